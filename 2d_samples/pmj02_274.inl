@@ -1,4096 +0,0 @@
-{std::array<float,2>{0.687545836f, 0.147023767f},
-std::array<float,2>{0.153295845f, 0.803818166f},
-std::array<float,2>{0.471190333f, 0.260475487f},
-std::array<float,2>{0.786717176f, 0.546524346f},
-std::array<float,2>{0.978775203f, 0.41009146f},
-std::array<float,2>{0.28090325f, 0.723331034f},
-std::array<float,2>{0.00552902278f, 0.102431074f},
-std::array<float,2>{0.610807896f, 0.921488047f},
-std::array<float,2>{0.8623299f, 0.0104874354f},
-std::array<float,2>{0.377370298f, 0.948120475f},
-std::array<float,2>{0.202266306f, 0.487864912f},
-std::array<float,2>{0.674353778f, 0.684968889f},
-std::array<float,2>{0.517374337f, 0.318893343f},
-std::array<float,2>{0.0894346833f, 0.598837137f},
-std::array<float,2>{0.322394997f, 0.241627425f},
-std::array<float,2>{0.904422939f, 0.85670495f},
-std::array<float,2>{0.585122168f, 0.0813266411f},
-std::array<float,2>{0.0358600095f, 0.905316472f},
-std::array<float,2>{0.304539472f, 0.389592886f},
-std::array<float,2>{0.968574882f, 0.699434102f},
-std::array<float,2>{0.759357035f, 0.29336375f},
-std::array<float,2>{0.440328836f, 0.514224648f},
-std::array<float,2>{0.162893742f, 0.176108524f},
-std::array<float,2>{0.723333478f, 0.772438824f},
-std::array<float,2>{0.913012087f, 0.195755526f},
-std::array<float,2>{0.351471305f, 0.821140528f},
-std::array<float,2>{0.109414533f, 0.359619737f},
-std::array<float,2>{0.559193194f, 0.570317745f},
-std::array<float,2>{0.641357124f, 0.446411312f},
-std::array<float,2>{0.246320635f, 0.642387986f},
-std::array<float,2>{0.416282475f, 0.0368096568f},
-std::array<float,2>{0.829663992f, 0.989997804f},
-std::array<float,2>{0.66549319f, 0.0504050925f},
-std::array<float,2>{0.20680736f, 0.969286501f},
-std::array<float,2>{0.393284351f, 0.453967303f},
-std::array<float,2>{0.854371727f, 0.636945963f},
-std::array<float,2>{0.883141279f, 0.353450537f},
-std::array<float,2>{0.336547613f, 0.586065114f},
-std::array<float,2>{0.0747900605f, 0.209348902f},
-std::array<float,2>{0.5032233f, 0.841211796f},
-std::array<float,2>{0.811964035f, 0.165659368f},
-std::array<float,2>{0.494681746f, 0.760280788f},
-std::array<float,2>{0.127116323f, 0.302992672f},
-std::array<float,2>{0.711670458f, 0.516786337f},
-std::array<float,2>{0.602301478f, 0.39234516f},
-std::array<float,2>{0.0272815712f, 0.709885001f},
-std::array<float,2>{0.262422562f, 0.0663254485f},
-std::array<float,2>{0.986171901f, 0.880451083f},
-std::array<float,2>{0.546324968f, 0.221495032f},
-std::array<float,2>{0.108677968f, 0.874836564f},
-std::array<float,2>{0.37025404f, 0.336935401f},
-std::array<float,2>{0.922364175f, 0.618137538f},
-std::array<float,2>{0.827060342f, 0.476488024f},
-std::array<float,2>{0.424815089f, 0.667205632f},
-std::array<float,2>{0.231061786f, 0.0271559265f},
-std::array<float,2>{0.635918617f, 0.964900196f},
-std::array<float,2>{0.947810411f, 0.116482593f},
-std::array<float,2>{0.290154487f, 0.928228796f},
-std::array<float,2>{0.0503541082f, 0.424300432f},
-std::array<float,2>{0.570313752f, 0.749358952f},
-std::array<float,2>{0.74812603f, 0.269643158f},
-std::array<float,2>{0.180431396f, 0.55866611f},
-std::array<float,2>{0.460687339f, 0.134665877f},
-std::array<float,2>{0.770159602f, 0.782768309f},
-std::array<float,2>{0.628979206f, 0.218466088f},
-std::array<float,2>{0.219595715f, 0.828488171f},
-std::array<float,2>{0.430081576f, 0.345716983f},
-std::array<float,2>{0.81759131f, 0.579430103f},
-std::array<float,2>{0.933384836f, 0.465440094f},
-std::array<float,2>{0.360100329f, 0.631854057f},
-std::array<float,2>{0.095098123f, 0.0590397343f},
-std::array<float,2>{0.537225306f, 0.983290613f},
-std::array<float,2>{0.780369163f, 0.0724663511f},
-std::array<float,2>{0.461910397f, 0.882990956f},
-std::array<float,2>{0.179184645f, 0.402685314f},
-std::array<float,2>{0.736466229f, 0.712611198f},
-std::array<float,2>{0.567342341f, 0.306664288f},
-std::array<float,2>{0.0560404807f, 0.530487061f},
-std::array<float,2>{0.284826696f, 0.156755716f},
-std::array<float,2>{0.942017972f, 0.752613187f},
-std::array<float,2>{0.511708677f, 0.021155443f},
-std::array<float,2>{0.0690598488f, 0.956937969f},
-std::array<float,2>{0.335747004f, 0.483622819f},
-std::array<float,2>{0.878643751f, 0.65881896f},
-std::array<float,2>{0.844283879f, 0.330582827f},
-std::array<float,2>{0.399539381f, 0.615694046f},
-std::array<float,2>{0.215688452f, 0.22935982f},
-std::array<float,2>{0.661491275f, 0.861688733f},
-std::array<float,2>{0.994946122f, 0.129153728f},
-std::array<float,2>{0.250738621f, 0.789835155f},
-std::array<float,2>{0.0197775178f, 0.274788111f},
-std::array<float,2>{0.594167888f, 0.54736495f},
-std::array<float,2>{0.709918499f, 0.43266356f},
-std::array<float,2>{0.133192033f, 0.73925519f},
-std::array<float,2>{0.487935305f, 0.119435646f},
-std::array<float,2>{0.801243722f, 0.934707105f},
-std::array<float,2>{0.731747508f, 0.100310221f},
-std::array<float,2>{0.169566706f, 0.910705805f},
-std::array<float,2>{0.447572619f, 0.420760334f},
-std::array<float,2>{0.750500619f, 0.732558548f},
-std::array<float,2>{0.960401654f, 0.257509887f},
-std::array<float,2>{0.308279425f, 0.538402855f},
-std::array<float,2>{0.0396379866f, 0.155832142f},
-std::array<float,2>{0.586872697f, 0.812376976f},
-std::array<float,2>{0.836020172f, 0.243600324f},
-std::array<float,2>{0.411053956f, 0.849331737f},
-std::array<float,2>{0.239357799f, 0.322110534f},
-std::array<float,2>{0.650134146f, 0.602114916f},
-std::array<float,2>{0.548134387f, 0.498521924f},
-std::array<float,2>{0.121018544f, 0.677543163f},
-std::array<float,2>{0.354315281f, 0.00138160714f},
-std::array<float,2>{0.917728126f, 0.943362832f},
-std::array<float,2>{0.622404933f, 0.180257425f},
-std::array<float,2>{0.0115869259f, 0.776055336f},
-std::array<float,2>{0.268331021f, 0.283353508f},
-std::array<float,2>{0.971245348f, 0.504242897f},
-std::array<float,2>{0.792849898f, 0.380678624f},
-std::array<float,2>{0.483658195f, 0.688827157f},
-std::array<float,2>{0.143006861f, 0.0893904418f},
-std::array<float,2>{0.700181544f, 0.891699851f},
-std::array<float,2>{0.894414842f, 0.0437263325f},
-std::array<float,2>{0.31769371f, 0.999779344f},
-std::array<float,2>{0.0805108622f, 0.444771349f},
-std::array<float,2>{0.529301941f, 0.649758577f},
-std::array<float,2>{0.682699084f, 0.37191844f},
-std::array<float,2>{0.189813927f, 0.565884948f},
-std::array<float,2>{0.384991646f, 0.193365261f},
-std::array<float,2>{0.872395873f, 0.813976765f},
-std::array<float,2>{0.739531398f, 0.237664402f},
-std::array<float,2>{0.172765017f, 0.853241742f},
-std::array<float,2>{0.466713428f, 0.313411593f},
-std::array<float,2>{0.77528578f, 0.595152974f},
-std::array<float,2>{0.937881827f, 0.489218563f},
-std::array<float,2>{0.28829965f, 0.681780756f},
-std::array<float,2>{0.0621795319f, 0.0120620476f},
-std::array<float,2>{0.565872014f, 0.951041162f},
-std::array<float,2>{0.816366911f, 0.108285308f},
-std::array<float,2>{0.436837494f, 0.917298317f},
-std::array<float,2>{0.224576458f, 0.411776513f},
-std::array<float,2>{0.62562573f, 0.722275794f},
-std::array<float,2>{0.532160521f, 0.263254195f},
-std::array<float,2>{0.0987477675f, 0.541885078f},
-std::array<float,2>{0.363951564f, 0.141256317f},
-std::array<float,2>{0.937015533f, 0.799679339f},
-std::array<float,2>{0.600101709f, 0.0349298976f},
-std::array<float,2>{0.0160101205f, 0.987142324f},
-std::array<float,2>{0.254653543f, 0.449288577f},
-std::array<float,2>{0.998482764f, 0.645218313f},
-std::array<float,2>{0.797358751f, 0.363578975f},
-std::array<float,2>{0.490790576f, 0.577097535f},
-std::array<float,2>{0.137207747f, 0.202961028f},
-std::array<float,2>{0.705810308f, 0.824956357f},
-std::array<float,2>{0.881563842f, 0.172257498f},
-std::array<float,2>{0.330733448f, 0.766367853f},
-std::array<float,2>{0.0629813299f, 0.291799754f},
-std::array<float,2>{0.514601648f, 0.51052767f},
-std::array<float,2>{0.65704906f, 0.385377139f},
-std::array<float,2>{0.212630808f, 0.695934176f},
-std::array<float,2>{0.404540271f, 0.0844551399f},
-std::array<float,2>{0.851041377f, 0.899071753f},
-std::array<float,2>{0.652711213f, 0.0673422441f},
-std::array<float,2>{0.238171384f, 0.876457155f},
-std::array<float,2>{0.406874269f, 0.395172864f},
-std::array<float,2>{0.842354119f, 0.70558691f},
-std::array<float,2>{0.919998407f, 0.296883732f},
-std::array<float,2>{0.355615169f, 0.522130072f},
-std::array<float,2>{0.122524209f, 0.169463798f},
-std::array<float,2>{0.552914977f, 0.763103366f},
-std::array<float,2>{0.756196558f, 0.205361173f},
-std::array<float,2>{0.45141843f, 0.839249313f},
-std::array<float,2>{0.167360693f, 0.356912613f},
-std::array<float,2>{0.729581892f, 0.591801405f},
-std::array<float,2>{0.592294395f, 0.460885048f},
-std::array<float,2>{0.0465212315f, 0.635182738f},
-std::array<float,2>{0.311827868f, 0.0523537695f},
-std::array<float,2>{0.954948962f, 0.975976169f},
-std::array<float,2>{0.527202249f, 0.138465285f},
-std::array<float,2>{0.0829795077f, 0.785893977f},
-std::array<float,2>{0.312723309f, 0.267048776f},
-std::array<float,2>{0.894620419f, 0.558537662f},
-std::array<float,2>{0.868667901f, 0.426050454f},
-std::array<float,2>{0.387771219f, 0.74514401f},
-std::array<float,2>{0.191753611f, 0.112495862f},
-std::array<float,2>{0.68566066f, 0.923611462f},
-std::array<float,2>{0.974250853f, 0.0282027908f},
-std::array<float,2>{0.271956682f, 0.963338733f},
-std::array<float,2>{0.0136216888f, 0.46958667f},
-std::array<float,2>{0.61828649f, 0.669347525f},
-std::array<float,2>{0.695450306f, 0.342853427f},
-std::array<float,2>{0.145155653f, 0.624918699f},
-std::array<float,2>{0.479063928f, 0.224382579f},
-std::array<float,2>{0.796799958f, 0.867909312f},
-std::array<float,2>{0.678174138f, 0.16048263f},
-std::array<float,2>{0.197281405f, 0.755270183f},
-std::array<float,2>{0.378928691f, 0.31151858f},
-std::array<float,2>{0.864032686f, 0.526588142f},
-std::array<float,2>{0.902180851f, 0.399156928f},
-std::array<float,2>{0.327638835f, 0.716204822f},
-std::array<float,2>{0.0927503407f, 0.0759734958f},
-std::array<float,2>{0.521048307f, 0.889362276f},
-std::array<float,2>{0.783840656f, 0.0576432273f},
-std::array<float,2>{0.475047618f, 0.978021204f},
-std::array<float,2>{0.152051836f, 0.462929577f},
-std::array<float,2>{0.693291664f, 0.626781642f},
-std::array<float,2>{0.614009976f, 0.348578125f},
-std::array<float,2>{0.00275744498f, 0.583904207f},
-std::array<float,2>{0.275303215f, 0.21296072f},
-std::array<float,2>{0.983373702f, 0.83454597f},
-std::array<float,2>{0.556804657f, 0.121428296f},
-std::array<float,2>{0.116317287f, 0.931053638f},
-std::array<float,2>{0.343934774f, 0.435193628f},
-std::array<float,2>{0.907768846f, 0.736747622f},
-std::array<float,2>{0.834825099f, 0.280109137f},
-std::array<float,2>{0.418350399f, 0.552186906f},
-std::array<float,2>{0.245189056f, 0.126395389f},
-std::array<float,2>{0.647459745f, 0.793447077f},
-std::array<float,2>{0.963334441f, 0.23376362f},
-std::array<float,2>{0.300632805f, 0.864743352f},
-std::array<float,2>{0.0344184227f, 0.332620323f},
-std::array<float,2>{0.581778586f, 0.612706125f},
-std::array<float,2>{0.720480919f, 0.480127782f},
-std::array<float,2>{0.15823251f, 0.660221279f},
-std::array<float,2>{0.445283771f, 0.0159860197f},
-std::array<float,2>{0.761723161f, 0.96042335f},
-std::array<float,2>{0.71559906f, 0.00634110114f},
-std::array<float,2>{0.132413983f, 0.941118598f},
-std::array<float,2>{0.499130189f, 0.492698818f},
-std::array<float,2>{0.806643844f, 0.675265074f},
-std::array<float,2>{0.988748312f, 0.324275941f},
-std::array<float,2>{0.260674894f, 0.607980609f},
-std::array<float,2>{0.0275501683f, 0.248768941f},
-std::array<float,2>{0.60556674f, 0.847577691f},
-std::array<float,2>{0.85907042f, 0.150212675f},
-std::array<float,2>{0.397657037f, 0.806742966f},
-std::array<float,2>{0.210340917f, 0.251509428f},
-std::array<float,2>{0.67066747f, 0.534322321f},
-std::array<float,2>{0.507363677f, 0.417856783f},
-std::array<float,2>{0.073648788f, 0.727032721f},
-std::array<float,2>{0.341644287f, 0.0972600505f},
-std::array<float,2>{0.888930976f, 0.909448922f},
-std::array<float,2>{0.575141728f, 0.190244168f},
-std::array<float,2>{0.0510431156f, 0.82017678f},
-std::array<float,2>{0.295475453f, 0.370548278f},
-std::array<float,2>{0.949397922f, 0.569307327f},
-std::array<float,2>{0.767714918f, 0.438136846f},
-std::array<float,2>{0.453613997f, 0.652522504f},
-std::array<float,2>{0.187027246f, 0.0397646576f},
-std::array<float,2>{0.745542109f, 0.995770395f},
-std::array<float,2>{0.929165363f, 0.091316998f},
-std::array<float,2>{0.371242523f, 0.897968292f},
-std::array<float,2>{0.103539072f, 0.376703113f},
-std::array<float,2>{0.542085946f, 0.692319214f},
-std::array<float,2>{0.640037298f, 0.287043422f},
-std::array<float,2>{0.229591399f, 0.501557291f},
-std::array<float,2>{0.428290576f, 0.185517699f},
-std::array<float,2>{0.822637022f, 0.779517591f},
-std::array<float,2>{0.724720776f, 0.177741319f},
-std::array<float,2>{0.160685942f, 0.770273089f},
-std::array<float,2>{0.439418137f, 0.29667595f},
-std::array<float,2>{0.761180639f, 0.512628853f},
-std::array<float,2>{0.965560317f, 0.388472766f},
-std::array<float,2>{0.3014386f, 0.702327251f},
-std::array<float,2>{0.0388246812f, 0.0786591247f},
-std::array<float,2>{0.583571434f, 0.903230071f},
-std::array<float,2>{0.830465913f, 0.0383203439f},
-std::array<float,2>{0.415526122f, 0.991808593f},
-std::array<float,2>{0.249474287f, 0.447277665f},
-std::array<float,2>{0.64271456f, 0.643789649f},
-std::array<float,2>{0.560609519f, 0.361611038f},
-std::array<float,2>{0.112518266f, 0.57370919f},
-std::array<float,2>{0.349091649f, 0.198078573f},
-std::array<float,2>{0.910420775f, 0.822328806f},
-std::array<float,2>{0.61258328f, 0.104786068f},
-std::array<float,2>{0.00646400359f, 0.918648183f},
-std::array<float,2>{0.278836519f, 0.406390071f},
-std::array<float,2>{0.977111816f, 0.726110518f},
-std::array<float,2>{0.788103461f, 0.259294271f},
-std::array<float,2>{0.470570177f, 0.543949068f},
-std::array<float,2>{0.155070007f, 0.145990744f},
-std::array<float,2>{0.691132963f, 0.801448584f},
-std::array<float,2>{0.903439939f, 0.238588303f},
-std::array<float,2>{0.321574688f, 0.858739197f},
-std::array<float,2>{0.0867049322f, 0.317938387f},
-std::array<float,2>{0.518393755f, 0.601534307f},
-std::array<float,2>{0.672661185f, 0.485645026f},
-std::array<float,2>{0.200688839f, 0.687011063f},
-std::array<float,2>{0.375485301f, 0.00932335015f},
-std::array<float,2>{0.860446692f, 0.946670532f},
-std::array<float,2>{0.63340342f, 0.0237037782f},
-std::array<float,2>{0.232531846f, 0.96727103f},
-std::array<float,2>{0.422439665f, 0.474496186f},
-std::array<float,2>{0.825108647f, 0.664063692f},
-std::array<float,2>{0.925639272f, 0.338856548f},
-std::array<float,2>{0.368685782f, 0.620755494f},
-std::array<float,2>{0.106001928f, 0.220547944f},
-std::array<float,2>{0.543150485f, 0.872340262f},
-std::array<float,2>{0.772876799f, 0.1364685f},
-std::array<float,2>{0.457512796f, 0.784605801f},
-std::array<float,2>{0.182968915f, 0.272649348f},
-std::array<float,2>{0.747528076f, 0.560820103f},
-std::array<float,2>{0.573357046f, 0.423379809f},
-std::array<float,2>{0.0478864722f, 0.747789562f},
-std::array<float,2>{0.292843729f, 0.114475936f},
-std::array<float,2>{0.946905673f, 0.926656306f},
-std::array<float,2>{0.50153029f, 0.208045349f},
-std::array<float,2>{0.0778076574f, 0.842445135f},
-std::array<float,2>{0.339641899f, 0.354979903f},
-std::array<float,2>{0.88494271f, 0.588334143f},
-std::array<float,2>{0.851792276f, 0.456896663f},
-std::array<float,2>{0.3918598f, 0.640405536f},
-std::array<float,2>{0.204620048f, 0.0475307442f},
-std::array<float,2>{0.66756475f, 0.971147776f},
-std::array<float,2>{0.987440169f, 0.0640623868f},
-std::array<float,2>{0.265419781f, 0.881798267f},
-std::array<float,2>{0.0239216276f, 0.393993497f},
-std::array<float,2>{0.605022788f, 0.708543599f},
-std::array<float,2>{0.714041591f, 0.302515864f},
-std::array<float,2>{0.12635541f, 0.517817974f},
-std::array<float,2>{0.492704511f, 0.166694224f},
-std::array<float,2>{0.809213817f, 0.757994473f},
-std::array<float,2>{0.663948536f, 0.226650029f},
-std::array<float,2>{0.217491359f, 0.861291051f},
-std::array<float,2>{0.401913047f, 0.329932183f},
-std::array<float,2>{0.847423315f, 0.613668919f},
-std::array<float,2>{0.875283897f, 0.481690139f},
-std::array<float,2>{0.333228171f, 0.656833112f},
-std::array<float,2>{0.0673357248f, 0.0222563446f},
-std::array<float,2>{0.509521484f, 0.953961909f},
-std::array<float,2>{0.804445088f, 0.118297935f},
-std::array<float,2>{0.48579827f, 0.935740709f},
-std::array<float,2>{0.136160076f, 0.430935293f},
-std::array<float,2>{0.708976567f, 0.741727769f},
-std::array<float,2>{0.597217441f, 0.276806265f},
-std::array<float,2>{0.023253303f, 0.549776018f},
-std::array<float,2>{0.252683342f, 0.131540328f},
-std::array<float,2>{0.99360323f, 0.792430401f},
-std::array<float,2>{0.536258578f, 0.060999129f},
-std::array<float,2>{0.0974985212f, 0.982212245f},
-std::array<float,2>{0.362691343f, 0.468382388f},
-std::array<float,2>{0.929953694f, 0.630106032f},
-std::array<float,2>{0.820126414f, 0.345433414f},
-std::array<float,2>{0.432668597f, 0.580527902f},
-std::array<float,2>{0.222172618f, 0.216573372f},
-std::array<float,2>{0.631648064f, 0.831579149f},
-std::array<float,2>{0.944968939f, 0.159082696f},
-std::array<float,2>{0.281902134f, 0.751071811f},
-std::array<float,2>{0.0582654849f, 0.304849118f},
-std::array<float,2>{0.568810165f, 0.527885258f},
-std::array<float,2>{0.73535645f, 0.405106544f},
-std::array<float,2>{0.175998598f, 0.713257492f},
-std::array<float,2>{0.464055806f, 0.0721857473f},
-std::array<float,2>{0.778937161f, 0.886535585f},
-std::array<float,2>{0.701881886f, 0.0876347944f},
-std::array<float,2>{0.140666083f, 0.893729746f},
-std::array<float,2>{0.481782675f, 0.381404757f},
-std::array<float,2>{0.790898323f, 0.689974427f},
-std::array<float,2>{0.970311046f, 0.283095628f},
-std::array<float,2>{0.267465562f, 0.506602108f},
-std::array<float,2>{0.00915001333f, 0.183211297f},
-std::array<float,2>{0.624264717f, 0.775210202f},
-std::array<float,2>{0.874693155f, 0.192807972f},
-std::array<float,2>{0.38418144f, 0.815261066f},
-std::array<float,2>{0.188384876f, 0.373741746f},
-std::array<float,2>{0.681552112f, 0.564177871f},
-std::array<float,2>{0.529194772f, 0.443137407f},
-std::array<float,2>{0.0792337433f, 0.651618123f},
-std::array<float,2>{0.319210738f, 0.0459513292f},
-std::array<float,2>{0.891155541f, 0.997970581f},
-std::array<float,2>{0.587916911f, 0.153632909f},
-std::array<float,2>{0.0416370109f, 0.809197247f},
-std::array<float,2>{0.304969192f, 0.254961669f},
-std::array<float,2>{0.958687365f, 0.536523759f},
-std::array<float,2>{0.753269076f, 0.419646084f},
-std::array<float,2>{0.445824921f, 0.730478346f},
-std::array<float,2>{0.170905054f, 0.0976995081f},
-std::array<float,2>{0.733970523f, 0.912323654f},
-std::array<float,2>{0.916004062f, 0.00268881791f},
-std::array<float,2>{0.352430969f, 0.942947328f},
-std::array<float,2>{0.117803887f, 0.496934772f},
-std::array<float,2>{0.550036252f, 0.679020047f},
-std::array<float,2>{0.651788712f, 0.322857887f},
-std::array<float,2>{0.2404643f, 0.604341328f},
-std::array<float,2>{0.413569301f, 0.244900137f},
-std::array<float,2>{0.839551628f, 0.849670351f},
-std::array<float,2>{0.704793632f, 0.199871212f},
-std::array<float,2>{0.139764786f, 0.827650845f},
-std::array<float,2>{0.490129322f, 0.365847021f},
-std::array<float,2>{0.800553679f, 0.575001061f},
-std::array<float,2>{0.996272802f, 0.453050524f},
-std::array<float,2>{0.257756531f, 0.64738971f},
-std::array<float,2>{0.0192552023f, 0.0324088633f},
-std::array<float,2>{0.59924072f, 0.985576749f},
-std::array<float,2>{0.848413765f, 0.0823765025f},
-std::array<float,2>{0.403511852f, 0.901158035f},
-std::array<float,2>{0.214255065f, 0.384096295f},
-std::array<float,2>{0.659139156f, 0.698842108f},
-std::array<float,2>{0.513124764f, 0.289106578f},
-std::array<float,2>{0.0656629577f, 0.509214282f},
-std::array<float,2>{0.329396456f, 0.174448684f},
-std::array<float,2>{0.8804456f, 0.769102871f},
-std::array<float,2>{0.562997103f, 0.0152011495f},
-std::array<float,2>{0.0602835752f, 0.951908946f},
-std::array<float,2>{0.285303086f, 0.490713805f},
-std::array<float,2>{0.941176772f, 0.680981576f},
-std::array<float,2>{0.776315749f, 0.315723807f},
-std::array<float,2>{0.467008114f, 0.597095251f},
-std::array<float,2>{0.17420955f, 0.235103965f},
-std::array<float,2>{0.741487324f, 0.854260445f},
-std::array<float,2>{0.934912503f, 0.14317216f},
-std::array<float,2>{0.366600841f, 0.79853332f},
-std::array<float,2>{0.100839719f, 0.264676154f},
-std::array<float,2>{0.533950806f, 0.539494276f},
-std::array<float,2>{0.62735182f, 0.412401915f},
-std::array<float,2>{0.225784302f, 0.718946934f},
-std::array<float,2>{0.434052229f, 0.105887085f},
-std::array<float,2>{0.812567174f, 0.914866626f},
-std::array<float,2>{0.685104728f, 0.111012116f},
-std::array<float,2>{0.194661796f, 0.924786985f},
-std::array<float,2>{0.39008376f, 0.428799778f},
-std::array<float,2>{0.870134711f, 0.743705094f},
-std::array<float,2>{0.897590578f, 0.268023521f},
-std::array<float,2>{0.316037744f, 0.556354761f},
-std::array<float,2>{0.0845814943f, 0.14043504f},
-std::array<float,2>{0.525330067f, 0.788968384f},
-std::array<float,2>{0.79462254f, 0.225717619f},
-std::array<float,2>{0.477684557f, 0.869263411f},
-std::array<float,2>{0.148337051f, 0.340814352f},
-std::array<float,2>{0.698978424f, 0.622488618f},
-std::array<float,2>{0.621042311f, 0.471876889f},
-std::array<float,2>{0.0155034019f, 0.670619249f},
-std::array<float,2>{0.27081418f, 0.0293416195f},
-std::array<float,2>{0.975972712f, 0.962810397f},
-std::array<float,2>{0.551230848f, 0.171314389f},
-std::array<float,2>{0.124179505f, 0.764553666f},
-std::array<float,2>{0.359180391f, 0.299177557f},
-std::array<float,2>{0.919684529f, 0.519612432f},
-std::array<float,2>{0.840530992f, 0.396547586f},
-std::array<float,2>{0.408894926f, 0.704920828f},
-std::array<float,2>{0.235055119f, 0.069985792f},
-std::array<float,2>{0.654817283f, 0.877197266f},
-std::array<float,2>{0.955459356f, 0.0537628084f},
-std::array<float,2>{0.309909046f, 0.972929239f},
-std::array<float,2>{0.043336425f, 0.458008289f},
-std::array<float,2>{0.590323508f, 0.633485079f},
-std::array<float,2>{0.728267848f, 0.357765615f},
-std::array<float,2>{0.165578127f, 0.590459168f},
-std::array<float,2>{0.451088935f, 0.203369632f},
-std::array<float,2>{0.754436374f, 0.837258577f},
-std::array<float,2>{0.645942152f, 0.128180981f},
-std::array<float,2>{0.243348897f, 0.796738327f},
-std::array<float,2>{0.420544326f, 0.278028339f},
-std::array<float,2>{0.832176507f, 0.553975165f},
-std::array<float,2>{0.90954715f, 0.437335759f},
-std::array<float,2>{0.346785456f, 0.734439254f},
-std::array<float,2>{0.113834754f, 0.123544872f},
-std::array<float,2>{0.555814207f, 0.93282187f},
-std::array<float,2>{0.764343381f, 0.0177138019f},
-std::array<float,2>{0.442758352f, 0.957178652f},
-std::array<float,2>{0.157973871f, 0.478008687f},
-std::array<float,2>{0.720930576f, 0.663323224f},
-std::array<float,2>{0.579706311f, 0.335367322f},
-std::array<float,2>{0.0320025384f, 0.610796809f},
-std::array<float,2>{0.297351062f, 0.230514184f},
-std::array<float,2>{0.961532831f, 0.865440488f},
-std::array<float,2>{0.523118436f, 0.0766493827f},
-std::array<float,2>{0.0915356427f, 0.888073683f},
-std::array<float,2>{0.324604541f, 0.402158678f},
-std::array<float,2>{0.899329066f, 0.71813345f},
-std::array<float,2>{0.86703074f, 0.309461623f},
-std::array<float,2>{0.380977631f, 0.524347901f},
-std::array<float,2>{0.195379511f, 0.163917527f},
-std::array<float,2>{0.676541686f, 0.756296098f},
-std::array<float,2>{0.981796443f, 0.21120216f},
-std::array<float,2>{0.277261883f, 0.833714306f},
-std::array<float,2>{0.00177611888f, 0.351351053f},
-std::array<float,2>{0.617031991f, 0.585837364f},
-std::array<float,2>{0.69360292f, 0.462420464f},
-std::array<float,2>{0.148824632f, 0.62713486f},
-std::array<float,2>{0.473972529f, 0.054696966f},
-std::array<float,2>{0.782091022f, 0.978832185f},
-std::array<float,2>{0.742390156f, 0.0414532833f},
-std::array<float,2>{0.184336409f, 0.992402673f},
-std::array<float,2>{0.456279665f, 0.439671725f},
-std::array<float,2>{0.766429603f, 0.655649304f},
-std::array<float,2>{0.951954365f, 0.367512792f},
-std::array<float,2>{0.294879079f, 0.567904174f},
-std::array<float,2>{0.0532475747f, 0.188687801f},
-std::array<float,2>{0.57689482f, 0.818130493f},
-std::array<float,2>{0.820670903f, 0.18690753f},
-std::array<float,2>{0.427446902f, 0.778423011f},
-std::array<float,2>{0.22814782f, 0.287961602f},
-std::array<float,2>{0.637206972f, 0.502992511f},
-std::array<float,2>{0.540211439f, 0.378100485f},
-std::array<float,2>{0.103406817f, 0.694482923f},
-std::array<float,2>{0.37455833f, 0.0926309004f},
-std::array<float,2>{0.927223861f, 0.894599438f},
-std::array<float,2>{0.60928756f, 0.246958122f},
-std::array<float,2>{0.0300257374f, 0.844317257f},
-std::array<float,2>{0.25841096f, 0.327021688f},
-std::array<float,2>{0.990425169f, 0.607047677f},
-std::array<float,2>{0.805715144f, 0.494977623f},
-std::array<float,2>{0.496097267f, 0.672463894f},
-std::array<float,2>{0.129876152f, 0.00392092811f},
-std::array<float,2>{0.71846509f, 0.938909948f},
-std::array<float,2>{0.888326883f, 0.0941841751f},
-std::array<float,2>{0.342009932f, 0.906255126f},
-std::array<float,2>{0.0706710219f, 0.415788323f},
-std::array<float,2>{0.504202843f, 0.729669154f},
-std::array<float,2>{0.668561637f, 0.253613114f},
-std::array<float,2>{0.208442912f, 0.532536089f},
-std::array<float,2>{0.395211965f, 0.151699424f},
-std::array<float,2>{0.856078029f, 0.805068672f},
-std::array<float,2>{0.712650239f, 0.167293698f},
-std::array<float,2>{0.128713936f, 0.75910908f},
-std::array<float,2>{0.495212436f, 0.301134914f},
-std::array<float,2>{0.810782254f, 0.519156516f},
-std::array<float,2>{0.984416187f, 0.393214285f},
-std::array<float,2>{0.262950838f, 0.707489669f},
-std::array<float,2>{0.0262748692f, 0.0633718967f},
-std::array<float,2>{0.602878869f, 0.8827281f},
-std::array<float,2>{0.85532105f, 0.0483798496f},
-std::array<float,2>{0.394480258f, 0.972509742f},
-std::array<float,2>{0.20534867f, 0.455957234f},
-std::array<float,2>{0.664772153f, 0.639044702f},
-std::array<float,2>{0.50257951f, 0.353857279f},
-std::array<float,2>{0.0755265951f, 0.589044631f},
-std::array<float,2>{0.33700949f, 0.20719023f},
-std::array<float,2>{0.884601831f, 0.843465567f},
-std::array<float,2>{0.571697116f, 0.114116155f},
-std::array<float,2>{0.049382966f, 0.927438259f},
-std::array<float,2>{0.289146274f, 0.422039509f},
-std::array<float,2>{0.948996663f, 0.746583939f},
-std::array<float,2>{0.771008313f, 0.271949798f},
-std::array<float,2>{0.459044367f, 0.561777115f},
-std::array<float,2>{0.181447983f, 0.135502219f},
-std::array<float,2>{0.749480903f, 0.783428788f},
-std::array<float,2>{0.922952652f, 0.21885927f},
-std::array<float,2>{0.369922251f, 0.871681273f},
-std::array<float,2>{0.107838646f, 0.33906275f},
-std::array<float,2>{0.545570552f, 0.619891822f},
-std::array<float,2>{0.635120988f, 0.473013401f},
-std::array<float,2>{0.231913909f, 0.665214717f},
-std::array<float,2>{0.424444318f, 0.0246172808f},
-std::array<float,2>{0.827952802f, 0.968064368f},
-std::array<float,2>{0.675731301f, 0.00792494137f},
-std::array<float,2>{0.202020407f, 0.945764124f},
-std::array<float,2>{0.378695935f, 0.484656394f},
-std::array<float,2>{0.862281501f, 0.686082006f},
-std::array<float,2>{0.906015575f, 0.316746026f},
-std::array<float,2>{0.323836088f, 0.60053736f},
-std::array<float,2>{0.0881962031f, 0.239989221f},
-std::array<float,2>{0.515919626f, 0.85831207f},
-std::array<float,2>{0.78611666f, 0.144825637f},
-std::array<float,2>{0.472620755f, 0.802120924f},
-std::array<float,2>{0.153507903f, 0.258233577f},
-std::array<float,2>{0.688878596f, 0.543224335f},
-std::array<float,2>{0.609687924f, 0.407702833f},
-std::array<float,2>{0.00410608249f, 0.725093603f},
-std::array<float,2>{0.27933529f, 0.103843391f},
-std::array<float,2>{0.980295539f, 0.91968447f},
-std::array<float,2>{0.559895456f, 0.19826521f},
-std::array<float,2>{0.111227788f, 0.823658884f},
-std::array<float,2>{0.349792719f, 0.362595499f},
-std::array<float,2>{0.914006889f, 0.572951138f},
-std::array<float,2>{0.828292429f, 0.448270679f},
-std::array<float,2>{0.417090744f, 0.643057764f},
-std::array<float,2>{0.247654706f, 0.0380385183f},
-std::array<float,2>{0.641829252f, 0.990604281f},
-std::array<float,2>{0.967679322f, 0.0795716718f},
-std::array<float,2>{0.303509116f, 0.903762341f},
-std::array<float,2>{0.0367370881f, 0.387619376f},
-std::array<float,2>{0.584540069f, 0.702015996f},
-std::array<float,2>{0.724332333f, 0.29513219f},
-std::array<float,2>{0.163384885f, 0.513391614f},
-std::array<float,2>{0.44092387f, 0.178717181f},
-std::array<float,2>{0.758173168f, 0.770563424f},
-std::array<float,2>{0.648777127f, 0.245636329f},
-std::array<float,2>{0.238524631f, 0.851191223f},
-std::array<float,2>{0.412047386f, 0.324146986f},
-std::array<float,2>{0.837621331f, 0.604943216f},
-std::array<float,2>{0.916245699f, 0.497988701f},
-std::array<float,2>{0.354759306f, 0.677911937f},
-std::array<float,2>{0.119857058f, 0.00330232247f},
-std::array<float,2>{0.547362506f, 0.941548109f},
-std::array<float,2>{0.751729548f, 0.0993660241f},
-std::array<float,2>{0.448765218f, 0.913601816f},
-std::array<float,2>{0.16858387f, 0.418819308f},
-std::array<float,2>{0.730639696f, 0.732009292f},
-std::array<float,2>{0.587780237f, 0.25437215f},
-std::array<float,2>{0.0406170078f, 0.535756707f},
-std::array<float,2>{0.307530314f, 0.153182745f},
-std::array<float,2>{0.959115386f, 0.810240209f},
-std::array<float,2>{0.530325174f, 0.0453520492f},
-std::array<float,2>{0.0815212652f, 0.996989727f},
-std::array<float,2>{0.316951841f, 0.44164449f},
-std::array<float,2>{0.893213153f, 0.650987983f},
-std::array<float,2>{0.871838152f, 0.374180734f},
-std::array<float,2>{0.385989487f, 0.562959731f},
-std::array<float,2>{0.190839201f, 0.192012504f},
-std::array<float,2>{0.6818735f, 0.815831602f},
-std::array<float,2>{0.972236395f, 0.182186216f},
-std::array<float,2>{0.268652499f, 0.774338841f},
-std::array<float,2>{0.0100782793f, 0.281805098f},
-std::array<float,2>{0.621118009f, 0.507022738f},
-std::array<float,2>{0.700879514f, 0.3824929f},
-std::array<float,2>{0.143590972f, 0.691128314f},
-std::array<float,2>{0.482788473f, 0.0860740691f},
-std::array<float,2>{0.791712224f, 0.893191159f},
-std::array<float,2>{0.737876415f, 0.0712359622f},
-std::array<float,2>{0.178043783f, 0.885393739f},
-std::array<float,2>{0.462706327f, 0.40581122f},
-std::array<float,2>{0.780189037f, 0.714664638f},
-std::array<float,2>{0.942678869f, 0.305911869f},
-std::array<float,2>{0.283545047f, 0.528325617f},
-std::array<float,2>{0.0549843833f, 0.15981026f},
-std::array<float,2>{0.567854404f, 0.750809312f},
-std::array<float,2>{0.817219138f, 0.215451121f},
-std::array<float,2>{0.431015223f, 0.830559313f},
-std::array<float,2>{0.220077425f, 0.343820542f},
-std::array<float,2>{0.630407691f, 0.581425667f},
-std::array<float,2>{0.53881526f, 0.467496485f},
-std::array<float,2>{0.0939166769f, 0.629095614f},
-std::array<float,2>{0.361008376f, 0.0623713285f},
-std::array<float,2>{0.931707203f, 0.980728567f},
-std::array<float,2>{0.595319808f, 0.132237658f},
-std::array<float,2>{0.021061698f, 0.791742444f},
-std::array<float,2>{0.251939267f, 0.276299179f},
-std::array<float,2>{0.995856345f, 0.550774992f},
-std::array<float,2>{0.802209198f, 0.43037653f},
-std::array<float,2>{0.486635357f, 0.740990996f},
-std::array<float,2>{0.134114578f, 0.117224842f},
-std::array<float,2>{0.710220397f, 0.937480986f},
-std::array<float,2>{0.87700063f, 0.0228965562f},
-std::array<float,2>{0.334238291f, 0.954592228f},
-std::array<float,2>{0.0697579086f, 0.481054723f},
-std::array<float,2>{0.510383546f, 0.657505929f},
-std::array<float,2>{0.660370409f, 0.328153849f},
-std::array<float,2>{0.216504201f, 0.614733338f},
-std::array<float,2>{0.399235994f, 0.228412867f},
-std::array<float,2>{0.844909906f, 0.859890521f},
-std::array<float,2>{0.728855729f, 0.204173103f},
-std::array<float,2>{0.166614488f, 0.836621642f},
-std::array<float,2>{0.45299843f, 0.358557582f},
-std::array<float,2>{0.757276952f, 0.591532409f},
-std::array<float,2>{0.953716755f, 0.457356185f},
-std::array<float,2>{0.310959548f, 0.63403511f},
-std::array<float,2>{0.0457867049f, 0.0529597774f},
-std::array<float,2>{0.592919528f, 0.974599004f},
-std::array<float,2>{0.842930377f, 0.0685712993f},
-std::array<float,2>{0.40725264f, 0.877995968f},
-std::array<float,2>{0.236438721f, 0.398132414f},
-std::array<float,2>{0.654068649f, 0.703196526f},
-std::array<float,2>{0.554382801f, 0.300542325f},
-std::array<float,2>{0.122023836f, 0.52101773f},
-std::array<float,2>{0.357079059f, 0.170492411f},
-std::array<float,2>{0.921073914f, 0.764663875f},
-std::array<float,2>{0.617932498f, 0.0305505041f},
-std::array<float,2>{0.012170692f, 0.961818755f},
-std::array<float,2>{0.273369491f, 0.471509486f},
-std::array<float,2>{0.973260343f, 0.671249986f},
-std::array<float,2>{0.795826554f, 0.341773331f},
-std::array<float,2>{0.479901165f, 0.621914864f},
-std::array<float,2>{0.145663276f, 0.225381911f},
-std::array<float,2>{0.696603f, 0.870702744f},
-std::array<float,2>{0.896314442f, 0.138921633f},
-std::array<float,2>{0.314451814f, 0.787681758f},
-std::array<float,2>{0.0836272165f, 0.268799007f},
-std::array<float,2>{0.525694728f, 0.555424094f},
-std::array<float,2>{0.686835587f, 0.428462744f},
-std::array<float,2>{0.192411304f, 0.742529094f},
-std::array<float,2>{0.387215912f, 0.110055737f},
-std::array<float,2>{0.867774487f, 0.9252249f},
-std::array<float,2>{0.626257896f, 0.107385702f},
-std::array<float,2>{0.222967401f, 0.915574372f},
-std::array<float,2>{0.43633613f, 0.414018393f},
-std::array<float,2>{0.814644098f, 0.720638156f},
-std::array<float,2>{0.936072648f, 0.264294982f},
-std::array<float,2>{0.365155309f, 0.540975094f},
-std::array<float,2>{0.0982206836f, 0.143807903f},
-std::array<float,2>{0.532233536f, 0.797459662f},
-std::array<float,2>{0.773960948f, 0.235812292f},
-std::array<float,2>{0.465621978f, 0.854541063f},
-std::array<float,2>{0.173694655f, 0.31494537f},
-std::array<float,2>{0.739016712f, 0.596561909f},
-std::array<float,2>{0.564513505f, 0.491595179f},
-std::array<float,2>{0.0614782348f, 0.680040836f},
-std::array<float,2>{0.287843138f, 0.01457409f},
-std::array<float,2>{0.939226985f, 0.952440619f},
-std::array<float,2>{0.515472829f, 0.17566967f},
-std::array<float,2>{0.0642790347f, 0.768032789f},
-std::array<float,2>{0.331441969f, 0.290578634f},
-std::array<float,2>{0.882332861f, 0.508054078f},
-std::array<float,2>{0.849833548f, 0.383494854f},
-std::array<float,2>{0.406125039f, 0.697332025f},
-std::array<float,2>{0.210962161f, 0.0833285451f},
-std::array<float,2>{0.657867193f, 0.90197742f},
-std::array<float,2>{0.99920541f, 0.0313714631f},
-std::array<float,2>{0.25508374f, 0.984586656f},
-std::array<float,2>{0.0166552495f, 0.452036172f},
-std::array<float,2>{0.601394236f, 0.648409247f},
-std::array<float,2>{0.706221044f, 0.366513908f},
-std::array<float,2>{0.138601646f, 0.575691938f},
-std::array<float,2>{0.491803974f, 0.200428233f},
-std::array<float,2>{0.798789859f, 0.826884329f},
-std::array<float,2>{0.671505511f, 0.151238635f},
-std::array<float,2>{0.20915997f, 0.806147814f},
-std::array<float,2>{0.396722585f, 0.252388746f},
-std::array<float,2>{0.85817498f, 0.531997263f},
-std::array<float,2>{0.889910877f, 0.41406554f},
-std::array<float,2>{0.340508163f, 0.729450345f},
-std::array<float,2>{0.0731276497f, 0.0955098048f},
-std::array<float,2>{0.506769896f, 0.907558441f},
-std::array<float,2>{0.807868183f, 0.00578206498f},
-std::array<float,2>{0.498715907f, 0.937960267f},
-std::array<float,2>{0.131667152f, 0.495869458f},
-std::array<float,2>{0.71592468f, 0.673247278f},
-std::array<float,2>{0.60695672f, 0.327341795f},
-std::array<float,2>{0.0287377164f, 0.605631113f},
-std::array<float,2>{0.26132521f, 0.247687519f},
-std::array<float,2>{0.989776015f, 0.845515966f},
-std::array<float,2>{0.541929901f, 0.0928077251f},
-std::array<float,2>{0.1052716f, 0.895595551f},
-std::array<float,2>{0.372553021f, 0.37750268f},
-std::array<float,2>{0.928673327f, 0.694247246f},
-std::array<float,2>{0.823453367f, 0.289030969f},
-std::array<float,2>{0.429219037f, 0.502307713f},
-std::array<float,2>{0.229106829f, 0.18582876f},
-std::array<float,2>{0.638879895f, 0.778316915f},
-std::array<float,2>{0.950475335f, 0.188399702f},
-std::array<float,2>{0.296568364f, 0.816548705f},
-std::array<float,2>{0.0522636063f, 0.36820209f},
-std::array<float,2>{0.57606715f, 0.566560686f},
-std::array<float,2>{0.744824111f, 0.440863311f},
-std::array<float,2>{0.186387107f, 0.654625535f},
-std::array<float,2>{0.45471558f, 0.0426886342f},
-std::array<float,2>{0.768662572f, 0.993370593f},
-std::array<float,2>{0.691956401f, 0.0557765514f},
-std::array<float,2>{0.150730103f, 0.979603291f},
-std::array<float,2>{0.475893646f, 0.461457521f},
-std::array<float,2>{0.784928083f, 0.628837049f},
-std::array<float,2>{0.98417902f, 0.350377977f},
-std::array<float,2>{0.273996234f, 0.584854662f},
-std::array<float,2>{0.00328983017f, 0.212824136f},
-std::array<float,2>{0.614313781f, 0.832418323f},
-std::array<float,2>{0.864827991f, 0.162415564f},
-std::array<float,2>{0.380703509f, 0.757005751f},
-std::array<float,2>{0.198448747f, 0.309743851f},
-std::array<float,2>{0.679434419f, 0.524643183f},
-std::array<float,2>{0.520116329f, 0.401059866f},
-std::array<float,2>{0.0927880928f, 0.71702981f},
-std::array<float,2>{0.326733321f, 0.0776684433f},
-std::array<float,2>{0.900597334f, 0.886840165f},
-std::array<float,2>{0.580200553f, 0.232132792f},
-std::array<float,2>{0.0336686894f, 0.866821051f},
-std::array<float,2>{0.299271047f, 0.334173441f},
-std::array<float,2>{0.96407032f, 0.609837711f},
-std::array<float,2>{0.763285279f, 0.477057755f},
-std::array<float,2>{0.443388313f, 0.662803471f},
-std::array<float,2>{0.159632981f, 0.018809231f},
-std::array<float,2>{0.719180465f, 0.958559036f},
-std::array<float,2>{0.907189906f, 0.124081068f},
-std::array<float,2>{0.34545505f, 0.932438731f},
-std::array<float,2>{0.115569562f, 0.436368585f},
-std::array<float,2>{0.558074117f, 0.735756934f},
-std::array<float,2>{0.648366749f, 0.278910935f},
-std::array<float,2>{0.244435117f, 0.553303003f},
-std::array<float,2>{0.419327438f, 0.127436191f},
-std::array<float,2>{0.835619569f, 0.795325875f},
-std::array<float,2>{0.74693042f, 0.133338094f},
-std::array<float,2>{0.182569891f, 0.781951606f},
-std::array<float,2>{0.458641261f, 0.271013558f},
-std::array<float,2>{0.771848619f, 0.560377836f},
-std::array<float,2>{0.946258903f, 0.425104946f},
-std::array<float,2>{0.29178983f, 0.748408914f},
-std::array<float,2>{0.0475747213f, 0.115913026f},
-std::array<float,2>{0.572698951f, 0.929047465f},
-std::array<float,2>{0.825986147f, 0.0261722133f},
-std::array<float,2>{0.423624963f, 0.966456771f},
-std::array<float,2>{0.234084904f, 0.474975467f},
-std::array<float,2>{0.633997917f, 0.666093767f},
-std::array<float,2>{0.54432106f, 0.336291254f},
-std::array<float,2>{0.107239895f, 0.618275285f},
-std::array<float,2>{0.367349297f, 0.222564921f},
-std::array<float,2>{0.924376786f, 0.873735547f},
-std::array<float,2>{0.604042292f, 0.0646471679f},
-std::array<float,2>{0.0247007646f, 0.879076719f},
-std::array<float,2>{0.264300913f, 0.391388148f},
-std::array<float,2>{0.987015188f, 0.710901856f},
-std::array<float,2>{0.810495317f, 0.304291189f},
-std::array<float,2>{0.493604511f, 0.515782535f},
-std::array<float,2>{0.125023738f, 0.165024132f},
-std::array<float,2>{0.713319421f, 0.761393249f},
-std::array<float,2>{0.886049509f, 0.210731015f},
-std::array<float,2>{0.338290691f, 0.840025842f},
-std::array<float,2>{0.0762588307f, 0.352098852f},
-std::array<float,2>{0.500128925f, 0.58719188f},
-std::array<float,2>{0.666121542f, 0.455034852f},
-std::array<float,2>{0.203260928f, 0.638342738f},
-std::array<float,2>{0.390831351f, 0.0496886335f},
-std::array<float,2>{0.852737486f, 0.970400691f},
-std::array<float,2>{0.644321442f, 0.0352124311f},
-std::array<float,2>{0.248695821f, 0.98857069f},
-std::array<float,2>{0.415020734f, 0.445463359f},
-std::array<float,2>{0.831434548f, 0.640708268f},
-std::array<float,2>{0.911503971f, 0.360402465f},
-std::array<float,2>{0.348288506f, 0.571433246f},
-std::array<float,2>{0.112127952f, 0.196921244f},
-std::array<float,2>{0.561801076f, 0.821542382f},
-std::array<float,2>{0.760071874f, 0.177670717f},
-std::array<float,2>{0.438375592f, 0.772849798f},
-std::array<float,2>{0.162073061f, 0.294377834f},
-std::array<float,2>{0.725632787f, 0.515475094f},
-std::array<float,2>{0.582141817f, 0.389743209f},
-std::array<float,2>{0.0376320779f, 0.700259805f},
-std::array<float,2>{0.302134395f, 0.080837816f},
-std::array<float,2>{0.96596545f, 0.904478848f},
-std::array<float,2>{0.518999755f, 0.24073647f},
-std::array<float,2>{0.0872294828f, 0.855640054f},
-std::array<float,2>{0.321053863f, 0.319358945f},
-std::array<float,2>{0.902955115f, 0.598204434f},
-std::array<float,2>{0.859420359f, 0.487295449f},
-std::array<float,2>{0.376065463f, 0.683886051f},
-std::array<float,2>{0.199398607f, 0.0108034723f},
-std::array<float,2>{0.673683405f, 0.948324084f},
-std::array<float,2>{0.97803539f, 0.102721132f},
-std::array<float,2>{0.278172851f, 0.920817256f},
-std::array<float,2>{0.00692327041f, 0.408454329f},
-std::array<float,2>{0.612257361f, 0.724291742f},
-std::array<float,2>{0.690042615f, 0.261018872f},
-std::array<float,2>{0.155865029f, 0.545432568f},
-std::array<float,2>{0.468901545f, 0.148030996f},
-std::array<float,2>{0.787692606f, 0.803455532f},
-std::array<float,2>{0.679752707f, 0.194704652f},
-std::array<float,2>{0.189188778f, 0.813288987f},
-std::array<float,2>{0.383149475f, 0.372464001f},
-std::array<float,2>{0.87337333f, 0.564600348f},
-std::array<float,2>{0.892300129f, 0.444228053f},
-std::array<float,2>{0.320205837f, 0.649137378f},
-std::array<float,2>{0.0781463161f, 0.0447748341f},
-std::array<float,2>{0.527412593f, 0.998478055f},
-std::array<float,2>{0.789717078f, 0.088792637f},
-std::array<float,2>{0.480818778f, 0.890847981f},
-std::array<float,2>{0.142484739f, 0.379865646f},
-std::array<float,2>{0.702351391f, 0.687938035f},
-std::array<float,2>{0.623566806f, 0.285072565f},
-std::array<float,2>{0.00833718292f, 0.505541682f},
-std::array<float,2>{0.265638173f, 0.181043044f},
-std::array<float,2>{0.969629169f, 0.776879728f},
-std::array<float,2>{0.549535513f, 0.000704246049f},
-std::array<float,2>{0.118578367f, 0.945215762f},
-std::array<float,2>{0.353317827f, 0.499272078f},
-std::array<float,2>{0.914157271f, 0.676077724f},
-std::array<float,2>{0.838702857f, 0.32085681f},
-std::array<float,2>{0.412955105f, 0.602581024f},
-std::array<float,2>{0.242055625f, 0.242763981f},
-std::array<float,2>{0.650515735f, 0.847943664f},
-std::array<float,2>{0.957294166f, 0.155142069f},
-std::array<float,2>{0.306158811f, 0.811370552f},
-std::array<float,2>{0.0424665697f, 0.256053954f},
-std::array<float,2>{0.58913672f, 0.537282526f},
-std::array<float,2>{0.732998788f, 0.421197325f},
-std::array<float,2>{0.17009522f, 0.733411193f},
-std::array<float,2>{0.44633013f, 0.101326175f},
-std::array<float,2>{0.752804518f, 0.911172271f},
-std::array<float,2>{0.707715511f, 0.120433293f},
-std::array<float,2>{0.135410428f, 0.934493423f},
-std::array<float,2>{0.484794617f, 0.431965381f},
-std::array<float,2>{0.802993357f, 0.739509344f},
-std::array<float,2>{0.992486477f, 0.273895234f},
-std::array<float,2>{0.253620505f, 0.548679054f},
-std::array<float,2>{0.0216045305f, 0.130456895f},
-std::array<float,2>{0.596012056f, 0.790254116f},
-std::array<float,2>{0.845858455f, 0.229960784f},
-std::array<float,2>{0.400844693f, 0.862483799f},
-std::array<float,2>{0.218129337f, 0.331083f},
-std::array<float,2>{0.662245631f, 0.616235316f},
-std::array<float,2>{0.508009911f, 0.482668638f},
-std::array<float,2>{0.0677333027f, 0.659350157f},
-std::array<float,2>{0.332567662f, 0.0202918109f},
-std::array<float,2>{0.876229405f, 0.955528617f},
-std::array<float,2>{0.570164979f, 0.158057839f},
-std::array<float,2>{0.0567327403f, 0.753361702f},
-std::array<float,2>{0.282227457f, 0.308356404f},
-std::array<float,2>{0.943756878f, 0.52935195f},
-std::array<float,2>{0.777766764f, 0.404219687f},
-std::array<float,2>{0.463119358f, 0.710958064f},
-std::array<float,2>{0.177289769f, 0.0741797611f},
-std::array<float,2>{0.734844744f, 0.884149432f},
-std::array<float,2>{0.931004286f, 0.0600378178f},
-std::array<float,2>{0.361814976f, 0.984363973f},
-std::array<float,2>{0.0963176712f, 0.466068447f},
-std::array<float,2>{0.536049485f, 0.631738961f},
-std::array<float,2>{0.632060885f, 0.347280562f},
-std::array<float,2>{0.22143276f, 0.578242838f},
-std::array<float,2>{0.43206054f, 0.217443198f},
-std::array<float,2>{0.818723738f, 0.829286218f},
-std::array<float,2>{0.697892845f, 0.222778678f},
-std::array<float,2>{0.147277847f, 0.868247449f},
-std::array<float,2>{0.476869166f, 0.342079014f},
-std::array<float,2>{0.793937504f, 0.623107016f},
-std::array<float,2>{0.975468993f, 0.470653832f},
-std::array<float,2>{0.270286918f, 0.668373108f},
-std::array<float,2>{0.0143752461f, 0.0291566588f},
-std::array<float,2>{0.619159579f, 0.964082062f},
-std::array<float,2>{0.869514227f, 0.111536771f},
-std::array<float,2>{0.388929993f, 0.921990335f},
-std::array<float,2>{0.193574503f, 0.426885813f},
-std::array<float,2>{0.683779776f, 0.744909823f},
-std::array<float,2>{0.524187863f, 0.266138017f},
-std::array<float,2>{0.085347645f, 0.556781888f},
-std::array<float,2>{0.314783901f, 0.137121201f},
-std::array<float,2>{0.896660388f, 0.786601067f},
-std::array<float,2>{0.591112792f, 0.0514059365f},
-std::array<float,2>{0.0446860492f, 0.975058138f},
-std::array<float,2>{0.308725774f, 0.459686935f},
-std::array<float,2>{0.956253111f, 0.635820687f},
-std::array<float,2>{0.755715668f, 0.355617642f},
-std::array<float,2>{0.449443489f, 0.593289852f},
-std::array<float,2>{0.1644205f, 0.206630513f},
-std::array<float,2>{0.727480352f, 0.838242531f},
-std::array<float,2>{0.918613255f, 0.168926463f},
-std::array<float,2>{0.357530266f, 0.762632787f},
-std::array<float,2>{0.123918869f, 0.298804522f},
-std::array<float,2>{0.552097082f, 0.523028612f},
-std::array<float,2>{0.655306041f, 0.395675242f},
-std::array<float,2>{0.235589951f, 0.706817448f},
-std::array<float,2>{0.409745097f, 0.0675972626f},
-std::array<float,2>{0.841115475f, 0.875650585f},
-std::array<float,2>{0.659967244f, 0.0855226144f},
-std::array<float,2>{0.213655502f, 0.900010467f},
-std::array<float,2>{0.403010845f, 0.385944217f},
-std::array<float,2>{0.848641694f, 0.696459413f},
-std::array<float,2>{0.879765451f, 0.292967588f},
-std::array<float,2>{0.328191876f, 0.511457205f},
-std::array<float,2>{0.0644574314f, 0.173683926f},
-std::array<float,2>{0.512540579f, 0.76700604f},
-std::array<float,2>{0.798863828f, 0.201783881f},
-std::array<float,2>{0.488665223f, 0.825468242f},
-std::array<float,2>{0.138850942f, 0.364800304f},
-std::array<float,2>{0.703246415f, 0.5777812f},
-std::array<float,2>{0.598299086f, 0.450314343f},
-std::array<float,2>{0.0178257078f, 0.645788252f},
-std::array<float,2>{0.256354302f, 0.0337003209f},
-std::array<float,2>{0.9979617f, 0.988206804f},
-std::array<float,2>{0.534489751f, 0.141989693f},
-std::array<float,2>{0.100009412f, 0.800297558f},
-std::array<float,2>{0.365788072f, 0.262402683f},
-std::array<float,2>{0.934486091f, 0.542052209f},
-std::array<float,2>{0.813516676f, 0.410351425f},
-std::array<float,2>{0.434674829f, 0.721273601f},
-std::array<float,2>{0.224723428f, 0.109162852f},
-std::array<float,2>{0.628375232f, 0.91626668f},
-std::array<float,2>{0.940064728f, 0.0132456245f},
-std::array<float,2>{0.286842883f, 0.950021982f},
-std::array<float,2>{0.0595425293f, 0.489940345f},
-std::array<float,2>{0.564413846f, 0.683385134f},
-std::array<float,2>{0.741171837f, 0.314381331f},
-std::array<float,2>{0.174968794f, 0.594006002f},
-std::array<float,2>{0.468124062f, 0.23716943f},
-std::array<float,2>{0.777120531f, 0.851737201f},
-std::array<float,2>{0.638316453f, 0.183757737f},
-std::array<float,2>{0.227208197f, 0.780923545f},
-std::array<float,2>{0.426477581f, 0.285953701f},
-std::array<float,2>{0.822166383f, 0.500475764f},
-std::array<float,2>{0.926547825f, 0.375973791f},
-std::array<float,2>{0.373936474f, 0.692514241f},
-std::array<float,2>{0.101665132f, 0.0905450433f},
-std::array<float,2>{0.539507985f, 0.897184908f},
-std::array<float,2>{0.766782582f, 0.0402435511f},
-std::array<float,2>{0.455788791f, 0.995026112f},
-std::array<float,2>{0.185184509f, 0.43910715f},
-std::array<float,2>{0.743809581f, 0.653737605f},
-std::array<float,2>{0.577804267f, 0.369538069f},
-std::array<float,2>{0.0540155545f, 0.570039988f},
-std::array<float,2>{0.293030411f, 0.19063589f},
-std::array<float,2>{0.952785671f, 0.819066286f},
-std::array<float,2>{0.505772293f, 0.0962521061f},
-std::array<float,2>{0.0715314671f, 0.908338249f},
-std::array<float,2>{0.343610704f, 0.416259915f},
-std::array<float,2>{0.887376189f, 0.727667451f},
-std::array<float,2>{0.857319713f, 0.25096944f},
-std::array<float,2>{0.395610988f, 0.533514023f},
-std::array<float,2>{0.207848191f, 0.149066791f},
-std::array<float,2>{0.669020891f, 0.808043122f},
-std::array<float,2>{0.99133563f, 0.2493058f},
-std::array<float,2>{0.259421647f, 0.846612513f},
-std::array<float,2>{0.0307569467f, 0.326098859f},
-std::array<float,2>{0.607914507f, 0.608523011f},
-std::array<float,2>{0.717665732f, 0.493204445f},
-std::array<float,2>{0.130011603f, 0.674200058f},
-std::array<float,2>{0.49780789f, 0.00688117649f},
-std::array<float,2>{0.805490971f, 0.939644754f},
-std::array<float,2>{0.722437441f, 0.017072551f},
-std::array<float,2>{0.156602427f, 0.95950979f},
-std::array<float,2>{0.441874027f, 0.478663325f},
-std::array<float,2>{0.764893889f, 0.661431491f},
-std::array<float,2>{0.962219238f, 0.333888113f},
-std::array<float,2>{0.297892123f, 0.611586332f},
-std::array<float,2>{0.0326747447f, 0.233318329f},
-std::array<float,2>{0.578394592f, 0.864165127f},
-std::array<float,2>{0.833030403f, 0.125952557f},
-std::array<float,2>{0.421855628f, 0.794554412f},
-std::array<float,2>{0.242218226f, 0.281230628f},
-std::array<float,2>{0.644913316f, 0.551390648f},
-std::array<float,2>{0.55536896f, 0.434479803f},
-std::array<float,2>{0.115073524f, 0.73789221f},
-std::array<float,2>{0.346623033f, 0.122081533f},
-std::array<float,2>{0.908497334f, 0.930416882f},
-std::array<float,2>{0.615982175f, 0.213937625f},
-std::array<float,2>{0.000605273817f, 0.835865617f},
-std::array<float,2>{0.275542945f, 0.349265546f},
-std::array<float,2>{0.980948865f, 0.582982361f},
-std::array<float,2>{0.783193111f, 0.463966638f},
-std::array<float,2>{0.472721785f, 0.625293195f},
-std::array<float,2>{0.149930194f, 0.0574388877f},
-std::array<float,2>{0.695234478f, 0.976596355f},
-std::array<float,2>{0.900086641f, 0.0746244043f},
-std::array<float,2>{0.32520178f, 0.890005112f},
-std::array<float,2>{0.0904798582f, 0.400359929f},
-std::array<float,2>{0.522149086f, 0.71534723f},
-std::array<float,2>{0.677061856f, 0.311900884f},
-std::array<float,2>{0.196843252f, 0.526265025f},
-std::array<float,2>{0.382579684f, 0.161444247f},
-std::array<float,2>{0.865919113f, 0.754692733f},
-std::array<float,2>{0.710691512f, 0.130337626f},
-std::array<float,2>{0.134296983f, 0.790827572f},
-std::array<float,2>{0.48704502f, 0.274130791f},
-std::array<float,2>{0.802709699f, 0.54806596f},
-std::array<float,2>{0.995140851f, 0.432460636f},
-std::array<float,2>{0.250994623f, 0.739905119f},
-std::array<float,2>{0.0209892243f, 0.120977446f},
-std::array<float,2>{0.59499985f, 0.933975518f},
-std::array<float,2>{0.845360994f, 0.0198916513f},
-std::array<float,2>{0.398457497f, 0.955720425f},
-std::array<float,2>{0.216128528f, 0.482915223f},
-std::array<float,2>{0.661002636f, 0.659920037f},
-std::array<float,2>{0.50984174f, 0.331956714f},
-std::array<float,2>{0.0702940747f, 0.617052376f},
-std::array<float,2>{0.334825099f, 0.230225608f},
-std::array<float,2>{0.877464592f, 0.863042414f},
-std::array<float,2>{0.568325102f, 0.0733004287f},
-std::array<float,2>{0.0554092824f, 0.884417534f},
-std::array<float,2>{0.283691496f, 0.403452635f},
-std::array<float,2>{0.943064272f, 0.711813152f},
-std::array<float,2>{0.779335022f, 0.307965815f},
-std::array<float,2>{0.462209255f, 0.529967189f},
-std::array<float,2>{0.178325415f, 0.157416105f},
-std::array<float,2>{0.737522602f, 0.75347805f},
-std::array<float,2>{0.932227135f, 0.216811225f},
-std::array<float,2>{0.360411912f, 0.829805553f},
-std::array<float,2>{0.0943200216f, 0.346754223f},
-std::array<float,2>{0.538456082f, 0.578916311f},
-std::array<float,2>{0.630341113f, 0.466609657f},
-std::array<float,2>{0.220237166f, 0.63133949f},
-std::array<float,2>{0.431445003f, 0.0601944141f},
-std::array<float,2>{0.816658676f, 0.983442366f},
-std::array<float,2>{0.682373106f, 0.0441062748f},
-std::array<float,2>{0.191206157f, 0.998960316f},
-std::array<float,2>{0.386562079f, 0.443520188f},
-std::array<float,2>{0.871210098f, 0.648464262f},
-std::array<float,2>{0.89261353f, 0.372960269f},
-std::array<float,2>{0.316696882f, 0.565059662f},
-std::array<float,2>{0.0820143819f, 0.195190638f},
-std::array<float,2>{0.53085649f, 0.812525094f},
-std::array<float,2>{0.791282117f, 0.181611463f},
-std::array<float,2>{0.483373702f, 0.776377559f},
-std::array<float,2>{0.144212902f, 0.284249097f},
-std::array<float,2>{0.700353265f, 0.505126059f},
-std::array<float,2>{0.622039914f, 0.379218757f},
-std::array<float,2>{0.0106062042f, 0.688165367f},
-std::array<float,2>{0.269390613f, 0.0881931037f},
-std::array<float,2>{0.971827686f, 0.891140163f},
-std::array<float,2>{0.547508836f, 0.242391348f},
-std::array<float,2>{0.119236864f, 0.84847939f},
-std::array<float,2>{0.355103463f, 0.320390046f},
-std::array<float,2>{0.916671634f, 0.603097439f},
-std::array<float,2>{0.837237179f, 0.499547243f},
-std::array<float,2>{0.411352873f, 0.6766541f},
-std::array<float,2>{0.23908934f, 0.000467667793f},
-std::array<float,2>{0.648961663f, 0.944354773f},
-std::array<float,2>{0.95995295f, 0.100658655f},
-std::array<float,2>{0.306872219f, 0.911789119f},
-std::array<float,2>{0.040143054f, 0.421848744f},
-std::array<float,2>{0.587135136f, 0.734292209f},
-std::array<float,2>{0.731412768f, 0.256423622f},
-std::array<float,2>{0.16812247f, 0.537661612f},
-std::array<float,2>{0.448486477f, 0.154451936f},
-std::array<float,2>{0.751374602f, 0.810638368f},
-std::array<float,2>{0.642555714f, 0.196418017f},
-std::array<float,2>{0.247168496f, 0.821803451f},
-std::array<float,2>{0.417764425f, 0.361022621f},
-std::array<float,2>{0.828855395f, 0.572008252f},
-std::array<float,2>{0.913475752f, 0.446014434f},
-std::array<float,2>{0.350204587f, 0.641442299f},
-std::array<float,2>{0.110491611f, 0.035929434f},
-std::array<float,2>{0.560430765f, 0.989220202f},
-std::array<float,2>{0.75875932f, 0.0803585202f},
-std::array<float,2>{0.44080323f, 0.905140102f},
-std::array<float,2>{0.163652405f, 0.390325785f},
-std::array<float,2>{0.723744333f, 0.701023161f},
-std::array<float,2>{0.58434093f, 0.294528544f},
-std::array<float,2>{0.0361964442f, 0.514861524f},
-std::array<float,2>{0.30322215f, 0.177015096f},
-std::array<float,2>{0.967167616f, 0.773272693f},
-std::array<float,2>{0.516336203f, 0.0114928056f},
-std::array<float,2>{0.0888425112f, 0.948744774f},
-std::array<float,2>{0.323535562f, 0.486369103f},
-std::array<float,2>{0.9053877f, 0.684498549f},
-std::array<float,2>{0.861536324f, 0.319932908f},
-std::array<float,2>{0.378270149f, 0.597926378f},
-std::array<float,2>{0.201356649f, 0.240710497f},
-std::array<float,2>{0.675244331f, 0.856095612f},
-std::array<float,2>{0.979682982f, 0.147512391f},
-std::array<float,2>{0.280025154f, 0.803185105f},
-std::array<float,2>{0.00476065511f, 0.261667609f},
-std::array<float,2>{0.609998524f, 0.545404077f},
-std::array<float,2>{0.689120412f, 0.408824563f},
-std::array<float,2>{0.154079691f, 0.723802745f},
-std::array<float,2>{0.471778393f, 0.103089832f},
-std::array<float,2>{0.785614192f, 0.92019242f},
-std::array<float,2>{0.749924004f, 0.115609393f},
-std::array<float,2>{0.181109771f, 0.929436028f},
-std::array<float,2>{0.459549427f, 0.425418228f},
-std::array<float,2>{0.770733058f, 0.748814404f},
-std::array<float,2>{0.948717177f, 0.270632416f},
-std::array<float,2>{0.289646149f, 0.559814453f},
-std::array<float,2>{0.0489326119f, 0.133248016f},
-std::array<float,2>{0.571894288f, 0.781626523f},
-std::array<float,2>{0.827529788f, 0.221682176f},
-std::array<float,2>{0.423924714f, 0.873102427f},
-std::array<float,2>{0.231961966f, 0.336456925f},
-std::array<float,2>{0.635688603f, 0.618825793f},
-std::array<float,2>{0.545326293f, 0.475226194f},
-std::array<float,2>{0.10810405f, 0.666818321f},
-std::array<float,2>{0.369424254f, 0.0253971647f},
-std::array<float,2>{0.923702598f, 0.965922773f},
-std::array<float,2>{0.603184402f, 0.164099693f},
-std::array<float,2>{0.0258212816f, 0.760957301f},
-std::array<float,2>{0.263292462f, 0.304017991f},
-std::array<float,2>{0.985125363f, 0.516320586f},
-std::array<float,2>{0.811438441f, 0.390730441f},
-std::array<float,2>{0.495840222f, 0.710250974f},
-std::array<float,2>{0.128183678f, 0.0652477667f},
-std::array<float,2>{0.712064564f, 0.87958461f},
-std::array<float,2>{0.884218454f, 0.0491593443f},
-std::array<float,2>{0.337534428f, 0.970185876f},
-std::array<float,2>{0.0757225156f, 0.454477429f},
-std::array<float,2>{0.502338827f, 0.637805402f},
-std::array<float,2>{0.664094985f, 0.351831079f},
-std::array<float,2>{0.205985561f, 0.587768078f},
-std::array<float,2>{0.393838018f, 0.210283622f},
-std::array<float,2>{0.85466665f, 0.840498924f},
-std::array<float,2>{0.719570458f, 0.232647657f},
-std::array<float,2>{0.15996629f, 0.863320708f},
-std::array<float,2>{0.444032848f, 0.333060592f},
-std::array<float,2>{0.762881935f, 0.612014055f},
-std::array<float,2>{0.964625061f, 0.479114413f},
-std::array<float,2>{0.299342573f, 0.661849499f},
-std::array<float,2>{0.0339049473f, 0.0171600524f},
-std::array<float,2>{0.580631375f, 0.959191084f},
-std::array<float,2>{0.835193396f, 0.122563802f},
-std::array<float,2>{0.419440687f, 0.930012167f},
-std::array<float,2>{0.24507758f, 0.433968306f},
-std::array<float,2>{0.647522271f, 0.737368286f},
-std::array<float,2>{0.5582726f, 0.280398697f},
-std::array<float,2>{0.116034932f, 0.551267505f},
-std::array<float,2>{0.345207512f, 0.125296026f},
-std::array<float,2>{0.906396031f, 0.793967605f},
-std::array<float,2>{0.614930868f, 0.0570896976f},
-std::array<float,2>{0.00384866237f, 0.977424979f},
-std::array<float,2>{0.273694366f, 0.46451664f},
-std::array<float,2>{0.983551383f, 0.625635505f},
-std::array<float,2>{0.784424603f, 0.349080563f},
-std::array<float,2>{0.476363897f, 0.582505226f},
-std::array<float,2>{0.151206493f, 0.21459645f},
-std::array<float,2>{0.691429317f, 0.835044563f},
-std::array<float,2>{0.900910974f, 0.161869556f},
-std::array<float,2>{0.326285094f, 0.754138887f},
-std::array<float,2>{0.0936264172f, 0.312221289f},
-std::array<float,2>{0.519719183f, 0.525766611f},
-std::array<float,2>{0.678977847f, 0.399629593f},
-std::array<float,2>{0.198884532f, 0.715328395f},
-std::array<float,2>{0.379945397f, 0.07508564f},
-std::array<float,2>{0.86439234f, 0.890170574f},
-std::array<float,2>{0.639235556f, 0.0902905688f},
-std::array<float,2>{0.228977799f, 0.896760464f},
-std::array<float,2>{0.429158926f, 0.375480056f},
-std::array<float,2>{0.82386899f, 0.69295615f},
-std::array<float,2>{0.927837253f, 0.285250157f},
-std::array<float,2>{0.37286216f, 0.500892222f},
-std::array<float,2>{0.104961246f, 0.184093803f},
-std::array<float,2>{0.541498721f, 0.780373275f},
-std::array<float,2>{0.769199967f, 0.191138297f},
-std::array<float,2>{0.454260886f, 0.818393409f},
-std::array<float,2>{0.185911879f, 0.369702756f},
-std::array<float,2>{0.744617879f, 0.569503665f},
-std::array<float,2>{0.575239241f, 0.438935548f},
-std::array<float,2>{0.0520007722f, 0.653836608f},
-std::array<float,2>{0.296355844f, 0.0409500003f},
-std::array<float,2>{0.950951397f, 0.99428463f},
-std::array<float,2>{0.506335735f, 0.148575902f},
-std::array<float,2>{0.0723248497f, 0.808240056f},
-std::array<float,2>{0.340199411f, 0.250225574f},
-std::array<float,2>{0.890280306f, 0.533800185f},
-std::array<float,2>{0.857444346f, 0.416535556f},
-std::array<float,2>{0.397014946f, 0.728105187f},
-std::array<float,2>{0.209626079f, 0.0959339067f},
-std::array<float,2>{0.67109549f, 0.908946753f},
-std::array<float,2>{0.989361882f, 0.00740926573f},
-std::array<float,2>{0.260898143f, 0.940122724f},
-std::array<float,2>{0.029063914f, 0.494067609f},
-std::array<float,2>{0.606648088f, 0.674362242f},
-std::array<float,2>{0.716381669f, 0.325388014f},
-std::array<float,2>{0.131135494f, 0.609117985f},
-std::array<float,2>{0.49833554f, 0.249823183f},
-std::array<float,2>{0.808503985f, 0.845801651f},
-std::array<float,2>{0.657236218f, 0.173226073f},
-std::array<float,2>{0.211641446f, 0.767258167f},
-std::array<float,2>{0.405526638f, 0.292415679f},
-std::array<float,2>{0.850307763f, 0.510994673f},
-std::array<float,2>{0.882279038f, 0.386312664f},
-std::array<float,2>{0.33167097f, 0.69713515f},
-std::array<float,2>{0.0637029856f, 0.0854375958f},
-std::array<float,2>{0.514910579f, 0.89964515f},
-std::array<float,2>{0.797964752f, 0.033300966f},
-std::array<float,2>{0.491628051f, 0.98738116f},
-std::array<float,2>{0.138133481f, 0.450914174f},
-std::array<float,2>{0.706573486f, 0.646077991f},
-std::array<float,2>{0.600802362f, 0.364416927f},
-std::array<float,2>{0.0173553675f, 0.5775581f},
-std::array<float,2>{0.255529642f, 0.201300576f},
-std::array<float,2>{0.999569416f, 0.825798571f},
-std::array<float,2>{0.53295368f, 0.108804055f},
-std::array<float,2>{0.098018989f, 0.91690892f},
-std::array<float,2>{0.364705741f, 0.410880327f},
-std::array<float,2>{0.935634673f, 0.721143544f},
-std::array<float,2>{0.815013409f, 0.262204856f},
-std::array<float,2>{0.435751885f, 0.542537987f},
-std::array<float,2>{0.223543361f, 0.142556623f},
-std::array<float,2>{0.626607358f, 0.800220251f},
-std::array<float,2>{0.938878596f, 0.236418381f},
-std::array<float,2>{0.287575275f, 0.852191865f},
-std::array<float,2>{0.0609443448f, 0.313911557f},
-std::array<float,2>{0.565311372f, 0.594639599f},
-std::array<float,2>{0.738733053f, 0.489344269f},
-std::array<float,2>{0.17325522f, 0.682996809f},
-std::array<float,2>{0.465188324f, 0.0127405291f},
-std::array<float,2>{0.773720264f, 0.949555039f},
-std::array<float,2>{0.696891546f, 0.0283522587f},
-std::array<float,2>{0.14634414f, 0.964826226f},
-std::array<float,2>{0.480131328f, 0.469892442f},
-std::array<float,2>{0.795287132f, 0.668824315f},
-std::array<float,2>{0.972753704f, 0.342400849f},
-std::array<float,2>{0.27287066f, 0.623745978f},
-std::array<float,2>{0.0122648226f, 0.223384902f},
-std::array<float,2>{0.617244482f, 0.869112194f},
-std::array<float,2>{0.867486f, 0.13737464f},
-std::array<float,2>{0.386752278f, 0.78690958f},
-std::array<float,2>{0.193244904f, 0.265727341f},
-std::array<float,2>{0.687096238f, 0.557341576f},
-std::array<float,2>{0.526267886f, 0.427550793f},
-std::array<float,2>{0.0833015218f, 0.744483292f},
-std::array<float,2>{0.313615113f, 0.112178743f},
-std::array<float,2>{0.895681024f, 0.922434926f},
-std::array<float,2>{0.593267739f, 0.206160054f},
-std::array<float,2>{0.0450494848f, 0.838603914f},
-std::array<float,2>{0.311239362f, 0.356278241f},
-std::array<float,2>{0.95315218f, 0.593134284f},
-std::array<float,2>{0.757655859f, 0.459369749f},
-std::array<float,2>{0.452374339f, 0.636481702f},
-std::array<float,2>{0.166340679f, 0.0510689281f},
-std::array<float,2>{0.729037642f, 0.975363255f},
-std::array<float,2>{0.9214347f, 0.0679677352f},
-std::array<float,2>{0.35683468f, 0.875248849f},
-std::array<float,2>{0.12132407f, 0.396471888f},
-std::array<float,2>{0.554069996f, 0.706507087f},
-std::array<float,2>{0.653802454f, 0.298121572f},
-std::array<float,2>{0.236901194f, 0.522846997f},
-std::array<float,2>{0.4081617f, 0.167993024f},
-std::array<float,2>{0.843382478f, 0.761933923f},
-std::array<float,2>{0.735037506f, 0.159194797f},
-std::array<float,2>{0.176849991f, 0.750402629f},
-std::array<float,2>{0.463657618f, 0.306337088f},
-std::array<float,2>{0.778052211f, 0.52926749f},
-std::array<float,2>{0.944159389f, 0.405694604f},
-std::array<float,2>{0.283048242f, 0.714241564f},
-std::array<float,2>{0.0574693643f, 0.0703686923f},
-std::array<float,2>{0.56963408f, 0.884830415f},
-std::array<float,2>{0.818855047f, 0.0617326833f},
-std::array<float,2>{0.432389021f, 0.981004953f},
-std::array<float,2>{0.220822424f, 0.467054605f},
-std::array<float,2>{0.632768989f, 0.62958312f},
-std::array<float,2>{0.535453796f, 0.344469279f},
-std::array<float,2>{0.0961590707f, 0.58199352f},
-std::array<float,2>{0.361875117f, 0.215208426f},
-std::array<float,2>{0.931385815f, 0.831031144f},
-std::array<float,2>{0.596427262f, 0.11803513f},
-std::array<float,2>{0.0222409796f, 0.936723709f},
-std::array<float,2>{0.253211617f, 0.430090666f},
-std::array<float,2>{0.993040919f, 0.740552902f},
-std::array<float,2>{0.803237081f, 0.275685966f},
-std::array<float,2>{0.485103935f, 0.550089836f},
-std::array<float,2>{0.135133371f, 0.132567778f},
-std::array<float,2>{0.707033992f, 0.791477621f},
-std::array<float,2>{0.876660883f, 0.227929384f},
-std::array<float,2>{0.33231923f, 0.859455884f},
-std::array<float,2>{0.0682703108f, 0.328956157f},
-std::array<float,2>{0.508597255f, 0.614878416f},
-std::array<float,2>{0.662867367f, 0.480716377f},
-std::array<float,2>{0.218422219f, 0.658088982f},
-std::array<float,2>{0.40107879f, 0.023258172f},
-std::array<float,2>{0.846640289f, 0.954251468f},
-std::array<float,2>{0.651252866f, 0.00376594882f},
-std::array<float,2>{0.241373271f, 0.942036986f},
-std::array<float,2>{0.412293643f, 0.497172475f},
-std::array<float,2>{0.83804214f, 0.678578556f},
-std::array<float,2>{0.914954603f, 0.323503196f},
-std::array<float,2>{0.353019387f, 0.605018914f},
-std::array<float,2>{0.118781716f, 0.245296821f},
-std::array<float,2>{0.549007893f, 0.850890219f},
-std::array<float,2>{0.751989126f, 0.152397871f},
-std::array<float,2>{0.447113603f, 0.809725344f},
-std::array<float,2>{0.170688346f, 0.254550427f},
-std::array<float,2>{0.732798398f, 0.535509288f},
-std::array<float,2>{0.589766324f, 0.418032169f},
-std::array<float,2>{0.0425134636f, 0.73180455f},
-std::array<float,2>{0.305903018f, 0.0986818075f},
-std::array<float,2>{0.957909524f, 0.913138032f},
-std::array<float,2>{0.52831018f, 0.191796452f},
-std::array<float,2>{0.0788684189f, 0.816113174f},
-std::array<float,2>{0.319591254f, 0.374954879f},
-std::array<float,2>{0.89163959f, 0.563340366f},
-std::array<float,2>{0.873742223f, 0.442225993f},
-std::array<float,2>{0.383516401f, 0.650814116f},
-std::array<float,2>{0.188536599f, 0.0454217792f},
-std::array<float,2>{0.680381596f, 0.996417463f},
-std::array<float,2>{0.968888283f, 0.0864685923f},
-std::array<float,2>{0.266511828f, 0.893046081f},
-std::array<float,2>{0.00803906564f, 0.381942064f},
-std::array<float,2>{0.623394966f, 0.690903068f},
-std::array<float,2>{0.702722847f, 0.281730473f},
-std::array<float,2>{0.141655609f, 0.507761061f},
-std::array<float,2>{0.481218845f, 0.181698263f},
-std::array<float,2>{0.78916496f, 0.773839831f},
-std::array<float,2>{0.673083723f, 0.239323884f},
-std::array<float,2>{0.200125352f, 0.857744932f},
-std::array<float,2>{0.376654923f, 0.317033738f},
-std::array<float,2>{0.860167503f, 0.599795461f},
-std::array<float,2>{0.90252912f, 0.48489365f},
-std::array<float,2>{0.320436031f, 0.685795188f},
-std::array<float,2>{0.0876783058f, 0.00835165009f},
-std::array<float,2>{0.519198f, 0.946088672f},
-std::array<float,2>{0.787581921f, 0.104366407f},
-std::array<float,2>{0.469511539f, 0.919279337f},
-std::array<float,2>{0.155593365f, 0.408149749f},
-std::array<float,2>{0.689921498f, 0.725256979f},
-std::array<float,2>{0.611422122f, 0.258702099f},
-std::array<float,2>{0.00775688468f, 0.543576062f},
-std::array<float,2>{0.277495146f, 0.145102337f},
-std::array<float,2>{0.977600038f, 0.80266732f},
-std::array<float,2>{0.562072217f, 0.0371871665f},
-std::array<float,2>{0.111357272f, 0.990794241f},
-std::array<float,2>{0.347988784f, 0.448807865f},
-std::array<float,2>{0.911939323f, 0.643527389f},
-std::array<float,2>{0.831733704f, 0.363081127f},
-std::array<float,2>{0.414229214f, 0.572395384f},
-std::array<float,2>{0.248099059f, 0.198841393f},
-std::array<float,2>{0.644005358f, 0.824168682f},
-std::array<float,2>{0.966513515f, 0.179217577f},
-std::array<float,2>{0.302687258f, 0.771009088f},
-std::array<float,2>{0.0374320261f, 0.295458764f},
-std::array<float,2>{0.582677066f, 0.512728035f},
-std::array<float,2>{0.726451159f, 0.386935055f},
-std::array<float,2>{0.161600173f, 0.701520979f},
-std::array<float,2>{0.437923104f, 0.0800105184f},
-std::array<float,2>{0.760395169f, 0.904245198f},
-std::array<float,2>{0.713859856f, 0.062536031f},
-std::array<float,2>{0.125787348f, 0.881932497f},
-std::array<float,2>{0.493865758f, 0.392657518f},
-std::array<float,2>{0.80992341f, 0.707922757f},
-std::array<float,2>{0.986693621f, 0.301330537f},
-std::array<float,2>{0.263893634f, 0.51902014f},
-std::array<float,2>{0.0249257497f, 0.167519957f},
-std::array<float,2>{0.60367775f, 0.759703279f},
-std::array<float,2>{0.853468776f, 0.207703859f},
-std::array<float,2>{0.39117825f, 0.842878103f},
-std::array<float,2>{0.203732938f, 0.354406565f},
-std::array<float,2>{0.666727901f, 0.589741111f},
-std::array<float,2>{0.500650525f, 0.455385208f},
-std::array<float,2>{0.0768304691f, 0.639508605f},
-std::array<float,2>{0.33842653f, 0.0482922494f},
-std::array<float,2>{0.886311948f, 0.971967161f},
-std::array<float,2>{0.573202968f, 0.135018826f},
-std::array<float,2>{0.0471868478f, 0.784078956f},
-std::array<float,2>{0.291092545f, 0.272269905f},
-std::array<float,2>{0.945439398f, 0.56220001f},
-std::array<float,2>{0.772430301f, 0.422444165f},
-std::array<float,2>{0.458434224f, 0.746349156f},
-std::array<float,2>{0.182091266f, 0.113575302f},
-std::array<float,2>{0.746531487f, 0.927202642f},
-std::array<float,2>{0.92393589f, 0.0253319722f},
-std::array<float,2>{0.368127525f, 0.968721211f},
-std::array<float,2>{0.106844626f, 0.473167449f},
-std::array<float,2>{0.54450202f, 0.665560961f},
-std::array<float,2>{0.634549379f, 0.339583874f},
-std::array<float,2>{0.233423561f, 0.619445324f},
-std::array<float,2>{0.423010528f, 0.219720304f},
-std::array<float,2>{0.825646281f, 0.871427476f},
-std::array<float,2>{0.694710851f, 0.212306082f},
-std::array<float,2>{0.149612769f, 0.832784772f},
-std::array<float,2>{0.473281324f, 0.350093812f},
-std::array<float,2>{0.782484353f, 0.584146321f},
-std::array<float,2>{0.981123507f, 0.461317658f},
-std::array<float,2>{0.276071578f, 0.628110707f},
-std::array<float,2>{5.90144809e-05f, 0.0562183373f},
-std::array<float,2>{0.615531087f, 0.980023384f},
-std::array<float,2>{0.86564827f, 0.0776074454f},
-std::array<float,2>{0.381899208f, 0.887535155f},
-std::array<float,2>{0.196562707f, 0.400825411f},
-std::array<float,2>{0.677498281f, 0.717297375f},
-std::array<float,2>{0.521683514f, 0.310327828f},
-std::array<float,2>{0.089950107f, 0.525241554f},
-std::array<float,2>{0.325909257f, 0.162743166f},
-std::array<float,2>{0.899534762f, 0.757382095f},
-std::array<float,2>{0.578617096f, 0.0191507973f},
-std::array<float,2>{0.032742165f, 0.958122075f},
-std::array<float,2>{0.298656046f, 0.476828843f},
-std::array<float,2>{0.962519825f, 0.662279546f},
-std::array<float,2>{0.765221f, 0.334702969f},
-std::array<float,2>{0.442001134f, 0.610216439f},
-std::array<float,2>{0.15675956f, 0.231745645f},
-std::array<float,2>{0.721888661f, 0.866320431f},
-std::array<float,2>{0.909174025f, 0.127581507f},
-std::array<float,2>{0.345726967f, 0.795772314f},
-std::array<float,2>{0.114642605f, 0.278369933f},
-std::array<float,2>{0.554927707f, 0.552851796f},
-std::array<float,2>{0.645462215f, 0.435891479f},
-std::array<float,2>{0.242718309f, 0.735922337f},
-std::array<float,2>{0.420928925f, 0.124877624f},
-std::array<float,2>{0.833658576f, 0.932101309f},
-std::array<float,2>{0.66960007f, 0.0951392874f},
-std::array<float,2>{0.207292765f, 0.908134758f},
-std::array<float,2>{0.396303087f, 0.414729267f},
-std::array<float,2>{0.856541514f, 0.728816926f},
-std::array<float,2>{0.887133479f, 0.252887219f},
-std::array<float,2>{0.343132347f, 0.531491458f},
-std::array<float,2>{0.0717939287f, 0.150725931f},
-std::array<float,2>{0.505327523f, 0.80631572f},
-std::array<float,2>{0.805007517f, 0.247418568f},
-std::array<float,2>{0.497536153f, 0.844920039f},
-std::array<float,2>{0.130858123f, 0.327964157f},
-std::array<float,2>{0.717184603f, 0.606071293f},
-std::array<float,2>{0.607830167f, 0.495431632f},
-std::array<float,2>{0.0308419075f, 0.673589826f},
-std::array<float,2>{0.258876503f, 0.00514756283f},
-std::array<float,2>{0.99212873f, 0.938089967f},
-std::array<float,2>{0.53957665f, 0.186178744f},
-std::array<float,2>{0.102077261f, 0.777813733f},
-std::array<float,2>{0.37308833f, 0.288289428f},
-std::array<float,2>{0.925864816f, 0.502562523f},
-std::array<float,2>{0.82145226f, 0.376999229f},
-std::array<float,2>{0.42620945f, 0.693692327f},
-std::array<float,2>{0.226585552f, 0.0935590267f},
-std::array<float,2>{0.637871921f, 0.896320462f},
-std::array<float,2>{0.952402294f, 0.042266503f},
-std::array<float,2>{0.293738842f, 0.994002283f},
-std::array<float,2>{0.0543942191f, 0.440984875f},
-std::array<float,2>{0.577489316f, 0.654792249f},
-std::array<float,2>{0.743580163f, 0.36868152f},
-std::array<float,2>{0.184649035f, 0.567330003f},
-std::array<float,2>{0.455150604f, 0.187835053f},
-std::array<float,2>{0.767519653f, 0.817095876f},
-std::array<float,2>{0.628854632f, 0.144431204f},
-std::array<float,2>{0.225131661f, 0.797149956f},
-std::array<float,2>{0.435133278f, 0.26397869f},
-std::array<float,2>{0.814263284f, 0.540190578f},
-std::array<float,2>{0.933946669f, 0.413411111f},
-std::array<float,2>{0.365321189f, 0.720190227f},
-std::array<float,2>{0.100468129f, 0.106513135f},
-std::array<float,2>{0.534766734f, 0.915456951f},
-std::array<float,2>{0.776638269f, 0.0140933096f},
-std::array<float,2>{0.468396962f, 0.95269835f},
-std::array<float,2>{0.175536498f, 0.491881639f},
-std::array<float,2>{0.740547299f, 0.680283904f},
-std::array<float,2>{0.563832521f, 0.314679116f},
-std::array<float,2>{0.0586974882f, 0.595949829f},
-std::array<float,2>{0.286164522f, 0.236019999f},
-std::array<float,2>{0.939773917f, 0.855366707f},
-std::array<float,2>{0.512158155f, 0.083776556f},
-std::array<float,2>{0.0650691837f, 0.901753604f},
-std::array<float,2>{0.329098701f, 0.383009911f},
-std::array<float,2>{0.87928164f, 0.698197305f},
-std::array<float,2>{0.849422872f, 0.290073574f},
-std::array<float,2>{0.40239802f, 0.508692682f},
-std::array<float,2>{0.213318244f, 0.175249577f},
-std::array<float,2>{0.659271896f, 0.768371046f},
-std::array<float,2>{0.997073591f, 0.201029629f},
-std::array<float,2>{0.256224155f, 0.826381624f},
-std::array<float,2>{0.0180740394f, 0.366813391f},
-std::array<float,2>{0.597759664f, 0.575486362f},
-std::array<float,2>{0.70406574f, 0.451306611f},
-std::array<float,2>{0.139591813f, 0.647718549f},
-std::array<float,2>{0.48894611f, 0.0318744779f},
-std::array<float,2>{0.79938823f, 0.985185444f},
-std::array<float,2>{0.726611376f, 0.0534231775f},
-std::array<float,2>{0.165017858f, 0.974048734f},
-std::array<float,2>{0.44999519f, 0.457795113f},
-std::array<float,2>{0.75535512f, 0.634599388f},
-std::array<float,2>{0.956715107f, 0.358889401f},
-std::array<float,2>{0.309523791f, 0.591149151f},
-std::array<float,2>{0.0439826995f, 0.204611957f},
-std::array<float,2>{0.591467857f, 0.836262524f},
-std::array<float,2>{0.841796815f, 0.16996029f},
-std::array<float,2>{0.409605384f, 0.765565157f},
-std::array<float,2>{0.236109093f, 0.300185889f},
-std::array<float,2>{0.655929983f, 0.520965099f},
-std::array<float,2>{0.552290499f, 0.397523582f},
-std::array<float,2>{0.123261064f, 0.703636348f},
-std::array<float,2>{0.358213395f, 0.0691774189f},
-std::array<float,2>{0.918342292f, 0.878816903f},
-std::array<float,2>{0.619794965f, 0.224981412f},
-std::array<float,2>{0.0140362261f, 0.870479643f},
-std::array<float,2>{0.269700468f, 0.340992391f},
-std::array<float,2>{0.974960685f, 0.621236265f},
-std::array<float,2>{0.793118954f, 0.471143633f},
-std::array<float,2>{0.477115154f, 0.671742499f},
-std::array<float,2>{0.146785095f, 0.0307621807f},
-std::array<float,2>{0.697391629f, 0.961002052f},
-std::array<float,2>{0.897155344f, 0.109653279f},
-std::array<float,2>{0.314991295f, 0.925551891f},
-std::array<float,2>{0.0855395198f, 0.428153098f},
-std::array<float,2>{0.523695469f, 0.742825806f},
-std::array<float,2>{0.684197187f, 0.269283623f},
-std::array<float,2>{0.193874359f, 0.555174589f},
-std::array<float,2>{0.389285535f, 0.139225259f},
-std::array<float,2>{0.869986892f, 0.787132621f},
-std::array<float,2>{0.699627399f, 0.182851329f},
-std::array<float,2>{0.143360108f, 0.774578512f},
-std::array<float,2>{0.484149575f, 0.282502502f},
-std::array<float,2>{0.792371988f, 0.505899429f},
-std::array<float,2>{0.970913649f, 0.381228089f},
-std::array<float,2>{0.267917424f, 0.689666688f},
-std::array<float,2>{0.0107690655f, 0.0869454518f},
-std::array<float,2>{0.622600555f, 0.894209623f},
-std::array<float,2>{0.872719824f, 0.0466827378f},
-std::array<float,2>{0.385278314f, 0.997127116f},
-std::array<float,2>{0.190116331f, 0.44280833f},
-std::array<float,2>{0.68318361f, 0.652228951f},
-std::array<float,2>{0.53025645f, 0.373250276f},
-std::array<float,2>{0.0807101279f, 0.56396091f},
-std::array<float,2>{0.317949623f, 0.193152398f},
-std::array<float,2>{0.893850207f, 0.814700961f},
-std::array<float,2>{0.586314738f, 0.0983738601f},
-std::array<float,2>{0.0394711941f, 0.912937224f},
-std::array<float,2>{0.307946801f, 0.419317454f},
-std::array<float,2>{0.960587561f, 0.730977833f},
-std::array<float,2>{0.750279367f, 0.255640745f},
-std::array<float,2>{0.448061049f, 0.536986411f},
-std::array<float,2>{0.169409961f, 0.154024899f},
-std::array<float,2>{0.73227948f, 0.809064329f},
-std::array<float,2>{0.917322755f, 0.244541109f},
-std::array<float,2>{0.353648901f, 0.850298226f},
-std::array<float,2>{0.120373152f, 0.322422415f},
-std::array<float,2>{0.548530459f, 0.603991091f},
-std::array<float,2>{0.649708033f, 0.496128917f},
-std::array<float,2>{0.240023181f, 0.679502487f},
-std::array<float,2>{0.410473824f, 0.0022739477f},
-std::array<float,2>{0.836822808f, 0.942611635f},
-std::array<float,2>{0.661891758f, 0.0217308085f},
-std::array<float,2>{0.214900285f, 0.953218102f},
-std::array<float,2>{0.400090188f, 0.482344359f},
-std::array<float,2>{0.844007492f, 0.65634644f},
-std::array<float,2>{0.878082216f, 0.329211801f},
-std::array<float,2>{0.335307062f, 0.613853514f},
-std::array<float,2>{0.0688288733f, 0.227324262f},
-std::array<float,2>{0.510870218f, 0.860396862f},
-std::array<float,2>{0.801324785f, 0.131014198f},
-std::array<float,2>{0.487482786f, 0.792862773f},
-std::array<float,2>{0.133497015f, 0.27692166f},
-std::array<float,2>{0.709164202f, 0.54913491f},
-std::array<float,2>{0.594723642f, 0.431345195f},
-std::array<float,2>{0.0201806761f, 0.741565466f},
-std::array<float,2>{0.250449568f, 0.119009793f},
-std::array<float,2>{0.994473517f, 0.936508179f},
-std::array<float,2>{0.537767649f, 0.216143161f},
-std::array<float,2>{0.0955442116f, 0.831312478f},
-std::array<float,2>{0.359844774f, 0.34518829f},
-std::array<float,2>{0.932964444f, 0.580774069f},
-std::array<float,2>{0.817899823f, 0.468065768f},
-std::array<float,2>{0.430611849f, 0.630859256f},
-std::array<float,2>{0.218825087f, 0.061301548f},
-std::array<float,2>{0.629494607f, 0.981704772f},
-std::array<float,2>{0.941632032f, 0.0713479072f},
-std::array<float,2>{0.284573287f, 0.885907173f},
-std::array<float,2>{0.0566372983f, 0.404358804f},
-std::array<float,2>{0.566772401f, 0.713773608f},
-std::array<float,2>{0.737297356f, 0.305212528f},
-std::array<float,2>{0.179518104f, 0.527577281f},
-std::array<float,2>{0.461001039f, 0.158206269f},
-std::array<float,2>{0.780933201f, 0.751812637f},
-std::array<float,2>{0.636366487f, 0.219794959f},
-std::array<float,2>{0.230721235f, 0.872876763f},
-std::array<float,2>{0.425584018f, 0.33826074f},
-std::array<float,2>{0.826612234f, 0.620454252f},
-std::array<float,2>{0.922121465f, 0.473897576f},
-std::array<float,2>{0.371039063f, 0.664808214f},
-std::array<float,2>{0.10889142f, 0.0243312772f},
-std::array<float,2>{0.546746492f, 0.967437983f},
-std::array<float,2>{0.769750059f, 0.114872694f},
-std::array<float,2>{0.460126847f, 0.925965428f},
-std::array<float,2>{0.180097774f, 0.422864407f},
-std::array<float,2>{0.748841882f, 0.747483134f},
-std::array<float,2>{0.570821404f, 0.273333192f},
-std::array<float,2>{0.0498986915f, 0.561119676f},
-std::array<float,2>{0.290759861f, 0.136118069f},
-std::array<float,2>{0.947374463f, 0.78468591f},
-std::array<float,2>{0.503708541f, 0.047290273f},
-std::array<float,2>{0.0746391267f, 0.971298158f},
-std::array<float,2>{0.336276412f, 0.456423581f},
-std::array<float,2>{0.883301973f, 0.639949322f},
-std::array<float,2>{0.853889942f, 0.35546115f},
-std::array<float,2>{0.392788261f, 0.588556707f},
-std::array<float,2>{0.206271484f, 0.208567455f},
-std::array<float,2>{0.665826797f, 0.841808677f},
-std::array<float,2>{0.985829055f, 0.166347116f},
-std::array<float,2>{0.262054354f, 0.758610845f},
-std::array<float,2>{0.0264962167f, 0.30188477f},
-std::array<float,2>{0.601688087f, 0.518227816f},
-std::array<float,2>{0.711292922f, 0.394326121f},
-std::array<float,2>{0.127544463f, 0.708317339f},
-std::array<float,2>{0.494495958f, 0.0637555346f},
-std::array<float,2>{0.812440693f, 0.88107729f},
-std::array<float,2>{0.722681403f, 0.0785828605f},
-std::array<float,2>{0.162381887f, 0.902643144f},
-std::array<float,2>{0.439653635f, 0.388047665f},
-std::array<float,2>{0.758907497f, 0.702886581f},
-std::array<float,2>{0.968077004f, 0.296027303f},
-std::array<float,2>{0.303726226f, 0.511775732f},
-std::array<float,2>{0.0352471657f, 0.178361684f},
-std::array<float,2>{0.585677445f, 0.769606769f},
-std::array<float,2>{0.829467833f, 0.197365105f},
-std::array<float,2>{0.416755468f, 0.822913885f},
-std::array<float,2>{0.246661231f, 0.361935645f},
-std::array<float,2>{0.641071022f, 0.574194133f},
-std::array<float,2>{0.558967412f, 0.447948933f},
-std::array<float,2>{0.110165432f, 0.644394577f},
-std::array<float,2>{0.350850135f, 0.0386275873f},
-std::array<float,2>{0.912152052f, 0.991228819f},
-std::array<float,2>{0.611124873f, 0.146331042f},
-std::array<float,2>{0.00500791799f, 0.801198006f},
-std::array<float,2>{0.280355066f, 0.259180367f},
-std::array<float,2>{0.979109347f, 0.544547617f},
-std::array<float,2>{0.786360323f, 0.406760126f},
-std::array<float,2>{0.471351415f, 0.725872576f},
-std::array<float,2>{0.152422905f, 0.105354108f},
-std::array<float,2>{0.688268542f, 0.918395936f},
-std::array<float,2>{0.904946506f, 0.00899367034f},
-std::array<float,2>{0.322948724f, 0.946890235f},
-std::array<float,2>{0.0892216861f, 0.485895991f},
-std::array<float,2>{0.516974092f, 0.687400937f},
-std::array<float,2>{0.673943877f, 0.317483991f},
-std::array<float,2>{0.203017339f, 0.600717187f},
-std::array<float,2>{0.377879411f, 0.238901913f},
-std::array<float,2>{0.863255024f, 0.85920471f},
-std::array<float,2>{0.745713651f, 0.189075366f},
-std::array<float,2>{0.186559319f, 0.817829013f},
-std::array<float,2>{0.453270584f, 0.367920071f},
-std::array<float,2>{0.768362045f, 0.567819059f},
-std::array<float,2>{0.950184941f, 0.439952016f},
-std::array<float,2>{0.29493916f, 0.656246364f},
-std::array<float,2>{0.0514307991f, 0.0419145599f},
-std::array<float,2>{0.574360967f, 0.993120432f},
-std::array<float,2>{0.823012888f, 0.0921705812f},
-std::array<float,2>{0.427954376f, 0.895169139f},
-std::array<float,2>{0.230275631f, 0.378641963f},
-std::array<float,2>{0.640500069f, 0.695044935f},
-std::array<float,2>{0.542598069f, 0.287201464f},
-std::array<float,2>{0.104214445f, 0.503537774f},
-std::array<float,2>{0.371705949f, 0.187272146f},
-std::array<float,2>{0.929394543f, 0.77891475f},
-std::array<float,2>{0.606322885f, 0.0045000934f},
-std::array<float,2>{0.0278611369f, 0.939155519f},
-std::array<float,2>{0.259782434f, 0.494325787f},
-std::array<float,2>{0.98904109f, 0.671908915f},
-std::array<float,2>{0.807456851f, 0.326626927f},
-std::array<float,2>{0.499717057f, 0.606633782f},
-std::array<float,2>{0.13205111f, 0.246231988f},
-std::array<float,2>{0.714949131f, 0.844218433f},
-std::array<float,2>{0.889585018f, 0.15215911f},
-std::array<float,2>{0.341207623f, 0.805608094f},
-std::array<float,2>{0.0740849376f, 0.252947301f},
-std::array<float,2>{0.507128775f, 0.53284049f},
-std::array<float,2>{0.670201778f, 0.415281653f},
-std::array<float,2>{0.210451871f, 0.730462134f},
-std::array<float,2>{0.397987306f, 0.0945019051f},
-std::array<float,2>{0.858550012f, 0.907078147f},
-std::array<float,2>{0.646816432f, 0.123511828f},
-std::array<float,2>{0.245944068f, 0.933532536f},
-std::array<float,2>{0.418936431f, 0.436808556f},
-std::array<float,2>{0.833993971f, 0.734993815f},
-std::array<float,2>{0.907514334f, 0.277356684f},
-std::array<float,2>{0.344516605f, 0.554450929f},
-std::array<float,2>{0.117016673f, 0.128502548f},
-std::array<float,2>{0.557457209f, 0.79598546f},
-std::array<float,2>{0.762474775f, 0.23116003f},
-std::array<float,2>{0.444394737f, 0.866148651f},
-std::array<float,2>{0.158868551f, 0.335839987f},
-std::array<float,2>{0.720156848f, 0.611244619f},
-std::array<float,2>{0.581276894f, 0.478425801f},
-std::array<float,2>{0.034738414f, 0.663691044f},
-std::array<float,2>{0.300225914f, 0.0182276256f},
-std::array<float,2>{0.963477612f, 0.957870781f},
-std::array<float,2>{0.520564795f, 0.16341044f},
-std::array<float,2>{0.0921840966f, 0.756410718f},
-std::array<float,2>{0.327395648f, 0.309035838f},
-std::array<float,2>{0.901608765f, 0.523919821f},
-std::array<float,2>{0.863669813f, 0.40153718f},
-std::array<float,2>{0.379507542f, 0.718421519f},
-std::array<float,2>{0.19785431f, 0.0767396614f},
-std::array<float,2>{0.678512037f, 0.8886168f},
-std::array<float,2>{0.982426584f, 0.0555052049f},
-std::array<float,2>{0.274475515f, 0.979137123f},
-std::array<float,2>{0.00203128648f, 0.462085932f},
-std::array<float,2>{0.613433957f, 0.627722919f},
-std::array<float,2>{0.692817271f, 0.350890756f},
-std::array<float,2>{0.151743889f, 0.585150421f},
-std::array<float,2>{0.475351363f, 0.211471543f},
-std::array<float,2>{0.783574343f, 0.833314538f},
-std::array<float,2>{0.686352432f, 0.140003458f},
-std::array<float,2>{0.192036003f, 0.788352132f},
-std::array<float,2>{0.388640225f, 0.268516123f},
-std::array<float,2>{0.86832279f, 0.555938065f},
-std::array<float,2>{0.89535743f, 0.429430425f},
-std::array<float,2>{0.31314081f, 0.743589938f},
-std::array<float,2>{0.0822496042f, 0.110373192f},
-std::array<float,2>{0.526591182f, 0.923880875f},
-std::array<float,2>{0.795904696f, 0.0302569922f},
-std::array<float,2>{0.47860682f, 0.962073684f},
-std::array<float,2>{0.1448396f, 0.472488761f},
-std::array<float,2>{0.695936978f, 0.670007706f},
-std::array<float,2>{0.619049013f, 0.339855224f},
-std::array<float,2>{0.0131406318f, 0.622699082f},
-std::array<float,2>{0.272096783f, 0.226207316f},
-std::array<float,2>{0.973884523f, 0.869709134f},
-std::array<float,2>{0.553523839f, 0.0696088672f},
-std::array<float,2>{0.1229375f, 0.87749362f},
-std::array<float,2>{0.356064618f, 0.397343546f},
-std::array<float,2>{0.920616627f, 0.704145551f},
-std::array<float,2>{0.842013001f, 0.299642533f},
-std::array<float,2>{0.406646937f, 0.520309687f},
-std::array<float,2>{0.237563789f, 0.171826959f},
-std::array<float,2>{0.653292179f, 0.763686776f},
-std::array<float,2>{0.954131067f, 0.203996807f},
-std::array<float,2>{0.31201908f, 0.837450802f},
-std::array<float,2>{0.0462437943f, 0.358216316f},
-std::array<float,2>{0.591890454f, 0.590070009f},
-std::array<float,2>{0.730450571f, 0.45878309f},
-std::array<float,2>{0.16753158f, 0.633130372f},
-std::array<float,2>{0.451963991f, 0.0542171709f},
-std::array<float,2>{0.756450832f, 0.973221183f},
-std::array<float,2>{0.705554843f, 0.0327191018f},
-std::array<float,2>{0.136967391f, 0.986324131f},
-std::array<float,2>{0.490385294f, 0.452314079f},
-std::array<float,2>{0.797543526f, 0.646616638f},
-std::array<float,2>{0.998589218f, 0.365431756f},
-std::array<float,2>{0.25408867f, 0.574312806f},
-std::array<float,2>{0.0161856804f, 0.199221626f},
-std::array<float,2>{0.599971771f, 0.827331424f},
-std::array<float,2>{0.851256728f, 0.17406486f},
-std::array<float,2>{0.405051827f, 0.768689573f},
-std::array<float,2>{0.212088585f, 0.289706439f},
-std::array<float,2>{0.65652895f, 0.509412229f},
-std::array<float,2>{0.513959646f, 0.384752452f},
-std::array<float,2>{0.0632798597f, 0.698608994f},
-std::array<float,2>{0.330495864f, 0.0828786343f},
-std::array<float,2>{0.881181836f, 0.900734603f},
-std::array<float,2>{0.566012204f, 0.234654292f},
-std::array<float,2>{0.0616357289f, 0.853731573f},
-std::array<float,2>{0.288758904f, 0.31616199f},
-std::array<float,2>{0.93812561f, 0.597436547f},
-std::array<float,2>{0.77448386f, 0.490840554f},
-std::array<float,2>{0.465892255f, 0.681518257f},
-std::array<float,2>{0.171880722f, 0.0146758966f},
-std::array<float,2>{0.739902318f, 0.951216817f},
-std::array<float,2>{0.93667388f, 0.106351458f},
-std::array<float,2>{0.363295406f, 0.914479971f},
-std::array<float,2>{0.0992755592f, 0.412831306f},
-std::array<float,2>{0.531683922f, 0.719642341f},
-std::array<float,2>{0.625215292f, 0.265176386f},
-std::array<float,2>{0.223714173f, 0.539948225f},
-std::array<float,2>{0.437039196f, 0.142858416f},
-std::array<float,2>{0.815720677f, 0.797859788f},
-std::array<float,2>{0.733592749f, 0.155442014f},
-std::array<float,2>{0.171511635f, 0.811941683f},
-std::array<float,2>{0.445485115f, 0.25719139f},
-std::array<float,2>{0.753420293f, 0.539019942f},
-std::array<float,2>{0.958380342f, 0.420192778f},
-std::array<float,2>{0.305571139f, 0.733293653f},
-std::array<float,2>{0.0411043502f, 0.0996666849f},
-std::array<float,2>{0.588839293f, 0.910569429f},
-std::array<float,2>{0.839001834f, 0.00152109459f},
-std::array<float,2>{0.413973808f, 0.943915904f},
-std::array<float,2>{0.240960225f, 0.498860061f},
-std::array<float,2>{0.651962996f, 0.677242458f},
-std::array<float,2>{0.55029583f, 0.32132405f},
-std::array<float,2>{0.117449932f, 0.601926088f},
-std::array<float,2>{0.351987749f, 0.243904933f},
-std::array<float,2>{0.915334344f, 0.848879397f},
-std::array<float,2>{0.624599218f, 0.0891597793f},
-std::array<float,2>{0.00961969234f, 0.89238888f},
-std::array<float,2>{0.266794622f, 0.380353034f},
-std::array<float,2>{0.969977379f, 0.689414084f},
-std::array<float,2>{0.79010731f, 0.28394857f},
-std::array<float,2>{0.482019126f, 0.504874527f},
-std::array<float,2>{0.141337678f, 0.180035397f},
-std::array<float,2>{0.701197922f, 0.775833607f},
-std::array<float,2>{0.890854359f, 0.194259405f},
-std::array<float,2>{0.31882441f, 0.813880742f},
-std::array<float,2>{0.0796086341f, 0.37121883f},
-std::array<float,2>{0.528327107f, 0.566054165f},
-std::array<float,2>{0.681127787f, 0.445177257f},
-std::array<float,2>{0.187719405f, 0.650253832f},
-std::array<float,2>{0.3846533f, 0.0430081859f},
-std::array<float,2>{0.874303937f, 0.99934572f},
-std::array<float,2>{0.630904138f, 0.0591593646f},
-std::array<float,2>{0.222015128f, 0.982676625f},
-std::array<float,2>{0.433338016f, 0.465014398f},
-std::array<float,2>{0.819682896f, 0.632538617f},
-std::array<float,2>{0.930193543f, 0.346322745f},
-std::array<float,2>{0.363272965f, 0.579850256f},
-std::array<float,2>{0.0971116051f, 0.218099847f},
-std::array<float,2>{0.537104249f, 0.828824818f},
-std::array<float,2>{0.778341353f, 0.156684533f},
-std::array<float,2>{0.464381814f, 0.752056181f},
-std::array<float,2>{0.176306337f, 0.307479501f},
-std::array<float,2>{0.736088097f, 0.53102535f},
-std::array<float,2>{0.56885016f, 0.403219372f},
-std::array<float,2>{0.0578595102f, 0.712233484f},
-std::array<float,2>{0.281687558f, 0.0729573295f},
-std::array<float,2>{0.944495797f, 0.883669078f},
-std::array<float,2>{0.509163916f, 0.228749275f},
-std::array<float,2>{0.0664767846f, 0.861876249f},
-std::array<float,2>{0.333592147f, 0.330546409f},
-std::array<float,2>{0.875722826f, 0.615975142f},
-std::array<float,2>{0.847050011f, 0.484090388f},
-std::array<float,2>{0.401517004f, 0.658302307f},
-std::array<float,2>{0.217250958f, 0.020522587f},
-std::array<float,2>{0.663569808f, 0.956091464f},
-std::array<float,2>{0.993890166f, 0.119906723f},
-std::array<float,2>{0.252059221f, 0.9352175f},
-std::array<float,2>{0.0228173509f, 0.43327716f},
-std::array<float,2>{0.596833229f, 0.738602042f},
-std::array<float,2>{0.708040357f, 0.275360465f},
-std::array<float,2>{0.136553138f, 0.54699403f},
-std::array<float,2>{0.485979795f, 0.129733533f},
-std::array<float,2>{0.803825319f, 0.789512992f},
-std::array<float,2>{0.667380273f, 0.209474608f},
-std::array<float,2>{0.204136521f, 0.841669083f},
-std::array<float,2>{0.392121434f, 0.352996588f},
-std::array<float,2>{0.852316976f, 0.586442232f},
-std::array<float,2>{0.885381997f, 0.453514159f},
-std::array<float,2>{0.339200497f, 0.637470067f},
-std::array<float,2>{0.0776163936f, 0.0502866991f},
-std::array<float,2>{0.501312733f, 0.968988776f},
-std::array<float,2>{0.808702409f, 0.065911442f},
-std::array<float,2>{0.492541671f, 0.880263984f},
-std::array<float,2>{0.126739487f, 0.392083734f},
-std::array<float,2>{0.714461625f, 0.709234536f},
-std::array<float,2>{0.604721427f, 0.303640366f},
-std::array<float,2>{0.0243023392f, 0.517539322f},
-std::array<float,2>{0.265015483f, 0.165416449f},
-std::array<float,2>{0.987826765f, 0.75987643f},
-std::array<float,2>{0.543487191f, 0.0264223926f},
-std::array<float,2>{0.10553582f, 0.965731859f},
-std::array<float,2>{0.368210703f, 0.475597411f},
-std::array<float,2>{0.924806297f, 0.667765558f},
-std::array<float,2>{0.824251294f, 0.337833673f},
-std::array<float,2>{0.421999633f, 0.617557526f},
-std::array<float,2>{0.233382568f, 0.221153066f},
-std::array<float,2>{0.63300693f, 0.874068916f},
-std::array<float,2>{0.946456015f, 0.133858532f},
-std::array<float,2>{0.292031139f, 0.782431543f},
-std::array<float,2>{0.0486293398f, 0.270381391f},
-std::array<float,2>{0.573799789f, 0.559282362f},
-std::array<float,2>{0.748011947f, 0.424714506f},
-std::array<float,2>{0.183593065f, 0.749649644f},
-std::array<float,2>{0.457684815f, 0.116873026f},
-std::array<float,2>{0.773281634f, 0.927825928f},
-std::array<float,2>{0.690583646f, 0.101901069f},
-std::array<float,2>{0.154304683f, 0.921174049f},
-std::array<float,2>{0.470132738f, 0.409491092f},
-std::array<float,2>{0.788731039f, 0.723124981f},
-std::array<float,2>{0.9766137f, 0.259962469f},
-std::array<float,2>{0.278521389f, 0.546318352f},
-std::array<float,2>{0.00616375962f, 0.146741435f},
-std::array<float,2>{0.612909913f, 0.804650605f},
-std::array<float,2>{0.861069083f, 0.241812855f},
-std::array<float,2>{0.375833124f, 0.857051313f},
-std::array<float,2>{0.200531408f, 0.318836182f},
-std::array<float,2>{0.672083378f, 0.599249542f},
-std::array<float,2>{0.517690301f, 0.487788767f},
-std::array<float,2>{0.0859790817f, 0.685330153f},
-std::array<float,2>{0.321895659f, 0.00981995557f},
-std::array<float,2>{0.904197752f, 0.947616518f},
-std::array<float,2>{0.583090305f, 0.176564112f},
-std::array<float,2>{0.0381467752f, 0.771948695f},
-std::array<float,2>{0.301042706f, 0.293874413f},
-std::array<float,2>{0.964970231f, 0.513873875f},
-std::array<float,2>{0.761602402f, 0.388682097f},
-std::array<float,2>{0.438483238f, 0.700139463f},
-std::array<float,2>{0.160221949f, 0.0818478316f},
-std::array<float,2>{0.725237608f, 0.90595901f},
-std::array<float,2>{0.910763502f, 0.0362568647f},
-std::array<float,2>{0.349153906f, 0.989590883f},
-std::array<float,2>{0.113031797f, 0.447175771f},
-std::array<float,2>{0.561212063f, 0.641658068f},
-std::array<float,2>{0.643145561f, 0.360000134f},
-std::array<float,2>{0.249699384f, 0.571213424f},
-std::array<float,2>{0.415882528f, 0.196190715f},
-std::array<float,2>{0.830716431f, 0.820672035f},
-std::array<float,2>{0.718172133f, 0.248461694f},
-std::array<float,2>{0.129320428f, 0.846973479f},
-std::array<float,2>{0.496994764f, 0.324846596f},
-std::array<float,2>{0.806496799f, 0.607816815f},
-std::array<float,2>{0.990945339f, 0.492428452f},
-std::array<float,2>{0.25812459f, 0.675778866f},
-std::array<float,2>{0.0294351093f, 0.00645164028f},
-std::array<float,2>{0.608400285f, 0.940862417f},
-std::array<float,2>{0.855929673f, 0.0969944373f},
-std::array<float,2>{0.394883931f, 0.909844458f},
-std::array<float,2>{0.208958209f, 0.417046875f},
-std::array<float,2>{0.668152392f, 0.727169335f},
-std::array<float,2>{0.504827499f, 0.251452804f},
-std::array<float,2>{0.0710727498f, 0.53468883f},
-std::array<float,2>{0.342628241f, 0.149764419f},
-std::array<float,2>{0.887862921f, 0.807187319f},
-std::array<float,2>{0.576299131f, 0.0392973907f},
-std::array<float,2>{0.0529255383f, 0.995166123f},
-std::array<float,2>{0.294257462f, 0.437811971f},
-std::array<float,2>{0.951237619f, 0.652954936f},
-std::array<float,2>{0.765755415f, 0.37104249f},
-std::array<float,2>{0.456821978f, 0.568830729f},
-std::array<float,2>{0.183848813f, 0.189842477f},
-std::array<float,2>{0.743099988f, 0.81936723f},
-std::array<float,2>{0.927339256f, 0.184580728f},
-std::array<float,2>{0.374271095f, 0.779874563f},
-std::array<float,2>{0.102893174f, 0.286365062f},
-std::array<float,2>{0.540680647f, 0.501229167f},
-std::array<float,2>{0.637482107f, 0.376009822f},
-std::array<float,2>{0.227606028f, 0.691629469f},
-std::array<float,2>{0.42688024f, 0.0909935161f},
-std::array<float,2>{0.821223795f, 0.897895217f},
-std::array<float,2>{0.675985992f, 0.075265184f},
-std::array<float,2>{0.195979953f, 0.888745904f},
-std::array<float,2>{0.381597757f, 0.398481816f},
-std::array<float,2>{0.866559625f, 0.716541767f},
-std::array<float,2>{0.898907542f, 0.310625553f},
-std::array<float,2>{0.324821651f, 0.527066588f},
-std::array<float,2>{0.0911877602f, 0.161037251f},
-std::array<float,2>{0.522539079f, 0.755571663f},
-std::array<float,2>{0.781591356f, 0.213721737f},
-std::array<float,2>{0.474173725f, 0.8340379f},
-std::array<float,2>{0.149236873f, 0.348064393f},
-std::array<float,2>{0.693894744f, 0.583373725f},
-std::array<float,2>{0.616692722f, 0.463706315f},
-std::array<float,2>{0.00120114372f, 0.626336873f},
-std::array<float,2>{0.27682215f, 0.0583015047f},
-std::array<float,2>{0.982142687f, 0.978244185f},
-std::array<float,2>{0.556317508f, 0.126828015f},
-std::array<float,2>{0.113406867f, 0.793801427f},
-std::array<float,2>{0.347546697f, 0.279385298f},
-std::array<float,2>{0.909775615f, 0.552360773f},
-std::array<float,2>{0.83286041f, 0.434769213f},
-std::array<float,2>{0.420406491f, 0.737011433f},
-std::array<float,2>{0.244129524f, 0.121844672f},
-std::array<float,2>{0.646377683f, 0.931462646f},
-std::array<float,2>{0.961049795f, 0.0162817501f},
-std::array<float,2>{0.297433883f, 0.960636318f},
-std::array<float,2>{0.0314366147f, 0.479878217f},
-std::array<float,2>{0.579447806f, 0.66112417f},
-std::array<float,2>{0.721548796f, 0.332167476f},
-std::array<float,2>{0.157494262f, 0.613129199f},
-std::array<float,2>{0.443114877f, 0.234224275f},
-std::array<float,2>{0.764018536f, 0.864836216f},
-std::array<float,2>{0.654346287f, 0.169074267f},
-std::array<float,2>{0.234470829f, 0.763383806f},
-std::array<float,2>{0.408556342f, 0.297799408f},
-std::array<float,2>{0.840278685f, 0.521603048f},
-std::array<float,2>{0.919228733f, 0.394969225f},
-std::array<float,2>{0.358742923f, 0.705504775f},
-std::array<float,2>{0.124901608f, 0.0667534992f},
-std::array<float,2>{0.551667273f, 0.876581669f},
-std::array<float,2>{0.75419414f, 0.052099023f},
-std::array<float,2>{0.450516731f, 0.976407886f},
-std::array<float,2>{0.165043801f, 0.459974825f},
-std::array<float,2>{0.727818608f, 0.635273516f},
-std::array<float,2>{0.590475023f, 0.357202977f},
-std::array<float,2>{0.0435345434f, 0.59246552f},
-std::array<float,2>{0.310439616f, 0.206052572f},
-std::array<float,2>{0.955945015f, 0.839756489f},
-std::array<float,2>{0.524759412f, 0.11309734f},
-std::array<float,2>{0.0843132213f, 0.923058033f},
-std::array<float,2>{0.315497398f, 0.426388711f},
-std::array<float,2>{0.898225784f, 0.745702446f},
-std::array<float,2>{0.871049225f, 0.267185509f},
-std::array<float,2>{0.390211612f, 0.557715476f},
-std::array<float,2>{0.195214614f, 0.13775304f},
-std::array<float,2>{0.684894383f, 0.785514653f},
-std::array<float,2>{0.976400018f, 0.223790228f},
-std::array<float,2>{0.271016568f, 0.867355585f},
-std::array<float,2>{0.014690523f, 0.343540817f},
-std::array<float,2>{0.62027663f, 0.624395132f},
-std::array<float,2>{0.698545277f, 0.468913466f},
-std::array<float,2>{0.147683084f, 0.669690013f},
-std::array<float,2>{0.478431046f, 0.0278114192f},
-std::array<float,2>{0.794403434f, 0.963532567f},
-std::array<float,2>{0.742012024f, 0.012595051f},
-std::array<float,2>{0.174522832f, 0.950443327f},
-std::array<float,2>{0.467690349f, 0.488411456f},
-std::array<float,2>{0.77565217f, 0.682402074f},
-std::array<float,2>{0.940630078f, 0.312592119f},
-std::array<float,2>{0.285739183f, 0.595682442f},
-std::array<float,2>{0.0598784462f, 0.238103464f},
-std::array<float,2>{0.562931478f, 0.852776408f},
-std::array<float,2>{0.813016295f, 0.140710562f},
-std::array<float,2>{0.434372544f, 0.798879445f},
-std::array<float,2>{0.226217076f, 0.262821645f},
-std::array<float,2>{0.627601743f, 0.541130185f},
-std::array<float,2>{0.533629119f, 0.411280751f},
-std::array<float,2>{0.101217732f, 0.721993625f},
-std::array<float,2>{0.366928667f, 0.107457049f},
-std::array<float,2>{0.9351964f, 0.917827606f},
-std::array<float,2>{0.598939419f, 0.202621982f},
-std::array<float,2>{0.018754771f, 0.824230433f},
-std::array<float,2>{0.257174641f, 0.363900304f},
-std::array<float,2>{0.996583879f, 0.576463997f},
-std::array<float,2>{0.800141871f, 0.449835569f},
-std::array<float,2>{0.489478052f, 0.644535422f},
-std::array<float,2>{0.140576258f, 0.0345526561f},
-std::array<float,2>{0.704268992f, 0.986417592f},
-std::array<float,2>{0.879887938f, 0.084682025f},
-std::array<float,2>{0.32987693f, 0.898680389f},
-std::array<float,2>{0.0659229904f, 0.385210216f},
-std::array<float,2>{0.513480067f, 0.695607603f},
-std::array<float,2>{0.658436298f, 0.291350752f},
-std::array<float,2>{0.214526653f, 0.510177374f},
-std::array<float,2>{0.404278606f, 0.172672361f},
-std::array<float,2>{0.847779155f, 0.765684605f},
-std::array<float,2>{0.696221888f, 0.136847556f},
-std::array<float,2>{0.144667417f, 0.78622967f},
-std::array<float,2>{0.478975207f, 0.266423404f},
-std::array<float,2>{0.796297193f, 0.556955457f},
-std::array<float,2>{0.973764718f, 0.427067965f},
-std::array<float,2>{0.272216797f, 0.74463594f},
-std::array<float,2>{0.012763896f, 0.111675851f},
-std::array<float,2>{0.618842244f, 0.922207355f},
-std::array<float,2>{0.868543625f, 0.0288416073f},
-std::array<float,2>{0.388268083f, 0.96435374f},
-std::array<float,2>{0.192231968f, 0.470236719f},
-std::array<float,2>{0.686187088f, 0.668176413f},
-std::array<float,2>{0.526825726f, 0.341956705f},
-std::array<float,2>{0.0823365077f, 0.623323023f},
-std::array<float,2>{0.313255608f, 0.223008141f},
-std::array<float,2>{0.895179093f, 0.868543327f},
-std::array<float,2>{0.592254281f, 0.0676508844f},
-std::array<float,2>{0.045954857f, 0.87574482f},
-std::array<float,2>{0.312403053f, 0.395761251f},
-std::array<float,2>{0.954566896f, 0.706724167f},
-std::array<float,2>{0.756743848f, 0.29854387f},
-std::array<float,2>{0.451839894f, 0.523435533f},
-std::array<float,2>{0.16791755f, 0.168473914f},
-std::array<float,2>{0.730087519f, 0.76242125f},
-std::array<float,2>{0.920727253f, 0.206858814f},
-std::array<float,2>{0.356332123f, 0.83797425f},
-std::array<float,2>{0.122774534f, 0.355760336f},
-std::array<float,2>{0.553347766f, 0.593635321f},
-std::array<float,2>{0.65297699f, 0.459853113f},
-std::array<float,2>{0.237459093f, 0.636069834f},
-std::array<float,2>{0.406315476f, 0.051756978f},
-std::array<float,2>{0.842238963f, 0.974622846f},
-std::array<float,2>{0.656319201f, 0.0339923948f},
-std::array<float,2>{0.212270379f, 0.98802036f},
-std::array<float,2>{0.405018717f, 0.450634003f},
-std::array<float,2>{0.851493657f, 0.645690858f},
-std::array<float,2>{0.880888999f, 0.365154803f},
-std::array<float,2>{0.330149204f, 0.577969968f},
-std::array<float,2>{0.0630767941f, 0.201966316f},
-std::array<float,2>{0.513868451f, 0.825413644f},
-std::array<float,2>{0.797778249f, 0.173493162f},
-std::array<float,2>{0.490657598f, 0.76675427f},
-std::array<float,2>{0.136877432f, 0.292524338f},
-std::array<float,2>{0.705229342f, 0.511484385f},
-std::array<float,2>{0.599661887f, 0.386074185f},
-std::array<float,2>{0.0164953265f, 0.696612656f},
-std::array<float,2>{0.254277736f, 0.0857007056f},
-std::array<float,2>{0.998818219f, 0.900295854f},
-std::array<float,2>{0.531442046f, 0.236826494f},
-std::array<float,2>{0.0995135978f, 0.851920247f},
-std::array<float,2>{0.363649905f, 0.314153731f},
-std::array<float,2>{0.937011302f, 0.593932569f},
-std::array<float,2>{0.815566778f, 0.49015829f},
-std::array<float,2>{0.437402636f, 0.683215559f},
-std::array<float,2>{0.223920882f, 0.0136025771f},
-std::array<float,2>{0.625337601f, 0.94976306f},
-std::array<float,2>{0.938368618f, 0.10906437f},
-std::array<float,2>{0.28893134f, 0.916162968f},
-std::array<float,2>{0.0617749356f, 0.410617381f},
-std::array<float,2>{0.566346049f, 0.721476018f},
-std::array<float,2>{0.74004662f, 0.262471884f},
-std::array<float,2>{0.172251865f, 0.542338729f},
-std::array<float,2>{0.466101438f, 0.141708732f},
-std::array<float,2>{0.77481705f, 0.800635219f},
-std::array<float,2>{0.640153527f, 0.190772519f},
-std::array<float,2>{0.230001017f, 0.819263637f},
-std::array<float,2>{0.42799446f, 0.369383633f},
-std::array<float,2>{0.822980523f, 0.570124447f},
-std::array<float,2>{0.92965734f, 0.439219415f},
-std::array<float,2>{0.371842325f, 0.653397202f},
-std::array<float,2>{0.104319982f, 0.0405098684f},
-std::array<float,2>{0.54294312f, 0.994751871f},
-std::array<float,2>{0.76815474f, 0.0906766951f},
-std::array<float,2>{0.453523397f, 0.897425056f},
-std::array<float,2>{0.186922267f, 0.375533432f},
-std::array<float,2>{0.745962083f, 0.692651153f},
-std::array<float,2>{0.574612916f, 0.285733342f},
-std::array<float,2>{0.0517317504f, 0.500125527f},
-std::array<float,2>{0.295390666f, 0.183898658f},
-std::array<float,2>{0.949800253f, 0.781219006f},
-std::array<float,2>{0.507034302f, 0.0072534848f},
-std::array<float,2>{0.0738212839f, 0.939933419f},
-std::array<float,2>{0.340952158f, 0.493650615f},
-std::array<float,2>{0.889389336f, 0.673871279f},
-std::array<float,2>{0.858823121f, 0.325724602f},
-std::array<float,2>{0.398216248f, 0.608650565f},
-std::array<float,2>{0.210822731f, 0.249107063f},
-std::array<float,2>{0.670154452f, 0.846288383f},
-std::array<float,2>{0.988788724f, 0.149243891f},
-std::array<float,2>{0.260105133f, 0.807738841f},
-std::array<float,2>{0.0280990973f, 0.25072661f},
-std::array<float,2>{0.606188357f, 0.533409834f},
-std::array<float,2>{0.715121388f, 0.416126788f},
-std::array<float,2>{0.132152885f, 0.727980256f},
-std::array<float,2>{0.499830216f, 0.0965549648f},
-std::array<float,2>{0.807327926f, 0.908563495f},
-std::array<float,2>{0.71990639f, 0.122450933f},
-std::array<float,2>{0.15894334f, 0.930633008f},
-std::array<float,2>{0.444810599f, 0.4342255f},
-std::array<float,2>{0.76242286f, 0.738081574f},
-std::array<float,2>{0.963760853f, 0.280879229f},
-std::array<float,2>{0.299912095f, 0.551693439f},
-std::array<float,2>{0.0349641591f, 0.125557467f},
-std::array<float,2>{0.581345618f, 0.794785619f},
-std::array<float,2>{0.834312439f, 0.232995585f},
-std::array<float,2>{0.418596208f, 0.863909781f},
-std::array<float,2>{0.245838121f, 0.333540291f},
-std::array<float,2>{0.64670521f, 0.611359239f},
-std::array<float,2>{0.557223678f, 0.478988439f},
-std::array<float,2>{0.116761945f, 0.661147773f},
-std::array<float,2>{0.344430417f, 0.0167581998f},
-std::array<float,2>{0.9074139f, 0.959905744f},
-std::array<float,2>{0.613580644f, 0.161135703f},
-std::array<float,2>{0.00232618814f, 0.754425943f},
-std::array<float,2>{0.274774343f, 0.311687589f},
-std::array<float,2>{0.982679188f, 0.526082575f},
-std::array<float,2>{0.78324604f, 0.39998731f},
-std::array<float,2>{0.475257844f, 0.71560061f},
-std::array<float,2>{0.151415333f, 0.0743197054f},
-std::array<float,2>{0.692527294f, 0.889772534f},
-std::array<float,2>{0.901692152f, 0.057343863f},
-std::array<float,2>{0.327234596f, 0.976919353f},
-std::array<float,2>{0.0919160247f, 0.464155436f},
-std::array<float,2>{0.520756066f, 0.625094652f},
-std::array<float,2>{0.678275466f, 0.349593282f},
-std::array<float,2>{0.198197559f, 0.582576394f},
-std::array<float,2>{0.379835665f, 0.21414271f},
-std::array<float,2>{0.863298893f, 0.835681081f},
-std::array<float,2>{0.748677015f, 0.222303689f},
-std::array<float,2>{0.179708153f, 0.873803794f},
-std::array<float,2>{0.460259378f, 0.336142451f},
-std::array<float,2>{0.769990802f, 0.618626177f},
-std::array<float,2>{0.947528541f, 0.474754155f},
-std::array<float,2>{0.290883988f, 0.666336179f},
-std::array<float,2>{0.0501874723f, 0.0259430707f},
-std::array<float,2>{0.571088731f, 0.966764867f},
-std::array<float,2>{0.826234043f, 0.116108909f},
-std::array<float,2>{0.425386876f, 0.92891252f},
-std::array<float,2>{0.230555981f, 0.424870968f},
-std::array<float,2>{0.636544287f, 0.748281419f},
-std::array<float,2>{0.546494842f, 0.271471351f},
-std::array<float,2>{0.109164961f, 0.560076833f},
-std::array<float,2>{0.370701373f, 0.133748576f},
-std::array<float,2>{0.92208463f, 0.782200277f},
-std::array<float,2>{0.601903975f, 0.0494383462f},
-std::array<float,2>{0.0268446375f, 0.970598698f},
-std::array<float,2>{0.26181376f, 0.454613447f},
-std::array<float,2>{0.98553896f, 0.638656676f},
-std::array<float,2>{0.812047839f, 0.35232085f},
-std::array<float,2>{0.494233966f, 0.586950839f},
-std::array<float,2>{0.127818376f, 0.21065639f},
-std::array<float,2>{0.71115309f, 0.840185463f},
-std::array<float,2>{0.883686244f, 0.164779708f},
-std::array<float,2>{0.336122572f, 0.761693239f},
-std::array<float,2>{0.0744030625f, 0.30459711f},
-std::array<float,2>{0.503489852f, 0.515917063f},
-std::array<float,2>{0.66557169f, 0.391193897f},
-std::array<float,2>{0.206474304f, 0.710649729f},
-std::array<float,2>{0.393044651f, 0.0648828819f},
-std::array<float,2>{0.853569448f, 0.879267693f},
-std::array<float,2>{0.640673459f, 0.0807937756f},
-std::array<float,2>{0.246843874f, 0.904675484f},
-std::array<float,2>{0.416679502f, 0.390001386f},
-std::array<float,2>{0.829139292f, 0.700681746f},
-std::array<float,2>{0.912488639f, 0.294116229f},
-std::array<float,2>{0.350791365f, 0.515173614f},
-std::array<float,2>{0.110024422f, 0.177301034f},
-std::array<float,2>{0.558781445f, 0.772644162f},
-std::array<float,2>{0.759079754f, 0.197073326f},
-std::array<float,2>{0.439713001f, 0.821489334f},
-std::array<float,2>{0.162246346f, 0.360650182f},
-std::array<float,2>{0.723074019f, 0.57171917f},
-std::array<float,2>{0.585911572f, 0.445682734f},
-std::array<float,2>{0.0355579592f, 0.640933096f},
-std::array<float,2>{0.304110676f, 0.0356082059f},
-std::array<float,2>{0.96780622f, 0.988446116f},
-std::array<float,2>{0.51676327f, 0.148304239f},
-std::array<float,2>{0.0889022797f, 0.803669035f},
-std::array<float,2>{0.323078454f, 0.260829866f},
-std::array<float,2>{0.905072391f, 0.545723557f},
-std::array<float,2>{0.862889409f, 0.408366978f},
-std::array<float,2>{0.377578288f, 0.724536657f},
-std::array<float,2>{0.202678993f, 0.102993846f},
-std::array<float,2>{0.674185574f, 0.920535564f},
-std::array<float,2>{0.97940594f, 0.0111533916f},
-std::array<float,2>{0.280584395f, 0.948717475f},
-std::array<float,2>{0.0052225017f, 0.487048596f},
-std::array<float,2>{0.610931754f, 0.683619022f},
-std::array<float,2>{0.68803072f, 0.319608688f},
-std::array<float,2>{0.152625248f, 0.598613977f},
-std::array<float,2>{0.471530557f, 0.241093725f},
-std::array<float,2>{0.786576033f, 0.855777621f},
-std::array<float,2>{0.683526635f, 0.180794373f},
-std::array<float,2>{0.19024983f, 0.777139544f},
-std::array<float,2>{0.385581911f, 0.284887075f},
-std::array<float,2>{0.872978687f, 0.505670309f},
-std::array<float,2>{0.893597186f, 0.379443318f},
-std::array<float,2>{0.318154454f, 0.687591076f},
-std::array<float,2>{0.0808469057f, 0.0885296986f},
-std::array<float,2>{0.529859126f, 0.890963376f},
-std::array<float,2>{0.792130053f, 0.0446597897f},
-std::array<float,2>{0.484108865f, 0.998134613f},
-std::array<float,2>{0.143074334f, 0.44398725f},
-std::array<float,2>{0.699269295f, 0.649256945f},
-std::array<float,2>{0.622858882f, 0.372213036f},
-std::array<float,2>{0.0110093169f, 0.564743102f},
-std::array<float,2>{0.267728806f, 0.194544867f},
-std::array<float,2>{0.970999241f, 0.813201308f},
-std::array<float,2>{0.548660994f, 0.101275861f},
-std::array<float,2>{0.120118834f, 0.911598861f},
-std::array<float,2>{0.353807777f, 0.421056151f},
-std::array<float,2>{0.917186141f, 0.733728349f},
-std::array<float,2>{0.836488605f, 0.256331533f},
-std::array<float,2>{0.410193682f, 0.537403166f},
-std::array<float,2>{0.239807174f, 0.154844686f},
-std::array<float,2>{0.649620652f, 0.811216831f},
-std::array<float,2>{0.96070224f, 0.243039712f},
-std::array<float,2>{0.307671666f, 0.847854018f},
-std::array<float,2>{0.0392709561f, 0.321134061f},
-std::array<float,2>{0.585944891f, 0.60280627f},
-std::array<float,2>{0.73194325f, 0.49915731f},
-std::array<float,2>{0.16910772f, 0.675799489f},
-std::array<float,2>{0.447977126f, 0.000791794853f},
-std::array<float,2>{0.750207186f, 0.944859684f},
-std::array<float,2>{0.709404647f, 0.0201289766f},
-std::array<float,2>{0.133602619f, 0.955223501f},
-std::array<float,2>{0.487689286f, 0.48259756f},
-std::array<float,2>{0.801755786f, 0.659443259f},
-std::array<float,2>{0.994263887f, 0.331470251f},
-std::array<float,2>{0.250237733f, 0.616468728f},
-std::array<float,2>{0.0203528777f, 0.229544997f},
-std::array<float,2>{0.594439507f, 0.862692416f},
-std::array<float,2>{0.843846381f, 0.130791947f},
-std::array<float,2>{0.400296777f, 0.79030025f},
-std::array<float,2>{0.215244651f, 0.273452133f},
-std::array<float,2>{0.661662519f, 0.548340619f},
-std::array<float,2>{0.511034429f, 0.431830466f},
-std::array<float,2>{0.0685995221f, 0.739336848f},
-std::array<float,2>{0.335072279f, 0.120318718f},
-std::array<float,2>{0.878339291f, 0.934123456f},
-std::array<float,2>{0.566611648f, 0.217739284f},
-std::array<float,2>{0.0562133938f, 0.829497993f},
-std::array<float,2>{0.28418687f, 0.347622395f},
-std::array<float,2>{0.941731155f, 0.578480065f},
-std::array<float,2>{0.781222761f, 0.465935826f},
-std::array<float,2>{0.461416632f, 0.631398201f},
-std::array<float,2>{0.179372132f, 0.0597243197f},
-std::array<float,2>{0.736848354f, 0.983916581f},
-std::array<float,2>{0.932700217f, 0.0737710968f},
-std::array<float,2>{0.359481543f, 0.883925796f},
-std::array<float,2>{0.0952217132f, 0.403966099f},
-std::array<float,2>{0.5379017f, 0.711334705f},
-std::array<float,2>{0.629751325f, 0.308157623f},
-std::array<float,2>{0.219005734f, 0.529613853f},
-std::array<float,2>{0.430176884f, 0.157825947f},
-std::array<float,2>{0.818187833f, 0.753090382f},
-std::array<float,2>{0.72767359f, 0.170879006f},
-std::array<float,2>{0.165523186f, 0.765107095f},
-std::array<float,2>{0.450277835f, 0.300305068f},
-std::array<float,2>{0.754150093f, 0.521295011f},
-std::array<float,2>{0.955749571f, 0.398385525f},
-std::array<float,2>{0.310139537f, 0.703495026f},
-std::array<float,2>{0.043860469f, 0.068689324f},
-std::array<float,2>{0.590815246f, 0.878358841f},
-std::array<float,2>{0.839903712f, 0.0531777628f},
-std::array<float,2>{0.408352673f, 0.974342346f},
-std::array<float,2>{0.234637588f, 0.457181215f},
-std::array<float,2>{0.654682338f, 0.633977711f},
-std::array<float,2>{0.551423073f, 0.358712137f},
-std::array<float,2>{0.124569245f, 0.591721535f},
-std::array<float,2>{0.358531833f, 0.204414025f},
-std::array<float,2>{0.919175267f, 0.83686918f},
-std::array<float,2>{0.620519638f, 0.110139392f},
-std::array<float,2>{0.0149933351f, 0.924842715f},
-std::array<float,2>{0.271326065f, 0.428497434f},
-std::array<float,2>{0.976239443f, 0.742385566f},
-std::array<float,2>{0.794108093f, 0.268580914f},
-std::array<float,2>{0.478066832f, 0.555382431f},
-std::array<float,2>{0.147862628f, 0.138827786f},
-std::array<float,2>{0.698343039f, 0.787973046f},
-std::array<float,2>{0.89813751f, 0.225319296f},
-std::array<float,2>{0.315892726f, 0.871083498f},
-std::array<float,2>{0.0842004716f, 0.341508627f},
-std::array<float,2>{0.524640799f, 0.621634185f},
-std::array<float,2>{0.684619308f, 0.471434057f},
-std::array<float,2>{0.19498764f, 0.670970023f},
-std::array<float,2>{0.390572131f, 0.0303315464f},
-std::array<float,2>{0.870806277f, 0.961541653f},
-std::array<float,2>{0.627784371f, 0.0142262038f},
-std::array<float,2>{0.226542547f, 0.9523139f},
-std::array<float,2>{0.434319139f, 0.491382867f},
-std::array<float,2>{0.813288987f, 0.679695249f},
-std::array<float,2>{0.935314536f, 0.315335572f},
-std::array<float,2>{0.366987109f, 0.596403539f},
-std::array<float,2>{0.101429895f, 0.235567048f},
-std::array<float,2>{0.533385634f, 0.854882419f},
-std::array<float,2>{0.7755602f, 0.143587485f},
-std::array<float,2>{0.467443615f, 0.797674596f},
-std::array<float,2>{0.174744263f, 0.264486074f},
-std::array<float,2>{0.741772175f, 0.540575683f},
-std::array<float,2>{0.562621534f, 0.413737297f},
-std::array<float,2>{0.0597171113f, 0.720399499f},
-std::array<float,2>{0.285959959f, 0.10703823f},
-std::array<float,2>{0.940862298f, 0.915984154f},
-std::array<float,2>{0.513391137f, 0.200602382f},
-std::array<float,2>{0.0661628544f, 0.827111602f},
-std::array<float,2>{0.329825133f, 0.366377681f},
-std::array<float,2>{0.880276442f, 0.575954854f},
-std::array<float,2>{0.847988367f, 0.451777905f},
-std::array<float,2>{0.403979838f, 0.648189843f},
-std::array<float,2>{0.214762554f, 0.0315423682f},
-std::array<float,2>{0.658615053f, 0.984663248f},
-std::array<float,2>{0.996981025f, 0.0830253586f},
-std::array<float,2>{0.256900758f, 0.902225435f},
-std::array<float,2>{0.019035643f, 0.383611679f},
-std::array<float,2>{0.598775685f, 0.697698951f},
-std::array<float,2>{0.704499066f, 0.291007936f},
-std::array<float,2>{0.140344173f, 0.508245826f},
-std::array<float,2>{0.489549547f, 0.175523713f},
-std::array<float,2>{0.799837828f, 0.767668247f},
-std::array<float,2>{0.66834265f, 0.248007044f},
-std::array<float,2>{0.208730221f, 0.845358729f},
-std::array<float,2>{0.394611895f, 0.327434719f},
-std::array<float,2>{0.855521262f, 0.605867207f},
-std::array<float,2>{0.887979388f, 0.495610327f},
-std::array<float,2>{0.342314333f, 0.673035383f},
-std::array<float,2>{0.0709095597f, 0.00547662564f},
-std::array<float,2>{0.504626036f, 0.937603056f},
-std::array<float,2>{0.80638206f, 0.0953148827f},
-std::array<float,2>{0.496643841f, 0.90744406f},
-std::array<float,2>{0.129104644f, 0.414343268f},
-std::array<float,2>{0.717950881f, 0.729173124f},
-std::array<float,2>{0.608855605f, 0.252114415f},
-std::array<float,2>{0.0295912884f, 0.531936228f},
-std::array<float,2>{0.25784865f, 0.150964171f},
-std::array<float,2>{0.991126001f, 0.805767715f},
-std::array<float,2>{0.540940464f, 0.0428048111f},
-std::array<float,2>{0.102617666f, 0.993536294f},
-std::array<float,2>{0.374070108f, 0.440579981f},
-std::array<float,2>{0.927506745f, 0.654479325f},
-std::array<float,2>{0.820913851f, 0.368473858f},
-std::array<float,2>{0.427145869f, 0.566807032f},
-std::array<float,2>{0.227931559f, 0.188072354f},
-std::array<float,2>{0.637293935f, 0.816674054f},
-std::array<float,2>{0.951473236f, 0.185747623f},
-std::array<float,2>{0.29415825f, 0.778019428f},
-std::array<float,2>{0.0531293564f, 0.288765222f},
-std::array<float,2>{0.576555371f, 0.502044439f},
-std::array<float,2>{0.742831409f, 0.377816349f},
-std::array<float,2>{0.183767438f, 0.693901956f},
-std::array<float,2>{0.456715047f, 0.0930180848f},
-std::array<float,2>{0.765980005f, 0.895814061f},
-std::array<float,2>{0.69433111f, 0.078078866f},
-std::array<float,2>{0.149053916f, 0.887144923f},
-std::array<float,2>{0.474373877f, 0.401168495f},
-std::array<float,2>{0.781324148f, 0.717103004f},
-std::array<float,2>{0.982271016f, 0.309848815f},
-std::array<float,2>{0.27638942f, 0.524684131f},
-std::array<float,2>{0.00129062659f, 0.162149981f},
-std::array<float,2>{0.616229177f, 0.75715059f},
-std::array<float,2>{0.866221964f, 0.212512448f},
-std::array<float,2>{0.381591678f, 0.832147896f},
-std::array<float,2>{0.196085304f, 0.35012421f},
-std::array<float,2>{0.676232696f, 0.584713757f},
-std::array<float,2>{0.522825599f, 0.461876601f},
-std::array<float,2>{0.090977028f, 0.628469229f},
-std::array<float,2>{0.325043857f, 0.0561207198f},
-std::array<float,2>{0.898539424f, 0.979777515f},
-std::array<float,2>{0.579189301f, 0.126974002f},
-std::array<float,2>{0.0315481909f, 0.794977903f},
-std::array<float,2>{0.297731221f, 0.279103428f},
-std::array<float,2>{0.961308062f, 0.553611934f},
-std::array<float,2>{0.763684034f, 0.436073065f},
-std::array<float,2>{0.4433074f, 0.735480964f},
-std::array<float,2>{0.157467291f, 0.124440394f},
-std::array<float,2>{0.721337914f, 0.932367504f},
-std::array<float,2>{0.909972429f, 0.018788781f},
-std::array<float,2>{0.347353429f, 0.958757758f},
-std::array<float,2>{0.113738656f, 0.477461696f},
-std::array<float,2>{0.556520224f, 0.663014889f},
-std::array<float,2>{0.64620918f, 0.334449857f},
-std::array<float,2>{0.243670166f, 0.609535217f},
-std::array<float,2>{0.420025051f, 0.232245833f},
-std::array<float,2>{0.832612514f, 0.867020249f},
-std::array<float,2>{0.714813471f, 0.207408652f},
-std::array<float,2>{0.126572043f, 0.843715847f},
-std::array<float,2>{0.492369652f, 0.353567809f},
-std::array<float,2>{0.809055567f, 0.589198053f},
-std::array<float,2>{0.988248706f, 0.45567441f},
-std::array<float,2>{0.264842749f, 0.638752282f},
-std::array<float,2>{0.0240973514f, 0.0487990044f},
-std::array<float,2>{0.604821205f, 0.972311735f},
-std::array<float,2>{0.852093697f, 0.0630833581f},
-std::array<float,2>{0.392500371f, 0.882467568f},
-std::array<float,2>{0.204400524f, 0.393348724f},
-std::array<float,2>{0.667166114f, 0.707084537f},
-std::array<float,2>{0.501018345f, 0.300994158f},
-std::array<float,2>{0.0771805793f, 0.519437671f},
-std::array<float,2>{0.338984698f, 0.167097345f},
-std::array<float,2>{0.88559854f, 0.758926809f},
-std::array<float,2>{0.574066639f, 0.024808649f},
-std::array<float,2>{0.0483585186f, 0.967956364f},
-std::array<float,2>{0.292437613f, 0.472890049f},
-std::array<float,2>{0.946768403f, 0.665351093f},
-std::array<float,2>{0.773030996f, 0.339169711f},
-std::array<float,2>{0.457764089f, 0.619747639f},
-std::array<float,2>{0.183247656f, 0.219070718f},
-std::array<float,2>{0.7476511f, 0.871844649f},
-std::array<float,2>{0.925115764f, 0.135432363f},
-std::array<float,2>{0.368508697f, 0.783570051f},
-std::array<float,2>{0.105841361f, 0.271652937f},
-std::array<float,2>{0.543815911f, 0.561626613f},
-std::array<float,2>{0.633246839f, 0.422161639f},
-std::array<float,2>{0.233105659f, 0.746902645f},
-std::array<float,2>{0.422308981f, 0.113906845f},
-std::array<float,2>{0.824527442f, 0.927642047f},
-std::array<float,2>{0.672210813f, 0.103571646f},
-std::array<float,2>{0.200404719f, 0.91944623f},
-std::array<float,2>{0.37549293f, 0.407282382f},
-std::array<float,2>{0.861177623f, 0.724644721f},
-std::array<float,2>{0.903842032f, 0.257976979f},
-std::array<float,2>{0.322226435f, 0.543210626f},
-std::array<float,2>{0.0863045529f, 0.14465934f},
-std::array<float,2>{0.518065274f, 0.801912189f},
-std::array<float,2>{0.788974106f, 0.240176618f},
-std::array<float,2>{0.469816238f, 0.857945979f},
-std::array<float,2>{0.154735297f, 0.316564977f},
-std::array<float,2>{0.69072479f, 0.600121021f},
-std::array<float,2>{0.613038361f, 0.484424055f},
-std::array<float,2>{0.00605714461f, 0.686500549f},
-std::array<float,2>{0.278629392f, 0.00818402227f},
-std::array<float,2>{0.976844847f, 0.945546329f},
-std::array<float,2>{0.561507285f, 0.179195955f},
-std::array<float,2>{0.113217674f, 0.770803034f},
-std::array<float,2>{0.349520266f, 0.295323372f},
-std::array<float,2>{0.911036193f, 0.513619125f},
-std::array<float,2>{0.831016362f, 0.387317449f},
-std::array<float,2>{0.415685922f, 0.701770604f},
-std::array<float,2>{0.249798164f, 0.0792297497f},
-std::array<float,2>{0.643549025f, 0.903326929f},
-std::array<float,2>{0.96522969f, 0.0376527682f},
-std::array<float,2>{0.300933599f, 0.990375698f},
-std::array<float,2>{0.038530495f, 0.44853273f},
-std::array<float,2>{0.583263934f, 0.642626286f},
-std::array<float,2>{0.725398898f, 0.362365872f},
-std::array<float,2>{0.160402983f, 0.573130906f},
-std::array<float,2>{0.438821346f, 0.198713556f},
-std::array<float,2>{0.761312664f, 0.823321521f},
-std::array<float,2>{0.652213991f, 0.152948737f},
-std::array<float,2>{0.241132751f, 0.810305059f},
-std::array<float,2>{0.413678199f, 0.254095286f},
-std::array<float,2>{0.839308202f, 0.536055267f},
-std::array<float,2>{0.915265381f, 0.418630481f},
-std::array<float,2>{0.351607233f, 0.732180536f},
-std::array<float,2>{0.117342785f, 0.099204056f},
-std::array<float,2>{0.550604284f, 0.913915098f},
-std::array<float,2>{0.753675818f, 0.00315342029f},
-std::array<float,2>{0.445590734f, 0.941811383f},
-std::array<float,2>{0.171796069f, 0.497790843f},
-std::array<float,2>{0.733650565f, 0.678088009f},
-std::array<float,2>{0.588387251f, 0.323902249f},
-std::array<float,2>{0.0412873365f, 0.604547083f},
-std::array<float,2>{0.305234313f, 0.245983422f},
-std::array<float,2>{0.958212793f, 0.851379156f},
-std::array<float,2>{0.52858597f, 0.0863765627f},
-std::array<float,2>{0.0799733698f, 0.893421292f},
-std::array<float,2>{0.318454951f, 0.382771254f},
-std::array<float,2>{0.890879571f, 0.691162825f},
-std::array<float,2>{0.874043524f, 0.28212586f},
-std::array<float,2>{0.384328514f, 0.507132113f},
-std::array<float,2>{0.187863484f, 0.182398483f},
-std::array<float,2>{0.680735707f, 0.77400589f},
-std::array<float,2>{0.969763696f, 0.192372128f},
-std::array<float,2>{0.266910583f, 0.815618515f},
-std::array<float,2>{0.00933964085f, 0.374378473f},
-std::array<float,2>{0.624903738f, 0.562611341f},
-std::array<float,2>{0.701466739f, 0.441669613f},
-std::array<float,2>{0.141434714f, 0.651124716f},
-std::array<float,2>{0.482374579f, 0.0450323038f},
-std::array<float,2>{0.790485859f, 0.996771634f},
-std::array<float,2>{0.736057997f, 0.0620682165f},
-std::array<float,2>{0.176702335f, 0.980606139f},
-std::array<float,2>{0.464787275f, 0.467725426f},
-std::array<float,2>{0.778623521f, 0.629330099f},
-std::array<float,2>{0.944769204f, 0.344052047f},
-std::array<float,2>{0.28144443f, 0.58122927f},
-std::array<float,2>{0.0579500198f, 0.215723023f},
-std::array<float,2>{0.569135368f, 0.830088913f},
-std::array<float,2>{0.819477022f, 0.159917697f},
-std::array<float,2>{0.433500826f, 0.750582695f},
-std::array<float,2>{0.22189492f, 0.305814296f},
-std::array<float,2>{0.631179035f, 0.528708518f},
-std::array<float,2>{0.536794603f, 0.406146556f},
-std::array<float,2>{0.0969217196f, 0.714437366f},
-std::array<float,2>{0.362900138f, 0.0710153431f},
-std::array<float,2>{0.930530012f, 0.885521948f},
-std::array<float,2>{0.597058237f, 0.228110179f},
-std::array<float,2>{0.0226093065f, 0.860278368f},
-std::array<float,2>{0.252208591f, 0.32838726f},
-std::array<float,2>{0.993906617f, 0.614343703f},
-std::array<float,2>{0.804138601f, 0.481341153f},
-std::array<float,2>{0.486295581f, 0.657311857f},
-std::array<float,2>{0.13629207f, 0.0226887614f},
-std::array<float,2>{0.708377779f, 0.954969227f},
-std::array<float,2>{0.875810087f, 0.117484927f},
-std::array<float,2>{0.333945394f, 0.937164247f},
-std::array<float,2>{0.066865921f, 0.43062979f},
-std::array<float,2>{0.509019434f, 0.74093169f},
-std::array<float,2>{0.663233995f, 0.2760818f},
-std::array<float,2>{0.216865063f, 0.550379992f},
-std::array<float,2>{0.40166238f, 0.131928891f},
-std::array<float,2>{0.846706986f, 0.791830003f},
-std::array<float,2>{0.706989408f, 0.174606308f},
-std::array<float,2>{0.137768343f, 0.769448578f},
-std::array<float,2>{0.491369635f, 0.289344728f},
-std::array<float,2>{0.798163176f, 0.50889802f},
-std::array<float,2>{0.999879181f, 0.38391009f},
-std::array<float,2>{0.255704582f, 0.699083686f},
-std::array<float,2>{0.0171548277f, 0.0821697488f},
-std::array<float,2>{0.600830197f, 0.90096426f},
-std::array<float,2>{0.85051924f, 0.0325538106f},
-std::array<float,2>{0.405297995f, 0.985747993f},
-std::array<float,2>{0.211903885f, 0.452832967f},
-std::array<float,2>{0.65758574f, 0.647157013f},
-std::array<float,2>{0.514658689f, 0.366189122f},
-std::array<float,2>{0.0637970716f, 0.574717641f},
-std::array<float,2>{0.331920505f, 0.200060993f},
-std::array<float,2>{0.881983161f, 0.827908576f},
-std::array<float,2>{0.565121174f, 0.105656013f},
-std::array<float,2>{0.0607387424f, 0.91455406f},
-std::array<float,2>{0.287312627f, 0.412142515f},
-std::array<float,2>{0.938632965f, 0.71916306f},
-std::array<float,2>{0.773673058f, 0.264990032f},
-std::array<float,2>{0.464987606f, 0.539074957f},
-std::array<float,2>{0.17299287f, 0.143466234f},
-std::array<float,2>{0.738382936f, 0.798801839f},
-std::array<float,2>{0.935978532f, 0.235192686f},
-std::array<float,2>{0.364268184f, 0.854006827f},
-std::array<float,2>{0.097673513f, 0.315510303f},
-std::array<float,2>{0.533136308f, 0.596737564f},
-std::array<float,2>{0.626930058f, 0.490241349f},
-std::array<float,2>{0.223283708f, 0.680725396f},
-std::array<float,2>{0.435808212f, 0.0155933918f},
-std::array<float,2>{0.815314472f, 0.951816499f},
-std::array<float,2>{0.687469304f, 0.0296935588f},
-std::array<float,2>{0.192897782f, 0.962415099f},
-std::array<float,2>{0.387055367f, 0.471943408f},
-std::array<float,2>{0.86738205f, 0.670706928f},
-std::array<float,2>{0.895788848f, 0.340542734f},
-std::array<float,2>{0.31393528f, 0.622247398f},
-std::array<float,2>{0.0831712037f, 0.225877643f},
-std::array<float,2>{0.526083827f, 0.869485319f},
-std::array<float,2>{0.795042098f, 0.140205517f},
-std::array<float,2>{0.480353564f, 0.788690746f},
-std::array<float,2>{0.146016091f, 0.267683029f},
-std::array<float,2>{0.697210133f, 0.556489527f},
-std::array<float,2>{0.617486954f, 0.429115564f},
-std::array<float,2>{0.0124946786f, 0.744003654f},
-std::array<float,2>{0.272478372f, 0.111246943f},
-std::array<float,2>{0.973135829f, 0.924364805f},
-std::array<float,2>{0.553789854f, 0.203359321f},
-std::array<float,2>{0.121366754f, 0.837033927f},
-std::array<float,2>{0.356600404f, 0.357497483f},
-std::array<float,2>{0.921694338f, 0.590719223f},
-std::array<float,2>{0.843741298f, 0.458337069f},
-std::array<float,2>{0.407911837f, 0.633775055f},
-std::array<float,2>{0.237066656f, 0.0541316159f},
-std::array<float,2>{0.653426647f, 0.972796261f},
-std::array<float,2>{0.953509152f, 0.0701436698f},
-std::array<float,2>{0.311346322f, 0.877196848f},
-std::array<float,2>{0.0452754535f, 0.396952718f},
-std::array<float,2>{0.593638062f, 0.704714119f},
-std::array<float,2>{0.729341626f, 0.298963398f},
-std::array<float,2>{0.166157171f, 0.519969881f},
-std::array<float,2>{0.452457368f, 0.171135157f},
-std::array<float,2>{0.757452309f, 0.764356136f},
-std::array<float,2>{0.647825897f, 0.23089391f},
-std::array<float,2>{0.244831175f, 0.865634322f},
-std::array<float,2>{0.419773638f, 0.335052907f},
-std::array<float,2>{0.835375547f, 0.610467613f},
-std::array<float,2>{0.906549573f, 0.477736592f},
-std::array<float,2>{0.344838113f, 0.663544476f},
-std::array<float,2>{0.115725935f, 0.0179645456f},
-std::array<float,2>{0.558423221f, 0.957320988f},
-std::array<float,2>{0.763174474f, 0.123972766f},
-std::array<float,2>{0.444157898f, 0.932943463f},
-std::array<float,2>{0.159757808f, 0.437014937f},
-std::array<float,2>{0.719467342f, 0.734651804f},
-std::array<float,2>{0.580933809f, 0.278234899f},
-std::array<float,2>{0.033957459f, 0.553856611f},
-std::array<float,2>{0.299657553f, 0.128169224f},
-std::array<float,2>{0.964466929f, 0.79644531f},
-std::array<float,2>{0.519934058f, 0.0551252104f},
-std::array<float,2>{0.0933000743f, 0.978746831f},
-std::array<float,2>{0.326469332f, 0.462838769f},
-std::array<float,2>{0.901175261f, 0.627262473f},
-std::array<float,2>{0.864507496f, 0.351151347f},
-std::array<float,2>{0.380167216f, 0.585617423f},
-std::array<float,2>{0.199110374f, 0.211016327f},
-std::array<float,2>{0.678849936f, 0.833883286f},
-std::array<float,2>{0.983671427f, 0.163795203f},
-std::array<float,2>{0.273548812f, 0.756065309f},
-std::array<float,2>{0.00342413201f, 0.309289217f},
-std::array<float,2>{0.615060925f, 0.524156272f},
-std::array<float,2>{0.691714942f, 0.401887536f},
-std::array<float,2>{0.150920063f, 0.717775583f},
-std::array<float,2>{0.476102203f, 0.0763473734f},
-std::array<float,2>{0.784180582f, 0.887908697f},
-std::array<float,2>{0.744262457f, 0.0924499184f},
-std::array<float,2>{0.18555361f, 0.894804716f},
-std::array<float,2>{0.454481035f, 0.378294557f},
-std::array<float,2>{0.769309223f, 0.694792151f},
-std::array<float,2>{0.950723946f, 0.287680656f},
-std::array<float,2>{0.296018749f, 0.503260016f},
-std::array<float,2>{0.052077055f, 0.186695412f},
-std::array<float,2>{0.575464487f, 0.778568685f},
-std::array<float,2>{0.824107409f, 0.188771918f},
-std::array<float,2>{0.428737849f, 0.818001986f},
-std::array<float,2>{0.228596598f, 0.367348343f},
-std::array<float,2>{0.63959986f, 0.568335831f},
-std::array<float,2>{0.541164041f, 0.43989557f},
-std::array<float,2>{0.104638591f, 0.655477107f},
-std::array<float,2>{0.372796565f, 0.0412200391f},
-std::array<float,2>{0.928032756f, 0.992613852f},
-std::array<float,2>{0.606855929f, 0.151401788f},
-std::array<float,2>{0.0288576279f, 0.80475384f},
-std::array<float,2>{0.261006624f, 0.253876388f},
-std::array<float,2>{0.989540637f, 0.532446504f},
-std::array<float,2>{0.808275044f, 0.415598691f},
-std::array<float,2>{0.498090357f, 0.729868472f},
-std::array<float,2>{0.130892694f, 0.0938945264f},
-std::array<float,2>{0.716662228f, 0.906560779f},
-std::array<float,2>{0.890449166f, 0.00434476184f},
-std::array<float,2>{0.340053827f, 0.938542426f},
-std::array<float,2>{0.0726062581f, 0.494849622f},
-std::array<float,2>{0.50605166f, 0.672633648f},
-std::array<float,2>{0.671307564f, 0.326843947f},
-std::array<float,2>{0.209927708f, 0.607409716f},
-std::array<float,2>{0.397234946f, 0.246717855f},
-std::array<float,2>{0.857729614f, 0.844567358f},
-std::array<float,2>{0.724054277f, 0.197969362f},
-std::array<float,2>{0.163970008f, 0.822515726f},
-std::array<float,2>{0.440437555f, 0.361482024f},
-std::array<float,2>{0.758480906f, 0.573405802f},
-std::array<float,2>{0.966834784f, 0.447530001f},
-std::array<float,2>{0.30291611f, 0.643971086f},
-std::array<float,2>{0.0365367904f, 0.0385383442f},
-std::array<float,2>{0.584196508f, 0.992071927f},
-std::array<float,2>{0.828931332f, 0.0788784549f},
-std::array<float,2>{0.417656451f, 0.902982354f},
-std::array<float,2>{0.247522056f, 0.388336211f},
-std::array<float,2>{0.642158568f, 0.702451468f},
-std::array<float,2>{0.560270071f, 0.296601206f},
-std::array<float,2>{0.110802598f, 0.512295127f},
-std::array<float,2>{0.350381255f, 0.178001806f},
-std::array<float,2>{0.913124144f, 0.770150661f},
-std::array<float,2>{0.61014998f, 0.00952679943f},
-std::array<float,2>{0.00457763625f, 0.946341097f},
-std::array<float,2>{0.280178159f, 0.485402197f},
-std::array<float,2>{0.97985065f, 0.686617911f},
-std::array<float,2>{0.785375774f, 0.318336427f},
-std::array<float,2>{0.471929967f, 0.601121306f},
-std::array<float,2>{0.154000551f, 0.238286108f},
-std::array<float,2>{0.689403892f, 0.858447552f},
-std::array<float,2>{0.905716181f, 0.14573127f},
-std::array<float,2>{0.323292524f, 0.801669538f},
-std::array<float,2>{0.0884447917f, 0.259672612f},
-std::array<float,2>{0.516505539f, 0.544277847f},
-std::array<float,2>{0.674874663f, 0.406710654f},
-std::array<float,2>{0.201558009f, 0.726444125f},
-std::array<float,2>{0.378131658f, 0.104605414f},
-std::array<float,2>{0.861753762f, 0.91888845f},
-std::array<float,2>{0.635371387f, 0.114547946f},
-std::array<float,2>{0.232284576f, 0.926401258f},
-std::array<float,2>{0.424078375f, 0.423705131f},
-std::array<float,2>{0.827231765f, 0.747945309f},
-std::array<float,2>{0.923467457f, 0.272863954f},
-std::array<float,2>{0.369361252f, 0.560548663f},
-std::array<float,2>{0.108349964f, 0.136522546f},
-std::array<float,2>{0.54504621f, 0.784184337f},
-std::array<float,2>{0.770973086f, 0.220445603f},
-std::array<float,2>{0.45989731f, 0.87207973f},
-std::array<float,2>{0.180898383f, 0.338571042f},
-std::array<float,2>{0.74966234f, 0.620911419f},
-std::array<float,2>{0.572117984f, 0.474311441f},
-std::array<float,2>{0.0493123382f, 0.66436708f},
-std::array<float,2>{0.290031344f, 0.0235811416f},
-std::array<float,2>{0.948387265f, 0.96689719f},
-std::array<float,2>{0.502162278f, 0.166914731f},
-std::array<float,2>{0.0760308132f, 0.758115292f},
-std::array<float,2>{0.33785823f, 0.302461267f},
-std::array<float,2>{0.884029329f, 0.518036127f},
-std::array<float,2>{0.854977131f, 0.393659741f},
-std::array<float,2>{0.3935574f, 0.708917618f},
-std::array<float,2>{0.205678165f, 0.0642121807f},
-std::array<float,2>{0.664328933f, 0.881540298f},
-std::array<float,2>{0.985043705f, 0.0477191508f},
-std::array<float,2>{0.2634781f, 0.970915616f},
-std::array<float,2>{0.0254300274f, 0.456566155f},
-std::array<float,2>{0.603461087f, 0.640206158f},
-std::array<float,2>{0.712328792f, 0.354507357f},
-std::array<float,2>{0.128114372f, 0.588056386f},
-std::array<float,2>{0.495868742f, 0.208256468f},
-std::array<float,2>{0.81121546f, 0.842624426f},
-std::array<float,2>{0.66087389f, 0.131699145f},
-std::array<float,2>{0.215869457f, 0.792048454f},
-std::array<float,2>{0.398798138f, 0.276453137f},
-std::array<float,2>{0.845606565f, 0.549365819f},
-std::array<float,2>{0.877825975f, 0.430687606f},
-std::array<float,2>{0.334640771f, 0.742007673f},
-std::array<float,2>{0.0698977187f, 0.118482843f},
-std::array<float,2>{0.510053754f, 0.936016917f},
-std::array<float,2>{0.80227679f, 0.0221426859f},
-std::array<float,2>{0.487158686f, 0.953740478f},
-std::array<float,2>{0.134606674f, 0.481467068f},
-std::array<float,2>{0.710849524f, 0.657033622f},
-std::array<float,2>{0.594867408f, 0.329722196f},
-std::array<float,2>{0.020620361f, 0.613325059f},
-std::array<float,2>{0.251349688f, 0.226850331f},
-std::array<float,2>{0.995414436f, 0.860920191f},
-std::array<float,2>{0.538253129f, 0.0717808083f},
-std::array<float,2>{0.0945665911f, 0.886247635f},
-std::array<float,2>{0.360680461f, 0.404809892f},
-std::array<float,2>{0.932403386f, 0.71306926f},
-std::array<float,2>{0.816486001f, 0.305078059f},
-std::array<float,2>{0.4312087f, 0.528141856f},
-std::array<float,2>{0.220612496f, 0.15893127f},
-std::array<float,2>{0.630066216f, 0.751255572f},
-std::array<float,2>{0.943187833f, 0.216380447f},
-std::array<float,2>{0.284103304f, 0.831882298f},
-std::array<float,2>{0.0556150824f, 0.345626622f},
-std::array<float,2>{0.56793493f, 0.580308378f},
-std::array<float,2>{0.737679601f, 0.468586087f},
-std::array<float,2>{0.178491607f, 0.630129218f},
-std::array<float,2>{0.462106258f, 0.0606487952f},
-std::array<float,2>{0.779627442f, 0.982049227f},
-std::array<float,2>{0.700509727f, 0.046225626f},
-std::array<float,2>{0.144402593f, 0.99776125f},
-std::array<float,2>{0.483115405f, 0.443104595f},
-std::array<float,2>{0.791169703f, 0.65137428f},
-std::array<float,2>{0.972038388f, 0.373965859f},
-std::array<float,2>{0.26909554f, 0.564249277f},
-std::array<float,2>{0.0104928231f, 0.192388639f},
-std::array<float,2>{0.621741533f, 0.814992964f},
-std::array<float,2>{0.87151283f, 0.183474109f},
-std::array<float,2>{0.386291981f, 0.775122404f},
-std::array<float,2>{0.191039011f, 0.282794923f},
-std::array<float,2>{0.682317495f, 0.506374776f},
-std::array<float,2>{0.531107724f, 0.38159281f},
-std::array<float,2>{0.0816948786f, 0.690402269f},
-std::array<float,2>{0.316423833f, 0.08772102f},
-std::array<float,2>{0.892878652f, 0.893818736f},
-std::array<float,2>{0.587394714f, 0.244847521f},
-std::array<float,2>{0.0403540023f, 0.849865437f},
-std::array<float,2>{0.307038039f, 0.323100656f},
-std::array<float,2>{0.959696651f, 0.604115367f},
-std::array<float,2>{0.751086771f, 0.496584684f},
-std::array<float,2>{0.448459327f, 0.678935349f},
-std::array<float,2>{0.168229684f, 0.00257269293f},
-std::array<float,2>{0.731190503f, 0.943284869f},
-std::array<float,2>{0.916949093f, 0.0981143266f},
-std::array<float,2>{0.355445892f, 0.912591577f},
-std::array<float,2>{0.119417056f, 0.419848949f},
-std::array<float,2>{0.547734916f, 0.730828643f},
-std::array<float,2>{0.64925462f, 0.255357713f},
-std::array<float,2>{0.238904342f, 0.536286235f},
-std::array<float,2>{0.411535621f, 0.153479069f},
-std::array<float,2>{0.837080956f, 0.809363723f},
-std::array<float,2>{0.740462959f, 0.141455784f},
-std::array<float,2>{0.175720915f, 0.799347341f},
-std::array<float,2>{0.468705595f, 0.263532698f},
-std::array<float,2>{0.776457667f, 0.541579902f},
-std::array<float,2>{0.939566731f, 0.41189754f},
-std::array<float,2>{0.28656137f, 0.72248888f},
-std::array<float,2>{0.0589541197f, 0.107994184f},
-std::array<float,2>{0.563556492f, 0.917155802f},
-std::array<float,2>{0.814117908f, 0.0118232323f},
-std::array<float,2>{0.435516775f, 0.950758576f},
-std::array<float,2>{0.225532934f, 0.488798469f},
-std::array<float,2>{0.628571451f, 0.682109058f},
-std::array<float,2>{0.53501308f, 0.313078433f},
-std::array<float,2>{0.100106768f, 0.594742835f},
-std::array<float,2>{0.36552614f, 0.23742345f},
-std::array<float,2>{0.933747768f, 0.853471935f},
-std::array<float,2>{0.59794879f, 0.0841897875f},
-std::array<float,2>{0.0183594488f, 0.899347663f},
-std::array<float,2>{0.256020576f, 0.38555339f},
-std::array<float,2>{0.997358441f, 0.696064889f},
-std::array<float,2>{0.799690008f, 0.291669518f},
-std::array<float,2>{0.489114642f, 0.510335565f},
-std::array<float,2>{0.139301896f, 0.172046691f},
-std::array<float,2>{0.703777075f, 0.766236544f},
-std::array<float,2>{0.878977835f, 0.20286645f},
-std::array<float,2>{0.328669697f, 0.824733377f},
-std::array<float,2>{0.0654181466f, 0.363430828f},
-std::array<float,2>{0.51193428f, 0.576715708f},
-std::array<float,2>{0.659568965f, 0.449473172f},
-std::array<float,2>{0.213003367f, 0.645321548f},
-std::array<float,2>{0.402601719f, 0.0347844921f},
-std::array<float,2>{0.84929049f, 0.986847758f},
-std::array<float,2>{0.656211197f, 0.0525358096f},
-std::array<float,2>{0.236035004f, 0.975803792f},
-std::array<float,2>{0.409274638f, 0.46058321f},
-std::array<float,2>{0.841528773f, 0.634993553f},
-std::array<float,2>{0.918185771f, 0.356511086f},
-std::array<float,2>{0.35814482f, 0.592138648f},
-std::array<float,2>{0.123297349f, 0.205138236f},
-std::array<float,2>{0.552635133f, 0.838924348f},
-std::array<float,2>{0.75492245f, 0.16973491f},
-std::array<float,2>{0.449777812f, 0.762733459f},
-std::array<float,2>{0.164770424f, 0.297312111f},
-std::array<float,2>{0.726884007f, 0.522436142f},
-std::array<float,2>{0.591778874f, 0.395426244f},
-std::array<float,2>{0.0441968404f, 0.705869019f},
-std::array<float,2>{0.30910027f, 0.0669132769f},
-std::array<float,2>{0.95685941f, 0.87599653f},
-std::array<float,2>{0.523645341f, 0.22432746f},
-std::array<float,2>{0.0858350918f, 0.868038833f},
-std::array<float,2>{0.315249622f, 0.343235701f},
-std::array<float,2>{0.897251189f, 0.624547362f},
-std::array<float,2>{0.869690776f, 0.469480604f},
-std::array<float,2>{0.389449835f, 0.669049382f},
-std::array<float,2>{0.194218248f, 0.027880786f},
-std::array<float,2>{0.68450278f, 0.963065922f},
-std::array<float,2>{0.974841893f, 0.112625435f},
-std::array<float,2>{0.269988328f, 0.923471332f},
-std::array<float,2>{0.0138659356f, 0.425981909f},
-std::array<float,2>{0.619921684f, 0.745366573f},
-std::array<float,2>{0.697690129f, 0.266657591f},
-std::array<float,2>{0.146644667f, 0.558132708f},
-std::array<float,2>{0.477373332f, 0.13819401f},
-std::array<float,2>{0.793289721f, 0.785682082f},
-std::array<float,2>{0.677376568f, 0.213313103f},
-std::array<float,2>{0.196398467f, 0.834841371f},
-std::array<float,2>{0.382188171f, 0.348298728f},
-std::array<float,2>{0.865338266f, 0.583695471f},
-std::array<float,2>{0.899793565f, 0.463144213f},
-std::array<float,2>{0.325996011f, 0.62669462f},
-std::array<float,2>{0.0901429057f, 0.0579862893f},
-std::array<float,2>{0.521742284f, 0.977718532f},
-std::array<float,2>{0.782316864f, 0.0757063404f},
-std::array<float,2>{0.473538369f, 0.889445424f},
-std::array<float,2>{0.14984937f, 0.399299145f},
-std::array<float,2>{0.694355845f, 0.715998471f},
-std::array<float,2>{0.615360975f, 0.31127575f},
-std::array<float,2>{0.0004734463f, 0.526729345f},
-std::array<float,2>{0.276148617f, 0.160241455f},
-std::array<float,2>{0.981423199f, 0.754955173f},
-std::array<float,2>{0.555072248f, 0.0157614462f},
-std::array<float,2>{0.114415795f, 0.960189939f},
-std::array<float,2>{0.346186191f, 0.480319321f},
-std::array<float,2>{0.908752024f, 0.660424471f},
-std::array<float,2>{0.833884478f, 0.332850277f},
-std::array<float,2>{0.421250492f, 0.612492025f},
-std::array<float,2>{0.243108839f, 0.233404413f},
-std::array<float,2>{0.645183206f, 0.864298224f},
-std::array<float,2>{0.962673783f, 0.126138344f},
-std::array<float,2>{0.298472196f, 0.793113053f},
-std::array<float,2>{0.0331535377f, 0.279856175f},
-std::array<float,2>{0.579005539f, 0.551784098f},
-std::array<float,2>{0.72215414f, 0.435409456f},
-std::array<float,2>{0.157058179f, 0.736344218f},
-std::array<float,2>{0.442265987f, 0.12132939f},
-std::array<float,2>{0.765385568f, 0.930833638f},
-std::array<float,2>{0.717034698f, 0.0975512564f},
-std::array<float,2>{0.13052699f, 0.909385324f},
-std::array<float,2>{0.497123808f, 0.417551488f},
-std::array<float,2>{0.804746628f, 0.726746202f},
-std::array<float,2>{0.991911769f, 0.251741469f},
-std::array<float,2>{0.259121031f, 0.53463012f},
-std::array<float,2>{0.0310400072f, 0.150013089f},
-std::array<float,2>{0.607515216f, 0.806918502f},
-std::array<float,2>{0.85672754f, 0.248839855f},
-std::array<float,2>{0.396220475f, 0.847233534f},
-std::array<float,2>{0.20725961f, 0.324584186f},
-std::array<float,2>{0.669846475f, 0.608393431f},
-std::array<float,2>{0.50495261f, 0.493151069f},
-std::array<float,2>{0.0720435455f, 0.674925804f},
-std::array<float,2>{0.343005687f, 0.00587773183f},
-std::array<float,2>{0.886769235f, 0.941269159f},
-std::array<float,2>{0.577369571f, 0.185283408f},
-std::array<float,2>{0.0546432026f, 0.77969265f},
-std::array<float,2>{0.293667793f, 0.286629498f},
-std::array<float,2>{0.952348948f, 0.501861036f},
-std::array<float,2>{0.767315328f, 0.376811057f},
-std::array<float,2>{0.455539048f, 0.692056656f},
-std::array<float,2>{0.185005575f, 0.0916052535f},
-std::array<float,2>{0.743317425f, 0.898346603f},
-std::array<float,2>{0.92617774f, 0.0398858562f},
-std::array<float,2>{0.373304248f, 0.996045947f},
-std::array<float,2>{0.102510199f, 0.438272297f},
-std::array<float,2>{0.539996862f, 0.652697325f},
-std::array<float,2>{0.638139546f, 0.37022385f},
-std::array<float,2>{0.226928368f, 0.568899214f},
-std::array<float,2>{0.425974369f, 0.190129712f},
-std::array<float,2>{0.821769595f, 0.819975138f},
-std::array<float,2>{0.689464748f, 0.241273999f},
-std::array<float,2>{0.155382559f, 0.856636465f},
-std::array<float,2>{0.469396263f, 0.319196254f},
-std::array<float,2>{0.787173867f, 0.598938882f},
-std::array<float,2>{0.977929771f, 0.488152862f},
-std::array<float,2>{0.277610749f, 0.684661865f},
-std::array<float,2>{0.0074228514f, 0.0106407246f},
-std::array<float,2>{0.611805439f, 0.947971404f},
-std::array<float,2>{0.860049963f, 0.102276877f},
-std::array<float,2>{0.376722962f, 0.921850443f},
-std::array<float,2>{0.199769959f, 0.409823567f},
-std::array<float,2>{0.673190475f, 0.723453879f},
-std::array<float,2>{0.519506335f, 0.260646373f},
-std::array<float,2>{0.0875667036f, 0.546662867f},
-std::array<float,2>{0.320605278f, 0.147422716f},
-std::array<float,2>{0.902728021f, 0.804145396f},
-std::array<float,2>{0.582878053f, 0.0370911732f},
-std::array<float,2>{0.0373148881f, 0.989954352f},
-std::array<float,2>{0.302400798f, 0.446628332f},
-std::array<float,2>{0.966686487f, 0.642158687f},
-std::array<float,2>{0.760624886f, 0.359548688f},
-std::array<float,2>{0.43764469f, 0.570765734f},
-std::array<float,2>{0.161246985f, 0.19540517f},
-std::array<float,2>{0.726303935f, 0.820936561f},
-std::array<float,2>{0.911823988f, 0.175783068f},
-std::array<float,2>{0.347707301f, 0.77208364f},
-std::array<float,2>{0.111765407f, 0.293048799f},
-std::array<float,2>{0.56234479f, 0.514525235f},
-std::array<float,2>{0.643603563f, 0.389305234f},
-std::array<float,2>{0.248419851f, 0.699691713f},
-std::array<float,2>{0.414480031f, 0.0812023506f},
-std::array<float,2>{0.831884325f, 0.905671299f},
-std::array<float,2>{0.666775167f, 0.0659270957f},
-std::array<float,2>{0.20392026f, 0.880655348f},
-std::array<float,2>{0.391507864f, 0.392257541f},
-std::array<float,2>{0.853112221f, 0.709637463f},
-std::array<float,2>{0.886515677f, 0.302785337f},
-std::array<float,2>{0.338816464f, 0.516904593f},
-std::array<float,2>{0.0770204514f, 0.165903479f},
-std::array<float,2>{0.500819027f, 0.760500371f},
-std::array<float,2>{0.809608221f, 0.209193334f},
-std::array<float,2>{0.493933648f, 0.840826035f},
-std::array<float,2>{0.125653431f, 0.353185803f},
-std::array<float,2>{0.713622391f, 0.586348116f},
-std::array<float,2>{0.603976011f, 0.453818887f},
-std::array<float,2>{0.0251657199f, 0.637149751f},
-std::array<float,2>{0.26398924f, 0.0506291352f},
-std::array<float,2>{0.986389518f, 0.969622195f},
-std::array<float,2>{0.544792771f, 0.134395987f},
-std::array<float,2>{0.106679849f, 0.783084333f},
-std::array<float,2>{0.367825687f, 0.269778877f},
-std::array<float,2>{0.924315095f, 0.558951557f},
-std::array<float,2>{0.82531023f, 0.42384249f},
-std::array<float,2>{0.423299253f, 0.749256432f},
-std::array<float,2>{0.23366642f, 0.116431281f},
-std::array<float,2>{0.634520352f, 0.928653896f},
-std::array<float,2>{0.945621133f, 0.0268593431f},
-std::array<float,2>{0.291336119f, 0.965167522f},
-std::array<float,2>{0.047044564f, 0.476295739f},
-std::array<float,2>{0.57290107f, 0.667312086f},
-std::array<float,2>{0.746297598f, 0.337166995f},
-std::array<float,2>{0.181871191f, 0.617784739f},
-std::array<float,2>{0.458235204f, 0.221397385f},
-std::array<float,2>{0.772201657f, 0.874725401f},
-std::array<float,2>{0.632526159f, 0.15702413f},
-std::array<float,2>{0.220948711f, 0.75289011f},
-std::array<float,2>{0.432148814f, 0.306990474f},
-std::array<float,2>{0.819218397f, 0.530723155f},
-std::array<float,2>{0.931408763f, 0.402462572f},
-std::array<float,2>{0.362124741f, 0.712705255f},
-std::array<float,2>{0.095924139f, 0.0727454498f},
-std::array<float,2>{0.535296977f, 0.883240163f},
-std::array<float,2>{0.778256893f, 0.0586820506f},
-std::array<float,2>{0.463563472f, 0.983138621f},
-std::array<float,2>{0.177025512f, 0.465582937f},
-std::array<float,2>{0.735269785f, 0.63211441f},
-std::array<float,2>{0.569392264f, 0.346051514f},
-std::array<float,2>{0.0571856201f, 0.579134762f},
-std::array<float,2>{0.282917649f, 0.218535498f},
-std::array<float,2>{0.943963945f, 0.828298628f},
-std::array<float,2>{0.508542657f, 0.119158387f},
-std::array<float,2>{0.0679442585f, 0.935020149f},
-std::array<float,2>{0.33217296f, 0.43287158f},
-std::array<float,2>{0.876753151f, 0.738981426f},
-std::array<float,2>{0.846287668f, 0.274552822f},
-std::array<float,2>{0.401358396f, 0.547741592f},
-std::array<float,2>{0.218742594f, 0.129135966f},
-std::array<float,2>{0.662745833f, 0.789777219f},
-std::array<float,2>{0.992887199f, 0.229040071f},
-std::array<float,2>{0.253065944f, 0.861465931f},
-std::array<float,2>{0.0220814794f, 0.330832213f},
-std::array<float,2>{0.596564233f, 0.615444958f},
-std::array<float,2>{0.707451344f, 0.483831763f},
-std::array<float,2>{0.134937927f, 0.659079611f},
-std::array<float,2>{0.485280126f, 0.0213992242f},
-std::array<float,2>{0.803468525f, 0.956696689f},
-std::array<float,2>{0.732657075f, 0.00104619749f},
-std::array<float,2>{0.170555532f, 0.943822443f},
-std::array<float,2>{0.446994901f, 0.498261482f},
-std::array<float,2>{0.752376795f, 0.67738533f},
-std::array<float,2>{0.957526386f, 0.322011918f},
-std::array<float,2>{0.306034893f, 0.602390349f},
-std::array<float,2>{0.0429378152f, 0.243330553f},
-std::array<float,2>{0.589524031f, 0.849575758f},
-std::array<float,2>{0.838294148f, 0.15609239f},
-std::array<float,2>{0.412368476f, 0.812033772f},
-std::array<float,2>{0.241459563f, 0.257722378f},
-std::array<float,2>{0.650975764f, 0.5383237f},
-std::array<float,2>{0.549242377f, 0.420494884f},
-std::array<float,2>{0.11891111f, 0.732812464f},
-std::array<float,2>{0.352648228f, 0.100402087f},
-std::array<float,2>{0.914715946f, 0.911126792f},
-std::array<float,2>{0.623205245f, 0.19369784f},
-std::array<float,2>{0.00806736667f, 0.814277768f},
-std::array<float,2>{0.266164184f, 0.371657819f},
-std::array<float,2>{0.9691118f, 0.565582752f},
-std::array<float,2>{0.78933692f, 0.444505095f},
-std::array<float,2>{0.481052428f, 0.649446487f},
-std::array<float,2>{0.141966209f, 0.0436771475f},
-std::array<float,2>{0.702937603f, 0.999593616f},
-std::array<float,2>{0.891925931f, 0.0896950215f},
-std::array<float,2>{0.319543481f, 0.892007947f},
-std::array<float,2>{0.0788028538f, 0.380451292f},
-std::array<float,2>{0.527950168f, 0.688685417f},
-std::array<float,2>{0.680430532f, 0.28368488f},
-std::array<float,2>{0.188788682f, 0.50400579f},
-std::array<float,2>{0.383737952f, 0.180553421f},
-std::array<float,2>{0.873943329f, 0.77636379f},
-std::array<float,2>{0.716107011f, 0.149425343f},
-std::array<float,2>{0.131438285f, 0.807497382f},
-std::array<float,2>{0.49894771f, 0.251060218f},
-std::array<float,2>{0.807706535f, 0.535005212f},
-std::array<float,2>{0.990059793f, 0.417347491f},
-std::array<float,2>{0.261649787f, 0.727475643f},
-std::array<float,2>{0.0283361562f, 0.0969140008f},
-std::array<float,2>{0.607228935f, 0.909925044f},
-std::array<float,2>{0.857990384f, 0.00675979629f},
-std::array<float,2>{0.396787673f, 0.94048363f},
-std::array<float,2>{0.209237114f, 0.492514431f},
-std::array<float,2>{0.671825647f, 0.675477028f},
-std::array<float,2>{0.506527901f, 0.324980319f},
-std::array<float,2>{0.0728975385f, 0.607616901f},
-std::array<float,2>{0.340585083f, 0.24819769f},
-std::array<float,2>{0.889818072f, 0.84681201f},
-std::array<float,2>{0.575854301f, 0.0911305174f},
-std::array<float,2>{0.0525744632f, 0.897491992f},
-std::array<float,2>{0.296818316f, 0.376403332f},
-std::array<float,2>{0.950317264f, 0.691805542f},
-std::array<float,2>{0.768940866f, 0.2865794f},
-std::array<float,2>{0.454945505f, 0.500977397f},
-std::array<float,2>{0.186142296f, 0.185007349f},
-std::array<float,2>{0.745041549f, 0.78018254f},
-std::array<float,2>{0.928364992f, 0.189546525f},
-std::array<float,2>{0.37220332f, 0.819750726f},
-std::array<float,2>{0.104993582f, 0.370741427f},
-std::array<float,2>{0.541557729f, 0.568513989f},
-std::array<float,2>{0.639136672f, 0.437734962f},
-std::array<float,2>{0.229268089f, 0.653104722f},
-std::array<float,2>{0.429577649f, 0.0394497178f},
-std::array<float,2>{0.823531926f, 0.995524943f},
-std::array<float,2>{0.679454088f, 0.0585693717f},
-std::array<float,2>{0.198575005f, 0.978402495f},
-std::array<float,2>{0.380456895f, 0.46339491f},
-std::array<float,2>{0.86517483f, 0.626077592f},
-std::array<float,2>{0.90083462f, 0.347802371f},
-std::array<float,2>{0.3269476f, 0.583160341f},
-std::array<float,2>{0.0931567326f, 0.213589504f},
-std::array<float,2>{0.520480752f, 0.834446907f},
-std::array<float,2>{0.784846902f, 0.160833538f},
-std::array<float,2>{0.475715786f, 0.755811751f},
-std::array<float,2>{0.15039666f, 0.310796916f},
-std::array<float,2>{0.692271411f, 0.527308524f},
-std::array<float,2>{0.614715338f, 0.398810625f},
-std::array<float,2>{0.00304340478f, 0.716777265f},
-std::array<float,2>{0.27435562f, 0.0755038559f},
-std::array<float,2>{0.983993769f, 0.889151514f},
-std::array<float,2>{0.557644308f, 0.234110728f},
-std::array<float,2>{0.11546208f, 0.865055084f},
-std::array<float,2>{0.345545292f, 0.332396179f},
-std::array<float,2>{0.906903505f, 0.613005757f},
-std::array<float,2>{0.835768938f, 0.4796184f},
-std::array<float,2>{0.418970555f, 0.660707235f},
-std::array<float,2>{0.244143307f, 0.0165239293f},
-std::array<float,2>{0.647989571f, 0.960828602f},
-std::array<float,2>{0.964272797f, 0.121700183f},
-std::array<float,2>{0.29888615f, 0.931155622f},
-std::array<float,2>{0.0333937742f, 0.435001135f},
-std::array<float,2>{0.580476284f, 0.737257183f},
-std::array<float,2>{0.718969822f, 0.279663682f},
-std::array<float,2>{0.159303203f, 0.552590728f},
-std::array<float,2>{0.443624616f, 0.126582161f},
-std::array<float,2>{0.763553798f, 0.793661356f},
-std::array<float,2>{0.653953254f, 0.20573093f},
-std::array<float,2>{0.236624882f, 0.839455545f},
-std::array<float,2>{0.407504737f, 0.357150674f},
-std::array<float,2>{0.843249261f, 0.592663884f},
-std::array<float,2>{0.921322465f, 0.46032995f},
-std::array<float,2>{0.357347041f, 0.635728955f},
-std::array<float,2>{0.121821433f, 0.0519463718f},
-std::array<float,2>{0.554476559f, 0.976233602f},
-std::array<float,2>{0.756943047f, 0.0666294843f},
-std::array<float,2>{0.452689588f, 0.876865745f},
-std::array<float,2>{0.166785181f, 0.394741744f},
-std::array<float,2>{0.728675723f, 0.705100417f},
-std::array<float,2>{0.593028426f, 0.29748714f},
-std::array<float,2>{0.0455261506f, 0.52174437f},
-std::array<float,2>{0.310743392f, 0.169385985f},
-std::array<float,2>{0.953987479f, 0.763465881f},
-std::array<float,2>{0.525399208f, 0.0274128243f},
-std::array<float,2>{0.0838174522f, 0.963841379f},
-std::array<float,2>{0.314178109f, 0.469073564f},
-std::array<float,2>{0.896024108f, 0.669530094f},
-std::array<float,2>{0.868089259f, 0.34330368f},
-std::array<float,2>{0.387501717f, 0.624251187f},
-std::array<float,2>{0.19281444f, 0.224043623f},
-std::array<float,2>{0.686663926f, 0.867614746f},
-std::array<float,2>{0.973452449f, 0.13816312f},
-std::array<float,2>{0.272969633f, 0.785343826f},
-std::array<float,2>{0.0118823741f, 0.267539263f},
-std::array<float,2>{0.617739916f, 0.557879269f},
-std::array<float,2>{0.696404994f, 0.426737845f},
-std::array<float,2>{0.145854563f, 0.746041775f},
-std::array<float,2>{0.479655743f, 0.112863004f},
-std::array<float,2>{0.795418918f, 0.923243344f},
-std::array<float,2>{0.738805234f, 0.107824728f},
-std::array<float,2>{0.173426673f, 0.917719126f},
-std::array<float,2>{0.465523928f, 0.411428601f},
-std::array<float,2>{0.774397612f, 0.721897185f},
-std::array<float,2>{0.939123333f, 0.263043046f},
-std::array<float,2>{0.287761718f, 0.541342676f},
-std::array<float,2>{0.0610974282f, 0.140933499f},
-std::array<float,2>{0.564867198f, 0.799086332f},
-std::array<float,2>{0.814716041f, 0.237902284f},
-std::array<float,2>{0.436036915f, 0.85292846f},
-std::array<float,2>{0.222863868f, 0.312826723f},
-std::array<float,2>{0.626164317f, 0.595226467f},
-std::array<float,2>{0.532649755f, 0.48858133f},
-std::array<float,2>{0.0984510332f, 0.682358861f},
-std::array<float,2>{0.364855915f, 0.0123111792f},
-std::array<float,2>{0.936442375f, 0.950258553f},
-std::array<float,2>{0.601183295f, 0.172471642f},
-std::array<float,2>{0.0169691835f, 0.766043782f},
-std::array<float,2>{0.25532341f, 0.291115284f},
-std::array<float,2>{0.999509871f, 0.509790361f},
-std::array<float,2>{0.798471749f, 0.384995937f},
-std::array<float,2>{0.492167056f, 0.695424795f},
-std::array<float,2>{0.13838622f, 0.0847744495f},
-std::array<float,2>{0.706387699f, 0.898786485f},
-std::array<float,2>{0.88261199f, 0.0341871902f},
-std::array<float,2>{0.331133276f, 0.986717105f},
-std::array<float,2>{0.064022541f, 0.450104415f},
-std::array<float,2>{0.515137672f, 0.644780099f},
-std::array<float,2>{0.658115327f, 0.364068866f},
-std::array<float,2>{0.211216047f, 0.576247454f},
-std::array<float,2>{0.405840904f, 0.202337891f},
-std::array<float,2>{0.849996686f, 0.824568331f},
-std::array<float,2>{0.730867445f, 0.243746534f},
-std::array<float,2>{0.168762952f, 0.848860443f},
-std::array<float,2>{0.449034035f, 0.321535528f},
-std::array<float,2>{0.75167644f, 0.601588964f},
-std::array<float,2>{0.959276319f, 0.498630673f},
-std::array<float,2>{0.307210505f, 0.676790535f},
-std::array<float,2>{0.0409915186f, 0.00188257534f},
-std::array<float,2>{0.587569833f, 0.94422102f},
-std::array<float,2>{0.837792516f, 0.100053877f},
-std::array<float,2>{0.411833167f, 0.910330057f},
-std::array<float,2>{0.238727778f, 0.420124441f},
-std::array<float,2>{0.648620367f, 0.732993722f},
-std::array<float,2>{0.547067702f, 0.256875813f},
-std::array<float,2>{0.119959727f, 0.538685083f},
-std::array<float,2>{0.354709148f, 0.155731946f},
-std::array<float,2>{0.916386008f, 0.811532855f},
-std::array<float,2>{0.621462822f, 0.0432734601f},
-std::array<float,2>{0.00980091374f, 0.999095201f},
-std::array<float,2>{0.268817067f, 0.445034236f},
-std::array<float,2>{0.972596586f, 0.650017202f},
-std::array<float,2>{0.791832924f, 0.37147674f},
-std::array<float,2>{0.482426912f, 0.566219985f},
-std::array<float,2>{0.143816382f, 0.193891421f},
-std::array<float,2>{0.701087594f, 0.813647211f},
-std::array<float,2>{0.893355548f, 0.179729253f},
-std::array<float,2>{0.317142248f, 0.775443435f},
-std::array<float,2>{0.0811242014f, 0.283784032f},
-std::array<float,2>{0.530539334f, 0.504433215f},
-std::array<float,2>{0.681892812f, 0.380119234f},
-std::array<float,2>{0.190651998f, 0.689160943f},
-std::array<float,2>{0.385971248f, 0.0889200047f},
-std::array<float,2>{0.871600509f, 0.892206609f},
-std::array<float,2>{0.630772293f, 0.0731505826f},
-std::array<float,2>{0.219761387f, 0.883396327f},
-std::array<float,2>{0.430797458f, 0.403072685f},
-std::array<float,2>{0.816971242f, 0.71192354f},
-std::array<float,2>{0.931891203f, 0.307169259f},
-std::array<float,2>{0.361258894f, 0.530809999f},
-std::array<float,2>{0.0940507576f, 0.156314507f},
-std::array<float,2>{0.538830757f, 0.752368152f},
-std::array<float,2>{0.779911041f, 0.217872009f},
-std::array<float,2>{0.462640643f, 0.828943193f},
-std::array<float,2>{0.17779997f, 0.346619159f},
-std::array<float,2>{0.738262951f, 0.579824924f},
-std::array<float,2>{0.567566872f, 0.465313554f},
-std::array<float,2>{0.0548476502f, 0.632659733f},
-std::array<float,2>{0.283302009f, 0.0593566075f},
-std::array<float,2>{0.942565143f, 0.982559264f},
-std::array<float,2>{0.510572612f, 0.129586294f},
-std::array<float,2>{0.0694429129f, 0.789228797f},
-std::array<float,2>{0.334059983f, 0.275140882f},
-std::array<float,2>{0.877310634f, 0.547200084f},
-std::array<float,2>{0.84499526f, 0.433554024f},
-std::array<float,2>{0.398979366f, 0.738350332f},
-std::array<float,2>{0.216718227f, 0.119730234f},
-std::array<float,2>{0.660581648f, 0.935344219f},
-std::array<float,2>{0.99579072f, 0.0207562093f},
-std::array<float,2>{0.2516357f, 0.956341743f},
-std::array<float,2>{0.0213402584f, 0.484222382f},
-std::array<float,2>{0.595491588f, 0.65853554f},
-std::array<float,2>{0.710069776f, 0.330281198f},
-std::array<float,2>{0.133864686f, 0.615875244f},
-std::array<float,2>{0.486524224f, 0.228980571f},
-std::array<float,2>{0.801762521f, 0.86216861f},
-std::array<float,2>{0.664953589f, 0.165278837f},
-std::array<float,2>{0.20517917f, 0.760227263f},
-std::array<float,2>{0.394126564f, 0.303261399f},
-std::array<float,2>{0.855003178f, 0.517326474f},
-std::array<float,2>{0.884413302f, 0.391714275f},
-std::array<float,2>{0.337260932f, 0.709138274f},
-std::array<float,2>{0.0752571449f, 0.0654651076f},
-std::array<float,2>{0.502717197f, 0.880062699f},
-std::array<float,2>{0.810897529f, 0.0499949977f},
-std::array<float,2>{0.495401651f, 0.969007909f},
-std::array<float,2>{0.128537312f, 0.453180224f},
-std::array<float,2>{0.712593555f, 0.637435079f},
-std::array<float,2>{0.60259968f, 0.352746457f},
-std::array<float,2>{0.0261090435f, 0.586903155f},
-std::array<float,2>{0.262815237f, 0.209919631f},
-std::array<float,2>{0.984851241f, 0.84146595f},
-std::array<float,2>{0.545725822f, 0.1169632f},
-std::array<float,2>{0.107653685f, 0.928022861f},
-std::array<float,2>{0.369789749f, 0.424530327f},
-std::array<float,2>{0.923227251f, 0.749829769f},
-std::array<float,2>{0.827678084f, 0.270149082f},
-std::array<float,2>{0.424647212f, 0.5595451f},
-std::array<float,2>{0.23154828f, 0.134057567f},
-std::array<float,2>{0.634813488f, 0.78251344f},
-std::array<float,2>{0.948811412f, 0.220893756f},
-std::array<float,2>{0.289442033f, 0.874426782f},
-std::array<float,2>{0.049603235f, 0.337422341f},
-std::array<float,2>{0.571508944f, 0.617264867f},
-std::array<float,2>{0.749061465f, 0.475855917f},
-std::array<float,2>{0.181362122f, 0.667520523f},
-std::array<float,2>{0.459448606f, 0.0266256649f},
-std::array<float,2>{0.771348f, 0.96536088f},
-std::array<float,2>{0.688630521f, 0.0101965498f},
-std::array<float,2>{0.153668478f, 0.947280884f},
-std::array<float,2>{0.472204149f, 0.487464368f},
-std::array<float,2>{0.785781562f, 0.685081363f},
-std::array<float,2>{0.980174243f, 0.318493098f},
-std::array<float,2>{0.27965641f, 0.599605799f},
-std::array<float,2>{0.00431733625f, 0.241951197f},
-std::array<float,2>{0.609390736f, 0.857258141f},
-std::array<float,2>{0.86182636f, 0.146534845f},
-std::array<float,2>{0.378600001f, 0.804438472f},
-std::array<float,2>{0.201701656f, 0.260097235f},
-std::array<float,2>{0.675359011f, 0.545931756f},
-std::array<float,2>{0.515762031f, 0.409282357f},
-std::array<float,2>{0.0880661607f, 0.722711265f},
-std::array<float,2>{0.32410863f, 0.10177055f},
-std::array<float,2>{0.905951738f, 0.92091006f},
-std::array<float,2>{0.584887207f, 0.195815668f},
-std::array<float,2>{0.0369492248f, 0.820446253f},
-std::array<float,2>{0.303440124f, 0.360338956f},
-std::array<float,2>{0.967318654f, 0.571020961f},
-std::array<float,2>{0.7579301f, 0.446794271f},
-std::array<float,2>{0.441200823f, 0.641955733f},
-std::array<float,2>{0.163270384f, 0.0365224332f},
-std::array<float,2>{0.724434674f, 0.98932755f},
-std::array<float,2>{0.913650155f, 0.0816575065f},
-std::array<float,2>{0.349966735f, 0.906206548f},
-std::array<float,2>{0.110888727f, 0.388980389f},
-std::array<float,2>{0.559593141f, 0.699781954f},
-std::array<float,2>{0.641926765f, 0.293651193f},
-std::array<float,2>{0.24787648f, 0.514090717f},
-std::array<float,2>{0.417379439f, 0.176401377f},
-std::array<float,2>{0.828468502f, 0.771492958f},
-std::array<float,2>{0.743960857f, 0.187097371f},
-std::array<float,2>{0.185423195f, 0.77908498f},
-std::array<float,2>{0.455898464f, 0.287529022f},
-std::array<float,2>{0.767056644f, 0.503897369f},
-std::array<float,2>{0.952881098f, 0.378700703f},
-std::array<float,2>{0.293287694f, 0.695152998f},
-std::array<float,2>{0.0537653193f, 0.0919780955f},
-std::array<float,2>{0.578092098f, 0.895426154f},
-std::array<float,2>{0.821997464f, 0.0417427272f},
-std::array<float,2>{0.426553488f, 0.992775977f},
-std::array<float,2>{0.22743611f, 0.440304995f},
-std::array<float,2>{0.638670504f, 0.655896425f},
-std::array<float,2>{0.53913033f, 0.36776191f},
-std::array<float,2>{0.10195829f, 0.567577481f},
-std::array<float,2>{0.373654395f, 0.189446539f},
-std::array<float,2>{0.926487565f, 0.817584217f},
-std::array<float,2>{0.608227491f, 0.0943548083f},
-std::array<float,2>{0.0303729828f, 0.90682596f},
-std::array<float,2>{0.259614676f, 0.415432543f},
-std::array<float,2>{0.991535962f, 0.73013413f},
-std::array<float,2>{0.805260479f, 0.253208578f},
-std::array<float,2>{0.497769266f, 0.533000827f},
-std::array<float,2>{0.130221397f, 0.151933655f},
-std::array<float,2>{0.717509806f, 0.805401802f},
-std::array<float,2>{0.887500048f, 0.246417746f},
-std::array<float,2>{0.343289375f, 0.843913376f},
-std::array<float,2>{0.0715879723f, 0.326334715f},
-std::array<float,2>{0.505392432f, 0.606817067f},
-std::array<float,2>{0.66938597f, 0.494578689f},
-std::array<float,2>{0.207696125f, 0.672358453f},
-std::array<float,2>{0.395901978f, 0.00470616808f},
-std::array<float,2>{0.85708338f, 0.939401925f},
-std::array<float,2>{0.644680262f, 0.018551277f},
-std::array<float,2>{0.242470548f, 0.957633495f},
-std::array<float,2>{0.421630383f, 0.478053868f},
-std::array<float,2>{0.833257139f, 0.664000511f},
-std::array<float,2>{0.908250093f, 0.335602641f},
-std::array<float,2>{0.346199065f, 0.610843182f},
-std::array<float,2>{0.114891633f, 0.231244162f},
-std::array<float,2>{0.555633664f, 0.865834355f},
-std::array<float,2>{0.764699996f, 0.128698051f},
-std::array<float,2>{0.441429883f, 0.796265543f},
-std::array<float,2>{0.156400219f, 0.27764082f},
-std::array<float,2>{0.722199023f, 0.554401457f},
-std::array<float,2>{0.578195751f, 0.436757088f},
-std::array<float,2>{0.0322849266f, 0.735327244f},
-std::array<float,2>{0.298124075f, 0.123237289f},
-std::array<float,2>{0.961935341f, 0.933312714f},
-std::array<float,2>{0.522320509f, 0.211730778f},
-std::array<float,2>{0.0907684863f, 0.833013356f},
-std::array<float,2>{0.325489432f, 0.350617975f},
-std::array<float,2>{0.900228024f, 0.585381925f},
-std::array<float,2>{0.866082847f, 0.462246895f},
-std::array<float,2>{0.382397383f, 0.627566397f},
-std::array<float,2>{0.197034582f, 0.0551981628f},
-std::array<float,2>{0.676999032f, 0.979293168f},
-std::array<float,2>{0.980712831f, 0.0771047026f},
-std::array<float,2>{0.275868416f, 0.888393998f},
-std::array<float,2>{0.000850582321f, 0.401771992f},
-std::array<float,2>{0.615776837f, 0.718702734f},
-std::array<float,2>{0.694905519f, 0.308596224f},
-std::array<float,2>{0.150157809f, 0.523527741f},
-std::array<float,2>{0.473124295f, 0.16313751f},
-std::array<float,2>{0.78278029f, 0.756622672f},
-std::array<float,2>{0.68403089f, 0.226561695f},
-std::array<float,2>{0.193726927f, 0.869978309f},
-std::array<float,2>{0.388909161f, 0.340148091f},
-std::array<float,2>{0.869358361f, 0.622863173f},
-std::array<float,2>{0.896843731f, 0.472234964f},
-std::array<float,2>{0.314666569f, 0.670347512f},
-std::array<float,2>{0.0851850957f, 0.0300286133f},
-std::array<float,2>{0.524127007f, 0.962271631f},
-std::array<float,2>{0.793672383f, 0.110689439f},
-std::array<float,2>{0.476624131f, 0.924175143f},
-std::array<float,2>{0.147056133f, 0.429647297f},
-std::array<float,2>{0.698140562f, 0.743382812f},
-std::array<float,2>{0.619508266f, 0.268111944f},
-std::array<float,2>{0.014479002f, 0.55566442f},
-std::array<float,2>{0.270056516f, 0.139843881f},
-std::array<float,2>{0.975100219f, 0.788189411f},
-std::array<float,2>{0.55196929f, 0.0546069928f},
-std::array<float,2>{0.12377274f, 0.973509371f},
-std::array<float,2>{0.357696116f, 0.458509982f},
-std::array<float,2>{0.91870904f, 0.632934988f},
-std::array<float,2>{0.840998113f, 0.358117968f},
-std::array<float,2>{0.41000554f, 0.590295553f},
-std::array<float,2>{0.235733584f, 0.203754872f},
-std::array<float,2>{0.655616879f, 0.837760568f},
-std::array<float,2>{0.956308544f, 0.171416566f},
-std::array<float,2>{0.309051633f, 0.764157176f},
-std::array<float,2>{0.0445565619f, 0.299402595f},
-std::array<float,2>{0.591038346f, 0.52009207f},
-std::array<float,2>{0.72726804f, 0.397099197f},
-std::array<float,2>{0.164101958f, 0.704510391f},
-std::array<float,2>{0.449696332f, 0.0693967789f},
-std::array<float,2>{0.755612314f, 0.877829373f},
-std::array<float,2>{0.703606546f, 0.0825436786f},
-std::array<float,2>{0.139141142f, 0.900572896f},
-std::array<float,2>{0.48832202f, 0.384383023f},
-std::array<float,2>{0.799087405f, 0.698485553f},
-std::array<float,2>{0.997708201f, 0.289925605f},
-std::array<float,2>{0.256652147f, 0.509693265f},
-std::array<float,2>{0.0177645534f, 0.174078345f},
-std::array<float,2>{0.598590612f, 0.768935561f},
-std::array<float,2>{0.84895283f, 0.199577466f},
-std::array<float,2>{0.40323016f, 0.827399731f},
-std::array<float,2>{0.2135524f, 0.365688235f},
-std::array<float,2>{0.659770787f, 0.57458055f},
-std::array<float,2>{0.512288988f, 0.452524602f},
-std::array<float,2>{0.0647408515f, 0.646853387f},
-std::array<float,2>{0.32857278f, 0.0331905261f},
-std::array<float,2>{0.879569232f, 0.986067712f},
-std::array<float,2>{0.564070821f, 0.142707378f},
-std::array<float,2>{0.059182059f, 0.798282027f},
-std::array<float,2>{0.287023783f, 0.26554358f},
-std::array<float,2>{0.940287292f, 0.539655566f},
-std::array<float,2>{0.77692765f, 0.412871361f},
-std::array<float,2>{0.467908382f, 0.719473243f},
-std::array<float,2>{0.175051987f, 0.105976671f},
-std::array<float,2>{0.740852058f, 0.914065897f},
-std::array<float,2>{0.934155226f, 0.0149847344f},
-std::array<float,2>{0.366040021f, 0.951526999f},
-std::array<float,2>{0.0998136029f, 0.491072059f},
-std::array<float,2>{0.53430593f, 0.681328475f},
-std::array<float,2>{0.628075659f, 0.316180497f},
-std::array<float,2>{0.224930033f, 0.597334802f},
-std::array<float,2>{0.434996158f, 0.234494701f},
-std::array<float,2>{0.81387341f, 0.853901446f},
-std::array<float,2>{0.702401698f, 0.192907825f},
-std::array<float,2>{0.142170563f, 0.814496756f},
-std::array<float,2>{0.480670959f, 0.373310328f},
-std::array<float,2>{0.789992571f, 0.56366533f},
-std::array<float,2>{0.96946007f, 0.442591757f},
-std::array<float,2>{0.266014934f, 0.651897252f},
-std::array<float,2>{0.00866054837f, 0.0465363003f},
-std::array<float,2>{0.623968899f, 0.997514188f},
-std::array<float,2>{0.873071253f, 0.0872364715f},
-std::array<float,2>{0.382841587f, 0.894344807f},
-std::array<float,2>{0.189377531f, 0.380971521f},
-std::array<float,2>{0.680111945f, 0.689889967f},
-std::array<float,2>{0.527809799f, 0.282275766f},
-std::array<float,2>{0.0784258619f, 0.506160617f},
-std::array<float,2>{0.319835782f, 0.182967409f},
-std::array<float,2>{0.892547369f, 0.774665952f},
-std::array<float,2>{0.588921845f, 0.00197858014f},
-std::array<float,2>{0.0420457423f, 0.942759573f},
-std::array<float,2>{0.306629568f, 0.496566802f},
-std::array<float,2>{0.957072258f, 0.679393411f},
-std::array<float,2>{0.752676368f, 0.322619349f},
-std::array<float,2>{0.446767211f, 0.603756368f},
-std::array<float,2>{0.17024152f, 0.244177327f},
-std::array<float,2>{0.733374476f, 0.850480378f},
-std::array<float,2>{0.914482355f, 0.154192582f},
-std::array<float,2>{0.353195518f, 0.808676183f},
-std::array<float,2>{0.118382104f, 0.255453199f},
-std::array<float,2>{0.549797595f, 0.536844909f},
-std::array<float,2>{0.650764406f, 0.419117361f},
-std::array<float,2>{0.24192898f, 0.731343329f},
-std::array<float,2>{0.412733257f, 0.0984368771f},
-std::array<float,2>{0.838495255f, 0.91263777f},
-std::array<float,2>{0.662385702f, 0.118882202f},
-std::array<float,2>{0.217876673f, 0.936118126f},
-std::array<float,2>{0.400462329f, 0.431423575f},
-std::array<float,2>{0.845959902f, 0.741443694f},
-std::array<float,2>{0.8760975f, 0.277285278f},
-std::array<float,2>{0.332853377f, 0.549058557f},
-std::array<float,2>{0.0674218088f, 0.13122043f},
-std::array<float,2>{0.50810045f, 0.792681098f},
-std::array<float,2>{0.802963555f, 0.227215409f},
-std::array<float,2>{0.484429777f, 0.860740423f},
-std::array<float,2>{0.135535255f, 0.329552531f},
-std::array<float,2>{0.707935274f, 0.6142084f},
-std::array<float,2>{0.595865786f, 0.481942594f},
-std::array<float,2>{0.0217649676f, 0.656692505f},
-std::array<float,2>{0.253684849f, 0.0216140393f},
-std::array<float,2>{0.992326438f, 0.95355767f},
-std::array<float,2>{0.535826743f, 0.158670336f},
-std::array<float,2>{0.0964485183f, 0.751570106f},
-std::array<float,2>{0.361410916f, 0.305601209f},
-std::array<float,2>{0.930803478f, 0.527731001f},
-std::array<float,2>{0.818452775f, 0.404555947f},
-std::array<float,2>{0.431665242f, 0.713397086f},
-std::array<float,2>{0.22163564f, 0.0716861039f},
-std::array<float,2>{0.632114887f, 0.886009574f},
-std::array<float,2>{0.943581045f, 0.0611969382f},
-std::array<float,2>{0.282661438f, 0.981652737f},
-std::array<float,2>{0.0571067743f, 0.467797816f},
-std::array<float,2>{0.569893301f, 0.630473614f},
-std::array<float,2>{0.7345137f, 0.344956815f},
-std::array<float,2>{0.177560255f, 0.580915153f},
-std::array<float,2>{0.463151366f, 0.215972245f},
-std::array<float,2>{0.777562678f, 0.831229746f},
-std::array<float,2>{0.634094834f, 0.13597852f},
-std::array<float,2>{0.23429513f, 0.785078585f},
-std::array<float,2>{0.423466623f, 0.273106933f},
-std::array<float,2>{0.825816453f, 0.561405301f},
-std::array<float,2>{0.924693584f, 0.423127979f},
-std::array<float,2>{0.367545366f, 0.747107029f},
-std::array<float,2>{0.107016109f, 0.115039229f},
-std::array<float,2>{0.544057846f, 0.926217914f},
-std::array<float,2>{0.771486938f, 0.0240901206f},
-std::array<float,2>{0.458968043f, 0.967592597f},
-std::array<float,2>{0.182131529f, 0.473717839f},
-std::array<float,2>{0.746684492f, 0.664710939f},
-std::array<float,2>{0.572314203f, 0.338036448f},
-std::array<float,2>{0.0477242768f, 0.620305359f},
-std::array<float,2>{0.291569591f, 0.22018072f},
-std::array<float,2>{0.945986927f, 0.872802019f},
-std::array<float,2>{0.500401676f, 0.0635255501f},
-std::array<float,2>{0.0764768124f, 0.881231606f},
-std::array<float,2>{0.338037729f, 0.394218177f},
-std::array<float,2>{0.885768652f, 0.708212018f},
-std::array<float,2>{0.852878749f, 0.302201331f},
-std::array<float,2>{0.391100705f, 0.518420577f},
-std::array<float,2>{0.203515828f, 0.166099548f},
-std::array<float,2>{0.666401684f, 0.758437991f},
-std::array<float,2>{0.987196505f, 0.208789796f},
-std::array<float,2>{0.264628917f, 0.842128992f},
-std::array<float,2>{0.0245012138f, 0.355205894f},
-std::array<float,2>{0.604410648f, 0.588682532f},
-std::array<float,2>{0.713130295f, 0.456235647f},
-std::array<float,2>{0.12533167f, 0.63977915f},
-std::array<float,2>{0.49323073f, 0.0471139662f},
-std::array<float,2>{0.810136914f, 0.971439302f},
-std::array<float,2>{0.725909293f, 0.0389281213f},
-std::array<float,2>{0.161682829f, 0.991523683f},
-std::array<float,2>{0.438137412f, 0.448172837f},
-std::array<float,2>{0.759836435f, 0.644168615f},
-std::array<float,2>{0.966090679f, 0.362111241f},
-std::array<float,2>{0.301950961f, 0.573861241f},
-std::array<float,2>{0.0380859114f, 0.197592571f},
-std::array<float,2>{0.582374215f, 0.823234677f},
-std::array<float,2>{0.831112504f, 0.178505495f},
-std::array<float,2>{0.414787114f, 0.769781768f},
-std::array<float,2>{0.248954564f, 0.296379983f},
-std::array<float,2>{0.644068003f, 0.511996686f},
-std::array<float,2>{0.561620712f, 0.387882143f},
-std::array<float,2>{0.112025768f, 0.702842891f},
-std::array<float,2>{0.348418742f, 0.0783553645f},
-std::array<float,2>{0.911303401f, 0.902529299f},
-std::array<float,2>{0.612015128f, 0.239042491f},
-std::array<float,2>{0.0071870652f, 0.858909726f},
-std::array<float,2>{0.27789712f, 0.317727298f},
-std::array<float,2>{0.978335559f, 0.601027906f},
-std::array<float,2>{0.788067877f, 0.48630923f},
-std::array<float,2>{0.46917814f, 0.687165141f},
-std::array<float,2>{0.156206906f, 0.00907744374f},
-std::array<float,2>{0.690417886f, 0.94711262f},
-std::array<float,2>{0.903085172f, 0.105040461f},
-std::array<float,2>{0.321042269f, 0.918143213f},
-std::array<float,2>{0.0871442184f, 0.407103032f},
-std::array<float,2>{0.518743336f, 0.725755215f},
-std::array<float,2>{0.673442006f, 0.258789778f},
-std::array<float,2>{0.199700236f, 0.544832349f},
-std::array<float,2>{0.376444846f, 0.146115676f},
-std::array<float,2>{0.859777629f, 0.801001906f},
-std::array<float,2>{0.692873895f, 0.162936017f},
-std::array<float,2>{0.15215537f, 0.757755578f},
-std::array<float,2>{0.474656224f, 0.310270458f},
-std::array<float,2>{0.783939183f, 0.524964392f},
-std::array<float,2>{0.983057559f, 0.400446355f},
-std::array<float,2>{0.275048077f, 0.717552066f},
-std::array<float,2>{0.002639835f, 0.0771995783f},
-std::array<float,2>{0.614246964f, 0.887370765f},
-std::array<float,2>{0.863925993f, 0.0565123372f},
-std::array<float,2>{0.37928623f, 0.980458677f},
-std::array<float,2>{0.197672501f, 0.460973322f},
-std::array<float,2>{0.677926004f, 0.628230572f},
-std::array<float,2>{0.521392465f, 0.349787652f},
-std::array<float,2>{0.092329368f, 0.58430624f},
-std::array<float,2>{0.328005493f, 0.211994916f},
-std::array<float,2>{0.90192306f, 0.832746208f},
-std::array<float,2>{0.581832886f, 0.124533072f},
-std::array<float,2>{0.0346627831f, 0.931860745f},
-std::array<float,2>{0.300460994f, 0.435565084f},
-std::array<float,2>{0.962955177f, 0.736100197f},
-std::array<float,2>{0.761981726f, 0.27856496f},
-std::array<float,2>{0.44485566f, 0.553142011f},
-std::array<float,2>{0.158524126f, 0.127719134f},
-std::array<float,2>{0.720231712f, 0.795517862f},
-std::array<float,2>{0.908036649f, 0.231676921f},
-std::array<float,2>{0.344174117f, 0.866478086f},
-std::array<float,2>{0.116473146f, 0.334792852f},
-std::array<float,2>{0.556912303f, 0.609964371f},
-std::array<float,2>{0.647146404f, 0.476739228f},
-std::array<float,2>{0.245509654f, 0.662493706f},
-std::array<float,2>{0.418044746f, 0.0195104238f},
-std::array<float,2>{0.83451879f, 0.9583112f},
-std::array<float,2>{0.67062813f, 0.00492610736f},
-std::array<float,2>{0.209961072f, 0.938375115f},
-std::array<float,2>{0.397711247f, 0.495205432f},
-std::array<float,2>{0.859188259f, 0.673392117f},
-std::array<float,2>{0.888803124f, 0.327756524f},
-std::array<float,2>{0.341365427f, 0.606303453f},
-std::array<float,2>{0.0734116212f, 0.247297868f},
-std::array<float,2>{0.507693827f, 0.845147908f},
-std::array<float,2>{0.806946874f, 0.150597394f},
-std::array<float,2>{0.499320209f, 0.806444466f},
-std::array<float,2>{0.132793665f, 0.252585679f},
-std::array<float,2>{0.715360641f, 0.53160882f},
-std::array<float,2>{0.605855048f, 0.414915442f},
-std::array<float,2>{0.027692819f, 0.728666008f},
-std::array<float,2>{0.260442138f, 0.0949233845f},
-std::array<float,2>{0.98833251f, 0.907868445f},
-std::array<float,2>{0.542430818f, 0.187625468f},
-std::array<float,2>{0.103802122f, 0.817375243f},
-std::array<float,2>{0.371496081f, 0.368981957f},
-std::array<float,2>{0.928858936f, 0.566906929f},
-std::array<float,2>{0.822420001f, 0.441350371f},
-std::array<float,2>{0.428584725f, 0.655044198f},
-std::array<float,2>{0.229810908f, 0.042179063f},
-std::array<float,2>{0.639813185f, 0.993672848f},
-std::array<float,2>{0.949667513f, 0.0935051069f},
-std::array<float,2>{0.295856088f, 0.896166027f},
-std::array<float,2>{0.0508690588f, 0.377305061f},
-std::array<float,2>{0.574810445f, 0.69350636f},
-std::array<float,2>{0.745339096f, 0.28847459f},
-std::array<float,2>{0.187361553f, 0.502709985f},
-std::array<float,2>{0.453943044f, 0.186346516f},
-std::array<float,2>{0.767912507f, 0.777562618f},
-std::array<float,2>{0.62591809f, 0.236232802f},
-std::array<float,2>{0.224359289f, 0.855058849f},
-std::array<float,2>{0.43660596f, 0.31490019f},
-std::array<float,2>{0.815968215f, 0.595717371f},
-std::array<float,2>{0.93749392f, 0.492048204f},
-std::array<float,2>{0.364015102f, 0.680496871f},
-std::array<float,2>{0.0991126522f, 0.0138870077f},
-std::array<float,2>{0.531965911f, 0.953086257f},
-std::array<float,2>{0.775058329f, 0.106901221f},
-std::array<float,2>{0.46646896f, 0.915151894f},
-std::array<float,2>{0.17236425f, 0.413309783f},
-std::array<float,2>{0.739380896f, 0.7198174f},
-std::array<float,2>{0.565436244f, 0.263728082f},
-std::array<float,2>{0.0623887442f, 0.540514648f},
-std::array<float,2>{0.288437575f, 0.144043058f},
-std::array<float,2>{0.937592685f, 0.797066152f},
-std::array<float,2>{0.514350832f, 0.0320060626f},
-std::array<float,2>{0.0625172853f, 0.984987497f},
-std::array<float,2>{0.331008881f, 0.451426208f},
-std::array<float,2>{0.881710112f, 0.647502959f},
-std::array<float,2>{0.850723147f, 0.367132634f},
-std::array<float,2>{0.404705644f, 0.575265467f},
-std::array<float,2>{0.212754622f, 0.200873062f},
-std::array<float,2>{0.656980872f, 0.826454878f},
-std::array<float,2>{0.998151064f, 0.174864933f},
-std::array<float,2>{0.254504681f, 0.76825279f},
-std::array<float,2>{0.0158604886f, 0.290315509f},
-std::array<float,2>{0.600431681f, 0.508481205f},
-std::array<float,2>{0.706020176f, 0.383232772f},
-std::array<float,2>{0.137624636f, 0.697927356f},
-std::array<float,2>{0.491134614f, 0.0837060809f},
-std::array<float,2>{0.797103167f, 0.901580215f},
-std::array<float,2>{0.729829311f, 0.0689464062f},
-std::array<float,2>{0.166993856f, 0.878455281f},
-std::array<float,2>{0.45139122f, 0.397924423f},
-std::array<float,2>{0.755991757f, 0.703983486f},
-std::array<float,2>{0.954764724f, 0.299999595f},
-std::array<float,2>{0.311567158f, 0.52060169f},
-std::array<float,2>{0.0466390997f, 0.170205116f},
-std::array<float,2>{0.592753828f, 0.76523298f},
-std::array<float,2>{0.842594266f, 0.20484747f},
-std::array<float,2>{0.407182097f, 0.83607012f},
-std::array<float,2>{0.237907737f, 0.35928154f},
-std::array<float,2>{0.652399778f, 0.590974629f},
-std::array<float,2>{0.55311501f, 0.457732052f},
-std::array<float,2>{0.122111425f, 0.634407163f},
-std::array<float,2>{0.355829269f, 0.0537062064f},
-std::array<float,2>{0.920395792f, 0.973656952f},
-std::array<float,2>{0.618473053f, 0.139429599f},
-std::array<float,2>{0.0133345323f, 0.787391424f},
-std::array<float,2>{0.271570742f, 0.269350767f},
-std::array<float,2>{0.974482596f, 0.554687798f},
-std::array<float,2>{0.79649353f, 0.427942246f},
-std::array<float,2>{0.479287833f, 0.743059814f},
-std::array<float,2>{0.145321801f, 0.109570004f},
-std::array<float,2>{0.695626616f, 0.925458491f},
-std::array<float,2>{0.894917905f, 0.0312483963f},
-std::array<float,2>{0.312752694f, 0.961351335f},
-std::array<float,2>{0.0827073902f, 0.4708336f},
-std::array<float,2>{0.527038336f, 0.671399057f},
-std::array<float,2>{0.685994327f, 0.341089308f},
-std::array<float,2>{0.19156f, 0.621340334f},
-std::array<float,2>{0.388112187f, 0.224709749f},
-std::array<float,2>{0.869093299f, 0.870301962f},
-std::array<float,2>{0.736647189f, 0.21495083f},
-std::array<float,2>{0.17893897f, 0.830636799f},
-std::array<float,2>{0.46146962f, 0.344630212f},
-std::array<float,2>{0.780754566f, 0.581672013f},
-std::array<float,2>{0.942147672f, 0.466954976f},
-std::array<float,2>{0.285006583f, 0.629746139f},
-std::array<float,2>{0.0558068156f, 0.0618924685f},
-std::array<float,2>{0.567067564f, 0.981398404f},
-std::array<float,2>{0.817683101f, 0.0705707371f},
-std::array<float,2>{0.429905117f, 0.885219514f},
-std::array<float,2>{0.219321966f, 0.405279309f},
-std::array<float,2>{0.629199922f, 0.714014351f},
-std::array<float,2>{0.537500501f, 0.306489944f},
-std::array<float,2>{0.0948783681f, 0.528991997f},
-std::array<float,2>{0.360300541f, 0.159479097f},
-std::array<float,2>{0.933284998f, 0.750068069f},
-std::array<float,2>{0.593937397f, 0.0229610857f},
-std::array<float,2>{0.0196106452f, 0.954464197f},
-std::array<float,2>{0.250503004f, 0.480696768f},
-std::array<float,2>{0.994681418f, 0.657754898f},
-std::array<float,2>{0.801011205f, 0.328721792f},
-std::array<float,2>{0.48826924f, 0.615169466f},
-std::array<float,2>{0.13283658f, 0.227683067f},
-std::array<float,2>{0.709600508f, 0.85969317f},
-std::array<float,2>{0.878859341f, 0.132589743f},
-std::array<float,2>{0.335599899f, 0.791168869f},
-std::array<float,2>{0.0693076774f, 0.275541544f},
-std::array<float,2>{0.511314511f, 0.55000627f},
-std::array<float,2>{0.661298573f, 0.429791868f},
-std::array<float,2>{0.215556026f, 0.740470469f},
-std::array<float,2>{0.3997913f, 0.117800802f},
-std::array<float,2>{0.844560444f, 0.936874926f},
-std::array<float,2>{0.650218666f, 0.0989755839f},
-std::array<float,2>{0.239683867f, 0.91350466f},
-std::array<float,2>{0.410814047f, 0.418406308f},
-std::array<float,2>{0.836403966f, 0.731659412f},
-std::array<float,2>{0.917690396f, 0.254663855f},
-std::array<float,2>{0.354166269f, 0.535328925f},
-std::array<float,2>{0.120642953f, 0.152599648f},
-std::array<float,2>{0.54809171f, 0.809903145f},
-std::array<float,2>{0.750776649f, 0.245512456f},
-std::array<float,2>{0.447508097f, 0.850716829f},
-std::array<float,2>{0.169786125f, 0.323249012f},
-std::array<float,2>{0.731517076f, 0.605300963f},
-std::array<float,2>{0.586561501f, 0.497351855f},
-std::array<float,2>{0.0399499014f, 0.678230047f},
-std::array<float,2>{0.308490157f, 0.00342149264f},
-std::array<float,2>{0.960009336f, 0.942249119f},
-std::array<float,2>{0.529760718f, 0.182051614f},
-std::array<float,2>{0.080272153f, 0.773452282f},
-std::array<float,2>{0.317446858f, 0.281415701f},
-std::array<float,2>{0.894224107f, 0.507434368f},
-std::array<float,2>{0.872166395f, 0.382252872f},
-std::array<float,2>{0.385146797f, 0.690467477f},
-std::array<float,2>{0.189599752f, 0.0866855532f},
-std::array<float,2>{0.682883561f, 0.892788231f},
-std::array<float,2>{0.971609175f, 0.0458664857f},
-std::array<float,2>{0.268214345f, 0.99617976f},
-std::array<float,2>{0.0112328306f, 0.442029774f},
-std::array<float,2>{0.622149527f, 0.650443017f},
-std::array<float,2>{0.699932456f, 0.374730527f},
-std::array<float,2>{0.142596617f, 0.563181639f},
-std::array<float,2>{0.483504713f, 0.191597894f},
-std::array<float,2>{0.792642772f, 0.816303611f},
-std::array<float,2>{0.674758017f, 0.145504445f},
-std::array<float,2>{0.202607602f, 0.802455842f},
-std::array<float,2>{0.377043486f, 0.258420676f},
-std::array<float,2>{0.862652063f, 0.543843091f},
-std::array<float,2>{0.904553413f, 0.407809824f},
-std::array<float,2>{0.3226192f, 0.725425363f},
-std::array<float,2>{0.0897349715f, 0.104150519f},
-std::array<float,2>{0.517172813f, 0.91904068f},
-std::array<float,2>{0.787107229f, 0.00856699701f},
-std::array<float,2>{0.47085169f, 0.945950389f},
-std::array<float,2>{0.153046623f, 0.485264987f},
-std::array<float,2>{0.687851429f, 0.685636997f},
-std::array<float,2>{0.610388756f, 0.31715852f},
-std::array<float,2>{0.00576591678f, 0.60009253f},
-std::array<float,2>{0.28116253f, 0.239559859f},
-std::array<float,2>{0.978628099f, 0.857507706f},
-std::array<float,2>{0.559507072f, 0.0796479285f},
-std::array<float,2>{0.109726258f, 0.903838634f},
-std::array<float,2>{0.351253361f, 0.386995167f},
-std::array<float,2>{0.912780762f, 0.701198697f},
-std::array<float,2>{0.830046237f, 0.295817018f},
-std::array<float,2>{0.416114688f, 0.512953222f},
-std::array<float,2>{0.246462211f, 0.179497913f},
-std::array<float,2>{0.641411602f, 0.771290362f},
-std::array<float,2>{0.968438506f, 0.198989823f},
-std::array<float,2>{0.304442793f, 0.823833287f},
-std::array<float,2>{0.0360416472f, 0.36301136f},
-std::array<float,2>{0.585337222f, 0.572682083f},
-std::array<float,2>{0.723590136f, 0.449088871f},
-std::array<float,2>{0.162609771f, 0.643123686f},
-std::array<float,2>{0.43994534f, 0.0375031047f},
-std::array<float,2>{0.759704113f, 0.991061687f},
-std::array<float,2>{0.711589634f, 0.0480136573f},
-std::array<float,2>{0.127307013f, 0.971846759f},
-std::array<float,2>{0.495056957f, 0.455157638f},
-std::array<float,2>{0.811714649f, 0.639390171f},
-std::array<float,2>{0.985943913f, 0.354008317f},
-std::array<float,2>{0.26256454f, 0.589483678f},
-std::array<float,2>{0.0270230491f, 0.207867205f},
-std::array<float,2>{0.60220319f, 0.843244433f},
-std::array<float,2>{0.85401386f, 0.167866051f},
-std::array<float,2>{0.393425316f, 0.759517312f},
-std::array<float,2>{0.206780046f, 0.301742405f},
-std::array<float,2>{0.66526264f, 0.51872015f},
-std::array<float,2>{0.503065288f, 0.392899454f},
-std::array<float,2>{0.0750165731f, 0.70765692f},
-std::array<float,2>{0.336706817f, 0.0628020391f},
-std::array<float,2>{0.882935345f, 0.882242262f},
-std::array<float,2>{0.570609152f, 0.219332218f},
-std::array<float,2>{0.0507320054f, 0.871281087f},
-std::array<float,2>{0.290394068f, 0.339625061f},
-std::array<float,2>{0.948031127f, 0.619323909f},
-std::array<float,2>{0.770309389f, 0.473475546f},
-std::array<float,2>{0.4607701f, 0.665892541f},
-std::array<float,2>{0.180201083f, 0.0250226557f},
-std::array<float,2>{0.748379827f, 0.968464136f},
-std::array<float,2>{0.922712088f, 0.113454603f},
-std::array<float,2>{0.37057206f, 0.926986039f},
-std::array<float,2>{0.108619966f, 0.422744125f},
-std::array<float,2>{0.546102881f, 0.746172488f},
-std::array<float,2>{0.636216462f, 0.272052914f},
-std::array<float,2>{0.231210887f, 0.562317729f},
-std::array<float,2>{0.425093383f, 0.134863183f},
-std::array<float,2>{0.826697826f, 0.7838943f},
-std::array<float,2>{0.721173048f, 0.125142425f},
-std::array<float,2>{0.157890618f, 0.794303656f},
-std::array<float,2>{0.442491561f, 0.280741483f},
-std::array<float,2>{0.764419615f, 0.550974846f},
-std::array<float,2>{0.961782694f, 0.433638096f},
-std::array<float,2>{0.297067225f, 0.737731695f},
-std::array<float,2>{0.0318943784f, 0.122841321f},
-std::array<float,2>{0.579845011f, 0.929886639f},
-std::array<float,2>{0.832355142f, 0.0174195953f},
-std::array<float,2>{0.420739472f, 0.959306538f},
-std::array<float,2>{0.24346219f, 0.479461938f},
-std::array<float,2>{0.645520329f, 0.661916494f},
-std::array<float,2>{0.55593133f, 0.333393574f},
-std::array<float,2>{0.114064328f, 0.612250328f},
-std::array<float,2>{0.347162515f, 0.232726276f},
-std::array<float,2>{0.909282506f, 0.863700211f},
-std::array<float,2>{0.616871119f, 0.0747082904f},
-std::array<float,2>{0.00148756441f, 0.890577853f},
-std::array<float,2>{0.277008891f, 0.399754554f},
-std::array<float,2>{0.981570482f, 0.714897573f},
-std::array<float,2>{0.781817555f, 0.312478304f},
-std::array<float,2>{0.473708838f, 0.52563262f},
-std::array<float,2>{0.148457587f, 0.16179435f},
-std::array<float,2>{0.693681777f, 0.754198015f},
-std::array<float,2>{0.899103522f, 0.214782998f},
-std::array<float,2>{0.324229717f, 0.83526361f},
-std::array<float,2>{0.0916312262f, 0.348635197f},
-std::array<float,2>{0.523238719f, 0.582032204f},
-std::array<float,2>{0.676358342f, 0.46476528f},
-std::array<float,2>{0.195662543f, 0.62578553f},
-std::array<float,2>{0.381116897f, 0.0568631627f},
-std::array<float,2>{0.866781116f, 0.977110267f},
-std::array<float,2>{0.636780381f, 0.0406245515f},
-std::array<float,2>{0.228371337f, 0.994405985f},
-std::array<float,2>{0.427578866f, 0.438524961f},
-std::array<float,2>{0.820324183f, 0.654196739f},
-std::array<float,2>{0.926929116f, 0.370114625f},
-std::array<float,2>{0.37492609f, 0.569734693f},
-std::array<float,2>{0.103053287f, 0.19125466f},
-std::array<float,2>{0.540334046f, 0.818658292f},
-std::array<float,2>{0.766120851f, 0.184548184f},
-std::array<float,2>{0.456525624f, 0.780526519f},
-std::array<float,2>{0.18424277f, 0.285534382f},
-std::array<float,2>{0.742490828f, 0.500628471f},
-std::array<float,2>{0.577013373f, 0.375010163f},
-std::array<float,2>{0.053598512f, 0.693177104f},
-std::array<float,2>{0.29450649f, 0.0900642425f},
-std::array<float,2>{0.951903343f, 0.896677017f},
-std::array<float,2>{0.503988087f, 0.249527574f},
-std::array<float,2>{0.0704519898f, 0.845966876f},
-std::array<float,2>{0.342101783f, 0.325574338f},
-std::array<float,2>{0.888503373f, 0.609142423f},
-std::array<float,2>{0.856433511f, 0.493689716f},
-std::array<float,2>{0.395284116f, 0.674766898f},
-std::array<float,2>{0.208192706f, 0.00760486908f},
-std::array<float,2>{0.66873765f, 0.940228581f},
-std::array<float,2>{0.99049592f, 0.0961078107f},
-std::array<float,2>{0.25865379f, 0.908879519f},
-std::array<float,2>{0.0302392952f, 0.416831642f},
-std::array<float,2>{0.609095931f, 0.728370726f},
-std::array<float,2>{0.718613863f, 0.250252545f},
-std::array<float,2>{0.12941812f, 0.534117222f},
-std::array<float,2>{0.496515602f, 0.148768693f},
-std::array<float,2>{0.806067526f, 0.808406115f},
-std::array<float,2>{0.658917785f, 0.201500505f},
-std::array<float,2>{0.213879615f, 0.826111257f},
-std::array<float,2>{0.40363723f, 0.364585221f},
-std::array<float,2>{0.848217845f, 0.57723999f},
-std::array<float,2>{0.880631268f, 0.4510158f},
-std::array<float,2>{0.329137206f, 0.646479309f},
-std::array<float,2>{0.0658554435f, 0.0336769857f},
-std::array<float,2>{0.512924612f, 0.987583697f},
-std::array<float,2>{0.800506473f, 0.0850418136f},
-std::array<float,2>{0.489898294f, 0.899718761f},
-std::array<float,2>{0.139971584f, 0.386489391f},
-std::array<float,2>{0.704952002f, 0.696922243f},
-std::array<float,2>{0.599379599f, 0.292225599f},
-std::array<float,2>{0.0194244161f, 0.510843694f},
-std::array<float,2>{0.257457554f, 0.172928557f},
-std::array<float,2>{0.996441782f, 0.767525792f},
-std::array<float,2>{0.533852458f, 0.012970007f},
-std::array<float,2>{0.100724533f, 0.949402988f},
-std::array<float,2>{0.366319329f, 0.489509493f},
-std::array<float,2>{0.934673786f, 0.682808638f},
-std::array<float,2>{0.812931836f, 0.313540816f},
-std::array<float,2>{0.433635533f, 0.594406664f},
-std::array<float,2>{0.225951344f, 0.236643955f},
-std::array<float,2>{0.627043664f, 0.852459371f},
-std::array<float,2>{0.94113034f, 0.142136872f},
-std::array<float,2>{0.285439253f, 0.79998666f},
-std::array<float,2>{0.0604129024f, 0.261802942f},
-std::array<float,2>{0.563347459f, 0.542856276f},
-std::array<float,2>{0.741363406f, 0.41090548f},
-std::array<float,2>{0.174040496f, 0.720808983f},
-std::array<float,2>{0.467180699f, 0.108581431f},
-std::array<float,2>{0.77610302f, 0.916507602f},
-std::array<float,2>{0.698928297f, 0.111860454f},
-std::array<float,2>{0.14799954f, 0.922667682f},
-std::array<float,2>{0.47780329f, 0.427454889f},
-std::array<float,2>{0.794876456f, 0.744285464f},
-std::array<float,2>{0.975825608f, 0.265938312f},
-std::array<float,2>{0.270688266f, 0.557461619f},
-std::array<float,2>{0.0153283961f, 0.137622029f},
-std::array<float,2>{0.620800972f, 0.786658466f},
-std::array<float,2>{0.870467901f, 0.22344631f},
-std::array<float,2>{0.38965705f, 0.868801475f},
-std::array<float,2>{0.194432676f, 0.3426736f},
-std::array<float,2>{0.685328186f, 0.623841763f},
-std::array<float,2>{0.524983943f, 0.47012955f},
-std::array<float,2>{0.0847887099f, 0.668660879f},
-std::array<float,2>{0.316181183f, 0.0287786517f},
-std::array<float,2>{0.897749364f, 0.964430571f},
-std::array<float,2>{0.589951575f, 0.168366194f},
-std::array<float,2>{0.0430983305f, 0.762073457f},
-std::array<float,2>{0.309779972f, 0.298089594f},
-std::array<float,2>{0.955134273f, 0.522613823f},
-std::array<float,2>{0.754692674f, 0.396044075f},
-std::array<float,2>{0.450754017f, 0.706252456f},
-std::array<float,2>{0.165992275f, 0.0681938678f},
-std::array<float,2>{0.728437304f, 0.875178754f},
-std::array<float,2>{0.919495583f, 0.0508228056f},
-std::array<float,2>{0.358967394f, 0.975195289f},
-std::array<float,2>{0.124432594f, 0.458998382f},
-std::array<float,2>{0.550956011f, 0.636326253f},
-std::array<float,2>{0.655081332f, 0.355976343f},
-std::array<float,2>{0.235137329f, 0.592935383f},
-std::array<float,2>{0.40895918f, 0.206464216f},
-std::array<float,2>{0.840677619f, 0.838633955f},
-std::array<float,2>{0.708615482f, 0.230102107f},
-std::array<float,2>{0.135745093f, 0.862878263f},
-std::array<float,2>{0.485494703f, 0.331561834f},
-std::array<float,2>{0.804207921f, 0.616807401f},
-std::array<float,2>{0.993340969f, 0.48326394f},
-std::array<float,2>{0.252866775f, 0.659905851f},
-std::array<float,2>{0.0231706332f, 0.0195456389f},
-std::array<float,2>{0.59742415f, 0.955860257f},
-std::array<float,2>{0.847170472f, 0.120620422f},
-std::array<float,2>{0.402199328f, 0.933621287f},
-std::array<float,2>{0.217543662f, 0.432180434f},
-std::array<float,2>{0.663719177f, 0.740125895f},
-std::array<float,2>{0.509630144f, 0.274320245f},
-std::array<float,2>{0.0670486391f, 0.548269808f},
-std::array<float,2>{0.333315849f, 0.130022347f},
-std::array<float,2>{0.875088632f, 0.79056257f},
-std::array<float,2>{0.568446457f, 0.0604352616f},
-std::array<float,2>{0.0584144332f, 0.983763158f},
-std::array<float,2>{0.28199175f, 0.466548562f},
-std::array<float,2>{0.94525224f, 0.631079018f},
-std::array<float,2>{0.779066026f, 0.34714976f},
-std::array<float,2>{0.464291185f, 0.578760862f},
-std::array<float,2>{0.176090762f, 0.217241213f},
-std::array<float,2>{0.735809386f, 0.829924107f},
-std::array<float,2>{0.929730713f, 0.15757288f},
-std::array<float,2>{0.362469405f, 0.753733456f},
-std::array<float,2>{0.0973310247f, 0.307783782f},
-std::array<float,2>{0.53649658f, 0.530067384f},
-std::array<float,2>{0.631576598f, 0.403621942f},
-std::array<float,2>{0.222579926f, 0.711457133f},
-std::array<float,2>{0.43294248f, 0.0735338032f},
-std::array<float,2>{0.819970071f, 0.884641051f},
-std::array<float,2>{0.681312799f, 0.0878908262f},
-std::array<float,2>{0.188137725f, 0.891488075f},
-std::array<float,2>{0.384017795f, 0.379110694f},
-std::array<float,2>{0.874791265f, 0.688431621f},
-std::array<float,2>{0.891504109f, 0.284528345f},
-std::array<float,2>{0.318862557f, 0.505255878f},
-std::array<float,2>{0.0795126855f, 0.181196257f},
-std::array<float,2>{0.528869987f, 0.776731193f},
-std::array<float,2>{0.790638685f, 0.194902331f},
-std::array<float,2>{0.481499523f, 0.812836409f},
-std::array<float,2>{0.140982017f, 0.372612178f},
-std::array<float,2>{0.702021837f, 0.565277874f},
-std::array<float,2>{0.62432754f, 0.443739951f},
-std::array<float,2>{0.00885747559f, 0.648762107f},
-std::array<float,2>{0.26722163f, 0.0442596748f},
-std::array<float,2>{0.970471442f, 0.998702824f},
-std::array<float,2>{0.550182223f, 0.154546231f},
-std::array<float,2>{0.118056729f, 0.810941041f},
-std::array<float,2>{0.352251559f, 0.256642908f},
-std::array<float,2>{0.915655375f, 0.537901878f},
-std::array<float,2>{0.839746296f, 0.421456605f},
-std::array<float,2>{0.413099408f, 0.734055758f},
-std::array<float,2>{0.24061209f, 0.101006165f},
-std::array<float,2>{0.651387751f, 0.911969006f},
-std::array<float,2>{0.95893687f, 0.000209381556f},
-std::array<float,2>{0.30469054f, 0.944792926f},
-std::array<float,2>{0.0418723673f, 0.499892294f},
-std::array<float,2>{0.588268876f, 0.676388085f},
-std::array<float,2>{0.734324932f, 0.32074967f},
-std::array<float,2>{0.17136322f, 0.603357017f},
-std::array<float,2>{0.446059495f, 0.242499486f},
-std::array<float,2>{0.753093481f, 0.84836489f},
-std::array<float,2>{0.643032134f, 0.176932633f},
-std::array<float,2>{0.249150336f, 0.773046017f},
-std::array<float,2>{0.415260285f, 0.294706672f},
-std::array<float,2>{0.830144346f, 0.514926136f},
-std::array<float,2>{0.91019702f, 0.390539616f},
-std::array<float,2>{0.348740369f, 0.70086199f},
-std::array<float,2>{0.112601295f, 0.0801504999f},
-std::array<float,2>{0.560927212f, 0.904787242f},
-std::array<float,2>{0.760795176f, 0.0357119963f},
-std::array<float,2>{0.438993335f, 0.988942444f},
-std::array<float,2>{0.161012635f, 0.446231544f},
-std::array<float,2>{0.724987745f, 0.6411919f},
-std::array<float,2>{0.583837748f, 0.361250073f},
-std::array<float,2>{0.0385754891f, 0.572157025f},
-std::array<float,2>{0.301715225f, 0.196605325f},
-std::array<float,2>{0.965809584f, 0.822088003f},
-std::array<float,2>{0.518146157f, 0.103416979f},
-std::array<float,2>{0.0866696164f, 0.920051932f},
-std::array<float,2>{0.321495801f, 0.408938318f},
-std::array<float,2>{0.903769553f, 0.723908067f},
-std::array<float,2>{0.860636771f, 0.26137349f},
-std::array<float,2>{0.375102222f, 0.544980109f},
-std::array<float,2>{0.201066136f, 0.147897795f},
-std::array<float,2>{0.672495663f, 0.80285728f},
-std::array<float,2>{0.977342784f, 0.240282714f},
-std::array<float,2>{0.279263645f, 0.856389642f},
-std::array<float,2>{0.00678908732f, 0.320211083f},
-std::array<float,2>{0.612409294f, 0.59788835f},
-std::array<float,2>{0.691327214f, 0.486805022f},
-std::array<float,2>{0.154886752f, 0.684166431f},
-std::array<float,2>{0.470355719f, 0.0112489378f},
-std::array<float,2>{0.788493335f, 0.949064374f},
-std::array<float,2>{0.747270167f, 0.0258247498f},
-std::array<float,2>{0.182736501f, 0.966184616f},
-std::array<float,2>{0.457089931f, 0.475344509f},
-std::array<float,2>{0.772598982f, 0.666504562f},
-std::array<float,2>{0.947247863f, 0.336773455f},
-std::array<float,2>{0.292683214f, 0.618978918f},
-std::array<float,2>{0.0482168123f, 0.222100854f},
-std::array<float,2>{0.573503554f, 0.873329341f},
-std::array<float,2>{0.824841678f, 0.132931218f},
-std::array<float,2>{0.422772735f, 0.781366944f},
-std::array<float,2>{0.23289375f, 0.270887464f},
-std::array<float,2>{0.633656859f, 0.559762597f},
-std::array<float,2>{0.543349385f, 0.425653577f},
-std::array<float,2>{0.106360666f, 0.748642623f},
-std::array<float,2>{0.368902266f, 0.115318775f},
-std::array<float,2>{0.925433755f, 0.92957896f},
-std::array<float,2>{0.605377078f, 0.210031539f},
-std::array<float,2>{0.0234610159f, 0.840591848f},
-std::array<float,2>{0.265331268f, 0.351584971f},
-std::array<float,2>{0.987761676f, 0.58744812f},
-std::array<float,2>{0.80939436f, 0.454146326f},
-std::array<float,2>{0.493159622f, 0.638153255f},
-std::array<float,2>{0.126049325f, 0.048970595f},
-std::array<float,2>{0.714219034f, 0.96987474f},
-std::array<float,2>{0.885236323f, 0.0649599954f},
-std::array<float,2>{0.33940649f, 0.879716694f},
-std::array<float,2>{0.0778929144f, 0.391111642f},
-std::array<float,2>{0.501922667f, 0.710012138f},
-std::array<float,2>{0.667884767f, 0.30390197f},
-std::array<float,2>{0.204937607f, 0.516507208f},
-std::array<float,2>{0.391643196f, 0.164454982f},
-std::array<float,2>{0.851816177f, 0.761050165f}}
\ No newline at end of file
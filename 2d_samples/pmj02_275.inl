@@ -1,4096 +0,0 @@
-{std::array<float,2>{0.141829953f, 0.0897217616f},
-std::array<float,2>{0.973166823f, 0.577791929f},
-std::array<float,2>{0.644828141f, 0.319784552f},
-std::array<float,2>{0.448925674f, 0.889426589f},
-std::array<float,2>{0.304013282f, 0.486568987f},
-std::array<float,2>{0.535740554f, 0.79427743f},
-std::array<float,2>{0.83849287f, 0.1998588f},
-std::array<float,2>{0.0986931324f, 0.705195546f},
-std::array<float,2>{0.0576832592f, 0.30335173f},
-std::array<float,2>{0.802863657f, 0.984178364f},
-std::array<float,2>{0.613025963f, 0.0526657589f},
-std::array<float,2>{0.316907227f, 0.529960394f},
-std::array<float,2>{0.417231649f, 0.184268653f},
-std::array<float,2>{0.698892534f, 0.639831424f},
-std::array<float,2>{0.890730619f, 0.421328485f},
-std::array<float,2>{0.242834419f, 0.842041075f},
-std::array<float,2>{0.0793961808f, 0.240286097f},
-std::array<float,2>{0.852739334f, 0.733675122f},
-std::array<float,2>{0.528221846f, 0.454419166f},
-std::array<float,2>{0.279971898f, 0.774645925f},
-std::array<float,2>{0.482230514f, 0.36025995f},
-std::array<float,2>{0.668145657f, 0.925019741f},
-std::array<float,2>{0.944218397f, 0.110784702f},
-std::array<float,2>{0.167907819f, 0.613865137f},
-std::array<float,2>{0.191874221f, 0.383915126f},
-std::array<float,2>{0.937235475f, 0.873189092f},
-std::array<float,2>{0.742681921f, 0.149433374f},
-std::array<float,2>{0.384891152f, 0.662661731f},
-std::array<float,2>{0.347841799f, 0.0164759364f},
-std::array<float,2>{0.562650323f, 0.558258832f},
-std::array<float,2>{0.765035629f, 0.25436607f},
-std::array<float,2>{0.010780883f, 0.952928185f},
-std::array<float,2>{0.231185704f, 0.132018834f},
-std::array<float,2>{0.883967817f, 0.677847505f},
-std::array<float,2>{0.708818734f, 0.402336538f},
-std::array<float,2>{0.43168655f, 0.858330905f},
-std::array<float,2>{0.330805719f, 0.266402483f},
-std::array<float,2>{0.602654934f, 0.958205879f},
-std::array<float,2>{0.783185482f, 0.0136156967f},
-std::array<float,2>{0.0433675162f, 0.535737097f},
-std::array<float,2>{0.120353229f, 0.445866525f},
-std::array<float,2>{0.821783185f, 0.753134847f},
-std::array<float,2>{0.554013789f, 0.233085424f},
-std::array<float,2>{0.293947548f, 0.740725636f},
-std::array<float,2>{0.454386503f, 0.10450428f},
-std::array<float,2>{0.625853896f, 0.598959923f},
-std::array<float,2>{0.998946249f, 0.350263685f},
-std::array<float,2>{0.127902314f, 0.911538839f},
-std::array<float,2>{0.0187026002f, 0.0351994522f},
-std::array<float,2>{0.767253518f, 0.509272814f},
-std::array<float,2>{0.584217727f, 0.281500846f},
-std::array<float,2>{0.374888688f, 0.987419188f},
-std::array<float,2>{0.394498795f, 0.429290891f},
-std::array<float,2>{0.722531259f, 0.823884964f},
-std::array<float,2>{0.910079241f, 0.157484129f},
-std::array<float,2>{0.208845347f, 0.646700323f},
-std::array<float,2>{0.184123665f, 0.330241948f},
-std::array<float,2>{0.960009694f, 0.903068483f},
-std::array<float,2>{0.68176347f, 0.0629764944f},
-std::array<float,2>{0.485109776f, 0.58886975f},
-std::array<float,2>{0.259705395f, 0.208870038f},
-std::array<float,2>{0.511835754f, 0.701973677f},
-std::array<float,2>{0.861244321f, 0.481716454f},
-std::array<float,2>{0.071853511f, 0.801753759f},
-std::array<float,2>{0.214020267f, 0.00759643875f},
-std::array<float,2>{0.918423057f, 0.540875912f},
-std::array<float,2>{0.730774283f, 0.273879737f},
-std::array<float,2>{0.399128377f, 0.961800575f},
-std::array<float,2>{0.363410205f, 0.39221406f},
-std::array<float,2>{0.587039649f, 0.8495121f},
-std::array<float,2>{0.775547206f, 0.135689721f},
-std::array<float,2>{0.0234513171f, 0.685044229f},
-std::array<float,2>{0.0650156289f, 0.357080191f},
-std::array<float,2>{0.870470107f, 0.920492768f},
-std::array<float,2>{0.501100004f, 0.0951740518f},
-std::array<float,2>{0.257796347f, 0.601592183f},
-std::array<float,2>{0.49870953f, 0.223955661f},
-std::array<float,2>{0.676805139f, 0.747796118f},
-std::array<float,2>{0.965209246f, 0.443567812f},
-std::array<float,2>{0.173391208f, 0.76164639f},
-std::array<float,2>{0.0320193507f, 0.167028978f},
-std::array<float,2>{0.796569526f, 0.648684144f},
-std::array<float,2>{0.599049389f, 0.429884732f},
-std::array<float,2>{0.339946777f, 0.814264774f},
-std::array<float,2>{0.427757889f, 0.294897228f},
-std::array<float,2>{0.717101932f, 0.995892942f},
-std::array<float,2>{0.882802546f, 0.0455066636f},
-std::array<float,2>{0.221758276f, 0.505784929f},
-std::array<float,2>{0.138362646f, 0.470630318f},
-std::array<float,2>{0.987626255f, 0.810954571f},
-std::array<float,2>{0.634716988f, 0.216189429f},
-std::array<float,2>{0.461980015f, 0.693509817f},
-std::array<float,2>{0.281332105f, 0.0726151839f},
-std::array<float,2>{0.561479151f, 0.585353434f},
-std::array<float,2>{0.814451873f, 0.342634439f},
-std::array<float,2>{0.112579189f, 0.894640505f},
-std::array<float,2>{0.160948232f, 0.189696953f},
-std::array<float,2>{0.952228308f, 0.717614055f},
-std::array<float,2>{0.662468493f, 0.494594485f},
-std::array<float,2>{0.475841314f, 0.782852888f},
-std::array<float,2>{0.265718848f, 0.321111679f},
-std::array<float,2>{0.517049909f, 0.881043553f},
-std::array<float,2>{0.847283781f, 0.0851574987f},
-std::array<float,2>{0.0874909535f, 0.568200052f},
-std::array<float,2>{0.0039357366f, 0.409664214f},
-std::array<float,2>{0.750779808f, 0.835304081f},
-std::array<float,2>{0.575916171f, 0.177978322f},
-std::array<float,2>{0.356221765f, 0.629671931f},
-std::array<float,2>{0.37553373f, 0.054920584f},
-std::array<float,2>{0.737645209f, 0.519859552f},
-std::array<float,2>{0.923517585f, 0.312060952f},
-std::array<float,2>{0.200230375f, 0.976429701f},
-std::array<float,2>{0.108205117f, 0.120922841f},
-std::array<float,2>{0.830175459f, 0.624342442f},
-std::array<float,2>{0.543592691f, 0.367765695f},
-std::array<float,2>{0.310678571f, 0.932824194f},
-std::array<float,2>{0.440138042f, 0.467543006f},
-std::array<float,2>{0.649430811f, 0.766647756f},
-std::array<float,2>{0.982194364f, 0.249844387f},
-std::array<float,2>{0.152469382f, 0.723095834f},
-std::array<float,2>{0.235098317f, 0.258025795f},
-std::array<float,2>{0.903248191f, 0.93819207f},
-std::array<float,2>{0.693349957f, 0.0262401998f},
-std::array<float,2>{0.4130916f, 0.554242969f},
-std::array<float,2>{0.327613235f, 0.146139011f},
-std::array<float,2>{0.620349824f, 0.667950749f},
-std::array<float,2>{0.804856718f, 0.381792039f},
-std::array<float,2>{0.0535244904f, 0.864839494f},
-std::array<float,2>{0.249722764f, 0.0995798633f},
-std::array<float,2>{0.894767225f, 0.606484056f},
-std::array<float,2>{0.700435221f, 0.355271131f},
-std::array<float,2>{0.418790489f, 0.916567385f},
-std::array<float,2>{0.313636333f, 0.438592911f},
-std::array<float,2>{0.614797652f, 0.764437795f},
-std::array<float,2>{0.799157619f, 0.220709652f},
-std::array<float,2>{0.0606772825f, 0.742285252f},
-std::array<float,2>{0.0940555558f, 0.279084682f},
-std::array<float,2>{0.840945244f, 0.967616856f},
-std::array<float,2>{0.53154695f, 0.000591251825f},
-std::array<float,2>{0.29825601f, 0.546530366f},
-std::array<float,2>{0.451445729f, 0.139258146f},
-std::array<float,2>{0.641895533f, 0.680442929f},
-std::array<float,2>{0.971391857f, 0.395962626f},
-std::array<float,2>{0.145575866f, 0.845813632f},
-std::array<float,2>{0.0128093408f, 0.212887749f},
-std::array<float,2>{0.758552074f, 0.687767267f},
-std::array<float,2>{0.566992998f, 0.475016981f},
-std::array<float,2>{0.34399578f, 0.805031359f},
-std::array<float,2>{0.387952417f, 0.339036554f},
-std::array<float,2>{0.749559343f, 0.893932343f},
-std::array<float,2>{0.931828976f, 0.0781061873f},
-std::array<float,2>{0.188737109f, 0.580517113f},
-std::array<float,2>{0.170670629f, 0.43472293f},
-std::array<float,2>{0.93974185f, 0.819522738f},
-std::array<float,2>{0.667646527f, 0.168461502f},
-std::array<float,2>{0.48021102f, 0.652923107f},
-std::array<float,2>{0.274291784f, 0.0415504053f},
-std::array<float,2>{0.524260759f, 0.501343966f},
-std::array<float,2>{0.858483791f, 0.289382607f},
-std::array<float,2>{0.0853460878f, 0.999067068f},
-std::array<float,2>{0.130822942f, 0.173347548f},
-std::array<float,2>{0.994366705f, 0.628210306f},
-std::array<float,2>{0.62912178f, 0.41304332f},
-std::array<float,2>{0.460213274f, 0.831043184f},
-std::array<float,2>{0.292497069f, 0.307471782f},
-std::array<float,2>{0.548648179f, 0.96903944f},
-std::array<float,2>{0.826605678f, 0.0623978376f},
-std::array<float,2>{0.124870732f, 0.51660496f},
-std::array<float,2>{0.0401022695f, 0.497329861f},
-std::array<float,2>{0.786339283f, 0.786983013f},
-std::array<float,2>{0.606460214f, 0.192275673f},
-std::array<float,2>{0.333503276f, 0.71269995f},
-std::array<float,2>{0.433629364f, 0.0819549337f},
-std::array<float,2>{0.704737902f, 0.564933896f},
-std::array<float,2>{0.888680637f, 0.32734251f},
-std::array<float,2>{0.2292068f, 0.876182377f},
-std::array<float,2>{0.0777898207f, 0.0298315417f},
-std::array<float,2>{0.86351341f, 0.548830092f},
-std::array<float,2>{0.507861674f, 0.26390025f},
-std::array<float,2>{0.26447171f, 0.94222796f},
-std::array<float,2>{0.490903646f, 0.377992064f},
-std::array<float,2>{0.684882939f, 0.862714648f},
-std::array<float,2>{0.954299867f, 0.143422693f},
-std::array<float,2>{0.181279078f, 0.670935631f},
-std::array<float,2>{0.206972107f, 0.374089509f},
-std::array<float,2>{0.912622511f, 0.933700681f},
-std::array<float,2>{0.722696662f, 0.121795416f},
-std::array<float,2>{0.395034641f, 0.619012713f},
-std::array<float,2>{0.367739409f, 0.244396374f},
-std::array<float,2>{0.57857281f, 0.720843613f},
-std::array<float,2>{0.772433996f, 0.463234514f},
-std::array<float,2>{0.0217258073f, 0.772397339f},
-std::array<float,2>{0.176316842f, 0.0484576449f},
-std::array<float,2>{0.964143395f, 0.524134815f},
-std::array<float,2>{0.675146341f, 0.299801201f},
-std::array<float,2>{0.49427557f, 0.97930479f},
-std::array<float,2>{0.253013015f, 0.417191505f},
-std::array<float,2>{0.50419879f, 0.839838982f},
-std::array<float,2>{0.871893346f, 0.180526093f},
-std::array<float,2>{0.0693070516f, 0.635896325f},
-std::array<float,2>{0.0290386565f, 0.315674037f},
-std::array<float,2>{0.779420376f, 0.88410002f},
-std::array<float,2>{0.592288256f, 0.0899350718f},
-std::array<float,2>{0.362414986f, 0.573893666f},
-std::array<float,2>{0.402874678f, 0.198081002f},
-std::array<float,2>{0.72676456f, 0.707151473f},
-std::array<float,2>{0.916044354f, 0.489326835f},
-std::array<float,2>{0.216421008f, 0.792126596f},
-std::array<float,2>{0.116166681f, 0.154492915f},
-std::array<float,2>{0.816507399f, 0.659028888f},
-std::array<float,2>{0.556570768f, 0.387758166f},
-std::array<float,2>{0.286596537f, 0.868138194f},
-std::array<float,2>{0.465762138f, 0.250709206f},
-std::array<float,2>{0.638587952f, 0.947707355f},
-std::array<float,2>{0.990673006f, 0.020239234f},
-std::array<float,2>{0.135589525f, 0.561284184f},
-std::array<float,2>{0.223390579f, 0.45939362f},
-std::array<float,2>{0.877441227f, 0.779831469f},
-std::array<float,2>{0.712011814f, 0.236165076f},
-std::array<float,2>{0.422114998f, 0.729926705f},
-std::array<float,2>{0.339455992f, 0.11347618f},
-std::array<float,2>{0.597059727f, 0.613182902f},
-std::array<float,2>{0.789697826f, 0.364628077f},
-std::array<float,2>{0.0357793272f, 0.929624021f},
-std::array<float,2>{0.195775941f, 0.22947526f},
-std::array<float,2>{0.927131355f, 0.738150537f},
-std::array<float,2>{0.739918649f, 0.452644348f},
-std::array<float,2>{0.380942076f, 0.755770564f},
-std::array<float,2>{0.352039933f, 0.344635904f},
-std::array<float,2>{0.57032609f, 0.90834862f},
-std::array<float,2>{0.757632375f, 0.109003782f},
-std::array<float,2>{0.000297372579f, 0.593793035f},
-std::array<float,2>{0.0905003324f, 0.404779762f},
-std::array<float,2>{0.850171506f, 0.851993382f},
-std::array<float,2>{0.520234108f, 0.127577499f},
-std::array<float,2>{0.270435959f, 0.675660312f},
-std::array<float,2>{0.470378846f, 0.0110198185f},
-std::array<float,2>{0.659758687f, 0.532152534f},
-std::array<float,2>{0.947942913f, 0.272922784f},
-std::array<float,2>{0.157504663f, 0.956662714f},
-std::array<float,2>{0.0479047894f, 0.0700155348f},
-std::array<float,2>{0.810565889f, 0.592698812f},
-std::array<float,2>{0.621536732f, 0.333007514f},
-std::array<float,2>{0.322271019f, 0.899537265f},
-std::array<float,2>{0.4093768f, 0.476576775f},
-std::array<float,2>{0.689053059f, 0.797958314f},
-std::array<float,2>{0.899670422f, 0.203834504f},
-std::array<float,2>{0.239681274f, 0.699103892f},
-std::array<float,2>{0.1490013f, 0.285211384f},
-std::array<float,2>{0.979517162f, 0.991667926f},
-std::array<float,2>{0.653355181f, 0.0339955278f},
-std::array<float,2>{0.443842322f, 0.514358938f},
-std::array<float,2>{0.308269471f, 0.16375038f},
-std::array<float,2>{0.539316118f, 0.642346919f},
-std::array<float,2>{0.834216475f, 0.424951583f},
-std::array<float,2>{0.105395049f, 0.827455461f},
-std::array<float,2>{0.165271148f, 0.111659542f},
-std::array<float,2>{0.942155004f, 0.616990149f},
-std::array<float,2>{0.670863926f, 0.363258004f},
-std::array<float,2>{0.484056145f, 0.922581613f},
-std::array<float,2>{0.277688324f, 0.455753475f},
-std::array<float,2>{0.530388296f, 0.776381075f},
-std::array<float,2>{0.854875922f, 0.239089847f},
-std::array<float,2>{0.0813730061f, 0.732036233f},
-std::array<float,2>{0.00846999045f, 0.257388175f},
-std::array<float,2>{0.762681961f, 0.949263811f},
-std::array<float,2>{0.565000236f, 0.0194553286f},
-std::array<float,2>{0.349899292f, 0.555971026f},
-std::array<float,2>{0.384731561f, 0.150834322f},
-std::array<float,2>{0.744373024f, 0.66130352f},
-std::array<float,2>{0.93445015f, 0.3867006f},
-std::array<float,2>{0.194009438f, 0.872879386f},
-std::array<float,2>{0.100457534f, 0.20206666f},
-std::array<float,2>{0.837756336f, 0.703739762f},
-std::array<float,2>{0.538525641f, 0.48610723f},
-std::array<float,2>{0.301435828f, 0.795271397f},
-std::array<float,2>{0.446951687f, 0.316617817f},
-std::array<float,2>{0.648115635f, 0.887547672f},
-std::array<float,2>{0.976119876f, 0.0872841701f},
-std::array<float,2>{0.144322202f, 0.57481122f},
-std::array<float,2>{0.244320765f, 0.418371379f},
-std::array<float,2>{0.892897308f, 0.84125185f},
-std::array<float,2>{0.695344269f, 0.187000215f},
-std::array<float,2>{0.415685266f, 0.637379289f},
-std::array<float,2>{0.319116175f, 0.0534634031f},
-std::array<float,2>{0.609650254f, 0.529241025f},
-std::array<float,2>{0.801915348f, 0.302188009f},
-std::array<float,2>{0.0551963374f, 0.980900526f},
-std::array<float,2>{0.210085183f, 0.15890564f},
-std::array<float,2>{0.906864285f, 0.644799531f},
-std::array<float,2>{0.719046295f, 0.427319169f},
-std::array<float,2>{0.392417192f, 0.821011543f},
-std::array<float,2>{0.371552497f, 0.284621447f},
-std::array<float,2>{0.583892822f, 0.984522879f},
-std::array<float,2>{0.768671215f, 0.037470635f},
-std::array<float,2>{0.0174095985f, 0.510121047f},
-std::array<float,2>{0.0726112947f, 0.483568043f},
-std::array<float,2>{0.862342775f, 0.804240823f},
-std::array<float,2>{0.515619516f, 0.209459901f},
-std::array<float,2>{0.260889649f, 0.699465632f},
-std::array<float,2>{0.488069206f, 0.065987207f},
-std::array<float,2>{0.680458844f, 0.586473405f},
-std::array<float,2>{0.957132101f, 0.328146666f},
-std::array<float,2>{0.185700551f, 0.905970275f},
-std::array<float,2>{0.0455852151f, 0.0139100244f},
-std::array<float,2>{0.783758402f, 0.538202226f},
-std::array<float,2>{0.60518223f, 0.26857242f},
-std::array<float,2>{0.329676718f, 0.960171103f},
-std::array<float,2>{0.431284875f, 0.400087774f},
-std::array<float,2>{0.710632145f, 0.856555164f},
-std::array<float,2>{0.885375559f, 0.128916338f},
-std::array<float,2>{0.233802229f, 0.675788403f},
-std::array<float,2>{0.126310959f, 0.349582821f},
-std::array<float,2>{0.997360468f, 0.913905561f},
-std::array<float,2>{0.628217161f, 0.10325978f},
-std::array<float,2>{0.45585084f, 0.599839091f},
-std::array<float,2>{0.295225024f, 0.231658638f},
-std::array<float,2>{0.551493704f, 0.739443004f},
-std::array<float,2>{0.823041856f, 0.449001789f},
-std::array<float,2>{0.117742263f, 0.751468778f},
-std::array<float,2>{0.219415247f, 0.0442863964f},
-std::array<float,2>{0.879665673f, 0.506197095f},
-std::array<float,2>{0.715382934f, 0.296193689f},
-std::array<float,2>{0.426291794f, 0.992565215f},
-std::array<float,2>{0.343464792f, 0.433287919f},
-std::array<float,2>{0.60115701f, 0.814904213f},
-std::array<float,2>{0.794494927f, 0.16543673f},
-std::array<float,2>{0.0342820622f, 0.651287675f},
-std::array<float,2>{0.109949261f, 0.3411915f},
-std::array<float,2>{0.816238582f, 0.897028565f},
-std::array<float,2>{0.560162723f, 0.0704270303f},
-std::array<float,2>{0.283993632f, 0.583130002f},
-std::array<float,2>{0.464091718f, 0.217378899f},
-std::array<float,2>{0.635188043f, 0.691677094f},
-std::array<float,2>{0.985935092f, 0.471023977f},
-std::array<float,2>{0.13987501f, 0.809415936f},
-std::array<float,2>{0.0263022128f, 0.134584963f},
-std::array<float,2>{0.775245845f, 0.685873687f},
-std::array<float,2>{0.588031411f, 0.39377588f},
-std::array<float,2>{0.365443617f, 0.851006866f},
-std::array<float,2>{0.401881129f, 0.277335882f},
-std::array<float,2>{0.73371011f, 0.964766204f},
-std::array<float,2>{0.921561778f, 0.00544394273f},
-std::array<float,2>{0.2120803f, 0.54281503f},
-std::array<float,2>{0.174109757f, 0.441881329f},
-std::array<float,2>{0.967067301f, 0.758742154f},
-std::array<float,2>{0.679633498f, 0.224886671f},
-std::array<float,2>{0.496183395f, 0.74927032f},
-std::array<float,2>{0.254966974f, 0.0972253308f},
-std::array<float,2>{0.502662957f, 0.604269981f},
-std::array<float,2>{0.868917525f, 0.358427465f},
-std::array<float,2>{0.0643922389f, 0.918620825f},
-std::array<float,2>{0.154857486f, 0.247707099f},
-std::array<float,2>{0.984032154f, 0.725660145f},
-std::array<float,2>{0.651667953f, 0.466258228f},
-std::array<float,2>{0.437625796f, 0.767734945f},
-std::array<float,2>{0.309111893f, 0.369687647f},
-std::array<float,2>{0.546524525f, 0.929796517f},
-std::array<float,2>{0.828716695f, 0.117392242f},
-std::array<float,2>{0.107093208f, 0.622351527f},
-std::array<float,2>{0.0507974401f, 0.379704684f},
-std::array<float,2>{0.808111489f, 0.866825402f},
-std::array<float,2>{0.619074702f, 0.147768095f},
-std::array<float,2>{0.325226426f, 0.664978325f},
-std::array<float,2>{0.410797447f, 0.0244968124f},
-std::array<float,2>{0.694647849f, 0.551681161f},
-std::array<float,2>{0.904359221f, 0.261035144f},
-std::array<float,2>{0.236350343f, 0.939742148f},
-std::array<float,2>{0.0896681845f, 0.0823063627f},
-std::array<float,2>{0.843917191f, 0.56861341f},
-std::array<float,2>{0.517973423f, 0.323407829f},
-std::array<float,2>{0.268717259f, 0.880391359f},
-std::array<float,2>{0.472898543f, 0.492774546f},
-std::array<float,2>{0.661386192f, 0.783515811f},
-std::array<float,2>{0.950116694f, 0.187796175f},
-std::array<float,2>{0.162751824f, 0.715376616f},
-std::array<float,2>{0.202596962f, 0.309171349f},
-std::array<float,2>{0.925101459f, 0.974333346f},
-std::array<float,2>{0.735473692f, 0.0581314787f},
-std::array<float,2>{0.378126681f, 0.521757841f},
-std::array<float,2>{0.358947963f, 0.176335871f},
-std::array<float,2>{0.577833593f, 0.631765962f},
-std::array<float,2>{0.752328038f, 0.406328082f},
-std::array<float,2>{0.00777662545f, 0.833209276f},
-std::array<float,2>{0.190378472f, 0.0757772401f},
-std::array<float,2>{0.930254698f, 0.578909874f},
-std::array<float,2>{0.746549785f, 0.337876469f},
-std::array<float,2>{0.389804006f, 0.891636908f},
-std::array<float,2>{0.346883982f, 0.472746253f},
-std::array<float,2>{0.568711281f, 0.807035744f},
-std::array<float,2>{0.760154665f, 0.214552522f},
-std::array<float,2>{0.0148553671f, 0.689932406f},
-std::array<float,2>{0.0839286f, 0.292393476f},
-std::array<float,2>{0.857266068f, 0.997002423f},
-std::array<float,2>{0.526564717f, 0.0392879397f},
-std::array<float,2>{0.277115405f, 0.503738225f},
-std::array<float,2>{0.476599723f, 0.17142801f},
-std::array<float,2>{0.665358126f, 0.654674828f},
-std::array<float,2>{0.93931663f, 0.43717441f},
-std::array<float,2>{0.16904889f, 0.816415966f},
-std::array<float,2>{0.0601090677f, 0.220529869f},
-std::array<float,2>{0.798704624f, 0.745468616f},
-std::array<float,2>{0.616024673f, 0.439490408f},
-std::array<float,2>{0.315553337f, 0.76285851f},
-std::array<float,2>{0.4210504f, 0.35157305f},
-std::array<float,2>{0.702381968f, 0.915674806f},
-std::array<float,2>{0.896722078f, 0.0996688306f},
-std::array<float,2>{0.247041106f, 0.607966185f},
-std::array<float,2>{0.148165286f, 0.398341268f},
-std::array<float,2>{0.969242036f, 0.843964994f},
-std::array<float,2>{0.643833995f, 0.13777104f},
-std::array<float,2>{0.44943428f, 0.683327377f},
-std::array<float,2>{0.299683481f, 0.00243502692f},
-std::array<float,2>{0.533310831f, 0.544285655f},
-std::array<float,2>{0.842899799f, 0.280955464f},
-std::array<float,2>{0.0967163146f, 0.965512574f},
-std::array<float,2>{0.182511225f, 0.14144814f},
-std::array<float,2>{0.955934882f, 0.668686092f},
-std::array<float,2>{0.686594844f, 0.375040412f},
-std::array<float,2>{0.489156812f, 0.860200584f},
-std::array<float,2>{0.262959182f, 0.262935519f},
-std::array<float,2>{0.510106742f, 0.944923639f},
-std::array<float,2>{0.865397751f, 0.0274038576f},
-std::array<float,2>{0.0753415823f, 0.547960043f},
-std::array<float,2>{0.0200976506f, 0.462563396f},
-std::array<float,2>{0.770390153f, 0.770589232f},
-std::array<float,2>{0.580561399f, 0.243332773f},
-std::array<float,2>{0.369296402f, 0.719237864f},
-std::array<float,2>{0.397357881f, 0.124380611f},
-std::array<float,2>{0.725405455f, 0.619939923f},
-std::array<float,2>{0.91027534f, 0.372373521f},
-std::array<float,2>{0.204039022f, 0.935700655f},
-std::array<float,2>{0.122462727f, 0.058850918f},
-std::array<float,2>{0.825021684f, 0.519321442f},
-std::array<float,2>{0.550733984f, 0.305404872f},
-std::array<float,2>{0.290933609f, 0.971910357f},
-std::array<float,2>{0.457609326f, 0.410604954f},
-std::array<float,2>{0.631905854f, 0.829714f},
-std::array<float,2>{0.992636383f, 0.173990294f},
-std::array<float,2>{0.132765204f, 0.625972152f},
-std::array<float,2>{0.227388307f, 0.324566334f},
-std::array<float,2>{0.887492716f, 0.877694011f},
-std::array<float,2>{0.705239534f, 0.078905955f},
-std::array<float,2>{0.435777903f, 0.564239383f},
-std::array<float,2>{0.334674209f, 0.195263505f},
-std::array<float,2>{0.608219028f, 0.713536799f},
-std::array<float,2>{0.788384616f, 0.498113781f},
-std::array<float,2>{0.0411549062f, 0.788784146f},
-std::array<float,2>{0.134061858f, 0.0220771972f},
-std::array<float,2>{0.988422573f, 0.560099721f},
-std::array<float,2>{0.640130341f, 0.25338605f},
-std::array<float,2>{0.466956377f, 0.945857584f},
-std::array<float,2>{0.287844062f, 0.389374495f},
-std::array<float,2>{0.556766331f, 0.870589435f},
-std::array<float,2>{0.820065916f, 0.152538478f},
-std::array<float,2>{0.113469705f, 0.657548845f},
-std::array<float,2>{0.0388312154f, 0.366404116f},
-std::array<float,2>{0.792456985f, 0.926100671f},
-std::array<float,2>{0.595296204f, 0.11698465f},
-std::array<float,2>{0.337337613f, 0.610870898f},
-std::array<float,2>{0.424031407f, 0.237311006f},
-std::array<float,2>{0.714375257f, 0.726733983f},
-std::array<float,2>{0.876929402f, 0.45878312f},
-std::array<float,2>{0.226333693f, 0.777450323f},
-std::array<float,2>{0.0667623803f, 0.183393568f},
-std::array<float,2>{0.873082101f, 0.634252369f},
-std::array<float,2>{0.506000876f, 0.414512604f},
-std::array<float,2>{0.250699997f, 0.836253822f},
-std::array<float,2>{0.492439926f, 0.296959132f},
-std::array<float,2>{0.67286694f, 0.978260636f},
-std::array<float,2>{0.961722374f, 0.0489703231f},
-std::array<float,2>{0.179267868f, 0.52706933f},
-std::array<float,2>{0.218450159f, 0.490460634f},
-std::array<float,2>{0.915161669f, 0.790919542f},
-std::array<float,2>{0.729638278f, 0.197142586f},
-std::array<float,2>{0.405507594f, 0.709701657f},
-std::array<float,2>{0.359798312f, 0.0927108675f},
-std::array<float,2>{0.590058029f, 0.570640326f},
-std::array<float,2>{0.77871412f, 0.314408898f},
-std::array<float,2>{0.0301507656f, 0.885357976f},
-std::array<float,2>{0.240315557f, 0.206807345f},
-std::array<float,2>{0.90119642f, 0.695845902f},
-std::array<float,2>{0.690839171f, 0.480305463f},
-std::array<float,2>{0.407183975f, 0.800211787f},
-std::array<float,2>{0.321599245f, 0.33482185f},
-std::array<float,2>{0.623446882f, 0.901857495f},
-std::array<float,2>{0.80979079f, 0.0670879334f},
-std::array<float,2>{0.0488744602f, 0.590199232f},
-std::array<float,2>{0.102706112f, 0.421965301f},
-std::array<float,2>{0.832913816f, 0.82429558f},
-std::array<float,2>{0.542064071f, 0.161733285f},
-std::array<float,2>{0.306268126f, 0.642755926f},
-std::array<float,2>{0.443277299f, 0.0328980647f},
-std::array<float,2>{0.654446661f, 0.512824476f},
-std::array<float,2>{0.976821184f, 0.287961483f},
-std::array<float,2>{0.15107812f, 0.988870561f},
-std::array<float,2>{0.00239982596f, 0.106251568f},
-std::array<float,2>{0.754958749f, 0.596058071f},
-std::array<float,2>{0.57320857f, 0.347566456f},
-std::array<float,2>{0.354501307f, 0.906856954f},
-std::array<float,2>{0.379855424f, 0.449775279f},
-std::array<float,2>{0.741919875f, 0.757356822f},
-std::array<float,2>{0.928432226f, 0.227932259f},
-std::array<float,2>{0.198605493f, 0.735172033f},
-std::array<float,2>{0.159165382f, 0.269637436f},
-std::array<float,2>{0.94713217f, 0.953532279f},
-std::array<float,2>{0.6570701f, 0.00936628692f},
-std::array<float,2>{0.471927136f, 0.535005212f},
-std::array<float,2>{0.271927774f, 0.12626034f},
-std::array<float,2>{0.522428632f, 0.673663318f},
-std::array<float,2>{0.848177612f, 0.403167307f},
-std::array<float,2>{0.0932554379f, 0.855026841f},
-std::array<float,2>{0.186597586f, 0.0637979731f},
-std::array<float,2>{0.958289742f, 0.58841902f},
-std::array<float,2>{0.681399882f, 0.331552804f},
-std::array<float,2>{0.486974686f, 0.903784335f},
-std::array<float,2>{0.259971738f, 0.480571508f},
-std::array<float,2>{0.513710499f, 0.802646279f},
-std::array<float,2>{0.861584425f, 0.207510263f},
-std::array<float,2>{0.0741474703f, 0.702597082f},
-std::array<float,2>{0.0157074519f, 0.282701552f},
-std::array<float,2>{0.768068969f, 0.986712158f},
-std::array<float,2>{0.582112253f, 0.036960911f},
-std::array<float,2>{0.37255618f, 0.508170187f},
-std::array<float,2>{0.390829772f, 0.156625822f},
-std::array<float,2>{0.719814122f, 0.648342967f},
-std::array<float,2>{0.907573819f, 0.427975267f},
-std::array<float,2>{0.209362f, 0.822829127f},
-std::array<float,2>{0.118590772f, 0.233787999f},
-std::array<float,2>{0.823672771f, 0.74194473f},
-std::array<float,2>{0.552181065f, 0.447075486f},
-std::array<float,2>{0.296471506f, 0.752731442f},
-std::array<float,2>{0.456451118f, 0.350666761f},
-std::array<float,2>{0.627413869f, 0.910693705f},
-std::array<float,2>{0.99670887f, 0.10401877f},
-std::array<float,2>{0.125210896f, 0.598479271f},
-std::array<float,2>{0.232874975f, 0.401038706f},
-std::array<float,2>{0.885830104f, 0.85860914f},
-std::array<float,2>{0.709235966f, 0.131293282f},
-std::array<float,2>{0.43005842f, 0.679314911f},
-std::array<float,2>{0.328306973f, 0.0124868024f},
-std::array<float,2>{0.60414356f, 0.536202312f},
-std::array<float,2>{0.785065413f, 0.267165929f},
-std::array<float,2>{0.0465044156f, 0.957974911f},
-std::array<float,2>{0.194840938f, 0.148722529f},
-std::array<float,2>{0.934574425f, 0.663603008f},
-std::array<float,2>{0.745829821f, 0.38294968f},
-std::array<float,2>{0.383679062f, 0.874414027f},
-std::array<float,2>{0.350856215f, 0.254910588f},
-std::array<float,2>{0.566204011f, 0.951840162f},
-std::array<float,2>{0.763136089f, 0.0172153451f},
-std::array<float,2>{0.00879242737f, 0.557457447f},
-std::array<float,2>{0.0808433816f, 0.453765064f},
-std::array<float,2>{0.853746474f, 0.774267972f},
-std::array<float,2>{0.530121446f, 0.241346821f},
-std::array<float,2>{0.279100865f, 0.732806325f},
-std::array<float,2>{0.482735783f, 0.110183224f},
-std::array<float,2>{0.670976341f, 0.614977479f},
-std::array<float,2>{0.942950308f, 0.361134082f},
-std::array<float,2>{0.164715335f, 0.924553037f},
-std::array<float,2>{0.0559457317f, 0.0512959771f},
-std::array<float,2>{0.801416159f, 0.530983865f},
-std::array<float,2>{0.611220896f, 0.304117829f},
-std::array<float,2>{0.319908619f, 0.983270705f},
-std::array<float,2>{0.414246827f, 0.420016378f},
-std::array<float,2>{0.696609378f, 0.843714714f},
-std::array<float,2>{0.893968284f, 0.185531273f},
-std::array<float,2>{0.245355234f, 0.639257133f},
-std::array<float,2>{0.143151343f, 0.318867326f},
-std::array<float,2>{0.975343108f, 0.889763713f},
-std::array<float,2>{0.646830499f, 0.0886165947f},
-std::array<float,2>{0.445781887f, 0.576287389f},
-std::array<float,2>{0.302465528f, 0.2007799f},
-std::array<float,2>{0.537136436f, 0.706571221f},
-std::array<float,2>{0.836592734f, 0.488062352f},
-std::array<float,2>{0.101275802f, 0.79324317f},
-std::array<float,2>{0.238022909f, 0.027256351f},
-std::array<float,2>{0.905822337f, 0.553544223f},
-std::array<float,2>{0.693626225f, 0.259668261f},
-std::array<float,2>{0.411872506f, 0.938926995f},
-std::array<float,2>{0.324822813f, 0.382445157f},
-std::array<float,2>{0.617264092f, 0.864147305f},
-std::array<float,2>{0.807272673f, 0.144652173f},
-std::array<float,2>{0.0518433116f, 0.666461289f},
-std::array<float,2>{0.105958469f, 0.368832529f},
-std::array<float,2>{0.829481184f, 0.932211637f},
-std::array<float,2>{0.545870721f, 0.11932224f},
-std::array<float,2>{0.309756547f, 0.623867035f},
-std::array<float,2>{0.438653469f, 0.248086572f},
-std::array<float,2>{0.651066363f, 0.72388643f},
-std::array<float,2>{0.982893229f, 0.468414813f},
-std::array<float,2>{0.155641124f, 0.766500831f},
-std::array<float,2>{0.00654092152f, 0.179346398f},
-std::array<float,2>{0.753098905f, 0.630047679f},
-std::array<float,2>{0.576765239f, 0.408639878f},
-std::array<float,2>{0.358074635f, 0.834224641f},
-std::array<float,2>{0.377325505f, 0.311423749f},
-std::array<float,2>{0.734879255f, 0.974926233f},
-std::array<float,2>{0.924404263f, 0.0556978844f},
-std::array<float,2>{0.201378629f, 0.52142626f},
-std::array<float,2>{0.163404912f, 0.495412558f},
-std::array<float,2>{0.950342715f, 0.782109201f},
-std::array<float,2>{0.6611076f, 0.191120163f},
-std::array<float,2>{0.473708719f, 0.718539119f},
-std::array<float,2>{0.268191457f, 0.0849002674f},
-std::array<float,2>{0.518592477f, 0.56722331f},
-std::array<float,2>{0.845410883f, 0.322149694f},
-std::array<float,2>{0.0887894481f, 0.88260138f},
-std::array<float,2>{0.138908938f, 0.215347588f},
-std::array<float,2>{0.984482288f, 0.694892108f},
-std::array<float,2>{0.635813713f, 0.469570518f},
-std::array<float,2>{0.463395745f, 0.812459052f},
-std::array<float,2>{0.28512159f, 0.343649387f},
-std::array<float,2>{0.559358299f, 0.896162808f},
-std::array<float,2>{0.815192223f, 0.0733484328f},
-std::array<float,2>{0.111035168f, 0.58493185f},
-std::array<float,2>{0.0338449553f, 0.431200504f},
-std::array<float,2>{0.793814182f, 0.812717319f},
-std::array<float,2>{0.599720359f, 0.166840315f},
-std::array<float,2>{0.342093915f, 0.650109529f},
-std::array<float,2>{0.426885486f, 0.0461335741f},
-std::array<float,2>{0.716365457f, 0.504114628f},
-std::array<float,2>{0.880318642f, 0.293418676f},
-std::array<float,2>{0.219775438f, 0.994608462f},
-std::array<float,2>{0.0628063753f, 0.0938685611f},
-std::array<float,2>{0.867189169f, 0.603119671f},
-std::array<float,2>{0.503902078f, 0.356222063f},
-std::array<float,2>{0.254542768f, 0.921289146f},
-std::array<float,2>{0.497917563f, 0.444408715f},
-std::array<float,2>{0.678514719f, 0.760181785f},
-std::array<float,2>{0.967933536f, 0.223453239f},
-std::array<float,2>{0.175758332f, 0.746904254f},
-std::array<float,2>{0.211355641f, 0.275086015f},
-std::array<float,2>{0.920476973f, 0.962076783f},
-std::array<float,2>{0.733046353f, 0.00653008185f},
-std::array<float,2>{0.401120007f, 0.539350092f},
-std::array<float,2>{0.367106438f, 0.136280626f},
-std::array<float,2>{0.589593768f, 0.684567153f},
-std::array<float,2>{0.773628831f, 0.391291797f},
-std::array<float,2>{0.0269267187f, 0.848408341f},
-std::array<float,2>{0.204313204f, 0.12273819f},
-std::array<float,2>{0.91187501f, 0.617957234f},
-std::array<float,2>{0.725795627f, 0.373662114f},
-std::array<float,2>{0.398203164f, 0.934825778f},
-std::array<float,2>{0.371084601f, 0.464757055f},
-std::array<float,2>{0.58134836f, 0.773008585f},
-std::array<float,2>{0.771001697f, 0.245898455f},
-std::array<float,2>{0.0210052282f, 0.722245872f},
-std::array<float,2>{0.0751748532f, 0.265133798f},
-std::array<float,2>{0.866226554f, 0.943055987f},
-std::array<float,2>{0.511428058f, 0.031177761f},
-std::array<float,2>{0.262519568f, 0.549959302f},
-std::array<float,2>{0.490171552f, 0.144525468f},
-std::array<float,2>{0.686321616f, 0.669999123f},
-std::array<float,2>{0.956540108f, 0.377097934f},
-std::array<float,2>{0.18293722f, 0.862025857f},
-std::array<float,2>{0.0427701697f, 0.193334937f},
-std::array<float,2>{0.78757596f, 0.711456895f},
-std::array<float,2>{0.608631551f, 0.497052491f},
-std::array<float,2>{0.335402369f, 0.785714626f},
-std::array<float,2>{0.436849475f, 0.326569825f},
-std::array<float,2>{0.70672375f, 0.875853658f},
-std::array<float,2>{0.888363302f, 0.0801844522f},
-std::array<float,2>{0.22782892f, 0.566013336f},
-std::array<float,2>{0.130879954f, 0.413524866f},
-std::array<float,2>{0.993803382f, 0.831136882f},
-std::array<float,2>{0.631071746f, 0.17225191f},
-std::array<float,2>{0.458247691f, 0.62718159f},
-std::array<float,2>{0.289337754f, 0.0606246144f},
-std::array<float,2>{0.549207509f, 0.515730619f},
-std::array<float,2>{0.825538635f, 0.30844897f},
-std::array<float,2>{0.121861339f, 0.970448911f},
-std::array<float,2>{0.168449953f, 0.16922076f},
-std::array<float,2>{0.937857509f, 0.654045522f},
-std::array<float,2>{0.664988816f, 0.433914155f},
-std::array<float,2>{0.478499204f, 0.818815768f},
-std::array<float,2>{0.27596274f, 0.29006958f},
-std::array<float,2>{0.525421858f, 0.998565733f},
-std::array<float,2>{0.856385291f, 0.0420514308f},
-std::array<float,2>{0.083001934f, 0.500371099f},
-std::array<float,2>{0.0140394093f, 0.476231426f},
-std::array<float,2>{0.760894597f, 0.805795431f},
-std::array<float,2>{0.570144415f, 0.211348936f},
-std::array<float,2>{0.345776439f, 0.689145327f},
-std::array<float,2>{0.38901931f, 0.0768687353f},
-std::array<float,2>{0.747999251f, 0.582000494f},
-std::array<float,2>{0.930807412f, 0.338197291f},
-std::array<float,2>{0.191038519f, 0.892811477f},
-std::array<float,2>{0.0964428782f, 0.00131964381f},
-std::array<float,2>{0.842589736f, 0.545182705f},
-std::array<float,2>{0.534751475f, 0.27758655f},
-std::array<float,2>{0.300755262f, 0.968513072f},
-std::array<float,2>{0.45082134f, 0.395203829f},
-std::array<float,2>{0.642869532f, 0.846998811f},
-std::array<float,2>{0.970018864f, 0.140541136f},
-std::array<float,2>{0.147251725f, 0.680779099f},
-std::array<float,2>{0.247406304f, 0.353961319f},
-std::array<float,2>{0.898296118f, 0.917903125f},
-std::array<float,2>{0.701715171f, 0.0983972177f},
-std::array<float,2>{0.420736164f, 0.606143773f},
-std::array<float,2>{0.314456642f, 0.222618461f},
-std::array<float,2>{0.616850138f, 0.74397409f},
-std::array<float,2>{0.797293425f, 0.437609613f},
-std::array<float,2>{0.0595108867f, 0.765017092f},
-std::array<float,2>{0.152306095f, 0.035121128f},
-std::array<float,2>{0.978391409f, 0.515297472f},
-std::array<float,2>{0.655301809f, 0.286456019f},
-std::array<float,2>{0.441463798f, 0.991081536f},
-std::array<float,2>{0.305557132f, 0.424239874f},
-std::array<float,2>{0.541635633f, 0.826613367f},
-std::array<float,2>{0.833194196f, 0.162714943f},
-std::array<float,2>{0.101807535f, 0.641157269f},
-std::array<float,2>{0.0507389866f, 0.333340436f},
-std::array<float,2>{0.809078574f, 0.898526847f},
-std::array<float,2>{0.624998629f, 0.0689610764f},
-std::array<float,2>{0.321142375f, 0.593572259f},
-std::array<float,2>{0.40819627f, 0.204922661f},
-std::array<float,2>{0.690364838f, 0.697983921f},
-std::array<float,2>{0.902267575f, 0.478015155f},
-std::array<float,2>{0.24189958f, 0.796972275f},
-std::array<float,2>{0.0925555229f, 0.12864545f},
-std::array<float,2>{0.849246979f, 0.674538493f},
-std::array<float,2>{0.522510529f, 0.405749828f},
-std::array<float,2>{0.273257136f, 0.853461921f},
-std::array<float,2>{0.471342593f, 0.271622121f},
-std::array<float,2>{0.658168018f, 0.955094576f},
-std::array<float,2>{0.945507109f, 0.00988068059f},
-std::array<float,2>{0.159617037f, 0.532273173f},
-std::array<float,2>{0.197403505f, 0.451476514f},
-std::array<float,2>{0.929137468f, 0.754618347f},
-std::array<float,2>{0.741049469f, 0.230400726f},
-std::array<float,2>{0.380750626f, 0.737187624f},
-std::array<float,2>{0.354366392f, 0.107533991f},
-std::array<float,2>{0.57365948f, 0.595254481f},
-std::array<float,2>{0.754376054f, 0.34568736f},
-std::array<float,2>{0.00302251289f, 0.909698129f},
-std::array<float,2>{0.22537604f, 0.234420121f},
-std::array<float,2>{0.875025451f, 0.728710651f},
-std::array<float,2>{0.713174939f, 0.459961772f},
-std::array<float,2>{0.42500788f, 0.781086445f},
-std::array<float,2>{0.336812288f, 0.364159763f},
-std::array<float,2>{0.594454825f, 0.928193808f},
-std::array<float,2>{0.791116834f, 0.115067884f},
-std::array<float,2>{0.0372649245f, 0.612230659f},
-std::array<float,2>{0.115113825f, 0.387647301f},
-std::array<float,2>{0.81894815f, 0.869050503f},
-std::array<float,2>{0.558396518f, 0.155791342f},
-std::array<float,2>{0.288575679f, 0.660156131f},
-std::array<float,2>{0.468140364f, 0.0206904765f},
-std::array<float,2>{0.638778925f, 0.562202573f},
-std::array<float,2>{0.989908576f, 0.251951158f},
-std::array<float,2>{0.133145899f, 0.948871315f},
-std::array<float,2>{0.0309732761f, 0.0910921246f},
-std::array<float,2>{0.778071046f, 0.572552383f},
-std::array<float,2>{0.591744602f, 0.314719319f},
-std::array<float,2>{0.360695302f, 0.883556902f},
-std::array<float,2>{0.404524475f, 0.48924318f},
-std::array<float,2>{0.729376376f, 0.791610956f},
-std::array<float,2>{0.914932311f, 0.199092165f},
-std::array<float,2>{0.21700877f, 0.70895648f},
-std::array<float,2>{0.178061828f, 0.300246745f},
-std::array<float,2>{0.961986184f, 0.980074644f},
-std::array<float,2>{0.67256546f, 0.047248207f},
-std::array<float,2>{0.493895352f, 0.524436951f},
-std::array<float,2>{0.251051784f, 0.18136628f},
-std::array<float,2>{0.507022917f, 0.635602891f},
-std::array<float,2>{0.874292076f, 0.416469485f},
-std::array<float,2>{0.0674218163f, 0.838840306f},
-std::array<float,2>{0.128575608f, 0.101944402f},
-std::array<float,2>{0.999835134f, 0.600701153f},
-std::array<float,2>{0.626741409f, 0.348525554f},
-std::array<float,2>{0.453560203f, 0.912607014f},
-std::array<float,2>{0.293192744f, 0.447824657f},
-std::array<float,2>{0.55301398f, 0.750583589f},
-std::array<float,2>{0.821014106f, 0.230666921f},
-std::array<float,2>{0.119964942f, 0.738514423f},
-std::array<float,2>{0.0439657085f, 0.267586231f},
-std::array<float,2>{0.782096267f, 0.95971787f},
-std::array<float,2>{0.602214158f, 0.0149606643f},
-std::array<float,2>{0.331924081f, 0.53769213f},
-std::array<float,2>{0.433588922f, 0.130399466f},
-std::array<float,2>{0.707081199f, 0.677356243f},
-std::array<float,2>{0.883633733f, 0.398600012f},
-std::array<float,2>{0.231897399f, 0.856390476f},
-std::array<float,2>{0.0711991861f, 0.210130647f},
-std::array<float,2>{0.859575927f, 0.700983882f},
-std::array<float,2>{0.512983322f, 0.482513905f},
-std::array<float,2>{0.258749068f, 0.803013742f},
-std::array<float,2>{0.485592306f, 0.329640985f},
-std::array<float,2>{0.682776392f, 0.904592335f},
-std::array<float,2>{0.95927453f, 0.064483799f},
-std::array<float,2>{0.184641406f, 0.587606072f},
-std::array<float,2>{0.207291335f, 0.425921828f},
-std::array<float,2>{0.908845663f, 0.82168144f},
-std::array<float,2>{0.721652091f, 0.159439743f},
-std::array<float,2>{0.393148512f, 0.646401405f},
-std::array<float,2>{0.373352855f, 0.038329877f},
-std::array<float,2>{0.585633576f, 0.511120498f},
-std::array<float,2>{0.765874267f, 0.28392601f},
-std::array<float,2>{0.0177017413f, 0.985485375f},
-std::array<float,2>{0.243853867f, 0.186418906f},
-std::array<float,2>{0.891700029f, 0.638080657f},
-std::array<float,2>{0.698000669f, 0.419451386f},
-std::array<float,2>{0.416261792f, 0.840614796f},
-std::array<float,2>{0.317585707f, 0.301140249f},
-std::array<float,2>{0.611708701f, 0.981633425f},
-std::array<float,2>{0.804065406f, 0.0537834503f},
-std::array<float,2>{0.0567324869f, 0.527383804f},
-std::array<float,2>{0.0980944112f, 0.485196531f},
-std::array<float,2>{0.839239061f, 0.795980752f},
-std::array<float,2>{0.536316395f, 0.202985093f},
-std::array<float,2>{0.303205132f, 0.704111636f},
-std::array<float,2>{0.447538614f, 0.0860679746f},
-std::array<float,2>{0.645945907f, 0.575717807f},
-std::array<float,2>{0.973808706f, 0.318285227f},
-std::array<float,2>{0.140824094f, 0.888279915f},
-std::array<float,2>{0.0098494105f, 0.0184704103f},
-std::array<float,2>{0.763703465f, 0.554822862f},
-std::array<float,2>{0.56350857f, 0.25590086f},
-std::array<float,2>{0.348653555f, 0.950225353f},
-std::array<float,2>{0.385886818f, 0.38531211f},
-std::array<float,2>{0.743352234f, 0.871615589f},
-std::array<float,2>{0.935791254f, 0.151752725f},
-std::array<float,2>{0.192795932f, 0.660927713f},
-std::array<float,2>{0.166682675f, 0.361568838f},
-std::array<float,2>{0.944458842f, 0.923362672f},
-std::array<float,2>{0.669270992f, 0.113078982f},
-std::array<float,2>{0.481057793f, 0.6159392f},
-std::array<float,2>{0.281089127f, 0.239446327f},
-std::array<float,2>{0.529031932f, 0.73113364f},
-std::array<float,2>{0.851971209f, 0.456657052f},
-std::array<float,2>{0.078284353f, 0.775413394f},
-std::array<float,2>{0.199599281f, 0.0572800785f},
-std::array<float,2>{0.922316492f, 0.522689641f},
-std::array<float,2>{0.737120271f, 0.310378641f},
-std::array<float,2>{0.376725286f, 0.972888827f},
-std::array<float,2>{0.356469452f, 0.407278448f},
-std::array<float,2>{0.574576616f, 0.832292616f},
-std::array<float,2>{0.751231015f, 0.177686423f},
-std::array<float,2>{0.00566748949f, 0.632326782f},
-std::array<float,2>{0.0862095356f, 0.32233578f},
-std::array<float,2>{0.846383333f, 0.879842997f},
-std::array<float,2>{0.51643163f, 0.083829388f},
-std::array<float,2>{0.267192334f, 0.570020556f},
-std::array<float,2>{0.475448936f, 0.189055249f},
-std::array<float,2>{0.663991988f, 0.716472924f},
-std::array<float,2>{0.951180637f, 0.493923634f},
-std::array<float,2>{0.161796272f, 0.78479588f},
-std::array<float,2>{0.0545112118f, 0.147149503f},
-std::array<float,2>{0.805712938f, 0.665041864f},
-std::array<float,2>{0.619732797f, 0.380689085f},
-std::array<float,2>{0.327004284f, 0.865408063f},
-std::array<float,2>{0.412901729f, 0.259851843f},
-std::array<float,2>{0.692370534f, 0.940588772f},
-std::array<float,2>{0.903423846f, 0.0241168942f},
-std::array<float,2>{0.235692933f, 0.552555919f},
-std::array<float,2>{0.154162034f, 0.464849114f},
-std::array<float,2>{0.98125571f, 0.769292831f},
-std::array<float,2>{0.649325013f, 0.246968791f},
-std::array<float,2>{0.440534413f, 0.725185573f},
-std::array<float,2>{0.311891645f, 0.118761033f},
-std::array<float,2>{0.544507205f, 0.621621668f},
-std::array<float,2>{0.831995189f, 0.370634794f},
-std::array<float,2>{0.108739994f, 0.93137908f},
-std::array<float,2>{0.172846109f, 0.225933596f},
-std::array<float,2>{0.966563284f, 0.748641372f},
-std::array<float,2>{0.676601112f, 0.442988276f},
-std::array<float,2>{0.499996454f, 0.759749115f},
-std::array<float,2>{0.256458372f, 0.358356744f},
-std::array<float,2>{0.500731409f, 0.919418931f},
-std::array<float,2>{0.869638383f, 0.0961309746f},
-std::array<float,2>{0.0657956675f, 0.604677856f},
-std::array<float,2>{0.0246414728f, 0.392698199f},
-std::array<float,2>{0.776628494f, 0.850471735f},
-std::array<float,2>{0.586483836f, 0.133568361f},
-std::array<float,2>{0.36452657f, 0.687349081f},
-std::array<float,2>{0.400145173f, 0.0040621045f},
-std::array<float,2>{0.732184649f, 0.541055441f},
-std::array<float,2>{0.919280052f, 0.276023924f},
-std::array<float,2>{0.213231087f, 0.963016152f},
-std::array<float,2>{0.111902513f, 0.0719670057f},
-std::array<float,2>{0.812929869f, 0.582568705f},
-std::array<float,2>{0.562378824f, 0.339894086f},
-std::array<float,2>{0.282239974f, 0.898164511f},
-std::array<float,2>{0.461128265f, 0.471830457f},
-std::array<float,2>{0.633042812f, 0.80975014f},
-std::array<float,2>{0.98667419f, 0.218695283f},
-std::array<float,2>{0.136749655f, 0.693219244f},
-std::array<float,2>{0.220847264f, 0.295827568f},
-std::array<float,2>{0.881488204f, 0.993756115f},
-std::array<float,2>{0.718185067f, 0.0435720384f},
-std::array<float,2>{0.429239303f, 0.506936908f},
-std::array<float,2>{0.341172427f, 0.164921284f},
-std::array<float,2>{0.598572075f, 0.651552498f},
-std::array<float,2>{0.79559958f, 0.431714773f},
-std::array<float,2>{0.0326712243f, 0.815755904f},
-std::array<float,2>{0.230384275f, 0.0798282251f},
-std::array<float,2>{0.890146613f, 0.562871635f},
-std::array<float,2>{0.703696311f, 0.325257689f},
-std::array<float,2>{0.435005665f, 0.878250241f},
-std::array<float,2>{0.332101107f, 0.49931106f},
-std::array<float,2>{0.606292307f, 0.78727293f},
-std::array<float,2>{0.785162985f, 0.193808332f},
-std::array<float,2>{0.0390651301f, 0.714713573f},
-std::array<float,2>{0.123526417f, 0.306292236f},
-std::array<float,2>{0.82775408f, 0.971079528f},
-std::array<float,2>{0.547039926f, 0.0603005178f},
-std::array<float,2>{0.291661292f, 0.517620921f},
-std::array<float,2>{0.459290892f, 0.175454825f},
-std::array<float,2>{0.630752981f, 0.626509607f},
-std::array<float,2>{0.995155573f, 0.411451042f},
-std::array<float,2>{0.129216462f, 0.828267872f},
-std::array<float,2>{0.0232853498f, 0.242823303f},
-std::array<float,2>{0.773346424f, 0.720254958f},
-std::array<float,2>{0.579586089f, 0.461623311f},
-std::array<float,2>{0.368548125f, 0.769621134f},
-std::array<float,2>{0.396384329f, 0.371559829f},
-std::array<float,2>{0.723998964f, 0.937395453f},
-std::array<float,2>{0.913980484f, 0.123267241f},
-std::array<float,2>{0.205166847f, 0.620821238f},
-std::array<float,2>{0.180471718f, 0.376476675f},
-std::array<float,2>{0.953772664f, 0.861285865f},
-std::array<float,2>{0.683628082f, 0.142423078f},
-std::array<float,2>{0.49164933f, 0.669141829f},
-std::array<float,2>{0.264893502f, 0.0283630565f},
-std::array<float,2>{0.508976102f, 0.547026277f},
-std::array<float,2>{0.864767909f, 0.262643635f},
-std::array<float,2>{0.0770490542f, 0.944244862f},
-std::array<float,2>{0.145436198f, 0.137277648f},
-std::array<float,2>{0.971957624f, 0.682198346f},
-std::array<float,2>{0.641587734f, 0.396928191f},
-std::array<float,2>{0.452786356f, 0.845241427f},
-std::array<float,2>{0.296903819f, 0.280228347f},
-std::array<float,2>{0.532421947f, 0.966774821f},
-std::array<float,2>{0.840256333f, 0.00311874878f},
-std::array<float,2>{0.0950809047f, 0.543308139f},
-std::array<float,2>{0.062174622f, 0.441114873f},
-std::array<float,2>{0.800053537f, 0.762022138f},
-std::array<float,2>{0.613739967f, 0.218839943f},
-std::array<float,2>{0.313413173f, 0.744683444f},
-std::array<float,2>{0.419106483f, 0.101488248f},
-std::array<float,2>{0.699687958f, 0.608725727f},
-std::array<float,2>{0.896476626f, 0.353356659f},
-std::array<float,2>{0.248798966f, 0.914662361f},
-std::array<float,2>{0.0845803991f, 0.0401758328f},
-std::array<float,2>{0.85745424f, 0.502140045f},
-std::array<float,2>{0.524773598f, 0.291572005f},
-std::array<float,2>{0.275183707f, 0.997357249f},
-std::array<float,2>{0.47909829f, 0.435625911f},
-std::array<float,2>{0.666653752f, 0.818025529f},
-std::array<float,2>{0.941025078f, 0.170643002f},
-std::array<float,2>{0.171495989f, 0.655905008f},
-std::array<float,2>{0.187572986f, 0.336294562f},
-std::array<float,2>{0.932672739f, 0.890723348f},
-std::array<float,2>{0.748832047f, 0.0749335513f},
-std::array<float,2>{0.386918217f, 0.579308033f},
-std::array<float,2>{0.345500022f, 0.213587597f},
-std::array<float,2>{0.567468107f, 0.691239655f},
-std::array<float,2>{0.759302199f, 0.474394858f},
-std::array<float,2>{0.0124460524f, 0.807913661f},
-std::array<float,2>{0.157022193f, 0.00848093256f},
-std::array<float,2>{0.948626339f, 0.533554494f},
-std::array<float,2>{0.65859884f, 0.271297067f},
-std::array<float,2>{0.469336748f, 0.954447687f},
-std::array<float,2>{0.27082935f, 0.404083997f},
-std::array<float,2>{0.521057665f, 0.85416925f},
-std::array<float,2>{0.851171792f, 0.12565811f},
-std::array<float,2>{0.0916202217f, 0.671910524f},
-std::array<float,2>{0.00128534203f, 0.346236676f},
-std::array<float,2>{0.756409347f, 0.908024549f},
-std::array<float,2>{0.571476758f, 0.106648557f},
-std::array<float,2>{0.352877647f, 0.597482562f},
-std::array<float,2>{0.382807851f, 0.22750479f},
-std::array<float,2>{0.738421619f, 0.735361159f},
-std::array<float,2>{0.926149845f, 0.450836331f},
-std::array<float,2>{0.196358994f, 0.756655157f},
-std::array<float,2>{0.10358163f, 0.160531998f},
-std::array<float,2>{0.835469365f, 0.644482791f},
-std::array<float,2>{0.540067136f, 0.423821568f},
-std::array<float,2>{0.307210654f, 0.825723588f},
-std::array<float,2>{0.44503805f, 0.288102955f},
-std::array<float,2>{0.652796626f, 0.989590406f},
-std::array<float,2>{0.979277074f, 0.0317238458f},
-std::array<float,2>{0.149906486f, 0.511938632f},
-std::array<float,2>{0.238668218f, 0.479006082f},
-std::array<float,2>{0.898760319f, 0.799662352f},
-std::array<float,2>{0.687583625f, 0.205578715f},
-std::array<float,2>{0.408422917f, 0.696564972f},
-std::array<float,2>{0.323598534f, 0.0674135014f},
-std::array<float,2>{0.622484744f, 0.591378987f},
-std::array<float,2>{0.812004507f, 0.335332841f},
-std::array<float,2>{0.0473323762f, 0.900811911f},
-std::array<float,2>{0.215030894f, 0.195669129f},
-std::array<float,2>{0.917436659f, 0.710447252f},
-std::array<float,2>{0.727819979f, 0.491664231f},
-std::array<float,2>{0.403538823f, 0.789362192f},
-std::array<float,2>{0.361664236f, 0.312700033f},
-std::array<float,2>{0.592853844f, 0.886152685f},
-std::array<float,2>{0.78072542f, 0.0930366293f},
-std::array<float,2>{0.027613841f, 0.571836412f},
-std::array<float,2>{0.0701647624f, 0.415105909f},
-std::array<float,2>{0.8727808f, 0.837139547f},
-std::array<float,2>{0.505421162f, 0.182122648f},
-std::array<float,2>{0.252739519f, 0.632918298f},
-std::array<float,2>{0.495126367f, 0.0507706627f},
-std::array<float,2>{0.674126327f, 0.525615811f},
-std::array<float,2>{0.963776231f, 0.298483253f},
-std::array<float,2>{0.176805839f, 0.976635695f},
-std::array<float,2>{0.0368042476f, 0.115530968f},
-std::array<float,2>{0.790669084f, 0.609392822f},
-std::array<float,2>{0.596397161f, 0.365479231f},
-std::array<float,2>{0.338631839f, 0.927419901f},
-std::array<float,2>{0.423436671f, 0.457952291f},
-std::array<float,2>{0.711264253f, 0.779044032f},
-std::array<float,2>{0.877989709f, 0.236586034f},
-std::array<float,2>{0.223899335f, 0.728151858f},
-std::array<float,2>{0.136123896f, 0.252736628f},
-std::array<float,2>{0.991372824f, 0.946576059f},
-std::array<float,2>{0.637047827f, 0.02315256f},
-std::array<float,2>{0.465884149f, 0.558746099f},
-std::array<float,2>{0.285243332f, 0.153700128f},
-std::array<float,2>{0.555520296f, 0.657031178f},
-std::array<float,2>{0.818346739f, 0.390183866f},
-std::array<float,2>{0.11664734f, 0.869592249f},
-std::array<float,2>{0.137226298f, 0.0740540475f},
-std::array<float,2>{0.987061143f, 0.584449768f},
-std::array<float,2>{0.633628666f, 0.343036711f},
-std::array<float,2>{0.461478651f, 0.895672858f},
-std::array<float,2>{0.282849461f, 0.468784571f},
-std::array<float,2>{0.562008262f, 0.811960459f},
-std::array<float,2>{0.813123405f, 0.215154573f},
-std::array<float,2>{0.111429811f, 0.694339275f},
-std::array<float,2>{0.0329346769f, 0.293884248f},
-std::array<float,2>{0.795392573f, 0.994874299f},
-std::array<float,2>{0.597661376f, 0.0465727709f},
-std::array<float,2>{0.341516346f, 0.504398525f},
-std::array<float,2>{0.429124802f, 0.166262314f},
-std::array<float,2>{0.718351185f, 0.649821818f},
-std::array<float,2>{0.880993366f, 0.431043267f},
-std::array<float,2>{0.221467122f, 0.813038945f},
-std::array<float,2>{0.0663368553f, 0.222686842f},
-std::array<float,2>{0.869270027f, 0.746106863f},
-std::array<float,2>{0.500005066f, 0.444932014f},
-std::array<float,2>{0.256143451f, 0.760492444f},
-std::array<float,2>{0.499439687f, 0.355945766f},
-std::array<float,2>{0.675996602f, 0.921583474f},
-std::array<float,2>{0.966069698f, 0.0943122506f},
-std::array<float,2>{0.172271505f, 0.60286665f},
-std::array<float,2>{0.21385783f, 0.390912354f},
-std::array<float,2>{0.919553399f, 0.848055243f},
-std::array<float,2>{0.731929362f, 0.135917544f},
-std::array<float,2>{0.399757296f, 0.684067249f},
-std::array<float,2>{0.364902496f, 0.00602197787f},
-std::array<float,2>{0.586290002f, 0.539835691f},
-std::array<float,2>{0.777286291f, 0.27473256f},
-std::array<float,2>{0.0249920376f, 0.962604821f},
-std::array<float,2>{0.235855237f, 0.145365253f},
-std::array<float,2>{0.903812766f, 0.666959524f},
-std::array<float,2>{0.691469908f, 0.381965578f},
-std::array<float,2>{0.412315041f, 0.863520563f},
-std::array<float,2>{0.326379657f, 0.25926578f},
-std::array<float,2>{0.619418502f, 0.939276278f},
-std::array<float,2>{0.806154966f, 0.0265245419f},
-std::array<float,2>{0.0539498962f, 0.553122699f},
-std::array<float,2>{0.109179191f, 0.468040556f},
-std::array<float,2>{0.831128895f, 0.766004503f},
-std::array<float,2>{0.544175029f, 0.248968795f},
-std::array<float,2>{0.312433302f, 0.724409521f},
-std::array<float,2>{0.441034764f, 0.119951986f},
-std::array<float,2>{0.648753881f, 0.623413146f},
-std::array<float,2>{0.980943203f, 0.36863026f},
-std::array<float,2>{0.153557271f, 0.931949437f},
-std::array<float,2>{0.00500946352f, 0.0564351305f},
-std::array<float,2>{0.751926005f, 0.520514846f},
-std::array<float,2>{0.575066805f, 0.310908169f},
-std::array<float,2>{0.357275933f, 0.975433886f},
-std::array<float,2>{0.376342952f, 0.408831149f},
-std::array<float,2>{0.73637259f, 0.834793329f},
-std::array<float,2>{0.922633946f, 0.178829655f},
-std::array<float,2>{0.200156763f, 0.630517483f},
-std::array<float,2>{0.161179274f, 0.321509868f},
-std::array<float,2>{0.952022135f, 0.882060826f},
-std::array<float,2>{0.663147271f, 0.0844008029f},
-std::array<float,2>{0.47478348f, 0.566869795f},
-std::array<float,2>{0.267028064f, 0.190747857f},
-std::array<float,2>{0.515684783f, 0.718047798f},
-std::array<float,2>{0.84577024f, 0.496026129f},
-std::array<float,2>{0.0865522996f, 0.781548679f},
-std::array<float,2>{0.193055272f, 0.0166089665f},
-std::array<float,2>{0.936218679f, 0.556764185f},
-std::array<float,2>{0.743821979f, 0.255499184f},
-std::array<float,2>{0.386671245f, 0.951378465f},
-std::array<float,2>{0.349456638f, 0.383462101f},
-std::array<float,2>{0.564334095f, 0.87462616f},
-std::array<float,2>{0.764558733f, 0.149384841f},
-std::array<float,2>{0.010276204f, 0.663327456f},
-std::array<float,2>{0.078773357f, 0.360812604f},
-std::array<float,2>{0.852345049f, 0.923892558f},
-std::array<float,2>{0.528490305f, 0.109592594f},
-std::array<float,2>{0.280730754f, 0.614287257f},
-std::array<float,2>{0.480474144f, 0.242144972f},
-std::array<float,2>{0.669740438f, 0.733347118f},
-std::array<float,2>{0.94530791f, 0.453369886f},
-std::array<float,2>{0.166064411f, 0.773655653f},
-std::array<float,2>{0.057343971f, 0.184901685f},
-std::array<float,2>{0.80460608f, 0.638742626f},
-std::array<float,2>{0.612139821f, 0.42052108f},
-std::array<float,2>{0.318041295f, 0.842809737f},
-std::array<float,2>{0.416797638f, 0.304323912f},
-std::array<float,2>{0.697480261f, 0.982559264f},
-std::array<float,2>{0.892115831f, 0.0509815402f},
-std::array<float,2>{0.243287951f, 0.530289769f},
-std::array<float,2>{0.14147529f, 0.487736046f},
-std::array<float,2>{0.974134743f, 0.793634355f},
-std::array<float,2>{0.646293104f, 0.200513005f},
-std::array<float,2>{0.448194146f, 0.706216216f},
-std::array<float,2>{0.303709179f, 0.088087514f},
-std::array<float,2>{0.536738455f, 0.576677978f},
-std::array<float,2>{0.839694381f, 0.318816572f},
-std::array<float,2>{0.0984808952f, 0.890182137f},
-std::array<float,2>{0.185207874f, 0.207865283f},
-std::array<float,2>{0.959657311f, 0.702653825f},
-std::array<float,2>{0.68351233f, 0.481367767f},
-std::array<float,2>{0.485904902f, 0.802084267f},
-std::array<float,2>{0.258278549f, 0.331250608f},
-std::array<float,2>{0.513664305f, 0.903953791f},
-std::array<float,2>{0.860049665f, 0.064070873f},
-std::array<float,2>{0.0706719905f, 0.588102877f},
-std::array<float,2>{0.018504126f, 0.428536266f},
-std::array<float,2>{0.766175091f, 0.822465241f},
-std::array<float,2>{0.585047424f, 0.156893045f},
-std::array<float,2>{0.373925507f, 0.647695303f},
-std::array<float,2>{0.392671287f, 0.0365474001f},
-std::array<float,2>{0.721029401f, 0.508421481f},
-std::array<float,2>{0.908458352f, 0.283182204f},
-std::array<float,2>{0.207972825f, 0.987172723f},
-std::array<float,2>{0.119621389f, 0.103537321f},
-std::array<float,2>{0.820596397f, 0.597829878f},
-std::array<float,2>{0.553335249f, 0.351212382f},
-std::array<float,2>{0.293807477f, 0.910242379f},
-std::array<float,2>{0.453692526f, 0.446694016f},
-std::array<float,2>{0.626036763f, 0.751971006f},
-std::array<float,2>{0.999255657f, 0.234287322f},
-std::array<float,2>{0.128303155f, 0.741480052f},
-std::array<float,2>{0.231972858f, 0.266782403f},
-std::array<float,2>{0.883128226f, 0.957253218f},
-std::array<float,2>{0.707861781f, 0.0119404625f},
-std::array<float,2>{0.432756037f, 0.536691248f},
-std::array<float,2>{0.331196904f, 0.131801993f},
-std::array<float,2>{0.601884484f, 0.67873776f},
-std::array<float,2>{0.781493306f, 0.400562257f},
-std::array<float,2>{0.0445122421f, 0.859283864f},
-std::array<float,2>{0.224526942f, 0.114668988f},
-std::array<float,2>{0.878674507f, 0.611724019f},
-std::array<float,2>{0.711462498f, 0.363383979f},
-std::array<float,2>{0.422895759f, 0.92833358f},
-std::array<float,2>{0.338305026f, 0.460589767f},
-std::array<float,2>{0.595860839f, 0.780537248f},
-std::array<float,2>{0.790468335f, 0.234909669f},
-std::array<float,2>{0.0364297107f, 0.729017854f},
-std::array<float,2>{0.117099062f, 0.251013905f},
-std::array<float,2>{0.817404866f, 0.948262215f},
-std::array<float,2>{0.555111885f, 0.0212647449f},
-std::array<float,2>{0.286037654f, 0.561690569f},
-std::array<float,2>{0.466402471f, 0.155726597f},
-std::array<float,2>{0.637644827f, 0.659528732f},
-std::array<float,2>{0.992109656f, 0.387099266f},
-std::array<float,2>{0.136280045f, 0.868471503f},
-std::array<float,2>{0.0281396694f, 0.198321804f},
-std::array<float,2>{0.781065047f, 0.708433867f},
-std::array<float,2>{0.59357208f, 0.488662064f},
-std::array<float,2>{0.362209707f, 0.791330755f},
-std::array<float,2>{0.403825521f, 0.315162838f},
-std::array<float,2>{0.728390098f, 0.883167684f},
-std::array<float,2>{0.917651355f, 0.0914310515f},
-std::array<float,2>{0.215636283f, 0.572936356f},
-std::array<float,2>{0.177583814f, 0.416510224f},
-std::array<float,2>{0.963109374f, 0.838311017f},
-std::array<float,2>{0.674641848f, 0.181016594f},
-std::array<float,2>{0.496014267f, 0.635238826f},
-std::array<float,2>{0.252100497f, 0.0477008671f},
-std::array<float,2>{0.505364537f, 0.525142312f},
-std::array<float,2>{0.872433424f, 0.300466478f},
-std::array<float,2>{0.0695218444f, 0.979573607f},
-std::array<float,2>{0.149457633f, 0.162248135f},
-std::array<float,2>{0.978886366f, 0.641077101f},
-std::array<float,2>{0.653288126f, 0.424597174f},
-std::array<float,2>{0.444592059f, 0.82700491f},
-std::array<float,2>{0.30708012f, 0.286874592f},
-std::array<float,2>{0.540545464f, 0.990353525f},
-std::array<float,2>{0.835114539f, 0.0341857187f},
-std::array<float,2>{0.104257368f, 0.515028596f},
-std::array<float,2>{0.0475231744f, 0.478111982f},
-std::array<float,2>{0.81201905f, 0.797526002f},
-std::array<float,2>{0.622595489f, 0.204146162f},
-std::array<float,2>{0.323782325f, 0.697636068f},
-std::array<float,2>{0.409061074f, 0.0683760121f},
-std::array<float,2>{0.68842864f, 0.593231499f},
-std::array<float,2>{0.8991763f, 0.333700448f},
-std::array<float,2>{0.238824695f, 0.899113834f},
-std::array<float,2>{0.0910201222f, 0.0102792559f},
-std::array<float,2>{0.85078764f, 0.53308475f},
-std::array<float,2>{0.520869851f, 0.272445917f},
-std::array<float,2>{0.271416664f, 0.955834091f},
-std::array<float,2>{0.468954712f, 0.405924618f},
-std::array<float,2>{0.658705771f, 0.852628291f},
-std::array<float,2>{0.948834062f, 0.128079623f},
-std::array<float,2>{0.156677753f, 0.673895299f},
-std::array<float,2>{0.197066441f, 0.345197886f},
-std::array<float,2>{0.92644757f, 0.909569561f},
-std::array<float,2>{0.738775373f, 0.108223423f},
-std::array<float,2>{0.382161528f, 0.595058501f},
-std::array<float,2>{0.35312897f, 0.229824737f},
-std::array<float,2>{0.571786821f, 0.736699581f},
-std::array<float,2>{0.756113291f, 0.451940626f},
-std::array<float,2>{0.00147805642f, 0.753983915f},
-std::array<float,2>{0.171128452f, 0.0429062396f},
-std::array<float,2>{0.940736532f, 0.500924468f},
-std::array<float,2>{0.666260064f, 0.290797502f},
-std::array<float,2>{0.47881493f, 0.99824971f},
-std::array<float,2>{0.274574071f, 0.434168726f},
-std::array<float,2>{0.525201857f, 0.81909436f},
-std::array<float,2>{0.858085334f, 0.169813126f},
-std::array<float,2>{0.0843458623f, 0.653373539f},
-std::array<float,2>{0.0121661341f, 0.338501722f},
-std::array<float,2>{0.758928955f, 0.893483758f},
-std::array<float,2>{0.568233728f, 0.0763388425f},
-std::array<float,2>{0.344837725f, 0.581383765f},
-std::array<float,2>{0.38752073f, 0.211523071f},
-std::array<float,2>{0.748340964f, 0.688881695f},
-std::array<float,2>{0.93348825f, 0.47589007f},
-std::array<float,2>{0.188213006f, 0.806308091f},
-std::array<float,2>{0.0953127816f, 0.139920503f},
-std::array<float,2>{0.840447843f, 0.681268215f},
-std::array<float,2>{0.532940686f, 0.394988596f},
-std::array<float,2>{0.297603518f, 0.84750849f},
-std::array<float,2>{0.452301651f, 0.278196692f},
-std::array<float,2>{0.640998423f, 0.968078256f},
-std::array<float,2>{0.97260958f, 0.00174754125f},
-std::array<float,2>{0.144702494f, 0.545533538f},
-std::array<float,2>{0.248100907f, 0.438054442f},
-std::array<float,2>{0.895751834f, 0.765358627f},
-std::array<float,2>{0.700138032f, 0.221829459f},
-std::array<float,2>{0.419594735f, 0.743243098f},
-std::array<float,2>{0.312865466f, 0.0977613628f},
-std::array<float,2>{0.613945782f, 0.605935156f},
-std::array<float,2>{0.800685823f, 0.354461223f},
-std::array<float,2>{0.0616835244f, 0.917062759f},
-std::array<float,2>{0.205873728f, 0.245326772f},
-std::array<float,2>{0.913373291f, 0.72207123f},
-std::array<float,2>{0.724499345f, 0.464127809f},
-std::array<float,2>{0.39588359f, 0.772570491f},
-std::array<float,2>{0.368800581f, 0.373099804f},
-std::array<float,2>{0.579823732f, 0.935427129f},
-std::array<float,2>{0.772744f, 0.12255577f},
-std::array<float,2>{0.0226520393f, 0.617544055f},
-std::array<float,2>{0.0765935034f, 0.377593458f},
-std::array<float,2>{0.864587486f, 0.861726463f},
-std::array<float,2>{0.509292901f, 0.143722907f},
-std::array<float,2>{0.265347809f, 0.67051816f},
-std::array<float,2>{0.491846025f, 0.0303822327f},
-std::array<float,2>{0.684230506f, 0.550650299f},
-std::array<float,2>{0.953511834f, 0.265346795f},
-std::array<float,2>{0.180025622f, 0.942831397f},
-std::array<float,2>{0.0396725424f, 0.080912821f},
-std::array<float,2>{0.785882115f, 0.565727055f},
-std::array<float,2>{0.605939209f, 0.326894999f},
-std::array<float,2>{0.332894981f, 0.875053704f},
-std::array<float,2>{0.43538481f, 0.496575952f},
-std::array<float,2>{0.703277111f, 0.785633504f},
-std::array<float,2>{0.889941931f, 0.192419246f},
-std::array<float,2>{0.22953032f, 0.710945904f},
-std::array<float,2>{0.12973924f, 0.30788067f},
-std::array<float,2>{0.995941818f, 0.970120311f},
-std::array<float,2>{0.630037904f, 0.0615016297f},
-std::array<float,2>{0.459681541f, 0.516288221f},
-std::array<float,2>{0.291025072f, 0.172376066f},
-std::array<float,2>{0.547565103f, 0.627700329f},
-std::array<float,2>{0.827453792f, 0.413931608f},
-std::array<float,2>{0.123727404f, 0.831755459f},
-std::array<float,2>{0.174821034f, 0.0964513794f},
-std::array<float,2>{0.96845752f, 0.605351269f},
-std::array<float,2>{0.677777469f, 0.357452631f},
-std::array<float,2>{0.497094661f, 0.919910967f},
-std::array<float,2>{0.254305035f, 0.442777097f},
-std::array<float,2>{0.50339365f, 0.759116411f},
-std::array<float,2>{0.86779964f, 0.226078033f},
-std::array<float,2>{0.0631604269f, 0.748364747f},
-std::array<float,2>{0.0266378988f, 0.275438517f},
-std::array<float,2>{0.774403811f, 0.963855922f},
-std::array<float,2>{0.589342117f, 0.00458121859f},
-std::array<float,2>{0.36638993f, 0.541669488f},
-std::array<float,2>{0.400711089f, 0.132838398f},
-std::array<float,2>{0.732484579f, 0.68694967f},
-std::array<float,2>{0.920342922f, 0.393403381f},
-std::array<float,2>{0.21155943f, 0.849710882f},
-std::array<float,2>{0.110398732f, 0.218070552f},
-std::array<float,2>{0.814766884f, 0.692692339f},
-std::array<float,2>{0.559046507f, 0.472309828f},
-std::array<float,2>{0.284632355f, 0.81053859f},
-std::array<float,2>{0.463055402f, 0.340581328f},
-std::array<float,2>{0.636629403f, 0.897641063f},
-std::array<float,2>{0.98516345f, 0.0717106014f},
-std::array<float,2>{0.139595181f, 0.582417965f},
-std::array<float,2>{0.220684752f, 0.432490557f},
-std::array<float,2>{0.880602896f, 0.816202044f},
-std::array<float,2>{0.715854287f, 0.164426044f},
-std::array<float,2>{0.427671254f, 0.652014792f},
-std::array<float,2>{0.342667282f, 0.0434345379f},
-std::array<float,2>{0.600335002f, 0.507494271f},
-std::array<float,2>{0.793042839f, 0.295299053f},
-std::array<float,2>{0.0334759317f, 0.993613422f},
-std::array<float,2>{0.201834857f, 0.17698051f},
-std::array<float,2>{0.924265921f, 0.632083833f},
-std::array<float,2>{0.734862506f, 0.408143133f},
-std::array<float,2>{0.377744406f, 0.83259809f},
-std::array<float,2>{0.357483178f, 0.309939057f},
-std::array<float,2>{0.576388657f, 0.973312676f},
-std::array<float,2>{0.753503799f, 0.0568255037f},
-std::array<float,2>{0.00588935753f, 0.523330152f},
-std::array<float,2>{0.0883231238f, 0.493526042f},
-std::array<float,2>{0.8448928f, 0.784387529f},
-std::array<float,2>{0.519312084f, 0.188729838f},
-std::array<float,2>{0.267846644f, 0.715849519f},
-std::array<float,2>{0.474532962f, 0.0834250972f},
-std::array<float,2>{0.660182118f, 0.56954205f},
-std::array<float,2>{0.950966239f, 0.322833627f},
-std::array<float,2>{0.164052367f, 0.879246891f},
-std::array<float,2>{0.0524006225f, 0.0234874934f},
-std::array<float,2>{0.806947649f, 0.551818013f},
-std::array<float,2>{0.617716193f, 0.260319173f},
-std::array<float,2>{0.324337035f, 0.941222608f},
-std::array<float,2>{0.411596328f, 0.380324394f},
-std::array<float,2>{0.694311619f, 0.866036534f},
-std::array<float,2>{0.905529439f, 0.146736443f},
-std::array<float,2>{0.23776257f, 0.665692568f},
-std::array<float,2>{0.156181231f, 0.370572835f},
-std::array<float,2>{0.983169317f, 0.930682421f},
-std::array<float,2>{0.650843263f, 0.118639864f},
-std::array<float,2>{0.438997418f, 0.621174216f},
-std::array<float,2>{0.310179979f, 0.246259272f},
-std::array<float,2>{0.545205653f, 0.724837959f},
-std::array<float,2>{0.82999593f, 0.465406954f},
-std::array<float,2>{0.105776154f, 0.768789053f},
-std::array<float,2>{0.245928228f, 0.0546461791f},
-std::array<float,2>{0.894219279f, 0.527923644f},
-std::array<float,2>{0.696966648f, 0.301731706f},
-std::array<float,2>{0.414982557f, 0.982274592f},
-std::array<float,2>{0.319536805f, 0.418960422f},
-std::array<float,2>{0.610615015f, 0.840133309f},
-std::array<float,2>{0.801142275f, 0.18589288f},
-std::array<float,2>{0.0561574586f, 0.638561964f},
-std::array<float,2>{0.100643031f, 0.317575634f},
-std::array<float,2>{0.836100221f, 0.88776195f},
-std::array<float,2>{0.537798762f, 0.0864780992f},
-std::array<float,2>{0.302119881f, 0.575396359f},
-std::array<float,2>{0.446032166f, 0.202225775f},
-std::array<float,2>{0.647281229f, 0.704669178f},
-std::array<float,2>{0.974678218f, 0.48486197f},
-std::array<float,2>{0.142765462f, 0.796644151f},
-std::array<float,2>{0.00960715208f, 0.152097762f},
-std::array<float,2>{0.76350981f, 0.66062516f},
-std::array<float,2>{0.56570971f, 0.384834617f},
-std::array<float,2>{0.351361871f, 0.871098995f},
-std::array<float,2>{0.383130103f, 0.256794333f},
-std::array<float,2>{0.7451756f, 0.950703025f},
-std::array<float,2>{0.935429633f, 0.0176049471f},
-std::array<float,2>{0.194419146f, 0.55524534f},
-std::array<float,2>{0.164516449f, 0.456353009f},
-std::array<float,2>{0.942519665f, 0.776293874f},
-std::array<float,2>{0.671432853f, 0.239796981f},
-std::array<float,2>{0.483050972f, 0.73050046f},
-std::array<float,2>{0.278555483f, 0.112392172f},
-std::array<float,2>{0.529608905f, 0.615692139f},
-std::array<float,2>{0.854480803f, 0.361909419f},
-std::array<float,2>{0.0804605782f, 0.922981441f},
-std::array<float,2>{0.125708103f, 0.231160194f},
-std::array<float,2>{0.996442437f, 0.739206433f},
-std::array<float,2>{0.627597094f, 0.44747287f},
-std::array<float,2>{0.456551999f, 0.750264227f},
-std::array<float,2>{0.295937896f, 0.348011404f},
-std::array<float,2>{0.552542746f, 0.912383497f},
-std::array<float,2>{0.824056327f, 0.102358758f},
-std::array<float,2>{0.118973836f, 0.60128057f},
-std::array<float,2>{0.0459441319f, 0.39928019f},
-std::array<float,2>{0.784348726f, 0.855950117f},
-std::array<float,2>{0.603744984f, 0.130165026f},
-std::array<float,2>{0.329044431f, 0.676969767f},
-std::array<float,2>{0.430487871f, 0.0152701344f},
-std::array<float,2>{0.709847271f, 0.53757602f},
-std::array<float,2>{0.886534333f, 0.268274724f},
-std::array<float,2>{0.23296462f, 0.95906198f},
-std::array<float,2>{0.0734073445f, 0.0652257502f},
-std::array<float,2>{0.861964285f, 0.587209225f},
-std::array<float,2>{0.514197171f, 0.329354316f},
-std::array<float,2>{0.260300249f, 0.904877067f},
-std::array<float,2>{0.486555308f, 0.483388782f},
-std::array<float,2>{0.681146681f, 0.803368628f},
-std::array<float,2>{0.958784401f, 0.210820675f},
-std::array<float,2>{0.187377766f, 0.700224817f},
-std::array<float,2>{0.209920168f, 0.283367306f},
-std::array<float,2>{0.90788722f, 0.986267209f},
-std::array<float,2>{0.720481813f, 0.0385850146f},
-std::array<float,2>{0.391187549f, 0.511299491f},
-std::array<float,2>{0.372986495f, 0.159866363f},
-std::array<float,2>{0.582839787f, 0.645919979f},
-std::array<float,2>{0.767626286f, 0.426375002f},
-std::array<float,2>{0.0162514374f, 0.822002292f},
-std::array<float,2>{0.217527494f, 0.093573086f},
-std::array<float,2>{0.914122105f, 0.571681559f},
-std::array<float,2>{0.728687584f, 0.313104421f},
-std::array<float,2>{0.405220628f, 0.886425197f},
-std::array<float,2>{0.361164778f, 0.491738856f},
-std::array<float,2>{0.591073573f, 0.789719522f},
-std::array<float,2>{0.777781904f, 0.195872843f},
-std::array<float,2>{0.0306533203f, 0.710748792f},
-std::array<float,2>{0.0679930449f, 0.298229426f},
-std::array<float,2>{0.874617755f, 0.977327526f},
-std::array<float,2>{0.507802725f, 0.0502195098f},
-std::array<float,2>{0.251592368f, 0.525927067f},
-std::array<float,2>{0.493207276f, 0.182309926f},
-std::array<float,2>{0.671894848f, 0.63334626f},
-std::array<float,2>{0.962889373f, 0.415907145f},
-std::array<float,2>{0.178525895f, 0.837671638f},
-std::array<float,2>{0.0378842242f, 0.237209901f},
-std::array<float,2>{0.791578412f, 0.727951586f},
-std::array<float,2>{0.593793631f, 0.457125992f},
-std::array<float,2>{0.336145222f, 0.778454721f},
-std::array<float,2>{0.425384164f, 0.365778416f},
-std::array<float,2>{0.713665605f, 0.927209139f},
-std::array<float,2>{0.875501871f, 0.115843192f},
-std::array<float,2>{0.224994093f, 0.609906971f},
-std::array<float,2>{0.133689225f, 0.389733404f},
-std::array<float,2>{0.989418507f, 0.869729459f},
-std::array<float,2>{0.639557362f, 0.153884053f},
-std::array<float,2>{0.468638569f, 0.656474888f},
-std::array<float,2>{0.288367867f, 0.0228909962f},
-std::array<float,2>{0.557804048f, 0.559117734f},
-std::array<float,2>{0.818681717f, 0.252265722f},
-std::array<float,2>{0.114359096f, 0.947106361f},
-std::array<float,2>{0.159947217f, 0.125016972f},
-std::array<float,2>{0.946061671f, 0.672420204f},
-std::array<float,2>{0.657694101f, 0.403808028f},
-std::array<float,2>{0.471169293f, 0.853930295f},
-std::array<float,2>{0.27281484f, 0.270923078f},
-std::array<float,2>{0.523275912f, 0.954972982f},
-std::array<float,2>{0.848798037f, 0.00802418869f},
-std::array<float,2>{0.092034027f, 0.534127533f},
-std::array<float,2>{0.00349130481f, 0.450581223f},
-std::array<float,2>{0.754880548f, 0.756266117f},
-std::array<float,2>{0.573766947f, 0.227004781f},
-std::array<float,2>{0.353562981f, 0.736166537f},
-std::array<float,2>{0.380065799f, 0.107131533f},
-std::array<float,2>{0.740536392f, 0.597098589f},
-std::array<float,2>{0.929387152f, 0.345951855f},
-std::array<float,2>{0.197975591f, 0.907624722f},
-std::array<float,2>{0.102341309f, 0.0319651812f},
-std::array<float,2>{0.833846211f, 0.512399495f},
-std::array<float,2>{0.541160524f, 0.288635552f},
-std::array<float,2>{0.305126041f, 0.990050197f},
-std::array<float,2>{0.44195357f, 0.422873557f},
-std::array<float,2>{0.655826449f, 0.825296402f},
-std::array<float,2>{0.977763057f, 0.160733953f},
-std::array<float,2>{0.151666805f, 0.643637955f},
-std::array<float,2>{0.241379425f, 0.33553645f},
-std::array<float,2>{0.901652932f, 0.901314855f},
-std::array<float,2>{0.689933002f, 0.0682485998f},
-std::array<float,2>{0.40728724f, 0.591053784f},
-std::array<float,2>{0.320438057f, 0.205194131f},
-std::array<float,2>{0.624113381f, 0.696867049f},
-std::array<float,2>{0.809093535f, 0.47866562f},
-std::array<float,2>{0.0501456335f, 0.798926175f},
-std::array<float,2>{0.146749571f, 0.00375075499f},
-std::array<float,2>{0.970338225f, 0.54355967f},
-std::array<float,2>{0.643201768f, 0.279449672f},
-std::array<float,2>{0.450344056f, 0.96598357f},
-std::array<float,2>{0.299975872f, 0.397458971f},
-std::array<float,2>{0.534521043f, 0.844740212f},
-std::array<float,2>{0.842120051f, 0.136729389f},
-std::array<float,2>{0.0959977359f, 0.682083905f},
-std::array<float,2>{0.0587839484f, 0.352636635f},
-std::array<float,2>{0.797521353f, 0.914360583f},
-std::array<float,2>{0.616683125f, 0.100984536f},
-std::array<float,2>{0.315285057f, 0.609112203f},
-std::array<float,2>{0.420382977f, 0.219315097f},
-std::array<float,2>{0.701186359f, 0.744375169f},
-std::array<float,2>{0.897478998f, 0.440798819f},
-std::array<float,2>{0.247992679f, 0.762389719f},
-std::array<float,2>{0.0824774951f, 0.170375735f},
-std::array<float,2>{0.855532467f, 0.655755341f},
-std::array<float,2>{0.525977194f, 0.436483502f},
-std::array<float,2>{0.275751561f, 0.817524135f},
-std::array<float,2>{0.477905065f, 0.291065902f},
-std::array<float,2>{0.664165795f, 0.997647047f},
-std::array<float,2>{0.938063025f, 0.0405947678f},
-std::array<float,2>{0.168766603f, 0.502885878f},
-std::array<float,2>{0.190910369f, 0.473954558f},
-std::array<float,2>{0.931301355f, 0.80835098f},
-std::array<float,2>{0.747080386f, 0.213229761f},
-std::array<float,2>{0.389310241f, 0.690610111f},
-std::array<float,2>{0.346296519f, 0.074303925f},
-std::array<float,2>{0.569812715f, 0.580006957f},
-std::array<float,2>{0.761568606f, 0.3367365f},
-std::array<float,2>{0.0144871278f, 0.891595721f},
-std::array<float,2>{0.228198662f, 0.194286972f},
-std::array<float,2>{0.888146996f, 0.71406734f},
-std::array<float,2>{0.706056654f, 0.499756247f},
-std::array<float,2>{0.437497497f, 0.787809193f},
-std::array<float,2>{0.335532457f, 0.326144397f},
-std::array<float,2>{0.609003484f, 0.878899455f},
-std::array<float,2>{0.787742972f, 0.0791557729f},
-std::array<float,2>{0.0420156382f, 0.563236415f},
-std::array<float,2>{0.121321611f, 0.412097812f},
-std::array<float,2>{0.825766385f, 0.828924f},
-std::array<float,2>{0.549615502f, 0.17523317f},
-std::array<float,2>{0.28962478f, 0.626239181f},
-std::array<float,2>{0.458876938f, 0.0599243268f},
-std::array<float,2>{0.631474853f, 0.518521011f},
-std::array<float,2>{0.993211627f, 0.305728614f},
-std::array<float,2>{0.131723389f, 0.971576154f},
-std::array<float,2>{0.020677438f, 0.123764165f},
-std::array<float,2>{0.770608962f, 0.62014997f},
-std::array<float,2>{0.581548452f, 0.371866047f},
-std::array<float,2>{0.370220661f, 0.936933339f},
-std::array<float,2>{0.397705257f, 0.461063445f},
-std::array<float,2>{0.726431847f, 0.770046473f},
-std::array<float,2>{0.911607742f, 0.242506638f},
-std::array<float,2>{0.204798475f, 0.720174789f},
-std::array<float,2>{0.183528095f, 0.262193441f},
-std::array<float,2>{0.956946075f, 0.943809569f},
-std::array<float,2>{0.685853183f, 0.0291489549f},
-std::array<float,2>{0.48968941f, 0.547706246f},
-std::array<float,2>{0.261952937f, 0.141840607f},
-std::array<float,2>{0.510944784f, 0.669535398f},
-std::array<float,2>{0.867092252f, 0.376084089f},
-std::array<float,2>{0.0744025484f, 0.860572398f},
-std::array<float,2>{0.162367538f, 0.0858290642f},
-std::array<float,2>{0.949701548f, 0.567485929f},
-std::array<float,2>{0.661893666f, 0.32052362f},
-std::array<float,2>{0.473306894f, 0.881684303f},
-std::array<float,2>{0.269318968f, 0.494804859f},
-std::array<float,2>{0.518428624f, 0.782603145f},
-std::array<float,2>{0.844655752f, 0.190317437f},
-std::array<float,2>{0.0890163332f, 0.71712184f},
-std::array<float,2>{0.00703744078f, 0.311532199f},
-std::array<float,2>{0.752622187f, 0.9757514f},
-std::array<float,2>{0.577356994f, 0.0554280803f},
-std::array<float,2>{0.358665526f, 0.520315707f},
-std::array<float,2>{0.37854296f, 0.178281128f},
-std::array<float,2>{0.735966265f, 0.628996968f},
-std::array<float,2>{0.92576021f, 0.409825087f},
-std::array<float,2>{0.202896401f, 0.835837126f},
-std::array<float,2>{0.106602035f, 0.249071985f},
-std::array<float,2>{0.828231871f, 0.723586142f},
-std::array<float,2>{0.546130955f, 0.467191726f},
-std::array<float,2>{0.308791637f, 0.767138481f},
-std::array<float,2>{0.438172191f, 0.367434442f},
-std::array<float,2>{0.65228349f, 0.933262944f},
-std::array<float,2>{0.983829021f, 0.12017329f},
-std::array<float,2>{0.154309303f, 0.624599099f},
-std::array<float,2>{0.237234429f, 0.381153733f},
-std::array<float,2>{0.905007422f, 0.86469698f},
-std::array<float,2>{0.69510299f, 0.145867482f},
-std::array<float,2>{0.410615623f, 0.66744715f},
-std::array<float,2>{0.326026857f, 0.0254044551f},
-std::array<float,2>{0.618481159f, 0.553824246f},
-std::array<float,2>{0.808094501f, 0.258482665f},
-std::array<float,2>{0.0514937751f, 0.937966168f},
-std::array<float,2>{0.212714016f, 0.134984687f},
-std::array<float,2>{0.920925617f, 0.685150862f},
-std::array<float,2>{0.734227419f, 0.392028302f},
-std::array<float,2>{0.401801884f, 0.848858595f},
-std::array<float,2>{0.366104901f, 0.274411052f},
-std::array<float,2>{0.588777006f, 0.961355925f},
-std::array<float,2>{0.774842381f, 0.00725943316f},
-std::array<float,2>{0.0256324299f, 0.540342391f},
-std::array<float,2>{0.0639334619f, 0.444281727f},
-std::array<float,2>{0.868632495f, 0.761113524f},
-std::array<float,2>{0.502065897f, 0.224180326f},
-std::array<float,2>{0.255739868f, 0.747385263f},
-std::array<float,2>{0.496591806f, 0.0956813172f},
-std::array<float,2>{0.678834617f, 0.602235615f},
-std::array<float,2>{0.967657328f, 0.356626868f},
-std::array<float,2>{0.17445454f, 0.920375168f},
-std::array<float,2>{0.0348181129f, 0.0451573394f},
-std::array<float,2>{0.793998122f, 0.505172431f},
-std::array<float,2>{0.60092485f, 0.294019073f},
-std::array<float,2>{0.343205392f, 0.99546665f},
-std::array<float,2>{0.425984412f, 0.430221289f},
-std::array<float,2>{0.714911103f, 0.813549221f},
-std::array<float,2>{0.879309535f, 0.16794917f},
-std::array<float,2>{0.218799129f, 0.64927125f},
-std::array<float,2>{0.140290275f, 0.341852874f},
-std::array<float,2>{0.985763907f, 0.895020425f},
-std::array<float,2>{0.635509551f, 0.0731660351f},
-std::array<float,2>{0.464416862f, 0.585680127f},
-std::array<float,2>{0.283625335f, 0.216557026f},
-std::array<float,2>{0.559928417f, 0.694205523f},
-std::array<float,2>{0.815569818f, 0.469900697f},
-std::array<float,2>{0.109815195f, 0.811271191f},
-std::array<float,2>{0.234055117f, 0.0127375135f},
-std::array<float,2>{0.884897947f, 0.535297334f},
-std::array<float,2>{0.710126221f, 0.265769184f},
-std::array<float,2>{0.43091476f, 0.958660603f},
-std::array<float,2>{0.329194874f, 0.401518762f},
-std::array<float,2>{0.604918063f, 0.857869685f},
-std::array<float,2>{0.783245981f, 0.13236858f},
-std::array<float,2>{0.0450544767f, 0.678601086f},
-std::array<float,2>{0.117493659f, 0.349918008f},
-std::array<float,2>{0.822568417f, 0.911670744f},
-std::array<float,2>{0.551001728f, 0.105376385f},
-std::array<float,2>{0.295836002f, 0.599467576f},
-std::array<float,2>{0.455249429f, 0.232706338f},
-std::array<float,2>{0.628737688f, 0.740612805f},
-std::array<float,2>{0.99799186f, 0.445625037f},
-std::array<float,2>{0.126827121f, 0.753871739f},
-std::array<float,2>{0.0169010088f, 0.158188939f},
-std::array<float,2>{0.769043386f, 0.647063076f},
-std::array<float,2>{0.583223045f, 0.428883463f},
-std::array<float,2>{0.371835053f, 0.82331109f},
-std::array<float,2>{0.39171052f, 0.282169044f},
-std::array<float,2>{0.719596922f, 0.987834752f},
-std::array<float,2>{0.906363904f, 0.0358476751f},
-std::array<float,2>{0.210770428f, 0.509491086f},
-std::array<float,2>{0.186130732f, 0.482265741f},
-std::array<float,2>{0.957914293f, 0.801251411f},
-std::array<float,2>{0.679745317f, 0.208086759f},
-std::array<float,2>{0.487509012f, 0.701254368f},
-std::array<float,2>{0.261602849f, 0.0630650967f},
-std::array<float,2>{0.51481849f, 0.589538991f},
-std::array<float,2>{0.862937331f, 0.330966949f},
-std::array<float,2>{0.0727687404f, 0.902381539f},
-std::array<float,2>{0.14370583f, 0.199401081f},
-std::array<float,2>{0.975654125f, 0.705804169f},
-std::array<float,2>{0.64784205f, 0.487201542f},
-std::array<float,2>{0.446712732f, 0.794547677f},
-std::array<float,2>{0.300956935f, 0.320200473f},
-std::array<float,2>{0.538775384f, 0.888954818f},
-std::array<float,2>{0.837149262f, 0.0892993286f},
-std::array<float,2>{0.0999504477f, 0.57720089f},
-std::array<float,2>{0.054715503f, 0.421594769f},
-std::array<float,2>{0.802335262f, 0.842343986f},
-std::array<float,2>{0.610119283f, 0.183795929f},
-std::array<float,2>{0.318725109f, 0.640493274f},
-std::array<float,2>{0.415116996f, 0.0520757772f},
-std::array<float,2>{0.69580102f, 0.529455721f},
-std::array<float,2>{0.893076956f, 0.302754194f},
-std::array<float,2>{0.244795501f, 0.983832479f},
-std::array<float,2>{0.0819192454f, 0.11095465f},
-std::array<float,2>{0.855402589f, 0.613470674f},
-std::array<float,2>{0.531186402f, 0.359837472f},
-std::array<float,2>{0.277953625f, 0.925407052f},
-std::array<float,2>{0.4834539f, 0.454889446f},
-std::array<float,2>{0.670179844f, 0.775057793f},
-std::array<float,2>{0.941652358f, 0.240929887f},
-std::array<float,2>{0.16591385f, 0.73417604f},
-std::array<float,2>{0.193838179f, 0.254592717f},
-std::array<float,2>{0.933842063f, 0.952190638f},
-std::array<float,2>{0.744894326f, 0.0157846902f},
-std::array<float,2>{0.383948535f, 0.557720304f},
-std::array<float,2>{0.350487351f, 0.149998218f},
-std::array<float,2>{0.564917266f, 0.662528217f},
-std::array<float,2>{0.761976182f, 0.384729534f},
-std::array<float,2>{0.00791382696f, 0.873706877f},
-std::array<float,2>{0.199129954f, 0.10875871f},
-std::array<float,2>{0.928214014f, 0.594686031f},
-std::array<float,2>{0.741257608f, 0.344137132f},
-std::array<float,2>{0.379021853f, 0.908827066f},
-std::array<float,2>{0.355450273f, 0.452376962f},
-std::array<float,2>{0.572277844f, 0.755220115f},
-std::array<float,2>{0.755529404f, 0.228975505f},
-std::array<float,2>{0.00262086187f, 0.737728596f},
-std::array<float,2>{0.093525894f, 0.273374379f},
-std::array<float,2>{0.847833574f, 0.956198692f},
-std::array<float,2>{0.52169925f, 0.0115360394f},
-std::array<float,2>{0.272186011f, 0.531517267f},
-std::array<float,2>{0.472253054f, 0.127191141f},
-std::array<float,2>{0.656318963f, 0.6750049f},
-std::array<float,2>{0.946347892f, 0.404910445f},
-std::array<float,2>{0.158424124f, 0.852308154f},
-std::array<float,2>{0.0496148616f, 0.203305721f},
-std::array<float,2>{0.810381174f, 0.698595822f},
-std::array<float,2>{0.623905659f, 0.477286935f},
-std::array<float,2>{0.322013617f, 0.79861182f},
-std::array<float,2>{0.406580538f, 0.33230719f},
-std::array<float,2>{0.690975666f, 0.900189042f},
-std::array<float,2>{0.900590718f, 0.0697331131f},
-std::array<float,2>{0.241021052f, 0.591880083f},
-std::array<float,2>{0.150799245f, 0.425522804f},
-std::array<float,2>{0.977444589f, 0.827905297f},
-std::array<float,2>{0.655169547f, 0.163360655f},
-std::array<float,2>{0.442854524f, 0.641642034f},
-std::array<float,2>{0.305849582f, 0.0334892869f},
-std::array<float,2>{0.542579412f, 0.513949096f},
-std::array<float,2>{0.832082272f, 0.285977602f},
-std::array<float,2>{0.10326241f, 0.992173553f},
-std::array<float,2>{0.178895235f, 0.179737568f},
-std::array<float,2>{0.961173832f, 0.636305869f},
-std::array<float,2>{0.673340499f, 0.417491466f},
-std::array<float,2>{0.493066102f, 0.839043915f},
-std::array<float,2>{0.250018924f, 0.298940778f},
-std::array<float,2>{0.506567299f, 0.978701353f},
-std::array<float,2>{0.873565376f, 0.0479369909f},
-std::array<float,2>{0.0669062585f, 0.523721159f},
-std::array<float,2>{0.0295311045f, 0.489832759f},
-std::array<float,2>{0.779229701f, 0.792808294f},
-std::array<float,2>{0.590465546f, 0.197720647f},
-std::array<float,2>{0.360289633f, 0.707934976f},
-std::array<float,2>{0.406122088f, 0.0905200765f},
-std::array<float,2>{0.730112314f, 0.573407292f},
-std::array<float,2>{0.915668011f, 0.316181511f},
-std::array<float,2>{0.217783093f, 0.884282172f},
-std::array<float,2>{0.1137897f, 0.0196934566f},
-std::array<float,2>{0.81967634f, 0.5606305f},
-std::array<float,2>{0.55738008f, 0.250012606f},
-std::array<float,2>{0.287463456f, 0.948203325f},
-std::array<float,2>{0.46774894f, 0.388534576f},
-std::array<float,2>{0.640270829f, 0.867303967f},
-std::array<float,2>{0.988970697f, 0.154923394f},
-std::array<float,2>{0.134607345f, 0.658432126f},
-std::array<float,2>{0.226055637f, 0.364872724f},
-std::array<float,2>{0.876146734f, 0.928973675f},
-std::array<float,2>{0.714338362f, 0.113889582f},
-std::array<float,2>{0.424466014f, 0.612344623f},
-std::array<float,2>{0.337830126f, 0.235471934f},
-std::array<float,2>{0.594850063f, 0.730296671f},
-std::array<float,2>{0.792627096f, 0.459533244f},
-std::array<float,2>{0.0382289961f, 0.779641449f},
-std::array<float,2>{0.131974742f, 0.0615607537f},
-std::array<float,2>{0.993030608f, 0.517470181f},
-std::array<float,2>{0.632660031f, 0.306842476f},
-std::array<float,2>{0.457469374f, 0.969405115f},
-std::array<float,2>{0.29004252f, 0.412455976f},
-std::array<float,2>{0.550247729f, 0.830416322f},
-std::array<float,2>{0.824674666f, 0.173299968f},
-std::array<float,2>{0.122755513f, 0.628609419f},
-std::array<float,2>{0.0419033319f, 0.327650994f},
-std::array<float,2>{0.788836658f, 0.876684368f},
-std::array<float,2>{0.607649982f, 0.0812230632f},
-std::array<float,2>{0.334319025f, 0.565293849f},
-std::array<float,2>{0.436173379f, 0.19173418f},
-std::array<float,2>{0.705898762f, 0.71198374f},
-std::array<float,2>{0.887024522f, 0.497659326f},
-std::array<float,2>{0.2265971f, 0.786297858f},
-std::array<float,2>{0.0761035755f, 0.142632082f},
-std::array<float,2>{0.866086781f, 0.671427488f},
-std::array<float,2>{0.510489881f, 0.378540277f},
-std::array<float,2>{0.263350815f, 0.863213897f},
-std::array<float,2>{0.488285959f, 0.264450014f},
-std::array<float,2>{0.687194943f, 0.941890776f},
-std::array<float,2>{0.955477118f, 0.0294154193f},
-std::array<float,2>{0.181928426f, 0.549657524f},
-std::array<float,2>{0.203127846f, 0.46383962f},
-std::array<float,2>{0.910872221f, 0.771943927f},
-std::array<float,2>{0.724717975f, 0.244759664f},
-std::array<float,2>{0.396815538f, 0.721635878f},
-std::array<float,2>{0.369752556f, 0.121484101f},
-std::array<float,2>{0.580976009f, 0.618640721f},
-std::array<float,2>{0.769655108f, 0.374586701f},
-std::array<float,2>{0.0197809637f, 0.934433818f},
-std::array<float,2>{0.246402591f, 0.22163035f},
-std::array<float,2>{0.8969872f, 0.742882609f},
-std::array<float,2>{0.703013361f, 0.438985527f},
-std::array<float,2>{0.421788603f, 0.763708413f},
-std::array<float,2>{0.316294968f, 0.354622155f},
-std::array<float,2>{0.61549288f, 0.916368723f},
-std::array<float,2>{0.798029602f, 0.0988941789f},
-std::array<float,2>{0.0598290451f, 0.607416332f},
-std::array<float,2>{0.0976301208f, 0.396042824f},
-std::array<float,2>{0.843706369f, 0.846656919f},
-std::array<float,2>{0.534060955f, 0.13887395f},
-std::array<float,2>{0.299243838f, 0.679934204f},
-std::array<float,2>{0.449878424f, 0.000103709637f},
-std::array<float,2>{0.644483149f, 0.546140194f},
-std::array<float,2>{0.969088197f, 0.278449118f},
-std::array<float,2>{0.147838712f, 0.966876328f},
-std::array<float,2>{0.0155732911f, 0.0775480419f},
-std::array<float,2>{0.760719657f, 0.580762267f},
-std::array<float,2>{0.569114685f, 0.339796782f},
-std::array<float,2>{0.347553223f, 0.894052982f},
-std::array<float,2>{0.390364289f, 0.475307167f},
-std::array<float,2>{0.746867836f, 0.805318713f},
-std::array<float,2>{0.930072784f, 0.211928084f},
-std::array<float,2>{0.189763337f, 0.688111842f},
-std::array<float,2>{0.169682533f, 0.28960517f},
-std::array<float,2>{0.938599586f, 0.999845922f},
-std::array<float,2>{0.665610731f, 0.0414926894f},
-std::array<float,2>{0.477233469f, 0.501594663f},
-std::array<float,2>{0.276818931f, 0.168382362f},
-std::array<float,2>{0.527047217f, 0.652345896f},
-std::array<float,2>{0.856718421f, 0.435483128f},
-std::array<float,2>{0.0830190107f, 0.820187092f},
-std::array<float,2>{0.153131187f, 0.118032955f},
-std::array<float,2>{0.981841922f, 0.622775376f},
-std::array<float,2>{0.65000838f, 0.369181603f},
-std::array<float,2>{0.439751655f, 0.930229723f},
-std::array<float,2>{0.311422765f, 0.466331452f},
-std::array<float,2>{0.543370545f, 0.768078327f},
-std::array<float,2>{0.830576777f, 0.247269228f},
-std::array<float,2>{0.107455738f, 0.726174593f},
-std::array<float,2>{0.0531851836f, 0.261673212f},
-std::array<float,2>{0.805565f, 0.940070033f},
-std::array<float,2>{0.620696425f, 0.0253051911f},
-std::array<float,2>{0.327669621f, 0.550851047f},
-std::array<float,2>{0.413598299f, 0.147993505f},
-std::array<float,2>{0.692861915f, 0.664508462f},
-std::array<float,2>{0.902777135f, 0.379145831f},
-std::array<float,2>{0.234643728f, 0.866382778f},
-std::array<float,2>{0.0872773677f, 0.188143715f},
-std::array<float,2>{0.846891642f, 0.715275049f},
-std::array<float,2>{0.517353296f, 0.492552936f},
-std::array<float,2>{0.266129285f, 0.783800542f},
-std::array<float,2>{0.476378947f, 0.323920727f},
-std::array<float,2>{0.662940085f, 0.880247593f},
-std::array<float,2>{0.952692747f, 0.0826554596f},
-std::array<float,2>{0.160253495f, 0.569151938f},
-std::array<float,2>{0.200752378f, 0.406852186f},
-std::array<float,2>{0.92321074f, 0.83393693f},
-std::array<float,2>{0.73806268f, 0.176037759f},
-std::array<float,2>{0.375166923f, 0.630916178f},
-std::array<float,2>{0.355801761f, 0.0580983423f},
-std::array<float,2>{0.575337112f, 0.522040248f},
-std::array<float,2>{0.750117242f, 0.308999151f},
-std::array<float,2>{0.00486215064f, 0.97370255f},
-std::array<float,2>{0.222429499f, 0.165657118f},
-std::array<float,2>{0.882151484f, 0.650709748f},
-std::array<float,2>{0.717435122f, 0.432709754f},
-std::array<float,2>{0.428659439f, 0.815048456f},
-std::array<float,2>{0.340714723f, 0.296535522f},
-std::array<float,2>{0.59935528f, 0.993151605f},
-std::array<float,2>{0.796217263f, 0.044562012f},
-std::array<float,2>{0.0315143988f, 0.50644505f},
-std::array<float,2>{0.113029465f, 0.471282333f},
-std::array<float,2>{0.813729823f, 0.809053183f},
-std::array<float,2>{0.560679972f, 0.21680443f},
-std::array<float,2>{0.282208413f, 0.692238748f},
-std::array<float,2>{0.462637097f, 0.0712276697f},
-std::array<float,2>{0.634054303f, 0.583538175f},
-std::array<float,2>{0.988023579f, 0.341782093f},
-std::array<float,2>{0.138173804f, 0.896752477f},
-std::array<float,2>{0.0243510511f, 0.00498702098f},
-std::array<float,2>{0.776238441f, 0.542063057f},
-std::array<float,2>{0.587515831f, 0.276709497f},
-std::array<float,2>{0.364210188f, 0.964217186f},
-std::array<float,2>{0.398588777f, 0.394408941f},
-std::array<float,2>{0.731107354f, 0.851388097f},
-std::array<float,2>{0.918803811f, 0.134272248f},
-std::array<float,2>{0.214366108f, 0.686467469f},
-std::array<float,2>{0.173118114f, 0.359351635f},
-std::array<float,2>{0.965711713f, 0.918081164f},
-std::array<float,2>{0.677268088f, 0.0969419181f},
-std::array<float,2>{0.498358995f, 0.603846967f},
-std::array<float,2>{0.257201731f, 0.225240752f},
-std::array<float,2>{0.501781344f, 0.749626637f},
-std::array<float,2>{0.870901883f, 0.442289382f},
-std::array<float,2>{0.0645134449f, 0.758134842f},
-std::array<float,2>{0.208186358f, 0.0379350744f},
-std::array<float,2>{0.909494936f, 0.510571718f},
-std::array<float,2>{0.721907675f, 0.285076976f},
-std::array<float,2>{0.393564939f, 0.985246539f},
-std::array<float,2>{0.374326527f, 0.426953733f},
-std::array<float,2>{0.584552824f, 0.820748627f},
-std::array<float,2>{0.76707375f, 0.158246771f},
-std::array<float,2>{0.0190663114f, 0.645055294f},
-std::array<float,2>{0.0713536888f, 0.328822136f},
-std::array<float,2>{0.86059773f, 0.905700743f},
-std::array<float,2>{0.512304127f, 0.0654942021f},
-std::array<float,2>{0.259137064f, 0.586255372f},
-std::array<float,2>{0.484810382f, 0.20992744f},
-std::array<float,2>{0.682550192f, 0.699976981f},
-std::array<float,2>{0.960775614f, 0.484292209f},
-std::array<float,2>{0.183869034f, 0.8039518f},
-std::array<float,2>{0.0434796512f, 0.129721388f},
-std::array<float,2>{0.782546222f, 0.676513314f},
-std::array<float,2>{0.603440046f, 0.399745315f},
-std::array<float,2>{0.33042416f, 0.857249916f},
-std::array<float,2>{0.432169139f, 0.269378573f},
-std::array<float,2>{0.708216727f, 0.960873902f},
-std::array<float,2>{0.884750247f, 0.0143119376f},
-std::array<float,2>{0.230798289f, 0.538848042f},
-std::array<float,2>{0.127120912f, 0.448656976f},
-std::array<float,2>{0.998459339f, 0.751428843f},
-std::array<float,2>{0.625364661f, 0.232046172f},
-std::array<float,2>{0.45489648f, 0.740082145f},
-std::array<float,2>{0.294585377f, 0.102632582f},
-std::array<float,2>{0.554679751f, 0.600422859f},
-std::array<float,2>{0.821418703f, 0.348707706f},
-std::array<float,2>{0.120703228f, 0.913284361f},
-std::array<float,2>{0.167137921f, 0.238448516f},
-std::array<float,2>{0.943846762f, 0.73188293f},
-std::array<float,2>{0.668525696f, 0.455206424f},
-std::array<float,2>{0.481633961f, 0.777137756f},
-std::array<float,2>{0.279359609f, 0.362746388f},
-std::array<float,2>{0.527522326f, 0.922317207f},
-std::array<float,2>{0.853066087f, 0.112086438f},
-std::array<float,2>{0.0798271522f, 0.616326392f},
-std::array<float,2>{0.0114217186f, 0.385789424f},
-std::array<float,2>{0.765194058f, 0.872438848f},
-std::array<float,2>{0.563257754f, 0.150941253f},
-std::array<float,2>{0.348270833f, 0.661838412f},
-std::array<float,2>{0.385722548f, 0.0189800411f},
-std::array<float,2>{0.742206633f, 0.556636989f},
-std::array<float,2>{0.936796784f, 0.256865323f},
-std::array<float,2>{0.191907242f, 0.949820697f},
-std::array<float,2>{0.0995826125f, 0.0875797495f},
-std::array<float,2>{0.838353515f, 0.574699163f},
-std::array<float,2>{0.535261869f, 0.316938996f},
-std::array<float,2>{0.304522902f, 0.886925578f},
-std::array<float,2>{0.448588163f, 0.485567331f},
-std::array<float,2>{0.645175815f, 0.795843899f},
-std::array<float,2>{0.973117411f, 0.201301798f},
-std::array<float,2>{0.142497987f, 0.703184724f},
-std::array<float,2>{0.24221988f, 0.302354246f},
-std::array<float,2>{0.891348958f, 0.98134917f},
-std::array<float,2>{0.698512316f, 0.0529151745f},
-std::array<float,2>{0.417692393f, 0.528382182f},
-std::array<float,2>{0.316781729f, 0.187220767f},
-std::array<float,2>{0.612543881f, 0.636989832f},
-std::array<float,2>{0.803609014f, 0.418890059f},
-std::array<float,2>{0.0584538989f, 0.841576576f},
-std::array<float,2>{0.240006432f, 0.0664275959f},
-std::array<float,2>{0.900039434f, 0.590342879f},
-std::array<float,2>{0.68890053f, 0.334101737f},
-std::array<float,2>{0.409823149f, 0.901495576f},
-std::array<float,2>{0.322936684f, 0.479579419f},
-std::array<float,2>{0.621835291f, 0.800528109f},
-std::array<float,2>{0.811426818f, 0.206453785f},
-std::array<float,2>{0.0486118197f, 0.695428252f},
-std::array<float,2>{0.104945108f, 0.287150562f},
-std::array<float,2>{0.834740639f, 0.98837626f},
-std::array<float,2>{0.539669394f, 0.0323181711f},
-std::array<float,2>{0.307683617f, 0.51320225f},
-std::array<float,2>{0.443893194f, 0.161379561f},
-std::array<float,2>{0.654096901f, 0.643268228f},
-std::array<float,2>{0.980089784f, 0.422505856f},
-std::array<float,2>{0.148871422f, 0.825057566f},
-std::array<float,2>{0.000946427695f, 0.228238583f},
-std::array<float,2>{0.757018507f, 0.734484017f},
-std::array<float,2>{0.571071506f, 0.449442089f},
-std::array<float,2>{0.352449864f, 0.757240951f},
-std::array<float,2>{0.381665349f, 0.34702003f},
-std::array<float,2>{0.739417613f, 0.906551301f},
-std::array<float,2>{0.927690327f, 0.105638251f},
-std::array<float,2>{0.19611758f, 0.596463919f},
-std::array<float,2>{0.158167392f, 0.402663738f},
-std::array<float,2>{0.947685897f, 0.854862094f},
-std::array<float,2>{0.659477353f, 0.126484245f},
-std::array<float,2>{0.469824642f, 0.673264682f},
-std::array<float,2>{0.269659638f, 0.00887210015f},
-std::array<float,2>{0.519664228f, 0.534339249f},
-std::array<float,2>{0.849740207f, 0.270028055f},
-std::array<float,2>{0.0900144652f, 0.953692138f},
-std::array<float,2>{0.134940922f, 0.153304204f},
-std::array<float,2>{0.990738809f, 0.658149004f},
-std::array<float,2>{0.638094664f, 0.388891548f},
-std::array<float,2>{0.465321958f, 0.871025801f},
-std::array<float,2>{0.286777735f, 0.253697008f},
-std::array<float,2>{0.55592972f, 0.945327938f},
-std::array<float,2>{0.817076564f, 0.0217873957f},
-std::array<float,2>{0.115638427f, 0.559639335f},
-std::array<float,2>{0.0354136303f, 0.458433092f},
-std::array<float,2>{0.789479673f, 0.778134704f},
-std::array<float,2>{0.597209215f, 0.237874851f},
-std::array<float,2>{0.339305013f, 0.727525234f},
-std::array<float,2>{0.42255953f, 0.116422549f},
-std::array<float,2>{0.712752402f, 0.610660374f},
-std::array<float,2>{0.877683759f, 0.366963148f},
-std::array<float,2>{0.222737297f, 0.926585376f},
-std::array<float,2>{0.068797864f, 0.049365133f},
-std::array<float,2>{0.871266007f, 0.526679277f},
-std::array<float,2>{0.504734516f, 0.29745245f},
-std::array<float,2>{0.253887355f, 0.977753401f},
-std::array<float,2>{0.494713664f, 0.414600372f},
-std::array<float,2>{0.67539835f, 0.83680439f},
-std::array<float,2>{0.964566588f, 0.182762548f},
-std::array<float,2>{0.176219881f, 0.634422839f},
-std::array<float,2>{0.215901941f, 0.313953131f},
-std::array<float,2>{0.916677773f, 0.885061502f},
-std::array<float,2>{0.727199852f, 0.0920847431f},
-std::array<float,2>{0.402361095f, 0.571061075f},
-std::array<float,2>{0.362901032f, 0.19658497f},
-std::array<float,2>{0.591801524f, 0.709308505f},
-std::array<float,2>{0.779864192f, 0.490746766f},
-std::array<float,2>{0.0283805523f, 0.790431917f},
-std::array<float,2>{0.181035638f, 0.0281024128f},
-std::array<float,2>{0.95497185f, 0.548420787f},
-std::array<float,2>{0.685312748f, 0.263305664f},
-std::array<float,2>{0.490700871f, 0.944653511f},
-std::array<float,2>{0.263790369f, 0.375822425f},
-std::array<float,2>{0.508773327f, 0.859853506f},
-std::array<float,2>{0.864103317f, 0.140909493f},
-std::array<float,2>{0.0774459243f, 0.668203056f},
-std::array<float,2>{0.0222845487f, 0.372937292f},
-std::array<float,2>{0.771692634f, 0.936442077f},
-std::array<float,2>{0.578895211f, 0.124785952f},
-std::array<float,2>{0.367411703f, 0.619202316f},
-std::array<float,2>{0.394680023f, 0.244107991f},
-std::array<float,2>{0.723625064f, 0.71947825f},
-std::array<float,2>{0.912446022f, 0.462368309f},
-std::array<float,2>{0.206318945f, 0.771444738f},
-std::array<float,2>{0.124207318f, 0.174795315f},
-std::array<float,2>{0.827026486f, 0.625054121f},
-std::array<float,2>{0.54788965f, 0.411110461f},
-std::array<float,2>{0.292215466f, 0.8291502f},
-std::array<float,2>{0.460799307f, 0.304813772f},
-std::array<float,2>{0.629489124f, 0.972586095f},
-std::array<float,2>{0.994993508f, 0.0593717024f},
-std::array<float,2>{0.129939467f, 0.518963873f},
-std::array<float,2>{0.228632376f, 0.498867899f},
-std::array<float,2>{0.889287651f, 0.788532674f},
-std::array<float,2>{0.704576433f, 0.194483057f},
-std::array<float,2>{0.43421492f, 0.713204145f},
-std::array<float,2>{0.333308369f, 0.078521207f},
-std::array<float,2>{0.607043564f, 0.563850105f},
-std::array<float,2>{0.786860943f, 0.325148523f},
-std::array<float,2>{0.0406734645f, 0.877040982f},
-std::array<float,2>{0.189391151f, 0.214314148f},
-std::array<float,2>{0.932324886f, 0.689997256f},
-std::array<float,2>{0.749339283f, 0.473178089f},
-std::array<float,2>{0.388655871f, 0.807374537f},
-std::array<float,2>{0.344647437f, 0.336990833f},
-std::array<float,2>{0.566724539f, 0.892528057f},
-std::array<float,2>{0.758077085f, 0.0755635276f},
-std::array<float,2>{0.0134926783f, 0.57856226f},
-std::array<float,2>{0.0859041065f, 0.436635792f},
-std::array<float,2>{0.85894227f, 0.817288399f},
-std::array<float,2>{0.523706079f, 0.171281338f},
-std::array<float,2>{0.273530185f, 0.655024588f},
-std::array<float,2>{0.479537338f, 0.0399665013f},
-std::array<float,2>{0.667370081f, 0.50310117f},
-std::array<float,2>{0.939978361f, 0.292544723f},
-std::array<float,2>{0.170145229f, 0.996289432f},
-std::array<float,2>{0.0613244772f, 0.100414f},
-std::array<float,2>{0.799373686f, 0.607469141f},
-std::array<float,2>{0.614674449f, 0.352492154f},
-std::array<float,2>{0.314426243f, 0.915335536f},
-std::array<float,2>{0.418384522f, 0.440259337f},
-std::array<float,2>{0.700992942f, 0.763655007f},
-std::array<float,2>{0.895114779f, 0.219972342f},
-std::array<float,2>{0.24917832f, 0.745891809f},
-std::array<float,2>{0.146355286f, 0.280750841f},
-std::array<float,2>{0.970857501f, 0.964958847f},
-std::array<float,2>{0.642099619f, 0.00253747823f},
-std::array<float,2>{0.452125579f, 0.544643581f},
-std::array<float,2>{0.298435599f, 0.138215095f},
-std::array<float,2>{0.531764388f, 0.68292135f},
-std::array<float,2>{0.841385603f, 0.397610992f},
-std::array<float,2>{0.094598271f, 0.844552338f},
-std::array<float,2>{0.148650452f, 0.0691858605f},
-std::array<float,2>{0.980231285f, 0.59328407f},
-std::array<float,2>{0.654016137f, 0.333072573f},
-std::array<float,2>{0.444111556f, 0.898848236f},
-std::array<float,2>{0.307895273f, 0.47770822f},
-std::array<float,2>{0.540014148f, 0.797215044f},
-std::array<float,2>{0.834608614f, 0.204808816f},
-std::array<float,2>{0.104644231f, 0.698034883f},
-std::array<float,2>{0.0483657047f, 0.286364168f},
-std::array<float,2>{0.811093092f, 0.990885913f},
-std::array<float,2>{0.621722102f, 0.0349001288f},
-std::array<float,2>{0.323047966f, 0.515582263f},
-std::array<float,2>{0.409933776f, 0.162935391f},
-std::array<float,2>{0.688504994f, 0.641485989f},
-std::array<float,2>{0.900233686f, 0.423870564f},
-std::array<float,2>{0.239898488f, 0.826282322f},
-std::array<float,2>{0.0902412683f, 0.230208084f},
-std::array<float,2>{0.850087941f, 0.736984849f},
-std::array<float,2>{0.519811094f, 0.451325327f},
-std::array<float,2>{0.270013183f, 0.754671276f},
-std::array<float,2>{0.470084637f, 0.345235676f},
-std::array<float,2>{0.65932864f, 0.910055101f},
-std::array<float,2>{0.947281659f, 0.107733928f},
-std::array<float,2>{0.157916605f, 0.595519483f},
-std::array<float,2>{0.195818692f, 0.40531528f},
-std::array<float,2>{0.927264512f, 0.853058934f},
-std::array<float,2>{0.739694774f, 0.128784224f},
-std::array<float,2>{0.381590098f, 0.674665451f},
-std::array<float,2>{0.352135837f, 0.0102354847f},
-std::array<float,2>{0.570914447f, 0.532565892f},
-std::array<float,2>{0.75713408f, 0.271862358f},
-std::array<float,2>{0.000596413098f, 0.955405951f},
-std::array<float,2>{0.222956374f, 0.156209216f},
-std::array<float,2>{0.877801657f, 0.659734607f},
-std::array<float,2>{0.71257472f, 0.387316495f},
-std::array<float,2>{0.422677666f, 0.868676305f},
-std::array<float,2>{0.338906378f, 0.251647294f},
-std::array<float,2>{0.597622335f, 0.949038386f},
-std::array<float,2>{0.789189041f, 0.0208843723f},
-std::array<float,2>{0.0353573486f, 0.562456667f},
-std::array<float,2>{0.115452692f, 0.460306764f},
-std::array<float,2>{0.817259431f, 0.780937374f},
-std::array<float,2>{0.555783808f, 0.234703645f},
-std::array<float,2>{0.28706786f, 0.728788018f},
-std::array<float,2>{0.465052158f, 0.114782222f},
-std::array<float,2>{0.637783468f, 0.611924112f},
-std::array<float,2>{0.991027892f, 0.36389336f},
-std::array<float,2>{0.135187835f, 0.92774415f},
-std::array<float,2>{0.0286662616f, 0.0470955782f},
-std::array<float,2>{0.780270755f, 0.524881184f},
-std::array<float,2>{0.59221822f, 0.299911797f},
-std::array<float,2>{0.363176376f, 0.980299294f},
-std::array<float,2>{0.402774185f, 0.416121125f},
-std::array<float,2>{0.727362335f, 0.838601708f},
-std::array<float,2>{0.916959345f, 0.181441978f},
-std::array<float,2>{0.216237277f, 0.635436714f},
-std::array<float,2>{0.175907031f, 0.314607799f},
-std::array<float,2>{0.964827955f, 0.883303881f},
-std::array<float,2>{0.675776839f, 0.0910529196f},
-std::array<float,2>{0.494974583f, 0.572356045f},
-std::array<float,2>{0.253426462f, 0.198969692f},
-std::array<float,2>{0.504525304f, 0.708547533f},
-std::array<float,2>{0.871370852f, 0.488993257f},
-std::array<float,2>{0.0685771704f, 0.791836321f},
-std::array<float,2>{0.206238687f, 0.0307629947f},
-std::array<float,2>{0.912140667f, 0.550274372f},
-std::array<float,2>{0.723368287f, 0.264766991f},
-std::array<float,2>{0.394786954f, 0.943272948f},
-std::array<float,2>{0.367476046f, 0.377244115f},
-std::array<float,2>{0.578731f, 0.862118363f},
-std::array<float,2>{0.77192086f, 0.144248143f},
-std::array<float,2>{0.0220237225f, 0.670316517f},
-std::array<float,2>{0.0772670582f, 0.373992473f},
-std::array<float,2>{0.863837183f, 0.934622228f},
-std::array<float,2>{0.508539021f, 0.123035617f},
-std::array<float,2>{0.264013141f, 0.617734492f},
-std::array<float,2>{0.490350246f, 0.245641962f},
-std::array<float,2>{0.685279429f, 0.722531736f},
-std::array<float,2>{0.954766273f, 0.464525491f},
-std::array<float,2>{0.180822521f, 0.773242414f},
-std::array<float,2>{0.0407731906f, 0.17209819f},
-std::array<float,2>{0.78710252f, 0.627406299f},
-std::array<float,2>{0.607186377f, 0.413252801f},
-std::array<float,2>{0.333144456f, 0.831452489f},
-std::array<float,2>{0.43452701f, 0.308290064f},
-std::array<float,2>{0.704260111f, 0.970690548f},
-std::array<float,2>{0.889505565f, 0.0609089285f},
-std::array<float,2>{0.228829637f, 0.515908539f},
-std::array<float,2>{0.130254984f, 0.496651381f},
-std::array<float,2>{0.994790912f, 0.786019862f},
-std::array<float,2>{0.629844129f, 0.192968205f},
-std::array<float,2>{0.460493922f, 0.711822629f},
-std::array<float,2>{0.292452127f, 0.0803395212f},
-std::array<float,2>{0.548099577f, 0.566209435f},
-std::array<float,2>{0.826875925f, 0.326353669f},
-std::array<float,2>{0.124336183f, 0.875579f},
-std::array<float,2>{0.170346588f, 0.211125225f},
-std::array<float,2>{0.940216184f, 0.689428627f},
-std::array<float,2>{0.667020798f, 0.476331145f},
-std::array<float,2>{0.479846358f, 0.806049407f},
-std::array<float,2>{0.273748487f, 0.337973535f},
-std::array<float,2>{0.523449004f, 0.892951608f},
-std::array<float,2>{0.859264195f, 0.0769982114f},
-std::array<float,2>{0.0855255499f, 0.581729531f},
-std::array<float,2>{0.0132941958f, 0.433755398f},
-std::array<float,2>{0.758048296f, 0.818545997f},
-std::array<float,2>{0.566444457f, 0.169064835f},
-std::array<float,2>{0.344328433f, 0.654239774f},
-std::array<float,2>{0.388246953f, 0.0422814898f},
-std::array<float,2>{0.749178767f, 0.500211656f},
-std::array<float,2>{0.932434916f, 0.290347248f},
-std::array<float,2>{0.189061552f, 0.999018431f},
-std::array<float,2>{0.0944358557f, 0.0983715579f},
-std::array<float,2>{0.841647267f, 0.606406152f},
-std::array<float,2>{0.532131612f, 0.353672534f},
-std::array<float,2>{0.298698872f, 0.917705357f},
-std::array<float,2>{0.451794088f, 0.437821507f},
-std::array<float,2>{0.64242667f, 0.76468426f},
-std::array<float,2>{0.971006811f, 0.22240828f},
-std::array<float,2>{0.146141097f, 0.743865311f},
-std::array<float,2>{0.249370217f, 0.277776569f},
-std::array<float,2>{0.895346284f, 0.968344927f},
-std::array<float,2>{0.700766385f, 0.00107681926f},
-std::array<float,2>{0.418010533f, 0.545031369f},
-std::array<float,2>{0.31413579f, 0.140183821f},
-std::array<float,2>{0.614421368f, 0.680972457f},
-std::array<float,2>{0.799576879f, 0.39526853f},
-std::array<float,2>{0.0610713102f, 0.846710205f},
-std::array<float,2>{0.234395474f, 0.119403549f},
-std::array<float,2>{0.902377367f, 0.623563409f},
-std::array<float,2>{0.692484796f, 0.368971527f},
-std::array<float,2>{0.413992137f, 0.932563543f},
-std::array<float,2>{0.327966124f, 0.468684733f},
-std::array<float,2>{0.621066391f, 0.766187727f},
-std::array<float,2>{0.805375159f, 0.248522818f},
-std::array<float,2>{0.052803386f, 0.723696709f},
-std::array<float,2>{0.1077528f, 0.259417385f},
-std::array<float,2>{0.831044674f, 0.938659787f},
-std::array<float,2>{0.543040276f, 0.0270342622f},
-std::array<float,2>{0.3112351f, 0.553462684f},
-std::array<float,2>{0.439638048f, 0.144862458f},
-std::array<float,2>{0.650319815f, 0.666110694f},
-std::array<float,2>{0.981605291f, 0.382729769f},
-std::array<float,2>{0.152910501f, 0.863777757f},
-std::array<float,2>{0.00461727241f, 0.19133155f},
-std::array<float,2>{0.750319362f, 0.718330741f},
-std::array<float,2>{0.575462997f, 0.495270431f},
-std::array<float,2>{0.355649352f, 0.781937659f},
-std::array<float,2>{0.375402689f, 0.321863323f},
-std::array<float,2>{0.737891614f, 0.88248992f},
-std::array<float,2>{0.922865987f, 0.0845756009f},
-std::array<float,2>{0.200962901f, 0.567050517f},
-std::array<float,2>{0.160453796f, 0.408238888f},
-std::array<float,2>{0.953010917f, 0.834272385f},
-std::array<float,2>{0.662684739f, 0.179596886f},
-std::array<float,2>{0.476223081f, 0.630200922f},
-std::array<float,2>{0.266371459f, 0.0560042933f},
-std::array<float,2>{0.517184675f, 0.52103436f},
-std::array<float,2>{0.847109616f, 0.311201155f},
-std::array<float,2>{0.0871382281f, 0.974629521f},
-std::array<float,2>{0.137778342f, 0.166534305f},
-std::array<float,2>{0.988041639f, 0.65033555f},
-std::array<float,2>{0.634018004f, 0.431597829f},
-std::array<float,2>{0.462741375f, 0.812861085f},
-std::array<float,2>{0.281774908f, 0.29298237f},
-std::array<float,2>{0.560859501f, 0.994224668f},
-std::array<float,2>{0.813674629f, 0.0463638641f},
-std::array<float,2>{0.113269456f, 0.504163563f},
-std::array<float,2>{0.0313883908f, 0.469408214f},
-std::array<float,2>{0.796113193f, 0.812021196f},
-std::array<float,2>{0.599594295f, 0.215715647f},
-std::array<float,2>{0.340395242f, 0.695268095f},
-std::array<float,2>{0.428410381f, 0.0736378655f},
-std::array<float,2>{0.717637837f, 0.584673047f},
-std::array<float,2>{0.881908953f, 0.343455076f},
-std::array<float,2>{0.22239387f, 0.896352768f},
-std::array<float,2>{0.0648440719f, 0.00682154484f},
-std::array<float,2>{0.870717108f, 0.539092541f},
-std::array<float,2>{0.501667678f, 0.275370419f},
-std::array<float,2>{0.256980568f, 0.962269962f},
-std::array<float,2>{0.498063236f, 0.39140901f},
-std::array<float,2>{0.677491605f, 0.848297536f},
-std::array<float,2>{0.965542257f, 0.136496991f},
-std::array<float,2>{0.172909364f, 0.68423152f},
-std::array<float,2>{0.214726061f, 0.355977207f},
-std::array<float,2>{0.918518186f, 0.921007156f},
-std::array<float,2>{0.731387854f, 0.0941276327f},
-std::array<float,2>{0.398822933f, 0.603331923f},
-std::array<float,2>{0.36392343f, 0.223263249f},
-std::array<float,2>{0.587670743f, 0.746724129f},
-std::array<float,2>{0.775948763f, 0.44475621f},
-std::array<float,2>{0.0240832064f, 0.75982219f},
-std::array<float,2>{0.183704913f, 0.0368246287f},
-std::array<float,2>{0.960579097f, 0.507937551f},
-std::array<float,2>{0.682129383f, 0.282363892f},
-std::array<float,2>{0.484494239f, 0.986536801f},
-std::array<float,2>{0.258997977f, 0.428146541f},
-std::array<float,2>{0.512565434f, 0.823115289f},
-std::array<float,2>{0.86041218f, 0.15638341f},
-std::array<float,2>{0.0716793984f, 0.648167431f},
-std::array<float,2>{0.0195211861f, 0.331907123f},
-std::array<float,2>{0.766716361f, 0.903398871f},
-std::array<float,2>{0.58474195f, 0.0636136979f},
-std::array<float,2>{0.374231666f, 0.588652909f},
-std::array<float,2>{0.393951893f, 0.207064226f},
-std::array<float,2>{0.722167671f, 0.702372849f},
-std::array<float,2>{0.90921098f, 0.480760247f},
-std::array<float,2>{0.208412826f, 0.802440464f},
-std::array<float,2>{0.121010013f, 0.131011426f},
-std::array<float,2>{0.821687579f, 0.679486394f},
-std::array<float,2>{0.554295361f, 0.401237547f},
-std::array<float,2>{0.294848949f, 0.858781576f},
-std::array<float,2>{0.454674542f, 0.267515182f},
-std::array<float,2>{0.625053585f, 0.957622588f},
-std::array<float,2>{0.998143494f, 0.0123960087f},
-std::array<float,2>{0.127437755f, 0.536440611f},
-std::array<float,2>{0.230550379f, 0.446815193f},
-std::array<float,2>{0.884391487f, 0.75252378f},
-std::array<float,2>{0.70835042f, 0.2335978f},
-std::array<float,2>{0.432611585f, 0.741900265f},
-std::array<float,2>{0.330203325f, 0.104266576f},
-std::array<float,2>{0.603270352f, 0.598295808f},
-std::array<float,2>{0.782405913f, 0.351055652f},
-std::array<float,2>{0.0437133163f, 0.910981536f},
-std::array<float,2>{0.19229652f, 0.241580009f},
-std::array<float,2>{0.936570227f, 0.732512951f},
-std::array<float,2>{0.742482841f, 0.454067796f},
-std::array<float,2>{0.385394901f, 0.773976862f},
-std::array<float,2>{0.348619998f, 0.360934645f},
-std::array<float,2>{0.563176036f, 0.924688041f},
-std::array<float,2>{0.765493512f, 0.109912232f},
-std::array<float,2>{0.0115054073f, 0.615003645f},
-std::array<float,2>{0.0798410326f, 0.383059978f},
-std::array<float,2>{0.853418767f, 0.874196112f},
-std::array<float,2>{0.527697861f, 0.148620576f},
-std::array<float,2>{0.279668301f, 0.663973212f},
-std::array<float,2>{0.481906474f, 0.0175573379f},
-std::array<float,2>{0.668716908f, 0.557183027f},
-std::array<float,2>{0.943401933f, 0.255178034f},
-std::array<float,2>{0.16734831f, 0.951955676f},
-std::array<float,2>{0.0583246388f, 0.0887997299f},
-std::array<float,2>{0.803324699f, 0.576452076f},
-std::array<float,2>{0.61267823f, 0.319113344f},
-std::array<float,2>{0.31650874f, 0.890061677f},
-std::array<float,2>{0.417732447f, 0.487841517f},
-std::array<float,2>{0.698361814f, 0.792978764f},
-std::array<float,2>{0.891588449f, 0.201066062f},
-std::array<float,2>{0.24252665f, 0.70694375f},
-std::array<float,2>{0.14219223f, 0.303824961f},
-std::array<float,2>{0.972781837f, 0.982967138f},
-std::array<float,2>{0.645502269f, 0.0516766757f},
-std::array<float,2>{0.448466867f, 0.531092227f},
-std::array<float,2>{0.304326206f, 0.185285196f},
-std::array<float,2>{0.535459101f, 0.639468253f},
-std::array<float,2>{0.838095784f, 0.420401692f},
-std::array<float,2>{0.0993314609f, 0.843452275f},
-std::array<float,2>{0.158531904f, 0.106847115f},
-std::array<float,2>{0.946771741f, 0.597395658f},
-std::array<float,2>{0.656601071f, 0.346627504f},
-std::array<float,2>{0.472435296f, 0.9078089f},
-std::array<float,2>{0.272437423f, 0.451156318f},
-std::array<float,2>{0.521824419f, 0.756352603f},
-std::array<float,2>{0.847933352f, 0.227063894f},
-std::array<float,2>{0.0934705958f, 0.735777438f},
-std::array<float,2>{0.00276984205f, 0.271148622f},
-std::array<float,2>{0.755786836f, 0.954250991f},
-std::array<float,2>{0.572690129f, 0.00873153377f},
-std::array<float,2>{0.355167836f, 0.533250451f},
-std::array<float,2>{0.379253328f, 0.125969231f},
-std::array<float,2>{0.741480827f, 0.672236621f},
-std::array<float,2>{0.927777112f, 0.403944463f},
-std::array<float,2>{0.19884643f, 0.854251027f},
-std::array<float,2>{0.103466086f, 0.206007048f},
-std::array<float,2>{0.832304001f, 0.696320176f},
-std::array<float,2>{0.542859793f, 0.479270041f},
-std::array<float,2>{0.306031406f, 0.799473882f},
-std::array<float,2>{0.442504853f, 0.335183591f},
-std::array<float,2>{0.654902279f, 0.90050292f},
-std::array<float,2>{0.977054358f, 0.067836538f},
-std::array<float,2>{0.150567695f, 0.59179014f},
-std::array<float,2>{0.240895033f, 0.423526585f},
-std::array<float,2>{0.900775194f, 0.82603085f},
-std::array<float,2>{0.691277266f, 0.160183191f},
-std::array<float,2>{0.406391293f, 0.644199312f},
-std::array<float,2>{0.322107404f, 0.0314053372f},
-std::array<float,2>{0.623737454f, 0.512038708f},
-std::array<float,2>{0.810167432f, 0.288440257f},
-std::array<float,2>{0.049366504f, 0.989295185f},
-std::array<float,2>{0.218046263f, 0.181880668f},
-std::array<float,2>{0.915976942f, 0.633165359f},
-std::array<float,2>{0.730375648f, 0.415402234f},
-std::array<float,2>{0.405958921f, 0.837321103f},
-std::array<float,2>{0.359878004f, 0.298791289f},
-std::array<float,2>{0.590808332f, 0.976918519f},
-std::array<float,2>{0.779033244f, 0.0505124144f},
-std::array<float,2>{0.0297088027f, 0.525804758f},
-std::array<float,2>{0.0673732087f, 0.491216838f},
-std::array<float,2>{0.874009073f, 0.789106429f},
-std::array<float,2>{0.506637692f, 0.19533506f},
-std::array<float,2>{0.250319839f, 0.710163713f},
-std::array<float,2>{0.492838651f, 0.0928353593f},
-std::array<float,2>{0.673732519f, 0.572200835f},
-std::array<float,2>{0.961200476f, 0.312887907f},
-std::array<float,2>{0.179058433f, 0.885823369f},
-std::array<float,2>{0.0384276621f, 0.023417335f},
-std::array<float,2>{0.792755187f, 0.559021652f},
-std::array<float,2>{0.595163405f, 0.252567858f},
-std::array<float,2>{0.337555051f, 0.946473479f},
-std::array<float,2>{0.424745828f, 0.390427381f},
-std::array<float,2>{0.713944137f, 0.869236469f},
-std::array<float,2>{0.876367927f, 0.153509378f},
-std::array<float,2>{0.225825951f, 0.656925321f},
-std::array<float,2>{0.134449676f, 0.365433425f},
-std::array<float,2>{0.989181221f, 0.927633584f},
-std::array<float,2>{0.640619159f, 0.115395121f},
-std::array<float,2>{0.467385888f, 0.609716892f},
-std::array<float,2>{0.287209511f, 0.236498386f},
-std::array<float,2>{0.557358801f, 0.728469968f},
-std::array<float,2>{0.819479525f, 0.457537711f},
-std::array<float,2>{0.114140183f, 0.779119551f},
-std::array<float,2>{0.226881444f, 0.0604361668f},
-std::array<float,2>{0.886941969f, 0.518058479f},
-std::array<float,2>{0.705567598f, 0.306552857f},
-std::array<float,2>{0.436350644f, 0.970741987f},
-std::array<float,2>{0.334124178f, 0.411176056f},
-std::array<float,2>{0.607780159f, 0.828482747f},
-std::array<float,2>{0.788672805f, 0.175677806f},
-std::array<float,2>{0.0416720584f, 0.626741171f},
-std::array<float,2>{0.123017557f, 0.325519115f},
-std::array<float,2>{0.824291468f, 0.877958477f},
-std::array<float,2>{0.549995303f, 0.0800211877f},
-std::array<float,2>{0.290309578f, 0.562665939f},
-std::array<float,2>{0.457113832f, 0.193588555f},
-std::array<float,2>{0.632361352f, 0.714436054f},
-std::array<float,2>{0.992795229f, 0.499256581f},
-std::array<float,2>{0.132283628f, 0.787568092f},
-std::array<float,2>{0.0196191836f, 0.142110184f},
-std::array<float,2>{0.769858539f, 0.669317782f},
-std::array<float,2>{0.580744624f, 0.376795113f},
-std::array<float,2>{0.370050102f, 0.860899687f},
-std::array<float,2>{0.396601856f, 0.26239121f},
-std::array<float,2>{0.724903762f, 0.943882287f},
-std::array<float,2>{0.911040485f, 0.0287255161f},
-std::array<float,2>{0.203507423f, 0.547324657f},
-std::array<float,2>{0.181658298f, 0.46180281f},
-std::array<float,2>{0.955270767f, 0.769863069f},
-std::array<float,2>{0.687384605f, 0.242922395f},
-std::array<float,2>{0.488668382f, 0.720653355f},
-std::array<float,2>{0.263501287f, 0.123413913f},
-std::array<float,2>{0.510679424f, 0.62092483f},
-std::array<float,2>{0.86588645f, 0.371160865f},
-std::array<float,2>{0.0757627711f, 0.937086463f},
-std::array<float,2>{0.147534713f, 0.219102189f},
-std::array<float,2>{0.968911469f, 0.74487406f},
-std::array<float,2>{0.644286871f, 0.441344172f},
-std::array<float,2>{0.450079709f, 0.761919618f},
-std::array<float,2>{0.299048215f, 0.353056282f},
-std::array<float,2>{0.533887208f, 0.914818287f},
-std::array<float,2>{0.843444943f, 0.101088963f},
-std::array<float,2>{0.0972555354f, 0.608482659f},
-std::array<float,2>{0.0595925488f, 0.396723449f},
-std::array<float,2>{0.798294723f, 0.845537186f},
-std::array<float,2>{0.615459621f, 0.137560248f},
-std::array<float,2>{0.316160738f, 0.682389081f},
-std::array<float,2>{0.421399385f, 0.00332745374f},
-std::array<float,2>{0.702638865f, 0.543155074f},
-std::array<float,2>{0.897227228f, 0.279835314f},
-std::array<float,2>{0.246102527f, 0.966384888f},
-std::array<float,2>{0.0833434537f, 0.0750138238f},
-std::array<float,2>{0.856621563f, 0.579530776f},
-std::array<float,2>{0.527325511f, 0.335959405f},
-std::array<float,2>{0.276382536f, 0.890912652f},
-std::array<float,2>{0.477403045f, 0.474250078f},
-std::array<float,2>{0.6658023f, 0.807770371f},
-std::array<float,2>{0.93875736f, 0.213774785f},
-std::array<float,2>{0.169522956f, 0.691067934f},
-std::array<float,2>{0.189660847f, 0.2919375f},
-std::array<float,2>{0.929706872f, 0.997263551f},
-std::array<float,2>{0.746675313f, 0.0404507704f},
-std::array<float,2>{0.390596777f, 0.502373815f},
-std::array<float,2>{0.347296536f, 0.170697242f},
-std::array<float,2>{0.56904012f, 0.656126499f},
-std::array<float,2>{0.760416985f, 0.43592751f},
-std::array<float,2>{0.0152022662f, 0.818259954f},
-std::array<float,2>{0.202879354f, 0.0836067796f},
-std::array<float,2>{0.925427914f, 0.570215404f},
-std::array<float,2>{0.736253381f, 0.322592497f},
-std::array<float,2>{0.37876606f, 0.879538953f},
-std::array<float,2>{0.358407944f, 0.493767947f},
-std::array<float,2>{0.577581048f, 0.785011768f},
-std::array<float,2>{0.752879739f, 0.189418346f},
-std::array<float,2>{0.00713217119f, 0.716696799f},
-std::array<float,2>{0.0893191323f, 0.310145915f},
-std::array<float,2>{0.844395518f, 0.972948372f},
-std::array<float,2>{0.518307507f, 0.0575780012f},
-std::array<float,2>{0.269216865f, 0.52291888f},
-std::array<float,2>{0.473406166f, 0.177377686f},
-std::array<float,2>{0.66176182f, 0.632724881f},
-std::array<float,2>{0.949313164f, 0.407603711f},
-std::array<float,2>{0.162177041f, 0.832212508f},
-std::array<float,2>{0.0515384376f, 0.246814519f},
-std::array<float,2>{0.80778414f, 0.725448906f},
-std::array<float,2>{0.61826694f, 0.465155274f},
-std::array<float,2>{0.325911939f, 0.769187152f},
-std::array<float,2>{0.41028139f, 0.370896608f},
-std::array<float,2>{0.694860876f, 0.931513965f},
-std::array<float,2>{0.905164719f, 0.118978262f},
-std::array<float,2>{0.236971796f, 0.6219666f},
-std::array<float,2>{0.154751301f, 0.380428702f},
-std::array<float,2>{0.983531415f, 0.865638673f},
-std::array<float,2>{0.65202105f, 0.147386372f},
-std::array<float,2>{0.438297868f, 0.665518701f},
-std::array<float,2>{0.308949441f, 0.0242990125f},
-std::array<float,2>{0.5461483f, 0.552458882f},
-std::array<float,2>{0.828397691f, 0.260086268f},
-std::array<float,2>{0.106911197f, 0.940913737f},
-std::array<float,2>{0.174662009f, 0.133396417f},
-std::array<float,2>{0.967380106f, 0.687085927f},
-std::array<float,2>{0.679007113f, 0.393013597f},
-std::array<float,2>{0.496985376f, 0.85014075f},
-std::array<float,2>{0.255540192f, 0.276317596f},
-std::array<float,2>{0.502366781f, 0.963236809f},
-std::array<float,2>{0.868291974f, 0.0042313775f},
-std::array<float,2>{0.0636058748f, 0.541470528f},
-std::array<float,2>{0.0256477427f, 0.443335563f},
-std::array<float,2>{0.77463752f, 0.759303987f},
-std::array<float,2>{0.588407934f, 0.225603119f},
-std::array<float,2>{0.365758389f, 0.748908937f},
-std::array<float,2>{0.401453316f, 0.0957497582f},
-std::array<float,2>{0.734101951f, 0.604917467f},
-std::array<float,2>{0.921381474f, 0.357946754f},
-std::array<float,2>{0.212534666f, 0.919131041f},
-std::array<float,2>{0.10940066f, 0.0439379066f},
-std::array<float,2>{0.815714777f, 0.507146895f},
-std::array<float,2>{0.559781373f, 0.29544884f},
-std::array<float,2>{0.28326714f, 0.993956804f},
-std::array<float,2>{0.464839548f, 0.43196103f},
-std::array<float,2>{0.635322988f, 0.81552738f},
-std::array<float,2>{0.985457659f, 0.164560139f},
-std::array<float,2>{0.140403762f, 0.651727557f},
-std::array<float,2>{0.21911943f, 0.340325952f},
-std::array<float,2>{0.878991783f, 0.898283958f},
-std::array<float,2>{0.715133607f, 0.0720377266f},
-std::array<float,2>{0.426068008f, 0.58300674f},
-std::array<float,2>{0.342788577f, 0.218450546f},
-std::array<float,2>{0.600652993f, 0.693082392f},
-std::array<float,2>{0.794416308f, 0.472022325f},
-std::array<float,2>{0.0350444652f, 0.809981525f},
-std::array<float,2>{0.126561955f, 0.0148715219f},
-std::array<float,2>{0.997743309f, 0.537873685f},
-std::array<float,2>{0.628481865f, 0.268054962f},
-std::array<float,2>{0.455509752f, 0.959583044f},
-std::array<float,2>{0.29553771f, 0.398743689f},
-std::array<float,2>{0.551128209f, 0.855972826f},
-std::array<float,2>{0.822500527f, 0.130765766f},
-std::array<float,2>{0.117349081f, 0.677582383f},
-std::array<float,2>{0.045352798f, 0.348346919f},
-std::array<float,2>{0.783659339f, 0.913049221f},
-std::array<float,2>{0.604596376f, 0.101689413f},
-std::array<float,2>{0.329532355f, 0.601049066f},
-std::array<float,2>{0.430772781f, 0.230745271f},
-std::array<float,2>{0.710408032f, 0.738705695f},
-std::array<float,2>{0.885039091f, 0.448116332f},
-std::array<float,2>{0.234346107f, 0.75089711f},
-std::array<float,2>{0.0731464922f, 0.159391686f},
-std::array<float,2>{0.863156974f, 0.64616251f},
-std::array<float,2>{0.514916241f, 0.426076949f},
-std::array<float,2>{0.261449367f, 0.821402133f},
-std::array<float,2>{0.487737358f, 0.28414917f},
-std::array<float,2>{0.680039942f, 0.985685289f},
-std::array<float,2>{0.957741499f, 0.0383401848f},
-std::array<float,2>{0.186293826f, 0.510930717f},
-std::array<float,2>{0.210548952f, 0.482717097f},
-std::array<float,2>{0.906497717f, 0.802859068f},
-std::array<float,2>{0.71943748f, 0.210231319f},
-std::array<float,2>{0.391954124f, 0.700782835f},
-std::array<float,2>{0.371752173f, 0.0648066923f},
-std::array<float,2>{0.583464205f, 0.587858677f},
-std::array<float,2>{0.769488811f, 0.329860806f},
-std::array<float,2>{0.0166506991f, 0.904413998f},
-std::array<float,2>{0.24503915f, 0.202800393f},
-std::array<float,2>{0.893419266f, 0.704438865f},
-std::array<float,2>{0.696090817f, 0.484979361f},
-std::array<float,2>{0.415517211f, 0.796262503f},
-std::array<float,2>{0.318426609f, 0.318044096f},
-std::array<float,2>{0.609926164f, 0.888513088f},
-std::array<float,2>{0.802601516f, 0.0862438306f},
-std::array<float,2>{0.0549462587f, 0.576007664f},
-std::array<float,2>{0.0997411609f, 0.419733703f},
-std::array<float,2>{0.837215126f, 0.84040463f},
-std::array<float,2>{0.538865328f, 0.186040908f},
-std::array<float,2>{0.301209688f, 0.637784362f},
-std::array<float,2>{0.446445107f, 0.054047171f},
-std::array<float,2>{0.647637665f, 0.527675152f},
-std::array<float,2>{0.976061285f, 0.300884962f},
-std::array<float,2>{0.144021839f, 0.981816232f},
-std::array<float,2>{0.00822517648f, 0.112812221f},
-std::array<float,2>{0.761942327f, 0.615968347f},
-std::array<float,2>{0.564482391f, 0.361754268f},
-std::array<float,2>{0.350264519f, 0.923677087f},
-std::array<float,2>{0.384067655f, 0.456815511f},
-std::array<float,2>{0.744696498f, 0.775716066f},
-std::array<float,2>{0.933601558f, 0.23951824f},
-std::array<float,2>{0.193501726f, 0.731365144f},
-std::array<float,2>{0.165722474f, 0.256269753f},
-std::array<float,2>{0.94152385f, 0.950475097f},
-std::array<float,2>{0.670071006f, 0.0182046574f},
-std::array<float,2>{0.483770728f, 0.555102587f},
-std::array<float,2>{0.278206915f, 0.151390761f},
-std::array<float,2>{0.530981898f, 0.660667956f},
-std::array<float,2>{0.855094016f, 0.385645419f},
-std::array<float,2>{0.081551671f, 0.871924698f},
-std::array<float,2>{0.178409711f, 0.0903299004f},
-std::array<float,2>{0.96256429f, 0.574097097f},
-std::array<float,2>{0.672287941f, 0.315670311f},
-std::array<float,2>{0.493642777f, 0.883846581f},
-std::array<float,2>{0.251915067f, 0.489710271f},
-std::array<float,2>{0.507330835f, 0.792386711f},
-std::array<float,2>{0.874985337f, 0.197938189f},
-std::array<float,2>{0.0682162866f, 0.707507908f},
-std::array<float,2>{0.030427115f, 0.299516797f},
-std::array<float,2>{0.777395606f, 0.979077637f},
-std::array<float,2>{0.590839922f, 0.0486593246f},
-std::array<float,2>{0.360974789f, 0.524387479f},
-std::array<float,2>{0.404813319f, 0.180311635f},
-std::array<float,2>{0.728961349f, 0.636048198f},
-std::array<float,2>{0.914424062f, 0.417299896f},
-std::array<float,2>{0.217596114f, 0.839374781f},
-std::array<float,2>{0.114710271f, 0.235898286f},
-std::array<float,2>{0.818460286f, 0.729548812f},
-std::array<float,2>{0.558073938f, 0.459133804f},
-std::array<float,2>{0.288294435f, 0.78026545f},
-std::array<float,2>{0.4683083f, 0.364495844f},
-std::array<float,2>{0.639270306f, 0.929332435f},
-std::array<float,2>{0.989701033f, 0.113613702f},
-std::array<float,2>{0.133432433f, 0.612968147f},
-std::array<float,2>{0.224646136f, 0.388026297f},
-std::array<float,2>{0.875854433f, 0.867754161f},
-std::array<float,2>{0.713540673f, 0.15458253f},
-std::array<float,2>{0.425640136f, 0.658765793f},
-std::array<float,2>{0.336390734f, 0.0204088818f},
-std::array<float,2>{0.59422344f, 0.561178386f},
-std::array<float,2>{0.791888773f, 0.250764728f},
-std::array<float,2>{0.037684571f, 0.947349429f},
-std::array<float,2>{0.198081881f, 0.127843797f},
-std::array<float,2>{0.929454565f, 0.675311923f},
-std::array<float,2>{0.740470648f, 0.404501259f},
-std::array<float,2>{0.380141675f, 0.851621807f},
-std::array<float,2>{0.353893995f, 0.272589117f},
-std::array<float,2>{0.574118912f, 0.956947327f},
-std::array<float,2>{0.754545331f, 0.010775202f},
-std::array<float,2>{0.00389297307f, 0.531852722f},
-std::array<float,2>{0.092093505f, 0.452900618f},
-std::array<float,2>{0.849103987f, 0.755470574f},
-std::array<float,2>{0.523073077f, 0.229054227f},
-std::array<float,2>{0.272543192f, 0.738001764f},
-std::array<float,2>{0.470727921f, 0.109165609f},
-std::array<float,2>{0.657253087f, 0.594047546f},
-std::array<float,2>{0.94596535f, 0.344471604f},
-std::array<float,2>{0.159719333f, 0.908625841f},
-std::array<float,2>{0.0499304309f, 0.0339232683f},
-std::array<float,2>{0.80946964f, 0.514467239f},
-std::array<float,2>{0.624385417f, 0.28546235f},
-std::array<float,2>{0.320684612f, 0.991253316f},
-std::array<float,2>{0.407630175f, 0.425138086f},
-std::array<float,2>{0.689617693f, 0.827199697f},
-std::array<float,2>{0.901572227f, 0.163936824f},
-std::array<float,2>{0.241657346f, 0.642278194f},
-std::array<float,2>{0.15149428f, 0.332566798f},
-std::array<float,2>{0.977976382f, 0.8997702f},
-std::array<float,2>{0.65620625f, 0.0702139512f},
-std::array<float,2>{0.4422355f, 0.592298865f},
-std::array<float,2>{0.304835528f, 0.203914404f},
-std::array<float,2>{0.541318595f, 0.69878006f},
-std::array<float,2>{0.833635271f, 0.477045536f},
-std::array<float,2>{0.102077626f, 0.798182547f},
-std::array<float,2>{0.247698829f, 0.000759251008f},
-std::array<float,2>{0.8979159f, 0.546816826f},
-std::array<float,2>{0.701508045f, 0.278837502f},
-std::array<float,2>{0.420095235f, 0.967443824f},
-std::array<float,2>{0.315163791f, 0.395701528f},
-std::array<float,2>{0.616348147f, 0.846140206f},
-std::array<float,2>{0.797763944f, 0.139473632f},
-std::array<float,2>{0.0589571893f, 0.680311263f},
-std::array<float,2>{0.0959116742f, 0.355043441f},
-std::array<float,2>{0.841899455f, 0.916882753f},
-std::array<float,2>{0.534352064f, 0.0992662609f},
-std::array<float,2>{0.300067604f, 0.606871486f},
-std::array<float,2>{0.450490832f, 0.22110337f},
-std::array<float,2>{0.643373787f, 0.742515624f},
-std::array<float,2>{0.970530391f, 0.438868016f},
-std::array<float,2>{0.146652505f, 0.764295101f},
-std::array<float,2>{0.0141947232f, 0.168840423f},
-std::array<float,2>{0.761449873f, 0.653098345f},
-std::array<float,2>{0.569477856f, 0.434978366f},
-std::array<float,2>{0.346581191f, 0.819669604f},
-std::array<float,2>{0.389634907f, 0.2891891f},
-std::array<float,2>{0.747339725f, 0.999322891f},
-std::array<float,2>{0.931458414f, 0.0417789556f},
-std::array<float,2>{0.190643266f, 0.501075685f},
-std::array<float,2>{0.168521598f, 0.4746207f},
-std::array<float,2>{0.938274622f, 0.804702282f},
-std::array<float,2>{0.664479673f, 0.212513924f},
-std::array<float,2>{0.477627575f, 0.687604904f},
-std::array<float,2>{0.275577515f, 0.0778703764f},
-std::array<float,2>{0.526249468f, 0.580201507f},
-std::array<float,2>{0.855938315f, 0.339144319f},
-std::array<float,2>{0.0820340663f, 0.893779814f},
-std::array<float,2>{0.131461009f, 0.191899166f},
-std::array<float,2>{0.993495584f, 0.712476134f},
-std::array<float,2>{0.631832898f, 0.497238725f},
-std::array<float,2>{0.458685488f, 0.786679327f},
-std::array<float,2>{0.290001005f, 0.32761848f},
-std::array<float,2>{0.549404621f, 0.876399815f},
-std::array<float,2>{0.826022685f, 0.0815692991f},
-std::array<float,2>{0.121399157f, 0.564477861f},
-std::array<float,2>{0.0423653834f, 0.412757665f},
-std::array<float,2>{0.787951708f, 0.83077085f},
-std::array<float,2>{0.609229386f, 0.173713505f},
-std::array<float,2>{0.335897297f, 0.628088892f},
-std::array<float,2>{0.437149584f, 0.0621512458f},
-std::array<float,2>{0.706396639f, 0.516882241f},
-std::array<float,2>{0.887850404f, 0.307258844f},
-std::array<float,2>{0.228449717f, 0.968882024f},
-std::array<float,2>{0.0745044202f, 0.122059964f},
-std::array<float,2>{0.86682868f, 0.618769646f},
-std::array<float,2>{0.511003792f, 0.374406815f},
-std::array<float,2>{0.262014478f, 0.933865547f},
-std::array<float,2>{0.489408821f, 0.463066757f},
-std::array<float,2>{0.685655415f, 0.772189677f},
-std::array<float,2>{0.956687212f, 0.244245157f},
-std::array<float,2>{0.183195189f, 0.721068799f},
-std::array<float,2>{0.204863742f, 0.263924271f},
-std::array<float,2>{0.911291718f, 0.942037702f},
-std::array<float,2>{0.726282001f, 0.0302460957f},
-std::array<float,2>{0.397607923f, 0.549090207f},
-std::array<float,2>{0.370509773f, 0.143286541f},
-std::array<float,2>{0.581870973f, 0.671264887f},
-std::array<float,2>{0.770859659f, 0.378260523f},
-std::array<float,2>{0.0207725391f, 0.862431586f},
-std::array<float,2>{0.211713552f, 0.0949436426f},
-std::array<float,2>{0.920149624f, 0.601933181f},
-std::array<float,2>{0.732689738f, 0.357181519f},
-std::array<float,2>{0.400613546f, 0.920749664f},
-std::array<float,2>{0.366568297f, 0.44372189f},
-std::array<float,2>{0.589044452f, 0.761368632f},
-std::array<float,2>{0.774057686f, 0.22378321f},
-std::array<float,2>{0.0264231265f, 0.74803406f},
-std::array<float,2>{0.0633192658f, 0.273546517f},
-std::array<float,2>{0.867955208f, 0.961489081f},
-std::array<float,2>{0.503132224f, 0.00754027767f},
-std::array<float,2>{0.253934711f, 0.54068917f},
-std::array<float,2>{0.497530252f, 0.135279641f},
-std::array<float,2>{0.678036928f, 0.684788346f},
-std::array<float,2>{0.968663275f, 0.392485321f},
-std::array<float,2>{0.175050274f, 0.849205554f},
-std::array<float,2>{0.0333647877f, 0.21587491f},
-std::array<float,2>{0.793391943f, 0.693627656f},
-std::array<float,2>{0.600541294f, 0.470246732f},
-std::array<float,2>{0.342432797f, 0.810718536f},
-std::array<float,2>{0.427343339f, 0.342388391f},
-std::array<float,2>{0.71625489f, 0.894932806f},
-std::array<float,2>{0.880780756f, 0.0723844618f},
-std::array<float,2>{0.220430478f, 0.585041881f},
-std::array<float,2>{0.139268056f, 0.430016816f},
-std::array<float,2>{0.985090792f, 0.814062417f},
-std::array<float,2>{0.636250854f, 0.167347535f},
-std::array<float,2>{0.463365495f, 0.64864558f},
-std::array<float,2>{0.284291297f, 0.0457932204f},
-std::array<float,2>{0.558734775f, 0.505514085f},
-std::array<float,2>{0.814624488f, 0.294635475f},
-std::array<float,2>{0.110837199f, 0.995678544f},
-std::array<float,2>{0.163740382f, 0.178196803f},
-std::array<float,2>{0.950899839f, 0.629478633f},
-std::array<float,2>{0.660531402f, 0.409207553f},
-std::array<float,2>{0.474189162f, 0.835172415f},
-std::array<float,2>{0.267770946f, 0.312493175f},
-std::array<float,2>{0.51919812f, 0.976129115f},
-std::array<float,2>{0.845138609f, 0.0550396927f},
-std::array<float,2>{0.0880836025f, 0.519753814f},
-std::array<float,2>{0.00625906838f, 0.494143099f},
-std::array<float,2>{0.753794014f, 0.78319639f},
-std::array<float,2>{0.576487899f, 0.189862445f},
-std::array<float,2>{0.357861251f, 0.717520714f},
-std::array<float,2>{0.377625823f, 0.0853660107f},
-std::array<float,2>{0.734465241f, 0.567952573f},
-std::array<float,2>{0.923845112f, 0.320977718f},
-std::array<float,2>{0.201905802f, 0.881119311f},
-std::array<float,2>{0.105688192f, 0.0259640664f},
-std::array<float,2>{0.82978946f, 0.554673314f},
-std::array<float,2>{0.545114875f, 0.258209378f},
-std::array<float,2>{0.310362339f, 0.93841362f},
-std::array<float,2>{0.439382136f, 0.381398797f},
-std::array<float,2>{0.65059036f, 0.865187943f},
-std::array<float,2>{0.98307991f, 0.146401048f},
-std::array<float,2>{0.155859783f, 0.667576194f},
-std::array<float,2>{0.237548634f, 0.368090153f},
-std::array<float,2>{0.905499935f, 0.933014095f},
-std::array<float,2>{0.694015503f, 0.12065044f},
-std::array<float,2>{0.411285162f, 0.624253392f},
-std::array<float,2>{0.324573964f, 0.249522135f},
-std::array<float,2>{0.618163109f, 0.722772658f},
-std::array<float,2>{0.806793928f, 0.467402458f},
-std::array<float,2>{0.0525936857f, 0.766906977f},
-std::array<float,2>{0.143041149f, 0.0522540249f},
-std::array<float,2>{0.975018263f, 0.53015995f},
-std::array<float,2>{0.647201478f, 0.303484023f},
-std::array<float,2>{0.446275622f, 0.984026492f},
-std::array<float,2>{0.30178532f, 0.421072513f},
-std::array<float,2>{0.537968516f, 0.841907978f},
-std::array<float,2>{0.836417139f, 0.184529126f},
-std::array<float,2>{0.100938573f, 0.639971972f},
-std::array<float,2>{0.0565921739f, 0.31936577f},
-std::array<float,2>{0.800924718f, 0.889199376f},
-std::array<float,2>{0.610541523f, 0.0894026756f},
-std::array<float,2>{0.319812775f, 0.577952623f},
-std::array<float,2>{0.414793879f, 0.199951872f},
-std::array<float,2>{0.697194815f, 0.7053774f},
-std::array<float,2>{0.894364357f, 0.486573726f},
-std::array<float,2>{0.245849311f, 0.794142544f},
-std::array<float,2>{0.0801852643f, 0.149795443f},
-std::array<float,2>{0.854041576f, 0.662981391f},
-std::array<float,2>{0.52939707f, 0.384189129f},
-std::array<float,2>{0.278715253f, 0.873392284f},
-std::array<float,2>{0.48319605f, 0.253968835f},
-std::array<float,2>{0.67168051f, 0.952859223f},
-std::array<float,2>{0.942649364f, 0.0163133908f},
-std::array<float,2>{0.164147541f, 0.55858916f},
-std::array<float,2>{0.194587633f, 0.454156458f},
-std::array<float,2>{0.935132682f, 0.77477169f},
-std::array<float,2>{0.745479107f, 0.240635276f},
-std::array<float,2>{0.383036137f, 0.733620346f},
-std::array<float,2>{0.35124886f, 0.110520542f},
-std::array<float,2>{0.565630376f, 0.614058256f},
-std::array<float,2>{0.763341188f, 0.359872311f},
-std::array<float,2>{0.00932102371f, 0.925173998f},
-std::array<float,2>{0.233298123f, 0.233359098f},
-std::array<float,2>{0.886357725f, 0.741197586f},
-std::array<float,2>{0.709575891f, 0.446119368f},
-std::array<float,2>{0.43017894f, 0.753219008f},
-std::array<float,2>{0.328693479f, 0.350435019f},
-std::array<float,2>{0.603877366f, 0.911289215f},
-std::array<float,2>{0.784502625f, 0.104948126f},
-std::array<float,2>{0.0462279506f, 0.598808169f},
-std::array<float,2>{0.118739881f, 0.402019918f},
-std::array<float,2>{0.823950768f, 0.858127475f},
-std::array<float,2>{0.552482545f, 0.13219969f},
-std::array<float,2>{0.296336919f, 0.678083599f},
-std::array<float,2>{0.456863701f, 0.0133528523f},
-std::array<float,2>{0.627715409f, 0.536000788f},
-std::array<float,2>{0.99629724f, 0.266120285f},
-std::array<float,2>{0.125792965f, 0.958449721f},
-std::array<float,2>{0.016538443f, 0.0626750737f},
-std::array<float,2>{0.767984629f, 0.589202523f},
-std::array<float,2>{0.582729995f, 0.330428034f},
-std::array<float,2>{0.372671068f, 0.903215706f},
-std::array<float,2>{0.391578346f, 0.481514543f},
-std::array<float,2>{0.720368803f, 0.801321328f},
-std::array<float,2>{0.908104658f, 0.208557233f},
-std::array<float,2>{0.209705353f, 0.701665163f},
-std::array<float,2>{0.187020257f, 0.281403959f},
-std::array<float,2>{0.958624125f, 0.987575471f},
-std::array<float,2>{0.680850923f, 0.0354428664f},
-std::array<float,2>{0.486660838f, 0.508962512f},
-std::array<float,2>{0.260698318f, 0.157354176f},
-std::array<float,2>{0.514406145f, 0.646745443f},
-std::array<float,2>{0.862085819f, 0.429605633f},
-std::array<float,2>{0.0737249106f, 0.824139118f},
-std::array<float,2>{0.136493772f, 0.116881438f},
-std::array<float,2>{0.991904378f, 0.61119622f},
-std::array<float,2>{0.637211561f, 0.366494834f},
-std::array<float,2>{0.466621459f, 0.925884128f},
-std::array<float,2>{0.285647094f, 0.458620667f},
-std::array<float,2>{0.554820776f, 0.777694523f},
-std::array<float,2>{0.81781894f, 0.237634212f},
-std::array<float,2>{0.116814002f, 0.726868629f},
-std::array<float,2>{0.0363448635f, 0.252966821f},
-std::array<float,2>{0.790130198f, 0.946235836f},
-std::array<float,2>{0.596043706f, 0.022262631f},
-std::array<float,2>{0.338117033f, 0.560321689f},
-std::array<float,2>{0.423171401f, 0.152779475f},
-std::array<float,2>{0.711857975f, 0.657287657f},
-std::array<float,2>{0.878661633f, 0.389548779f},
-std::array<float,2>{0.224225059f, 0.870195627f},
-std::array<float,2>{0.0696868226f, 0.196901247f},
-std::array<float,2>{0.872097373f, 0.709878922f},
-std::array<float,2>{0.505043864f, 0.490709364f},
-std::array<float,2>{0.252408266f, 0.790636241f},
-std::array<float,2>{0.495835483f, 0.31406036f},
-std::array<float,2>{0.674450994f, 0.885548532f},
-std::array<float,2>{0.963136375f, 0.0924341902f},
-std::array<float,2>{0.177449763f, 0.570548654f},
-std::array<float,2>{0.215353087f, 0.414153934f},
-std::array<float,2>{0.917873681f, 0.83614397f},
-std::array<float,2>{0.728215635f, 0.183347732f},
-std::array<float,2>{0.404056549f, 0.633967876f},
-std::array<float,2>{0.361883461f, 0.0492436923f},
-std::array<float,2>{0.593409061f, 0.527237654f},
-std::array<float,2>{0.780809045f, 0.297290802f},
-std::array<float,2>{0.0278796088f, 0.978510916f},
-std::array<float,2>{0.239039078f, 0.161889553f},
-std::array<float,2>{0.898971975f, 0.642870128f},
-std::array<float,2>{0.688136816f, 0.422238946f},
-std::array<float,2>{0.408806771f, 0.824529171f},
-std::array<float,2>{0.324129879f, 0.28782922f},
-std::array<float,2>{0.62286067f, 0.989057302f},
-std::array<float,2>{0.812265873f, 0.0331342369f},
-std::array<float,2>{0.0477103144f, 0.512947917f},
-std::array<float,2>{0.104110971f, 0.480129689f},
-std::array<float,2>{0.835407257f, 0.79990226f},
-std::array<float,2>{0.540831268f, 0.206773534f},
-std::array<float,2>{0.306794226f, 0.696173549f},
-std::array<float,2>{0.444500029f, 0.0672225505f},
-std::array<float,2>{0.652938128f, 0.589903772f},
-std::array<float,2>{0.97873354f, 0.334674358f},
-std::array<float,2>{0.149716243f, 0.902240932f},
-std::array<float,2>{0.00180101476f, 0.00971705839f},
-std::array<float,2>{0.756017327f, 0.534867287f},
-std::array<float,2>{0.572264552f, 0.269940525f},
-std::array<float,2>{0.353493273f, 0.953146756f},
-std::array<float,2>{0.382003725f, 0.403059781f},
-std::array<float,2>{0.739018083f, 0.855380058f},
-std::array<float,2>{0.92672652f, 0.126012877f},
-std::array<float,2>{0.196964458f, 0.6734671f},
-std::array<float,2>{0.156366348f, 0.347249299f},
-std::array<float,2>{0.949065745f, 0.907091916f},
-std::array<float,2>{0.659000814f, 0.106157772f},
-std::array<float,2>{0.469201505f, 0.595743239f},
-std::array<float,2>{0.271034062f, 0.227605999f},
-std::array<float,2>{0.520579517f, 0.735051155f},
-std::array<float,2>{0.850898385f, 0.450189561f},
-std::array<float,2>{0.0910795629f, 0.757599652f},
-std::array<float,2>{0.188246146f, 0.0394717865f},
-std::array<float,2>{0.933276594f, 0.503541768f},
-std::array<float,2>{0.748074114f, 0.29201439f},
-std::array<float,2>{0.38739267f, 0.996738791f},
-std::array<float,2>{0.345170557f, 0.437303513f},
-std::array<float,2>{0.568097651f, 0.816891551f},
-std::array<float,2>{0.75911057f, 0.17177555f},
-std::array<float,2>{0.0118788071f, 0.654346943f},
-std::array<float,2>{0.0839927867f, 0.337570816f},
-std::array<float,2>{0.858379662f, 0.891907275f},
-std::array<float,2>{0.524929106f, 0.0760009959f},
-std::array<float,2>{0.274718523f, 0.57870692f},
-std::array<float,2>{0.47862795f, 0.214835897f},
-std::array<float,2>{0.666202247f, 0.689528108f},
-std::array<float,2>{0.94056493f, 0.473091841f},
-std::array<float,2>{0.171219081f, 0.806780398f},
-std::array<float,2>{0.0617768615f, 0.137952849f},
-std::array<float,2>{0.800444305f, 0.683573544f},
-std::array<float,2>{0.614157677f, 0.398178369f},
-std::array<float,2>{0.312700242f, 0.844152272f},
-std::array<float,2>{0.419803828f, 0.281102151f},
-std::array<float,2>{0.699823737f, 0.965732872f},
-std::array<float,2>{0.895904124f, 0.00199970254f},
-std::array<float,2>{0.248484582f, 0.54408586f},
-std::array<float,2>{0.144855544f, 0.439747155f},
-std::array<float,2>{0.972222805f, 0.763117254f},
-std::array<float,2>{0.640759647f, 0.220311061f},
-std::array<float,2>{0.452419937f, 0.745279312f},
-std::array<float,2>{0.297631562f, 0.100068875f},
-std::array<float,2>{0.533015192f, 0.608373225f},
-std::array<float,2>{0.840641737f, 0.352047503f},
-std::array<float,2>{0.0956994444f, 0.916006207f},
-std::array<float,2>{0.179700881f, 0.24361597f},
-std::array<float,2>{0.953325212f, 0.71881032f},
-std::array<float,2>{0.684565067f, 0.462656021f},
-std::array<float,2>{0.492029101f, 0.770889759f},
-std::array<float,2>{0.265491456f, 0.372300178f},
-std::array<float,2>{0.509576678f, 0.935976446f},
-std::array<float,2>{0.86433208f, 0.12412937f},
-std::array<float,2>{0.0762394145f, 0.619682312f},
-std::array<float,2>{0.0228710417f, 0.375287563f},
-std::array<float,2>{0.772481859f, 0.860013068f},
-std::array<float,2>{0.579957426f, 0.141234308f},
-std::array<float,2>{0.368998021f, 0.668704689f},
-std::array<float,2>{0.395550013f, 0.027631864f},
-std::array<float,2>{0.724138916f, 0.548139274f},
-std::array<float,2>{0.913312912f, 0.263096422f},
-std::array<float,2>{0.205610394f, 0.945091128f},
-std::array<float,2>{0.123880662f, 0.0787037835f},
-std::array<float,2>{0.827184618f, 0.564154267f},
-std::array<float,2>{0.547700405f, 0.324319571f},
-std::array<float,2>{0.291484445f, 0.877506077f},
-std::array<float,2>{0.45991081f, 0.498425573f},
-std::array<float,2>{0.63015753f, 0.788936198f},
-std::array<float,2>{0.995797634f, 0.194983363f},
-std::array<float,2>{0.129450411f, 0.713826239f},
-std::array<float,2>{0.229970381f, 0.305546701f},
-std::array<float,2>{0.889658391f, 0.971932709f},
-std::array<float,2>{0.703478932f, 0.0587132722f},
-std::array<float,2>{0.435294151f, 0.519219637f},
-std::array<float,2>{0.332654327f, 0.174157828f},
-std::array<float,2>{0.605626464f, 0.625501335f},
-std::array<float,2>{0.786026895f, 0.410173565f},
-std::array<float,2>{0.0398595929f, 0.830053329f},
-std::array<float,2>{0.221368954f, 0.0705916211f},
-std::array<float,2>{0.881190121f, 0.58325237f},
-std::array<float,2>{0.718698323f, 0.340898007f},
-std::array<float,2>{0.428844869f, 0.89742732f},
-std::array<float,2>{0.341589481f, 0.47088483f},
-std::array<float,2>{0.598066568f, 0.809182465f},
-std::array<float,2>{0.795108497f, 0.217766747f},
-std::array<float,2>{0.0330811478f, 0.691522717f},
-std::array<float,2>{0.111611448f, 0.295964748f},
-std::array<float,2>{0.813256025f, 0.992333055f},
-std::array<float,2>{0.561679304f, 0.0439491421f},
-std::array<float,2>{0.283176452f, 0.506094396f},
-std::array<float,2>{0.461672664f, 0.165215135f},
-std::array<float,2>{0.633418143f, 0.650973678f},
-std::array<float,2>{0.986860514f, 0.433532119f},
-std::array<float,2>{0.137539908f, 0.814586639f},
-std::array<float,2>{0.0253794231f, 0.224695861f},
-std::array<float,2>{0.776887238f, 0.749076486f},
-std::array<float,2>{0.586159587f, 0.441461444f},
-std::array<float,2>{0.365110993f, 0.758515954f},
-std::array<float,2>{0.399453878f, 0.358820707f},
-std::array<float,2>{0.731487155f, 0.918905437f},
-std::array<float,2>{0.91983062f, 0.0975027531f},
-std::array<float,2>{0.213523388f, 0.60412693f},
-std::array<float,2>{0.172001362f, 0.393915147f},
-std::array<float,2>{0.965924263f, 0.850786507f},
-std::array<float,2>{0.676149905f, 0.13437891f},
-std::array<float,2>{0.499212295f, 0.685675561f},
-std::array<float,2>{0.256002426f, 0.00576474145f},
-std::array<float,2>{0.500323951f, 0.542614698f},
-std::array<float,2>{0.869460344f, 0.276908368f},
-std::array<float,2>{0.0659500584f, 0.964520395f},
-std::array<float,2>{0.153577194f, 0.147536695f},
-std::array<float,2>{0.980606973f, 0.664729893f},
-std::array<float,2>{0.648577929f, 0.379414797f},
-std::array<float,2>{0.441366434f, 0.867049515f},
-std::array<float,2>{0.312168926f, 0.260764688f},
-std::array<float,2>{0.544428051f, 0.939466536f},
-std::array<float,2>{0.83134371f, 0.0248929374f},
-std::array<float,2>{0.108996883f, 0.551277041f},
-std::array<float,2>{0.053955175f, 0.466009855f},
-std::array<float,2>{0.80663991f, 0.767927408f},
-std::array<float,2>{0.61920023f, 0.247938976f},
-std::array<float,2>{0.326647937f, 0.725984037f},
-std::array<float,2>{0.412548035f, 0.117452651f},
-std::array<float,2>{0.691884696f, 0.622193575f},
-std::array<float,2>{0.904128432f, 0.370086938f},
-std::array<float,2>{0.236220479f, 0.93012315f},
-std::array<float,2>{0.0868753493f, 0.058443293f},
-std::array<float,2>{0.845993757f, 0.521629691f},
-std::array<float,2>{0.515880466f, 0.3093355f},
-std::array<float,2>{0.266835541f, 0.974434197f},
-std::array<float,2>{0.474969655f, 0.406679213f},
-std::array<float,2>{0.663421869f, 0.833376408f},
-std::array<float,2>{0.951680958f, 0.176572233f},
-std::array<float,2>{0.161379978f, 0.63156724f},
-std::array<float,2>{0.199741587f, 0.323514521f},
-std::array<float,2>{0.922364235f, 0.880619407f},
-std::array<float,2>{0.736619592f, 0.0822338536f},
-std::array<float,2>{0.376076758f, 0.568394363f},
-std::array<float,2>{0.357101917f, 0.187561721f},
-std::array<float,2>{0.574727535f, 0.715715468f},
-std::array<float,2>{0.751701236f, 0.493080199f},
-std::array<float,2>{0.00525939744f, 0.783329189f},
-std::array<float,2>{0.166331604f, 0.0192018207f},
-std::array<float,2>{0.944830775f, 0.555847228f},
-std::array<float,2>{0.66952014f, 0.257712543f},
-std::array<float,2>{0.48071599f, 0.949580312f},
-std::array<float,2>{0.280500621f, 0.386470377f},
-std::array<float,2>{0.528697193f, 0.872787893f},
-std::array<float,2>{0.852139175f, 0.15063028f},
-std::array<float,2>{0.0790913999f, 0.661391914f},
-std::array<float,2>{0.0105674323f, 0.36288166f},
-std::array<float,2>{0.764348626f, 0.922792554f},
-std::array<float,2>{0.564111471f, 0.111520149f},
-std::array<float,2>{0.349365175f, 0.616773009f},
-std::array<float,2>{0.386437774f, 0.238884196f},
-std::array<float,2>{0.744003594f, 0.732403159f},
-std::array<float,2>{0.936436892f, 0.456018209f},
-std::array<float,2>{0.193269968f, 0.776791096f},
-std::array<float,2>{0.0982140228f, 0.18670018f},
-std::array<float,2>{0.839592099f, 0.637531936f},
-std::array<float,2>{0.537060797f, 0.41815874f},
-std::array<float,2>{0.303227365f, 0.840879202f},
-std::array<float,2>{0.447866023f, 0.301898956f},
-std::array<float,2>{0.646117389f, 0.980485797f},
-std::array<float,2>{0.97457093f, 0.0536844693f},
-std::array<float,2>{0.141246289f, 0.528967559f},
-std::array<float,2>{0.243604228f, 0.485956341f},
-std::array<float,2>{0.892503619f, 0.794970214f},
-std::array<float,2>{0.697733402f, 0.201661363f},
-std::array<float,2>{0.416522384f, 0.704009116f},
-std::array<float,2>{0.318171799f, 0.0870988891f},
-std::array<float,2>{0.611826897f, 0.575007856f},
-std::array<float,2>{0.804406404f, 0.316666156f},
-std::array<float,2>{0.0575058088f, 0.88733381f},
-std::array<float,2>{0.207739949f, 0.209199518f},
-std::array<float,2>{0.908425331f, 0.699299872f},
-std::array<float,2>{0.720937669f, 0.483686119f},
-std::array<float,2>{0.392921358f, 0.804611385f},
-std::array<float,2>{0.373702914f, 0.328393728f},
-std::array<float,2>{0.585303724f, 0.906093836f},
-std::array<float,2>{0.766573489f, 0.0661917105f},
-std::array<float,2>{0.0182692111f, 0.586748838f},
-std::array<float,2>{0.0705366358f, 0.427534997f},
-std::array<float,2>{0.860187829f, 0.821209788f},
-std::array<float,2>{0.513417244f, 0.159137636f},
-std::array<float,2>{0.257875144f, 0.644552469f},
-std::array<float,2>{0.486142814f, 0.0372738615f},
-std::array<float,2>{0.683206558f, 0.509853363f},
-std::array<float,2>{0.959801912f, 0.28429535f},
-std::array<float,2>{0.185340881f, 0.984755099f},
-std::array<float,2>{0.0448818058f, 0.103323057f},
-std::array<float,2>{0.781710029f, 0.600077748f},
-std::array<float,2>{0.601663291f, 0.349232465f},
-std::array<float,2>{0.331519723f, 0.913700402f},
-std::array<float,2>{0.432995319f, 0.448795319f},
-std::array<float,2>{0.707712948f, 0.751881897f},
-std::array<float,2>{0.882924438f, 0.231747091f},
-std::array<float,2>{0.232289568f, 0.739692032f},
-std::array<float,2>{0.128063262f, 0.269022316f},
-std::array<float,2>{0.999386013f, 0.960261106f},
-std::array<float,2>{0.626418948f, 0.0139996558f},
-std::array<float,2>{0.453935266f, 0.53841269f},
-std::array<float,2>{0.293500036f, 0.129188001f},
-std::array<float,2>{0.553574443f, 0.676197946f},
-std::array<float,2>{0.820363104f, 0.400342554f},
-std::array<float,2>{0.119240686f, 0.856690168f},
-std::array<float,2>{0.128952533f, 0.0813889056f},
-std::array<float,2>{0.995382667f, 0.565180182f},
-std::array<float,2>{0.630581677f, 0.327965289f},
-std::array<float,2>{0.459025681f, 0.876848936f},
-std::array<float,2>{0.291844279f, 0.497810006f},
-std::array<float,2>{0.547166407f, 0.786424994f},
-std::array<float,2>{0.827979326f, 0.19149752f},
-std::array<float,2>{0.123217613f, 0.71226269f},
-std::array<float,2>{0.0393478796f, 0.306894958f},
-std::array<float,2>{0.785593569f, 0.969513893f},
-std::array<float,2>{0.605959117f, 0.0617883392f},
-std::array<float,2>{0.332296491f, 0.517248571f},
-std::array<float,2>{0.434665203f, 0.173013911f},
-std::array<float,2>{0.703938961f, 0.628881216f},
-std::array<float,2>{0.890606046f, 0.412284017f},
-std::array<float,2>{0.230200827f, 0.830108821f},
-std::array<float,2>{0.0768514127f, 0.244965538f},
-std::array<float,2>{0.865210593f, 0.721281469f},
-std::array<float,2>{0.509147167f, 0.463462293f},
-std::array<float,2>{0.264721394f, 0.771678567f},
-std::array<float,2>{0.491239458f, 0.374937952f},
-std::array<float,2>{0.683950305f, 0.934125364f},
-std::array<float,2>{0.953993261f, 0.12122605f},
-std::array<float,2>{0.180287197f, 0.618307173f},
-std::array<float,2>{0.205327138f, 0.37888512f},
-std::array<float,2>{0.913674831f, 0.862985373f},
-std::array<float,2>{0.72374016f, 0.142999679f},
-std::array<float,2>{0.396229148f, 0.671696424f},
-std::array<float,2>{0.368346542f, 0.0296282172f},
-std::array<float,2>{0.579339027f, 0.549541295f},
-std::array<float,2>{0.773106337f, 0.264303327f},
-std::array<float,2>{0.0231882166f, 0.941529274f},
-std::array<float,2>{0.248732746f, 0.138948366f},
-std::array<float,2>{0.896086812f, 0.679697871f},
-std::array<float,2>{0.699336767f, 0.396473706f},
-std::array<float,2>{0.419364005f, 0.846428335f},
-std::array<float,2>{0.31300804f, 0.278733283f},
-std::array<float,2>{0.613511503f, 0.967207432f},
-std::array<float,2>{0.799921393f, 0.0004230536f},
-std::array<float,2>{0.06241237f, 0.546338439f},
-std::array<float,2>{0.0949013159f, 0.439219683f},
-std::array<float,2>{0.839949071f, 0.764103949f},
-std::array<float,2>{0.532543004f, 0.22137934f},
-std::array<float,2>{0.297359884f, 0.742982268f},
-std::array<float,2>{0.453064322f, 0.0987304375f},
-std::array<float,2>{0.641322017f, 0.606959164f},
-std::array<float,2>{0.971812487f, 0.354885817f},
-std::array<float,2>{0.14506726f, 0.916031837f},
-std::array<float,2>{0.0126728648f, 0.0411288813f},
-std::array<float,2>{0.759612501f, 0.50190413f},
-std::array<float,2>{0.567753136f, 0.290012121f},
-std::array<float,2>{0.345246494f, 0.999662101f},
-std::array<float,2>{0.387122065f, 0.435151905f},
-std::array<float,2>{0.748696566f, 0.819977045f},
-std::array<float,2>{0.933103681f, 0.168124571f},
-std::array<float,2>{0.187921882f, 0.652594745f},
-std::array<float,2>{0.171674937f, 0.339385211f},
-std::array<float,2>{0.94124186f, 0.894385099f},
-std::array<float,2>{0.666835725f, 0.0773207098f},
-std::array<float,2>{0.479249656f, 0.58102119f},
-std::array<float,2>{0.274931282f, 0.212364912f},
-std::array<float,2>{0.524490535f, 0.688291311f},
-std::array<float,2>{0.857783079f, 0.475585371f},
-std::array<float,2>{0.0847415105f, 0.805481076f},
-std::array<float,2>{0.196561471f, 0.0113604302f},
-std::array<float,2>{0.925890625f, 0.531367362f},
-std::array<float,2>{0.738543272f, 0.273134649f},
-std::array<float,2>{0.382337183f, 0.956503689f},
-std::array<float,2>{0.352757692f, 0.405211568f},
-std::array<float,2>{0.571588576f, 0.852099299f},
-std::array<float,2>{0.756679893f, 0.127373993f},
-std::array<float,2>{0.00100927765f, 0.675277531f},
-std::array<float,2>{0.0914466083f, 0.343944579f},
-std::array<float,2>{0.851471543f, 0.908990324f},
-std::array<float,2>{0.521343231f, 0.108423539f},
-std::array<float,2>{0.270716488f, 0.594409823f},
-std::array<float,2>{0.469695389f, 0.228703797f},
-std::array<float,2>{0.658414841f, 0.737355471f},
-std::array<float,2>{0.948375821f, 0.452599496f},
-std::array<float,2>{0.156741515f, 0.754986882f},
-std::array<float,2>{0.0469035171f, 0.163098633f},
-std::array<float,2>{0.811704099f, 0.642050862f},
-std::array<float,2>{0.622163415f, 0.425641835f},
-std::array<float,2>{0.323457092f, 0.827714145f},
-std::array<float,2>{0.408507824f, 0.285746872f},
-std::array<float,2>{0.687951565f, 0.991748631f},
-std::array<float,2>{0.898600698f, 0.0334386528f},
-std::array<float,2>{0.238344878f, 0.513864636f},
-std::array<float,2>{0.150373176f, 0.477487832f},
-std::array<float,2>{0.979031444f, 0.79836446f},
-std::array<float,2>{0.652554333f, 0.203416601f},
-std::array<float,2>{0.445154935f, 0.6983096f},
-std::array<float,2>{0.307446331f, 0.0695159808f},
-std::array<float,2>{0.540381789f, 0.592276394f},
-std::array<float,2>{0.835765839f, 0.332250774f},
-std::array<float,2>{0.103865728f, 0.899953902f},
-std::array<float,2>{0.177012175f, 0.197382465f},
-std::array<float,2>{0.96340549f, 0.707727551f},
-std::array<float,2>{0.67402029f, 0.490200728f},
-std::array<float,2>{0.495602965f, 0.792645276f},
-std::array<float,2>{0.252685338f, 0.316042602f},
-std::array<float,2>{0.505797803f, 0.884681642f},
-std::array<float,2>{0.872867644f, 0.0905934274f},
-std::array<float,2>{0.0700016543f, 0.573583722f},
-std::array<float,2>{0.0274410397f, 0.417763442f},
-std::array<float,2>{0.78047204f, 0.839174628f},
-std::array<float,2>{0.593206286f, 0.179935262f},
-std::array<float,2>{0.361527205f, 0.636713922f},
-std::array<float,2>{0.403566092f, 0.0483389646f},
-std::array<float,2>{0.727616549f, 0.52358228f},
-std::array<float,2>{0.917001009f, 0.299128264f},
-std::array<float,2>{0.215306774f, 0.978949368f},
-std::array<float,2>{0.116319537f, 0.114033446f},
-std::array<float,2>{0.817920446f, 0.612595558f},
-std::array<float,2>{0.555256844f, 0.365188241f},
-std::array<float,2>{0.285434991f, 0.928721189f},
-std::array<float,2>{0.466281623f, 0.459940821f},
-std::array<float,2>{0.636905253f, 0.779352844f},
-std::array<float,2>{0.991479337f, 0.235696018f},
-std::array<float,2>{0.1358172f, 0.729990602f},
-std::array<float,2>{0.223791659f, 0.25041911f},
-std::array<float,2>{0.878198087f, 0.947890282f},
-std::array<float,2>{0.711176395f, 0.0197945498f},
-std::array<float,2>{0.423588604f, 0.560823083f},
-std::array<float,2>{0.338575691f, 0.155178621f},
-std::array<float,2>{0.596567392f, 0.658638179f},
-std::array<float,2>{0.790826619f, 0.388306022f},
-std::array<float,2>{0.0370119065f, 0.867663383f},
-std::array<float,2>{0.231655926f, 0.105147369f},
-std::array<float,2>{0.883518279f, 0.599242091f},
-std::array<float,2>{0.707424343f, 0.349785596f},
-std::array<float,2>{0.433345705f, 0.912052035f},
-std::array<float,2>{0.3316845f, 0.445340872f},
-std::array<float,2>{0.602300227f, 0.753584146f},
-std::array<float,2>{0.781960011f, 0.232528627f},
-std::array<float,2>{0.0443521775f, 0.740251482f},
-std::array<float,2>{0.119831629f, 0.26606673f},
-std::array<float,2>{0.821235716f, 0.958782315f},
-std::array<float,2>{0.552839577f, 0.0130276615f},
-std::array<float,2>{0.293381304f, 0.535455704f},
-std::array<float,2>{0.453341156f, 0.132692188f},
-std::array<float,2>{0.626568556f, 0.678365946f},
-std::array<float,2>{0.999632776f, 0.401642531f},
-std::array<float,2>{0.128771096f, 0.857563078f},
-std::array<float,2>{0.0180307161f, 0.208274916f},
-std::array<float,2>{0.765661716f, 0.701519966f},
-std::array<float,2>{0.585695446f, 0.482063711f},
-std::array<float,2>{0.37324962f, 0.800792694f},
-std::array<float,2>{0.393416703f, 0.330569535f},
-std::array<float,2>{0.721290588f, 0.902806103f},
-std::array<float,2>{0.909035563f, 0.0632860512f},
-std::array<float,2>{0.207117036f, 0.589686573f},
-std::array<float,2>{0.18499361f, 0.428957105f},
-std::array<float,2>{0.95910573f, 0.823565781f},
-std::array<float,2>{0.682932913f, 0.157950312f},
-std::array<float,2>{0.485706896f, 0.647343457f},
-std::array<float,2>{0.258370578f, 0.0359472968f},
-std::array<float,2>{0.512883365f, 0.509563029f},
-std::array<float,2>{0.859845459f, 0.281898707f},
-std::array<float,2>{0.0708284527f, 0.988113284f},
-std::array<float,2>{0.141084284f, 0.18386741f},
-std::array<float,2>{0.974112988f, 0.640331209f},
-std::array<float,2>{0.645693183f, 0.42185697f},
-std::array<float,2>{0.447469056f, 0.842723727f},
-std::array<float,2>{0.30293107f, 0.303013831f},
-std::array<float,2>{0.536409557f, 0.983495057f},
-std::array<float,2>{0.838915408f, 0.0519638881f},
-std::array<float,2>{0.0977718458f, 0.529719293f},
-std::array<float,2>{0.0570069328f, 0.486855239f},
-std::array<float,2>{0.803884089f, 0.794889867f},
-std::array<float,2>{0.611467361f, 0.199522808f},
-std::array<float,2>{0.317866921f, 0.705937922f},
-std::array<float,2>{0.416050941f, 0.0888793916f},
-std::array<float,2>{0.697913945f, 0.577409208f},
-std::array<float,2>{0.891916871f, 0.320043385f},
-std::array<float,2>{0.243907675f, 0.888707042f},
-std::array<float,2>{0.078535445f, 0.0160973351f},
-std::array<float,2>{0.851721764f, 0.557914615f},
-std::array<float,2>{0.529148817f, 0.254865378f},
-std::array<float,2>{0.280947626f, 0.95261085f},
-std::array<float,2>{0.481396914f, 0.384415686f},
-std::array<float,2>{0.669020474f, 0.87384069f},
-std::array<float,2>{0.944790483f, 0.150153086f},
-std::array<float,2>{0.166938916f, 0.662192762f},
-std::array<float,2>{0.192485943f, 0.359444886f},
-std::array<float,2>{0.935782015f, 0.925592601f},
-std::array<float,2>{0.743625879f, 0.111102246f},
-std::array<float,2>{0.386174023f, 0.61357677f},
-std::array<float,2>{0.348936319f, 0.241202101f},
-std::array<float,2>{0.563796043f, 0.733891785f},
-std::array<float,2>{0.764024675f, 0.45468992f},
-std::array<float,2>{0.0101563539f, 0.775184691f},
-std::array<float,2>{0.161904871f, 0.0553427935f},
-std::array<float,2>{0.951564491f, 0.520107985f},
-std::array<float,2>{0.663658142f, 0.311854422f},
-std::array<float,2>{0.475178629f, 0.976059377f},
-std::array<float,2>{0.267519057f, 0.410105258f},
-std::array<float,2>{0.516165078f, 0.835680008f},
-std::array<float,2>{0.846601367f, 0.17861861f},
-std::array<float,2>{0.0860143527f, 0.629376948f},
-std::array<float,2>{0.00556471292f, 0.32060954f},
-std::array<float,2>{0.75101465f, 0.881569505f},
-std::array<float,2>{0.574234486f, 0.0856312886f},
-std::array<float,2>{0.356741071f, 0.567648292f},
-std::array<float,2>{0.376702726f, 0.190110192f},
-std::array<float,2>{0.736840248f, 0.717040718f},
-std::array<float,2>{0.921891987f, 0.494968563f},
-std::array<float,2>{0.199372932f, 0.78227973f},
-std::array<float,2>{0.108418718f, 0.145528376f},
-std::array<float,2>{0.831733346f, 0.667071998f},
-std::array<float,2>{0.544865251f, 0.380904794f},
-std::array<float,2>{0.311589926f, 0.864496768f},
-std::array<float,2>{0.440748423f, 0.258704901f},
-std::array<float,2>{0.649066687f, 0.9377321f},
-std::array<float,2>{0.981183112f, 0.0257549919f},
-std::array<float,2>{0.154049635f, 0.554109156f},
-std::array<float,2>{0.235587344f, 0.466899961f},
-std::array<float,2>{0.903735578f, 0.767468691f},
-std::array<float,2>{0.69208014f, 0.249298468f},
-std::array<float,2>{0.412788749f, 0.723177195f},
-std::array<float,2>{0.326899022f, 0.120392077f},
-std::array<float,2>{0.619873047f, 0.624957204f},
-std::array<float,2>{0.805931985f, 0.36719963f},
-std::array<float,2>{0.0544036962f, 0.93356508f},
-std::array<float,2>{0.212979242f, 0.224434406f},
-std::array<float,2>{0.919077456f, 0.747126579f},
-std::array<float,2>{0.731942117f, 0.444042385f},
-std::array<float,2>{0.400351405f, 0.760969639f},
-std::array<float,2>{0.364406765f, 0.356840551f},
-std::array<float,2>{0.586749911f, 0.919970572f},
-std::array<float,2>{0.776546597f, 0.0954365581f},
-std::array<float,2>{0.0247065015f, 0.602513134f},
-std::array<float,2>{0.0655392706f, 0.391621053f},
-std::array<float,2>{0.86996007f, 0.849102199f},
-std::array<float,2>{0.500784814f, 0.135052606f},
-std::array<float,2>{0.256636441f, 0.685476899f},
-std::array<float,2>{0.499579489f, 0.00692435587f},
-std::array<float,2>{0.676405549f, 0.54023093f},
-std::array<float,2>{0.966411054f, 0.274119735f},
-std::array<float,2>{0.17249985f, 0.961148739f},
-std::array<float,2>{0.0324260704f, 0.0729731545f},
-std::array<float,2>{0.795862854f, 0.585839927f},
-std::array<float,2>{0.598300338f, 0.342092335f},
-std::array<float,2>{0.340919495f, 0.895317495f},
-std::array<float,2>{0.429673523f, 0.470116913f},
-std::array<float,2>{0.717862427f, 0.811314821f},
-std::array<float,2>{0.881614268f, 0.216451645f},
-std::array<float,2>{0.221108273f, 0.694065154f},
-std::array<float,2>{0.13711141f, 0.294313163f},
-std::array<float,2>{0.986425936f, 0.995163202f},
-std::array<float,2>{0.633130431f, 0.0452529415f},
-std::array<float,2>{0.461220235f, 0.505019724f},
-std::array<float,2>{0.282636732f, 0.167569295f},
-std::array<float,2>{0.562199175f, 0.648933947f},
-std::array<float,2>{0.812687576f, 0.43053627f},
-std::array<float,2>{0.112127006f, 0.813900113f},
-std::array<float,2>{0.182752788f, 0.124604054f},
-std::array<float,2>{0.95622462f, 0.619488955f},
-std::array<float,2>{0.686145246f, 0.372653544f},
-std::array<float,2>{0.489961207f, 0.936169982f},
-std::array<float,2>{0.262405545f, 0.46213308f},
-std::array<float,2>{0.511624634f, 0.771130443f},
-std::array<float,2>{0.86656642f, 0.243856728f},
-std::array<float,2>{0.0748659372f, 0.719592929f},
-std::array<float,2>{0.0214694366f, 0.263508648f},
-std::array<float,2>{0.771390259f, 0.944463253f},
-std::array<float,2>{0.581074774f, 0.0278826356f},
-std::array<float,2>{0.370694548f, 0.548621595f},
-std::array<float,2>{0.398149848f, 0.140799701f},
-std::array<float,2>{0.725831449f, 0.668453753f},
-std::array<float,2>{0.911715567f, 0.375671118f},
-std::array<float,2>{0.204553008f, 0.859549463f},
-std::array<float,2>{0.121609949f, 0.194614738f},
-std::array<float,2>{0.825342119f, 0.713076711f},
-std::array<float,2>{0.549046814f, 0.4987275f},
-std::array<float,2>{0.289281189f, 0.788140535f},
-std::array<float,2>{0.458277017f, 0.324759871f},
-std::array<float,2>{0.631184638f, 0.877322435f},
-std::array<float,2>{0.99413532f, 0.0782973543f},
-std::array<float,2>{0.131220371f, 0.563719928f},
-std::array<float,2>{0.22759968f, 0.410804063f},
-std::array<float,2>{0.888662934f, 0.829495192f},
-std::array<float,2>{0.706942081f, 0.174385875f},
-std::array<float,2>{0.436759591f, 0.625363469f},
-std::array<float,2>{0.335108131f, 0.0591456331f},
-std::array<float,2>{0.608696759f, 0.518657506f},
-std::array<float,2>{0.787255645f, 0.304939151f},
-std::array<float,2>{0.0425142832f, 0.972389162f},
-std::array<float,2>{0.191297308f, 0.171020404f},
-std::array<float,2>{0.93097502f, 0.655184984f},
-std::array<float,2>{0.747606814f, 0.436995745f},
-std::array<float,2>{0.38883689f, 0.81692487f},
-std::array<float,2>{0.346147835f, 0.292917073f},
-std::array<float,2>{0.570036292f, 0.996370137f},
-std::array<float,2>{0.761157811f, 0.0396740027f},
-std::array<float,2>{0.01385218f, 0.503193676f},
-std::array<float,2>{0.0826630518f, 0.473455846f},
-std::array<float,2>{0.855969548f, 0.807270408f},
-std::array<float,2>{0.525783598f, 0.214043736f},
-std::array<float,2>{0.276186943f, 0.69032073f},
-std::array<float,2>{0.478221416f, 0.0754020289f},
-std::array<float,2>{0.664729655f, 0.578239799f},
-std::array<float,2>{0.937592983f, 0.337398589f},
-std::array<float,2>{0.168162704f, 0.892220199f},
-std::array<float,2>{0.0592255816f, 0.00281265704f},
-std::array<float,2>{0.796899915f, 0.544784129f},
-std::array<float,2>{0.617162049f, 0.280441165f},
-std::array<float,2>{0.314823955f, 0.9652946f},
-std::array<float,2>{0.420526832f, 0.39784652f},
-std::array<float,2>{0.702103376f, 0.844256341f},
-std::array<float,2>{0.89795351f, 0.138541102f},
-std::array<float,2>{0.247303903f, 0.68280822f},
-std::array<float,2>{0.146995917f, 0.352057397f},
-std::array<float,2>{0.969727874f, 0.915188909f},
-std::array<float,2>{0.642614901f, 0.100211181f},
-std::array<float,2>{0.451113224f, 0.607719183f},
-std::array<float,2>{0.300334364f, 0.219788402f},
-std::array<float,2>{0.535101235f, 0.745840371f},
-std::array<float,2>{0.842472672f, 0.440045923f},
-std::array<float,2>{0.0963222831f, 0.763220489f},
-std::array<float,2>{0.242055237f, 0.0326972976f},
-std::array<float,2>{0.901955485f, 0.513562202f},
-std::array<float,2>{0.690114856f, 0.287398726f},
-std::array<float,2>{0.40777871f, 0.988660991f},
-std::array<float,2>{0.320941389f, 0.422746986f},
-std::array<float,2>{0.624667704f, 0.824796855f},
-std::array<float,2>{0.808754683f, 0.161177769f},
-std::array<float,2>{0.0505277589f, 0.643414319f},
-std::array<float,2>{0.101662897f, 0.334390461f},
-std::array<float,2>{0.833439887f, 0.901659191f},
-std::array<float,2>{0.541759133f, 0.0667941943f},
-std::array<float,2>{0.305224061f, 0.590585768f},
-std::array<float,2>{0.441853523f, 0.206203997f},
-std::array<float,2>{0.655607641f, 0.695676863f},
-std::array<float,2>{0.978175223f, 0.479888022f},
-std::array<float,2>{0.152095824f, 0.800763726f},
-std::array<float,2>{0.00330583681f, 0.126724005f},
-std::array<float,2>{0.75406301f, 0.672900677f},
-std::array<float,2>{0.573350668f, 0.402496338f},
-std::array<float,2>{0.35410431f, 0.854735613f},
-std::array<float,2>{0.380492479f, 0.270425171f},
-std::array<float,2>{0.740817428f, 0.953936398f},
-std::array<float,2>{0.928878903f, 0.00922620483f},
-std::array<float,2>{0.197603345f, 0.534638703f},
-std::array<float,2>{0.159385517f, 0.449655622f},
-std::array<float,2>{0.945567429f, 0.757021904f},
-std::array<float,2>{0.657761812f, 0.228399292f},
-std::array<float,2>{0.471627951f, 0.73476398f},
-std::array<float,2>{0.273136139f, 0.105867364f},
-std::array<float,2>{0.522794485f, 0.596367836f},
-std::array<float,2>{0.849479377f, 0.346726447f},
-std::array<float,2>{0.0924792737f, 0.906269372f},
-std::array<float,2>{0.132838145f, 0.238240987f},
-std::array<float,2>{0.990228832f, 0.727054358f},
-std::array<float,2>{0.639039755f, 0.45808965f},
-std::array<float,2>{0.467782557f, 0.777938664f},
-std::array<float,2>{0.289031714f, 0.366913795f},
-std::array<float,2>{0.558137238f, 0.926385641f},
-std::array<float,2>{0.819125235f, 0.116520055f},
-std::array<float,2>{0.114843249f, 0.610431075f},
-std::array<float,2>{0.0374673121f, 0.389005929f},
-std::array<float,2>{0.791469336f, 0.870827138f},
-std::array<float,2>{0.594636142f, 0.152953058f},
-std::array<float,2>{0.336597592f, 0.657791495f},
-std::array<float,2>{0.425149858f, 0.0215978827f},
-std::array<float,2>{0.713039517f, 0.55988729f},
-std::array<float,2>{0.875401556f, 0.253607273f},
-std::array<float,2>{0.225314945f, 0.945741892f},
-std::array<float,2>{0.0678006411f, 0.0918754935f},
-std::array<float,2>{0.874116421f, 0.570992529f},
-std::array<float,2>{0.507234275f, 0.313558668f},
-std::array<float,2>{0.251297563f, 0.884997189f},
-std::array<float,2>{0.494082987f, 0.491082191f},
-std::array<float,2>{0.672622263f, 0.790092468f},
-std::array<float,2>{0.96236372f, 0.196326405f},
-std::array<float,2>{0.177846551f, 0.709049821f},
-std::array<float,2>{0.217160106f, 0.297818333f},
-std::array<float,2>{0.914551198f, 0.977917612f},
-std::array<float,2>{0.729241431f, 0.0497311093f},
-std::array<float,2>{0.404652357f, 0.526389658f},
-std::array<float,2>{0.360365391f, 0.182980269f},
-std::array<float,2>{0.5913679f, 0.634529829f},
-std::array<float,2>{0.778078914f, 0.414813042f},
-std::array<float,2>{0.0310234297f, 0.836516619f},
-std::array<float,2>{0.209102094f, 0.0657805949f},
-std::array<float,2>{0.90740186f, 0.585959077f},
-std::array<float,2>{0.720015228f, 0.328919709f},
-std::array<float,2>{0.390940309f, 0.905485451f},
-std::array<float,2>{0.372283876f, 0.484064639f},
-std::array<float,2>{0.582498252f, 0.804186881f},
-std::array<float,2>{0.768520653f, 0.20966588f},
-std::array<float,2>{0.0160658881f, 0.699767411f},
-std::array<float,2>{0.0739212483f, 0.284825504f},
-std::array<float,2>{0.861549437f, 0.985053241f},
-std::array<float,2>{0.513986588f, 0.037660744f},
-std::array<float,2>{0.260180324f, 0.510289013f},
-std::array<float,2>{0.487271428f, 0.158515409f},
-std::array<float,2>{0.681381524f, 0.64549911f},
-std::array<float,2>{0.958233476f, 0.427092344f},
-std::array<float,2>{0.186805204f, 0.820401967f},
-std::array<float,2>{0.0467245951f, 0.232341051f},
-std::array<float,2>{0.784717262f, 0.739979923f},
-std::array<float,2>{0.604416609f, 0.448263735f},
-std::array<float,2>{0.328557789f, 0.751096725f},
-std::array<float,2>{0.429738909f, 0.349105954f},
-std::array<float,2>{0.709063053f, 0.913522243f},
-std::array<float,2>{0.886151731f, 0.102789633f},
-std::array<float,2>{0.232593164f, 0.600256979f},
-std::array<float,2>{0.125297517f, 0.399492294f},
-std::array<float,2>{0.996925712f, 0.857124269f},
-std::array<float,2>{0.626979232f, 0.129415005f},
-std::array<float,2>{0.456207335f, 0.676680803f},
-std::array<float,2>{0.296803415f, 0.0145206386f},
-std::array<float,2>{0.551813126f, 0.538739562f},
-std::array<float,2>{0.823358178f, 0.269215673f},
-std::array<float,2>{0.118167996f, 0.960555375f},
-std::array<float,2>{0.164886877f, 0.15112865f},
-std::array<float,2>{0.943353295f, 0.662060022f},
-std::array<float,2>{0.671297491f, 0.386069179f},
-std::array<float,2>{0.482482731f, 0.872141361f},
-std::array<float,2>{0.27898109f, 0.257281721f},
-std::array<float,2>{0.529903412f, 0.950042665f},
-std::array<float,2>{0.853976786f, 0.0187347531f},
-std::array<float,2>{0.0806066319f, 0.556284904f},
-std::array<float,2>{0.00905154459f, 0.455349863f},
-std::array<float,2>{0.762859285f, 0.776998341f},
-std::array<float,2>{0.566070914f, 0.238700524f},
-std::array<float,2>{0.350592941f, 0.731681466f},
-std::array<float,2>{0.383476287f, 0.112034224f},
-std::array<float,2>{0.745897532f, 0.616488934f},
-std::array<float,2>{0.934832156f, 0.362378418f},
-std::array<float,2>{0.195297644f, 0.922095656f},
-std::array<float,2>{0.101338886f, 0.0530178174f},
-std::array<float,2>{0.836837947f, 0.528602064f},
-std::array<float,2>{0.537583768f, 0.302661777f},
-std::array<float,2>{0.302569926f, 0.981185019f},
-std::array<float,2>{0.445544124f, 0.41860804f},
-std::array<float,2>{0.646725476f, 0.841513395f},
-std::array<float,2>{0.975337148f, 0.187417373f},
-std::array<float,2>{0.14334695f, 0.636792004f},
-std::array<float,2>{0.245586604f, 0.317361593f},
-std::array<float,2>{0.893717825f, 0.88710463f},
-std::array<float,2>{0.696308076f, 0.087855719f},
-std::array<float,2>{0.414475173f, 0.574294865f},
-std::array<float,2>{0.320152551f, 0.201589823f},
-std::array<float,2>{0.611080408f, 0.7034688f},
-std::array<float,2>{0.801616311f, 0.485761851f},
-std::array<float,2>{0.0558916256f, 0.795484066f},
-std::array<float,2>{0.155413359f, 0.0249322634f},
-std::array<float,2>{0.982550323f, 0.551055014f},
-std::array<float,2>{0.651350737f, 0.261334568f},
-std::array<float,2>{0.438818395f, 0.940199733f},
-std::array<float,2>{0.310048789f, 0.379351228f},
-std::array<float,2>{0.545457363f, 0.866559625f},
-std::array<float,2>{0.829324901f, 0.148366973f},
-std::array<float,2>{0.106372222f, 0.66414237f},
-std::array<float,2>{0.0520809181f, 0.369393468f},
-std::array<float,2>{0.807532787f, 0.930603683f},
-std::array<float,2>{0.617639661f, 0.117780112f},
-std::array<float,2>{0.325014889f, 0.62280333f},
-std::array<float,2>{0.411834121f, 0.247468218f},
-std::array<float,2>{0.693441927f, 0.726448178f},
-std::array<float,2>{0.906099796f, 0.466712058f},
-std::array<float,2>{0.238137707f, 0.768393874f},
-std::array<float,2>{0.088394016f, 0.175961226f},
-std::array<float,2>{0.845690489f, 0.631142199f},
-std::array<float,2>{0.518963397f, 0.406986624f},
-std::array<float,2>{0.268466353f, 0.833676279f},
-std::array<float,2>{0.474019289f, 0.308719516f},
-std::array<float,2>{0.660748422f, 0.973920166f},
-std::array<float,2>{0.950482726f, 0.0577643104f},
-std::array<float,2>{0.163181335f, 0.522301614f},
-std::array<float,2>{0.201512277f, 0.492191941f},
-std::array<float,2>{0.924675703f, 0.78393811f},
-std::array<float,2>{0.735153556f, 0.188271746f},
-std::array<float,2>{0.377005994f, 0.715070069f},
-std::array<float,2>{0.35818392f, 0.0829127058f},
-std::array<float,2>{0.577097476f, 0.569056809f},
-std::array<float,2>{0.753410459f, 0.324200392f},
-std::array<float,2>{0.00671965862f, 0.879901707f},
-std::array<float,2>{0.220188096f, 0.21707426f},
-std::array<float,2>{0.880010784f, 0.692044973f},
-std::array<float,2>{0.71659714f, 0.471672893f},
-std::array<float,2>{0.427052617f, 0.808700919f},
-std::array<float,2>{0.341958344f, 0.341485709f},
-std::array<float,2>{0.600043714f, 0.896526814f},
-std::array<float,2>{0.793662131f, 0.070833981f},
-std::array<float,2>{0.0339555815f, 0.583882749f},
-std::array<float,2>{0.111085996f, 0.433094412f},
-std::array<float,2>{0.815042496f, 0.815283954f},
-std::array<float,2>{0.559178174f, 0.165944397f},
-std::array<float,2>{0.284893423f, 0.650600791f},
-std::array<float,2>{0.463781685f, 0.0449059978f},
-std::array<float,2>{0.636005819f, 0.506726265f},
-std::array<float,2>{0.984634399f, 0.296819687f},
-std::array<float,2>{0.139067203f, 0.992688835f},
-std::array<float,2>{0.0271029323f, 0.0968414992f},
-std::array<float,2>{0.773742676f, 0.603566706f},
-std::array<float,2>{0.589708567f, 0.35906285f},
-std::array<float,2>{0.366889924f, 0.918247521f},
-std::array<float,2>{0.401345223f, 0.441999078f},
-std::array<float,2>{0.733210027f, 0.75803268f},
-std::array<float,2>{0.920729339f, 0.225421235f},
-std::array<float,2>{0.211065009f, 0.749954879f},
-std::array<float,2>{0.175491005f, 0.276457608f},
-std::array<float,2>{0.968146145f, 0.963972867f},
-std::array<float,2>{0.6783005f, 0.00529060094f},
-std::array<float,2>{0.497699261f, 0.542307556f},
-std::array<float,2>{0.254668772f, 0.133929461f},
-std::array<float,2>{0.503573775f, 0.686185181f},
-std::array<float,2>{0.867471337f, 0.394191742f},
-std::array<float,2>{0.0625449345f, 0.85115701f},
-std::array<float,2>{0.169411957f, 0.0765536577f},
-std::array<float,2>{0.939088404f, 0.581074119f},
-std::array<float,2>{0.665200412f, 0.338712335f},
-std::array<float,2>{0.477042317f, 0.893229842f},
-std::array<float,2>{0.276956171f, 0.475685358f},
-std::array<float,2>{0.526807249f, 0.806517959f},
-std::array<float,2>{0.857165635f, 0.211694509f},
-std::array<float,2>{0.0836872682f, 0.688597918f},
-std::array<float,2>{0.0150605785f, 0.290655106f},
-std::array<float,2>{0.759941995f, 0.998295009f},
-std::array<float,2>{0.568435729f, 0.0426181145f},
-std::array<float,2>{0.346951663f, 0.500536561f},
-std::array<float,2>{0.389922202f, 0.169597879f},
-std::array<float,2>{0.746259332f, 0.653680742f},
-std::array<float,2>{0.930562794f, 0.434488565f},
-std::array<float,2>{0.190166727f, 0.81888026f},
-std::array<float,2>{0.0969240218f, 0.222008809f},
-std::array<float,2>{0.843039989f, 0.743485868f},
-std::array<float,2>{0.5334993f, 0.438358426f},
-std::array<float,2>{0.299510956f, 0.765523732f},
-std::array<float,2>{0.449465364f, 0.354107082f},
-std::array<float,2>{0.643708766f, 0.917391121f},
-std::array<float,2>{0.969645083f, 0.0979064405f},
-std::array<float,2>{0.148349196f, 0.60553503f},
-std::array<float,2>{0.246786803f, 0.394736886f},
-std::array<float,2>{0.896766603f, 0.847185433f},
-std::array<float,2>{0.702441514f, 0.139735684f},
-std::array<float,2>{0.42120266f, 0.681613922f},
-std::array<float,2>{0.315748662f, 0.00154888572f},
-std::array<float,2>{0.615772367f, 0.545869231f},
-std::array<float,2>{0.798539698f, 0.277873009f},
-std::array<float,2>{0.0604180917f, 0.967922866f},
-std::array<float,2>{0.203756899f, 0.143828362f},
-std::array<float,2>{0.910494387f, 0.670786679f},
-std::array<float,2>{0.725130439f, 0.377702415f},
-std::array<float,2>{0.397060156f, 0.861439466f},
-std::array<float,2>{0.369573891f, 0.265470475f},
-std::array<float,2>{0.580213904f, 0.942608356f},
-std::array<float,2>{0.770044684f, 0.030731149f},
-std::array<float,2>{0.0202843752f, 0.55029422f},
-std::array<float,2>{0.0754855946f, 0.46399495f},
-std::array<float,2>{0.865641952f, 0.772707999f},
-std::array<float,2>{0.509926438f, 0.245459005f},
-std::array<float,2>{0.262886375f, 0.721703231f},
-std::array<float,2>{0.488816738f, 0.122239158f},
-std::array<float,2>{0.686984956f, 0.617267311f},
-std::array<float,2>{0.955785215f, 0.373440862f},
-std::array<float,2>{0.182223544f, 0.935295939f},
-std::array<float,2>{0.041261781f, 0.0610392839f},
-std::array<float,2>{0.788092673f, 0.516550899f},
-std::array<float,2>{0.607914209f, 0.307781041f},
-std::array<float,2>{0.334756374f, 0.969741881f},
-std::array<float,2>{0.436033368f, 0.413618088f},
-std::array<float,2>{0.705528438f, 0.831996083f},
-std::array<float,2>{0.887448788f, 0.172822282f},
-std::array<float,2>{0.227207631f, 0.62750721f},
-std::array<float,2>{0.132476225f, 0.32701093f},
-std::array<float,2>{0.992321014f, 0.875330687f},
-std::array<float,2>{0.632204235f, 0.0807439014f},
-std::array<float,2>{0.457959533f, 0.565529644f},
-std::array<float,2>{0.290675968f, 0.192792386f},
-std::array<float,2>{0.550325632f, 0.711192429f},
-std::array<float,2>{0.824862957f, 0.49626714f},
-std::array<float,2>{0.12217351f, 0.785320759f},
-std::array<float,2>{0.226081446f, 0.0212140307f},
-std::array<float,2>{0.876594305f, 0.56200242f},
-std::array<float,2>{0.71484226f, 0.251408845f},
-std::array<float,2>{0.424116164f, 0.9486292f},
-std::array<float,2>{0.337106794f, 0.386844069f},
-std::array<float,2>{0.595670223f, 0.868378162f},
-std::array<float,2>{0.792188466f, 0.155488312f},
-std::array<float,2>{0.038724497f, 0.659376681f},
-std::array<float,2>{0.113691442f, 0.363554358f},
-std::array<float,2>{0.820112348f, 0.92860055f},
-std::array<float,2>{0.557115138f, 0.114259928f},
-std::array<float,2>{0.287606031f, 0.611548483f},
-std::array<float,2>{0.467247069f, 0.235180929f},
-std::array<float,2>{0.639683902f, 0.729253292f},
-std::array<float,2>{0.9886958f, 0.460801184f},
-std::array<float,2>{0.133889973f, 0.780499637f},
-std::array<float,2>{0.0299619138f, 0.180833057f},
-std::array<float,2>{0.778394878f, 0.634817243f},
-std::array<float,2>{0.590125263f, 0.416990936f},
-std::array<float,2>{0.359455973f, 0.837910712f},
-std::array<float,2>{0.405548424f, 0.300583631f},
-std::array<float,2>{0.729890168f, 0.979946554f},
-std::array<float,2>{0.915374875f, 0.0474478863f},
-std::array<float,2>{0.218559653f, 0.525258303f},
-std::array<float,2>{0.179679126f, 0.488289356f},
-std::array<float,2>{0.961517036f, 0.791200817f},
-std::array<float,2>{0.673251808f, 0.198616743f},
-std::array<float,2>{0.492330939f, 0.708247185f},
-std::array<float,2>{0.250968814f, 0.0917701125f},
-std::array<float,2>{0.506208539f, 0.57322979f},
-std::array<float,2>{0.873294532f, 0.315289259f},
-std::array<float,2>{0.0664211735f, 0.882944167f},
-std::array<float,2>{0.151313603f, 0.204416245f},
-std::array<float,2>{0.976643682f, 0.69740802f},
-std::array<float,2>{0.654749513f, 0.478301972f},
-std::array<float,2>{0.443001568f, 0.797782123f},
-std::array<float,2>{0.306521505f, 0.333982348f},
-std::array<float,2>{0.542261779f, 0.899199903f},
-std::array<float,2>{0.832660317f, 0.0686311424f},
-std::array<float,2>{0.102895856f, 0.592858136f},
-std::array<float,2>{0.0492376573f, 0.424419641f},
-std::array<float,2>{0.809855998f, 0.826877952f},
-std::array<float,2>{0.623142123f, 0.162497997f},
-std::array<float,2>{0.321464956f, 0.640765667f},
-std::array<float,2>{0.406974137f, 0.0344650969f},
-std::array<float,2>{0.690479636f, 0.514752567f},
-std::array<float,2>{0.900980532f, 0.286743075f},
-std::array<float,2>{0.240600571f, 0.99062413f},
-std::array<float,2>{0.0929099098f, 0.107986979f},
-std::array<float,2>{0.848420322f, 0.59493655f},
-std::array<float,2>{0.52210319f, 0.34485957f},
-std::array<float,2>{0.271627635f, 0.909349263f},
-std::array<float,2>{0.471756309f, 0.451788068f},
-std::array<float,2>{0.656747818f, 0.754391134f},
-std::array<float,2>{0.94680953f, 0.229560837f},
-std::array<float,2>{0.158806518f, 0.736500025f},
-std::array<float,2>{0.198358551f, 0.272120506f},
-std::array<float,2>{0.928622425f, 0.955765188f},
-std::array<float,2>{0.742111683f, 0.0106967399f},
-std::array<float,2>{0.379514664f, 0.532790184f},
-std::array<float,2>{0.354895592f, 0.128326401f},
-std::array<float,2>{0.572868288f, 0.674145639f},
-std::array<float,2>{0.755143046f, 0.406188786f},
-std::array<float,2>{0.00211809948f, 0.853024185f},
-std::array<float,2>{0.194185138f, 0.109825857f},
-std::array<float,2>{0.934194207f, 0.614620388f},
-std::array<float,2>{0.744605899f, 0.360454202f},
-std::array<float,2>{0.384499103f, 0.924153566f},
-std::array<float,2>{0.349616021f, 0.453207135f},
-std::array<float,2>{0.565417051f, 0.773807943f},
-std::array<float,2>{0.762422383f, 0.241770446f},
-std::array<float,2>{0.00862899888f, 0.733144879f},
-std::array<float,2>{0.0811027065f, 0.25565359f},
-std::array<float,2>{0.854663968f, 0.951433182f},
-std::array<float,2>{0.53058821f, 0.01691732f},
-std::array<float,2>{0.277422756f, 0.556975543f},
-std::array<float,2>{0.484369725f, 0.148937151f},
-std::array<float,2>{0.670506895f, 0.663564861f},
-std::array<float,2>{0.941952348f, 0.38376537f},
-std::array<float,2>{0.165359154f, 0.874981225f},
-std::array<float,2>{0.0556621887f, 0.200314522f},
-std::array<float,2>{0.802135766f, 0.706510603f},
-std::array<float,2>{0.609443486f, 0.487518013f},
-std::array<float,2>{0.318953663f, 0.793881774f},
-std::array<float,2>{0.415999293f, 0.318411171f},
-std::array<float,2>{0.695672452f, 0.890553594f},
-std::array<float,2>{0.892767847f, 0.0882563964f},
-std::array<float,2>{0.244479522f, 0.577104211f},
-std::array<float,2>{0.144182608f, 0.420814812f},
-std::array<float,2>{0.976510942f, 0.843030035f},
-std::array<float,2>{0.64838773f, 0.184680209f},
-std::array<float,2>{0.447068334f, 0.639104486f},
-std::array<float,2>{0.301753014f, 0.0511008948f},
-std::array<float,2>{0.538274527f, 0.530672371f},
-std::array<float,2>{0.837429285f, 0.304598838f},
-std::array<float,2>{0.100261174f, 0.98269701f},
-std::array<float,2>{0.185858384f, 0.156997114f},
-std::array<float,2>{0.957365453f, 0.647764742f},
-std::array<float,2>{0.680219531f, 0.428330362f},
-std::array<float,2>{0.487882346f, 0.822562635f},
-std::array<float,2>{0.261213839f, 0.282780319f},
-std::array<float,2>{0.515370369f, 0.98683995f},
-std::array<float,2>{0.862607539f, 0.0363016464f},
-std::array<float,2>{0.0724481791f, 0.508626819f},
-std::array<float,2>{0.0171214193f, 0.481017888f},
-std::array<float,2>{0.768954098f, 0.801811099f},
-std::array<float,2>{0.583665371f, 0.207599536f},
-std::array<float,2>{0.37118572f, 0.703060508f},
-std::array<float,2>{0.392261863f, 0.0643586293f},
-std::array<float,2>{0.718960524f, 0.588268459f},
-std::array<float,2>{0.906983018f, 0.33147344f},
-std::array<float,2>{0.210248411f, 0.904296041f},
-std::array<float,2>{0.118046619f, 0.0120498501f},
-std::array<float,2>{0.822774947f, 0.53704077f},
-std::array<float,2>{0.551621675f, 0.267088234f},
-std::array<float,2>{0.295020968f, 0.957383633f},
-std::array<float,2>{0.455592781f, 0.400862157f},
-std::array<float,2>{0.62810427f, 0.85892731f},
-std::array<float,2>{0.997230351f, 0.131481409f},
-std::array<float,2>{0.126069441f, 0.679106176f},
-std::array<float,2>{0.233526066f, 0.351444244f},
-std::array<float,2>{0.885699093f, 0.91055733f},
-std::array<float,2>{0.710729122f, 0.103958189f},
-std::array<float,2>{0.43147251f, 0.598038256f},
-std::array<float,2>{0.329916f, 0.233929381f},
-std::array<float,2>{0.60538727f, 0.741252422f},
-std::array<float,2>{0.783996701f, 0.446504086f},
-std::array<float,2>{0.0458815657f, 0.752218783f},
-std::array<float,2>{0.140108794f, 0.0468284376f},
-std::array<float,2>{0.986197352f, 0.504658937f},
-std::array<float,2>{0.634789109f, 0.293660432f},
-std::array<float,2>{0.46416375f, 0.994795561f},
-std::array<float,2>{0.283806711f, 0.430876434f},
-std::array<float,2>{0.560508192f, 0.813273072f},
-std::array<float,2>{0.816068947f, 0.16620183f},
-std::array<float,2>{0.110329725f, 0.649619579f},
-std::array<float,2>{0.0345661454f, 0.342778563f},
-std::array<float,2>{0.79484874f, 0.89597559f},
-std::array<float,2>{0.601467311f, 0.0739565194f},
-std::array<float,2>{0.343710244f, 0.58411628f},
-std::array<float,2>{0.426708072f, 0.215016484f},
-std::array<float,2>{0.715650499f, 0.694702506f},
-std::array<float,2>{0.879572034f, 0.469183207f},
-std::array<float,2>{0.219716355f, 0.811526597f},
-std::array<float,2>{0.0641234145f, 0.136059895f},
-std::array<float,2>{0.868730187f, 0.683720589f},
-std::array<float,2>{0.502901614f, 0.390783668f},
-std::array<float,2>{0.255318195f, 0.847659409f},
-std::array<float,2>{0.49650833f, 0.274555475f},
-std::array<float,2>{0.679282725f, 0.96267134f},
-std::array<float,2>{0.966835082f, 0.00615179585f},
-std::array<float,2>{0.173860997f, 0.53976059f},
-std::array<float,2>{0.212254897f, 0.445082009f},
-std::array<float,2>{0.921703219f, 0.760559797f},
-std::array<float,2>{0.733475506f, 0.222914457f},
-std::array<float,2>{0.402247965f, 0.746458471f},
-std::array<float,2>{0.365634948f, 0.0946693644f},
-std::array<float,2>{0.588209271f, 0.602655172f},
-std::array<float,2>{0.774967134f, 0.35551697f},
-std::array<float,2>{0.0260162055f, 0.921699345f},
-std::array<float,2>{0.23658371f, 0.248748899f},
-std::array<float,2>{0.904782891f, 0.724223912f},
-std::array<float,2>{0.694512844f, 0.467969716f},
-std::array<float,2>{0.410993129f, 0.765776813f},
-std::array<float,2>{0.325465143f, 0.368288219f},
-std::array<float,2>{0.618859947f, 0.931830943f},
-std::array<float,2>{0.808591962f, 0.119713247f},
-std::array<float,2>{0.0511254333f, 0.623089492f},
-std::array<float,2>{0.107314654f, 0.382164896f},
-std::array<float,2>{0.828892767f, 0.863664687f},
-std::array<float,2>{0.546863914f, 0.145033866f},
-std::array<float,2>{0.309373528f, 0.666546226f},
-std::array<float,2>{0.437833339f, 0.026674768f},
-std::array<float,2>{0.651385725f, 0.552914679f},
-std::array<float,2>{0.984294474f, 0.258961886f},
-std::array<float,2>{0.155216053f, 0.939196467f},
-std::array<float,2>{0.00748547073f, 0.0842193887f},
-std::array<float,2>{0.752175212f, 0.56664753f},
-std::array<float,2>{0.578106701f, 0.321571976f},
-std::array<float,2>{0.359173298f, 0.88225913f},
-std::array<float,2>{0.378290385f, 0.495793581f},
-std::array<float,2>{0.735742331f, 0.781491399f},
-std::array<float,2>{0.92482543f, 0.190498978f},
-std::array<float,2>{0.202255979f, 0.717857599f},
-std::array<float,2>{0.162951574f, 0.3105703f},
-std::array<float,2>{0.949711323f, 0.975250244f},
-std::array<float,2>{0.661142111f, 0.0562874041f},
-std::array<float,2>{0.47303164f, 0.520774424f},
-std::array<float,2>{0.26895377f, 0.179093078f},
-std::array<float,2>{0.517710268f, 0.630648673f},
-std::array<float,2>{0.844044149f, 0.408994108f},
-std::array<float,2>{0.0894477516f, 0.83463037f},
-std::array<float,2>{0.145852864f, 0.100791626f},
-std::array<float,2>{0.97155863f, 0.609164774f},
-std::array<float,2>{0.641649663f, 0.352970511f},
-std::array<float,2>{0.451345623f, 0.914189458f},
-std::array<float,2>{0.297973365f, 0.440667242f},
-std::array<float,2>{0.53143549f, 0.762505114f},
-std::array<float,2>{0.841135442f, 0.219575211f},
-std::array<float,2>{0.093845278f, 0.744463086f},
-std::array<float,2>{0.0609306842f, 0.279577643f},
-std::array<float,2>{0.798905969f, 0.966276824f},
-std::array<float,2>{0.615172744f, 0.0036146387f},
-std::array<float,2>{0.313850641f, 0.543804049f},
-std::array<float,2>{0.418697447f, 0.137167141f},
-std::array<float,2>{0.700502634f, 0.681750536f},
-std::array<float,2>{0.894779503f, 0.397160709f},
-std::array<float,2>{0.249799088f, 0.845163584f},
-std::array<float,2>{0.0850808471f, 0.213110402f},
-std::array<float,2>{0.85884285f, 0.69090873f},
-std::array<float,2>{0.524012089f, 0.473777562f},
-std::array<float,2>{0.274073929f, 0.808348358f},
-std::array<float,2>{0.480461925f, 0.336523831f},
-std::array<float,2>{0.667833328f, 0.891162992f},
-std::array<float,2>{0.939591229f, 0.0746823549f},
-std::array<float,2>{0.170427874f, 0.579694808f},
-std::array<float,2>{0.188682348f, 0.436185122f},
-std::array<float,2>{0.932013869f, 0.817810476f},
-std::array<float,2>{0.749761462f, 0.17014803f},
-std::array<float,2>{0.387716025f, 0.6553725f},
-std::array<float,2>{0.343904912f, 0.040907938f},
-std::array<float,2>{0.567378283f, 0.502494037f},
-std::array<float,2>{0.758430362f, 0.291459024f},
-std::array<float,2>{0.0131512173f, 0.997979045f},
-std::array<float,2>{0.229390174f, 0.174879983f},
-std::array<float,2>{0.88911283f, 0.625989199f},
-std::array<float,2>{0.7048558f, 0.411678463f},
-std::array<float,2>{0.43401134f, 0.828690827f},
-std::array<float,2>{0.333740473f, 0.306104332f},
-std::array<float,2>{0.60670352f, 0.971269846f},
-std::array<float,2>{0.78643328f, 0.059658777f},
-std::array<float,2>{0.0404800698f, 0.51826179f},
-std::array<float,2>{0.12467511f, 0.499594986f},
-std::array<float,2>{0.826207042f, 0.787914634f},
-std::array<float,2>{0.548558593f, 0.194045156f},
-std::array<float,2>{0.29283002f, 0.714174211f},
-std::array<float,2>{0.460157752f, 0.0794182941f},
-std::array<float,2>{0.62938571f, 0.563175738f},
-std::array<float,2>{0.994507432f, 0.325880885f},
-std::array<float,2>{0.130534708f, 0.878586173f},
-std::array<float,2>{0.021737732f, 0.0288196988f},
-std::array<float,2>{0.772021055f, 0.54745996f},
-std::array<float,2>{0.578277707f, 0.261871397f},
-std::array<float,2>{0.367952049f, 0.943361878f},
-std::array<float,2>{0.395358443f, 0.376239687f},
-std::array<float,2>{0.722901046f, 0.860748768f},
-std::array<float,2>{0.913006186f, 0.142085269f},
-std::array<float,2>{0.206666157f, 0.669730306f},
-std::array<float,2>{0.181569129f, 0.371587753f},
-std::array<float,2>{0.954491794f, 0.936733663f},
-std::array<float,2>{0.684576809f, 0.123841666f},
-std::array<float,2>{0.490998656f, 0.620363355f},
-std::array<float,2>{0.264379829f, 0.242320433f},
-std::array<float,2>{0.508253872f, 0.719740808f},
-std::array<float,2>{0.8636989f, 0.461240351f},
-std::array<float,2>{0.0779491961f, 0.770281494f},
-std::array<float,2>{0.216660306f, 0.0498894043f},
-std::array<float,2>{0.916459262f, 0.526364625f},
-std::array<float,2>{0.727028191f, 0.2978912f},
-std::array<float,2>{0.403233737f, 0.977158725f},
-std::array<float,2>{0.362563223f, 0.415635377f},
-std::array<float,2>{0.592597067f, 0.83749336f},
-std::array<float,2>{0.779585421f, 0.18242386f},
-std::array<float,2>{0.0292733703f, 0.633573472f},
-std::array<float,2>{0.0690745935f, 0.313464463f},
-std::array<float,2>{0.871800959f, 0.886525214f},
-std::array<float,2>{0.503959119f, 0.0933682993f},
-std::array<float,2>{0.253205627f, 0.571412981f},
-std::array<float,2>{0.494478852f, 0.19617708f},
-std::array<float,2>{0.674941897f, 0.710603476f},
-std::array<float,2>{0.963990211f, 0.492090285f},
-std::array<float,2>{0.176685616f, 0.789844394f},
-std::array<float,2>{0.0359767266f, 0.154219598f},
-std::array<float,2>{0.789868712f, 0.656558394f},
-std::array<float,2>{0.5968104f, 0.390054196f},
-std::array<float,2>{0.339758754f, 0.869972706f},
-std::array<float,2>{0.42229262f, 0.251960099f},
-std::array<float,2>{0.712268531f, 0.946826458f},
-std::array<float,2>{0.877063453f, 0.0224818457f},
-std::array<float,2>{0.223194495f, 0.559505165f},
-std::array<float,2>{0.135336846f, 0.457411528f},
-std::array<float,2>{0.990300536f, 0.778764546f},
-std::array<float,2>{0.638330221f, 0.237031341f},
-std::array<float,2>{0.4655357f, 0.727648079f},
-std::array<float,2>{0.286375552f, 0.116012074f},
-std::array<float,2>{0.556374431f, 0.610183954f},
-std::array<float,2>{0.816662908f, 0.366132617f},
-std::array<float,2>{0.115777425f, 0.926892161f},
-std::array<float,2>{0.157232612f, 0.226585761f},
-std::array<float,2>{0.948024035f, 0.73588711f},
-std::array<float,2>{0.659953833f, 0.45043239f},
-std::array<float,2>{0.470483691f, 0.755954981f},
-std::array<float,2>{0.270072848f, 0.345811933f},
-std::array<float,2>{0.520340204f, 0.907259285f},
-std::array<float,2>{0.850585163f, 0.107417583f},
-std::array<float,2>{0.0907572508f, 0.596749127f},
-std::array<float,2>{0.000139463009f, 0.403339088f},
-std::array<float,2>{0.757520914f, 0.853585243f},
-std::array<float,2>{0.570770085f, 0.125363469f},
-std::array<float,2>{0.351735055f, 0.672775865f},
-std::array<float,2>{0.381267667f, 0.0082789259f},
-std::array<float,2>{0.740141153f, 0.533703923f},
-std::array<float,2>{0.926769853f, 0.270681918f},
-std::array<float,2>{0.19531399f, 0.9545964f},
-std::array<float,2>{0.105156608f, 0.0680214688f},
-std::array<float,2>{0.834385931f, 0.591153979f},
-std::array<float,2>{0.539270818f, 0.335876882f},
-std::array<float,2>{0.308428437f, 0.901041389f},
-std::array<float,2>{0.443448812f, 0.478794962f},
-std::array<float,2>{0.653589964f, 0.799090147f},
-std::array<float,2>{0.979913592f, 0.205347776f},
-std::array<float,2>{0.149389848f, 0.697261035f},
-std::array<float,2>{0.239389077f, 0.289046526f},
-std::array<float,2>{0.899429321f, 0.989900649f},
-std::array<float,2>{0.689231932f, 0.0320015512f},
-std::array<float,2>{0.409629256f, 0.512654901f},
-std::array<float,2>{0.322670668f, 0.16091083f},
-std::array<float,2>{0.621140897f, 0.643999875f},
-std::array<float,2>{0.810879946f, 0.423319787f},
-std::array<float,2>{0.0482411869f, 0.825490773f},
-std::array<float,2>{0.242925555f, 0.0868541747f},
-std::array<float,2>{0.891104758f, 0.575567365f},
-std::array<float,2>{0.699086964f, 0.317681909f},
-std::array<float,2>{0.41742456f, 0.888159037f},
-std::array<float,2>{0.317263484f, 0.484406888f},
-std::array<float,2>{0.613264203f, 0.796611249f},
-std::array<float,2>{0.803123474f, 0.202599838f},
-std::array<float,2>{0.0578662083f, 0.705059648f},
-std::array<float,2>{0.0989268124f, 0.30134359f},
-std::array<float,2>{0.83865416f, 0.982106447f},
-std::array<float,2>{0.536112428f, 0.054242257f},
-std::array<float,2>{0.303860158f, 0.528262496f},
-std::array<float,2>{0.44919163f, 0.18573454f},
-std::array<float,2>{0.644590974f, 0.638207078f},
-std::array<float,2>{0.973490477f, 0.419200927f},
-std::array<float,2>{0.141857758f, 0.840022624f},
-std::array<float,2>{0.0110408301f, 0.240002334f},
-std::array<float,2>{0.764868259f, 0.730738401f},
-std::array<float,2>{0.562799215f, 0.456284344f},
-std::array<float,2>{0.348105431f, 0.776016653f},
-std::array<float,2>{0.385056198f, 0.362248093f},
-std::array<float,2>{0.743112445f, 0.923314571f},
-std::array<float,2>{0.937361419f, 0.112696819f},
-std::array<float,2>{0.19143188f, 0.615329266f},
-std::array<float,2>{0.167704329f, 0.385144144f},
-std::array<float,2>{0.943890333f, 0.871464252f},
-std::array<float,2>{0.668312192f, 0.152232766f},
-std::array<float,2>{0.482106596f, 0.660389662f},
-std::array<float,2>{0.280063212f, 0.0179066751f},
-std::array<float,2>{0.528004587f, 0.555617809f},
-std::array<float,2>{0.853011847f, 0.256493211f},
-std::array<float,2>{0.0791971311f, 0.951013982f},
-std::array<float,2>{0.127563849f, 0.129966363f},
-std::array<float,2>{0.998717785f, 0.677003682f},
-std::array<float,2>{0.625667155f, 0.399120808f},
-std::array<float,2>{0.454130203f, 0.855498612f},
-std::array<float,2>{0.294325948f, 0.26853478f},
-std::array<float,2>{0.553751945f, 0.959354222f},
-std::array<float,2>{0.822050631f, 0.0154192615f},
-std::array<float,2>{0.120372914f, 0.537270367f},
-std::array<float,2>{0.0430339091f, 0.447676957f},
-std::array<float,2>{0.782935202f, 0.750135958f},
-std::array<float,2>{0.602930546f, 0.231351659f},
-std::array<float,2>{0.33085835f, 0.73892343f},
-std::array<float,2>{0.431903392f, 0.102119043f},
-std::array<float,2>{0.708667755f, 0.601427317f},
-std::array<float,2>{0.884045422f, 0.347814441f},
-std::array<float,2>{0.23136586f, 0.912251592f},
-std::array<float,2>{0.0721703321f, 0.0389259085f},
-std::array<float,2>{0.860935271f, 0.511488199f},
-std::array<float,2>{0.512021482f, 0.283513486f},
-std::array<float,2>{0.259406447f, 0.986010969f},
-std::array<float,2>{0.485026538f, 0.426543891f},
-std::array<float,2>{0.682031631f, 0.82209152f},
-std::array<float,2>{0.960299671f, 0.160081074f},
-std::array<float,2>{0.184393495f, 0.645617485f},
-std::array<float,2>{0.208640024f, 0.329105169f},
-std::array<float,2>{0.909867525f, 0.905237138f},
-std::array<float,2>{0.722345829f, 0.0651099607f},
-std::array<float,2>{0.39408645f, 0.586982906f},
-std::array<float,2>{0.374658257f, 0.210539863f},
-std::array<float,2>{0.584342718f, 0.700509608f},
-std::array<float,2>{0.767399013f, 0.483067989f},
-std::array<float,2>{0.0188336149f, 0.803588629f},
-std::array<float,2>{0.173634231f, 0.00468304707f},
-std::array<float,2>{0.964941323f, 0.541763842f},
-std::array<float,2>{0.677172661f, 0.275878191f},
-std::array<float,2>{0.499015003f, 0.963516891f},
-std::array<float,2>{0.257445216f, 0.39324069f},
-std::array<float,2>{0.501336753f, 0.84999609f},
-std::array<float,2>{0.870155394f, 0.133232564f},
-std::array<float,2>{0.0652466416f, 0.686651707f},
-std::array<float,2>{0.0237521809f, 0.357908458f},
-std::array<float,2>{0.775743127f, 0.91948849f},
-std::array<float,2>{0.587192655f, 0.0963098407f},
-std::array<float,2>{0.363728374f, 0.605060339f},
-std::array<float,2>{0.399377972f, 0.226401702f},
-std::array<float,2>{0.730680645f, 0.748116016f},
-std::array<float,2>{0.917975247f, 0.442577332f},
-std::array<float,2>{0.214214474f, 0.758883834f},
-std::array<float,2>{0.112504147f, 0.164221004f},
-std::array<float,2>{0.814009726f, 0.652109146f},
-std::array<float,2>{0.561063409f, 0.432196707f},
-std::array<float,2>{0.281635761f, 0.816089928f},
-std::array<float,2>{0.462384254f, 0.294988841f},
-std::array<float,2>{0.634449482f, 0.993185818f},
-std::array<float,2>{0.987402081f, 0.0431621857f},
-std::array<float,2>{0.138643205f, 0.507753015f},
-std::array<float,2>{0.22206153f, 0.472535878f},
-std::array<float,2>{0.882392943f, 0.810203731f},
-std::array<float,2>{0.716930151f, 0.217883989f},
-std::array<float,2>{0.428103477f, 0.692402482f},
-std::array<float,2>{0.340107471f, 0.0714904815f},
-std::array<float,2>{0.598678708f, 0.582037091f},
-std::array<float,2>{0.796842813f, 0.340518117f},
-std::array<float,2>{0.0319224074f, 0.897847474f},
-std::array<float,2>{0.20049727f, 0.188480422f},
-std::array<float,2>{0.923705697f, 0.716299355f},
-std::array<float,2>{0.73752141f, 0.493269444f},
-std::array<float,2>{0.375824153f, 0.784580767f},
-std::array<float,2>{0.356170088f, 0.323116183f},
-std::array<float,2>{0.575968325f, 0.87903583f},
-std::array<float,2>{0.75049454f, 0.0831714571f},
-std::array<float,2>{0.00423696171f, 0.569663882f},
-std::array<float,2>{0.0877789557f, 0.407897592f},
-std::array<float,2>{0.84754777f, 0.832862735f},
-std::array<float,2>{0.516713142f, 0.177042931f},
-std::array<float,2>{0.266103387f, 0.631860018f},
-std::array<float,2>{0.47561422f, 0.0569841973f},
-std::array<float,2>{0.662285864f, 0.522986352f},
-std::array<float,2>{0.952555656f, 0.309741497f},
-std::array<float,2>{0.160775155f, 0.973538339f},
-std::array<float,2>{0.0533534959f, 0.118303619f},
-std::array<float,2>{0.804965317f, 0.621488988f},
-std::array<float,2>{0.62040329f, 0.370310307f},
-std::array<float,2>{0.327192426f, 0.931077361f},
-std::array<float,2>{0.413538903f, 0.465756655f},
-std::array<float,2>{0.692906022f, 0.768985808f},
-std::array<float,2>{0.902947128f, 0.246502623f},
-std::array<float,2>{0.235228196f, 0.724990129f},
-std::array<float,2>{0.15282011f, 0.260600656f},
-std::array<float,2>{0.981989384f, 0.941088498f},
-std::array<float,2>{0.649791837f, 0.0238313247f},
-std::array<float,2>{0.440196723f, 0.552184463f},
-std::array<float,2>{0.310945064f, 0.146728292f},
-std::array<float,2>{0.543914616f, 0.665966988f},
-std::array<float,2>{0.830393076f, 0.380054981f},
-std::array<float,2>{0.108132616f, 0.865837157f}}
\ No newline at end of file
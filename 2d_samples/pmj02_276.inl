@@ -1,4096 +0,0 @@
-{std::array<float,2>{0.970658541f, 0.114713341f},
-std::array<float,2>{0.00219224463f, 0.848629415f},
-std::array<float,2>{0.631643713f, 0.547546387f},
-std::array<float,2>{0.455188125f, 0.301167548f},
-std::array<float,2>{0.505197763f, 0.399897873f},
-std::array<float,2>{0.32623589f, 0.725735188f},
-std::array<float,2>{0.793028176f, 0.972136438f},
-std::array<float,2>{0.242915437f, 0.216189876f},
-std::array<float,2>{0.723782718f, 0.140578121f},
-std::array<float,2>{0.3927176f, 0.879299402f},
-std::array<float,2>{0.911696315f, 0.664573729f},
-std::array<float,2>{0.101402007f, 0.453792602f},
-std::array<float,2>{0.824612617f, 0.319225848f},
-std::array<float,2>{0.183367535f, 0.606790185f},
-std::array<float,2>{0.600777328f, 0.800909579f},
-std::array<float,2>{0.312212169f, 0.02610939f},
-std::array<float,2>{0.769469738f, 0.220344454f},
-std::array<float,2>{0.201090917f, 0.958289802f},
-std::array<float,2>{0.55932349f, 0.70492965f},
-std::array<float,2>{0.359420955f, 0.429798335f},
-std::array<float,2>{0.662669837f, 0.262657195f},
-std::array<float,2>{0.485046983f, 0.526411295f},
-std::array<float,2>{0.94667238f, 0.817272246f},
-std::array<float,2>{0.0328437574f, 0.0796590075f},
-std::array<float,2>{0.578096449f, 0.051983837f},
-std::array<float,2>{0.273468971f, 0.777262926f},
-std::array<float,2>{0.865053058f, 0.582044303f},
-std::array<float,2>{0.136199892f, 0.3542867f},
-std::array<float,2>{0.879025757f, 0.497762322f},
-std::array<float,2>{0.082204923f, 0.649001241f},
-std::array<float,2>{0.697978973f, 0.934848905f},
-std::array<float,2>{0.412043661f, 0.18048434f},
-std::array<float,2>{0.855488658f, 0.00675473968f},
-std::array<float,2>{0.148834854f, 0.787264764f},
-std::array<float,2>{0.579558432f, 0.611547649f},
-std::array<float,2>{0.257073075f, 0.341222554f},
-std::array<float,2>{0.711943448f, 0.450556606f},
-std::array<float,2>{0.427955359f, 0.682322443f},
-std::array<float,2>{0.900786757f, 0.898798048f},
-std::array<float,2>{0.0637010261f, 0.146090567f},
-std::array<float,2>{0.536994398f, 0.193166465f},
-std::array<float,2>{0.358030468f, 0.988381267f},
-std::array<float,2>{0.755133569f, 0.736743391f},
-std::array<float,2>{0.208522364f, 0.38926059f},
-std::array<float,2>{0.956095874f, 0.289741278f},
-std::array<float,2>{0.054165177f, 0.535737395f},
-std::array<float,2>{0.682663441f, 0.860857546f},
-std::array<float,2>{0.473126113f, 0.104056165f},
-std::array<float,2>{0.926549554f, 0.158736333f},
-std::array<float,2>{0.110662594f, 0.919165969f},
-std::array<float,2>{0.746086121f, 0.625908554f},
-std::array<float,2>{0.389494717f, 0.469791651f},
-std::array<float,2>{0.614380538f, 0.368502617f},
-std::array<float,2>{0.294764578f, 0.568807006f},
-std::array<float,2>{0.839018524f, 0.751778245f},
-std::array<float,2>{0.166530117f, 0.0399508178f},
-std::array<float,2>{0.656121671f, 0.0711114332f},
-std::array<float,2>{0.440699071f, 0.83987993f},
-std::array<float,2>{0.995891094f, 0.511677861f},
-std::array<float,2>{0.0266056303f, 0.274407834f},
-std::array<float,2>{0.800615728f, 0.419681311f},
-std::array<float,2>{0.225346446f, 0.695643246f},
-std::array<float,2>{0.521904767f, 0.948546827f},
-std::array<float,2>{0.33252266f, 0.247408316f},
-std::array<float,2>{0.89373827f, 0.0337677002f},
-std::array<float,2>{0.0764578283f, 0.760660529f},
-std::array<float,2>{0.705371499f, 0.574918807f},
-std::array<float,2>{0.436172456f, 0.362690896f},
-std::array<float,2>{0.59305346f, 0.480855584f},
-std::array<float,2>{0.262226701f, 0.633060753f},
-std::array<float,2>{0.843923748f, 0.909443974f},
-std::array<float,2>{0.141641393f, 0.16677469f},
-std::array<float,2>{0.673455536f, 0.236096397f},
-std::array<float,2>{0.476673007f, 0.944363356f},
-std::array<float,2>{0.96546793f, 0.68931371f},
-std::array<float,2>{0.0618181229f, 0.409596026f},
-std::array<float,2>{0.763431787f, 0.273038685f},
-std::array<float,2>{0.21369569f, 0.505023181f},
-std::array<float,2>{0.546695828f, 0.834604263f},
-std::array<float,2>{0.348203093f, 0.0690031201f},
-std::array<float,2>{0.830976486f, 0.148463815f},
-std::array<float,2>{0.157858834f, 0.89634949f},
-std::array<float,2>{0.623028696f, 0.674007952f},
-std::array<float,2>{0.281285584f, 0.440236896f},
-std::array<float,2>{0.73524487f, 0.331752539f},
-std::array<float,2>{0.380337119f, 0.617760539f},
-std::array<float,2>{0.935643315f, 0.791321099f},
-std::array<float,2>{0.122785531f, 0.0134017365f},
-std::array<float,2>{0.530462921f, 0.0965741277f},
-std::array<float,2>{0.338757545f, 0.870901763f},
-std::array<float,2>{0.805184841f, 0.541885138f},
-std::array<float,2>{0.226568729f, 0.287102163f},
-std::array<float,2>{0.987507939f, 0.379657149f},
-std::array<float,2>{0.0176593587f, 0.749354064f},
-std::array<float,2>{0.645538092f, 0.996428192f},
-std::array<float,2>{0.446208745f, 0.201001003f},
-std::array<float,2>{0.781781197f, 0.0871987343f},
-std::array<float,2>{0.24055472f, 0.825086355f},
-std::array<float,2>{0.509889126f, 0.51819396f},
-std::array<float,2>{0.317923695f, 0.250203878f},
-std::array<float,2>{0.635024607f, 0.422427058f},
-std::array<float,2>{0.462706864f, 0.712829649f},
-std::array<float,2>{0.978074729f, 0.967176974f},
-std::array<float,2>{0.0127300192f, 0.23390542f},
-std::array<float,2>{0.609198451f, 0.178196907f},
-std::array<float,2>{0.297468543f, 0.92784667f},
-std::array<float,2>{0.819499493f, 0.644015849f},
-std::array<float,2>{0.177488491f, 0.492072135f},
-std::array<float,2>{0.921658993f, 0.34709084f},
-std::array<float,2>{0.106537186f, 0.590688348f},
-std::array<float,2>{0.726978898f, 0.772538483f},
-std::array<float,2>{0.405491233f, 0.058610253f},
-std::array<float,2>{0.943526685f, 0.205996588f},
-std::array<float,2>{0.0435891934f, 0.979030311f},
-std::array<float,2>{0.668458939f, 0.731157005f},
-std::array<float,2>{0.499091685f, 0.396212012f},
-std::array<float,2>{0.554235458f, 0.312324613f},
-std::array<float,2>{0.367768347f, 0.55516696f},
-std::array<float,2>{0.777171552f, 0.851585388f},
-std::array<float,2>{0.195037693f, 0.12439926f},
-std::array<float,2>{0.689365745f, 0.0164313409f},
-std::array<float,2>{0.417253196f, 0.808865249f},
-std::array<float,2>{0.886082053f, 0.601489007f},
-std::array<float,2>{0.088370502f, 0.324577212f},
-std::array<float,2>{0.874111176f, 0.462741643f},
-std::array<float,2>{0.130070403f, 0.658005893f},
-std::array<float,2>{0.569228292f, 0.88294822f},
-std::array<float,2>{0.2701855f, 0.128995359f},
-std::array<float,2>{0.963338315f, 0.0311085656f},
-std::array<float,2>{0.0558362529f, 0.797109425f},
-std::array<float,2>{0.678166091f, 0.60241282f},
-std::array<float,2>{0.483315557f, 0.315633267f},
-std::array<float,2>{0.540423274f, 0.460278153f},
-std::array<float,2>{0.347627133f, 0.668672621f},
-std::array<float,2>{0.76069802f, 0.877251387f},
-std::array<float,2>{0.216533735f, 0.13417092f},
-std::array<float,2>{0.70942837f, 0.211743057f},
-std::array<float,2>{0.431808323f, 0.975506723f},
-std::array<float,2>{0.895498633f, 0.721007884f},
-std::array<float,2>{0.0733385012f, 0.404618263f},
-std::array<float,2>{0.849268913f, 0.299228549f},
-std::array<float,2>{0.148017347f, 0.553207755f},
-std::array<float,2>{0.586730659f, 0.84433651f},
-std::array<float,2>{0.258036643f, 0.111938111f},
-std::array<float,2>{0.811319947f, 0.184992969f},
-std::array<float,2>{0.231278703f, 0.929874778f},
-std::array<float,2>{0.526646852f, 0.652652919f},
-std::array<float,2>{0.342479706f, 0.495719016f},
-std::array<float,2>{0.643457294f, 0.358316153f},
-std::array<float,2>{0.451283544f, 0.581849515f},
-std::array<float,2>{0.988321602f, 0.778241754f},
-std::array<float,2>{0.0226208866f, 0.0501949377f},
-std::array<float,2>{0.619316459f, 0.0858966559f},
-std::array<float,2>{0.287999332f, 0.813784838f},
-std::array<float,2>{0.835515618f, 0.528812528f},
-std::array<float,2>{0.160593241f, 0.260546118f},
-std::array<float,2>{0.930000901f, 0.435718745f},
-std::array<float,2>{0.11784701f, 0.708739638f},
-std::array<float,2>{0.741892159f, 0.954840541f},
-std::array<float,2>{0.378311068f, 0.224175319f},
-std::array<float,2>{0.814107776f, 0.106188543f},
-std::array<float,2>{0.175762326f, 0.863445699f},
-std::array<float,2>{0.602256238f, 0.534347653f},
-std::array<float,2>{0.301921815f, 0.294646531f},
-std::array<float,2>{0.731990278f, 0.38427794f},
-std::array<float,2>{0.401455879f, 0.738920271f},
-std::array<float,2>{0.917513967f, 0.987900198f},
-std::array<float,2>{0.102038927f, 0.191088989f},
-std::array<float,2>{0.511853397f, 0.143350631f},
-std::array<float,2>{0.315044224f, 0.905731082f},
-std::array<float,2>{0.785719752f, 0.686011136f},
-std::array<float,2>{0.237084374f, 0.448104322f},
-std::array<float,2>{0.983059466f, 0.33701849f},
-std::array<float,2>{0.0101319402f, 0.616557181f},
-std::array<float,2>{0.637317479f, 0.783176541f},
-std::array<float,2>{0.466248095f, 0.000482060161f},
-std::array<float,2>{0.888329089f, 0.245232955f},
-std::array<float,2>{0.0923989415f, 0.949326754f},
-std::array<float,2>{0.694241345f, 0.701824546f},
-std::array<float,2>{0.419812977f, 0.417624205f},
-std::array<float,2>{0.565404892f, 0.280575216f},
-std::array<float,2>{0.268211335f, 0.515173912f},
-std::array<float,2>{0.87108463f, 0.838455617f},
-std::array<float,2>{0.125638336f, 0.0743009672f},
-std::array<float,2>{0.665872931f, 0.0468692854f},
-std::array<float,2>{0.495756865f, 0.756538391f},
-std::array<float,2>{0.941188574f, 0.56618011f},
-std::array<float,2>{0.0408381708f, 0.37301001f},
-std::array<float,2>{0.777907729f, 0.4745107f},
-std::array<float,2>{0.189061314f, 0.630366504f},
-std::array<float,2>{0.547541261f, 0.917863905f},
-std::array<float,2>{0.371527165f, 0.160803735f},
-std::array<float,2>{0.909151256f, 0.0646184683f},
-std::array<float,2>{0.0945550129f, 0.831822395f},
-std::array<float,2>{0.721676767f, 0.500768185f},
-std::array<float,2>{0.396188289f, 0.265874773f},
-std::array<float,2>{0.595555007f, 0.410299391f},
-std::array<float,2>{0.307680935f, 0.695013463f},
-std::array<float,2>{0.822953641f, 0.9392941f},
-std::array<float,2>{0.18610473f, 0.238515317f},
-std::array<float,2>{0.628423274f, 0.168125451f},
-std::array<float,2>{0.457418084f, 0.911412179f},
-std::array<float,2>{0.973203897f, 0.638945043f},
-std::array<float,2>{0.00762603618f, 0.478023857f},
-std::array<float,2>{0.792053401f, 0.364348978f},
-std::array<float,2>{0.247003391f, 0.571733654f},
-std::array<float,2>{0.503587484f, 0.762370169f},
-std::array<float,2>{0.323964119f, 0.036945343f},
-std::array<float,2>{0.860255599f, 0.197987035f},
-std::array<float,2>{0.139977679f, 0.994423389f},
-std::array<float,2>{0.571834743f, 0.744757295f},
-std::array<float,2>{0.279359758f, 0.375524729f},
-std::array<float,2>{0.701032639f, 0.283164859f},
-std::array<float,2>{0.407351792f, 0.546151042f},
-std::array<float,2>{0.877677202f, 0.871680498f},
-std::array<float,2>{0.0798962936f, 0.0999358594f},
-std::array<float,2>{0.555711627f, 0.0107483454f},
-std::array<float,2>{0.364044845f, 0.794901252f},
-std::array<float,2>{0.770095229f, 0.62479341f},
-std::array<float,2>{0.197320148f, 0.335374564f},
-std::array<float,2>{0.949636936f, 0.442426294f},
-std::array<float,2>{0.036966823f, 0.67737174f},
-std::array<float,2>{0.657779217f, 0.890752196f},
-std::array<float,2>{0.492152154f, 0.154344186f},
-std::array<float,2>{0.753692627f, 0.0565920658f},
-std::array<float,2>{0.203516483f, 0.769490421f},
-std::array<float,2>{0.531537294f, 0.586842597f},
-std::array<float,2>{0.354869336f, 0.35092923f},
-std::array<float,2>{0.683953881f, 0.484473765f},
-std::array<float,2>{0.472384959f, 0.647036791f},
-std::array<float,2>{0.959855497f, 0.922077239f},
-std::array<float,2>{0.0472730845f, 0.175495967f},
-std::array<float,2>{0.583464444f, 0.230106607f},
-std::array<float,2>{0.253767401f, 0.961494684f},
-std::array<float,2>{0.854130507f, 0.715638697f},
-std::array<float,2>{0.154487073f, 0.428121656f},
-std::array<float,2>{0.903785765f, 0.257249326f},
-std::array<float,2>{0.0688955858f, 0.520599365f},
-std::array<float,2>{0.71809876f, 0.821313679f},
-std::array<float,2>{0.425519079f, 0.0924582481f},
-std::array<float,2>{0.999087811f, 0.126489267f},
-std::array<float,2>{0.0288082864f, 0.886797428f},
-std::array<float,2>{0.651034296f, 0.660278559f},
-std::array<float,2>{0.444093198f, 0.465563655f},
-std::array<float,2>{0.518548906f, 0.321863204f},
-std::array<float,2>{0.328347862f, 0.59522289f},
-std::array<float,2>{0.801163197f, 0.807217419f},
-std::array<float,2>{0.220125899f, 0.0208512135f},
-std::array<float,2>{0.749002218f, 0.118605062f},
-std::array<float,2>{0.385035366f, 0.856339395f},
-std::array<float,2>{0.925708473f, 0.561950088f},
-std::array<float,2>{0.116183467f, 0.304869086f},
-std::array<float,2>{0.843235493f, 0.393847913f},
-std::array<float,2>{0.171352178f, 0.728157043f},
-std::array<float,2>{0.612157166f, 0.981151581f},
-std::array<float,2>{0.289227486f, 0.20950754f},
-std::array<float,2>{0.948603809f, 0.0814708099f},
-std::array<float,2>{0.0339404792f, 0.818618476f},
-std::array<float,2>{0.662099779f, 0.523660362f},
-std::array<float,2>{0.48681131f, 0.265395761f},
-std::array<float,2>{0.56167376f, 0.432309687f},
-std::array<float,2>{0.361988991f, 0.706203163f},
-std::array<float,2>{0.767472923f, 0.960458934f},
-std::array<float,2>{0.201467261f, 0.222643897f},
-std::array<float,2>{0.696190774f, 0.18246524f},
-std::array<float,2>{0.413200766f, 0.936451375f},
-std::array<float,2>{0.882725f, 0.650449634f},
-std::array<float,2>{0.0846956223f, 0.499921441f},
-std::array<float,2>{0.865536392f, 0.352226675f},
-std::array<float,2>{0.132933632f, 0.585561812f},
-std::array<float,2>{0.574484944f, 0.774891198f},
-std::array<float,2>{0.276042998f, 0.0536546558f},
-std::array<float,2>{0.795981109f, 0.218000203f},
-std::array<float,2>{0.24560459f, 0.970342457f},
-std::array<float,2>{0.505915642f, 0.724303961f},
-std::array<float,2>{0.325817704f, 0.401809275f},
-std::array<float,2>{0.629193485f, 0.304504752f},
-std::array<float,2>{0.454247057f, 0.550587535f},
-std::array<float,2>{0.971181333f, 0.851073503f},
-std::array<float,2>{0.000263681519f, 0.116522267f},
-std::array<float,2>{0.599464059f, 0.024091756f},
-std::array<float,2>{0.308644235f, 0.803378642f},
-std::array<float,2>{0.826287687f, 0.608448625f},
-std::array<float,2>{0.179850519f, 0.317148089f},
-std::array<float,2>{0.913692474f, 0.455311418f},
-std::array<float,2>{0.0988163278f, 0.666686833f},
-std::array<float,2>{0.725213587f, 0.881234527f},
-std::array<float,2>{0.390983552f, 0.137937129f},
-std::array<float,2>{0.835951388f, 0.0411482863f},
-std::array<float,2>{0.164510474f, 0.753331542f},
-std::array<float,2>{0.615432203f, 0.567112863f},
-std::array<float,2>{0.295925975f, 0.369897515f},
-std::array<float,2>{0.743229389f, 0.47234121f},
-std::array<float,2>{0.38702032f, 0.627041578f},
-std::array<float,2>{0.927969396f, 0.920602858f},
-std::array<float,2>{0.112497196f, 0.156770542f},
-std::array<float,2>{0.520830452f, 0.24816817f},
-std::array<float,2>{0.334280699f, 0.946773767f},
-std::array<float,2>{0.797811389f, 0.698460221f},
-std::array<float,2>{0.22438778f, 0.420668274f},
-std::array<float,2>{0.993714273f, 0.277268022f},
-std::array<float,2>{0.0249696542f, 0.508091569f},
-std::array<float,2>{0.653914332f, 0.842809975f},
-std::array<float,2>{0.439334691f, 0.0740010291f},
-std::array<float,2>{0.900052309f, 0.147018522f},
-std::array<float,2>{0.0662433133f, 0.901508808f},
-std::array<float,2>{0.713244796f, 0.680767417f},
-std::array<float,2>{0.426105618f, 0.452594727f},
-std::array<float,2>{0.581741989f, 0.342401743f},
-std::array<float,2>{0.25522846f, 0.609833121f},
-std::array<float,2>{0.859033406f, 0.785521388f},
-std::array<float,2>{0.151705965f, 0.00449224468f},
-std::array<float,2>{0.679869831f, 0.103468679f},
-std::array<float,2>{0.475889027f, 0.862134457f},
-std::array<float,2>{0.954371572f, 0.537887871f},
-std::array<float,2>{0.0514466912f, 0.291340798f},
-std::array<float,2>{0.755889237f, 0.3870776f},
-std::array<float,2>{0.209497377f, 0.734644234f},
-std::array<float,2>{0.537293255f, 0.99092257f},
-std::array<float,2>{0.355694622f, 0.193364471f},
-std::array<float,2>{0.933724761f, 0.0149533534f},
-std::array<float,2>{0.12393041f, 0.789958954f},
-std::array<float,2>{0.737286329f, 0.620450556f},
-std::array<float,2>{0.381212682f, 0.328372449f},
-std::array<float,2>{0.623633027f, 0.437912166f},
-std::array<float,2>{0.285102755f, 0.672742009f},
-std::array<float,2>{0.829367161f, 0.897372365f},
-std::array<float,2>{0.158885986f, 0.150971025f},
-std::array<float,2>{0.647748113f, 0.202882752f},
-std::array<float,2>{0.448856324f, 0.999348164f},
-std::array<float,2>{0.985193849f, 0.746725023f},
-std::array<float,2>{0.0172596872f, 0.382358521f},
-std::array<float,2>{0.808181763f, 0.287396371f},
-std::array<float,2>{0.229003534f, 0.539981604f},
-std::array<float,2>{0.528912187f, 0.867865562f},
-std::array<float,2>{0.336336136f, 0.0949855223f},
-std::array<float,2>{0.846651316f, 0.164216667f},
-std::array<float,2>{0.142686903f, 0.908009768f},
-std::array<float,2>{0.591417491f, 0.635655701f},
-std::array<float,2>{0.265123516f, 0.483067542f},
-std::array<float,2>{0.704924345f, 0.360780448f},
-std::array<float,2>{0.434471101f, 0.576537311f},
-std::array<float,2>{0.89138037f, 0.758199036f},
-std::array<float,2>{0.0750160292f, 0.0318371952f},
-std::array<float,2>{0.543556094f, 0.0680691972f},
-std::array<float,2>{0.351354063f, 0.832777739f},
-std::array<float,2>{0.764541864f, 0.50759095f},
-std::array<float,2>{0.211515293f, 0.26982373f},
-std::array<float,2>{0.968064606f, 0.407485902f},
-std::array<float,2>{0.0602617711f, 0.690933108f},
-std::array<float,2>{0.675297379f, 0.941660345f},
-std::array<float,2>{0.479418606f, 0.236993179f},
-std::array<float,2>{0.773611486f, 0.121976629f},
-std::array<float,2>{0.191904962f, 0.854523122f},
-std::array<float,2>{0.551149189f, 0.557636738f},
-std::array<float,2>{0.370882511f, 0.308955401f},
-std::array<float,2>{0.669928968f, 0.398133993f},
-std::array<float,2>{0.49676767f, 0.73421979f},
-std::array<float,2>{0.943344295f, 0.976875484f},
-std::array<float,2>{0.0459048301f, 0.20364067f},
-std::array<float,2>{0.5681687f, 0.131094754f},
-std::array<float,2>{0.271922141f, 0.885101736f},
-std::array<float,2>{0.872445464f, 0.658433437f},
-std::array<float,2>{0.130930483f, 0.463584393f},
-std::array<float,2>{0.88334918f, 0.327320784f},
-std::array<float,2>{0.0865593478f, 0.599368215f},
-std::array<float,2>{0.691161096f, 0.812121153f},
-std::array<float,2>{0.415997088f, 0.0178557113f},
-std::array<float,2>{0.980006695f, 0.230500102f},
-std::array<float,2>{0.0139488084f, 0.96631664f},
-std::array<float,2>{0.633022606f, 0.713605046f},
-std::array<float,2>{0.46456641f, 0.423944861f},
-std::array<float,2>{0.508868754f, 0.253542453f},
-std::array<float,2>{0.319537401f, 0.517279029f},
-std::array<float,2>{0.784203291f, 0.827142656f},
-std::array<float,2>{0.238281861f, 0.0886335969f},
-std::array<float,2>{0.730313361f, 0.061726138f},
-std::array<float,2>{0.403207749f, 0.770118535f},
-std::array<float,2>{0.918182313f, 0.593019187f},
-std::array<float,2>{0.108649068f, 0.34534353f},
-std::array<float,2>{0.817755342f, 0.488958329f},
-std::array<float,2>{0.179569423f, 0.641304016f},
-std::array<float,2>{0.605636835f, 0.927673936f},
-std::array<float,2>{0.299082994f, 0.177597865f},
-std::array<float,2>{0.990478098f, 0.047995545f},
-std::array<float,2>{0.0210062321f, 0.78043282f},
-std::array<float,2>{0.642457962f, 0.57959193f},
-std::array<float,2>{0.449713588f, 0.357232958f},
-std::array<float,2>{0.524784982f, 0.492434829f},
-std::array<float,2>{0.340786099f, 0.654485524f},
-std::array<float,2>{0.80861032f, 0.933000624f},
-std::array<float,2>{0.233949095f, 0.187258303f},
-std::array<float,2>{0.738420427f, 0.225888744f},
-std::array<float,2>{0.376331657f, 0.956736565f},
-std::array<float,2>{0.932529628f, 0.710710227f},
-std::array<float,2>{0.120663196f, 0.434442669f},
-std::array<float,2>{0.833537102f, 0.259595603f},
-std::array<float,2>{0.162817359f, 0.529440284f},
-std::array<float,2>{0.618933678f, 0.814589083f},
-std::array<float,2>{0.286196887f, 0.082171768f},
-std::array<float,2>{0.75816685f, 0.135367155f},
-std::array<float,2>{0.217729032f, 0.876129925f},
-std::array<float,2>{0.542216837f, 0.670345247f},
-std::array<float,2>{0.344547808f, 0.458264679f},
-std::array<float,2>{0.676744938f, 0.313200563f},
-std::array<float,2>{0.481648386f, 0.604292274f},
-std::array<float,2>{0.961837173f, 0.800010145f},
-std::array<float,2>{0.0574578866f, 0.0276542176f},
-std::array<float,2>{0.589167833f, 0.110776044f},
-std::array<float,2>{0.260044724f, 0.846363902f},
-std::array<float,2>{0.850068986f, 0.550876737f},
-std::array<float,2>{0.145674288f, 0.297049552f},
-std::array<float,2>{0.898244202f, 0.402378172f},
-std::array<float,2>{0.0718712211f, 0.718887925f},
-std::array<float,2>{0.708511174f, 0.973772824f},
-std::array<float,2>{0.431595564f, 0.214729756f},
-std::array<float,2>{0.867960513f, 0.0762714148f},
-std::array<float,2>{0.128719777f, 0.836209476f},
-std::array<float,2>{0.563103437f, 0.51262778f},
-std::array<float,2>{0.267126918f, 0.277988434f},
-std::array<float,2>{0.692189336f, 0.415342152f},
-std::array<float,2>{0.420040816f, 0.70042485f},
-std::array<float,2>{0.890211642f, 0.951246619f},
-std::array<float,2>{0.0907333121f, 0.242388308f},
-std::array<float,2>{0.550732017f, 0.163813397f},
-std::array<float,2>{0.374658108f, 0.915649772f},
-std::array<float,2>{0.779736042f, 0.632642686f},
-std::array<float,2>{0.190733001f, 0.474868327f},
-std::array<float,2>{0.938977301f, 0.373379081f},
-std::array<float,2>{0.0426141322f, 0.564222813f},
-std::array<float,2>{0.666978896f, 0.753970325f},
-std::array<float,2>{0.492197931f, 0.0435636565f},
-std::array<float,2>{0.91429615f, 0.189364627f},
-std::array<float,2>{0.104646906f, 0.98528707f},
-std::array<float,2>{0.732684851f, 0.74049443f},
-std::array<float,2>{0.399789035f, 0.385742396f},
-std::array<float,2>{0.604653656f, 0.296388358f},
-std::array<float,2>{0.303347707f, 0.531605542f},
-std::array<float,2>{0.815610766f, 0.865499616f},
-std::array<float,2>{0.171963245f, 0.107505105f},
-std::array<float,2>{0.639709234f, 0.00235690363f},
-std::array<float,2>{0.468048871f, 0.785038769f},
-std::array<float,2>{0.982216716f, 0.61434412f},
-std::array<float,2>{0.00851585809f, 0.338685542f},
-std::array<float,2>{0.788044631f, 0.446327537f},
-std::array<float,2>{0.235689402f, 0.684626102f},
-std::array<float,2>{0.514443159f, 0.903452516f},
-std::array<float,2>{0.312922418f, 0.141496465f},
-std::array<float,2>{0.876368582f, 0.0992259011f},
-std::array<float,2>{0.0815244243f, 0.873628616f},
-std::array<float,2>{0.701776206f, 0.544830143f},
-std::array<float,2>{0.409521878f, 0.283258229f},
-std::array<float,2>{0.573558688f, 0.377934724f},
-std::array<float,2>{0.278792858f, 0.742460847f},
-std::array<float,2>{0.862988472f, 0.992636681f},
-std::array<float,2>{0.136895552f, 0.196855888f},
-std::array<float,2>{0.659980178f, 0.153003275f},
-std::array<float,2>{0.488761097f, 0.893271744f},
-std::array<float,2>{0.95268625f, 0.678823471f},
-std::array<float,2>{0.0384862535f, 0.443864942f},
-std::array<float,2>{0.771918893f, 0.333418071f},
-std::array<float,2>{0.196869582f, 0.622182548f},
-std::array<float,2>{0.558575451f, 0.79673022f},
-std::array<float,2>{0.365592986f, 0.00894941762f},
-std::array<float,2>{0.820964277f, 0.241125658f},
-std::array<float,2>{0.18516393f, 0.940982342f},
-std::array<float,2>{0.5969311f, 0.691742063f},
-std::array<float,2>{0.305700809f, 0.413496912f},
-std::array<float,2>{0.719979823f, 0.268345833f},
-std::array<float,2>{0.396628678f, 0.502923787f},
-std::array<float,2>{0.907860041f, 0.82945925f},
-std::array<float,2>{0.0958263874f, 0.0630106851f},
-std::array<float,2>{0.500795126f, 0.0379421748f},
-std::array<float,2>{0.320565522f, 0.765351593f},
-std::array<float,2>{0.789374352f, 0.573758841f},
-std::array<float,2>{0.249000654f, 0.365681112f},
-std::array<float,2>{0.976286352f, 0.479006201f},
-std::array<float,2>{0.00560705271f, 0.638508618f},
-std::array<float,2>{0.625258625f, 0.912445664f},
-std::array<float,2>{0.460208893f, 0.16999878f},
-std::array<float,2>{0.804669678f, 0.0228963438f},
-std::array<float,2>{0.221781492f, 0.804738224f},
-std::array<float,2>{0.516503394f, 0.595878363f},
-std::array<float,2>{0.331515044f, 0.323337555f},
-std::array<float,2>{0.649418771f, 0.468387336f},
-std::array<float,2>{0.441769034f, 0.662725031f},
-std::array<float,2>{0.996152878f, 0.890535653f},
-std::array<float,2>{0.0301304907f, 0.128370732f},
-std::array<float,2>{0.609482706f, 0.208723277f},
-std::array<float,2>{0.292115986f, 0.983501375f},
-std::array<float,2>{0.84077394f, 0.728859603f},
-std::array<float,2>{0.16874887f, 0.392497957f},
-std::array<float,2>{0.921884596f, 0.307410479f},
-std::array<float,2>{0.113338873f, 0.558705688f},
-std::array<float,2>{0.746424794f, 0.858306944f},
-std::array<float,2>{0.384368122f, 0.1206773f},
-std::array<float,2>{0.958264291f, 0.172442511f},
-std::array<float,2>{0.0504606776f, 0.924537718f},
-std::array<float,2>{0.687214553f, 0.644766092f},
-std::array<float,2>{0.469442427f, 0.488038719f},
-std::array<float,2>{0.53336674f, 0.348899931f},
-std::array<float,2>{0.352350295f, 0.587935627f},
-std::array<float,2>{0.750592172f, 0.767077267f},
-std::array<float,2>{0.206474751f, 0.0571478903f},
-std::array<float,2>{0.715214908f, 0.091237694f},
-std::array<float,2>{0.422416657f, 0.822521269f},
-std::array<float,2>{0.905382574f, 0.522072434f},
-std::array<float,2>{0.066875346f, 0.254874796f},
-std::array<float,2>{0.852313101f, 0.427698374f},
-std::array<float,2>{0.154070035f, 0.717621863f},
-std::array<float,2>{0.584376991f, 0.963290513f},
-std::array<float,2>{0.251789093f, 0.227589101f},
-std::array<float,2>{0.994441032f, 0.0727795884f},
-std::array<float,2>{0.0260353852f, 0.842390418f},
-std::array<float,2>{0.655186474f, 0.509182096f},
-std::array<float,2>{0.440171838f, 0.276217699f},
-std::array<float,2>{0.522660434f, 0.421213597f},
-std::array<float,2>{0.333894789f, 0.698236525f},
-std::array<float,2>{0.799396992f, 0.945955873f},
-std::array<float,2>{0.226282895f, 0.249290973f},
-std::array<float,2>{0.745025694f, 0.157505333f},
-std::array<float,2>{0.390436739f, 0.921351731f},
-std::array<float,2>{0.927617848f, 0.628073454f},
-std::array<float,2>{0.109901927f, 0.471551597f},
-std::array<float,2>{0.837905049f, 0.37044397f},
-std::array<float,2>{0.167780414f, 0.567541838f},
-std::array<float,2>{0.613535702f, 0.752523482f},
-std::array<float,2>{0.293897331f, 0.0427058749f},
-std::array<float,2>{0.754417837f, 0.194400221f},
-std::array<float,2>{0.207677886f, 0.992102504f},
-std::array<float,2>{0.535922825f, 0.735455036f},
-std::array<float,2>{0.358853281f, 0.388359278f},
-std::array<float,2>{0.681886256f, 0.292895585f},
-std::array<float,2>{0.473797172f, 0.538817823f},
-std::array<float,2>{0.955878496f, 0.863023043f},
-std::array<float,2>{0.0537082963f, 0.102167077f},
-std::array<float,2>{0.57842046f, 0.00495446287f},
-std::array<float,2>{0.256768793f, 0.786607802f},
-std::array<float,2>{0.856965542f, 0.610939085f},
-std::array<float,2>{0.150298268f, 0.343532741f},
-std::array<float,2>{0.901767015f, 0.452035606f},
-std::array<float,2>{0.0633098632f, 0.680000305f},
-std::array<float,2>{0.710985482f, 0.901029468f},
-std::array<float,2>{0.429427773f, 0.147946492f},
-std::array<float,2>{0.863473237f, 0.0546258651f},
-std::array<float,2>{0.135562956f, 0.773672819f},
-std::array<float,2>{0.576774597f, 0.584156096f},
-std::array<float,2>{0.274952441f, 0.352672905f},
-std::array<float,2>{0.698766887f, 0.498235285f},
-std::array<float,2>{0.410653502f, 0.651986778f},
-std::array<float,2>{0.879973888f, 0.936836421f},
-std::array<float,2>{0.0832251832f, 0.183137134f},
-std::array<float,2>{0.559676647f, 0.221103162f},
-std::array<float,2>{0.360883772f, 0.959391713f},
-std::array<float,2>{0.768291175f, 0.705473363f},
-std::array<float,2>{0.199555382f, 0.433277577f},
-std::array<float,2>{0.945591092f, 0.264208525f},
-std::array<float,2>{0.0319192931f, 0.524943113f},
-std::array<float,2>{0.663712025f, 0.819675267f},
-std::array<float,2>{0.485405117f, 0.0805862099f},
-std::array<float,2>{0.910645068f, 0.136814624f},
-std::array<float,2>{0.100573078f, 0.881932974f},
-std::array<float,2>{0.723199368f, 0.667597473f},
-std::array<float,2>{0.393603116f, 0.456909388f},
-std::array<float,2>{0.600105524f, 0.317733824f},
-std::array<float,2>{0.311322093f, 0.608360767f},
-std::array<float,2>{0.825800538f, 0.804118395f},
-std::array<float,2>{0.18181853f, 0.025210565f},
-std::array<float,2>{0.632117748f, 0.11620082f},
-std::array<float,2>{0.456721395f, 0.850003839f},
-std::array<float,2>{0.969306529f, 0.548981309f},
-std::array<float,2>{0.00333975302f, 0.303453952f},
-std::array<float,2>{0.794330716f, 0.401326865f},
-std::array<float,2>{0.244073898f, 0.723278701f},
-std::array<float,2>{0.504104435f, 0.969471574f},
-std::array<float,2>{0.327884555f, 0.21731849f},
-std::array<float,2>{0.884900868f, 0.0192634705f},
-std::array<float,2>{0.0892112032f, 0.811173022f},
-std::array<float,2>{0.688098311f, 0.598501384f},
-std::array<float,2>{0.416293025f, 0.326694071f},
-std::array<float,2>{0.569570243f, 0.464634776f},
-std::array<float,2>{0.271411151f, 0.659273982f},
-std::array<float,2>{0.87316829f, 0.886223912f},
-std::array<float,2>{0.12894018f, 0.132680684f},
-std::array<float,2>{0.669089854f, 0.204464108f},
-std::array<float,2>{0.49858731f, 0.97763139f},
-std::array<float,2>{0.944383681f, 0.732929647f},
-std::array<float,2>{0.0443597473f, 0.3966223f},
-std::array<float,2>{0.775690675f, 0.309898883f},
-std::array<float,2>{0.193644747f, 0.556805372f},
-std::array<float,2>{0.553640008f, 0.853862822f},
-std::array<float,2>{0.368638247f, 0.122269653f},
-std::array<float,2>{0.818890035f, 0.176597521f},
-std::array<float,2>{0.176753402f, 0.926331878f},
-std::array<float,2>{0.608314872f, 0.641607463f},
-std::array<float,2>{0.298395991f, 0.489268631f},
-std::array<float,2>{0.728315771f, 0.344518214f},
-std::array<float,2>{0.404790193f, 0.59208256f},
-std::array<float,2>{0.920371711f, 0.771264553f},
-std::array<float,2>{0.106148399f, 0.0608980991f},
-std::array<float,2>{0.511237979f, 0.0894662216f},
-std::array<float,2>{0.316457421f, 0.827797234f},
-std::array<float,2>{0.782506526f, 0.516227424f},
-std::array<float,2>{0.24159579f, 0.252073884f},
-std::array<float,2>{0.976667464f, 0.425517201f},
-std::array<float,2>{0.0117993765f, 0.714630842f},
-std::array<float,2>{0.636193335f, 0.964941323f},
-std::array<float,2>{0.461265862f, 0.232160568f},
-std::array<float,2>{0.805743337f, 0.0938279927f},
-std::array<float,2>{0.228202626f, 0.868754983f},
-std::array<float,2>{0.529906929f, 0.540350318f},
-std::array<float,2>{0.339352518f, 0.288378984f},
-std::array<float,2>{0.645087838f, 0.381253242f},
-std::array<float,2>{0.44707647f, 0.747580409f},
-std::array<float,2>{0.986341059f, 0.998916149f},
-std::array<float,2>{0.0187270232f, 0.201359123f},
-std::array<float,2>{0.621229112f, 0.151542604f},
-std::array<float,2>{0.282785356f, 0.898422062f},
-std::array<float,2>{0.831166983f, 0.67335391f},
-std::array<float,2>{0.156543925f, 0.439022809f},
-std::array<float,2>{0.936733067f, 0.329291314f},
-std::array<float,2>{0.121406153f, 0.61973083f},
-std::array<float,2>{0.736325681f, 0.790535688f},
-std::array<float,2>{0.378947318f, 0.0141231073f},
-std::array<float,2>{0.96675849f, 0.23752971f},
-std::array<float,2>{0.060644459f, 0.942389488f},
-std::array<float,2>{0.672057331f, 0.690056086f},
-std::array<float,2>{0.478430688f, 0.406349748f},
-std::array<float,2>{0.545337617f, 0.270863146f},
-std::array<float,2>{0.349179983f, 0.506488502f},
-std::array<float,2>{0.76226747f, 0.833360076f},
-std::array<float,2>{0.214020431f, 0.067108199f},
-std::array<float,2>{0.706497014f, 0.0331162997f},
-std::array<float,2>{0.436558992f, 0.758981645f},
-std::array<float,2>{0.893508673f, 0.577269316f},
-std::array<float,2>{0.0772810951f, 0.359729558f},
-std::array<float,2>{0.84504348f, 0.483919799f},
-std::array<float,2>{0.141417876f, 0.63636291f},
-std::array<float,2>{0.592062473f, 0.906626165f},
-std::array<float,2>{0.263586909f, 0.165944472f},
-std::array<float,2>{0.940398455f, 0.0444005355f},
-std::array<float,2>{0.0391078889f, 0.755670846f},
-std::array<float,2>{0.664464235f, 0.563443542f},
-std::array<float,2>{0.49504748f, 0.374626786f},
-std::array<float,2>{0.548777282f, 0.475762397f},
-std::array<float,2>{0.372150093f, 0.631538808f},
-std::array<float,2>{0.778376937f, 0.914794803f},
-std::array<float,2>{0.187690184f, 0.162347987f},
-std::array<float,2>{0.694895446f, 0.243938208f},
-std::array<float,2>{0.418131858f, 0.95226717f},
-std::array<float,2>{0.886889815f, 0.700183928f},
-std::array<float,2>{0.0929076448f, 0.41416201f},
-std::array<float,2>{0.869766295f, 0.278705806f},
-std::array<float,2>{0.126183227f, 0.513442874f},
-std::array<float,2>{0.56630826f, 0.837776124f},
-std::array<float,2>{0.268890977f, 0.0774537101f},
-std::array<float,2>{0.786948323f, 0.142292723f},
-std::array<float,2>{0.23803702f, 0.902633011f},
-std::array<float,2>{0.513452768f, 0.68410188f},
-std::array<float,2>{0.315567493f, 0.44563365f},
-std::array<float,2>{0.638654172f, 0.339125395f},
-std::array<float,2>{0.465556949f, 0.614033759f},
-std::array<float,2>{0.983814418f, 0.783855617f},
-std::array<float,2>{0.0116092777f, 0.00355992885f},
-std::array<float,2>{0.603045046f, 0.109288082f},
-std::array<float,2>{0.30101639f, 0.866630971f},
-std::array<float,2>{0.813311875f, 0.532397926f},
-std::array<float,2>{0.174483672f, 0.295516253f},
-std::array<float,2>{0.916282058f, 0.385035068f},
-std::array<float,2>{0.103040949f, 0.741434634f},
-std::array<float,2>{0.730747759f, 0.985746443f},
-std::array<float,2>{0.400815934f, 0.188151389f},
-std::array<float,2>{0.834042668f, 0.0834469274f},
-std::array<float,2>{0.161169857f, 0.815577567f},
-std::array<float,2>{0.620571434f, 0.530727208f},
-std::array<float,2>{0.288943052f, 0.258266002f},
-std::array<float,2>{0.740480483f, 0.434681594f},
-std::array<float,2>{0.377089322f, 0.709280491f},
-std::array<float,2>{0.930718958f, 0.955346406f},
-std::array<float,2>{0.118395813f, 0.224814624f},
-std::array<float,2>{0.526279151f, 0.186158106f},
-std::array<float,2>{0.343557835f, 0.932074785f},
-std::array<float,2>{0.812252641f, 0.656209171f},
-std::array<float,2>{0.232346907f, 0.494000793f},
-std::array<float,2>{0.990159869f, 0.355810463f},
-std::array<float,2>{0.0216105096f, 0.578919411f},
-std::array<float,2>{0.643672407f, 0.780177891f},
-std::array<float,2>{0.452752054f, 0.0469496846f},
-std::array<float,2>{0.896055222f, 0.212890908f},
-std::array<float,2>{0.0723406225f, 0.973423839f},
-std::array<float,2>{0.71079725f, 0.72060734f},
-std::array<float,2>{0.432883143f, 0.403910369f},
-std::array<float,2>{0.587054193f, 0.298298985f},
-std::array<float,2>{0.259643048f, 0.552288413f},
-std::array<float,2>{0.848553181f, 0.847006142f},
-std::array<float,2>{0.147004411f, 0.109959163f},
-std::array<float,2>{0.679282486f, 0.0286212377f},
-std::array<float,2>{0.483883053f, 0.799286842f},
-std::array<float,2>{0.964740336f, 0.604575872f},
-std::array<float,2>{0.0547074266f, 0.313987464f},
-std::array<float,2>{0.761604309f, 0.457876474f},
-std::array<float,2>{0.215025246f, 0.671144903f},
-std::array<float,2>{0.539654255f, 0.875939727f},
-std::array<float,2>{0.346042246f, 0.136554226f},
-std::array<float,2>{0.924678922f, 0.119779967f},
-std::array<float,2>{0.116934076f, 0.858868778f},
-std::array<float,2>{0.749817431f, 0.560398877f},
-std::array<float,2>{0.385868937f, 0.307678819f},
-std::array<float,2>{0.612540841f, 0.391255528f},
-std::array<float,2>{0.290279359f, 0.730442762f},
-std::array<float,2>{0.841995716f, 0.982463121f},
-std::array<float,2>{0.169950038f, 0.207961112f},
-std::array<float,2>{0.65208894f, 0.127894729f},
-std::array<float,2>{0.445185184f, 0.88884598f},
-std::array<float,2>{0.998247445f, 0.663722575f},
-std::array<float,2>{0.027563503f, 0.467060715f},
-std::array<float,2>{0.802630126f, 0.322571367f},
-std::array<float,2>{0.219213322f, 0.597563088f},
-std::array<float,2>{0.519358635f, 0.805676877f},
-std::array<float,2>{0.330040187f, 0.0215319823f},
-std::array<float,2>{0.855391085f, 0.227032438f},
-std::array<float,2>{0.155592784f, 0.964581907f},
-std::array<float,2>{0.582213342f, 0.718309283f},
-std::array<float,2>{0.252541602f, 0.426064909f},
-std::array<float,2>{0.717713773f, 0.255395532f},
-std::array<float,2>{0.424772263f, 0.522894502f},
-std::array<float,2>{0.903050244f, 0.823971748f},
-std::array<float,2>{0.0694482774f, 0.090246819f},
-std::array<float,2>{0.532719433f, 0.0578610674f},
-std::array<float,2>{0.354080319f, 0.766591668f},
-std::array<float,2>{0.75246644f, 0.58918947f},
-std::array<float,2>{0.204651713f, 0.34837985f},
-std::array<float,2>{0.960258484f, 0.487290114f},
-std::array<float,2>{0.0485182852f, 0.645923018f},
-std::array<float,2>{0.684896708f, 0.925150752f},
-std::array<float,2>{0.470750302f, 0.173782438f},
-std::array<float,2>{0.770875633f, 0.00798759423f},
-std::array<float,2>{0.198496521f, 0.795616388f},
-std::array<float,2>{0.555250049f, 0.621926606f},
-std::array<float,2>{0.365141958f, 0.332345486f},
-std::array<float,2>{0.65628314f, 0.445236266f},
-std::array<float,2>{0.490249664f, 0.67809695f},
-std::array<float,2>{0.950744927f, 0.894340575f},
-std::array<float,2>{0.0353558213f, 0.153788373f},
-std::array<float,2>{0.570953727f, 0.195695862f},
-std::array<float,2>{0.280558735f, 0.993754566f},
-std::array<float,2>{0.860473752f, 0.743279397f},
-std::array<float,2>{0.139086664f, 0.377622783f},
-std::array<float,2>{0.878118038f, 0.284613311f},
-std::array<float,2>{0.0786885992f, 0.543889463f},
-std::array<float,2>{0.699338973f, 0.874125183f},
-std::array<float,2>{0.406800777f, 0.0981711447f},
-std::array<float,2>{0.97385329f, 0.170997798f},
-std::array<float,2>{0.00605032779f, 0.913414717f},
-std::array<float,2>{0.626964867f, 0.637438953f},
-std::array<float,2>{0.458111942f, 0.480466127f},
-std::array<float,2>{0.502101362f, 0.367136598f},
-std::array<float,2>{0.322957486f, 0.572497785f},
-std::array<float,2>{0.791944563f, 0.764636993f},
-std::array<float,2>{0.247735366f, 0.0390392467f},
-std::array<float,2>{0.722444892f, 0.0644107237f},
-std::array<float,2>{0.395035863f, 0.828834534f},
-std::array<float,2>{0.909362376f, 0.503895164f},
-std::array<float,2>{0.0955512971f, 0.268630356f},
-std::array<float,2>{0.823884785f, 0.412672788f},
-std::array<float,2>{0.187489182f, 0.69306469f},
-std::array<float,2>{0.593879879f, 0.94033432f},
-std::array<float,2>{0.306886315f, 0.242125034f},
-std::array<float,2>{0.953387678f, 0.105066329f},
-std::array<float,2>{0.0521022789f, 0.860031009f},
-std::array<float,2>{0.680790424f, 0.536200285f},
-std::array<float,2>{0.474896163f, 0.290054202f},
-std::array<float,2>{0.538167834f, 0.389963627f},
-std::array<float,2>{0.356590629f, 0.73756212f},
-std::array<float,2>{0.757525504f, 0.989439964f},
-std::array<float,2>{0.210899696f, 0.191497266f},
-std::array<float,2>{0.714075208f, 0.145449564f},
-std::array<float,2>{0.427497059f, 0.899450183f},
-std::array<float,2>{0.899109244f, 0.683586895f},
-std::array<float,2>{0.0644805059f, 0.449605584f},
-std::array<float,2>{0.857880414f, 0.340639234f},
-std::array<float,2>{0.151213869f, 0.612525344f},
-std::array<float,2>{0.580973089f, 0.788474143f},
-std::array<float,2>{0.254672885f, 0.00743289851f},
-std::array<float,2>{0.79791671f, 0.246515021f},
-std::array<float,2>{0.223363474f, 0.947954714f},
-std::array<float,2>{0.519775033f, 0.696640432f},
-std::array<float,2>{0.335571527f, 0.418049037f},
-std::array<float,2>{0.653157175f, 0.275181502f},
-std::array<float,2>{0.438037544f, 0.509878993f},
-std::array<float,2>{0.99239856f, 0.841313541f},
-std::array<float,2>{0.0241760425f, 0.0717228651f},
-std::array<float,2>{0.616739869f, 0.0408517979f},
-std::array<float,2>{0.294923693f, 0.750705242f},
-std::array<float,2>{0.837388039f, 0.570221901f},
-std::array<float,2>{0.165190607f, 0.368145198f},
-std::array<float,2>{0.929421127f, 0.469648302f},
-std::array<float,2>{0.111924611f, 0.626048625f},
-std::array<float,2>{0.742836416f, 0.918244004f},
-std::array<float,2>{0.388535589f, 0.160013348f},
-std::array<float,2>{0.827785492f, 0.0267726742f},
-std::array<float,2>{0.181127489f, 0.802393496f},
-std::array<float,2>{0.598138452f, 0.605701149f},
-std::array<float,2>{0.310445219f, 0.319756597f},
-std::array<float,2>{0.726001322f, 0.45424825f},
-std::array<float,2>{0.391609102f, 0.665529907f},
-std::array<float,2>{0.912346542f, 0.880635858f},
-std::array<float,2>{0.097682476f, 0.138782859f},
-std::array<float,2>{0.50710839f, 0.215170085f},
-std::array<float,2>{0.324888289f, 0.971253216f},
-std::array<float,2>{0.795142293f, 0.724866748f},
-std::array<float,2>{0.244261339f, 0.398970991f},
-std::array<float,2>{0.972351909f, 0.302305728f},
-std::array<float,2>{0.00145996187f, 0.548107922f},
-std::array<float,2>{0.629947782f, 0.84915036f},
-std::array<float,2>{0.453235f, 0.113963477f},
-std::array<float,2>{0.88138175f, 0.181415439f},
-std::array<float,2>{0.0856682807f, 0.934130907f},
-std::array<float,2>{0.69640547f, 0.649757028f},
-std::array<float,2>{0.412628502f, 0.496773511f},
-std::array<float,2>{0.575748146f, 0.355119586f},
-std::array<float,2>{0.277315319f, 0.583303571f},
-std::array<float,2>{0.867119431f, 0.775709927f},
-std::array<float,2>{0.13399595f, 0.0515990369f},
-std::array<float,2>{0.660694897f, 0.0786661506f},
-std::array<float,2>{0.488212138f, 0.817807853f},
-std::array<float,2>{0.948084712f, 0.52635169f},
-std::array<float,2>{0.0348585919f, 0.263260514f},
-std::array<float,2>{0.76641649f, 0.431253165f},
-std::array<float,2>{0.202331886f, 0.703267157f},
-std::array<float,2>{0.561394453f, 0.957274318f},
-std::array<float,2>{0.362435281f, 0.219291329f},
-std::array<float,2>{0.919547915f, 0.0605338849f},
-std::array<float,2>{0.107950501f, 0.772143304f},
-std::array<float,2>{0.728663027f, 0.590989411f},
-std::array<float,2>{0.403821647f, 0.345738947f},
-std::array<float,2>{0.606547773f, 0.490364611f},
-std::array<float,2>{0.300019711f, 0.643299878f},
-std::array<float,2>{0.816847265f, 0.929637194f},
-std::array<float,2>{0.178559095f, 0.178998321f},
-std::array<float,2>{0.634542465f, 0.23294884f},
-std::array<float,2>{0.463380814f, 0.968134403f},
-std::array<float,2>{0.979249299f, 0.711565316f},
-std::array<float,2>{0.0149367461f, 0.42327109f},
-std::array<float,2>{0.784141779f, 0.251433462f},
-std::array<float,2>{0.239679977f, 0.518910229f},
-std::array<float,2>{0.508224666f, 0.825332701f},
-std::array<float,2>{0.31932047f, 0.0862270966f},
-std::array<float,2>{0.871684551f, 0.129932255f},
-std::array<float,2>{0.131887004f, 0.884267688f},
-std::array<float,2>{0.566570878f, 0.656619012f},
-std::array<float,2>{0.273110062f, 0.461032957f},
-std::array<float,2>{0.690115869f, 0.325431019f},
-std::array<float,2>{0.414829761f, 0.600579858f},
-std::array<float,2>{0.884565949f, 0.809843957f},
-std::array<float,2>{0.0876118764f, 0.0170480274f},
-std::array<float,2>{0.552189887f, 0.123271704f},
-std::array<float,2>{0.369339585f, 0.853027642f},
-std::array<float,2>{0.774660051f, 0.556595743f},
-std::array<float,2>{0.193304345f, 0.311433762f},
-std::array<float,2>{0.941854775f, 0.395435959f},
-std::array<float,2>{0.0457488969f, 0.731697142f},
-std::array<float,2>{0.671192706f, 0.980162382f},
-std::array<float,2>{0.497241765f, 0.206349954f},
-std::array<float,2>{0.765582919f, 0.0700997934f},
-std::array<float,2>{0.21269992f, 0.835093915f},
-std::array<float,2>{0.544218183f, 0.504698336f},
-std::array<float,2>{0.349852681f, 0.271888703f},
-std::array<float,2>{0.674407244f, 0.40851292f},
-std::array<float,2>{0.479811996f, 0.688257456f},
-std::array<float,2>{0.967359602f, 0.944307864f},
-std::array<float,2>{0.0590374395f, 0.235208824f},
-std::array<float,2>{0.590293705f, 0.167747751f},
-std::array<float,2>{0.26387772f, 0.909066319f},
-std::array<float,2>{0.847068131f, 0.633863032f},
-std::array<float,2>{0.144021422f, 0.481859893f},
-std::array<float,2>{0.892021298f, 0.36142242f},
-std::array<float,2>{0.0759968758f, 0.575744271f},
-std::array<float,2>{0.703724921f, 0.761294782f},
-std::array<float,2>{0.435288429f, 0.0350176282f},
-std::array<float,2>{0.985871553f, 0.199758917f},
-std::array<float,2>{0.0165817719f, 0.997987211f},
-std::array<float,2>{0.647008836f, 0.748808086f},
-std::array<float,2>{0.448191613f, 0.380356789f},
-std::array<float,2>{0.528208256f, 0.285266846f},
-std::array<float,2>{0.336975932f, 0.542884707f},
-std::array<float,2>{0.806680202f, 0.869453609f},
-std::array<float,2>{0.230334938f, 0.0973534882f},
-std::array<float,2>{0.737883091f, 0.0122392997f},
-std::array<float,2>{0.382440567f, 0.792485476f},
-std::array<float,2>{0.934899628f, 0.618218839f},
-std::array<float,2>{0.124545537f, 0.330508769f},
-std::array<float,2>{0.828202724f, 0.441367954f},
-std::array<float,2>{0.159944355f, 0.675501227f},
-std::array<float,2>{0.624728441f, 0.894765794f},
-std::array<float,2>{0.283661813f, 0.149813578f},
-std::array<float,2>{0.980565786f, 0.00102905859f},
-std::array<float,2>{0.00927006733f, 0.781900406f},
-std::array<float,2>{0.63883251f, 0.616022468f},
-std::array<float,2>{0.467349619f, 0.336855024f},
-std::array<float,2>{0.515389979f, 0.448271215f},
-std::array<float,2>{0.313937873f, 0.68718034f},
-std::array<float,2>{0.788531184f, 0.905127227f},
-std::array<float,2>{0.234856248f, 0.14385514f},
-std::array<float,2>{0.733769894f, 0.189531684f},
-std::array<float,2>{0.398453981f, 0.98651439f},
-std::array<float,2>{0.915450454f, 0.739761531f},
-std::array<float,2>{0.103639789f, 0.383067816f},
-std::array<float,2>{0.814785123f, 0.293653905f},
-std::array<float,2>{0.173378006f, 0.533382177f},
-std::array<float,2>{0.60373491f, 0.865121782f},
-std::array<float,2>{0.304265529f, 0.107093967f},
-std::array<float,2>{0.781000316f, 0.161943689f},
-std::array<float,2>{0.190301359f, 0.916671991f},
-std::array<float,2>{0.549191833f, 0.629681349f},
-std::array<float,2>{0.373095095f, 0.472909838f},
-std::array<float,2>{0.667782247f, 0.371668756f},
-std::array<float,2>{0.493863016f, 0.565051615f},
-std::array<float,2>{0.937924862f, 0.756928325f},
-std::array<float,2>{0.0412128754f, 0.0450180061f},
-std::array<float,2>{0.563527822f, 0.0757395029f},
-std::array<float,2>{0.266039968f, 0.838956892f},
-std::array<float,2>{0.868636847f, 0.514499843f},
-std::array<float,2>{0.127317846f, 0.279644877f},
-std::array<float,2>{0.889250875f, 0.416906625f},
-std::array<float,2>{0.0909773558f, 0.702788949f},
-std::array<float,2>{0.692531407f, 0.950196564f},
-std::array<float,2>{0.421779692f, 0.24463518f},
-std::array<float,2>{0.851186395f, 0.112771578f},
-std::array<float,2>{0.145338982f, 0.844823301f},
-std::array<float,2>{0.587914169f, 0.554153383f},
-std::array<float,2>{0.261197507f, 0.300279647f},
-std::array<float,2>{0.707880557f, 0.40545097f},
-std::array<float,2>{0.430566072f, 0.721806705f},
-std::array<float,2>{0.897314548f, 0.975609243f},
-std::array<float,2>{0.0710504502f, 0.212427303f},
-std::array<float,2>{0.541123331f, 0.133205727f},
-std::array<float,2>{0.345037758f, 0.878245652f},
-std::array<float,2>{0.758881211f, 0.669716954f},
-std::array<float,2>{0.218081504f, 0.459955603f},
-std::array<float,2>{0.962677181f, 0.314538389f},
-std::array<float,2>{0.0581193753f, 0.603433311f},
-std::array<float,2>{0.676879644f, 0.798431277f},
-std::array<float,2>{0.480734169f, 0.0299776774f},
-std::array<float,2>{0.933273733f, 0.223027304f},
-std::array<float,2>{0.119148225f, 0.953549445f},
-std::array<float,2>{0.740122259f, 0.707581699f},
-std::array<float,2>{0.375024378f, 0.437138051f},
-std::array<float,2>{0.617907643f, 0.260896862f},
-std::array<float,2>{0.28538239f, 0.528240144f},
-std::array<float,2>{0.832148254f, 0.812878788f},
-std::array<float,2>{0.163228124f, 0.0842012092f},
-std::array<float,2>{0.640795767f, 0.0490020439f},
-std::array<float,2>{0.45100987f, 0.778903723f},
-std::array<float,2>{0.991772294f, 0.580151498f},
-std::array<float,2>{0.0198389404f, 0.359228283f},
-std::array<float,2>{0.809984565f, 0.494521499f},
-std::array<float,2>{0.233009964f, 0.653546453f},
-std::array<float,2>{0.523459852f, 0.931222379f},
-std::array<float,2>{0.340853781f, 0.184523091f},
-std::array<float,2>{0.90483731f, 0.092878826f},
-std::array<float,2>{0.0678961053f, 0.820867419f},
-std::array<float,2>{0.716780365f, 0.520399213f},
-std::array<float,2>{0.422905236f, 0.256771624f},
-std::array<float,2>{0.58502537f, 0.429525465f},
-std::array<float,2>{0.250857979f, 0.71653986f},
-std::array<float,2>{0.853505492f, 0.962746203f},
-std::array<float,2>{0.153027609f, 0.229230896f},
-std::array<float,2>{0.685783923f, 0.174570099f},
-std::array<float,2>{0.469907969f, 0.923662782f},
-std::array<float,2>{0.957551479f, 0.647797108f},
-std::array<float,2>{0.0497103557f, 0.486133099f},
-std::array<float,2>{0.751559913f, 0.35004425f},
-std::array<float,2>{0.205283895f, 0.587173581f},
-std::array<float,2>{0.535110056f, 0.768374979f},
-std::array<float,2>{0.352650791f, 0.0554389544f},
-std::array<float,2>{0.841246605f, 0.210247487f},
-std::array<float,2>{0.169071943f, 0.981796145f},
-std::array<float,2>{0.610388935f, 0.727513671f},
-std::array<float,2>{0.291465193f, 0.392988682f},
-std::array<float,2>{0.747437418f, 0.306031764f},
-std::array<float,2>{0.383226633f, 0.561280847f},
-std::array<float,2>{0.923287272f, 0.856571138f},
-std::array<float,2>{0.115012959f, 0.117323421f},
-std::array<float,2>{0.516751468f, 0.0199189559f},
-std::array<float,2>{0.330937982f, 0.807628512f},
-std::array<float,2>{0.803345382f, 0.594695985f},
-std::array<float,2>{0.221626192f, 0.321187973f},
-std::array<float,2>{0.997200131f, 0.466081381f},
-std::array<float,2>{0.030283276f, 0.661176145f},
-std::array<float,2>{0.648561358f, 0.88850981f},
-std::array<float,2>{0.44330129f, 0.125667721f},
-std::array<float,2>{0.790445685f, 0.0355674624f},
-std::array<float,2>{0.249602437f, 0.763306499f},
-std::array<float,2>{0.501128018f, 0.570660651f},
-std::array<float,2>{0.322046399f, 0.363511533f},
-std::array<float,2>{0.62605834f, 0.47739014f},
-std::array<float,2>{0.459682673f, 0.639702439f},
-std::array<float,2>{0.975372612f, 0.910286784f},
-std::array<float,2>{0.00437270803f, 0.169173211f},
-std::array<float,2>{0.595917702f, 0.240072072f},
-std::array<float,2>{0.305418313f, 0.93814826f},
-std::array<float,2>{0.821877897f, 0.694240034f},
-std::array<float,2>{0.183603302f, 0.411540121f},
-std::array<float,2>{0.906680763f, 0.267542452f},
-std::array<float,2>{0.0974518284f, 0.501581073f},
-std::array<float,2>{0.719332814f, 0.830079913f},
-std::array<float,2>{0.397518396f, 0.0662918538f},
-std::array<float,2>{0.951436937f, 0.156242907f},
-std::array<float,2>{0.0377167463f, 0.891837001f},
-std::array<float,2>{0.658717215f, 0.676411867f},
-std::array<float,2>{0.489818811f, 0.442290485f},
-std::array<float,2>{0.556659281f, 0.334307581f},
-std::array<float,2>{0.36695078f, 0.623318553f},
-std::array<float,2>{0.772617042f, 0.793717504f},
-std::array<float,2>{0.195537478f, 0.00978201907f},
-std::array<float,2>{0.702298462f, 0.100772448f},
-std::array<float,2>{0.40885669f, 0.872490764f},
-std::array<float,2>{0.87504065f, 0.545157254f},
-std::array<float,2>{0.0806561559f, 0.281973392f},
-std::array<float,2>{0.861928821f, 0.376616031f},
-std::array<float,2>{0.138267681f, 0.745568037f},
-std::array<float,2>{0.572886944f, 0.995892406f},
-std::array<float,2>{0.277991056f, 0.198943347f},
-std::array<float,2>{0.987038791f, 0.0968201756f},
-std::array<float,2>{0.0190489795f, 0.869704068f},
-std::array<float,2>{0.644636869f, 0.542386532f},
-std::array<float,2>{0.446611017f, 0.28573367f},
-std::array<float,2>{0.529725254f, 0.380730063f},
-std::array<float,2>{0.339711905f, 0.748226583f},
-std::array<float,2>{0.806212723f, 0.997247517f},
-std::array<float,2>{0.227975816f, 0.199527383f},
-std::array<float,2>{0.735618293f, 0.149907842f},
-std::array<float,2>{0.379455775f, 0.895168304f},
-std::array<float,2>{0.93718034f, 0.674867272f},
-std::array<float,2>{0.12172322f, 0.440472901f},
-std::array<float,2>{0.831957281f, 0.33079955f},
-std::array<float,2>{0.157077089f, 0.618677557f},
-std::array<float,2>{0.621696711f, 0.792380452f},
-std::array<float,2>{0.28261745f, 0.0119014122f},
-std::array<float,2>{0.762117565f, 0.23443079f},
-std::array<float,2>{0.214369118f, 0.943794012f},
-std::array<float,2>{0.545872748f, 0.687845886f},
-std::array<float,2>{0.349110961f, 0.408929646f},
-std::array<float,2>{0.672520816f, 0.27219373f},
-std::array<float,2>{0.477566749f, 0.504205048f},
-std::array<float,2>{0.965968251f, 0.835731149f},
-std::array<float,2>{0.0611744523f, 0.069788754f},
-std::array<float,2>{0.592528045f, 0.0346297733f},
-std::array<float,2>{0.262835592f, 0.76122731f},
-std::array<float,2>{0.845528722f, 0.575340211f},
-std::array<float,2>{0.140717566f, 0.361980557f},
-std::array<float,2>{0.892869413f, 0.482411712f},
-std::array<float,2>{0.0780636445f, 0.634281933f},
-std::array<float,2>{0.706887841f, 0.908476174f},
-std::array<float,2>{0.43728438f, 0.167269915f},
-std::array<float,2>{0.873554647f, 0.0173492692f},
-std::array<float,2>{0.12956953f, 0.810402691f},
-std::array<float,2>{0.570127308f, 0.59984386f},
-std::array<float,2>{0.27059871f, 0.325782627f},
-std::array<float,2>{0.687983036f, 0.46167174f},
-std::array<float,2>{0.416622758f, 0.657048702f},
-std::array<float,2>{0.885550916f, 0.884628654f},
-std::array<float,2>{0.0895791128f, 0.130787373f},
-std::array<float,2>{0.553141713f, 0.206770658f},
-std::array<float,2>{0.368744731f, 0.979514778f},
-std::array<float,2>{0.776131332f, 0.732327223f},
-std::array<float,2>{0.194154739f, 0.394588321f},
-std::array<float,2>{0.945103347f, 0.310606748f},
-std::array<float,2>{0.0446264744f, 0.555967987f},
-std::array<float,2>{0.669784665f, 0.852962494f},
-std::array<float,2>{0.498525411f, 0.123709753f},
-std::array<float,2>{0.920836389f, 0.179322764f},
-std::array<float,2>{0.10581243f, 0.929180324f},
-std::array<float,2>{0.727579534f, 0.64295882f},
-std::array<float,2>{0.404306829f, 0.490822583f},
-std::array<float,2>{0.607638776f, 0.346453637f},
-std::array<float,2>{0.298197538f, 0.591551065f},
-std::array<float,2>{0.818563044f, 0.77150929f},
-std::array<float,2>{0.175985396f, 0.0596112981f},
-std::array<float,2>{0.636475444f, 0.0866257176f},
-std::array<float,2>{0.461617142f, 0.825950742f},
-std::array<float,2>{0.97716713f, 0.519107759f},
-std::array<float,2>{0.0122119151f, 0.251666963f},
-std::array<float,2>{0.782946587f, 0.42377153f},
-std::array<float,2>{0.242085457f, 0.711328685f},
-std::array<float,2>{0.511055648f, 0.968358636f},
-std::array<float,2>{0.316953272f, 0.232560307f},
-std::array<float,2>{0.880506814f, 0.0509398803f},
-std::array<float,2>{0.0836757421f, 0.776245356f},
-std::array<float,2>{0.698527455f, 0.583862901f},
-std::array<float,2>{0.410490096f, 0.354835749f},
-std::array<float,2>{0.576484501f, 0.496268868f},
-std::array<float,2>{0.274843931f, 0.650174499f},
-std::array<float,2>{0.86416316f, 0.933850408f},
-std::array<float,2>{0.134852663f, 0.180872247f},
-std::array<float,2>{0.66346699f, 0.218750983f},
-std::array<float,2>{0.486308903f, 0.957933664f},
-std::array<float,2>{0.94627738f, 0.703928053f},
-std::array<float,2>{0.0317347832f, 0.431016296f},
-std::array<float,2>{0.76786238f, 0.262724519f},
-std::array<float,2>{0.200167269f, 0.525582016f},
-std::array<float,2>{0.560074687f, 0.818294585f},
-std::array<float,2>{0.360751688f, 0.078537561f},
-std::array<float,2>{0.825518787f, 0.139593855f},
-std::array<float,2>{0.182579085f, 0.880287707f},
-std::array<float,2>{0.5998469f, 0.66511929f},
-std::array<float,2>{0.310904533f, 0.454964042f},
-std::array<float,2>{0.722889006f, 0.320092082f},
-std::array<float,2>{0.394205004f, 0.606218159f},
-std::array<float,2>{0.910348654f, 0.802169621f},
-std::array<float,2>{0.100001134f, 0.0271954145f},
-std::array<float,2>{0.504554868f, 0.113609783f},
-std::array<float,2>{0.327377141f, 0.848846257f},
-std::array<float,2>{0.794838965f, 0.548794925f},
-std::array<float,2>{0.243524447f, 0.302228659f},
-std::array<float,2>{0.968889534f, 0.398463666f},
-std::array<float,2>{0.00348256947f, 0.725189567f},
-std::array<float,2>{0.632379949f, 0.970998466f},
-std::array<float,2>{0.456542462f, 0.215437964f},
-std::array<float,2>{0.799314797f, 0.0718029141f},
-std::array<float,2>{0.22590825f, 0.841056645f},
-std::array<float,2>{0.52343595f, 0.510514498f},
-std::array<float,2>{0.33301717f, 0.27456364f},
-std::array<float,2>{0.654380679f, 0.418493748f},
-std::array<float,2>{0.439908296f, 0.697172344f},
-std::array<float,2>{0.994795978f, 0.947612405f},
-std::array<float,2>{0.0254529305f, 0.246684924f},
-std::array<float,2>{0.613969684f, 0.159411877f},
-std::array<float,2>{0.293297976f, 0.918464899f},
-std::array<float,2>{0.838855982f, 0.626867473f},
-std::array<float,2>{0.167320386f, 0.469027072f},
-std::array<float,2>{0.927015066f, 0.367274016f},
-std::array<float,2>{0.109569333f, 0.569543481f},
-std::array<float,2>{0.744326174f, 0.750210524f},
-std::array<float,2>{0.390109718f, 0.0400407463f},
-std::array<float,2>{0.955358922f, 0.192300349f},
-std::array<float,2>{0.0529525317f, 0.989880741f},
-std::array<float,2>{0.682548583f, 0.738131404f},
-std::array<float,2>{0.474159956f, 0.390546679f},
-std::array<float,2>{0.535534263f, 0.291013777f},
-std::array<float,2>{0.358912021f, 0.536843002f},
-std::array<float,2>{0.753951669f, 0.859791577f},
-std::array<float,2>{0.207098573f, 0.104701869f},
-std::array<float,2>{0.711752117f, 0.00701453164f},
-std::array<float,2>{0.428866416f, 0.789048195f},
-std::array<float,2>{0.901900828f, 0.613248467f},
-std::array<float,2>{0.0625308082f, 0.340166688f},
-std::array<float,2>{0.856915057f, 0.449992836f},
-std::array<float,2>{0.149784014f, 0.682800889f},
-std::array<float,2>{0.578872442f, 0.900020242f},
-std::array<float,2>{0.256128371f, 0.144929111f},
-std::array<float,2>{0.950669825f, 0.0104949353f},
-std::array<float,2>{0.0359631889f, 0.793407798f},
-std::array<float,2>{0.656754911f, 0.623599172f},
-std::array<float,2>{0.491008997f, 0.334591985f},
-std::array<float,2>{0.554865479f, 0.441879094f},
-std::array<float,2>{0.364373356f, 0.675880075f},
-std::array<float,2>{0.771114171f, 0.892241061f},
-std::array<float,2>{0.198780879f, 0.155505598f},
-std::array<float,2>{0.699966252f, 0.198474184f},
-std::array<float,2>{0.406337529f, 0.995468974f},
-std::array<float,2>{0.878596961f, 0.745995462f},
-std::array<float,2>{0.0781547055f, 0.376308531f},
-std::array<float,2>{0.861315668f, 0.281686187f},
-std::array<float,2>{0.139352798f, 0.54560405f},
-std::array<float,2>{0.570316255f, 0.873006523f},
-std::array<float,2>{0.28087905f, 0.101311319f},
-std::array<float,2>{0.791268587f, 0.169646606f},
-std::array<float,2>{0.247427955f, 0.9107939f},
-std::array<float,2>{0.502807498f, 0.640587807f},
-std::array<float,2>{0.322477669f, 0.476918072f},
-std::array<float,2>{0.627871513f, 0.363977879f},
-std::array<float,2>{0.458757937f, 0.571097314f},
-std::array<float,2>{0.974309087f, 0.763167024f},
-std::array<float,2>{0.00652073231f, 0.0361142829f},
-std::array<float,2>{0.594490409f, 0.0654473305f},
-std::array<float,2>{0.307512522f, 0.830792785f},
-std::array<float,2>{0.823487639f, 0.501068711f},
-std::array<float,2>{0.186633304f, 0.266894609f},
-std::array<float,2>{0.910109341f, 0.411758423f},
-std::array<float,2>{0.0949164107f, 0.693507314f},
-std::array<float,2>{0.722123027f, 0.937718153f},
-std::array<float,2>{0.394694149f, 0.239460692f},
-std::array<float,2>{0.842506111f, 0.117814191f},
-std::array<float,2>{0.170684323f, 0.857408106f},
-std::array<float,2>{0.613165617f, 0.560831547f},
-std::array<float,2>{0.290715754f, 0.306515723f},
-std::array<float,2>{0.749166071f, 0.393391579f},
-std::array<float,2>{0.386289626f, 0.726564229f},
-std::array<float,2>{0.92388922f, 0.98200798f},
-std::array<float,2>{0.116479941f, 0.21073854f},
-std::array<float,2>{0.51892662f, 0.125464737f},
-std::array<float,2>{0.329328865f, 0.888097048f},
-std::array<float,2>{0.801855743f, 0.661742687f},
-std::array<float,2>{0.219631925f, 0.466642767f},
-std::array<float,2>{0.998915195f, 0.320602298f},
-std::array<float,2>{0.0279945713f, 0.594134092f},
-std::array<float,2>{0.651469469f, 0.808220744f},
-std::array<float,2>{0.444475144f, 0.020135561f},
-std::array<float,2>{0.902352393f, 0.228826776f},
-std::array<float,2>{0.0698387399f, 0.961975455f},
-std::array<float,2>{0.717278481f, 0.715967715f},
-std::array<float,2>{0.424222589f, 0.429161668f},
-std::array<float,2>{0.582743168f, 0.255997151f},
-std::array<float,2>{0.252237678f, 0.519560337f},
-std::array<float,2>{0.854682088f, 0.820376039f},
-std::array<float,2>{0.155870616f, 0.0936597288f},
-std::array<float,2>{0.685459971f, 0.0550723039f},
-std::array<float,2>{0.471246004f, 0.767967939f},
-std::array<float,2>{0.960518956f, 0.587672234f},
-std::array<float,2>{0.048279155f, 0.350520909f},
-std::array<float,2>{0.752008021f, 0.485433728f},
-std::array<float,2>{0.204398051f, 0.648185909f},
-std::array<float,2>{0.532284021f, 0.923190653f},
-std::array<float,2>{0.353630602f, 0.174059436f},
-std::array<float,2>{0.93129003f, 0.0845418945f},
-std::array<float,2>{0.118668541f, 0.813408852f},
-std::array<float,2>{0.740905762f, 0.52741611f},
-std::array<float,2>{0.377587885f, 0.261711031f},
-std::array<float,2>{0.620857775f, 0.436763257f},
-std::array<float,2>{0.288311005f, 0.707312465f},
-std::array<float,2>{0.834860504f, 0.953726709f},
-std::array<float,2>{0.161783725f, 0.223517716f},
-std::array<float,2>{0.644236445f, 0.183739841f},
-std::array<float,2>{0.452177584f, 0.930903196f},
-std::array<float,2>{0.98971647f, 0.653925776f},
-std::array<float,2>{0.0223698281f, 0.495032936f},
-std::array<float,2>{0.811691642f, 0.358574718f},
-std::array<float,2>{0.231504798f, 0.580870986f},
-std::array<float,2>{0.525416553f, 0.778593123f},
-std::array<float,2>{0.343055338f, 0.0496981256f},
-std::array<float,2>{0.84774977f, 0.212357536f},
-std::array<float,2>{0.146660507f, 0.976323068f},
-std::array<float,2>{0.587845385f, 0.722562313f},
-std::array<float,2>{0.258928806f, 0.406086236f},
-std::array<float,2>{0.710025609f, 0.30031082f},
-std::array<float,2>{0.433423668f, 0.554288626f},
-std::array<float,2>{0.895755291f, 0.845578432f},
-std::array<float,2>{0.0731714293f, 0.112958975f},
-std::array<float,2>{0.53925699f, 0.0294549838f},
-std::array<float,2>{0.346487582f, 0.797864437f},
-std::array<float,2>{0.761135221f, 0.602756321f},
-std::array<float,2>{0.215619132f, 0.315092444f},
-std::array<float,2>{0.964031339f, 0.459112912f},
-std::array<float,2>{0.0552961789f, 0.669245958f},
-std::array<float,2>{0.679069042f, 0.878904939f},
-std::array<float,2>{0.484079808f, 0.133650139f},
-std::array<float,2>{0.778990984f, 0.0458502285f},
-std::array<float,2>{0.188376606f, 0.757702053f},
-std::array<float,2>{0.548209727f, 0.564743876f},
-std::array<float,2>{0.372686774f, 0.371534973f},
-std::array<float,2>{0.664838254f, 0.473333597f},
-std::array<float,2>{0.494146168f, 0.629030824f},
-std::array<float,2>{0.939662337f, 0.916081607f},
-std::array<float,2>{0.0400346257f, 0.161297381f},
-std::array<float,2>{0.565439761f, 0.244323969f},
-std::array<float,2>{0.269221812f, 0.951111317f},
-std::array<float,2>{0.869352341f, 0.702333331f},
-std::array<float,2>{0.126830295f, 0.416419923f},
-std::array<float,2>{0.887514651f, 0.279905945f},
-std::array<float,2>{0.0937304944f, 0.513913214f},
-std::array<float,2>{0.69473356f, 0.839611411f},
-std::array<float,2>{0.418858588f, 0.0755389258f},
-std::array<float,2>{0.984165609f, 0.144414946f},
-std::array<float,2>{0.0108860172f, 0.904345334f},
-std::array<float,2>{0.638078868f, 0.686813056f},
-std::array<float,2>{0.465328634f, 0.449168295f},
-std::array<float,2>{0.5129022f, 0.336396396f},
-std::array<float,2>{0.316105396f, 0.615250409f},
-std::array<float,2>{0.786577761f, 0.781465292f},
-std::array<float,2>{0.237430602f, 0.00182589283f},
-std::array<float,2>{0.730957091f, 0.106777415f},
-std::array<float,2>{0.40128389f, 0.864606619f},
-std::array<float,2>{0.91683352f, 0.533864915f},
-std::array<float,2>{0.102711573f, 0.293332279f},
-std::array<float,2>{0.812826276f, 0.383678436f},
-std::array<float,2>{0.174220562f, 0.739279866f},
-std::array<float,2>{0.602596879f, 0.987080395f},
-std::array<float,2>{0.301375985f, 0.19010368f},
-std::array<float,2>{0.9670856f, 0.0667943135f},
-std::array<float,2>{0.059086822f, 0.83375901f},
-std::array<float,2>{0.673862934f, 0.505886972f},
-std::array<float,2>{0.480275214f, 0.271073461f},
-std::array<float,2>{0.544457078f, 0.406878591f},
-std::array<float,2>{0.350563347f, 0.689543068f},
-std::array<float,2>{0.764976025f, 0.943034649f},
-std::array<float,2>{0.212153986f, 0.237939104f},
-std::array<float,2>{0.703220069f, 0.165155843f},
-std::array<float,2>{0.434699744f, 0.90707159f},
-std::array<float,2>{0.892499745f, 0.635805249f},
-std::array<float,2>{0.075501129f, 0.483593225f},
-std::array<float,2>{0.847225845f, 0.36025843f},
-std::array<float,2>{0.144470781f, 0.578101993f},
-std::array<float,2>{0.590585828f, 0.759509921f},
-std::array<float,2>{0.26455766f, 0.0325633027f},
-std::array<float,2>{0.807535112f, 0.201822147f},
-std::array<float,2>{0.229914784f, 0.998466492f},
-std::array<float,2>{0.527577698f, 0.747122109f},
-std::array<float,2>{0.337726474f, 0.381527781f},
-std::array<float,2>{0.646715283f, 0.288751692f},
-std::array<float,2>{0.447443575f, 0.54060322f},
-std::array<float,2>{0.985490382f, 0.868234277f},
-std::array<float,2>{0.016040422f, 0.0944651887f},
-std::array<float,2>{0.624362528f, 0.0142602278f},
-std::array<float,2>{0.28383106f, 0.790353119f},
-std::array<float,2>{0.82886374f, 0.619586408f},
-std::array<float,2>{0.15938656f, 0.329610944f},
-std::array<float,2>{0.935338616f, 0.438594431f},
-std::array<float,2>{0.124398254f, 0.673319876f},
-std::array<float,2>{0.737369359f, 0.897478819f},
-std::array<float,2>{0.38207677f, 0.151998088f},
-std::array<float,2>{0.816959083f, 0.0612418465f},
-std::array<float,2>{0.177995995f, 0.77071476f},
-std::array<float,2>{0.60725379f, 0.592749536f},
-std::array<float,2>{0.300725371f, 0.344222546f},
-std::array<float,2>{0.729396582f, 0.490210682f},
-std::array<float,2>{0.403777748f, 0.642100394f},
-std::array<float,2>{0.91909647f, 0.926155925f},
-std::array<float,2>{0.107780494f, 0.17618376f},
-std::array<float,2>{0.508788705f, 0.231788307f},
-std::array<float,2>{0.318390518f, 0.965345442f},
-std::array<float,2>{0.783528328f, 0.71416527f},
-std::array<float,2>{0.240030766f, 0.425007969f},
-std::array<float,2>{0.978628039f, 0.252579451f},
-std::array<float,2>{0.0153446831f, 0.515931785f},
-std::array<float,2>{0.633963168f, 0.827556729f},
-std::array<float,2>{0.463100463f, 0.0888883546f},
-std::array<float,2>{0.88426125f, 0.132258922f},
-std::array<float,2>{0.0873485878f, 0.886439502f},
-std::array<float,2>{0.689599097f, 0.660140455f},
-std::array<float,2>{0.414492667f, 0.464310765f},
-std::array<float,2>{0.567028463f, 0.326616704f},
-std::array<float,2>{0.272777706f, 0.597822368f},
-std::array<float,2>{0.871451676f, 0.810890496f},
-std::array<float,2>{0.132644981f, 0.0186316073f},
-std::array<float,2>{0.671560287f, 0.122769766f},
-std::array<float,2>{0.497953117f, 0.854400635f},
-std::array<float,2>{0.942038178f, 0.557480514f},
-std::array<float,2>{0.0453511514f, 0.310313106f},
-std::array<float,2>{0.775385022f, 0.396979302f},
-std::array<float,2>{0.192707613f, 0.732641757f},
-std::array<float,2>{0.552277267f, 0.978136539f},
-std::array<float,2>{0.36998716f, 0.204855487f},
-std::array<float,2>{0.912989497f, 0.024898693f},
-std::array<float,2>{0.0985242501f, 0.804505229f},
-std::array<float,2>{0.726523101f, 0.607438922f},
-std::array<float,2>{0.392390877f, 0.318206072f},
-std::array<float,2>{0.59840256f, 0.456423998f},
-std::array<float,2>{0.309851587f, 0.666993797f},
-std::array<float,2>{0.827557862f, 0.882799089f},
-std::array<float,2>{0.181511045f, 0.13737385f},
-std::array<float,2>{0.63051796f, 0.216918841f},
-std::array<float,2>{0.453889698f, 0.968824089f},
-std::array<float,2>{0.972048402f, 0.723086059f},
-std::array<float,2>{0.00163972413f, 0.400711149f},
-std::array<float,2>{0.795861423f, 0.303015828f},
-std::array<float,2>{0.244934201f, 0.549492359f},
-std::array<float,2>{0.507806003f, 0.850551367f},
-std::array<float,2>{0.324436188f, 0.115609907f},
-std::array<float,2>{0.866442621f, 0.183099657f},
-std::array<float,2>{0.134465903f, 0.937128782f},
-std::array<float,2>{0.575606704f, 0.651843488f},
-std::array<float,2>{0.276727349f, 0.49881348f},
-std::array<float,2>{0.697247446f, 0.353238136f},
-std::array<float,2>{0.412399858f, 0.584607065f},
-std::array<float,2>{0.881223857f, 0.774294198f},
-std::array<float,2>{0.0850658715f, 0.0537729971f},
-std::array<float,2>{0.560862362f, 0.080252856f},
-std::array<float,2>{0.362876594f, 0.819839597f},
-std::array<float,2>{0.765950203f, 0.524448276f},
-std::array<float,2>{0.202981398f, 0.263844818f},
-std::array<float,2>{0.947353244f, 0.433026344f},
-std::array<float,2>{0.0343404077f, 0.705659449f},
-std::array<float,2>{0.660627663f, 0.959652841f},
-std::array<float,2>{0.487580359f, 0.221384451f},
-std::array<float,2>{0.757203281f, 0.101756163f},
-std::array<float,2>{0.210053355f, 0.862697184f},
-std::array<float,2>{0.538887024f, 0.538380027f},
-std::array<float,2>{0.35738793f, 0.292403042f},
-std::array<float,2>{0.681346178f, 0.388051987f},
-std::array<float,2>{0.475495726f, 0.73623693f},
-std::array<float,2>{0.953980803f, 0.991330266f},
-std::array<float,2>{0.0523408167f, 0.195129335f},
-std::array<float,2>{0.580483496f, 0.148380563f},
-std::array<float,2>{0.253907382f, 0.900520623f},
-std::array<float,2>{0.8583408f, 0.680501461f},
-std::array<float,2>{0.150444314f, 0.451640457f},
-std::array<float,2>{0.8985129f, 0.343140781f},
-std::array<float,2>{0.0649693012f, 0.610564172f},
-std::array<float,2>{0.714658439f, 0.786880374f},
-std::array<float,2>{0.427165538f, 0.00567660108f},
-std::array<float,2>{0.992993355f, 0.249643192f},
-std::array<float,2>{0.0234990381f, 0.945409477f},
-std::array<float,2>{0.652421653f, 0.697749496f},
-std::array<float,2>{0.437668055f, 0.421482295f},
-std::array<float,2>{0.520056546f, 0.275510401f},
-std::array<float,2>{0.335364521f, 0.509322822f},
-std::array<float,2>{0.798628449f, 0.841867566f},
-std::array<float,2>{0.222954869f, 0.0725144818f},
-std::array<float,2>{0.742390096f, 0.0423854291f},
-std::array<float,2>{0.387925863f, 0.752180338f},
-std::array<float,2>{0.928777993f, 0.568186522f},
-std::array<float,2>{0.11145965f, 0.370684385f},
-std::array<float,2>{0.837817371f, 0.471025556f},
-std::array<float,2>{0.165599346f, 0.628749251f},
-std::array<float,2>{0.616451859f, 0.921825826f},
-std::array<float,2>{0.295604467f, 0.157825992f},
-std::array<float,2>{0.974716187f, 0.0383677892f},
-std::array<float,2>{0.00476240786f, 0.763826787f},
-std::array<float,2>{0.626652956f, 0.572787583f},
-std::array<float,2>{0.459415793f, 0.366211116f},
-std::array<float,2>{0.50165379f, 0.479617417f},
-std::array<float,2>{0.32156533f, 0.636902869f},
-std::array<float,2>{0.790967107f, 0.913641512f},
-std::array<float,2>{0.249093935f, 0.171492681f},
-std::array<float,2>{0.718963385f, 0.241317987f},
-std::array<float,2>{0.398272932f, 0.939724267f},
-std::array<float,2>{0.906853557f, 0.692599654f},
-std::array<float,2>{0.0970141441f, 0.412537992f},
-std::array<float,2>{0.821348786f, 0.269470304f},
-std::array<float,2>{0.184518382f, 0.503020227f},
-std::array<float,2>{0.596193254f, 0.82859987f},
-std::array<float,2>{0.305090815f, 0.0638240948f},
-std::array<float,2>{0.773387909f, 0.154291824f},
-std::array<float,2>{0.196108669f, 0.893638551f},
-std::array<float,2>{0.557410121f, 0.678324044f},
-std::array<float,2>{0.366621733f, 0.444479644f},
-std::array<float,2>{0.658558905f, 0.332765192f},
-std::array<float,2>{0.489340931f, 0.621117711f},
-std::array<float,2>{0.952143133f, 0.79506886f},
-std::array<float,2>{0.0375412181f, 0.00856360421f},
-std::array<float,2>{0.572427034f, 0.0976578593f},
-std::array<float,2>{0.277354658f, 0.874598682f},
-std::array<float,2>{0.861774504f, 0.543151081f},
-std::array<float,2>{0.137843728f, 0.284969479f},
-std::array<float,2>{0.875634432f, 0.377049237f},
-std::array<float,2>{0.0801985785f, 0.74395901f},
-std::array<float,2>{0.702949882f, 0.993384719f},
-std::array<float,2>{0.408622205f, 0.195990801f},
-std::array<float,2>{0.852793455f, 0.0904942527f},
-std::array<float,2>{0.152476475f, 0.823463023f},
-std::array<float,2>{0.585600257f, 0.523053765f},
-std::array<float,2>{0.250170559f, 0.25503996f},
-std::array<float,2>{0.716077983f, 0.426611006f},
-std::array<float,2>{0.423447251f, 0.717905581f},
-std::array<float,2>{0.90475738f, 0.964026272f},
-std::array<float,2>{0.0677287802f, 0.227174282f},
-std::array<float,2>{0.53466469f, 0.173165932f},
-std::array<float,2>{0.353422225f, 0.925587714f},
-std::array<float,2>{0.75107497f, 0.646334052f},
-std::array<float,2>{0.205855981f, 0.486469179f},
-std::array<float,2>{0.957049966f, 0.34809202f},
-std::array<float,2>{0.0492649041f, 0.589805782f},
-std::array<float,2>{0.686245739f, 0.765834212f},
-std::array<float,2>{0.470584542f, 0.0583844706f},
-std::array<float,2>{0.923644006f, 0.207356408f},
-std::array<float,2>{0.11464306f, 0.983100832f},
-std::array<float,2>{0.747880936f, 0.729521751f},
-std::array<float,2>{0.383514732f, 0.390909433f},
-std::array<float,2>{0.610953927f, 0.308179259f},
-std::array<float,2>{0.29188633f, 0.559891224f},
-std::array<float,2>{0.841622055f, 0.859330773f},
-std::array<float,2>{0.169901744f, 0.119388305f},
-std::array<float,2>{0.649100661f, 0.0223012641f},
-std::array<float,2>{0.442646354f, 0.806297898f},
-std::array<float,2>{0.997668862f, 0.596950889f},
-std::array<float,2>{0.0310269613f, 0.322799206f},
-std::array<float,2>{0.802823126f, 0.467498869f},
-std::array<float,2>{0.220913783f, 0.663350999f},
-std::array<float,2>{0.517562747f, 0.889216721f},
-std::array<float,2>{0.330161989f, 0.127193063f},
-std::array<float,2>{0.896859407f, 0.109620787f},
-std::array<float,2>{0.0703923181f, 0.847218692f},
-std::array<float,2>{0.707456946f, 0.551858485f},
-std::array<float,2>{0.430000275f, 0.298601925f},
-std::array<float,2>{0.588689506f, 0.403706551f},
-std::array<float,2>{0.26129061f, 0.719852924f},
-std::array<float,2>{0.851066828f, 0.972948194f},
-std::array<float,2>{0.144665584f, 0.213467479f},
-std::array<float,2>{0.67751348f, 0.135859862f},
-std::array<float,2>{0.481314361f, 0.87523222f},
-std::array<float,2>{0.961920202f, 0.671704173f},
-std::array<float,2>{0.0577314012f, 0.457123488f},
-std::array<float,2>{0.759632647f, 0.313775182f},
-std::array<float,2>{0.218625322f, 0.605196118f},
-std::array<float,2>{0.541771114f, 0.799376488f},
-std::array<float,2>{0.345222324f, 0.0292099938f},
-std::array<float,2>{0.83296901f, 0.225421101f},
-std::array<float,2>{0.163927302f, 0.955651879f},
-std::array<float,2>{0.61730051f, 0.709500015f},
-std::array<float,2>{0.285736859f, 0.435487866f},
-std::array<float,2>{0.739289522f, 0.258536637f},
-std::array<float,2>{0.375778586f, 0.530869007f},
-std::array<float,2>{0.932989538f, 0.816190839f},
-std::array<float,2>{0.120027393f, 0.0836924836f},
-std::array<float,2>{0.524389327f, 0.0474263616f},
-std::array<float,2>{0.341660976f, 0.779745996f},
-std::array<float,2>{0.810087979f, 0.578230023f},
-std::array<float,2>{0.232542664f, 0.356290042f},
-std::array<float,2>{0.991292357f, 0.49362734f},
-std::array<float,2>{0.0204413701f, 0.655507743f},
-std::array<float,2>{0.641427934f, 0.932495117f},
-std::array<float,2>{0.450665623f, 0.185664058f},
-std::array<float,2>{0.788876712f, 0.00310662086f},
-std::array<float,2>{0.235341191f, 0.783510864f},
-std::array<float,2>{0.514810741f, 0.613764465f},
-std::array<float,2>{0.314054668f, 0.339568973f},
-std::array<float,2>{0.63939476f, 0.446098447f},
-std::array<float,2>{0.467157066f, 0.683987558f},
-std::array<float,2>{0.980997145f, 0.903264701f},
-std::array<float,2>{0.00958662387f, 0.142015532f},
-std::array<float,2>{0.604302526f, 0.187803328f},
-std::array<float,2>{0.304181129f, 0.985940933f},
-std::array<float,2>{0.815104961f, 0.741891384f},
-std::array<float,2>{0.173244849f, 0.385698438f},
-std::array<float,2>{0.915986717f, 0.295157939f},
-std::array<float,2>{0.104194604f, 0.533152044f},
-std::array<float,2>{0.734247684f, 0.866892874f},
-std::array<float,2>{0.399338424f, 0.108485356f},
-std::array<float,2>{0.938270628f, 0.162903756f},
-std::array<float,2>{0.0418768823f, 0.914093912f},
-std::array<float,2>{0.667455494f, 0.631059587f},
-std::array<float,2>{0.49345848f, 0.4761886f},
-std::array<float,2>{0.549525201f, 0.374491602f},
-std::array<float,2>{0.373916745f, 0.562747478f},
-std::array<float,2>{0.780647695f, 0.755001485f},
-std::array<float,2>{0.189664528f, 0.0444610193f},
-std::array<float,2>{0.693222463f, 0.0780068338f},
-std::array<float,2>{0.421050787f, 0.83692199f},
-std::array<float,2>{0.88910228f, 0.513107359f},
-std::array<float,2>{0.0914094448f, 0.279092103f},
-std::array<float,2>{0.868918955f, 0.414582074f},
-std::array<float,2>{0.127626583f, 0.699225962f},
-std::array<float,2>{0.564019382f, 0.952822864f},
-std::array<float,2>{0.266174763f, 0.243208379f},
-std::array<float,2>{0.977853835f, 0.0883706287f},
-std::array<float,2>{0.0136551782f, 0.826261103f},
-std::array<float,2>{0.635345519f, 0.516837656f},
-std::array<float,2>{0.461932689f, 0.252962649f},
-std::array<float,2>{0.510623515f, 0.424466193f},
-std::array<float,2>{0.317560643f, 0.713317811f},
-std::array<float,2>{0.781663179f, 0.965985835f},
-std::array<float,2>{0.240897849f, 0.231321827f},
-std::array<float,2>{0.727339208f, 0.176812738f},
-std::array<float,2>{0.406149596f, 0.927056909f},
-std::array<float,2>{0.921237051f, 0.641087949f},
-std::array<float,2>{0.106987424f, 0.488469899f},
-std::array<float,2>{0.819881439f, 0.344812721f},
-std::array<float,2>{0.176970273f, 0.593557179f},
-std::array<float,2>{0.6085127f, 0.769901276f},
-std::array<float,2>{0.297058076f, 0.0622432306f},
-std::array<float,2>{0.776545346f, 0.203378975f},
-std::array<float,2>{0.194673494f, 0.977192819f},
-std::array<float,2>{0.55383867f, 0.73360914f},
-std::array<float,2>{0.367491275f, 0.397472143f},
-std::array<float,2>{0.66815716f, 0.30918932f},
-std::array<float,2>{0.499679029f, 0.558415592f},
-std::array<float,2>{0.943868816f, 0.855421305f},
-std::array<float,2>{0.0433032848f, 0.121313147f},
-std::array<float,2>{0.568368316f, 0.0182715915f},
-std::array<float,2>{0.26980722f, 0.811566174f},
-std::array<float,2>{0.874863029f, 0.59883523f},
-std::array<float,2>{0.130758524f, 0.327947289f},
-std::array<float,2>{0.886234283f, 0.463068545f},
-std::array<float,2>{0.0884270817f, 0.658938766f},
-std::array<float,2>{0.688827515f, 0.885286927f},
-std::array<float,2>{0.417756766f, 0.131495744f},
-std::array<float,2>{0.844460487f, 0.0315897278f},
-std::array<float,2>{0.142121896f, 0.758339345f},
-std::array<float,2>{0.593463182f, 0.577070057f},
-std::array<float,2>{0.262016833f, 0.361037135f},
-std::array<float,2>{0.705624819f, 0.482625425f},
-std::array<float,2>{0.4359034f, 0.634994507f},
-std::array<float,2>{0.894511461f, 0.907482207f},
-std::array<float,2>{0.0768051073f, 0.164714336f},
-std::array<float,2>{0.54629308f, 0.236473233f},
-std::array<float,2>{0.347888321f, 0.942106307f},
-std::array<float,2>{0.76286447f, 0.690853357f},
-std::array<float,2>{0.212925687f, 0.407836735f},
-std::array<float,2>{0.964996815f, 0.27018699f},
-std::array<float,2>{0.0624135993f, 0.50716877f},
-std::array<float,2>{0.673280418f, 0.832300067f},
-std::array<float,2>{0.477157831f, 0.0677938983f},
-std::array<float,2>{0.936071634f, 0.150742978f},
-std::array<float,2>{0.122471832f, 0.896899998f},
-std::array<float,2>{0.734863222f, 0.671897769f},
-std::array<float,2>{0.380555242f, 0.43799144f},
-std::array<float,2>{0.622237802f, 0.328704476f},
-std::array<float,2>{0.282074004f, 0.620725632f},
-std::array<float,2>{0.83031249f, 0.789172828f},
-std::array<float,2>{0.15729098f, 0.0155891441f},
-std::array<float,2>{0.646408021f, 0.0952974707f},
-std::array<float,2>{0.445768625f, 0.867634714f},
-std::array<float,2>{0.987982988f, 0.539077759f},
-std::array<float,2>{0.0183642339f, 0.287842989f},
-std::array<float,2>{0.8048684f, 0.381847322f},
-std::array<float,2>{0.227115408f, 0.746270776f},
-std::array<float,2>{0.531225681f, 0.999643147f},
-std::array<float,2>{0.337958097f, 0.202497169f},
-std::array<float,2>{0.901138902f, 0.00427174708f},
-std::array<float,2>{0.0639899075f, 0.78600806f},
-std::array<float,2>{0.7128793f, 0.610162675f},
-std::array<float,2>{0.428559422f, 0.342043787f},
-std::array<float,2>{0.579665005f, 0.453106046f},
-std::array<float,2>{0.257556856f, 0.681259274f},
-std::array<float,2>{0.856382608f, 0.902280509f},
-std::array<float,2>{0.149035275f, 0.146865442f},
-std::array<float,2>{0.68335402f, 0.194320917f},
-std::array<float,2>{0.473334461f, 0.990475535f},
-std::array<float,2>{0.957015574f, 0.734998703f},
-std::array<float,2>{0.0546559207f, 0.387539148f},
-std::array<float,2>{0.755670309f, 0.291660875f},
-std::array<float,2>{0.208448336f, 0.537231088f},
-std::array<float,2>{0.536298513f, 0.8614465f},
-std::array<float,2>{0.35769558f, 0.102736942f},
-std::array<float,2>{0.839609861f, 0.156672493f},
-std::array<float,2>{0.166369781f, 0.920162678f},
-std::array<float,2>{0.615097165f, 0.627661705f},
-std::array<float,2>{0.294158012f, 0.471838683f},
-std::array<float,2>{0.745197356f, 0.369525909f},
-std::array<float,2>{0.388861865f, 0.566558421f},
-std::array<float,2>{0.926064551f, 0.753574908f},
-std::array<float,2>{0.110964753f, 0.0416687764f},
-std::array<float,2>{0.522079408f, 0.0735847652f},
-std::array<float,2>{0.332036525f, 0.843597829f},
-std::array<float,2>{0.800119698f, 0.508399069f},
-std::array<float,2>{0.22466214f, 0.276441276f},
-std::array<float,2>{0.995211244f, 0.419925719f},
-std::array<float,2>{0.0268896185f, 0.698772192f},
-std::array<float,2>{0.655738235f, 0.947041333f},
-std::array<float,2>{0.441023529f, 0.248575136f},
-std::array<float,2>{0.793923616f, 0.116935603f},
-std::array<float,2>{0.242380574f, 0.851474345f},
-std::array<float,2>{0.505502105f, 0.550029874f},
-std::array<float,2>{0.326666176f, 0.303793103f},
-std::array<float,2>{0.63098079f, 0.402108401f},
-std::array<float,2>{0.455582529f, 0.724034488f},
-std::array<float,2>{0.969833374f, 0.970189571f},
-std::array<float,2>{0.00248063658f, 0.218599454f},
-std::array<float,2>{0.601325393f, 0.138422891f},
-std::array<float,2>{0.311872214f, 0.881774247f},
-std::array<float,2>{0.825021148f, 0.666358948f},
-std::array<float,2>{0.182835162f, 0.455770642f},
-std::array<float,2>{0.91158545f, 0.316573381f},
-std::array<float,2>{0.101007149f, 0.609094083f},
-std::array<float,2>{0.72436738f, 0.803135455f},
-std::array<float,2>{0.393265158f, 0.0235871263f},
-std::array<float,2>{0.947049618f, 0.221969754f},
-std::array<float,2>{0.0324541293f, 0.960037887f},
-std::array<float,2>{0.662436485f, 0.706871808f},
-std::array<float,2>{0.484703898f, 0.431762457f},
-std::array<float,2>{0.558716238f, 0.264926165f},
-std::array<float,2>{0.360237688f, 0.52399832f},
-std::array<float,2>{0.768763065f, 0.818960845f},
-std::array<float,2>{0.200530782f, 0.0820083991f},
-std::array<float,2>{0.697741747f, 0.0528270118f},
-std::array<float,2>{0.411186099f, 0.774975836f},
-std::array<float,2>{0.879399002f, 0.585001051f},
-std::array<float,2>{0.0827357918f, 0.351798207f},
-std::array<float,2>{0.864548504f, 0.499108404f},
-std::array<float,2>{0.136400372f, 0.650942385f},
-std::array<float,2>{0.577233195f, 0.935563743f},
-std::array<float,2>{0.273981571f, 0.181693748f},
-std::array<float,2>{0.959096193f, 0.0566838719f},
-std::array<float,2>{0.0473889858f, 0.767139435f},
-std::array<float,2>{0.68418175f, 0.588465214f},
-std::array<float,2>{0.47181958f, 0.349335849f},
-std::array<float,2>{0.532097816f, 0.487512469f},
-std::array<float,2>{0.355423599f, 0.645026267f},
-std::array<float,2>{0.753377259f, 0.923984945f},
-std::array<float,2>{0.203855664f, 0.172238827f},
-std::array<float,2>{0.718624175f, 0.228127778f},
-std::array<float,2>{0.425095081f, 0.963730276f},
-std::array<float,2>{0.904074609f, 0.717078328f},
-std::array<float,2>{0.0687270239f, 0.426983714f},
-std::array<float,2>{0.853991389f, 0.254270017f},
-std::array<float,2>{0.154793769f, 0.521544516f},
-std::array<float,2>{0.583781958f, 0.823028743f},
-std::array<float,2>{0.25323683f, 0.0913866907f},
-std::array<float,2>{0.801708281f, 0.128454328f},
-std::array<float,2>{0.220469072f, 0.890072644f},
-std::array<float,2>{0.518010616f, 0.662311673f},
-std::array<float,2>{0.328700006f, 0.46794638f},
-std::array<float,2>{0.650517285f, 0.324073076f},
-std::array<float,2>{0.443412393f, 0.596432447f},
-std::array<float,2>{0.999749243f, 0.805292666f},
-std::array<float,2>{0.028812062f, 0.0229983442f},
-std::array<float,2>{0.611505508f, 0.120291345f},
-std::array<float,2>{0.289604753f, 0.85760963f},
-std::array<float,2>{0.843647778f, 0.559384823f},
-std::array<float,2>{0.171465531f, 0.30706346f},
-std::array<float,2>{0.925147831f, 0.391656697f},
-std::array<float,2>{0.115301535f, 0.72925508f},
-std::array<float,2>{0.748164237f, 0.98419112f},
-std::array<float,2>{0.385644048f, 0.208175868f},
-std::array<float,2>{0.822753191f, 0.0626064092f},
-std::array<float,2>{0.185921475f, 0.829619527f},
-std::array<float,2>{0.594934344f, 0.5020836f},
-std::array<float,2>{0.308432817f, 0.268025309f},
-std::array<float,2>{0.721142232f, 0.413699478f},
-std::array<float,2>{0.395595223f, 0.691899896f},
-std::array<float,2>{0.908519387f, 0.940604568f},
-std::array<float,2>{0.0940011591f, 0.240627214f},
-std::array<float,2>{0.503153503f, 0.170833319f},
-std::array<float,2>{0.323370993f, 0.912655652f},
-std::array<float,2>{0.792594135f, 0.637767792f},
-std::array<float,2>{0.246248379f, 0.478724808f},
-std::array<float,2>{0.973040521f, 0.366089135f},
-std::array<float,2>{0.007060003f, 0.573698342f},
-std::array<float,2>{0.628354132f, 0.76494509f},
-std::array<float,2>{0.457920164f, 0.0373965278f},
-std::array<float,2>{0.877438307f, 0.196622133f},
-std::array<float,2>{0.0792114511f, 0.992795348f},
-std::array<float,2>{0.700635433f, 0.743161321f},
-std::array<float,2>{0.407817066f, 0.378722847f},
-std::array<float,2>{0.571742296f, 0.28372547f},
-std::array<float,2>{0.280255258f, 0.544053912f},
-std::array<float,2>{0.859403968f, 0.873288751f},
-std::array<float,2>{0.140525967f, 0.0990079269f},
-std::array<float,2>{0.65732044f, 0.00932212081f},
-std::array<float,2>{0.491416365f, 0.795903206f},
-std::array<float,2>{0.950094342f, 0.622926235f},
-std::array<float,2>{0.0362165831f, 0.333705038f},
-std::array<float,2>{0.769896448f, 0.443483979f},
-std::array<float,2>{0.198036119f, 0.679281652f},
-std::array<float,2>{0.5565539f, 0.892945051f},
-std::array<float,2>{0.363594323f, 0.152798459f},
-std::array<float,2>{0.917305827f, 0.108218156f},
-std::array<float,2>{0.102495693f, 0.865981102f},
-std::array<float,2>{0.731794f, 0.532038987f},
-std::array<float,2>{0.402135879f, 0.296155155f},
-std::array<float,2>{0.601785302f, 0.386629999f},
-std::array<float,2>{0.302353144f, 0.741182208f},
-std::array<float,2>{0.81349659f, 0.984637976f},
-std::array<float,2>{0.175045907f, 0.188549504f},
-std::array<float,2>{0.637058377f, 0.140754983f},
-std::array<float,2>{0.466738015f, 0.90403831f},
-std::array<float,2>{0.982549131f, 0.685101569f},
-std::array<float,2>{0.01033362f, 0.446804613f},
-std::array<float,2>{0.785231233f, 0.3379035f},
-std::array<float,2>{0.236426502f, 0.615118027f},
-std::array<float,2>{0.512643874f, 0.784534931f},
-std::array<float,2>{0.314680815f, 0.00268699508f},
-std::array<float,2>{0.870132685f, 0.242922962f},
-std::array<float,2>{0.125124231f, 0.951803625f},
-std::array<float,2>{0.564544797f, 0.701136589f},
-std::array<float,2>{0.267638415f, 0.415998578f},
-std::array<float,2>{0.693712771f, 0.277413011f},
-std::array<float,2>{0.419359207f, 0.512204111f},
-std::array<float,2>{0.888104618f, 0.836555421f},
-std::array<float,2>{0.0920033529f, 0.0768919066f},
-std::array<float,2>{0.546963036f, 0.0432223491f},
-std::array<float,2>{0.372041494f, 0.75454849f},
-std::array<float,2>{0.777386785f, 0.563618004f},
-std::array<float,2>{0.188824251f, 0.374004096f},
-std::array<float,2>{0.940823555f, 0.475245535f},
-std::array<float,2>{0.0403208174f, 0.63195467f},
-std::array<float,2>{0.665336907f, 0.915057898f},
-std::array<float,2>{0.495206624f, 0.163315669f},
-std::array<float,2>{0.75979805f, 0.0283067115f},
-std::array<float,2>{0.21604073f, 0.800387144f},
-std::array<float,2>{0.540557325f, 0.603885412f},
-std::array<float,2>{0.346880436f, 0.312921196f},
-std::array<float,2>{0.678585291f, 0.458619595f},
-std::array<float,2>{0.482837021f, 0.670626402f},
-std::array<float,2>{0.963709593f, 0.876658261f},
-std::array<float,2>{0.0563784391f, 0.134956717f},
-std::array<float,2>{0.586092412f, 0.214054883f},
-std::array<float,2>{0.258713067f, 0.974530101f},
-std::array<float,2>{0.848722517f, 0.719455898f},
-std::array<float,2>{0.147889659f, 0.403123498f},
-std::array<float,2>{0.894817889f, 0.297734708f},
-std::array<float,2>{0.0741677284f, 0.551517248f},
-std::array<float,2>{0.709947944f, 0.845968544f},
-std::array<float,2>{0.432449967f, 0.110936247f},
-std::array<float,2>{0.989256978f, 0.186897159f},
-std::array<float,2>{0.0230553877f, 0.93351227f},
-std::array<float,2>{0.642901897f, 0.65522629f},
-std::array<float,2>{0.452062726f, 0.493065149f},
-std::array<float,2>{0.527219534f, 0.356811374f},
-std::array<float,2>{0.342103571f, 0.579283178f},
-std::array<float,2>{0.810709119f, 0.780799031f},
-std::array<float,2>{0.23057206f, 0.0484968014f},
-std::array<float,2>{0.741690457f, 0.0829902515f},
-std::array<float,2>{0.378552049f, 0.815038979f},
-std::array<float,2>{0.93027705f, 0.529813707f},
-std::array<float,2>{0.117345065f, 0.259188324f},
-std::array<float,2>{0.835421562f, 0.433603078f},
-std::array<float,2>{0.160899192f, 0.710419059f},
-std::array<float,2>{0.619846165f, 0.956107318f},
-std::array<float,2>{0.287308127f, 0.226262018f},
-std::array<float,2>{0.942545176f, 0.124787502f},
-std::array<float,2>{0.0466400161f, 0.852360547f},
-std::array<float,2>{0.670625985f, 0.555255353f},
-std::array<float,2>{0.496435612f, 0.31172809f},
-std::array<float,2>{0.551270247f, 0.395893157f},
-std::array<float,2>{0.370166719f, 0.730488956f},
-std::array<float,2>{0.774084806f, 0.978856385f},
-std::array<float,2>{0.191675052f, 0.205331534f},
-std::array<float,2>{0.690899789f, 0.129871666f},
-std::array<float,2>{0.415383309f, 0.883629978f},
-std::array<float,2>{0.883171856f, 0.657425106f},
-std::array<float,2>{0.0862143859f, 0.461994618f},
-std::array<float,2>{0.872926712f, 0.324810296f},
-std::array<float,2>{0.131778419f, 0.600714803f},
-std::array<float,2>{0.567624986f, 0.809278071f},
-std::array<float,2>{0.272320151f, 0.0158908349f},
-std::array<float,2>{0.784879327f, 0.233555615f},
-std::array<float,2>{0.238836572f, 0.967360795f},
-std::array<float,2>{0.509322762f, 0.712188363f},
-std::array<float,2>{0.320108533f, 0.421880394f},
-std::array<float,2>{0.633595467f, 0.250854611f},
-std::array<float,2>{0.464163005f, 0.518007457f},
-std::array<float,2>{0.979976237f, 0.824403346f},
-std::array<float,2>{0.0145165157f, 0.0878878832f},
-std::array<float,2>{0.606347144f, 0.0593344308f},
-std::array<float,2>{0.299757659f, 0.773233593f},
-std::array<float,2>{0.818242788f, 0.590143144f},
-std::array<float,2>{0.178892761f, 0.347219974f},
-std::array<float,2>{0.918658733f, 0.491350114f},
-std::array<float,2>{0.109126218f, 0.644468844f},
-std::array<float,2>{0.72970134f, 0.928648233f},
-std::array<float,2>{0.402581245f, 0.178547338f},
-std::array<float,2>{0.829832494f, 0.0127973408f},
-std::array<float,2>{0.158459827f, 0.791524947f},
-std::array<float,2>{0.623353601f, 0.617494166f},
-std::array<float,2>{0.284488767f, 0.331335187f},
-std::array<float,2>{0.736759424f, 0.439522356f},
-std::array<float,2>{0.381422967f, 0.674350441f},
-std::array<float,2>{0.934506297f, 0.895591915f},
-std::array<float,2>{0.123365648f, 0.149115935f},
-std::array<float,2>{0.528616607f, 0.200649396f},
-std::array<float,2>{0.336718261f, 0.996926665f},
-std::array<float,2>{0.807891905f, 0.749848366f},
-std::array<float,2>{0.229124904f, 0.378914952f},
-std::array<float,2>{0.984627724f, 0.286142409f},
-std::array<float,2>{0.0166624375f, 0.541463673f},
-std::array<float,2>{0.648252726f, 0.870155931f},
-std::array<float,2>{0.448486567f, 0.0960593894f},
-std::array<float,2>{0.890894175f, 0.166100442f},
-std::array<float,2>{0.0746124014f, 0.909982979f},
-std::array<float,2>{0.704267681f, 0.633714437f},
-std::array<float,2>{0.434074491f, 0.481173187f},
-std::array<float,2>{0.590838909f, 0.362852365f},
-std::array<float,2>{0.265385687f, 0.574314237f},
-std::array<float,2>{0.846146524f, 0.76024121f},
-std::array<float,2>{0.143453181f, 0.0334118344f},
-std::array<float,2>{0.674948037f, 0.0687519759f},
-std::array<float,2>{0.47887072f, 0.834107518f},
-std::array<float,2>{0.968292892f, 0.505717158f},
-std::array<float,2>{0.0599889643f, 0.272462219f},
-std::array<float,2>{0.764084876f, 0.409748763f},
-std::array<float,2>{0.211351737f, 0.688495398f},
-std::array<float,2>{0.543246269f, 0.944881976f},
-std::array<float,2>{0.350803524f, 0.23582831f},
-std::array<float,2>{0.928687453f, 0.0395357497f},
-std::array<float,2>{0.113123819f, 0.751352787f},
-std::array<float,2>{0.744119287f, 0.56931603f},
-std::array<float,2>{0.38727054f, 0.369046032f},
-std::array<float,2>{0.615863919f, 0.470372021f},
-std::array<float,2>{0.296477437f, 0.625296116f},
-std::array<float,2>{0.836752653f, 0.919673085f},
-std::array<float,2>{0.164783999f, 0.158631608f},
-std::array<float,2>{0.653707802f, 0.247990564f},
-std::array<float,2>{0.438527942f, 0.949010789f},
-std::array<float,2>{0.993462741f, 0.695822358f},
-std::array<float,2>{0.0246516522f, 0.41899088f},
-std::array<float,2>{0.797231257f, 0.273851782f},
-std::array<float,2>{0.224076286f, 0.510898054f},
-std::array<float,2>{0.52136147f, 0.840332925f},
-std::array<float,2>{0.334506214f, 0.0703673214f},
-std::array<float,2>{0.858494878f, 0.145968303f},
-std::array<float,2>{0.152027249f, 0.899337173f},
-std::array<float,2>{0.58130002f, 0.681880295f},
-std::array<float,2>{0.255422264f, 0.450951129f},
-std::array<float,2>{0.713403225f, 0.341540396f},
-std::array<float,2>{0.426291853f, 0.612084329f},
-std::array<float,2>{0.89963001f, 0.787986398f},
-std::array<float,2>{0.0655619204f, 0.00608019065f},
-std::array<float,2>{0.537831426f, 0.103812478f},
-std::array<float,2>{0.356220007f, 0.860599101f},
-std::array<float,2>{0.756608129f, 0.535610199f},
-std::array<float,2>{0.209365189f, 0.289167851f},
-std::array<float,2>{0.954693317f, 0.388830841f},
-std::array<float,2>{0.0510280877f, 0.736993551f},
-std::array<float,2>{0.680258334f, 0.988818705f},
-std::array<float,2>{0.476341814f, 0.192587674f},
-std::array<float,2>{0.766689301f, 0.0791645646f},
-std::array<float,2>{0.201859951f, 0.816444457f},
-std::array<float,2>{0.562341034f, 0.527067542f},
-std::array<float,2>{0.361708611f, 0.262094468f},
-std::array<float,2>{0.661485791f, 0.430502802f},
-std::array<float,2>{0.487016529f, 0.704436481f},
-std::array<float,2>{0.948994458f, 0.958549857f},
-std::array<float,2>{0.0332585052f, 0.220151886f},
-std::array<float,2>{0.575041115f, 0.179966584f},
-std::array<float,2>{0.275656968f, 0.935194075f},
-std::array<float,2>{0.866079688f, 0.648569763f},
-std::array<float,2>{0.133476615f, 0.497393012f},
-std::array<float,2>{0.881869435f, 0.353805393f},
-std::array<float,2>{0.0842041969f, 0.582882166f},
-std::array<float,2>{0.695334017f, 0.776465774f},
-std::array<float,2>{0.413858622f, 0.0523994155f},
-std::array<float,2>{0.97144115f, 0.216777921f},
-std::array<float,2>{0.000643836102f, 0.972302675f},
-std::array<float,2>{0.629520357f, 0.726213396f},
-std::array<float,2>{0.454946846f, 0.40018034f},
-std::array<float,2>{0.506478786f, 0.301297188f},
-std::array<float,2>{0.325604409f, 0.54710716f},
-std::array<float,2>{0.79668653f, 0.848107338f},
-std::array<float,2>{0.245740622f, 0.11515262f},
-std::array<float,2>{0.724997997f, 0.0257785916f},
-std::array<float,2>{0.391195595f, 0.801754653f},
-std::array<float,2>{0.913093448f, 0.607342124f},
-std::array<float,2>{0.0995671749f, 0.318628013f},
-std::array<float,2>{0.82704699f, 0.453512639f},
-std::array<float,2>{0.180580616f, 0.664519668f},
-std::array<float,2>{0.59887737f, 0.879408777f},
-std::array<float,2>{0.309531063f, 0.140114188f},
-std::array<float,2>{0.996831f, 0.0214009043f},
-std::array<float,2>{0.0295865554f, 0.806865394f},
-std::array<float,2>{0.649997234f, 0.595038533f},
-std::array<float,2>{0.442044914f, 0.321562737f},
-std::array<float,2>{0.515712619f, 0.465198815f},
-std::array<float,2>{0.331883699f, 0.6609025f},
-std::array<float,2>{0.803881109f, 0.887446761f},
-std::array<float,2>{0.222368494f, 0.126060948f},
-std::array<float,2>{0.746847689f, 0.209361136f},
-std::array<float,2>{0.384177864f, 0.980945647f},
-std::array<float,2>{0.922551572f, 0.727977753f},
-std::array<float,2>{0.113977417f, 0.394435316f},
-std::array<float,2>{0.840092778f, 0.305662781f},
-std::array<float,2>{0.168350533f, 0.562185526f},
-std::array<float,2>{0.609971464f, 0.855630994f},
-std::array<float,2>{0.292760372f, 0.119023904f},
-std::array<float,2>{0.750302911f, 0.174991384f},
-std::array<float,2>{0.206579417f, 0.922487915f},
-std::array<float,2>{0.534176767f, 0.646569729f},
-std::array<float,2>{0.351587474f, 0.485029995f},
-std::array<float,2>{0.686577439f, 0.351165473f},
-std::array<float,2>{0.469227254f, 0.586382926f},
-std::array<float,2>{0.958554685f, 0.768630862f},
-std::array<float,2>{0.0500131138f, 0.0557743721f},
-std::array<float,2>{0.584834158f, 0.0922601894f},
-std::array<float,2>{0.251240224f, 0.822183609f},
-std::array<float,2>{0.851662517f, 0.521321416f},
-std::array<float,2>{0.153688416f, 0.257331938f},
-std::array<float,2>{0.905817568f, 0.428373516f},
-std::array<float,2>{0.067150712f, 0.714857936f},
-std::array<float,2>{0.715626061f, 0.961330652f},
-std::array<float,2>{0.422328442f, 0.229927167f},
-std::array<float,2>{0.862417042f, 0.100561686f},
-std::array<float,2>{0.137286097f, 0.871270716f},
-std::array<float,2>{0.573850334f, 0.54673183f},
-std::array<float,2>{0.279187053f, 0.282247573f},
-std::array<float,2>{0.701373994f, 0.375111699f},
-std::array<float,2>{0.40975076f, 0.744302869f},
-std::array<float,2>{0.876662552f, 0.994978666f},
-std::array<float,2>{0.0818613842f, 0.197468102f},
-std::array<float,2>{0.558007658f, 0.155220687f},
-std::array<float,2>{0.36579448f, 0.891390741f},
-std::array<float,2>{0.771974027f, 0.677028f},
-std::array<float,2>{0.19641985f, 0.442922354f},
-std::array<float,2>{0.952468455f, 0.335814625f},
-std::array<float,2>{0.0386868343f, 0.624312818f},
-std::array<float,2>{0.659310937f, 0.794139802f},
-std::array<float,2>{0.488805443f, 0.0115765585f},
-std::array<float,2>{0.907325208f, 0.238826007f},
-std::array<float,2>{0.0966169015f, 0.938578248f},
-std::array<float,2>{0.720218182f, 0.694713414f},
-std::array<float,2>{0.397190481f, 0.410711855f},
-std::array<float,2>{0.59762609f, 0.266213536f},
-std::array<float,2>{0.306232691f, 0.500436842f},
-std::array<float,2>{0.820744753f, 0.831222415f},
-std::array<float,2>{0.184865847f, 0.0653809682f},
-std::array<float,2>{0.625966191f, 0.0363186672f},
-std::array<float,2>{0.46055311f, 0.762104034f},
-std::array<float,2>{0.975746691f, 0.572165251f},
-std::array<float,2>{0.00531908078f, 0.364822954f},
-std::array<float,2>{0.78999418f, 0.478049487f},
-std::array<float,2>{0.248491183f, 0.6394943f},
-std::array<float,2>{0.500234485f, 0.911860108f},
-std::array<float,2>{0.320875108f, 0.168810263f},
-std::array<float,2>{0.889850676f, 0.0747237802f},
-std::array<float,2>{0.0901095569f, 0.837936401f},
-std::array<float,2>{0.691858113f, 0.515107274f},
-std::array<float,2>{0.420766264f, 0.281068146f},
-std::array<float,2>{0.562503338f, 0.417446136f},
-std::array<float,2>{0.2666879f, 0.70165509f},
-std::array<float,2>{0.867295742f, 0.949737549f},
-std::array<float,2>{0.128208563f, 0.246042445f},
-std::array<float,2>{0.66612488f, 0.160380512f},
-std::array<float,2>{0.492809772f, 0.917277336f},
-std::array<float,2>{0.938827932f, 0.630770862f},
-std::array<float,2>{0.042430684f, 0.473660439f},
-std::array<float,2>{0.779830277f, 0.372140765f},
-std::array<float,2>{0.191320136f, 0.565648139f},
-std::array<float,2>{0.54984349f, 0.756163239f},
-std::array<float,2>{0.374031723f, 0.0462101437f},
-std::array<float,2>{0.816207349f, 0.190647915f},
-std::array<float,2>{0.17278178f, 0.987440348f},
-std::array<float,2>{0.605282128f, 0.738698721f},
-std::array<float,2>{0.303200215f, 0.383915752f},
-std::array<float,2>{0.732980847f, 0.294383526f},
-std::array<float,2>{0.400082409f, 0.534778714f},
-std::array<float,2>{0.914730728f, 0.863891125f},
-std::array<float,2>{0.105316505f, 0.105577596f},
-std::array<float,2>{0.513885856f, 0.000619289f},
-std::array<float,2>{0.313354433f, 0.782449603f},
-std::array<float,2>{0.787536502f, 0.617108285f},
-std::array<float,2>{0.235844538f, 0.337637901f},
-std::array<float,2>{0.981746078f, 0.447294772f},
-std::array<float,2>{0.00795943663f, 0.686390221f},
-std::array<float,2>{0.640423596f, 0.906243384f},
-std::array<float,2>{0.46828714f, 0.142771244f},
-std::array<float,2>{0.809108973f, 0.0506636836f},
-std::array<float,2>{0.233770996f, 0.777824104f},
-std::array<float,2>{0.525381207f, 0.581269741f},
-std::array<float,2>{0.340179801f, 0.357605547f},
-std::array<float,2>{0.641755998f, 0.495483786f},
-std::array<float,2>{0.449235111f, 0.652948737f},
-std::array<float,2>{0.990771294f, 0.930522144f},
-std::array<float,2>{0.0209813248f, 0.185413748f},
-std::array<float,2>{0.61819762f, 0.22381565f},
-std::array<float,2>{0.287064373f, 0.954555869f},
-std::array<float,2>{0.833118558f, 0.708229005f},
-std::array<float,2>{0.162272558f, 0.43647176f},
-std::array<float,2>{0.931711614f, 0.26020059f},
-std::array<float,2>{0.120448306f, 0.528790414f},
-std::array<float,2>{0.738976181f, 0.814225733f},
-std::array<float,2>{0.376654088f, 0.0850130469f},
-std::array<float,2>{0.961193621f, 0.134404421f},
-std::array<float,2>{0.0571111701f, 0.877732396f},
-std::array<float,2>{0.675855696f, 0.668076158f},
-std::array<float,2>{0.48232311f, 0.460920691f},
-std::array<float,2>{0.542685866f, 0.316002965f},
-std::array<float,2>{0.343872875f, 0.601725578f},
-std::array<float,2>{0.758689523f, 0.797627151f},
-std::array<float,2>{0.216961414f, 0.03073203f},
-std::array<float,2>{0.708173335f, 0.111446373f},
-std::array<float,2>{0.430978149f, 0.844116986f},
-std::array<float,2>{0.897519708f, 0.553356707f},
-std::array<float,2>{0.0713979751f, 0.299377531f},
-std::array<float,2>{0.850389719f, 0.404890329f},
-std::array<float,2>{0.146427006f, 0.721238494f},
-std::array<float,2>{0.589534223f, 0.974730074f},
-std::array<float,2>{0.260721952f, 0.21109581f},
-std::array<float,2>{0.982709467f, 0.107299365f},
-std::array<float,2>{0.0105806896f, 0.864916086f},
-std::array<float,2>{0.636877596f, 0.533668578f},
-std::array<float,2>{0.466525733f, 0.293736696f},
-std::array<float,2>{0.512234926f, 0.38299796f},
-std::array<float,2>{0.314928889f, 0.740074158f},
-std::array<float,2>{0.785491645f, 0.986575186f},
-std::array<float,2>{0.236764774f, 0.189766794f},
-std::array<float,2>{0.73148632f, 0.14373979f},
-std::array<float,2>{0.402066678f, 0.904992044f},
-std::array<float,2>{0.917051971f, 0.68743974f},
-std::array<float,2>{0.102164991f, 0.448528916f},
-std::array<float,2>{0.813824832f, 0.336637586f},
-std::array<float,2>{0.175220609f, 0.615837038f},
-std::array<float,2>{0.601813495f, 0.782137215f},
-std::array<float,2>{0.302537382f, 0.00141922175f},
-std::array<float,2>{0.777602971f, 0.245028377f},
-std::array<float,2>{0.188703999f, 0.950460792f},
-std::array<float,2>{0.547142029f, 0.702981114f},
-std::array<float,2>{0.371707499f, 0.416609079f},
-std::array<float,2>{0.665270448f, 0.279445678f},
-std::array<float,2>{0.495423943f, 0.514207661f},
-std::array<float,2>{0.940508604f, 0.83930397f},
-std::array<float,2>{0.0400483981f, 0.0759635195f},
-std::array<float,2>{0.564753115f, 0.045207493f},
-std::array<float,2>{0.268035531f, 0.757211983f},
-std::array<float,2>{0.870554328f, 0.565225482f},
-std::array<float,2>{0.125318632f, 0.371829718f},
-std::array<float,2>{0.887808323f, 0.472670019f},
-std::array<float,2>{0.0921267048f, 0.629404008f},
-std::array<float,2>{0.693465829f, 0.916956365f},
-std::array<float,2>{0.419125587f, 0.161843628f},
-std::array<float,2>{0.848934352f, 0.0301307347f},
-std::array<float,2>{0.147489101f, 0.798787832f},
-std::array<float,2>{0.586216509f, 0.603212953f},
-std::array<float,2>{0.258331925f, 0.314875096f},
-std::array<float,2>{0.709567785f, 0.459653258f},
-std::array<float,2>{0.432272613f, 0.669562221f},
-std::array<float,2>{0.894571662f, 0.878008306f},
-std::array<float,2>{0.073906824f, 0.132996812f},
-std::array<float,2>{0.540849805f, 0.212856233f},
-std::array<float,2>{0.347138822f, 0.975987554f},
-std::array<float,2>{0.760238469f, 0.722032785f},
-std::array<float,2>{0.216219604f, 0.405705303f},
-std::array<float,2>{0.96343267f, 0.299815893f},
-std::array<float,2>{0.0566052534f, 0.553748131f},
-std::array<float,2>{0.678251088f, 0.845208764f},
-std::array<float,2>{0.482497334f, 0.112332813f},
-std::array<float,2>{0.930614471f, 0.184129342f},
-std::array<float,2>{0.117457055f, 0.931481361f},
-std::array<float,2>{0.741390467f, 0.653645098f},
-std::array<float,2>{0.378903836f, 0.494278789f},
-std::array<float,2>{0.620097876f, 0.35895893f},
-std::array<float,2>{0.287550151f, 0.580469608f},
-std::array<float,2>{0.835035086f, 0.779230833f},
-std::array<float,2>{0.16080609f, 0.0490831882f},
-std::array<float,2>{0.642657399f, 0.0842939615f},
-std::array<float,2>{0.451837152f, 0.812676728f},
-std::array<float,2>{0.988991201f, 0.528025091f},
-std::array<float,2>{0.0232874528f, 0.261093438f},
-std::array<float,2>{0.810873449f, 0.437273711f},
-std::array<float,2>{0.230888665f, 0.707899451f},
-std::array<float,2>{0.527007878f, 0.953328609f},
-std::array<float,2>{0.341843724f, 0.222660437f},
-std::array<float,2>{0.90385592f, 0.0553676747f},
-std::array<float,2>{0.0685755089f, 0.768252671f},
-std::array<float,2>{0.718364537f, 0.587033987f},
-std::array<float,2>{0.424993664f, 0.34981373f},
-std::array<float,2>{0.583540618f, 0.48603189f},
-std::array<float,2>{0.253173709f, 0.647493839f},
-std::array<float,2>{0.853628576f, 0.923542976f},
-std::array<float,2>{0.155095384f, 0.174416557f},
-std::array<float,2>{0.684471011f, 0.229424402f},
-std::array<float,2>{0.472054362f, 0.962487042f},
-std::array<float,2>{0.959453881f, 0.71671772f},
-std::array<float,2>{0.0478071719f, 0.429393977f},
-std::array<float,2>{0.753127456f, 0.25637424f},
-std::array<float,2>{0.203963727f, 0.520108521f},
-std::array<float,2>{0.531899154f, 0.821049511f},
-std::array<float,2>{0.355169654f, 0.093189016f},
-std::array<float,2>{0.843319356f, 0.125968054f},
-std::array<float,2>{0.17174536f, 0.888302386f},
-std::array<float,2>{0.611792743f, 0.661401927f},
-std::array<float,2>{0.289855361f, 0.465960056f},
-std::array<float,2>{0.748376906f, 0.320833296f},
-std::array<float,2>{0.38536793f, 0.594275832f},
-std::array<float,2>{0.924927294f, 0.807884157f},
-std::array<float,2>{0.11551737f, 0.0195954759f},
-std::array<float,2>{0.517629564f, 0.117645562f},
-std::array<float,2>{0.32907787f, 0.856719971f},
-std::array<float,2>{0.801320016f, 0.561086953f},
-std::array<float,2>{0.220360354f, 0.305827856f},
-std::array<float,2>{0.999917567f, 0.392708033f},
-std::array<float,2>{0.0291564111f, 0.727282822f},
-std::array<float,2>{0.65068686f, 0.981462359f},
-std::array<float,2>{0.443827599f, 0.210184842f},
-std::array<float,2>{0.792858779f, 0.0660576522f},
-std::array<float,2>{0.246368855f, 0.830422699f},
-std::array<float,2>{0.50331229f, 0.501765072f},
-std::array<float,2>{0.32360658f, 0.267236263f},
-std::array<float,2>{0.628012955f, 0.411338627f},
-std::array<float,2>{0.457698375f, 0.693848073f},
-std::array<float,2>{0.972805798f, 0.938464105f},
-std::array<float,2>{0.00723628188f, 0.239980444f},
-std::array<float,2>{0.595195293f, 0.169426069f},
-std::array<float,2>{0.308140278f, 0.910493791f},
-std::array<float,2>{0.822303832f, 0.640032113f},
-std::array<float,2>{0.185711786f, 0.477223843f},
-std::array<float,2>{0.908304989f, 0.363570988f},
-std::array<float,2>{0.0939827561f, 0.570400417f},
-std::array<float,2>{0.720877469f, 0.763574541f},
-std::array<float,2>{0.395786315f, 0.0351982899f},
-std::array<float,2>{0.949810088f, 0.199059919f},
-std::array<float,2>{0.036476884f, 0.995691538f},
-std::array<float,2>{0.657490551f, 0.745236337f},
-std::array<float,2>{0.491511673f, 0.37692377f},
-std::array<float,2>{0.556354582f, 0.28200376f},
-std::array<float,2>{0.36346218f, 0.545243561f},
-std::array<float,2>{0.769756913f, 0.872231662f},
-std::array<float,2>{0.197863564f, 0.100983582f},
-std::array<float,2>{0.700318635f, 0.010034658f},
-std::array<float,2>{0.408012807f, 0.793646753f},
-std::array<float,2>{0.877158523f, 0.623252213f},
-std::array<float,2>{0.0794162899f, 0.334025949f},
-std::array<float,2>{0.859646142f, 0.441925049f},
-std::array<float,2>{0.140178263f, 0.67664516f},
-std::array<float,2>{0.571354926f, 0.892015219f},
-std::array<float,2>{0.279994965f, 0.155864298f},
-std::array<float,2>{0.956615031f, 0.0077544814f},
-std::array<float,2>{0.0543509051f, 0.788299799f},
-std::array<float,2>{0.683194637f, 0.612634599f},
-std::array<float,2>{0.473457783f, 0.340472788f},
-std::array<float,2>{0.536598325f, 0.449305117f},
-std::array<float,2>{0.357602239f, 0.683299422f},
-std::array<float,2>{0.755439103f, 0.899695635f},
-std::array<float,2>{0.208170801f, 0.145222172f},
-std::array<float,2>{0.712617934f, 0.191763148f},
-std::array<float,2>{0.428338498f, 0.989722133f},
-std::array<float,2>{0.901116014f, 0.737399161f},
-std::array<float,2>{0.0644254088f, 0.389800698f},
-std::array<float,2>{0.856089592f, 0.290519714f},
-std::array<float,2>{0.149324432f, 0.536468685f},
-std::array<float,2>{0.579979837f, 0.860108316f},
-std::array<float,2>{0.257712543f, 0.105454065f},
-std::array<float,2>{0.799990475f, 0.159899727f},
-std::array<float,2>{0.224936217f, 0.918037355f},
-std::array<float,2>{0.522361219f, 0.62631315f},
-std::array<float,2>{0.332458973f, 0.469408274f},
-std::array<float,2>{0.655297339f, 0.367682755f},
-std::array<float,2>{0.441206068f, 0.569969118f},
-std::array<float,2>{0.995583594f, 0.750808775f},
-std::array<float,2>{0.0272598099f, 0.0406095721f},
-std::array<float,2>{0.614807248f, 0.0713614896f},
-std::array<float,2>{0.294206679f, 0.841707349f},
-std::array<float,2>{0.839398265f, 0.51017195f},
-std::array<float,2>{0.166220829f, 0.274990112f},
-std::array<float,2>{0.925803542f, 0.418288887f},
-std::array<float,2>{0.111250617f, 0.696425319f},
-std::array<float,2>{0.745487928f, 0.948157907f},
-std::array<float,2>{0.388959646f, 0.246333748f},
-std::array<float,2>{0.824818075f, 0.114134729f},
-std::array<float,2>{0.18301712f, 0.849608362f},
-std::array<float,2>{0.601255774f, 0.547910333f},
-std::array<float,2>{0.311729491f, 0.302618146f},
-std::array<float,2>{0.724281073f, 0.399302274f},
-std::array<float,2>{0.393343061f, 0.724785566f},
-std::array<float,2>{0.911299944f, 0.971536517f},
-std::array<float,2>{0.100706398f, 0.214899361f},
-std::array<float,2>{0.505674899f, 0.13897258f},
-std::array<float,2>{0.326959133f, 0.880596757f},
-std::array<float,2>{0.793612421f, 0.666012824f},
-std::array<float,2>{0.242447391f, 0.454410553f},
-std::array<float,2>{0.970065176f, 0.319439113f},
-std::array<float,2>{0.00271554803f, 0.605770707f},
-std::array<float,2>{0.631242037f, 0.802714229f},
-std::array<float,2>{0.455854058f, 0.0264228173f},
-std::array<float,2>{0.879739106f, 0.219636694f},
-std::array<float,2>{0.082789138f, 0.957335353f},
-std::array<float,2>{0.697291613f, 0.70340389f},
-std::array<float,2>{0.411381572f, 0.431517959f},
-std::array<float,2>{0.577500582f, 0.263555318f},
-std::array<float,2>{0.274177879f, 0.525908291f},
-std::array<float,2>{0.864464879f, 0.817595184f},
-std::array<float,2>{0.136497304f, 0.0789002553f},
-std::array<float,2>{0.662219524f, 0.051333148f},
-std::array<float,2>{0.484437346f, 0.775565267f},
-std::array<float,2>{0.947013676f, 0.583122134f},
-std::array<float,2>{0.032510411f, 0.355372012f},
-std::array<float,2>{0.768900931f, 0.496885985f},
-std::array<float,2>{0.200355038f, 0.649440885f},
-std::array<float,2>{0.558951199f, 0.934476733f},
-std::array<float,2>{0.360031933f, 0.181170866f},
-std::array<float,2>{0.921094894f, 0.0861178413f},
-std::array<float,2>{0.107278608f, 0.825662792f},
-std::array<float,2>{0.727281272f, 0.518678665f},
-std::array<float,2>{0.405942827f, 0.251019359f},
-std::array<float,2>{0.608850956f, 0.422864646f},
-std::array<float,2>{0.297265798f, 0.711749732f},
-std::array<float,2>{0.820207238f, 0.967999697f},
-std::array<float,2>{0.177184507f, 0.23315993f},
-std::array<float,2>{0.635651648f, 0.178824782f},
-std::array<float,2>{0.462326616f, 0.929231584f},
-std::array<float,2>{0.97776866f, 0.643459618f},
-std::array<float,2>{0.0132678775f, 0.490684867f},
-std::array<float,2>{0.781361759f, 0.346048117f},
-std::array<float,2>{0.241112798f, 0.591289878f},
-std::array<float,2>{0.510310948f, 0.772366941f},
-std::array<float,2>{0.317763984f, 0.0600849763f},
-std::array<float,2>{0.874546766f, 0.206245944f},
-std::array<float,2>{0.13049823f, 0.980448723f},
-std::array<float,2>{0.568717718f, 0.731614709f},
-std::array<float,2>{0.269673795f, 0.395242453f},
-std::array<float,2>{0.688598812f, 0.31110236f},
-std::array<float,2>{0.417648643f, 0.556174994f},
-std::array<float,2>{0.886581421f, 0.853479147f},
-std::array<float,2>{0.088744536f, 0.123518102f},
-std::array<float,2>{0.554168761f, 0.0166033246f},
-std::array<float,2>{0.367347181f, 0.809578359f},
-std::array<float,2>{0.776642025f, 0.600149214f},
-std::array<float,2>{0.194560871f, 0.325613886f},
-std::array<float,2>{0.944171548f, 0.461328715f},
-std::array<float,2>{0.0430621281f, 0.656254053f},
-std::array<float,2>{0.668388665f, 0.883795202f},
-std::array<float,2>{0.499762356f, 0.130198061f},
-std::array<float,2>{0.762958288f, 0.0347809345f},
-std::array<float,2>{0.213300586f, 0.761711657f},
-std::array<float,2>{0.546073794f, 0.576042652f},
-std::array<float,2>{0.348143071f, 0.361682206f},
-std::array<float,2>{0.673066735f, 0.481452405f},
-std::array<float,2>{0.477432936f, 0.634089649f},
-std::array<float,2>{0.96517837f, 0.908723593f},
-std::array<float,2>{0.0621890947f, 0.167658806f},
-std::array<float,2>{0.59360379f, 0.234984711f},
-std::array<float,2>{0.261863768f, 0.943866968f},
-std::array<float,2>{0.844532549f, 0.688097775f},
-std::array<float,2>{0.142543182f, 0.408230782f},
-std::array<float,2>{0.89417845f, 0.271648705f},
-std::array<float,2>{0.076959528f, 0.504481196f},
-std::array<float,2>{0.706044376f, 0.835213065f},
-std::array<float,2>{0.435618401f, 0.0698384866f},
-std::array<float,2>{0.988118589f, 0.14943181f},
-std::array<float,2>{0.0181687642f, 0.894874871f},
-std::array<float,2>{0.646059394f, 0.675660908f},
-std::array<float,2>{0.445545346f, 0.441022336f},
-std::array<float,2>{0.530833125f, 0.330189407f},
-std::array<float,2>{0.338325173f, 0.618438005f},
-std::array<float,2>{0.805067837f, 0.792774796f},
-std::array<float,2>{0.227501243f, 0.0125701306f},
-std::array<float,2>{0.73444736f, 0.0974327251f},
-std::array<float,2>{0.380773187f, 0.869144619f},
-std::array<float,2>{0.936298668f, 0.542564154f},
-std::array<float,2>{0.122285023f, 0.285535991f},
-std::array<float,2>{0.830389142f, 0.380025119f},
-std::array<float,2>{0.157713696f, 0.748634338f},
-std::array<float,2>{0.622509658f, 0.997635424f},
-std::array<float,2>{0.281766325f, 0.20013772f},
-std::array<float,2>{0.938506067f, 0.0773043409f},
-std::array<float,2>{0.0420051329f, 0.837455988f},
-std::array<float,2>{0.666261971f, 0.513286293f},
-std::array<float,2>{0.493100941f, 0.278432012f},
-std::array<float,2>{0.550246894f, 0.414459825f},
-std::array<float,2>{0.374318123f, 0.69974494f},
-std::array<float,2>{0.780030429f, 0.952630162f},
-std::array<float,2>{0.190922335f, 0.243714035f},
-std::array<float,2>{0.691497028f, 0.162487403f},
-std::array<float,2>{0.420431018f, 0.914877117f},
-std::array<float,2>{0.890089393f, 0.631705165f},
-std::array<float,2>{0.0899000168f, 0.475968152f},
-std::array<float,2>{0.867483735f, 0.374974161f},
-std::array<float,2>{0.128080755f, 0.563217521f},
-std::array<float,2>{0.562956989f, 0.75550127f},
-std::array<float,2>{0.266850471f, 0.0440946482f},
-std::array<float,2>{0.787343323f, 0.188400686f},
-std::array<float,2>{0.236190528f, 0.985481977f},
-std::array<float,2>{0.514157057f, 0.741591454f},
-std::array<float,2>{0.313213348f, 0.384848177f},
-std::array<float,2>{0.640318871f, 0.295755625f},
-std::array<float,2>{0.468575299f, 0.532485306f},
-std::array<float,2>{0.981481135f, 0.866219759f},
-std::array<float,2>{0.00821116939f, 0.108998835f},
-std::array<float,2>{0.605130494f, 0.00378743489f},
-std::array<float,2>{0.302834719f, 0.78417027f},
-std::array<float,2>{0.81593287f, 0.614000261f},
-std::array<float,2>{0.172393501f, 0.339004159f},
-std::array<float,2>{0.914800107f, 0.44534567f},
-std::array<float,2>{0.105178252f, 0.684367657f},
-std::array<float,2>{0.733181119f, 0.902586699f},
-std::array<float,2>{0.400203317f, 0.142419234f},
-std::array<float,2>{0.833485365f, 0.0473039597f},
-std::array<float,2>{0.162493378f, 0.779811859f},
-std::array<float,2>{0.618564248f, 0.578662038f},
-std::array<float,2>{0.286724389f, 0.355477393f},
-std::array<float,2>{0.739059448f, 0.493774384f},
-std::array<float,2>{0.376869589f, 0.655888319f},
-std::array<float,2>{0.932082415f, 0.931725025f},
-std::array<float,2>{0.12027707f, 0.186446145f},
-std::array<float,2>{0.52496618f, 0.225003004f},
-std::array<float,2>{0.339945972f, 0.955167532f},
-std::array<float,2>{0.809366763f, 0.709205568f},
-std::array<float,2>{0.233543336f, 0.435054451f},
-std::array<float,2>{0.990989923f, 0.257830322f},
-std::array<float,2>{0.0206437986f, 0.530406117f},
-std::array<float,2>{0.642085671f, 0.815743387f},
-std::array<float,2>{0.449570119f, 0.0830841735f},
-std::array<float,2>{0.897784829f, 0.136454925f},
-std::array<float,2>{0.071621418f, 0.87572974f},
-std::array<float,2>{0.708428741f, 0.671131849f},
-std::array<float,2>{0.430871606f, 0.457629234f},
-std::array<float,2>{0.589820862f, 0.314412236f},
-std::array<float,2>{0.26042971f, 0.604947269f},
-std::array<float,2>{0.850257456f, 0.798981786f},
-std::array<float,2>{0.146217987f, 0.0284656137f},
-std::array<float,2>{0.67606163f, 0.110343911f},
-std::array<float,2>{0.481972843f, 0.846898973f},
-std::array<float,2>{0.961110115f, 0.552722275f},
-std::array<float,2>{0.056756448f, 0.298009157f},
-std::array<float,2>{0.758450389f, 0.404242307f},
-std::array<float,2>{0.217177495f, 0.720225453f},
-std::array<float,2>{0.542924345f, 0.973161697f},
-std::array<float,2>{0.344027281f, 0.213239893f},
-std::array<float,2>{0.922673881f, 0.0219473224f},
-std::array<float,2>{0.114092864f, 0.806141019f},
-std::array<float,2>{0.746599793f, 0.597236156f},
-std::array<float,2>{0.383963853f, 0.322295338f},
-std::array<float,2>{0.610197544f, 0.466857135f},
-std::array<float,2>{0.292692602f, 0.66393435f},
-std::array<float,2>{0.839862227f, 0.889148831f},
-std::array<float,2>{0.168207988f, 0.127660677f},
-std::array<float,2>{0.650172591f, 0.207681417f},
-std::array<float,2>{0.442317754f, 0.98284173f},
-std::array<float,2>{0.996671379f, 0.730224311f},
-std::array<float,2>{0.0294480547f, 0.391383171f},
-std::array<float,2>{0.804178417f, 0.30805245f},
-std::array<float,2>{0.222644299f, 0.560173273f},
-std::array<float,2>{0.516004562f, 0.858463407f},
-std::array<float,2>{0.3317689f, 0.119874544f},
-std::array<float,2>{0.851906121f, 0.173494101f},
-std::array<float,2>{0.153502584f, 0.924982369f},
-std::array<float,2>{0.584475338f, 0.64568001f},
-std::array<float,2>{0.25098443f, 0.486994922f},
-std::array<float,2>{0.715410709f, 0.348567903f},
-std::array<float,2>{0.422039717f, 0.588995874f},
-std::array<float,2>{0.906036317f, 0.766258419f},
-std::array<float,2>{0.0671385229f, 0.05787782f},
-std::array<float,2>{0.533895552f, 0.0900485069f},
-std::array<float,2>{0.351853371f, 0.824014902f},
-std::array<float,2>{0.750172257f, 0.522527993f},
-std::array<float,2>{0.20698218f, 0.255777776f},
-std::array<float,2>{0.958744228f, 0.42594862f},
-std::array<float,2>{0.0501101762f, 0.718533695f},
-std::array<float,2>{0.686922729f, 0.964710116f},
-std::array<float,2>{0.468801379f, 0.226700932f},
-std::array<float,2>{0.772383332f, 0.0985044241f},
-std::array<float,2>{0.19666937f, 0.874448955f},
-std::array<float,2>{0.55778867f, 0.543687582f},
-std::array<float,2>{0.366058469f, 0.284272879f},
-std::array<float,2>{0.659548461f, 0.377800673f},
-std::array<float,2>{0.489065289f, 0.743409634f},
-std::array<float,2>{0.952373981f, 0.994001985f},
-std::array<float,2>{0.0389420316f, 0.195479915f},
-std::array<float,2>{0.574196398f, 0.153542146f},
-std::array<float,2>{0.278993785f, 0.894180059f},
-std::array<float,2>{0.8626526f, 0.677976549f},
-std::array<float,2>{0.137528062f, 0.44506526f},
-std::array<float,2>{0.876810014f, 0.332186401f},
-std::array<float,2>{0.0817274824f, 0.621634245f},
-std::array<float,2>{0.701565146f, 0.795742869f},
-std::array<float,2>{0.409984767f, 0.00827335753f},
-std::array<float,2>{0.975865602f, 0.241867468f},
-std::array<float,2>{0.00511918217f, 0.940092444f},
-std::array<float,2>{0.625527859f, 0.693288922f},
-std::array<float,2>{0.460784167f, 0.412884682f},
-std::array<float,2>{0.500298917f, 0.268974304f},
-std::array<float,2>{0.321169078f, 0.503539324f},
-std::array<float,2>{0.789551973f, 0.829003155f},
-std::array<float,2>{0.248128816f, 0.0640905797f},
-std::array<float,2>{0.720500112f, 0.0387947075f},
-std::array<float,2>{0.397269964f, 0.764387131f},
-std::array<float,2>{0.907473505f, 0.572639167f},
-std::array<float,2>{0.0963309258f, 0.366919875f},
-std::array<float,2>{0.820362449f, 0.480140924f},
-std::array<float,2>{0.184580564f, 0.637563765f},
-std::array<float,2>{0.597328126f, 0.913276196f},
-std::array<float,2>{0.306512386f, 0.171218112f},
-std::array<float,2>{0.993215442f, 0.0429080687f},
-std::array<float,2>{0.0247951467f, 0.752687275f},
-std::array<float,2>{0.653403938f, 0.567829669f},
-std::array<float,2>{0.438788474f, 0.370197505f},
-std::array<float,2>{0.521228373f, 0.471300811f},
-std::array<float,2>{0.33491534f, 0.628174245f},
-std::array<float,2>{0.796937287f, 0.921121299f},
-std::array<float,2>{0.223866329f, 0.157432258f},
-std::array<float,2>{0.743803322f, 0.249169141f},
-std::array<float,2>{0.387570828f, 0.946190715f},
-std::array<float,2>{0.928323388f, 0.697907746f},
-std::array<float,2>{0.112853236f, 0.420979619f},
-std::array<float,2>{0.83655256f, 0.276122272f},
-std::array<float,2>{0.16486752f, 0.508922935f},
-std::array<float,2>{0.616205513f, 0.842584968f},
-std::array<float,2>{0.296692729f, 0.0730827227f},
-std::array<float,2>{0.756415248f, 0.147604659f},
-std::array<float,2>{0.209130079f, 0.901302636f},
-std::array<float,2>{0.537887454f, 0.6797719f},
-std::array<float,2>{0.356035024f, 0.451847166f},
-std::array<float,2>{0.680639207f, 0.343310088f},
-std::array<float,2>{0.476092905f, 0.611262798f},
-std::array<float,2>{0.954966724f, 0.786242783f},
-std::array<float,2>{0.0508378297f, 0.0053412877f},
-std::array<float,2>{0.581222117f, 0.10239242f},
-std::array<float,2>{0.255788743f, 0.863085687f},
-std::array<float,2>{0.858755291f, 0.538912952f},
-std::array<float,2>{0.152249694f, 0.292565376f},
-std::array<float,2>{0.899730444f, 0.388447791f},
-std::array<float,2>{0.0658375993f, 0.73578918f},
-std::array<float,2>{0.7137779f, 0.991740644f},
-std::array<float,2>{0.426743209f, 0.194785371f},
-std::array<float,2>{0.865907967f, 0.0809406117f},
-std::array<float,2>{0.13355355f, 0.819423437f},
-std::array<float,2>{0.574798822f, 0.525354981f},
-std::array<float,2>{0.275475591f, 0.264591217f},
-std::array<float,2>{0.695578516f, 0.433544785f},
-std::array<float,2>{0.413796335f, 0.705192566f},
-std::array<float,2>{0.88214606f, 0.959059238f},
-std::array<float,2>{0.0842633098f, 0.220811427f},
-std::array<float,2>{0.56215322f, 0.183375373f},
-std::array<float,2>{0.361417592f, 0.936713994f},
-std::array<float,2>{0.767020762f, 0.652305841f},
-std::array<float,2>{0.201973855f, 0.498434991f},
-std::array<float,2>{0.948938072f, 0.352999747f},
-std::array<float,2>{0.0336344615f, 0.584234178f},
-std::array<float,2>{0.661348104f, 0.773698807f},
-std::array<float,2>{0.487191111f, 0.0542355217f},
-std::array<float,2>{0.913455844f, 0.21761933f},
-std::array<float,2>{0.0992067084f, 0.969540358f},
-std::array<float,2>{0.724721849f, 0.72361356f},
-std::array<float,2>{0.391407102f, 0.400956571f},
-std::array<float,2>{0.598794103f, 0.303476661f},
-std::array<float,2>{0.309282571f, 0.54921931f},
-std::array<float,2>{0.826888561f, 0.849731803f},
-std::array<float,2>{0.180236861f, 0.115802921f},
-std::array<float,2>{0.629703283f, 0.0250516366f},
-std::array<float,2>{0.454829276f, 0.803836346f},
-std::array<float,2>{0.97120893f, 0.607939184f},
-std::array<float,2>{0.00074596284f, 0.317553431f},
-std::array<float,2>{0.796443105f, 0.456594735f},
-std::array<float,2>{0.246012434f, 0.667753816f},
-std::array<float,2>{0.506629348f, 0.882154465f},
-std::array<float,2>{0.325387567f, 0.137185559f},
-std::array<float,2>{0.883020103f, 0.122446992f},
-std::array<float,2>{0.0860519037f, 0.85361433f},
-std::array<float,2>{0.690662146f, 0.557127178f},
-std::array<float,2>{0.415223897f, 0.309596568f},
-std::array<float,2>{0.567843974f, 0.396853119f},
-std::array<float,2>{0.272209197f, 0.733161986f},
-std::array<float,2>{0.872651398f, 0.977842748f},
-std::array<float,2>{0.131525904f, 0.204310238f},
-std::array<float,2>{0.670765579f, 0.132343948f},
-std::array<float,2>{0.496222615f, 0.885832787f},
-std::array<float,2>{0.94265157f, 0.659614146f},
-std::array<float,2>{0.0465989672f, 0.464563251f},
-std::array<float,2>{0.774284422f, 0.326988101f},
-std::array<float,2>{0.191462576f, 0.598387361f},
-std::array<float,2>{0.551545322f, 0.811427951f},
-std::array<float,2>{0.370479405f, 0.019325858f},
-std::array<float,2>{0.818089247f, 0.232188344f},
-std::array<float,2>{0.179168433f, 0.965226412f},
-std::array<float,2>{0.606147528f, 0.714595258f},
-std::array<float,2>{0.299534529f, 0.425634861f},
-std::array<float,2>{0.72974515f, 0.252246886f},
-std::array<float,2>{0.40276444f, 0.516553879f},
-std::array<float,2>{0.918719888f, 0.827941239f},
-std::array<float,2>{0.109287292f, 0.089748688f},
-std::array<float,2>{0.509610415f, 0.060716182f},
-std::array<float,2>{0.319942713f, 0.771237552f},
-std::array<float,2>{0.7849527f, 0.591898739f},
-std::array<float,2>{0.239017054f, 0.344289929f},
-std::array<float,2>{0.979499102f, 0.489556521f},
-std::array<float,2>{0.0142819462f, 0.642032385f},
-std::array<float,2>{0.63354063f, 0.926584363f},
-std::array<float,2>{0.463919103f, 0.176299468f},
-std::array<float,2>{0.807754517f, 0.0137722576f},
-std::array<float,2>{0.229264528f, 0.79080224f},
-std::array<float,2>{0.528410017f, 0.620102644f},
-std::array<float,2>{0.336569607f, 0.329512775f},
-std::array<float,2>{0.648137212f, 0.439276218f},
-std::array<float,2>{0.448400855f, 0.673666418f},
-std::array<float,2>{0.984558523f, 0.898010135f},
-std::array<float,2>{0.0169976894f, 0.151664644f},
-std::array<float,2>{0.623173833f, 0.201571941f},
-std::array<float,2>{0.284247249f, 0.998583853f},
-std::array<float,2>{0.829980433f, 0.747962892f},
-std::array<float,2>{0.158226699f, 0.38100031f},
-std::array<float,2>{0.934269905f, 0.288329214f},
-std::array<float,2>{0.123069711f, 0.540048003f},
-std::array<float,2>{0.736544132f, 0.86913842f},
-std::array<float,2>{0.381729364f, 0.094103694f},
-std::array<float,2>{0.968514502f, 0.165746883f},
-std::array<float,2>{0.0595999919f, 0.906410992f},
-std::array<float,2>{0.675286293f, 0.636567116f},
-std::array<float,2>{0.478615314f, 0.484306306f},
-std::array<float,2>{0.543105602f, 0.359600306f},
-std::array<float,2>{0.350986779f, 0.577480376f},
-std::array<float,2>{0.763740599f, 0.759106457f},
-std::array<float,2>{0.211056143f, 0.032878045f},
-std::array<float,2>{0.704548061f, 0.0673712268f},
-std::array<float,2>{0.433750004f, 0.833117366f},
-std::array<float,2>{0.8908149f, 0.506706953f},
-std::array<float,2>{0.0742286295f, 0.270747155f},
-std::array<float,2>{0.845858812f, 0.406529486f},
-std::array<float,2>{0.143233225f, 0.690424442f},
-std::array<float,2>{0.591285467f, 0.942692399f},
-std::array<float,2>{0.26526767f, 0.237751678f},
-std::array<float,2>{0.989342093f, 0.0824944898f},
-std::array<float,2>{0.0220968537f, 0.814716697f},
-std::array<float,2>{0.644305766f, 0.529725015f},
-std::array<float,2>{0.452619404f, 0.25931111f},
-std::array<float,2>{0.525710404f, 0.434273541f},
-std::array<float,2>{0.342890263f, 0.710620642f},
-std::array<float,2>{0.811814547f, 0.95693326f},
-std::array<float,2>{0.231868252f, 0.225666046f},
-std::array<float,2>{0.741193533f, 0.187146813f},
-std::array<float,2>{0.377743125f, 0.932749271f},
-std::array<float,2>{0.931610882f, 0.654673576f},
-std::array<float,2>{0.11892055f, 0.492407233f},
-std::array<float,2>{0.834598541f, 0.35714066f},
-std::array<float,2>{0.162088796f, 0.579932451f},
-std::array<float,2>{0.620714962f, 0.780611277f},
-std::array<float,2>{0.288533151f, 0.048112765f},
-std::array<float,2>{0.7609725f, 0.214466661f},
-std::array<float,2>{0.215394899f, 0.974083185f},
-std::array<float,2>{0.539363861f, 0.719206631f},
-std::array<float,2>{0.346281588f, 0.402696043f},
-std::array<float,2>{0.678756833f, 0.297242522f},
-std::array<float,2>{0.484174341f, 0.551217854f},
-std::array<float,2>{0.964211166f, 0.846591532f},
-std::array<float,2>{0.0555677675f, 0.110591888f},
-std::array<float,2>{0.587409079f, 0.027587181f},
-std::array<float,2>{0.259120822f, 0.800242722f},
-std::array<float,2>{0.848073423f, 0.604113579f},
-std::array<float,2>{0.146739215f, 0.313456178f},
-std::array<float,2>{0.895579875f, 0.458045572f},
-std::array<float,2>{0.0727558956f, 0.670126855f},
-std::array<float,2>{0.710372806f, 0.876406789f},
-std::array<float,2>{0.433168799f, 0.135659516f},
-std::array<float,2>{0.86960417f, 0.0437211208f},
-std::array<float,2>{0.126536295f, 0.754375398f},
-std::array<float,2>{0.565764189f, 0.564126372f},
-std::array<float,2>{0.269376487f, 0.373122722f},
-std::array<float,2>{0.694570482f, 0.474643588f},
-std::array<float,2>{0.418519139f, 0.632558823f},
-std::array<float,2>{0.887413204f, 0.915845215f},
-std::array<float,2>{0.093491219f, 0.16396983f},
-std::array<float,2>{0.54797399f, 0.242563084f},
-std::array<float,2>{0.37290284f, 0.951582611f},
-std::array<float,2>{0.779088497f, 0.700595438f},
-std::array<float,2>{0.18803665f, 0.41523394f},
-std::array<float,2>{0.939937413f, 0.278233021f},
-std::array<float,2>{0.0397401899f, 0.512437224f},
-std::array<float,2>{0.664628029f, 0.835989237f},
-std::array<float,2>{0.494627625f, 0.0764543042f},
-std::array<float,2>{0.916596413f, 0.141195223f},
-std::array<float,2>{0.102823183f, 0.903640926f},
-std::array<float,2>{0.731407285f, 0.684962928f},
-std::array<float,2>{0.401073247f, 0.446677893f},
-std::array<float,2>{0.602881074f, 0.338510036f},
-std::array<float,2>{0.301537693f, 0.614563942f},
-std::array<float,2>{0.812584281f, 0.784869671f},
-std::array<float,2>{0.173972011f, 0.0020213665f},
-std::array<float,2>{0.637815952f, 0.107680835f},
-std::array<float,2>{0.464934379f, 0.865364313f},
-std::array<float,2>{0.983990431f, 0.531376958f},
-std::array<float,2>{0.0111513287f, 0.296667516f},
-std::array<float,2>{0.786166966f, 0.386190027f},
-std::array<float,2>{0.237704366f, 0.740244687f},
-std::array<float,2>{0.513015747f, 0.985059321f},
-std::array<float,2>{0.316393495f, 0.18918258f},
-std::array<float,2>{0.87874794f, 0.00907102693f},
-std::array<float,2>{0.0785675198f, 0.796419263f},
-std::array<float,2>{0.699849248f, 0.622537911f},
-std::array<float,2>{0.406724602f, 0.333150774f},
-std::array<float,2>{0.570769787f, 0.444275141f},
-std::array<float,2>{0.281240284f, 0.679002523f},
-std::array<float,2>{0.861024201f, 0.893550158f},
-std::array<float,2>{0.139433324f, 0.153079942f},
-std::array<float,2>{0.657098711f, 0.197025657f},
-std::array<float,2>{0.490934998f, 0.992426336f},
-std::array<float,2>{0.950233757f, 0.742422938f},
-std::array<float,2>{0.0358398035f, 0.378184795f},
-std::array<float,2>{0.771381915f, 0.283690959f},
-std::array<float,2>{0.199130312f, 0.544447064f},
-std::array<float,2>{0.55493319f, 0.873939097f},
-std::array<float,2>{0.36459595f, 0.099444516f},
-std::array<float,2>{0.823296666f, 0.170272291f},
-std::array<float,2>{0.186931103f, 0.912117839f},
-std::array<float,2>{0.594291449f, 0.638224661f},
-std::array<float,2>{0.307312727f, 0.479475707f},
-std::array<float,2>{0.721789122f, 0.365475893f},
-std::array<float,2>{0.394962072f, 0.57401365f},
-std::array<float,2>{0.909774005f, 0.765553772f},
-std::array<float,2>{0.0951585695f, 0.0377645791f},
-std::array<float,2>{0.502664745f, 0.0633913502f},
-std::array<float,2>{0.322713196f, 0.829212725f},
-std::array<float,2>{0.79112488f, 0.502650499f},
-std::array<float,2>{0.247301832f, 0.268239766f},
-std::array<float,2>{0.974388957f, 0.413294941f},
-std::array<float,2>{0.00672952319f, 0.691519201f},
-std::array<float,2>{0.627578735f, 0.941253066f},
-std::array<float,2>{0.458695978f, 0.240870625f},
-std::array<float,2>{0.802083194f, 0.121038616f},
-std::array<float,2>{0.219308704f, 0.8581177f},
-std::array<float,2>{0.518686831f, 0.558931291f},
-std::array<float,2>{0.329556555f, 0.307288796f},
-std::array<float,2>{0.65181464f, 0.392118812f},
-std::array<float,2>{0.44469595f, 0.728678346f},
-std::array<float,2>{0.998686433f, 0.983854651f},
-std::array<float,2>{0.0281350967f, 0.208784387f},
-std::array<float,2>{0.612892866f, 0.128120452f},
-std::array<float,2>{0.290875971f, 0.890306413f},
-std::array<float,2>{0.842735827f, 0.662960231f},
-std::array<float,2>{0.170474067f, 0.46853143f},
-std::array<float,2>{0.924228668f, 0.323668808f},
-std::array<float,2>{0.116446652f, 0.596037567f},
-std::array<float,2>{0.749274373f, 0.805111706f},
-std::array<float,2>{0.386658281f, 0.0225623455f},
-std::array<float,2>{0.960811675f, 0.227926269f},
-std::array<float,2>{0.048031047f, 0.962907732f},
-std::array<float,2>{0.685237944f, 0.717391014f},
-std::array<float,2>{0.471601665f, 0.427377731f},
-std::array<float,2>{0.532489419f, 0.254397839f},
-std::array<float,2>{0.353789777f, 0.522328436f},
-std::array<float,2>{0.752417982f, 0.822366834f},
-std::array<float,2>{0.204258844f, 0.0909504145f},
-std::array<float,2>{0.716960073f, 0.0574905537f},
-std::array<float,2>{0.423885554f, 0.766778231f},
-std::array<float,2>{0.902645051f, 0.588188708f},
-std::array<float,2>{0.0701227412f, 0.348722726f},
-std::array<float,2>{0.854894102f, 0.487817168f},
-std::array<float,2>{0.156120211f, 0.644887924f},
-std::array<float,2>{0.582863033f, 0.924579024f},
-std::array<float,2>{0.25217405f, 0.172851115f},
-std::array<float,2>{0.945889056f, 0.0533410981f},
-std::array<float,2>{0.0313019976f, 0.774482727f},
-std::array<float,2>{0.663230121f, 0.585937083f},
-std::array<float,2>{0.486083299f, 0.352451831f},
-std::array<float,2>{0.560323715f, 0.499544114f},
-std::array<float,2>{0.360499591f, 0.650683701f},
-std::array<float,2>{0.767808557f, 0.936081171f},
-std::array<float,2>{0.199904546f, 0.182163283f},
-std::array<float,2>{0.698480427f, 0.222398818f},
-std::array<float,2>{0.410361558f, 0.960837543f},
-std::array<float,2>{0.880826175f, 0.706481218f},
-std::array<float,2>{0.0837997794f, 0.432533592f},
-std::array<float,2>{0.863788843f, 0.26536265f},
-std::array<float,2>{0.135138392f, 0.523714781f},
-std::array<float,2>{0.576232612f, 0.818421483f},
-std::array<float,2>{0.274447531f, 0.0811721012f},
-std::array<float,2>{0.794494689f, 0.138041392f},
-std::array<float,2>{0.243303671f, 0.881026506f},
-std::array<float,2>{0.504810154f, 0.666855216f},
-std::array<float,2>{0.327616155f, 0.455532342f},
-std::array<float,2>{0.632734239f, 0.317135513f},
-std::array<float,2>{0.45622766f, 0.608670712f},
-std::array<float,2>{0.969106793f, 0.803594947f},
-std::array<float,2>{0.00374828791f, 0.024291167f},
-std::array<float,2>{0.599991858f, 0.116407685f},
-std::array<float,2>{0.310638964f, 0.850631475f},
-std::array<float,2>{0.825413227f, 0.550339639f},
-std::array<float,2>{0.182250604f, 0.304442048f},
-std::array<float,2>{0.910475433f, 0.401489466f},
-std::array<float,2>{0.0997885391f, 0.724603176f},
-std::array<float,2>{0.723025501f, 0.970582604f},
-std::array<float,2>{0.394433081f, 0.218100384f},
-std::array<float,2>{0.838546276f, 0.0738103613f},
-std::array<float,2>{0.167103305f, 0.843188047f},
-std::array<float,2>{0.614052773f, 0.507958949f},
-std::array<float,2>{0.293100893f, 0.276900798f},
-std::array<float,2>{0.744530559f, 0.420509547f},
-std::array<float,2>{0.389838189f, 0.698721588f},
-std::array<float,2>{0.92688477f, 0.946408331f},
-std::array<float,2>{0.109804034f, 0.248349011f},
-std::array<float,2>{0.52298516f, 0.157027066f},
-std::array<float,2>{0.333257467f, 0.920893133f},
-std::array<float,2>{0.798905194f, 0.627283573f},
-std::array<float,2>{0.225750163f, 0.472553641f},
-std::array<float,2>{0.994988024f, 0.369750142f},
-std::array<float,2>{0.0256591532f, 0.567237079f},
-std::array<float,2>{0.65455687f, 0.75313592f},
-std::array<float,2>{0.439536691f, 0.0414925329f},
-std::array<float,2>{0.902328908f, 0.193718791f},
-std::array<float,2>{0.0627849102f, 0.99097091f},
-std::array<float,2>{0.71164459f, 0.734518766f},
-std::array<float,2>{0.429140925f, 0.386796296f},
-std::array<float,2>{0.578822732f, 0.29109484f},
-std::array<float,2>{0.255939335f, 0.537814856f},
-std::array<float,2>{0.856564283f, 0.861975431f},
-std::array<float,2>{0.149429128f, 0.103127941f},
-std::array<float,2>{0.682309031f, 0.00479354989f},
-std::array<float,2>{0.474595785f, 0.785302818f},
-std::array<float,2>{0.955273688f, 0.609579802f},
-std::array<float,2>{0.0531875491f, 0.342649549f},
-std::array<float,2>{0.754360318f, 0.452166408f},
-std::array<float,2>{0.207453966f, 0.681075633f},
-std::array<float,2>{0.535302877f, 0.901614547f},
-std::array<float,2>{0.359262407f, 0.147335693f},
-std::array<float,2>{0.937333226f, 0.0949270502f},
-std::array<float,2>{0.122010693f, 0.867985308f},
-std::array<float,2>{0.73550272f, 0.539569736f},
-std::array<float,2>{0.379681766f, 0.28713116f},
-std::array<float,2>{0.621998847f, 0.382768422f},
-std::array<float,2>{0.282369852f, 0.746873736f},
-std::array<float,2>{0.831649303f, 0.999107122f},
-std::array<float,2>{0.15686734f, 0.202702984f},
-std::array<float,2>{0.644858062f, 0.15132679f},
-std::array<float,2>{0.446483225f, 0.896986544f},
-std::array<float,2>{0.987277985f, 0.672425568f},
-std::array<float,2>{0.0193094239f, 0.437606931f},
-std::array<float,2>{0.80663085f, 0.328262329f},
-std::array<float,2>{0.227590725f, 0.620217681f},
-std::array<float,2>{0.529384911f, 0.789745033f},
-std::array<float,2>{0.339452296f, 0.0147068258f},
-std::array<float,2>{0.845383525f, 0.2370805f},
-std::array<float,2>{0.14096123f, 0.941585481f},
-std::array<float,2>{0.592562616f, 0.691389978f},
-std::array<float,2>{0.263164341f, 0.407230049f},
-std::array<float,2>{0.706638217f, 0.269744784f},
-std::array<float,2>{0.437143058f, 0.50745815f},
-std::array<float,2>{0.892712176f, 0.8326208f},
-std::array<float,2>{0.077668488f, 0.0681193545f},
-std::array<float,2>{0.545607448f, 0.0320204236f},
-std::array<float,2>{0.348844141f, 0.757993221f},
-std::array<float,2>{0.761726439f, 0.576237023f},
-std::array<float,2>{0.214626655f, 0.36050275f},
-std::array<float,2>{0.966072321f, 0.483227611f},
-std::array<float,2>{0.0612858422f, 0.635454893f},
-std::array<float,2>{0.672670245f, 0.907788575f},
-std::array<float,2>{0.47791931f, 0.164528266f},
-std::array<float,2>{0.77596873f, 0.0176510122f},
-std::array<float,2>{0.194028333f, 0.812441587f},
-std::array<float,2>{0.552972436f, 0.599189341f},
-std::array<float,2>{0.369067103f, 0.327517807f},
-std::array<float,2>{0.669625163f, 0.463796109f},
-std::array<float,2>{0.498110384f, 0.658680141f},
-std::array<float,2>{0.945051789f, 0.884842992f},
-std::array<float,2>{0.0447782241f, 0.131345525f},
-std::array<float,2>{0.569931865f, 0.204022571f},
-std::array<float,2>{0.270850867f, 0.976578832f},
-std::array<float,2>{0.873961091f, 0.733954251f},
-std::array<float,2>{0.129698873f, 0.398361802f},
-std::array<float,2>{0.885459065f, 0.308686793f},
-std::array<float,2>{0.0898062959f, 0.557929277f},
-std::array<float,2>{0.687505007f, 0.854970634f},
-std::array<float,2>{0.41687113f, 0.121652924f},
-std::array<float,2>{0.977438629f, 0.177281514f},
-std::array<float,2>{0.0125163719f, 0.927258551f},
-std::array<float,2>{0.636250317f, 0.64144069f},
-std::array<float,2>{0.461767137f, 0.489033133f},
-std::array<float,2>{0.510953426f, 0.345481932f},
-std::array<float,2>{0.317265898f, 0.592937529f},
-std::array<float,2>{0.783165336f, 0.77029866f},
-std::array<float,2>{0.241789117f, 0.0619494319f},
-std::array<float,2>{0.728021801f, 0.088484861f},
-std::array<float,2>{0.404661745f, 0.826815069f},
-std::array<float,2>{0.920454502f, 0.51744616f},
-std::array<float,2>{0.105574585f, 0.253904194f},
-std::array<float,2>{0.818614244f, 0.424284369f},
-std::array<float,2>{0.176035345f, 0.713679492f},
-std::array<float,2>{0.607842743f, 0.966705084f},
-std::array<float,2>{0.297907472f, 0.230909958f},
-std::array<float,2>{0.962244809f, 0.112283275f},
-std::array<float,2>{0.0578991808f, 0.844580948f},
-std::array<float,2>{0.677250147f, 0.552824795f},
-std::array<float,2>{0.481165856f, 0.298900247f},
-std::array<float,2>{0.541656852f, 0.404416591f},
-std::array<float,2>{0.345474124f, 0.720798492f},
-std::array<float,2>{0.759359241f, 0.975167394f},
-std::array<float,2>{0.218294293f, 0.211589009f},
-std::array<float,2>{0.707096577f, 0.133872002f},
-std::array<float,2>{0.429925591f, 0.876992106f},
-std::array<float,2>{0.896618724f, 0.668713868f},
-std::array<float,2>{0.0706354901f, 0.460187197f},
-std::array<float,2>{0.850808859f, 0.315896094f},
-std::array<float,2>{0.145018533f, 0.602119684f},
-std::array<float,2>{0.588418007f, 0.797207415f},
-std::array<float,2>{0.26170224f, 0.0309249721f},
-std::array<float,2>{0.810489476f, 0.224576816f},
-std::array<float,2>{0.232681468f, 0.95464921f},
-std::array<float,2>{0.524006963f, 0.70876956f},
-std::array<float,2>{0.341416627f, 0.436027139f},
-std::array<float,2>{0.641300261f, 0.260288715f},
-std::array<float,2>{0.450247347f, 0.529268801f},
-std::array<float,2>{0.991681695f, 0.813665628f},
-std::array<float,2>{0.0201656222f, 0.0856622458f},
-std::array<float,2>{0.617540181f, 0.0499837622f},
-std::array<float,2>{0.286046118f, 0.777874351f},
-std::array<float,2>{0.83257091f, 0.58173722f},
-std::array<float,2>{0.163619995f, 0.358132184f},
-std::array<float,2>{0.932679415f, 0.496045679f},
-std::array<float,2>{0.119667552f, 0.652539551f},
-std::array<float,2>{0.73956573f, 0.929988444f},
-std::array<float,2>{0.375689626f, 0.18468985f},
-std::array<float,2>{0.815241039f, 5.74276273e-05f},
-std::array<float,2>{0.172900215f, 0.78288871f},
-std::array<float,2>{0.60416925f, 0.616269827f},
-std::array<float,2>{0.303898633f, 0.337180346f},
-std::array<float,2>{0.733953834f, 0.447882622f},
-std::array<float,2>{0.399006754f, 0.685566127f},
-std::array<float,2>{0.915697396f, 0.905454218f},
-std::array<float,2>{0.104289293f, 0.14320004f},
-std::array<float,2>{0.514990509f, 0.191182196f},
-std::array<float,2>{0.314284712f, 0.9880867f},
-std::array<float,2>{0.788681686f, 0.739054441f},
-std::array<float,2>{0.234920934f, 0.384701073f},
-std::array<float,2>{0.981201828f, 0.294681817f},
-std::array<float,2>{0.00934534334f, 0.534540296f},
-std::array<float,2>{0.639647305f, 0.863544643f},
-std::array<float,2>{0.466943651f, 0.106272615f},
-std::array<float,2>{0.888852298f, 0.160933405f},
-std::array<float,2>{0.0915844589f, 0.917581975f},
-std::array<float,2>{0.692976654f, 0.63009572f},
-std::array<float,2>{0.421284258f, 0.47434032f},
-std::array<float,2>{0.564295352f, 0.372767508f},
-std::array<float,2>{0.266461998f, 0.566034555f},
-std::array<float,2>{0.86882484f, 0.756759703f},
-std::array<float,2>{0.127843827f, 0.0465204418f},
-std::array<float,2>{0.66717118f, 0.0746051967f},
-std::array<float,2>{0.493251413f, 0.838722408f},
-std::array<float,2>{0.938035011f, 0.515485942f},
-std::array<float,2>{0.0415210016f, 0.280315995f},
-std::array<float,2>{0.780290425f, 0.417812198f},
-std::array<float,2>{0.189737007f, 0.701990306f},
-std::array<float,2>{0.549610555f, 0.949527979f},
-std::array<float,2>{0.373680621f, 0.245549455f},
-std::array<float,2>{0.907152057f, 0.0368109383f},
-std::array<float,2>{0.0968964472f, 0.762520134f},
-std::array<float,2>{0.719108939f, 0.57137239f},
-std::array<float,2>{0.398091823f, 0.364679366f},
-std::array<float,2>{0.596558213f, 0.477780133f},
-std::array<float,2>{0.304890573f, 0.638674319f},
-std::array<float,2>{0.821760416f, 0.911285102f},
-std::array<float,2>{0.184152275f, 0.168341219f},
-std::array<float,2>{0.626761675f, 0.238638401f},
-std::array<float,2>{0.459129035f, 0.939166903f},
-std::array<float,2>{0.975025952f, 0.695293903f},
-std::array<float,2>{0.00463102013f, 0.410564899f},
-std::array<float,2>{0.790653348f, 0.265677452f},
-std::array<float,2>{0.249387726f, 0.500701368f},
-std::array<float,2>{0.501913607f, 0.831777096f},
-std::array<float,2>{0.321475446f, 0.064833723f},
-std::array<float,2>{0.861543f, 0.154705256f},
-std::array<float,2>{0.138067275f, 0.890881419f},
-std::array<float,2>{0.572589993f, 0.677635491f},
-std::array<float,2>{0.277720898f, 0.442760915f},
-std::array<float,2>{0.702787697f, 0.335107058f},
-std::array<float,2>{0.408312291f, 0.624697208f},
-std::array<float,2>{0.875761688f, 0.794662535f},
-std::array<float,2>{0.0805295631f, 0.011057632f},
-std::array<float,2>{0.55727762f, 0.0997425169f},
-std::array<float,2>{0.366347194f, 0.871837318f},
-std::array<float,2>{0.773096144f, 0.546103299f},
-std::array<float,2>{0.196033329f, 0.282837957f},
-std::array<float,2>{0.951847732f, 0.375761658f},
-std::array<float,2>{0.0373416878f, 0.74492383f},
-std::array<float,2>{0.65826124f, 0.994197845f},
-std::array<float,2>{0.48954919f, 0.198160097f},
-std::array<float,2>{0.751246035f, 0.092677936f},
-std::array<float,2>{0.205693141f, 0.821680844f},
-std::array<float,2>{0.534278274f, 0.520913482f},
-std::array<float,2>{0.353134245f, 0.256947249f},
-std::array<float,2>{0.686469674f, 0.427935362f},
-std::array<float,2>{0.470360309f, 0.71543622f},
-std::array<float,2>{0.957488298f, 0.961838186f},
-std::array<float,2>{0.0489048027f, 0.230409041f},
-std::array<float,2>{0.585739791f, 0.175541356f},
-std::array<float,2>{0.250265837f, 0.922155738f},
-std::array<float,2>{0.852596045f, 0.64735508f},
-std::array<float,2>{0.152591363f, 0.484837264f},
-std::array<float,2>{0.904328227f, 0.35081169f},
-std::array<float,2>{0.06752076f, 0.586512029f},
-std::array<float,2>{0.715910792f, 0.769159138f},
-std::array<float,2>{0.423666477f, 0.0562226325f},
-std::array<float,2>{0.997881234f, 0.209823504f},
-std::array<float,2>{0.030893622f, 0.981434345f},
-std::array<float,2>{0.649272025f, 0.728466511f},
-std::array<float,2>{0.442445159f, 0.393698096f},
-std::array<float,2>{0.517213047f, 0.304986268f},
-std::array<float,2>{0.33048895f, 0.56173414f},
-std::array<float,2>{0.803050697f, 0.856001258f},
-std::array<float,2>{0.2209865f, 0.11823906f},
-std::array<float,2>{0.747696161f, 0.0207008142f},
-std::array<float,2>{0.383693844f, 0.807384789f},
-std::array<float,2>{0.923478782f, 0.595462084f},
-std::array<float,2>{0.114376202f, 0.322032392f},
-std::array<float,2>{0.841520131f, 0.46569705f},
-std::array<float,2>{0.169445619f, 0.660437942f},
-std::array<float,2>{0.611273408f, 0.886980057f},
-std::array<float,2>{0.291728586f, 0.126939356f},
-std::array<float,2>{0.971726418f, 0.0262557976f},
-std::array<float,2>{0.0017763339f, 0.801148236f},
-std::array<float,2>{0.630692482f, 0.606455266f},
-std::array<float,2>{0.453808457f, 0.318991154f},
-std::array<float,2>{0.507485628f, 0.454022467f},
-std::array<float,2>{0.324626923f, 0.664961338f},
-std::array<float,2>{0.795621276f, 0.879022837f},
-std::array<float,2>{0.244759396f, 0.140163869f},
-std::array<float,2>{0.726287782f, 0.215850249f},
-std::array<float,2>{0.392321318f, 0.971863449f},
-std::array<float,2>{0.912608445f, 0.725965619f},
-std::array<float,2>{0.0981968492f, 0.399597019f},
-std::array<float,2>{0.827328026f, 0.300875366f},
-std::array<float,2>{0.181270748f, 0.547708452f},
-std::array<float,2>{0.598386109f, 0.848199606f},
-std::array<float,2>{0.309749424f, 0.114481442f},
-std::array<float,2>{0.765654564f, 0.180390552f},
-std::array<float,2>{0.202768877f, 0.934785903f},
-std::array<float,2>{0.560683072f, 0.649399281f},
-std::array<float,2>{0.363192946f, 0.497982293f},
-std::array<float,2>{0.66027236f, 0.354019254f},
-std::array<float,2>{0.487308562f, 0.582433939f},
-std::array<float,2>{0.947554708f, 0.776867211f},
-std::array<float,2>{0.0344269127f, 0.0521171913f},
-std::array<float,2>{0.57535851f, 0.0800736248f},
-std::array<float,2>{0.27650696f, 0.817055762f},
-std::array<float,2>{0.86646992f, 0.52673924f},
-std::array<float,2>{0.134530589f, 0.262447089f},
-std::array<float,2>{0.881063163f, 0.430040568f},
-std::array<float,2>{0.0854017809f, 0.704768181f},
-std::array<float,2>{0.697017193f, 0.958072007f},
-std::array<float,2>{0.412282377f, 0.220628381f},
-std::array<float,2>{0.857968509f, 0.104273327f},
-std::array<float,2>{0.150648624f, 0.861217082f},
-std::array<float,2>{0.580202639f, 0.535945833f},
-std::array<float,2>{0.254376769f, 0.289959282f},
-std::array<float,2>{0.714556158f, 0.389469653f},
-std::array<float,2>{0.426868081f, 0.736506462f},
-std::array<float,2>{0.89887929f, 0.988554597f},
-std::array<float,2>{0.0653407276f, 0.192950293f},
-std::array<float,2>{0.538777113f, 0.146319821f},
-std::array<float,2>{0.357148796f, 0.89851886f},
-std::array<float,2>{0.757012963f, 0.682434916f},
-std::array<float,2>{0.210309997f, 0.450429618f},
-std::array<float,2>{0.953846335f, 0.341057599f},
-std::array<float,2>{0.0525426492f, 0.611648858f},
-std::array<float,2>{0.68163991f, 0.787418008f},
-std::array<float,2>{0.475233227f, 0.00649029715f},
-std::array<float,2>{0.929107726f, 0.247176051f},
-std::array<float,2>{0.11168085f, 0.948385715f},
-std::array<float,2>{0.742515028f, 0.695536077f},
-std::array<float,2>{0.388043284f, 0.419673294f},
-std::array<float,2>{0.616541028f, 0.274021655f},
-std::array<float,2>{0.295897335f, 0.511426151f},
-std::array<float,2>{0.837468803f, 0.840198874f},
-std::array<float,2>{0.166007876f, 0.0709887892f},
-std::array<float,2>{0.652673721f, 0.0397433862f},
-std::array<float,2>{0.437881917f, 0.751692891f},
-std::array<float,2>{0.992790401f, 0.568414092f},
-std::array<float,2>{0.0238729194f, 0.368174136f},
-std::array<float,2>{0.798405707f, 0.470195979f},
-std::array<float,2>{0.222731248f, 0.625669658f},
-std::array<float,2>{0.520345807f, 0.919204772f},
-std::array<float,2>{0.335088998f, 0.159165204f},
-std::array<float,2>{0.89217484f, 0.0691477805f},
-std::array<float,2>{0.0753704533f, 0.834916532f},
-std::array<float,2>{0.703598797f, 0.505300105f},
-std::array<float,2>{0.435054034f, 0.273215622f},
-std::array<float,2>{0.590543807f, 0.40925315f},
-std::array<float,2>{0.264186651f, 0.689157784f},
-std::array<float,2>{0.847565174f, 0.944785535f},
-std::array<float,2>{0.144079849f, 0.235904872f},
-std::array<float,2>{0.674134612f, 0.16672112f},
-std::array<float,2>{0.480199367f, 0.909290195f},
-std::array<float,2>{0.966825366f, 0.633050501f},
-std::array<float,2>{0.0593877696f, 0.480657786f},
-std::array<float,2>{0.764777243f, 0.362441629f},
-std::array<float,2>{0.212177604f, 0.575158656f},
-std::array<float,2>{0.544773817f, 0.760268569f},
-std::array<float,2>{0.350211322f, 0.0339891724f},
-std::array<float,2>{0.828774631f, 0.200690836f},
-std::array<float,2>{0.159441859f, 0.996159196f},
-std::array<float,2>{0.624175489f, 0.749047518f},
-std::array<float,2>{0.284139246f, 0.379556298f},
-std::array<float,2>{0.737691224f, 0.286828548f},
-std::array<float,2>{0.382082075f, 0.541607916f},
-std::array<float,2>{0.935144365f, 0.870812237f},
-std::array<float,2>{0.124114357f, 0.0962768495f},
-std::array<float,2>{0.527736247f, 0.0136126233f},
-std::array<float,2>{0.337594837f, 0.79103756f},
-std::array<float,2>{0.80733639f, 0.61800009f},
-std::array<float,2>{0.229716659f, 0.331847876f},
-std::array<float,2>{0.985634744f, 0.440087229f},
-std::array<float,2>{0.0157609861f, 0.674201965f},
-std::array<float,2>{0.646901786f, 0.896001816f},
-std::array<float,2>{0.447532624f, 0.148837328f},
-std::array<float,2>{0.783331156f, 0.0589396618f},
-std::array<float,2>{0.239824086f, 0.772868037f},
-std::array<float,2>{0.508383155f, 0.590481222f},
-std::array<float,2>{0.318786383f, 0.346848905f},
-std::array<float,2>{0.634177446f, 0.491753012f},
-std::array<float,2>{0.463359684f, 0.643776536f},
-std::array<float,2>{0.978928804f, 0.928055108f},
-std::array<float,2>{0.0155118462f, 0.177813485f},
-std::array<float,2>{0.606937706f, 0.234327123f},
-std::array<float,2>{0.300374418f, 0.966874361f},
-std::array<float,2>{0.817269385f, 0.712424755f},
-std::array<float,2>{0.177778348f, 0.422673017f},
-std::array<float,2>{0.91929388f, 0.250289917f},
-std::array<float,2>{0.107556581f, 0.518519521f},
-std::array<float,2>{0.729082227f, 0.824903965f},
-std::array<float,2>{0.403330326f, 0.0870384574f},
-std::array<float,2>{0.942165911f, 0.129200011f},
-std::array<float,2>{0.0449887365f, 0.883225977f},
-std::array<float,2>{0.671814919f, 0.657860279f},
-std::array<float,2>{0.497653991f, 0.462446392f},
-std::array<float,2>{0.552566528f, 0.324428737f},
-std::array<float,2>{0.369724244f, 0.601238251f},
-std::array<float,2>{0.775106609f, 0.808734775f},
-std::array<float,2>{0.192467436f, 0.0163135622f},
-std::array<float,2>{0.689836621f, 0.124194853f},
-std::array<float,2>{0.414190233f, 0.851895154f},
-std::array<float,2>{0.883794367f, 0.554831743f},
-std::array<float,2>{0.0869950056f, 0.312013239f},
-std::array<float,2>{0.871135771f, 0.396392763f},
-std::array<float,2>{0.132329047f, 0.731418371f},
-std::array<float,2>{0.567179024f, 0.979335487f},
-std::array<float,2>{0.272534996f, 0.205692574f},
-std::array<float,2>{0.998418927f, 0.118706256f},
-std::array<float,2>{0.0278008282f, 0.855795503f},
-std::array<float,2>{0.652313054f, 0.562417388f},
-std::array<float,2>{0.445006877f, 0.305367142f},
-std::array<float,2>{0.519157648f, 0.394235373f},
-std::array<float,2>{0.329804987f, 0.727702737f},
-std::array<float,2>{0.802464604f, 0.980521142f},
-std::array<float,2>{0.21895051f, 0.209015071f},
-std::array<float,2>{0.749551177f, 0.126438305f},
-std::array<float,2>{0.38613674f, 0.887650073f},
-std::array<float,2>{0.924378693f, 0.6607005f},
-std::array<float,2>{0.11703413f, 0.464985281f},
-std::array<float,2>{0.842186809f, 0.321291775f},
-std::array<float,2>{0.170291901f, 0.594847918f},
-std::array<float,2>{0.612570345f, 0.807002842f},
-std::array<float,2>{0.290361375f, 0.0211343579f},
-std::array<float,2>{0.752689123f, 0.229621932f},
-std::array<float,2>{0.204951912f, 0.96106267f},
-std::array<float,2>{0.533173919f, 0.715150237f},
-std::array<float,2>{0.354453683f, 0.428607017f},
-std::array<float,2>{0.684656501f, 0.257722914f},
-std::array<float,2>{0.471150786f, 0.521040499f},
-std::array<float,2>{0.960011065f, 0.821943581f},
-std::array<float,2>{0.048720479f, 0.0918436646f},
-std::array<float,2>{0.582319677f, 0.0560368486f},
-std::array<float,2>{0.252828062f, 0.768930733f},
-std::array<float,2>{0.855130076f, 0.585943103f},
-std::array<float,2>{0.155381516f, 0.35147354f},
-std::array<float,2>{0.903239906f, 0.485225707f},
-std::array<float,2>{0.0697308183f, 0.646775186f},
-std::array<float,2>{0.717333376f, 0.9227314f},
-std::array<float,2>{0.424334705f, 0.175182834f},
-std::array<float,2>{0.86065942f, 0.0114509761f},
-std::array<float,2>{0.138843685f, 0.794342458f},
-std::array<float,2>{0.571193874f, 0.624120414f},
-std::array<float,2>{0.280294806f, 0.335674495f},
-std::array<float,2>{0.699649811f, 0.443166882f},
-std::array<float,2>{0.407020777f, 0.676814616f},
-std::array<float,2>{0.878284276f, 0.891216159f},
-std::array<float,2>{0.0790393203f, 0.154799551f},
-std::array<float,2>{0.555511653f, 0.197668537f},
-std::array<float,2>{0.364951849f, 0.994655252f},
-std::array<float,2>{0.770644844f, 0.744557381f},
-std::array<float,2>{0.198441699f, 0.375450343f},
-std::array<float,2>{0.951108515f, 0.282590687f},
-std::array<float,2>{0.0356189348f, 0.546518505f},
-std::array<float,2>{0.656513631f, 0.871502519f},
-std::array<float,2>{0.490484595f, 0.100260466f},
-std::array<float,2>{0.909538448f, 0.168689683f},
-std::array<float,2>{0.0952300951f, 0.911901712f},
-std::array<float,2>{0.722242773f, 0.639231503f},
-std::array<float,2>{0.395277262f, 0.478339583f},
-std::array<float,2>{0.594086885f, 0.365126044f},
-std::array<float,2>{0.306757987f, 0.572012424f},
-std::array<float,2>{0.824193895f, 0.761791527f},
-std::array<float,2>{0.187166557f, 0.0364234298f},
-std::array<float,2>{0.627337933f, 0.0651567876f},
-std::array<float,2>{0.458445996f, 0.83131057f},
-std::array<float,2>{0.974097967f, 0.500107884f},
-std::array<float,2>{0.006147095f, 0.266516984f},
-std::array<float,2>{0.791510105f, 0.410964251f},
-std::array<float,2>{0.24784559f, 0.694385529f},
-std::array<float,2>{0.502310038f, 0.938942671f},
-std::array<float,2>{0.323194623f, 0.239247575f},
-std::array<float,2>{0.887160003f, 0.0460681431f},
-std::array<float,2>{0.0930897221f, 0.755972564f},
-std::array<float,2>{0.695247889f, 0.565802634f},
-std::array<float,2>{0.418423057f, 0.372443587f},
-std::array<float,2>{0.566012263f, 0.473920703f},
-std::array<float,2>{0.268577605f, 0.630447924f},
-std::array<float,2>{0.870043933f, 0.917017698f},
-std::array<float,2>{0.126292065f, 0.1604013f},
-std::array<float,2>{0.664218783f, 0.245786041f},
-std::array<float,2>{0.494698435f, 0.949953139f},
-std::array<float,2>{0.940122068f, 0.701330721f},
-std::array<float,2>{0.0395004638f, 0.416999131f},
-std::array<float,2>{0.778759956f, 0.280877024f},
-std::array<float,2>{0.187968656f, 0.514823556f},
-std::array<float,2>{0.548443794f, 0.838248968f},
-std::array<float,2>{0.372413874f, 0.0749670863f},
-std::array<float,2>{0.813070953f, 0.142934546f},
-std::array<float,2>{0.174785122f, 0.905773818f},
-std::array<float,2>{0.603496969f, 0.686104417f},
-std::array<float,2>{0.301263422f, 0.447598755f},
-std::array<float,2>{0.730681181f, 0.337649703f},
-std::array<float,2>{0.400463402f, 0.616776645f},
-std::array<float,2>{0.916250348f, 0.782595456f},
-std::array<float,2>{0.103468612f, 0.000815573556f},
-std::array<float,2>{0.513349891f, 0.105894975f},
-std::array<float,2>{0.315714657f, 0.864033878f},
-std::array<float,2>{0.786836684f, 0.535142779f},
-std::array<float,2>{0.238234341f, 0.294079036f},
-std::array<float,2>{0.983541548f, 0.38409698f},
-std::array<float,2>{0.011265263f, 0.738350153f},
-std::array<float,2>{0.638233006f, 0.98756969f},
-std::array<float,2>{0.465607405f, 0.190760702f},
-std::array<float,2>{0.812349617f, 0.0854330212f},
-std::array<float,2>{0.232076153f, 0.814098299f},
-std::array<float,2>{0.525916815f, 0.528389573f},
-std::array<float,2>{0.343355417f, 0.25977394f},
-std::array<float,2>{0.643906415f, 0.436086863f},
-std::array<float,2>{0.4528929f, 0.708445311f},
-std::array<float,2>{0.989955246f, 0.95422709f},
-std::array<float,2>{0.0217499919f, 0.224005759f},
-std::array<float,2>{0.620242834f, 0.185171291f},
-std::array<float,2>{0.288785666f, 0.930259287f},
-std::array<float,2>{0.834379852f, 0.653214753f},
-std::array<float,2>{0.161596581f, 0.495202303f},
-std::array<float,2>{0.931067407f, 0.357761651f},
-std::array<float,2>{0.11849606f, 0.581352711f},
-std::array<float,2>{0.740407348f, 0.777468145f},
-std::array<float,2>{0.377208859f, 0.050419379f},
-std::array<float,2>{0.964593351f, 0.211342558f},
-std::array<float,2>{0.0549390577f, 0.975015163f},
-std::array<float,2>{0.679576457f, 0.721549273f},
-std::array<float,2>{0.483442426f, 0.405196369f},
-std::array<float,2>{0.539892495f, 0.299744576f},
-std::array<float,2>{0.345933706f, 0.553708136f},
-std::array<float,2>{0.761435866f, 0.843899667f},
-std::array<float,2>{0.215202942f, 0.111704029f},
-std::array<float,2>{0.710534096f, 0.0304815397f},
-std::array<float,2>{0.432702631f, 0.797476113f},
-std::array<float,2>{0.896357775f, 0.602018118f},
-std::array<float,2>{0.0725478232f, 0.316395998f},
-std::array<float,2>{0.84827435f, 0.460581928f},
-std::array<float,2>{0.147273213f, 0.668402433f},
-std::array<float,2>{0.587381482f, 0.877513528f},
-std::array<float,2>{0.259413183f, 0.134562209f},
-std::array<float,2>{0.944796979f, 0.0156917498f},
-std::array<float,2>{0.0440136418f, 0.809370995f},
-std::array<float,2>{0.669286549f, 0.601072609f},
-std::array<float,2>{0.498782367f, 0.325158119f},
-std::array<float,2>{0.553460002f, 0.462188393f},
-std::array<float,2>{0.368256927f, 0.657601714f},
-std::array<float,2>{0.775568128f, 0.883383632f},
-std::array<float,2>{0.193516195f, 0.129585564f},
-std::array<float,2>{0.688426971f, 0.205262676f},
-std::array<float,2>{0.416122586f, 0.978738487f},
-std::array<float,2>{0.885055482f, 0.730895996f},
-std::array<float,2>{0.0891032368f, 0.395738691f},
-std::array<float,2>{0.873529792f, 0.311808199f},
-std::array<float,2>{0.129177883f, 0.555521429f},
-std::array<float,2>{0.569735765f, 0.852178395f},
-std::array<float,2>{0.271219254f, 0.124645583f},
-std::array<float,2>{0.782382309f, 0.178425685f},
-std::array<float,2>{0.24135685f, 0.928424478f},
-std::array<float,2>{0.511675656f, 0.644078791f},
-std::array<float,2>{0.316822857f, 0.491552234f},
-std::array<float,2>{0.635839283f, 0.34751904f},
-std::array<float,2>{0.461065739f, 0.589905083f},
-std::array<float,2>{0.976846039f, 0.772985876f},
-std::array<float,2>{0.0120472424f, 0.0591147356f},
-std::array<float,2>{0.60809803f, 0.0875610113f},
-std::array<float,2>{0.298693866f, 0.82463038f},
-std::array<float,2>{0.819247246f, 0.517669022f},
-std::array<float,2>{0.176313847f, 0.25064823f},
-std::array<float,2>{0.920050561f, 0.422346354f},
-std::array<float,2>{0.106346123f, 0.711968124f},
-std::array<float,2>{0.728042305f, 0.967702448f},
-std::array<float,2>{0.405213535f, 0.233770654f},
-std::array<float,2>{0.831399262f, 0.0957230479f},
-std::array<float,2>{0.156346574f, 0.870560884f},
-std::array<float,2>{0.621484876f, 0.541068792f},
-std::array<float,2>{0.283079267f, 0.286411256f},
-std::array<float,2>{0.735906184f, 0.379220724f},
-std::array<float,2>{0.379391402f, 0.749600172f},
-std::array<float,2>{0.936896443f, 0.996712565f},
-std::array<float,2>{0.12115597f, 0.20038943f},
-std::array<float,2>{0.530166507f, 0.149250373f},
-std::array<float,2>{0.338951677f, 0.895949423f},
-std::array<float,2>{0.806010783f, 0.674639761f},
-std::array<float,2>{0.228404522f, 0.439768225f},
-std::array<float,2>{0.986704409f, 0.331296533f},
-std::array<float,2>{0.0188023895f, 0.617419243f},
-std::array<float,2>{0.645426691f, 0.791973889f},
-std::array<float,2>{0.446910888f, 0.0130332923f},
-std::array<float,2>{0.893095911f, 0.235437289f},
-std::array<float,2>{0.0775050074f, 0.945286751f},
-std::array<float,2>{0.706156492f, 0.688825428f},
-std::array<float,2>{0.436780691f, 0.409946442f},
-std::array<float,2>{0.591956437f, 0.272847176f},
-std::array<float,2>{0.263279259f, 0.50559473f},
-std::array<float,2>{0.84478128f, 0.834316969f},
-std::array<float,2>{0.141236454f, 0.0685361028f},
-std::array<float,2>{0.672357261f, 0.0335983336f},
-std::array<float,2>{0.478209883f, 0.759986758f},
-std::array<float,2>{0.966413379f, 0.574629068f},
-std::array<float,2>{0.0609301217f, 0.363157541f},
-std::array<float,2>{0.762452006f, 0.481337368f},
-std::array<float,2>{0.214175791f, 0.633535683f},
-std::array<float,2>{0.545052171f, 0.909801304f},
-std::array<float,2>{0.349396259f, 0.166496187f},
-std::array<float,2>{0.927470684f, 0.07066416f},
-std::array<float,2>{0.110249542f, 0.840608895f},
-std::array<float,2>{0.744679689f, 0.511149108f},
-std::array<float,2>{0.390346378f, 0.273620963f},
-std::array<float,2>{0.613473058f, 0.419389546f},
-std::array<float,2>{0.293484807f, 0.696234763f},
-std::array<float,2>{0.838256359f, 0.94883728f},
-std::array<float,2>{0.167600527f, 0.24775517f},
-std::array<float,2>{0.654999077f, 0.158205047f},
-std::array<float,2>{0.440402865f, 0.919889867f},
-std::array<float,2>{0.99420917f, 0.625069559f},
-std::array<float,2>{0.0262837708f, 0.470574558f},
-std::array<float,2>{0.799794555f, 0.368689507f},
-std::array<float,2>{0.226327613f, 0.569050908f},
-std::array<float,2>{0.522759855f, 0.751184046f},
-std::array<float,2>{0.333515525f, 0.0390750021f},
-std::array<float,2>{0.85720855f, 0.192737222f},
-std::array<float,2>{0.150144398f, 0.989038587f},
-std::array<float,2>{0.578355372f, 0.737242341f},
-std::array<float,2>{0.256541491f, 0.389013976f},
-std::array<float,2>{0.711243272f, 0.28954789f},
-std::array<float,2>{0.429602742f, 0.535197318f},
-std::array<float,2>{0.90154165f, 0.860539734f},
-std::array<float,2>{0.0630659461f, 0.103639714f},
-std::array<float,2>{0.535818338f, 0.00615837844f},
-std::array<float,2>{0.358530313f, 0.787812829f},
-std::array<float,2>{0.754870772f, 0.61186403f},
-std::array<float,2>{0.207911402f, 0.34166339f},
-std::array<float,2>{0.955682933f, 0.450856328f},
-std::array<float,2>{0.0534645803f, 0.681999862f},
-std::array<float,2>{0.68180716f, 0.899066985f},
-std::array<float,2>{0.473973632f, 0.145707846f},
-std::array<float,2>{0.768525898f, 0.0525616184f},
-std::array<float,2>{0.199317873f, 0.776800513f},
-std::array<float,2>{0.560020268f, 0.582588792f},
-std::array<float,2>{0.361149073f, 0.353718132f},
-std::array<float,2>{0.66406101f, 0.497237056f},
-std::array<float,2>{0.485736936f, 0.648829699f},
-std::array<float,2>{0.945398748f, 0.935330629f},
-std::array<float,2>{0.0320961289f, 0.17977953f},
-std::array<float,2>{0.576938808f, 0.219827548f},
-std::array<float,2>{0.275169104f, 0.958881855f},
-std::array<float,2>{0.863578081f, 0.704337299f},
-std::array<float,2>{0.135408312f, 0.43035391f},
-std::array<float,2>{0.880254745f, 0.261754245f},
-std::array<float,2>{0.0834565163f, 0.527214408f},
-std::array<float,2>{0.699114978f, 0.816761971f},
-std::array<float,2>{0.410951763f, 0.0793914646f},
-std::array<float,2>{0.969514966f, 0.13975729f},
-std::array<float,2>{0.00301142363f, 0.879858375f},
-std::array<float,2>{0.631836236f, 0.664091349f},
-std::array<float,2>{0.456804544f, 0.453296065f},
-std::array<float,2>{0.504171252f, 0.31854865f},
-std::array<float,2>{0.32770586f, 0.607028186f},
-std::array<float,2>{0.794171929f, 0.801303923f},
-std::array<float,2>{0.243761286f, 0.025432568f},
-std::array<float,2>{0.72358942f, 0.114806101f},
-std::array<float,2>{0.39383325f, 0.847890258f},
-std::array<float,2>{0.911105573f, 0.547219634f},
-std::array<float,2>{0.100243263f, 0.301523983f},
-std::array<float,2>{0.826110363f, 0.40006569f},
-std::array<float,2>{0.182026297f, 0.726474881f},
-std::array<float,2>{0.600397229f, 0.97250855f},
-std::array<float,2>{0.311170101f, 0.216363966f},
-std::array<float,2>{0.957827687f, 0.0917440951f},
-std::array<float,2>{0.0495484471f, 0.82291609f},
-std::array<float,2>{0.685806811f, 0.521762013f},
-std::array<float,2>{0.470050067f, 0.254113615f},
-std::array<float,2>{0.53485471f, 0.427197754f},
-std::array<float,2>{0.352938801f, 0.717018485f},
-std::array<float,2>{0.751750767f, 0.963461876f},
-std::array<float,2>{0.205349177f, 0.228406847f},
-std::array<float,2>{0.716472447f, 0.172089547f},
-std::array<float,2>{0.423179984f, 0.92414552f},
-std::array<float,2>{0.905066907f, 0.645270944f},
-std::array<float,2>{0.0682083145f, 0.487737417f},
-std::array<float,2>{0.853162289f, 0.349602848f},
-std::array<float,2>{0.153161883f, 0.5886994f},
-std::array<float,2>{0.585273087f, 0.767553747f},
-std::array<float,2>{0.25067842f, 0.0569770671f},
-std::array<float,2>{0.803470314f, 0.208320364f},
-std::array<float,2>{0.221370056f, 0.983947217f},
-std::array<float,2>{0.516895413f, 0.729058027f},
-std::array<float,2>{0.33063966f, 0.391907692f},
-std::array<float,2>{0.648725569f, 0.30674845f},
-std::array<float,2>{0.443114787f, 0.559164405f},
-std::array<float,2>{0.997479737f, 0.857815802f},
-std::array<float,2>{0.0306055285f, 0.120439999f},
-std::array<float,2>{0.610678256f, 0.0233148187f},
-std::array<float,2>{0.291227221f, 0.805466413f},
-std::array<float,2>{0.840992451f, 0.59653461f},
-std::array<float,2>{0.169248417f, 0.323739141f},
-std::array<float,2>{0.922872007f, 0.468105942f},
-std::array<float,2>{0.114763476f, 0.662569642f},
-std::array<float,2>{0.74707216f, 0.88985157f},
-std::array<float,2>{0.382901102f, 0.128872707f},
-std::array<float,2>{0.822084308f, 0.0373107046f},
-std::array<float,2>{0.184048504f, 0.764850736f},
-std::array<float,2>{0.595956028f, 0.573459625f},
-std::array<float,2>{0.305537641f, 0.365891457f},
-std::array<float,2>{0.719537139f, 0.478770584f},
-std::array<float,2>{0.397942811f, 0.638167202f},
-std::array<float,2>{0.906473339f, 0.912982345f},
-std::array<float,2>{0.0973634347f, 0.170441866f},
-std::array<float,2>{0.501445651f, 0.240455538f},
-std::array<float,2>{0.32190299f, 0.940845549f},
-std::array<float,2>{0.790254772f, 0.692362964f},
-std::array<float,2>{0.249933645f, 0.413953304f},
-std::array<float,2>{0.975125194f, 0.267698199f},
-std::array<float,2>{0.00407016231f, 0.502313733f},
-std::array<float,2>{0.626234949f, 0.829885781f},
-std::array<float,2>{0.459750921f, 0.0627690032f},
-std::array<float,2>{0.875311553f, 0.15249756f},
-std::array<float,2>{0.081046015f, 0.89260155f},
-std::array<float,2>{0.702426493f, 0.679679394f},
-std::array<float,2>{0.409073234f, 0.443631917f},
-std::array<float,2>{0.5730232f, 0.333957523f},
-std::array<float,2>{0.278274924f, 0.622707009f},
-std::array<float,2>{0.862065256f, 0.796228528f},
-std::array<float,2>{0.138472438f, 0.00965823978f},
-std::array<float,2>{0.659162283f, 0.098833397f},
-std::array<float,2>{0.490062207f, 0.873522282f},
-std::array<float,2>{0.951229274f, 0.544303417f},
-std::array<float,2>{0.0380447358f, 0.284047335f},
-std::array<float,2>{0.772944808f, 0.378585637f},
-std::array<float,2>{0.1955809f, 0.742831528f},
-std::array<float,2>{0.557047367f, 0.992934406f},
-std::array<float,2>{0.366910517f, 0.196487889f},
-std::array<float,2>{0.915126503f, 0.00256295549f},
-std::array<float,2>{0.10384547f, 0.784190357f},
-std::array<float,2>{0.733403623f, 0.614762068f},
-std::array<float,2>{0.398749769f, 0.338364005f},
-std::array<float,2>{0.603793621f, 0.447152287f},
-std::array<float,2>{0.304608613f, 0.685433567f},
-std::array<float,2>{0.814663947f, 0.904065967f},
-std::array<float,2>{0.173744023f, 0.140940428f},
-std::array<float,2>{0.639109731f, 0.188920081f},
-std::array<float,2>{0.467726797f, 0.984453797f},
-std::array<float,2>{0.980718791f, 0.740747094f},
-std::array<float,2>{0.00902535208f, 0.386403322f},
-std::array<float,2>{0.788104594f, 0.296003252f},
-std::array<float,2>{0.234401226f, 0.531755149f},
-std::array<float,2>{0.515352666f, 0.86588496f},
-std::array<float,2>{0.313698053f, 0.10796956f},
-std::array<float,2>{0.86817348f, 0.163449436f},
-std::array<float,2>{0.127131268f, 0.91532582f},
-std::array<float,2>{0.563855112f, 0.632280707f},
-std::array<float,2>{0.265643924f, 0.475367129f},
-std::array<float,2>{0.692853034f, 0.37371847f},
-std::array<float,2>{0.421469182f, 0.563835204f},
-std::array<float,2>{0.889499843f, 0.754641175f},
-std::array<float,2>{0.0911410078f, 0.0430709869f},
-std::array<float,2>{0.549030721f, 0.0769046471f},
-std::array<float,2>{0.373309106f, 0.836846828f},
-std::array<float,2>{0.781049728f, 0.511893213f},
-std::array<float,2>{0.190124765f, 0.277628213f},
-std::array<float,2>{0.937679708f, 0.415609539f},
-std::array<float,2>{0.0413836502f, 0.700863063f},
-std::array<float,2>{0.667648077f, 0.952016234f},
-std::array<float,2>{0.493918478f, 0.242803469f},
-std::array<float,2>{0.759242058f, 0.111175686f},
-std::array<float,2>{0.21796976f, 0.84581244f},
-std::array<float,2>{0.541468978f, 0.551411688f},
-std::array<float,2>{0.344903409f, 0.297449172f},
-std::array<float,2>{0.677012026f, 0.403017014f},
-std::array<float,2>{0.480491817f, 0.719716728f},
-std::array<float,2>{0.962612808f, 0.974325776f},
-std::array<float,2>{0.0585801862f, 0.214192063f},
-std::array<float,2>{0.588210464f, 0.135127559f},
-std::array<float,2>{0.260830373f, 0.87679702f},
-std::array<float,2>{0.851521254f, 0.67076534f},
-std::array<float,2>{0.145197392f, 0.458870053f},
-std::array<float,2>{0.89713645f, 0.312578231f},
-std::array<float,2>{0.0709365234f, 0.603643537f},
-std::array<float,2>{0.707710266f, 0.800629914f},
-std::array<float,2>{0.430229515f, 0.027977366f},
-std::array<float,2>{0.992048502f, 0.226550773f},
-std::array<float,2>{0.0196903106f, 0.956470847f},
-std::array<float,2>{0.640914381f, 0.709978938f},
-std::array<float,2>{0.450702697f, 0.433846354f},
-std::array<float,2>{0.523858249f, 0.258947164f},
-std::array<float,2>{0.341278076f, 0.53014648f},
-std::array<float,2>{0.809606135f, 0.815212548f},
-std::array<float,2>{0.233266085f, 0.0825850442f},
-std::array<float,2>{0.739862144f, 0.0487176664f},
-std::array<float,2>{0.375284404f, 0.781061471f},
-std::array<float,2>{0.93356061f, 0.57957375f},
-std::array<float,2>{0.119456157f, 0.356535763f},
-std::array<float,2>{0.83229357f, 0.492726415f},
-std::array<float,2>{0.163487837f, 0.654824257f},
-std::array<float,2>{0.618057907f, 0.933135986f},
-std::array<float,2>{0.285602093f, 0.186548755f},
-std::array<float,2>{0.979011118f, 0.0623217747f},
-std::array<float,2>{0.0147426268f, 0.769749522f},
-std::array<float,2>{0.634374142f, 0.593330503f},
-std::array<float,2>{0.463683039f, 0.345053613f},
-std::array<float,2>{0.507860363f, 0.488654703f},
-std::array<float,2>{0.318875402f, 0.640741527f},
-std::array<float,2>{0.783696234f, 0.926957786f},
-std::array<float,2>{0.239259854f, 0.177035153f},
-std::array<float,2>{0.728770494f, 0.231053799f},
-std::array<float,2>{0.404271334f, 0.966158569f},
-std::array<float,2>{0.919772148f, 0.712891221f},
-std::array<float,2>{0.108301029f, 0.42468825f},
-std::array<float,2>{0.81641233f, 0.253285587f},
-std::array<float,2>{0.178232417f, 0.516921401f},
-std::array<float,2>{0.606909811f, 0.826484799f},
-std::array<float,2>{0.300256997f, 0.0879611298f},
-std::array<float,2>{0.774612665f, 0.131787419f},
-std::array<float,2>{0.192932367f, 0.885659933f},
-std::array<float,2>{0.551997304f, 0.658824682f},
-std::array<float,2>{0.369396329f, 0.463356256f},
-std::array<float,2>{0.670935452f, 0.327850938f},
-std::array<float,2>{0.497537136f, 0.598927557f},
-std::array<float,2>{0.941511095f, 0.81200242f},
-std::array<float,2>{0.0455832332f, 0.018535126f},
-std::array<float,2>{0.566749036f, 0.121413082f},
-std::array<float,2>{0.273260295f, 0.854988992f},
-std::array<float,2>{0.871978462f, 0.558173656f},
-std::array<float,2>{0.132121816f, 0.309502184f},
-std::array<float,2>{0.884386778f, 0.397838891f},
-std::array<float,2>{0.0877324119f, 0.73376286f},
-std::array<float,2>{0.690350533f, 0.977336824f},
-std::array<float,2>{0.414583355f, 0.203361019f},
-std::array<float,2>{0.846820533f, 0.067510061f},
-std::array<float,2>{0.143596932f, 0.83210057f},
-std::array<float,2>{0.59000057f, 0.506992161f},
-std::array<float,2>{0.263979882f, 0.270293176f},
-std::array<float,2>{0.703869224f, 0.408184707f},
-std::array<float,2>{0.435410053f, 0.69047159f},
-std::array<float,2>{0.89164567f, 0.942256391f},
-std::array<float,2>{0.0757326931f, 0.236803636f},
-std::array<float,2>{0.543956697f, 0.164900869f},
-std::array<float,2>{0.349931896f, 0.907327473f},
-std::array<float,2>{0.765214741f, 0.635104477f},
-std::array<float,2>{0.212608352f, 0.482898384f},
-std::array<float,2>{0.96773386f, 0.361240804f},
-std::array<float,2>{0.0586109869f, 0.57687068f},
-std::array<float,2>{0.674671948f, 0.75870049f},
-std::array<float,2>{0.479639471f, 0.0314088911f},
-std::array<float,2>{0.934620798f, 0.202189863f},
-std::array<float,2>{0.124893904f, 0.999964356f},
-std::array<float,2>{0.738043487f, 0.746511042f},
-std::array<float,2>{0.382623434f, 0.382082641f},
-std::array<float,2>{0.624781907f, 0.287791878f},
-std::array<float,2>{0.283315182f, 0.539371252f},
-std::array<float,2>{0.828413188f, 0.867294967f},
-std::array<float,2>{0.159833089f, 0.0955209211f},
-std::array<float,2>{0.647407293f, 0.0152265467f},
-std::array<float,2>{0.447843581f, 0.789535761f},
-std::array<float,2>{0.986197233f, 0.621010005f},
-std::array<float,2>{0.0162286554f, 0.328901827f},
-std::array<float,2>{0.807111323f, 0.43829608f},
-std::array<float,2>{0.230057746f, 0.67233932f},
-std::array<float,2>{0.527942479f, 0.896552622f},
-std::array<float,2>{0.337174088f, 0.150441244f},
-std::array<float,2>{0.899369478f, 0.102825157f},
-std::array<float,2>{0.0648404509f, 0.861762881f},
-std::array<float,2>{0.71421814f, 0.537527919f},
-std::array<float,2>{0.427461594f, 0.291847706f},
-std::array<float,2>{0.580785453f, 0.387338042f},
-std::array<float,2>{0.254412472f, 0.735145807f},
-std::array<float,2>{0.857489407f, 0.990715146f},
-std::array<float,2>{0.151092023f, 0.193854973f},
-std::array<float,2>{0.681037188f, 0.146672249f},
-std::array<float,2>{0.474810332f, 0.901911855f},
-std::array<float,2>{0.953220785f, 0.681492686f},
-std::array<float,2>{0.0518407561f, 0.452644378f},
-std::array<float,2>{0.757794917f, 0.342014104f},
-std::array<float,2>{0.210523143f, 0.609977007f},
-std::array<float,2>{0.53840673f, 0.785820484f},
-std::array<float,2>{0.356787771f, 0.00394746289f},
-std::array<float,2>{0.836950123f, 0.248832345f},
-std::array<float,2>{0.165459618f, 0.946779251f},
-std::array<float,2>{0.617011786f, 0.699068189f},
-std::array<float,2>{0.295202017f, 0.420225859f},
-std::array<float,2>{0.743154943f, 0.276641399f},
-std::array<float,2>{0.388404191f, 0.508648336f},
-std::array<float,2>{0.929528892f, 0.843460739f},
-std::array<float,2>{0.112280704f, 0.0734651461f},
-std::array<float,2>{0.519896209f, 0.0417989716f},
-std::array<float,2>{0.335894644f, 0.75372678f},
-std::array<float,2>{0.798285425f, 0.566730261f},
-std::array<float,2>{0.223412246f, 0.369161665f},
-std::array<float,2>{0.992500067f, 0.472007751f},
-std::array<float,2>{0.0240547992f, 0.627829254f},
-std::array<float,2>{0.652938604f, 0.920379758f},
-std::array<float,2>{0.438444763f, 0.156320259f},
-std::array<float,2>{0.795236766f, 0.0239249263f},
-std::array<float,2>{0.244537205f, 0.802736044f},
-std::array<float,2>{0.506881297f, 0.60934031f},
-std::array<float,2>{0.325010806f, 0.316755831f},
-std::array<float,2>{0.630288124f, 0.455917448f},
-std::array<float,2>{0.45355168f, 0.666210353f},
-std::array<float,2>{0.972552598f, 0.88153249f},
-std::array<float,2>{0.00105761702f, 0.138505563f},
-std::array<float,2>{0.59770453f, 0.218385264f},
-std::array<float,2>{0.310114354f, 0.969760358f},
-std::array<float,2>{0.828000069f, 0.723784566f},
-std::array<float,2>{0.18082729f, 0.402097553f},
-std::array<float,2>{0.912588656f, 0.304119885f},
-std::array<float,2>{0.0981094539f, 0.550070882f},
-std::array<float,2>{0.725827813f, 0.851207674f},
-std::array<float,2>{0.391891003f, 0.117178194f},
-std::array<float,2>{0.947973788f, 0.182086542f},
-std::array<float,2>{0.0349793024f, 0.935975373f},
-std::array<float,2>{0.660983384f, 0.651336551f},
-std::array<float,2>{0.48780793f, 0.499289602f},
-std::array<float,2>{0.561246097f, 0.351921171f},
-std::array<float,2>{0.36266458f, 0.585326314f},
-std::array<float,2>{0.766140521f, 0.775165021f},
-std::array<float,2>{0.20263581f, 0.0531815737f},
-std::array<float,2>{0.69673562f, 0.0816046223f},
-std::array<float,2>{0.413005114f, 0.81918925f},
-std::array<float,2>{0.88170588f, 0.524402678f},
-std::array<float,2>{0.0857880861f, 0.264887035f},
-std::array<float,2>{0.866929293f, 0.431885719f},
-std::array<float,2>{0.134115368f, 0.706667364f},
-std::array<float,2>{0.576148033f, 0.960432172f},
-std::array<float,2>{0.276942015f, 0.221762568f},
-std::array<float,2>{0.973581731f, 0.0635151416f},
-std::array<float,2>{0.00739133079f, 0.828342855f},
-std::array<float,2>{0.628672302f, 0.503213525f},
-std::array<float,2>{0.457134008f, 0.269196242f},
-std::array<float,2>{0.50384289f, 0.412187576f},
-std::array<float,2>{0.324122995f, 0.692757964f},
-std::array<float,2>{0.792294979f, 0.939503074f},
-std::array<float,2>{0.246703804f, 0.241662502f},
-std::array<float,2>{0.721383929f, 0.171870828f},
-std::array<float,2>{0.396446109f, 0.913996458f},
-std::array<float,2>{0.90884012f, 0.637181818f},
-std::array<float,2>{0.0943304226f, 0.479860008f},
-std::array<float,2>{0.823199749f, 0.366691589f},
-std::array<float,2>{0.186352849f, 0.573181808f},
-std::array<float,2>{0.595427573f, 0.764124334f},
-std::array<float,2>{0.307891339f, 0.0382492468f},
-std::array<float,2>{0.77042079f, 0.196214795f},
-std::array<float,2>{0.197575688f, 0.993594825f},
-std::array<float,2>{0.556083202f, 0.743786454f},
-std::array<float,2>{0.364013553f, 0.377378553f},
-std::array<float,2>{0.657977581f, 0.284852028f},
-std::array<float,2>{0.491855979f, 0.543228209f},
-std::array<float,2>{0.949433804f, 0.874825418f},
-std::array<float,2>{0.0367000215f, 0.0981372297f},
-std::array<float,2>{0.572032869f, 0.00848724972f},
-std::array<float,2>{0.279684484f, 0.795188844f},
-std::array<float,2>{0.859927297f, 0.621570349f},
-std::array<float,2>{0.139845774f, 0.33253777f},
-std::array<float,2>{0.877850354f, 0.444794834f},
-std::array<float,2>{0.0796916559f, 0.678557396f},
-std::array<float,2>{0.700790823f, 0.893965006f},
-std::array<float,2>{0.407539278f, 0.153825775f},
-std::array<float,2>{0.854490161f, 0.0582989976f},
-std::array<float,2>{0.154753253f, 0.76604259f},
-std::array<float,2>{0.583085537f, 0.589419603f},
-std::array<float,2>{0.253531188f, 0.347795129f},
-std::array<float,2>{0.717951596f, 0.486600518f},
-std::array<float,2>{0.425688058f, 0.646235108f},
-std::array<float,2>{0.903515279f, 0.925467134f},
-std::array<float,2>{0.0692244098f, 0.172902882f},
-std::array<float,2>{0.531472206f, 0.227391049f},
-std::array<float,2>{0.354537606f, 0.964355171f},
-std::array<float,2>{0.753519952f, 0.718119502f},
-std::array<float,2>{0.203350529f, 0.426393956f},
-std::array<float,2>{0.95970571f, 0.255137563f},
-std::array<float,2>{0.0470616035f, 0.523362279f},
-std::array<float,2>{0.683728397f, 0.823498189f},
-std::array<float,2>{0.472524464f, 0.0907778963f},
-std::array<float,2>{0.925411463f, 0.127221346f},
-std::array<float,2>{0.115882777f, 0.889437079f},
-std::array<float,2>{0.748663485f, 0.663237512f},
-std::array<float,2>{0.384893417f, 0.467721879f},
-std::array<float,2>{0.611952364f, 0.323150218f},
-std::array<float,2>{0.289500445f, 0.596904516f},
-std::array<float,2>{0.842783153f, 0.806573749f},
-std::array<float,2>{0.171076313f, 0.0219733417f},
-std::array<float,2>{0.651234984f, 0.119193822f},
-std::array<float,2>{0.44403252f, 0.859032094f},
-std::array<float,2>{0.999482095f, 0.55964303f},
-std::array<float,2>{0.0285045058f, 0.30857861f},
-std::array<float,2>{0.800869942f, 0.390628576f},
-std::array<float,2>{0.219813257f, 0.729815722f},
-std::array<float,2>{0.518106759f, 0.983242929f},
-std::array<float,2>{0.328561246f, 0.207074896f},
-std::array<float,2>{0.895253718f, 0.028945256f},
-std::array<float,2>{0.0736037791f, 0.799570441f},
-std::array<float,2>{0.708992898f, 0.605288148f},
-std::array<float,2>{0.431951314f, 0.313565761f},
-std::array<float,2>{0.586488485f, 0.457305729f},
-std::array<float,2>{0.258145899f, 0.671580851f},
-std::array<float,2>{0.849553168f, 0.875279665f},
-std::array<float,2>{0.148436382f, 0.136107087f},
-std::array<float,2>{0.677835584f, 0.213859349f},
-std::array<float,2>{0.48309499f, 0.97289902f},
-std::array<float,2>{0.962971449f, 0.720045447f},
-std::array<float,2>{0.0559375547f, 0.403449595f},
-std::array<float,2>{0.760277212f, 0.298459083f},
-std::array<float,2>{0.21665749f, 0.552033901f},
-std::array<float,2>{0.540162325f, 0.847524464f},
-std::array<float,2>{0.347276628f, 0.109611712f},
-std::array<float,2>{0.835780144f, 0.185898423f},
-std::array<float,2>{0.160361186f, 0.932224751f},
-std::array<float,2>{0.619410098f, 0.655624211f},
-std::array<float,2>{0.287766993f, 0.493282735f},
-std::array<float,2>{0.741986215f, 0.356051773f},
-std::array<float,2>{0.378008515f, 0.578580856f},
-std::array<float,2>{0.929858923f, 0.779413939f},
-std::array<float,2>{0.118079528f, 0.0477434322f},
-std::array<float,2>{0.526566029f, 0.083754316f},
-std::array<float,2>{0.342674285f, 0.815955997f},
-std::array<float,2>{0.811120272f, 0.531092525f},
-std::array<float,2>{0.2309784f, 0.258593529f},
-std::array<float,2>{0.988616168f, 0.435130417f},
-std::array<float,2>{0.0229270495f, 0.709739804f},
-std::array<float,2>{0.643077433f, 0.955959618f},
-std::array<float,2>{0.451477617f, 0.225156739f},
-std::array<float,2>{0.786009073f, 0.10878104f},
-std::array<float,2>{0.237057671f, 0.866971791f},
-std::array<float,2>{0.512041211f, 0.532774508f},
-std::array<float,2>{0.315312982f, 0.295240402f},
-std::array<float,2>{0.637458384f, 0.385262728f},
-std::array<float,2>{0.465991378f, 0.742101431f},
-std::array<float,2>{0.98333317f, 0.986167967f},
-std::array<float,2>{0.00996408891f, 0.187514871f},
-std::array<float,2>{0.602518022f, 0.141722918f},
-std::array<float,2>{0.302192599f, 0.903070927f},
-std::array<float,2>{0.814237475f, 0.683741271f},
-std::array<float,2>{0.175359666f, 0.445927113f},
-std::array<float,2>{0.917745829f, 0.339755595f},
-std::array<float,2>{0.101669617f, 0.61332345f},
-std::array<float,2>{0.732281804f, 0.783236206f},
-std::array<float,2>{0.401764929f, 0.00322695286f},
-std::array<float,2>{0.941150844f, 0.243624508f},
-std::array<float,2>{0.0406619944f, 0.952952623f},
-std::array<float,2>{0.66571337f, 0.699680984f},
-std::array<float,2>{0.496084273f, 0.414857805f},
-std::array<float,2>{0.547737002f, 0.278851777f},
-std::array<float,2>{0.371199518f, 0.512919128f},
-std::array<float,2>{0.778311133f, 0.837305844f},
-std::array<float,2>{0.189264297f, 0.0777298063f},
-std::array<float,2>{0.693917453f, 0.0446904823f},
-std::array<float,2>{0.419501245f, 0.755232692f},
-std::array<float,2>{0.888609469f, 0.562639654f},
-std::array<float,2>{0.0925858095f, 0.374180734f},
-std::array<float,2>{0.870657086f, 0.476506263f},
-std::array<float,2>{0.125865594f, 0.631178677f},
-std::array<float,2>{0.56503284f, 0.914362848f},
-std::array<float,2>{0.268544257f, 0.162598237f},
-std::array<float,2>{0.965680718f, 0.0323996134f},
-std::array<float,2>{0.0615659468f, 0.759671807f},
-std::array<float,2>{0.673745453f, 0.577879786f},
-std::array<float,2>{0.477018923f, 0.360017121f},
-std::array<float,2>{0.546533108f, 0.483664304f},
-std::array<float,2>{0.348497659f, 0.636094511f},
-std::array<float,2>{0.763204575f, 0.906957209f},
-std::array<float,2>{0.21340324f, 0.165472999f},
-std::array<float,2>{0.705188215f, 0.238188088f},
-std::array<float,2>{0.436349124f, 0.943131387f},
-std::array<float,2>{0.893804491f, 0.689937055f},
-std::array<float,2>{0.0763779283f, 0.407044262f},
-std::array<float,2>{0.844093204f, 0.271350443f},
-std::array<float,2>{0.141863734f, 0.506298244f},
-std::array<float,2>{0.592821538f, 0.833501399f},
-std::array<float,2>{0.26269263f, 0.0665035099f},
-std::array<float,2>{0.805471301f, 0.152337566f},
-std::array<float,2>{0.226817533f, 0.897860467f},
-std::array<float,2>{0.530701756f, 0.672917604f},
-std::array<float,2>{0.338577092f, 0.438729078f},
-std::array<float,2>{0.645850301f, 0.32986784f},
-std::array<float,2>{0.445837975f, 0.619233966f},
-std::array<float,2>{0.98767662f, 0.790245652f},
-std::array<float,2>{0.0178888105f, 0.014586851f},
-std::array<float,2>{0.622699916f, 0.0944964886f},
-std::array<float,2>{0.281608969f, 0.868559599f},
-std::array<float,2>{0.830738187f, 0.540870547f},
-std::array<float,2>{0.157998845f, 0.288861424f},
-std::array<float,2>{0.935827315f, 0.381608605f},
-std::array<float,2>{0.122965209f, 0.747489333f},
-std::array<float,2>{0.734975755f, 0.998075187f},
-std::array<float,2>{0.379888445f, 0.201973632f},
-std::array<float,2>{0.819651484f, 0.0893470719f},
-std::array<float,2>{0.177704379f, 0.82729727f},
-std::array<float,2>{0.609012425f, 0.51584965f},
-std::array<float,2>{0.297607869f, 0.252778888f},
-std::array<float,2>{0.726581991f, 0.425096422f},
-std::array<float,2>{0.40576008f, 0.713909268f},
-std::array<float,2>{0.921619892f, 0.965643942f},
-std::array<float,2>{0.106740423f, 0.231588542f},
-std::array<float,2>{0.510237932f, 0.175859213f},
-std::array<float,2>{0.318198234f, 0.925831079f},
-std::array<float,2>{0.782208622f, 0.642418325f},
-std::array<float,2>{0.240356043f, 0.489750743f},
-std::array<float,2>{0.978292763f, 0.343918025f},
-std::array<float,2>{0.0129855163f, 0.592390418f},
-std::array<float,2>{0.634943724f, 0.770853698f},
-std::array<float,2>{0.462579668f, 0.0613430701f},
-std::array<float,2>{0.885766387f, 0.204817653f},
-std::array<float,2>{0.0880699456f, 0.978303611f},
-std::array<float,2>{0.689019203f, 0.732846498f},
-std::array<float,2>{0.417012453f, 0.397327721f},
-std::array<float,2>{0.568883181f, 0.310249239f},
-std::array<float,2>{0.270331204f, 0.557367802f},
-std::array<float,2>{0.874278009f, 0.854142725f},
-std::array<float,2>{0.130350679f, 0.122988492f},
-std::array<float,2>{0.668790579f, 0.0190000199f},
-std::array<float,2>{0.499447018f, 0.810655475f},
-std::array<float,2>{0.943628788f, 0.597998977f},
-std::array<float,2>{0.0437311865f, 0.32622388f},
-std::array<float,2>{0.777089834f, 0.463939399f},
-std::array<float,2>{0.195142627f, 0.659893513f},
-std::array<float,2>{0.554522514f, 0.886671185f},
-std::array<float,2>{0.367949992f, 0.131967694f},
-std::array<float,2>{0.912103891f, 0.115340799f},
-std::array<float,2>{0.101309486f, 0.85011673f},
-std::array<float,2>{0.723920166f, 0.549727857f},
-std::array<float,2>{0.392904133f, 0.302807271f},
-std::array<float,2>{0.601065993f, 0.400469154f},
-std::array<float,2>{0.312470764f, 0.722839653f},
-std::array<float,2>{0.82424444f, 0.969219387f},
-std::array<float,2>{0.183312386f, 0.217196405f},
-std::array<float,2>{0.631409168f, 0.137471125f},
-std::array<float,2>{0.455401152f, 0.882367551f},
-std::array<float,2>{0.970390975f, 0.667369246f},
-std::array<float,2>{0.00229576183f, 0.456158727f},
-std::array<float,2>{0.79332298f, 0.318080753f},
-std::array<float,2>{0.242999092f, 0.60774374f},
-std::array<float,2>{0.505091012f, 0.804361224f},
-std::array<float,2>{0.326526344f, 0.0244874191f},
-std::array<float,2>{0.864916027f, 0.221618116f},
-std::array<float,2>{0.135745749f, 0.959891677f},
-std::array<float,2>{0.577684164f, 0.70603621f},
-std::array<float,2>{0.273681641f, 0.432667643f},
-std::array<float,2>{0.698022902f, 0.264027774f},
-std::array<float,2>{0.41168651f, 0.524759531f},
-std::array<float,2>{0.879359007f, 0.820091486f},
-std::array<float,2>{0.0824072212f, 0.0804814547f},
-std::array<float,2>{0.559496939f, 0.0541887507f},
-std::array<float,2>{0.359771609f, 0.774116755f},
-std::array<float,2>{0.769181907f, 0.58487016f},
-std::array<float,2>{0.200762779f, 0.353338391f},
-std::array<float,2>{0.946337819f, 0.498538285f},
-std::array<float,2>{0.0330284126f, 0.651587248f},
-std::array<float,2>{0.662973166f, 0.93738389f},
-std::array<float,2>{0.485225379f, 0.182842627f},
-std::array<float,2>{0.755037367f, 0.0054169544f},
-std::array<float,2>{0.208975554f, 0.786818326f},
-std::array<float,2>{0.536658406f, 0.610763133f},
-std::array<float,2>{0.358356625f, 0.34298256f},
-std::array<float,2>{0.683077872f, 0.451218933f},
-std::array<float,2>{0.472862184f, 0.680259407f},
-std::array<float,2>{0.956343472f, 0.900797963f},
-std::array<float,2>{0.0538622141f, 0.148007527f},
-std::array<float,2>{0.579104662f, 0.195042267f},
-std::array<float,2>{0.257256687f, 0.991530716f},
-std::array<float,2>{0.855875254f, 0.73607254f},
-std::array<float,2>{0.148565859f, 0.38776204f},
-std::array<float,2>{0.900562227f, 0.29208982f},
-std::array<float,2>{0.0638064221f, 0.538173437f},
-std::array<float,2>{0.712339759f, 0.86249572f},
-std::array<float,2>{0.427983731f, 0.101909682f},
-std::array<float,2>{0.995650887f, 0.158148676f},
-std::array<float,2>{0.0266620889f, 0.921565652f},
-std::array<float,2>{0.65599817f, 0.628422737f},
-std::array<float,2>{0.440591127f, 0.470734864f},
-std::array<float,2>{0.521701097f, 0.370921701f},
-std::array<float,2>{0.33298707f, 0.567940056f},
-std::array<float,2>{0.800492465f, 0.752317071f},
-std::array<float,2>{0.225139335f, 0.0422183238f},
-std::array<float,2>{0.74566412f, 0.0723135471f},
-std::array<float,2>{0.389385819f, 0.842200458f},
-std::array<float,2>{0.926453054f, 0.509641528f},
-std::array<float,2>{0.110394947f, 0.275647759f},
-std::array<float,2>{0.839303076f, 0.421836257f},
-std::array<float,2>{0.166879565f, 0.69730109f},
-std::array<float,2>{0.614529371f, 0.94578898f},
-std::array<float,2>{0.294572324f, 0.249855846f},
-std::array<float,2>{0.952954113f, 0.101500146f},
-std::array<float,2>{0.0382438004f, 0.872576952f},
-std::array<float,2>{0.659853518f, 0.545703888f},
-std::array<float,2>{0.488423377f, 0.28140229f},
-std::array<float,2>{0.558230221f, 0.375995934f},
-std::array<float,2>{0.365389913f, 0.745658159f},
-std::array<float,2>{0.77155596f, 0.99528414f},
-std::array<float,2>{0.19708389f, 0.198700964f},
-std::array<float,2>{0.702000976f, 0.155663997f},
-std::array<float,2>{0.409311891f, 0.892559409f},
-std::array<float,2>{0.876152337f, 0.676077247f},
-std::array<float,2>{0.0811503455f, 0.441591293f},
-std::array<float,2>{0.863125086f, 0.334939003f},
-std::array<float,2>{0.137136996f, 0.623815715f},
-std::array<float,2>{0.573399007f, 0.793188214f},
-std::array<float,2>{0.278417259f, 0.0106406631f},
-std::array<float,2>{0.78907758f, 0.239537299f},
-std::array<float,2>{0.248595834f, 0.93788898f},
-std::array<float,2>{0.500505328f, 0.693817735f},
-std::array<float,2>{0.320360512f, 0.412046552f},
-std::array<float,2>{0.625060558f, 0.266685396f},
-std::array<float,2>{0.460060298f, 0.501228511f},
-std::array<float,2>{0.976477802f, 0.831017554f},
-std::array<float,2>{0.00563625805f, 0.0657961518f},
-std::array<float,2>{0.596695185f, 0.0357426964f},
-std::array<float,2>{0.306047857f, 0.762718678f},
-std::array<float,2>{0.821107745f, 0.570961356f},
-std::array<float,2>{0.185390174f, 0.364197135f},
-std::array<float,2>{0.908060551f, 0.47675553f},
-std::array<float,2>{0.0961725041f, 0.640196145f},
-std::array<float,2>{0.719942868f, 0.910967231f},
-std::array<float,2>{0.39690727f, 0.169805139f},
-std::array<float,2>{0.840490878f, 0.0204759389f},
-std::array<float,2>{0.168565363f, 0.80847472f},
-std::array<float,2>{0.609755158f, 0.593868911f},
-std::array<float,2>{0.292463183f, 0.320518881f},
-std::array<float,2>{0.746326149f, 0.466369838f},
-std::array<float,2>{0.384600222f, 0.661943376f},
-std::array<float,2>{0.922296524f, 0.887809098f},
-std::array<float,2>{0.113619499f, 0.125084013f},
-std::array<float,2>{0.51626718f, 0.21059534f},
-std::array<float,2>{0.331132144f, 0.982236743f},
-std::array<float,2>{0.804359615f, 0.726891756f},
-std::array<float,2>{0.22215426f, 0.393172234f},
-std::array<float,2>{0.996348679f, 0.306370497f},
-std::array<float,2>{0.0300212055f, 0.560548604f},
-std::array<float,2>{0.649875641f, 0.857161582f},
-std::array<float,2>{0.441608131f, 0.118004441f},
-std::array<float,2>{0.905754387f, 0.174254f},
-std::array<float,2>{0.0665669963f, 0.922873676f},
-std::array<float,2>{0.714887261f, 0.648278594f},
-std::array<float,2>{0.42268315f, 0.485713512f},
-std::array<float,2>{0.584114552f, 0.350114495f},
-std::array<float,2>{0.251508802f, 0.58740747f},
-std::array<float,2>{0.852128506f, 0.767736018f},
-std::array<float,2>{0.154031873f, 0.0547785871f},
-std::array<float,2>{0.687473297f, 0.0934605524f},
-std::array<float,2>{0.469664186f, 0.820633233f},
-std::array<float,2>{0.958080947f, 0.520018578f},
-std::array<float,2>{0.0507501438f, 0.256127685f},
-std::array<float,2>{0.750831544f, 0.428872108f},
-std::array<float,2>{0.20607768f, 0.716153979f},
-std::array<float,2>{0.533509314f, 0.962365746f},
-std::array<float,2>{0.352106929f, 0.228616908f},
-std::array<float,2>{0.932217479f, 0.0494882949f},
-std::array<float,2>{0.121050842f, 0.778531432f},
-std::array<float,2>{0.738725722f, 0.580722511f},
-std::array<float,2>{0.376004577f, 0.358808011f},
-std::array<float,2>{0.618695498f, 0.49483493f},
-std::array<float,2>{0.28639546f, 0.654278457f},
-std::array<float,2>{0.833929241f, 0.930975437f},
-std::array<float,2>{0.162885621f, 0.183975577f},
-std::array<float,2>{0.642137766f, 0.223206207f},
-std::array<float,2>{0.449999779f, 0.9538818f},
-std::array<float,2>{0.990694284f, 0.707148373f},
-std::array<float,2>{0.0214768499f, 0.436787903f},
-std::array<float,2>{0.808907807f, 0.261441618f},
-std::array<float,2>{0.234196693f, 0.527608871f},
-std::array<float,2>{0.524615824f, 0.813126326f},
-std::array<float,2>{0.340554714f, 0.0848492533f},
-std::array<float,2>{0.849623084f, 0.133417413f},
-std::array<float,2>{0.145777091f, 0.878467321f},
-std::array<float,2>{0.589097619f, 0.669000447f},
-std::array<float,2>{0.259768605f, 0.459443152f},
-std::array<float,2>{0.708857119f, 0.315258086f},
-std::array<float,2>{0.431213707f, 0.602929294f},
-std::array<float,2>{0.898027956f, 0.798173249f},
-std::array<float,2>{0.0721457675f, 0.0295770224f},
-std::array<float,2>{0.542415679f, 0.113245614f},
-std::array<float,2>{0.34431982f, 0.84530443f},
-std::array<float,2>{0.757880151f, 0.554660916f},
-std::array<float,2>{0.217426598f, 0.300747633f},
-std::array<float,2>{0.96143961f, 0.405991435f},
-std::array<float,2>{0.0572117306f, 0.722337306f},
-std::array<float,2>{0.676342309f, 0.976200163f},
-std::array<float,2>{0.481815249f, 0.212041184f},
-std::array<float,2>{0.779368579f, 0.075363934f},
-std::array<float,2>{0.190465644f, 0.839578748f},
-std::array<float,2>{0.550318658f, 0.514083922f},
-std::array<float,2>{0.374827534f, 0.280221999f},
-std::array<float,2>{0.666694939f, 0.416110605f},
-std::array<float,2>{0.492462933f, 0.702502131f},
-std::array<float,2>{0.939276338f, 0.950771868f},
-std::array<float,2>{0.0428746454f, 0.244607672f},
-std::array<float,2>{0.563320994f, 0.161420092f},
-std::array<float,2>{0.267496526f, 0.916469693f},
-std::array<float,2>{0.867844045f, 0.629345655f},
-std::array<float,2>{0.128445014f, 0.47355485f},
-std::array<float,2>{0.890562057f, 0.371308982f},
-std::array<float,2>{0.090499267f, 0.564677119f},
-std::array<float,2>{0.692135811f, 0.757327437f},
-std::array<float,2>{0.42020452f, 0.0456016585f},
-std::array<float,2>{0.982158422f, 0.190237477f},
-std::array<float,2>{0.00865046307f, 0.986935794f},
-std::array<float,2>{0.639997363f, 0.739512682f},
-std::array<float,2>{0.468012571f, 0.38351649f},
-std::array<float,2>{0.51416409f, 0.292985559f},
-std::array<float,2>{0.312577546f, 0.533982635f},
-std::array<float,2>{0.787828088f, 0.864428222f},
-std::array<float,2>{0.235548049f, 0.106471315f},
-std::array<float,2>{0.732492447f, 0.00157440815f},
-std::array<float,2>{0.399518341f, 0.781676292f},
-std::array<float,2>{0.914336801f, 0.615708709f},
-std::array<float,2>{0.104766041f, 0.336110204f},
-std::array<float,2>{0.81587261f, 0.448817492f},
-std::array<float,2>{0.172209382f, 0.686679065f},
-std::array<float,2>{0.604885697f, 0.904593468f},
-std::array<float,2>{0.303633124f, 0.14426741f},
-std::array<float,2>{0.984990835f, 0.0121724037f},
-std::array<float,2>{0.0174795035f, 0.792073905f},
-std::array<float,2>{0.647471547f, 0.619047344f},
-std::array<float,2>{0.449146181f, 0.330998451f},
-std::array<float,2>{0.52919966f, 0.440789402f},
-std::array<float,2>{0.336092234f, 0.675077796f},
-std::array<float,2>{0.80858165f, 0.895281672f},
-std::array<float,2>{0.22870408f, 0.150216833f},
-std::array<float,2>{0.737039745f, 0.199284256f},
-std::array<float,2>{0.381024003f, 0.997321308f},
-std::array<float,2>{0.934048474f, 0.748354554f},
-std::array<float,2>{0.123616137f, 0.380531907f},
-std::array<float,2>{0.82913363f, 0.286011487f},
-std::array<float,2>{0.159016505f, 0.542163014f},
-std::array<float,2>{0.623903513f, 0.870084345f},
-std::array<float,2>{0.284902543f, 0.0969879478f},
-std::array<float,2>{0.764227986f, 0.167015523f},
-std::array<float,2>{0.211827561f, 0.908342004f},
-std::array<float,2>{0.543928623f, 0.634755909f},
-std::array<float,2>{0.351208925f, 0.482060701f},
-std::array<float,2>{0.675640881f, 0.362218648f},
-std::array<float,2>{0.479086369f, 0.575654268f},
-std::array<float,2>{0.967940807f, 0.760753095f},
-std::array<float,2>{0.060388349f, 0.0343384109f},
-std::array<float,2>{0.591588974f, 0.0695445389f},
-std::array<float,2>{0.264760882f, 0.835659981f},
-std::array<float,2>{0.84620595f, 0.504129946f},
-std::array<float,2>{0.142887428f, 0.272359669f},
-std::array<float,2>{0.891206264f, 0.409163833f},
-std::array<float,2>{0.0747921765f, 0.687502921f},
-std::array<float,2>{0.704698861f, 0.943545938f},
-std::array<float,2>{0.434302002f, 0.234697431f},
-std::array<float,2>{0.872142494f, 0.123878911f},
-std::array<float,2>{0.131230354f, 0.852618396f},
-std::array<float,2>{0.568061113f, 0.555880904f},
-std::array<float,2>{0.271696508f, 0.311032057f},
-std::array<float,2>{0.691392004f, 0.395014107f},
-std::array<float,2>{0.415646315f, 0.732172549f},
-std::array<float,2>{0.883627832f, 0.979937136f},
-std::array<float,2>{0.0868280828f, 0.20700869f},
-std::array<float,2>{0.550836682f, 0.130396709f},
-std::array<float,2>{0.370650172f, 0.884289205f},
-std::array<float,2>{0.773921907f, 0.656775415f},
-std::array<float,2>{0.192182258f, 0.461626977f},
-std::array<float,2>{0.94299686f, 0.326084405f},
-std::array<float,2>{0.0463475622f, 0.600078821f},
-std::array<float,2>{0.670178056f, 0.81012398f},
-std::array<float,2>{0.497003555f, 0.01719491f},
-std::array<float,2>{0.918228507f, 0.232692733f},
-std::array<float,2>{0.108582124f, 0.968678236f},
-std::array<float,2>{0.730212808f, 0.711073399f},
-std::array<float,2>{0.402882129f, 0.423356742f},
-std::array<float,2>{0.605796635f, 0.251798898f},
-std::array<float,2>{0.298846453f, 0.519371271f},
-std::array<float,2>{0.81760931f, 0.825923383f},
-std::array<float,2>{0.179439962f, 0.0868109539f},
-std::array<float,2>{0.633259654f, 0.0599528067f},
-std::array<float,2>{0.464765251f, 0.771813452f},
-std::array<float,2>{0.980366409f, 0.591602623f},
-std::array<float,2>{0.0137257576f, 0.346303374f},
-std::array<float,2>{0.784576058f, 0.490998834f},
-std::array<float,2>{0.238766491f, 0.642676532f},
-std::array<float,2>{0.509226501f, 0.928763509f},
-std::array<float,2>{0.319664478f, 0.179465905f},
-std::array<float,2>{0.882393003f, 0.0782626346f},
-std::array<float,2>{0.0848017186f, 0.818011284f},
-std::array<float,2>{0.695806801f, 0.525755942f},
-std::array<float,2>{0.41355738f, 0.263112903f},
-std::array<float,2>{0.574358284f, 0.430665851f},
-std::array<float,2>{0.276230186f, 0.703624725f},
-std::array<float,2>{0.865301073f, 0.957655728f},
-std::array<float,2>{0.133075342f, 0.219071761f},
-std::array<float,2>{0.661657751f, 0.181046277f},
-std::array<float,2>{0.486439735f, 0.933647513f},
-std::array<float,2>{0.948315978f, 0.649978817f},
-std::array<float,2>{0.0337890908f, 0.496394277f},
-std::array<float,2>{0.767117143f, 0.354655415f},
-std::array<float,2>{0.201397732f, 0.583577096f},
-std::array<float,2>{0.561949432f, 0.776038766f},
-std::array<float,2>{0.362302005f, 0.0511853211f},
-std::array<float,2>{0.826457024f, 0.215771317f},
-std::array<float,2>{0.180161968f, 0.970941007f},
-std::array<float,2>{0.599255562f, 0.725527883f},
-std::array<float,2>{0.308985084f, 0.398783237f},
-std::array<float,2>{0.725538671f, 0.301931828f},
-std::array<float,2>{0.390779316f, 0.548464775f},
-std::array<float,2>{0.914035201f, 0.849110484f},
-std::array<float,2>{0.0989459381f, 0.113499291f},
-std::array<float,2>{0.506245255f, 0.0270621609f},
-std::array<float,2>{0.326087952f, 0.801892281f},
-std::array<float,2>{0.796240687f, 0.606144249f},
-std::array<float,2>{0.245182529f, 0.320048124f},
-std::array<float,2>{0.970730722f, 0.454642355f},
-std::array<float,2>{0.000128900661f, 0.665288508f},
-std::array<float,2>{0.629112005f, 0.879930794f},
-std::array<float,2>{0.454531759f, 0.13934508f},
-std::array<float,2>{0.79737705f, 0.040426705f},
-std::array<float,2>{0.224304602f, 0.750379264f},
-std::array<float,2>{0.520692229f, 0.569728136f},
-std::array<float,2>{0.334138393f, 0.367670119f},
-std::array<float,2>{0.654287994f, 0.46876055f},
-std::array<float,2>{0.439065218f, 0.626492321f},
-std::array<float,2>{0.993962944f, 0.918774068f},
-std::array<float,2>{0.0251939557f, 0.159485355f},
-std::array<float,2>{0.615479767f, 0.246857941f},
-std::array<float,2>{0.29637301f, 0.947412908f},
-std::array<float,2>{0.836229026f, 0.696943641f},
-std::array<float,2>{0.164099902f, 0.418909162f},
-std::array<float,2>{0.928098679f, 0.274838626f},
-std::array<float,2>{0.112557702f, 0.510291636f},
-std::array<float,2>{0.743581593f, 0.8410725f},
-std::array<float,2>{0.386943668f, 0.0720954165f},
-std::array<float,2>{0.954342663f, 0.144660607f},
-std::array<float,2>{0.0516940467f, 0.90029794f},
-std::array<float,2>{0.68000859f, 0.683096111f},
-std::array<float,2>{0.47572124f, 0.449791282f},
-std::array<float,2>{0.537427604f, 0.340061575f},
-std::array<float,2>{0.355718225f, 0.612849832f},
-std::array<float,2>{0.756250143f, 0.788763881f},
-std::array<float,2>{0.209749356f, 0.00725792116f},
-std::array<float,2>{0.712948263f, 0.104950212f},
-std::array<float,2>{0.425845563f, 0.859610319f},
-std::array<float,2>{0.90021652f, 0.537076473f},
-std::array<float,2>{0.0660884157f, 0.29058817f},
-std::array<float,2>{0.859162271f, 0.390368015f},
-std::array<float,2>{0.151412562f, 0.738028109f},
-std::array<float,2>{0.581896603f, 0.990213752f},
-std::array<float,2>{0.255097538f, 0.191900268f}}
\ No newline at end of file
@@ -1,4096 +0,0 @@
-{std::array<float,2>{0.767672122f, 0.964461207f},
-std::array<float,2>{0.279696167f, 0.10756842f},
-std::array<float,2>{0.14613612f, 0.551388323f},
-std::array<float,2>{0.649035215f, 0.338049352f},
-std::array<float,2>{0.614436686f, 0.720757067f},
-std::array<float,2>{0.0994010493f, 0.412915647f},
-std::array<float,2>{0.389783472f, 0.78296417f},
-std::array<float,2>{0.955248952f, 0.248071015f},
-std::array<float,2>{0.909575641f, 0.598015308f},
-std::array<float,2>{0.445526868f, 0.288973153f},
-std::array<float,2>{0.0607452281f, 0.901528537f},
-std::array<float,2>{0.545646966f, 0.0517224073f},
-std::array<float,2>{0.711764336f, 0.838546813f},
-std::array<float,2>{0.19867079f, 0.159181714f},
-std::array<float,2>{0.330752075f, 0.683796585f},
-std::array<float,2>{0.866133511f, 0.476767689f},
-std::array<float,2>{0.994993746f, 0.771030426f},
-std::array<float,2>{0.432551265f, 0.19883506f},
-std::array<float,2>{0.0688132867f, 0.713157296f},
-std::array<float,2>{0.568030059f, 0.378641665f},
-std::array<float,2>{0.684377491f, 0.522189438f},
-std::array<float,2>{0.185146391f, 0.35876748f},
-std::array<float,2>{0.308562219f, 0.988978982f},
-std::array<float,2>{0.807046533f, 0.0641915798f},
-std::array<float,2>{0.832622766f, 0.626469195f},
-std::array<float,2>{0.361840665f, 0.452721745f},
-std::array<float,2>{0.232064202f, 0.844214797f},
-std::array<float,2>{0.722026646f, 0.132286683f},
-std::array<float,2>{0.514648795f, 0.937126935f},
-std::array<float,2>{0.0295384862f, 0.0113031138f},
-std::array<float,2>{0.499165922f, 0.571083605f},
-std::array<float,2>{0.877592027f, 0.271711737f},
-std::array<float,2>{0.900314569f, 0.886787355f},
-std::array<float,2>{0.47826317f, 0.0353155546f},
-std::array<float,2>{0.00148222817f, 0.616385579f},
-std::array<float,2>{0.520274103f, 0.301680684f},
-std::array<float,2>{0.749952793f, 0.659854829f},
-std::array<float,2>{0.24762018f, 0.497481912f},
-std::array<float,2>{0.354398787f, 0.818213284f},
-std::array<float,2>{0.817276895f, 0.175759107f},
-std::array<float,2>{0.784004867f, 0.540539324f},
-std::array<float,2>{0.281926781f, 0.322766989f},
-std::array<float,2>{0.159412116f, 0.944874227f},
-std::array<float,2>{0.661946714f, 0.114961579f},
-std::array<float,2>{0.591063201f, 0.79724443f},
-std::array<float,2>{0.0863524973f, 0.22409445f},
-std::array<float,2>{0.40916571f, 0.74339211f},
-std::array<float,2>{0.972917616f, 0.436779737f},
-std::array<float,2>{0.854985356f, 0.860000134f},
-std::array<float,2>{0.319455773f, 0.142844409f},
-std::array<float,2>{0.212428704f, 0.640921116f},
-std::array<float,2>{0.698475301f, 0.464683414f},
-std::array<float,2>{0.56184411f, 0.587495685f},
-std::array<float,2>{0.0450276285f, 0.253695339f},
-std::array<float,2>{0.462542892f, 0.916128099f},
-std::array<float,2>{0.927973747f, 0.0293143131f},
-std::array<float,2>{0.951438844f, 0.697709084f},
-std::array<float,2>{0.405094355f, 0.393507063f},
-std::array<float,2>{0.112353683f, 0.756025016f},
-std::array<float,2>{0.604772806f, 0.203345984f},
-std::array<float,2>{0.634732842f, 0.983155489f},
-std::array<float,2>{0.129842833f, 0.0878357068f},
-std::array<float,2>{0.262723237f, 0.512591779f},
-std::array<float,2>{0.75338155f, 0.360035807f},
-std::array<float,2>{0.821499646f, 0.906825304f},
-std::array<float,2>{0.351034582f, 0.0225597788f},
-std::array<float,2>{0.241422459f, 0.580518484f},
-std::array<float,2>{0.740376413f, 0.260309696f},
-std::array<float,2>{0.526392579f, 0.652496278f},
-std::array<float,2>{0.0118774846f, 0.458641052f},
-std::array<float,2>{0.472123891f, 0.869133055f},
-std::array<float,2>{0.890679717f, 0.154540002f},
-std::array<float,2>{0.982505739f, 0.507198751f},
-std::array<float,2>{0.421534896f, 0.368467808f},
-std::array<float,2>{0.0854695141f, 0.975899875f},
-std::array<float,2>{0.581583083f, 0.0789972097f},
-std::array<float,2>{0.666050851f, 0.758567452f},
-std::array<float,2>{0.168369383f, 0.214066997f},
-std::array<float,2>{0.295375854f, 0.689960599f},
-std::array<float,2>{0.793563187f, 0.403367907f},
-std::array<float,2>{0.930133045f, 0.825003326f},
-std::array<float,2>{0.45470944f, 0.184789002f},
-std::array<float,2>{0.0383352116f, 0.66821748f},
-std::array<float,2>{0.549635351f, 0.490608782f},
-std::array<float,2>{0.694951534f, 0.621800423f},
-std::array<float,2>{0.210123032f, 0.30688858f},
-std::array<float,2>{0.320583612f, 0.876576424f},
-std::array<float,2>{0.846714556f, 0.0415385365f},
-std::array<float,2>{0.764225662f, 0.736546397f},
-std::array<float,2>{0.250020683f, 0.428973287f},
-std::array<float,2>{0.13674809f, 0.80512619f},
-std::array<float,2>{0.629673898f, 0.230728477f},
-std::array<float,2>{0.600180387f, 0.952149391f},
-std::array<float,2>{0.122533418f, 0.123986371f},
-std::array<float,2>{0.391456306f, 0.534477115f},
-std::array<float,2>{0.937842011f, 0.314375639f},
-std::array<float,2>{0.967765093f, 0.996987581f},
-std::array<float,2>{0.382155955f, 0.0770745724f},
-std::array<float,2>{0.106008485f, 0.52963388f},
-std::array<float,2>{0.622208178f, 0.345731884f},
-std::array<float,2>{0.646882415f, 0.707363307f},
-std::array<float,2>{0.151274413f, 0.383821845f},
-std::array<float,2>{0.26891157f, 0.77362746f},
-std::array<float,2>{0.78068012f, 0.195196524f},
-std::array<float,2>{0.868665457f, 0.564682424f},
-std::array<float,2>{0.34109363f, 0.275060385f},
-std::array<float,2>{0.191032737f, 0.925055206f},
-std::array<float,2>{0.708449364f, 0.00769350491f},
-std::array<float,2>{0.535949647f, 0.856848598f},
-std::array<float,2>{0.0486400984f, 0.139469817f},
-std::array<float,2>{0.441639721f, 0.636086404f},
-std::array<float,2>{0.914815307f, 0.438980192f},
-std::array<float,2>{0.796895087f, 0.792595744f},
-std::array<float,2>{0.30055812f, 0.240367249f},
-std::array<float,2>{0.176230311f, 0.727083981f},
-std::array<float,2>{0.677441001f, 0.419059098f},
-std::array<float,2>{0.577794135f, 0.55814749f},
-std::array<float,2>{0.0750646964f, 0.333012998f},
-std::array<float,2>{0.424405664f, 0.957708895f},
-std::array<float,2>{0.989630461f, 0.0947900712f},
-std::array<float,2>{0.889222264f, 0.672032058f},
-std::array<float,2>{0.484575391f, 0.470041782f},
-std::array<float,2>{0.0205881838f, 0.830206215f},
-std::array<float,2>{0.50722456f, 0.166545436f},
-std::array<float,2>{0.732054472f, 0.897095919f},
-std::array<float,2>{0.223684549f, 0.0557561219f},
-std::array<float,2>{0.371611387f, 0.604326487f},
-std::array<float,2>{0.842918992f, 0.292090386f},
-std::array<float,2>{0.792426527f, 0.904427946f},
-std::array<float,2>{0.292687684f, 0.0502644405f},
-std::array<float,2>{0.165389225f, 0.597477019f},
-std::array<float,2>{0.671287417f, 0.284865707f},
-std::array<float,2>{0.582083702f, 0.68013382f},
-std::array<float,2>{0.0798827708f, 0.484058559f},
-std::array<float,2>{0.416075498f, 0.842756867f},
-std::array<float,2>{0.979847074f, 0.162130401f},
-std::array<float,2>{0.89745605f, 0.550174117f},
-std::array<float,2>{0.472947508f, 0.339969873f},
-std::array<float,2>{0.0101495935f, 0.965820849f},
-std::array<float,2>{0.528550863f, 0.104951665f},
-std::array<float,2>{0.737798691f, 0.785242915f},
-std::array<float,2>{0.23651886f, 0.243970141f},
-std::array<float,2>{0.346233368f, 0.725193977f},
-std::array<float,2>{0.82553345f, 0.407641053f},
-std::array<float,2>{0.94329071f, 0.84945327f},
-std::array<float,2>{0.396335751f, 0.126937762f},
-std::array<float,2>{0.120245218f, 0.632182062f},
-std::array<float,2>{0.59430784f, 0.448563814f},
-std::array<float,2>{0.627785623f, 0.577901244f},
-std::array<float,2>{0.135630757f, 0.266997427f},
-std::array<float,2>{0.255106211f, 0.929972172f},
-std::array<float,2>{0.758084893f, 0.0119972406f},
-std::array<float,2>{0.851538837f, 0.717647254f},
-std::array<float,2>{0.32632038f, 0.379544348f},
-std::array<float,2>{0.205639049f, 0.768019199f},
-std::array<float,2>{0.689713061f, 0.199416339f},
-std::array<float,2>{0.551245511f, 0.988188922f},
-std::array<float,2>{0.0328441225f, 0.068555288f},
-std::array<float,2>{0.460083485f, 0.516130269f},
-std::array<float,2>{0.934292853f, 0.352276027f},
-std::array<float,2>{0.921691298f, 0.940489233f},
-std::array<float,2>{0.437546909f, 0.113083668f},
-std::array<float,2>{0.0528492592f, 0.544908285f},
-std::array<float,2>{0.53136009f, 0.326315254f},
-std::array<float,2>{0.703587174f, 0.747942984f},
-std::array<float,2>{0.192307249f, 0.430709422f},
-std::array<float,2>{0.336254328f, 0.802312315f},
-std::array<float,2>{0.871880412f, 0.221344531f},
-std::array<float,2>{0.775191724f, 0.610691428f},
-std::array<float,2>{0.27339381f, 0.298852444f},
-std::array<float,2>{0.154141203f, 0.883527339f},
-std::array<float,2>{0.644033134f, 0.0315722302f},
-std::array<float,2>{0.618071496f, 0.815582573f},
-std::array<float,2>{0.102785885f, 0.176227838f},
-std::array<float,2>{0.378560781f, 0.66055584f},
-std::array<float,2>{0.963602304f, 0.49488616f},
-std::array<float,2>{0.836065114f, 0.752612472f},
-std::array<float,2>{0.368514091f, 0.210300311f},
-std::array<float,2>{0.219446763f, 0.699985087f},
-std::array<float,2>{0.727426827f, 0.395917296f},
-std::array<float,2>{0.501130462f, 0.510792375f},
-std::array<float,2>{0.0190840885f, 0.364644945f},
-std::array<float,2>{0.491627246f, 0.978620231f},
-std::array<float,2>{0.883862913f, 0.0911194757f},
-std::array<float,2>{0.985457361f, 0.647848666f},
-std::array<float,2>{0.42933619f, 0.468672276f},
-std::array<float,2>{0.0706374198f, 0.866648316f},
-std::array<float,2>{0.572659552f, 0.145112738f},
-std::array<float,2>{0.675709307f, 0.919700444f},
-std::array<float,2>{0.174665228f, 0.0239814725f},
-std::array<float,2>{0.301587313f, 0.590076804f},
-std::array<float,2>{0.80203563f, 0.254311353f},
-std::array<float,2>{0.863048613f, 0.972165167f},
-std::array<float,2>{0.333131105f, 0.0845253468f},
-std::array<float,2>{0.200582296f, 0.502650023f},
-std::array<float,2>{0.718431294f, 0.373152018f},
-std::array<float,2>{0.541207314f, 0.694162726f},
-std::array<float,2>{0.0554718561f, 0.401628524f},
-std::array<float,2>{0.453104705f, 0.764921188f},
-std::array<float,2>{0.912280619f, 0.217033193f},
-std::array<float,2>{0.957733095f, 0.583847106f},
-std::array<float,2>{0.38601777f, 0.263022304f},
-std::array<float,2>{0.0975120664f, 0.91127032f},
-std::array<float,2>{0.610356152f, 0.0179471392f},
-std::array<float,2>{0.654296458f, 0.873762429f},
-std::array<float,2>{0.141763613f, 0.151143372f},
-std::array<float,2>{0.276407123f, 0.65040791f},
-std::array<float,2>{0.770202935f, 0.455448002f},
-std::array<float,2>{0.879241645f, 0.80863589f},
-std::array<float,2>{0.493674368f, 0.22944054f},
-std::array<float,2>{0.0246808548f, 0.740905285f},
-std::array<float,2>{0.510766685f, 0.422888935f},
-std::array<float,2>{0.725331903f, 0.536956906f},
-std::array<float,2>{0.229642719f, 0.318871111f},
-std::array<float,2>{0.36684835f, 0.947886944f},
-std::array<float,2>{0.828978539f, 0.117791623f},
-std::array<float,2>{0.812193155f, 0.667832077f},
-std::array<float,2>{0.310066342f, 0.485333741f},
-std::array<float,2>{0.180276006f, 0.820382476f},
-std::array<float,2>{0.681077302f, 0.181114584f},
-std::array<float,2>{0.564848423f, 0.881954372f},
-std::array<float,2>{0.0651879162f, 0.0449974798f},
-std::array<float,2>{0.43747136f, 0.619483292f},
-std::array<float,2>{0.998451114f, 0.30877465f},
-std::array<float,2>{0.971491873f, 0.927065969f},
-std::array<float,2>{0.411023676f, 0.00172824168f},
-std::array<float,2>{0.0929683968f, 0.570174336f},
-std::array<float,2>{0.58703047f, 0.277845889f},
-std::array<float,2>{0.656304121f, 0.639778912f},
-std::array<float,2>{0.162389562f, 0.441435248f},
-std::array<float,2>{0.288575053f, 0.85462153f},
-std::array<float,2>{0.788227081f, 0.135015309f},
-std::array<float,2>{0.814666808f, 0.524926424f},
-std::array<float,2>{0.355935007f, 0.351020843f},
-std::array<float,2>{0.245163366f, 0.995917797f},
-std::array<float,2>{0.743206859f, 0.0740836784f},
-std::array<float,2>{0.516554177f, 0.779795408f},
-std::array<float,2>{0.00663750665f, 0.190108001f},
-std::array<float,2>{0.480603456f, 0.706416786f},
-std::array<float,2>{0.903699279f, 0.389040172f},
-std::array<float,2>{0.754774988f, 0.8335976f},
-std::array<float,2>{0.259566486f, 0.169450194f},
-std::array<float,2>{0.126435071f, 0.677613497f},
-std::array<float,2>{0.637680352f, 0.476492614f},
-std::array<float,2>{0.609318614f, 0.608974993f},
-std::array<float,2>{0.1152303f, 0.295989603f},
-std::array<float,2>{0.4005633f, 0.892234266f},
-std::array<float,2>{0.946095049f, 0.0586671382f},
-std::array<float,2>{0.924849987f, 0.732440531f},
-std::array<float,2>{0.465133429f, 0.414125592f},
-std::array<float,2>{0.0399217643f, 0.796460509f},
-std::array<float,2>{0.556493223f, 0.234943688f},
-std::array<float,2>{0.7029019f, 0.955978632f},
-std::array<float,2>{0.217416734f, 0.0995447189f},
-std::array<float,2>{0.31520915f, 0.560426176f},
-std::array<float,2>{0.856346309f, 0.330447495f},
-std::array<float,2>{0.805901408f, 0.990802586f},
-std::array<float,2>{0.306051165f, 0.064498812f},
-std::array<float,2>{0.186656624f, 0.520202816f},
-std::array<float,2>{0.685686767f, 0.355987132f},
-std::array<float,2>{0.570180774f, 0.71103698f},
-std::array<float,2>{0.06826289f, 0.375138015f},
-std::array<float,2>{0.430400193f, 0.77293551f},
-std::array<float,2>{0.994043708f, 0.196485326f},
-std::array<float,2>{0.875990629f, 0.573274434f},
-std::array<float,2>{0.496632606f, 0.27101633f},
-std::array<float,2>{0.0291615594f, 0.933968663f},
-std::array<float,2>{0.513526082f, 0.00867785327f},
-std::array<float,2>{0.7189098f, 0.846785009f},
-std::array<float,2>{0.23371093f, 0.129830018f},
-std::array<float,2>{0.359817386f, 0.627528429f},
-std::array<float,2>{0.834393859f, 0.449721992f},
-std::array<float,2>{0.954977989f, 0.784485221f},
-std::array<float,2>{0.388529599f, 0.246664375f},
-std::array<float,2>{0.100088216f, 0.719185591f},
-std::array<float,2>{0.616162956f, 0.412062019f},
-std::array<float,2>{0.651054502f, 0.554208994f},
-std::array<float,2>{0.147638589f, 0.336817026f},
-std::array<float,2>{0.27902317f, 0.962795675f},
-std::array<float,2>{0.766811371f, 0.106977366f},
-std::array<float,2>{0.863438547f, 0.6859079f},
-std::array<float,2>{0.329649895f, 0.478562474f},
-std::array<float,2>{0.19614622f, 0.836794972f},
-std::array<float,2>{0.71464783f, 0.15628998f},
-std::array<float,2>{0.543768048f, 0.898861468f},
-std::array<float,2>{0.0587317944f, 0.0537862889f},
-std::array<float,2>{0.449014366f, 0.601023376f},
-std::array<float,2>{0.906487703f, 0.286550194f},
-std::array<float,2>{0.926425278f, 0.915981948f},
-std::array<float,2>{0.463597894f, 0.0284105949f},
-std::array<float,2>{0.044610057f, 0.588954091f},
-std::array<float,2>{0.558810115f, 0.250313312f},
-std::array<float,2>{0.697176397f, 0.643360794f},
-std::array<float,2>{0.214226872f, 0.461783171f},
-std::array<float,2>{0.317266136f, 0.863183379f},
-std::array<float,2>{0.851629555f, 0.14098148f},
-std::array<float,2>{0.750247419f, 0.514287829f},
-std::array<float,2>{0.263859689f, 0.362399071f},
-std::array<float,2>{0.131149247f, 0.982420504f},
-std::array<float,2>{0.635501027f, 0.088522017f},
-std::array<float,2>{0.602773964f, 0.755123675f},
-std::array<float,2>{0.110602401f, 0.206257701f},
-std::array<float,2>{0.403142959f, 0.695464194f},
-std::array<float,2>{0.950595498f, 0.390732288f},
-std::array<float,2>{0.818856835f, 0.819244504f},
-std::array<float,2>{0.351941794f, 0.172063053f},
-std::array<float,2>{0.248841375f, 0.656514943f},
-std::array<float,2>{0.746569216f, 0.499636561f},
-std::array<float,2>{0.52326107f, 0.614813268f},
-std::array<float,2>{0.00223163166f, 0.303569019f},
-std::array<float,2>{0.480261713f, 0.888834417f},
-std::array<float,2>{0.901863396f, 0.0376838036f},
-std::array<float,2>{0.975400805f, 0.746002197f},
-std::array<float,2>{0.407439977f, 0.43385604f},
-std::array<float,2>{0.0892671943f, 0.799536943f},
-std::array<float,2>{0.592232168f, 0.225627318f},
-std::array<float,2>{0.662324607f, 0.941420078f},
-std::array<float,2>{0.157833174f, 0.115689285f},
-std::array<float,2>{0.283509225f, 0.541055381f},
-std::array<float,2>{0.782295048f, 0.320679128f},
-std::array<float,2>{0.843763053f, 0.878204346f},
-std::array<float,2>{0.323576272f, 0.040841978f},
-std::array<float,2>{0.208809838f, 0.623466253f},
-std::array<float,2>{0.691990495f, 0.30579102f},
-std::array<float,2>{0.548042178f, 0.67149812f},
-std::array<float,2>{0.0366933383f, 0.488626957f},
-std::array<float,2>{0.456003398f, 0.826614559f},
-std::array<float,2>{0.931912899f, 0.187336862f},
-std::array<float,2>{0.941250563f, 0.53135103f},
-std::array<float,2>{0.39357844f, 0.315784425f},
-std::array<float,2>{0.124480046f, 0.951081634f},
-std::array<float,2>{0.598850667f, 0.122170083f},
-std::array<float,2>{0.632236004f, 0.807266414f},
-std::array<float,2>{0.13996765f, 0.233687714f},
-std::array<float,2>{0.252238631f, 0.734969258f},
-std::array<float,2>{0.763349891f, 0.426555604f},
-std::array<float,2>{0.893747449f, 0.869647622f},
-std::array<float,2>{0.469016105f, 0.153607473f},
-std::array<float,2>{0.0149344662f, 0.654436886f},
-std::array<float,2>{0.524812818f, 0.460472286f},
-std::array<float,2>{0.73990798f, 0.579392612f},
-std::array<float,2>{0.239187643f, 0.259361237f},
-std::array<float,2>{0.348308712f, 0.908843756f},
-std::array<float,2>{0.823070228f, 0.0205004495f},
-std::array<float,2>{0.795391381f, 0.689283431f},
-std::array<float,2>{0.294811755f, 0.404915929f},
-std::array<float,2>{0.170736507f, 0.760607362f},
-std::array<float,2>{0.664833367f, 0.211495116f},
-std::array<float,2>{0.578687847f, 0.97401005f},
-std::array<float,2>{0.0834409446f, 0.0801849738f},
-std::array<float,2>{0.418992162f, 0.505281866f},
-std::array<float,2>{0.981636643f, 0.369692951f},
-std::array<float,2>{0.991312861f, 0.960182607f},
-std::array<float,2>{0.423321038f, 0.0974226072f},
-std::array<float,2>{0.0773444697f, 0.554826498f},
-std::array<float,2>{0.574930668f, 0.334862381f},
-std::array<float,2>{0.679456055f, 0.729381204f},
-std::array<float,2>{0.179229543f, 0.420234829f},
-std::array<float,2>{0.297615975f, 0.790562093f},
-std::array<float,2>{0.799814939f, 0.240021989f},
-std::array<float,2>{0.840793729f, 0.602952182f},
-std::array<float,2>{0.374057919f, 0.290533692f},
-std::array<float,2>{0.225748301f, 0.896444619f},
-std::array<float,2>{0.73319006f, 0.0580861978f},
-std::array<float,2>{0.505245805f, 0.82952708f},
-std::array<float,2>{0.0216553118f, 0.165401742f},
-std::array<float,2>{0.487951398f, 0.674881697f},
-std::array<float,2>{0.887728035f, 0.472306967f},
-std::array<float,2>{0.778600693f, 0.775883377f},
-std::array<float,2>{0.265737474f, 0.191790655f},
-std::array<float,2>{0.148452491f, 0.709595621f},
-std::array<float,2>{0.64455539f, 0.386169046f},
-std::array<float,2>{0.624856055f, 0.528481483f},
-std::array<float,2>{0.10768941f, 0.344557673f},
-std::array<float,2>{0.379823565f, 0.998559594f},
-std::array<float,2>{0.965956628f, 0.0760973468f},
-std::array<float,2>{0.916463912f, 0.634218991f},
-std::array<float,2>{0.443586916f, 0.440256506f},
-std::array<float,2>{0.0491304137f, 0.857426584f},
-std::array<float,2>{0.537371278f, 0.138389319f},
-std::array<float,2>{0.709190369f, 0.922726095f},
-std::array<float,2>{0.188422039f, 0.00467749825f},
-std::array<float,2>{0.34242925f, 0.564364493f},
-std::array<float,2>{0.869169235f, 0.275605649f},
-std::array<float,2>{0.760033369f, 0.932436705f},
-std::array<float,2>{0.256579429f, 0.0138604408f},
-std::array<float,2>{0.133226499f, 0.574466169f},
-std::array<float,2>{0.626445472f, 0.269462377f},
-std::array<float,2>{0.597260833f, 0.630032957f},
-std::array<float,2>{0.117594063f, 0.446941853f},
-std::array<float,2>{0.396593451f, 0.849871635f},
-std::array<float,2>{0.943707645f, 0.128277063f},
-std::array<float,2>{0.936662614f, 0.519427419f},
-std::array<float,2>{0.45737043f, 0.354472011f},
-std::array<float,2>{0.0347698554f, 0.984895885f},
-std::array<float,2>{0.552945852f, 0.0668945163f},
-std::array<float,2>{0.689264238f, 0.765956342f},
-std::array<float,2>{0.20436807f, 0.201507881f},
-std::array<float,2>{0.324640155f, 0.715680182f},
-std::array<float,2>{0.847671926f, 0.380959123f},
-std::array<float,2>{0.977567255f, 0.841583967f},
-std::array<float,2>{0.414693624f, 0.160689279f},
-std::array<float,2>{0.0814589933f, 0.683050215f},
-std::array<float,2>{0.584328413f, 0.480491698f},
-std::array<float,2>{0.668197513f, 0.59464848f},
-std::array<float,2>{0.167387977f, 0.283180743f},
-std::array<float,2>{0.290109158f, 0.903986394f},
-std::array<float,2>{0.790213346f, 0.0474516451f},
-std::array<float,2>{0.826427102f, 0.723272026f},
-std::array<float,2>{0.345556706f, 0.408222854f},
-std::array<float,2>{0.236164272f, 0.788195789f},
-std::array<float,2>{0.735521317f, 0.244517997f},
-std::array<float,2>{0.529861033f, 0.968604088f},
-std::array<float,2>{0.00790299568f, 0.102165908f},
-std::array<float,2>{0.474885881f, 0.548664212f},
-std::array<float,2>{0.895082116f, 0.342131168f},
-std::array<float,2>{0.885896087f, 0.976896644f},
-std::array<float,2>{0.489352554f, 0.0928434432f},
-std::array<float,2>{0.0161778238f, 0.507883549f},
-std::array<float,2>{0.502914131f, 0.366974235f},
-std::array<float,2>{0.730005503f, 0.702575386f},
-std::array<float,2>{0.222017691f, 0.398206353f},
-std::array<float,2>{0.370482355f, 0.750617206f},
-std::array<float,2>{0.838270605f, 0.20816803f},
-std::array<float,2>{0.803557575f, 0.592493415f},
-std::array<float,2>{0.304031014f, 0.257300258f},
-std::array<float,2>{0.173330948f, 0.921450853f},
-std::array<float,2>{0.673036039f, 0.027151173f},
-std::array<float,2>{0.571633399f, 0.865162313f},
-std::array<float,2>{0.0726024657f, 0.146587595f},
-std::array<float,2>{0.427634299f, 0.645911634f},
-std::array<float,2>{0.987384617f, 0.466113627f},
-std::array<float,2>{0.874053538f, 0.8032974f},
-std::array<float,2>{0.338032067f, 0.219784334f},
-std::array<float,2>{0.194156975f, 0.749307275f},
-std::array<float,2>{0.706585765f, 0.433217734f},
-std::array<float,2>{0.534746587f, 0.546365499f},
-std::array<float,2>{0.0525025427f, 0.324817181f},
-std::array<float,2>{0.440684408f, 0.939310014f},
-std::array<float,2>{0.919278443f, 0.10970401f},
-std::array<float,2>{0.96265763f, 0.66222012f},
-std::array<float,2>{0.375633031f, 0.493249059f},
-std::array<float,2>{0.104321599f, 0.813523412f},
-std::array<float,2>{0.620392799f, 0.178414688f},
-std::array<float,2>{0.641421676f, 0.88671124f},
-std::array<float,2>{0.154803306f, 0.0335047506f},
-std::array<float,2>{0.271443725f, 0.611727476f},
-std::array<float,2>{0.777321696f, 0.298071116f},
-std::array<float,2>{0.831058204f, 0.94534719f},
-std::array<float,2>{0.36485076f, 0.119191036f},
-std::array<float,2>{0.227496967f, 0.538278997f},
-std::array<float,2>{0.723633707f, 0.316567212f},
-std::array<float,2>{0.509381413f, 0.738977075f},
-std::array<float,2>{0.0264744703f, 0.424042732f},
-std::array<float,2>{0.495142609f, 0.81142801f},
-std::array<float,2>{0.881220818f, 0.226941794f},
-std::array<float,2>{0.996700644f, 0.618107319f},
-std::array<float,2>{0.434380412f, 0.31162551f},
-std::array<float,2>{0.0640386567f, 0.879724622f},
-std::array<float,2>{0.563333809f, 0.0444825962f},
-std::array<float,2>{0.68254143f, 0.823648691f},
-std::array<float,2>{0.18196997f, 0.18301101f},
-std::array<float,2>{0.311315507f, 0.665995479f},
-std::array<float,2>{0.808705568f, 0.488087535f},
-std::array<float,2>{0.911169112f, 0.762989581f},
-std::array<float,2>{0.450319618f, 0.21491392f},
-std::array<float,2>{0.056898661f, 0.693062901f},
-std::array<float,2>{0.540092349f, 0.398626149f},
-std::array<float,2>{0.716730177f, 0.500862002f},
-std::array<float,2>{0.201363489f, 0.372541755f},
-std::array<float,2>{0.334359497f, 0.970447421f},
-std::array<float,2>{0.860198319f, 0.0822520033f},
-std::array<float,2>{0.772590339f, 0.648829043f},
-std::array<float,2>{0.274233907f, 0.453801215f},
-std::array<float,2>{0.143494785f, 0.872207463f},
-std::array<float,2>{0.654657662f, 0.149464086f},
-std::array<float,2>{0.613135278f, 0.912299871f},
-std::array<float,2>{0.0953203291f, 0.0170406215f},
-std::array<float,2>{0.384293854f, 0.584039927f},
-std::array<float,2>{0.960116029f, 0.264667869f},
-std::array<float,2>{0.947409868f, 0.893084049f},
-std::array<float,2>{0.398694307f, 0.0608644448f},
-std::array<float,2>{0.116311826f, 0.605705619f},
-std::array<float,2>{0.606256545f, 0.293225914f},
-std::array<float,2>{0.64008069f, 0.679050446f},
-std::array<float,2>{0.127666026f, 0.47280845f},
-std::array<float,2>{0.260394216f, 0.834606528f},
-std::array<float,2>{0.755913675f, 0.170260683f},
-std::array<float,2>{0.859226346f, 0.561162293f},
-std::array<float,2>{0.314183414f, 0.329501688f},
-std::array<float,2>{0.215569273f, 0.954248965f},
-std::array<float,2>{0.700928032f, 0.0999129638f},
-std::array<float,2>{0.556673765f, 0.794148088f},
-std::array<float,2>{0.0427351594f, 0.236830711f},
-std::array<float,2>{0.468745828f, 0.730847418f},
-std::array<float,2>{0.923172772f, 0.417838186f},
-std::array<float,2>{0.785748005f, 0.851575553f},
-std::array<float,2>{0.286641419f, 0.133380011f},
-std::array<float,2>{0.161531597f, 0.637164354f},
-std::array<float,2>{0.659829438f, 0.443648309f},
-std::array<float,2>{0.588024378f, 0.566407919f},
-std::array<float,2>{0.0916533843f, 0.280498445f},
-std::array<float,2>{0.412579298f, 0.928656578f},
-std::array<float,2>{0.969658196f, 0.00210673013f},
-std::array<float,2>{0.904490113f, 0.703997374f},
-std::array<float,2>{0.48386246f, 0.387667f},
-std::array<float,2>{0.00525374804f, 0.778088391f},
-std::array<float,2>{0.519484222f, 0.189411059f},
-std::array<float,2>{0.745606482f, 0.993709326f},
-std::array<float,2>{0.244021013f, 0.0703142583f},
-std::array<float,2>{0.357773721f, 0.527130902f},
-std::array<float,2>{0.813875258f, 0.348433167f},
-std::array<float,2>{0.781484127f, 0.943971217f},
-std::array<float,2>{0.284392804f, 0.113329411f},
-std::array<float,2>{0.157087356f, 0.53998059f},
-std::array<float,2>{0.663489103f, 0.324051678f},
-std::array<float,2>{0.592940986f, 0.742571414f},
-std::array<float,2>{0.0885274708f, 0.436493188f},
-std::array<float,2>{0.406723201f, 0.798188269f},
-std::array<float,2>{0.975981772f, 0.22294724f},
-std::array<float,2>{0.900938034f, 0.615464985f},
-std::array<float,2>{0.478616089f, 0.301931113f},
-std::array<float,2>{0.00308090169f, 0.888623893f},
-std::array<float,2>{0.521518707f, 0.0361538939f},
-std::array<float,2>{0.747778594f, 0.817219555f},
-std::array<float,2>{0.24931702f, 0.174415246f},
-std::array<float,2>{0.352928162f, 0.658734381f},
-std::array<float,2>{0.819590211f, 0.49628064f},
-std::array<float,2>{0.949915528f, 0.757281303f},
-std::array<float,2>{0.40405038f, 0.204725191f},
-std::array<float,2>{0.110090442f, 0.699060559f},
-std::array<float,2>{0.602044642f, 0.393580794f},
-std::array<float,2>{0.636523068f, 0.513338685f},
-std::array<float,2>{0.131887138f, 0.360538453f},
-std::array<float,2>{0.26495409f, 0.984005749f},
-std::array<float,2>{0.751146734f, 0.0864081457f},
-std::array<float,2>{0.853055954f, 0.642179489f},
-std::array<float,2>{0.317473382f, 0.463102132f},
-std::array<float,2>{0.21360521f, 0.861023366f},
-std::array<float,2>{0.696215212f, 0.144040227f},
-std::array<float,2>{0.56000042f, 0.917551637f},
-std::array<float,2>{0.0438535847f, 0.0310189445f},
-std::array<float,2>{0.464507997f, 0.586598158f},
-std::array<float,2>{0.927415788f, 0.252495676f},
-std::array<float,2>{0.907869756f, 0.900908649f},
-std::array<float,2>{0.448195636f, 0.0519045666f},
-std::array<float,2>{0.0599829257f, 0.598760903f},
-std::array<float,2>{0.544470429f, 0.287665844f},
-std::array<float,2>{0.713045537f, 0.685122013f},
-std::array<float,2>{0.196428224f, 0.478215098f},
-std::array<float,2>{0.329043925f, 0.839314103f},
-std::array<float,2>{0.864599705f, 0.158881485f},
-std::array<float,2>{0.765731335f, 0.551925063f},
-std::array<float,2>{0.277728289f, 0.338893384f},
-std::array<float,2>{0.147066206f, 0.963612735f},
-std::array<float,2>{0.651937306f, 0.109238856f},
-std::array<float,2>{0.616352975f, 0.781264603f},
-std::array<float,2>{0.101383671f, 0.249171063f},
-std::array<float,2>{0.387017787f, 0.722099721f},
-std::array<float,2>{0.953418553f, 0.413400561f},
-std::array<float,2>{0.835358381f, 0.844886541f},
-std::array<float,2>{0.361289501f, 0.130973801f},
-std::array<float,2>{0.233367711f, 0.625552297f},
-std::array<float,2>{0.720347047f, 0.451813549f},
-std::array<float,2>{0.512017369f, 0.571492791f},
-std::array<float,2>{0.0278232992f, 0.272958368f},
-std::array<float,2>{0.497778803f, 0.935913563f},
-std::array<float,2>{0.875593245f, 0.0100433445f},
-std::array<float,2>{0.992324293f, 0.714056015f},
-std::array<float,2>{0.431167215f, 0.377542317f},
-std::array<float,2>{0.0673713014f, 0.769728899f},
-std::array<float,2>{0.56925422f, 0.197412163f},
-std::array<float,2>{0.686937749f, 0.990208924f},
-std::array<float,2>{0.186080605f, 0.0631738305f},
-std::array<float,2>{0.305090278f, 0.522770107f},
-std::array<float,2>{0.80561322f, 0.357665539f},
-std::array<float,2>{0.87087822f, 0.924265325f},
-std::array<float,2>{0.343298435f, 0.00596585823f},
-std::array<float,2>{0.1891817f, 0.566380739f},
-std::array<float,2>{0.710682631f, 0.273537189f},
-std::array<float,2>{0.538856626f, 0.634885848f},
-std::array<float,2>{0.0501438081f, 0.43783474f},
-std::array<float,2>{0.444392383f, 0.855794072f},
-std::array<float,2>{0.917204499f, 0.140099943f},
-std::array<float,2>{0.965701282f, 0.530777931f},
-std::array<float,2>{0.380179912f, 0.347107083f},
-std::array<float,2>{0.109079905f, 0.997386932f},
-std::array<float,2>{0.623577774f, 0.0778714418f},
-std::array<float,2>{0.64582777f, 0.775332332f},
-std::array<float,2>{0.149685264f, 0.193544999f},
-std::array<float,2>{0.266658187f, 0.708532393f},
-std::array<float,2>{0.77779597f, 0.383363754f},
-std::array<float,2>{0.887323618f, 0.831701756f},
-std::array<float,2>{0.486373901f, 0.167358324f},
-std::array<float,2>{0.0233055092f, 0.672866642f},
-std::array<float,2>{0.504444659f, 0.468836248f},
-std::array<float,2>{0.734323144f, 0.604936063f},
-std::array<float,2>{0.224803761f, 0.291394323f},
-std::array<float,2>{0.37342146f, 0.897906959f},
-std::array<float,2>{0.841098428f, 0.0553945266f},
-std::array<float,2>{0.799757779f, 0.728193343f},
-std::array<float,2>{0.297918051f, 0.418704063f},
-std::array<float,2>{0.178006306f, 0.791059434f},
-std::array<float,2>{0.677792907f, 0.24184072f},
-std::array<float,2>{0.575642526f, 0.958973408f},
-std::array<float,2>{0.0769023746f, 0.0940801576f},
-std::array<float,2>{0.422653526f, 0.556647718f},
-std::array<float,2>{0.990690708f, 0.332053691f},
-std::array<float,2>{0.980471075f, 0.975067079f},
-std::array<float,2>{0.418621004f, 0.0795050636f},
-std::array<float,2>{0.0824005455f, 0.506133676f},
-std::array<float,2>{0.579620779f, 0.368101835f},
-std::array<float,2>{0.665160298f, 0.691161036f},
-std::array<float,2>{0.171190962f, 0.402858138f},
-std::array<float,2>{0.293009907f, 0.759144783f},
-std::array<float,2>{0.796788871f, 0.2137658f},
-std::array<float,2>{0.823827267f, 0.581453681f},
-std::array<float,2>{0.3494232f, 0.260796756f},
-std::array<float,2>{0.239802912f, 0.9080562f},
-std::array<float,2>{0.738557756f, 0.0221626479f},
-std::array<float,2>{0.523968101f, 0.867903352f},
-std::array<float,2>{0.0142612038f, 0.155299157f},
-std::array<float,2>{0.469954699f, 0.653552711f},
-std::array<float,2>{0.893185258f, 0.457199544f},
-std::array<float,2>{0.76177901f, 0.806320727f},
-std::array<float,2>{0.253090799f, 0.232020646f},
-std::array<float,2>{0.139492646f, 0.7381441f},
-std::array<float,2>{0.631694853f, 0.428609818f},
-std::array<float,2>{0.598144352f, 0.533658445f},
-std::array<float,2>{0.123315081f, 0.313261032f},
-std::array<float,2>{0.393080235f, 0.951709628f},
-std::array<float,2>{0.940025508f, 0.124348074f},
-std::array<float,2>{0.932815552f, 0.669250488f},
-std::array<float,2>{0.456471324f, 0.491283864f},
-std::array<float,2>{0.0354142822f, 0.825860977f},
-std::array<float,2>{0.547472715f, 0.18421644f},
-std::array<float,2>{0.692449808f, 0.875074506f},
-std::array<float,2>{0.207142457f, 0.0429569371f},
-std::array<float,2>{0.322639197f, 0.62301141f},
-std::array<float,2>{0.845456779f, 0.307620943f},
-std::array<float,2>{0.775543988f, 0.884280562f},
-std::array<float,2>{0.27038011f, 0.0328174569f},
-std::array<float,2>{0.15528135f, 0.610001922f},
-std::array<float,2>{0.642046034f, 0.300649017f},
-std::array<float,2>{0.619268894f, 0.661166012f},
-std::array<float,2>{0.104638152f, 0.49606967f},
-std::array<float,2>{0.376080185f, 0.814789832f},
-std::array<float,2>{0.961017132f, 0.177179411f},
-std::array<float,2>{0.91871959f, 0.54329896f},
-std::array<float,2>{0.440211475f, 0.3276456f},
-std::array<float,2>{0.0515627675f, 0.939504623f},
-std::array<float,2>{0.533518255f, 0.111525245f},
-std::array<float,2>{0.70511055f, 0.801509738f},
-std::array<float,2>{0.194581568f, 0.222147852f},
-std::array<float,2>{0.339502513f, 0.746109366f},
-std::array<float,2>{0.873067975f, 0.430301756f},
-std::array<float,2>{0.987259507f, 0.866007507f},
-std::array<float,2>{0.426751435f, 0.145976678f},
-std::array<float,2>{0.0736752898f, 0.646567941f},
-std::array<float,2>{0.570621967f, 0.466897786f},
-std::array<float,2>{0.671978831f, 0.590873241f},
-std::array<float,2>{0.172308147f, 0.255394876f},
-std::array<float,2>{0.303062886f, 0.918847442f},
-std::array<float,2>{0.803814709f, 0.025150774f},
-std::array<float,2>{0.839573443f, 0.701071501f},
-std::array<float,2>{0.369621396f, 0.394895494f},
-std::array<float,2>{0.221610293f, 0.753222406f},
-std::array<float,2>{0.72904855f, 0.209545195f},
-std::array<float,2>{0.50300318f, 0.980303526f},
-std::array<float,2>{0.0175262354f, 0.0906151682f},
-std::array<float,2>{0.488369375f, 0.51067549f},
-std::array<float,2>{0.885685086f, 0.363455981f},
-std::array<float,2>{0.896203816f, 0.965420067f},
-std::array<float,2>{0.475991935f, 0.104255378f},
-std::array<float,2>{0.00966126658f, 0.549038053f},
-std::array<float,2>{0.530619502f, 0.341446102f},
-std::array<float,2>{0.735051155f, 0.725986481f},
-std::array<float,2>{0.235117659f, 0.4067339f},
-std::array<float,2>{0.343907893f, 0.786695242f},
-std::array<float,2>{0.827823102f, 0.242240354f},
-std::array<float,2>{0.789282203f, 0.59601897f},
-std::array<float,2>{0.289241195f, 0.284042537f},
-std::array<float,2>{0.166033626f, 0.906235337f},
-std::array<float,2>{0.669407904f, 0.0491399616f},
-std::array<float,2>{0.585743546f, 0.843396485f},
-std::array<float,2>{0.0803251192f, 0.163113877f},
-std::array<float,2>{0.415344745f, 0.680682957f},
-std::array<float,2>{0.976649225f, 0.482815415f},
-std::array<float,2>{0.849578023f, 0.769391358f},
-std::array<float,2>{0.326132894f, 0.200778902f},
-std::array<float,2>{0.203404322f, 0.718073785f},
-std::array<float,2>{0.687762678f, 0.380615801f},
-std::array<float,2>{0.554041743f, 0.517432749f},
-std::array<float,2>{0.0338801928f, 0.352772355f},
-std::array<float,2>{0.458764493f, 0.986369491f},
-std::array<float,2>{0.936332941f, 0.0693760216f},
-std::array<float,2>{0.944709599f, 0.630966842f},
-std::array<float,2>{0.397981197f, 0.448165894f},
-std::array<float,2>{0.118901379f, 0.848194957f},
-std::array<float,2>{0.596223593f, 0.125041664f},
-std::array<float,2>{0.625100851f, 0.930760086f},
-std::array<float,2>{0.13400121f, 0.0132134724f},
-std::array<float,2>{0.25721243f, 0.576436043f},
-std::array<float,2>{0.760823786f, 0.266105533f},
-std::array<float,2>{0.813306928f, 0.994608045f},
-std::array<float,2>{0.358986318f, 0.0724589303f},
-std::array<float,2>{0.242452279f, 0.52395618f},
-std::array<float,2>{0.744540095f, 0.349969923f},
-std::array<float,2>{0.517707348f, 0.705248535f},
-std::array<float,2>{0.00484257424f, 0.390580028f},
-std::array<float,2>{0.482748955f, 0.780292332f},
-std::array<float,2>{0.906138361f, 0.190995693f},
-std::array<float,2>{0.970537782f, 0.568867207f},
-std::array<float,2>{0.413347751f, 0.278856486f},
-std::array<float,2>{0.0902058482f, 0.926139176f},
-std::array<float,2>{0.589782715f, 0.000910747214f},
-std::array<float,2>{0.658749282f, 0.853695989f},
-std::array<float,2>{0.160290256f, 0.136594579f},
-std::array<float,2>{0.285864085f, 0.638895154f},
-std::array<float,2>{0.786456764f, 0.442847282f},
-std::array<float,2>{0.922303498f, 0.795015514f},
-std::array<float,2>{0.466823071f, 0.235995874f},
-std::array<float,2>{0.0411508642f, 0.733769119f},
-std::array<float,2>{0.558317661f, 0.415631592f},
-std::array<float,2>{0.699707448f, 0.559102297f},
-std::array<float,2>{0.21670942f, 0.33203122f},
-std::array<float,2>{0.313469529f, 0.956240356f},
-std::array<float,2>{0.857961595f, 0.0980429277f},
-std::array<float,2>{0.757285237f, 0.676502645f},
-std::array<float,2>{0.260779738f, 0.474884361f},
-std::array<float,2>{0.128068835f, 0.832238913f},
-std::array<float,2>{0.639366508f, 0.168351531f},
-std::array<float,2>{0.607348323f, 0.890713274f},
-std::array<float,2>{0.115871146f, 0.0599518903f},
-std::array<float,2>{0.399743319f, 0.607757986f},
-std::array<float,2>{0.948899865f, 0.295254588f},
-std::array<float,2>{0.959926069f, 0.910589755f},
-std::array<float,2>{0.38332814f, 0.0186443999f},
-std::array<float,2>{0.0943689123f, 0.582879603f},
-std::array<float,2>{0.611536682f, 0.261940002f},
-std::array<float,2>{0.655494332f, 0.652085364f},
-std::array<float,2>{0.144519076f, 0.456769079f},
-std::array<float,2>{0.274990231f, 0.874213517f},
-std::array<float,2>{0.771697283f, 0.151445985f},
-std::array<float,2>{0.860496461f, 0.503902256f},
-std::array<float,2>{0.335885435f, 0.374876171f},
-std::array<float,2>{0.202303857f, 0.97100544f},
-std::array<float,2>{0.715482593f, 0.0852926746f},
-std::array<float,2>{0.539549828f, 0.764475405f},
-std::array<float,2>{0.0577924252f, 0.217957675f},
-std::array<float,2>{0.449333042f, 0.694756091f},
-std::array<float,2>{0.910700619f, 0.400955856f},
-std::array<float,2>{0.809665799f, 0.821906447f},
-std::array<float,2>{0.311787635f, 0.17968981f},
-std::array<float,2>{0.18269591f, 0.666140437f},
-std::array<float,2>{0.68346411f, 0.485532969f},
-std::array<float,2>{0.564416826f, 0.621054471f},
-std::array<float,2>{0.0628964975f, 0.31042704f},
-std::array<float,2>{0.435207963f, 0.88112092f},
-std::array<float,2>{0.997176766f, 0.04674327f},
-std::array<float,2>{0.882420659f, 0.741332948f},
-std::array<float,2>{0.494548231f, 0.422087312f},
-std::array<float,2>{0.026029516f, 0.809992194f},
-std::array<float,2>{0.508756876f, 0.230178371f},
-std::array<float,2>{0.722708106f, 0.948320746f},
-std::array<float,2>{0.227586851f, 0.118354738f},
-std::array<float,2>{0.364166558f, 0.536057413f},
-std::array<float,2>{0.830420256f, 0.319998115f},
-std::array<float,2>{0.752297759f, 0.981436431f},
-std::array<float,2>{0.262244105f, 0.0895143226f},
-std::array<float,2>{0.130848452f, 0.514795899f},
-std::array<float,2>{0.632876396f, 0.361772478f},
-std::array<float,2>{0.604357064f, 0.69718045f},
-std::array<float,2>{0.111377493f, 0.392522484f},
-std::array<float,2>{0.405639321f, 0.754803121f},
-std::array<float,2>{0.952617228f, 0.205199465f},
-std::array<float,2>{0.929666758f, 0.588153362f},
-std::array<float,2>{0.461160511f, 0.251612335f},
-std::array<float,2>{0.0468295254f, 0.914902389f},
-std::array<float,2>{0.561276615f, 0.0281541105f},
-std::array<float,2>{0.697526634f, 0.861745834f},
-std::array<float,2>{0.211000711f, 0.142299473f},
-std::array<float,2>{0.319267392f, 0.643671155f},
-std::array<float,2>{0.854455948f, 0.461961001f},
-std::array<float,2>{0.974264205f, 0.800425768f},
-std::array<float,2>{0.410048753f, 0.224702895f},
-std::array<float,2>{0.0870389491f, 0.745026767f},
-std::array<float,2>{0.590115488f, 0.435269892f},
-std::array<float,2>{0.660333872f, 0.542374372f},
-std::array<float,2>{0.158553049f, 0.321527869f},
-std::array<float,2>{0.282544553f, 0.943336606f},
-std::array<float,2>{0.784820497f, 0.116694406f},
-std::array<float,2>{0.81831634f, 0.658064127f},
-std::array<float,2>{0.354968011f, 0.49891293f},
-std::array<float,2>{0.246278316f, 0.819792926f},
-std::array<float,2>{0.748484969f, 0.17315264f},
-std::array<float,2>{0.521228254f, 0.89041847f},
-std::array<float,2>{2.9858079e-06f, 0.0390280597f},
-std::array<float,2>{0.477344781f, 0.613327742f},
-std::array<float,2>{0.898651898f, 0.304401159f},
-std::array<float,2>{0.878152668f, 0.935456336f},
-std::array<float,2>{0.498656392f, 0.00941158179f},
-std::array<float,2>{0.0309363492f, 0.572407484f},
-std::array<float,2>{0.514289498f, 0.27037707f},
-std::array<float,2>{0.7212767f, 0.628368556f},
-std::array<float,2>{0.231363907f, 0.450258523f},
-std::array<float,2>{0.36267215f, 0.845996022f},
-std::array<float,2>{0.833024204f, 0.130569071f},
-std::array<float,2>{0.808344543f, 0.521158814f},
-std::array<float,2>{0.306965142f, 0.356657475f},
-std::array<float,2>{0.184106901f, 0.991958737f},
-std::array<float,2>{0.685059369f, 0.0656297728f},
-std::array<float,2>{0.566925645f, 0.772334516f},
-std::array<float,2>{0.0695099905f, 0.196025565f},
-std::array<float,2>{0.433465779f, 0.712006629f},
-std::array<float,2>{0.995497882f, 0.376632214f},
-std::array<float,2>{0.86658287f, 0.83778739f},
-std::array<float,2>{0.33144775f, 0.158090919f},
-std::array<float,2>{0.197745755f, 0.686754405f},
-std::array<float,2>{0.712253869f, 0.479700953f},
-std::array<float,2>{0.546230614f, 0.599697828f},
-std::array<float,2>{0.0622189231f, 0.285840362f},
-std::array<float,2>{0.446402222f, 0.899475694f},
-std::array<float,2>{0.908634782f, 0.0529237501f},
-std::array<float,2>{0.956515014f, 0.720360398f},
-std::array<float,2>{0.389158189f, 0.410906494f},
-std::array<float,2>{0.0979580805f, 0.783834398f},
-std::array<float,2>{0.61405772f, 0.247552603f},
-std::array<float,2>{0.649595737f, 0.961589277f},
-std::array<float,2>{0.144974962f, 0.106321685f},
-std::array<float,2>{0.281236351f, 0.55296278f},
-std::array<float,2>{0.769083858f, 0.337171882f},
-std::array<float,2>{0.842660725f, 0.895063162f},
-std::array<float,2>{0.372862697f, 0.0570528321f},
-std::array<float,2>{0.223491862f, 0.602512598f},
-std::array<float,2>{0.730856597f, 0.289709747f},
-std::array<float,2>{0.506009996f, 0.674453914f},
-std::array<float,2>{0.0204840712f, 0.471056998f},
-std::array<float,2>{0.48562941f, 0.828921378f},
-std::array<float,2>{0.890031576f, 0.164230824f},
-std::array<float,2>{0.988347769f, 0.556157351f},
-std::array<float,2>{0.425649375f, 0.335738301f},
-std::array<float,2>{0.0759009346f, 0.959096193f},
-std::array<float,2>{0.577007532f, 0.0964323878f},
-std::array<float,2>{0.676546395f, 0.789611399f},
-std::array<float,2>{0.177274913f, 0.238369733f},
-std::array<float,2>{0.299712062f, 0.730466247f},
-std::array<float,2>{0.798742414f, 0.421724349f},
-std::array<float,2>{0.915899038f, 0.85895586f},
-std::array<float,2>{0.443193108f, 0.136779755f},
-std::array<float,2>{0.0470550731f, 0.633013725f},
-std::array<float,2>{0.536692619f, 0.441394031f},
-std::array<float,2>{0.707174122f, 0.563120842f},
-std::array<float,2>{0.189708412f, 0.276782632f},
-std::array<float,2>{0.340141207f, 0.923796654f},
-std::array<float,2>{0.867484629f, 0.00511707785f},
-std::array<float,2>{0.779997289f, 0.710471809f},
-std::array<float,2>{0.267869681f, 0.385128438f},
-std::array<float,2>{0.151816413f, 0.776592553f},
-std::array<float,2>{0.647554994f, 0.192898273f},
-std::array<float,2>{0.621878386f, 0.999740839f},
-std::array<float,2>{0.107187375f, 0.0748771429f},
-std::array<float,2>{0.381753564f, 0.527576447f},
-std::array<float,2>{0.968528509f, 0.344781339f},
-std::array<float,2>{0.938722253f, 0.949439883f},
-std::array<float,2>{0.392263919f, 0.121529453f},
-std::array<float,2>{0.121256866f, 0.533116281f},
-std::array<float,2>{0.600766718f, 0.314658999f},
-std::array<float,2>{0.630649924f, 0.736179769f},
-std::array<float,2>{0.137748986f, 0.427260518f},
-std::array<float,2>{0.251005709f, 0.808115423f},
-std::array<float,2>{0.765235245f, 0.232768983f},
-std::array<float,2>{0.846107185f, 0.624512076f},
-std::array<float,2>{0.32197839f, 0.305118889f},
-std::array<float,2>{0.209931552f, 0.877134502f},
-std::array<float,2>{0.694186687f, 0.0392393544f},
-std::array<float,2>{0.550483942f, 0.827324748f},
-std::array<float,2>{0.0379589759f, 0.186374709f},
-std::array<float,2>{0.453758597f, 0.67089361f},
-std::array<float,2>{0.931358755f, 0.489691257f},
-std::array<float,2>{0.793960333f, 0.761196554f},
-std::array<float,2>{0.296023726f, 0.212212875f},
-std::array<float,2>{0.168984652f, 0.688327909f},
-std::array<float,2>{0.667227745f, 0.405802757f},
-std::array<float,2>{0.580578923f, 0.504134953f},
-std::array<float,2>{0.084926948f, 0.370321065f},
-std::array<float,2>{0.420229673f, 0.973259151f},
-std::array<float,2>{0.984327734f, 0.0811838657f},
-std::array<float,2>{0.892558873f, 0.655960679f},
-std::array<float,2>{0.471492231f, 0.459271967f},
-std::array<float,2>{0.0132088056f, 0.871080875f},
-std::array<float,2>{0.52599436f, 0.152927622f},
-std::array<float,2>{0.741341531f, 0.910121083f},
-std::array<float,2>{0.241110623f, 0.0209854245f},
-std::array<float,2>{0.349746674f, 0.578602076f},
-std::array<float,2>{0.820428431f, 0.258681506f},
-std::array<float,2>{0.801358998f, 0.920086443f},
-std::array<float,2>{0.302218407f, 0.0262550954f},
-std::array<float,2>{0.175050601f, 0.59331882f},
-std::array<float,2>{0.674055636f, 0.256475836f},
-std::array<float,2>{0.573696733f, 0.644844055f},
-std::array<float,2>{0.0717433244f, 0.465762496f},
-std::array<float,2>{0.428107858f, 0.863841653f},
-std::array<float,2>{0.984712064f, 0.14813906f},
-std::array<float,2>{0.88351804f, 0.509253919f},
-std::array<float,2>{0.490797341f, 0.366060734f},
-std::array<float,2>{0.0175895356f, 0.978501618f},
-std::array<float,2>{0.500331163f, 0.092097193f},
-std::array<float,2>{0.728368819f, 0.751071692f},
-std::array<float,2>{0.22043398f, 0.207792699f},
-std::array<float,2>{0.36792317f, 0.701953053f},
-std::array<float,2>{0.836965859f, 0.396526992f},
-std::array<float,2>{0.964525461f, 0.813091815f},
-std::array<float,2>{0.37723276f, 0.179288477f},
-std::array<float,2>{0.102431782f, 0.663597584f},
-std::array<float,2>{0.618705213f, 0.492706269f},
-std::array<float,2>{0.643445253f, 0.612784445f},
-std::array<float,2>{0.152959853f, 0.297235489f},
-std::array<float,2>{0.272359759f, 0.885472775f},
-std::array<float,2>{0.774212778f, 0.0345984362f},
-std::array<float,2>{0.872818172f, 0.74851203f},
-std::array<float,2>{0.336950332f, 0.432030916f},
-std::array<float,2>{0.192908108f, 0.80393219f},
-std::array<float,2>{0.704219759f, 0.218849659f},
-std::array<float,2>{0.532379508f, 0.938278675f},
-std::array<float,2>{0.054548122f, 0.111023806f},
-std::array<float,2>{0.439135134f, 0.545545101f},
-std::array<float,2>{0.920453131f, 0.326127231f},
-std::array<float,2>{0.935133219f, 0.985577285f},
-std::array<float,2>{0.459109724f, 0.0676937997f},
-std::array<float,2>{0.031793084f, 0.518419206f},
-std::array<float,2>{0.55260998f, 0.355199724f},
-std::array<float,2>{0.69088304f, 0.716011703f},
-std::array<float,2>{0.206908241f, 0.382699609f},
-std::array<float,2>{0.327980995f, 0.766646564f},
-std::array<float,2>{0.849706292f, 0.202472836f},
-std::array<float,2>{0.759458899f, 0.575673223f},
-std::array<float,2>{0.254487872f, 0.267644167f},
-std::array<float,2>{0.135847867f, 0.933324397f},
-std::array<float,2>{0.6282534f, 0.0148069402f},
-std::array<float,2>{0.594979465f, 0.85066539f},
-std::array<float,2>{0.119489253f, 0.127354145f},
-std::array<float,2>{0.395463109f, 0.629417598f},
-std::array<float,2>{0.941567779f, 0.445851266f},
-std::array<float,2>{0.824385822f, 0.787771761f},
-std::array<float,2>{0.347186476f, 0.245503575f},
-std::array<float,2>{0.237429738f, 0.723920703f},
-std::array<float,2>{0.736823618f, 0.409181982f},
-std::array<float,2>{0.527975678f, 0.547308147f},
-std::array<float,2>{0.0113640437f, 0.343130857f},
-std::array<float,2>{0.474300325f, 0.967358828f},
-std::array<float,2>{0.898399234f, 0.102647044f},
-std::array<float,2>{0.978876948f, 0.682358921f},
-std::array<float,2>{0.41778484f, 0.482180387f},
-std::array<float,2>{0.0781634822f, 0.840115368f},
-std::array<float,2>{0.583280087f, 0.161465511f},
-std::array<float,2>{0.670797825f, 0.902786255f},
-std::array<float,2>{0.164117724f, 0.0484839864f},
-std::array<float,2>{0.29146114f, 0.595651865f},
-std::array<float,2>{0.791575134f, 0.281283259f},
-std::array<float,2>{0.857171178f, 0.95360297f},
-std::array<float,2>{0.315814078f, 0.101048492f},
-std::array<float,2>{0.218099877f, 0.562422395f},
-std::array<float,2>{0.701491952f, 0.32818833f},
-std::array<float,2>{0.555542231f, 0.731576204f},
-std::array<float,2>{0.0402901918f, 0.416036606f},
-std::array<float,2>{0.466208279f, 0.793894827f},
-std::array<float,2>{0.923841834f, 0.237564251f},
-std::array<float,2>{0.947065532f, 0.607241452f},
-std::array<float,2>{0.402060896f, 0.294113368f},
-std::array<float,2>{0.113733456f, 0.893773615f},
-std::array<float,2>{0.607841015f, 0.0617291629f},
-std::array<float,2>{0.638662517f, 0.835935414f},
-std::array<float,2>{0.12515673f, 0.171353653f},
-std::array<float,2>{0.257920325f, 0.678156376f},
-std::array<float,2>{0.755068839f, 0.474124193f},
-std::array<float,2>{0.902870595f, 0.778536618f},
-std::array<float,2>{0.481907725f, 0.187922731f},
-std::array<float,2>{0.00689848932f, 0.70440197f},
-std::array<float,2>{0.517352462f, 0.388030618f},
-std::array<float,2>{0.743138969f, 0.526125729f},
-std::array<float,2>{0.245006412f, 0.348713577f},
-std::array<float,2>{0.3570005f, 0.99229908f},
-std::array<float,2>{0.815810621f, 0.0718393326f},
-std::array<float,2>{0.787757993f, 0.638155818f},
-std::array<float,2>{0.287455559f, 0.444494992f},
-std::array<float,2>{0.163603753f, 0.852792263f},
-std::array<float,2>{0.658180356f, 0.134008676f},
-std::array<float,2>{0.586791217f, 0.928788602f},
-std::array<float,2>{0.0919595212f, 0.00365857454f},
-std::array<float,2>{0.411711812f, 0.56746769f},
-std::array<float,2>{0.971715331f, 0.279297113f},
-std::array<float,2>{0.999831676f, 0.879986525f},
-std::array<float,2>{0.436252028f, 0.0434610881f},
-std::array<float,2>{0.0663558245f, 0.618237972f},
-std::array<float,2>{0.565715611f, 0.31098035f},
-std::array<float,2>{0.68052727f, 0.664418817f},
-std::array<float,2>{0.181086332f, 0.486390501f},
-std::array<float,2>{0.309335142f, 0.823016167f},
-std::array<float,2>{0.811097741f, 0.182561785f},
-std::array<float,2>{0.82953155f, 0.537519634f},
-std::array<float,2>{0.366087884f, 0.318336546f},
-std::array<float,2>{0.229181275f, 0.946292281f},
-std::array<float,2>{0.725980282f, 0.120489798f},
-std::array<float,2>{0.510291398f, 0.812188327f},
-std::array<float,2>{0.024249291f, 0.227978602f},
-std::array<float,2>{0.492254823f, 0.739679694f},
-std::array<float,2>{0.880307496f, 0.425362796f},
-std::array<float,2>{0.771116257f, 0.87115401f},
-std::array<float,2>{0.276072443f, 0.14855887f},
-std::array<float,2>{0.140877157f, 0.650057673f},
-std::array<float,2>{0.65301466f, 0.454848468f},
-std::array<float,2>{0.609978318f, 0.585277915f},
-std::array<float,2>{0.0961893797f, 0.264457375f},
-std::array<float,2>{0.385647953f, 0.913306117f},
-std::array<float,2>{0.958957732f, 0.015723059f},
-std::array<float,2>{0.913523674f, 0.691952646f},
-std::array<float,2>{0.452043921f, 0.400164694f},
-std::array<float,2>{0.0563597456f, 0.762188077f},
-std::array<float,2>{0.542728364f, 0.216256186f},
-std::array<float,2>{0.717128038f, 0.9689219f},
-std::array<float,2>{0.199223876f, 0.0833135396f},
-std::array<float,2>{0.332627088f, 0.501120687f},
-std::array<float,2>{0.862242997f, 0.371443748f},
-std::array<float,2>{0.764897645f, 0.951286614f},
-std::array<float,2>{0.251608729f, 0.12487191f},
-std::array<float,2>{0.138643354f, 0.534031153f},
-std::array<float,2>{0.630001307f, 0.312660754f},
-std::array<float,2>{0.601222873f, 0.737546086f},
-std::array<float,2>{0.121609755f, 0.427797407f},
-std::array<float,2>{0.391997635f, 0.805683792f},
-std::array<float,2>{0.939109266f, 0.231802613f},
-std::array<float,2>{0.931114316f, 0.622239709f},
-std::array<float,2>{0.453557283f, 0.308351576f},
-std::array<float,2>{0.0373177752f, 0.875614285f},
-std::array<float,2>{0.550001144f, 0.0424379148f},
-std::array<float,2>{0.693824232f, 0.825236738f},
-std::array<float,2>{0.209205836f, 0.18368122f},
-std::array<float,2>{0.32136184f, 0.669440806f},
-std::array<float,2>{0.846667588f, 0.491914451f},
-std::array<float,2>{0.983599126f, 0.759642363f},
-std::array<float,2>{0.420845747f, 0.213343978f},
-std::array<float,2>{0.0842287317f, 0.690521777f},
-std::array<float,2>{0.58011657f, 0.40270561f},
-std::array<float,2>{0.667940795f, 0.506456554f},
-std::array<float,2>{0.16974704f, 0.367584884f},
-std::array<float,2>{0.296483189f, 0.97548455f},
-std::array<float,2>{0.79468745f, 0.0800079107f},
-std::array<float,2>{0.820905268f, 0.654148519f},
-std::array<float,2>{0.350512862f, 0.457734466f},
-std::array<float,2>{0.240559965f, 0.867616653f},
-std::array<float,2>{0.741705894f, 0.15607661f},
-std::array<float,2>{0.525693536f, 0.907693207f},
-std::array<float,2>{0.0128944088f, 0.0215374809f},
-std::array<float,2>{0.471129775f, 0.581954122f},
-std::array<float,2>{0.89202404f, 0.26159808f},
-std::array<float,2>{0.890506864f, 0.898387313f},
-std::array<float,2>{0.485957444f, 0.0551018268f},
-std::array<float,2>{0.0196920931f, 0.605167866f},
-std::array<float,2>{0.506621242f, 0.291594833f},
-std::array<float,2>{0.73108387f, 0.673757911f},
-std::array<float,2>{0.222710758f, 0.469309539f},
-std::array<float,2>{0.372478336f, 0.831312776f},
-std::array<float,2>{0.841998994f, 0.167519763f},
-std::array<float,2>{0.798268974f, 0.557512641f},
-std::array<float,2>{0.299210787f, 0.332533717f},
-std::array<float,2>{0.177046761f, 0.958092988f},
-std::array<float,2>{0.676046073f, 0.0944623575f},
-std::array<float,2>{0.576462746f, 0.791595221f},
-std::array<float,2>{0.0756713971f, 0.241522893f},
-std::array<float,2>{0.425129175f, 0.72797507f},
-std::array<float,2>{0.988982856f, 0.417974263f},
-std::array<float,2>{0.867805004f, 0.85600841f},
-std::array<float,2>{0.340452611f, 0.140146121f},
-std::array<float,2>{0.190099016f, 0.635355055f},
-std::array<float,2>{0.707806587f, 0.438153088f},
-std::array<float,2>{0.536287487f, 0.565831602f},
-std::array<float,2>{0.0474037193f, 0.274272352f},
-std::array<float,2>{0.442669064f, 0.924746275f},
-std::array<float,2>{0.915513575f, 0.00653399341f},
-std::array<float,2>{0.968127549f, 0.70807147f},
-std::array<float,2>{0.381049335f, 0.382962286f},
-std::array<float,2>{0.106537476f, 0.77445972f},
-std::array<float,2>{0.621553898f, 0.194242656f},
-std::array<float,2>{0.648263633f, 0.997649074f},
-std::array<float,2>{0.152124792f, 0.0776021034f},
-std::array<float,2>{0.268104702f, 0.53054601f},
-std::array<float,2>{0.779537141f, 0.347556889f},
-std::array<float,2>{0.833611488f, 0.936110497f},
-std::array<float,2>{0.363011867f, 0.0104838638f},
-std::array<float,2>{0.23075299f, 0.572193325f},
-std::array<float,2>{0.720816374f, 0.272839308f},
-std::array<float,2>{0.513886571f, 0.625345349f},
-std::array<float,2>{0.030672323f, 0.451481611f},
-std::array<float,2>{0.498096883f, 0.845488727f},
-std::array<float,2>{0.878751755f, 0.131654739f},
-std::array<float,2>{0.995809734f, 0.523259699f},
-std::array<float,2>{0.433013171f, 0.358172983f},
-std::array<float,2>{0.0699794441f, 0.989516079f},
-std::array<float,2>{0.566623271f, 0.0626539811f},
-std::array<float,2>{0.684981942f, 0.770075381f},
-std::array<float,2>{0.184010267f, 0.198123455f},
-std::array<float,2>{0.307406545f, 0.714378953f},
-std::array<float,2>{0.808053136f, 0.377182305f},
-std::array<float,2>{0.908741415f, 0.839637339f},
-std::array<float,2>{0.446964234f, 0.158431843f},
-std::array<float,2>{0.0615258627f, 0.684749603f},
-std::array<float,2>{0.546578765f, 0.477846026f},
-std::array<float,2>{0.712643921f, 0.599445403f},
-std::array<float,2>{0.197853327f, 0.287144154f},
-std::array<float,2>{0.331713557f, 0.900418222f},
-std::array<float,2>{0.866725087f, 0.0527017452f},
-std::array<float,2>{0.768900514f, 0.722468317f},
-std::array<float,2>{0.280514479f, 0.414053708f},
-std::array<float,2>{0.145064905f, 0.782043517f},
-std::array<float,2>{0.650234878f, 0.249939546f},
-std::array<float,2>{0.61344552f, 0.963013053f},
-std::array<float,2>{0.0983490497f, 0.108555116f},
-std::array<float,2>{0.389253467f, 0.55231595f},
-std::array<float,2>{0.956576049f, 0.339776009f},
-std::array<float,2>{0.952744007f, 0.983782828f},
-std::array<float,2>{0.405895561f, 0.0867784768f},
-std::array<float,2>{0.111962751f, 0.513151348f},
-std::array<float,2>{0.603528202f, 0.360861957f},
-std::array<float,2>{0.633310318f, 0.698530734f},
-std::array<float,2>{0.130001426f, 0.394169658f},
-std::array<float,2>{0.262141883f, 0.757483602f},
-std::array<float,2>{0.752844512f, 0.204195976f},
-std::array<float,2>{0.853690267f, 0.586267889f},
-std::array<float,2>{0.318539768f, 0.252311558f},
-std::array<float,2>{0.21155642f, 0.917239964f},
-std::array<float,2>{0.697848558f, 0.0306592453f},
-std::array<float,2>{0.56072247f, 0.860530078f},
-std::array<float,2>{0.0462868623f, 0.144485489f},
-std::array<float,2>{0.461704314f, 0.641925812f},
-std::array<float,2>{0.928905189f, 0.463622034f},
-std::array<float,2>{0.784541488f, 0.798415422f},
-std::array<float,2>{0.283144861f, 0.223324746f},
-std::array<float,2>{0.158803463f, 0.743017137f},
-std::array<float,2>{0.660874605f, 0.435684681f},
-std::array<float,2>{0.590623319f, 0.539104521f},
-std::array<float,2>{0.0877576098f, 0.323348701f},
-std::array<float,2>{0.409414291f, 0.943633318f},
-std::array<float,2>{0.973771453f, 0.114103124f},
-std::array<float,2>{0.899056852f, 0.658216894f},
-std::array<float,2>{0.476808608f, 0.496782869f},
-std::array<float,2>{0.000760500319f, 0.81655097f},
-std::array<float,2>{0.520853341f, 0.173909038f},
-std::array<float,2>{0.748979509f, 0.888158202f},
-std::array<float,2>{0.246892989f, 0.0366287567f},
-std::array<float,2>{0.355237275f, 0.616168797f},
-std::array<float,2>{0.817549169f, 0.302730501f},
-std::array<float,2>{0.81063664f, 0.8814134f},
-std::array<float,2>{0.30872497f, 0.0461659953f},
-std::array<float,2>{0.181424081f, 0.620580435f},
-std::array<float,2>{0.679777265f, 0.309911132f},
-std::array<float,2>{0.566341639f, 0.666921854f},
-std::array<float,2>{0.0657402724f, 0.486318827f},
-std::array<float,2>{0.435609788f, 0.821759462f},
-std::array<float,2>{0.999246955f, 0.180320621f},
-std::array<float,2>{0.880768001f, 0.535378575f},
-std::array<float,2>{0.493154377f, 0.319646329f},
-std::array<float,2>{0.0238786712f, 0.94902271f},
-std::array<float,2>{0.509802997f, 0.118882023f},
-std::array<float,2>{0.726089597f, 0.810075343f},
-std::array<float,2>{0.228646353f, 0.229588091f},
-std::array<float,2>{0.365457624f, 0.741803646f},
-std::array<float,2>{0.829763114f, 0.422639608f},
-std::array<float,2>{0.958027303f, 0.874620795f},
-std::array<float,2>{0.384962559f, 0.152132869f},
-std::array<float,2>{0.0966726914f, 0.651733756f},
-std::array<float,2>{0.609760225f, 0.45637545f},
-std::array<float,2>{0.65273267f, 0.582336843f},
-std::array<float,2>{0.141383797f, 0.262328714f},
-std::array<float,2>{0.275803506f, 0.91071403f},
-std::array<float,2>{0.770975947f, 0.0194403585f},
-std::array<float,2>{0.861641943f, 0.69521898f},
-std::array<float,2>{0.332393348f, 0.400722057f},
-std::array<float,2>{0.199798852f, 0.763939321f},
-std::array<float,2>{0.717350721f, 0.218612209f},
-std::array<float,2>{0.542162895f, 0.971552908f},
-std::array<float,2>{0.0560425892f, 0.0857336372f},
-std::array<float,2>{0.451471001f, 0.503279567f},
-std::array<float,2>{0.913855731f, 0.374416083f},
-std::array<float,2>{0.924737453f, 0.957010567f},
-std::array<float,2>{0.466730714f, 0.0985209718f},
-std::array<float,2>{0.0408277176f, 0.558858752f},
-std::array<float,2>{0.555086672f, 0.331284046f},
-std::array<float,2>{0.701689065f, 0.734059691f},
-std::array<float,2>{0.218676016f, 0.415102899f},
-std::array<float,2>{0.316189617f, 0.795826316f},
-std::array<float,2>{0.856844783f, 0.235552028f},
-std::array<float,2>{0.755560398f, 0.60826385f},
-std::array<float,2>{0.258513838f, 0.295838386f},
-std::array<float,2>{0.125642374f, 0.891572714f},
-std::array<float,2>{0.637741804f, 0.0603090264f},
-std::array<float,2>{0.608132362f, 0.832965791f},
-std::array<float,2>{0.113771498f, 0.168556854f},
-std::array<float,2>{0.401504666f, 0.675945818f},
-std::array<float,2>{0.946410596f, 0.475571007f},
-std::array<float,2>{0.816322565f, 0.781216443f},
-std::array<float,2>{0.356719762f, 0.190638185f},
-std::array<float,2>{0.244367898f, 0.705727279f},
-std::array<float,2>{0.742493153f, 0.389783919f},
-std::array<float,2>{0.517061293f, 0.523548663f},
-std::array<float,2>{0.00762490649f, 0.350283802f},
-std::array<float,2>{0.481944978f, 0.995020926f},
-std::array<float,2>{0.902591407f, 0.0728838444f},
-std::array<float,2>{0.97221601f, 0.639448285f},
-std::array<float,2>{0.411224782f, 0.442970157f},
-std::array<float,2>{0.0924050957f, 0.854115844f},
-std::array<float,2>{0.586155176f, 0.136062726f},
-std::array<float,2>{0.657547951f, 0.926701963f},
-std::array<float,2>{0.163491428f, 0.000479508628f},
-std::array<float,2>{0.288085878f, 0.568591475f},
-std::array<float,2>{0.787312329f, 0.278699219f},
-std::array<float,2>{0.850490749f, 0.987256169f},
-std::array<float,2>{0.327253312f, 0.0700041577f},
-std::array<float,2>{0.206070691f, 0.516831458f},
-std::array<float,2>{0.691218019f, 0.353448212f},
-std::array<float,2>{0.551888764f, 0.718715727f},
-std::array<float,2>{0.0317233354f, 0.380218357f},
-std::array<float,2>{0.459859341f, 0.76885736f},
-std::array<float,2>{0.934945226f, 0.200213954f},
-std::array<float,2>{0.94191438f, 0.576970756f},
-std::array<float,2>{0.39478296f, 0.266583771f},
-std::array<float,2>{0.119899698f, 0.931304276f},
-std::array<float,2>{0.595435262f, 0.0131772319f},
-std::array<float,2>{0.628824532f, 0.847963691f},
-std::array<float,2>{0.136426196f, 0.125510857f},
-std::array<float,2>{0.254094005f, 0.631471336f},
-std::array<float,2>{0.758863509f, 0.447532147f},
-std::array<float,2>{0.897723019f, 0.786385417f},
-std::array<float,2>{0.473641008f, 0.243160963f},
-std::array<float,2>{0.0108111752f, 0.726294339f},
-std::array<float,2>{0.527391315f, 0.407158971f},
-std::array<float,2>{0.736384153f, 0.549475014f},
-std::array<float,2>{0.23787874f, 0.341246247f},
-std::array<float,2>{0.346932024f, 0.965163469f},
-std::array<float,2>{0.824813843f, 0.103721119f},
-std::array<float,2>{0.791114986f, 0.681335807f},
-std::array<float,2>{0.29164055f, 0.482966572f},
-std::array<float,2>{0.164716467f, 0.842783868f},
-std::array<float,2>{0.670084894f, 0.164022118f},
-std::array<float,2>{0.583527565f, 0.905730665f},
-std::array<float,2>{0.0787262022f, 0.0494883321f},
-std::array<float,2>{0.417161405f, 0.596330523f},
-std::array<float,2>{0.979350626f, 0.283245921f},
-std::array<float,2>{0.985198975f, 0.918447495f},
-std::array<float,2>{0.428244293f, 0.0246077739f},
-std::array<float,2>{0.0718903318f, 0.591420352f},
-std::array<float,2>{0.574157238f, 0.255132198f},
-std::array<float,2>{0.674597919f, 0.647026598f},
-std::array<float,2>{0.175749615f, 0.467629313f},
-std::array<float,2>{0.302334547f, 0.865711808f},
-std::array<float,2>{0.801124811f, 0.146053895f},
-std::array<float,2>{0.837511122f, 0.510109901f},
-std::array<float,2>{0.367386043f, 0.363818854f},
-std::array<float,2>{0.219757676f, 0.97974813f},
-std::array<float,2>{0.727605939f, 0.0900198519f},
-std::array<float,2>{0.50070101f, 0.753613055f},
-std::array<float,2>{0.0183557104f, 0.209262803f},
-std::array<float,2>{0.490593195f, 0.700402617f},
-std::array<float,2>{0.883234262f, 0.395265996f},
-std::array<float,2>{0.773881316f, 0.815212727f},
-std::array<float,2>{0.271629006f, 0.177562401f},
-std::array<float,2>{0.152769044f, 0.661886752f},
-std::array<float,2>{0.642607629f, 0.495561093f},
-std::array<float,2>{0.618344367f, 0.609642565f},
-std::array<float,2>{0.101902187f, 0.300270528f},
-std::array<float,2>{0.377525657f, 0.884165883f},
-std::array<float,2>{0.964260876f, 0.0323839001f},
-std::array<float,2>{0.919958472f, 0.746671557f},
-std::array<float,2>{0.438622653f, 0.430110097f},
-std::array<float,2>{0.0541331135f, 0.801217914f},
-std::array<float,2>{0.533016086f, 0.222294316f},
-std::array<float,2>{0.705064595f, 0.940132022f},
-std::array<float,2>{0.192798749f, 0.111901239f},
-std::array<float,2>{0.337863117f, 0.543646157f},
-std::array<float,2>{0.87241298f, 0.327180743f},
-std::array<float,2>{0.796055436f, 0.972879469f},
-std::array<float,2>{0.293566734f, 0.0815671086f},
-std::array<float,2>{0.171410725f, 0.504467845f},
-std::array<float,2>{0.665949941f, 0.370892912f},
-std::array<float,2>{0.579230845f, 0.687553108f},
-std::array<float,2>{0.0827426687f, 0.405577242f},
-std::array<float,2>{0.418454468f, 0.761552453f},
-std::array<float,2>{0.981064439f, 0.21283938f},
-std::array<float,2>{0.892911851f, 0.57884717f},
-std::array<float,2>{0.470499098f, 0.258247912f},
-std::array<float,2>{0.0139692454f, 0.909385979f},
-std::array<float,2>{0.523733079f, 0.021043662f},
-std::array<float,2>{0.739016414f, 0.870569885f},
-std::array<float,2>{0.239736438f, 0.152607515f},
-std::array<float,2>{0.348846614f, 0.655407965f},
-std::array<float,2>{0.823634088f, 0.459681243f},
-std::array<float,2>{0.93987757f, 0.807823837f},
-std::array<float,2>{0.392724127f, 0.233051121f},
-std::array<float,2>{0.12396533f, 0.735826254f},
-std::array<float,2>{0.598193526f, 0.426899046f},
-std::array<float,2>{0.631012559f, 0.532574713f},
-std::array<float,2>{0.138764411f, 0.315384299f},
-std::array<float,2>{0.253795624f, 0.949936569f},
-std::array<float,2>{0.762459815f, 0.121936902f},
-std::array<float,2>{0.844847083f, 0.6701805f},
-std::array<float,2>{0.323225945f, 0.489821702f},
-std::array<float,2>{0.207778737f, 0.827933133f},
-std::array<float,2>{0.69325918f, 0.185755506f},
-std::array<float,2>{0.547070861f, 0.877809882f},
-std::array<float,2>{0.0359076262f, 0.0399559177f},
-std::array<float,2>{0.456569821f, 0.624116778f},
-std::array<float,2>{0.933196664f, 0.305186719f},
-std::array<float,2>{0.917738855f, 0.923285961f},
-std::array<float,2>{0.445138484f, 0.00562564097f},
-std::array<float,2>{0.0505844317f, 0.562796056f},
-std::array<float,2>{0.538133621f, 0.276992559f},
-std::array<float,2>{0.710342407f, 0.633425355f},
-std::array<float,2>{0.188909546f, 0.440831095f},
-std::array<float,2>{0.342853338f, 0.858555317f},
-std::array<float,2>{0.870149136f, 0.137353688f},
-std::array<float,2>{0.778131187f, 0.528100789f},
-std::array<float,2>{0.267260849f, 0.345424592f},
-std::array<float,2>{0.15020141f, 0.99908644f},
-std::array<float,2>{0.645998001f, 0.0744329989f},
-std::array<float,2>{0.623245835f, 0.777298152f},
-std::array<float,2>{0.108451881f, 0.1925506f},
-std::array<float,2>{0.380377829f, 0.710394084f},
-std::array<float,2>{0.965036988f, 0.385509521f},
-std::array<float,2>{0.84138453f, 0.828240395f},
-std::array<float,2>{0.373897433f, 0.164620176f},
-std::array<float,2>{0.225440353f, 0.67431581f},
-std::array<float,2>{0.733854234f, 0.471498549f},
-std::array<float,2>{0.50427115f, 0.601992905f},
-std::array<float,2>{0.022478655f, 0.289330006f},
-std::array<float,2>{0.487018824f, 0.894772291f},
-std::array<float,2>{0.886941433f, 0.0573872812f},
-std::array<float,2>{0.991056025f, 0.729680002f},
-std::array<float,2>{0.421886146f, 0.421103835f},
-std::array<float,2>{0.0762747005f, 0.789269626f},
-std::array<float,2>{0.575766087f, 0.238769948f},
-std::array<float,2>{0.678583741f, 0.959839165f},
-std::array<float,2>{0.17869027f, 0.0959483832f},
-std::array<float,2>{0.298451453f, 0.555741549f},
-std::array<float,2>{0.798940659f, 0.335365385f},
-std::array<float,2>{0.8652125f, 0.899952471f},
-std::array<float,2>{0.328186542f, 0.0534517691f},
-std::array<float,2>{0.197030872f, 0.600560546f},
-std::array<float,2>{0.713693738f, 0.285196483f},
-std::array<float,2>{0.544368446f, 0.687165141f},
-std::array<float,2>{0.060543403f, 0.480174631f},
-std::array<float,2>{0.447742611f, 0.837329865f},
-std::array<float,2>{0.907607198f, 0.157685488f},
-std::array<float,2>{0.954039931f, 0.553264797f},
-std::array<float,2>{0.387311786f, 0.337521583f},
-std::array<float,2>{0.100688703f, 0.961024821f},
-std::array<float,2>{0.617083788f, 0.105735011f},
-std::array<float,2>{0.651723504f, 0.783642232f},
-std::array<float,2>{0.146870717f, 0.247645468f},
-std::array<float,2>{0.278105199f, 0.71972692f},
-std::array<float,2>{0.766158283f, 0.410583764f},
-std::array<float,2>{0.875173151f, 0.846287072f},
-std::array<float,2>{0.497184098f, 0.130142659f},
-std::array<float,2>{0.028097339f, 0.628807962f},
-std::array<float,2>{0.512438953f, 0.450760543f},
-std::array<float,2>{0.720199585f, 0.573216975f},
-std::array<float,2>{0.232541293f, 0.269786805f},
-std::array<float,2>{0.360386282f, 0.934628606f},
-std::array<float,2>{0.835507989f, 0.00901866611f},
-std::array<float,2>{0.805147707f, 0.712429404f},
-std::array<float,2>{0.305388659f, 0.376088411f},
-std::array<float,2>{0.186023355f, 0.771775663f},
-std::array<float,2>{0.68739742f, 0.195693657f},
-std::array<float,2>{0.568601847f, 0.991660118f},
-std::array<float,2>{0.0667513609f, 0.065930739f},
-std::array<float,2>{0.430823445f, 0.520956039f},
-std::array<float,2>{0.992769778f, 0.357133657f},
-std::array<float,2>{0.976401508f, 0.942869842f},
-std::array<float,2>{0.407055706f, 0.116891801f},
-std::array<float,2>{0.0882586315f, 0.54282546f},
-std::array<float,2>{0.593706608f, 0.321877301f},
-std::array<float,2>{0.663721621f, 0.744457364f},
-std::array<float,2>{0.1565983f, 0.435020775f},
-std::array<float,2>{0.285069227f, 0.799816906f},
-std::array<float,2>{0.781754136f, 0.225472406f},
-std::array<float,2>{0.819880664f, 0.614089727f},
-std::array<float,2>{0.353100479f, 0.303803533f},
-std::array<float,2>{0.249764726f, 0.890136361f},
-std::array<float,2>{0.747404277f, 0.0382690877f},
-std::array<float,2>{0.522033453f, 0.820234239f},
-std::array<float,2>{0.00356030045f, 0.173418567f},
-std::array<float,2>{0.479050964f, 0.657486856f},
-std::array<float,2>{0.900520325f, 0.498049974f},
-std::array<float,2>{0.751469791f, 0.753976583f},
-std::array<float,2>{0.265160948f, 0.205614686f},
-std::array<float,2>{0.132742077f, 0.696346104f},
-std::array<float,2>{0.636051893f, 0.391925186f},
-std::array<float,2>{0.602235198f, 0.51528883f},
-std::array<float,2>{0.109586857f, 0.362078726f},
-std::array<float,2>{0.403492928f, 0.980710924f},
-std::array<float,2>{0.949229062f, 0.0888686106f},
-std::array<float,2>{0.926987886f, 0.644444406f},
-std::array<float,2>{0.464044601f, 0.462609559f},
-std::array<float,2>{0.0431178585f, 0.861872077f},
-std::array<float,2>{0.560417056f, 0.141773894f},
-std::array<float,2>{0.695365965f, 0.914312363f},
-std::array<float,2>{0.21329686f, 0.0276452582f},
-std::array<float,2>{0.318100512f, 0.588700354f},
-std::array<float,2>{0.853009582f, 0.251199484f},
-std::array<float,2>{0.772204101f, 0.913908005f},
-std::array<float,2>{0.274833828f, 0.0165507812f},
-std::array<float,2>{0.143842146f, 0.585629523f},
-std::array<float,2>{0.656016886f, 0.263840824f},
-std::array<float,2>{0.61198169f, 0.649782717f},
-std::array<float,2>{0.0939443484f, 0.454155058f},
-std::array<float,2>{0.383075356f, 0.871967018f},
-std::array<float,2>{0.959424078f, 0.149235323f},
-std::array<float,2>{0.910357475f, 0.501483321f},
-std::array<float,2>{0.449857652f, 0.371931791f},
-std::array<float,2>{0.0584080741f, 0.969588041f},
-std::array<float,2>{0.53990078f, 0.0835253745f},
-std::array<float,2>{0.715125799f, 0.762265146f},
-std::array<float,2>{0.202861026f, 0.216589823f},
-std::array<float,2>{0.335009307f, 0.691691339f},
-std::array<float,2>{0.861298263f, 0.399486154f},
-std::array<float,2>{0.997651458f, 0.822272718f},
-std::array<float,2>{0.434649199f, 0.182062879f},
-std::array<float,2>{0.0630257577f, 0.664693713f},
-std::array<float,2>{0.563515246f, 0.487179756f},
-std::array<float,2>{0.682788789f, 0.618804276f},
-std::array<float,2>{0.183290824f, 0.311394364f},
-std::array<float,2>{0.312217176f, 0.880807519f},
-std::array<float,2>{0.810170412f, 0.0433403179f},
-std::array<float,2>{0.830725312f, 0.739757538f},
-std::array<float,2>{0.363525569f, 0.425154269f},
-std::array<float,2>{0.228280827f, 0.811680019f},
-std::array<float,2>{0.7234689f, 0.228316128f},
-std::array<float,2>{0.508075595f, 0.947071731f},
-std::array<float,2>{0.0256531816f, 0.120743342f},
-std::array<float,2>{0.494920522f, 0.537892282f},
-std::array<float,2>{0.882300258f, 0.317399532f},
-std::array<float,2>{0.905531585f, 0.992765307f},
-std::array<float,2>{0.483336747f, 0.0715886503f},
-std::array<float,2>{0.00421087118f, 0.525615215f},
-std::array<float,2>{0.518325925f, 0.349225372f},
-std::array<float,2>{0.744828641f, 0.704732239f},
-std::array<float,2>{0.242865607f, 0.388391078f},
-std::array<float,2>{0.358661324f, 0.779002547f},
-std::array<float,2>{0.812684715f, 0.188252583f},
-std::array<float,2>{0.786837816f, 0.568133652f},
-std::array<float,2>{0.285332024f, 0.279998332f},
-std::array<float,2>{0.160699412f, 0.929459989f},
-std::array<float,2>{0.658455133f, 0.00336067914f},
-std::array<float,2>{0.589198232f, 0.853105724f},
-std::array<float,2>{0.0904366598f, 0.134316668f},
-std::array<float,2>{0.413992912f, 0.638584316f},
-std::array<float,2>{0.9701159f, 0.444829524f},
-std::array<float,2>{0.857774198f, 0.793418527f},
-std::array<float,2>{0.312673748f, 0.238005817f},
-std::array<float,2>{0.216104537f, 0.732209384f},
-std::array<float,2>{0.699290276f, 0.416616082f},
-std::array<float,2>{0.557762325f, 0.56184715f},
-std::array<float,2>{0.0415852107f, 0.328967243f},
-std::array<float,2>{0.467547625f, 0.953668296f},
-std::array<float,2>{0.922846138f, 0.101522297f},
-std::array<float,2>{0.948574305f, 0.67831403f},
-std::array<float,2>{0.40012008f, 0.473720044f},
-std::array<float,2>{0.11526151f, 0.835092306f},
-std::array<float,2>{0.606485248f, 0.171807334f},
-std::array<float,2>{0.638916075f, 0.894175053f},
-std::array<float,2>{0.128536746f, 0.0622889549f},
-std::array<float,2>{0.261604249f, 0.60686779f},
-std::array<float,2>{0.757381082f, 0.29489249f},
-std::array<float,2>{0.827409387f, 0.966963232f},
-std::array<float,2>{0.344680071f, 0.103445418f},
-std::array<float,2>{0.234404162f, 0.547544777f},
-std::array<float,2>{0.73477459f, 0.343742907f},
-std::array<float,2>{0.531247854f, 0.724264741f},
-std::array<float,2>{0.00886678044f, 0.409971446f},
-std::array<float,2>{0.476512998f, 0.787323833f},
-std::array<float,2>{0.895936728f, 0.245712772f},
-std::array<float,2>{0.977429926f, 0.595163703f},
-std::array<float,2>{0.415801257f, 0.282049865f},
-std::array<float,2>{0.0809168145f, 0.903163135f},
-std::array<float,2>{0.585065365f, 0.0479377806f},
-std::array<float,2>{0.669614911f, 0.840400338f},
-std::array<float,2>{0.166866794f, 0.162077993f},
-std::array<float,2>{0.289636731f, 0.681685865f},
-std::array<float,2>{0.789808571f, 0.481471419f},
-std::array<float,2>{0.935937285f, 0.767484963f},
-std::array<float,2>{0.458405077f, 0.202702105f},
-std::array<float,2>{0.0335276723f, 0.716540754f},
-std::array<float,2>{0.554623723f, 0.381955743f},
-std::array<float,2>{0.688129365f, 0.518010795f},
-std::array<float,2>{0.203764111f, 0.354651898f},
-std::array<float,2>{0.32542485f, 0.985848725f},
-std::array<float,2>{0.848865688f, 0.0679043606f},
-std::array<float,2>{0.761473954f, 0.629232407f},
-std::array<float,2>{0.257672608f, 0.445337594f},
-std::array<float,2>{0.134765446f, 0.851420224f},
-std::array<float,2>{0.625681281f, 0.127824947f},
-std::array<float,2>{0.59590584f, 0.933055997f},
-std::array<float,2>{0.118526913f, 0.0153195914f},
-std::array<float,2>{0.397586346f, 0.576096237f},
-std::array<float,2>{0.945284367f, 0.268209875f},
-std::array<float,2>{0.961475611f, 0.885240555f},
-std::array<float,2>{0.376841068f, 0.0350748897f},
-std::array<float,2>{0.10536743f, 0.613108635f},
-std::array<float,2>{0.620022535f, 0.297807515f},
-std::array<float,2>{0.642199159f, 0.663504899f},
-std::array<float,2>{0.156166419f, 0.492201269f},
-std::array<float,2>{0.269962996f, 0.812579274f},
-std::array<float,2>{0.775971174f, 0.179001957f},
-std::array<float,2>{0.87370497f, 0.545118928f},
-std::array<float,2>{0.338885397f, 0.325425684f},
-std::array<float,2>{0.194990024f, 0.937717021f},
-std::array<float,2>{0.705802441f, 0.110739648f},
-std::array<float,2>{0.534056246f, 0.804224789f},
-std::array<float,2>{0.0509799011f, 0.219620675f},
-std::array<float,2>{0.439720124f, 0.748748124f},
-std::array<float,2>{0.91833204f, 0.432434499f},
-std::array<float,2>{0.804210603f, 0.863510728f},
-std::array<float,2>{0.303401649f, 0.147864535f},
-std::array<float,2>{0.172837436f, 0.645059407f},
-std::array<float,2>{0.672640264f, 0.464897305f},
-std::array<float,2>{0.571265697f, 0.593058228f},
-std::array<float,2>{0.0740924105f, 0.256168574f},
-std::array<float,2>{0.426002771f, 0.920476794f},
-std::array<float,2>{0.986762345f, 0.0255190507f},
-std::array<float,2>{0.884779155f, 0.701345384f},
-std::array<float,2>{0.488932282f, 0.397239774f},
-std::array<float,2>{0.0168064721f, 0.75194335f},
-std::array<float,2>{0.503664374f, 0.207365364f},
-std::array<float,2>{0.72882092f, 0.977834702f},
-std::array<float,2>{0.220962182f, 0.0922877342f},
-std::array<float,2>{0.369766474f, 0.509660959f},
-std::array<float,2>{0.839206219f, 0.365661025f},
-std::array<float,2>{0.800525665f, 0.957214415f},
-std::array<float,2>{0.297267914f, 0.0952398106f},
-std::array<float,2>{0.178873077f, 0.558050513f},
-std::array<float,2>{0.679187894f, 0.333745629f},
-std::array<float,2>{0.574691415f, 0.726617157f},
-std::array<float,2>{0.0779660344f, 0.419900119f},
-std::array<float,2>{0.423552513f, 0.792463481f},
-std::array<float,2>{0.992107451f, 0.241135523f},
-std::array<float,2>{0.888406217f, 0.603785157f},
-std::array<float,2>{0.487327546f, 0.292730033f},
-std::array<float,2>{0.0223076716f, 0.896761417f},
-std::array<float,2>{0.505539238f, 0.0562380478f},
-std::array<float,2>{0.732714355f, 0.830975652f},
-std::array<float,2>{0.226118371f, 0.166283712f},
-std::array<float,2>{0.374924034f, 0.672653198f},
-std::array<float,2>{0.839958787f, 0.470506608f},
-std::array<float,2>{0.966350615f, 0.773996115f},
-std::array<float,2>{0.379154652f, 0.194550484f},
-std::array<float,2>{0.107961245f, 0.707870424f},
-std::array<float,2>{0.624323249f, 0.384616375f},
-std::array<float,2>{0.645217419f, 0.53026855f},
-std::array<float,2>{0.1489546f, 0.346433967f},
-std::array<float,2>{0.26646179f, 0.996327817f},
-std::array<float,2>{0.779285431f, 0.0764964148f},
-std::array<float,2>{0.869731963f, 0.636412501f},
-std::array<float,2>{0.341982126f, 0.438604414f},
-std::array<float,2>{0.187788725f, 0.85704577f},
-std::array<float,2>{0.709709227f, 0.138938382f},
-std::array<float,2>{0.538081944f, 0.925774813f},
-std::array<float,2>{0.0493494757f, 0.006996457f},
-std::array<float,2>{0.443978906f, 0.565386355f},
-std::array<float,2>{0.916586339f, 0.274670541f},
-std::array<float,2>{0.932252228f, 0.875998616f},
-std::array<float,2>{0.455333263f, 0.0413070954f},
-std::array<float,2>{0.0362258144f, 0.621483624f},
-std::array<float,2>{0.548727393f, 0.307473063f},
-std::array<float,2>{0.691819906f, 0.668570459f},
-std::array<float,2>{0.208453774f, 0.490832686f},
-std::array<float,2>{0.323773742f, 0.824298978f},
-std::array<float,2>{0.84465611f, 0.185255542f},
-std::array<float,2>{0.762908638f, 0.535102606f},
-std::array<float,2>{0.25244379f, 0.313563108f},
-std::array<float,2>{0.140325785f, 0.952655494f},
-std::array<float,2>{0.632484674f, 0.123487219f},
-std::array<float,2>{0.599317312f, 0.805248916f},
-std::array<float,2>{0.12457826f, 0.23110868f},
-std::array<float,2>{0.394142419f, 0.737106979f},
-std::array<float,2>{0.940812111f, 0.429683059f},
-std::array<float,2>{0.822531939f, 0.868560851f},
-std::array<float,2>{0.347706258f, 0.1551034f},
-std::array<float,2>{0.238365442f, 0.652922034f},
-std::array<float,2>{0.739264369f, 0.458117187f},
-std::array<float,2>{0.524969518f, 0.580667615f},
-std::array<float,2>{0.0155947292f, 0.259806633f},
-std::array<float,2>{0.46969685f, 0.906390846f},
-std::array<float,2>{0.894282937f, 0.0231509283f},
-std::array<float,2>{0.981978834f, 0.689935446f},
-std::array<float,2>{0.419722408f, 0.403837651f},
-std::array<float,2>{0.0835498497f, 0.7580266f},
-std::array<float,2>{0.57843715f, 0.214739621f},
-std::array<float,2>{0.664348483f, 0.976345539f},
-std::array<float,2>{0.169996575f, 0.0783128291f},
-std::array<float,2>{0.294273436f, 0.507648528f},
-std::array<float,2>{0.795781136f, 0.368921191f},
-std::array<float,2>{0.852232397f, 0.916764975f},
-std::array<float,2>{0.316410929f, 0.0298213623f},
-std::array<float,2>{0.214685544f, 0.587382376f},
-std::array<float,2>{0.696489811f, 0.253112584f},
-std::array<float,2>{0.55915314f, 0.641500056f},
-std::array<float,2>{0.0442330837f, 0.463911653f},
-std::array<float,2>{0.462965995f, 0.859737396f},
-std::array<float,2>{0.925872207f, 0.143200636f},
-std::array<float,2>{0.950841725f, 0.511966407f},
-std::array<float,2>{0.402532041f, 0.359400541f},
-std::array<float,2>{0.111186177f, 0.982673824f},
-std::array<float,2>{0.603094637f, 0.0869328082f},
-std::array<float,2>{0.635131598f, 0.756453514f},
-std::array<float,2>{0.131530002f, 0.203648508f},
-std::array<float,2>{0.264624119f, 0.698189139f},
-std::array<float,2>{0.750746429f, 0.392832249f},
-std::array<float,2>{0.901827395f, 0.817841172f},
-std::array<float,2>{0.479523778f, 0.175038218f},
-std::array<float,2>{0.0026522812f, 0.659199655f},
-std::array<float,2>{0.52249372f, 0.497670501f},
-std::array<float,2>{0.746999979f, 0.616942823f},
-std::array<float,2>{0.248083666f, 0.301119566f},
-std::array<float,2>{0.352057725f, 0.887653172f},
-std::array<float,2>{0.818685234f, 0.0356735401f},
-std::array<float,2>{0.782764733f, 0.743928015f},
-std::array<float,2>{0.284017593f, 0.437066555f},
-std::array<float,2>{0.157263696f, 0.797426164f},
-std::array<float,2>{0.66274935f, 0.224196404f},
-std::array<float,2>{0.592451155f, 0.944617271f},
-std::array<float,2>{0.0894063786f, 0.114691548f},
-std::array<float,2>{0.407867968f, 0.540059924f},
-std::array<float,2>{0.974810123f, 0.32251972f},
-std::array<float,2>{0.993480444f, 0.988472819f},
-std::array<float,2>{0.430015653f, 0.0639457107f},
-std::array<float,2>{0.0674419031f, 0.521861076f},
-std::array<float,2>{0.569673657f, 0.359223098f},
-std::array<float,2>{0.686412096f, 0.713676155f},
-std::array<float,2>{0.187288433f, 0.378090173f},
-std::array<float,2>{0.306210309f, 0.770919859f},
-std::array<float,2>{0.806188226f, 0.198627532f},
-std::array<float,2>{0.834823549f, 0.570795298f},
-std::array<float,2>{0.360120028f, 0.272246748f},
-std::array<float,2>{0.234039724f, 0.936586559f},
-std::array<float,2>{0.719531834f, 0.010754426f},
-std::array<float,2>{0.513171971f, 0.844683588f},
-std::array<float,2>{0.0284484383f, 0.132771209f},
-std::array<float,2>{0.496419698f, 0.626426399f},
-std::array<float,2>{0.87656486f, 0.452530056f},
-std::array<float,2>{0.767137527f, 0.78243041f},
-std::array<float,2>{0.278440565f, 0.248633891f},
-std::array<float,2>{0.148254842f, 0.721311212f},
-std::array<float,2>{0.650602221f, 0.412372857f},
-std::array<float,2>{0.615445852f, 0.551046133f},
-std::array<float,2>{0.100144349f, 0.338825047f},
-std::array<float,2>{0.387888223f, 0.964201152f},
-std::array<float,2>{0.954188466f, 0.108026154f},
-std::array<float,2>{0.906957269f, 0.68420732f},
-std::array<float,2>{0.448723793f, 0.477155745f},
-std::array<float,2>{0.0591208488f, 0.838024676f},
-std::array<float,2>{0.543105245f, 0.159903139f},
-std::array<float,2>{0.714199007f, 0.902175188f},
-std::array<float,2>{0.195590124f, 0.0509857014f},
-std::array<float,2>{0.329228103f, 0.598469973f},
-std::array<float,2>{0.864031255f, 0.288095534f},
-std::array<float,2>{0.756815076f, 0.891930938f},
-std::array<float,2>{0.259912133f, 0.0595641844f},
-std::array<float,2>{0.127348587f, 0.608557701f},
-std::array<float,2>{0.640344501f, 0.296631277f},
-std::array<float,2>{0.60556066f, 0.676791608f},
-std::array<float,2>{0.116874754f, 0.475847453f},
-std::array<float,2>{0.398935616f, 0.833235919f},
-std::array<float,2>{0.947824955f, 0.16908887f},
-std::array<float,2>{0.923482895f, 0.559713066f},
-std::array<float,2>{0.46789676f, 0.330990851f},
-std::array<float,2>{0.0422558077f, 0.955329657f},
-std::array<float,2>{0.557406723f, 0.0987982303f},
-std::array<float,2>{0.700225055f, 0.795942485f},
-std::array<float,2>{0.215304032f, 0.234417036f},
-std::array<float,2>{0.31378001f, 0.732940376f},
-std::array<float,2>{0.858825803f, 0.414581478f},
-std::array<float,2>{0.968845963f, 0.855464458f},
-std::array<float,2>{0.412682176f, 0.135722235f},
-std::array<float,2>{0.0912488922f, 0.640595675f},
-std::array<float,2>{0.58865577f, 0.441948831f},
-std::array<float,2>{0.659289837f, 0.569649577f},
-std::array<float,2>{0.16186741f, 0.277597636f},
-std::array<float,2>{0.286342978f, 0.927383363f},
-std::array<float,2>{0.785489857f, 0.0010770479f},
-std::array<float,2>{0.813990593f, 0.706911564f},
-std::array<float,2>{0.3579579f, 0.389326692f},
-std::array<float,2>{0.243296072f, 0.779486716f},
-std::array<float,2>{0.745409608f, 0.189852774f},
-std::array<float,2>{0.518656373f, 0.995478988f},
-std::array<float,2>{0.00563203497f, 0.073681578f},
-std::array<float,2>{0.484161317f, 0.524583578f},
-std::array<float,2>{0.905051172f, 0.35142222f},
-std::array<float,2>{0.88158083f, 0.947736979f},
-std::array<float,2>{0.495849818f, 0.117243454f},
-std::array<float,2>{0.0271666255f, 0.5361467f},
-std::array<float,2>{0.508943379f, 0.318812907f},
-std::array<float,2>{0.724292815f, 0.740272999f},
-std::array<float,2>{0.226964772f, 0.423459858f},
-std::array<float,2>{0.364504993f, 0.809518218f},
-std::array<float,2>{0.831666172f, 0.228615388f},
-std::array<float,2>{0.809158862f, 0.620089412f},
-std::array<float,2>{0.310762048f, 0.309189439f},
-std::array<float,2>{0.182160288f, 0.882546067f},
-std::array<float,2>{0.682059765f, 0.0458277427f},
-std::array<float,2>{0.562971532f, 0.821246147f},
-std::array<float,2>{0.0639581829f, 0.181356207f},
-std::array<float,2>{0.433648556f, 0.667237401f},
-std::array<float,2>{0.996233165f, 0.484450251f},
-std::array<float,2>{0.859834135f, 0.765597224f},
-std::array<float,2>{0.334561229f, 0.217622533f},
-std::array<float,2>{0.201753706f, 0.693755031f},
-std::array<float,2>{0.716202617f, 0.401913702f},
-std::array<float,2>{0.540565729f, 0.502113998f},
-std::array<float,2>{0.0571935959f, 0.373636067f},
-std::array<float,2>{0.450842857f, 0.972313225f},
-std::array<float,2>{0.911898971f, 0.0842898265f},
-std::array<float,2>{0.960692823f, 0.651072502f},
-std::array<float,2>{0.383974731f, 0.455573201f},
-std::array<float,2>{0.0948164389f, 0.873114765f},
-std::array<float,2>{0.612336695f, 0.150476962f},
-std::array<float,2>{0.655001879f, 0.911927283f},
-std::array<float,2>{0.142912626f, 0.0185124893f},
-std::array<float,2>{0.273677826f, 0.583073497f},
-std::array<float,2>{0.773391128f, 0.263396859f},
-std::array<float,2>{0.838567138f, 0.979441762f},
-std::array<float,2>{0.370780349f, 0.091742523f},
-std::array<float,2>{0.222591981f, 0.511554539f},
-std::array<float,2>{0.729791284f, 0.364781141f},
-std::array<float,2>{0.502289653f, 0.699686229f},
-std::array<float,2>{0.0157631636f, 0.396288455f},
-std::array<float,2>{0.489818007f, 0.752355933f},
-std::array<float,2>{0.88654691f, 0.21055223f},
-std::array<float,2>{0.988067627f, 0.5906775f},
-std::array<float,2>{0.427154034f, 0.254736423f},
-std::array<float,2>{0.0732403919f, 0.919035554f},
-std::array<float,2>{0.571782708f, 0.0235031135f},
-std::array<float,2>{0.673538089f, 0.866978765f},
-std::array<float,2>{0.173771992f, 0.144936159f},
-std::array<float,2>{0.304516286f, 0.648409188f},
-std::array<float,2>{0.802747369f, 0.467960954f},
-std::array<float,2>{0.919564366f, 0.801875174f},
-std::array<float,2>{0.441083848f, 0.221107349f},
-std::array<float,2>{0.0519020632f, 0.74741441f},
-std::array<float,2>{0.534570515f, 0.431340754f},
-std::array<float,2>{0.706141412f, 0.54405421f},
-std::array<float,2>{0.193755656f, 0.327121735f},
-std::array<float,2>{0.338627696f, 0.941300213f},
-std::array<float,2>{0.874580204f, 0.112734765f},
-std::array<float,2>{0.776667178f, 0.660675228f},
-std::array<float,2>{0.27054441f, 0.494312257f},
-std::array<float,2>{0.154765129f, 0.816262126f},
-std::array<float,2>{0.640900373f, 0.176615149f},
-std::array<float,2>{0.620657146f, 0.883087277f},
-std::array<float,2>{0.103985272f, 0.032011278f},
-std::array<float,2>{0.375140965f, 0.610845864f},
-std::array<float,2>{0.962206185f, 0.299626052f},
-std::array<float,2>{0.944250882f, 0.930294454f},
-std::array<float,2>{0.397264183f, 0.0122892791f},
-std::array<float,2>{0.118015647f, 0.577575207f},
-std::array<float,2>{0.596873641f, 0.267145813f},
-std::array<float,2>{0.62683183f, 0.632397413f},
-std::array<float,2>{0.133762971f, 0.4489429f},
-std::array<float,2>{0.256026655f, 0.848904669f},
-std::array<float,2>{0.760713995f, 0.126006901f},
-std::array<float,2>{0.848320663f, 0.516078591f},
-std::array<float,2>{0.324741781f, 0.351828396f},
-std::array<float,2>{0.204702809f, 0.987352133f},
-std::array<float,2>{0.68848443f, 0.0692916289f},
-std::array<float,2>{0.553460956f, 0.76818043f},
-std::array<float,2>{0.0345938057f, 0.199738517f},
-std::array<float,2>{0.457586557f, 0.71703583f},
-std::array<float,2>{0.937358677f, 0.378915101f},
-std::array<float,2>{0.790974379f, 0.841977239f},
-std::array<float,2>{0.290688843f, 0.162984937f},
-std::array<float,2>{0.167675093f, 0.680584073f},
-std::array<float,2>{0.668488026f, 0.483805835f},
-std::array<float,2>{0.584688067f, 0.596715152f},
-std::array<float,2>{0.0816150755f, 0.284399688f},
-std::array<float,2>{0.414093763f, 0.905208111f},
-std::array<float,2>{0.978372991f, 0.050618127f},
-std::array<float,2>{0.894592047f, 0.725084245f},
-std::array<float,2>{0.475407511f, 0.407831281f},
-std::array<float,2>{0.00844474975f, 0.786107302f},
-std::array<float,2>{0.529749632f, 0.243596956f},
-std::array<float,2>{0.736284614f, 0.966383219f},
-std::array<float,2>{0.235652313f, 0.105351873f},
-std::array<float,2>{0.345046967f, 0.550593913f},
-std::array<float,2>{0.826688111f, 0.340768844f},
-std::array<float,2>{0.78123647f, 0.998313665f},
-std::array<float,2>{0.269464791f, 0.0756138042f},
-std::array<float,2>{0.150826246f, 0.528868794f},
-std::array<float,2>{0.647068977f, 0.343868345f},
-std::array<float,2>{0.622988999f, 0.709270477f},
-std::array<float,2>{0.105934031f, 0.386547536f},
-std::array<float,2>{0.382626593f, 0.775771499f},
-std::array<float,2>{0.966962397f, 0.19218488f},
-std::array<float,2>{0.914114535f, 0.563703656f},
-std::array<float,2>{0.442149669f, 0.276038408f},
-std::array<float,2>{0.0482078157f, 0.921961427f},
-std::array<float,2>{0.535195768f, 0.00400058599f},
-std::array<float,2>{0.70850867f, 0.858101845f},
-std::array<float,2>{0.190491542f, 0.137778178f},
-std::array<float,2>{0.341398478f, 0.634746253f},
-std::array<float,2>{0.868558586f, 0.439721525f},
-std::array<float,2>{0.989848197f, 0.790518045f},
-std::array<float,2>{0.424007446f, 0.239708006f},
-std::array<float,2>{0.0744264498f, 0.728523552f},
-std::array<float,2>{0.577311158f, 0.420520306f},
-std::array<float,2>{0.676837862f, 0.555289447f},
-std::array<float,2>{0.176324159f, 0.334285796f},
-std::array<float,2>{0.300197482f, 0.96055764f},
-std::array<float,2>{0.797600806f, 0.0967379436f},
-std::array<float,2>{0.843300104f, 0.675474823f},
-std::array<float,2>{0.371281236f, 0.47192362f},
-std::array<float,2>{0.224301651f, 0.829929352f},
-std::array<float,2>{0.731532454f, 0.165789008f},
-std::array<float,2>{0.507623911f, 0.895574093f},
-std::array<float,2>{0.0210792497f, 0.0582958274f},
-std::array<float,2>{0.485181212f, 0.603242159f},
-std::array<float,2>{0.888934612f, 0.290373683f},
-std::array<float,2>{0.891143918f, 0.908336103f},
-std::array<float,2>{0.472507834f, 0.0199524034f},
-std::array<float,2>{0.0123818731f, 0.5797171f},
-std::array<float,2>{0.526901543f, 0.258901924f},
-std::array<float,2>{0.740996659f, 0.655006945f},
-std::array<float,2>{0.241713598f, 0.459974974f},
-std::array<float,2>{0.351475894f, 0.869364083f},
-std::array<float,2>{0.822001457f, 0.154286087f},
-std::array<float,2>{0.79299587f, 0.505406439f},
-std::array<float,2>{0.295522183f, 0.369232506f},
-std::array<float,2>{0.168645531f, 0.974182427f},
-std::array<float,2>{0.666876793f, 0.0807210356f},
-std::array<float,2>{0.581168532f, 0.759906948f},
-std::array<float,2>{0.0853661597f, 0.210986838f},
-std::array<float,2>{0.421043217f, 0.688530684f},
-std::array<float,2>{0.982964575f, 0.404670417f},
-std::array<float,2>{0.847591102f, 0.826681077f},
-std::array<float,2>{0.321096867f, 0.186930969f},
-std::array<float,2>{0.210541636f, 0.671363413f},
-std::array<float,2>{0.694419622f, 0.488843799f},
-std::array<float,2>{0.54911238f, 0.623832941f},
-std::array<float,2>{0.0387349688f, 0.306484282f},
-std::array<float,2>{0.454452038f, 0.878706992f},
-std::array<float,2>{0.93061763f, 0.04026407f},
-std::array<float,2>{0.938088119f, 0.734817743f},
-std::array<float,2>{0.39068234f, 0.425960183f},
-std::array<float,2>{0.12296351f, 0.807083547f},
-std::array<float,2>{0.59999001f, 0.233968496f},
-std::array<float,2>{0.629218042f, 0.950302601f},
-std::array<float,2>{0.137434974f, 0.122882925f},
-std::array<float,2>{0.250720769f, 0.532106817f},
-std::array<float,2>{0.763736546f, 0.316092074f},
-std::array<float,2>{0.816569269f, 0.889582098f},
-std::array<float,2>{0.353724003f, 0.0372285023f},
-std::array<float,2>{0.247332692f, 0.614402115f},
-std::array<float,2>{0.749405324f, 0.30278492f},
-std::array<float,2>{0.51987493f, 0.657123327f},
-std::array<float,2>{0.00126117794f, 0.499408096f},
-std::array<float,2>{0.477606803f, 0.818517983f},
-std::array<float,2>{0.899755895f, 0.17271398f},
-std::array<float,2>{0.973268569f, 0.54172796f},
-std::array<float,2>{0.408593923f, 0.321114302f},
-std::array<float,2>{0.0865279958f, 0.941932499f},
-std::array<float,2>{0.59139359f, 0.115926906f},
-std::array<float,2>{0.661521137f, 0.799144387f},
-std::array<float,2>{0.159936234f, 0.226393551f},
-std::array<float,2>{0.281401098f, 0.745444536f},
-std::array<float,2>{0.783451855f, 0.434093773f},
-std::array<float,2>{0.928337872f, 0.862410665f},
-std::array<float,2>{0.462225795f, 0.141126513f},
-std::array<float,2>{0.0456599891f, 0.642828524f},
-std::array<float,2>{0.562146008f, 0.461321354f},
-std::array<float,2>{0.699051142f, 0.589744627f},
-std::array<float,2>{0.212150931f, 0.250788867f},
-std::array<float,2>{0.320103824f, 0.915492177f},
-std::array<float,2>{0.854840755f, 0.0292063486f},
-std::array<float,2>{0.753592253f, 0.696086287f},
-std::array<float,2>{0.263457358f, 0.391292632f},
-std::array<float,2>{0.129052654f, 0.755724072f},
-std::array<float,2>{0.634064555f, 0.206770778f},
-std::array<float,2>{0.605353415f, 0.98175329f},
-std::array<float,2>{0.113229208f, 0.0880406126f},
-std::array<float,2>{0.404410452f, 0.513864338f},
-std::array<float,2>{0.951912582f, 0.363254547f},
-std::array<float,2>{0.955643177f, 0.962022007f},
-std::array<float,2>{0.390155762f, 0.106718026f},
-std::array<float,2>{0.0988163874f, 0.554102123f},
-std::array<float,2>{0.614776909f, 0.33627522f},
-std::array<float,2>{0.648887992f, 0.719342172f},
-std::array<float,2>{0.145897254f, 0.41133979f},
-std::array<float,2>{0.280172378f, 0.785076499f},
-std::array<float,2>{0.768330276f, 0.246476829f},
-std::array<float,2>{0.86558044f, 0.601376772f},
-std::array<float,2>{0.330469787f, 0.286624104f},
-std::array<float,2>{0.199011341f, 0.899003029f},
-std::array<float,2>{0.711043894f, 0.0545858443f},
-std::array<float,2>{0.544928253f, 0.835977793f},
-std::array<float,2>{0.0613227002f, 0.15702346f},
-std::array<float,2>{0.445968866f, 0.686503828f},
-std::array<float,2>{0.910027802f, 0.479395092f},
-std::array<float,2>{0.807241499f, 0.773069084f},
-std::array<float,2>{0.308068305f, 0.19704105f},
-std::array<float,2>{0.184679523f, 0.711911201f},
-std::array<float,2>{0.683910966f, 0.375827342f},
-std::array<float,2>{0.567863226f, 0.519622087f},
-std::array<float,2>{0.0691293776f, 0.355630934f},
-std::array<float,2>{0.43186456f, 0.990338624f},
-std::array<float,2>{0.994541228f, 0.0651336163f},
-std::array<float,2>{0.877162755f, 0.62720412f},
-std::array<float,2>{0.499739647f, 0.44968015f},
-std::array<float,2>{0.0301452f, 0.847339034f},
-std::array<float,2>{0.515350103f, 0.129168525f},
-std::array<float,2>{0.722453833f, 0.934522271f},
-std::array<float,2>{0.231657594f, 0.00825921725f},
-std::array<float,2>{0.361603528f, 0.573962569f},
-std::array<float,2>{0.832234919f, 0.270655066f},
-std::array<float,2>{0.788725317f, 0.928198278f},
-std::array<float,2>{0.288184494f, 0.00245412346f},
-std::array<float,2>{0.162814707f, 0.567052603f},
-std::array<float,2>{0.656879783f, 0.281200111f},
-std::array<float,2>{0.587510943f, 0.637303114f},
-std::array<float,2>{0.0937139988f, 0.443946928f},
-std::array<float,2>{0.410583258f, 0.852424443f},
-std::array<float,2>{0.971129298f, 0.132906586f},
-std::array<float,2>{0.903883278f, 0.526848495f},
-std::array<float,2>{0.48108539f, 0.347743958f},
-std::array<float,2>{0.00619578408f, 0.993333519f},
-std::array<float,2>{0.515817225f, 0.0709765777f},
-std::array<float,2>{0.74403125f, 0.777763188f},
-std::array<float,2>{0.245726228f, 0.1889534f},
-std::array<float,2>{0.355981618f, 0.703325033f},
-std::array<float,2>{0.814967096f, 0.386784285f},
-std::array<float,2>{0.945554912f, 0.834335327f},
-std::array<float,2>{0.401206285f, 0.170792893f},
-std::array<float,2>{0.114419967f, 0.679479659f},
-std::array<float,2>{0.608534157f, 0.473346591f},
-std::array<float,2>{0.636809528f, 0.606175482f},
-std::array<float,2>{0.126715988f, 0.293654442f},
-std::array<float,2>{0.258806258f, 0.892993271f},
-std::array<float,2>{0.754274964f, 0.0612781085f},
-std::array<float,2>{0.855910003f, 0.731365979f},
-std::array<float,2>{0.314831465f, 0.417093068f},
-std::array<float,2>{0.217209503f, 0.794588923f},
-std::array<float,2>{0.702448189f, 0.236508086f},
-std::array<float,2>{0.556109667f, 0.954606414f},
-std::array<float,2>{0.0393101834f, 0.100568824f},
-std::array<float,2>{0.465548545f, 0.560947001f},
-std::array<float,2>{0.925508022f, 0.330054164f},
-std::array<float,2>{0.912602127f, 0.970175862f},
-std::array<float,2>{0.452500761f, 0.0826117396f},
-std::array<float,2>{0.0548960716f, 0.500014901f},
-std::array<float,2>{0.541647971f, 0.372568429f},
-std::array<float,2>{0.717813313f, 0.692735791f},
-std::array<float,2>{0.201074287f, 0.399079829f},
-std::array<float,2>{0.33381775f, 0.763257802f},
-std::array<float,2>{0.862663448f, 0.215595841f},
-std::array<float,2>{0.76974225f, 0.584583104f},
-std::array<float,2>{0.276956558f, 0.265529305f},
-std::array<float,2>{0.142225504f, 0.913003922f},
-std::array<float,2>{0.653617501f, 0.0175765436f},
-std::array<float,2>{0.610996783f, 0.872623682f},
-std::array<float,2>{0.0969066024f, 0.150289908f},
-std::array<float,2>{0.386362344f, 0.649002492f},
-std::array<float,2>{0.957449794f, 0.45355913f},
-std::array<float,2>{0.828523219f, 0.810736656f},
-std::array<float,2>{0.36655724f, 0.227394149f},
-std::array<float,2>{0.230464742f, 0.738767326f},
-std::array<float,2>{0.72467345f, 0.424742699f},
-std::array<float,2>{0.511540949f, 0.538670719f},
-std::array<float,2>{0.0251967385f, 0.31695199f},
-std::array<float,2>{0.493509948f, 0.94583112f},
-std::array<float,2>{0.879437327f, 0.120104939f},
-std::array<float,2>{0.998598516f, 0.665437758f},
-std::array<float,2>{0.436829239f, 0.487756491f},
-std::array<float,2>{0.0646074414f, 0.824111044f},
-std::array<float,2>{0.564980567f, 0.183216527f},
-std::array<float,2>{0.681507528f, 0.879315078f},
-std::array<float,2>{0.179874867f, 0.0442686342f},
-std::array<float,2>{0.309965283f, 0.617376029f},
-std::array<float,2>{0.811667442f, 0.312340587f},
-std::array<float,2>{0.871118009f, 0.938854873f},
-std::array<float,2>{0.336659908f, 0.110344723f},
-std::array<float,2>{0.191675216f, 0.546819746f},
-std::array<float,2>{0.703885257f, 0.324620247f},
-std::array<float,2>{0.531880438f, 0.74973011f},
-std::array<float,2>{0.053461235f, 0.432631642f},
-std::array<float,2>{0.438335001f, 0.803048015f},
-std::array<float,2>{0.921366453f, 0.22056447f},
-std::array<float,2>{0.963180125f, 0.612159491f},
-std::array<float,2>{0.378346771f, 0.298805445f},
-std::array<float,2>{0.103165358f, 0.886079729f},
-std::array<float,2>{0.617294073f, 0.0340638459f},
-std::array<float,2>{0.64445883f, 0.814277709f},
-std::array<float,2>{0.153337985f, 0.17776534f},
-std::array<float,2>{0.272633255f, 0.662956178f},
-std::array<float,2>{0.774781406f, 0.493919075f},
-std::array<float,2>{0.884491682f, 0.750185251f},
-std::array<float,2>{0.492118597f, 0.20853433f},
-std::array<float,2>{0.0187080242f, 0.702921689f},
-std::array<float,2>{0.501944125f, 0.397782952f},
-std::array<float,2>{0.726981521f, 0.508653641f},
-std::array<float,2>{0.218845129f, 0.366413474f},
-std::array<float,2>{0.368852884f, 0.977182984f},
-std::array<float,2>{0.836904764f, 0.0936609134f},
-std::array<float,2>{0.802576423f, 0.646104634f},
-std::array<float,2>{0.300891042f, 0.466447294f},
-std::array<float,2>{0.174155027f, 0.864479661f},
-std::array<float,2>{0.675091863f, 0.147359565f},
-std::array<float,2>{0.573117554f, 0.921175838f},
-std::array<float,2>{0.0712614432f, 0.0265324991f},
-std::array<float,2>{0.428977966f, 0.591939747f},
-std::array<float,2>{0.985907078f, 0.257367998f},
-std::array<float,2>{0.980207503f, 0.903786123f},
-std::array<float,2>{0.416757554f, 0.0473315753f},
-std::array<float,2>{0.0794228241f, 0.593824923f},
-std::array<float,2>{0.582531512f, 0.282465219f},
-std::array<float,2>{0.671651244f, 0.683110833f},
-std::array<float,2>{0.16572094f, 0.481372118f},
-std::array<float,2>{0.292436481f, 0.840823054f},
-std::array<float,2>{0.792635381f, 0.160179183f},
-std::array<float,2>{0.825907409f, 0.548277795f},
-std::array<float,2>{0.346075088f, 0.342382044f},
-std::array<float,2>{0.237206563f, 0.968246341f},
-std::array<float,2>{0.737568557f, 0.102008902f},
-std::array<float,2>{0.528826475f, 0.788919508f},
-std::array<float,2>{0.0103389518f, 0.244717121f},
-std::array<float,2>{0.473145366f, 0.722826421f},
-std::array<float,2>{0.896640182f, 0.409156412f},
-std::array<float,2>{0.758563995f, 0.850220859f},
-std::array<float,2>{0.255498767f, 0.128631815f},
-std::array<float,2>{0.135058686f, 0.630492389f},
-std::array<float,2>{0.627174437f, 0.446531922f},
-std::array<float,2>{0.593780518f, 0.574770868f},
-std::array<float,2>{0.12103679f, 0.268602014f},
-std::array<float,2>{0.395651191f, 0.932011724f},
-std::array<float,2>{0.942513704f, 0.0143764867f},
-std::array<float,2>{0.9337672f, 0.715036452f},
-std::array<float,2>{0.460726738f, 0.381519556f},
-std::array<float,2>{0.0323829725f, 0.766346574f},
-std::array<float,2>{0.551460445f, 0.201934561f},
-std::array<float,2>{0.690285742f, 0.984378994f},
-std::array<float,2>{0.205401301f, 0.0670551658f},
-std::array<float,2>{0.326911122f, 0.518990159f},
-std::array<float,2>{0.850640237f, 0.353919864f},
-std::array<float,2>{0.774558961f, 0.939855039f},
-std::array<float,2>{0.272763133f, 0.111577593f},
-std::array<float,2>{0.153734058f, 0.543154895f},
-std::array<float,2>{0.644096792f, 0.328008205f},
-std::array<float,2>{0.61761415f, 0.746366262f},
-std::array<float,2>{0.103358731f, 0.430570424f},
-std::array<float,2>{0.378128409f, 0.80154866f},
-std::array<float,2>{0.962964416f, 0.221923813f},
-std::array<float,2>{0.921109438f, 0.610263646f},
-std::array<float,2>{0.438195705f, 0.300349772f},
-std::array<float,2>{0.0534869358f, 0.884763002f},
-std::array<float,2>{0.532115817f, 0.0331709944f},
-std::array<float,2>{0.703713298f, 0.8146106f},
-std::array<float,2>{0.191521198f, 0.176830947f},
-std::array<float,2>{0.336900175f, 0.661410153f},
-std::array<float,2>{0.871473968f, 0.495749205f},
-std::array<float,2>{0.986188173f, 0.753126264f},
-std::array<float,2>{0.428944916f, 0.209952354f},
-std::array<float,2>{0.0709831789f, 0.700745463f},
-std::array<float,2>{0.572909296f, 0.394561529f},
-std::array<float,2>{0.674823046f, 0.510306418f},
-std::array<float,2>{0.174004778f, 0.363666564f},
-std::array<float,2>{0.301227927f, 0.98012954f},
-std::array<float,2>{0.802485049f, 0.0903936327f},
-std::array<float,2>{0.836606562f, 0.646812141f},
-std::array<float,2>{0.368901432f, 0.467215866f},
-std::array<float,2>{0.219115853f, 0.865768373f},
-std::array<float,2>{0.726653516f, 0.145634457f},
-std::array<float,2>{0.501507878f, 0.918678164f},
-std::array<float,2>{0.0188699085f, 0.0250837319f},
-std::array<float,2>{0.491725773f, 0.591079772f},
-std::array<float,2>{0.884739161f, 0.255637944f},
-std::array<float,2>{0.896793604f, 0.905840218f},
-std::array<float,2>{0.473428279f, 0.048994489f},
-std::array<float,2>{0.0105405292f, 0.595740855f},
-std::array<float,2>{0.529289305f, 0.283867419f},
-std::array<float,2>{0.737524271f, 0.680993915f},
-std::array<float,2>{0.236887708f, 0.482603461f},
-std::array<float,2>{0.345912129f, 0.843605638f},
-std::array<float,2>{0.826159239f, 0.163563952f},
-std::array<float,2>{0.792913854f, 0.54910475f},
-std::array<float,2>{0.292008162f, 0.341658473f},
-std::array<float,2>{0.165784374f, 0.965713561f},
-std::array<float,2>{0.671510935f, 0.104156576f},
-std::array<float,2>{0.582902968f, 0.786898196f},
-std::array<float,2>{0.0793081224f, 0.242576674f},
-std::array<float,2>{0.416599035f, 0.725586295f},
-std::array<float,2>{0.98041904f, 0.406335264f},
-std::array<float,2>{0.851009786f, 0.848606586f},
-std::array<float,2>{0.326785892f, 0.125254691f},
-std::array<float,2>{0.205133796f, 0.631240427f},
-std::array<float,2>{0.689982653f, 0.447969824f},
-std::array<float,2>{0.551544487f, 0.57641381f},
-std::array<float,2>{0.0324836522f, 0.265646756f},
-std::array<float,2>{0.460488468f, 0.931094766f},
-std::array<float,2>{0.933937252f, 0.0135663915f},
-std::array<float,2>{0.942822397f, 0.717897832f},
-std::array<float,2>{0.395969003f, 0.380592167f},
-std::array<float,2>{0.120720744f, 0.769201577f},
-std::array<float,2>{0.594223857f, 0.201054707f},
-std::array<float,2>{0.627434611f, 0.986670017f},
-std::array<float,2>{0.134977445f, 0.0696797222f},
-std::array<float,2>{0.255771667f, 0.517208874f},
-std::array<float,2>{0.758349538f, 0.352870345f},
-std::array<float,2>{0.815308571f, 0.926001787f},
-std::array<float,2>{0.356279343f, 0.000497185683f},
-std::array<float,2>{0.245971039f, 0.569330454f},
-std::array<float,2>{0.743666768f, 0.279269248f},
-std::array<float,2>{0.515869558f, 0.638990998f},
-std::array<float,2>{0.00586537039f, 0.442583531f},
-std::array<float,2>{0.481250614f, 0.853799343f},
-std::array<float,2>{0.904114842f, 0.13634941f},
-std::array<float,2>{0.970843494f, 0.524183989f},
-std::array<float,2>{0.410381824f, 0.349760443f},
-std::array<float,2>{0.0933153108f, 0.994248271f},
-std::array<float,2>{0.587673306f, 0.0726918876f},
-std::array<float,2>{0.657023013f, 0.780675232f},
-std::array<float,2>{0.162991151f, 0.191398114f},
-std::array<float,2>{0.288462013f, 0.705360711f},
-std::array<float,2>{0.78888011f, 0.390247911f},
-std::array<float,2>{0.925622642f, 0.832356215f},
-std::array<float,2>{0.465615779f, 0.168040603f},
-std::array<float,2>{0.0392116271f, 0.676617563f},
-std::array<float,2>{0.555669308f, 0.474609584f},
-std::array<float,2>{0.702207446f, 0.60747093f},
-std::array<float,2>{0.216809049f, 0.29503572f},
-std::array<float,2>{0.314470351f, 0.891014338f},
-std::array<float,2>{0.85557574f, 0.059702076f},
-std::array<float,2>{0.754004121f, 0.73341012f},
-std::array<float,2>{0.259234935f, 0.415814698f},
-std::array<float,2>{0.126588359f, 0.795219362f},
-std::array<float,2>{0.637117505f, 0.236274242f},
-std::array<float,2>{0.608680725f, 0.956478417f},
-std::array<float,2>{0.114520453f, 0.097727485f},
-std::array<float,2>{0.401048064f, 0.559442341f},
-std::array<float,2>{0.945733845f, 0.331690371f},
-std::array<float,2>{0.957224548f, 0.970788717f},
-std::array<float,2>{0.386573255f, 0.0850050449f},
-std::array<float,2>{0.0969380662f, 0.503421605f},
-std::array<float,2>{0.611280918f, 0.374643475f},
-std::array<float,2>{0.653499961f, 0.694428146f},
-std::array<float,2>{0.142379075f, 0.401176482f},
-std::array<float,2>{0.277180701f, 0.764316142f},
-std::array<float,2>{0.769960165f, 0.218112588f},
-std::array<float,2>{0.862457514f, 0.582640111f},
-std::array<float,2>{0.33370629f, 0.262048006f},
-std::array<float,2>{0.200847134f, 0.910392463f},
-std::array<float,2>{0.718206227f, 0.0190358236f},
-std::array<float,2>{0.541881084f, 0.874427378f},
-std::array<float,2>{0.0550992973f, 0.151662648f},
-std::array<float,2>{0.452171654f, 0.652247667f},
-std::array<float,2>{0.912932873f, 0.456830144f},
-std::array<float,2>{0.811800539f, 0.809681773f},
-std::array<float,2>{0.309760332f, 0.230384305f},
-std::array<float,2>{0.179954827f, 0.74151969f},
-std::array<float,2>{0.681206405f, 0.422350228f},
-std::array<float,2>{0.5652408f, 0.535855591f},
-std::array<float,2>{0.0648128763f, 0.320276529f},
-std::array<float,2>{0.436549067f, 0.94851172f},
-std::array<float,2>{0.998882711f, 0.118461527f},
-std::array<float,2>{0.879660249f, 0.666349053f},
-std::array<float,2>{0.493223608f, 0.485715985f},
-std::array<float,2>{0.025041895f, 0.822162271f},
-std::array<float,2>{0.511436462f, 0.179935217f},
-std::array<float,2>{0.725058436f, 0.881033957f},
-std::array<float,2>{0.230129763f, 0.0466296934f},
-std::array<float,2>{0.366316617f, 0.620845795f},
-std::array<float,2>{0.828358889f, 0.310084462f},
-std::array<float,2>{0.783246875f, 0.888426423f},
-std::array<float,2>{0.281698912f, 0.0365082733f},
-std::array<float,2>{0.159760699f, 0.615521073f},
-std::array<float,2>{0.661337137f, 0.302184224f},
-std::array<float,2>{0.591602921f, 0.659145415f},
-std::array<float,2>{0.0868650898f, 0.496376455f},
-std::array<float,2>{0.408369958f, 0.816930652f},
-std::array<float,2>{0.973427892f, 0.174642414f},
-std::array<float,2>{0.899482489f, 0.539601564f},
-std::array<float,2>{0.478021383f, 0.323917419f},
-std::array<float,2>{0.00117133453f, 0.944237053f},
-std::array<float,2>{0.519559622f, 0.11372529f},
-std::array<float,2>{0.749249458f, 0.7979725f},
-std::array<float,2>{0.247194469f, 0.222844765f},
-std::array<float,2>{0.353911996f, 0.742406368f},
-std::array<float,2>{0.816871405f, 0.436129272f},
-std::array<float,2>{0.951828063f, 0.861256361f},
-std::array<float,2>{0.404696882f, 0.143582627f},
-std::array<float,2>{0.112833351f, 0.642393947f},
-std::array<float,2>{0.605052888f, 0.463229477f},
-std::array<float,2>{0.633985996f, 0.586714149f},
-std::array<float,2>{0.129371777f, 0.252828211f},
-std::array<float,2>{0.263322145f, 0.917926788f},
-std::array<float,2>{0.753707051f, 0.0308193173f},
-std::array<float,2>{0.854601741f, 0.698970318f},
-std::array<float,2>{0.32004115f, 0.393889219f},
-std::array<float,2>{0.212198645f, 0.756880522f},
-std::array<float,2>{0.698879004f, 0.204895914f},
-std::array<float,2>{0.562318444f, 0.984353125f},
-std::array<float,2>{0.0454342626f, 0.0859550685f},
-std::array<float,2>{0.462109268f, 0.513638914f},
-std::array<float,2>{0.928522587f, 0.360761523f},
-std::array<float,2>{0.909678817f, 0.963665068f},
-std::array<float,2>{0.446171373f, 0.109118626f},
-std::array<float,2>{0.0612029359f, 0.552157044f},
-std::array<float,2>{0.54518646f, 0.339161903f},
-std::array<float,2>{0.711257577f, 0.721682906f},
-std::array<float,2>{0.198829487f, 0.413214684f},
-std::array<float,2>{0.330280572f, 0.781499207f},
-std::array<float,2>{0.865358829f, 0.2494964f},
-std::array<float,2>{0.768082976f, 0.599090397f},
-std::array<float,2>{0.280000389f, 0.287964731f},
-std::array<float,2>{0.145733476f, 0.901292622f},
-std::array<float,2>{0.648527324f, 0.0522159934f},
-std::array<float,2>{0.615146637f, 0.838935494f},
-std::array<float,2>{0.0991135985f, 0.159151778f},
-std::array<float,2>{0.390481383f, 0.685351789f},
-std::array<float,2>{0.956009209f, 0.478475541f},
-std::array<float,2>{0.832404256f, 0.769992173f},
-std::array<float,2>{0.361502409f, 0.197693065f},
-std::array<float,2>{0.231701836f, 0.71412617f},
-std::array<float,2>{0.72226429f, 0.377816617f},
-std::array<float,2>{0.515465617f, 0.522585392f},
-std::array<float,2>{0.0299944896f, 0.357889771f},
-std::array<float,2>{0.499928802f, 0.989812553f},
-std::array<float,2>{0.87727958f, 0.0633076206f},
-std::array<float,2>{0.99420619f, 0.625736475f},
-std::array<float,2>{0.432021946f, 0.45202449f},
-std::array<float,2>{0.0690577477f, 0.845009446f},
-std::array<float,2>{0.567533851f, 0.131179348f},
-std::array<float,2>{0.683725178f, 0.935685158f},
-std::array<float,2>{0.185042247f, 0.00997171178f},
-std::array<float,2>{0.30774188f, 0.571647644f},
-std::array<float,2>{0.807525456f, 0.273265004f},
-std::array<float,2>{0.868336558f, 0.997194946f},
-std::array<float,2>{0.341621399f, 0.0780685768f},
-std::array<float,2>{0.190849736f, 0.531041741f},
-std::array<float,2>{0.708939731f, 0.346844673f},
-std::array<float,2>{0.535466194f, 0.708780229f},
-std::array<float,2>{0.0478627793f, 0.383723468f},
-std::array<float,2>{0.441987693f, 0.775076449f},
-std::array<float,2>{0.914495826f, 0.193681777f},
-std::array<float,2>{0.967152417f, 0.566132009f},
-std::array<float,2>{0.382374227f, 0.27375716f},
-std::array<float,2>{0.105540037f, 0.923891306f},
-std::array<float,2>{0.622596502f, 0.00631571608f},
-std::array<float,2>{0.647325099f, 0.855602145f},
-std::array<float,2>{0.150613263f, 0.139791399f},
-std::array<float,2>{0.269258916f, 0.635245562f},
-std::array<float,2>{0.780984998f, 0.437689215f},
-std::array<float,2>{0.888691843f, 0.791412175f},
-std::array<float,2>{0.485077709f, 0.24210234f},
-std::array<float,2>{0.0214600414f, 0.728504658f},
-std::array<float,2>{0.507534444f, 0.41867274f},
-std::array<float,2>{0.731746852f, 0.556938112f},
-std::array<float,2>{0.224488631f, 0.332289159f},
-std::array<float,2>{0.371358067f, 0.958627045f},
-std::array<float,2>{0.843568623f, 0.0939862803f},
-std::array<float,2>{0.797807813f, 0.673182249f},
-std::array<float,2>{0.299927443f, 0.469033957f},
-std::array<float,2>{0.176687837f, 0.831898332f},
-std::array<float,2>{0.677148819f, 0.167220667f},
-std::array<float,2>{0.577566862f, 0.897472739f},
-std::array<float,2>{0.0745549202f, 0.0554310828f},
-std::array<float,2>{0.424095094f, 0.604516625f},
-std::array<float,2>{0.990146518f, 0.291095048f},
-std::array<float,2>{0.983225524f, 0.907929778f},
-std::array<float,2>{0.421370268f, 0.0224019159f},
-std::array<float,2>{0.0851110145f, 0.581218362f},
-std::array<float,2>{0.581376672f, 0.261201113f},
-std::array<float,2>{0.66669035f, 0.653790474f},
-std::array<float,2>{0.168926418f, 0.457418233f},
-std::array<float,2>{0.295836627f, 0.868109107f},
-std::array<float,2>{0.793267071f, 0.155578047f},
-std::array<float,2>{0.822214365f, 0.50609678f},
-std::array<float,2>{0.351192951f, 0.367778659f},
-std::array<float,2>{0.242147282f, 0.974736869f},
-std::array<float,2>{0.740724504f, 0.0792356357f},
-std::array<float,2>{0.527274668f, 0.758963048f},
-std::array<float,2>{0.0125317695f, 0.213398814f},
-std::array<float,2>{0.472232193f, 0.691334486f},
-std::array<float,2>{0.891383588f, 0.403304636f},
-std::array<float,2>{0.764104843f, 0.826079845f},
-std::array<float,2>{0.250940889f, 0.184380293f},
-std::array<float,2>{0.137676179f, 0.669006467f},
-std::array<float,2>{0.629006028f, 0.491596341f},
-std::array<float,2>{0.599687278f, 0.622567594f},
-std::array<float,2>{0.122649297f, 0.308065653f},
-std::array<float,2>{0.391092658f, 0.875460148f},
-std::array<float,2>{0.93832612f, 0.0426062979f},
-std::array<float,2>{0.93019563f, 0.737969518f},
-std::array<float,2>{0.454131097f, 0.428417653f},
-std::array<float,2>{0.0389156751f, 0.806435883f},
-std::array<float,2>{0.548921764f, 0.23226051f},
-std::array<float,2>{0.694755554f, 0.951999128f},
-std::array<float,2>{0.210699216f, 0.124116048f},
-std::array<float,2>{0.320964903f, 0.533206224f},
-std::array<float,2>{0.847399354f, 0.312989265f},
-std::array<float,2>{0.803148746f, 0.978082955f},
-std::array<float,2>{0.304406971f, 0.0919950083f},
-std::array<float,2>{0.173386082f, 0.508944809f},
-std::array<float,2>{0.673675537f, 0.36582157f},
-std::array<float,2>{0.572113335f, 0.701902211f},
-std::array<float,2>{0.0729473829f, 0.396744519f},
-std::array<float,2>{0.426896691f, 0.751221597f},
-std::array<float,2>{0.987917125f, 0.207632288f},
-std::array<float,2>{0.886290073f, 0.593634129f},
-std::array<float,2>{0.490017354f, 0.25671041f},
-std::array<float,2>{0.0160299446f, 0.920354843f},
-std::array<float,2>{0.502095401f, 0.0260292403f},
-std::array<float,2>{0.729567468f, 0.86418581f},
-std::array<float,2>{0.222322583f, 0.148309022f},
-std::array<float,2>{0.371063679f, 0.644758344f},
-std::array<float,2>{0.838740885f, 0.465573996f},
-std::array<float,2>{0.962111592f, 0.804129303f},
-std::array<float,2>{0.375342101f, 0.219057977f},
-std::array<float,2>{0.103589833f, 0.748180032f},
-std::array<float,2>{0.620956123f, 0.431646228f},
-std::array<float,2>{0.640739739f, 0.545750797f},
-std::array<float,2>{0.154303715f, 0.325782806f},
-std::array<float,2>{0.270875901f, 0.938004911f},
-std::array<float,2>{0.776450992f, 0.111305803f},
-std::array<float,2>{0.874989629f, 0.664012074f},
-std::array<float,2>{0.33850351f, 0.493032545f},
-std::array<float,2>{0.193508074f, 0.813379586f},
-std::array<float,2>{0.706358194f, 0.179612339f},
-std::array<float,2>{0.534345567f, 0.885670304f},
-std::array<float,2>{0.0520927049f, 0.0341804735f},
-std::array<float,2>{0.441367954f, 0.612526715f},
-std::array<float,2>{0.919678628f, 0.297083408f},
-std::array<float,2>{0.937151432f, 0.933523953f},
-std::array<float,2>{0.457960039f, 0.0149719417f},
-std::array<float,2>{0.0341940783f, 0.575361669f},
-std::array<float,2>{0.553526402f, 0.268061697f},
-std::array<float,2>{0.688944876f, 0.629812539f},
-std::array<float,2>{0.204982474f, 0.446102262f},
-std::array<float,2>{0.324953318f, 0.850895286f},
-std::array<float,2>{0.848497152f, 0.127172753f},
-std::array<float,2>{0.760436416f, 0.518277466f},
-std::array<float,2>{0.256163269f, 0.355326384f},
-std::array<float,2>{0.133416623f, 0.985684991f},
-std::array<float,2>{0.626537979f, 0.0674522072f},
-std::array<float,2>{0.597143769f, 0.766905904f},
-std::array<float,2>{0.117762744f, 0.202177078f},
-std::array<float,2>{0.397039086f, 0.716167212f},
-std::array<float,2>{0.944024265f, 0.382483453f},
-std::array<float,2>{0.827134848f, 0.839982271f},
-std::array<float,2>{0.344882935f, 0.161240086f},
-std::array<float,2>{0.235496014f, 0.682383716f},
-std::array<float,2>{0.735914588f, 0.481955767f},
-std::array<float,2>{0.529512167f, 0.595373571f},
-std::array<float,2>{0.00866762735f, 0.281664282f},
-std::array<float,2>{0.475209415f, 0.902403533f},
-std::array<float,2>{0.895011961f, 0.0487211868f},
-std::array<float,2>{0.978086352f, 0.723650336f},
-std::array<float,2>{0.414327085f, 0.409472495f},
-std::array<float,2>{0.0818004161f, 0.787897408f},
-std::array<float,2>{0.584896564f, 0.245212913f},
-std::array<float,2>{0.668913662f, 0.967636824f},
-std::array<float,2>{0.167879835f, 0.102903619f},
-std::array<float,2>{0.291009814f, 0.547038436f},
-std::array<float,2>{0.790564537f, 0.342812866f},
-std::array<float,2>{0.858523548f, 0.893915057f},
-std::array<float,2>{0.313513964f, 0.061971806f},
-std::array<float,2>{0.215012848f, 0.60717243f},
-std::array<float,2>{0.700674474f, 0.294298857f},
-std::array<float,2>{0.557348967f, 0.677926719f},
-std::array<float,2>{0.0421895273f, 0.474592566f},
-std::array<float,2>{0.468099892f, 0.835473835f},
-std::array<float,2>{0.923699856f, 0.170932382f},
-std::array<float,2>{0.94805038f, 0.56210506f},
-std::array<float,2>{0.399260819f, 0.328610808f},
-std::array<float,2>{0.117070779f, 0.953291059f},
-std::array<float,2>{0.605822206f, 0.100774921f},
-std::array<float,2>{0.640430093f, 0.793537617f},
-std::array<float,2>{0.127059594f, 0.237422243f},
-std::array<float,2>{0.260195017f, 0.731918931f},
-std::array<float,2>{0.756428421f, 0.416338086f},
-std::array<float,2>{0.904881477f, 0.852592885f},
-std::array<float,2>{0.483976603f, 0.134157449f},
-std::array<float,2>{0.00546670798f, 0.637819409f},
-std::array<float,2>{0.518838108f, 0.444686383f},
-std::array<float,2>{0.745271266f, 0.567810118f},
-std::array<float,2>{0.243530229f, 0.279667318f},
-std::array<float,2>{0.358160496f, 0.929103911f},
-std::array<float,2>{0.814334154f, 0.00380639825f},
-std::array<float,2>{0.785230339f, 0.704170465f},
-std::array<float,2>{0.286391318f, 0.387902796f},
-std::array<float,2>{0.161733136f, 0.778744936f},
-std::array<float,2>{0.659547687f, 0.187687591f},
-std::array<float,2>{0.58859539f, 0.992563009f},
-std::array<float,2>{0.0910378024f, 0.0721629858f},
-std::array<float,2>{0.413011044f, 0.526040018f},
-std::array<float,2>{0.969139636f, 0.349077314f},
-std::array<float,2>{0.996445477f, 0.946573198f},
-std::array<float,2>{0.434074908f, 0.120191991f},
-std::array<float,2>{0.0635676757f, 0.537282348f},
-std::array<float,2>{0.562732875f, 0.317952275f},
-std::array<float,2>{0.681770623f, 0.739348114f},
-std::array<float,2>{0.18250975f, 0.425541669f},
-std::array<float,2>{0.3108643f, 0.812467575f},
-std::array<float,2>{0.809554279f, 0.227597132f},
-std::array<float,2>{0.831964135f, 0.61863035f},
-std::array<float,2>{0.364370555f, 0.310769469f},
-std::array<float,2>{0.22663261f, 0.880201399f},
-std::array<float,2>{0.724517107f, 0.043853797f},
-std::array<float,2>{0.509150386f, 0.822910964f},
-std::array<float,2>{0.0269778483f, 0.18215853f},
-std::array<float,2>{0.495827258f, 0.664174676f},
-std::array<float,2>{0.881657481f, 0.486667544f},
-std::array<float,2>{0.773085237f, 0.761843383f},
-std::array<float,2>{0.273807198f, 0.215929642f},
-std::array<float,2>{0.142583638f, 0.692376077f},
-std::array<float,2>{0.655240893f, 0.399912536f},
-std::array<float,2>{0.612589121f, 0.501408279f},
-std::array<float,2>{0.0949871987f, 0.371305197f},
-std::array<float,2>{0.384183317f, 0.96920383f},
-std::array<float,2>{0.960777879f, 0.0830154642f},
-std::array<float,2>{0.911705196f, 0.650255799f},
-std::array<float,2>{0.451021284f, 0.454604f},
-std::array<float,2>{0.0573758595f, 0.871358156f},
-std::array<float,2>{0.54101342f, 0.148859397f},
-std::array<float,2>{0.715855002f, 0.913503587f},
-std::array<float,2>{0.201994002f, 0.0160182696f},
-std::array<float,2>{0.334760129f, 0.585188091f},
-std::array<float,2>{0.859479249f, 0.264315099f},
-std::array<float,2>{0.75064373f, 0.914672196f},
-std::array<float,2>{0.264324546f, 0.0279100202f},
-std::array<float,2>{0.131633013f, 0.588106096f},
-std::array<float,2>{0.634887457f, 0.251841277f},
-std::array<float,2>{0.603363335f, 0.643946648f},
-std::array<float,2>{0.110889576f, 0.462204188f},
-std::array<float,2>{0.402715534f, 0.861350954f},
-std::array<float,2>{0.951151788f, 0.142369702f},
-std::array<float,2>{0.926115215f, 0.515116572f},
-std::array<float,2>{0.463220984f, 0.361537248f},
-std::array<float,2>{0.044059433f, 0.981016457f},
-std::array<float,2>{0.55934763f, 0.089783892f},
-std::array<float,2>{0.696763694f, 0.754522264f},
-std::array<float,2>{0.214359775f, 0.205415264f},
-std::array<float,2>{0.316757321f, 0.696985126f},
-std::array<float,2>{0.852513552f, 0.392240077f},
-std::array<float,2>{0.974968314f, 0.819365025f},
-std::array<float,2>{0.40818271f, 0.172865763f},
-std::array<float,2>{0.0897503942f, 0.657723606f},
-std::array<float,2>{0.592540324f, 0.498589605f},
-std::array<float,2>{0.66286695f, 0.613581598f},
-std::array<float,2>{0.157533005f, 0.304509491f},
-std::array<float,2>{0.283756196f, 0.890362382f},
-std::array<float,2>{0.783082247f, 0.0387839004f},
-std::array<float,2>{0.818504453f, 0.744638979f},
-std::array<float,2>{0.352394432f, 0.435329825f},
-std::array<float,2>{0.248517513f, 0.800759614f},
-std::array<float,2>{0.746599376f, 0.22494249f},
-std::array<float,2>{0.522932827f, 0.942945242f},
-std::array<float,2>{0.00278196274f, 0.116297789f},
-std::array<float,2>{0.479804248f, 0.542165041f},
-std::array<float,2>{0.901482105f, 0.321674764f},
-std::array<float,2>{0.876910388f, 0.991788208f},
-std::array<float,2>{0.496113211f, 0.0658870041f},
-std::array<float,2>{0.0287960991f, 0.521473646f},
-std::array<float,2>{0.512747943f, 0.356884301f},
-std::array<float,2>{0.719414473f, 0.712317109f},
-std::array<float,2>{0.234173059f, 0.376870036f},
-std::array<float,2>{0.359865129f, 0.772152841f},
-std::array<float,2>{0.834590793f, 0.196176067f},
-std::array<float,2>{0.80657655f, 0.572639287f},
-std::array<float,2>{0.306602925f, 0.270067632f},
-std::array<float,2>{0.187121078f, 0.935160577f},
-std::array<float,2>{0.686266541f, 0.00955016073f},
-std::array<float,2>{0.56948328f, 0.84580934f},
-std::array<float,2>{0.0676468089f, 0.130829126f},
-std::array<float,2>{0.429914117f, 0.627987683f},
-std::array<float,2>{0.993346035f, 0.45043999f},
-std::array<float,2>{0.863781512f, 0.784147084f},
-std::array<float,2>{0.329359293f, 0.24715136f},
-std::array<float,2>{0.19547382f, 0.720678866f},
-std::array<float,2>{0.71391499f, 0.410816848f},
-std::array<float,2>{0.543280363f, 0.553148925f},
-std::array<float,2>{0.0594318025f, 0.336927652f},
-std::array<float,2>{0.448260605f, 0.961786389f},
-std::array<float,2>{0.907146633f, 0.10610757f},
-std::array<float,2>{0.954589784f, 0.686855912f},
-std::array<float,2>{0.388171285f, 0.479772598f},
-std::array<float,2>{0.100548416f, 0.837554336f},
-std::array<float,2>{0.615582049f, 0.15791747f},
-std::array<float,2>{0.650764108f, 0.899761438f},
-std::array<float,2>{0.148113132f, 0.0531178787f},
-std::array<float,2>{0.278587848f, 0.599958181f},
-std::array<float,2>{0.767342389f, 0.28606382f},
-std::array<float,2>{0.840237439f, 0.959271967f},
-std::array<float,2>{0.374583721f, 0.0966654271f},
-std::array<float,2>{0.226414651f, 0.556542814f},
-std::array<float,2>{0.732467115f, 0.335502654f},
-std::array<float,2>{0.505773067f, 0.730037689f},
-std::array<float,2>{0.022174634f, 0.421494633f},
-std::array<float,2>{0.487692028f, 0.789861083f},
-std::array<float,2>{0.888620496f, 0.238743767f},
-std::array<float,2>{0.991874874f, 0.602265894f},
-std::array<float,2>{0.42363891f, 0.289857447f},
-std::array<float,2>{0.0778759569f, 0.895427525f},
-std::array<float,2>{0.574260533f, 0.0567784496f},
-std::array<float,2>{0.678724945f, 0.828706861f},
-std::array<float,2>{0.179031879f, 0.164532259f},
-std::array<float,2>{0.297049522f, 0.674745202f},
-std::array<float,2>{0.800684452f, 0.470788956f},
-std::array<float,2>{0.916863799f, 0.776697814f},
-std::array<float,2>{0.444181025f, 0.193309501f},
-std::array<float,2>{0.0497183427f, 0.710771322f},
-std::array<float,2>{0.537600517f, 0.38497892f},
-std::array<float,2>{0.70980984f, 0.527602732f},
-std::array<float,2>{0.18762143f, 0.344971418f},
-std::array<float,2>{0.342117995f, 0.999812901f},
-std::array<float,2>{0.869978189f, 0.074957855f},
-std::array<float,2>{0.779005766f, 0.633230865f},
-std::array<float,2>{0.266339511f, 0.440974563f},
-std::array<float,2>{0.149190798f, 0.859354794f},
-std::array<float,2>{0.645288169f, 0.137143508f},
-std::array<float,2>{0.624188602f, 0.923357308f},
-std::array<float,2>{0.108287796f, 0.00526700681f},
-std::array<float,2>{0.379055291f, 0.563250363f},
-std::array<float,2>{0.966712594f, 0.276442468f},
-std::array<float,2>{0.940587103f, 0.877292275f},
-std::array<float,2>{0.39449507f, 0.0393588915f},
-std::array<float,2>{0.124968648f, 0.624810636f},
-std::array<float,2>{0.5994398f, 0.304896295f},
-std::array<float,2>{0.632584393f, 0.670435548f},
-std::array<float,2>{0.140458047f, 0.489396423f},
-std::array<float,2>{0.252810687f, 0.827552319f},
-std::array<float,2>{0.763049424f, 0.186077163f},
-std::array<float,2>{0.844464183f, 0.532887995f},
-std::array<float,2>{0.324044973f, 0.314799786f},
-std::array<float,2>{0.208200082f, 0.949568093f},
-std::array<float,2>{0.691551208f, 0.121097125f},
-std::array<float,2>{0.548419058f, 0.808398664f},
-std::array<float,2>{0.0364106186f, 0.232549965f},
-std::array<float,2>{0.455242097f, 0.735861719f},
-std::array<float,2>{0.932499349f, 0.42764771f},
-std::array<float,2>{0.7955966f, 0.870697737f},
-std::array<float,2>{0.294097036f, 0.153226584f},
-std::array<float,2>{0.170254305f, 0.656020224f},
-std::array<float,2>{0.664270163f, 0.459162235f},
-std::array<float,2>{0.578335881f, 0.578314662f},
-std::array<float,2>{0.0838006437f, 0.258533061f},
-std::array<float,2>{0.419478059f, 0.909857094f},
-std::array<float,2>{0.98217845f, 0.0205228012f},
-std::array<float,2>{0.894329906f, 0.688147306f},
-std::array<float,2>{0.469442189f, 0.406033307f},
-std::array<float,2>{0.0152432797f, 0.76080811f},
-std::array<float,2>{0.525317013f, 0.211922035f},
-std::array<float,2>{0.739550054f, 0.973551393f},
-std::array<float,2>{0.238583341f, 0.0813775584f},
-std::array<float,2>{0.347954273f, 0.504270315f},
-std::array<float,2>{0.82243222f, 0.370363504f},
-std::array<float,2>{0.789699256f, 0.966220856f},
-std::array<float,2>{0.289984107f, 0.104604132f},
-std::array<float,2>{0.166667849f, 0.549856782f},
-std::array<float,2>{0.669900179f, 0.340276808f},
-std::array<float,2>{0.585275471f, 0.725418091f},
-std::array<float,2>{0.0807827562f, 0.407281727f},
-std::array<float,2>{0.415563345f, 0.78543222f},
-std::array<float,2>{0.977125645f, 0.243780807f},
-std::array<float,2>{0.895680189f, 0.597245574f},
-std::array<float,2>{0.476290226f, 0.285004944f},
-std::array<float,2>{0.00907421671f, 0.904590189f},
-std::array<float,2>{0.530908465f, 0.0498322546f},
-std::array<float,2>{0.734426618f, 0.842361391f},
-std::array<float,2>{0.234723896f, 0.162398979f},
-std::array<float,2>{0.344454139f, 0.679700911f},
-std::array<float,2>{0.827329278f, 0.484351188f},
-std::array<float,2>{0.944935083f, 0.767697275f},
-std::array<float,2>{0.39794293f, 0.199562803f},
-std::array<float,2>{0.118285097f, 0.717313349f},
-std::array<float,2>{0.596035719f, 0.379806131f},
-std::array<float,2>{0.625876486f, 0.516359985f},
-std::array<float,2>{0.134443089f, 0.352352232f},
-std::array<float,2>{0.257473022f, 0.987841129f},
-std::array<float,2>{0.761674106f, 0.0686214864f},
-std::array<float,2>{0.848972559f, 0.632017493f},
-std::array<float,2>{0.325663537f, 0.448321849f},
-std::array<float,2>{0.203952283f, 0.849332452f},
-std::array<float,2>{0.688436568f, 0.126641899f},
-std::array<float,2>{0.554325819f, 0.929839313f},
-std::array<float,2>{0.0332613625f, 0.0117960051f},
-std::array<float,2>{0.458172083f, 0.577874005f},
-std::array<float,2>{0.935715437f, 0.266691238f},
-std::array<float,2>{0.918022037f, 0.88358283f},
-std::array<float,2>{0.439562917f, 0.0312761478f},
-std::array<float,2>{0.0511596836f, 0.610494316f},
-std::array<float,2>{0.533920646f, 0.299215883f},
-std::array<float,2>{0.705847025f, 0.660232604f},
-std::array<float,2>{0.19510147f, 0.494835764f},
-std::array<float,2>{0.339164525f, 0.815778494f},
-std::array<float,2>{0.874005198f, 0.175984532f},
-std::array<float,2>{0.776219726f, 0.544500232f},
-std::array<float,2>{0.269709855f, 0.326530844f},
-std::array<float,2>{0.155994907f, 0.940885067f},
-std::array<float,2>{0.642432332f, 0.112873055f},
-std::array<float,2>{0.619758844f, 0.802520514f},
-std::array<float,2>{0.105021901f, 0.221523732f},
-std::array<float,2>{0.376577497f, 0.747724175f},
-std::array<float,2>{0.96179086f, 0.430909961f},
-std::array<float,2>{0.838870645f, 0.866217792f},
-std::array<float,2>{0.369992733f, 0.145265236f},
-std::array<float,2>{0.220844314f, 0.647626758f},
-std::array<float,2>{0.728740513f, 0.468445688f},
-std::array<float,2>{0.503640115f, 0.590191066f},
-std::array<float,2>{0.0168777462f, 0.254012942f},
-std::array<float,2>{0.48924315f, 0.919642806f},
-std::array<float,2>{0.885020256f, 0.0241763238f},
-std::array<float,2>{0.986399889f, 0.699939609f},
-std::array<float,2>{0.426258564f, 0.395684242f},
-std::array<float,2>{0.0738851801f, 0.752720416f},
-std::array<float,2>{0.570968211f, 0.210196733f},
-std::array<float,2>{0.672496378f, 0.978815854f},
-std::array<float,2>{0.172570795f, 0.0909630805f},
-std::array<float,2>{0.303564698f, 0.511146784f},
-std::array<float,2>{0.804445744f, 0.364336252f},
-std::array<float,2>{0.860984266f, 0.911537647f},
-std::array<float,2>{0.335348964f, 0.0177666694f},
-std::array<float,2>{0.20305343f, 0.583547771f},
-std::array<float,2>{0.715058565f, 0.262739658f},
-std::array<float,2>{0.539761364f, 0.650803089f},
-std::array<float,2>{0.0582067072f, 0.455219924f},
-std::array<float,2>{0.450074852f, 0.873856962f},
-std::array<float,2>{0.910566628f, 0.150972888f},
-std::array<float,2>{0.959073961f, 0.502823889f},
-std::array<float,2>{0.382973492f, 0.373376876f},
-std::array<float,2>{0.0942340493f, 0.971770048f},
-std::array<float,2>{0.612061262f, 0.0847440213f},
-std::array<float,2>{0.655982256f, 0.764796197f},
-std::array<float,2>{0.143749669f, 0.217281252f},
-std::array<float,2>{0.274431318f, 0.6938833f},
-std::array<float,2>{0.772243142f, 0.401367873f},
-std::array<float,2>{0.882039189f, 0.82068789f},
-std::array<float,2>{0.494665265f, 0.180705532f},
-std::array<float,2>{0.0255227908f, 0.667588532f},
-std::array<float,2>{0.50783509f, 0.484982908f},
-std::array<float,2>{0.723347902f, 0.619267344f},
-std::array<float,2>{0.228116482f, 0.309029043f},
-std::array<float,2>{0.363291442f, 0.882282615f},
-std::array<float,2>{0.830889642f, 0.0453119352f},
-std::array<float,2>{0.8104496f, 0.74103111f},
-std::array<float,2>{0.312256992f, 0.423190951f},
-std::array<float,2>{0.18348825f, 0.808960021f},
-std::array<float,2>{0.682954788f, 0.229041979f},
-std::array<float,2>{0.56390202f, 0.948208928f},
-std::array<float,2>{0.0633193031f, 0.118055828f},
-std::array<float,2>{0.434900582f, 0.536656499f},
-std::array<float,2>{0.99796778f, 0.319193214f},
-std::array<float,2>{0.969854236f, 0.995618224f},
-std::array<float,2>{0.413750112f, 0.0739626586f},
-std::array<float,2>{0.090818271f, 0.525295019f},
-std::array<float,2>{0.589024067f, 0.350593626f},
-std::array<float,2>{0.658296824f, 0.706103325f},
-std::array<float,2>{0.161126599f, 0.388747364f},
-std::array<float,2>{0.285641521f, 0.780112147f},
-std::array<float,2>{0.786997855f, 0.190381736f},
-std::array<float,2>{0.812948048f, 0.569829524f},
-std::array<float,2>{0.3586137f, 0.27811119f},
-std::array<float,2>{0.243052676f, 0.927001238f},
-std::array<float,2>{0.745080411f, 0.00168807688f},
-std::array<float,2>{0.518153548f, 0.8548792f},
-std::array<float,2>{0.00406259205f, 0.134915307f},
-std::array<float,2>{0.48292616f, 0.639892995f},
-std::array<float,2>{0.905370116f, 0.441825479f},
-std::array<float,2>{0.757673085f, 0.796791077f},
-std::array<float,2>{0.26136291f, 0.235120371f},
-std::array<float,2>{0.128765717f, 0.732818127f},
-std::array<float,2>{0.638827026f, 0.414465904f},
-std::array<float,2>{0.60676229f, 0.560293674f},
-std::array<float,2>{0.115504161f, 0.330269575f},
-std::array<float,2>{0.400360972f, 0.955575705f},
-std::array<float,2>{0.948329687f, 0.0991988853f},
-std::array<float,2>{0.922462404f, 0.677395463f},
-std::array<float,2>{0.467493176f, 0.476228446f},
-std::array<float,2>{0.0418275371f, 0.833780766f},
-std::array<float,2>{0.55809921f, 0.16977416f},
-std::array<float,2>{0.69958359f, 0.892521679f},
-std::array<float,2>{0.215915337f, 0.0589305237f},
-std::array<float,2>{0.312872082f, 0.609335959f},
-std::array<float,2>{0.8574242f, 0.296356291f},
-std::array<float,2>{0.766491473f, 0.9017573f},
-std::array<float,2>{0.278055549f, 0.0514232442f},
-std::array<float,2>{0.146636024f, 0.597688675f},
-std::array<float,2>{0.651562095f, 0.288746744f},
-std::array<float,2>{0.616830468f, 0.683951318f},
-std::array<float,2>{0.100879163f, 0.476944059f},
-std::array<float,2>{0.387612522f, 0.838734865f},
-std::array<float,2>{0.953807354f, 0.159548908f},
-std::array<float,2>{0.907326758f, 0.55164063f},
-std::array<float,2>{0.447489977f, 0.338216901f},
-std::array<float,2>{0.0602946281f, 0.964803338f},
-std::array<float,2>{0.54404819f, 0.107768565f},
-std::array<float,2>{0.713538229f, 0.782894611f},
-std::array<float,2>{0.196835235f, 0.248369351f},
-std::array<float,2>{0.328394622f, 0.721109867f},
-std::array<float,2>{0.864798367f, 0.412659436f},
-std::array<float,2>{0.992958605f, 0.843864739f},
-std::array<float,2>{0.431001365f, 0.132039741f},
-std::array<float,2>{0.0664879084f, 0.626764476f},
-std::array<float,2>{0.568741322f, 0.45289585f},
-std::array<float,2>{0.687167227f, 0.570854366f},
-std::array<float,2>{0.185660928f, 0.271831542f},
-std::array<float,2>{0.305588007f, 0.937262475f},
-std::array<float,2>{0.804807246f, 0.0115172453f},
-std::array<float,2>{0.835934401f, 0.712965727f},
-std::array<float,2>{0.360700905f, 0.378752917f},
-std::array<float,2>{0.232856736f, 0.771478832f},
-std::array<float,2>{0.719945371f, 0.198984951f},
-std::array<float,2>{0.512456179f, 0.989131629f},
-std::array<float,2>{0.0279942919f, 0.064451836f},
-std::array<float,2>{0.49733597f, 0.522277117f},
-std::array<float,2>{0.87536633f, 0.35845539f},
-std::array<float,2>{0.900877118f, 0.945209026f},
-std::array<float,2>{0.479373932f, 0.115059048f},
-std::array<float,2>{0.00371531956f, 0.541012645f},
-std::array<float,2>{0.522352636f, 0.323138446f},
-std::array<float,2>{0.747223079f, 0.743454039f},
-std::array<float,2>{0.24953942f, 0.436694324f},
-std::array<float,2>{0.353329688f, 0.797040343f},
-std::array<float,2>{0.820149183f, 0.22375156f},
-std::array<float,2>{0.782198668f, 0.616586268f},
-std::array<float,2>{0.284896672f, 0.301347196f},
-std::array<float,2>{0.156281367f, 0.886990964f},
-std::array<float,2>{0.664001942f, 0.0356088355f},
-std::array<float,2>{0.593436182f, 0.817905724f},
-std::array<float,2>{0.0878911018f, 0.17534928f},
-std::array<float,2>{0.406938463f, 0.660146356f},
-std::array<float,2>{0.976210296f, 0.497201234f},
-std::array<float,2>{0.852640331f, 0.756121933f},
-std::array<float,2>{0.318137467f, 0.203391641f},
-std::array<float,2>{0.213020384f, 0.697367072f},
-std::array<float,2>{0.695592284f, 0.393132329f},
-std::array<float,2>{0.560204685f, 0.512387097f},
-std::array<float,2>{0.0432361662f, 0.360284626f},
-std::array<float,2>{0.464277536f, 0.983018219f},
-std::array<float,2>{0.927032769f, 0.087426886f},
-std::array<float,2>{0.94956845f, 0.640854418f},
-std::array<float,2>{0.403669745f, 0.464406967f},
-std::array<float,2>{0.109765425f, 0.860218763f},
-std::array<float,2>{0.602342904f, 0.142796189f},
-std::array<float,2>{0.635827303f, 0.916281044f},
-std::array<float,2>{0.13240023f, 0.0295680128f},
-std::array<float,2>{0.265510231f, 0.587780476f},
-std::array<float,2>{0.75192225f, 0.253648609f},
-std::array<float,2>{0.823283315f, 0.975784719f},
-std::array<float,2>{0.348970354f, 0.0787529051f},
-std::array<float,2>{0.239342898f, 0.507043898f},
-std::array<float,2>{0.738886535f, 0.368300974f},
-std::array<float,2>{0.523606062f, 0.69032836f},
-std::array<float,2>{0.0139110787f, 0.403588861f},
-std::array<float,2>{0.470359534f, 0.758433759f},
-std::array<float,2>{0.892592847f, 0.214300245f},
-std::array<float,2>{0.981211305f, 0.580305338f},
-std::array<float,2>{0.418192506f, 0.260520548f},
-std::array<float,2>{0.0829012021f, 0.907206595f},
-std::array<float,2>{0.579377294f, 0.0229225047f},
-std::array<float,2>{0.665623307f, 0.868832111f},
-std::array<float,2>{0.171832994f, 0.154782787f},
-std::array<float,2>{0.293705434f, 0.652600944f},
-std::array<float,2>{0.796349406f, 0.458862811f},
-std::array<float,2>{0.933592498f, 0.804804623f},
-std::array<float,2>{0.456791788f, 0.230659127f},
-std::array<float,2>{0.0358758681f, 0.736659288f},
-std::array<float,2>{0.547234595f, 0.428737342f},
-std::array<float,2>{0.693080366f, 0.534325898f},
-std::array<float,2>{0.207601622f, 0.314020932f},
-std::array<float,2>{0.322969526f, 0.952434719f},
-std::array<float,2>{0.84501487f, 0.123565845f},
-std::array<float,2>{0.762377977f, 0.668030679f},
-std::array<float,2>{0.253534228f, 0.490243256f},
-std::array<float,2>{0.139101624f, 0.824766874f},
-std::array<float,2>{0.631194174f, 0.184898898f},
-std::array<float,2>{0.598618507f, 0.876851916f},
-std::array<float,2>{0.123652115f, 0.0419040173f},
-std::array<float,2>{0.393035799f, 0.621986747f},
-std::array<float,2>{0.939598858f, 0.306663364f},
-std::array<float,2>{0.965161502f, 0.924975574f},
-std::array<float,2>{0.380628377f, 0.0075389361f},
-std::array<float,2>{0.108854823f, 0.564800262f},
-std::array<float,2>{0.623360574f, 0.275331259f},
-std::array<float,2>{0.646348417f, 0.63587755f},
-std::array<float,2>{0.150085345f, 0.439246327f},
-std::array<float,2>{0.267335325f, 0.856617749f},
-std::array<float,2>{0.777997136f, 0.139271781f},
-std::array<float,2>{0.87043196f, 0.529509127f},
-std::array<float,2>{0.343177259f, 0.346145302f},
-std::array<float,2>{0.18848303f, 0.996650159f},
-std::array<float,2>{0.710180759f, 0.0767213106f},
-std::array<float,2>{0.538476706f, 0.773684978f},
-std::array<float,2>{0.0505245216f, 0.194933191f},
-std::array<float,2>{0.444851816f, 0.707256794f},
-std::array<float,2>{0.917537272f, 0.384253442f},
-std::array<float,2>{0.799191833f, 0.830365539f},
-std::array<float,2>{0.298633665f, 0.166984648f},
-std::array<float,2>{0.178223103f, 0.672283113f},
-std::array<float,2>{0.678292334f, 0.469791591f},
-std::array<float,2>{0.576072872f, 0.604086697f},
-std::array<float,2>{0.076431945f, 0.292315453f},
-std::array<float,2>{0.422355652f, 0.897235215f},
-std::array<float,2>{0.990805984f, 0.0560241565f},
-std::array<float,2>{0.887162626f, 0.727431417f},
-std::array<float,2>{0.48729977f, 0.41924566f},
-std::array<float,2>{0.0228277426f, 0.792769909f},
-std::array<float,2>{0.503972352f, 0.240644708f},
-std::array<float,2>{0.733593464f, 0.957890093f},
-std::array<float,2>{0.225320429f, 0.0951552913f},
-std::array<float,2>{0.373566598f, 0.558465242f},
-std::array<float,2>{0.841777563f, 0.333333522f},
-std::array<float,2>{0.759174287f, 0.985307932f},
-std::array<float,2>{0.254295856f, 0.0664595962f},
-std::array<float,2>{0.136703238f, 0.519254565f},
-std::array<float,2>{0.628628254f, 0.35404706f},
-std::array<float,2>{0.595469534f, 0.715378761f},
-std::array<float,2>{0.119834431f, 0.381287366f},
-std::array<float,2>{0.394668221f, 0.765766203f},
-std::array<float,2>{0.942347407f, 0.201239914f},
-std::array<float,2>{0.934744835f, 0.574338615f},
-std::array<float,2>{0.459522367f, 0.269130498f},
-std::array<float,2>{0.0313357525f, 0.932247043f},
-std::array<float,2>{0.552053094f, 0.0140237287f},
-std::array<float,2>{0.69099921f, 0.849755287f},
-std::array<float,2>{0.206449762f, 0.128164932f},
-std::array<float,2>{0.327633172f, 0.630159974f},
-std::array<float,2>{0.850218534f, 0.447084695f},
-std::array<float,2>{0.979206741f, 0.788562f},
-std::array<float,2>{0.417375982f, 0.244371846f},
-std::array<float,2>{0.0788949206f, 0.723573387f},
-std::array<float,2>{0.583910406f, 0.408590853f},
-std::array<float,2>{0.670269907f, 0.548425496f},
-std::array<float,2>{0.164835691f, 0.341964215f},
-std::array<float,2>{0.291876853f, 0.96842587f},
-std::array<float,2>{0.791433394f, 0.102385074f},
-std::array<float,2>{0.825010359f, 0.682745218f},
-std::array<float,2>{0.346718639f, 0.480813205f},
-std::array<float,2>{0.238225758f, 0.841508329f},
-std::array<float,2>{0.736674011f, 0.161060601f},
-std::array<float,2>{0.527621686f, 0.904268265f},
-std::array<float,2>{0.0110001722f, 0.047754325f},
-std::array<float,2>{0.47408998f, 0.594453752f},
-std::array<float,2>{0.897693753f, 0.282898813f},
-std::array<float,2>{0.882876039f, 0.921644688f},
-std::array<float,2>{0.490477115f, 0.0268898234f},
-std::array<float,2>{0.0180815589f, 0.592757642f},
-std::array<float,2>{0.500910997f, 0.256868005f},
-std::array<float,2>{0.728011072f, 0.645533919f},
-std::array<float,2>{0.220143273f, 0.466026843f},
-std::array<float,2>{0.367618144f, 0.864985883f},
-std::array<float,2>{0.837671101f, 0.146845639f},
-std::array<float,2>{0.800985456f, 0.508098423f},
-std::array<float,2>{0.302570224f, 0.36670354f},
-std::array<float,2>{0.175329342f, 0.976648629f},
-std::array<float,2>{0.67435199f, 0.0930530205f},
-std::array<float,2>{0.573908091f, 0.750869989f},
-std::array<float,2>{0.0722419992f, 0.208365247f},
-std::array<float,2>{0.428609848f, 0.702198267f},
-std::array<float,2>{0.98509866f, 0.39807865f},
-std::array<float,2>{0.872285426f, 0.813745797f},
-std::array<float,2>{0.337520033f, 0.178617418f},
-std::array<float,2>{0.192412436f, 0.662448704f},
-std::array<float,2>{0.704827785f, 0.493460417f},
-std::array<float,2>{0.53271538f, 0.611367702f},
-std::array<float,2>{0.0538990721f, 0.29814893f},
-std::array<float,2>{0.438762009f, 0.886333108f},
-std::array<float,2>{0.92028892f, 0.0333186761f},
-std::array<float,2>{0.964077353f, 0.74922353f},
-std::array<float,2>{0.377859384f, 0.43357411f},
-std::array<float,2>{0.101787649f, 0.803471148f},
-std::array<float,2>{0.618586421f, 0.220048651f},
-std::array<float,2>{0.642906189f, 0.939055085f},
-std::array<float,2>{0.152541295f, 0.109553359f},
-std::array<float,2>{0.271787554f, 0.545944452f},
-std::array<float,2>{0.773624063f, 0.324990004f},
-std::array<float,2>{0.829867482f, 0.879590333f},
-std::array<float,2>{0.365696639f, 0.0447102711f},
-std::array<float,2>{0.228862062f, 0.617858648f},
-std::array<float,2>{0.726362586f, 0.311775029f},
-std::array<float,2>{0.510049939f, 0.665681124f},
-std::array<float,2>{0.0234840512f, 0.487964302f},
-std::array<float,2>{0.492881566f, 0.82346338f},
-std::array<float,2>{0.880484223f, 0.182776213f},
-std::array<float,2>{0.999310732f, 0.538421512f},
-std::array<float,2>{0.43585521f, 0.316830158f},
-std::array<float,2>{0.0656020865f, 0.945703149f},
-std::array<float,2>{0.566086233f, 0.119494542f},
-std::array<float,2>{0.680159032f, 0.811216533f},
-std::array<float,2>{0.181211889f, 0.226765275f},
-std::array<float,2>{0.30902341f, 0.739215732f},
-std::array<float,2>{0.810934186f, 0.424296707f},
-std::array<float,2>{0.913783073f, 0.87233758f},
-std::array<float,2>{0.451385975f, 0.149730295f},
-std::array<float,2>{0.0556725822f, 0.648454487f},
-std::array<float,2>{0.542444348f, 0.453941196f},
-std::array<float,2>{0.717753291f, 0.584415436f},
-std::array<float,2>{0.200085118f, 0.265131384f},
-std::array<float,2>{0.332110107f, 0.912397683f},
-std::array<float,2>{0.861423016f, 0.016696373f},
-std::array<float,2>{0.770527303f, 0.693283737f},
-std::array<float,2>{0.275579125f, 0.39884609f},
-std::array<float,2>{0.141347125f, 0.762806833f},
-std::array<float,2>{0.652373254f, 0.215212464f},
-std::array<float,2>{0.609536171f, 0.970498443f},
-std::array<float,2>{0.0962485746f, 0.0822838768f},
-std::array<float,2>{0.385165572f, 0.500676095f},
-std::array<float,2>{0.958261073f, 0.372305393f},
-std::array<float,2>{0.946575344f, 0.954471111f},
-std::array<float,2>{0.40179354f, 0.0997009873f},
-std::array<float,2>{0.114105292f, 0.561376452f},
-std::array<float,2>{0.608297825f, 0.329113603f},
-std::array<float,2>{0.638174295f, 0.73069334f},
-std::array<float,2>{0.125773355f, 0.417515993f},
-std::array<float,2>{0.258781552f, 0.794382989f},
-std::array<float,2>{0.755716443f, 0.237160027f},
-std::array<float,2>{0.856538177f, 0.605829537f},
-std::array<float,2>{0.315986186f, 0.293031663f},
-std::array<float,2>{0.218264118f, 0.893495321f},
-std::array<float,2>{0.702126086f, 0.0606732331f},
-std::array<float,2>{0.554702222f, 0.834724367f},
-std::array<float,2>{0.0406874567f, 0.169941887f},
-std::array<float,2>{0.466318965f, 0.678942263f},
-std::array<float,2>{0.924556673f, 0.473094732f},
-std::array<float,2>{0.787382245f, 0.777998507f},
-std::array<float,2>{0.287781954f, 0.189099953f},
-std::array<float,2>{0.163208768f, 0.70364666f},
-std::array<float,2>{0.657248855f, 0.38735041f},
-std::array<float,2>{0.586383343f, 0.526865602f},
-std::array<float,2>{0.0925770774f, 0.348180592f},
-std::array<float,2>{0.411445409f, 0.993897974f},
-std::array<float,2>{0.972546816f, 0.0707338601f},
-std::array<float,2>{0.902485073f, 0.636754036f},
-std::array<float,2>{0.482355356f, 0.443438709f},
-std::array<float,2>{0.00737551367f, 0.851827681f},
-std::array<float,2>{0.516807318f, 0.133661523f},
-std::array<float,2>{0.742290139f, 0.928287745f},
-std::array<float,2>{0.244523764f, 0.00238115829f},
-std::array<float,2>{0.356625378f, 0.56672883f},
-std::array<float,2>{0.816087425f, 0.280615091f},
-std::array<float,2>{0.807721257f, 0.93365109f},
-std::array<float,2>{0.307288259f, 0.00836453028f},
-std::array<float,2>{0.183737338f, 0.573701322f},
-std::array<float,2>{0.684701145f, 0.271401107f},
-std::array<float,2>{0.566744745f, 0.627924562f},
-std::array<float,2>{0.070088163f, 0.450127035f},
-std::array<float,2>{0.432648271f, 0.846937656f},
-std::array<float,2>{0.996091008f, 0.129486457f},
-std::array<float,2>{0.878457844f, 0.520375788f},
-std::array<float,2>{0.498510987f, 0.356260151f},
-std::array<float,2>{0.0302918181f, 0.991123438f},
-std::array<float,2>{0.514134049f, 0.0649214238f},
-std::array<float,2>{0.721121967f, 0.772573352f},
-std::array<float,2>{0.230695248f, 0.19668813f},
-std::array<float,2>{0.363062322f, 0.711294234f},
-std::array<float,2>{0.833941579f, 0.375399083f},
-std::array<float,2>{0.956806004f, 0.83645606f},
-std::array<float,2>{0.389453173f, 0.156731382f},
-std::array<float,2>{0.0983930007f, 0.685590088f},
-std::array<float,2>{0.613656402f, 0.478772253f},
-std::array<float,2>{0.650035501f, 0.60074836f},
-std::array<float,2>{0.145305544f, 0.286147296f},
-std::array<float,2>{0.28052178f, 0.898638546f},
-std::array<float,2>{0.768788278f, 0.0540732592f},
-std::array<float,2>{0.866995454f, 0.718842745f},
-std::array<float,2>{0.331907094f, 0.411659688f},
-std::array<float,2>{0.198062494f, 0.784187973f},
-std::array<float,2>{0.712829292f, 0.246971548f},
-std::array<float,2>{0.54675436f, 0.962407529f},
-std::array<float,2>{0.0618118569f, 0.107179224f},
-std::array<float,2>{0.447211295f, 0.554631233f},
-std::array<float,2>{0.908999145f, 0.336621076f},
-std::array<float,2>{0.928976059f, 0.981960952f},
-std::array<float,2>{0.461592615f, 0.0886434093f},
-std::array<float,2>{0.0460154526f, 0.514446676f},
-std::array<float,2>{0.560982347f, 0.362628251f},
-std::array<float,2>{0.698004782f, 0.695632637f},
-std::array<float,2>{0.211674571f, 0.391067356f},
-std::array<float,2>{0.318630725f, 0.755308151f},
-std::array<float,2>{0.853824258f, 0.206482187f},
-std::array<float,2>{0.752524674f, 0.589260399f},
-std::array<float,2>{0.261762828f, 0.250086784f},
-std::array<float,2>{0.130238459f, 0.915705264f},
-std::array<float,2>{0.633577466f, 0.0286623128f},
-std::array<float,2>{0.603918433f, 0.862827718f},
-std::array<float,2>{0.112184599f, 0.140804604f},
-std::array<float,2>{0.406209439f, 0.643266261f},
-std::array<float,2>{0.952926934f, 0.461548656f},
-std::array<float,2>{0.817813575f, 0.799633563f},
-std::array<float,2>{0.355188489f, 0.2258448f},
-std::array<float,2>{0.246655837f, 0.745628357f},
-std::array<float,2>{0.748615384f, 0.433717072f},
-std::array<float,2>{0.520687222f, 0.541370451f},
-std::array<float,2>{0.000576271617f, 0.320323914f},
-std::array<float,2>{0.476568341f, 0.941878557f},
-std::array<float,2>{0.899281979f, 0.115440592f},
-std::array<float,2>{0.973896921f, 0.6563797f},
-std::array<float,2>{0.409513146f, 0.499906927f},
-std::array<float,2>{0.0874300301f, 0.819082558f},
-std::array<float,2>{0.590358198f, 0.172254816f},
-std::array<float,2>{0.661030471f, 0.889018118f},
-std::array<float,2>{0.158944547f, 0.0380509868f},
-std::array<float,2>{0.282890588f, 0.614998519f},
-std::array<float,2>{0.784296334f, 0.303384155f},
-std::array<float,2>{0.846223176f, 0.950764835f},
-std::array<float,2>{0.321609169f, 0.122495152f},
-std::array<float,2>{0.209297419f, 0.531624615f},
-std::array<float,2>{0.693558812f, 0.315610081f},
-std::array<float,2>{0.550269902f, 0.735240221f},
-std::array<float,2>{0.0373561308f, 0.426464707f},
-std::array<float,2>{0.453232259f, 0.807456374f},
-std::array<float,2>{0.930855334f, 0.233589187f},
-std::array<float,2>{0.939438462f, 0.623232543f},
-std::array<float,2>{0.391748786f, 0.306116045f},
-std::array<float,2>{0.12185511f, 0.877954006f},
-std::array<float,2>{0.601495564f, 0.0405949391f},
-std::array<float,2>{0.630199909f, 0.826309979f},
-std::array<float,2>{0.138203636f, 0.187143475f},
-std::array<float,2>{0.251946241f, 0.671646655f},
-std::array<float,2>{0.764708042f, 0.488488853f},
-std::array<float,2>{0.891677737f, 0.760479033f},
-std::array<float,2>{0.470914602f, 0.211862594f},
-std::array<float,2>{0.0131551353f, 0.689199507f},
-std::array<float,2>{0.525442541f, 0.40518862f},
-std::array<float,2>{0.742111325f, 0.504982829f},
-std::array<float,2>{0.240320638f, 0.369952172f},
-std::array<float,2>{0.350174397f, 0.973649144f},
-std::array<float,2>{0.821196258f, 0.0805139095f},
-std::array<float,2>{0.794570267f, 0.654729366f},
-std::array<float,2>{0.296667725f, 0.460844249f},
-std::array<float,2>{0.169506684f, 0.870036721f},
-std::array<float,2>{0.667550564f, 0.153549165f},
-std::array<float,2>{0.580406725f, 0.908982217f},
-std::array<float,2>{0.0840482414f, 0.0200747456f},
-std::array<float,2>{0.420521319f, 0.5792467f},
-std::array<float,2>{0.98381716f, 0.259666353f},
-std::array<float,2>{0.989211798f, 0.896006405f},
-std::array<float,2>{0.425007522f, 0.0577994883f},
-std::array<float,2>{0.0753118098f, 0.60254401f},
-std::array<float,2>{0.576369166f, 0.290989757f},
-std::array<float,2>{0.675930083f, 0.675266862f},
-std::array<float,2>{0.176837757f, 0.472494543f},
-std::array<float,2>{0.298901856f, 0.829123974f},
-std::array<float,2>{0.797862411f, 0.165210232f},
-std::array<float,2>{0.842131197f, 0.555169702f},
-std::array<float,2>{0.372083753f, 0.334571809f},
-std::array<float,2>{0.222916424f, 0.960415721f},
-std::array<float,2>{0.73141849f, 0.0973222926f},
-std::array<float,2>{0.506534398f, 0.790967464f},
-std::array<float,2>{0.0198009387f, 0.239985228f},
-std::array<float,2>{0.486236095f, 0.729053319f},
-std::array<float,2>{0.890170872f, 0.420161545f},
-std::array<float,2>{0.779649496f, 0.857898235f},
-std::array<float,2>{0.268372118f, 0.13866125f},
-std::array<float,2>{0.151960611f, 0.633973598f},
-std::array<float,2>{0.647976696f, 0.440143377f},
-std::array<float,2>{0.621165454f, 0.564056993f},
-std::array<float,2>{0.106764443f, 0.275778115f},
-std::array<float,2>{0.381269872f, 0.922540843f},
-std::array<float,2>{0.967908919f, 0.00452110358f},
-std::array<float,2>{0.915048599f, 0.709920526f},
-std::array<float,2>{0.442471981f, 0.385772228f},
-std::array<float,2>{0.047807049f, 0.776295662f},
-std::array<float,2>{0.536484122f, 0.191641778f},
-std::array<float,2>{0.707722366f, 0.998995543f},
-std::array<float,2>{0.190213785f, 0.0759255141f},
-std::array<float,2>{0.340702325f, 0.528635859f},
-std::array<float,2>{0.868138075f, 0.344421118f},
-std::array<float,2>{0.755208433f, 0.955233693f},
-std::array<float,2>{0.258202225f, 0.0989738032f},
-std::array<float,2>{0.125477806f, 0.55981791f},
-std::array<float,2>{0.638192236f, 0.330667317f},
-std::array<float,2>{0.607422411f, 0.733388305f},
-std::array<float,2>{0.113487035f, 0.414923549f},
-std::array<float,2>{0.402293861f, 0.796296477f},
-std::array<float,2>{0.946891427f, 0.234773457f},
-std::array<float,2>{0.924229383f, 0.60882318f},
-std::array<float,2>{0.465930492f, 0.29656449f},
-std::array<float,2>{0.0401091985f, 0.891645193f},
-std::array<float,2>{0.555207491f, 0.0591421127f},
-std::array<float,2>{0.701263368f, 0.833378553f},
-std::array<float,2>{0.217899337f, 0.16940023f},
-std::array<float,2>{0.315621644f, 0.67705965f},
-std::array<float,2>{0.857402444f, 0.475710094f},
-std::array<float,2>{0.972149372f, 0.779623508f},
-std::array<float,2>{0.412001163f, 0.189530388f},
-std::array<float,2>{0.0921512917f, 0.706707299f},
-std::array<float,2>{0.586470246f, 0.389547229f},
-std::array<float,2>{0.657766998f, 0.52471137f},
-std::array<float,2>{0.164053857f, 0.351225585f},
-std::array<float,2>{0.287282616f, 0.995243251f},
-std::array<float,2>{0.787976742f, 0.0733360425f},
-std::array<float,2>{0.815448642f, 0.640223145f},
-std::array<float,2>{0.357269675f, 0.442210436f},
-std::array<float,2>{0.244834319f, 0.855138958f},
-std::array<float,2>{0.742844641f, 0.135280743f},
-std::array<float,2>{0.517288446f, 0.9275195f},
-std::array<float,2>{0.00724730873f, 0.00131260988f},
-std::array<float,2>{0.481521726f, 0.569432199f},
-std::array<float,2>{0.903134286f, 0.277472168f},
-std::array<float,2>{0.880034506f, 0.882731736f},
-std::array<float,2>{0.492554009f, 0.0454524159f},
-std::array<float,2>{0.0241513252f, 0.619671702f},
-std::array<float,2>{0.510659993f, 0.309437722f},
-std::array<float,2>{0.725757539f, 0.667084277f},
-std::array<float,2>{0.229492009f, 0.484714806f},
-std::array<float,2>{0.365960628f, 0.820969224f},
-std::array<float,2>{0.82919091f, 0.181622848f},
-std::array<float,2>{0.811502755f, 0.536515117f},
-std::array<float,2>{0.309188902f, 0.318486571f},
-std::array<float,2>{0.180776626f, 0.947499156f},
-std::array<float,2>{0.68032974f, 0.117634878f},
-std::array<float,2>{0.565453172f, 0.809195638f},
-std::array<float,2>{0.0659706444f, 0.228845388f},
-std::array<float,2>{0.436393321f, 0.740597606f},
-std::array<float,2>{0.999548376f, 0.423625618f},
-std::array<float,2>{0.862052679f, 0.873365521f},
-std::array<float,2>{0.332863569f, 0.150719151f},
-std::array<float,2>{0.199632004f, 0.651252866f},
-std::array<float,2>{0.717036545f, 0.455901444f},
-std::array<float,2>{0.542505741f, 0.58341372f},
-std::array<float,2>{0.0565110706f, 0.263506234f},
-std::array<float,2>{0.451888055f, 0.911630869f},
-std::array<float,2>{0.913130581f, 0.0181020368f},
-std::array<float,2>{0.958670676f, 0.693377793f},
-std::array<float,2>{0.385329992f, 0.402115822f},
-std::array<float,2>{0.0957484841f, 0.765162885f},
-std::array<float,2>{0.610167205f, 0.217422843f},
-std::array<float,2>{0.653184772f, 0.972602725f},
-std::array<float,2>{0.140810341f, 0.0841470808f},
-std::array<float,2>{0.276294231f, 0.502275229f},
-std::array<float,2>{0.771318138f, 0.373808175f},
-std::array<float,2>{0.837220371f, 0.919190228f},
-std::array<float,2>{0.367749751f, 0.023813203f},
-std::array<float,2>{0.220691741f, 0.590374887f},
-std::array<float,2>{0.728068888f, 0.254463553f},
-std::array<float,2>{0.500054896f, 0.648164034f},
-std::array<float,2>{0.018006457f, 0.468088031f},
-std::array<float,2>{0.491034865f, 0.866862178f},
-std::array<float,2>{0.883694947f, 0.144674376f},
-std::array<float,2>{0.98437655f, 0.511259973f},
-std::array<float,2>{0.427770257f, 0.365123093f},
-std::array<float,2>{0.0715134144f, 0.979157627f},
-std::array<float,2>{0.573401213f, 0.0913387984f},
-std::array<float,2>{0.674204648f, 0.752175152f},
-std::array<float,2>{0.17494075f, 0.210913703f},
-std::array<float,2>{0.301921844f, 0.699335158f},
-std::array<float,2>{0.801521778f, 0.396025598f},
-std::array<float,2>{0.920889735f, 0.816129446f},
-std::array<float,2>{0.439402103f, 0.17647025f},
-std::array<float,2>{0.0542198755f, 0.660923183f},
-std::array<float,2>{0.532622635f, 0.494473517f},
-std::array<float,2>{0.704365969f, 0.611194313f},
-std::array<float,2>{0.193322465f, 0.299550682f},
-std::array<float,2>{0.337349892f, 0.883022368f},
-std::array<float,2>{0.87273407f, 0.0319098644f},
-std::array<float,2>{0.774144351f, 0.747289956f},
-std::array<float,2>{0.272037834f, 0.431498051f},
-std::array<float,2>{0.153266087f, 0.802150309f},
-std::array<float,2>{0.643102646f, 0.220879436f},
-std::array<float,2>{0.618937016f, 0.941081047f},
-std::array<float,2>{0.102106072f, 0.112413749f},
-std::array<float,2>{0.376992583f, 0.544412315f},
-std::array<float,2>{0.964712918f, 0.326901227f},
-std::array<float,2>{0.941675127f, 0.987687528f},
-std::array<float,2>{0.395244062f, 0.0690175742f},
-std::array<float,2>{0.119206481f, 0.515799522f},
-std::array<float,2>{0.594882965f, 0.351665318f},
-std::array<float,2>{0.6280334f, 0.71714294f},
-std::array<float,2>{0.136182621f, 0.379229546f},
-std::array<float,2>{0.254684985f, 0.768358171f},
-std::array<float,2>{0.759703457f, 0.199990839f},
-std::array<float,2>{0.850071311f, 0.577298462f},
-std::array<float,2>{0.327798873f, 0.267513007f},
-std::array<float,2>{0.206756592f, 0.930429161f},
-std::array<float,2>{0.690526903f, 0.0126046082f},
-std::array<float,2>{0.552410543f, 0.848803818f},
-std::array<float,2>{0.032125894f, 0.126445785f},
-std::array<float,2>{0.45942235f, 0.632577837f},
-std::array<float,2>{0.935495794f, 0.449145794f},
-std::array<float,2>{0.791817963f, 0.785654545f},
-std::array<float,2>{0.291125685f, 0.243316561f},
-std::array<float,2>{0.164319381f, 0.724613667f},
-std::array<float,2>{0.670535147f, 0.407964468f},
-std::array<float,2>{0.583111823f, 0.550460219f},
-std::array<float,2>{0.0784372911f, 0.340552896f},
-std::array<float,2>{0.41752547f, 0.966635048f},
-std::array<float,2>{0.978627205f, 0.105125599f},
-std::array<float,2>{0.898087144f, 0.680246353f},
-std::array<float,2>{0.474565834f, 0.483447224f},
-std::array<float,2>{0.0116909137f, 0.842272937f},
-std::array<float,2>{0.528129756f, 0.162784323f},
-std::array<float,2>{0.737296522f, 0.904797614f},
-std::array<float,2>{0.237600669f, 0.0503800102f},
-std::array<float,2>{0.347571433f, 0.596959114f},
-std::array<float,2>{0.824499667f, 0.284588099f},
-std::array<float,2>{0.798520267f, 0.896628976f},
-std::array<float,2>{0.299408883f, 0.056566678f},
-std::array<float,2>{0.177587762f, 0.603702605f},
-std::array<float,2>{0.676448405f, 0.292627722f},
-std::array<float,2>{0.576866984f, 0.672573209f},
-std::array<float,2>{0.0760534927f, 0.470237404f},
-std::array<float,2>{0.425429493f, 0.830720067f},
-std::array<float,2>{0.988619506f, 0.166076243f},
-std::array<float,2>{0.889831543f, 0.557816207f},
-std::array<float,2>{0.485451341f, 0.333526582f},
-std::array<float,2>{0.0202040207f, 0.957315207f},
-std::array<float,2>{0.506314576f, 0.0954880714f},
-std::array<float,2>{0.730708718f, 0.792059958f},
-std::array<float,2>{0.223316044f, 0.240808874f},
-std::array<float,2>{0.372728229f, 0.727014005f},
-std::array<float,2>{0.842329681f, 0.419609427f},
-std::array<float,2>{0.968355179f, 0.857198894f},
-std::array<float,2>{0.381381184f, 0.138812065f},
-std::array<float,2>{0.107045762f, 0.636592984f},
-std::array<float,2>{0.621724546f, 0.43878904f},
-std::array<float,2>{0.647726715f, 0.56497395f},
-std::array<float,2>{0.151510328f, 0.274559379f},
-std::array<float,2>{0.267656207f, 0.925366521f},
-std::array<float,2>{0.780037165f, 0.00709741842f},
-std::array<float,2>{0.867277086f, 0.707609653f},
-std::array<float,2>{0.339942783f, 0.384320796f},
-std::array<float,2>{0.189691499f, 0.77436775f},
-std::array<float,2>{0.707401097f, 0.194706112f},
-std::array<float,2>{0.537074685f, 0.996371865f},
-std::array<float,2>{0.047287792f, 0.0762680098f},
-std::array<float,2>{0.442999154f, 0.530004561f},
-std::array<float,2>{0.915663004f, 0.346569657f},
-std::array<float,2>{0.931450605f, 0.953026175f},
-std::array<float,2>{0.454075307f, 0.123275384f},
-std::array<float,2>{0.0376665667f, 0.53472048f},
-std::array<float,2>{0.550727189f, 0.3138313f},
-std::array<float,2>{0.694075108f, 0.736909389f},
-std::array<float,2>{0.209703639f, 0.42936492f},
-std::array<float,2>{0.322151333f, 0.805576742f},
-std::array<float,2>{0.845876038f, 0.231261119f},
-std::array<float,2>{0.765443385f, 0.621288657f},
-std::array<float,2>{0.25133878f, 0.307243705f},
-std::array<float,2>{0.13812466f, 0.876410127f},
-std::array<float,2>{0.630486131f, 0.0410322808f},
-std::array<float,2>{0.600988269f, 0.824658751f},
-std::array<float,2>{0.121481121f, 0.185490876f},
-std::array<float,2>{0.392369181f, 0.668828189f},
-std::array<float,2>{0.938657403f, 0.491134435f},
-std::array<float,2>{0.820679724f, 0.758238852f},
-std::array<float,2>{0.349962085f, 0.214389443f},
-std::array<float,2>{0.240789831f, 0.689580381f},
-std::array<float,2>{0.741535068f, 0.404259712f},
-std::array<float,2>{0.526196003f, 0.507491767f},
-std::array<float,2>{0.0136660095f, 0.368876398f},
-std::array<float,2>{0.471197188f, 0.97617048f},
-std::array<float,2>{0.892280102f, 0.0784833804f},
-std::array<float,2>{0.983947396f, 0.65330857f},
-std::array<float,2>{0.42007035f, 0.458435386f},
-std::array<float,2>{0.0846256018f, 0.86837244f},
-std::array<float,2>{0.580998778f, 0.154789209f},
-std::array<float,2>{0.667400181f, 0.906579733f},
-std::array<float,2>{0.169389814f, 0.0234101079f},
-std::array<float,2>{0.296382546f, 0.581043124f},
-std::array<float,2>{0.79428184f, 0.260038823f},
-std::array<float,2>{0.854239523f, 0.982590258f},
-std::array<float,2>{0.31898731f, 0.087193951f},
-std::array<float,2>{0.211205035f, 0.511800647f},
-std::array<float,2>{0.697459638f, 0.359661102f},
-std::array<float,2>{0.56149745f, 0.6978302f},
-std::array<float,2>{0.0466058217f, 0.392786175f},
-std::array<float,2>{0.461382657f, 0.75665319f},
-std::array<float,2>{0.929417133f, 0.204001918f},
-std::array<float,2>{0.952213287f, 0.586983621f},
-std::array<float,2>{0.40545553f, 0.253379107f},
-std::array<float,2>{0.111763395f, 0.916622162f},
-std::array<float,2>{0.604112566f, 0.0302726347f},
-std::array<float,2>{0.633095443f, 0.859609783f},
-std::array<float,2>{0.130546361f, 0.143515706f},
-std::array<float,2>{0.262521595f, 0.641351223f},
-std::array<float,2>{0.752138615f, 0.464310735f},
-std::array<float,2>{0.898806751f, 0.797809899f},
-std::array<float,2>{0.477191746f, 0.224507973f},
-std::array<float,2>{0.000249542936f, 0.743797719f},
-std::array<float,2>{0.521305025f, 0.437289029f},
-std::array<float,2>{0.748107731f, 0.54046762f},
-std::array<float,2>{0.246427089f, 0.322309554f},
-std::array<float,2>{0.354603052f, 0.944451034f},
-std::array<float,2>{0.817908049f, 0.114474148f},
-std::array<float,2>{0.785081446f, 0.659466982f},
-std::array<float,2>{0.282276928f, 0.497978419f},
-std::array<float,2>{0.158264175f, 0.817558646f},
-std::array<float,2>{0.660633326f, 0.175243467f},
-std::array<float,2>{0.589881063f, 0.887371242f},
-std::array<float,2>{0.0873075947f, 0.0359426923f},
-std::array<float,2>{0.409752697f, 0.617182076f},
-std::array<float,2>{0.974605918f, 0.300879031f},
-std::array<float,2>{0.995282114f, 0.936838448f},
-std::array<float,2>{0.433314919f, 0.0109917866f},
-std::array<float,2>{0.0697387382f, 0.570371687f},
-std::array<float,2>{0.567310631f, 0.272028953f},
-std::array<float,2>{0.685483932f, 0.625983655f},
-std::array<float,2>{0.184464633f, 0.452294797f},
-std::array<float,2>{0.306717932f, 0.84447068f},
-std::array<float,2>{0.808577657f, 0.132479906f},
-std::array<float,2>{0.833492219f, 0.521677554f},
-std::array<float,2>{0.36250785f, 0.359030992f},
-std::array<float,2>{0.231013343f, 0.988560379f},
-std::array<float,2>{0.721556962f, 0.0636358485f},
-std::array<float,2>{0.51455456f, 0.770678341f},
-std::array<float,2>{0.0311299786f, 0.198433608f},
-std::array<float,2>{0.498919576f, 0.713383138f},
-std::array<float,2>{0.87827909f, 0.378383964f},
-std::array<float,2>{0.76929909f, 0.838248909f},
-std::array<float,2>{0.280774355f, 0.159965828f},
-std::array<float,2>{0.144702718f, 0.684416413f},
-std::array<float,2>{0.649760783f, 0.477429628f},
-std::array<float,2>{0.613850355f, 0.598343313f},
-std::array<float,2>{0.0978951156f, 0.288398385f},
-std::array<float,2>{0.388856262f, 0.901944995f},
-std::array<float,2>{0.956076801f, 0.0510923639f},
-std::array<float,2>{0.908274651f, 0.721556246f},
-std::array<float,2>{0.446739286f, 0.412326157f},
-std::array<float,2>{0.0624159798f, 0.782638609f},
-std::array<float,2>{0.546096981f, 0.248853177f},
-std::array<float,2>{0.711997449f, 0.964098454f},
-std::array<float,2>{0.197470754f, 0.108302481f},
-std::array<float,2>{0.331248701f, 0.550954103f},
-std::array<float,2>{0.866411328f, 0.338437825f},
-std::array<float,2>{0.786186039f, 0.993489146f},
-std::array<float,2>{0.286041468f, 0.0710802898f},
-std::array<float,2>{0.160629213f, 0.526383281f},
-std::array<float,2>{0.659003139f, 0.347931683f},
-std::array<float,2>{0.589423656f, 0.703421116f},
-std::array<float,2>{0.0900521725f, 0.386976421f},
-std::array<float,2>{0.413267374f, 0.777347386f},
-std::array<float,2>{0.970361114f, 0.188487634f},
-std::array<float,2>{0.905813098f, 0.567211032f},
-std::array<float,2>{0.482535064f, 0.280944169f},
-std::array<float,2>{0.00461399043f, 0.927771568f},
-std::array<float,2>{0.517941892f, 0.00283088838f},
-std::array<float,2>{0.744275451f, 0.852176964f},
-std::array<float,2>{0.242384449f, 0.133237913f},
-std::array<float,2>{0.359362692f, 0.637576997f},
-std::array<float,2>{0.813078284f, 0.444285899f},
-std::array<float,2>{0.949085712f, 0.794909298f},
-std::array<float,2>{0.399573952f, 0.236679196f},
-std::array<float,2>{0.116144121f, 0.731172085f},
-std::array<float,2>{0.606977403f, 0.417260945f},
-std::array<float,2>{0.639569998f, 0.560780704f},
-std::array<float,2>{0.128330395f, 0.329689503f},
-std::array<float,2>{0.260990202f, 0.954917192f},
-std::array<float,2>{0.757033646f, 0.100308716f},
-std::array<float,2>{0.858168721f, 0.679257512f},
-std::array<float,2>{0.313051254f, 0.473449111f},
-std::array<float,2>{0.216476262f, 0.834132791f},
-std::array<float,2>{0.700154662f, 0.170432106f},
-std::array<float,2>{0.558352232f, 0.892585754f},
-std::array<float,2>{0.0414253846f, 0.0612981841f},
-std::array<float,2>{0.467141181f, 0.606351674f},
-std::array<float,2>{0.921875477f, 0.293741047f},
-std::array<float,2>{0.910928547f, 0.912688911f},
-std::array<float,2>{0.449576199f, 0.0171104521f},
-std::array<float,2>{0.058051642f, 0.584931612f},
-std::array<float,2>{0.539120018f, 0.265173137f},
-std::array<float,2>{0.715734839f, 0.649249852f},
-std::array<float,2>{0.202486098f, 0.453221828f},
-std::array<float,2>{0.335546523f, 0.872960985f},
-std::array<float,2>{0.86073482f, 0.149953991f},
-std::array<float,2>{0.7718665f, 0.500469744f},
-std::array<float,2>{0.275146931f, 0.372835785f},
-std::array<float,2>{0.144192785f, 0.969766498f},
-std::array<float,2>{0.655666232f, 0.0829985663f},
-std::array<float,2>{0.611786723f, 0.763543129f},
-std::array<float,2>{0.0946308598f, 0.215361461f},
-std::array<float,2>{0.383658946f, 0.692412972f},
-std::array<float,2>{0.959514618f, 0.39921549f},
-std::array<float,2>{0.830287933f, 0.823906362f},
-std::array<float,2>{0.363953948f, 0.183581114f},
-std::array<float,2>{0.228023723f, 0.665134966f},
-std::array<float,2>{0.723127067f, 0.487419814f},
-std::array<float,2>{0.508378208f, 0.617535233f},
-std::array<float,2>{0.0262222756f, 0.312042207f},
-std::array<float,2>{0.494379729f, 0.879048705f},
-std::array<float,2>{0.882608235f, 0.0440810695f},
-std::array<float,2>{0.997419178f, 0.738310814f},
-std::array<float,2>{0.435527444f, 0.424428999f},
-std::array<float,2>{0.062603116f, 0.811011851f},
-std::array<float,2>{0.563982725f, 0.2271173f},
-std::array<float,2>{0.683199763f, 0.946273208f},
-std::array<float,2>{0.183070019f, 0.119797319f},
-std::array<float,2>{0.311642766f, 0.539010108f},
-std::array<float,2>{0.809826314f, 0.317378908f},
-std::array<float,2>{0.873511195f, 0.885912895f},
-std::array<float,2>{0.339698672f, 0.0338051841f},
-std::array<float,2>{0.194440514f, 0.611974716f},
-std::array<float,2>{0.705417573f, 0.298550189f},
-std::array<float,2>{0.533391416f, 0.662683725f},
-std::array<float,2>{0.0513157733f, 0.493777931f},
-std::array<float,2>{0.440011024f, 0.81420517f},
-std::array<float,2>{0.918591738f, 0.178004026f},
-std::array<float,2>{0.961352468f, 0.546558917f},
-std::array<float,2>{0.376330793f, 0.32434383f},
-std::array<float,2>{0.104860447f, 0.938567817f},
-std::array<float,2>{0.619522154f, 0.109964654f},
-std::array<float,2>{0.641654313f, 0.80291611f},
-std::array<float,2>{0.155557483f, 0.220306486f},
-std::array<float,2>{0.270135373f, 0.749944508f},
-std::array<float,2>{0.775746763f, 0.432987601f},
-std::array<float,2>{0.885282278f, 0.864572227f},
-std::array<float,2>{0.488540053f, 0.146992385f},
-std::array<float,2>{0.0172048565f, 0.646483719f},
-std::array<float,2>{0.503357053f, 0.466585845f},
-std::array<float,2>{0.729275942f, 0.59218663f},
-std::array<float,2>{0.221402675f, 0.257659167f},
-std::array<float,2>{0.369291484f, 0.921014309f},
-std::array<float,2>{0.839714527f, 0.0266512521f},
-std::array<float,2>{0.804102004f, 0.702814937f},
-std::array<float,2>{0.302799225f, 0.397695094f},
-std::array<float,2>{0.171941116f, 0.750349462f},
-std::array<float,2>{0.672279656f, 0.208750293f},
-std::array<float,2>{0.570356309f, 0.977339029f},
-std::array<float,2>{0.0734381899f, 0.0933917016f},
-std::array<float,2>{0.426326305f, 0.508467734f},
-std::array<float,2>{0.986959517f, 0.366518348f},
-std::array<float,2>{0.976927221f, 0.967916369f},
-std::array<float,2>{0.415065676f, 0.10159827f},
-std::array<float,2>{0.0801161602f, 0.548088312f},
-std::array<float,2>{0.5855757f, 0.342714339f},
-std::array<float,2>{0.669094145f, 0.723005176f},
-std::array<float,2>{0.166329458f, 0.408873171f},
-std::array<float,2>{0.289387137f, 0.788779616f},
-std::array<float,2>{0.789516211f, 0.245114669f},
-std::array<float,2>{0.82795769f, 0.594009399f},
-std::array<float,2>{0.344169587f, 0.282607943f},
-std::array<float,2>{0.235023513f, 0.903376102f},
-std::array<float,2>{0.73514086f, 0.04710944f},
-std::array<float,2>{0.530472159f, 0.841290593f},
-std::array<float,2>{0.00939443614f, 0.160633937f},
-std::array<float,2>{0.475717425f, 0.683410287f},
-std::array<float,2>{0.896449387f, 0.481011212f},
-std::array<float,2>{0.761006534f, 0.766499996f},
-std::array<float,2>{0.256939471f, 0.201677799f},
-std::array<float,2>{0.134064615f, 0.71525079f},
-std::array<float,2>{0.625469923f, 0.381646693f},
-std::array<float,2>{0.596527338f, 0.518633127f},
-std::array<float,2>{0.118693344f, 0.353748709f},
-std::array<float,2>{0.3983576f, 0.98470211f},
-std::array<float,2>{0.944576204f, 0.0672167018f},
-std::array<float,2>{0.936133146f, 0.630660176f},
-std::array<float,2>{0.458685666f, 0.446728319f},
-std::array<float,2>{0.0339468494f, 0.85047543f},
-std::array<float,2>{0.553804994f, 0.128814995f},
-std::array<float,2>{0.687556505f, 0.931814015f},
-std::array<float,2>{0.203280747f, 0.0146044772f},
-std::array<float,2>{0.325725198f, 0.575014889f},
-std::array<float,2>{0.8493132f, 0.268940568f},
-std::array<float,2>{0.777553558f, 0.92226392f},
-std::array<float,2>{0.266893476f, 0.00427531311f},
-std::array<float,2>{0.149528831f, 0.563847899f},
-std::array<float,2>{0.645584404f, 0.276342303f},
-std::array<float,2>{0.62391758f, 0.634519041f},
-std::array<float,2>{0.109306f, 0.439621568f},
-std::array<float,2>{0.379915506f, 0.858382285f},
-std::array<float,2>{0.965453327f, 0.138008207f},
-std::array<float,2>{0.917438745f, 0.529212534f},
-std::array<float,2>{0.444801837f, 0.344051212f},
-std::array<float,2>{0.0499840491f, 0.998205483f},
-std::array<float,2>{0.538575411f, 0.0752381384f},
-std::array<float,2>{0.710696161f, 0.775558114f},
-std::array<float,2>{0.189339548f, 0.19205977f},
-std::array<float,2>{0.343585521f, 0.709221423f},
-std::array<float,2>{0.870668292f, 0.386413753f},
-std::array<float,2>{0.99032104f, 0.829750776f},
-std::array<float,2>{0.422401398f, 0.165548161f},
-std::array<float,2>{0.0771256983f, 0.675592363f},
-std::array<float,2>{0.575392962f, 0.472159266f},
-std::array<float,2>{0.678026557f, 0.603478968f},
-std::array<float,2>{0.177764595f, 0.290178537f},
-std::array<float,2>{0.298336059f, 0.895902395f},
-std::array<float,2>{0.799541473f, 0.0583660789f},
-std::array<float,2>{0.841029644f, 0.728857875f},
-std::array<float,2>{0.373207033f, 0.420725852f},
-std::array<float,2>{0.224995032f, 0.790056407f},
-std::array<float,2>{0.733890414f, 0.23942098f},
-std::array<float,2>{0.504709125f, 0.960917532f},
-std::array<float,2>{0.0230107754f, 0.0969468504f},
-std::array<float,2>{0.486593217f, 0.555584133f},
-std::array<float,2>{0.887473285f, 0.334003478f},
-std::array<float,2>{0.893368721f, 0.974485397f},
-std::array<float,2>{0.470191807f, 0.0809309483f},
-std::array<float,2>{0.0144323865f, 0.505833745f},
-std::array<float,2>{0.524179757f, 0.369439572f},
-std::array<float,2>{0.738285542f, 0.688748538f},
-std::array<float,2>{0.240196034f, 0.404426306f},
-std::array<float,2>{0.349234223f, 0.760097682f},
-std::array<float,2>{0.824178994f, 0.211415902f},
-std::array<float,2>{0.796442509f, 0.579883277f},
-std::array<float,2>{0.293424189f, 0.25908637f},
-std::array<float,2>{0.170955315f, 0.908505976f},
-std::array<float,2>{0.665331781f, 0.0197537038f},
-std::array<float,2>{0.579849482f, 0.869416416f},
-std::array<float,2>{0.0821752474f, 0.153882995f},
-std::array<float,2>{0.418805033f, 0.655076861f},
-std::array<float,2>{0.980861425f, 0.460302562f},
-std::array<float,2>{0.845660388f, 0.806876898f},
-std::array<float,2>{0.322371691f, 0.234241396f},
-std::array<float,2>{0.207287893f, 0.734527528f},
-std::array<float,2>{0.692816138f, 0.426178366f},
-std::array<float,2>{0.547669888f, 0.531834424f},
-std::array<float,2>{0.0352852866f, 0.316342473f},
-std::array<float,2>{0.456108332f, 0.950678647f},
-std::array<float,2>{0.933054924f, 0.122592136f},
-std::array<float,2>{0.940426707f, 0.671117246f},
-std::array<float,2>{0.393316269f, 0.489145905f},
-std::array<float,2>{0.123266362f, 0.827037036f},
-std::array<float,2>{0.597849727f, 0.186728716f},
-std::array<float,2>{0.631526232f, 0.878455877f},
-std::array<float,2>{0.139260992f, 0.0403602384f},
-std::array<float,2>{0.253396839f, 0.623559296f},
-std::array<float,2>{0.762095511f, 0.306222677f},
-std::array<float,2>{0.819394529f, 0.942242742f},
-std::array<float,2>{0.35275802f, 0.115998954f},
-std::array<float,2>{0.249130696f, 0.541976869f},
-std::array<float,2>{0.748032033f, 0.320961773f},
-std::array<float,2>{0.521867037f, 0.745257974f},
-std::array<float,2>{0.0031816517f, 0.434378356f},
-std::array<float,2>{0.478956223f, 0.798872888f},
-std::array<float,2>{0.901157677f, 0.226152763f},
-std::array<float,2>{0.975625873f, 0.614652216f},
-std::array<float,2>{0.406391352f, 0.303096175f},
-std::array<float,2>{0.0887552351f, 0.889333427f},
-std::array<float,2>{0.593019843f, 0.0373695083f},
-std::array<float,2>{0.663181484f, 0.818825781f},
-std::array<float,2>{0.156781033f, 0.172372133f},
-std::array<float,2>{0.284564793f, 0.656872749f},
-std::array<float,2>{0.781554759f, 0.499126315f},
-std::array<float,2>{0.927619696f, 0.755379498f},
-std::array<float,2>{0.46473366f, 0.206876054f},
-std::array<float,2>{0.0434658825f, 0.69592607f},
-std::array<float,2>{0.559579313f, 0.391511917f},
-std::array<float,2>{0.69598937f, 0.51395911f},
-std::array<float,2>{0.213714033f, 0.362826914f},
-std::array<float,2>{0.317635894f, 0.981493592f},
-std::array<float,2>{0.85351187f, 0.0881910771f},
-std::array<float,2>{0.751333356f, 0.642662704f},
-std::array<float,2>{0.264747083f, 0.460984558f},
-std::array<float,2>{0.132123336f, 0.862576842f},
-std::array<float,2>{0.636286557f, 0.141537428f},
-std::array<float,2>{0.601795197f, 0.915187716f},
-std::array<float,2>{0.110147193f, 0.0289971568f},
-std::array<float,2>{0.404077351f, 0.589596987f},
-std::array<float,2>{0.950158715f, 0.250627249f},
-std::array<float,2>{0.953310609f, 0.899334311f},
-std::array<float,2>{0.386719704f, 0.0544432811f},
-std::array<float,2>{0.101163566f, 0.601312697f},
-std::array<float,2>{0.6166991f, 0.286895633f},
-std::array<float,2>{0.652210712f, 0.686048925f},
-std::array<float,2>{0.147333384f, 0.479247481f},
-std::array<float,2>{0.277481347f, 0.836357832f},
-std::array<float,2>{0.766042411f, 0.156765133f},
-std::array<float,2>{0.864265919f, 0.553910434f},
-std::array<float,2>{0.328700274f, 0.336133987f},
-std::array<float,2>{0.196669012f, 0.962285161f},
-std::array<float,2>{0.713242173f, 0.106579319f},
-std::array<float,2>{0.544820189f, 0.784860492f},
-std::array<float,2>{0.0597520545f, 0.246229142f},
-std::array<float,2>{0.447856843f, 0.71953702f},
-std::array<float,2>{0.908183634f, 0.411597431f},
-std::array<float,2>{0.805317342f, 0.847559333f},
-std::array<float,2>{0.30486533f, 0.12897782f},
-std::array<float,2>{0.186510429f, 0.627094448f},
-std::array<float,2>{0.68662411f, 0.449331969f},
-std::array<float,2>{0.569082499f, 0.57399267f},
-std::array<float,2>{0.0669500083f, 0.270820647f},
-std::array<float,2>{0.431483388f, 0.934113383f},
-std::array<float,2>{0.992506325f, 0.00803627912f},
-std::array<float,2>{0.87580812f, 0.711429179f},
-std::array<float,2>{0.49793148f, 0.375644445f},
-std::array<float,2>{0.0275415201f, 0.773314655f},
-std::array<float,2>{0.511792839f, 0.196910322f},
-std::array<float,2>{0.720515549f, 0.990585029f},
-std::array<float,2>{0.233009949f, 0.0653609633f},
-std::array<float,2>{0.361042589f, 0.519857824f},
-std::array<float,2>{0.835043371f, 0.3559165f},
-std::array<float,2>{0.809007764f, 0.948934495f},
-std::array<float,2>{0.31109187f, 0.119035661f},
-std::array<float,2>{0.181868821f, 0.535426319f},
-std::array<float,2>{0.682180643f, 0.319457114f},
-std::array<float,2>{0.56310004f, 0.742015183f},
-std::array<float,2>{0.0644306466f, 0.422409534f},
-std::array<float,2>{0.434235036f, 0.810533285f},
-std::array<float,2>{0.996951044f, 0.229871675f},
-std::array<float,2>{0.881065071f, 0.620180845f},
-std::array<float,2>{0.495432854f, 0.309717059f},
-std::array<float,2>{0.0267062392f, 0.881780624f},
-std::array<float,2>{0.509664237f, 0.0460777842f},
-std::array<float,2>{0.723966956f, 0.821502626f},
-std::array<float,2>{0.227158844f, 0.180641592f},
-std::array<float,2>{0.36517325f, 0.66658318f},
-std::array<float,2>{0.831473708f, 0.485930622f},
-std::array<float,2>{0.960444212f, 0.763754427f},
-std::array<float,2>{0.384723365f, 0.218302533f},
-std::array<float,2>{0.0955779552f, 0.695046842f},
-std::array<float,2>{0.612930715f, 0.400396913f},
-std::array<float,2>{0.654471695f, 0.503110886f},
-std::array<float,2>{0.14320223f, 0.37409538f},
-std::array<float,2>{0.274054527f, 0.971208513f},
-std::array<float,2>{0.772916853f, 0.0855153576f},
-std::array<float,2>{0.860004961f, 0.651408672f},
-std::array<float,2>{0.334142566f, 0.456288159f},
-std::array<float,2>{0.201570496f, 0.874777675f},
-std::array<float,2>{0.716444492f, 0.152004674f},
-std::array<float,2>{0.540371418f, 0.911132038f},
-std::array<float,2>{0.0568683594f, 0.0191900861f},
-std::array<float,2>{0.450458735f, 0.582101882f},
-std::array<float,2>{0.91140449f, 0.262651622f},
-std::array<float,2>{0.922923386f, 0.891299248f},
-std::array<float,2>{0.4682751f, 0.0601661168f},
-std::array<float,2>{0.0425992571f, 0.608005404f},
-std::array<float,2>{0.557040215f, 0.295602143f},
-std::array<float,2>{0.700754106f, 0.676117837f},
-std::array<float,2>{0.215582937f, 0.475251317f},
-std::array<float,2>{0.314406782f, 0.832739592f},
-std::array<float,2>{0.859102547f, 0.168794334f},
-std::array<float,2>{0.756192684f, 0.558796406f},
-std::array<float,2>{0.260716707f, 0.331304699f},
-std::array<float,2>{0.127710626f, 0.956671178f},
-std::array<float,2>{0.63978982f, 0.0981858298f},
-std::array<float,2>{0.606190801f, 0.795642436f},
-std::array<float,2>{0.116661474f, 0.235804975f},
-std::array<float,2>{0.398455232f, 0.734203517f},
-std::array<float,2>{0.94770503f, 0.415409088f},
-std::array<float,2>{0.813617826f, 0.854380071f},
-std::array<float,2>{0.357616991f, 0.135901079f},
-std::array<float,2>{0.243694648f, 0.639251113f},
-std::array<float,2>{0.745952427f, 0.443247676f},
-std::array<float,2>{0.519128084f, 0.568659604f},
-std::array<float,2>{0.00497559831f, 0.278422117f},
-std::array<float,2>{0.483494341f, 0.926348746f},
-std::array<float,2>{0.904637694f, 0.00017386135f},
-std::array<float,2>{0.96944958f, 0.705986321f},
-std::array<float,2>{0.41232422f, 0.390126497f},
-std::array<float,2>{0.0913720205f, 0.781003833f},
-std::array<float,2>{0.588362455f, 0.190879032f},
-std::array<float,2>{0.660009027f, 0.994636118f},
-std::array<float,2>{0.161261201f, 0.0731189772f},
-std::array<float,2>{0.28707096f, 0.523872972f},
-std::array<float,2>{0.785960615f, 0.350477785f},
-std::array<float,2>{0.847969174f, 0.931632757f},
-std::array<float,2>{0.324452847f, 0.012703076f},
-std::array<float,2>{0.204256311f, 0.576800227f},
-std::array<float,2>{0.689181924f, 0.266221315f},
-std::array<float,2>{0.553183794f, 0.631749213f},
-std::array<float,2>{0.0350056365f, 0.447286546f},
-std::array<float,2>{0.457112074f, 0.84779954f},
-std::array<float,2>{0.936803758f, 0.125844926f},
-std::array<float,2>{0.943514764f, 0.516983032f},
-std::array<float,2>{0.396745116f, 0.353091508f},
-std::array<float,2>{0.117301807f, 0.987024486f},
-std::array<float,2>{0.597615242f, 0.0701252967f},
-std::array<float,2>{0.626199484f, 0.768729746f},
-std::array<float,2>{0.132815793f, 0.200595498f},
-std::array<float,2>{0.256781936f, 0.718339086f},
-std::array<float,2>{0.759857237f, 0.38006413f},
-std::array<float,2>{0.895266175f, 0.843040764f},
-std::array<float,2>{0.474617183f, 0.163782835f},
-std::array<float,2>{0.00813556276f, 0.681562185f},
-std::array<float,2>{0.53013742f, 0.483232617f},
-std::array<float,2>{0.735690773f, 0.596464634f},
-std::array<float,2>{0.235970065f, 0.283599019f},
-std::array<float,2>{0.345367759f, 0.90542537f},
-std::array<float,2>{0.82640934f, 0.0497079305f},
-std::array<float,2>{0.790342093f, 0.726550698f},
-std::array<float,2>{0.290407956f, 0.406777799f},
-std::array<float,2>{0.167230055f, 0.786253393f},
-std::array<float,2>{0.668308079f, 0.242808104f},
-std::array<float,2>{0.584014714f, 0.965023518f},
-std::array<float,2>{0.0812159479f, 0.103934407f},
-std::array<float,2>{0.415011853f, 0.549569786f},
-std::array<float,2>{0.977942109f, 0.340992659f},
-std::array<float,2>{0.98762393f, 0.979719043f},
-std::array<float,2>{0.42748636f, 0.0901271328f},
-std::array<float,2>{0.07234402f, 0.509978294f},
-std::array<float,2>{0.571465552f, 0.36414963f},
-std::array<float,2>{0.673169255f, 0.700475991f},
-std::array<float,2>{0.172970191f, 0.395213783f},
-std::array<float,2>{0.30378744f, 0.753840327f},
-std::array<float,2>{0.803240478f, 0.209099635f},
-std::array<float,2>{0.838094532f, 0.591652393f},
-std::array<float,2>{0.37029019f, 0.254921257f},
-std::array<float,2>{0.221857965f, 0.918092549f},
-std::array<float,2>{0.730368912f, 0.0247550625f},
-std::array<float,2>{0.502597809f, 0.865378737f},
-std::array<float,2>{0.0165450238f, 0.146251678f},
-std::array<float,2>{0.489611626f, 0.647278845f},
-std::array<float,2>{0.886147559f, 0.467424989f},
-std::array<float,2>{0.777090013f, 0.800799787f},
-std::array<float,2>{0.271175861f, 0.222451866f},
-std::array<float,2>{0.155053675f, 0.746883333f},
-std::array<float,2>{0.641320705f, 0.429771304f},
-std::array<float,2>{0.620319366f, 0.543761551f},
-std::array<float,2>{0.104213051f, 0.327527553f},
-std::array<float,2>{0.375879079f, 0.94023186f},
-std::array<float,2>{0.962407172f, 0.112061605f},
-std::array<float,2>{0.919138372f, 0.661737561f},
-std::array<float,2>{0.440623432f, 0.495203197f},
-std::array<float,2>{0.0524849109f, 0.815005004f},
-std::array<float,2>{0.535084367f, 0.177352816f},
-std::array<float,2>{0.706815302f, 0.883897603f},
-std::array<float,2>{0.193921879f, 0.0326520652f},
-std::array<float,2>{0.338291407f, 0.609417021f},
-std::array<float,2>{0.874351263f, 0.299950272f},
-std::array<float,2>{0.763549805f, 0.875918627f},
-std::array<float,2>{0.25206852f, 0.042147588f},
-std::array<float,2>{0.139668494f, 0.622531712f},
-std::array<float,2>{0.631955802f, 0.308273822f},
-std::array<float,2>{0.599118233f, 0.669724107f},
-std::array<float,2>{0.124190167f, 0.492089093f},
-std::array<float,2>{0.393817455f, 0.825533092f},
-std::array<float,2>{0.941101611f, 0.183878854f},
-std::array<float,2>{0.931686997f, 0.533818305f},
-std::array<float,2>{0.455755562f, 0.312933654f},
-std::array<float,2>{0.0369735956f, 0.951447189f},
-std::array<float,2>{0.548251748f, 0.124660894f},
-std::array<float,2>{0.692215919f, 0.805977523f},
-std::array<float,2>{0.208690435f, 0.231564671f},
-std::array<float,2>{0.32325393f, 0.737784386f},
-std::array<float,2>{0.844113827f, 0.428203344f},
-std::array<float,2>{0.98183912f, 0.867273331f},
-std::array<float,2>{0.419431359f, 0.155804574f},
-std::array<float,2>{0.0831884742f, 0.653907418f},
-std::array<float,2>{0.578953803f, 0.457804888f},
-std::array<float,2>{0.664583266f, 0.581773877f},
-std::array<float,2>{0.170460999f, 0.261372119f},
-std::array<float,2>{0.294597954f, 0.907437027f},
-std::array<float,2>{0.795068979f, 0.0217791405f},
-std::array<float,2>{0.822881281f, 0.690702021f},
-std::array<float,2>{0.348489016f, 0.402403206f},
-std::array<float,2>{0.238954872f, 0.759519517f},
-std::array<float,2>{0.740089059f, 0.213115364f},
-std::array<float,2>{0.524616957f, 0.975140154f},
-std::array<float,2>{0.0147936018f, 0.0797029883f},
-std::array<float,2>{0.468833178f, 0.50662297f},
-std::array<float,2>{0.893883824f, 0.367275387f},
-std::array<float,2>{0.888143241f, 0.958280683f},
-std::array<float,2>{0.488179743f, 0.0947134122f},
-std::array<float,2>{0.0219429228f, 0.557238698f},
-std::array<float,2>{0.504973233f, 0.332946748f},
-std::array<float,2>{0.733005702f, 0.727743506f},
-std::array<float,2>{0.225965276f, 0.418216288f},
-std::array<float,2>{0.374494493f, 0.791891813f},
-std::array<float,2>{0.840439439f, 0.241272032f},
-std::array<float,2>{0.800160885f, 0.605319679f},
-std::array<float,2>{0.297593951f, 0.291892439f},
-std::array<float,2>{0.179537579f, 0.898030579f},
-std::array<float,2>{0.679209471f, 0.0549137779f},
-std::array<float,2>{0.575138092f, 0.831124783f},
-std::array<float,2>{0.0774141923f, 0.167942733f},
-std::array<float,2>{0.422989756f, 0.673522234f},
-std::array<float,2>{0.991491199f, 0.469554394f},
-std::array<float,2>{0.869621396f, 0.774862409f},
-std::array<float,2>{0.342568368f, 0.193974793f},
-std::array<float,2>{0.188020334f, 0.708292067f},
-std::array<float,2>{0.709276259f, 0.383140981f},
-std::array<float,2>{0.537138581f, 0.530414283f},
-std::array<float,2>{0.0488660038f, 0.347362936f},
-std::array<float,2>{0.44381541f, 0.997835517f},
-std::array<float,2>{0.916153789f, 0.0772821531f},
-std::array<float,2>{0.966255486f, 0.635720432f},
-std::array<float,2>{0.379550755f, 0.438336909f},
-std::array<float,2>{0.107475698f, 0.856212676f},
-std::array<float,2>{0.624548852f, 0.140388295f},
-std::array<float,2>{0.64490509f, 0.924328208f},
-std::array<float,2>{0.148701414f, 0.00667443685f},
-std::array<float,2>{0.266008765f, 0.56553483f},
-std::array<float,2>{0.778481245f, 0.274162143f},
-std::array<float,2>{0.83420229f, 0.989407957f},
-std::array<float,2>{0.359573126f, 0.0627668947f},
-std::array<float,2>{0.233636141f, 0.522953689f},
-std::array<float,2>{0.719069123f, 0.358044893f},
-std::array<float,2>{0.513359785f, 0.714676023f},
-std::array<float,2>{0.0288166367f, 0.377303064f},
-std::array<float,2>{0.496923387f, 0.770310581f},
-std::array<float,2>{0.876338899f, 0.197850794f},
-std::array<float,2>{0.993787229f, 0.571808577f},
-std::array<float,2>{0.4305695f, 0.27263689f},
-std::array<float,2>{0.0680094287f, 0.936409056f},
-std::array<float,2>{0.569893479f, 0.0105154561f},
-std::array<float,2>{0.685896158f, 0.845445096f},
-std::array<float,2>{0.186904639f, 0.131448194f},
-std::array<float,2>{0.305801511f, 0.625088215f},
-std::array<float,2>{0.805997789f, 0.451340824f},
-std::array<float,2>{0.906505346f, 0.781890154f},
-std::array<float,2>{0.448916048f, 0.249720082f},
-std::array<float,2>{0.0588729493f, 0.722171962f},
-std::array<float,2>{0.543681443f, 0.413609743f},
-std::array<float,2>{0.714508295f, 0.552511334f},
-std::array<float,2>{0.195876315f, 0.339554995f},
-std::array<float,2>{0.329929501f, 0.963341951f},
-std::array<float,2>{0.863606572f, 0.108781576f},
-std::array<float,2>{0.767059267f, 0.685037017f},
-std::array<float,2>{0.279216617f, 0.47776559f},
-std::array<float,2>{0.147882119f, 0.839423597f},
-std::array<float,2>{0.651171207f, 0.158646494f},
-std::array<float,2>{0.615792334f, 0.900752723f},
-std::array<float,2>{0.099797219f, 0.0523090549f},
-std::array<float,2>{0.388425946f, 0.599251866f},
-std::array<float,2>{0.954738736f, 0.287501574f},
-std::array<float,2>{0.950240731f, 0.917039752f},
-std::array<float,2>{0.403031111f, 0.0302892085f},
-std::array<float,2>{0.110393949f, 0.586159647f},
-std::array<float,2>{0.602819145f, 0.252141416f},
-std::array<float,2>{0.635366976f, 0.641643703f},
-std::array<float,2>{0.130905628f, 0.463630974f},
-std::array<float,2>{0.264077574f, 0.86063534f},
-std::array<float,2>{0.750164688f, 0.144189492f},
-std::array<float,2>{0.851958632f, 0.512923181f},
-std::array<float,2>{0.316999942f, 0.361284643f},
-std::array<float,2>{0.213884488f, 0.98343116f},
-std::array<float,2>{0.696801662f, 0.0865857154f},
-std::array<float,2>{0.558921933f, 0.757657707f},
-std::array<float,2>{0.0447995402f, 0.204409912f},
-std::array<float,2>{0.463624448f, 0.698416889f},
-std::array<float,2>{0.92659992f, 0.394483507f},
-std::array<float,2>{0.78261435f, 0.816720009f},
-std::array<float,2>{0.283437133f, 0.174192026f},
-std::array<float,2>{0.158163756f, 0.658475339f},
-std::array<float,2>{0.662478685f, 0.497011006f},
-std::array<float,2>{0.591903746f, 0.615777016f},
-std::array<float,2>{0.0889128372f, 0.302458048f},
-std::array<float,2>{0.407540381f, 0.887911499f},
-std::array<float,2>{0.975100994f, 0.0370031856f},
-std::array<float,2>{0.902255118f, 0.742852926f},
-std::array<float,2>{0.48016724f, 0.435807109f},
-std::array<float,2>{0.00210397062f, 0.798827171f},
-std::array<float,2>{0.523130834f, 0.223418012f},
-std::array<float,2>{0.746267736f, 0.943543017f},
-std::array<float,2>{0.248629883f, 0.113833576f},
-std::array<float,2>{0.351623774f, 0.539441764f},
-std::array<float,2>{0.819097877f, 0.323608428f},
-std::array<float,2>{0.770265818f, 0.969307899f},
-std::array<float,2>{0.27671653f, 0.0838625655f},
-std::array<float,2>{0.142032459f, 0.501902044f},
-std::array<float,2>{0.653891265f, 0.371703655f},
-std::array<float,2>{0.610773206f, 0.691522181f},
-std::array<float,2>{0.097259514f, 0.399874657f},
-std::array<float,2>{0.385985166f, 0.762506545f},
-std::array<float,2>{0.958004355f, 0.216342688f},
-std::array<float,2>{0.912444293f, 0.585732877f},
-std::array<float,2>{0.452867538f, 0.264009804f},
-std::array<float,2>{0.055329334f, 0.91359669f},
-std::array<float,2>{0.541337967f, 0.0161739178f},
-std::array<float,2>{0.718589604f, 0.87167871f},
-std::array<float,2>{0.20031105f, 0.148983613f},
-std::array<float,2>{0.333403051f, 0.649513483f},
-std::array<float,2>{0.862981498f, 0.454519391f},
-std::array<float,2>{0.998118579f, 0.811787307f},
-std::array<float,2>{0.437174916f, 0.228126645f},
-std::array<float,2>{0.0651652068f, 0.740222573f},
-std::array<float,2>{0.564672291f, 0.424922913f},
-std::array<float,2>{0.680835485f, 0.53781575f},
-std::array<float,2>{0.18060343f, 0.317674041f},
-std::array<float,2>{0.3104963f, 0.946864128f},
-std::array<float,2>{0.812322676f, 0.12091846f},
-std::array<float,2>{0.828698456f, 0.66502732f},
-std::array<float,2>{0.366989106f, 0.486898631f},
-std::array<float,2>{0.229952842f, 0.82268405f},
-std::array<float,2>{0.725502372f, 0.181773365f},
-std::array<float,2>{0.511224985f, 0.880396008f},
-std::array<float,2>{0.024590062f, 0.0430599712f},
-std::array<float,2>{0.494013816f, 0.618973553f},
-std::array<float,2>{0.8789891f, 0.31124261f},
-std::array<float,2>{0.9034338f, 0.929259419f},
-std::array<float,2>{0.480732352f, 0.00312442216f},
-std::array<float,2>{0.0065034898f, 0.568062842f},
-std::array<float,2>{0.516247928f, 0.280069023f},
-std::array<float,2>{0.743439734f, 0.638305008f},
-std::array<float,2>{0.245540082f, 0.445263505f},
-std::array<float,2>{0.355612278f, 0.853308558f},
-std::array<float,2>{0.814715922f, 0.134643048f},
-std::array<float,2>{0.788428605f, 0.525706112f},
-std::array<float,2>{0.288820893f, 0.349397421f},
-std::array<float,2>{0.162280768f, 0.993151844f},
-std::array<float,2>{0.656693041f, 0.0714648888f},
-std::array<float,2>{0.587354124f, 0.779252529f},
-std::array<float,2>{0.0932163745f, 0.188094512f},
-std::array<float,2>{0.410841286f, 0.704968274f},
-std::array<float,2>{0.971200407f, 0.388456136f},
-std::array<float,2>{0.855975568f, 0.835226417f},
-std::array<float,2>{0.314991534f, 0.171482697f},
-std::array<float,2>{0.217550144f, 0.678485692f},
-std::array<float,2>{0.702741206f, 0.47393775f},
-std::array<float,2>{0.556379735f, 0.606649876f},
-std::array<float,2>{0.0396131203f, 0.294436842f},
-std::array<float,2>{0.465054393f, 0.894333422f},
-std::array<float,2>{0.925226033f, 0.0621715114f},
-std::array<float,2>{0.945989072f, 0.731996715f},
-std::array<float,2>{0.400752515f, 0.416967094f},
-std::array<float,2>{0.114773966f, 0.793031335f},
-std::array<float,2>{0.608917177f, 0.238180608f},
-std::array<float,2>{0.637293816f, 0.95392704f},
-std::array<float,2>{0.126037881f, 0.101130091f},
-std::array<float,2>{0.259485066f, 0.561693907f},
-std::array<float,2>{0.754577577f, 0.328798622f},
-std::array<float,2>{0.825359225f, 0.902967095f},
-std::array<float,2>{0.34664619f, 0.0481453016f},
-std::array<float,2>{0.236697048f, 0.59473294f},
-std::array<float,2>{0.738079965f, 0.281972915f},
-std::array<float,2>{0.528662145f, 0.681893826f},
-std::array<float,2>{0.00976934843f, 0.481801242f},
-std::array<float,2>{0.472732455f, 0.840810061f},
-std::array<float,2>{0.89718616f, 0.16164194f},
-std::array<float,2>{0.979680359f, 0.547849476f},
-std::array<float,2>{0.416359842f, 0.343384475f},
-std::array<float,2>{0.0797248781f, 0.967089057f},
-std::array<float,2>{0.582504272f, 0.1030569f},
-std::array<float,2>{0.670999587f, 0.787534714f},
-std::array<float,2>{0.165204048f, 0.246036455f},
-std::array<float,2>{0.292805523f, 0.724594474f},
-std::array<float,2>{0.792131901f, 0.409760743f},
-std::array<float,2>{0.934373975f, 0.851091444f},
-std::array<float,2>{0.4603405f, 0.127602667f},
-std::array<float,2>{0.0331517085f, 0.629112363f},
-std::array<float,2>{0.550822079f, 0.445673645f},
-std::array<float,2>{0.689543247f, 0.57586205f},
-std::array<float,2>{0.20590961f, 0.268532187f},
-std::array<float,2>{0.326636612f, 0.932837009f},
-std::array<float,2>{0.851118505f, 0.0155400187f},
-std::array<float,2>{0.757934153f, 0.716582954f},
-std::array<float,2>{0.255320549f, 0.382259846f},
-std::array<float,2>{0.135389537f, 0.767290175f},
-std::array<float,2>{0.627552211f, 0.203124166f},
-std::array<float,2>{0.594667315f, 0.986171365f},
-std::array<float,2>{0.120435856f, 0.0682938471f},
-std::array<float,2>{0.395997673f, 0.517617524f},
-std::array<float,2>{0.942919672f, 0.354968429f},
-std::array<float,2>{0.963728309f, 0.937912464f},
-std::array<float,2>{0.378719032f, 0.110423319f},
-std::array<float,2>{0.102680072f, 0.545394003f},
-std::array<float,2>{0.617837846f, 0.325513512f},
-std::array<float,2>{0.643571377f, 0.748888314f},
-std::array<float,2>{0.154015988f, 0.432304978f},
-std::array<float,2>{0.272986084f, 0.804504693f},
-std::array<float,2>{0.775075972f, 0.219464511f},
-std::array<float,2>{0.871752024f, 0.612883627f},
-std::array<float,2>{0.335986257f, 0.297385991f},
-std::array<float,2>{0.192125559f, 0.884944856f},
-std::array<float,2>{0.703194857f, 0.0346722268f},
-std::array<float,2>{0.531519115f, 0.812901437f},
-std::array<float,2>{0.0531763174f, 0.178740039f},
-std::array<float,2>{0.437936217f, 0.663221776f},
-std::array<float,2>{0.921423316f, 0.492569298f},
-std::array<float,2>{0.801998138f, 0.751692593f},
-std::array<float,2>{0.301403373f, 0.207106248f},
-std::array<float,2>{0.174323276f, 0.701642156f},
-std::array<float,2>{0.675364077f, 0.397207588f},
-std::array<float,2>{0.572426856f, 0.509512424f},
-std::array<float,2>{0.0703689605f, 0.365293682f},
-std::array<float,2>{0.429455906f, 0.977611125f},
-std::array<float,2>{0.985681295f, 0.0927311927f},
-std::array<float,2>{0.884112597f, 0.645418763f},
-std::array<float,2>{0.491399616f, 0.46533066f},
-std::array<float,2>{0.0193363074f, 0.863543034f},
-std::array<float,2>{0.501240432f, 0.147460938f},
-std::array<float,2>{0.727228165f, 0.92089045f},
-std::array<float,2>{0.219725564f, 0.0257525444f},
-std::array<float,2>{0.368405372f, 0.592822731f},
-std::array<float,2>{0.8363204f, 0.255867302f},
-std::array<float,2>{0.79388082f, 0.909539759f},
-std::array<float,2>{0.295008898f, 0.0213607419f},
-std::array<float,2>{0.167998895f, 0.579051375f},
-std::array<float,2>{0.666480362f, 0.257863879f},
-std::array<float,2>{0.581899405f, 0.655611992f},
-std::array<float,2>{0.0857767761f, 0.459930539f},
-std::array<float,2>{0.421756685f, 0.870258033f},
-std::array<float,2>{0.98287797f, 0.152528301f},
-std::array<float,2>{0.890996158f, 0.504796386f},
-std::array<float,2>{0.471714169f, 0.370745152f},
-std::array<float,2>{0.0121823838f, 0.973090112f},
-std::array<float,2>{0.526753724f, 0.0818766952f},
-std::array<float,2>{0.740711153f, 0.761383176f},
-std::array<float,2>{0.241668627f, 0.212562874f},
-std::array<float,2>{0.350653112f, 0.687948823f},
-std::array<float,2>{0.82157594f, 0.405411035f},
-std::array<float,2>{0.9377141f, 0.827828586f},
-std::array<float,2>{0.391118526f, 0.185927048f},
-std::array<float,2>{0.122097835f, 0.670105278f},
-std::array<float,2>{0.600421548f, 0.490177274f},
-std::array<float,2>{0.629421175f, 0.624389112f},
-std::array<float,2>{0.137140796f, 0.30562377f},
-std::array<float,2>{0.250414521f, 0.877587855f},
-std::array<float,2>{0.764487028f, 0.0396046229f},
-std::array<float,2>{0.847075939f, 0.735564113f},
-std::array<float,2>{0.320538402f, 0.427092135f},
-std::array<float,2>{0.21022588f, 0.8080796f},
-std::array<float,2>{0.695234835f, 0.233266339f},
-std::array<float,2>{0.549419641f, 0.950166464f},
-std::array<float,2>{0.0381021574f, 0.121674716f},
-std::array<float,2>{0.454930484f, 0.532266974f},
-std::array<float,2>{0.929729342f, 0.315031081f},
-std::array<float,2>{0.914562285f, 0.999446571f},
-std::array<float,2>{0.441889793f, 0.0747066811f},
-std::array<float,2>{0.0485605523f, 0.528055429f},
-std::array<float,2>{0.535885334f, 0.345688969f},
-std::array<float,2>{0.70822072f, 0.710028827f},
-std::array<float,2>{0.191305682f, 0.385400385f},
-std::array<float,2>{0.34101209f, 0.777023256f},
-std::array<float,2>{0.868967354f, 0.192755401f},
-std::array<float,2>{0.780355692f, 0.562521458f},
-std::array<float,2>{0.26870364f, 0.277157336f},
-std::array<float,2>{0.151002929f, 0.922991633f},
-std::array<float,2>{0.646655917f, 0.00550216017f},
-std::array<float,2>{0.622500718f, 0.858833015f},
-std::array<float,2>{0.106325857f, 0.137665048f},
-std::array<float,2>{0.381839007f, 0.633657575f},
-std::array<float,2>{0.967342138f, 0.440628499f},
-std::array<float,2>{0.8432284f, 0.789549053f},
-std::array<float,2>{0.37189582f, 0.239110768f},
-std::array<float,2>{0.223970041f, 0.72973901f},
-std::array<float,2>{0.732305586f, 0.42119053f},
-std::array<float,2>{0.506892681f, 0.556084991f},
-std::array<float,2>{0.0209915079f, 0.335036784f},
-std::array<float,2>{0.484696656f, 0.959631503f},
-std::array<float,2>{0.889487922f, 0.0957646072f},
-std::array<float,2>{0.989286423f, 0.673925042f},
-std::array<float,2>{0.424789697f, 0.471266985f},
-std::array<float,2>{0.0747583881f, 0.828529835f},
-std::array<float,2>{0.578115165f, 0.164916649f},
-std::array<float,2>{0.677612126f, 0.894956946f},
-std::array<float,2>{0.175951019f, 0.0571693331f},
-std::array<float,2>{0.300467104f, 0.60173595f},
-std::array<float,2>{0.797151983f, 0.289184004f},
-std::array<float,2>{0.86596489f, 0.961362004f},
-std::array<float,2>{0.331010163f, 0.105583966f},
-std::array<float,2>{0.198277503f, 0.553631127f},
-std::array<float,2>{0.711461961f, 0.337680519f},
-std::array<float,2>{0.545720339f, 0.720202386f},
-std::array<float,2>{0.0608969666f, 0.410213232f},
-std::array<float,2>{0.445640713f, 0.783396423f},
-std::array<float,2>{0.909210443f, 0.248015657f},
-std::array<float,2>{0.955409646f, 0.600306213f},
-std::array<float,2>{0.39006719f, 0.285430342f},
-std::array<float,2>{0.0991443247f, 0.900164604f},
-std::array<float,2>{0.614565313f, 0.0536327697f},
-std::array<float,2>{0.649219513f, 0.83693707f},
-std::array<float,2>{0.146405712f, 0.157276377f},
-std::array<float,2>{0.279338509f, 0.687460661f},
-std::array<float,2>{0.767961025f, 0.480232239f},
-std::array<float,2>{0.877876759f, 0.771703839f},
-std::array<float,2>{0.499348909f, 0.195462942f},
-std::array<float,2>{0.0297352169f, 0.712756038f},
-std::array<float,2>{0.514989316f, 0.376325667f},
-std::array<float,2>{0.72174114f, 0.520645201f},
-std::array<float,2>{0.232414961f, 0.35724169f},
-std::array<float,2>{0.362061471f, 0.991253734f},
-std::array<float,2>{0.83280021f, 0.0663369298f},
-std::array<float,2>{0.806719601f, 0.628546953f},
-std::array<float,2>{0.308119297f, 0.450966448f},
-std::array<float,2>{0.185335964f, 0.846614122f},
-std::array<float,2>{0.684153676f, 0.129914775f},
-std::array<float,2>{0.568123758f, 0.934911489f},
-std::array<float,2>{0.0685439333f, 0.00918021798f},
-std::array<float,2>{0.432213694f, 0.572823763f},
-std::array<float,2>{0.994737387f, 0.269646883f},
-std::array<float,2>{0.972656608f, 0.889694035f},
-std::array<float,2>{0.408892155f, 0.0385688841f},
-std::array<float,2>{0.0860686228f, 0.61388284f},
-std::array<float,2>{0.591086149f, 0.304027349f},
-std::array<float,2>{0.661722362f, 0.657386482f},
-std::array<float,2>{0.159642473f, 0.498358577f},
-std::array<float,2>{0.282158762f, 0.819940567f},
-std::array<float,2>{0.783912778f, 0.173685834f},
-std::array<float,2>{0.816961408f, 0.542577147f},
-std::array<float,2>{0.354131907f, 0.322182626f},
-std::array<float,2>{0.248036787f, 0.94246459f},
-std::array<float,2>{0.749524474f, 0.11707098f},
-std::array<float,2>{0.520048082f, 0.800171733f},
-std::array<float,2>{0.00179460889f, 0.22517319f},
-std::array<float,2>{0.478294581f, 0.744179726f},
-std::array<float,2>{0.90006566f, 0.434640765f},
-std::array<float,2>{0.753026247f, 0.86226207f},
-std::array<float,2>{0.263136268f, 0.141906545f},
-std::array<float,2>{0.129535243f, 0.644060791f},
-std::array<float,2>{0.634394586f, 0.462886751f},
-std::array<float,2>{0.604517043f, 0.588453174f},
-std::array<float,2>{0.112584867f, 0.251236856f},
-std::array<float,2>{0.405023992f, 0.914274633f},
-std::array<float,2>{0.951276839f, 0.0275802258f},
-std::array<float,2>{0.928137958f, 0.696706414f},
-std::array<float,2>{0.462817103f, 0.391747743f},
-std::array<float,2>{0.0453555882f, 0.754342079f},
-std::array<float,2>{0.561632276f, 0.20604445f},
-std::array<float,2>{0.698578954f, 0.980733633f},
-std::array<float,2>{0.212736785f, 0.0891767219f},
-std::array<float,2>{0.319774777f, 0.515585005f},
-std::array<float,2>{0.855298817f, 0.361960232f}}
\ No newline at end of file
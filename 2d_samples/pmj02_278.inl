@@ -1,4096 +0,0 @@
-{std::array<float,2>{0.022371335f, 0.414845884f},
-std::array<float,2>{0.935236156f, 0.660753131f},
-std::array<float,2>{0.7403602f, 0.236355647f},
-std::array<float,2>{0.463719189f, 0.960487247f},
-std::array<float,2>{0.297422737f, 0.0605753399f},
-std::array<float,2>{0.518702507f, 0.84685576f},
-std::array<float,2>{0.756659389f, 0.273092449f},
-std::array<float,2>{0.159917623f, 0.589093328f},
-std::array<float,2>{0.422623068f, 0.332173496f},
-std::array<float,2>{0.658779502f, 0.501683116f},
-std::array<float,2>{0.987863421f, 0.0901359692f},
-std::array<float,2>{0.10476774f, 0.766878784f},
-std::array<float,2>{0.226261586f, 0.159494773f},
-std::array<float,2>{0.868895054f, 0.931403935f},
-std::array<float,2>{0.58504039f, 0.488740087f},
-std::array<float,2>{0.325744689f, 0.712837994f},
-std::array<float,2>{0.146608233f, 0.305599183f},
-std::array<float,2>{0.808373988f, 0.624373198f},
-std::array<float,2>{0.543914735f, 0.0242423974f},
-std::array<float,2>{0.263912708f, 0.825858772f},
-std::array<float,2>{0.48255527f, 0.213336214f},
-std::array<float,2>{0.704611182f, 0.998366296f},
-std::array<float,2>{0.878537714f, 0.398672014f},
-std::array<float,2>{0.0453550927f, 0.64401406f},
-std::array<float,2>{0.354692221f, 0.440807641f},
-std::array<float,2>{0.611040235f, 0.738680601f},
-std::array<float,2>{0.840675712f, 0.152869582f},
-std::array<float,2>{0.21141699f, 0.881829202f},
-std::array<float,2>{0.0736012831f, 0.0988300964f},
-std::array<float,2>{0.954394102f, 0.785839856f},
-std::array<float,2>{0.635846138f, 0.350940406f},
-std::array<float,2>{0.39570865f, 0.550214589f},
-std::array<float,2>{0.120498203f, 0.367756367f},
-std::array<float,2>{0.973297119f, 0.53153199f},
-std::array<float,2>{0.685228467f, 0.123274267f},
-std::array<float,2>{0.413053155f, 0.811736286f},
-std::array<float,2>{0.341090202f, 0.140593722f},
-std::array<float,2>{0.572565854f, 0.894916356f},
-std::array<float,2>{0.854978383f, 0.459387153f},
-std::array<float,2>{0.246512681f, 0.732826531f},
-std::array<float,2>{0.450403124f, 0.376278639f},
-std::array<float,2>{0.734093606f, 0.638576865f},
-std::array<float,2>{0.914826095f, 0.194306001f},
-std::array<float,2>{0.00708338944f, 0.968836069f},
-std::array<float,2>{0.180415109f, 0.0136276856f},
-std::array<float,2>{0.778613329f, 0.838066578f},
-std::array<float,2>{0.500437319f, 0.29571262f},
-std::array<float,2>{0.288265556f, 0.595472038f},
-std::array<float,2>{0.189220071f, 0.47866115f},
-std::array<float,2>{0.824162841f, 0.695983768f},
-std::array<float,2>{0.595463574f, 0.17426832f},
-std::array<float,2>{0.366314977f, 0.907211006f},
-std::array<float,2>{0.378188759f, 0.0663201958f},
-std::array<float,2>{0.649308681f, 0.750888944f},
-std::array<float,2>{0.943361998f, 0.326247603f},
-std::array<float,2>{0.0919528082f, 0.515647888f},
-std::array<float,2>{0.274489671f, 0.255946547f},
-std::array<float,2>{0.547966719f, 0.570803523f},
-std::array<float,2>{0.791893184f, 0.0415993743f},
-std::array<float,2>{0.139052913f, 0.865035594f},
-std::array<float,2>{0.0605136938f, 0.230126888f},
-std::array<float,2>{0.904536903f, 0.950037003f},
-std::array<float,2>{0.696507156f, 0.428403437f},
-std::array<float,2>{0.489947557f, 0.676760733f},
-std::array<float,2>{0.0789940357f, 0.463544071f},
-std::array<float,2>{0.951454163f, 0.722707629f},
-std::array<float,2>{0.64532131f, 0.132634282f},
-std::array<float,2>{0.386138797f, 0.903991997f},
-std::array<float,2>{0.372814626f, 0.11611551f},
-std::array<float,2>{0.607670307f, 0.799436033f},
-std::array<float,2>{0.813381255f, 0.363075465f},
-std::array<float,2>{0.198251814f, 0.543376148f},
-std::array<float,2>{0.493715525f, 0.283835053f},
-std::array<float,2>{0.694341958f, 0.605299175f},
-std::array<float,2>{0.897627413f, 0.00769306766f},
-std::array<float,2>{0.0519746132f, 0.832068205f},
-std::array<float,2>{0.1252314f, 0.201830402f},
-std::array<float,2>{0.785715222f, 0.978343368f},
-std::array<float,2>{0.560089588f, 0.387032956f},
-std::array<float,2>{0.266093135f, 0.627054989f},
-std::array<float,2>{0.234717101f, 0.31713289f},
-std::array<float,2>{0.84421891f, 0.525200784f},
-std::array<float,2>{0.56332016f, 0.0772088319f},
-std::array<float,2>{0.333757341f, 0.760266304f},
-std::array<float,2>{0.41861558f, 0.186117858f},
-std::array<float,2>{0.679593444f, 0.921771944f},
-std::array<float,2>{0.978809357f, 0.474823087f},
-std::array<float,2>{0.11193651f, 0.693567872f},
-std::array<float,2>{0.29092747f, 0.43392095f},
-std::array<float,2>{0.511289656f, 0.687437832f},
-std::array<float,2>{0.766807675f, 0.224343568f},
-std::array<float,2>{0.174467862f, 0.938399851f},
-std::array<float,2>{0.0112616569f, 0.0362298526f},
-std::array<float,2>{0.910239041f, 0.873836458f},
-std::array<float,2>{0.724830627f, 0.259749651f},
-std::array<float,2>{0.444642782f, 0.567289591f},
-std::array<float,2>{0.0340586156f, 0.277804613f},
-std::array<float,2>{0.885340154f, 0.581099272f},
-std::array<float,2>{0.71343261f, 0.051174894f},
-std::array<float,2>{0.470375597f, 0.85835433f},
-std::array<float,2>{0.254420042f, 0.249960646f},
-std::array<float,2>{0.532915056f, 0.964937031f},
-std::array<float,2>{0.800495446f, 0.408805788f},
-std::array<float,2>{0.153001606f, 0.665938854f},
-std::array<float,2>{0.399602592f, 0.499056518f},
-std::array<float,2>{0.625105023f, 0.706263602f},
-std::array<float,2>{0.967978597f, 0.1641725f},
-std::array<float,2>{0.0661381409f, 0.925322592f},
-std::array<float,2>{0.21054785f, 0.0789263919f},
-std::array<float,2>{0.832524896f, 0.776957393f},
-std::array<float,2>{0.618810236f, 0.338233143f},
-std::array<float,2>{0.347441882f, 0.51500845f},
-std::array<float,2>{0.171240985f, 0.39650467f},
-std::array<float,2>{0.762359321f, 0.655548573f},
-std::array<float,2>{0.523960888f, 0.209571958f},
-std::array<float,2>{0.308801472f, 0.990080237f},
-std::array<float,2>{0.455961972f, 0.0162548739f},
-std::array<float,2>{0.747538686f, 0.815049112f},
-std::array<float,2>{0.925962567f, 0.301551491f},
-std::array<float,2>{0.0247408263f, 0.60977143f},
-std::array<float,2>{0.317970753f, 0.354337305f},
-std::array<float,2>{0.589924395f, 0.559574306f},
-std::array<float,2>{0.861760557f, 0.105182506f},
-std::array<float,2>{0.232628778f, 0.795455337f},
-std::array<float,2>{0.100621134f, 0.145216331f},
-std::array<float,2>{0.997162044f, 0.885245025f},
-std::array<float,2>{0.664720714f, 0.446134478f},
-std::array<float,2>{0.432926327f, 0.748742461f},
-std::array<float,2>{0.106648788f, 0.384503663f},
-std::array<float,2>{0.991989076f, 0.631218851f},
-std::array<float,2>{0.661362588f, 0.197771654f},
-std::array<float,2>{0.429439098f, 0.980993867f},
-std::array<float,2>{0.322681189f, 0.00352110341f},
-std::array<float,2>{0.580017865f, 0.830481052f},
-std::array<float,2>{0.873445153f, 0.288515598f},
-std::array<float,2>{0.221705765f, 0.60707128f},
-std::array<float,2>{0.466384977f, 0.364925355f},
-std::array<float,2>{0.738052189f, 0.540659726f},
-std::array<float,2>{0.931195438f, 0.112629734f},
-std::array<float,2>{0.0186725166f, 0.803317189f},
-std::array<float,2>{0.160237953f, 0.128252551f},
-std::array<float,2>{0.753247917f, 0.902012408f},
-std::array<float,2>{0.521329403f, 0.467411458f},
-std::array<float,2>{0.302371562f, 0.719132423f},
-std::array<float,2>{0.216138124f, 0.265158623f},
-std::array<float,2>{0.837059975f, 0.565532029f},
-std::array<float,2>{0.615709364f, 0.0343616605f},
-std::array<float,2>{0.356483459f, 0.870907068f},
-std::array<float,2>{0.393501639f, 0.219152927f},
-std::array<float,2>{0.638317287f, 0.943527281f},
-std::array<float,2>{0.959764004f, 0.430562228f},
-std::array<float,2>{0.0751965046f, 0.681957185f},
-std::array<float,2>{0.260579348f, 0.469349563f},
-std::array<float,2>{0.542847216f, 0.690737605f},
-std::array<float,2>{0.811671734f, 0.181570843f},
-std::array<float,2>{0.143316612f, 0.914188445f},
-std::array<float,2>{0.0406538323f, 0.0722686648f},
-std::array<float,2>{0.881106079f, 0.765622854f},
-std::array<float,2>{0.709280372f, 0.314197659f},
-std::array<float,2>{0.478805721f, 0.528596878f},
-std::array<float,2>{0.00255987304f, 0.343514413f},
-std::array<float,2>{0.919360757f, 0.511586308f},
-std::array<float,2>{0.73034662f, 0.0845051929f},
-std::array<float,2>{0.447386473f, 0.777933836f},
-std::array<float,2>{0.284867615f, 0.169482395f},
-std::array<float,2>{0.507052124f, 0.926432073f},
-std::array<float,2>{0.775584996f, 0.493824452f},
-std::array<float,2>{0.18443121f, 0.70940268f},
-std::array<float,2>{0.409443527f, 0.411707312f},
-std::array<float,2>{0.682758212f, 0.669278324f},
-std::array<float,2>{0.971024394f, 0.245045111f},
-std::array<float,2>{0.121883035f, 0.962988079f},
-std::array<float,2>{0.245376736f, 0.0493702739f},
-std::array<float,2>{0.857443035f, 0.852365911f},
-std::array<float,2>{0.57799387f, 0.275633156f},
-std::array<float,2>{0.338544786f, 0.585126877f},
-std::array<float,2>{0.135724023f, 0.450816453f},
-std::array<float,2>{0.796241939f, 0.745836914f},
-std::array<float,2>{0.552022874f, 0.143807247f},
-std::array<float,2>{0.280888915f, 0.890171885f},
-std::array<float,2>{0.487053752f, 0.106127806f},
-std::array<float,2>{0.699549317f, 0.790436506f},
-std::array<float,2>{0.900829196f, 0.356020033f},
-std::array<float,2>{0.0563867912f, 0.557443798f},
-std::array<float,2>{0.361072451f, 0.300154477f},
-std::array<float,2>{0.601433158f, 0.613730073f},
-std::array<float,2>{0.824287176f, 0.020430252f},
-std::array<float,2>{0.194632486f, 0.819186866f},
-std::array<float,2>{0.0874849558f, 0.205789268f},
-std::array<float,2>{0.939679384f, 0.987180114f},
-std::array<float,2>{0.6526438f, 0.39086476f},
-std::array<float,2>{0.381295383f, 0.651626348f},
-std::array<float,2>{0.0481966846f, 0.487747729f},
-std::array<float,2>{0.891574681f, 0.717532873f},
-std::array<float,2>{0.688198745f, 0.160983369f},
-std::array<float,2>{0.499897897f, 0.936516643f},
-std::array<float,2>{0.27074042f, 0.0871132463f},
-std::array<float,2>{0.556524456f, 0.770692706f},
-std::array<float,2>{0.782151878f, 0.328338206f},
-std::array<float,2>{0.131184205f, 0.507000089f},
-std::array<float,2>{0.387154758f, 0.267153651f},
-std::array<float,2>{0.642142415f, 0.59299475f},
-std::array<float,2>{0.945622742f, 0.0563848317f},
-std::array<float,2>{0.0833876058f, 0.849913538f},
-std::array<float,2>{0.202796206f, 0.241751447f},
-std::array<float,2>{0.81791842f, 0.953916371f},
-std::array<float,2>{0.60251987f, 0.419903368f},
-std::array<float,2>{0.368818879f, 0.657034934f},
-std::array<float,2>{0.179462597f, 0.345885962f},
-std::array<float,2>{0.772628009f, 0.554115057f},
-std::array<float,2>{0.514563143f, 0.0940862969f},
-std::array<float,2>{0.296610028f, 0.781572878f},
-std::array<float,2>{0.440972686f, 0.149864495f},
-std::array<float,2>{0.721107662f, 0.878530145f},
-std::array<float,2>{0.906350613f, 0.442770839f},
-std::array<float,2>{0.0151712261f, 0.735239983f},
-std::array<float,2>{0.331006646f, 0.403569549f},
-std::array<float,2>{0.570043206f, 0.646784723f},
-std::array<float,2>{0.848564088f, 0.217977375f},
-std::array<float,2>{0.240080535f, 0.99566251f},
-std::array<float,2>{0.116428599f, 0.0287261344f},
-std::array<float,2>{0.984183967f, 0.823243737f},
-std::array<float,2>{0.674753249f, 0.309996068f},
-std::array<float,2>{0.415582538f, 0.619366348f},
-std::array<float,2>{0.06887272f, 0.289199054f},
-std::array<float,2>{0.963959694f, 0.601124525f},
-std::array<float,2>{0.628968418f, 0.0115760639f},
-std::array<float,2>{0.404677421f, 0.842126727f},
-std::array<float,2>{0.350303411f, 0.189116642f},
-std::array<float,2>{0.621115506f, 0.975436509f},
-std::array<float,2>{0.828408301f, 0.379522145f},
-std::array<float,2>{0.206952065f, 0.636295676f},
-std::array<float,2>{0.475652546f, 0.455424756f},
-std::array<float,2>{0.71815896f, 0.727177918f},
-std::array<float,2>{0.887490273f, 0.135866433f},
-std::array<float,2>{0.0364511274f, 0.891290724f},
-std::array<float,2>{0.149386004f, 0.118671283f},
-std::array<float,2>{0.804524422f, 0.806321144f},
-std::array<float,2>{0.537330329f, 0.374474615f},
-std::array<float,2>{0.253734499f, 0.537278295f},
-std::array<float,2>{0.226902559f, 0.423087507f},
-std::array<float,2>{0.864322126f, 0.672596157f},
-std::array<float,2>{0.589226842f, 0.233625844f},
-std::array<float,2>{0.315762699f, 0.948467195f},
-std::array<float,2>{0.436515599f, 0.0438279882f},
-std::array<float,2>{0.670988023f, 0.862507701f},
-std::array<float,2>{0.995767236f, 0.250809729f},
-std::array<float,2>{0.0970679894f, 0.575029135f},
-std::array<float,2>{0.307052881f, 0.32040602f},
-std::array<float,2>{0.531022131f, 0.520155251f},
-std::array<float,2>{0.760766864f, 0.0693434998f},
-std::array<float,2>{0.166570574f, 0.757533133f},
-std::array<float,2>{0.0301975794f, 0.178091913f},
-std::array<float,2>{0.922637463f, 0.913351476f},
-std::array<float,2>{0.743632138f, 0.483994573f},
-std::array<float,2>{0.457818508f, 0.700579345f},
-std::array<float,2>{0.0435014106f, 0.401383102f},
-std::array<float,2>{0.876049101f, 0.642224669f},
-std::array<float,2>{0.705300212f, 0.212391913f},
-std::array<float,2>{0.480792403f, 0.996737599f},
-std::array<float,2>{0.263434142f, 0.0269337036f},
-std::array<float,2>{0.546352446f, 0.827949345f},
-std::array<float,2>{0.806243837f, 0.308165371f},
-std::array<float,2>{0.146187529f, 0.622418463f},
-std::array<float,2>{0.39768362f, 0.348237842f},
-std::array<float,2>{0.63384968f, 0.547836185f},
-std::array<float,2>{0.955237687f, 0.100565128f},
-std::array<float,2>{0.0721374974f, 0.787140846f},
-std::array<float,2>{0.212985605f, 0.156048402f},
-std::array<float,2>{0.843710184f, 0.879314363f},
-std::array<float,2>{0.612828791f, 0.438633591f},
-std::array<float,2>{0.352844238f, 0.741544783f},
-std::array<float,2>{0.157351717f, 0.269619107f},
-std::array<float,2>{0.755280435f, 0.587781489f},
-std::array<float,2>{0.517051816f, 0.0594869144f},
-std::array<float,2>{0.300713599f, 0.845187783f},
-std::array<float,2>{0.462319791f, 0.234488443f},
-std::array<float,2>{0.738736272f, 0.95743227f},
-std::array<float,2>{0.935791135f, 0.417775571f},
-std::array<float,2>{0.0211882424f, 0.66257441f},
-std::array<float,2>{0.327952564f, 0.490898907f},
-std::array<float,2>{0.582428753f, 0.713650107f},
-std::array<float,2>{0.870875895f, 0.156848282f},
-std::array<float,2>{0.222690389f, 0.932937562f},
-std::array<float,2>{0.101803899f, 0.0931269601f},
-std::array<float,2>{0.98507607f, 0.76946497f},
-std::array<float,2>{0.656940937f, 0.335045695f},
-std::array<float,2>{0.425366074f, 0.502636671f},
-std::array<float,2>{0.0914296433f, 0.324940532f},
-std::array<float,2>{0.942540944f, 0.519058943f},
-std::array<float,2>{0.650662243f, 0.063679941f},
-std::array<float,2>{0.375208169f, 0.752821267f},
-std::array<float,2>{0.365003943f, 0.173183829f},
-std::array<float,2>{0.596774399f, 0.909676492f},
-std::array<float,2>{0.820728004f, 0.478158653f},
-std::array<float,2>{0.190944746f, 0.69851017f},
-std::array<float,2>{0.49154076f, 0.426457733f},
-std::array<float,2>{0.697741866f, 0.679366231f},
-std::array<float,2>{0.903584957f, 0.228380382f},
-std::array<float,2>{0.0622130856f, 0.952635646f},
-std::array<float,2>{0.138008416f, 0.0395817906f},
-std::array<float,2>{0.790244877f, 0.866985798f},
-std::array<float,2>{0.549995482f, 0.255548686f},
-std::array<float,2>{0.276520342f, 0.574018836f},
-std::array<float,2>{0.249287486f, 0.457845151f},
-std::array<float,2>{0.853211641f, 0.730764508f},
-std::array<float,2>{0.571151078f, 0.136724815f},
-std::array<float,2>{0.343058705f, 0.898078978f},
-std::array<float,2>{0.410289824f, 0.121134534f},
-std::array<float,2>{0.687169433f, 0.809681058f},
-std::array<float,2>{0.975899637f, 0.370478302f},
-std::array<float,2>{0.118002445f, 0.534739554f},
-std::array<float,2>{0.285942376f, 0.294786394f},
-std::array<float,2>{0.503003776f, 0.597517371f},
-std::array<float,2>{0.780280828f, 0.0143366093f},
-std::array<float,2>{0.181715637f, 0.836656213f},
-std::array<float,2>{0.00468554208f, 0.191746756f},
-std::array<float,2>{0.916587114f, 0.971528471f},
-std::array<float,2>{0.732031345f, 0.378467739f},
-std::array<float,2>{0.451639771f, 0.638816297f},
-std::array<float,2>{0.110573374f, 0.473744214f},
-std::array<float,2>{0.978180766f, 0.692698956f},
-std::array<float,2>{0.677279294f, 0.184246272f},
-std::array<float,2>{0.421501547f, 0.919283032f},
-std::array<float,2>{0.335354179f, 0.0756451413f},
-std::array<float,2>{0.565221727f, 0.758409083f},
-std::array<float,2>{0.846684694f, 0.319087774f},
-std::array<float,2>{0.236873925f, 0.526728868f},
-std::array<float,2>{0.442961812f, 0.261162102f},
-std::array<float,2>{0.722703099f, 0.569922149f},
-std::array<float,2>{0.913331568f, 0.0387093052f},
-std::array<float,2>{0.00858650915f, 0.871260464f},
-std::array<float,2>{0.173030257f, 0.225073203f},
-std::array<float,2>{0.769517183f, 0.940065801f},
-std::array<float,2>{0.508275807f, 0.436414212f},
-std::array<float,2>{0.291351885f, 0.685455561f},
-std::array<float,2>{0.197125971f, 0.360588282f},
-std::array<float,2>{0.816351831f, 0.54564935f},
-std::array<float,2>{0.606908441f, 0.113815323f},
-std::array<float,2>{0.374151409f, 0.797551036f},
-std::array<float,2>{0.382882982f, 0.130501017f},
-std::array<float,2>{0.647356153f, 0.904760122f},
-std::array<float,2>{0.950006068f, 0.461886913f},
-std::array<float,2>{0.0803714544f, 0.726301134f},
-std::array<float,2>{0.268769532f, 0.390061945f},
-std::array<float,2>{0.561404347f, 0.626149952f},
-std::array<float,2>{0.788791895f, 0.1993604f},
-std::array<float,2>{0.127897233f, 0.980168104f},
-std::array<float,2>{0.0536987185f, 0.0042058574f},
-std::array<float,2>{0.896393299f, 0.835897803f},
-std::array<float,2>{0.692441523f, 0.282697111f},
-std::array<float,2>{0.495939493f, 0.602653444f},
-std::array<float,2>{0.0272514988f, 0.302871644f},
-std::array<float,2>{0.928938508f, 0.613273382f},
-std::array<float,2>{0.749562085f, 0.0178270712f},
-std::array<float,2>{0.453161806f, 0.8133232f},
-std::array<float,2>{0.311104238f, 0.208536178f},
-std::array<float,2>{0.526105583f, 0.990845025f},
-std::array<float,2>{0.763743699f, 0.395256221f},
-std::array<float,2>{0.168030828f, 0.653454065f},
-std::array<float,2>{0.429731011f, 0.44891575f},
-std::array<float,2>{0.667448223f, 0.746812582f},
-std::array<float,2>{0.999896824f, 0.147339851f},
-std::array<float,2>{0.0979108065f, 0.883114576f},
-std::array<float,2>{0.230918676f, 0.102136329f},
-std::array<float,2>{0.860885561f, 0.794820786f},
-std::array<float,2>{0.593022287f, 0.351803809f},
-std::array<float,2>{0.319228977f, 0.561714232f},
-std::array<float,2>{0.155281007f, 0.407748252f},
-std::array<float,2>{0.797452986f, 0.666821301f},
-std::array<float,2>{0.535068095f, 0.248028606f},
-std::array<float,2>{0.256917268f, 0.967471659f},
-std::array<float,2>{0.471065521f, 0.0529863872f},
-std::array<float,2>{0.712693095f, 0.857161462f},
-std::array<float,2>{0.883535981f, 0.280385613f},
-std::array<float,2>{0.0326448083f, 0.579162598f},
-std::array<float,2>{0.3447088f, 0.337363631f},
-std::array<float,2>{0.62033695f, 0.512063265f},
-std::array<float,2>{0.835582137f, 0.0818842426f},
-std::array<float,2>{0.207399324f, 0.774901211f},
-std::array<float,2>{0.0626547635f, 0.166541308f},
-std::array<float,2>{0.965131462f, 0.923678756f},
-std::array<float,2>{0.627851069f, 0.496111006f},
-std::array<float,2>{0.400546402f, 0.704964638f},
-std::array<float,2>{0.0769180283f, 0.432968467f},
-std::array<float,2>{0.958069086f, 0.681088507f},
-std::array<float,2>{0.639376462f, 0.22154741f},
-std::array<float,2>{0.391822726f, 0.942823887f},
-std::array<float,2>{0.358710259f, 0.0318269134f},
-std::array<float,2>{0.614571273f, 0.867525637f},
-std::array<float,2>{0.83964771f, 0.26321438f},
-std::array<float,2>{0.217337623f, 0.563305855f},
-std::array<float,2>{0.47804597f, 0.315651f},
-std::array<float,2>{0.708318591f, 0.529347241f},
-std::array<float,2>{0.880662858f, 0.0713206753f},
-std::array<float,2>{0.041046083f, 0.761906385f},
-std::array<float,2>{0.141737685f, 0.182833642f},
-std::array<float,2>{0.809042275f, 0.916418731f},
-std::array<float,2>{0.540910244f, 0.472586453f},
-std::array<float,2>{0.258757293f, 0.688870132f},
-std::array<float,2>{0.220018387f, 0.28614971f},
-std::array<float,2>{0.872492433f, 0.60808748f},
-std::array<float,2>{0.58057785f, 0.000705806306f},
-std::array<float,2>{0.320463598f, 0.82894516f},
-std::array<float,2>{0.427280933f, 0.195802659f},
-std::array<float,2>{0.663308322f, 0.98325175f},
-std::array<float,2>{0.988465607f, 0.386274129f},
-std::array<float,2>{0.108116157f, 0.629182875f},
-std::array<float,2>{0.302772135f, 0.465990514f},
-std::array<float,2>{0.522847056f, 0.721844971f},
-std::array<float,2>{0.750183403f, 0.125962883f},
-std::array<float,2>{0.163566351f, 0.899108112f},
-std::array<float,2>{0.0168787483f, 0.110304818f},
-std::array<float,2>{0.931805074f, 0.801395774f},
-std::array<float,2>{0.734698832f, 0.366673052f},
-std::array<float,2>{0.467756778f, 0.541613221f},
-std::array<float,2>{0.0583730601f, 0.357512206f},
-std::array<float,2>{0.900358558f, 0.555959582f},
-std::array<float,2>{0.701555192f, 0.109052993f},
-std::array<float,2>{0.485668808f, 0.792601407f},
-std::array<float,2>{0.278545469f, 0.14166145f},
-std::array<float,2>{0.552817464f, 0.888254642f},
-std::array<float,2>{0.793621421f, 0.451736391f},
-std::array<float,2>{0.134396896f, 0.742440283f},
-std::array<float,2>{0.379033953f, 0.393367141f},
-std::array<float,2>{0.655700684f, 0.649689853f},
-std::array<float,2>{0.937930942f, 0.203928664f},
-std::array<float,2>{0.0887915045f, 0.98535037f},
-std::array<float,2>{0.191516861f, 0.0226251446f},
-std::array<float,2>{0.827945352f, 0.817215979f},
-std::array<float,2>{0.597746313f, 0.297550857f},
-std::array<float,2>{0.362198323f, 0.616080403f},
-std::array<float,2>{0.186531201f, 0.494305074f},
-std::array<float,2>{0.774913549f, 0.707621634f},
-std::array<float,2>{0.505560279f, 0.170910627f},
-std::array<float,2>{0.282010347f, 0.929313064f},
-std::array<float,2>{0.445637345f, 0.0828885287f},
-std::array<float,2>{0.726930201f, 0.779793382f},
-std::array<float,2>{0.920207202f, 0.341027647f},
-std::array<float,2>{0.000433178124f, 0.508333921f},
-std::array<float,2>{0.337817311f, 0.275027543f},
-std::array<float,2>{0.574786127f, 0.582678854f},
-std::array<float,2>{0.857167542f, 0.0485446639f},
-std::array<float,2>{0.243773684f, 0.854917109f},
-std::array<float,2>{0.12429776f, 0.242295712f},
-std::array<float,2>{0.970452785f, 0.962101758f},
-std::array<float,2>{0.68132025f, 0.412196815f},
-std::array<float,2>{0.407947719f, 0.670067787f},
-std::array<float,2>{0.0133132543f, 0.4437792f},
-std::array<float,2>{0.908941031f, 0.73756361f},
-std::array<float,2>{0.719967663f, 0.152062058f},
-std::array<float,2>{0.439364851f, 0.876033366f},
-std::array<float,2>{0.293517321f, 0.0963568091f},
-std::array<float,2>{0.512404799f, 0.783911109f},
-std::array<float,2>{0.770568371f, 0.344381809f},
-std::array<float,2>{0.176535979f, 0.552147269f},
-std::array<float,2>{0.416310102f, 0.31140396f},
-std::array<float,2>{0.67189461f, 0.619016171f},
-std::array<float,2>{0.981887937f, 0.0298980121f},
-std::array<float,2>{0.115134008f, 0.821368396f},
-std::array<float,2>{0.241854504f, 0.216071993f},
-std::array<float,2>{0.85141784f, 0.992248416f},
-std::array<float,2>{0.567291796f, 0.404780447f},
-std::array<float,2>{0.328848213f, 0.645438671f},
-std::array<float,2>{0.130297735f, 0.330317706f},
-std::array<float,2>{0.784985006f, 0.504814029f},
-std::array<float,2>{0.557355464f, 0.088386111f},
-std::array<float,2>{0.272762835f, 0.773388684f},
-std::array<float,2>{0.496612668f, 0.163919821f},
-std::array<float,2>{0.691192985f, 0.933675945f},
-std::array<float,2>{0.894209862f, 0.484994322f},
-std::array<float,2>{0.0504368357f, 0.715741873f},
-std::array<float,2>{0.369752556f, 0.420041233f},
-std::array<float,2>{0.603629231f, 0.65877378f},
-std::array<float,2>{0.81963104f, 0.239485562f},
-std::array<float,2>{0.200899005f, 0.955909789f},
-std::array<float,2>{0.0848998204f, 0.0577020571f},
-std::array<float,2>{0.947559714f, 0.848405182f},
-std::array<float,2>{0.642956972f, 0.268983334f},
-std::array<float,2>{0.389110953f, 0.590439916f},
-std::array<float,2>{0.093960233f, 0.253480285f},
-std::array<float,2>{0.994032741f, 0.578056872f},
-std::array<float,2>{0.669046462f, 0.0457080044f},
-std::array<float,2>{0.43547833f, 0.860530615f},
-std::array<float,2>{0.314389229f, 0.230706349f},
-std::array<float,2>{0.586559653f, 0.946030378f},
-std::array<float,2>{0.865428925f, 0.424445927f},
-std::array<float,2>{0.22868149f, 0.674245596f},
-std::array<float,2>{0.460132003f, 0.482091367f},
-std::array<float,2>{0.745879829f, 0.701216936f},
-std::array<float,2>{0.924923718f, 0.175858364f},
-std::array<float,2>{0.027774835f, 0.911714196f},
-std::array<float,2>{0.165468961f, 0.0677009672f},
-std::array<float,2>{0.757953584f, 0.755215108f},
-std::array<float,2>{0.52901113f, 0.322942197f},
-std::array<float,2>{0.306087494f, 0.523202896f},
-std::array<float,2>{0.204737395f, 0.382672638f},
-std::array<float,2>{0.831234992f, 0.63474828f},
-std::array<float,2>{0.624356091f, 0.191013142f},
-std::array<float,2>{0.348032892f, 0.973503709f},
-std::array<float,2>{0.403387427f, 0.00795717351f},
-std::array<float,2>{0.63179189f, 0.840848029f},
-std::array<float,2>{0.961962283f, 0.292654008f},
-std::array<float,2>{0.0664863661f, 0.598234057f},
-std::array<float,2>{0.251704365f, 0.372823983f},
-std::array<float,2>{0.536403954f, 0.535214305f},
-std::array<float,2>{0.80089128f, 0.120064229f},
-std::array<float,2>{0.151531637f, 0.807513416f},
-std::array<float,2>{0.0383909792f, 0.134198278f},
-std::array<float,2>{0.889440894f, 0.893533766f},
-std::array<float,2>{0.716715395f, 0.453377843f},
-std::array<float,2>{0.473230213f, 0.729345262f},
-std::array<float,2>{0.0608070269f, 0.429262191f},
-std::array<float,2>{0.902428925f, 0.6765306f},
-std::array<float,2>{0.698474288f, 0.22888191f},
-std::array<float,2>{0.49091813f, 0.950508654f},
-std::array<float,2>{0.275842935f, 0.0422083959f},
-std::array<float,2>{0.549391806f, 0.863852084f},
-std::array<float,2>{0.789956748f, 0.257395208f},
-std::array<float,2>{0.137483329f, 0.572220385f},
-std::array<float,2>{0.376383036f, 0.327222615f},
-std::array<float,2>{0.651954591f, 0.517537355f},
-std::array<float,2>{0.941921353f, 0.065303579f},
-std::array<float,2>{0.0901324749f, 0.751813591f},
-std::array<float,2>{0.189878866f, 0.17494598f},
-std::array<float,2>{0.821911156f, 0.908178627f},
-std::array<float,2>{0.596300066f, 0.479527652f},
-std::array<float,2>{0.363749713f, 0.697130442f},
-std::array<float,2>{0.18278344f, 0.296599448f},
-std::array<float,2>{0.780053556f, 0.594283342f},
-std::array<float,2>{0.502692401f, 0.0117845852f},
-std::array<float,2>{0.286426157f, 0.839330554f},
-std::array<float,2>{0.453044951f, 0.194792494f},
-std::array<float,2>{0.731267393f, 0.970248699f},
-std::array<float,2>{0.917643011f, 0.375474423f},
-std::array<float,2>{0.00574334385f, 0.637576461f},
-std::array<float,2>{0.341811538f, 0.460872829f},
-std::array<float,2>{0.572245061f, 0.734181821f},
-std::array<float,2>{0.851661146f, 0.139421329f},
-std::array<float,2>{0.248186603f, 0.895584047f},
-std::array<float,2>{0.118721522f, 0.124707401f},
-std::array<float,2>{0.975071967f, 0.811406255f},
-std::array<float,2>{0.686034739f, 0.36856395f},
-std::array<float,2>{0.411553741f, 0.53243494f},
-std::array<float,2>{0.0708986968f, 0.350474238f},
-std::array<float,2>{0.956175447f, 0.549061179f},
-std::array<float,2>{0.633309484f, 0.0985958651f},
-std::array<float,2>{0.39738825f, 0.786879182f},
-std::array<float,2>{0.351883829f, 0.154282063f},
-std::array<float,2>{0.612223685f, 0.882095635f},
-std::array<float,2>{0.841834903f, 0.43986249f},
-std::array<float,2>{0.214836478f, 0.740010679f},
-std::array<float,2>{0.482418239f, 0.399738431f},
-std::array<float,2>{0.707021713f, 0.643311977f},
-std::array<float,2>{0.87567836f, 0.214152589f},
-std::array<float,2>{0.0448806919f, 0.999812782f},
-std::array<float,2>{0.145169958f, 0.0250654295f},
-std::array<float,2>{0.805510044f, 0.825115979f},
-std::array<float,2>{0.545855284f, 0.306490153f},
-std::array<float,2>{0.261871755f, 0.623408556f},
-std::array<float,2>{0.224042282f, 0.489862651f},
-std::array<float,2>{0.86975956f, 0.711896122f},
-std::array<float,2>{0.58368814f, 0.158845201f},
-std::array<float,2>{0.32684195f, 0.93012917f},
-std::array<float,2>{0.424784064f, 0.091306448f},
-std::array<float,2>{0.657801628f, 0.7656371f},
-std::array<float,2>{0.985595882f, 0.333831817f},
-std::array<float,2>{0.102689929f, 0.500947356f},
-std::array<float,2>{0.29971844f, 0.272056311f},
-std::array<float,2>{0.5158903f, 0.588775337f},
-std::array<float,2>{0.754792511f, 0.0618119165f},
-std::array<float,2>{0.15626514f, 0.84585309f},
-std::array<float,2>{0.0197324082f, 0.23764345f},
-std::array<float,2>{0.936992764f, 0.959619761f},
-std::array<float,2>{0.739340842f, 0.415602118f},
-std::array<float,2>{0.461618513f, 0.661369503f},
-std::array<float,2>{0.0992723554f, 0.446611553f},
-std::array<float,2>{0.998219371f, 0.749673307f},
-std::array<float,2>{0.666642427f, 0.146458864f},
-std::array<float,2>{0.430707991f, 0.885894239f},
-std::array<float,2>{0.319603175f, 0.103676587f},
-std::array<float,2>{0.592213273f, 0.796021342f},
-std::array<float,2>{0.859875262f, 0.354803443f},
-std::array<float,2>{0.232270181f, 0.558750808f},
-std::array<float,2>{0.454123884f, 0.301984817f},
-std::array<float,2>{0.748983741f, 0.611031294f},
-std::array<float,2>{0.928073227f, 0.0173568055f},
-std::array<float,2>{0.0255885683f, 0.81633395f},
-std::array<float,2>{0.169404984f, 0.210928157f},
-std::array<float,2>{0.764971137f, 0.989189267f},
-std::array<float,2>{0.527119458f, 0.398136705f},
-std::array<float,2>{0.312110454f, 0.654547751f},
-std::array<float,2>{0.208871603f, 0.339026302f},
-std::array<float,2>{0.834445417f, 0.514452696f},
-std::array<float,2>{0.619683981f, 0.0797320157f},
-std::array<float,2>{0.345701545f, 0.775905788f},
-std::array<float,2>{0.402060568f, 0.165857449f},
-std::array<float,2>{0.628393471f, 0.924388945f},
-std::array<float,2>{0.96648562f, 0.498844296f},
-std::array<float,2>{0.0635567978f, 0.705367208f},
-std::array<float,2>{0.256622791f, 0.409382522f},
-std::array<float,2>{0.533292413f, 0.664589763f},
-std::array<float,2>{0.798719466f, 0.248786837f},
-std::array<float,2>{0.155168459f, 0.965977609f},
-std::array<float,2>{0.0312508792f, 0.0525900349f},
-std::array<float,2>{0.883823931f, 0.859263361f},
-std::array<float,2>{0.71115911f, 0.278508604f},
-std::array<float,2>{0.472376853f, 0.580899239f},
-std::array<float,2>{0.00948763266f, 0.258004308f},
-std::array<float,2>{0.912655056f, 0.568309247f},
-std::array<float,2>{0.724079907f, 0.036103636f},
-std::array<float,2>{0.441890985f, 0.874966204f},
-std::array<float,2>{0.292666823f, 0.223624051f},
-std::array<float,2>{0.50945431f, 0.938845038f},
-std::array<float,2>{0.767910063f, 0.435157925f},
-std::array<float,2>{0.172846645f, 0.686076701f},
-std::array<float,2>{0.420084417f, 0.476267517f},
-std::array<float,2>{0.676050246f, 0.695012629f},
-std::array<float,2>{0.976587951f, 0.186980084f},
-std::array<float,2>{0.109389171f, 0.920360804f},
-std::array<float,2>{0.238057747f, 0.0764762312f},
-std::array<float,2>{0.846598566f, 0.761247635f},
-std::array<float,2>{0.565486908f, 0.317786276f},
-std::array<float,2>{0.334788829f, 0.52403456f},
-std::array<float,2>{0.128356352f, 0.388249248f},
-std::array<float,2>{0.7877841f, 0.628518581f},
-std::array<float,2>{0.562378049f, 0.202186435f},
-std::array<float,2>{0.268432498f, 0.977331996f},
-std::array<float,2>{0.494773328f, 0.00680094771f},
-std::array<float,2>{0.691556334f, 0.833889544f},
-std::array<float,2>{0.894911766f, 0.28436166f},
-std::array<float,2>{0.0539144911f, 0.604028642f},
-std::array<float,2>{0.373566836f, 0.361611187f},
-std::array<float,2>{0.605606139f, 0.544861376f},
-std::array<float,2>{0.815271318f, 0.117071912f},
-std::array<float,2>{0.195765942f, 0.800758004f},
-std::array<float,2>{0.0814599246f, 0.131184191f},
-std::array<float,2>{0.950966239f, 0.90258497f},
-std::array<float,2>{0.647789717f, 0.464717269f},
-std::array<float,2>{0.384625584f, 0.724338114f},
-std::array<float,2>{0.0896557942f, 0.391940057f},
-std::array<float,2>{0.939391553f, 0.651327312f},
-std::array<float,2>{0.654434621f, 0.206502855f},
-std::array<float,2>{0.380099237f, 0.987909019f},
-std::array<float,2>{0.363253027f, 0.0209975336f},
-std::array<float,2>{0.599441826f, 0.819959998f},
-std::array<float,2>{0.826259136f, 0.299202502f},
-std::array<float,2>{0.192833513f, 0.614844143f},
-std::array<float,2>{0.484506935f, 0.356930405f},
-std::array<float,2>{0.702730596f, 0.55822736f},
-std::array<float,2>{0.898884058f, 0.106534399f},
-std::array<float,2>{0.0572874658f, 0.789957285f},
-std::array<float,2>{0.133452863f, 0.143464416f},
-std::array<float,2>{0.794516623f, 0.889557779f},
-std::array<float,2>{0.55439651f, 0.449751049f},
-std::array<float,2>{0.277839035f, 0.744390607f},
-std::array<float,2>{0.242607534f, 0.276968598f},
-std::array<float,2>{0.85639441f, 0.583999395f},
-std::array<float,2>{0.575583518f, 0.0499669462f},
-std::array<float,2>{0.336571097f, 0.853094637f},
-std::array<float,2>{0.406891704f, 0.245438203f},
-std::array<float,2>{0.680117905f, 0.963999152f},
-std::array<float,2>{0.969027996f, 0.41065383f},
-std::array<float,2>{0.123518616f, 0.66862756f},
-std::array<float,2>{0.282418489f, 0.492360115f},
-std::array<float,2>{0.504783332f, 0.710005164f},
-std::array<float,2>{0.773636103f, 0.16867426f},
-std::array<float,2>{0.186169133f, 0.926916122f},
-std::array<float,2>{0.0015088974f, 0.0852222145f},
-std::array<float,2>{0.920985103f, 0.778587639f},
-std::array<float,2>{0.728504181f, 0.34255138f},
-std::array<float,2>{0.447236061f, 0.51072818f},
-std::array<float,2>{0.0422984809f, 0.313438594f},
-std::array<float,2>{0.879138112f, 0.527796209f},
-std::array<float,2>{0.707553327f, 0.0741557702f},
-std::array<float,2>{0.476758927f, 0.763915837f},
-std::array<float,2>{0.259634167f, 0.179991573f},
-std::array<float,2>{0.539790809f, 0.915166199f},
-std::array<float,2>{0.809782982f, 0.470205694f},
-std::array<float,2>{0.140974298f, 0.689869225f},
-std::array<float,2>{0.390769243f, 0.430926353f},
-std::array<float,2>{0.640472353f, 0.682620466f},
-std::array<float,2>{0.957257867f, 0.220685795f},
-std::array<float,2>{0.077462852f, 0.944507003f},
-std::array<float,2>{0.218288511f, 0.0339592136f},
-std::array<float,2>{0.838041842f, 0.8700369f},
-std::array<float,2>{0.613851249f, 0.264497459f},
-std::array<float,2>{0.357462466f, 0.564958632f},
-std::array<float,2>{0.162677184f, 0.468671858f},
-std::array<float,2>{0.751563847f, 0.71997714f},
-std::array<float,2>{0.522112012f, 0.127131209f},
-std::array<float,2>{0.304270506f, 0.90079999f},
-std::array<float,2>{0.468686759f, 0.111798041f},
-std::array<float,2>{0.736027956f, 0.804566383f},
-std::array<float,2>{0.933510482f, 0.363461375f},
-std::array<float,2>{0.0157718025f, 0.539783657f},
-std::array<float,2>{0.321867585f, 0.287393719f},
-std::array<float,2>{0.582025707f, 0.605718076f},
-std::array<float,2>{0.871829629f, 0.00256411126f},
-std::array<float,2>{0.219513163f, 0.831459463f},
-std::array<float,2>{0.108797386f, 0.198466435f},
-std::array<float,2>{0.990039527f, 0.981569231f},
-std::array<float,2>{0.662198007f, 0.38346687f},
-std::array<float,2>{0.426391512f, 0.631979823f},
-std::array<float,2>{0.0292781331f, 0.48266384f},
-std::array<float,2>{0.923937678f, 0.699936032f},
-std::array<float,2>{0.744790614f, 0.178800806f},
-std::array<float,2>{0.459714025f, 0.912692547f},
-std::array<float,2>{0.304783195f, 0.0684911832f},
-std::array<float,2>{0.527556598f, 0.756430209f},
-std::array<float,2>{0.758869946f, 0.321753561f},
-std::array<float,2>{0.164490417f, 0.520653188f},
-std::array<float,2>{0.434120744f, 0.250987649f},
-std::array<float,2>{0.668493211f, 0.575232685f},
-std::array<float,2>{0.993081987f, 0.044892434f},
-std::array<float,2>{0.0947282091f, 0.861925006f},
-std::array<float,2>{0.229508355f, 0.233267203f},
-std::array<float,2>{0.866567194f, 0.947527051f},
-std::array<float,2>{0.587526143f, 0.422127545f},
-std::array<float,2>{0.313304484f, 0.673267722f},
-std::array<float,2>{0.150483713f, 0.373610944f},
-std::array<float,2>{0.80234319f, 0.538633347f},
-std::array<float,2>{0.53541851f, 0.117694944f},
-std::array<float,2>{0.25096181f, 0.80527842f},
-std::array<float,2>{0.473846316f, 0.134821072f},
-std::array<float,2>{0.715515196f, 0.892569423f},
-std::array<float,2>{0.889888883f, 0.45693326f},
-std::array<float,2>{0.0372820236f, 0.728310525f},
-std::array<float,2>{0.348668724f, 0.380597204f},
-std::array<float,2>{0.623230398f, 0.635550559f},
-std::array<float,2>{0.830670416f, 0.187537476f},
-std::array<float,2>{0.20378609f, 0.975647748f},
-std::array<float,2>{0.0676496625f, 0.0099176513f},
-std::array<float,2>{0.961591661f, 0.84315455f},
-std::array<float,2>{0.632499039f, 0.290244579f},
-std::array<float,2>{0.40258655f, 0.599804342f},
-std::array<float,2>{0.113719784f, 0.309115738f},
-std::array<float,2>{0.981101334f, 0.620168507f},
-std::array<float,2>{0.673416793f, 0.0277495347f},
-std::array<float,2>{0.417542249f, 0.822947621f},
-std::array<float,2>{0.329648256f, 0.21736972f},
-std::array<float,2>{0.567768991f, 0.995030522f},
-std::array<float,2>{0.850095928f, 0.402543068f},
-std::array<float,2>{0.240962401f, 0.647910178f},
-std::array<float,2>{0.437528849f, 0.441519737f},
-std::array<float,2>{0.719701707f, 0.736102045f},
-std::array<float,2>{0.909278512f, 0.148622632f},
-std::array<float,2>{0.0126662422f, 0.877888441f},
-std::array<float,2>{0.176955134f, 0.0947560892f},
-std::array<float,2>{0.770183921f, 0.782813668f},
-std::array<float,2>{0.512859166f, 0.346856773f},
-std::array<float,2>{0.294595033f, 0.553634644f},
-std::array<float,2>{0.199900106f, 0.41865477f},
-std::array<float,2>{0.819274724f, 0.657996118f},
-std::array<float,2>{0.604608297f, 0.240483716f},
-std::array<float,2>{0.371027827f, 0.954800785f},
-std::array<float,2>{0.390489429f, 0.0555930734f},
-std::array<float,2>{0.643979013f, 0.851186216f},
-std::array<float,2>{0.948432982f, 0.266443223f},
-std::array<float,2>{0.0854312852f, 0.592315733f},
-std::array<float,2>{0.271988571f, 0.329461128f},
-std::array<float,2>{0.557703674f, 0.506510139f},
-std::array<float,2>{0.783422649f, 0.0862068906f},
-std::array<float,2>{0.129257247f, 0.769810438f},
-std::array<float,2>{0.0495264903f, 0.161856622f},
-std::array<float,2>{0.893522859f, 0.937343776f},
-std::array<float,2>{0.690278769f, 0.486842096f},
-std::array<float,2>{0.49773258f, 0.718140244f},
-std::array<float,2>{0.00626898371f, 0.377725542f},
-std::array<float,2>{0.915517688f, 0.640240967f},
-std::array<float,2>{0.732513368f, 0.193045288f},
-std::array<float,2>{0.449742705f, 0.971791983f},
-std::array<float,2>{0.287923843f, 0.0152759328f},
-std::array<float,2>{0.501866579f, 0.837696373f},
-std::array<float,2>{0.778286159f, 0.293156892f},
-std::array<float,2>{0.181136459f, 0.596435189f},
-std::array<float,2>{0.41362524f, 0.369572639f},
-std::array<float,2>{0.683683515f, 0.533984184f},
-std::array<float,2>{0.973954916f, 0.122503676f},
-std::array<float,2>{0.120036863f, 0.808794677f},
-std::array<float,2>{0.247376993f, 0.138119832f},
-std::array<float,2>{0.854334116f, 0.896560848f},
-std::array<float,2>{0.573887646f, 0.458937168f},
-std::array<float,2>{0.340742469f, 0.732102931f},
-std::array<float,2>{0.14034459f, 0.254273057f},
-std::array<float,2>{0.792125821f, 0.573147178f},
-std::array<float,2>{0.547353625f, 0.0403878763f},
-std::array<float,2>{0.274250805f, 0.865476191f},
-std::array<float,2>{0.488320291f, 0.226734415f},
-std::array<float,2>{0.695965409f, 0.951631427f},
-std::array<float,2>{0.905994773f, 0.427344143f},
-std::array<float,2>{0.0587019771f, 0.677747309f},
-std::array<float,2>{0.365648925f, 0.477003336f},
-std::array<float,2>{0.593934894f, 0.69814527f},
-std::array<float,2>{0.823097825f, 0.172446758f},
-std::array<float,2>{0.188202649f, 0.908283174f},
-std::array<float,2>{0.0933121517f, 0.0630195439f},
-std::array<float,2>{0.944793344f, 0.753155351f},
-std::array<float,2>{0.649850547f, 0.32582292f},
-std::array<float,2>{0.37773928f, 0.518232882f},
-std::array<float,2>{0.103850164f, 0.334748894f},
-std::array<float,2>{0.986690283f, 0.503440619f},
-std::array<float,2>{0.659526885f, 0.0925113484f},
-std::array<float,2>{0.423383981f, 0.76781553f},
-std::array<float,2>{0.324843228f, 0.157896265f},
-std::array<float,2>{0.584235489f, 0.931839406f},
-std::array<float,2>{0.867833793f, 0.491314799f},
-std::array<float,2>{0.22477673f, 0.714320719f},
-std::array<float,2>{0.464726239f, 0.416217387f},
-std::array<float,2>{0.741424978f, 0.663993418f},
-std::array<float,2>{0.934442699f, 0.236131698f},
-std::array<float,2>{0.0232346747f, 0.958677351f},
-std::array<float,2>{0.158656344f, 0.0600617304f},
-std::array<float,2>{0.757188857f, 0.843811989f},
-std::array<float,2>{0.517912447f, 0.271337301f},
-std::array<float,2>{0.298049629f, 0.586722076f},
-std::array<float,2>{0.212231115f, 0.438421488f},
-std::array<float,2>{0.841504276f, 0.740803301f},
-std::array<float,2>{0.610090971f, 0.155050099f},
-std::array<float,2>{0.354442179f, 0.880685687f},
-std::array<float,2>{0.394784391f, 0.101510145f},
-std::array<float,2>{0.634816825f, 0.788656175f},
-std::array<float,2>{0.953481376f, 0.348995328f},
-std::array<float,2>{0.0728782192f, 0.547947347f},
-std::array<float,2>{0.265232712f, 0.306985289f},
-std::array<float,2>{0.544569552f, 0.621643901f},
-std::array<float,2>{0.807079673f, 0.025572842f},
-std::array<float,2>{0.147654086f, 0.827008963f},
-std::array<float,2>{0.0466677733f, 0.211119533f},
-std::array<float,2>{0.87763083f, 0.997283876f},
-std::array<float,2>{0.703249395f, 0.400961101f},
-std::array<float,2>{0.484179437f, 0.640743434f},
-std::array<float,2>{0.0652716681f, 0.49744755f},
-std::array<float,2>{0.967045844f, 0.70313561f},
-std::array<float,2>{0.626098037f, 0.167231679f},
-std::array<float,2>{0.398622513f, 0.922358453f},
-std::array<float,2>{0.346135736f, 0.0808028057f},
-std::array<float,2>{0.617647767f, 0.77351737f},
-std::array<float,2>{0.833568811f, 0.336332053f},
-std::array<float,2>{0.209602132f, 0.51344651f},
-std::array<float,2>{0.469375581f, 0.279668063f},
-std::array<float,2>{0.714828968f, 0.578445017f},
-std::array<float,2>{0.886107206f, 0.0538028181f},
-std::array<float,2>{0.0350292511f, 0.856327534f},
-std::array<float,2>{0.154002115f, 0.246999621f},
-std::array<float,2>{0.799392402f, 0.968451262f},
-std::array<float,2>{0.532150269f, 0.406431735f},
-std::array<float,2>{0.255593926f, 0.667176247f},
-std::array<float,2>{0.233602777f, 0.352813661f},
-std::array<float,2>{0.863233984f, 0.561208189f},
-std::array<float,2>{0.591502011f, 0.103324361f},
-std::array<float,2>{0.317123473f, 0.79381752f},
-std::array<float,2>{0.431779146f, 0.148033947f},
-std::array<float,2>{0.665287912f, 0.884067595f},
-std::array<float,2>{0.996930182f, 0.447653711f},
-std::array<float,2>{0.100124165f, 0.747580051f},
-std::array<float,2>{0.309761167f, 0.395752966f},
-std::array<float,2>{0.524949789f, 0.653155982f},
-std::array<float,2>{0.763237894f, 0.207821727f},
-std::array<float,2>{0.170133784f, 0.99162966f},
-std::array<float,2>{0.0238486528f, 0.0186487958f},
-std::array<float,2>{0.927594602f, 0.813966572f},
-std::array<float,2>{0.746984661f, 0.303795725f},
-std::array<float,2>{0.45685786f, 0.611944497f},
-std::array<float,2>{0.0513909459f, 0.281848341f},
-std::array<float,2>{0.896777391f, 0.602288783f},
-std::array<float,2>{0.693951428f, 0.00551948277f},
-std::array<float,2>{0.492479116f, 0.83490783f},
-std::array<float,2>{0.267084122f, 0.200884834f},
-std::array<float,2>{0.559457719f, 0.978737891f},
-std::array<float,2>{0.786644459f, 0.388795227f},
-std::array<float,2>{0.125982374f, 0.625084937f},
-std::array<float,2>{0.385159612f, 0.462853938f},
-std::array<float,2>{0.645700872f, 0.725326896f},
-std::array<float,2>{0.952830672f, 0.129375443f},
-std::array<float,2>{0.0794268325f, 0.905765951f},
-std::array<float,2>{0.197377786f, 0.114415504f},
-std::array<float,2>{0.813954115f, 0.798785985f},
-std::array<float,2>{0.60911864f, 0.359878987f},
-std::array<float,2>{0.371186763f, 0.545958281f},
-std::array<float,2>{0.175453573f, 0.436822504f},
-std::array<float,2>{0.766112566f, 0.684273899f},
-std::array<float,2>{0.509920597f, 0.226210102f},
-std::array<float,2>{0.289430857f, 0.940907359f},
-std::array<float,2>{0.443417549f, 0.0371794738f},
-std::array<float,2>{0.725883603f, 0.872337937f},
-std::array<float,2>{0.91177702f, 0.260202616f},
-std::array<float,2>{0.0100755226f, 0.568674028f},
-std::array<float,2>{0.332562476f, 0.319713593f},
-std::array<float,2>{0.56401509f, 0.525727689f},
-std::array<float,2>{0.84551549f, 0.074443303f},
-std::array<float,2>{0.236163005f, 0.758796871f},
-std::array<float,2>{0.112448826f, 0.185029507f},
-std::array<float,2>{0.98038584f, 0.918271959f},
-std::array<float,2>{0.678337276f, 0.472681791f},
-std::array<float,2>{0.41945532f, 0.691582143f},
-std::array<float,2>{0.12255346f, 0.413774878f},
-std::array<float,2>{0.972652137f, 0.671771348f},
-std::array<float,2>{0.682239532f, 0.243840799f},
-std::array<float,2>{0.408750981f, 0.961657882f},
-std::array<float,2>{0.339359105f, 0.0471951589f},
-std::array<float,2>{0.576789737f, 0.853731334f},
-std::array<float,2>{0.858407021f, 0.274369478f},
-std::array<float,2>{0.244769797f, 0.583142459f},
-std::array<float,2>{0.448782444f, 0.340405226f},
-std::array<float,2>{0.728568435f, 0.508881807f},
-std::array<float,2>{0.91841197f, 0.0834955722f},
-std::array<float,2>{0.00361311669f, 0.780702233f},
-std::array<float,2>{0.185028285f, 0.170027941f},
-std::array<float,2>{0.776675045f, 0.9279145f},
-std::array<float,2>{0.506382585f, 0.495796055f},
-std::array<float,2>{0.283304811f, 0.708355367f},
-std::array<float,2>{0.194121987f, 0.298311293f},
-std::array<float,2>{0.825878084f, 0.616384029f},
-std::array<float,2>{0.600400448f, 0.0215581264f},
-std::array<float,2>{0.359548509f, 0.817551315f},
-std::array<float,2>{0.382033557f, 0.204299271f},
-std::array<float,2>{0.653695822f, 0.985961854f},
-std::array<float,2>{0.94095844f, 0.394159645f},
-std::array<float,2>{0.0859427378f, 0.648562968f},
-std::array<float,2>{0.279955566f, 0.452415675f},
-std::array<float,2>{0.551643372f, 0.743787408f},
-std::array<float,2>{0.795811117f, 0.140969217f},
-std::array<float,2>{0.136110455f, 0.887110233f},
-std::array<float,2>{0.054798983f, 0.108221903f},
-std::array<float,2>{0.902284205f, 0.791168094f},
-std::array<float,2>{0.700722992f, 0.359129548f},
-std::array<float,2>{0.487562537f, 0.555260837f},
-std::array<float,2>{0.0179707035f, 0.366181374f},
-std::array<float,2>{0.93056637f, 0.542231202f},
-std::array<float,2>{0.736702681f, 0.111043729f},
-std::array<float,2>{0.464965105f, 0.802295744f},
-std::array<float,2>{0.301299065f, 0.126227155f},
-std::array<float,2>{0.519971192f, 0.899983287f},
-std::array<float,2>{0.752322197f, 0.46546337f},
-std::array<float,2>{0.161816388f, 0.721652925f},
-std::array<float,2>{0.428149819f, 0.384961158f},
-std::array<float,2>{0.660861969f, 0.630395591f},
-std::array<float,2>{0.991137981f, 0.196739599f},
-std::array<float,2>{0.106107861f, 0.983826399f},
-std::array<float,2>{0.221648172f, 0.00192935136f},
-std::array<float,2>{0.874399722f, 0.829509437f},
-std::array<float,2>{0.578159988f, 0.285619915f},
-std::array<float,2>{0.323404759f, 0.609090447f},
-std::array<float,2>{0.143685058f, 0.471464217f},
-std::array<float,2>{0.810813963f, 0.688375354f},
-std::array<float,2>{0.541989684f, 0.182070524f},
-std::array<float,2>{0.261616498f, 0.917870879f},
-std::array<float,2>{0.480389595f, 0.0705762729f},
-std::array<float,2>{0.71057421f, 0.763311923f},
-std::array<float,2>{0.882064819f, 0.315280318f},
-std::array<float,2>{0.0390625559f, 0.531209171f},
-std::array<float,2>{0.355912417f, 0.262501419f},
-std::array<float,2>{0.61644733f, 0.563601971f},
-std::array<float,2>{0.836753249f, 0.0325499102f},
-std::array<float,2>{0.215670601f, 0.868244648f},
-std::array<float,2>{0.0743795261f, 0.221972823f},
-std::array<float,2>{0.960803807f, 0.942335427f},
-std::array<float,2>{0.63689369f, 0.432485461f},
-std::array<float,2>{0.394277483f, 0.680063784f},
-std::array<float,2>{0.0354680195f, 0.454357654f},
-std::array<float,2>{0.8879776f, 0.730289817f},
-std::array<float,2>{0.717256069f, 0.133177087f},
-std::array<float,2>{0.475400627f, 0.894375086f},
-std::array<float,2>{0.2520459f, 0.120407782f},
-std::array<float,2>{0.538932085f, 0.807721674f},
-std::array<float,2>{0.802868307f, 0.371756166f},
-std::array<float,2>{0.149923459f, 0.536267459f},
-std::array<float,2>{0.405277699f, 0.291341037f},
-std::array<float,2>{0.630073607f, 0.599490464f},
-std::array<float,2>{0.963028312f, 0.00938574132f},
-std::array<float,2>{0.0698280409f, 0.840696692f},
-std::array<float,2>{0.205283478f, 0.190156206f},
-std::array<float,2>{0.829991996f, 0.974556923f},
-std::array<float,2>{0.622802675f, 0.38113445f},
-std::array<float,2>{0.3508901f, 0.633485079f},
-std::array<float,2>{0.167382643f, 0.323818326f},
-std::array<float,2>{0.759922445f, 0.521758378f},
-std::array<float,2>{0.53014648f, 0.0665106699f},
-std::array<float,2>{0.308116436f, 0.753989875f},
-std::array<float,2>{0.458948791f, 0.177219674f},
-std::array<float,2>{0.74238652f, 0.910157382f},
-std::array<float,2>{0.923001468f, 0.481345147f},
-std::array<float,2>{0.0304516517f, 0.702983379f},
-std::array<float,2>{0.315038919f, 0.424896836f},
-std::array<float,2>{0.588623226f, 0.675609112f},
-std::array<float,2>{0.864220202f, 0.231489554f},
-std::array<float,2>{0.22843197f, 0.946993947f},
-std::array<float,2>{0.0964756981f, 0.0461976826f},
-std::array<float,2>{0.995066166f, 0.859808385f},
-std::array<float,2>{0.67062676f, 0.252298862f},
-std::array<float,2>{0.43697238f, 0.576749802f},
-std::array<float,2>{0.0825658515f, 0.267813325f},
-std::array<float,2>{0.947067738f, 0.590977609f},
-std::array<float,2>{0.641483366f, 0.0566740334f},
-std::array<float,2>{0.388662994f, 0.849242628f},
-std::array<float,2>{0.367390096f, 0.238713354f},
-std::array<float,2>{0.602688134f, 0.956183195f},
-std::array<float,2>{0.817045569f, 0.420925438f},
-std::array<float,2>{0.201989427f, 0.659365952f},
-std::array<float,2>{0.498821497f, 0.485414863f},
-std::array<float,2>{0.689295709f, 0.716256499f},
-std::array<float,2>{0.892251909f, 0.162513047f},
-std::array<float,2>{0.0472484864f, 0.935292721f},
-std::array<float,2>{0.13255322f, 0.0894289538f},
-std::array<float,2>{0.782707274f, 0.7720052f},
-std::array<float,2>{0.555424452f, 0.33143267f},
-std::array<float,2>{0.269942641f, 0.505810857f},
-std::array<float,2>{0.238817081f, 0.406026959f},
-std::array<float,2>{0.849365294f, 0.646268845f},
-std::array<float,2>{0.568797588f, 0.215677008f},
-std::array<float,2>{0.331056565f, 0.993644238f},
-std::array<float,2>{0.414730042f, 0.0307695419f},
-std::array<float,2>{0.674998283f, 0.820691288f},
-std::array<float,2>{0.982897878f, 0.311684608f},
-std::array<float,2>{0.115827709f, 0.617700338f},
-std::array<float,2>{0.295117855f, 0.345180422f},
-std::array<float,2>{0.514793277f, 0.551628172f},
-std::array<float,2>{0.771620393f, 0.097026065f},
-std::array<float,2>{0.17846635f, 0.785009921f},
-std::array<float,2>{0.0144646578f, 0.150465861f},
-std::array<float,2>{0.907826781f, 0.875733972f},
-std::array<float,2>{0.722323954f, 0.44450444f},
-std::array<float,2>{0.440282166f, 0.736772537f},
-std::array<float,2>{0.0104712732f, 0.434643507f},
-std::array<float,2>{0.911563993f, 0.68562901f},
-std::array<float,2>{0.726451218f, 0.22275807f},
-std::array<float,2>{0.443941563f, 0.939073563f},
-std::array<float,2>{0.289764076f, 0.0354711525f},
-std::array<float,2>{0.510265946f, 0.874201596f},
-std::array<float,2>{0.766131759f, 0.25830847f},
-std::array<float,2>{0.17511262f, 0.567848086f},
-std::array<float,2>{0.419112384f, 0.318221986f},
-std::array<float,2>{0.678158939f, 0.52368176f},
-std::array<float,2>{0.979809821f, 0.0769655928f},
-std::array<float,2>{0.113247804f, 0.7609936f},
-std::array<float,2>{0.235637143f, 0.187488675f},
-std::array<float,2>{0.844758332f, 0.920869052f},
-std::array<float,2>{0.56364727f, 0.47578451f},
-std::array<float,2>{0.332319409f, 0.69481951f},
-std::array<float,2>{0.126744166f, 0.284720153f},
-std::array<float,2>{0.786197901f, 0.603587985f},
-std::array<float,2>{0.558722496f, 0.00627701869f},
-std::array<float,2>{0.267550737f, 0.833297849f},
-std::array<float,2>{0.492739379f, 0.202773198f},
-std::array<float,2>{0.69363004f, 0.977040648f},
-std::array<float,2>{0.897225618f, 0.387782156f},
-std::array<float,2>{0.0511118323f, 0.628405333f},
-std::array<float,2>{0.371677458f, 0.463889599f},
-std::array<float,2>{0.608750522f, 0.72373271f},
-std::array<float,2>{0.814178467f, 0.131546944f},
-std::array<float,2>{0.198177457f, 0.903209686f},
-std::array<float,2>{0.0797052011f, 0.11625468f},
-std::array<float,2>{0.952410996f, 0.799987495f},
-std::array<float,2>{0.646374166f, 0.362161428f},
-std::array<float,2>{0.385451853f, 0.543974519f},
-std::array<float,2>{0.0997534841f, 0.355102539f},
-std::array<float,2>{0.996228218f, 0.559426725f},
-std::array<float,2>{0.665701509f, 0.104400925f},
-std::array<float,2>{0.432399631f, 0.79658556f},
-std::array<float,2>{0.316602558f, 0.145961106f},
-std::array<float,2>{0.591301084f, 0.886535287f},
-std::array<float,2>{0.862596393f, 0.447230667f},
-std::array<float,2>{0.234036431f, 0.74927628f},
-std::array<float,2>{0.456226647f, 0.39782232f},
-std::array<float,2>{0.746105254f, 0.655213654f},
-std::array<float,2>{0.926939726f, 0.210218132f},
-std::array<float,2>{0.02435649f, 0.988456488f},
-std::array<float,2>{0.170778409f, 0.0166336372f},
-std::array<float,2>{0.762964964f, 0.815555513f},
-std::array<float,2>{0.524636447f, 0.302324921f},
-std::array<float,2>{0.310351044f, 0.610487103f},
-std::array<float,2>{0.209449083f, 0.498199105f},
-std::array<float,2>{0.833350301f, 0.705839336f},
-std::array<float,2>{0.618035197f, 0.165050253f},
-std::array<float,2>{0.346388221f, 0.924027324f},
-std::array<float,2>{0.399199337f, 0.0793628469f},
-std::array<float,2>{0.626556277f, 0.775870383f},
-std::array<float,2>{0.967413783f, 0.339729339f},
-std::array<float,2>{0.0648432896f, 0.513810635f},
-std::array<float,2>{0.254884481f, 0.279264152f},
-std::array<float,2>{0.531359196f, 0.580483556f},
-std::array<float,2>{0.799029171f, 0.0521013737f},
-std::array<float,2>{0.153356209f, 0.858684063f},
-std::array<float,2>{0.0342451558f, 0.248521f},
-std::array<float,2>{0.886682212f, 0.966432512f},
-std::array<float,2>{0.714186072f, 0.410108328f},
-std::array<float,2>{0.468841314f, 0.664324105f},
-std::array<float,2>{0.0726354569f, 0.44017452f},
-std::array<float,2>{0.953824162f, 0.739286721f},
-std::array<float,2>{0.635428846f, 0.153527603f},
-std::array<float,2>{0.395149797f, 0.882586122f},
-std::array<float,2>{0.353811145f, 0.0979840457f},
-std::array<float,2>{0.609724283f, 0.786598802f},
-std::array<float,2>{0.841248155f, 0.349895746f},
-std::array<float,2>{0.212508976f, 0.549697161f},
-std::array<float,2>{0.48349148f, 0.30573535f},
-std::array<float,2>{0.703670382f, 0.623675287f},
-std::array<float,2>{0.877352953f, 0.0244210623f},
-std::array<float,2>{0.0462532975f, 0.824295759f},
-std::array<float,2>{0.148006529f, 0.214500695f},
-std::array<float,2>{0.807356477f, 0.99925977f},
-std::array<float,2>{0.544177532f, 0.400165856f},
-std::array<float,2>{0.265016884f, 0.642659426f},
-std::array<float,2>{0.225569159f, 0.333195746f},
-std::array<float,2>{0.86719358f, 0.500081301f},
-std::array<float,2>{0.584920645f, 0.091477789f},
-std::array<float,2>{0.324518561f, 0.766199291f},
-std::array<float,2>{0.42318812f, 0.158208385f},
-std::array<float,2>{0.659855247f, 0.930554748f},
-std::array<float,2>{0.987113953f, 0.489411116f},
-std::array<float,2>{0.104476474f, 0.711037934f},
-std::array<float,2>{0.298710853f, 0.415190876f},
-std::array<float,2>{0.518442571f, 0.662048876f},
-std::array<float,2>{0.757775664f, 0.238274008f},
-std::array<float,2>{0.158733502f, 0.959445298f},
-std::array<float,2>{0.0229461361f, 0.0622741729f},
-std::array<float,2>{0.933818042f, 0.846297443f},
-std::array<float,2>{0.74209547f, 0.271934032f},
-std::array<float,2>{0.464208394f, 0.588003814f},
-std::array<float,2>{0.059221141f, 0.256880224f},
-std::array<float,2>{0.905332923f, 0.571342587f},
-std::array<float,2>{0.69544214f, 0.0427075662f},
-std::array<float,2>{0.488874704f, 0.863560081f},
-std::array<float,2>{0.273616433f, 0.229236796f},
-std::array<float,2>{0.54771322f, 0.950850785f},
-std::array<float,2>{0.79258728f, 0.429099828f},
-std::array<float,2>{0.139653131f, 0.676184297f},
-std::array<float,2>{0.377031446f, 0.480197936f},
-std::array<float,2>{0.650148809f, 0.696769059f},
-std::array<float,2>{0.944906533f, 0.175387919f},
-std::array<float,2>{0.0929769725f, 0.907659113f},
-std::array<float,2>{0.187886119f, 0.0648902431f},
-std::array<float,2>{0.822442234f, 0.751397133f},
-std::array<float,2>{0.594667435f, 0.327699929f},
-std::array<float,2>{0.365941226f, 0.516965568f},
-std::array<float,2>{0.181470841f, 0.375560641f},
-std::array<float,2>{0.777364492f, 0.637127101f},
-std::array<float,2>{0.501260579f, 0.194927439f},
-std::array<float,2>{0.287392706f, 0.969960868f},
-std::array<float,2>{0.449677467f, 0.0125110447f},
-std::array<float,2>{0.733279824f, 0.839366436f},
-std::array<float,2>{0.915666759f, 0.295899987f},
-std::array<float,2>{0.00654028449f, 0.593877375f},
-std::array<float,2>{0.340300322f, 0.368783563f},
-std::array<float,2>{0.57351774f, 0.532783091f},
-std::array<float,2>{0.853996277f, 0.124343663f},
-std::array<float,2>{0.247966766f, 0.81065923f},
-std::array<float,2>{0.119265139f, 0.138847426f},
-std::array<float,2>{0.974408865f, 0.896373212f},
-std::array<float,2>{0.684212089f, 0.460325152f},
-std::array<float,2>{0.413532764f, 0.733560383f},
-std::array<float,2>{0.115551904f, 0.403311133f},
-std::array<float,2>{0.983284473f, 0.648281395f},
-std::array<float,2>{0.675341368f, 0.217050463f},
-std::array<float,2>{0.414418489f, 0.994538844f},
-std::array<float,2>{0.331571907f, 0.0279859696f},
-std::array<float,2>{0.569190085f, 0.822344303f},
-std::array<float,2>{0.848939061f, 0.308776587f},
-std::array<float,2>{0.238677815f, 0.621091068f},
-std::array<float,2>{0.439726532f, 0.347624004f},
-std::array<float,2>{0.722092986f, 0.553176999f},
-std::array<float,2>{0.907293618f, 0.0952331051f},
-std::array<float,2>{0.0140951173f, 0.782672465f},
-std::array<float,2>{0.178173959f, 0.148930147f},
-std::array<float,2>{0.77229172f, 0.877243638f},
-std::array<float,2>{0.515177488f, 0.442060024f},
-std::array<float,2>{0.295505404f, 0.735584795f},
-std::array<float,2>{0.201199248f, 0.265999526f},
-std::array<float,2>{0.816860139f, 0.592169821f},
-std::array<float,2>{0.603513002f, 0.0547280088f},
-std::array<float,2>{0.368131369f, 0.850589752f},
-std::array<float,2>{0.387886584f, 0.240777194f},
-std::array<float,2>{0.64089632f, 0.954385161f},
-std::array<float,2>{0.946759224f, 0.418012798f},
-std::array<float,2>{0.0823275447f, 0.657370508f},
-std::array<float,2>{0.270157516f, 0.486348122f},
-std::array<float,2>{0.554702997f, 0.718335271f},
-std::array<float,2>{0.782979548f, 0.161152601f},
-std::array<float,2>{0.132081285f, 0.93675077f},
-std::array<float,2>{0.0476099029f, 0.0867531002f},
-std::array<float,2>{0.891902447f, 0.770354331f},
-std::array<float,2>{0.688645899f, 0.329626262f},
-std::array<float,2>{0.498052478f, 0.506334245f},
-std::array<float,2>{0.0309804883f, 0.322097808f},
-std::array<float,2>{0.923773468f, 0.52141726f},
-std::array<float,2>{0.743055463f, 0.0691291317f},
-std::array<float,2>{0.45838505f, 0.756294608f},
-std::array<float,2>{0.307893753f, 0.179637194f},
-std::array<float,2>{0.529502451f, 0.912432134f},
-std::array<float,2>{0.760438204f, 0.482920825f},
-std::array<float,2>{0.167780608f, 0.699542403f},
-std::array<float,2>{0.437412113f, 0.422460765f},
-std::array<float,2>{0.669941723f, 0.673764408f},
-std::array<float,2>{0.994313776f, 0.232673019f},
-std::array<float,2>{0.0961471945f, 0.947822332f},
-std::array<float,2>{0.227992848f, 0.0442227051f},
-std::array<float,2>{0.86341542f, 0.86145848f},
-std::array<float,2>{0.588086843f, 0.251919299f},
-std::array<float,2>{0.314469904f, 0.576154351f},
-std::array<float,2>{0.14958559f, 0.456394613f},
-std::array<float,2>{0.803587496f, 0.727675498f},
-std::array<float,2>{0.538489997f, 0.13556771f},
-std::array<float,2>{0.25286594f, 0.891668677f},
-std::array<float,2>{0.474750906f, 0.117188968f},
-std::array<float,2>{0.717762411f, 0.804693699f},
-std::array<float,2>{0.888355315f, 0.373340547f},
-std::array<float,2>{0.0358492844f, 0.538183749f},
-std::array<float,2>{0.351400614f, 0.290869921f},
-std::array<float,2>{0.622244f, 0.600203753f},
-std::array<float,2>{0.829428494f, 0.010471086f},
-std::array<float,2>{0.205863193f, 0.843510032f},
-std::array<float,2>{0.0694003776f, 0.188101381f},
-std::array<float,2>{0.963864803f, 0.976418138f},
-std::array<float,2>{0.6306777f, 0.380165488f},
-std::array<float,2>{0.405969232f, 0.634913921f},
-std::array<float,2>{0.0396430455f, 0.470664918f},
-std::array<float,2>{0.882734418f, 0.690172791f},
-std::array<float,2>{0.710398316f, 0.180634841f},
-std::array<float,2>{0.479661077f, 0.915750444f},
-std::array<float,2>{0.260858774f, 0.0733189955f},
-std::array<float,2>{0.541148186f, 0.764301717f},
-std::array<float,2>{0.811134577f, 0.312525511f},
-std::array<float,2>{0.144316584f, 0.527984083f},
-std::array<float,2>{0.393790543f, 0.264044434f},
-std::array<float,2>{0.637274146f, 0.564850628f},
-std::array<float,2>{0.960018873f, 0.0333280601f},
-std::array<float,2>{0.0748654827f, 0.869203508f},
-std::array<float,2>{0.214956582f, 0.220186204f},
-std::array<float,2>{0.836380184f, 0.945022047f},
-std::array<float,2>{0.617131829f, 0.431471139f},
-std::array<float,2>{0.356343836f, 0.683161676f},
-std::array<float,2>{0.161550418f, 0.364190817f},
-std::array<float,2>{0.752875447f, 0.539438546f},
-std::array<float,2>{0.520311475f, 0.112026095f},
-std::array<float,2>{0.30098024f, 0.804047644f},
-std::array<float,2>{0.465616107f, 0.12783514f},
-std::array<float,2>{0.737089515f, 0.90097928f},
-std::array<float,2>{0.9298352f, 0.468191475f},
-std::array<float,2>{0.0184481721f, 0.720550478f},
-std::array<float,2>{0.323848695f, 0.382862777f},
-std::array<float,2>{0.578844428f, 0.632682145f},
-std::array<float,2>{0.874668837f, 0.198880479f},
-std::array<float,2>{0.220740527f, 0.981945336f},
-std::array<float,2>{0.10592597f, 0.0021302111f},
-std::array<float,2>{0.99061358f, 0.831672251f},
-std::array<float,2>{0.660195827f, 0.287735403f},
-std::array<float,2>{0.428520679f, 0.606164634f},
-std::array<float,2>{0.0865690187f, 0.299666226f},
-std::array<float,2>{0.940880299f, 0.61435616f},
-std::array<float,2>{0.654237449f, 0.0207078755f},
-std::array<float,2>{0.382613599f, 0.819504321f},
-std::array<float,2>{0.359989554f, 0.20687598f},
-std::array<float,2>{0.599931955f, 0.987789631f},
-std::array<float,2>{0.825304151f, 0.392204165f},
-std::array<float,2>{0.193599522f, 0.650720835f},
-std::array<float,2>{0.488226712f, 0.449445754f},
-std::array<float,2>{0.700681567f, 0.744906902f},
-std::array<float,2>{0.901777327f, 0.14289476f},
-std::array<float,2>{0.0553072169f, 0.889148891f},
-std::array<float,2>{0.136693686f, 0.106986396f},
-std::array<float,2>{0.795194983f, 0.789066792f},
-std::array<float,2>{0.550964475f, 0.357133627f},
-std::array<float,2>{0.279433131f, 0.557987034f},
-std::array<float,2>{0.244369686f, 0.410577416f},
-std::array<float,2>{0.859198749f, 0.668091416f},
-std::array<float,2>{0.576228678f, 0.24590376f},
-std::array<float,2>{0.339239299f, 0.964534581f},
-std::array<float,2>{0.408380181f, 0.0506075546f},
-std::array<float,2>{0.681965888f, 0.852575004f},
-std::array<float,2>{0.972049356f, 0.276455224f},
-std::array<float,2>{0.122941144f, 0.584914744f},
-std::array<float,2>{0.283875972f, 0.341886908f},
-std::array<float,2>{0.506254435f, 0.50991255f},
-std::array<float,2>{0.777180314f, 0.0855974331f},
-std::array<float,2>{0.185504571f, 0.779121757f},
-std::array<float,2>{0.00293998839f, 0.168412104f},
-std::array<float,2>{0.918917954f, 0.927497387f},
-std::array<float,2>{0.729108155f, 0.492853403f},
-std::array<float,2>{0.448435754f, 0.710465729f},
-std::array<float,2>{0.054241851f, 0.389175385f},
-std::array<float,2>{0.895263791f, 0.625506938f},
-std::array<float,2>{0.692315996f, 0.200502858f},
-std::array<float,2>{0.4946087f, 0.979107022f},
-std::array<float,2>{0.267675698f, 0.00512489863f},
-std::array<float,2>{0.561771512f, 0.834261f},
-std::array<float,2>{0.787404776f, 0.281494051f},
-std::array<float,2>{0.128759861f, 0.601832211f},
-std::array<float,2>{0.383989871f, 0.359463274f},
-std::array<float,2>{0.648332357f, 0.546656966f},
-std::array<float,2>{0.950591981f, 0.114881463f},
-std::array<float,2>{0.0817362368f, 0.797961175f},
-std::array<float,2>{0.195919037f, 0.129574239f},
-std::array<float,2>{0.814743996f, 0.905647695f},
-std::array<float,2>{0.606445193f, 0.462185711f},
-std::array<float,2>{0.373211771f, 0.725038588f},
-std::array<float,2>{0.172267392f, 0.260504186f},
-std::array<float,2>{0.768195331f, 0.569196284f},
-std::array<float,2>{0.508974433f, 0.0380141102f},
-std::array<float,2>{0.29227376f, 0.872746229f},
-std::array<float,2>{0.442220449f, 0.226018235f},
-std::array<float,2>{0.724599779f, 0.941153288f},
-std::array<float,2>{0.912197232f, 0.437161148f},
-std::array<float,2>{0.00887554698f, 0.683907628f},
-std::array<float,2>{0.33404085f, 0.473199517f},
-std::array<float,2>{0.566039205f, 0.692337573f},
-std::array<float,2>{0.84587425f, 0.185302585f},
-std::array<float,2>{0.237478361f, 0.918780446f},
-std::array<float,2>{0.109870657f, 0.0750061646f},
-std::array<float,2>{0.977453649f, 0.759503245f},
-std::array<float,2>{0.676291764f, 0.32030043f},
-std::array<float,2>{0.420486808f, 0.525918722f},
-std::array<float,2>{0.0643707216f, 0.336464942f},
-std::array<float,2>{0.966023803f, 0.51308018f},
-std::array<float,2>{0.62851119f, 0.0802456066f},
-std::array<float,2>{0.401836663f, 0.774114788f},
-std::array<float,2>{0.345079213f, 0.167741731f},
-std::array<float,2>{0.619141638f, 0.92273736f},
-std::array<float,2>{0.834508181f, 0.497565985f},
-std::array<float,2>{0.20811747f, 0.703813195f},
-std::array<float,2>{0.471966863f, 0.407099038f},
-std::array<float,2>{0.711796343f, 0.667906404f},
-std::array<float,2>{0.884701073f, 0.246445015f},
-std::array<float,2>{0.0319962762f, 0.967904031f},
-std::array<float,2>{0.15432708f, 0.0546471067f},
-std::array<float,2>{0.798163354f, 0.855716407f},
-std::array<float,2>{0.533903062f, 0.280272633f},
-std::array<float,2>{0.256240308f, 0.578654945f},
-std::array<float,2>{0.231810302f, 0.448071986f},
-std::array<float,2>{0.859423101f, 0.747205436f},
-std::array<float,2>{0.592717886f, 0.147540018f},
-std::array<float,2>{0.320039153f, 0.884747684f},
-std::array<float,2>{0.431386709f, 0.102962404f},
-std::array<float,2>{0.666154742f, 0.793324888f},
-std::array<float,2>{0.998812735f, 0.353077799f},
-std::array<float,2>{0.0987505093f, 0.560888827f},
-std::array<float,2>{0.312010527f, 0.304285437f},
-std::array<float,2>{0.52646786f, 0.611559451f},
-std::array<float,2>{0.765360653f, 0.019247815f},
-std::array<float,2>{0.169655755f, 0.813857257f},
-std::array<float,2>{0.0259987116f, 0.207063675f},
-std::array<float,2>{0.928365052f, 0.991998315f},
-std::array<float,2>{0.748292923f, 0.396450192f},
-std::array<float,2>{0.45470193f, 0.652752817f},
-std::array<float,2>{0.103483073f, 0.492166877f},
-std::array<float,2>{0.985972881f, 0.714593828f},
-std::array<float,2>{0.657298565f, 0.15739505f},
-std::array<float,2>{0.424150765f, 0.932148397f},
-std::array<float,2>{0.326265186f, 0.0918087736f},
-std::array<float,2>{0.583478391f, 0.768266678f},
-std::array<float,2>{0.86958158f, 0.334322661f},
-std::array<float,2>{0.224262431f, 0.503032446f},
-std::array<float,2>{0.461216927f, 0.270761341f},
-std::array<float,2>{0.740205169f, 0.586024523f},
-std::array<float,2>{0.937037349f, 0.0596570447f},
-std::array<float,2>{0.0203331579f, 0.844595671f},
-std::array<float,2>{0.156814739f, 0.2356686f},
-std::array<float,2>{0.754351854f, 0.958213568f},
-std::array<float,2>{0.516266167f, 0.416721672f},
-std::array<float,2>{0.299158543f, 0.663108826f},
-std::array<float,2>{0.213988021f, 0.349394798f},
-std::array<float,2>{0.842342913f, 0.548609257f},
-std::array<float,2>{0.611649215f, 0.100628138f},
-std::array<float,2>{0.352531195f, 0.788521707f},
-std::array<float,2>{0.396513432f, 0.154432893f},
-std::array<float,2>{0.632963657f, 0.880271852f},
-std::array<float,2>{0.957015276f, 0.437539726f},
-std::array<float,2>{0.0707398728f, 0.740376651f},
-std::array<float,2>{0.26227659f, 0.400826305f},
-std::array<float,2>{0.54532963f, 0.641537726f},
-std::array<float,2>{0.804954052f, 0.211672828f},
-std::array<float,2>{0.144580469f, 0.99797976f},
-std::array<float,2>{0.0444078967f, 0.0261031762f},
-std::array<float,2>{0.87523061f, 0.826327503f},
-std::array<float,2>{0.706061244f, 0.307525575f},
-std::array<float,2>{0.481841803f, 0.621558547f},
-std::array<float,2>{0.00501397066f, 0.293912441f},
-std::array<float,2>{0.91738528f, 0.595910132f},
-std::array<float,2>{0.730722785f, 0.0147201112f},
-std::array<float,2>{0.452603847f, 0.83723104f},
-std::array<float,2>{0.28705892f, 0.192754626f},
-std::array<float,2>{0.502158582f, 0.972586811f},
-std::array<float,2>{0.779391646f, 0.377302825f},
-std::array<float,2>{0.183194816f, 0.639925241f},
-std::array<float,2>{0.41163376f, 0.458064198f},
-std::array<float,2>{0.686246276f, 0.731701672f},
-std::array<float,2>{0.975356698f, 0.138450101f},
-std::array<float,2>{0.118347161f, 0.897388279f},
-std::array<float,2>{0.248913854f, 0.122753754f},
-std::array<float,2>{0.852268219f, 0.809336901f},
-std::array<float,2>{0.571699679f, 0.370050669f},
-std::array<float,2>{0.342674881f, 0.533384144f},
-std::array<float,2>{0.136803821f, 0.426927775f},
-std::array<float,2>{0.789234698f, 0.678226173f},
-std::array<float,2>{0.549287677f, 0.227160424f},
-std::array<float,2>{0.276034027f, 0.95168227f},
-std::array<float,2>{0.490341842f, 0.0409702472f},
-std::array<float,2>{0.699146032f, 0.865961492f},
-std::array<float,2>{0.903238237f, 0.254644364f},
-std::array<float,2>{0.0610870831f, 0.572529495f},
-std::array<float,2>{0.363986611f, 0.325634658f},
-std::array<float,2>{0.595859885f, 0.517627716f},
-std::array<float,2>{0.821751714f, 0.0629273877f},
-std::array<float,2>{0.19033052f, 0.753663838f},
-std::array<float,2>{0.0907876417f, 0.172077581f},
-std::array<float,2>{0.941789389f, 0.909128249f},
-std::array<float,2>{0.65147841f, 0.477437496f},
-std::array<float,2>{0.376730233f, 0.69756186f},
-std::array<float,2>{0.0857573375f, 0.421631575f},
-std::array<float,2>{0.949036717f, 0.659988105f},
-std::array<float,2>{0.644111335f, 0.239211157f},
-std::array<float,2>{0.389818937f, 0.956646442f},
-std::array<float,2>{0.370567977f, 0.0574429557f},
-std::array<float,2>{0.605024397f, 0.84883064f},
-std::array<float,2>{0.81865555f, 0.268467873f},
-std::array<float,2>{0.199524194f, 0.591699123f},
-std::array<float,2>{0.497119009f, 0.331872225f},
-std::array<float,2>{0.6898821f, 0.50491035f},
-std::array<float,2>{0.892637014f, 0.0890907198f},
-std::array<float,2>{0.0490668751f, 0.771860063f},
-std::array<float,2>{0.129690215f, 0.162946165f},
-std::array<float,2>{0.783972323f, 0.93492198f},
-std::array<float,2>{0.558224261f, 0.485856295f},
-std::array<float,2>{0.271786928f, 0.716575742f},
-std::array<float,2>{0.24042742f, 0.312217504f},
-std::array<float,2>{0.850231469f, 0.617331207f},
-std::array<float,2>{0.568265557f, 0.0305784121f},
-std::array<float,2>{0.329369932f, 0.821233571f},
-std::array<float,2>{0.417389452f, 0.214930475f},
-std::array<float,2>{0.672961473f, 0.99411571f},
-std::array<float,2>{0.980952263f, 0.4053635f},
-std::array<float,2>{0.114066698f, 0.645657957f},
-std::array<float,2>{0.29416731f, 0.445198208f},
-std::array<float,2>{0.513401449f, 0.737300754f},
-std::array<float,2>{0.769638598f, 0.151172683f},
-std::array<float,2>{0.177271172f, 0.875460804f},
-std::array<float,2>{0.0117415497f, 0.0974634364f},
-std::array<float,2>{0.909889936f, 0.784248352f},
-std::array<float,2>{0.719204009f, 0.345431536f},
-std::array<float,2>{0.438012153f, 0.550852239f},
-std::array<float,2>{0.0377127938f, 0.371189237f},
-std::array<float,2>{0.890307307f, 0.536866605f},
-std::array<float,2>{0.714847326f, 0.120732598f},
-std::array<float,2>{0.474243611f, 0.808258891f},
-std::array<float,2>{0.250271171f, 0.133711621f},
-std::array<float,2>{0.535778761f, 0.893885553f},
-std::array<float,2>{0.801964462f, 0.454892904f},
-std::array<float,2>{0.151255772f, 0.729727268f},
-std::array<float,2>{0.403209627f, 0.381514698f},
-std::array<float,2>{0.631907642f, 0.633204103f},
-std::array<float,2>{0.961221635f, 0.189776763f},
-std::array<float,2>{0.0679406971f, 0.974084079f},
-std::array<float,2>{0.203378588f, 0.00927492231f},
-std::array<float,2>{0.83033663f, 0.840212286f},
-std::array<float,2>{0.623707294f, 0.291753799f},
-std::array<float,2>{0.349600524f, 0.598973989f},
-std::array<float,2>{0.164956152f, 0.480481446f},
-std::array<float,2>{0.759623826f, 0.702446103f},
-std::array<float,2>{0.528135121f, 0.177354306f},
-std::array<float,2>{0.305394322f, 0.910963476f},
-std::array<float,2>{0.459074318f, 0.0670255497f},
-std::array<float,2>{0.744223058f, 0.754855752f},
-std::array<float,2>{0.924633682f, 0.323460162f},
-std::array<float,2>{0.0284331739f, 0.522038996f},
-std::array<float,2>{0.312835425f, 0.252723038f},
-std::array<float,2>{0.587243497f, 0.576188445f},
-std::array<float,2>{0.867103577f, 0.0466153882f},
-std::array<float,2>{0.23011373f, 0.860007644f},
-std::array<float,2>{0.0956213325f, 0.232311279f},
-std::array<float,2>{0.992240548f, 0.946340024f},
-std::array<float,2>{0.66825527f, 0.425771773f},
-std::array<float,2>{0.433872193f, 0.674891055f},
-std::array<float,2>{0.0162957571f, 0.465019643f},
-std::array<float,2>{0.932630897f, 0.72105509f},
-std::array<float,2>{0.73568958f, 0.126722097f},
-std::array<float,2>{0.46822691f, 0.899499118f},
-std::array<float,2>{0.304177821f, 0.110464767f},
-std::array<float,2>{0.521752059f, 0.801976502f},
-std::array<float,2>{0.751435995f, 0.365589589f},
-std::array<float,2>{0.162182406f, 0.542663276f},
-std::array<float,2>{0.426000625f, 0.285770535f},
-std::array<float,2>{0.662887037f, 0.608490169f},
-std::array<float,2>{0.989612341f, 0.00118639483f},
-std::array<float,2>{0.109252781f, 0.829854548f},
-std::array<float,2>{0.218819976f, 0.196840987f},
-std::array<float,2>{0.871442914f, 0.984110415f},
-std::array<float,2>{0.58112973f, 0.385601193f},
-std::array<float,2>{0.321299434f, 0.629912496f},
-std::array<float,2>{0.141222075f, 0.314835399f},
-std::array<float,2>{0.810510635f, 0.53046304f},
-std::array<float,2>{0.5393309f, 0.0709531903f},
-std::array<float,2>{0.259156883f, 0.763105214f},
-std::array<float,2>{0.477477878f, 0.182561755f},
-std::array<float,2>{0.707156539f, 0.917329133f},
-std::array<float,2>{0.879844427f, 0.470819086f},
-std::array<float,2>{0.0425267667f, 0.687504053f},
-std::array<float,2>{0.358309925f, 0.431660593f},
-std::array<float,2>{0.613387346f, 0.68055141f},
-std::array<float,2>{0.838606775f, 0.222343817f},
-std::array<float,2>{0.21787414f, 0.941829085f},
-std::array<float,2>{0.0780429766f, 0.0329913013f},
-std::array<float,2>{0.957911491f, 0.869114101f},
-std::array<float,2>{0.640112817f, 0.262183815f},
-std::array<float,2>{0.391495287f, 0.564287424f},
-std::array<float,2>{0.123752072f, 0.273840487f},
-std::array<float,2>{0.9694134f, 0.58393842f},
-std::array<float,2>{0.680275142f, 0.0475221202f},
-std::array<float,2>{0.406706363f, 0.854255438f},
-std::array<float,2>{0.336271971f, 0.24328123f},
-std::array<float,2>{0.57585901f, 0.961404681f},
-std::array<float,2>{0.855664313f, 0.413522422f},
-std::array<float,2>{0.242735907f, 0.671144187f},
-std::array<float,2>{0.446486771f, 0.495182097f},
-std::array<float,2>{0.727863431f, 0.708693445f},
-std::array<float,2>{0.921705902f, 0.170547858f},
-std::array<float,2>{0.00134544529f, 0.928365469f},
-std::array<float,2>{0.185575888f, 0.0837086067f},
-std::array<float,2>{0.774227083f, 0.781173646f},
-std::array<float,2>{0.503915429f, 0.339899272f},
-std::array<float,2>{0.283110529f, 0.509658098f},
-std::array<float,2>{0.192984447f, 0.393574625f},
-std::array<float,2>{0.826726437f, 0.649333596f},
-std::array<float,2>{0.598842502f, 0.205043077f},
-std::array<float,2>{0.362415105f, 0.98560673f},
-std::array<float,2>{0.380414099f, 0.0220082272f},
-std::array<float,2>{0.655146182f, 0.818038166f},
-std::array<float,2>{0.938594759f, 0.298761755f},
-std::array<float,2>{0.089000605f, 0.616980016f},
-std::array<float,2>{0.277406663f, 0.358707666f},
-std::array<float,2>{0.553952813f, 0.554859936f},
-std::array<float,2>{0.793960869f, 0.107624911f},
-std::array<float,2>{0.133257627f, 0.791719317f},
-std::array<float,2>{0.056939207f, 0.141176462f},
-std::array<float,2>{0.899371862f, 0.887342334f},
-std::array<float,2>{0.702543855f, 0.452707797f},
-std::array<float,2>{0.485236943f, 0.74359715f},
-std::array<float,2>{0.0328178816f, 0.408548981f},
-std::array<float,2>{0.883019984f, 0.665511429f},
-std::array<float,2>{0.711949229f, 0.249233067f},
-std::array<float,2>{0.471434355f, 0.965665579f},
-std::array<float,2>{0.257577777f, 0.0516808629f},
-std::array<float,2>{0.534429133f, 0.857805252f},
-std::array<float,2>{0.797047019f, 0.277872771f},
-std::array<float,2>{0.156241491f, 0.581896245f},
-std::array<float,2>{0.400981992f, 0.338797003f},
-std::array<float,2>{0.62705189f, 0.515205681f},
-std::array<float,2>{0.965444148f, 0.0785950422f},
-std::array<float,2>{0.0633657873f, 0.77674222f},
-std::array<float,2>{0.207550794f, 0.164754063f},
-std::array<float,2>{0.835433006f, 0.925068736f},
-std::array<float,2>{0.620674729f, 0.499827117f},
-std::array<float,2>{0.343951285f, 0.706705749f},
-std::array<float,2>{0.168942839f, 0.300882131f},
-std::array<float,2>{0.76418668f, 0.610194385f},
-std::array<float,2>{0.525541961f, 0.0158182923f},
-std::array<float,2>{0.310638607f, 0.814761281f},
-std::array<float,2>{0.453878164f, 0.209422395f},
-std::array<float,2>{0.749323666f, 0.989319384f},
-std::array<float,2>{0.929562092f, 0.397340178f},
-std::array<float,2>{0.0265645143f, 0.655906737f},
-std::array<float,2>{0.318695903f, 0.44546929f},
-std::array<float,2>{0.593328893f, 0.7480672f},
-std::array<float,2>{0.860746384f, 0.144832045f},
-std::array<float,2>{0.231048867f, 0.885626853f},
-std::array<float,2>{0.0982437953f, 0.104749963f},
-std::array<float,2>{0.999486983f, 0.79507345f},
-std::array<float,2>{0.667759478f, 0.353886813f},
-std::array<float,2>{0.430347174f, 0.560426652f},
-std::array<float,2>{0.0805921555f, 0.36256367f},
-std::array<float,2>{0.949541748f, 0.543523371f},
-std::array<float,2>{0.64689219f, 0.11526911f},
-std::array<float,2>{0.383660525f, 0.7992028f},
-std::array<float,2>{0.37463361f, 0.131967738f},
-std::array<float,2>{0.607415617f, 0.903659701f},
-std::array<float,2>{0.815880835f, 0.463281393f},
-std::array<float,2>{0.196639195f, 0.723342717f},
-std::array<float,2>{0.49550724f, 0.387433887f},
-std::array<float,2>{0.693029046f, 0.627916992f},
-std::array<float,2>{0.895635545f, 0.201581672f},
-std::array<float,2>{0.0530452468f, 0.977558255f},
-std::array<float,2>{0.127164364f, 0.00721238833f},
-std::array<float,2>{0.788348615f, 0.832934558f},
-std::array<float,2>{0.560988605f, 0.283666939f},
-std::array<float,2>{0.269313902f, 0.604841292f},
-std::array<float,2>{0.236528739f, 0.475330174f},
-std::array<float,2>{0.847307086f, 0.694212317f},
-std::array<float,2>{0.564715385f, 0.185693771f},
-std::array<float,2>{0.335742384f, 0.921363115f},
-std::array<float,2>{0.421165258f, 0.0778541043f},
-std::array<float,2>{0.676941037f, 0.759831488f},
-std::array<float,2>{0.977962852f, 0.316463321f},
-std::array<float,2>{0.111002341f, 0.5245713f},
-std::array<float,2>{0.291630507f, 0.258896351f},
-std::array<float,2>{0.508399785f, 0.566509306f},
-std::array<float,2>{0.768713713f, 0.0366908424f},
-std::array<float,2>{0.173717201f, 0.873480916f},
-std::array<float,2>{0.00813371129f, 0.224017248f},
-std::array<float,2>{0.913725019f, 0.937592447f},
-std::array<float,2>{0.723396122f, 0.434560597f},
-std::array<float,2>{0.4426184f, 0.68662101f},
-std::array<float,2>{0.117507927f, 0.459920555f},
-std::array<float,2>{0.976088643f, 0.733072817f},
-std::array<float,2>{0.68660295f, 0.139894739f},
-std::array<float,2>{0.410645992f, 0.895334959f},
-std::array<float,2>{0.343692362f, 0.123870894f},
-std::array<float,2>{0.570580006f, 0.812221646f},
-std::array<float,2>{0.852675438f, 0.367352873f},
-std::array<float,2>{0.249669924f, 0.531885266f},
-std::array<float,2>{0.452020705f, 0.295224935f},
-std::array<float,2>{0.731594563f, 0.595139503f},
-std::array<float,2>{0.916294158f, 0.0129232798f},
-std::array<float,2>{0.00392725039f, 0.838701069f},
-std::array<float,2>{0.182286382f, 0.193832949f},
-std::array<float,2>{0.780938447f, 0.969239712f},
-std::array<float,2>{0.503693342f, 0.376700193f},
-std::array<float,2>{0.285568655f, 0.637790442f},
-std::array<float,2>{0.190513074f, 0.326862931f},
-std::array<float,2>{0.820999205f, 0.51617986f},
-std::array<float,2>{0.597643733f, 0.0654991642f},
-std::array<float,2>{0.364325643f, 0.750468731f},
-std::array<float,2>{0.375748187f, 0.174564406f},
-std::array<float,2>{0.651285112f, 0.906589985f},
-std::array<float,2>{0.943005741f, 0.479474843f},
-std::array<float,2>{0.0912867785f, 0.695698082f},
-std::array<float,2>{0.277244896f, 0.427996606f},
-std::array<float,2>{0.550630033f, 0.677657306f},
-std::array<float,2>{0.790987194f, 0.229741946f},
-std::array<float,2>{0.138269126f, 0.949371457f},
-std::array<float,2>{0.0615873858f, 0.0414449796f},
-std::array<float,2>{0.90401125f, 0.864297152f},
-std::array<float,2>{0.697935939f, 0.256513357f},
-std::array<float,2>{0.491844267f, 0.570334554f},
-std::array<float,2>{0.0208406597f, 0.272830456f},
-std::array<float,2>{0.936121225f, 0.589537561f},
-std::array<float,2>{0.739251852f, 0.0611007102f},
-std::array<float,2>{0.462485254f, 0.847392261f},
-std::array<float,2>{0.300125152f, 0.237165675f},
-std::array<float,2>{0.517097175f, 0.960153937f},
-std::array<float,2>{0.755619287f, 0.414341062f},
-std::array<float,2>{0.157984003f, 0.660555542f},
-std::array<float,2>{0.424869776f, 0.488874286f},
-std::array<float,2>{0.656718433f, 0.712112427f},
-std::array<float,2>{0.984428644f, 0.159902722f},
-std::array<float,2>{0.102523997f, 0.931073844f},
-std::array<float,2>{0.223410636f, 0.0907873437f},
-std::array<float,2>{0.870598555f, 0.767242789f},
-std::array<float,2>{0.58256036f, 0.332714587f},
-std::array<float,2>{0.32760942f, 0.500988364f},
-std::array<float,2>{0.145892054f, 0.399070352f},
-std::array<float,2>{0.806086004f, 0.644452751f},
-std::array<float,2>{0.546743155f, 0.213852435f},
-std::array<float,2>{0.262730569f, 0.999008536f},
-std::array<float,2>{0.481312305f, 0.0236289389f},
-std::array<float,2>{0.705839097f, 0.825309694f},
-std::array<float,2>{0.876847565f, 0.304706067f},
-std::array<float,2>{0.0430416726f, 0.624788821f},
-std::array<float,2>{0.353065461f, 0.351323843f},
-std::array<float,2>{0.612334251f, 0.55060333f},
-std::array<float,2>{0.842921317f, 0.0995724946f},
-std::array<float,2>{0.213581115f, 0.785538137f},
-std::array<float,2>{0.0714437813f, 0.152614877f},
-std::array<float,2>{0.956038892f, 0.881203949f},
-std::array<float,2>{0.634709477f, 0.441393316f},
-std::array<float,2>{0.397958279f, 0.739229441f},
-std::array<float,2>{0.0671881214f, 0.379168034f},
-std::array<float,2>{0.962552845f, 0.636010766f},
-std::array<float,2>{0.631266117f, 0.188494176f},
-std::array<float,2>{0.403830707f, 0.975075364f},
-std::array<float,2>{0.348340392f, 0.0108399624f},
-std::array<float,2>{0.624677062f, 0.842352509f},
-std::array<float,2>{0.831759334f, 0.289954305f},
-std::array<float,2>{0.204161763f, 0.600899398f},
-std::array<float,2>{0.473019451f, 0.374516904f},
-std::array<float,2>{0.716219664f, 0.537921071f},
-std::array<float,2>{0.889044881f, 0.118252195f},
-std::array<float,2>{0.0388443172f, 0.806136608f},
-std::array<float,2>{0.152186811f, 0.136381805f},
-std::array<float,2>{0.801378429f, 0.890843272f},
-std::array<float,2>{0.53689611f, 0.455587506f},
-std::array<float,2>{0.251019478f, 0.726993918f},
-std::array<float,2>{0.229278147f, 0.250439942f},
-std::array<float,2>{0.866190791f, 0.574278295f},
-std::array<float,2>{0.586143374f, 0.0432164595f},
-std::array<float,2>{0.313757658f, 0.863280356f},
-std::array<float,2>{0.434697837f, 0.234049559f},
-std::array<float,2>{0.669631183f, 0.94918865f},
-std::array<float,2>{0.993457735f, 0.423716873f},
-std::array<float,2>{0.0945222154f, 0.67202574f},
-std::array<float,2>{0.306427002f, 0.483642489f},
-std::array<float,2>{0.528786898f, 0.700743854f},
-std::array<float,2>{0.758451819f, 0.178654715f},
-std::array<float,2>{0.16586709f, 0.913847148f},
-std::array<float,2>{0.0282343812f, 0.06992241f},
-std::array<float,2>{0.925713718f, 0.757122576f},
-std::array<float,2>{0.745450199f, 0.321072429f},
-std::array<float,2>{0.460806489f, 0.519852281f},
-std::array<float,2>{0.0498278663f, 0.329095513f},
-std::array<float,2>{0.893743396f, 0.507354259f},
-std::array<float,2>{0.690756679f, 0.0874487683f},
-std::array<float,2>{0.496146023f, 0.771080792f},
-std::array<float,2>{0.273310065f, 0.160464168f},
-std::array<float,2>{0.556852162f, 0.93578589f},
-std::array<float,2>{0.784317315f, 0.488175601f},
-std::array<float,2>{0.130810663f, 0.716903031f},
-std::array<float,2>{0.389301479f, 0.419089913f},
-std::array<float,2>{0.643320262f, 0.656396627f},
-std::array<float,2>{0.947970808f, 0.241536915f},
-std::array<float,2>{0.0840905979f, 0.953296721f},
-std::array<float,2>{0.200292438f, 0.05601345f},
-std::array<float,2>{0.819944799f, 0.8502267f},
-std::array<float,2>{0.604390502f, 0.266850591f},
-std::array<float,2>{0.369158f, 0.593539536f},
-std::array<float,2>{0.175899968f, 0.443222374f},
-std::array<float,2>{0.771421432f, 0.734833479f},
-std::array<float,2>{0.512026191f, 0.1499504f},
-std::array<float,2>{0.293207794f, 0.878062308f},
-std::array<float,2>{0.438944727f, 0.0945227593f},
-std::array<float,2>{0.720627308f, 0.78187561f},
-std::array<float,2>{0.908205509f, 0.346359134f},
-std::array<float,2>{0.0127648301f, 0.554428339f},
-std::array<float,2>{0.328567535f, 0.310356617f},
-std::array<float,2>{0.566425264f, 0.619813681f},
-std::array<float,2>{0.850974321f, 0.0290200505f},
-std::array<float,2>{0.241626844f, 0.824028075f},
-std::array<float,2>{0.114658058f, 0.2186988f},
-std::array<float,2>{0.982184827f, 0.995318115f},
-std::array<float,2>{0.672751069f, 0.404283047f},
-std::array<float,2>{0.416971892f, 0.647247851f},
-std::array<float,2>{0.000530063582f, 0.493282557f},
-std::array<float,2>{0.920779049f, 0.709627151f},
-std::array<float,2>{0.727077603f, 0.169320613f},
-std::array<float,2>{0.446225882f, 0.926169395f},
-std::array<float,2>{0.281527221f, 0.084357731f},
-std::array<float,2>{0.505215049f, 0.777775347f},
-std::array<float,2>{0.774558902f, 0.34319967f},
-std::array<float,2>{0.187078595f, 0.511013448f},
-std::array<float,2>{0.407450318f, 0.276092499f},
-std::array<float,2>{0.681139469f, 0.585642219f},
-std::array<float,2>{0.970046878f, 0.0491160043f},
-std::array<float,2>{0.124691315f, 0.852021694f},
-std::array<float,2>{0.243322998f, 0.244349465f},
-std::array<float,2>{0.856929958f, 0.963848829f},
-std::array<float,2>{0.574360251f, 0.411466986f},
-std::array<float,2>{0.337200761f, 0.669779718f},
-std::array<float,2>{0.133792892f, 0.355568588f},
-std::array<float,2>{0.793089211f, 0.556898475f},
-std::array<float,2>{0.553622901f, 0.105884574f},
-std::array<float,2>{0.278982043f, 0.790811062f},
-std::array<float,2>{0.486002803f, 0.144463539f},
-std::array<float,2>{0.701712549f, 0.889901221f},
-std::array<float,2>{0.899682224f, 0.450454414f},
-std::array<float,2>{0.0579350814f, 0.745354056f},
-std::array<float,2>{0.361503571f, 0.391197383f},
-std::array<float,2>{0.598319888f, 0.652334094f},
-std::array<float,2>{0.827270448f, 0.205334231f},
-std::array<float,2>{0.192069277f, 0.986652732f},
-std::array<float,2>{0.0882993713f, 0.0199232418f},
-std::array<float,2>{0.938392699f, 0.81882304f},
-std::array<float,2>{0.655911028f, 0.300414115f},
-std::array<float,2>{0.379753709f, 0.613902032f},
-std::array<float,2>{0.107835285f, 0.288682014f},
-std::array<float,2>{0.988989294f, 0.606833458f},
-std::array<float,2>{0.663971126f, 0.00307307532f},
-std::array<float,2>{0.426987678f, 0.830867112f},
-std::array<float,2>{0.320954025f, 0.197603688f},
-std::array<float,2>{0.580156922f, 0.980676055f},
-std::array<float,2>{0.873001039f, 0.384015411f},
-std::array<float,2>{0.220435381f, 0.631432712f},
-std::array<float,2>{0.467224896f, 0.467152029f},
-std::array<float,2>{0.734985888f, 0.719443798f},
-std::array<float,2>{0.932375789f, 0.128899008f},
-std::array<float,2>{0.0170944147f, 0.901592016f},
-std::array<float,2>{0.163791612f, 0.113213271f},
-std::array<float,2>{0.750948131f, 0.802795351f},
-std::array<float,2>{0.523112655f, 0.364492983f},
-std::array<float,2>{0.303696424f, 0.5400998f},
-std::array<float,2>{0.216993421f, 0.429882497f},
-std::array<float,2>{0.839154243f, 0.68244797f},
-std::array<float,2>{0.615017235f, 0.219423577f},
-std::array<float,2>{0.359050542f, 0.943878949f},
-std::array<float,2>{0.392325968f, 0.0348652676f},
-std::array<float,2>{0.638691783f, 0.870148063f},
-std::array<float,2>{0.958854318f, 0.264738977f},
-std::array<float,2>{0.0765654296f, 0.565969825f},
-std::array<float,2>{0.258279651f, 0.313758343f},
-std::array<float,2>{0.540126681f, 0.529203892f},
-std::array<float,2>{0.809337974f, 0.0728430673f},
-std::array<float,2>{0.142205521f, 0.764951885f},
-std::array<float,2>{0.0418807231f, 0.180969208f},
-std::array<float,2>{0.880038023f, 0.914568603f},
-std::array<float,2>{0.708787799f, 0.469098777f},
-std::array<float,2>{0.477608502f, 0.690974772f},
-std::array<float,2>{0.0253291428f, 0.394665509f},
-std::array<float,2>{0.926308274f, 0.654187083f},
-std::array<float,2>{0.74802959f, 0.208269432f},
-std::array<float,2>{0.455173194f, 0.990457475f},
-std::array<float,2>{0.309361905f, 0.0181787703f},
-std::array<float,2>{0.523797154f, 0.812761486f},
-std::array<float,2>{0.762166858f, 0.303382963f},
-std::array<float,2>{0.171802863f, 0.612755239f},
-std::array<float,2>{0.433251768f, 0.352498382f},
-std::array<float,2>{0.664499044f, 0.562178493f},
-std::array<float,2>{0.997627079f, 0.101616696f},
-std::array<float,2>{0.101258077f, 0.794327199f},
-std::array<float,2>{0.233152166f, 0.14664875f},
-std::array<float,2>{0.862263143f, 0.883377969f},
-std::array<float,2>{0.590637207f, 0.44869113f},
-std::array<float,2>{0.317423791f, 0.746149659f},
-std::array<float,2>{0.152592108f, 0.281168461f},
-std::array<float,2>{0.800203979f, 0.579776049f},
-std::array<float,2>{0.532704055f, 0.0533487126f},
-std::array<float,2>{0.254088283f, 0.85681206f},
-std::array<float,2>{0.469914436f, 0.247080609f},
-std::array<float,2>{0.713106632f, 0.967233598f},
-std::array<float,2>{0.88510716f, 0.407245755f},
-std::array<float,2>{0.0334253088f, 0.666096628f},
-std::array<float,2>{0.347123742f, 0.49687621f},
-std::array<float,2>{0.618368924f, 0.70428282f},
-std::array<float,2>{0.832349718f, 0.166446462f},
-std::array<float,2>{0.210052937f, 0.923194885f},
-std::array<float,2>{0.0655701905f, 0.0813768208f},
-std::array<float,2>{0.968457699f, 0.775024176f},
-std::array<float,2>{0.625768125f, 0.337479085f},
-std::array<float,2>{0.400094092f, 0.51243782f},
-std::array<float,2>{0.111677088f, 0.318841755f},
-std::array<float,2>{0.979462266f, 0.526978076f},
-std::array<float,2>{0.679040313f, 0.0760954469f},
-std::array<float,2>{0.418064386f, 0.757826924f},
-std::array<float,2>{0.333294362f, 0.183733374f},
-std::array<float,2>{0.562704027f, 0.919854105f},
-std::array<float,2>{0.844530821f, 0.474395543f},
-std::array<float,2>{0.235074177f, 0.693218887f},
-std::array<float,2>{0.445071697f, 0.435805321f},
-std::array<float,2>{0.725533366f, 0.684826314f},
-std::array<float,2>{0.911044717f, 0.225321651f},
-std::array<float,2>{0.0111911111f, 0.939867914f},
-std::array<float,2>{0.174293593f, 0.0383015908f},
-std::array<float,2>{0.767241478f, 0.871864021f},
-std::array<float,2>{0.51112926f, 0.261421055f},
-std::array<float,2>{0.290088177f, 0.569787562f},
-std::array<float,2>{0.198795468f, 0.461146802f},
-std::array<float,2>{0.812850595f, 0.725854218f},
-std::array<float,2>{0.608292162f, 0.129985258f},
-std::array<float,2>{0.372288436f, 0.90491873f},
-std::array<float,2>{0.386662185f, 0.11339879f},
-std::array<float,2>{0.644541562f, 0.79726243f},
-std::array<float,2>{0.95183742f, 0.361121386f},
-std::array<float,2>{0.0781728774f, 0.544973969f},
-std::array<float,2>{0.26635173f, 0.282829881f},
-std::array<float,2>{0.55978334f, 0.603308916f},
-std::array<float,2>{0.785255313f, 0.00440196646f},
-std::array<float,2>{0.125580043f, 0.835404575f},
-std::array<float,2>{0.0525105707f, 0.199717477f},
-std::array<float,2>{0.898122668f, 0.979841411f},
-std::array<float,2>{0.69525212f, 0.390623003f},
-std::array<float,2>{0.493196666f, 0.626543462f},
-std::array<float,2>{0.0924912989f, 0.477959454f},
-std::array<float,2>{0.944142997f, 0.698844254f},
-std::array<float,2>{0.648626506f, 0.173733518f},
-std::array<float,2>{0.378695965f, 0.909401476f},
-std::array<float,2>{0.366720974f, 0.0640556365f},
-std::array<float,2>{0.594741344f, 0.752416372f},
-std::array<float,2>{0.823403418f, 0.324290365f},
-std::array<float,2>{0.188662633f, 0.518779933f},
-std::array<float,2>{0.489427835f, 0.255083531f},
-std::array<float,2>{0.697138488f, 0.573295772f},
-std::array<float,2>{0.905031979f, 0.0392890424f},
-std::array<float,2>{0.059658546f, 0.866538465f},
-std::array<float,2>{0.139301673f, 0.227566063f},
-std::array<float,2>{0.791036069f, 0.952879071f},
-std::array<float,2>{0.548732638f, 0.426111698f},
-std::array<float,2>{0.275090486f, 0.67916131f},
-std::array<float,2>{0.247030318f, 0.370633721f},
-std::array<float,2>{0.855129063f, 0.534359396f},
-std::array<float,2>{0.572902203f, 0.121858232f},
-std::array<float,2>{0.3414554f, 0.810183644f},
-std::array<float,2>{0.412544996f, 0.137462452f},
-std::array<float,2>{0.685045123f, 0.897526443f},
-std::array<float,2>{0.973140597f, 0.457044542f},
-std::array<float,2>{0.121059641f, 0.731191635f},
-std::array<float,2>{0.28857711f, 0.378084153f},
-std::array<float,2>{0.500564396f, 0.639519811f},
-std::array<float,2>{0.779230654f, 0.192252204f},
-std::array<float,2>{0.179969683f, 0.970903933f},
-std::array<float,2>{0.00765044987f, 0.0139049143f},
-std::array<float,2>{0.914371252f, 0.836394787f},
-std::array<float,2>{0.733791828f, 0.29425177f},
-std::array<float,2>{0.450971901f, 0.597033858f},
-std::array<float,2>{0.0454237126f, 0.308069229f},
-std::array<float,2>{0.878077745f, 0.622687876f},
-std::array<float,2>{0.704259336f, 0.0265775751f},
-std::array<float,2>{0.482993037f, 0.827407539f},
-std::array<float,2>{0.264310122f, 0.212772369f},
-std::array<float,2>{0.543448031f, 0.996486545f},
-std::array<float,2>{0.80783385f, 0.40214029f},
-std::array<float,2>{0.146988153f, 0.641716003f},
-std::array<float,2>{0.396417528f, 0.439090908f},
-std::array<float,2>{0.636241794f, 0.741960347f},
-std::array<float,2>{0.955066919f, 0.155720726f},
-std::array<float,2>{0.0737642422f, 0.879661202f},
-std::array<float,2>{0.211539075f, 0.0998737216f},
-std::array<float,2>{0.839956284f, 0.788025916f},
-std::array<float,2>{0.610450268f, 0.347807735f},
-std::array<float,2>{0.355191171f, 0.547190905f},
-std::array<float,2>{0.159332573f, 0.417104095f},
-std::array<float,2>{0.756287098f, 0.662664473f},
-std::array<float,2>{0.519058526f, 0.235199183f},
-std::array<float,2>{0.29707247f, 0.958007097f},
-std::array<float,2>{0.463095754f, 0.0589519963f},
-std::array<float,2>{0.741030633f, 0.845246851f},
-std::array<float,2>{0.935052812f, 0.270339757f},
-std::array<float,2>{0.0218991097f, 0.587131739f},
-std::array<float,2>{0.325663745f, 0.335742444f},
-std::array<float,2>{0.585513771f, 0.502276003f},
-std::array<float,2>{0.868221939f, 0.0932997316f},
-std::array<float,2>{0.226038098f, 0.76861757f},
-std::array<float,2>{0.105266728f, 0.156535849f},
-std::array<float,2>{0.987573445f, 0.933429003f},
-std::array<float,2>{0.658388495f, 0.490360618f},
-std::array<float,2>{0.422113329f, 0.713151991f},
-std::array<float,2>{0.0976505727f, 0.423993766f},
-std::array<float,2>{0.995340168f, 0.674685597f},
-std::array<float,2>{0.671506584f, 0.23107706f},
-std::array<float,2>{0.435729355f, 0.945578694f},
-std::array<float,2>{0.316339314f, 0.0453203097f},
-std::array<float,2>{0.58936882f, 0.861174524f},
-std::array<float,2>{0.865118146f, 0.253385484f},
-std::array<float,2>{0.227067426f, 0.577230811f},
-std::array<float,2>{0.457292289f, 0.322286308f},
-std::array<float,2>{0.743762672f, 0.522598147f},
-std::array<float,2>{0.922019184f, 0.0682694539f},
-std::array<float,2>{0.0296861399f, 0.755718827f},
-std::array<float,2>{0.16645959f, 0.176605895f},
-std::array<float,2>{0.76130873f, 0.911234438f},
-std::array<float,2>{0.530364573f, 0.481550008f},
-std::array<float,2>{0.307272494f, 0.701681197f},
-std::array<float,2>{0.2061252f, 0.292082578f},
-std::array<float,2>{0.828942299f, 0.597944736f},
-std::array<float,2>{0.621991515f, 0.00863162428f},
-std::array<float,2>{0.350076556f, 0.841386914f},
-std::array<float,2>{0.405112058f, 0.190492019f},
-std::array<float,2>{0.629757226f, 0.972776473f},
-std::array<float,2>{0.964417756f, 0.381857187f},
-std::array<float,2>{0.0688207f, 0.633896947f},
-std::array<float,2>{0.253104925f, 0.454071075f},
-std::array<float,2>{0.537676394f, 0.728862047f},
-std::array<float,2>{0.80389291f, 0.134286404f},
-std::array<float,2>{0.14883852f, 0.892784417f},
-std::array<float,2>{0.0366397537f, 0.119312078f},
-std::array<float,2>{0.886860073f, 0.806935549f},
-std::array<float,2>{0.718517244f, 0.372295648f},
-std::array<float,2>{0.47617808f, 0.536013603f},
-std::array<float,2>{0.0149565162f, 0.343816757f},
-std::array<float,2>{0.906968772f, 0.552485824f},
-std::array<float,2>{0.721340597f, 0.0958299637f},
-std::array<float,2>{0.440706611f, 0.783417106f},
-std::array<float,2>{0.296195865f, 0.151529536f},
-std::array<float,2>{0.514146388f, 0.87662375f},
-std::array<float,2>{0.773311496f, 0.444262147f},
-std::array<float,2>{0.178781748f, 0.737852812f},
-std::array<float,2>{0.415273428f, 0.404878408f},
-std::array<float,2>{0.673901558f, 0.644646645f},
-std::array<float,2>{0.983614981f, 0.216382593f},
-std::array<float,2>{0.116969854f, 0.99305886f},
-std::array<float,2>{0.239574894f, 0.029499948f},
-std::array<float,2>{0.847912729f, 0.8220523f},
-std::array<float,2>{0.569626629f, 0.310793251f},
-std::array<float,2>{0.330322355f, 0.618254781f},
-std::array<float,2>{0.131817088f, 0.484528989f},
-std::array<float,2>{0.781405032f, 0.714956522f},
-std::array<float,2>{0.556078196f, 0.163114354f},
-std::array<float,2>{0.271101803f, 0.934321523f},
-std::array<float,2>{0.499319166f, 0.0881039277f},
-std::array<float,2>{0.687736511f, 0.772470295f},
-std::array<float,2>{0.890924335f, 0.330674142f},
-std::array<float,2>{0.048824396f, 0.503948689f},
-std::array<float,2>{0.368620515f, 0.269473404f},
-std::array<float,2>{0.601822853f, 0.590051234f},
-std::array<float,2>{0.817592859f, 0.0583655089f},
-std::array<float,2>{0.202226862f, 0.847815633f},
-std::array<float,2>{0.0837801695f, 0.239975855f},
-std::array<float,2>{0.94604075f, 0.955312908f},
-std::array<float,2>{0.641610563f, 0.420446306f},
-std::array<float,2>{0.38731724f, 0.658420384f},
-std::array<float,2>{0.05574793f, 0.451583743f},
-std::array<float,2>{0.901163816f, 0.742720783f},
-std::array<float,2>{0.699788809f, 0.142566457f},
-std::array<float,2>{0.486341059f, 0.888075233f},
-std::array<float,2>{0.280746222f, 0.108803265f},
-std::array<float,2>{0.552565634f, 0.792381167f},
-std::array<float,2>{0.796775639f, 0.358341396f},
-std::array<float,2>{0.134916618f, 0.556516111f},
-std::array<float,2>{0.381796867f, 0.296987414f},
-std::array<float,2>{0.653170884f, 0.61560744f},
-std::array<float,2>{0.94003582f, 0.0232851002f},
-std::array<float,2>{0.0869667009f, 0.816532433f},
-std::array<float,2>{0.195267722f, 0.203530326f},
-std::array<float,2>{0.825176358f, 0.984654069f},
-std::array<float,2>{0.600863814f, 0.393033624f},
-std::array<float,2>{0.360839725f, 0.650094092f},
-std::array<float,2>{0.184006035f, 0.341338933f},
-std::array<float,2>{0.776151478f, 0.50820756f},
-std::array<float,2>{0.507424533f, 0.0821830481f},
-std::array<float,2>{0.284258962f, 0.779479444f},
-std::array<float,2>{0.447886944f, 0.171582446f},
-std::array<float,2>{0.729754806f, 0.929154038f},
-std::array<float,2>{0.919590175f, 0.49509427f},
-std::array<float,2>{0.00211101072f, 0.707145631f},
-std::array<float,2>{0.338351429f, 0.412956238f},
-std::array<float,2>{0.577233613f, 0.670574903f},
-std::array<float,2>{0.858319759f, 0.242784664f},
-std::array<float,2>{0.245646939f, 0.962886572f},
-std::array<float,2>{0.121473938f, 0.04830667f},
-std::array<float,2>{0.971369028f, 0.855359077f},
-std::array<float,2>{0.683201134f, 0.274674237f},
-std::array<float,2>{0.409692347f, 0.582502186f},
-std::array<float,2>{0.0756862685f, 0.262905478f},
-std::array<float,2>{0.959089756f, 0.56259352f},
-std::array<float,2>{0.638116479f, 0.0316083096f},
-std::array<float,2>{0.393024385f, 0.868142426f},
-std::array<float,2>{0.357150733f, 0.220851287f},
-std::array<float,2>{0.615975499f, 0.943351805f},
-std::array<float,2>{0.837702751f, 0.433565736f},
-std::array<float,2>{0.216445342f, 0.681303144f},
-std::array<float,2>{0.479429841f, 0.472166389f},
-std::array<float,2>{0.709922552f, 0.689342976f},
-std::array<float,2>{0.881414473f, 0.183226436f},
-std::array<float,2>{0.0401836075f, 0.916747749f},
-std::array<float,2>{0.142645121f, 0.0722276419f},
-std::array<float,2>{0.812333643f, 0.762324631f},
-std::array<float,2>{0.542271256f, 0.316133291f},
-std::array<float,2>{0.260189652f, 0.529862523f},
-std::array<float,2>{0.222341523f, 0.386101961f},
-std::array<float,2>{0.873981655f, 0.62954551f},
-std::array<float,2>{0.579287827f, 0.195419133f},
-std::array<float,2>{0.323158622f, 0.982706785f},
-std::array<float,2>{0.428946137f, 0.000305290887f},
-std::array<float,2>{0.661738813f, 0.828384757f},
-std::array<float,2>{0.991545796f, 0.286857009f},
-std::array<float,2>{0.107254267f, 0.607732654f},
-std::array<float,2>{0.30218935f, 0.36718291f},
-std::array<float,2>{0.520816147f, 0.541172206f},
-std::array<float,2>{0.753701508f, 0.109801285f},
-std::array<float,2>{0.160916299f, 0.800854564f},
-std::array<float,2>{0.0190472845f, 0.125199899f},
-std::array<float,2>{0.930765927f, 0.898736417f},
-std::array<float,2>{0.737410665f, 0.46656689f},
-std::array<float,2>{0.46598193f, 0.722308159f},
-std::array<float,2>{0.00374507532f, 0.411136925f},
-std::array<float,2>{0.918150842f, 0.669588089f},
-std::array<float,2>{0.72879678f, 0.244447172f},
-std::array<float,2>{0.449068755f, 0.96350807f},
-std::array<float,2>{0.28355664f, 0.048836153f},
-std::array<float,2>{0.506816268f, 0.851654053f},
-std::array<float,2>{0.776550174f, 0.276345551f},
-std::array<float,2>{0.184722289f, 0.585800052f},
-std::array<float,2>{0.409177661f, 0.342872828f},
-std::array<float,2>{0.682411432f, 0.510743916f},
-std::array<float,2>{0.972238481f, 0.0841629803f},
-std::array<float,2>{0.122275211f, 0.777428269f},
-std::array<float,2>{0.245018065f, 0.169071332f},
-std::array<float,2>{0.858848751f, 0.925848961f},
-std::array<float,2>{0.577128351f, 0.49357447f},
-std::array<float,2>{0.339785367f, 0.709857047f},
-std::array<float,2>{0.135752857f, 0.300613403f},
-std::array<float,2>{0.795447052f, 0.614102244f},
-std::array<float,2>{0.551424384f, 0.0195577554f},
-std::array<float,2>{0.280189842f, 0.818546295f},
-std::array<float,2>{0.487383574f, 0.205231965f},
-std::array<float,2>{0.701119661f, 0.986358762f},
-std::array<float,2>{0.902057171f, 0.391445667f},
-std::array<float,2>{0.0550631434f, 0.651862144f},
-std::array<float,2>{0.359777242f, 0.450263798f},
-std::array<float,2>{0.600110471f, 0.745542943f},
-std::array<float,2>{0.826155961f, 0.144232184f},
-std::array<float,2>{0.19407621f, 0.889840186f},
-std::array<float,2>{0.0864052549f, 0.105537854f},
-std::array<float,2>{0.941370845f, 0.790739775f},
-std::array<float,2>{0.653496444f, 0.355714738f},
-std::array<float,2>{0.38210693f, 0.556662619f},
-std::array<float,2>{0.106223337f, 0.364536554f},
-std::array<float,2>{0.99085027f, 0.540470839f},
-std::array<float,2>{0.661048591f, 0.113004938f},
-std::array<float,2>{0.42774722f, 0.803051293f},
-std::array<float,2>{0.323673218f, 0.12843585f},
-std::array<float,2>{0.578608751f, 0.901786745f},
-std::array<float,2>{0.874035776f, 0.467035681f},
-std::array<float,2>{0.221311629f, 0.719564915f},
-std::array<float,2>{0.465254754f, 0.384147257f},
-std::array<float,2>{0.736492872f, 0.631635785f},
-std::array<float,2>{0.930193186f, 0.197362974f},
-std::array<float,2>{0.0176420938f, 0.980781913f},
-std::array<float,2>{0.162039369f, 0.00336017483f},
-std::array<float,2>{0.751960933f, 0.830748439f},
-std::array<float,2>{0.519646704f, 0.288999408f},
-std::array<float,2>{0.301692367f, 0.606528401f},
-std::array<float,2>{0.215457439f, 0.468773454f},
-std::array<float,2>{0.836546004f, 0.691378891f},
-std::array<float,2>{0.616468906f, 0.180893034f},
-std::array<float,2>{0.355562836f, 0.914956033f},
-std::array<float,2>{0.394503444f, 0.0731972158f},
-std::array<float,2>{0.63703686f, 0.764800131f},
-std::array<float,2>{0.960521281f, 0.313493341f},
-std::array<float,2>{0.0745635256f, 0.528820395f},
-std::array<float,2>{0.26125282f, 0.26489979f},
-std::array<float,2>{0.541620731f, 0.566250026f},
-std::array<float,2>{0.810646057f, 0.0349270962f},
-std::array<float,2>{0.143896401f, 0.870556891f},
-std::array<float,2>{0.0394391119f, 0.219597399f},
-std::array<float,2>{0.88222456f, 0.94418329f},
-std::array<float,2>{0.710832298f, 0.430116236f},
-std::array<float,2>{0.480184555f, 0.682261527f},
-std::array<float,2>{0.0702668652f, 0.455837965f},
-std::array<float,2>{0.96323806f, 0.726612389f},
-std::array<float,2>{0.630154312f, 0.136529475f},
-std::array<float,2>{0.405701399f, 0.89095664f},
-std::array<float,2>{0.350763381f, 0.118546546f},
-std::array<float,2>{0.622869551f, 0.805727243f},
-std::array<float,2>{0.829740763f, 0.374878913f},
-std::array<float,2>{0.205402732f, 0.537698209f},
-std::array<float,2>{0.475284696f, 0.289790004f},
-std::array<float,2>{0.71689868f, 0.600792527f},
-std::array<float,2>{0.887898624f, 0.0110652111f},
-std::array<float,2>{0.035394527f, 0.842639685f},
-std::array<float,2>{0.150372937f, 0.188892469f},
-std::array<float,2>{0.803012669f, 0.974640787f},
-std::array<float,2>{0.538614213f, 0.378944159f},
-std::array<float,2>{0.25232476f, 0.635777235f},
-std::array<float,2>{0.228177115f, 0.320820123f},
-std::array<float,2>{0.863977313f, 0.519595921f},
-std::array<float,2>{0.588603497f, 0.0702508539f},
-std::array<float,2>{0.315393984f, 0.756883621f},
-std::array<float,2>{0.436611474f, 0.178333148f},
-std::array<float,2>{0.670740843f, 0.913613558f},
-std::array<float,2>{0.99476558f, 0.483710796f},
-std::array<float,2>{0.0962634981f, 0.701091886f},
-std::array<float,2>{0.308349937f, 0.423564732f},
-std::array<float,2>{0.529925704f, 0.672245622f},
-std::array<float,2>{0.760185182f, 0.23421818f},
-std::array<float,2>{0.167102054f, 0.948962152f},
-std::array<float,2>{0.0306885149f, 0.043172732f},
-std::array<float,2>{0.923294723f, 0.862871528f},
-std::array<float,2>{0.742517412f, 0.250107169f},
-std::array<float,2>{0.458512425f, 0.574598849f},
-std::array<float,2>{0.0469096266f, 0.266684532f},
-std::array<float,2>{0.892438412f, 0.593304813f},
-std::array<float,2>{0.688974917f, 0.055671297f},
-std::array<float,2>{0.498664558f, 0.850412726f},
-std::array<float,2>{0.269704133f, 0.241393179f},
-std::array<float,2>{0.555266798f, 0.953606904f},
-std::array<float,2>{0.782316029f, 0.419280082f},
-std::array<float,2>{0.132627711f, 0.656581581f},
-std::array<float,2>{0.388295531f, 0.48786062f},
-std::array<float,2>{0.641248465f, 0.717179239f},
-std::array<float,2>{0.946920455f, 0.160388082f},
-std::array<float,2>{0.0828518122f, 0.935954034f},
-std::array<float,2>{0.201804489f, 0.0876760185f},
-std::array<float,2>{0.817208529f, 0.771353185f},
-std::array<float,2>{0.602815211f, 0.328620613f},
-std::array<float,2>{0.36749953f, 0.507673502f},
-std::array<float,2>{0.178481877f, 0.403922796f},
-std::array<float,2>{0.771930397f, 0.6470204f},
-std::array<float,2>{0.51507467f, 0.218339086f},
-std::array<float,2>{0.295297503f, 0.995557785f},
-std::array<float,2>{0.440119088f, 0.0292412676f},
-std::array<float,2>{0.722499847f, 0.823946238f},
-std::array<float,2>{0.908071935f, 0.310296655f},
-std::array<float,2>{0.0142624844f, 0.620108008f},
-std::array<float,2>{0.331353039f, 0.346625179f},
-std::array<float,2>{0.568576336f, 0.554532409f},
-std::array<float,2>{0.849190712f, 0.0943864658f},
-std::array<float,2>{0.2392492f, 0.782209456f},
-std::array<float,2>{0.116189726f, 0.150263175f},
-std::array<float,2>{0.982423663f, 0.87825954f},
-std::array<float,2>{0.675172448f, 0.442921191f},
-std::array<float,2>{0.414889395f, 0.734453917f},
-std::array<float,2>{0.119870313f, 0.37681666f},
-std::array<float,2>{0.973876655f, 0.638158441f},
-std::array<float,2>{0.683990896f, 0.193490803f},
-std::array<float,2>{0.413902432f, 0.969658196f},
-std::array<float,2>{0.340565175f, 0.0129682794f},
-std::array<float,2>{0.574135959f, 0.838456094f},
-std::array<float,2>{0.854183555f, 0.29495874f},
-std::array<float,2>{0.247143909f, 0.594905198f},
-std::array<float,2>{0.450066686f, 0.367453963f},
-std::array<float,2>{0.732909083f, 0.532023251f},
-std::array<float,2>{0.91513294f, 0.123733006f},
-std::array<float,2>{0.00609653117f, 0.812304556f},
-std::array<float,2>{0.180776328f, 0.139697477f},
-std::array<float,2>{0.778038383f, 0.895259082f},
-std::array<float,2>{0.501605511f, 0.459572077f},
-std::array<float,2>{0.287810624f, 0.733239591f},
-std::array<float,2>{0.188447848f, 0.256635815f},
-std::array<float,2>{0.822867751f, 0.57076323f},
-std::array<float,2>{0.594068229f, 0.0411144868f},
-std::array<float,2>{0.365329683f, 0.86460501f},
-std::array<float,2>{0.377542049f, 0.229711294f},
-std::array<float,2>{0.649512947f, 0.949463606f},
-std::array<float,2>{0.944405198f, 0.427906573f},
-std::array<float,2>{0.0936192498f, 0.677323878f},
-std::array<float,2>{0.273935199f, 0.479064763f},
-std::array<float,2>{0.546947122f, 0.695461154f},
-std::array<float,2>{0.792399704f, 0.174412012f},
-std::array<float,2>{0.140400246f, 0.906472445f},
-std::array<float,2>{0.0589093529f, 0.0656763986f},
-std::array<float,2>{0.906056046f, 0.750220954f},
-std::array<float,2>{0.696221292f, 0.326917112f},
-std::array<float,2>{0.488602787f, 0.51638931f},
-std::array<float,2>{0.023083318f, 0.33285749f},
-std::array<float,2>{0.934224725f, 0.501435101f},
-std::array<float,2>{0.741666138f, 0.0904928669f},
-std::array<float,2>{0.464371681f, 0.76743114f},
-std::array<float,2>{0.298102945f, 0.1601298f},
-std::array<float,2>{0.517721415f, 0.930779696f},
-std::array<float,2>{0.756956279f, 0.489085525f},
-std::array<float,2>{0.158297926f, 0.712351859f},
-std::array<float,2>{0.423609495f, 0.414259791f},
-std::array<float,2>{0.659220695f, 0.660210073f},
-std::array<float,2>{0.986426532f, 0.237009153f},
-std::array<float,2>{0.103530884f, 0.960367143f},
-std::array<float,2>{0.224855095f, 0.0614107735f},
-std::array<float,2>{0.868159115f, 0.847438872f},
-std::array<float,2>{0.584093034f, 0.272562385f},
-std::array<float,2>{0.324952543f, 0.589614034f},
-std::array<float,2>{0.147871554f, 0.440928698f},
-std::array<float,2>{0.806883216f, 0.738780856f},
-std::array<float,2>{0.544728398f, 0.152577683f},
-std::array<float,2>{0.265493631f, 0.88096267f},
-std::array<float,2>{0.484032571f, 0.0992839038f},
-std::array<float,2>{0.703445911f, 0.785354793f},
-std::array<float,2>{0.877714574f, 0.351119965f},
-std::array<float,2>{0.0465915203f, 0.550451875f},
-std::array<float,2>{0.354084462f, 0.305131704f},
-std::array<float,2>{0.610233665f, 0.624692321f},
-std::array<float,2>{0.841720343f, 0.0237022545f},
-std::array<float,2>{0.212077156f, 0.825655401f},
-std::array<float,2>{0.0731622949f, 0.213612899f},
-std::array<float,2>{0.953169584f, 0.998768389f},
-std::array<float,2>{0.635072947f, 0.399188042f},
-std::array<float,2>{0.394635379f, 0.644156933f},
-std::array<float,2>{0.0346912183f, 0.499744862f},
-std::array<float,2>{0.885902762f, 0.70695287f},
-std::array<float,2>{0.714533031f, 0.165006623f},
-std::array<float,2>{0.469641626f, 0.925017059f},
-std::array<float,2>{0.255803019f, 0.0783053711f},
-std::array<float,2>{0.531963706f, 0.776414752f},
-std::array<float,2>{0.799678326f, 0.338565916f},
-std::array<float,2>{0.154254183f, 0.515448451f},
-std::array<float,2>{0.39882654f, 0.278140098f},
-std::array<float,2>{0.626365364f, 0.581662655f},
-std::array<float,2>{0.966890037f, 0.0514929518f},
-std::array<float,2>{0.0651760623f, 0.857657909f},
-std::array<float,2>{0.209829092f, 0.249359593f},
-std::array<float,2>{0.833800435f, 0.965393722f},
-std::array<float,2>{0.61725688f, 0.408394605f},
-std::array<float,2>{0.345722258f, 0.665083826f},
-std::array<float,2>{0.170306697f, 0.353598088f},
-std::array<float,2>{0.763512313f, 0.560168028f},
-std::array<float,2>{0.525273442f, 0.104687743f},
-std::array<float,2>{0.310055882f, 0.79523021f},
-std::array<float,2>{0.456659526f, 0.144771665f},
-std::array<float,2>{0.746619403f, 0.885278821f},
-std::array<float,2>{0.927476227f, 0.445653379f},
-std::array<float,2>{0.0236441903f, 0.748357236f},
-std::array<float,2>{0.317320943f, 0.397091061f},
-std::array<float,2>{0.591709077f, 0.656165242f},
-std::array<float,2>{0.862833321f, 0.209152773f},
-std::array<float,2>{0.233671084f, 0.989620566f},
-std::array<float,2>{0.100396186f, 0.0159788337f},
-std::array<float,2>{0.996819854f, 0.814565539f},
-std::array<float,2>{0.665105641f, 0.301222861f},
-std::array<float,2>{0.432110071f, 0.609885037f},
-std::array<float,2>{0.0791798458f, 0.283218503f},
-std::array<float,2>{0.953119099f, 0.604596972f},
-std::array<float,2>{0.645877421f, 0.00705448259f},
-std::array<float,2>{0.384829879f, 0.832625151f},
-std::array<float,2>{0.371392012f, 0.20122619f},
-std::array<float,2>{0.609294415f, 0.977869868f},
-std::array<float,2>{0.813686669f, 0.387457639f},
-std::array<float,2>{0.197599694f, 0.627541661f},
-std::array<float,2>{0.492281914f, 0.463040024f},
-std::array<float,2>{0.694118619f, 0.723575652f},
-std::array<float,2>{0.896727443f, 0.132278845f},
-std::array<float,2>{0.0516706593f, 0.903416574f},
-std::array<float,2>{0.126269341f, 0.115692422f},
-std::array<float,2>{0.786927342f, 0.798836231f},
-std::array<float,2>{0.559138656f, 0.362528503f},
-std::array<float,2>{0.266821146f, 0.543902814f},
-std::array<float,2>{0.236057833f, 0.434127897f},
-std::array<float,2>{0.845398605f, 0.686897933f},
-std::array<float,2>{0.564327002f, 0.22379677f},
-std::array<float,2>{0.332922161f, 0.937786341f},
-std::array<float,2>{0.419843376f, 0.0369161144f},
-std::array<float,2>{0.67870748f, 0.873238742f},
-std::array<float,2>{0.980046034f, 0.259259105f},
-std::array<float,2>{0.112748377f, 0.56671226f},
-std::array<float,2>{0.289233088f, 0.316865653f},
-std::array<float,2>{0.510043025f, 0.524812222f},
-std::array<float,2>{0.765705764f, 0.0779611096f},
-std::array<float,2>{0.175622985f, 0.760197878f},
-std::array<float,2>{0.0099399928f, 0.18581304f},
-std::array<float,2>{0.912040234f, 0.920922875f},
-std::array<float,2>{0.725764155f, 0.475443989f},
-std::array<float,2>{0.443847001f, 0.69388032f},
-std::array<float,2>{0.0574178249f, 0.392634273f},
-std::array<float,2>{0.898445606f, 0.650200367f},
-std::array<float,2>{0.702993214f, 0.203242749f},
-std::array<float,2>{0.484793872f, 0.984533727f},
-std::array<float,2>{0.278164268f, 0.0231624581f},
-std::array<float,2>{0.554506838f, 0.816852689f},
-std::array<float,2>{0.794816434f, 0.297135144f},
-std::array<float,2>{0.133651704f, 0.615256488f},
-std::array<float,2>{0.380332828f, 0.358124226f},
-std::array<float,2>{0.654768586f, 0.556379437f},
-std::array<float,2>{0.939053714f, 0.108486004f},
-std::array<float,2>{0.0893746763f, 0.79203558f},
-std::array<float,2>{0.192576468f, 0.142232135f},
-std::array<float,2>{0.826502979f, 0.887931883f},
-std::array<float,2>{0.5993011f, 0.451206446f},
-std::array<float,2>{0.362944245f, 0.742929697f},
-std::array<float,2>{0.186347127f, 0.274651647f},
-std::array<float,2>{0.773696065f, 0.582044959f},
-std::array<float,2>{0.504476726f, 0.0480378233f},
-std::array<float,2>{0.282544523f, 0.855198145f},
-std::array<float,2>{0.446807772f, 0.242996186f},
-std::array<float,2>{0.72810179f, 0.962613404f},
-std::array<float,2>{0.92121923f, 0.412661046f},
-std::array<float,2>{0.00191689853f, 0.670684695f},
-std::array<float,2>{0.336869925f, 0.494686127f},
-std::array<float,2>{0.575437844f, 0.707368731f},
-std::array<float,2>{0.855965137f, 0.171823293f},
-std::array<float,2>{0.24235642f, 0.928780258f},
-std::array<float,2>{0.123179778f, 0.0823776275f},
-std::array<float,2>{0.968852878f, 0.779756367f},
-std::array<float,2>{0.679884791f, 0.341639012f},
-std::array<float,2>{0.407033026f, 0.507963538f},
-std::array<float,2>{0.0773211643f, 0.316355795f},
-std::array<float,2>{0.957494855f, 0.530213714f},
-std::array<float,2>{0.640161216f, 0.0717775896f},
-std::array<float,2>{0.391110718f, 0.762521446f},
-std::array<float,2>{0.357905656f, 0.183499232f},
-std::array<float,2>{0.61405468f, 0.916937888f},
-std::array<float,2>{0.838344991f, 0.471768975f},
-std::array<float,2>{0.218641281f, 0.689011216f},
-std::array<float,2>{0.47702983f, 0.433129758f},
-std::array<float,2>{0.707892537f, 0.68140322f},
-std::array<float,2>{0.879275382f, 0.221006185f},
-std::array<float,2>{0.0421758555f, 0.942991674f},
-std::array<float,2>{0.140641108f, 0.0313897617f},
-std::array<float,2>{0.809951365f, 0.867687523f},
-std::array<float,2>{0.539838314f, 0.263017386f},
-std::array<float,2>{0.259424955f, 0.562931418f},
-std::array<float,2>{0.219402686f, 0.466450959f},
-std::array<float,2>{0.871715248f, 0.72244668f},
-std::array<float,2>{0.581629694f, 0.125404596f},
-std::array<float,2>{0.322243392f, 0.898661494f},
-std::array<float,2>{0.426554471f, 0.109418809f},
-std::array<float,2>{0.662492633f, 0.801172197f},
-std::array<float,2>{0.989922106f, 0.366882831f},
-std::array<float,2>{0.108568996f, 0.541457891f},
-std::array<float,2>{0.304448992f, 0.287064999f},
-std::array<float,2>{0.52223134f, 0.607582927f},
-std::array<float,2>{0.751889944f, 0.000215270658f},
-std::array<float,2>{0.163049266f, 0.828294933f},
-std::array<float,2>{0.015877001f, 0.195627689f},
-std::array<float,2>{0.933145821f, 0.982598186f},
-std::array<float,2>{0.73608923f, 0.38579151f},
-std::array<float,2>{0.468486458f, 0.629689813f},
-std::array<float,2>{0.0950615257f, 0.481795073f},
-std::array<float,2>{0.992806315f, 0.701943815f},
-std::array<float,2>{0.668929279f, 0.176343918f},
-std::array<float,2>{0.434388101f, 0.911431909f},
-std::array<float,2>{0.313148379f, 0.0680483282f},
-std::array<float,2>{0.587664664f, 0.755373716f},
-std::array<float,2>{0.866389692f, 0.322667241f},
-std::array<float,2>{0.229820162f, 0.522796988f},
-std::array<float,2>{0.45973137f, 0.253030926f},
-std::array<float,2>{0.745096564f, 0.577421069f},
-std::array<float,2>{0.924100697f, 0.0449742265f},
-std::array<float,2>{0.0288533643f, 0.860903502f},
-std::array<float,2>{0.164294377f, 0.231301367f},
-std::array<float,2>{0.759045482f, 0.945459306f},
-std::array<float,2>{0.527645528f, 0.424223632f},
-std::array<float,2>{0.305139691f, 0.674490631f},
-std::array<float,2>{0.20402357f, 0.372319102f},
-std::array<float,2>{0.831044674f, 0.535844505f},
-std::array<float,2>{0.623313427f, 0.119421072f},
-std::array<float,2>{0.349050492f, 0.806876779f},
-std::array<float,2>{0.4026649f, 0.134730682f},
-std::array<float,2>{0.632689536f, 0.892932117f},
-std::array<float,2>{0.961864293f, 0.453652322f},
-std::array<float,2>{0.0674739257f, 0.72871381f},
-std::array<float,2>{0.250635177f, 0.382215232f},
-std::array<float,2>{0.535346687f, 0.634235024f},
-std::array<float,2>{0.802649319f, 0.190885767f},
-std::array<float,2>{0.150786459f, 0.973062515f},
-std::array<float,2>{0.0374416746f, 0.00831099693f},
-std::array<float,2>{0.890013039f, 0.841773748f},
-std::array<float,2>{0.715813041f, 0.292318702f},
-std::array<float,2>{0.47393766f, 0.597786248f},
-std::array<float,2>{0.0123209236f, 0.31058991f},
-std::array<float,2>{0.909485519f, 0.618510008f},
-std::array<float,2>{0.7194556f, 0.0296094362f},
-std::array<float,2>{0.437859893f, 0.821909308f},
-std::array<float,2>{0.294916153f, 0.216587737f},
-std::array<float,2>{0.513064086f, 0.992891073f},
-std::array<float,2>{0.770406425f, 0.405168742f},
-std::array<float,2>{0.177066222f, 0.644963264f},
-std::array<float,2>{0.417865425f, 0.444055617f},
-std::array<float,2>{0.673621297f, 0.738219202f},
-std::array<float,2>{0.981295884f, 0.151682377f},
-std::array<float,2>{0.113430403f, 0.876826286f},
-std::array<float,2>{0.24112384f, 0.0960669741f},
-std::array<float,2>{0.849753678f, 0.783460617f},
-std::array<float,2>{0.567567825f, 0.343995333f},
-std::array<float,2>{0.329875201f, 0.552686095f},
-std::array<float,2>{0.12891379f, 0.420823604f},
-std::array<float,2>{0.78365612f, 0.658596516f},
-std::array<float,2>{0.558084309f, 0.240007654f},
-std::array<float,2>{0.272326231f, 0.955347657f},
-std::array<float,2>{0.497863501f, 0.0581173263f},
-std::array<float,2>{0.690010428f, 0.847960889f},
-std::array<float,2>{0.893223941f, 0.269043863f},
-std::array<float,2>{0.0496594124f, 0.590163648f},
-std::array<float,2>{0.370701283f, 0.330874115f},
-std::array<float,2>{0.604760051f, 0.504364133f},
-std::array<float,2>{0.818900585f, 0.0882446766f},
-std::array<float,2>{0.200163007f, 0.772885799f},
-std::array<float,2>{0.0850462168f, 0.163561657f},
-std::array<float,2>{0.94866401f, 0.93437016f},
-std::array<float,2>{0.643580317f, 0.484681875f},
-std::array<float,2>{0.390185595f, 0.71513164f},
-std::array<float,2>{0.090021506f, 0.426009893f},
-std::array<float,2>{0.942357957f, 0.678863466f},
-std::array<float,2>{0.652101517f, 0.228004634f},
-std::array<float,2>{0.376178712f, 0.952935338f},
-std::array<float,2>{0.363355905f, 0.0394078754f},
-std::array<float,2>{0.596622109f, 0.866438508f},
-std::array<float,2>{0.822123349f, 0.255299509f},
-std::array<float,2>{0.189513594f, 0.573700666f},
-std::array<float,2>{0.491025269f, 0.32455647f},
-std::array<float,2>{0.698711395f, 0.518805385f},
-std::array<float,2>{0.902698755f, 0.064217262f},
-std::array<float,2>{0.0607169494f, 0.752186f},
-std::array<float,2>{0.137289464f, 0.173512384f},
-std::array<float,2>{0.789744318f, 0.909635842f},
-std::array<float,2>{0.549734533f, 0.477692693f},
-std::array<float,2>{0.275489271f, 0.699206591f},
-std::array<float,2>{0.248475164f, 0.294020504f},
-std::array<float,2>{0.851996362f, 0.596800089f},
-std::array<float,2>{0.572020769f, 0.0140323658f},
-std::array<float,2>{0.342273384f, 0.835984409f},
-std::array<float,2>{0.411249548f, 0.191938967f},
-std::array<float,2>{0.685575545f, 0.970957518f},
-std::array<float,2>{0.974683285f, 0.378257841f},
-std::array<float,2>{0.118951522f, 0.639345229f},
-std::array<float,2>{0.286368847f, 0.457300842f},
-std::array<float,2>{0.502670705f, 0.731301486f},
-std::array<float,2>{0.779808581f, 0.137294441f},
-std::array<float,2>{0.183058381f, 0.897787392f},
-std::array<float,2>{0.00539787579f, 0.121625923f},
-std::array<float,2>{0.917815208f, 0.810402691f},
-std::array<float,2>{0.730973184f, 0.370926112f},
-std::array<float,2>{0.452825665f, 0.534546435f},
-std::array<float,2>{0.044604715f, 0.347949743f},
-std::array<float,2>{0.875790477f, 0.547000825f},
-std::array<float,2>{0.70666784f, 0.099755913f},
-std::array<float,2>{0.482098997f, 0.787700713f},
-std::array<float,2>{0.262157053f, 0.155307665f},
-std::array<float,2>{0.545594096f, 0.879541755f},
-std::array<float,2>{0.805417299f, 0.439448774f},
-std::array<float,2>{0.145428404f, 0.741769373f},
-std::array<float,2>{0.397200435f, 0.402080983f},
-std::array<float,2>{0.633586884f, 0.641982019f},
-std::array<float,2>{0.956408024f, 0.212435678f},
-std::array<float,2>{0.0711722523f, 0.996243954f},
-std::array<float,2>{0.214544445f, 0.0266566314f},
-std::array<float,2>{0.842264652f, 0.827165842f},
-std::array<float,2>{0.611985445f, 0.307780653f},
-std::array<float,2>{0.351698488f, 0.62280637f},
-std::array<float,2>{0.156702682f, 0.49051699f},
-std::array<float,2>{0.754604042f, 0.713014424f},
-std::array<float,2>{0.515866637f, 0.156428888f},
-std::array<float,2>{0.299374878f, 0.933340251f},
-std::array<float,2>{0.4617697f, 0.0937081948f},
-std::array<float,2>{0.739682257f, 0.768851638f},
-std::array<float,2>{0.936639309f, 0.335616112f},
-std::array<float,2>{0.0200049728f, 0.50218302f},
-std::array<float,2>{0.326953769f, 0.270081103f},
-std::array<float,2>{0.583888233f, 0.58729738f},
-std::array<float,2>{0.869980931f, 0.0587574989f},
-std::array<float,2>{0.223664612f, 0.84567672f},
-std::array<float,2>{0.102795973f, 0.234948486f},
-std::array<float,2>{0.985535443f, 0.957620025f},
-std::array<float,2>{0.658081532f, 0.417393953f},
-std::array<float,2>{0.424524099f, 0.663044691f},
-std::array<float,2>{0.0257058013f, 0.448341668f},
-std::array<float,2>{0.927924991f, 0.746556878f},
-std::array<float,2>{0.74856627f, 0.146802038f},
-std::array<float,2>{0.454369277f, 0.883726716f},
-std::array<float,2>{0.312487423f, 0.102037802f},
-std::array<float,2>{0.526944995f, 0.79412663f},
-std::array<float,2>{0.764666378f, 0.352214098f},
-std::array<float,2>{0.169013321f, 0.562467098f},
-std::array<float,2>{0.431140542f, 0.303674191f},
-std::array<float,2>{0.666879177f, 0.612485349f},
-std::array<float,2>{0.998519778f, 0.0184051916f},
-std::array<float,2>{0.0994940251f, 0.812591374f},
-std::array<float,2>{0.232137099f, 0.208083227f},
-std::array<float,2>{0.860208094f, 0.990600348f},
-std::array<float,2>{0.591930449f, 0.394920349f},
-std::array<float,2>{0.31941992f, 0.654043913f},
-std::array<float,2>{0.154981837f, 0.337682009f},
-std::array<float,2>{0.798534989f, 0.512676895f},
-std::array<float,2>{0.533509195f, 0.0812253654f},
-std::array<float,2>{0.256438047f, 0.775152028f},
-std::array<float,2>{0.472592562f, 0.166087046f},
-std::array<float,2>{0.71130383f, 0.922867358f},
-std::array<float,2>{0.884246588f, 0.496821642f},
-std::array<float,2>{0.0316162221f, 0.704560518f},
-std::array<float,2>{0.345387667f, 0.407596529f},
-std::array<float,2>{0.619886398f, 0.666432321f},
-std::array<float,2>{0.834091187f, 0.247419432f},
-std::array<float,2>{0.208600938f, 0.966953635f},
-std::array<float,2>{0.063730523f, 0.0534804761f},
-std::array<float,2>{0.966664672f, 0.856458366f},
-std::array<float,2>{0.628140271f, 0.280829608f},
-std::array<float,2>{0.402280539f, 0.579877794f},
-std::array<float,2>{0.109786928f, 0.261521161f},
-std::array<float,2>{0.976961136f, 0.569493532f},
-std::array<float,2>{0.675837278f, 0.0384742245f},
-std::array<float,2>{0.420343578f, 0.871671855f},
-std::array<float,2>{0.33456257f, 0.225412041f},
-std::array<float,2>{0.565841019f, 0.939666629f},
-std::array<float,2>{0.846241057f, 0.435558826f},
-std::array<float,2>{0.237949431f, 0.684716642f},
-std::array<float,2>{0.44153735f, 0.47414878f},
-std::array<float,2>{0.723732114f, 0.692946196f},
-std::array<float,2>{0.913066089f, 0.183960065f},
-std::array<float,2>{0.00968437549f, 0.919537187f},
-std::array<float,2>{0.172462568f, 0.0757788122f},
-std::array<float,2>{0.767721355f, 0.758121014f},
-std::array<float,2>{0.509565651f, 0.318416417f},
-std::array<float,2>{0.292834103f, 0.52732563f},
-std::array<float,2>{0.195463389f, 0.390174747f},
-std::array<float,2>{0.815005183f, 0.626931787f},
-std::array<float,2>{0.60576278f, 0.200109959f},
-std::array<float,2>{0.373880655f, 0.979575098f},
-std::array<float,2>{0.384473592f, 0.00468617445f},
-std::array<float,2>{0.647674561f, 0.834970474f},
-std::array<float,2>{0.950843334f, 0.28300032f},
-std::array<float,2>{0.0811699629f, 0.603265524f},
-std::array<float,2>{0.268135637f, 0.361059904f},
-std::array<float,2>{0.562081277f, 0.545382023f},
-std::array<float,2>{0.788043737f, 0.113625675f},
-std::array<float,2>{0.128099471f, 0.796924114f},
-std::array<float,2>{0.0541592501f, 0.130246192f},
-std::array<float,2>{0.894630909f, 0.905126393f},
-std::array<float,2>{0.691770136f, 0.461317986f},
-std::array<float,2>{0.495069355f, 0.72575444f},
-std::array<float,2>{0.0414700173f, 0.431200951f},
-std::array<float,2>{0.880393147f, 0.683515251f},
-std::array<float,2>{0.708135724f, 0.219890326f},
-std::array<float,2>{0.478397518f, 0.945197403f},
-std::array<float,2>{0.258519679f, 0.0334978253f},
-std::array<float,2>{0.540691912f, 0.869522274f},
-std::array<float,2>{0.808795929f, 0.263765335f},
-std::array<float,2>{0.141928315f, 0.564562023f},
-std::array<float,2>{0.391994476f, 0.312857807f},
-std::array<float,2>{0.639636278f, 0.528193772f},
-std::array<float,2>{0.958435237f, 0.0735658258f},
-std::array<float,2>{0.0767616853f, 0.76454556f},
-std::array<float,2>{0.217674807f, 0.180397421f},
-std::array<float,2>{0.839497864f, 0.915865958f},
-std::array<float,2>{0.614279985f, 0.470243424f},
-std::array<float,2>{0.358581901f, 0.690195322f},
-std::array<float,2>{0.163111374f, 0.287866056f},
-std::array<float,2>{0.750318348f, 0.606366634f},
-std::array<float,2>{0.522703826f, 0.00228528422f},
-std::array<float,2>{0.303167433f, 0.831845999f},
-std::array<float,2>{0.46747008f, 0.199067265f},
-std::array<float,2>{0.734465241f, 0.982399344f},
-std::array<float,2>{0.932100356f, 0.383198589f},
-std::array<float,2>{0.0167526416f, 0.632513702f},
-std::array<float,2>{0.320739537f, 0.467953831f},
-std::array<float,2>{0.581044734f, 0.720227838f},
-std::array<float,2>{0.87228924f, 0.127498806f},
-std::array<float,2>{0.219929591f, 0.901204169f},
-std::array<float,2>{0.108362265f, 0.112063937f},
-std::array<float,2>{0.988536f, 0.803804696f},
-std::array<float,2>{0.663493454f, 0.363889515f},
-std::array<float,2>{0.427513361f, 0.539183557f},
-std::array<float,2>{0.0883845091f, 0.35725522f},
-std::array<float,2>{0.937676191f, 0.557856441f},
-std::array<float,2>{0.655514956f, 0.107404485f},
-std::array<float,2>{0.379206836f, 0.789420128f},
-std::array<float,2>{0.361855358f, 0.142682955f},
-std::array<float,2>{0.597949326f, 0.888825297f},
-std::array<float,2>{0.827715814f, 0.449494749f},
-std::array<float,2>{0.191711098f, 0.744699359f},
-std::array<float,2>{0.485508204f, 0.39236474f},
-std::array<float,2>{0.701411843f, 0.65041703f},
-std::array<float,2>{0.899932027f, 0.20658873f},
-std::array<float,2>{0.0581215508f, 0.987440348f},
-std::array<float,2>{0.134742439f, 0.0209376458f},
-std::array<float,2>{0.793786049f, 0.819690645f},
-std::array<float,2>{0.553100646f, 0.299476206f},
-std::array<float,2>{0.278616697f, 0.614557147f},
-std::array<float,2>{0.244000316f, 0.49294588f},
-std::array<float,2>{0.857360005f, 0.710757971f},
-std::array<float,2>{0.575059831f, 0.168062985f},
-std::array<float,2>{0.337485582f, 0.927412331f},
-std::array<float,2>{0.408065975f, 0.0857803449f},
-std::array<float,2>{0.6815027f, 0.778908849f},
-std::array<float,2>{0.970588028f, 0.342128783f},
-std::array<float,2>{0.124261454f, 0.510224164f},
-std::array<float,2>{0.281890213f, 0.276649475f},
-std::array<float,2>{0.505755782f, 0.584659219f},
-std::array<float,2>{0.775204301f, 0.0503627062f},
-std::array<float,2>{0.186813474f, 0.852972507f},
-std::array<float,2>{0.000240963229f, 0.245741189f},
-std::array<float,2>{0.919988155f, 0.964630544f},
-std::array<float,2>{0.726645768f, 0.410326928f},
-std::array<float,2>{0.445551813f, 0.668399096f},
-std::array<float,2>{0.114754766f, 0.44229573f},
-std::array<float,2>{0.981610358f, 0.735617042f},
-std::array<float,2>{0.672339022f, 0.149287611f},
-std::array<float,2>{0.416061401f, 0.877171755f},
-std::array<float,2>{0.329034448f, 0.0955218971f},
-std::array<float,2>{0.566916287f, 0.782275856f},
-std::array<float,2>{0.851308346f, 0.347200811f},
-std::array<float,2>{0.2420917f, 0.552931428f},
-std::array<float,2>{0.439007998f, 0.308924973f},
-std::array<float,2>{0.720109224f, 0.620827973f},
-std::array<float,2>{0.908717752f, 0.0282079875f},
-std::array<float,2>{0.0136134904f, 0.822526097f},
-std::array<float,2>{0.176422432f, 0.217013061f},
-std::array<float,2>{0.770919919f, 0.994365454f},
-std::array<float,2>{0.512628138f, 0.402988821f},
-std::array<float,2>{0.29380399f, 0.648143351f},
-std::array<float,2>{0.200996444f, 0.329863161f},
-std::array<float,2>{0.819506466f, 0.505988121f},
-std::array<float,2>{0.603974044f, 0.0865732133f},
-std::array<float,2>{0.370034575f, 0.77002126f},
-std::array<float,2>{0.388859451f, 0.161383167f},
-std::array<float,2>{0.642578542f, 0.93697238f},
-std::array<float,2>{0.94745636f, 0.486816168f},
-std::array<float,2>{0.0846233219f, 0.718673766f},
-std::array<float,2>{0.272678822f, 0.418416619f},
-std::array<float,2>{0.557414234f, 0.657528698f},
-std::array<float,2>{0.784838736f, 0.241099238f},
-std::array<float,2>{0.129940167f, 0.954254508f},
-std::array<float,2>{0.0505972803f, 0.0551304594f},
-std::array<float,2>{0.894451857f, 0.851033449f},
-std::array<float,2>{0.691056609f, 0.265783548f},
-std::array<float,2>{0.496835321f, 0.591857135f},
-std::array<float,2>{0.0275492165f, 0.251568794f},
-std::array<float,2>{0.925146937f, 0.575769186f},
-std::array<float,2>{0.745684087f, 0.0440043919f},
-std::array<float,2>{0.460386664f, 0.861797452f},
-std::array<float,2>{0.305845886f, 0.232665226f},
-std::array<float,2>{0.529231131f, 0.948000848f},
-std::array<float,2>{0.758087397f, 0.422790021f},
-std::array<float,2>{0.165230304f, 0.673538864f},
-std::array<float,2>{0.435061663f, 0.483223706f},
-std::array<float,2>{0.669425786f, 0.699326932f},
-std::array<float,2>{0.993698359f, 0.179402277f},
-std::array<float,2>{0.0941355973f, 0.912122428f},
-std::array<float,2>{0.228946298f, 0.0688501894f},
-std::array<float,2>{0.86563617f, 0.755877614f},
-std::array<float,2>{0.586803257f, 0.321871608f},
-std::array<float,2>{0.314021111f, 0.521028459f},
-std::array<float,2>{0.151688769f, 0.379986703f},
-std::array<float,2>{0.801159203f, 0.635026813f},
-std::array<float,2>{0.536153495f, 0.188245177f},
-std::array<float,2>{0.251909643f, 0.976126313f},
-std::array<float,2>{0.473530084f, 0.0107147163f},
-std::array<float,2>{0.716431141f, 0.843422055f},
-std::array<float,2>{0.8893677f, 0.290528625f},
-std::array<float,2>{0.0381865054f, 0.600517273f},
-std::array<float,2>{0.347871631f, 0.373187542f},
-std::array<float,2>{0.624145091f, 0.538450241f},
-std::array<float,2>{0.831477165f, 0.1174521f},
-std::array<float,2>{0.205001175f, 0.804976881f},
-std::array<float,2>{0.0667476654f, 0.135381684f},
-std::array<float,2>{0.962336421f, 0.891943693f},
-std::array<float,2>{0.631536543f, 0.456297845f},
-std::array<float,2>{0.403608978f, 0.728012621f},
-std::array<float,2>{0.071809724f, 0.400038511f},
-std::array<float,2>{0.955416918f, 0.642981708f},
-std::array<float,2>{0.634240091f, 0.214764729f},
-std::array<float,2>{0.397816598f, 0.999300599f},
-std::array<float,2>{0.352648079f, 0.0248872247f},
-std::array<float,2>{0.613172889f, 0.82448113f},
-std::array<float,2>{0.843324482f, 0.305908591f},
-std::array<float,2>{0.213181883f, 0.624023378f},
-std::array<float,2>{0.480684638f, 0.349700242f},
-std::array<float,2>{0.705488503f, 0.549517512f},
-std::array<float,2>{0.876352668f, 0.0977843404f},
-std::array<float,2>{0.0438432656f, 0.786262035f},
-std::array<float,2>{0.146447137f, 0.153567925f},
-std::array<float,2>{0.806450844f, 0.882410347f},
-std::array<float,2>{0.54598242f, 0.440220952f},
-std::array<float,2>{0.263337076f, 0.739559889f},
-std::array<float,2>{0.223104224f, 0.271493375f},
-std::array<float,2>{0.870796323f, 0.588329434f},
-std::array<float,2>{0.582188249f, 0.0620608814f},
-std::array<float,2>{0.327675939f, 0.846590638f},
-std::array<float,2>{0.425666243f, 0.23779434f},
-std::array<float,2>{0.657093346f, 0.959010959f},
-std::array<float,2>{0.985226393f, 0.4153561f},
-std::array<float,2>{0.102042101f, 0.661688685f},
-std::array<float,2>{0.300440729f, 0.489675462f},
-std::array<float,2>{0.516753078f, 0.711405039f},
-std::array<float,2>{0.754991412f, 0.158497736f},
-std::array<float,2>{0.157685369f, 0.93026191f},
-std::array<float,2>{0.0214442238f, 0.0915764123f},
-std::array<float,2>{0.935591757f, 0.766601026f},
-std::array<float,2>{0.738298893f, 0.333339453f},
-std::array<float,2>{0.462019831f, 0.50044167f},
-std::array<float,2>{0.062386822f, 0.327898651f},
-std::array<float,2>{0.903541148f, 0.516714275f},
-std::array<float,2>{0.697320819f, 0.0644838884f},
-std::array<float,2>{0.49122867f, 0.751060724f},
-std::array<float,2>{0.276640713f, 0.175546542f},
-std::array<float,2>{0.550264716f, 0.9073928f},
-std::array<float,2>{0.79028374f, 0.480314374f},
-std::array<float,2>{0.137747884f, 0.696409106f},
-std::array<float,2>{0.375482947f, 0.428889573f},
-std::array<float,2>{0.650437832f, 0.675833285f},
-std::array<float,2>{0.942700267f, 0.229467452f},
-std::array<float,2>{0.0916756839f, 0.950933754f},
-std::array<float,2>{0.191184178f, 0.0428961292f},
-std::array<float,2>{0.820525467f, 0.863433242f},
-std::array<float,2>{0.596996248f, 0.25731197f},
-std::array<float,2>{0.36496529f, 0.571775973f},
-std::array<float,2>{0.181902632f, 0.460082173f},
-std::array<float,2>{0.780614018f, 0.733825326f},
-std::array<float,2>{0.503265202f, 0.139099732f},
-std::array<float,2>{0.285792291f, 0.896169662f},
-std::array<float,2>{0.45121485f, 0.124199167f},
-std::array<float,2>{0.732184529f, 0.810916245f},
-std::array<float,2>{0.916975796f, 0.369140476f},
-std::array<float,2>{0.00451871194f, 0.533103466f},
-std::array<float,2>{0.342937827f, 0.29617545f},
-std::array<float,2>{0.570831835f, 0.594206929f},
-std::array<float,2>{0.853431582f, 0.0123787047f},
-std::array<float,2>{0.249074131f, 0.839768291f},
-std::array<float,2>{0.117749721f, 0.195307896f},
-std::array<float,2>{0.975694954f, 0.970173657f},
-std::array<float,2>{0.687407076f, 0.37591508f},
-std::array<float,2>{0.410521686f, 0.636831939f},
-std::array<float,2>{0.00840858929f, 0.476064056f},
-std::array<float,2>{0.913138568f, 0.694435716f},
-std::array<float,2>{0.723079383f, 0.18723537f},
-std::array<float,2>{0.443281174f, 0.920567036f},
-std::array<float,2>{0.291061968f, 0.0768813342f},
-std::array<float,2>{0.508012056f, 0.760970771f},
-std::array<float,2>{0.769147694f, 0.317903459f},
-std::array<float,2>{0.173269719f, 0.52364105f},
-std::array<float,2>{0.421714336f, 0.258660227f},
-std::array<float,2>{0.677630663f, 0.567419171f},
-std::array<float,2>{0.978308976f, 0.0352793932f},
-std::array<float,2>{0.110771716f, 0.874303281f},
-std::array<float,2>{0.237146169f, 0.222992048f},
-std::array<float,2>{0.846973717f, 0.939313531f},
-std::array<float,2>{0.565074325f, 0.434960693f},
-std::array<float,2>{0.335002303f, 0.68587482f},
-std::array<float,2>{0.12749587f, 0.361839443f},
-std::array<float,2>{0.789038539f, 0.544374704f},
-std::array<float,2>{0.561224282f, 0.116675399f},
-std::array<float,2>{0.268909156f, 0.800202966f},
-std::array<float,2>{0.495798647f, 0.131697819f},
-std::array<float,2>{0.692644477f, 0.903048635f},
-std::array<float,2>{0.896154523f, 0.46432367f},
-std::array<float,2>{0.0533204451f, 0.72405225f},
-std::array<float,2>{0.374270797f, 0.388157755f},
-std::array<float,2>{0.606642902f, 0.628097057f},
-std::array<float,2>{0.816134691f, 0.203104496f},
-std::array<float,2>{0.19694528f, 0.976740122f},
-std::array<float,2>{0.0800959095f, 0.00600546738f},
-std::array<float,2>{0.949893415f, 0.833163559f},
-std::array<float,2>{0.64712733f, 0.284966975f},
-std::array<float,2>{0.383283645f, 0.603803933f},
-std::array<float,2>{0.0978764519f, 0.302628011f},
-std::array<float,2>{0.999662161f, 0.610838056f},
-std::array<float,2>{0.667114079f, 0.016862195f},
-std::array<float,2>{0.429954559f, 0.815785706f},
-std::array<float,2>{0.31893754f, 0.210078746f},
-std::array<float,2>{0.593007386f, 0.988555491f},
-std::array<float,2>{0.861272991f, 0.397477806f},
-std::array<float,2>{0.230512589f, 0.654910624f},
-std::array<float,2>{0.453433961f, 0.446804792f},
-std::array<float,2>{0.749799669f, 0.749119103f},
-std::array<float,2>{0.929113328f, 0.145530611f},
-std::array<float,2>{0.0269569792f, 0.886339724f},
-std::array<float,2>{0.168374866f, 0.104099236f},
-std::array<float,2>{0.763998508f, 0.796706855f},
-std::array<float,2>{0.526184142f, 0.355335951f},
-std::array<float,2>{0.311354727f, 0.559279561f},
-std::array<float,2>{0.207065955f, 0.409851223f},
-std::array<float,2>{0.835737526f, 0.664305389f},
-std::array<float,2>{0.620570362f, 0.248126641f},
-std::array<float,2>{0.34438324f, 0.96679461f},
-std::array<float,2>{0.400752902f, 0.0519463904f},
-std::array<float,2>{0.627620161f, 0.858569503f},
-std::array<float,2>{0.964968681f, 0.278888196f},
-std::array<float,2>{0.0628406182f, 0.580279171f},
-std::array<float,2>{0.257310748f, 0.339444429f},
-std::array<float,2>{0.534850955f, 0.514002979f},
-std::array<float,2>{0.797700763f, 0.0791523084f},
-std::array<float,2>{0.155666962f, 0.775597751f},
-std::array<float,2>{0.0322924256f, 0.165370211f},
-std::array<float,2>{0.883705497f, 0.924158216f},
-std::array<float,2>{0.712543488f, 0.498440623f},
-std::array<float,2>{0.470784843f, 0.705639064f},
-std::array<float,2>{0.0189449545f, 0.385344595f},
-std::array<float,2>{0.931412935f, 0.630190313f},
-std::array<float,2>{0.737805188f, 0.197186604f},
-std::array<float,2>{0.466692388f, 0.984353125f},
-std::array<float,2>{0.302527636f, 0.00123580871f},
-std::array<float,2>{0.521113753f, 0.829750776f},
-std::array<float,2>{0.752967894f, 0.286089361f},
-std::array<float,2>{0.160584956f, 0.608873069f},
-std::array<float,2>{0.429492056f, 0.365330756f},
-std::array<float,2>{0.661459148f, 0.542834044f},
-std::array<float,2>{0.991798937f, 0.110681705f},
-std::array<float,2>{0.106866881f, 0.802081704f},
-std::array<float,2>{0.222151294f, 0.126502872f},
-std::array<float,2>{0.873125017f, 0.899746418f},
-std::array<float,2>{0.579611719f, 0.465108275f},
-std::array<float,2>{0.322439283f, 0.720768213f},
-std::array<float,2>{0.14330332f, 0.261920631f},
-std::array<float,2>{0.811995983f, 0.563981891f},
-std::array<float,2>{0.542710066f, 0.0329242349f},
-std::array<float,2>{0.260485351f, 0.868772328f},
-std::array<float,2>{0.478598297f, 0.22241503f},
-std::array<float,2>{0.709046602f, 0.941444218f},
-std::array<float,2>{0.881034732f, 0.432022661f},
-std::array<float,2>{0.0409986153f, 0.680176377f},
-std::array<float,2>{0.356778234f, 0.470952064f},
-std::array<float,2>{0.615447044f, 0.687746167f},
-std::array<float,2>{0.837177932f, 0.18218413f},
-std::array<float,2>{0.215933412f, 0.917203605f},
-std::array<float,2>{0.0754743218f, 0.071088016f},
-std::array<float,2>{0.959562659f, 0.762889504f},
-std::array<float,2>{0.638506651f, 0.31464988f},
-std::array<float,2>{0.393197149f, 0.530650139f},
-std::array<float,2>{0.121749096f, 0.340262413f},
-std::array<float,2>{0.970863938f, 0.509457171f},
-std::array<float,2>{0.682985187f, 0.083776325f},
-std::array<float,2>{0.409351677f, 0.781003714f},
-std::array<float,2>{0.338640362f, 0.170887589f},
-std::array<float,2>{0.577676654f, 0.928535819f},
-std::array<float,2>{0.857723594f, 0.495570332f},
-std::array<float,2>{0.245204583f, 0.708829343f},
-std::array<float,2>{0.447701871f, 0.413198739f},
-std::array<float,2>{0.730213344f, 0.671044648f},
-std::array<float,2>{0.91906333f, 0.24350822f},
-std::array<float,2>{0.0027716253f, 0.961150944f},
-std::array<float,2>{0.184094638f, 0.0477403663f},
-std::array<float,2>{0.775723875f, 0.854165554f},
-std::array<float,2>{0.507269859f, 0.273507446f},
-std::array<float,2>{0.284989983f, 0.583669305f},
-std::array<float,2>{0.194484651f, 0.453043342f},
-std::array<float,2>{0.824550629f, 0.743224263f},
-std::array<float,2>{0.601222396f, 0.141530395f},
-std::array<float,2>{0.361242533f, 0.887529314f},
-std::array<float,2>{0.380937308f, 0.10786026f},
-std::array<float,2>{0.652370214f, 0.791847587f},
-std::array<float,2>{0.939865172f, 0.358462334f},
-std::array<float,2>{0.0877332464f, 0.5550614f},
-std::array<float,2>{0.281245351f, 0.298472911f},
-std::array<float,2>{0.551873565f, 0.616869748f},
-std::array<float,2>{0.796120703f, 0.0224355794f},
-std::array<float,2>{0.135330483f, 0.818297863f},
-std::array<float,2>{0.0565607585f, 0.204594523f},
-std::array<float,2>{0.90052563f, 0.985565901f},
-std::array<float,2>{0.699251115f, 0.39388597f},
-std::array<float,2>{0.487166911f, 0.648992121f},
-std::array<float,2>{0.0831943378f, 0.486210644f},
-std::array<float,2>{0.945403337f, 0.716475189f},
-std::array<float,2>{0.642355144f, 0.162687823f},
-std::array<float,2>{0.386926264f, 0.934597135f},
-std::array<float,2>{0.369039178f, 0.089134641f},
-std::array<float,2>{0.602240205f, 0.771527886f},
-std::array<float,2>{0.818224669f, 0.331758529f},
-std::array<float,2>{0.203088552f, 0.505307138f},
-std::array<float,2>{0.499553382f, 0.268265694f},
-std::array<float,2>{0.688433886f, 0.591405034f},
-std::array<float,2>{0.891252339f, 0.0572369397f},
-std::array<float,2>{0.0478539839f, 0.84910816f},
-std::array<float,2>{0.130985916f, 0.238998353f},
-std::array<float,2>{0.781968534f, 0.956898987f},
-std::array<float,2>{0.55628109f, 0.421603799f},
-std::array<float,2>{0.270754188f, 0.65968895f},
-std::array<float,2>{0.239915073f, 0.345673829f},
-std::array<float,2>{0.848171473f, 0.551066995f},
-std::array<float,2>{0.5703125f, 0.0972513855f},
-std::array<float,2>{0.33073777f, 0.784588933f},
-std::array<float,2>{0.415874422f, 0.150962159f},
-std::array<float,2>{0.674452186f, 0.875131667f},
-std::array<float,2>{0.984013557f, 0.444869369f},
-std::array<float,2>{0.116669782f, 0.737002313f},
-std::array<float,2>{0.296683758f, 0.40561682f},
-std::array<float,2>{0.514395356f, 0.645959496f},
-std::array<float,2>{0.772834599f, 0.215302035f},
-std::array<float,2>{0.179254934f, 0.993781447f},
-std::array<float,2>{0.0154961087f, 0.0304474998f},
-std::array<float,2>{0.906629622f, 0.82095319f},
-std::array<float,2>{0.72071743f, 0.312386692f},
-std::array<float,2>{0.441207588f, 0.617565274f},
-std::array<float,2>{0.0363258682f, 0.291518331f},
-std::array<float,2>{0.887417972f, 0.598847687f},
-std::array<float,2>{0.718006194f, 0.0088306861f},
-std::array<float,2>{0.476020187f, 0.839857161f},
-std::array<float,2>{0.253640473f, 0.189538851f},
-std::array<float,2>{0.537397385f, 0.973821342f},
-std::array<float,2>{0.804399312f, 0.381813496f},
-std::array<float,2>{0.148937464f, 0.633042812f},
-std::array<float,2>{0.404392183f, 0.454776794f},
-std::array<float,2>{0.629196942f, 0.72990489f},
-std::array<float,2>{0.964183927f, 0.133304447f},
-std::array<float,2>{0.0691605434f, 0.893660903f},
-std::array<float,2>{0.20667921f, 0.120996661f},
-std::array<float,2>{0.828135133f, 0.808380306f},
-std::array<float,2>{0.621360719f, 0.371409118f},
-std::array<float,2>{0.350553513f, 0.536674976f},
-std::array<float,2>{0.166903242f, 0.42537275f},
-std::array<float,2>{0.761220872f, 0.675278306f},
-std::array<float,2>{0.530972302f, 0.232142776f},
-std::array<float,2>{0.306816757f, 0.946763754f},
-std::array<float,2>{0.457628727f, 0.0466492847f},
-std::array<float,2>{0.743207395f, 0.860249996f},
-std::array<float,2>{0.922588825f, 0.252622724f},
-std::array<float,2>{0.029942384f, 0.576427698f},
-std::array<float,2>{0.315513134f, 0.323718429f},
-std::array<float,2>{0.588975191f, 0.522375762f},
-std::array<float,2>{0.86457473f, 0.0672976896f},
-std::array<float,2>{0.226720929f, 0.754459977f},
-std::array<float,2>{0.0967168882f, 0.177732006f},
-std::array<float,2>{0.995889544f, 0.910770714f},
-std::array<float,2>{0.671362102f, 0.480914682f},
-std::array<float,2>{0.436070234f, 0.702238858f},
-std::array<float,2>{0.104609556f, 0.416809529f},
-std::array<float,2>{0.988129199f, 0.663511276f},
-std::array<float,2>{0.659178853f, 0.235485449f},
-std::array<float,2>{0.422438204f, 0.958450794f},
-std::array<float,2>{0.326029956f, 0.0598976016f},
-std::array<float,2>{0.58524543f, 0.844332337f},
-std::array<float,2>{0.869018435f, 0.270597011f},
-std::array<float,2>{0.226544723f, 0.586236179f},
-std::array<float,2>{0.463505089f, 0.334226817f},
-std::array<float,2>{0.740548968f, 0.503258407f},
-std::array<float,2>{0.935498357f, 0.092194885f},
-std::array<float,2>{0.0221006814f, 0.768439412f},
-std::array<float,2>{0.159810841f, 0.157626227f},
-std::array<float,2>{0.756439984f, 0.93247664f},
-std::array<float,2>{0.519039094f, 0.49174723f},
-std::array<float,2>{0.297718018f, 0.714807332f},
-std::array<float,2>{0.211139053f, 0.30732289f},
-std::array<float,2>{0.840349674f, 0.621307552f},
-std::array<float,2>{0.611209512f, 0.0263031833f},
-std::array<float,2>{0.354947001f, 0.826466978f},
-std::array<float,2>{0.395782083f, 0.211603999f},
-std::array<float,2>{0.636205196f, 0.997574389f},
-std::array<float,2>{0.954195619f, 0.400518537f},
-std::array<float,2>{0.0733600333f, 0.641279817f},
-std::array<float,2>{0.263967276f, 0.437823355f},
-std::array<float,2>{0.543600678f, 0.740627348f},
-std::array<float,2>{0.808288336f, 0.154588848f},
-std::array<float,2>{0.146939337f, 0.880102754f},
-std::array<float,2>{0.0451192893f, 0.100872375f},
-std::array<float,2>{0.878884375f, 0.788175821f},
-std::array<float,2>{0.705043793f, 0.349241674f},
-std::array<float,2>{0.482847959f, 0.548539937f},
-std::array<float,2>{0.00704231206f, 0.369853824f},
-std::array<float,2>{0.914645433f, 0.533453047f},
-std::array<float,2>{0.734324932f, 0.122969642f},
-std::array<float,2>{0.450635672f, 0.809243202f},
-std::array<float,2>{0.288463801f, 0.138409391f},
-std::array<float,2>{0.50001508f, 0.897139609f},
-std::array<float,2>{0.778341174f, 0.458315551f},
-std::array<float,2>{0.180449396f, 0.731577635f},
-std::array<float,2>{0.412824571f, 0.377182931f},
-std::array<float,2>{0.685519934f, 0.6396842f},
-std::array<float,2>{0.973605216f, 0.192430839f},
-std::array<float,2>{0.120161302f, 0.972276449f},
-std::array<float,2>{0.2461835f, 0.0150467018f},
-std::array<float,2>{0.854631782f, 0.837156057f},
-std::array<float,2>{0.572403252f, 0.293644905f},
-std::array<float,2>{0.341036528f, 0.596048951f},
-std::array<float,2>{0.138713419f, 0.477164894f},
-std::array<float,2>{0.791516304f, 0.697454333f},
-std::array<float,2>{0.548159301f, 0.172145918f},
-std::array<float,2>{0.274863154f, 0.908818424f},
-std::array<float,2>{0.490149111f, 0.0626951009f},
-std::array<float,2>{0.696572125f, 0.753604233f},
-std::array<float,2>{0.904620051f, 0.325287819f},
-std::array<float,2>{0.0601212792f, 0.517855585f},
-std::array<float,2>{0.366553962f, 0.254518211f},
-std::array<float,2>{0.595375657f, 0.572424531f},
-std::array<float,2>{0.823955297f, 0.040635787f},
-std::array<float,2>{0.189118966f, 0.866127789f},
-std::array<float,2>{0.0922427773f, 0.227345705f},
-std::array<float,2>{0.943724036f, 0.95198673f},
-std::array<float,2>{0.649134159f, 0.427222431f},
-std::array<float,2>{0.378051728f, 0.678637028f},
-std::array<float,2>{0.0522390381f, 0.462105632f},
-std::array<float,2>{0.897853255f, 0.724774063f},
-std::array<float,2>{0.694594979f, 0.129802585f},
-std::array<float,2>{0.494117975f, 0.905396819f},
-std::array<float,2>{0.265690625f, 0.115070894f},
-std::array<float,2>{0.560328007f, 0.798175633f},
-std::array<float,2>{0.786105037f, 0.359671682f},
-std::array<float,2>{0.125372976f, 0.5464378f},
-std::array<float,2>{0.385903567f, 0.281536788f},
-std::array<float,2>{0.645165563f, 0.6016047f},
-std::array<float,2>{0.951182902f, 0.0052192593f},
-std::array<float,2>{0.0786777064f, 0.834194243f},
-std::array<float,2>{0.198687568f, 0.200278506f},
-std::array<float,2>{0.812989175f, 0.979368687f},
-std::array<float,2>{0.607441783f, 0.38943404f},
-std::array<float,2>{0.3727009f, 0.625957787f},
-std::array<float,2>{0.174743205f, 0.319978297f},
-std::array<float,2>{0.766937554f, 0.526134133f},
-std::array<float,2>{0.511594772f, 0.074818626f},
-std::array<float,2>{0.290674388f, 0.759582579f},
-std::array<float,2>{0.44455567f, 0.185314924f},
-std::array<float,2>{0.725033104f, 0.918595076f},
-std::array<float,2>{0.910436571f, 0.473419994f},
-std::array<float,2>{0.0116699999f, 0.69206953f},
-std::array<float,2>{0.333577693f, 0.437467188f},
-std::array<float,2>{0.563057423f, 0.683753967f},
-std::array<float,2>{0.843990982f, 0.225712597f},
-std::array<float,2>{0.234458432f, 0.941313088f},
-std::array<float,2>{0.112263404f, 0.0376281776f},
-std::array<float,2>{0.978693962f, 0.872951448f},
-std::array<float,2>{0.679283261f, 0.260263681f},
-std::array<float,2>{0.418753386f, 0.569090366f},
-std::array<float,2>{0.0662472546f, 0.280027062f},
-std::array<float,2>{0.968248665f, 0.579002619f},
-std::array<float,2>{0.625350714f, 0.0543321036f},
-std::array<float,2>{0.399707496f, 0.85550189f},
-std::array<float,2>{0.347391725f, 0.246214435f},
-std::array<float,2>{0.618988097f, 0.968070924f},
-std::array<float,2>{0.832937717f, 0.406962454f},
-std::array<float,2>{0.210889727f, 0.66767031f},
-std::array<float,2>{0.470695645f, 0.497827291f},
-std::array<float,2>{0.713804722f, 0.703964472f},
-std::array<float,2>{0.885600746f, 0.167629302f},
-std::array<float,2>{0.0339032747f, 0.922468007f},
-std::array<float,2>{0.153220281f, 0.0804084614f},
-std::array<float,2>{0.80076164f, 0.774364769f},
-std::array<float,2>{0.533155859f, 0.336784422f},
-std::array<float,2>{0.254758358f, 0.512861192f},
-std::array<float,2>{0.232878178f, 0.395997316f},
-std::array<float,2>{0.861541867f, 0.652580023f},
-std::array<float,2>{0.590255737f, 0.207303748f},
-std::array<float,2>{0.318150103f, 0.991711617f},
-std::array<float,2>{0.432675183f, 0.0193728078f},
-std::array<float,2>{0.665009975f, 0.813580394f},
-std::array<float,2>{0.997317016f, 0.304609388f},
-std::array<float,2>{0.100916088f, 0.611741602f},
-std::array<float,2>{0.309074223f, 0.353302181f},
-std::array<float,2>{0.524208009f, 0.560663164f},
-std::array<float,2>{0.762541831f, 0.102589481f},
-std::array<float,2>{0.17092824f, 0.793140769f},
-std::array<float,2>{0.0245587341f, 0.147787288f},
-std::array<float,2>{0.926203191f, 0.884467959f},
-std::array<float,2>{0.747144818f, 0.447758049f},
-std::array<float,2>{0.455771327f, 0.747351527f},
-std::array<float,2>{0.0293139182f, 0.4220981f},
-std::array<float,2>{0.922196269f, 0.673009872f},
-std::array<float,2>{0.743970096f, 0.233150885f},
-std::array<float,2>{0.457204908f, 0.947308481f},
-std::array<float,2>{0.307584077f, 0.0445861593f},
-std::array<float,2>{0.530676186f, 0.862200141f},
-std::array<float,2>{0.761541367f, 0.251246095f},
-std::array<float,2>{0.166033491f, 0.575650394f},
-std::array<float,2>{0.435881704f, 0.321303993f},
-std::array<float,2>{0.671771526f, 0.520886779f},
-std::array<float,2>{0.995545268f, 0.068750456f},
-std::array<float,2>{0.0972372442f, 0.756780624f},
-std::array<float,2>{0.227315038f, 0.179156408f},
-std::array<float,2>{0.864929795f, 0.912922323f},
-std::array<float,2>{0.589841545f, 0.482687473f},
-std::array<float,2>{0.315959513f, 0.700116098f},
-std::array<float,2>{0.1484503f, 0.290323913f},
-std::array<float,2>{0.804021716f, 0.599886715f},
-std::array<float,2>{0.537843645f, 0.0101145748f},
-std::array<float,2>{0.253212452f, 0.842865765f},
-std::array<float,2>{0.476542354f, 0.187904298f},
-std::array<float,2>{0.718371868f, 0.976001501f},
-std::array<float,2>{0.88711977f, 0.380679369f},
-std::array<float,2>{0.0368870981f, 0.635325253f},
-std::array<float,2>{0.34975332f, 0.456746638f},
-std::array<float,2>{0.621825993f, 0.728084028f},
-std::array<float,2>{0.828630328f, 0.13502726f},
-std::array<float,2>{0.206344798f, 0.892198503f},
-std::array<float,2>{0.0685278997f, 0.117996082f},
-std::array<float,2>{0.964789212f, 0.805623293f},
-std::array<float,2>{0.62948072f, 0.373903066f},
-std::array<float,2>{0.405004948f, 0.538928568f},
-std::array<float,2>{0.116807133f, 0.347080767f},
-std::array<float,2>{0.983666301f, 0.55336374f},
-std::array<float,2>{0.674226224f, 0.0949834585f},
-std::array<float,2>{0.41531983f, 0.783116341f},
-std::array<float,2>{0.330118775f, 0.148798138f},
-std::array<float,2>{0.569342554f, 0.877668202f},
-std::array<float,2>{0.84782505f, 0.441798389f},
-std::array<float,2>{0.239448607f, 0.736039877f},
-std::array<float,2>{0.440561503f, 0.402650416f},
-std::array<float,2>{0.721526384f, 0.647685409f},
-std::array<float,2>{0.907136977f, 0.217609793f},
-std::array<float,2>{0.0146755157f, 0.994842291f},
-std::array<float,2>{0.17918247f, 0.027451288f},
-std::array<float,2>{0.773089468f, 0.823154867f},
-std::array<float,2>{0.513886929f, 0.309349269f},
-std::array<float,2>{0.296077937f, 0.62056309f},
-std::array<float,2>{0.202402875f, 0.487126231f},
-std::array<float,2>{0.817738056f, 0.717962682f},
-std::array<float,2>{0.60160017f, 0.162036851f},
-std::array<float,2>{0.368388563f, 0.93709743f},
-std::array<float,2>{0.38760528f, 0.0861000568f},
-std::array<float,2>{0.641977549f, 0.769630253f},
-std::array<float,2>{0.946141899f, 0.329144359f},
-std::array<float,2>{0.0836633816f, 0.506701767f},
-std::array<float,2>{0.27139014f, 0.266271532f},
-std::array<float,2>{0.555812895f, 0.592688262f},
-std::array<float,2>{0.781704366f, 0.0554147847f},
-std::array<float,2>{0.131370351f, 0.851558268f},
-std::array<float,2>{0.0484889336f, 0.240378618f},
-std::array<float,2>{0.890732646f, 0.954984546f},
-std::array<float,2>{0.687937856f, 0.4189156f},
-std::array<float,2>{0.499129713f, 0.657906771f},
-std::array<float,2>{0.0873282403f, 0.450111806f},
-std::array<float,2>{0.940349817f, 0.744260848f},
-std::array<float,2>{0.652889729f, 0.143271312f},
-std::array<float,2>{0.381557196f, 0.88935113f},
-std::array<float,2>{0.360510886f, 0.106769368f},
-std::array<float,2>{0.600705743f, 0.789635539f},
-std::array<float,2>{0.824758291f, 0.356500447f},
-std::array<float,2>{0.19496116f, 0.558519065f},
-std::array<float,2>{0.486790687f, 0.299058557f},
-std::array<float,2>{0.700118423f, 0.615200102f},
-std::array<float,2>{0.900978744f, 0.0213980507f},
-std::array<float,2>{0.0560638346f, 0.82017827f},
-std::array<float,2>{0.135139272f, 0.206244409f},
-std::array<float,2>{0.796493471f, 0.988136351f},
-std::array<float,2>{0.552411199f, 0.391644269f},
-std::array<float,2>{0.280366004f, 0.651012838f},
-std::array<float,2>{0.246043622f, 0.342337519f},
-std::array<float,2>{0.857929409f, 0.51029706f},
-std::array<float,2>{0.577429116f, 0.0850136727f},
-std::array<float,2>{0.338103414f, 0.778347194f},
-std::array<float,2>{0.410118043f, 0.168941796f},
-std::array<float,2>{0.683354557f, 0.927037835f},
-std::array<float,2>{0.971675694f, 0.492517799f},
-std::array<float,2>{0.121231765f, 0.710302472f},
-std::array<float,2>{0.284506381f, 0.411023259f},
-std::array<float,2>{0.507652879f, 0.668908477f},
-std::array<float,2>{0.775941432f, 0.245294794f},
-std::array<float,2>{0.183600292f, 0.964177072f},
-std::array<float,2>{0.00225855061f, 0.0501591153f},
-std::array<float,2>{0.919776499f, 0.853424847f},
-std::array<float,2>{0.729534507f, 0.277219415f},
-std::array<float,2>{0.448232591f, 0.584469438f},
-std::array<float,2>{0.040345028f, 0.264326304f},
-std::array<float,2>{0.881601274f, 0.565277338f},
-std::array<float,2>{0.70957166f, 0.0338184536f},
-std::array<float,2>{0.479042649f, 0.869748473f},
-std::array<float,2>{0.259929061f, 0.220434859f},
-std::array<float,2>{0.542102098f, 0.944740534f},
-std::array<float,2>{0.812183678f, 0.430903256f},
-std::array<float,2>{0.142882556f, 0.682942748f},
-std::array<float,2>{0.392614841f, 0.469804198f},
-std::array<float,2>{0.637742758f, 0.689523816f},
-std::array<float,2>{0.959259987f, 0.179804713f},
-std::array<float,2>{0.0761506036f, 0.915347278f},
-std::array<float,2>{0.216629088f, 0.0738298893f},
-std::array<float,2>{0.837609947f, 0.764052868f},
-std::array<float,2>{0.615736842f, 0.313010752f},
-std::array<float,2>{0.357363552f, 0.527571857f},
-std::array<float,2>{0.160672978f, 0.38365683f},
-std::array<float,2>{0.753469467f, 0.632201493f},
-std::array<float,2>{0.520575166f, 0.198621988f},
-std::array<float,2>{0.301860422f, 0.981739342f},
-std::array<float,2>{0.466256946f, 0.00275164237f},
-std::array<float,2>{0.737771213f, 0.831225514f},
-std::array<float,2>{0.931119084f, 0.287200958f},
-std::array<float,2>{0.0193601213f, 0.605686903f},
-std::array<float,2>{0.322835445f, 0.363756001f},
-std::array<float,2>{0.57948035f, 0.539932013f},
-std::array<float,2>{0.873548269f, 0.111382045f},
-std::array<float,2>{0.222450361f, 0.804354966f},
-std::array<float,2>{0.106951155f, 0.127203181f},
-std::array<float,2>{0.991274416f, 0.900517464f},
-std::array<float,2>{0.661903918f, 0.468489081f},
-std::array<float,2>{0.429052651f, 0.719749391f},
-std::array<float,2>{0.101533949f, 0.398312092f},
-std::array<float,2>{0.997993886f, 0.65433234f},
-std::array<float,2>{0.664246559f, 0.210625827f},
-std::array<float,2>{0.433564425f, 0.988874674f},
-std::array<float,2>{0.317656904f, 0.0171819273f},
-std::array<float,2>{0.590572774f, 0.81613034f},
-std::array<float,2>{0.862028301f, 0.302215338f},
-std::array<float,2>{0.233195677f, 0.611101329f},
-std::array<float,2>{0.455467194f, 0.354717255f},
-std::array<float,2>{0.747704268f, 0.559024811f},
-std::array<float,2>{0.926630199f, 0.103927404f},
-std::array<float,2>{0.0249975082f, 0.796298265f},
-std::array<float,2>{0.171583384f, 0.146039337f},
-std::array<float,2>{0.76178503f, 0.886175811f},
-std::array<float,2>{0.523598313f, 0.446462542f},
-std::array<float,2>{0.309200227f, 0.749904275f},
-std::array<float,2>{0.210402131f, 0.278757572f},
-std::array<float,2>{0.832119226f, 0.580566585f},
-std::array<float,2>{0.618549943f, 0.0523262918f},
-std::array<float,2>{0.346702784f, 0.859065711f},
-std::array<float,2>{0.400304973f, 0.248662978f},
-std::array<float,2>{0.625670969f, 0.966070056f},
-std::array<float,2>{0.968546867f, 0.409551829f},
-std::array<float,2>{0.0658434629f, 0.665027916f},
-std::array<float,2>{0.25420928f, 0.4986296f},
-std::array<float,2>{0.532294095f, 0.705309033f},
-std::array<float,2>{0.799881339f, 0.165598229f},
-std::array<float,2>{0.152348518f, 0.924660802f},
-std::array<float,2>{0.0335186385f, 0.0799833983f},
-std::array<float,2>{0.884862125f, 0.776305914f},
-std::array<float,2>{0.713264108f, 0.339243889f},
-std::array<float,2>{0.470006436f, 0.514380336f},
-std::array<float,2>{0.0109446431f, 0.31744495f},
-std::array<float,2>{0.91078037f, 0.524205804f},
-std::array<float,2>{0.72530663f, 0.0761799589f},
-std::array<float,2>{0.44494608f, 0.761683643f},
-std::array<float,2>{0.290496469f, 0.186551973f},
-std::array<float,2>{0.510763288f, 0.919983625f},
-std::array<float,2>{0.767437935f, 0.476493984f},
-std::array<float,2>{0.174014106f, 0.695135176f},
-std::array<float,2>{0.418222368f, 0.43532598f},
-std::array<float,2>{0.678776324f, 0.686427832f},
-std::array<float,2>{0.979020894f, 0.22327064f},
-std::array<float,2>{0.111570187f, 0.938657105f},
-std::array<float,2>{0.235255212f, 0.0356790014f},
-std::array<float,2>{0.84439528f, 0.874629259f},
-std::array<float,2>{0.56288147f, 0.258231908f},
-std::array<float,2>{0.333142102f, 0.568074346f},
-std::array<float,2>{0.125849679f, 0.464416534f},
-std::array<float,2>{0.785438061f, 0.724583566f},
-std::array<float,2>{0.559825599f, 0.131008372f},
-std::array<float,2>{0.266363382f, 0.902823329f},
-std::array<float,2>{0.49347204f, 0.116820097f},
-std::array<float,2>{0.695044398f, 0.800487876f},
-std::array<float,2>{0.898265839f, 0.361480445f},
-std::array<float,2>{0.052250497f, 0.544457555f},
-std::array<float,2>{0.372443497f, 0.284532338f},
-std::array<float,2>{0.607956767f, 0.604384601f},
-std::array<float,2>{0.812624633f, 0.0064314073f},
-std::array<float,2>{0.199175566f, 0.833633482f},
-std::array<float,2>{0.0784409791f, 0.202625409f},
-std::array<float,2>{0.952002287f, 0.977121532f},
-std::array<float,2>{0.644920409f, 0.388476551f},
-std::array<float,2>{0.386353642f, 0.628710687f},
-std::array<float,2>{0.059819594f, 0.479764491f},
-std::array<float,2>{0.904856622f, 0.69685334f},
-std::array<float,2>{0.696887434f, 0.175223738f},
-std::array<float,2>{0.489666551f, 0.907764077f},
-std::array<float,2>{0.2751652f, 0.0651380196f},
-std::array<float,2>{0.548438251f, 0.751648545f},
-std::array<float,2>{0.791452229f, 0.327600926f},
-std::array<float,2>{0.139429986f, 0.517277479f},
-std::array<float,2>{0.378487796f, 0.257587612f},
-std::array<float,2>{0.648800313f, 0.571864188f},
-std::array<float,2>{0.943895698f, 0.0422777459f},
-std::array<float,2>{0.092612952f, 0.864228904f},
-std::array<float,2>{0.188828826f, 0.228666916f},
-std::array<float,2>{0.823629081f, 0.950332522f},
-std::array<float,2>{0.595036566f, 0.429571748f},
-std::array<float,2>{0.366997421f, 0.676478744f},
-std::array<float,2>{0.179803222f, 0.368379235f},
-std::array<float,2>{0.779021323f, 0.532485545f},
-std::array<float,2>{0.500789642f, 0.124773376f},
-std::array<float,2>{0.288980842f, 0.811059117f},
-std::array<float,2>{0.450732648f, 0.139253318f},
-std::array<float,2>{0.733638346f, 0.895859361f},
-std::array<float,2>{0.914101481f, 0.460565507f},
-std::array<float,2>{0.00755146565f, 0.733920693f},
-std::array<float,2>{0.341769338f, 0.375207663f},
-std::array<float,2>{0.57315737f, 0.637284756f},
-std::array<float,2>{0.855329871f, 0.194465905f},
-std::array<float,2>{0.246654049f, 0.970650256f},
-std::array<float,2>{0.120815665f, 0.0121451793f},
-std::array<float,2>{0.972684979f, 0.838996947f},
-std::array<float,2>{0.684624732f, 0.296764106f},
-std::array<float,2>{0.412222385f, 0.594615638f},
-std::array<float,2>{0.0740416944f, 0.306172937f},
-std::array<float,2>{0.954695344f, 0.623149753f},
-std::array<float,2>{0.636600673f, 0.0253635608f},
-std::array<float,2>{0.39614898f, 0.824872911f},
-std::array<float,2>{0.355459243f, 0.213919714f},
-std::array<float,2>{0.610618651f, 0.999564469f},
-std::array<float,2>{0.840160668f, 0.399485916f},
-std::array<float,2>{0.211677909f, 0.643151641f},
-std::array<float,2>{0.483220339f, 0.439470947f},
-std::array<float,2>{0.704467118f, 0.739932358f},
-std::array<float,2>{0.878209293f, 0.15401338f},
-std::array<float,2>{0.0457718335f, 0.881946027f},
-std::array<float,2>{0.147255316f, 0.0982667133f},
-std::array<float,2>{0.807889521f, 0.786760569f},
-std::array<float,2>{0.543206453f, 0.350143671f},
-std::array<float,2>{0.264444858f, 0.549174845f},
-std::array<float,2>{0.225761831f, 0.415985852f},
-std::array<float,2>{0.868410468f, 0.661501169f},
-std::array<float,2>{0.585830986f, 0.2375274f},
-std::array<float,2>{0.325355172f, 0.959863663f},
-std::array<float,2>{0.422123224f, 0.061676193f},
-std::array<float,2>{0.658612132f, 0.846168101f},
-std::array<float,2>{0.987517595f, 0.272266388f},
-std::array<float,2>{0.105208479f, 0.588591397f},
-std::array<float,2>{0.29727909f, 0.333619595f},
-std::array<float,2>{0.519301355f, 0.500515401f},
-std::array<float,2>{0.755935729f, 0.0908900946f},
-std::array<float,2>{0.159538835f, 0.766034722f},
-std::array<float,2>{0.0215905495f, 0.159118086f},
-std::array<float,2>{0.934796691f, 0.929784715f},
-std::array<float,2>{0.740831554f, 0.490166098f},
-std::array<float,2>{0.463175744f, 0.711515486f},
-std::array<float,2>{0.0386814885f, 0.381048769f},
-std::array<float,2>{0.888691843f, 0.633665442f},
-std::array<float,2>{0.716022432f, 0.190355048f},
-std::array<float,2>{0.472705811f, 0.97419256f},
-std::array<float,2>{0.251346022f, 0.00974189769f},
-std::array<float,2>{0.536756277f, 0.840491772f},
-std::array<float,2>{0.801675618f, 0.291099757f},
-std::array<float,2>{0.152062073f, 0.599287271f},
-std::array<float,2>{0.404236466f, 0.372066855f},
-std::array<float,2>{0.631069422f, 0.536514163f},
-std::array<float,2>{0.962754965f, 0.120179944f},
-std::array<float,2>{0.0671060383f, 0.808092833f},
-std::array<float,2>{0.20445095f, 0.132903859f},
-std::array<float,2>{0.831831038f, 0.894100249f},
-std::array<float,2>{0.624801397f, 0.454324543f},
-std::array<float,2>{0.348609179f, 0.730081737f},
-std::array<float,2>{0.165739059f, 0.252028704f},
-std::array<float,2>{0.758559942f, 0.577046514f},
-std::array<float,2>{0.528334856f, 0.0459233187f},
-std::array<float,2>{0.306156754f, 0.859505415f},
-std::array<float,2>{0.460514784f, 0.231709063f},
-std::array<float,2>{0.745222688f, 0.947061956f},
-std::array<float,2>{0.925343513f, 0.425060183f},
-std::array<float,2>{0.0279192626f, 0.675319314f},
-std::array<float,2>{0.313490361f, 0.480999023f},
-std::array<float,2>{0.586269915f, 0.702803493f},
-std::array<float,2>{0.865959287f, 0.176909149f},
-std::array<float,2>{0.229223922f, 0.910546482f},
-std::array<float,2>{0.0943663418f, 0.0667365715f},
-std::array<float,2>{0.993228674f, 0.754208982f},
-std::array<float,2>{0.669690967f, 0.323984206f},
-std::array<float,2>{0.434979975f, 0.521698415f},
-std::array<float,2>{0.0844455734f, 0.33119747f},
-std::array<float,2>{0.94821775f, 0.505609751f},
-std::array<float,2>{0.643073857f, 0.0896965042f},
-std::array<float,2>{0.389417201f, 0.772254169f},
-std::array<float,2>{0.369443893f, 0.162338898f},
-std::array<float,2>{0.604234755f, 0.935440958f},
-std::array<float,2>{0.820104718f, 0.4856143f},
-std::array<float,2>{0.200637817f, 0.715954423f},
-std::array<float,2>{0.49634847f, 0.421345055f},
-std::array<float,2>{0.690592468f, 0.659549117f},
-std::array<float,2>{0.893838406f, 0.238396868f},
-std::array<float,2>{0.0500543192f, 0.956344247f},
-std::array<float,2>{0.130546287f, 0.0570428185f},
-std::array<float,2>{0.784526527f, 0.849556863f},
-std::array<float,2>{0.556958795f, 0.267862499f},
-std::array<float,2>{0.273079246f, 0.591111898f},
-std::array<float,2>{0.241227344f, 0.444593787f},
-std::array<float,2>{0.850682497f, 0.736408591f},
-std::array<float,2>{0.566771984f, 0.15083845f},
-std::array<float,2>{0.328128397f, 0.875592709f},
-std::array<float,2>{0.416565329f, 0.0967273638f},
-std::array<float,2>{0.672368467f, 0.784866214f},
-std::array<float,2>{0.982022405f, 0.344906837f},
-std::array<float,2>{0.114261411f, 0.551496089f},
-std::array<float,2>{0.293373257f, 0.311799765f},
-std::array<float,2>{0.511932194f, 0.618134856f},
-std::array<float,2>{0.771122932f, 0.0311703179f},
-std::array<float,2>{0.176114887f, 0.820364535f},
-std::array<float,2>{0.0130537227f, 0.215425313f},
-std::array<float,2>{0.908623874f, 0.993358374f},
-std::array<float,2>{0.720226765f, 0.405928195f},
-std::array<float,2>{0.438676625f, 0.646134079f},
-std::array<float,2>{0.124805599f, 0.495956123f},
-std::array<float,2>{0.969768107f, 0.708225667f},
-std::array<float,2>{0.68083787f, 0.17037268f},
-std::array<float,2>{0.407677472f, 0.928152442f},
-std::array<float,2>{0.336948931f, 0.0830719471f},
-std::array<float,2>{0.574475706f, 0.780344546f},
-std::array<float,2>{0.856589019f, 0.340699524f},
-std::array<float,2>{0.243558705f, 0.5091272f},
-std::array<float,2>{0.445849448f, 0.274162561f},
-std::array<float,2>{0.727394164f, 0.583430529f},
-std::array<float,2>{0.920535386f, 0.0469731875f},
-std::array<float,2>{0.000863530731f, 0.853843629f},
-std::array<float,2>{0.187340051f, 0.244009882f},
-std::array<float,2>{0.774692476f, 0.961888552f},
-std::array<float,2>{0.505114079f, 0.413974047f},
-std::array<float,2>{0.281345218f, 0.6714499f},
-std::array<float,2>{0.192139223f, 0.359172374f},
-std::array<float,2>{0.82755959f, 0.555507421f},
-std::array<float,2>{0.598517299f, 0.108044527f},
-std::array<float,2>{0.361770123f, 0.791288674f},
-std::array<float,2>{0.379591972f, 0.140835181f},
-std::array<float,2>{0.656125426f, 0.886956453f},
-std::array<float,2>{0.938097477f, 0.452172995f},
-std::array<float,2>{0.0879599676f, 0.743990302f},
-std::array<float,2>{0.279193223f, 0.394505054f},
-std::array<float,2>{0.553427815f, 0.648916185f},
-std::array<float,2>{0.793325603f, 0.204396516f},
-std::array<float,2>{0.134139642f, 0.986173332f},
-std::array<float,2>{0.0577807762f, 0.0218453575f},
-std::array<float,2>{0.899619281f, 0.817740858f},
-std::array<float,2>{0.702061713f, 0.297948897f},
-std::array<float,2>{0.486191481f, 0.616685152f},
-std::array<float,2>{0.0174185261f, 0.285188764f},
-std::array<float,2>{0.932207465f, 0.609293878f},
-std::array<float,2>{0.735155642f, 0.00150540273f},
-std::array<float,2>{0.466959983f, 0.829194009f},
-std::array<float,2>{0.303396106f, 0.196355522f},
-std::array<float,2>{0.523204863f, 0.98350358f},
-std::array<float,2>{0.75066328f, 0.385026515f},
-std::array<float,2>{0.164021164f, 0.630839407f},
-std::array<float,2>{0.427148849f, 0.465702444f},
-std::array<float,2>{0.663605452f, 0.721224427f},
-std::array<float,2>{0.989213407f, 0.12609905f},
-std::array<float,2>{0.107618771f, 0.900385499f},
-std::array<float,2>{0.220463797f, 0.111126408f},
-std::array<float,2>{0.872775137f, 0.802705526f},
-std::array<float,2>{0.580511749f, 0.365791291f},
-std::array<float,2>{0.321230799f, 0.542460382f},
-std::array<float,2>{0.142502651f, 0.432343096f},
-std::array<float,2>{0.809101284f, 0.679692507f},
-std::array<float,2>{0.540424287f, 0.221923456f},
-std::array<float,2>{0.258029312f, 0.941949248f},
-std::array<float,2>{0.477919966f, 0.0323529467f},
-std::array<float,2>{0.708522558f, 0.868632495f},
-std::array<float,2>{0.88028878f, 0.262341768f},
-std::array<float,2>{0.0417351313f, 0.563803315f},
-std::array<float,2>{0.35917294f, 0.315135896f},
-std::array<float,2>{0.614859045f, 0.530928552f},
-std::array<float,2>{0.839000463f, 0.0703170896f},
-std::array<float,2>{0.217158869f, 0.763639867f},
-std::array<float,2>{0.0763509199f, 0.181841999f},
-std::array<float,2>{0.95849967f, 0.917673826f},
-std::array<float,2>{0.639053226f, 0.471269876f},
-std::array<float,2>{0.392486989f, 0.688119709f},
-std::array<float,2>{0.0632282421f, 0.406678915f},
-std::array<float,2>{0.965779006f, 0.667455316f},
-std::array<float,2>{0.627313554f, 0.246641189f},
-std::array<float,2>{0.401139796f, 0.968691707f},
-std::array<float,2>{0.344217688f, 0.0541637316f},
-std::array<float,2>{0.620993912f, 0.856168628f},
-std::array<float,2>{0.835190058f, 0.279394001f},
-std::array<float,2>{0.207938105f, 0.578289449f},
-std::array<float,2>{0.47167334f, 0.336093634f},
-std::array<float,2>{0.712372661f, 0.513290823f},
-std::array<float,2>{0.883188307f, 0.0808832422f},
-std::array<float,2>{0.0329815634f, 0.773900986f},
-std::array<float,2>{0.155789092f, 0.167339072f},
-std::array<float,2>{0.797316313f, 0.921963036f},
-std::array<float,2>{0.53434211f, 0.497305036f},
-std::array<float,2>{0.25752306f, 0.703381717f},
-std::array<float,2>{0.231296629f, 0.304097205f},
-std::array<float,2>{0.860511124f, 0.61212033f},
-std::array<float,2>{0.593692243f, 0.0188126676f},
-std::array<float,2>{0.318542063f, 0.81425631f},
-std::array<float,2>{0.43061924f, 0.207667202f},
-std::array<float,2>{0.667716146f, 0.991352975f},
-std::array<float,2>{0.999191403f, 0.395661771f},
-std::array<float,2>{0.0985947475f, 0.653065026f},
-std::array<float,2>{0.310849965f, 0.447356492f},
-std::array<float,2>{0.52581495f, 0.747858107f},
-std::array<float,2>{0.764618516f, 0.14839597f},
-std::array<float,2>{0.168498248f, 0.883809805f},
-std::array<float,2>{0.0268336199f, 0.103123412f},
-std::array<float,2>{0.929257631f, 0.793585002f},
-std::array<float,2>{0.749118567f, 0.352721453f},
-std::array<float,2>{0.453662634f, 0.561447442f},
-std::array<float,2>{0.0528015159f, 0.36016801f},
-std::array<float,2>{0.895896375f, 0.54633671f},
-std::array<float,2>{0.693183482f, 0.114727743f},
-std::array<float,2>{0.495191783f, 0.798352957f},
-std::array<float,2>{0.269114763f, 0.128910005f},
-std::array<float,2>{0.56077081f, 0.906006157f},
-std::array<float,2>{0.78816694f, 0.462581009f},
-std::array<float,2>{0.12735413f, 0.72550267f},
-std::array<float,2>{0.383481026f, 0.389086664f},
-std::array<float,2>{0.646487832f, 0.625331879f},
-std::array<float,2>{0.949309111f, 0.201033339f},
-std::array<float,2>{0.0809399635f, 0.978861988f},
-std::array<float,2>{0.196364269f, 0.00576320942f},
-std::array<float,2>{0.815514982f, 0.834497869f},
-std::array<float,2>{0.606950462f, 0.282192945f},
-std::array<float,2>{0.374907315f, 0.602452219f},
-std::array<float,2>{0.173403487f, 0.473096102f},
-std::array<float,2>{0.768966377f, 0.691848814f},
-std::array<float,2>{0.508570492f, 0.184604689f},
-std::array<float,2>{0.291786909f, 0.918212712f},
-std::array<float,2>{0.44273591f, 0.0746560618f},
-std::array<float,2>{0.723232567f, 0.759137154f},
-std::array<float,2>{0.913934648f, 0.319512576f},
-std::array<float,2>{0.00794049911f, 0.52554512f},
-std::array<float,2>{0.33553645f, 0.259793401f},
-std::array<float,2>{0.564584136f, 0.568566322f},
-std::array<float,2>{0.847477973f, 0.0375556909f},
-std::array<float,2>{0.236730486f, 0.872141838f},
-std::array<float,2>{0.111100405f, 0.226344496f},
-std::array<float,2>{0.977679074f, 0.940599203f},
-std::array<float,2>{0.677046061f, 0.436656058f},
-std::array<float,2>{0.42112717f, 0.684456646f},
-std::array<float,2>{0.00415891316f, 0.458570421f},
-std::array<float,2>{0.916143835f, 0.732240915f},
-std::array<float,2>{0.731801093f, 0.137880445f},
-std::array<float,2>{0.45173806f, 0.896799445f},
-std::array<float,2>{0.285271555f, 0.122207746f},
-std::array<float,2>{0.503506482f, 0.808912039f},
-std::array<float,2>{0.781070411f, 0.369197607f},
-std::array<float,2>{0.182572111f, 0.533845067f},
-std::array<float,2>{0.410938799f, 0.293442249f},
-std::array<float,2>{0.686950982f, 0.596469343f},
-std::array<float,2>{0.976375103f, 0.0155746294f},
-std::array<float,2>{0.117401652f, 0.837522268f},
-std::array<float,2>{0.249985307f, 0.193243444f},
-std::array<float,2>{0.852786422f, 0.971964836f},
-std::array<float,2>{0.570525229f, 0.377582908f},
-std::array<float,2>{0.343436837f, 0.640440464f},
-std::array<float,2>{0.138625339f, 0.32600072f},
-std::array<float,2>{0.790584147f, 0.518459558f},
-std::array<float,2>{0.550500572f, 0.0634237155f},
-std::array<float,2>{0.277080297f, 0.753230214f},
-std::array<float,2>{0.492119938f, 0.172774523f},
-std::array<float,2>{0.698203146f, 0.908467174f},
-std::array<float,2>{0.90417707f, 0.476772964f},
-std::array<float,2>{0.0619426779f, 0.697780609f},
-std::array<float,2>{0.364630491f, 0.427665979f},
-std::array<float,2>{0.597182631f, 0.678201497f},
-std::array<float,2>{0.821124852f, 0.226840869f},
-std::array<float,2>{0.190754369f, 0.951320052f},
-std::array<float,2>{0.0910486206f, 0.0401870832f},
-std::array<float,2>{0.943239808f, 0.865606546f},
-std::array<float,2>{0.650911808f, 0.253934711f},
-std::array<float,2>{0.375724286f, 0.572948694f},
-std::array<float,2>{0.102156766f, 0.27115643f},
-std::array<float,2>{0.984794557f, 0.58666718f},
-std::array<float,2>{0.656488001f, 0.0603865609f},
-std::array<float,2>{0.425149888f, 0.844055951f},
-std::array<float,2>{0.327349097f, 0.236082092f},
-std::array<float,2>{0.582979858f, 0.958785415f},
-std::array<float,2>{0.870318711f, 0.416370034f},
-std::array<float,2>{0.223356113f, 0.663673222f},
-std::array<float,2>{0.46268791f, 0.491612166f},
-std::array<float,2>{0.738818228f, 0.713938177f},
-std::array<float,2>{0.936280727f, 0.157968193f},
-std::array<float,2>{0.0205986146f, 0.931888461f},
-std::array<float,2>{0.157958403f, 0.0927705765f},
-std::array<float,2>{0.755608499f, 0.767893612f},
-std::array<float,2>{0.517349362f, 0.334541202f},
-std::array<float,2>{0.300030023f, 0.503857136f},
-std::array<float,2>{0.213852137f, 0.401327908f},
-std::array<float,2>{0.84304446f, 0.64103508f},
-std::array<float,2>{0.61279285f, 0.211218536f},
-std::array<float,2>{0.353460371f, 0.997548819f},
-std::array<float,2>{0.398310035f, 0.0257554278f},
-std::array<float,2>{0.634451628f, 0.826901555f},
-std::array<float,2>{0.955767214f, 0.306661099f},
-std::array<float,2>{0.0717155039f, 0.621900856f},
-std::array<float,2>{0.26303187f, 0.348739952f},
-std::array<float,2>{0.546446919f, 0.54824543f},
-std::array<float,2>{0.805792153f, 0.101289205f},
-std::array<float,2>{0.145647854f, 0.788955808f},
-std::array<float,2>{0.0432982482f, 0.154925808f},
-std::array<float,2>{0.876659393f, 0.880407035f},
-std::array<float,2>{0.705685794f, 0.438003361f},
-std::array<float,2>{0.481075078f, 0.740998507f},
-std::array<float,2>{0.0492411219f, 0.419463336f},
-std::array<float,2>{0.893050969f, 0.656942129f},
-std::array<float,2>{0.689514935f, 0.242060885f},
-std::array<float,2>{0.497443438f, 0.953837454f},
-std::array<float,2>{0.271649331f, 0.0564051308f},
-std::array<float,2>{0.558391213f, 0.849682331f},
-std::array<float,2>{0.783801019f, 0.267352164f},
-std::array<float,2>{0.129560173f, 0.593147755f},
-std::array<float,2>{0.390045732f, 0.328537077f},
-std::array<float,2>{0.644394755f, 0.507273197f},
-std::array<float,2>{0.948811114f, 0.0872331783f},
-std::array<float,2>{0.0855105817f, 0.770930052f},
-std::array<float,2>{0.199364871f, 0.160733804f},
-std::array<float,2>{0.818544745f, 0.936106443f},
-std::array<float,2>{0.605344474f, 0.4873285f},
-std::array<float,2>{0.370235115f, 0.717371106f},
-std::array<float,2>{0.177546576f, 0.309718221f},
-std::array<float,2>{0.769962847f, 0.6195333f},
-std::array<float,2>{0.513477504f, 0.0284307655f},
-std::array<float,2>{0.29442206f, 0.823693812f},
-std::array<float,2>{0.438301891f, 0.218045428f},
-std::array<float,2>{0.718861103f, 0.996027768f},
-std::array<float,2>{0.910097659f, 0.403531373f},
-std::array<float,2>{0.0121127591f, 0.646544993f},
-std::array<float,2>{0.329106182f, 0.442508131f},
-std::array<float,2>{0.568038881f, 0.734917402f},
-std::array<float,2>{0.850451231f, 0.149455696f},
-std::array<float,2>{0.240578026f, 0.878682733f},
-std::array<float,2>{0.113822497f, 0.0938884094f},
-std::array<float,2>{0.980527222f, 0.78134197f},
-std::array<float,2>{0.673238933f, 0.346085876f},
-std::array<float,2>{0.41716662f, 0.553803444f},
-std::array<float,2>{0.0682437271f, 0.37403059f},
-std::array<float,2>{0.961061835f, 0.537531137f},
-std::array<float,2>{0.632300138f, 0.119078323f},
-std::array<float,2>{0.402972162f, 0.8064695f},
-std::array<float,2>{0.349127561f, 0.136164144f},
-std::array<float,2>{0.623927295f, 0.891461194f},
-std::array<float,2>{0.830199897f, 0.455218852f},
-std::array<float,2>{0.203276649f, 0.727464557f},
-std::array<float,2>{0.474401742f, 0.379866362f},
-std::array<float,2>{0.71526432f, 0.636696637f},
-std::array<float,2>{0.890605092f, 0.189242899f},
-std::array<float,2>{0.0378704816f, 0.975161552f},
-std::array<float,2>{0.150913313f, 0.0113294916f},
-std::array<float,2>{0.802206755f, 0.842008471f},
-std::array<float,2>{0.536113024f, 0.289424747f},
-std::array<float,2>{0.250150323f, 0.60152638f},
-std::array<float,2>{0.230465442f, 0.484192461f},
-std::array<float,2>{0.866898477f, 0.700362384f},
-std::array<float,2>{0.586976469f, 0.17788586f},
-std::array<float,2>{0.31271106f, 0.913293839f},
-std::array<float,2>{0.433822781f, 0.0696854293f},
-std::array<float,2>{0.668028533f, 0.757647455f},
-std::array<float,2>{0.992440641f, 0.320582628f},
-std::array<float,2>{0.0954348743f, 0.520282269f},
-std::array<float,2>{0.305527419f, 0.250709981f},
-std::array<float,2>{0.527832985f, 0.57476145f},
-std::array<float,2>{0.759453714f, 0.0434762761f},
-std::array<float,2>{0.164657518f, 0.862689734f},
-std::array<float,2>{0.0287952535f, 0.233859465f},
-std::array<float,2>{0.924528182f, 0.948554635f},
-std::array<float,2>{0.744509757f, 0.423235267f},
-std::array<float,2>{0.459447145f, 0.672692299f},
-std::array<float,2>{0.108892784f, 0.467655212f},
-std::array<float,2>{0.989377797f, 0.718814433f},
-std::array<float,2>{0.662782013f, 0.128067598f},
-std::array<float,2>{0.426253736f, 0.90214926f},
-std::array<float,2>{0.321769178f, 0.112335049f},
-std::array<float,2>{0.581527233f, 0.803658783f},
-std::array<float,2>{0.871249437f, 0.365083277f},
-std::array<float,2>{0.2191879f, 0.54082787f},
-std::array<float,2>{0.467801452f, 0.288208783f},
-std::array<float,2>{0.735383093f, 0.607370913f},
-std::array<float,2>{0.932873905f, 0.00372397411f},
-std::array<float,2>{0.0164464042f, 0.830117822f},
-std::array<float,2>{0.16250059f, 0.198221117f},
-std::array<float,2>{0.751073241f, 0.981351852f},
-std::array<float,2>{0.521582067f, 0.384583592f},
-std::array<float,2>{0.30391553f, 0.630981743f},
-std::array<float,2>{0.218173251f, 0.314294308f},
-std::array<float,2>{0.838834822f, 0.528343797f},
-std::array<float,2>{0.613713503f, 0.0726066232f},
-std::array<float,2>{0.358040094f, 0.765209675f},
-std::array<float,2>{0.391316921f, 0.181194976f},
-std::array<float,2>{0.639766455f, 0.914354444f},
-std::array<float,2>{0.957759142f, 0.46961844f},
-std::array<float,2>{0.0776526704f, 0.690527201f},
-std::array<float,2>{0.258809894f, 0.430274487f},
-std::array<float,2>{0.539195895f, 0.681646764f},
-std::array<float,2>{0.810190797f, 0.218784168f},
-std::array<float,2>{0.141458645f, 0.94384408f},
-std::array<float,2>{0.0429243594f, 0.034548793f},
-std::array<float,2>{0.879517913f, 0.87071079f},
-std::array<float,2>{0.707511544f, 0.265534997f},
-std::array<float,2>{0.477233052f, 0.565756857f},
-std::array<float,2>{0.00109219481f, 0.275874466f},
-std::array<float,2>{0.921488047f, 0.585397363f},
-std::array<float,2>{0.72757268f, 0.0497358032f},
-std::array<float,2>{0.446770012f, 0.852232277f},
-std::array<float,2>{0.28277871f, 0.244679034f},
-std::array<float,2>{0.504255712f, 0.963340163f},
-std::array<float,2>{0.773998976f, 0.411970407f},
-std::array<float,2>{0.185908094f, 0.668978155f},
-std::array<float,2>{0.406284004f, 0.494030505f},
-std::array<float,2>{0.680630922f, 0.709069967f},
-std::array<float,2>{0.969671905f, 0.169723988f},
-std::array<float,2>{0.123851068f, 0.926704347f},
-std::array<float,2>{0.243101135f, 0.0848719105f},
-std::array<float,2>{0.855945051f, 0.77828902f},
-std::array<float,2>{0.576150656f, 0.343302995f},
-std::array<float,2>{0.336001694f, 0.511231065f},
-std::array<float,2>{0.132958934f, 0.390970081f},
-std::array<float,2>{0.794316232f, 0.651515841f},
-std::array<float,2>{0.55405134f, 0.205877662f},
-std::array<float,2>{0.277722776f, 0.986970961f},
-std::array<float,2>{0.485012203f, 0.020176461f},
-std::array<float,2>{0.702227235f, 0.819005668f},
-std::array<float,2>{0.898997843f, 0.299998999f},
-std::array<float,2>{0.0567584932f, 0.613500297f},
-std::array<float,2>{0.362680256f, 0.356404483f},
-std::array<float,2>{0.59905839f, 0.557260633f},
-std::array<float,2>{0.826990962f, 0.106223598f},
-std::array<float,2>{0.193130165f, 0.790258408f},
-std::array<float,2>{0.0892516375f, 0.143761322f},
-std::array<float,2>{0.93880105f, 0.890474379f},
-std::array<float,2>{0.654915214f, 0.451125175f},
-std::array<float,2>{0.380709529f, 0.746024549f},
-std::array<float,2>{0.0819741786f, 0.386750996f},
-std::array<float,2>{0.950231731f, 0.627357006f},
-std::array<float,2>{0.648085773f, 0.202097803f},
-std::array<float,2>{0.384230494f, 0.978032589f},
-std::array<float,2>{0.373305321f, 0.00746521028f},
-std::array<float,2>{0.606178701f, 0.832320213f},
-std::array<float,2>{0.814538479f, 0.284018725f},
-std::array<float,2>{0.196131051f, 0.605055928f},
-std::array<float,2>{0.494147718f, 0.362974912f},
-std::array<float,2>{0.691907108f, 0.542995453f},
-std::array<float,2>{0.895020664f, 0.115783826f},
-std::array<float,2>{0.0545776449f, 0.799600244f},
-std::array<float,2>{0.128635764f, 0.132534504f},
-std::array<float,2>{0.787287414f, 0.904082358f},
-std::array<float,2>{0.561669648f, 0.463725448f},
-std::array<float,2>{0.267823786f, 0.722914517f},
-std::array<float,2>{0.237711191f, 0.259384722f},
-std::array<float,2>{0.845992088f, 0.567132652f},
-std::array<float,2>{0.566385448f, 0.0364060551f},
-std::array<float,2>{0.334427893f, 0.873746455f},
-std::array<float,2>{0.420657754f, 0.224560112f},
-std::array<float,2>{0.676616251f, 0.938160896f},
-std::array<float,2>{0.977108717f, 0.43368873f},
-std::array<float,2>{0.110253707f, 0.687103093f},
-std::array<float,2>{0.29209125f, 0.474899799f},
-std::array<float,2>{0.509166121f, 0.693779409f},
-std::array<float,2>{0.768432617f, 0.186356202f},
-std::array<float,2>{0.171879783f, 0.921390712f},
-std::array<float,2>{0.00914435927f, 0.077492252f},
-std::array<float,2>{0.91249615f, 0.760593653f},
-std::array<float,2>{0.724230528f, 0.317367494f},
-std::array<float,2>{0.442078561f, 0.524916768f},
-std::array<float,2>{0.0317835212f, 0.338024676f},
-std::array<float,2>{0.884429216f, 0.51467514f},
-std::array<float,2>{0.711642861f, 0.0787751228f},
-std::array<float,2>{0.471841216f, 0.777103722f},
-std::array<float,2>{0.256055206f, 0.164475635f},
-std::array<float,2>{0.534135342f, 0.925559402f},
-std::array<float,2>{0.797985375f, 0.499458283f},
-std::array<float,2>{0.154726595f, 0.706486762f},
-std::array<float,2>{0.401460499f, 0.409016788f},
-std::array<float,2>{0.628767967f, 0.665582597f},
-std::array<float,2>{0.966294408f, 0.249544039f},
-std::array<float,2>{0.0640156791f, 0.965101659f},
-std::array<float,2>{0.208276004f, 0.0509235971f},
-std::array<float,2>{0.834756255f, 0.857933462f},
-std::array<float,2>{0.619583249f, 0.27734533f},
-std::array<float,2>{0.344767988f, 0.581531465f},
-std::array<float,2>{0.169881403f, 0.44595471f},
-std::array<float,2>{0.765601337f, 0.748889983f},
-std::array<float,2>{0.526727676f, 0.145268813f},
-std::array<float,2>{0.311726987f, 0.88497138f},
-std::array<float,2>{0.454838067f, 0.105399229f},
-std::array<float,2>{0.748133004f, 0.795682192f},
-std::array<float,2>{0.928487659f, 0.354055166f},
-std::array<float,2>{0.0262478273f, 0.560037434f},
-std::array<float,2>{0.320095479f, 0.301445276f},
-std::array<float,2>{0.592291713f, 0.609433055f},
-std::array<float,2>{0.859740496f, 0.0165798403f},
-std::array<float,2>{0.231470361f, 0.815222502f},
-std::array<float,2>{0.0989820287f, 0.209902555f},
-std::array<float,2>{0.998722553f, 0.989822209f},
-std::array<float,2>{0.666353643f, 0.396782011f},
-std::array<float,2>{0.431455553f, 0.655458212f},
-std::array<float,2>{0.0200940091f, 0.488287896f},
-std::array<float,2>{0.937435627f, 0.71244514f},
-std::array<float,2>{0.73997277f, 0.159253016f},
-std::array<float,2>{0.461127549f, 0.931231558f},
-std::array<float,2>{0.298995078f, 0.0899405554f},
-std::array<float,2>{0.516496956f, 0.766691744f},
-std::array<float,2>{0.754022777f, 0.332439333f},
-std::array<float,2>{0.157025352f, 0.501775861f},
-std::array<float,2>{0.423908412f, 0.273433447f},
-std::array<float,2>{0.657535076f, 0.589337289f},
-std::array<float,2>{0.986166656f, 0.0608143769f},
-std::array<float,2>{0.103100173f, 0.847024798f},
-std::array<float,2>{0.224559069f, 0.236575365f},
-std::array<float,2>{0.869264543f, 0.960876107f},
-std::array<float,2>{0.583098233f, 0.414626032f},
-std::array<float,2>{0.326623589f, 0.660892129f},
-std::array<float,2>{0.144824907f, 0.350775421f},
-std::array<float,2>{0.804731786f, 0.549984097f},
-std::array<float,2>{0.545062482f, 0.0990835428f},
-std::array<float,2>{0.262476295f, 0.786046922f},
-std::array<float,2>{0.481463432f, 0.153318062f},
-std::array<float,2>{0.706385672f, 0.881588936f},
-std::array<float,2>{0.87545526f, 0.440653473f},
-std::array<float,2>{0.0440321602f, 0.738356471f},
-std::array<float,2>{0.352173418f, 0.398783386f},
-std::array<float,2>{0.611548066f, 0.643610597f},
-std::array<float,2>{0.842685163f, 0.212922528f},
-std::array<float,2>{0.214136332f, 0.998135865f},
-std::array<float,2>{0.0705058351f, 0.0239582565f},
-std::array<float,2>{0.95678705f, 0.826042414f},
-std::array<float,2>{0.633200109f, 0.305408776f},
-std::array<float,2>{0.396910876f, 0.624213755f},
-std::array<float,2>{0.118560046f, 0.295610398f},
-std::array<float,2>{0.975268722f, 0.595276415f},
-std::array<float,2>{0.686473012f, 0.0133972913f},
-std::array<float,2>{0.411970884f, 0.838340342f},
-std::array<float,2>{0.342396915f, 0.193978444f},
-std::array<float,2>{0.57133311f, 0.969166636f},
-std::array<float,2>{0.852386892f, 0.376212984f},
-std::array<float,2>{0.248553827f, 0.638206065f},
-std::array<float,2>{0.452335238f, 0.459109843f},
-std::array<float,2>{0.73057878f, 0.732634068f},
-std::array<float,2>{0.917198777f, 0.140273795f},
-std::array<float,2>{0.00527662132f, 0.894673884f},
-std::array<float,2>{0.183461756f, 0.123462848f},
-std::array<float,2>{0.779763162f, 0.811789215f},
-std::array<float,2>{0.502411008f, 0.368115485f},
-std::array<float,2>{0.286856115f, 0.531324685f},
-std::array<float,2>{0.189951316f, 0.428473145f},
-std::array<float,2>{0.821306586f, 0.677135944f},
-std::array<float,2>{0.596000612f, 0.230408311f},
-std::array<float,2>{0.364029616f, 0.949797273f},
-std::array<float,2>{0.376492202f, 0.0419196449f},
-std::array<float,2>{0.651722968f, 0.864839494f},
-std::array<float,2>{0.941604674f, 0.256338388f},
-std::array<float,2>{0.0904805139f, 0.571252584f},
-std::array<float,2>{0.276146233f, 0.326654792f},
-std::array<float,2>{0.54895395f, 0.516056776f},
-std::array<float,2>{0.789518058f, 0.0660928488f},
-std::array<float,2>{0.137097821f, 0.750690877f},
-std::array<float,2>{0.0613502823f, 0.173948616f},
-std::array<float,2>{0.903022707f, 0.906808913f},
-std::array<float,2>{0.698840022f, 0.478901237f},
-std::array<float,2>{0.490613312f, 0.696233332f},
-std::array<float,2>{0.0137128541f, 0.4044424f},
-std::array<float,2>{0.90768528f, 0.645175755f},
-std::array<float,2>{0.721733212f, 0.215846255f},
-std::array<float,2>{0.43951726f, 0.992546141f},
-std::array<float,2>{0.295856535f, 0.0302640311f},
-std::array<float,2>{0.515561998f, 0.821537077f},
-std::array<float,2>{0.772119462f, 0.311077893f},
-std::array<float,2>{0.17797029f, 0.618879855f},
-std::array<float,2>{0.414231867f, 0.344591111f},
-std::array<float,2>{0.675708294f, 0.551996231f},
-std::array<float,2>{0.983014345f, 0.0965787843f},
-std::array<float,2>{0.115454324f, 0.784123778f},
-std::array<float,2>{0.238478497f, 0.152210876f},
-std::array<float,2>{0.848735988f, 0.876458824f},
-std::array<float,2>{0.569009364f, 0.443481833f},
-std::array<float,2>{0.331959605f, 0.737357855f},
-std::array<float,2>{0.131891444f, 0.268785f},
-std::array<float,2>{0.782779515f, 0.590774536f},
-std::array<float,2>{0.555059433f, 0.0580549464f},
-std::array<float,2>{0.270407885f, 0.848330081f},
-std::array<float,2>{0.498340666f, 0.239620626f},
-std::array<float,2>{0.688872993f, 0.955772638f},
-std::array<float,2>{0.891673803f, 0.420364648f},
-std::array<float,2>{0.0475567468f, 0.659042716f},
-std::array<float,2>{0.367730349f, 0.4852449f},
-std::array<float,2>{0.603156686f, 0.715413928f},
-std::array<float,2>{0.816570878f, 0.163649246f},
-std::array<float,2>{0.201433033f, 0.934022963f},
-std::array<float,2>{0.0822677761f, 0.0888062865f},
-std::array<float,2>{0.946407259f, 0.773060322f},
-std::array<float,2>{0.640700281f, 0.330487221f},
-std::array<float,2>{0.388149142f, 0.504422545f},
-std::array<float,2>{0.095723927f, 0.323081881f},
-std::array<float,2>{0.994600892f, 0.523028791f},
-std::array<float,2>{0.670226693f, 0.0676247552f},
-std::array<float,2>{0.43707031f, 0.755000472f},
-std::array<float,2>{0.314746588f, 0.176195383f},
-std::array<float,2>{0.588200986f, 0.912044704f},
-std::array<float,2>{0.863659382f, 0.482259363f},
-std::array<float,2>{0.227559641f, 0.701465309f},
-std::array<float,2>{0.458040178f, 0.424770325f},
-std::array<float,2>{0.742802441f, 0.674033225f},
-std::array<float,2>{0.92349714f, 0.230845228f},
-std::array<float,2>{0.0311169941f, 0.946242511f},
-std::array<float,2>{0.167500585f, 0.0454195775f},
-std::array<float,2>{0.760639071f, 0.860822737f},
-std::array<float,2>{0.529764771f, 0.253742188f},
-std::array<float,2>{0.307844937f, 0.577841878f},
-std::array<float,2>{0.205672011f, 0.453127056f},
-std::array<float,2>{0.829119086f, 0.729183674f},
-std::array<float,2>{0.622342885f, 0.133818105f},
-std::array<float,2>{0.351180494f, 0.893182933f},
-std::array<float,2>{0.406101674f, 0.119818114f},
-std::array<float,2>{0.63054961f, 0.807263315f},
-std::array<float,2>{0.963520765f, 0.372762054f},
-std::array<float,2>{0.0698026866f, 0.535526514f},
-std::array<float,2>{0.252591282f, 0.292935163f},
-std::array<float,2>{0.538189828f, 0.598393798f},
-std::array<float,2>{0.803343773f, 0.00815536082f},
-std::array<float,2>{0.149867967f, 0.841201782f},
-std::array<float,2>{0.0359062552f, 0.191289216f},
-std::array<float,2>{0.888593376f, 0.973305285f},
-std::array<float,2>{0.717332482f, 0.382354856f},
-std::array<float,2>{0.474968612f, 0.634406269f},
-std::array<float,2>{0.0750803724f, 0.47231859f},
-std::array<float,2>{0.960417092f, 0.688606381f},
-std::array<float,2>{0.637687087f, 0.183077872f},
-std::array<float,2>{0.394030124f, 0.916194201f},
-std::array<float,2>{0.356150776f, 0.0715463087f},
-std::array<float,2>{0.61673981f, 0.76218605f},
-std::array<float,2>{0.835987151f, 0.315740436f},
-std::array<float,2>{0.215328142f, 0.529722035f},
-std::array<float,2>{0.479793012f, 0.263649285f},
-std::array<float,2>{0.710001588f, 0.563210309f},
-std::array<float,2>{0.882497847f, 0.0320474021f},
-std::array<float,2>{0.0400272571f, 0.867346525f},
-std::array<float,2>{0.144260466f, 0.221256778f},
-std::array<float,2>{0.811491072f, 0.942565978f},
-std::array<float,2>{0.541333795f, 0.432700455f},
-std::array<float,2>{0.261063725f, 0.680829287f},
-std::array<float,2>{0.221024483f, 0.36623776f},
-std::array<float,2>{0.874951422f, 0.541759729f},
-std::array<float,2>{0.5790627f, 0.109883495f},
-std::array<float,2>{0.324065238f, 0.801675081f},
-std::array<float,2>{0.428393245f, 0.125577912f},
-std::array<float,2>{0.660549879f, 0.89937067f},
-std::array<float,2>{0.990285099f, 0.466286153f},
-std::array<float,2>{0.105617844f, 0.722087681f},
-std::array<float,2>{0.30105266f, 0.386633635f},
-std::array<float,2>{0.520110011f, 0.629079282f},
-std::array<float,2>{0.752521217f, 0.196145877f},
-std::array<float,2>{0.16135627f, 0.982986629f},
-std::array<float,2>{0.0181467291f, 0.000779677299f},
-std::array<float,2>{0.930015087f, 0.828719795f},
-std::array<float,2>{0.737017035f, 0.286570579f},
-std::array<float,2>{0.465553731f, 0.608279526f},
-std::array<float,2>{0.055633653f, 0.297776014f},
-std::array<float,2>{0.901462138f, 0.615907311f},
-std::array<float,2>{0.700214684f, 0.0229266975f},
-std::array<float,2>{0.487907887f, 0.816923678f},
-std::array<float,2>{0.279763937f, 0.203637749f},
-std::array<float,2>{0.551160216f, 0.984941185f},
-std::array<float,2>{0.795126736f, 0.393279523f},
-std::array<float,2>{0.136471063f, 0.649494171f},
-std::array<float,2>{0.382448137f, 0.452059805f},
-std::array<float,2>{0.654051363f, 0.742337584f},
-std::array<float,2>{0.940511823f, 0.142004922f},
-std::array<float,2>{0.0867003277f, 0.888580739f},
-std::array<float,2>{0.19378747f, 0.10924454f},
-std::array<float,2>{0.825529754f, 0.792944729f},
-std::array<float,2>{0.599725187f, 0.357876867f},
-std::array<float,2>{0.360303253f, 0.555691659f},
-std::array<float,2>{0.185209379f, 0.412533224f},
-std::array<float,2>{0.776873529f, 0.670260012f},
-std::array<float,2>{0.505876303f, 0.242555752f},
-std::array<float,2>{0.284047931f, 0.962174535f},
-std::array<float,2>{0.44869712f, 0.0485932529f},
-std::array<float,2>{0.729426682f, 0.854517698f},
-std::array<float,2>{0.918598413f, 0.275208265f},
-std::array<float,2>{0.00332574919f, 0.582906663f},
-std::array<float,2>{0.338882804f, 0.341078818f},
-std::array<float,2>{0.576592863f, 0.508733749f},
-std::array<float,2>{0.85906738f, 0.0826370269f},
-std::array<float,2>{0.24441728f, 0.780173004f},
-std::array<float,2>{0.122789204f, 0.171245739f},
-std::array<float,2>{0.971700788f, 0.929645538f},
-std::array<float,2>{0.681847811f, 0.4945364f},
-std::array<float,2>{0.408543259f, 0.707957387f},
-std::array<float,2>{0.112866551f, 0.436095834f},
-std::array<float,2>{0.979543447f, 0.685240805f},
-std::array<float,2>{0.677830219f, 0.224752039f},
-std::array<float,2>{0.419405192f, 0.940400362f},
-std::array<float,2>{0.332092553f, 0.0390306413f},
-std::array<float,2>{0.563758135f, 0.871384263f},
-std::array<float,2>{0.84497565f, 0.260907501f},
-std::array<float,2>{0.235357702f, 0.570153236f},
-std::array<float,2>{0.444133759f, 0.319335282f},
-std::array<float,2>{0.726317167f, 0.52639246f},
-std::array<float,2>{0.9111709f, 0.0752275065f},
-std::array<float,2>{0.0106362486f, 0.758742034f},
-std::array<float,2>{0.17498602f, 0.184492126f},
-std::array<float,2>{0.766547203f, 0.919162095f},
-std::array<float,2>{0.510622442f, 0.473956287f},
-std::array<float,2>{0.289990932f, 0.692451894f},
-std::array<float,2>{0.197928861f, 0.282302886f},
-std::array<float,2>{0.814318359f, 0.602851868f},
-std::array<float,2>{0.608636856f, 0.00391090009f},
-std::array<float,2>{0.371834219f, 0.835639119f},
-std::array<float,2>{0.385703713f, 0.199588344f},
-std::array<float,2>{0.646101713f, 0.980289042f},
-std::array<float,2>{0.952257574f, 0.389685094f},
-std::array<float,2>{0.0800646916f, 0.62625438f},
-std::array<float,2>{0.26717791f, 0.461573124f},
-std::array<float,2>{0.558931947f, 0.726437986f},
-std::array<float,2>{0.786412537f, 0.130647019f},
-std::array<float,2>{0.126631096f, 0.904368341f},
-std::array<float,2>{0.0509351194f, 0.114240527f},
-std::array<float,2>{0.897014081f, 0.797650397f},
-std::array<float,2>{0.693463981f, 0.360598624f},
-std::array<float,2>{0.492980808f, 0.545878828f},
-std::array<float,2>{0.0240668543f, 0.351819098f},
-std::array<float,2>{0.927179575f, 0.561855376f},
-std::array<float,2>{0.746431947f, 0.102480635f},
-std::array<float,2>{0.456413597f, 0.794676244f},
-std::array<float,2>{0.310090095f, 0.146973148f},
-std::array<float,2>{0.524758637f, 0.882888258f},
-std::array<float,2>{0.762933671f, 0.449197173f},
-std::array<float,2>{0.170503229f, 0.746857047f},
-std::array<float,2>{0.432252437f, 0.395418704f},
-std::array<float,2>{0.665830135f, 0.653661191f},
-std::array<float,2>{0.996557117f, 0.208850861f},
-std::array<float,2>{0.0999710709f, 0.991209805f},
-std::array<float,2>{0.234243482f, 0.0175845474f},
-std::array<float,2>{0.862329245f, 0.813021421f},
-std::array<float,2>{0.590848267f, 0.30318886f},
-std::array<float,2>{0.316765815f, 0.612805665f},
-std::array<float,2>{0.153719649f, 0.496375054f},
-std::array<float,2>{0.799191952f, 0.704826236f},
-std::array<float,2>{0.531567276f, 0.166851684f},
-std::array<float,2>{0.255152434f, 0.923575938f},
-std::array<float,2>{0.46909228f, 0.0817405507f},
-std::array<float,2>{0.714034736f, 0.774522901f},
-std::array<float,2>{0.88626188f, 0.337081403f},
-std::array<float,2>{0.0344699547f, 0.511910617f},
-std::array<float,2>{0.34664017f, 0.280729741f},
-std::array<float,2>{0.617713988f, 0.579476476f},
-std::array<float,2>{0.833098531f, 0.0527394414f},
-std::array<float,2>{0.209220126f, 0.857271194f},
-std::array<float,2>{0.0645977929f, 0.247685283f},
-std::array<float,2>{0.967637241f, 0.967677355f},
-std::array<float,2>{0.626771569f, 0.408057392f},
-std::array<float,2>{0.39902553f, 0.66654247f},
-std::array<float,2>{0.0459639877f, 0.438792825f},
-std::array<float,2>{0.877188146f, 0.74144882f},
-std::array<float,2>{0.704034388f, 0.155944631f},
-std::array<float,2>{0.483715951f, 0.879117846f},
-std::array<float,2>{0.264799207f, 0.100215837f},
-std::array<float,2>{0.544296205f, 0.78753525f},
-std::array<float,2>{0.807506621f, 0.348573744f},
-std::array<float,2>{0.148359194f, 0.547545671f},
-std::array<float,2>{0.395485371f, 0.308377445f},
-std::array<float,2>{0.635517299f, 0.622163117f},
-std::array<float,2>{0.954011738f, 0.0273361281f},
-std::array<float,2>{0.0724861324f, 0.827772558f},
-std::array<float,2>{0.212677956f, 0.212123349f},
-std::array<float,2>{0.840875626f, 0.996876717f},
-std::array<float,2>{0.609400988f, 0.4018206f},
-std::array<float,2>{0.353548169f, 0.6425457f},
-std::array<float,2>{0.159006998f, 0.335276693f},
-std::array<float,2>{0.757356822f, 0.502839327f},
-std::array<float,2>{0.518124998f, 0.0928526074f},
-std::array<float,2>{0.298537493f, 0.769054055f},
-std::array<float,2>{0.463960856f, 0.157194018f},
-std::array<float,2>{0.741938353f, 0.932784855f},
-std::array<float,2>{0.933883309f, 0.491102874f},
-std::array<float,2>{0.0226501431f, 0.713389635f},
-std::array<float,2>{0.324332833f, 0.417622894f},
-std::array<float,2>{0.58469528f, 0.662297606f},
-std::array<float,2>{0.867553592f, 0.23466441f},
-std::array<float,2>{0.225341573f, 0.957176507f},
-std::array<float,2>{0.104211144f, 0.0593257286f},
-std::array<float,2>{0.986947238f, 0.844922185f},
-std::array<float,2>{0.659944534f, 0.269838691f},
-std::array<float,2>{0.422956795f, 0.587459147f},
-std::array<float,2>{0.0932482183f, 0.255721569f},
-std::array<float,2>{0.945135951f, 0.573905051f},
-std::array<float,2>{0.649934888f, 0.0398949571f},
-std::array<float,2>{0.377434969f, 0.866939783f},
-std::array<float,2>{0.366110146f, 0.228178248f},
-std::array<float,2>{0.594341278f, 0.952322781f},
-std::array<float,2>{0.822678566f, 0.426552445f},
-std::array<float,2>{0.187548012f, 0.679457247f},
-std::array<float,2>{0.489207447f, 0.47848621f},
-std::array<float,2>{0.695659935f, 0.69835335f},
-std::array<float,2>{0.905657291f, 0.173025593f},
-std::array<float,2>{0.0593287423f, 0.910040557f},
-std::array<float,2>{0.139917865f, 0.063766785f},
-std::array<float,2>{0.79284656f, 0.752489924f},
-std::array<float,2>{0.547591269f, 0.32511127f},
-std::array<float,2>{0.273876637f, 0.519454241f},
-std::array<float,2>{0.247680798f, 0.378894329f},
-std::array<float,2>{0.853694975f, 0.638942778f},
-std::array<float,2>{0.573365808f, 0.191579327f},
-std::array<float,2>{0.339930743f, 0.971193969f},
-std::array<float,2>{0.413242072f, 0.0146071073f},
-std::array<float,2>{0.68435663f, 0.836825907f},
-std::array<float,2>{0.97414279f, 0.294544607f},
-std::array<float,2>{0.119510911f, 0.597227514f},
-std::array<float,2>{0.287311375f, 0.370227426f},
-std::array<float,2>{0.501026928f, 0.535000801f},
-std::array<float,2>{0.777750194f, 0.121371299f},
-std::array<float,2>{0.1811551f, 0.809994221f},
-std::array<float,2>{0.00660108449f, 0.137031898f},
-std::array<float,2>{0.915933132f, 0.898195803f},
-std::array<float,2>{0.732980251f, 0.457758814f},
-std::array<float,2>{0.449458182f, 0.730645299f}}
\ No newline at end of file
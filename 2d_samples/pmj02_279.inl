@@ -1,4096 +0,0 @@
-{std::array<float,2>{0.198327243f, 0.758683383f},
-std::array<float,2>{0.777256489f, 0.0632891133f},
-std::array<float,2>{0.35339278f, 0.365653902f},
-std::array<float,2>{0.670595467f, 0.746192038f},
-std::array<float,2>{0.378315002f, 0.503061712f},
-std::array<float,2>{0.528877676f, 0.49136728f},
-std::array<float,2>{0.0071858163f, 0.190090477f},
-std::array<float,2>{0.933444142f, 0.945202649f},
-std::array<float,2>{0.251919031f, 0.880693376f},
-std::array<float,2>{0.749918282f, 0.161339253f},
-std::array<float,2>{0.185634747f, 0.408457071f},
-std::array<float,2>{0.870628119f, 0.568622231f},
-std::array<float,2>{0.0867785886f, 0.686947107f},
-std::array<float,2>{0.967916489f, 0.258626074f},
-std::array<float,2>{0.485416144f, 0.0300948583f},
-std::array<float,2>{0.562705338f, 0.845120788f},
-std::array<float,2>{0.0510604307f, 0.98138088f},
-std::array<float,2>{0.90031898f, 0.240583971f},
-std::array<float,2>{0.424728245f, 0.460656971f},
-std::array<float,2>{0.541897953f, 0.55077821f},
-std::array<float,2>{0.335783035f, 0.6899997f},
-std::array<float,2>{0.631988466f, 0.342677593f},
-std::array<float,2>{0.233035475f, 0.120640881f},
-std::array<float,2>{0.799037457f, 0.807957113f},
-std::array<float,2>{0.455821723f, 0.824533343f},
-std::array<float,2>{0.622369826f, 0.0564525388f},
-std::array<float,2>{0.124086879f, 0.293546587f},
-std::array<float,2>{0.995189905f, 0.641593516f},
-std::array<float,2>{0.149922058f, 0.594707727f},
-std::array<float,2>{0.838119864f, 0.397895485f},
-std::array<float,2>{0.303009212f, 0.131591067f},
-std::array<float,2>{0.691477001f, 0.922631502f},
-std::array<float,2>{0.156355113f, 0.912127018f},
-std::array<float,2>{0.85894233f, 0.149061888f},
-std::array<float,2>{0.276504546f, 0.380886465f},
-std::array<float,2>{0.719524145f, 0.612354398f},
-std::array<float,2>{0.48254168f, 0.637308896f},
-std::array<float,2>{0.587780178f, 0.297729701f},
-std::array<float,2>{0.0670816526f, 0.0430009291f},
-std::array<float,2>{0.944542348f, 0.835408151f},
-std::array<float,2>{0.368298918f, 0.795607567f},
-std::array<float,2>{0.672338903f, 0.102153085f},
-std::array<float,2>{0.214885578f, 0.326256931f},
-std::array<float,2>{0.760529757f, 0.711105764f},
-std::array<float,2>{0.0210082605f, 0.544119537f},
-std::array<float,2>{0.907900691f, 0.443590283f},
-std::array<float,2>{0.404782414f, 0.23244752f},
-std::array<float,2>{0.502040446f, 0.996294141f},
-std::array<float,2>{0.102132179f, 0.867519855f},
-std::array<float,2>{0.983088315f, 0.00561205577f},
-std::array<float,2>{0.450203001f, 0.271991998f},
-std::array<float,2>{0.602676928f, 0.664854109f},
-std::array<float,2>{0.292131573f, 0.592272758f},
-std::array<float,2>{0.70364517f, 0.425689459f},
-std::array<float,2>{0.125988215f, 0.179955348f},
-std::array<float,2>{0.826656878f, 0.898811221f},
-std::array<float,2>{0.408963829f, 0.954475164f},
-std::array<float,2>{0.557170272f, 0.215103328f},
-std::array<float,2>{0.0413182713f, 0.470291913f},
-std::array<float,2>{0.878728986f, 0.523629367f},
-std::array<float,2>{0.248769045f, 0.733723938f},
-std::array<float,2>{0.794627368f, 0.347826123f},
-std::array<float,2>{0.313872159f, 0.0867490992f},
-std::array<float,2>{0.645701826f, 0.767608404f},
-std::array<float,2>{0.13303186f, 0.836473942f},
-std::array<float,2>{0.819127738f, 0.0380730405f},
-std::array<float,2>{0.288503498f, 0.31159243f},
-std::array<float,2>{0.716546595f, 0.627424836f},
-std::array<float,2>{0.442940116f, 0.622247338f},
-std::array<float,2>{0.601148605f, 0.385983765f},
-std::array<float,2>{0.0964073166f, 0.147592977f},
-std::array<float,2>{0.972324371f, 0.921299279f},
-std::array<float,2>{0.327755898f, 0.986460447f},
-std::array<float,2>{0.653200388f, 0.218856946f},
-std::array<float,2>{0.240924358f, 0.449257463f},
-std::array<float,2>{0.787600636f, 0.537069499f},
-std::array<float,2>{0.0342202745f, 0.706519902f},
-std::array<float,2>{0.887945592f, 0.319640338f},
-std::array<float,2>{0.416560203f, 0.0995081589f},
-std::array<float,2>{0.551390827f, 0.7889027f},
-std::array<float,2>{0.0738743246f, 0.897085309f},
-std::array<float,2>{0.952884197f, 0.1770408f},
-std::array<float,2>{0.474406779f, 0.436711401f},
-std::array<float,2>{0.581997335f, 0.58015281f},
-std::array<float,2>{0.271750003f, 0.659686387f},
-std::array<float,2>{0.732423186f, 0.276290417f},
-std::array<float,2>{0.167731062f, 0.0111603858f},
-std::array<float,2>{0.850484788f, 0.866466224f},
-std::array<float,2>{0.390930027f, 0.781221032f},
-std::array<float,2>{0.515610874f, 0.0845821127f},
-std::array<float,2>{0.0283036884f, 0.357973516f},
-std::array<float,2>{0.921311259f, 0.725675285f},
-std::array<float,2>{0.204056978f, 0.520402551f},
-std::array<float,2>{0.757009864f, 0.481990397f},
-std::array<float,2>{0.359748393f, 0.205948889f},
-std::array<float,2>{0.679707944f, 0.965389907f},
-std::array<float,2>{0.224788502f, 0.945894182f},
-std::array<float,2>{0.807199359f, 0.202479854f},
-std::array<float,2>{0.337656915f, 0.495559871f},
-std::array<float,2>{0.637208521f, 0.509691536f},
-std::array<float,2>{0.429695249f, 0.739052594f},
-std::array<float,2>{0.538557589f, 0.367542654f},
-std::array<float,2>{0.0583840758f, 0.076854378f},
-std::array<float,2>{0.891385317f, 0.756017804f},
-std::array<float,2>{0.310639441f, 0.856573105f},
-std::array<float,2>{0.696500123f, 0.0158050638f},
-std::array<float,2>{0.148174196f, 0.256225646f},
-std::array<float,2>{0.834360719f, 0.678396165f},
-std::array<float,2>{0.117054403f, 0.57247591f},
-std::array<float,2>{0.988761008f, 0.415244281f},
-std::array<float,2>{0.464957446f, 0.164300427f},
-std::array<float,2>{0.61193651f, 0.888118625f},
-std::array<float,2>{0.014974582f, 0.803397834f},
-std::array<float,2>{0.923305213f, 0.110958435f},
-std::array<float,2>{0.384011805f, 0.330223829f},
-std::array<float,2>{0.516508877f, 0.695772231f},
-std::array<float,2>{0.34723103f, 0.556097031f},
-std::array<float,2>{0.66133374f, 0.465490788f},
-std::array<float,2>{0.195089042f, 0.249097034f},
-std::array<float,2>{0.770732284f, 0.972724736f},
-std::array<float,2>{0.499102563f, 0.932619989f},
-std::array<float,2>{0.577834487f, 0.13492465f},
-std::array<float,2>{0.0859173536f, 0.402518034f},
-std::array<float,2>{0.95332396f, 0.604724407f},
-std::array<float,2>{0.174029708f, 0.655170739f},
-std::array<float,2>{0.86422658f, 0.284098208f},
-std::array<float,2>{0.263847649f, 0.0510064885f},
-std::array<float,2>{0.736774623f, 0.818720996f},
-std::array<float,2>{0.181133211f, 0.784864128f},
-std::array<float,2>{0.872601628f, 0.0946164206f},
-std::array<float,2>{0.25717929f, 0.316178381f},
-std::array<float,2>{0.744533896f, 0.708950639f},
-std::array<float,2>{0.490625769f, 0.53460592f},
-std::array<float,2>{0.567897499f, 0.447384268f},
-std::array<float,2>{0.0909245834f, 0.225159541f},
-std::array<float,2>{0.962124586f, 0.992130697f},
-std::array<float,2>{0.359247923f, 0.914233267f},
-std::array<float,2>{0.667324245f, 0.140856385f},
-std::array<float,2>{0.199841395f, 0.389723927f},
-std::array<float,2>{0.780243158f, 0.617461443f},
-std::array<float,2>{0.00112906389f, 0.629937887f},
-std::array<float,2>{0.934910595f, 0.307463288f},
-std::array<float,2>{0.379479349f, 0.0341617651f},
-std::array<float,2>{0.527096927f, 0.842006862f},
-std::array<float,2>{0.1204409f, 0.961920381f},
-std::array<float,2>{0.999703407f, 0.210025162f},
-std::array<float,2>{0.458205462f, 0.478381068f},
-std::array<float,2>{0.620061934f, 0.518517613f},
-std::array<float,2>{0.297163367f, 0.718796194f},
-std::array<float,2>{0.69109714f, 0.355302513f},
-std::array<float,2>{0.154305652f, 0.0781778321f},
-std::array<float,2>{0.843525469f, 0.774877608f},
-std::array<float,2>{0.428923815f, 0.862214684f},
-std::array<float,2>{0.543102741f, 0.0131780962f},
-std::array<float,2>{0.0470345505f, 0.278517723f},
-std::array<float,2>{0.905901849f, 0.662537336f},
-std::array<float,2>{0.229422137f, 0.582128882f},
-std::array<float,2>{0.80435431f, 0.430489928f},
-std::array<float,2>{0.330991536f, 0.171975598f},
-std::array<float,2>{0.625167251f, 0.892983615f},
-std::array<float,2>{0.211382791f, 0.884588122f},
-std::array<float,2>{0.764831722f, 0.171573848f},
-std::array<float,2>{0.374948472f, 0.419083416f},
-std::array<float,2>{0.67768997f, 0.575643778f},
-std::array<float,2>{0.401595592f, 0.67573303f},
-std::array<float,2>{0.506710529f, 0.250710368f},
-std::array<float,2>{0.0180483181f, 0.0209829155f},
-std::array<float,2>{0.913755834f, 0.854151249f},
-std::array<float,2>{0.280763328f, 0.750140488f},
-std::array<float,2>{0.72331506f, 0.0703406706f},
-std::array<float,2>{0.161563307f, 0.373993993f},
-std::array<float,2>{0.852940857f, 0.735948026f},
-std::array<float,2>{0.0644452795f, 0.512599826f},
-std::array<float,2>{0.937820494f, 0.497021168f},
-std::array<float,2>{0.477659166f, 0.197658032f},
-std::array<float,2>{0.591745615f, 0.949940324f},
-std::array<float,2>{0.045788344f, 0.813829362f},
-std::array<float,2>{0.879665077f, 0.0471657515f},
-std::array<float,2>{0.412664622f, 0.285471678f},
-std::array<float,2>{0.560090959f, 0.64848125f},
-std::array<float,2>{0.317920148f, 0.607793272f},
-std::array<float,2>{0.644180715f, 0.399180025f},
-std::array<float,2>{0.244418338f, 0.138126165f},
-std::array<float,2>{0.790397048f, 0.935258389f},
-std::array<float,2>{0.448406935f, 0.972092807f},
-std::array<float,2>{0.607591391f, 0.242595434f},
-std::array<float,2>{0.108760647f, 0.463099569f},
-std::array<float,2>{0.980174959f, 0.559683442f},
-std::array<float,2>{0.131611139f, 0.701069176f},
-std::array<float,2>{0.821089685f, 0.332217723f},
-std::array<float,2>{0.293517858f, 0.114706933f},
-std::array<float,2>{0.710740447f, 0.797190428f},
-std::array<float,2>{0.235285923f, 0.849957168f},
-std::array<float,2>{0.781590998f, 0.0243876576f},
-std::array<float,2>{0.321767271f, 0.262520313f},
-std::array<float,2>{0.6505211f, 0.681274235f},
-std::array<float,2>{0.421301335f, 0.562739968f},
-std::array<float,2>{0.547535658f, 0.411693454f},
-std::array<float,2>{0.035737291f, 0.159115776f},
-std::array<float,2>{0.883136332f, 0.876936316f},
-std::array<float,2>{0.284172118f, 0.938862145f},
-std::array<float,2>{0.71392715f, 0.195156842f},
-std::array<float,2>{0.140453026f, 0.485993177f},
-std::array<float,2>{0.81362623f, 0.504439473f},
-std::array<float,2>{0.0994300246f, 0.744048417f},
-std::array<float,2>{0.975515783f, 0.361262232f},
-std::array<float,2>{0.437847883f, 0.067566067f},
-std::array<float,2>{0.594186187f, 0.763857007f},
-std::array<float,2>{0.0248133689f, 0.927599013f},
-std::array<float,2>{0.917556405f, 0.128170624f},
-std::array<float,2>{0.397759676f, 0.392636478f},
-std::array<float,2>{0.509356797f, 0.598123252f},
-std::array<float,2>{0.366196245f, 0.645287514f},
-std::array<float,2>{0.686728239f, 0.292085886f},
-std::array<float,2>{0.21022211f, 0.060476847f},
-std::array<float,2>{0.750965297f, 0.824042797f},
-std::array<float,2>{0.470449388f, 0.808654428f},
-std::array<float,2>{0.583111763f, 0.124367587f},
-std::array<float,2>{0.0753800645f, 0.339299023f},
-std::array<float,2>{0.946335077f, 0.691435754f},
-std::array<float,2>{0.168629423f, 0.552153885f},
-std::array<float,2>{0.844366372f, 0.455456138f},
-std::array<float,2>{0.26946494f, 0.235470429f},
-std::array<float,2>{0.729815722f, 0.979336977f},
-std::array<float,2>{0.142972529f, 0.992276907f},
-std::array<float,2>{0.831964195f, 0.226668835f},
-std::array<float,2>{0.305017412f, 0.440300941f},
-std::array<float,2>{0.703076303f, 0.539102793f},
-std::array<float,2>{0.462072134f, 0.717961431f},
-std::array<float,2>{0.613666952f, 0.321440101f},
-std::array<float,2>{0.112218641f, 0.106203169f},
-std::array<float,2>{0.984810531f, 0.791418135f},
-std::array<float,2>{0.340102702f, 0.82908684f},
-std::array<float,2>{0.63514632f, 0.0393056832f},
-std::array<float,2>{0.219174892f, 0.301593661f},
-std::array<float,2>{0.808978856f, 0.634100318f},
-std::array<float,2>{0.0595562011f, 0.616776705f},
-std::array<float,2>{0.897223234f, 0.376556754f},
-std::array<float,2>{0.434178203f, 0.154487297f},
-std::array<float,2>{0.534550309f, 0.908033609f},
-std::array<float,2>{0.0811211467f, 0.772793293f},
-std::array<float,2>{0.957225263f, 0.0914750025f},
-std::array<float,2>{0.4941127f, 0.347274035f},
-std::array<float,2>{0.573108375f, 0.728167713f},
-std::array<float,2>{0.259506673f, 0.527687848f},
-std::array<float,2>{0.741517067f, 0.474007428f},
-std::array<float,2>{0.178153872f, 0.212032661f},
-std::array<float,2>{0.860925019f, 0.960732043f},
-std::array<float,2>{0.389967382f, 0.905628741f},
-std::array<float,2>{0.520724535f, 0.184119642f},
-std::array<float,2>{0.00982738286f, 0.42671752f},
-std::array<float,2>{0.929423034f, 0.586837769f},
-std::array<float,2>{0.188588694f, 0.67075479f},
-std::array<float,2>{0.765917897f, 0.268957853f},
-std::array<float,2>{0.348060578f, 0.00100628147f},
-std::array<float,2>{0.657501161f, 0.874017239f},
-std::array<float,2>{0.232296363f, 0.804997504f},
-std::array<float,2>{0.798116565f, 0.1184422f},
-std::array<float,2>{0.332127333f, 0.339969188f},
-std::array<float,2>{0.6301651f, 0.688628137f},
-std::array<float,2>{0.423374534f, 0.548519313f},
-std::array<float,2>{0.539318979f, 0.45819065f},
-std::array<float,2>{0.0540442877f, 0.239665359f},
-std::array<float,2>{0.901028216f, 0.984147191f},
-std::array<float,2>{0.302149475f, 0.925689459f},
-std::array<float,2>{0.693932712f, 0.130543813f},
-std::array<float,2>{0.150982097f, 0.39614591f},
-std::array<float,2>{0.836770773f, 0.596492112f},
-std::array<float,2>{0.121543907f, 0.643549263f},
-std::array<float,2>{0.993385136f, 0.296747416f},
-std::array<float,2>{0.45377183f, 0.058490552f},
-std::array<float,2>{0.623400629f, 0.827926219f},
-std::array<float,2>{0.00527050486f, 0.942602038f},
-std::array<float,2>{0.931058168f, 0.188925102f},
-std::array<float,2>{0.375804156f, 0.489777684f},
-std::array<float,2>{0.529460192f, 0.50000453f},
-std::array<float,2>{0.354047298f, 0.749717236f},
-std::array<float,2>{0.669207096f, 0.364333123f},
-std::array<float,2>{0.195597693f, 0.0662451684f},
-std::array<float,2>{0.773520768f, 0.761141062f},
-std::array<float,2>{0.488043338f, 0.847265422f},
-std::array<float,2>{0.566164017f, 0.0284326598f},
-std::array<float,2>{0.0882058665f, 0.261586159f},
-std::array<float,2>{0.966120958f, 0.684550703f},
-std::array<float,2>{0.184840709f, 0.567389786f},
-std::array<float,2>{0.868544877f, 0.406689376f},
-std::array<float,2>{0.25287807f, 0.163704336f},
-std::array<float,2>{0.747271538f, 0.88250953f},
-std::array<float,2>{0.127072304f, 0.901339173f},
-std::array<float,2>{0.824461997f, 0.18223986f},
-std::array<float,2>{0.289623857f, 0.423414201f},
-std::array<float,2>{0.706016779f, 0.590788126f},
-std::array<float,2>{0.452468842f, 0.667221129f},
-std::array<float,2>{0.603639722f, 0.270857036f},
-std::array<float,2>{0.103752218f, 0.00743977027f},
-std::array<float,2>{0.981013298f, 0.86994046f},
-std::array<float,2>{0.314848572f, 0.767116964f},
-std::array<float,2>{0.647860885f, 0.0888976231f},
-std::array<float,2>{0.247631788f, 0.350015312f},
-std::array<float,2>{0.795256495f, 0.731133938f},
-std::array<float,2>{0.0397011861f, 0.525978506f},
-std::array<float,2>{0.876223743f, 0.471894145f},
-std::array<float,2>{0.406291604f, 0.218018115f},
-std::array<float,2>{0.555631697f, 0.956816554f},
-std::array<float,2>{0.0695498809f, 0.832874477f},
-std::array<float,2>{0.942690134f, 0.0453611128f},
-std::array<float,2>{0.482232988f, 0.300408036f},
-std::array<float,2>{0.58933568f, 0.639633417f},
-std::array<float,2>{0.274254769f, 0.609728515f},
-std::array<float,2>{0.721512556f, 0.378989816f},
-std::array<float,2>{0.159279466f, 0.1509711f},
-std::array<float,2>{0.855514169f, 0.911314785f},
-std::array<float,2>{0.402614802f, 0.999456942f},
-std::array<float,2>{0.500236452f, 0.231789678f},
-std::array<float,2>{0.0219088104f, 0.441447765f},
-std::array<float,2>{0.909962714f, 0.546512485f},
-std::array<float,2>{0.218109623f, 0.71441412f},
-std::array<float,2>{0.757835507f, 0.324952275f},
-std::array<float,2>{0.370339662f, 0.10391394f},
-std::array<float,2>{0.675032675f, 0.793112218f},
-std::array<float,2>{0.165447846f, 0.863315761f},
-std::array<float,2>{0.84942919f, 0.00917315017f},
-std::array<float,2>{0.269727945f, 0.275107265f},
-std::array<float,2>{0.730492353f, 0.656333566f},
-std::array<float,2>{0.475070834f, 0.578625679f},
-std::array<float,2>{0.580014348f, 0.434918791f},
-std::array<float,2>{0.0703229532f, 0.177776083f},
-std::array<float,2>{0.950530291f, 0.895543814f},
-std::array<float,2>{0.361974865f, 0.966926634f},
-std::array<float,2>{0.682808757f, 0.203631699f},
-std::array<float,2>{0.206141278f, 0.482601196f},
-std::array<float,2>{0.754162014f, 0.522260845f},
-std::array<float,2>{0.0309548508f, 0.723603666f},
-std::array<float,2>{0.918863416f, 0.356506646f},
-std::array<float,2>{0.393571168f, 0.0828485563f},
-std::array<float,2>{0.513251364f, 0.778687418f},
-std::array<float,2>{0.0955878794f, 0.919325411f},
-std::array<float,2>{0.970011115f, 0.145398632f},
-std::array<float,2>{0.443711191f, 0.3842583f},
-std::array<float,2>{0.597896695f, 0.624262512f},
-std::array<float,2>{0.28548795f, 0.626250088f},
-std::array<float,2>{0.718086004f, 0.310273319f},
-std::array<float,2>{0.136712596f, 0.0367676057f},
-std::array<float,2>{0.817106783f, 0.839299381f},
-std::array<float,2>{0.414464861f, 0.786346793f},
-std::array<float,2>{0.554243863f, 0.0999830589f},
-std::array<float,2>{0.0328093097f, 0.318202049f},
-std::array<float,2>{0.890351593f, 0.70320797f},
-std::array<float,2>{0.239434138f, 0.537454128f},
-std::array<float,2>{0.786805212f, 0.452224523f},
-std::array<float,2>{0.32448861f, 0.221775666f},
-std::array<float,2>{0.656091988f, 0.984888136f},
-std::array<float,2>{0.19253695f, 0.975595295f},
-std::array<float,2>{0.77343446f, 0.246175408f},
-std::array<float,2>{0.344103158f, 0.467088878f},
-std::array<float,2>{0.662280202f, 0.556918859f},
-std::array<float,2>{0.386460602f, 0.698076963f},
-std::array<float,2>{0.518049359f, 0.32952705f},
-std::array<float,2>{0.0117742782f, 0.111526668f},
-std::array<float,2>{0.924544096f, 0.801547408f},
-std::array<float,2>{0.262809485f, 0.817917109f},
-std::array<float,2>{0.736301243f, 0.0534560718f},
-std::array<float,2>{0.172490194f, 0.282850951f},
-std::array<float,2>{0.865245402f, 0.653809011f},
-std::array<float,2>{0.0823655277f, 0.602041543f},
-std::array<float,2>{0.956139922f, 0.405125648f},
-std::array<float,2>{0.496517092f, 0.13436906f},
-std::array<float,2>{0.575571239f, 0.93141973f},
-std::array<float,2>{0.0556026064f, 0.754949987f},
-std::array<float,2>{0.893039227f, 0.0754736513f},
-std::array<float,2>{0.432967454f, 0.369830877f},
-std::array<float,2>{0.5362764f, 0.74038136f},
-std::array<float,2>{0.339007765f, 0.509887695f},
-std::array<float,2>{0.639823914f, 0.493121266f},
-std::array<float,2>{0.223913983f, 0.199912414f},
-std::array<float,2>{0.806298792f, 0.948047578f},
-std::array<float,2>{0.467734873f, 0.889864266f},
-std::array<float,2>{0.610678613f, 0.166948199f},
-std::array<float,2>{0.114470482f, 0.416245222f},
-std::array<float,2>{0.990535736f, 0.571173906f},
-std::array<float,2>{0.146084711f, 0.677044153f},
-std::array<float,2>{0.832122266f, 0.255139977f},
-std::array<float,2>{0.310104012f, 0.0176640283f},
-std::array<float,2>{0.699082255f, 0.859258413f},
-std::array<float,2>{0.152732626f, 0.776195824f},
-std::array<float,2>{0.840524673f, 0.0804091021f},
-std::array<float,2>{0.298950821f, 0.353499174f},
-std::array<float,2>{0.687557876f, 0.722449899f},
-std::array<float,2>{0.460822672f, 0.516420841f},
-std::array<float,2>{0.618437767f, 0.478853673f},
-std::array<float,2>{0.117705032f, 0.20791389f},
-std::array<float,2>{0.996149242f, 0.964144945f},
-std::array<float,2>{0.328412235f, 0.891416192f},
-std::array<float,2>{0.627621651f, 0.174806088f},
-std::array<float,2>{0.226661295f, 0.432283163f},
-std::array<float,2>{0.801845968f, 0.584944308f},
-std::array<float,2>{0.0490871966f, 0.660508513f},
-std::array<float,2>{0.903047442f, 0.2793217f},
-std::array<float,2>{0.425968289f, 0.0148416404f},
-std::array<float,2>{0.546486259f, 0.859894276f},
-std::array<float,2>{0.093352437f, 0.98997879f},
-std::array<float,2>{0.964791059f, 0.223015264f},
-std::array<float,2>{0.48843345f, 0.44556421f},
-std::array<float,2>{0.569766819f, 0.531777263f},
-std::array<float,2>{0.254059643f, 0.710834563f},
-std::array<float,2>{0.742600083f, 0.312560052f},
-std::array<float,2>{0.182008713f, 0.0961675718f},
-std::array<float,2>{0.874686599f, 0.781432688f},
-std::array<float,2>{0.381171644f, 0.84002012f},
-std::array<float,2>{0.525078475f, 0.0328912027f},
-std::array<float,2>{0.0028553477f, 0.305762529f},
-std::array<float,2>{0.937161446f, 0.631843865f},
-std::array<float,2>{0.201378793f, 0.620698631f},
-std::array<float,2>{0.778953969f, 0.388143599f},
-std::array<float,2>{0.356647789f, 0.14386712f},
-std::array<float,2>{0.665944099f, 0.917783797f},
-std::array<float,2>{0.242966086f, 0.937426269f},
-std::array<float,2>{0.792230844f, 0.13998124f},
-std::array<float,2>{0.319920659f, 0.401774228f},
-std::array<float,2>{0.641441941f, 0.606326282f},
-std::array<float,2>{0.410599947f, 0.65160656f},
-std::array<float,2>{0.562147915f, 0.288413644f},
-std::array<float,2>{0.0441156588f, 0.050112389f},
-std::array<float,2>{0.882256269f, 0.815207899f},
-std::array<float,2>{0.296170533f, 0.799660981f},
-std::array<float,2>{0.707655132f, 0.116121054f},
-std::array<float,2>{0.129545972f, 0.334430993f},
-std::array<float,2>{0.823096633f, 0.701741815f},
-std::array<float,2>{0.106975988f, 0.561245799f},
-std::array<float,2>{0.977501035f, 0.462596387f},
-std::array<float,2>{0.446431607f, 0.244170189f},
-std::array<float,2>{0.606687307f, 0.969033062f},
-std::array<float,2>{0.0158202406f, 0.852374971f},
-std::array<float,2>{0.911824703f, 0.0216569845f},
-std::array<float,2>{0.400325596f, 0.253737122f},
-std::array<float,2>{0.504006326f, 0.672438502f},
-std::array<float,2>{0.372740775f, 0.57746011f},
-std::array<float,2>{0.678196669f, 0.420730889f},
-std::array<float,2>{0.212915286f, 0.16983372f},
-std::array<float,2>{0.761971772f, 0.88484472f},
-std::array<float,2>{0.480185091f, 0.952316165f},
-std::array<float,2>{0.593016982f, 0.196686715f},
-std::array<float,2>{0.0655054301f, 0.499725908f},
-std::array<float,2>{0.940230966f, 0.514007807f},
-std::array<float,2>{0.163155854f, 0.736640871f},
-std::array<float,2>{0.854396343f, 0.371875554f},
-std::array<float,2>{0.278082788f, 0.0730833039f},
-std::array<float,2>{0.726291835f, 0.753426969f},
-std::array<float,2>{0.207455084f, 0.820475042f},
-std::array<float,2>{0.753119528f, 0.0616214685f},
-std::array<float,2>{0.365028322f, 0.28935957f},
-std::array<float,2>{0.685054839f, 0.646893263f},
-std::array<float,2>{0.396163851f, 0.600025117f},
-std::array<float,2>{0.511383295f, 0.390917212f},
-std::array<float,2>{0.0270290747f, 0.126137391f},
-std::array<float,2>{0.915039957f, 0.929541171f},
-std::array<float,2>{0.267417938f, 0.97751075f},
-std::array<float,2>{0.726791143f, 0.236697093f},
-std::array<float,2>{0.171838313f, 0.453537077f},
-std::array<float,2>{0.847420633f, 0.553021312f},
-std::array<float,2>{0.0763158351f, 0.693718195f},
-std::array<float,2>{0.948034286f, 0.336831391f},
-std::array<float,2>{0.471100777f, 0.122689962f},
-std::array<float,2>{0.585166574f, 0.812150538f},
-std::array<float,2>{0.0377990119f, 0.877425015f},
-std::array<float,2>{0.885691345f, 0.157636255f},
-std::array<float,2>{0.418093354f, 0.412785321f},
-std::array<float,2>{0.550125122f, 0.565377295f},
-std::array<float,2>{0.322452009f, 0.682269692f},
-std::array<float,2>{0.64884156f, 0.264620602f},
-std::array<float,2>{0.237708926f, 0.0263190959f},
-std::array<float,2>{0.783825397f, 0.848207951f},
-std::array<float,2>{0.441067249f, 0.762516618f},
-std::array<float,2>{0.596160531f, 0.0690051317f},
-std::array<float,2>{0.0997101888f, 0.363060027f},
-std::array<float,2>{0.974044442f, 0.745573163f},
-std::array<float,2>{0.137002334f, 0.507741511f},
-std::array<float,2>{0.815415442f, 0.486491412f},
-std::array<float,2>{0.282431692f, 0.193225265f},
-std::array<float,2>{0.711446881f, 0.939910948f},
-std::array<float,2>{0.177573413f, 0.957999647f},
-std::array<float,2>{0.861414671f, 0.214462012f},
-std::array<float,2>{0.261433184f, 0.476179898f},
-std::array<float,2>{0.738455772f, 0.53041178f},
-std::array<float,2>{0.495265305f, 0.730187714f},
-std::array<float,2>{0.570759356f, 0.345213145f},
-std::array<float,2>{0.0781494528f, 0.0919013768f},
-std::array<float,2>{0.959290922f, 0.771398604f},
-std::array<float,2>{0.350994408f, 0.872730255f},
-std::array<float,2>{0.6597718f, 0.00340806064f},
-std::array<float,2>{0.191286072f, 0.266379893f},
-std::array<float,2>{0.76888907f, 0.668144524f},
-std::array<float,2>{0.00950153545f, 0.589603245f},
-std::array<float,2>{0.927263379f, 0.429323107f},
-std::array<float,2>{0.387787998f, 0.185869172f},
-std::array<float,2>{0.523183644f, 0.902792275f},
-std::array<float,2>{0.109799281f, 0.790141523f},
-std::array<float,2>{0.986957192f, 0.107487656f},
-std::array<float,2>{0.463462323f, 0.323947191f},
-std::array<float,2>{0.617067039f, 0.716372967f},
-std::array<float,2>{0.306792855f, 0.541968346f},
-std::array<float,2>{0.701032579f, 0.438563555f},
-std::array<float,2>{0.14215757f, 0.228849143f},
-std::array<float,2>{0.829736173f, 0.99545455f},
-std::array<float,2>{0.43645829f, 0.908458769f},
-std::array<float,2>{0.533108354f, 0.1538755f},
-std::array<float,2>{0.0607280359f, 0.377177268f},
-std::array<float,2>{0.895359874f, 0.614977956f},
-std::array<float,2>{0.22145772f, 0.635745227f},
-std::array<float,2>{0.812255144f, 0.303214699f},
-std::array<float,2>{0.342188448f, 0.0425661989f},
-std::array<float,2>{0.634170711f, 0.831264317f},
-std::array<float,2>{0.24674882f, 0.769440472f},
-std::array<float,2>{0.796732605f, 0.0869436637f},
-std::array<float,2>{0.31603986f, 0.349551111f},
-std::array<float,2>{0.64721334f, 0.733305156f},
-std::array<float,2>{0.408007592f, 0.525170445f},
-std::array<float,2>{0.556606531f, 0.468959957f},
-std::array<float,2>{0.0400412753f, 0.215884924f},
-std::array<float,2>{0.875585735f, 0.953655958f},
-std::array<float,2>{0.290561289f, 0.899903357f},
-std::array<float,2>{0.706738889f, 0.180895478f},
-std::array<float,2>{0.128529921f, 0.424418688f},
-std::array<float,2>{0.825984895f, 0.593580008f},
-std::array<float,2>{0.104940884f, 0.665403187f},
-std::array<float,2>{0.981660485f, 0.273106009f},
-std::array<float,2>{0.451781183f, 0.00426394166f},
-std::array<float,2>{0.605443954f, 0.868191957f},
-std::array<float,2>{0.0231531989f, 0.997262895f},
-std::array<float,2>{0.908996701f, 0.233920231f},
-std::array<float,2>{0.403885603f, 0.444473028f},
-std::array<float,2>{0.501654029f, 0.543152392f},
-std::array<float,2>{0.369922459f, 0.712422907f},
-std::array<float,2>{0.67408067f, 0.327498883f},
-std::array<float,2>{0.217629924f, 0.102984287f},
-std::array<float,2>{0.759018898f, 0.796418071f},
-std::array<float,2>{0.480733752f, 0.834329844f},
-std::array<float,2>{0.587932408f, 0.0442986749f},
-std::array<float,2>{0.0688538849f, 0.298696876f},
-std::array<float,2>{0.942330241f, 0.638200819f},
-std::array<float,2>{0.159154728f, 0.611772716f},
-std::array<float,2>{0.856657147f, 0.382389545f},
-std::array<float,2>{0.27525866f, 0.149884954f},
-std::array<float,2>{0.721856833f, 0.913247287f},
-std::array<float,2>{0.151878119f, 0.92358762f},
-std::array<float,2>{0.837049365f, 0.132139578f},
-std::array<float,2>{0.300964326f, 0.397298485f},
-std::array<float,2>{0.695232213f, 0.595589817f},
-std::array<float,2>{0.454334855f, 0.642324626f},
-std::array<float,2>{0.624405801f, 0.294266343f},
-std::array<float,2>{0.122228853f, 0.0552936904f},
-std::array<float,2>{0.992439508f, 0.825586498f},
-std::array<float,2>{0.333718538f, 0.807223201f},
-std::array<float,2>{0.629528403f, 0.11923895f},
-std::array<float,2>{0.231008932f, 0.342882335f},
-std::array<float,2>{0.797695696f, 0.691065371f},
-std::array<float,2>{0.0530902706f, 0.549090981f},
-std::array<float,2>{0.901820183f, 0.459552109f},
-std::array<float,2>{0.42194736f, 0.241510451f},
-std::array<float,2>{0.540619135f, 0.982088804f},
-std::array<float,2>{0.0892813206f, 0.843952656f},
-std::array<float,2>{0.965809584f, 0.0304535814f},
-std::array<float,2>{0.487100214f, 0.259518594f},
-std::array<float,2>{0.564679265f, 0.685614228f},
-std::array<float,2>{0.253119528f, 0.5694592f},
-std::array<float,2>{0.746796668f, 0.409691602f},
-std::array<float,2>{0.184158728f, 0.160883859f},
-std::array<float,2>{0.867269635f, 0.879440665f},
-std::array<float,2>{0.376716286f, 0.943420708f},
-std::array<float,2>{0.530452728f, 0.1905604f},
-std::array<float,2>{0.00456776097f, 0.491119981f},
-std::array<float,2>{0.929878712f, 0.502749205f},
-std::array<float,2>{0.196598127f, 0.747800231f},
-std::array<float,2>{0.774561048f, 0.366481841f},
-std::array<float,2>{0.354576111f, 0.0638942644f},
-std::array<float,2>{0.668008506f, 0.759620011f},
-std::array<float,2>{0.173408657f, 0.819572031f},
-std::array<float,2>{0.866910636f, 0.0522105917f},
-std::array<float,2>{0.262594521f, 0.284207433f},
-std::array<float,2>{0.734631538f, 0.655918121f},
-std::array<float,2>{0.497425586f, 0.603830695f},
-std::array<float,2>{0.574901819f, 0.404131621f},
-std::array<float,2>{0.0832612142f, 0.136650801f},
-std::array<float,2>{0.955505848f, 0.932120264f},
-std::array<float,2>{0.345100224f, 0.974501431f},
-std::array<float,2>{0.663221598f, 0.248240426f},
-std::array<float,2>{0.191725165f, 0.466357678f},
-std::array<float,2>{0.77244854f, 0.55473417f},
-std::array<float,2>{0.0135255791f, 0.697264373f},
-std::array<float,2>{0.925671279f, 0.331924289f},
-std::array<float,2>{0.384824932f, 0.109697118f},
-std::array<float,2>{0.519528687f, 0.803961039f},
-std::array<float,2>{0.113534309f, 0.886834741f},
-std::array<float,2>{0.991620958f, 0.165713161f},
-std::array<float,2>{0.467970788f, 0.414752096f},
-std::array<float,2>{0.609887958f, 0.573373735f},
-std::array<float,2>{0.309421688f, 0.679210722f},
-std::array<float,2>{0.697712243f, 0.257166147f},
-std::array<float,2>{0.145116806f, 0.017472025f},
-std::array<float,2>{0.833703279f, 0.85570097f},
-std::array<float,2>{0.432505131f, 0.757632434f},
-std::array<float,2>{0.535987675f, 0.0776609182f},
-std::array<float,2>{0.0556979887f, 0.368714511f},
-std::array<float,2>{0.894147813f, 0.73944968f},
-std::array<float,2>{0.223143265f, 0.508446157f},
-std::array<float,2>{0.805517197f, 0.494661152f},
-std::array<float,2>{0.33793059f, 0.201907575f},
-std::array<float,2>{0.639190376f, 0.947260976f},
-std::array<float,2>{0.205798805f, 0.966080546f},
-std::array<float,2>{0.75493741f, 0.206074819f},
-std::array<float,2>{0.363017797f, 0.480940223f},
-std::array<float,2>{0.682355523f, 0.521309614f},
-std::array<float,2>{0.393214673f, 0.725041449f},
-std::array<float,2>{0.511972308f, 0.359232932f},
-std::array<float,2>{0.0298431516f, 0.0854200274f},
-std::array<float,2>{0.919480145f, 0.780107439f},
-std::array<float,2>{0.271240562f, 0.865716815f},
-std::array<float,2>{0.731711805f, 0.00997812208f},
-std::array<float,2>{0.16486299f, 0.276878178f},
-std::array<float,2>{0.847800076f, 0.658802629f},
-std::array<float,2>{0.0714880675f, 0.581340909f},
-std::array<float,2>{0.949257553f, 0.436301291f},
-std::array<float,2>{0.475783944f, 0.176703438f},
-std::array<float,2>{0.578868866f, 0.897642374f},
-std::array<float,2>{0.0319739319f, 0.788053989f},
-std::array<float,2>{0.888965011f, 0.0983109772f},
-std::array<float,2>{0.415334195f, 0.318649918f},
-std::array<float,2>{0.55282557f, 0.705751956f},
-std::array<float,2>{0.325769871f, 0.535170674f},
-std::array<float,2>{0.654373944f, 0.450858653f},
-std::array<float,2>{0.238319635f, 0.220396295f},
-std::array<float,2>{0.785369217f, 0.987986445f},
-std::array<float,2>{0.445177466f, 0.920074046f},
-std::array<float,2>{0.599310935f, 0.146704763f},
-std::array<float,2>{0.0939792097f, 0.385485619f},
-std::array<float,2>{0.969576418f, 0.62131542f},
-std::array<float,2>{0.134959072f, 0.628236353f},
-std::array<float,2>{0.817560792f, 0.310724378f},
-std::array<float,2>{0.286898434f, 0.0386290289f},
-std::array<float,2>{0.717018306f, 0.83741194f},
-std::array<float,2>{0.130739957f, 0.798293948f},
-std::array<float,2>{0.823583543f, 0.11413569f},
-std::array<float,2>{0.295877695f, 0.333762795f},
-std::array<float,2>{0.708253145f, 0.699923038f},
-std::array<float,2>{0.446101487f, 0.558755517f},
-std::array<float,2>{0.606144369f, 0.464570016f},
-std::array<float,2>{0.106399789f, 0.243859604f},
-std::array<float,2>{0.977552831f, 0.971631944f},
-std::array<float,2>{0.31913203f, 0.933993518f},
-std::array<float,2>{0.641671121f, 0.13693729f},
-std::array<float,2>{0.243932337f, 0.400232732f},
-std::array<float,2>{0.791770697f, 0.609216094f},
-std::array<float,2>{0.0438247956f, 0.649909377f},
-std::array<float,2>{0.880922556f, 0.286480546f},
-std::array<float,2>{0.411631316f, 0.0481579751f},
-std::array<float,2>{0.561136007f, 0.812731624f},
-std::array<float,2>{0.0651359409f, 0.950728655f},
-std::array<float,2>{0.940751433f, 0.199195698f},
-std::array<float,2>{0.478657573f, 0.497333765f},
-std::array<float,2>{0.592263341f, 0.512818456f},
-std::array<float,2>{0.27856636f, 0.734542787f},
-std::array<float,2>{0.724657357f, 0.374286473f},
-std::array<float,2>{0.162402451f, 0.071773909f},
-std::array<float,2>{0.85501653f, 0.751637697f},
-std::array<float,2>{0.399307549f, 0.85462302f},
-std::array<float,2>{0.505480289f, 0.020178562f},
-std::array<float,2>{0.0169052649f, 0.251679868f},
-std::array<float,2>{0.91101104f, 0.674218416f},
-std::array<float,2>{0.214483455f, 0.574227512f},
-std::array<float,2>{0.762880921f, 0.418010116f},
-std::array<float,2>{0.371774286f, 0.170396775f},
-std::array<float,2>{0.679268599f, 0.882854581f},
-std::array<float,2>{0.227716327f, 0.894196928f},
-std::array<float,2>{0.801676393f, 0.173786685f},
-std::array<float,2>{0.329681188f, 0.430935174f},
-std::array<float,2>{0.62885505f, 0.583062291f},
-std::array<float,2>{0.426795363f, 0.663991928f},
-std::array<float,2>{0.54572618f, 0.27818203f},
-std::array<float,2>{0.0500449166f, 0.0119565539f},
-std::array<float,2>{0.903697848f, 0.863104045f},
-std::array<float,2>{0.300393939f, 0.774198234f},
-std::array<float,2>{0.688868821f, 0.0797429606f},
-std::array<float,2>{0.153739661f, 0.353819221f},
-std::array<float,2>{0.841334224f, 0.719902158f},
-std::array<float,2>{0.118471354f, 0.519497335f},
-std::array<float,2>{0.997982919f, 0.476673126f},
-std::array<float,2>{0.459522665f, 0.209625602f},
-std::array<float,2>{0.617370963f, 0.961245775f},
-std::array<float,2>{0.00301608839f, 0.842851877f},
-std::array<float,2>{0.935797632f, 0.0345121175f},
-std::array<float,2>{0.382595718f, 0.307750046f},
-std::array<float,2>{0.523802817f, 0.629672408f},
-std::array<float,2>{0.356159508f, 0.618413031f},
-std::array<float,2>{0.664902031f, 0.389413118f},
-std::array<float,2>{0.202368021f, 0.141686171f},
-std::array<float,2>{0.777534723f, 0.915573895f},
-std::array<float,2>{0.489354849f, 0.990534604f},
-std::array<float,2>{0.568994701f, 0.226190045f},
-std::array<float,2>{0.0923575014f, 0.449142903f},
-std::array<float,2>{0.963608682f, 0.533987284f},
-std::array<float,2>{0.18321839f, 0.707575798f},
-std::array<float,2>{0.873788118f, 0.314819217f},
-std::array<float,2>{0.255790532f, 0.0956029892f},
-std::array<float,2>{0.743382633f, 0.783614933f},
-std::array<float,2>{0.190107465f, 0.874221206f},
-std::array<float,2>{0.768121302f, 0.000623525004f},
-std::array<float,2>{0.349628121f, 0.268235564f},
-std::array<float,2>{0.658226848f, 0.671725571f},
-std::array<float,2>{0.38738957f, 0.587709904f},
-std::array<float,2>{0.521852076f, 0.427496582f},
-std::array<float,2>{0.00797714945f, 0.185494184f},
-std::array<float,2>{0.926317513f, 0.904781938f},
-std::array<float,2>{0.260041475f, 0.959652007f},
-std::array<float,2>{0.739977062f, 0.211663544f},
-std::array<float,2>{0.176622644f, 0.473251641f},
-std::array<float,2>{0.862508774f, 0.528504968f},
-std::array<float,2>{0.0799950361f, 0.726594508f},
-std::array<float,2>{0.960447967f, 0.346628577f},
-std::array<float,2>{0.494158566f, 0.0900658518f},
-std::array<float,2>{0.571798861f, 0.771710396f},
-std::array<float,2>{0.062352296f, 0.906718314f},
-std::array<float,2>{0.895525038f, 0.155796602f},
-std::array<float,2>{0.436656654f, 0.375860453f},
-std::array<float,2>{0.531630576f, 0.615543246f},
-std::array<float,2>{0.343473792f, 0.633323252f},
-std::array<float,2>{0.632893026f, 0.302117258f},
-std::array<float,2>{0.222099155f, 0.0401851833f},
-std::array<float,2>{0.810765982f, 0.829901099f},
-std::array<float,2>{0.464021683f, 0.792372108f},
-std::array<float,2>{0.615389645f, 0.107264616f},
-std::array<float,2>{0.111262597f, 0.321162999f},
-std::array<float,2>{0.987391829f, 0.71756357f},
-std::array<float,2>{0.141253114f, 0.540354133f},
-std::array<float,2>{0.828854144f, 0.440852642f},
-std::array<float,2>{0.30826202f, 0.227568477f},
-std::array<float,2>{0.699827611f, 0.993945777f},
-std::array<float,2>{0.170879588f, 0.979791939f},
-std::array<float,2>{0.845798492f, 0.234447598f},
-std::array<float,2>{0.266069382f, 0.456381857f},
-std::array<float,2>{0.728207469f, 0.551404536f},
-std::array<float,2>{0.472625911f, 0.692604721f},
-std::array<float,2>{0.58449471f, 0.33798185f},
-std::array<float,2>{0.07725247f, 0.123661779f},
-std::array<float,2>{0.948980987f, 0.810005248f},
-std::array<float,2>{0.363691241f, 0.822773993f},
-std::array<float,2>{0.683915794f, 0.0594511963f},
-std::array<float,2>{0.208773345f, 0.291905433f},
-std::array<float,2>{0.752090752f, 0.645709217f},
-std::array<float,2>{0.0260685161f, 0.598732054f},
-std::array<float,2>{0.914809763f, 0.393616945f},
-std::array<float,2>{0.395064771f, 0.127324477f},
-std::array<float,2>{0.50987488f, 0.92619127f},
-std::array<float,2>{0.101106554f, 0.765138328f},
-std::array<float,2>{0.972708941f, 0.0668658391f},
-std::array<float,2>{0.440025121f, 0.360286385f},
-std::array<float,2>{0.596834719f, 0.742918968f},
-std::array<float,2>{0.281782568f, 0.505672812f},
-std::array<float,2>{0.712574899f, 0.485284299f},
-std::array<float,2>{0.137854785f, 0.194057032f},
-std::array<float,2>{0.816184878f, 0.938090622f},
-std::array<float,2>{0.419830322f, 0.875544012f},
-std::array<float,2>{0.549331486f, 0.159454986f},
-std::array<float,2>{0.03886199f, 0.410334766f},
-std::array<float,2>{0.886059105f, 0.564209282f},
-std::array<float,2>{0.236478791f, 0.680347443f},
-std::array<float,2>{0.785024107f, 0.263410896f},
-std::array<float,2>{0.324091554f, 0.0253509562f},
-std::array<float,2>{0.649876833f, 0.85104543f},
-std::array<float,2>{0.216138482f, 0.794853389f},
-std::array<float,2>{0.761049092f, 0.105060339f},
-std::array<float,2>{0.367642015f, 0.326023787f},
-std::array<float,2>{0.67364186f, 0.713211417f},
-std::array<float,2>{0.405340672f, 0.545713842f},
-std::array<float,2>{0.503661871f, 0.443333894f},
-std::array<float,2>{0.0203177352f, 0.2307951f},
-std::array<float,2>{0.907095134f, 0.999008358f},
-std::array<float,2>{0.276351601f, 0.910841703f},
-std::array<float,2>{0.720299363f, 0.151857704f},
-std::array<float,2>{0.1576024f, 0.380112648f},
-std::array<float,2>{0.857812524f, 0.61072278f},
-std::array<float,2>{0.0680364966f, 0.640453458f},
-std::array<float,2>{0.943421662f, 0.298938304f},
-std::array<float,2>{0.483881384f, 0.0462139137f},
-std::array<float,2>{0.58595401f, 0.83359921f},
-std::array<float,2>{0.0427927934f, 0.955931008f},
-std::array<float,2>{0.877225339f, 0.217199966f},
-std::array<float,2>{0.409435451f, 0.470750839f},
-std::array<float,2>{0.55782491f, 0.526631534f},
-std::array<float,2>{0.312797487f, 0.731925607f},
-std::array<float,2>{0.644895077f, 0.351056427f},
-std::array<float,2>{0.249642059f, 0.0882203281f},
-std::array<float,2>{0.793724537f, 0.766298056f},
-std::array<float,2>{0.449992955f, 0.870545626f},
-std::array<float,2>{0.602078259f, 0.00604038686f},
-std::array<float,2>{0.102914847f, 0.270433366f},
-std::array<float,2>{0.984213114f, 0.666878164f},
-std::array<float,2>{0.125386015f, 0.591677189f},
-std::array<float,2>{0.827959001f, 0.422149748f},
-std::array<float,2>{0.291119397f, 0.183021292f},
-std::array<float,2>{0.704720974f, 0.901474297f},
-std::array<float,2>{0.187351614f, 0.881465673f},
-std::array<float,2>{0.869389832f, 0.162618384f},
-std::array<float,2>{0.250708044f, 0.407880098f},
-std::array<float,2>{0.74886477f, 0.56677407f},
-std::array<float,2>{0.484538108f, 0.684616268f},
-std::array<float,2>{0.564403474f, 0.260289162f},
-std::array<float,2>{0.0875156969f, 0.0275771189f},
-std::array<float,2>{0.967205405f, 0.846438408f},
-std::array<float,2>{0.352342784f, 0.759814322f},
-std::array<float,2>{0.671737731f, 0.0653622448f},
-std::array<float,2>{0.197503492f, 0.363578051f},
-std::array<float,2>{0.776325941f, 0.748297393f},
-std::array<float,2>{0.00613206765f, 0.501809299f},
-std::array<float,2>{0.931689322f, 0.488821208f},
-std::array<float,2>{0.377922446f, 0.1877224f},
-std::array<float,2>{0.528167844f, 0.942225575f},
-std::array<float,2>{0.123664886f, 0.826227248f},
-std::array<float,2>{0.994871974f, 0.0574513227f},
-std::array<float,2>{0.456663936f, 0.294939339f},
-std::array<float,2>{0.621905565f, 0.64429307f},
-std::array<float,2>{0.304451525f, 0.596760392f},
-std::array<float,2>{0.692888021f, 0.394568771f},
-std::array<float,2>{0.148679435f, 0.129009515f},
-std::array<float,2>{0.839525282f, 0.924723983f},
-std::array<float,2>{0.425244749f, 0.982968211f},
-std::array<float,2>{0.542783737f, 0.238846287f},
-std::array<float,2>{0.0518119521f, 0.457363039f},
-std::array<float,2>{0.8993029f, 0.547189891f},
-std::array<float,2>{0.233851895f, 0.687995553f},
-std::array<float,2>{0.800741911f, 0.341050297f},
-std::array<float,2>{0.334595233f, 0.117710292f},
-std::array<float,2>{0.631676674f, 0.805814266f},
-std::array<float,2>{0.146956876f, 0.857579172f},
-std::array<float,2>{0.835043967f, 0.0190422703f},
-std::array<float,2>{0.312463641f, 0.25458473f},
-std::array<float,2>{0.695374489f, 0.675889611f},
-std::array<float,2>{0.466301233f, 0.571380556f},
-std::array<float,2>{0.612540722f, 0.417632848f},
-std::array<float,2>{0.115632288f, 0.167016432f},
-std::array<float,2>{0.989478707f, 0.889520288f},
-std::array<float,2>{0.336308241f, 0.948805213f},
-std::array<float,2>{0.638522446f, 0.200798765f},
-std::array<float,2>{0.226269439f, 0.493961155f},
-std::array<float,2>{0.808411896f, 0.511149347f},
-std::array<float,2>{0.0571381971f, 0.742156208f},
-std::array<float,2>{0.891693532f, 0.370160609f},
-std::array<float,2>{0.430683345f, 0.0747280791f},
-std::array<float,2>{0.537581682f, 0.754584074f},
-std::array<float,2>{0.0847077221f, 0.930508554f},
-std::array<float,2>{0.954819679f, 0.133500621f},
-std::array<float,2>{0.49852252f, 0.406228095f},
-std::array<float,2>{0.576652765f, 0.603025317f},
-std::array<float,2>{0.265351981f, 0.652427137f},
-std::array<float,2>{0.737503767f, 0.281390309f},
-std::array<float,2>{0.175662488f, 0.0544798374f},
-std::array<float,2>{0.864597142f, 0.816892862f},
-std::array<float,2>{0.383732706f, 0.80237478f},
-std::array<float,2>{0.517539024f, 0.112914301f},
-std::array<float,2>{0.0144430287f, 0.328955621f},
-std::array<float,2>{0.922753155f, 0.699213564f},
-std::array<float,2>{0.193442866f, 0.558383286f},
-std::array<float,2>{0.77028352f, 0.46835354f},
-std::array<float,2>{0.346444309f, 0.247889027f},
-std::array<float,2>{0.661027193f, 0.974848449f},
-std::array<float,2>{0.24163112f, 0.985735714f},
-std::array<float,2>{0.788109779f, 0.221350953f},
-std::array<float,2>{0.327095598f, 0.451685369f},
-std::array<float,2>{0.654010236f, 0.538839221f},
-std::array<float,2>{0.417228431f, 0.704348028f},
-std::array<float,2>{0.552071869f, 0.317167729f},
-std::array<float,2>{0.033385057f, 0.101456016f},
-std::array<float,2>{0.887429297f, 0.785882115f},
-std::array<float,2>{0.287237287f, 0.838099241f},
-std::array<float,2>{0.715107799f, 0.0359535627f},
-std::array<float,2>{0.1343894f, 0.309288502f},
-std::array<float,2>{0.819956243f, 0.625279367f},
-std::array<float,2>{0.0976352021f, 0.623973072f},
-std::array<float,2>{0.971356094f, 0.382836699f},
-std::array<float,2>{0.442022204f, 0.146342471f},
-std::array<float,2>{0.6001665f, 0.918443859f},
-std::array<float,2>{0.0288884677f, 0.77825886f},
-std::array<float,2>{0.920535028f, 0.0835887268f},
-std::array<float,2>{0.39171809f, 0.356123745f},
-std::array<float,2>{0.514061034f, 0.7237885f},
-std::array<float,2>{0.361214966f, 0.522756875f},
-std::array<float,2>{0.681357026f, 0.484332085f},
-std::array<float,2>{0.20446752f, 0.204418451f},
-std::array<float,2>{0.756474674f, 0.968064308f},
-std::array<float,2>{0.472786456f, 0.894908667f},
-std::array<float,2>{0.58019501f, 0.179433107f},
-std::array<float,2>{0.0724678785f, 0.434130102f},
-std::array<float,2>{0.952140212f, 0.579835653f},
-std::array<float,2>{0.166082069f, 0.657868683f},
-std::array<float,2>{0.851332068f, 0.274229944f},
-std::array<float,2>{0.273397774f, 0.00798765849f},
-std::array<float,2>{0.733413577f, 0.864737451f},
-std::array<float,2>{0.161052957f, 0.752130389f},
-std::array<float,2>{0.851732671f, 0.0741616413f},
-std::array<float,2>{0.279627949f, 0.372647703f},
-std::array<float,2>{0.72368288f, 0.738192916f},
-std::array<float,2>{0.477018118f, 0.515054047f},
-std::array<float,2>{0.590768158f, 0.49857232f},
-std::array<float,2>{0.0630454272f, 0.195953771f},
-std::array<float,2>{0.939279437f, 0.951582253f},
-std::array<float,2>{0.373996556f, 0.885749638f},
-std::array<float,2>{0.676643014f, 0.16797027f},
-std::array<float,2>{0.212044939f, 0.421333849f},
-std::array<float,2>{0.764335871f, 0.577122748f},
-std::array<float,2>{0.0193155129f, 0.673282385f},
-std::array<float,2>{0.912151694f, 0.25280574f},
-std::array<float,2>{0.401283652f, 0.0233731754f},
-std::array<float,2>{0.507798254f, 0.853138566f},
-std::array<float,2>{0.10784936f, 0.970136642f},
-std::array<float,2>{0.978571475f, 0.246040434f},
-std::array<float,2>{0.447321773f, 0.46162653f},
-std::array<float,2>{0.608435571f, 0.562137485f},
-std::array<float,2>{0.294192255f, 0.702880204f},
-std::array<float,2>{0.709685385f, 0.335751653f},
-std::array<float,2>{0.131906494f, 0.116859183f},
-std::array<float,2>{0.821438611f, 0.799883246f},
-std::array<float,2>{0.413178056f, 0.815648019f},
-std::array<float,2>{0.558594227f, 0.0497385673f},
-std::array<float,2>{0.0460923947f, 0.287469536f},
-std::array<float,2>{0.880827963f, 0.651317298f},
-std::array<float,2>{0.245156348f, 0.607193112f},
-std::array<float,2>{0.789824486f, 0.40092966f},
-std::array<float,2>{0.317127943f, 0.139347121f},
-std::array<float,2>{0.643358409f, 0.936325133f},
-std::array<float,2>{0.200205401f, 0.916170895f},
-std::array<float,2>{0.781163335f, 0.143290907f},
-std::array<float,2>{0.357908994f, 0.387601674f},
-std::array<float,2>{0.666458845f, 0.619164467f},
-std::array<float,2>{0.380809814f, 0.63129741f},
-std::array<float,2>{0.526166975f, 0.305090964f},
-std::array<float,2>{0.000188553066f, 0.0317306928f},
-std::array<float,2>{0.933649957f, 0.841643691f},
-std::array<float,2>{0.256497592f, 0.783071756f},
-std::array<float,2>{0.745795488f, 0.0970631465f},
-std::array<float,2>{0.180057228f, 0.314084828f},
-std::array<float,2>{0.871805131f, 0.709211648f},
-std::array<float,2>{0.0899424776f, 0.533186436f},
-std::array<float,2>{0.961342216f, 0.446501076f},
-std::array<float,2>{0.492182612f, 0.224140987f},
-std::array<float,2>{0.566729546f, 0.988866448f},
-std::array<float,2>{0.0483189039f, 0.861278296f},
-std::array<float,2>{0.905219376f, 0.0145839984f},
-std::array<float,2>{0.427889496f, 0.281162888f},
-std::array<float,2>{0.544562757f, 0.66190958f},
-std::array<float,2>{0.33146584f, 0.585097194f},
-std::array<float,2>{0.626108348f, 0.433147728f},
-std::array<float,2>{0.22969839f, 0.174717605f},
-std::array<float,2>{0.803426743f, 0.891886413f},
-std::array<float,2>{0.457969606f, 0.96324259f},
-std::array<float,2>{0.620741963f, 0.208367467f},
-std::array<float,2>{0.119274653f, 0.479520738f},
-std::array<float,2>{0.998512983f, 0.516949654f},
-std::array<float,2>{0.155755207f, 0.720962226f},
-std::array<float,2>{0.842367589f, 0.35213387f},
-std::array<float,2>{0.298070371f, 0.0817038044f},
-std::array<float,2>{0.690065444f, 0.776780903f},
-std::array<float,2>{0.220123962f, 0.830390275f},
-std::array<float,2>{0.810111165f, 0.0416120812f},
-std::array<float,2>{0.341631204f, 0.30408603f},
-std::array<float,2>{0.636384308f, 0.635365129f},
-std::array<float,2>{0.434644908f, 0.613599718f},
-std::array<float,2>{0.533819556f, 0.378584683f},
-std::array<float,2>{0.0598559976f, 0.153037772f},
-std::array<float,2>{0.897599101f, 0.910021007f},
-std::array<float,2>{0.305840313f, 0.994524717f},
-std::array<float,2>{0.702109277f, 0.229927629f},
-std::array<float,2>{0.144418463f, 0.438433737f},
-std::array<float,2>{0.830564499f, 0.542729378f},
-std::array<float,2>{0.11323823f, 0.715118945f},
-std::array<float,2>{0.985792875f, 0.323196948f},
-std::array<float,2>{0.460949242f, 0.109321877f},
-std::array<float,2>{0.615081847f, 0.789416969f},
-std::array<float,2>{0.0107425414f, 0.903841972f},
-std::array<float,2>{0.928699493f, 0.186717287f},
-std::array<float,2>{0.389387667f, 0.428050876f},
-std::array<float,2>{0.519989312f, 0.588305712f},
-std::array<float,2>{0.349526942f, 0.669493496f},
-std::array<float,2>{0.656391084f, 0.267438471f},
-std::array<float,2>{0.188209146f, 0.00285380892f},
-std::array<float,2>{0.767012358f, 0.87178266f},
-std::array<float,2>{0.49222967f, 0.770232737f},
-std::array<float,2>{0.573603451f, 0.0929491445f},
-std::array<float,2>{0.0807818323f, 0.344069183f},
-std::array<float,2>{0.958507776f, 0.729140341f},
-std::array<float,2>{0.178881049f, 0.529348016f},
-std::array<float,2>{0.859556675f, 0.474971771f},
-std::array<float,2>{0.257817835f, 0.213677019f},
-std::array<float,2>{0.740457416f, 0.958690941f},
-std::array<float,2>{0.138690934f, 0.940583408f},
-std::array<float,2>{0.813354254f, 0.191507682f},
-std::array<float,2>{0.28437382f, 0.487976134f},
-std::array<float,2>{0.712900937f, 0.506828666f},
-std::array<float,2>{0.439382136f, 0.744384766f},
-std::array<float,2>{0.59502238f, 0.36230129f},
-std::array<float,2>{0.097853817f, 0.0695144534f},
-std::array<float,2>{0.976274312f, 0.762698352f},
-std::array<float,2>{0.320593387f, 0.849376857f},
-std::array<float,2>{0.652278781f, 0.0267464966f},
-std::array<float,2>{0.235622421f, 0.265144527f},
-std::array<float,2>{0.783045769f, 0.683366776f},
-std::array<float,2>{0.0364518352f, 0.566089571f},
-std::array<float,2>{0.884429574f, 0.413957924f},
-std::array<float,2>{0.420134664f, 0.156260327f},
-std::array<float,2>{0.548750937f, 0.878503203f},
-std::array<float,2>{0.0751780644f, 0.810935438f},
-std::array<float,2>{0.945811808f, 0.121190161f},
-std::array<float,2>{0.469188452f, 0.337759614f},
-std::array<float,2>{0.58238256f, 0.6948241f},
-std::array<float,2>{0.268196851f, 0.554133475f},
-std::array<float,2>{0.728607833f, 0.454180598f},
-std::array<float,2>{0.169369563f, 0.238104686f},
-std::array<float,2>{0.844825804f, 0.977646768f},
-std::array<float,2>{0.396688163f, 0.928686678f},
-std::array<float,2>{0.508157611f, 0.125673056f},
-std::array<float,2>{0.0237799585f, 0.39162159f},
-std::array<float,2>{0.916617036f, 0.60128516f},
-std::array<float,2>{0.20928359f, 0.64836967f},
-std::array<float,2>{0.751625776f, 0.290911257f},
-std::array<float,2>{0.366388887f, 0.0614811145f},
-std::array<float,2>{0.685855746f, 0.821415842f},
-std::array<float,2>{0.204667613f, 0.779429793f},
-std::array<float,2>{0.755957067f, 0.0856398419f},
-std::array<float,2>{0.360745281f, 0.358533263f},
-std::array<float,2>{0.680738091f, 0.725308299f},
-std::array<float,2>{0.392301679f, 0.520652533f},
-std::array<float,2>{0.514617145f, 0.481385082f},
-std::array<float,2>{0.0285200961f, 0.206750616f},
-std::array<float,2>{0.919987142f, 0.966742396f},
-std::array<float,2>{0.272618324f, 0.898091018f},
-std::array<float,2>{0.734039307f, 0.175982997f},
-std::array<float,2>{0.166815504f, 0.435931623f},
-std::array<float,2>{0.8507936f, 0.581574678f},
-std::array<float,2>{0.0727939904f, 0.658620596f},
-std::array<float,2>{0.951586306f, 0.276758164f},
-std::array<float,2>{0.473213315f, 0.0104478886f},
-std::array<float,2>{0.580803096f, 0.86591953f},
-std::array<float,2>{0.0338693336f, 0.987752736f},
-std::array<float,2>{0.886990368f, 0.219985381f},
-std::array<float,2>{0.417718172f, 0.450267136f},
-std::array<float,2>{0.552578688f, 0.535753131f},
-std::array<float,2>{0.326424748f, 0.705511689f},
-std::array<float,2>{0.653459609f, 0.319157302f},
-std::array<float,2>{0.241868094f, 0.0978604034f},
-std::array<float,2>{0.789036214f, 0.787220716f},
-std::array<float,2>{0.441527635f, 0.837242305f},
-std::array<float,2>{0.600041509f, 0.0382184125f},
-std::array<float,2>{0.0970266908f, 0.311267972f},
-std::array<float,2>{0.970755935f, 0.628784478f},
-std::array<float,2>{0.133818313f, 0.621608078f},
-std::array<float,2>{0.819588363f, 0.384842664f},
-std::array<float,2>{0.287943393f, 0.147456378f},
-std::array<float,2>{0.715729833f, 0.920793414f},
-std::array<float,2>{0.17511414f, 0.932385981f},
-std::array<float,2>{0.864789128f, 0.136175781f},
-std::array<float,2>{0.264814854f, 0.403800428f},
-std::array<float,2>{0.737998009f, 0.604351342f},
-std::array<float,2>{0.498983473f, 0.655702651f},
-std::array<float,2>{0.576670051f, 0.285152465f},
-std::array<float,2>{0.0843816474f, 0.0524869338f},
-std::array<float,2>{0.954446137f, 0.820075333f},
-std::array<float,2>{0.34599787f, 0.804392755f},
-std::array<float,2>{0.660571754f, 0.11019256f},
-std::array<float,2>{0.194192588f, 0.331194788f},
-std::array<float,2>{0.770008624f, 0.696438789f},
-std::array<float,2>{0.0139461039f, 0.55564481f},
-std::array<float,2>{0.922041595f, 0.466003656f},
-std::array<float,2>{0.383017361f, 0.24889414f},
-std::array<float,2>{0.516722262f, 0.97400862f},
-std::array<float,2>{0.115753308f, 0.856224537f},
-std::array<float,2>{0.989979446f, 0.0168581717f},
-std::array<float,2>{0.466640323f, 0.257786155f},
-std::array<float,2>{0.613023102f, 0.678814232f},
-std::array<float,2>{0.311566055f, 0.573794484f},
-std::array<float,2>{0.696110606f, 0.414400041f},
-std::array<float,2>{0.147296667f, 0.165154666f},
-std::array<float,2>{0.835473716f, 0.887631536f},
-std::array<float,2>{0.431235611f, 0.946567953f},
-std::array<float,2>{0.53789413f, 0.201319858f},
-std::array<float,2>{0.0567927063f, 0.49433893f},
-std::array<float,2>{0.892432153f, 0.508203208f},
-std::array<float,2>{0.226052046f, 0.739878595f},
-std::array<float,2>{0.807742178f, 0.368385047f},
-std::array<float,2>{0.336446583f, 0.077283904f},
-std::array<float,2>{0.637746751f, 0.757088065f},
-std::array<float,2>{0.149397686f, 0.82573545f},
-std::array<float,2>{0.839065731f, 0.0548396334f},
-std::array<float,2>{0.303866297f, 0.294594646f},
-std::array<float,2>{0.692701578f, 0.641628146f},
-std::array<float,2>{0.456498832f, 0.594837785f},
-std::array<float,2>{0.621337891f, 0.396517932f},
-std::array<float,2>{0.123048641f, 0.132517606f},
-std::array<float,2>{0.994526327f, 0.922868907f},
-std::array<float,2>{0.334373236f, 0.981844485f},
-std::array<float,2>{0.630967617f, 0.241997197f},
-std::array<float,2>{0.233962089f, 0.459198564f},
-std::array<float,2>{0.799901903f, 0.549660146f},
-std::array<float,2>{0.0525090918f, 0.690866828f},
-std::array<float,2>{0.898706794f, 0.343526423f},
-std::array<float,2>{0.425695032f, 0.119759187f},
-std::array<float,2>{0.542332411f, 0.80711323f},
-std::array<float,2>{0.0871507451f, 0.879345119f},
-std::array<float,2>{0.967555106f, 0.160340995f},
-std::array<float,2>{0.485036731f, 0.409576118f},
-std::array<float,2>{0.563904285f, 0.570168436f},
-std::array<float,2>{0.250135422f, 0.686115324f},
-std::array<float,2>{0.748261273f, 0.259081274f},
-std::array<float,2>{0.186665788f, 0.0312059894f},
-std::array<float,2>{0.869913757f, 0.844449937f},
-std::array<float,2>{0.377046287f, 0.758813322f},
-std::array<float,2>{0.52751112f, 0.0642915443f},
-std::array<float,2>{0.00642629014f, 0.366940111f},
-std::array<float,2>{0.932186663f, 0.7474038f},
-std::array<float,2>{0.198192537f, 0.501973331f},
-std::array<float,2>{0.775576949f, 0.490654081f},
-std::array<float,2>{0.351956129f, 0.191325366f},
-std::array<float,2>{0.670946658f, 0.943951607f},
-std::array<float,2>{0.249261677f, 0.95322454f},
-std::array<float,2>{0.793043137f, 0.216466069f},
-std::array<float,2>{0.313229054f, 0.469466835f},
-std::array<float,2>{0.645447552f, 0.524580002f},
-std::array<float,2>{0.40993914f, 0.732815564f},
-std::array<float,2>{0.558356285f, 0.34898448f},
-std::array<float,2>{0.0422389843f, 0.0876601413f},
-std::array<float,2>{0.877928734f, 0.768898606f},
-std::array<float,2>{0.291678518f, 0.868982911f},
-std::array<float,2>{0.704475582f, 0.00476662349f},
-std::array<float,2>{0.125870466f, 0.272670299f},
-std::array<float,2>{0.827472687f, 0.665953696f},
-std::array<float,2>{0.103276178f, 0.592840075f},
-std::array<float,2>{0.983831286f, 0.424203813f},
-std::array<float,2>{0.449591607f, 0.181582019f},
-std::array<float,2>{0.601962268f, 0.899795055f},
-std::array<float,2>{0.0199878868f, 0.79633224f},
-std::array<float,2>{0.906724095f, 0.103113957f},
-std::array<float,2>{0.40585953f, 0.327893466f},
-std::array<float,2>{0.503139496f, 0.712053418f},
-std::array<float,2>{0.367917567f, 0.543489635f},
-std::array<float,2>{0.672952473f, 0.444893032f},
-std::array<float,2>{0.21631819f, 0.233650327f},
-std::array<float,2>{0.761421442f, 0.997970879f},
-std::array<float,2>{0.484139949f, 0.913710773f},
-std::array<float,2>{0.586549997f, 0.150003955f},
-std::array<float,2>{0.0675924122f, 0.382087827f},
-std::array<float,2>{0.944190085f, 0.611849189f},
-std::array<float,2>{0.158149123f, 0.637831688f},
-std::array<float,2>{0.858366191f, 0.298338056f},
-std::array<float,2>{0.275449902f, 0.0444443412f},
-std::array<float,2>{0.720020294f, 0.834899008f},
-std::array<float,2>{0.169572756f, 0.810274005f},
-std::array<float,2>{0.845289111f, 0.123166054f},
-std::array<float,2>{0.268023133f, 0.338669866f},
-std::array<float,2>{0.729178607f, 0.693016827f},
-std::array<float,2>{0.469652385f, 0.550914705f},
-std::array<float,2>{0.582914472f, 0.456611902f},
-std::array<float,2>{0.0743316337f, 0.235226214f},
-std::array<float,2>{0.945661306f, 0.98008585f},
-std::array<float,2>{0.367068201f, 0.926323354f},
-std::array<float,2>{0.686059952f, 0.127924323f},
-std::array<float,2>{0.209710926f, 0.394438893f},
-std::array<float,2>{0.751374006f, 0.59932214f},
-std::array<float,2>{0.0242998656f, 0.646432161f},
-std::array<float,2>{0.916328311f, 0.291100055f},
-std::array<float,2>{0.397226989f, 0.0586737059f},
-std::array<float,2>{0.508328438f, 0.822660208f},
-std::array<float,2>{0.0981576294f, 0.937546134f},
-std::array<float,2>{0.975979924f, 0.193540618f},
-std::array<float,2>{0.438898951f, 0.484392434f},
-std::array<float,2>{0.595358133f, 0.505026877f},
-std::array<float,2>{0.284782022f, 0.742463708f},
-std::array<float,2>{0.713555634f, 0.359463871f},
-std::array<float,2>{0.139182851f, 0.067048125f},
-std::array<float,2>{0.812958479f, 0.764775217f},
-std::array<float,2>{0.420719206f, 0.851085067f},
-std::array<float,2>{0.547929823f, 0.0245723464f},
-std::array<float,2>{0.0370996706f, 0.262764275f},
-std::array<float,2>{0.88400954f, 0.68003428f},
-std::array<float,2>{0.235971898f, 0.563957453f},
-std::array<float,2>{0.782274663f, 0.410699755f},
-std::array<float,2>{0.321061343f, 0.16000466f},
-std::array<float,2>{0.651437163f, 0.875240386f},
-std::array<float,2>{0.187859282f, 0.905046999f},
-std::array<float,2>{0.767397523f, 0.184735641f},
-std::array<float,2>{0.348764002f, 0.427188724f},
-std::array<float,2>{0.656814694f, 0.587333262f},
-std::array<float,2>{0.388716221f, 0.671370924f},
-std::array<float,2>{0.52030766f, 0.267604977f},
-std::array<float,2>{0.0113520091f, 0.000319026003f},
-std::array<float,2>{0.927970886f, 0.874572098f},
-std::array<float,2>{0.25840497f, 0.77198118f},
-std::array<float,2>{0.740851223f, 0.0905376971f},
-std::array<float,2>{0.179372266f, 0.345740587f},
-std::array<float,2>{0.86003989f, 0.727051914f},
-std::array<float,2>{0.0801098943f, 0.528887033f},
-std::array<float,2>{0.958153725f, 0.473112851f},
-std::array<float,2>{0.492969602f, 0.211082965f},
-std::array<float,2>{0.573814094f, 0.959349811f},
-std::array<float,2>{0.0600876547f, 0.829464197f},
-std::array<float,2>{0.89798981f, 0.0408361182f},
-std::array<float,2>{0.435216635f, 0.302269548f},
-std::array<float,2>{0.533417523f, 0.633012414f},
-std::array<float,2>{0.341207415f, 0.616190016f},
-std::array<float,2>{0.635790408f, 0.375100076f},
-std::array<float,2>{0.220686793f, 0.155519798f},
-std::array<float,2>{0.809875965f, 0.907072186f},
-std::array<float,2>{0.461612314f, 0.993306756f},
-std::array<float,2>{0.614500165f, 0.228174508f},
-std::array<float,2>{0.112703137f, 0.441378087f},
-std::array<float,2>{0.986292839f, 0.540945172f},
-std::array<float,2>{0.143644869f, 0.71728009f},
-std::array<float,2>{0.830657959f, 0.320519328f},
-std::array<float,2>{0.306278646f, 0.106884889f},
-std::array<float,2>{0.701440752f, 0.792526364f},
-std::array<float,2>{0.23044838f, 0.86248678f},
-std::array<float,2>{0.802790046f, 0.0122082578f},
-std::array<float,2>{0.331795335f, 0.277383626f},
-std::array<float,2>{0.626688778f, 0.663534582f},
-std::array<float,2>{0.428385347f, 0.583546579f},
-std::array<float,2>{0.544201195f, 0.431247354f},
-std::array<float,2>{0.0486058965f, 0.17289573f},
-std::array<float,2>{0.904431939f, 0.893756807f},
-std::array<float,2>{0.29876253f, 0.961708665f},
-std::array<float,2>{0.689559877f, 0.209108233f},
-std::array<float,2>{0.155900598f, 0.477460057f},
-std::array<float,2>{0.841809273f, 0.519014716f},
-std::array<float,2>{0.119648747f, 0.720702708f},
-std::array<float,2>{0.99896735f, 0.354388714f},
-std::array<float,2>{0.457196146f, 0.0791752562f},
-std::array<float,2>{0.620584548f, 0.77356869f},
-std::array<float,2>{0.000742194417f, 0.9150846f},
-std::array<float,2>{0.934528887f, 0.142433539f},
-std::array<float,2>{0.380237907f, 0.389035761f},
-std::array<float,2>{0.525811911f, 0.618721902f},
-std::array<float,2>{0.35823071f, 0.629017651f},
-std::array<float,2>{0.666674137f, 0.308289498f},
-std::array<float,2>{0.200762108f, 0.0349498168f},
-std::array<float,2>{0.780311167f, 0.843287051f},
-std::array<float,2>{0.491504639f, 0.784094691f},
-std::array<float,2>{0.56709224f, 0.0949140191f},
-std::array<float,2>{0.0907282308f, 0.315407127f},
-std::array<float,2>{0.961875319f, 0.707318068f},
-std::array<float,2>{0.18064642f, 0.533242106f},
-std::array<float,2>{0.871434808f, 0.448673338f},
-std::array<float,2>{0.256306708f, 0.225940943f},
-std::array<float,2>{0.745419204f, 0.990973115f},
-std::array<float,2>{0.132598519f, 0.971047997f},
-std::array<float,2>{0.821980774f, 0.243220493f},
-std::array<float,2>{0.294548303f, 0.463966519f},
-std::array<float,2>{0.709186852f, 0.559321523f},
-std::array<float,2>{0.447816461f, 0.699456394f},
-std::array<float,2>{0.609159589f, 0.333176583f},
-std::array<float,2>{0.10834147f, 0.113546573f},
-std::array<float,2>{0.979299247f, 0.798552334f},
-std::array<float,2>{0.316791803f, 0.813210845f},
-std::array<float,2>{0.642872751f, 0.0483571514f},
-std::array<float,2>{0.246073306f, 0.287030429f},
-std::array<float,2>{0.789388597f, 0.649814427f},
-std::array<float,2>{0.0468038246f, 0.608542979f},
-std::array<float,2>{0.880125225f, 0.399716914f},
-std::array<float,2>{0.413802028f, 0.137473062f},
-std::array<float,2>{0.559562266f, 0.934496462f},
-std::array<float,2>{0.0627496839f, 0.751447737f},
-std::array<float,2>{0.938517153f, 0.0722226948f},
-std::array<float,2>{0.477112412f, 0.374959201f},
-std::array<float,2>{0.590277731f, 0.735096991f},
-std::array<float,2>{0.280149996f, 0.513430119f},
-std::array<float,2>{0.724351346f, 0.497736335f},
-std::array<float,2>{0.16062969f, 0.198423564f},
-std::array<float,2>{0.852456868f, 0.95058322f},
-std::array<float,2>{0.400559872f, 0.883511782f},
-std::array<float,2>{0.507112384f, 0.170852959f},
-std::array<float,2>{0.0187763497f, 0.41872865f},
-std::array<float,2>{0.912991941f, 0.574778974f},
-std::array<float,2>{0.212819099f, 0.67438966f},
-std::array<float,2>{0.763868093f, 0.251259297f},
-std::array<float,2>{0.373132348f, 0.019988982f},
-std::array<float,2>{0.676219463f, 0.855417609f},
-std::array<float,2>{0.239184842f, 0.785196304f},
-std::array<float,2>{0.785645366f, 0.100693755f},
-std::array<float,2>{0.325456411f, 0.316502005f},
-std::array<float,2>{0.655203998f, 0.704602122f},
-std::array<float,2>{0.415901512f, 0.538523734f},
-std::array<float,2>{0.553683043f, 0.451218575f},
-std::array<float,2>{0.0312538147f, 0.220942274f},
-std::array<float,2>{0.889642119f, 0.98593694f},
-std::array<float,2>{0.286560357f, 0.918916464f},
-std::array<float,2>{0.717744887f, 0.145852938f},
-std::array<float,2>{0.135703191f, 0.383477926f},
-std::array<float,2>{0.818166852f, 0.623342693f},
-std::array<float,2>{0.0945885777f, 0.625521123f},
-std::array<float,2>{0.969020247f, 0.30860126f},
-std::array<float,2>{0.444374859f, 0.035571374f},
-std::array<float,2>{0.598965287f, 0.83886379f},
-std::array<float,2>{0.0293584205f, 0.968410909f},
-std::array<float,2>{0.919119239f, 0.204946518f},
-std::array<float,2>{0.392638236f, 0.483528525f},
-std::array<float,2>{0.512557209f, 0.523409307f},
-std::array<float,2>{0.362676591f, 0.72428906f},
-std::array<float,2>{0.681996226f, 0.355574846f},
-std::array<float,2>{0.205377817f, 0.0831977949f},
-std::array<float,2>{0.755832434f, 0.777463853f},
-std::array<float,2>{0.476477772f, 0.865144193f},
-std::array<float,2>{0.578243971f, 0.00830914173f},
-std::array<float,2>{0.0720163807f, 0.273612261f},
-std::array<float,2>{0.950111151f, 0.657577276f},
-std::array<float,2>{0.164423794f, 0.579457045f},
-std::array<float,2>{0.848477721f, 0.434009731f},
-std::array<float,2>{0.270811319f, 0.178762436f},
-std::array<float,2>{0.732385159f, 0.895465136f},
-std::array<float,2>{0.144584507f, 0.888770759f},
-std::array<float,2>{0.833488882f, 0.16795674f},
-std::array<float,2>{0.308853835f, 0.417250067f},
-std::array<float,2>{0.698240817f, 0.572122991f},
-std::array<float,2>{0.468649566f, 0.676709175f},
-std::array<float,2>{0.60966295f, 0.25395301f},
-std::array<float,2>{0.114115834f, 0.0192197673f},
-std::array<float,2>{0.992047369f, 0.857956886f},
-std::array<float,2>{0.338613302f, 0.754335761f},
-std::array<float,2>{0.639075816f, 0.0744587258f},
-std::array<float,2>{0.223366752f, 0.370953172f},
-std::array<float,2>{0.804916859f, 0.741412282f},
-std::array<float,2>{0.0562148839f, 0.511650741f},
-std::array<float,2>{0.893697858f, 0.493237823f},
-std::array<float,2>{0.431967914f, 0.200535044f},
-std::array<float,2>{0.535579503f, 0.948470533f},
-std::array<float,2>{0.0836978778f, 0.817262471f},
-std::array<float,2>{0.955841124f, 0.0540812761f},
-std::array<float,2>{0.497583687f, 0.282181025f},
-std::array<float,2>{0.574602783f, 0.65307492f},
-std::array<float,2>{0.261826605f, 0.603358924f},
-std::array<float,2>{0.735239685f, 0.405400008f},
-std::array<float,2>{0.173032999f, 0.132869467f},
-std::array<float,2>{0.866561592f, 0.930055261f},
-std::array<float,2>{0.385660946f, 0.975383103f},
-std::array<float,2>{0.518572152f, 0.247202605f},
-std::array<float,2>{0.0129364254f, 0.468241125f},
-std::array<float,2>{0.925000787f, 0.557630956f},
-std::array<float,2>{0.192182243f, 0.698461711f},
-std::array<float,2>{0.771818101f, 0.328382999f},
-std::array<float,2>{0.34526065f, 0.112785548f},
-std::array<float,2>{0.663725674f, 0.802063763f},
-std::array<float,2>{0.183997795f, 0.845847428f},
-std::array<float,2>{0.867854536f, 0.028021574f},
-std::array<float,2>{0.253449827f, 0.260237813f},
-std::array<float,2>{0.746145368f, 0.685388267f},
-std::array<float,2>{0.486680537f, 0.566995323f},
-std::array<float,2>{0.565072536f, 0.407568723f},
-std::array<float,2>{0.0896876156f, 0.162247956f},
-std::array<float,2>{0.96513027f, 0.880917013f},
-std::array<float,2>{0.355423748f, 0.941683769f},
-std::array<float,2>{0.668787718f, 0.188143879f},
-std::array<float,2>{0.197036102f, 0.488470167f},
-std::array<float,2>{0.77496171f, 0.501060903f},
-std::array<float,2>{0.00404934911f, 0.748730838f},
-std::array<float,2>{0.930331171f, 0.363802135f},
-std::array<float,2>{0.376150459f, 0.064905718f},
-std::array<float,2>{0.531011939f, 0.760475934f},
-std::array<float,2>{0.122589387f, 0.924147844f},
-std::array<float,2>{0.992913008f, 0.12977621f},
-std::array<float,2>{0.454623818f, 0.395258188f},
-std::array<float,2>{0.62453419f, 0.597287416f},
-std::array<float,2>{0.301347703f, 0.643919647f},
-std::array<float,2>{0.694373012f, 0.295706779f},
-std::array<float,2>{0.151596189f, 0.0568520613f},
-std::array<float,2>{0.837843537f, 0.826947927f},
-std::array<float,2>{0.422459811f, 0.80649823f},
-std::array<float,2>{0.54006964f, 0.11763145f},
-std::array<float,2>{0.0536572672f, 0.341455877f},
-std::array<float,2>{0.901885748f, 0.687702477f},
-std::array<float,2>{0.230522782f, 0.547796011f},
-std::array<float,2>{0.797316611f, 0.45785886f},
-std::array<float,2>{0.333110601f, 0.238592014f},
-std::array<float,2>{0.629160762f, 0.982574999f},
-std::array<float,2>{0.217241645f, 0.998527646f},
-std::array<float,2>{0.759447396f, 0.231133997f},
-std::array<float,2>{0.369525522f, 0.44252637f},
-std::array<float,2>{0.674689651f, 0.544951022f},
-std::array<float,2>{0.40358907f, 0.713564694f},
-std::array<float,2>{0.501203835f, 0.325297058f},
-std::array<float,2>{0.0225472264f, 0.104538411f},
-std::array<float,2>{0.908352792f, 0.794234335f},
-std::array<float,2>{0.274427205f, 0.833064973f},
-std::array<float,2>{0.722369969f, 0.0465225205f},
-std::array<float,2>{0.158337682f, 0.299397945f},
-std::array<float,2>{0.857080281f, 0.639738441f},
-std::array<float,2>{0.0685583949f, 0.611301184f},
-std::array<float,2>{0.941694975f, 0.380698413f},
-std::array<float,2>{0.481240273f, 0.151647136f},
-std::array<float,2>{0.588754416f, 0.910300076f},
-std::array<float,2>{0.0407837741f, 0.765744448f},
-std::array<float,2>{0.875106514f, 0.0884434357f},
-std::array<float,2>{0.407440096f, 0.351547956f},
-std::array<float,2>{0.556052446f, 0.732028604f},
-std::array<float,2>{0.315522134f, 0.527201951f},
-std::array<float,2>{0.646867037f, 0.471405596f},
-std::array<float,2>{0.246573284f, 0.217550427f},
-std::array<float,2>{0.796085417f, 0.955192983f},
-std::array<float,2>{0.451595008f, 0.902139068f},
-std::array<float,2>{0.604841471f, 0.183225498f},
-std::array<float,2>{0.105167538f, 0.422409415f},
-std::array<float,2>{0.982156456f, 0.591295421f},
-std::array<float,2>{0.12823385f, 0.666186929f},
-std::array<float,2>{0.825369835f, 0.26982078f},
-std::array<float,2>{0.290090501f, 0.00676625455f},
-std::array<float,2>{0.706062555f, 0.870640159f},
-std::array<float,2>{0.138548076f, 0.763204336f},
-std::array<float,2>{0.815550864f, 0.0702029094f},
-std::array<float,2>{0.281462342f, 0.36171183f},
-std::array<float,2>{0.712212563f, 0.744641364f},
-std::array<float,2>{0.439636379f, 0.505946994f},
-std::array<float,2>{0.597596884f, 0.487305313f},
-std::array<float,2>{0.100670211f, 0.191942632f},
-std::array<float,2>{0.973568201f, 0.941343665f},
-std::array<float,2>{0.323595017f, 0.878314972f},
-std::array<float,2>{0.649985254f, 0.157076254f},
-std::array<float,2>{0.237157166f, 0.413376451f},
-std::array<float,2>{0.784274578f, 0.565661192f},
-std::array<float,2>{0.0381090716f, 0.682955682f},
-std::array<float,2>{0.886344671f, 0.265115887f},
-std::array<float,2>{0.419029176f, 0.0269010533f},
-std::array<float,2>{0.549008071f, 0.84910351f},
-std::array<float,2>{0.078050144f, 0.978460789f},
-std::array<float,2>{0.948715866f, 0.237575203f},
-std::array<float,2>{0.471744627f, 0.454863429f},
-std::array<float,2>{0.584310591f, 0.554484904f},
-std::array<float,2>{0.266597897f, 0.695262253f},
-std::array<float,2>{0.727816403f, 0.3369627f},
-std::array<float,2>{0.170229241f, 0.12185964f},
-std::array<float,2>{0.846665978f, 0.811441481f},
-std::array<float,2>{0.394942164f, 0.822213531f},
-std::array<float,2>{0.510596633f, 0.0608816482f},
-std::array<float,2>{0.0255890954f, 0.290156245f},
-std::array<float,2>{0.914215922f, 0.647843301f},
-std::array<float,2>{0.208235398f, 0.600640476f},
-std::array<float,2>{0.752567291f, 0.392300367f},
-std::array<float,2>{0.364116132f, 0.125230312f},
-std::array<float,2>{0.684127808f, 0.92802912f},
-std::array<float,2>{0.222573444f, 0.909432113f},
-std::array<float,2>{0.811431408f, 0.152500972f},
-std::array<float,2>{0.342867643f, 0.378002614f},
-std::array<float,2>{0.633770525f, 0.613886476f},
-std::array<float,2>{0.437280446f, 0.635123789f},
-std::array<float,2>{0.531901479f, 0.304273337f},
-std::array<float,2>{0.0619741455f, 0.0412137397f},
-std::array<float,2>{0.896267474f, 0.830875516f},
-std::array<float,2>{0.307959735f, 0.789838731f},
-std::array<float,2>{0.699453712f, 0.108588874f},
-std::array<float,2>{0.140789822f, 0.322277486f},
-std::array<float,2>{0.828493476f, 0.71535033f},
-std::array<float,2>{0.110456847f, 0.542051435f},
-std::array<float,2>{0.987806082f, 0.437929988f},
-std::array<float,2>{0.464398295f, 0.230423838f},
-std::array<float,2>{0.616078556f, 0.995075345f},
-std::array<float,2>{0.00834946707f, 0.871172965f},
-std::array<float,2>{0.92618978f, 0.00224341592f},
-std::array<float,2>{0.387115389f, 0.26707381f},
-std::array<float,2>{0.522427917f, 0.66936034f},
-std::array<float,2>{0.350473106f, 0.588803053f},
-std::array<float,2>{0.65882659f, 0.428349316f},
-std::array<float,2>{0.189806193f, 0.187128782f},
-std::array<float,2>{0.767578542f, 0.903770685f},
-std::array<float,2>{0.494802326f, 0.958363473f},
-std::array<float,2>{0.571441889f, 0.213124216f},
-std::array<float,2>{0.0792949125f, 0.475213587f},
-std::array<float,2>{0.960752964f, 0.530034006f},
-std::array<float,2>{0.176101431f, 0.728618205f},
-std::array<float,2>{0.862878382f, 0.344583511f},
-std::array<float,2>{0.260276854f, 0.0935477167f},
-std::array<float,2>{0.739290476f, 0.769563973f},
-std::array<float,2>{0.202871948f, 0.841103256f},
-std::array<float,2>{0.77815944f, 0.0319328979f},
-std::array<float,2>{0.355638325f, 0.305363297f},
-std::array<float,2>{0.664150536f, 0.631716371f},
-std::array<float,2>{0.381936014f, 0.620110512f},
-std::array<float,2>{0.524069965f, 0.386890799f},
-std::array<float,2>{0.00345986011f, 0.142859265f},
-std::array<float,2>{0.936470926f, 0.916949332f},
-std::array<float,2>{0.255089581f, 0.988523722f},
-std::array<float,2>{0.743662834f, 0.224067613f},
-std::array<float,2>{0.183087423f, 0.446854085f},
-std::array<float,2>{0.873515546f, 0.532254934f},
-std::array<float,2>{0.09197703f, 0.709721029f},
-std::array<float,2>{0.963261187f, 0.313839763f},
-std::array<float,2>{0.489995241f, 0.0975363329f},
-std::array<float,2>{0.568655252f, 0.782255411f},
-std::array<float,2>{0.050765723f, 0.892537415f},
-std::array<float,2>{0.903918266f, 0.174029097f},
-std::array<float,2>{0.427652359f, 0.433080435f},
-std::array<float,2>{0.545133412f, 0.585547984f},
-std::array<float,2>{0.329541683f, 0.661490381f},
-std::array<float,2>{0.628362596f, 0.280499518f},
-std::array<float,2>{0.228388399f, 0.0136929667f},
-std::array<float,2>{0.800941825f, 0.860837758f},
-std::array<float,2>{0.459046394f, 0.776952803f},
-std::array<float,2>{0.617884159f, 0.0811478868f},
-std::array<float,2>{0.11909163f, 0.351856977f},
-std::array<float,2>{0.997113407f, 0.721214294f},
-std::array<float,2>{0.153876662f, 0.517386377f},
-std::array<float,2>{0.841101885f, 0.480219096f},
-std::array<float,2>{0.299821377f, 0.208560616f},
-std::array<float,2>{0.68935281f, 0.963694513f},
-std::array<float,2>{0.16295059f, 0.952123165f},
-std::array<float,2>{0.854580283f, 0.195600659f},
-std::array<float,2>{0.279020071f, 0.498344451f},
-std::array<float,2>{0.725316465f, 0.515523076f},
-std::array<float,2>{0.479388773f, 0.737347722f},
-std::array<float,2>{0.5925982f, 0.372159839f},
-std::array<float,2>{0.0647637099f, 0.0735445544f},
-std::array<float,2>{0.941119254f, 0.752731144f},
-std::array<float,2>{0.371426553f, 0.852889121f},
-std::array<float,2>{0.679071009f, 0.0228923354f},
-std::array<float,2>{0.214216024f, 0.25202167f},
-std::array<float,2>{0.763278425f, 0.673695683f},
-std::array<float,2>{0.0171860196f, 0.576249301f},
-std::array<float,2>{0.910292029f, 0.421829998f},
-std::array<float,2>{0.398510128f, 0.168939427f},
-std::array<float,2>{0.505366325f, 0.886276722f},
-std::array<float,2>{0.105566271f, 0.800710618f},
-std::array<float,2>{0.978445888f, 0.116231896f},
-std::array<float,2>{0.445552379f, 0.335225701f},
-std::array<float,2>{0.605551004f, 0.702263415f},
-std::array<float,2>{0.294997811f, 0.561682403f},
-std::array<float,2>{0.708911538f, 0.461238146f},
-std::array<float,2>{0.129907787f, 0.24537012f},
-std::array<float,2>{0.82395041f, 0.970446289f},
-std::array<float,2>{0.41152814f, 0.935679674f},
-std::array<float,2>{0.560829759f, 0.138926163f},
-std::array<float,2>{0.0431849062f, 0.400863916f},
-std::array<float,2>{0.881634414f, 0.606601119f},
-std::array<float,2>{0.243184596f, 0.65064311f},
-std::array<float,2>{0.791024566f, 0.287876189f},
-std::array<float,2>{0.318490773f, 0.049220413f},
-std::array<float,2>{0.642142951f, 0.816197157f},
-std::array<float,2>{0.224218726f, 0.756471694f},
-std::array<float,2>{0.805979192f, 0.0761900097f},
-std::array<float,2>{0.339410424f, 0.367702961f},
-std::array<float,2>{0.64030087f, 0.738441348f},
-std::array<float,2>{0.433220774f, 0.508893967f},
-std::array<float,2>{0.536807597f, 0.49598217f},
-std::array<float,2>{0.0548093915f, 0.202668443f},
-std::array<float,2>{0.89331007f, 0.945736945f},
-std::array<float,2>{0.309745371f, 0.888488293f},
-std::array<float,2>{0.698510349f, 0.164886758f},
-std::array<float,2>{0.145821244f, 0.415823787f},
-std::array<float,2>{0.832955599f, 0.572826326f},
-std::array<float,2>{0.114841685f, 0.678029776f},
-std::array<float,2>{0.991092861f, 0.256392092f},
-std::array<float,2>{0.466878057f, 0.0161730535f},
-std::array<float,2>{0.611318409f, 0.857089102f},
-std::array<float,2>{0.012387136f, 0.973601341f},
-std::array<float,2>{0.924216688f, 0.249594599f},
-std::array<float,2>{0.386176944f, 0.465128034f},
-std::array<float,2>{0.518547297f, 0.556631088f},
-std::array<float,2>{0.344359875f, 0.696273804f},
-std::array<float,2>{0.662843049f, 0.330610216f},
-std::array<float,2>{0.193238229f, 0.110771738f},
-std::array<float,2>{0.772467971f, 0.80303812f},
-std::array<float,2>{0.496677607f, 0.819162428f},
-std::array<float,2>{0.576033473f, 0.0515375398f},
-std::array<float,2>{0.0826392844f, 0.283493727f},
-std::array<float,2>{0.956638396f, 0.654488206f},
-std::array<float,2>{0.172098264f, 0.605421603f},
-std::array<float,2>{0.866192341f, 0.403016478f},
-std::array<float,2>{0.263316244f, 0.135292441f},
-std::array<float,2>{0.735402167f, 0.933318675f},
-std::array<float,2>{0.135951534f, 0.921666145f},
-std::array<float,2>{0.816561639f, 0.148381159f},
-std::array<float,2>{0.285727859f, 0.386363059f},
-std::array<float,2>{0.718357384f, 0.622990727f},
-std::array<float,2>{0.443850636f, 0.627879798f},
-std::array<float,2>{0.598612309f, 0.312273055f},
-std::array<float,2>{0.0950610414f, 0.0375175029f},
-std::array<float,2>{0.970582426f, 0.83599335f},
-std::array<float,2>{0.325164378f, 0.788439393f},
-std::array<float,2>{0.655353069f, 0.098663941f},
-std::array<float,2>{0.240036666f, 0.320044696f},
-std::array<float,2>{0.786377251f, 0.706857681f},
-std::array<float,2>{0.0324463025f, 0.536608458f},
-std::array<float,2>{0.889797091f, 0.449867308f},
-std::array<float,2>{0.414743215f, 0.219247147f},
-std::array<float,2>{0.553734601f, 0.98691684f},
-std::array<float,2>{0.0712680593f, 0.86686343f},
-std::array<float,2>{0.951047421f, 0.0114331422f},
-std::array<float,2>{0.47552371f, 0.275704712f},
-std::array<float,2>{0.579307973f, 0.659247458f},
-std::array<float,2>{0.270074189f, 0.581010222f},
-std::array<float,2>{0.73142761f, 0.437241107f},
-std::array<float,2>{0.165658176f, 0.177441299f},
-std::array<float,2>{0.849053264f, 0.896655142f},
-std::array<float,2>{0.394159675f, 0.965061963f},
-std::array<float,2>{0.512969613f, 0.205130935f},
-std::array<float,2>{0.0304732621f, 0.481674165f},
-std::array<float,2>{0.918342054f, 0.519798994f},
-std::array<float,2>{0.206615299f, 0.726359546f},
-std::array<float,2>{0.754712582f, 0.357524425f},
-std::array<float,2>{0.361574084f, 0.0841625258f},
-std::array<float,2>{0.683236063f, 0.780382335f},
-std::array<float,2>{0.159984231f, 0.835848808f},
-std::array<float,2>{0.856442571f, 0.0439197868f},
-std::array<float,2>{0.273739398f, 0.297032207f},
-std::array<float,2>{0.721139431f, 0.636929274f},
-std::array<float,2>{0.481910676f, 0.612928987f},
-std::array<float,2>{0.589358687f, 0.381829679f},
-std::array<float,2>{0.0702446401f, 0.14885965f},
-std::array<float,2>{0.943316758f, 0.912989259f},
-std::array<float,2>{0.370831192f, 0.996630311f},
-std::array<float,2>{0.675652921f, 0.233177021f},
-std::array<float,2>{0.218735993f, 0.444237977f},
-std::array<float,2>{0.758462787f, 0.544770777f},
-std::array<float,2>{0.0220740363f, 0.711459935f},
-std::array<float,2>{0.909251273f, 0.326874882f},
-std::array<float,2>{0.403299153f, 0.102042884f},
-std::array<float,2>{0.500763178f, 0.7951684f},
-std::array<float,2>{0.104333021f, 0.899410546f},
-std::array<float,2>{0.98060596f, 0.180461034f},
-std::array<float,2>{0.453112096f, 0.425174028f},
-std::array<float,2>{0.604077995f, 0.59252125f},
-std::array<float,2>{0.289422125f, 0.664524078f},
-std::array<float,2>{0.705561876f, 0.27149865f},
-std::array<float,2>{0.127563521f, 0.00536759989f},
-std::array<float,2>{0.825033128f, 0.868081391f},
-std::array<float,2>{0.406918377f, 0.768482268f},
-std::array<float,2>{0.555048466f, 0.0864160806f},
-std::array<float,2>{0.0393230878f, 0.348609835f},
-std::array<float,2>{0.876660645f, 0.734220207f},
-std::array<float,2>{0.247325063f, 0.524097443f},
-std::array<float,2>{0.795696914f, 0.469759345f},
-std::array<float,2>{0.315199405f, 0.215661347f},
-std::array<float,2>{0.647958219f, 0.955060542f},
-std::array<float,2>{0.196190283f, 0.944683671f},
-std::array<float,2>{0.774187505f, 0.189673617f},
-std::array<float,2>{0.353923351f, 0.492185622f},
-std::array<float,2>{0.669818163f, 0.503677487f},
-std::array<float,2>{0.375121176f, 0.746766806f},
-std::array<float,2>{0.530202866f, 0.366180003f},
-std::array<float,2>{0.00550461886f, 0.0625692457f},
-std::array<float,2>{0.931618869f, 0.757856846f},
-std::array<float,2>{0.252281815f, 0.845667183f},
-std::array<float,2>{0.747858346f, 0.0293372069f},
-std::array<float,2>{0.185082212f, 0.258213967f},
-std::array<float,2>{0.86865437f, 0.687051713f},
-std::array<float,2>{0.0887418762f, 0.569262207f},
-std::array<float,2>{0.966693044f, 0.408755392f},
-std::array<float,2>{0.487595409f, 0.16188547f},
-std::array<float,2>{0.5655967f, 0.880365908f},
-std::array<float,2>{0.0545907058f, 0.808556139f},
-std::array<float,2>{0.9005211f, 0.1205291f},
-std::array<float,2>{0.423103839f, 0.342005283f},
-std::array<float,2>{0.539952993f, 0.689799547f},
-std::array<float,2>{0.332997739f, 0.550226808f},
-std::array<float,2>{0.630696833f, 0.460402191f},
-std::array<float,2>{0.231454685f, 0.241117731f},
-std::array<float,2>{0.798496723f, 0.980936468f},
-std::array<float,2>{0.453270197f, 0.922328889f},
-std::array<float,2>{0.623657405f, 0.131121174f},
-std::array<float,2>{0.121615216f, 0.398230851f},
-std::array<float,2>{0.994067609f, 0.59376204f},
-std::array<float,2>{0.150437742f, 0.641035855f},
-std::array<float,2>{0.836413383f, 0.29316628f},
-std::array<float,2>{0.302652568f, 0.0557481162f},
-std::array<float,2>{0.693538845f, 0.824783504f},
-std::array<float,2>{0.141692832f, 0.791772783f},
-std::array<float,2>{0.829442203f, 0.105822943f},
-std::array<float,2>{0.307237476f, 0.32197845f},
-std::array<float,2>{0.700654984f, 0.718639255f},
-std::array<float,2>{0.46290952f, 0.539957464f},
-std::array<float,2>{0.616362453f, 0.439577073f},
-std::array<float,2>{0.110236205f, 0.22729069f},
-std::array<float,2>{0.986334145f, 0.992961168f},
-std::array<float,2>{0.342401564f, 0.907464981f},
-std::array<float,2>{0.634318233f, 0.155092925f},
-std::array<float,2>{0.220841825f, 0.376253575f},
-std::array<float,2>{0.811813533f, 0.616293848f},
-std::array<float,2>{0.0612386316f, 0.63429898f},
-std::array<float,2>{0.894534647f, 0.300820351f},
-std::array<float,2>{0.436028689f, 0.0399621539f},
-std::array<float,2>{0.532421947f, 0.828290164f},
-std::array<float,2>{0.0788801536f, 0.960227013f},
-std::array<float,2>{0.959885001f, 0.212403566f},
-std::array<float,2>{0.495867819f, 0.474374294f},
-std::array<float,2>{0.570962787f, 0.527980506f},
-std::array<float,2>{0.26107198f, 0.727869272f},
-std::array<float,2>{0.738836944f, 0.346961021f},
-std::array<float,2>{0.177173033f, 0.0909167379f},
-std::array<float,2>{0.861877382f, 0.772951126f},
-std::array<float,2>{0.388423294f, 0.873096108f},
-std::array<float,2>{0.522504389f, 0.00158198958f},
-std::array<float,2>{0.00902970601f, 0.269203901f},
-std::array<float,2>{0.926790059f, 0.670230806f},
-std::array<float,2>{0.190447435f, 0.586115479f},
-std::array<float,2>{0.769490123f, 0.425815791f},
-std::array<float,2>{0.351259053f, 0.184076145f},
-std::array<float,2>{0.659492791f, 0.90600723f},
-std::array<float,2>{0.238223478f, 0.876321554f},
-std::array<float,2>{0.783489943f, 0.158447385f},
-std::array<float,2>{0.322922707f, 0.411445528f},
-std::array<float,2>{0.649047077f, 0.563087881f},
-std::array<float,2>{0.418729186f, 0.680936933f},
-std::array<float,2>{0.550660491f, 0.261884362f},
-std::array<float,2>{0.0372033045f, 0.0238653012f},
-std::array<float,2>{0.885084033f, 0.850128889f},
-std::array<float,2>{0.282780737f, 0.764379919f},
-std::array<float,2>{0.71097523f, 0.0681164041f},
-std::array<float,2>{0.137587503f, 0.360617608f},
-std::array<float,2>{0.814517677f, 0.743312001f},
-std::array<float,2>{0.100123025f, 0.504341245f},
-std::array<float,2>{0.974166691f, 0.485736221f},
-std::array<float,2>{0.440474212f, 0.194644511f},
-std::array<float,2>{0.596444786f, 0.939146638f},
-std::array<float,2>{0.0268064179f, 0.823317587f},
-std::array<float,2>{0.915879965f, 0.0598296002f},
-std::array<float,2>{0.39552024f, 0.292898357f},
-std::array<float,2>{0.511047721f, 0.644602716f},
-std::array<float,2>{0.364711463f, 0.598357499f},
-std::array<float,2>{0.68512845f, 0.393334776f},
-std::array<float,2>{0.20782575f, 0.12852183f},
-std::array<float,2>{0.753673136f, 0.927159071f},
-std::array<float,2>{0.471562207f, 0.978949845f},
-std::array<float,2>{0.585582733f, 0.236116886f},
-std::array<float,2>{0.0769313723f, 0.455598444f},
-std::array<float,2>{0.947303116f, 0.55252701f},
-std::array<float,2>{0.171110615f, 0.691896081f},
-std::array<float,2>{0.846949577f, 0.339478344f},
-std::array<float,2>{0.26663956f, 0.124905974f},
-std::array<float,2>{0.727140009f, 0.809544981f},
-std::array<float,2>{0.213425577f, 0.853687346f},
-std::array<float,2>{0.76244992f, 0.0214136373f},
-std::array<float,2>{0.372186899f, 0.250402391f},
-std::array<float,2>{0.6786865f, 0.675263762f},
-std::array<float,2>{0.399852753f, 0.575996161f},
-std::array<float,2>{0.504432082f, 0.419529706f},
-std::array<float,2>{0.0165547878f, 0.171064675f},
-std::array<float,2>{0.911262214f, 0.884056568f},
-std::array<float,2>{0.277755231f, 0.949635863f},
-std::array<float,2>{0.725828052f, 0.19779022f},
-std::array<float,2>{0.163682908f, 0.496388227f},
-std::array<float,2>{0.853940189f, 0.511943936f},
-std::array<float,2>{0.066172339f, 0.735450447f},
-std::array<float,2>{0.939662397f, 0.373108298f},
-std::array<float,2>{0.479777187f, 0.0709983334f},
-std::array<float,2>{0.593465388f, 0.750700176f},
-std::array<float,2>{0.0446661524f, 0.934927881f},
-std::array<float,2>{0.882503688f, 0.138400555f},
-std::array<float,2>{0.410762668f, 0.398669481f},
-std::array<float,2>{0.561701417f, 0.607952118f},
-std::array<float,2>{0.319531947f, 0.649362743f},
-std::array<float,2>{0.64087373f, 0.286021292f},
-std::array<float,2>{0.242202431f, 0.0477735884f},
-std::array<float,2>{0.792603612f, 0.814350188f},
-std::array<float,2>{0.447104692f, 0.797849178f},
-std::array<float,2>{0.607385814f, 0.114764988f},
-std::array<float,2>{0.106727652f, 0.332968235f},
-std::array<float,2>{0.976748765f, 0.700284123f},
-std::array<float,2>{0.129078716f, 0.560163856f},
-std::array<float,2>{0.822335243f, 0.463736504f},
-std::array<float,2>{0.296393692f, 0.242800057f},
-std::array<float,2>{0.707054377f, 0.972472429f},
-std::array<float,2>{0.182209775f, 0.991300285f},
-std::array<float,2>{0.874271095f, 0.224897087f},
-std::array<float,2>{0.254806697f, 0.447893322f},
-std::array<float,2>{0.742709041f, 0.534815013f},
-std::array<float,2>{0.488857061f, 0.708063424f},
-std::array<float,2>{0.57017076f, 0.315518558f},
-std::array<float,2>{0.0928539187f, 0.0941155404f},
-std::array<float,2>{0.964232922f, 0.784336746f},
-std::array<float,2>{0.357320309f, 0.842362761f},
-std::array<float,2>{0.665134251f, 0.0335535929f},
-std::array<float,2>{0.20206736f, 0.306992501f},
-std::array<float,2>{0.778343439f, 0.630785763f},
-std::array<float,2>{0.00217218301f, 0.618079543f},
-std::array<float,2>{0.936609626f, 0.390461713f},
-std::array<float,2>{0.381574899f, 0.141430885f},
-std::array<float,2>{0.524682999f, 0.914883912f},
-std::array<float,2>{0.117522232f, 0.775272131f},
-std::array<float,2>{0.996935248f, 0.0786705837f},
-std::array<float,2>{0.460154831f, 0.354857862f},
-std::array<float,2>{0.618665636f, 0.719485343f},
-std::array<float,2>{0.299474031f, 0.51789695f},
-std::array<float,2>{0.688328207f, 0.478012174f},
-std::array<float,2>{0.153100759f, 0.21065101f},
-std::array<float,2>{0.839936316f, 0.962827921f},
-std::array<float,2>{0.426722825f, 0.893328846f},
-std::array<float,2>{0.54608506f, 0.17261304f},
-std::array<float,2>{0.0497593954f, 0.430105925f},
-std::array<float,2>{0.902444899f, 0.582939327f},
-std::array<float,2>{0.227245107f, 0.662967265f},
-std::array<float,2>{0.802641869f, 0.278831482f},
-std::array<float,2>{0.328776538f, 0.0132528339f},
-std::array<float,2>{0.626961648f, 0.861346543f},
-std::array<float,2>{0.194384724f, 0.801023126f},
-std::array<float,2>{0.771243453f, 0.112292968f},
-std::array<float,2>{0.347148806f, 0.329794407f},
-std::array<float,2>{0.66191107f, 0.697503448f},
-std::array<float,2>{0.38442108f, 0.557300925f},
-std::array<float,2>{0.51591748f, 0.467473686f},
-std::array<float,2>{0.0155173922f, 0.246694222f},
-std::array<float,2>{0.923637211f, 0.976541519f},
-std::array<float,2>{0.264193714f, 0.931123435f},
-std::array<float,2>{0.737256408f, 0.134149373f},
-std::array<float,2>{0.174649984f, 0.404314041f},
-std::array<float,2>{0.863624871f, 0.602425456f},
-std::array<float,2>{0.0851475447f, 0.653737247f},
-std::array<float,2>{0.954100311f, 0.282276511f},
-std::array<float,2>{0.499628931f, 0.0529464856f},
-std::array<float,2>{0.577615261f, 0.817426383f},
-std::array<float,2>{0.0576770455f, 0.947653055f},
-std::array<float,2>{0.890673399f, 0.199530303f},
-std::array<float,2>{0.430391043f, 0.492590576f},
-std::array<float,2>{0.538840055f, 0.510702431f},
-std::array<float,2>{0.337153286f, 0.740822136f},
-std::array<float,2>{0.637103021f, 0.369524568f},
-std::array<float,2>{0.225517273f, 0.0760115013f},
-std::array<float,2>{0.806927681f, 0.755434096f},
-std::array<float,2>{0.465436369f, 0.858841538f},
-std::array<float,2>{0.611536264f, 0.0182969645f},
-std::array<float,2>{0.116624787f, 0.255484313f},
-std::array<float,2>{0.989228725f, 0.677679718f},
-std::array<float,2>{0.147704437f, 0.570376575f},
-std::array<float,2>{0.834531665f, 0.416738123f},
-std::array<float,2>{0.311189562f, 0.166229323f},
-std::array<float,2>{0.697246134f, 0.890257418f},
-std::array<float,2>{0.167437658f, 0.896309733f},
-std::array<float,2>{0.849911332f, 0.178491652f},
-std::array<float,2>{0.272109687f, 0.435322791f},
-std::array<float,2>{0.7331568f, 0.57846123f},
-std::array<float,2>{0.473970264f, 0.657166839f},
-std::array<float,2>{0.581409752f, 0.274429172f},
-std::array<float,2>{0.0735690296f, 0.00939546805f},
-std::array<float,2>{0.952394485f, 0.863941133f},
-std::array<float,2>{0.360105485f, 0.779079318f},
-std::array<float,2>{0.68062067f, 0.0822384134f},
-std::array<float,2>{0.203423411f, 0.357252926f},
-std::array<float,2>{0.757811964f, 0.722730219f},
-std::array<float,2>{0.027830787f, 0.52173245f},
-std::array<float,2>{0.921512425f, 0.483262897f},
-std::array<float,2>{0.391145557f, 0.203448102f},
-std::array<float,2>{0.514730334f, 0.967333853f},
-std::array<float,2>{0.0957752988f, 0.839574397f},
-std::array<float,2>{0.972112536f, 0.0361881144f},
-std::array<float,2>{0.442522734f, 0.309983879f},
-std::array<float,2>{0.60076952f, 0.626801789f},
-std::array<float,2>{0.288729161f, 0.624793112f},
-std::array<float,2>{0.71600616f, 0.384737283f},
-std::array<float,2>{0.133333191f, 0.144975826f},
-std::array<float,2>{0.818525612f, 0.919906497f},
-std::array<float,2>{0.416378349f, 0.984782457f},
-std::array<float,2>{0.550884664f, 0.222546771f},
-std::array<float,2>{0.0349282473f, 0.452953875f},
-std::array<float,2>{0.888391435f, 0.537786245f},
-std::array<float,2>{0.240692198f, 0.703970015f},
-std::array<float,2>{0.787581861f, 0.317463845f},
-std::array<float,2>{0.327158809f, 0.100439548f},
-std::array<float,2>{0.652578413f, 0.786750376f},
-std::array<float,2>{0.126489848f, 0.869442642f},
-std::array<float,2>{0.826924443f, 0.00711670332f},
-std::array<float,2>{0.292897284f, 0.271002829f},
-std::array<float,2>{0.703219235f, 0.667578697f},
-std::array<float,2>{0.45102337f, 0.589973807f},
-std::array<float,2>{0.60305059f, 0.423015177f},
-std::array<float,2>{0.101977989f, 0.182067335f},
-std::array<float,2>{0.982560098f, 0.900475204f},
-std::array<float,2>{0.314208508f, 0.956457794f},
-std::array<float,2>{0.646050215f, 0.218360946f},
-std::array<float,2>{0.248401225f, 0.472435445f},
-std::array<float,2>{0.794055998f, 0.525572836f},
-std::array<float,2>{0.0417741649f, 0.730883956f},
-std::array<float,2>{0.878202558f, 0.35043174f},
-std::array<float,2>{0.408214599f, 0.0896616653f},
-std::array<float,2>{0.556858361f, 0.766878605f},
-std::array<float,2>{0.0665670931f, 0.911896944f},
-std::array<float,2>{0.945162117f, 0.150684223f},
-std::array<float,2>{0.48297891f, 0.3798455f},
-std::array<float,2>{0.587309539f, 0.610247254f},
-std::array<float,2>{0.276970685f, 0.638790727f},
-std::array<float,2>{0.718785048f, 0.300005883f},
-std::array<float,2>{0.157176971f, 0.045839455f},
-std::array<float,2>{0.858753204f, 0.832042336f},
-std::array<float,2>{0.405220211f, 0.793555617f},
-std::array<float,2>{0.502602994f, 0.10441085f},
-std::array<float,2>{0.0207212251f, 0.324426532f},
-std::array<float,2>{0.907520294f, 0.714184284f},
-std::array<float,2>{0.21569936f, 0.545919955f},
-std::array<float,2>{0.760098517f, 0.442282796f},
-std::array<float,2>{0.36892429f, 0.231950775f},
-std::array<float,2>{0.672432601f, 0.999607205f},
-std::array<float,2>{0.232672095f, 0.983622909f},
-std::array<float,2>{0.799514532f, 0.240220889f},
-std::array<float,2>{0.335435838f, 0.458929718f},
-std::array<float,2>{0.63250196f, 0.547909439f},
-std::array<float,2>{0.424142659f, 0.689333498f},
-std::array<float,2>{0.541347682f, 0.340608567f},
-std::array<float,2>{0.0516689867f, 0.119046718f},
-std::array<float,2>{0.899511933f, 0.805291891f},
-std::array<float,2>{0.303485185f, 0.827571809f},
-std::array<float,2>{0.692064524f, 0.0580737032f},
-std::array<float,2>{0.149582535f, 0.29632163f},
-std::array<float,2>{0.83869803f, 0.642991245f},
-std::array<float,2>{0.124951534f, 0.595788538f},
-std::array<float,2>{0.995816231f, 0.395976067f},
-std::array<float,2>{0.455380529f, 0.129966095f},
-std::array<float,2>{0.622735918f, 0.924871802f},
-std::array<float,2>{0.00777136255f, 0.761636913f},
-std::array<float,2>{0.932827115f, 0.0658124685f},
-std::array<float,2>{0.378692895f, 0.365075082f},
-std::array<float,2>{0.528672874f, 0.749219298f},
-std::array<float,2>{0.352827936f, 0.500796556f},
-std::array<float,2>{0.670148611f, 0.489674419f},
-std::array<float,2>{0.1991864f, 0.189069286f},
-std::array<float,2>{0.776395798f, 0.943124354f},
-std::array<float,2>{0.486255884f, 0.882156909f},
-std::array<float,2>{0.563405871f, 0.163448647f},
-std::array<float,2>{0.0861310214f, 0.40717411f},
-std::array<float,2>{0.968475699f, 0.568122566f},
-std::array<float,2>{0.186465234f, 0.683796942f},
-std::array<float,2>{0.870194495f, 0.261067718f},
-std::array<float,2>{0.251288414f, 0.0292943567f},
-std::array<float,2>{0.749447107f, 0.84715879f},
-std::array<float,2>{0.178702414f, 0.770842552f},
-std::array<float,2>{0.86068207f, 0.0926637724f},
-std::array<float,2>{0.258813709f, 0.345338076f},
-std::array<float,2>{0.741750956f, 0.729642272f},
-std::array<float,2>{0.493478596f, 0.530887485f},
-std::array<float,2>{0.57232219f, 0.475953698f},
-std::array<float,2>{0.0816530213f, 0.214014068f},
-std::array<float,2>{0.957878768f, 0.957275867f},
-std::array<float,2>{0.348175049f, 0.903010488f},
-std::array<float,2>{0.657997131f, 0.186176047f},
-std::array<float,2>{0.189312309f, 0.429045558f},
-std::array<float,2>{0.766492903f, 0.588986456f},
-std::array<float,2>{0.010431272f, 0.668782175f},
-std::array<float,2>{0.928887546f, 0.265931487f},
-std::array<float,2>{0.39035821f, 0.00356242317f},
-std::array<float,2>{0.521387875f, 0.872236431f},
-std::array<float,2>{0.111381546f, 0.995861888f},
-std::array<float,2>{0.984876335f, 0.229048371f},
-std::array<float,2>{0.462616384f, 0.439393163f},
-std::array<float,2>{0.614169121f, 0.541143656f},
-std::array<float,2>{0.305342793f, 0.716221333f},
-std::array<float,2>{0.702209175f, 0.323504418f},
-std::array<float,2>{0.143135548f, 0.108369812f},
-std::array<float,2>{0.831065893f, 0.79066354f},
-std::array<float,2>{0.433913171f, 0.831668079f},
-std::array<float,2>{0.535071254f, 0.0423485078f},
-std::array<float,2>{0.0586215295f, 0.303368837f},
-std::array<float,2>{0.896971107f, 0.636554897f},
-std::array<float,2>{0.219365045f, 0.614455044f},
-std::array<float,2>{0.809246838f, 0.377664059f},
-std::array<float,2>{0.340399802f, 0.153513685f},
-std::array<float,2>{0.635365129f, 0.909161568f},
-std::array<float,2>{0.210790247f, 0.929064572f},
-std::array<float,2>{0.75020808f, 0.126673043f},
-std::array<float,2>{0.3653844f, 0.391450554f},
-std::array<float,2>{0.687312484f, 0.600583732f},
-std::array<float,2>{0.398325056f, 0.647459805f},
-std::array<float,2>{0.509063423f, 0.289910764f},
-std::array<float,2>{0.0253686495f, 0.0622885451f},
-std::array<float,2>{0.917315066f, 0.820868969f},
-std::array<float,2>{0.268688262f, 0.811932385f},
-std::array<float,2>{0.730143368f, 0.122243688f},
-std::array<float,2>{0.168082178f, 0.336324722f},
-std::array<float,2>{0.843827426f, 0.694005191f},
-std::array<float,2>{0.0759789795f, 0.553419948f},
-std::array<float,2>{0.946827114f, 0.453781128f},
-std::array<float,2>{0.469771922f, 0.237105772f},
-std::array<float,2>{0.583875179f, 0.976640701f},
-std::array<float,2>{0.0354680941f, 0.847895801f},
-std::array<float,2>{0.883310974f, 0.0255608931f},
-std::array<float,2>{0.42184031f, 0.264057606f},
-std::array<float,2>{0.546902478f, 0.681955874f},
-std::array<float,2>{0.321917355f, 0.56475836f},
-std::array<float,2>{0.651168942f, 0.412317216f},
-std::array<float,2>{0.234735936f, 0.158114433f},
-std::array<float,2>{0.782010198f, 0.877848148f},
-std::array<float,2>{0.438426703f, 0.940154791f},
-std::array<float,2>{0.594654858f, 0.192480356f},
-std::array<float,2>{0.0990290269f, 0.486931741f},
-std::array<float,2>{0.974647224f, 0.507026136f},
-std::array<float,2>{0.139922351f, 0.745619059f},
-std::array<float,2>{0.814223409f, 0.362348408f},
-std::array<float,2>{0.283307046f, 0.0687110573f},
-std::array<float,2>{0.714648843f, 0.761994362f},
-std::array<float,2>{0.244973943f, 0.814711034f},
-std::array<float,2>{0.790707707f, 0.0507424697f},
-std::array<float,2>{0.317794621f, 0.288946211f},
-std::array<float,2>{0.643655062f, 0.651941001f},
-std::array<float,2>{0.412560076f, 0.605652034f},
-std::array<float,2>{0.559725523f, 0.40187797f},
-std::array<float,2>{0.045027677f, 0.140586302f},
-std::array<float,2>{0.8790645f, 0.936667562f},
-std::array<float,2>{0.293409109f, 0.969474018f},
-std::array<float,2>{0.710015476f, 0.244848862f},
-std::array<float,2>{0.131332591f, 0.462236166f},
-std::array<float,2>{0.820532084f, 0.560580313f},
-std::array<float,2>{0.109055601f, 0.701291919f},
-std::array<float,2>{0.979628503f, 0.334472865f},
-std::array<float,2>{0.44892332f, 0.115585893f},
-std::array<float,2>{0.607953727f, 0.799120486f},
-std::array<float,2>{0.0182497706f, 0.885500848f},
-std::array<float,2>{0.913519084f, 0.169404045f},
-std::array<float,2>{0.401856959f, 0.420368761f},
-std::array<float,2>{0.506078064f, 0.5780496f},
-std::array<float,2>{0.374459475f, 0.672277331f},
-std::array<float,2>{0.676916718f, 0.253235042f},
-std::array<float,2>{0.211672932f, 0.0222407747f},
-std::array<float,2>{0.76529038f, 0.851941884f},
-std::array<float,2>{0.478498667f, 0.753398359f},
-std::array<float,2>{0.590976298f, 0.0727333054f},
-std::array<float,2>{0.0637422055f, 0.371232003f},
-std::array<float,2>{0.938235939f, 0.736863375f},
-std::array<float,2>{0.161643147f, 0.514576018f},
-std::array<float,2>{0.853158712f, 0.499060363f},
-std::array<float,2>{0.280603707f, 0.197217971f},
-std::array<float,2>{0.722850263f, 0.952950895f},
-std::array<float,2>{0.155105427f, 0.964753389f},
-std::array<float,2>{0.843063056f, 0.207261726f},
-std::array<float,2>{0.297528833f, 0.479367286f},
-std::array<float,2>{0.690459549f, 0.515886009f},
-std::array<float,2>{0.458920717f, 0.721724868f},
-std::array<float,2>{0.619244874f, 0.352820158f},
-std::array<float,2>{0.120624714f, 0.0806962326f},
-std::array<float,2>{0.999241292f, 0.7756567f},
-std::array<float,2>{0.330330163f, 0.859681666f},
-std::array<float,2>{0.62571609f, 0.0155534185f},
-std::array<float,2>{0.228546113f, 0.280042171f},
-std::array<float,2>{0.804000795f, 0.66088289f},
-std::array<float,2>{0.0476533957f, 0.584132135f},
-std::array<float,2>{0.905461788f, 0.43169564f},
-std::array<float,2>{0.4294402f, 0.175369039f},
-std::array<float,2>{0.543809116f, 0.890988708f},
-std::array<float,2>{0.0916473195f, 0.782216787f},
-std::array<float,2>{0.962631166f, 0.0964492112f},
-std::array<float,2>{0.490977764f, 0.31320563f},
-std::array<float,2>{0.56776166f, 0.710212767f},
-std::array<float,2>{0.257686436f, 0.53150773f},
-std::array<float,2>{0.744852424f, 0.44585526f},
-std::array<float,2>{0.181616858f, 0.223443136f},
-std::array<float,2>{0.87226063f, 0.989282608f},
-std::array<float,2>{0.379293501f, 0.917035699f},
-std::array<float,2>{0.526746511f, 0.144299343f},
-std::array<float,2>{0.00170676596f, 0.388276935f},
-std::array<float,2>{0.935507238f, 0.620393813f},
-std::array<float,2>{0.199514315f, 0.632749021f},
-std::array<float,2>{0.779602826f, 0.306248933f},
-std::array<float,2>{0.358415395f, 0.03237978f},
-std::array<float,2>{0.667546332f, 0.840516329f},
-std::array<float,2>{0.189095736f, 0.771752596f},
-std::array<float,2>{0.766343892f, 0.0902775154f},
-std::array<float,2>{0.348428458f, 0.34626168f},
-std::array<float,2>{0.657778323f, 0.727013767f},
-std::array<float,2>{0.390459508f, 0.528704762f},
-std::array<float,2>{0.521090508f, 0.473552167f},
-std::array<float,2>{0.0107286684f, 0.211904004f},
-std::array<float,2>{0.9291628f, 0.959778011f},
-std::array<float,2>{0.259191692f, 0.904509723f},
-std::array<float,2>{0.742157757f, 0.185175315f},
-std::array<float,2>{0.178257868f, 0.427342296f},
-std::array<float,2>{0.860527217f, 0.587463737f},
-std::array<float,2>{0.0818044767f, 0.671567798f},
-std::array<float,2>{0.957686245f, 0.268550962f},
-std::array<float,2>{0.493335336f, 0.000930618611f},
-std::array<float,2>{0.572519362f, 0.874286592f},
-std::array<float,2>{0.0590025783f, 0.993671119f},
-std::array<float,2>{0.896606982f, 0.227977216f},
-std::array<float,2>{0.433633268f, 0.440525174f},
-std::array<float,2>{0.534762025f, 0.540259004f},
-std::array<float,2>{0.340798587f, 0.717311561f},
-std::array<float,2>{0.635593295f, 0.320958048f},
-std::array<float,2>{0.219524533f, 0.107149847f},
-std::array<float,2>{0.809351802f, 0.792194366f},
-std::array<float,2>{0.462736428f, 0.829669297f},
-std::array<float,2>{0.613958538f, 0.0405036137f},
-std::array<float,2>{0.111744732f, 0.301918387f},
-std::array<float,2>{0.985175312f, 0.633772612f},
-std::array<float,2>{0.143416867f, 0.615467608f},
-std::array<float,2>{0.831517279f, 0.375610024f},
-std::array<float,2>{0.305530816f, 0.156048179f},
-std::array<float,2>{0.702533722f, 0.906387269f},
-std::array<float,2>{0.168219045f, 0.925946295f},
-std::array<float,2>{0.844113767f, 0.127155975f},
-std::array<float,2>{0.268888265f, 0.393953651f},
-std::array<float,2>{0.730353177f, 0.599012256f},
-std::array<float,2>{0.470110983f, 0.645964086f},
-std::array<float,2>{0.5837363f, 0.291608602f},
-std::array<float,2>{0.0757771805f, 0.0591394864f},
-std::array<float,2>{0.947056949f, 0.823046267f},
-std::array<float,2>{0.365537137f, 0.809584379f},
-std::array<float,2>{0.687028825f, 0.123910256f},
-std::array<float,2>{0.210508913f, 0.338280886f},
-std::array<float,2>{0.750381291f, 0.692738533f},
-std::array<float,2>{0.0249114912f, 0.55160141f},
-std::array<float,2>{0.917137027f, 0.456204653f},
-std::array<float,2>{0.398065865f, 0.234704912f},
-std::array<float,2>{0.509017527f, 0.979639053f},
-std::array<float,2>{0.0986687168f, 0.850729525f},
-std::array<float,2>{0.975060999f, 0.0249678176f},
-std::array<float,2>{0.438165367f, 0.263579428f},
-std::array<float,2>{0.594316185f, 0.680495799f},
-std::array<float,2>{0.283547848f, 0.564075947f},
-std::array<float,2>{0.714567125f, 0.410468817f},
-std::array<float,2>{0.139835551f, 0.159325659f},
-std::array<float,2>{0.814058185f, 0.875938892f},
-std::array<float,2>{0.42148158f, 0.938374996f},
-std::array<float,2>{0.547299147f, 0.194309771f},
-std::array<float,2>{0.0353537425f, 0.484868199f},
-std::array<float,2>{0.883667052f, 0.505583882f},
-std::array<float,2>{0.234419569f, 0.742947996f},
-std::array<float,2>{0.78186959f, 0.360034496f},
-std::array<float,2>{0.322098672f, 0.0664765015f},
-std::array<float,2>{0.650939345f, 0.765426457f},
-std::array<float,2>{0.131085411f, 0.812923312f},
-std::array<float,2>{0.820673704f, 0.0480945632f},
-std::array<float,2>{0.293092042f, 0.286207974f},
-std::array<float,2>{0.710353494f, 0.650340796f},
-std::array<float,2>{0.449029863f, 0.609125674f},
-std::array<float,2>{0.608390272f, 0.399923354f},
-std::array<float,2>{0.10926532f, 0.137059256f},
-std::array<float,2>{0.979744077f, 0.933709919f},
-std::array<float,2>{0.317557812f, 0.971334338f},
-std::array<float,2>{0.643966436f, 0.244053081f},
-std::array<float,2>{0.244645685f, 0.4646568f},
-std::array<float,2>{0.790820897f, 0.559030294f},
-std::array<float,2>{0.0453617349f, 0.700041711f},
-std::array<float,2>{0.879317641f, 0.333586544f},
-std::array<float,2>{0.412180424f, 0.113947995f},
-std::array<float,2>{0.559990466f, 0.797929645f},
-std::array<float,2>{0.0635154992f, 0.883190453f},
-std::array<float,2>{0.938028097f, 0.170129254f},
-std::array<float,2>{0.478271216f, 0.418439656f},
-std::array<float,2>{0.591224313f, 0.57448256f},
-std::array<float,2>{0.280279756f, 0.673852801f},
-std::array<float,2>{0.722994745f, 0.251952499f},
-std::array<float,2>{0.161909819f, 0.0204250086f},
-std::array<float,2>{0.853457749f, 0.854843557f},
-std::array<float,2>{0.402325213f, 0.751805723f},
-std::array<float,2>{0.506211162f, 0.0713288262f},
-std::array<float,2>{0.0183248706f, 0.374067873f},
-std::array<float,2>{0.913152516f, 0.734757245f},
-std::array<float,2>{0.211532682f, 0.513081849f},
-std::array<float,2>{0.765509903f, 0.497223854f},
-std::array<float,2>{0.374070525f, 0.198947802f},
-std::array<float,2>{0.677201569f, 0.951067924f},
-std::array<float,2>{0.228932589f, 0.960980415f},
-std::array<float,2>{0.803772688f, 0.209917918f},
-std::array<float,2>{0.330320358f, 0.476876616f},
-std::array<float,2>{0.625909925f, 0.519259155f},
-std::array<float,2>{0.429538995f, 0.720205426f},
-std::array<float,2>{0.54360044f, 0.35371992f},
-std::array<float,2>{0.0474633202f, 0.079954356f},
-std::array<float,2>{0.905593812f, 0.774103642f},
-std::array<float,2>{0.297831893f, 0.862823486f},
-std::array<float,2>{0.690685511f, 0.0120013198f},
-std::array<float,2>{0.155012026f, 0.277847111f},
-std::array<float,2>{0.842791498f, 0.663710475f},
-std::array<float,2>{0.120955274f, 0.58343327f},
-std::array<float,2>{0.999286473f, 0.430699289f},
-std::array<float,2>{0.458634585f, 0.173437059f},
-std::array<float,2>{0.619435012f, 0.894487798f},
-std::array<float,2>{0.001768608f, 0.783342898f},
-std::array<float,2>{0.935068369f, 0.0953255445f},
-std::array<float,2>{0.379107952f, 0.314571768f},
-std::array<float,2>{0.526575625f, 0.707888424f},
-std::array<float,2>{0.358780086f, 0.533733547f},
-std::array<float,2>{0.667927146f, 0.448898464f},
-std::array<float,2>{0.199375808f, 0.226440251f},
-std::array<float,2>{0.779375076f, 0.990300357f},
-std::array<float,2>{0.490954399f, 0.915908158f},
-std::array<float,2>{0.567617059f, 0.14202106f},
-std::array<float,2>{0.0915092155f, 0.389326274f},
-std::array<float,2>{0.96271044f, 0.61830467f},
-std::array<float,2>{0.181370988f, 0.629576385f},
-std::array<float,2>{0.872334003f, 0.308052063f},
-std::array<float,2>{0.257538736f, 0.0343655683f},
-std::array<float,2>{0.74510181f, 0.843022048f},
-std::array<float,2>{0.174329117f, 0.803933442f},
-std::array<float,2>{0.863358319f, 0.10940925f},
-std::array<float,2>{0.264618874f, 0.331591964f},
-std::array<float,2>{0.736859858f, 0.696820438f},
-std::array<float,2>{0.499793172f, 0.554992616f},
-std::array<float,2>{0.577214241f, 0.466584712f},
-std::array<float,2>{0.0854061767f, 0.248410657f},
-std::array<float,2>{0.953615546f, 0.974282324f},
-std::array<float,2>{0.346907765f, 0.931860328f},
-std::array<float,2>{0.661627233f, 0.136294827f},
-std::array<float,2>{0.194610357f, 0.403845787f},
-std::array<float,2>{0.771053612f, 0.60357064f},
-std::array<float,2>{0.0152110811f, 0.656194329f},
-std::array<float,2>{0.923578382f, 0.284607112f},
-std::array<float,2>{0.384695023f, 0.0517579801f},
-std::array<float,2>{0.51572299f, 0.819663227f},
-std::array<float,2>{0.11635837f, 0.94694829f},
-std::array<float,2>{0.988915205f, 0.201689973f},
-std::array<float,2>{0.465777427f, 0.494898617f},
-std::array<float,2>{0.611750662f, 0.508696616f},
-std::array<float,2>{0.311290354f, 0.739678144f},
-std::array<float,2>{0.697006047f, 0.368994474f},
-std::array<float,2>{0.147856593f, 0.0779535472f},
-std::array<float,2>{0.834886849f, 0.75752914f},
-std::array<float,2>{0.430657327f, 0.855929315f},
-std::array<float,2>{0.538577735f, 0.0172434077f},
-std::array<float,2>{0.0579620078f, 0.257053882f},
-std::array<float,2>{0.89101994f, 0.679562986f},
-std::array<float,2>{0.225190461f, 0.573707283f},
-std::array<float,2>{0.806695223f, 0.414876789f},
-std::array<float,2>{0.337185889f, 0.165828571f},
-std::array<float,2>{0.636783481f, 0.887189209f},
-std::array<float,2>{0.203364745f, 0.897877157f},
-std::array<float,2>{0.757463515f, 0.176269621f},
-std::array<float,2>{0.360187948f, 0.436120778f},
-std::array<float,2>{0.680286527f, 0.581103027f},
-std::array<float,2>{0.391518712f, 0.659130931f},
-std::array<float,2>{0.514917076f, 0.277341217f},
-std::array<float,2>{0.0273649991f, 0.0100216987f},
-std::array<float,2>{0.92183125f, 0.865254581f},
-std::array<float,2>{0.272305369f, 0.779839873f},
-std::array<float,2>{0.733015537f, 0.0850393698f},
-std::array<float,2>{0.167074382f, 0.358955979f},
-std::array<float,2>{0.849625111f, 0.72469902f},
-std::array<float,2>{0.0734363496f, 0.521001101f},
-std::array<float,2>{0.952241182f, 0.480662584f},
-std::array<float,2>{0.473852485f, 0.206388593f},
-std::array<float,2>{0.581231356f, 0.965966105f},
-std::array<float,2>{0.0347200483f, 0.837886512f},
-std::array<float,2>{0.888534248f, 0.0390014611f},
-std::array<float,2>{0.416042179f, 0.310820997f},
-std::array<float,2>{0.551051497f, 0.627956748f},
-std::array<float,2>{0.327464014f, 0.621454298f},
-std::array<float,2>{0.652778864f, 0.385644317f},
-std::array<float,2>{0.240257561f, 0.146834865f},
-std::array<float,2>{0.787216306f, 0.920387208f},
-std::array<float,2>{0.442658484f, 0.988133073f},
-std::array<float,2>{0.600937605f, 0.220538512f},
-std::array<float,2>{0.0959869325f, 0.451116353f},
-std::array<float,2>{0.971881568f, 0.535606682f},
-std::array<float,2>{0.133716419f, 0.70587182f},
-std::array<float,2>{0.818752825f, 0.318479627f},
-std::array<float,2>{0.288959682f, 0.0985091403f},
-std::array<float,2>{0.716102839f, 0.787782907f},
-std::array<float,2>{0.248152971f, 0.868447185f},
-std::array<float,2>{0.794263959f, 0.00399887981f},
-std::array<float,2>{0.314267427f, 0.273339152f},
-std::array<float,2>{0.646320403f, 0.665145814f},
-std::array<float,2>{0.408518732f, 0.593348801f},
-std::array<float,2>{0.557125509f, 0.424780101f},
-std::array<float,2>{0.0417305715f, 0.181039318f},
-std::array<float,2>{0.877930462f, 0.900153875f},
-std::array<float,2>{0.292680264f, 0.953863323f},
-std::array<float,2>{0.70355022f, 0.216215968f},
-std::array<float,2>{0.126813456f, 0.469060212f},
-std::array<float,2>{0.82676661f, 0.525019467f},
-std::array<float,2>{0.101586141f, 0.732979357f},
-std::array<float,2>{0.982786834f, 0.349297673f},
-std::array<float,2>{0.450852484f, 0.0873057693f},
-std::array<float,2>{0.603492379f, 0.769242346f},
-std::array<float,2>{0.0209358931f, 0.913517594f},
-std::array<float,2>{0.907370508f, 0.149545044f},
-std::array<float,2>{0.404996634f, 0.38265276f},
-std::array<float,2>{0.502906442f, 0.611558497f},
-std::array<float,2>{0.368886799f, 0.638570786f},
-std::array<float,2>{0.672748446f, 0.298568994f},
-std::array<float,2>{0.21533905f, 0.044136405f},
-std::array<float,2>{0.75979656f, 0.834118426f},
-std::array<float,2>{0.483190149f, 0.79674983f},
-std::array<float,2>{0.587008893f, 0.102539577f},
-std::array<float,2>{0.0668281689f, 0.327226818f},
-std::array<float,2>{0.944884837f, 0.712805271f},
-std::array<float,2>{0.156848118f, 0.543223679f},
-std::array<float,2>{0.858444214f, 0.444686174f},
-std::array<float,2>{0.277335763f, 0.234203517f},
-std::array<float,2>{0.719055772f, 0.99744606f},
-std::array<float,2>{0.14987655f, 0.982264102f},
-std::array<float,2>{0.838510096f, 0.241440877f},
-std::array<float,2>{0.303376704f, 0.459894538f},
-std::array<float,2>{0.692171752f, 0.548916638f},
-std::array<float,2>{0.455297977f, 0.691402793f},
-std::array<float,2>{0.622962654f, 0.343056887f},
-std::array<float,2>{0.12475498f, 0.119447544f},
-std::array<float,2>{0.996088862f, 0.807481766f},
-std::array<float,2>{0.335198253f, 0.825420916f},
-std::array<float,2>{0.63258481f, 0.0556413084f},
-std::array<float,2>{0.232661903f, 0.293977916f},
-std::array<float,2>{0.799671173f, 0.642381132f},
-std::array<float,2>{0.051410377f, 0.595245183f},
-std::array<float,2>{0.899718165f, 0.397043198f},
-std::array<float,2>{0.423865855f, 0.132026345f},
-std::array<float,2>{0.541242123f, 0.923378229f},
-std::array<float,2>{0.0863469392f, 0.759311438f},
-std::array<float,2>{0.968532443f, 0.063601166f},
-std::array<float,2>{0.485947698f, 0.366369158f},
-std::array<float,2>{0.563196719f, 0.747945368f},
-std::array<float,2>{0.251065791f, 0.502467096f},
-std::array<float,2>{0.749183476f, 0.49085781f},
-std::array<float,2>{0.186111823f, 0.190842718f},
-std::array<float,2>{0.870526612f, 0.943772435f},
-std::array<float,2>{0.378594071f, 0.87977922f},
-std::array<float,2>{0.528486669f, 0.161023065f},
-std::array<float,2>{0.0074960608f, 0.410088301f},
-std::array<float,2>{0.932935834f, 0.569746971f},
-std::array<float,2>{0.198763281f, 0.685963273f},
-std::array<float,2>{0.776740789f, 0.259707451f},
-std::array<float,2>{0.352629066f, 0.0305181351f},
-std::array<float,2>{0.670237601f, 0.844023705f},
-std::array<float,2>{0.221114233f, 0.789077818f},
-std::array<float,2>{0.811644673f, 0.109043851f},
-std::array<float,2>{0.342694789f, 0.322759837f},
-std::array<float,2>{0.634530187f, 0.714915752f},
-std::array<float,2>{0.43564263f, 0.542567432f},
-std::array<float,2>{0.532640338f, 0.43803671f},
-std::array<float,2>{0.06148481f, 0.229730174f},
-std::array<float,2>{0.894924819f, 0.994259298f},
-std::array<float,2>{0.307554305f, 0.909761727f},
-std::array<float,2>{0.700299084f, 0.15328145f},
-std::array<float,2>{0.141981751f, 0.378669709f},
-std::array<float,2>{0.829245389f, 0.613519549f},
-std::array<float,2>{0.110105142f, 0.635615051f},
-std::array<float,2>{0.986778736f, 0.303749591f},
-std::array<float,2>{0.463270724f, 0.0417522639f},
-std::array<float,2>{0.616523087f, 0.83017379f},
-std::array<float,2>{0.00903742202f, 0.958905578f},
-std::array<float,2>{0.927153707f, 0.213408098f},
-std::array<float,2>{0.388452768f, 0.474751621f},
-std::array<float,2>{0.522845805f, 0.529780924f},
-std::array<float,2>{0.351474434f, 0.729383111f},
-std::array<float,2>{0.659400642f, 0.343968749f},
-std::array<float,2>{0.190716013f, 0.0932316929f},
-std::array<float,2>{0.769168317f, 0.770507634f},
-std::array<float,2>{0.495620131f, 0.871896029f},
-std::array<float,2>{0.571067333f, 0.00261446019f},
-std::array<float,2>{0.078701295f, 0.267299026f},
-std::array<float,2>{0.959503949f, 0.669701278f},
-std::array<float,2>{0.17681329f, 0.587917089f},
-std::array<float,2>{0.862267375f, 0.427962512f},
-std::array<float,2>{0.260887533f, 0.186938286f},
-std::array<float,2>{0.739085317f, 0.904123247f},
-std::array<float,2>{0.137214631f, 0.878876448f},
-std::array<float,2>{0.814785182f, 0.156527221f},
-std::array<float,2>{0.283199787f, 0.413774341f},
-std::array<float,2>{0.711205125f, 0.566286802f},
-std::array<float,2>{0.440727025f, 0.683288038f},
-std::array<float,2>{0.596421242f, 0.265405118f},
-std::array<float,2>{0.10048008f, 0.026575638f},
-std::array<float,2>{0.974426985f, 0.849239707f},
-std::array<float,2>{0.323076099f, 0.762978613f},
-std::array<float,2>{0.649177551f, 0.0697459579f},
-std::array<float,2>{0.237828493f, 0.362042725f},
-std::array<float,2>{0.783216f, 0.744554341f},
-std::array<float,2>{0.0375516787f, 0.506415844f},
-std::array<float,2>{0.884840727f, 0.488108426f},
-std::array<float,2>{0.418559492f, 0.191786259f},
-std::array<float,2>{0.550455034f, 0.940712512f},
-std::array<float,2>{0.0767210796f, 0.821758211f},
-std::array<float,2>{0.947570562f, 0.0612293035f},
-std::array<float,2>{0.471212357f, 0.290614814f},
-std::array<float,2>{0.585845828f, 0.648176432f},
-std::array<float,2>{0.267030269f, 0.601504266f},
-std::array<float,2>{0.727362812f, 0.392067879f},
-std::array<float,2>{0.171375051f, 0.125911161f},
-std::array<float,2>{0.846850514f, 0.928362966f},
-std::array<float,2>{0.395757079f, 0.977822244f},
-std::array<float,2>{0.510880709f, 0.237875491f},
-std::array<float,2>{0.0265530664f, 0.454557925f},
-std::array<float,2>{0.915748715f, 0.553748667f},
-std::array<float,2>{0.207651734f, 0.694403112f},
-std::array<float,2>{0.753549635f, 0.337531924f},
-std::array<float,2>{0.364464819f, 0.121453598f},
-std::array<float,2>{0.685363591f, 0.810577929f},
-std::array<float,2>{0.163994029f, 0.85328275f},
-std::array<float,2>{0.853702009f, 0.0231857151f},
-std::array<float,2>{0.277359277f, 0.252472132f},
-std::array<float,2>{0.726039052f, 0.672887325f},
-std::array<float,2>{0.47955665f, 0.576863647f},
-std::array<float,2>{0.593618691f, 0.421114564f},
-std::array<float,2>{0.0659782365f, 0.168245241f},
-std::array<float,2>{0.939807951f, 0.886200428f},
-std::array<float,2>{0.372498214f, 0.951213598f},
-std::array<float,2>{0.678319335f, 0.196147889f},
-std::array<float,2>{0.213734433f, 0.498989701f},
-std::array<float,2>{0.762467206f, 0.514823914f},
-std::array<float,2>{0.0161630977f, 0.738000512f},
-std::array<float,2>{0.91148454f, 0.372804672f},
-std::array<float,2>{0.399518013f, 0.0739349201f},
-std::array<float,2>{0.504796088f, 0.752258003f},
-std::array<float,2>{0.10667675f, 0.936185241f},
-std::array<float,2>{0.977012277f, 0.139440879f},
-std::array<float,2>{0.446969956f, 0.401236892f},
-std::array<float,2>{0.607115686f, 0.607149184f},
-std::array<float,2>{0.296746731f, 0.650973022f},
-std::array<float,2>{0.707329512f, 0.287270039f},
-std::array<float,2>{0.129257917f, 0.0494657084f},
-std::array<float,2>{0.822650731f, 0.815751135f},
-std::array<float,2>{0.411019564f, 0.800180793f},
-std::array<float,2>{0.561991632f, 0.117091514f},
-std::array<float,2>{0.0448180884f, 0.335617185f},
-std::array<float,2>{0.882751942f, 0.702910364f},
-std::array<float,2>{0.242548019f, 0.562419415f},
-std::array<float,2>{0.79295516f, 0.46168977f},
-std::array<float,2>{0.319770694f, 0.245677292f},
-std::array<float,2>{0.640685737f, 0.969760239f},
-std::array<float,2>{0.201670736f, 0.989182055f},
-std::array<float,2>{0.778601408f, 0.224483207f},
-std::array<float,2>{0.357115209f, 0.446687669f},
-std::array<float,2>{0.66540724f, 0.532858849f},
-std::array<float,2>{0.381638259f, 0.709469736f},
-std::array<float,2>{0.524527431f, 0.314291358f},
-std::array<float,2>{0.0022508055f, 0.0968139321f},
-std::array<float,2>{0.936768472f, 0.782765329f},
-std::array<float,2>{0.254436553f, 0.84131211f},
-std::array<float,2>{0.742978871f, 0.031320516f},
-std::array<float,2>{0.182476044f, 0.3048051f},
-std::array<float,2>{0.874202549f, 0.630921483f},
-std::array<float,2>{0.0930749699f, 0.619409323f},
-std::array<float,2>{0.964067519f, 0.387366325f},
-std::array<float,2>{0.489034265f, 0.143541455f},
-std::array<float,2>{0.569894016f, 0.916417003f},
-std::array<float,2>{0.0495083444f, 0.776395202f},
-std::array<float,2>{0.902821064f, 0.081870988f},
-std::array<float,2>{0.426272005f, 0.352396786f},
-std::array<float,2>{0.546303213f, 0.720883369f},
-std::array<float,2>{0.328908145f, 0.516803503f},
-std::array<float,2>{0.627440631f, 0.479737729f},
-std::array<float,2>{0.227359697f, 0.208235085f},
-std::array<float,2>{0.802301645f, 0.962953687f},
-std::array<float,2>{0.460284859f, 0.891654372f},
-std::array<float,2>{0.619021416f, 0.174454272f},
-std::array<float,2>{0.117207944f, 0.43349275f},
-std::array<float,2>{0.996714532f, 0.585249901f},
-std::array<float,2>{0.152904108f, 0.661700964f},
-std::array<float,2>{0.840145171f, 0.280908585f},
-std::array<float,2>{0.299701124f, 0.0143712554f},
-std::array<float,2>{0.688194096f, 0.86099261f},
-std::array<float,2>{0.145650789f, 0.754675865f},
-std::array<float,2>{0.832545519f, 0.0751791745f},
-std::array<float,2>{0.309930444f, 0.370417595f},
-std::array<float,2>{0.698273361f, 0.741789937f},
-std::array<float,2>{0.467240632f, 0.510770559f},
-std::array<float,2>{0.610934615f, 0.493682772f},
-std::array<float,2>{0.115180984f, 0.200967342f},
-std::array<float,2>{0.990813017f, 0.948989332f},
-std::array<float,2>{0.339825362f, 0.889278412f},
-std::array<float,2>{0.640521765f, 0.167316288f},
-std::array<float,2>{0.224433482f, 0.417760104f},
-std::array<float,2>{0.805854201f, 0.571573675f},
-std::array<float,2>{0.0549942702f, 0.676198542f},
-std::array<float,2>{0.893494785f, 0.254706502f},
-std::array<float,2>{0.433434159f, 0.0187239908f},
-std::array<float,2>{0.537029207f, 0.85777241f},
-std::array<float,2>{0.0830063373f, 0.975045979f},
-std::array<float,2>{0.956909478f, 0.247656539f},
-std::array<float,2>{0.496991158f, 0.468563139f},
-std::array<float,2>{0.575895071f, 0.558174312f},
-std::array<float,2>{0.263550282f, 0.698820889f},
-std::array<float,2>{0.73572439f, 0.32862255f},
-std::array<float,2>{0.172263816f, 0.113097444f},
-std::array<float,2>{0.865761936f, 0.802597046f},
-std::array<float,2>{0.385823488f, 0.816643715f},
-std::array<float,2>{0.518204391f, 0.0543911196f},
-std::array<float,2>{0.0125185326f, 0.281536818f},
-std::array<float,2>{0.923998773f, 0.652825058f},
-std::array<float,2>{0.192896739f, 0.602661908f},
-std::array<float,2>{0.772865415f, 0.405826479f},
-std::array<float,2>{0.344569921f, 0.133583829f},
-std::array<float,2>{0.662816942f, 0.930397272f},
-std::array<float,2>{0.239961609f, 0.918001592f},
-std::array<float,2>{0.78633666f, 0.146152958f},
-std::array<float,2>{0.324766576f, 0.383259058f},
-std::array<float,2>{0.655555487f, 0.623632252f},
-std::array<float,2>{0.414969027f, 0.625004411f},
-std::array<float,2>{0.554062843f, 0.309478492f},
-std::array<float,2>{0.0326014906f, 0.0356993787f},
-std::array<float,2>{0.890038788f, 0.838352203f},
-std::array<float,2>{0.285986722f, 0.786014199f},
-std::array<float,2>{0.718514383f, 0.101079173f},
-std::array<float,2>{0.136007071f, 0.316998035f},
-std::array<float,2>{0.816865563f, 0.704213619f},
-std::array<float,2>{0.094900094f, 0.538754404f},
-std::array<float,2>{0.970404923f, 0.451953262f},
-std::array<float,2>{0.444132537f, 0.221550256f},
-std::array<float,2>{0.598272681f, 0.985422552f},
-std::array<float,2>{0.0307379924f, 0.864461184f},
-std::array<float,2>{0.917970538f, 0.00815394148f},
-std::array<float,2>{0.394429952f, 0.274101377f},
-std::array<float,2>{0.512776375f, 0.658106923f},
-std::array<float,2>{0.361534864f, 0.579666734f},
-std::array<float,2>{0.68355906f, 0.434369266f},
-std::array<float,2>{0.206948414f, 0.179557577f},
-std::array<float,2>{0.754459023f, 0.894566417f},
-std::array<float,2>{0.475183904f, 0.967932522f},
-std::array<float,2>{0.579500914f, 0.204318076f},
-std::array<float,2>{0.0709272251f, 0.484011143f},
-std::array<float,2>{0.950893641f, 0.522515297f},
-std::array<float,2>{0.165809095f, 0.724064827f},
-std::array<float,2>{0.848636687f, 0.356362164f},
-std::array<float,2>{0.270450264f, 0.0838178098f},
-std::array<float,2>{0.731099486f, 0.778001249f},
-std::array<float,2>{0.218314573f, 0.833863258f},
-std::array<float,2>{0.75862956f, 0.0460237302f},
-std::array<float,2>{0.370900154f, 0.299122721f},
-std::array<float,2>{0.675353765f, 0.640323877f},
-std::array<float,2>{0.402952105f, 0.61059463f},
-std::array<float,2>{0.500697255f, 0.380299538f},
-std::array<float,2>{0.0222247969f, 0.152292818f},
-std::array<float,2>{0.909508109f, 0.910992444f},
-std::array<float,2>{0.273572594f, 0.99862653f},
-std::array<float,2>{0.720753908f, 0.230676427f},
-std::array<float,2>{0.15970698f, 0.442983538f},
-std::array<float,2>{0.856001973f, 0.545414627f},
-std::array<float,2>{0.0698467344f, 0.71299082f},
-std::array<float,2>{0.943080604f, 0.325831324f},
-std::array<float,2>{0.481654823f, 0.105228059f},
-std::array<float,2>{0.589793503f, 0.794492841f},
-std::array<float,2>{0.0391757227f, 0.901693761f},
-std::array<float,2>{0.876882732f, 0.182826087f},
-std::array<float,2>{0.407079846f, 0.422050506f},
-std::array<float,2>{0.554723322f, 0.591377139f},
-std::array<float,2>{0.315183371f, 0.666541159f},
-std::array<float,2>{0.648412049f, 0.270051867f},
-std::array<float,2>{0.247126535f, 0.00624134531f},
-std::array<float,2>{0.795533001f, 0.870162249f},
-std::array<float,2>{0.452682585f, 0.766480803f},
-std::array<float,2>{0.604352772f, 0.0881346092f},
-std::array<float,2>{0.104150042f, 0.350789547f},
-std::array<float,2>{0.980767369f, 0.731624484f},
-std::array<float,2>{0.127747089f, 0.52650404f},
-std::array<float,2>{0.824881613f, 0.470948845f},
-std::array<float,2>{0.289243579f, 0.216974497f},
-std::array<float,2>{0.70516932f, 0.955761552f},
-std::array<float,2>{0.185308918f, 0.941981316f},
-std::array<float,2>{0.868925929f, 0.187800527f},
-std::array<float,2>{0.252003282f, 0.489113957f},
-std::array<float,2>{0.747673988f, 0.501578271f},
-std::array<float,2>{0.487518042f, 0.748148859f},
-std::array<float,2>{0.565906644f, 0.363360792f},
-std::array<float,2>{0.0884310976f, 0.0651088208f},
-std::array<float,2>{0.966518581f, 0.760089219f},
-std::array<float,2>{0.353663713f, 0.84631145f},
-std::array<float,2>{0.6696105f, 0.0277931411f},
-std::array<float,2>{0.195848346f, 0.260657251f},
-std::array<float,2>{0.774061739f, 0.684895277f},
-std::array<float,2>{0.0057389033f, 0.566504598f},
-std::array<float,2>{0.931240022f, 0.408156246f},
-std::array<float,2>{0.375268102f, 0.162972629f},
-std::array<float,2>{0.529994607f, 0.881676674f},
-std::array<float,2>{0.121959731f, 0.806110322f},
-std::array<float,2>{0.993760586f, 0.118111588f},
-std::array<float,2>{0.453469455f, 0.341087252f},
-std::array<float,2>{0.623951972f, 0.688264191f},
-std::array<float,2>{0.302457422f, 0.547067165f},
-std::array<float,2>{0.693728149f, 0.457197517f},
-std::array<float,2>{0.1508279f, 0.239033401f},
-std::array<float,2>{0.836072922f, 0.983382165f},
-std::array<float,2>{0.423049629f, 0.924393356f},
-std::array<float,2>{0.539681494f, 0.129284605f},
-std::array<float,2>{0.0542975515f, 0.394869328f},
-std::array<float,2>{0.900864065f, 0.596940398f},
-std::array<float,2>{0.231903657f, 0.6442765f},
-std::array<float,2>{0.79862833f, 0.295181006f},
-std::array<float,2>{0.332626879f, 0.0573023595f},
-std::array<float,2>{0.630501211f, 0.826510906f},
-std::array<float,2>{0.236964285f, 0.763976336f},
-std::array<float,2>{0.784493387f, 0.0677075982f},
-std::array<float,2>{0.323465079f, 0.360845476f},
-std::array<float,2>{0.650177181f, 0.743703365f},
-std::array<float,2>{0.419287086f, 0.504771769f},
-std::array<float,2>{0.54912293f, 0.48624295f},
-std::array<float,2>{0.0384409651f, 0.194947273f},
-std::array<float,2>{0.886698067f, 0.938539445f},
-std::array<float,2>{0.281602293f, 0.876636803f},
-std::array<float,2>{0.711984813f, 0.158842638f},
-std::array<float,2>{0.138415441f, 0.412105709f},
-std::array<float,2>{0.815908492f, 0.562805235f},
-std::array<float,2>{0.100840002f, 0.681567073f},
-std::array<float,2>{0.973276138f, 0.2622554f},
-std::array<float,2>{0.439860106f, 0.0240332652f},
-std::array<float,2>{0.597273171f, 0.849724233f},
-std::array<float,2>{0.0258365851f, 0.9790833f},
-std::array<float,2>{0.914519072f, 0.235704735f},
-std::array<float,2>{0.394645452f, 0.455081999f},
-std::array<float,2>{0.510259986f, 0.551796198f},
-std::array<float,2>{0.363953948f, 0.691815495f},
-std::array<float,2>{0.684483945f, 0.338894367f},
-std::array<float,2>{0.208337247f, 0.124092087f},
-std::array<float,2>{0.752910435f, 0.80890125f},
-std::array<float,2>{0.47204861f, 0.823738158f},
-std::array<float,2>{0.584188402f, 0.0602548569f},
-std::array<float,2>{0.0777737796f, 0.292342782f},
-std::array<float,2>{0.948425889f, 0.645150483f},
-std::array<float,2>{0.169941247f, 0.59783411f},
-std::array<float,2>{0.846304655f, 0.393028736f},
-std::array<float,2>{0.266268581f, 0.128189161f},
-std::array<float,2>{0.727615178f, 0.927272499f},
-std::array<float,2>{0.140891925f, 0.907752573f},
-std::array<float,2>{0.828325272f, 0.154716834f},
-std::array<float,2>{0.307631373f, 0.376750737f},
-std::array<float,2>{0.699550807f, 0.617022693f},
-std::array<float,2>{0.464746088f, 0.633816242f},
-std::array<float,2>{0.615771234f, 0.301317245f},
-std::array<float,2>{0.110664912f, 0.0393631384f},
-std::array<float,2>{0.988203943f, 0.828779042f},
-std::array<float,2>{0.343121976f, 0.791111588f},
-std::array<float,2>{0.633539557f, 0.106155157f},
-std::array<float,2>{0.222245365f, 0.321753442f},
-std::array<float,2>{0.811083555f, 0.718044579f},
-std::array<float,2>{0.0617211834f, 0.539378762f},
-std::array<float,2>{0.896238685f, 0.439959049f},
-std::array<float,2>{0.437071383f, 0.226883605f},
-std::array<float,2>{0.532063842f, 0.992643595f},
-std::array<float,2>{0.0794869438f, 0.873735428f},
-std::array<float,2>{0.960546553f, 0.00132989651f},
-std::array<float,2>{0.495086342f, 0.26868701f},
-std::array<float,2>{0.571657777f, 0.670637846f},
-std::array<float,2>{0.260692596f, 0.586516559f},
-std::array<float,2>{0.73967731f, 0.426383168f},
-std::array<float,2>{0.175956354f, 0.184498042f},
-std::array<float,2>{0.863270104f, 0.905363798f},
-std::array<float,2>{0.386790007f, 0.960616291f},
-std::array<float,2>{0.521980643f, 0.212354362f},
-std::array<float,2>{0.00861626025f, 0.47383216f},
-std::array<float,2>{0.925934374f, 0.527345181f},
-std::array<float,2>{0.189657018f, 0.728507578f},
-std::array<float,2>{0.768040597f, 0.347646862f},
-std::array<float,2>{0.350248545f, 0.0915718079f},
-std::array<float,2>{0.658989847f, 0.772621274f},
-std::array<float,2>{0.182840019f, 0.842134655f},
-std::array<float,2>{0.87318337f, 0.0338178799f},
-std::array<float,2>{0.255306602f, 0.307201266f},
-std::array<float,2>{0.744087338f, 0.630175412f},
-std::array<float,2>{0.489854962f, 0.617295444f},
-std::array<float,2>{0.568526208f, 0.390073001f},
-std::array<float,2>{0.0920721665f, 0.140911087f},
-std::array<float,2>{0.963049412f, 0.914387643f},
-std::array<float,2>{0.355818182f, 0.991729021f},
-std::array<float,2>{0.664347887f, 0.225484669f},
-std::array<float,2>{0.203113437f, 0.447710931f},
-std::array<float,2>{0.777879596f, 0.534208298f},
-std::array<float,2>{0.00373650133f, 0.708500624f},
-std::array<float,2>{0.936221778f, 0.315961748f},
-std::array<float,2>{0.382321745f, 0.0944240242f},
-std::array<float,2>{0.524197876f, 0.784978092f},
-std::array<float,2>{0.11868871f, 0.89278996f},
-std::array<float,2>{0.997384429f, 0.172293618f},
-std::array<float,2>{0.459435582f, 0.430378526f},
-std::array<float,2>{0.618095875f, 0.58227551f},
-std::array<float,2>{0.300210595f, 0.662198246f},
-std::array<float,2>{0.688990474f, 0.278731436f},
-std::array<float,2>{0.154163375f, 0.0128438529f},
-std::array<float,2>{0.840854168f, 0.862022817f},
-std::array<float,2>{0.427282482f, 0.774476349f},
-std::array<float,2>{0.545394063f, 0.0784435198f},
-std::array<float,2>{0.0504655167f, 0.355160296f},
-std::array<float,2>{0.904103637f, 0.719163537f},
-std::array<float,2>{0.228034481f, 0.518218517f},
-std::array<float,2>{0.801103532f, 0.478155017f},
-std::array<float,2>{0.329103827f, 0.210443586f},
-std::array<float,2>{0.627991199f, 0.962357461f},
-std::array<float,2>{0.21395272f, 0.950154603f},
-std::array<float,2>{0.76357156f, 0.197333783f},
-std::array<float,2>{0.371139914f, 0.49672389f},
-std::array<float,2>{0.678780377f, 0.512294352f},
-std::array<float,2>{0.398858547f, 0.736322105f},
-std::array<float,2>{0.504991889f, 0.373746902f},
-std::array<float,2>{0.017414283f, 0.0707262084f},
-std::array<float,2>{0.910584509f, 0.750244975f},
-std::array<float,2>{0.279118419f, 0.85436219f},
-std::array<float,2>{0.725477576f, 0.0205288325f},
-std::array<float,2>{0.162663475f, 0.250758559f},
-std::array<float,2>{0.854881585f, 0.675413191f},
-std::array<float,2>{0.0646954179f, 0.575342476f},
-std::array<float,2>{0.941350698f, 0.419273287f},
-std::array<float,2>{0.479030877f, 0.171845838f},
-std::array<float,2>{0.592387676f, 0.884375989f},
-std::array<float,2>{0.0432512164f, 0.797017634f},
-std::array<float,2>{0.881553769f, 0.114342749f},
-std::array<float,2>{0.41120249f, 0.332402349f},
-std::array<float,2>{0.560673535f, 0.700864673f},
-std::array<float,2>{0.318607926f, 0.559880257f},
-std::array<float,2>{0.642397761f, 0.463228971f},
-std::array<float,2>{0.243499115f, 0.242278501f},
-std::array<float,2>{0.791451991f, 0.971711397f},
-std::array<float,2>{0.445682377f, 0.93543762f},
-std::array<float,2>{0.605871916f, 0.137710154f},
-std::array<float,2>{0.105753392f, 0.39893952f},
-std::array<float,2>{0.978251457f, 0.607495964f},
-std::array<float,2>{0.130185589f, 0.648890853f},
-std::array<float,2>{0.824099123f, 0.285301805f},
-std::array<float,2>{0.295408368f, 0.0471025854f},
-std::array<float,2>{0.708660424f, 0.813592136f},
-std::array<float,2>{0.135313764f, 0.788767993f},
-std::array<float,2>{0.818097055f, 0.0993260071f},
-std::array<float,2>{0.286314577f, 0.319497943f},
-std::array<float,2>{0.717468798f, 0.706129551f},
-std::array<float,2>{0.444612324f, 0.536704421f},
-std::array<float,2>{0.598865151f, 0.449618131f},
-std::array<float,2>{0.0943261236f, 0.219058707f},
-std::array<float,2>{0.968850017f, 0.986652255f},
-std::array<float,2>{0.325223804f, 0.921066761f},
-std::array<float,2>{0.654933751f, 0.147742376f},
-std::array<float,2>{0.238949865f, 0.386032522f},
-std::array<float,2>{0.786017001f, 0.622363806f},
-std::array<float,2>{0.031730514f, 0.627039492f},
-std::array<float,2>{0.889332354f, 0.311852872f},
-std::array<float,2>{0.415653855f, 0.0376453288f},
-std::array<float,2>{0.553300738f, 0.836715698f},
-std::array<float,2>{0.0722598583f, 0.965653598f},
-std::array<float,2>{0.94979471f, 0.205745727f},
-std::array<float,2>{0.476093709f, 0.482324183f},
-std::array<float,2>{0.578369498f, 0.520117402f},
-std::array<float,2>{0.270508885f, 0.726056218f},
-std::array<float,2>{0.732041359f, 0.358158648f},
-std::array<float,2>{0.164071783f, 0.0847759321f},
-std::array<float,2>{0.848145187f, 0.780988872f},
-std::array<float,2>{0.392895401f, 0.866326869f},
-std::array<float,2>{0.51241672f, 0.0109056551f},
-std::array<float,2>{0.0296925362f, 0.275905073f},
-std::array<float,2>{0.919335365f, 0.659929633f},
-std::array<float,2>{0.205263555f, 0.58048439f},
-std::array<float,2>{0.755462468f, 0.436988682f},
-std::array<float,2>{0.36250332f, 0.176951364f},
-std::array<float,2>{0.681685388f, 0.897311866f},
-std::array<float,2>{0.22342822f, 0.887796819f},
-std::array<float,2>{0.805146277f, 0.164470151f},
-std::array<float,2>{0.338627189f, 0.415345639f},
-std::array<float,2>{0.63873148f, 0.572696567f},
-std::array<float,2>{0.43176198f, 0.678473294f},
-std::array<float,2>{0.535255492f, 0.256065607f},
-std::array<float,2>{0.0565343052f, 0.0160081312f},
-std::array<float,2>{0.894009054f, 0.856823206f},
-std::array<float,2>{0.308690518f, 0.756208181f},
-std::array<float,2>{0.697884023f, 0.0770353675f},
-std::array<float,2>{0.144874275f, 0.367322862f},
-std::array<float,2>{0.833142698f, 0.738862932f},
-std::array<float,2>{0.113883696f, 0.509415448f},
-std::array<float,2>{0.991804898f, 0.495321155f},
-std::array<float,2>{0.468414307f, 0.20221433f},
-std::array<float,2>{0.609425485f, 0.946183801f},
-std::array<float,2>{0.0131761581f, 0.818563879f},
-std::array<float,2>{0.925111949f, 0.051255364f},
-std::array<float,2>{0.385483801f, 0.283751249f},
-std::array<float,2>{0.518823326f, 0.654956937f},
-std::array<float,2>{0.345563859f, 0.604920149f},
-std::array<float,2>{0.664020002f, 0.402802676f},
-std::array<float,2>{0.19213824f, 0.135109633f},
-std::array<float,2>{0.771631241f, 0.933049738f},
-std::array<float,2>{0.497805923f, 0.973040164f},
-std::array<float,2>{0.574389279f, 0.249270558f},
-std::array<float,2>{0.0839588121f, 0.465802103f},
-std::array<float,2>{0.955789924f, 0.555679023f},
-std::array<float,2>{0.173161656f, 0.695411444f},
-std::array<float,2>{0.866373956f, 0.330334872f},
-std::array<float,2>{0.262051135f, 0.111304663f},
-std::array<float,2>{0.734874427f, 0.803631723f},
-std::array<float,2>{0.196993887f, 0.844944715f},
-std::array<float,2>{0.775187433f, 0.0299970675f},
-std::array<float,2>{0.35504204f, 0.258360118f},
-std::array<float,2>{0.668521583f, 0.686608136f},
-std::array<float,2>{0.376254946f, 0.568365872f},
-std::array<float,2>{0.530889273f, 0.408428073f},
-std::array<float,2>{0.00438558264f, 0.161610663f},
-std::array<float,2>{0.930515707f, 0.880469263f},
-std::array<float,2>{0.253695846f, 0.945020616f},
-std::array<float,2>{0.746388197f, 0.190206602f},
-std::array<float,2>{0.183604628f, 0.491575658f},
-std::array<float,2>{0.868007779f, 0.503413081f},
-std::array<float,2>{0.0894458964f, 0.7464059f},
-std::array<float,2>{0.96508044f, 0.365388811f},
-std::array<float,2>{0.486554861f, 0.062990047f},
-std::array<float,2>{0.565368891f, 0.758396029f},
-std::array<float,2>{0.0532840788f, 0.922583461f},
-std::array<float,2>{0.902103305f, 0.131657243f},
-std::array<float,2>{0.422635853f, 0.397488475f},
-std::array<float,2>{0.540511012f, 0.594401419f},
-std::array<float,2>{0.333343327f, 0.641140401f},
-std::array<float,2>{0.629095018f, 0.293803662f},
-std::array<float,2>{0.230872214f, 0.0562187731f},
-std::array<float,2>{0.796897888f, 0.824268997f},
-std::array<float,2>{0.454953164f, 0.807667017f},
-std::array<float,2>{0.624867499f, 0.12104544f},
-std::array<float,2>{0.122944303f, 0.342442065f},
-std::array<float,2>{0.993060708f, 0.690401495f},
-std::array<float,2>{0.151802853f, 0.550314724f},
-std::array<float,2>{0.837481618f, 0.460903317f},
-std::array<float,2>{0.301608503f, 0.240372777f},
-std::array<float,2>{0.694590211f, 0.980966687f},
-std::array<float,2>{0.158630177f, 0.996455729f},
-std::array<float,2>{0.857384741f, 0.232863754f},
-std::array<float,2>{0.274658293f, 0.443620533f},
-std::array<float,2>{0.722474158f, 0.544234753f},
-std::array<float,2>{0.481123328f, 0.711274087f},
-std::array<float,2>{0.588537395f, 0.32657221f},
-std::array<float,2>{0.0686777234f, 0.102458537f},
-std::array<float,2>{0.941507995f, 0.795697689f},
-std::array<float,2>{0.369191885f, 0.835096657f},
-std::array<float,2>{0.674355924f, 0.0433775447f},
-std::array<float,2>{0.216931477f, 0.297549397f},
-std::array<float,2>{0.759660363f, 0.637690485f},
-std::array<float,2>{0.0227133222f, 0.612726033f},
-std::array<float,2>{0.908548474f, 0.381290615f},
-std::array<float,2>{0.403532743f, 0.149277657f},
-std::array<float,2>{0.501436114f, 0.912584543f},
-std::array<float,2>{0.105286233f, 0.767954946f},
-std::array<float,2>{0.98225385f, 0.0865691304f},
-std::array<float,2>{0.451216102f, 0.347960681f},
-std::array<float,2>{0.604657888f, 0.733490825f},
-std::array<float,2>{0.290315509f, 0.523831904f},
-std::array<float,2>{0.706393957f, 0.470472008f},
-std::array<float,2>{0.127981663f, 0.215016678f},
-std::array<float,2>{0.825632453f, 0.954293907f},
-std::array<float,2>{0.407502234f, 0.898507178f},
-std::array<float,2>{0.5557428f, 0.17974402f},
-std::array<float,2>{0.0407696627f, 0.425474733f},
-std::array<float,2>{0.875408471f, 0.591995537f},
-std::array<float,2>{0.246299967f, 0.664635658f},
-std::array<float,2>{0.796275973f, 0.2723957f},
-std::array<float,2>{0.315767974f, 0.00582970399f},
-std::array<float,2>{0.646523476f, 0.867406964f},
-std::array<float,2>{0.209952593f, 0.812393427f},
-std::array<float,2>{0.751134038f, 0.122942865f},
-std::array<float,2>{0.366760463f, 0.336537749f},
-std::array<float,2>{0.68637377f, 0.693466902f},
-std::array<float,2>{0.397198349f, 0.552782893f},
-std::array<float,2>{0.508778036f, 0.453148514f},
-std::array<float,2>{0.0240907092f, 0.236485034f},
-std::array<float,2>{0.916186512f, 0.977138638f},
-std::array<float,2>{0.267800093f, 0.929331243f},
-std::array<float,2>{0.729281306f, 0.126355648f},
-std::array<float,2>{0.169748887f, 0.390705526f},
-std::array<float,2>{0.845491946f, 0.599817812f},
-std::array<float,2>{0.0744760558f, 0.646643698f},
-std::array<float,2>{0.945547998f, 0.289230287f},
-std::array<float,2>{0.469240546f, 0.0619516596f},
-std::array<float,2>{0.582682431f, 0.820684195f},
-std::array<float,2>{0.0367495865f, 0.939640641f},
-std::array<float,2>{0.884039164f, 0.193067148f},
-std::array<float,2>{0.420438856f, 0.4866063f},
-std::array<float,2>{0.548199892f, 0.507441401f},
-std::array<float,2>{0.320941538f, 0.745268166f},
-std::array<float,2>{0.651699603f, 0.362874478f},
-std::array<float,2>{0.236199528f, 0.0692766905f},
-std::array<float,2>{0.78268683f, 0.762326896f},
-std::array<float,2>{0.438598871f, 0.848486185f},
-std::array<float,2>{0.595527709f, 0.0260166321f},
-std::array<float,2>{0.0984520838f, 0.264365524f},
-std::array<float,2>{0.97580409f, 0.682385921f},
-std::array<float,2>{0.139625728f, 0.565061271f},
-std::array<float,2>{0.812664032f, 0.41298458f},
-std::array<float,2>{0.285121143f, 0.15736483f},
-std::array<float,2>{0.713743865f, 0.877141237f},
-std::array<float,2>{0.179586276f, 0.902460635f},
-std::array<float,2>{0.860161066f, 0.18563278f},
-std::array<float,2>{0.258548558f, 0.42968148f},
-std::array<float,2>{0.741085112f, 0.589461684f},
-std::array<float,2>{0.492829442f, 0.668449223f},
-std::array<float,2>{0.574160159f, 0.266308099f},
-std::array<float,2>{0.0803225785f, 0.00315662427f},
-std::array<float,2>{0.958287537f, 0.872826993f},
-std::array<float,2>{0.349025905f, 0.771225929f},
-std::array<float,2>{0.657011092f, 0.0921222568f},
-std::array<float,2>{0.187515721f, 0.344954848f},
-std::array<float,2>{0.76730305f, 0.730323136f},
-std::array<float,2>{0.0115260808f, 0.530696988f},
-std::array<float,2>{0.928022325f, 0.476494461f},
-std::array<float,2>{0.389133781f, 0.214811653f},
-std::array<float,2>{0.520229936f, 0.957608879f},
-std::array<float,2>{0.112505078f, 0.831484616f},
-std::array<float,2>{0.986047685f, 0.0429183282f},
-std::array<float,2>{0.461785197f, 0.302872449f},
-std::array<float,2>{0.61458987f, 0.636203468f},
-std::array<float,2>{0.306502163f, 0.615185201f},
-std::array<float,2>{0.701295316f, 0.377320975f},
-std::array<float,2>{0.144023791f, 0.154135689f},
-std::array<float,2>{0.830841064f, 0.90838021f},
-std::array<float,2>{0.435337812f, 0.995117545f},
-std::array<float,2>{0.533551872f, 0.228653654f},
-std::array<float,2>{0.0604564361f, 0.438945621f},
-std::array<float,2>{0.898244858f, 0.541524231f},
-std::array<float,2>{0.220290348f, 0.716595829f},
-std::array<float,2>{0.809782267f, 0.324154824f},
-std::array<float,2>{0.341036737f, 0.107827865f},
-std::array<float,2>{0.636145234f, 0.790311456f},
-std::array<float,2>{0.156068727f, 0.860310614f},
-std::array<float,2>{0.842250884f, 0.0149138225f},
-std::array<float,2>{0.298432529f, 0.279676914f},
-std::array<float,2>{0.689896226f, 0.660220563f},
-std::array<float,2>{0.457424909f, 0.584607482f},
-std::array<float,2>{0.620252371f, 0.432418942f},
-std::array<float,2>{0.11996191f, 0.175225675f},
-std::array<float,2>{0.998590171f, 0.891322076f},
-std::array<float,2>{0.331606984f, 0.963882506f},
-std::array<float,2>{0.626939952f, 0.207708478f},
-std::array<float,2>{0.230179846f, 0.478529096f},
-std::array<float,2>{0.803174853f, 0.516207278f},
-std::array<float,2>{0.0484755673f, 0.72226274f},
-std::array<float,2>{0.904581785f, 0.35317415f},
-std::array<float,2>{0.428507566f, 0.0802672282f},
-std::array<float,2>{0.544104993f, 0.776047945f},
-std::array<float,2>{0.0904508382f, 0.917719066f},
-std::array<float,2>{0.961612344f, 0.143606782f},
-std::array<float,2>{0.491309017f, 0.387716293f},
-std::array<float,2>{0.56714654f, 0.620870888f},
-std::array<float,2>{0.255957156f, 0.632211268f},
-std::array<float,2>{0.745158195f, 0.306064606f},
-std::array<float,2>{0.180225119f, 0.0330998451f},
-std::array<float,2>{0.871180773f, 0.840254247f},
-std::array<float,2>{0.380072147f, 0.781569421f},
-std::array<float,2>{0.525428295f, 0.0958691984f},
-std::array<float,2>{0.00071413425f, 0.312895089f},
-std::array<float,2>{0.934212506f, 0.710681319f},
-std::array<float,2>{0.201009586f, 0.532065272f},
-std::array<float,2>{0.780545592f, 0.445495397f},
-std::array<float,2>{0.357958496f, 0.222668827f},
-std::array<float,2>{0.666991115f, 0.990208089f},
-std::array<float,2>{0.245646149f, 0.968815506f},
-std::array<float,2>{0.789152563f, 0.244407788f},
-std::array<float,2>{0.316441655f, 0.46267724f},
-std::array<float,2>{0.642639935f, 0.561321259f},
-std::array<float,2>{0.413968801f, 0.702055395f},
-std::array<float,2>{0.559163451f, 0.334228128f},
-std::array<float,2>{0.046428483f, 0.115916342f},
-std::array<float,2>{0.880167603f, 0.799474657f},
-std::array<float,2>{0.294855535f, 0.815099895f},
-std::array<float,2>{0.709287226f, 0.0499266908f},
-std::array<float,2>{0.132383466f, 0.288231164f},
-std::array<float,2>{0.822179496f, 0.651640177f},
-std::array<float,2>{0.108019784f, 0.606174231f},
-std::array<float,2>{0.979057252f, 0.401420474f},
-std::array<float,2>{0.448093414f, 0.139891416f},
-std::array<float,2>{0.608902097f, 0.937086046f},
-std::array<float,2>{0.018901553f, 0.753769457f},
-std::array<float,2>{0.912662208f, 0.0728134885f},
-std::array<float,2>{0.40067336f, 0.371698439f},
-std::array<float,2>{0.506860137f, 0.736507118f},
-std::array<float,2>{0.373346776f, 0.513777256f},
-std::array<float,2>{0.675880432f, 0.499896288f},
-std::array<float,2>{0.212537333f, 0.196432427f},
-std::array<float,2>{0.764033377f, 0.952574849f},
-std::array<float,2>{0.477376878f, 0.885137916f},
-std::array<float,2>{0.589980245f, 0.169657677f},
-std::array<float,2>{0.0625032485f, 0.420531213f},
-std::array<float,2>{0.938956261f, 0.577171266f},
-std::array<float,2>{0.160381407f, 0.672709882f},
-std::array<float,2>{0.852123916f, 0.253601879f},
-std::array<float,2>{0.279866874f, 0.0219612736f},
-std::array<float,2>{0.724447072f, 0.852285147f},
-std::array<float,2>{0.1665764f, 0.778392613f},
-std::array<float,2>{0.850834429f, 0.0826844499f},
-std::array<float,2>{0.272833258f, 0.356755286f},
-std::array<float,2>{0.734259486f, 0.723201394f},
-std::array<float,2>{0.47349897f, 0.52219069f},
-std::array<float,2>{0.580890834f, 0.482902884f},
-std::array<float,2>{0.0731622726f, 0.203926146f},
-std::array<float,2>{0.951193094f, 0.967173278f},
-std::array<float,2>{0.360476881f, 0.895872533f},
-std::array<float,2>{0.681074083f, 0.178043827f},
-std::array<float,2>{0.204858795f, 0.434778631f},
-std::array<float,2>{0.756319642f, 0.579004049f},
-std::array<float,2>{0.0287223253f, 0.656665087f},
-std::array<float,2>{0.920189321f, 0.275351822f},
-std::array<float,2>{0.392474383f, 0.00883213524f},
-std::array<float,2>{0.514273524f, 0.863722205f},
-std::array<float,2>{0.096691668f, 0.985239625f},
-std::array<float,2>{0.971087098f, 0.222002193f},
-std::array<float,2>{0.441861093f, 0.452479571f},
-std::array<float,2>{0.599609852f, 0.537248135f},
-std::array<float,2>{0.287711471f, 0.70342356f},
-std::array<float,2>{0.715500832f, 0.317963779f},
-std::array<float,2>{0.134191334f, 0.0996111259f},
-std::array<float,2>{0.819380999f, 0.786517859f},
-std::array<float,2>{0.417787492f, 0.839012623f},
-std::array<float,2>{0.552477419f, 0.0369712114f},
-std::array<float,2>{0.0340680256f, 0.310480386f},
-std::array<float,2>{0.88685286f, 0.626025259f},
-std::array<float,2>{0.242057592f, 0.624290526f},
-std::array<float,2>{0.788728595f, 0.383797616f},
-std::array<float,2>{0.326319396f, 0.145140156f},
-std::array<float,2>{0.653766274f, 0.919135332f},
-std::array<float,2>{0.193992108f, 0.93123877f},
-std::array<float,2>{0.769559979f, 0.13463591f},
-std::array<float,2>{0.345883012f, 0.404958993f},
-std::array<float,2>{0.660223544f, 0.601574183f},
-std::array<float,2>{0.383252919f, 0.65415889f},
-std::array<float,2>{0.516852498f, 0.283147663f},
-std::array<float,2>{0.0138843926f, 0.0536427386f},
-std::array<float,2>{0.922212243f, 0.818357527f},
-std::array<float,2>{0.265062332f, 0.801423013f},
-std::array<float,2>{0.738124549f, 0.111702301f},
-std::array<float,2>{0.174967438f, 0.329144746f},
-std::array<float,2>{0.865210891f, 0.69793725f},
-std::array<float,2>{0.0839937106f, 0.556664824f},
-std::array<float,2>{0.954287767f, 0.466999471f},
-std::array<float,2>{0.498594344f, 0.246502355f},
-std::array<float,2>{0.577083647f, 0.975857735f},
-std::array<float,2>{0.0569671951f, 0.859054685f},
-std::array<float,2>{0.892131627f, 0.0178750847f},
-std::array<float,2>{0.431481034f, 0.254911602f},
-std::array<float,2>{0.537701428f, 0.676995099f},
-std::array<float,2>{0.336709857f, 0.570966423f},
-std::array<float,2>{0.638076842f, 0.416261733f},
-std::array<float,2>{0.225746125f, 0.166687995f},
-std::array<float,2>{0.80810082f, 0.890031457f},
-std::array<float,2>{0.466446817f, 0.947773695f},
-std::array<float,2>{0.613142312f, 0.200089127f},
-std::array<float,2>{0.116185322f, 0.492889941f},
-std::array<float,2>{0.990162075f, 0.510234058f},
-std::array<float,2>{0.14705947f, 0.740705013f},
-std::array<float,2>{0.835732281f, 0.370063335f},
-std::array<float,2>{0.311917245f, 0.0752516165f},
-std::array<float,2>{0.695943773f, 0.755197227f},
-std::array<float,2>{0.234322891f, 0.827706039f},
-std::array<float,2>{0.800070286f, 0.0582272224f},
-std::array<float,2>{0.334210217f, 0.296561033f},
-std::array<float,2>{0.631162822f, 0.643072724f},
-std::array<float,2>{0.42551142f, 0.596408725f},
-std::array<float,2>{0.542096257f, 0.396440297f},
-std::array<float,2>{0.0522543155f, 0.130691722f},
-std::array<float,2>{0.89861387f, 0.925346136f},
-std::array<float,2>{0.304069281f, 0.984128118f},
-std::array<float,2>{0.692501307f, 0.239447758f},
-std::array<float,2>{0.149010614f, 0.458399594f},
-std::array<float,2>{0.839132309f, 0.548797369f},
-std::array<float,2>{0.123346761f, 0.688926339f},
-std::array<float,2>{0.994354606f, 0.340099424f},
-std::array<float,2>{0.456150144f, 0.118219867f},
-std::array<float,2>{0.621367991f, 0.804775298f},
-std::array<float,2>{0.00674918294f, 0.88264668f},
-std::array<float,2>{0.932587028f, 0.163934141f},
-std::array<float,2>{0.377315789f, 0.406437218f},
-std::array<float,2>{0.527626753f, 0.567858219f},
-std::array<float,2>{0.351703167f, 0.684090555f},
-std::array<float,2>{0.6711573f, 0.26135233f},
-std::array<float,2>{0.197910964f, 0.0286185481f},
-std::array<float,2>{0.775649726f, 0.847591102f},
-std::array<float,2>{0.485153854f, 0.760849118f},
-std::array<float,2>{0.563705146f, 0.0661180168f},
-std::array<float,2>{0.0873761624f, 0.364631146f},
-std::array<float,2>{0.967368066f, 0.749968529f},
-std::array<float,2>{0.186837628f, 0.50037998f},
-std::array<float,2>{0.869717717f, 0.490179151f},
-std::array<float,2>{0.250286371f, 0.188671619f},
-std::array<float,2>{0.748482168f, 0.942678094f},
-std::array<float,2>{0.125581592f, 0.956637681f},
-std::array<float,2>{0.827359796f, 0.217885956f},
-std::array<float,2>{0.291874081f, 0.472004741f},
-std::array<float,2>{0.704180062f, 0.526278317f},
-std::array<float,2>{0.449407518f, 0.731311858f},
-std::array<float,2>{0.601734161f, 0.349771142f},
-std::array<float,2>{0.103112482f, 0.0891793668f},
-std::array<float,2>{0.983466566f, 0.767450869f},
-std::array<float,2>{0.313366324f, 0.869757354f},
-std::array<float,2>{0.645086884f, 0.00759721734f},
-std::array<float,2>{0.249494791f, 0.270523578f},
-std::array<float,2>{0.793279588f, 0.667403996f},
-std::array<float,2>{0.0421757214f, 0.590529323f},
-std::array<float,2>{0.877623737f, 0.423600197f},
-std::array<float,2>{0.40991053f, 0.182536498f},
-std::array<float,2>{0.558321595f, 0.901042283f},
-std::array<float,2>{0.0676442608f, 0.793267071f},
-std::array<float,2>{0.943989754f, 0.103618823f},
-std::array<float,2>{0.484116644f, 0.324719578f},
-std::array<float,2>{0.586880565f, 0.714635849f},
-std::array<float,2>{0.27584669f, 0.546666563f},
-std::array<float,2>{0.719883025f, 0.441708505f},
-std::array<float,2>{0.157767907f, 0.231605753f},
-std::array<float,2>{0.858114958f, 0.999197423f},
-std::array<float,2>{0.406146884f, 0.911537826f},
-std::array<float,2>{0.50325489f, 0.151135564f},
-std::array<float,2>{0.0196450409f, 0.379296511f},
-std::array<float,2>{0.906435907f, 0.609612226f},
-std::array<float,2>{0.216796607f, 0.639334321f},
-std::array<float,2>{0.761712432f, 0.30074209f},
-std::array<float,2>{0.367929041f, 0.0451085791f},
-std::array<float,2>{0.673240304f, 0.832669079f},
-std::array<float,2>{0.212215975f, 0.750777662f},
-std::array<float,2>{0.764446318f, 0.0711542293f},
-std::array<float,2>{0.373616129f, 0.373437285f},
-std::array<float,2>{0.676501811f, 0.735702097f},
-std::array<float,2>{0.400974095f, 0.512038112f},
-std::array<float,2>{0.507431328f, 0.496241242f},
-std::array<float,2>{0.0191170201f, 0.198172361f},
-std::array<float,2>{0.912400305f, 0.949246049f},
-std::array<float,2>{0.279440463f, 0.883867681f},
-std::array<float,2>{0.723949552f, 0.17119509f},
-std::array<float,2>{0.16069822f, 0.419712365f},
-std::array<float,2>{0.851912916f, 0.57591033f},
-std::array<float,2>{0.0633094162f, 0.674905002f},
-std::array<float,2>{0.938976705f, 0.250004172f},
-std::array<float,2>{0.476564914f, 0.0210802406f},
-std::array<float,2>{0.590352774f, 0.853933692f},
-std::array<float,2>{0.0461991616f, 0.972350359f},
-std::array<float,2>{0.880488455f, 0.243016362f},
-std::array<float,2>{0.413427085f, 0.463622004f},
-std::array<float,2>{0.558902502f, 0.560421884f},
-std::array<float,2>{0.317160398f, 0.700601578f},
-std::array<float,2>{0.64310503f, 0.332558811f},
-std::array<float,2>{0.245499492f, 0.115126081f},
-std::array<float,2>{0.789745569f, 0.797468424f},
-std::array<float,2>{0.447723001f, 0.814051628f},
-std::array<float,2>{0.608798444f, 0.0474610627f},
-std::array<float,2>{0.107550621f, 0.285681099f},
-std::array<float,2>{0.978937268f, 0.649125338f},
-std::array<float,2>{0.132081911f, 0.608155608f},
-std::array<float,2>{0.821613848f, 0.398907781f},
-std::array<float,2>{0.294089586f, 0.138566181f},
-std::array<float,2>{0.709872186f, 0.934588552f},
-std::array<float,2>{0.179751903f, 0.91455096f},
-std::array<float,2>{0.871827602f, 0.141298056f},
-std::array<float,2>{0.256765038f, 0.390326291f},
-std::array<float,2>{0.745857596f, 0.617914796f},
-std::array<float,2>{0.49176085f, 0.63058573f},
-std::array<float,2>{0.566515028f, 0.306856215f},
-std::array<float,2>{0.0900939554f, 0.0333194584f},
-std::array<float,2>{0.960999966f, 0.842701137f},
-std::array<float,2>{0.357534945f, 0.784437776f},
-std::array<float,2>{0.666104794f, 0.0938962922f},
-std::array<float,2>{0.200521365f, 0.315856457f},
-std::array<float,2>{0.780960262f, 0.708429337f},
-std::array<float,2>{0.000346769608f, 0.535061061f},
-std::array<float,2>{0.933924913f, 0.448215574f},
-std::array<float,2>{0.380426526f, 0.224630058f},
-std::array<float,2>{0.525982499f, 0.99147135f},
-std::array<float,2>{0.119545393f, 0.861591637f},
-std::array<float,2>{0.998178482f, 0.0135451583f},
-std::array<float,2>{0.457576543f, 0.279101998f},
-std::array<float,2>{0.621050835f, 0.662724912f},
-std::array<float,2>{0.298128575f, 0.582560062f},
-std::array<float,2>{0.690194666f, 0.429819167f},
-std::array<float,2>{0.155389935f, 0.172594562f},
-std::array<float,2>{0.842642665f, 0.89326936f},
-std::array<float,2>{0.428077757f, 0.962537289f},
-std::array<float,2>{0.544778764f, 0.210855991f},
-std::array<float,2>{0.0480168164f, 0.477543592f},
-std::array<float,2>{0.904869676f, 0.517673135f},
-std::array<float,2>{0.229935557f, 0.719274938f},
-std::array<float,2>{0.803490341f, 0.354610652f},
-std::array<float,2>{0.331095994f, 0.0788789839f},
-std::array<float,2>{0.626320124f, 0.774947822f},
-std::array<float,2>{0.144200876f, 0.828469872f},
-std::array<float,2>{0.830301046f, 0.039645806f},
-std::array<float,2>{0.306136221f, 0.301227599f},
-std::array<float,2>{0.701719105f, 0.634631276f},
-std::array<float,2>{0.461284101f, 0.61648792f},
-std::array<float,2>{0.614792466f, 0.376167715f},
-std::array<float,2>{0.112997688f, 0.154815704f},
-std::array<float,2>{0.985539734f, 0.907680154f},
-std::array<float,2>{0.341486156f, 0.992862999f},
-std::array<float,2>{0.636613846f, 0.227531925f},
-std::array<float,2>{0.219861865f, 0.439778954f},
-std::array<float,2>{0.810444832f, 0.53965354f},
-std::array<float,2>{0.0596364588f, 0.718308806f},
-std::array<float,2>{0.897753417f, 0.322073579f},
-std::array<float,2>{0.435032457f, 0.105621077f},
-std::array<float,2>{0.533968687f, 0.791704595f},
-std::array<float,2>{0.0809926614f, 0.905997097f},
-std::array<float,2>{0.958779097f, 0.183616906f},
-std::array<float,2>{0.492432833f, 0.426103473f},
-std::array<float,2>{0.573277056f, 0.586280882f},
-std::array<float,2>{0.258105665f, 0.670120895f},
-std::array<float,2>{0.740662992f, 0.269307256f},
-std::array<float,2>{0.179015264f, 0.00188579666f},
-std::array<float,2>{0.859786272f, 0.873465121f},
-std::array<float,2>{0.389605761f, 0.773256242f},
-std::array<float,2>{0.519535124f, 0.091076076f},
-std::array<float,2>{0.0111513576f, 0.346901238f},
-std::array<float,2>{0.928257883f, 0.727676272f},
-std::array<float,2>{0.18844445f, 0.528190136f},
-std::array<float,2>{0.766738832f, 0.474323094f},
-std::array<float,2>{0.349283248f, 0.212862208f},
-std::array<float,2>{0.656543016f, 0.959992647f},
-std::array<float,2>{0.235578686f, 0.939340651f},
-std::array<float,2>{0.782752633f, 0.194347709f},
-std::array<float,2>{0.320351213f, 0.485417902f},
-std::array<float,2>{0.651948988f, 0.50405997f},
-std::array<float,2>{0.420271337f, 0.743452966f},
-std::array<float,2>{0.548376918f, 0.360483229f},
-std::array<float,2>{0.0362236276f, 0.0678977668f},
-std::array<float,2>{0.88465488f, 0.7645787f},
-std::array<float,2>{0.284611523f, 0.850512445f},
-std::array<float,2>{0.713176489f, 0.0236526486f},
-std::array<float,2>{0.139044181f, 0.26216951f},
-std::array<float,2>{0.813090146f, 0.680679679f},
-std::array<float,2>{0.0980876014f, 0.563442826f},
-std::array<float,2>{0.976357698f, 0.411259651f},
-std::array<float,2>{0.439036071f, 0.158363059f},
-std::array<float,2>{0.594791591f, 0.876190186f},
-std::array<float,2>{0.0236677285f, 0.809189558f},
-std::array<float,2>{0.916937053f, 0.124744132f},
-std::array<float,2>{0.396912873f, 0.339664519f},
-std::array<float,2>{0.507864058f, 0.692310631f},
-std::array<float,2>{0.366675377f, 0.552329123f},
-std::array<float,2>{0.685684621f, 0.455970585f},
-std::array<float,2>{0.209151596f, 0.235990465f},
-std::array<float,2>{0.751763523f, 0.978572607f},
-std::array<float,2>{0.468847722f, 0.926795959f},
-std::array<float,2>{0.582256198f, 0.128709793f},
-std::array<float,2>{0.0749388561f, 0.393239707f},
-std::array<float,2>{0.946239293f, 0.598473668f},
-std::array<float,2>{0.169120356f, 0.644985259f},
-std::array<float,2>{0.845028937f, 0.292640328f},
-std::array<float,2>{0.268460691f, 0.0596885942f},
-std::array<float,2>{0.728911281f, 0.823625624f},
-std::array<float,2>{0.157264367f, 0.794933259f},
-std::array<float,2>{0.857630253f, 0.101797633f},
-std::array<float,2>{0.276007324f, 0.326988757f},
-std::array<float,2>{0.720682383f, 0.711755037f},
-std::array<float,2>{0.483617216f, 0.544502139f},
-std::array<float,2>{0.586264431f, 0.444083661f},
-std::array<float,2>{0.06811589f, 0.232988f},
-std::array<float,2>{0.943711162f, 0.997042298f},
-std::array<float,2>{0.367291182f, 0.912808716f},
-std::array<float,2>{0.673441231f, 0.148676261f},
-std::array<float,2>{0.216054559f, 0.38144812f},
-std::array<float,2>{0.760847449f, 0.613136709f},
-std::array<float,2>{0.0200856756f, 0.636981547f},
-std::array<float,2>{0.906827271f, 0.297295094f},
-std::array<float,2>{0.405641079f, 0.0435267873f},
-std::array<float,2>{0.503774881f, 0.8354671f},
-std::array<float,2>{0.102685168f, 0.954773843f},
-std::array<float,2>{0.983960152f, 0.215479091f},
-std::array<float,2>{0.449900389f, 0.47008577f},
-std::array<float,2>{0.602524877f, 0.524409711f},
-std::array<float,2>{0.291386187f, 0.733925223f},
-std::array<float,2>{0.705000877f, 0.348308295f},
-std::array<float,2>{0.125006303f, 0.0861025825f},
-std::array<float,2>{0.827801943f, 0.768069685f},
-std::array<float,2>{0.409367532f, 0.867830992f},
-std::array<float,2>{0.557905138f, 0.00508064451f},
-std::array<float,2>{0.0426418856f, 0.271888435f},
-std::array<float,2>{0.877188742f, 0.664208174f},
-std::array<float,2>{0.249973655f, 0.592534423f},
-std::array<float,2>{0.793482721f, 0.424971551f},
-std::array<float,2>{0.312609583f, 0.180181056f},
-std::array<float,2>{0.644642293f, 0.899027169f},
-std::array<float,2>{0.197723329f, 0.880039394f},
-std::array<float,2>{0.775964737f, 0.16175209f},
-std::array<float,2>{0.352210462f, 0.408951014f},
-std::array<float,2>{0.671619713f, 0.569017649f},
-std::array<float,2>{0.377646923f, 0.687467515f},
-std::array<float,2>{0.527965546f, 0.257820219f},
-std::array<float,2>{0.00606718287f, 0.029692864f},
-std::array<float,2>{0.931954503f, 0.845298111f},
-std::array<float,2>{0.250790834f, 0.758296192f},
-std::array<float,2>{0.748699546f, 0.0627696589f},
-std::array<float,2>{0.187173933f, 0.365951329f},
-std::array<float,2>{0.869273245f, 0.746875465f},
-std::array<float,2>{0.0877554491f, 0.503649771f},
-std::array<float,2>{0.966817319f, 0.491829455f},
-std::array<float,2>{0.484697074f, 0.189713299f},
-std::array<float,2>{0.564097345f, 0.944404423f},
-std::array<float,2>{0.052037444f, 0.82503593f},
-std::array<float,2>{0.899145424f, 0.0560598113f},
-std::array<float,2>{0.424937963f, 0.293357491f},
-std::array<float,2>{0.542682827f, 0.640784621f},
-std::array<float,2>{0.334935069f, 0.59415859f},
-std::array<float,2>{0.631551623f, 0.398133516f},
-std::array<float,2>{0.233625516f, 0.130947366f},
-std::array<float,2>{0.800494671f, 0.921994984f},
-std::array<float,2>{0.456858814f, 0.980620325f},
-std::array<float,2>{0.621641099f, 0.240880489f},
-std::array<float,2>{0.124013819f, 0.46006161f},
-std::array<float,2>{0.994894147f, 0.54988271f},
-std::array<float,2>{0.148731887f, 0.689485133f},
-std::array<float,2>{0.839804411f, 0.342125624f},
-std::array<float,2>{0.304371983f, 0.120165519f},
-std::array<float,2>{0.693208694f, 0.808238029f},
-std::array<float,2>{0.226554438f, 0.857343018f},
-std::array<float,2>{0.80821389f, 0.0163855385f},
-std::array<float,2>{0.335960209f, 0.256593078f},
-std::array<float,2>{0.638347447f, 0.677952886f},
-std::array<float,2>{0.430931956f, 0.573188305f},
-std::array<float,2>{0.537114084f, 0.415534019f},
-std::array<float,2>{0.0576118156f, 0.164647087f},
-std::array<float,2>{0.891911447f, 0.888418436f},
-std::array<float,2>{0.312075168f, 0.945546091f},
-std::array<float,2>{0.695715785f, 0.203104168f},
-std::array<float,2>{0.146648824f, 0.495717257f},
-std::array<float,2>{0.835330129f, 0.509124875f},
-std::array<float,2>{0.115429193f, 0.738698125f},
-std::array<float,2>{0.989620268f, 0.368114382f},
-std::array<float,2>{0.465932816f, 0.0766160861f},
-std::array<float,2>{0.612774074f, 0.756652236f},
-std::array<float,2>{0.0142524345f, 0.933464587f},
-std::array<float,2>{0.922493339f, 0.135504305f},
-std::array<float,2>{0.38341108f, 0.403208107f},
-std::array<float,2>{0.517294705f, 0.605104566f},
-std::array<float,2>{0.346195132f, 0.654737055f},
-std::array<float,2>{0.660718501f, 0.283383727f},
-std::array<float,2>{0.193800986f, 0.0513934419f},
-std::array<float,2>{0.770260394f, 0.819024086f},
-std::array<float,2>{0.498114526f, 0.802942991f},
-std::array<float,2>{0.576404691f, 0.110366717f},
-std::array<float,2>{0.0847770348f, 0.330911726f},
-std::array<float,2>{0.954897821f, 0.695993662f},
-std::array<float,2>{0.175360054f, 0.556272626f},
-std::array<float,2>{0.864382029f, 0.464877188f},
-std::array<float,2>{0.265601248f, 0.249909773f},
-std::array<float,2>{0.737707138f, 0.973218024f},
-std::array<float,2>{0.134596542f, 0.987061322f},
-std::array<float,2>{0.820287168f, 0.219709814f},
-std::array<float,2>{0.287579745f, 0.450005352f},
-std::array<float,2>{0.715081215f, 0.536315382f},
-std::array<float,2>{0.442246825f, 0.706752539f},
-std::array<float,2>{0.600557089f, 0.320228308f},
-std::array<float,2>{0.0972712114f, 0.099116452f},
-std::array<float,2>{0.971459746f, 0.788245499f},
-std::array<float,2>{0.326738268f, 0.836419642f},
-std::array<float,2>{0.654089928f, 0.037186861f},
-std::array<float,2>{0.241355091f, 0.312190086f},
-std::array<float,2>{0.788491547f, 0.627446294f},
-std::array<float,2>{0.0334983207f, 0.622616529f},
-std::array<float,2>{0.887642324f, 0.38665992f},
-std::array<float,2>{0.41741097f, 0.1480207f},
-std::array<float,2>{0.551842451f, 0.921452522f},
-std::array<float,2>{0.0727009699f, 0.780712783f},
-std::array<float,2>{0.95181632f, 0.0842984095f},
-std::array<float,2>{0.47294718f, 0.357733935f},
-std::array<float,2>{0.580336213f, 0.726183772f},
-std::array<float,2>{0.27315256f, 0.519665778f},
-std::array<float,2>{0.733698666f, 0.481917292f},
-std::array<float,2>{0.16638428f, 0.205546573f},
-std::array<float,2>{0.851116717f, 0.965239465f},
-std::array<float,2>{0.391880065f, 0.896955073f},
-std::array<float,2>{0.513880074f, 0.177520812f},
-std::array<float,2>{0.0291685704f, 0.437291503f},
-std::array<float,2>{0.920880914f, 0.580673099f},
-std::array<float,2>{0.204225466f, 0.659524918f},
-std::array<float,2>{0.756810009f, 0.275438547f},
-std::array<float,2>{0.36095348f, 0.0116915097f},
-std::array<float,2>{0.681589365f, 0.867139995f},
-std::array<float,2>{0.243884549f, 0.799039602f},
-std::array<float,2>{0.791628003f, 0.115271583f},
-std::array<float,2>{0.318954259f, 0.334889144f},
-std::array<float,2>{0.641962528f, 0.701508045f},
-std::array<float,2>{0.411971688f, 0.560878336f},
-std::array<float,2>{0.561509192f, 0.461915582f},
-std::array<float,2>{0.0435972251f, 0.245010093f},
-std::array<float,2>{0.88126421f, 0.969506502f},
-std::array<float,2>{0.295491606f, 0.936882377f},
-std::array<float,2>{0.708146274f, 0.140379086f},
-std::array<float,2>{0.130483732f, 0.402314067f},
-std::array<float,2>{0.823348105f, 0.605887234f},
-std::array<float,2>{0.106174663f, 0.652186096f},
-std::array<float,2>{0.977969766f, 0.288645446f},
-std::array<float,2>{0.445931047f, 0.0503917672f},
-std::array<float,2>{0.606216788f, 0.814667404f},
-std::array<float,2>{0.016689213f, 0.95283407f},
-std::array<float,2>{0.91074276f, 0.196836919f},
-std::array<float,2>{0.399062037f, 0.499364048f},
-std::array<float,2>{0.50579077f, 0.514179111f},
-std::array<float,2>{0.371853352f, 0.737149715f},
-std::array<float,2>{0.679654956f, 0.37153393f},
-std::array<float,2>{0.214811549f, 0.0724025965f},
-std::array<float,2>{0.763087809f, 0.753045559f},
-std::array<float,2>{0.478760064f, 0.851735771f},
-std::array<float,2>{0.59186548f, 0.0220432635f},
-std::array<float,2>{0.0653665364f, 0.253028929f},
-std::array<float,2>{0.940646529f, 0.671924591f},
-std::array<float,2>{0.162149966f, 0.577755213f},
-std::array<float,2>{0.855330408f, 0.419985563f},
-std::array<float,2>{0.278353989f, 0.169021368f},
-std::array<float,2>{0.724933386f, 0.885346234f},
-std::array<float,2>{0.153324753f, 0.89075011f},
-std::array<float,2>{0.841626287f, 0.175741985f},
-std::array<float,2>{0.300663054f, 0.432013333f},
-std::array<float,2>{0.688497007f, 0.584313214f},
-std::array<float,2>{0.459956259f, 0.66093874f},
-std::array<float,2>{0.617613852f, 0.279991627f},
-std::array<float,2>{0.118390813f, 0.0153535008f},
-std::array<float,2>{0.997583151f, 0.859464049f},
-std::array<float,2>{0.329990804f, 0.775467753f},
-std::array<float,2>{0.628655553f, 0.0809801444f},
-std::array<float,2>{0.227938145f, 0.352567136f},
-std::array<float,2>{0.801493883f, 0.721978247f},
-std::array<float,2>{0.0500636287f, 0.515778065f},
-std::array<float,2>{0.903366923f, 0.47909072f},
-std::array<float,2>{0.427224994f, 0.207308844f},
-std::array<float,2>{0.545621693f, 0.964532137f},
-std::array<float,2>{0.0926346481f, 0.840769291f},
-std::array<float,2>{0.963855207f, 0.0327115692f},
-std::array<float,2>{0.489518195f, 0.306536317f},
-std::array<float,2>{0.569261372f, 0.632468462f},
-std::array<float,2>{0.255444884f, 0.620130539f},
-std::array<float,2>{0.74346751f, 0.388547748f},
-std::array<float,2>{0.183403358f, 0.144168884f},
-std::array<float,2>{0.873627245f, 0.917339146f},
-std::array<float,2>{0.382567644f, 0.989592373f},
-std::array<float,2>{0.523479998f, 0.223266557f},
-std::array<float,2>{0.00317814737f, 0.446195096f},
-std::array<float,2>{0.935666382f, 0.531380177f},
-std::array<float,2>{0.202407375f, 0.710026383f},
-std::array<float,2>{0.777740717f, 0.313411385f},
-std::array<float,2>{0.356256992f, 0.09633784f},
-std::array<float,2>{0.664566994f, 0.781811595f},
-std::array<float,2>{0.17650038f, 0.872427762f},
-std::array<float,2>{0.86260587f, 0.00383253908f},
-std::array<float,2>{0.259791464f, 0.265635967f},
-std::array<float,2>{0.740154684f, 0.668694258f},
-std::array<float,2>{0.494513899f, 0.589244783f},
-std::array<float,2>{0.572079957f, 0.428856045f},
-std::array<float,2>{0.0797481164f, 0.186406106f},
-std::array<float,2>{0.960099399f, 0.903197646f},
-std::array<float,2>{0.349901944f, 0.957153738f},
-std::array<float,2>{0.658563912f, 0.214168325f},
-std::array<float,2>{0.190368399f, 0.475775331f},
-std::array<float,2>{0.768498421f, 0.531154096f},
-std::array<float,2>{0.00821371283f, 0.729845107f},
-std::array<float,2>{0.92657268f, 0.345521182f},
-std::array<float,2>{0.387465507f, 0.0923014879f},
-std::array<float,2>{0.521641314f, 0.77071774f},
-std::array<float,2>{0.110904254f, 0.908768892f},
-std::array<float,2>{0.987744153f, 0.153802574f},
-std::array<float,2>{0.46430108f, 0.377691239f},
-std::array<float,2>{0.615606368f, 0.614530802f},
-std::array<float,2>{0.308568865f, 0.636283994f},
-std::array<float,2>{0.700169265f, 0.303633779f},
-std::array<float,2>{0.14154239f, 0.0422044843f},
-std::array<float,2>{0.829092801f, 0.832027018f},
-std::array<float,2>{0.436956525f, 0.791009665f},
-std::array<float,2>{0.53138572f, 0.108150899f},
-std::array<float,2>{0.0621628575f, 0.323350459f},
-std::array<float,2>{0.895765185f, 0.715850413f},
-std::array<float,2>{0.221891373f, 0.541492164f},
-std::array<float,2>{0.810861886f, 0.439150125f},
-std::array<float,2>{0.343586385f, 0.229262039f},
-std::array<float,2>{0.633291662f, 0.995823503f},
-std::array<float,2>{0.208683312f, 0.977004349f},
-std::array<float,2>{0.752325296f, 0.236920789f},
-std::array<float,2>{0.363465488f, 0.45406121f},
-std::array<float,2>{0.683605015f, 0.553534806f},
-std::array<float,2>{0.395391732f, 0.69429183f},
-std::array<float,2>{0.510070026f, 0.335984468f},
-std::array<float,2>{0.02617977f, 0.122353144f},
-std::array<float,2>{0.914615631f, 0.811601579f},
-std::array<float,2>{0.265756279f, 0.821112335f},
-std::array<float,2>{0.728371084f, 0.0622185208f},
-std::array<float,2>{0.170466334f, 0.289592087f},
-std::array<float,2>{0.846063256f, 0.647031188f},
-std::array<float,2>{0.0775760189f, 0.600144804f},
-std::array<float,2>{0.948765814f, 0.391162694f},
-std::array<float,2>{0.472269088f, 0.126861557f},
-std::array<float,2>{0.584783494f, 0.928904653f},
-std::array<float,2>{0.0386120975f, 0.76183188f},
-std::array<float,2>{0.885750473f, 0.0685588717f},
-std::array<float,2>{0.419670492f, 0.362676233f},
-std::array<float,2>{0.549717605f, 0.745896041f},
-std::array<float,2>{0.323803276f, 0.50731492f},
-std::array<float,2>{0.649559975f, 0.487096369f},
-std::array<float,2>{0.236620381f, 0.192750111f},
-std::array<float,2>{0.784858644f, 0.940415621f},
-std::array<float,2>{0.440407664f, 0.877649188f},
-std::array<float,2>{0.597114682f, 0.157835633f},
-std::array<float,2>{0.101323865f, 0.41257897f},
-std::array<float,2>{0.972926855f, 0.56453234f},
-std::array<float,2>{0.138173297f, 0.681835771f},
-std::array<float,2>{0.816040576f, 0.263801843f},
-std::array<float,2>{0.28200984f, 0.0257818624f},
-std::array<float,2>{0.712880254f, 0.847916365f},
-std::array<float,2>{0.128881261f, 0.7667889f},
-std::array<float,2>{0.825762153f, 0.0893925652f},
-std::array<float,2>{0.290931493f, 0.350121111f},
-std::array<float,2>{0.706947088f, 0.730638862f},
-std::array<float,2>{0.452120215f, 0.525730371f},
-std::array<float,2>{0.605092227f, 0.472260892f},
-std::array<float,2>{0.104676433f, 0.218545735f},
-std::array<float,2>{0.981921494f, 0.956151128f},
-std::array<float,2>{0.316207528f, 0.900860965f},
-std::array<float,2>{0.647383392f, 0.181800917f},
-std::array<float,2>{0.247025013f, 0.423175752f},
-std::array<float,2>{0.796545208f, 0.59021455f},
-std::array<float,2>{0.0403456427f, 0.667756438f},
-std::array<float,2>{0.875840425f, 0.271330744f},
-std::array<float,2>{0.407736689f, 0.00699882302f},
-std::array<float,2>{0.556191802f, 0.869354606f},
-std::array<float,2>{0.0691384822f, 0.999952555f},
-std::array<float,2>{0.942094326f, 0.232302636f},
-std::array<float,2>{0.480540603f, 0.442121297f},
-std::array<float,2>{0.58832407f, 0.546269774f},
-std::array<float,2>{0.274935752f, 0.714006603f},
-std::array<float,2>{0.721940517f, 0.324693203f},
-std::array<float,2>{0.158757865f, 0.104112983f},
-std::array<float,2>{0.856901884f, 0.793914974f},
-std::array<float,2>{0.404066682f, 0.832513452f},
-std::array<float,2>{0.501934767f, 0.0454760827f},
-std::array<float,2>{0.0232758597f, 0.300086111f},
-std::array<float,2>{0.908792198f, 0.639134586f},
-std::array<float,2>{0.217417255f, 0.609881401f},
-std::array<float,2>{0.759166598f, 0.379592806f},
-std::array<float,2>{0.369665146f, 0.150517151f},
-std::array<float,2>{0.673849761f, 0.911726177f},
-std::array<float,2>{0.231219605f, 0.925069928f},
-std::array<float,2>{0.797494829f, 0.130149662f},
-std::array<float,2>{0.333897144f, 0.395531088f},
-std::array<float,2>{0.629639447f, 0.596108794f},
-std::array<float,2>{0.422151238f, 0.642578602f},
-std::array<float,2>{0.540798008f, 0.295993f},
-std::array<float,2>{0.052938696f, 0.0578236692f},
-std::array<float,2>{0.901588738f, 0.827306747f},
-std::array<float,2>{0.301100373f, 0.805423856f},
-std::array<float,2>{0.694944084f, 0.118754692f},
-std::array<float,2>{0.152328432f, 0.340467811f},
-std::array<float,2>{0.837213814f, 0.689127266f},
-std::array<float,2>{0.122425713f, 0.548304975f},
-std::array<float,2>{0.992361605f, 0.458593607f},
-std::array<float,2>{0.454355538f, 0.239941895f},
-std::array<float,2>{0.624175251f, 0.983764231f},
-std::array<float,2>{0.00472353306f, 0.846853673f},
-std::array<float,2>{0.929982543f, 0.0289162267f},
-std::array<float,2>{0.376654118f, 0.260831088f},
-std::array<float,2>{0.530656397f, 0.68392086f},
-std::array<float,2>{0.354885668f, 0.567932487f},
-std::array<float,2>{0.668437243f, 0.406740189f},
-std::array<float,2>{0.196521714f, 0.163265944f},
-std::array<float,2>{0.77470994f, 0.881937027f},
-std::array<float,2>{0.486859828f, 0.942930341f},
-std::array<float,2>{0.564886153f, 0.189215705f},
-std::array<float,2>{0.0888786167f, 0.489314586f},
-std::array<float,2>{0.965422153f, 0.500503004f},
-std::array<float,2>{0.184496537f, 0.749440312f},
-std::array<float,2>{0.867549598f, 0.364789456f},
-std::array<float,2>{0.253260523f, 0.0654935241f},
-std::array<float,2>{0.746848702f, 0.761353374f},
-std::array<float,2>{0.191500023f, 0.817737937f},
-std::array<float,2>{0.772123873f, 0.0530400686f},
-std::array<float,2>{0.344926476f, 0.282658517f},
-std::array<float,2>{0.663481236f, 0.653519988f},
-std::array<float,2>{0.38520357f, 0.602120876f},
-std::array<float,2>{0.519219816f, 0.404702544f},
-std::array<float,2>{0.0132701453f, 0.133959994f},
-std::array<float,2>{0.925316632f, 0.930865586f},
-std::array<float,2>{0.262287557f, 0.976249874f},
-std::array<float,2>{0.734579146f, 0.246944293f},
-std::array<float,2>{0.173616156f, 0.467653543f},
-std::array<float,2>{0.867137551f, 0.55749172f},
-std::array<float,2>{0.0830250829f, 0.697537124f},
-std::array<float,2>{0.955182374f, 0.329842359f},
-std::array<float,2>{0.497218192f, 0.111907579f},
-std::array<float,2>{0.574953854f, 0.80108875f},
-std::array<float,2>{0.0560241528f, 0.890458405f},
-std::array<float,2>{0.894528329f, 0.166264638f},
-std::array<float,2>{0.432213694f, 0.416845262f},
-std::array<float,2>{0.535857797f, 0.570718825f},
-std::array<float,2>{0.338141084f, 0.677344084f},
-std::array<float,2>{0.6395154f, 0.255768508f},
-std::array<float,2>{0.222755939f, 0.0184936933f},
-std::array<float,2>{0.805272043f, 0.858578563f},
-std::array<float,2>{0.468059361f, 0.755759835f},
-std::array<float,2>{0.610249043f, 0.0759177878f},
-std::array<float,2>{0.113335252f, 0.369276524f},
-std::array<float,2>{0.991229177f, 0.741153777f},
-std::array<float,2>{0.145319507f, 0.510258913f},
-std::array<float,2>{0.833845139f, 0.492210597f},
-std::array<float,2>{0.309241146f, 0.199249372f},
-std::array<float,2>{0.697345853f, 0.947270751f},
-std::array<float,2>{0.164793774f, 0.967733026f},
-std::array<float,2>{0.848016679f, 0.203189373f},
-std::array<float,2>{0.271050036f, 0.48307386f},
-std::array<float,2>{0.731670737f, 0.521659732f},
-std::array<float,2>{0.475838631f, 0.723122895f},
-std::array<float,2>{0.578651369f, 0.357145965f},
-std::array<float,2>{0.0715388507f, 0.0824983343f},
-std::array<float,2>{0.949480355f, 0.778986394f},
-std::array<float,2>{0.363168299f, 0.864088714f},
-std::array<float,2>{0.682434857f, 0.0095407106f},
-std::array<float,2>{0.205988452f, 0.274855047f},
-std::array<float,2>{0.755236387f, 0.656869948f},
-std::array<float,2>{0.0302641038f, 0.578172088f},
-std::array<float,2>{0.919761658f, 0.435248554f},
-std::array<float,2>{0.393374085f, 0.178305835f},
-std::array<float,2>{0.511726856f, 0.896077216f},
-std::array<float,2>{0.0942328051f, 0.786964357f},
-std::array<float,2>{0.96945101f, 0.100172907f},
-std::array<float,2>{0.44482851f, 0.317808241f},
-std::array<float,2>{0.599372804f, 0.703744471f},
-std::array<float,2>{0.286732465f, 0.538082957f},
-std::array<float,2>{0.717278302f, 0.452835709f},
-std::array<float,2>{0.135014385f, 0.222265258f},
-std::array<float,2>{0.817715168f, 0.984429717f},
-std::array<float,2>{0.415276945f, 0.919666111f},
-std::array<float,2>{0.553186297f, 0.144697443f},
-std::array<float,2>{0.0320969857f, 0.3843458f},
-std::array<float,2>{0.888769805f, 0.624665558f},
-std::array<float,2>{0.238754287f, 0.626475096f},
-std::array<float,2>{0.785424113f, 0.309796512f},
-std::array<float,2>{0.326118767f, 0.0365334302f},
-std::array<float,2>{0.654598713f, 0.839607656f},
-std::array<float,2>{0.226921424f, 0.773738265f},
-std::array<float,2>{0.80215317f, 0.0794277936f},
-std::array<float,2>{0.328336596f, 0.354153872f},
-std::array<float,2>{0.627777994f, 0.720384777f},
-std::array<float,2>{0.426182926f, 0.51871264f},
-std::array<float,2>{0.546707392f, 0.477226138f},
-std::array<float,2>{0.048922468f, 0.209321097f},
-std::array<float,2>{0.903191686f, 0.961516857f},
-std::array<float,2>{0.299129754f, 0.893882871f},
-std::array<float,2>{0.687754512f, 0.173253119f},
-std::array<float,2>{0.152349651f, 0.431571484f},
-std::array<float,2>{0.840701342f, 0.583775878f},
-std::array<float,2>{0.117920443f, 0.663185954f},
-std::array<float,2>{0.996465623f, 0.277688175f},
-std::array<float,2>{0.460651249f, 0.0125951106f},
-std::array<float,2>{0.618346453f, 0.86271584f},
-std::array<float,2>{0.00267322687f, 0.990864635f},
-std::array<float,2>{0.937480152f, 0.225715071f},
-std::array<float,2>{0.380931556f, 0.448268771f},
-std::array<float,2>{0.525303006f, 0.53360939f},
-std::array<float,2>{0.356882662f, 0.707184196f},
-std::array<float,2>{0.665750086f, 0.315084279f},
-std::array<float,2>{0.201641873f, 0.0950794891f},
-std::array<float,2>{0.77912575f, 0.783932328f},
-std::array<float,2>{0.488676161f, 0.843725443f},
-std::array<float,2>{0.569399118f, 0.0348824672f},
-std::array<float,2>{0.0936204046f, 0.308412343f},
-std::array<float,2>{0.964440584f, 0.629376829f},
-std::array<float,2>{0.181873381f, 0.619135916f},
-std::array<float,2>{0.874951065f, 0.388696045f},
-std::array<float,2>{0.254319757f, 0.142109022f},
-std::array<float,2>{0.742411911f, 0.915343881f},
-std::array<float,2>{0.129787296f, 0.934209466f},
-std::array<float,2>{0.822857857f, 0.137223855f},
-std::array<float,2>{0.295993716f, 0.399419397f},
-std::array<float,2>{0.707787931f, 0.608825088f},
-std::array<float,2>{0.44656679f, 0.649498105f},
-std::array<float,2>{0.606752396f, 0.286638528f},
-std::array<float,2>{0.107320473f, 0.0487235859f},
-std::array<float,2>{0.977160275f, 0.81329751f},
-std::array<float,2>{0.320175409f, 0.798629344f},
-std::array<float,2>{0.641183972f, 0.113374241f},
-std::array<float,2>{0.242738202f, 0.33345595f},
-std::array<float,2>{0.792439282f, 0.699559748f},
-std::array<float,2>{0.0444259644f, 0.559360445f},
-std::array<float,2>{0.881998539f, 0.464146972f},
-std::array<float,2>{0.410294741f, 0.243582621f},
-std::array<float,2>{0.562324584f, 0.970916033f},
-std::array<float,2>{0.0659123436f, 0.855150938f},
-std::array<float,2>{0.940092742f, 0.0197188575f},
-std::array<float,2>{0.480393857f, 0.251181394f},
-std::array<float,2>{0.593105614f, 0.674616218f},
-std::array<float,2>{0.277862608f, 0.575136065f},
-std::array<float,2>{0.726397932f, 0.418629259f},
-std::array<float,2>{0.16333805f, 0.170513675f},
-std::array<float,2>{0.85416168f, 0.883562446f},
-std::array<float,2>{0.400096744f, 0.950243115f},
-std::array<float,2>{0.504383445f, 0.198598459f},
-std::array<float,2>{0.0159907974f, 0.498041689f},
-std::array<float,2>{0.911873937f, 0.513224483f},
-std::array<float,2>{0.213225007f, 0.735213578f},
-std::array<float,2>{0.761819243f, 0.374729991f},
-std::array<float,2>{0.372917891f, 0.0719208941f},
-std::array<float,2>{0.67789799f, 0.751159012f},
-std::array<float,2>{0.171435311f, 0.822501361f},
-std::array<float,2>{0.847303927f, 0.0589508787f},
-std::array<float,2>{0.267174512f, 0.291371495f},
-std::array<float,2>{0.726811826f, 0.646141648f},
-std::array<float,2>{0.470747203f, 0.599446356f},
-std::array<float,2>{0.585381329f, 0.394177616f},
-std::array<float,2>{0.0766170695f, 0.127595708f},
-std::array<float,2>{0.947947979f, 0.926700056f},
-std::array<float,2>{0.364889771f, 0.980330408f},
-std::array<float,2>{0.684713483f, 0.235101402f},
-std::array<float,2>{0.207141265f, 0.456949323f},
-std::array<float,2>{0.753354847f, 0.551228583f},
-std::array<float,2>{0.0271684024f, 0.693151355f},
-std::array<float,2>{0.91546756f, 0.338505268f},
-std::array<float,2>{0.396284789f, 0.123455457f},
-std::array<float,2>{0.511621118f, 0.810503364f},
-std::array<float,2>{0.100094862f, 0.875403166f},
-std::array<float,2>{0.973707318f, 0.159807339f},
-std::array<float,2>{0.441170603f, 0.410979301f},
-std::array<float,2>{0.595777512f, 0.563668191f},
-std::array<float,2>{0.282676041f, 0.679874897f},
-std::array<float,2>{0.71184665f, 0.263121516f},
-std::array<float,2>{0.136915714f, 0.0246938914f},
-std::array<float,2>{0.815083563f, 0.851379156f},
-std::array<float,2>{0.418421865f, 0.765089095f},
-std::array<float,2>{0.549841881f, 0.0671800375f},
-std::array<float,2>{0.0380329229f, 0.359854579f},
-std::array<float,2>{0.885373533f, 0.742255867f},
-std::array<float,2>{0.237350136f, 0.505225718f},
-std::array<float,2>{0.783964455f, 0.484844536f},
-std::array<float,2>{0.322579205f, 0.193710819f},
-std::array<float,2>{0.648525715f, 0.937870443f},
-std::array<float,2>{0.190998077f, 0.95916909f},
-std::array<float,2>{0.768690228f, 0.211235106f},
-std::array<float,2>{0.350634962f, 0.472843707f},
-std::array<float,2>{0.659929037f, 0.529055059f},
-std::array<float,2>{0.387971938f, 0.727522612f},
-std::array<float,2>{0.523198843f, 0.346022606f},
-std::array<float,2>{0.00965178106f, 0.0908155814f},
-std::array<float,2>{0.927495182f, 0.772292018f},
-std::array<float,2>{0.261644363f, 0.874927163f},
-std::array<float,2>{0.738764524f, 0.00013548875f},
-std::array<float,2>{0.177322879f, 0.267856121f},
-std::array<float,2>{0.861746132f, 0.671123564f},
-std::array<float,2>{0.0783958882f, 0.587095737f},
-std::array<float,2>{0.959073961f, 0.426904976f},
-std::array<float,2>{0.495579273f, 0.185022786f},
-std::array<float,2>{0.570490599f, 0.90498513f},
-std::array<float,2>{0.0608751439f, 0.792865515f},
-std::array<float,2>{0.895130694f, 0.106558092f},
-std::array<float,2>{0.436234593f, 0.32069549f},
-std::array<float,2>{0.53277874f, 0.717018485f},
-std::array<float,2>{0.341956973f, 0.540573418f},
-std::array<float,2>{0.633986056f, 0.441083997f},
-std::array<float,2>{0.221362799f, 0.228443444f},
-std::array<float,2>{0.812259555f, 0.993642747f},
-std::array<float,2>{0.46372056f, 0.906765878f},
-std::array<float,2>{0.616806328f, 0.155404985f},
-std::array<float,2>{0.109406255f, 0.375422835f},
-std::array<float,2>{0.987301767f, 0.615952194f},
-std::array<float,2>{0.14241536f, 0.633225083f},
-std::array<float,2>{0.829961777f, 0.302575976f},
-std::array<float,2>{0.307069957f, 0.0405664593f},
-std::array<float,2>{0.700789332f, 0.829194844f},
-std::array<float,2>{0.151296481f, 0.806711972f},
-std::array<float,2>{0.836544037f, 0.119911596f},
-std::array<float,2>{0.301981628f, 0.34326297f},
-std::array<float,2>{0.694163442f, 0.690470636f},
-std::array<float,2>{0.453866065f, 0.549338937f},
-std::array<float,2>{0.623283923f, 0.459358186f},
-std::array<float,2>{0.121244214f, 0.241898209f},
-std::array<float,2>{0.993616998f, 0.981497765f},
-std::array<float,2>{0.332355887f, 0.923209071f},
-std::array<float,2>{0.629930854f, 0.132787883f},
-std::array<float,2>{0.232024163f, 0.396883845f},
-std::array<float,2>{0.797978938f, 0.595063567f},
-std::array<float,2>{0.0537733771f, 0.641923189f},
-std::array<float,2>{0.90136528f, 0.294829011f},
-std::array<float,2>{0.423772246f, 0.0549989827f},
-std::array<float,2>{0.539124012f, 0.826111376f},
-std::array<float,2>{0.0879335999f, 0.944202065f},
-std::array<float,2>{0.965952754f, 0.191001892f},
-std::array<float,2>{0.487860978f, 0.49036473f},
-std::array<float,2>{0.565941989f, 0.502239227f},
-std::array<float,2>{0.252646595f, 0.747174501f},
-std::array<float,2>{0.747516453f, 0.367013007f},
-std::array<float,2>{0.184645951f, 0.0641362965f},
-std::array<float,2>{0.868272781f, 0.759065509f},
-std::array<float,2>{0.375682563f, 0.844674826f},
-std::array<float,2>{0.529549778f, 0.0309376642f},
-std::array<float,2>{0.00496385107f, 0.258793473f},
-std::array<float,2>{0.930748165f, 0.686312497f},
-std::array<float,2>{0.195338875f, 0.569941521f},
-std::array<float,2>{0.773907423f, 0.409281254f},
-std::array<float,2>{0.354341447f, 0.160553291f},
-std::array<float,2>{0.669140041f, 0.879123449f},
-std::array<float,2>{0.247938156f, 0.899462581f},
-std::array<float,2>{0.794922948f, 0.181248143f},
-std::array<float,2>{0.314489782f, 0.424008816f},
-std::array<float,2>{0.647515416f, 0.593160152f},
-std::array<float,2>{0.406599075f, 0.665654123f},
-std::array<float,2>{0.555219889f, 0.272753686f},
-std::array<float,2>{0.0399325825f, 0.0044292747f},
-std::array<float,2>{0.876151502f, 0.868760288f},
-std::array<float,2>{0.289905727f, 0.768610418f},
-std::array<float,2>{0.70569557f, 0.087644957f},
-std::array<float,2>{0.127201796f, 0.348688215f},
-std::array<float,2>{0.824539781f, 0.732533753f},
-std::array<float,2>{0.103786334f, 0.524710238f},
-std::array<float,2>{0.981235862f, 0.469582915f},
-std::array<float,2>{0.452248514f, 0.216661945f},
-std::array<float,2>{0.603845179f, 0.953378856f},
-std::array<float,2>{0.0215924866f, 0.834618688f},
-std::array<float,2>{0.909824073f, 0.0447886586f},
-std::array<float,2>{0.40245688f, 0.297950655f},
-std::array<float,2>{0.50033617f, 0.638089597f},
-std::array<float,2>{0.370571256f, 0.612068117f},
-std::array<float,2>{0.675129533f, 0.382007778f},
-std::array<float,2>{0.217776209f, 0.150300682f},
-std::array<float,2>{0.758272111f, 0.913956702f},
-std::array<float,2>{0.482055992f, 0.997664332f},
-std::array<float,2>{0.588886201f, 0.23359026f},
-std::array<float,2>{0.06964349f, 0.445068866f},
-std::array<float,2>{0.942592919f, 0.543756723f},
-std::array<float,2>{0.159584001f, 0.712341189f},
-std::array<float,2>{0.855777323f, 0.327688992f},
-std::array<float,2>{0.274146974f, 0.103310212f},
-std::array<float,2>{0.7213099f, 0.795966506f},
-std::array<float,2>{0.206497252f, 0.866164982f},
-std::array<float,2>{0.754104435f, 0.0106969634f},
-std::array<float,2>{0.362278044f, 0.276598424f},
-std::array<float,2>{0.683059216f, 0.658280551f},
-std::array<float,2>{0.393981069f, 0.581995368f},
-std::array<float,2>{0.513648272f, 0.435577899f},
-std::array<float,2>{0.0311623774f, 0.176134855f},
-std::array<float,2>{0.918562531f, 0.898384452f},
-std::array<float,2>{0.269975215f, 0.96650362f},
-std::array<float,2>{0.730900347f, 0.206832439f},
-std::array<float,2>{0.165111661f, 0.481008947f},
-std::array<float,2>{0.84918189f, 0.52082634f},
-std::array<float,2>{0.0706841201f, 0.725534618f},
-std::array<float,2>{0.950415611f, 0.358711869f},
-std::array<float,2>{0.474744707f, 0.0858460292f},
-std::array<float,2>{0.579635203f, 0.779542565f},
-std::array<float,2>{0.0330169611f, 0.920551956f},
-std::array<float,2>{0.890475273f, 0.147113085f},
-std::array<float,2>{0.414104313f, 0.385232657f},
-std::array<float,2>{0.554660261f, 0.6219455f},
-std::array<float,2>{0.3243801f, 0.628492057f},
-std::array<float,2>{0.65585202f, 0.311453193f},
-std::array<float,2>{0.239723876f, 0.0384757221f},
-std::array<float,2>{0.787068546f, 0.837106168f},
-std::array<float,2>{0.443498105f, 0.787473559f},
-std::array<float,2>{0.598001122f, 0.0980720073f},
-std::array<float,2>{0.095355764f, 0.3189888f},
-std::array<float,2>{0.969909191f, 0.705100656f},
-std::array<float,2>{0.136460036f, 0.535893798f},
-std::array<float,2>{0.817163467f, 0.450591147f},
-std::array<float,2>{0.285238773f, 0.219830811f},
-std::array<float,2>{0.717985332f, 0.987542391f},
-std::array<float,2>{0.172638461f, 0.973765433f},
-std::array<float,2>{0.865641594f, 0.248649642f},
-std::array<float,2>{0.263076186f, 0.466076076f},
-std::array<float,2>{0.736045241f, 0.555319846f},
-std::array<float,2>{0.496197283f, 0.696580887f},
-std::array<float,2>{0.57530123f, 0.331383854f},
-std::array<float,2>{0.0822399259f, 0.109995916f},
-std::array<float,2>{0.95642978f, 0.804632425f},
-std::array<float,2>{0.34381026f, 0.81989181f},
-std::array<float,2>{0.662511349f, 0.0525974408f},
-std::array<float,2>{0.192755461f, 0.28489086f},
-std::array<float,2>{0.772976577f, 0.655510545f},
-std::array<float,2>{0.0119695161f, 0.604104698f},
-std::array<float,2>{0.924652874f, 0.403470129f},
-std::array<float,2>{0.386681736f, 0.135940805f},
-std::array<float,2>{0.51759094f, 0.932291806f},
-std::array<float,2>{0.114561692f, 0.756928682f},
-std::array<float,2>{0.990297377f, 0.0775555372f},
-std::array<float,2>{0.467298329f, 0.368475139f},
-std::array<float,2>{0.610537112f, 0.739992321f},
-std::array<float,2>{0.310375959f, 0.507819891f},
-std::array<float,2>{0.698814213f, 0.494459987f},
-std::array<float,2>{0.146329612f, 0.201504841f},
-std::array<float,2>{0.83237952f, 0.946319401f},
-std::array<float,2>{0.432763517f, 0.887317181f},
-std::array<float,2>{0.536576927f, 0.165373102f},
-std::array<float,2>{0.0553473309f, 0.414274156f},
-std::array<float,2>{0.892644346f, 0.574082136f},
-std::array<float,2>{0.223718852f, 0.679155469f},
-std::array<float,2>{0.806542516f, 0.257506996f},
-std::array<float,2>{0.339203149f, 0.0167732183f},
-std::array<float,2>{0.639893889f, 0.855994999f},
-std::array<float,2>{0.200095877f, 0.782538354f},
-std::array<float,2>{0.779821217f, 0.0974013731f},
-std::array<float,2>{0.358983487f, 0.31368655f},
-std::array<float,2>{0.667130053f, 0.709512353f},
-std::array<float,2>{0.379781127f, 0.532712281f},
-std::array<float,2>{0.527108371f, 0.447201461f},
-std::array<float,2>{0.0012347782f, 0.223780796f},
-std::array<float,2>{0.93461585f, 0.988597035f},
-std::array<float,2>{0.257072181f, 0.916582286f},
-std::array<float,2>{0.744219601f, 0.142714784f},
-std::array<float,2>{0.180832863f, 0.387116879f},
-std::array<float,2>{0.872892559f, 0.619850636f},
-std::array<float,2>{0.0911769643f, 0.631415367f},
-std::array<float,2>{0.962286234f, 0.305633157f},
-std::array<float,2>{0.490341723f, 0.0321438573f},
-std::array<float,2>{0.568126917f, 0.840831101f},
-std::array<float,2>{0.0471581481f, 0.963493466f},
-std::array<float,2>{0.906088889f, 0.20895566f},
-std::array<float,2>{0.429022014f, 0.480363876f},
-std::array<float,2>{0.543357015f, 0.517097354f},
-std::array<float,2>{0.330760717f, 0.721489668f},
-std::array<float,2>{0.62548697f, 0.351751536f},
-std::array<float,2>{0.229110196f, 0.081333138f},
-std::array<float,2>{0.804497778f, 0.777263463f},
-std::array<float,2>{0.458391458f, 0.86058861f},
-std::array<float,2>{0.619852066f, 0.0141315144f},
-std::array<float,2>{0.12021827f, 0.280561298f},
-std::array<float,2>{0.999830484f, 0.661256433f},
-std::array<float,2>{0.154753417f, 0.585719168f},
-std::array<float,2>{0.843320727f, 0.432794839f},
-std::array<float,2>{0.296921581f, 0.174304917f},
-std::array<float,2>{0.691220045f, 0.892290771f},
-std::array<float,2>{0.161172181f, 0.886565328f},
-std::array<float,2>{0.85266906f, 0.168680057f},
-std::array<float,2>{0.28106162f, 0.421507329f},
-std::array<float,2>{0.723617256f, 0.576622725f},
-std::array<float,2>{0.477829576f, 0.673343182f},
-std::array<float,2>{0.591477871f, 0.252202511f},
-std::array<float,2>{0.0640230104f, 0.0225349385f},
-std::array<float,2>{0.937627316f, 0.852544427f},
-std::array<float,2>{0.374515831f, 0.752572358f},
-std::array<float,2>{0.677274764f, 0.0734006166f},
-std::array<float,2>{0.211040542f, 0.372451156f},
-std::array<float,2>{0.7649405f, 0.737563014f},
-std::array<float,2>{0.017745031f, 0.515342295f},
-std::array<float,2>{0.914050817f, 0.49819386f},
-std::array<float,2>{0.40163219f, 0.195392042f},
-std::array<float,2>{0.506439209f, 0.951666653f},
-std::array<float,2>{0.108636141f, 0.816099107f},
-std::array<float,2>{0.980266631f, 0.0489289425f},
-std::array<float,2>{0.448642969f, 0.287737161f},
-std::array<float,2>{0.607828021f, 0.650475562f},
-std::array<float,2>{0.29380849f, 0.606817067f},
-std::array<float,2>{0.710553408f, 0.400535077f},
-std::array<float,2>{0.131449208f, 0.1388385f},
-std::array<float,2>{0.820883036f, 0.935837865f},
-std::array<float,2>{0.412981182f, 0.970548689f},
-std::array<float,2>{0.560372233f, 0.245218694f},
-std::array<float,2>{0.0454684682f, 0.461069912f},
-std::array<float,2>{0.879588306f, 0.561982691f},
-std::array<float,2>{0.244195893f, 0.702476084f},
-std::array<float,2>{0.790051281f, 0.335108995f},
-std::array<float,2>{0.318186462f, 0.116665512f},
-std::array<float,2>{0.644509315f, 0.80037117f},
-std::array<float,2>{0.140336856f, 0.848856628f},
-std::array<float,2>{0.813821137f, 0.0272203591f},
-std::array<float,2>{0.28380543f, 0.264827371f},
-std::array<float,2>{0.714303374f, 0.68275547f},
-std::array<float,2>{0.437651187f, 0.565721512f},
-std::array<float,2>{0.593976378f, 0.413101673f},
-std::array<float,2>{0.0991858318f, 0.156947672f},
-std::array<float,2>{0.975239098f, 0.878076553f},
-std::array<float,2>{0.32146737f, 0.94110471f},
-std::array<float,2>{0.650674343f, 0.192381814f},
-std::array<float,2>{0.234865755f, 0.487690806f},
-std::array<float,2>{0.781423628f, 0.506334662f},
-std::array<float,2>{0.0360644422f, 0.744938254f},
-std::array<float,2>{0.882906079f, 0.361491531f},
-std::array<float,2>{0.421078622f, 0.0699884966f},
-std::array<float,2>{0.547625482f, 0.763440371f},
-std::array<float,2>{0.0756263211f, 0.927906513f},
-std::array<float,2>{0.946675122f, 0.125425652f},
-std::array<float,2>{0.470552921f, 0.392521322f},
-std::array<float,2>{0.583333194f, 0.601065993f},
-std::array<float,2>{0.269146323f, 0.64752996f},
-std::array<float,2>{0.729565918f, 0.290415406f},
-std::array<float,2>{0.168733791f, 0.0607842356f},
-std::array<float,2>{0.844604969f, 0.821845174f},
-std::array<float,2>{0.397507668f, 0.811080635f},
-std::array<float,2>{0.509651303f, 0.121658668f},
-std::array<float,2>{0.0245447177f, 0.337276816f},
-std::array<float,2>{0.917794287f, 0.694908261f},
-std::array<float,2>{0.210000396f, 0.554386079f},
-std::array<float,2>{0.750730336f, 0.454689294f},
-std::array<float,2>{0.365805f, 0.237340316f},
-std::array<float,2>{0.686787128f, 0.978151441f},
-std::array<float,2>{0.218792379f, 0.994646609f},
-std::array<float,2>{0.808671415f, 0.230124578f},
-std::array<float,2>{0.340004176f, 0.437521964f},
-std::array<float,2>{0.634830832f, 0.542413473f},
-std::array<float,2>{0.4344109f, 0.715640128f},
-std::array<float,2>{0.534223437f, 0.322693795f},
-std::array<float,2>{0.0592074618f, 0.108700775f},
-std::array<float,2>{0.897114933f, 0.78966558f},
-std::array<float,2>{0.304882258f, 0.83072412f},
-std::array<float,2>{0.702794552f, 0.0414834805f},
-std::array<float,2>{0.142685995f, 0.30459246f},
-std::array<float,2>{0.831694305f, 0.634855449f},
-std::array<float,2>{0.1118543f, 0.614131749f},
-std::array<float,2>{0.984432042f, 0.378210574f},
-std::array<float,2>{0.462391317f, 0.152711958f},
-std::array<float,2>{0.61346662f, 0.909396768f},
-std::array<float,2>{0.0100118611f, 0.769934952f},
-std::array<float,2>{0.929613829f, 0.0933989659f},
-std::array<float,2>{0.38987416f, 0.344477445f},
-std::array<float,2>{0.52097857f, 0.728859544f},
-std::array<float,2>{0.347877234f, 0.529929757f},
-std::array<float,2>{0.657280564f, 0.475411385f},
-std::array<float,2>{0.188787594f, 0.213288158f},
-std::array<float,2>{0.765747011f, 0.958034933f},
-std::array<float,2>{0.493736953f, 0.903413057f},
-std::array<float,2>{0.572761297f, 0.187400788f},
-std::array<float,2>{0.0814540535f, 0.428539395f},
-std::array<float,2>{0.957361758f, 0.588543534f},
-std::array<float,2>{0.17780143f, 0.669172108f},
-std::array<float,2>{0.861258686f, 0.266626358f},
-std::array<float,2>{0.259685278f, 0.00206288649f},
-std::array<float,2>{0.741350174f, 0.87153697f},
-std::array<float,2>{0.186018273f, 0.760523915f},
-std::array<float,2>{0.87107861f, 0.0646928772f},
-std::array<float,2>{0.251474977f, 0.364125252f},
-std::array<float,2>{0.749563277f, 0.749022782f},
-std::array<float,2>{0.485773355f, 0.501458466f},
-std::array<float,2>{0.562898815f, 0.48861751f},
-std::array<float,2>{0.0866465345f, 0.188441247f},
-std::array<float,2>{0.968071461f, 0.941522896f},
-std::array<float,2>{0.353108734f, 0.88119477f},
-std::array<float,2>{0.670829296f, 0.162584066f},
-std::array<float,2>{0.198568121f, 0.407319784f},
-std::array<float,2>{0.777036071f, 0.567213774f},
-std::array<float,2>{0.00684287027f, 0.68509239f},
-std::array<float,2>{0.93328321f, 0.259805739f},
-std::array<float,2>{0.377979577f, 0.0282861516f},
-std::array<float,2>{0.52909565f, 0.846026599f},
-std::array<float,2>{0.124417126f, 0.982812405f},
-std::array<float,2>{0.99537158f, 0.238449648f},
-std::array<float,2>{0.455704749f, 0.457662851f},
-std::array<float,2>{0.622139692f, 0.547373533f},
-std::array<float,2>{0.302946568f, 0.687897861f},
-std::array<float,2>{0.691829801f, 0.341598988f},
-std::array<float,2>{0.150300592f, 0.117200918f},
-std::array<float,2>{0.838216305f, 0.806253135f},
-std::array<float,2>{0.424496591f, 0.826670885f},
-std::array<float,2>{0.541594207f, 0.0568999983f},
-std::array<float,2>{0.0509018525f, 0.295603663f},
-std::array<float,2>{0.899935722f, 0.643694818f},
-std::array<float,2>{0.233388677f, 0.597473025f},
-std::array<float,2>{0.799287856f, 0.395380765f},
-std::array<float,2>{0.335579008f, 0.129562929f},
-std::array<float,2>{0.632249415f, 0.923991263f},
-std::array<float,2>{0.215331897f, 0.910420001f},
-std::array<float,2>{0.760379732f, 0.151419893f},
-std::array<float,2>{0.368548453f, 0.380410761f},
-std::array<float,2>{0.672000587f, 0.610940874f},
-std::array<float,2>{0.404495448f, 0.640096068f},
-std::array<float,2>{0.502198517f, 0.299575508f},
-std::array<float,2>{0.021365907f, 0.0467795245f},
-std::array<float,2>{0.908039629f, 0.833399892f},
-std::array<float,2>{0.276671916f, 0.794120073f},
-std::array<float,2>{0.719416678f, 0.104804084f},
-std::array<float,2>{0.156613052f, 0.325600922f},
-std::array<float,2>{0.859259486f, 0.713699758f},
-std::array<float,2>{0.0671945587f, 0.545391142f},
-std::array<float,2>{0.944806397f, 0.442750424f},
-std::array<float,2>{0.482830405f, 0.231423229f},
-std::array<float,2>{0.587449312f, 0.998103261f},
-std::array<float,2>{0.0411055237f, 0.870895863f},
-std::array<float,2>{0.878427863f, 0.00638910523f},
-std::array<float,2>{0.408908635f, 0.269646823f},
-std::array<float,2>{0.557534695f, 0.66636771f},
-std::array<float,2>{0.313668489f, 0.590985775f},
-std::array<float,2>{0.645901144f, 0.422612518f},
-std::array<float,2>{0.248979613f, 0.183486193f},
-std::array<float,2>{0.794763565f, 0.901899517f},
-std::array<float,2>{0.450443476f, 0.95549953f},
-std::array<float,2>{0.602887213f, 0.217390791f},
-std::array<float,2>{0.102533385f, 0.471580297f},
-std::array<float,2>{0.98335886f, 0.526933134f},
-std::array<float,2>{0.126298666f, 0.732409954f},
-std::array<float,2>{0.82623893f, 0.351170719f},
-std::array<float,2>{0.292316228f, 0.0888400376f},
-std::array<float,2>{0.704076171f, 0.765871644f},
-std::array<float,2>{0.241137952f, 0.838446915f},
-std::array<float,2>{0.788054347f, 0.0353231952f},
-std::array<float,2>{0.327936321f, 0.308843225f},
-std::array<float,2>{0.652893245f, 0.625802159f},
-std::array<float,2>{0.416935563f, 0.623139679f},
-std::array<float,2>{0.551751137f, 0.383549511f},
-std::array<float,2>{0.0345788971f, 0.145677269f},
-std::array<float,2>{0.887821615f, 0.918556094f},
-std::array<float,2>{0.288305193f, 0.986217916f},
-std::array<float,2>{0.716700256f, 0.221111685f},
-std::array<float,2>{0.133160099f, 0.451431692f},
-std::array<float,2>{0.818996847f, 0.538284063f},
-std::array<float,2>{0.0964739248f, 0.704923451f},
-std::array<float,2>{0.972591519f, 0.316685319f},
-std::array<float,2>{0.443282694f, 0.100871496f},
-std::array<float,2>{0.601405919f, 0.785479724f},
-std::array<float,2>{0.0279614944f, 0.89515835f},
-std::array<float,2>{0.92099601f, 0.178998128f},
-std::array<float,2>{0.390841365f, 0.43367222f},
-std::array<float,2>{0.515233755f, 0.579183519f},
-std::array<float,2>{0.359434366f, 0.657361269f},
-std::array<float,2>{0.679995179f, 0.273893416f},
-std::array<float,2>{0.203854695f, 0.00861659553f},
-std::array<float,2>{0.757280529f, 0.864947021f},
-std::array<float,2>{0.474300265f, 0.777789593f},
-std::array<float,2>{0.581641674f, 0.0834657401f},
-std::array<float,2>{0.0740929991f, 0.355793953f},
-std::array<float,2>{0.952871263f, 0.724424422f},
-std::array<float,2>{0.16748552f, 0.523079991f},
-std::array<float,2>{0.850268245f, 0.483858913f},
-std::array<float,2>{0.271613032f, 0.204618096f},
-std::array<float,2>{0.732841611f, 0.968556523f},
-std::array<float,2>{0.148223221f, 0.948650062f},
-std::array<float,2>{0.834103823f, 0.20027706f},
-std::array<float,2>{0.310951173f, 0.493632555f},
-std::array<float,2>{0.696587861f, 0.511447668f},
-std::array<float,2>{0.465108722f, 0.741641164f},
-std::array<float,2>{0.612293005f, 0.370643616f},
-std::array<float,2>{0.116868898f, 0.0744920969f},
-std::array<float,2>{0.988415837f, 0.75412786f},
-std::array<float,2>{0.337640107f, 0.858346641f},
-std::array<float,2>{0.637676895f, 0.019342795f},
-std::array<float,2>{0.224986479f, 0.254321575f},
-std::array<float,2>{0.807502568f, 0.676402688f},
-std::array<float,2>{0.0583410487f, 0.571778834f},
-std::array<float,2>{0.891183138f, 0.41704917f},
-std::array<float,2>{0.4301036f, 0.16753909f},
-std::array<float,2>{0.53813225f, 0.889016867f},
-std::array<float,2>{0.085472025f, 0.801825106f},
-std::array<float,2>{0.953373671f, 0.112473644f},
-std::array<float,2>{0.499390483f, 0.32827431f},
-std::array<float,2>{0.577961802f, 0.698691308f},
-std::array<float,2>{0.264156491f, 0.55787909f},
-std::array<float,2>{0.736346304f, 0.467793524f},
-std::array<float,2>{0.174084082f, 0.247402042f},
-std::array<float,2>{0.863802314f, 0.975110948f},
-std::array<float,2>{0.384119093f, 0.929870903f},
-std::array<float,2>{0.516291797f, 0.133179545f},
-std::array<float,2>{0.0148163568f, 0.40572381f},
-std::array<float,2>{0.922922373f, 0.603038311f},
-std::array<float,2>{0.19497472f, 0.653150022f},
-std::array<float,2>{0.770827949f, 0.281853944f},
-std::array<float,2>{0.347512305f, 0.0539544113f},
-std::array<float,2>{0.661588132f, 0.817019582f}}
\ No newline at end of file
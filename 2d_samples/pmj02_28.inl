@@ -1,4096 +0,0 @@
-{std::array<float,2>{0.903210461f, 0.0809442475f},
-std::array<float,2>{0.382817358f, 0.917670667f},
-std::array<float,2>{0.127258837f, 0.301856041f},
-std::array<float,2>{0.593206108f, 0.697766542f},
-std::array<float,2>{0.737318099f, 0.410464346f},
-std::array<float,2>{0.0130631188f, 0.584160745f},
-std::array<float,2>{0.371056378f, 0.219912484f},
-std::array<float,2>{0.777066827f, 0.828585625f},
-std::array<float,2>{0.871714234f, 0.33032915f},
-std::array<float,2>{0.273822159f, 0.669630647f},
-std::array<float,2>{0.0770351887f, 0.0172650013f},
-std::array<float,2>{0.682781219f, 0.991325319f},
-std::array<float,2>{0.560876071f, 0.156508282f},
-std::array<float,2>{0.210372627f, 0.754251063f},
-std::array<float,2>{0.488970339f, 0.484489471f},
-std::array<float,2>{0.946923554f, 0.501613915f},
-std::array<float,2>{0.789115191f, 0.217474684f},
-std::array<float,2>{0.329148114f, 0.869420469f},
-std::array<float,2>{0.0621995628f, 0.385016322f},
-std::array<float,2>{0.711270034f, 0.604516983f},
-std::array<float,2>{0.614520729f, 0.275129408f},
-std::array<float,2>{0.164729476f, 0.720444024f},
-std::array<float,2>{0.433684468f, 0.110608853f},
-std::array<float,2>{0.913920164f, 0.895156026f},
-std::array<float,2>{0.994452238f, 0.459676296f},
-std::array<float,2>{0.452187866f, 0.550851524f},
-std::array<float,2>{0.227796257f, 0.130051389f},
-std::array<float,2>{0.529303312f, 0.796427488f},
-std::array<float,2>{0.654640853f, 0.0442705899f},
-std::array<float,2>{0.0956482068f, 0.959993124f},
-std::array<float,2>{0.290714055f, 0.363454908f},
-std::array<float,2>{0.835419834f, 0.636403561f},
-std::array<float,2>{0.817554235f, 0.00562317623f},
-std::array<float,2>{0.300249606f, 0.97513926f},
-std::array<float,2>{0.113418534f, 0.312723666f},
-std::array<float,2>{0.639722109f, 0.684461892f},
-std::array<float,2>{0.511876404f, 0.475816101f},
-std::array<float,2>{0.236739144f, 0.523757815f},
-std::array<float,2>{0.462833226f, 0.177920356f},
-std::array<float,2>{0.975510716f, 0.78064549f},
-std::array<float,2>{0.932651699f, 0.285269082f},
-std::array<float,2>{0.41244173f, 0.709976494f},
-std::array<float,2>{0.175146386f, 0.0776552781f},
-std::array<float,2>{0.602335274f, 0.928588808f},
-std::array<float,2>{0.701077461f, 0.24587135f},
-std::array<float,2>{0.0409723073f, 0.825977564f},
-std::array<float,2>{0.322494f, 0.430012882f},
-std::array<float,2>{0.796892047f, 0.577366233f},
-std::array<float,2>{0.966587245f, 0.144435003f},
-std::array<float,2>{0.478804648f, 0.801905096f},
-std::array<float,2>{0.193112403f, 0.447429955f},
-std::array<float,2>{0.538057685f, 0.545678794f},
-std::array<float,2>{0.65858686f, 0.348477274f},
-std::array<float,2>{0.0898354873f, 0.647622168f},
-std::array<float,2>{0.25886929f, 0.0589043945f},
-std::array<float,2>{0.858910799f, 0.946275949f},
-std::array<float,2>{0.757884145f, 0.401767671f},
-std::array<float,2>{0.350265473f, 0.619588017f},
-std::array<float,2>{0.0236973651f, 0.18897377f},
-std::array<float,2>{0.724125385f, 0.848842561f},
-std::array<float,2>{0.570800066f, 0.104959853f},
-std::array<float,2>{0.146945238f, 0.888152063f},
-std::array<float,2>{0.400022477f, 0.252770007f},
-std::array<float,2>{0.885588706f, 0.738156259f},
-std::array<float,2>{0.978762031f, 0.0477722995f},
-std::array<float,2>{0.456939191f, 0.938244879f},
-std::array<float,2>{0.245589018f, 0.351893961f},
-std::array<float,2>{0.501666427f, 0.649683595f},
-std::array<float,2>{0.627930284f, 0.440577954f},
-std::array<float,2>{0.119378842f, 0.536359131f},
-std::array<float,2>{0.305451959f, 0.149220094f},
-std::array<float,2>{0.82577306f, 0.808542967f},
-std::array<float,2>{0.810605645f, 0.264272392f},
-std::array<float,2>{0.316794068f, 0.743621469f},
-std::array<float,2>{0.0328930505f, 0.0964770764f},
-std::array<float,2>{0.692414463f, 0.881773591f},
-std::array<float,2>{0.596112072f, 0.198246673f},
-std::array<float,2>{0.185646489f, 0.854761481f},
-std::array<float,2>{0.418321013f, 0.394033819f},
-std::array<float,2>{0.926141858f, 0.615501404f},
-std::array<float,2>{0.850494027f, 0.182313979f},
-std::array<float,2>{0.253104597f, 0.771469712f},
-std::array<float,2>{0.0786144584f, 0.48146522f},
-std::array<float,2>{0.669037879f, 0.518027842f},
-std::array<float,2>{0.542420089f, 0.322933048f},
-std::array<float,2>{0.201463059f, 0.673204005f},
-std::array<float,2>{0.471488029f, 0.00835854374f},
-std::array<float,2>{0.956561029f, 0.984187782f},
-std::array<float,2>{0.8797791f, 0.428671181f},
-std::array<float,2>{0.394744724f, 0.567430973f},
-std::array<float,2>{0.148970291f, 0.23599498f},
-std::array<float,2>{0.562990248f, 0.815583169f},
-std::array<float,2>{0.734175086f, 0.0698248595f},
-std::array<float,2>{0.0218820367f, 0.934112012f},
-std::array<float,2>{0.354981214f, 0.296603501f},
-std::array<float,2>{0.754022598f, 0.715660453f},
-std::array<float,2>{0.769559979f, 0.119300239f},
-std::array<float,2>{0.359688729f, 0.905424178f},
-std::array<float,2>{0.00582890585f, 0.273137301f},
-std::array<float,2>{0.746275902f, 0.730251312f},
-std::array<float,2>{0.585630059f, 0.382623553f},
-std::array<float,2>{0.137790486f, 0.598460853f},
-std::array<float,2>{0.376186758f, 0.209411323f},
-std::array<float,2>{0.896622121f, 0.862287045f},
-std::array<float,2>{0.9391976f, 0.372976571f},
-std::array<float,2>{0.493676186f, 0.628190696f},
-std::array<float,2>{0.217230752f, 0.0390492231f},
-std::array<float,2>{0.553246319f, 0.96634537f},
-std::array<float,2>{0.678278089f, 0.133375242f},
-std::array<float,2>{0.0648377314f, 0.787118733f},
-std::array<float,2>{0.267773598f, 0.465716124f},
-std::array<float,2>{0.866439283f, 0.556644678f},
-std::array<float,2>{0.916655183f, 0.231676623f},
-std::array<float,2>{0.422364146f, 0.837177157f},
-std::array<float,2>{0.162210137f, 0.414224386f},
-std::array<float,2>{0.618587315f, 0.591455519f},
-std::array<float,2>{0.709486246f, 0.306515962f},
-std::array<float,2>{0.0483462363f, 0.691386044f},
-std::array<float,2>{0.336946934f, 0.0913292021f},
-std::array<float,2>{0.78620708f, 0.90867871f},
-std::array<float,2>{0.839924037f, 0.498862416f},
-std::array<float,2>{0.285450608f, 0.511921048f},
-std::array<float,2>{0.107128665f, 0.16943191f},
-std::array<float,2>{0.646209836f, 0.762184143f},
-std::array<float,2>{0.520770133f, 0.0262377486f},
-std::array<float,2>{0.223009005f, 0.994809031f},
-std::array<float,2>{0.442090601f, 0.341495454f},
-std::array<float,2>{0.989311993f, 0.660570085f},
-std::array<float,2>{0.925317228f, 0.0230572391f},
-std::array<float,2>{0.414242119f, 0.985225558f},
-std::array<float,2>{0.180924684f, 0.334051937f},
-std::array<float,2>{0.598436356f, 0.664354801f},
-std::array<float,2>{0.688580453f, 0.49185431f},
-std::array<float,2>{0.0352271125f, 0.506771982f},
-std::array<float,2>{0.315027863f, 0.161701381f},
-std::array<float,2>{0.804853737f, 0.752951443f},
-std::array<float,2>{0.820910931f, 0.297153682f},
-std::array<float,2>{0.308816731f, 0.701447129f},
-std::array<float,2>{0.123659894f, 0.0839291662f},
-std::array<float,2>{0.630865932f, 0.920147777f},
-std::array<float,2>{0.50714922f, 0.225691438f},
-std::array<float,2>{0.246386379f, 0.83213824f},
-std::array<float,2>{0.459547043f, 0.408320516f},
-std::array<float,2>{0.98396498f, 0.579969168f},
-std::array<float,2>{0.751202881f, 0.128374934f},
-std::array<float,2>{0.357891142f, 0.791778743f},
-std::array<float,2>{0.0184723418f, 0.453795284f},
-std::array<float,2>{0.72813046f, 0.547893822f},
-std::array<float,2>{0.569004536f, 0.361918181f},
-std::array<float,2>{0.153627545f, 0.639287829f},
-std::array<float,2>{0.391072005f, 0.0410169475f},
-std::array<float,2>{0.87809217f, 0.955596566f},
-std::array<float,2>{0.960717857f, 0.388032347f},
-std::array<float,2>{0.476424038f, 0.605675399f},
-std::array<float,2>{0.196473733f, 0.213522077f},
-std::array<float,2>{0.546007574f, 0.872259557f},
-std::array<float,2>{0.666775644f, 0.114424527f},
-std::array<float,2>{0.0837768689f, 0.891234696f},
-std::array<float,2>{0.25775069f, 0.279148996f},
-std::array<float,2>{0.846136093f, 0.725917757f},
-std::array<float,2>{0.861671448f, 0.0734665096f},
-std::array<float,2>{0.27298063f, 0.923387229f},
-std::array<float,2>{0.0689249933f, 0.283672482f},
-std::array<float,2>{0.674739301f, 0.706480563f},
-std::array<float,2>{0.549196422f, 0.433968723f},
-std::array<float,2>{0.212409407f, 0.573674023f},
-std::array<float,2>{0.498960584f, 0.248742417f},
-std::array<float,2>{0.943082213f, 0.820822954f},
-std::array<float,2>{0.89225173f, 0.319803774f},
-std::array<float,2>{0.379226953f, 0.683357894f},
-std::array<float,2>{0.135903388f, 0.000983592821f},
-std::array<float,2>{0.578266203f, 0.971900582f},
-std::array<float,2>{0.744419515f, 0.173231393f},
-std::array<float,2>{0.00255649351f, 0.775853336f},
-std::array<float,2>{0.367057055f, 0.471280277f},
-std::array<float,2>{0.769492447f, 0.528725684f},
-std::array<float,2>{0.985734046f, 0.192829311f},
-std::array<float,2>{0.439290106f, 0.845238507f},
-std::array<float,2>{0.218917161f, 0.405733615f},
-std::array<float,2>{0.519521356f, 0.623468697f},
-std::array<float,2>{0.642224371f, 0.257508129f},
-std::array<float,2>{0.102706335f, 0.739677072f},
-std::array<float,2>{0.282281816f, 0.107819788f},
-std::array<float,2>{0.837103188f, 0.885969639f},
-std::array<float,2>{0.783992946f, 0.449788809f},
-std::array<float,2>{0.343549818f, 0.53949517f},
-std::array<float,2>{0.051855877f, 0.148068815f},
-std::array<float,2>{0.705651283f, 0.798865438f},
-std::array<float,2>{0.622423112f, 0.0566018634f},
-std::array<float,2>{0.156484991f, 0.949556112f},
-std::array<float,2>{0.425797015f, 0.344972342f},
-std::array<float,2>{0.921630979f, 0.642760813f},
-std::array<float,2>{0.952372968f, 0.100786485f},
-std::array<float,2>{0.486606658f, 0.877867758f},
-std::array<float,2>{0.206314608f, 0.260563791f},
-std::array<float,2>{0.555678606f, 0.748199403f},
-std::array<float,2>{0.684294343f, 0.395033687f},
-std::array<float,2>{0.0741432682f, 0.612949431f},
-std::array<float,2>{0.278797716f, 0.199423045f},
-std::array<float,2>{0.869161963f, 0.856831551f},
-std::array<float,2>{0.778634906f, 0.356375068f},
-std::array<float,2>{0.37356773f, 0.655720949f},
-std::array<float,2>{0.0105753643f, 0.0526901223f},
-std::array<float,2>{0.738534033f, 0.944764555f},
-std::array<float,2>{0.587451756f, 0.154558197f},
-std::array<float,2>{0.129423097f, 0.811783195f},
-std::array<float,2>{0.389808774f, 0.441806585f},
-std::array<float,2>{0.898789406f, 0.531458437f},
-std::array<float,2>{0.829531252f, 0.241622478f},
-std::array<float,2>{0.293667674f, 0.818275928f},
-std::array<float,2>{0.0987081826f, 0.425577313f},
-std::array<float,2>{0.651270211f, 0.566167355f},
-std::array<float,2>{0.524240673f, 0.29226926f},
-std::array<float,2>{0.23372288f, 0.711322546f},
-std::array<float,2>{0.448953986f, 0.0647414327f},
-std::array<float,2>{0.996160448f, 0.93336165f},
-std::array<float,2>{0.909131825f, 0.477321148f},
-std::array<float,2>{0.431849509f, 0.519681096f},
-std::array<float,2>{0.170668095f, 0.184937149f},
-std::array<float,2>{0.612403214f, 0.767791152f},
-std::array<float,2>{0.716434538f, 0.014877486f},
-std::array<float,2>{0.0551272966f, 0.979991078f},
-std::array<float,2>{0.333613694f, 0.325890511f},
-std::array<float,2>{0.794940591f, 0.676557422f},
-std::array<float,2>{0.80382514f, 0.0317766331f},
-std::array<float,2>{0.32575658f, 0.964573562f},
-std::array<float,2>{0.046210032f, 0.369343817f},
-std::array<float,2>{0.696751893f, 0.631055117f},
-std::array<float,2>{0.606567621f, 0.461530268f},
-std::array<float,2>{0.176087365f, 0.562174082f},
-std::array<float,2>{0.408982426f, 0.137999907f},
-std::array<float,2>{0.93366164f, 0.784093201f},
-std::array<float,2>{0.969757259f, 0.267565399f},
-std::array<float,2>{0.465531707f, 0.731368542f},
-std::array<float,2>{0.241079971f, 0.123599768f},
-std::array<float,2>{0.508791625f, 0.901747823f},
-std::array<float,2>{0.634893537f, 0.204834267f},
-std::array<float,2>{0.110054366f, 0.866499066f},
-std::array<float,2>{0.300873458f, 0.377269089f},
-std::array<float,2>{0.814920545f, 0.596681535f},
-std::array<float,2>{0.888375998f, 0.167097703f},
-std::array<float,2>{0.40257737f, 0.760583222f},
-std::array<float,2>{0.144041002f, 0.49311167f},
-std::array<float,2>{0.575731158f, 0.510614872f},
-std::array<float,2>{0.721066356f, 0.339321256f},
-std::array<float,2>{0.0302333254f, 0.657076538f},
-std::array<float,2>{0.345153958f, 0.0308044404f},
-std::array<float,2>{0.763565898f, 0.998574197f},
-std::array<float,2>{0.854049802f, 0.418447465f},
-std::array<float,2>{0.263198256f, 0.586862326f},
-std::array<float,2>{0.0914910063f, 0.230196655f},
-std::array<float,2>{0.66267705f, 0.842193604f},
-std::array<float,2>{0.534049213f, 0.0886468738f},
-std::array<float,2>{0.18759568f, 0.911875546f},
-std::array<float,2>{0.481482744f, 0.311368018f},
-std::array<float,2>{0.961869121f, 0.693339407f},
-std::array<float,2>{0.910364151f, 0.111399837f},
-std::array<float,2>{0.436965287f, 0.897311509f},
-std::array<float,2>{0.167695314f, 0.277162135f},
-std::array<float,2>{0.616091669f, 0.722427011f},
-std::array<float,2>{0.713983059f, 0.383106679f},
-std::array<float,2>{0.0588223636f, 0.601763785f},
-std::array<float,2>{0.33192426f, 0.216483533f},
-std::array<float,2>{0.791039526f, 0.868413389f},
-std::array<float,2>{0.832704186f, 0.366838932f},
-std::array<float,2>{0.291081399f, 0.634547114f},
-std::array<float,2>{0.0968373343f, 0.0451422893f},
-std::array<float,2>{0.65368557f, 0.958720565f},
-std::array<float,2>{0.528167605f, 0.131598264f},
-std::array<float,2>{0.229638144f, 0.793991745f},
-std::array<float,2>{0.449386507f, 0.458696276f},
-std::array<float,2>{0.994057178f, 0.554200113f},
-std::array<float,2>{0.774397969f, 0.222552672f},
-std::array<float,2>{0.368428886f, 0.830562353f},
-std::array<float,2>{0.0155908894f, 0.412187278f},
-std::array<float,2>{0.735993385f, 0.583777308f},
-std::array<float,2>{0.590905905f, 0.303375632f},
-std::array<float,2>{0.126156986f, 0.696729481f},
-std::array<float,2>{0.386351913f, 0.0799531713f},
-std::array<float,2>{0.905169845f, 0.914137483f},
-std::array<float,2>{0.948479116f, 0.486716092f},
-std::array<float,2>{0.491078794f, 0.502820492f},
-std::array<float,2>{0.207143426f, 0.158642247f},
-std::array<float,2>{0.55952543f, 0.756568849f},
-std::array<float,2>{0.681537032f, 0.0176199693f},
-std::array<float,2>{0.0742336512f, 0.989087939f},
-std::array<float,2>{0.276253521f, 0.329839349f},
-std::array<float,2>{0.874214709f, 0.671678603f},
-std::array<float,2>{0.85571903f, 0.0613579415f},
-std::array<float,2>{0.259895533f, 0.947645009f},
-std::array<float,2>{0.0865068212f, 0.350498855f},
-std::array<float,2>{0.658180952f, 0.645192564f},
-std::array<float,2>{0.535256982f, 0.446117073f},
-std::array<float,2>{0.194520652f, 0.543067217f},
-std::array<float,2>{0.478310615f, 0.141022027f},
-std::array<float,2>{0.967679203f, 0.804047585f},
-std::array<float,2>{0.884337485f, 0.25016588f},
-std::array<float,2>{0.40101859f, 0.735942662f},
-std::array<float,2>{0.146398485f, 0.102101132f},
-std::array<float,2>{0.572649598f, 0.889894664f},
-std::array<float,2>{0.726038039f, 0.190689385f},
-std::array<float,2>{0.0268931054f, 0.850266457f},
-std::array<float,2>{0.348862737f, 0.400257111f},
-std::array<float,2>{0.760592878f, 0.617257595f},
-std::array<float,2>{0.973920286f, 0.175833762f},
-std::array<float,2>{0.463594973f, 0.777801096f},
-std::array<float,2>{0.235075861f, 0.47423625f},
-std::array<float,2>{0.515094399f, 0.525557697f},
-std::array<float,2>{0.637437999f, 0.316331297f},
-std::array<float,2>{0.115566701f, 0.687080264f},
-std::array<float,2>{0.297932744f, 0.00780904153f},
-std::array<float,2>{0.818538129f, 0.973597109f},
-std::array<float,2>{0.799294293f, 0.432318598f},
-std::array<float,2>{0.321163177f, 0.575948417f},
-std::array<float,2>{0.0411156304f, 0.242328763f},
-std::array<float,2>{0.701987028f, 0.827151418f},
-std::array<float,2>{0.60480082f, 0.0752546936f},
-std::array<float,2>{0.171933725f, 0.92772603f},
-std::array<float,2>{0.410514355f, 0.288221717f},
-std::array<float,2>{0.931197762f, 0.707542717f},
-std::array<float,2>{0.954683065f, 0.00980858319f},
-std::array<float,2>{0.46900636f, 0.982360601f},
-std::array<float,2>{0.200054154f, 0.32107529f},
-std::array<float,2>{0.539352417f, 0.674227595f},
-std::array<float,2>{0.670010984f, 0.482537746f},
-std::array<float,2>{0.080788441f, 0.516998649f},
-std::array<float,2>{0.251286536f, 0.180357635f},
-std::array<float,2>{0.849319339f, 0.772874475f},
-std::array<float,2>{0.756451368f, 0.293210238f},
-std::array<float,2>{0.352328092f, 0.717460871f},
-std::array<float,2>{0.0214064568f, 0.0671483651f},
-std::array<float,2>{0.73185426f, 0.935551822f},
-std::array<float,2>{0.565929711f, 0.236446142f},
-std::array<float,2>{0.151220843f, 0.813141465f},
-std::array<float,2>{0.397568554f, 0.426323473f},
-std::array<float,2>{0.881403387f, 0.569472909f},
-std::array<float,2>{0.82703495f, 0.151445329f},
-std::array<float,2>{0.308258653f, 0.806324661f},
-std::array<float,2>{0.11810936f, 0.438335985f},
-std::array<float,2>{0.626023173f, 0.537176073f},
-std::array<float,2>{0.503545702f, 0.353841156f},
-std::array<float,2>{0.244091243f, 0.65174216f},
-std::array<float,2>{0.45343861f, 0.0497448295f},
-std::array<float,2>{0.978116632f, 0.940836489f},
-std::array<float,2>{0.929661214f, 0.39242059f},
-std::array<float,2>{0.420174718f, 0.614311755f},
-std::array<float,2>{0.183725834f, 0.195716769f},
-std::array<float,2>{0.595168591f, 0.852862358f},
-std::array<float,2>{0.694909871f, 0.0944646001f},
-std::array<float,2>{0.0342994891f, 0.879553735f},
-std::array<float,2>{0.319817841f, 0.262435287f},
-std::array<float,2>{0.809953272f, 0.745550096f},
-std::array<float,2>{0.788753092f, 0.0930272862f},
-std::array<float,2>{0.338905215f, 0.906550765f},
-std::array<float,2>{0.050200332f, 0.307174414f},
-std::array<float,2>{0.708817363f, 0.688850284f},
-std::array<float,2>{0.619705379f, 0.417142838f},
-std::array<float,2>{0.162094235f, 0.592575014f},
-std::array<float,2>{0.425665319f, 0.234293848f},
-std::array<float,2>{0.914216638f, 0.838199794f},
-std::array<float,2>{0.991430044f, 0.34262675f},
-std::array<float,2>{0.444172621f, 0.663642287f},
-std::array<float,2>{0.225965351f, 0.0245121177f},
-std::array<float,2>{0.522566497f, 0.993161798f},
-std::array<float,2>{0.646872878f, 0.171665877f},
-std::array<float,2>{0.107949719f, 0.764895737f},
-std::array<float,2>{0.287317097f, 0.49768278f},
-std::array<float,2>{0.842571139f, 0.513808727f},
-std::array<float,2>{0.895854712f, 0.208751455f},
-std::array<float,2>{0.377394229f, 0.860939324f},
-std::array<float,2>{0.139435813f, 0.380618989f},
-std::array<float,2>{0.583434403f, 0.600589395f},
-std::array<float,2>{0.749654949f, 0.270856082f},
-std::array<float,2>{0.00727891875f, 0.728186488f},
-std::array<float,2>{0.362479776f, 0.11772757f},
-std::array<float,2>{0.772506595f, 0.902835667f},
-std::array<float,2>{0.865077376f, 0.468497336f},
-std::array<float,2>{0.267061889f, 0.554827213f},
-std::array<float,2>{0.0626142621f, 0.136613563f},
-std::array<float,2>{0.675866246f, 0.785355985f},
-std::array<float,2>{0.551542759f, 0.0363954119f},
-std::array<float,2>{0.21660237f, 0.966901898f},
-std::array<float,2>{0.495481133f, 0.374020606f},
-std::array<float,2>{0.940872312f, 0.626362801f},
-std::array<float,2>{0.87567699f, 0.039521277f},
-std::array<float,2>{0.392810106f, 0.954587519f},
-std::array<float,2>{0.154727533f, 0.360346824f},
-std::array<float,2>{0.568340659f, 0.638570368f},
-std::array<float,2>{0.729894221f, 0.456527978f},
-std::array<float,2>{0.0158982519f, 0.549488306f},
-std::array<float,2>{0.356868953f, 0.125940919f},
-std::array<float,2>{0.753706396f, 0.789489329f},
-std::array<float,2>{0.845001817f, 0.281168878f},
-std::array<float,2>{0.25440684f, 0.724409401f},
-std::array<float,2>{0.0840125456f, 0.115863718f},
-std::array<float,2>{0.664656162f, 0.892958939f},
-std::array<float,2>{0.543392241f, 0.211952016f},
-std::array<float,2>{0.198714957f, 0.874361217f},
-std::array<float,2>{0.473740131f, 0.389389753f},
-std::array<float,2>{0.957779646f, 0.607980251f},
-std::array<float,2>{0.808354914f, 0.163551345f},
-std::array<float,2>{0.314232975f, 0.750702083f},
-std::array<float,2>{0.039020393f, 0.488332331f},
-std::array<float,2>{0.689914405f, 0.504563868f},
-std::array<float,2>{0.600098014f, 0.332034051f},
-std::array<float,2>{0.182037175f, 0.666415036f},
-std::array<float,2>{0.416213423f, 0.0201594196f},
-std::array<float,2>{0.923166096f, 0.986960053f},
-std::array<float,2>{0.981091082f, 0.407880366f},
-std::array<float,2>{0.458405823f, 0.580835462f},
-std::array<float,2>{0.248693362f, 0.224094719f},
-std::array<float,2>{0.504011691f, 0.835195124f},
-std::array<float,2>{0.629212558f, 0.0857542679f},
-std::array<float,2>{0.12162441f, 0.91948235f},
-std::array<float,2>{0.311651617f, 0.300148517f},
-std::array<float,2>{0.822667301f, 0.700315416f},
-std::array<float,2>{0.838727951f, 0.105508476f},
-std::array<float,2>{0.283342034f, 0.883756638f},
-std::array<float,2>{0.103604905f, 0.255775213f},
-std::array<float,2>{0.643633962f, 0.74177295f},
-std::array<float,2>{0.516670465f, 0.402589977f},
-std::array<float,2>{0.221171737f, 0.622496903f},
-std::array<float,2>{0.44090566f, 0.193719044f},
-std::array<float,2>{0.986631095f, 0.845713675f},
-std::array<float,2>{0.91866672f, 0.346519649f},
-std::array<float,2>{0.428749859f, 0.64169246f},
-std::array<float,2>{0.15983355f, 0.0569970645f},
-std::array<float,2>{0.623609543f, 0.951419771f},
-std::array<float,2>{0.703472376f, 0.146318287f},
-std::array<float,2>{0.054416921f, 0.797479749f},
-std::array<float,2>{0.341236442f, 0.45121932f},
-std::array<float,2>{0.781260252f, 0.541552424f},
-std::array<float,2>{0.944651783f, 0.247055128f},
-std::array<float,2>{0.49774161f, 0.823162854f},
-std::array<float,2>{0.214671075f, 0.436822087f},
-std::array<float,2>{0.548507392f, 0.570647955f},
-std::array<float,2>{0.672237873f, 0.282955945f},
-std::array<float,2>{0.0670946389f, 0.704132795f},
-std::array<float,2>{0.270662844f, 0.070506312f},
-std::array<float,2>{0.860794485f, 0.924970567f},
-std::array<float,2>{0.767218053f, 0.470048994f},
-std::array<float,2>{0.363708287f, 0.530735612f},
-std::array<float,2>{0.000931563263f, 0.174100816f},
-std::array<float,2>{0.743538558f, 0.774577916f},
-std::array<float,2>{0.5819965f, 0.00309659238f},
-std::array<float,2>{0.134730667f, 0.97034502f},
-std::array<float,2>{0.382477164f, 0.317125857f},
-std::array<float,2>{0.893942416f, 0.67980963f},
-std::array<float,2>{0.999532104f, 0.0632424429f},
-std::array<float,2>{0.445446998f, 0.93043983f},
-std::array<float,2>{0.231930986f, 0.289757788f},
-std::array<float,2>{0.526838362f, 0.714563549f},
-std::array<float,2>{0.649563134f, 0.423219651f},
-std::array<float,2>{0.101309016f, 0.563565731f},
-std::array<float,2>{0.296174288f, 0.239520058f},
-std::array<float,2>{0.831832051f, 0.818748295f},
-std::array<float,2>{0.793067515f, 0.327536196f},
-std::array<float,2>{0.335453242f, 0.678119183f},
-std::array<float,2>{0.0567083731f, 0.0118460907f},
-std::array<float,2>{0.71732682f, 0.977964342f},
-std::array<float,2>{0.609493375f, 0.185875699f},
-std::array<float,2>{0.169764385f, 0.76654619f},
-std::array<float,2>{0.430358976f, 0.478999764f},
-std::array<float,2>{0.907657444f, 0.522983849f},
-std::array<float,2>{0.868761778f, 0.201414213f},
-std::array<float,2>{0.280382186f, 0.858110547f},
-std::array<float,2>{0.0713098273f, 0.396781534f},
-std::array<float,2>{0.686367512f, 0.609545231f},
-std::array<float,2>{0.557385147f, 0.259147763f},
-std::array<float,2>{0.204276115f, 0.746712327f},
-std::array<float,2>{0.4850142f, 0.0986713246f},
-std::array<float,2>{0.950418651f, 0.875759304f},
-std::array<float,2>{0.901644588f, 0.443740308f},
-std::array<float,2>{0.387121469f, 0.535074592f},
-std::array<float,2>{0.132546321f, 0.153729856f},
-std::array<float,2>{0.588209808f, 0.8102175f},
-std::array<float,2>{0.741025209f, 0.0540121198f},
-std::array<float,2>{0.00812922977f, 0.942790747f},
-std::array<float,2>{0.371859699f, 0.357688487f},
-std::array<float,2>{0.780238748f, 0.65281713f},
-std::array<float,2>{0.765279472f, 0.0282490589f},
-std::array<float,2>{0.346618712f, 0.997033715f},
-std::array<float,2>{0.0286684316f, 0.336375505f},
-std::array<float,2>{0.719165444f, 0.658306122f},
-std::array<float,2>{0.577274919f, 0.49574846f},
-std::array<float,2>{0.140835717f, 0.509719968f},
-std::array<float,2>{0.405980915f, 0.165307567f},
-std::array<float,2>{0.889707565f, 0.758273184f},
-std::array<float,2>{0.964541435f, 0.308631986f},
-std::array<float,2>{0.482518107f, 0.694119751f},
-std::array<float,2>{0.19109641f, 0.0864929706f},
-std::array<float,2>{0.532272041f, 0.912136376f},
-std::array<float,2>{0.661519408f, 0.227136582f},
-std::array<float,2>{0.0935475528f, 0.839944124f},
-std::array<float,2>{0.264215618f, 0.421396434f},
-std::array<float,2>{0.851921678f, 0.588729799f},
-std::array<float,2>{0.936826706f, 0.138788179f},
-std::array<float,2>{0.407700956f, 0.782630146f},
-std::array<float,2>{0.178396717f, 0.463728845f},
-std::array<float,2>{0.608376503f, 0.559360266f},
-std::array<float,2>{0.697981119f, 0.368470132f},
-std::array<float,2>{0.0439004228f, 0.630843401f},
-std::array<float,2>{0.328104973f, 0.0333378278f},
-std::array<float,2>{0.802552044f, 0.962696671f},
-std::array<float,2>{0.81301564f, 0.375719666f},
-std::array<float,2>{0.303449839f, 0.593851268f},
-std::array<float,2>{0.112966895f, 0.205819666f},
-std::array<float,2>{0.634587109f, 0.863376915f},
-std::array<float,2>{0.510879397f, 0.122512683f},
-std::array<float,2>{0.238931045f, 0.898938179f},
-std::array<float,2>{0.468353778f, 0.267950118f},
-std::array<float,2>{0.97076565f, 0.732455254f},
-std::array<float,2>{0.886188924f, 0.102914445f},
-std::array<float,2>{0.398806661f, 0.889227867f},
-std::array<float,2>{0.14763394f, 0.251689851f},
-std::array<float,2>{0.572036386f, 0.734488189f},
-std::array<float,2>{0.723454952f, 0.39908728f},
-std::array<float,2>{0.0251621697f, 0.618397295f},
-std::array<float,2>{0.350682229f, 0.189479008f},
-std::array<float,2>{0.759674907f, 0.851023912f},
-std::array<float,2>{0.857716858f, 0.351529896f},
-std::array<float,2>{0.258464247f, 0.646014094f},
-std::array<float,2>{0.0880021825f, 0.0623954646f},
-std::array<float,2>{0.659620047f, 0.94829607f},
-std::array<float,2>{0.538937569f, 0.141990006f},
-std::array<float,2>{0.191966295f, 0.803415418f},
-std::array<float,2>{0.479976028f, 0.446928054f},
-std::array<float,2>{0.965605199f, 0.544328153f},
-std::array<float,2>{0.798015416f, 0.243779689f},
-std::array<float,2>{0.32364285f, 0.827069461f},
-std::array<float,2>{0.0399419889f, 0.432897002f},
-std::array<float,2>{0.699564219f, 0.574579537f},
-std::array<float,2>{0.602728546f, 0.28753683f},
-std::array<float,2>{0.174764171f, 0.708378613f},
-std::array<float,2>{0.413275748f, 0.0747278333f},
-std::array<float,2>{0.932240963f, 0.926462531f},
-std::array<float,2>{0.975856662f, 0.473094583f},
-std::array<float,2>{0.461189628f, 0.527260303f},
-std::array<float,2>{0.238238633f, 0.176798567f},
-std::array<float,2>{0.513337135f, 0.778539956f},
-std::array<float,2>{0.6395064f, 0.00673685176f},
-std::array<float,2>{0.115149528f, 0.973701179f},
-std::array<float,2>{0.2989631f, 0.314740628f},
-std::array<float,2>{0.816946685f, 0.686322212f},
-std::array<float,2>{0.834476888f, 0.0463604964f},
-std::array<float,2>{0.289208472f, 0.957459092f},
-std::array<float,2>{0.0946424752f, 0.365891755f},
-std::array<float,2>{0.655403852f, 0.63314414f},
-std::array<float,2>{0.531248033f, 0.457577258f},
-std::array<float,2>{0.226756841f, 0.553188384f},
-std::array<float,2>{0.452070028f, 0.132370621f},
-std::array<float,2>{0.995382786f, 0.793897271f},
-std::array<float,2>{0.912860274f, 0.275758296f},
-std::array<float,2>{0.434573144f, 0.720712662f},
-std::array<float,2>{0.165069953f, 0.112926371f},
-std::array<float,2>{0.61335963f, 0.898370147f},
-std::array<float,2>{0.712616146f, 0.215073168f},
-std::array<float,2>{0.0611239821f, 0.868142366f},
-std::array<float,2>{0.328612119f, 0.384753764f},
-std::array<float,2>{0.790950418f, 0.60266912f},
-std::array<float,2>{0.946137309f, 0.159999102f},
-std::array<float,2>{0.489830285f, 0.757397532f},
-std::array<float,2>{0.209363833f, 0.488013059f},
-std::array<float,2>{0.562171638f, 0.50328958f},
-std::array<float,2>{0.682493448f, 0.328382283f},
-std::array<float,2>{0.0772459209f, 0.67024827f},
-std::array<float,2>{0.275340527f, 0.0194366295f},
-std::array<float,2>{0.872828186f, 0.989918768f},
-std::array<float,2>{0.776307225f, 0.413596988f},
-std::array<float,2>{0.369347215f, 0.582711041f},
-std::array<float,2>{0.0123886587f, 0.220848382f},
-std::array<float,2>{0.736900449f, 0.831707537f},
-std::array<float,2>{0.592771411f, 0.0787738711f},
-std::array<float,2>{0.128856853f, 0.915689051f},
-std::array<float,2>{0.383984208f, 0.30374831f},
-std::array<float,2>{0.90411973f, 0.695403636f},
-std::array<float,2>{0.988384008f, 0.0243451986f},
-std::array<float,2>{0.442798018f, 0.994103491f},
-std::array<float,2>{0.224203229f, 0.342949718f},
-std::array<float,2>{0.519901037f, 0.663001895f},
-std::array<float,2>{0.64515245f, 0.496607929f},
-std::array<float,2>{0.106218576f, 0.515057087f},
-std::array<float,2>{0.286889851f, 0.170731172f},
-std::array<float,2>{0.841739535f, 0.764052391f},
-std::array<float,2>{0.785682976f, 0.308570027f},
-std::array<float,2>{0.336478919f, 0.688202322f},
-std::array<float,2>{0.0477513559f, 0.0920301005f},
-std::array<float,2>{0.710501671f, 0.907437742f},
-std::array<float,2>{0.61798048f, 0.23279725f},
-std::array<float,2>{0.164038196f, 0.839149535f},
-std::array<float,2>{0.423699856f, 0.41606608f},
-std::array<float,2>{0.917160869f, 0.593457222f},
-std::array<float,2>{0.866018713f, 0.135299772f},
-std::array<float,2>{0.268822968f, 0.786491811f},
-std::array<float,2>{0.0656010583f, 0.467152119f},
-std::array<float,2>{0.679331779f, 0.556640387f},
-std::array<float,2>{0.553771853f, 0.374899089f},
-std::array<float,2>{0.218491077f, 0.625468493f},
-std::array<float,2>{0.4923518f, 0.0354748592f},
-std::array<float,2>{0.938296676f, 0.968460381f},
-std::array<float,2>{0.89756012f, 0.379596204f},
-std::array<float,2>{0.375687182f, 0.600248635f},
-std::array<float,2>{0.137239754f, 0.207744583f},
-std::array<float,2>{0.584923208f, 0.859687984f},
-std::array<float,2>{0.747392476f, 0.119090959f},
-std::array<float,2>{0.00450310577f, 0.903590918f},
-std::array<float,2>{0.360939175f, 0.269618213f},
-std::array<float,2>{0.770720482f, 0.727072179f},
-std::array<float,2>{0.755809307f, 0.0678602606f},
-std::array<float,2>{0.353897721f, 0.93749392f},
-std::array<float,2>{0.0234307405f, 0.294143796f},
-std::array<float,2>{0.732519865f, 0.718277693f},
-std::array<float,2>{0.563883901f, 0.427641273f},
-std::array<float,2>{0.149481863f, 0.56924051f},
-std::array<float,2>{0.395914644f, 0.237663403f},
-std::array<float,2>{0.880084276f, 0.813645244f},
-std::array<float,2>{0.955187857f, 0.322238445f},
-std::array<float,2>{0.472219288f, 0.675275981f},
-std::array<float,2>{0.202323347f, 0.0110347643f},
-std::array<float,2>{0.541693985f, 0.981133878f},
-std::array<float,2>{0.668465972f, 0.18072629f},
-std::array<float,2>{0.0797941461f, 0.771511912f},
-std::array<float,2>{0.252322018f, 0.483468145f},
-std::array<float,2>{0.851531982f, 0.516246438f},
-std::array<float,2>{0.927278459f, 0.196493566f},
-std::array<float,2>{0.419405818f, 0.851998329f},
-std::array<float,2>{0.186556503f, 0.390923023f},
-std::array<float,2>{0.597293735f, 0.61419791f},
-std::array<float,2>{0.691717386f, 0.26277566f},
-std::array<float,2>{0.0320741385f, 0.744537592f},
-std::array<float,2>{0.318042397f, 0.0952044651f},
-std::array<float,2>{0.812007427f, 0.879890025f},
-std::array<float,2>{0.824564338f, 0.439174831f},
-std::array<float,2>{0.306383044f, 0.538373947f},
-std::array<float,2>{0.12014062f, 0.150648654f},
-std::array<float,2>{0.627665639f, 0.804935634f},
-std::array<float,2>{0.500465095f, 0.0507221594f},
-std::array<float,2>{0.244203568f, 0.939830899f},
-std::array<float,2>{0.455692589f, 0.35527727f},
-std::array<float,2>{0.980035543f, 0.65051651f},
-std::array<float,2>{0.920465589f, 0.0579871759f},
-std::array<float,2>{0.426937819f, 0.952276409f},
-std::array<float,2>{0.158081427f, 0.347508103f},
-std::array<float,2>{0.62112087f, 0.640627801f},
-std::array<float,2>{0.706065655f, 0.452210784f},
-std::array<float,2>{0.0514250249f, 0.542210817f},
-std::array<float,2>{0.34235999f, 0.144875214f},
-std::array<float,2>{0.784653902f, 0.797917187f},
-std::array<float,2>{0.83600527f, 0.254576892f},
-std::array<float,2>{0.281667262f, 0.741018534f},
-std::array<float,2>{0.101926073f, 0.107306071f},
-std::array<float,2>{0.640769541f, 0.883833051f},
-std::array<float,2>{0.518046141f, 0.194795728f},
-std::array<float,2>{0.220070317f, 0.84699142f},
-std::array<float,2>{0.437585205f, 0.404035032f},
-std::array<float,2>{0.985016584f, 0.621553302f},
-std::array<float,2>{0.768289685f, 0.175337479f},
-std::array<float,2>{0.365245789f, 0.773922682f},
-std::array<float,2>{0.0034602622f, 0.46927008f},
-std::array<float,2>{0.745852351f, 0.529459774f},
-std::array<float,2>{0.579877257f, 0.317667753f},
-std::array<float,2>{0.134870782f, 0.681112289f},
-std::array<float,2>{0.380103081f, 0.00197096821f},
-std::array<float,2>{0.891530573f, 0.969463289f},
-std::array<float,2>{0.941707551f, 0.435993433f},
-std::array<float,2>{0.499926835f, 0.571879447f},
-std::array<float,2>{0.211290583f, 0.247805849f},
-std::array<float,2>{0.550043881f, 0.823294044f},
-std::array<float,2>{0.675780296f, 0.0717114061f},
-std::array<float,2>{0.0695201308f, 0.924612284f},
-std::array<float,2>{0.272021741f, 0.281847268f},
-std::array<float,2>{0.862854064f, 0.70407337f},
-std::array<float,2>{0.846910775f, 0.11717172f},
-std::array<float,2>{0.256822228f, 0.894198179f},
-std::array<float,2>{0.0825780183f, 0.279966235f},
-std::array<float,2>{0.667431474f, 0.723106623f},
-std::array<float,2>{0.545216024f, 0.39057216f},
-std::array<float,2>{0.195766851f, 0.609276295f},
-std::array<float,2>{0.47503081f, 0.210940197f},
-std::array<float,2>{0.959448099f, 0.873193622f},
-std::array<float,2>{0.877299964f, 0.361119717f},
-std::array<float,2>{0.391733378f, 0.637301981f},
-std::array<float,2>{0.152540922f, 0.0401163176f},
-std::array<float,2>{0.569493771f, 0.95352006f},
-std::array<float,2>{0.727068067f, 0.126608238f},
-std::array<float,2>{0.0186314005f, 0.790683568f},
-std::array<float,2>{0.359076202f, 0.455433995f},
-std::array<float,2>{0.750662506f, 0.549897194f},
-std::array<float,2>{0.983114481f, 0.223059893f},
-std::array<float,2>{0.460044026f, 0.834279478f},
-std::array<float,2>{0.247677132f, 0.406907946f},
-std::array<float,2>{0.506464124f, 0.58122164f},
-std::array<float,2>{0.632074535f, 0.299732864f},
-std::array<float,2>{0.124098919f, 0.699334681f},
-std::array<float,2>{0.309955597f, 0.0841496885f},
-std::array<float,2>{0.822034061f, 0.918591917f},
-std::array<float,2>{0.806139529f, 0.489851475f},
-std::array<float,2>{0.316168189f, 0.505713344f},
-std::array<float,2>{0.0369113274f, 0.16236046f},
-std::array<float,2>{0.687746525f, 0.751850367f},
-std::array<float,2>{0.599298358f, 0.0208791569f},
-std::array<float,2>{0.180284664f, 0.987489343f},
-std::array<float,2>{0.415569246f, 0.333019644f},
-std::array<float,2>{0.924360693f, 0.667699873f},
-std::array<float,2>{0.962226808f, 0.0876590237f},
-std::array<float,2>{0.481014043f, 0.913946688f},
-std::array<float,2>{0.189210594f, 0.310256451f},
-std::array<float,2>{0.534364998f, 0.695277572f},
-std::array<float,2>{0.663327456f, 0.420521468f},
-std::array<float,2>{0.090237774f, 0.589338899f},
-std::array<float,2>{0.261773765f, 0.227792457f},
-std::array<float,2>{0.855113447f, 0.841705263f},
-std::array<float,2>{0.762148738f, 0.337804586f},
-std::array<float,2>{0.34459132f, 0.659242988f},
-std::array<float,2>{0.0303702392f, 0.0289526694f},
-std::array<float,2>{0.72183311f, 0.998014629f},
-std::array<float,2>{0.574889302f, 0.164920419f},
-std::array<float,2>{0.143373191f, 0.759313703f},
-std::array<float,2>{0.404063374f, 0.494734436f},
-std::array<float,2>{0.886991918f, 0.508035541f},
-std::array<float,2>{0.816142082f, 0.206295654f},
-std::array<float,2>{0.302036643f, 0.864938378f},
-std::array<float,2>{0.110833503f, 0.376193374f},
-std::array<float,2>{0.636686921f, 0.595339835f},
-std::array<float,2>{0.507876754f, 0.269217938f},
-std::array<float,2>{0.242014498f, 0.733860373f},
-std::array<float,2>{0.466624171f, 0.1218495f},
-std::array<float,2>{0.968752861f, 0.900292635f},
-std::array<float,2>{0.934656501f, 0.464516431f},
-std::array<float,2>{0.409268439f, 0.560453176f},
-std::array<float,2>{0.177211717f, 0.140079334f},
-std::array<float,2>{0.605723381f, 0.781959593f},
-std::array<float,2>{0.695697427f, 0.0350896306f},
-std::array<float,2>{0.0456952527f, 0.96117574f},
-std::array<float,2>{0.324585617f, 0.36748606f},
-std::array<float,2>{0.803583741f, 0.629619122f},
-std::array<float,2>{0.796176851f, 0.0136328619f},
-std::array<float,2>{0.332174093f, 0.977466762f},
-std::array<float,2>{0.056598492f, 0.326745898f},
-std::array<float,2>{0.715001047f, 0.679276943f},
-std::array<float,2>{0.612292171f, 0.480291754f},
-std::array<float,2>{0.171673343f, 0.521961033f},
-std::array<float,2>{0.432674855f, 0.186882809f},
-std::array<float,2>{0.909458399f, 0.767061114f},
-std::array<float,2>{0.997184873f, 0.290542036f},
-std::array<float,2>{0.44781065f, 0.712917984f},
-std::array<float,2>{0.232756004f, 0.0643211454f},
-std::array<float,2>{0.524583936f, 0.931041777f},
-std::array<float,2>{0.651419997f, 0.238430381f},
-std::array<float,2>{0.0984717831f, 0.819624186f},
-std::array<float,2>{0.29424718f, 0.4226996f},
-std::array<float,2>{0.82837522f, 0.562818825f},
-std::array<float,2>{0.900024951f, 0.152888045f},
-std::array<float,2>{0.388752043f, 0.808828354f},
-std::array<float,2>{0.1304086f, 0.444809467f},
-std::array<float,2>{0.586296141f, 0.533540964f},
-std::array<float,2>{0.739810586f, 0.358907044f},
-std::array<float,2>{0.0116770044f, 0.653430939f},
-std::array<float,2>{0.374885887f, 0.0527807921f},
-std::array<float,2>{0.777633727f, 0.941426039f},
-std::array<float,2>{0.870339036f, 0.398252428f},
-std::array<float,2>{0.277709752f, 0.610592425f},
-std::array<float,2>{0.073122628f, 0.202486575f},
-std::array<float,2>{0.685433507f, 0.85887903f},
-std::array<float,2>{0.555557311f, 0.0980030745f},
-std::array<float,2>{0.205784634f, 0.876741648f},
-std::array<float,2>{0.487976283f, 0.258511454f},
-std::array<float,2>{0.951957107f, 0.747972369f},
-std::array<float,2>{0.929786623f, 0.0765557289f},
-std::array<float,2>{0.411235869f, 0.929039121f},
-std::array<float,2>{0.173310846f, 0.286745518f},
-std::array<float,2>{0.604070127f, 0.709856093f},
-std::array<float,2>{0.702899635f, 0.430892617f},
-std::array<float,2>{0.0423548333f, 0.576378047f},
-std::array<float,2>{0.321355671f, 0.245111406f},
-std::array<float,2>{0.800355613f, 0.824728251f},
-std::array<float,2>{0.819875419f, 0.313796371f},
-std::array<float,2>{0.29761073f, 0.685309052f},
-std::array<float,2>{0.116472945f, 0.00401147874f},
-std::array<float,2>{0.638299584f, 0.97646302f},
-std::array<float,2>{0.514283597f, 0.178877756f},
-std::array<float,2>{0.236075714f, 0.779814661f},
-std::array<float,2>{0.46462065f, 0.475189239f},
-std::array<float,2>{0.972827971f, 0.525152087f},
-std::array<float,2>{0.761186063f, 0.187610447f},
-std::array<float,2>{0.347864747f, 0.848519146f},
-std::array<float,2>{0.0262842551f, 0.400404334f},
-std::array<float,2>{0.725143731f, 0.620685518f},
-std::array<float,2>{0.57384938f, 0.253800869f},
-std::array<float,2>{0.14540799f, 0.737176955f},
-std::array<float,2>{0.401418477f, 0.104273498f},
-std::array<float,2>{0.883227944f, 0.887613773f},
-std::array<float,2>{0.968449771f, 0.448765129f},
-std::array<float,2>{0.477381647f, 0.54621911f},
-std::array<float,2>{0.194127977f, 0.142741904f},
-std::array<float,2>{0.537036419f, 0.800843775f},
-std::array<float,2>{0.657123268f, 0.0602332428f},
-std::array<float,2>{0.0873553082f, 0.946472824f},
-std::array<float,2>{0.26084286f, 0.348933399f},
-std::array<float,2>{0.856977701f, 0.647092998f},
-std::array<float,2>{0.873476565f, 0.0160641f},
-std::array<float,2>{0.276604205f, 0.990309775f},
-std::array<float,2>{0.0758472234f, 0.331888556f},
-std::array<float,2>{0.680209637f, 0.668338597f},
-std::array<float,2>{0.559599698f, 0.486055434f},
-std::array<float,2>{0.208340243f, 0.500788867f},
-std::array<float,2>{0.491473913f, 0.15783456f},
-std::array<float,2>{0.948181748f, 0.755097449f},
-std::array<float,2>{0.905964613f, 0.301004797f},
-std::array<float,2>{0.385221958f, 0.69893682f},
-std::array<float,2>{0.125443518f, 0.0815609396f},
-std::array<float,2>{0.590644598f, 0.91655761f},
-std::array<float,2>{0.734520674f, 0.21903643f},
-std::array<float,2>{0.0139876436f, 0.829405785f},
-std::array<float,2>{0.367634833f, 0.411669046f},
-std::array<float,2>{0.774690866f, 0.585577846f},
-std::array<float,2>{0.993082881f, 0.129336491f},
-std::array<float,2>{0.45035255f, 0.795272708f},
-std::array<float,2>{0.229211316f, 0.460120618f},
-std::array<float,2>{0.528745413f, 0.552526176f},
-std::array<float,2>{0.652430534f, 0.365191907f},
-std::array<float,2>{0.0964219719f, 0.635322273f},
-std::array<float,2>{0.292941898f, 0.0432394445f},
-std::array<float,2>{0.833329618f, 0.959910691f},
-std::array<float,2>{0.792617917f, 0.38586551f},
-std::array<float,2>{0.330752552f, 0.604146302f},
-std::array<float,2>{0.0597275496f, 0.218411654f},
-std::array<float,2>{0.713266015f, 0.870347798f},
-std::array<float,2>{0.616932392f, 0.109636113f},
-std::array<float,2>{0.166081294f, 0.896004558f},
-std::array<float,2>{0.435798287f, 0.274144739f},
-std::array<float,2>{0.911977291f, 0.719661415f},
-std::array<float,2>{0.939941585f, 0.0371933766f},
-std::array<float,2>{0.494561315f, 0.965323925f},
-std::array<float,2>{0.215071961f, 0.371376008f},
-std::array<float,2>{0.5525648f, 0.627232134f},
-std::array<float,2>{0.677733719f, 0.466609031f},
-std::array<float,2>{0.0638332367f, 0.558052838f},
-std::array<float,2>{0.266450673f, 0.134743363f},
-std::array<float,2>{0.864168942f, 0.788663745f},
-std::array<float,2>{0.772126257f, 0.272033691f},
-std::array<float,2>{0.361606628f, 0.728558779f},
-std::array<float,2>{0.00655261846f, 0.120991901f},
-std::array<float,2>{0.748792231f, 0.90445745f},
-std::array<float,2>{0.582795143f, 0.210238859f},
-std::array<float,2>{0.139948383f, 0.862337112f},
-std::array<float,2>{0.378739595f, 0.380897194f},
-std::array<float,2>{0.894848406f, 0.599332273f},
-std::array<float,2>{0.843192995f, 0.168259665f},
-std::array<float,2>{0.28872025f, 0.762809813f},
-std::array<float,2>{0.109095581f, 0.499123365f},
-std::array<float,2>{0.648228943f, 0.513089597f},
-std::array<float,2>{0.522102356f, 0.339971006f},
-std::array<float,2>{0.225263819f, 0.661944509f},
-std::array<float,2>{0.444843709f, 0.026546251f},
-std::array<float,2>{0.990310073f, 0.995636702f},
-std::array<float,2>{0.915838718f, 0.415725917f},
-std::array<float,2>{0.424291372f, 0.590289652f},
-std::array<float,2>{0.160220474f, 0.231249169f},
-std::array<float,2>{0.621035993f, 0.836382866f},
-std::array<float,2>{0.707595348f, 0.090122968f},
-std::array<float,2>{0.0491586365f, 0.90971458f},
-std::array<float,2>{0.338011742f, 0.304771662f},
-std::array<float,2>{0.787782907f, 0.689668834f},
-std::array<float,2>{0.809488356f, 0.097124368f},
-std::array<float,2>{0.319067359f, 0.882001698f},
-std::array<float,2>{0.0335200205f, 0.265487999f},
-std::array<float,2>{0.69411248f, 0.743086219f},
-std::array<float,2>{0.594092429f, 0.392704844f},
-std::array<float,2>{0.18496953f, 0.616599739f},
-std::array<float,2>{0.421477795f, 0.197985917f},
-std::array<float,2>{0.928249955f, 0.853605449f},
-std::array<float,2>{0.976781249f, 0.353399396f},
-std::array<float,2>{0.455035061f, 0.649069011f},
-std::array<float,2>{0.242212266f, 0.0482640155f},
-std::array<float,2>{0.502187431f, 0.938910365f},
-std::array<float,2>{0.625815511f, 0.150106028f},
-std::array<float,2>{0.118479691f, 0.807133734f},
-std::array<float,2>{0.306657046f, 0.439942926f},
-std::array<float,2>{0.827870667f, 0.535925865f},
-std::array<float,2>{0.882557094f, 0.234577373f},
-std::array<float,2>{0.397349864f, 0.815246642f},
-std::array<float,2>{0.152048275f, 0.429315656f},
-std::array<float,2>{0.56516242f, 0.566805124f},
-std::array<float,2>{0.730837822f, 0.295577586f},
-std::array<float,2>{0.0195699483f, 0.716277957f},
-std::array<float,2>{0.352727681f, 0.0687052757f},
-std::array<float,2>{0.757005095f, 0.93553859f},
-std::array<float,2>{0.848011851f, 0.48081252f},
-std::array<float,2>{0.250850976f, 0.518571734f},
-std::array<float,2>{0.0814593285f, 0.182658821f},
-std::array<float,2>{0.671638489f, 0.769739211f},
-std::array<float,2>{0.54055804f, 0.0090559395f},
-std::array<float,2>{0.200658455f, 0.983278632f},
-std::array<float,2>{0.470648408f, 0.324166685f},
-std::array<float,2>{0.953425169f, 0.672547698f},
-std::array<float,2>{0.893471062f, 0.000643504027f},
-std::array<float,2>{0.38124758f, 0.971477091f},
-std::array<float,2>{0.133374438f, 0.319159746f},
-std::array<float,2>{0.580614507f, 0.682165682f},
-std::array<float,2>{0.7427122f, 0.4718104f},
-std::array<float,2>{0.00150074961f, 0.527564466f},
-std::array<float,2>{0.364828914f, 0.172127813f},
-std::array<float,2>{0.765910089f, 0.776408911f},
-std::array<float,2>{0.860310972f, 0.284810543f},
-std::array<float,2>{0.269703507f, 0.705981433f},
-std::array<float,2>{0.0681717917f, 0.0731317177f},
-std::array<float,2>{0.673148513f, 0.922039986f},
-std::array<float,2>{0.547236383f, 0.24931936f},
-std::array<float,2>{0.21322161f, 0.822213233f},
-std::array<float,2>{0.496516138f, 0.435371429f},
-std::array<float,2>{0.943850696f, 0.572597861f},
-std::array<float,2>{0.783058345f, 0.146665379f},
-std::array<float,2>{0.340816289f, 0.799973369f},
-std::array<float,2>{0.0533593372f, 0.450357795f},
-std::array<float,2>{0.704798281f, 0.541005194f},
-std::array<float,2>{0.624275744f, 0.344634891f},
-std::array<float,2>{0.158305466f, 0.644308031f},
-std::array<float,2>{0.428582698f, 0.0548593104f},
-std::array<float,2>{0.919490516f, 0.950556755f},
-std::array<float,2>{0.987718582f, 0.405072212f},
-std::array<float,2>{0.439522564f, 0.624694765f},
-std::array<float,2>{0.222269252f, 0.191626981f},
-std::array<float,2>{0.516490161f, 0.844403327f},
-std::array<float,2>{0.643474877f, 0.108987547f},
-std::array<float,2>{0.104914524f, 0.884960234f},
-std::array<float,2>{0.284582824f, 0.256220758f},
-std::array<float,2>{0.839767277f, 0.739048123f},
-std::array<float,2>{0.824180186f, 0.0820434242f},
-std::array<float,2>{0.310622633f, 0.921755612f},
-std::array<float,2>{0.122693904f, 0.298359454f},
-std::array<float,2>{0.630844533f, 0.703088343f},
-std::array<float,2>{0.505366981f, 0.409210503f},
-std::array<float,2>{0.249266192f, 0.578388393f},
-std::array<float,2>{0.457295746f, 0.225278124f},
-std::array<float,2>{0.982232809f, 0.833781064f},
-std::array<float,2>{0.922617197f, 0.335896879f},
-std::array<float,2>{0.417675436f, 0.665517092f},
-std::array<float,2>{0.182663143f, 0.0219606217f},
-std::array<float,2>{0.60062474f, 0.985360146f},
-std::array<float,2>{0.691268682f, 0.161048606f},
-std::array<float,2>{0.0371407159f, 0.752271473f},
-std::array<float,2>{0.313331217f, 0.490254492f},
-std::array<float,2>{0.807477713f, 0.507271588f},
-std::array<float,2>{0.958141446f, 0.214208871f},
-std::array<float,2>{0.473344684f, 0.871914446f},
-std::array<float,2>{0.197577357f, 0.386844873f},
-std::array<float,2>{0.544722438f, 0.606745422f},
-std::array<float,2>{0.665821314f, 0.277661175f},
-std::array<float,2>{0.0852516666f, 0.724935353f},
-std::array<float,2>{0.2556732f, 0.113403693f},
-std::array<float,2>{0.844516516f, 0.892104506f},
-std::array<float,2>{0.752267957f, 0.454609364f},
-std::array<float,2>{0.355846763f, 0.547195017f},
-std::array<float,2>{0.0167231541f, 0.127915561f},
-std::array<float,2>{0.729243636f, 0.792711675f},
-std::array<float,2>{0.566450834f, 0.0420351848f},
-std::array<float,2>{0.155484453f, 0.956832528f},
-std::array<float,2>{0.393979549f, 0.362949669f},
-std::array<float,2>{0.876102209f, 0.640226185f},
-std::array<float,2>{0.971703291f, 0.124064527f},
-std::array<float,2>{0.467743546f, 0.900650144f},
-std::array<float,2>{0.240015984f, 0.265736461f},
-std::array<float,2>{0.510722399f, 0.732194126f},
-std::array<float,2>{0.633124471f, 0.378144175f},
-std::array<float,2>{0.112195797f, 0.596406758f},
-std::array<float,2>{0.304271668f, 0.203179017f},
-std::array<float,2>{0.813884854f, 0.865788341f},
-std::array<float,2>{0.800839901f, 0.370371878f},
-std::array<float,2>{0.327017814f, 0.632656336f},
-std::array<float,2>{0.0445690416f, 0.0326237902f},
-std::array<float,2>{0.698590338f, 0.963476837f},
-std::array<float,2>{0.608792663f, 0.137355372f},
-std::array<float,2>{0.179363772f, 0.784977853f},
-std::array<float,2>{0.406374127f, 0.461924553f},
-std::array<float,2>{0.93624723f, 0.561125934f},
-std::array<float,2>{0.852983236f, 0.22934626f},
-std::array<float,2>{0.265424132f, 0.843458354f},
-std::array<float,2>{0.0926961303f, 0.419674784f},
-std::array<float,2>{0.660746813f, 0.587456822f},
-std::array<float,2>{0.531646073f, 0.312488914f},
-std::array<float,2>{0.189958006f, 0.692070484f},
-std::array<float,2>{0.48372522f, 0.0891688466f},
-std::array<float,2>{0.963259161f, 0.911061347f},
-std::array<float,2>{0.888684154f, 0.493732631f},
-std::array<float,2>{0.404571772f, 0.511087894f},
-std::array<float,2>{0.142420083f, 0.166796744f},
-std::array<float,2>{0.576568127f, 0.761021972f},
-std::array<float,2>{0.720099092f, 0.0300870053f},
-std::array<float,2>{0.0282068476f, 0.999172866f},
-std::array<float,2>{0.34763974f, 0.338078767f},
-std::array<float,2>{0.764375687f, 0.657331765f},
-std::array<float,2>{0.781207561f, 0.0516562499f},
-std::array<float,2>{0.372144461f, 0.943478584f},
-std::array<float,2>{0.00969836302f, 0.356835842f},
-std::array<float,2>{0.742108285f, 0.654693663f},
-std::array<float,2>{0.589503825f, 0.442743808f},
-std::array<float,2>{0.130941004f, 0.532979012f},
-std::array<float,2>{0.387942761f, 0.156105518f},
-std::array<float,2>{0.900868952f, 0.811160564f},
-std::array<float,2>{0.94989264f, 0.26159054f},
-std::array<float,2>{0.486139089f, 0.749152243f},
-std::array<float,2>{0.203355789f, 0.100307107f},
-std::array<float,2>{0.558396757f, 0.878163218f},
-std::array<float,2>{0.686893106f, 0.200658336f},
-std::array<float,2>{0.0703760907f, 0.856247425f},
-std::array<float,2>{0.279692322f, 0.396161705f},
-std::array<float,2>{0.86780858f, 0.61180228f},
-std::array<float,2>{0.907116711f, 0.184436321f},
-std::array<float,2>{0.43103525f, 0.769285798f},
-std::array<float,2>{0.168368474f, 0.477896273f},
-std::array<float,2>{0.611175895f, 0.521328509f},
-std::array<float,2>{0.718586624f, 0.325195134f},
-std::array<float,2>{0.0578156449f, 0.67687726f},
-std::array<float,2>{0.334081292f, 0.0137846135f},
-std::array<float,2>{0.794594705f, 0.979342341f},
-std::array<float,2>{0.830954671f, 0.424091816f},
-std::array<float,2>{0.295691609f, 0.565250814f},
-std::array<float,2>{0.10036128f, 0.241073579f},
-std::array<float,2>{0.648634851f, 0.81675297f},
-std::array<float,2>{0.525693119f, 0.0659211129f},
-std::array<float,2>{0.230800956f, 0.93168658f},
-std::array<float,2>{0.446463227f, 0.291968346f},
-std::array<float,2>{0.998291314f, 0.712451518f},
-std::array<float,2>{0.880566239f, 0.0691029057f},
-std::array<float,2>{0.396263331f, 0.934677064f},
-std::array<float,2>{0.149937332f, 0.294942915f},
-std::array<float,2>{0.564272463f, 0.716400981f},
-std::array<float,2>{0.733373284f, 0.428769767f},
-std::array<float,2>{0.022574801f, 0.566908062f},
-std::array<float,2>{0.354339868f, 0.235278279f},
-std::array<float,2>{0.755022287f, 0.814935505f},
-std::array<float,2>{0.850751877f, 0.323515475f},
-std::array<float,2>{0.252548665f, 0.672130525f},
-std::array<float,2>{0.0792986974f, 0.00952163339f},
-std::array<float,2>{0.668441474f, 0.982478559f},
-std::array<float,2>{0.541370273f, 0.183361664f},
-std::array<float,2>{0.203107715f, 0.770352781f},
-std::array<float,2>{0.472016096f, 0.481179506f},
-std::array<float,2>{0.95604676f, 0.519530535f},
-std::array<float,2>{0.812390089f, 0.197384477f},
-std::array<float,2>{0.317855954f, 0.854343951f},
-std::array<float,2>{0.0312716998f, 0.393312931f},
-std::array<float,2>{0.692263305f, 0.616913438f},
-std::array<float,2>{0.596719444f, 0.265068978f},
-std::array<float,2>{0.187371656f, 0.742567658f},
-std::array<float,2>{0.419807315f, 0.0973898768f},
-std::array<float,2>{0.927172065f, 0.88269943f},
-std::array<float,2>{0.979521096f, 0.439683616f},
-std::array<float,2>{0.455370784f, 0.535207987f},
-std::array<float,2>{0.244684711f, 0.149848863f},
-std::array<float,2>{0.500884056f, 0.807039678f},
-std::array<float,2>{0.627286434f, 0.0484113395f},
-std::array<float,2>{0.120639496f, 0.939258516f},
-std::array<float,2>{0.306146085f, 0.352874935f},
-std::array<float,2>{0.824712455f, 0.648634255f},
-std::array<float,2>{0.840959132f, 0.0273075774f},
-std::array<float,2>{0.286277294f, 0.995329976f},
-std::array<float,2>{0.105497934f, 0.340550482f},
-std::array<float,2>{0.644585609f, 0.661430418f},
-std::array<float,2>{0.520133555f, 0.499922276f},
-std::array<float,2>{0.223997444f, 0.513638318f},
-std::array<float,2>{0.442948878f, 0.168464422f},
-std::array<float,2>{0.989053488f, 0.763432443f},
-std::array<float,2>{0.917591989f, 0.305457532f},
-std::array<float,2>{0.423338205f, 0.690384984f},
-std::array<float,2>{0.163460374f, 0.0907717422f},
-std::array<float,2>{0.617417634f, 0.909665704f},
-std::array<float,2>{0.710322678f, 0.230645284f},
-std::array<float,2>{0.0471630357f, 0.836669862f},
-std::array<float,2>{0.33641243f, 0.415312231f},
-std::array<float,2>{0.785578847f, 0.590459228f},
-std::array<float,2>{0.937884927f, 0.133976579f},
-std::array<float,2>{0.493022978f, 0.788461983f},
-std::array<float,2>{0.21792227f, 0.465977013f},
-std::array<float,2>{0.55442822f, 0.558330536f},
-std::array<float,2>{0.679063141f, 0.371909797f},
-std::array<float,2>{0.0663942769f, 0.627466321f},
-std::array<float,2>{0.269200206f, 0.0377257168f},
-std::array<float,2>{0.865303516f, 0.965735793f},
-std::array<float,2>{0.771308661f, 0.381792963f},
-std::array<float,2>{0.360571116f, 0.599085987f},
-std::array<float,2>{0.00416066125f, 0.21052213f},
-std::array<float,2>{0.74760282f, 0.863063812f},
-std::array<float,2>{0.58442688f, 0.120588571f},
-std::array<float,2>{0.137085199f, 0.905219018f},
-std::array<float,2>{0.375271291f, 0.27160421f},
-std::array<float,2>{0.898274422f, 0.729144514f},
-std::array<float,2>{0.995724201f, 0.0438655131f},
-std::array<float,2>{0.451361328f, 0.959231853f},
-std::array<float,2>{0.227294475f, 0.364443541f},
-std::array<float,2>{0.530305207f, 0.634842098f},
-std::array<float,2>{0.656018019f, 0.460552335f},
-std::array<float,2>{0.0938529819f, 0.551887393f},
-std::array<float,2>{0.289783776f, 0.129533872f},
-std::array<float,2>{0.834354758f, 0.795517206f},
-std::array<float,2>{0.790497363f, 0.273718774f},
-std::array<float,2>{0.329100937f, 0.718787909f},
-std::array<float,2>{0.0609988198f, 0.109955616f},
-std::array<float,2>{0.712010443f, 0.895927608f},
-std::array<float,2>{0.614113748f, 0.218072414f},
-std::array<float,2>{0.165987208f, 0.871076345f},
-std::array<float,2>{0.435545832f, 0.386662483f},
-std::array<float,2>{0.91220367f, 0.603982925f},
-std::array<float,2>{0.872147202f, 0.157424808f},
-std::array<float,2>{0.2746647f, 0.755596757f},
-std::array<float,2>{0.0781120434f, 0.485774279f},
-std::array<float,2>{0.681757689f, 0.500328064f},
-std::array<float,2>{0.56196022f, 0.33128044f},
-std::array<float,2>{0.209840521f, 0.6687361f},
-std::array<float,2>{0.489706069f, 0.0164909717f},
-std::array<float,2>{0.945766628f, 0.990773678f},
-std::array<float,2>{0.903460681f, 0.41148141f},
-std::array<float,2>{0.384625673f, 0.585345089f},
-std::array<float,2>{0.128153756f, 0.219405681f},
-std::array<float,2>{0.592217922f, 0.829690099f},
-std::array<float,2>{0.73643595f, 0.0814419612f},
-std::array<float,2>{0.0122021763f, 0.916199565f},
-std::array<float,2>{0.369692922f, 0.301546037f},
-std::array<float,2>{0.775830805f, 0.69849056f},
-std::array<float,2>{0.759235322f, 0.103752896f},
-std::array<float,2>{0.351561278f, 0.887113214f},
-std::array<float,2>{0.0244268067f, 0.253112406f},
-std::array<float,2>{0.722677588f, 0.736595392f},
-std::array<float,2>{0.571465492f, 0.401266366f},
-std::array<float,2>{0.148147345f, 0.620443761f},
-std::array<float,2>{0.399254233f, 0.18811737f},
-std::array<float,2>{0.886367857f, 0.848001897f},
-std::array<float,2>{0.965286016f, 0.349149168f},
-std::array<float,2>{0.480462939f, 0.646570504f},
-std::array<float,2>{0.191424787f, 0.059904363f},
-std::array<float,2>{0.538538694f, 0.94719249f},
-std::array<float,2>{0.660099924f, 0.143287435f},
-std::array<float,2>{0.0884134173f, 0.801296532f},
-std::array<float,2>{0.258258849f, 0.448707759f},
-std::array<float,2>{0.857963264f, 0.546708703f},
-std::array<float,2>{0.931993067f, 0.244552881f},
-std::array<float,2>{0.413841516f, 0.824581981f},
-std::array<float,2>{0.173935696f, 0.431286067f},
-std::array<float,2>{0.603143096f, 0.577115417f},
-std::array<float,2>{0.699736238f, 0.286281705f},
-std::array<float,2>{0.0395094045f, 0.709363163f},
-std::array<float,2>{0.323924005f, 0.0766979679f},
-std::array<float,2>{0.798428059f, 0.929341018f},
-std::array<float,2>{0.816601992f, 0.474951684f},
-std::array<float,2>{0.299654901f, 0.524703503f},
-std::array<float,2>{0.114372335f, 0.179561079f},
-std::array<float,2>{0.638778627f, 0.779502988f},
-std::array<float,2>{0.512810171f, 0.00461634295f},
-std::array<float,2>{0.237374961f, 0.975889564f},
-std::array<float,2>{0.46176511f, 0.313965619f},
-std::array<float,2>{0.976475596f, 0.684672117f},
-std::array<float,2>{0.909811616f, 0.0144933155f},
-std::array<float,2>{0.433433175f, 0.97866714f},
-std::array<float,2>{0.170951381f, 0.324300945f},
-std::array<float,2>{0.611678004f, 0.677334547f},
-std::array<float,2>{0.715450287f, 0.478287995f},
-std::array<float,2>{0.056024529f, 0.520588815f},
-std::array<float,2>{0.332535088f, 0.183721855f},
-std::array<float,2>{0.79669553f, 0.768708766f},
-std::array<float,2>{0.828939199f, 0.291268826f},
-std::array<float,2>{0.294541121f, 0.711928666f},
-std::array<float,2>{0.097773537f, 0.0655145496f},
-std::array<float,2>{0.65207082f, 0.932338774f},
-std::array<float,2>{0.525174201f, 0.240511656f},
-std::array<float,2>{0.23327367f, 0.816913962f},
-std::array<float,2>{0.447643816f, 0.424617708f},
-std::array<float,2>{0.997692823f, 0.564618468f},
-std::array<float,2>{0.778090417f, 0.155407861f},
-std::array<float,2>{0.3743864f, 0.810571611f},
-std::array<float,2>{0.0108948974f, 0.443223238f},
-std::array<float,2>{0.739706993f, 0.53255868f},
-std::array<float,2>{0.586438119f, 0.357373774f},
-std::array<float,2>{0.130331218f, 0.654997349f},
-std::array<float,2>{0.389223307f, 0.0511965156f},
-std::array<float,2>{0.899638951f, 0.943986297f},
-std::array<float,2>{0.951210499f, 0.39565134f},
-std::array<float,2>{0.487439036f, 0.611872137f},
-std::array<float,2>{0.205222771f, 0.200697228f},
-std::array<float,2>{0.555054188f, 0.855808735f},
-std::array<float,2>{0.684853494f, 0.0998413861f},
-std::array<float,2>{0.0725911409f, 0.878699899f},
-std::array<float,2>{0.278232694f, 0.261098802f},
-std::array<float,2>{0.870616376f, 0.749718189f},
-std::array<float,2>{0.854911327f, 0.0895261019f},
-std::array<float,2>{0.262634665f, 0.910553157f},
-std::array<float,2>{0.0904216468f, 0.311934471f},
-std::array<float,2>{0.663702309f, 0.69188261f},
-std::array<float,2>{0.535081863f, 0.419358373f},
-std::array<float,2>{0.188661247f, 0.587284923f},
-std::array<float,2>{0.480814457f, 0.228831753f},
-std::array<float,2>{0.962796509f, 0.843219876f},
-std::array<float,2>{0.887530148f, 0.338788182f},
-std::array<float,2>{0.403687388f, 0.658137977f},
-std::array<float,2>{0.142961428f, 0.029389007f},
-std::array<float,2>{0.574624002f, 0.99980092f},
-std::array<float,2>{0.722312927f, 0.166148946f},
-std::array<float,2>{0.0310440101f, 0.761232555f},
-std::array<float,2>{0.34379223f, 0.49326703f},
-std::array<float,2>{0.7624861f, 0.511326909f},
-std::array<float,2>{0.969315648f, 0.203831613f},
-std::array<float,2>{0.466164023f, 0.865666032f},
-std::array<float,2>{0.24169296f, 0.378493518f},
-std::array<float,2>{0.508788168f, 0.596107364f},
-std::array<float,2>{0.636152089f, 0.266376376f},
-std::array<float,2>{0.11104583f, 0.731513798f},
-std::array<float,2>{0.302280962f, 0.124637738f},
-std::array<float,2>{0.815600395f, 0.901058197f},
-std::array<float,2>{0.803002059f, 0.462604821f},
-std::array<float,2>{0.324954629f, 0.560594678f},
-std::array<float,2>{0.0453574732f, 0.136790976f},
-std::array<float,2>{0.696159601f, 0.784385145f},
-std::array<float,2>{0.606433392f, 0.0328051373f},
-std::array<float,2>{0.177648887f, 0.963240623f},
-std::array<float,2>{0.409943759f, 0.371026665f},
-std::array<float,2>{0.935170531f, 0.63229531f},
-std::array<float,2>{0.959697843f, 0.113935001f},
-std::array<float,2>{0.475128502f, 0.891854465f},
-std::array<float,2>{0.195866942f, 0.277986407f},
-std::array<float,2>{0.545760214f, 0.725554347f},
-std::array<float,2>{0.667518318f, 0.387693256f},
-std::array<float,2>{0.0824774131f, 0.607390761f},
-std::array<float,2>{0.256213546f, 0.214830682f},
-std::array<float,2>{0.847297966f, 0.871114373f},
-std::array<float,2>{0.750261486f, 0.362413228f},
-std::array<float,2>{0.358429521f, 0.639657319f},
-std::array<float,2>{0.0193431638f, 0.0426047258f},
-std::array<float,2>{0.726841748f, 0.956377685f},
-std::array<float,2>{0.570311844f, 0.127258539f},
-std::array<float,2>{0.15283522f, 0.79219985f},
-std::array<float,2>{0.39213869f, 0.454419315f},
-std::array<float,2>{0.877670944f, 0.547742844f},
-std::array<float,2>{0.821554661f, 0.224711806f},
-std::array<float,2>{0.310318857f, 0.833230138f},
-std::array<float,2>{0.124936685f, 0.409873068f},
-std::array<float,2>{0.632328272f, 0.578988314f},
-std::array<float,2>{0.505896509f, 0.298060656f},
-std::array<float,2>{0.247212216f, 0.702312946f},
-std::array<float,2>{0.460923314f, 0.0825435594f},
-std::array<float,2>{0.98273021f, 0.920913041f},
-std::array<float,2>{0.924245059f, 0.490961671f},
-std::array<float,2>{0.415072173f, 0.507626176f},
-std::array<float,2>{0.179936737f, 0.160556197f},
-std::array<float,2>{0.598900199f, 0.752695024f},
-std::array<float,2>{0.68807447f, 0.0221658163f},
-std::array<float,2>{0.0362922847f, 0.985922575f},
-std::array<float,2>{0.315750808f, 0.335141778f},
-std::array<float,2>{0.806301236f, 0.66584903f},
-std::array<float,2>{0.784943938f, 0.0553114042f},
-std::array<float,2>{0.341964066f, 0.951057434f},
-std::array<float,2>{0.0512486249f, 0.343869478f},
-std::array<float,2>{0.706975579f, 0.643907666f},
-std::array<float,2>{0.621965766f, 0.451159f},
-std::array<float,2>{0.157403752f, 0.540121198f},
-std::array<float,2>{0.427568346f, 0.147181645f},
-std::array<float,2>{0.920399368f, 0.800426364f},
-std::array<float,2>{0.984486997f, 0.256777912f},
-std::array<float,2>{0.438080698f, 0.738690197f},
-std::array<float,2>{0.220703021f, 0.108552769f},
-std::array<float,2>{0.518081546f, 0.885678291f},
-std::array<float,2>{0.641288042f, 0.192161754f},
-std::array<float,2>{0.102067269f, 0.843785882f},
-std::array<float,2>{0.282072693f, 0.40464294f},
-std::array<float,2>{0.836700737f, 0.624490798f},
-std::array<float,2>{0.890957713f, 0.172532722f},
-std::array<float,2>{0.380733073f, 0.777257383f},
-std::array<float,2>{0.135631114f, 0.472548574f},
-std::array<float,2>{0.57927388f, 0.528234422f},
-std::array<float,2>{0.745475471f, 0.318585992f},
-std::array<float,2>{0.0031018462f, 0.68185246f},
-std::array<float,2>{0.366019547f, 0.00018119358f},
-std::array<float,2>{0.767791927f, 0.970887721f},
-std::array<float,2>{0.862502933f, 0.434812307f},
-std::array<float,2>{0.271583766f, 0.573134184f},
-std::array<float,2>{0.0701017976f, 0.249792621f},
-std::array<float,2>{0.675242662f, 0.82144171f},
-std::array<float,2>{0.550444901f, 0.0727243647f},
-std::array<float,2>{0.21181719f, 0.922458112f},
-std::array<float,2>{0.49920693f, 0.284453779f},
-std::array<float,2>{0.941975594f, 0.705391228f},
-std::array<float,2>{0.927867711f, 0.0953858346f},
-std::array<float,2>{0.420920014f, 0.880575061f},
-std::array<float,2>{0.185531631f, 0.263570309f},
-std::array<float,2>{0.594508708f, 0.744744778f},
-std::array<float,2>{0.693367839f, 0.391569048f},
-std::array<float,2>{0.0338191763f, 0.613485813f},
-std::array<float,2>{0.318519026f, 0.197083995f},
-std::array<float,2>{0.809047937f, 0.852063358f},
-std::array<float,2>{0.827276051f, 0.354821742f},
-std::array<float,2>{0.307245702f, 0.651136994f},
-std::array<float,2>{0.118910715f, 0.0498707108f},
-std::array<float,2>{0.625345528f, 0.940092266f},
-std::array<float,2>{0.502521515f, 0.151245862f},
-std::array<float,2>{0.242852286f, 0.805236936f},
-std::array<float,2>{0.454191804f, 0.438631028f},
-std::array<float,2>{0.977492929f, 0.538790226f},
-std::array<float,2>{0.757764518f, 0.238006398f},
-std::array<float,2>{0.353274167f, 0.814129949f},
-std::array<float,2>{0.0200609881f, 0.426913887f},
-std::array<float,2>{0.731298685f, 0.568775356f},
-std::array<float,2>{0.564710259f, 0.294590473f},
-std::array<float,2>{0.151773572f, 0.71788317f},
-std::array<float,2>{0.396546751f, 0.0683123916f},
-std::array<float,2>{0.882069349f, 0.93657285f},
-std::array<float,2>{0.953988075f, 0.484140128f},
-std::array<float,2>{0.4701792f, 0.515625f},
-std::array<float,2>{0.201028571f, 0.181449279f},
-std::array<float,2>{0.54048425f, 0.772362828f},
-std::array<float,2>{0.671302736f, 0.011665646f},
-std::array<float,2>{0.0820240378f, 0.980793655f},
-std::array<float,2>{0.250300646f, 0.321658373f},
-std::array<float,2>{0.848280311f, 0.675379515f},
-std::array<float,2>{0.863406539f, 0.0357097723f},
-std::array<float,2>{0.266086102f, 0.968042076f},
-std::array<float,2>{0.063978903f, 0.374311447f},
-std::array<float,2>{0.676860988f, 0.625540018f},
-std::array<float,2>{0.552218556f, 0.467579871f},
-std::array<float,2>{0.21578151f, 0.555870473f},
-std::array<float,2>{0.494970083f, 0.135057285f},
-std::array<float,2>{0.939749897f, 0.786721587f},
-std::array<float,2>{0.895210862f, 0.270507574f},
-std::array<float,2>{0.378017247f, 0.726577163f},
-std::array<float,2>{0.140242815f, 0.118233316f},
-std::array<float,2>{0.582513928f, 0.903894901f},
-std::array<float,2>{0.748511314f, 0.20732829f},
-std::array<float,2>{0.0062870835f, 0.860154867f},
-std::array<float,2>{0.362135112f, 0.378991991f},
-std::array<float,2>{0.771734774f, 0.599944592f},
-std::array<float,2>{0.990900576f, 0.169979706f},
-std::array<float,2>{0.444782019f, 0.764298797f},
-std::array<float,2>{0.224942639f, 0.496570855f},
-std::array<float,2>{0.521957278f, 0.515476465f},
-std::array<float,2>{0.647542059f, 0.343646556f},
-std::array<float,2>{0.108870022f, 0.662502825f},
-std::array<float,2>{0.288114727f, 0.0235247258f},
-std::array<float,2>{0.843688667f, 0.99334234f},
-std::array<float,2>{0.787143826f, 0.416829377f},
-std::array<float,2>{0.338424712f, 0.5928002f},
-std::array<float,2>{0.0496798754f, 0.233374476f},
-std::array<float,2>{0.707177758f, 0.839575648f},
-std::array<float,2>{0.620287776f, 0.0926535055f},
-std::array<float,2>{0.160690129f, 0.90806216f},
-std::array<float,2>{0.424480021f, 0.307942241f},
-std::array<float,2>{0.915176272f, 0.687893987f},
-std::array<float,2>{0.947273672f, 0.01858522f},
-std::array<float,2>{0.491878361f, 0.989495814f},
-std::array<float,2>{0.208749175f, 0.329088688f},
-std::array<float,2>{0.56049329f, 0.670730412f},
-std::array<float,2>{0.679800749f, 0.48777616f},
-std::array<float,2>{0.0755486116f, 0.503473818f},
-std::array<float,2>{0.277177602f, 0.159474775f},
-std::array<float,2>{0.873700678f, 0.757300138f},
-std::array<float,2>{0.775022745f, 0.304252952f},
-std::array<float,2>{0.367736071f, 0.695822179f},
-std::array<float,2>{0.0142059326f, 0.0784166902f},
-std::array<float,2>{0.734872937f, 0.915226817f},
-std::array<float,2>{0.59030658f, 0.221534759f},
-std::array<float,2>{0.125519902f, 0.831287205f},
-std::array<float,2>{0.385696471f, 0.413155288f},
-std::array<float,2>{0.905515611f, 0.582243204f},
-std::array<float,2>{0.833590567f, 0.132002577f},
-std::array<float,2>{0.29228127f, 0.793125391f},
-std::array<float,2>{0.0958631933f, 0.457159489f},
-std::array<float,2>{0.653265119f, 0.553368568f},
-std::array<float,2>{0.52924943f, 0.36558786f},
-std::array<float,2>{0.22877945f, 0.633642852f},
-std::array<float,2>{0.451111615f, 0.046822466f},
-std::array<float,2>{0.99237299f, 0.957590699f},
-std::array<float,2>{0.911294758f, 0.384208977f},
-std::array<float,2>{0.436276078f, 0.603383541f},
-std::array<float,2>{0.166945472f, 0.215343505f},
-std::array<float,2>{0.616374254f, 0.867480457f},
-std::array<float,2>{0.713853478f, 0.112442434f},
-std::array<float,2>{0.0603948273f, 0.897536874f},
-std::array<float,2>{0.33030951f, 0.275942802f},
-std::array<float,2>{0.792088747f, 0.721277893f},
-std::array<float,2>{0.800096333f, 0.0744114891f},
-std::array<float,2>{0.322064459f, 0.926125884f},
-std::array<float,2>{0.0428972021f, 0.287799418f},
-std::array<float,2>{0.702268064f, 0.708647132f},
-std::array<float,2>{0.603674948f, 0.433437079f},
-std::array<float,2>{0.17339626f, 0.574731231f},
-std::array<float,2>{0.412109196f, 0.243392274f},
-std::array<float,2>{0.930360615f, 0.826636672f},
-std::array<float,2>{0.97325772f, 0.315216511f},
-std::array<float,2>{0.464030296f, 0.68596071f},
-std::array<float,2>{0.235801607f, 0.00599341094f},
-std::array<float,2>{0.514097273f, 0.974182844f},
-std::array<float,2>{0.638082385f, 0.177375257f},
-std::array<float,2>{0.116899416f, 0.779270649f},
-std::array<float,2>{0.297195017f, 0.473582923f},
-std::array<float,2>{0.819533885f, 0.526560068f},
-std::array<float,2>{0.883348823f, 0.189984962f},
-std::array<float,2>{0.401935339f, 0.851299644f},
-std::array<float,2>{0.144767866f, 0.398505151f},
-std::array<float,2>{0.573728323f, 0.618779361f},
-std::array<float,2>{0.724791169f, 0.251228541f},
-std::array<float,2>{0.0258214884f, 0.734939694f},
-std::array<float,2>{0.348228365f, 0.103162751f},
-std::array<float,2>{0.761585355f, 0.889111221f},
-std::array<float,2>{0.8565467f, 0.446671218f},
-std::array<float,2>{0.26134631f, 0.544595838f},
-std::array<float,2>{0.0877027214f, 0.142260537f},
-std::array<float,2>{0.656365573f, 0.802907944f},
-std::array<float,2>{0.53614819f, 0.0616219752f},
-std::array<float,2>{0.193371028f, 0.948841631f},
-std::array<float,2>{0.476656139f, 0.350663394f},
-std::array<float,2>{0.967937529f, 0.645693064f},
-std::array<float,2>{0.901018977f, 0.0532343611f},
-std::array<float,2>{0.388490528f, 0.941902161f},
-std::array<float,2>{0.13154535f, 0.358700931f},
-std::array<float,2>{0.589035094f, 0.653995275f},
-std::array<float,2>{0.741574049f, 0.445280194f},
-std::array<float,2>{0.00925778225f, 0.533832252f},
-std::array<float,2>{0.372650772f, 0.152509883f},
-std::array<float,2>{0.780681372f, 0.809320748f},
-std::array<float,2>{0.867196679f, 0.257812768f},
-std::array<float,2>{0.280063331f, 0.747189224f},
-std::array<float,2>{0.0712041855f, 0.0982641578f},
-std::array<float,2>{0.687379599f, 0.876249731f},
-std::array<float,2>{0.557809532f, 0.202783734f},
-std::array<float,2>{0.203806013f, 0.85900116f},
-std::array<float,2>{0.485775292f, 0.397686541f},
-std::array<float,2>{0.949436963f, 0.611280203f},
-std::array<float,2>{0.794294834f, 0.187395379f},
-std::array<float,2>{0.334828258f, 0.767173231f},
-std::array<float,2>{0.0583864637f, 0.479637772f},
-std::array<float,2>{0.717998624f, 0.522080421f},
-std::array<float,2>{0.610379159f, 0.326591432f},
-std::array<float,2>{0.168462321f, 0.678998649f},
-std::array<float,2>{0.431430072f, 0.0129482076f},
-std::array<float,2>{0.906345308f, 0.976997614f},
-std::array<float,2>{0.998629808f, 0.4219293f},
-std::array<float,2>{0.447219551f, 0.563059747f},
-std::array<float,2>{0.231290236f, 0.238862112f},
-std::array<float,2>{0.526246369f, 0.819887578f},
-std::array<float,2>{0.649270117f, 0.0635356084f},
-std::array<float,2>{0.100017741f, 0.93136555f},
-std::array<float,2>{0.294984609f, 0.290358305f},
-std::array<float,2>{0.830533385f, 0.713404238f},
-std::array<float,2>{0.814340949f, 0.121521078f},
-std::array<float,2>{0.304028541f, 0.899419904f},
-std::array<float,2>{0.111410253f, 0.268806934f},
-std::array<float,2>{0.633314908f, 0.733919322f},
-std::array<float,2>{0.50976938f, 0.376823872f},
-std::array<float,2>{0.239443839f, 0.595068395f},
-std::array<float,2>{0.467027873f, 0.206987381f},
-std::array<float,2>{0.972583294f, 0.864714384f},
-std::array<float,2>{0.935805261f, 0.367919028f},
-std::array<float,2>{0.406739473f, 0.629082143f},
-std::array<float,2>{0.178983584f, 0.0345733427f},
-std::array<float,2>{0.609166861f, 0.961629689f},
-std::array<float,2>{0.699008822f, 0.140563354f},
-std::array<float,2>{0.0441899598f, 0.781368434f},
-std::array<float,2>{0.326253802f, 0.464112103f},
-std::array<float,2>{0.801482141f, 0.559720516f},
-std::array<float,2>{0.963519156f, 0.228109509f},
-std::array<float,2>{0.48433575f, 0.840959132f},
-std::array<float,2>{0.189709678f, 0.420053601f},
-std::array<float,2>{0.532170236f, 0.589527547f},
-std::array<float,2>{0.660555303f, 0.309733301f},
-std::array<float,2>{0.0918180794f, 0.694358647f},
-std::array<float,2>{0.264864087f, 0.0871180519f},
-std::array<float,2>{0.85305047f, 0.913364172f},
-std::array<float,2>{0.763800442f, 0.494436085f},
-std::array<float,2>{0.346883565f, 0.508548021f},
-std::array<float,2>{0.0277594756f, 0.164153904f},
-std::array<float,2>{0.720426083f, 0.759079814f},
-std::array<float,2>{0.576735795f, 0.0287441835f},
-std::array<float,2>{0.141869023f, 0.997222304f},
-std::array<float,2>{0.404862165f, 0.337080568f},
-std::array<float,2>{0.889443934f, 0.659725547f},
-std::array<float,2>{0.981810987f, 0.0846020356f},
-std::array<float,2>{0.457713962f, 0.918040276f},
-std::array<float,2>{0.249886855f, 0.298976451f},
-std::array<float,2>{0.505429804f, 0.700141072f},
-std::array<float,2>{0.630284965f, 0.406481713f},
-std::array<float,2>{0.122493103f, 0.581778884f},
-std::array<float,2>{0.31111449f, 0.223174319f},
-std::array<float,2>{0.823260009f, 0.834857702f},
-std::array<float,2>{0.806896448f, 0.333825886f},
-std::array<float,2>{0.312947243f, 0.66709733f},
-std::array<float,2>{0.0376533344f, 0.0212028567f},
-std::array<float,2>{0.690779865f, 0.987973452f},
-std::array<float,2>{0.60138911f, 0.162769228f},
-std::array<float,2>{0.183159575f, 0.751082778f},
-std::array<float,2>{0.417095542f, 0.48957786f},
-std::array<float,2>{0.922288179f, 0.504904568f},
-std::array<float,2>{0.843805552f, 0.211583555f},
-std::array<float,2>{0.255018502f, 0.873650849f},
-std::array<float,2>{0.0858191699f, 0.389926702f},
-std::array<float,2>{0.665194869f, 0.60840553f},
-std::array<float,2>{0.543951094f, 0.279442012f},
-std::array<float,2>{0.19821094f, 0.723226666f},
-std::array<float,2>{0.472912252f, 0.116395444f},
-std::array<float,2>{0.958610177f, 0.89387399f},
-std::array<float,2>{0.876866519f, 0.455895275f},
-std::array<float,2>{0.394416928f, 0.55032593f},
-std::array<float,2>{0.156037092f, 0.126296937f},
-std::array<float,2>{0.56720531f, 0.790314436f},
-std::array<float,2>{0.72882247f, 0.0407214612f},
-std::array<float,2>{0.0174121894f, 0.953729689f},
-std::array<float,2>{0.356427699f, 0.360405207f},
-std::array<float,2>{0.752857745f, 0.636960328f},
-std::array<float,2>{0.766202748f, 0.00257490342f},
-std::array<float,2>{0.364360213f, 0.969097674f},
-std::array<float,2>{0.00129569403f, 0.318172753f},
-std::array<float,2>{0.742337704f, 0.681588113f},
-std::array<float,2>{0.580222905f, 0.46900329f},
-std::array<float,2>{0.133009508f, 0.530146956f},
-std::array<float,2>{0.381522596f, 0.17490986f},
-std::array<float,2>{0.892918169f, 0.774193883f},
-std::array<float,2>{0.943601966f, 0.28152889f},
-std::array<float,2>{0.497044474f, 0.703554034f},
-std::array<float,2>{0.213413864f, 0.0717873797f},
-std::array<float,2>{0.547404766f, 0.923888743f},
-std::array<float,2>{0.673655152f, 0.247359827f},
-std::array<float,2>{0.0676333457f, 0.824011862f},
-std::array<float,2>{0.270066202f, 0.43605873f},
-std::array<float,2>{0.859394073f, 0.57145524f},
-std::array<float,2>{0.919326901f, 0.145064533f},
-std::array<float,2>{0.428170025f, 0.798499227f},
-std::array<float,2>{0.158917964f, 0.453065157f},
-std::array<float,2>{0.624792874f, 0.542487621f},
-std::array<float,2>{0.704409361f, 0.34690401f},
-std::array<float,2>{0.0532035306f, 0.641526222f},
-std::array<float,2>{0.340106755f, 0.0583392493f},
-std::array<float,2>{0.782496512f, 0.952817321f},
-std::array<float,2>{0.839327991f, 0.403379709f},
-std::array<float,2>{0.284843266f, 0.621798098f},
-std::array<float,2>{0.105434202f, 0.195164397f},
-std::array<float,2>{0.642977238f, 0.847593546f},
-std::array<float,2>{0.516090989f, 0.106878236f},
-std::array<float,2>{0.222033486f, 0.8845855f},
-std::array<float,2>{0.440297544f, 0.25399068f},
-std::array<float,2>{0.988095343f, 0.740545034f},
-std::array<float,2>{0.897089362f, 0.117234096f},
-std::array<float,2>{0.376500428f, 0.902464151f},
-std::array<float,2>{0.138627276f, 0.27110669f},
-std::array<float,2>{0.585119605f, 0.72770083f},
-std::array<float,2>{0.74659735f, 0.380017638f},
-std::array<float,2>{0.00514435209f, 0.6011222f},
-std::array<float,2>{0.35989356f, 0.208169222f},
-std::array<float,2>{0.770469546f, 0.860747576f},
-std::array<float,2>{0.866944909f, 0.373301148f},
-std::array<float,2>{0.268447518f, 0.626736701f},
-std::array<float,2>{0.0652289838f, 0.0370202623f},
-std::array<float,2>{0.677830517f, 0.967445254f},
-std::array<float,2>{0.552766621f, 0.136169419f},
-std::array<float,2>{0.217763245f, 0.785656929f},
-std::array<float,2>{0.493587494f, 0.468191981f},
-std::array<float,2>{0.938885927f, 0.555229723f},
-std::array<float,2>{0.786749005f, 0.233811185f},
-std::array<float,2>{0.337700784f, 0.838598371f},
-std::array<float,2>{0.0479506031f, 0.417844445f},
-std::array<float,2>{0.709234178f, 0.591809928f},
-std::array<float,2>{0.61900562f, 0.306678921f},
-std::array<float,2>{0.162825197f, 0.689347029f},
-std::array<float,2>{0.421937793f, 0.0933151022f},
-std::array<float,2>{0.916107833f, 0.907200217f},
-std::array<float,2>{0.98999691f, 0.497326225f},
-std::array<float,2>{0.441680312f, 0.514295876f},
-std::array<float,2>{0.223629937f, 0.171062231f},
-std::array<float,2>{0.52118355f, 0.765238702f},
-std::array<float,2>{0.645720601f, 0.025151521f},
-std::array<float,2>{0.106683716f, 0.992314696f},
-std::array<float,2>{0.285896391f, 0.34215948f},
-std::array<float,2>{0.840774357f, 0.66341579f},
-std::array<float,2>{0.825606883f, 0.0490350761f},
-std::array<float,2>{0.305009365f, 0.941366732f},
-std::array<float,2>{0.119688213f, 0.354475796f},
-std::array<float,2>{0.628575861f, 0.652315855f},
-std::array<float,2>{0.501172662f, 0.437565029f},
-std::array<float,2>{0.245646432f, 0.538069725f},
-std::array<float,2>{0.456248462f, 0.152016774f},
-std::array<float,2>{0.979240537f, 0.805721045f},
-std::array<float,2>{0.92629832f, 0.261961401f},
-std::array<float,2>{0.418536693f, 0.745677352f},
-std::array<float,2>{0.186411321f, 0.0941661f},
-std::array<float,2>{0.596531153f, 0.879388392f},
-std::array<float,2>{0.692904949f, 0.196233541f},
-std::array<float,2>{0.0326327942f, 0.853506386f},
-std::array<float,2>{0.317160457f, 0.392008811f},
-std::array<float,2>{0.811087549f, 0.614830375f},
-std::array<float,2>{0.956357479f, 0.179975852f},
-std::array<float,2>{0.471105695f, 0.77327472f},
-std::array<float,2>{0.201870263f, 0.483339339f},
-std::array<float,2>{0.542516351f, 0.517190456f},
-std::array<float,2>{0.669839978f, 0.32055667f},
-std::array<float,2>{0.0781366378f, 0.674395859f},
-std::array<float,2>{0.253658414f, 0.0105434489f},
-std::array<float,2>{0.849698067f, 0.981846452f},
-std::array<float,2>{0.7547822f, 0.426150739f},
-std::array<float,2>{0.354866385f, 0.570207357f},
-std::array<float,2>{0.0223309938f, 0.2371279f},
-std::array<float,2>{0.733625889f, 0.812597811f},
-std::array<float,2>{0.562968969f, 0.0668473244f},
-std::array<float,2>{0.148597851f, 0.936330557f},
-std::array<float,2>{0.3951855f, 0.293537378f},
-std::array<float,2>{0.878974438f, 0.717143655f},
-std::array<float,2>{0.974646032f, 0.00685984874f},
-std::array<float,2>{0.462010533f, 0.972696483f},
-std::array<float,2>{0.237091452f, 0.315510035f},
-std::array<float,2>{0.512314618f, 0.686662197f},
-std::array<float,2>{0.640355051f, 0.474069417f},
-std::array<float,2>{0.114213429f, 0.526149273f},
-std::array<float,2>{0.300559729f, 0.176409483f},
-std::array<float,2>{0.81804949f, 0.778310537f},
-std::array<float,2>{0.797391474f, 0.288941562f},
-std::array<float,2>{0.323185086f, 0.707334518f},
-std::array<float,2>{0.0401380025f, 0.0758492947f},
-std::array<float,2>{0.700401843f, 0.927152932f},
-std::array<float,2>{0.602042615f, 0.242920518f},
-std::array<float,2>{0.175584719f, 0.827873409f},
-std::array<float,2>{0.412927687f, 0.431956232f},
-std::array<float,2>{0.93322736f, 0.575512588f},
-std::array<float,2>{0.858802319f, 0.141250789f},
-std::array<float,2>{0.259381831f, 0.804538667f},
-std::array<float,2>{0.0890950188f, 0.445549935f},
-std::array<float,2>{0.658789456f, 0.543726861f},
-std::array<float,2>{0.537114203f, 0.349679947f},
-std::array<float,2>{0.192523107f, 0.644702137f},
-std::array<float,2>{0.479151845f, 0.0608659089f},
-std::array<float,2>{0.966074824f, 0.947842836f},
-std::array<float,2>{0.88476789f, 0.399589092f},
-std::array<float,2>{0.399475724f, 0.617737591f},
-std::array<float,2>{0.147307098f, 0.191120371f},
-std::array<float,2>{0.571113348f, 0.849938333f},
-std::array<float,2>{0.723724782f, 0.101890296f},
-std::array<float,2>{0.0239968058f, 0.890391409f},
-std::array<float,2>{0.349622369f, 0.25051856f},
-std::array<float,2>{0.758351743f, 0.735818207f},
-std::array<float,2>{0.77662605f, 0.0791251585f},
-std::array<float,2>{0.370230824f, 0.91464144f},
-std::array<float,2>{0.0133471284f, 0.302991748f},
-std::array<float,2>{0.738115251f, 0.696950436f},
-std::array<float,2>{0.593394876f, 0.412732273f},
-std::array<float,2>{0.127619028f, 0.583396912f},
-std::array<float,2>{0.383698732f, 0.222056016f},
-std::array<float,2>{0.902629197f, 0.830586374f},
-std::array<float,2>{0.946618557f, 0.329241306f},
-std::array<float,2>{0.488536477f, 0.671006441f},
-std::array<float,2>{0.210669324f, 0.0184598882f},
-std::array<float,2>{0.561116338f, 0.988713861f},
-std::array<float,2>{0.683577538f, 0.158691943f},
-std::array<float,2>{0.0762302652f, 0.756094515f},
-std::array<float,2>{0.274169683f, 0.486979991f},
-std::array<float,2>{0.871155083f, 0.502135158f},
-std::array<float,2>{0.913352013f, 0.215981588f},
-std::array<float,2>{0.434379697f, 0.868806124f},
-std::array<float,2>{0.164225981f, 0.383488536f},
-std::array<float,2>{0.614836931f, 0.602380633f},
-std::array<float,2>{0.711570978f, 0.276771218f},
-std::array<float,2>{0.061835371f, 0.721683979f},
-std::array<float,2>{0.329994977f, 0.112076923f},
-std::array<float,2>{0.789605796f, 0.896703124f},
-std::array<float,2>{0.835802257f, 0.458150238f},
-std::array<float,2>{0.290311575f, 0.554016531f},
-std::array<float,2>{0.0949015021f, 0.131277516f},
-std::array<float,2>{0.654903114f, 0.794820786f},
-std::array<float,2>{0.529811025f, 0.045896709f},
-std::array<float,2>{0.228247106f, 0.958072424f},
-std::array<float,2>{0.452757657f, 0.366293341f},
-std::array<float,2>{0.994980216f, 0.633928418f},
-std::array<float,2>{0.934410632f, 0.0337926857f},
-std::array<float,2>{0.408236861f, 0.962167919f},
-std::array<float,2>{0.176665917f, 0.368695229f},
-std::array<float,2>{0.60699451f, 0.630220711f},
-std::array<float,2>{0.697147131f, 0.46319586f},
-std::array<float,2>{0.0468348823f, 0.558872402f},
-std::array<float,2>{0.325392246f, 0.139173895f},
-std::array<float,2>{0.804254353f, 0.782849371f},
-std::array<float,2>{0.8151474f, 0.268380046f},
-std::array<float,2>{0.301745117f, 0.733301759f},
-std::array<float,2>{0.109738931f, 0.122827262f},
-std::array<float,2>{0.635270059f, 0.898519278f},
-std::array<float,2>{0.509764731f, 0.205245033f},
-std::array<float,2>{0.240297586f, 0.864228547f},
-std::array<float,2>{0.465261906f, 0.375392944f},
-std::array<float,2>{0.970408022f, 0.594646275f},
-std::array<float,2>{0.762804389f, 0.165533438f},
-std::array<float,2>{0.345521063f, 0.758332789f},
-std::array<float,2>{0.0296439342f, 0.495262593f},
-std::array<float,2>{0.721520662f, 0.50919354f},
-std::array<float,2>{0.575582206f, 0.336626381f},
-std::array<float,2>{0.144206539f, 0.65890497f},
-std::array<float,2>{0.403230101f, 0.0273689982f},
-std::array<float,2>{0.888113081f, 0.996391594f},
-std::array<float,2>{0.961032629f, 0.421353191f},
-std::array<float,2>{0.482214272f, 0.588115215f},
-std::array<float,2>{0.188018441f, 0.227003515f},
-std::array<float,2>{0.53338933f, 0.840551138f},
-std::array<float,2>{0.662320375f, 0.0861942917f},
-std::array<float,2>{0.0912277326f, 0.912707806f},
-std::array<float,2>{0.262994945f, 0.309287876f},
-std::array<float,2>{0.853624821f, 0.693833351f},
-std::array<float,2>{0.869744241f, 0.0995675698f},
-std::array<float,2>{0.279086351f, 0.875472248f},
-std::array<float,2>{0.0734173879f, 0.259315461f},
-std::array<float,2>{0.683829784f, 0.746392906f},
-std::array<float,2>{0.556540728f, 0.397435099f},
-std::array<float,2>{0.206810027f, 0.61005044f},
-std::array<float,2>{0.486995429f, 0.201773494f},
-std::array<float,2>{0.952656925f, 0.857426524f},
-std::array<float,2>{0.899392664f, 0.358373225f},
-std::array<float,2>{0.390142441f, 0.653037667f},
-std::array<float,2>{0.129067302f, 0.0543442406f},
-std::array<float,2>{0.586937964f, 0.943023682f},
-std::array<float,2>{0.739012837f, 0.153937414f},
-std::array<float,2>{0.010062743f, 0.809934139f},
-std::array<float,2>{0.373155206f, 0.444270134f},
-std::array<float,2>{0.779006958f, 0.534276009f},
-std::array<float,2>{0.996715724f, 0.240230829f},
-std::array<float,2>{0.448542178f, 0.819250166f},
-std::array<float,2>{0.234012797f, 0.423481435f},
-std::array<float,2>{0.523437619f, 0.564341247f},
-std::array<float,2>{0.650608599f, 0.289340079f},
-std::array<float,2>{0.099429138f, 0.713895619f},
-std::array<float,2>{0.293091714f, 0.0627841353f},
-std::array<float,2>{0.830034614f, 0.929902017f},
-std::array<float,2>{0.795431912f, 0.479482025f},
-std::array<float,2>{0.333286852f, 0.522530794f},
-std::array<float,2>{0.0552165024f, 0.186239213f},
-std::array<float,2>{0.715986431f, 0.765910685f},
-std::array<float,2>{0.613086164f, 0.0123658367f},
-std::array<float,2>{0.170134187f, 0.978298247f},
-std::array<float,2>{0.432545483f, 0.327723831f},
-std::array<float,2>{0.908288479f, 0.678443253f},
-std::array<float,2>{0.942439735f, 0.0709103495f},
-std::array<float,2>{0.498479903f, 0.925453186f},
-std::array<float,2>{0.211934924f, 0.282605141f},
-std::array<float,2>{0.549759805f, 0.704761803f},
-std::array<float,2>{0.674019992f, 0.437146783f},
-std::array<float,2>{0.0684991777f, 0.571222007f},
-std::array<float,2>{0.272940218f, 0.246377364f},
-std::array<float,2>{0.862046182f, 0.822617412f},
-std::array<float,2>{0.768845975f, 0.31686306f},
-std::array<float,2>{0.366355628f, 0.680658817f},
-std::array<float,2>{0.00203083758f, 0.00367747387f},
-std::array<float,2>{0.744743168f, 0.969874799f},
-std::array<float,2>{0.578962028f, 0.174710914f},
-std::array<float,2>{0.136555582f, 0.775114655f},
-std::array<float,2>{0.379844755f, 0.470502555f},
-std::array<float,2>{0.891960561f, 0.531230092f},
-std::array<float,2>{0.837827146f, 0.193900019f},
-std::array<float,2>{0.282861292f, 0.846462309f},
-std::array<float,2>{0.103178777f, 0.403264403f},
-std::array<float,2>{0.642026424f, 0.622828782f},
-std::array<float,2>{0.518980086f, 0.255210519f},
-std::array<float,2>{0.219390586f, 0.741654336f},
-std::array<float,2>{0.438834071f, 0.106215112f},
-std::array<float,2>{0.986037254f, 0.883121371f},
-std::array<float,2>{0.92118001f, 0.451670527f},
-std::array<float,2>{0.426726967f, 0.54149586f},
-std::array<float,2>{0.157112479f, 0.145744428f},
-std::array<float,2>{0.622926593f, 0.797166944f},
-std::array<float,2>{0.705372632f, 0.05719769f},
-std::array<float,2>{0.0526821874f, 0.952047348f},
-std::array<float,2>{0.343205363f, 0.346188873f},
-std::array<float,2>{0.78356123f, 0.642313242f},
-std::array<float,2>{0.805183768f, 0.0196304582f},
-std::array<float,2>{0.314688414f, 0.986615777f},
-std::array<float,2>{0.0360056311f, 0.332596958f},
-std::array<float,2>{0.688972831f, 0.66690135f},
-std::array<float,2>{0.598123431f, 0.488879383f},
-std::array<float,2>{0.181497976f, 0.504217386f},
-std::array<float,2>{0.414657265f, 0.163790405f},
-std::array<float,2>{0.924932659f, 0.750136495f},
-std::array<float,2>{0.983853161f, 0.300506741f},
-std::array<float,2>{0.459457487f, 0.700982332f},
-std::array<float,2>{0.246997342f, 0.0854282901f},
-std::array<float,2>{0.507801235f, 0.919321716f},
-std::array<float,2>{0.63140291f, 0.224375173f},
-std::array<float,2>{0.123262659f, 0.835528851f},
-std::array<float,2>{0.309238821f, 0.407670587f},
-std::array<float,2>{0.820532739f, 0.580312192f},
-std::array<float,2>{0.878863275f, 0.12506035f},
-std::array<float,2>{0.391346931f, 0.789562345f},
-std::array<float,2>{0.154027417f, 0.456711799f},
-std::array<float,2>{0.56842047f, 0.549021006f},
-std::array<float,2>{0.727904975f, 0.359832436f},
-std::array<float,2>{0.0177147817f, 0.63790381f},
-std::array<float,2>{0.357949793f, 0.040017575f},
-std::array<float,2>{0.751664519f, 0.954723716f},
-std::array<float,2>{0.846495271f, 0.388929665f},
-std::array<float,2>{0.257100552f, 0.6078704f},
-std::array<float,2>{0.0830892175f, 0.212468505f},
-std::array<float,2>{0.666327298f, 0.874605f},
-std::array<float,2>{0.546513855f, 0.115296602f},
-std::array<float,2>{0.196969658f, 0.893122494f},
-std::array<float,2>{0.475882411f, 0.280548453f},
-std::array<float,2>{0.960209608f, 0.723840833f},
-std::array<float,2>{0.914690316f, 0.0912093818f},
-std::array<float,2>{0.424868435f, 0.908724785f},
-std::array<float,2>{0.161393464f, 0.306031287f},
-std::array<float,2>{0.619590104f, 0.690493703f},
-std::array<float,2>{0.708400309f, 0.414735168f},
-std::array<float,2>{0.0507764742f, 0.59099865f},
-std::array<float,2>{0.339598447f, 0.232407495f},
-std::array<float,2>{0.788110316f, 0.837561488f},
-std::array<float,2>{0.842282832f, 0.340904862f},
-std::array<float,2>{0.287965447f, 0.661114454f},
-std::array<float,2>{0.107694604f, 0.0254841167f},
-std::array<float,2>{0.646993935f, 0.99426496f},
-std::array<float,2>{0.522952795f, 0.169902787f},
-std::array<float,2>{0.22619155f, 0.762526095f},
-std::array<float,2>{0.443465412f, 0.498094857f},
-std::array<float,2>{0.992058754f, 0.512275755f},
-std::array<float,2>{0.773428917f, 0.209746435f},
-std::array<float,2>{0.363018811f, 0.861362636f},
-std::array<float,2>{0.0077410643f, 0.382285982f},
-std::array<float,2>{0.749069989f, 0.597893775f},
-std::array<float,2>{0.583874702f, 0.272916615f},
-std::array<float,2>{0.13895157f, 0.729760885f},
-std::array<float,2>{0.377544314f, 0.119943149f},
-std::array<float,2>{0.896117926f, 0.906229019f},
-std::array<float,2>{0.941116691f, 0.465224862f},
-std::array<float,2>{0.495858788f, 0.5573107f},
-std::array<float,2>{0.216244355f, 0.133198589f},
-std::array<float,2>{0.550938308f, 0.787694037f},
-std::array<float,2>{0.676635742f, 0.0384829864f},
-std::array<float,2>{0.0634495094f, 0.965909183f},
-std::array<float,2>{0.267382264f, 0.372513771f},
-std::array<float,2>{0.864367604f, 0.628785193f},
-std::array<float,2>{0.848779559f, 0.00787681062f},
-std::array<float,2>{0.251621664f, 0.983558476f},
-std::array<float,2>{0.0800920576f, 0.322302788f},
-std::array<float,2>{0.670573771f, 0.673532009f},
-std::array<float,2>{0.539920509f, 0.482366085f},
-std::array<float,2>{0.199612975f, 0.518127263f},
-std::array<float,2>{0.469421059f, 0.181961045f},
-std::array<float,2>{0.954423249f, 0.770751476f},
-std::array<float,2>{0.881091774f, 0.296176314f},
-std::array<float,2>{0.398225307f, 0.714978397f},
-std::array<float,2>{0.150727347f, 0.0695017129f},
-std::array<float,2>{0.565630734f, 0.933819234f},
-std::array<float,2>{0.732021332f, 0.235689372f},
-std::array<float,2>{0.020625582f, 0.816012323f},
-std::array<float,2>{0.351702005f, 0.4282161f},
-std::array<float,2>{0.756248534f, 0.568345487f},
-std::array<float,2>{0.977760732f, 0.148547783f},
-std::array<float,2>{0.453748316f, 0.807845473f},
-std::array<float,2>{0.243265867f, 0.441222161f},
-std::array<float,2>{0.503063083f, 0.53671217f},
-std::array<float,2>{0.626703799f, 0.352365643f},
-std::array<float,2>{0.117338367f, 0.650170088f},
-std::array<float,2>{0.307847887f, 0.0468963869f},
-std::array<float,2>{0.82665962f, 0.937611401f},
-std::array<float,2>{0.810377121f, 0.394438416f},
-std::array<float,2>{0.31986481f, 0.616046309f},
-std::array<float,2>{0.0351164639f, 0.19921039f},
-std::array<float,2>{0.694776773f, 0.855171978f},
-std::array<float,2>{0.595281363f, 0.0961100385f},
-std::array<float,2>{0.184444427f, 0.880947411f},
-std::array<float,2>{0.420515031f, 0.264008433f},
-std::array<float,2>{0.929150522f, 0.743969202f},
-std::array<float,2>{0.966990232f, 0.0594214909f},
-std::array<float,2>{0.47758159f, 0.945566654f},
-std::array<float,2>{0.194932118f, 0.347661912f},
-std::array<float,2>{0.535698116f, 0.648094833f},
-std::array<float,2>{0.65765202f, 0.447769105f},
-std::array<float,2>{0.0862628445f, 0.545284569f},
-std::array<float,2>{0.260590255f, 0.143617257f},
-std::array<float,2>{0.856286526f, 0.802355647f},
-std::array<float,2>{0.759992421f, 0.252263963f},
-std::array<float,2>{0.349321753f, 0.737377524f},
-std::array<float,2>{0.0268463213f, 0.10514202f},
-std::array<float,2>{0.726219237f, 0.88830626f},
-std::array<float,2>{0.573166311f, 0.188629463f},
-std::array<float,2>{0.145813882f, 0.849483252f},
-std::array<float,2>{0.400549293f, 0.401880294f},
-std::array<float,2>{0.884085536f, 0.619714022f},
-std::array<float,2>{0.819194913f, 0.178559139f},
-std::array<float,2>{0.298580498f, 0.780802906f},
-std::array<float,2>{0.116070174f, 0.476470441f},
-std::array<float,2>{0.637194872f, 0.523927212f},
-std::array<float,2>{0.515278637f, 0.313058615f},
-std::array<float,2>{0.234722525f, 0.683686376f},
-std::array<float,2>{0.46324718f, 0.00488951942f},
-std::array<float,2>{0.974221706f, 0.974941492f},
-std::array<float,2>{0.930933177f, 0.430561274f},
-std::array<float,2>{0.410742491f, 0.578024209f},
-std::array<float,2>{0.172638312f, 0.24541381f},
-std::array<float,2>{0.604984939f, 0.825287759f},
-std::array<float,2>{0.701510072f, 0.0774997324f},
-std::array<float,2>{0.0419359133f, 0.92778182f},
-std::array<float,2>{0.320578039f, 0.285804421f},
-std::array<float,2>{0.799585938f, 0.710596859f},
-std::array<float,2>{0.79167521f, 0.111171164f},
-std::array<float,2>{0.331229985f, 0.894590139f},
-std::array<float,2>{0.0595678128f, 0.274583429f},
-std::array<float,2>{0.714511335f, 0.719899714f},
-std::array<float,2>{0.615610421f, 0.385560572f},
-std::array<float,2>{0.167297289f, 0.605198503f},
-std::array<float,2>{0.437377304f, 0.216873258f},
-std::array<float,2>{0.910724938f, 0.870102644f},
-std::array<float,2>{0.993190944f, 0.363852352f},
-std::array<float,2>{0.449863762f, 0.635890126f},
-std::array<float,2>{0.230105832f, 0.0446591564f},
-std::array<float,2>{0.527388155f, 0.960723221f},
-std::array<float,2>{0.654172003f, 0.130672783f},
-std::array<float,2>{0.0972929671f, 0.795928061f},
-std::array<float,2>{0.291742712f, 0.459454894f},
-std::array<float,2>{0.832277715f, 0.551316619f},
-std::array<float,2>{0.904395759f, 0.220612779f},
-std::array<float,2>{0.385895848f, 0.828614056f},
-std::array<float,2>{0.126873791f, 0.410652161f},
-std::array<float,2>{0.591588974f, 0.58457917f},
-std::array<float,2>{0.735654414f, 0.302612364f},
-std::array<float,2>{0.0149679855f, 0.697515488f},
-std::array<float,2>{0.368759453f, 0.080359377f},
-std::array<float,2>{0.773440003f, 0.917222023f},
-std::array<float,2>{0.874605119f, 0.485000938f},
-std::array<float,2>{0.275494635f, 0.501345038f},
-std::array<float,2>{0.0747784078f, 0.157005236f},
-std::array<float,2>{0.680691123f, 0.754402757f},
-std::array<float,2>{0.559079587f, 0.016927423f},
-std::array<float,2>{0.207759216f, 0.991830647f},
-std::array<float,2>{0.490582734f, 0.331047893f},
-std::array<float,2>{0.948896348f, 0.669416845f},
-std::array<float,2>{0.890402973f, 0.030394977f},
-std::array<float,2>{0.40559864f, 0.998517692f},
-std::array<float,2>{0.141562283f, 0.339510351f},
-std::array<float,2>{0.577696204f, 0.656503856f},
-std::array<float,2>{0.719711304f, 0.49255079f},
-std::array<float,2>{0.0290942956f, 0.510123253f},
-std::array<float,2>{0.34574306f, 0.167493582f},
-std::array<float,2>{0.764729798f, 0.759889424f},
-std::array<float,2>{0.852161229f, 0.310869157f},
-std::array<float,2>{0.263817549f, 0.692840338f},
-std::array<float,2>{0.0928069875f, 0.0880434215f},
-std::array<float,2>{0.661962986f, 0.911453426f},
-std::array<float,2>{0.533027947f, 0.229888931f},
-std::array<float,2>{0.190479681f, 0.84244585f},
-std::array<float,2>{0.483288527f, 0.418697357f},
-std::array<float,2>{0.964118838f, 0.586273551f},
-std::array<float,2>{0.802079141f, 0.138264909f},
-std::array<float,2>{0.327511579f, 0.783413887f},
-std::array<float,2>{0.0430441611f, 0.461269349f},
-std::array<float,2>{0.697633445f, 0.561981618f},
-std::array<float,2>{0.607737839f, 0.370049655f},
-std::array<float,2>{0.177963525f, 0.631788611f},
-std::array<float,2>{0.40808019f, 0.0316818133f},
-std::array<float,2>{0.937300384f, 0.964046478f},
-std::array<float,2>{0.971500278f, 0.377774596f},
-std::array<float,2>{0.468027383f, 0.597309709f},
-std::array<float,2>{0.238757297f, 0.204119131f},
-std::array<float,2>{0.51136452f, 0.866806686f},
-std::array<float,2>{0.634024441f, 0.123127498f},
-std::array<float,2>{0.112644479f, 0.902143061f},
-std::array<float,2>{0.302906573f, 0.266946942f},
-std::array<float,2>{0.81276077f, 0.730730414f},
-std::array<float,2>{0.831281424f, 0.0651273429f},
-std::array<float,2>{0.296489865f, 0.932757437f},
-std::array<float,2>{0.10071303f, 0.292801917f},
-std::array<float,2>{0.650113046f, 0.711541831f},
-std::array<float,2>{0.527340591f, 0.425246179f},
-std::array<float,2>{0.2324083f, 0.56557709f},
-std::array<float,2>{0.445957184f, 0.242010921f},
-std::array<float,2>{0.999163806f, 0.817721248f},
-std::array<float,2>{0.907967508f, 0.325354218f},
-std::array<float,2>{0.43002668f, 0.676081061f},
-std::array<float,2>{0.169404536f, 0.0152259404f},
-std::array<float,2>{0.610002756f, 0.979757249f},
-std::array<float,2>{0.716817677f, 0.185261965f},
-std::array<float,2>{0.0571952797f, 0.76851958f},
-std::array<float,2>{0.335208207f, 0.477048725f},
-std::array<float,2>{0.793889999f, 0.52033031f},
-std::array<float,2>{0.951119184f, 0.200015768f},
-std::array<float,2>{0.484856248f, 0.857201755f},
-std::array<float,2>{0.204961568f, 0.394901961f},
-std::array<float,2>{0.556835651f, 0.612321019f},
-std::array<float,2>{0.685728371f, 0.259858817f},
-std::array<float,2>{0.0720211491f, 0.748609781f},
-std::array<float,2>{0.281106621f, 0.101155914f},
-std::array<float,2>{0.868540823f, 0.877241552f},
-std::array<float,2>{0.779626906f, 0.441896945f},
-std::array<float,2>{0.371573091f, 0.531986356f},
-std::array<float,2>{0.00853714906f, 0.15522036f},
-std::array<float,2>{0.740266442f, 0.812486529f},
-std::array<float,2>{0.588785768f, 0.0521223098f},
-std::array<float,2>{0.132091045f, 0.944943011f},
-std::array<float,2>{0.3876068f, 0.355861545f},
-std::array<float,2>{0.901879728f, 0.655903459f},
-std::array<float,2>{0.986960292f, 0.108119495f},
-std::array<float,2>{0.441076577f, 0.886601627f},
-std::array<float,2>{0.221193135f, 0.257123351f},
-std::array<float,2>{0.517453432f, 0.739893138f},
-std::array<float,2>{0.644191504f, 0.406114519f},
-std::array<float,2>{0.104215503f, 0.623790264f},
-std::array<float,2>{0.283800066f, 0.193035141f},
-std::array<float,2>{0.838074028f, 0.845119536f},
-std::array<float,2>{0.781982958f, 0.34549427f},
-std::array<float,2>{0.341711968f, 0.643426239f},
-std::array<float,2>{0.0539629795f, 0.0558103174f},
-std::array<float,2>{0.703702986f, 0.949762225f},
-std::array<float,2>{0.623312354f, 0.147545457f},
-std::array<float,2>{0.159293264f, 0.799684346f},
-std::array<float,2>{0.429660916f, 0.449614346f},
-std::array<float,2>{0.918250799f, 0.540017486f},
-std::array<float,2>{0.861229956f, 0.24830243f},
-std::array<float,2>{0.271426648f, 0.820706964f},
-std::array<float,2>{0.0668108612f, 0.434516996f},
-std::array<float,2>{0.672408342f, 0.574024498f},
-std::array<float,2>{0.547975123f, 0.283925384f},
-std::array<float,2>{0.213915527f, 0.706632257f},
-std::array<float,2>{0.497401386f, 0.0741671771f},
-std::array<float,2>{0.944959223f, 0.923326194f},
-std::array<float,2>{0.894211829f, 0.470774621f},
-std::array<float,2>{0.381861627f, 0.529240668f},
-std::array<float,2>{0.133794576f, 0.173742965f},
-std::array<float,2>{0.581171632f, 0.77591604f},
-std::array<float,2>{0.744055808f, 0.00166170404f},
-std::array<float,2>{4.99742164e-05f, 0.972489357f},
-std::array<float,2>{0.364025891f, 0.319972813f},
-std::array<float,2>{0.766838849f, 0.683058619f},
-std::array<float,2>{0.75295347f, 0.0416641943f},
-std::array<float,2>{0.357014507f, 0.955564678f},
-std::array<float,2>{0.0165378507f, 0.361568838f},
-std::array<float,2>{0.730334282f, 0.638816774f},
-std::array<float,2>{0.567489147f, 0.453541756f},
-std::array<float,2>{0.154821932f, 0.548533499f},
-std::array<float,2>{0.393105805f, 0.12845926f},
-std::array<float,2>{0.875128567f, 0.791093826f},
-std::array<float,2>{0.957073033f, 0.278396308f},
-std::array<float,2>{0.474418193f, 0.726307631f},
-std::array<float,2>{0.199116066f, 0.114770815f},
-std::array<float,2>{0.543698311f, 0.890708387f},
-std::array<float,2>{0.664530337f, 0.212911084f},
-std::array<float,2>{0.0845353901f, 0.872703493f},
-std::array<float,2>{0.253909945f, 0.388579011f},
-std::array<float,2>{0.845235825f, 0.605958462f},
-std::array<float,2>{0.923737347f, 0.161482304f},
-std::array<float,2>{0.416644037f, 0.753902733f},
-std::array<float,2>{0.182192624f, 0.491288275f},
-std::array<float,2>{0.599936306f, 0.506265461f},
-std::array<float,2>{0.690310955f, 0.334796399f},
-std::array<float,2>{0.0381533764f, 0.665010512f},
-std::array<float,2>{0.313563347f, 0.0229139496f},
-std::array<float,2>{0.807880938f, 0.984766126f},
-std::array<float,2>{0.822950661f, 0.409159303f},
-std::array<float,2>{0.312280357f, 0.57947588f},
-std::array<float,2>{0.121530943f, 0.226224944f},
-std::array<float,2>{0.62947005f, 0.832822204f},
-std::array<float,2>{0.504547894f, 0.0831757262f},
-std::array<float,2>{0.248232424f, 0.920410633f},
-std::array<float,2>{0.4588736f, 0.297672659f},
-std::array<float,2>{0.980764151f, 0.701855302f},
-std::array<float,2>{0.89170742f, 0.0729974061f},
-std::array<float,2>{0.379453748f, 0.922327995f},
-std::array<float,2>{0.136243194f, 0.285134554f},
-std::array<float,2>{0.578802168f, 0.705603659f},
-std::array<float,2>{0.74493897f, 0.435092628f},
-std::array<float,2>{0.00229367893f, 0.572443485f},
-std::array<float,2>{0.36669454f, 0.249129593f},
-std::array<float,2>{0.76865077f, 0.821832478f},
-std::array<float,2>{0.862239063f, 0.318949431f},
-std::array<float,2>{0.272513479f, 0.682587802f},
-std::array<float,2>{0.0687691197f, 0.000960232224f},
-std::array<float,2>{0.674284458f, 0.971413195f},
-std::array<float,2>{0.549335539f, 0.171983644f},
-std::array<float,2>{0.21228835f, 0.776843071f},
-std::array<float,2>{0.498224407f, 0.472124904f},
-std::array<float,2>{0.942796648f, 0.52767086f},
-std::array<float,2>{0.783367097f, 0.191748351f},
-std::array<float,2>{0.342873394f, 0.844485283f},
-std::array<float,2>{0.052321665f, 0.4048751f},
-std::array<float,2>{0.705085516f, 0.624959409f},
-std::array<float,2>{0.622572541f, 0.256051958f},
-std::array<float,2>{0.156783685f, 0.738893867f},
-std::array<float,2>{0.426466376f, 0.109262459f},
-std::array<float,2>{0.921028256f, 0.88517499f},
-std::array<float,2>{0.986283422f, 0.450587332f},
-std::array<float,2>{0.438573897f, 0.540580451f},
-std::array<float,2>{0.219572082f, 0.146852121f},
-std::array<float,2>{0.518714905f, 0.800204158f},
-std::array<float,2>{0.641844928f, 0.0551585183f},
-std::array<float,2>{0.103331245f, 0.950423956f},
-std::array<float,2>{0.283160597f, 0.344300002f},
-std::array<float,2>{0.837538004f, 0.644086003f},
-std::array<float,2>{0.820661783f, 0.0215522293f},
-std::array<float,2>{0.309474289f, 0.985659182f},
-std::array<float,2>{0.123489223f, 0.335687131f},
-std::array<float,2>{0.631796837f, 0.665249169f},
-std::array<float,2>{0.507487714f, 0.490555257f},
-std::array<float,2>{0.246643931f, 0.507007062f},
-std::array<float,2>{0.45922026f, 0.160670906f},
-std::array<float,2>{0.983402193f, 0.752061188f},
-std::array<float,2>{0.925093293f, 0.298729926f},
-std::array<float,2>{0.414813727f, 0.702756703f},
-std::array<float,2>{0.181165189f, 0.082449995f},
-std::array<float,2>{0.597732186f, 0.921559036f},
-std::array<float,2>{0.689415812f, 0.225444019f},
-std::array<float,2>{0.0358177237f, 0.833548009f},
-std::array<float,2>{0.314839542f, 0.40953964f},
-std::array<float,2>{0.805426061f, 0.578312337f},
-std::array<float,2>{0.960030079f, 0.127680704f},
-std::array<float,2>{0.475672573f, 0.792806029f},
-std::array<float,2>{0.197092146f, 0.454863369f},
-std::array<float,2>{0.546787918f, 0.546961784f},
-std::array<float,2>{0.666165054f, 0.363116831f},
-std::array<float,2>{0.0832650512f, 0.640568614f},
-std::array<float,2>{0.256903738f, 0.0423437133f},
-std::array<float,2>{0.846241236f, 0.956661701f},
-std::array<float,2>{0.751848936f, 0.387117594f},
-std::array<float,2>{0.358272344f, 0.606656492f},
-std::array<float,2>{0.0178462379f, 0.213902488f},
-std::array<float,2>{0.727682292f, 0.871695757f},
-std::array<float,2>{0.568791091f, 0.113653056f},
-std::array<float,2>{0.154080182f, 0.892396152f},
-std::array<float,2>{0.391388714f, 0.277459592f},
-std::array<float,2>{0.878628612f, 0.724649668f},
-std::array<float,2>{0.970702887f, 0.0322526917f},
-std::array<float,2>{0.464989066f, 0.963639677f},
-std::array<float,2>{0.240546763f, 0.370243728f},
-std::array<float,2>{0.509405673f, 0.632370055f},
-std::array<float,2>{0.635708213f, 0.462370664f},
-std::array<float,2>{0.109605215f, 0.5615049f},
-std::array<float,2>{0.301485181f, 0.137693569f},
-std::array<float,2>{0.815348506f, 0.784901798f},
-std::array<float,2>{0.804606199f, 0.265950292f},
-std::array<float,2>{0.325552374f, 0.731949568f},
-std::array<float,2>{0.046436131f, 0.124336146f},
-std::array<float,2>{0.696963668f, 0.900494397f},
-std::array<float,2>{0.607253611f, 0.203554973f},
-std::array<float,2>{0.176476389f, 0.866089761f},
-std::array<float,2>{0.408558249f, 0.378377885f},
-std::array<float,2>{0.934202194f, 0.596583128f},
-std::array<float,2>{0.853836179f, 0.166530699f},
-std::array<float,2>{0.262835175f, 0.760860801f},
-std::array<float,2>{0.0908657014f, 0.494128704f},
-std::array<float,2>{0.662536263f, 0.510743499f},
-std::array<float,2>{0.533579886f, 0.338316232f},
-std::array<float,2>{0.188240573f, 0.657674611f},
-std::array<float,2>{0.482146502f, 0.029870186f},
-std::array<float,2>{0.961326838f, 0.999362767f},
-std::array<float,2>{0.887835503f, 0.419720232f},
-std::array<float,2>{0.402848661f, 0.587826014f},
-std::array<float,2>{0.144393936f, 0.229067475f},
-std::array<float,2>{0.575285196f, 0.843614459f},
-std::array<float,2>{0.721244335f, 0.0889260471f},
-std::array<float,2>{0.0293996446f, 0.910751104f},
-std::array<float,2>{0.345326275f, 0.312025338f},
-std::array<float,2>{0.76306963f, 0.692377985f},
-std::array<float,2>{0.779165924f, 0.100548357f},
-std::array<float,2>{0.373298913f, 0.878223896f},
-std::array<float,2>{0.00979827624f, 0.261466295f},
-std::array<float,2>{0.739086807f, 0.749411643f},
-std::array<float,2>{0.587204516f, 0.396274358f},
-std::array<float,2>{0.129265502f, 0.611528099f},
-std::array<float,2>{0.390549898f, 0.200375199f},
-std::array<float,2>{0.899138212f, 0.855974078f},
-std::array<float,2>{0.953111053f, 0.356577277f},
-std::array<float,2>{0.487201571f, 0.654326141f},
-std::array<float,2>{0.206576824f, 0.0514945649f},
-std::array<float,2>{0.556183934f, 0.943770468f},
-std::array<float,2>{0.683863819f, 0.155917704f},
-std::array<float,2>{0.073713392f, 0.811481416f},
-std::array<float,2>{0.278946906f, 0.442454159f},
-std::array<float,2>{0.869956791f, 0.532829285f},
-std::array<float,2>{0.908453286f, 0.240775242f},
-std::array<float,2>{0.432209492f, 0.816510677f},
-std::array<float,2>{0.170171201f, 0.423959553f},
-std::array<float,2>{0.612973988f, 0.565044999f},
-std::array<float,2>{0.716175973f, 0.291598231f},
-std::array<float,2>{0.0555379763f, 0.712798178f},
-std::array<float,2>{0.33314985f, 0.0662640631f},
-std::array<float,2>{0.795693934f, 0.931912065f},
-std::array<float,2>{0.829631329f, 0.477776468f},
-std::array<float,2>{0.293415904f, 0.521192849f},
-std::array<float,2>{0.099192597f, 0.184101716f},
-std::array<float,2>{0.650809348f, 0.769504011f},
-std::array<float,2>{0.523749292f, 0.0139297955f},
-std::array<float,2>{0.234340295f, 0.97903651f},
-std::array<float,2>{0.448403358f, 0.324801236f},
-std::array<float,2>{0.996926308f, 0.677231729f},
-std::array<float,2>{0.933437824f, 0.00427018665f},
-std::array<float,2>{0.412779659f, 0.976247787f},
-std::array<float,2>{0.175313517f, 0.313561022f},
-std::array<float,2>{0.601666629f, 0.68510747f},
-std::array<float,2>{0.700442255f, 0.475376874f},
-std::array<float,2>{0.0403142571f, 0.524954796f},
-std::array<float,2>{0.322965264f, 0.179140642f},
-std::array<float,2>{0.797665f, 0.780081928f},
-std::array<float,2>{0.818173945f, 0.286990464f},
-std::array<float,2>{0.300328702f, 0.709543884f},
-std::array<float,2>{0.11381752f, 0.0762868151f},
-std::array<float,2>{0.640414655f, 0.928954303f},
-std::array<float,2>{0.512485147f, 0.244654357f},
-std::array<float,2>{0.236849517f, 0.825181544f},
-std::array<float,2>{0.462294072f, 0.430928171f},
-std::array<float,2>{0.974965036f, 0.576531887f},
-std::array<float,2>{0.758558214f, 0.14306134f},
-std::array<float,2>{0.349985957f, 0.801057875f},
-std::array<float,2>{0.0241919961f, 0.449019849f},
-std::array<float,2>{0.72408092f, 0.546139956f},
-std::array<float,2>{0.570959866f, 0.34871313f},
-std::array<float,2>{0.147207245f, 0.647294939f},
-std::array<float,2>{0.399854571f, 0.0605104789f},
-std::array<float,2>{0.885094881f, 0.946561038f},
-std::array<float,2>{0.965828001f, 0.400767297f},
-std::array<float,2>{0.479463845f, 0.621078551f},
-std::array<float,2>{0.192811608f, 0.187801406f},
-std::array<float,2>{0.537517428f, 0.848356009f},
-std::array<float,2>{0.659093082f, 0.104106024f},
-std::array<float,2>{0.0891794935f, 0.887262404f},
-std::array<float,2>{0.259609699f, 0.253525168f},
-std::array<float,2>{0.858457267f, 0.736967504f},
-std::array<float,2>{0.871557236f, 0.081788823f},
-std::array<float,2>{0.274362385f, 0.916928351f},
-std::array<float,2>{0.0764202103f, 0.301037699f},
-std::array<float,2>{0.683281481f, 0.699188054f},
-std::array<float,2>{0.561411262f, 0.411901891f},
-std::array<float,2>{0.210926026f, 0.585722148f},
-std::array<float,2>{0.488507003f, 0.21883072f},
-std::array<float,2>{0.946466208f, 0.82928133f},
-std::array<float,2>{0.902348518f, 0.33159256f},
-std::array<float,2>{0.38337183f, 0.667987227f},
-std::array<float,2>{0.127835572f, 0.0157004967f},
-std::array<float,2>{0.593726039f, 0.990625679f},
-std::array<float,2>{0.73792541f, 0.158077687f},
-std::array<float,2>{0.0134328669f, 0.755363882f},
-std::array<float,2>{0.370529681f, 0.486304671f},
-std::array<float,2>{0.776413023f, 0.500685573f},
-std::array<float,2>{0.994681895f, 0.21859628f},
-std::array<float,2>{0.453089476f, 0.870557547f},
-std::array<float,2>{0.228365704f, 0.386172503f},
-std::array<float,2>{0.530270576f, 0.604305148f},
-std::array<float,2>{0.655186653f, 0.274344146f},
-std::array<float,2>{0.0951800719f, 0.719275236f},
-std::array<float,2>{0.290170968f, 0.109610498f},
-std::array<float,2>{0.835679948f, 0.896407604f},
-std::array<float,2>{0.789946854f, 0.460422963f},
-std::array<float,2>{0.329647034f, 0.552392185f},
-std::array<float,2>{0.0615803413f, 0.128991157f},
-std::array<float,2>{0.711832285f, 0.79495883f},
-std::array<float,2>{0.615083814f, 0.043001432f},
-std::array<float,2>{0.164467201f, 0.959524214f},
-std::array<float,2>{0.434191674f, 0.364943415f},
-std::array<float,2>{0.913194835f, 0.635694385f},
-std::array<float,2>{0.938705504f, 0.120695099f},
-std::array<float,2>{0.493178874f, 0.904777586f},
-std::array<float,2>{0.217474252f, 0.272389293f},
-std::array<float,2>{0.553024948f, 0.728961885f},
-std::array<float,2>{0.678137481f, 0.381175727f},
-std::array<float,2>{0.0651688054f, 0.599436462f},
-std::array<float,2>{0.268132985f, 0.210002437f},
-std::array<float,2>{0.866774619f, 0.862549365f},
-std::array<float,2>{0.770054042f, 0.371134967f},
-std::array<float,2>{0.360254377f, 0.626953423f},
-std::array<float,2>{0.00510008819f, 0.0375492387f},
-std::array<float,2>{0.747062266f, 0.964927852f},
-std::array<float,2>{0.585419059f, 0.13428393f},
-std::array<float,2>{0.138421655f, 0.789036095f},
-std::array<float,2>{0.376735449f, 0.466379941f},
-std::array<float,2>{0.897377133f, 0.557840049f},
-std::array<float,2>{0.840459228f, 0.231063738f},
-std::array<float,2>{0.285835952f, 0.836063504f},
-std::array<float,2>{0.106799074f, 0.415797085f},
-std::array<float,2>{0.645933807f, 0.589916408f},
-std::array<float,2>{0.521351695f, 0.305140167f},
-std::array<float,2>{0.223210976f, 0.689799368f},
-std::array<float,2>{0.441480249f, 0.0898797065f},
-std::array<float,2>{0.989804029f, 0.909970999f},
-std::array<float,2>{0.916441143f, 0.499437898f},
-std::array<float,2>{0.422218621f, 0.512701988f},
-std::array<float,2>{0.162900686f, 0.167969033f},
-std::array<float,2>{0.618890226f, 0.76299566f},
-std::array<float,2>{0.709116697f, 0.0266941264f},
-std::array<float,2>{0.0482411943f, 0.995971918f},
-std::array<float,2>{0.33762309f, 0.340161085f},
-std::array<float,2>{0.786957145f, 0.66175127f},
-std::array<float,2>{0.811412036f, 0.0478726849f},
-std::array<float,2>{0.317015529f, 0.938662171f},
-std::array<float,2>{0.0322680213f, 0.353090435f},
-std::array<float,2>{0.693345249f, 0.649319708f},
-std::array<float,2>{0.596396565f, 0.44024691f},
-std::array<float,2>{0.186043575f, 0.5357216f},
-std::array<float,2>{0.418870926f, 0.150264591f},
-std::array<float,2>{0.92672056f, 0.807481706f},
-std::array<float,2>{0.979301393f, 0.265171468f},
-std::array<float,2>{0.456480682f, 0.742859542f},
-std::array<float,2>{0.245922416f, 0.0967499986f},
-std::array<float,2>{0.501313686f, 0.882322669f},
-std::array<float,2>{0.62877804f, 0.198202878f},
-std::array<float,2>{0.120105617f, 0.853919268f},
-std::array<float,2>{0.304837048f, 0.392935872f},
-std::array<float,2>{0.825396895f, 0.616314709f},
-std::array<float,2>{0.879364967f, 0.183102384f},
-std::array<float,2>{0.395406812f, 0.769799292f},
-std::array<float,2>{0.148735985f, 0.480640262f},
-std::array<float,2>{0.562661052f, 0.519003987f},
-std::array<float,2>{0.733738184f, 0.323752612f},
-std::array<float,2>{0.0221680366f, 0.672750294f},
-std::array<float,2>{0.354532123f, 0.00884066522f},
-std::array<float,2>{0.754613578f, 0.983149529f},
-std::array<float,2>{0.850096583f, 0.42961207f},
-std::array<float,2>{0.253782153f, 0.566647768f},
-std::array<float,2>{0.0784909204f, 0.234856382f},
-std::array<float,2>{0.669534922f, 0.814991176f},
-std::array<float,2>{0.542831063f, 0.0683621764f},
-std::array<float,2>{0.202115774f, 0.935182095f},
-std::array<float,2>{0.47082448f, 0.295743823f},
-std::array<float,2>{0.95607239f, 0.716029227f},
-std::array<float,2>{0.9180758f, 0.107171342f},
-std::array<float,2>{0.429391414f, 0.884153605f},
-std::array<float,2>{0.159630209f, 0.254774034f},
-std::array<float,2>{0.623078585f, 0.740937352f},
-std::array<float,2>{0.70408392f, 0.404053986f},
-std::array<float,2>{0.0538492873f, 0.621238589f},
-std::array<float,2>{0.34136194f, 0.194545433f},
-std::array<float,2>{0.781969786f, 0.846790969f},
-std::array<float,2>{0.838241398f, 0.347348273f},
-std::array<float,2>{0.28414309f, 0.640944183f},
-std::array<float,2>{0.104334466f, 0.0577133819f},
-std::array<float,2>{0.644489527f, 0.952499211f},
-std::array<float,2>{0.51726228f, 0.144732252f},
-std::array<float,2>{0.221588597f, 0.798184037f},
-std::array<float,2>{0.441231072f, 0.452460468f},
-std::array<float,2>{0.987124264f, 0.542344511f},
-std::array<float,2>{0.76693368f, 0.247582629f},
-std::array<float,2>{0.364000678f, 0.823567033f},
-std::array<float,2>{0.000253448961f, 0.435556054f},
-std::array<float,2>{0.743879199f, 0.57215941f},
-std::array<float,2>{0.581388831f, 0.282073289f},
-std::array<float,2>{0.134138212f, 0.703741729f},
-std::array<float,2>{0.382220268f, 0.0714492947f},
-std::array<float,2>{0.894446433f, 0.924467921f},
-std::array<float,2>{0.94524014f, 0.469679415f},
-std::array<float,2>{0.497306049f, 0.529670775f},
-std::array<float,2>{0.214350089f, 0.175563738f},
-std::array<float,2>{0.548095763f, 0.773494899f},
-std::array<float,2>{0.672821283f, 0.00243837852f},
-std::array<float,2>{0.0664768666f, 0.969700336f},
-std::array<float,2>{0.271151304f, 0.317497551f},
-std::array<float,2>{0.860857904f, 0.680761456f},
-std::array<float,2>{0.84561491f, 0.0404623598f},
-std::array<float,2>{0.254166454f, 0.953191996f},
-std::array<float,2>{0.0848265216f, 0.360946685f},
-std::array<float,2>{0.664279997f, 0.637481391f},
-std::array<float,2>{0.543729365f, 0.455175012f},
-std::array<float,2>{0.198832884f, 0.550072968f},
-std::array<float,2>{0.474271774f, 0.126819238f},
-std::array<float,2>{0.957294345f, 0.791009247f},
-std::array<float,2>{0.875371993f, 0.28021875f},
-std::array<float,2>{0.393376559f, 0.722796142f},
-std::array<float,2>{0.155257672f, 0.116815962f},
-std::array<float,2>{0.567795634f, 0.89445883f},
-std::array<float,2>{0.729995728f, 0.211227819f},
-std::array<float,2>{0.0161586553f, 0.873351395f},
-std::array<float,2>{0.357249498f, 0.3901667f},
-std::array<float,2>{0.753312469f, 0.609129727f},
-std::array<float,2>{0.980612338f, 0.162211955f},
-std::array<float,2>{0.458506554f, 0.751607478f},
-std::array<float,2>{0.248521879f, 0.4900738f},
-std::array<float,2>{0.504747272f, 0.505580187f},
-std::array<float,2>{0.62980628f, 0.333397925f},
-std::array<float,2>{0.12118236f, 0.667920172f},
-std::array<float,2>{0.312252909f, 0.0206809323f},
-std::array<float,2>{0.823039412f, 0.987691522f},
-std::array<float,2>{0.80774349f, 0.407199085f},
-std::array<float,2>{0.313850105f, 0.58147347f},
-std::array<float,2>{0.0383492745f, 0.222883046f},
-std::array<float,2>{0.689998388f, 0.834173322f},
-std::array<float,2>{0.599796951f, 0.0842437893f},
-std::array<float,2>{0.182489768f, 0.918933094f},
-std::array<float,2>{0.416759163f, 0.299448669f},
-std::array<float,2>{0.923498034f, 0.699604869f},
-std::array<float,2>{0.963919699f, 0.0291037019f},
-std::array<float,2>{0.482980281f, 0.99768436f},
-std::array<float,2>{0.190722167f, 0.337604523f},
-std::array<float,2>{0.532932281f, 0.659640372f},
-std::array<float,2>{0.661770463f, 0.494891226f},
-std::array<float,2>{0.0932031795f, 0.508217573f},
-std::array<float,2>{0.264101624f, 0.164735928f},
-std::array<float,2>{0.852377653f, 0.759704411f},
-std::array<float,2>{0.764971793f, 0.310415924f},
-std::array<float,2>{0.346148044f, 0.694947898f},
-std::array<float,2>{0.0288614109f, 0.0876278356f},
-std::array<float,2>{0.719452143f, 0.913797438f},
-std::array<float,2>{0.577946007f, 0.227594495f},
-std::array<float,2>{0.141193226f, 0.841474473f},
-std::array<float,2>{0.405468047f, 0.420862406f},
-std::array<float,2>{0.890370607f, 0.588955581f},
-std::array<float,2>{0.812644064f, 0.139736116f},
-std::array<float,2>{0.303162038f, 0.782060742f},
-std::array<float,2>{0.112513438f, 0.46483323f},
-std::array<float,2>{0.634055972f, 0.560105979f},
-std::array<float,2>{0.511475325f, 0.367343843f},
-std::array<float,2>{0.238298714f, 0.629739404f},
-std::array<float,2>{0.467997044f, 0.0347650014f},
-std::array<float,2>{0.971360147f, 0.961336493f},
-std::array<float,2>{0.93705368f, 0.376310319f},
-std::array<float,2>{0.407869577f, 0.595686078f},
-std::array<float,2>{0.178082466f, 0.206327021f},
-std::array<float,2>{0.607655525f, 0.865059376f},
-std::array<float,2>{0.697318733f, 0.121725857f},
-std::array<float,2>{0.0433154032f, 0.900036395f},
-std::array<float,2>{0.327187806f, 0.269442022f},
-std::array<float,2>{0.801945269f, 0.73341918f},
-std::array<float,2>{0.79350853f, 0.0641423017f},
-std::array<float,2>{0.33504647f, 0.930778861f},
-std::array<float,2>{0.0575944073f, 0.290869623f},
-std::array<float,2>{0.71706754f, 0.713364899f},
-std::array<float,2>{0.610320926f, 0.422580242f},
-std::array<float,2>{0.169001728f, 0.562590539f},
-std::array<float,2>{0.429832339f, 0.238563642f},
-std::array<float,2>{0.90795362f, 0.819368422f},
-std::array<float,2>{0.999319196f, 0.327071816f},
-std::array<float,2>{0.446158886f, 0.67967689f},
-std::array<float,2>{0.232042521f, 0.0133313052f},
-std::array<float,2>{0.526945949f, 0.9771896f},
-std::array<float,2>{0.650161505f, 0.186731249f},
-std::array<float,2>{0.10101606f, 0.766605854f},
-std::array<float,2>{0.296784163f, 0.480158865f},
-std::array<float,2>{0.831385493f, 0.521685958f},
-std::array<float,2>{0.902244747f, 0.202327594f},
-std::array<float,2>{0.387386531f, 0.858469784f},
-std::array<float,2>{0.132033199f, 0.398037225f},
-std::array<float,2>{0.588469505f, 0.610651076f},
-std::array<float,2>{0.740559042f, 0.258659273f},
-std::array<float,2>{0.00854967535f, 0.74768883f},
-std::array<float,2>{0.371237457f, 0.0976784751f},
-std::array<float,2>{0.779417992f, 0.876643062f},
-std::array<float,2>{0.868266046f, 0.444357842f},
-std::array<float,2>{0.280806512f, 0.533325195f},
-std::array<float,2>{0.0722582489f, 0.153174147f},
-std::array<float,2>{0.686032832f, 0.808843076f},
-std::array<float,2>{0.557070076f, 0.0531947799f},
-std::array<float,2>{0.204627797f, 0.941747665f},
-std::array<float,2>{0.484376252f, 0.359234303f},
-std::array<float,2>{0.950800538f, 0.653614163f},
-std::array<float,2>{0.883976877f, 0.0620572977f},
-std::array<float,2>{0.400637478f, 0.948488295f},
-std::array<float,2>{0.145563081f, 0.35113433f},
-std::array<float,2>{0.572772741f, 0.646363139f},
-std::array<float,2>{0.726457059f, 0.447234213f},
-std::array<float,2>{0.0265406687f, 0.544018984f},
-std::array<float,2>{0.349428326f, 0.141702086f},
-std::array<float,2>{0.760184228f, 0.803643763f},
-std::array<float,2>{0.855998635f, 0.251780778f},
-std::array<float,2>{0.260476589f, 0.734835684f},
-std::array<float,2>{0.0860037282f, 0.102750137f},
-std::array<float,2>{0.657407224f, 0.889601231f},
-std::array<float,2>{0.536123037f, 0.189938381f},
-std::array<float,2>{0.195307299f, 0.85073787f},
-std::array<float,2>{0.477962911f, 0.399296165f},
-std::array<float,2>{0.96710664f, 0.618411481f},
-std::array<float,2>{0.799334943f, 0.177110448f},
-std::array<float,2>{0.320326f, 0.778774858f},
-std::array<float,2>{0.0416074172f, 0.472696424f},
-std::array<float,2>{0.701408863f, 0.526991189f},
-std::array<float,2>{0.605349243f, 0.314564377f},
-std::array<float,2>{0.172420651f, 0.686050832f},
-std::array<float,2>{0.410918981f, 0.00651021115f},
-std::array<float,2>{0.93080312f, 0.973892689f},
-std::array<float,2>{0.974411368f, 0.432706296f},
-std::array<float,2>{0.462901145f, 0.574451566f},
-std::array<float,2>{0.234395176f, 0.244085819f},
-std::array<float,2>{0.515575349f, 0.826886535f},
-std::array<float,2>{0.636856973f, 0.0750130713f},
-std::array<float,2>{0.115787521f, 0.926702023f},
-std::array<float,2>{0.298741609f, 0.287244111f},
-std::array<float,2>{0.818934381f, 0.708022714f},
-std::array<float,2>{0.832093656f, 0.113121785f},
-std::array<float,2>{0.291897535f, 0.898148656f},
-std::array<float,2>{0.0975683555f, 0.275484622f},
-std::array<float,2>{0.653873146f, 0.720982969f},
-std::array<float,2>{0.527752161f, 0.384376526f},
-std::array<float,2>{0.230245471f, 0.602814674f},
-std::array<float,2>{0.450042218f, 0.215284869f},
-std::array<float,2>{0.99342823f, 0.867682338f},
-std::array<float,2>{0.910914481f, 0.36601153f},
-std::array<float,2>{0.437135011f, 0.632857263f},
-std::array<float,2>{0.167123914f, 0.0460922681f},
-std::array<float,2>{0.615246177f, 0.957138181f},
-std::array<float,2>{0.714617372f, 0.132628456f},
-std::array<float,2>{0.0591767728f, 0.793610632f},
-std::array<float,2>{0.331518799f, 0.457797617f},
-std::array<float,2>{0.791924655f, 0.55289793f},
-std::array<float,2>{0.949082494f, 0.221147746f},
-std::array<float,2>{0.490314394f, 0.831926465f},
-std::array<float,2>{0.207987532f, 0.413869292f},
-std::array<float,2>{0.55881995f, 0.582821846f},
-std::array<float,2>{0.680964589f, 0.304012626f},
-std::array<float,2>{0.0750418529f, 0.695721745f},
-std::array<float,2>{0.275875986f, 0.0789525956f},
-std::array<float,2>{0.874797583f, 0.915982544f},
-std::array<float,2>{0.773870409f, 0.488133639f},
-std::array<float,2>{0.368899733f, 0.503062367f},
-std::array<float,2>{0.0148667013f, 0.159892187f},
-std::array<float,2>{0.735430062f, 0.757743776f},
-std::array<float,2>{0.591335654f, 0.0191936232f},
-std::array<float,2>{0.126585275f, 0.990132868f},
-std::array<float,2>{0.386103839f, 0.328316242f},
-std::array<float,2>{0.904620171f, 0.670152724f},
-std::array<float,2>{0.991839111f, 0.0922499821f},
-std::array<float,2>{0.443620056f, 0.90757215f},
-std::array<float,2>{0.2265618f, 0.308242172f},
-std::array<float,2>{0.523278177f, 0.688311934f},
-std::array<float,2>{0.647254825f, 0.416369617f},
-std::array<float,2>{0.107505575f, 0.59358114f},
-std::array<float,2>{0.287635326f, 0.232653111f},
-std::array<float,2>{0.841816366f, 0.838982761f},
-std::array<float,2>{0.788330495f, 0.343104482f},
-std::array<float,2>{0.339784205f, 0.662790716f},
-std::array<float,2>{0.0503306724f, 0.0240978729f},
-std::array<float,2>{0.708140254f, 0.993669629f},
-std::array<float,2>{0.619349599f, 0.170484766f},
-std::array<float,2>{0.161319092f, 0.763753951f},
-std::array<float,2>{0.425195932f, 0.496837169f},
-std::array<float,2>{0.914908469f, 0.514831483f},
-std::array<float,2>{0.864536643f, 0.207939163f},
-std::array<float,2>{0.267153025f, 0.859518945f},
-std::array<float,2>{0.0632235929f, 0.379654348f},
-std::array<float,2>{0.676447988f, 0.600376785f},
-std::array<float,2>{0.55125618f, 0.269848198f},
-std::array<float,2>{0.216053218f, 0.72748971f},
-std::array<float,2>{0.495821297f, 0.11886882f},
-std::array<float,2>{0.941292584f, 0.903432667f},
-std::array<float,2>{0.896240413f, 0.466969192f},
-std::array<float,2>{0.377857476f, 0.556241453f},
-std::array<float,2>{0.138885468f, 0.135540992f},
-std::array<float,2>{0.583561778f, 0.786294639f},
-std::array<float,2>{0.749508977f, 0.0353928506f},
-std::array<float,2>{0.00735844346f, 0.96852988f},
-std::array<float,2>{0.363099843f, 0.374741018f},
-std::array<float,2>{0.77298528f, 0.625119448f},
-std::array<float,2>{0.756077588f, 0.0108179944f},
-std::array<float,2>{0.352041632f, 0.981409013f},
-std::array<float,2>{0.0209198743f, 0.322006822f},
-std::array<float,2>{0.73224932f, 0.674992383f},
-std::array<float,2>{0.565872908f, 0.483881056f},
-std::array<float,2>{0.1506304f, 0.516581774f},
-std::array<float,2>{0.39818573f, 0.181140602f},
-std::array<float,2>{0.881168127f, 0.77196914f},
-std::array<float,2>{0.954168618f, 0.294397771f},
-std::array<float,2>{0.469700634f, 0.718608737f},
-std::array<float,2>{0.19924441f, 0.0673884228f},
-std::array<float,2>{0.539601207f, 0.937160492f},
-std::array<float,2>{0.670707703f, 0.237315372f},
-std::array<float,2>{0.0803943127f, 0.813916922f},
-std::array<float,2>{0.251855105f, 0.427328676f},
-std::array<float,2>{0.848940194f, 0.569027185f},
-std::array<float,2>{0.92880553f, 0.150402203f},
-std::array<float,2>{0.420816988f, 0.804796815f},
-std::array<float,2>{0.184118271f, 0.439292163f},
-std::array<float,2>{0.595522225f, 0.538098752f},
-std::array<float,2>{0.694577157f, 0.355049253f},
-std::array<float,2>{0.0347916894f, 0.650682569f},
-std::array<float,2>{0.320144176f, 0.0505067855f},
-std::array<float,2>{0.810254455f, 0.939563096f},
-std::array<float,2>{0.826240718f, 0.390730411f},
-std::array<float,2>{0.307941288f, 0.613862455f},
-std::array<float,2>{0.117571063f, 0.19676058f},
-std::array<float,2>{0.626834571f, 0.851608276f},
-std::array<float,2>{0.503413975f, 0.0949046239f},
-std::array<float,2>{0.243493617f, 0.880231917f},
-std::array<float,2>{0.453997135f, 0.263070047f},
-std::array<float,2>{0.977859557f, 0.744211555f},
-std::array<float,2>{0.877718627f, 0.116034903f},
-std::array<float,2>{0.392458379f, 0.892692268f},
-std::array<float,2>{0.153106093f, 0.280957133f},
-std::array<float,2>{0.570012033f, 0.724190295f},
-std::array<float,2>{0.726706028f, 0.389599144f},
-std::array<float,2>{0.0192622654f, 0.608273447f},
-std::array<float,2>{0.358859062f, 0.212250099f},
-std::array<float,2>{0.750192046f, 0.874251068f},
-std::array<float,2>{0.8474648f, 0.359967381f},
-std::array<float,2>{0.256075084f, 0.638377786f},
-std::array<float,2>{0.0821786225f, 0.0392882191f},
-std::array<float,2>{0.66775614f, 0.954221368f},
-std::array<float,2>{0.545613527f, 0.125506952f},
-std::array<float,2>{0.196133122f, 0.789185345f},
-std::array<float,2>{0.475435585f, 0.456210107f},
-std::array<float,2>{0.959849715f, 0.549709201f},
-std::array<float,2>{0.806499898f, 0.223814175f},
-std::array<float,2>{0.315557182f, 0.835271418f},
-std::array<float,2>{0.0364440493f, 0.408177465f},
-std::array<float,2>{0.68829143f, 0.580794573f},
-std::array<float,2>{0.598790407f, 0.29981181f},
-std::array<float,2>{0.179695338f, 0.700612247f},
-std::array<float,2>{0.415397435f, 0.0855963528f},
-std::array<float,2>{0.923974931f, 0.919774115f},
-std::array<float,2>{0.982526958f, 0.488765806f},
-std::array<float,2>{0.460594594f, 0.504691184f},
-std::array<float,2>{0.247491688f, 0.16317825f},
-std::array<float,2>{0.506224632f, 0.750893772f},
-std::array<float,2>{0.632604301f, 0.0205045007f},
-std::array<float,2>{0.124681272f, 0.987242639f},
-std::array<float,2>{0.310152352f, 0.332319647f},
-std::array<float,2>{0.82152617f, 0.666243315f},
-std::array<float,2>{0.836652994f, 0.0567508042f},
-std::array<float,2>{0.281975776f, 0.951214194f},
-std::array<float,2>{0.102530271f, 0.346272111f},
-std::array<float,2>{0.641466022f, 0.64201057f},
-std::array<float,2>{0.518363237f, 0.451481253f},
-std::array<float,2>{0.220366836f, 0.54188776f},
-std::array<float,2>{0.43832323f, 0.146186173f},
-std::array<float,2>{0.984746516f, 0.797624946f},
-std::array<float,2>{0.920080185f, 0.255485684f},
-std::array<float,2>{0.427313328f, 0.742011726f},
-std::array<float,2>{0.157653272f, 0.105868243f},
-std::array<float,2>{0.62166059f, 0.88340348f},
-std::array<float,2>{0.706618428f, 0.193384141f},
-std::array<float,2>{0.0508882888f, 0.846062243f},
-std::array<float,2>{0.342209607f, 0.402404875f},
-std::array<float,2>{0.78485328f, 0.622241199f},
-std::array<float,2>{0.94219631f, 0.173970938f},
-std::array<float,2>{0.499396294f, 0.774778485f},
-std::array<float,2>{0.21149309f, 0.469954222f},
-std::array<float,2>{0.550699055f, 0.530299127f},
-std::array<float,2>{0.674962223f, 0.31732896f},
-std::array<float,2>{0.0699791387f, 0.680093288f},
-std::array<float,2>{0.271844447f, 0.00324094994f},
-std::array<float,2>{0.862757742f, 0.970653176f},
-std::array<float,2>{0.76791358f, 0.436596781f},
-std::array<float,2>{0.365927637f, 0.570394814f},
-std::array<float,2>{0.00332393777f, 0.246792287f},
-std::array<float,2>{0.745324731f, 0.822913587f},
-std::array<float,2>{0.579354882f, 0.0706324354f},
-std::array<float,2>{0.13532877f, 0.925226212f},
-std::array<float,2>{0.380526394f, 0.283097148f},
-std::array<float,2>{0.89083451f, 0.704350293f},
-std::array<float,2>{0.998040438f, 0.0120108733f},
-std::array<float,2>{0.447314143f, 0.977692664f},
-std::array<float,2>{0.232946411f, 0.327223629f},
-std::array<float,2>{0.52512008f, 0.677914381f},
-std::array<float,2>{0.652152181f, 0.478552878f},
-std::array<float,2>{0.0980511457f, 0.523207426f},
-std::array<float,2>{0.294833481f, 0.185685962f},
-std::array<float,2>{0.828763247f, 0.766227245f},
-std::array<float,2>{0.796432436f, 0.289879203f},
-std::array<float,2>{0.33282572f, 0.714626193f},
-std::array<float,2>{0.0557844825f, 0.0630593896f},
-std::array<float,2>{0.715586782f, 0.930413961f},
-std::array<float,2>{0.611557841f, 0.239454955f},
-std::array<float,2>{0.171277255f, 0.818553269f},
-std::array<float,2>{0.433149099f, 0.422904879f},
-std::array<float,2>{0.909990728f, 0.563782513f},
-std::array<float,2>{0.871005118f, 0.153338328f},
-std::array<float,2>{0.277925581f, 0.810333431f},
-std::array<float,2>{0.0725095645f, 0.443362087f},
-std::array<float,2>{0.684749246f, 0.534843087f},
-std::array<float,2>{0.554807246f, 0.357557058f},
-std::array<float,2>{0.205540329f, 0.65246433f},
-std::array<float,2>{0.487729996f, 0.0537577122f},
-std::array<float,2>{0.951483309f, 0.942582846f},
-std::array<float,2>{0.899764597f, 0.396606505f},
-std::array<float,2>{0.389531344f, 0.609659433f},
-std::array<float,2>{0.129946023f, 0.201644942f},
-std::array<float,2>{0.586708963f, 0.858392656f},
-std::array<float,2>{0.739492238f, 0.0990048945f},
-std::array<float,2>{0.0110485991f, 0.875567853f},
-std::array<float,2>{0.374224842f, 0.258956552f},
-std::array<float,2>{0.777845085f, 0.746837318f},
-std::array<float,2>{0.762390494f, 0.0867906064f},
-std::array<float,2>{0.344029188f, 0.912448645f},
-std::array<float,2>{0.030971678f, 0.308840156f},
-std::array<float,2>{0.722580433f, 0.693928838f},
-std::array<float,2>{0.574308276f, 0.421639711f},
-std::array<float,2>{0.142806217f, 0.588440776f},
-std::array<float,2>{0.403425813f, 0.227380589f},
-std::array<float,2>{0.887382925f, 0.840269625f},
-std::array<float,2>{0.962597132f, 0.336112469f},
-std::array<float,2>{0.4805305f, 0.65864408f},
-std::array<float,2>{0.188841581f, 0.028056303f},
-std::array<float,2>{0.534846961f, 0.996781707f},
-std::array<float,2>{0.663899064f, 0.165147409f},
-std::array<float,2>{0.0907586738f, 0.757822394f},
-std::array<float,2>{0.262387276f, 0.495879531f},
-std::array<float,2>{0.854566514f, 0.509412348f},
-std::array<float,2>{0.93543452f, 0.205640629f},
-std::array<float,2>{0.409740269f, 0.863584816f},
-std::array<float,2>{0.177293405f, 0.375893027f},
-std::array<float,2>{0.606118143f, 0.594188929f},
-std::array<float,2>{0.696008265f, 0.267764717f},
-std::array<float,2>{0.0449859649f, 0.732903123f},
-std::array<float,2>{0.324754119f, 0.122123733f},
-std::array<float,2>{0.802861154f, 0.899293005f},
-std::array<float,2>{0.815750301f, 0.463487923f},
-std::array<float,2>{0.302511513f, 0.559271872f},
-std::array<float,2>{0.111189008f, 0.139108956f},
-std::array<float,2>{0.635772288f, 0.782343984f},
-std::array<float,2>{0.508322597f, 0.0336641669f},
-std::array<float,2>{0.241300344f, 0.962451816f},
-std::array<float,2>{0.465838909f, 0.368344367f},
-std::array<float,2>{0.969557941f, 0.630497158f},
-std::array<float,2>{0.912360191f, 0.0453746952f},
-std::array<float,2>{0.435059547f, 0.958785057f},
-std::array<float,2>{0.165723547f, 0.367016852f},
-std::array<float,2>{0.613987923f, 0.634451151f},
-std::array<float,2>{0.712161601f, 0.458768696f},
-std::array<float,2>{0.0607229732f, 0.554601789f},
-std::array<float,2>{0.328816295f, 0.131501228f},
-std::array<float,2>{0.790205002f, 0.794327021f},
-std::array<float,2>{0.834201634f, 0.277038842f},
-std::array<float,2>{0.289955348f, 0.722372353f},
-std::array<float,2>{0.0940123498f, 0.111675531f},
-std::array<float,2>{0.655764163f, 0.897123754f},
-std::array<float,2>{0.530713975f, 0.216752633f},
-std::array<float,2>{0.227534607f, 0.86832422f},
-std::array<float,2>{0.451535791f, 0.38281253f},
-std::array<float,2>{0.995980144f, 0.601994216f},
-std::array<float,2>{0.775631666f, 0.158225566f},
-std::array<float,2>{0.369978756f, 0.756711781f},
-std::array<float,2>{0.0119168749f, 0.486428708f},
-std::array<float,2>{0.73679769f, 0.502650499f},
-std::array<float,2>{0.591964364f, 0.329613954f},
-std::array<float,2>{0.128340334f, 0.67145431f},
-std::array<float,2>{0.384334356f, 0.0179157294f},
-std::array<float,2>{0.903806448f, 0.988776743f},
-std::array<float,2>{0.945524454f, 0.41245383f},
-std::array<float,2>{0.489439785f, 0.583707869f},
-std::array<float,2>{0.209530607f, 0.222224414f},
-std::array<float,2>{0.561658978f, 0.830262423f},
-std::array<float,2>{0.68197298f, 0.0796779618f},
-std::array<float,2>{0.0776741281f, 0.914452016f},
-std::array<float,2>{0.274547905f, 0.303645402f},
-std::array<float,2>{0.872341752f, 0.696304083f},
-std::array<float,2>{0.858199358f, 0.102475569f},
-std::array<float,2>{0.257966578f, 0.889795125f},
-std::array<float,2>{0.0886713043f, 0.250289977f},
-std::array<float,2>{0.65972209f, 0.736311316f},
-std::array<float,2>{0.538178384f, 0.400137872f},
-std::array<float,2>{0.191884667f, 0.617639422f},
-std::array<float,2>{0.480113268f, 0.190494969f},
-std::array<float,2>{0.964846432f, 0.850415111f},
-std::array<float,2>{0.88665688f, 0.350230217f},
-std::array<float,2>{0.39912793f, 0.64537698f},
-std::array<float,2>{0.148326963f, 0.0611807443f},
-std::array<float,2>{0.571673632f, 0.947290003f},
-std::array<float,2>{0.723005533f, 0.140839949f},
-std::array<float,2>{0.0247476306f, 0.803797543f},
-std::array<float,2>{0.351268262f, 0.44597888f},
-std::array<float,2>{0.758804083f, 0.543393791f},
-std::array<float,2>{0.976217985f, 0.242486626f},
-std::array<float,2>{0.461580545f, 0.827484787f},
-std::array<float,2>{0.237782761f, 0.432403326f},
-std::array<float,2>{0.512968242f, 0.575795233f},
-std::array<float,2>{0.639017582f, 0.288371354f},
-std::array<float,2>{0.114678085f, 0.707925737f},
-std::array<float,2>{0.299509197f, 0.0755149648f},
-std::array<float,2>{0.816794336f, 0.927262783f},
-std::array<float,2>{0.798765123f, 0.474509537f},
-std::array<float,2>{0.324069709f, 0.52582258f},
-std::array<float,2>{0.0391049422f, 0.176151544f},
-std::array<float,2>{0.700164795f, 0.777421236f},
-std::array<float,2>{0.603513002f, 0.00735074654f},
-std::array<float,2>{0.17413044f, 0.973290026f},
-std::array<float,2>{0.413737386f, 0.315930933f},
-std::array<float,2>{0.931880116f, 0.687453151f},
-std::array<float,2>{0.95580405f, 0.0668975189f},
-std::array<float,2>{0.471768469f, 0.935914397f},
-std::array<float,2>{0.202722624f, 0.293376982f},
-std::array<float,2>{0.541097343f, 0.717602372f},
-std::array<float,2>{0.668032348f, 0.426520497f},
-std::array<float,2>{0.0795662329f, 0.56978929f},
-std::array<float,2>{0.252869338f, 0.236643672f},
-std::array<float,2>{0.850838721f, 0.813379526f},
-std::array<float,2>{0.755320191f, 0.320996642f},
-std::array<float,2>{0.35401696f, 0.673964381f},
-std::array<float,2>{0.0229300167f, 0.0100650964f},
-std::array<float,2>{0.732995868f, 0.982060015f},
-std::array<float,2>{0.564029396f, 0.180522084f},
-std::array<float,2>{0.150212809f, 0.772485495f},
-std::array<float,2>{0.396162927f, 0.482873976f},
-std::array<float,2>{0.880776107f, 0.516754746f},
-std::array<float,2>{0.825010657f, 0.19541201f},
-std::array<float,2>{0.305771202f, 0.852570176f},
-std::array<float,2>{0.12091019f, 0.392163247f},
-std::array<float,2>{0.627039552f, 0.614549816f},
-std::array<float,2>{0.500540435f, 0.262559235f},
-std::array<float,2>{0.244957015f, 0.745228469f},
-std::array<float,2>{0.455179214f, 0.0946591571f},
-std::array<float,2>{0.979898989f, 0.879701853f},
-std::array<float,2>{0.926957369f, 0.438077807f},
-std::array<float,2>{0.419597507f, 0.537486851f},
-std::array<float,2>{0.187162995f, 0.151661739f},
-std::array<float,2>{0.597010434f, 0.806557298f},
-std::array<float,2>{0.692080915f, 0.0495363735f},
-std::array<float,2>{0.0315308608f, 0.94045049f},
-std::array<float,2>{0.317580402f, 0.353730232f},
-std::array<float,2>{0.812242448f, 0.651448309f},
-std::array<float,2>{0.785268068f, 0.0247942433f},
-std::array<float,2>{0.336162955f, 0.992801189f},
-std::array<float,2>{0.0470752418f, 0.342362255f},
-std::array<float,2>{0.710103393f, 0.663933396f},
-std::array<float,2>{0.617435515f, 0.497814894f},
-std::array<float,2>{0.163252443f, 0.514120579f},
-std::array<float,2>{0.423073739f, 0.171601146f},
-std::array<float,2>{0.917795658f, 0.764717221f},
-std::array<float,2>{0.988871217f, 0.30756551f},
-std::array<float,2>{0.443340212f, 0.688675284f},
-std::array<float,2>{0.22386694f, 0.0930117965f},
-std::array<float,2>{0.520403266f, 0.906407952f},
-std::array<float,2>{0.644784272f, 0.233939394f},
-std::array<float,2>{0.105870262f, 0.837909281f},
-std::array<float,2>{0.286502391f, 0.4172768f},
-std::array<float,2>{0.841078818f, 0.592343867f},
-std::array<float,2>{0.898032665f, 0.13624312f},
-std::array<float,2>{0.375164747f, 0.785605371f},
-std::array<float,2>{0.136771381f, 0.468573123f},
-std::array<float,2>{0.584077418f, 0.555087149f},
-std::array<float,2>{0.747961998f, 0.373752505f},
-std::array<float,2>{0.00396870682f, 0.626005709f},
-std::array<float,2>{0.360809326f, 0.0361825041f},
-std::array<float,2>{0.771003306f, 0.967167556f},
-std::array<float,2>{0.865674853f, 0.380521327f},
-std::array<float,2>{0.26931417f, 0.600904763f},
-std::array<float,2>{0.0660122707f, 0.208701879f},
-std::array<float,2>{0.67883873f, 0.861187756f},
-std::array<float,2>{0.554470599f, 0.117988862f},
-std::array<float,2>{0.218187734f, 0.903233945f},
-std::array<float,2>{0.492782354f, 0.270712614f},
-std::array<float,2>{0.937513411f, 0.728300393f},
-std::array<float,2>{0.921972156f, 0.083710596f},
-std::array<float,2>{0.417289048f, 0.920359373f},
-std::array<float,2>{0.183476463f, 0.297082245f},
-std::array<float,2>{0.601285219f, 0.701337099f},
-std::array<float,2>{0.690481305f, 0.408664674f},
-std::array<float,2>{0.0379447564f, 0.579623878f},
-std::array<float,2>{0.312744141f, 0.225945115f},
-std::array<float,2>{0.806759715f, 0.832464874f},
-std::array<float,2>{0.823531449f, 0.33433941f},
-std::array<float,2>{0.311328024f, 0.664131284f},
-std::array<float,2>{0.122179873f, 0.0233228691f},
-std::array<float,2>{0.630012095f, 0.984869719f},
-std::array<float,2>{0.505809784f, 0.161910936f},
-std::array<float,2>{0.24961555f, 0.753261209f},
-std::array<float,2>{0.458005607f, 0.492091477f},
-std::array<float,2>{0.981666028f, 0.506362021f},
-std::array<float,2>{0.752535641f, 0.213760391f},
-std::array<float,2>{0.356182218f, 0.872342288f},
-std::array<float,2>{0.0171141811f, 0.387777388f},
-std::array<float,2>{0.728582919f, 0.605797172f},
-std::array<float,2>{0.567075968f, 0.278925657f},
-std::array<float,2>{0.15594089f, 0.725785077f},
-std::array<float,2>{0.394098997f, 0.114503674f},
-std::array<float,2>{0.876583993f, 0.89142108f},
-std::array<float,2>{0.958823085f, 0.453959763f},
-std::array<float,2>{0.472756743f, 0.548144996f},
-std::array<float,2>{0.197816119f, 0.127933666f},
-std::array<float,2>{0.544422865f, 0.791726232f},
-std::array<float,2>{0.665284753f, 0.0413565785f},
-std::array<float,2>{0.0855727419f, 0.95588088f},
-std::array<float,2>{0.255298227f, 0.36219573f},
-std::array<float,2>{0.844194531f, 0.639462829f},
-std::array<float,2>{0.859765708f, 0.0014575806f},
-std::array<float,2>{0.270378768f, 0.971939027f},
-std::array<float,2>{0.0675089434f, 0.319346666f},
-std::array<float,2>{0.673392296f, 0.683283448f},
-std::array<float,2>{0.547828913f, 0.471439719f},
-std::array<float,2>{0.213696733f, 0.528464437f},
-std::array<float,2>{0.496724308f, 0.17296885f},
-std::array<float,2>{0.94364512f, 0.775446415f},
-std::array<float,2>{0.892656863f, 0.28328377f},
-std::array<float,2>{0.381622642f, 0.706221402f},
-std::array<float,2>{0.133059084f, 0.0735468343f},
-std::array<float,2>{0.58053124f, 0.923600674f},
-std::array<float,2>{0.742604911f, 0.248896807f},
-std::array<float,2>{0.00111943565f, 0.821141899f},
-std::array<float,2>{0.364586145f, 0.433751136f},
-std::array<float,2>{0.766487181f, 0.573244333f},
-std::array<float,2>{0.987886548f, 0.148209229f},
-std::array<float,2>{0.440160692f, 0.799223006f},
-std::array<float,2>{0.221890077f, 0.450157553f},
-std::array<float,2>{0.515779257f, 0.539218009f},
-std::array<float,2>{0.642624557f, 0.344843805f},
-std::array<float,2>{0.105091743f, 0.6428532f},
-std::array<float,2>{0.285065234f, 0.0562892631f},
-std::array<float,2>{0.839054465f, 0.949403942f},
-std::array<float,2>{0.782256365f, 0.405426949f},
-std::array<float,2>{0.339990079f, 0.623250484f},
-std::array<float,2>{0.0528581142f, 0.192590684f},
-std::array<float,2>{0.704251826f, 0.845542789f},
-std::array<float,2>{0.624673903f, 0.107516676f},
-std::array<float,2>{0.159123495f, 0.886147499f},
-std::array<float,2>{0.427922547f, 0.257666022f},
-std::array<float,2>{0.919048011f, 0.739415824f},
-std::array<float,2>{0.949555576f, 0.0523658581f},
-std::array<float,2>{0.485580742f, 0.944496989f},
-std::array<float,2>{0.203979552f, 0.356042027f},
-std::array<float,2>{0.557957113f, 0.655413985f},
-std::array<float,2>{0.687253833f, 0.441444844f},
-std::array<float,2>{0.0709325522f, 0.531515121f},
-std::array<float,2>{0.279796153f, 0.154312789f},
-std::array<float,2>{0.867438376f, 0.811611712f},
-std::array<float,2>{0.780301988f, 0.260264933f},
-std::array<float,2>{0.372884482f, 0.748317599f},
-std::array<float,2>{0.00881140772f, 0.101064406f},
-std::array<float,2>{0.741376638f, 0.87752521f},
-std::array<float,2>{0.589198649f, 0.199668229f},
-std::array<float,2>{0.131713256f, 0.856620073f},
-std::array<float,2>{0.388224751f, 0.395442456f},
-std::array<float,2>{0.901336372f, 0.613145232f},
-std::array<float,2>{0.830110967f, 0.18457365f},
-std::array<float,2>{0.295302927f, 0.767958343f},
-std::array<float,2>{0.0996303037f, 0.477192461f},
-std::array<float,2>{0.64898634f, 0.519849598f},
-std::array<float,2>{0.526113153f, 0.325976074f},
-std::array<float,2>{0.231148064f, 0.676294625f},
-std::array<float,2>{0.446869671f, 0.0150958952f},
-std::array<float,2>{0.998893082f, 0.980294168f},
-std::array<float,2>{0.90672648f, 0.42535761f},
-std::array<float,2>{0.431164682f, 0.566024542f},
-std::array<float,2>{0.168873742f, 0.241453901f},
-std::array<float,2>{0.610666692f, 0.818032205f},
-std::array<float,2>{0.718147516f, 0.0646949932f},
-std::array<float,2>{0.0582457408f, 0.93321389f},
-std::array<float,2>{0.33458373f, 0.292078912f},
-std::array<float,2>{0.793981493f, 0.710965335f},
-std::array<float,2>{0.801617205f, 0.123923331f},
-std::array<float,2>{0.32648012f, 0.901389897f},
-std::array<float,2>{0.0441313386f, 0.267141879f},
-std::array<float,2>{0.698766947f, 0.730978966f},
-std::array<float,2>{0.608955503f, 0.377175361f},
-std::array<float,2>{0.178731605f, 0.596927762f},
-std::array<float,2>{0.407098204f, 0.204618111f},
-std::array<float,2>{0.935580909f, 0.866365254f},
-std::array<float,2>{0.972198069f, 0.369596928f},
-std::array<float,2>{0.467274725f, 0.631120265f},
-std::array<float,2>{0.239731207f, 0.0321338065f},
-std::array<float,2>{0.510183156f, 0.964783907f},
-std::array<float,2>{0.633765578f, 0.137912303f},
-std::array<float,2>{0.111791007f, 0.783740759f},
-std::array<float,2>{0.303905457f, 0.461893827f},
-std::array<float,2>{0.814157307f, 0.562328756f},
-std::array<float,2>{0.889276683f, 0.230391845f},
-std::array<float,2>{0.405214489f, 0.841908932f},
-std::array<float,2>{0.141766801f, 0.418176174f},
-std::array<float,2>{0.577045977f, 0.586561382f},
-std::array<float,2>{0.720482349f, 0.311189353f},
-std::array<float,2>{0.0274654571f, 0.692915142f},
-std::array<float,2>{0.346995324f, 0.0885951445f},
-std::array<float,2>{0.764104366f, 0.911707342f},
-std::array<float,2>{0.853451312f, 0.492885828f},
-std::array<float,2>{0.265128016f, 0.51040107f},
-std::array<float,2>{0.0920744762f, 0.167348877f},
-std::array<float,2>{0.660160005f, 0.760495842f},
-std::array<float,2>{0.531917691f, 0.0311330073f},
-std::array<float,2>{0.189593986f, 0.998792112f},
-std::array<float,2>{0.484093159f, 0.339013666f},
-std::array<float,2>{0.96365869f, 0.656977415f},
-std::array<float,2>{0.905534565f, 0.0175598357f},
-std::array<float,2>{0.385380268f, 0.991485119f},
-std::array<float,2>{0.125924185f, 0.330095202f},
-std::array<float,2>{0.589880407f, 0.669852912f},
-std::array<float,2>{0.735253572f, 0.48465097f},
-std::array<float,2>{0.0145490682f, 0.50178206f},
-std::array<float,2>{0.367961168f, 0.156363741f},
-std::array<float,2>{0.775197744f, 0.754023135f},
-std::array<float,2>{0.873967469f, 0.302162498f},
-std::array<float,2>{0.277090967f, 0.698147476f},
-std::array<float,2>{0.075390771f, 0.080808349f},
-std::array<float,2>{0.680014729f, 0.917764127f},
-std::array<float,2>{0.560246229f, 0.219971031f},
-std::array<float,2>{0.208712906f, 0.828175902f},
-std::array<float,2>{0.492149442f, 0.410369784f},
-std::array<float,2>{0.947514832f, 0.584411204f},
-std::array<float,2>{0.792451143f, 0.130184025f},
-std::array<float,2>{0.330389291f, 0.796736658f},
-std::array<float,2>{0.060137704f, 0.459855676f},
-std::array<float,2>{0.713408828f, 0.551090837f},
-std::array<float,2>{0.616532207f, 0.363549769f},
-std::array<float,2>{0.166603997f, 0.636510611f},
-std::array<float,2>{0.436365247f, 0.0440559313f},
-std::array<float,2>{0.911414504f, 0.960314929f},
-std::array<float,2>{0.992570162f, 0.384887725f},
-std::array<float,2>{0.450888574f, 0.60486114f},
-std::array<float,2>{0.228528798f, 0.217678666f},
-std::array<float,2>{0.528999209f, 0.869181275f},
-std::array<float,2>{0.653036892f, 0.110418998f},
-std::array<float,2>{0.0961345807f, 0.895474851f},
-std::array<float,2>{0.292199045f, 0.275284946f},
-std::array<float,2>{0.833856046f, 0.720507383f},
-std::array<float,2>{0.819673955f, 0.0779971108f},
-std::array<float,2>{0.296899021f, 0.928446531f},
-std::array<float,2>{0.117136635f, 0.285581082f},
-std::array<float,2>{0.637817919f, 0.710423887f},
-std::array<float,2>{0.513696134f, 0.429914802f},
-std::array<float,2>{0.235513508f, 0.577490568f},
-std::array<float,2>{0.464180619f, 0.245630473f},
-std::array<float,2>{0.973429561f, 0.825891435f},
-std::array<float,2>{0.930564463f, 0.312827259f},
-std::array<float,2>{0.411691666f, 0.684222043f},
-std::array<float,2>{0.173593178f, 0.00552284438f},
-std::array<float,2>{0.603907108f, 0.975490391f},
-std::array<float,2>{0.702407837f, 0.17813541f},
-std::array<float,2>{0.0427073725f, 0.780343831f},
-std::array<float,2>{0.321790487f, 0.475853145f},
-std::array<float,2>{0.799941123f, 0.523439348f},
-std::array<float,2>{0.968230188f, 0.189415127f},
-std::array<float,2>{0.47704339f, 0.849091053f},
-std::array<float,2>{0.193807065f, 0.401413351f},
-std::array<float,2>{0.536494076f, 0.619150758f},
-std::array<float,2>{0.656522453f, 0.252659351f},
-std::array<float,2>{0.0876145214f, 0.737946689f},
-std::array<float,2>{0.261600256f, 0.104603656f},
-std::array<float,2>{0.856725752f, 0.887727022f},
-std::array<float,2>{0.76140821f, 0.447524101f},
-std::array<float,2>{0.348489732f, 0.545432985f},
-std::array<float,2>{0.0255532544f, 0.144082755f},
-std::array<float,2>{0.724979997f, 0.80212599f},
-std::array<float,2>{0.573482156f, 0.0587032326f},
-std::array<float,2>{0.145014882f, 0.945838451f},
-std::array<float,2>{0.402271837f, 0.348384202f},
-std::array<float,2>{0.883651376f, 0.647859156f},
-std::array<float,2>{0.977056146f, 0.0962726101f},
-std::array<float,2>{0.454473466f, 0.881357789f},
-std::array<float,2>{0.242931798f, 0.264443725f},
-std::array<float,2>{0.502796412f, 0.743192792f},
-std::array<float,2>{0.625011802f, 0.393713266f},
-std::array<float,2>{0.118790418f, 0.61524564f},
-std::array<float,2>{0.30744046f, 0.198610678f},
-std::array<float,2>{0.827408731f, 0.854517281f},
-std::array<float,2>{0.808823705f, 0.351740688f},
-std::array<float,2>{0.318610936f, 0.649464369f},
-std::array<float,2>{0.0341082029f, 0.0475840271f},
-std::array<float,2>{0.693674684f, 0.938077748f},
-std::array<float,2>{0.594341338f, 0.149106055f},
-std::array<float,2>{0.185059667f, 0.80810976f},
-std::array<float,2>{0.421173006f, 0.440747231f},
-std::array<float,2>{0.928170264f, 0.536615968f},
-std::array<float,2>{0.848501563f, 0.236284092f},
-std::array<float,2>{0.250172406f, 0.815792561f},
-std::array<float,2>{0.0815759599f, 0.428251356f},
-std::array<float,2>{0.670972407f, 0.567748666f},
-std::array<float,2>{0.540076435f, 0.296814293f},
-std::array<float,2>{0.20074074f, 0.715465069f},
-std::array<float,2>{0.469919086f, 0.0702524185f},
-std::array<float,2>{0.953736544f, 0.934455574f},
-std::array<float,2>{0.882295847f, 0.481911391f},
-std::array<float,2>{0.3969661f, 0.517700851f},
-std::array<float,2>{0.151567623f, 0.182385549f},
-std::array<float,2>{0.564597487f, 0.771029472f},
-std::array<float,2>{0.731128752f, 0.00872945786f},
-std::array<float,2>{0.0204074625f, 0.984060049f},
-std::array<float,2>{0.353196144f, 0.323097587f},
-std::array<float,2>{0.757375479f, 0.672915757f},
-std::array<float,2>{0.771637559f, 0.0387737639f},
-std::array<float,2>{0.362036407f, 0.966774106f},
-std::array<float,2>{0.0059851394f, 0.372666061f},
-std::array<float,2>{0.748287082f, 0.62810874f},
-std::array<float,2>{0.582031488f, 0.46539104f},
-std::array<float,2>{0.140413612f, 0.557003677f},
-std::array<float,2>{0.378408521f, 0.133587047f},
-std::array<float,2>{0.89546746f, 0.787438929f},
-std::array<float,2>{0.939463794f, 0.273259878f},
-std::array<float,2>{0.494682401f, 0.730174839f},
-std::array<float,2>{0.215473309f, 0.119500905f},
-std::array<float,2>{0.551801562f, 0.905633211f},
-std::array<float,2>{0.677136958f, 0.209108204f},
-std::array<float,2>{0.0642626658f, 0.861952424f},
-std::array<float,2>{0.265685558f, 0.382534355f},
-std::array<float,2>{0.863625109f, 0.598284245f},
-std::array<float,2>{0.915392041f, 0.169016421f},
-std::array<float,2>{0.424563855f, 0.76183778f},
-std::array<float,2>{0.161126107f, 0.498652041f},
-std::array<float,2>{0.620406568f, 0.511996567f},
-std::array<float,2>{0.707443595f, 0.341589957f},
-std::array<float,2>{0.049385488f, 0.660300076f},
-std::array<float,2>{0.33868742f, 0.0260230526f},
-std::array<float,2>{0.787427306f, 0.995017588f},
-std::array<float,2>{0.843419611f, 0.414441288f},
-std::array<float,2>{0.288343102f, 0.591743588f},
-std::array<float,2>{0.108403765f, 0.231840029f},
-std::array<float,2>{0.647890747f, 0.83711046f},
-std::array<float,2>{0.521697998f, 0.0916896909f},
-std::array<float,2>{0.224657461f, 0.908328235f},
-std::array<float,2>{0.444535434f, 0.306395262f},
-std::array<float,2>{0.990990341f, 0.690932989f},
-std::array<float,2>{0.886751592f, 0.0883107409f},
-std::array<float,2>{0.403948337f, 0.911234677f},
-std::array<float,2>{0.143187597f, 0.310700625f},
-std::array<float,2>{0.5751248f, 0.692591965f},
-std::array<float,2>{0.722109437f, 0.418853819f},
-std::array<float,2>{0.030602511f, 0.586071134f},
-std::array<float,2>{0.344415992f, 0.22970435f},
-std::array<float,2>{0.76191622f, 0.84256506f},
-std::array<float,2>{0.85526377f, 0.339655608f},
-std::array<float,2>{0.262008011f, 0.656484842f},
-std::array<float,2>{0.089936316f, 0.030622391f},
-std::array<float,2>{0.663330853f, 0.998280942f},
-std::array<float,2>{0.534625947f, 0.167796552f},
-std::array<float,2>{0.189094037f, 0.760235071f},
-std::array<float,2>{0.481212586f, 0.49235177f},
-std::array<float,2>{0.961950004f, 0.509903014f},
-std::array<float,2>{0.8034181f, 0.204522178f},
-std::array<float,2>{0.324340284f, 0.867100775f},
-std::array<float,2>{0.0454431996f, 0.377495646f},
-std::array<float,2>{0.695383668f, 0.597413838f},
-std::array<float,2>{0.605664909f, 0.266780496f},
-std::array<float,2>{0.17678602f, 0.730606496f},
-std::array<float,2>{0.409547359f, 0.123469107f},
-std::array<float,2>{0.934832871f, 0.901924789f},
-std::array<float,2>{0.969230473f, 0.461137384f},
-std::array<float,2>{0.466493309f, 0.561523914f},
-std::array<float,2>{0.241833791f, 0.138517976f},
-std::array<float,2>{0.508134425f, 0.783636212f},
-std::array<float,2>{0.636468887f, 0.0312786177f},
-std::array<float,2>{0.11046835f, 0.964145541f},
-std::array<float,2>{0.301967382f, 0.369637072f},
-std::array<float,2>{0.816230536f, 0.631569445f},
-std::array<float,2>{0.828357399f, 0.0154232578f},
-std::array<float,2>{0.293988913f, 0.979655862f},
-std::array<float,2>{0.0982839093f, 0.32561782f},
-std::array<float,2>{0.65179795f, 0.675807297f},
-std::array<float,2>{0.524722457f, 0.476646632f},
-std::array<float,2>{0.232568964f, 0.520224571f},
-std::array<float,2>{0.448138624f, 0.185371265f},
-std::array<float,2>{0.997538149f, 0.76824069f},
-std::array<float,2>{0.90933162f, 0.292601615f},
-std::array<float,2>{0.432909548f, 0.711787105f},
-std::array<float,2>{0.171491474f, 0.0652283207f},
-std::array<float,2>{0.612019598f, 0.932892263f},
-std::array<float,2>{0.715096235f, 0.241794094f},
-std::array<float,2>{0.0562994033f, 0.817608535f},
-std::array<float,2>{0.332481474f, 0.424979478f},
-std::array<float,2>{0.795993626f, 0.565699041f},
-std::array<float,2>{0.951811552f, 0.154828846f},
-std::array<float,2>{0.488040566f, 0.812170446f},
-std::array<float,2>{0.205838501f, 0.442227215f},
-std::array<float,2>{0.555284441f, 0.531747878f},
-std::array<float,2>{0.68525666f, 0.355478585f},
-std::array<float,2>{0.0728003383f, 0.656123161f},
-std::array<float,2>{0.277545452f, 0.0518290512f},
-std::array<float,2>{0.870503068f, 0.945097506f},
-std::array<float,2>{0.777398467f, 0.394711643f},
-std::array<float,2>{0.374714613f, 0.612730086f},
-std::array<float,2>{0.0114302505f, 0.199869066f},
-std::array<float,2>{0.740111589f, 0.857127666f},
-std::array<float,2>{0.586054862f, 0.101329871f},
-std::array<float,2>{0.130841926f, 0.877098739f},
-std::array<float,2>{0.389152199f, 0.260248959f},
-std::array<float,2>{0.90024972f, 0.748876512f},
-std::array<float,2>{0.985157251f, 0.0561084449f},
-std::array<float,2>{0.437798023f, 0.950152576f},
-std::array<float,2>{0.219872788f, 0.345420778f},
-std::array<float,2>{0.517586112f, 0.643302381f},
-std::array<float,2>{0.641014576f, 0.449346006f},
-std::array<float,2>{0.101773851f, 0.539665043f},
-std::array<float,2>{0.281435281f, 0.147813082f},
-std::array<float,2>{0.83637321f, 0.799545884f},
-std::array<float,2>{0.784404635f, 0.257047355f},
-std::array<float,2>{0.342571408f, 0.740054548f},
-std::array<float,2>{0.0517277792f, 0.108311161f},
-std::array<float,2>{0.706490517f, 0.886303782f},
-std::array<float,2>{0.621536672f, 0.193293542f},
-std::array<float,2>{0.157879055f, 0.844777167f},
-std::array<float,2>{0.4271788f, 0.405842751f},
-std::array<float,2>{0.920831859f, 0.623737395f},
-std::array<float,2>{0.863138855f, 0.173380643f},
-std::array<float,2>{0.272389859f, 0.776322603f},
-std::array<float,2>{0.0697981641f, 0.47108382f},
-std::array<float,2>{0.675477266f, 0.528943598f},
-std::array<float,2>{0.550208151f, 0.320269972f},
-std::array<float,2>{0.211093038f, 0.682756603f},
-std::array<float,2>{0.499724835f, 0.00172154594f},
-std::array<float,2>{0.941625118f, 0.972362399f},
-std::array<float,2>{0.891154349f, 0.434109449f},
-std::array<float,2>{0.380235404f, 0.573852658f},
-std::array<float,2>{0.135112807f, 0.248168394f},
-std::array<float,2>{0.579628885f, 0.820495486f},
-std::array<float,2>{0.745732903f, 0.0737592578f},
-std::array<float,2>{0.00378569891f, 0.922982335f},
-std::array<float,2>{0.365545511f, 0.284049094f},
-std::array<float,2>{0.768535018f, 0.706840456f},
-std::array<float,2>{0.750744581f, 0.115093596f},
-std::array<float,2>{0.359311432f, 0.891092181f},
-std::array<float,2>{0.019008927f, 0.278674215f},
-std::array<float,2>{0.727416933f, 0.726527274f},
-std::array<float,2>{0.569812f, 0.388324142f},
-std::array<float,2>{0.152591944f, 0.606373429f},
-std::array<float,2>{0.391903162f, 0.213215247f},
-std::array<float,2>{0.877022147f, 0.872905612f},
-std::array<float,2>{0.959159791f, 0.361622155f},
-std::array<float,2>{0.47473824f, 0.638957858f},
-std::array<float,2>{0.195491955f, 0.0418794937f},
-std::array<float,2>{0.544997096f, 0.955287158f},
-std::array<float,2>{0.667233765f, 0.128882095f},
-std::array<float,2>{0.0828486085f, 0.791430056f},
-std::array<float,2>{0.256473482f, 0.453296572f},
-std::array<float,2>{0.84696877f, 0.548789024f},
-std::array<float,2>{0.924705267f, 0.226507396f},
-std::array<float,2>{0.415835589f, 0.832544267f},
-std::array<float,2>{0.180467591f, 0.408735216f},
-std::array<float,2>{0.599498212f, 0.579171121f},
-std::array<float,2>{0.687590063f, 0.297574908f},
-std::array<float,2>{0.0367590822f, 0.702058673f},
-std::array<float,2>{0.316071987f, 0.0833738521f},
-std::array<float,2>{0.805895269f, 0.920827508f},
-std::array<float,2>{0.822009981f, 0.491593838f},
-std::array<float,2>{0.309774786f, 0.505892515f},
-std::array<float,2>{0.124412991f, 0.161169872f},
-std::array<float,2>{0.632106364f, 0.753550887f},
-std::array<float,2>{0.506825566f, 0.0226273369f},
-std::array<float,2>{0.247825742f, 0.984424353f},
-std::array<float,2>{0.460416436f, 0.334611744f},
-std::array<float,2>{0.983304918f, 0.66469574f},
-std::array<float,2>{0.917365432f, 0.0258174036f},
-std::array<float,2>{0.42334044f, 0.994525909f},
-std::array<float,2>{0.163620159f, 0.341212988f},
-std::array<float,2>{0.617821574f, 0.660878956f},
-std::array<float,2>{0.710702717f, 0.498509973f},
-std::array<float,2>{0.0473834611f, 0.512505054f},
-std::array<float,2>{0.336856306f, 0.169548601f},
-std::array<float,2>{0.786114812f, 0.762441695f},
-std::array<float,2>{0.841370583f, 0.305723846f},
-std::array<float,2>{0.286802024f, 0.690821767f},
-std::array<float,2>{0.105989724f, 0.0909678563f},
-std::array<float,2>{0.645329773f, 0.908948541f},
-std::array<float,2>{0.519728839f, 0.232134953f},
-std::array<float,2>{0.224549741f, 0.837819159f},
-std::array<float,2>{0.442480743f, 0.41490525f},
-std::array<float,2>{0.988647342f, 0.591152847f},
-std::array<float,2>{0.77097559f, 0.133047611f},
-std::array<float,2>{0.361118764f, 0.787987471f},
-std::array<float,2>{0.00483096251f, 0.464917392f},
-std::array<float,2>{0.747236431f, 0.557467461f},
-std::array<float,2>{0.584615946f, 0.37209475f},
-std::array<float,2>{0.137561172f, 0.628639817f},
-std::array<float,2>{0.375898689f, 0.0381678939f},
-std::array<float,2>{0.897821426f, 0.966271877f},
-std::array<float,2>{0.938012958f, 0.382055968f},
-std::array<float,2>{0.492635518f, 0.598120511f},
-std::array<float,2>{0.218524426f, 0.209552601f},
-std::array<float,2>{0.554051161f, 0.861626029f},
-std::array<float,2>{0.67948097f, 0.119825728f},
-std::array<float,2>{0.0657584667f, 0.905994534f},
-std::array<float,2>{0.268726319f, 0.27249369f},
-std::array<float,2>{0.865908563f, 0.729553998f},
-std::array<float,2>{0.851224005f, 0.0697438195f},
-std::array<float,2>{0.252131492f, 0.933872044f},
-std::array<float,2>{0.0799671337f, 0.296033889f},
-std::array<float,2>{0.668899775f, 0.715241015f},
-std::array<float,2>{0.54184401f, 0.427910835f},
-std::array<float,2>{0.202627823f, 0.567899466f},
-std::array<float,2>{0.472600728f, 0.235527858f},
-std::array<float,2>{0.955542386f, 0.816339791f},
-std::array<float,2>{0.88015449f, 0.322697133f},
-std::array<float,2>{0.395705611f, 0.673703074f},
-std::array<float,2>{0.149745747f, 0.00810825732f},
-std::array<float,2>{0.563648224f, 0.983853459f},
-std::array<float,2>{0.732668459f, 0.181821465f},
-std::array<float,2>{0.0229919199f, 0.770838976f},
-std::array<float,2>{0.353517532f, 0.48199445f},
-std::array<float,2>{0.755515635f, 0.518456697f},
-std::array<float,2>{0.980240941f, 0.198961347f},
-std::array<float,2>{0.455846459f, 0.855439007f},
-std::array<float,2>{0.244487792f, 0.394197434f},
-std::array<float,2>{0.500014544f, 0.615744472f},
-std::array<float,2>{0.627854526f, 0.263833344f},
-std::array<float,2>{0.120387129f, 0.743802786f},
-std::array<float,2>{0.306479365f, 0.0959009305f},
-std::array<float,2>{0.824341416f, 0.88111794f},
-std::array<float,2>{0.811657429f, 0.44103542f},
-std::array<float,2>{0.318283379f, 0.536881626f},
-std::array<float,2>{0.0319297649f, 0.14882572f},
-std::array<float,2>{0.691616237f, 0.807916284f},
-std::array<float,2>{0.59749943f, 0.0472132005f},
-std::array<float,2>{0.18701154f, 0.937949479f},
-std::array<float,2>{0.419073731f, 0.352222413f},
-std::array<float,2>{0.927573681f, 0.649905384f},
-std::array<float,2>{0.965332747f, 0.105357237f},
-std::array<float,2>{0.479592413f, 0.888613701f},
-std::array<float,2>{0.192219973f, 0.252189785f},
-std::array<float,2>{0.538586855f, 0.737602055f},
-std::array<float,2>{0.659382045f, 0.402178913f},
-std::array<float,2>{0.0883054063f, 0.620063603f},
-std::array<float,2>{0.25872913f, 0.188911527f},
-std::array<float,2>{0.857502222f, 0.849169374f},
-std::array<float,2>{0.759349763f, 0.347917587f},
-std::array<float,2>{0.350925446f, 0.648371398f},
-std::array<float,2>{0.0250157621f, 0.0593255386f},
-std::array<float,2>{0.723257303f, 0.945554316f},
-std::array<float,2>{0.571948588f, 0.143812403f},
-std::array<float,2>{0.147821218f, 0.802619815f},
-std::array<float,2>{0.398650289f, 0.448162854f},
-std::array<float,2>{0.885875225f, 0.545023441f},
-std::array<float,2>{0.817358553f, 0.245270193f},
-std::array<float,2>{0.2992782f, 0.825669587f},
-std::array<float,2>{0.114811264f, 0.430281311f},
-std::array<float,2>{0.639297009f, 0.577774644f},
-std::array<float,2>{0.513603747f, 0.286130309f},
-std::array<float,2>{0.23798199f, 0.71086067f},
-std::array<float,2>{0.461143464f, 0.0771602988f},
-std::array<float,2>{0.975762427f, 0.928190887f},
-std::array<float,2>{0.932591438f, 0.476317286f},
-std::array<float,2>{0.413372099f, 0.524268806f},
-std::array<float,2>{0.174357548f, 0.178441569f},
-std::array<float,2>{0.602849305f, 0.781022429f},
-std::array<float,2>{0.699302912f, 0.00526999775f},
-std::array<float,2>{0.0395818017f, 0.974719465f},
-std::array<float,2>{0.323253363f, 0.31333679f},
-std::array<float,2>{0.798282146f, 0.684003532f},
-std::array<float,2>{0.790606558f, 0.044812981f},
-std::array<float,2>{0.328127742f, 0.960469544f},
-std::array<float,2>{0.0614167899f, 0.364088863f},
-std::array<float,2>{0.712833226f, 0.636225224f},
-std::array<float,2>{0.613744557f, 0.459181249f},
-std::array<float,2>{0.165397793f, 0.55151546f},
-std::array<float,2>{0.434882283f, 0.130526707f},
-std::array<float,2>{0.912823558f, 0.796328187f},
-std::array<float,2>{0.995237529f, 0.274788409f},
-std::array<float,2>{0.451837212f, 0.720108926f},
-std::array<float,2>{0.22700046f, 0.111052439f},
-std::array<float,2>{0.530842125f, 0.894853175f},
-std::array<float,2>{0.655564308f, 0.217094705f},
-std::array<float,2>{0.0944406912f, 0.869674265f},
-std::array<float,2>{0.289435536f, 0.385476053f},
-std::array<float,2>{0.834951043f, 0.605401099f},
-std::array<float,2>{0.904003561f, 0.156847671f},
-std::array<float,2>{0.38426289f, 0.754646242f},
-std::array<float,2>{0.128596455f, 0.485275149f},
-std::array<float,2>{0.592389822f, 0.501009226f},
-std::array<float,2>{0.737294972f, 0.330573738f},
-std::array<float,2>{0.012583768f, 0.669188499f},
-std::array<float,2>{0.369516283f, 0.0166481286f},
-std::array<float,2>{0.776002586f, 0.99213624f},
-std::array<float,2>{0.872771978f, 0.411013752f},
-std::array<float,2>{0.275125057f, 0.584935844f},
-std::array<float,2>{0.0775145143f, 0.22027801f},
-std::array<float,2>{0.682301939f, 0.828908145f},
-std::array<float,2>{0.562465787f, 0.080319792f},
-std::array<float,2>{0.209206119f, 0.917275548f},
-std::array<float,2>{0.489992023f, 0.30236578f},
-std::array<float,2>{0.945939362f, 0.697288811f},
-std::array<float,2>{0.93643415f, 0.122676477f},
-std::array<float,2>{0.406611383f, 0.898721039f},
-std::array<float,2>{0.179558858f, 0.268264771f},
-std::array<float,2>{0.608547866f, 0.732994616f},
-std::array<float,2>{0.698303998f, 0.375059813f},
-std::array<float,2>{0.0446851477f, 0.594443321f},
-std::array<float,2>{0.326850563f, 0.20537512f},
-std::array<float,2>{0.801118135f, 0.86380899f},
-std::array<float,2>{0.813631415f, 0.369060427f},
-std::array<float,2>{0.304581255f, 0.630014539f},
-std::array<float,2>{0.111820415f, 0.0339431018f},
-std::array<float,2>{0.632900715f, 0.962149501f},
-std::array<float,2>{0.51041019f, 0.139446989f},
-std::array<float,2>{0.239746526f, 0.783174217f},
-std::array<float,2>{0.467346936f, 0.462896675f},
-std::array<float,2>{0.971958816f, 0.558596313f},
-std::array<float,2>{0.764430642f, 0.22658667f},
-std::array<float,2>{0.347316295f, 0.840802491f},
-std::array<float,2>{0.0278792121f, 0.421098113f},
-std::array<float,2>{0.719892085f, 0.588186562f},
-std::array<float,2>{0.576384962f, 0.309435666f},
-std::array<float,2>{0.142156437f, 0.693499386f},
-std::array<float,2>{0.40448159f, 0.0859609917f},
-std::array<float,2>{0.889159858f, 0.912947059f},
-std::array<float,2>{0.963062167f, 0.495497018f},
-std::array<float,2>{0.483411551f, 0.509020269f},
-std::array<float,2>{0.190297857f, 0.165878028f},
-std::array<float,2>{0.531449854f, 0.75873071f},
-std::array<float,2>{0.660902679f, 0.0277507659f},
-std::array<float,2>{0.0923692957f, 0.99631685f},
-std::array<float,2>{0.265332371f, 0.336887032f},
-std::array<float,2>{0.85265398f, 0.65908742f},
-std::array<float,2>{0.868046045f, 0.0545082763f},
-std::array<float,2>{0.279505968f, 0.943245709f},
-std::array<float,2>{0.0706128702f, 0.358058095f},
-std::array<float,2>{0.686541736f, 0.653143167f},
-std::array<float,2>{0.558342099f, 0.443900585f},
-std::array<float,2>{0.203449935f, 0.53453362f},
-std::array<float,2>{0.48585695f, 0.154198378f},
-std::array<float,2>{0.950111926f, 0.809588194f},
-std::array<float,2>{0.900437474f, 0.259669185f},
-std::array<float,2>{0.387823373f, 0.7461285f},
-std::array<float,2>{0.131342649f, 0.0993545949f},
-std::array<float,2>{0.589802504f, 0.875018418f},
-std::array<float,2>{0.741746247f, 0.202063799f},
-std::array<float,2>{0.00929714832f, 0.857781529f},
-std::array<float,2>{0.372553349f, 0.397141933f},
-std::array<float,2>{0.780773222f, 0.610320449f},
-std::array<float,2>{0.998288453f, 0.186312079f},
-std::array<float,2>{0.446671337f, 0.765837967f},
-std::array<float,2>{0.230646327f, 0.479193866f},
-std::array<float,2>{0.525534034f, 0.522873878f},
-std::array<float,2>{0.648706377f, 0.32806018f},
-std::array<float,2>{0.100265719f, 0.678697228f},
-std::array<float,2>{0.295610785f, 0.0126143508f},
-std::array<float,2>{0.830700278f, 0.978234529f},
-std::array<float,2>{0.794820547f, 0.423637688f},
-std::array<float,2>{0.334244579f, 0.56410414f},
-std::array<float,2>{0.0579073764f, 0.23987776f},
-std::array<float,2>{0.718296587f, 0.81906116f},
-std::array<float,2>{0.611083806f, 0.062642999f},
-std::array<float,2>{0.168137819f, 0.929999173f},
-std::array<float,2>{0.430693835f, 0.289075881f},
-std::array<float,2>{0.906948328f, 0.714322507f},
-std::array<float,2>{0.944235742f, 0.00362834637f},
-std::array<float,2>{0.496287704f, 0.970042706f},
-std::array<float,2>{0.212901458f, 0.316609323f},
-std::array<float,2>{0.547095835f, 0.680344999f},
-std::array<float,2>{0.672948956f, 0.470320672f},
-std::array<float,2>{0.0680927336f, 0.530797362f},
-std::array<float,2>{0.269927084f, 0.17441158f},
-std::array<float,2>{0.859931767f, 0.775355935f},
-std::array<float,2>{0.765701294f, 0.282431275f},
-std::array<float,2>{0.36499992f, 0.704908669f},
-std::array<float,2>{0.00176385266f, 0.0712210536f},
-std::array<float,2>{0.742928624f, 0.925759375f},
-std::array<float,2>{0.581027269f, 0.246135026f},
-std::array<float,2>{0.133625552f, 0.82240814f},
-std::array<float,2>{0.381078392f, 0.437376052f},
-std::array<float,2>{0.89328295f, 0.571004629f},
-std::array<float,2>{0.839510739f, 0.145943046f},
-std::array<float,2>{0.284409285f, 0.7970258f},
-std::array<float,2>{0.104513213f, 0.452034742f},
-std::array<float,2>{0.643198609f, 0.541095436f},
-std::array<float,2>{0.516238034f, 0.345907509f},
-std::array<float,2>{0.222474083f, 0.64235574f},
-std::array<float,2>{0.439789265f, 0.0573846102f},
-std::array<float,2>{0.987447143f, 0.951671958f},
-std::array<float,2>{0.919708729f, 0.402919114f},
-std::array<float,2>{0.428321421f, 0.622651756f},
-std::array<float,2>{0.158484504f, 0.194188923f},
-std::array<float,2>{0.624247611f, 0.846220791f},
-std::array<float,2>{0.705060363f, 0.10616336f},
-std::array<float,2>{0.0535764173f, 0.883039415f},
-std::array<float,2>{0.340350509f, 0.254885644f},
-std::array<float,2>{0.782728851f, 0.741416752f},
-std::array<float,2>{0.807189405f, 0.0851091668f},
-std::array<float,2>{0.313205302f, 0.919105589f},
-std::array<float,2>{0.0375761539f, 0.300770223f},
-std::array<float,2>{0.691079021f, 0.700817883f},
-std::array<float,2>{0.600939691f, 0.407363564f},
-std::array<float,2>{0.182986528f, 0.580458641f},
-std::array<float,2>{0.41780597f, 0.224336118f},
-std::array<float,2>{0.92248404f, 0.835865617f},
-std::array<float,2>{0.982007802f, 0.332844585f},
-std::array<float,2>{0.457218111f, 0.6666466f},
-std::array<float,2>{0.249381647f, 0.0199298132f},
-std::array<float,2>{0.505090475f, 0.986453295f},
-std::array<float,2>{0.630417764f, 0.164061189f},
-std::array<float,2>{0.122842491f, 0.75031805f},
-std::array<float,2>{0.311000049f, 0.489179671f},
-std::array<float,2>{0.823831677f, 0.504100382f},
-std::array<float,2>{0.876413584f, 0.212838918f},
-std::array<float,2>{0.393610656f, 0.874792516f},
-std::array<float,2>{0.155734032f, 0.388733476f},
-std::array<float,2>{0.566838682f, 0.607554138f},
-std::array<float,2>{0.729456842f, 0.280438095f},
-std::array<float,2>{0.0169141237f, 0.724074304f},
-std::array<float,2>{0.355494082f, 0.115679868f},
-std::array<float,2>{0.752055764f, 0.893417001f},
-std::array<float,2>{0.844264269f, 0.456911474f},
-std::array<float,2>{0.255463451f, 0.54911226f},
-std::array<float,2>{0.0851937011f, 0.125344828f},
-std::array<float,2>{0.665732503f, 0.790021181f},
-std::array<float,2>{0.544604778f, 0.039758604f},
-std::array<float,2>{0.197430432f, 0.954958379f},
-std::array<float,2>{0.473447412f, 0.359444916f},
-std::array<float,2>{0.958255053f, 0.638056517f},
-std::array<float,2>{0.894736588f, 0.036814414f},
-std::array<float,2>{0.37842378f, 0.967693567f},
-std::array<float,2>{0.139759213f, 0.373097807f},
-std::array<float,2>{0.582658052f, 0.626659453f},
-std::array<float,2>{0.748577774f, 0.467978686f},
-std::array<float,2>{0.00667729042f, 0.555646062f},
-std::array<float,2>{0.36152491f, 0.135966733f},
-std::array<float,2>{0.77231729f, 0.786084175f},
-std::array<float,2>{0.863983154f, 0.27140981f},
-std::array<float,2>{0.266350627f, 0.727921903f},
-std::array<float,2>{0.0636267215f, 0.117454782f},
-std::array<float,2>{0.677436054f, 0.902754188f},
-std::array<float,2>{0.552355647f, 0.208308816f},
-std::array<float,2>{0.215237454f, 0.86038655f},
-std::array<float,2>{0.494302273f, 0.380161226f},
-std::array<float,2>{0.940202415f, 0.601369083f},
-std::array<float,2>{0.787969649f, 0.171283901f},
-std::array<float,2>{0.3383196f, 0.765586853f},
-std::array<float,2>{0.0488628484f, 0.497307599f},
-std::array<float,2>{0.707971871f, 0.514507115f},
-std::array<float,2>{0.620765269f, 0.341943175f},
-std::array<float,2>{0.160605058f, 0.663110673f},
-std::array<float,2>{0.4240399f, 0.0251363665f},
-std::array<float,2>{0.915672719f, 0.992584407f},
-std::array<float,2>{0.990492046f, 0.41760391f},
-std::array<float,2>{0.445162505f, 0.592058063f},
-std::array<float,2>{0.225457847f, 0.233527154f},
-std::array<float,2>{0.522324443f, 0.838733733f},
-std::array<float,2>{0.64811939f, 0.0937439352f},
-std::array<float,2>{0.109228127f, 0.906754792f},
-std::array<float,2>{0.288909227f, 0.30712533f},
-std::array<float,2>{0.842867732f, 0.688997984f},
-std::array<float,2>{0.828051984f, 0.0939780697f},
-std::array<float,2>{0.307075888f, 0.879107475f},
-std::array<float,2>{0.118301846f, 0.262061745f},
-std::array<float,2>{0.62555629f, 0.745946646f},
-std::array<float,2>{0.502407968f, 0.391612649f},
-std::array<float,2>{0.242457539f, 0.615070701f},
-std::array<float,2>{0.45476079f, 0.196038783f},
-std::array<float,2>{0.976828218f, 0.853145897f},
-std::array<float,2>{0.92851001f, 0.354208022f},
-std::array<float,2>{0.421800822f, 0.651938736f},
-std::array<float,2>{0.184712574f, 0.0493155122f},
-std::array<float,2>{0.593972445f, 0.941102386f},
-std::array<float,2>{0.694077075f, 0.152100787f},
-std::array<float,2>{0.0334032103f, 0.806012869f},
-std::array<float,2>{0.319107652f, 0.437831789f},
-std::array<float,2>{0.809253573f, 0.537722826f},
-std::array<float,2>{0.953275681f, 0.236819908f},
-std::array<float,2>{0.47040686f, 0.812815189f},
-std::array<float,2>{0.20034489f, 0.425826252f},
-std::array<float,2>{0.54101032f, 0.569957674f},
-std::array<float,2>{0.671456039f, 0.293757439f},
-std::array<float,2>{0.0811205283f, 0.716801405f},
-std::array<float,2>{0.250644773f, 0.0666317269f},
-std::array<float,2>{0.847776115f, 0.936086655f},
-std::array<float,2>{0.757237494f, 0.483004332f},
-std::array<float,2>{0.352977544f, 0.517522633f},
-std::array<float,2>{0.01980526f, 0.179748461f},
-std::array<float,2>{0.730531812f, 0.773088098f},
-std::array<float,2>{0.565371692f, 0.0103066899f},
-std::array<float,2>{0.152205795f, 0.981538117f},
-std::array<float,2>{0.397094071f, 0.320480525f},
-std::array<float,2>{0.882812083f, 0.674777627f},
-std::array<float,2>{0.973095894f, 0.0759806633f},
-std::array<float,2>{0.464590579f, 0.926878154f},
-std::array<float,2>{0.236250952f, 0.288663626f},
-std::array<float,2>{0.51463747f, 0.707069933f},
-std::array<float,2>{0.638460755f, 0.43182525f},
-std::array<float,2>{0.116233744f, 0.575417161f},
-std::array<float,2>{0.297565103f, 0.242704809f},
-std::array<float,2>{0.820116222f, 0.827973783f},
-std::array<float,2>{0.800565302f, 0.315882772f},
-std::array<float,2>{0.321756899f, 0.686813533f},
-std::array<float,2>{0.042003531f, 0.00726548024f},
-std::array<float,2>{0.702726543f, 0.973033547f},
-std::array<float,2>{0.604452193f, 0.176638797f},
-std::array<float,2>{0.172875866f, 0.778074861f},
-std::array<float,2>{0.41151914f, 0.473873317f},
-std::array<float,2>{0.930043221f, 0.525979638f},
-std::array<float,2>{0.857223213f, 0.191292778f},
-std::array<float,2>{0.261223435f, 0.84965694f},
-std::array<float,2>{0.0871006325f, 0.39971593f},
-std::array<float,2>{0.656828582f, 0.61814642f},
-std::array<float,2>{0.536646843f, 0.250967354f},
-std::array<float,2>{0.194059595f, 0.735552251f},
-std::array<float,2>{0.477083027f, 0.101616614f},
-std::array<float,2>{0.968527675f, 0.890218854f},
-std::array<float,2>{0.882854521f, 0.445664346f},
-std::array<float,2>{0.401667476f, 0.543625534f},
-std::array<float,2>{0.145182744f, 0.141589522f},
-std::array<float,2>{0.573998153f, 0.804427862f},
-std::array<float,2>{0.725448132f, 0.0606091358f},
-std::array<float,2>{0.0260569528f, 0.948174238f},
-std::array<float,2>{0.348142445f, 0.349977165f},
-std::array<float,2>{0.760935724f, 0.644858181f},
-std::array<float,2>{0.774546742f, 0.0180856325f},
-std::array<float,2>{0.367275834f, 0.988497794f},
-std::array<float,2>{0.0137523375f, 0.329395413f},
-std::array<float,2>{0.734626174f, 0.671292543f},
-std::array<float,2>{0.590470791f, 0.487123996f},
-std::array<float,2>{0.125135019f, 0.502285719f},
-std::array<float,2>{0.38481304f, 0.158963948f},
-std::array<float,2>{0.906039894f, 0.756165683f},
-std::array<float,2>{0.947755814f, 0.302862287f},
-std::array<float,2>{0.491341799f, 0.697027564f},
-std::array<float,2>{0.20824784f, 0.0793969557f},
-std::array<float,2>{0.559823573f, 0.914905071f},
-std::array<float,2>{0.680533648f, 0.221709847f},
-std::array<float,2>{0.0760592818f, 0.830875456f},
-std::array<float,2>{0.276676327f, 0.413029999f},
-std::array<float,2>{0.873071373f, 0.58319062f},
-std::array<float,2>{0.911730766f, 0.131029457f},
-std::array<float,2>{0.435724229f, 0.794575214f},
-std::array<float,2>{0.166362122f, 0.458480537f},
-std::array<float,2>{0.616959631f, 0.553768814f},
-std::array<float,2>{0.713046908f, 0.366621912f},
-std::array<float,2>{0.0600567646f, 0.634159565f},
-std::array<float,2>{0.331044286f, 0.045519527f},
-std::array<float,2>{0.792883515f, 0.958480537f},
-std::array<float,2>{0.833032429f, 0.383547902f},
-std::array<float,2>{0.292677075f, 0.602167845f},
-std::array<float,2>{0.0965704173f, 0.216154069f},
-std::array<float,2>{0.652701378f, 0.869075418f},
-std::array<float,2>{0.528469145f, 0.111872382f},
-std::array<float,2>{0.229480177f, 0.896940231f},
-std::array<float,2>{0.450480729f, 0.276411146f},
-std::array<float,2>{0.992835522f, 0.722067893f},
-std::array<float,2>{0.898465097f, 0.0985667631f},
-std::array<float,2>{0.389998704f, 0.876021445f},
-std::array<float,2>{0.129705772f, 0.258229315f},
-std::array<float,2>{0.587686241f, 0.747502923f},
-std::array<float,2>{0.738379955f, 0.397938043f},
-std::array<float,2>{0.0104065686f, 0.611075938f},
-std::array<float,2>{0.373810589f, 0.202955768f},
-std::array<float,2>{0.778561473f, 0.859146774f},
-std::array<float,2>{0.869432211f, 0.358608931f},
-std::array<float,2>{0.2783297f, 0.654216647f},
-std::array<float,2>{0.0738107711f, 0.0535934232f},
-std::array<float,2>{0.684354305f, 0.942221224f},
-std::array<float,2>{0.555992544f, 0.152622119f},
-std::array<float,2>{0.206055462f, 0.809497416f},
-std::array<float,2>{0.486536205f, 0.444840342f},
-std::array<float,2>{0.952629983f, 0.534157693f},
-std::array<float,2>{0.795338213f, 0.239103645f},
-std::array<float,2>{0.333806753f, 0.820247293f},
-std::array<float,2>{0.0548658855f, 0.422178656f},
-std::array<float,2>{0.716748476f, 0.563251376f},
-std::array<float,2>{0.612586617f, 0.290098339f},
-std::array<float,2>{0.170432821f, 0.713798642f},
-std::array<float,2>{0.431982726f, 0.0638244227f},
-std::array<float,2>{0.90888387f, 0.931435585f},
-std::array<float,2>{0.99654603f, 0.479831278f},
-std::array<float,2>{0.449037135f, 0.522434533f},
-std::array<float,2>{0.233448133f, 0.187051132f},
-std::array<float,2>{0.524164736f, 0.767358124f},
-std::array<float,2>{0.650967956f, 0.0127362162f},
-std::array<float,2>{0.0990745276f, 0.976657152f},
-std::array<float,2>{0.293889821f, 0.326284647f},
-std::array<float,2>{0.829258382f, 0.67889446f},
-std::array<float,2>{0.814480901f, 0.0342359915f},
-std::array<float,2>{0.301174641f, 0.961889744f},
-std::array<float,2>{0.110175729f, 0.368087322f},
-std::array<float,2>{0.635136724f, 0.629244208f},
-std::array<float,2>{0.509081423f, 0.464085013f},
-std::array<float,2>{0.240917757f, 0.559956849f},
-std::array<float,2>{0.46567744f, 0.140229359f},
-std::array<float,2>{0.970212519f, 0.781693339f},
-std::array<float,2>{0.934052408f, 0.268712699f},
-std::array<float,2>{0.40874514f, 0.734181702f},
-std::array<float,2>{0.175870404f, 0.121317223f},
-std::array<float,2>{0.606843591f, 0.899787843f},
-std::array<float,2>{0.696295977f, 0.20673272f},
-std::array<float,2>{0.0460464694f, 0.864326f},
-std::array<float,2>{0.326061428f, 0.376512229f},
-std::array<float,2>{0.804061949f, 0.594897747f},
-std::array<float,2>{0.961660683f, 0.164535195f},
-std::array<float,2>{0.481764674f, 0.758843303f},
-std::array<float,2>{0.187965661f, 0.494262934f},
-std::array<float,2>{0.533871412f, 0.50842315f},
-std::array<float,2>{0.663028955f, 0.337210894f},
-std::array<float,2>{0.0917483643f, 0.659971356f},
-std::array<float,2>{0.263474137f, 0.0285342596f},
-std::array<float,2>{0.854423165f, 0.997459292f},
-std::array<float,2>{0.763197958f, 0.42030412f},
-std::array<float,2>{0.344776422f, 0.589704573f},
-std::array<float,2>{0.0298473332f, 0.228339896f},
-std::array<float,2>{0.72073704f, 0.841137588f},
-std::array<float,2>{0.576157689f, 0.0873900428f},
-std::array<float,2>{0.143663511f, 0.913171053f},
-std::array<float,2>{0.402778834f, 0.309875906f},
-std::array<float,2>{0.888436556f, 0.69479531f},
-std::array<float,2>{0.984284759f, 0.0213778745f},
-std::array<float,2>{0.459766567f, 0.988136947f},
-std::array<float,2>{0.246127278f, 0.333602488f},
-std::array<float,2>{0.506963372f, 0.667269588f},
-std::array<float,2>{0.631294847f, 0.489480942f},
-std::array<float,2>{0.123952866f, 0.505189896f},
-std::array<float,2>{0.308881521f, 0.163085476f},
-std::array<float,2>{0.821105897f, 0.751412153f},
-std::array<float,2>{0.805013359f, 0.299123228f},
-std::array<float,2>{0.315189034f, 0.699761868f},
-std::array<float,2>{0.0355454013f, 0.0849063247f},
-std::array<float,2>{0.688861191f, 0.918233097f},
-std::array<float,2>{0.598213434f, 0.223486692f},
-std::array<float,2>{0.180773273f, 0.834695578f},
-std::array<float,2>{0.414416939f, 0.406665802f},
-std::array<float,2>{0.925554633f, 0.581828356f},
-std::array<float,2>{0.845780492f, 0.126055688f},
-std::array<float,2>{0.257487178f, 0.790251672f},
-std::array<float,2>{0.0835145712f, 0.455611467f},
-std::array<float,2>{0.666619599f, 0.550712168f},
-std::array<float,2>{0.546177626f, 0.360827833f},
-std::array<float,2>{0.196681455f, 0.637096822f},
-std::array<float,2>{0.476300299f, 0.0408999063f},
-std::array<float,2>{0.960564971f, 0.954042435f},
-std::array<float,2>{0.87835294f, 0.389770806f},
-std::array<float,2>{0.39086175f, 0.608859718f},
-std::array<float,2>{0.153520688f, 0.211705655f},
-std::array<float,2>{0.569283009f, 0.87386328f},
-std::array<float,2>{0.728342533f, 0.116688982f},
-std::array<float,2>{0.0181461256f, 0.893754601f},
-std::array<float,2>{0.357449234f, 0.279784411f},
-std::array<float,2>{0.751295269f, 0.723606646f},
-std::array<float,2>{0.769266903f, 0.0722296685f},
-std::array<float,2>{0.366921544f, 0.924112022f},
-std::array<float,2>{0.00281708455f, 0.281442732f},
-std::array<float,2>{0.744346917f, 0.703315258f},
-std::array<float,2>{0.578611612f, 0.436451346f},
-std::array<float,2>{0.136204123f, 0.571643233f},
-std::array<float,2>{0.379064083f, 0.247186363f},
-std::array<float,2>{0.89244312f, 0.823818803f},
-std::array<float,2>{0.943252325f, 0.318022817f},
-std::array<float,2>{0.498648524f, 0.681321025f},
-std::array<float,2>{0.212676764f, 0.00276601082f},
-std::array<float,2>{0.548956871f, 0.968834281f},
-std::array<float,2>{0.674373806f, 0.175136551f},
-std::array<float,2>{0.0693261996f, 0.774132133f},
-std::array<float,2>{0.273327589f, 0.468752414f},
-std::array<float,2>{0.861530483f, 0.529958725f},
-std::array<float,2>{0.921473145f, 0.194852173f},
-std::array<float,2>{0.426038474f, 0.847217441f},
-std::array<float,2>{0.156544179f, 0.403623998f},
-std::array<float,2>{0.622122526f, 0.621877849f},
-std::array<float,2>{0.70603317f, 0.254267246f},
-std::array<float,2>{0.0521204174f, 0.740244091f},
-std::array<float,2>{0.34328115f, 0.106657267f},
-std::array<float,2>{0.783896267f, 0.884379148f},
-std::array<float,2>{0.837353289f, 0.452816069f},
-std::array<float,2>{0.282660127f, 0.542792797f},
-std::array<float,2>{0.102987953f, 0.145282432f},
-std::array<float,2>{0.642443776f, 0.79873538f},
-std::array<float,2>{0.519276857f, 0.0584604219f},
-std::array<float,2>{0.219064206f, 0.952958107f},
-std::array<float,2>{0.439136982f, 0.347140789f},
-std::array<float,2>{0.985382199f, 0.641116619f},
-std::array<float,2>{0.926002085f, 0.0500607379f},
-std::array<float,2>{0.418174446f, 0.940412402f},
-std::array<float,2>{0.186029598f, 0.354571372f},
-std::array<float,2>{0.595853865f, 0.650901198f},
-std::array<float,2>{0.6928671f, 0.438834548f},
-std::array<float,2>{0.0331397578f, 0.538879275f},
-std::array<float,2>{0.316620559f, 0.151114047f},
-std::array<float,2>{0.811028183f, 0.805588186f},
-std::array<float,2>{0.82612592f, 0.263311446f},
-std::array<float,2>{0.305285692f, 0.745084882f},
-std::array<float,2>{0.119473614f, 0.0954975411f},
-std::array<float,2>{0.628387511f, 0.880786061f},
-std::array<float,2>{0.501910865f, 0.196818039f},
-std::array<float,2>{0.245212406f, 0.852324069f},
-std::array<float,2>{0.456633806f, 0.391274005f},
-std::array<float,2>{0.978730381f, 0.613683522f},
-std::array<float,2>{0.754324019f, 0.181392759f},
-std::array<float,2>{0.355264097f, 0.771979511f},
-std::array<float,2>{0.0216601659f, 0.48405382f},
-std::array<float,2>{0.734024286f, 0.515989959f},
-std::array<float,2>{0.563408434f, 0.321379781f},
-std::array<float,2>{0.149189025f, 0.675589502f},
-std::array<float,2>{0.39484629f, 0.0112789217f},
-std::array<float,2>{0.87942189f, 0.980546236f},
-std::array<float,2>{0.957026124f, 0.427057952f},
-std::array<float,2>{0.471249938f, 0.568506062f},
-std::array<float,2>{0.201381966f, 0.238081232f},
-std::array<float,2>{0.542183697f, 0.814211071f},
-std::array<float,2>{0.669203877f, 0.0679194033f},
-std::array<float,2>{0.0790829211f, 0.936867416f},
-std::array<float,2>{0.253259897f, 0.294783413f},
-std::array<float,2>{0.850297511f, 0.718056381f},
-std::array<float,2>{0.866495669f, 0.11848525f},
-std::array<float,2>{0.268050671f, 0.904132605f},
-std::array<float,2>{0.0646488518f, 0.270139277f},
-std::array<float,2>{0.678664923f, 0.72697705f},
-std::array<float,2>{0.553623736f, 0.379393131f},
-std::array<float,2>{0.216989443f, 0.599830449f},
-std::array<float,2>{0.493977875f, 0.207160637f},
-std::array<float,2>{0.939366519f, 0.859987736f},
-std::array<float,2>{0.896801174f, 0.374165416f},
-std::array<float,2>{0.376271814f, 0.62586844f},
-std::array<float,2>{0.137975588f, 0.0360841118f},
-std::array<float,2>{0.58585304f, 0.967910945f},
-std::array<float,2>{0.746545494f, 0.134869114f},
-std::array<float,2>{0.00556116505f, 0.787028909f},
-std::array<float,2>{0.359459251f, 0.467363805f},
-std::array<float,2>{0.769948065f, 0.556043446f},
-std::array<float,2>{0.989645481f, 0.233151287f},
-std::array<float,2>{0.442319602f, 0.839774132f},
-std::array<float,2>{0.222729757f, 0.416582942f},
-std::array<float,2>{0.520686269f, 0.593182683f},
-std::array<float,2>{0.646319211f, 0.307783246f},
-std::array<float,2>{0.107246503f, 0.687545538f},
-std::array<float,2>{0.285257041f, 0.0923470855f},
-std::array<float,2>{0.840109408f, 0.90778631f},
-std::array<float,2>{0.786516964f, 0.496258348f},
-std::array<float,2>{0.337256759f, 0.51516825f},
-std::array<float,2>{0.0487038754f, 0.170241565f},
-std::array<float,2>{0.709747672f, 0.764519036f},
-std::array<float,2>{0.618233144f, 0.0237263478f},
-std::array<float,2>{0.162365168f, 0.993614614f},
-std::array<float,2>{0.42275095f, 0.343268365f},
-std::array<float,2>{0.916927338f, 0.662202179f},
-std::array<float,2>{0.947153151f, 0.0783472583f},
-std::array<float,2>{0.489182591f, 0.915476024f},
-std::array<float,2>{0.210202947f, 0.304654777f},
-std::array<float,2>{0.560596526f, 0.696233273f},
-std::array<float,2>{0.683067441f, 0.413491547f},
-std::array<float,2>{0.0768683702f, 0.582363427f},
-std::array<float,2>{0.273651093f, 0.221331701f},
-std::array<float,2>{0.871923864f, 0.831372619f},
-std::array<float,2>{0.777324557f, 0.328732401f},
-std::array<float,2>{0.370839745f, 0.670440912f},
-std::array<float,2>{0.0127596892f, 0.0188552756f},
-std::array<float,2>{0.737791181f, 0.989696205f},
-std::array<float,2>{0.592845798f, 0.159208193f},
-std::array<float,2>{0.127165288f, 0.75693363f},
-std::array<float,2>{0.383110315f, 0.487502217f},
-std::array<float,2>{0.90287596f, 0.503663898f},
-std::array<float,2>{0.83515662f, 0.215584159f},
-std::array<float,2>{0.29080233f, 0.867420495f},
-std::array<float,2>{0.0953601152f, 0.383854419f},
-std::array<float,2>{0.654357374f, 0.603261709f},
-std::array<float,2>{0.529586196f, 0.276155859f},
-std::array<float,2>{0.227622598f, 0.721663713f},
-std::array<float,2>{0.452420533f, 0.112731472f},
-std::array<float,2>{0.994153142f, 0.897852957f},
-std::array<float,2>{0.913586855f, 0.457385898f},
-std::array<float,2>{0.433897883f, 0.55363065f},
-std::array<float,2>{0.165033862f, 0.132085159f},
-std::array<float,2>{0.614283502f, 0.793319285f},
-std::array<float,2>{0.710964382f, 0.0465200283f},
-std::array<float,2>{0.0623794682f, 0.957927227f},
-std::array<float,2>{0.329483896f, 0.365329266f},
-std::array<float,2>{0.789474905f, 0.633463562f},
-std::array<float,2>{0.797193646f, 0.00610456336f},
-std::array<float,2>{0.322624236f, 0.974389195f},
-std::array<float,2>{0.0406572521f, 0.315154105f},
-std::array<float,2>{0.700848877f, 0.685559452f},
-std::array<float,2>{0.60215205f, 0.473231077f},
-std::array<float,2>{0.175038785f, 0.526803911f},
-std::array<float,2>{0.412259758f, 0.177559152f},
-std::array<float,2>{0.932938814f, 0.778878093f},
-std::array<float,2>{0.97523129f, 0.287979513f},
-std::array<float,2>{0.462538242f, 0.708904684f},
-std::array<float,2>{0.236507088f, 0.074555032f},
-std::array<float,2>{0.512010515f, 0.925954044f},
-std::array<float,2>{0.640129983f, 0.243566379f},
-std::array<float,2>{0.113592044f, 0.826227188f},
-std::array<float,2>{0.29993546f, 0.433302581f},
-std::array<float,2>{0.81764102f, 0.575192273f},
-std::array<float,2>{0.885495067f, 0.142494589f},
-std::array<float,2>{0.400173366f, 0.803083718f},
-std::array<float,2>{0.146648765f, 0.446506888f},
-std::array<float,2>{0.570469379f, 0.544732213f},
-std::array<float,2>{0.72438854f, 0.351038933f},
-std::array<float,2>{0.0236730594f, 0.645781398f},
-std::array<float,2>{0.350466341f, 0.0619686432f},
-std::array<float,2>{0.758261919f, 0.949019372f},
-std::array<float,2>{0.859353364f, 0.398786575f},
-std::array<float,2>{0.259164214f, 0.618968844f},
-std::array<float,2>{0.089528963f, 0.190214172f},
-std::array<float,2>{0.658239961f, 0.851520896f},
-std::array<float,2>{0.537673771f, 0.103378579f},
-std::array<float,2>{0.193354666f, 0.888744235f},
-std::array<float,2>{0.478698939f, 0.251098007f},
-std::array<float,2>{0.966335237f, 0.735277712f},
-std::array<float,2>{0.907342076f, 0.0658447444f},
-std::array<float,2>{0.430448294f, 0.932578385f},
-std::array<float,2>{0.169615239f, 0.291243434f},
-std::array<float,2>{0.609758914f, 0.712278068f},
-std::array<float,2>{0.717764676f, 0.424373418f},
-std::array<float,2>{0.0569730215f, 0.564939201f},
-std::array<float,2>{0.335885644f, 0.240268901f},
-std::array<float,2>{0.793222606f, 0.817367911f},
-std::array<float,2>{0.831626296f, 0.324578017f},
-std::array<float,2>{0.296038479f, 0.677645087f},
-std::array<float,2>{0.101523928f, 0.0143377725f},
-std::array<float,2>{0.649753094f, 0.978817165f},
-std::array<float,2>{0.526392877f, 0.183876544f},
-std::array<float,2>{0.231499404f, 0.768841267f},
-std::array<float,2>{0.445727646f, 0.478053421f},
-std::array<float,2>{1.0f, 0.520866692f},
-std::array<float,2>{0.779899716f, 0.201081306f},
-std::array<float,2>{0.371728957f, 0.85550034f},
-std::array<float,2>{0.00802015793f, 0.395960212f},
-std::array<float,2>{0.740888953f, 0.612199187f},
-std::array<float,2>{0.587948203f, 0.260814726f},
-std::array<float,2>{0.132680267f, 0.749967098f},
-std::array<float,2>{0.386948526f, 0.0999178588f},
-std::array<float,2>{0.90159899f, 0.878607392f},
-std::array<float,2>{0.950633705f, 0.443054169f},
-std::array<float,2>{0.485193193f, 0.532277226f},
-std::array<float,2>{0.204518899f, 0.155638546f},
-std::array<float,2>{0.557219207f, 0.810999632f},
-std::array<float,2>{0.686180234f, 0.050978139f},
-std::array<float,2>{0.0716458485f, 0.944292665f},
-std::array<float,2>{0.280670613f, 0.357111216f},
-std::array<float,2>{0.869062543f, 0.655069947f},
-std::array<float,2>{0.851787031f, 0.0295698252f},
-std::array<float,2>{0.264542878f, 0.999671042f},
-std::array<float,2>{0.0933229402f, 0.338576078f},
-std::array<float,2>{0.661274135f, 0.6578601f},
-std::array<float,2>{0.532529354f, 0.493471265f},
-std::array<float,2>{0.191358984f, 0.511669934f},
-std::array<float,2>{0.482907861f, 0.16644004f},
-std::array<float,2>{0.964609027f, 0.761681736f},
-std::array<float,2>{0.890022635f, 0.311751425f},
-std::array<float,2>{0.40609768f, 0.691640377f},
-std::array<float,2>{0.140876114f, 0.0897690281f},
-std::array<float,2>{0.577592671f, 0.910272479f},
-std::array<float,2>{0.718853772f, 0.228652835f},
-std::array<float,2>{0.0284532364f, 0.842837036f},
-std::array<float,2>{0.346216828f, 0.4189533f},
-std::array<float,2>{0.765569031f, 0.587096512f},
-std::array<float,2>{0.971107304f, 0.137118876f},
-std::array<float,2>{0.468747139f, 0.784483075f},
-std::array<float,2>{0.239059582f, 0.46274507f},
-std::array<float,2>{0.511163533f, 0.561009586f},
-std::array<float,2>{0.634392202f, 0.370743871f},
-std::array<float,2>{0.113279089f, 0.632065415f},
-std::array<float,2>{0.303486466f, 0.0330406986f},
-std::array<float,2>{0.813303411f, 0.96310991f},
-std::array<float,2>{0.802333295f, 0.378786892f},
-std::array<float,2>{0.327743471f, 0.595719159f},
-std::array<float,2>{0.0434669964f, 0.204048991f},
-std::array<float,2>{0.698237479f, 0.865436494f},
-std::array<float,2>{0.607993126f, 0.12492568f},
-std::array<float,2>{0.178619817f, 0.901245296f},
-std::array<float,2>{0.407288909f, 0.266254246f},
-std::array<float,2>{0.936558843f, 0.731829286f},
-std::array<float,2>{0.957589746f, 0.0428785421f},
-std::array<float,2>{0.474027812f, 0.956215858f},
-std::array<float,2>{0.198362052f, 0.362733364f},
-std::array<float,2>{0.543163776f, 0.639946878f},
-std::array<float,2>{0.664852381f, 0.45418787f},
-std::array<float,2>{0.0842813626f, 0.547586143f},
-std::array<float,2>{0.254849643f, 0.127087876f},
-std::array<float,2>{0.844919443f, 0.792330146f},
-std::array<float,2>{0.753423691f, 0.278092057f},
-std::array<float,2>{0.356540501f, 0.725304544f},
-std::array<float,2>{0.0156287961f, 0.114216357f},
-std::array<float,2>{0.729705572f, 0.891691566f},
-std::array<float,2>{0.567946911f, 0.214593753f},
-std::array<float,2>{0.154317975f, 0.871496618f},
-std::array<float,2>{0.393032193f, 0.387355655f},
-std::array<float,2>{0.875733912f, 0.606937885f},
-std::array<float,2>{0.822301269f, 0.160356179f},
-std::array<float,2>{0.311877728f, 0.752597451f},
-std::array<float,2>{0.122032091f, 0.491086543f},
-std::array<float,2>{0.629128814f, 0.50755173f},
-std::array<float,2>{0.504382432f, 0.335290492f},
-std::array<float,2>{0.248781234f, 0.665549695f},
-std::array<float,2>{0.458107203f, 0.0223718174f},
-std::array<float,2>{0.981219292f, 0.986299932f},
-std::array<float,2>{0.922959328f, 0.410078317f},
-std::array<float,2>{0.416481376f, 0.578847885f},
-std::array<float,2>{0.181676611f, 0.224944338f},
-std::array<float,2>{0.600433707f, 0.833461165f},
-std::array<float,2>{0.689550757f, 0.0828871503f},
-std::array<float,2>{0.0387813225f, 0.921242058f},
-std::array<float,2>{0.314195931f, 0.298288316f},
-std::array<float,2>{0.808293819f, 0.702582419f},
-std::array<float,2>{0.78165251f, 0.108684838f},
-std::array<float,2>{0.340869606f, 0.885468245f},
-std::array<float,2>{0.054634247f, 0.256501824f},
-std::array<float,2>{0.70325166f, 0.73833847f},
-std::array<float,2>{0.623839855f, 0.404316753f},
-std::array<float,2>{0.160034895f, 0.62403816f},
-std::array<float,2>{0.429089606f, 0.192074895f},
-std::array<float,2>{0.918927133f, 0.844114661f},
-std::array<float,2>{0.986552894f, 0.34402281f},
-std::array<float,2>{0.440622479f, 0.643788338f},
-std::array<float,2>{0.220939428f, 0.0555331446f},
-std::array<float,2>{0.51708132f, 0.950736701f},
-std::array<float,2>{0.643936455f, 0.147412434f},
-std::array<float,2>{0.103991345f, 0.8005777f},
-std::array<float,2>{0.283449918f, 0.450918585f},
-std::array<float,2>{0.838434577f, 0.540452302f},
-std::array<float,2>{0.893642962f, 0.249675795f},
-std::array<float,2>{0.382720262f, 0.821578503f},
-std::array<float,2>{0.13435635f, 0.434905887f},
-std::array<float,2>{0.581731737f, 0.572862804f},
-std::array<float,2>{0.743288159f, 0.284348279f},
-std::array<float,2>{0.000567822601f, 0.705144048f},
-std::array<float,2>{0.36349684f, 0.0724261999f},
-std::array<float,2>{0.76742655f, 0.922722578f},
-std::array<float,2>{0.860458732f, 0.472204149f},
-std::array<float,2>{0.27089265f, 0.528024912f},
-std::array<float,2>{0.0673659444f, 0.172823086f},
-std::array<float,2>{0.671982825f, 0.776923478f},
-std::array<float,2>{0.548725665f, 0.000347101857f},
-std::array<float,2>{0.214406833f, 0.971120417f},
-std::array<float,2>{0.49791491f, 0.318632364f},
-std::array<float,2>{0.944411159f, 0.682028532f},
-std::array<float,2>{0.881785929f, 0.00936669856f},
-std::array<float,2>{0.39778918f, 0.982833147f},
-std::array<float,2>{0.151076809f, 0.323474109f},
-std::array<float,2>{0.566211462f, 0.672008574f},
-std::array<float,2>{0.731631458f, 0.481320709f},
-std::array<float,2>{0.0210539177f, 0.519281149f},
-std::array<float,2>{0.352200896f, 0.183208063f},
-std::array<float,2>{0.756827593f, 0.770057976f},
-std::array<float,2>{0.849588335f, 0.29531008f},
-std::array<float,2>{0.251021206f, 0.716615856f},
-std::array<float,2>{0.0810471252f, 0.068987146f},
-std::array<float,2>{0.67027837f, 0.93494159f},
-std::array<float,2>{0.539135396f, 0.235012934f},
-std::array<float,2>{0.19992134f, 0.814625859f},
-std::array<float,2>{0.468979508f, 0.429123968f},
-std::array<float,2>{0.955000222f, 0.56729418f},
-std::array<float,2>{0.809742332f, 0.149651259f},
-std::array<float,2>{0.319545478f, 0.806774437f},
-std::array<float,2>{0.0344555676f, 0.43986848f},
-std::array<float,2>{0.695227861f, 0.53554064f},
-std::array<float,2>{0.594929338f, 0.352663159f},
-std::array<float,2>{0.184008807f, 0.648837626f},
-std::array<float,2>{0.42001605f, 0.048722595f},
-std::array<float,2>{0.929388642f, 0.938978374f},
-std::array<float,2>{0.978465497f, 0.393107951f},
-std::array<float,2>{0.453143954f, 0.617036164f},
-std::array<float,2>{0.243855491f, 0.197714999f},
-std::array<float,2>{0.503857315f, 0.854006767f},
-std::array<float,2>{0.626256347f, 0.0975299925f},
-std::array<float,2>{0.117843509f, 0.882511079f},
-std::array<float,2>{0.308356404f, 0.264689863f},
-std::array<float,2>{0.826901197f, 0.742424488f},
-std::array<float,2>{0.842442513f, 0.0904558748f},
-std::array<float,2>{0.287505835f, 0.909314275f},
-std::array<float,2>{0.108191632f, 0.305335581f},
-std::array<float,2>{0.646496236f, 0.690045118f},
-std::array<float,2>{0.522842169f, 0.415252954f},
-std::array<float,2>{0.225674659f, 0.590779126f},
-std::array<float,2>{0.444011658f, 0.230749145f},
-std::array<float,2>{0.991491914f, 0.836703598f},
-std::array<float,2>{0.914407432f, 0.340644032f},
-std::array<float,2>{0.425447881f, 0.661331952f},
-std::array<float,2>{0.16168575f, 0.0268614255f},
-std::array<float,2>{0.619875014f, 0.995394051f},
-std::array<float,2>{0.708636403f, 0.168933749f},
-std::array<float,2>{0.0500244275f, 0.763222575f},
-std::array<float,2>{0.339229703f, 0.499681532f},
-std::array<float,2>{0.78898406f, 0.5132007f},
-std::array<float,2>{0.940474987f, 0.210922331f},
-std::array<float,2>{0.495277941f, 0.86279583f},
-std::array<float,2>{0.216377929f, 0.381458133f},
-std::array<float,2>{0.551502824f, 0.598661959f},
-std::array<float,2>{0.676182985f, 0.271735191f},
-std::array<float,2>{0.0628774911f, 0.729367435f},
-std::array<float,2>{0.266707271f, 0.120218538f},
-std::array<float,2>{0.864800513f, 0.904916704f},
-std::array<float,2>{0.772922218f, 0.466296315f},
-std::array<float,2>{0.362645209f, 0.558552086f},
-std::array<float,2>{0.00686301524f, 0.134113789f},
-std::array<float,2>{0.749824345f, 0.788210869f},
-std::array<float,2>{0.583096862f, 0.0380252376f},
-std::array<float,2>{0.139313966f, 0.965371728f},
-std::array<float,2>{0.377184272f, 0.371826023f},
-std::array<float,2>{0.895747602f, 0.627727985f},
-std::array<float,2>{0.993695378f, 0.110208839f},
-std::array<float,2>{0.449623495f, 0.895693243f},
-std::array<float,2>{0.229753003f, 0.273483455f},
-std::array<float,2>{0.527880609f, 0.719208062f},
-std::array<float,2>{0.653324127f, 0.386470288f},
-std::array<float,2>{0.0971524939f, 0.603705108f},
-std::array<float,2>{0.291445434f, 0.217854738f},
-std::array<float,2>{0.832965732f, 0.870666683f},
-std::array<float,2>{0.791498303f, 0.364723653f},
-std::array<float,2>{0.331745565f, 0.635112703f},
-std::array<float,2>{0.0589101203f, 0.0435623527f},
-std::array<float,2>{0.714114368f, 0.959104836f},
-std::array<float,2>{0.615900278f, 0.129833862f},
-std::array<float,2>{0.167817071f, 0.79578203f},
-std::array<float,2>{0.436689049f, 0.460800946f},
-std::array<float,2>{0.910452068f, 0.552139223f},
-std::array<float,2>{0.874304891f, 0.219507307f},
-std::array<float,2>{0.275915235f, 0.829938054f},
-std::array<float,2>{0.074624382f, 0.411349565f},
-std::array<float,2>{0.681352019f, 0.58520335f},
-std::array<float,2>{0.559248745f, 0.301409155f},
-std::array<float,2>{0.207416415f, 0.698276877f},
-std::array<float,2>{0.49078837f, 0.0811832398f},
-std::array<float,2>{0.948681056f, 0.916293383f},
-std::array<float,2>{0.904806435f, 0.485477537f},
-std::array<float,2>{0.386575192f, 0.500054419f},
-std::array<float,2>{0.126300767f, 0.157608762f},
-std::array<float,2>{0.591282129f, 0.755751729f},
-std::array<float,2>{0.736299455f, 0.0163179059f},
-std::array<float,2>{0.0153415808f, 0.990987778f},
-std::array<float,2>{0.36817354f, 0.331362963f},
-std::array<float,2>{0.77406925f, 0.668677568f},
-std::array<float,2>{0.760325015f, 0.0596814305f},
-std::array<float,2>{0.348997712f, 0.94689697f},
-std::array<float,2>{0.0273151565f, 0.349522948f},
-std::array<float,2>{0.725723565f, 0.646775961f},
-std::array<float,2>{0.572271228f, 0.448470354f},
-std::array<float,2>{0.146061331f, 0.546426058f},
-std::array<float,2>{0.401328146f, 0.143446997f},
-std::array<float,2>{0.884631574f, 0.801616848f},
-std::array<float,2>{0.967477262f, 0.253385931f},
-std::array<float,2>{0.478190362f, 0.736546278f},
-std::array<float,2>{0.19466719f, 0.103785962f},
-std::array<float,2>{0.535475075f, 0.886930704f},
-std::array<float,2>{0.657773316f, 0.188257158f},
-std::array<float,2>{0.0867320746f, 0.847768128f},
-std::array<float,2>{0.2602247f, 0.401109517f},
-std::array<float,2>{0.855688035f, 0.620193064f},
-std::array<float,2>{0.93150723f, 0.179205641f},
-std::array<float,2>{0.410208613f, 0.779552937f},
-std::array<float,2>{0.172278866f, 0.474758834f},
-std::array<float,2>{0.604663432f, 0.524498701f},
-std::array<float,2>{0.701780736f, 0.314349741f},
-std::array<float,2>{0.0413752086f, 0.684847772f},
-std::array<float,2>{0.320916176f, 0.0047246241f},
-std::array<float,2>{0.798898816f, 0.975664675f},
-std::array<float,2>{0.818623364f, 0.431636721f},
-std::array<float,2>{0.298142523f, 0.576696455f},
-std::array<float,2>{0.11529319f, 0.24432534f},
-std::array<float,2>{0.637464762f, 0.824275255f},
-std::array<float,2>{0.514853239f, 0.077012457f},
-std::array<float,2>{0.235219941f, 0.929519355f},
-std::array<float,2>{0.463757098f, 0.286440015f},
-std::array<float,2>{0.973721802f, 0.709218204f}}
@@ -1,4096 +0,0 @@
-{std::array<float,2>{0.578328252f, 0.807165742f},
-std::array<float,2>{0.185494691f, 0.090512827f},
-std::array<float,2>{0.479618162f, 0.517924011f},
-std::array<float,2>{0.825507164f, 0.474823207f},
-std::array<float,2>{0.997458637f, 0.696121871f},
-std::array<float,2>{0.327555746f, 0.263443202f},
-std::array<float,2>{0.0675369725f, 0.977108359f},
-std::array<float,2>{0.666940331f, 0.186306402f},
-std::array<float,2>{0.755093336f, 0.907564223f},
-std::array<float,2>{0.436459392f, 0.191435173f},
-std::array<float,2>{0.201362312f, 0.630220413f},
-std::array<float,2>{0.53888154f, 0.330145538f},
-std::array<float,2>{0.724225461f, 0.569479346f},
-std::array<float,2>{0.00922254939f, 0.430577129f},
-std::array<float,2>{0.275839537f, 0.836012781f},
-std::array<float,2>{0.921136439f, 0.0118799573f},
-std::array<float,2>{0.626541376f, 0.960285842f},
-std::array<float,2>{0.124875024f, 0.149555251f},
-std::array<float,2>{0.359234601f, 0.73834759f},
-std::array<float,2>{0.964143097f, 0.287085325f},
-std::array<float,2>{0.846057475f, 0.561724246f},
-std::array<float,2>{0.457874209f, 0.453287482f},
-std::array<float,2>{0.145977452f, 0.775024235f},
-std::array<float,2>{0.595351338f, 0.101454154f},
-std::array<float,2>{0.9059062f, 0.848054707f},
-std::array<float,2>{0.301039994f, 0.049615182f},
-std::array<float,2>{0.0524283238f, 0.61699003f},
-std::array<float,2>{0.714028358f, 0.393338442f},
-std::array<float,2>{0.524474621f, 0.68428725f},
-std::array<float,2>{0.233522519f, 0.359462947f},
-std::array<float,2>{0.386102945f, 0.901836514f},
-std::array<float,2>{0.807078958f, 0.248394653f},
-std::array<float,2>{0.559521437f, 0.878365278f},
-std::array<float,2>{0.218476415f, 0.22556825f},
-std::array<float,2>{0.410413921f, 0.666492939f},
-std::array<float,2>{0.765753686f, 0.348900139f},
-std::array<float,2>{0.935838223f, 0.595711112f},
-std::array<float,2>{0.26204288f, 0.381376415f},
-std::array<float,2>{0.0214654058f, 0.866681755f},
-std::array<float,2>{0.738651216f, 0.0348131023f},
-std::array<float,2>{0.836400986f, 0.759471476f},
-std::array<float,2>{0.490475416f, 0.120727777f},
-std::array<float,2>{0.166498274f, 0.545234084f},
-std::array<float,2>{0.573156655f, 0.452396452f},
-std::array<float,2>{0.673089683f, 0.731910408f},
-std::array<float,2>{0.087843217f, 0.308827907f},
-std::array<float,2>{0.331150204f, 0.941320539f},
-std::array<float,2>{0.981723368f, 0.138924897f},
-std::array<float,2>{0.687905908f, 0.816768289f},
-std::array<float,2>{0.0387650356f, 0.0274903998f},
-std::array<float,2>{0.29250145f, 0.582527876f},
-std::array<float,2>{0.886942804f, 0.410449326f},
-std::array<float,2>{0.78416723f, 0.655297339f},
-std::array<float,2>{0.392711937f, 0.324313849f},
-std::array<float,2>{0.24946861f, 0.925834179f},
-std::array<float,2>{0.505805492f, 0.208437294f},
-std::array<float,2>{0.941344261f, 0.994963944f},
-std::array<float,2>{0.373858392f, 0.164683461f},
-std::array<float,2>{0.107061125f, 0.712037265f},
-std::array<float,2>{0.646042228f, 0.280333817f},
-std::array<float,2>{0.609484136f, 0.514898896f},
-std::array<float,2>{0.138706222f, 0.497138262f},
-std::array<float,2>{0.446936876f, 0.785995841f},
-std::array<float,2>{0.862821221f, 0.0656618178f},
-std::array<float,2>{0.511465847f, 0.872712016f},
-std::array<float,2>{0.239971027f, 0.0442120247f},
-std::array<float,2>{0.403658599f, 0.608023465f},
-std::array<float,2>{0.796817958f, 0.389163554f},
-std::array<float,2>{0.882370889f, 0.656715333f},
-std::array<float,2>{0.282046229f, 0.35558787f},
-std::array<float,2>{0.043686565f, 0.890500605f},
-std::array<float,2>{0.69922787f, 0.232842192f},
-std::array<float,2>{0.86748898f, 0.950972319f},
-std::array<float,2>{0.444434494f, 0.130534396f},
-std::array<float,2>{0.132566854f, 0.724732757f},
-std::array<float,2>{0.624080479f, 0.302243531f},
-std::array<float,2>{0.648660243f, 0.535076737f},
-std::array<float,2>{0.101056658f, 0.44013235f},
-std::array<float,2>{0.365688235f, 0.754977405f},
-std::array<float,2>{0.953018963f, 0.112478644f},
-std::array<float,2>{0.746908665f, 0.935400069f},
-std::array<float,2>{0.0246003903f, 0.213096768f},
-std::array<float,2>{0.257173359f, 0.643354058f},
-std::array<float,2>{0.922846079f, 0.318862915f},
-std::array<float,2>{0.777597666f, 0.590789855f},
-std::array<float,2>{0.421105117f, 0.416373104f},
-std::array<float,2>{0.208744824f, 0.822821259f},
-std::array<float,2>{0.549028993f, 0.0175415874f},
-std::array<float,2>{0.969926655f, 0.795422494f},
-std::array<float,2>{0.340174317f, 0.072422713f},
-std::array<float,2>{0.0853194967f, 0.506223559f},
-std::array<float,2>{0.685073197f, 0.484377086f},
-std::array<float,2>{0.56340766f, 0.707715869f},
-std::array<float,2>{0.162480876f, 0.268506259f},
-std::array<float,2>{0.492563456f, 0.98866713f},
-std::array<float,2>{0.833348691f, 0.162396193f},
-std::array<float,2>{0.606961548f, 0.975411534f},
-std::array<float,2>{0.150948122f, 0.179649174f},
-std::array<float,2>{0.466364563f, 0.691703141f},
-std::array<float,2>{0.856827259f, 0.253515452f},
-std::array<float,2>{0.953681409f, 0.529969096f},
-std::array<float,2>{0.345251262f, 0.483501345f},
-std::array<float,2>{0.110885575f, 0.798416376f},
-std::array<float,2>{0.635963142f, 0.0808239728f},
-std::array<float,2>{0.798732996f, 0.835552633f},
-std::array<float,2>{0.378476381f, 0.00283660297f},
-std::array<float,2>{0.225892469f, 0.577664256f},
-std::array<float,2>{0.517817259f, 0.425616324f},
-std::array<float,2>{0.7069242f, 0.640051246f},
-std::array<float,2>{0.0621538125f, 0.337830007f},
-std::array<float,2>{0.306921393f, 0.920379877f},
-std::array<float,2>{0.890923977f, 0.200513422f},
-std::array<float,2>{0.662225544f, 0.772182703f},
-std::array<float,2>{0.0744362846f, 0.106198192f},
-std::array<float,2>{0.315443456f, 0.553848982f},
-std::array<float,2>{0.98918891f, 0.463866681f},
-std::array<float,2>{0.815027893f, 0.744597137f},
-std::array<float,2>{0.47086969f, 0.294818848f},
-std::array<float,2>{0.17813538f, 0.96788168f},
-std::array<float,2>{0.588717759f, 0.142836243f},
-std::array<float,2>{0.913268864f, 0.896950841f},
-std::array<float,2>{0.265743434f, 0.239032939f},
-std::array<float,2>{0.00160405156f, 0.671964943f},
-std::array<float,2>{0.734319508f, 0.374502867f},
-std::array<float,2>{0.545830309f, 0.619319677f},
-std::array<float,2>{0.190749586f, 0.404742092f},
-std::array<float,2>{0.424663126f, 0.852884114f},
-std::array<float,2>{0.762620389f, 0.0589811578f},
-std::array<float,2>{0.53131485f, 0.753695726f},
-std::array<float,2>{0.196914926f, 0.114050716f},
-std::array<float,2>{0.43206656f, 0.537076354f},
-std::array<float,2>{0.753541708f, 0.444057614f},
-std::array<float,2>{0.916804075f, 0.722465754f},
-std::array<float,2>{0.279598951f, 0.297482193f},
-std::array<float,2>{0.0131150428f, 0.949130356f},
-std::array<float,2>{0.719857574f, 0.125681773f},
-std::array<float,2>{0.820738554f, 0.885320723f},
-std::array<float,2>{0.482485056f, 0.22710456f},
-std::array<float,2>{0.182289004f, 0.662522972f},
-std::array<float,2>{0.584330261f, 0.351961315f},
-std::array<float,2>{0.668457925f, 0.604448855f},
-std::array<float,2>{0.0647873133f, 0.386102855f},
-std::array<float,2>{0.323546618f, 0.867964745f},
-std::array<float,2>{0.994655132f, 0.0409321561f},
-std::array<float,2>{0.71642679f, 0.986448646f},
-std::array<float,2>{0.048847869f, 0.156956375f},
-std::array<float,2>{0.298132598f, 0.704981387f},
-std::array<float,2>{0.899990201f, 0.273233771f},
-std::array<float,2>{0.811626375f, 0.50005728f},
-std::array<float,2>{0.388077855f, 0.48936978f},
-std::array<float,2>{0.229778782f, 0.791612387f},
-std::array<float,2>{0.530609787f, 0.0749111399f},
-std::array<float,2>{0.96772182f, 0.826645672f},
-std::array<float,2>{0.354136646f, 0.0198411476f},
-std::array<float,2>{0.119302668f, 0.589044571f},
-std::array<float,2>{0.630442381f, 0.420245558f},
-std::array<float,2>{0.599251568f, 0.646117032f},
-std::array<float,2>{0.143821269f, 0.313568532f},
-std::array<float,2>{0.453528404f, 0.932930052f},
-std::array<float,2>{0.850169361f, 0.217855677f},
-std::array<float,2>{0.575656772f, 0.917090356f},
-std::array<float,2>{0.16839543f, 0.198765397f},
-std::array<float,2>{0.485117733f, 0.633534014f},
-std::array<float,2>{0.842850447f, 0.341883481f},
-std::array<float,2>{0.980023324f, 0.572900891f},
-std::array<float,2>{0.333741993f, 0.426055402f},
-std::array<float,2>{0.0909861252f, 0.829952836f},
-std::array<float,2>{0.676538527f, 0.00675037783f},
-std::array<float,2>{0.772859395f, 0.801223397f},
-std::array<float,2>{0.410006851f, 0.0822737888f},
-std::array<float,2>{0.214456156f, 0.525368273f},
-std::array<float,2>{0.554836869f, 0.477045506f},
-std::array<float,2>{0.73525542f, 0.688417971f},
-std::array<float,2>{0.0193275027f, 0.255810678f},
-std::array<float,2>{0.259036362f, 0.969497561f},
-std::array<float,2>{0.933519781f, 0.175251678f},
-std::array<float,2>{0.641181648f, 0.858222306f},
-std::array<float,2>{0.10400077f, 0.056891676f},
-std::array<float,2>{0.367910981f, 0.623187363f},
-std::array<float,2>{0.943953156f, 0.402170241f},
-std::array<float,2>{0.86362046f, 0.678903103f},
-std::array<float,2>{0.451903492f, 0.367887884f},
-std::array<float,2>{0.136095569f, 0.891690731f},
-std::array<float,2>{0.614492536f, 0.234464109f},
-std::array<float,2>{0.883692563f, 0.962856829f},
-std::array<float,2>{0.29531613f, 0.147337273f},
-std::array<float,2>{0.0344478376f, 0.747726917f},
-std::array<float,2>{0.692740023f, 0.290855229f},
-std::array<float,2>{0.501895189f, 0.54748106f},
-std::array<float,2>{0.245681584f, 0.465678304f},
-std::array<float,2>{0.3970429f, 0.767306089f},
-std::array<float,2>{0.785640717f, 0.101775438f},
-std::array<float,2>{0.617795587f, 0.841903627f},
-std::array<float,2>{0.126575157f, 0.0110943243f},
-std::array<float,2>{0.438766241f, 0.563072383f},
-std::array<float,2>{0.873729944f, 0.436655223f},
-std::array<float,2>{0.948939443f, 0.625559688f},
-std::array<float,2>{0.361987412f, 0.335903913f},
-std::array<float,2>{0.0949670821f, 0.912916899f},
-std::array<float,2>{0.655076265f, 0.188007519f},
-std::array<float,2>{0.789721251f, 0.980739474f},
-std::array<float,2>{0.398953885f, 0.17977722f},
-std::array<float,2>{0.235744298f, 0.701901734f},
-std::array<float,2>{0.511936784f, 0.259154528f},
-std::array<float,2>{0.695966423f, 0.522870779f},
-std::array<float,2>{0.0420560092f, 0.472517252f},
-std::array<float,2>{0.286778122f, 0.811659157f},
-std::array<float,2>{0.876547635f, 0.089233987f},
-std::array<float,2>{0.682929099f, 0.903688431f},
-std::array<float,2>{0.0798871964f, 0.242255196f},
-std::array<float,2>{0.336639911f, 0.680904686f},
-std::array<float,2>{0.975548148f, 0.365432292f},
-std::array<float,2>{0.829361558f, 0.612227738f},
-std::array<float,2>{0.498784989f, 0.397890747f},
-std::array<float,2>{0.156938478f, 0.844233394f},
-std::array<float,2>{0.568473339f, 0.054647468f},
-std::array<float,2>{0.929664314f, 0.778038442f},
-std::array<float,2>{0.251671284f, 0.0948996246f},
-std::array<float,2>{0.0275826678f, 0.557219207f},
-std::array<float,2>{0.74373883f, 0.459672093f},
-std::array<float,2>{0.553073347f, 0.735913575f},
-std::array<float,2>{0.206456676f, 0.283574045f},
-std::array<float,2>{0.416992992f, 0.956324697f},
-std::array<float,2>{0.776423395f, 0.154471844f},
-std::array<float,2>{0.522473097f, 0.942741036f},
-std::array<float,2>{0.220114991f, 0.13285248f},
-std::array<float,2>{0.379980624f, 0.727113008f},
-std::array<float,2>{0.804439664f, 0.305413961f},
-std::array<float,2>{0.897959709f, 0.540348232f},
-std::array<float,2>{0.312136799f, 0.448577166f},
-std::array<float,2>{0.0571381263f, 0.763344228f},
-std::array<float,2>{0.709789991f, 0.121971488f},
-std::array<float,2>{0.852191746f, 0.86267674f},
-std::array<float,2>{0.461676359f, 0.0355389044f},
-std::array<float,2>{0.153270736f, 0.597718656f},
-std::array<float,2>{0.602156043f, 0.376849532f},
-std::array<float,2>{0.639913142f, 0.670491815f},
-std::array<float,2>{0.114272825f, 0.346523881f},
-std::array<float,2>{0.347845644f, 0.882139802f},
-std::array<float,2>{0.958698928f, 0.220824063f},
-std::array<float,2>{0.729254365f, 0.782412708f},
-std::array<float,2>{0.00459987903f, 0.0689797625f},
-std::array<float,2>{0.272028595f, 0.509486377f},
-std::array<float,2>{0.906987429f, 0.495192796f},
-std::array<float,2>{0.76014334f, 0.715453804f},
-std::array<float,2>{0.426827103f, 0.276091546f},
-std::array<float,2>{0.194305643f, 0.999355733f},
-std::array<float,2>{0.542329073f, 0.168286785f},
-std::array<float,2>{0.985467911f, 0.924386322f},
-std::array<float,2>{0.320243686f, 0.206200376f},
-std::array<float,2>{0.0707485452f, 0.648913741f},
-std::array<float,2>{0.658447981f, 0.321233183f},
-std::array<float,2>{0.59263885f, 0.580108702f},
-std::array<float,2>{0.173481017f, 0.408732176f},
-std::array<float,2>{0.47448197f, 0.813879013f},
-std::array<float,2>{0.818833292f, 0.0268806946f},
-std::array<float,2>{0.596570611f, 0.776140392f},
-std::array<float,2>{0.147521228f, 0.0994000286f},
-std::array<float,2>{0.459213018f, 0.559866071f},
-std::array<float,2>{0.844326973f, 0.456203818f},
-std::array<float,2>{0.961827993f, 0.740922451f},
-std::array<float,2>{0.356515884f, 0.287492216f},
-std::array<float,2>{0.122508824f, 0.958000124f},
-std::array<float,2>{0.628547132f, 0.150421679f},
-std::array<float,2>{0.805614889f, 0.900093675f},
-std::array<float,2>{0.38353309f, 0.247687742f},
-std::array<float,2>{0.231458157f, 0.685979664f},
-std::array<float,2>{0.526781321f, 0.361628622f},
-std::array<float,2>{0.712624073f, 0.614909172f},
-std::array<float,2>{0.0540114343f, 0.390643448f},
-std::array<float,2>{0.30311814f, 0.850207984f},
-std::array<float,2>{0.9032408f, 0.048431769f},
-std::array<float,2>{0.66472429f, 0.978522062f},
-std::array<float,2>{0.06968043f, 0.184097469f},
-std::array<float,2>{0.32556811f, 0.698646367f},
-std::array<float,2>{0.998544097f, 0.264374524f},
-std::array<float,2>{0.827613831f, 0.516694129f},
-std::array<float,2>{0.477846235f, 0.473025411f},
-std::array<float,2>{0.187449127f, 0.804717541f},
-std::array<float,2>{0.581432343f, 0.0919744745f},
-std::array<float,2>{0.918454826f, 0.839775622f},
-std::array<float,2>{0.27447331f, 0.0151685923f},
-std::array<float,2>{0.0116965258f, 0.567230403f},
-std::array<float,2>{0.726549149f, 0.432153404f},
-std::array<float,2>{0.535806715f, 0.63129586f},
-std::array<float,2>{0.200463906f, 0.329223484f},
-std::array<float,2>{0.433894694f, 0.9095608f},
-std::array<float,2>{0.757058442f, 0.194862336f},
-std::array<float,2>{0.506722629f, 0.927821875f},
-std::array<float,2>{0.246165901f, 0.209553078f},
-std::array<float,2>{0.39234671f, 0.652599752f},
-std::array<float,2>{0.782947481f, 0.326575458f},
-std::array<float,2>{0.888964593f, 0.584662259f},
-std::array<float,2>{0.290668339f, 0.4122262f},
-std::array<float,2>{0.0355634093f, 0.818776369f},
-std::array<float,2>{0.689706266f, 0.0298812799f},
-std::array<float,2>{0.860130012f, 0.787538648f},
-std::array<float,2>{0.449065417f, 0.0630056188f},
-std::array<float,2>{0.137261555f, 0.512491345f},
-std::array<float,2>{0.612370729f, 0.498388052f},
-std::array<float,2>{0.647798061f, 0.713299274f},
-std::array<float,2>{0.108564042f, 0.278213412f},
-std::array<float,2>{0.371420801f, 0.993004799f},
-std::array<float,2>{0.939427018f, 0.167282149f},
-std::array<float,2>{0.741479754f, 0.864395916f},
-std::array<float,2>{0.0222965628f, 0.0328884944f},
-std::array<float,2>{0.264362097f, 0.594652176f},
-std::array<float,2>{0.933990479f, 0.379948616f},
-std::array<float,2>{0.76768446f, 0.664464414f},
-std::array<float,2>{0.412853807f, 0.350467235f},
-std::array<float,2>{0.215966046f, 0.875301182f},
-std::array<float,2>{0.560645461f, 0.224549785f},
-std::array<float,2>{0.983810365f, 0.938219368f},
-std::array<float,2>{0.329895735f, 0.138104513f},
-std::array<float,2>{0.0881518424f, 0.733163774f},
-std::array<float,2>{0.674845994f, 0.312323183f},
-std::array<float,2>{0.571061373f, 0.544228315f},
-std::array<float,2>{0.16547884f, 0.450822771f},
-std::array<float,2>{0.489952773f, 0.760720372f},
-std::array<float,2>{0.839717865f, 0.118924007f},
-std::array<float,2>{0.547672629f, 0.821372211f},
-std::array<float,2>{0.209632039f, 0.0180572458f},
-std::array<float,2>{0.419874847f, 0.592992604f},
-std::array<float,2>{0.781111896f, 0.414508849f},
-std::array<float,2>{0.92542249f, 0.642411828f},
-std::array<float,2>{0.255783767f, 0.318078429f},
-std::array<float,2>{0.0258745886f, 0.937090278f},
-std::array<float,2>{0.748846531f, 0.211631835f},
-std::array<float,2>{0.835679173f, 0.991071582f},
-std::array<float,2>{0.495000184f, 0.16195479f},
-std::array<float,2>{0.161033079f, 0.709305406f},
-std::array<float,2>{0.566319287f, 0.26727134f},
-std::array<float,2>{0.685752571f, 0.504913807f},
-std::array<float,2>{0.0827222914f, 0.486474156f},
-std::array<float,2>{0.34347859f, 0.793572366f},
-std::array<float,2>{0.972609222f, 0.0713628605f},
-std::array<float,2>{0.702846825f, 0.888550639f},
-std::array<float,2>{0.0453470498f, 0.231502682f},
-std::array<float,2>{0.283835977f, 0.659151256f},
-std::array<float,2>{0.880661845f, 0.359067738f},
-std::array<float,2>{0.794897139f, 0.606246293f},
-std::array<float,2>{0.405809551f, 0.388664246f},
-std::array<float,2>{0.241687626f, 0.874809802f},
-std::array<float,2>{0.509051144f, 0.0449711941f},
-std::array<float,2>{0.950186968f, 0.756214917f},
-std::array<float,2>{0.363480955f, 0.11041417f},
-std::array<float,2>{0.0985107571f, 0.532054901f},
-std::array<float,2>{0.651952803f, 0.438258648f},
-std::array<float,2>{0.621097207f, 0.723522186f},
-std::array<float,2>{0.129982695f, 0.304206371f},
-std::array<float,2>{0.443003356f, 0.952349246f},
-std::array<float,2>{0.869669676f, 0.131200686f},
-std::array<float,2>{0.587149978f, 0.966237962f},
-std::array<float,2>{0.176640496f, 0.141042784f},
-std::array<float,2>{0.47066164f, 0.742981017f},
-std::array<float,2>{0.813399196f, 0.296467245f},
-std::array<float,2>{0.99054873f, 0.552272201f},
-std::array<float,2>{0.314344347f, 0.461154997f},
-std::array<float,2>{0.0771366656f, 0.770614028f},
-std::array<float,2>{0.661831439f, 0.108927257f},
-std::array<float,2>{0.763980865f, 0.854556859f},
-std::array<float,2>{0.42346555f, 0.060826093f},
-std::array<float,2>{0.188573703f, 0.617960036f},
-std::array<float,2>{0.544446707f, 0.403382599f},
-std::array<float,2>{0.73187685f, 0.675123453f},
-std::array<float,2>{0.00251151482f, 0.37204513f},
-std::array<float,2>{0.267979205f, 0.896167457f},
-std::array<float,2>{0.911934972f, 0.241276726f},
-std::array<float,2>{0.634598553f, 0.798973203f},
-std::array<float,2>{0.112892352f, 0.0793411285f},
-std::array<float,2>{0.345906347f, 0.528251171f},
-std::array<float,2>{0.955096662f, 0.480754226f},
-std::array<float,2>{0.85854274f, 0.694024444f},
-std::array<float,2>{0.467474878f, 0.251409084f},
-std::array<float,2>{0.149422988f, 0.974371076f},
-std::array<float,2>{0.608435869f, 0.177011445f},
-std::array<float,2>{0.892748833f, 0.919029057f},
-std::array<float,2>{0.305763304f, 0.202821732f},
-std::array<float,2>{0.0600949451f, 0.638421237f},
-std::array<float,2>{0.703608394f, 0.338023961f},
-std::array<float,2>{0.515966237f, 0.575979292f},
-std::array<float,2>{0.224003598f, 0.422599167f},
-std::array<float,2>{0.376899481f, 0.833852291f},
-std::array<float,2>{0.799627662f, 0.000411054323f},
-std::array<float,2>{0.528599977f, 0.7903229f},
-std::array<float,2>{0.226629034f, 0.0766773298f},
-std::array<float,2>{0.390463233f, 0.503131628f},
-std::array<float,2>{0.810156107f, 0.490555048f},
-std::array<float,2>{0.901392519f, 0.706023633f},
-std::array<float,2>{0.299864292f, 0.269987077f},
-std::array<float,2>{0.0472757667f, 0.985678613f},
-std::array<float,2>{0.71787709f, 0.15859662f},
-std::array<float,2>{0.848831236f, 0.93132019f},
-std::array<float,2>{0.456632048f, 0.215622261f},
-std::array<float,2>{0.141810477f, 0.647499979f},
-std::array<float,2>{0.601316214f, 0.314747781f},
-std::array<float,2>{0.631473958f, 0.587100685f},
-std::array<float,2>{0.118737325f, 0.419880897f},
-std::array<float,2>{0.351970464f, 0.824647069f},
-std::array<float,2>{0.965425432f, 0.0228391718f},
-std::array<float,2>{0.72145313f, 0.946666062f},
-std::array<float,2>{0.0141094476f, 0.127030522f},
-std::array<float,2>{0.277732581f, 0.719659925f},
-std::array<float,2>{0.91523236f, 0.300572813f},
-std::array<float,2>{0.750590563f, 0.537208378f},
-std::array<float,2>{0.43151626f, 0.443101078f},
-std::array<float,2>{0.198716298f, 0.751607478f},
-std::array<float,2>{0.534055889f, 0.11535956f},
-std::array<float,2>{0.992864251f, 0.869349837f},
-std::array<float,2>{0.321610183f, 0.0423948653f},
-std::array<float,2>{0.0636124983f, 0.601746917f},
-std::array<float,2>{0.670196116f, 0.38435635f},
-std::array<float,2>{0.582527399f, 0.661452472f},
-std::array<float,2>{0.179828957f, 0.354422718f},
-std::array<float,2>{0.481922477f, 0.88315022f},
-std::array<float,2>{0.823183596f, 0.229349703f},
-std::array<float,2>{0.615833938f, 0.892889917f},
-std::array<float,2>{0.133552611f, 0.237586766f},
-std::array<float,2>{0.449985325f, 0.676830649f},
-std::array<float,2>{0.866609097f, 0.370510459f},
-std::array<float,2>{0.94315213f, 0.62297231f},
-std::array<float,2>{0.369657636f, 0.399502963f},
-std::array<float,2>{0.102618635f, 0.856730938f},
-std::array<float,2>{0.643500924f, 0.0564864278f},
-std::array<float,2>{0.787836671f, 0.767870724f},
-std::array<float,2>{0.396148175f, 0.105354637f},
-std::array<float,2>{0.242745787f, 0.548993945f},
-std::array<float,2>{0.503701627f, 0.468670577f},
-std::array<float,2>{0.694739521f, 0.749797344f},
-std::array<float,2>{0.0326919518f, 0.292054445f},
-std::array<float,2>{0.293180794f, 0.964138865f},
-std::array<float,2>{0.884941161f, 0.145515665f},
-std::array<float,2>{0.678714931f, 0.831240833f},
-std::array<float,2>{0.0925009847f, 0.00421241624f},
-std::array<float,2>{0.334445715f, 0.57138598f},
-std::array<float,2>{0.978041947f, 0.428162068f},
-std::array<float,2>{0.840277791f, 0.635870636f},
-std::array<float,2>{0.48804909f, 0.339978665f},
-std::array<float,2>{0.171813533f, 0.915510893f},
-std::array<float,2>{0.576363504f, 0.197040424f},
-std::array<float,2>{0.93052429f, 0.970949113f},
-std::array<float,2>{0.261171758f, 0.172136515f},
-std::array<float,2>{0.016055353f, 0.69093591f},
-std::array<float,2>{0.737876117f, 0.256859511f},
-std::array<float,2>{0.557559967f, 0.526516914f},
-std::array<float,2>{0.211847365f, 0.48038733f},
-std::array<float,2>{0.407334775f, 0.803712189f},
-std::array<float,2>{0.770573974f, 0.0840547755f},
-std::array<float,2>{0.568220377f, 0.847352982f},
-std::array<float,2>{0.158226714f, 0.051910229f},
-std::array<float,2>{0.496325493f, 0.609661818f},
-std::array<float,2>{0.831408858f, 0.396470785f},
-std::array<float,2>{0.974065721f, 0.683016479f},
-std::array<float,2>{0.339121819f, 0.363642484f},
-std::array<float,2>{0.0809541121f, 0.90535301f},
-std::array<float,2>{0.681621373f, 0.244752645f},
-std::array<float,2>{0.773715794f, 0.954233587f},
-std::array<float,2>{0.414862901f, 0.15423964f},
-std::array<float,2>{0.203913927f, 0.73773706f},
-std::array<float,2>{0.551679194f, 0.282261521f},
-std::array<float,2>{0.744218886f, 0.556556702f},
-std::array<float,2>{0.0304899514f, 0.457850188f},
-std::array<float,2>{0.25306201f, 0.779719591f},
-std::array<float,2>{0.926478148f, 0.097452648f},
-std::array<float,2>{0.652555048f, 0.911278367f},
-std::array<float,2>{0.096137926f, 0.191271916f},
-std::array<float,2>{0.361306906f, 0.628589749f},
-std::array<float,2>{0.94587487f, 0.333478183f},
-std::array<float,2>{0.872914255f, 0.565786839f},
-std::array<float,2>{0.439700902f, 0.434384644f},
-std::array<float,2>{0.128464848f, 0.841101229f},
-std::array<float,2>{0.619248271f, 0.0079485001f},
-std::array<float,2>{0.877378404f, 0.808620572f},
-std::array<float,2>{0.288782805f, 0.0863059908f},
-std::array<float,2>{0.0395991504f, 0.521378219f},
-std::array<float,2>{0.698153794f, 0.469739914f},
-std::array<float,2>{0.514623106f, 0.700882912f},
-std::array<float,2>{0.237696618f, 0.26143539f},
-std::array<float,2>{0.402012736f, 0.984237552f},
-std::array<float,2>{0.792696476f, 0.182067201f},
-std::array<float,2>{0.540184021f, 0.997881949f},
-std::array<float,2>{0.192471966f, 0.170291454f},
-std::array<float,2>{0.429029375f, 0.71700418f},
-std::array<float,2>{0.758135498f, 0.274341047f},
-std::array<float,2>{0.909968138f, 0.510378182f},
-std::array<float,2>{0.271083862f, 0.493271649f},
-std::array<float,2>{0.00642932486f, 0.784245253f},
-std::array<float,2>{0.727934837f, 0.066873081f},
-std::array<float,2>{0.817154467f, 0.815257788f},
-std::array<float,2>{0.4757967f, 0.024212582f},
-std::array<float,2>{0.17558831f, 0.57909739f},
-std::array<float,2>{0.590966642f, 0.407191813f},
-std::array<float,2>{0.657934248f, 0.651942253f},
-std::array<float,2>{0.0723028034f, 0.322419316f},
-std::array<float,2>{0.317906111f, 0.921912432f},
-std::array<float,2>{0.98654449f, 0.204192355f},
-std::array<float,2>{0.708978593f, 0.76476717f},
-std::array<float,2>{0.055994682f, 0.123902127f},
-std::array<float,2>{0.309597582f, 0.541352749f},
-std::array<float,2>{0.894647956f, 0.446036667f},
-std::array<float,2>{0.802550435f, 0.730420649f},
-std::array<float,2>{0.381253421f, 0.306812257f},
-std::array<float,2>{0.221443459f, 0.943798363f},
-std::array<float,2>{0.519754171f, 0.135443598f},
-std::array<float,2>{0.960612714f, 0.880617321f},
-std::array<float,2>{0.350454807f, 0.220309034f},
-std::array<float,2>{0.115593635f, 0.668460965f},
-std::array<float,2>{0.638271451f, 0.344147414f},
-std::array<float,2>{0.60536772f, 0.600843132f},
-std::array<float,2>{0.154874504f, 0.377220184f},
-std::array<float,2>{0.463390976f, 0.860468268f},
-std::array<float,2>{0.854517639f, 0.0373687111f},
-std::array<float,2>{0.611746132f, 0.786771178f},
-std::array<float,2>{0.137993336f, 0.0651943833f},
-std::array<float,2>{0.448125809f, 0.514381647f},
-std::array<float,2>{0.860365391f, 0.496425569f},
-std::array<float,2>{0.937671065f, 0.711495817f},
-std::array<float,2>{0.372971356f, 0.280201316f},
-std::array<float,2>{0.108135223f, 0.995281637f},
-std::array<float,2>{0.646486223f, 0.165557608f},
-std::array<float,2>{0.781932533f, 0.927085102f},
-std::array<float,2>{0.390632749f, 0.207979158f},
-std::array<float,2>{0.247511148f, 0.654702246f},
-std::array<float,2>{0.507729113f, 0.326124281f},
-std::array<float,2>{0.691034496f, 0.583618402f},
-std::array<float,2>{0.0365133658f, 0.411478132f},
-std::array<float,2>{0.289475262f, 0.817938447f},
-std::array<float,2>{0.890291095f, 0.0284895748f},
-std::array<float,2>{0.674159169f, 0.939749777f},
-std::array<float,2>{0.0897585154f, 0.140495285f},
-std::array<float,2>{0.32891956f, 0.730975211f},
-std::array<float,2>{0.983146191f, 0.309695512f},
-std::array<float,2>{0.838427961f, 0.546085477f},
-std::array<float,2>{0.488308638f, 0.451378644f},
-std::array<float,2>{0.16416648f, 0.758209229f},
-std::array<float,2>{0.571391642f, 0.119958259f},
-std::array<float,2>{0.934678733f, 0.865584016f},
-std::array<float,2>{0.265566289f, 0.0338893309f},
-std::array<float,2>{0.0232107546f, 0.597434223f},
-std::array<float,2>{0.740791082f, 0.382421255f},
-std::array<float,2>{0.561968505f, 0.667140543f},
-std::array<float,2>{0.215663448f, 0.348254293f},
-std::array<float,2>{0.413588494f, 0.877894342f},
-std::array<float,2>{0.769163311f, 0.226490498f},
-std::array<float,2>{0.526290774f, 0.900986969f},
-std::array<float,2>{0.2305388f, 0.24974288f},
-std::array<float,2>{0.383907378f, 0.685147941f},
-std::array<float,2>{0.806457281f, 0.361299783f},
-std::array<float,2>{0.904229224f, 0.61526978f},
-std::array<float,2>{0.303802878f, 0.394208968f},
-std::array<float,2>{0.0530383661f, 0.849337578f},
-std::array<float,2>{0.710963786f, 0.050115332f},
-std::array<float,2>{0.845656157f, 0.774357736f},
-std::array<float,2>{0.460594952f, 0.100489058f},
-std::array<float,2>{0.146923915f, 0.561210036f},
-std::array<float,2>{0.597012818f, 0.454708546f},
-std::array<float,2>{0.627382457f, 0.739340842f},
-std::array<float,2>{0.121449798f, 0.286119461f},
-std::array<float,2>{0.356039703f, 0.959733427f},
-std::array<float,2>{0.962288499f, 0.148883998f},
-std::array<float,2>{0.724982083f, 0.837529957f},
-std::array<float,2>{0.0102057336f, 0.0136464294f},
-std::array<float,2>{0.274063081f, 0.56855464f},
-std::array<float,2>{0.919280171f, 0.43066752f},
-std::array<float,2>{0.75658977f, 0.629366934f},
-std::array<float,2>{0.435297161f, 0.331807882f},
-std::array<float,2>{0.199818492f, 0.906922817f},
-std::array<float,2>{0.536400199f, 0.192581445f},
-std::array<float,2>{0.999243915f, 0.978493989f},
-std::array<float,2>{0.324954093f, 0.186813951f},
-std::array<float,2>{0.0690045059f, 0.696660638f},
-std::array<float,2>{0.665587544f, 0.262207836f},
-std::array<float,2>{0.580571234f, 0.519167423f},
-std::array<float,2>{0.185747832f, 0.476187497f},
-std::array<float,2>{0.476792157f, 0.807902396f},
-std::array<float,2>{0.826971531f, 0.0913071781f},
-std::array<float,2>{0.543759882f, 0.851751089f},
-std::array<float,2>{0.188182995f, 0.0597781874f},
-std::array<float,2>{0.422313333f, 0.621072352f},
-std::array<float,2>{0.76513505f, 0.406026542f},
-std::array<float,2>{0.910615742f, 0.673210323f},
-std::array<float,2>{0.268654108f, 0.373047829f},
-std::array<float,2>{0.00318542705f, 0.897477627f},
-std::array<float,2>{0.731286228f, 0.23971507f},
-std::array<float,2>{0.813639164f, 0.966990173f},
-std::array<float,2>{0.469034225f, 0.14392069f},
-std::array<float,2>{0.177467093f, 0.745736718f},
-std::array<float,2>{0.586574435f, 0.293916821f},
-std::array<float,2>{0.660265326f, 0.553509593f},
-std::array<float,2>{0.077228561f, 0.464630455f},
-std::array<float,2>{0.313005537f, 0.773253858f},
-std::array<float,2>{0.992174864f, 0.107081927f},
-std::array<float,2>{0.704138339f, 0.921205282f},
-std::array<float,2>{0.0591370128f, 0.199228108f},
-std::array<float,2>{0.305511981f, 0.639283001f},
-std::array<float,2>{0.894310594f, 0.336794823f},
-std::array<float,2>{0.800080657f, 0.576356947f},
-std::array<float,2>{0.375179499f, 0.42390275f},
-std::array<float,2>{0.222984985f, 0.834533811f},
-std::array<float,2>{0.517099023f, 0.00307082268f},
-std::array<float,2>{0.956387818f, 0.796998084f},
-std::array<float,2>{0.347015321f, 0.081976667f},
-std::array<float,2>{0.111699842f, 0.530838192f},
-std::array<float,2>{0.633294761f, 0.482463181f},
-std::array<float,2>{0.60768491f, 0.693072319f},
-std::array<float,2>{0.148531064f, 0.252025217f},
-std::array<float,2>{0.46823895f, 0.976057708f},
-std::array<float,2>{0.857501686f, 0.17849566f},
-std::array<float,2>{0.565236092f, 0.990123749f},
-std::array<float,2>{0.161380917f, 0.163159013f},
-std::array<float,2>{0.495363683f, 0.708889484f},
-std::array<float,2>{0.834070504f, 0.269138634f},
-std::array<float,2>{0.971436918f, 0.507771373f},
-std::array<float,2>{0.3421413f, 0.485564828f},
-std::array<float,2>{0.083793126f, 0.796222806f},
-std::array<float,2>{0.687428892f, 0.0741188899f},
-std::array<float,2>{0.779591918f, 0.824103773f},
-std::array<float,2>{0.418823272f, 0.0161128193f},
-std::array<float,2>{0.210634455f, 0.590934873f},
-std::array<float,2>{0.548061728f, 0.417712063f},
-std::array<float,2>{0.749967694f, 0.644394875f},
-std::array<float,2>{0.027029667f, 0.319833905f},
-std::array<float,2>{0.253912687f, 0.933697701f},
-std::array<float,2>{0.924633265f, 0.214676306f},
-std::array<float,2>{0.650891304f, 0.754150629f},
-std::array<float,2>{0.0992896482f, 0.11182338f},
-std::array<float,2>{0.365044653f, 0.533238649f},
-std::array<float,2>{0.950197518f, 0.440930486f},
-std::array<float,2>{0.870619833f, 0.725633085f},
-std::array<float,2>{0.442161083f, 0.300955862f},
-std::array<float,2>{0.128924355f, 0.949964404f},
-std::array<float,2>{0.622810483f, 0.129378468f},
-std::array<float,2>{0.878920615f, 0.889564395f},
-std::array<float,2>{0.285146803f, 0.234347016f},
-std::array<float,2>{0.0461996756f, 0.658097088f},
-std::array<float,2>{0.701793909f, 0.356590122f},
-std::array<float,2>{0.508072019f, 0.608444631f},
-std::array<float,2>{0.240738168f, 0.390434802f},
-std::array<float,2>{0.404335529f, 0.87185204f},
-std::array<float,2>{0.793160677f, 0.0434720926f},
-std::array<float,2>{0.502872765f, 0.765702844f},
-std::array<float,2>{0.243923381f, 0.10267289f},
-std::array<float,2>{0.394672424f, 0.548625886f},
-std::array<float,2>{0.788547695f, 0.465857536f},
-std::array<float,2>{0.886262894f, 0.746231556f},
-std::array<float,2>{0.294047832f, 0.289098442f},
-std::array<float,2>{0.0314481966f, 0.961409569f},
-std::array<float,2>{0.694155097f, 0.148297429f},
-std::array<float,2>{0.866037846f, 0.891321182f},
-std::array<float,2>{0.451078951f, 0.235916257f},
-std::array<float,2>{0.134364396f, 0.678170145f},
-std::array<float,2>{0.616381049f, 0.368837774f},
-std::array<float,2>{0.643651068f, 0.624979138f},
-std::array<float,2>{0.101605795f, 0.400469273f},
-std::array<float,2>{0.370269328f, 0.85857296f},
-std::array<float,2>{0.941544235f, 0.057993181f},
-std::array<float,2>{0.737301469f, 0.97050339f},
-std::array<float,2>{0.0166680701f, 0.174171776f},
-std::array<float,2>{0.260424018f, 0.688731253f},
-std::array<float,2>{0.930802286f, 0.254427344f},
-std::array<float,2>{0.770240605f, 0.524109185f},
-std::array<float,2>{0.406266868f, 0.477711201f},
-std::array<float,2>{0.212634459f, 0.802463651f},
-std::array<float,2>{0.557900369f, 0.0837154016f},
-std::array<float,2>{0.976992786f, 0.828768075f},
-std::array<float,2>{0.335855395f, 0.00710152276f},
-std::array<float,2>{0.0937122479f, 0.574055731f},
-std::array<float,2>{0.678114951f, 0.427553713f},
-std::array<float,2>{0.577712357f, 0.634221494f},
-std::array<float,2>{0.17060855f, 0.343575388f},
-std::array<float,2>{0.486462831f, 0.916811466f},
-std::array<float,2>{0.841712356f, 0.198100328f},
-std::array<float,2>{0.599734366f, 0.931860864f},
-std::array<float,2>{0.14084743f, 0.217477605f},
-std::array<float,2>{0.455399483f, 0.64487493f},
-std::array<float,2>{0.848416626f, 0.312734067f},
-std::array<float,2>{0.966428399f, 0.588635504f},
-std::array<float,2>{0.352831423f, 0.421604991f},
-std::array<float,2>{0.117264681f, 0.827921331f},
-std::array<float,2>{0.632775962f, 0.0212159529f},
-std::array<float,2>{0.808995247f, 0.792654932f},
-std::array<float,2>{0.389184803f, 0.0758414418f},
-std::array<float,2>{0.227966562f, 0.501738727f},
-std::array<float,2>{0.528051376f, 0.488955319f},
-std::array<float,2>{0.717327476f, 0.703799129f},
-std::array<float,2>{0.0485869683f, 0.271852136f},
-std::array<float,2>{0.299658597f, 0.987957954f},
-std::array<float,2>{0.90086019f, 0.157849103f},
-std::array<float,2>{0.671441674f, 0.868808568f},
-std::array<float,2>{0.0627407059f, 0.0394098461f},
-std::array<float,2>{0.320723444f, 0.604976356f},
-std::array<float,2>{0.993578374f, 0.385594726f},
-std::array<float,2>{0.824117482f, 0.663217366f},
-std::array<float,2>{0.480855495f, 0.352581322f},
-std::array<float,2>{0.181370407f, 0.885754645f},
-std::array<float,2>{0.583712697f, 0.227713659f},
-std::array<float,2>{0.914421499f, 0.94764322f},
-std::array<float,2>{0.278915763f, 0.126434058f},
-std::array<float,2>{0.0152008021f, 0.72117722f},
-std::array<float,2>{0.722652972f, 0.298757404f},
-std::array<float,2>{0.535131454f, 0.535972059f},
-std::array<float,2>{0.197390601f, 0.44441694f},
-std::array<float,2>{0.430454016f, 0.752326012f},
-std::array<float,2>{0.751713157f, 0.11448957f},
-std::array<float,2>{0.590165198f, 0.812982798f},
-std::array<float,2>{0.174139187f, 0.0258690733f},
-std::array<float,2>{0.474763393f, 0.581697762f},
-std::array<float,2>{0.817427039f, 0.409760267f},
-std::array<float,2>{0.987621725f, 0.649619877f},
-std::array<float,2>{0.316914171f, 0.321506947f},
-std::array<float,2>{0.0735658258f, 0.925177455f},
-std::array<float,2>{0.656701446f, 0.206005529f},
-std::array<float,2>{0.759622455f, 0.998555541f},
-std::array<float,2>{0.428282201f, 0.169897154f},
-std::array<float,2>{0.191803873f, 0.716441572f},
-std::array<float,2>{0.539914548f, 0.276658893f},
-std::array<float,2>{0.727091908f, 0.507891357f},
-std::array<float,2>{0.00747131417f, 0.494175434f},
-std::array<float,2>{0.270108461f, 0.78162533f},
-std::array<float,2>{0.909146845f, 0.0700065717f},
-std::array<float,2>{0.637463212f, 0.881389737f},
-std::array<float,2>{0.116385356f, 0.222047016f},
-std::array<float,2>{0.350594729f, 0.671410561f},
-std::array<float,2>{0.959670186f, 0.347254544f},
-std::array<float,2>{0.854089737f, 0.599091291f},
-std::array<float,2>{0.464592904f, 0.375157028f},
-std::array<float,2>{0.155308068f, 0.861400664f},
-std::array<float,2>{0.604231954f, 0.0368346646f},
-std::array<float,2>{0.895907462f, 0.762396097f},
-std::array<float,2>{0.308734268f, 0.122445583f},
-std::array<float,2>{0.0555201285f, 0.53983587f},
-std::array<float,2>{0.707778275f, 0.447348177f},
-std::array<float,2>{0.520745754f, 0.727907896f},
-std::array<float,2>{0.222228676f, 0.306128293f},
-std::array<float,2>{0.382251918f, 0.941773057f},
-std::array<float,2>{0.80142343f, 0.134273827f},
-std::array<float,2>{0.552312672f, 0.955178678f},
-std::array<float,2>{0.204452142f, 0.155410081f},
-std::array<float,2>{0.415477961f, 0.735120356f},
-std::array<float,2>{0.7751109f, 0.284954578f},
-std::array<float,2>{0.927439153f, 0.558352232f},
-std::array<float,2>{0.252280235f, 0.460100204f},
-std::array<float,2>{0.0296471287f, 0.778554142f},
-std::array<float,2>{0.745759308f, 0.0942975655f},
-std::array<float,2>{0.830355823f, 0.845187545f},
-std::array<float,2>{0.497084528f, 0.0528678223f},
-std::array<float,2>{0.159319326f, 0.612556815f},
-std::array<float,2>{0.566476107f, 0.39726007f},
-std::array<float,2>{0.680134535f, 0.679888904f},
-std::array<float,2>{0.0811003447f, 0.36699006f},
-std::array<float,2>{0.338058531f, 0.902356029f},
-std::array<float,2>{0.972873211f, 0.243553355f},
-std::array<float,2>{0.699134469f, 0.811041892f},
-std::array<float,2>{0.0406060182f, 0.0880950838f},
-std::array<float,2>{0.287874252f, 0.522093058f},
-std::array<float,2>{0.878807902f, 0.470799923f},
-std::array<float,2>{0.791625082f, 0.702870607f},
-std::array<float,2>{0.401302189f, 0.258129507f},
-std::array<float,2>{0.237198964f, 0.982026935f},
-std::array<float,2>{0.514783919f, 0.180903032f},
-std::array<float,2>{0.946369529f, 0.913262427f},
-std::array<float,2>{0.359558076f, 0.188946143f},
-std::array<float,2>{0.0971320122f, 0.626479626f},
-std::array<float,2>{0.653744102f, 0.334413528f},
-std::array<float,2>{0.620720088f, 0.563686013f},
-std::array<float,2>{0.127751663f, 0.435745567f},
-std::array<float,2>{0.441404492f, 0.843210876f},
-std::array<float,2>{0.871889293f, 0.0100709107f},
-std::array<float,2>{0.573732316f, 0.761228323f},
-std::array<float,2>{0.167700574f, 0.117686845f},
-std::array<float,2>{0.492171377f, 0.543845713f},
-std::array<float,2>{0.837491393f, 0.450133651f},
-std::array<float,2>{0.980875731f, 0.733415365f},
-std::array<float,2>{0.330926269f, 0.310882688f},
-std::array<float,2>{0.0861712545f, 0.939062297f},
-std::array<float,2>{0.672175884f, 0.137184098f},
-std::array<float,2>{0.766635656f, 0.876789987f},
-std::array<float,2>{0.411788464f, 0.223567069f},
-std::array<float,2>{0.217250556f, 0.665676594f},
-std::array<float,2>{0.560215473f, 0.350899339f},
-std::array<float,2>{0.740013659f, 0.595580757f},
-std::array<float,2>{0.0199166704f, 0.379616231f},
-std::array<float,2>{0.263019115f, 0.864085913f},
-std::array<float,2>{0.936665356f, 0.0319787264f},
-std::array<float,2>{0.645284295f, 0.993852258f},
-std::array<float,2>{0.10614419f, 0.166176528f},
-std::array<float,2>{0.374314934f, 0.714838207f},
-std::array<float,2>{0.9399786f, 0.279142231f},
-std::array<float,2>{0.861758471f, 0.513189077f},
-std::array<float,2>{0.445754379f, 0.49926734f},
-std::array<float,2>{0.139953524f, 0.788207531f},
-std::array<float,2>{0.611234248f, 0.0639821365f},
-std::array<float,2>{0.888406157f, 0.819926262f},
-std::array<float,2>{0.29173401f, 0.0311336182f},
-std::array<float,2>{0.0376375951f, 0.585926712f},
-std::array<float,2>{0.689203084f, 0.414025784f},
-std::array<float,2>{0.504176319f, 0.653995812f},
-std::array<float,2>{0.248547137f, 0.328068882f},
-std::array<float,2>{0.394202948f, 0.929647744f},
-std::array<float,2>{0.784673214f, 0.210853323f},
-std::array<float,2>{0.537170529f, 0.908340216f},
-std::array<float,2>{0.202364206f, 0.193959415f},
-std::array<float,2>{0.437088549f, 0.632298529f},
-std::array<float,2>{0.75455749f, 0.328619301f},
-std::array<float,2>{0.920178354f, 0.568255305f},
-std::array<float,2>{0.276917994f, 0.433545709f},
-std::array<float,2>{0.00828638114f, 0.838688791f},
-std::array<float,2>{0.723298788f, 0.0145879211f},
-std::array<float,2>{0.824967504f, 0.805827022f},
-std::array<float,2>{0.47860536f, 0.0931991413f},
-std::array<float,2>{0.184384525f, 0.515946925f},
-std::array<float,2>{0.579523563f, 0.473775417f},
-std::array<float,2>{0.667399764f, 0.697810769f},
-std::array<float,2>{0.0672482997f, 0.264929622f},
-std::array<float,2>{0.32683745f, 0.980229318f},
-std::array<float,2>{0.996389031f, 0.185002297f},
-std::array<float,2>{0.713450551f, 0.850878298f},
-std::array<float,2>{0.0511028431f, 0.0476359911f},
-std::array<float,2>{0.301978916f, 0.613556802f},
-std::array<float,2>{0.905155122f, 0.392464668f},
-std::array<float,2>{0.808542252f, 0.686739743f},
-std::array<float,2>{0.385324478f, 0.363278091f},
-std::array<float,2>{0.232715324f, 0.899344325f},
-std::array<float,2>{0.523641348f, 0.246928066f},
-std::array<float,2>{0.963141501f, 0.958129764f},
-std::array<float,2>{0.357658863f, 0.152201831f},
-std::array<float,2>{0.123514883f, 0.741785228f},
-std::array<float,2>{0.625220537f, 0.288315356f},
-std::array<float,2>{0.59466368f, 0.558913648f},
-std::array<float,2>{0.144940332f, 0.455211937f},
-std::array<float,2>{0.458498567f, 0.776960909f},
-std::array<float,2>{0.847639799f, 0.0977331847f},
-std::array<float,2>{0.518597126f, 0.832986116f},
-std::array<float,2>{0.225396335f, 0.00147233624f},
-std::array<float,2>{0.377612799f, 0.575013995f},
-std::array<float,2>{0.796897233f, 0.423157752f},
-std::array<float,2>{0.892415106f, 0.637475014f},
-std::array<float,2>{0.307824284f, 0.338893056f},
-std::array<float,2>{0.0607770979f, 0.918000281f},
-std::array<float,2>{0.70579803f, 0.201635629f},
-std::array<float,2>{0.856370628f, 0.973479688f},
-std::array<float,2>{0.464996934f, 0.17607075f},
-std::array<float,2>{0.151892409f, 0.694655001f},
-std::array<float,2>{0.606186986f, 0.250879824f},
-std::array<float,2>{0.635213077f, 0.52916199f},
-std::array<float,2>{0.109809533f, 0.481793463f},
-std::array<float,2>{0.343979895f, 0.800733507f},
-std::array<float,2>{0.954625368f, 0.0788624212f},
-std::array<float,2>{0.732812703f, 0.894940794f},
-std::array<float,2>{0.000410855806f, 0.240731522f},
-std::array<float,2>{0.266994983f, 0.674139738f},
-std::array<float,2>{0.91292417f, 0.372336268f},
-std::array<float,2>{0.763065279f, 0.618300557f},
-std::array<float,2>{0.425728619f, 0.403129727f},
-std::array<float,2>{0.189829737f, 0.854477167f},
-std::array<float,2>{0.546814203f, 0.062100891f},
-std::array<float,2>{0.989674091f, 0.769658566f},
-std::array<float,2>{0.314719707f, 0.107502826f},
-std::array<float,2>{0.0756767392f, 0.551303506f},
-std::array<float,2>{0.664049268f, 0.462368548f},
-std::array<float,2>{0.589514375f, 0.743850708f},
-std::array<float,2>{0.179519147f, 0.295123786f},
-std::array<float,2>{0.472486347f, 0.965367734f},
-std::array<float,2>{0.815696657f, 0.142577007f},
-std::array<float,2>{0.623938501f, 0.951831698f},
-std::array<float,2>{0.13167353f, 0.132803291f},
-std::array<float,2>{0.444168746f, 0.723727167f},
-std::array<float,2>{0.868817866f, 0.303478062f},
-std::array<float,2>{0.951275945f, 0.532553971f},
-std::array<float,2>{0.366831183f, 0.439165026f},
-std::array<float,2>{0.0999242738f, 0.757668436f},
-std::array<float,2>{0.650260508f, 0.110069573f},
-std::array<float,2>{0.795481145f, 0.873176336f},
-std::array<float,2>{0.402351648f, 0.0466784686f},
-std::array<float,2>{0.238733783f, 0.607105315f},
-std::array<float,2>{0.510605097f, 0.38721922f},
-std::array<float,2>{0.700635612f, 0.659643769f},
-std::array<float,2>{0.0448152721f, 0.357453525f},
-std::array<float,2>{0.282867879f, 0.887281656f},
-std::array<float,2>{0.881451786f, 0.230596632f},
-std::array<float,2>{0.684079885f, 0.794493794f},
-std::array<float,2>{0.0846424401f, 0.0708177388f},
-std::array<float,2>{0.340873092f, 0.504191041f},
-std::array<float,2>{0.969294071f, 0.487679332f},
-std::array<float,2>{0.832034767f, 0.710721731f},
-std::array<float,2>{0.493716836f, 0.265731543f},
-std::array<float,2>{0.16315636f, 0.991526961f},
-std::array<float,2>{0.563651025f, 0.160884961f},
-std::array<float,2>{0.923217833f, 0.936390698f},
-std::array<float,2>{0.256742239f, 0.212348282f},
-std::array<float,2>{0.0240452345f, 0.641315341f},
-std::array<float,2>{0.7472018f, 0.317009419f},
-std::array<float,2>{0.550295174f, 0.5919559f},
-std::array<float,2>{0.207425296f, 0.415503055f},
-std::array<float,2>{0.420582235f, 0.821084321f},
-std::array<float,2>{0.779054224f, 0.0191050693f},
-std::array<float,2>{0.556550562f, 0.803179502f},
-std::array<float,2>{0.213695705f, 0.0854158029f},
-std::array<float,2>{0.408244014f, 0.526134014f},
-std::array<float,2>{0.771950483f, 0.47855705f},
-std::array<float,2>{0.93190378f, 0.690414011f},
-std::array<float,2>{0.258490771f, 0.256150544f},
-std::array<float,2>{0.0180485081f, 0.97255218f},
-std::array<float,2>{0.735889137f, 0.173108831f},
-std::array<float,2>{0.842323422f, 0.914588511f},
-std::array<float,2>{0.48607707f, 0.195601881f},
-std::array<float,2>{0.169720933f, 0.634805977f},
-std::array<float,2>{0.574700952f, 0.341359735f},
-std::array<float,2>{0.677705348f, 0.570334971f},
-std::array<float,2>{0.0905952081f, 0.429153681f},
-std::array<float,2>{0.332718045f, 0.830335915f},
-std::array<float,2>{0.979119778f, 0.00515875407f},
-std::array<float,2>{0.691412926f, 0.963660777f},
-std::array<float,2>{0.0333959348f, 0.145384818f},
-std::array<float,2>{0.296756387f, 0.748586833f},
-std::array<float,2>{0.884723783f, 0.291895062f},
-std::array<float,2>{0.787029088f, 0.550603151f},
-std::array<float,2>{0.398326755f, 0.46750024f},
-std::array<float,2>{0.244365469f, 0.769053578f},
-std::array<float,2>{0.50023365f, 0.104144208f},
-std::array<float,2>{0.945287168f, 0.855665386f},
-std::array<float,2>{0.368409902f, 0.0554952398f},
-std::array<float,2>{0.104781143f, 0.621815026f},
-std::array<float,2>{0.642395437f, 0.399034053f},
-std::array<float,2>{0.613484442f, 0.676235437f},
-std::array<float,2>{0.135401085f, 0.369950473f},
-std::array<float,2>{0.453031093f, 0.893932581f},
-std::array<float,2>{0.864583135f, 0.236665338f},
-std::array<float,2>{0.585592806f, 0.883811116f},
-std::array<float,2>{0.183348835f, 0.229619861f},
-std::array<float,2>{0.48417449f, 0.66107583f},
-std::array<float,2>{0.821374595f, 0.354671657f},
-std::array<float,2>{0.995594263f, 0.602944851f},
-std::array<float,2>{0.323095202f, 0.383644193f},
-std::array<float,2>{0.0656352863f, 0.870545506f},
-std::array<float,2>{0.669627964f, 0.0414098352f},
-std::array<float,2>{0.751992643f, 0.75091511f},
-std::array<float,2>{0.433398426f, 0.116766699f},
-std::array<float,2>{0.195653602f, 0.538090348f},
-std::array<float,2>{0.532452047f, 0.441714674f},
-std::array<float,2>{0.719578028f, 0.720687151f},
-std::array<float,2>{0.0121219521f, 0.29889816f},
-std::array<float,2>{0.281181276f, 0.9455778f},
-std::array<float,2>{0.917192757f, 0.128510028f},
-std::array<float,2>{0.629773438f, 0.825946927f},
-std::array<float,2>{0.121060044f, 0.0218972024f},
-std::array<float,2>{0.355438679f, 0.586211741f},
-std::array<float,2>{0.968666613f, 0.418880075f},
-std::array<float,2>{0.851251066f, 0.646531641f},
-std::array<float,2>{0.454595506f, 0.316197276f},
-std::array<float,2>{0.142915115f, 0.930397332f},
-std::array<float,2>{0.598130822f, 0.216759622f},
-std::array<float,2>{0.899055243f, 0.98467797f},
-std::array<float,2>{0.297686666f, 0.159412146f},
-std::array<float,2>{0.0500567555f, 0.706270635f},
-std::array<float,2>{0.71501857f, 0.27083531f},
-std::array<float,2>{0.530030549f, 0.501955032f},
-std::array<float,2>{0.229033068f, 0.491653115f},
-std::array<float,2>{0.387619734f, 0.789177299f},
-std::array<float,2>{0.810862541f, 0.0778869539f},
-std::array<float,2>{0.60343945f, 0.859416306f},
-std::array<float,2>{0.153951004f, 0.0383163057f},
-std::array<float,2>{0.462501734f, 0.599757254f},
-std::array<float,2>{0.852873564f, 0.378340751f},
-std::array<float,2>{0.957493484f, 0.669182599f},
-std::array<float,2>{0.349024773f, 0.344968885f},
-std::array<float,2>{0.113874428f, 0.87954092f},
-std::array<float,2>{0.638758183f, 0.219154209f},
-std::array<float,2>{0.803105533f, 0.94442457f},
-std::array<float,2>{0.379600406f, 0.135880902f},
-std::array<float,2>{0.219267994f, 0.728518128f},
-std::array<float,2>{0.522191823f, 0.308378756f},
-std::array<float,2>{0.710739732f, 0.542085111f},
-std::array<float,2>{0.0583345257f, 0.446834594f},
-std::array<float,2>{0.311480552f, 0.763867259f},
-std::array<float,2>{0.897156239f, 0.124887086f},
-std::array<float,2>{0.659332395f, 0.922918618f},
-std::array<float,2>{0.0718493536f, 0.204067394f},
-std::array<float,2>{0.318840176f, 0.650743604f},
-std::array<float,2>{0.985153615f, 0.323365092f},
-std::array<float,2>{0.819407761f, 0.579864919f},
-std::array<float,2>{0.473038703f, 0.407242984f},
-std::array<float,2>{0.172023118f, 0.815499246f},
-std::array<float,2>{0.593100905f, 0.0245835036f},
-std::array<float,2>{0.907233894f, 0.783635736f},
-std::array<float,2>{0.272478878f, 0.0678934678f},
-std::array<float,2>{0.00557654817f, 0.510882378f},
-std::array<float,2>{0.730139315f, 0.492999434f},
-std::array<float,2>{0.541841686f, 0.718135178f},
-std::array<float,2>{0.194527119f, 0.274921805f},
-std::array<float,2>{0.425962299f, 0.996154189f},
-std::array<float,2>{0.76103425f, 0.171505764f},
-std::array<float,2>{0.513228834f, 0.983143032f},
-std::array<float,2>{0.234476119f, 0.183431298f},
-std::array<float,2>{0.400368184f, 0.699275017f},
-std::array<float,2>{0.790288687f, 0.260190189f},
-std::array<float,2>{0.875307679f, 0.519841194f},
-std::array<float,2>{0.285859436f, 0.469722211f},
-std::array<float,2>{0.0412447266f, 0.809947014f},
-std::array<float,2>{0.697128117f, 0.0876829177f},
-std::array<float,2>{0.87409848f, 0.840294898f},
-std::array<float,2>{0.438454837f, 0.00924170483f},
-std::array<float,2>{0.125113577f, 0.564818978f},
-std::array<float,2>{0.618968427f, 0.435373664f},
-std::array<float,2>{0.655763745f, 0.627905667f},
-std::array<float,2>{0.0943977535f, 0.332254112f},
-std::array<float,2>{0.362592191f, 0.91101265f},
-std::array<float,2>{0.947521806f, 0.189563259f},
-std::array<float,2>{0.742983639f, 0.781209052f},
-std::array<float,2>{0.028732257f, 0.0959207937f},
-std::array<float,2>{0.250016481f, 0.555645287f},
-std::array<float,2>{0.928035498f, 0.458786845f},
-std::array<float,2>{0.775864065f, 0.736767709f},
-std::array<float,2>{0.416977197f, 0.28179872f},
-std::array<float,2>{0.205935851f, 0.953405976f},
-std::array<float,2>{0.554284811f, 0.152831912f},
-std::array<float,2>{0.976375699f, 0.904447019f},
-std::array<float,2>{0.337380916f, 0.245228067f},
-std::array<float,2>{0.0781607628f, 0.681690454f},
-std::array<float,2>{0.682442129f, 0.365069598f},
-std::array<float,2>{0.57009232f, 0.610806227f},
-std::array<float,2>{0.157494977f, 0.395035237f},
-std::array<float,2>{0.499132723f, 0.845870972f},
-std::array<float,2>{0.828215897f, 0.0512736626f},
-std::array<float,2>{0.56419009f, 0.796637714f},
-std::array<float,2>{0.163919061f, 0.0737016946f},
-std::array<float,2>{0.493638933f, 0.507306933f},
-std::array<float,2>{0.832874954f, 0.486154139f},
-std::array<float,2>{0.968774736f, 0.708412707f},
-std::array<float,2>{0.341487795f, 0.268647015f},
-std::array<float,2>{0.0842801332f, 0.989672065f},
-std::array<float,2>{0.684408784f, 0.164028361f},
-std::array<float,2>{0.778483391f, 0.93415004f},
-std::array<float,2>{0.420318365f, 0.214296401f},
-std::array<float,2>{0.207687244f, 0.643583775f},
-std::array<float,2>{0.550140977f, 0.319336414f},
-std::array<float,2>{0.747597635f, 0.591647744f},
-std::array<float,2>{0.0234848447f, 0.417278916f},
-std::array<float,2>{0.256243408f, 0.823675811f},
-std::array<float,2>{0.923764884f, 0.0162731446f},
-std::array<float,2>{0.649499476f, 0.949328184f},
-std::array<float,2>{0.100140527f, 0.129857734f},
-std::array<float,2>{0.366290957f, 0.726333797f},
-std::array<float,2>{0.951734841f, 0.301708341f},
-std::array<float,2>{0.868465841f, 0.534008205f},
-std::array<float,2>{0.443601787f, 0.44047007f},
-std::array<float,2>{0.131111488f, 0.754825234f},
-std::array<float,2>{0.623240292f, 0.111628041f},
-std::array<float,2>{0.880901158f, 0.871107936f},
-std::array<float,2>{0.282562703f, 0.0433140919f},
-std::array<float,2>{0.0443207063f, 0.609214365f},
-std::array<float,2>{0.701056063f, 0.390032738f},
-std::array<float,2>{0.50976795f, 0.657267392f},
-std::array<float,2>{0.238944665f, 0.356945246f},
-std::array<float,2>{0.402960449f, 0.888976455f},
-std::array<float,2>{0.79508692f, 0.233646587f},
-std::array<float,2>{0.546312273f, 0.898041487f},
-std::array<float,2>{0.190322965f, 0.240192875f},
-std::array<float,2>{0.424936533f, 0.673636377f},
-std::array<float,2>{0.763579011f, 0.373731732f},
-std::array<float,2>{0.912443101f, 0.620551288f},
-std::array<float,2>{0.267483085f, 0.405285567f},
-std::array<float,2>{0.000721480174f, 0.852112472f},
-std::array<float,2>{0.733312786f, 0.0603698418f},
-std::array<float,2>{0.816096306f, 0.772754252f},
-std::array<float,2>{0.471725821f, 0.10661111f},
-std::array<float,2>{0.179008469f, 0.552785754f},
-std::array<float,2>{0.589071989f, 0.464038968f},
-std::array<float,2>{0.663457692f, 0.745473444f},
-std::array<float,2>{0.0758208856f, 0.293094754f},
-std::array<float,2>{0.315372169f, 0.967515528f},
-std::array<float,2>{0.990098596f, 0.144168749f},
-std::array<float,2>{0.705399692f, 0.834150136f},
-std::array<float,2>{0.0614946932f, 0.00353032025f},
-std::array<float,2>{0.308421671f, 0.576801181f},
-std::array<float,2>{0.891922653f, 0.424520701f},
-std::array<float,2>{0.797694802f, 0.638933718f},
-std::array<float,2>{0.377252489f, 0.336355895f},
-std::array<float,2>{0.224921912f, 0.921851397f},
-std::array<float,2>{0.519212008f, 0.199972719f},
-std::array<float,2>{0.954341948f, 0.976083219f},
-std::array<float,2>{0.344247609f, 0.177827209f},
-std::array<float,2>{0.110064954f, 0.69255656f},
-std::array<float,2>{0.635709882f, 0.252566308f},
-std::array<float,2>{0.605938315f, 0.530737698f},
-std::array<float,2>{0.151505008f, 0.483352631f},
-std::array<float,2>{0.465561718f, 0.797773719f},
-std::array<float,2>{0.855731428f, 0.081345275f},
-std::array<float,2>{0.524197519f, 0.848646343f},
-std::array<float,2>{0.23335281f, 0.0506699346f},
-std::array<float,2>{0.38504234f, 0.616072476f},
-std::array<float,2>{0.807713807f, 0.39382565f},
-std::array<float,2>{0.904443204f, 0.684958041f},
-std::array<float,2>{0.302581161f, 0.360572696f},
-std::array<float,2>{0.0514660254f, 0.900468767f},
-std::array<float,2>{0.712916315f, 0.249230221f},
-std::array<float,2>{0.84680748f, 0.959142745f},
-std::array<float,2>{0.458157629f, 0.148974955f},
-std::array<float,2>{0.145131856f, 0.740191698f},
-std::array<float,2>{0.593940318f, 0.285157293f},
-std::array<float,2>{0.625578642f, 0.560939491f},
-std::array<float,2>{0.123554923f, 0.454194188f},
-std::array<float,2>{0.358291477f, 0.773673594f},
-std::array<float,2>{0.963770092f, 0.0998406112f},
-std::array<float,2>{0.72301358f, 0.906657338f},
-std::array<float,2>{0.00839553867f, 0.192957118f},
-std::array<float,2>{0.27670157f, 0.629876018f},
-std::array<float,2>{0.920441449f, 0.331300467f},
-std::array<float,2>{0.754297435f, 0.569006979f},
-std::array<float,2>{0.436576933f, 0.431428283f},
-std::array<float,2>{0.203068495f, 0.837290108f},
-std::array<float,2>{0.53798753f, 0.0130803185f},
-std::array<float,2>{0.996712506f, 0.808209062f},
-std::array<float,2>{0.326460332f, 0.0914987102f},
-std::array<float,2>{0.0666257069f, 0.518780768f},
-std::array<float,2>{0.667726636f, 0.475985616f},
-std::array<float,2>{0.579845428f, 0.696987689f},
-std::array<float,2>{0.18378374f, 0.2620956f},
-std::array<float,2>{0.479271978f, 0.97800535f},
-std::array<float,2>{0.824469745f, 0.187012568f},
-std::array<float,2>{0.610389054f, 0.996074915f},
-std::array<float,2>{0.14036116f, 0.16534017f},
-std::array<float,2>{0.44585529f, 0.711019456f},
-std::array<float,2>{0.861888051f, 0.279387832f},
-std::array<float,2>{0.939466953f, 0.514087796f},
-std::array<float,2>{0.374588937f, 0.496931434f},
-std::array<float,2>{0.105784841f, 0.786150992f},
-std::array<float,2>{0.64481014f, 0.0644930378f},
-std::array<float,2>{0.784619868f, 0.81744206f},
-std::array<float,2>{0.393859088f, 0.0289276857f},
-std::array<float,2>{0.248104408f, 0.583113015f},
-std::array<float,2>{0.504748464f, 0.411846787f},
-std::array<float,2>{0.688908577f, 0.655137837f},
-std::array<float,2>{0.0374763273f, 0.325464994f},
-std::array<float,2>{0.291444123f, 0.927638531f},
-std::array<float,2>{0.888181746f, 0.207463115f},
-std::array<float,2>{0.672816873f, 0.758636117f},
-std::array<float,2>{0.0865263343f, 0.119256988f},
-std::array<float,2>{0.330558121f, 0.546548784f},
-std::array<float,2>{0.981397033f, 0.451692373f},
-std::array<float,2>{0.837047815f, 0.730642438f},
-std::array<float,2>{0.491280705f, 0.310266435f},
-std::array<float,2>{0.167045563f, 0.94019264f},
-std::array<float,2>{0.573285758f, 0.139949322f},
-std::array<float,2>{0.937332511f, 0.877322257f},
-std::array<float,2>{0.263449132f, 0.226069137f},
-std::array<float,2>{0.0202423446f, 0.667661726f},
-std::array<float,2>{0.739464402f, 0.347972482f},
-std::array<float,2>{0.559883475f, 0.596960127f},
-std::array<float,2>{0.217388421f, 0.381951869f},
-std::array<float,2>{0.411304951f, 0.865929246f},
-std::array<float,2>{0.767533422f, 0.0332889296f},
-std::array<float,2>{0.553986907f, 0.778940678f},
-std::array<float,2>{0.205440596f, 0.0939555988f},
-std::array<float,2>{0.416416913f, 0.557892323f},
-std::array<float,2>{0.776019275f, 0.460879594f},
-std::array<float,2>{0.928382933f, 0.734661996f},
-std::array<float,2>{0.250757664f, 0.284663826f},
-std::array<float,2>{0.0289380047f, 0.955712438f},
-std::array<float,2>{0.742248297f, 0.155837029f},
-std::array<float,2>{0.828873634f, 0.903245389f},
-std::array<float,2>{0.499826282f, 0.243894085f},
-std::array<float,2>{0.157984823f, 0.68046397f},
-std::array<float,2>{0.569419026f, 0.366578251f},
-std::array<float,2>{0.681925654f, 0.613176286f},
-std::array<float,2>{0.0790445283f, 0.3969087f},
-std::array<float,2>{0.337542087f, 0.845641911f},
-std::array<float,2>{0.975942373f, 0.0534744039f},
-std::array<float,2>{0.696748257f, 0.981620789f},
-std::array<float,2>{0.0416779891f, 0.181243494f},
-std::array<float,2>{0.285432428f, 0.702357948f},
-std::array<float,2>{0.875834405f, 0.258326262f},
-std::array<float,2>{0.790691972f, 0.521748066f},
-std::array<float,2>{0.399894118f, 0.471329689f},
-std::array<float,2>{0.235129133f, 0.810975432f},
-std::array<float,2>{0.512900651f, 0.0885151178f},
-std::array<float,2>{0.947905242f, 0.843317807f},
-std::array<float,2>{0.363279641f, 0.0104180658f},
-std::array<float,2>{0.0938719288f, 0.563968658f},
-std::array<float,2>{0.655331254f, 0.436433941f},
-std::array<float,2>{0.618493319f, 0.62640065f},
-std::array<float,2>{0.125764638f, 0.334514856f},
-std::array<float,2>{0.437507719f, 0.913939893f},
-std::array<float,2>{0.874987423f, 0.189173535f},
-std::array<float,2>{0.593693078f, 0.925468862f},
-std::array<float,2>{0.172382891f, 0.205293477f},
-std::array<float,2>{0.473218888f, 0.650130451f},
-std::array<float,2>{0.820088327f, 0.321811825f},
-std::array<float,2>{0.984646797f, 0.581514657f},
-std::array<float,2>{0.319315881f, 0.409663588f},
-std::array<float,2>{0.0713196248f, 0.813099146f},
-std::array<float,2>{0.659684002f, 0.0260648932f},
-std::array<float,2>{0.761593342f, 0.782134056f},
-std::array<float,2>{0.426560462f, 0.0697450563f},
-std::array<float,2>{0.195079714f, 0.50833571f},
-std::array<float,2>{0.541176796f, 0.494775653f},
-std::array<float,2>{0.729831696f, 0.716138601f},
-std::array<float,2>{0.00521641038f, 0.27720812f},
-std::array<float,2>{0.273300171f, 0.99822551f},
-std::array<float,2>{0.907987237f, 0.169344187f},
-std::array<float,2>{0.639262795f, 0.861872077f},
-std::array<float,2>{0.113405883f, 0.0362241268f},
-std::array<float,2>{0.349162936f, 0.5995785f},
-std::array<float,2>{0.957825243f, 0.375530154f},
-std::array<float,2>{0.853369534f, 0.671150029f},
-std::array<float,2>{0.462059408f, 0.347016603f},
-std::array<float,2>{0.153674096f, 0.881065607f},
-std::array<float,2>{0.602909267f, 0.222363204f},
-std::array<float,2>{0.896524549f, 0.94203794f},
-std::array<float,2>{0.310811698f, 0.134576648f},
-std::array<float,2>{0.0578917824f, 0.728084624f},
-std::array<float,2>{0.710377634f, 0.306170553f},
-std::array<float,2>{0.521969557f, 0.539512396f},
-std::array<float,2>{0.218800709f, 0.447756648f},
-std::array<float,2>{0.379003733f, 0.761776567f},
-std::array<float,2>{0.803297758f, 0.122641817f},
-std::array<float,2>{0.598578334f, 0.827302396f},
-std::array<float,2>{0.143361971f, 0.0208248701f},
-std::array<float,2>{0.454430282f, 0.588349581f},
-std::array<float,2>{0.850864828f, 0.420977741f},
-std::array<float,2>{0.968164802f, 0.645063937f},
-std::array<float,2>{0.354742169f, 0.31315279f},
-std::array<float,2>{0.120550804f, 0.932179332f},
-std::array<float,2>{0.629057348f, 0.217183441f},
-std::array<float,2>{0.811073124f, 0.987439096f},
-std::array<float,2>{0.387178272f, 0.157301188f},
-std::array<float,2>{0.228907645f, 0.703552127f},
-std::array<float,2>{0.529699683f, 0.27208823f},
-std::array<float,2>{0.715669811f, 0.501116931f},
-std::array<float,2>{0.0505619831f, 0.488312453f},
-std::array<float,2>{0.297192723f, 0.792173326f},
-std::array<float,2>{0.898589253f, 0.0752469301f},
-std::array<float,2>{0.669369459f, 0.886672974f},
-std::array<float,2>{0.0663400143f, 0.228487149f},
-std::array<float,2>{0.322353214f, 0.66394645f},
-std::array<float,2>{0.995691895f, 0.353472173f},
-std::array<float,2>{0.822107434f, 0.605007291f},
-std::array<float,2>{0.483540744f, 0.384842724f},
-std::array<float,2>{0.182643622f, 0.868607879f},
-std::array<float,2>{0.585200548f, 0.0396857597f},
-std::array<float,2>{0.917594612f, 0.752469003f},
-std::array<float,2>{0.280394405f, 0.115181126f},
-std::array<float,2>{0.0124942465f, 0.535234928f},
-std::array<float,2>{0.719033897f, 0.444891036f},
-std::array<float,2>{0.532887578f, 0.721260726f},
-std::array<float,2>{0.196154699f, 0.298191488f},
-std::array<float,2>{0.432749361f, 0.948111892f},
-std::array<float,2>{0.752486467f, 0.126922026f},
-std::array<float,2>{0.50081867f, 0.961471677f},
-std::array<float,2>{0.245104134f, 0.147683635f},
-std::array<float,2>{0.397722811f, 0.74676007f},
-std::array<float,2>{0.786163747f, 0.289953023f},
-std::array<float,2>{0.883942425f, 0.548019052f},
-std::array<float,2>{0.296187013f, 0.466637939f},
-std::array<float,2>{0.0337865055f, 0.766423225f},
-std::array<float,2>{0.69208914f, 0.103456408f},
-std::array<float,2>{0.864927709f, 0.859129131f},
-std::array<float,2>{0.45225364f, 0.0583888739f},
-std::array<float,2>{0.135012493f, 0.624285936f},
-std::array<float,2>{0.613963604f, 0.40090996f},
-std::array<float,2>{0.641967952f, 0.678708196f},
-std::array<float,2>{0.105201013f, 0.36829254f},
-std::array<float,2>{0.368784994f, 0.890871584f},
-std::array<float,2>{0.944649696f, 0.23550424f},
-std::array<float,2>{0.735668838f, 0.801888347f},
-std::array<float,2>{0.018386757f, 0.0834880173f},
-std::array<float,2>{0.258192211f, 0.523749113f},
-std::array<float,2>{0.932575345f, 0.478317291f},
-std::array<float,2>{0.772261858f, 0.689008713f},
-std::array<float,2>{0.40899989f, 0.253976107f},
-std::array<float,2>{0.213128656f, 0.96984297f},
-std::array<float,2>{0.556001842f, 0.174332216f},
-std::array<float,2>{0.978816807f, 0.916435003f},
-std::array<float,2>{0.332378894f, 0.197681561f},
-std::array<float,2>{0.0900398493f, 0.634425819f},
-std::array<float,2>{0.676859438f, 0.343069524f},
-std::array<float,2>{0.574943721f, 0.573723197f},
-std::array<float,2>{0.169020116f, 0.427127212f},
-std::array<float,2>{0.485661358f, 0.828601003f},
-std::array<float,2>{0.842251539f, 0.00762701826f},
-std::array<float,2>{0.622242212f, 0.757301092f},
-std::array<float,2>{0.12958242f, 0.109566554f},
-std::array<float,2>{0.441588402f, 0.532762825f},
-std::array<float,2>{0.870383382f, 0.438537776f},
-std::array<float,2>{0.950857222f, 0.724572718f},
-std::array<float,2>{0.364706725f, 0.302950025f},
-std::array<float,2>{0.0987104252f, 0.951249063f},
-std::array<float,2>{0.650755048f, 0.132300436f},
-std::array<float,2>{0.793556392f, 0.886977375f},
-std::array<float,2>{0.405060232f, 0.23136133f},
-std::array<float,2>{0.240706593f, 0.659698486f},
-std::array<float,2>{0.508448005f, 0.358290136f},
-std::array<float,2>{0.701277494f, 0.606775463f},
-std::array<float,2>{0.0466836914f, 0.386954367f},
-std::array<float,2>{0.284304172f, 0.873741686f},
-std::array<float,2>{0.879676759f, 0.0462749526f},
-std::array<float,2>{0.686893582f, 0.991837859f},
-std::array<float,2>{0.0832153633f, 0.160203218f},
-std::array<float,2>{0.342376977f, 0.710093319f},
-std::array<float,2>{0.971070588f, 0.266160876f},
-std::array<float,2>{0.834732354f, 0.504710615f},
-std::array<float,2>{0.495860636f, 0.487984687f},
-std::array<float,2>{0.161673918f, 0.793988466f},
-std::array<float,2>{0.564582884f, 0.0707280114f},
-std::array<float,2>{0.924163103f, 0.820386291f},
-std::array<float,2>{0.254750371f, 0.0186591763f},
-std::array<float,2>{0.0264941715f, 0.59246558f},
-std::array<float,2>{0.749488413f, 0.415970594f},
-std::array<float,2>{0.548797786f, 0.640860677f},
-std::array<float,2>{0.210438207f, 0.316758841f},
-std::array<float,2>{0.418415934f, 0.936032534f},
-std::array<float,2>{0.779955924f, 0.212663412f},
-std::array<float,2>{0.516765356f, 0.918852389f},
-std::array<float,2>{0.223458081f, 0.201843873f},
-std::array<float,2>{0.37556091f, 0.636720777f},
-std::array<float,2>{0.800616622f, 0.339446127f},
-std::array<float,2>{0.893814027f, 0.574297071f},
-std::array<float,2>{0.304766744f, 0.423526943f},
-std::array<float,2>{0.0588117205f, 0.832357883f},
-std::array<float,2>{0.70477438f, 0.00133920158f},
-std::array<float,2>{0.8582021f, 0.799898088f},
-std::array<float,2>{0.468430042f, 0.078559421f},
-std::array<float,2>{0.149321511f, 0.528403819f},
-std::array<float,2>{0.608087182f, 0.482215852f},
-std::array<float,2>{0.633772373f, 0.69526732f},
-std::array<float,2>{0.112034105f, 0.250188589f},
-std::array<float,2>{0.347630054f, 0.972682238f},
-std::array<float,2>{0.956996083f, 0.17640397f},
-std::array<float,2>{0.730742633f, 0.853948355f},
-std::array<float,2>{0.0036154741f, 0.0616000891f},
-std::array<float,2>{0.269308716f, 0.618888915f},
-std::array<float,2>{0.910710037f, 0.402459204f},
-std::array<float,2>{0.7653687f, 0.674647927f},
-std::array<float,2>{0.422483802f, 0.372756809f},
-std::array<float,2>{0.187594652f, 0.895271659f},
-std::array<float,2>{0.543191314f, 0.240411416f},
-std::array<float,2>{0.991377234f, 0.965282977f},
-std::array<float,2>{0.312875092f, 0.141605869f},
-std::array<float,2>{0.0781154856f, 0.743583381f},
-std::array<float,2>{0.660827637f, 0.295443296f},
-std::array<float,2>{0.586227477f, 0.551199317f},
-std::array<float,2>{0.176800355f, 0.462638319f},
-std::array<float,2>{0.469511569f, 0.770146906f},
-std::array<float,2>{0.814070106f, 0.107914038f},
-std::array<float,2>{0.536740184f, 0.838120639f},
-std::array<float,2>{0.199404091f, 0.01415399f},
-std::array<float,2>{0.434716612f, 0.567648113f},
-std::array<float,2>{0.755913913f, 0.432797313f},
-std::array<float,2>{0.919654131f, 0.632415116f},
-std::array<float,2>{0.273749292f, 0.328359008f},
-std::array<float,2>{0.0105933249f, 0.908840239f},
-std::array<float,2>{0.725359499f, 0.193571836f},
-std::array<float,2>{0.826552629f, 0.979775488f},
-std::array<float,2>{0.47734794f, 0.185358107f},
-std::array<float,2>{0.186038777f, 0.697656989f},
-std::array<float,2>{0.580093801f, 0.265170932f},
-std::array<float,2>{0.665168107f, 0.516219914f},
-std::array<float,2>{0.0684293658f, 0.474244744f},
-std::array<float,2>{0.324383557f, 0.80654645f},
-std::array<float,2>{0.999768674f, 0.0936209634f},
-std::array<float,2>{0.711466968f, 0.898922741f},
-std::array<float,2>{0.0534996539f, 0.246192291f},
-std::array<float,2>{0.304208547f, 0.687412083f},
-std::array<float,2>{0.903786361f, 0.362644672f},
-std::array<float,2>{0.806111872f, 0.614026368f},
-std::array<float,2>{0.384584457f, 0.392031372f},
-std::array<float,2>{0.231156573f, 0.851200581f},
-std::array<float,2>{0.525570452f, 0.0471671931f},
-std::array<float,2>{0.962810397f, 0.776393473f},
-std::array<float,2>{0.355767071f, 0.0983085483f},
-std::array<float,2>{0.121872783f, 0.559515536f},
-std::array<float,2>{0.627886295f, 0.45578739f},
-std::array<float,2>{0.597340941f, 0.741611362f},
-std::array<float,2>{0.147275299f, 0.288718432f},
-std::array<float,2>{0.460206747f, 0.958906531f},
-std::array<float,2>{0.844780445f, 0.151613787f},
-std::array<float,2>{0.572107017f, 0.938921154f},
-std::array<float,2>{0.164888144f, 0.137594953f},
-std::array<float,2>{0.489112109f, 0.733973026f},
-std::array<float,2>{0.83801347f, 0.311264217f},
-std::array<float,2>{0.982652128f, 0.543172836f},
-std::array<float,2>{0.328404665f, 0.449567258f},
-std::array<float,2>{0.0891592577f, 0.761388421f},
-std::array<float,2>{0.674660921f, 0.117452092f},
-std::array<float,2>{0.768992543f, 0.863355279f},
-std::array<float,2>{0.413453549f, 0.0317289345f},
-std::array<float,2>{0.215294734f, 0.594916284f},
-std::array<float,2>{0.56223464f, 0.379370242f},
-std::array<float,2>{0.740382135f, 0.66534853f},
-std::array<float,2>{0.0227941088f, 0.351512551f},
-std::array<float,2>{0.265131623f, 0.876002252f},
-std::array<float,2>{0.935159683f, 0.222741917f},
-std::array<float,2>{0.647453189f, 0.788854301f},
-std::array<float,2>{0.107675746f, 0.0636298805f},
-std::array<float,2>{0.372500777f, 0.51313144f},
-std::array<float,2>{0.938218653f, 0.499549776f},
-std::array<float,2>{0.860938907f, 0.714345932f},
-std::array<float,2>{0.447745144f, 0.278689444f},
-std::array<float,2>{0.138284683f, 0.993278742f},
-std::array<float,2>{0.612126529f, 0.166789412f},
-std::array<float,2>{0.889713705f, 0.929114103f},
-std::array<float,2>{0.289636493f, 0.210086912f},
-std::array<float,2>{0.0369520895f, 0.653388798f},
-std::array<float,2>{0.690600097f, 0.327185512f},
-std::array<float,2>{0.50685966f, 0.585237145f},
-std::array<float,2>{0.247717217f, 0.413568467f},
-std::array<float,2>{0.391443372f, 0.819462657f},
-std::array<float,2>{0.78145206f, 0.0304852501f},
-std::array<float,2>{0.51553303f, 0.810270488f},
-std::array<float,2>{0.236425653f, 0.0870637447f},
-std::array<float,2>{0.400459528f, 0.520388782f},
-std::array<float,2>{0.791132629f, 0.468831211f},
-std::array<float,2>{0.87818259f, 0.69979161f},
-std::array<float,2>{0.287214398f, 0.260527253f},
-std::array<float,2>{0.0401254743f, 0.982501149f},
-std::array<float,2>{0.698304296f, 0.18276988f},
-std::array<float,2>{0.871219993f, 0.910405695f},
-std::array<float,2>{0.44064188f, 0.190403342f},
-std::array<float,2>{0.127342612f, 0.627101779f},
-std::array<float,2>{0.620599866f, 0.332836688f},
-std::array<float,2>{0.653812706f, 0.56529355f},
-std::array<float,2>{0.0972078741f, 0.434948802f},
-std::array<float,2>{0.35998863f, 0.840449393f},
-std::array<float,2>{0.94723773f, 0.00962819252f},
-std::array<float,2>{0.745555043f, 0.953970492f},
-std::array<float,2>{0.029906977f, 0.153117791f},
-std::array<float,2>{0.252536118f, 0.736887038f},
-std::array<float,2>{0.927173376f, 0.281333625f},
-std::array<float,2>{0.77467519f, 0.554819703f},
-std::array<float,2>{0.415772736f, 0.458333582f},
-std::array<float,2>{0.204772621f, 0.780604005f},
-std::array<float,2>{0.552069604f, 0.0966586247f},
-std::array<float,2>{0.973246932f, 0.846297264f},
-std::array<float,2>{0.338679343f, 0.0510689877f},
-std::array<float,2>{0.0820212215f, 0.610959113f},
-std::array<float,2>{0.680546045f, 0.394817829f},
-std::array<float,2>{0.566988349f, 0.682598948f},
-std::array<float,2>{0.160132974f, 0.364470303f},
-std::array<float,2>{0.497902602f, 0.905240297f},
-std::array<float,2>{0.831040382f, 0.245670944f},
-std::array<float,2>{0.603997946f, 0.87898916f},
-std::array<float,2>{0.156248659f, 0.219651058f},
-std::array<float,2>{0.464045703f, 0.669844627f},
-std::array<float,2>{0.853686452f, 0.345324278f},
-std::array<float,2>{0.95902729f, 0.600381434f},
-std::array<float,2>{0.351546675f, 0.378599465f},
-std::array<float,2>{0.11677821f, 0.859979212f},
-std::array<float,2>{0.636781156f, 0.0385992341f},
-std::array<float,2>{0.801193953f, 0.764370084f},
-std::array<float,2>{0.382536978f, 0.124456085f},
-std::array<float,2>{0.221905112f, 0.542872667f},
-std::array<float,2>{0.52128911f, 0.446646124f},
-std::array<float,2>{0.707354963f, 0.729228318f},
-std::array<float,2>{0.0549130142f, 0.308006704f},
-std::array<float,2>{0.309358239f, 0.94525373f},
-std::array<float,2>{0.896381795f, 0.136582941f},
-std::array<float,2>{0.657127738f, 0.816280067f},
-std::array<float,2>{0.0738238692f, 0.0252646562f},
-std::array<float,2>{0.316677928f, 0.579239666f},
-std::array<float,2>{0.988188267f, 0.408014297f},
-std::array<float,2>{0.817922294f, 0.651319325f},
-std::array<float,2>{0.475503713f, 0.323883772f},
-std::array<float,2>{0.174452737f, 0.923403144f},
-std::array<float,2>{0.590691209f, 0.203555375f},
-std::array<float,2>{0.908452392f, 0.996761858f},
-std::array<float,2>{0.26966235f, 0.1710345f},
-std::array<float,2>{0.00722910138f, 0.71839124f},
-std::array<float,2>{0.726814151f, 0.274654716f},
-std::array<float,2>{0.539531767f, 0.511355162f},
-std::array<float,2>{0.192240804f, 0.492187709f},
-std::array<float,2>{0.428029388f, 0.783830404f},
-std::array<float,2>{0.759215057f, 0.0677777007f},
-std::array<float,2>{0.583279192f, 0.87082541f},
-std::array<float,2>{0.180967644f, 0.0416083708f},
-std::array<float,2>{0.481309593f, 0.603199482f},
-std::array<float,2>{0.823393285f, 0.382973909f},
-std::array<float,2>{0.993801951f, 0.660399437f},
-std::array<float,2>{0.320864379f, 0.355100065f},
-std::array<float,2>{0.0632165894f, 0.884714425f},
-std::array<float,2>{0.671022356f, 0.230318069f},
-std::array<float,2>{0.751236498f, 0.946009278f},
-std::array<float,2>{0.429763973f, 0.127966195f},
-std::array<float,2>{0.197761163f, 0.720070183f},
-std::array<float,2>{0.534565151f, 0.299584299f},
-std::array<float,2>{0.72216624f, 0.538629711f},
-std::array<float,2>{0.0151277073f, 0.442122996f},
-std::array<float,2>{0.278604627f, 0.75044775f},
-std::array<float,2>{0.914562583f, 0.116477601f},
-std::array<float,2>{0.631885886f, 0.929786325f},
-std::array<float,2>{0.118101604f, 0.216006964f},
-std::array<float,2>{0.353138357f, 0.647135615f},
-std::array<float,2>{0.96614629f, 0.315907836f},
-std::array<float,2>{0.847748876f, 0.586624384f},
-std::array<float,2>{0.455773205f, 0.41820693f},
-std::array<float,2>{0.141163737f, 0.825344622f},
-std::array<float,2>{0.600434422f, 0.0219779219f},
-std::array<float,2>{0.901288271f, 0.789956331f},
-std::array<float,2>{0.299284726f, 0.0774100795f},
-std::array<float,2>{0.04832948f, 0.502640486f},
-std::array<float,2>{0.717026532f, 0.491989106f},
-std::array<float,2>{0.527415454f, 0.706707597f},
-std::array<float,2>{0.228301242f, 0.271290332f},
-std::array<float,2>{0.388732165f, 0.985330284f},
-std::array<float,2>{0.809212923f, 0.159744322f},
-std::array<float,2>{0.558422446f, 0.971785426f},
-std::array<float,2>{0.212015703f, 0.173439413f},
-std::array<float,2>{0.406933308f, 0.689675212f},
-std::array<float,2>{0.769812942f, 0.256812215f},
-std::array<float,2>{0.931182921f, 0.525429249f},
-std::array<float,2>{0.259776503f, 0.479268879f},
-std::array<float,2>{0.0174912773f, 0.803306043f},
-std::array<float,2>{0.736673594f, 0.0858629942f},
-std::array<float,2>{0.841276348f, 0.830673218f},
-std::array<float,2>{0.486930877f, 0.00567814568f},
-std::array<float,2>{0.170326352f, 0.570882976f},
-std::array<float,2>{0.577549815f, 0.429295659f},
-std::array<float,2>{0.678706467f, 0.635574996f},
-std::array<float,2>{0.0928133503f, 0.341082931f},
-std::array<float,2>{0.335144043f, 0.914164066f},
-std::array<float,2>{0.977334619f, 0.196080714f},
-std::array<float,2>{0.693409383f, 0.768600643f},
-std::array<float,2>{0.0317880213f, 0.103797175f},
-std::array<float,2>{0.294909954f, 0.550144315f},
-std::array<float,2>{0.886175632f, 0.467213988f},
-std::array<float,2>{0.788864493f, 0.748071074f},
-std::array<float,2>{0.395107687f, 0.29138881f},
-std::array<float,2>{0.24344182f, 0.963083506f},
-std::array<float,2>{0.50224793f, 0.144973591f},
-std::array<float,2>{0.942002833f, 0.894248188f},
-std::array<float,2>{0.370663077f, 0.236941457f},
-std::array<float,2>{0.102060072f, 0.67662847f},
-std::array<float,2>{0.644526124f, 0.369251013f},
-std::array<float,2>{0.616805911f, 0.62135464f},
-std::array<float,2>{0.134276956f, 0.398843288f},
-std::array<float,2>{0.450476408f, 0.856032252f},
-std::array<float,2>{0.86548394f, 0.0548321865f},
-std::array<float,2>{0.609014571f, 0.798187554f},
-std::array<float,2>{0.150247976f, 0.0801495984f},
-std::array<float,2>{0.467112035f, 0.529625118f},
-std::array<float,2>{0.859233856f, 0.484030873f},
-std::array<float,2>{0.955789626f, 0.692087591f},
-std::array<float,2>{0.346599013f, 0.25341031f},
-std::array<float,2>{0.112452477f, 0.975026011f},
-std::array<float,2>{0.634060442f, 0.178736538f},
-std::array<float,2>{0.79905057f, 0.920575619f},
-std::array<float,2>{0.376058936f, 0.200802103f},
-std::array<float,2>{0.224131078f, 0.640421867f},
-std::array<float,2>{0.51652509f, 0.33730489f},
-std::array<float,2>{0.704004824f, 0.577614844f},
-std::array<float,2>{0.0597726144f, 0.425026506f},
-std::array<float,2>{0.306283414f, 0.835013688f},
-std::array<float,2>{0.893472075f, 0.00203718385f},
-std::array<float,2>{0.661232889f, 0.968460977f},
-std::array<float,2>{0.0766012371f, 0.143356562f},
-std::array<float,2>{0.313836902f, 0.744792342f},
-std::array<float,2>{0.991051674f, 0.294202507f},
-std::array<float,2>{0.812716842f, 0.554474235f},
-std::array<float,2>{0.469935358f, 0.463037103f},
-std::array<float,2>{0.17585586f, 0.771839023f},
-std::array<float,2>{0.58751595f, 0.105522551f},
-std::array<float,2>{0.911396384f, 0.853318155f},
-std::array<float,2>{0.268237054f, 0.0592549779f},
-std::array<float,2>{0.0020439541f, 0.620029092f},
-std::array<float,2>{0.732360005f, 0.40514797f},
-std::array<float,2>{0.544297695f, 0.672773957f},
-std::array<float,2>{0.189065203f, 0.374999285f},
-std::array<float,2>{0.423060983f, 0.897425056f},
-std::array<float,2>{0.764434993f, 0.238383189f},
-std::array<float,2>{0.509361446f, 0.889787495f},
-std::array<float,2>{0.241818681f, 0.233292833f},
-std::array<float,2>{0.405486733f, 0.656795979f},
-std::array<float,2>{0.794239283f, 0.356049418f},
-std::array<float,2>{0.880358517f, 0.60757935f},
-std::array<float,2>{0.283339173f, 0.389148682f},
-std::array<float,2>{0.0454519056f, 0.872400701f},
-std::array<float,2>{0.702372313f, 0.0447549522f},
-std::array<float,2>{0.869204104f, 0.755725205f},
-std::array<float,2>{0.442807168f, 0.113105834f},
-std::array<float,2>{0.130647749f, 0.534367502f},
-std::array<float,2>{0.621999621f, 0.43976751f},
-std::array<float,2>{0.65165031f, 0.725401461f},
-std::array<float,2>{0.0979218856f, 0.302630305f},
-std::array<float,2>{0.364146471f, 0.950280905f},
-std::array<float,2>{0.949345887f, 0.129890069f},
-std::array<float,2>{0.748319685f, 0.822660446f},
-std::array<float,2>{0.026145177f, 0.016614411f},
-std::array<float,2>{0.255307525f, 0.589911938f},
-std::array<float,2>{0.925020576f, 0.416828394f},
-std::array<float,2>{0.780382514f, 0.642869055f},
-std::array<float,2>{0.419245601f, 0.318396509f},
-std::array<float,2>{0.209402695f, 0.935013533f},
-std::array<float,2>{0.546907246f, 0.213429749f},
-std::array<float,2>{0.972038925f, 0.989027798f},
-std::array<float,2>{0.343254775f, 0.162938848f},
-std::array<float,2>{0.0822518989f, 0.707366347f},
-std::array<float,2>{0.686169863f, 0.267784625f},
-std::array<float,2>{0.565542758f, 0.506488681f},
-std::array<float,2>{0.160406575f, 0.485026151f},
-std::array<float,2>{0.494548053f, 0.794966102f},
-std::array<float,2>{0.834973931f, 0.0728195533f},
-std::array<float,2>{0.56120646f, 0.866809607f},
-std::array<float,2>{0.216572806f, 0.0341900624f},
-std::array<float,2>{0.412260652f, 0.596563876f},
-std::array<float,2>{0.768122554f, 0.381001174f},
-std::array<float,2>{0.934566736f, 0.666808903f},
-std::array<float,2>{0.264003277f, 0.349372208f},
-std::array<float,2>{0.0216336437f, 0.87843889f},
-std::array<float,2>{0.742082238f, 0.225078419f},
-std::array<float,2>{0.839117706f, 0.940728545f},
-std::array<float,2>{0.489515036f, 0.139288887f},
-std::array<float,2>{0.165754378f, 0.731998026f},
-std::array<float,2>{0.570403337f, 0.309475988f},
-std::array<float,2>{0.675402999f, 0.545766413f},
-std::array<float,2>{0.0887397751f, 0.452723235f},
-std::array<float,2>{0.329429686f, 0.759229481f},
-std::array<float,2>{0.983933449f, 0.120470323f},
-std::array<float,2>{0.690383077f, 0.926445842f},
-std::array<float,2>{0.036048308f, 0.208782941f},
-std::array<float,2>{0.290467024f, 0.656109154f},
-std::array<float,2>{0.889453351f, 0.32493332f},
-std::array<float,2>{0.782365382f, 0.582128406f},
-std::array<float,2>{0.392081678f, 0.410926729f},
-std::array<float,2>{0.246705279f, 0.817278624f},
-std::array<float,2>{0.506104231f, 0.0281185824f},
-std::array<float,2>{0.938526392f, 0.785630345f},
-std::array<float,2>{0.371856511f, 0.066198267f},
-std::array<float,2>{0.108985558f, 0.515175879f},
-std::array<float,2>{0.648106575f, 0.497828782f},
-std::array<float,2>{0.612855971f, 0.712595165f},
-std::array<float,2>{0.13697955f, 0.280812204f},
-std::array<float,2>{0.448420942f, 0.994369626f},
-std::array<float,2>{0.859379649f, 0.164175719f},
-std::array<float,2>{0.58187294f, 0.976700783f},
-std::array<float,2>{0.186901361f, 0.185882926f},
-std::array<float,2>{0.478151739f, 0.695470333f},
-std::array<float,2>{0.827704787f, 0.262881607f},
-std::array<float,2>{0.998435497f, 0.518140793f},
-std::array<float,2>{0.325897217f, 0.475346416f},
-std::array<float,2>{0.0701525286f, 0.80684942f},
-std::array<float,2>{0.664291918f, 0.0898658186f},
-std::array<float,2>{0.75735563f, 0.836712122f},
-std::array<float,2>{0.434251279f, 0.0122239869f},
-std::array<float,2>{0.200696364f, 0.570254087f},
-std::array<float,2>{0.535361588f, 0.430026293f},
-std::array<float,2>{0.725650072f, 0.630562305f},
-std::array<float,2>{0.0110776033f, 0.330687881f},
-std::array<float,2>{0.275087446f, 0.907822073f},
-std::array<float,2>{0.918584108f, 0.192148432f},
-std::array<float,2>{0.628147125f, 0.774891853f},
-std::array<float,2>{0.122737743f, 0.100642532f},
-std::array<float,2>{0.357087076f, 0.562275231f},
-std::array<float,2>{0.960962713f, 0.454000145f},
-std::array<float,2>{0.843833387f, 0.738941371f},
-std::array<float,2>{0.459934652f, 0.286283255f},
-std::array<float,2>{0.148006454f, 0.960654616f},
-std::array<float,2>{0.595772088f, 0.15011932f},
-std::array<float,2>{0.902668595f, 0.902027905f},
-std::array<float,2>{0.303275466f, 0.249000147f},
-std::array<float,2>{0.0546742715f, 0.683822989f},
-std::array<float,2>{0.712171674f, 0.36029315f},
-std::array<float,2>{0.527143121f, 0.61624974f},
-std::array<float,2>{0.231952876f, 0.392745793f},
-std::array<float,2>{0.383180559f, 0.848361313f},
-std::array<float,2>{0.804744601f, 0.048946362f},
-std::array<float,2>{0.520121634f, 0.763142407f},
-std::array<float,2>{0.220857233f, 0.121398255f},
-std::array<float,2>{0.38156119f, 0.540552735f},
-std::array<float,2>{0.80207628f, 0.448959678f},
-std::array<float,2>{0.89528966f, 0.726818264f},
-std::array<float,2>{0.310359418f, 0.304842412f},
-std::array<float,2>{0.0565199144f, 0.942997038f},
-std::array<float,2>{0.70844084f, 0.13363114f},
-std::array<float,2>{0.855185211f, 0.882671952f},
-std::array<float,2>{0.46319434f, 0.22147122f},
-std::array<float,2>{0.154443815f, 0.670252919f},
-std::array<float,2>{0.604815423f, 0.345789135f},
-std::array<float,2>{0.638008416f, 0.598519385f},
-std::array<float,2>{0.116161115f, 0.37627098f},
-std::array<float,2>{0.349841863f, 0.863100946f},
-std::array<float,2>{0.959979475f, 0.0358707756f},
-std::array<float,2>{0.728091955f, 0.999747753f},
-std::array<float,2>{0.00624793814f, 0.16876103f},
-std::array<float,2>{0.270535409f, 0.715178192f},
-std::array<float,2>{0.9092049f, 0.275452644f},
-std::array<float,2>{0.758743823f, 0.509217203f},
-std::array<float,2>{0.429369956f, 0.496077359f},
-std::array<float,2>{0.193076149f, 0.782737792f},
-std::array<float,2>{0.540838778f, 0.068652533f},
-std::array<float,2>{0.987266839f, 0.814068258f},
-std::array<float,2>{0.317829907f, 0.026802646f},
-std::array<float,2>{0.0730988458f, 0.58100611f},
-std::array<float,2>{0.657603383f, 0.408585459f},
-std::array<float,2>{0.591711342f, 0.648994446f},
-std::array<float,2>{0.17500487f, 0.320788741f},
-std::array<float,2>{0.476215184f, 0.923854947f},
-std::array<float,2>{0.816414475f, 0.206622422f},
-std::array<float,2>{0.620039761f, 0.912457705f},
-std::array<float,2>{0.128055677f, 0.18795535f},
-std::array<float,2>{0.440279067f, 0.62526691f},
-std::array<float,2>{0.872456849f, 0.335396856f},
-std::array<float,2>{0.945345104f, 0.562784612f},
-std::array<float,2>{0.360429943f, 0.437140882f},
-std::array<float,2>{0.096279189f, 0.842514336f},
-std::array<float,2>{0.65320003f, 0.011568292f},
-std::array<float,2>{0.79231137f, 0.812152743f},
-std::array<float,2>{0.401400745f, 0.0896435007f},
-std::array<float,2>{0.237904057f, 0.522995174f},
-std::array<float,2>{0.514054894f, 0.471988171f},
-std::array<float,2>{0.697367072f, 0.701588154f},
-std::array<float,2>{0.039162498f, 0.259437472f},
-std::array<float,2>{0.288359791f, 0.981099725f},
-std::array<float,2>{0.877927005f, 0.180620417f},
-std::array<float,2>{0.681137919f, 0.844427884f},
-std::array<float,2>{0.080553554f, 0.0538993105f},
-std::array<float,2>{0.339646637f, 0.611776054f},
-std::array<float,2>{0.974228978f, 0.398394316f},
-std::array<float,2>{0.831584692f, 0.681402147f},
-std::array<float,2>{0.496734411f, 0.365911484f},
-std::array<float,2>{0.159120008f, 0.904180467f},
-std::array<float,2>{0.567568481f, 0.242933527f},
-std::array<float,2>{0.926234126f, 0.957000732f},
-std::array<float,2>{0.253782213f, 0.15521124f},
-std::array<float,2>{0.0312436409f, 0.735578239f},
-std::array<float,2>{0.745081782f, 0.284076154f},
-std::array<float,2>{0.551227808f, 0.556934118f},
-std::array<float,2>{0.20320414f, 0.459395617f},
-std::array<float,2>{0.414430261f, 0.77764535f},
-std::array<float,2>{0.774091184f, 0.0953769982f},
-std::array<float,2>{0.576674581f, 0.829177916f},
-std::array<float,2>{0.171119645f, 0.00631735288f},
-std::array<float,2>{0.487749457f, 0.572651923f},
-std::array<float,2>{0.840444148f, 0.426752925f},
-std::array<float,2>{0.977833807f, 0.633263707f},
-std::array<float,2>{0.33490774f, 0.34245798f},
-std::array<float,2>{0.0921350867f, 0.917713106f},
-std::array<float,2>{0.679301858f, 0.198406458f},
-std::array<float,2>{0.771472931f, 0.968866408f},
-std::array<float,2>{0.407800019f, 0.175685719f},
-std::array<float,2>{0.211050317f, 0.687509954f},
-std::array<float,2>{0.557008088f, 0.255018115f},
-std::array<float,2>{0.73735702f, 0.524734914f},
-std::array<float,2>{0.0164373424f, 0.477498829f},
-std::array<float,2>{0.261430025f, 0.801512361f},
-std::array<float,2>{0.929885387f, 0.082711339f},
-std::array<float,2>{0.642713308f, 0.892535508f},
-std::array<float,2>{0.103190735f, 0.235268265f},
-std::array<float,2>{0.369333237f, 0.679366529f},
-std::array<float,2>{0.94254142f, 0.367348254f},
-std::array<float,2>{0.867044926f, 0.623866141f},
-std::array<float,2>{0.44937858f, 0.401404262f},
-std::array<float,2>{0.133172274f, 0.857439339f},
-std::array<float,2>{0.615625858f, 0.0574967973f},
-std::array<float,2>{0.885315597f, 0.766727507f},
-std::array<float,2>{0.293534845f, 0.102499746f},
-std::array<float,2>{0.032956291f, 0.547270834f},
-std::array<float,2>{0.69522059f, 0.465224653f},
-std::array<float,2>{0.503300726f, 0.747347534f},
-std::array<float,2>{0.24260968f, 0.29019326f},
-std::array<float,2>{0.395663977f, 0.962261558f},
-std::array<float,2>{0.787335455f, 0.14690575f},
-std::array<float,2>{0.53352958f, 0.948438883f},
-std::array<float,2>{0.199103758f, 0.125239f},
-std::array<float,2>{0.430831581f, 0.721810997f},
-std::array<float,2>{0.750169218f, 0.297269166f},
-std::array<float,2>{0.91560781f, 0.536473453f},
-std::array<float,2>{0.278272092f, 0.443630934f},
-std::array<float,2>{0.014567012f, 0.753094435f},
-std::array<float,2>{0.720791578f, 0.113594837f},
-std::array<float,2>{0.822283566f, 0.867205501f},
-std::array<float,2>{0.482226163f, 0.0404061265f},
-std::array<float,2>{0.180331528f, 0.603629947f},
-std::array<float,2>{0.582325578f, 0.386714637f},
-std::array<float,2>{0.670468032f, 0.663018703f},
-std::array<float,2>{0.0641254261f, 0.352053493f},
-std::array<float,2>{0.322062343f, 0.885149062f},
-std::array<float,2>{0.992569327f, 0.226662397f},
-std::array<float,2>{0.718688488f, 0.791137516f},
-std::array<float,2>{0.0477047823f, 0.0745824277f},
-std::array<float,2>{0.300449282f, 0.500785291f},
-std::array<float,2>{0.902264535f, 0.490082771f},
-std::array<float,2>{0.809905231f, 0.704104304f},
-std::array<float,2>{0.390107363f, 0.272667915f},
-std::array<float,2>{0.22726655f, 0.98684752f},
-std::array<float,2>{0.528854728f, 0.156637624f},
-std::array<float,2>{0.964876652f, 0.933391154f},
-std::array<float,2>{0.35208118f, 0.218555108f},
-std::array<float,2>{0.11861784f, 0.64595753f},
-std::array<float,2>{0.631183326f, 0.313996345f},
-std::array<float,2>{0.600901902f, 0.589738369f},
-std::array<float,2>{0.142474398f, 0.420896143f},
-std::array<float,2>{0.456267357f, 0.82711488f},
-std::array<float,2>{0.84957099f, 0.0201792214f},
-std::array<float,2>{0.588267684f, 0.771102548f},
-std::array<float,2>{0.178238377f, 0.108421735f},
-std::array<float,2>{0.471579343f, 0.552154422f},
-std::array<float,2>{0.814903617f, 0.461706161f},
-std::array<float,2>{0.988366663f, 0.742672145f},
-std::array<float,2>{0.315926045f, 0.295991898f},
-std::array<float,2>{0.0749190375f, 0.966513097f},
-std::array<float,2>{0.66305989f, 0.141584799f},
-std::array<float,2>{0.762022793f, 0.895788193f},
-std::array<float,2>{0.424014926f, 0.241857484f},
-std::array<float,2>{0.191129267f, 0.675437152f},
-std::array<float,2>{0.544955671f, 0.371375382f},
-std::array<float,2>{0.73368609f, 0.617283583f},
-std::array<float,2>{0.00136014703f, 0.404221714f},
-std::array<float,2>{0.266569674f, 0.855463088f},
-std::array<float,2>{0.913853049f, 0.0612244233f},
-std::array<float,2>{0.636299372f, 0.973739445f},
-std::array<float,2>{0.110458337f, 0.177470595f},
-std::array<float,2>{0.345211834f, 0.693846405f},
-std::array<float,2>{0.953237355f, 0.251601368f},
-std::array<float,2>{0.857011199f, 0.527664125f},
-std::array<float,2>{0.466286063f, 0.481090754f},
-std::array<float,2>{0.150414571f, 0.799467325f},
-std::array<float,2>{0.606631637f, 0.079957135f},
-std::array<float,2>{0.891180694f, 0.833151162f},
-std::array<float,2>{0.307332039f, 0.000701057375f},
-std::array<float,2>{0.0615638718f, 0.575407505f},
-std::array<float,2>{0.70642823f, 0.422067702f},
-std::array<float,2>{0.518235326f, 0.638024867f},
-std::array<float,2>{0.226369411f, 0.3387779f},
-std::array<float,2>{0.378332138f, 0.919656336f},
-std::array<float,2>{0.797874868f, 0.202526614f},
-std::array<float,2>{0.549412549f, 0.93671757f},
-std::array<float,2>{0.208391815f, 0.21118331f},
-std::array<float,2>{0.42162782f, 0.64187175f},
-std::array<float,2>{0.778065264f, 0.317705333f},
-std::array<float,2>{0.92209518f, 0.593743682f},
-std::array<float,2>{0.257461309f, 0.414863408f},
-std::array<float,2>{0.0249584336f, 0.821798444f},
-std::array<float,2>{0.74613142f, 0.018518351f},
-std::array<float,2>{0.833740473f, 0.793025672f},
-std::array<float,2>{0.49303928f, 0.0720817223f},
-std::array<float,2>{0.162838787f, 0.505795956f},
-std::array<float,2>{0.562893033f, 0.487140983f},
-std::array<float,2>{0.684716046f, 0.709940314f},
-std::array<float,2>{0.0855870247f, 0.266758233f},
-std::array<float,2>{0.340766937f, 0.990465939f},
-std::array<float,2>{0.970492125f, 0.161464348f},
-std::array<float,2>{0.699813187f, 0.87444526f},
-std::array<float,2>{0.043183051f, 0.0457756594f},
-std::array<float,2>{0.28147763f, 0.605802655f},
-std::array<float,2>{0.882300496f, 0.388011366f},
-std::array<float,2>{0.796170413f, 0.658263624f},
-std::array<float,2>{0.40417397f, 0.358644605f},
-std::array<float,2>{0.239529952f, 0.888153791f},
-std::array<float,2>{0.511173606f, 0.232276559f},
-std::array<float,2>{0.952588677f, 0.952947855f},
-std::array<float,2>{0.36599952f, 0.131759182f},
-std::array<float,2>{0.10131073f, 0.723041892f},
-std::array<float,2>{0.649064124f, 0.303889513f},
-std::array<float,2>{0.624933779f, 0.531665266f},
-std::array<float,2>{0.131964311f, 0.43789804f},
-std::array<float,2>{0.445149571f, 0.756380796f},
-std::array<float,2>{0.867970526f, 0.110966928f},
-std::array<float,2>{0.505293071f, 0.819271266f},
-std::array<float,2>{0.249579191f, 0.0295628924f},
-std::array<float,2>{0.393423319f, 0.584455192f},
-std::array<float,2>{0.783323586f, 0.412823349f},
-std::array<float,2>{0.887611926f, 0.65315038f},
-std::array<float,2>{0.292260677f, 0.326938778f},
-std::array<float,2>{0.0381520391f, 0.928675234f},
-std::array<float,2>{0.688180685f, 0.209409967f},
-std::array<float,2>{0.862504303f, 0.992308259f},
-std::array<float,2>{0.446510106f, 0.167689443f},
-std::array<float,2>{0.13935256f, 0.713546038f},
-std::array<float,2>{0.610253572f, 0.277456552f},
-std::array<float,2>{0.645725369f, 0.511970043f},
-std::array<float,2>{0.106814973f, 0.498793781f},
-std::array<float,2>{0.37324366f, 0.787818134f},
-std::array<float,2>{0.940727234f, 0.062743701f},
-std::array<float,2>{0.738968015f, 0.875551939f},
-std::array<float,2>{0.020904066f, 0.223698482f},
-std::array<float,2>{0.26253581f, 0.664805233f},
-std::array<float,2>{0.936404288f, 0.349762946f},
-std::array<float,2>{0.766568005f, 0.593888819f},
-std::array<float,2>{0.410813659f, 0.380837649f},
-std::array<float,2>{0.218213797f, 0.864881575f},
-std::array<float,2>{0.558773339f, 0.0326861218f},
-std::array<float,2>{0.982342303f, 0.760153651f},
-std::array<float,2>{0.331604511f, 0.118330076f},
-std::array<float,2>{0.0872077271f, 0.544778168f},
-std::array<float,2>{0.673712015f, 0.450231522f},
-std::array<float,2>{0.572354019f, 0.732619941f},
-std::array<float,2>{0.166768998f, 0.31185931f},
-std::array<float,2>{0.490798593f, 0.937879264f},
-std::array<float,2>{0.836553991f, 0.138545915f},
-std::array<float,2>{0.59495461f, 0.957125604f},
-std::array<float,2>{0.146048725f, 0.15133436f},
-std::array<float,2>{0.457378507f, 0.740364194f},
-std::array<float,2>{0.846666873f, 0.287994742f},
-std::array<float,2>{0.964581251f, 0.560187399f},
-std::array<float,2>{0.358823508f, 0.456975847f},
-std::array<float,2>{0.124483697f, 0.775674582f},
-std::array<float,2>{0.626374066f, 0.0987559035f},
-std::array<float,2>{0.807190478f, 0.849701464f},
-std::array<float,2>{0.386386633f, 0.0479464047f},
-std::array<float,2>{0.234105498f, 0.614504635f},
-std::array<float,2>{0.525342703f, 0.391462207f},
-std::array<float,2>{0.714632034f, 0.686183691f},
-std::array<float,2>{0.052213382f, 0.362066627f},
-std::array<float,2>{0.301328003f, 0.899674356f},
-std::array<float,2>{0.905649781f, 0.247442752f},
-std::array<float,2>{0.66628319f, 0.805471361f},
-std::array<float,2>{0.0681495667f, 0.0927179754f},
-std::array<float,2>{0.327909768f, 0.517153025f},
-std::array<float,2>{0.997608066f, 0.473539501f},
-std::array<float,2>{0.825895429f, 0.698908508f},
-std::array<float,2>{0.480053067f, 0.263676852f},
-std::array<float,2>{0.184575498f, 0.979410708f},
-std::array<float,2>{0.578919232f, 0.183763087f},
-std::array<float,2>{0.921647966f, 0.909786582f},
-std::array<float,2>{0.276030809f, 0.194561586f},
-std::array<float,2>{0.00955953728f, 0.631376445f},
-std::array<float,2>{0.723982453f, 0.329723328f},
-std::array<float,2>{0.538150311f, 0.566736162f},
-std::array<float,2>{0.201694667f, 0.43194744f},
-std::array<float,2>{0.435731977f, 0.839330792f},
-std::array<float,2>{0.755423784f, 0.0147567261f},
-std::array<float,2>{0.542762697f, 0.784873903f},
-std::array<float,2>{0.193708837f, 0.0672942176f},
-std::array<float,2>{0.427565932f, 0.509775519f},
-std::array<float,2>{0.760441065f, 0.493934214f},
-std::array<float,2>{0.906317472f, 0.717602789f},
-std::array<float,2>{0.271523893f, 0.273566842f},
-std::array<float,2>{0.00429271162f, 0.997448325f},
-std::array<float,2>{0.728863001f, 0.170427337f},
-std::array<float,2>{0.819316864f, 0.922808349f},
-std::array<float,2>{0.473785907f, 0.204863653f},
-std::array<float,2>{0.172861829f, 0.651544273f},
-std::array<float,2>{0.592057705f, 0.323239446f},
-std::array<float,2>{0.658792734f, 0.578171015f},
-std::array<float,2>{0.0708722994f, 0.406425744f},
-std::array<float,2>{0.319772422f, 0.814631522f},
-std::array<float,2>{0.986028433f, 0.023813257f},
-std::array<float,2>{0.709046125f, 0.944270015f},
-std::array<float,2>{0.0568350293f, 0.134809315f},
-std::array<float,2>{0.311635196f, 0.729723811f},
-std::array<float,2>{0.897640646f, 0.307494462f},
-std::array<float,2>{0.803836524f, 0.541654885f},
-std::array<float,2>{0.380721033f, 0.445752382f},
-std::array<float,2>{0.220627427f, 0.765169084f},
-std::array<float,2>{0.523370266f, 0.123167187f},
-std::array<float,2>{0.958009779f, 0.861041903f},
-std::array<float,2>{0.348352015f, 0.037927594f},
-std::array<float,2>{0.114925131f, 0.601301014f},
-std::array<float,2>{0.640456676f, 0.377684325f},
-std::array<float,2>{0.601669788f, 0.668345869f},
-std::array<float,2>{0.152736872f, 0.344442457f},
-std::array<float,2>{0.461026073f, 0.880225241f},
-std::array<float,2>{0.851887763f, 0.220117301f},
-std::array<float,2>{0.569236457f, 0.906156242f},
-std::array<float,2>{0.156541929f, 0.244525701f},
-std::array<float,2>{0.498450756f, 0.683277547f},
-std::array<float,2>{0.829674363f, 0.363868982f},
-std::array<float,2>{0.974632204f, 0.609992266f},
-std::array<float,2>{0.336311758f, 0.395575643f},
-std::array<float,2>{0.0794502795f, 0.847135723f},
-std::array<float,2>{0.683253706f, 0.0526238009f},
-std::array<float,2>{0.776914537f, 0.780202091f},
-std::array<float,2>{0.417496771f, 0.0969639346f},
-std::array<float,2>{0.206549823f, 0.55584687f},
-std::array<float,2>{0.553434312f, 0.457264841f},
-std::array<float,2>{0.743575573f, 0.738239884f},
-std::array<float,2>{0.0279301628f, 0.282804281f},
-std::array<float,2>{0.251222521f, 0.954689205f},
-std::array<float,2>{0.928741276f, 0.153765276f},
-std::array<float,2>{0.654667079f, 0.841777265f},
-std::array<float,2>{0.0953375772f, 0.00837483536f},
-std::array<float,2>{0.361406654f, 0.566079855f},
-std::array<float,2>{0.948502541f, 0.433651567f},
-std::array<float,2>{0.873307288f, 0.628038645f},
-std::array<float,2>{0.439279735f, 0.333754659f},
-std::array<float,2>{0.12637572f, 0.911940932f},
-std::array<float,2>{0.617191732f, 0.190870494f},
-std::array<float,2>{0.876029551f, 0.983731449f},
-std::array<float,2>{0.286604911f, 0.182569519f},
-std::array<float,2>{0.04254907f, 0.70048368f},
-std::array<float,2>{0.695692658f, 0.260957897f},
-std::array<float,2>{0.512677431f, 0.520786405f},
-std::array<float,2>{0.235950038f, 0.470557153f},
-std::array<float,2>{0.398782134f, 0.809084892f},
-std::array<float,2>{0.78907156f, 0.0864350051f},
-std::array<float,2>{0.615211129f, 0.857415617f},
-std::array<float,2>{0.136555374f, 0.0556783564f},
-std::array<float,2>{0.451197982f, 0.622107506f},
-std::array<float,2>{0.863777339f, 0.400307536f},
-std::array<float,2>{0.943790853f, 0.677482784f},
-std::array<float,2>{0.367331177f, 0.371022582f},
-std::array<float,2>{0.104173258f, 0.893497348f},
-std::array<float,2>{0.640898108f, 0.238218665f},
-std::array<float,2>{0.785763979f, 0.964741826f},
-std::array<float,2>{0.396833748f, 0.146028027f},
-std::array<float,2>{0.245528683f, 0.749179959f},
-std::array<float,2>{0.501433671f, 0.292499542f},
-std::array<float,2>{0.693257749f, 0.549639165f},
-std::array<float,2>{0.034997195f, 0.467996448f},
-std::array<float,2>{0.295897305f, 0.76810497f},
-std::array<float,2>{0.882842124f, 0.104536228f},
-std::array<float,2>{0.676118612f, 0.915577948f},
-std::array<float,2>{0.0913306773f, 0.196650296f},
-std::array<float,2>{0.333364069f, 0.636239529f},
-std::array<float,2>{0.979692757f, 0.340686232f},
-std::array<float,2>{0.843487084f, 0.571931958f},
-std::array<float,2>{0.484434873f, 0.428248882f},
-std::array<float,2>{0.16891402f, 0.831826448f},
-std::array<float,2>{0.575973988f, 0.00471903477f},
-std::array<float,2>{0.933007717f, 0.804340422f},
-std::array<float,2>{0.2597076f, 0.0846996158f},
-std::array<float,2>{0.0190218352f, 0.527333021f},
-std::array<float,2>{0.734637141f, 0.479546934f},
-std::array<float,2>{0.555519998f, 0.690889955f},
-std::array<float,2>{0.213908717f, 0.257723689f},
-std::array<float,2>{0.409646839f, 0.971595705f},
-std::array<float,2>{0.773009717f, 0.172447711f},
-std::array<float,2>{0.531120539f, 0.986158013f},
-std::array<float,2>{0.23039256f, 0.159130126f},
-std::array<float,2>{0.3883138f, 0.705276847f},
-std::array<float,2>{0.812319219f, 0.270174146f},
-std::array<float,2>{0.899500489f, 0.503508925f},
-std::array<float,2>{0.298651397f, 0.49115485f},
-std::array<float,2>{0.0497390702f, 0.790574789f},
-std::array<float,2>{0.716059208f, 0.0763157085f},
-std::array<float,2>{0.849911094f, 0.824812114f},
-std::array<float,2>{0.453798443f, 0.023016613f},
-std::array<float,2>{0.14406164f, 0.587616384f},
-std::array<float,2>{0.598729789f, 0.419024825f},
-std::array<float,2>{0.630312383f, 0.648030162f},
-std::array<float,2>{0.120106563f, 0.315030247f},
-std::array<float,2>{0.353875279f, 0.930969119f},
-std::array<float,2>{0.96709168f, 0.215274751f},
-std::array<float,2>{0.720538557f, 0.751308918f},
-std::array<float,2>{0.0134810321f, 0.116160788f},
-std::array<float,2>{0.280023545f, 0.53765434f},
-std::array<float,2>{0.916500151f, 0.44266656f},
-std::array<float,2>{0.753129125f, 0.718772411f},
-std::array<float,2>{0.432235092f, 0.300216347f},
-std::array<float,2>{0.196338952f, 0.94723767f},
-std::array<float,2>{0.532106161f, 0.127794161f},
-std::array<float,2>{0.994489849f, 0.883570492f},
-std::array<float,2>{0.323759437f, 0.228899077f},
-std::array<float,2>{0.0653302819f, 0.662002623f},
-std::array<float,2>{0.668221235f, 0.353596091f},
-std::array<float,2>{0.584831834f, 0.602475405f},
-std::array<float,2>{0.181950122f, 0.383854866f},
-std::array<float,2>{0.483124018f, 0.869885206f},
-std::array<float,2>{0.821031868f, 0.0428934023f},
-std::array<float,2>{0.574448764f, 0.801642478f},
-std::array<float,2>{0.169622496f, 0.0828618035f},
-std::array<float,2>{0.486196339f, 0.52454257f},
-std::array<float,2>{0.842762351f, 0.477228105f},
-std::array<float,2>{0.979391336f, 0.687808216f},
-std::array<float,2>{0.332993895f, 0.255157501f},
-std::array<float,2>{0.0905199051f, 0.96919018f},
-std::array<float,2>{0.677292705f, 0.175455973f},
-std::array<float,2>{0.771662772f, 0.917896032f},
-std::array<float,2>{0.408584505f, 0.198596686f},
-std::array<float,2>{0.213579819f, 0.632895708f},
-std::array<float,2>{0.556266427f, 0.342681289f},
-std::array<float,2>{0.736268401f, 0.572482884f},
-std::array<float,2>{0.0178125426f, 0.426318854f},
-std::array<float,2>{0.258636028f, 0.829523921f},
-std::array<float,2>{0.931863368f, 0.00595012726f},
-std::array<float,2>{0.64224118f, 0.962077916f},
-std::array<float,2>{0.10459251f, 0.14668262f},
-std::array<float,2>{0.368319064f, 0.747081578f},
-std::array<float,2>{0.944924653f, 0.290432513f},
-std::array<float,2>{0.864269912f, 0.547115803f},
-std::array<float,2>{0.452764273f, 0.464900494f},
-std::array<float,2>{0.135730401f, 0.766971707f},
-std::array<float,2>{0.613762975f, 0.102178693f},
-std::array<float,2>{0.88428694f, 0.857795835f},
-std::array<float,2>{0.296425521f, 0.0572382845f},
-std::array<float,2>{0.0334883668f, 0.623750865f},
-std::array<float,2>{0.691666722f, 0.401700199f},
-std::array<float,2>{0.500265062f, 0.679578185f},
-std::array<float,2>{0.244452134f, 0.367446333f},
-std::array<float,2>{0.398012429f, 0.892182112f},
-std::array<float,2>{0.786850095f, 0.234980136f},
-std::array<float,2>{0.532486081f, 0.884897292f},
-std::array<float,2>{0.195378378f, 0.227000251f},
-std::array<float,2>{0.433253229f, 0.662755549f},
-std::array<float,2>{0.752258956f, 0.352429003f},
-std::array<float,2>{0.917278051f, 0.603948355f},
-std::array<float,2>{0.280917913f, 0.386401772f},
-std::array<float,2>{0.0118523221f, 0.867668331f},
-std::array<float,2>{0.719273806f, 0.0402339958f},
-std::array<float,2>{0.821665227f, 0.753312469f},
-std::array<float,2>{0.484122694f, 0.113426164f},
-std::array<float,2>{0.183503151f, 0.536137819f},
-std::array<float,2>{0.585923374f, 0.443528533f},
-std::array<float,2>{0.669786215f, 0.721951783f},
-std::array<float,2>{0.0658923462f, 0.296987891f},
-std::array<float,2>{0.322808027f, 0.948594511f},
-std::array<float,2>{0.995170414f, 0.125302806f},
-std::array<float,2>{0.715139568f, 0.826783538f},
-std::array<float,2>{0.0499265529f, 0.0204288606f},
-std::array<float,2>{0.297535032f, 0.589472592f},
-std::array<float,2>{0.899184048f, 0.420507908f},
-std::array<float,2>{0.810626924f, 0.645588636f},
-std::array<float,2>{0.387429327f, 0.314224422f},
-std::array<float,2>{0.229351148f, 0.933237374f},
-std::array<float,2>{0.529956698f, 0.218468621f},
-std::array<float,2>{0.968370676f, 0.987270296f},
-std::array<float,2>{0.354981661f, 0.156450987f},
-std::array<float,2>{0.12065763f, 0.704502881f},
-std::array<float,2>{0.629628181f, 0.272923172f},
-std::array<float,2>{0.597699344f, 0.500547528f},
-std::array<float,2>{0.142604873f, 0.489927471f},
-std::array<float,2>{0.454846948f, 0.791491568f},
-std::array<float,2>{0.851425409f, 0.0744185448f},
-std::array<float,2>{0.522334158f, 0.862804413f},
-std::array<float,2>{0.219714522f, 0.036073789f},
-std::array<float,2>{0.379770249f, 0.598382771f},
-std::array<float,2>{0.802838326f, 0.376107097f},
-std::array<float,2>{0.897422671f, 0.669936657f},
-std::array<float,2>{0.311210394f, 0.346045017f},
-std::array<float,2>{0.0584494211f, 0.882549405f},
-std::array<float,2>{0.710583866f, 0.221219003f},
-std::array<float,2>{0.852588594f, 0.943345666f},
-std::array<float,2>{0.462743223f, 0.133428127f},
-std::array<float,2>{0.154205725f, 0.726655185f},
-std::array<float,2>{0.603053033f, 0.30508548f},
-std::array<float,2>{0.639119446f, 0.540891349f},
-std::array<float,2>{0.114094861f, 0.449061245f},
-std::array<float,2>{0.348709315f, 0.762840927f},
-std::array<float,2>{0.957271695f, 0.121210419f},
-std::array<float,2>{0.730235994f, 0.924181223f},
-std::array<float,2>{0.00582486531f, 0.206958726f},
-std::array<float,2>{0.272907525f, 0.649292707f},
-std::array<float,2>{0.907601118f, 0.320410758f},
-std::array<float,2>{0.760890007f, 0.580617011f},
-std::array<float,2>{0.426129729f, 0.408362091f},
-std::array<float,2>{0.194715068f, 0.814236283f},
-std::array<float,2>{0.54166919f, 0.0264304075f},
-std::array<float,2>{0.984900177f, 0.783197522f},
-std::array<float,2>{0.318574816f, 0.0685364231f},
-std::array<float,2>{0.072043851f, 0.508942068f},
-std::array<float,2>{0.659525096f, 0.495631307f},
-std::array<float,2>{0.592946291f, 0.714889824f},
-std::array<float,2>{0.172257513f, 0.275730997f},
-std::array<float,2>{0.472776473f, 0.999824882f},
-std::array<float,2>{0.819795251f, 0.168689758f},
-std::array<float,2>{0.618857563f, 0.981319845f},
-std::array<float,2>{0.125430897f, 0.180294499f},
-std::array<float,2>{0.438149184f, 0.701330543f},
-std::array<float,2>{0.874421477f, 0.259663463f},
-std::array<float,2>{0.947355211f, 0.523274839f},
-std::array<float,2>{0.362463117f, 0.471883744f},
-std::array<float,2>{0.0945321992f, 0.812408447f},
-std::array<float,2>{0.656186342f, 0.0893631727f},
-std::array<float,2>{0.790259182f, 0.842634261f},
-std::array<float,2>{0.399924397f, 0.0113850515f},
-std::array<float,2>{0.234760627f, 0.562594235f},
-std::array<float,2>{0.513598084f, 0.437421113f},
-std::array<float,2>{0.69678545f, 0.625077307f},
-std::array<float,2>{0.0413309932f, 0.335047662f},
-std::array<float,2>{0.28608337f, 0.912193537f},
-std::array<float,2>{0.87523973f, 0.187542051f},
-std::array<float,2>{0.682245672f, 0.777562082f},
-std::array<float,2>{0.0785114244f, 0.0956683382f},
-std::array<float,2>{0.337116212f, 0.556784511f},
-std::array<float,2>{0.976273f, 0.459207177f},
-std::array<float,2>{0.828512967f, 0.735649288f},
-std::array<float,2>{0.499446243f, 0.283826739f},
-std::array<float,2>{0.157445773f, 0.956627131f},
-std::array<float,2>{0.570009649f, 0.154837519f},
-std::array<float,2>{0.92781812f, 0.903990924f},
-std::array<float,2>{0.250326365f, 0.242736772f},
-std::array<float,2>{0.0284667015f, 0.681250513f},
-std::array<float,2>{0.742821991f, 0.366195679f},
-std::array<float,2>{0.554471195f, 0.611472785f},
-std::array<float,2>{0.205683246f, 0.398092836f},
-std::array<float,2>{0.41655761f, 0.844717443f},
-std::array<float,2>{0.775564075f, 0.0540111624f},
-std::array<float,2>{0.560456216f, 0.759009302f},
-std::array<float,2>{0.216968089f, 0.120263264f},
-std::array<float,2>{0.411906689f, 0.545447767f},
-std::array<float,2>{0.766993701f, 0.453087091f},
-std::array<float,2>{0.93694663f, 0.732264936f},
-std::array<float,2>{0.262818128f, 0.30909881f},
-std::array<float,2>{0.0196759049f, 0.940466225f},
-std::array<float,2>{0.739790618f, 0.139468059f},
-std::array<float,2>{0.837664962f, 0.878723681f},
-std::array<float,2>{0.491817176f, 0.224834308f},
-std::array<float,2>{0.167911083f, 0.666716933f},
-std::array<float,2>{0.574144185f, 0.349336028f},
-std::array<float,2>{0.671950817f, 0.596264184f},
-std::array<float,2>{0.0863911659f, 0.381196141f},
-std::array<float,2>{0.330696136f, 0.867177904f},
-std::array<float,2>{0.980502129f, 0.0345983393f},
-std::array<float,2>{0.689410269f, 0.994391143f},
-std::array<float,2>{0.0379902236f, 0.164436743f},
-std::array<float,2>{0.291822314f, 0.712828577f},
-std::array<float,2>{0.888665676f, 0.281180531f},
-std::array<float,2>{0.784986615f, 0.515528858f},
-std::array<float,2>{0.394507229f, 0.497700155f},
-std::array<float,2>{0.248857021f, 0.78538394f},
-std::array<float,2>{0.504130781f, 0.0661448613f},
-std::array<float,2>{0.940269113f, 0.817121565f},
-std::array<float,2>{0.374208748f, 0.0279190689f},
-std::array<float,2>{0.106326975f, 0.582496166f},
-std::array<float,2>{0.64509052f, 0.410703182f},
-std::array<float,2>{0.611042619f, 0.656004786f},
-std::array<float,2>{0.139763787f, 0.325145036f},
-std::array<float,2>{0.445440054f, 0.926679611f},
-std::array<float,2>{0.861527979f, 0.208704412f},
-std::array<float,2>{0.579177201f, 0.908063769f},
-std::array<float,2>{0.184297144f, 0.19208689f},
-std::array<float,2>{0.478790373f, 0.630759895f},
-std::array<float,2>{0.824940264f, 0.331047773f},
-std::array<float,2>{0.99630028f, 0.569993079f},
-std::array<float,2>{0.327103794f, 0.429921776f},
-std::array<float,2>{0.0669322163f, 0.836473107f},
-std::array<float,2>{0.667001665f, 0.0126280282f},
-std::array<float,2>{0.754867256f, 0.807035863f},
-std::array<float,2>{0.437450022f, 0.090133816f},
-std::array<float,2>{0.20243226f, 0.518450618f},
-std::array<float,2>{0.537570715f, 0.47527799f},
-std::array<float,2>{0.723628402f, 0.69559592f},
-std::array<float,2>{0.00797897484f, 0.26313284f},
-std::array<float,2>{0.277151197f, 0.976915538f},
-std::array<float,2>{0.920066357f, 0.18556346f},
-std::array<float,2>{0.625334024f, 0.848568976f},
-std::array<float,2>{0.123198263f, 0.0492428727f},
-std::array<float,2>{0.357880056f, 0.616466522f},
-std::array<float,2>{0.962957084f, 0.392833471f},
-std::array<float,2>{0.84735018f, 0.683867991f},
-std::array<float,2>{0.458821565f, 0.359957248f},
-std::array<float,2>{0.144764006f, 0.902252555f},
-std::array<float,2>{0.594477057f, 0.248676687f},
-std::array<float,2>{0.90501076f, 0.960910678f},
-std::array<float,2>{0.302085459f, 0.150356829f},
-std::array<float,2>{0.0508854575f, 0.739079297f},
-std::array<float,2>{0.713659763f, 0.286409378f},
-std::array<float,2>{0.523915589f, 0.562146246f},
-std::array<float,2>{0.232454449f, 0.453733593f},
-std::array<float,2>{0.385647267f, 0.774445236f},
-std::array<float,2>{0.808258176f, 0.101011619f},
-std::array<float,2>{0.606443465f, 0.835406125f},
-std::array<float,2>{0.152276799f, 0.00234406418f},
-std::array<float,2>{0.465228051f, 0.577156246f},
-std::array<float,2>{0.856140912f, 0.42521742f},
-std::array<float,2>{0.95502001f, 0.64032793f},
-std::array<float,2>{0.344181269f, 0.336960256f},
-std::array<float,2>{0.109535716f, 0.920871913f},
-std::array<float,2>{0.634838223f, 0.201105058f},
-std::array<float,2>{0.797272265f, 0.974716544f},
-std::array<float,2>{0.377707005f, 0.179174274f},
-std::array<float,2>{0.22515884f, 0.692158341f},
-std::array<float,2>{0.518878818f, 0.253098905f},
-std::array<float,2>{0.706017375f, 0.529330492f},
-std::array<float,2>{0.0608445853f, 0.48426953f},
-std::array<float,2>{0.308022499f, 0.797874689f},
-std::array<float,2>{0.892128706f, 0.0803507715f},
-std::array<float,2>{0.663742721f, 0.897213459f},
-std::array<float,2>{0.0753097981f, 0.238651544f},
-std::array<float,2>{0.314558417f, 0.672539711f},
-std::array<float,2>{0.989313126f, 0.374623477f},
-std::array<float,2>{0.815642118f, 0.619704664f},
-std::array<float,2>{0.4722085f, 0.404890716f},
-std::array<float,2>{0.179208353f, 0.853161395f},
-std::array<float,2>{0.589683414f, 0.0594812743f},
-std::array<float,2>{0.912691414f, 0.77157259f},
-std::array<float,2>{0.266679108f, 0.10592404f},
-std::array<float,2>{0.000242203911f, 0.554272473f},
-std::array<float,2>{0.732650101f, 0.463205695f},
-std::array<float,2>{0.546543241f, 0.744961321f},
-std::array<float,2>{0.189562678f, 0.293992639f},
-std::array<float,2>{0.425536722f, 0.968740106f},
-std::array<float,2>{0.762820542f, 0.143160731f},
-std::array<float,2>{0.510393977f, 0.950520813f},
-std::array<float,2>{0.238482922f, 0.130341679f},
-std::array<float,2>{0.402639151f, 0.725299239f},
-std::array<float,2>{0.795885801f, 0.302349299f},
-std::array<float,2>{0.881740928f, 0.534586847f},
-std::array<float,2>{0.283144832f, 0.4395971f},
-std::array<float,2>{0.0445418768f, 0.755392432f},
-std::array<float,2>{0.700352609f, 0.112898223f},
-std::array<float,2>{0.869083643f, 0.872295022f},
-std::array<float,2>{0.443970412f, 0.0445469134f},
-std::array<float,2>{0.131380618f, 0.607803226f},
-std::array<float,2>{0.623678207f, 0.388691753f},
-std::array<float,2>{0.649984777f, 0.65709275f},
-std::array<float,2>{0.0996232033f, 0.356258422f},
-std::array<float,2>{0.36711055f, 0.889902115f},
-std::array<float,2>{0.951439977f, 0.232999593f},
-std::array<float,2>{0.747504473f, 0.795341313f},
-std::array<float,2>{0.0243174303f, 0.0732081831f},
-std::array<float,2>{0.256381094f, 0.506757021f},
-std::array<float,2>{0.922862351f, 0.485164881f},
-std::array<float,2>{0.778834224f, 0.70713371f},
-std::array<float,2>{0.420855761f, 0.2678909f},
-std::array<float,2>{0.207241476f, 0.989001155f},
-std::array<float,2>{0.550649107f, 0.162652627f},
-std::array<float,2>{0.969688118f, 0.934713602f},
-std::array<float,2>{0.34115079f, 0.213722572f},
-std::array<float,2>{0.084743984f, 0.642756164f},
-std::array<float,2>{0.683752716f, 0.318834245f},
-std::array<float,2>{0.563847065f, 0.590102732f},
-std::array<float,2>{0.163425922f, 0.416576952f},
-std::array<float,2>{0.494068086f, 0.822447062f},
-std::array<float,2>{0.832331598f, 0.0170728005f},
-std::array<float,2>{0.616541684f, 0.76839745f},
-std::array<float,2>{0.134713322f, 0.104803495f},
-std::array<float,2>{0.450712711f, 0.54942888f},
-std::array<float,2>{0.865735292f, 0.468235165f},
-std::array<float,2>{0.941842079f, 0.749346137f},
-std::array<float,2>{0.370477915f, 0.292788923f},
-std::array<float,2>{0.102023624f, 0.964550495f},
-std::array<float,2>{0.643963814f, 0.146431088f},
-std::array<float,2>{0.788192332f, 0.893103302f},
-std::array<float,2>{0.394841611f, 0.237984344f},
-std::array<float,2>{0.243891776f, 0.67753458f},
-std::array<float,2>{0.502446234f, 0.370636523f},
-std::array<float,2>{0.693975329f, 0.622511446f},
-std::array<float,2>{0.0316684693f, 0.399969667f},
-std::array<float,2>{0.294209063f, 0.856988072f},
-std::array<float,2>{0.886702001f, 0.0561474375f},
-std::array<float,2>{0.677949905f, 0.971218467f},
-std::array<float,2>{0.0934657529f, 0.172721058f},
-std::array<float,2>{0.335505784f, 0.69045347f},
-std::array<float,2>{0.9765957f, 0.257507116f},
-std::array<float,2>{0.841539264f, 0.527016699f},
-std::array<float,2>{0.486804605f, 0.479966491f},
-std::array<float,2>{0.17075251f, 0.804538786f},
-std::array<float,2>{0.577942133f, 0.0849244818f},
-std::array<float,2>{0.931087375f, 0.831747711f},
-std::array<float,2>{0.26050216f, 0.00462365383f},
-std::array<float,2>{0.0169392824f, 0.572078168f},
-std::array<float,2>{0.737047017f, 0.428633392f},
-std::array<float,2>{0.557639241f, 0.636476159f},
-std::array<float,2>{0.212884352f, 0.340462059f},
-std::array<float,2>{0.406665087f, 0.915775836f},
-std::array<float,2>{0.770403624f, 0.19639717f},
-std::array<float,2>{0.528316379f, 0.930747092f},
-std::array<float,2>{0.227763221f, 0.214882076f},
-std::array<float,2>{0.389585495f, 0.648196876f},
-std::array<float,2>{0.808676958f, 0.31519711f},
-std::array<float,2>{0.900508821f, 0.587701797f},
-std::array<float,2>{0.299493074f, 0.419397444f},
-std::array<float,2>{0.0484931022f, 0.825039625f},
-std::array<float,2>{0.71761173f, 0.023243146f},
-std::array<float,2>{0.848202586f, 0.790921152f},
-std::array<float,2>{0.455135494f, 0.0766201317f},
-std::array<float,2>{0.140940726f, 0.503687441f},
-std::array<float,2>{0.599981844f, 0.490871698f},
-std::array<float,2>{0.632412612f, 0.705502272f},
-std::array<float,2>{0.117562078f, 0.270458192f},
-std::array<float,2>{0.352647245f, 0.985912263f},
-std::array<float,2>{0.966780245f, 0.158709049f},
-std::array<float,2>{0.722387254f, 0.869718015f},
-std::array<float,2>{0.0155884f, 0.0425910354f},
-std::array<float,2>{0.279168159f, 0.602269948f},
-std::array<float,2>{0.914227962f, 0.384171516f},
-std::array<float,2>{0.751515925f, 0.661699474f},
-std::array<float,2>{0.430347353f, 0.353841215f},
-std::array<float,2>{0.197650284f, 0.883430958f},
-std::array<float,2>{0.534753501f, 0.228549734f},
-std::array<float,2>{0.993317068f, 0.947005153f},
-std::array<float,2>{0.320471972f, 0.127590477f},
-std::array<float,2>{0.0628328323f, 0.719054103f},
-std::array<float,2>{0.671818852f, 0.299961329f},
-std::array<float,2>{0.58382839f, 0.537847161f},
-std::array<float,2>{0.181550995f, 0.442473918f},
-std::array<float,2>{0.480600178f, 0.751117229f},
-std::array<float,2>{0.82380724f, 0.11591091f},
-std::array<float,2>{0.539742172f, 0.814852059f},
-std::array<float,2>{0.191416264f, 0.023511529f},
-std::array<float,2>{0.428524137f, 0.578601301f},
-std::array<float,2>{0.759488642f, 0.406664371f},
-std::array<float,2>{0.908702135f, 0.65163976f},
-std::array<float,2>{0.270394981f, 0.322899908f},
-std::array<float,2>{0.00757986121f, 0.922531903f},
-std::array<float,2>{0.727504194f, 0.204828143f},
-std::array<float,2>{0.817812383f, 0.997108161f},
-std::array<float,2>{0.474908412f, 0.170781597f},
-std::array<float,2>{0.173950896f, 0.717397928f},
-std::array<float,2>{0.590043008f, 0.273822963f},
-std::array<float,2>{0.656377673f, 0.510245681f},
-std::array<float,2>{0.0732447803f, 0.493762106f},
-std::array<float,2>{0.31723541f, 0.784944534f},
-std::array<float,2>{0.987326264f, 0.0669080839f},
-std::array<float,2>{0.707600355f, 0.879992783f},
-std::array<float,2>{0.0552501045f, 0.219943792f},
-std::array<float,2>{0.308847696f, 0.668186784f},
-std::array<float,2>{0.895720899f, 0.344671428f},
-std::array<float,2>{0.801521957f, 0.601388454f},
-std::array<float,2>{0.382061601f, 0.37790817f},
-std::array<float,2>{0.222629741f, 0.861251116f},
-std::array<float,2>{0.520908952f, 0.0376263075f},
-std::array<float,2>{0.959797025f, 0.765602529f},
-std::array<float,2>{0.350856096f, 0.123326465f},
-std::array<float,2>{0.116506524f, 0.541945994f},
-std::array<float,2>{0.637393296f, 0.445370167f},
-std::array<float,2>{0.604456961f, 0.729789555f},
-std::array<float,2>{0.155603215f, 0.30730629f},
-std::array<float,2>{0.464660227f, 0.943905592f},
-std::array<float,2>{0.854344845f, 0.135146737f},
-std::array<float,2>{0.566680312f, 0.954892159f},
-std::array<float,2>{0.159450546f, 0.153499514f},
-std::array<float,2>{0.497450531f, 0.737890244f},
-std::array<float,2>{0.830080688f, 0.283049256f},
-std::array<float,2>{0.9729743f, 0.555917084f},
-std::array<float,2>{0.338184685f, 0.457287639f},
-std::array<float,2>{0.0814873353f, 0.780011535f},
-std::array<float,2>{0.679814696f, 0.0968705788f},
-std::array<float,2>{0.775303423f, 0.846752465f},
-std::array<float,2>{0.415046901f, 0.0522572212f},
-std::array<float,2>{0.204194009f, 0.610325694f},
-std::array<float,2>{0.552709758f, 0.395917505f},
-std::array<float,2>{0.745984256f, 0.683560669f},
-std::array<float,2>{0.0293981098f, 0.364243954f},
-std::array<float,2>{0.252056152f, 0.905762315f},
-std::array<float,2>{0.92756182f, 0.24427332f},
-std::array<float,2>{0.653527737f, 0.809563577f},
-std::array<float,2>{0.0967514589f, 0.0866873711f},
-std::array<float,2>{0.359747589f, 0.520602584f},
-std::array<float,2>{0.946574807f, 0.470340222f},
-std::array<float,2>{0.871621072f, 0.700423837f},
-std::array<float,2>{0.440952748f, 0.261121422f},
-std::array<float,2>{0.127659366f, 0.983520329f},
-std::array<float,2>{0.620943367f, 0.182303786f},
-std::array<float,2>{0.878570318f, 0.91162169f},
-std::array<float,2>{0.28775388f, 0.19053708f},
-std::array<float,2>{0.0409049056f, 0.628405392f},
-std::array<float,2>{0.698920012f, 0.33373332f},
-std::array<float,2>{0.514977455f, 0.566182256f},
-std::array<float,2>{0.236978203f, 0.433963269f},
-std::array<float,2>{0.400905371f, 0.841470659f},
-std::array<float,2>{0.791901171f, 0.00873941556f},
-std::array<float,2>{0.507544637f, 0.787873745f},
-std::array<float,2>{0.247306764f, 0.0628849491f},
-std::array<float,2>{0.390967071f, 0.511787355f},
-std::array<float,2>{0.782219231f, 0.4986206f},
-std::array<float,2>{0.89055562f, 0.713778257f},
-std::array<float,2>{0.289128691f, 0.277816504f},
-std::array<float,2>{0.03635839f, 0.992551804f},
-std::array<float,2>{0.69139111f, 0.167897224f},
-std::array<float,2>{0.860831261f, 0.928258121f},
-std::array<float,2>{0.447815031f, 0.20903033f},
-std::array<float,2>{0.137937322f, 0.652983069f},
-std::array<float,2>{0.611422062f, 0.326661974f},
-std::array<float,2>{0.646881461f, 0.583995283f},
-std::array<float,2>{0.10829787f, 0.412858099f},
-std::array<float,2>{0.372686923f, 0.819001615f},
-std::array<float,2>{0.937770486f, 0.0294892062f},
-std::array<float,2>{0.741108298f, 0.937668025f},
-std::array<float,2>{0.0229677875f, 0.138205186f},
-std::array<float,2>{0.265257061f, 0.732710838f},
-std::array<float,2>{0.93505311f, 0.311706454f},
-std::array<float,2>{0.769449055f, 0.544657826f},
-std::array<float,2>{0.414034218f, 0.450683475f},
-std::array<float,2>{0.215405166f, 0.759879351f},
-std::array<float,2>{0.561535835f, 0.118640468f},
-std::array<float,2>{0.983298004f, 0.865215659f},
-std::array<float,2>{0.328803539f, 0.0323538482f},
-std::array<float,2>{0.0895966068f, 0.594034731f},
-std::array<float,2>{0.674059093f, 0.380375803f},
-std::array<float,2>{0.57171917f, 0.664739847f},
-std::array<float,2>{0.164380133f, 0.349909723f},
-std::array<float,2>{0.488585025f, 0.875890911f},
-std::array<float,2>{0.838834703f, 0.223990113f},
-std::array<float,2>{0.596679866f, 0.899656415f},
-std::array<float,2>{0.146556646f, 0.247301534f},
-std::array<float,2>{0.460825652f, 0.686405659f},
-std::array<float,2>{0.845252097f, 0.361905187f},
-std::array<float,2>{0.962026894f, 0.614379883f},
-std::array<float,2>{0.356281251f, 0.39123863f},
-std::array<float,2>{0.121317253f, 0.850016057f},
-std::array<float,2>{0.627146661f, 0.0482892431f},
-std::array<float,2>{0.806259096f, 0.775525331f},
-std::array<float,2>{0.384177834f, 0.0989971533f},
-std::array<float,2>{0.230754763f, 0.560508311f},
-std::array<float,2>{0.526048899f, 0.456592262f},
-std::array<float,2>{0.711184204f, 0.740596354f},
-std::array<float,2>{0.0528455824f, 0.287809551f},
-std::array<float,2>{0.304184735f, 0.957490146f},
-std::array<float,2>{0.90401715f, 0.151040629f},
-std::array<float,2>{0.66590178f, 0.838909745f},
-std::array<float,2>{0.0692430362f, 0.0150664151f},
-std::array<float,2>{0.324725181f, 0.56655097f},
-std::array<float,2>{0.999417245f, 0.431864768f},
-std::array<float,2>{0.826792777f, 0.631745994f},
-std::array<float,2>{0.476938039f, 0.329851925f},
-std::array<float,2>{0.185861334f, 0.910079658f},
-std::array<float,2>{0.581040323f, 0.194740534f},
-std::array<float,2>{0.919053316f, 0.979176223f},
-std::array<float,2>{0.274335235f, 0.183932781f},
-std::array<float,2>{0.00993964076f, 0.699124634f},
-std::array<float,2>{0.724783003f, 0.263933003f},
-std::array<float,2>{0.536229193f, 0.517424345f},
-std::array<float,2>{0.200034484f, 0.47336337f},
-std::array<float,2>{0.435437411f, 0.805295408f},
-std::array<float,2>{0.756635189f, 0.0925226808f},
-std::array<float,2>{0.586750627f, 0.855178237f},
-std::array<float,2>{0.177732423f, 0.0613759868f},
-std::array<float,2>{0.46877262f, 0.617439806f},
-std::array<float,2>{0.813963532f, 0.403832972f},
-std::array<float,2>{0.991759002f, 0.675751626f},
-std::array<float,2>{0.313360333f, 0.371300191f},
-std::array<float,2>{0.0775098428f, 0.895620942f},
-std::array<float,2>{0.660628676f, 0.242026836f},
-std::array<float,2>{0.764662564f, 0.966735601f},
-std::array<float,2>{0.422110558f, 0.141251549f},
-std::array<float,2>{0.188314557f, 0.742402434f},
-std::array<float,2>{0.543575287f, 0.296202391f},
-std::array<float,2>{0.730987608f, 0.551953018f},
-std::array<float,2>{0.00316726184f, 0.461529732f},
-std::array<float,2>{0.268904924f, 0.771363974f},
-std::array<float,2>{0.910249412f, 0.108759791f},
-std::array<float,2>{0.632928073f, 0.919684589f},
-std::array<float,2>{0.111391217f, 0.202213213f},
-std::array<float,2>{0.346869081f, 0.637824953f},
-std::array<float,2>{0.956138432f, 0.338581979f},
-std::array<float,2>{0.857892394f, 0.575640976f},
-std::array<float,2>{0.467991471f, 0.422361165f},
-std::array<float,2>{0.14869076f, 0.833340228f},
-std::array<float,2>{0.60755837f, 0.000971412403f},
-std::array<float,2>{0.894046366f, 0.799803793f},
-std::array<float,2>{0.305373639f, 0.0797039643f},
-std::array<float,2>{0.0593941621f, 0.527553856f},
-std::array<float,2>{0.704576075f, 0.481376499f},
-std::array<float,2>{0.517445743f, 0.693591654f},
-std::array<float,2>{0.222857907f, 0.251807362f},
-std::array<float,2>{0.375365674f, 0.97389096f},
-std::array<float,2>{0.799907684f, 0.177615315f},
-std::array<float,2>{0.548312545f, 0.990655124f},
-std::array<float,2>{0.210872546f, 0.161189765f},
-std::array<float,2>{0.41868937f, 0.709672928f},
-std::array<float,2>{0.779316366f, 0.26685074f},
-std::array<float,2>{0.924347281f, 0.505378425f},
-std::array<float,2>{0.254176915f, 0.48694098f},
-std::array<float,2>{0.0272611175f, 0.793333769f},
-std::array<float,2>{0.749668658f, 0.0718861595f},
-std::array<float,2>{0.83440125f, 0.822219729f},
-std::array<float,2>{0.495165765f, 0.0181036647f},
-std::array<float,2>{0.161215857f, 0.59335351f},
-std::array<float,2>{0.565134704f, 0.414592952f},
-std::array<float,2>{0.687188566f, 0.641693711f},
-std::array<float,2>{0.0835473388f, 0.317445606f},
-std::array<float,2>{0.341817766f, 0.936840773f},
-std::array<float,2>{0.971407533f, 0.210976094f},
-std::array<float,2>{0.702038407f, 0.756672144f},
-std::array<float,2>{0.045956105f, 0.111241981f},
-std::array<float,2>{0.284904629f, 0.531264544f},
-std::array<float,2>{0.879209697f, 0.437595844f},
-std::array<float,2>{0.793353498f, 0.722861171f},
-std::array<float,2>{0.404669255f, 0.304033875f},
-std::array<float,2>{0.241147995f, 0.952854514f},
-std::array<float,2>{0.507885814f, 0.131409138f},
-std::array<float,2>{0.950671375f, 0.887923479f},
-std::array<float,2>{0.364988118f, 0.232010707f},
-std::array<float,2>{0.0994087085f, 0.658556342f},
-std::array<float,2>{0.651192307f, 0.358436942f},
-std::array<float,2>{0.622790992f, 0.605668604f},
-std::array<float,2>{0.129394516f, 0.387926251f},
-std::array<float,2>{0.442038715f, 0.874180198f},
-std::array<float,2>{0.870962083f, 0.0456469022f},
-std::array<float,2>{0.601555169f, 0.792356968f},
-std::array<float,2>{0.142034143f, 0.0756096244f},
-std::array<float,2>{0.456995875f, 0.501275957f},
-std::array<float,2>{0.849071264f, 0.488761485f},
-std::array<float,2>{0.965782344f, 0.703228295f},
-std::array<float,2>{0.35173291f, 0.272247702f},
-std::array<float,2>{0.119136177f, 0.987580359f},
-std::array<float,2>{0.631633103f, 0.157590061f},
-std::array<float,2>{0.810518384f, 0.932543933f},
-std::array<float,2>{0.39029929f, 0.21701324f},
-std::array<float,2>{0.227001131f, 0.645312607f},
-std::array<float,2>{0.528544724f, 0.313248783f},
-std::array<float,2>{0.7180866f, 0.587983251f},
-std::array<float,2>{0.0469708368f, 0.421350807f},
-std::array<float,2>{0.300185293f, 0.827431917f},
-std::array<float,2>{0.901834071f, 0.0206484906f},
-std::array<float,2>{0.670092344f, 0.947885156f},
-std::array<float,2>{0.0637647063f, 0.126681045f},
-std::array<float,2>{0.321368635f, 0.721467197f},
-std::array<float,2>{0.993090272f, 0.297941774f},
-std::array<float,2>{0.822864473f, 0.535627902f},
-std::array<float,2>{0.481517017f, 0.445218414f},
-std::array<float,2>{0.179963768f, 0.752781451f},
-std::array<float,2>{0.582783341f, 0.114789099f},
-std::array<float,2>{0.915297985f, 0.868166625f},
-std::array<float,2>{0.277359486f, 0.0398490094f},
-std::array<float,2>{0.0137649858f, 0.605227232f},
-std::array<float,2>{0.721352577f, 0.385242701f},
-std::array<float,2>{0.533812821f, 0.663702786f},
-std::array<float,2>{0.198247418f, 0.353215158f},
-std::array<float,2>{0.431225002f, 0.886467516f},
-std::array<float,2>{0.750804305f, 0.228110641f},
-std::array<float,2>{0.503639698f, 0.890755713f},
-std::array<float,2>{0.243042991f, 0.235808954f},
-std::array<float,2>{0.396405697f, 0.678422868f},
-std::array<float,2>{0.788043261f, 0.36847803f},
-std::array<float,2>{0.88513267f, 0.62411809f},
-std::array<float,2>{0.293447733f, 0.4013547f},
-std::array<float,2>{0.0322350226f, 0.859338999f},
-std::array<float,2>{0.694345057f, 0.0582837574f},
-std::array<float,2>{0.866219342f, 0.766255975f},
-std::array<float,2>{0.449780315f, 0.103168637f},
-std::array<float,2>{0.133497015f, 0.548290312f},
-std::array<float,2>{0.616148531f, 0.466336548f},
-std::array<float,2>{0.643111587f, 0.747027159f},
-std::array<float,2>{0.102962129f, 0.289766997f},
-std::array<float,2>{0.369893551f, 0.961898446f},
-std::array<float,2>{0.942954004f, 0.147899479f},
-std::array<float,2>{0.738268077f, 0.828311801f},
-std::array<float,2>{0.0156797525f, 0.00743523333f},
-std::array<float,2>{0.260768861f, 0.573295593f},
-std::array<float,2>{0.930260122f, 0.426977366f},
-std::array<float,2>{0.770815372f, 0.634545386f},
-std::array<float,2>{0.407632321f, 0.342897534f},
-std::array<float,2>{0.211602509f, 0.91607362f},
-std::array<float,2>{0.557162523f, 0.197452426f},
-std::array<float,2>{0.978272557f, 0.970205605f},
-std::array<float,2>{0.334112555f, 0.174798101f},
-std::array<float,2>{0.0925310701f, 0.689238548f},
-std::array<float,2>{0.679139972f, 0.254252315f},
-std::array<float,2>{0.576476395f, 0.523564279f},
-std::array<float,2>{0.17139636f, 0.478158981f},
-std::array<float,2>{0.487953693f, 0.802005351f},
-std::array<float,2>{0.839986503f, 0.0830086321f},
-std::array<float,2>{0.551488996f, 0.845234931f},
-std::array<float,2>{0.203785047f, 0.0533540659f},
-std::array<float,2>{0.414610863f, 0.613026083f},
-std::array<float,2>{0.773592532f, 0.396701008f},
-std::array<float,2>{0.926555932f, 0.680247366f},
-std::array<float,2>{0.253250599f, 0.36632964f},
-std::array<float,2>{0.0306939073f, 0.902970195f},
-std::array<float,2>{0.744406879f, 0.244058579f},
-std::array<float,2>{0.831057608f, 0.955981493f},
-std::array<float,2>{0.496419609f, 0.156126559f},
-std::array<float,2>{0.158526152f, 0.734529197f},
-std::array<float,2>{0.567996562f, 0.284265906f},
-std::array<float,2>{0.681206524f, 0.557716429f},
-std::array<float,2>{0.080630444f, 0.460626572f},
-std::array<float,2>{0.338957846f, 0.779090524f},
-std::array<float,2>{0.973822355f, 0.0940891802f},
-std::array<float,2>{0.697869778f, 0.913667619f},
-std::array<float,2>{0.0399593487f, 0.189424485f},
-std::array<float,2>{0.289021999f, 0.626134694f},
-std::array<float,2>{0.877156198f, 0.334737599f},
-std::array<float,2>{0.792872667f, 0.564355791f},
-std::array<float,2>{0.402303398f, 0.436074823f},
-std::array<float,2>{0.237417698f, 0.843673825f},
-std::array<float,2>{0.514306307f, 0.0105788866f},
-std::array<float,2>{0.946273625f, 0.810604513f},
-std::array<float,2>{0.360935152f, 0.0886355117f},
-std::array<float,2>{0.0957584381f, 0.521668255f},
-std::array<float,2>{0.652811944f, 0.471649885f},
-std::array<float,2>{0.619392455f, 0.702527285f},
-std::array<float,2>{0.128796682f, 0.258620948f},
-std::array<float,2>{0.439658195f, 0.981734812f},
-std::array<float,2>{0.87260139f, 0.181480572f},
-std::array<float,2>{0.591273069f, 0.998493075f},
-std::array<float,2>{0.175464615f, 0.16903092f},
-std::array<float,2>{0.475919992f, 0.715898812f},
-std::array<float,2>{0.816984892f, 0.276967347f},
-std::array<float,2>{0.986712754f, 0.508574307f},
-std::array<float,2>{0.318304926f, 0.495068908f},
-std::array<float,2>{0.0725251064f, 0.781785727f},
-std::array<float,2>{0.658030152f, 0.0693498179f},
-std::array<float,2>{0.757875621f, 0.813316047f},
-std::array<float,2>{0.428901196f, 0.0262992848f},
-std::array<float,2>{0.192686424f, 0.581151962f},
-std::array<float,2>{0.540404737f, 0.409335464f},
-std::array<float,2>{0.727655828f, 0.650270581f},
-std::array<float,2>{0.00669564866f, 0.322074175f},
-std::array<float,2>{0.271351635f, 0.925711572f},
-std::array<float,2>{0.909775198f, 0.205498114f},
-std::array<float,2>{0.638535738f, 0.762109458f},
-std::array<float,2>{0.115434639f, 0.122843072f},
-std::array<float,2>{0.350329608f, 0.539292395f},
-std::array<float,2>{0.960774302f, 0.448058486f},
-std::array<float,2>{0.854808271f, 0.72841686f},
-std::array<float,2>{0.46386531f, 0.306480348f},
-std::array<float,2>{0.155064285f, 0.942362547f},
-std::array<float,2>{0.605132222f, 0.134511188f},
-std::array<float,2>{0.894981503f, 0.881292403f},
-std::array<float,2>{0.309857517f, 0.222478405f},
-std::array<float,2>{0.0557474904f, 0.670961142f},
-std::array<float,2>{0.708497107f, 0.346896619f},
-std::array<float,2>{0.519949496f, 0.599137425f},
-std::array<float,2>{0.221427202f, 0.375925541f},
-std::array<float,2>{0.380929232f, 0.862066329f},
-std::array<float,2>{0.802316308f, 0.036540851f},
-std::array<float,2>{0.526386499f, 0.773715913f},
-std::array<float,2>{0.231715366f, 0.100062244f},
-std::array<float,2>{0.383689791f, 0.56063956f},
-std::array<float,2>{0.805263817f, 0.454376519f},
-std::array<float,2>{0.902996182f, 0.739984989f},
-std::array<float,2>{0.302903861f, 0.285539538f},
-std::array<float,2>{0.0537485853f, 0.95940727f},
-std::array<float,2>{0.712870777f, 0.149184108f},
-std::array<float,2>{0.84449476f, 0.900655448f},
-std::array<float,2>{0.459409654f, 0.249442697f},
-std::array<float,2>{0.147886008f, 0.684766591f},
-std::array<float,2>{0.596272111f, 0.360695511f},
-std::array<float,2>{0.628795445f, 0.615845501f},
-std::array<float,2>{0.122204319f, 0.393614113f},
-std::array<float,2>{0.35683164f, 0.849051535f},
-std::array<float,2>{0.961488426f, 0.050314866f},
-std::array<float,2>{0.726119518f, 0.977690339f},
-std::array<float,2>{0.0113046207f, 0.187416583f},
-std::array<float,2>{0.274664164f, 0.697221518f},
-std::array<float,2>{0.918049932f, 0.261744052f},
-std::array<float,2>{0.757094741f, 0.519020975f},
-std::array<float,2>{0.433820456f, 0.47559908f},
-std::array<float,2>{0.200261056f, 0.808502674f},
-std::array<float,2>{0.535946369f, 0.0916466638f},
-std::array<float,2>{0.998847961f, 0.836971164f},
-std::array<float,2>{0.325424701f, 0.01288532f},
-std::array<float,2>{0.0695183426f, 0.56923157f},
-std::array<float,2>{0.664825201f, 0.431206107f},
-std::array<float,2>{0.581203818f, 0.629633665f},
-std::array<float,2>{0.187190607f, 0.331138909f},
-std::array<float,2>{0.477666825f, 0.906438112f},
-std::array<float,2>{0.827232599f, 0.193342432f},
-std::array<float,2>{0.612603426f, 0.927371204f},
-std::array<float,2>{0.137582406f, 0.207124487f},
-std::array<float,2>{0.448732525f, 0.65490061f},
-std::array<float,2>{0.859929502f, 0.325344861f},
-std::array<float,2>{0.939138412f, 0.583428979f},
-std::array<float,2>{0.371241778f, 0.412047386f},
-std::array<float,2>{0.108642973f, 0.817830384f},
-std::array<float,2>{0.647512972f, 0.0291968491f},
-std::array<float,2>{0.783100009f, 0.786401153f},
-std::array<float,2>{0.392136127f, 0.0649272278f},
-std::array<float,2>{0.246363014f, 0.513746619f},
-std::array<float,2>{0.506364226f, 0.496757984f},
-std::array<float,2>{0.689585149f, 0.711312532f},
-std::array<float,2>{0.0353692733f, 0.279658228f},
-std::array<float,2>{0.290866137f, 0.995652258f},
-std::array<float,2>{0.888791382f, 0.1652174f},
-std::array<float,2>{0.675210536f, 0.866110265f},
-std::array<float,2>{0.0880815983f, 0.0335129835f},
-std::array<float,2>{0.329743832f, 0.596696854f},
-std::array<float,2>{0.983466268f, 0.382196337f},
-std::array<float,2>{0.839557052f, 0.667895436f},
-std::array<float,2>{0.490160972f, 0.347834438f},
-std::array<float,2>{0.165109128f, 0.876990914f},
-std::array<float,2>{0.570932388f, 0.225683481f},
-std::array<float,2>{0.933725655f, 0.939984441f},
-std::array<float,2>{0.264625311f, 0.139791384f},
-std::array<float,2>{0.0220761281f, 0.730740309f},
-std::array<float,2>{0.74124825f, 0.310465813f},
-std::array<float,2>{0.56081593f, 0.546793938f},
-std::array<float,2>{0.21628134f, 0.452099353f},
-std::array<float,2>{0.41275382f, 0.758524656f},
-std::array<float,2>{0.767870307f, 0.119591482f},
-std::array<float,2>{0.566097081f, 0.82343781f},
-std::array<float,2>{0.160659075f, 0.0165796205f},
-std::array<float,2>{0.494685411f, 0.591334164f},
-std::array<float,2>{0.835910559f, 0.417110354f},
-std::array<float,2>{0.972318411f, 0.643967807f},
-std::array<float,2>{0.343654126f, 0.319765747f},
-std::array<float,2>{0.0828521401f, 0.934531808f},
-std::array<float,2>{0.685870349f, 0.21401161f},
-std::array<float,2>{0.780862868f, 0.989486277f},
-std::array<float,2>{0.419616759f, 0.163779914f},
-std::array<float,2>{0.209920526f, 0.708201647f},
-std::array<float,2>{0.547403216f, 0.268918872f},
-std::array<float,2>{0.748694301f, 0.507002354f},
-std::array<float,2>{0.0255233552f, 0.486081004f},
-std::array<float,2>{0.255607903f, 0.796451807f},
-std::array<float,2>{0.925706744f, 0.0733390227f},
-std::array<float,2>{0.652343452f, 0.88868916f},
-std::array<float,2>{0.0983617753f, 0.233606264f},
-std::array<float,2>{0.363641143f, 0.657671452f},
-std::array<float,2>{0.949812591f, 0.35725677f},
-std::array<float,2>{0.869921625f, 0.609081388f},
-std::array<float,2>{0.443239629f, 0.389843136f},
-std::array<float,2>{0.130361661f, 0.871352613f},
-std::array<float,2>{0.621419609f, 0.0429969616f},
-std::array<float,2>{0.8803913f, 0.754423022f},
-std::array<float,2>{0.283942163f, 0.111523986f},
-std::array<float,2>{0.0449423902f, 0.533908248f},
-std::array<float,2>{0.702895045f, 0.440732062f},
-std::array<float,2>{0.508963168f, 0.726088822f},
-std::array<float,2>{0.241265848f, 0.301294416f},
-std::array<float,2>{0.406055272f, 0.949489713f},
-std::array<float,2>{0.794525027f, 0.12957947f},
-std::array<float,2>{0.544692099f, 0.967692018f},
-std::array<float,2>{0.188791633f, 0.144510657f},
-std::array<float,2>{0.423621446f, 0.745145202f},
-std::array<float,2>{0.763856053f, 0.293380708f},
-std::array<float,2>{0.911800742f, 0.553049505f},
-std::array<float,2>{0.267608792f, 0.46413213f},
-std::array<float,2>{0.00286541251f, 0.772677541f},
-std::array<float,2>{0.731611431f, 0.106764078f},
-std::array<float,2>{0.812997818f, 0.852296352f},
-std::array<float,2>{0.470254838f, 0.060213808f},
-std::array<float,2>{0.176405996f, 0.62035352f},
-std::array<float,2>{0.58733809f, 0.405721337f},
-std::array<float,2>{0.662056386f, 0.67335391f},
-std::array<float,2>{0.0767964497f, 0.373780042f},
-std::array<float,2>{0.31402576f, 0.898380697f},
-std::array<float,2>{0.990280747f, 0.239879176f},
-std::array<float,2>{0.703220844f, 0.797384322f},
-std::array<float,2>{0.0605461523f, 0.0810715035f},
-std::array<float,2>{0.30605638f, 0.530414164f},
-std::array<float,2>{0.892995059f, 0.483091623f},
-std::array<float,2>{0.799319565f, 0.692821324f},
-std::array<float,2>{0.376576036f, 0.252898335f},
-std::array<float,2>{0.223706067f, 0.976353288f},
-std::array<float,2>{0.515774012f, 0.178130195f},
-std::array<float,2>{0.955441594f, 0.921402097f},
-std::array<float,2>{0.346144974f, 0.199909389f},
-std::array<float,2>{0.113216206f, 0.63873893f},
-std::array<float,2>{0.634503901f, 0.336062312f},
-std::array<float,2>{0.608785868f, 0.576972067f},
-std::array<float,2>{0.149829835f, 0.424610823f},
-std::array<float,2>{0.46760425f, 0.834448695f},
-std::array<float,2>{0.858817399f, 0.00381131331f},
-std::array<float,2>{0.584204435f, 0.750179887f},
-std::array<float,2>{0.18255049f, 0.116361238f},
-std::array<float,2>{0.482891053f, 0.538845122f},
-std::array<float,2>{0.820455074f, 0.442263305f},
-std::array<float,2>{0.995017588f, 0.719743252f},
-std::array<float,2>{0.323390305f, 0.299502224f},
-std::array<float,2>{0.06456393f, 0.946133375f},
-std::array<float,2>{0.668772399f, 0.128384084f},
-std::array<float,2>{0.753774524f, 0.884471476f},
-std::array<float,2>{0.431834489f, 0.230015337f},
-std::array<float,2>{0.197115883f, 0.660622835f},
-std::array<float,2>{0.531707406f, 0.355455339f},
-std::array<float,2>{0.720116258f, 0.603321791f},
-std::array<float,2>{0.0127681317f, 0.383258522f},
-std::array<float,2>{0.279319882f, 0.871088207f},
-std::array<float,2>{0.916579664f, 0.0418203324f},
-std::array<float,2>{0.630642474f, 0.985101581f},
-std::array<float,2>{0.119407006f, 0.159939826f},
-std::array<float,2>{0.354331076f, 0.707008839f},
-std::array<float,2>{0.967396438f, 0.270996422f},
-std::array<float,2>{0.85055238f, 0.502820373f},
-std::array<float,2>{0.453326613f, 0.491721839f},
-std::array<float,2>{0.143632844f, 0.789575458f},
-std::array<float,2>{0.599437833f, 0.0772270411f},
-std::array<float,2>{0.900374115f, 0.825440943f},
-std::array<float,2>{0.29791531f, 0.0223871619f},
-std::array<float,2>{0.0492496267f, 0.586780548f},
-std::array<float,2>{0.716727197f, 0.418316841f},
-std::array<float,2>{0.530310333f, 0.647287309f},
-std::array<float,2>{0.229730621f, 0.315525532f},
-std::array<float,2>{0.387695402f, 0.930026889f},
-std::array<float,2>{0.811806858f, 0.216109931f},
-std::array<float,2>{0.555118918f, 0.914363563f},
-std::array<float,2>{0.214651302f, 0.195938289f},
-std::array<float,2>{0.409813046f, 0.635294974f},
-std::array<float,2>{0.772526979f, 0.340945423f},
-std::array<float,2>{0.933158696f, 0.571089149f},
-std::array<float,2>{0.258802205f, 0.429582864f},
-std::array<float,2>{0.019205926f, 0.831006825f},
-std::array<float,2>{0.735086024f, 0.00553616229f},
-std::array<float,2>{0.843057275f, 0.803687572f},
-std::array<float,2>{0.484865993f, 0.0855264664f},
-std::array<float,2>{0.167984039f, 0.525676668f},
-std::array<float,2>{0.575408638f, 0.479130626f},
-std::array<float,2>{0.676496565f, 0.689893186f},
-std::array<float,2>{0.0910896212f, 0.256382823f},
-std::array<float,2>{0.33367005f, 0.97192508f},
-std::array<float,2>{0.98038131f, 0.17371121f},
-std::array<float,2>{0.692383409f, 0.856380999f},
-std::array<float,2>{0.0342828073f, 0.054986719f},
-std::array<float,2>{0.295005322f, 0.621116638f},
-std::array<float,2>{0.88350302f, 0.398583263f},
-std::array<float,2>{0.78519094f, 0.676429689f},
-std::array<float,2>{0.39730221f, 0.369589001f},
-std::array<float,2>{0.245907694f, 0.894483626f},
-std::array<float,2>{0.501477718f, 0.237214193f},
-std::array<float,2>{0.944109559f, 0.963142991f},
-std::array<float,2>{0.368070573f, 0.14456217f},
-std::array<float,2>{0.103672594f, 0.748532176f},
-std::array<float,2>{0.64156723f, 0.291159749f},
-std::array<float,2>{0.614524603f, 0.549969375f},
-std::array<float,2>{0.135792419f, 0.467016786f},
-std::array<float,2>{0.451982081f, 0.768954158f},
-std::array<float,2>{0.863439381f, 0.103532806f},
-std::array<float,2>{0.51215142f, 0.840803921f},
-std::array<float,2>{0.235373244f, 0.00935177784f},
-std::array<float,2>{0.39941141f, 0.565142393f},
-std::array<float,2>{0.789909899f, 0.434641302f},
-std::array<float,2>{0.876871049f, 0.627313018f},
-std::array<float,2>{0.287073553f, 0.33258906f},
-std::array<float,2>{0.0423302464f, 0.910193145f},
-std::array<float,2>{0.696200669f, 0.190174207f},
-std::array<float,2>{0.873842478f, 0.982728362f},
-std::array<float,2>{0.438617051f, 0.182993814f},
-std::array<float,2>{0.126882136f, 0.699962795f},
-std::array<float,2>{0.617943525f, 0.260379851f},
-std::array<float,2>{0.654913843f, 0.520145297f},
-std::array<float,2>{0.0950558558f, 0.469063073f},
-std::array<float,2>{0.362282068f, 0.81039685f},
-std::array<float,2>{0.949124455f, 0.0873614103f},
-std::array<float,2>{0.743925095f, 0.904845595f},
-std::array<float,2>{0.0276626367f, 0.245942518f},
-std::array<float,2>{0.251875728f, 0.682151377f},
-std::array<float,2>{0.929422975f, 0.364707291f},
-std::array<float,2>{0.776652694f, 0.611300528f},
-std::array<float,2>{0.417266816f, 0.394588381f},
-std::array<float,2>{0.206128255f, 0.846641779f},
-std::array<float,2>{0.552891374f, 0.0509237945f},
-std::array<float,2>{0.975211143f, 0.780278802f},
-std::array<float,2>{0.336720556f, 0.0963725299f},
-std::array<float,2>{0.0796834677f, 0.55505985f},
-std::array<float,2>{0.682733238f, 0.458177686f},
-std::array<float,2>{0.568843246f, 0.737080514f},
-std::array<float,2>{0.157118663f, 0.281512439f},
-std::array<float,2>{0.498743147f, 0.953798056f},
-std::array<float,2>{0.829238653f, 0.15286094f},
-std::array<float,2>{0.60243845f, 0.944868386f},
-std::array<float,2>{0.152959004f, 0.136328146f},
-std::array<float,2>{0.461484313f, 0.729346931f},
-std::array<float,2>{0.852333665f, 0.307811767f},
-std::array<float,2>{0.958831251f, 0.542500913f},
-std::array<float,2>{0.348137319f, 0.446421295f},
-std::array<float,2>{0.114667915f, 0.764443338f},
-std::array<float,2>{0.639778078f, 0.124055982f},
-std::array<float,2>{0.804652333f, 0.86027056f},
-std::array<float,2>{0.380322754f, 0.0389902219f},
-std::array<float,2>{0.219831586f, 0.600197971f},
-std::array<float,2>{0.522832394f, 0.378669769f},
-std::array<float,2>{0.709702134f, 0.669578493f},
-std::array<float,2>{0.0575604811f, 0.345529556f},
-std::array<float,2>{0.312275827f, 0.879162312f},
-std::array<float,2>{0.898435831f, 0.219274968f},
-std::array<float,2>{0.658250511f, 0.783951759f},
-std::array<float,2>{0.0703386888f, 0.0675205737f},
-std::array<float,2>{0.320039719f, 0.511505783f},
-std::array<float,2>{0.985597134f, 0.492485434f},
-std::array<float,2>{0.818366408f, 0.718621016f},
-std::array<float,2>{0.474174351f, 0.274722755f},
-std::array<float,2>{0.17377764f, 0.996855855f},
-std::array<float,2>{0.592295647f, 0.171192437f},
-std::array<float,2>{0.906815767f, 0.923626065f},
-std::array<float,2>{0.272339225f, 0.203274563f},
-std::array<float,2>{0.00476919767f, 0.651028514f},
-std::array<float,2>{0.729009748f, 0.324045539f},
-std::array<float,2>{0.542199671f, 0.579516768f},
-std::array<float,2>{0.194060639f, 0.407823145f},
-std::array<float,2>{0.4270868f, 0.816110492f},
-std::array<float,2>{0.759833157f, 0.0250773355f},
-std::array<float,2>{0.538668334f, 0.806171536f},
-std::array<float,2>{0.201550767f, 0.093262434f},
-std::array<float,2>{0.436056882f, 0.51658231f},
-std::array<float,2>{0.75516057f, 0.474394262f},
-std::array<float,2>{0.921282887f, 0.697366476f},
-std::array<float,2>{0.275603831f, 0.265473664f},
-std::array<float,2>{0.00889329053f, 0.979685009f},
-std::array<float,2>{0.724563301f, 0.185289025f},
-std::array<float,2>{0.825248241f, 0.9090904f},
-std::array<float,2>{0.479779691f, 0.193762541f},
-std::array<float,2>{0.185199395f, 0.632686675f},
-std::array<float,2>{0.578608036f, 0.328544736f},
-std::array<float,2>{0.666627645f, 0.567419112f},
-std::array<float,2>{0.0677245408f, 0.432944477f},
-std::array<float,2>{0.327332616f, 0.838352084f},
-std::array<float,2>{0.997138619f, 0.0136787146f},
-std::array<float,2>{0.714119434f, 0.958630085f},
-std::array<float,2>{0.0526779592f, 0.151422888f},
-std::array<float,2>{0.300919086f, 0.741401315f},
-std::array<float,2>{0.906053483f, 0.288999498f},
-std::array<float,2>{0.806749582f, 0.559280992f},
-std::array<float,2>{0.385815054f, 0.455968469f},
-std::array<float,2>{0.233660653f, 0.776834726f},
-std::array<float,2>{0.52478528f, 0.0985085294f},
-std::array<float,2>{0.963946462f, 0.851378202f},
-std::array<float,2>{0.359062791f, 0.0470954962f},
-std::array<float,2>{0.124582276f, 0.613934219f},
-std::array<float,2>{0.626866221f, 0.391801506f},
-std::array<float,2>{0.595515847f, 0.687151313f},
-std::array<float,2>{0.145684063f, 0.362546235f},
-std::array<float,2>{0.457528412f, 0.898573101f},
-std::array<float,2>{0.845896065f, 0.246429667f},
-std::array<float,2>{0.572914302f, 0.876328528f},
-std::array<float,2>{0.166245371f, 0.222955778f},
-std::array<float,2>{0.490595102f, 0.665100515f},
-std::array<float,2>{0.835990012f, 0.351229817f},
-std::array<float,2>{0.981590509f, 0.595197201f},
-std::array<float,2>{0.331535459f, 0.37912336f},
-std::array<float,2>{0.0874765888f, 0.863586485f},
-std::array<float,2>{0.673181117f, 0.0313765667f},
-std::array<float,2>{0.766111612f, 0.761552274f},
-std::array<float,2>{0.410164654f, 0.117421553f},
-std::array<float,2>{0.218689665f, 0.543382585f},
-std::array<float,2>{0.559251428f, 0.449336976f},
-std::array<float,2>{0.738373339f, 0.734131396f},
-std::array<float,2>{0.0211630221f, 0.311509877f},
-std::array<float,2>{0.261885554f, 0.938496947f},
-std::array<float,2>{0.935568154f, 0.137385875f},
-std::array<float,2>{0.646472752f, 0.819783688f},
-std::array<float,2>{0.107380748f, 0.0307231396f},
-std::array<float,2>{0.373645365f, 0.585158467f},
-std::array<float,2>{0.940935791f, 0.413220793f},
-std::array<float,2>{0.863116503f, 0.65369451f},
-std::array<float,2>{0.4470478f, 0.327413142f},
-std::array<float,2>{0.139101446f, 0.928738534f},
-std::array<float,2>{0.609747171f, 0.210272327f},
-std::array<float,2>{0.886994362f, 0.993420243f},
-std::array<float,2>{0.2929205f, 0.166745931f},
-std::array<float,2>{0.0389466211f, 0.714094102f},
-std::array<float,2>{0.687714696f, 0.278452188f},
-std::array<float,2>{0.505466521f, 0.512867272f},
-std::array<float,2>{0.249251857f, 0.499795824f},
-std::array<float,2>{0.393057823f, 0.788609087f},
-std::array<float,2>{0.783828497f, 0.063946709f},
-std::array<float,2>{0.624430716f, 0.873781383f},
-std::array<float,2>{0.132779494f, 0.0460626148f},
-std::array<float,2>{0.444589257f, 0.60648942f},
-std::array<float,2>{0.867297471f, 0.387077332f},
-std::array<float,2>{0.95279038f, 0.660052478f},
-std::array<float,2>{0.365458816f, 0.358051658f},
-std::array<float,2>{0.100635178f, 0.886938691f},
-std::array<float,2>{0.648781836f, 0.231148943f},
-std::array<float,2>{0.796471179f, 0.951616466f},
-std::array<float,2>{0.403386265f, 0.132026613f},
-std::array<float,2>{0.240151048f, 0.724155486f},
-std::array<float,2>{0.511687458f, 0.303218096f},
-std::array<float,2>{0.699660063f, 0.533033133f},
-std::array<float,2>{0.0438686088f, 0.438855469f},
-std::array<float,2>{0.281931311f, 0.756866395f},
-std::array<float,2>{0.88278228f, 0.109706037f},
-std::array<float,2>{0.685458243f, 0.935574591f},
-std::array<float,2>{0.0851357505f, 0.212519094f},
-std::array<float,2>{0.339961737f, 0.641085565f},
-std::array<float,2>{0.970004797f, 0.316507787f},
-std::array<float,2>{0.833243847f, 0.592587888f},
-std::array<float,2>{0.492280543f, 0.415672779f},
-std::array<float,2>{0.162135467f, 0.820690691f},
-std::array<float,2>{0.56316644f, 0.0190024916f},
-std::array<float,2>{0.922424436f, 0.794312358f},
-std::array<float,2>{0.257026315f, 0.07049907f},
-std::array<float,2>{0.0248824563f, 0.504522562f},
-std::array<float,2>{0.746639371f, 0.488119543f},
-std::array<float,2>{0.549141347f, 0.710353792f},
-std::array<float,2>{0.208658695f, 0.266384304f},
-std::array<float,2>{0.421226263f, 0.992044628f},
-std::array<float,2>{0.777432561f, 0.160586119f},
-std::array<float,2>{0.518043876f, 0.972934306f},
-std::array<float,2>{0.225612685f, 0.176668853f},
-std::array<float,2>{0.378786206f, 0.694874704f},
-std::array<float,2>{0.798407674f, 0.250289351f},
-std::array<float,2>{0.890719056f, 0.528688014f},
-std::array<float,2>{0.306871593f, 0.482088417f},
-std::array<float,2>{0.0624218173f, 0.800207317f},
-std::array<float,2>{0.706602335f, 0.07831797f},
-std::array<float,2>{0.856681347f, 0.832046509f},
-std::array<float,2>{0.466725171f, 0.00104126194f},
-std::array<float,2>{0.151278198f, 0.574532509f},
-std::array<float,2>{0.607311249f, 0.423792869f},
-std::array<float,2>{0.636172473f, 0.637061298f},
-std::array<float,2>{0.111297555f, 0.339785814f},
-std::array<float,2>{0.345687896f, 0.91853869f},
-std::array<float,2>{0.95404923f, 0.201925755f},
-std::array<float,2>{0.733916879f, 0.770358324f},
-std::array<float,2>{0.00179079175f, 0.108368024f},
-std::array<float,2>{0.266035199f, 0.550983667f},
-std::array<float,2>{0.913501203f, 0.462706625f},
-std::array<float,2>{0.762292325f, 0.743179739f},
-std::array<float,2>{0.42450282f, 0.295654684f},
-std::array<float,2>{0.190506965f, 0.965050101f},
-std::array<float,2>{0.545638502f, 0.141960278f},
-std::array<float,2>{0.988797903f, 0.89517808f},
-std::array<float,2>{0.315867662f, 0.24050577f},
-std::array<float,2>{0.0747022033f, 0.674463451f},
-std::array<float,2>{0.662491858f, 0.373023421f},
-std::array<float,2>{0.588569164f, 0.618902624f},
-std::array<float,2>{0.177884176f, 0.402666688f},
-std::array<float,2>{0.471091837f, 0.853598654f},
-std::array<float,2>{0.815422833f, 0.0619955771f},
-std::array<float,2>{0.591810703f, 0.781345844f},
-std::array<float,2>{0.17319946f, 0.0702654943f},
-std::array<float,2>{0.474041492f, 0.508235753f},
-std::array<float,2>{0.818978906f, 0.494521976f},
-std::array<float,2>{0.986277223f, 0.71655941f},
-std::array<float,2>{0.319467485f, 0.276496857f},
-std::array<float,2>{0.0711462572f, 0.998914301f},
-std::array<float,2>{0.658943713f, 0.169537172f},
-std::array<float,2>{0.760739148f, 0.924878359f},
-std::array<float,2>{0.427445143f, 0.205746695f},
-std::array<float,2>{0.193470791f, 0.649812996f},
-std::array<float,2>{0.542585254f, 0.321749061f},
-std::array<float,2>{0.728591919f, 0.581920087f},
-std::array<float,2>{0.00408862345f, 0.410058677f},
-std::array<float,2>{0.271900266f, 0.812533438f},
-std::array<float,2>{0.906686187f, 0.0254503917f},
-std::array<float,2>{0.640165329f, 0.941614389f},
-std::array<float,2>{0.115109906f, 0.133962348f},
-std::array<float,2>{0.348590076f, 0.727543294f},
-std::array<float,2>{0.958439946f, 0.305690467f},
-std::array<float,2>{0.851794779f, 0.539653063f},
-std::array<float,2>{0.461345911f, 0.447525531f},
-std::array<float,2>{0.152391106f, 0.762499452f},
-std::array<float,2>{0.601849616f, 0.122268289f},
-std::array<float,2>{0.89793247f, 0.86170131f},
-std::array<float,2>{0.311807275f, 0.0370266475f},
-std::array<float,2>{0.0570250042f, 0.59883672f},
-std::array<float,2>{0.709327161f, 0.375267684f},
-std::array<float,2>{0.522975385f, 0.671684325f},
-std::array<float,2>{0.22029154f, 0.347504675f},
-std::array<float,2>{0.380594939f, 0.881712914f},
-std::array<float,2>{0.804139733f, 0.221913442f},
-std::array<float,2>{0.553476214f, 0.902631223f},
-std::array<float,2>{0.206886262f, 0.243296847f},
-std::array<float,2>{0.417936772f, 0.680009484f},
-std::array<float,2>{0.777277529f, 0.366719753f},
-std::array<float,2>{0.929107428f, 0.61251086f},
-std::array<float,2>{0.251081079f, 0.397178173f},
-std::array<float,2>{0.0282239188f, 0.844823599f},
-std::array<float,2>{0.743293345f, 0.0530704595f},
-std::array<float,2>{0.830036938f, 0.77857691f},
-std::array<float,2>{0.498174608f, 0.0945635885f},
-std::array<float,2>{0.156461805f, 0.558344543f},
-std::array<float,2>{0.568863392f, 0.460317343f},
-std::array<float,2>{0.683491409f, 0.734967172f},
-std::array<float,2>{0.0793281123f, 0.284906775f},
-std::array<float,2>{0.336004466f, 0.955464184f},
-std::array<float,2>{0.974912524f, 0.155566752f},
-std::array<float,2>{0.695443153f, 0.843010366f},
-std::array<float,2>{0.042881351f, 0.00991446525f},
-std::array<float,2>{0.28631264f, 0.563832581f},
-std::array<float,2>{0.876253605f, 0.435975611f},
-std::array<float,2>{0.789337754f, 0.626793146f},
-std::array<float,2>{0.3985838f, 0.334010214f},
-std::array<float,2>{0.23618494f, 0.913360834f},
-std::array<float,2>{0.512239635f, 0.188567176f},
-std::array<float,2>{0.948319435f, 0.982210696f},
-std::array<float,2>{0.361663729f, 0.180923447f},
-std::array<float,2>{0.0956329554f, 0.703005135f},
-std::array<float,2>{0.654310763f, 0.257820398f},
-std::array<float,2>{0.617599726f, 0.522347033f},
-std::array<float,2>{0.126114011f, 0.471090019f},
-std::array<float,2>{0.439110249f, 0.81137234f},
-std::array<float,2>{0.873246133f, 0.0881404802f},
-std::array<float,2>{0.501206696f, 0.858682692f},
-std::array<float,2>{0.245286018f, 0.0577487275f},
-std::array<float,2>{0.396679461f, 0.624572694f},
-std::array<float,2>{0.786100626f, 0.400835991f},
-std::array<float,2>{0.883258283f, 0.67797488f},
-std::array<float,2>{0.29547143f, 0.369120449f},
-std::array<float,2>{0.034900941f, 0.891532302f},
-std::array<float,2>{0.692885458f, 0.23629427f},
-std::array<float,2>{0.864078224f, 0.96094805f},
-std::array<float,2>{0.451588839f, 0.148075521f},
-std::array<float,2>{0.136326954f, 0.746573687f},
-std::array<float,2>{0.614838541f, 0.289423227f},
-std::array<float,2>{0.640745938f, 0.548372388f},
-std::array<float,2>{0.104384609f, 0.466075897f},
-std::array<float,2>{0.367645085f, 0.765966117f},
-std::array<float,2>{0.943500578f, 0.102897681f},
-std::array<float,2>{0.734517395f, 0.916706562f},
-std::array<float,2>{0.0186543055f, 0.197800949f},
-std::array<float,2>{0.259431511f, 0.633955538f},
-std::array<float,2>{0.932761729f, 0.343479425f},
-std::array<float,2>{0.773430705f, 0.573938847f},
-std::array<float,2>{0.409288019f, 0.427332997f},
-std::array<float,2>{0.214159399f, 0.829052806f},
-std::array<float,2>{0.555322051f, 0.00696943002f},
-std::array<float,2>{0.979736865f, 0.802546561f},
-std::array<float,2>{0.333177f, 0.083817862f},
-std::array<float,2>{0.0916202441f, 0.524319351f},
-std::array<float,2>{0.675936282f, 0.477990597f},
-std::array<float,2>{0.575881422f, 0.688485086f},
-std::array<float,2>{0.168656826f, 0.25466305f},
-std::array<float,2>{0.484844834f, 0.970307171f},
-std::array<float,2>{0.843609512f, 0.174036816f},
-std::array<float,2>{0.599052906f, 0.988064587f},
-std::array<float,2>{0.144456908f, 0.158052757f},
-std::array<float,2>{0.454063982f, 0.703994989f},
-std::array<float,2>{0.849647403f, 0.271519512f},
-std::array<float,2>{0.966983259f, 0.501592815f},
-std::array<float,2>{0.353592068f, 0.489121765f},
-std::array<float,2>{0.119813979f, 0.792750597f},
-std::array<float,2>{0.630050778f, 0.0759370103f},
-std::array<float,2>{0.812235236f, 0.827719748f},
-std::array<float,2>{0.388432354f, 0.0212484058f},
-std::array<float,2>{0.230146945f, 0.588529885f},
-std::array<float,2>{0.530995429f, 0.421712697f},
-std::array<float,2>{0.716135502f, 0.644605279f},
-std::array<float,2>{0.0493562445f, 0.312851369f},
-std::array<float,2>{0.298370034f, 0.932114661f},
-std::array<float,2>{0.899886787f, 0.217615485f},
-std::array<float,2>{0.668144703f, 0.752059639f},
-std::array<float,2>{0.0651105717f, 0.114510156f},
-std::array<float,2>{0.324179798f, 0.53576827f},
-std::array<float,2>{0.994265378f, 0.44467628f},
-std::array<float,2>{0.821273446f, 0.720734298f},
-std::array<float,2>{0.483350456f, 0.29842338f},
-std::array<float,2>{0.181843638f, 0.94741416f},
-std::array<float,2>{0.584638238f, 0.126179069f},
-std::array<float,2>{0.916083455f, 0.886028051f},
-std::array<float,2>{0.280241281f, 0.227791667f},
-std::array<float,2>{0.013409663f, 0.663483679f},
-std::array<float,2>{0.720420897f, 0.352815837f},
-std::array<float,2>{0.531944096f, 0.604558885f},
-std::array<float,2>{0.196753547f, 0.385398358f},
-std::array<float,2>{0.432596445f, 0.868901432f},
-std::array<float,2>{0.753326774f, 0.0391777158f},
-std::array<float,2>{0.545190752f, 0.773143232f},
-std::array<float,2>{0.191320375f, 0.10721086f},
-std::array<float,2>{0.424197435f, 0.553398788f},
-std::array<float,2>{0.761853635f, 0.464532316f},
-std::array<float,2>{0.913774908f, 0.74608928f},
-std::array<float,2>{0.266210407f, 0.293521434f},
-std::array<float,2>{0.00110623555f, 0.967182994f},
-std::array<float,2>{0.733481646f, 0.143651158f},
-std::array<float,2>{0.814637303f, 0.897746325f},
-std::array<float,2>{0.471293092f, 0.239347622f},
-std::array<float,2>{0.178570986f, 0.673037827f},
-std::array<float,2>{0.588092446f, 0.373409063f},
-std::array<float,2>{0.662768245f, 0.620802104f},
-std::array<float,2>{0.0750504732f, 0.4058626f},
-std::array<float,2>{0.316247106f, 0.851852894f},
-std::array<float,2>{0.988707483f, 0.0599191226f},
-std::array<float,2>{0.706196427f, 0.975599408f},
-std::array<float,2>{0.0619529523f, 0.178336531f},
-std::array<float,2>{0.307387292f, 0.693116307f},
-std::array<float,2>{0.891358972f, 0.25233534f},
-std::array<float,2>{0.798130929f, 0.531178892f},
-std::array<float,2>{0.378113896f, 0.482671142f},
-std::array<float,2>{0.226101279f, 0.797124863f},
-std::array<float,2>{0.518465459f, 0.0816438571f},
-std::array<float,2>{0.953378558f, 0.834753335f},
-std::array<float,2>{0.34484455f, 0.00319735822f},
-std::array<float,2>{0.110763796f, 0.576656401f},
-std::array<float,2>{0.636579275f, 0.424314946f},
-std::array<float,2>{0.606921494f, 0.639441192f},
-std::array<float,2>{0.150868252f, 0.336520821f},
-std::array<float,2>{0.466062874f, 0.921078742f},
-std::array<float,2>{0.857203901f, 0.19967334f},
-std::array<float,2>{0.562678993f, 0.933973074f},
-std::array<float,2>{0.163058475f, 0.214540079f},
-std::array<float,2>{0.49270016f, 0.644260585f},
-std::array<float,2>{0.83365345f, 0.32025364f},
-std::array<float,2>{0.970258057f, 0.591117322f},
-std::array<float,2>{0.340443671f, 0.417793542f},
-std::array<float,2>{0.0857577622f, 0.823937654f},
-std::array<float,2>{0.684856713f, 0.0156665072f},
-std::array<float,2>{0.778140724f, 0.79608041f},
-std::array<float,2>{0.421736836f, 0.073800385f},
-std::array<float,2>{0.208076581f, 0.507472038f},
-std::array<float,2>{0.549764693f, 0.485729039f},
-std::array<float,2>{0.746538162f, 0.708660066f},
-std::array<float,2>{0.0253435168f, 0.269344211f},
-std::array<float,2>{0.257715523f, 0.989820123f},
-std::array<float,2>{0.922136724f, 0.163375273f},
-std::array<float,2>{0.649240494f, 0.871712983f},
-std::array<float,2>{0.1013221f, 0.0438948832f},
-std::array<float,2>{0.365790665f, 0.608681798f},
-std::array<float,2>{0.952274024f, 0.390296906f},
-std::array<float,2>{0.867860377f, 0.657835543f},
-std::array<float,2>{0.44505772f, 0.3568964f},
-std::array<float,2>{0.13231802f, 0.889338732f},
-std::array<float,2>{0.624743938f, 0.234118268f},
-std::array<float,2>{0.882074654f, 0.949819028f},
-std::array<float,2>{0.28157866f, 0.129033878f},
-std::array<float,2>{0.0433723219f, 0.725841701f},
-std::array<float,2>{0.699951649f, 0.301071465f},
-std::array<float,2>{0.510775745f, 0.533482909f},
-std::array<float,2>{0.239331782f, 0.441229463f},
-std::array<float,2>{0.403972089f, 0.754145384f},
-std::array<float,2>{0.79591161f, 0.112229273f},
-std::array<float,2>{0.610057294f, 0.818119466f},
-std::array<float,2>{0.139637992f, 0.0285651479f},
-std::array<float,2>{0.446653932f, 0.583773792f},
-std::array<float,2>{0.862784564f, 0.411291391f},
-std::array<float,2>{0.940483987f, 0.654308438f},
-std::array<float,2>{0.373299181f, 0.325921804f},
-std::array<float,2>{0.106600374f, 0.926905036f},
-std::array<float,2>{0.645916939f, 0.207576156f},
-std::array<float,2>{0.783636749f, 0.995481074f},
-std::array<float,2>{0.3932679f, 0.165983424f},
-std::array<float,2>{0.249822915f, 0.711835921f},
-std::array<float,2>{0.505032659f, 0.279859632f},
-std::array<float,2>{0.688348174f, 0.514521897f},
-std::array<float,2>{0.0384590775f, 0.496136695f},
-std::array<float,2>{0.292037278f, 0.787058771f},
-std::array<float,2>{0.887312591f, 0.0651087239f},
-std::array<float,2>{0.673365414f, 0.877572358f},
-std::array<float,2>{0.0870038047f, 0.2263107f},
-std::array<float,2>{0.331876814f, 0.6674667f},
-std::array<float,2>{0.98199302f, 0.348534346f},
-std::array<float,2>{0.836710334f, 0.597255349f},
-std::array<float,2>{0.491202265f, 0.382715136f},
-std::array<float,2>{0.16666618f, 0.865248859f},
-std::array<float,2>{0.57274282f, 0.0339473411f},
-std::array<float,2>{0.936188221f, 0.758023322f},
-std::array<float,2>{0.262338161f, 0.119799145f},
-std::array<float,2>{0.0205709226f, 0.546251476f},
-std::array<float,2>{0.739134133f, 0.451506704f},
-std::array<float,2>{0.558906913f, 0.731418252f},
-std::array<float,2>{0.217810184f, 0.30994609f},
-std::array<float,2>{0.411123872f, 0.939611971f},
-std::array<float,2>{0.766330004f, 0.140267044f},
-std::array<float,2>{0.525013149f, 0.959594429f},
-std::array<float,2>{0.234286562f, 0.148618132f},
-std::array<float,2>{0.3865062f, 0.739726186f},
-std::array<float,2>{0.807492256f, 0.285834432f},
-std::array<float,2>{0.905285776f, 0.561512291f},
-std::array<float,2>{0.301555574f, 0.455055207f},
-std::array<float,2>{0.0518908277f, 0.774072051f},
-std::array<float,2>{0.714472413f, 0.100204587f},
-std::array<float,2>{0.846302509f, 0.849408269f},
-std::array<float,2>{0.457177758f, 0.0499501638f},
-std::array<float,2>{0.146353349f, 0.615512967f},
-std::array<float,2>{0.594981313f, 0.394299448f},
-std::array<float,2>{0.626105547f, 0.685350239f},
-std::array<float,2>{0.124203034f, 0.360937774f},
-std::array<float,2>{0.358608842f, 0.901185393f},
-std::array<float,2>{0.9647277f, 0.249797523f},
-std::array<float,2>{0.72371459f, 0.807689607f},
-std::array<float,2>{0.00946430583f, 0.0909754634f},
-std::array<float,2>{0.276245326f, 0.519484639f},
-std::array<float,2>{0.921588302f, 0.476369351f},
-std::array<float,2>{0.755695701f, 0.696296751f},
-std::array<float,2>{0.435909539f, 0.262468308f},
-std::array<float,2>{0.202131435f, 0.97815305f},
-std::array<float,2>{0.538410902f, 0.186661541f},
-std::array<float,2>{0.997808158f, 0.907055736f},
-std::array<float,2>{0.327852517f, 0.192657501f},
-std::array<float,2>{0.0680911466f, 0.629142642f},
-std::array<float,2>{0.6661309f, 0.331637859f},
-std::array<float,2>{0.578631103f, 0.568662643f},
-std::array<float,2>{0.185029134f, 0.431080282f},
-std::array<float,2>{0.480239421f, 0.837810934f},
-std::array<float,2>{0.826036453f, 0.0132934311f},
-std::array<float,2>{0.604596615f, 0.763975441f},
-std::array<float,2>{0.154665157f, 0.124606639f},
-std::array<float,2>{0.462966204f, 0.542374194f},
-std::array<float,2>{0.855339944f, 0.447183073f},
-std::array<float,2>{0.960371554f, 0.728947103f},
-std::array<float,2>{0.350079238f, 0.308222324f},
-std::array<float,2>{0.115890466f, 0.944742203f},
-std::array<float,2>{0.637723029f, 0.136088982f},
-std::array<float,2>{0.801977336f, 0.879682481f},
-std::array<float,2>{0.381675482f, 0.218972936f},
-std::array<float,2>{0.221179381f, 0.669299424f},
-std::array<float,2>{0.520394444f, 0.345169574f},
-std::array<float,2>{0.708168328f, 0.599962473f},
-std::array<float,2>{0.0562573075f, 0.377996951f},
-std::array<float,2>{0.310167134f, 0.859771729f},
-std::array<float,2>{0.895105064f, 0.0385563448f},
-std::array<float,2>{0.657416046f, 0.996383011f},
-std::array<float,2>{0.0729075745f, 0.171674907f},
-std::array<float,2>{0.317545801f, 0.717996955f},
-std::array<float,2>{0.987000942f, 0.275261134f},
-std::array<float,2>{0.816794395f, 0.511134267f},
-std::array<float,2>{0.476524144f, 0.492815346f},
-std::array<float,2>{0.175083235f, 0.78337431f},
-std::array<float,2>{0.591483057f, 0.0682925209f},
-std::array<float,2>{0.909530103f, 0.815682828f},
-std::array<float,2>{0.270883679f, 0.0247801542f},
-std::array<float,2>{0.00591787975f, 0.579773009f},
-std::array<float,2>{0.728338063f, 0.407562703f},
-std::array<float,2>{0.540729821f, 0.650549233f},
-std::array<float,2>{0.193236306f, 0.323608726f},
-std::array<float,2>{0.429670304f, 0.923172712f},
-std::array<float,2>{0.758354306f, 0.203726813f},
-std::array<float,2>{0.513734043f, 0.910825193f},
-std::array<float,2>{0.238160148f, 0.189722598f},
-std::array<float,2>{0.401729405f, 0.62767303f},
-std::array<float,2>{0.792049348f, 0.33245182f},
-std::array<float,2>{0.877557933f, 0.56464541f},
-std::array<float,2>{0.288243145f, 0.435083538f},
-std::array<float,2>{0.0394534431f, 0.840022922f},
-std::array<float,2>{0.697691083f, 0.00894385483f},
-std::array<float,2>{0.872074544f, 0.809692323f},
-std::array<float,2>{0.440038025f, 0.0875417367f},
-std::array<float,2>{0.128352493f, 0.519639373f},
-std::array<float,2>{0.619778872f, 0.469475389f},
-std::array<float,2>{0.652846873f, 0.699640214f},
-std::array<float,2>{0.0965729877f, 0.259870797f},
-std::array<float,2>{0.36069116f, 0.98319608f},
-std::array<float,2>{0.945563734f, 0.183254704f},
-std::array<float,2>{0.744629562f, 0.846176207f},
-std::array<float,2>{0.0308887996f, 0.0515892878f},
-std::array<float,2>{0.25352633f, 0.610361576f},
-std::array<float,2>{0.925788522f, 0.395271212f},
-std::array<float,2>{0.774220765f, 0.682076037f},
-std::array<float,2>{0.414176852f, 0.364909053f},
-std::array<float,2>{0.203596577f, 0.904651463f},
-std::array<float,2>{0.550954938f, 0.245403916f},
-std::array<float,2>{0.974468589f, 0.95323348f},
-std::array<float,2>{0.339409441f, 0.152477816f},
-std::array<float,2>{0.0803176165f, 0.736440003f},
-std::array<float,2>{0.680814922f, 0.282137871f},
-std::array<float,2>{0.567642689f, 0.555186629f},
-std::array<float,2>{0.15871647f, 0.458696842f},
-std::array<float,2>{0.496828765f, 0.780895531f},
-std::array<float,2>{0.831914246f, 0.0961873606f},
-std::array<float,2>{0.556861103f, 0.830099761f},
-std::array<float,2>{0.211378425f, 0.00503353821f},
-std::array<float,2>{0.408116609f, 0.570694089f},
-std::array<float,2>{0.771174073f, 0.428770483f},
-std::array<float,2>{0.929953218f, 0.635253191f},
-std::array<float,2>{0.261631101f, 0.341668457f},
-std::array<float,2>{0.0162641481f, 0.915025175f},
-std::array<float,2>{0.73768127f, 0.195352569f},
-std::array<float,2>{0.840705991f, 0.972339272f},
-std::array<float,2>{0.487378329f, 0.172886774f},
-std::array<float,2>{0.171194851f, 0.690075755f},
-std::array<float,2>{0.576959193f, 0.255869657f},
-std::array<float,2>{0.679458439f, 0.526090145f},
-std::array<float,2>{0.0919768959f, 0.478854269f},
-std::array<float,2>{0.33465147f, 0.80291456f},
-std::array<float,2>{0.977703035f, 0.085092932f},
-std::array<float,2>{0.694971502f, 0.893746853f},
-std::array<float,2>{0.0331057608f, 0.236345947f},
-std::array<float,2>{0.293790966f, 0.675863326f},
-std::array<float,2>{0.885677874f, 0.369771302f},
-std::array<float,2>{0.787590325f, 0.622058392f},
-std::array<float,2>{0.39594084f, 0.39925915f},
-std::array<float,2>{0.242290154f, 0.855715096f},
-std::array<float,2>{0.503035963f, 0.0553652644f},
-std::array<float,2>{0.942767143f, 0.76938498f},
-std::array<float,2>{0.369505197f, 0.104299344f},
-std::array<float,2>{0.103492528f, 0.550505161f},
-std::array<float,2>{0.643044949f, 0.467557222f},
-std::array<float,2>{0.615388274f, 0.748959899f},
-std::array<float,2>{0.132858038f, 0.291623712f},
-std::array<float,2>{0.449648172f, 0.963597536f},
-std::array<float,2>{0.866761446f, 0.14520283f},
-std::array<float,2>{0.582199275f, 0.945327163f},
-std::array<float,2>{0.180420592f, 0.128764927f},
-std::array<float,2>{0.482029319f, 0.720239162f},
-std::array<float,2>{0.822731674f, 0.299120188f},
-std::array<float,2>{0.992333651f, 0.538364172f},
-std::array<float,2>{0.321811885f, 0.441519022f},
-std::array<float,2>{0.0643101037f, 0.750660062f},
-std::array<float,2>{0.670819879f, 0.117026895f},
-std::array<float,2>{0.75028801f, 0.870124876f},
-std::array<float,2>{0.430945605f, 0.0412457399f},
-std::array<float,2>{0.198967814f, 0.602561653f},
-std::array<float,2>{0.533399045f, 0.383399695f},
-std::array<float,2>{0.721133888f, 0.660838783f},
-std::array<float,2>{0.0142821223f, 0.354769021f},
-std::array<float,2>{0.27799052f, 0.884167552f},
-std::array<float,2>{0.915839612f, 0.229785204f},
-std::array<float,2>{0.631041706f, 0.789369643f},
-std::array<float,2>{0.118404016f, 0.0777063593f},
-std::array<float,2>{0.352373153f, 0.502222121f},
-std::array<float,2>{0.96520704f, 0.491261154f},
-std::array<float,2>{0.849200666f, 0.706390202f},
-std::array<float,2>{0.456524402f, 0.270732492f},
-std::array<float,2>{0.142239943f, 0.984535158f},
-std::array<float,2>{0.600603223f, 0.159436435f},
-std::array<float,2>{0.901868403f, 0.930485368f},
-std::array<float,2>{0.300774723f, 0.216384366f},
-std::array<float,2>{0.0474931039f, 0.646840036f},
-std::array<float,2>{0.718483388f, 0.316040128f},
-std::array<float,2>{0.529259861f, 0.585978389f},
-std::array<float,2>{0.227503896f, 0.418648094f},
-std::array<float,2>{0.38973543f, 0.825901687f},
-std::array<float,2>{0.809641182f, 0.0215433948f},
-std::array<float,2>{0.516150475f, 0.80031234f},
-std::array<float,2>{0.224455357f, 0.0786229521f},
-std::array<float,2>{0.376346529f, 0.528824091f},
-std::array<float,2>{0.799241483f, 0.481614679f},
-std::array<float,2>{0.893238246f, 0.694442809f},
-std::array<float,2>{0.306557208f, 0.25071606f},
-std::array<float,2>{0.0598267354f, 0.973321855f},
-std::array<float,2>{0.703756511f, 0.175794452f},
-std::array<float,2>{0.859094739f, 0.918303072f},
-std::array<float,2>{0.466798693f, 0.201323181f},
-std::array<float,2>{0.150129601f, 0.637274325f},
-std::array<float,2>{0.609340489f, 0.339315146f},
-std::array<float,2>{0.634012759f, 0.574716628f},
-std::array<float,2>{0.11277689f, 0.422983885f},
-std::array<float,2>{0.346330881f, 0.832545877f},
-std::array<float,2>{0.956014931f, 0.00190767343f},
-std::array<float,2>{0.7319538f, 0.965591788f},
-std::array<float,2>{0.00221396354f, 0.142235905f},
-std::array<float,2>{0.268356621f, 0.743980706f},
-std::array<float,2>{0.911162317f, 0.295307547f},
-std::array<float,2>{0.764292717f, 0.551613927f},
-std::array<float,2>{0.423236221f, 0.462091744f},
-std::array<float,2>{0.18928276f, 0.769808054f},
-std::array<float,2>{0.543962657f, 0.10786546f},
-std::array<float,2>{0.990726352f, 0.854109228f},
-std::array<float,2>{0.313536108f, 0.0623485744f},
-std::array<float,2>{0.0762623474f, 0.618584096f},
-std::array<float,2>{0.661614716f, 0.403033793f},
-std::array<float,2>{0.587827384f, 0.674009025f},
-std::array<float,2>{0.176151931f, 0.372242481f},
-std::array<float,2>{0.469991982f, 0.894765973f},
-std::array<float,2>{0.812964618f, 0.241017491f},
-std::array<float,2>{0.621794581f, 0.887511194f},
-std::array<float,2>{0.130531684f, 0.23086822f},
-std::array<float,2>{0.442619592f, 0.659282923f},
-std::array<float,2>{0.869574487f, 0.35772413f},
-std::array<float,2>{0.949509442f, 0.607344866f},
-std::array<float,2>{0.363935679f, 0.387627989f},
-std::array<float,2>{0.0978703275f, 0.873511076f},
-std::array<float,2>{0.651440144f, 0.0465092435f},
-std::array<float,2>{0.794187427f, 0.757356763f},
-std::array<float,2>{0.405552477f, 0.110168941f},
-std::array<float,2>{0.242162943f, 0.532397151f},
-std::array<float,2>{0.509636223f, 0.439298421f},
-std::array<float,2>{0.70257175f, 0.723889351f},
-std::array<float,2>{0.045763921f, 0.303350925f},
-std::array<float,2>{0.283638179f, 0.951958477f},
-std::array<float,2>{0.88010031f, 0.132439405f},
-std::array<float,2>{0.686326206f, 0.820887446f},
-std::array<float,2>{0.0824915096f, 0.0193154383f},
-std::array<float,2>{0.342794746f, 0.592101634f},
-std::array<float,2>{0.971792996f, 0.415115178f},
-std::array<float,2>{0.835407853f, 0.641434908f},
-std::array<float,2>{0.494270027f, 0.317368597f},
-std::array<float,2>{0.160288766f, 0.936118305f},
-std::array<float,2>{0.565750122f, 0.211997151f},
-std::array<float,2>{0.925242186f, 0.991312861f},
-std::array<float,2>{0.25491935f, 0.160954788f},
-std::array<float,2>{0.0260423347f, 0.710458279f},
-std::array<float,2>{0.748289526f, 0.265930057f},
-std::array<float,2>{0.547131896f, 0.504015028f},
-std::array<float,2>{0.208985403f, 0.487357795f},
-std::array<float,2>{0.419090688f, 0.794899285f},
-std::array<float,2>{0.780700505f, 0.0712806359f},
-std::array<float,2>{0.570796609f, 0.864013433f},
-std::array<float,2>{0.165774167f, 0.0322147459f},
-std::array<float,2>{0.489414811f, 0.595453858f},
-std::array<float,2>{0.83908087f, 0.379744738f},
-std::array<float,2>{0.984194279f, 0.665791214f},
-std::array<float,2>{0.32911703f, 0.350730002f},
-std::array<float,2>{0.0885313526f, 0.876582325f},
-std::array<float,2>{0.675727963f, 0.223346993f},
-std::array<float,2>{0.76849699f, 0.939224482f},
-std::array<float,2>{0.412513971f, 0.136936098f},
-std::array<float,2>{0.21637176f, 0.733817935f},
-std::array<float,2>{0.561391115f, 0.310704142f},
-std::array<float,2>{0.741735816f, 0.543637812f},
-std::array<float,2>{0.0218797233f, 0.449884325f},
-std::array<float,2>{0.263733298f, 0.760834277f},
-std::array<float,2>{0.934176505f, 0.118074857f},
-std::array<float,2>{0.648421228f, 0.929336429f},
-std::array<float,2>{0.109162584f, 0.210471213f},
-std::array<float,2>{0.371773928f, 0.654209018f},
-std::array<float,2>{0.938915789f, 0.327869177f},
-std::array<float,2>{0.859805226f, 0.585588872f},
-std::array<float,2>{0.448635072f, 0.413658917f},
-std::array<float,2>{0.136856496f, 0.820179641f},
-std::array<float,2>{0.613243163f, 0.0309332293f},
-std::array<float,2>{0.889291584f, 0.788397133f},
-std::array<float,2>{0.290274143f, 0.0644446909f},
-std::array<float,2>{0.0358425826f, 0.513618112f},
-std::array<float,2>{0.689983487f, 0.499420822f},
-std::array<float,2>{0.505980074f, 0.71448952f},
-std::array<float,2>{0.246939138f, 0.278986216f},
-std::array<float,2>{0.391735256f, 0.994067669f},
-std::array<float,2>{0.782591164f, 0.166334897f},
-std::array<float,2>{0.535417318f, 0.980119765f},
-std::array<float,2>{0.201048002f, 0.184728026f},
-std::array<float,2>{0.434466064f, 0.69822222f},
-std::array<float,2>{0.757676601f, 0.264776736f},
-std::array<float,2>{0.91887486f, 0.515749276f},
-std::array<float,2>{0.275384516f, 0.473957419f},
-std::array<float,2>{0.0109850215f, 0.806020498f},
-std::array<float,2>{0.725997865f, 0.0928755254f},
-std::array<float,2>{0.827917576f, 0.8384794f},
-std::array<float,2>{0.478283912f, 0.0143055972f},
-std::array<float,2>{0.186729878f, 0.567917943f},
-std::array<float,2>{0.581637383f, 0.433298111f},
-std::array<float,2>{0.664394021f, 0.631952226f},
-std::array<float,2>{0.0700532049f, 0.329089373f},
-std::array<float,2>{0.32607621f, 0.908579648f},
-std::array<float,2>{0.998148739f, 0.194322169f},
-std::array<float,2>{0.711936891f, 0.77711767f},
-std::array<float,2>{0.0544002801f, 0.0980715975f},
-std::array<float,2>{0.303687155f, 0.558681726f},
-std::array<float,2>{0.902479887f, 0.455556363f},
-std::array<float,2>{0.805140257f, 0.742184222f},
-std::array<float,2>{0.382877916f, 0.288433731f},
-std::array<float,2>{0.232194424f, 0.958478689f},
-std::array<float,2>{0.527004302f, 0.151894122f},
-std::array<float,2>{0.961309731f, 0.898961008f},
-std::array<float,2>{0.357267767f, 0.246612787f},
-std::array<float,2>{0.122949012f, 0.686900735f},
-std::array<float,2>{0.628305376f, 0.362800568f},
-std::array<float,2>{0.596059918f, 0.613455296f},
-std::array<float,2>{0.14830102f, 0.392300069f},
-std::array<float,2>{0.459628135f, 0.850639224f},
-std::array<float,2>{0.844007909f, 0.0475668386f},
-std::array<float,2>{0.620184064f, 0.811819077f},
-std::array<float,2>{0.127183914f, 0.0889347345f},
-std::array<float,2>{0.440832973f, 0.522544503f},
-std::array<float,2>{0.871361971f, 0.472278535f},
-std::array<float,2>{0.946900308f, 0.702010989f},
-std::array<float,2>{0.360151082f, 0.258892f},
-std::array<float,2>{0.0975483358f, 0.980568886f},
-std::array<float,2>{0.654205084f, 0.179988369f},
-std::array<float,2>{0.791271806f, 0.912729621f},
-std::array<float,2>{0.400742263f, 0.188345641f},
-std::array<float,2>{0.236640647f, 0.625802875f},
-std::array<float,2>{0.515351474f, 0.335562706f},
-std::array<float,2>{0.698520124f, 0.563362241f},
-std::array<float,2>{0.0404346921f, 0.436853409f},
-std::array<float,2>{0.287399709f, 0.84214586f},
-std::array<float,2>{0.878126085f, 0.010837256f},
-std::array<float,2>{0.680372655f, 0.956155837f},
-std::array<float,2>{0.0816162825f, 0.154616967f},
-std::array<float,2>{0.33859548f, 0.73614496f},
-std::array<float,2>{0.973546684f, 0.283251971f},
-std::array<float,2>{0.830590606f, 0.557433784f},
-std::array<float,2>{0.497576714f, 0.459802836f},
-std::array<float,2>{0.159884647f, 0.778251588f},
-std::array<float,2>{0.567141354f, 0.095153518f},
-std::array<float,2>{0.926961601f, 0.843802154f},
-std::array<float,2>{0.252881795f, 0.0543287992f},
-std::array<float,2>{0.0301121604f, 0.612009645f},
-std::array<float,2>{0.745227873f, 0.397674024f},
-std::array<float,2>{0.551879525f, 0.680981696f},
-std::array<float,2>{0.204957023f, 0.365705967f},
-std::array<float,2>{0.415592283f, 0.903415263f},
-std::array<float,2>{0.77445662f, 0.24266547f},
-std::array<float,2>{0.521036685f, 0.882014036f},
-std::array<float,2>{0.222167626f, 0.221131727f},
-std::array<float,2>{0.382719934f, 0.670818925f},
-std::array<float,2>{0.800963402f, 0.346382856f},
-std::array<float,2>{0.896011651f, 0.597991586f},
-std::array<float,2>{0.309114546f, 0.376627475f},
-std::array<float,2>{0.0551265292f, 0.862314105f},
-std::array<float,2>{0.707213879f, 0.0352410898f},
-std::array<float,2>{0.85378617f, 0.763617218f},
-std::array<float,2>{0.464232683f, 0.121657819f},
-std::array<float,2>{0.155791968f, 0.540229917f},
-std::array<float,2>{0.603601933f, 0.448462784f},
-std::array<float,2>{0.637164116f, 0.727449f},
-std::array<float,2>{0.117097825f, 0.305468649f},
-std::array<float,2>{0.35124144f, 0.942437172f},
-std::array<float,2>{0.959467947f, 0.133244991f},
-std::array<float,2>{0.726753771f, 0.813491881f},
-std::array<float,2>{0.00692710187f, 0.0273246113f},
-std::array<float,2>{0.2698946f, 0.580367267f},
-std::array<float,2>{0.908325255f, 0.408989459f},
-std::array<float,2>{0.759004176f, 0.648477495f},
-std::array<float,2>{0.427883297f, 0.320958227f},
-std::array<float,2>{0.192124292f, 0.92474401f},
-std::array<float,2>{0.539153993f, 0.206427827f},
-std::array<float,2>{0.987965703f, 0.99915415f},
-std::array<float,2>{0.31647566f, 0.168151036f},
-std::array<float,2>{0.0741559044f, 0.715712726f},
-std::array<float,2>{0.656745315f, 0.276230782f},
-std::array<float,2>{0.590353966f, 0.509682178f},
-std::array<float,2>{0.17476961f, 0.495447159f},
-std::array<float,2>{0.475323498f, 0.782504618f},
-std::array<float,2>{0.818301558f, 0.0692760721f},
-std::array<float,2>{0.534309745f, 0.86773932f},
-std::array<float,2>{0.19809939f, 0.0406468548f},
-std::array<float,2>{0.430144757f, 0.604179025f},
-std::array<float,2>{0.751012444f, 0.385790408f},
-std::array<float,2>{0.914969623f, 0.662319064f},
-std::array<float,2>{0.278485119f, 0.351633668f},
-std::array<float,2>{0.0146749262f, 0.885541141f},
-std::array<float,2>{0.721903443f, 0.227412879f},
-std::array<float,2>{0.823699713f, 0.948882461f},
-std::array<float,2>{0.481008917f, 0.125785351f},
-std::array<float,2>{0.180778265f, 0.722314298f},
-std::array<float,2>{0.583044291f, 0.297798544f},
-std::array<float,2>{0.671239674f, 0.536785841f},
-std::array<float,2>{0.0633833483f, 0.444290608f},
-std::array<float,2>{0.321088016f, 0.753633499f},
-std::array<float,2>{0.994012117f, 0.113823056f},
-std::array<float,2>{0.717089713f, 0.932833195f},
-std::array<float,2>{0.0479831621f, 0.21803759f},
-std::array<float,2>{0.298942357f, 0.646302521f},
-std::array<float,2>{0.900993109f, 0.313737154f},
-std::array<float,2>{0.809383273f, 0.58932066f},
-std::array<float,2>{0.389007986f, 0.419980854f},
-std::array<float,2>{0.228056833f, 0.826313972f},
-std::array<float,2>{0.527816594f, 0.0195720065f},
-std::array<float,2>{0.965826988f, 0.79190135f},
-std::array<float,2>{0.35349673f, 0.0749817863f},
-std::array<float,2>{0.117684007f, 0.500445485f},
-std::array<float,2>{0.632209539f, 0.489568442f},
-std::array<float,2>{0.600119054f, 0.704766393f},
-std::array<float,2>{0.14151001f, 0.272992134f},
-std::array<float,2>{0.455921739f, 0.986732483f},
-std::array<float,2>{0.847929001f, 0.157127574f},
-std::array<float,2>{0.577282548f, 0.969441235f},
-std::array<float,2>{0.169969618f, 0.174934551f},
-std::array<float,2>{0.48721537f, 0.688201964f},
-std::array<float,2>{0.841004014f, 0.255528182f},
-std::array<float,2>{0.977150559f, 0.524988651f},
-std::array<float,2>{0.335275203f, 0.476675123f},
-std::array<float,2>{0.0930477753f, 0.800913572f},
-std::array<float,2>{0.678332984f, 0.0823334754f},
-std::array<float,2>{0.769538403f, 0.829800069f},
-std::array<float,2>{0.407197535f, 0.0065676095f},
-std::array<float,2>{0.212256163f, 0.573052287f},
-std::array<float,2>{0.558157623f, 0.42601195f},
-std::array<float,2>{0.73638618f, 0.633704841f},
-std::array<float,2>{0.0171417166f, 0.342079043f},
-std::array<float,2>{0.260112017f, 0.917254448f},
-std::array<float,2>{0.931438088f, 0.198986843f},
-std::array<float,2>{0.644049168f, 0.767576873f},
-std::array<float,2>{0.10251312f, 0.102039039f},
-std::array<float,2>{0.371016711f, 0.547674775f},
-std::array<float,2>{0.942375481f, 0.465435833f},
-std::array<float,2>{0.865460098f, 0.747900069f},
-std::array<float,2>{0.450341314f, 0.290599853f},
-std::array<float,2>{0.133955479f, 0.962465584f},
-std::array<float,2>{0.616961479f, 0.147046283f},
-std::array<float,2>{0.885800362f, 0.891945779f},
-std::array<float,2>{0.294593841f, 0.234843686f},
-std::array<float,2>{0.032150384f, 0.678955913f},
-std::array<float,2>{0.693718731f, 0.368141592f},
-std::array<float,2>{0.502142489f, 0.623347938f},
-std::array<float,2>{0.243249714f, 0.401926219f},
-std::array<float,2>{0.395437151f, 0.85813725f},
-std::array<float,2>{0.788813353f, 0.0566905662f},
-std::array<float,2>{0.508663893f, 0.755145609f},
-std::array<float,2>{0.240433529f, 0.112717554f},
-std::array<float,2>{0.404988408f, 0.534710586f},
-std::array<float,2>{0.79389894f, 0.440386564f},
-std::array<float,2>{0.879508197f, 0.725066662f},
-std::array<float,2>{0.284569889f, 0.301905155f},
-std::array<float,2>{0.0463979393f, 0.950846791f},
-std::array<float,2>{0.70153892f, 0.130722225f},
-std::array<float,2>{0.870301783f, 0.890217662f},
-std::array<float,2>{0.441843152f, 0.232606947f},
-std::array<float,2>{0.12969549f, 0.656410635f},
-std::array<float,2>{0.622462809f, 0.355932683f},
-std::array<float,2>{0.650627732f, 0.608389616f},
-std::array<float,2>{0.099107556f, 0.389510065f},
-std::array<float,2>{0.36444214f, 0.872963846f},
-std::array<float,2>{0.951006055f, 0.0440417305f},
-std::array<float,2>{0.749214172f, 0.988482714f},
-std::array<float,2>{0.0266118124f, 0.162231311f},
-std::array<float,2>{0.254433781f, 0.707986355f},
-std::array<float,2>{0.923838675f, 0.268191308f},
-std::array<float,2>{0.780106544f, 0.506041706f},
-std::array<float,2>{0.418111861f, 0.484685212f},
-std::array<float,2>{0.210125431f, 0.795845687f},
-std::array<float,2>{0.548514307f, 0.0725825056f},
-std::array<float,2>{0.970912039f, 0.82300365f},
-std::array<float,2>{0.342625409f, 0.0171812009f},
-std::array<float,2>{0.0834310502f, 0.590526402f},
-std::array<float,2>{0.686580122f, 0.416218638f},
-std::array<float,2>{0.564721286f, 0.64322108f},
-std::array<float,2>{0.161889851f, 0.319226533f},
-std::array<float,2>{0.495841891f, 0.935299873f},
-std::array<float,2>{0.834573627f, 0.213280767f},
-std::array<float,2>{0.608312666f, 0.92007786f},
-std::array<float,2>{0.149092168f, 0.200357735f},
-std::array<float,2>{0.468665928f, 0.639821947f},
-std::array<float,2>{0.857926548f, 0.337539703f},
-std::array<float,2>{0.956729412f, 0.577912986f},
-std::array<float,2>{0.347331792f, 0.425459266f},
-std::array<float,2>{0.112197921f, 0.835710466f},
-std::array<float,2>{0.633500934f, 0.00258543505f},
-std::array<float,2>{0.80032146f, 0.79865253f},
-std::array<float,2>{0.375746101f, 0.080571495f},
-std::array<float,2>{0.22321856f, 0.530232966f},
-std::array<float,2>{0.517026722f, 0.483695298f},
-std::array<float,2>{0.705007374f, 0.691633999f},
-std::array<float,2>{0.0588654019f, 0.253816873f},
-std::array<float,2>{0.305118561f, 0.975318134f},
-std::array<float,2>{0.893691003f, 0.179370314f},
-std::array<float,2>{0.661101341f, 0.852625966f},
-std::array<float,2>{0.0778149813f, 0.0587593503f},
-std::array<float,2>{0.312672496f, 0.619553626f},
-std::array<float,2>{0.991487145f, 0.404417723f},
-std::array<float,2>{0.814381003f, 0.672302067f},
-std::array<float,2>{0.469454706f, 0.37406531f},
-std::array<float,2>{0.177134976f, 0.896655798f},
-std::array<float,2>{0.586107135f, 0.23890084f},
-std::array<float,2>{0.910970449f, 0.968148053f},
-std::array<float,2>{0.269094676f, 0.142742798f},
-std::array<float,2>{0.00372914085f, 0.744286656f},
-std::array<float,2>{0.730699718f, 0.294531047f},
-std::array<float,2>{0.543259799f, 0.554018319f},
-std::array<float,2>{0.187750652f, 0.46352753f},
-std::array<float,2>{0.42262134f, 0.772232413f},
-std::array<float,2>{0.765454531f, 0.106351413f},
-std::array<float,2>{0.580471158f, 0.836399496f},
-std::array<float,2>{0.186349615f, 0.0121303806f},
-std::array<float,2>{0.477106243f, 0.569814801f},
-std::array<float,2>{0.82629019f, 0.430194885f},
-std::array<float,2>{0.999585986f, 0.630084455f},
-std::array<float,2>{0.324535459f, 0.330504626f},
-std::array<float,2>{0.0687257126f, 0.907439947f},
-std::array<float,2>{0.665365994f, 0.191739097f},
-std::array<float,2>{0.756217659f, 0.977469444f},
-std::array<float,2>{0.435022891f, 0.186126992f},
-std::array<float,2>{0.199528128f, 0.695962429f},
-std::array<float,2>{0.536957026f, 0.263381273f},
-std::array<float,2>{0.725125372f, 0.517652452f},
-std::array<float,2>{0.0102560055f, 0.474931061f},
-std::array<float,2>{0.273492455f, 0.807486534f},
-std::array<float,2>{0.919806719f, 0.0907043517f},
-std::array<float,2>{0.627482772f, 0.901402771f},
-std::array<float,2>{0.121715464f, 0.248047233f},
-std::array<float,2>{0.355555892f, 0.684432983f},
-std::array<float,2>{0.962421656f, 0.359727204f},
-std::array<float,2>{0.845199823f, 0.616833389f},
-std::array<float,2>{0.46020323f, 0.393149734f},
-std::array<float,2>{0.147101909f, 0.847760677f},
-std::array<float,2>{0.597579956f, 0.0493488126f},
-std::array<float,2>{0.903471112f, 0.775250971f},
-std::array<float,2>{0.304660589f, 0.101150766f},
-std::array<float,2>{0.0532526411f, 0.561893642f},
-std::array<float,2>{0.711714983f, 0.453432739f},
-std::array<float,2>{0.525709212f, 0.738644004f},
-std::array<float,2>{0.231324539f, 0.286832482f},
-std::array<float,2>{0.384456158f, 0.960125089f},
-std::array<float,2>{0.805703461f, 0.14977704f},
-std::array<float,2>{0.562328875f, 0.940975189f},
-std::array<float,2>{0.215063214f, 0.13870813f},
-std::array<float,2>{0.413145751f, 0.731671751f},
-std::array<float,2>{0.768674135f, 0.308926791f},
-std::array<float,2>{0.935519755f, 0.54496485f},
-std::array<float,2>{0.264672846f, 0.452265233f},
-std::array<float,2>{0.0225009825f, 0.759674549f},
-std::array<float,2>{0.740508139f, 0.12095093f},
-std::array<float,2>{0.8382954f, 0.866262019f},
-std::array<float,2>{0.488872498f, 0.0350311175f},
-std::array<float,2>{0.164671719f, 0.596098363f},
-std::array<float,2>{0.571787179f, 0.381765306f},
-std::array<float,2>{0.674347699f, 0.666130424f},
-std::array<float,2>{0.0889588669f, 0.348786861f},
-std::array<float,2>{0.328208894f, 0.878054321f},
-std::array<float,2>{0.982859433f, 0.225266069f},
-std::array<float,2>{0.690757751f, 0.785761356f},
-std::array<float,2>{0.0368281677f, 0.0657107234f},
-std::array<float,2>{0.289878249f, 0.514818609f},
-std::array<float,2>{0.890065074f, 0.497521013f},
-std::array<float,2>{0.781504035f, 0.712199748f},
-std::array<float,2>{0.391152114f, 0.280755401f},
-std::array<float,2>{0.247852311f, 0.994720697f},
-std::array<float,2>{0.507131994f, 0.165011495f},
-std::array<float,2>{0.938403249f, 0.92611897f},
-std::array<float,2>{0.372197449f, 0.208225563f},
-std::array<float,2>{0.107534729f, 0.655688584f},
-std::array<float,2>{0.647000194f, 0.324658632f},
-std::array<float,2>{0.612010539f, 0.582803845f},
-std::array<float,2>{0.138497487f, 0.410259545f},
-std::array<float,2>{0.447268784f, 0.816412091f},
-std::array<float,2>{0.861265719f, 0.0276967864f},
-std::array<float,2>{0.569759548f, 0.779427707f},
-std::array<float,2>{0.157874569f, 0.0973635539f},
-std::array<float,2>{0.499713302f, 0.556251168f},
-std::array<float,2>{0.828753293f, 0.457617849f},
-std::array<float,2>{0.975709438f, 0.737318456f},
-std::array<float,2>{0.337842256f, 0.282621831f},
-std::array<float,2>{0.0787956044f, 0.954499424f},
-std::array<float,2>{0.681816339f, 0.153931841f},
-std::array<float,2>{0.776352286f, 0.905685782f},
-std::array<float,2>{0.416030228f, 0.244961143f},
-std::array<float,2>{0.205135122f, 0.682683527f},
-std::array<float,2>{0.553835273f, 0.363295048f},
-std::array<float,2>{0.74262619f, 0.609501123f},
-std::array<float,2>{0.0292085726f, 0.396155983f},
-std::array<float,2>{0.250666469f, 0.847474337f},
-std::array<float,2>{0.928479016f, 0.0520102493f},
-std::array<float,2>{0.65576148f, 0.9839921f},
-std::array<float,2>{0.0941141844f, 0.181862935f},
-std::array<float,2>{0.362815827f, 0.701031029f},
-std::array<float,2>{0.948093355f, 0.261629879f},
-std::array<float,2>{0.874589086f, 0.521212399f},
-std::array<float,2>{0.437955171f, 0.470199078f},
-std::array<float,2>{0.125570804f, 0.808874965f},
-std::array<float,2>{0.618312061f, 0.0859429017f},
-std::array<float,2>{0.875619233f, 0.841061175f},
-std::array<float,2>{0.285238087f, 0.00816585496f},
-std::array<float,2>{0.0418328196f, 0.565502107f},
-std::array<float,2>{0.696360588f, 0.434197336f},
-std::array<float,2>{0.513116896f, 0.628714502f},
-std::array<float,2>{0.234928891f, 0.33310917f},
-std::array<float,2>{0.399618864f, 0.911615431f},
-std::array<float,2>{0.790913105f, 0.191133022f},
-std::array<float,2>{0.541263402f, 0.922204733f},
-std::array<float,2>{0.194909081f, 0.204407677f},
-std::array<float,2>{0.426328301f, 0.652199149f},
-std::array<float,2>{0.761394978f, 0.322738349f},
-std::array<float,2>{0.907728195f, 0.578775585f},
-std::array<float,2>{0.273132473f, 0.406738579f},
-std::array<float,2>{0.00489007775f, 0.815057218f},
-std::array<float,2>{0.729564726f, 0.0240887105f},
-std::array<float,2>{0.820059121f, 0.78459388f},
-std::array<float,2>{0.473472923f, 0.0665528774f},
-std::array<float,2>{0.172777861f, 0.510544658f},
-std::array<float,2>{0.593496799f, 0.493508786f},
-std::array<float,2>{0.660078585f, 0.717282474f},
-std::array<float,2>{0.0717112198f, 0.274118781f},
-std::array<float,2>{0.318977118f, 0.997676134f},
-std::array<float,2>{0.984424889f, 0.169998378f},
-std::array<float,2>{0.710079968f, 0.860655427f},
-std::array<float,2>{0.057618361f, 0.0372247025f},
-std::array<float,2>{0.310681909f, 0.600813329f},
-std::array<float,2>{0.896811306f, 0.377117008f},
-std::array<float,2>{0.803634524f, 0.668915868f},
-std::array<float,2>{0.379309744f, 0.343883187f},
-std::array<float,2>{0.219129056f, 0.880409241f},
-std::array<float,2>{0.521556258f, 0.220686227f},
-std::array<float,2>{0.95770824f, 0.943392396f},
-std::array<float,2>{0.349552423f, 0.135647774f},
-std::array<float,2>{0.113643199f, 0.73010242f},
-std::array<float,2>{0.639615536f, 0.306893289f},
-std::array<float,2>{0.602776349f, 0.541032374f},
-std::array<float,2>{0.153459147f, 0.446266234f},
-std::array<float,2>{0.462380141f, 0.765079856f},
-std::array<float,2>{0.853045821f, 0.123690814f},
-std::array<float,2>{0.529417634f, 0.824428737f},
-std::array<float,2>{0.228544101f, 0.0226946864f},
-std::array<float,2>{0.386951387f, 0.587180614f},
-std::array<float,2>{0.8114627f, 0.419521153f},
-std::array<float,2>{0.898768902f, 0.647925377f},
-std::array<float,2>{0.296986789f, 0.314605057f},
-std::array<float,2>{0.0503718443f, 0.931630373f},
-std::array<float,2>{0.715565979f, 0.215394586f},
-std::array<float,2>{0.850629568f, 0.985376537f},
-std::array<float,2>{0.454295039f, 0.158317536f},
-std::array<float,2>{0.143298328f, 0.705757618f},
-std::array<float,2>{0.598359704f, 0.269684315f},
-std::array<float,2>{0.629277229f, 0.503266811f},
-std::array<float,2>{0.120197847f, 0.490462482f},
-std::array<float,2>{0.354599267f, 0.790072322f},
-std::array<float,2>{0.967879474f, 0.0770891234f},
-std::array<float,2>{0.71888423f, 0.882949889f},
-std::array<float,2>{0.012376328f, 0.229154304f},
-std::array<float,2>{0.280615658f, 0.661358714f},
-std::array<float,2>{0.917868495f, 0.354090154f},
-std::array<float,2>{0.752889156f, 0.601868033f},
-std::array<float,2>{0.432947755f, 0.384671688f},
-std::array<float,2>{0.195835993f, 0.869510531f},
-std::array<float,2>{0.533087313f, 0.0421831384f},
-std::array<float,2>{0.99601686f, 0.751877725f},
-std::array<float,2>{0.322621614f, 0.115485929f},
-std::array<float,2>{0.0660446584f, 0.537541628f},
-std::array<float,2>{0.669159234f, 0.44330436f},
-std::array<float,2>{0.585327208f, 0.719479024f},
-std::array<float,2>{0.183037043f, 0.300450087f},
-std::array<float,2>{0.483804971f, 0.946412802f},
-std::array<float,2>{0.82182771f, 0.127231285f},
-std::array<float,2>{0.614081383f, 0.964037955f},
-std::array<float,2>{0.134920567f, 0.145856306f},
-std::array<float,2>{0.452635795f, 0.749532878f},
-std::array<float,2>{0.865104496f, 0.292468607f},
-std::array<float,2>{0.944515705f, 0.549123108f},
-std::array<float,2>{0.369012922f, 0.468362212f},
-std::array<float,2>{0.105327733f, 0.767680883f},
-std::array<float,2>{0.64177233f, 0.105030142f},
-std::array<float,2>{0.786452651f, 0.856641412f},
-std::array<float,2>{0.39758563f, 0.0561800413f},
-std::array<float,2>{0.244678438f, 0.622758031f},
-std::array<float,2>{0.500595808f, 0.399881452f},
-std::array<float,2>{0.692340851f, 0.677044094f},
-std::array<float,2>{0.0340723395f, 0.370347291f},
-std::array<float,2>{0.296102524f, 0.892687738f},
-std::array<float,2>{0.88415581f, 0.2374672f},
-std::array<float,2>{0.677132666f, 0.804153144f},
-std::array<float,2>{0.0902380645f, 0.0844292715f},
-std::array<float,2>{0.332191169f, 0.526744545f},
-std::array<float,2>{0.978678763f, 0.480111659f},
-std::array<float,2>{0.841930747f, 0.691337585f},
-std::array<float,2>{0.485475689f, 0.257136017f},
-std::array<float,2>{0.169330239f, 0.970862925f},
-std::array<float,2>{0.575108349f, 0.172057107f},
-std::array<float,2>{0.93214035f, 0.915192544f},
-std::array<float,2>{0.257936299f, 0.196983218f},
-std::array<float,2>{0.018289553f, 0.63610965f},
-std::array<float,2>{0.735436141f, 0.340325415f},
-std::array<float,2>{0.555743277f, 0.571718216f},
-std::array<float,2>{0.213297427f, 0.42780453f},
-std::array<float,2>{0.408903509f, 0.831535757f},
-std::array<float,2>{0.772081137f, 0.00404821616f},
-std::array<float,2>{0.549812436f, 0.793807089f},
-std::array<float,2>{0.207899004f, 0.0716860741f},
-std::array<float,2>{0.420149148f, 0.505352378f},
-std::array<float,2>{0.778766513f, 0.486603588f},
-std::array<float,2>{0.923480272f, 0.709020853f},
-std::array<float,2>{0.255901247f, 0.267555743f},
-std::array<float,2>{0.0237741582f, 0.990923166f},
-std::array<float,2>{0.748021364f, 0.161667004f},
-std::array<float,2>{0.832589805f, 0.93746978f},
-std::array<float,2>{0.493215501f, 0.211792991f},
-std::array<float,2>{0.163668454f, 0.642280519f},
-std::array<float,2>{0.564413786f, 0.318350434f},
-std::array<float,2>{0.684104085f, 0.593237579f},
-std::array<float,2>{0.0840271413f, 0.414165407f},
-std::array<float,2>{0.341697574f, 0.821558774f},
-std::array<float,2>{0.969176352f, 0.0176791269f},
-std::array<float,2>{0.70087564f, 0.952524006f},
-std::array<float,2>{0.0440549701f, 0.130952314f},
-std::array<float,2>{0.282303691f, 0.72322154f},
-std::array<float,2>{0.881303132f, 0.304447174f},
-std::array<float,2>{0.795307457f, 0.531884372f},
-std::array<float,2>{0.403156132f, 0.438219994f},
-std::array<float,2>{0.23917222f, 0.755901337f},
-std::array<float,2>{0.510150671f, 0.110770248f},
-std::array<float,2>{0.952100456f, 0.874524355f},
-std::array<float,2>{0.366558075f, 0.0453770794f},
-std::array<float,2>{0.100383431f, 0.606085598f},
-std::array<float,2>{0.649892151f, 0.388276786f},
-std::array<float,2>{0.623436511f, 0.658899128f},
-std::array<float,2>{0.130927056f, 0.35918504f},
-std::array<float,2>{0.443628401f, 0.888203859f},
-std::array<float,2>{0.868358791f, 0.231879964f},
-std::array<float,2>{0.58935535f, 0.896434605f},
-std::array<float,2>{0.178863809f, 0.241601333f},
-std::array<float,2>{0.472143054f, 0.67498517f},
-std::array<float,2>{0.816329479f, 0.371800363f},
-std::array<float,2>{0.989797473f, 0.617724121f},
-std::array<float,2>{0.315001518f, 0.403733194f},
-std::array<float,2>{0.0760683641f, 0.854780734f},
-std::array<float,2>{0.663196504f, 0.0607782342f},
-std::array<float,2>{0.763415158f, 0.770825565f},
-std::array<float,2>{0.425245345f, 0.109136418f},
-std::array<float,2>{0.190146655f, 0.552662075f},
-std::array<float,2>{0.546126008f, 0.461349934f},
-std::array<float,2>{0.733058512f, 0.742876887f},
-std::array<float,2>{0.000880691223f, 0.296737969f},
-std::array<float,2>{0.267221212f, 0.965907991f},
-std::array<float,2>{0.912125945f, 0.140634045f},
-std::array<float,2>{0.635384083f, 0.83358258f},
-std::array<float,2>{0.110183738f, 3.24841021e-05f},
-std::array<float,2>{0.344532639f, 0.575739086f},
-std::array<float,2>{0.954515815f, 0.422843754f},
-std::array<float,2>{0.855479658f, 0.638505518f},
-std::array<float,2>{0.465644836f, 0.338279277f},
-std::array<float,2>{0.151710689f, 0.919372797f},
-std::array<float,2>{0.605470777f, 0.202918887f},
-std::array<float,2>{0.891735196f, 0.974262834f},
-std::array<float,2>{0.308190495f, 0.176961184f},
-std::array<float,2>{0.0610680133f, 0.694331646f},
-std::array<float,2>{0.705096602f, 0.25113073f},
-std::array<float,2>{0.519441247f, 0.528069735f},
-std::array<float,2>{0.224772334f, 0.48050195f},
-std::array<float,2>{0.376971275f, 0.79920274f},
-std::array<float,2>{0.797591865f, 0.0795309767f},
-std::array<float,2>{0.594197035f, 0.850568771f},
-std::array<float,2>{0.145339668f, 0.0487166494f},
-std::array<float,2>{0.458361328f, 0.615061939f},
-std::array<float,2>{0.847124636f, 0.391051322f},
-std::array<float,2>{0.963548541f, 0.685738325f},
-std::array<float,2>{0.358017325f, 0.361537933f},
-std::array<float,2>{0.123912826f, 0.900149822f},
-std::array<float,2>{0.625820875f, 0.24797678f},
-std::array<float,2>{0.807909071f, 0.957754135f},
-std::array<float,2>{0.384923428f, 0.15081875f},
-std::array<float,2>{0.232956782f, 0.741093159f},
-std::array<float,2>{0.523974299f, 0.28727895f},
-std::array<float,2>{0.713262141f, 0.559780538f},
-std::array<float,2>{0.0515152141f, 0.456503361f},
-std::array<float,2>{0.302264005f, 0.775879502f},
-std::array<float,2>{0.904559553f, 0.0992752537f},
-std::array<float,2>{0.667555153f, 0.90939337f},
-std::array<float,2>{0.0668414012f, 0.195121914f},
-std::array<float,2>{0.326276213f, 0.630967557f},
-std::array<float,2>{0.996872604f, 0.329502106f},
-std::array<float,2>{0.824275792f, 0.566912889f},
-std::array<float,2>{0.479019195f, 0.432529688f},
-std::array<float,2>{0.18395713f, 0.839381754f},
-std::array<float,2>{0.579742551f, 0.0153983906f},
-std::array<float,2>{0.920719326f, 0.805019975f},
-std::array<float,2>{0.276468635f, 0.0921916589f},
-std::array<float,2>{0.00870670192f, 0.51705569f},
-std::array<float,2>{0.722744167f, 0.472768307f},
-std::array<float,2>{0.537777543f, 0.698483288f},
-std::array<float,2>{0.202722877f, 0.264429361f},
-std::array<float,2>{0.436935961f, 0.978977978f},
-std::array<float,2>{0.75404501f, 0.184507862f},
-std::array<float,2>{0.50459069f, 0.992823541f},
-std::array<float,2>{0.248361006f, 0.167145282f},
-std::array<float,2>{0.393664539f, 0.713116169f},
-std::array<float,2>{0.784188032f, 0.27795434f},
-std::array<float,2>{0.887726665f, 0.512212336f},
-std::array<float,2>{0.2911053f, 0.498104095f},
-std::array<float,2>{0.0372546762f, 0.787158191f},
-std::array<float,2>{0.688612223f, 0.0633358881f},
-std::array<float,2>{0.862062395f, 0.818583667f},
-std::array<float,2>{0.446083307f, 0.0300494339f},
-std::array<float,2>{0.140623927f, 0.584734559f},
-std::array<float,2>{0.610787809f, 0.412430793f},
-std::array<float,2>{0.644559741f, 0.6525352f},
-std::array<float,2>{0.105598554f, 0.326353788f},
-std::array<float,2>{0.374872684f, 0.928105772f},
-std::array<float,2>{0.939721882f, 0.209899738f},
-std::array<float,2>{0.739521682f, 0.760481417f},
-std::array<float,2>{0.0204536524f, 0.118862763f},
-std::array<float,2>{0.26331991f, 0.544070959f},
-std::array<float,2>{0.937105417f, 0.451096624f},
-std::array<float,2>{0.767109752f, 0.732989073f},
-std::array<float,2>{0.411549628f, 0.31222412f},
-std::array<float,2>{0.217629939f, 0.938462198f},
-std::array<float,2>{0.559714556f, 0.13783738f},
-std::array<float,2>{0.981201053f, 0.875059068f},
-std::array<float,2>{0.330222875f, 0.224149063f},
-std::array<float,2>{0.0868643969f, 0.664299309f},
-std::array<float,2>{0.672595143f, 0.350265861f},
-std::array<float,2>{0.573590994f, 0.594253957f},
-std::array<float,2>{0.167308852f, 0.380280316f},
-std::array<float,2>{0.491697013f, 0.864542127f},
-std::array<float,2>{0.837211132f, 0.0330890641f}}
\ No newline at end of file
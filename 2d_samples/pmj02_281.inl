@@ -1,4096 +0,0 @@
-{std::array<float,2>{0.611557484f, 0.111898392f},
-std::array<float,2>{0.0122003211f, 0.733973086f},
-std::array<float,2>{0.896651387f, 0.763360381f},
-std::array<float,2>{0.475049198f, 0.384189665f},
-std::array<float,2>{0.863640964f, 0.299029469f},
-std::array<float,2>{0.300867468f, 0.943260074f},
-std::array<float,2>{0.629444718f, 0.571123838f},
-std::array<float,2>{0.16695559f, 0.129906178f},
-std::array<float,2>{0.988299489f, 0.240200534f},
-std::array<float,2>{0.433225632f, 0.5583601f},
-std::array<float,2>{0.528891742f, 0.909512937f},
-std::array<float,2>{0.108514816f, 0.338348061f},
-std::array<float,2>{0.691634238f, 0.492093295f},
-std::array<float,2>{0.246157706f, 0.859054685f},
-std::array<float,2>{0.760881722f, 0.625834227f},
-std::array<float,2>{0.325645089f, 0.0140007362f},
-std::array<float,2>{0.679125309f, 0.182191819f},
-std::array<float,2>{0.142133072f, 0.617219627f},
-std::array<float,2>{0.832960308f, 0.97088635f},
-std::array<float,2>{0.279432595f, 0.256523281f},
-std::array<float,2>{0.910085857f, 0.434803605f},
-std::array<float,2>{0.459721208f, 0.795930862f},
-std::array<float,2>{0.573875368f, 0.690735459f},
-std::array<float,2>{0.0597111844f, 0.0757112205f},
-std::array<float,2>{0.793680727f, 0.0591799952f},
-std::array<float,2>{0.36157304f, 0.675450385f},
-std::array<float,2>{0.726606727f, 0.819114804f},
-std::array<float,2>{0.216333181f, 0.467254549f},
-std::array<float,2>{0.541039288f, 0.351327449f},
-std::array<float,2>{0.0916998237f, 0.902535737f},
-std::array<float,2>{0.943662584f, 0.518173575f},
-std::array<float,2>{0.404465497f, 0.188261345f},
-std::array<float,2>{0.511547327f, 0.208657444f},
-std::array<float,2>{0.112865925f, 0.50902158f},
-std::array<float,2>{0.981455445f, 0.879013479f},
-std::array<float,2>{0.409961611f, 0.361601532f},
-std::array<float,2>{0.766072273f, 0.448758513f},
-std::array<float,2>{0.336621284f, 0.838087678f},
-std::array<float,2>{0.706736565f, 0.668666303f},
-std::array<float,2>{0.221270949f, 0.034305416f},
-std::array<float,2>{0.879465401f, 0.0888961777f},
-std::array<float,2>{0.486503661f, 0.713403225f},
-std::array<float,2>{0.602802396f, 0.811427355f},
-std::array<float,2>{0.0209431108f, 0.421494603f},
-std::array<float,2>{0.642331898f, 0.275454253f},
-std::array<float,2>{0.185787156f, 0.98886168f},
-std::array<float,2>{0.847732246f, 0.608407199f},
-std::array<float,2>{0.282156646f, 0.158467874f},
-std::array<float,2>{0.741115689f, 0.0277494229f},
-std::array<float,2>{0.194127679f, 0.649532616f},
-std::array<float,2>{0.801444709f, 0.868443251f},
-std::array<float,2>{0.355972469f, 0.477389127f},
-std::array<float,2>{0.955877244f, 0.317169875f},
-std::array<float,2>{0.386216938f, 0.925690472f},
-std::array<float,2>{0.549979568f, 0.541684985f},
-std::array<float,2>{0.0733123869f, 0.225751892f},
-std::array<float,2>{0.814130783f, 0.149218708f},
-std::array<float,2>{0.252369374f, 0.588796139f},
-std::array<float,2>{0.667058647f, 0.960243762f},
-std::array<float,2>{0.130767912f, 0.293661863f},
-std::array<float,2>{0.589449048f, 0.398528606f},
-std::array<float,2>{0.0331081264f, 0.770717621f},
-std::array<float,2>{0.931260467f, 0.741370559f},
-std::array<float,2>{0.437846661f, 0.106858447f},
-std::array<float,2>{0.561208427f, 0.0429891907f},
-std::array<float,2>{0.0699394941f, 0.659184396f},
-std::array<float,2>{0.96857959f, 0.830172658f},
-std::array<float,2>{0.377147704f, 0.44354555f},
-std::array<float,2>{0.805752873f, 0.368502021f},
-std::array<float,2>{0.3492845f, 0.886920154f},
-std::array<float,2>{0.747054756f, 0.505262971f},
-std::array<float,2>{0.198012412f, 0.212367728f},
-std::array<float,2>{0.922179937f, 0.170911476f},
-std::array<float,2>{0.449678093f, 0.59723562f},
-std::array<float,2>{0.58573246f, 0.998114228f},
-std::array<float,2>{0.0465281121f, 0.266511083f},
-std::array<float,2>{0.657337666f, 0.410068661f},
-std::array<float,2>{0.133406132f, 0.80454129f},
-std::array<float,2>{0.826100409f, 0.708118618f},
-std::array<float,2>{0.262622058f, 0.0810376778f},
-std::array<float,2>{0.718502223f, 0.231053606f},
-std::array<float,2>{0.228717983f, 0.533232987f},
-std::array<float,2>{0.778692722f, 0.931691468f},
-std::array<float,2>{0.335888714f, 0.324676901f},
-std::array<float,2>{0.975281715f, 0.473348916f},
-std::array<float,2>{0.419951499f, 0.863698721f},
-std::array<float,2>{0.503772914f, 0.642778993f},
-std::array<float,2>{0.121135868f, 0.0165434051f},
-std::array<float,2>{0.853414893f, 0.0961952582f},
-std::array<float,2>{0.291657299f, 0.748091638f},
-std::array<float,2>{0.652328074f, 0.776713133f},
-std::array<float,2>{0.175233752f, 0.394880652f},
-std::array<float,2>{0.599818468f, 0.28306964f},
-std::array<float,2>{0.0253034029f, 0.962117136f},
-std::array<float,2>{0.89019829f, 0.58530122f},
-std::array<float,2>{0.499893397f, 0.146862224f},
-std::array<float,2>{0.569738507f, 0.140160546f},
-std::array<float,2>{0.0506021306f, 0.569210827f},
-std::array<float,2>{0.919974625f, 0.952017069f},
-std::array<float,2>{0.468354881f, 0.308191746f},
-std::array<float,2>{0.843011677f, 0.376291662f},
-std::array<float,2>{0.266621798f, 0.754048705f},
-std::array<float,2>{0.684567332f, 0.720059633f},
-std::array<float,2>{0.149188787f, 0.122592345f},
-std::array<float,2>{0.950969398f, 0.000449308776f},
-std::array<float,2>{0.392403215f, 0.637259126f},
-std::array<float,2>{0.534812272f, 0.844684124f},
-std::array<float,2>{0.0784458593f, 0.499368012f},
-std::array<float,2>{0.721088707f, 0.331139088f},
-std::array<float,2>{0.203579545f, 0.919012129f},
-std::array<float,2>{0.784558415f, 0.550619602f},
-std::array<float,2>{0.374897927f, 0.243138209f},
-std::array<float,2>{0.633156121f, 0.0660805032f},
-std::array<float,2>{0.159295946f, 0.700831652f},
-std::array<float,2>{0.874527514f, 0.786448181f},
-std::array<float,2>{0.306750566f, 0.422980517f},
-std::array<float,2>{0.903625429f, 0.261745125f},
-std::array<float,2>{0.481402785f, 0.978227794f},
-std::array<float,2>{0.62292093f, 0.613493741f},
-std::array<float,2>{0.00383690326f, 0.171932414f},
-std::array<float,2>{0.752646387f, 0.202784106f},
-std::array<float,2>{0.314521372f, 0.529686749f},
-std::array<float,2>{0.698632956f, 0.896762013f},
-std::array<float,2>{0.240273878f, 0.355603188f},
-std::array<float,2>{0.521521747f, 0.455326766f},
-std::array<float,2>{0.0990964547f, 0.824740767f},
-std::array<float,2>{0.994084656f, 0.683794796f},
-std::array<float,2>{0.425578445f, 0.0534030534f},
-std::array<float,2>{0.527266145f, 0.0835437849f},
-std::array<float,2>{0.104575664f, 0.703833103f},
-std::array<float,2>{0.985954106f, 0.800073564f},
-std::array<float,2>{0.435617715f, 0.413938463f},
-std::array<float,2>{0.763768435f, 0.271224409f},
-std::array<float,2>{0.321283668f, 0.993020713f},
-std::array<float,2>{0.689929724f, 0.600515783f},
-std::array<float,2>{0.245070517f, 0.165386245f},
-std::array<float,2>{0.893338323f, 0.217703834f},
-std::array<float,2>{0.470986754f, 0.503698766f},
-std::array<float,2>{0.613301277f, 0.886200547f},
-std::array<float,2>{0.0117168669f, 0.371908426f},
-std::array<float,2>{0.627463341f, 0.43872866f},
-std::array<float,2>{0.171502024f, 0.835652232f},
-std::array<float,2>{0.862198949f, 0.662510097f},
-std::array<float,2>{0.29742521f, 0.0426806733f},
-std::array<float,2>{0.73099041f, 0.141570672f},
-std::array<float,2>{0.213578299f, 0.581453681f},
-std::array<float,2>{0.792722642f, 0.967482626f},
-std::array<float,2>{0.366882116f, 0.285547584f},
-std::array<float,2>{0.937707841f, 0.394118965f},
-std::array<float,2>{0.401457101f, 0.780935526f},
-std::array<float,2>{0.543527424f, 0.745083988f},
-std::array<float,2>{0.0868152902f, 0.0987229124f},
-std::array<float,2>{0.831327021f, 0.0227606352f},
-std::array<float,2>{0.274392843f, 0.644731581f},
-std::array<float,2>{0.672774315f, 0.862763524f},
-std::array<float,2>{0.145222083f, 0.472499073f},
-std::array<float,2>{0.577150881f, 0.322924137f},
-std::array<float,2>{0.056854099f, 0.936351478f},
-std::array<float,2>{0.914039433f, 0.536826849f},
-std::array<float,2>{0.455850154f, 0.23018384f},
-std::array<float,2>{0.60697937f, 0.249705613f},
-std::array<float,2>{0.0188868567f, 0.553727865f},
-std::array<float,2>{0.878129959f, 0.915306747f},
-std::array<float,2>{0.490391761f, 0.334870815f},
-std::array<float,2>{0.847334802f, 0.495453984f},
-std::array<float,2>{0.288809419f, 0.847738028f},
-std::array<float,2>{0.646824718f, 0.635262966f},
-std::array<float,2>{0.180312395f, 0.0044202935f},
-std::array<float,2>{0.979342937f, 0.117388107f},
-std::array<float,2>{0.411171168f, 0.726091087f},
-std::array<float,2>{0.514165223f, 0.752306223f},
-std::array<float,2>{0.115870953f, 0.38036111f},
-std::array<float,2>{0.709620118f, 0.309005171f},
-std::array<float,2>{0.224415779f, 0.945851147f},
-std::array<float,2>{0.770810544f, 0.566299915f},
-std::array<float,2>{0.34122628f, 0.135658696f},
-std::array<float,2>{0.669576049f, 0.0500001535f},
-std::array<float,2>{0.125730231f, 0.679703951f},
-std::array<float,2>{0.817752004f, 0.823113382f},
-std::array<float,2>{0.256700456f, 0.459632665f},
-std::array<float,2>{0.937109411f, 0.352762729f},
-std::array<float,2>{0.442032605f, 0.892429054f},
-std::array<float,2>{0.591792941f, 0.524721384f},
-std::array<float,2>{0.0376029238f, 0.197796315f},
-std::array<float,2>{0.800385892f, 0.177030131f},
-std::array<float,2>{0.353881985f, 0.612838984f},
-std::array<float,2>{0.737278819f, 0.981930435f},
-std::array<float,2>{0.189210474f, 0.260873795f},
-std::array<float,2>{0.553054035f, 0.428416729f},
-std::array<float,2>{0.0769077092f, 0.783877552f},
-std::array<float,2>{0.960675478f, 0.69842875f},
-std::array<float,2>{0.38940683f, 0.0683423579f},
-std::array<float,2>{0.579991102f, 0.00892923586f},
-std::array<float,2>{0.0411890447f, 0.631312907f},
-std::array<float,2>{0.929347873f, 0.852872252f},
-std::array<float,2>{0.448136598f, 0.487996221f},
-std::array<float,2>{0.821509004f, 0.341452777f},
-std::array<float,2>{0.258815616f, 0.912086189f},
-std::array<float,2>{0.661824763f, 0.560707152f},
-std::array<float,2>{0.138976559f, 0.237853512f},
-std::array<float,2>{0.963256955f, 0.128261104f},
-std::array<float,2>{0.380302995f, 0.576145291f},
-std::array<float,2>{0.555040896f, 0.938118696f},
-std::array<float,2>{0.0663247332f, 0.304014325f},
-std::array<float,2>{0.74411881f, 0.389121085f},
-std::array<float,2>{0.202194825f, 0.75879097f},
-std::array<float,2>{0.80936861f, 0.729166448f},
-std::array<float,2>{0.347117633f, 0.116345339f},
-std::array<float,2>{0.655898154f, 0.194347471f},
-std::array<float,2>{0.179176882f, 0.52311784f},
-std::array<float,2>{0.858540714f, 0.898936093f},
-std::array<float,2>{0.295981646f, 0.344615281f},
-std::array<float,2>{0.885090232f, 0.464324057f},
-std::array<float,2>{0.493403673f, 0.816220105f},
-std::array<float,2>{0.597212195f, 0.679022253f},
-std::array<float,2>{0.0295494013f, 0.0558394939f},
-std::array<float,2>{0.775162876f, 0.0720643625f},
-std::array<float,2>{0.329516023f, 0.692189753f},
-std::array<float,2>{0.713612676f, 0.789903343f},
-std::array<float,2>{0.230991647f, 0.433380365f},
-std::array<float,2>{0.50746274f, 0.250117958f},
-std::array<float,2>{0.120669775f, 0.976467788f},
-std::array<float,2>{0.970643997f, 0.624374509f},
-std::array<float,2>{0.415763676f, 0.187093705f},
-std::array<float,2>{0.536899686f, 0.162788406f},
-std::array<float,2>{0.0855337381f, 0.603507459f},
-std::array<float,2>{0.948771834f, 0.987139463f},
-std::array<float,2>{0.398293793f, 0.278435707f},
-std::array<float,2>{0.786449432f, 0.415385664f},
-std::array<float,2>{0.368437678f, 0.807623923f},
-std::array<float,2>{0.725251615f, 0.718588412f},
-std::array<float,2>{0.209869683f, 0.0915880203f},
-std::array<float,2>{0.915598214f, 0.0377717018f},
-std::array<float,2>{0.461246401f, 0.667742968f},
-std::array<float,2>{0.563831925f, 0.841071248f},
-std::array<float,2>{0.0525536425f, 0.450945407f},
-std::array<float,2>{0.681878269f, 0.365272105f},
-std::array<float,2>{0.154109851f, 0.875574946f},
-std::array<float,2>{0.837551415f, 0.5147596f},
-std::array<float,2>{0.27074948f, 0.204394892f},
-std::array<float,2>{0.699338913f, 0.104216941f},
-std::array<float,2>{0.236454204f, 0.738209009f},
-std::array<float,2>{0.755282462f, 0.766216457f},
-std::array<float,2>{0.318286926f, 0.402973413f},
-std::array<float,2>{0.999432564f, 0.291549236f},
-std::array<float,2>{0.42704016f, 0.953268886f},
-std::array<float,2>{0.515729547f, 0.590029359f},
-std::array<float,2>{0.0959418863f, 0.154771313f},
-std::array<float,2>{0.870891213f, 0.221408293f},
-std::array<float,2>{0.310093105f, 0.545185626f},
-std::array<float,2>{0.638647199f, 0.927159011f},
-std::array<float,2>{0.162982941f, 0.315821499f},
-std::array<float,2>{0.618275583f, 0.483431667f},
-std::array<float,2>{0.00702795992f, 0.872676373f},
-std::array<float,2>{0.900154769f, 0.653063893f},
-std::array<float,2>{0.478819042f, 0.0245496295f},
-std::array<float,2>{0.572254002f, 0.0769853145f},
-std::array<float,2>{0.0624268204f, 0.68902564f},
-std::array<float,2>{0.907089233f, 0.793072999f},
-std::array<float,2>{0.458245546f, 0.435592383f},
-std::array<float,2>{0.834289312f, 0.254630357f},
-std::array<float,2>{0.279055446f, 0.970374823f},
-std::array<float,2>{0.676126659f, 0.619758189f},
-std::array<float,2>{0.143870458f, 0.180148587f},
-std::array<float,2>{0.941554606f, 0.190912038f},
-std::array<float,2>{0.402382374f, 0.516711593f},
-std::array<float,2>{0.539402664f, 0.905483723f},
-std::array<float,2>{0.0932064652f, 0.349594146f},
-std::array<float,2>{0.7303707f, 0.465112388f},
-std::array<float,2>{0.21734263f, 0.81707269f},
-std::array<float,2>{0.795033991f, 0.673329175f},
-std::array<float,2>{0.360226899f, 0.0621275119f},
-std::array<float,2>{0.6315853f, 0.13168405f},
-std::array<float,2>{0.164729282f, 0.574170291f},
-std::array<float,2>{0.865477681f, 0.943393707f},
-std::array<float,2>{0.302928388f, 0.29738909f},
-std::array<float,2>{0.895128071f, 0.385557383f},
-std::array<float,2>{0.473747343f, 0.764481604f},
-std::array<float,2>{0.610319316f, 0.731395543f},
-std::array<float,2>{0.0145136006f, 0.111229837f},
-std::array<float,2>{0.75928992f, 0.0125238532f},
-std::array<float,2>{0.326264441f, 0.628607571f},
-std::array<float,2>{0.694310129f, 0.855843246f},
-std::array<float,2>{0.248227179f, 0.489969343f},
-std::array<float,2>{0.529931307f, 0.336776584f},
-std::array<float,2>{0.105660394f, 0.906278014f},
-std::array<float,2>{0.991590798f, 0.555413306f},
-std::array<float,2>{0.431609809f, 0.241610751f},
-std::array<float,2>{0.547578037f, 0.223655283f},
-std::array<float,2>{0.0709221214f, 0.539248288f},
-std::array<float,2>{0.953152359f, 0.923643947f},
-std::array<float,2>{0.383131295f, 0.318400323f},
-std::array<float,2>{0.803337395f, 0.480373353f},
-std::array<float,2>{0.358003408f, 0.869400084f},
-std::array<float,2>{0.738467038f, 0.65043658f},
-std::array<float,2>{0.192598224f, 0.0300219227f},
-std::array<float,2>{0.933298111f, 0.107939802f},
-std::array<float,2>{0.440490484f, 0.740222156f},
-std::array<float,2>{0.587575436f, 0.771906614f},
-std::array<float,2>{0.0332120731f, 0.401314199f},
-std::array<float,2>{0.665391922f, 0.2955392f},
-std::array<float,2>{0.131924167f, 0.957510412f},
-std::array<float,2>{0.814982355f, 0.587346971f},
-std::array<float,2>{0.251206309f, 0.150619879f},
-std::array<float,2>{0.70486939f, 0.0318280272f},
-std::array<float,2>{0.219995916f, 0.671302617f},
-std::array<float,2>{0.769170105f, 0.83641243f},
-std::array<float,2>{0.339832753f, 0.447099358f},
-std::array<float,2>{0.982765198f, 0.360054165f},
-std::array<float,2>{0.406325907f, 0.881745219f},
-std::array<float,2>{0.508801401f, 0.51074934f},
-std::array<float,2>{0.109865785f, 0.209811956f},
-std::array<float,2>{0.849758744f, 0.157828286f},
-std::array<float,2>{0.284922749f, 0.60641402f},
-std::array<float,2>{0.643472433f, 0.991945446f},
-std::array<float,2>{0.184163138f, 0.274718285f},
-std::array<float,2>{0.604672849f, 0.419368416f},
-std::array<float,2>{0.0229554493f, 0.808607221f},
-std::array<float,2>{0.881299198f, 0.712225437f},
-std::array<float,2>{0.484737128f, 0.087692827f},
-std::array<float,2>{0.500851512f, 0.0183262266f},
-std::array<float,2>{0.123579793f, 0.640871465f},
-std::array<float,2>{0.973421812f, 0.865364313f},
-std::array<float,2>{0.419404119f, 0.476522624f},
-std::array<float,2>{0.779999733f, 0.327042639f},
-std::array<float,2>{0.332650453f, 0.930234909f},
-std::array<float,2>{0.714967549f, 0.533179581f},
-std::array<float,2>{0.228450462f, 0.233972743f},
-std::array<float,2>{0.886984646f, 0.145213217f},
-std::array<float,2>{0.496829659f, 0.583144844f},
-std::array<float,2>{0.597739458f, 0.96336937f},
-std::array<float,2>{0.0254385937f, 0.283911437f},
-std::array<float,2>{0.649351001f, 0.398312449f},
-std::array<float,2>{0.173212141f, 0.774568975f},
-std::array<float,2>{0.853776634f, 0.74671787f},
-std::array<float,2>{0.289460778f, 0.0946953893f},
-std::array<float,2>{0.748086393f, 0.213309884f},
-std::array<float,2>{0.195840791f, 0.506868303f},
-std::array<float,2>{0.807871938f, 0.890511572f},
-std::array<float,2>{0.350235283f, 0.369888335f},
-std::array<float,2>{0.965189457f, 0.44178322f},
-std::array<float,2>{0.376066506f, 0.829706848f},
-std::array<float,2>{0.560393155f, 0.656413078f},
-std::array<float,2>{0.0672928765f, 0.0450433418f},
-std::array<float,2>{0.827185094f, 0.0793410093f},
-std::array<float,2>{0.265232801f, 0.709920883f},
-std::array<float,2>{0.658840537f, 0.802412629f},
-std::array<float,2>{0.135832727f, 0.408051997f},
-std::array<float,2>{0.582099259f, 0.26781404f},
-std::array<float,2>{0.0436470546f, 0.996772408f},
-std::array<float,2>{0.924963117f, 0.595124066f},
-std::array<float,2>{0.45244202f, 0.169699356f},
-std::array<float,2>{0.624013305f, 0.174216717f},
-std::array<float,2>{0.000555108592f, 0.616330504f},
-std::array<float,2>{0.905148089f, 0.980033576f},
-std::array<float,2>{0.482610196f, 0.264673322f},
-std::array<float,2>{0.871540785f, 0.424178183f},
-std::array<float,2>{0.305753112f, 0.787864149f},
-std::array<float,2>{0.63525629f, 0.70236069f},
-std::array<float,2>{0.156928331f, 0.0639724955f},
-std::array<float,2>{0.99420929f, 0.0519242994f},
-std::array<float,2>{0.422861546f, 0.685646653f},
-std::array<float,2>{0.520621419f, 0.827221096f},
-std::array<float,2>{0.100011401f, 0.454747468f},
-std::array<float,2>{0.6955778f, 0.358219922f},
-std::array<float,2>{0.238394648f, 0.894870222f},
-std::array<float,2>{0.751309216f, 0.529225409f},
-std::array<float,2>{0.312628597f, 0.200146943f},
-std::array<float,2>{0.687097073f, 0.12355487f},
-std::array<float,2>{0.151964232f, 0.722211957f},
-std::array<float,2>{0.840617716f, 0.756482244f},
-std::array<float,2>{0.268256098f, 0.37826252f},
-std::array<float,2>{0.918675184f, 0.305871934f},
-std::array<float,2>{0.466189981f, 0.949410796f},
-std::array<float,2>{0.566746056f, 0.566648185f},
-std::array<float,2>{0.0471238159f, 0.137313589f},
-std::array<float,2>{0.782613099f, 0.244174287f},
-std::array<float,2>{0.371221185f, 0.548365712f},
-std::array<float,2>{0.720052361f, 0.920848668f},
-std::array<float,2>{0.20595035f, 0.329346031f},
-std::array<float,2>{0.532150388f, 0.497669786f},
-std::array<float,2>{0.080452092f, 0.845707119f},
-std::array<float,2>{0.951372385f, 0.639324903f},
-std::array<float,2>{0.393042028f, 0.00322195492f},
-std::array<float,2>{0.54581809f, 0.100042239f},
-std::array<float,2>{0.0880001858f, 0.743505001f},
-std::array<float,2>{0.940638423f, 0.77899152f},
-std::array<float,2>{0.398856878f, 0.391271681f},
-std::array<float,2>{0.789675355f, 0.288296252f},
-std::array<float,2>{0.363407344f, 0.966429293f},
-std::array<float,2>{0.732593954f, 0.579251647f},
-std::array<float,2>{0.212460652f, 0.144451037f},
-std::array<float,2>{0.911177397f, 0.227067202f},
-std::array<float,2>{0.453559846f, 0.537712514f},
-std::array<float,2>{0.576161921f, 0.933988869f},
-std::array<float,2>{0.0550025068f, 0.322042316f},
-std::array<float,2>{0.675486207f, 0.468873769f},
-std::array<float,2>{0.14827776f, 0.860516965f},
-std::array<float,2>{0.829175234f, 0.646825194f},
-std::array<float,2>{0.275947988f, 0.0208350457f},
-std::array<float,2>{0.688128948f, 0.167814553f},
-std::array<float,2>{0.243175477f, 0.598787725f},
-std::array<float,2>{0.761738181f, 0.995321989f},
-std::array<float,2>{0.323153615f, 0.272344679f},
-std::array<float,2>{0.986651242f, 0.410761565f},
-std::array<float,2>{0.434075356f, 0.797474921f},
-std::array<float,2>{0.525232077f, 0.705757439f},
-std::array<float,2>{0.102494396f, 0.085219346f},
-std::array<float,2>{0.860841215f, 0.0399589092f},
-std::array<float,2>{0.299338907f, 0.661759377f},
-std::array<float,2>{0.625193059f, 0.832739234f},
-std::array<float,2>{0.16852358f, 0.440199643f},
-std::array<float,2>{0.615478039f, 0.374545157f},
-std::array<float,2>{0.0090972092f, 0.884669065f},
-std::array<float,2>{0.890805781f, 0.500077784f},
-std::array<float,2>{0.469247639f, 0.216601551f},
-std::array<float,2>{0.593559384f, 0.19665058f},
-std::array<float,2>{0.0354234315f, 0.525651038f},
-std::array<float,2>{0.934035003f, 0.892939806f},
-std::array<float,2>{0.443808675f, 0.354282886f},
-std::array<float,2>{0.818864703f, 0.458687156f},
-std::array<float,2>{0.25470978f, 0.821947515f},
-std::array<float,2>{0.670149982f, 0.682641625f},
-std::array<float,2>{0.128622219f, 0.0474435687f},
-std::array<float,2>{0.958916128f, 0.0699595734f},
-std::array<float,2>{0.387873501f, 0.697090983f},
-std::array<float,2>{0.551996827f, 0.78233403f},
-std::array<float,2>{0.0743179992f, 0.427382618f},
-std::array<float,2>{0.736068964f, 0.259642184f},
-std::array<float,2>{0.189818949f, 0.982486546f},
-std::array<float,2>{0.79781431f, 0.611236572f},
-std::array<float,2>{0.353097498f, 0.177762479f},
-std::array<float,2>{0.645840168f, 0.00658698147f},
-std::array<float,2>{0.181729868f, 0.633033574f},
-std::array<float,2>{0.844631791f, 0.851184785f},
-std::array<float,2>{0.285296053f, 0.492650568f},
-std::array<float,2>{0.87637651f, 0.332273155f},
-std::array<float,2>{0.489615947f, 0.917112947f},
-std::array<float,2>{0.608134031f, 0.550992429f},
-std::array<float,2>{0.0157182161f, 0.247313321f},
-std::array<float,2>{0.771922708f, 0.134617552f},
-std::array<float,2>{0.343322843f, 0.562621951f},
-std::array<float,2>{0.707939386f, 0.947933614f},
-std::array<float,2>{0.225460336f, 0.310820192f},
-std::array<float,2>{0.512430072f, 0.382675171f},
-std::array<float,2>{0.114599019f, 0.751453459f},
-std::array<float,2>{0.976985395f, 0.723205388f},
-std::array<float,2>{0.413348049f, 0.120715588f},
-std::array<float,2>{0.595147491f, 0.0568169057f},
-std::array<float,2>{0.0280786604f, 0.677284002f},
-std::array<float,2>{0.883941948f, 0.814051211f},
-std::array<float,2>{0.49595657f, 0.46110028f},
-std::array<float,2>{0.857306719f, 0.347528696f},
-std::array<float,2>{0.29450205f, 0.901095331f},
-std::array<float,2>{0.653168142f, 0.519622445f},
-std::array<float,2>{0.177268952f, 0.192266256f},
-std::array<float,2>{0.970860243f, 0.184936553f},
-std::array<float,2>{0.416248947f, 0.621632457f},
-std::array<float,2>{0.505613148f, 0.972951233f},
-std::array<float,2>{0.117458224f, 0.25226146f},
-std::array<float,2>{0.712876081f, 0.430798829f},
-std::array<float,2>{0.234149992f, 0.791912556f},
-std::array<float,2>{0.776123822f, 0.693430483f},
-std::array<float,2>{0.331926733f, 0.0729263425f},
-std::array<float,2>{0.662632167f, 0.23474361f},
-std::array<float,2>{0.137987673f, 0.559004664f},
-std::array<float,2>{0.823801398f, 0.913192809f},
-std::array<float,2>{0.260355026f, 0.342988998f},
-std::array<float,2>{0.926637948f, 0.485150903f},
-std::array<float,2>{0.44620502f, 0.853676438f},
-std::array<float,2>{0.580583334f, 0.630467117f},
-std::array<float,2>{0.0397450179f, 0.0102913892f},
-std::array<float,2>{0.811408699f, 0.113441966f},
-std::array<float,2>{0.345033586f, 0.727883458f},
-std::array<float,2>{0.745503962f, 0.760050893f},
-std::array<float,2>{0.20057933f, 0.388367325f},
-std::array<float,2>{0.557178676f, 0.301804483f},
-std::array<float,2>{0.0643845573f, 0.93970263f},
-std::array<float,2>{0.96176362f, 0.576603353f},
-std::array<float,2>{0.38139388f, 0.126295775f},
-std::array<float,2>{0.518387496f, 0.153239548f},
-std::array<float,2>{0.0953133106f, 0.593404412f},
-std::array<float,2>{0.997775257f, 0.955756009f},
-std::array<float,2>{0.428816348f, 0.289117306f},
-std::array<float,2>{0.757807672f, 0.404840469f},
-std::array<float,2>{0.319061279f, 0.767834544f},
-std::array<float,2>{0.701316416f, 0.736206412f},
-std::array<float,2>{0.235225916f, 0.10319414f},
-std::array<float,2>{0.90212357f, 0.025913721f},
-std::array<float,2>{0.477801323f, 0.655639231f},
-std::array<float,2>{0.620722234f, 0.873512983f},
-std::array<float,2>{0.00475014932f, 0.48062706f},
-std::array<float,2>{0.640470088f, 0.312849402f},
-std::array<float,2>{0.161648557f, 0.928840518f},
-std::array<float,2>{0.868730485f, 0.544917643f},
-std::array<float,2>{0.311687887f, 0.220463067f},
-std::array<float,2>{0.724393725f, 0.0935960114f},
-std::array<float,2>{0.207952276f, 0.715868115f},
-std::array<float,2>{0.788473964f, 0.805487275f},
-std::array<float,2>{0.370000541f, 0.416900158f},
-std::array<float,2>{0.946850896f, 0.281044245f},
-std::array<float,2>{0.39493835f, 0.984572232f},
-std::array<float,2>{0.537254333f, 0.604023516f},
-std::array<float,2>{0.0836763829f, 0.161636472f},
-std::array<float,2>{0.839210689f, 0.2062857f},
-std::array<float,2>{0.271699607f, 0.512330234f},
-std::array<float,2>{0.681490004f, 0.878520906f},
-std::array<float,2>{0.155816063f, 0.36376664f},
-std::array<float,2>{0.565170407f, 0.451359719f},
-std::array<float,2>{0.053614378f, 0.841893911f},
-std::array<float,2>{0.917098463f, 0.664676249f},
-std::array<float,2>{0.462949961f, 0.0356257893f},
-std::array<float,2>{0.602405965f, 0.086320892f},
-std::array<float,2>{0.0201884247f, 0.711390197f},
-std::array<float,2>{0.880669653f, 0.810418487f},
-std::array<float,2>{0.487600684f, 0.418799639f},
-std::array<float,2>{0.849131763f, 0.273645967f},
-std::array<float,2>{0.282754183f, 0.990763664f},
-std::array<float,2>{0.641592085f, 0.606856585f},
-std::array<float,2>{0.187290177f, 0.157215387f},
-std::array<float,2>{0.980913758f, 0.209995002f},
-std::array<float,2>{0.408789009f, 0.509769678f},
-std::array<float,2>{0.509853601f, 0.882131994f},
-std::array<float,2>{0.112248562f, 0.360879719f},
-std::array<float,2>{0.705861211f, 0.445853442f},
-std::array<float,2>{0.222276926f, 0.8371225f},
-std::array<float,2>{0.767329872f, 0.669926107f},
-std::array<float,2>{0.337140709f, 0.0322323963f},
-std::array<float,2>{0.666024268f, 0.151548102f},
-std::array<float,2>{0.129819825f, 0.586690068f},
-std::array<float,2>{0.813021064f, 0.958033562f},
-std::array<float,2>{0.253248453f, 0.29630214f},
-std::array<float,2>{0.930536926f, 0.4017196f},
-std::array<float,2>{0.439030886f, 0.772937536f},
-std::array<float,2>{0.588151991f, 0.739159942f},
-std::array<float,2>{0.0313265584f, 0.108834349f},
-std::array<float,2>{0.802352428f, 0.0305888001f},
-std::array<float,2>{0.356711686f, 0.652192235f},
-std::array<float,2>{0.741535842f, 0.871009886f},
-std::array<float,2>{0.194884345f, 0.479477972f},
-std::array<float,2>{0.54971236f, 0.319631308f},
-std::array<float,2>{0.0730165541f, 0.922617614f},
-std::array<float,2>{0.956441939f, 0.540612638f},
-std::array<float,2>{0.384990275f, 0.223280266f},
-std::array<float,2>{0.528240025f, 0.240351826f},
-std::array<float,2>{0.107517451f, 0.556539237f},
-std::array<float,2>{0.989959061f, 0.907524586f},
-std::array<float,2>{0.432493687f, 0.337094069f},
-std::array<float,2>{0.760702312f, 0.489103466f},
-std::array<float,2>{0.32475546f, 0.856691658f},
-std::array<float,2>{0.69264549f, 0.62712729f},
-std::array<float,2>{0.247597232f, 0.0130700748f},
-std::array<float,2>{0.898193598f, 0.109894104f},
-std::array<float,2>{0.476382226f, 0.732184887f},
-std::array<float,2>{0.613159537f, 0.764745951f},
-std::array<float,2>{0.0134172393f, 0.386288375f},
-std::array<float,2>{0.630556941f, 0.297864169f},
-std::array<float,2>{0.167181313f, 0.944886804f},
-std::array<float,2>{0.865166545f, 0.572284043f},
-std::array<float,2>{0.301862717f, 0.131875098f},
-std::array<float,2>{0.728351951f, 0.0608575195f},
-std::array<float,2>{0.215048f, 0.672420084f},
-std::array<float,2>{0.794748366f, 0.818013072f},
-std::array<float,2>{0.363130718f, 0.466496319f},
-std::array<float,2>{0.945073843f, 0.348608583f},
-std::array<float,2>{0.405545294f, 0.904469192f},
-std::array<float,2>{0.542277277f, 0.515874207f},
-std::array<float,2>{0.0900960267f, 0.189653039f},
-std::array<float,2>{0.833752275f, 0.181597948f},
-std::array<float,2>{0.280711114f, 0.620959759f},
-std::array<float,2>{0.677836418f, 0.969533145f},
-std::array<float,2>{0.141046897f, 0.255723923f},
-std::array<float,2>{0.573172092f, 0.437456757f},
-std::array<float,2>{0.0588162206f, 0.794902384f},
-std::array<float,2>{0.908450067f, 0.687839031f},
-std::array<float,2>{0.46078524f, 0.0778004378f},
-std::array<float,2>{0.533575296f, 0.00198487309f},
-std::array<float,2>{0.07954593f, 0.640235603f},
-std::array<float,2>{0.949581385f, 0.847202897f},
-std::array<float,2>{0.390909106f, 0.496783584f},
-std::array<float,2>{0.783837736f, 0.328584015f},
-std::array<float,2>{0.373625189f, 0.921056449f},
-std::array<float,2>{0.722184181f, 0.547454119f},
-std::array<float,2>{0.204240739f, 0.245511591f},
-std::array<float,2>{0.920941591f, 0.138248891f},
-std::array<float,2>{0.467603564f, 0.567450285f},
-std::array<float,2>{0.569051743f, 0.950816214f},
-std::array<float,2>{0.0494772419f, 0.3049196f},
-std::array<float,2>{0.684936583f, 0.377130568f},
-std::array<float,2>{0.149786845f, 0.757557034f},
-std::array<float,2>{0.841965139f, 0.721579671f},
-std::array<float,2>{0.266139805f, 0.124895565f},
-std::array<float,2>{0.697818875f, 0.201094404f},
-std::array<float,2>{0.241561726f, 0.528093517f},
-std::array<float,2>{0.753582418f, 0.895778179f},
-std::array<float,2>{0.316284209f, 0.358562827f},
-std::array<float,2>{0.992742062f, 0.453791231f},
-std::array<float,2>{0.424709767f, 0.826308668f},
-std::array<float,2>{0.522690356f, 0.68668431f},
-std::array<float,2>{0.0977110863f, 0.0517480373f},
-std::array<float,2>{0.873579621f, 0.0629115105f},
-std::array<float,2>{0.307831258f, 0.701642334f},
-std::array<float,2>{0.634544194f, 0.788600266f},
-std::array<float,2>{0.15834412f, 0.425310284f},
-std::array<float,2>{0.621820033f, 0.264635324f},
-std::array<float,2>{0.00198160158f, 0.97875458f},
-std::array<float,2>{0.90236187f, 0.616122365f},
-std::array<float,2>{0.481777012f, 0.175265789f},
-std::array<float,2>{0.584601045f, 0.168433711f},
-std::array<float,2>{0.0451646671f, 0.59402585f},
-std::array<float,2>{0.923413455f, 0.997233808f},
-std::array<float,2>{0.450961322f, 0.268932432f},
-std::array<float,2>{0.824587643f, 0.406711251f},
-std::array<float,2>{0.26301387f, 0.801698148f},
-std::array<float,2>{0.656947136f, 0.710907698f},
-std::array<float,2>{0.134101287f, 0.0787528306f},
-std::array<float,2>{0.967010617f, 0.0463948101f},
-std::array<float,2>{0.378354371f, 0.657299876f},
-std::array<float,2>{0.561968803f, 0.828144193f},
-std::array<float,2>{0.0688922703f, 0.44256705f},
-std::array<float,2>{0.747136712f, 0.370723963f},
-std::array<float,2>{0.198287115f, 0.88920784f},
-std::array<float,2>{0.805240452f, 0.506216228f},
-std::array<float,2>{0.347831637f, 0.214573354f},
-std::array<float,2>{0.650699675f, 0.0948547795f},
-std::array<float,2>{0.174299151f, 0.747083187f},
-std::array<float,2>{0.851734936f, 0.774244547f},
-std::array<float,2>{0.292569727f, 0.397072434f},
-std::array<float,2>{0.889031053f, 0.284497589f},
-std::array<float,2>{0.498887599f, 0.964795172f},
-std::array<float,2>{0.600875258f, 0.582454741f},
-std::array<float,2>{0.0242051017f, 0.146026269f},
-std::array<float,2>{0.777457356f, 0.232555076f},
-std::array<float,2>{0.334684223f, 0.531960487f},
-std::array<float,2>{0.716844916f, 0.931469858f},
-std::array<float,2>{0.229672313f, 0.327154905f},
-std::array<float,2>{0.502496302f, 0.475229859f},
-std::array<float,2>{0.122714944f, 0.866471648f},
-std::array<float,2>{0.976074159f, 0.642064929f},
-std::array<float,2>{0.421164036f, 0.019428689f},
-std::array<float,2>{0.514736056f, 0.119924895f},
-std::array<float,2>{0.116659261f, 0.724485457f},
-std::array<float,2>{0.979975522f, 0.750960827f},
-std::array<float,2>{0.411090136f, 0.381776065f},
-std::array<float,2>{0.770482659f, 0.312412828f},
-std::array<float,2>{0.340580583f, 0.948500216f},
-std::array<float,2>{0.710753798f, 0.563996911f},
-std::array<float,2>{0.223102689f, 0.133719236f},
-std::array<float,2>{0.877630413f, 0.246482208f},
-std::array<float,2>{0.492016375f, 0.55250293f},
-std::array<float,2>{0.606293619f, 0.916090548f},
-std::array<float,2>{0.0179494526f, 0.333750039f},
-std::array<float,2>{0.647765875f, 0.493643105f},
-std::array<float,2>{0.18134585f, 0.850033224f},
-std::array<float,2>{0.846583784f, 0.633985162f},
-std::array<float,2>{0.287512898f, 0.00734184356f},
-std::array<float,2>{0.738276303f, 0.178942159f},
-std::array<float,2>{0.187867016f, 0.6097489f},
-std::array<float,2>{0.799590647f, 0.983985424f},
-std::array<float,2>{0.354854196f, 0.258450001f},
-std::array<float,2>{0.959393084f, 0.426665276f},
-std::array<float,2>{0.389707029f, 0.782142699f},
-std::array<float,2>{0.554603219f, 0.695586324f},
-std::array<float,2>{0.0779804811f, 0.069110997f},
-std::array<float,2>{0.816933811f, 0.0484540127f},
-std::array<float,2>{0.257800221f, 0.68241787f},
-std::array<float,2>{0.668190241f, 0.820483685f},
-std::array<float,2>{0.126308188f, 0.457407236f},
-std::array<float,2>{0.590381145f, 0.354696304f},
-std::array<float,2>{0.0386163816f, 0.89356643f},
-std::array<float,2>{0.93576169f, 0.526978791f},
-std::array<float,2>{0.442807734f, 0.196138874f},
-std::array<float,2>{0.615147889f, 0.215615347f},
-std::array<float,2>{0.00977106579f, 0.501547277f},
-std::array<float,2>{0.894133091f, 0.88291949f},
-std::array<float,2>{0.472654909f, 0.373742342f},
-std::array<float,2>{0.862738192f, 0.440719903f},
-std::array<float,2>{0.298690766f, 0.833579183f},
-std::array<float,2>{0.628132582f, 0.660628617f},
-std::array<float,2>{0.170328975f, 0.0406928957f},
-std::array<float,2>{0.98532933f, 0.0848742351f},
-std::array<float,2>{0.43661803f, 0.706439137f},
-std::array<float,2>{0.526072741f, 0.798821926f},
-std::array<float,2>{0.103899561f, 0.411355048f},
-std::array<float,2>{0.690735221f, 0.27335304f},
-std::array<float,2>{0.245244667f, 0.994782925f},
-std::array<float,2>{0.765196562f, 0.59860599f},
-std::array<float,2>{0.321298659f, 0.166050866f},
-std::array<float,2>{0.673498094f, 0.020135032f},
-std::array<float,2>{0.145948797f, 0.647550344f},
-std::array<float,2>{0.830849528f, 0.860131323f},
-std::array<float,2>{0.275049478f, 0.470404565f},
-std::array<float,2>{0.913076758f, 0.320537031f},
-std::array<float,2>{0.456238955f, 0.935114264f},
-std::array<float,2>{0.576930583f, 0.538811803f},
-std::array<float,2>{0.057795804f, 0.227642328f},
-std::array<float,2>{0.791599691f, 0.143426761f},
-std::array<float,2>{0.365845889f, 0.578794897f},
-std::array<float,2>{0.731553733f, 0.964989126f},
-std::array<float,2>{0.214365557f, 0.287167788f},
-std::array<float,2>{0.544538915f, 0.39248544f},
-std::array<float,2>{0.0870276392f, 0.777925789f},
-std::array<float,2>{0.938685179f, 0.742845953f},
-std::array<float,2>{0.401084304f, 0.101288348f},
-std::array<float,2>{0.562514544f, 0.0366667472f},
-std::array<float,2>{0.0515354164f, 0.665561914f},
-std::array<float,2>{0.914491296f, 0.843064129f},
-std::array<float,2>{0.462312222f, 0.452208698f},
-std::array<float,2>{0.836675584f, 0.364751369f},
-std::array<float,2>{0.270132691f, 0.877391517f},
-std::array<float,2>{0.682769835f, 0.513369799f},
-std::array<float,2>{0.152678624f, 0.20546408f},
-std::array<float,2>{0.948007345f, 0.160935447f},
-std::array<float,2>{0.397203147f, 0.604619086f},
-std::array<float,2>{0.535737455f, 0.985871434f},
-std::array<float,2>{0.0841736943f, 0.279978901f},
-std::array<float,2>{0.726396918f, 0.4173702f},
-std::array<float,2>{0.210682765f, 0.80572331f},
-std::array<float,2>{0.785308421f, 0.714919269f},
-std::array<float,2>{0.36733532f, 0.0918858498f},
-std::array<float,2>{0.636848748f, 0.218840107f},
-std::array<float,2>{0.164008766f, 0.543431222f},
-std::array<float,2>{0.869275093f, 0.928272903f},
-std::array<float,2>{0.30883798f, 0.313872874f},
-std::array<float,2>{0.898961306f, 0.482103676f},
-std::array<float,2>{0.48027727f, 0.874316931f},
-std::array<float,2>{0.617188036f, 0.655153632f},
-std::array<float,2>{0.00611775042f, 0.0270628873f},
-std::array<float,2>{0.753920078f, 0.101913773f},
-std::array<float,2>{0.317081809f, 0.735046148f},
-std::array<float,2>{0.70083642f, 0.769096732f},
-std::array<float,2>{0.237778217f, 0.405956805f},
-std::array<float,2>{0.516794145f, 0.290984392f},
-std::array<float,2>{0.0969154164f, 0.956902266f},
-std::array<float,2>{0.998766482f, 0.592219472f},
-std::array<float,2>{0.426661164f, 0.153766394f},
-std::array<float,2>{0.556604624f, 0.125668034f},
-std::array<float,2>{0.0645342991f, 0.578123212f},
-std::array<float,2>{0.963973999f, 0.94106257f},
-std::array<float,2>{0.379372269f, 0.30149585f},
-std::array<float,2>{0.8100214f, 0.387046367f},
-std::array<float,2>{0.345987856f, 0.760820389f},
-std::array<float,2>{0.742619991f, 0.726745725f},
-std::array<float,2>{0.20203419f, 0.114920147f},
-std::array<float,2>{0.928303897f, 0.0111249499f},
-std::array<float,2>{0.448346883f, 0.629457653f},
-std::array<float,2>{0.57906878f, 0.854592621f},
-std::array<float,2>{0.0422105566f, 0.485686511f},
-std::array<float,2>{0.660737097f, 0.342155606f},
-std::array<float,2>{0.140197262f, 0.912982941f},
-std::array<float,2>{0.820844889f, 0.560480058f},
-std::array<float,2>{0.258035123f, 0.235693872f},
-std::array<float,2>{0.71475172f, 0.0739591345f},
-std::array<float,2>{0.231458127f, 0.694869161f},
-std::array<float,2>{0.774264395f, 0.792307913f},
-std::array<float,2>{0.328237444f, 0.430376112f},
-std::array<float,2>{0.968998969f, 0.253176659f},
-std::array<float,2>{0.414088994f, 0.973965168f},
-std::array<float,2>{0.506749392f, 0.622666359f},
-std::array<float,2>{0.119487248f, 0.184487909f},
-std::array<float,2>{0.857782423f, 0.19310157f},
-std::array<float,2>{0.295059204f, 0.521158636f},
-std::array<float,2>{0.654513359f, 0.901853502f},
-std::array<float,2>{0.178390607f, 0.346436381f},
-std::array<float,2>{0.596351802f, 0.462536067f},
-std::array<float,2>{0.030616587f, 0.813227713f},
-std::array<float,2>{0.885973454f, 0.676014721f},
-std::array<float,2>{0.492596388f, 0.0579373576f},
-std::array<float,2>{0.586731017f, 0.106326126f},
-std::array<float,2>{0.0345585719f, 0.74063623f},
-std::array<float,2>{0.931927025f, 0.769990504f},
-std::array<float,2>{0.440244019f, 0.400044978f},
-std::array<float,2>{0.815676451f, 0.294195116f},
-std::array<float,2>{0.250496536f, 0.959614277f},
-std::array<float,2>{0.664150774f, 0.589070797f},
-std::array<float,2>{0.13148959f, 0.150331795f},
-std::array<float,2>{0.954443455f, 0.225471586f},
-std::array<float,2>{0.383895725f, 0.542664528f},
-std::array<float,2>{0.547877014f, 0.923885942f},
-std::array<float,2>{0.0717920363f, 0.318178415f},
-std::array<float,2>{0.740084231f, 0.478329211f},
-std::array<float,2>{0.192077383f, 0.867218375f},
-std::array<float,2>{0.803949237f, 0.648446441f},
-std::array<float,2>{0.358721197f, 0.028704308f},
-std::array<float,2>{0.644347727f, 0.159597412f},
-std::array<float,2>{0.184903875f, 0.608321249f},
-std::array<float,2>{0.851104021f, 0.990142167f},
-std::array<float,2>{0.283811897f, 0.276903212f},
-std::array<float,2>{0.882756829f, 0.420781881f},
-std::array<float,2>{0.485495031f, 0.811603129f},
-std::array<float,2>{0.604243755f, 0.714461565f},
-std::array<float,2>{0.0215070602f, 0.0880380124f},
-std::array<float,2>{0.767963231f, 0.0341497436f},
-std::array<float,2>{0.338660985f, 0.669875324f},
-std::array<float,2>{0.703187287f, 0.838906944f},
-std::array<float,2>{0.218953744f, 0.447490215f},
-std::array<float,2>{0.508497536f, 0.362901777f},
-std::array<float,2>{0.111327156f, 0.880823672f},
-std::array<float,2>{0.983847678f, 0.508277118f},
-std::array<float,2>{0.407610714f, 0.207150787f},
-std::array<float,2>{0.540920138f, 0.188867092f},
-std::array<float,2>{0.0918909907f, 0.518999517f},
-std::array<float,2>{0.942832291f, 0.903725505f},
-std::array<float,2>{0.403790981f, 0.350569963f},
-std::array<float,2>{0.796685755f, 0.467952043f},
-std::array<float,2>{0.361164361f, 0.819821775f},
-std::array<float,2>{0.728692174f, 0.674549341f},
-std::array<float,2>{0.218014434f, 0.0600638352f},
-std::array<float,2>{0.907301366f, 0.0744290873f},
-std::array<float,2>{0.457169443f, 0.689574718f},
-std::array<float,2>{0.570322812f, 0.79510957f},
-std::array<float,2>{0.0613575391f, 0.4335998f},
-std::array<float,2>{0.676851511f, 0.257381856f},
-std::array<float,2>{0.143482998f, 0.97247225f},
-std::array<float,2>{0.835348368f, 0.61913687f},
-std::array<float,2>{0.277390122f, 0.183285922f},
-std::array<float,2>{0.694541454f, 0.0156043004f},
-std::array<float,2>{0.249056891f, 0.626443505f},
-std::array<float,2>{0.758283556f, 0.857734919f},
-std::array<float,2>{0.327259541f, 0.490780294f},
-std::array<float,2>{0.990789413f, 0.339508325f},
-std::array<float,2>{0.429902434f, 0.908260524f},
-std::array<float,2>{0.531220794f, 0.557011843f},
-std::array<float,2>{0.106757164f, 0.239174932f},
-std::array<float,2>{0.866535306f, 0.129560784f},
-std::array<float,2>{0.304687291f, 0.57158792f},
-std::array<float,2>{0.632538795f, 0.941643476f},
-std::array<float,2>{0.165133193f, 0.300462395f},
-std::array<float,2>{0.610714972f, 0.383585781f},
-std::array<float,2>{0.0147418035f, 0.761772454f},
-std::array<float,2>{0.895671248f, 0.73339653f},
-std::array<float,2>{0.47296834f, 0.11230807f},
-std::array<float,2>{0.519983411f, 0.0541486517f},
-std::array<float,2>{0.101258606f, 0.68479985f},
-std::array<float,2>{0.995800376f, 0.825444877f},
-std::array<float,2>{0.422748476f, 0.456192434f},
-std::array<float,2>{0.750451565f, 0.357159376f},
-std::array<float,2>{0.314133555f, 0.89797765f},
-std::array<float,2>{0.696386337f, 0.530305862f},
-std::array<float,2>{0.240120694f, 0.201424778f},
-std::array<float,2>{0.905348837f, 0.173614725f},
-std::array<float,2>{0.483630151f, 0.614505589f},
-std::array<float,2>{0.624960005f, 0.977138579f},
-std::array<float,2>{0.000998455798f, 0.263273865f},
-std::array<float,2>{0.636030078f, 0.422194302f},
-std::array<float,2>{0.158005401f, 0.785247803f},
-std::array<float,2>{0.872730792f, 0.699933112f},
-std::array<float,2>{0.30550468f, 0.0647143722f},
-std::array<float,2>{0.718803823f, 0.243314475f},
-std::array<float,2>{0.206490666f, 0.549579084f},
-std::array<float,2>{0.782025635f, 0.918916464f},
-std::array<float,2>{0.373035729f, 0.330397338f},
-std::array<float,2>{0.952470005f, 0.498378962f},
-std::array<float,2>{0.394225359f, 0.845482588f},
-std::array<float,2>{0.532371342f, 0.637748897f},
-std::array<float,2>{0.0816636458f, 0.00184548227f},
-std::array<float,2>{0.840921044f, 0.121677414f},
-std::array<float,2>{0.268966049f, 0.719568849f},
-std::array<float,2>{0.685783803f, 0.755252779f},
-std::array<float,2>{0.150632679f, 0.37569207f},
-std::array<float,2>{0.567505479f, 0.307062507f},
-std::array<float,2>{0.0483527482f, 0.952157497f},
-std::array<float,2>{0.919595838f, 0.569856226f},
-std::array<float,2>{0.465362579f, 0.138895661f},
-std::array<float,2>{0.599275112f, 0.148275897f},
-std::array<float,2>{0.0269171167f, 0.584233761f},
-std::array<float,2>{0.888249874f, 0.961532593f},
-std::array<float,2>{0.497461438f, 0.281431824f},
-std::array<float,2>{0.85513401f, 0.395999014f},
-std::array<float,2>{0.29084304f, 0.77578342f},
-std::array<float,2>{0.649587929f, 0.749975979f},
-std::array<float,2>{0.172656268f, 0.096788168f},
-std::array<float,2>{0.973846793f, 0.0168048926f},
-std::array<float,2>{0.418490767f, 0.643856585f},
-std::array<float,2>{0.501777887f, 0.864957213f},
-std::array<float,2>{0.124056712f, 0.473640203f},
-std::array<float,2>{0.715982735f, 0.325414389f},
-std::array<float,2>{0.227359772f, 0.932806492f},
-std::array<float,2>{0.780502737f, 0.534971714f},
-std::array<float,2>{0.333142519f, 0.231829211f},
-std::array<float,2>{0.659225941f, 0.081091933f},
-std::array<float,2>{0.135630459f, 0.707947135f},
-std::array<float,2>{0.82671231f, 0.803018034f},
-std::array<float,2>{0.264065206f, 0.408943057f},
-std::array<float,2>{0.924498081f, 0.26668939f},
-std::array<float,2>{0.451642334f, 0.999138296f},
-std::array<float,2>{0.583369195f, 0.5963943f},
-std::array<float,2>{0.0448991694f, 0.169931516f},
-std::array<float,2>{0.807156861f, 0.211826533f},
-std::array<float,2>{0.350858122f, 0.504678905f},
-std::array<float,2>{0.749263883f, 0.88866657f},
-std::array<float,2>{0.19671835f, 0.367255211f},
-std::array<float,2>{0.558615863f, 0.444679826f},
-std::array<float,2>{0.0675866753f, 0.831968546f},
-std::array<float,2>{0.966335535f, 0.658317327f},
-std::array<float,2>{0.375308782f, 0.0440357998f},
-std::array<float,2>{0.551022053f, 0.0668211132f},
-std::array<float,2>{0.075608328f, 0.698087454f},
-std::array<float,2>{0.957321644f, 0.784491479f},
-std::array<float,2>{0.387558281f, 0.429454416f},
-std::array<float,2>{0.797861993f, 0.260043144f},
-std::array<float,2>{0.352030039f, 0.981385648f},
-std::array<float,2>{0.735269368f, 0.612078309f},
-std::array<float,2>{0.190606207f, 0.176395699f},
-std::array<float,2>{0.934694946f, 0.199173138f},
-std::array<float,2>{0.444841832f, 0.523793697f},
-std::array<float,2>{0.591897845f, 0.891151845f},
-std::array<float,2>{0.0367787927f, 0.351999193f},
-std::array<float,2>{0.671130598f, 0.460160553f},
-std::array<float,2>{0.127206177f, 0.824120283f},
-std::array<float,2>{0.819947124f, 0.681566358f},
-std::array<float,2>{0.255146533f, 0.0489377752f},
-std::array<float,2>{0.708843112f, 0.13608326f},
-std::array<float,2>{0.226145551f, 0.564808011f},
-std::array<float,2>{0.773274541f, 0.947254479f},
-std::array<float,2>{0.342392772f, 0.310525447f},
-std::array<float,2>{0.977705598f, 0.379557908f},
-std::array<float,2>{0.412654489f, 0.753056824f},
-std::array<float,2>{0.512848377f, 0.725062668f},
-std::array<float,2>{0.113439128f, 0.118486106f},
-std::array<float,2>{0.845368445f, 0.00574916368f},
-std::array<float,2>{0.286263049f, 0.636583924f},
-std::array<float,2>{0.644912541f, 0.849063993f},
-std::array<float,2>{0.183214605f, 0.494505316f},
-std::array<float,2>{0.608552456f, 0.335354298f},
-std::array<float,2>{0.0174409356f, 0.914487779f},
-std::array<float,2>{0.875264883f, 0.553561151f},
-std::array<float,2>{0.488466114f, 0.248101413f},
-std::array<float,2>{0.574963033f, 0.228519395f},
-std::array<float,2>{0.0557607152f, 0.536090612f},
-std::array<float,2>{0.910812795f, 0.936867714f},
-std::array<float,2>{0.454902649f, 0.324151039f},
-std::array<float,2>{0.828202426f, 0.471008122f},
-std::array<float,2>{0.276477188f, 0.862219036f},
-std::array<float,2>{0.674278557f, 0.645541072f},
-std::array<float,2>{0.146544874f, 0.0218897276f},
-std::array<float,2>{0.940344155f, 0.0979362503f},
-std::array<float,2>{0.399933606f, 0.745399237f},
-std::array<float,2>{0.546761155f, 0.780019522f},
-std::array<float,2>{0.0898041651f, 0.39298436f},
-std::array<float,2>{0.734351873f, 0.28618598f},
-std::array<float,2>{0.21150592f, 0.968196094f},
-std::array<float,2>{0.790742338f, 0.580949247f},
-std::array<float,2>{0.36459434f, 0.141892999f},
-std::array<float,2>{0.625995338f, 0.0418813787f},
-std::array<float,2>{0.169043005f, 0.66386795f},
-std::array<float,2>{0.859931886f, 0.834632635f},
-std::array<float,2>{0.300016195f, 0.438185513f},
-std::array<float,2>{0.892450929f, 0.372253507f},
-std::array<float,2>{0.470463157f, 0.885449529f},
-std::array<float,2>{0.616370618f, 0.502511024f},
-std::array<float,2>{0.00842359103f, 0.21857819f},
-std::array<float,2>{0.763343871f, 0.164677396f},
-std::array<float,2>{0.323915511f, 0.601131618f},
-std::array<float,2>{0.689447045f, 0.994095862f},
-std::array<float,2>{0.242708266f, 0.269578516f},
-std::array<float,2>{0.524192691f, 0.41300258f},
-std::array<float,2>{0.103119142f, 0.799212873f},
-std::array<float,2>{0.988206148f, 0.704638779f},
-std::array<float,2>{0.435013503f, 0.0827041715f},
-std::array<float,2>{0.619730532f, 0.0240446702f},
-std::array<float,2>{0.00517365476f, 0.653902411f},
-std::array<float,2>{0.900666296f, 0.871795833f},
-std::array<float,2>{0.476996541f, 0.48259303f},
-std::array<float,2>{0.867975891f, 0.314817071f},
-std::array<float,2>{0.311234653f, 0.926549971f},
-std::array<float,2>{0.638681829f, 0.546379983f},
-std::array<float,2>{0.160207421f, 0.222543165f},
-std::array<float,2>{0.99618125f, 0.155844882f},
-std::array<float,2>{0.42788586f, 0.590874076f},
-std::array<float,2>{0.518603384f, 0.954513073f},
-std::array<float,2>{0.0941397473f, 0.292631179f},
-std::array<float,2>{0.703046203f, 0.403712839f},
-std::array<float,2>{0.235775307f, 0.766957581f},
-std::array<float,2>{0.756280005f, 0.736899316f},
-std::array<float,2>{0.319922686f, 0.104845509f},
-std::array<float,2>{0.680194914f, 0.20326063f},
-std::array<float,2>{0.154727265f, 0.514424443f},
-std::array<float,2>{0.838864863f, 0.876174212f},
-std::array<float,2>{0.27297762f, 0.366342634f},
-std::array<float,2>{0.916379392f, 0.449450254f},
-std::array<float,2>{0.463929027f, 0.840205371f},
-std::array<float,2>{0.566322267f, 0.66682893f},
-std::array<float,2>{0.0545271225f, 0.0388395078f},
-std::array<float,2>{0.78722614f, 0.0900438949f},
-std::array<float,2>{0.370920628f, 0.717000484f},
-std::array<float,2>{0.723082721f, 0.807197034f},
-std::array<float,2>{0.208391324f, 0.414840758f},
-std::array<float,2>{0.538553774f, 0.278154701f},
-std::array<float,2>{0.0824233294f, 0.987963259f},
-std::array<float,2>{0.94624722f, 0.601715684f},
-std::array<float,2>{0.395729929f, 0.163591444f},
-std::array<float,2>{0.504284441f, 0.186404407f},
-std::array<float,2>{0.118823074f, 0.623557389f},
-std::array<float,2>{0.972534478f, 0.974941373f},
-std::array<float,2>{0.417238981f, 0.251450032f},
-std::array<float,2>{0.776996255f, 0.432283491f},
-std::array<float,2>{0.330819756f, 0.790390491f},
-std::array<float,2>{0.711375237f, 0.692806065f},
-std::array<float,2>{0.232628018f, 0.0704440624f},
-std::array<float,2>{0.883624911f, 0.0553720705f},
-std::array<float,2>{0.494310141f, 0.677958429f},
-std::array<float,2>{0.594524801f, 0.815054595f},
-std::array<float,2>{0.0289116185f, 0.463715553f},
-std::array<float,2>{0.653376937f, 0.345394552f},
-std::array<float,2>{0.175782785f, 0.900252342f},
-std::array<float,2>{0.856163502f, 0.522408187f},
-std::array<float,2>{0.293327481f, 0.19402042f},
-std::array<float,2>{0.744451046f, 0.115895055f},
-std::array<float,2>{0.199228287f, 0.729702353f},
-std::array<float,2>{0.811935663f, 0.758213282f},
-std::array<float,2>{0.344717592f, 0.39040795f},
-std::array<float,2>{0.962057471f, 0.303594768f},
-std::array<float,2>{0.382666737f, 0.938919842f},
-std::array<float,2>{0.558498442f, 0.574892342f},
-std::array<float,2>{0.0630842745f, 0.127599537f},
-std::array<float,2>{0.822803795f, 0.236333221f},
-std::array<float,2>{0.261288971f, 0.56214577f},
-std::array<float,2>{0.663727701f, 0.910540938f},
-std::array<float,2>{0.136881471f, 0.340282559f},
-std::array<float,2>{0.58173275f, 0.486810207f},
-std::array<float,2>{0.0402863175f, 0.852238297f},
-std::array<float,2>{0.927031696f, 0.632242382f},
-std::array<float,2>{0.446405113f, 0.00808154978f},
-std::array<float,2>{0.601145208f, 0.0976468697f},
-std::array<float,2>{0.0234993305f, 0.74906981f},
-std::array<float,2>{0.889432132f, 0.776301265f},
-std::array<float,2>{0.498352677f, 0.395926774f},
-std::array<float,2>{0.852303803f, 0.282208771f},
-std::array<float,2>{0.292160779f, 0.961171627f},
-std::array<float,2>{0.651129723f, 0.584922791f},
-std::array<float,2>{0.174406797f, 0.147597522f},
-std::array<float,2>{0.976193964f, 0.232090101f},
-std::array<float,2>{0.421692342f, 0.534599721f},
-std::array<float,2>{0.50241518f, 0.933125794f},
-std::array<float,2>{0.122198708f, 0.325893581f},
-std::array<float,2>{0.717585742f, 0.474270672f},
-std::array<float,2>{0.230442554f, 0.864333034f},
-std::array<float,2>{0.778241336f, 0.644200921f},
-std::array<float,2>{0.334306031f, 0.0172415394f},
-std::array<float,2>{0.656589806f, 0.17079334f},
-std::array<float,2>{0.134480283f, 0.59578532f},
-std::array<float,2>{0.824890852f, 0.999813676f},
-std::array<float,2>{0.26341477f, 0.267316192f},
-std::array<float,2>{0.923018396f, 0.408483684f},
-std::array<float,2>{0.450581044f, 0.803525329f},
-std::array<float,2>{0.58418709f, 0.707104027f},
-std::array<float,2>{0.0455393158f, 0.0820123628f},
-std::array<float,2>{0.805027902f, 0.0449055359f},
-std::array<float,2>{0.348536074f, 0.659051597f},
-std::array<float,2>{0.747668624f, 0.831530869f},
-std::array<float,2>{0.198946103f, 0.444825053f},
-std::array<float,2>{0.562067807f, 0.368079156f},
-std::array<float,2>{0.0684448108f, 0.887936413f},
-std::array<float,2>{0.967598081f, 0.503922164f},
-std::array<float,2>{0.378642529f, 0.211098969f},
-std::array<float,2>{0.523306906f, 0.201954469f},
-std::array<float,2>{0.0986246392f, 0.531118989f},
-std::array<float,2>{0.99222976f, 0.897866845f},
-std::array<float,2>{0.423991889f, 0.356660336f},
-std::array<float,2>{0.753215313f, 0.456649035f},
-std::array<float,2>{0.315441489f, 0.826020241f},
-std::array<float,2>{0.697431028f, 0.685282826f},
-std::array<float,2>{0.241782472f, 0.0543960631f},
-std::array<float,2>{0.903262436f, 0.0653771758f},
-std::array<float,2>{0.481959164f, 0.69928962f},
-std::array<float,2>{0.621187091f, 0.785846233f},
-std::array<float,2>{0.0027854736f, 0.42281273f},
-std::array<float,2>{0.634147227f, 0.263041466f},
-std::array<float,2>{0.158896297f, 0.976719737f},
-std::array<float,2>{0.873051167f, 0.615061939f},
-std::array<float,2>{0.308285058f, 0.173146456f},
-std::array<float,2>{0.721691191f, 0.0011208884f},
-std::array<float,2>{0.204599679f, 0.63839072f},
-std::array<float,2>{0.783357799f, 0.845175922f},
-std::array<float,2>{0.373431653f, 0.498855412f},
-std::array<float,2>{0.950122416f, 0.33096844f},
-std::array<float,2>{0.391549408f, 0.918160081f},
-std::array<float,2>{0.533920825f, 0.549055457f},
-std::array<float,2>{0.0798780024f, 0.24365291f},
-std::array<float,2>{0.842714608f, 0.139580622f},
-std::array<float,2>{0.265710294f, 0.569709241f},
-std::array<float,2>{0.685415626f, 0.952861667f},
-std::array<float,2>{0.150272444f, 0.307522744f},
-std::array<float,2>{0.568541467f, 0.375382543f},
-std::array<float,2>{0.0489179343f, 0.75560832f},
-std::array<float,2>{0.921408296f, 0.719042659f},
-std::array<float,2>{0.467183858f, 0.121399857f},
-std::array<float,2>{0.542731702f, 0.0600584298f},
-std::array<float,2>{0.0905026942f, 0.674144447f},
-std::array<float,2>{0.944442809f, 0.819879055f},
-std::array<float,2>{0.405945271f, 0.468649834f},
-std::array<float,2>{0.793984652f, 0.350024909f},
-std::array<float,2>{0.362651318f, 0.903822124f},
-std::array<float,2>{0.727577865f, 0.51935333f},
-std::array<float,2>{0.215573087f, 0.18930012f},
-std::array<float,2>{0.908765316f, 0.182712153f},
-std::array<float,2>{0.460256249f, 0.618591607f},
-std::array<float,2>{0.572456837f, 0.971933782f},
-std::array<float,2>{0.0595240556f, 0.257148802f},
-std::array<float,2>{0.678539455f, 0.434348375f},
-std::array<float,2>{0.141369954f, 0.795470417f},
-std::array<float,2>{0.833308518f, 0.690158665f},
-std::array<float,2>{0.281230211f, 0.0747302473f},
-std::array<float,2>{0.693072975f, 0.238574937f},
-std::array<float,2>{0.247489229f, 0.557358623f},
-std::array<float,2>{0.760237753f, 0.909175038f},
-std::array<float,2>{0.3245897f, 0.339342415f},
-std::array<float,2>{0.989683926f, 0.490486354f},
-std::array<float,2>{0.432083786f, 0.858341396f},
-std::array<float,2>{0.527818203f, 0.62676537f},
-std::array<float,2>{0.10834717f, 0.014715774f},
-std::array<float,2>{0.864599288f, 0.113090605f},
-std::array<float,2>{0.302302688f, 0.73275125f},
-std::array<float,2>{0.630016685f, 0.762224138f},
-std::array<float,2>{0.167798027f, 0.38282609f},
-std::array<float,2>{0.612512767f, 0.299876571f},
-std::array<float,2>{0.0130496118f, 0.942040205f},
-std::array<float,2>{0.89774102f, 0.57202208f},
-std::array<float,2>{0.475696057f, 0.129111424f},
-std::array<float,2>{0.588475287f, 0.149435088f},
-std::array<float,2>{0.0318765156f, 0.589562297f},
-std::array<float,2>{0.929957688f, 0.959081054f},
-std::array<float,2>{0.43863821f, 0.294457227f},
-std::array<float,2>{0.81254679f, 0.399674386f},
-std::array<float,2>{0.253652364f, 0.770247459f},
-std::array<float,2>{0.6666345f, 0.741196871f},
-std::array<float,2>{0.129328847f, 0.105575286f},
-std::array<float,2>{0.956727862f, 0.0288366415f},
-std::array<float,2>{0.385510027f, 0.649237037f},
-std::array<float,2>{0.549275517f, 0.867901921f},
-std::array<float,2>{0.0725172386f, 0.477789223f},
-std::array<float,2>{0.74177736f, 0.317795753f},
-std::array<float,2>{0.194711223f, 0.924480915f},
-std::array<float,2>{0.802205086f, 0.542171538f},
-std::array<float,2>{0.357372373f, 0.225090638f},
-std::array<float,2>{0.640639126f, 0.0883993283f},
-std::array<float,2>{0.186634451f, 0.714260161f},
-std::array<float,2>{0.848633349f, 0.812301636f},
-std::array<float,2>{0.282447189f, 0.420109093f},
-std::array<float,2>{0.87990135f, 0.276610553f},
-std::array<float,2>{0.488031447f, 0.989291131f},
-std::array<float,2>{0.601856053f, 0.607442737f},
-std::array<float,2>{0.0198376998f, 0.159883574f},
-std::array<float,2>{0.766689003f, 0.207744464f},
-std::array<float,2>{0.337555587f, 0.508647501f},
-std::array<float,2>{0.705130994f, 0.880051792f},
-std::array<float,2>{0.221868783f, 0.362686723f},
-std::array<float,2>{0.510381639f, 0.448219657f},
-std::array<float,2>{0.11141938f, 0.839599311f},
-std::array<float,2>{0.981367648f, 0.669315398f},
-std::array<float,2>{0.408415347f, 0.033326596f},
-std::array<float,2>{0.506179273f, 0.0711871609f},
-std::array<float,2>{0.119726412f, 0.693078637f},
-std::array<float,2>{0.969252408f, 0.790626884f},
-std::array<float,2>{0.414807528f, 0.431728303f},
-std::array<float,2>{0.773745477f, 0.251941383f},
-std::array<float,2>{0.328758448f, 0.975404739f},
-std::array<float,2>{0.714190245f, 0.623141646f},
-std::array<float,2>{0.231988057f, 0.185722023f},
-std::array<float,2>{0.886316001f, 0.19373405f},
-std::array<float,2>{0.492937595f, 0.521835625f},
-std::array<float,2>{0.596083522f, 0.899444997f},
-std::array<float,2>{0.0310187228f, 0.345214427f},
-std::array<float,2>{0.654853284f, 0.463377982f},
-std::array<float,2>{0.177879393f, 0.814541399f},
-std::array<float,2>{0.858093202f, 0.678241313f},
-std::array<float,2>{0.295444369f, 0.0550891347f},
-std::array<float,2>{0.743062437f, 0.126966864f},
-std::array<float,2>{0.201325968f, 0.574559391f},
-std::array<float,2>{0.810106933f, 0.939207733f},
-std::array<float,2>{0.34656319f, 0.303070635f},
-std::array<float,2>{0.964574993f, 0.389947653f},
-std::array<float,2>{0.379547775f, 0.758698285f},
-std::array<float,2>{0.55589366f, 0.730039179f},
-std::array<float,2>{0.0653439537f, 0.115455613f},
-std::array<float,2>{0.820442438f, 0.0084642563f},
-std::array<float,2>{0.258704692f, 0.632484019f},
-std::array<float,2>{0.660365283f, 0.851741433f},
-std::array<float,2>{0.139902055f, 0.486980081f},
-std::array<float,2>{0.578493595f, 0.34047848f},
-std::array<float,2>{0.0426081717f, 0.910676897f},
-std::array<float,2>{0.928074121f, 0.561980367f},
-std::array<float,2>{0.449038595f, 0.236939073f},
-std::array<float,2>{0.618114829f, 0.221754462f},
-std::array<float,2>{0.00644119224f, 0.546436965f},
-std::array<float,2>{0.898512781f, 0.926080406f},
-std::array<float,2>{0.479969263f, 0.315122128f},
-std::array<float,2>{0.869789422f, 0.483188063f},
-std::array<float,2>{0.309214175f, 0.871483386f},
-std::array<float,2>{0.637466431f, 0.653419554f},
-std::array<float,2>{0.163144097f, 0.0234646834f},
-std::array<float,2>{0.998199284f, 0.105185635f},
-std::array<float,2>{0.425952971f, 0.736795425f},
-std::array<float,2>{0.517513275f, 0.767297566f},
-std::array<float,2>{0.0972606614f, 0.404162019f},
-std::array<float,2>{0.700237274f, 0.292267501f},
-std::array<float,2>{0.237818122f, 0.954910994f},
-std::array<float,2>{0.754462242f, 0.591789007f},
-std::array<float,2>{0.31687659f, 0.155667052f},
-std::array<float,2>{0.683208823f, 0.0383431353f},
-std::array<float,2>{0.153210327f, 0.666202962f},
-std::array<float,2>{0.836051524f, 0.840569973f},
-std::array<float,2>{0.269927412f, 0.45003593f},
-std::array<float,2>{0.915004015f, 0.366995454f},
-std::array<float,2>{0.462649941f, 0.876840532f},
-std::array<float,2>{0.563285768f, 0.513870895f},
-std::array<float,2>{0.0508868024f, 0.203646213f},
-std::array<float,2>{0.785944641f, 0.163305864f},
-std::array<float,2>{0.36776188f, 0.602160335f},
-std::array<float,2>{0.725955427f, 0.987649322f},
-std::array<float,2>{0.210221961f, 0.277494311f},
-std::array<float,2>{0.535459876f, 0.414258748f},
-std::array<float,2>{0.0845693722f, 0.806850016f},
-std::array<float,2>{0.947636247f, 0.717475772f},
-std::array<float,2>{0.396702886f, 0.0908053443f},
-std::array<float,2>{0.576367497f, 0.022296356f},
-std::array<float,2>{0.0585204884f, 0.646143973f},
-std::array<float,2>{0.912375033f, 0.861735225f},
-std::array<float,2>{0.456865609f, 0.471473187f},
-std::array<float,2>{0.830174983f, 0.323269695f},
-std::array<float,2>{0.27455169f, 0.937380254f},
-std::array<float,2>{0.672889352f, 0.535549521f},
-std::array<float,2>{0.146436915f, 0.229430422f},
-std::array<float,2>{0.939053774f, 0.142440051f},
-std::array<float,2>{0.400842905f, 0.580497801f},
-std::array<float,2>{0.544413745f, 0.968436062f},
-std::array<float,2>{0.0876386762f, 0.287007719f},
-std::array<float,2>{0.732214212f, 0.393471062f},
-std::array<float,2>{0.214006633f, 0.77949816f},
-std::array<float,2>{0.791398704f, 0.745982587f},
-std::array<float,2>{0.365499914f, 0.0983684734f},
-std::array<float,2>{0.628562033f, 0.218049243f},
-std::array<float,2>{0.170811117f, 0.502001643f},
-std::array<float,2>{0.86308825f, 0.88516736f},
-std::array<float,2>{0.297858268f, 0.372676224f},
-std::array<float,2>{0.893666983f, 0.437557012f},
-std::array<float,2>{0.472155452f, 0.833994091f},
-std::array<float,2>{0.614641488f, 0.663140476f},
-std::array<float,2>{0.0105960611f, 0.0412192717f},
-std::array<float,2>{0.764743745f, 0.0825062692f},
-std::array<float,2>{0.321787059f, 0.704544961f},
-std::array<float,2>{0.691192508f, 0.79965359f},
-std::array<float,2>{0.245851263f, 0.412437975f},
-std::array<float,2>{0.525694728f, 0.270132482f},
-std::array<float,2>{0.104275659f, 0.993285894f},
-std::array<float,2>{0.984537125f, 0.600866318f},
-std::array<float,2>{0.437431246f, 0.164171904f},
-std::array<float,2>{0.553759396f, 0.176040024f},
-std::array<float,2>{0.077168487f, 0.611418426f},
-std::array<float,2>{0.9595927f, 0.980878353f},
-std::array<float,2>{0.390218288f, 0.260282695f},
-std::array<float,2>{0.799267888f, 0.428976029f},
-std::array<float,2>{0.355388343f, 0.78504771f},
-std::array<float,2>{0.737326026f, 0.697344601f},
-std::array<float,2>{0.18847315f, 0.0671419203f},
-std::array<float,2>{0.936071277f, 0.0494483262f},
-std::array<float,2>{0.442982465f, 0.680796683f},
-std::array<float,2>{0.59015274f, 0.823346496f},
-std::array<float,2>{0.0384771898f, 0.460906565f},
-std::array<float,2>{0.668473482f, 0.352056324f},
-std::array<float,2>{0.126667351f, 0.891040087f},
-std::array<float,2>{0.81686753f, 0.523956656f},
-std::array<float,2>{0.257011086f, 0.198597565f},
-std::array<float,2>{0.710012257f, 0.118814625f},
-std::array<float,2>{0.223632589f, 0.725507855f},
-std::array<float,2>{0.769770801f, 0.7537992f},
-std::array<float,2>{0.340194851f, 0.379260689f},
-std::array<float,2>{0.980066955f, 0.309846431f},
-std::array<float,2>{0.410168022f, 0.94639504f},
-std::array<float,2>{0.515467763f, 0.565124214f},
-std::array<float,2>{0.116933525f, 0.136302009f},
-std::array<float,2>{0.846068263f, 0.248979852f},
-std::array<float,2>{0.287974745f, 0.553165972f},
-std::array<float,2>{0.64831531f, 0.914874613f},
-std::array<float,2>{0.180938438f, 0.335857004f},
-std::array<float,2>{0.605782628f, 0.495031148f},
-std::array<float,2>{0.0184234381f, 0.849404395f},
-std::array<float,2>{0.87730974f, 0.636217058f},
-std::array<float,2>{0.49160248f, 0.00516073219f},
-std::array<float,2>{0.583821595f, 0.0785158053f},
-std::array<float,2>{0.0440207459f, 0.710358024f},
-std::array<float,2>{0.924148738f, 0.800924242f},
-std::array<float,2>{0.452053547f, 0.406775504f},
-std::array<float,2>{0.826524794f, 0.26938045f},
-std::array<float,2>{0.264494628f, 0.997806311f},
-std::array<float,2>{0.659852266f, 0.594264746f},
-std::array<float,2>{0.135060027f, 0.168699592f},
-std::array<float,2>{0.966066301f, 0.214109391f},
-std::array<float,2>{0.375715047f, 0.506722927f},
-std::array<float,2>{0.559109926f, 0.888834953f},
-std::array<float,2>{0.0682241544f, 0.370389104f},
-std::array<float,2>{0.749895692f, 0.443259895f},
-std::array<float,2>{0.19718045f, 0.828722715f},
-std::array<float,2>{0.806675613f, 0.658046842f},
-std::array<float,2>{0.351515353f, 0.0459066406f},
-std::array<float,2>{0.64999342f, 0.145979986f},
-std::array<float,2>{0.172139212f, 0.582990527f},
-std::array<float,2>{0.85487932f, 0.964332342f},
-std::array<float,2>{0.290120125f, 0.285025656f},
-std::array<float,2>{0.888168573f, 0.396759957f},
-std::array<float,2>{0.497593969f, 0.773601532f},
-std::array<float,2>{0.598845243f, 0.747672141f},
-std::array<float,2>{0.0266997367f, 0.0954968184f},
-std::array<float,2>{0.780873775f, 0.0187491011f},
-std::array<float,2>{0.333518296f, 0.642307878f},
-std::array<float,2>{0.716386795f, 0.866746426f},
-std::array<float,2>{0.226742998f, 0.474692136f},
-std::array<float,2>{0.501036167f, 0.328011513f},
-std::array<float,2>{0.124799751f, 0.93099612f},
-std::array<float,2>{0.974520147f, 0.531284153f},
-std::array<float,2>{0.418236107f, 0.233261272f},
-std::array<float,2>{0.532966435f, 0.245606646f},
-std::array<float,2>{0.0815132931f, 0.547204375f},
-std::array<float,2>{0.952927768f, 0.921589315f},
-std::array<float,2>{0.393645257f, 0.32890448f},
-std::array<float,2>{0.781714857f, 0.496445388f},
-std::array<float,2>{0.37242046f, 0.846779406f},
-std::array<float,2>{0.719434202f, 0.639788866f},
-std::array<float,2>{0.20686841f, 0.00287425658f},
-std::array<float,2>{0.919378042f, 0.124242246f},
-std::array<float,2>{0.465020537f, 0.720843494f},
-std::array<float,2>{0.568183064f, 0.757084906f},
-std::array<float,2>{0.0481140874f, 0.377681941f},
-std::array<float,2>{0.686095893f, 0.305613309f},
-std::array<float,2>{0.151139975f, 0.950613081f},
-std::array<float,2>{0.841483891f, 0.567993164f},
-std::array<float,2>{0.269465029f, 0.137970984f},
-std::array<float,2>{0.696810722f, 0.0507832356f},
-std::array<float,2>{0.239472419f, 0.687156916f},
-std::array<float,2>{0.750973821f, 0.826786458f},
-std::array<float,2>{0.313574702f, 0.453428864f},
-std::array<float,2>{0.995443761f, 0.359285623f},
-std::array<float,2>{0.422064245f, 0.89616102f},
-std::array<float,2>{0.520454407f, 0.527669072f},
-std::array<float,2>{0.10074842f, 0.200601771f},
-std::array<float,2>{0.872421026f, 0.17555064f},
-std::array<float,2>{0.304939359f, 0.615592301f},
-std::array<float,2>{0.636331677f, 0.979043305f},
-std::array<float,2>{0.157288566f, 0.263941675f},
-std::array<float,2>{0.624189317f, 0.425014377f},
-std::array<float,2>{0.00162475219f, 0.788295507f},
-std::array<float,2>{0.906064212f, 0.701993227f},
-std::array<float,2>{0.48399204f, 0.0631703585f},
-std::array<float,2>{0.530717909f, 0.0132545391f},
-std::array<float,2>{0.106990106f, 0.627648056f},
-std::array<float,2>{0.990651011f, 0.857114017f},
-std::array<float,2>{0.430516213f, 0.488711655f},
-std::array<float,2>{0.758688033f, 0.337821275f},
-std::array<float,2>{0.327899665f, 0.90797466f},
-std::array<float,2>{0.695211828f, 0.555666924f},
-std::array<float,2>{0.249834433f, 0.241103381f},
-std::array<float,2>{0.896352172f, 0.132745177f},
-std::array<float,2>{0.473588079f, 0.572772026f},
-std::array<float,2>{0.61089015f, 0.944626451f},
-std::array<float,2>{0.0151692005f, 0.298349142f},
-std::array<float,2>{0.632032216f, 0.385955334f},
-std::array<float,2>{0.165579677f, 0.765333235f},
-std::array<float,2>{0.866904855f, 0.731565773f},
-std::array<float,2>{0.304129064f, 0.109672621f},
-std::array<float,2>{0.729426742f, 0.189949989f},
-std::array<float,2>{0.218453392f, 0.516230524f},
-std::array<float,2>{0.796224892f, 0.905025899f},
-std::array<float,2>{0.360651404f, 0.347785592f},
-std::array<float,2>{0.942938089f, 0.466029435f},
-std::array<float,2>{0.40383485f, 0.817838848f},
-std::array<float,2>{0.540413976f, 0.671937406f},
-std::array<float,2>{0.0923605338f, 0.0613194406f},
-std::array<float,2>{0.835567296f, 0.0776252598f},
-std::array<float,2>{0.278129816f, 0.688192129f},
-std::array<float,2>{0.677674174f, 0.794187903f},
-std::array<float,2>{0.142629832f, 0.436763138f},
-std::array<float,2>{0.571066439f, 0.255040795f},
-std::array<float,2>{0.0609637722f, 0.968810081f},
-std::array<float,2>{0.908073902f, 0.6203897f},
-std::array<float,2>{0.457757026f, 0.181123942f},
-std::array<float,2>{0.60378772f, 0.156460926f},
-std::array<float,2>{0.022191776f, 0.607219815f},
-std::array<float,2>{0.881955087f, 0.990572751f},
-std::array<float,2>{0.485934108f, 0.274170548f},
-std::array<float,2>{0.851060331f, 0.418309718f},
-std::array<float,2>{0.283434987f, 0.809652328f},
-std::array<float,2>{0.643594623f, 0.711901963f},
-std::array<float,2>{0.185123861f, 0.086909689f},
-std::array<float,2>{0.984084845f, 0.0329612494f},
-std::array<float,2>{0.407787055f, 0.670520663f},
-std::array<float,2>{0.508009672f, 0.83744359f},
-std::array<float,2>{0.110366985f, 0.445626438f},
-std::array<float,2>{0.703704119f, 0.360629678f},
-std::array<float,2>{0.219459862f, 0.882599533f},
-std::array<float,2>{0.768368483f, 0.510739505f},
-std::array<float,2>{0.33797887f, 0.210908994f},
-std::array<float,2>{0.664848685f, 0.108979352f},
-std::array<float,2>{0.130877897f, 0.738457859f},
-std::array<float,2>{0.816333711f, 0.773150802f},
-std::array<float,2>{0.250250489f, 0.401881456f},
-std::array<float,2>{0.932503879f, 0.296439558f},
-std::array<float,2>{0.439730316f, 0.958577156f},
-std::array<float,2>{0.586179793f, 0.585964978f},
-std::array<float,2>{0.0347169079f, 0.151932627f},
-std::array<float,2>{0.804561675f, 0.222789586f},
-std::array<float,2>{0.359069794f, 0.54052192f},
-std::array<float,2>{0.739674568f, 0.921990037f},
-std::array<float,2>{0.191875905f, 0.320085019f},
-std::array<float,2>{0.548824728f, 0.478927225f},
-std::array<float,2>{0.0717112944f, 0.870553076f},
-std::array<float,2>{0.954735756f, 0.651376307f},
-std::array<float,2>{0.384684712f, 0.0312134698f},
-std::array<float,2>{0.557777822f, 0.114642419f},
-std::array<float,2>{0.0629723743f, 0.727441549f},
-std::array<float,2>{0.96276015f, 0.761673272f},
-std::array<float,2>{0.382166237f, 0.387414724f},
-std::array<float,2>{0.812313914f, 0.300999254f},
-std::array<float,2>{0.343915075f, 0.940854847f},
-std::array<float,2>{0.744780004f, 0.577380836f},
-std::array<float,2>{0.199779168f, 0.125020593f},
-std::array<float,2>{0.927506745f, 0.236207694f},
-std::array<float,2>{0.446814328f, 0.560006499f},
-std::array<float,2>{0.581486046f, 0.912153959f},
-std::array<float,2>{0.0409763344f, 0.342393249f},
-std::array<float,2>{0.663158715f, 0.486043334f},
-std::array<float,2>{0.137326807f, 0.855348349f},
-std::array<float,2>{0.822453856f, 0.629254818f},
-std::array<float,2>{0.260996282f, 0.0114852916f},
-std::array<float,2>{0.7116552f, 0.183830008f},
-std::array<float,2>{0.233364016f, 0.622178316f},
-std::array<float,2>{0.776574135f, 0.9742468f},
-std::array<float,2>{0.330430031f, 0.253897488f},
-std::array<float,2>{0.971930087f, 0.429882288f},
-std::array<float,2>{0.417644501f, 0.792940676f},
-std::array<float,2>{0.504639566f, 0.694506705f},
-std::array<float,2>{0.118545264f, 0.0733615085f},
-std::array<float,2>{0.855772555f, 0.058450114f},
-std::array<float,2>{0.293810487f, 0.676283896f},
-std::array<float,2>{0.653851449f, 0.812669277f},
-std::array<float,2>{0.176688701f, 0.462195873f},
-std::array<float,2>{0.593916416f, 0.346105933f},
-std::array<float,2>{0.0285250936f, 0.902170122f},
-std::array<float,2>{0.883120239f, 0.520954847f},
-std::array<float,2>{0.49468115f, 0.192795426f},
-std::array<float,2>{0.565712571f, 0.205902398f},
-std::array<float,2>{0.0539241582f, 0.512832046f},
-std::array<float,2>{0.91661644f, 0.877576947f},
-std::array<float,2>{0.464665145f, 0.36451596f},
-std::array<float,2>{0.838266194f, 0.452932477f},
-std::array<float,2>{0.272907555f, 0.843479693f},
-std::array<float,2>{0.679911911f, 0.665079415f},
-std::array<float,2>{0.155179173f, 0.0361683965f},
-std::array<float,2>{0.945487142f, 0.0924233869f},
-std::array<float,2>{0.396086276f, 0.715450108f},
-std::array<float,2>{0.538837016f, 0.806523442f},
-std::array<float,2>{0.0828801766f, 0.417616248f},
-std::array<float,2>{0.723488569f, 0.279773682f},
-std::array<float,2>{0.208656833f, 0.98543185f},
-std::array<float,2>{0.788074911f, 0.605430901f},
-std::array<float,2>{0.370370924f, 0.160338208f},
-std::array<float,2>{0.63918525f, 0.0264304876f},
-std::array<float,2>{0.161116272f, 0.654501319f},
-std::array<float,2>{0.86764282f, 0.874546766f},
-std::array<float,2>{0.310611814f, 0.481794327f},
-std::array<float,2>{0.900954545f, 0.314075649f},
-std::array<float,2>{0.477344513f, 0.927941561f},
-std::array<float,2>{0.619600177f, 0.54349947f},
-std::array<float,2>{0.00566878961f, 0.219476923f},
-std::array<float,2>{0.756818116f, 0.153999016f},
-std::array<float,2>{0.319771498f, 0.592696667f},
-std::array<float,2>{0.702487111f, 0.956421912f},
-std::array<float,2>{0.236095235f, 0.290275544f},
-std::array<float,2>{0.51908797f, 0.405332685f},
-std::array<float,2>{0.0945546106f, 0.769003153f},
-std::array<float,2>{0.99663651f, 0.734833956f},
-std::array<float,2>{0.428557515f, 0.102491997f},
-std::array<float,2>{0.616818547f, 0.040475104f},
-std::array<float,2>{0.00806856155f, 0.660849929f},
-std::array<float,2>{0.891634226f, 0.833321691f},
-std::array<float,2>{0.469957501f, 0.441024125f},
-std::array<float,2>{0.859456062f, 0.37324509f},
-std::array<float,2>{0.300620139f, 0.88365984f},
-std::array<float,2>{0.626716852f, 0.501326382f},
-std::array<float,2>{0.169899181f, 0.214945227f},
-std::array<float,2>{0.987472594f, 0.166817427f},
-std::array<float,2>{0.435171813f, 0.598138332f},
-std::array<float,2>{0.523456454f, 0.994385481f},
-std::array<float,2>{0.102893561f, 0.272568136f},
-std::array<float,2>{0.688660383f, 0.411877632f},
-std::array<float,2>{0.242572755f, 0.798204541f},
-std::array<float,2>{0.762795806f, 0.706550419f},
-std::array<float,2>{0.323459983f, 0.084070839f},
-std::array<float,2>{0.674568951f, 0.228171915f},
-std::array<float,2>{0.147197917f, 0.538316011f},
-std::array<float,2>{0.828794539f, 0.934829235f},
-std::array<float,2>{0.277315915f, 0.320815682f},
-std::array<float,2>{0.91020155f, 0.470120341f},
-std::array<float,2>{0.454343498f, 0.859679401f},
-std::array<float,2>{0.574597061f, 0.648248076f},
-std::array<float,2>{0.0562571324f, 0.0197663456f},
-std::array<float,2>{0.790198207f, 0.10095758f},
-std::array<float,2>{0.365041941f, 0.742607653f},
-std::array<float,2>{0.73359412f, 0.777387559f},
-std::array<float,2>{0.21131058f, 0.392000318f},
-std::array<float,2>{0.545944989f, 0.287881434f},
-std::array<float,2>{0.0893525481f, 0.96577996f},
-std::array<float,2>{0.939881444f, 0.578445256f},
-std::array<float,2>{0.399877697f, 0.142666772f},
-std::array<float,2>{0.513559043f, 0.133175105f},
-std::array<float,2>{0.114150368f, 0.563606024f},
-std::array<float,2>{0.978258073f, 0.948831856f},
-std::array<float,2>{0.41211772f, 0.311704993f},
-std::array<float,2>{0.772838712f, 0.381127685f},
-std::array<float,2>{0.341886669f, 0.750154912f},
-std::array<float,2>{0.70845139f, 0.7238006f},
-std::array<float,2>{0.225607455f, 0.119238101f},
-std::array<float,2>{0.875617027f, 0.00699748797f},
-std::array<float,2>{0.488988489f, 0.634690523f},
-std::array<float,2>{0.609370887f, 0.85023123f},
-std::array<float,2>{0.0168932192f, 0.4937419f},
-std::array<float,2>{0.645085335f, 0.333293885f},
-std::array<float,2>{0.182862118f, 0.916572571f},
-std::array<float,2>{0.844904184f, 0.552073836f},
-std::array<float,2>{0.286645472f, 0.247048885f},
-std::array<float,2>{0.734381199f, 0.0688134506f},
-std::array<float,2>{0.191301554f, 0.69621408f},
-std::array<float,2>{0.798822165f, 0.781487107f},
-std::array<float,2>{0.352090597f, 0.425898492f},
-std::array<float,2>{0.957859159f, 0.258163452f},
-std::array<float,2>{0.387042016f, 0.983631194f},
-std::array<float,2>{0.551315069f, 0.610104799f},
-std::array<float,2>{0.0758583471f, 0.179410294f},
-std::array<float,2>{0.819614828f, 0.195537493f},
-std::array<float,2>{0.25571999f, 0.526416898f},
-std::array<float,2>{0.671594918f, 0.8941046f},
-std::array<float,2>{0.127465829f, 0.35526216f},
-std::array<float,2>{0.592285931f, 0.457704246f},
-std::array<float,2>{0.0361677967f, 0.820817947f},
-std::array<float,2>{0.935279548f, 0.682083249f},
-std::array<float,2>{0.444394559f, 0.0481514633f},
-std::array<float,2>{0.622217774f, 0.06351652f},
-std::array<float,2>{0.00331789092f, 0.70308429f},
-std::array<float,2>{0.903913915f, 0.787453592f},
-std::array<float,2>{0.480800897f, 0.424591005f},
-std::array<float,2>{0.87405175f, 0.265520811f},
-std::array<float,2>{0.307361871f, 0.979743063f},
-std::array<float,2>{0.633485436f, 0.616821468f},
-std::array<float,2>{0.159828588f, 0.174532503f},
-std::array<float,2>{0.99340421f, 0.199344441f},
-std::array<float,2>{0.424878955f, 0.528378785f},
-std::array<float,2>{0.522444487f, 0.895210803f},
-std::array<float,2>{0.0994638577f, 0.357862025f},
-std::array<float,2>{0.698859334f, 0.454424739f},
-std::array<float,2>{0.240736663f, 0.827724278f},
-std::array<float,2>{0.752142787f, 0.686461389f},
-std::array<float,2>{0.315337092f, 0.0522845015f},
-std::array<float,2>{0.683772326f, 0.137032241f},
-std::array<float,2>{0.1488107f, 0.566960812f},
-std::array<float,2>{0.84362185f, 0.950060964f},
-std::array<float,2>{0.267161071f, 0.306261122f},
-std::array<float,2>{0.920769274f, 0.378584564f},
-std::array<float,2>{0.468011498f, 0.756084383f},
-std::array<float,2>{0.570034564f, 0.721987486f},
-std::array<float,2>{0.0498690158f, 0.123444922f},
-std::array<float,2>{0.784825087f, 0.00372578134f},
-std::array<float,2>{0.374332637f, 0.63884294f},
-std::array<float,2>{0.721549928f, 0.84661603f},
-std::array<float,2>{0.203798607f, 0.497479439f},
-std::array<float,2>{0.534522474f, 0.329991102f},
-std::array<float,2>{0.0789763182f, 0.920369506f},
-std::array<float,2>{0.950270534f, 0.54812932f},
-std::array<float,2>{0.392035067f, 0.245039254f},
-std::array<float,2>{0.503359377f, 0.233764753f},
-std::array<float,2>{0.121667296f, 0.532461047f},
-std::array<float,2>{0.97506547f, 0.92982322f},
-std::array<float,2>{0.420509338f, 0.326266408f},
-std::array<float,2>{0.779090881f, 0.475805521f},
-std::array<float,2>{0.335098892f, 0.866059363f},
-std::array<float,2>{0.71789217f, 0.641195178f},
-std::array<float,2>{0.229016155f, 0.0176664609f},
-std::array<float,2>{0.889729083f, 0.0940490663f},
-std::array<float,2>{0.499171257f, 0.746362269f},
-std::array<float,2>{0.600145221f, 0.775164902f},
-std::array<float,2>{0.0249014813f, 0.397757292f},
-std::array<float,2>{0.651421368f, 0.283510238f},
-std::array<float,2>{0.175579101f, 0.963779926f},
-std::array<float,2>{0.852706194f, 0.583797932f},
-std::array<float,2>{0.291273504f, 0.144567445f},
-std::array<float,2>{0.746147513f, 0.0457774326f},
-std::array<float,2>{0.197736502f, 0.657095969f},
-std::array<float,2>{0.806585789f, 0.829329908f},
-std::array<float,2>{0.349084944f, 0.44234702f},
-std::array<float,2>{0.967953503f, 0.369421631f},
-std::array<float,2>{0.377512842f, 0.890053153f},
-std::array<float,2>{0.560577393f, 0.507457316f},
-std::array<float,2>{0.0697337463f, 0.21340099f},
-std::array<float,2>{0.825554192f, 0.169188038f},
-std::array<float,2>{0.261916935f, 0.595296383f},
-std::array<float,2>{0.657951355f, 0.996241271f},
-std::array<float,2>{0.133074641f, 0.268171817f},
-std::array<float,2>{0.58498919f, 0.407477975f},
-std::array<float,2>{0.0462369174f, 0.801831663f},
-std::array<float,2>{0.92269963f, 0.709132195f},
-std::array<float,2>{0.450059801f, 0.0797250494f},
-std::array<float,2>{0.550531685f, 0.0294470899f},
-std::array<float,2>{0.0741311088f, 0.651006818f},
-std::array<float,2>{0.955350757f, 0.870107949f},
-std::array<float,2>{0.386277974f, 0.479925096f},
-std::array<float,2>{0.801095545f, 0.318925083f},
-std::array<float,2>{0.355797142f, 0.92320317f},
-std::array<float,2>{0.740554929f, 0.53993392f},
-std::array<float,2>{0.193372115f, 0.224581525f},
-std::array<float,2>{0.930766761f, 0.151063621f},
-std::array<float,2>{0.438372582f, 0.587573647f},
-std::array<float,2>{0.58925277f, 0.95760715f},
-std::array<float,2>{0.0324941128f, 0.295061022f},
-std::array<float,2>{0.667681694f, 0.40077588f},
-std::array<float,2>{0.130171001f, 0.771980584f},
-std::array<float,2>{0.813797414f, 0.73949635f},
-std::array<float,2>{0.252508998f, 0.107886717f},
-std::array<float,2>{0.706182122f, 0.209105477f},
-std::array<float,2>{0.220756143f, 0.511291862f},
-std::array<float,2>{0.766237378f, 0.880978107f},
-std::array<float,2>{0.336053908f, 0.359673887f},
-std::array<float,2>{0.981962502f, 0.446511269f},
-std::array<float,2>{0.409382463f, 0.836742222f},
-std::array<float,2>{0.511059344f, 0.671488166f},
-std::array<float,2>{0.112399295f, 0.0314725302f},
-std::array<float,2>{0.848414302f, 0.0872335583f},
-std::array<float,2>{0.281585455f, 0.712838411f},
-std::array<float,2>{0.641722918f, 0.809405386f},
-std::array<float,2>{0.186123803f, 0.419533163f},
-std::array<float,2>{0.603328943f, 0.274956971f},
-std::array<float,2>{0.0211184099f, 0.9916991f},
-std::array<float,2>{0.879347146f, 0.605662525f},
-std::array<float,2>{0.486856848f, 0.157230794f},
-std::array<float,2>{0.573440909f, 0.180385157f},
-std::array<float,2>{0.0602065288f, 0.619572043f},
-std::array<float,2>{0.90924269f, 0.970087707f},
-std::array<float,2>{0.459229797f, 0.254329175f},
-std::array<float,2>{0.83227396f, 0.436185896f},
-std::array<float,2>{0.280118287f, 0.793875992f},
-std::array<float,2>{0.679199278f, 0.688589334f},
-std::array<float,2>{0.141956821f, 0.0763521045f},
-std::array<float,2>{0.944088519f, 0.0617468581f},
-std::array<float,2>{0.405151576f, 0.673526227f},
-std::array<float,2>{0.541692019f, 0.816483021f},
-std::array<float,2>{0.0909044966f, 0.465714693f},
-std::array<float,2>{0.727420628f, 0.348849237f},
-std::array<float,2>{0.216113716f, 0.906083286f},
-std::array<float,2>{0.793291271f, 0.517395914f},
-std::array<float,2>{0.361952156f, 0.19140619f},
-std::array<float,2>{0.628981411f, 0.110538505f},
-std::array<float,2>{0.16606237f, 0.730739355f},
-std::array<float,2>{0.863953292f, 0.764065862f},
-std::array<float,2>{0.301276982f, 0.384805977f},
-std::array<float,2>{0.897406995f, 0.297170311f},
-std::array<float,2>{0.475209057f, 0.944089592f},
-std::array<float,2>{0.611850083f, 0.573516309f},
-std::array<float,2>{0.0122093195f, 0.131185502f},
-std::array<float,2>{0.761404157f, 0.241744995f},
-std::array<float,2>{0.325912952f, 0.55476445f},
-std::array<float,2>{0.692159235f, 0.907060087f},
-std::array<float,2>{0.246941522f, 0.33603242f},
-std::array<float,2>{0.528425395f, 0.489618123f},
-std::array<float,2>{0.109021381f, 0.855977058f},
-std::array<float,2>{0.989138484f, 0.627954721f},
-std::array<float,2>{0.432967246f, 0.0120202517f},
-std::array<float,2>{0.516530931f, 0.102796949f},
-std::array<float,2>{0.0965325609f, 0.735765636f},
-std::array<float,2>{0.999974847f, 0.76842761f},
-std::array<float,2>{0.427678674f, 0.404689282f},
-std::array<float,2>{0.755720973f, 0.289756477f},
-std::array<float,2>{0.317850918f, 0.955337584f},
-std::array<float,2>{0.699922621f, 0.593120635f},
-std::array<float,2>{0.237042472f, 0.152449146f},
-std::array<float,2>{0.89945066f, 0.220091328f},
-std::array<float,2>{0.479216784f, 0.544156075f},
-std::array<float,2>{0.618701696f, 0.929269552f},
-std::array<float,2>{0.00762246363f, 0.313147902f},
-std::array<float,2>{0.637722433f, 0.480977237f},
-std::array<float,2>{0.162500814f, 0.873773932f},
-std::array<float,2>{0.870553851f, 0.655866921f},
-std::array<float,2>{0.309800714f, 0.0255342945f},
-std::array<float,2>{0.724839032f, 0.161253601f},
-std::array<float,2>{0.209075198f, 0.603671134f},
-std::array<float,2>{0.787046075f, 0.984998941f},
-std::array<float,2>{0.369061947f, 0.280606925f},
-std::array<float,2>{0.948483527f, 0.41606009f},
-std::array<float,2>{0.397461802f, 0.804905355f},
-std::array<float,2>{0.536344826f, 0.716671646f},
-std::array<float,2>{0.0851039663f, 0.0929499865f},
-std::array<float,2>{0.83736515f, 0.0360009447f},
-std::array<float,2>{0.271482438f, 0.664079249f},
-std::array<float,2>{0.682304263f, 0.842425227f},
-std::array<float,2>{0.153764114f, 0.45193091f},
-std::array<float,2>{0.564435959f, 0.36398828f},
-std::array<float,2>{0.0522414595f, 0.878134906f},
-std::array<float,2>{0.915433109f, 0.511861801f},
-std::array<float,2>{0.461814165f, 0.206760049f},
-std::array<float,2>{0.596710384f, 0.191490129f},
-std::array<float,2>{0.0301884189f, 0.52020514f},
-std::array<float,2>{0.88549304f, 0.900638342f},
-std::array<float,2>{0.493823677f, 0.346949369f},
-std::array<float,2>{0.859088242f, 0.461649716f},
-std::array<float,2>{0.29685083f, 0.81353873f},
-std::array<float,2>{0.655688822f, 0.676850319f},
-std::array<float,2>{0.179442763f, 0.0575316139f},
-std::array<float,2>{0.969851136f, 0.072526373f},
-std::array<float,2>{0.415137231f, 0.694323421f},
-std::array<float,2>{0.507066011f, 0.791247249f},
-std::array<float,2>{0.120171204f, 0.431166291f},
-std::array<float,2>{0.71290952f, 0.252776772f},
-std::array<float,2>{0.230927661f, 0.973533273f},
-std::array<float,2>{0.77480489f, 0.621345997f},
-std::array<float,2>{0.32963264f, 0.185410753f},
-std::array<float,2>{0.661256731f, 0.00997977238f},
-std::array<float,2>{0.139554143f, 0.630048156f},
-std::array<float,2>{0.821796775f, 0.854349673f},
-std::array<float,2>{0.259340644f, 0.484485984f},
-std::array<float,2>{0.928773046f, 0.343689114f},
-std::array<float,2>{0.447686195f, 0.913911581f},
-std::array<float,2>{0.579460144f, 0.559197187f},
-std::array<float,2>{0.0419613309f, 0.234983489f},
-std::array<float,2>{0.808766484f, 0.126724318f},
-std::array<float,2>{0.347333103f, 0.576977909f},
-std::array<float,2>{0.743488908f, 0.940080285f},
-std::array<float,2>{0.202858746f, 0.302488089f},
-std::array<float,2>{0.555261135f, 0.388000637f},
-std::array<float,2>{0.0655675232f, 0.760617614f},
-std::array<float,2>{0.963781536f, 0.7280581f},
-std::array<float,2>{0.38070488f, 0.114202432f},
-std::array<float,2>{0.591113865f, 0.0471305326f},
-std::array<float,2>{0.037500497f, 0.683535695f},
-std::array<float,2>{0.93691349f, 0.821584344f},
-std::array<float,2>{0.441809684f, 0.45846197f},
-std::array<float,2>{0.818178952f, 0.353557199f},
-std::array<float,2>{0.256193638f, 0.893092155f},
-std::array<float,2>{0.66901505f, 0.526008368f},
-std::array<float,2>{0.125248045f, 0.197211698f},
-std::array<float,2>{0.960033238f, 0.178227037f},
-std::array<float,2>{0.388927609f, 0.610749245f},
-std::array<float,2>{0.553585708f, 0.983181179f},
-std::array<float,2>{0.0766135156f, 0.258990854f},
-std::array<float,2>{0.73649013f, 0.427019954f},
-std::array<float,2>{0.188620165f, 0.783025801f},
-std::array<float,2>{0.800184906f, 0.696725488f},
-std::array<float,2>{0.354092807f, 0.0695584565f},
-std::array<float,2>{0.647138357f, 0.247816145f},
-std::array<float,2>{0.180096895f, 0.551502347f},
-std::array<float,2>{0.846924782f, 0.917766452f},
-std::array<float,2>{0.288486481f, 0.332740724f},
-std::array<float,2>{0.87885499f, 0.493163913f},
-std::array<float,2>{0.491092443f, 0.850901186f},
-std::array<float,2>{0.606528699f, 0.633496702f},
-std::array<float,2>{0.0194815826f, 0.00628268626f},
-std::array<float,2>{0.771378577f, 0.120349012f},
-std::array<float,2>{0.341589689f, 0.722827554f},
-std::array<float,2>{0.709069312f, 0.751813829f},
-std::array<float,2>{0.223926112f, 0.381922871f},
-std::array<float,2>{0.513961256f, 0.311249286f},
-std::array<float,2>{0.115602627f, 0.947710395f},
-std::array<float,2>{0.97897774f, 0.563255548f},
-std::array<float,2>{0.41200009f, 0.133952275f},
-std::array<float,2>{0.543286324f, 0.143899828f},
-std::array<float,2>{0.0860682279f, 0.57968384f},
-std::array<float,2>{0.938244522f, 0.966112673f},
-std::array<float,2>{0.40214324f, 0.288677812f},
-std::array<float,2>{0.792005122f, 0.391037196f},
-std::array<float,2>{0.366386652f, 0.778648376f},
-std::array<float,2>{0.730527461f, 0.743962824f},
-std::array<float,2>{0.213116854f, 0.100191921f},
-std::array<float,2>{0.913394451f, 0.0210536439f},
-std::array<float,2>{0.455533177f, 0.647292972f},
-std::array<float,2>{0.578095555f, 0.861210108f},
-std::array<float,2>{0.0572264828f, 0.469716221f},
-std::array<float,2>{0.672208428f, 0.321445942f},
-std::array<float,2>{0.144943878f, 0.93410784f},
-std::array<float,2>{0.831853986f, 0.53725332f},
-std::array<float,2>{0.273597777f, 0.227014065f},
-std::array<float,2>{0.690214217f, 0.0856810883f},
-std::array<float,2>{0.244432658f, 0.705426574f},
-std::array<float,2>{0.764520526f, 0.797140419f},
-std::array<float,2>{0.320610255f, 0.410257131f},
-std::array<float,2>{0.985414386f, 0.271839976f},
-std::array<float,2>{0.436091125f, 0.995651662f},
-std::array<float,2>{0.526515365f, 0.599261045f},
-std::array<float,2>{0.105397873f, 0.167337492f},
-std::array<float,2>{0.861796737f, 0.215962172f},
-std::array<float,2>{0.297109634f, 0.500824749f},
-std::array<float,2>{0.627416968f, 0.883844793f},
-std::array<float,2>{0.171291277f, 0.374318928f},
-std::array<float,2>{0.613880754f, 0.439934313f},
-std::array<float,2>{0.0108374972f, 0.832404613f},
-std::array<float,2>{0.892868876f, 0.661423445f},
-std::array<float,2>{0.47119686f, 0.039503403f},
-std::array<float,2>{0.566956997f, 0.122509547f},
-std::array<float,2>{0.0476792902f, 0.720232606f},
-std::array<float,2>{0.918021262f, 0.754811347f},
-std::array<float,2>{0.466410279f, 0.376483887f},
-std::array<float,2>{0.839874983f, 0.30801478f},
-std::array<float,2>{0.267696589f, 0.951365471f},
-std::array<float,2>{0.68664211f, 0.568679094f},
-std::array<float,2>{0.15172863f, 0.139701948f},
-std::array<float,2>{0.951825857f, 0.242201224f},
-std::array<float,2>{0.393094182f, 0.549903512f},
-std::array<float,2>{0.531489372f, 0.919519126f},
-std::array<float,2>{0.0808590949f, 0.331764311f},
-std::array<float,2>{0.720353127f, 0.499663562f},
-std::array<float,2>{0.205497772f, 0.843809545f},
-std::array<float,2>{0.783159614f, 0.637113094f},
-std::array<float,2>{0.371599019f, 0.000960206962f},
-std::array<float,2>{0.635243893f, 0.172741249f},
-std::array<float,2>{0.156270653f, 0.614002109f},
-std::array<float,2>{0.871998429f, 0.977774441f},
-std::array<float,2>{0.306258976f, 0.262440354f},
-std::array<float,2>{0.904530108f, 0.42353788f},
-std::array<float,2>{0.483145267f, 0.786957443f},
-std::array<float,2>{0.62328589f, 0.700656056f},
-std::array<float,2>{9.57595985e-05f, 0.0657000914f},
-std::array<float,2>{0.7514925f, 0.0527620651f},
-std::array<float,2>{0.313324124f, 0.684359312f},
-std::array<float,2>{0.696194828f, 0.824659526f},
-std::array<float,2>{0.238845095f, 0.456053853f},
-std::array<float,2>{0.521234334f, 0.356222868f},
-std::array<float,2>{0.100284234f, 0.897194564f},
-std::array<float,2>{0.994670808f, 0.53000623f},
-std::array<float,2>{0.423762113f, 0.202241585f},
-std::array<float,2>{0.560028613f, 0.212792769f},
-std::array<float,2>{0.0667752847f, 0.505828619f},
-std::array<float,2>{0.965493321f, 0.887405694f},
-std::array<float,2>{0.376900434f, 0.368857265f},
-std::array<float,2>{0.808556437f, 0.443979502f},
-std::array<float,2>{0.349650413f, 0.830928504f},
-std::array<float,2>{0.748715818f, 0.659792781f},
-std::array<float,2>{0.195349276f, 0.0438440517f},
-std::array<float,2>{0.925711751f, 0.0804639012f},
-std::array<float,2>{0.452660471f, 0.708886743f},
-std::array<float,2>{0.58253336f, 0.803966999f},
-std::array<float,2>{0.0433062874f, 0.409636706f},
-std::array<float,2>{0.658523202f, 0.265709281f},
-std::array<float,2>{0.136698157f, 0.998664916f},
-std::array<float,2>{0.82806468f, 0.597131729f},
-std::array<float,2>{0.264707923f, 0.171490669f},
-std::array<float,2>{0.71569401f, 0.016102463f},
-std::array<float,2>{0.227594718f, 0.643291831f},
-std::array<float,2>{0.779720783f, 0.863872707f},
-std::array<float,2>{0.332419068f, 0.472698569f},
-std::array<float,2>{0.972808063f, 0.324858338f},
-std::array<float,2>{0.419831395f, 0.932562053f},
-std::array<float,2>{0.500287652f, 0.533921063f},
-std::array<float,2>{0.123058729f, 0.230499804f},
-std::array<float,2>{0.854130089f, 0.147358418f},
-std::array<float,2>{0.289687812f, 0.585628211f},
-std::array<float,2>{0.648439407f, 0.96251893f},
-std::array<float,2>{0.173545316f, 0.282312125f},
-std::array<float,2>{0.598192751f, 0.395341069f},
-std::array<float,2>{0.026232224f, 0.777032554f},
-std::array<float,2>{0.887382865f, 0.7489748f},
-std::array<float,2>{0.496408045f, 0.0959489346f},
-std::array<float,2>{0.509414077f, 0.0348659307f},
-std::array<float,2>{0.10954912f, 0.668196738f},
-std::array<float,2>{0.983290136f, 0.838448524f},
-std::array<float,2>{0.407054722f, 0.448382616f},
-std::array<float,2>{0.768570542f, 0.361996919f},
-std::array<float,2>{0.338870704f, 0.879830599f},
-std::array<float,2>{0.704224706f, 0.509687304f},
-std::array<float,2>{0.220596626f, 0.208030075f},
-std::array<float,2>{0.881408095f, 0.159008935f},
-std::array<float,2>{0.485193402f, 0.609046161f},
-std::array<float,2>{0.605088055f, 0.988571405f},
-std::array<float,2>{0.0225312058f, 0.276334494f},
-std::array<float,2>{0.642649293f, 0.420976311f},
-std::array<float,2>{0.183827102f, 0.81088829f},
-std::array<float,2>{0.850432932f, 0.713171601f},
-std::array<float,2>{0.284196496f, 0.0896607041f},
-std::array<float,2>{0.738969207f, 0.226233482f},
-std::array<float,2>{0.193156868f, 0.541254759f},
-std::array<float,2>{0.802905619f, 0.925186813f},
-std::array<float,2>{0.357696295f, 0.316463917f},
-std::array<float,2>{0.953791022f, 0.476871461f},
-std::array<float,2>{0.383662343f, 0.868736267f},
-std::array<float,2>{0.547308326f, 0.650259793f},
-std::array<float,2>{0.070709683f, 0.0282134879f},
-std::array<float,2>{0.814927638f, 0.107393242f},
-std::array<float,2>{0.251690686f, 0.74212265f},
-std::array<float,2>{0.665839732f, 0.771448433f},
-std::array<float,2>{0.132656083f, 0.399083912f},
-std::array<float,2>{0.586968899f, 0.293288499f},
-std::array<float,2>{0.0340679102f, 0.960614324f},
-std::array<float,2>{0.932695627f, 0.588206887f},
-std::array<float,2>{0.441245198f, 0.148498356f},
-std::array<float,2>{0.609707296f, 0.130805179f},
-std::array<float,2>{0.0137927653f, 0.570622563f},
-std::array<float,2>{0.894768357f, 0.942497194f},
-std::array<float,2>{0.474521816f, 0.299436271f},
-std::array<float,2>{0.866105855f, 0.384401411f},
-std::array<float,2>{0.303620726f, 0.762907088f},
-std::array<float,2>{0.630874932f, 0.733753085f},
-std::array<float,2>{0.16453819f, 0.111342765f},
-std::array<float,2>{0.992019594f, 0.0143488292f},
-std::array<float,2>{0.430812567f, 0.625184238f},
-std::array<float,2>{0.529482722f, 0.858837306f},
-std::array<float,2>{0.106045142f, 0.491362363f},
-std::array<float,2>{0.693785608f, 0.338689268f},
-std::array<float,2>{0.248560712f, 0.909982026f},
-std::array<float,2>{0.759005308f, 0.557632267f},
-std::array<float,2>{0.326773286f, 0.239362746f},
-std::array<float,2>{0.676676691f, 0.0753062516f},
-std::array<float,2>{0.144527465f, 0.691331148f},
-std::array<float,2>{0.834662855f, 0.796801329f},
-std::array<float,2>{0.278444231f, 0.435447305f},
-std::array<float,2>{0.906633198f, 0.255897403f},
-std::array<float,2>{0.458631635f, 0.971402764f},
-std::array<float,2>{0.571543217f, 0.617687404f},
-std::array<float,2>{0.0617440753f, 0.181843817f},
-std::array<float,2>{0.795829654f, 0.187547162f},
-std::array<float,2>{0.359472781f, 0.517720759f},
-std::array<float,2>{0.729967415f, 0.902875006f},
-std::array<float,2>{0.217016324f, 0.350746065f},
-std::array<float,2>{0.539740384f, 0.467517197f},
-std::array<float,2>{0.0934193432f, 0.818753064f},
-std::array<float,2>{0.942342639f, 0.675284266f},
-std::array<float,2>{0.403241515f, 0.0587227941f},
-std::array<float,2>{0.537758946f, 0.0909793824f},
-std::array<float,2>{0.0832983851f, 0.71803534f},
-std::array<float,2>{0.946692646f, 0.808199286f},
-std::array<float,2>{0.395302504f, 0.415587604f},
-std::array<float,2>{0.78899157f, 0.27920112f},
-std::array<float,2>{0.369196117f, 0.986406863f},
-std::array<float,2>{0.723932505f, 0.602621913f},
-std::array<float,2>{0.207300752f, 0.162169307f},
-std::array<float,2>{0.917751431f, 0.204614311f},
-std::array<float,2>{0.4633995f, 0.515433192f},
-std::array<float,2>{0.564855576f, 0.875457227f},
-std::array<float,2>{0.0527710244f, 0.36597231f},
-std::array<float,2>{0.681053638f, 0.450562447f},
-std::array<float,2>{0.155362323f, 0.841671109f},
-std::array<float,2>{0.839506745f, 0.667350411f},
-std::array<float,2>{0.272149712f, 0.0371410735f},
-std::array<float,2>{0.701812029f, 0.155057058f},
-std::array<float,2>{0.234550878f, 0.590481818f},
-std::array<float,2>{0.757083714f, 0.953795373f},
-std::array<float,2>{0.318551004f, 0.291089028f},
-std::array<float,2>{0.997373402f, 0.402401447f},
-std::array<float,2>{0.429417729f, 0.765966535f},
-std::array<float,2>{0.517628431f, 0.737502456f},
-std::array<float,2>{0.0951605961f, 0.103811644f},
-std::array<float,2>{0.868447363f, 0.0249861106f},
-std::array<float,2>{0.312490016f, 0.652350307f},
-std::array<float,2>{0.640012205f, 0.872460663f},
-std::array<float,2>{0.161303714f, 0.483982444f},
-std::array<float,2>{0.620526791f, 0.316046774f},
-std::array<float,2>{0.00415791571f, 0.927731335f},
-std::array<float,2>{0.901702404f, 0.545781791f},
-std::array<float,2>{0.478099138f, 0.22096546f},
-std::array<float,2>{0.580283523f, 0.23764281f},
-std::array<float,2>{0.0394791588f, 0.561385393f},
-std::array<float,2>{0.926161349f, 0.91135484f},
-std::array<float,2>{0.445509821f, 0.341202378f},
-std::array<float,2>{0.823245525f, 0.487608075f},
-std::array<float,2>{0.260078013f, 0.853173673f},
-std::array<float,2>{0.662474692f, 0.631640911f},
-std::array<float,2>{0.138595268f, 0.00974229258f},
-std::array<float,2>{0.961004019f, 0.116737358f},
-std::array<float,2>{0.381125808f, 0.728912055f},
-std::array<float,2>{0.55704987f, 0.759595692f},
-std::array<float,2>{0.0637060627f, 0.389268309f},
-std::array<float,2>{0.746020079f, 0.304665267f},
-std::array<float,2>{0.200824693f, 0.937574148f},
-std::array<float,2>{0.810886681f, 0.575315416f},
-std::array<float,2>{0.345480382f, 0.128561318f},
-std::array<float,2>{0.652424932f, 0.0565625094f},
-std::array<float,2>{0.17724371f, 0.679308832f},
-std::array<float,2>{0.856504261f, 0.815700054f},
-std::array<float,2>{0.294216126f, 0.464393646f},
-std::array<float,2>{0.884686172f, 0.344063282f},
-std::array<float,2>{0.495281845f, 0.89854461f},
-std::array<float,2>{0.595247746f, 0.522500277f},
-std::array<float,2>{0.0276510753f, 0.195158973f},
-std::array<float,2>{0.775676489f, 0.186742753f},
-std::array<float,2>{0.33153218f, 0.624947667f},
-std::array<float,2>{0.712065339f, 0.975609779f},
-std::array<float,2>{0.2334636f, 0.250812411f},
-std::array<float,2>{0.505087197f, 0.433098197f},
-std::array<float,2>{0.118146434f, 0.789431512f},
-std::array<float,2>{0.971202374f, 0.691714287f},
-std::array<float,2>{0.416902483f, 0.0714520216f},
-std::array<float,2>{0.60786134f, 0.00409552734f},
-std::array<float,2>{0.0162761137f, 0.6351583f},
-std::array<float,2>{0.876537442f, 0.848443747f},
-std::array<float,2>{0.489754438f, 0.495805383f},
-std::array<float,2>{0.843919575f, 0.334205538f},
-std::array<float,2>{0.285957098f, 0.915638447f},
-std::array<float,2>{0.646374941f, 0.554361224f},
-std::array<float,2>{0.182232261f, 0.249454975f},
-std::array<float,2>{0.977415979f, 0.135083199f},
-std::array<float,2>{0.413620263f, 0.565780401f},
-std::array<float,2>{0.51204294f, 0.945414484f},
-std::array<float,2>{0.115180597f, 0.3090958f},
-std::array<float,2>{0.707409501f, 0.380511105f},
-std::array<float,2>{0.225078166f, 0.752764821f},
-std::array<float,2>{0.772419214f, 0.725990891f},
-std::array<float,2>{0.343011051f, 0.117855079f},
-std::array<float,2>{0.670543134f, 0.197643623f},
-std::array<float,2>{0.128384873f, 0.524984598f},
-std::array<float,2>{0.818666935f, 0.891714156f},
-std::array<float,2>{0.254198968f, 0.353375465f},
-std::array<float,2>{0.934499681f, 0.459164083f},
-std::array<float,2>{0.444149196f, 0.822722018f},
-std::array<float,2>{0.593133807f, 0.680303335f},
-std::array<float,2>{0.0360335708f, 0.0506938137f},
-std::array<float,2>{0.796987057f, 0.0678284466f},
-std::array<float,2>{0.352765352f, 0.698788166f},
-std::array<float,2>{0.735592782f, 0.783397794f},
-std::array<float,2>{0.190205976f, 0.427849948f},
-std::array<float,2>{0.552608073f, 0.261394471f},
-std::array<float,2>{0.0750424638f, 0.982268393f},
-std::array<float,2>{0.958117902f, 0.612719655f},
-std::array<float,2>{0.388438761f, 0.177652061f},
-std::array<float,2>{0.52453655f, 0.165860683f},
-std::array<float,2>{0.101947211f, 0.599948764f},
-std::array<float,2>{0.986950874f, 0.992554903f},
-std::array<float,2>{0.434212536f, 0.270747542f},
-std::array<float,2>{0.762387991f, 0.413272113f},
-std::array<float,2>{0.322687596f, 0.800470412f},
-std::array<float,2>{0.687683284f, 0.703267813f},
-std::array<float,2>{0.243871987f, 0.0830188617f},
-std::array<float,2>{0.891599357f, 0.0424049422f},
-std::array<float,2>{0.46895662f, 0.66300112f},
-std::array<float,2>{0.615978837f, 0.835055053f},
-std::array<float,2>{0.00963596813f, 0.4392308f},
-std::array<float,2>{0.625851095f, 0.371307015f},
-std::array<float,2>{0.168148503f, 0.886683047f},
-std::array<float,2>{0.860592127f, 0.503321767f},
-std::array<float,2>{0.299239039f, 0.216810614f},
-std::array<float,2>{0.733341634f, 0.0994141474f},
-std::array<float,2>{0.211995542f, 0.744293034f},
-std::array<float,2>{0.789456367f, 0.780593634f},
-std::array<float,2>{0.363982856f, 0.394035459f},
-std::array<float,2>{0.941175401f, 0.285650462f},
-std::array<float,2>{0.399003893f, 0.967092454f},
-std::array<float,2>{0.54526329f, 0.581894934f},
-std::array<float,2>{0.088713713f, 0.140797004f},
-std::array<float,2>{0.829597235f, 0.229929566f},
-std::array<float,2>{0.275418699f, 0.536514223f},
-std::array<float,2>{0.67527169f, 0.935721755f},
-std::array<float,2>{0.14750275f, 0.322701931f},
-std::array<float,2>{0.575251102f, 0.471920997f},
-std::array<float,2>{0.0556373224f, 0.86304754f},
-std::array<float,2>{0.911881983f, 0.645252228f},
-std::array<float,2>{0.453888088f, 0.0229709577f},
-std::array<float,2>{0.606114268f, 0.117935933f},
-std::array<float,2>{0.0176249035f, 0.72581476f},
-std::array<float,2>{0.877920747f, 0.752487481f},
-std::array<float,2>{0.491897345f, 0.38068977f},
-std::array<float,2>{0.846195757f, 0.309544325f},
-std::array<float,2>{0.287189037f, 0.945774972f},
-std::array<float,2>{0.647511244f, 0.565497637f},
-std::array<float,2>{0.181456506f, 0.134859294f},
-std::array<float,2>{0.979583383f, 0.24918209f},
-std::array<float,2>{0.410870463f, 0.554523051f},
-std::array<float,2>{0.515058577f, 0.915850878f},
-std::array<float,2>{0.116310745f, 0.334386528f},
-std::array<float,2>{0.710569441f, 0.495934546f},
-std::array<float,2>{0.222819462f, 0.848199129f},
-std::array<float,2>{0.770181835f, 0.634768128f},
-std::array<float,2>{0.340468228f, 0.004222224f},
-std::array<float,2>{0.66834569f, 0.177274346f},
-std::array<float,2>{0.126014709f, 0.612411499f},
-std::array<float,2>{0.817241967f, 0.982075095f},
-std::array<float,2>{0.257443935f, 0.261543602f},
-std::array<float,2>{0.935966253f, 0.428084314f},
-std::array<float,2>{0.442418575f, 0.783545554f},
-std::array<float,2>{0.590643883f, 0.699170113f},
-std::array<float,2>{0.0389524661f, 0.067398034f},
-std::array<float,2>{0.799506307f, 0.0505227931f},
-std::array<float,2>{0.354500443f, 0.68046701f},
-std::array<float,2>{0.737839401f, 0.822426856f},
-std::array<float,2>{0.187688455f, 0.45934245f},
-std::array<float,2>{0.554363966f, 0.353076905f},
-std::array<float,2>{0.0778764114f, 0.891876936f},
-std::array<float,2>{0.959150255f, 0.52524364f},
-std::array<float,2>{0.390045941f, 0.197327867f},
-std::array<float,2>{0.526145816f, 0.217127413f},
-std::array<float,2>{0.103632897f, 0.503106534f},
-std::array<float,2>{0.985001326f, 0.886285663f},
-std::array<float,2>{0.436995924f, 0.37145859f},
-std::array<float,2>{0.765484571f, 0.439148039f},
-std::array<float,2>{0.321730554f, 0.835213482f},
-std::array<float,2>{0.690555096f, 0.662689984f},
-std::array<float,2>{0.245373547f, 0.0421083532f},
-std::array<float,2>{0.894307196f, 0.0832832456f},
-std::array<float,2>{0.472203314f, 0.703435838f},
-std::array<float,2>{0.614963055f, 0.800628006f},
-std::array<float,2>{0.0100602889f, 0.413380444f},
-std::array<float,2>{0.628229141f, 0.270934433f},
-std::array<float,2>{0.170089975f, 0.992288351f},
-std::array<float,2>{0.862381101f, 0.5997563f},
-std::array<float,2>{0.29845944f, 0.165621966f},
-std::array<float,2>{0.731908798f, 0.0232520904f},
-std::array<float,2>{0.214717433f, 0.645316243f},
-std::array<float,2>{0.791985273f, 0.862989008f},
-std::array<float,2>{0.366003454f, 0.472104043f},
-std::array<float,2>{0.938901722f, 0.322288692f},
-std::array<float,2>{0.401329756f, 0.935833871f},
-std::array<float,2>{0.544808686f, 0.536374032f},
-std::array<float,2>{0.087329492f, 0.229666024f},
-std::array<float,2>{0.830717444f, 0.140898585f},
-std::array<float,2>{0.275349587f, 0.581566751f},
-std::array<float,2>{0.673775256f, 0.966967583f},
-std::array<float,2>{0.14565596f, 0.285933435f},
-std::array<float,2>{0.576781392f, 0.393642515f},
-std::array<float,2>{0.057924848f, 0.780324399f},
-std::array<float,2>{0.91266185f, 0.744525909f},
-std::array<float,2>{0.456378669f, 0.0993430167f},
-std::array<float,2>{0.536021531f, 0.037412066f},
-std::array<float,2>{0.0842511728f, 0.66707164f},
-std::array<float,2>{0.947984159f, 0.841480076f},
-std::array<float,2>{0.39723295f, 0.450350404f},
-std::array<float,2>{0.785458207f, 0.36572811f},
-std::array<float,2>{0.367635161f, 0.875130773f},
-std::array<float,2>{0.726302266f, 0.515142322f},
-std::array<float,2>{0.210762218f, 0.20505859f},
-std::array<float,2>{0.91428721f, 0.162380829f},
-std::array<float,2>{0.462006837f, 0.602890432f},
-std::array<float,2>{0.56281817f, 0.986620247f},
-std::array<float,2>{0.0514115095f, 0.278867453f},
-std::array<float,2>{0.682920039f, 0.415830791f},
-std::array<float,2>{0.152353004f, 0.808448017f},
-std::array<float,2>{0.836503267f, 0.717862666f},
-std::array<float,2>{0.270387024f, 0.0912221745f},
-std::array<float,2>{0.700952351f, 0.220831677f},
-std::array<float,2>{0.237318337f, 0.545424342f},
-std::array<float,2>{0.754317045f, 0.927248597f},
-std::array<float,2>{0.317149758f, 0.316400766f},
-std::array<float,2>{0.998887837f, 0.484301984f},
-std::array<float,2>{0.426390082f, 0.872280657f},
-std::array<float,2>{0.516960025f, 0.65277046f},
-std::array<float,2>{0.09696538f, 0.0252637453f},
-std::array<float,2>{0.869440317f, 0.103721343f},
-std::array<float,2>{0.308733165f, 0.73770839f},
-std::array<float,2>{0.636999369f, 0.765750349f},
-std::array<float,2>{0.163680494f, 0.402707249f},
-std::array<float,2>{0.617616653f, 0.291381568f},
-std::array<float,2>{0.00602052454f, 0.953982711f},
-std::array<float,2>{0.899204433f, 0.590625107f},
-std::array<float,2>{0.480110407f, 0.15499641f},
-std::array<float,2>{0.57878083f, 0.128845677f},
-std::array<float,2>{0.0423091054f, 0.575557053f},
-std::array<float,2>{0.928655386f, 0.93791759f},
-std::array<float,2>{0.448720455f, 0.304424554f},
-std::array<float,2>{0.821221352f, 0.38954252f},
-std::array<float,2>{0.25816825f, 0.759517908f},
-std::array<float,2>{0.660939038f, 0.72863245f},
-std::array<float,2>{0.140459403f, 0.117059812f},
-std::array<float,2>{0.964143991f, 0.00939742941f},
-std::array<float,2>{0.378981382f, 0.631429136f},
-std::array<float,2>{0.556171894f, 0.853329241f},
-std::array<float,2>{0.0648946241f, 0.48752436f},
-std::array<float,2>{0.742362201f, 0.340957046f},
-std::array<float,2>{0.201788053f, 0.91141206f},
-std::array<float,2>{0.809583426f, 0.561227322f},
-std::array<float,2>{0.345850468f, 0.237510413f},
-std::array<float,2>{0.654730022f, 0.0716889054f},
-std::array<float,2>{0.178673968f, 0.691565514f},
-std::array<float,2>{0.857608378f, 0.7890926f},
-std::array<float,2>{0.295181274f, 0.432629079f},
-std::array<float,2>{0.886170208f, 0.250632793f},
-std::array<float,2>{0.492416203f, 0.975871146f},
-std::array<float,2>{0.596502721f, 0.624685049f},
-std::array<float,2>{0.0304729287f, 0.186941609f},
-std::array<float,2>{0.773989558f, 0.194949687f},
-std::array<float,2>{0.328531206f, 0.522927046f},
-std::array<float,2>{0.714579642f, 0.898755968f},
-std::array<float,2>{0.231701076f, 0.343872398f},
-std::array<float,2>{0.506567657f, 0.464797556f},
-std::array<float,2>{0.119319312f, 0.815574169f},
-std::array<float,2>{0.968758702f, 0.679540455f},
-std::array<float,2>{0.414403379f, 0.0561967827f},
-std::array<float,2>{0.510253012f, 0.0894333944f},
-std::array<float,2>{0.111893483f, 0.713132203f},
-std::array<float,2>{0.98058027f, 0.810596228f},
-std::array<float,2>{0.408971459f, 0.421377331f},
-std::array<float,2>{0.767358184f, 0.275990039f},
-std::array<float,2>{0.337313026f, 0.988482058f},
-std::array<float,2>{0.705699861f, 0.609148502f},
-std::array<float,2>{0.222432211f, 0.15878804f},
-std::array<float,2>{0.880420566f, 0.208264321f},
-std::array<float,2>{0.487457842f, 0.50941962f},
-std::array<float,2>{0.60226357f, 0.879516721f},
-std::array<float,2>{0.0203193873f, 0.362236351f},
-std::array<float,2>{0.641251743f, 0.448634863f},
-std::array<float,2>{0.187145412f, 0.838766873f},
-std::array<float,2>{0.849488437f, 0.668355227f},
-std::array<float,2>{0.282961398f, 0.0349624343f},
-std::array<float,2>{0.741228521f, 0.14885366f},
-std::array<float,2>{0.195153773f, 0.588020623f},
-std::array<float,2>{0.802623451f, 0.96090889f},
-std::array<float,2>{0.356666744f, 0.293003201f},
-std::array<float,2>{0.956200719f, 0.399389237f},
-std::array<float,2>{0.385120571f, 0.77113533f},
-std::array<float,2>{0.54952997f, 0.741715133f},
-std::array<float,2>{0.0728482306f, 0.107154325f},
-std::array<float,2>{0.81335175f, 0.0280352645f},
-std::array<float,2>{0.252955258f, 0.650019288f},
-std::array<float,2>{0.666270435f, 0.868994057f},
-std::array<float,2>{0.129570469f, 0.47661978f},
-std::array<float,2>{0.588072419f, 0.316778392f},
-std::array<float,2>{0.0317327604f, 0.924952805f},
-std::array<float,2>{0.930327237f, 0.541410565f},
-std::array<float,2>{0.439294785f, 0.226318419f},
-std::array<float,2>{0.612854123f, 0.23970519f},
-std::array<float,2>{0.0136453565f, 0.557993054f},
-std::array<float,2>{0.897952497f, 0.909902692f},
-std::array<float,2>{0.476271987f, 0.338518888f},
-std::array<float,2>{0.864836931f, 0.491592705f},
-std::array<float,2>{0.302189201f, 0.858593881f},
-std::array<float,2>{0.630663157f, 0.625487745f},
-std::array<float,2>{0.167478487f, 0.0145317521f},
-std::array<float,2>{0.990035117f, 0.111760087f},
-std::array<float,2>{0.432236195f, 0.733495057f},
-std::array<float,2>{0.528018057f, 0.7631253f},
-std::array<float,2>{0.107674979f, 0.384604901f},
-std::array<float,2>{0.692616522f, 0.299609989f},
-std::array<float,2>{0.247929916f, 0.942767918f},
-std::array<float,2>{0.760491729f, 0.570414901f},
-std::array<float,2>{0.325078249f, 0.130505845f},
-std::array<float,2>{0.678195417f, 0.0588680878f},
-std::array<float,2>{0.140713021f, 0.674855351f},
-std::array<float,2>{0.833716571f, 0.8184582f},
-std::array<float,2>{0.280404836f, 0.467562675f},
-std::array<float,2>{0.90829438f, 0.350981444f},
-std::array<float,2>{0.460545152f, 0.903314531f},
-std::array<float,2>{0.572814643f, 0.517967761f},
-std::array<float,2>{0.0588760562f, 0.187945575f},
-std::array<float,2>{0.794461608f, 0.181998208f},
-std::array<float,2>{0.362800419f, 0.618091702f},
-std::array<float,2>{0.728146374f, 0.9716115f},
-std::array<float,2>{0.215311229f, 0.25633654f},
-std::array<float,2>{0.542177379f, 0.435103595f},
-std::array<float,2>{0.0898742378f, 0.796597838f},
-std::array<float,2>{0.944945216f, 0.691108942f},
-std::array<float,2>{0.405371457f, 0.075568296f},
-std::array<float,2>{0.569097281f, 0.000657322817f},
-std::array<float,2>{0.0497685596f, 0.636938274f},
-std::array<float,2>{0.921175957f, 0.844106913f},
-std::array<float,2>{0.467523277f, 0.499817908f},
-std::array<float,2>{0.842108309f, 0.332021207f},
-std::array<float,2>{0.266563773f, 0.919773757f},
-std::array<float,2>{0.684606731f, 0.550265431f},
-std::array<float,2>{0.149463981f, 0.242554128f},
-std::array<float,2>{0.94939065f, 0.140079409f},
-std::array<float,2>{0.390787989f, 0.568502426f},
-std::array<float,2>{0.533287168f, 0.951590776f},
-std::array<float,2>{0.0791618377f, 0.307852864f},
-std::array<float,2>{0.722614706f, 0.37688753f},
-std::array<float,2>{0.204360992f, 0.754582763f},
-std::array<float,2>{0.783999205f, 0.720554292f},
-std::array<float,2>{0.373880446f, 0.122299835f},
-std::array<float,2>{0.634433389f, 0.202613637f},
-std::array<float,2>{0.158653215f, 0.530098319f},
-std::array<float,2>{0.873949945f, 0.897434831f},
-std::array<float,2>{0.308100045f, 0.356152266f},
-std::array<float,2>{0.902775943f, 0.455659688f},
-std::array<float,2>{0.481542468f, 0.824262917f},
-std::array<float,2>{0.621856272f, 0.684145451f},
-std::array<float,2>{0.00227228366f, 0.0531239435f},
-std::array<float,2>{0.75374186f, 0.0656659082f},
-std::array<float,2>{0.316047013f, 0.700427473f},
-std::array<float,2>{0.698062479f, 0.786829829f},
-std::array<float,2>{0.241409227f, 0.423701137f},
-std::array<float,2>{0.522820413f, 0.262661517f},
-std::array<float,2>{0.0979580805f, 0.977903306f},
-std::array<float,2>{0.993133426f, 0.61401403f},
-std::array<float,2>{0.424373448f, 0.172551334f},
-std::array<float,2>{0.561733127f, 0.171716899f},
-std::array<float,2>{0.0691428557f, 0.596738756f},
-std::array<float,2>{0.967245877f, 0.999002695f},
-std::array<float,2>{0.378156275f, 0.265976638f},
-std::array<float,2>{0.805535674f, 0.409300148f},
-std::array<float,2>{0.348118484f, 0.803714395f},
-std::array<float,2>{0.747417092f, 0.708665013f},
-std::array<float,2>{0.198664203f, 0.0801769644f},
-std::array<float,2>{0.923814595f, 0.0435874015f},
-std::array<float,2>{0.450869709f, 0.660069108f},
-std::array<float,2>{0.584809303f, 0.830712974f},
-std::array<float,2>{0.045256149f, 0.444233119f},
-std::array<float,2>{0.657181382f, 0.36897704f},
-std::array<float,2>{0.133988991f, 0.887628675f},
-std::array<float,2>{0.824445307f, 0.505567014f},
-std::array<float,2>{0.262868762f, 0.212570593f},
-std::array<float,2>{0.717213571f, 0.0958640426f},
-std::array<float,2>{0.229803652f, 0.748675585f},
-std::array<float,2>{0.777716517f, 0.77721554f},
-std::array<float,2>{0.334724814f, 0.395198584f},
-std::array<float,2>{0.975811601f, 0.282702446f},
-std::array<float,2>{0.420998007f, 0.962734699f},
-std::array<float,2>{0.502718925f, 0.585774243f},
-std::array<float,2>{0.123024233f, 0.147155926f},
-std::array<float,2>{0.851843774f, 0.230763614f},
-std::array<float,2>{0.292844862f, 0.534074426f},
-std::array<float,2>{0.650460899f, 0.932138264f},
-std::array<float,2>{0.173985824f, 0.325071752f},
-std::array<float,2>{0.600710928f, 0.473035127f},
-std::array<float,2>{0.0239904057f, 0.864169002f},
-std::array<float,2>{0.888817787f, 0.643330216f},
-std::array<float,2>{0.498706013f, 0.0157251898f},
-std::array<float,2>{0.592094541f, 0.0695918202f},
-std::array<float,2>{0.0370942466f, 0.696327329f},
-std::array<float,2>{0.934877038f, 0.782861948f},
-std::array<float,2>{0.445175588f, 0.426837713f},
-std::array<float,2>{0.820246339f, 0.259255171f},
-std::array<float,2>{0.255125701f, 0.982940495f},
-std::array<float,2>{0.671205699f, 0.61047411f},
-std::array<float,2>{0.126984566f, 0.178597525f},
-std::array<float,2>{0.957235873f, 0.196917549f},
-std::array<float,2>{0.387370408f, 0.52618295f},
-std::array<float,2>{0.551139235f, 0.893481791f},
-std::array<float,2>{0.0752059817f, 0.35388878f},
-std::array<float,2>{0.734895468f, 0.458150029f},
-std::array<float,2>{0.190886453f, 0.821447432f},
-std::array<float,2>{0.798312902f, 0.683289826f},
-std::array<float,2>{0.351625562f, 0.0468948558f},
-std::array<float,2>{0.644709408f, 0.134219289f},
-std::array<float,2>{0.183492735f, 0.563152373f},
-std::array<float,2>{0.845532358f, 0.947408974f},
-std::array<float,2>{0.286483496f, 0.311521411f},
-std::array<float,2>{0.875031769f, 0.382184803f},
-std::array<float,2>{0.48868832f, 0.751694322f},
-std::array<float,2>{0.608701169f, 0.722965121f},
-std::array<float,2>{0.0172070954f, 0.120431893f},
-std::array<float,2>{0.773168027f, 0.00597932423f},
-std::array<float,2>{0.34273988f, 0.633646369f},
-std::array<float,2>{0.708698153f, 0.850673795f},
-std::array<float,2>{0.226513937f, 0.492908716f},
-std::array<float,2>{0.513065755f, 0.332900912f},
-std::array<float,2>{0.113631442f, 0.917644739f},
-std::array<float,2>{0.977962732f, 0.551606953f},
-std::array<float,2>{0.413012058f, 0.247764722f},
-std::array<float,2>{0.546426475f, 0.226677477f},
-std::array<float,2>{0.0893664211f, 0.537494004f},
-std::array<float,2>{0.940049291f, 0.934445441f},
-std::array<float,2>{0.400159985f, 0.321774572f},
-std::array<float,2>{0.790935099f, 0.469434887f},
-std::array<float,2>{0.364322126f, 0.861078918f},
-std::array<float,2>{0.733988464f, 0.647027731f},
-std::array<float,2>{0.211790904f, 0.0214460641f},
-std::array<float,2>{0.911095381f, 0.100396387f},
-std::array<float,2>{0.454659402f, 0.743837953f},
-std::array<float,2>{0.574744761f, 0.778489649f},
-std::array<float,2>{0.0559344627f, 0.390852511f},
-std::array<float,2>{0.673976719f, 0.288846493f},
-std::array<float,2>{0.146902218f, 0.966037214f},
-std::array<float,2>{0.828570187f, 0.579897642f},
-std::array<float,2>{0.27682665f, 0.143580586f},
-std::array<float,2>{0.68900609f, 0.0391689725f},
-std::array<float,2>{0.243088514f, 0.661147475f},
-std::array<float,2>{0.763579249f, 0.832058072f},
-std::array<float,2>{0.324150056f, 0.439536452f},
-std::array<float,2>{0.987827957f, 0.374129981f},
-std::array<float,2>{0.434726149f, 0.884194076f},
-std::array<float,2>{0.524094939f, 0.500573218f},
-std::array<float,2>{0.103399105f, 0.216225058f},
-std::array<float,2>{0.860113204f, 0.167042494f},
-std::array<float,2>{0.300155193f, 0.599467754f},
-std::array<float,2>{0.626370013f, 0.996057332f},
-std::array<float,2>{0.169378206f, 0.271507204f},
-std::array<float,2>{0.616615593f, 0.410437286f},
-std::array<float,2>{0.00860290136f, 0.797029793f},
-std::array<float,2>{0.892133474f, 0.70518291f},
-std::array<float,2>{0.470407218f, 0.0858024955f},
-std::array<float,2>{0.518808067f, 0.0258645844f},
-std::array<float,2>{0.0939284265f, 0.656096339f},
-std::array<float,2>{0.996360481f, 0.87399888f},
-std::array<float,2>{0.428179234f, 0.481260896f},
-std::array<float,2>{0.755992472f, 0.313410789f},
-std::array<float,2>{0.320274442f, 0.929650366f},
-std::array<float,2>{0.702747762f, 0.544306099f},
-std::array<float,2>{0.235461071f, 0.219805285f},
-std::array<float,2>{0.900629103f, 0.152689114f},
-std::array<float,2>{0.476778537f, 0.592842996f},
-std::array<float,2>{0.619989753f, 0.955179691f},
-std::array<float,2>{0.0049787187f, 0.289868385f},
-std::array<float,2>{0.639089108f, 0.404468268f},
-std::array<float,2>{0.160512075f, 0.768243074f},
-std::array<float,2>{0.86779815f, 0.735558987f},
-std::array<float,2>{0.31140554f, 0.102642521f},
-std::array<float,2>{0.722681761f, 0.207030579f},
-std::array<float,2>{0.208108082f, 0.512075543f},
-std::array<float,2>{0.787563384f, 0.878381848f},
-std::array<float,2>{0.37070483f, 0.36414057f},
-std::array<float,2>{0.945863962f, 0.451819658f},
-std::array<float,2>{0.395982474f, 0.842676759f},
-std::array<float,2>{0.538163781f, 0.664549232f},
-std::array<float,2>{0.0822722241f, 0.0358331837f},
-std::array<float,2>{0.838411629f, 0.0932320654f},
-std::array<float,2>{0.273355544f, 0.71635139f},
-std::array<float,2>{0.680659413f, 0.80511564f},
-std::array<float,2>{0.154505521f, 0.416399777f},
-std::array<float,2>{0.56592083f, 0.280457765f},
-std::array<float,2>{0.0544304512f, 0.985326171f},
-std::array<float,2>{0.916052341f, 0.603780389f},
-std::array<float,2>{0.464278668f, 0.161459461f},
-std::array<float,2>{0.594359815f, 0.185190096f},
-std::array<float,2>{0.029136762f, 0.621267736f},
-std::array<float,2>{0.883509934f, 0.973192215f},
-std::array<float,2>{0.49460569f, 0.252447546f},
-std::array<float,2>{0.856292069f, 0.431593835f},
-std::array<float,2>{0.293040276f, 0.79137516f},
-std::array<float,2>{0.653655887f, 0.693930447f},
-std::array<float,2>{0.176188201f, 0.0724109113f},
-std::array<float,2>{0.97221452f, 0.0572404154f},
-std::array<float,2>{0.417171717f, 0.677140236f},
-std::array<float,2>{0.503940403f, 0.813877225f},
-std::array<float,2>{0.119002648f, 0.461804688f},
-std::array<float,2>{0.71097213f, 0.346898615f},
-std::array<float,2>{0.232677877f, 0.900453925f},
-std::array<float,2>{0.777112663f, 0.520455122f},
-std::array<float,2>{0.330750793f, 0.191665098f},
-std::array<float,2>{0.663930237f, 0.114011951f},
-std::array<float,2>{0.137192667f, 0.728305042f},
-std::array<float,2>{0.823234379f, 0.760258973f},
-std::array<float,2>{0.261694044f, 0.387781441f},
-std::array<float,2>{0.926971018f, 0.30257684f},
-std::array<float,2>{0.446552277f, 0.940215647f},
-std::array<float,2>{0.581925571f, 0.57674557f},
-std::array<float,2>{0.0400720872f, 0.126686886f},
-std::array<float,2>{0.811760604f, 0.235202923f},
-std::array<float,2>{0.344265193f, 0.559546173f},
-std::array<float,2>{0.744243383f, 0.91363579f},
-std::array<float,2>{0.199481383f, 0.343286335f},
-std::array<float,2>{0.558195531f, 0.484741926f},
-std::array<float,2>{0.0633919388f, 0.854238927f},
-std::array<float,2>{0.962159932f, 0.630129874f},
-std::array<float,2>{0.382353097f, 0.0100124972f},
-std::array<float,2>{0.548142076f, 0.10745272f},
-std::array<float,2>{0.0721429363f, 0.739737332f},
-std::array<float,2>{0.954321206f, 0.772340417f},
-std::array<float,2>{0.384249419f, 0.400455505f},
-std::array<float,2>{0.803998888f, 0.295337945f},
-std::array<float,2>{0.358567953f, 0.957908571f},
-std::array<float,2>{0.739849329f, 0.587753475f},
-std::array<float,2>{0.192366555f, 0.151172012f},
-std::array<float,2>{0.931694329f, 0.224272832f},
-std::array<float,2>{0.440057576f, 0.539703429f},
-std::array<float,2>{0.586586654f, 0.922955036f},
-std::array<float,2>{0.0342223682f, 0.3192105f},
-std::array<float,2>{0.664410055f, 0.47950229f},
-std::array<float,2>{0.131746501f, 0.869809449f},
-std::array<float,2>{0.815623403f, 0.651288271f},
-std::array<float,2>{0.250798583f, 0.029607784f},
-std::array<float,2>{0.70356518f, 0.157635942f},
-std::array<float,2>{0.219216391f, 0.60571456f},
-std::array<float,2>{0.767579675f, 0.991300344f},
-std::array<float,2>{0.338550866f, 0.275253266f},
-std::array<float,2>{0.983576596f, 0.419895232f},
-std::array<float,2>{0.407261193f, 0.809132874f},
-std::array<float,2>{0.508577585f, 0.71257925f},
-std::array<float,2>{0.110872351f, 0.0869653299f},
-std::array<float,2>{0.851374209f, 0.0315513648f},
-std::array<float,2>{0.284051627f, 0.671707392f},
-std::array<float,2>{0.644226789f, 0.836512208f},
-std::array<float,2>{0.18480505f, 0.44657892f},
-std::array<float,2>{0.604365289f, 0.359613657f},
-std::array<float,2>{0.0218887571f, 0.881342411f},
-std::array<float,2>{0.882364929f, 0.511584163f},
-std::array<float,2>{0.485718995f, 0.209293738f},
-std::array<float,2>{0.570785999f, 0.191043526f},
-std::array<float,2>{0.061135184f, 0.517123044f},
-std::array<float,2>{0.907610416f, 0.905792534f},
-std::array<float,2>{0.457476079f, 0.348877043f},
-std::array<float,2>{0.835158169f, 0.465460837f},
-std::array<float,2>{0.277590871f, 0.816874802f},
-std::array<float,2>{0.67711091f, 0.673817635f},
-std::array<float,2>{0.143105313f, 0.0618673675f},
-std::array<float,2>{0.9425807f, 0.0764885694f},
-std::array<float,2>{0.403476387f, 0.688925624f},
-std::array<float,2>{0.540706515f, 0.793460608f},
-std::array<float,2>{0.0922420621f, 0.436421543f},
-std::array<float,2>{0.728809536f, 0.253975064f},
-std::array<float,2>{0.218103841f, 0.969857633f},
-std::array<float,2>{0.796404421f, 0.619261563f},
-std::array<float,2>{0.361042142f, 0.180503249f},
-std::array<float,2>{0.632802069f, 0.0117842732f},
-std::array<float,2>{0.165449947f, 0.628320158f},
-std::array<float,2>{0.866317153f, 0.856428862f},
-std::array<float,2>{0.304210126f, 0.489490718f},
-std::array<float,2>{0.895767748f, 0.336296678f},
-std::array<float,2>{0.472694814f, 0.906876504f},
-std::array<float,2>{0.610401273f, 0.555076063f},
-std::array<float,2>{0.0149981473f, 0.241953984f},
-std::array<float,2>{0.758038342f, 0.130890563f},
-std::array<float,2>{0.327430606f, 0.573247552f},
-std::array<float,2>{0.694639444f, 0.944199264f},
-std::array<float,2>{0.249392003f, 0.296943218f},
-std::array<float,2>{0.530778766f, 0.385138929f},
-std::array<float,2>{0.106579959f, 0.763683677f},
-std::array<float,2>{0.99119097f, 0.730673492f},
-std::array<float,2>{0.430145651f, 0.110604815f},
-std::array<float,2>{0.624724805f, 0.0526578538f},
-std::array<float,2>{0.00130703929f, 0.686231911f},
-std::array<float,2>{0.90567565f, 0.828096628f},
-std::array<float,2>{0.483755946f, 0.454235852f},
-std::array<float,2>{0.873046815f, 0.357456088f},
-std::array<float,2>{0.305367172f, 0.895449042f},
-std::array<float,2>{0.63588196f, 0.528722525f},
-std::array<float,2>{0.157815635f, 0.199587554f},
-std::array<float,2>{0.995862961f, 0.17463851f},
-std::array<float,2>{0.422436833f, 0.617028713f},
-std::array<float,2>{0.519646585f, 0.979620874f},
-std::array<float,2>{0.10139747f, 0.265238076f},
-std::array<float,2>{0.696621895f, 0.424559712f},
-std::array<float,2>{0.239958704f, 0.787117004f},
-std::array<float,2>{0.750053823f, 0.702854097f},
-std::array<float,2>{0.314255893f, 0.0637802258f},
-std::array<float,2>{0.686019599f, 0.244855613f},
-std::array<float,2>{0.150829062f, 0.547870517f},
-std::array<float,2>{0.841276288f, 0.920078278f},
-std::array<float,2>{0.268665314f, 0.329695374f},
-std::array<float,2>{0.919694245f, 0.497112632f},
-std::array<float,2>{0.465616345f, 0.846378326f},
-std::array<float,2>{0.567782521f, 0.639038563f},
-std::array<float,2>{0.0488278754f, 0.00341906259f},
-std::array<float,2>{0.781832039f, 0.123154521f},
-std::array<float,2>{0.372748226f, 0.721839368f},
-std::array<float,2>{0.719104528f, 0.756193936f},
-std::array<float,2>{0.206155419f, 0.378792107f},
-std::array<float,2>{0.532658815f, 0.306509733f},
-std::array<float,2>{0.0818688124f, 0.949885249f},
-std::array<float,2>{0.952322841f, 0.567341268f},
-std::array<float,2>{0.394456863f, 0.136817276f},
-std::array<float,2>{0.501620948f, 0.144993991f},
-std::array<float,2>{0.12436755f, 0.583677828f},
-std::array<float,2>{0.974025548f, 0.963608146f},
-std::array<float,2>{0.418767214f, 0.283431888f},
-std::array<float,2>{0.78065896f, 0.397528291f},
-std::array<float,2>{0.333347648f, 0.775139272f},
-std::array<float,2>{0.71619457f, 0.746323645f},
-std::array<float,2>{0.2271301f, 0.0937970504f},
-std::array<float,2>{0.888486028f, 0.0178225674f},
-std::array<float,2>{0.497103542f, 0.641554892f},
-std::array<float,2>{0.599544168f, 0.865764737f},
-std::array<float,2>{0.0272839945f, 0.47605145f},
-std::array<float,2>{0.649790168f, 0.326618761f},
-std::array<float,2>{0.17239289f, 0.93011421f},
-std::array<float,2>{0.855336726f, 0.532677591f},
-std::array<float,2>{0.29077059f, 0.233586624f},
-std::array<float,2>{0.749495804f, 0.0800231025f},
-std::array<float,2>{0.196363732f, 0.70927912f},
-std::array<float,2>{0.807603538f, 0.802048802f},
-std::array<float,2>{0.350709915f, 0.407283723f},
-std::array<float,2>{0.966734886f, 0.268458635f},
-std::array<float,2>{0.375171274f, 0.996361196f},
-std::array<float,2>{0.559072077f, 0.595508039f},
-std::array<float,2>{0.0677538589f, 0.169249848f},
-std::array<float,2>{0.826920509f, 0.213717803f},
-std::array<float,2>{0.263804287f, 0.507770419f},
-std::array<float,2>{0.659551859f, 0.88969481f},
-std::array<float,2>{0.135377705f, 0.369202256f},
-std::array<float,2>{0.583221853f, 0.44201225f},
-std::array<float,2>{0.0444998257f, 0.829466343f},
-std::array<float,2>{0.924767971f, 0.656744659f},
-std::array<float,2>{0.451312363f, 0.0454489924f},
-std::array<float,2>{0.613565922f, 0.0844191536f},
-std::array<float,2>{0.0113165602f, 0.706916451f},
-std::array<float,2>{0.893223286f, 0.797928751f},
-std::array<float,2>{0.470768839f, 0.411858469f},
-std::array<float,2>{0.862034261f, 0.272937536f},
-std::array<float,2>{0.297692031f, 0.99435091f},
-std::array<float,2>{0.627746105f, 0.597701609f},
-std::array<float,2>{0.171672076f, 0.166636422f},
-std::array<float,2>{0.98625201f, 0.215199471f},
-std::array<float,2>{0.43581593f, 0.501006961f},
-std::array<float,2>{0.526911318f, 0.88342911f},
-std::array<float,2>{0.104939602f, 0.37335813f},
-std::array<float,2>{0.689505279f, 0.441400647f},
-std::array<float,2>{0.244825915f, 0.833108783f},
-std::array<float,2>{0.763944387f, 0.661003709f},
-std::array<float,2>{0.320826501f, 0.0400650501f},
-std::array<float,2>{0.672437191f, 0.142946109f},
-std::array<float,2>{0.145403609f, 0.578310013f},
-std::array<float,2>{0.831271172f, 0.965351939f},
-std::array<float,2>{0.273961216f, 0.287714928f},
-std::array<float,2>{0.913668931f, 0.391755253f},
-std::array<float,2>{0.455658346f, 0.777751386f},
-std::array<float,2>{0.57741189f, 0.742241204f},
-std::array<float,2>{0.0571141914f, 0.100717418f},
-std::array<float,2>{0.792836607f, 0.0199834816f},
-std::array<float,2>{0.366950601f, 0.64819181f},
-std::array<float,2>{0.731247425f, 0.859570086f},
-std::array<float,2>{0.213843271f, 0.469970703f},
-std::array<float,2>{0.543909609f, 0.321158111f},
-std::array<float,2>{0.0865323022f, 0.934725106f},
-std::array<float,2>{0.937927544f, 0.538341463f},
-std::array<float,2>{0.401799113f, 0.228365824f},
-std::array<float,2>{0.514497221f, 0.246604741f},
-std::array<float,2>{0.116100147f, 0.551763058f},
-std::array<float,2>{0.979010463f, 0.9169783f},
-std::array<float,2>{0.411462218f, 0.333110839f},
-std::array<float,2>{0.770690918f, 0.493910432f},
-std::array<float,2>{0.340988785f, 0.85054785f},
-std::array<float,2>{0.709798515f, 0.634405434f},
-std::array<float,2>{0.224292457f, 0.00721753808f},
-std::array<float,2>{0.878405094f, 0.119446948f},
-std::array<float,2>{0.490647793f, 0.724017024f},
-std::array<float,2>{0.607241333f, 0.750331104f},
-std::array<float,2>{0.0185592659f, 0.380982518f},
-std::array<float,2>{0.646500945f, 0.31200853f},
-std::array<float,2>{0.180616394f, 0.949100256f},
-std::array<float,2>{0.847572207f, 0.563769042f},
-std::array<float,2>{0.288893431f, 0.13298434f},
-std::array<float,2>{0.736940205f, 0.0480094478f},
-std::array<float,2>{0.189143389f, 0.681697369f},
-std::array<float,2>{0.800661325f, 0.821274519f},
-std::array<float,2>{0.35374409f, 0.457879782f},
-std::array<float,2>{0.96072948f, 0.355050355f},
-std::array<float,2>{0.389288723f, 0.894478142f},
-std::array<float,2>{0.552793562f, 0.526837051f},
-std::array<float,2>{0.076784119f, 0.195716321f},
-std::array<float,2>{0.817600727f, 0.1796031f},
-std::array<float,2>{0.256458074f, 0.61011374f},
-std::array<float,2>{0.669770062f, 0.983691037f},
-std::array<float,2>{0.125751913f, 0.257855624f},
-std::array<float,2>{0.591465056f, 0.426030487f},
-std::array<float,2>{0.0378734693f, 0.781665027f},
-std::array<float,2>{0.937416017f, 0.696000397f},
-std::array<float,2>{0.442244262f, 0.06837219f},
-std::array<float,2>{0.554889143f, 0.0112430416f},
-std::array<float,2>{0.0660879239f, 0.628941178f},
-std::array<float,2>{0.963042915f, 0.855095565f},
-std::array<float,2>{0.380015671f, 0.486161858f},
-std::array<float,2>{0.809280038f, 0.342720777f},
-std::array<float,2>{0.346800983f, 0.912513554f},
-std::array<float,2>{0.743806124f, 0.559794128f},
-std::array<float,2>{0.202624083f, 0.236058891f},
-std::array<float,2>{0.929512143f, 0.125344843f},
-std::array<float,2>{0.447917372f, 0.577394128f},
-std::array<float,2>{0.579769015f, 0.94055891f},
-std::array<float,2>{0.0413714685f, 0.301088303f},
-std::array<float,2>{0.662003934f, 0.387613535f},
-std::array<float,2>{0.138768911f, 0.761306942f},
-std::array<float,2>{0.821615517f, 0.727150679f},
-std::array<float,2>{0.25916177f, 0.114302307f},
-std::array<float,2>{0.713708043f, 0.192484304f},
-std::array<float,2>{0.231284663f, 0.520747781f},
-std::array<float,2>{0.775092542f, 0.901981592f},
-std::array<float,2>{0.329302996f, 0.345944196f},
-std::array<float,2>{0.970276058f, 0.462082416f},
-std::array<float,2>{0.415967166f, 0.81295681f},
-std::array<float,2>{0.507672608f, 0.676707506f},
-std::array<float,2>{0.120980673f, 0.058262486f},
-std::array<float,2>{0.85875833f, 0.0735614896f},
-std::array<float,2>{0.296351463f, 0.694793761f},
-std::array<float,2>{0.656200528f, 0.79250747f},
-std::array<float,2>{0.178895026f, 0.429972321f},
-std::array<float,2>{0.597612083f, 0.253605455f},
-std::array<float,2>{0.0295016915f, 0.97456938f},
-std::array<float,2>{0.884964049f, 0.622324049f},
-std::array<float,2>{0.493469298f, 0.183856994f},
-std::array<float,2>{0.563689291f, 0.160479367f},
-std::array<float,2>{0.0524661057f, 0.605104268f},
-std::array<float,2>{0.915962934f, 0.985801637f},
-std::array<float,2>{0.461072952f, 0.279493898f},
-std::array<float,2>{0.837721169f, 0.417725742f},
-std::array<float,2>{0.270788372f, 0.806211829f},
-std::array<float,2>{0.681985021f, 0.71571666f},
-std::array<float,2>{0.153832138f, 0.0926553458f},
-std::array<float,2>{0.949119329f, 0.0363911316f},
-std::array<float,2>{0.398058355f, 0.665344894f},
-std::array<float,2>{0.536670983f, 0.84369868f},
-std::array<float,2>{0.0859367922f, 0.45283854f},
-std::array<float,2>{0.725457728f, 0.364391237f},
-std::array<float,2>{0.209637299f, 0.877774775f},
-std::array<float,2>{0.786187112f, 0.513027847f},
-std::array<float,2>{0.368210852f, 0.205699027f},
-std::array<float,2>{0.638231695f, 0.102057807f},
-std::array<float,2>{0.162826449f, 0.734592021f},
-std::array<float,2>{0.870726526f, 0.768709004f},
-std::array<float,2>{0.310438752f, 0.405603796f},
-std::array<float,2>{0.899994612f, 0.29037258f},
-std::array<float,2>{0.478612065f, 0.956263781f},
-std::array<float,2>{0.618583322f, 0.592297912f},
-std::array<float,2>{0.00723502738f, 0.154091239f},
-std::array<float,2>{0.754998565f, 0.219571918f},
-std::array<float,2>{0.318010896f, 0.543819785f},
-std::array<float,2>{0.69956845f, 0.92811203f},
-std::array<float,2>{0.236765832f, 0.31428054f},
-std::array<float,2>{0.515908837f, 0.481494188f},
-std::array<float,2>{0.096142225f, 0.874863982f},
-std::array<float,2>{0.999132812f, 0.65460968f},
-std::array<float,2>{0.4269467f, 0.0268425345f},
-std::array<float,2>{0.529121935f, 0.109589368f},
-std::array<float,2>{0.108881116f, 0.731776416f},
-std::array<float,2>{0.988649368f, 0.765441179f},
-std::array<float,2>{0.433540583f, 0.386067301f},
-std::array<float,2>{0.761001885f, 0.298683286f},
-std::array<float,2>{0.325428367f, 0.944365621f},
-std::array<float,2>{0.691831529f, 0.573205292f},
-std::array<float,2>{0.246499106f, 0.132412478f},
-std::array<float,2>{0.896932006f, 0.240924314f},
-std::array<float,2>{0.474769562f, 0.556136191f},
-std::array<float,2>{0.611668408f, 0.907948732f},
-std::array<float,2>{0.0119337281f, 0.33750999f},
-std::array<float,2>{0.629804194f, 0.488382012f},
-std::array<float,2>{0.166653633f, 0.857285559f},
-std::array<float,2>{0.863396227f, 0.627821624f},
-std::array<float,2>{0.301261604f, 0.0134600792f},
-std::array<float,2>{0.726848841f, 0.180813059f},
-std::array<float,2>{0.216696382f, 0.620352745f},
-std::array<float,2>{0.793847084f, 0.969044626f},
-std::array<float,2>{0.361526757f, 0.255167335f},
-std::array<float,2>{0.943473458f, 0.436993778f},
-std::array<float,2>{0.404784709f, 0.794224679f},
-std::array<float,2>{0.54133594f, 0.688355148f},
-std::array<float,2>{0.0913972259f, 0.0772096962f},
-std::array<float,2>{0.832613647f, 0.0611092597f},
-std::array<float,2>{0.279577017f, 0.672324777f},
-std::array<float,2>{0.678912103f, 0.817434072f},
-std::array<float,2>{0.1423641f, 0.466235965f},
-std::array<float,2>{0.574208975f, 0.348088771f},
-std::array<float,2>{0.0600021705f, 0.90514344f},
-std::array<float,2>{0.909713864f, 0.516531825f},
-std::array<float,2>{0.45951131f, 0.190371946f},
-std::array<float,2>{0.602728248f, 0.210527107f},
-std::array<float,2>{0.0206481107f, 0.510344982f},
-std::array<float,2>{0.879780233f, 0.882531822f},
-std::array<float,2>{0.486632615f, 0.360580057f},
-std::array<float,2>{0.847936571f, 0.445453614f},
-std::array<float,2>{0.281928539f, 0.837676167f},
-std::array<float,2>{0.642389059f, 0.670704544f},
-std::array<float,2>{0.185819462f, 0.0329002403f},
-std::array<float,2>{0.981882572f, 0.0865465552f},
-std::array<float,2>{0.409822971f, 0.711431265f},
-std::array<float,2>{0.51131916f, 0.809942424f},
-std::array<float,2>{0.113088511f, 0.418171942f},
-std::array<float,2>{0.706841588f, 0.274096012f},
-std::array<float,2>{0.22151427f, 0.990456402f},
-std::array<float,2>{0.765731633f, 0.606938183f},
-std::array<float,2>{0.33667776f, 0.156626686f},
-std::array<float,2>{0.667379379f, 0.0308494437f},
-std::array<float,2>{0.130496353f, 0.651823997f},
-std::array<float,2>{0.814411521f, 0.8703174f},
-std::array<float,2>{0.25211966f, 0.478518307f},
-std::array<float,2>{0.931539714f, 0.319836676f},
-std::array<float,2>{0.437719405f, 0.922173202f},
-std::array<float,2>{0.589670122f, 0.54027915f},
-std::array<float,2>{0.0329547264f, 0.222906172f},
-std::array<float,2>{0.801670074f, 0.152237326f},
-std::array<float,2>{0.356410861f, 0.586276412f},
-std::array<float,2>{0.740913451f, 0.958908081f},
-std::array<float,2>{0.194069043f, 0.296631515f},
-std::array<float,2>{0.550271273f, 0.402313173f},
-std::array<float,2>{0.0735230222f, 0.773275375f},
-std::array<float,2>{0.955774069f, 0.738596559f},
-std::array<float,2>{0.385845363f, 0.109257579f},
-std::array<float,2>{0.585473001f, 0.0462188721f},
-std::array<float,2>{0.0467722751f, 0.657737076f},
-std::array<float,2>{0.922087431f, 0.829056084f},
-std::array<float,2>{0.449264795f, 0.443028629f},
-std::array<float,2>{0.825844765f, 0.370182693f},
-std::array<float,2>{0.26238957f, 0.889051855f},
-std::array<float,2>{0.657511353f, 0.506465435f},
-std::array<float,2>{0.133622378f, 0.214231536f},
-std::array<float,2>{0.968406379f, 0.168825656f},
-std::array<float,2>{0.377276748f, 0.594620347f},
-std::array<float,2>{0.561371803f, 0.997623086f},
-std::array<float,2>{0.0701709092f, 0.269058883f},
-std::array<float,2>{0.746672213f, 0.407046258f},
-std::array<float,2>{0.197826713f, 0.80104965f},
-std::array<float,2>{0.806068778f, 0.710102201f},
-std::array<float,2>{0.349378824f, 0.0783304647f},
-std::array<float,2>{0.651950181f, 0.232936755f},
-std::array<float,2>{0.175022677f, 0.531720042f},
-std::array<float,2>{0.853085935f, 0.930727601f},
-std::array<float,2>{0.291818291f, 0.327735275f},
-std::array<float,2>{0.890595794f, 0.474858046f},
-std::array<float,2>{0.499614f, 0.867043912f},
-std::array<float,2>{0.600003541f, 0.642337143f},
-std::array<float,2>{0.0250967648f, 0.0188147854f},
-std::array<float,2>{0.778513074f, 0.0952199027f},
-std::array<float,2>{0.335550398f, 0.747911751f},
-std::array<float,2>{0.718600214f, 0.773734629f},
-std::array<float,2>{0.228898138f, 0.396591663f},
-std::array<float,2>{0.503524721f, 0.284778625f},
-std::array<float,2>{0.121433869f, 0.964079201f},
-std::array<float,2>{0.975578129f, 0.582525373f},
-std::array<float,2>{0.420392573f, 0.145518929f},
-std::array<float,2>{0.535001755f, 0.137915835f},
-std::array<float,2>{0.0783320069f, 0.568276227f},
-std::array<float,2>{0.950841904f, 0.950251281f},
-std::array<float,2>{0.392203808f, 0.305382907f},
-std::array<float,2>{0.784404993f, 0.377754122f},
-std::array<float,2>{0.374720812f, 0.756904662f},
-std::array<float,2>{0.720743418f, 0.721150041f},
-std::array<float,2>{0.203298882f, 0.124418758f},
-std::array<float,2>{0.920321882f, 0.00247932691f},
-std::array<float,2>{0.468715906f, 0.639959931f},
-std::array<float,2>{0.569425881f, 0.847084224f},
-std::array<float,2>{0.0504096597f, 0.496311337f},
-std::array<float,2>{0.684291303f, 0.328854293f},
-std::array<float,2>{0.149009004f, 0.921636939f},
-std::array<float,2>{0.843250096f, 0.547113955f},
-std::array<float,2>{0.266942173f, 0.245988593f},
-std::array<float,2>{0.698285699f, 0.0632592216f},
-std::array<float,2>{0.240538672f, 0.701680183f},
-std::array<float,2>{0.752833247f, 0.788378298f},
-std::array<float,2>{0.314853281f, 0.425246269f},
-std::array<float,2>{0.993748546f, 0.263676763f},
-std::array<float,2>{0.425293297f, 0.979404032f},
-std::array<float,2>{0.521780312f, 0.615429699f},
-std::array<float,2>{0.098782517f, 0.175471097f},
-std::array<float,2>{0.87482506f, 0.200338662f},
-std::array<float,2>{0.307026505f, 0.527483404f},
-std::array<float,2>{0.632993877f, 0.896387398f},
-std::array<float,2>{0.159470931f, 0.359075338f},
-std::array<float,2>{0.622653544f, 0.453305513f},
-std::array<float,2>{0.00365471072f, 0.82698667f},
-std::array<float,2>{0.903491557f, 0.687294483f},
-std::array<float,2>{0.481036574f, 0.0510450564f},
-std::array<float,2>{0.575913966f, 0.0984818861f},
-std::array<float,2>{0.0548578314f, 0.745802462f},
-std::array<float,2>{0.911489844f, 0.779767096f},
-std::array<float,2>{0.453200132f, 0.393247336f},
-std::array<float,2>{0.829539716f, 0.286688089f},
-std::array<float,2>{0.276271224f, 0.968566239f},
-std::array<float,2>{0.675652564f, 0.580119669f},
-std::array<float,2>{0.148045883f, 0.142142385f},
-std::array<float,2>{0.940813124f, 0.229103401f},
-std::array<float,2>{0.398639739f, 0.535250247f},
-std::array<float,2>{0.545464277f, 0.937125087f},
-std::array<float,2>{0.0882680863f, 0.323657572f},
-std::array<float,2>{0.732745886f, 0.471366107f},
-std::array<float,2>{0.212647244f, 0.861531734f},
-std::array<float,2>{0.7898103f, 0.646303117f},
-std::array<float,2>{0.363556236f, 0.0221630055f},
-std::array<float,2>{0.625371277f, 0.164420545f},
-std::array<float,2>{0.168937564f, 0.60079658f},
-std::array<float,2>{0.861205637f, 0.993474483f},
-std::array<float,2>{0.299693197f, 0.270331025f},
-std::array<float,2>{0.891055822f, 0.412320346f},
-std::array<float,2>{0.469528377f, 0.799483359f},
-std::array<float,2>{0.61555171f, 0.704241216f},
-std::array<float,2>{0.00891939737f, 0.0820369571f},
-std::array<float,2>{0.76217556f, 0.0414657146f},
-std::array<float,2>{0.322942346f, 0.663411677f},
-std::array<float,2>{0.68832624f, 0.834408522f},
-std::array<float,2>{0.243554816f, 0.437866777f},
-std::array<float,2>{0.524977624f, 0.372893244f},
-std::array<float,2>{0.102146059f, 0.884988248f},
-std::array<float,2>{0.986559749f, 0.502435088f},
-std::array<float,2>{0.433824897f, 0.217913464f},
-std::array<float,2>{0.552100599f, 0.198358148f},
-std::array<float,2>{0.0746218041f, 0.52434057f},
-std::array<float,2>{0.958636761f, 0.890705049f},
-std::array<float,2>{0.388042629f, 0.352453113f},
-std::array<float,2>{0.797593892f, 0.460573971f},
-std::array<float,2>{0.353399694f, 0.823524892f},
-std::array<float,2>{0.736327291f, 0.681000471f},
-std::array<float,2>{0.189456835f, 0.0495736189f},
-std::array<float,2>{0.933756232f, 0.0670287535f},
-std::array<float,2>{0.443403602f, 0.69756937f},
-std::array<float,2>{0.593325853f, 0.784815133f},
-std::array<float,2>{0.0353704244f, 0.428743422f},
-std::array<float,2>{0.67022121f, 0.260731608f},
-std::array<float,2>{0.128834829f, 0.98054117f},
-std::array<float,2>{0.819294095f, 0.611758411f},
-std::array<float,2>{0.254446954f, 0.175972417f},
-std::array<float,2>{0.707722604f, 0.00506064808f},
-std::array<float,2>{0.225220069f, 0.635789096f},
-std::array<float,2>{0.771692991f, 0.849129975f},
-std::array<float,2>{0.343644589f, 0.494869798f},
-std::array<float,2>{0.976590872f, 0.335582346f},
-std::array<float,2>{0.413207531f, 0.91477263f},
-std::array<float,2>{0.512476265f, 0.552826941f},
-std::array<float,2>{0.114400193f, 0.248683095f},
-std::array<float,2>{0.844335794f, 0.13656719f},
-std::array<float,2>{0.285427749f, 0.565336704f},
-std::array<float,2>{0.645623982f, 0.946769118f},
-std::array<float,2>{0.182090998f, 0.309599102f},
-std::array<float,2>{0.608231902f, 0.379038662f},
-std::array<float,2>{0.0160326734f, 0.753483117f},
-std::array<float,2>{0.876103222f, 0.725244939f},
-std::array<float,2>{0.489433408f, 0.119130291f},
-std::array<float,2>{0.505697548f, 0.0548825338f},
-std::array<float,2>{0.117385276f, 0.678570151f},
-std::array<float,2>{0.971121192f, 0.814732194f},
-std::array<float,2>{0.41627422f, 0.462929279f},
-std::array<float,2>{0.77589643f, 0.344964325f},
-std::array<float,2>{0.331727564f, 0.899692953f},
-std::array<float,2>{0.712508857f, 0.521671116f},
-std::array<float,2>{0.234092221f, 0.193498373f},
-std::array<float,2>{0.884203136f, 0.185966775f},
-std::array<float,2>{0.495672911f, 0.623296559f},
-std::array<float,2>{0.594958603f, 0.975164592f},
-std::array<float,2>{0.0278399233f, 0.251497924f},
-std::array<float,2>{0.6529814f, 0.432078719f},
-std::array<float,2>{0.177585244f, 0.790784836f},
-std::array<float,2>{0.857042551f, 0.693164468f},
-std::array<float,2>{0.294756919f, 0.0708016232f},
-std::array<float,2>{0.745253384f, 0.237177983f},
-std::array<float,2>{0.20029141f, 0.561642051f},
-std::array<float,2>{0.811243713f, 0.911050677f},
-std::array<float,2>{0.344826937f, 0.340598434f},
-std::array<float,2>{0.961562693f, 0.487241417f},
-std::array<float,2>{0.381798059f, 0.851880312f},
-std::array<float,2>{0.557382226f, 0.632676065f},
-std::array<float,2>{0.0640026629f, 0.00863843225f},
-std::array<float,2>{0.824211538f, 0.11558973f},
-std::array<float,2>{0.26071009f, 0.730257988f},
-std::array<float,2>{0.662912965f, 0.758409739f},
-std::array<float,2>{0.137873814f, 0.389881015f},
-std::array<float,2>{0.580865622f, 0.302744269f},
-std::array<float,2>{0.0398660935f, 0.939425111f},
-std::array<float,2>{0.926375329f, 0.574238539f},
-std::array<float,2>{0.445991904f, 0.127205715f},
-std::array<float,2>{0.621012866f, 0.155463457f},
-std::array<float,2>{0.00447357167f, 0.591420293f},
-std::array<float,2>{0.901974082f, 0.954650283f},
-std::array<float,2>{0.477692544f, 0.292154431f},
-std::array<float,2>{0.869007289f, 0.403812528f},
-std::array<float,2>{0.311767638f, 0.767421246f},
-std::array<float,2>{0.640222847f, 0.736454964f},
-std::array<float,2>{0.16194734f, 0.105271161f},
-std::array<float,2>{0.998009324f, 0.0236985683f},
-std::array<float,2>{0.42907542f, 0.653713465f},
-std::array<float,2>{0.518309891f, 0.871219397f},
-std::array<float,2>{0.0955347717f, 0.483086199f},
-std::array<float,2>{0.70154351f, 0.315362424f},
-std::array<float,2>{0.234907493f, 0.925924003f},
-std::array<float,2>{0.757394969f, 0.546764791f},
-std::array<float,2>{0.319192827f, 0.221992552f},
-std::array<float,2>{0.681302011f, 0.0904045999f},
-std::array<float,2>{0.156236947f, 0.717681706f},
-std::array<float,2>{0.838887572f, 0.806976557f},
-std::array<float,2>{0.271733254f, 0.414485991f},
-std::array<float,2>{0.917351127f, 0.277657717f},
-std::array<float,2>{0.46334824f, 0.987434745f},
-std::array<float,2>{0.565303504f, 0.602335691f},
-std::array<float,2>{0.0534237549f, 0.163557291f},
-std::array<float,2>{0.788283646f, 0.203901812f},
-std::array<float,2>{0.369834036f, 0.51403749f},
-std::array<float,2>{0.72426343f, 0.87666893f},
-std::array<float,2>{0.207628712f, 0.366825402f},
-std::array<float,2>{0.537568748f, 0.449930012f},
-std::array<float,2>{0.0839342624f, 0.840627253f},
-std::array<float,2>{0.947194695f, 0.666286767f},
-std::array<float,2>{0.39463076f, 0.0382527784f},
-std::array<float,2>{0.539135754f, 0.0751294345f},
-std::array<float,2>{0.0927791893f, 0.690299511f},
-std::array<float,2>{0.941882491f, 0.795673668f},
-std::array<float,2>{0.402631223f, 0.434100688f},
-std::array<float,2>{0.795197189f, 0.257004827f},
-std::array<float,2>{0.359942317f, 0.971767485f},
-std::array<float,2>{0.730104268f, 0.618216276f},
-std::array<float,2>{0.217563361f, 0.182948649f},
-std::array<float,2>{0.906941295f, 0.189009443f},
-std::array<float,2>{0.458394647f, 0.519260705f},
-std::array<float,2>{0.571874738f, 0.904252768f},
-std::array<float,2>{0.0620803051f, 0.349830419f},
-std::array<float,2>{0.675861835f, 0.468330622f},
-std::array<float,2>{0.143619001f, 0.820095718f},
-std::array<float,2>{0.83406347f, 0.673938513f},
-std::array<float,2>{0.279022068f, 0.0596472397f},
-std::array<float,2>{0.69391948f, 0.129318357f},
-std::array<float,2>{0.248534396f, 0.571978629f},
-std::array<float,2>{0.759544432f, 0.942342758f},
-std::array<float,2>{0.326613843f, 0.300191224f},
-std::array<float,2>{0.99129504f, 0.383123636f},
-std::array<float,2>{0.43119362f, 0.762576342f},
-std::array<float,2>{0.530258834f, 0.732663393f},
-std::array<float,2>{0.105794415f, 0.112885192f},
-std::array<float,2>{0.865568459f, 0.0150492908f},
-std::array<float,2>{0.30312261f, 0.62656188f},
-std::array<float,2>{0.63175106f, 0.858114541f},
-std::array<float,2>{0.164918944f, 0.490371227f},
-std::array<float,2>{0.610092759f, 0.338912219f},
-std::array<float,2>{0.0141997049f, 0.908852518f},
-std::array<float,2>{0.895296812f, 0.557578385f},
-std::array<float,2>{0.474036723f, 0.238443255f},
-std::array<float,2>{0.587766767f, 0.224762842f},
-std::array<float,2>{0.0335486419f, 0.542322159f},
-std::array<float,2>{0.933350146f, 0.924727261f},
-std::array<float,2>{0.440876931f, 0.317609608f},
-std::array<float,2>{0.815225303f, 0.477705687f},
-std::array<float,2>{0.25127244f, 0.868015409f},
-std::array<float,2>{0.665222526f, 0.649020672f},
-std::array<float,2>{0.132155597f, 0.0291048884f},
-std::array<float,2>{0.953457534f, 0.10580954f},
-std::array<float,2>{0.382953346f, 0.740794539f},
-std::array<float,2>{0.54777503f, 0.77047199f},
-std::array<float,2>{0.0712304786f, 0.399533927f},
-std::array<float,2>{0.738695025f, 0.294839025f},
-std::array<float,2>{0.192830533f, 0.959277272f},
-std::array<float,2>{0.803556859f, 0.589719653f},
-std::array<float,2>{0.3583408f, 0.149818137f},
-std::array<float,2>{0.64309752f, 0.0336091705f},
-std::array<float,2>{0.184404269f, 0.668947518f},
-std::array<float,2>{0.849970937f, 0.839699805f},
-std::array<float,2>{0.28472057f, 0.447772115f},
-std::array<float,2>{0.88089627f, 0.362404853f},
-std::array<float,2>{0.484480172f, 0.880138636f},
-std::array<float,2>{0.604739308f, 0.50842762f},
-std::array<float,2>{0.0232637115f, 0.207937434f},
-std::array<float,2>{0.769467711f, 0.160126314f},
-std::array<float,2>{0.339397848f, 0.607800484f},
-std::array<float,2>{0.704713702f, 0.989593625f},
-std::array<float,2>{0.219821632f, 0.276818931f},
-std::array<float,2>{0.509056628f, 0.420317322f},
-std::array<float,2>{0.110320725f, 0.812238574f},
-std::array<float,2>{0.982431293f, 0.713978052f},
-std::array<float,2>{0.406637013f, 0.0888618082f},
-std::array<float,2>{0.59805429f, 0.0174744781f},
-std::array<float,2>{0.0257275775f, 0.644473553f},
-std::array<float,2>{0.886959076f, 0.864698946f},
-std::array<float,2>{0.496765554f, 0.474412024f},
-std::array<float,2>{0.853701472f, 0.325995326f},
-std::array<float,2>{0.289162546f, 0.933538973f},
-std::array<float,2>{0.649168313f, 0.534416914f},
-std::array<float,2>{0.173022255f, 0.232188851f},
-std::array<float,2>{0.973304927f, 0.147941381f},
-std::array<float,2>{0.418998539f, 0.584615588f},
-std::array<float,2>{0.500540912f, 0.961234987f},
-std::array<float,2>{0.123953722f, 0.281806678f},
-std::array<float,2>{0.715313911f, 0.395693928f},
-std::array<float,2>{0.228184938f, 0.775898576f},
-std::array<float,2>{0.780191481f, 0.749319553f},
-std::array<float,2>{0.332842112f, 0.0974103659f},
-std::array<float,2>{0.65906918f, 0.211273775f},
-std::array<float,2>{0.136051387f, 0.504354894f},
-std::array<float,2>{0.827409685f, 0.888013005f},
-std::array<float,2>{0.265623719f, 0.367794901f},
-std::array<float,2>{0.925110817f, 0.445138961f},
-std::array<float,2>{0.452328742f, 0.831191182f},
-std::array<float,2>{0.582444489f, 0.658740103f},
-std::array<float,2>{0.0439141765f, 0.044471167f},
-std::array<float,2>{0.807765782f, 0.0815610662f},
-std::array<float,2>{0.350503862f, 0.707333922f},
-std::array<float,2>{0.748345852f, 0.803350031f},
-std::array<float,2>{0.196230024f, 0.408266515f},
-std::array<float,2>{0.560226977f, 0.267383814f},
-std::array<float,2>{0.0669957846f, 0.999592185f},
-std::array<float,2>{0.965043366f, 0.596137941f},
-std::array<float,2>{0.376417279f, 0.170414627f},
-std::array<float,2>{0.520843625f, 0.172932491f},
-std::array<float,2>{0.0998165011f, 0.61476779f},
-std::array<float,2>{0.994581938f, 0.976948678f},
-std::array<float,2>{0.42317155f, 0.262851357f},
-std::array<float,2>{0.751063883f, 0.422582448f},
-std::array<float,2>{0.31283161f, 0.786118805f},
-std::array<float,2>{0.69551158f, 0.699566066f},
-std::array<float,2>{0.238544181f, 0.0651204064f},
-std::array<float,2>{0.904840827f, 0.054515928f},
-std::array<float,2>{0.482690603f, 0.685534358f},
-std::array<float,2>{0.623563349f, 0.825886369f},
-std::array<float,2>{0.000901025545f, 0.456865102f},
-std::array<float,2>{0.635577321f, 0.356764972f},
-std::array<float,2>{0.157127991f, 0.897472918f},
-std::array<float,2>{0.87109679f, 0.530775428f},
-std::array<float,2>{0.306133062f, 0.201874405f},
-std::array<float,2>{0.719754398f, 0.12116617f},
-std::array<float,2>{0.205781415f, 0.718924999f},
-std::array<float,2>{0.782375455f, 0.755739272f},
-std::array<float,2>{0.371436834f, 0.375185698f},
-std::array<float,2>{0.951586604f, 0.307168901f},
-std::array<float,2>{0.392792612f, 0.953118384f},
-std::array<float,2>{0.531809866f, 0.569385529f},
-std::array<float,2>{0.080186449f, 0.139258474f},
-std::array<float,2>{0.840551853f, 0.244061708f},
-std::array<float,2>{0.268362731f, 0.549261987f},
-std::array<float,2>{0.687467039f, 0.918423593f},
-std::array<float,2>{0.152216882f, 0.330655426f},
-std::array<float,2>{0.566494405f, 0.498736203f},
-std::array<float,2>{0.0469847098f, 0.844855547f},
-std::array<float,2>{0.918702483f, 0.638619304f},
-std::array<float,2>{0.465894878f, 0.0013629297f},
-std::array<float,2>{0.619031966f, 0.104526997f},
-std::array<float,2>{0.00753162242f, 0.73713094f},
-std::array<float,2>{0.899719357f, 0.766614556f},
-std::array<float,2>{0.479294091f, 0.403372526f},
-std::array<float,2>{0.870159864f, 0.292784482f},
-std::array<float,2>{0.309893399f, 0.954123557f},
-std::array<float,2>{0.638052821f, 0.591276407f},
-std::array<float,2>{0.162196919f, 0.156060264f},
-std::array<float,2>{0.999632657f, 0.222225651f},
-std::array<float,2>{0.427473038f, 0.545973718f},
-std::array<float,2>{0.516278565f, 0.926326394f},
-std::array<float,2>{0.096380651f, 0.314653009f},
-std::array<float,2>{0.70006299f, 0.482679486f},
-std::array<float,2>{0.237287313f, 0.871956944f},
-std::array<float,2>{0.755445004f, 0.654131472f},
-std::array<float,2>{0.317398578f, 0.0242999196f},
-std::array<float,2>{0.682574034f, 0.164054334f},
-std::array<float,2>{0.153439194f, 0.601832807f},
-std::array<float,2>{0.837064743f, 0.988162458f},
-std::array<float,2>{0.271079838f, 0.277919948f},
-std::array<float,2>{0.915225804f, 0.414593816f},
-std::array<float,2>{0.461439162f, 0.807600319f},
-std::array<float,2>{0.564015806f, 0.71724844f},
-std::array<float,2>{0.0519369058f, 0.0902720839f},
-std::array<float,2>{0.786818802f, 0.0386794284f},
-std::array<float,2>{0.368862927f, 0.666725039f},
-std::array<float,2>{0.724913538f, 0.83987093f},
-std::array<float,2>{0.209276766f, 0.449676424f},
-std::array<float,2>{0.53658843f, 0.366544098f},
-std::array<float,2>{0.0853518695f, 0.876310825f},
-std::array<float,2>{0.94866097f, 0.514375567f},
-std::array<float,2>{0.397912651f, 0.203590408f},
-std::array<float,2>{0.507305086f, 0.194169492f},
-std::array<float,2>{0.120424733f, 0.522190392f},
-std::array<float,2>{0.970108509f, 0.900057971f},
-std::array<float,2>{0.415317327f, 0.345520675f},
-std::array<float,2>{0.7745502f, 0.463448256f},
-std::array<float,2>{0.329845428f, 0.81520468f},
-std::array<float,2>{0.713349164f, 0.67814678f},
-std::array<float,2>{0.230624214f, 0.0555020794f},
-std::array<float,2>{0.885589778f, 0.0706897452f},
-std::array<float,2>{0.494066417f, 0.69256264f},
-std::array<float,2>{0.597167432f, 0.790254235f},
-std::array<float,2>{0.0298682563f, 0.432516545f},
-std::array<float,2>{0.655311942f, 0.251057357f},
-std::array<float,2>{0.179524317f, 0.974690795f},
-std::array<float,2>{0.859276175f, 0.624022186f},
-std::array<float,2>{0.296392441f, 0.186109081f},
-std::array<float,2>{0.743349731f, 0.00786804315f},
-std::array<float,2>{0.203053534f, 0.63202405f},
-std::array<float,2>{0.808944583f, 0.852520108f},
-std::array<float,2>{0.347434133f, 0.486559123f},
-std::array<float,2>{0.963386536f, 0.339872062f},
-std::array<float,2>{0.380383015f, 0.91038245f},
-std::array<float,2>{0.555431128f, 0.562284172f},
-std::array<float,2>{0.0657631159f, 0.236611396f},
-std::array<float,2>{0.82225275f, 0.127765968f},
-std::array<float,2>{0.259676069f, 0.575127363f},
-std::array<float,2>{0.661557555f, 0.938683271f},
-std::array<float,2>{0.139310062f, 0.303395748f},
-std::array<float,2>{0.579320312f, 0.390275925f},
-std::array<float,2>{0.0415174738f, 0.757974088f},
-std::array<float,2>{0.929153383f, 0.729788423f},
-std::array<float,2>{0.4472799f, 0.116049014f},
-std::array<float,2>{0.553387582f, 0.0491220616f},
-std::array<float,2>{0.0762616321f, 0.681276977f},
-std::array<float,2>{0.960354447f, 0.823740721f},
-std::array<float,2>{0.388904333f, 0.460447371f},
-std::array<float,2>{0.799885094f, 0.351737261f},
-std::array<float,2>{0.354485691f, 0.891419768f},
-std::array<float,2>{0.736626744f, 0.523658633f},
-std::array<float,2>{0.188854769f, 0.19885467f},
-std::array<float,2>{0.936598837f, 0.176626861f},
-std::array<float,2>{0.441490352f, 0.611832857f},
-std::array<float,2>{0.591010869f, 0.980958939f},
-std::array<float,2>{0.0372815244f, 0.259900391f},
-std::array<float,2>{0.669201255f, 0.429255277f},
-std::array<float,2>{0.125136688f, 0.784263372f},
-std::array<float,2>{0.817986786f, 0.697952092f},
-std::array<float,2>{0.256094128f, 0.06644959f},
-std::array<float,2>{0.709459066f, 0.248508036f},
-std::array<float,2>{0.223745212f, 0.553304672f},
-std::array<float,2>{0.771036327f, 0.914103508f},
-std::array<float,2>{0.341531456f, 0.334975213f},
-std::array<float,2>{0.978695571f, 0.494285047f},
-std::array<float,2>{0.411640316f, 0.848776996f},
-std::array<float,2>{0.513835549f, 0.6364187f},
-std::array<float,2>{0.115329243f, 0.00541237416f},
-std::array<float,2>{0.846858144f, 0.118402429f},
-std::array<float,2>{0.288205266f, 0.724697232f},
-std::array<float,2>{0.647405863f, 0.753416359f},
-std::array<float,2>{0.179706201f, 0.379646093f},
-std::array<float,2>{0.60681057f, 0.310127974f},
-std::array<float,2>{0.0191529915f, 0.946945429f},
-std::array<float,2>{0.878562391f, 0.564503372f},
-std::array<float,2>{0.490830451f, 0.135976389f},
-std::array<float,2>{0.577878773f, 0.141797766f},
-std::array<float,2>{0.0573805124f, 0.580745518f},
-std::array<float,2>{0.913300693f, 0.967922866f},
-std::array<float,2>{0.455100238f, 0.28650257f},
-std::array<float,2>{0.831777513f, 0.392720103f},
-std::array<float,2>{0.273857594f, 0.780031919f},
-std::array<float,2>{0.672071934f, 0.745301425f},
-std::array<float,2>{0.144627601f, 0.0977747142f},
-std::array<float,2>{0.938003719f, 0.0214932412f},
-std::array<float,2>{0.402062327f, 0.645890117f},
-std::array<float,2>{0.543198347f, 0.862014711f},
-std::array<float,2>{0.0862909555f, 0.470829159f},
-std::array<float,2>{0.730772376f, 0.323923469f},
-std::array<float,2>{0.213152766f, 0.936760485f},
-std::array<float,2>{0.79245168f, 0.535769224f},
-std::array<float,2>{0.366633892f, 0.228909209f},
-std::array<float,2>{0.626975417f, 0.0828683004f},
-std::array<float,2>{0.170987993f, 0.70488745f},
-std::array<float,2>{0.861472547f, 0.79897356f},
-std::array<float,2>{0.2972036f, 0.412766248f},
-std::array<float,2>{0.892774701f, 0.269829363f},
-std::array<float,2>{0.471571863f, 0.993894339f},
-std::array<float,2>{0.614093006f, 0.6014148f},
-std::array<float,2>{0.0112107527f, 0.164916039f},
-std::array<float,2>{0.764235437f, 0.218280002f},
-std::array<float,2>{0.320509136f, 0.502922833f},
-std::array<float,2>{0.690092683f, 0.885669172f},
-std::array<float,2>{0.244298875f, 0.372474581f},
-std::array<float,2>{0.526658833f, 0.438248366f},
-std::array<float,2>{0.105167031f, 0.834738851f},
-std::array<float,2>{0.985791266f, 0.663577437f},
-std::array<float,2>{0.436410636f, 0.0417468771f},
-std::array<float,2>{0.521991313f, 0.0644759312f},
-std::array<float,2>{0.0992876366f, 0.699978232f},
-std::array<float,2>{0.99363482f, 0.785523832f},
-std::array<float,2>{0.42526871f, 0.422014654f},
-std::array<float,2>{0.752436459f, 0.263536215f},
-std::array<float,2>{0.315077335f, 0.977470875f},
-std::array<float,2>{0.699098527f, 0.614302576f},
-std::array<float,2>{0.24107419f, 0.173570067f},
-std::array<float,2>{0.904213488f, 0.201238245f},
-std::array<float,2>{0.480582088f, 0.530743599f},
-std::array<float,2>{0.622342288f, 0.898200035f},
-std::array<float,2>{0.00312905503f, 0.357417136f},
-std::array<float,2>{0.633702159f, 0.456421882f},
-std::array<float,2>{0.160057202f, 0.825432777f},
-std::array<float,2>{0.874503314f, 0.684824824f},
-std::array<float,2>{0.307376653f, 0.0537697822f},
-std::array<float,2>{0.721362233f, 0.139073625f},
-std::array<float,2>{0.203943908f, 0.570233703f},
-std::array<float,2>{0.785121918f, 0.952503622f},
-std::array<float,2>{0.374085486f, 0.306746453f},
-std::array<float,2>{0.95049274f, 0.375808388f},
-std::array<float,2>{0.391650856f, 0.754974961f},
-std::array<float,2>{0.53429687f, 0.719430685f},
-std::array<float,2>{0.078746222f, 0.121852703f},
-std::array<float,2>{0.843369901f, 0.00150248874f},
-std::array<float,2>{0.267498642f, 0.638008416f},
-std::array<float,2>{0.683995783f, 0.845229805f},
-std::array<float,2>{0.148501262f, 0.49805209f},
-std::array<float,2>{0.57029134f, 0.330165356f},
-std::array<float,2>{0.0501670726f, 0.918462873f},
-std::array<float,2>{0.920434833f, 0.54943794f},
-std::array<float,2>{0.468157411f, 0.243489563f},
-std::array<float,2>{0.600474119f, 0.231659204f},
-std::array<float,2>{0.0244514942f, 0.534907103f},
-std::array<float,2>{0.890072048f, 0.932957351f},
-std::array<float,2>{0.499463379f, 0.325533181f},
-std::array<float,2>{0.852950811f, 0.47406587f},
-std::array<float,2>{0.291061312f, 0.865232348f},
-std::array<float,2>{0.651668668f, 0.643761635f},
-std::array<float,2>{0.175435275f, 0.0169148054f},
-std::array<float,2>{0.974775195f, 0.0970851853f},
-std::array<float,2>{0.420678943f, 0.749711931f},
-std::array<float,2>{0.503000796f, 0.775521696f},
-std::array<float,2>{0.121885091f, 0.39645955f},
-std::array<float,2>{0.718018949f, 0.281615645f},
-std::array<float,2>{0.229270786f, 0.961766541f},
-std::array<float,2>{0.778840721f, 0.584026873f},
-std::array<float,2>{0.335307449f, 0.147986531f},
-std::array<float,2>{0.658057809f, 0.0443232059f},
-std::array<float,2>{0.133003116f, 0.658492923f},
-std::array<float,2>{0.825247824f, 0.831763804f},
-std::array<float,2>{0.2621544f, 0.444542885f},
-std::array<float,2>{0.922565281f, 0.36767453f},
-std::array<float,2>{0.449709624f, 0.888357043f},
-std::array<float,2>{0.585418046f, 0.504603386f},
-std::array<float,2>{0.0459089614f, 0.211504728f},
-std::array<float,2>{0.80620265f, 0.170254692f},
-std::array<float,2>{0.348806798f, 0.596502841f},
-std::array<float,2>{0.7464481f, 0.999275327f},
-std::array<float,2>{0.19745855f, 0.267059147f},
-std::array<float,2>{0.561025858f, 0.408827275f},
-std::array<float,2>{0.0695748478f, 0.80282563f},
-std::array<float,2>{0.968049884f, 0.707585514f},
-std::array<float,2>{0.377741992f, 0.0813423842f},
-std::array<float,2>{0.588885486f, 0.0284734666f},
-std::array<float,2>{0.0324665681f, 0.648738801f},
-std::array<float,2>{0.931024849f, 0.867636025f},
-std::array<float,2>{0.438078105f, 0.478114039f},
-std::array<float,2>{0.813616753f, 0.317929387f},
-std::array<float,2>{0.252775073f, 0.924205005f},
-std::array<float,2>{0.667877138f, 0.542737544f},
-std::array<float,2>{0.130043089f, 0.225337893f},
-std::array<float,2>{0.95513922f, 0.149925917f},
-std::array<float,2>{0.386693865f, 0.589231133f},
-std::array<float,2>{0.55057323f, 0.959742308f},
-std::array<float,2>{0.0738344193f, 0.294158638f},
-std::array<float,2>{0.740363836f, 0.400294065f},
-std::array<float,2>{0.193736523f, 0.769552648f},
-std::array<float,2>{0.800847113f, 0.740415156f},
-std::array<float,2>{0.355511457f, 0.106106736f},
-std::array<float,2>{0.642087877f, 0.207476214f},
-std::array<float,2>{0.186461419f, 0.507901073f},
-std::array<float,2>{0.848178864f, 0.88041693f},
-std::array<float,2>{0.281289071f, 0.363102645f},
-std::array<float,2>{0.878997862f, 0.447620928f},
-std::array<float,2>{0.48720783f, 0.83918339f},
-std::array<float,2>{0.603213668f, 0.669598162f},
-std::array<float,2>{0.0213613361f, 0.0338563472f},
-std::array<float,2>{0.766364753f, 0.0881366581f},
-std::array<float,2>{0.336309195f, 0.714697838f},
-std::array<float,2>{0.706464529f, 0.811861455f},
-std::array<float,2>{0.221098855f, 0.420558482f},
-std::array<float,2>{0.510848045f, 0.277214944f},
-std::array<float,2>{0.11276859f, 0.989902437f},
-std::array<float,2>{0.982230902f, 0.608073533f},
-std::array<float,2>{0.409505278f, 0.159268618f},
-std::array<float,2>{0.541866601f, 0.183459371f},
-std::array<float,2>{0.0911944658f, 0.618859947f},
-std::array<float,2>{0.944134235f, 0.972393572f},
-std::array<float,2>{0.405001193f, 0.257778615f},
-std::array<float,2>{0.793129623f, 0.433878481f},
-std::array<float,2>{0.362279117f, 0.795300186f},
-std::array<float,2>{0.727091432f, 0.689936757f},
-std::array<float,2>{0.215849683f, 0.0745081753f},
-std::array<float,2>{0.909485042f, 0.0603678375f},
-std::array<float,2>{0.459166348f, 0.674581289f},
-std::array<float,2>{0.573717237f, 0.819501638f},
-std::array<float,2>{0.0603485256f, 0.468100637f},
-std::array<float,2>{0.679520786f, 0.350109786f},
-std::array<float,2>{0.141799852f, 0.903545141f},
-std::array<float,2>{0.832328081f, 0.518558025f},
-std::array<float,2>{0.27988565f, 0.188715756f},
-std::array<float,2>{0.692061424f, 0.112645775f},
-std::array<float,2>{0.246664584f, 0.733075321f},
-std::array<float,2>{0.761536181f, 0.761984348f},
-std::array<float,2>{0.326132596f, 0.383469135f},
-std::array<float,2>{0.988868952f, 0.300663263f},
-std::array<float,2>{0.432835937f, 0.941748857f},
-std::array<float,2>{0.528725863f, 0.571399212f},
-std::array<float,2>{0.109236747f, 0.129657239f},
-std::array<float,2>{0.864209473f, 0.238907695f},
-std::array<float,2>{0.301757663f, 0.556874156f},
-std::array<float,2>{0.629267097f, 0.908581376f},
-std::array<float,2>{0.166341677f, 0.339716315f},
-std::array<float,2>{0.612102568f, 0.491195768f},
-std::array<float,2>{0.0125621744f, 0.857628047f},
-std::array<float,2>{0.897089064f, 0.626134336f},
-std::array<float,2>{0.475546688f, 0.0153240124f},
-std::array<float,2>{0.564692199f, 0.0921493843f},
-std::array<float,2>{0.0531398319f, 0.71519953f},
-std::array<float,2>{0.917551756f, 0.806020916f},
-std::array<float,2>{0.463723779f, 0.417093873f},
-std::array<float,2>{0.839749932f, 0.280169427f},
-std::array<float,2>{0.272229731f, 0.986289501f},
-std::array<float,2>{0.680762649f, 0.6049698f},
-std::array<float,2>{0.155664921f, 0.160764545f},
-std::array<float,2>{0.946425438f, 0.20507966f},
-std::array<float,2>{0.395102769f, 0.51347357f},
-std::array<float,2>{0.537960172f, 0.877138853f},
-std::array<float,2>{0.0831819251f, 0.365162998f},
-std::array<float,2>{0.723740399f, 0.452606678f},
-std::array<float,2>{0.207177445f, 0.842912912f},
-std::array<float,2>{0.788695157f, 0.665827215f},
-std::array<float,2>{0.369485438f, 0.036947865f},
-std::array<float,2>{0.639795542f, 0.153427228f},
-std::array<float,2>{0.161474183f, 0.591867149f},
-std::array<float,2>{0.868348777f, 0.956694663f},
-std::array<float,2>{0.312083095f, 0.290707022f},
-std::array<float,2>{0.901540518f, 0.406097472f},
-std::array<float,2>{0.478323638f, 0.769494295f},
-std::array<float,2>{0.620210767f, 0.735321581f},
-std::array<float,2>{0.00406106887f, 0.101761557f},
-std::array<float,2>{0.757077813f, 0.0271051843f},
-std::array<float,2>{0.318756968f, 0.654841185f},
-std::array<float,2>{0.702120662f, 0.874219537f},
-std::array<float,2>{0.234758645f, 0.482297361f},
-std::array<float,2>{0.517901957f, 0.313688606f},
-std::array<float,2>{0.0949347764f, 0.928472877f},
-std::array<float,2>{0.997147977f, 0.543056548f},
-std::array<float,2>{0.429447711f, 0.219070137f},
-std::array<float,2>{0.556674063f, 0.235424325f},
-std::array<float,2>{0.0637599453f, 0.560075283f},
-std::array<float,2>{0.961327434f, 0.912642241f},
-std::array<float,2>{0.3810727f, 0.341929704f},
-std::array<float,2>{0.810757935f, 0.485569984f},
-std::array<float,2>{0.345313877f, 0.85491401f},
-std::array<float,2>{0.745683312f, 0.629834712f},
-std::array<float,2>{0.20105423f, 0.010919407f},
-std::array<float,2>{0.925942719f, 0.115029544f},
-std::array<float,2>{0.445759565f, 0.726835787f},
-std::array<float,2>{0.580433071f, 0.761203945f},
-std::array<float,2>{0.0392770544f, 0.38692829f},
-std::array<float,2>{0.662271559f, 0.301544458f},
-std::array<float,2>{0.138400391f, 0.941369712f},
-std::array<float,2>{0.823544919f, 0.577706754f},
-std::array<float,2>{0.259829819f, 0.12592195f},
-std::array<float,2>{0.712372065f, 0.0577261373f},
-std::array<float,2>{0.23380211f, 0.676048875f},
-std::array<float,2>{0.775395632f, 0.813289285f},
-std::array<float,2>{0.331181198f, 0.46269244f},
-std::array<float,2>{0.971617758f, 0.346335799f},
-std::array<float,2>{0.41652742f, 0.901382327f},
-std::array<float,2>{0.505136132f, 0.521397233f},
-std::array<float,2>{0.117881827f, 0.193169564f},
-std::array<float,2>{0.856870115f, 0.184197456f},
-std::array<float,2>{0.294109702f, 0.623016059f},
-std::array<float,2>{0.652659714f, 0.973828435f},
-std::array<float,2>{0.176934138f, 0.252959371f},
-std::array<float,2>{0.595494688f, 0.430663228f},
-std::array<float,2>{0.0275114309f, 0.792031586f},
-std::array<float,2>{0.884382248f, 0.695091546f},
-std::array<float,2>{0.495525926f, 0.0740099102f},
-std::array<float,2>{0.511750996f, 0.00771566015f},
-std::array<float,2>{0.114877537f, 0.634262562f},
-std::array<float,2>{0.97705549f, 0.849772334f},
-std::array<float,2>{0.413981408f, 0.493372798f},
-std::array<float,2>{0.772215366f, 0.333710283f},
-std::array<float,2>{0.343083829f, 0.916493952f},
-std::array<float,2>{0.707071722f, 0.552390695f},
-std::array<float,2>{0.224723071f, 0.24629806f},
-std::array<float,2>{0.876786351f, 0.133535877f},
-std::array<float,2>{0.490199983f, 0.564434648f},
-std::array<float,2>{0.607521892f, 0.948335171f},
-std::array<float,2>{0.0165781751f, 0.312238336f},
-std::array<float,2>{0.646015584f, 0.381537974f},
-std::array<float,2>{0.182590336f, 0.750573516f},
-std::array<float,2>{0.8440274f, 0.724197626f},
-std::array<float,2>{0.285866797f, 0.119692765f},
-std::array<float,2>{0.735782266f, 0.195868194f},
-std::array<float,2>{0.190090418f, 0.527334034f},
-std::array<float,2>{0.797308266f, 0.894034147f},
-std::array<float,2>{0.353021592f, 0.354904145f},
-std::array<float,2>{0.958282769f, 0.457206368f},
-std::array<float,2>{0.388413608f, 0.82062614f},
-std::array<float,2>{0.552369237f, 0.682132304f},
-std::array<float,2>{0.0747083202f, 0.0486108176f},
-std::array<float,2>{0.818549752f, 0.0689084232f},
-std::array<float,2>{0.254090667f, 0.695540965f},
-std::array<float,2>{0.670730233f, 0.781857491f},
-std::array<float,2>{0.128154889f, 0.426505804f},
-std::array<float,2>{0.592784822f, 0.258678317f},
-std::array<float,2>{0.0358288921f, 0.984149575f},
-std::array<float,2>{0.934258044f, 0.609398484f},
-std::array<float,2>{0.443851262f, 0.179165691f},
-std::array<float,2>{0.615740299f, 0.166271448f},
-std::array<float,2>{0.00930328667f, 0.59819144f},
-std::array<float,2>{0.89119333f, 0.994964838f},
-std::array<float,2>{0.469146907f, 0.2730501f},
-std::array<float,2>{0.860822618f, 0.411408573f},
-std::array<float,2>{0.298995972f, 0.79845643f},
-std::array<float,2>{0.625601292f, 0.706150591f},
-std::array<float,2>{0.168334618f, 0.084474951f},
-std::array<float,2>{0.98717916f, 0.0409946479f},
-std::array<float,2>{0.434356987f, 0.660255015f},
-std::array<float,2>{0.524895132f, 0.83391124f},
-std::array<float,2>{0.10172227f, 0.440483809f},
-std::array<float,2>{0.687863469f, 0.373857528f},
-std::array<float,2>{0.243968785f, 0.883222997f},
-std::array<float,2>{0.762572944f, 0.501712739f},
-std::array<float,2>{0.322455287f, 0.215385899f},
-std::array<float,2>{0.675037265f, 0.101552263f},
-std::array<float,2>{0.147782892f, 0.742935061f},
-std::array<float,2>{0.829877317f, 0.778257906f},
-std::array<float,2>{0.27567482f, 0.392160714f},
-std::array<float,2>{0.911658764f, 0.28747496f},
-std::array<float,2>{0.453748614f, 0.965201616f},
-std::array<float,2>{0.575526416f, 0.578868926f},
-std::array<float,2>{0.055210378f, 0.143297672f},
-std::array<float,2>{0.789238095f, 0.228017107f},
-std::array<float,2>{0.364158422f, 0.538936138f},
-std::array<float,2>{0.733002126f, 0.935330093f},
-std::array<float,2>{0.212370172f, 0.320594162f},
-std::array<float,2>{0.545079768f, 0.470664293f},
-std::array<float,2>{0.0884175599f, 0.859881461f},
-std::array<float,2>{0.941138685f, 0.647759318f},
-std::array<float,2>{0.399195343f, 0.0204412863f},
-std::array<float,2>{0.531688333f, 0.124670371f},
-std::array<float,2>{0.0807525963f, 0.721285641f},
-std::array<float,2>{0.951971829f, 0.757746637f},
-std::array<float,2>{0.393440306f, 0.377353936f},
-std::array<float,2>{0.782884181f, 0.305126846f},
-std::array<float,2>{0.371988147f, 0.951132834f},
-std::array<float,2>{0.72049433f, 0.56762886f},
-std::array<float,2>{0.205271646f, 0.138483927f},
-std::array<float,2>{0.918347776f, 0.245311797f},
-std::array<float,2>{0.466724247f, 0.547771931f},
-std::array<float,2>{0.567172706f, 0.921169043f},
-std::array<float,2>{0.0474671312f, 0.328318417f},
-std::array<float,2>{0.687010348f, 0.497024626f},
-std::array<float,2>{0.151591972f, 0.847481132f},
-std::array<float,2>{0.840108931f, 0.64054215f},
-std::array<float,2>{0.267990947f, 0.00221213698f},
-std::array<float,2>{0.695875227f, 0.175038204f},
-std::array<float,2>{0.23915714f, 0.615823269f},
-std::array<float,2>{0.751848876f, 0.978971601f},
-std::array<float,2>{0.3131392f, 0.264350414f},
-std::array<float,2>{0.995008767f, 0.425603032f},
-std::array<float,2>{0.423462957f, 0.788906038f},
-std::array<float,2>{0.521420956f, 0.701215804f},
-std::array<float,2>{0.100509241f, 0.062623322f},
-std::array<float,2>{0.871604383f, 0.051508233f},
-std::array<float,2>{0.306570709f, 0.687004268f},
-std::array<float,2>{0.634889722f, 0.826446831f},
-std::array<float,2>{0.156642452f, 0.453866243f},
-std::array<float,2>{0.623413444f, 0.358823001f},
-std::array<float,2>{0.000321872067f, 0.895667553f},
-std::array<float,2>{0.904600024f, 0.527916253f},
-std::array<float,2>{0.483218938f, 0.200757936f},
-std::array<float,2>{0.582940042f, 0.214665413f},
-std::array<float,2>{0.043186862f, 0.506000519f},
-std::array<float,2>{0.925495744f, 0.889523447f},
-std::array<float,2>{0.453114748f, 0.37095511f},
-std::array<float,2>{0.827660918f, 0.442738444f},
-std::array<float,2>{0.265042216f, 0.828432918f},
-std::array<float,2>{0.658235312f, 0.657546997f},
-std::array<float,2>{0.136333868f, 0.0468369983f},
-std::array<float,2>{0.965613067f, 0.0789766461f},
-std::array<float,2>{0.376637578f, 0.710556746f},
-std::array<float,2>{0.559678793f, 0.801363885f},
-std::array<float,2>{0.0664783567f, 0.406420916f},
-std::array<float,2>{0.748831868f, 0.268597096f},
-std::array<float,2>{0.195712134f, 0.997362196f},
-std::array<float,2>{0.808327138f, 0.593951404f},
-std::array<float,2>{0.350084931f, 0.167988718f},
-std::array<float,2>{0.648784041f, 0.0191862751f},
-std::array<float,2>{0.173605084f, 0.641723454f},
-std::array<float,2>{0.8544119f, 0.866277993f},
-std::array<float,2>{0.289975256f, 0.475563705f},
-std::array<float,2>{0.88762331f, 0.327619582f},
-std::array<float,2>{0.496303797f, 0.931301177f},
-std::array<float,2>{0.598438978f, 0.53222388f},
-std::array<float,2>{0.025894016f, 0.232809633f},
-std::array<float,2>{0.779455662f, 0.146341681f},
-std::array<float,2>{0.332166523f, 0.582218945f},
-std::array<float,2>{0.71552211f, 0.964532614f},
-std::array<float,2>{0.227983758f, 0.284387678f},
-std::array<float,2>{0.50023514f, 0.397282183f},
-std::array<float,2>{0.123531073f, 0.77396518f},
-std::array<float,2>{0.973099947f, 0.747528791f},
-std::array<float,2>{0.419460177f, 0.0950770378f},
-std::array<float,2>{0.605294466f, 0.0325640291f},
-std::array<float,2>{0.022714192f, 0.670184612f},
-std::array<float,2>{0.881631434f, 0.837363005f},
-std::array<float,2>{0.485098302f, 0.446283191f},
-std::array<float,2>{0.85013181f, 0.361309648f},
-std::array<float,2>{0.284521192f, 0.881863534f},
-std::array<float,2>{0.642928958f, 0.510252893f},
-std::array<float,2>{0.183924526f, 0.210321769f},
-std::array<float,2>{0.983137667f, 0.156823814f},
-std::array<float,2>{0.40678975f, 0.606514931f},
-std::array<float,2>{0.509719968f, 0.991086602f},
-std::array<float,2>{0.109695904f, 0.273912221f},
-std::array<float,2>{0.704548478f, 0.418478042f},
-std::array<float,2>{0.220436677f, 0.810238779f},
-std::array<float,2>{0.768872142f, 0.711054385f},
-std::array<float,2>{0.339320034f, 0.086100921f},
-std::array<float,2>{0.665592551f, 0.223466471f},
-std::array<float,2>{0.132557154f, 0.540888369f},
-std::array<float,2>{0.814576924f, 0.922495782f},
-std::array<float,2>{0.251936793f, 0.319512188f},
-std::array<float,2>{0.932997704f, 0.479068279f},
-std::array<float,2>{0.441028595f, 0.870613098f},
-std::array<float,2>{0.587289631f, 0.651895165f},
-std::array<float,2>{0.0338463895f, 0.0303806867f},
-std::array<float,2>{0.803027093f, 0.10844487f},
-std::array<float,2>{0.357561111f, 0.738952339f},
-std::array<float,2>{0.739073098f, 0.772464335f},
-std::array<float,2>{0.193036154f, 0.40155834f},
-std::array<float,2>{0.547038794f, 0.295944184f},
-std::array<float,2>{0.0704536289f, 0.958313823f},
-std::array<float,2>{0.953971088f, 0.586661875f},
-std::array<float,2>{0.383352846f, 0.151803374f},
-std::array<float,2>{0.529564261f, 0.132223219f},
-std::array<float,2>{0.106419988f, 0.57269752f},
-std::array<float,2>{0.991796613f, 0.945291102f},
-std::array<float,2>{0.430915952f, 0.298120856f},
-std::array<float,2>{0.759208739f, 0.386560678f},
-std::array<float,2>{0.327122182f, 0.764962196f},
-std::array<float,2>{0.693423569f, 0.732138336f},
-std::array<float,2>{0.248886928f, 0.110333323f},
-std::array<float,2>{0.894885182f, 0.0128507642f},
-std::array<float,2>{0.474360079f, 0.627331078f},
-std::array<float,2>{0.609375f, 0.856490254f},
-std::array<float,2>{0.0140293529f, 0.488787293f},
-std::array<float,2>{0.631140172f, 0.337161541f},
-std::array<float,2>{0.164266601f, 0.90742439f},
-std::array<float,2>{0.865836263f, 0.556313396f},
-std::array<float,2>{0.303422272f, 0.240516573f},
-std::array<float,2>{0.729500473f, 0.078010194f},
-std::array<float,2>{0.217178434f, 0.687704146f},
-std::array<float,2>{0.795576453f, 0.794664621f},
-std::array<float,2>{0.359669685f, 0.437087744f},
-std::array<float,2>{0.941993237f, 0.255488873f},
-std::array<float,2>{0.402991354f, 0.969378054f},
-std::array<float,2>{0.539810836f, 0.620825529f},
-std::array<float,2>{0.0936898738f, 0.181277439f},
-std::array<float,2>{0.834910214f, 0.189935282f},
-std::array<float,2>{0.278780639f, 0.515794039f},
-std::array<float,2>{0.676342726f, 0.904601574f},
-std::array<float,2>{0.144057736f, 0.348378301f},
-std::array<float,2>{0.571491063f, 0.46662268f},
-std::array<float,2>{0.0619273931f, 0.81829083f},
-std::array<float,2>{0.906323254f, 0.672729671f},
-std::array<float,2>{0.458818316f, 0.0606940836f},
-std::array<float,2>{0.595730186f, 0.0731210858f},
-std::array<float,2>{0.0309029352f, 0.693611383f},
-std::array<float,2>{0.886634231f, 0.791740119f},
-std::array<float,2>{0.49288404f, 0.431007922f},
-std::array<float,2>{0.858169973f, 0.252123594f},
-std::array<float,2>{0.295779169f, 0.972704411f},
-std::array<float,2>{0.655245721f, 0.621986032f},
-std::array<float,2>{0.178018823f, 0.184666827f},
-std::array<float,2>{0.969550014f, 0.192000613f},
-std::array<float,2>{0.414556235f, 0.519835532f},
-std::array<float,2>{0.505893528f, 0.901230037f},
-std::array<float,2>{0.119918562f, 0.347218424f},
-std::array<float,2>{0.714062214f, 0.461232096f},
-std::array<float,2>{0.232221678f, 0.814430952f},
-std::array<float,2>{0.773578107f, 0.677616596f},
-std::array<float,2>{0.329077035f, 0.0569571033f},
-std::array<float,2>{0.660422266f, 0.126057103f},
-std::array<float,2>{0.139718369f, 0.576302648f},
-std::array<float,2>{0.820795298f, 0.939522982f},
-std::array<float,2>{0.258361071f, 0.302072316f},
-std::array<float,2>{0.927914679f, 0.388655514f},
-std::array<float,2>{0.44884333f, 0.759789526f},
-std::array<float,2>{0.578249991f, 0.727657139f},
-std::array<float,2>{0.0429394729f, 0.113719322f},
-std::array<float,2>{0.810460746f, 0.0105240364f},
-std::array<float,2>{0.346342057f, 0.630819559f},
-std::array<float,2>{0.742861986f, 0.853770256f},
-std::array<float,2>{0.201563671f, 0.485062808f},
-std::array<float,2>{0.555994511f, 0.343114763f},
-std::array<float,2>{0.0649582222f, 0.913505375f},
-std::array<float,2>{0.964657545f, 0.558823586f},
-std::array<float,2>{0.379643172f, 0.234458268f},
-std::array<float,2>{0.517117023f, 0.22037518f},
-std::array<float,2>{0.0974926054f, 0.544653654f},
-std::array<float,2>{0.998319805f, 0.929028988f},
-std::array<float,2>{0.426030785f, 0.312678903f},
-std::array<float,2>{0.754790187f, 0.480730921f},
-std::array<float,2>{0.316645235f, 0.873242795f},
-std::array<float,2>{0.700652361f, 0.65544188f},
-std::array<float,2>{0.238052592f, 0.0262211673f},
-std::array<float,2>{0.898738384f, 0.103371255f},
-std::array<float,2>{0.479494989f, 0.735929966f},
-std::array<float,2>{0.617898524f, 0.767618775f},
-std::array<float,2>{0.00674015889f, 0.405100137f},
-std::array<float,2>{0.637293994f, 0.289484054f},
-std::array<float,2>{0.1635627f, 0.955901325f},
-std::array<float,2>{0.869883537f, 0.593646228f},
-std::array<float,2>{0.309359699f, 0.15301922f},
-std::array<float,2>{0.725630105f, 0.0351773202f},
-std::array<float,2>{0.210041016f, 0.664814115f},
-std::array<float,2>{0.785812378f, 0.842075169f},
-std::array<float,2>{0.368068814f, 0.451468199f},
-std::array<float,2>{0.947474718f, 0.363399893f},
-std::array<float,2>{0.39695251f, 0.87886405f},
-std::array<float,2>{0.53520751f, 0.512609661f},
-std::array<float,2>{0.0847544968f, 0.206506997f},
-std::array<float,2>{0.836386561f, 0.161917254f},
-std::array<float,2>{0.269731224f, 0.604325652f},
-std::array<float,2>{0.683417559f, 0.984805584f},
-std::array<float,2>{0.153021544f, 0.28076908f},
-std::array<float,2>{0.563073754f, 0.416559041f},
-std::array<float,2>{0.0512581356f, 0.805223525f},
-std::array<float,2>{0.914610922f, 0.716292143f},
-std::array<float,2>{0.462644964f, 0.0934225395f},
-std::array<float,2>{0.544017732f, 0.0205350686f},
-std::array<float,2>{0.0878481343f, 0.646534145f},
-std::array<float,2>{0.939391971f, 0.860673845f},
-std::array<float,2>{0.400581867f, 0.468997478f},
-std::array<float,2>{0.791086197f, 0.321859002f},
-std::array<float,2>{0.36523667f, 0.933635712f},
-std::array<float,2>{0.732119083f, 0.537964106f},
-std::array<float,2>{0.214128703f, 0.227316096f},
-std::array<float,2>{0.91217494f, 0.144139156f},
-std::array<float,2>{0.456670761f, 0.579482794f},
-std::array<float,2>{0.576428831f, 0.966745257f},
-std::array<float,2>{0.0581673644f, 0.288353771f},
-std::array<float,2>{0.67332226f, 0.391468078f},
-std::array<float,2>{0.146101207f, 0.77925539f},
-std::array<float,2>{0.830498397f, 0.743318617f},
-std::array<float,2>{0.274688482f, 0.0996900946f},
-std::array<float,2>{0.690964162f, 0.21634385f},
-std::array<float,2>{0.24581036f, 0.50033462f},
-std::array<float,2>{0.764922559f, 0.884397626f},
-std::array<float,2>{0.322048247f, 0.374887377f},
-std::array<float,2>{0.984745443f, 0.440147042f},
-std::array<float,2>{0.437173992f, 0.832991481f},
-std::array<float,2>{0.525415242f, 0.662037611f},
-std::array<float,2>{0.104100958f, 0.0396771953f},
-std::array<float,2>{0.862882555f, 0.0850501284f},
-std::array<float,2>{0.298210233f, 0.706014037f},
-std::array<float,2>{0.628847361f, 0.79775697f},
-std::array<float,2>{0.170597479f, 0.411008775f},
-std::array<float,2>{0.614290953f, 0.272128493f},
-std::array<float,2>{0.0104302838f, 0.995413721f},
-std::array<float,2>{0.893849075f, 0.599003315f},
-std::array<float,2>{0.471904576f, 0.167526022f},
-std::array<float,2>{0.589899659f, 0.178176388f},
-std::array<float,2>{0.0382667184f, 0.610856235f},
-std::array<float,2>{0.936507463f, 0.982715428f},
-std::array<float,2>{0.443288296f, 0.259287238f},
-std::array<float,2>{0.816495121f, 0.427553058f},
-std::array<float,2>{0.257296294f, 0.782668948f},
-std::array<float,2>{0.66874516f, 0.697016597f},
-std::array<float,2>{0.126798779f, 0.070296146f},
-std::array<float,2>{0.95978415f, 0.0477088131f},
-std::array<float,2>{0.390396327f, 0.682884216f},
-std::array<float,2>{0.554005504f, 0.822077215f},
-std::array<float,2>{0.0774999186f, 0.458910793f},
-std::array<float,2>{0.73778224f, 0.354071379f},
-std::array<float,2>{0.188181549f, 0.892605186f},
-std::array<float,2>{0.799035847f, 0.525524139f},
-std::array<float,2>{0.355006516f, 0.196358547f},
-std::array<float,2>{0.648006141f, 0.121036038f},
-std::array<float,2>{0.180761456f, 0.723495662f},
-std::array<float,2>{0.8459149f, 0.751038253f},
-std::array<float,2>{0.287736118f, 0.382524341f},
-std::array<float,2>{0.877044737f, 0.310694247f},
-std::array<float,2>{0.491274834f, 0.948060989f},
-std::array<float,2>{0.605488837f, 0.562864661f},
-std::array<float,2>{0.0182461422f, 0.134312958f},
-std::array<float,2>{0.769964516f, 0.247447759f},
-std::array<float,2>{0.340025187f, 0.55111438f},
-std::array<float,2>{0.710359573f, 0.917276859f},
-std::array<float,2>{0.223238125f, 0.332427055f},
-std::array<float,2>{0.515267611f, 0.492310435f},
-std::array<float,2>{0.117034942f, 0.851327837f},
-std::array<float,2>{0.980238676f, 0.633211493f},
-std::array<float,2>{0.410506815f, 0.00671304483f},
-std::array<float,2>{0.501980722f, 0.0944244117f},
-std::array<float,2>{0.122329742f, 0.746993065f},
-std::array<float,2>{0.976428926f, 0.77477932f},
-std::array<float,2>{0.421501487f, 0.398159385f},
-std::array<float,2>{0.778052807f, 0.283996612f},
-std::array<float,2>{0.334071815f, 0.963023901f},
-std::array<float,2>{0.717306197f, 0.583495736f},
-std::array<float,2>{0.230102554f, 0.145459518f},
-std::array<float,2>{0.889281571f, 0.234265462f},
-std::array<float,2>{0.498147994f, 0.532928169f},
-std::array<float,2>{0.601560414f, 0.930540383f},
-std::array<float,2>{0.0237103924f, 0.326828927f},
-std::array<float,2>{0.651028395f, 0.476300061f},
-std::array<float,2>{0.174630612f, 0.865574419f},
-std::array<float,2>{0.852293491f, 0.640781403f},
-std::array<float,2>{0.292271286f, 0.0181403328f},
-std::array<float,2>{0.747875512f, 0.169600159f},
-std::array<float,2>{0.199054703f, 0.594742119f},
-std::array<float,2>{0.804816186f, 0.996865034f},
-std::array<float,2>{0.348226815f, 0.26805079f},
-std::array<float,2>{0.967448056f, 0.407906055f},
-std::array<float,2>{0.378862679f, 0.802631915f},
-std::array<float,2>{0.562451422f, 0.709513485f},
-std::array<float,2>{0.0686352775f, 0.079353258f},
-std::array<float,2>{0.825085342f, 0.0451878347f},
-std::array<float,2>{0.263627946f, 0.656619608f},
-std::array<float,2>{0.656300664f, 0.830024779f},
-std::array<float,2>{0.134646922f, 0.441575021f},
-std::array<float,2>{0.584449053f, 0.369808286f},
-std::array<float,2>{0.0458464921f, 0.890202701f},
-std::array<float,2>{0.923313022f, 0.507103384f},
-std::array<float,2>{0.450281411f, 0.212953001f},
-std::array<float,2>{0.621559083f, 0.199840993f},
-std::array<float,2>{0.00263335137f, 0.528817892f},
-std::array<float,2>{0.902866662f, 0.894568026f},
-std::array<float,2>{0.482375443f, 0.357948095f},
-std::array<float,2>{0.873409748f, 0.454956293f},
-std::array<float,2>{0.308527887f, 0.827432156f},
-std::array<float,2>{0.633859217f, 0.685928226f},
-std::array<float,2>{0.15903537f, 0.0520923883f},
-std::array<float,2>{0.992589891f, 0.0642403066f},
-std::array<float,2>{0.424261719f, 0.702578545f},
-std::array<float,2>{0.523174047f, 0.787757456f},
-std::array<float,2>{0.0983015299f, 0.4240022f},
-std::array<float,2>{0.697523594f, 0.264988869f},
-std::array<float,2>{0.242143154f, 0.980397105f},
-std::array<float,2>{0.75314796f, 0.616466701f},
-std::array<float,2>{0.315824717f, 0.173970908f},
-std::array<float,2>{0.685266256f, 0.00314248889f},
-std::array<float,2>{0.149927795f, 0.639590621f},
-std::array<float,2>{0.84252876f, 0.846146524f},
-std::array<float,2>{0.266008377f, 0.4980416f},
-std::array<float,2>{0.921647131f, 0.329304665f},
-std::array<float,2>{0.466865093f, 0.920586407f},
-std::array<float,2>{0.568630278f, 0.548696876f},
-std::array<float,2>{0.0492032357f, 0.244513646f},
-std::array<float,2>{0.783642352f, 0.137581885f},
-std::array<float,2>{0.373196632f, 0.566886604f},
-std::array<float,2>{0.721987009f, 0.949601591f},
-std::array<float,2>{0.204925656f, 0.3059825f},
-std::array<float,2>{0.534156144f, 0.378011972f},
-std::array<float,2>{0.0796600208f, 0.7567963f},
-std::array<float,2>{0.949840724f, 0.722505212f},
-std::array<float,2>{0.391344815f, 0.123810418f},
-std::array<float,2>{0.572592616f, 0.0623836815f},
-std::array<float,2>{0.0592418648f, 0.673038363f},
-std::array<float,2>{0.909143925f, 0.817376316f},
-std::array<float,2>{0.460186839f, 0.465009004f},
-std::array<float,2>{0.833214462f, 0.349167198f},
-std::array<float,2>{0.280971169f, 0.905542791f},
-std::array<float,2>{0.678454816f, 0.517054439f},
-std::array<float,2>{0.141175106f, 0.190466866f},
-std::array<float,2>{0.94481951f, 0.179758862f},
-std::array<float,2>{0.406191707f, 0.620033145f},
-std::array<float,2>{0.542573512f, 0.970617056f},
-std::array<float,2>{0.0906179175f, 0.254681498f},
-std::array<float,2>{0.728015304f, 0.435869932f},
-std::array<float,2>{0.215741277f, 0.793275595f},
-std::array<float,2>{0.79422015f, 0.689442635f},
-std::array<float,2>{0.362528652f, 0.0766763166f},
-std::array<float,2>{0.630275428f, 0.24130328f},
-std::array<float,2>{0.167543516f, 0.555531144f},
-std::array<float,2>{0.864263594f, 0.906518996f},
-std::array<float,2>{0.302589923f, 0.336663693f},
-std::array<float,2>{0.897546411f, 0.490212739f},
-std::array<float,2>{0.475930631f, 0.8555637f},
-std::array<float,2>{0.612715304f, 0.628748298f},
-std::array<float,2>{0.0128927678f, 0.0123141771f},
-std::array<float,2>{0.759778082f, 0.111008614f},
-std::array<float,2>{0.324435741f, 0.731074572f},
-std::array<float,2>{0.693314254f, 0.764192998f},
-std::array<float,2>{0.247211099f, 0.385466397f},
-std::array<float,2>{0.527397275f, 0.297752202f},
-std::array<float,2>{0.107951932f, 0.943724632f},
-std::array<float,2>{0.989388764f, 0.573928773f},
-std::array<float,2>{0.431777567f, 0.131500199f},
-std::array<float,2>{0.548905194f, 0.150733173f},
-std::array<float,2>{0.0722763464f, 0.586966336f},
-std::array<float,2>{0.957010984f, 0.957161009f},
-std::array<float,2>{0.385320216f, 0.295697361f},
-std::array<float,2>{0.80179286f, 0.401017785f},
-std::array<float,2>{0.356958151f, 0.771687746f},
-std::array<float,2>{0.742046654f, 0.73987788f},
-std::array<float,2>{0.194454044f, 0.108349644f},
-std::array<float,2>{0.929810882f, 0.0301762018f},
-std::array<float,2>{0.438944042f, 0.65065676f},
-std::array<float,2>{0.588649511f, 0.869368911f},
-std::array<float,2>{0.0319858491f, 0.480040371f},
-std::array<float,2>{0.666841745f, 0.318626374f},
-std::array<float,2>{0.129111499f, 0.923342764f},
-std::array<float,2>{0.812859714f, 0.539333165f},
-std::array<float,2>{0.253792226f, 0.223908558f},
-std::array<float,2>{0.705339253f, 0.0874088034f},
-std::array<float,2>{0.221998155f, 0.711998284f},
-std::array<float,2>{0.767065346f, 0.809051096f},
-std::array<float,2>{0.337746054f, 0.419052303f},
-std::array<float,2>{0.98100841f, 0.27461493f},
-std::array<float,2>{0.408647358f, 0.991847813f},
-std::array<float,2>{0.510614693f, 0.606139719f},
-std::array<float,2>{0.111576416f, 0.158172011f},
-std::array<float,2>{0.849087954f, 0.209683105f},
-std::array<float,2>{0.282593906f, 0.511195183f},
-std::array<float,2>{0.640961826f, 0.881548584f},
-std::array<float,2>{0.186911702f, 0.360290855f},
-std::array<float,2>{0.601635098f, 0.446792334f},
-std::array<float,2>{0.0195910614f, 0.836121261f},
-std::array<float,2>{0.880286396f, 0.671104133f},
-std::array<float,2>{0.488163561f, 0.0320049599f},
-std::array<float,2>{0.581060588f, 0.116653688f},
-std::array<float,2>{0.0407395512f, 0.729297638f},
-std::array<float,2>{0.927292883f, 0.759210587f},
-std::array<float,2>{0.447198838f, 0.388898849f},
-std::array<float,2>{0.822686017f, 0.303881884f},
-std::array<float,2>{0.260876149f, 0.93845439f},
-std::array<float,2>{0.663476288f, 0.575849712f},
-std::array<float,2>{0.137610793f, 0.128076881f},
-std::array<float,2>{0.962469578f, 0.238088474f},
-std::array<float,2>{0.381929785f, 0.56087786f},
-std::array<float,2>{0.558053195f, 0.911671519f},
-std::array<float,2>{0.0627160519f, 0.341572136f},
-std::array<float,2>{0.744881272f, 0.488043964f},
-std::array<float,2>{0.200018823f, 0.852552056f},
-std::array<float,2>{0.812080801f, 0.631008208f},
-std::array<float,2>{0.344189107f, 0.00927629136f},
-std::array<float,2>{0.654147327f, 0.18749015f},
-std::array<float,2>{0.176320791f, 0.624155998f},
-std::array<float,2>{0.855496287f, 0.97607857f},
-std::array<float,2>{0.29367879f, 0.250310004f},
-std::array<float,2>{0.882950902f, 0.433229506f},
-std::array<float,2>{0.494895309f, 0.789745033f},
-std::array<float,2>{0.594210088f, 0.692084014f},
-std::array<float,2>{0.0286810137f, 0.0719743073f},
-std::array<float,2>{0.776726782f, 0.0560090654f},
-std::array<float,2>{0.330175966f, 0.678851366f},
-std::array<float,2>{0.711880267f, 0.816011727f},
-std::array<float,2>{0.23293826f, 0.464090377f},
-std::array<float,2>{0.504474521f, 0.344372034f},
-std::array<float,2>{0.118214883f, 0.899388194f},
-std::array<float,2>{0.971723318f, 0.523396552f},
-std::array<float,2>{0.417819649f, 0.194814324f},
-std::array<float,2>{0.538792193f, 0.204109222f},
-std::array<float,2>{0.0826690719f, 0.515034199f},
-std::array<float,2>{0.945711851f, 0.875805199f},
-std::array<float,2>{0.396314889f, 0.365602285f},
-std::array<float,2>{0.787688732f, 0.4507218f},
-std::array<float,2>{0.37017563f, 0.841023266f},
-std::array<float,2>{0.723265171f, 0.66765511f},
-std::array<float,2>{0.20877713f, 0.0380409062f},
-std::array<float,2>{0.916791737f, 0.0915125161f},
-std::array<float,2>{0.464497417f, 0.718300402f},
-std::array<float,2>{0.565651119f, 0.808058739f},
-std::array<float,2>{0.0541259199f, 0.415118426f},
-std::array<float,2>{0.680155993f, 0.278687984f},
-std::array<float,2>{0.154819027f, 0.987007797f},
-std::array<float,2>{0.837934375f, 0.603091061f},
-std::array<float,2>{0.272523731f, 0.163007304f},
-std::array<float,2>{0.702169418f, 0.0247484297f},
-std::array<float,2>{0.23592332f, 0.653205514f},
-std::array<float,2>{0.756417632f, 0.872935534f},
-std::array<float,2>{0.31945473f, 0.483837217f},
-std::array<float,2>{0.996928096f, 0.315526217f},
-std::array<float,2>{0.428380638f, 0.926800191f},
-std::array<float,2>{0.519483924f, 0.545000613f},
-std::array<float,2>{0.0944684148f, 0.221473411f},
-std::array<float,2>{0.867306292f, 0.154518291f},
-std::array<float,2>{0.310927391f, 0.59010762f},
-std::array<float,2>{0.639481366f, 0.953501761f},
-std::array<float,2>{0.160674646f, 0.291837215f},
-std::array<float,2>{0.619153798f, 0.403308749f},
-std::array<float,2>{0.00557813421f, 0.766522944f},
-std::array<float,2>{0.901270747f, 0.737816334f},
-std::array<float,2>{0.477222174f, 0.104285792f},
-std::array<float,2>{0.52387923f, 0.0428669527f},
-std::array<float,2>{0.102756992f, 0.662180722f},
-std::array<float,2>{0.987601459f, 0.83592391f},
-std::array<float,2>{0.435515463f, 0.438596219f},
-std::array<float,2>{0.763173938f, 0.371739715f},
-std::array<float,2>{0.323501468f, 0.885888577f},
-std::array<float,2>{0.688809514f, 0.503487647f},
-std::array<float,2>{0.242342025f, 0.217457876f},
-std::array<float,2>{0.891907454f, 0.165275291f},
-std::array<float,2>{0.470119119f, 0.600319982f},
-std::array<float,2>{0.617140532f, 0.992871702f},
-std::array<float,2>{0.00800178293f, 0.271339506f},
-std::array<float,2>{0.626641333f, 0.413779378f},
-std::array<float,2>{0.169546694f, 0.799873471f},
-std::array<float,2>{0.85978806f, 0.704058528f},
-std::array<float,2>{0.300347358f, 0.0837809145f},
-std::array<float,2>{0.733797908f, 0.230407238f},
-std::array<float,2>{0.211058959f, 0.537098885f},
-std::array<float,2>{0.790339231f, 0.936245382f},
-std::array<float,2>{0.364926398f, 0.323069632f},
-std::array<float,2>{0.939654708f, 0.472200841f},
-std::array<float,2>{0.399486721f, 0.862407446f},
-std::array<float,2>{0.546245873f, 0.644846797f},
-std::array<float,2>{0.0890080407f, 0.0225697607f},
-std::array<float,2>{0.829083085f, 0.0991101637f},
-std::array<float,2>{0.27687645f, 0.744777381f},
-std::array<float,2>{0.674549818f, 0.781104743f},
-std::array<float,2>{0.147263005f, 0.39444375f},
-std::array<float,2>{0.574219406f, 0.28526032f},
-std::array<float,2>{0.0565791652f, 0.967586458f},
-std::array<float,2>{0.910490692f, 0.581188381f},
-std::array<float,2>{0.454385668f, 0.141349673f},
-std::array<float,2>{0.608945489f, 0.135413125f},
-std::array<float,2>{0.0167353097f, 0.566102147f},
-std::array<float,2>{0.875825942f, 0.946284771f},
-std::array<float,2>{0.489096552f, 0.308825523f},
-std::array<float,2>{0.845020175f, 0.380095601f},
-std::array<float,2>{0.286954343f, 0.752071083f},
-std::array<float,2>{0.645327032f, 0.726406455f},
-std::array<float,2>{0.18270804f, 0.117545709f},
-std::array<float,2>{0.978304982f, 0.0047291941f},
-std::array<float,2>{0.412413478f, 0.635617614f},
-std::array<float,2>{0.513224602f, 0.84792906f},
-std::array<float,2>{0.113873415f, 0.495325893f},
-std::array<float,2>{0.708199382f, 0.334566176f},
-std::array<float,2>{0.225895926f, 0.915113628f},
-std::array<float,2>{0.772571564f, 0.554013312f},
-std::array<float,2>{0.342197359f, 0.249872461f},
-std::array<float,2>{0.671663702f, 0.0679786727f},
-std::array<float,2>{0.127830446f, 0.698548257f},
-std::array<float,2>{0.819339335f, 0.784073293f},
-std::array<float,2>{0.255589038f, 0.428608418f},
-std::array<float,2>{0.935439825f, 0.261143893f},
-std::array<float,2>{0.444813848f, 0.981620312f},
-std::array<float,2>{0.592603743f, 0.61323905f},
-std::array<float,2>{0.0365179069f, 0.176965296f},
-std::array<float,2>{0.798553586f, 0.198238671f},
-std::array<float,2>{0.352449775f, 0.524423242f},
-std::array<float,2>{0.73477149f, 0.892180085f},
-std::array<float,2>{0.190929577f, 0.352815121f},
-std::array<float,2>{0.551560342f, 0.459764957f},
-std::array<float,2>{0.0760743171f, 0.822758079f},
-std::array<float,2>{0.957588196f, 0.680166364f},
-std::array<float,2>{0.386868626f, 0.0501602925f},
-std::array<float,2>{0.559548438f, 0.080576323f},
-std::array<float,2>{0.0679830313f, 0.708321631f},
-std::array<float,2>{0.965896785f, 0.804297447f},
-std::array<float,2>{0.375794172f, 0.409713954f},
-std::array<float,2>{0.807036877f, 0.266115785f},
-std::array<float,2>{0.351166755f, 0.998427153f},
-std::array<float,2>{0.749608278f, 0.597444117f},
-std::array<float,2>{0.196999371f, 0.171293214f},
-std::array<float,2>{0.923918068f, 0.212149352f},
-std::array<float,2>{0.451669902f, 0.505123615f},
-std::array<float,2>{0.583619118f, 0.887204409f},
-std::array<float,2>{0.0442377478f, 0.368290246f},
-std::array<float,2>{0.660153747f, 0.443646371f},
-std::array<float,2>{0.134880111f, 0.830403507f},
-std::array<float,2>{0.826323032f, 0.659546912f},
-std::array<float,2>{0.264386356f, 0.0433271192f},
-std::array<float,2>{0.71658206f, 0.146636933f},
-std::array<float,2>{0.226937145f, 0.584976256f},
-std::array<float,2>{0.781115174f, 0.962340772f},
-std::array<float,2>{0.333835393f, 0.282793224f},
-std::array<float,2>{0.974168003f, 0.394743353f},
-std::array<float,2>{0.418062001f, 0.776472926f},
-std::array<float,2>{0.501228034f, 0.748435736f},
-std::array<float,2>{0.124541968f, 0.0964464545f},
-std::array<float,2>{0.854620874f, 0.0161702018f},
-std::array<float,2>{0.290453851f, 0.642885804f},
-std::array<float,2>{0.650332034f, 0.863375247f},
-std::array<float,2>{0.172075212f, 0.473396778f},
-std::array<float,2>{0.598977804f, 0.324426681f},
-std::array<float,2>{0.0264756903f, 0.932093978f},
-std::array<float,2>{0.887836993f, 0.533552825f},
-std::array<float,2>{0.497830123f, 0.231251284f},
-std::array<float,2>{0.568040788f, 0.24291952f},
-std::array<float,2>{0.0479270257f, 0.550421476f},
-std::array<float,2>{0.919077277f, 0.919408143f},
-std::array<float,2>{0.465316176f, 0.331485987f},
-std::array<float,2>{0.841684222f, 0.499218285f},
-std::array<float,2>{0.269059211f, 0.844318569f},
-std::array<float,2>{0.68628943f, 0.637511909f},
-std::array<float,2>{0.150972024f, 7.61394986e-05f},
-std::array<float,2>{0.952652395f, 0.122928172f},
-std::array<float,2>{0.393812358f, 0.719868958f},
-std::array<float,2>{0.532871187f, 0.754230678f},
-std::array<float,2>{0.0812493563f, 0.376190215f},
-std::array<float,2>{0.719523668f, 0.308589846f},
-std::array<float,2>{0.206643179f, 0.951713622f},
-std::array<float,2>{0.78127259f, 0.569029093f},
-std::array<float,2>{0.37220782f, 0.140400335f},
-std::array<float,2>{0.636684358f, 0.0536238663f},
-std::array<float,2>{0.15758428f, 0.683976412f},
-std::array<float,2>{0.872155547f, 0.82504648f},
-std::array<float,2>{0.304801494f, 0.455218375f},
-std::array<float,2>{0.905851305f, 0.355816364f},
-std::array<float,2>{0.484265476f, 0.896545649f},
-std::array<float,2>{0.62433517f, 0.529309213f},
-std::array<float,2>{0.00182150933f, 0.203049302f},
-std::array<float,2>{0.750499129f, 0.172293365f},
-std::array<float,2>{0.313841105f, 0.613659084f},
-std::array<float,2>{0.69723022f, 0.978295267f},
-std::array<float,2>{0.239702404f, 0.262049675f},
-std::array<float,2>{0.520075977f, 0.423170149f},
-std::array<float,2>{0.100894488f, 0.786142886f},
-std::array<float,2>{0.99519366f, 0.701162398f},
-std::array<float,2>{0.422142416f, 0.0662748069f},
-std::array<float,2>{0.611207604f, 0.013796973f},
-std::array<float,2>{0.0154039524f, 0.625545681f},
-std::array<float,2>{0.896230698f, 0.859172225f},
-std::array<float,2>{0.473317474f, 0.491875559f},
-std::array<float,2>{0.867087305f, 0.338120788f},
-std::array<float,2>{0.30374825f, 0.90921247f},
-std::array<float,2>{0.632215798f, 0.55821532f},
-std::array<float,2>{0.16587694f, 0.239770919f},
-std::array<float,2>{0.990408957f, 0.130154133f},
-std::array<float,2>{0.430218399f, 0.570899129f},
-std::array<float,2>{0.530512512f, 0.943114638f},
-std::array<float,2>{0.107209295f, 0.299084306f},
-std::array<float,2>{0.694894493f, 0.383916944f},
-std::array<float,2>{0.249648035f, 0.763530672f},
-std::array<float,2>{0.758520961f, 0.734164417f},
-std::array<float,2>{0.327637136f, 0.11220707f},
-std::array<float,2>{0.677481592f, 0.188217163f},
-std::array<float,2>{0.142983004f, 0.518494606f},
-std::array<float,2>{0.835882545f, 0.902757585f},
-std::array<float,2>{0.278001398f, 0.351253152f},
-std::array<float,2>{0.907956421f, 0.46693489f},
-std::array<float,2>{0.457972914f, 0.81886071f},
-std::array<float,2>{0.57096988f, 0.675576031f},
-std::array<float,2>{0.060649544f, 0.0595051423f},
-std::array<float,2>{0.79591167f, 0.0761471838f},
-std::array<float,2>{0.360517979f, 0.690663517f},
-std::array<float,2>{0.729014814f, 0.796297967f},
-std::array<float,2>{0.218526646f, 0.4349989f},
-std::array<float,2>{0.540094912f, 0.256832361f},
-std::array<float,2>{0.0926699191f, 0.971146822f},
-std::array<float,2>{0.943339586f, 0.617470443f},
-std::array<float,2>{0.404115409f, 0.182473287f},
-std::array<float,2>{0.508080423f, 0.15844208f},
-std::array<float,2>{0.110708028f, 0.608659685f},
-std::array<float,2>{0.984225929f, 0.989172757f},
-std::array<float,2>{0.408146083f, 0.275652409f},
-std::array<float,2>{0.768144965f, 0.421715826f},
-std::array<float,2>{0.338357598f, 0.811104596f},
-std::array<float,2>{0.704016089f, 0.713849545f},
-std::array<float,2>{0.219488904f, 0.0892809033f},
-std::array<float,2>{0.882171512f, 0.0344542041f},
-std::array<float,2>{0.486100048f, 0.66884762f},
-std::array<float,2>{0.603751957f, 0.838232219f},
-std::array<float,2>{0.0224054996f, 0.44908008f},
-std::array<float,2>{0.644008517f, 0.361374736f},
-std::array<float,2>{0.185423106f, 0.879225194f},
-std::array<float,2>{0.850766897f, 0.509113491f},
-std::array<float,2>{0.283612669f, 0.208798602f},
-std::array<float,2>{0.739386141f, 0.106604554f},
-std::array<float,2>{0.191647261f, 0.741534233f},
-std::array<float,2>{0.804400921f, 0.770840049f},
-std::array<float,2>{0.359350443f, 0.39874202f},
-std::array<float,2>{0.955040693f, 0.293909103f},
-std::array<float,2>{0.384383053f, 0.960010171f},
-std::array<float,2>{0.548563957f, 0.588537633f},
-std::array<float,2>{0.0714586303f, 0.149130464f},
-std::array<float,2>{0.816083014f, 0.225982293f},
-std::array<float,2>{0.250010729f, 0.541849196f},
-std::array<float,2>{0.664682269f, 0.92540437f},
-std::array<float,2>{0.131201044f, 0.317104518f},
-std::array<float,2>{0.586371839f, 0.477056086f},
-std::array<float,2>{0.0350514874f, 0.868362486f},
-std::array<float,2>{0.932159126f, 0.649791658f},
-std::array<float,2>{0.439680547f, 0.0273922998f}}
\ No newline at end of file
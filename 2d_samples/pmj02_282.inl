@@ -1,4096 +0,0 @@
-{std::array<float,2>{0.0205386952f, 0.294265598f},
-std::array<float,2>{0.708604276f, 0.569329262f},
-std::array<float,2>{0.819247246f, 0.24828501f},
-std::array<float,2>{0.271225929f, 0.813136578f},
-std::array<float,2>{0.438200921f, 0.108187489f},
-std::array<float,2>{0.938519955f, 0.904793739f},
-std::array<float,2>{0.586045384f, 0.399387658f},
-std::array<float,2>{0.210337505f, 0.739234686f},
-std::array<float,2>{0.361338973f, 0.462533623f},
-std::array<float,2>{0.785628259f, 0.647554874f},
-std::array<float,2>{0.680364311f, 0.035741929f},
-std::array<float,2>{0.101146422f, 0.939356744f},
-std::array<float,2>{0.142528072f, 0.183050469f},
-std::array<float,2>{0.543374717f, 0.773774564f},
-std::array<float,2>{0.904076159f, 0.361345619f},
-std::array<float,2>{0.420860738f, 0.532796144f},
-std::array<float,2>{0.232106268f, 0.436392725f},
-std::array<float,2>{0.622416317f, 0.715007901f},
-std::array<float,2>{0.977608442f, 0.0685038567f},
-std::array<float,2>{0.489623368f, 0.932871282f},
-std::array<float,2>{0.300558358f, 0.212819368f},
-std::array<float,2>{0.844188929f, 0.861295521f},
-std::array<float,2>{0.71906209f, 0.264872938f},
-std::array<float,2>{0.0556101054f, 0.623443782f},
-std::array<float,2>{0.392767668f, 0.337783366f},
-std::array<float,2>{0.928445399f, 0.526811004f},
-std::array<float,2>{0.510494113f, 0.156002477f},
-std::array<float,2>{0.181448057f, 0.801291764f},
-std::array<float,2>{0.0712640211f, 0.0220260341f},
-std::array<float,2>{0.632651567f, 0.971911967f},
-std::array<float,2>{0.780651033f, 0.495902508f},
-std::array<float,2>{0.325159341f, 0.684091508f},
-std::array<float,2>{0.114505798f, 0.481862366f},
-std::array<float,2>{0.660433114f, 0.658798218f},
-std::array<float,2>{0.798270941f, 0.00242950208f},
-std::array<float,2>{0.354017586f, 0.996671438f},
-std::array<float,2>{0.427290022f, 0.132329136f},
-std::array<float,2>{0.87572819f, 0.792927682f},
-std::array<float,2>{0.549533427f, 0.327231944f},
-std::array<float,2>{0.133945078f, 0.51071918f},
-std::array<float,2>{0.263357252f, 0.267640263f},
-std::array<float,2>{0.837862849f, 0.608138323f},
-std::array<float,2>{0.697917879f, 0.189693883f},
-std::array<float,2>{0.000358634512f, 0.843912721f},
-std::array<float,2>{0.196667254f, 0.0864638239f},
-std::array<float,2>{0.567706406f, 0.914560199f},
-std::array<float,2>{0.95805949f, 0.413790613f},
-std::array<float,2>{0.457331508f, 0.694579363f},
-std::array<float,2>{0.170632094f, 0.350500077f},
-std::array<float,2>{0.529259861f, 0.560397625f},
-std::array<float,2>{0.913246036f, 0.156890109f},
-std::array<float,2>{0.385454655f, 0.753715158f},
-std::array<float,2>{0.331260473f, 0.0575862639f},
-std::array<float,2>{0.751312971f, 0.962164342f},
-std::array<float,2>{0.64338398f, 0.444021136f},
-std::array<float,2>{0.0793463513f, 0.629575908f},
-std::array<float,2>{0.472450823f, 0.390495718f},
-std::array<float,2>{0.997194827f, 0.723386467f},
-std::array<float,2>{0.594952881f, 0.112287186f},
-std::array<float,2>{0.245770589f, 0.882372677f},
-std::array<float,2>{0.0354401954f, 0.226194754f},
-std::array<float,2>{0.737832785f, 0.828611314f},
-std::array<float,2>{0.873230994f, 0.308449954f},
-std::array<float,2>{0.29341644f, 0.589582622f},
-std::array<float,2>{0.0882709622f, 0.314500272f},
-std::array<float,2>{0.654750526f, 0.50305903f},
-std::array<float,2>{0.764158428f, 0.138618633f},
-std::array<float,2>{0.342156231f, 0.786120832f},
-std::array<float,2>{0.379546344f, 0.0137093728f},
-std::array<float,2>{0.92072314f, 0.990726292f},
-std::array<float,2>{0.521512985f, 0.474565417f},
-std::array<float,2>{0.162550315f, 0.666897535f},
-std::array<float,2>{0.288159877f, 0.419493556f},
-std::array<float,2>{0.865293503f, 0.695346057f},
-std::array<float,2>{0.748728991f, 0.0826091915f},
-std::array<float,2>{0.0444440506f, 0.906973541f},
-std::array<float,2>{0.241234854f, 0.19778423f},
-std::array<float,2>{0.605175853f, 0.857657194f},
-std::array<float,2>{0.985058665f, 0.279027551f},
-std::array<float,2>{0.478922725f, 0.601041615f},
-std::array<float,2>{0.129165918f, 0.445391536f},
-std::array<float,2>{0.561509371f, 0.635030448f},
-std::array<float,2>{0.887768149f, 0.0535451584f},
-std::array<float,2>{0.432348311f, 0.954742908f},
-std::array<float,2>{0.344338745f, 0.164224908f},
-std::array<float,2>{0.806385934f, 0.761002183f},
-std::array<float,2>{0.667346358f, 0.352608919f},
-std::array<float,2>{0.122120768f, 0.547254443f},
-std::array<float,2>{0.466027528f, 0.301400572f},
-std::array<float,2>{0.96277386f, 0.58234179f},
-std::array<float,2>{0.576668978f, 0.230918929f},
-std::array<float,2>{0.187975228f, 0.84223485f},
-std::array<float,2>{0.0142838014f, 0.119027399f},
-std::array<float,2>{0.692374706f, 0.888615906f},
-std::array<float,2>{0.829514742f, 0.376947463f},
-std::array<float,2>{0.250231385f, 0.727330267f},
-std::array<float,2>{0.0488469377f, 0.39214924f},
-std::array<float,2>{0.728498399f, 0.747680664f},
-std::array<float,2>{0.857536077f, 0.100193292f},
-std::array<float,2>{0.309962422f, 0.891908884f},
-std::array<float,2>{0.496584028f, 0.237835377f},
-std::array<float,2>{0.969288886f, 0.827496648f},
-std::array<float,2>{0.615576327f, 0.288245171f},
-std::array<float,2>{0.224557936f, 0.576667547f},
-std::array<float,2>{0.313046962f, 0.371965021f},
-std::array<float,2>{0.766620278f, 0.542010784f},
-std::array<float,2>{0.6352368f, 0.178418592f},
-std::array<float,2>{0.0694073811f, 0.768652081f},
-std::array<float,2>{0.173458919f, 0.0448388532f},
-std::array<float,2>{0.503719866f, 0.949580073f},
-std::array<float,2>{0.931500494f, 0.458025813f},
-std::array<float,2>{0.404168338f, 0.652053773f},
-std::array<float,2>{0.213198394f, 0.250826359f},
-std::array<float,2>{0.583204627f, 0.613028705f},
-std::array<float,2>{0.949553251f, 0.208653748f},
-std::array<float,2>{0.448875189f, 0.874131143f},
-std::array<float,2>{0.280983984f, 0.0725765526f},
-std::array<float,2>{0.823042691f, 0.921996415f},
-std::array<float,2>{0.716076612f, 0.422064275f},
-std::array<float,2>{0.0285374783f, 0.710652113f},
-std::array<float,2>{0.411875069f, 0.491468042f},
-std::array<float,2>{0.892406702f, 0.672144532f},
-std::array<float,2>{0.53367734f, 0.0290278383f},
-std::array<float,2>{0.152146801f, 0.983917117f},
-std::array<float,2>{0.101773866f, 0.14582479f},
-std::array<float,2>{0.676710844f, 0.812038958f},
-std::array<float,2>{0.791553319f, 0.334494025f},
-std::array<float,2>{0.370651066f, 0.522198737f},
-std::array<float,2>{0.0971088931f, 0.276126385f},
-std::array<float,2>{0.686510384f, 0.595685542f},
-std::array<float,2>{0.783215106f, 0.200603217f},
-std::array<float,2>{0.365460545f, 0.851663589f},
-std::array<float,2>{0.414444655f, 0.081129685f},
-std::array<float,2>{0.901587307f, 0.914036274f},
-std::array<float,2>{0.542017817f, 0.415985644f},
-std::array<float,2>{0.147250906f, 0.70214206f},
-std::array<float,2>{0.269351155f, 0.470716089f},
-std::array<float,2>{0.815253556f, 0.668101251f},
-std::array<float,2>{0.706177056f, 0.0079388516f},
-std::array<float,2>{0.0194727033f, 0.987289608f},
-std::array<float,2>{0.205430433f, 0.1352088f},
-std::array<float,2>{0.593211293f, 0.785124183f},
-std::array<float,2>{0.941625774f, 0.317825168f},
-std::array<float,2>{0.441603333f, 0.505603492f},
-std::array<float,2>{0.18540208f, 0.381973684f},
-std::array<float,2>{0.514126897f, 0.731757641f},
-std::array<float,2>{0.92382282f, 0.124913178f},
-std::array<float,2>{0.395376116f, 0.883783638f},
-std::array<float,2>{0.323349118f, 0.227458f},
-std::array<float,2>{0.775226116f, 0.838380396f},
-std::array<float,2>{0.627853453f, 0.298394293f},
-std::array<float,2>{0.0766249225f, 0.581982613f},
-std::array<float,2>{0.48675701f, 0.356490165f},
-std::array<float,2>{0.981092751f, 0.552029967f},
-std::array<float,2>{0.617299139f, 0.169785157f},
-std::array<float,2>{0.230266377f, 0.763635933f},
-std::array<float,2>{0.0621877126f, 0.050197728f},
-std::array<float,2>{0.725116014f, 0.959825039f},
-std::array<float,2>{0.851440907f, 0.449313045f},
-std::array<float,2>{0.300851524f, 0.637417436f},
-std::array<float,2>{0.00587284192f, 0.453856409f},
-std::array<float,2>{0.701047421f, 0.654052019f},
-std::array<float,2>{0.842086911f, 0.0399223417f},
-std::array<float,2>{0.260585308f, 0.948431075f},
-std::array<float,2>{0.45471108f, 0.173297822f},
-std::array<float,2>{0.955733418f, 0.770772636f},
-std::array<float,2>{0.563670576f, 0.37069577f},
-std::array<float,2>{0.200198039f, 0.544583559f},
-std::array<float,2>{0.358967841f, 0.283855766f},
-std::array<float,2>{0.803353369f, 0.571541905f},
-std::array<float,2>{0.656430244f, 0.241476804f},
-std::array<float,2>{0.112817243f, 0.821533442f},
-std::array<float,2>{0.138027817f, 0.0973519832f},
-std::array<float,2>{0.553691447f, 0.897143006f},
-std::array<float,2>{0.880624771f, 0.397257239f},
-std::array<float,2>{0.423424274f, 0.745197237f},
-std::array<float,2>{0.246945396f, 0.329835951f},
-std::array<float,2>{0.600730598f, 0.519272625f},
-std::array<float,2>{0.994655728f, 0.142081603f},
-std::array<float,2>{0.474095374f, 0.805346251f},
-std::array<float,2>{0.2927773f, 0.0262937844f},
-std::array<float,2>{0.869562864f, 0.980182767f},
-std::array<float,2>{0.740520239f, 0.484761983f},
-std::array<float,2>{0.033652015f, 0.678316534f},
-std::array<float,2>{0.389024436f, 0.428364098f},
-std::array<float,2>{0.908910513f, 0.706837058f},
-std::array<float,2>{0.524274409f, 0.0769519508f},
-std::array<float,2>{0.166244254f, 0.928208053f},
-std::array<float,2>{0.0857789889f, 0.206800923f},
-std::array<float,2>{0.646135688f, 0.869936049f},
-std::array<float,2>{0.75600785f, 0.255800337f},
-std::array<float,2>{0.332790911f, 0.616664827f},
-std::array<float,2>{0.042306643f, 0.366514057f},
-std::array<float,2>{0.745465934f, 0.537903726f},
-std::array<float,2>{0.85968101f, 0.184736133f},
-std::array<float,2>{0.283621073f, 0.778513491f},
-std::array<float,2>{0.48258549f, 0.0323007889f},
-std::array<float,2>{0.992163956f, 0.942179203f},
-std::array<float,2>{0.607557356f, 0.466492593f},
-std::array<float,2>{0.236474082f, 0.643348217f},
-std::array<float,2>{0.339651316f, 0.405837238f},
-std::array<float,2>{0.757946968f, 0.736498356f},
-std::array<float,2>{0.650939345f, 0.104069091f},
-std::array<float,2>{0.092126444f, 0.901193202f},
-std::array<float,2>{0.156572014f, 0.242547497f},
-std::array<float,2>{0.517947555f, 0.820271194f},
-std::array<float,2>{0.915595889f, 0.290159315f},
-std::array<float,2>{0.375885993f, 0.566047788f},
-std::array<float,2>{0.192146495f, 0.49666065f},
-std::array<float,2>{0.571204662f, 0.682465196f},
-std::array<float,2>{0.965314388f, 0.0189580973f},
-std::array<float,2>{0.463436335f, 0.97510314f},
-std::array<float,2>{0.257308543f, 0.14885278f},
-std::array<float,2>{0.835567296f, 0.797258317f},
-std::array<float,2>{0.687615871f, 0.342559814f},
-std::array<float,2>{0.00851518661f, 0.530229807f},
-std::array<float,2>{0.436408758f, 0.259738415f},
-std::array<float,2>{0.885387838f, 0.619186044f},
-std::array<float,2>{0.556966007f, 0.215828478f},
-std::array<float,2>{0.125074506f, 0.863550365f},
-std::array<float,2>{0.118094787f, 0.0661350563f},
-std::array<float,2>{0.671542287f, 0.937124491f},
-std::array<float,2>{0.812480867f, 0.430780798f},
-std::array<float,2>{0.34795773f, 0.71183306f},
-std::array<float,2>{0.0637172386f, 0.407225877f},
-std::array<float,2>{0.639565408f, 0.690723479f},
-std::array<float,2>{0.76954627f, 0.0922661796f},
-std::array<float,2>{0.319407493f, 0.918971181f},
-std::array<float,2>{0.399616957f, 0.194037229f},
-std::array<float,2>{0.935901105f, 0.850734234f},
-std::array<float,2>{0.504538715f, 0.273095757f},
-std::array<float,2>{0.177148998f, 0.60320276f},
-std::array<float,2>{0.308084607f, 0.321246058f},
-std::array<float,2>{0.853931308f, 0.511924028f},
-std::array<float,2>{0.733617127f, 0.128214821f},
-std::array<float,2>{0.0543509349f, 0.794974148f},
-std::array<float,2>{0.218920767f, 0.00422486803f},
-std::array<float,2>{0.61011833f, 0.993474364f},
-std::array<float,2>{0.97413069f, 0.478689998f},
-std::array<float,2>{0.493337482f, 0.662024736f},
-std::array<float,2>{0.155833229f, 0.309351712f},
-std::array<float,2>{0.538960636f, 0.591506064f},
-std::array<float,2>{0.898404062f, 0.22264564f},
-std::array<float,2>{0.408227295f, 0.833804548f},
-std::array<float,2>{0.371261775f, 0.114436142f},
-std::array<float,2>{0.793556213f, 0.875006735f},
-std::array<float,2>{0.671977341f, 0.386404097f},
-std::array<float,2>{0.107739069f, 0.720627308f},
-std::array<float,2>{0.449354529f, 0.437946379f},
-std::array<float,2>{0.949076414f, 0.628373742f},
-std::array<float,2>{0.580890775f, 0.0612883233f},
-std::array<float,2>{0.216655433f, 0.967665553f},
-std::array<float,2>{0.0257267337f, 0.161414549f},
-std::array<float,2>{0.711029947f, 0.757143319f},
-std::array<float,2>{0.825330138f, 0.344124794f},
-std::array<float,2>{0.275955409f, 0.556898355f},
-std::array<float,2>{0.0577023402f, 0.26239875f},
-std::array<float,2>{0.722351849f, 0.622904658f},
-std::array<float,2>{0.847048461f, 0.213010669f},
-std::array<float,2>{0.296971083f, 0.863230586f},
-std::array<float,2>{0.490840375f, 0.0664867461f},
-std::array<float,2>{0.979154706f, 0.930307806f},
-std::array<float,2>{0.624862969f, 0.433914959f},
-std::array<float,2>{0.232456669f, 0.716963112f},
-std::array<float,2>{0.326952368f, 0.493190855f},
-std::array<float,2>{0.777969718f, 0.686153769f},
-std::array<float,2>{0.630767345f, 0.0213705935f},
-std::array<float,2>{0.0729264766f, 0.969569087f},
-std::array<float,2>{0.182397157f, 0.153538063f},
-std::array<float,2>{0.508235991f, 0.804106832f},
-std::array<float,2>{0.92701757f, 0.338939339f},
-std::array<float,2>{0.39153111f, 0.524218619f},
-std::array<float,2>{0.208243608f, 0.401634604f},
-std::array<float,2>{0.589036226f, 0.741123497f},
-std::array<float,2>{0.940525234f, 0.106393307f},
-std::array<float,2>{0.440900028f, 0.903525054f},
-std::array<float,2>{0.27336058f, 0.24689424f},
-std::array<float,2>{0.816545963f, 0.81481874f},
-std::array<float,2>{0.710178077f, 0.2958543f},
-std::array<float,2>{0.0217651743f, 0.567627549f},
-std::array<float,2>{0.419553965f, 0.360377312f},
-std::array<float,2>{0.904868126f, 0.534492135f},
-std::array<float,2>{0.545117259f, 0.179905772f},
-std::array<float,2>{0.144520596f, 0.775533378f},
-std::array<float,2>{0.0988616571f, 0.0386062376f},
-std::array<float,2>{0.683564305f, 0.940098763f},
-std::array<float,2>{0.788859069f, 0.462903589f},
-std::array<float,2>{0.361160666f, 0.645469844f},
-std::array<float,2>{0.0809190795f, 0.44151625f},
-std::array<float,2>{0.640754879f, 0.632765889f},
-std::array<float,2>{0.752212644f, 0.0558535829f},
-std::array<float,2>{0.329369724f, 0.964679718f},
-std::array<float,2>{0.384388745f, 0.15916492f},
-std::array<float,2>{0.911253035f, 0.751144111f},
-std::array<float,2>{0.529998779f, 0.348331124f},
-std::array<float,2>{0.169863001f, 0.561682999f},
-std::array<float,2>{0.295503587f, 0.304720163f},
-std::array<float,2>{0.87150234f, 0.587454796f},
-std::array<float,2>{0.735620677f, 0.224278048f},
-std::array<float,2>{0.0379381441f, 0.831313074f},
-std::array<float,2>{0.243407041f, 0.109923504f},
-std::array<float,2>{0.59669596f, 0.879005015f},
-std::array<float,2>{0.999581575f, 0.387414098f},
-std::array<float,2>{0.470577598f, 0.725219667f},
-std::array<float,2>{0.13662976f, 0.325093865f},
-std::array<float,2>{0.547909141f, 0.508364677f},
-std::array<float,2>{0.87816757f, 0.12915282f},
-std::array<float,2>{0.428280413f, 0.789356887f},
-std::array<float,2>{0.353401005f, 0.000617571408f},
-std::array<float,2>{0.799785793f, 0.999143839f},
-std::array<float,2>{0.664044619f, 0.483403236f},
-std::array<float,2>{0.11590486f, 0.658089817f},
-std::array<float,2>{0.460256338f, 0.411788881f},
-std::array<float,2>{0.960520625f, 0.691836655f},
-std::array<float,2>{0.568776309f, 0.0880778804f},
-std::array<float,2>{0.197512835f, 0.917934299f},
-std::array<float,2>{0.0034572538f, 0.188639358f},
-std::array<float,2>{0.696675599f, 0.847031057f},
-std::array<float,2>{0.839638472f, 0.26741457f},
-std::array<float,2>{0.264808625f, 0.605947077f},
-std::array<float,2>{0.124952227f, 0.353629529f},
-std::array<float,2>{0.664607465f, 0.550693035f},
-std::array<float,2>{0.807140172f, 0.167620942f},
-std::array<float,2>{0.346533477f, 0.75885725f},
-std::array<float,2>{0.42991212f, 0.0522416309f},
-std::array<float,2>{0.890503049f, 0.956882536f},
-std::array<float,2>{0.55959636f, 0.447630882f},
-std::array<float,2>{0.131243065f, 0.634131312f},
-std::array<float,2>{0.252530336f, 0.377890855f},
-std::array<float,2>{0.83018738f, 0.729967117f},
-std::array<float,2>{0.694512248f, 0.119167902f},
-std::array<float,2>{0.0118031846f, 0.890623569f},
-std::array<float,2>{0.189851955f, 0.232669741f},
-std::array<float,2>{0.574286044f, 0.841606021f},
-std::array<float,2>{0.964496076f, 0.303061903f},
-std::array<float,2>{0.466865718f, 0.584966123f},
-std::array<float,2>{0.160974324f, 0.476531148f},
-std::array<float,2>{0.520802855f, 0.665769637f},
-std::array<float,2>{0.919833601f, 0.0131306527f},
-std::array<float,2>{0.381046414f, 0.989953876f},
-std::array<float,2>{0.339975417f, 0.139201552f},
-std::array<float,2>{0.763227463f, 0.788570821f},
-std::array<float,2>{0.653280854f, 0.312864393f},
-std::array<float,2>{0.0876954198f, 0.500410676f},
-std::array<float,2>{0.477168411f, 0.280159771f},
-std::array<float,2>{0.987957299f, 0.598260224f},
-std::array<float,2>{0.602844238f, 0.197086453f},
-std::array<float,2>{0.24006407f, 0.856038332f},
-std::array<float,2>{0.0454791859f, 0.0846984386f},
-std::array<float,2>{0.746121824f, 0.909283698f},
-std::array<float,2>{0.865200758f, 0.421198636f},
-std::array<float,2>{0.286881536f, 0.698348999f},
-std::array<float,2>{0.0297113955f, 0.424156338f},
-std::array<float,2>{0.716951489f, 0.707570136f},
-std::array<float,2>{0.821306348f, 0.0707920194f},
-std::array<float,2>{0.278830707f, 0.923879862f},
-std::array<float,2>{0.445826739f, 0.210877344f},
-std::array<float,2>{0.952444255f, 0.871711493f},
-std::array<float,2>{0.584560275f, 0.253661007f},
-std::array<float,2>{0.212308913f, 0.609443009f},
-std::array<float,2>{0.368254572f, 0.333058834f},
-std::array<float,2>{0.790503442f, 0.520905674f},
-std::array<float,2>{0.679358065f, 0.147614777f},
-std::array<float,2>{0.104676388f, 0.809327781f},
-std::array<float,2>{0.148934141f, 0.0302778129f},
-std::array<float,2>{0.532368064f, 0.981508374f},
-std::array<float,2>{0.893900216f, 0.489585549f},
-std::array<float,2>{0.412287891f, 0.675654233f},
-std::array<float,2>{0.224617094f, 0.286453277f},
-std::array<float,2>{0.613425136f, 0.575761378f},
-std::array<float,2>{0.972228765f, 0.235495403f},
-std::array<float,2>{0.499137938f, 0.825810313f},
-std::array<float,2>{0.311336607f, 0.0980143696f},
-std::array<float,2>{0.857162118f, 0.892807066f},
-std::array<float,2>{0.729660988f, 0.393704802f},
-std::array<float,2>{0.0475771874f, 0.749201059f},
-std::array<float,2>{0.404371947f, 0.460907251f},
-std::array<float,2>{0.931660533f, 0.648572862f},
-std::array<float,2>{0.500920415f, 0.0467067994f},
-std::array<float,2>{0.174806207f, 0.952827096f},
-std::array<float,2>{0.0668429658f, 0.176820323f},
-std::array<float,2>{0.633235753f, 0.765855432f},
-std::array<float,2>{0.768689275f, 0.373568296f},
-std::array<float,2>{0.31460765f, 0.540439844f},
-std::array<float,2>{0.0748582259f, 0.299100548f},
-std::array<float,2>{0.626899779f, 0.578909636f},
-std::array<float,2>{0.77680558f, 0.229894921f},
-std::array<float,2>{0.321843237f, 0.837449789f},
-std::array<float,2>{0.396530211f, 0.122108094f},
-std::array<float,2>{0.924632013f, 0.885919929f},
-std::array<float,2>{0.512002766f, 0.379048973f},
-std::array<float,2>{0.186648399f, 0.733392179f},
-std::array<float,2>{0.304147273f, 0.45212245f},
-std::array<float,2>{0.848724127f, 0.639116704f},
-std::array<float,2>{0.724544585f, 0.0482313596f},
-std::array<float,2>{0.0604398809f, 0.957446456f},
-std::array<float,2>{0.227615029f, 0.171712503f},
-std::array<float,2>{0.620051742f, 0.763784409f},
-std::array<float,2>{0.983624756f, 0.357774079f},
-std::array<float,2>{0.485925227f, 0.553636789f},
-std::array<float,2>{0.146443307f, 0.416967332f},
-std::array<float,2>{0.53929466f, 0.700464129f},
-std::array<float,2>{0.899183929f, 0.078246735f},
-std::array<float,2>{0.417252839f, 0.911725521f},
-std::array<float,2>{0.364602327f, 0.201944798f},
-std::array<float,2>{0.781650722f, 0.854060888f},
-std::array<float,2>{0.68414855f, 0.274175972f},
-std::array<float,2>{0.0944695398f, 0.596855044f},
-std::array<float,2>{0.444713265f, 0.318372697f},
-std::array<float,2>{0.944146931f, 0.506681025f},
-std::array<float,2>{0.590104997f, 0.134103537f},
-std::array<float,2>{0.204051644f, 0.783056438f},
-std::array<float,2>{0.0171240717f, 0.0107819792f},
-std::array<float,2>{0.704317749f, 0.986196518f},
-std::array<float,2>{0.81332159f, 0.469019979f},
-std::array<float,2>{0.266315252f, 0.671687841f},
-std::array<float,2>{0.0315433294f, 0.487251163f},
-std::array<float,2>{0.739146233f, 0.677277386f},
-std::array<float,2>{0.867453098f, 0.0252540465f},
-std::array<float,2>{0.289865255f, 0.977352262f},
-std::array<float,2>{0.474625707f, 0.144026294f},
-std::array<float,2>{0.993640542f, 0.808022857f},
-std::array<float,2>{0.598273516f, 0.33124119f},
-std::array<float,2>{0.249121279f, 0.516764522f},
-std::array<float,2>{0.334018558f, 0.256593972f},
-std::array<float,2>{0.754934967f, 0.614782989f},
-std::array<float,2>{0.646646678f, 0.204187959f},
-std::array<float,2>{0.0827963129f, 0.868384063f},
-std::array<float,2>{0.16415529f, 0.0752664953f},
-std::array<float,2>{0.527234554f, 0.926674068f},
-std::array<float,2>{0.907317519f, 0.426073641f},
-std::array<float,2>{0.387574732f, 0.703748941f},
-std::array<float,2>{0.203001812f, 0.367233574f},
-std::array<float,2>{0.565207243f, 0.54664886f},
-std::array<float,2>{0.953525543f, 0.174795851f},
-std::array<float,2>{0.455939472f, 0.773228288f},
-std::array<float,2>{0.259058326f, 0.0412622578f},
-std::array<float,2>{0.841385543f, 0.946728945f},
-std::array<float,2>{0.701492846f, 0.456430793f},
-std::array<float,2>{0.00481402455f, 0.654807687f},
-std::array<float,2>{0.424710304f, 0.39485693f},
-std::array<float,2>{0.882414818f, 0.74265027f},
-std::array<float,2>{0.551981747f, 0.0943009332f},
-std::array<float,2>{0.139474571f, 0.894792557f},
-std::array<float,2>{0.111252725f, 0.239916265f},
-std::array<float,2>{0.659650028f, 0.823476136f},
-std::array<float,2>{0.801620364f, 0.28264451f},
-std::array<float,2>{0.35583958f, 0.573085546f},
-std::array<float,2>{0.0116616124f, 0.341254771f},
-std::array<float,2>{0.69016999f, 0.528141081f},
-std::array<float,2>{0.832923174f, 0.152312502f},
-std::array<float,2>{0.254554451f, 0.800066292f},
-std::array<float,2>{0.462407172f, 0.0158231948f},
-std::array<float,2>{0.967393458f, 0.97360462f},
-std::array<float,2>{0.572695553f, 0.498753071f},
-std::array<float,2>{0.194410741f, 0.681453049f},
-std::array<float,2>{0.351144791f, 0.431685984f},
-std::array<float,2>{0.80889231f, 0.71482873f},
-std::array<float,2>{0.668345034f, 0.0632430837f},
-std::array<float,2>{0.120357193f, 0.934112966f},
-std::array<float,2>{0.127143189f, 0.218001142f},
-std::array<float,2>{0.555733562f, 0.86553818f},
-std::array<float,2>{0.883763134f, 0.261090517f},
-std::array<float,2>{0.434154868f, 0.617346525f},
-std::array<float,2>{0.23587586f, 0.468196273f},
-std::array<float,2>{0.607047439f, 0.642007709f},
-std::array<float,2>{0.989793122f, 0.0333655812f},
-std::array<float,2>{0.481501639f, 0.943371832f},
-std::array<float,2>{0.282008946f, 0.186318606f},
-std::array<float,2>{0.861639559f, 0.780151129f},
-std::array<float,2>{0.743131876f, 0.363598853f},
-std::array<float,2>{0.0395476073f, 0.536507666f},
-std::array<float,2>{0.377899885f, 0.292224556f},
-std::array<float,2>{0.917455435f, 0.563629806f},
-std::array<float,2>{0.516844571f, 0.245237052f},
-std::array<float,2>{0.159990057f, 0.817589521f},
-std::array<float,2>{0.090203017f, 0.102883808f},
-std::array<float,2>{0.649414122f, 0.89983356f},
-std::array<float,2>{0.761688232f, 0.402662277f},
-std::array<float,2>{0.336603642f, 0.735360205f},
-std::array<float,2>{0.105773561f, 0.383167058f},
-std::array<float,2>{0.674333155f, 0.722286582f},
-std::array<float,2>{0.796136558f, 0.116772592f},
-std::array<float,2>{0.374730259f, 0.877163112f},
-std::array<float,2>{0.407529831f, 0.219848931f},
-std::array<float,2>{0.894640088f, 0.835845649f},
-std::array<float,2>{0.536046863f, 0.311259359f},
-std::array<float,2>{0.152840987f, 0.592570007f},
-std::array<float,2>{0.274242431f, 0.346708626f},
-std::array<float,2>{0.826892316f, 0.555640578f},
-std::array<float,2>{0.713921428f, 0.162479147f},
-std::array<float,2>{0.025182629f, 0.755562782f},
-std::array<float,2>{0.218114331f, 0.0592748895f},
-std::array<float,2>{0.579439819f, 0.965033889f},
-std::array<float,2>{0.946961105f, 0.441131145f},
-std::array<float,2>{0.452979535f, 0.626163423f},
-std::array<float,2>{0.178206265f, 0.271003395f},
-std::array<float,2>{0.506449282f, 0.603901267f},
-std::array<float,2>{0.93516469f, 0.193338901f},
-std::array<float,2>{0.400726318f, 0.849349439f},
-std::array<float,2>{0.31667614f, 0.0900437906f},
-std::array<float,2>{0.771922588f, 0.920881033f},
-std::array<float,2>{0.638326526f, 0.409671813f},
-std::array<float,2>{0.0650129169f, 0.689198017f},
-std::array<float,2>{0.494846851f, 0.476994008f},
-std::array<float,2>{0.975751936f, 0.663972318f},
-std::array<float,2>{0.611939251f, 0.00605786638f},
-std::array<float,2>{0.221302599f, 0.995337129f},
-std::array<float,2>{0.0527235828f, 0.1258104f},
-std::array<float,2>{0.730963171f, 0.794670761f},
-std::array<float,2>{0.853216529f, 0.322703183f},
-std::array<float,2>{0.305529118f, 0.514576077f},
-std::array<float,2>{0.0385579951f, 0.3068344f},
-std::array<float,2>{0.735266447f, 0.588448882f},
-std::array<float,2>{0.872728527f, 0.225114137f},
-std::array<float,2>{0.2966353f, 0.829295576f},
-std::array<float,2>{0.468752146f, 0.112542376f},
-std::array<float,2>{0.9988572f, 0.881661892f},
-std::array<float,2>{0.596052229f, 0.389145225f},
-std::array<float,2>{0.242575124f, 0.724505305f},
-std::array<float,2>{0.328976572f, 0.444371551f},
-std::array<float,2>{0.753177106f, 0.630229831f},
-std::array<float,2>{0.641830504f, 0.0585898012f},
-std::array<float,2>{0.0812252015f, 0.96181947f},
-std::array<float,2>{0.168019637f, 0.158111334f},
-std::array<float,2>{0.531046927f, 0.752844274f},
-std::array<float,2>{0.910365462f, 0.350772053f},
-std::array<float,2>{0.382833064f, 0.559106767f},
-std::array<float,2>{0.198505118f, 0.413049668f},
-std::array<float,2>{0.569904089f, 0.693426728f},
-std::array<float,2>{0.95899421f, 0.0875364766f},
-std::array<float,2>{0.459365696f, 0.915547132f},
-std::array<float,2>{0.263929456f, 0.190823913f},
-std::array<float,2>{0.838789046f, 0.845041037f},
-std::array<float,2>{0.696154356f, 0.269204319f},
-std::array<float,2>{0.00275270361f, 0.608765543f},
-std::array<float,2>{0.429298669f, 0.326580793f},
-std::array<float,2>{0.877215087f, 0.510936022f},
-std::array<float,2>{0.547715664f, 0.131808639f},
-std::array<float,2>{0.135238051f, 0.791413784f},
-std::array<float,2>{0.116391428f, 0.00302234432f},
-std::array<float,2>{0.662935436f, 0.997256041f},
-std::array<float,2>{0.800212026f, 0.481035858f},
-std::array<float,2>{0.351624101f, 0.659229279f},
-std::array<float,2>{0.0738214031f, 0.494225115f},
-std::array<float,2>{0.629471242f, 0.684586167f},
-std::array<float,2>{0.779197276f, 0.0230904594f},
-std::array<float,2>{0.327372044f, 0.97131902f},
-std::array<float,2>{0.392575532f, 0.154373601f},
-std::array<float,2>{0.926656842f, 0.802690506f},
-std::array<float,2>{0.509328723f, 0.336095393f},
-std::array<float,2>{0.183261335f, 0.525651813f},
-std::array<float,2>{0.297913074f, 0.264476597f},
-std::array<float,2>{0.846293211f, 0.624363422f},
-std::array<float,2>{0.721312165f, 0.211341485f},
-std::array<float,2>{0.0574532449f, 0.859412313f},
-std::array<float,2>{0.234164849f, 0.0697538331f},
-std::array<float,2>{0.623570681f, 0.932381868f},
-std::array<float,2>{0.980032027f, 0.437272787f},
-std::array<float,2>{0.491863936f, 0.716589689f},
-std::array<float,2>{0.142599985f, 0.362355947f},
-std::array<float,2>{0.54609555f, 0.531365991f},
-std::array<float,2>{0.906199276f, 0.181791157f},
-std::array<float,2>{0.418210655f, 0.774954498f},
-std::array<float,2>{0.36006254f, 0.036736615f},
-std::array<float,2>{0.787635565f, 0.937773228f},
-std::array<float,2>{0.682138562f, 0.460949451f},
-std::array<float,2>{0.0977805555f, 0.64743793f},
-std::array<float,2>{0.439574569f, 0.399763227f},
-std::array<float,2>{0.939803839f, 0.73938489f},
-std::array<float,2>{0.588555157f, 0.108408518f},
-std::array<float,2>{0.20776771f, 0.905316889f},
-std::array<float,2>{0.0225419924f, 0.249576449f},
-std::array<float,2>{0.709666252f, 0.814116359f},
-std::array<float,2>{0.817887247f, 0.293359816f},
-std::array<float,2>{0.271727681f, 0.569427967f},
-std::array<float,2>{0.104444183f, 0.335158169f},
-std::array<float,2>{0.678356588f, 0.523386121f},
-std::array<float,2>{0.789493978f, 0.145473361f},
-std::array<float,2>{0.367962241f, 0.811291456f},
-std::array<float,2>{0.413600355f, 0.0278242659f},
-std::array<float,2>{0.893026531f, 0.982478082f},
-std::array<float,2>{0.532208562f, 0.490308374f},
-std::array<float,2>{0.150302455f, 0.673373759f},
-std::array<float,2>{0.277688801f, 0.423658311f},
-std::array<float,2>{0.821057498f, 0.709304512f},
-std::array<float,2>{0.717847943f, 0.0740948692f},
-std::array<float,2>{0.0308219697f, 0.923454344f},
-std::array<float,2>{0.211418688f, 0.20730634f},
-std::array<float,2>{0.585464418f, 0.873468459f},
-std::array<float,2>{0.951654494f, 0.251281142f},
-std::array<float,2>{0.446318358f, 0.611794233f},
-std::array<float,2>{0.174107954f, 0.457695335f},
-std::array<float,2>{0.501874804f, 0.651013136f},
-std::array<float,2>{0.933428705f, 0.0437844098f},
-std::array<float,2>{0.406091005f, 0.950911283f},
-std::array<float,2>{0.316219419f, 0.178794488f},
-std::array<float,2>{0.768035114f, 0.767740488f},
-std::array<float,2>{0.63426888f, 0.372538537f},
-std::array<float,2>{0.0682901666f, 0.541878104f},
-std::array<float,2>{0.498736233f, 0.287283987f},
-std::array<float,2>{0.970960379f, 0.577217221f},
-std::array<float,2>{0.614445746f, 0.237136871f},
-std::array<float,2>{0.225642428f, 0.826614857f},
-std::array<float,2>{0.0484420173f, 0.101509742f},
-std::array<float,2>{0.728685141f, 0.891564727f},
-std::array<float,2>{0.855533361f, 0.390913308f},
-std::array<float,2>{0.312326401f, 0.74619931f},
-std::array<float,2>{0.013518312f, 0.375380546f},
-std::array<float,2>{0.694227993f, 0.728002429f},
-std::array<float,2>{0.831873298f, 0.117879786f},
-std::array<float,2>{0.253278702f, 0.886910975f},
-std::array<float,2>{0.468507111f, 0.231514603f},
-std::array<float,2>{0.963642001f, 0.842961252f},
-std::array<float,2>{0.575206161f, 0.302283227f},
-std::array<float,2>{0.191048324f, 0.583919466f},
-std::array<float,2>{0.346933573f, 0.35172525f},
-std::array<float,2>{0.807757735f, 0.54799068f},
-std::array<float,2>{0.665885091f, 0.165604502f},
-std::array<float,2>{0.123102613f, 0.76018846f},
-std::array<float,2>{0.132134631f, 0.0539816916f},
-std::array<float,2>{0.558812439f, 0.953471184f},
-std::array<float,2>{0.888728142f, 0.447179765f},
-std::array<float,2>{0.430805087f, 0.636427402f},
-std::array<float,2>{0.238931671f, 0.277413785f},
-std::array<float,2>{0.602119565f, 0.599801779f},
-std::array<float,2>{0.986398041f, 0.198507562f},
-std::array<float,2>{0.478157371f, 0.858707905f},
-std::array<float,2>{0.285715878f, 0.0837177485f},
-std::array<float,2>{0.863466799f, 0.907948315f},
-std::array<float,2>{0.747406304f, 0.418186337f},
-std::array<float,2>{0.0461032055f, 0.69664681f},
-std::array<float,2>{0.382254541f, 0.473074704f},
-std::array<float,2>{0.918637514f, 0.667689502f},
-std::array<float,2>{0.52017951f, 0.0149080008f},
-std::array<float,2>{0.161921382f, 0.991792798f},
-std::array<float,2>{0.0866119936f, 0.137314275f},
-std::array<float,2>{0.653503835f, 0.786572814f},
-std::array<float,2>{0.762060225f, 0.315804005f},
-std::array<float,2>{0.341358572f, 0.502055585f},
-std::array<float,2>{0.0835567489f, 0.254189909f},
-std::array<float,2>{0.647564828f, 0.615741611f},
-std::array<float,2>{0.754566491f, 0.206028149f},
-std::array<float,2>{0.335195959f, 0.87015754f},
-std::array<float,2>{0.387921184f, 0.0771578401f},
-std::array<float,2>{0.907020867f, 0.929516733f},
-std::array<float,2>{0.525837004f, 0.428942114f},
-std::array<float,2>{0.165664002f, 0.705263436f},
-std::array<float,2>{0.290881366f, 0.486075401f},
-std::array<float,2>{0.868661642f, 0.67937994f},
-std::array<float,2>{0.739682376f, 0.0264426805f},
-std::array<float,2>{0.0323420279f, 0.979036689f},
-std::array<float,2>{0.248645887f, 0.140988827f},
-std::array<float,2>{0.59893626f, 0.805865407f},
-std::array<float,2>{0.992590845f, 0.32851997f},
-std::array<float,2>{0.475736558f, 0.518276215f},
-std::array<float,2>{0.13966006f, 0.398146838f},
-std::array<float,2>{0.551561415f, 0.744567573f},
-std::array<float,2>{0.881328046f, 0.0965689197f},
-std::array<float,2>{0.424954683f, 0.898164332f},
-std::array<float,2>{0.357328296f, 0.240773723f},
-std::array<float,2>{0.802386343f, 0.82104671f},
-std::array<float,2>{0.658239901f, 0.285086066f},
-std::array<float,2>{0.109984055f, 0.571011662f},
-std::array<float,2>{0.456152707f, 0.369710356f},
-std::array<float,2>{0.9541049f, 0.543293238f},
-std::array<float,2>{0.566327393f, 0.172340199f},
-std::array<float,2>{0.201910704f, 0.77037704f},
-std::array<float,2>{0.00509669678f, 0.0402006432f},
-std::array<float,2>{0.702984035f, 0.947736263f},
-std::array<float,2>{0.839934587f, 0.454736143f},
-std::array<float,2>{0.258026481f, 0.653262019f},
-std::array<float,2>{0.0587147512f, 0.451087177f},
-std::array<float,2>{0.723198175f, 0.637730241f},
-std::array<float,2>{0.848552048f, 0.049391523f},
-std::array<float,2>{0.303355068f, 0.960373521f},
-std::array<float,2>{0.48480019f, 0.168422893f},
-std::array<float,2>{0.983364642f, 0.761950791f},
-std::array<float,2>{0.620269597f, 0.35591954f},
-std::array<float,2>{0.22700949f, 0.551471829f},
-std::array<float,2>{0.320885628f, 0.29763484f},
-std::array<float,2>{0.775670469f, 0.580799103f},
-std::array<float,2>{0.625173986f, 0.228020161f},
-std::array<float,2>{0.0753416345f, 0.839534223f},
-std::array<float,2>{0.186381727f, 0.123721957f},
-std::array<float,2>{0.513320267f, 0.884588003f},
-std::array<float,2>{0.925464988f, 0.381693244f},
-std::array<float,2>{0.397555739f, 0.731357634f},
-std::array<float,2>{0.204471096f, 0.316706598f},
-std::array<float,2>{0.591328919f, 0.503917754f},
-std::array<float,2>{0.945104897f, 0.136215806f},
-std::array<float,2>{0.4434264f, 0.783259153f},
-std::array<float,2>{0.267314523f, 0.00938997231f},
-std::array<float,2>{0.814379871f, 0.987759829f},
-std::array<float,2>{0.703495622f, 0.4718979f},
-std::array<float,2>{0.0156936217f, 0.669051409f},
-std::array<float,2>{0.416089118f, 0.414370507f},
-std::array<float,2>{0.899998724f, 0.70269686f},
-std::array<float,2>{0.540562868f, 0.0804049596f},
-std::array<float,2>{0.145492643f, 0.912959993f},
-std::array<float,2>{0.0948525816f, 0.199848816f},
-std::array<float,2>{0.685114622f, 0.852648497f},
-std::array<float,2>{0.78240788f, 0.277324796f},
-std::array<float,2>{0.363382906f, 0.593920469f},
-std::array<float,2>{0.0236798022f, 0.34512943f},
-std::array<float,2>{0.713044643f, 0.557891726f},
-std::array<float,2>{0.827776611f, 0.160214424f},
-std::array<float,2>{0.274578035f, 0.756573141f},
-std::array<float,2>{0.451829135f, 0.0622347556f},
-std::array<float,2>{0.945599198f, 0.968353987f},
-std::array<float,2>{0.57866925f, 0.438637555f},
-std::array<float,2>{0.217471525f, 0.627722085f},
-std::array<float,2>{0.373782724f, 0.38543576f},
-std::array<float,2>{0.795865655f, 0.719542682f},
-std::array<float,2>{0.675741196f, 0.1139661f},
-std::array<float,2>{0.107372195f, 0.876580179f},
-std::array<float,2>{0.153334767f, 0.221192837f},
-std::array<float,2>{0.536514759f, 0.832644999f},
-std::array<float,2>{0.895912468f, 0.309937775f},
-std::array<float,2>{0.407033294f, 0.590293527f},
-std::array<float,2>{0.222288594f, 0.480127305f},
-std::array<float,2>{0.612893581f, 0.660606384f},
-std::array<float,2>{0.975566506f, 0.00582110556f},
-std::array<float,2>{0.49533549f, 0.992288291f},
-std::array<float,2>{0.306010008f, 0.127720878f},
-std::array<float,2>{0.852449f, 0.796838999f},
-std::array<float,2>{0.732300758f, 0.321623921f},
-std::array<float,2>{0.0514619797f, 0.513234258f},
-std::array<float,2>{0.402273089f, 0.272286206f},
-std::array<float,2>{0.93384409f, 0.602340341f},
-std::array<float,2>{0.507126808f, 0.194588274f},
-std::array<float,2>{0.179134116f, 0.849872351f},
-std::array<float,2>{0.0656780526f, 0.0932574347f},
-std::array<float,2>{0.637668967f, 0.918877721f},
-std::array<float,2>{0.772916675f, 0.40784809f},
-std::array<float,2>{0.317672789f, 0.690146148f},
-std::array<float,2>{0.119365737f, 0.430461824f},
-std::array<float,2>{0.669814348f, 0.712341011f},
-std::array<float,2>{0.810066521f, 0.0647743791f},
-std::array<float,2>{0.35016942f, 0.936446369f},
-std::array<float,2>{0.435118288f, 0.215661153f},
-std::array<float,2>{0.883818328f, 0.864809275f},
-std::array<float,2>{0.554719508f, 0.258527935f},
-std::array<float,2>{0.128668293f, 0.620227575f},
-std::array<float,2>{0.255155295f, 0.342824876f},
-std::array<float,2>{0.833731413f, 0.531145036f},
-std::array<float,2>{0.690858305f, 0.149550065f},
-std::array<float,2>{0.010713323f, 0.79821533f},
-std::array<float,2>{0.193614975f, 0.0180392899f},
-std::array<float,2>{0.574180186f, 0.976163089f},
-std::array<float,2>{0.967941523f, 0.497303218f},
-std::array<float,2>{0.461027026f, 0.68282342f},
-std::array<float,2>{0.158756509f, 0.289280325f},
-std::array<float,2>{0.516143382f, 0.564710617f},
-std::array<float,2>{0.916621149f, 0.24361676f},
-std::array<float,2>{0.378149837f, 0.818757296f},
-std::array<float,2>{0.337510496f, 0.10545481f},
-std::array<float,2>{0.760463774f, 0.901660025f},
-std::array<float,2>{0.648479164f, 0.405167907f},
-std::array<float,2>{0.091600433f, 0.737374365f},
-std::array<float,2>{0.481193811f, 0.465147614f},
-std::array<float,2>{0.988524318f, 0.644293785f},
-std::array<float,2>{0.605714083f, 0.0316533744f},
-std::array<float,2>{0.234893724f, 0.943139017f},
-std::array<float,2>{0.0409476571f, 0.184427708f},
-std::array<float,2>{0.743534505f, 0.777414739f},
-std::array<float,2>{0.863255382f, 0.365437984f},
-std::array<float,2>{0.283134341f, 0.538102746f},
-std::array<float,2>{0.00116410118f, 0.266463101f},
-std::array<float,2>{0.698874056f, 0.606586337f},
-std::array<float,2>{0.836235106f, 0.187800735f},
-std::array<float,2>{0.262158871f, 0.845978856f},
-std::array<float,2>{0.458774894f, 0.089305453f},
-std::array<float,2>{0.957993031f, 0.916966975f},
-std::array<float,2>{0.566679597f, 0.411079347f},
-std::array<float,2>{0.195570454f, 0.692528903f},
-std::array<float,2>{0.354789525f, 0.482686639f},
-std::array<float,2>{0.79708612f, 0.656398296f},
-std::array<float,2>{0.661543369f, 0.00125630095f},
-std::array<float,2>{0.113842919f, 0.998286068f},
-std::array<float,2>{0.133069426f, 0.130100176f},
-std::array<float,2>{0.550723553f, 0.790552378f},
-std::array<float,2>{0.876104057f, 0.325997353f},
-std::array<float,2>{0.426415443f, 0.509196103f},
-std::array<float,2>{0.244280055f, 0.387760788f},
-std::array<float,2>{0.594255865f, 0.725586712f},
-std::array<float,2>{0.996465504f, 0.110585056f},
-std::array<float,2>{0.47081998f, 0.880421042f},
-std::array<float,2>{0.294667721f, 0.223454729f},
-std::array<float,2>{0.874159336f, 0.830510795f},
-std::array<float,2>{0.736971974f, 0.305784941f},
-std::array<float,2>{0.0367498323f, 0.586869121f},
-std::array<float,2>{0.386191726f, 0.348745316f},
-std::array<float,2>{0.912668467f, 0.561511099f},
-std::array<float,2>{0.528203309f, 0.159242883f},
-std::array<float,2>{0.171215147f, 0.750714302f},
-std::array<float,2>{0.0784768537f, 0.0551071726f},
-std::array<float,2>{0.644000173f, 0.963468492f},
-std::array<float,2>{0.750035822f, 0.442596167f},
-std::array<float,2>{0.330916911f, 0.631286383f},
-std::array<float,2>{0.0997063071f, 0.464784205f},
-std::array<float,2>{0.680809617f, 0.645626664f},
-std::array<float,2>{0.78639102f, 0.0375978015f},
-std::array<float,2>{0.362309426f, 0.941105425f},
-std::array<float,2>{0.42171067f, 0.181111991f},
-std::array<float,2>{0.903239906f, 0.776982486f},
-std::array<float,2>{0.544776618f, 0.360319525f},
-std::array<float,2>{0.14157933f, 0.534069717f},
-std::array<float,2>{0.270361811f, 0.296727926f},
-std::array<float,2>{0.819585264f, 0.567233622f},
-std::array<float,2>{0.707252562f, 0.247878179f},
-std::array<float,2>{0.0197444279f, 0.815669894f},
-std::array<float,2>{0.209677517f, 0.107044287f},
-std::array<float,2>{0.587428629f, 0.903294742f},
-std::array<float,2>{0.938135862f, 0.401019722f},
-std::array<float,2>{0.438656688f, 0.741742969f},
-std::array<float,2>{0.180440545f, 0.338069886f},
-std::array<float,2>{0.511370301f, 0.524929523f},
-std::array<float,2>{0.929056525f, 0.152663454f},
-std::array<float,2>{0.39384374f, 0.803228915f},
-std::array<float,2>{0.325553596f, 0.0196305905f},
-std::array<float,2>{0.780118585f, 0.970081568f},
-std::array<float,2>{0.631555736f, 0.492482662f},
-std::array<float,2>{0.0718916804f, 0.686943948f},
-std::array<float,2>{0.489206731f, 0.434652269f},
-std::array<float,2>{0.976874113f, 0.718256474f},
-std::array<float,2>{0.621454656f, 0.0680013523f},
-std::array<float,2>{0.230723321f, 0.931064427f},
-std::array<float,2>{0.0564736985f, 0.214500099f},
-std::array<float,2>{0.719761491f, 0.861581624f},
-std::array<float,2>{0.845471919f, 0.263112366f},
-std::array<float,2>{0.299404204f, 0.621156573f},
-std::array<float,2>{0.0687247142f, 0.374034286f},
-std::array<float,2>{0.636228204f, 0.539586425f},
-std::array<float,2>{0.765830457f, 0.176141724f},
-std::array<float,2>{0.313890219f, 0.76740998f},
-std::array<float,2>{0.40251407f, 0.0455950461f},
-std::array<float,2>{0.930347621f, 0.951257646f},
-std::array<float,2>{0.50289768f, 0.459762126f},
-std::array<float,2>{0.17253153f, 0.65038377f},
-std::array<float,2>{0.309131026f, 0.393512577f},
-std::array<float,2>{0.85843128f, 0.748924613f},
-std::array<float,2>{0.727218807f, 0.099476181f},
-std::array<float,2>{0.0504862107f, 0.893945396f},
-std::array<float,2>{0.222673282f, 0.234643131f},
-std::array<float,2>{0.616936982f, 0.824600279f},
-std::array<float,2>{0.970437169f, 0.285665214f},
-std::array<float,2>{0.49766022f, 0.575087547f},
-std::array<float,2>{0.150716722f, 0.488376439f},
-std::array<float,2>{0.534319103f, 0.674801648f},
-std::array<float,2>{0.890986323f, 0.0302545112f},
-std::array<float,2>{0.411084294f, 0.980914295f},
-std::array<float,2>{0.36988619f, 0.14709191f},
-std::array<float,2>{0.79228133f, 0.80977124f},
-std::array<float,2>{0.677440584f, 0.332282245f},
-std::array<float,2>{0.102582343f, 0.520035684f},
-std::array<float,2>{0.44727549f, 0.252354026f},
-std::array<float,2>{0.950269341f, 0.611130655f},
-std::array<float,2>{0.582744539f, 0.209786147f},
-std::array<float,2>{0.214788198f, 0.873024285f},
-std::array<float,2>{0.0282140635f, 0.0722588003f},
-std::array<float,2>{0.714924514f, 0.925768137f},
-std::array<float,2>{0.823387086f, 0.425317585f},
-std::array<float,2>{0.279564559f, 0.708315194f},
-std::array<float,2>{0.0435313955f, 0.420599788f},
-std::array<float,2>{0.749412298f, 0.697617412f},
-std::array<float,2>{0.867177427f, 0.0850337371f},
-std::array<float,2>{0.287430733f, 0.908656299f},
-std::array<float,2>{0.479996562f, 0.196048424f},
-std::array<float,2>{0.985832512f, 0.857355654f},
-std::array<float,2>{0.603615582f, 0.281167477f},
-std::array<float,2>{0.240310207f, 0.599232197f},
-std::array<float,2>{0.343265772f, 0.313628614f},
-std::array<float,2>{0.764826775f, 0.501726747f},
-std::array<float,2>{0.655832291f, 0.139853701f},
-std::array<float,2>{0.0891098827f, 0.787567675f},
-std::array<float,2>{0.163500562f, 0.0123554207f},
-std::array<float,2>{0.523231506f, 0.988817751f},
-std::array<float,2>{0.920997858f, 0.474938065f},
-std::array<float,2>{0.380484372f, 0.664107323f},
-std::array<float,2>{0.18863596f, 0.304319143f},
-std::array<float,2>{0.577489972f, 0.584841311f},
-std::array<float,2>{0.961861193f, 0.234147072f},
-std::array<float,2>{0.465239912f, 0.839921594f},
-std::array<float,2>{0.251709759f, 0.120405465f},
-std::array<float,2>{0.828406274f, 0.889509857f},
-std::array<float,2>{0.69272691f, 0.378126353f},
-std::array<float,2>{0.0153606972f, 0.729462206f},
-std::array<float,2>{0.432926804f, 0.4482916f},
-std::array<float,2>{0.887168348f, 0.633694291f},
-std::array<float,2>{0.562349319f, 0.0515430383f},
-std::array<float,2>{0.130179316f, 0.955496371f},
-std::array<float,2>{0.121818788f, 0.166255862f},
-std::array<float,2>{0.66641885f, 0.758375168f},
-std::array<float,2>{0.805273771f, 0.354947686f},
-std::array<float,2>{0.345173806f, 0.548906088f},
-std::array<float,2>{0.111508228f, 0.281386137f},
-std::array<float,2>{0.658014476f, 0.573625743f},
-std::array<float,2>{0.803753495f, 0.239070132f},
-std::array<float,2>{0.358264863f, 0.822774887f},
-std::array<float,2>{0.422549456f, 0.0954229683f},
-std::array<float,2>{0.878926396f, 0.895811737f},
-std::array<float,2>{0.553932786f, 0.396081746f},
-std::array<float,2>{0.136952475f, 0.743770182f},
-std::array<float,2>{0.261569768f, 0.45553574f},
-std::array<float,2>{0.843558431f, 0.655889273f},
-std::array<float,2>{0.699715793f, 0.0425174572f},
-std::array<float,2>{0.00693975482f, 0.945954204f},
-std::array<float,2>{0.199804455f, 0.175436616f},
-std::array<float,2>{0.563314974f, 0.772046924f},
-std::array<float,2>{0.956834197f, 0.368864864f},
-std::array<float,2>{0.453898728f, 0.545487344f},
-std::array<float,2>{0.167933255f, 0.427649379f},
-std::array<float,2>{0.524525464f, 0.704620719f},
-std::array<float,2>{0.9092471f, 0.075069651f},
-std::array<float,2>{0.390139967f, 0.926890314f},
-std::array<float,2>{0.333673328f, 0.203877494f},
-std::array<float,2>{0.757615447f, 0.867531717f},
-std::array<float,2>{0.644705772f, 0.25736776f},
-std::array<float,2>{0.0844787359f, 0.614007056f},
-std::array<float,2>{0.473217726f, 0.33030957f},
-std::array<float,2>{0.995139956f, 0.515832245f},
-std::array<float,2>{0.599913478f, 0.142921999f},
-std::array<float,2>{0.247703597f, 0.807412207f},
-std::array<float,2>{0.034564659f, 0.0239792895f},
-std::array<float,2>{0.741613626f, 0.978250206f},
-std::array<float,2>{0.870138884f, 0.487703383f},
-std::array<float,2>{0.2915681f, 0.676113665f},
-std::array<float,2>{0.0183497667f, 0.470289677f},
-std::array<float,2>{0.705750108f, 0.670239806f},
-std::array<float,2>{0.816274464f, 0.00977861695f},
-std::array<float,2>{0.268154204f, 0.984705925f},
-std::array<float,2>{0.44292587f, 0.133512467f},
-std::array<float,2>{0.942697823f, 0.782045305f},
-std::array<float,2>{0.592491746f, 0.31947279f},
-std::array<float,2>{0.207003281f, 0.507376432f},
-std::array<float,2>{0.366283059f, 0.274473906f},
-std::array<float,2>{0.784357011f, 0.596523046f},
-std::array<float,2>{0.686536908f, 0.202170447f},
-std::array<float,2>{0.0962374434f, 0.855290413f},
-std::array<float,2>{0.147891015f, 0.079711616f},
-std::array<float,2>{0.541760802f, 0.91073066f},
-std::array<float,2>{0.901050508f, 0.417404205f},
-std::array<float,2>{0.415527463f, 0.699713051f},
-std::array<float,2>{0.228907436f, 0.358497769f},
-std::array<float,2>{0.618343174f, 0.554501235f},
-std::array<float,2>{0.982344985f, 0.170432806f},
-std::array<float,2>{0.487926692f, 0.764726222f},
-std::array<float,2>{0.30224824f, 0.047582157f},
-std::array<float,2>{0.850074708f, 0.958982944f},
-std::array<float,2>{0.726065695f, 0.453089803f},
-std::array<float,2>{0.0612989143f, 0.639671803f},
-std::array<float,2>{0.395736277f, 0.380051941f},
-std::array<float,2>{0.922497153f, 0.733470738f},
-std::array<float,2>{0.514894247f, 0.121942438f},
-std::array<float,2>{0.184153333f, 0.884941041f},
-std::array<float,2>{0.0780810565f, 0.228709638f},
-std::array<float,2>{0.628662527f, 0.836465538f},
-std::array<float,2>{0.773827672f, 0.300682515f},
-std::array<float,2>{0.322916359f, 0.579666436f},
-std::array<float,2>{0.0532044508f, 0.323982447f},
-std::array<float,2>{0.732656121f, 0.514948189f},
-std::array<float,2>{0.854973614f, 0.126662061f},
-std::array<float,2>{0.307494581f, 0.79359293f},
-std::array<float,2>{0.492692083f, 0.00736614643f},
-std::array<float,2>{0.973487139f, 0.994322598f},
-std::array<float,2>{0.610931277f, 0.478224039f},
-std::array<float,2>{0.220380783f, 0.662359715f},
-std::array<float,2>{0.318622082f, 0.409142107f},
-std::array<float,2>{0.770833611f, 0.687598884f},
-std::array<float,2>{0.640060782f, 0.0917835832f},
-std::array<float,2>{0.0633777976f, 0.921077728f},
-std::array<float,2>{0.176122725f, 0.191812173f},
-std::array<float,2>{0.505284846f, 0.848169625f},
-std::array<float,2>{0.937088311f, 0.27005437f},
-std::array<float,2>{0.39865461f, 0.605368614f},
-std::array<float,2>{0.215367749f, 0.439485252f},
-std::array<float,2>{0.582017422f, 0.625695586f},
-std::array<float,2>{0.947406948f, 0.0602910332f},
-std::array<float,2>{0.451040059f, 0.966066062f},
-std::array<float,2>{0.277198464f, 0.16366756f},
-std::array<float,2>{0.825128555f, 0.754242718f},
-std::array<float,2>{0.712291539f, 0.346003056f},
-std::array<float,2>{0.0268685929f, 0.555810392f},
-std::array<float,2>{0.409366906f, 0.311907917f},
-std::array<float,2>{0.896871805f, 0.592891574f},
-std::array<float,2>{0.537610114f, 0.219336435f},
-std::array<float,2>{0.154879779f, 0.834477127f},
-std::array<float,2>{0.109045304f, 0.115281768f},
-std::array<float,2>{0.673413813f, 0.878133059f},
-std::array<float,2>{0.793958068f, 0.384740412f},
-std::array<float,2>{0.372671932f, 0.72128135f},
-std::array<float,2>{0.0928087905f, 0.403794289f},
-std::array<float,2>{0.651714563f, 0.734536946f},
-std::array<float,2>{0.759268761f, 0.101779908f},
-std::array<float,2>{0.338568002f, 0.898645759f},
-std::array<float,2>{0.37662977f, 0.244293109f},
-std::array<float,2>{0.914363444f, 0.816827834f},
-std::array<float,2>{0.518724978f, 0.291526675f},
-std::array<float,2>{0.15729548f, 0.562698781f},
-std::array<float,2>{0.284342736f, 0.36490038f},
-std::array<float,2>{0.860959172f, 0.535881817f},
-std::array<float,2>{0.744624317f, 0.187154889f},
-std::array<float,2>{0.0412335396f, 0.780858874f},
-std::array<float,2>{0.238075122f, 0.0349748954f},
-std::array<float,2>{0.608681262f, 0.944390178f},
-std::array<float,2>{0.990391076f, 0.467459977f},
-std::array<float,2>{0.483575553f, 0.641516924f},
-std::array<float,2>{0.126657009f, 0.260603815f},
-std::array<float,2>{0.558438778f, 0.619048536f},
-std::array<float,2>{0.88653487f, 0.217338964f},
-std::array<float,2>{0.437049717f, 0.866819263f},
-std::array<float,2>{0.349155128f, 0.0638959557f},
-std::array<float,2>{0.811060071f, 0.935306132f},
-std::array<float,2>{0.67037648f, 0.432834864f},
-std::array<float,2>{0.118256718f, 0.71309495f},
-std::array<float,2>{0.464831024f, 0.49943915f},
-std::array<float,2>{0.966143668f, 0.679695249f},
-std::array<float,2>{0.57170248f, 0.0171114001f},
-std::array<float,2>{0.192589328f, 0.974394798f},
-std::array<float,2>{0.00892486703f, 0.150748342f},
-std::array<float,2>{0.688923776f, 0.799042165f},
-std::array<float,2>{0.834035218f, 0.339887589f},
-std::array<float,2>{0.25666678f, 0.528372765f},
-std::array<float,2>{0.0147490986f, 0.30220899f},
-std::array<float,2>{0.692985952f, 0.583249688f},
-std::array<float,2>{0.828868151f, 0.232358381f},
-std::array<float,2>{0.250985056f, 0.843568325f},
-std::array<float,2>{0.465749502f, 0.117229559f},
-std::array<float,2>{0.961308479f, 0.887372911f},
-std::array<float,2>{0.57763797f, 0.375678718f},
-std::array<float,2>{0.189392328f, 0.728478611f},
-std::array<float,2>{0.345390975f, 0.446383119f},
-std::array<float,2>{0.80492121f, 0.635879695f},
-std::array<float,2>{0.666891932f, 0.0544348769f},
-std::array<float,2>{0.121367283f, 0.953914285f},
-std::array<float,2>{0.130542964f, 0.165448055f},
-std::array<float,2>{0.561790884f, 0.76068604f},
-std::array<float,2>{0.88769412f, 0.352094173f},
-std::array<float,2>{0.433211565f, 0.548666537f},
-std::array<float,2>{0.240886927f, 0.418670177f},
-std::array<float,2>{0.604422748f, 0.69682759f},
-std::array<float,2>{0.986071587f, 0.083277829f},
-std::array<float,2>{0.479741603f, 0.907458484f},
-std::array<float,2>{0.288063854f, 0.198867217f},
-std::array<float,2>{0.866244614f, 0.859214664f},
-std::array<float,2>{0.749957621f, 0.278043061f},
-std::array<float,2>{0.0430595241f, 0.600100994f},
-std::array<float,2>{0.380360484f, 0.316362798f},
-std::array<float,2>{0.92152983f, 0.502779484f},
-std::array<float,2>{0.522502661f, 0.137145221f},
-std::array<float,2>{0.163723737f, 0.786970794f},
-std::array<float,2>{0.089403756f, 0.015606801f},
-std::array<float,2>{0.655444562f, 0.991503596f},
-std::array<float,2>{0.765448987f, 0.473146766f},
-std::array<float,2>{0.342949837f, 0.667091429f},
-std::array<float,2>{0.103497781f, 0.490786493f},
-std::array<float,2>{0.677107871f, 0.673193097f},
-std::array<float,2>{0.792550743f, 0.0282833055f},
-std::array<float,2>{0.369350702f, 0.983281791f},
-std::array<float,2>{0.410283595f, 0.144721225f},
-std::array<float,2>{0.891194582f, 0.810965896f},
-std::array<float,2>{0.535031557f, 0.335604489f},
-std::array<float,2>{0.151179671f, 0.522750676f},
-std::array<float,2>{0.280061305f, 0.251589984f},
-std::array<float,2>{0.823802292f, 0.611923099f},
-std::array<float,2>{0.715501845f, 0.207547143f},
-std::array<float,2>{0.0278086793f, 0.87354809f},
-std::array<float,2>{0.214115426f, 0.0733703077f},
-std::array<float,2>{0.582432091f, 0.922865868f},
-std::array<float,2>{0.950745106f, 0.423006564f},
-std::array<float,2>{0.447835177f, 0.709720254f},
-std::array<float,2>{0.172217101f, 0.372807175f},
-std::array<float,2>{0.50232619f, 0.5413239f},
-std::array<float,2>{0.929986596f, 0.179375648f},
-std::array<float,2>{0.402959377f, 0.768349051f},
-std::array<float,2>{0.314302802f, 0.0431722961f},
-std::array<float,2>{0.766463101f, 0.950468361f},
-std::array<float,2>{0.636551559f, 0.457449973f},
-std::array<float,2>{0.0690467432f, 0.650592506f},
-std::array<float,2>{0.497278124f, 0.391248643f},
-std::array<float,2>{0.969870329f, 0.746872485f},
-std::array<float,2>{0.616434693f, 0.101039596f},
-std::array<float,2>{0.223508343f, 0.890859365f},
-std::array<float,2>{0.0498257019f, 0.236402676f},
-std::array<float,2>{0.726684153f, 0.827058971f},
-std::array<float,2>{0.859291255f, 0.28773427f},
-std::array<float,2>{0.308776647f, 0.577741385f},
-std::array<float,2>{0.0717768595f, 0.336666554f},
-std::array<float,2>{0.631224632f, 0.525925159f},
-std::array<float,2>{0.779543877f, 0.155022323f},
-std::array<float,2>{0.326124221f, 0.801800609f},
-std::array<float,2>{0.394310713f, 0.0227214675f},
-std::array<float,2>{0.929235339f, 0.970719695f},
-std::array<float,2>{0.511219203f, 0.494958371f},
-std::array<float,2>{0.179919377f, 0.685422838f},
-std::array<float,2>{0.299264669f, 0.43696478f},
-std::array<float,2>{0.845100045f, 0.716097236f},
-std::array<float,2>{0.720485628f, 0.069826372f},
-std::array<float,2>{0.0558465496f, 0.93201524f},
-std::array<float,2>{0.231024861f, 0.211879447f},
-std::array<float,2>{0.621960044f, 0.859965503f},
-std::array<float,2>{0.977351725f, 0.264110655f},
-std::array<float,2>{0.488317728f, 0.624956429f},
-std::array<float,2>{0.140725791f, 0.461583167f},
-std::array<float,2>{0.543993175f, 0.646682322f},
-std::array<float,2>{0.902490318f, 0.0364170372f},
-std::array<float,2>{0.421356678f, 0.938350081f},
-std::array<float,2>{0.362956166f, 0.18247956f},
-std::array<float,2>{0.786747932f, 0.774777353f},
-std::array<float,2>{0.681160569f, 0.362931699f},
-std::array<float,2>{0.100579545f, 0.531760454f},
-std::array<float,2>{0.439172149f, 0.293509305f},
-std::array<float,2>{0.937816679f, 0.570082903f},
-std::array<float,2>{0.58722502f, 0.24902378f},
-std::array<float,2>{0.209371343f, 0.813760519f},
-std::array<float,2>{0.0200480912f, 0.109042726f},
-std::array<float,2>{0.70797658f, 0.90622133f},
-std::array<float,2>{0.819980323f, 0.400157124f},
-std::array<float,2>{0.269990951f, 0.739762545f},
-std::array<float,2>{0.0362055078f, 0.389162838f},
-std::array<float,2>{0.736551285f, 0.724057853f},
-std::array<float,2>{0.874599457f, 0.113142811f},
-std::array<float,2>{0.294028819f, 0.881256223f},
-std::array<float,2>{0.471294552f, 0.224646822f},
-std::array<float,2>{0.99700439f, 0.829837978f},
-std::array<float,2>{0.594222307f, 0.307280928f},
-std::array<float,2>{0.244729087f, 0.587892413f},
-std::array<float,2>{0.330323339f, 0.351423383f},
-std::array<float,2>{0.750511289f, 0.559035301f},
-std::array<float,2>{0.644197404f, 0.157239437f},
-std::array<float,2>{0.079041563f, 0.752316296f},
-std::array<float,2>{0.171644852f, 0.0581047125f},
-std::array<float,2>{0.527653098f, 0.961008668f},
-std::array<float,2>{0.912195504f, 0.445131272f},
-std::array<float,2>{0.386472523f, 0.630582869f},
-std::array<float,2>{0.195821732f, 0.268566072f},
-std::array<float,2>{0.567103505f, 0.609191239f},
-std::array<float,2>{0.957135201f, 0.191400945f},
-std::array<float,2>{0.458360106f, 0.845597744f},
-std::array<float,2>{0.262553662f, 0.0871965662f},
-std::array<float,2>{0.836750448f, 0.915155172f},
-std::array<float,2>{0.698249221f, 0.412592798f},
-std::array<float,2>{0.00177935918f, 0.69416225f},
-std::array<float,2>{0.42603308f, 0.480526626f},
-std::array<float,2>{0.87667048f, 0.659768462f},
-std::array<float,2>{0.550066411f, 0.00364932185f},
-std::array<float,2>{0.133398071f, 0.997632325f},
-std::array<float,2>{0.113726735f, 0.130935222f},
-std::array<float,2>{0.661672771f, 0.791898668f},
-std::array<float,2>{0.797442675f, 0.327129781f},
-std::array<float,2>{0.355152458f, 0.511497259f},
-std::array<float,2>{0.118868351f, 0.258254826f},
-std::array<float,2>{0.67046541f, 0.620990217f},
-std::array<float,2>{0.810799539f, 0.215081617f},
-std::array<float,2>{0.348870128f, 0.864359677f},
-std::array<float,2>{0.436582237f, 0.0652429536f},
-std::array<float,2>{0.885787964f, 0.935732782f},
-std::array<float,2>{0.557653129f, 0.429938942f},
-std::array<float,2>{0.126288339f, 0.712739587f},
-std::array<float,2>{0.255878031f, 0.497831136f},
-std::array<float,2>{0.834788561f, 0.683469296f},
-std::array<float,2>{0.689139605f, 0.0183424167f},
-std::array<float,2>{0.00938619487f, 0.976006508f},
-std::array<float,2>{0.193241417f, 0.150132522f},
-std::array<float,2>{0.571903408f, 0.798607767f},
-std::array<float,2>{0.966346741f, 0.343321204f},
-std::array<float,2>{0.464259803f, 0.530287564f},
-std::array<float,2>{0.158148006f, 0.4046323f},
-std::array<float,2>{0.519159257f, 0.737795055f},
-std::array<float,2>{0.914563715f, 0.104715683f},
-std::array<float,2>{0.376105487f, 0.901862621f},
-std::array<float,2>{0.338195592f, 0.244032428f},
-std::array<float,2>{0.759685099f, 0.819077134f},
-std::array<float,2>{0.651935101f, 0.289996415f},
-std::array<float,2>{0.0932878181f, 0.565184951f},
-std::array<float,2>{0.484231561f, 0.365754962f},
-std::array<float,2>{0.990994573f, 0.539037466f},
-std::array<float,2>{0.608976901f, 0.183822975f},
-std::array<float,2>{0.237428844f, 0.778312027f},
-std::array<float,2>{0.0415840559f, 0.0318729617f},
-std::array<float,2>{0.744965851f, 0.942707896f},
-std::array<float,2>{0.860748529f, 0.465686977f},
-std::array<float,2>{0.284929127f, 0.643585563f},
-std::array<float,2>{0.0265045911f, 0.439103335f},
-std::array<float,2>{0.712795138f, 0.627136528f},
-std::array<float,2>{0.824545205f, 0.0616747662f},
-std::array<float,2>{0.276397675f, 0.967872143f},
-std::array<float,2>{0.450576633f, 0.160947725f},
-std::array<float,2>{0.948241115f, 0.756113529f},
-std::array<float,2>{0.581097126f, 0.34548834f},
-std::array<float,2>{0.215030044f, 0.558481455f},
-std::array<float,2>{0.372339666f, 0.310324103f},
-std::array<float,2>{0.794640601f, 0.590804338f},
-std::array<float,2>{0.67290926f, 0.220715463f},
-std::array<float,2>{0.108478792f, 0.832384944f},
-std::array<float,2>{0.154402018f, 0.113693506f},
-std::array<float,2>{0.537445426f, 0.876429021f},
-std::array<float,2>{0.897135317f, 0.385066718f},
-std::array<float,2>{0.410004944f, 0.718776762f},
-std::array<float,2>{0.219986409f, 0.322246671f},
-std::array<float,2>{0.610589385f, 0.512767017f},
-std::array<float,2>{0.972984672f, 0.127395615f},
-std::array<float,2>{0.492374122f, 0.796198249f},
-std::array<float,2>{0.306775779f, 0.00506606046f},
-std::array<float,2>{0.855021834f, 0.992697954f},
-std::array<float,2>{0.733296216f, 0.479731768f},
-std::array<float,2>{0.0532233156f, 0.661014318f},
-std::array<float,2>{0.399036974f, 0.407549202f},
-std::array<float,2>{0.936800182f, 0.689840853f},
-std::array<float,2>{0.505714834f, 0.0937064439f},
-std::array<float,2>{0.176515982f, 0.918164372f},
-std::array<float,2>{0.062644504f, 0.195009917f},
-std::array<float,2>{0.640195787f, 0.850253105f},
-std::array<float,2>{0.771377265f, 0.27174148f},
-std::array<float,2>{0.319017023f, 0.601807177f},
-std::array<float,2>{0.0606738627f, 0.356355011f},
-std::array<float,2>{0.726159632f, 0.550847232f},
-std::array<float,2>{0.850519836f, 0.168886319f},
-std::array<float,2>{0.301817089f, 0.762307644f},
-std::array<float,2>{0.487597018f, 0.0491853096f},
-std::array<float,2>{0.981550276f, 0.960536361f},
-std::array<float,2>{0.618895829f, 0.450486243f},
-std::array<float,2>{0.229251474f, 0.638352871f},
-std::array<float,2>{0.322372168f, 0.381058007f},
-std::array<float,2>{0.774348676f, 0.73054558f},
-std::array<float,2>{0.628104448f, 0.12344908f},
-std::array<float,2>{0.0774286538f, 0.884074688f},
-std::array<float,2>{0.184022099f, 0.228087395f},
-std::array<float,2>{0.515202641f, 0.838898063f},
-std::array<float,2>{0.922328293f, 0.297044903f},
-std::array<float,2>{0.39637357f, 0.580485821f},
-std::array<float,2>{0.206518337f, 0.472206771f},
-std::array<float,2>{0.591865122f, 0.669760108f},
-std::array<float,2>{0.94292748f, 0.00885412563f},
-std::array<float,2>{0.442739248f, 0.988177299f},
-std::array<float,2>{0.267804474f, 0.136492923f},
-std::array<float,2>{0.815742493f, 0.783923209f},
-std::array<float,2>{0.705446303f, 0.317209005f},
-std::array<float,2>{0.0180098806f, 0.504400492f},
-std::array<float,2>{0.415099621f, 0.276759148f},
-std::array<float,2>{0.900648296f, 0.594281614f},
-std::array<float,2>{0.541362405f, 0.199427411f},
-std::array<float,2>{0.148347422f, 0.853385329f},
-std::array<float,2>{0.0960748419f, 0.0808514506f},
-std::array<float,2>{0.687064826f, 0.912290752f},
-std::array<float,2>{0.785073161f, 0.414758831f},
-std::array<float,2>{0.366894752f, 0.702447295f},
-std::array<float,2>{0.0841595158f, 0.429687321f},
-std::array<float,2>{0.64544481f, 0.705694556f},
-std::array<float,2>{0.757113934f, 0.077947028f},
-std::array<float,2>{0.33341223f, 0.928933144f},
-std::array<float,2>{0.390020192f, 0.205097616f},
-std::array<float,2>{0.909723878f, 0.871050775f},
-std::array<float,2>{0.525202811f, 0.254622221f},
-std::array<float,2>{0.16710636f, 0.61528194f},
-std::array<float,2>{0.291437328f, 0.328817636f},
-std::array<float,2>{0.871005535f, 0.51796937f},
-std::array<float,2>{0.741809189f, 0.141217053f},
-std::array<float,2>{0.0348258391f, 0.806168973f},
-std::array<float,2>{0.247302994f, 0.0273297746f},
-std::array<float,2>{0.600570977f, 0.9785797f},
-std::array<float,2>{0.995990515f, 0.485371709f},
-std::array<float,2>{0.472987443f, 0.679091692f},
-std::array<float,2>{0.137546852f, 0.284628779f},
-std::array<float,2>{0.554650187f, 0.570777774f},
-std::array<float,2>{0.879594028f, 0.240592837f},
-std::array<float,2>{0.421943784f, 0.820665181f},
-std::array<float,2>{0.357724488f, 0.095834069f},
-std::array<float,2>{0.804205179f, 0.897698164f},
-std::array<float,2>{0.657634795f, 0.397847861f},
-std::array<float,2>{0.111880332f, 0.745074391f},
-std::array<float,2>{0.453442544f, 0.454225242f},
-std::array<float,2>{0.956067383f, 0.652623713f},
-std::array<float,2>{0.562570453f, 0.0405357741f},
-std::array<float,2>{0.199625716f, 0.948095024f},
-std::array<float,2>{0.00741849933f, 0.172630221f},
-std::array<float,2>{0.699289858f, 0.769923747f},
-std::array<float,2>{0.842919052f, 0.369309455f},
-std::array<float,2>{0.260785133f, 0.543834746f},
-std::array<float,2>{0.046710182f, 0.28038305f},
-std::array<float,2>{0.747876406f, 0.598930597f},
-std::array<float,2>{0.863989055f, 0.195462734f},
-std::array<float,2>{0.285472214f, 0.856464863f},
-std::array<float,2>{0.477745503f, 0.085850656f},
-std::array<float,2>{0.98695451f, 0.908927202f},
-std::array<float,2>{0.601922333f, 0.419975072f},
-std::array<float,2>{0.238296583f, 0.697861493f},
-std::array<float,2>{0.341130942f, 0.475484371f},
-std::array<float,2>{0.762224495f, 0.66468209f},
-std::array<float,2>{0.654188812f, 0.0121113835f},
-std::array<float,2>{0.0859644637f, 0.988563538f},
-std::array<float,2>{0.161294952f, 0.14029938f},
-std::array<float,2>{0.519910455f, 0.787997663f},
-std::array<float,2>{0.918142676f, 0.314329684f},
-std::array<float,2>{0.38262254f, 0.5012573f},
-std::array<float,2>{0.190747216f, 0.37846005f},
-std::array<float,2>{0.575688601f, 0.72899735f},
-std::array<float,2>{0.963194728f, 0.120667107f},
-std::array<float,2>{0.468018711f, 0.888768613f},
-std::array<float,2>{0.253702879f, 0.233702257f},
-std::array<float,2>{0.831387043f, 0.840722859f},
-std::array<float,2>{0.693846941f, 0.303984433f},
-std::array<float,2>{0.0127504226f, 0.584048927f},
-std::array<float,2>{0.431539744f, 0.35544154f},
-std::array<float,2>{0.889572322f, 0.549457967f},
-std::array<float,2>{0.559519172f, 0.166758955f},
-std::array<float,2>{0.132363558f, 0.758300185f},
-std::array<float,2>{0.124003105f, 0.0508522615f},
-std::array<float,2>{0.665482998f, 0.95570755f},
-std::array<float,2>{0.808590293f, 0.449157774f},
-std::array<float,2>{0.347287476f, 0.632950187f},
-std::array<float,2>{0.0674417838f, 0.459347069f},
-std::array<float,2>{0.634370148f, 0.64972949f},
-std::array<float,2>{0.768466055f, 0.0450483188f},
-std::array<float,2>{0.315498918f, 0.951753855f},
-std::array<float,2>{0.405599594f, 0.176537767f},
-std::array<float,2>{0.932768524f, 0.766887248f},
-std::array<float,2>{0.501103163f, 0.374535888f},
-std::array<float,2>{0.174484029f, 0.53928566f},
-std::array<float,2>{0.311832786f, 0.285407394f},
-std::array<float,2>{0.856217027f, 0.574299872f},
-std::array<float,2>{0.729351401f, 0.235212892f},
-std::array<float,2>{0.0480765104f, 0.825082779f},
-std::array<float,2>{0.226166993f, 0.0989641026f},
-std::array<float,2>{0.614877582f, 0.894380867f},
-std::array<float,2>{0.97163105f, 0.392996669f},
-std::array<float,2>{0.498331577f, 0.748346865f},
-std::array<float,2>{0.149620533f, 0.332694232f},
-std::array<float,2>{0.531371832f, 0.519645691f},
-std::array<float,2>{0.893243134f, 0.14678207f},
-std::array<float,2>{0.413367987f, 0.810276628f},
-std::array<float,2>{0.36753884f, 0.0295116324f},
-std::array<float,2>{0.789835334f, 0.981332242f},
-std::array<float,2>{0.677840233f, 0.489164203f},
-std::array<float,2>{0.103707202f, 0.674286902f},
-std::array<float,2>{0.447057158f, 0.424916118f},
-std::array<float,2>{0.951874912f, 0.708830953f},
-std::array<float,2>{0.585431933f, 0.0716465712f},
-std::array<float,2>{0.211818531f, 0.924989343f},
-std::array<float,2>{0.0304694977f, 0.209408015f},
-std::array<float,2>{0.718294382f, 0.872230113f},
-std::array<float,2>{0.820597172f, 0.252709985f},
-std::array<float,2>{0.278314561f, 0.610682428f},
-std::array<float,2>{0.0983841941f, 0.359718174f},
-std::array<float,2>{0.681785822f, 0.533329785f},
-std::array<float,2>{0.787277639f, 0.181456134f},
-std::array<float,2>{0.359847784f, 0.776616871f},
-std::array<float,2>{0.418926299f, 0.0372974686f},
-std::array<float,2>{0.905717432f, 0.940759182f},
-std::array<float,2>{0.546537459f, 0.464066356f},
-std::array<float,2>{0.143550307f, 0.646229506f},
-std::array<float,2>{0.272370607f, 0.400806308f},
-std::array<float,2>{0.817421556f, 0.741522431f},
-std::array<float,2>{0.709204614f, 0.106790364f},
-std::array<float,2>{0.0229932927f, 0.902386904f},
-std::array<float,2>{0.207396075f, 0.247462854f},
-std::array<float,2>{0.588078499f, 0.816031456f},
-std::array<float,2>{0.939997971f, 0.296263248f},
-std::array<float,2>{0.440202028f, 0.566521883f},
-std::array<float,2>{0.183077306f, 0.492764711f},
-std::array<float,2>{0.509038031f, 0.687146366f},
-std::array<float,2>{0.925891697f, 0.0202100612f},
-std::array<float,2>{0.392012835f, 0.970599592f},
-std::array<float,2>{0.327994615f, 0.152976066f},
-std::array<float,2>{0.778523982f, 0.802772582f},
-std::array<float,2>{0.629012465f, 0.338806748f},
-std::array<float,2>{0.0736953914f, 0.524420679f},
-std::array<float,2>{0.491622239f, 0.263398468f},
-std::array<float,2>{0.979797661f, 0.62200141f},
-std::array<float,2>{0.623166084f, 0.214253426f},
-std::array<float,2>{0.233757794f, 0.86215049f},
-std::array<float,2>{0.0569536649f, 0.067413345f},
-std::array<float,2>{0.721134245f, 0.931438327f},
-std::array<float,2>{0.845853925f, 0.435300976f},
-std::array<float,2>{0.298564821f, 0.718345523f},
-std::array<float,2>{0.00213058223f, 0.41061613f},
-std::array<float,2>{0.695789456f, 0.693330407f},
-std::array<float,2>{0.838132977f, 0.0898302272f},
-std::array<float,2>{0.264351398f, 0.916071475f},
-std::array<float,2>{0.459734112f, 0.188291013f},
-std::array<float,2>{0.959816933f, 0.846468031f},
-std::array<float,2>{0.569478631f, 0.265785277f},
-std::array<float,2>{0.199130237f, 0.607010126f},
-std::array<float,2>{0.352387249f, 0.325410813f},
-std::array<float,2>{0.800536036f, 0.509712338f},
-std::array<float,2>{0.662185311f, 0.130650371f},
-std::array<float,2>{0.116898812f, 0.790148258f},
-std::array<float,2>{0.135412797f, 0.00192973565f},
-std::array<float,2>{0.546885312f, 0.99877733f},
-std::array<float,2>{0.877543092f, 0.483112335f},
-std::array<float,2>{0.42873767f, 0.656760871f},
-std::array<float,2>{0.242930338f, 0.306585729f},
-std::array<float,2>{0.59641844f, 0.586090863f},
-std::array<float,2>{0.998357236f, 0.222951457f},
-std::array<float,2>{0.46924445f, 0.830896378f},
-std::array<float,2>{0.296103597f, 0.11095459f},
-std::array<float,2>{0.872141123f, 0.879902542f},
-std::array<float,2>{0.734752297f, 0.388479084f},
-std::array<float,2>{0.0387364291f, 0.726272404f},
-std::array<float,2>{0.38362205f, 0.443009198f},
-std::array<float,2>{0.910880983f, 0.631698549f},
-std::array<float,2>{0.53028965f, 0.0552151278f},
-std::array<float,2>{0.168879375f, 0.962991416f},
-std::array<float,2>{0.0818026662f, 0.159926981f},
-std::array<float,2>{0.642096996f, 0.750013113f},
-std::array<float,2>{0.753451049f, 0.349191397f},
-std::array<float,2>{0.328595072f, 0.56097281f},
-std::array<float,2>{0.090899229f, 0.291136026f},
-std::array<float,2>{0.649021387f, 0.563077331f},
-std::array<float,2>{0.760203123f, 0.244700432f},
-std::array<float,2>{0.336984396f, 0.816939592f},
-std::array<float,2>{0.37866202f, 0.102338001f},
-std::array<float,2>{0.91612196f, 0.899307847f},
-std::array<float,2>{0.516043127f, 0.404040635f},
-std::array<float,2>{0.158438399f, 0.735241234f},
-std::array<float,2>{0.282620966f, 0.467245162f},
-std::array<float,2>{0.862360835f, 0.640663505f},
-std::array<float,2>{0.743848979f, 0.0346141122f},
-std::array<float,2>{0.0404445268f, 0.945240676f},
-std::array<float,2>{0.234787226f, 0.186988994f},
-std::array<float,2>{0.606261909f, 0.780641615f},
-std::array<float,2>{0.989017904f, 0.364645571f},
-std::array<float,2>{0.480596095f, 0.535363257f},
-std::array<float,2>{0.128315985f, 0.43320334f},
-std::array<float,2>{0.555256784f, 0.713389635f},
-std::array<float,2>{0.884672523f, 0.0644254535f},
-std::array<float,2>{0.434617937f, 0.934784114f},
-std::array<float,2>{0.349915266f, 0.217070356f},
-std::array<float,2>{0.809616745f, 0.866246045f},
-std::array<float,2>{0.669017375f, 0.260064662f},
-std::array<float,2>{0.119945444f, 0.618485987f},
-std::array<float,2>{0.461760908f, 0.340506405f},
-std::array<float,2>{0.96842432f, 0.528812349f},
-std::array<float,2>{0.573272526f, 0.151228175f},
-std::array<float,2>{0.19386217f, 0.799720466f},
-std::array<float,2>{0.0100510409f, 0.0169924237f},
-std::array<float,2>{0.691306174f, 0.974084496f},
-std::array<float,2>{0.833040833f, 0.49993214f},
-std::array<float,2>{0.255450219f, 0.680505335f},
-std::array<float,2>{0.0510831811f, 0.478009015f},
-std::array<float,2>{0.731810093f, 0.6626665f},
-std::array<float,2>{0.851622522f, 0.00687131425f},
-std::array<float,2>{0.306220531f, 0.995026588f},
-std::array<float,2>{0.495732844f, 0.126164809f},
-std::array<float,2>{0.975016475f, 0.793136299f},
-std::array<float,2>{0.612423718f, 0.323625684f},
-std::array<float,2>{0.222137779f, 0.515358806f},
-std::array<float,2>{0.318162531f, 0.269603491f},
-std::array<float,2>{0.772967517f, 0.604875565f},
-std::array<float,2>{0.636765897f, 0.192158088f},
-std::array<float,2>{0.0662180483f, 0.847794294f},
-std::array<float,2>{0.179552719f, 0.0908417404f},
-std::array<float,2>{0.50756377f, 0.921495259f},
-std::array<float,2>{0.934172511f, 0.408581972f},
-std::array<float,2>{0.401435226f, 0.687997162f},
-std::array<float,2>{0.21703063f, 0.346231371f},
-std::array<float,2>{0.578242123f, 0.556578279f},
-std::array<float,2>{0.946248591f, 0.16310066f},
-std::array<float,2>{0.451436371f, 0.754435539f},
-std::array<float,2>{0.274913073f, 0.0598641932f},
-std::array<float,2>{0.827153206f, 0.966704726f},
-std::array<float,2>{0.713798761f, 0.4403629f},
-std::array<float,2>{0.0240275692f, 0.625059903f},
-std::array<float,2>{0.406478941f, 0.383806437f},
-std::array<float,2>{0.89621222f, 0.720735073f},
-std::array<float,2>{0.536623478f, 0.115954503f},
-std::array<float,2>{0.154010832f, 0.878802657f},
-std::array<float,2>{0.106789276f, 0.219194874f},
-std::array<float,2>{0.67483449f, 0.834461391f},
-std::array<float,2>{0.795051575f, 0.312408954f},
-std::array<float,2>{0.37338993f, 0.593388617f},
-std::array<float,2>{0.0161205605f, 0.320177674f},
-std::array<float,2>{0.70370692f, 0.506869256f},
-std::array<float,2>{0.813494682f, 0.133269668f},
-std::array<float,2>{0.266942739f, 0.781580627f},
-std::array<float,2>{0.444060922f, 0.0103878044f},
-std::array<float,2>{0.944390595f, 0.985139132f},
-std::array<float,2>{0.591235399f, 0.470021874f},
-std::array<float,2>{0.204724103f, 0.670413315f},
-std::array<float,2>{0.363972545f, 0.417640358f},
-std::array<float,2>{0.783103704f, 0.699520707f},
-std::array<float,2>{0.684947789f, 0.0795870945f},
-std::array<float,2>{0.0954747498f, 0.910428405f},
-std::array<float,2>{0.144774318f, 0.203101084f},
-std::array<float,2>{0.540478349f, 0.854807615f},
-std::array<float,2>{0.899786413f, 0.275028825f},
-std::array<float,2>{0.416856289f, 0.596077263f},
-std::array<float,2>{0.227242887f, 0.452277094f},
-std::array<float,2>{0.62090683f, 0.64037466f},
-std::array<float,2>{0.982556403f, 0.0471313745f},
-std::array<float,2>{0.484954149f, 0.958232939f},
-std::array<float,2>{0.302764773f, 0.170108452f},
-std::array<float,2>{0.847765625f, 0.765430927f},
-std::array<float,2>{0.722815514f, 0.358929187f},
-std::array<float,2>{0.0591217615f, 0.553786933f},
-std::array<float,2>{0.398056448f, 0.300095856f},
-std::array<float,2>{0.924948037f, 0.579238355f},
-std::array<float,2>{0.512808621f, 0.229180485f},
-std::array<float,2>{0.185623556f, 0.836078703f},
-std::array<float,2>{0.0758986399f, 0.121179424f},
-std::array<float,2>{0.625667036f, 0.885613739f},
-std::array<float,2>{0.77618295f, 0.380768597f},
-std::array<float,2>{0.320799649f, 0.734277248f},
-std::array<float,2>{0.109615274f, 0.395815015f},
-std::array<float,2>{0.659145296f, 0.743550181f},
-std::array<float,2>{0.802005708f, 0.0950750485f},
-std::array<float,2>{0.356487095f, 0.896314919f},
-std::array<float,2>{0.425622523f, 0.238573626f},
-std::array<float,2>{0.881569862f, 0.822271049f},
-std::array<float,2>{0.551004827f, 0.281764597f},
-std::array<float,2>{0.140460461f, 0.5737409f},
-std::array<float,2>{0.258441776f, 0.368448615f},
-std::array<float,2>{0.840609431f, 0.545093715f},
-std::array<float,2>{0.702504516f, 0.17514357f},
-std::array<float,2>{0.00549908588f, 0.771491647f},
-std::array<float,2>{0.201356411f, 0.0420050509f},
-std::array<float,2>{0.56584388f, 0.9457587f},
-std::array<float,2>{0.955035925f, 0.456029117f},
-std::array<float,2>{0.456681639f, 0.655662f},
-std::array<float,2>{0.165395051f, 0.257050753f},
-std::array<float,2>{0.525957346f, 0.613547742f},
-std::array<float,2>{0.906252801f, 0.203592539f},
-std::array<float,2>{0.388263464f, 0.867958784f},
-std::array<float,2>{0.335691094f, 0.0744759217f},
-std::array<float,2>{0.754185617f, 0.927651823f},
-std::array<float,2>{0.648073554f, 0.427040279f},
-std::array<float,2>{0.0832244158f, 0.704524398f},
-std::array<float,2>{0.476559818f, 0.487874299f},
-std::array<float,2>{0.992939293f, 0.676583946f},
-std::array<float,2>{0.599248648f, 0.0236767158f},
-std::array<float,2>{0.248237699f, 0.977839947f},
-std::array<float,2>{0.0328221507f, 0.143423691f},
-std::array<float,2>{0.740040958f, 0.806811988f},
-std::array<float,2>{0.868449688f, 0.33063221f},
-std::array<float,2>{0.290410876f, 0.516259193f},
-std::array<float,2>{0.0473326966f, 0.288731724f},
-std::array<float,2>{0.730142236f, 0.57660538f},
-std::array<float,2>{0.856512904f, 0.237466663f},
-std::array<float,2>{0.311009079f, 0.82796526f},
-std::array<float,2>{0.499744087f, 0.0998745784f},
-std::array<float,2>{0.971884072f, 0.892115414f},
-std::array<float,2>{0.614051163f, 0.392056644f},
-std::array<float,2>{0.225159928f, 0.747378528f},
-std::array<float,2>{0.315153062f, 0.458780617f},
-std::array<float,2>{0.769108653f, 0.651557028f},
-std::array<float,2>{0.633606672f, 0.0442199707f},
-std::array<float,2>{0.067262277f, 0.950125158f},
-std::array<float,2>{0.175665662f, 0.17819944f},
-std::array<float,2>{0.500076592f, 0.769335508f},
-std::array<float,2>{0.932311773f, 0.371390671f},
-std::array<float,2>{0.405184656f, 0.54262346f},
-std::array<float,2>{0.212842405f, 0.422742784f},
-std::array<float,2>{0.584005058f, 0.710097075f},
-std::array<float,2>{0.952739954f, 0.0729894489f},
-std::array<float,2>{0.445569336f, 0.92252636f},
-std::array<float,2>{0.278706878f, 0.20831719f},
-std::array<float,2>{0.821937501f, 0.874597609f},
-std::array<float,2>{0.717345595f, 0.250216186f},
-std::array<float,2>{0.0300610717f, 0.612699926f},
-std::array<float,2>{0.413033009f, 0.334109068f},
-std::array<float,2>{0.894275904f, 0.521954656f},
-std::array<float,2>{0.533037364f, 0.146298856f},
-std::array<float,2>{0.148923561f, 0.811611593f},
-std::array<float,2>{0.105318859f, 0.0288057178f},
-std::array<float,2>{0.679169834f, 0.983477175f},
-std::array<float,2>{0.790570199f, 0.492031813f},
-std::array<float,2>{0.368785858f, 0.672776997f},
-std::array<float,2>{0.0872157738f, 0.473802239f},
-std::array<float,2>{0.652610004f, 0.666102111f},
-std::array<float,2>{0.762831509f, 0.0142610967f},
-std::array<float,2>{0.34042573f, 0.990575194f},
-std::array<float,2>{0.381479681f, 0.13810505f},
-std::array<float,2>{0.919203997f, 0.785183549f},
-std::array<float,2>{0.521092713f, 0.315092176f},
-std::array<float,2>{0.160591587f, 0.503775656f},
-std::array<float,2>{0.286225319f, 0.278607845f},
-std::array<float,2>{0.864462256f, 0.60113126f},
-std::array<float,2>{0.746708095f, 0.197311342f},
-std::array<float,2>{0.0452265218f, 0.858161151f},
-std::array<float,2>{0.239444077f, 0.082049489f},
-std::array<float,2>{0.603473246f, 0.906333923f},
-std::array<float,2>{0.987612844f, 0.419257343f},
-std::array<float,2>{0.476764977f, 0.696094036f},
-std::array<float,2>{0.131802097f, 0.353082985f},
-std::array<float,2>{0.560351491f, 0.547431707f},
-std::array<float,2>{0.890050292f, 0.164680049f},
-std::array<float,2>{0.430357695f, 0.761522532f},
-std::array<float,2>{0.346137613f, 0.0531002805f},
-std::array<float,2>{0.806982219f, 0.954486668f},
-std::array<float,2>{0.664391696f, 0.445826113f},
-std::array<float,2>{0.124093637f, 0.635259748f},
-std::array<float,2>{0.467741251f, 0.376425296f},
-std::array<float,2>{0.963888347f, 0.727023244f},
-std::array<float,2>{0.574709713f, 0.118449725f},
-std::array<float,2>{0.190275908f, 0.887835324f},
-std::array<float,2>{0.012229193f, 0.231041148f},
-std::array<float,2>{0.694962025f, 0.842333555f},
-std::array<float,2>{0.830686033f, 0.301239818f},
-std::array<float,2>{0.252340287f, 0.582639813f},
-std::array<float,2>{0.11558108f, 0.327897817f},
-std::array<float,2>{0.663268328f, 0.509964585f},
-std::array<float,2>{0.798927188f, 0.132030442f},
-std::array<float,2>{0.35264203f, 0.792218626f},
-std::array<float,2>{0.428005427f, 0.00287050707f},
-std::array<float,2>{0.878513515f, 0.996560335f},
-std::array<float,2>{0.548653662f, 0.482119143f},
-std::array<float,2>{0.135754481f, 0.658227444f},
-std::array<float,2>{0.265403181f, 0.413102359f},
-std::array<float,2>{0.838890612f, 0.694988549f},
-std::array<float,2>{0.696985006f, 0.0862849206f},
-std::array<float,2>{0.00299928896f, 0.914486229f},
-std::array<float,2>{0.197834775f, 0.190209195f},
-std::array<float,2>{0.5690099f, 0.844244123f},
-std::array<float,2>{0.960052133f, 0.268373549f},
-std::array<float,2>{0.460684091f, 0.607427895f},
-std::array<float,2>{0.169145897f, 0.443438798f},
-std::array<float,2>{0.529649436f, 0.629160881f},
-std::array<float,2>{0.911780477f, 0.0568238497f},
-std::array<float,2>{0.383894771f, 0.962505698f},
-std::array<float,2>{0.329758614f, 0.156396046f},
-std::array<float,2>{0.752718985f, 0.753252506f},
-std::array<float,2>{0.641233265f, 0.349969149f},
-std::array<float,2>{0.0803103819f, 0.559696078f},
-std::array<float,2>{0.469939023f, 0.307980359f},
-std::array<float,2>{0.999288023f, 0.588999867f},
-std::array<float,2>{0.597230494f, 0.225780621f},
-std::array<float,2>{0.243749782f, 0.828796864f},
-std::array<float,2>{0.0375038572f, 0.111328967f},
-std::array<float,2>{0.736108661f, 0.882215917f},
-std::array<float,2>{0.871733367f, 0.390053093f},
-std::array<float,2>{0.29521662f, 0.722689569f},
-std::array<float,2>{0.0221770853f, 0.398557067f},
-std::array<float,2>{0.710762739f, 0.738745034f},
-std::array<float,2>{0.817172766f, 0.107696429f},
-std::array<float,2>{0.27256459f, 0.904697001f},
-std::array<float,2>{0.441233069f, 0.248590097f},
-std::array<float,2>{0.941324413f, 0.812660277f},
-std::array<float,2>{0.5896312f, 0.29466778f},
-std::array<float,2>{0.208869815f, 0.568376064f},
-std::array<float,2>{0.360737085f, 0.362093747f},
-std::array<float,2>{0.78845042f, 0.532676697f},
-std::array<float,2>{0.683076322f, 0.18343766f},
-std::array<float,2>{0.0994499028f, 0.773941636f},
-std::array<float,2>{0.143623576f, 0.0353758894f},
-std::array<float,2>{0.545416236f, 0.938602269f},
-std::array<float,2>{0.904432893f, 0.462152779f},
-std::array<float,2>{0.419209749f, 0.648297369f},
-std::array<float,2>{0.233255908f, 0.265214294f},
-std::array<float,2>{0.624102414f, 0.623814225f},
-std::array<float,2>{0.97853303f, 0.212178335f},
-std::array<float,2>{0.490562797f, 0.860353827f},
-std::array<float,2>{0.297619253f, 0.0688531101f},
-std::array<float,2>{0.847420752f, 0.933348238f},
-std::array<float,2>{0.721955299f, 0.435574353f},
-std::array<float,2>{0.0582577214f, 0.715551019f},
-std::array<float,2>{0.390823573f, 0.495314628f},
-std::array<float,2>{0.927440882f, 0.683711469f},
-std::array<float,2>{0.508336008f, 0.0219476204f},
-std::array<float,2>{0.181730345f, 0.972551167f},
-std::array<float,2>{0.0725802556f, 0.155531853f},
-std::array<float,2>{0.630345702f, 0.800849736f},
-std::array<float,2>{0.777367294f, 0.337210596f},
-std::array<float,2>{0.326346904f, 0.527297735f},
-std::array<float,2>{0.0645243153f, 0.272564918f},
-std::array<float,2>{0.63783145f, 0.602907836f},
-std::array<float,2>{0.772037268f, 0.193577662f},
-std::array<float,2>{0.317117393f, 0.851554632f},
-std::array<float,2>{0.40113309f, 0.0923424438f},
-std::array<float,2>{0.934639215f, 0.919740915f},
-std::array<float,2>{0.50604105f, 0.406323045f},
-std::array<float,2>{0.178262934f, 0.691404402f},
-std::array<float,2>{0.304801852f, 0.479033351f},
-std::array<float,2>{0.853018999f, 0.661477745f},
-std::array<float,2>{0.730873704f, 0.00474267825f},
-std::array<float,2>{0.0520116277f, 0.993942022f},
-std::array<float,2>{0.220836788f, 0.128433004f},
-std::array<float,2>{0.611688912f, 0.795858085f},
-std::array<float,2>{0.976148605f, 0.32060498f},
-std::array<float,2>{0.494591355f, 0.512262285f},
-std::array<float,2>{0.152747929f, 0.386128724f},
-std::array<float,2>{0.535558701f, 0.71984148f},
-std::array<float,2>{0.895067632f, 0.114866242f},
-std::array<float,2>{0.407805324f, 0.875532269f},
-std::array<float,2>{0.374114811f, 0.222100556f},
-std::array<float,2>{0.79666388f, 0.833475947f},
-std::array<float,2>{0.674149513f, 0.309025168f},
-std::array<float,2>{0.105991803f, 0.591080606f},
-std::array<float,2>{0.45262301f, 0.344487429f},
-std::array<float,2>{0.946717024f, 0.557160854f},
-std::array<float,2>{0.579832315f, 0.162059814f},
-std::array<float,2>{0.21836473f, 0.75761044f},
-std::array<float,2>{0.0245673582f, 0.0610280298f},
-std::array<float,2>{0.714762151f, 0.967178881f},
-std::array<float,2>{0.826536179f, 0.438364983f},
-std::array<float,2>{0.273608297f, 0.628803134f},
-std::array<float,2>{0.0398392566f, 0.466091156f},
-std::array<float,2>{0.74230653f, 0.642997563f},
-std::array<float,2>{0.861891866f, 0.0331845842f},
-std::array<float,2>{0.28142783f, 0.941417694f},
-std::array<float,2>{0.48202312f, 0.185500249f},
-std::array<float,2>{0.989640236f, 0.778816819f},
-std::array<float,2>{0.606540143f, 0.366922796f},
-std::array<float,2>{0.235641897f, 0.537328839f},
-std::array<float,2>{0.33627528f, 0.29077819f},
-std::array<float,2>{0.760844111f, 0.565654218f},
-std::array<float,2>{0.650369585f, 0.242888778f},
-std::array<float,2>{0.0906559229f, 0.819367528f},
-std::array<float,2>{0.159493446f, 0.103598133f},
-std::array<float,2>{0.517403483f, 0.9004336f},
-std::array<float,2>{0.917694032f, 0.405585349f},
-std::array<float,2>{0.377178729f, 0.736997664f},
-std::array<float,2>{0.195308462f, 0.342255235f},
-std::array<float,2>{0.57284081f, 0.529456258f},
-std::array<float,2>{0.966881812f, 0.149235174f},
-std::array<float,2>{0.461963594f, 0.797848761f},
-std::array<float,2>{0.25397107f, 0.0193300359f},
-std::array<float,2>{0.832476735f, 0.974819303f},
-std::array<float,2>{0.689486146f, 0.49647522f},
-std::array<float,2>{0.0109887607f, 0.681794286f},
-std::array<float,2>{0.433714509f, 0.431622654f},
-std::array<float,2>{0.883137763f, 0.711270154f},
-std::array<float,2>{0.556303144f, 0.0655568466f},
-std::array<float,2>{0.127464384f, 0.936989367f},
-std::array<float,2>{0.120790429f, 0.216459498f},
-std::array<float,2>{0.668464959f, 0.863938808f},
-std::array<float,2>{0.80947566f, 0.259057969f},
-std::array<float,2>{0.350931466f, 0.619700134f},
-std::array<float,2>{0.0043801507f, 0.370563149f},
-std::array<float,2>{0.701838076f, 0.544250727f},
-std::array<float,2>{0.841095746f, 0.173592761f},
-std::array<float,2>{0.25960806f, 0.771454632f},
-std::array<float,2>{0.455542177f, 0.0391108543f},
-std::array<float,2>{0.953878701f, 0.949157178f},
-std::array<float,2>{0.564793706f, 0.453429431f},
-std::array<float,2>{0.202618748f, 0.653621733f},
-std::array<float,2>{0.356219202f, 0.396550924f},
-std::array<float,2>{0.801020086f, 0.745969296f},
-std::array<float,2>{0.66000253f, 0.0967685431f},
-std::array<float,2>{0.110435575f, 0.896499574f},
-std::array<float,2>{0.139019385f, 0.241724044f},
-std::array<float,2>{0.552699625f, 0.822039485f},
-std::array<float,2>{0.882313251f, 0.283229023f},
-std::array<float,2>{0.424291819f, 0.572131336f},
-std::array<float,2>{0.249996334f, 0.484944016f},
-std::array<float,2>{0.598030984f, 0.678205371f},
-std::array<float,2>{0.993770361f, 0.025713617f},
-std::array<float,2>{0.475466311f, 0.979890108f},
-std::array<float,2>{0.289106429f, 0.14231877f},
-std::array<float,2>{0.867779493f, 0.804915786f},
-std::array<float,2>{0.738675833f, 0.3292225f},
-std::array<float,2>{0.0322022326f, 0.518810272f},
-std::array<float,2>{0.387046367f, 0.255087256f},
-std::array<float,2>{0.907997549f, 0.617115557f},
-std::array<float,2>{0.526831985f, 0.206153333f},
-std::array<float,2>{0.164611489f, 0.869151771f},
-std::array<float,2>{0.0821523145f, 0.0765189007f},
-std::array<float,2>{0.647398353f, 0.928686261f},
-std::array<float,2>{0.755498111f, 0.428121537f},
-std::array<float,2>{0.334569693f, 0.706392527f},
-std::array<float,2>{0.0938082263f, 0.415479809f},
-std::array<float,2>{0.68394798f, 0.701464891f},
-std::array<float,2>{0.781826437f, 0.081594035f},
-std::array<float,2>{0.364781111f, 0.913525224f},
-std::array<float,2>{0.417948097f, 0.200723514f},
-std::array<float,2>{0.89884305f, 0.852127433f},
-std::array<float,2>{0.539729059f, 0.275416583f},
-std::array<float,2>{0.145563737f, 0.595087647f},
-std::array<float,2>{0.265945971f, 0.318096668f},
-std::array<float,2>{0.812969267f, 0.505019009f},
-std::array<float,2>{0.705030501f, 0.135277137f},
-std::array<float,2>{0.0168637037f, 0.784462154f},
-std::array<float,2>{0.203361556f, 0.00864680763f},
-std::array<float,2>{0.590433121f, 0.986377478f},
-std::array<float,2>{0.94381988f, 0.471563011f},
-std::array<float,2>{0.445131123f, 0.668554008f},
-std::array<float,2>{0.187136605f, 0.29829967f},
-std::array<float,2>{0.512218416f, 0.581417739f},
-std::array<float,2>{0.924039721f, 0.226726487f},
-std::array<float,2>{0.397434533f, 0.838045478f},
-std::array<float,2>{0.321624517f, 0.124498859f},
-std::array<float,2>{0.777134478f, 0.883081555f},
-std::array<float,2>{0.626273811f, 0.38235262f},
-std::array<float,2>{0.0745094493f, 0.732355475f},
-std::array<float,2>{0.48549965f, 0.45016855f},
-std::array<float,2>{0.98427093f, 0.636939764f},
-std::array<float,2>{0.619271815f, 0.0506938994f},
-std::array<float,2>{0.228389487f, 0.959366858f},
-std::array<float,2>{0.0597186536f, 0.169230253f},
-std::array<float,2>{0.724003315f, 0.763030827f},
-std::array<float,2>{0.849255323f, 0.357242733f},
-std::array<float,2>{0.304469705f, 0.552717984f},
-std::array<float,2>{0.0290887542f, 0.252930254f},
-std::array<float,2>{0.716671586f, 0.610063314f},
-std::array<float,2>{0.822739363f, 0.210284933f},
-std::array<float,2>{0.280478477f, 0.871138275f},
-std::array<float,2>{0.448302537f, 0.0708779767f},
-std::array<float,2>{0.950139821f, 0.924781263f},
-std::array<float,2>{0.583731413f, 0.424459279f},
-std::array<float,2>{0.213600397f, 0.707322598f},
-std::array<float,2>{0.370497406f, 0.489994258f},
-std::array<float,2>{0.79138279f, 0.674964368f},
-std::array<float,2>{0.676220655f, 0.0310181063f},
-std::array<float,2>{0.102103017f, 0.981956124f},
-std::array<float,2>{0.151499927f, 0.148200154f},
-std::array<float,2>{0.534049332f, 0.808833659f},
-std::array<float,2>{0.892072916f, 0.333517283f},
-std::array<float,2>{0.411441147f, 0.521471441f},
-std::array<float,2>{0.223747894f, 0.394050211f},
-std::array<float,2>{0.616067708f, 0.749724388f},
-std::array<float,2>{0.968972862f, 0.0986270234f},
-std::array<float,2>{0.49625054f, 0.893354416f},
-std::array<float,2>{0.310442954f, 0.235882849f},
-std::array<float,2>{0.858077884f, 0.825372458f},
-std::array<float,2>{0.727834523f, 0.286878973f},
-std::array<float,2>{0.0497697294f, 0.57537365f},
-std::array<float,2>{0.403501838f, 0.373414606f},
-std::array<float,2>{0.930687964f, 0.540935397f},
-std::array<float,2>{0.503171682f, 0.177541286f},
-std::array<float,2>{0.173025504f, 0.766128898f},
-std::array<float,2>{0.070116125f, 0.0463231951f},
-std::array<float,2>{0.635357499f, 0.952607632f},
-std::array<float,2>{0.76754874f, 0.460082024f},
-std::array<float,2>{0.312915713f, 0.649132311f},
-std::array<float,2>{0.122707225f, 0.448156863f},
-std::array<float,2>{0.66773957f, 0.63449198f},
-std::array<float,2>{0.806018293f, 0.0524694957f},
-std::array<float,2>{0.344080001f, 0.956517339f},
-std::array<float,2>{0.431830645f, 0.16708076f},
-std::array<float,2>{0.888291717f, 0.759716094f},
-std::array<float,2>{0.561008215f, 0.354153663f},
-std::array<float,2>{0.129512027f, 0.54987663f},
-std::array<float,2>{0.250539839f, 0.303589523f},
-std::array<float,2>{0.82984215f, 0.585502744f},
-std::array<float,2>{0.691463649f, 0.233019486f},
-std::array<float,2>{0.0136928679f, 0.840850174f},
-std::array<float,2>{0.188086003f, 0.120109379f},
-std::array<float,2>{0.57630533f, 0.890083849f},
-std::array<float,2>{0.962136745f, 0.37726438f},
-std::array<float,2>{0.466475993f, 0.7301386f},
-std::array<float,2>{0.162613973f, 0.313035369f},
-std::array<float,2>{0.52230835f, 0.500914097f},
-std::array<float,2>{0.919971764f, 0.139102936f},
-std::array<float,2>{0.379214168f, 0.78858614f},
-std::array<float,2>{0.342531353f, 0.0133157857f},
-std::array<float,2>{0.764520347f, 0.989600003f},
-std::array<float,2>{0.654959738f, 0.47592327f},
-std::array<float,2>{0.0887126327f, 0.66510421f},
-std::array<float,2>{0.479266644f, 0.421685874f},
-std::array<float,2>{0.984455168f, 0.69880265f},
-std::array<float,2>{0.604899883f, 0.0844071284f},
-std::array<float,2>{0.241794437f, 0.90994072f},
-std::array<float,2>{0.0441798829f, 0.196375817f},
-std::array<float,2>{0.748047233f, 0.855873764f},
-std::array<float,2>{0.865987837f, 0.279577464f},
-std::array<float,2>{0.288823068f, 0.598080039f},
-std::array<float,2>{0.0799532086f, 0.347789884f},
-std::array<float,2>{0.643008828f, 0.562449694f},
-std::array<float,2>{0.751847744f, 0.158678815f},
-std::array<float,2>{0.331985056f, 0.751841307f},
-std::array<float,2>{0.385113746f, 0.0563222393f},
-std::array<float,2>{0.913895905f, 0.964115143f},
-std::array<float,2>{0.528788209f, 0.44204253f},
-std::array<float,2>{0.169931218f, 0.632070065f},
-std::array<float,2>{0.293748528f, 0.38679263f},
-std::array<float,2>{0.873855889f, 0.724848688f},
-std::array<float,2>{0.737467229f, 0.109623246f},
-std::array<float,2>{0.0357341319f, 0.879641533f},
-std::array<float,2>{0.245145366f, 0.223943293f},
-std::array<float,2>{0.595247686f, 0.831872642f},
-std::array<float,2>{0.997676671f, 0.30521965f},
-std::array<float,2>{0.472047776f, 0.587355673f},
-std::array<float,2>{0.134285033f, 0.484167516f},
-std::array<float,2>{0.549050629f, 0.657367349f},
-std::array<float,2>{0.875204444f, 7.58794122e-05f},
-std::array<float,2>{0.427220225f, 0.999606192f},
-std::array<float,2>{0.353969812f, 0.12962243f},
-std::array<float,2>{0.798647642f, 0.790006101f},
-std::array<float,2>{0.660649121f, 0.324518532f},
-std::array<float,2>{0.114817977f, 0.508254647f},
-std::array<float,2>{0.457726806f, 0.266844213f},
-std::array<float,2>{0.958611131f, 0.60624665f},
-std::array<float,2>{0.567875028f, 0.189312518f},
-std::array<float,2>{0.196981326f, 0.847343445f},
-std::array<float,2>{0.000604717468f, 0.0883817449f},
-std::array<float,2>{0.697580636f, 0.917280555f},
-std::array<float,2>{0.837307155f, 0.411242306f},
-std::array<float,2>{0.262975216f, 0.691941082f},
-std::array<float,2>{0.0549112111f, 0.43436116f},
-std::array<float,2>{0.719673038f, 0.717548132f},
-std::array<float,2>{0.844398141f, 0.0671737492f},
-std::array<float,2>{0.299886703f, 0.929808855f},
-std::array<float,2>{0.490178913f, 0.213643879f},
-std::array<float,2>{0.978351891f, 0.862439036f},
-std::array<float,2>{0.622862577f, 0.261823863f},
-std::array<float,2>{0.231721804f, 0.622365713f},
-std::array<float,2>{0.32464096f, 0.339599371f},
-std::array<float,2>{0.780950904f, 0.52380687f},
-std::array<float,2>{0.63188374f, 0.15427503f},
-std::array<float,2>{0.0703292862f, 0.804262757f},
-std::array<float,2>{0.180703074f, 0.0206925441f},
-std::array<float,2>{0.509799659f, 0.969024241f},
-std::array<float,2>{0.927825809f, 0.493711472f},
-std::array<float,2>{0.393216252f, 0.685669661f},
-std::array<float,2>{0.210638776f, 0.295297235f},
-std::array<float,2>{0.586889625f, 0.568281531f},
-std::array<float,2>{0.939264953f, 0.246239245f},
-std::array<float,2>{0.437856823f, 0.815237403f},
-std::array<float,2>{0.270881742f, 0.105797023f},
-std::array<float,2>{0.818649232f, 0.904210806f},
-std::array<float,2>{0.708425641f, 0.401861131f},
-std::array<float,2>{0.0214340221f, 0.740426481f},
-std::array<float,2>{0.420106709f, 0.463379979f},
-std::array<float,2>{0.903756797f, 0.644993186f},
-std::array<float,2>{0.543817282f, 0.0382185765f},
-std::array<float,2>{0.141862735f, 0.939486086f},
-std::array<float,2>{0.100595765f, 0.180622265f},
-std::array<float,2>{0.67985487f, 0.775991499f},
-std::array<float,2>{0.785816967f, 0.360881448f},
-std::array<float,2>{0.361818135f, 0.534744442f},
-std::array<float,2>{0.108150586f, 0.310588419f},
-std::array<float,2>{0.672564209f, 0.592175782f},
-std::array<float,2>{0.793361247f, 0.220627382f},
-std::array<float,2>{0.37177971f, 0.835049748f},
-std::array<float,2>{0.40916431f, 0.11662031f},
-std::array<float,2>{0.897910953f, 0.877517641f},
-std::array<float,2>{0.538495123f, 0.383651912f},
-std::array<float,2>{0.155474991f, 0.721734047f},
-std::array<float,2>{0.275871396f, 0.440809965f},
-std::array<float,2>{0.825952768f, 0.626847982f},
-std::array<float,2>{0.711492062f, 0.0587506294f},
-std::array<float,2>{0.0259837713f, 0.965422809f},
-std::array<float,2>{0.216246858f, 0.162942708f},
-std::array<float,2>{0.580235064f, 0.754947305f},
-std::array<float,2>{0.948705256f, 0.347633898f},
-std::array<float,2>{0.450077951f, 0.554827094f},
-std::array<float,2>{0.17724964f, 0.409475863f},
-std::array<float,2>{0.504041791f, 0.688917994f},
-std::array<float,2>{0.936428607f, 0.0906316862f},
-std::array<float,2>{0.400185794f, 0.919938505f},
-std::array<float,2>{0.320047557f, 0.192806691f},
-std::array<float,2>{0.770266056f, 0.848709404f},
-std::array<float,2>{0.638923645f, 0.270757318f},
-std::array<float,2>{0.0640751496f, 0.604290962f},
-std::array<float,2>{0.493924826f, 0.323083609f},
-std::array<float,2>{0.973691821f, 0.513750196f},
-std::array<float,2>{0.609439671f, 0.125093818f},
-std::array<float,2>{0.21967414f, 0.794406235f},
-std::array<float,2>{0.0539722033f, 0.00642419653f},
-std::array<float,2>{0.734223127f, 0.995999932f},
-std::array<float,2>{0.854209185f, 0.477521181f},
-std::array<float,2>{0.308555603f, 0.663510442f},
-std::array<float,2>{0.0079093352f, 0.498534203f},
-std::array<float,2>{0.688137472f, 0.680895627f},
-std::array<float,2>{0.835131228f, 0.0163507462f},
-std::array<float,2>{0.257704139f, 0.973001719f},
-std::array<float,2>{0.463015884f, 0.151617378f},
-std::array<float,2>{0.965529561f, 0.800738394f},
-std::array<float,2>{0.570461333f, 0.341309696f},
-std::array<float,2>{0.191743731f, 0.527505398f},
-std::array<float,2>{0.348482102f, 0.261567652f},
-std::array<float,2>{0.811818838f, 0.617774487f},
-std::array<float,2>{0.671076655f, 0.21844013f},
-std::array<float,2>{0.117618762f, 0.865859389f},
-std::array<float,2>{0.125595406f, 0.0629060045f},
-std::array<float,2>{0.557293057f, 0.933881521f},
-std::array<float,2>{0.884930849f, 0.432512671f},
-std::array<float,2>{0.435965091f, 0.714007199f},
-std::array<float,2>{0.237176463f, 0.364242524f},
-std::array<float,2>{0.608009636f, 0.536646307f},
-std::array<float,2>{0.991247773f, 0.185885251f},
-std::array<float,2>{0.483205527f, 0.779693186f},
-std::array<float,2>{0.283741713f, 0.0339565538f},
-std::array<float,2>{0.859944046f, 0.944286644f},
-std::array<float,2>{0.745947778f, 0.468347758f},
-std::array<float,2>{0.0429681428f, 0.642508686f},
-std::array<float,2>{0.375135243f, 0.403018773f},
-std::array<float,2>{0.91521436f, 0.736038029f},
-std::array<float,2>{0.51823616f, 0.103120953f},
-std::array<float,2>{0.157074675f, 0.900322318f},
-std::array<float,2>{0.0923626125f, 0.24588728f},
-std::array<float,2>{0.650440872f, 0.818311036f},
-std::array<float,2>{0.758783817f, 0.292643547f},
-std::array<float,2>{0.338988245f, 0.563969612f},
-std::array<float,2>{0.0338596813f, 0.331714869f},
-std::array<float,2>{0.740938246f, 0.517245412f},
-std::array<float,2>{0.869965076f, 0.144251004f},
-std::array<float,2>{0.292024821f, 0.808472753f},
-std::array<float,2>{0.474248886f, 0.0244971327f},
-std::array<float,2>{0.994141042f, 0.976742744f},
-std::array<float,2>{0.601464331f, 0.486469299f},
-std::array<float,2>{0.246522978f, 0.676775455f},
-std::array<float,2>{0.332270652f, 0.426592022f},
-std::array<float,2>{0.756453454f, 0.703552186f},
-std::array<float,2>{0.645899355f, 0.0757746249f},
-std::array<float,2>{0.0853012055f, 0.926143765f},
-std::array<float,2>{0.166822046f, 0.204984516f},
-std::array<float,2>{0.523618519f, 0.868922353f},
-std::array<float,2>{0.908438802f, 0.256205559f},
-std::array<float,2>{0.389581919f, 0.614404142f},
-std::array<float,2>{0.201020166f, 0.45678091f},
-std::array<float,2>{0.564134121f, 0.654665709f},
-std::array<float,2>{0.955237031f, 0.041708719f},
-std::array<float,2>{0.454251945f, 0.94721657f},
-std::array<float,2>{0.259771317f, 0.173940778f},
-std::array<float,2>{0.842587173f, 0.772634506f},
-std::array<float,2>{0.700450301f, 0.368004858f},
-std::array<float,2>{0.00637504645f, 0.546248615f},
-std::array<float,2>{0.42290917f, 0.283052772f},
-std::array<float,2>{0.879904926f, 0.572595298f},
-std::array<float,2>{0.552867651f, 0.239357904f},
-std::array<float,2>{0.138448313f, 0.824060023f},
-std::array<float,2>{0.112362221f, 0.0939983502f},
-std::array<float,2>{0.656800449f, 0.895105839f},
-std::array<float,2>{0.802937269f, 0.39535296f},
-std::array<float,2>{0.358771145f, 0.743128061f},
-std::array<float,2>{0.0768587366f, 0.379605442f},
-std::array<float,2>{0.627069533f, 0.732714415f},
-std::array<float,2>{0.774769604f, 0.122667909f},
-std::array<float,2>{0.323819369f, 0.886536539f},
-std::array<float,2>{0.394899696f, 0.230441257f},
-std::array<float,2>{0.923020244f, 0.83740133f},
-std::array<float,2>{0.514324188f, 0.299767554f},
-std::array<float,2>{0.184737861f, 0.578214169f},
-std::array<float,2>{0.3013587f, 0.357990921f},
-std::array<float,2>{0.850780487f, 0.552998424f},
-std::array<float,2>{0.724767625f, 0.171242326f},
-std::array<float,2>{0.0618788153f, 0.76457268f},
-std::array<float,2>{0.229755893f, 0.0486245267f},
-std::array<float,2>{0.618122041f, 0.95776397f},
-std::array<float,2>{0.980700791f, 0.451394826f},
-std::array<float,2>{0.487178534f, 0.639334917f},
-std::array<float,2>{0.146550581f, 0.273793906f},
-std::array<float,2>{0.542833388f, 0.597234845f},
-std::array<float,2>{0.902311623f, 0.201407835f},
-std::array<float,2>{0.414823949f, 0.853943825f},
-std::array<float,2>{0.365734458f, 0.0789701715f},
-std::array<float,2>{0.783890843f, 0.91125071f},
-std::array<float,2>{0.685976207f, 0.416338354f},
-std::array<float,2>{0.0973067507f, 0.700779557f},
-std::array<float,2>{0.442038149f, 0.46944809f},
-std::array<float,2>{0.942009866f, 0.670953572f},
-std::array<float,2>{0.593612075f, 0.0115255723f},
-std::array<float,2>{0.205924153f, 0.985720515f},
-std::array<float,2>{0.0189193264f, 0.134648889f},
-std::array<float,2>{0.706760347f, 0.782334328f},
-std::array<float,2>{0.814933121f, 0.318857968f},
-std::array<float,2>{0.268701524f, 0.505966306f},
-std::array<float,2>{0.0263381992f, 0.309653312f},
-std::array<float,2>{0.711797535f, 0.58994776f},
-std::array<float,2>{0.825818121f, 0.221660152f},
-std::array<float,2>{0.275476635f, 0.832865f},
-std::array<float,2>{0.449871302f, 0.11423213f},
-std::array<float,2>{0.94833684f, 0.876938701f},
-std::array<float,2>{0.580565035f, 0.38550657f},
-std::array<float,2>{0.21588023f, 0.719313025f},
-std::array<float,2>{0.371987253f, 0.43886885f},
-std::array<float,2>{0.793170333f, 0.627664208f},
-std::array<float,2>{0.672657847f, 0.0624871701f},
-std::array<float,2>{0.108229049f, 0.968631864f},
-std::array<float,2>{0.155595452f, 0.160436273f},
-std::array<float,2>{0.538292944f, 0.756736875f},
-std::array<float,2>{0.897628129f, 0.344881713f},
-std::array<float,2>{0.408727646f, 0.55782485f},
-std::array<float,2>{0.219370529f, 0.407974958f},
-std::array<float,2>{0.609684706f, 0.690382659f},
-std::array<float,2>{0.974004924f, 0.0928722695f},
-std::array<float,2>{0.493857116f, 0.918632507f},
-std::array<float,2>{0.308129132f, 0.194367424f},
-std::array<float,2>{0.854268372f, 0.849790156f},
-std::array<float,2>{0.733926952f, 0.272198677f},
-std::array<float,2>{0.0537326969f, 0.602164567f},
-std::array<float,2>{0.400111318f, 0.321314722f},
-std::array<float,2>{0.936082602f, 0.513440251f},
-std::array<float,2>{0.504334331f, 0.127594605f},
-std::array<float,2>{0.177696317f, 0.796588957f},
-std::array<float,2>{0.0642606393f, 0.00551571557f},
-std::array<float,2>{0.638844609f, 0.992546618f},
-std::array<float,2>{0.770113051f, 0.480404735f},
-std::array<float,2>{0.320179939f, 0.66035527f},
-std::array<float,2>{0.117367826f, 0.49738279f},
-std::array<float,2>{0.671329975f, 0.682928741f},
-std::array<float,2>{0.811724961f, 0.0177223478f},
-std::array<float,2>{0.348180801f, 0.976541519f},
-std::array<float,2>{0.435691535f, 0.149851471f},
-std::array<float,2>{0.885146797f, 0.797854602f},
-std::array<float,2>{0.55751586f, 0.343079776f},
-std::array<float,2>{0.125912756f, 0.530990601f},
-std::array<float,2>{0.257505715f, 0.258691907f},
-std::array<float,2>{0.835291088f, 0.620474517f},
-std::array<float,2>{0.688381732f, 0.21549435f},
-std::array<float,2>{0.00818871427f, 0.865045726f},
-std::array<float,2>{0.191621602f, 0.0645559728f},
-std::array<float,2>{0.57058835f, 0.936078012f},
-std::array<float,2>{0.96564126f, 0.430226266f},
-std::array<float,2>{0.463155061f, 0.711954415f},
-std::array<float,2>{0.156845182f, 0.36554873f},
-std::array<float,2>{0.518382847f, 0.538433015f},
-std::array<float,2>{0.915453494f, 0.184087723f},
-std::array<float,2>{0.375416815f, 0.777623355f},
-std::array<float,2>{0.339171618f, 0.0313095637f},
-std::array<float,2>{0.758347392f, 0.94300133f},
-std::array<float,2>{0.650730133f, 0.465027809f},
-std::array<float,2>{0.0926901326f, 0.644200444f},
-std::array<float,2>{0.483044744f, 0.404912263f},
-std::array<float,2>{0.991615593f, 0.737680793f},
-std::array<float,2>{0.60832876f, 0.105190262f},
-std::array<float,2>{0.237004444f, 0.901527166f},
-std::array<float,2>{0.0426840968f, 0.243219361f},
-std::array<float,2>{0.745711148f, 0.818442464f},
-std::array<float,2>{0.860306621f, 0.289349675f},
-std::array<float,2>{0.283981919f, 0.564497828f},
-std::array<float,2>{0.085036613f, 0.328165561f},
-std::array<float,2>{0.645608604f, 0.51851511f},
-std::array<float,2>{0.756609499f, 0.140702367f},
-std::array<float,2>{0.332322389f, 0.805930257f},
-std::array<float,2>{0.389371395f, 0.0267031062f},
-std::array<float,2>{0.908554614f, 0.97933048f},
-std::array<float,2>{0.523755312f, 0.486203939f},
-std::array<float,2>{0.166515693f, 0.679634929f},
-std::array<float,2>{0.292447835f, 0.428962171f},
-std::array<float,2>{0.869654953f, 0.705537438f},
-std::array<float,2>{0.74099952f, 0.0775289908f},
-std::array<float,2>{0.0340860635f, 0.92939496f},
-std::array<float,2>{0.24621214f, 0.205612645f},
-std::array<float,2>{0.601136088f, 0.870580792f},
-std::array<float,2>{0.994453609f, 0.254145741f},
-std::array<float,2>{0.47445339f, 0.616013825f},
-std::array<float,2>{0.138304964f, 0.454980403f},
-std::array<float,2>{0.553126812f, 0.653002501f},
-std::array<float,2>{0.880149662f, 0.0404675789f},
-std::array<float,2>{0.423118442f, 0.947466969f},
-std::array<float,2>{0.358549684f, 0.172024265f},
-std::array<float,2>{0.803143382f, 0.770032763f},
-std::array<float,2>{0.657084167f, 0.369942605f},
-std::array<float,2>{0.112554543f, 0.542982519f},
-std::array<float,2>{0.454574794f, 0.284812361f},
-std::array<float,2>{0.95538795f, 0.57126379f},
-std::array<float,2>{0.56444782f, 0.24119924f},
-std::array<float,2>{0.20091939f, 0.820937693f},
-std::array<float,2>{0.00673481775f, 0.0962271392f},
-std::array<float,2>{0.700433254f, 0.89826411f},
-std::array<float,2>{0.842385232f, 0.398223907f},
-std::array<float,2>{0.260162771f, 0.744194567f},
-std::array<float,2>{0.0616694652f, 0.381510884f},
-std::array<float,2>{0.725046158f, 0.731114149f},
-std::array<float,2>{0.850987792f, 0.12388856f},
-std::array<float,2>{0.30157885f, 0.884410501f},
-std::array<float,2>{0.486883014f, 0.227766305f},
-std::array<float,2>{0.980833054f, 0.83983624f},
-std::array<float,2>{0.617833078f, 0.297537118f},
-std::array<float,2>{0.229543045f, 0.580942512f},
-std::array<float,2>{0.324045897f, 0.355587155f},
-std::array<float,2>{0.774654508f, 0.551751316f},
-std::array<float,2>{0.627221406f, 0.168012112f},
-std::array<float,2>{0.0771128908f, 0.762123942f},
-std::array<float,2>{0.185034677f, 0.0496291667f},
-std::array<float,2>{0.514410973f, 0.960012674f},
-std::array<float,2>{0.923169613f, 0.45078966f},
-std::array<float,2>{0.394590527f, 0.638064504f},
-std::array<float,2>{0.205727056f, 0.277096182f},
-std::array<float,2>{0.593384326f, 0.593995988f},
-std::array<float,2>{0.942203104f, 0.200008824f},
-std::array<float,2>{0.442209959f, 0.852927148f},
-std::array<float,2>{0.268918037f, 0.080282025f},
-std::array<float,2>{0.814553082f, 0.912776053f},
-std::array<float,2>{0.707025766f, 0.414240479f},
-std::array<float,2>{0.0187473204f, 0.703054667f},
-std::array<float,2>{0.414610922f, 0.472023219f},
-std::array<float,2>{0.901990891f, 0.669320583f},
-std::array<float,2>{0.542715728f, 0.00965963118f},
-std::array<float,2>{0.146927088f, 0.987541139f},
-std::array<float,2>{0.0976319984f, 0.13590616f},
-std::array<float,2>{0.685603738f, 0.783522606f},
-std::array<float,2>{0.78398329f, 0.316416323f},
-std::array<float,2>{0.366121709f, 0.504261792f},
-std::array<float,2>{0.102346383f, 0.250989765f},
-std::array<float,2>{0.676023662f, 0.611523867f},
-std::array<float,2>{0.791017115f, 0.207180932f},
-std::array<float,2>{0.370308101f, 0.873259604f},
-std::array<float,2>{0.411142886f, 0.0738257393f},
-std::array<float,2>{0.891721785f, 0.923716187f},
-std::array<float,2>{0.533707321f, 0.423447549f},
-std::array<float,2>{0.151852414f, 0.709000289f},
-std::array<float,2>{0.280661643f, 0.490514427f},
-std::array<float,2>{0.822419107f, 0.673814178f},
-std::array<float,2>{0.716551542f, 0.0275843404f},
-std::array<float,2>{0.0289504901f, 0.982811093f},
-std::array<float,2>{0.213820577f, 0.145063296f},
-std::array<float,2>{0.583758414f, 0.811043262f},
-std::array<float,2>{0.949805856f, 0.335235149f},
-std::array<float,2>{0.44856289f, 0.523182452f},
-std::array<float,2>{0.173117116f, 0.390719473f},
-std::array<float,2>{0.503259301f, 0.746503413f},
-std::array<float,2>{0.931013525f, 0.101222612f},
-std::array<float,2>{0.403731793f, 0.891168952f},
-std::array<float,2>{0.312683702f, 0.236850083f},
-std::array<float,2>{0.767154694f, 0.8263219f},
-std::array<float,2>{0.635548234f, 0.287504733f},
-std::array<float,2>{0.0698875412f, 0.577510715f},
-std::array<float,2>{0.496453673f, 0.372088939f},
-std::array<float,2>{0.969071686f, 0.541696608f},
-std::array<float,2>{0.615854681f, 0.179146737f},
-std::array<float,2>{0.223955616f, 0.767925441f},
-std::array<float,2>{0.0494956896f, 0.0434901603f},
-std::array<float,2>{0.727647841f, 0.950987577f},
-std::array<float,2>{0.858294547f, 0.457912773f},
-std::array<float,2>{0.310073286f, 0.651174605f},
-std::array<float,2>{0.0140348878f, 0.446966618f},
-std::array<float,2>{0.691833556f, 0.636513948f},
-std::array<float,2>{0.829697371f, 0.0537635721f},
-std::array<float,2>{0.250938624f, 0.953346252f},
-std::array<float,2>{0.466658294f, 0.165872946f},
-std::array<float,2>{0.962220967f, 0.759968758f},
-std::array<float,2>{0.576634228f, 0.351934344f},
-std::array<float,2>{0.188269615f, 0.548228383f},
-std::array<float,2>{0.343757957f, 0.30249238f},
-std::array<float,2>{0.805818021f, 0.583512604f},
-std::array<float,2>{0.667713344f, 0.23172234f},
-std::array<float,2>{0.122971728f, 0.843024254f},
-std::array<float,2>{0.129777834f, 0.118119866f},
-std::array<float,2>{0.560664773f, 0.887105107f},
-std::array<float,2>{0.888558328f, 0.375076324f},
-std::array<float,2>{0.432079405f, 0.727698922f},
-std::array<float,2>{0.242173493f, 0.315515995f},
-std::array<float,2>{0.604537547f, 0.502411246f},
-std::array<float,2>{0.984652936f, 0.137590542f},
-std::array<float,2>{0.479026943f, 0.786151588f},
-std::array<float,2>{0.288594574f, 0.014651956f},
-std::array<float,2>{0.865783572f, 0.992148221f},
-std::array<float,2>{0.748467267f, 0.47274819f},
-std::array<float,2>{0.0443165451f, 0.667915463f},
-std::array<float,2>{0.379125267f, 0.418326914f},
-std::array<float,2>{0.920236111f, 0.696522832f},
-std::array<float,2>{0.522022069f, 0.0839828327f},
-std::array<float,2>{0.162900731f, 0.907994032f},
-std::array<float,2>{0.0885389224f, 0.198415712f},
-std::array<float,2>{0.655204773f, 0.858528078f},
-std::array<float,2>{0.764384866f, 0.277610302f},
-std::array<float,2>{0.342405498f, 0.599892259f},
-std::array<float,2>{0.0360390767f, 0.350832283f},
-std::array<float,2>{0.737639189f, 0.559504271f},
-std::array<float,2>{0.873617232f, 0.157883838f},
-std::array<float,2>{0.293524504f, 0.752451301f},
-std::array<float,2>{0.471825719f, 0.0583398379f},
-std::array<float,2>{0.997849226f, 0.961645603f},
-std::array<float,2>{0.595651388f, 0.44472304f},
-std::array<float,2>{0.245457634f, 0.6299721f},
-std::array<float,2>{0.331618816f, 0.388847053f},
-std::array<float,2>{0.751515508f, 0.724277794f},
-std::array<float,2>{0.64277339f, 0.112598717f},
-std::array<float,2>{0.0798049197f, 0.881567717f},
-std::array<float,2>{0.170265049f, 0.225539282f},
-std::array<float,2>{0.528539419f, 0.829437315f},
-std::array<float,2>{0.91369921f, 0.30695042f},
-std::array<float,2>{0.384959668f, 0.588848591f},
-std::array<float,2>{0.197136596f, 0.481383651f},
-std::array<float,2>{0.568218827f, 0.659435511f},
-std::array<float,2>{0.95879215f, 0.00335709192f},
-std::array<float,2>{0.457926482f, 0.997422636f},
-std::array<float,2>{0.262901008f, 0.13150169f},
-std::array<float,2>{0.837142706f, 0.791235447f},
-std::array<float,2>{0.697274268f, 0.326233089f},
-std::array<float,2>{0.000857874751f, 0.511101484f},
-std::array<float,2>{0.426808178f, 0.269507676f},
-std::array<float,2>{0.87544322f, 0.608510137f},
-std::array<float,2>{0.549198389f, 0.190536082f},
-std::array<float,2>{0.134526208f, 0.844788492f},
-std::array<float,2>{0.115160547f, 0.0878008232f},
-std::array<float,2>{0.661055505f, 0.915925503f},
-std::array<float,2>{0.798559368f, 0.412684023f},
-std::array<float,2>{0.353517443f, 0.693787813f},
-std::array<float,2>{0.0706626624f, 0.437120348f},
-std::array<float,2>{0.632262111f, 0.716319144f},
-std::array<float,2>{0.781148851f, 0.0693372935f},
-std::array<float,2>{0.324402541f, 0.932197154f},
-std::array<float,2>{0.393313706f, 0.211107075f},
-std::array<float,2>{0.928077042f, 0.859798789f},
-std::array<float,2>{0.510090053f, 0.264364332f},
-std::array<float,2>{0.180957139f, 0.624097884f},
-std::array<float,2>{0.300139338f, 0.336371154f},
-std::array<float,2>{0.844710886f, 0.525600672f},
-std::array<float,2>{0.719377041f, 0.15465571f},
-std::array<float,2>{0.0549834073f, 0.802440763f},
-std::array<float,2>{0.231664419f, 0.0233966708f},
-std::array<float,2>{0.622561514f, 0.971554518f},
-std::array<float,2>{0.978154123f, 0.494589657f},
-std::array<float,2>{0.489783138f, 0.68490696f},
-std::array<float,2>{0.141803697f, 0.293142319f},
-std::array<float,2>{0.543595612f, 0.569776237f},
-std::array<float,2>{0.903545976f, 0.249976277f},
-std::array<float,2>{0.420286298f, 0.814225674f},
-std::array<float,2>{0.362103373f, 0.108752407f},
-std::array<float,2>{0.785997808f, 0.905523241f},
-std::array<float,2>{0.680005312f, 0.399556547f},
-std::array<float,2>{0.101039968f, 0.739549637f},
-std::array<float,2>{0.437681794f, 0.461423248f},
-std::array<float,2>{0.939197838f, 0.647028565f},
-std::array<float,2>{0.586472094f, 0.0370255634f},
-std::array<float,2>{0.210903496f, 0.937552154f},
-std::array<float,2>{0.0211505368f, 0.18194364f},
-std::array<float,2>{0.708183408f, 0.775369048f},
-std::array<float,2>{0.818563759f, 0.362756789f},
-std::array<float,2>{0.270550936f, 0.531659901f},
-std::array<float,2>{0.0518201292f, 0.27041924f},
-std::array<float,2>{0.730493188f, 0.605051756f},
-std::array<float,2>{0.852685928f, 0.191452578f},
-std::array<float,2>{0.304952115f, 0.848455787f},
-std::array<float,2>{0.494229734f, 0.0914058462f},
-std::array<float,2>{0.976416171f, 0.921149313f},
-std::array<float,2>{0.611441135f, 0.408836484f},
-std::array<float,2>{0.220965922f, 0.687830448f},
-std::array<float,2>{0.317235291f, 0.478333861f},
-std::array<float,2>{0.77235347f, 0.66215837f},
-std::array<float,2>{0.638146102f, 0.00774271972f},
-std::array<float,2>{0.0649386048f, 0.994604886f},
-std::array<float,2>{0.178573862f, 0.126817852f},
-std::array<float,2>{0.506126881f, 0.793907583f},
-std::array<float,2>{0.934985936f, 0.323829263f},
-std::array<float,2>{0.400897294f, 0.514739275f},
-std::array<float,2>{0.21861805f, 0.384469807f},
-std::array<float,2>{0.579878688f, 0.721441627f},
-std::array<float,2>{0.946334898f, 0.115517899f},
-std::array<float,2>{0.452202767f, 0.878400564f},
-std::array<float,2>{0.273705393f, 0.219605327f},
-std::array<float,2>{0.826224506f, 0.834773183f},
-std::array<float,2>{0.714488924f, 0.31156984f},
-std::array<float,2>{0.0248079598f, 0.59314549f},
-std::array<float,2>{0.408196151f, 0.345758647f},
-std::array<float,2>{0.895331442f, 0.555977285f},
-std::array<float,2>{0.535308301f, 0.16389738f},
-std::array<float,2>{0.152547717f, 0.754091859f},
-std::array<float,2>{0.106231391f, 0.0605162606f},
-std::array<float,2>{0.673940539f, 0.965985775f},
-std::array<float,2>{0.796583354f, 0.439914078f},
-std::array<float,2>{0.374492198f, 0.62594223f},
-std::array<float,2>{0.0903980434f, 0.467612386f},
-std::array<float,2>{0.650097013f, 0.641247392f},
-std::array<float,2>{0.761046052f, 0.0348893702f},
-std::array<float,2>{0.336057395f, 0.944723666f},
-std::array<float,2>{0.377280831f, 0.187332153f},
-std::array<float,2>{0.917850912f, 0.781012237f},
-std::array<float,2>{0.517122328f, 0.365169764f},
-std::array<float,2>{0.159351289f, 0.536026299f},
-std::array<float,2>{0.281730384f, 0.291985631f},
-std::array<float,2>{0.862185359f, 0.562897861f},
-std::array<float,2>{0.74252677f, 0.244397849f},
-std::array<float,2>{0.0397426523f, 0.816420853f},
-std::array<float,2>{0.235546872f, 0.10185127f},
-std::array<float,2>{0.606735229f, 0.898871064f},
-std::array<float,2>{0.989300668f, 0.403322965f},
-std::array<float,2>{0.482226253f, 0.734662473f},
-std::array<float,2>{0.127852455f, 0.340254992f},
-std::array<float,2>{0.556632221f, 0.528615594f},
-std::array<float,2>{0.882813394f, 0.150437862f},
-std::array<float,2>{0.433904409f, 0.79908371f},
-std::array<float,2>{0.350621104f, 0.0175244156f},
-std::array<float,2>{0.809195995f, 0.974125862f},
-std::array<float,2>{0.668821216f, 0.499260992f},
-std::array<float,2>{0.120994367f, 0.67998451f},
-std::array<float,2>{0.462236375f, 0.433054805f},
-std::array<float,2>{0.967167497f, 0.713321686f},
-std::array<float,2>{0.573209584f, 0.06350106f},
-std::array<float,2>{0.194982395f, 0.935288906f},
-std::array<float,2>{0.010877097f, 0.21754615f},
-std::array<float,2>{0.689822495f, 0.867134988f},
-std::array<float,2>{0.832051754f, 0.260371625f},
-std::array<float,2>{0.25422585f, 0.618825197f},
-std::array<float,2>{0.110649131f, 0.369084746f},
-std::array<float,2>{0.65986377f, 0.545749247f},
-std::array<float,2>{0.801161647f, 0.17557314f},
-std::array<float,2>{0.355957478f, 0.772455573f},
-std::array<float,2>{0.42390272f, 0.0428158566f},
-std::array<float,2>{0.881990373f, 0.946113229f},
-std::array<float,2>{0.552280068f, 0.455168009f},
-std::array<float,2>{0.138875514f, 0.656117499f},
-std::array<float,2>{0.259408951f, 0.396321625f},
-std::array<float,2>{0.840860903f, 0.744111359f},
-std::array<float,2>{0.702115655f, 0.0956628695f},
-std::array<float,2>{0.00409222534f, 0.895665646f},
-std::array<float,2>{0.202150896f, 0.238911033f},
-std::array<float,2>{0.564650059f, 0.823129475f},
-std::array<float,2>{0.953759372f, 0.281533718f},
-std::array<float,2>{0.455207855f, 0.573387206f},
-std::array<float,2>{0.164894447f, 0.487457663f},
-std::array<float,2>{0.526436806f, 0.675836802f},
-std::array<float,2>{0.907750785f, 0.0242584217f},
-std::array<float,2>{0.38682285f, 0.978311896f},
-std::array<float,2>{0.33491233f, 0.142669901f},
-std::array<float,2>{0.755773246f, 0.807256103f},
-std::array<float,2>{0.647008657f, 0.33040455f},
-std::array<float,2>{0.0822836459f, 0.515890956f},
-std::array<float,2>{0.475236505f, 0.257649064f},
-std::array<float,2>{0.994030237f, 0.614221096f},
-std::array<float,2>{0.597734451f, 0.203646258f},
-std::array<float,2>{0.249750674f, 0.867230535f},
-std::array<float,2>{0.0319464244f, 0.0747640803f},
-std::array<float,2>{0.738443136f, 0.927064359f},
-std::array<float,2>{0.868059933f, 0.427472979f},
-std::array<float,2>{0.289427906f, 0.704861045f},
-std::array<float,2>{0.0167230833f, 0.417044312f},
-std::array<float,2>{0.704740942f, 0.700155139f},
-std::array<float,2>{0.812613904f, 0.0798845142f},
-std::array<float,2>{0.265826643f, 0.910907209f},
-std::array<float,2>{0.444940388f, 0.202473238f},
-std::array<float,2>{0.943378568f, 0.855207026f},
-std::array<float,2>{0.590762019f, 0.274714261f},
-std::array<float,2>{0.203598484f, 0.596363842f},
-std::array<float,2>{0.36521247f, 0.319643885f},
-std::array<float,2>{0.78220439f, 0.507653832f},
-std::array<float,2>{0.683596373f, 0.133553863f},
-std::array<float,2>{0.0941951349f, 0.781904578f},
-std::array<float,2>{0.14580512f, 0.0101026017f},
-std::array<float,2>{0.539851904f, 0.984507859f},
-std::array<float,2>{0.898676813f, 0.470541477f},
-std::array<float,2>{0.417658001f, 0.66996783f},
-std::array<float,2>{0.228177845f, 0.300525993f},
-std::array<float,2>{0.619396865f, 0.580047846f},
-std::array<float,2>{0.983963549f, 0.228816539f},
-std::array<float,2>{0.48579061f, 0.836681902f},
-std::array<float,2>{0.304402083f, 0.121772952f},
-std::array<float,2>{0.849605322f, 0.885018885f},
-std::array<float,2>{0.723653376f, 0.380358338f},
-std::array<float,2>{0.0598221533f, 0.733709931f},
-std::array<float,2>{0.397177696f, 0.452840537f},
-std::array<float,2>{0.924126863f, 0.640101373f},
-std::array<float,2>{0.512650788f, 0.0477879606f},
-std::array<float,2>{0.187267631f, 0.958566606f},
-std::array<float,2>{0.0744541213f, 0.170867294f},
-std::array<float,2>{0.626062036f, 0.765129924f},
-std::array<float,2>{0.776946306f, 0.358749509f},
-std::array<float,2>{0.321436703f, 0.554441512f},
-std::array<float,2>{0.0669807345f, 0.285957873f},
-std::array<float,2>{0.633347571f, 0.574857533f},
-std::array<float,2>{0.769328773f, 0.234566376f},
-std::array<float,2>{0.315287769f, 0.824281514f},
-std::array<float,2>{0.404905349f, 0.0991924256f},
-std::array<float,2>{0.932465076f, 0.893670917f},
-std::array<float,2>{0.500441194f, 0.393178105f},
-std::array<float,2>{0.175346434f, 0.748734891f},
-std::array<float,2>{0.310675859f, 0.45951423f},
-std::array<float,2>{0.856852889f, 0.649908185f},
-std::array<float,2>{0.730388582f, 0.0457429029f},
-std::array<float,2>{0.046976652f, 0.951458871f},
-std::array<float,2>{0.225547269f, 0.175998762f},
-std::array<float,2>{0.613985717f, 0.767092288f},
-std::array<float,2>{0.972025394f, 0.374408841f},
-std::array<float,2>{0.499874592f, 0.540021241f},
-std::array<float,2>{0.148446143f, 0.425656259f},
-std::array<float,2>{0.53272748f, 0.708029151f},
-std::array<float,2>{0.89449954f, 0.0720010474f},
-std::array<float,2>{0.41270262f, 0.925504088f},
-std::array<float,2>{0.368939668f, 0.209555477f},
-std::array<float,2>{0.790910304f, 0.872588277f},
-std::array<float,2>{0.678890288f, 0.251973152f},
-std::array<float,2>{0.105093889f, 0.610852122f},
-std::array<float,2>{0.445394874f, 0.332266241f},
-std::array<float,2>{0.952955067f, 0.520294428f},
-std::array<float,2>{0.584387481f, 0.147438973f},
-std::array<float,2>{0.212495565f, 0.809865415f},
-std::array<float,2>{0.0298021641f, 0.0299814623f},
-std::array<float,2>{0.717709422f, 0.980551958f},
-std::array<float,2>{0.822125673f, 0.488658875f},
-std::array<float,2>{0.278479487f, 0.674419463f},
-std::array<float,2>{0.0449226201f, 0.474653393f},
-std::array<float,2>{0.746900797f, 0.664514422f},
-std::array<float,2>{0.864601374f, 0.0126057435f},
-std::array<float,2>{0.286547452f, 0.98914355f},
-std::array<float,2>{0.476964772f, 0.140003845f},
-std::array<float,2>{0.98750788f, 0.787300289f},
-std::array<float,2>{0.603092849f, 0.313918978f},
-std::array<float,2>{0.239630744f, 0.501689732f},
-std::array<float,2>{0.340764821f, 0.280908227f},
-std::array<float,2>{0.762990654f, 0.599565744f},
-std::array<float,2>{0.652503312f, 0.195825547f},
-std::array<float,2>{0.0871083885f, 0.857041776f},
-std::array<float,2>{0.160341576f, 0.0853321254f},
-std::array<float,2>{0.521252155f, 0.90827316f},
-std::array<float,2>{0.919132233f, 0.420804441f},
-std::array<float,2>{0.381698489f, 0.697350502f},
-std::array<float,2>{0.190042153f, 0.354726911f},
-std::array<float,2>{0.575192869f, 0.549107313f},
-std::array<float,2>{0.96434927f, 0.166344628f},
-std::array<float,2>{0.467310548f, 0.758782625f},
-std::array<float,2>{0.252083361f, 0.0513732769f},
-std::array<float,2>{0.830881298f, 0.955096126f},
-std::array<float,2>{0.695289433f, 0.448524743f},
-std::array<float,2>{0.0125808958f, 0.633311927f},
-std::array<float,2>{0.430593133f, 0.378355443f},
-std::array<float,2>{0.889817297f, 0.729132473f},
-std::array<float,2>{0.560068786f, 0.120144755f},
-std::array<float,2>{0.131486684f, 0.889367104f},
-std::array<float,2>{0.124461271f, 0.234088778f},
-std::array<float,2>{0.664291978f, 0.840271831f},
-std::array<float,2>{0.8067801f, 0.304502666f},
-std::array<float,2>{0.345909983f, 0.584693789f},
-std::array<float,2>{0.00321961241f, 0.325838208f},
-std::array<float,2>{0.697078824f, 0.508789837f},
-std::array<float,2>{0.83928138f, 0.130253062f},
-std::array<float,2>{0.265315741f, 0.790792346f},
-std::array<float,2>{0.460910887f, 0.00107776711f},
-std::array<float,2>{0.96026665f, 0.998478532f},
-std::array<float,2>{0.569132268f, 0.482473284f},
-std::array<float,2>{0.198075294f, 0.656580806f},
-std::array<float,2>{0.352901906f, 0.410730958f},
-std::array<float,2>{0.799150169f, 0.692723513f},
-std::array<float,2>{0.663371444f, 0.0889322385f},
-std::array<float,2>{0.115266666f, 0.916733861f},
-std::array<float,2>{0.136048973f, 0.187713757f},
-std::array<float,2>{0.548512757f, 0.845743537f},
-std::array<float,2>{0.878791094f, 0.266209573f},
-std::array<float,2>{0.42777729f, 0.606818795f},
-std::array<float,2>{0.243925393f, 0.442864239f},
-std::array<float,2>{0.597420335f, 0.631092489f},
-std::array<float,2>{0.99920392f, 0.0547238104f},
-std::array<float,2>{0.470122337f, 0.963667989f},
-std::array<float,2>{0.294925779f, 0.159607276f},
-std::array<float,2>{0.872010827f, 0.750923157f},
-std::array<float,2>{0.735939443f, 0.349114031f},
-std::array<float,2>{0.0372037292f, 0.561255932f},
-std::array<float,2>{0.384224683f, 0.30596298f},
-std::array<float,2>{0.912028611f, 0.586487412f},
-std::array<float,2>{0.529347479f, 0.223239854f},
-std::array<float,2>{0.169220567f, 0.830186069f},
-std::array<float,2>{0.080333218f, 0.110716894f},
-std::array<float,2>{0.641574979f, 0.880645216f},
-std::array<float,2>{0.752613604f, 0.388108969f},
-std::array<float,2>{0.330004454f, 0.725914598f},
-std::array<float,2>{0.0992031544f, 0.401172131f},
-std::array<float,2>{0.682744861f, 0.742031217f},
-std::array<float,2>{0.78829813f, 0.107195295f},
-std::array<float,2>{0.36056003f, 0.903036296f},
-std::array<float,2>{0.419035316f, 0.24760288f},
-std::array<float,2>{0.904706717f, 0.815678418f},
-std::array<float,2>{0.545854032f, 0.296471328f},
-std::array<float,2>{0.14396055f, 0.566925049f},
-std::array<float,2>{0.272824764f, 0.359879285f},
-std::array<float,2>{0.817047298f, 0.533901572f},
-std::array<float,2>{0.710649014f, 0.180810615f},
-std::array<float,2>{0.0222495031f, 0.777319729f},
-std::array<float,2>{0.208638623f, 0.0378678441f},
-std::array<float,2>{0.589410961f, 0.941212535f},
-std::array<float,2>{0.940928221f, 0.464592636f},
-std::array<float,2>{0.440946043f, 0.645773232f},
-std::array<float,2>{0.18207708f, 0.262898266f},
-std::array<float,2>{0.508567393f, 0.621506155f},
-std::array<float,2>{0.927713633f, 0.214763388f},
-std::array<float,2>{0.390875101f, 0.86144346f},
-std::array<float,2>{0.326488316f, 0.0682540834f},
-std::array<float,2>{0.77760148f, 0.930700719f},
-std::array<float,2>{0.630016208f, 0.43485716f},
-std::array<float,2>{0.072389923f, 0.717807829f},
-std::array<float,2>{0.490244806f, 0.49241522f},
-std::array<float,2>{0.978835166f, 0.686636209f},
-std::array<float,2>{0.62431258f, 0.0199786648f},
-std::array<float,2>{0.232989222f, 0.969922006f},
-std::array<float,2>{0.0584075972f, 0.152449876f},
-std::array<float,2>{0.721687973f, 0.803628922f},
-std::array<float,2>{0.847322822f, 0.338141352f},
-std::array<float,2>{0.297599733f, 0.525261104f},
-std::array<float,2>{0.0402481109f, 0.290414602f},
-std::array<float,2>{0.744094133f, 0.566337109f},
-std::array<float,2>{0.862700284f, 0.242210642f},
-std::array<float,2>{0.282291621f, 0.820022523f},
-std::array<float,2>{0.480728716f, 0.104288459f},
-std::array<float,2>{0.988953948f, 0.901113987f},
-std::array<float,2>{0.605978608f, 0.406041771f},
-std::array<float,2>{0.234433338f, 0.73658514f},
-std::array<float,2>{0.3372114f, 0.466792405f},
-std::array<float,2>{0.759858429f, 0.643249512f},
-std::array<float,2>{0.649215341f, 0.0325937346f},
-std::array<float,2>{0.0910806954f, 0.941969693f},
-std::array<float,2>{0.158651516f, 0.1849574f},
-std::array<float,2>{0.515817404f, 0.778624415f},
-std::array<float,2>{0.916472137f, 0.36635372f},
-std::array<float,2>{0.378681302f, 0.53774637f},
-std::array<float,2>{0.19430171f, 0.431009799f},
-std::array<float,2>{0.573655725f, 0.711552262f},
-std::array<float,2>{0.968741715f, 0.0662931204f},
-std::array<float,2>{0.461618394f, 0.937328637f},
-std::array<float,2>{0.25580734f, 0.216261759f},
-std::array<float,2>{0.833362341f, 0.86328572f},
-std::array<float,2>{0.690942168f, 0.259366602f},
-std::array<float,2>{0.00980123878f, 0.619624496f},
-std::array<float,2>{0.434915781f, 0.342445523f},
-std::array<float,2>{0.88448143f, 0.52994734f},
-std::array<float,2>{0.555515051f, 0.148638293f},
-std::array<float,2>{0.12793754f, 0.79707706f},
-std::array<float,2>{0.11981073f, 0.0186431836f},
-std::array<float,2>{0.669292927f, 0.975412965f},
-std::array<float,2>{0.809899688f, 0.496874124f},
-std::array<float,2>{0.349647045f, 0.682216883f},
-std::array<float,2>{0.0660945848f, 0.478996277f},
-std::array<float,2>{0.63716042f, 0.661858499f},
-std::array<float,2>{0.77329421f, 0.00391630875f},
-std::array<float,2>{0.317895979f, 0.993300319f},
-std::array<float,2>{0.401775271f, 0.128068537f},
-std::array<float,2>{0.934373975f, 0.795321107f},
-std::array<float,2>{0.507582545f, 0.32092768f},
-std::array<float,2>{0.179384485f, 0.512059331f},
-std::array<float,2>{0.306499988f, 0.273401171f},
-std::array<float,2>{0.851900935f, 0.603284776f},
-std::array<float,2>{0.73154819f, 0.194237664f},
-std::array<float,2>{0.0508086197f, 0.851033986f},
-std::array<float,2>{0.221695468f, 0.0919508189f},
-std::array<float,2>{0.61277914f, 0.91924572f},
-std::array<float,2>{0.974760234f, 0.406911671f},
-std::array<float,2>{0.496049285f, 0.69044596f},
-std::array<float,2>{0.154077575f, 0.34381479f},
-std::array<float,2>{0.536963165f, 0.556849122f},
-std::array<float,2>{0.896244228f, 0.161170945f},
-std::array<float,2>{0.406647533f, 0.756904423f},
-std::array<float,2>{0.373206556f, 0.0611070581f},
-std::array<float,2>{0.795239925f, 0.967420816f},
-std::array<float,2>{0.675240397f, 0.437503606f},
-std::array<float,2>{0.106471665f, 0.628050685f},
-std::array<float,2>{0.451266915f, 0.386500239f},
-std::array<float,2>{0.945887625f, 0.720447123f},
-std::array<float,2>{0.578407943f, 0.114707589f},
-std::array<float,2>{0.217118785f, 0.875250459f},
-std::array<float,2>{0.0243820474f, 0.222310513f},
-std::array<float,2>{0.713460803f, 0.833738506f},
-std::array<float,2>{0.827454865f, 0.309178472f},
-std::array<float,2>{0.275370985f, 0.591638625f},
-std::array<float,2>{0.0953958929f, 0.317477942f},
-std::array<float,2>{0.684573472f, 0.505848229f},
-std::array<float,2>{0.782773495f, 0.134966075f},
-std::array<float,2>{0.364074886f, 0.784689724f},
-std::array<float,2>{0.416727483f, 0.00822920725f},
-std::array<float,2>{0.899623632f, 0.987029731f},
-std::array<float,2>{0.540077031f, 0.471055418f},
-std::array<float,2>{0.145015866f, 0.668415546f},
-std::array<float,2>{0.266750842f, 0.415700644f},
-std::array<float,2>{0.81381011f, 0.701768458f},
-std::array<float,2>{0.704011321f, 0.0815363675f},
-std::array<float,2>{0.0164594427f, 0.913692057f},
-std::array<float,2>{0.205064729f, 0.200247973f},
-std::array<float,2>{0.591047049f, 0.852002203f},
-std::array<float,2>{0.944750488f, 0.276049852f},
-std::array<float,2>{0.444102108f, 0.595335841f},
-std::array<float,2>{0.186030522f, 0.449469864f},
-std::array<float,2>{0.513022721f, 0.637664318f},
-std::array<float,2>{0.925105035f, 0.0498398654f},
-std::array<float,2>{0.398409277f, 0.959610403f},
-std::array<float,2>{0.320348322f, 0.169614658f},
-std::array<float,2>{0.776054263f, 0.763338506f},
-std::array<float,2>{0.625738561f, 0.356817693f},
-std::array<float,2>{0.0759969503f, 0.551989734f},
-std::array<float,2>{0.485271662f, 0.298690677f},
-std::array<float,2>{0.982685804f, 0.581743419f},
-std::array<float,2>{0.620801687f, 0.227186203f},
-std::array<float,2>{0.227448732f, 0.838777125f},
-std::array<float,2>{0.0594672933f, 0.124642126f},
-std::array<float,2>{0.723131657f, 0.883372903f},
-std::array<float,2>{0.84790045f, 0.382297903f},
-std::array<float,2>{0.303211182f, 0.731684089f},
-std::array<float,2>{0.00567097683f, 0.397067934f},
-std::array<float,2>{0.702180028f, 0.745603442f},
-std::array<float,2>{0.840488911f, 0.0975551158f},
-std::array<float,2>{0.258661717f, 0.897372961f},
-std::array<float,2>{0.456906855f, 0.241362005f},
-std::array<float,2>{0.954772055f, 0.8213709f},
-std::array<float,2>{0.565460443f, 0.283975452f},
-std::array<float,2>{0.201437905f, 0.571462452f},
-std::array<float,2>{0.356831312f, 0.370885789f},
-std::array<float,2>{0.801789999f, 0.544903755f},
-std::array<float,2>{0.658760607f, 0.173069313f},
-std::array<float,2>{0.109856918f, 0.770536125f},
-std::array<float,2>{0.140331373f, 0.0395808965f},
-std::array<float,2>{0.551165521f, 0.94870317f},
-std::array<float,2>{0.881628573f, 0.454101086f},
-std::array<float,2>{0.42552793f, 0.654064357f},
-std::array<float,2>{0.248386115f, 0.255443186f},
-std::array<float,2>{0.59942466f, 0.616263807f},
-std::array<float,2>{0.99271971f, 0.206775978f},
-std::array<float,2>{0.476159394f, 0.869868159f},
-std::array<float,2>{0.290054291f, 0.0768177137f},
-std::array<float,2>{0.868317187f, 0.927918136f},
-std::array<float,2>{0.73979634f, 0.428477108f},
-std::array<float,2>{0.0330447257f, 0.706603765f},
-std::array<float,2>{0.388550103f, 0.48448056f},
-std::array<float,2>{0.906723797f, 0.678571165f},
-std::array<float,2>{0.52632767f, 0.0261141378f},
-std::array<float,2>{0.165155336f, 0.980269551f},
-std::array<float,2>{0.0832734779f, 0.141784996f},
-std::array<float,2>{0.648372829f, 0.805588782f},
-std::array<float,2>{0.754085004f, 0.329603434f},
-std::array<float,2>{0.335774899f, 0.519430757f},
-std::array<float,2>{0.0862035975f, 0.279214323f},
-std::array<float,2>{0.653888226f, 0.600675642f},
-std::array<float,2>{0.762601495f, 0.198028296f},
-std::array<float,2>{0.340889961f, 0.857902348f},
-std::array<float,2>{0.38236469f, 0.0828133374f},
-std::array<float,2>{0.918238282f, 0.907186568f},
-std::array<float,2>{0.51954031f, 0.419740409f},
-std::array<float,2>{0.161601156f, 0.695734978f},
-std::array<float,2>{0.285356492f, 0.474347532f},
-std::array<float,2>{0.864154994f, 0.666668892f},
-std::array<float,2>{0.747789681f, 0.013975502f},
-std::array<float,2>{0.0465009212f, 0.991063058f},
-std::array<float,2>{0.238630861f, 0.138189018f},
-std::array<float,2>{0.601689637f, 0.785702169f},
-std::array<float,2>{0.987200141f, 0.314901382f},
-std::array<float,2>{0.477942795f, 0.50325954f},
-std::array<float,2>{0.13269195f, 0.376597077f},
-std::array<float,2>{0.559094131f, 0.727208734f},
-std::array<float,2>{0.889330804f, 0.118670277f},
-std::array<float,2>{0.431305736f, 0.888291001f},
-std::array<float,2>{0.347541958f, 0.230536744f},
-std::array<float,2>{0.808235347f, 0.841930628f},
-std::array<float,2>{0.665153444f, 0.301726341f},
-std::array<float,2>{0.12372236f, 0.582232356f},
-std::array<float,2>{0.46783933f, 0.352805346f},
-std::array<float,2>{0.962929964f, 0.546985447f},
-std::array<float,2>{0.576161206f, 0.164413676f},
-std::array<float,2>{0.190577716f, 0.760863304f},
-std::array<float,2>{0.0129933106f, 0.0533913672f},
-std::array<float,2>{0.693600059f, 0.954961538f},
-std::array<float,2>{0.831144571f, 0.445793062f},
-std::array<float,2>{0.253589749f, 0.634964705f},
-std::array<float,2>{0.0481426008f, 0.458394051f},
-std::array<float,2>{0.729215086f, 0.652251959f},
-std::array<float,2>{0.856140554f, 0.044442419f},
-std::array<float,2>{0.311653733f, 0.94930011f},
-std::array<float,2>{0.498133749f, 0.178615347f},
-std::array<float,2>{0.97129637f, 0.76897037f},
-std::array<float,2>{0.615033746f, 0.371602982f},
-std::array<float,2>{0.226551607f, 0.54232347f},
-std::array<float,2>{0.315865964f, 0.288445443f},
-std::array<float,2>{0.768292606f, 0.576945066f},
-std::array<float,2>{0.634550095f, 0.238210037f},
-std::array<float,2>{0.067782402f, 0.827352226f},
-std::array<float,2>{0.174633101f, 0.100479409f},
-std::array<float,2>{0.501342654f, 0.89163661f},
-std::array<float,2>{0.932907462f, 0.392423928f},
-std::array<float,2>{0.405499727f, 0.747970343f},
-std::array<float,2>{0.211543679f, 0.334761739f},
-std::array<float,2>{0.585022867f, 0.522240877f},
-std::array<float,2>{0.952057064f, 0.145529464f},
-std::array<float,2>{0.446975648f, 0.812419057f},
-std::array<float,2>{0.278002381f, 0.0291953813f},
-std::array<float,2>{0.820490241f, 0.984361112f},
-std::array<float,2>{0.71873486f, 0.491379917f},
-std::array<float,2>{0.0305622667f, 0.672067463f},
-std::array<float,2>{0.413289726f, 0.422157437f},
-std::array<float,2>{0.893488109f, 0.710738838f},
-std::array<float,2>{0.531580925f, 0.0722860619f},
-std::array<float,2>{0.149814993f, 0.922246337f},
-std::array<float,2>{0.103891701f, 0.208745882f},
-std::array<float,2>{0.67798847f, 0.874492228f},
-std::array<float,2>{0.789578736f, 0.25062868f},
-std::array<float,2>{0.367235959f, 0.613280058f},
-std::array<float,2>{0.0233503673f, 0.361597389f},
-std::array<float,2>{0.709240556f, 0.533133805f},
-std::array<float,2>{0.817869961f, 0.182654753f},
-std::array<float,2>{0.27221337f, 0.773557961f},
-std::array<float,2>{0.440153033f, 0.0361215398f},
-std::array<float,2>{0.940237224f, 0.939194977f},
-std::array<float,2>{0.58825469f, 0.462676734f},
-std::array<float,2>{0.207102373f, 0.64783138f},
-std::array<float,2>{0.35954982f, 0.399032742f},
-std::array<float,2>{0.787518203f, 0.738798261f},
-std::array<float,2>{0.682032824f, 0.108136453f},
-std::array<float,2>{0.0985835269f, 0.905072391f},
-std::array<float,2>{0.143308952f, 0.248358518f},
-std::array<float,2>{0.546833158f, 0.813341618f},
-std::array<float,2>{0.905332208f, 0.293972671f},
-std::array<float,2>{0.418695003f, 0.568945408f},
-std::array<float,2>{0.233406335f, 0.495748371f},
-std::array<float,2>{0.623392284f, 0.684512079f},
-std::array<float,2>{0.979609251f, 0.0224572346f},
-std::array<float,2>{0.49144423f, 0.972056806f},
-std::array<float,2>{0.298634231f, 0.156084493f},
-std::array<float,2>{0.846048236f, 0.801643133f},
-std::array<float,2>{0.720939875f, 0.337410688f},
-std::array<float,2>{0.0568322614f, 0.526521266f},
-std::array<float,2>{0.39171809f, 0.264992654f},
-std::array<float,2>{0.926188648f, 0.623099566f},
-std::array<float,2>{0.508895338f, 0.212612092f},
-std::array<float,2>{0.182821602f, 0.860998213f},
-std::array<float,2>{0.0732730478f, 0.068831332f},
-std::array<float,2>{0.62921989f, 0.932703376f},
-std::array<float,2>{0.778700829f, 0.436239868f},
-std::array<float,2>{0.327804178f, 0.715288281f},
-std::array<float,2>{0.116983071f, 0.413926035f},
-std::array<float,2>{0.662539661f, 0.694742441f},
-std::array<float,2>{0.800735831f, 0.0868719444f},
-std::array<float,2>{0.352268606f, 0.914946556f},
-std::array<float,2>{0.42918843f, 0.189888403f},
-std::array<float,2>{0.877838492f, 0.84405309f},
-std::array<float,2>{0.547253549f, 0.267970324f},
-std::array<float,2>{0.13571313f, 0.608334482f},
-std::array<float,2>{0.264621705f, 0.327567369f},
-std::array<float,2>{0.838323712f, 0.51043433f},
-std::array<float,2>{0.695486903f, 0.132660389f},
-std::array<float,2>{0.0023727417f, 0.792616129f},
-std::array<float,2>{0.198815405f, 0.00205168384f},
-std::array<float,2>{0.569664538f, 0.997020304f},
-std::array<float,2>{0.959517837f, 0.481542796f},
-std::array<float,2>{0.459632218f, 0.659017861f},
-std::array<float,2>{0.168670535f, 0.308249176f},
-std::array<float,2>{0.530674577f, 0.589788079f},
-std::array<float,2>{0.911025882f, 0.226462021f},
-std::array<float,2>{0.383326828f, 0.828245103f},
-std::array<float,2>{0.328206837f, 0.111835621f},
-std::array<float,2>{0.753881514f, 0.882675648f},
-std::array<float,2>{0.64239794f, 0.390213937f},
-std::array<float,2>{0.081545569f, 0.723543763f},
-std::array<float,2>{0.469488442f, 0.444133222f},
-std::array<float,2>{0.998082817f, 0.629668057f},
-std::array<float,2>{0.596525609f, 0.0571345128f},
-std::array<float,2>{0.242788821f, 0.962089777f},
-std::array<float,2>{0.0390347205f, 0.157087147f},
-std::array<float,2>{0.734473944f, 0.753555536f},
-std::array<float,2>{0.872356415f, 0.350248367f},
-std::array<float,2>{0.296169698f, 0.560112715f},
-std::array<float,2>{0.0095665371f, 0.260918438f},
-std::array<float,2>{0.689339459f, 0.617464125f},
-std::array<float,2>{0.834701896f, 0.218090519f},
-std::array<float,2>{0.25630489f, 0.865276575f},
-std::array<float,2>{0.463980496f, 0.0630811602f},
-std::array<float,2>{0.966682673f, 0.934521198f},
-std::array<float,2>{0.572134197f, 0.431920111f},
-std::array<float,2>{0.193067446f, 0.714530051f},
-std::array<float,2>{0.348915339f, 0.498841375f},
-std::array<float,2>{0.810673118f, 0.681270361f},
-std::array<float,2>{0.670731187f, 0.0160016064f},
-std::array<float,2>{0.118911035f, 0.973174572f},
-std::array<float,2>{0.126206368f, 0.15197964f},
-std::array<float,2>{0.558096945f, 0.799971044f},
-std::array<float,2>{0.886229873f, 0.341052234f},
-std::array<float,2>{0.436781973f, 0.528038144f},
-std::array<float,2>{0.237580329f, 0.402464777f},
-std::array<float,2>{0.609147906f, 0.735658467f},
-std::array<float,2>{0.990737021f, 0.102658913f},
-std::array<float,2>{0.483913481f, 0.899471283f},
-std::array<float,2>{0.284706891f, 0.245422065f},
-std::array<float,2>{0.860521138f, 0.817669988f},
-std::array<float,2>{0.74469471f, 0.292296618f},
-std::array<float,2>{0.0419675708f, 0.563962758f},
-std::array<float,2>{0.376405537f, 0.363490283f},
-std::array<float,2>{0.915027618f, 0.536252856f},
-std::array<float,2>{0.519373894f, 0.186111718f},
-std::array<float,2>{0.157838255f, 0.780005991f},
-std::array<float,2>{0.0935970023f, 0.0336018689f},
-std::array<float,2>{0.652106285f, 0.943638742f},
-std::array<float,2>{0.759471595f, 0.467904747f},
-std::array<float,2>{0.338060379f, 0.641612351f},
-std::array<float,2>{0.108659573f, 0.441357493f},
-std::array<float,2>{0.673180521f, 0.626394868f},
-std::array<float,2>{0.794743717f, 0.0593882576f},
-std::array<float,2>{0.37217322f, 0.965207696f},
-std::array<float,2>{0.409700096f, 0.16213356f},
-std::array<float,2>{0.897293985f, 0.755771756f},
-std::array<float,2>{0.537151814f, 0.346983016f},
-std::array<float,2>{0.154621094f, 0.555372298f},
-std::array<float,2>{0.276680052f, 0.311481774f},
-std::array<float,2>{0.824238837f, 0.592469096f},
-std::array<float,2>{0.712537885f, 0.220137805f},
-std::array<float,2>{0.0266773365f, 0.835622549f},
-std::array<float,2>{0.215198636f, 0.117168576f},
-std::array<float,2>{0.581528485f, 0.87743634f},
-std::array<float,2>{0.94797039f, 0.38303414f},
-std::array<float,2>{0.450438708f, 0.722535729f},
-std::array<float,2>{0.176483482f, 0.322505713f},
-std::array<float,2>{0.505551875f, 0.514258385f},
-std::array<float,2>{0.936661601f, 0.125569671f},
-std::array<float,2>{0.39923051f, 0.794733942f},
-std::array<float,2>{0.319311976f, 0.00621770183f},
-std::array<float,2>{0.771016419f, 0.995510757f},
-std::array<float,2>{0.640579998f, 0.476630151f},
-std::array<float,2>{0.0628179759f, 0.663704038f},
-std::array<float,2>{0.492619812f, 0.410000831f},
-std::array<float,2>{0.972666383f, 0.689289153f},
-std::array<float,2>{0.610670745f, 0.09016487f},
-std::array<float,2>{0.219908297f, 0.920620203f},
-std::array<float,2>{0.0534723476f, 0.192940384f},
-std::array<float,2>{0.73306632f, 0.849448264f},
-std::array<float,2>{0.855380952f, 0.271352261f},
-std::array<float,2>{0.307104707f, 0.603637755f},
-std::array<float,2>{0.077296555f, 0.357517034f},
-std::array<float,2>{0.628295064f, 0.553322732f},
-std::array<float,2>{0.773972392f, 0.171471894f},
-std::array<float,2>{0.322578788f, 0.763985813f},
-std::array<float,2>{0.396133423f, 0.0479236431f},
-std::array<float,2>{0.921898842f, 0.957245052f},
-std::array<float,2>{0.51555562f, 0.451855421f},
-std::array<float,2>{0.183807358f, 0.638788342f},
-std::array<float,2>{0.302158773f, 0.379332185f},
-std::array<float,2>{0.850302696f, 0.733094692f},
-std::array<float,2>{0.726500928f, 0.122378595f},
-std::array<float,2>{0.0610000566f, 0.886042535f},
-std::array<float,2>{0.229094177f, 0.229692191f},
-std::array<float,2>{0.618979216f, 0.837646604f},
-std::array<float,2>{0.981781006f, 0.299063474f},
-std::array<float,2>{0.487505436f, 0.578636289f},
-std::array<float,2>{0.148045003f, 0.468806803f},
-std::array<float,2>{0.541102111f, 0.671525121f},
-std::array<float,2>{0.900592685f, 0.0112042613f},
-std::array<float,2>{0.415503353f, 0.985931754f},
-std::array<float,2>{0.367041022f, 0.133869454f},
-std::array<float,2>{0.784684658f, 0.782846749f},
-std::array<float,2>{0.687461615f, 0.318760395f},
-std::array<float,2>{0.0957920104f, 0.506433547f},
-std::array<float,2>{0.442569673f, 0.274140745f},
-std::array<float,2>{0.943267822f, 0.597149432f},
-std::array<float,2>{0.59208715f, 0.201704323f},
-std::array<float,2>{0.20618853f, 0.854346395f},
-std::array<float,2>{0.0176331196f, 0.0784892067f},
-std::array<float,2>{0.705309868f, 0.912041426f},
-std::array<float,2>{0.815478623f, 0.416743308f},
-std::array<float,2>{0.268016487f, 0.700269222f},
-std::array<float,2>{0.0350475498f, 0.425788194f},
-std::array<float,2>{0.742093861f, 0.703971624f},
-std::array<float,2>{0.870806515f, 0.0755115151f},
-std::array<float,2>{0.291130513f, 0.92641896f},
-std::array<float,2>{0.472854674f, 0.204422057f},
-std::array<float,2>{0.995622635f, 0.868434072f},
-std::array<float,2>{0.60012418f, 0.25639835f},
-std::array<float,2>{0.247348025f, 0.615055323f},
-std::array<float,2>{0.333217174f, 0.331506997f},
-std::array<float,2>{0.756877184f, 0.516866207f},
-std::array<float,2>{0.645119071f, 0.143645301f},
-std::array<float,2>{0.0844001919f, 0.807836413f},
-std::array<float,2>{0.167434201f, 0.0250642952f},
-std::array<float,2>{0.524942696f, 0.97726661f},
-std::array<float,2>{0.910152614f, 0.486911774f},
-std::array<float,2>{0.389683276f, 0.677557111f},
-std::array<float,2>{0.19922705f, 0.282234639f},
-std::array<float,2>{0.562888205f, 0.57291609f},
-std::array<float,2>{0.956408501f, 0.240130082f},
-std::array<float,2>{0.453273833f, 0.823614538f},
-std::array<float,2>{0.261144102f, 0.0946189985f},
-std::array<float,2>{0.843123198f, 0.894648254f},
-std::array<float,2>{0.699589789f, 0.394734472f},
-std::array<float,2>{0.00775511004f, 0.742423236f},
-std::array<float,2>{0.422204822f, 0.456166387f},
-std::array<float,2>{0.879858136f, 0.655265689f},
-std::array<float,2>{0.554388404f, 0.0410917103f},
-std::array<float,2>{0.137258887f, 0.946364284f},
-std::array<float,2>{0.112146765f, 0.174361035f},
-std::array<float,2>{0.657289922f, 0.773020625f},
-std::array<float,2>{0.804490864f, 0.367535859f},
-std::array<float,2>{0.357516676f, 0.546420991f},
-std::array<float,2>{0.121279843f, 0.30290994f},
-std::array<float,2>{0.666580856f, 0.58538425f},
-std::array<float,2>{0.805141568f, 0.23251906f},
-std::array<float,2>{0.34564358f, 0.841510475f},
-std::array<float,2>{0.433538914f, 0.1193927f},
-std::array<float,2>{0.887445152f, 0.890161991f},
-std::array<float,2>{0.561619937f, 0.377672821f},
-std::array<float,2>{0.130718574f, 0.729550719f},
-std::array<float,2>{0.25143519f, 0.44739756f},
-std::array<float,2>{0.828794181f, 0.633791089f},
-std::array<float,2>{0.693189144f, 0.0518194623f},
-std::array<float,2>{0.0150959389f, 0.95663929f},
-std::array<float,2>{0.189064205f, 0.167882681f},
-std::array<float,2>{0.577906489f, 0.759094536f},
-std::array<float,2>{0.961116493f, 0.353865921f},
-std::array<float,2>{0.465356648f, 0.550530493f},
-std::array<float,2>{0.163873509f, 0.421021223f},
-std::array<float,2>{0.522842348f, 0.698663831f},
-std::array<float,2>{0.921805441f, 0.0849361718f},
-std::array<float,2>{0.380002737f, 0.909606397f},
-std::array<float,2>{0.34305644f, 0.196832567f},
-std::array<float,2>{0.765142918f, 0.856333435f},
-std::array<float,2>{0.655531704f, 0.27989465f},
-std::array<float,2>{0.0896829441f, 0.598392785f},
-std::array<float,2>{0.4795461f, 0.312633872f},
-std::array<float,2>{0.986099482f, 0.500231266f},
-std::array<float,2>{0.60424453f, 0.139516518f},
-std::array<float,2>{0.240972191f, 0.788258672f},
-std::array<float,2>{0.0432319827f, 0.012798572f},
-std::array<float,2>{0.749635696f, 0.990163565f},
-std::array<float,2>{0.866567791f, 0.476162404f},
-std::array<float,2>{0.287781954f, 0.665820301f},
-std::array<float,2>{0.0274931267f, 0.48930034f},
-std::array<float,2>{0.715708435f, 0.675462365f},
-std::array<float,2>{0.823982835f, 0.030736167f},
-std::array<float,2>{0.280023962f, 0.981755674f},
-std::array<float,2>{0.448185086f, 0.147878379f},
-std::array<float,2>{0.951030016f, 0.809255242f},
-std::array<float,2>{0.582248092f, 0.333311498f},
-std::array<float,2>{0.214089334f, 0.520611763f},
-std::array<float,2>{0.369465798f, 0.253894567f},
-std::array<float,2>{0.792746484f, 0.60984087f},
-std::array<float,2>{0.676791668f, 0.21045655f},
-std::array<float,2>{0.103232004f, 0.871956408f},
-std::array<float,2>{0.151109278f, 0.0704924241f},
-std::array<float,2>{0.534835756f, 0.924111903f},
-std::array<float,2>{0.891445518f, 0.42393142f},
-std::array<float,2>{0.410468966f, 0.707902014f},
-std::array<float,2>{0.223253161f, 0.373813212f},
-std::array<float,2>{0.616470695f, 0.540043652f},
-std::array<float,2>{0.970003843f, 0.177182019f},
-std::array<float,2>{0.497482687f, 0.766093075f},
-std::array<float,2>{0.308977216f, 0.0466013774f},
-std::array<float,2>{0.859101772f, 0.952893972f},
-std::array<float,2>{0.726931632f, 0.460601985f},
-std::array<float,2>{0.050130792f, 0.648726463f},
-std::array<float,2>{0.403142422f, 0.393998057f},
-std::array<float,2>{0.929817617f, 0.749307811f},
-std::array<float,2>{0.502168894f, 0.0977736786f},
-std::array<float,2>{0.172053888f, 0.892893076f},
-std::array<float,2>{0.0691474155f, 0.235632554f},
-std::array<float,2>{0.636295617f, 0.825957119f},
-std::array<float,2>{0.766281903f, 0.2862207f},
-std::array<float,2>{0.314147115f, 0.576170743f},
-std::array<float,2>{0.055998154f, 0.33925882f},
-std::array<float,2>{0.720407069f, 0.524062276f},
-std::array<float,2>{0.84494251f, 0.153726682f},
-std::array<float,2>{0.299014151f, 0.803787112f},
-std::array<float,2>{0.488624603f, 0.0211977754f},
-std::array<float,2>{0.977085173f, 0.969357491f},
-std::array<float,2>{0.621681094f, 0.49364391f},
-std::array<float,2>{0.231206149f, 0.686442375f},
-std::array<float,2>{0.325836629f, 0.43374446f},
-std::array<float,2>{0.779393911f, 0.717137039f},
-std::array<float,2>{0.630951583f, 0.0668618083f},
-std::array<float,2>{0.0713212565f, 0.93064487f},
-std::array<float,2>{0.180149585f, 0.213234156f},
-std::array<float,2>{0.510885119f, 0.862850845f},
-std::array<float,2>{0.929449856f, 0.262505651f},
-std::array<float,2>{0.394237995f, 0.622715712f},
-std::array<float,2>{0.209035963f, 0.463178515f},
-std::array<float,2>{0.587028384f, 0.645160317f},
-std::array<float,2>{0.937573612f, 0.0389811695f},
-std::array<float,2>{0.439324856f, 0.940256417f},
-std::array<float,2>{0.269657761f, 0.179945216f},
-std::array<float,2>{0.820131302f, 0.775770187f},
-std::array<float,2>{0.707715869f, 0.360719621f},
-std::array<float,2>{0.0202791598f, 0.534276903f},
-std::array<float,2>{0.421123356f, 0.295451581f},
-std::array<float,2>{0.902682781f, 0.567570567f},
-std::array<float,2>{0.544427156f, 0.246708229f},
-std::array<float,2>{0.14099066f, 0.81447041f},
-std::array<float,2>{0.100113757f, 0.106116615f},
-std::array<float,2>{0.681555331f, 0.903596163f},
-std::array<float,2>{0.786883175f, 0.401526719f},
-std::array<float,2>{0.363161534f, 0.740864873f},
-std::array<float,2>{0.0787561312f, 0.387552023f},
-std::array<float,2>{0.644467652f, 0.725559175f},
-std::array<float,2>{0.750909328f, 0.110261001f},
-std::array<float,2>{0.330207437f, 0.879213452f},
-std::array<float,2>{0.386627555f, 0.224565729f},
-std::array<float,2>{0.912472546f, 0.831219852f},
-std::array<float,2>{0.527372122f, 0.305015624f},
-std::array<float,2>{0.171508133f, 0.587804019f},
-std::array<float,2>{0.294349194f, 0.348456174f},
-std::array<float,2>{0.874985874f, 0.561998367f},
-std::array<float,2>{0.736585796f, 0.158874378f},
-std::array<float,2>{0.0363981836f, 0.751327276f},
-std::array<float,2>{0.245002344f, 0.0560617186f},
-std::array<float,2>{0.59390521f, 0.964519143f},
-std::array<float,2>{0.996812046f, 0.441846967f},
-std::array<float,2>{0.47155869f, 0.632511914f},
-std::array<float,2>{0.133687645f, 0.267292887f},
-std::array<float,2>{0.549918354f, 0.605560601f},
-std::array<float,2>{0.876915336f, 0.188788727f},
-std::array<float,2>{0.425928503f, 0.846717954f},
-std::array<float,2>{0.355285197f, 0.0882223099f},
-std::array<float,2>{0.797739625f, 0.917482257f},
-std::array<float,2>{0.66201067f, 0.411950469f},
-std::array<float,2>{0.113477133f, 0.691423297f},
-std::array<float,2>{0.458159655f, 0.483680427f},
-std::array<float,2>{0.957289696f, 0.657752216f},
-std::array<float,2>{0.567221582f, 0.000802581955f},
-std::array<float,2>{0.19624269f, 0.999315917f},
-std::array<float,2>{0.00168158859f, 0.128996283f},
-std::array<float,2>{0.698489487f, 0.789210677f},
-std::array<float,2>{0.836476445f, 0.324738711f},
-std::array<float,2>{0.262208253f, 0.508571684f},
-std::array<float,2>{0.00708097778f, 0.283648789f},
-std::array<float,2>{0.700194478f, 0.571933866f},
-std::array<float,2>{0.843356252f, 0.242148444f},
-std::array<float,2>{0.261265785f, 0.821819186f},
-std::array<float,2>{0.453656137f, 0.0969958156f},
-std::array<float,2>{0.956753731f, 0.896844387f},
-std::array<float,2>{0.563035667f, 0.396912217f},
-std::array<float,2>{0.200174347f, 0.745791256f},
-std::array<float,2>{0.358081073f, 0.453152061f},
-std::array<float,2>{0.804022193f, 0.653526485f},
-std::array<float,2>{0.657923043f, 0.039532382f},
-std::array<float,2>{0.111572973f, 0.948924839f},
-std::array<float,2>{0.136972517f, 0.173535332f},
-std::array<float,2>{0.553999722f, 0.771147072f},
-std::array<float,2>{0.879371285f, 0.370169997f},
-std::array<float,2>{0.422688037f, 0.543994844f},
-std::array<float,2>{0.247826129f, 0.427974939f},
-std::array<float,2>{0.599847734f, 0.706130743f},
-std::array<float,2>{0.99556303f, 0.076274164f},
-std::array<float,2>{0.473606676f, 0.928268731f},
-std::array<float,2>{0.291823298f, 0.206346691f},
-std::array<float,2>{0.870434165f, 0.869522512f},
-std::array<float,2>{0.741270244f, 0.255319387f},
-std::array<float,2>{0.0342419706f, 0.616910815f},
-std::array<float,2>{0.390484691f, 0.329475522f},
-std::array<float,2>{0.909566522f, 0.518681347f},
-std::array<float,2>{0.524843156f, 0.142345861f},
-std::array<float,2>{0.167669073f, 0.805126846f},
-std::array<float,2>{0.0848258361f, 0.0253956206f},
-std::array<float,2>{0.645002186f, 0.97957319f},
-std::array<float,2>{0.757543862f, 0.485132009f},
-std::array<float,2>{0.333822072f, 0.677781284f},
-std::array<float,2>{0.0965062082f, 0.471291006f},
-std::array<float,2>{0.686801434f, 0.668883264f},
-std::array<float,2>{0.784483373f, 0.00843188632f},
-std::array<float,2>{0.366563708f, 0.986806691f},
-std::array<float,2>{0.415892035f, 0.135580763f},
-std::array<float,2>{0.90127039f, 0.784251094f},
-std::array<float,2>{0.54161793f, 0.318295479f},
-std::array<float,2>{0.147631288f, 0.505278349f},
-std::array<float,2>{0.268547386f, 0.275827467f},
-std::array<float,2>{0.815986812f, 0.594944417f},
-std::array<float,2>{0.705873311f, 0.200974494f},
-std::array<float,2>{0.0181945525f, 0.852435112f},
-std::array<float,2>{0.206696495f, 0.0818150863f},
-std::array<float,2>{0.592625439f, 0.913204074f},
-std::array<float,2>{0.942451298f, 0.415219724f},
-std::array<float,2>{0.4432877f, 0.701400697f},
-std::array<float,2>{0.184541538f, 0.357017606f},
-std::array<float,2>{0.514717042f, 0.552253962f},
-std::array<float,2>{0.922847152f, 0.168989569f},
-std::array<float,2>{0.395840257f, 0.762761533f},
-std::array<float,2>{0.323168188f, 0.05051025f},
-std::array<float,2>{0.77348727f, 0.959173977f},
-std::array<float,2>{0.628581285f, 0.44987002f},
-std::array<float,2>{0.0777865797f, 0.637006462f},
-std::array<float,2>{0.488213241f, 0.382764667f},
-std::array<float,2>{0.982107222f, 0.732044697f},
-std::array<float,2>{0.61841923f, 0.12407998f},
-std::array<float,2>{0.228579879f, 0.883013606f},
-std::array<float,2>{0.0612522364f, 0.226873726f},
-std::array<float,2>{0.725764632f, 0.838377655f},
-std::array<float,2>{0.849639058f, 0.298015386f},
-std::array<float,2>{0.302709371f, 0.581210196f},
-std::array<float,2>{0.0630791709f, 0.320515394f},
-std::array<float,2>{0.639870286f, 0.51259315f},
-std::array<float,2>{0.770657718f, 0.128859386f},
-std::array<float,2>{0.318590403f, 0.795505524f},
-std::array<float,2>{0.398780882f, 0.00453121774f},
-std::array<float,2>{0.937450647f, 0.993654132f},
-std::array<float,2>{0.505073667f, 0.479399085f},
-std::array<float,2>{0.175799057f, 0.661260128f},
-std::array<float,2>{0.307282329f, 0.406540602f},
-std::array<float,2>{0.854567051f, 0.69111979f},
-std::array<float,2>{0.732807934f, 0.0927367881f},
-std::array<float,2>{0.0528751388f, 0.919441998f},
-std::array<float,2>{0.22063832f, 0.193736166f},
-std::array<float,2>{0.611212492f, 0.851249635f},
-std::array<float,2>{0.973357916f, 0.272869408f},
-std::array<float,2>{0.493051887f, 0.602577269f},
-std::array<float,2>{0.155124307f, 0.438075125f},
-std::array<float,2>{0.537935376f, 0.628551483f},
-std::array<float,2>{0.896646082f, 0.0607383028f},
-std::array<float,2>{0.409591645f, 0.966939032f},
-std::array<float,2>{0.372808486f, 0.161738604f},
-std::array<float,2>{0.794377863f, 0.7573874f},
-std::array<float,2>{0.673803151f, 0.344269782f},
-std::array<float,2>{0.109163933f, 0.557484627f},
-std::array<float,2>{0.450779259f, 0.30870533f},
-std::array<float,2>{0.947516382f, 0.590916574f},
-std::array<float,2>{0.58156532f, 0.221687853f},
-std::array<float,2>{0.215718448f, 0.833174646f},
-std::array<float,2>{0.0272267405f, 0.115229815f},
-std::array<float,2>{0.711914778f, 0.875804484f},
-std::array<float,2>{0.824909568f, 0.385844678f},
-std::array<float,2>{0.277048796f, 0.7201612f},
-std::array<float,2>{0.0414692163f, 0.405310929f},
-std::array<float,2>{0.744160175f, 0.737170935f},
-std::array<float,2>{0.861298144f, 0.103967912f},
-std::array<float,2>{0.284444213f, 0.900767505f},
-std::array<float,2>{0.483832985f, 0.243006036f},
-std::array<float,2>{0.990695417f, 0.819741428f},
-std::array<float,2>{0.608430147f, 0.290761709f},
-std::array<float,2>{0.237869263f, 0.565853417f},
-std::array<float,2>{0.338647872f, 0.366955906f},
-std::array<float,2>{0.75890702f, 0.537365258f},
-std::array<float,2>{0.651509404f, 0.185297564f},
-std::array<float,2>{0.0930916518f, 0.779207826f},
-std::array<float,2>{0.157473445f, 0.0329372697f},
-std::array<float,2>{0.518845499f, 0.941793561f},
-std::array<float,2>{0.914253533f, 0.46600008f},
-std::array<float,2>{0.376709372f, 0.642694652f},
-std::array<float,2>{0.192812607f, 0.259006977f},
-std::array<float,2>{0.571454883f, 0.620015442f},
-std::array<float,2>{0.966045201f, 0.216634318f},
-std::array<float,2>{0.464442879f, 0.864251494f},
-std::array<float,2>{0.25654459f, 0.0657609925f},
-std::array<float,2>{0.834373593f, 0.936562538f},
-std::array<float,2>{0.688554168f, 0.431293398f},
-std::array<float,2>{0.0090374006f, 0.711061299f},
-std::array<float,2>{0.437433332f, 0.496160239f},
-std::array<float,2>{0.886366665f, 0.682074368f},
-std::array<float,2>{0.55818516f, 0.0191826094f},
-std::array<float,2>{0.12679033f, 0.975076377f},
-std::array<float,2>{0.118560471f, 0.149141595f},
-std::array<float,2>{0.670150459f, 0.797573328f},
-std::array<float,2>{0.811402261f, 0.341932565f},
-std::array<float,2>{0.349543989f, 0.52967298f},
-std::array<float,2>{0.114176884f, 0.268235385f},
-std::array<float,2>{0.661155641f, 0.607753634f},
-std::array<float,2>{0.797233045f, 0.190082923f},
-std::array<float,2>{0.354679316f, 0.844502509f},
-std::array<float,2>{0.426588714f, 0.0861792415f},
-std::array<float,2>{0.876366198f, 0.914106011f},
-std::array<float,2>{0.55039078f, 0.413444996f},
-std::array<float,2>{0.132834271f, 0.695282936f},
-std::array<float,2>{0.261839658f, 0.482181102f},
-std::array<float,2>{0.836015165f, 0.658505261f},
-std::array<float,2>{0.699007809f, 0.00250590779f},
-std::array<float,2>{0.00127177185f, 0.996316791f},
-std::array<float,2>{0.195382774f, 0.132181928f},
-std::array<float,2>{0.566599965f, 0.792432427f},
-std::array<float,2>{0.957639337f, 0.327677131f},
-std::array<float,2>{0.458701223f, 0.510174274f},
-std::array<float,2>{0.171030119f, 0.389654934f},
-std::array<float,2>{0.527843058f, 0.722933769f},
-std::array<float,2>{0.913055956f, 0.111754529f},
-std::array<float,2>{0.38583523f, 0.881960511f},
-std::array<float,2>{0.330664426f, 0.225984961f},
-std::array<float,2>{0.750443816f, 0.829050004f},
-std::array<float,2>{0.643791616f, 0.307651639f},
-std::array<float,2>{0.0782005712f, 0.589302599f},
-std::array<float,2>{0.471020758f, 0.349799365f},
-std::array<float,2>{0.996225893f, 0.560031474f},
-std::array<float,2>{0.594677746f, 0.156576082f},
-std::array<float,2>{0.244540498f, 0.753141284f},
-std::array<float,2>{0.036997918f, 0.0570161305f},
-std::array<float,2>{0.737226069f, 0.962871909f},
-std::array<float,2>{0.874466002f, 0.443650901f},
-std::array<float,2>{0.29492113f, 0.628938735f},
-std::array<float,2>{0.019897256f, 0.462251782f},
-std::array<float,2>{0.707315505f, 0.647985876f},
-std::array<float,2>{0.819343388f, 0.0354128592f},
-std::array<float,2>{0.27019918f, 0.938850045f},
-std::array<float,2>{0.438842207f, 0.183337763f},
-std::array<float,2>{0.938300431f, 0.774201035f},
-std::array<float,2>{0.587854385f, 0.361838788f},
-std::array<float,2>{0.209762499f, 0.532227874f},
-std::array<float,2>{0.362637579f, 0.29486081f},
-std::array<float,2>{0.786374927f, 0.568616807f},
-std::array<float,2>{0.681033432f, 0.248872921f},
-std::array<float,2>{0.100026526f, 0.812933505f},
-std::array<float,2>{0.141228124f, 0.10748852f},
-std::array<float,2>{0.544635177f, 0.904482841f},
-std::array<float,2>{0.902962267f, 0.398861796f},
-std::array<float,2>{0.42140764f, 0.738307178f},
-std::array<float,2>{0.230626911f, 0.337061256f},
-std::array<float,2>{0.62133491f, 0.527031898f},
-std::array<float,2>{0.976575017f, 0.155274764f},
-std::array<float,2>{0.488815516f, 0.801100492f},
-std::array<float,2>{0.299677849f, 0.0215658098f},
-std::array<float,2>{0.845249176f, 0.97239399f},
-std::array<float,2>{0.720009506f, 0.495449662f},
-std::array<float,2>{0.0562287457f, 0.683975816f},
-std::array<float,2>{0.393590361f, 0.435830593f},
-std::array<float,2>{0.928876638f, 0.715635419f},
-std::array<float,2>{0.511547327f, 0.0691171438f},
-std::array<float,2>{0.180384278f, 0.933424711f},
-std::array<float,2>{0.0722241998f, 0.211937174f},
-std::array<float,2>{0.631665468f, 0.860622585f},
-std::array<float,2>{0.779786229f, 0.265509188f},
-std::array<float,2>{0.325358897f, 0.62377882f},
-std::array<float,2>{0.0505731627f, 0.371108025f},
-std::array<float,2>{0.727348506f, 0.542913973f},
-std::array<float,2>{0.858810544f, 0.177827075f},
-std::array<float,2>{0.309373796f, 0.769282937f},
-std::array<float,2>{0.49794805f, 0.0441105254f},
-std::array<float,2>{0.970530868f, 0.949936688f},
-std::array<float,2>{0.617136002f, 0.45855844f},
-std::array<float,2>{0.222938746f, 0.65180105f},
-std::array<float,2>{0.313536286f, 0.391708404f},
-std::array<float,2>{0.766071379f, 0.747273505f},
-std::array<float,2>{0.635924101f, 0.0996754989f},
-std::array<float,2>{0.0685737133f, 0.892465293f},
-std::array<float,2>{0.172669232f, 0.237643823f},
-std::array<float,2>{0.5025056f, 0.827691555f},
-std::array<float,2>{0.930629432f, 0.289057583f},
-std::array<float,2>{0.40279296f, 0.576182663f},
-std::array<float,2>{0.214415014f, 0.491795927f},
-std::array<float,2>{0.582864523f, 0.672385395f},
-std::array<float,2>{0.950577438f, 0.028473299f},
-std::array<float,2>{0.447568178f, 0.983743668f},
-std::array<float,2>{0.279394954f, 0.146141201f},
-std::array<float,2>{0.823690951f, 0.811787903f},
-std::array<float,2>{0.715203822f, 0.334280521f},
-std::array<float,2>{0.0278513432f, 0.521704078f},
-std::array<float,2>{0.410700917f, 0.250270724f},
-std::array<float,2>{0.890694261f, 0.612530947f},
-std::array<float,2>{0.534440935f, 0.208078086f},
-std::array<float,2>{0.150533199f, 0.874758482f},
-std::array<float,2>{0.10284546f, 0.0732395425f},
-std::array<float,2>{0.677493095f, 0.92261827f},
-std::array<float,2>{0.792035997f, 0.422538102f},
-std::array<float,2>{0.369630605f, 0.710370541f},
-std::array<float,2>{0.089129135f, 0.418978184f},
-std::array<float,2>{0.656122923f, 0.695809543f},
-std::array<float,2>{0.764965951f, 0.082303904f},
-std::array<float,2>{0.343603194f, 0.906647086f},
-std::array<float,2>{0.380777419f, 0.197708055f},
-std::array<float,2>{0.921327293f, 0.858127177f},
-std::array<float,2>{0.522989571f, 0.278533608f},
-std::array<float,2>{0.163285851f, 0.601522982f},
-std::array<float,2>{0.287178129f, 0.315301925f},
-std::array<float,2>{0.866801977f, 0.50353241f},
-std::array<float,2>{0.749082506f, 0.137867019f},
-std::array<float,2>{0.0437404029f, 0.785507917f},
-std::array<float,2>{0.240548357f, 0.0144616337f},
-std::array<float,2>{0.603903949f, 0.990321994f},
-std::array<float,2>{0.985585988f, 0.474067241f},
-std::array<float,2>{0.480257899f, 0.666477323f},
-std::array<float,2>{0.130001187f, 0.301010519f},
-std::array<float,2>{0.562243223f, 0.582840741f},
-std::array<float,2>{0.886931658f, 0.231430829f},
-std::array<float,2>{0.432708383f, 0.842641056f},
-std::array<float,2>{0.344731241f, 0.118394203f},
-std::array<float,2>{0.805551112f, 0.888028622f},
-std::array<float,2>{0.666199565f, 0.376206756f},
-std::array<float,2>{0.121925838f, 0.726687372f},
-std::array<float,2>{0.465041727f, 0.44612807f},
-std::array<float,2>{0.961664021f, 0.635684729f},
-std::array<float,2>{0.577166796f, 0.0529114828f},
-std::array<float,2>{0.188913763f, 0.954182327f},
-std::array<float,2>{0.0153819425f, 0.164967015f},
-std::array<float,2>{0.692609429f, 0.761320412f},
-std::array<float,2>{0.828200102f, 0.35335803f},
-std::array<float,2>{0.251548201f, 0.547701061f},
-std::array<float,2>{0.0325778946f, 0.255862474f},
-std::array<float,2>{0.739354074f, 0.614506423f},
-std::array<float,2>{0.869125664f, 0.204644755f},
-std::array<float,2>{0.290627211f, 0.868759096f},
-std::array<float,2>{0.476002455f, 0.0760218352f},
-std::array<float,2>{0.992429495f, 0.925908029f},
-std::array<float,2>{0.59881556f, 0.426490277f},
-std::array<float,2>{0.249019787f, 0.703264296f},
-std::array<float,2>{0.335336298f, 0.486628652f},
-std::array<float,2>{0.754694521f, 0.677060723f},
-std::array<float,2>{0.647843838f, 0.0246632099f},
-std::array<float,2>{0.0837907195f, 0.976929069f},
-std::array<float,2>{0.166011378f, 0.144446433f},
-std::array<float,2>{0.52549839f, 0.808252633f},
-std::array<float,2>{0.906835258f, 0.33179158f},
-std::array<float,2>{0.388002604f, 0.517415822f},
-std::array<float,2>{0.201780379f, 0.3950966f},
-std::array<float,2>{0.565942109f, 0.742817223f},
-std::array<float,2>{0.954362214f, 0.0939041302f},
-std::array<float,2>{0.456447124f, 0.895413697f},
-std::array<float,2>{0.258210659f, 0.23957698f},
-std::array<float,2>{0.840315104f, 0.823842585f},
-std::array<float,2>{0.702775657f, 0.282872528f},
-std::array<float,2>{0.00534157874f, 0.572449803f},
-std::array<float,2>{0.425256222f, 0.36788097f},
-std::array<float,2>{0.88107866f, 0.545950174f},
-std::array<float,2>{0.551338077f, 0.17414397f},
-std::array<float,2>{0.139901027f, 0.772722304f},
-std::array<float,2>{0.110259518f, 0.0418059751f},
-std::array<float,2>{0.658539176f, 0.946926832f},
-std::array<float,2>{0.802608967f, 0.456788987f},
-std::array<float,2>{0.357173771f, 0.654414594f},
-std::array<float,2>{0.0754574537f, 0.451547652f},
-std::array<float,2>{0.625404418f, 0.639414847f},
-std::array<float,2>{0.775413811f, 0.0483622886f},
-std::array<float,2>{0.321225345f, 0.9576419f},
-std::array<float,2>{0.39789328f, 0.170916334f},
-std::array<float,2>{0.925716341f, 0.764374435f},
-std::array<float,2>{0.51363045f, 0.358239949f},
-std::array<float,2>{0.186162934f, 0.552760184f},
-std::array<float,2>{0.303670734f, 0.299491465f},
-std::array<float,2>{0.848343372f, 0.578483701f},
-std::array<float,2>{0.72357446f, 0.230107427f},
-std::array<float,2>{0.0589949563f, 0.836959183f},
-std::array<float,2>{0.226782814f, 0.122838691f},
-std::array<float,2>{0.620507896f, 0.886276305f},
-std::array<float,2>{0.982995152f, 0.379730046f},
-std::array<float,2>{0.484555483f, 0.732523203f},
-std::array<float,2>{0.145090431f, 0.31922242f},
-std::array<float,2>{0.540994108f, 0.506138146f},
-std::array<float,2>{0.900361061f, 0.134353995f},
-std::array<float,2>{0.41643399f, 0.782524109f},
-std::array<float,2>{0.363630354f, 0.0114149703f},
-std::array<float,2>{0.78260529f, 0.985534728f},
-std::array<float,2>{0.685421228f, 0.469720095f},
-std::array<float,2>{0.0950838104f, 0.671314836f},
-std::array<float,2>{0.44365406f, 0.416070014f},
-std::array<float,2>{0.944885731f, 0.701039255f},
-std::array<float,2>{0.591686249f, 0.0786592066f},
-std::array<float,2>{0.204118714f, 0.911396086f},
-std::array<float,2>{0.0161069278f, 0.201499879f},
-std::array<float,2>{0.703274012f, 0.853584349f},
-std::array<float,2>{0.81419915f, 0.27360037f},
-std::array<float,2>{0.267439574f, 0.597610593f},
-std::array<float,2>{0.107028246f, 0.347352684f},
-std::array<float,2>{0.675381541f, 0.555143833f},
-std::array<float,2>{0.795627832f, 0.162752345f},
-std::array<float,2>{0.37359181f, 0.755364716f},
-std::array<float,2>{0.406878889f, 0.0588760115f},
-std::array<float,2>{0.89571166f, 0.965766668f},
-std::array<float,2>{0.536172688f, 0.440618634f},
-std::array<float,2>{0.153636977f, 0.62648648f},
-std::array<float,2>{0.274791479f, 0.38332057f},
-std::array<float,2>{0.82806778f, 0.722112596f},
-std::array<float,2>{0.713364124f, 0.116415203f},
-std::array<float,2>{0.0237011518f, 0.877762496f},
-std::array<float,2>{0.217563063f, 0.22040762f},
-std::array<float,2>{0.579018056f, 0.835273325f},
-std::array<float,2>{0.945333362f, 0.310945392f},
-std::array<float,2>{0.452141762f, 0.591821373f},
-std::array<float,2>{0.178751513f, 0.477291226f},
-std::array<float,2>{0.506909847f, 0.663144529f},
-std::array<float,2>{0.933793783f, 0.00675988849f},
-std::array<float,2>{0.402062535f, 0.995829761f},
-std::array<float,2>{0.317542136f, 0.125350535f},
-std::array<float,2>{0.77247417f, 0.794003189f},
-std::array<float,2>{0.637439847f, 0.322798818f},
-std::array<float,2>{0.0654309914f, 0.514078021f},
-std::array<float,2>{0.495524168f, 0.270515293f},
-std::array<float,2>{0.975302279f, 0.604227424f},
-std::array<float,2>{0.613264143f, 0.192556798f},
-std::array<float,2>{0.222655758f, 0.849009395f},
-std::array<float,2>{0.0516561046f, 0.0905134901f},
-std::array<float,2>{0.732011497f, 0.920252085f},
-std::array<float,2>{0.852225423f, 0.409371883f},
-std::array<float,2>{0.30567199f, 0.688649416f},
-std::array<float,2>{0.0102651156f, 0.43223998f},
-std::array<float,2>{0.69053936f, 0.714296997f},
-std::array<float,2>{0.833923578f, 0.0626013577f},
-std::array<float,2>{0.255050898f, 0.933667362f},
-std::array<float,2>{0.461276919f, 0.218580469f},
-std::array<float,2>{0.968071759f, 0.865980685f},
-std::array<float,2>{0.573740005f, 0.26131615f},
-std::array<float,2>{0.193462729f, 0.617962658f},
-std::array<float,2>{0.35036844f, 0.341717303f},
-std::array<float,2>{0.810443103f, 0.527626753f},
-std::array<float,2>{0.669446945f, 0.151429981f},
-std::array<float,2>{0.11939247f, 0.800384939f},
-std::array<float,2>{0.128551632f, 0.0165274981f},
-std::array<float,2>{0.554996431f, 0.972764492f},
-std::array<float,2>{0.884157121f, 0.498256087f},
-std::array<float,2>{0.435492069f, 0.680983186f},
-std::array<float,2>{0.235160947f, 0.292883545f},
-std::array<float,2>{0.605548799f, 0.564411521f},
-std::array<float,2>{0.988577008f, 0.245715037f},
-std::array<float,2>{0.481203109f, 0.818077028f},
-std::array<float,2>{0.282866985f, 0.103325449f},
-std::array<float,2>{0.8629843f, 0.900096536f},
-std::array<float,2>{0.743257344f, 0.403188109f},
-std::array<float,2>{0.0405845456f, 0.736101389f},
-std::array<float,2>{0.378335148f, 0.468658626f},
-std::array<float,2>{0.916949213f, 0.642306626f},
-std::array<float,2>{0.516465962f, 0.0337350592f},
-std::array<float,2>{0.159130052f, 0.943934798f},
-std::array<float,2>{0.0913575441f, 0.185608134f},
-std::array<float,2>{0.64887017f, 0.779308856f},
-std::array<float,2>{0.760574818f, 0.363827795f},
-std::array<float,2>{0.337697148f, 0.537024558f},
-std::array<float,2>{0.0813820586f, 0.305544108f},
-std::array<float,2>{0.64193821f, 0.587081909f},
-std::array<float,2>{0.753112793f, 0.223868951f},
-std::array<float,2>{0.328744322f, 0.831596136f},
-std::array<float,2>{0.383074254f, 0.109595746f},
-std::array<float,2>{0.910488963f, 0.87943244f},
-std::array<float,2>{0.53090328f, 0.38706243f},
-std::array<float,2>{0.168440998f, 0.724962652f},
-std::array<float,2>{0.296619117f, 0.442228138f},
-std::array<float,2>{0.872940838f, 0.632310331f},
-std::array<float,2>{0.734897375f, 0.056591291f},
-std::array<float,2>{0.0382617526f, 0.96397388f},
-std::array<float,2>{0.242339313f, 0.158430919f},
-std::array<float,2>{0.595942557f, 0.751614034f},
-std::array<float,2>{0.99865818f, 0.348069429f},
-std::array<float,2>{0.469130546f, 0.562121749f},
-std::array<float,2>{0.134895474f, 0.411459118f},
-std::array<float,2>{0.547496974f, 0.692297637f},
-std::array<float,2>{0.877075553f, 0.0886746719f},
-std::array<float,2>{0.429598451f, 0.917070925f},
-std::array<float,2>{0.351863831f, 0.189079404f},
-std::array<float,2>{0.799858093f, 0.847425818f},
-std::array<float,2>{0.662723482f, 0.266949564f},
-std::array<float,2>{0.116617545f, 0.606139421f},
-std::array<float,2>{0.458995789f, 0.324391156f},
-std::array<float,2>{0.959445715f, 0.507938385f},
-std::array<float,2>{0.570288956f, 0.129859433f},
-std::array<float,2>{0.198335558f, 0.789556742f},
-std::array<float,2>{0.00265619997f, 0.000429990556f},
-std::array<float,2>{0.695905447f, 0.999928892f},
-std::array<float,2>{0.838379741f, 0.484024584f},
-std::array<float,2>{0.26376766f, 0.657622039f},
-std::array<float,2>{0.0571464188f, 0.494008154f},
-std::array<float,2>{0.721605957f, 0.68581301f},
-std::array<float,2>{0.846470892f, 0.0209467728f},
-std::array<float,2>{0.29826802f, 0.968841553f},
-std::array<float,2>{0.492058605f, 0.153893679f},
-std::array<float,2>{0.980312586f, 0.804598868f},
-std::array<float,2>{0.624003828f, 0.339811981f},
-std::array<float,2>{0.234047979f, 0.523545146f},
-std::array<float,2>{0.327499509f, 0.2621032f},
-std::array<float,2>{0.778859854f, 0.622105539f},
-std::array<float,2>{0.629683614f, 0.213516831f},
-std::array<float,2>{0.0739823803f, 0.862692177f},
-std::array<float,2>{0.18343477f, 0.0671364293f},
-std::array<float,2>{0.509577274f, 0.929973006f},
-std::array<float,2>{0.926276028f, 0.434099853f},
-std::array<float,2>{0.392113f, 0.717511654f},
-std::array<float,2>{0.207720235f, 0.361089349f},
-std::array<float,2>{0.588638127f, 0.535146177f},
-std::array<float,2>{0.93961525f, 0.180418491f},
-std::array<float,2>{0.439809769f, 0.776304007f},
-std::array<float,2>{0.271948457f, 0.0385242477f},
-std::array<float,2>{0.818258703f, 0.939854264f},
-std::array<float,2>{0.709931016f, 0.463728458f},
-std::array<float,2>{0.022919789f, 0.644631863f},
-std::array<float,2>{0.418416739f, 0.402133733f},
-std::array<float,2>{0.905918121f, 0.740612566f},
-std::array<float,2>{0.546275437f, 0.105528735f},
-std::array<float,2>{0.142965332f, 0.904036224f},
-std::array<float,2>{0.0979327038f, 0.246344924f},
-std::array<float,2>{0.68255657f, 0.815151334f},
-std::array<float,2>{0.787871897f, 0.295131743f},
-std::array<float,2>{0.360307276f, 0.568089306f},
-std::array<float,2>{0.0312381592f, 0.333975166f},
-std::array<float,2>{0.718125582f, 0.521045983f},
-std::array<float,2>{0.820859909f, 0.148145095f},
-std::array<float,2>{0.277456611f, 0.808925211f},
-std::array<float,2>{0.446660161f, 0.0308572706f},
-std::array<float,2>{0.951283634f, 0.982311964f},
-std::array<float,2>{0.585861444f, 0.489984363f},
-std::array<float,2>{0.211076111f, 0.675204098f},
-std::array<float,2>{0.367831975f, 0.424731731f},
-std::array<float,2>{0.78909266f, 0.707106233f},
-std::array<float,2>{0.678633273f, 0.0711394846f},
-std::array<float,2>{0.104133129f, 0.924337745f},
-std::array<float,2>{0.150101125f, 0.210073963f},
-std::array<float,2>{0.531814098f, 0.871507227f},
-std::array<float,2>{0.892779291f, 0.253319502f},
-std::array<float,2>{0.413859069f, 0.610255301f},
-std::array<float,2>{0.226042494f, 0.460309178f},
-std::array<float,2>{0.614659846f, 0.649244726f},
-std::array<float,2>{0.970922232f, 0.0460003242f},
-std::array<float,2>{0.498917192f, 0.952208877f},
-std::array<float,2>{0.312012315f, 0.177427441f},
-std::array<float,2>{0.85587734f, 0.766558528f},
-std::array<float,2>{0.72880137f, 0.373184204f},
-std::array<float,2>{0.0486251637f, 0.540766239f},
-std::array<float,2>{0.405968249f, 0.286780715f},
-std::array<float,2>{0.933303654f, 0.575667739f},
-std::array<float,2>{0.501545548f, 0.236129105f},
-std::array<float,2>{0.173996925f, 0.825675189f},
-std::array<float,2>{0.0679342821f, 0.0982897207f},
-std::array<float,2>{0.633981228f, 0.893167317f},
-std::array<float,2>{0.767678738f, 0.394475311f},
-std::array<float,2>{0.316162109f, 0.749898791f},
-std::array<float,2>{0.123516388f, 0.377172142f},
-std::array<float,2>{0.665765345f, 0.730465114f},
-std::array<float,2>{0.807923555f, 0.119811133f},
-std::array<float,2>{0.346722245f, 0.889838219f},
-std::array<float,2>{0.430930704f, 0.233251587f},
-std::array<float,2>{0.888992131f, 0.841301501f},
-std::array<float,2>{0.559021294f, 0.303258777f},
-std::array<float,2>{0.131926626f, 0.585901916f},
-std::array<float,2>{0.253065914f, 0.354299903f},
-std::array<float,2>{0.831658065f, 0.550225377f},
-std::array<float,2>{0.693958759f, 0.167384177f},
-std::array<float,2>{0.0134235201f, 0.759433389f},
-std::array<float,2>{0.19137086f, 0.0526302978f},
-std::array<float,2>{0.575510383f, 0.956145465f},
-std::array<float,2>{0.963494122f, 0.44792673f},
-std::array<float,2>{0.468466133f, 0.634649992f},
-std::array<float,2>{0.161736712f, 0.279532105f},
-std::array<float,2>{0.520370245f, 0.597813725f},
-std::array<float,2>{0.918707073f, 0.196650177f},
-std::array<float,2>{0.381920069f, 0.855701208f},
-std::array<float,2>{0.341642231f, 0.0840589553f},
-std::array<float,2>{0.761855841f, 0.909757674f},
-std::array<float,2>{0.653611302f, 0.421456337f},
-std::array<float,2>{0.0868626684f, 0.699175179f},
-std::array<float,2>{0.47846213f, 0.475632548f},
-std::array<float,2>{0.986605108f, 0.66542685f},
-std::array<float,2>{0.602360606f, 0.0134326359f},
-std::array<float,2>{0.239217326f, 0.98945868f},
-std::array<float,2>{0.0462240055f, 0.138739765f},
-std::array<float,2>{0.747266054f, 0.789051175f},
-std::array<float,2>{0.863590658f, 0.313269287f},
-std::array<float,2>{0.285911322f, 0.500508308f},
-std::array<float,2>{0.0601488724f, 0.297267139f},
-std::array<float,2>{0.724343538f, 0.580119908f},
-std::array<float,2>{0.849094152f, 0.228343531f},
-std::array<float,2>{0.303792506f, 0.83926481f},
-std::array<float,2>{0.486290604f, 0.123212062f},
-std::array<float,2>{0.983709514f, 0.883948684f},
-std::array<float,2>{0.619637191f, 0.381177545f},
-std::array<float,2>{0.228006288f, 0.73090452f},
-std::array<float,2>{0.32225883f, 0.450349659f},
-std::array<float,2>{0.776510417f, 0.638498545f},
-std::array<float,2>{0.626652479f, 0.0490186103f},
-std::array<float,2>{0.0751362294f, 0.960881293f},
-std::array<float,2>{0.186927393f, 0.168618992f},
-std::array<float,2>{0.511855245f, 0.762472093f},
-std::array<float,2>{0.924479544f, 0.356167644f},
-std::array<float,2>{0.39679864f, 0.551126301f},
-std::array<float,2>{0.203826383f, 0.414907813f},
-std::array<float,2>{0.59006989f, 0.702344418f},
-std::array<float,2>{0.943857729f, 0.0807870254f},
-std::array<float,2>{0.444549471f, 0.912452459f},
-std::array<float,2>{0.266377658f, 0.199558854f},
-std::array<float,2>{0.813005328f, 0.853151143f},
-std::array<float,2>{0.704356015f, 0.27656728f},
-std::array<float,2>{0.0174299385f, 0.594516218f},
-std::array<float,2>{0.417229056f, 0.31711179f},
-std::array<float,2>{0.899004996f, 0.504875124f},
-std::array<float,2>{0.539347529f, 0.136370733f},
-std::array<float,2>{0.146025956f, 0.783939302f},
-std::array<float,2>{0.0946781263f, 0.00915870257f},
-std::array<float,2>{0.684444606f, 0.988010526f},
-std::array<float,2>{0.781268656f, 0.472594172f},
-std::array<float,2>{0.36447677f, 0.669632614f},
-std::array<float,2>{0.0826599076f, 0.485697776f},
-std::array<float,2>{0.646938443f, 0.678740501f},
-std::array<float,2>{0.755205393f, 0.0270286743f},
-std::array<float,2>{0.334337711f, 0.978781044f},
-std::array<float,2>{0.387248129f, 0.141458318f},
-std::array<float,2>{0.907579958f, 0.806470394f},
-std::array<float,2>{0.526858687f, 0.329050153f},
-std::array<float,2>{0.164446875f, 0.517719984f},
-std::array<float,2>{0.289597869f, 0.254796535f},
-std::array<float,2>{0.867233157f, 0.615539849f},
-std::array<float,2>{0.738913655f, 0.205326021f},
-std::array<float,2>{0.031400688f, 0.870837688f},
-std::array<float,2>{0.249358013f, 0.0778217837f},
-std::array<float,2>{0.598495364f, 0.929193795f},
-std::array<float,2>{0.993228197f, 0.429351836f},
-std::array<float,2>{0.47505337f, 0.70590055f},
-std::array<float,2>{0.139358446f, 0.369584769f},
-std::array<float,2>{0.552089274f, 0.543667555f},
-std::array<float,2>{0.882731318f, 0.172405183f},
-std::array<float,2>{0.424463511f, 0.769698441f},
-std::array<float,2>{0.355547458f, 0.0408524275f},
-std::array<float,2>{0.801399469f, 0.947941959f},
-std::array<float,2>{0.659322739f, 0.454368412f},
-std::array<float,2>{0.110873751f, 0.652350187f},
-std::array<float,2>{0.455762982f, 0.397495031f},
-std::array<float,2>{0.953237116f, 0.744829535f},
-std::array<float,2>{0.565162897f, 0.0961083248f},
-std::array<float,2>{0.202753365f, 0.897736073f},
-std::array<float,2>{0.00453474512f, 0.240275785f},
-std::array<float,2>{0.701196432f, 0.82032603f},
-std::array<float,2>{0.841621339f, 0.284230053f},
-std::array<float,2>{0.258805901f, 0.570326269f},
-std::array<float,2>{0.120529935f, 0.343741119f},
-std::array<float,2>{0.668176353f, 0.530599475f},
-std::array<float,2>{0.808793843f, 0.150293112f},
-std::array<float,2>{0.351319581f, 0.79857409f},
-std::array<float,2>{0.434403658f, 0.0182266105f},
-std::array<float,2>{0.883308947f, 0.97572577f},
-std::array<float,2>{0.556148767f, 0.497574687f},
-std::array<float,2>{0.127365023f, 0.68329668f},
-std::array<float,2>{0.25485307f, 0.429697722f},
-std::array<float,2>{0.832568705f, 0.712541938f},
-std::array<float,2>{0.690288544f, 0.0651388392f},
-std::array<float,2>{0.0114192702f, 0.935919881f},
-std::array<float,2>{0.194581181f, 0.215276793f},
-std::array<float,2>{0.572498083f, 0.86474371f},
-std::array<float,2>{0.967543662f, 0.257997394f},
-std::array<float,2>{0.462657154f, 0.620727301f},
-std::array<float,2>{0.159890726f, 0.46536687f},
-std::array<float,2>{0.517082334f, 0.643873215f},
-std::array<float,2>{0.917012095f, 0.0320041738f},
-std::array<float,2>{0.37758553f, 0.942505479f},
-std::array<float,2>{0.336762846f, 0.184058711f},
-std::array<float,2>{0.76139605f, 0.777962029f},
-std::array<float,2>{0.649708867f, 0.366179049f},
-std::array<float,2>{0.0900234357f, 0.538613319f},
-std::array<float,2>{0.481882066f, 0.289751977f},
-std::array<float,2>{0.990233719f, 0.565393627f},
-std::array<float,2>{0.607349932f, 0.243869096f},
-std::array<float,2>{0.236272752f, 0.819167316f},
-std::array<float,2>{0.0391925052f, 0.104765512f},
-std::array<float,2>{0.742768109f, 0.902128637f},
-std::array<float,2>{0.861353993f, 0.404305249f},
-std::array<float,2>{0.281865329f, 0.738129616f},
-std::array<float,2>{0.0250025056f, 0.384865195f},
-std::array<float,2>{0.71419853f, 0.719057679f},
-std::array<float,2>{0.827123523f, 0.113299564f},
-std::array<float,2>{0.274155885f, 0.876217782f},
-std::array<float,2>{0.452777416f, 0.221086755f},
-std::array<float,2>{0.947053969f, 0.832091033f},
-std::array<float,2>{0.579172194f, 0.310162932f},
-std::array<float,2>{0.217948347f, 0.590566397f},
-std::array<float,2>{0.37479502f, 0.34524408f},
-std::array<float,2>{0.796309114f, 0.558182001f},
-std::array<float,2>{0.674703717f, 0.160849288f},
-std::array<float,2>{0.105591156f, 0.756064951f},
-std::array<float,2>{0.153088197f, 0.0617937967f},
-std::array<float,2>{0.535835385f, 0.968084633f},
-std::array<float,2>{0.894804239f, 0.439314783f},
-std::array<float,2>{0.407398283f, 0.627241671f},
-std::array<float,2>{0.221544117f, 0.271574259f},
-std::array<float,2>{0.612222135f, 0.601744473f},
-std::array<float,2>{0.975875616f, 0.19511579f},
-std::array<float,2>{0.495048672f, 0.850568712f},
-std::array<float,2>{0.305190802f, 0.093440637f},
-std::array<float,2>{0.853296578f, 0.918364048f},
-std::array<float,2>{0.731435537f, 0.407450318f},
-std::array<float,2>{0.0524552576f, 0.689608395f},
-std::array<float,2>{0.400414437f, 0.479977459f},
-std::array<float,2>{0.935329497f, 0.660863578f},
-std::array<float,2>{0.506603241f, 0.0052524833f},
-std::array<float,2>{0.17779918f, 0.993092418f},
-std::array<float,2>{0.0652712882f, 0.127068609f},
-std::array<float,2>{0.63857913f, 0.795925856f},
-std::array<float,2>{0.77165556f, 0.321887851f},
-std::array<float,2>{0.316469163f, 0.513077676f},
-std::array<float,2>{0.0730629265f, 0.263768315f},
-std::array<float,2>{0.630509257f, 0.624515295f},
-std::array<float,2>{0.778137207f, 0.211515486f},
-std::array<float,2>{0.326755226f, 0.860244632f},
-std::array<float,2>{0.391139299f, 0.0701682344f},
-std::array<float,2>{0.926888347f, 0.931745589f},
-std::array<float,2>{0.507895589f, 0.436544299f},
-std::array<float,2>{0.182220221f, 0.716064036f},
-std::array<float,2>{0.297308207f, 0.494839877f},
-std::array<float,2>{0.846715271f, 0.685267746f},
-std::array<float,2>{0.722493291f, 0.0224840138f},
-std::array<float,2>{0.0580465123f, 0.971003115f},
-std::array<float,2>{0.232768834f, 0.155070186f},
-std::array<float,2>{0.624678731f, 0.802213788f},
-std::array<float,2>{0.979339123f, 0.336906642f},
-std::array<float,2>{0.491051286f, 0.526135623f},
-std::array<float,2>{0.144240201f, 0.399911582f},
-std::array<float,2>{0.545201421f, 0.740077436f},
-std::array<float,2>{0.905148327f, 0.109237134f},
-std::array<float,2>{0.419889122f, 0.905996203f},
-std::array<float,2>{0.361049145f, 0.249301791f},
-std::array<float,2>{0.788664162f, 0.813524544f},
-std::array<float,2>{0.683296323f, 0.293882966f},
-std::array<float,2>{0.0990397632f, 0.569934249f},
-std::array<float,2>{0.440634549f, 0.363037974f},
-std::array<float,2>{0.940817118f, 0.532105207f},
-std::array<float,2>{0.589136779f, 0.182171687f},
-std::array<float,2>{0.208281621f, 0.774567485f},
-std::array<float,2>{0.0215108842f, 0.0363631099f},
-std::array<float,2>{0.710303605f, 0.938184142f},
-std::array<float,2>{0.81684345f, 0.461874306f},
-std::array<float,2>{0.273171306f, 0.64673382f},
-std::array<float,2>{0.0376789309f, 0.445015341f},
-std::array<float,2>{0.735376239f, 0.630659997f},
-std::array<float,2>{0.871269226f, 0.0577328689f},
-std::array<float,2>{0.295820355f, 0.961303234f},
-std::array<float,2>{0.47023043f, 0.157610416f},
-std::array<float,2>{0.999922693f, 0.752156317f},
-std::array<float,2>{0.597052217f, 0.351222754f},
-std::array<float,2>{0.243589863f, 0.55872035f},
-std::array<float,2>{0.329137713f, 0.30740425f},
-std::array<float,2>{0.752070904f, 0.58820945f},
-std::array<float,2>{0.641105115f, 0.22497794f},
-std::array<float,2>{0.0807071552f, 0.829726636f},
-std::array<float,2>{0.169442713f, 0.113014504f},
-std::array<float,2>{0.530174494f, 0.880972147f},
-std::array<float,2>{0.911583602f, 0.389514148f},
-std::array<float,2>{0.384621412f, 0.723751128f},
-std::array<float,2>{0.19750677f, 0.326897353f},
-std::array<float,2>{0.568526745f, 0.511401832f},
-std::array<float,2>{0.960808516f, 0.13133195f},
-std::array<float,2>{0.460148662f, 0.791715622f},
-std::array<float,2>{0.264950246f, 0.00390110281f},
-std::array<float,2>{0.8393628f, 0.997899413f},
-std::array<float,2>{0.696380079f, 0.480721653f},
-std::array<float,2>{0.00386357494f, 0.660086215f},
-std::array<float,2>{0.428527832f, 0.412299782f},
-std::array<float,2>{0.878380835f, 0.693984449f},
-std::array<float,2>{0.548108459f, 0.0870829299f},
-std::array<float,2>{0.136243895f, 0.91529429f},
-std::array<float,2>{0.116069354f, 0.191014186f},
-std::array<float,2>{0.663643181f, 0.845356405f},
-std::array<float,2>{0.799508989f, 0.268931597f},
-std::array<float,2>{0.353116661f, 0.609118402f},
-std::array<float,2>{0.0121287862f, 0.352474362f},
-std::array<float,2>{0.694727659f, 0.548403382f},
-std::array<float,2>{0.830497801f, 0.16516073f},
-std::array<float,2>{0.252705663f, 0.760429323f},
-std::array<float,2>{0.467222035f, 0.0546809062f},
-std::array<float,2>{0.964786887f, 0.95371455f},
-std::array<float,2>{0.574689806f, 0.44659695f},
-std::array<float,2>{0.189640045f, 0.636184514f},
-std::array<float,2>{0.346199691f, 0.375779986f},
-std::array<float,2>{0.807419896f, 0.728028297f},
-std::array<float,2>{0.665003359f, 0.117517769f},
-std::array<float,2>{0.124712653f, 0.887549818f},
-std::array<float,2>{0.130921319f, 0.232011914f},
-std::array<float,2>{0.560030282f, 0.843421698f},
-std::array<float,2>{0.890169144f, 0.301783144f},
-std::array<float,2>{0.430065274f, 0.583424211f},
-std::array<float,2>{0.23988983f, 0.473486483f},
-std::array<float,2>{0.602757156f, 0.667401373f},
-std::array<float,2>{0.988061428f, 0.0152722681f},
-std::array<float,2>{0.477524728f, 0.99144417f},
-std::array<float,2>{0.28664124f, 0.136809647f},
-std::array<float,2>{0.864817321f, 0.786734343f},
-std::array<float,2>{0.746576726f, 0.316133082f},
-std::array<float,2>{0.0457559675f, 0.502451241f},
-std::array<float,2>{0.381167799f, 0.278307706f},
-std::array<float,2>{0.919582486f, 0.60034585f},
-std::array<float,2>{0.520618498f, 0.199126735f},
-std::array<float,2>{0.160733759f, 0.85895592f},
-std::array<float,2>{0.0875671133f, 0.0830185264f},
-std::array<float,2>{0.65293175f, 0.907650828f},
-std::array<float,2>{0.763633728f, 0.418827325f},
-std::array<float,2>{0.340180784f, 0.697093725f},
-std::array<float,2>{0.104951903f, 0.423329383f},
-std::array<float,2>{0.679622352f, 0.709634602f},
-std::array<float,2>{0.790229976f, 0.0737207383f},
-std::array<float,2>{0.368415713f, 0.92331779f},
-std::array<float,2>{0.412372619f, 0.207933903f},
-std::array<float,2>{0.893735945f, 0.873792827f},
-std::array<float,2>{0.532608747f, 0.251930028f},
-std::array<float,2>{0.149235949f, 0.612183273f},
-std::array<float,2>{0.279223502f, 0.33587727f},
-std::array<float,2>{0.821677446f, 0.522693872f},
-std::array<float,2>{0.717140198f, 0.144951031f},
-std::array<float,2>{0.0294725318f, 0.810644746f},
-std::array<float,2>{0.212157995f, 0.0278472863f},
-std::array<float,2>{0.584905922f, 0.982989371f},
-std::array<float,2>{0.952370167f, 0.491079181f},
-std::array<float,2>{0.446234375f, 0.672886252f},
-std::array<float,2>{0.175181955f, 0.288081199f},
-std::array<float,2>{0.500690341f, 0.577923954f},
-std::array<float,2>{0.93206501f, 0.236665487f},
-std::array<float,2>{0.404604316f, 0.826895416f},
-std::array<float,2>{0.314845443f, 0.100636452f},
-std::array<float,2>{0.76898998f, 0.891018689f},
-std::array<float,2>{0.632983685f, 0.3914648f},
-std::array<float,2>{0.0665130317f, 0.746816099f},
-std::array<float,2>{0.499326378f, 0.457056016f},
-std::array<float,2>{0.97245568f, 0.650672793f},
-std::array<float,2>{0.613743305f, 0.0433984958f},
-std::array<float,2>{0.225028992f, 0.950246274f},
-std::array<float,2>{0.0478361808f, 0.179681212f},
-std::array<float,2>{0.729964912f, 0.768220961f},
-std::array<float,2>{0.857327044f, 0.372777104f},
-std::array<float,2>{0.311158627f, 0.54104799f},
-std::array<float,2>{0.0191306155f, 0.275205731f},
-std::array<float,2>{0.706466556f, 0.5957371f},
-std::array<float,2>{0.815056562f, 0.202657253f},
-std::array<float,2>{0.26905477f, 0.854570389f},
-std::array<float,2>{0.441651583f, 0.079220891f},
-std::array<float,2>{0.94167012f, 0.910387814f},
-std::array<float,2>{0.59283942f, 0.417944312f},
-std::array<float,2>{0.205308482f, 0.699341357f},
-std::array<float,2>{0.365567982f, 0.469965696f},
-std::array<float,2>{0.783607125f, 0.670858622f},
-std::array<float,2>{0.686205745f, 0.0106795039f},
-std::array<float,2>{0.0966904536f, 0.984920621f},
-std::array<float,2>{0.14719601f, 0.132915467f},
-std::array<float,2>{0.542266846f, 0.781488359f},
-std::array<float,2>{0.90172416f, 0.319915444f},
-std::array<float,2>{0.414148182f, 0.507171214f},
-std::array<float,2>{0.230020463f, 0.380414099f},
-std::array<float,2>{0.617508054f, 0.733943462f},
-std::array<float,2>{0.981265962f, 0.121370964f},
-std::array<float,2>{0.486467332f, 0.885319114f},
-std::array<float,2>{0.301163763f, 0.229410738f},
-std::array<float,2>{0.8512761f, 0.836413324f},
-std::array<float,2>{0.725418746f, 0.299862355f},
-std::array<float,2>{0.0623140782f, 0.579433203f},
-std::array<float,2>{0.395068586f, 0.359283149f},
-std::array<float,2>{0.923345268f, 0.553991735f},
-std::array<float,2>{0.513764143f, 0.170405358f},
-std::array<float,2>{0.185161889f, 0.76531738f},
-std::array<float,2>{0.0763351768f, 0.0471163206f},
-std::array<float,2>{0.627470791f, 0.958320141f},
-std::array<float,2>{0.774919987f, 0.452509701f},
-std::array<float,2>{0.323635131f, 0.640532076f},
-std::array<float,2>{0.113137253f, 0.455692738f},
-std::array<float,2>{0.656707227f, 0.655478537f},
-std::array<float,2>{0.803704023f, 0.0424431227f},
-std::array<float,2>{0.359240949f, 0.945472717f},
-std::array<float,2>{0.423602402f, 0.174825996f},
-std::array<float,2>{0.880570412f, 0.771950662f},
-std::array<float,2>{0.553300619f, 0.368238062f},
-std::array<float,2>{0.137802228f, 0.545197725f},
-std::array<float,2>{0.260371387f, 0.282162398f},
-std::array<float,2>{0.842032373f, 0.574086249f},
-std::array<float,2>{0.700731158f, 0.23834978f},
-std::array<float,2>{0.00626489054f, 0.822591484f},
-std::array<float,2>{0.20063965f, 0.0948316976f},
-std::array<float,2>{0.563770533f, 0.896017849f},
-std::array<float,2>{0.955973506f, 0.395731091f},
-std::array<float,2>{0.455047339f, 0.743392944f},
-std::array<float,2>{0.166382641f, 0.330974102f},
-std::array<float,2>{0.523943901f, 0.516496599f},
-std::array<float,2>{0.908998311f, 0.143120632f},
-std::array<float,2>{0.388750583f, 0.80705452f},
-std::array<float,2>{0.33255586f, 0.0239095576f},
-std::array<float,2>{0.756186187f, 0.977751553f},
-std::array<float,2>{0.646256864f, 0.488130152f},
-std::array<float,2>{0.0856791735f, 0.676446617f},
-std::array<float,2>{0.473675966f, 0.42681554f},
-std::array<float,2>{0.995007455f, 0.704246342f},
-std::array<float,2>{0.601016998f, 0.0743781403f},
-std::array<float,2>{0.246693358f, 0.927292347f},
-std::array<float,2>{0.0332545936f, 0.203177571f},
-std::array<float,2>{0.740382791f, 0.867700517f},
-std::array<float,2>{0.869178057f, 0.257092655f},
-std::array<float,2>{0.292657673f, 0.613520563f},
-std::array<float,2>{0.0918570086f, 0.364420891f},
-std::array<float,2>{0.651271462f, 0.535483479f},
-std::array<float,2>{0.758149326f, 0.186541125f},
-std::array<float,2>{0.33947283f, 0.78027761f},
-std::array<float,2>{0.37569353f, 0.0342875309f},
-std::array<float,2>{0.916004241f, 0.94505477f},
-std::array<float,2>{0.517606616f, 0.46702382f},
-std::array<float,2>{0.156287402f, 0.640977085f},
-std::array<float,2>{0.283225834f, 0.404093802f},
-std::array<float,2>{0.859464586f, 0.734873235f},
-std::array<float,2>{0.745157957f, 0.102229677f},
-std::array<float,2>{0.0420261696f, 0.899163067f},
-std::array<float,2>{0.23667869f, 0.244964778f},
-std::array<float,2>{0.607815146f, 0.81736809f},
-std::array<float,2>{0.991735578f, 0.29145059f},
-std::array<float,2>{0.48287341f, 0.563403368f},
-std::array<float,2>{0.125322431f, 0.499629527f},
-std::array<float,2>{0.556768298f, 0.680239916f},
-std::array<float,2>{0.885667264f, 0.0166181028f},
-std::array<float,2>{0.436184227f, 0.973837197f},
-std::array<float,2>{0.34777528f, 0.151053488f},
-std::array<float,2>{0.81205231f, 0.799443662f},
-std::array<float,2>{0.67168808f, 0.340760648f},
-std::array<float,2>{0.11787688f, 0.529198766f},
-std::array<float,2>{0.463848859f, 0.259869576f},
-std::array<float,2>{0.964912057f, 0.618329585f},
-std::array<float,2>{0.570829511f, 0.216980815f},
-std::array<float,2>{0.192075506f, 0.866590202f},
-std::array<float,2>{0.00860927906f, 0.0642067194f},
-std::array<float,2>{0.687924385f, 0.934946299f},
-std::array<float,2>{0.835799873f, 0.433436066f},
-std::array<float,2>{0.256930918f, 0.713780284f},
-std::array<float,2>{0.0545127466f, 0.408243954f},
-std::array<float,2>{0.733798444f, 0.688294291f},
-std::array<float,2>{0.853716195f, 0.0912506804f},
-std::array<float,2>{0.307722509f, 0.921844482f},
-std::array<float,2>{0.493431479f, 0.192109585f},
-std::array<float,2>{0.974387944f, 0.847941518f},
-std::array<float,2>{0.610004485f, 0.269880116f},
-std::array<float,2>{0.219006896f, 0.6047135f},
-std::array<float,2>{0.319583237f, 0.323337048f},
-std::array<float,2>{0.769927204f, 0.51556772f},
-std::array<float,2>{0.639265478f, 0.126341715f},
-std::array<float,2>{0.0637884438f, 0.793317318f},
-std::array<float,2>{0.176980704f, 0.00727355806f},
-std::array<float,2>{0.504665017f, 0.99482578f},
-std::array<float,2>{0.935647607f, 0.477751762f},
-std::array<float,2>{0.399681568f, 0.662887514f},
-std::array<float,2>{0.216505304f, 0.312160581f},
-std::array<float,2>{0.580774128f, 0.593653619f},
-std::array<float,2>{0.948913097f, 0.218835592f},
-std::array<float,2>{0.44948554f, 0.834054649f},
-std::array<float,2>{0.276273489f, 0.116035275f},
-std::array<float,2>{0.82552433f, 0.878436625f},
-std::array<float,2>{0.711243331f, 0.384067029f},
-std::array<float,2>{0.0254423302f, 0.721145034f},
-std::array<float,2>{0.408618987f, 0.440149307f},
-std::array<float,2>{0.898114264f, 0.625343978f},
-std::array<float,2>{0.538600624f, 0.0596202575f},
-std::array<float,2>{0.156114951f, 0.966455996f},
-std::array<float,2>{0.107551187f, 0.163428247f},
-std::array<float,2>{0.672132015f, 0.754685163f},
-std::array<float,2>{0.793894768f, 0.346664727f},
-std::array<float,2>{0.371558875f, 0.556355059f},
-std::array<float,2>{0.101369448f, 0.295974523f},
-std::array<float,2>{0.680580199f, 0.566767216f},
-std::array<float,2>{0.785254657f, 0.247253254f},
-std::array<float,2>{0.361665279f, 0.816265225f},
-std::array<float,2>{0.420519382f, 0.106454402f},
-std::array<float,2>{0.904017329f, 0.902812421f},
-std::array<float,2>{0.542997777f, 0.400513858f},
-std::array<float,2>{0.142118663f, 0.741330028f},
-std::array<float,2>{0.271307558f, 0.464115649f},
-std::array<float,2>{0.818858027f, 0.646276832f},
-std::array<float,2>{0.708809912f, 0.0375442356f},
-std::array<float,2>{0.0209324751f, 0.940585494f},
-std::array<float,2>{0.210116655f, 0.181258544f},
-std::array<float,2>{0.586308658f, 0.776429892f},
-std::array<float,2>{0.938744307f, 0.359433472f},
-std::array<float,2>{0.438247502f, 0.533636928f},
-std::array<float,2>{0.181285426f, 0.435462177f},
-std::array<float,2>{0.510651588f, 0.718571484f},
-std::array<float,2>{0.928630114f, 0.0678070039f},
-std::array<float,2>{0.392823309f, 0.931175172f},
-std::array<float,2>{0.324757278f, 0.21399121f},
-std::array<float,2>{0.780438602f, 0.86202997f},
-std::array<float,2>{0.632434607f, 0.263436049f},
-std::array<float,2>{0.0710214749f, 0.621700346f},
-std::array<float,2>{0.489328593f, 0.338438839f},
-std::array<float,2>{0.977789581f, 0.524856091f},
-std::array<float,2>{0.622092843f, 0.153199837f},
-std::array<float,2>{0.232287124f, 0.803065121f},
-std::array<float,2>{0.0552423038f, 0.0204869621f},
-std::array<float,2>{0.718831599f, 0.970299244f},
-std::array<float,2>{0.843818307f, 0.49314332f},
-std::array<float,2>{0.300508022f, 0.687403083f},
-std::array<float,2>{0.000177228663f, 0.483267158f},
-std::array<float,2>{0.698180318f, 0.657151401f},
-std::array<float,2>{0.837637424f, 0.00163593353f},
-std::array<float,2>{0.263463706f, 0.998929739f},
-std::array<float,2>{0.45705989f, 0.13059172f},
-std::array<float,2>{0.958493769f, 0.790335715f},
-std::array<float,2>{0.567462683f, 0.325665534f},
-std::array<float,2>{0.196321756f, 0.509510756f},
-std::array<float,2>{0.354336739f, 0.266050786f},
-std::array<float,2>{0.797858059f, 0.607356429f},
-std::array<float,2>{0.660220981f, 0.188186049f},
-std::array<float,2>{0.114324085f, 0.846228659f},
-std::array<float,2>{0.134148911f, 0.0894090906f},
-std::array<float,2>{0.549664438f, 0.91647017f},
-std::array<float,2>{0.87592411f, 0.410309494f},
-std::array<float,2>{0.427524507f, 0.692911506f},
-std::array<float,2>{0.2460244f, 0.349570185f},
-std::array<float,2>{0.594976366f, 0.560565293f},
-std::array<float,2>{0.997360766f, 0.159896433f},
-std::array<float,2>{0.472391099f, 0.750350475f},
-std::array<float,2>{0.292978585f, 0.0556442998f},
-std::array<float,2>{0.873474419f, 0.963193357f},
-std::array<float,2>{0.738166749f, 0.443215549f},
-std::array<float,2>{0.0352993682f, 0.631384075f},
-std::array<float,2>{0.385554969f, 0.388414502f},
-std::array<float,2>{0.913495362f, 0.72641927f},
-std::array<float,2>{0.529052496f, 0.111253962f},
-std::array<float,2>{0.170879483f, 0.880227029f},
-std::array<float,2>{0.0791956335f, 0.222666174f},
-std::array<float,2>{0.64313519f, 0.830582142f},
-std::array<float,2>{0.751076162f, 0.306252122f},
-std::array<float,2>{0.331454664f, 0.586368263f},
-std::array<float,2>{0.0447731614f, 0.314158857f},
-std::array<float,2>{0.748832405f, 0.50120753f},
-std::array<float,2>{0.865678728f, 0.140494242f},
-std::array<float,2>{0.288333178f, 0.787712574f},
-std::array<float,2>{0.478652835f, 0.0117504438f},
-std::array<float,2>{0.985185444f, 0.988371313f},
-std::array<float,2>{0.605325103f, 0.475233048f},
-std::array<float,2>{0.241515368f, 0.664986789f},
-std::array<float,2>{0.341964394f, 0.420371741f},
-std::array<float,2>{0.763742507f, 0.698082209f},
-std::array<float,2>{0.654404342f, 0.0856328681f},
-std::array<float,2>{0.0880822167f, 0.909115791f},
-std::array<float,2>{0.162249118f, 0.19570294f},
-std::array<float,2>{0.521812081f, 0.856835485f},
-std::array<float,2>{0.92060107f, 0.280551255f},
-std::array<float,2>{0.37972939f, 0.598827422f},
-std::array<float,2>{0.187516436f, 0.448802084f},
-std::array<float,2>{0.577037632f, 0.633057892f},
-std::array<float,2>{0.96244359f, 0.0511051826f},
-std::array<float,2>{0.466234028f, 0.955885231f},
-std::array<float,2>{0.250386804f, 0.166602299f},
-std::array<float,2>{0.829343319f, 0.758052886f},
-std::array<float,2>{0.691937745f, 0.355101347f},
-std::array<float,2>{0.0144857867f, 0.549639523f},
-std::array<float,2>{0.432603866f, 0.303824872f},
-std::array<float,2>{0.887958169f, 0.584258378f},
-std::array<float,2>{0.561120987f, 0.233430803f},
-std::array<float,2>{0.129096359f, 0.840473056f},
-std::array<float,2>{0.122358717f, 0.120893262f},
-std::array<float,2>{0.667235196f, 0.888961613f},
-std::array<float,2>{0.80653125f, 0.378699005f},
-std::array<float,2>{0.344711185f, 0.72854954f},
-std::array<float,2>{0.0696367547f, 0.392723024f},
-std::array<float,2>{0.634865642f, 0.748252511f},
-std::array<float,2>{0.766855776f, 0.0986951813f},
-std::array<float,2>{0.31340301f, 0.89412564f},
-std::array<float,2>{0.403975636f, 0.234867305f},
-std::array<float,2>{0.931385994f, 0.824711084f},
-std::array<float,2>{0.503542006f, 0.285320401f},
-std::array<float,2>{0.173655912f, 0.574581921f},
-std::array<float,2>{0.309690177f, 0.374793172f},
-std::array<float,2>{0.857846498f, 0.539342999f},
-std::array<float,2>{0.728028357f, 0.176365927f},
-std::array<float,2>{0.0492082313f, 0.766706049f},
-std::array<float,2>{0.224354491f, 0.0453284644f},
-std::array<float,2>{0.615248263f, 0.951919496f},
-std::array<float,2>{0.969693303f, 0.459115088f},
-std::array<float,2>{0.496829838f, 0.649414062f},
-std::array<float,2>{0.152016982f, 0.252544373f},
-std::array<float,2>{0.533443868f, 0.610467017f},
-std::array<float,2>{0.892327964f, 0.20900546f},
-std::array<float,2>{0.411826402f, 0.872393787f},
-std::array<float,2>{0.370850921f, 0.0715328529f},
-std::array<float,2>{0.791944504f, 0.925097287f},
-std::array<float,2>{0.676489711f, 0.425147116f},
-std::array<float,2>{0.101977825f, 0.708670497f},
-std::array<float,2>{0.449000001f, 0.488873363f},
-std::array<float,2>{0.949392617f, 0.67400986f},
-std::array<float,2>{0.583294451f, 0.0295969471f},
-std::array<float,2>{0.213010296f, 0.981122851f},
-std::array<float,2>{0.0286357179f, 0.146709993f},
-std::array<float,2>{0.715921402f, 0.810480773f},
-std::array<float,2>{0.822972357f, 0.333003074f},
-std::array<float,2>{0.28115502f, 0.519938171f}}
\ No newline at end of file
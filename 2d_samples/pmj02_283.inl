@@ -1,4096 +0,0 @@
-{std::array<float,2>{0.554880977f, 0.28051275f},
-std::array<float,2>{0.274416268f, 0.7501387f},
-std::array<float,2>{0.954770327f, 0.64799273f},
-std::array<float,2>{0.230656847f, 0.0528132841f},
-std::array<float,2>{0.805530548f, 0.136328623f},
-std::array<float,2>{0.100318506f, 0.52425772f},
-std::array<float,2>{0.625993252f, 0.963838279f},
-std::array<float,2>{0.421575576f, 0.432958096f},
-std::array<float,2>{0.890914202f, 0.484529704f},
-std::array<float,2>{0.150721624f, 0.917044938f},
-std::array<float,2>{0.578322709f, 0.597430289f},
-std::array<float,2>{0.319846869f, 0.219132915f},
-std::array<float,2>{0.698331594f, 0.0696695521f},
-std::array<float,2>{0.471374631f, 0.719107807f},
-std::array<float,2>{0.864192545f, 0.834258676f},
-std::array<float,2>{0.0331905112f, 0.351386517f},
-std::array<float,2>{0.680481791f, 0.378959864f},
-std::array<float,2>{0.378573686f, 0.99505949f},
-std::array<float,2>{0.779186487f, 0.555461705f},
-std::array<float,2>{0.0728223771f, 0.172727138f},
-std::array<float,2>{0.991652131f, 0.00939198583f},
-std::array<float,2>{0.202028751f, 0.679596245f},
-std::array<float,2>{0.502026439f, 0.808089375f},
-std::array<float,2>{0.308221787f, 0.289641172f},
-std::array<float,2>{0.83493489f, 0.320549071f},
-std::array<float,2>{0.0147753162f, 0.86030674f},
-std::array<float,2>{0.72482866f, 0.698731601f},
-std::array<float,2>{0.445336699f, 0.113669477f},
-std::array<float,2>{0.618164301f, 0.208832204f},
-std::array<float,2>{0.364242405f, 0.569797814f},
-std::array<float,2>{0.932903171f, 0.891097367f},
-std::array<float,2>{0.175814852f, 0.445142746f},
-std::array<float,2>{0.566707909f, 0.465141535f},
-std::array<float,2>{0.334741712f, 0.87525779f},
-std::array<float,2>{0.879519939f, 0.588434339f},
-std::array<float,2>{0.128644228f, 0.195514426f},
-std::array<float,2>{0.850996435f, 0.09628997f},
-std::array<float,2>{0.049673073f, 0.70601064f},
-std::array<float,2>{0.7108832f, 0.845257223f},
-std::array<float,2>{0.495355844f, 0.342137337f},
-std::array<float,2>{0.944698274f, 0.299147516f},
-std::array<float,2>{0.241750598f, 0.789757669f},
-std::array<float,2>{0.534358323f, 0.666181982f},
-std::array<float,2>{0.26293385f, 0.0184935909f},
-std::array<float,2>{0.645771563f, 0.164444655f},
-std::array<float,2>{0.430712312f, 0.536050498f},
-std::array<float,2>{0.795829296f, 0.970970571f},
-std::array<float,2>{0.112479933f, 0.394911557f},
-std::array<float,2>{0.744986832f, 0.369751304f},
-std::array<float,2>{0.464438051f, 0.818261743f},
-std::array<float,2>{0.816973805f, 0.738842547f},
-std::array<float,2>{0.0200062562f, 0.0799857154f},
-std::array<float,2>{0.909960508f, 0.239735663f},
-std::array<float,2>{0.157733813f, 0.620277941f},
-std::array<float,2>{0.598754168f, 0.931272864f},
-std::array<float,2>{0.349266648f, 0.477650374f},
-std::array<float,2>{0.76347065f, 0.419438094f},
-std::array<float,2>{0.0851045847f, 0.940127611f},
-std::array<float,2>{0.668591857f, 0.509742498f},
-std::array<float,2>{0.391298443f, 0.143285632f},
-std::array<float,2>{0.525571287f, 0.0344373882f},
-std::array<float,2>{0.28553915f, 0.632008553f},
-std::array<float,2>{0.974949539f, 0.776599348f},
-std::array<float,2>{0.218084827f, 0.252586782f},
-std::array<float,2>{0.607385755f, 0.329926848f},
-std::array<float,2>{0.354584038f, 0.854084492f},
-std::array<float,2>{0.920748711f, 0.716169953f},
-std::array<float,2>{0.16610086f, 0.10381607f},
-std::array<float,2>{0.82434845f, 0.188349143f},
-std::array<float,2>{0.0262407083f, 0.581951082f},
-std::array<float,2>{0.738113999f, 0.88491255f},
-std::array<float,2>{0.458914846f, 0.4547728f},
-std::array<float,2>{0.982592881f, 0.400128812f},
-std::array<float,2>{0.205873311f, 0.977133512f},
-std::array<float,2>{0.516763449f, 0.546867192f},
-std::array<float,2>{0.294430077f, 0.162651151f},
-std::array<float,2>{0.663830519f, 0.0258854032f},
-std::array<float,2>{0.400832057f, 0.661911368f},
-std::array<float,2>{0.751445472f, 0.785582483f},
-std::array<float,2>{0.0936112851f, 0.312072039f},
-std::array<float,2>{0.713598609f, 0.471725166f},
-std::array<float,2>{0.48622629f, 0.928217828f},
-std::array<float,2>{0.857056439f, 0.611713409f},
-std::array<float,2>{0.0572425686f, 0.246875778f},
-std::array<float,2>{0.887858093f, 0.0907431766f},
-std::array<float,2>{0.140287131f, 0.743121743f},
-std::array<float,2>{0.576206267f, 0.82316035f},
-std::array<float,2>{0.337410003f, 0.359782964f},
-std::array<float,2>{0.787890971f, 0.265463114f},
-std::array<float,2>{0.122424133f, 0.772405207f},
-std::array<float,2>{0.655326426f, 0.63938421f},
-std::array<float,2>{0.425130934f, 0.0443909913f},
-std::array<float,2>{0.541190743f, 0.150829077f},
-std::array<float,2>{0.254316866f, 0.504591227f},
-std::array<float,2>{0.951404393f, 0.952764273f},
-std::array<float,2>{0.243729129f, 0.410951048f},
-std::array<float,2>{0.511475623f, 0.423653424f},
-std::array<float,2>{0.300322145f, 0.959132671f},
-std::array<float,2>{0.999706507f, 0.518035233f},
-std::array<float,2>{0.190373987f, 0.127542078f},
-std::array<float,2>{0.767739654f, 0.0620155297f},
-std::array<float,2>{0.0668276101f, 0.648543179f},
-std::array<float,2>{0.679584861f, 0.764405847f},
-std::array<float,2>{0.38956213f, 0.268935412f},
-std::array<float,2>{0.925558984f, 0.353231013f},
-std::array<float,2>{0.187062636f, 0.839069068f},
-std::array<float,2>{0.611844063f, 0.730476141f},
-std::array<float,2>{0.373150617f, 0.0759411082f},
-std::array<float,2>{0.727193594f, 0.229447663f},
-std::array<float,2>{0.439592451f, 0.601575255f},
-std::array<float,2>{0.836512327f, 0.907020092f},
-std::array<float,2>{0.00424074102f, 0.496744573f},
-std::array<float,2>{0.634361029f, 0.286186755f},
-std::array<float,2>{0.40634954f, 0.797609568f},
-std::array<float,2>{0.803601027f, 0.681380391f},
-std::array<float,2>{0.102121487f, 0.00719997613f},
-std::array<float,2>{0.964617133f, 0.180000022f},
-std::array<float,2>{0.22506021f, 0.552352548f},
-std::array<float,2>{0.54691869f, 0.990981579f},
-std::array<float,2>{0.268294662f, 0.383298069f},
-std::array<float,2>{0.874580383f, 0.451230407f},
-std::array<float,2>{0.0428076722f, 0.898941755f},
-std::array<float,2>{0.687773764f, 0.577642798f},
-std::array<float,2>{0.47986114f, 0.211086825f},
-std::array<float,2>{0.589359224f, 0.1188052f},
-std::array<float,2>{0.323994726f, 0.688366592f},
-std::array<float,2>{0.905397534f, 0.873272657f},
-std::array<float,2>{0.144488931f, 0.319487303f},
-std::array<float,2>{0.582702398f, 0.306789041f},
-std::array<float,2>{0.312707543f, 0.781545997f},
-std::array<float,2>{0.89603442f, 0.658126414f},
-std::array<float,2>{0.154395267f, 0.0283847079f},
-std::array<float,2>{0.86101228f, 0.159857005f},
-std::array<float,2>{0.0383218229f, 0.542105854f},
-std::array<float,2>{0.702326357f, 0.982215285f},
-std::array<float,2>{0.474183589f, 0.403291613f},
-std::array<float,2>{0.958637655f, 0.460532188f},
-std::array<float,2>{0.227942273f, 0.88696599f},
-std::array<float,2>{0.561850309f, 0.584879696f},
-std::array<float,2>{0.279374391f, 0.193788216f},
-std::array<float,2>{0.631588817f, 0.107680336f},
-std::array<float,2>{0.415169179f, 0.712016344f},
-std::array<float,2>{0.809013784f, 0.856454134f},
-std::array<float,2>{0.095763579f, 0.332484215f},
-std::array<float,2>{0.721865296f, 0.409152687f},
-std::array<float,2>{0.450727284f, 0.946031928f},
-std::array<float,2>{0.828797579f, 0.502359748f},
-std::array<float,2>{0.00790150277f, 0.155355051f},
-std::array<float,2>{0.936322451f, 0.0417392924f},
-std::array<float,2>{0.173877627f, 0.632839203f},
-std::array<float,2>{0.624354839f, 0.767120361f},
-std::array<float,2>{0.361276239f, 0.25832966f},
-std::array<float,2>{0.776434004f, 0.366552234f},
-std::array<float,2>{0.075349398f, 0.827726841f},
-std::array<float,2>{0.686387539f, 0.747610509f},
-std::array<float,2>{0.378965169f, 0.0889797211f},
-std::array<float,2>{0.504348397f, 0.244839862f},
-std::array<float,2>{0.310168236f, 0.614873469f},
-std::array<float,2>{0.98556447f, 0.925201654f},
-std::array<float,2>{0.197736502f, 0.473803818f},
-std::array<float,2>{0.535576642f, 0.495136917f},
-std::array<float,2>{0.258638829f, 0.912505746f},
-std::array<float,2>{0.941081226f, 0.608720183f},
-std::array<float,2>{0.234670237f, 0.233400136f},
-std::array<float,2>{0.791968286f, 0.0732073113f},
-std::array<float,2>{0.11374943f, 0.72853297f},
-std::array<float,2>{0.640888512f, 0.841035247f},
-std::array<float,2>{0.437206775f, 0.357602566f},
-std::array<float,2>{0.875281751f, 0.271618009f},
-std::array<float,2>{0.130959392f, 0.761217535f},
-std::array<float,2>{0.565257251f, 0.654029846f},
-std::array<float,2>{0.330766529f, 0.0551017448f},
-std::array<float,2>{0.703171313f, 0.130453259f},
-std::array<float,2>{0.496244967f, 0.522432625f},
-std::array<float,2>{0.845549524f, 0.954993963f},
-std::array<float,2>{0.0545686893f, 0.427078068f},
-std::array<float,2>{0.665254354f, 0.31428805f},
-std::array<float,2>{0.3970128f, 0.867414773f},
-std::array<float,2>{0.761057198f, 0.693766534f},
-std::array<float,2>{0.0815448314f, 0.124719694f},
-std::array<float,2>{0.969396055f, 0.216385216f},
-std::array<float,2>{0.213190377f, 0.572594523f},
-std::array<float,2>{0.529297948f, 0.903675437f},
-std::array<float,2>{0.284225255f, 0.448254079f},
-std::array<float,2>{0.813082218f, 0.387526363f},
-std::array<float,2>{0.0192567781f, 0.98769176f},
-std::array<float,2>{0.74877727f, 0.547133744f},
-std::array<float,2>{0.467045754f, 0.186999619f},
-std::array<float,2>{0.596347749f, 0.00360364886f},
-std::array<float,2>{0.344942957f, 0.684503794f},
-std::array<float,2>{0.912673354f, 0.803983271f},
-std::array<float,2>{0.160933197f, 0.281669676f},
-std::array<float,2>{0.521436691f, 0.345802069f},
-std::array<float,2>{0.28943336f, 0.82863754f},
-std::array<float,2>{0.980059266f, 0.725284278f},
-std::array<float,2>{0.209097669f, 0.0659711361f},
-std::array<float,2>{0.753955662f, 0.223438218f},
-std::array<float,2>{0.0886718258f, 0.601035774f},
-std::array<float,2>{0.659947097f, 0.918080628f},
-std::array<float,2>{0.402819574f, 0.489607126f},
-std::array<float,2>{0.917386174f, 0.433607399f},
-std::array<float,2>{0.171523914f, 0.966782212f},
-std::array<float,2>{0.602320969f, 0.529507577f},
-std::array<float,2>{0.356137067f, 0.138210967f},
-std::array<float,2>{0.738796294f, 0.0475364178f},
-std::array<float,2>{0.454992712f, 0.642047465f},
-std::array<float,2>{0.821374476f, 0.755209744f},
-std::array<float,2>{0.0281986669f, 0.275703996f},
-std::array<float,2>{0.64846462f, 0.439344794f},
-std::array<float,2>{0.428959519f, 0.896040499f},
-std::array<float,2>{0.785131395f, 0.564592898f},
-std::array<float,2>{0.119027898f, 0.205822945f},
-std::array<float,2>{0.948062181f, 0.110467605f},
-std::array<float,2>{0.249301061f, 0.700115263f},
-std::array<float,2>{0.544977129f, 0.86553818f},
-std::array<float,2>{0.252073795f, 0.324548215f},
-std::array<float,2>{0.854387939f, 0.293189138f},
-std::array<float,2>{0.0593348444f, 0.809892595f},
-std::array<float,2>{0.71747458f, 0.673640192f},
-std::array<float,2>{0.490746617f, 0.011940009f},
-std::array<float,2>{0.571208179f, 0.178647429f},
-std::array<float,2>{0.341161489f, 0.561514676f},
-std::array<float,2>{0.885489345f, 0.998375118f},
-std::array<float,2>{0.132820532f, 0.377983093f},
-std::array<float,2>{0.614900947f, 0.391526043f},
-std::array<float,2>{0.369565785f, 0.972927392f},
-std::array<float,2>{0.926091909f, 0.534371316f},
-std::array<float,2>{0.179963365f, 0.170395985f},
-std::array<float,2>{0.841338694f, 0.0212275162f},
-std::array<float,2>{0.00269239792f, 0.668771625f},
-std::array<float,2>{0.730661094f, 0.794789255f},
-std::array<float,2>{0.441451639f, 0.304004878f},
-std::array<float,2>{0.994931817f, 0.33823961f},
-std::array<float,2>{0.191625148f, 0.848877847f},
-std::array<float,2>{0.5139907f, 0.707618713f},
-std::array<float,2>{0.303098083f, 0.10076727f},
-std::array<float,2>{0.672141135f, 0.201146618f},
-std::array<float,2>{0.385435522f, 0.592891932f},
-std::array<float,2>{0.770088375f, 0.881711721f},
-std::array<float,2>{0.0659579933f, 0.462870389f},
-std::array<float,2>{0.692995131f, 0.254944831f},
-std::array<float,2>{0.483561724f, 0.779264212f},
-std::array<float,2>{0.871077716f, 0.626836896f},
-std::array<float,2>{0.0457627736f, 0.0388300233f},
-std::array<float,2>{0.899307728f, 0.145927325f},
-std::array<float,2>{0.148178369f, 0.515517056f},
-std::array<float,2>{0.591072738f, 0.942078173f},
-std::array<float,2>{0.327096283f, 0.415819138f},
-std::array<float,2>{0.800010383f, 0.482243031f},
-std::array<float,2>{0.106032975f, 0.936619222f},
-std::array<float,2>{0.638839304f, 0.624688029f},
-std::array<float,2>{0.412317485f, 0.235395342f},
-std::array<float,2>{0.552717626f, 0.0839250982f},
-std::array<float,2>{0.271048456f, 0.736254692f},
-std::array<float,2>{0.966070712f, 0.81637305f},
-std::array<float,2>{0.221592054f, 0.374681264f},
-std::array<float,2>{0.500564456f, 0.292949319f},
-std::array<float,2>{0.306187123f, 0.804758489f},
-std::array<float,2>{0.989975512f, 0.676699221f},
-std::array<float,2>{0.200738102f, 0.0108883018f},
-std::array<float,2>{0.779453874f, 0.175082982f},
-std::array<float,2>{0.0717120022f, 0.556822002f},
-std::array<float,2>{0.683537006f, 0.992767751f},
-std::array<float,2>{0.376550853f, 0.380991787f},
-std::array<float,2>{0.92969048f, 0.443017185f},
-std::array<float,2>{0.177836984f, 0.892794847f},
-std::array<float,2>{0.619629681f, 0.566468298f},
-std::array<float,2>{0.366130918f, 0.209421456f},
-std::array<float,2>{0.724034488f, 0.115513258f},
-std::array<float,2>{0.447435349f, 0.697089255f},
-std::array<float,2>{0.833427548f, 0.861351609f},
-std::array<float,2>{0.0131657831f, 0.32321471f},
-std::array<float,2>{0.627722979f, 0.430389792f},
-std::array<float,2>{0.41929692f, 0.962351263f},
-std::array<float,2>{0.806904674f, 0.526952386f},
-std::array<float,2>{0.097667776f, 0.133315623f},
-std::array<float,2>{0.956151128f, 0.0524961092f},
-std::array<float,2>{0.232741803f, 0.645160437f},
-std::array<float,2>{0.55684799f, 0.753143013f},
-std::array<float,2>{0.276889145f, 0.279045731f},
-std::array<float,2>{0.866605878f, 0.349599093f},
-std::array<float,2>{0.0332412347f, 0.832679808f},
-std::array<float,2>{0.696864545f, 0.722155094f},
-std::array<float,2>{0.469835401f, 0.0670066476f},
-std::array<float,2>{0.580297351f, 0.22184445f},
-std::array<float,2>{0.317700088f, 0.594024539f},
-std::array<float,2>{0.892646134f, 0.915793121f},
-std::array<float,2>{0.148550272f, 0.487360209f},
-std::array<float,2>{0.600147486f, 0.479396105f},
-std::array<float,2>{0.350280374f, 0.931846499f},
-std::array<float,2>{0.907763779f, 0.617693722f},
-std::array<float,2>{0.159111902f, 0.241195828f},
-std::array<float,2>{0.81902945f, 0.0816671774f},
-std::array<float,2>{0.0218675509f, 0.740332305f},
-std::array<float,2>{0.742598832f, 0.818686247f},
-std::array<float,2>{0.462029904f, 0.367816657f},
-std::array<float,2>{0.974590957f, 0.25075984f},
-std::array<float,2>{0.214990646f, 0.775167286f},
-std::array<float,2>{0.524616003f, 0.629857063f},
-std::array<float,2>{0.288279325f, 0.0330069438f},
-std::array<float,2>{0.670693576f, 0.142105073f},
-std::array<float,2>{0.39334023f, 0.509795427f},
-std::array<float,2>{0.765163779f, 0.938063085f},
-std::array<float,2>{0.0828085765f, 0.421268046f},
-std::array<float,2>{0.707201898f, 0.340130627f},
-std::array<float,2>{0.493664652f, 0.846860588f},
-std::array<float,2>{0.848744273f, 0.703404307f},
-std::array<float,2>{0.0474607237f, 0.0954210088f},
-std::array<float,2>{0.882640481f, 0.197576076f},
-std::array<float,2>{0.125209942f, 0.587798357f},
-std::array<float,2>{0.569439828f, 0.877890408f},
-std::array<float,2>{0.33318904f, 0.467497587f},
-std::array<float,2>{0.7946558f, 0.398215711f},
-std::array<float,2>{0.110960685f, 0.969612896f},
-std::array<float,2>{0.646645606f, 0.539001882f},
-std::array<float,2>{0.433186889f, 0.167218715f},
-std::array<float,2>{0.532295585f, 0.0164376739f},
-std::array<float,2>{0.26477614f, 0.665237188f},
-std::array<float,2>{0.942070782f, 0.791603327f},
-std::array<float,2>{0.23954092f, 0.297366142f},
-std::array<float,2>{0.575205684f, 0.362540185f},
-std::array<float,2>{0.33933416f, 0.822125912f},
-std::array<float,2>{0.889708817f, 0.744692862f},
-std::array<float,2>{0.137879848f, 0.0932307169f},
-std::array<float,2>{0.857653618f, 0.248806059f},
-std::array<float,2>{0.0547698289f, 0.609571338f},
-std::array<float,2>{0.712567747f, 0.927262604f},
-std::array<float,2>{0.487811297f, 0.470528662f},
-std::array<float,2>{0.94955951f, 0.412851423f},
-std::array<float,2>{0.245469362f, 0.9505288f},
-std::array<float,2>{0.5403108f, 0.506295264f},
-std::array<float,2>{0.257123083f, 0.149532437f},
-std::array<float,2>{0.65395987f, 0.0450466685f},
-std::array<float,2>{0.422424406f, 0.638308167f},
-std::array<float,2>{0.785861909f, 0.770721495f},
-std::array<float,2>{0.124275006f, 0.262780041f},
-std::array<float,2>{0.734814644f, 0.45596084f},
-std::array<float,2>{0.460040987f, 0.884199798f},
-std::array<float,2>{0.82741046f, 0.578626692f},
-std::array<float,2>{0.0250613336f, 0.191342518f},
-std::array<float,2>{0.919913828f, 0.101728119f},
-std::array<float,2>{0.165101528f, 0.717369735f},
-std::array<float,2>{0.608439445f, 0.852941871f},
-std::array<float,2>{0.351729661f, 0.331339926f},
-std::array<float,2>{0.75318408f, 0.308708876f},
-std::array<float,2>{0.0916071758f, 0.788351774f},
-std::array<float,2>{0.661939204f, 0.663787067f},
-std::array<float,2>{0.400153339f, 0.0236923266f},
-std::array<float,2>{0.519467235f, 0.161216706f},
-std::array<float,2>{0.29536742f, 0.544406712f},
-std::array<float,2>{0.980661035f, 0.979431748f},
-std::array<float,2>{0.203588307f, 0.401558995f},
-std::array<float,2>{0.549279928f, 0.385162801f},
-std::array<float,2>{0.266839594f, 0.990026176f},
-std::array<float,2>{0.962108433f, 0.553191721f},
-std::array<float,2>{0.224387109f, 0.182535902f},
-std::array<float,2>{0.80104661f, 0.00490800571f},
-std::array<float,2>{0.10542053f, 0.683110535f},
-std::array<float,2>{0.636114478f, 0.800664604f},
-std::array<float,2>{0.408445328f, 0.288091481f},
-std::array<float,2>{0.902552903f, 0.317544818f},
-std::array<float,2>{0.142348677f, 0.87210536f},
-std::array<float,2>{0.586984336f, 0.691239297f},
-std::array<float,2>{0.321619809f, 0.119283356f},
-std::array<float,2>{0.689638257f, 0.214581236f},
-std::array<float,2>{0.478036255f, 0.57490164f},
-std::array<float,2>{0.872069657f, 0.902150273f},
-std::array<float,2>{0.0409034677f, 0.450947642f},
-std::array<float,2>{0.677673101f, 0.267414302f},
-std::array<float,2>{0.386943489f, 0.76261574f},
-std::array<float,2>{0.767081261f, 0.651419759f},
-std::array<float,2>{0.0685900524f, 0.0602566339f},
-std::array<float,2>{0.99784565f, 0.126555234f},
-std::array<float,2>{0.189336464f, 0.517255068f},
-std::array<float,2>{0.508227885f, 0.95786804f},
-std::array<float,2>{0.297530413f, 0.424178988f},
-std::array<float,2>{0.838156104f, 0.498298883f},
-std::array<float,2>{0.00589459622f, 0.909983099f},
-std::array<float,2>{0.728525639f, 0.605359435f},
-std::array<float,2>{0.438993245f, 0.227298498f},
-std::array<float,2>{0.610737264f, 0.0765966922f},
-std::array<float,2>{0.371210903f, 0.734228969f},
-std::array<float,2>{0.922109365f, 0.836660385f},
-std::array<float,2>{0.184533492f, 0.355001956f},
-std::array<float,2>{0.62300235f, 0.260647446f},
-std::array<float,2>{0.361681968f, 0.768080592f},
-std::array<float,2>{0.935450673f, 0.635121167f},
-std::array<float,2>{0.172049657f, 0.0399767198f},
-std::array<float,2>{0.830678582f, 0.152348056f},
-std::array<float,2>{0.0112567469f, 0.500367999f},
-std::array<float,2>{0.720020354f, 0.94744271f},
-std::array<float,2>{0.452317327f, 0.408196896f},
-std::array<float,2>{0.986981452f, 0.476203352f},
-std::array<float,2>{0.195573151f, 0.922679782f},
-std::array<float,2>{0.506061196f, 0.616404891f},
-std::array<float,2>{0.311656713f, 0.242464349f},
-std::array<float,2>{0.684410632f, 0.0867282599f},
-std::array<float,2>{0.382243842f, 0.748583257f},
-std::array<float,2>{0.774256766f, 0.825525165f},
-std::array<float,2>{0.0771538913f, 0.363883585f},
-std::array<float,2>{0.699355543f, 0.404763341f},
-std::array<float,2>{0.475310087f, 0.982576728f},
-std::array<float,2>{0.862944782f, 0.540515542f},
-std::array<float,2>{0.037025094f, 0.156742513f},
-std::array<float,2>{0.898060441f, 0.0303726587f},
-std::array<float,2>{0.153634816f, 0.659500301f},
-std::array<float,2>{0.585176229f, 0.78478229f},
-std::array<float,2>{0.315242678f, 0.306594104f},
-std::array<float,2>{0.811730564f, 0.334033787f},
-std::array<float,2>{0.0937866643f, 0.857794344f},
-std::array<float,2>{0.629651845f, 0.71477294f},
-std::array<float,2>{0.416155905f, 0.106337994f},
-std::array<float,2>{0.560473204f, 0.191854373f},
-std::array<float,2>{0.278758019f, 0.583503902f},
-std::array<float,2>{0.959789753f, 0.890051663f},
-std::array<float,2>{0.22855413f, 0.457175553f},
-std::array<float,2>{0.528900206f, 0.446335852f},
-std::array<float,2>{0.282533467f, 0.904666543f},
-std::array<float,2>{0.972562075f, 0.571979642f},
-std::array<float,2>{0.211175486f, 0.216982156f},
-std::array<float,2>{0.758292735f, 0.122712366f},
-std::array<float,2>{0.0798652247f, 0.692433417f},
-std::array<float,2>{0.666975737f, 0.870793998f},
-std::array<float,2>{0.394889206f, 0.314812154f},
-std::array<float,2>{0.91174674f, 0.283353567f},
-std::array<float,2>{0.162168637f, 0.80105406f},
-std::array<float,2>{0.594967663f, 0.686799884f},
-std::array<float,2>{0.347160548f, 0.00162571983f},
-std::array<float,2>{0.746330619f, 0.184286326f},
-std::array<float,2>{0.465087771f, 0.550129116f},
-std::array<float,2>{0.81586206f, 0.984452307f},
-std::array<float,2>{0.0164702795f, 0.389165372f},
-std::array<float,2>{0.644433975f, 0.355799764f},
-std::array<float,2>{0.434745967f, 0.842468619f},
-std::array<float,2>{0.78910625f, 0.727964699f},
-std::array<float,2>{0.115282729f, 0.0705628097f},
-std::array<float,2>{0.93863219f, 0.231730074f},
-std::array<float,2>{0.237759233f, 0.605896115f},
-std::array<float,2>{0.538201928f, 0.911253572f},
-std::array<float,2>{0.261473f, 0.493402928f},
-std::array<float,2>{0.847168922f, 0.428717434f},
-std::array<float,2>{0.0509495623f, 0.955652535f},
-std::array<float,2>{0.706879139f, 0.520047545f},
-std::array<float,2>{0.499546766f, 0.131002128f},
-std::array<float,2>{0.562732756f, 0.0571511053f},
-std::array<float,2>{0.329835773f, 0.655785859f},
-std::array<float,2>{0.877404094f, 0.758922279f},
-std::array<float,2>{0.129165441f, 0.270993739f},
-std::array<float,2>{0.543619275f, 0.326175869f},
-std::array<float,2>{0.25012219f, 0.863420188f},
-std::array<float,2>{0.945929468f, 0.701569736f},
-std::array<float,2>{0.247394145f, 0.112860516f},
-std::array<float,2>{0.783203006f, 0.203135058f},
-std::array<float,2>{0.120292008f, 0.564060569f},
-std::array<float,2>{0.650828958f, 0.897378147f},
-std::array<float,2>{0.426128536f, 0.440886915f},
-std::array<float,2>{0.883093655f, 0.375916243f},
-std::array<float,2>{0.1362762f, 0.997982442f},
-std::array<float,2>{0.573792994f, 0.559689939f},
-std::array<float,2>{0.342951894f, 0.177407846f},
-std::array<float,2>{0.716784179f, 0.0142325228f},
-std::array<float,2>{0.488314241f, 0.674087882f},
-std::array<float,2>{0.851976514f, 0.811383486f},
-std::array<float,2>{0.0622399189f, 0.295746684f},
-std::array<float,2>{0.656528533f, 0.491403848f},
-std::array<float,2>{0.405219555f, 0.921607554f},
-std::array<float,2>{0.755884528f, 0.598887026f},
-std::array<float,2>{0.0861265808f, 0.225525022f},
-std::array<float,2>{0.977026463f, 0.0631952807f},
-std::array<float,2>{0.207897842f, 0.723585188f},
-std::array<float,2>{0.523397923f, 0.831467688f},
-std::array<float,2>{0.291509449f, 0.345073491f},
-std::array<float,2>{0.824004531f, 0.274582803f},
-std::array<float,2>{0.0300384965f, 0.756239593f},
-std::array<float,2>{0.740409076f, 0.643928528f},
-std::array<float,2>{0.455092281f, 0.0500683002f},
-std::array<float,2>{0.60391748f, 0.140058175f},
-std::array<float,2>{0.357532293f, 0.528330326f},
-std::array<float,2>{0.915396512f, 0.966861188f},
-std::array<float,2>{0.168504819f, 0.435609251f},
-std::array<float,2>{0.592548072f, 0.41740796f},
-std::array<float,2>{0.324420661f, 0.944874048f},
-std::array<float,2>{0.90065819f, 0.51270777f},
-std::array<float,2>{0.145176023f, 0.147345468f},
-std::array<float,2>{0.868176997f, 0.0369749144f},
-std::array<float,2>{0.0447217487f, 0.628755987f},
-std::array<float,2>{0.695189178f, 0.781096876f},
-std::array<float,2>{0.481241167f, 0.25751406f},
-std::array<float,2>{0.96761024f, 0.371371955f},
-std::array<float,2>{0.219753459f, 0.813278019f},
-std::array<float,2>{0.55354923f, 0.738090336f},
-std::array<float,2>{0.27201277f, 0.0854947567f},
-std::array<float,2>{0.638383627f, 0.237880245f},
-std::array<float,2>{0.410904706f, 0.621407449f},
-std::array<float,2>{0.798557818f, 0.93483001f},
-std::array<float,2>{0.107544854f, 0.483271241f},
-std::array<float,2>{0.732997894f, 0.300979823f},
-std::array<float,2>{0.445174098f, 0.796699286f},
-std::array<float,2>{0.843050301f, 0.671345174f},
-std::array<float,2>{0.00186454679f, 0.022415759f},
-std::array<float,2>{0.929068506f, 0.168319687f},
-std::array<float,2>{0.18247138f, 0.532226324f},
-std::array<float,2>{0.616778314f, 0.975414932f},
-std::array<float,2>{0.367628902f, 0.394337535f},
-std::array<float,2>{0.772425234f, 0.463126063f},
-std::array<float,2>{0.0635364726f, 0.880189836f},
-std::array<float,2>{0.675579846f, 0.590605378f},
-std::array<float,2>{0.38296178f, 0.203056917f},
-std::array<float,2>{0.511914492f, 0.0989912674f},
-std::array<float,2>{0.300920665f, 0.71001631f},
-std::array<float,2>{0.993098974f, 0.850726962f},
-std::array<float,2>{0.194459155f, 0.337488115f},
-std::array<float,2>{0.533894002f, 0.298296452f},
-std::array<float,2>{0.261814803f, 0.792314708f},
-std::array<float,2>{0.943401992f, 0.664726734f},
-std::array<float,2>{0.24040179f, 0.0166846681f},
-std::array<float,2>{0.796703458f, 0.16636695f},
-std::array<float,2>{0.112132557f, 0.537698328f},
-std::array<float,2>{0.644581974f, 0.970337451f},
-std::array<float,2>{0.43010664f, 0.397233129f},
-std::array<float,2>{0.880668223f, 0.468087465f},
-std::array<float,2>{0.12741679f, 0.877997696f},
-std::array<float,2>{0.568223f, 0.586122632f},
-std::array<float,2>{0.335311323f, 0.198414832f},
-std::array<float,2>{0.709603846f, 0.0939569324f},
-std::array<float,2>{0.49498558f, 0.704498529f},
-std::array<float,2>{0.849901497f, 0.845996559f},
-std::array<float,2>{0.0507124253f, 0.341712832f},
-std::array<float,2>{0.6692186f, 0.4205167f},
-std::array<float,2>{0.391831607f, 0.938718379f},
-std::array<float,2>{0.762036085f, 0.511240542f},
-std::array<float,2>{0.0843787193f, 0.140861586f},
-std::array<float,2>{0.975965559f, 0.0314459614f},
-std::array<float,2>{0.217012808f, 0.630137146f},
-std::array<float,2>{0.526380241f, 0.773948908f},
-std::array<float,2>{0.286286294f, 0.251044899f},
-std::array<float,2>{0.817485571f, 0.368324846f},
-std::array<float,2>{0.0212404635f, 0.820050359f},
-std::array<float,2>{0.746068299f, 0.741403341f},
-std::array<float,2>{0.463120222f, 0.0804210156f},
-std::array<float,2>{0.598261058f, 0.241405025f},
-std::array<float,2>{0.348603129f, 0.618836522f},
-std::array<float,2>{0.908242285f, 0.933190942f},
-std::array<float,2>{0.156597301f, 0.480165184f},
-std::array<float,2>{0.579621315f, 0.487278134f},
-std::array<float,2>{0.318778872f, 0.914991796f},
-std::array<float,2>{0.891662955f, 0.594831467f},
-std::array<float,2>{0.152085081f, 0.22081691f},
-std::array<float,2>{0.864676774f, 0.0674883947f},
-std::array<float,2>{0.0317051858f, 0.721125066f},
-std::array<float,2>{0.697916925f, 0.833729982f},
-std::array<float,2>{0.472527862f, 0.348417848f},
-std::array<float,2>{0.953276813f, 0.278001398f},
-std::array<float,2>{0.231787488f, 0.752434492f},
-std::array<float,2>{0.555718243f, 0.645797312f},
-std::array<float,2>{0.273562491f, 0.0509132408f},
-std::array<float,2>{0.625648737f, 0.134009585f},
-std::array<float,2>{0.420485407f, 0.525942504f},
-std::array<float,2>{0.806346297f, 0.961474657f},
-std::array<float,2>{0.10117577f, 0.43111816f},
-std::array<float,2>{0.726401985f, 0.323732316f},
-std::array<float,2>{0.44688946f, 0.862446845f},
-std::array<float,2>{0.835605681f, 0.696062744f},
-std::array<float,2>{0.0145247485f, 0.116313271f},
-std::array<float,2>{0.931746066f, 0.210558325f},
-std::array<float,2>{0.177009821f, 0.568057418f},
-std::array<float,2>{0.617768705f, 0.894010901f},
-std::array<float,2>{0.365080595f, 0.441678435f},
-std::array<float,2>{0.77815032f, 0.38262248f},
-std::array<float,2>{0.0733986944f, 0.993816912f},
-std::array<float,2>{0.681112885f, 0.558160305f},
-std::array<float,2>{0.377199709f, 0.174565196f},
-std::array<float,2>{0.503100276f, 0.0104441019f},
-std::array<float,2>{0.307412744f, 0.676854849f},
-std::array<float,2>{0.990977347f, 0.806009412f},
-std::array<float,2>{0.20230107f, 0.291626871f},
-std::array<float,2>{0.612546206f, 0.354159176f},
-std::array<float,2>{0.374337643f, 0.83779788f},
-std::array<float,2>{0.924133718f, 0.733152807f},
-std::array<float,2>{0.186021909f, 0.0778260455f},
-std::array<float,2>{0.837286711f, 0.227990881f},
-std::array<float,2>{0.00490241451f, 0.603583455f},
-std::array<float,2>{0.727785826f, 0.908836901f},
-std::array<float,2>{0.441145092f, 0.499960929f},
-std::array<float,2>{0.99816817f, 0.425758958f},
-std::array<float,2>{0.191254228f, 0.95877403f},
-std::array<float,2>{0.509808362f, 0.516060233f},
-std::array<float,2>{0.298936993f, 0.125084639f},
-std::array<float,2>{0.678245604f, 0.0590166859f},
-std::array<float,2>{0.390292555f, 0.651103795f},
-std::array<float,2>{0.769022107f, 0.763389885f},
-std::array<float,2>{0.0681883097f, 0.266371936f},
-std::array<float,2>{0.689117968f, 0.449380368f},
-std::array<float,2>{0.479186445f, 0.901358604f},
-std::array<float,2>{0.873892426f, 0.575910866f},
-std::array<float,2>{0.0415493101f, 0.213173494f},
-std::array<float,2>{0.904350817f, 0.120968156f},
-std::array<float,2>{0.143553719f, 0.689527154f},
-std::array<float,2>{0.588350832f, 0.871308386f},
-std::array<float,2>{0.322515756f, 0.316473991f},
-std::array<float,2>{0.804556429f, 0.287545323f},
-std::array<float,2>{0.103381298f, 0.799067378f},
-std::array<float,2>{0.633598626f, 0.681877136f},
-std::array<float,2>{0.407575369f, 0.00440485403f},
-std::array<float,2>{0.548261046f, 0.183263481f},
-std::array<float,2>{0.268928498f, 0.553817928f},
-std::array<float,2>{0.963316262f, 0.988296092f},
-std::array<float,2>{0.225836217f, 0.385984033f},
-std::array<float,2>{0.516562939f, 0.400972337f},
-std::array<float,2>{0.293006688f, 0.979628563f},
-std::array<float,2>{0.983915269f, 0.543656051f},
-std::array<float,2>{0.206151515f, 0.160632834f},
-std::array<float,2>{0.750212371f, 0.024551915f},
-std::array<float,2>{0.0921383575f, 0.662385225f},
-std::array<float,2>{0.662933171f, 0.787346721f},
-std::array<float,2>{0.401875466f, 0.310256183f},
-std::array<float,2>{0.921305001f, 0.330470592f},
-std::array<float,2>{0.167918757f, 0.852494717f},
-std::array<float,2>{0.606431186f, 0.718030035f},
-std::array<float,2>{0.353762984f, 0.102687739f},
-std::array<float,2>{0.737255931f, 0.190248325f},
-std::array<float,2>{0.457083941f, 0.579478264f},
-std::array<float,2>{0.825556457f, 0.883058667f},
-std::array<float,2>{0.0266313497f, 0.456603765f},
-std::array<float,2>{0.654587924f, 0.261728883f},
-std::array<float,2>{0.424432755f, 0.769788146f},
-std::array<float,2>{0.789013505f, 0.636914074f},
-std::array<float,2>{0.121256202f, 0.0468366444f},
-std::array<float,2>{0.952805996f, 0.148910999f},
-std::array<float,2>{0.243003264f, 0.507681251f},
-std::array<float,2>{0.542462885f, 0.949838042f},
-std::array<float,2>{0.255770653f, 0.413747251f},
-std::array<float,2>{0.85562104f, 0.469298333f},
-std::array<float,2>{0.0582897291f, 0.926181138f},
-std::array<float,2>{0.714506149f, 0.610451758f},
-std::array<float,2>{0.48477596f, 0.249877751f},
-std::array<float,2>{0.577450871f, 0.0921516567f},
-std::array<float,2>{0.336901575f, 0.745739698f},
-std::array<float,2>{0.887291908f, 0.820605278f},
-std::array<float,2>{0.139442667f, 0.361831605f},
-std::array<float,2>{0.565716445f, 0.270352364f},
-std::array<float,2>{0.33145982f, 0.758685648f},
-std::array<float,2>{0.876935065f, 0.655116081f},
-std::array<float,2>{0.13205269f, 0.0579532534f},
-std::array<float,2>{0.844190121f, 0.132583946f},
-std::array<float,2>{0.0535522215f, 0.520764709f},
-std::array<float,2>{0.705014288f, 0.957001686f},
-std::array<float,2>{0.497506946f, 0.428152293f},
-std::array<float,2>{0.940138817f, 0.492434919f},
-std::array<float,2>{0.236074656f, 0.910483479f},
-std::array<float,2>{0.53630209f, 0.607314527f},
-std::array<float,2>{0.259399951f, 0.230619892f},
-std::array<float,2>{0.642471492f, 0.071848534f},
-std::array<float,2>{0.435715616f, 0.727110505f},
-std::array<float,2>{0.79221338f, 0.843181789f},
-std::array<float,2>{0.11491596f, 0.357004791f},
-std::array<float,2>{0.749197602f, 0.39057222f},
-std::array<float,2>{0.46797958f, 0.985622644f},
-std::array<float,2>{0.8142097f, 0.549250603f},
-std::array<float,2>{0.0183569584f, 0.185505673f},
-std::array<float,2>{0.913090646f, 0.000709010754f},
-std::array<float,2>{0.161934763f, 0.686279714f},
-std::array<float,2>{0.597646475f, 0.80248934f},
-std::array<float,2>{0.343905628f, 0.284589767f},
-std::array<float,2>{0.759932637f, 0.315965414f},
-std::array<float,2>{0.0802647322f, 0.869441628f},
-std::array<float,2>{0.664800823f, 0.691523731f},
-std::array<float,2>{0.397539943f, 0.121886805f},
-std::array<float,2>{0.530806541f, 0.218049809f},
-std::array<float,2>{0.283311248f, 0.570504069f},
-std::array<float,2>{0.969737232f, 0.905978084f},
-std::array<float,2>{0.214555532f, 0.446115285f},
-std::array<float,2>{0.561185181f, 0.458046168f},
-std::array<float,2>{0.281230271f, 0.889518917f},
-std::array<float,2>{0.957109272f, 0.582735598f},
-std::array<float,2>{0.226766467f, 0.192944154f},
-std::array<float,2>{0.809842408f, 0.107133262f},
-std::array<float,2>{0.097348839f, 0.713319361f},
-std::array<float,2>{0.632289827f, 0.859304309f},
-std::array<float,2>{0.414757013f, 0.335712731f},
-std::array<float,2>{0.894699872f, 0.30500105f},
-std::array<float,2>{0.155388504f, 0.78415966f},
-std::array<float,2>{0.583143771f, 0.658727109f},
-std::array<float,2>{0.314014792f, 0.0298078973f},
-std::array<float,2>{0.701368093f, 0.158050075f},
-std::array<float,2>{0.473578006f, 0.539384305f},
-std::array<float,2>{0.860329628f, 0.984009206f},
-std::array<float,2>{0.0375008546f, 0.405318797f},
-std::array<float,2>{0.687290668f, 0.365133256f},
-std::array<float,2>{0.380676627f, 0.824584544f},
-std::array<float,2>{0.775395751f, 0.749895334f},
-std::array<float,2>{0.0748302937f, 0.0876176134f},
-std::array<float,2>{0.984387517f, 0.243743464f},
-std::array<float,2>{0.19838357f, 0.616014361f},
-std::array<float,2>{0.505035102f, 0.923618972f},
-std::array<float,2>{0.308780223f, 0.474790931f},
-std::array<float,2>{0.829735518f, 0.407097399f},
-std::array<float,2>{0.00907593407f, 0.948250949f},
-std::array<float,2>{0.721219361f, 0.500992596f},
-std::array<float,2>{0.449824244f, 0.154050052f},
-std::array<float,2>{0.62323606f, 0.0405813083f},
-std::array<float,2>{0.359950691f, 0.636245131f},
-std::array<float,2>{0.936811984f, 0.76868403f},
-std::array<float,2>{0.175296426f, 0.260962993f},
-std::array<float,2>{0.514948368f, 0.336884141f},
-std::array<float,2>{0.304053932f, 0.850396991f},
-std::array<float,2>{0.995907843f, 0.709296465f},
-std::array<float,2>{0.193249121f, 0.0986032262f},
-std::array<float,2>{0.771190524f, 0.201674387f},
-std::array<float,2>{0.0647693649f, 0.591262996f},
-std::array<float,2>{0.673112392f, 0.879366219f},
-std::array<float,2>{0.386317581f, 0.464210838f},
-std::array<float,2>{0.927024543f, 0.392803729f},
-std::array<float,2>{0.181121856f, 0.975747585f},
-std::array<float,2>{0.614011943f, 0.533194482f},
-std::array<float,2>{0.37090376f, 0.169583261f},
-std::array<float,2>{0.732263327f, 0.0232829694f},
-std::array<float,2>{0.442545176f, 0.670733631f},
-std::array<float,2>{0.839931667f, 0.795479774f},
-std::array<float,2>{0.00305505726f, 0.302332699f},
-std::array<float,2>{0.640077949f, 0.483790994f},
-std::array<float,2>{0.413207084f, 0.934567809f},
-std::array<float,2>{0.799309671f, 0.622949243f},
-std::array<float,2>{0.106571138f, 0.236871094f},
-std::array<float,2>{0.965281248f, 0.0847195014f},
-std::array<float,2>{0.221819431f, 0.736716628f},
-std::array<float,2>{0.551096797f, 0.814142644f},
-std::array<float,2>{0.269926995f, 0.372725308f},
-std::array<float,2>{0.870055676f, 0.255950272f},
-std::array<float,2>{0.0466348343f, 0.780058503f},
-std::array<float,2>{0.69227159f, 0.627555668f},
-std::array<float,2>{0.483264893f, 0.0353587195f},
-std::array<float,2>{0.590333998f, 0.147973597f},
-std::array<float,2>{0.328108728f, 0.511915743f},
-std::array<float,2>{0.89989686f, 0.943851769f},
-std::array<float,2>{0.146994829f, 0.416044414f},
-std::array<float,2>{0.602942109f, 0.436796576f},
-std::array<float,2>{0.357328385f, 0.967803776f},
-std::array<float,2>{0.91627866f, 0.527471423f},
-std::array<float,2>{0.170424476f, 0.138946295f},
-std::array<float,2>{0.820772111f, 0.0494550839f},
-std::array<float,2>{0.0288084913f, 0.643271565f},
-std::array<float,2>{0.739372253f, 0.757203281f},
-std::array<float,2>{0.453330278f, 0.274363607f},
-std::array<float,2>{0.978866756f, 0.344012827f},
-std::array<float,2>{0.210733742f, 0.830646455f},
-std::array<float,2>{0.51974088f, 0.724368691f},
-std::array<float,2>{0.290412843f, 0.0639335364f},
-std::array<float,2>{0.658784091f, 0.226095766f},
-std::array<float,2>{0.404203027f, 0.598107874f},
-std::array<float,2>{0.75561893f, 0.920295238f},
-std::array<float,2>{0.0894066617f, 0.490840316f},
-std::array<float,2>{0.718402982f, 0.29683736f},
-std::array<float,2>{0.492087275f, 0.811794102f},
-std::array<float,2>{0.855331123f, 0.675019085f},
-std::array<float,2>{0.0604336783f, 0.015231573f},
-std::array<float,2>{0.886484683f, 0.176418602f},
-std::array<float,2>{0.13431187f, 0.558643937f},
-std::array<float,2>{0.571810365f, 0.99621129f},
-std::array<float,2>{0.340548068f, 0.376819909f},
-std::array<float,2>{0.783629537f, 0.439798504f},
-std::array<float,2>{0.117533594f, 0.897914886f},
-std::array<float,2>{0.649986863f, 0.563018024f},
-std::array<float,2>{0.42833668f, 0.204972565f},
-std::array<float,2>{0.546014905f, 0.112043783f},
-std::array<float,2>{0.253324032f, 0.702250242f},
-std::array<float,2>{0.948872328f, 0.8649351f},
-std::array<float,2>{0.248906419f, 0.328105062f},
-std::array<float,2>{0.523930371f, 0.253145337f},
-std::array<float,2>{0.287847102f, 0.775955081f},
-std::array<float,2>{0.972792029f, 0.631745458f},
-std::array<float,2>{0.216040656f, 0.0333573557f},
-std::array<float,2>{0.764440119f, 0.143727586f},
-std::array<float,2>{0.0834224448f, 0.508232951f},
-std::array<float,2>{0.671503246f, 0.940850258f},
-std::array<float,2>{0.393921912f, 0.418474317f},
-std::array<float,2>{0.907100081f, 0.476642102f},
-std::array<float,2>{0.159188867f, 0.930580676f},
-std::array<float,2>{0.601442099f, 0.61971885f},
-std::array<float,2>{0.350907534f, 0.239206657f},
-std::array<float,2>{0.743384242f, 0.0790262222f},
-std::array<float,2>{0.461065292f, 0.740158558f},
-std::array<float,2>{0.819939256f, 0.81685847f},
-std::array<float,2>{0.023036778f, 0.370424628f},
-std::array<float,2>{0.648072362f, 0.395575106f},
-std::array<float,2>{0.432554185f, 0.971921027f},
-std::array<float,2>{0.793866754f, 0.537035942f},
-std::array<float,2>{0.109942466f, 0.165312648f},
-std::array<float,2>{0.942790449f, 0.0194522105f},
-std::array<float,2>{0.238562167f, 0.667015493f},
-std::array<float,2>{0.532037854f, 0.790900409f},
-std::array<float,2>{0.26432839f, 0.300143629f},
-std::array<float,2>{0.848621249f, 0.343144119f},
-std::array<float,2>{0.0484073535f, 0.84408915f},
-std::array<float,2>{0.708775043f, 0.706756711f},
-std::array<float,2>{0.492627263f, 0.0968856514f},
-std::array<float,2>{0.568494081f, 0.196644768f},
-std::array<float,2>{0.332113028f, 0.589142323f},
-std::array<float,2>{0.881397009f, 0.876252592f},
-std::array<float,2>{0.126856655f, 0.466440558f},
-std::array<float,2>{0.6204319f, 0.444200605f},
-std::array<float,2>{0.366624475f, 0.891926527f},
-std::array<float,2>{0.931368947f, 0.56841588f},
-std::array<float,2>{0.179633677f, 0.207961336f},
-std::array<float,2>{0.8322559f, 0.114510737f},
-std::array<float,2>{0.0119667687f, 0.698214293f},
-std::array<float,2>{0.723250747f, 0.860753179f},
-std::array<float,2>{0.448527992f, 0.322250903f},
-std::array<float,2>{0.988665938f, 0.290774971f},
-std::array<float,2>{0.199912414f, 0.806666136f},
-std::array<float,2>{0.501445532f, 0.678312898f},
-std::array<float,2>{0.304836005f, 0.00861308258f},
-std::array<float,2>{0.681898057f, 0.173155487f},
-std::array<float,2>{0.375277489f, 0.556116581f},
-std::array<float,2>{0.780362725f, 0.995167077f},
-std::array<float,2>{0.0703428909f, 0.380020469f},
-std::array<float,2>{0.695984304f, 0.350221455f},
-std::array<float,2>{0.469515562f, 0.835865498f},
-std::array<float,2>{0.866023898f, 0.720671117f},
-std::array<float,2>{0.0345866233f, 0.0686783642f},
-std::array<float,2>{0.894523382f, 0.219896495f},
-std::array<float,2>{0.149643466f, 0.595922172f},
-std::array<float,2>{0.581680894f, 0.916435421f},
-std::array<float,2>{0.316991806f, 0.485825717f},
-std::array<float,2>{0.80809778f, 0.432386249f},
-std::array<float,2>{0.0993349031f, 0.964264452f},
-std::array<float,2>{0.62812978f, 0.525105715f},
-std::array<float,2>{0.418790907f, 0.134851247f},
-std::array<float,2>{0.557787597f, 0.0540091656f},
-std::array<float,2>{0.276109695f, 0.647258997f},
-std::array<float,2>{0.955769479f, 0.751844645f},
-std::array<float,2>{0.233708605f, 0.27999106f},
-std::array<float,2>{0.586250484f, 0.319214791f},
-std::array<float,2>{0.321218371f, 0.874611497f},
-std::array<float,2>{0.903527021f, 0.68913734f},
-std::array<float,2>{0.141023353f, 0.117242001f},
-std::array<float,2>{0.872740149f, 0.212600783f},
-std::array<float,2>{0.0397056267f, 0.577096999f},
-std::array<float,2>{0.691349924f, 0.900369108f},
-std::array<float,2>{0.477251023f, 0.452661246f},
-std::array<float,2>{0.961077273f, 0.383943051f},
-std::array<float,2>{0.22321865f, 0.99141258f},
-std::array<float,2>{0.550776064f, 0.551616669f},
-std::array<float,2>{0.266107917f, 0.181390956f},
-std::array<float,2>{0.635167122f, 0.00657742005f},
-std::array<float,2>{0.409633845f, 0.680069387f},
-std::array<float,2>{0.802661419f, 0.797948837f},
-std::array<float,2>{0.104448639f, 0.285756707f},
-std::array<float,2>{0.730095506f, 0.497543573f},
-std::array<float,2>{0.437807292f, 0.907900095f},
-std::array<float,2>{0.839794993f, 0.602796853f},
-std::array<float,2>{0.00700558396f, 0.229623914f},
-std::array<float,2>{0.923056304f, 0.0750243738f},
-std::array<float,2>{0.184978783f, 0.732165694f},
-std::array<float,2>{0.610023916f, 0.837963402f},
-std::array<float,2>{0.372965604f, 0.351982087f},
-std::array<float,2>{0.766139984f, 0.268296063f},
-std::array<float,2>{0.0697259307f, 0.765140176f},
-std::array<float,2>{0.676555336f, 0.650190711f},
-std::array<float,2>{0.388640225f, 0.0614485331f},
-std::array<float,2>{0.5093171f, 0.128692552f},
-std::array<float,2>{0.298215061f, 0.518809497f},
-std::array<float,2>{0.996623635f, 0.960637867f},
-std::array<float,2>{0.187917307f, 0.421896547f},
-std::array<float,2>{0.539405286f, 0.411552757f},
-std::array<float,2>{0.256326348f, 0.951953232f},
-std::array<float,2>{0.950396061f, 0.505814373f},
-std::array<float,2>{0.244811893f, 0.152036503f},
-std::array<float,2>{0.786164343f, 0.0437301435f},
-std::array<float,2>{0.123486519f, 0.64050132f},
-std::array<float,2>{0.653232396f, 0.772856295f},
-std::array<float,2>{0.423186719f, 0.263957351f},
-std::array<float,2>{0.889186323f, 0.361252874f},
-std::array<float,2>{0.137516066f, 0.82403338f},
-std::array<float,2>{0.574713528f, 0.744047582f},
-std::array<float,2>{0.338636607f, 0.0914642587f},
-std::array<float,2>{0.711490691f, 0.247238874f},
-std::array<float,2>{0.487150192f, 0.61254555f},
-std::array<float,2>{0.858659923f, 0.929247797f},
-std::array<float,2>{0.0557333715f, 0.4709149f},
-std::array<float,2>{0.660605013f, 0.311365277f},
-std::array<float,2>{0.399353057f, 0.786982417f},
-std::array<float,2>{0.752123654f, 0.661008596f},
-std::array<float,2>{0.0904237479f, 0.0269396231f},
-std::array<float,2>{0.98225075f, 0.163397044f},
-std::array<float,2>{0.204542086f, 0.545646131f},
-std::array<float,2>{0.517833292f, 0.977571785f},
-std::array<float,2>{0.296799392f, 0.398902804f},
-std::array<float,2>{0.826522827f, 0.45344004f},
-std::array<float,2>{0.0237100907f, 0.886425316f},
-std::array<float,2>{0.736005425f, 0.580823064f},
-std::array<float,2>{0.459605813f, 0.189445242f},
-std::array<float,2>{0.607538939f, 0.105294071f},
-std::array<float,2>{0.352971673f, 0.715169787f},
-std::array<float,2>{0.918853402f, 0.855347395f},
-std::array<float,2>{0.164150238f, 0.32856831f},
-std::array<float,2>{0.594122946f, 0.282422155f},
-std::array<float,2>{0.346255511f, 0.803509772f},
-std::array<float,2>{0.91055268f, 0.684769988f},
-std::array<float,2>{0.163848177f, 0.00219340646f},
-std::array<float,2>{0.814988434f, 0.186039761f},
-std::array<float,2>{0.0166313257f, 0.5478549f},
-std::array<float,2>{0.747475147f, 0.986585557f},
-std::array<float,2>{0.466081083f, 0.387852877f},
-std::array<float,2>{0.970968187f, 0.44804135f},
-std::array<float,2>{0.212036431f, 0.902790964f},
-std::array<float,2>{0.527346373f, 0.574210942f},
-std::array<float,2>{0.281637728f, 0.215705186f},
-std::array<float,2>{0.667190671f, 0.123386227f},
-std::array<float,2>{0.396044284f, 0.695307732f},
-std::array<float,2>{0.759088039f, 0.869136095f},
-std::array<float,2>{0.078682065f, 0.312977284f},
-std::array<float,2>{0.705226064f, 0.425909311f},
-std::array<float,2>{0.498906851f, 0.954008758f},
-std::array<float,2>{0.845765471f, 0.522873402f},
-std::array<float,2>{0.0520346388f, 0.129711345f},
-std::array<float,2>{0.878746867f, 0.056151133f},
-std::array<float,2>{0.130380467f, 0.652490616f},
-std::array<float,2>{0.563650906f, 0.759800196f},
-std::array<float,2>{0.329027504f, 0.272916347f},
-std::array<float,2>{0.790537059f, 0.35906285f},
-std::array<float,2>{0.116844065f, 0.840171874f},
-std::array<float,2>{0.64316529f, 0.730332375f},
-std::array<float,2>{0.434473246f, 0.0739104599f},
-std::array<float,2>{0.538034081f, 0.233294085f},
-std::array<float,2>{0.260486335f, 0.607571006f},
-std::array<float,2>{0.937684655f, 0.913706839f},
-std::array<float,2>{0.23711361f, 0.494569868f},
-std::array<float,2>{0.507555604f, 0.473197669f},
-std::array<float,2>{0.310859293f, 0.923846662f},
-std::array<float,2>{0.987424493f, 0.61390239f},
-std::array<float,2>{0.196485057f, 0.245933473f},
-std::array<float,2>{0.775119185f, 0.0885968357f},
-std::array<float,2>{0.0761778057f, 0.746217787f},
-std::array<float,2>{0.685023129f, 0.826980352f},
-std::array<float,2>{0.381458938f, 0.365705401f},
-std::array<float,2>{0.93432492f, 0.259707779f},
-std::array<float,2>{0.17356047f, 0.766345799f},
-std::array<float,2>{0.621510863f, 0.634463668f},
-std::array<float,2>{0.36315614f, 0.0427356139f},
-std::array<float,2>{0.719231963f, 0.155103296f},
-std::array<float,2>{0.451194495f, 0.503739655f},
-std::array<float,2>{0.83112967f, 0.946660519f},
-std::array<float,2>{0.0100471871f, 0.409454763f},
-std::array<float,2>{0.630816519f, 0.333221912f},
-std::array<float,2>{0.417561531f, 0.856217325f},
-std::array<float,2>{0.811050415f, 0.711286604f},
-std::array<float,2>{0.095423311f, 0.109177709f},
-std::array<float,2>{0.960791588f, 0.195271492f},
-std::array<float,2>{0.23028779f, 0.584968507f},
-std::array<float,2>{0.559099913f, 0.888614774f},
-std::array<float,2>{0.278250575f, 0.459541589f},
-std::array<float,2>{0.862112701f, 0.403413504f},
-std::array<float,2>{0.0357197449f, 0.981411636f},
-std::array<float,2>{0.700370133f, 0.541790187f},
-std::array<float,2>{0.475659311f, 0.158967316f},
-std::array<float,2>{0.584427118f, 0.0282795094f},
-std::array<float,2>{0.315701991f, 0.657215834f},
-std::array<float,2>{0.897269905f, 0.782970846f},
-std::array<float,2>{0.153163418f, 0.308340251f},
-std::array<float,2>{0.554635584f, 0.373871744f},
-std::array<float,2>{0.273147076f, 0.814778686f},
-std::array<float,2>{0.968524218f, 0.734992027f},
-std::array<float,2>{0.219613478f, 0.0825927258f},
-std::array<float,2>{0.79755038f, 0.235243782f},
-std::array<float,2>{0.109350592f, 0.623243272f},
-std::array<float,2>{0.637538731f, 0.936212182f},
-std::array<float,2>{0.411934525f, 0.480513722f},
-std::array<float,2>{0.902009785f, 0.414962173f},
-std::array<float,2>{0.146270618f, 0.942544818f},
-std::array<float,2>{0.592999339f, 0.514400125f},
-std::array<float,2>{0.325254083f, 0.145345062f},
-std::array<float,2>{0.694108665f, 0.037807636f},
-std::array<float,2>{0.482342809f, 0.625379801f},
-std::array<float,2>{0.867334664f, 0.777609646f},
-std::array<float,2>{0.0435914658f, 0.254745036f},
-std::array<float,2>{0.674275398f, 0.461610705f},
-std::array<float,2>{0.384737462f, 0.882058024f},
-std::array<float,2>{0.773355186f, 0.592220724f},
-std::array<float,2>{0.0632865652f, 0.199256912f},
-std::array<float,2>{0.993541777f, 0.0996473134f},
-std::array<float,2>{0.194019511f, 0.708138347f},
-std::array<float,2>{0.513082981f, 0.848227918f},
-std::array<float,2>{0.301818639f, 0.33970657f},
-std::array<float,2>{0.842492282f, 0.303482294f},
-std::array<float,2>{0.000146401828f, 0.793764532f},
-std::array<float,2>{0.733402133f, 0.669013143f},
-std::array<float,2>{0.443503588f, 0.0200794302f},
-std::array<float,2>{0.61614126f, 0.17108658f},
-std::array<float,2>{0.36825034f, 0.533838272f},
-std::array<float,2>{0.928604603f, 0.973730981f},
-std::array<float,2>{0.183483839f, 0.391740531f},
-std::array<float,2>{0.572585583f, 0.377627969f},
-std::array<float,2>{0.342050344f, 0.999522805f},
-std::array<float,2>{0.884616375f, 0.561626554f},
-std::array<float,2>{0.135202006f, 0.17954275f},
-std::array<float,2>{0.852845311f, 0.0134921754f},
-std::array<float,2>{0.0608820617f, 0.67214781f},
-std::array<float,2>{0.715676069f, 0.808750927f},
-std::array<float,2>{0.489822835f, 0.294648468f},
-std::array<float,2>{0.946968675f, 0.325251937f},
-std::array<float,2>{0.246297866f, 0.866648018f},
-std::array<float,2>{0.544295311f, 0.700269818f},
-std::array<float,2>{0.251398951f, 0.109836899f},
-std::array<float,2>{0.651556075f, 0.206616402f},
-std::array<float,2>{0.427592129f, 0.566062629f},
-std::array<float,2>{0.781692445f, 0.894960225f},
-std::array<float,2>{0.119250357f, 0.438196421f},
-std::array<float,2>{0.741910815f, 0.276504457f},
-std::array<float,2>{0.456232548f, 0.754586637f},
-std::array<float,2>{0.82303077f, 0.64149946f},
-std::array<float,2>{0.0309625454f, 0.0483210459f},
-std::array<float,2>{0.914176464f, 0.136982009f},
-std::array<float,2>{0.16902639f, 0.530854881f},
-std::array<float,2>{0.604919493f, 0.965770662f},
-std::array<float,2>{0.359294116f, 0.434850454f},
-std::array<float,2>{0.757383823f, 0.489014059f},
-std::array<float,2>{0.0869419053f, 0.919475973f},
-std::array<float,2>{0.657317519f, 0.600332916f},
-std::array<float,2>{0.40550065f, 0.224435985f},
-std::array<float,2>{0.522065282f, 0.0649779961f},
-std::array<float,2>{0.292894304f, 0.726519704f},
-std::array<float,2>{0.977841794f, 0.829114974f},
-std::array<float,2>{0.208952531f, 0.346894175f},
-std::array<float,2>{0.542520344f, 0.264298528f},
-std::array<float,2>{0.255005658f, 0.773244858f},
-std::array<float,2>{0.952196836f, 0.640129685f},
-std::array<float,2>{0.242255181f, 0.0431163236f},
-std::array<float,2>{0.788535774f, 0.151417509f},
-std::array<float,2>{0.121823527f, 0.505254567f},
-std::array<float,2>{0.654884517f, 0.95148325f},
-std::array<float,2>{0.424214691f, 0.411936551f},
-std::array<float,2>{0.887016654f, 0.471503615f},
-std::array<float,2>{0.138817623f, 0.928933263f},
-std::array<float,2>{0.577949107f, 0.612899542f},
-std::array<float,2>{0.336413682f, 0.247705549f},
-std::array<float,2>{0.71420747f, 0.0909475386f},
-std::array<float,2>{0.485287964f, 0.743210495f},
-std::array<float,2>{0.856015086f, 0.823597372f},
-std::array<float,2>{0.057659246f, 0.360361665f},
-std::array<float,2>{0.662159264f, 0.399041295f},
-std::array<float,2>{0.401626378f, 0.978119612f},
-std::array<float,2>{0.750919342f, 0.54516685f},
-std::array<float,2>{0.0926769748f, 0.163942039f},
-std::array<float,2>{0.98369962f, 0.026509434f},
-std::array<float,2>{0.206558049f, 0.660342932f},
-std::array<float,2>{0.516005397f, 0.786302686f},
-std::array<float,2>{0.293780625f, 0.311026931f},
-std::array<float,2>{0.825804174f, 0.329021513f},
-std::array<float,2>{0.0269889664f, 0.854712903f},
-std::array<float,2>{0.73647666f, 0.715812385f},
-std::array<float,2>{0.4578906f, 0.104763605f},
-std::array<float,2>{0.605777085f, 0.188779324f},
-std::array<float,2>{0.354103357f, 0.580423713f},
-std::array<float,2>{0.921488583f, 0.885893285f},
-std::array<float,2>{0.167162895f, 0.453989059f},
-std::array<float,2>{0.588643074f, 0.452453673f},
-std::array<float,2>{0.322885007f, 0.899428308f},
-std::array<float,2>{0.90486604f, 0.576274633f},
-std::array<float,2>{0.142657056f, 0.212064236f},
-std::array<float,2>{0.873471797f, 0.1180728f},
-std::array<float,2>{0.0412450731f, 0.688709378f},
-std::array<float,2>{0.688635409f, 0.874095261f},
-std::array<float,2>{0.478924096f, 0.318716973f},
-std::array<float,2>{0.96356833f, 0.285398185f},
-std::array<float,2>{0.22625798f, 0.798539281f},
-std::array<float,2>{0.548545837f, 0.680518329f},
-std::array<float,2>{0.26909852f, 0.00600755587f},
-std::array<float,2>{0.633035898f, 0.180796251f},
-std::array<float,2>{0.407986045f, 0.551015496f},
-std::array<float,2>{0.804166377f, 0.991797924f},
-std::array<float,2>{0.102564543f, 0.384493828f},
-std::array<float,2>{0.728460729f, 0.352311969f},
-std::array<float,2>{0.440866858f, 0.838654816f},
-std::array<float,2>{0.837773204f, 0.731848657f},
-std::array<float,2>{0.00570600247f, 0.0743221641f},
-std::array<float,2>{0.924669981f, 0.23015447f},
-std::array<float,2>{0.186052412f, 0.603118241f},
-std::array<float,2>{0.613040149f, 0.907441437f},
-std::array<float,2>{0.374725729f, 0.49803564f},
-std::array<float,2>{0.769381046f, 0.422664344f},
-std::array<float,2>{0.0675930232f, 0.960367203f},
-std::array<float,2>{0.677764595f, 0.519478559f},
-std::array<float,2>{0.389680356f, 0.128114358f},
-std::array<float,2>{0.51037842f, 0.060857214f},
-std::array<float,2>{0.299491405f, 0.649590492f},
-std::array<float,2>{0.998798072f, 0.765056789f},
-std::array<float,2>{0.190832749f, 0.267934293f},
-std::array<float,2>{0.617362976f, 0.321529746f},
-std::array<float,2>{0.364446014f, 0.861296415f},
-std::array<float,2>{0.932177484f, 0.6976282f},
-std::array<float,2>{0.177617222f, 0.115146063f},
-std::array<float,2>{0.835259676f, 0.207446843f},
-std::array<float,2>{0.0139378114f, 0.569287956f},
-std::array<float,2>{0.72571826f, 0.89235276f},
-std::array<float,2>{0.446368665f, 0.443842649f},
-std::array<float,2>{0.990477085f, 0.38050279f},
-std::array<float,2>{0.203065649f, 0.995810151f},
-std::array<float,2>{0.503454864f, 0.556553721f},
-std::array<float,2>{0.306951851f, 0.173601374f},
-std::array<float,2>{0.681334019f, 0.00801812485f},
-std::array<float,2>{0.377515703f, 0.678113818f},
-std::array<float,2>{0.777476788f, 0.8072837f},
-std::array<float,2>{0.0741955563f, 0.290362179f},
-std::array<float,2>{0.697576225f, 0.486056596f},
-std::array<float,2>{0.472149998f, 0.916523576f},
-std::array<float,2>{0.865119636f, 0.596499383f},
-std::array<float,2>{0.0318941548f, 0.220423102f},
-std::array<float,2>{0.892394662f, 0.0691405982f},
-std::array<float,2>{0.151646793f, 0.719893515f},
-std::array<float,2>{0.579145372f, 0.8351053f},
-std::array<float,2>{0.319078833f, 0.349886358f},
-std::array<float,2>{0.805859089f, 0.27960974f},
-std::array<float,2>{0.100843243f, 0.751095235f},
-std::array<float,2>{0.625120938f, 0.646621227f},
-std::array<float,2>{0.420037538f, 0.0543012619f},
-std::array<float,2>{0.55655694f, 0.135676533f},
-std::array<float,2>{0.27428019f, 0.524603963f},
-std::array<float,2>{0.953897834f, 0.964744389f},
-std::array<float,2>{0.231939822f, 0.431940556f},
-std::array<float,2>{0.526998043f, 0.418139488f},
-std::array<float,2>{0.286666721f, 0.94096303f},
-std::array<float,2>{0.976480722f, 0.508457959f},
-std::array<float,2>{0.217638314f, 0.144467384f},
-std::array<float,2>{0.762301981f, 0.0337623134f},
-std::array<float,2>{0.084790051f, 0.631103277f},
-std::array<float,2>{0.669819474f, 0.77549386f},
-std::array<float,2>{0.392203808f, 0.253451169f},
-std::array<float,2>{0.908923626f, 0.370716989f},
-std::array<float,2>{0.157047883f, 0.817191362f},
-std::array<float,2>{0.597672582f, 0.739639461f},
-std::array<float,2>{0.347914666f, 0.0782737434f},
-std::array<float,2>{0.745380998f, 0.238504425f},
-std::array<float,2>{0.463559151f, 0.619320035f},
-std::array<float,2>{0.818254173f, 0.929750621f},
-std::array<float,2>{0.0205106083f, 0.477156132f},
-std::array<float,2>{0.645143628f, 0.300295234f},
-std::array<float,2>{0.430616319f, 0.790323317f},
-std::array<float,2>{0.796042442f, 0.667501092f},
-std::array<float,2>{0.111356393f, 0.0186357666f},
-std::array<float,2>{0.944114029f, 0.165669933f},
-std::array<float,2>{0.240749329f, 0.536502898f},
-std::array<float,2>{0.53327781f, 0.972249627f},
-std::array<float,2>{0.262488008f, 0.396242648f},
-std::array<float,2>{0.850462854f, 0.465975642f},
-std::array<float,2>{0.0502706841f, 0.876475513f},
-std::array<float,2>{0.709209859f, 0.589526594f},
-std::array<float,2>{0.494176209f, 0.197046474f},
-std::array<float,2>{0.567463517f, 0.0972438753f},
-std::array<float,2>{0.335880339f, 0.706280828f},
-std::array<float,2>{0.880289078f, 0.844709218f},
-std::array<float,2>{0.127643406f, 0.34368819f},
-std::array<float,2>{0.571363807f, 0.294112533f},
-std::array<float,2>{0.340116143f, 0.809438169f},
-std::array<float,2>{0.885809422f, 0.672456801f},
-std::array<float,2>{0.133860856f, 0.0130213602f},
-std::array<float,2>{0.854718089f, 0.178873613f},
-std::array<float,2>{0.059772931f, 0.562063336f},
-std::array<float,2>{0.717831016f, 0.999109685f},
-std::array<float,2>{0.491613477f, 0.37742874f},
-std::array<float,2>{0.948580742f, 0.437790871f},
-std::array<float,2>{0.248353958f, 0.895137012f},
-std::array<float,2>{0.54667753f, 0.565904319f},
-std::array<float,2>{0.253740102f, 0.206084967f},
-std::array<float,2>{0.649800122f, 0.109933741f},
-std::array<float,2>{0.428143322f, 0.701009154f},
-std::array<float,2>{0.784075975f, 0.866912186f},
-std::array<float,2>{0.117879339f, 0.325860798f},
-std::array<float,2>{0.739748776f, 0.43546313f},
-std::array<float,2>{0.453707248f, 0.965240121f},
-std::array<float,2>{0.821113646f, 0.530365586f},
-std::array<float,2>{0.0291055739f, 0.137569979f},
-std::array<float,2>{0.916740298f, 0.0486640446f},
-std::array<float,2>{0.170310065f, 0.640960813f},
-std::array<float,2>{0.603393376f, 0.753951371f},
-std::array<float,2>{0.356585711f, 0.277111083f},
-std::array<float,2>{0.755051732f, 0.347295791f},
-std::array<float,2>{0.0891748443f, 0.829998314f},
-std::array<float,2>{0.658496022f, 0.726019859f},
-std::array<float,2>{0.403426528f, 0.0648658872f},
-std::array<float,2>{0.520255268f, 0.224007666f},
-std::array<float,2>{0.29097864f, 0.599824786f},
-std::array<float,2>{0.979164541f, 0.919429958f},
-std::array<float,2>{0.210108072f, 0.488508016f},
-std::array<float,2>{0.551452935f, 0.48125273f},
-std::array<float,2>{0.270146132f, 0.935972691f},
-std::array<float,2>{0.965679765f, 0.623796821f},
-std::array<float,2>{0.222241387f, 0.234717742f},
-std::array<float,2>{0.799495935f, 0.0820967406f},
-std::array<float,2>{0.107346132f, 0.734647214f},
-std::array<float,2>{0.640207171f, 0.81498903f},
-std::array<float,2>{0.413753718f, 0.373104602f},
-std::array<float,2>{0.900035977f, 0.254388869f},
-std::array<float,2>{0.14670749f, 0.777833879f},
-std::array<float,2>{0.590152919f, 0.625740945f},
-std::array<float,2>{0.327559799f, 0.0374884009f},
-std::array<float,2>{0.691755831f, 0.144825548f},
-std::array<float,2>{0.482583672f, 0.513747811f},
-std::array<float,2>{0.86954844f, 0.942886591f},
-std::array<float,2>{0.0460226536f, 0.414416909f},
-std::array<float,2>{0.673447192f, 0.339067847f},
-std::array<float,2>{0.386002809f, 0.848137975f},
-std::array<float,2>{0.770872653f, 0.708723247f},
-std::array<float,2>{0.065108031f, 0.100194305f},
-std::array<float,2>{0.995381653f, 0.199869394f},
-std::array<float,2>{0.192395687f, 0.592581093f},
-std::array<float,2>{0.515143871f, 0.882525206f},
-std::array<float,2>{0.304231137f, 0.461136878f},
-std::array<float,2>{0.840385497f, 0.392151356f},
-std::array<float,2>{0.00371536217f, 0.974262834f},
-std::array<float,2>{0.731558502f, 0.533398211f},
-std::array<float,2>{0.44327718f, 0.17179136f},
-std::array<float,2>{0.613694966f, 0.0196452439f},
-std::array<float,2>{0.370380938f, 0.669832528f},
-std::array<float,2>{0.927506626f, 0.792998791f},
-std::array<float,2>{0.181285486f, 0.302739471f},
-std::array<float,2>{0.505574942f, 0.365820855f},
-std::array<float,2>{0.309539974f, 0.826626778f},
-std::array<float,2>{0.985179424f, 0.747044027f},
-std::array<float,2>{0.199086905f, 0.0882781148f},
-std::array<float,2>{0.776109755f, 0.245179087f},
-std::array<float,2>{0.0742717311f, 0.613323212f},
-std::array<float,2>{0.68688935f, 0.924405515f},
-std::array<float,2>{0.3800807f, 0.472739607f},
-std::array<float,2>{0.937042356f, 0.409981161f},
-std::array<float,2>{0.175144315f, 0.947221279f},
-std::array<float,2>{0.623938918f, 0.503327847f},
-std::array<float,2>{0.359797776f, 0.154377252f},
-std::array<float,2>{0.720712423f, 0.0421087183f},
-std::array<float,2>{0.449428886f, 0.634151757f},
-std::array<float,2>{0.829216123f, 0.765677512f},
-std::array<float,2>{0.00957663823f, 0.258947313f},
-std::array<float,2>{0.63250345f, 0.459441036f},
-std::array<float,2>{0.414268136f, 0.887767196f},
-std::array<float,2>{0.81006068f, 0.58563894f},
-std::array<float,2>{0.0971130133f, 0.19459264f},
-std::array<float,2>{0.957877934f, 0.108565755f},
-std::array<float,2>{0.227298409f, 0.711478889f},
-std::array<float,2>{0.560620725f, 0.855897188f},
-std::array<float,2>{0.280587286f, 0.333827257f},
-std::array<float,2>{0.859583497f, 0.307886302f},
-std::array<float,2>{0.0378703736f, 0.78224206f},
-std::array<float,2>{0.701874197f, 0.656619966f},
-std::array<float,2>{0.47306934f, 0.0273907222f},
-std::array<float,2>{0.583941936f, 0.158220485f},
-std::array<float,2>{0.313789845f, 0.541124284f},
-std::array<float,2>{0.89503485f, 0.980823994f},
-std::array<float,2>{0.155839294f, 0.404107869f},
-std::array<float,2>{0.596856952f, 0.388271302f},
-std::array<float,2>{0.344459355f, 0.987151504f},
-std::array<float,2>{0.913862646f, 0.548781395f},
-std::array<float,2>{0.161618859f, 0.185744673f},
-std::array<float,2>{0.813836515f, 0.00281158416f},
-std::array<float,2>{0.0178435519f, 0.685540855f},
-std::array<float,2>{0.749879837f, 0.802862883f},
-std::array<float,2>{0.468586087f, 0.282868892f},
-std::array<float,2>{0.970276713f, 0.313164949f},
-std::array<float,2>{0.213986605f, 0.868411005f},
-std::array<float,2>{0.530699849f, 0.694817901f},
-std::array<float,2>{0.28391093f, 0.124002129f},
-std::array<float,2>{0.664314032f, 0.215100765f},
-std::array<float,2>{0.39838919f, 0.573678553f},
-std::array<float,2>{0.76026839f, 0.902855098f},
-std::array<float,2>{0.0809706599f, 0.447380155f},
-std::array<float,2>{0.704355955f, 0.273294151f},
-std::array<float,2>{0.497667134f, 0.760381401f},
-std::array<float,2>{0.844300151f, 0.653050601f},
-std::array<float,2>{0.0529703051f, 0.0561832935f},
-std::array<float,2>{0.876365542f, 0.12907353f},
-std::array<float,2>{0.132705107f, 0.523353934f},
-std::array<float,2>{0.565927267f, 0.953496873f},
-std::array<float,2>{0.331792563f, 0.426367879f},
-std::array<float,2>{0.792953253f, 0.495083332f},
-std::array<float,2>{0.114265017f, 0.913210809f},
-std::array<float,2>{0.641901016f, 0.607980907f},
-std::array<float,2>{0.436469436f, 0.232716575f},
-std::array<float,2>{0.536701858f, 0.0732681826f},
-std::array<float,2>{0.259181827f, 0.729844511f},
-std::array<float,2>{0.939635575f, 0.840646982f},
-std::array<float,2>{0.235442579f, 0.358807713f},
-std::array<float,2>{0.51851064f, 0.31000182f},
-std::array<float,2>{0.295988351f, 0.788038671f},
-std::array<float,2>{0.981761575f, 0.662709951f},
-std::array<float,2>{0.204593405f, 0.0249757972f},
-std::array<float,2>{0.752924919f, 0.160973877f},
-std::array<float,2>{0.0899039581f, 0.543021619f},
-std::array<float,2>{0.660702229f, 0.98017776f},
-std::array<float,2>{0.39884153f, 0.400523782f},
-std::array<float,2>{0.918236136f, 0.456100076f},
-std::array<float,2>{0.164926529f, 0.883624017f},
-std::array<float,2>{0.608020008f, 0.579770148f},
-std::array<float,2>{0.353204012f, 0.189666778f},
-std::array<float,2>{0.735458374f, 0.103347875f},
-std::array<float,2>{0.458993196f, 0.718446732f},
-std::array<float,2>{0.826998591f, 0.852046251f},
-std::array<float,2>{0.0240372848f, 0.330577254f},
-std::array<float,2>{0.652700067f, 0.413526505f},
-std::array<float,2>{0.423667103f, 0.94943279f},
-std::array<float,2>{0.786905587f, 0.507283032f},
-std::array<float,2>{0.123540521f, 0.149309412f},
-std::array<float,2>{0.950708568f, 0.0463436581f},
-std::array<float,2>{0.24416472f, 0.637471139f},
-std::array<float,2>{0.539785326f, 0.770033956f},
-std::array<float,2>{0.256596506f, 0.262675613f},
-std::array<float,2>{0.859095514f, 0.361530185f},
-std::array<float,2>{0.0565728433f, 0.820908248f},
-std::array<float,2>{0.711320221f, 0.745523512f},
-std::array<float,2>{0.486433387f, 0.0927470401f},
-std::array<float,2>{0.574677229f, 0.249221146f},
-std::array<float,2>{0.338184565f, 0.611318111f},
-std::array<float,2>{0.888784826f, 0.926701069f},
-std::array<float,2>{0.137156337f, 0.469072431f},
-std::array<float,2>{0.60982579f, 0.499448091f},
-std::array<float,2>{0.372424811f, 0.908459485f},
-std::array<float,2>{0.923356712f, 0.604470134f},
-std::array<float,2>{0.185175374f, 0.2281591f},
-std::array<float,2>{0.838874459f, 0.0771718323f},
-std::array<float,2>{0.00773295574f, 0.732833207f},
-std::array<float,2>{0.729701996f, 0.83694309f},
-std::array<float,2>{0.438186437f, 0.353714406f},
-std::array<float,2>{0.996467054f, 0.265900046f},
-std::array<float,2>{0.188343406f, 0.763063908f},
-std::array<float,2>{0.508794367f, 0.650588453f},
-std::array<float,2>{0.298421055f, 0.059222158f},
-std::array<float,2>{0.675855815f, 0.125723198f},
-std::array<float,2>{0.388010055f, 0.516474068f},
-std::array<float,2>{0.765635669f, 0.958039105f},
-std::array<float,2>{0.0702380836f, 0.425231695f},
-std::array<float,2>{0.69076854f, 0.317085594f},
-std::array<float,2>{0.476877391f, 0.871641934f},
-std::array<float,2>{0.872122884f, 0.689985275f},
-std::array<float,2>{0.0393491834f, 0.120141096f},
-std::array<float,2>{0.904242873f, 0.213541582f},
-std::array<float,2>{0.141336784f, 0.575659275f},
-std::array<float,2>{0.586598575f, 0.900809884f},
-std::array<float,2>{0.320639074f, 0.450049341f},
-std::array<float,2>{0.802174807f, 0.38663274f},
-std::array<float,2>{0.103882693f, 0.989029169f},
-std::array<float,2>{0.635301113f, 0.554535389f},
-std::array<float,2>{0.409941375f, 0.182760134f},
-std::array<float,2>{0.549809694f, 0.0043388214f},
-std::array<float,2>{0.266192377f, 0.682493091f},
-std::array<float,2>{0.961522639f, 0.799785733f},
-std::array<float,2>{0.223035544f, 0.287895054f},
-std::array<float,2>{0.581298411f, 0.34801805f},
-std::array<float,2>{0.316892982f, 0.833461702f},
-std::array<float,2>{0.893639982f, 0.721501887f},
-std::array<float,2>{0.150299847f, 0.0683405623f},
-std::array<float,2>{0.865625203f, 0.22141023f},
-std::array<float,2>{0.034907952f, 0.595454633f},
-std::array<float,2>{0.695516646f, 0.914204478f},
-std::array<float,2>{0.469165176f, 0.486498386f},
-std::array<float,2>{0.955272198f, 0.431305319f},
-std::array<float,2>{0.234363273f, 0.961099565f},
-std::array<float,2>{0.558152199f, 0.525402665f},
-std::array<float,2>{0.27559939f, 0.13476038f},
-std::array<float,2>{0.628640354f, 0.051730644f},
-std::array<float,2>{0.41800338f, 0.646413386f},
-std::array<float,2>{0.808498025f, 0.752718151f},
-std::array<float,2>{0.0988008007f, 0.277462929f},
-std::array<float,2>{0.722940385f, 0.441954434f},
-std::array<float,2>{0.448840648f, 0.894118011f},
-std::array<float,2>{0.832749426f, 0.567610085f},
-std::array<float,2>{0.012414501f, 0.210125387f},
-std::array<float,2>{0.930733502f, 0.11695303f},
-std::array<float,2>{0.179151908f, 0.6954f},
-std::array<float,2>{0.621020496f, 0.86285162f},
-std::array<float,2>{0.366988301f, 0.323667496f},
-std::array<float,2>{0.781039596f, 0.291304141f},
-std::array<float,2>{0.0710342005f, 0.806583762f},
-std::array<float,2>{0.682458818f, 0.677722156f},
-std::array<float,2>{0.375517786f, 0.0100951437f},
-std::array<float,2>{0.501605034f, 0.174017489f},
-std::array<float,2>{0.305577785f, 0.557632446f},
-std::array<float,2>{0.988772154f, 0.993536413f},
-std::array<float,2>{0.199508607f, 0.381917715f},
-std::array<float,2>{0.531725347f, 0.396780282f},
-std::array<float,2>{0.263838798f, 0.97003448f},
-std::array<float,2>{0.943143547f, 0.537436247f},
-std::array<float,2>{0.238776997f, 0.166689053f},
-std::array<float,2>{0.793276072f, 0.01730939f},
-std::array<float,2>{0.109572761f, 0.664500058f},
-std::array<float,2>{0.647830427f, 0.792659402f},
-std::array<float,2>{0.43211031f, 0.298515797f},
-std::array<float,2>{0.881097674f, 0.341074735f},
-std::array<float,2>{0.12615931f, 0.846646905f},
-std::array<float,2>{0.569080234f, 0.705063462f},
-std::array<float,2>{0.332574844f, 0.0945335329f},
-std::array<float,2>{0.708023489f, 0.199160874f},
-std::array<float,2>{0.492862672f, 0.586871207f},
-std::array<float,2>{0.847826898f, 0.878874302f},
-std::array<float,2>{0.0480731018f, 0.468430907f},
-std::array<float,2>{0.67092973f, 0.251866639f},
-std::array<float,2>{0.39442274f, 0.773813665f},
-std::array<float,2>{0.764148176f, 0.63043201f},
-std::array<float,2>{0.0838193446f, 0.0319594815f},
-std::array<float,2>{0.973205209f, 0.141557559f},
-std::array<float,2>{0.216484204f, 0.511185169f},
-std::array<float,2>{0.52358371f, 0.93923831f},
-std::array<float,2>{0.287141681f, 0.419924855f},
-std::array<float,2>{0.819781065f, 0.47975719f},
-std::array<float,2>{0.022515947f, 0.933072686f},
-std::array<float,2>{0.743983805f, 0.618540764f},
-std::array<float,2>{0.46176973f, 0.241736546f},
-std::array<float,2>{0.600865841f, 0.0809561834f},
-std::array<float,2>{0.351233333f, 0.741908371f},
-std::array<float,2>{0.906567514f, 0.819365501f},
-std::array<float,2>{0.160109133f, 0.368812948f},
-std::array<float,2>{0.605341554f, 0.273627847f},
-std::array<float,2>{0.358772457f, 0.757478714f},
-std::array<float,2>{0.914824247f, 0.642676473f},
-std::array<float,2>{0.169793621f, 0.0490608327f},
-std::array<float,2>{0.822444141f, 0.139478788f},
-std::array<float,2>{0.0303728674f, 0.527847886f},
-std::array<float,2>{0.741649628f, 0.968377054f},
-std::array<float,2>{0.456863016f, 0.437497139f},
-std::array<float,2>{0.978061676f, 0.490682602f},
-std::array<float,2>{0.208447993f, 0.920788407f},
-std::array<float,2>{0.521971226f, 0.598415077f},
-std::array<float,2>{0.292286545f, 0.225889653f},
-std::array<float,2>{0.657755673f, 0.0643872172f},
-std::array<float,2>{0.406140536f, 0.723968208f},
-std::array<float,2>{0.756964147f, 0.830173492f},
-std::array<float,2>{0.0874320194f, 0.344574094f},
-std::array<float,2>{0.714887798f, 0.37613982f},
-std::array<float,2>{0.489314079f, 0.996728361f},
-std::array<float,2>{0.853345752f, 0.559289634f},
-std::array<float,2>{0.0613045394f, 0.17619209f},
-std::array<float,2>{0.884084642f, 0.0150773395f},
-std::array<float,2>{0.135457411f, 0.675542951f},
-std::array<float,2>{0.572953522f, 0.812413394f},
-std::array<float,2>{0.342484564f, 0.295954764f},
-std::array<float,2>{0.782131493f, 0.32743451f},
-std::array<float,2>{0.119908378f, 0.864709854f},
-std::array<float,2>{0.652108312f, 0.70299983f},
-std::array<float,2>{0.426817745f, 0.111596689f},
-std::array<float,2>{0.544570029f, 0.204563513f},
-std::array<float,2>{0.251582712f, 0.562536001f},
-std::array<float,2>{0.94657135f, 0.8983078f},
-std::array<float,2>{0.246691987f, 0.440277994f},
-std::array<float,2>{0.513243854f, 0.464603037f},
-std::array<float,2>{0.302574515f, 0.879808724f},
-std::array<float,2>{0.994136751f, 0.591609538f},
-std::array<float,2>{0.193768814f, 0.201480687f},
-std::array<float,2>{0.772473156f, 0.0981060714f},
-std::array<float,2>{0.0627141893f, 0.709664941f},
-std::array<float,2>{0.674620032f, 0.849736154f},
-std::array<float,2>{0.384123623f, 0.336334407f},
-std::array<float,2>{0.927818656f, 0.302238464f},
-std::array<float,2>{0.182735786f, 0.795164049f},
-std::array<float,2>{0.615311205f, 0.670216501f},
-std::array<float,2>{0.36890614f, 0.0225921124f},
-std::array<float,2>{0.734154642f, 0.168950647f},
-std::array<float,2>{0.444131106f, 0.532478213f},
-std::array<float,2>{0.842096448f, 0.976376176f},
-std::array<float,2>{0.000942475395f, 0.39345634f},
-std::array<float,2>{0.636993766f, 0.372488201f},
-std::array<float,2>{0.411363125f, 0.813577116f},
-std::array<float,2>{0.796918273f, 0.736942649f},
-std::array<float,2>{0.108548492f, 0.0840793252f},
-std::array<float,2>{0.967906713f, 0.236579955f},
-std::array<float,2>{0.219148561f, 0.622388721f},
-std::array<float,2>{0.553734183f, 0.934052467f},
-std::array<float,2>{0.272652149f, 0.484225422f},
-std::array<float,2>{0.867759824f, 0.416907102f},
-std::array<float,2>{0.0434564725f, 0.943801403f},
-std::array<float,2>{0.693455637f, 0.512209654f},
-std::array<float,2>{0.481899053f, 0.147640258f},
-std::array<float,2>{0.593694508f, 0.0357174091f},
-std::array<float,2>{0.326076984f, 0.627327681f},
-std::array<float,2>{0.90159744f, 0.779515624f},
-std::array<float,2>{0.145518556f, 0.256753713f},
-std::array<float,2>{0.558953345f, 0.33524406f},
-std::array<float,2>{0.277439594f, 0.858439744f},
-std::array<float,2>{0.960261047f, 0.713827848f},
-std::array<float,2>{0.22962226f, 0.106696635f},
-std::array<float,2>{0.810565293f, 0.19258596f},
-std::array<float,2>{0.0949118957f, 0.582496822f},
-std::array<float,2>{0.630092382f, 0.888828099f},
-std::array<float,2>{0.417045683f, 0.458764613f},
-std::array<float,2>{0.896835446f, 0.405916423f},
-std::array<float,2>{0.152416274f, 0.983406782f},
-std::array<float,2>{0.584736109f, 0.539671957f},
-std::array<float,2>{0.315982342f, 0.157237932f},
-std::array<float,2>{0.700835109f, 0.0293421466f},
-std::array<float,2>{0.476252347f, 0.658298492f},
-std::array<float,2>{0.861765444f, 0.783314049f},
-std::array<float,2>{0.0352375209f, 0.305218875f},
-std::array<float,2>{0.685314417f, 0.475438505f},
-std::array<float,2>{0.381235182f, 0.923146367f},
-std::array<float,2>{0.774542093f, 0.615676761f},
-std::array<float,2>{0.0769567564f, 0.243341461f},
-std::array<float,2>{0.987971067f, 0.0872505978f},
-std::array<float,2>{0.197067186f, 0.749440372f},
-std::array<float,2>{0.507219315f, 0.82484144f},
-std::array<float,2>{0.311296999f, 0.364310294f},
-std::array<float,2>{0.831721365f, 0.261501312f},
-std::array<float,2>{0.0103526497f, 0.769507527f},
-std::array<float,2>{0.719308794f, 0.636166871f},
-std::array<float,2>{0.452034324f, 0.0402230695f},
-std::array<float,2>{0.621696591f, 0.153740495f},
-std::array<float,2>{0.362682015f, 0.501603544f},
-std::array<float,2>{0.933725953f, 0.948918998f},
-std::array<float,2>{0.173055381f, 0.406427979f},
-std::array<float,2>{0.564353704f, 0.428493798f},
-std::array<float,2>{0.328503788f, 0.956372559f},
-std::array<float,2>{0.878146172f, 0.521127045f},
-std::array<float,2>{0.13000755f, 0.131957456f},
-std::array<float,2>{0.846300662f, 0.0584939234f},
-std::array<float,2>{0.0526822172f, 0.654540181f},
-std::array<float,2>{0.705781996f, 0.758300602f},
-std::array<float,2>{0.498295695f, 0.269850165f},
-std::array<float,2>{0.938172102f, 0.356905639f},
-std::array<float,2>{0.236534551f, 0.843723536f},
-std::array<float,2>{0.537321508f, 0.726926506f},
-std::array<float,2>{0.260092348f, 0.0715818852f},
-std::array<float,2>{0.642778754f, 0.230966046f},
-std::array<float,2>{0.433757603f, 0.606865585f},
-std::array<float,2>{0.790048242f, 0.91074115f},
-std::array<float,2>{0.116423532f, 0.493020296f},
-std::array<float,2>{0.747779787f, 0.284744948f},
-std::array<float,2>{0.466689318f, 0.801919281f},
-std::array<float,2>{0.814721882f, 0.685727f},
-std::array<float,2>{0.0173667353f, 0.000341221719f},
-std::array<float,2>{0.910873055f, 0.184769735f},
-std::array<float,2>{0.163201004f, 0.549650133f},
-std::array<float,2>{0.594373226f, 0.986170471f},
-std::array<float,2>{0.345848918f, 0.389861405f},
-std::array<float,2>{0.759481907f, 0.44548434f},
-std::array<float,2>{0.0781433657f, 0.905289054f},
-std::array<float,2>{0.667796016f, 0.57113713f},
-std::array<float,2>{0.395988703f, 0.21827592f},
-std::array<float,2>{0.528235495f, 0.121472508f},
-std::array<float,2>{0.281997889f, 0.691970229f},
-std::array<float,2>{0.971413553f, 0.869713366f},
-std::array<float,2>{0.212515444f, 0.315479428f},
-std::array<float,2>{0.547566712f, 0.288753688f},
-std::array<float,2>{0.267623067f, 0.800086319f},
-std::array<float,2>{0.96407187f, 0.68269819f},
-std::array<float,2>{0.225349277f, 0.00544943707f},
-std::array<float,2>{0.80314368f, 0.181747958f},
-std::array<float,2>{0.101679645f, 0.553304255f},
-std::array<float,2>{0.634046853f, 0.989259779f},
-std::array<float,2>{0.407061756f, 0.385552108f},
-std::array<float,2>{0.906014442f, 0.450357556f},
-std::array<float,2>{0.14386414f, 0.901807904f},
-std::array<float,2>{0.589060903f, 0.574464142f},
-std::array<float,2>{0.323498905f, 0.214039624f},
-std::array<float,2>{0.688293219f, 0.120013773f},
-std::array<float,2>{0.480413139f, 0.690819144f},
-std::array<float,2>{0.874371409f, 0.872651517f},
-std::array<float,2>{0.042266164f, 0.318104148f},
-std::array<float,2>{0.678832352f, 0.424356133f},
-std::array<float,2>{0.388713628f, 0.95728904f},
-std::array<float,2>{0.768332124f, 0.516607344f},
-std::array<float,2>{0.0670137927f, 0.126082391f},
-std::array<float,2>{0.999254405f, 0.0596483387f},
-std::array<float,2>{0.189567655f, 0.651935399f},
-std::array<float,2>{0.511009753f, 0.762002468f},
-std::array<float,2>{0.300037861f, 0.266972959f},
-std::array<float,2>{0.835992992f, 0.354887992f},
-std::array<float,2>{0.00474403938f, 0.835968554f},
-std::array<float,2>{0.726913452f, 0.733862579f},
-std::array<float,2>{0.440292299f, 0.0767266378f},
-std::array<float,2>{0.611748993f, 0.226819485f},
-std::array<float,2>{0.373818845f, 0.60457164f},
-std::array<float,2>{0.925224841f, 0.909563243f},
-std::array<float,2>{0.186615571f, 0.498569697f},
-std::array<float,2>{0.576993823f, 0.469749987f},
-std::array<float,2>{0.337101221f, 0.926772535f},
-std::array<float,2>{0.888407528f, 0.610310018f},
-std::array<float,2>{0.139682829f, 0.248480946f},
-std::array<float,2>{0.856462359f, 0.0937272236f},
-std::array<float,2>{0.0569444671f, 0.744472623f},
-std::array<float,2>{0.713011265f, 0.821334183f},
-std::array<float,2>{0.485812753f, 0.362849236f},
-std::array<float,2>{0.952113807f, 0.263360709f},
-std::array<float,2>{0.243354067f, 0.771309435f},
-std::array<float,2>{0.541960299f, 0.638040066f},
-std::array<float,2>{0.25481841f, 0.0458341688f},
-std::array<float,2>{0.655997634f, 0.150080711f},
-std::array<float,2>{0.425718009f, 0.506425917f},
-std::array<float,2>{0.787522674f, 0.95096904f},
-std::array<float,2>{0.122689918f, 0.412235767f},
-std::array<float,2>{0.737757981f, 0.331954956f},
-std::array<float,2>{0.458367765f, 0.853434265f},
-std::array<float,2>{0.825104535f, 0.717086196f},
-std::array<float,2>{0.0254826844f, 0.102161832f},
-std::array<float,2>{0.920267999f, 0.190683648f},
-std::array<float,2>{0.166916281f, 0.578385711f},
-std::array<float,2>{0.606689811f, 0.884575784f},
-std::array<float,2>{0.355104744f, 0.455327064f},
-std::array<float,2>{0.751781702f, 0.401942879f},
-std::array<float,2>{0.0930442661f, 0.9785285f},
-std::array<float,2>{0.663435519f, 0.544818699f},
-std::array<float,2>{0.400953978f, 0.161637723f},
-std::array<float,2>{0.517262161f, 0.0240145139f},
-std::array<float,2>{0.294512272f, 0.663511276f},
-std::array<float,2>{0.983097792f, 0.788743198f},
-std::array<float,2>{0.205314279f, 0.309464008f},
-std::array<float,2>{0.599341989f, 0.367452741f},
-std::array<float,2>{0.348947495f, 0.819166362f},
-std::array<float,2>{0.909535944f, 0.740782917f},
-std::array<float,2>{0.157578364f, 0.0813490897f},
-std::array<float,2>{0.816672325f, 0.240415543f},
-std::array<float,2>{0.020467246f, 0.617441058f},
-std::array<float,2>{0.744492471f, 0.932162941f},
-std::array<float,2>{0.464189291f, 0.478617638f},
-std::array<float,2>{0.975165784f, 0.421476245f},
-std::array<float,2>{0.218337089f, 0.937644124f},
-std::array<float,2>{0.526129544f, 0.510634422f},
-std::array<float,2>{0.285862476f, 0.141936958f},
-std::array<float,2>{0.668170273f, 0.0324066542f},
-std::array<float,2>{0.390990615f, 0.629138947f},
-std::array<float,2>{0.76291734f, 0.774516642f},
-std::array<float,2>{0.0855192691f, 0.250086814f},
-std::array<float,2>{0.710355103f, 0.467182308f},
-std::array<float,2>{0.495641083f, 0.877069771f},
-std::array<float,2>{0.851147413f, 0.58697921f},
-std::array<float,2>{0.0491128825f, 0.198116422f},
-std::array<float,2>{0.879186213f, 0.0949949548f},
-std::array<float,2>{0.128140628f, 0.70369935f},
-std::array<float,2>{0.567177773f, 0.847405374f},
-std::array<float,2>{0.334113806f, 0.340384901f},
-std::array<float,2>{0.795059144f, 0.296978951f},
-std::array<float,2>{0.113112941f, 0.791370392f},
-std::array<float,2>{0.646298766f, 0.665924668f},
-std::array<float,2>{0.431463927f, 0.0156296529f},
-std::array<float,2>{0.535094023f, 0.16755037f},
-std::array<float,2>{0.263307035f, 0.538230121f},
-std::array<float,2>{0.945062995f, 0.968879223f},
-std::array<float,2>{0.241572708f, 0.397791654f},
-std::array<float,2>{0.502863169f, 0.381420672f},
-std::array<float,2>{0.307655215f, 0.992232084f},
-std::array<float,2>{0.992076397f, 0.557359338f},
-std::array<float,2>{0.201277912f, 0.175602853f},
-std::array<float,2>{0.778394818f, 0.0114342514f},
-std::array<float,2>{0.0725747645f, 0.676189125f},
-std::array<float,2>{0.679703891f, 0.805605531f},
-std::array<float,2>{0.378188729f, 0.29216668f},
-std::array<float,2>{0.933512092f, 0.322434723f},
-std::array<float,2>{0.17653048f, 0.861965835f},
-std::array<float,2>{0.619015157f, 0.696776807f},
-std::array<float,2>{0.363479793f, 0.115771599f},
-std::array<float,2>{0.725283384f, 0.209691897f},
-std::array<float,2>{0.446120411f, 0.567098081f},
-std::array<float,2>{0.834245205f, 0.893194914f},
-std::array<float,2>{0.0152216107f, 0.442457169f},
-std::array<float,2>{0.626575708f, 0.278775811f},
-std::array<float,2>{0.42119354f, 0.753618836f},
-std::array<float,2>{0.804928541f, 0.644643426f},
-std::array<float,2>{0.100071721f, 0.0519236885f},
-std::array<float,2>{0.954581678f, 0.132937774f},
-std::array<float,2>{0.231030732f, 0.526465356f},
-std::array<float,2>{0.555191159f, 0.962889314f},
-std::array<float,2>{0.275325328f, 0.430106729f},
-std::array<float,2>{0.863565326f, 0.488015711f},
-std::array<float,2>{0.0325280502f, 0.91536212f},
-std::array<float,2>{0.698740005f, 0.594607055f},
-std::array<float,2>{0.470802546f, 0.222240284f},
-std::array<float,2>{0.578888595f, 0.0668420643f},
-std::array<float,2>{0.319782108f, 0.722179532f},
-std::array<float,2>{0.891283393f, 0.832142532f},
-std::array<float,2>{0.151162401f, 0.348815411f},
-std::array<float,2>{0.591637611f, 0.256939083f},
-std::array<float,2>{0.326457441f, 0.780456007f},
-std::array<float,2>{0.89890486f, 0.628340662f},
-std::array<float,2>{0.147941887f, 0.0361763574f},
-std::array<float,2>{0.870563686f, 0.146614373f},
-std::array<float,2>{0.0452067591f, 0.513341188f},
-std::array<float,2>{0.692398012f, 0.944441974f},
-std::array<float,2>{0.483931243f, 0.417956322f},
-std::array<float,2>{0.966550231f, 0.482432544f},
-std::array<float,2>{0.220819935f, 0.935509205f},
-std::array<float,2>{0.551876485f, 0.621846199f},
-std::array<float,2>{0.270994425f, 0.237559885f},
-std::array<float,2>{0.639617026f, 0.085023798f},
-std::array<float,2>{0.412779003f, 0.737384856f},
-std::array<float,2>{0.800557077f, 0.812771201f},
-std::array<float,2>{0.105835132f, 0.37192449f},
-std::array<float,2>{0.730963826f, 0.393777013f},
-std::array<float,2>{0.442328364f, 0.974788606f},
-std::array<float,2>{0.841123581f, 0.531372547f},
-std::array<float,2>{0.00232458231f, 0.168491259f},
-std::array<float,2>{0.926748455f, 0.0218147617f},
-std::array<float,2>{0.180208564f, 0.671575248f},
-std::array<float,2>{0.614327013f, 0.796030104f},
-std::array<float,2>{0.369750291f, 0.301656574f},
-std::array<float,2>{0.769634008f, 0.337359935f},
-std::array<float,2>{0.065868333f, 0.851229906f},
-std::array<float,2>{0.672648072f, 0.710532308f},
-std::array<float,2>{0.385059923f, 0.0992479399f},
-std::array<float,2>{0.514567018f, 0.202620268f},
-std::array<float,2>{0.303366542f, 0.590201914f},
-std::array<float,2>{0.994566679f, 0.880598485f},
-std::array<float,2>{0.192373395f, 0.463665396f},
-std::array<float,2>{0.545757174f, 0.441253871f},
-std::array<float,2>{0.252504706f, 0.896850228f},
-std::array<float,2>{0.947287142f, 0.563587487f},
-std::array<float,2>{0.249960065f, 0.203637302f},
-std::array<float,2>{0.784411371f, 0.112487175f},
-std::array<float,2>{0.118356161f, 0.701879501f},
-std::array<float,2>{0.649288714f, 0.863875329f},
-std::array<float,2>{0.429326952f, 0.326726675f},
-std::array<float,2>{0.885119498f, 0.295355231f},
-std::array<float,2>{0.133784741f, 0.810905337f},
-std::array<float,2>{0.570644438f, 0.674559951f},
-std::array<float,2>{0.341763407f, 0.0139236627f},
-std::array<float,2>{0.71699661f, 0.176951408f},
-std::array<float,2>{0.490476489f, 0.560115337f},
-std::array<float,2>{0.853791833f, 0.99737078f},
-std::array<float,2>{0.0588727035f, 0.375242442f},
-std::array<float,2>{0.659220874f, 0.345391184f},
-std::array<float,2>{0.403045803f, 0.831727326f},
-std::array<float,2>{0.754605412f, 0.722900927f},
-std::array<float,2>{0.0881512538f, 0.0627711043f},
-std::array<float,2>{0.979512513f, 0.224955708f},
-std::array<float,2>{0.209684804f, 0.599514842f},
-std::array<float,2>{0.520621777f, 0.921076179f},
-std::array<float,2>{0.289913863f, 0.491887838f},
-std::array<float,2>{0.821881711f, 0.436151624f},
-std::array<float,2>{0.0276823509f, 0.967708468f},
-std::array<float,2>{0.738405108f, 0.529281676f},
-std::array<float,2>{0.454582572f, 0.140599877f},
-std::array<float,2>{0.601632237f, 0.0506324619f},
-std::array<float,2>{0.355647892f, 0.644143879f},
-std::array<float,2>{0.91788125f, 0.756660998f},
-std::array<float,2>{0.170934036f, 0.275131434f},
-std::array<float,2>{0.53003037f, 0.315363705f},
-std::array<float,2>{0.285032332f, 0.870189309f},
-std::array<float,2>{0.968910396f, 0.69320792f},
-std::array<float,2>{0.213742852f, 0.122119412f},
-std::array<float,2>{0.761622667f, 0.217554629f},
-std::array<float,2>{0.0815024897f, 0.57168287f},
-std::array<float,2>{0.665858686f, 0.904827893f},
-std::array<float,2>{0.396888644f, 0.446906984f},
-std::array<float,2>{0.912473679f, 0.388778955f},
-std::array<float,2>{0.160477489f, 0.985026836f},
-std::array<float,2>{0.596102178f, 0.55076164f},
-std::array<float,2>{0.345264614f, 0.183808461f},
-std::array<float,2>{0.748268187f, 0.00123132626f},
-std::array<float,2>{0.467375964f, 0.68737042f},
-std::array<float,2>{0.812517643f, 0.80160439f},
-std::array<float,2>{0.0188918822f, 0.284131169f},
-std::array<float,2>{0.641544759f, 0.493881971f},
-std::array<float,2>{0.436737269f, 0.91190505f},
-std::array<float,2>{0.791393638f, 0.606275618f},
-std::array<float,2>{0.114034154f, 0.232138112f},
-std::array<float,2>{0.940828443f, 0.0708617344f},
-std::array<float,2>{0.235235527f, 0.728170395f},
-std::array<float,2>{0.53612268f, 0.842250884f},
-std::array<float,2>{0.258002162f, 0.356251329f},
-std::array<float,2>{0.844865024f, 0.271428645f},
-std::array<float,2>{0.0537564345f, 0.759610772f},
-std::array<float,2>{0.704063416f, 0.655377507f},
-std::array<float,2>{0.496919215f, 0.0568784289f},
-std::array<float,2>{0.564529121f, 0.131403238f},
-std::array<float,2>{0.330429435f, 0.519911587f},
-std::array<float,2>{0.875628531f, 0.955497503f},
-std::array<float,2>{0.131577149f, 0.429484487f},
-std::array<float,2>{0.624637783f, 0.407520324f},
-std::array<float,2>{0.360535413f, 0.947760224f},
-std::array<float,2>{0.936008453f, 0.500908434f},
-std::array<float,2>{0.174448222f, 0.153286517f},
-std::array<float,2>{0.828230739f, 0.0391377173f},
-std::array<float,2>{0.00841910671f, 0.635424137f},
-std::array<float,2>{0.722215533f, 0.768037438f},
-std::array<float,2>{0.450496674f, 0.260090798f},
-std::array<float,2>{0.986031353f, 0.363675654f},
-std::array<float,2>{0.197984606f, 0.826110661f},
-std::array<float,2>{0.504426539f, 0.748194039f},
-std::array<float,2>{0.309925914f, 0.0862463564f},
-std::array<float,2>{0.685983181f, 0.242937312f},
-std::array<float,2>{0.379520476f, 0.617033005f},
-std::array<float,2>{0.777203619f, 0.922142506f},
-std::array<float,2>{0.0757407397f, 0.475619555f},
-std::array<float,2>{0.702799976f, 0.305747956f},
-std::array<float,2>{0.474021971f, 0.784548342f},
-std::array<float,2>{0.860821247f, 0.659980059f},
-std::array<float,2>{0.0390168056f, 0.031030219f},
-std::array<float,2>{0.895832419f, 0.156548873f},
-std::array<float,2>{0.154864743f, 0.540708005f},
-std::array<float,2>{0.582213104f, 0.983304083f},
-std::array<float,2>{0.313111693f, 0.404823184f},
-std::array<float,2>{0.809265077f, 0.457792431f},
-std::array<float,2>{0.0963392705f, 0.890310585f},
-std::array<float,2>{0.631074846f, 0.583394945f},
-std::array<float,2>{0.41569826f, 0.191935077f},
-std::array<float,2>{0.562232792f, 0.105843693f},
-std::array<float,2>{0.279792815f, 0.713895559f},
-std::array<float,2>{0.958492041f, 0.857968986f},
-std::array<float,2>{0.228071138f, 0.334895492f},
-std::array<float,2>{0.508693516f, 0.269219905f},
-std::array<float,2>{0.297233284f, 0.763793588f},
-std::array<float,2>{0.997125268f, 0.64917767f},
-std::array<float,2>{0.188875094f, 0.0617534406f},
-std::array<float,2>{0.767283261f, 0.127280354f},
-std::array<float,2>{0.0688533485f, 0.518107355f},
-std::array<float,2>{0.677231431f, 0.959567964f},
-std::array<float,2>{0.387299269f, 0.423060566f},
-std::array<float,2>{0.92257452f, 0.496454149f},
-std::array<float,2>{0.18359521f, 0.90652144f},
-std::array<float,2>{0.610954583f, 0.602098882f},
-std::array<float,2>{0.371977478f, 0.228567794f},
-std::array<float,2>{0.729088604f, 0.0755479336f},
-std::array<float,2>{0.438898921f, 0.731219113f},
-std::array<float,2>{0.838609636f, 0.839452147f},
-std::array<float,2>{0.0067955656f, 0.352604389f},
-std::array<float,2>{0.636424482f, 0.3837156f},
-std::array<float,2>{0.408884764f, 0.99045521f},
-std::array<float,2>{0.801516175f, 0.551796675f},
-std::array<float,2>{0.10472104f, 0.180564642f},
-std::array<float,2>{0.962417185f, 0.00763350772f},
-std::array<float,2>{0.223746851f, 0.680939257f},
-std::array<float,2>{0.549655855f, 0.796900809f},
-std::array<float,2>{0.267496824f, 0.28673014f},
-std::array<float,2>{0.871434569f, 0.3200109f},
-std::array<float,2>{0.0404328778f, 0.873638034f},
-std::array<float,2>{0.690328002f, 0.687839568f},
-std::array<float,2>{0.477682412f, 0.118379258f},
-std::array<float,2>{0.587572575f, 0.21153596f},
-std::array<float,2>{0.321997941f, 0.577407897f},
-std::array<float,2>{0.902870774f, 0.898835301f},
-std::array<float,2>{0.141658515f, 0.452137679f},
-std::array<float,2>{0.609131277f, 0.454310745f},
-std::array<float,2>{0.352108121f, 0.885697007f},
-std::array<float,2>{0.919398129f, 0.581272066f},
-std::array<float,2>{0.165643483f, 0.187591374f},
-std::array<float,2>{0.827707767f, 0.104310423f},
-std::array<float,2>{0.0248369612f, 0.716599703f},
-std::array<float,2>{0.735191643f, 0.853577256f},
-std::array<float,2>{0.460666507f, 0.329587489f},
-std::array<float,2>{0.980984628f, 0.311933249f},
-std::array<float,2>{0.204061076f, 0.785836339f},
-std::array<float,2>{0.518737078f, 0.661450326f},
-std::array<float,2>{0.295726627f, 0.0255000796f},
-std::array<float,2>{0.661360681f, 0.162251055f},
-std::array<float,2>{0.399440497f, 0.545955241f},
-std::array<float,2>{0.753881693f, 0.977021217f},
-std::array<float,2>{0.0911681205f, 0.399595529f},
-std::array<float,2>{0.712318659f, 0.360222608f},
-std::array<float,2>{0.487421662f, 0.822466016f},
-std::array<float,2>{0.858318388f, 0.742334366f},
-std::array<float,2>{0.0553061552f, 0.090091683f},
-std::array<float,2>{0.890355647f, 0.246492386f},
-std::array<float,2>{0.138596877f, 0.612238228f},
-std::array<float,2>{0.575761318f, 0.92869854f},
-std::array<float,2>{0.339753956f, 0.47231105f},
-std::array<float,2>{0.785376728f, 0.410621643f},
-std::array<float,2>{0.124661133f, 0.952550232f},
-std::array<float,2>{0.653367519f, 0.504081845f},
-std::array<float,2>{0.422281146f, 0.151178718f},
-std::array<float,2>{0.540600419f, 0.0445258468f},
-std::array<float,2>{0.257348865f, 0.638692319f},
-std::array<float,2>{0.949970067f, 0.771703601f},
-std::array<float,2>{0.246011198f, 0.26502198f},
-std::array<float,2>{0.57018435f, 0.342645317f},
-std::array<float,2>{0.333745986f, 0.84504956f},
-std::array<float,2>{0.881898403f, 0.705310702f},
-std::array<float,2>{0.125550836f, 0.0960767642f},
-std::array<float,2>{0.849540174f, 0.195950225f},
-std::array<float,2>{0.0469256155f, 0.588341117f},
-std::array<float,2>{0.707869112f, 0.875611246f},
-std::array<float,2>{0.493332505f, 0.465556115f},
-std::array<float,2>{0.94171828f, 0.395424604f},
-std::array<float,2>{0.240163088f, 0.971495926f},
-std::array<float,2>{0.532830238f, 0.5355196f},
-std::array<float,2>{0.265506864f, 0.164611056f},
-std::array<float,2>{0.647213578f, 0.0180038493f},
-std::array<float,2>{0.432872683f, 0.666882992f},
-std::array<float,2>{0.794292092f, 0.789123356f},
-std::array<float,2>{0.110715576f, 0.299700916f},
-std::array<float,2>{0.743122637f, 0.478069097f},
-std::array<float,2>{0.462428242f, 0.930932879f},
-std::array<float,2>{0.818451107f, 0.62071532f},
-std::array<float,2>{0.02235578f, 0.239826471f},
-std::array<float,2>{0.907369018f, 0.0793456212f},
-std::array<float,2>{0.158226505f, 0.738346398f},
-std::array<float,2>{0.599960029f, 0.817681015f},
-std::array<float,2>{0.34984535f, 0.369428307f},
-std::array<float,2>{0.764783144f, 0.251967818f},
-std::array<float,2>{0.0821985304f, 0.77687782f},
-std::array<float,2>{0.670204878f, 0.632786155f},
-std::array<float,2>{0.392618597f, 0.0349307805f},
-std::array<float,2>{0.525235355f, 0.142634928f},
-std::array<float,2>{0.288639903f, 0.508821011f},
-std::array<float,2>{0.973692715f, 0.939880848f},
-std::array<float,2>{0.215446323f, 0.419245899f},
-std::array<float,2>{0.55721426f, 0.433550268f},
-std::array<float,2>{0.276404172f, 0.963336408f},
-std::array<float,2>{0.956733882f, 0.523439884f},
-std::array<float,2>{0.233312696f, 0.135992542f},
-std::array<float,2>{0.807437003f, 0.0532430448f},
-std::array<float,2>{0.0983392671f, 0.647688746f},
-std::array<float,2>{0.626999438f, 0.750631869f},
-std::array<float,2>{0.419502467f, 0.28089115f},
-std::array<float,2>{0.893120885f, 0.350874513f},
-std::array<float,2>{0.149113178f, 0.834903657f},
-std::array<float,2>{0.58090204f, 0.719663501f},
-std::array<float,2>{0.318051636f, 0.0698436797f},
-std::array<float,2>{0.696332872f, 0.219273433f},
-std::array<float,2>{0.47059682f, 0.596815944f},
-std::array<float,2>{0.866969943f, 0.917905509f},
-std::array<float,2>{0.0341080055f, 0.48523736f},
-std::array<float,2>{0.68275851f, 0.289455414f},
-std::array<float,2>{0.376064599f, 0.808269858f},
-std::array<float,2>{0.77999264f, 0.678810179f},
-std::array<float,2>{0.0721758157f, 0.00890921615f},
-std::array<float,2>{0.989358306f, 0.171974316f},
-std::array<float,2>{0.200385317f, 0.554915845f},
-std::array<float,2>{0.500091314f, 0.994449258f},
-std::array<float,2>{0.305708945f, 0.379590362f},
-std::array<float,2>{0.833745778f, 0.444754511f},
-std::array<float,2>{0.0133215487f, 0.891350448f},
-std::array<float,2>{0.724315882f, 0.570114493f},
-std::array<float,2>{0.448065221f, 0.20846051f},
-std::array<float,2>{0.619216263f, 0.114110425f},
-std::array<float,2>{0.365491062f, 0.698699594f},
-std::array<float,2>{0.930487752f, 0.859642267f},
-std::array<float,2>{0.178362966f, 0.321207911f},
-std::array<float,2>{0.616397202f, 0.304304808f},
-std::array<float,2>{0.368030369f, 0.794240177f},
-std::array<float,2>{0.929418504f, 0.668257475f},
-std::array<float,2>{0.182024434f, 0.020624429f},
-std::array<float,2>{0.843589187f, 0.170765176f},
-std::array<float,2>{0.00129943516f, 0.534906328f},
-std::array<float,2>{0.732470512f, 0.97336036f},
-std::array<float,2>{0.444746792f, 0.390997827f},
-std::array<float,2>{0.992492676f, 0.462309122f},
-std::array<float,2>{0.194933653f, 0.880986631f},
-std::array<float,2>{0.512453735f, 0.59342885f},
-std::array<float,2>{0.301557362f, 0.200446561f},
-std::array<float,2>{0.674847662f, 0.10130547f},
-std::array<float,2>{0.383335114f, 0.707468808f},
-std::array<float,2>{0.771566212f, 0.849217713f},
-std::array<float,2>{0.0643770322f, 0.338389397f},
-std::array<float,2>{0.694380939f, 0.415443331f},
-std::array<float,2>{0.480835795f, 0.94152385f},
-std::array<float,2>{0.868703842f, 0.514783621f},
-std::array<float,2>{0.0443882979f, 0.146152824f},
-std::array<float,2>{0.901183486f, 0.0382555611f},
-std::array<float,2>{0.144909844f, 0.626176715f},
-std::array<float,2>{0.591888666f, 0.77850765f},
-std::array<float,2>{0.325086385f, 0.255748481f},
-std::array<float,2>{0.798181474f, 0.374402195f},
-std::array<float,2>{0.10815078f, 0.81591332f},
-std::array<float,2>{0.637985766f, 0.735452414f},
-std::array<float,2>{0.4104231f, 0.0833471566f},
-std::array<float,2>{0.553057909f, 0.235993296f},
-std::array<float,2>{0.271786958f, 0.624258816f},
-std::array<float,2>{0.967175543f, 0.937130988f},
-std::array<float,2>{0.220534027f, 0.481654704f},
-std::array<float,2>{0.522757173f, 0.490058184f},
-std::array<float,2>{0.291234791f, 0.918709695f},
-std::array<float,2>{0.977461874f, 0.601236761f},
-std::array<float,2>{0.207166955f, 0.223103359f},
-std::array<float,2>{0.756644487f, 0.0658983067f},
-std::array<float,2>{0.0867751911f, 0.72464174f},
-std::array<float,2>{0.65710932f, 0.828586817f},
-std::array<float,2>{0.404724211f, 0.346265972f},
-std::array<float,2>{0.915805757f, 0.276049942f},
-std::array<float,2>{0.168417037f, 0.755617559f},
-std::array<float,2>{0.604405761f, 0.64243257f},
-std::array<float,2>{0.358036399f, 0.047318574f},
-std::array<float,2>{0.741058767f, 0.138021693f},
-std::array<float,2>{0.455951661f, 0.530173063f},
-std::array<float,2>{0.823260486f, 0.966292977f},
-std::array<float,2>{0.0295852255f, 0.434321314f},
-std::array<float,2>{0.651032746f, 0.324868262f},
-std::array<float,2>{0.426380485f, 0.866047084f},
-std::array<float,2>{0.782357812f, 0.699617684f},
-std::array<float,2>{0.120643668f, 0.111236095f},
-std::array<float,2>{0.945726335f, 0.205359906f},
-std::array<float,2>{0.247867063f, 0.56520927f},
-std::array<float,2>{0.543172181f, 0.895964861f},
-std::array<float,2>{0.25070259f, 0.4387573f},
-std::array<float,2>{0.852098584f, 0.378895015f},
-std::array<float,2>{0.0619909391f, 0.99857235f},
-std::array<float,2>{0.715974033f, 0.560792148f},
-std::array<float,2>{0.489214361f, 0.178060174f},
-std::array<float,2>{0.573321283f, 0.0125640063f},
-std::array<float,2>{0.343432963f, 0.672867715f},
-std::array<float,2>{0.883692086f, 0.810122132f},
-std::array<float,2>{0.135846749f, 0.293567151f},
-std::array<float,2>{0.538919449f, 0.358312339f},
-std::array<float,2>{0.260793447f, 0.841409624f},
-std::array<float,2>{0.939354479f, 0.729106128f},
-std::array<float,2>{0.237960473f, 0.0722876489f},
-std::array<float,2>{0.789636195f, 0.23412478f},
-std::array<float,2>{0.11578384f, 0.609085143f},
-std::array<float,2>{0.643782914f, 0.91280365f},
-std::array<float,2>{0.435304672f, 0.495738804f},
-std::array<float,2>{0.877711773f, 0.427485645f},
-std::array<float,2>{0.129714206f, 0.954242527f},
-std::array<float,2>{0.56310904f, 0.521651387f},
-std::array<float,2>{0.329193443f, 0.130315006f},
-std::array<float,2>{0.706392884f, 0.0553108007f},
-std::array<float,2>{0.499420822f, 0.653621674f},
-std::array<float,2>{0.847025454f, 0.761705816f},
-std::array<float,2>{0.051603239f, 0.272444755f},
-std::array<float,2>{0.666234255f, 0.448784173f},
-std::array<float,2>{0.395256728f, 0.903836966f},
-std::array<float,2>{0.758667231f, 0.57292223f},
-std::array<float,2>{0.0791927949f, 0.216255575f},
-std::array<float,2>{0.971702337f, 0.124475487f},
-std::array<float,2>{0.211858064f, 0.69418782f},
-std::array<float,2>{0.528566957f, 0.86777705f},
-std::array<float,2>{0.282776207f, 0.313488901f},
-std::array<float,2>{0.81627804f, 0.282164484f},
-std::array<float,2>{0.0159594193f, 0.804312229f},
-std::array<float,2>{0.746724188f, 0.683983028f},
-std::array<float,2>{0.465765715f, 0.0032716f},
-std::array<float,2>{0.595552206f, 0.187313661f},
-std::array<float,2>{0.347407103f, 0.547441423f},
-std::array<float,2>{0.91128844f, 0.98815763f},
-std::array<float,2>{0.16301769f, 0.386983782f},
-std::array<float,2>{0.585596919f, 0.402779996f},
-std::array<float,2>{0.314828813f, 0.981595695f},
-std::array<float,2>{0.897660136f, 0.542693794f},
-std::array<float,2>{0.153943285f, 0.159511372f},
-std::array<float,2>{0.862751842f, 0.0292399246f},
-std::array<float,2>{0.0363371707f, 0.657662988f},
-std::array<float,2>{0.699936628f, 0.782093644f},
-std::array<float,2>{0.474633992f, 0.307396978f},
-std::array<float,2>{0.959448934f, 0.332716554f},
-std::array<float,2>{0.229451656f, 0.857281864f},
-std::array<float,2>{0.559623241f, 0.71286267f},
-std::array<float,2>{0.278996706f, 0.108160414f},
-std::array<float,2>{0.629120827f, 0.193895802f},
-std::array<float,2>{0.41655311f, 0.584258676f},
-std::array<float,2>{0.812240601f, 0.887687385f},
-std::array<float,2>{0.0946079567f, 0.459991783f},
-std::array<float,2>{0.720527887f, 0.257925838f},
-std::array<float,2>{0.45308286f, 0.766750455f},
-std::array<float,2>{0.830285609f, 0.633320928f},
-std::array<float,2>{0.0109799234f, 0.0412076749f},
-std::array<float,2>{0.934994638f, 0.156030804f},
-std::array<float,2>{0.172623172f, 0.502845228f},
-std::array<float,2>{0.622393966f, 0.945470333f},
-std::array<float,2>{0.362214953f, 0.408592641f},
-std::array<float,2>{0.773867309f, 0.474188954f},
-std::array<float,2>{0.0777333826f, 0.925513148f},
-std::array<float,2>{0.683617175f, 0.614690542f},
-std::array<float,2>{0.382563621f, 0.244504228f},
-std::array<float,2>{0.506689906f, 0.0895782262f},
-std::array<float,2>{0.312047988f, 0.747104824f},
-std::array<float,2>{0.986341f, 0.827229321f},
-std::array<float,2>{0.195903316f, 0.366777718f},
-std::array<float,2>{0.552237988f, 0.254510403f},
-std::array<float,2>{0.270729631f, 0.777513206f},
-std::array<float,2>{0.966631114f, 0.62519908f},
-std::array<float,2>{0.221105307f, 0.038040258f},
-std::array<float,2>{0.800408721f, 0.145185038f},
-std::array<float,2>{0.105473384f, 0.514411271f},
-std::array<float,2>{0.639390349f, 0.942658782f},
-std::array<float,2>{0.412887484f, 0.414768994f},
-std::array<float,2>{0.898453712f, 0.480849385f},
-std::array<float,2>{0.147538707f, 0.936357737f},
-std::array<float,2>{0.591421485f, 0.623503089f},
-std::array<float,2>{0.326235771f, 0.234867483f},
-std::array<float,2>{0.69269681f, 0.0828247741f},
-std::array<float,2>{0.484196067f, 0.73518604f},
-std::array<float,2>{0.870242119f, 0.814536631f},
-std::array<float,2>{0.0450770408f, 0.373756737f},
-std::array<float,2>{0.672415853f, 0.391969502f},
-std::array<float,2>{0.384841502f, 0.973944843f},
-std::array<float,2>{0.769786835f, 0.534092665f},
-std::array<float,2>{0.0655809566f, 0.171309873f},
-std::array<float,2>{0.994322896f, 0.0203826744f},
-std::array<float,2>{0.192085847f, 0.669209957f},
-std::array<float,2>{0.514189601f, 0.793568909f},
-std::array<float,2>{0.303560466f, 0.303314358f},
-std::array<float,2>{0.841001332f, 0.339415282f},
-std::array<float,2>{0.00215100893f, 0.848462999f},
-std::array<float,2>{0.731431723f, 0.708417475f},
-std::array<float,2>{0.442138195f, 0.100094177f},
-std::array<float,2>{0.614629507f, 0.19948259f},
-std::array<float,2>{0.36988166f, 0.591994941f},
-std::array<float,2>{0.926401854f, 0.882313669f},
-std::array<float,2>{0.180521205f, 0.461892635f},
-std::array<float,2>{0.570495069f, 0.438405156f},
-std::array<float,2>{0.341493368f, 0.894615591f},
-std::array<float,2>{0.884994686f, 0.566282511f},
-std::array<float,2>{0.133487791f, 0.206890121f},
-std::array<float,2>{0.853590429f, 0.109539226f},
-std::array<float,2>{0.0587318055f, 0.700469613f},
-std::array<float,2>{0.717084527f, 0.866247594f},
-std::array<float,2>{0.490688771f, 0.325678915f},
-std::array<float,2>{0.947562933f, 0.294708043f},
-std::array<float,2>{0.249564156f, 0.808989465f},
-std::array<float,2>{0.545629621f, 0.671886265f},
-std::array<float,2>{0.252794921f, 0.013397173f},
-std::array<float,2>{0.649152279f, 0.179323703f},
-std::array<float,2>{0.429514289f, 0.561837256f},
-std::array<float,2>{0.784663498f, 0.999803782f},
-std::array<float,2>{0.118603326f, 0.377765119f},
-std::array<float,2>{0.738701522f, 0.347100943f},
-std::array<float,2>{0.454107404f, 0.829426646f},
-std::array<float,2>{0.822126567f, 0.72610718f},
-std::array<float,2>{0.0274050403f, 0.0654068068f},
-std::array<float,2>{0.917720139f, 0.224164188f},
-std::array<float,2>{0.171358958f, 0.600351512f},
-std::array<float,2>{0.60197854f, 0.919863641f},
-std::array<float,2>{0.355795711f, 0.48893702f},
-std::array<float,2>{0.754880071f, 0.434592396f},
-std::array<float,2>{0.0880291313f, 0.965361178f},
-std::array<float,2>{0.659502089f, 0.531147182f},
-std::array<float,2>{0.403255254f, 0.136869386f},
-std::array<float,2>{0.520962894f, 0.0479968004f},
-std::array<float,2>{0.289720982f, 0.641204834f},
-std::array<float,2>{0.979901314f, 0.754703879f},
-std::array<float,2>{0.209852383f, 0.276826233f},
-std::array<float,2>{0.595913708f, 0.312527597f},
-std::array<float,2>{0.345536441f, 0.868883908f},
-std::array<float,2>{0.912351072f, 0.694972157f},
-std::array<float,2>{0.160217091f, 0.123054914f},
-std::array<float,2>{0.812779367f, 0.215471521f},
-std::array<float,2>{0.0187285226f, 0.573763609f},
-std::array<float,2>{0.748456657f, 0.902532995f},
-std::array<float,2>{0.467537165f, 0.44777602f},
-std::array<float,2>{0.969051659f, 0.38802734f},
-std::array<float,2>{0.213559911f, 0.98648119f},
-std::array<float,2>{0.529877663f, 0.548306108f},
-std::array<float,2>{0.28480345f, 0.186344668f},
-std::array<float,2>{0.665594578f, 0.00229038415f},
-std::array<float,2>{0.396565557f, 0.68495059f},
-std::array<float,2>{0.761248291f, 0.803332865f},
-std::array<float,2>{0.0811107159f, 0.28270489f},
-std::array<float,2>{0.703780949f, 0.494347841f},
-std::array<float,2>{0.496730357f, 0.913860202f},
-std::array<float,2>{0.845192492f, 0.607875764f},
-std::array<float,2>{0.0541841425f, 0.232945561f},
-std::array<float,2>{0.875946879f, 0.074177973f},
-std::array<float,2>{0.131817043f, 0.730040729f},
-std::array<float,2>{0.564801276f, 0.839999557f},
-std::array<float,2>{0.330184221f, 0.359325707f},
-std::array<float,2>{0.791242182f, 0.272658885f},
-std::array<float,2>{0.11377342f, 0.760068953f},
-std::array<float,2>{0.641219378f, 0.65278393f},
-std::array<float,2>{0.436780989f, 0.0556666479f},
-std::array<float,2>{0.535684943f, 0.12947537f},
-std::array<float,2>{0.258086205f, 0.522551537f},
-std::array<float,2>{0.940622151f, 0.953741848f},
-std::array<float,2>{0.235049367f, 0.426154792f},
-std::array<float,2>{0.504819691f, 0.409181625f},
-std::array<float,2>{0.309811175f, 0.94638294f},
-std::array<float,2>{0.986142159f, 0.503489375f},
-std::array<float,2>{0.198182717f, 0.154819623f},
-std::array<float,2>{0.776923239f, 0.0424914248f},
-std::array<float,2>{0.076097846f, 0.634555399f},
-std::array<float,2>{0.685683727f, 0.76648283f},
-std::array<float,2>{0.37976253f, 0.259441972f},
-std::array<float,2>{0.935548723f, 0.365286291f},
-std::array<float,2>{0.174651101f, 0.826729834f},
-std::array<float,2>{0.624920964f, 0.746344805f},
-std::array<float,2>{0.36059767f, 0.0887079537f},
-std::array<float,2>{0.722633362f, 0.245749474f},
-std::array<float,2>{0.450280786f, 0.614183903f},
-std::array<float,2>{0.828486502f, 0.92423135f},
-std::array<float,2>{0.00878108852f, 0.473631442f},
-std::array<float,2>{0.631220043f, 0.308408707f},
-std::array<float,2>{0.415939361f, 0.782953918f},
-std::array<float,2>{0.80953151f, 0.656859279f},
-std::array<float,2>{0.0966092944f, 0.0278857071f},
-std::array<float,2>{0.958054841f, 0.158706784f},
-std::array<float,2>{0.228424147f, 0.541532695f},
-std::array<float,2>{0.562267661f, 0.98117274f},
-std::array<float,2>{0.280185342f, 0.403781742f},
-std::array<float,2>{0.860354662f, 0.459755391f},
-std::array<float,2>{0.0386290997f, 0.888391852f},
-std::array<float,2>{0.703099012f, 0.585330069f},
-std::array<float,2>{0.473871171f, 0.194835469f},
-std::array<float,2>{0.582377255f, 0.108941413f},
-std::array<float,2>{0.313462138f, 0.711176932f},
-std::array<float,2>{0.895722628f, 0.856185377f},
-std::array<float,2>{0.155259565f, 0.333280861f},
-std::array<float,2>{0.589115262f, 0.286114633f},
-std::array<float,2>{0.323425591f, 0.798150003f},
-std::array<float,2>{0.905911863f, 0.679895818f},
-std::array<float,2>{0.143678129f, 0.00663183723f},
-std::array<float,2>{0.874194026f, 0.181447461f},
-std::array<float,2>{0.0420038365f, 0.55141741f},
-std::array<float,2>{0.688168824f, 0.991671681f},
-std::array<float,2>{0.480203003f, 0.384262651f},
-std::array<float,2>{0.964127481f, 0.453073949f},
-std::array<float,2>{0.225275546f, 0.900145054f},
-std::array<float,2>{0.547619998f, 0.576695025f},
-std::array<float,2>{0.267916411f, 0.21270515f},
-std::array<float,2>{0.633918166f, 0.117461652f},
-std::array<float,2>{0.406882823f, 0.689249754f},
-std::array<float,2>{0.802931249f, 0.874821961f},
-std::array<float,2>{0.101892211f, 0.318907261f},
-std::array<float,2>{0.726641655f, 0.422281504f},
-std::array<float,2>{0.440157324f, 0.960870624f},
-std::array<float,2>{0.836201012f, 0.51869297f},
-std::array<float,2>{0.0045263404f, 0.128507212f},
-std::array<float,2>{0.924905241f, 0.0610554293f},
-std::array<float,2>{0.186928138f, 0.650021493f},
-std::array<float,2>{0.611537457f, 0.765424132f},
-std::array<float,2>{0.373661846f, 0.268389523f},
-std::array<float,2>{0.768180549f, 0.351637483f},
-std::array<float,2>{0.0673307553f, 0.838282645f},
-std::array<float,2>{0.67911011f, 0.732399464f},
-std::array<float,2>{0.389021069f, 0.0748805478f},
-std::array<float,2>{0.510862589f, 0.229920685f},
-std::array<float,2>{0.300211638f, 0.602631569f},
-std::array<float,2>{0.999469399f, 0.907993317f},
-std::array<float,2>{0.189761832f, 0.497140199f},
-std::array<float,2>{0.541612327f, 0.470976532f},
-std::array<float,2>{0.254411668f, 0.929604113f},
-std::array<float,2>{0.951670706f, 0.612649798f},
-std::array<float,2>{0.243456259f, 0.247404501f},
-std::array<float,2>{0.787145674f, 0.0917312503f},
-std::array<float,2>{0.122982703f, 0.743866742f},
-std::array<float,2>{0.656185687f, 0.823912084f},
-std::array<float,2>{0.425511986f, 0.360976636f},
-std::array<float,2>{0.88849932f, 0.263904512f},
-std::array<float,2>{0.140006006f, 0.772629201f},
-std::array<float,2>{0.576846242f, 0.640302777f},
-std::array<float,2>{0.337256163f, 0.0435616672f},
-std::array<float,2>{0.713304281f, 0.152106121f},
-std::array<float,2>{0.485440135f, 0.505448341f},
-std::array<float,2>{0.856931686f, 0.951787353f},
-std::array<float,2>{0.0566468015f, 0.411144823f},
-std::array<float,2>{0.663157821f, 0.328360677f},
-std::array<float,2>{0.401275992f, 0.85511601f},
-std::array<float,2>{0.75153023f, 0.715086281f},
-std::array<float,2>{0.0927769616f, 0.105014913f},
-std::array<float,2>{0.983364165f, 0.189142376f},
-std::array<float,2>{0.205331638f, 0.580725908f},
-std::array<float,2>{0.517368019f, 0.886680961f},
-std::array<float,2>{0.29476282f, 0.453249961f},
-std::array<float,2>{0.824801326f, 0.398657531f},
-std::array<float,2>{0.0258364063f, 0.977923691f},
-std::array<float,2>{0.737332046f, 0.545811832f},
-std::array<float,2>{0.458251148f, 0.163134396f},
-std::array<float,2>{0.606608748f, 0.0273106359f},
-std::array<float,2>{0.355353832f, 0.660730183f},
-std::array<float,2>{0.919927537f, 0.78680253f},
-std::array<float,2>{0.16656974f, 0.311056256f},
-std::array<float,2>{0.526001215f, 0.370224267f},
-std::array<float,2>{0.286026716f, 0.816442549f},
-std::array<float,2>{0.975509107f, 0.739918888f},
-std::array<float,2>{0.218623012f, 0.0788320452f},
-std::array<float,2>{0.763090432f, 0.238956317f},
-std::array<float,2>{0.0857332498f, 0.619934976f},
-std::array<float,2>{0.668233931f, 0.930343866f},
-std::array<float,2>{0.39062655f, 0.477010578f},
-std::array<float,2>{0.909182131f, 0.418907583f},
-std::array<float,2>{0.157311499f, 0.940580785f},
-std::array<float,2>{0.599510431f, 0.508035898f},
-std::array<float,2>{0.348829567f, 0.143954322f},
-std::array<float,2>{0.744376898f, 0.0336794965f},
-std::array<float,2>{0.463943005f, 0.631524503f},
-std::array<float,2>{0.816579521f, 0.776198268f},
-std::array<float,2>{0.0200316794f, 0.253284812f},
-std::array<float,2>{0.6460886f, 0.466552973f},
-std::array<float,2>{0.431210339f, 0.876106799f},
-std::array<float,2>{0.795328498f, 0.58893919f},
-std::array<float,2>{0.113012344f, 0.196290895f},
-std::array<float,2>{0.945185781f, 0.0969345644f},
-std::array<float,2>{0.241403833f, 0.70698458f},
-std::array<float,2>{0.534819067f, 0.843895435f},
-std::array<float,2>{0.263642102f, 0.34289059f},
-std::array<float,2>{0.851323664f, 0.299845755f},
-std::array<float,2>{0.0490460396f, 0.790738881f},
-std::array<float,2>{0.710054159f, 0.667338729f},
-std::array<float,2>{0.495852292f, 0.0192068461f},
-std::array<float,2>{0.566958725f, 0.165081128f},
-std::array<float,2>{0.33440733f, 0.536752999f},
-std::array<float,2>{0.879143715f, 0.972028434f},
-std::array<float,2>{0.1282361f, 0.395967662f},
-std::array<float,2>{0.618740857f, 0.38025102f},
-std::array<float,2>{0.363601446f, 0.995568931f},
-std::array<float,2>{0.933225334f, 0.555738747f},
-std::array<float,2>{0.176356658f, 0.172932819f},
-std::array<float,2>{0.834124982f, 0.00844259094f},
-std::array<float,2>{0.0155341392f, 0.678710043f},
-std::array<float,2>{0.725553989f, 0.806951106f},
-std::array<float,2>{0.445957631f, 0.290770739f},
-std::array<float,2>{0.9918136f, 0.322006255f},
-std::array<float,2>{0.201505333f, 0.860431015f},
-std::array<float,2>{0.502482653f, 0.697817326f},
-std::array<float,2>{0.308097541f, 0.114388138f},
-std::array<float,2>{0.680123568f, 0.207665116f},
-std::array<float,2>{0.378011674f, 0.568704486f},
-std::array<float,2>{0.778711319f, 0.891702652f},
-std::array<float,2>{0.0724087134f, 0.443860173f},
-std::array<float,2>{0.699062467f, 0.280069202f},
-std::array<float,2>{0.471016556f, 0.751504302f},
-std::array<float,2>{0.863447666f, 0.647033036f},
-std::array<float,2>{0.0323997252f, 0.0538240671f},
-std::array<float,2>{0.891358078f, 0.135134503f},
-std::array<float,2>{0.150966808f, 0.52519536f},
-std::array<float,2>{0.578820348f, 0.963868618f},
-std::array<float,2>{0.319354773f, 0.432185948f},
-std::array<float,2>{0.805118203f, 0.485492289f},
-std::array<float,2>{0.0996642858f, 0.916090727f},
-std::array<float,2>{0.626723945f, 0.596181214f},
-std::array<float,2>{0.420928955f, 0.219989926f},
-std::array<float,2>{0.555474579f, 0.0684407204f},
-std::array<float,2>{0.274916977f, 0.720227122f},
-std::array<float,2>{0.954285324f, 0.835541725f},
-std::array<float,2>{0.231218576f, 0.350572646f},
-std::array<float,2>{0.512255132f, 0.302696377f},
-std::array<float,2>{0.301283866f, 0.795713305f},
-std::array<float,2>{0.992286205f, 0.670558691f},
-std::array<float,2>{0.195128441f, 0.0230996087f},
-std::array<float,2>{0.771870732f, 0.169836655f},
-std::array<float,2>{0.064152807f, 0.532846987f},
-std::array<float,2>{0.675179362f, 0.976061761f},
-std::array<float,2>{0.383728713f, 0.39283967f},
-std::array<float,2>{0.929641783f, 0.464073241f},
-std::array<float,2>{0.181832746f, 0.879081368f},
-std::array<float,2>{0.616526783f, 0.590835512f},
-std::array<float,2>{0.367731363f, 0.20206663f},
-std::array<float,2>{0.732843876f, 0.0982285216f},
-std::array<float,2>{0.444526613f, 0.709113061f},
-std::array<float,2>{0.843358576f, 0.850107491f},
-std::array<float,2>{0.00114872726f, 0.336657912f},
-std::array<float,2>{0.637823045f, 0.416329414f},
-std::array<float,2>{0.410202742f, 0.944334447f},
-std::array<float,2>{0.797967076f, 0.511979818f},
-std::array<float,2>{0.108265489f, 0.148333684f},
-std::array<float,2>{0.966908872f, 0.0355899669f},
-std::array<float,2>{0.220407605f, 0.627687812f},
-std::array<float,2>{0.552790642f, 0.779911757f},
-std::array<float,2>{0.271564662f, 0.256157666f},
-std::array<float,2>{0.868928909f, 0.372983694f},
-std::array<float,2>{0.0441608615f, 0.814265668f},
-std::array<float,2>{0.694620669f, 0.736434877f},
-std::array<float,2>{0.480475634f, 0.0844774246f},
-std::array<float,2>{0.592209339f, 0.237157896f},
-std::array<float,2>{0.32489115f, 0.622595131f},
-std::array<float,2>{0.901110351f, 0.934142709f},
-std::array<float,2>{0.144620329f, 0.483402282f},
-std::array<float,2>{0.604092896f, 0.491091937f},
-std::array<float,2>{0.358326882f, 0.919941008f},
-std::array<float,2>{0.915650785f, 0.5978719f},
-std::array<float,2>{0.167976514f, 0.22640501f},
-std::array<float,2>{0.82371521f, 0.0636448041f},
-std::array<float,2>{0.0293020401f, 0.72416544f},
-std::array<float,2>{0.740926445f, 0.830953658f},
-std::array<float,2>{0.455660999f, 0.343796194f},
-std::array<float,2>{0.97709769f, 0.273959398f},
-std::array<float,2>{0.207466826f, 0.756919324f},
-std::array<float,2>{0.522688031f, 0.643337011f},
-std::array<float,2>{0.291271597f, 0.0496842004f},
-std::array<float,2>{0.656939268f, 0.138827607f},
-std::array<float,2>{0.404332638f, 0.527649999f},
-std::array<float,2>{0.756455719f, 0.96811527f},
-std::array<float,2>{0.0865305811f, 0.436726719f},
-std::array<float,2>{0.716116607f, 0.327810287f},
-std::array<float,2>{0.488859087f, 0.865233779f},
-std::array<float,2>{0.8524248f, 0.702476382f},
-std::array<float,2>{0.0617337376f, 0.112264208f},
-std::array<float,2>{0.883389354f, 0.204817832f},
-std::array<float,2>{0.136002585f, 0.563417554f},
-std::array<float,2>{0.573536098f, 0.897597492f},
-std::array<float,2>{0.343576819f, 0.439653188f},
-std::array<float,2>{0.782642841f, 0.376582235f},
-std::array<float,2>{0.121014394f, 0.996373653f},
-std::array<float,2>{0.651132405f, 0.558973372f},
-std::array<float,2>{0.42661944f, 0.176586553f},
-std::array<float,2>{0.543439269f, 0.01546208f},
-std::array<float,2>{0.250761867f, 0.675123572f},
-std::array<float,2>{0.945432961f, 0.811660707f},
-std::array<float,2>{0.247640043f, 0.29651311f},
-std::array<float,2>{0.563457787f, 0.357291579f},
-std::array<float,2>{0.329553545f, 0.84296447f},
-std::array<float,2>{0.877486944f, 0.72731626f},
-std::array<float,2>{0.129442602f, 0.0720717162f},
-std::array<float,2>{0.846851587f, 0.230879411f},
-std::array<float,2>{0.0514038876f, 0.606978357f},
-std::array<float,2>{0.706176341f, 0.910204113f},
-std::array<float,2>{0.499131918f, 0.492307991f},
-std::array<float,2>{0.939205468f, 0.427832633f},
-std::array<float,2>{0.238151759f, 0.956774116f},
-std::array<float,2>{0.538585186f, 0.520532548f},
-std::array<float,2>{0.261214525f, 0.132566705f},
-std::array<float,2>{0.643943369f, 0.0577271581f},
-std::array<float,2>{0.435180992f, 0.654831171f},
-std::array<float,2>{0.789876997f, 0.758543909f},
-std::array<float,2>{0.116148472f, 0.27017653f},
-std::array<float,2>{0.746967256f, 0.445823491f},
-std::array<float,2>{0.465523571f, 0.906022429f},
-std::array<float,2>{0.815928936f, 0.570660055f},
-std::array<float,2>{0.0157242119f, 0.217948109f},
-std::array<float,2>{0.911512136f, 0.12161167f},
-std::array<float,2>{0.162712455f, 0.691797435f},
-std::array<float,2>{0.595251083f, 0.869150281f},
-std::array<float,2>{0.347612351f, 0.316231757f},
-std::array<float,2>{0.758366883f, 0.284206778f},
-std::array<float,2>{0.0793804303f, 0.802635729f},
-std::array<float,2>{0.666316271f, 0.686219156f},
-std::array<float,2>{0.395305723f, 0.00083755987f},
-std::array<float,2>{0.528498352f, 0.185263008f},
-std::array<float,2>{0.282981753f, 0.549047649f},
-std::array<float,2>{0.972061515f, 0.985443056f},
-std::array<float,2>{0.211498946f, 0.390247077f},
-std::array<float,2>{0.559816957f, 0.405708522f},
-std::array<float,2>{0.279128641f, 0.984276235f},
-std::array<float,2>{0.959221125f, 0.539066911f},
-std::array<float,2>{0.229072198f, 0.157869443f},
-std::array<float,2>{0.812341213f, 0.0302157402f},
-std::array<float,2>{0.0944715366f, 0.659106016f},
-std::array<float,2>{0.629214883f, 0.783893824f},
-std::array<float,2>{0.416792482f, 0.304724783f},
-std::array<float,2>{0.897898674f, 0.335517496f},
-std::array<float,2>{0.15411374f, 0.858960271f},
-std::array<float,2>{0.585795939f, 0.713074386f},
-std::array<float,2>{0.314571798f, 0.107243091f},
-std::array<float,2>{0.700149238f, 0.193197519f},
-std::array<float,2>{0.475025684f, 0.583002269f},
-std::array<float,2>{0.8623963f, 0.889370143f},
-std::array<float,2>{0.0365390368f, 0.458319783f},
-std::array<float,2>{0.683935046f, 0.261114568f},
-std::array<float,2>{0.382685304f, 0.769040763f},
-std::array<float,2>{0.773655415f, 0.636580288f},
-std::array<float,2>{0.0780412853f, 0.0409671925f},
-std::array<float,2>{0.986586332f, 0.154243678f},
-std::array<float,2>{0.196173236f, 0.501425147f},
-std::array<float,2>{0.50656122f, 0.948493898f},
-std::array<float,2>{0.312494755f, 0.406813562f},
-std::array<float,2>{0.830327868f, 0.475063354f},
-std::array<float,2>{0.0111297369f, 0.923450768f},
-std::array<float,2>{0.720420182f, 0.615741789f},
-std::array<float,2>{0.452751368f, 0.24403134f},
-std::array<float,2>{0.622095227f, 0.0878321752f},
-std::array<float,2>{0.361898005f, 0.749637961f},
-std::array<float,2>{0.934800267f, 0.824417174f},
-std::array<float,2>{0.172393948f, 0.364862144f},
-std::array<float,2>{0.611192226f, 0.266334176f},
-std::array<float,2>{0.371781021f, 0.763520658f},
-std::array<float,2>{0.922730446f, 0.651126623f},
-std::array<float,2>{0.184040099f, 0.0588067323f},
-std::array<float,2>{0.838654935f, 0.125301436f},
-std::array<float,2>{0.00639142888f, 0.515674353f},
-std::array<float,2>{0.729480028f, 0.95872575f},
-std::array<float,2>{0.438574672f, 0.425433755f},
-std::array<float,2>{0.99750191f, 0.499600559f},
-std::array<float,2>{0.188591659f, 0.909118712f},
-std::array<float,2>{0.508535028f, 0.603977442f},
-std::array<float,2>{0.297006369f, 0.227669239f},
-std::array<float,2>{0.676856935f, 0.0779109448f},
-std::array<float,2>{0.387463808f, 0.733213305f},
-std::array<float,2>{0.767354369f, 0.837482452f},
-std::array<float,2>{0.0691030398f, 0.354398072f},
-std::array<float,2>{0.690036476f, 0.386101574f},
-std::array<float,2>{0.477973938f, 0.98854363f},
-std::array<float,2>{0.871319115f, 0.554014444f},
-std::array<float,2>{0.0401394852f, 0.183486953f},
-std::array<float,2>{0.903262436f, 0.00466274191f},
-std::array<float,2>{0.142011896f, 0.681993902f},
-std::array<float,2>{0.587859869f, 0.799300134f},
-std::array<float,2>{0.322216749f, 0.287141681f},
-std::array<float,2>{0.801364303f, 0.316868305f},
-std::array<float,2>{0.104878426f, 0.871370733f},
-std::array<float,2>{0.636655569f, 0.689772904f},
-std::array<float,2>{0.409148067f, 0.120620511f},
-std::array<float,2>{0.549520552f, 0.212971151f},
-std::array<float,2>{0.267125845f, 0.575935543f},
-std::array<float,2>{0.96276629f, 0.901122749f},
-std::array<float,2>{0.22405684f, 0.449521422f},
-std::array<float,2>{0.518940449f, 0.456971556f},
-std::array<float,2>{0.295643121f, 0.882828176f},
-std::array<float,2>{0.981237411f, 0.579284847f},
-std::array<float,2>{0.203615993f, 0.190000415f},
-std::array<float,2>{0.75346303f, 0.102994487f},
-std::array<float,2>{0.0909429491f, 0.717927814f},
-std::array<float,2>{0.661528707f, 0.852059543f},
-std::array<float,2>{0.399867326f, 0.330111861f},
-std::array<float,2>{0.919053853f, 0.310473263f},
-std::array<float,2>{0.165883973f, 0.787425995f},
-std::array<float,2>{0.609070837f, 0.66233927f},
-std::array<float,2>{0.352345288f, 0.0247235764f},
-std::array<float,2>{0.73495388f, 0.160283715f},
-std::array<float,2>{0.460714459f, 0.543764472f},
-std::array<float,2>{0.827994585f, 0.979928374f},
-std::array<float,2>{0.0246428084f, 0.401160896f},
-std::array<float,2>{0.653575599f, 0.36206761f},
-std::array<float,2>{0.422043294f, 0.820405304f},
-std::array<float,2>{0.78556174f, 0.746012688f},
-std::array<float,2>{0.124808691f, 0.0919320509f},
-std::array<float,2>{0.949926257f, 0.24958162f},
-std::array<float,2>{0.245713979f, 0.610600173f},
-std::array<float,2>{0.540955782f, 0.925846219f},
-std::array<float,2>{0.257640243f, 0.469676197f},
-std::array<float,2>{0.858014345f, 0.413915813f},
-std::array<float,2>{0.0556313545f, 0.950171769f},
-std::array<float,2>{0.71197468f, 0.507542908f},
-std::array<float,2>{0.487621516f, 0.148639753f},
-std::array<float,2>{0.576104522f, 0.0465084612f},
-std::array<float,2>{0.339443147f, 0.637068629f},
-std::array<float,2>{0.890383482f, 0.769593418f},
-std::array<float,2>{0.138259828f, 0.261996806f},
-std::array<float,2>{0.53303045f, 0.341477126f},
-std::array<float,2>{0.265231252f, 0.845823944f},
-std::array<float,2>{0.941650271f, 0.704157174f},
-std::array<float,2>{0.239823848f, 0.0940906331f},
-std::array<float,2>{0.793960512f, 0.198601618f},
-std::array<float,2>{0.110415809f, 0.586336136f},
-std::array<float,2>{0.647435427f, 0.878393829f},
-std::array<float,2>{0.432710767f, 0.467832327f},
-std::array<float,2>{0.882140219f, 0.397061408f},
-std::array<float,2>{0.125878394f, 0.970676959f},
-std::array<float,2>{0.569960773f, 0.537913024f},
-std::array<float,2>{0.333633661f, 0.166121334f},
-std::array<float,2>{0.707643688f, 0.0169983711f},
-std::array<float,2>{0.493436456f, 0.664814591f},
-std::array<float,2>{0.849248111f, 0.792083025f},
-std::array<float,2>{0.0472115837f, 0.298046738f},
-std::array<float,2>{0.669942856f, 0.480240852f},
-std::array<float,2>{0.392910033f, 0.933454931f},
-std::array<float,2>{0.765107095f, 0.619000435f},
-std::array<float,2>{0.0823219642f, 0.241588935f},
-std::array<float,2>{0.974095345f, 0.0801429525f},
-std::array<float,2>{0.215804756f, 0.741697133f},
-std::array<float,2>{0.525062621f, 0.820265174f},
-std::array<float,2>{0.288930684f, 0.368540317f},
-std::array<float,2>{0.818631589f, 0.251393348f},
-std::array<float,2>{0.0221825857f, 0.774301827f},
-std::array<float,2>{0.742708087f, 0.630084932f},
-std::array<float,2>{0.462857783f, 0.0315062888f},
-std::array<float,2>{0.599755824f, 0.140905678f},
-std::array<float,2>{0.350037843f, 0.511602521f},
-std::array<float,2>{0.907678664f, 0.938861251f},
-std::array<float,2>{0.15864794f, 0.420689583f},
-std::array<float,2>{0.580697775f, 0.430811733f},
-std::array<float,2>{0.318119586f, 0.961725771f},
-std::array<float,2>{0.893409908f, 0.526292264f},
-std::array<float,2>{0.149301574f, 0.134193212f},
-std::array<float,2>{0.866764784f, 0.0510763489f},
-std::array<float,2>{0.033755105f, 0.645525992f},
-std::array<float,2>{0.696728885f, 0.752044678f},
-std::array<float,2>{0.470379531f, 0.278127968f},
-std::array<float,2>{0.956791759f, 0.348335236f},
-std::array<float,2>{0.232915759f, 0.833946407f},
-std::array<float,2>{0.55745244f, 0.720719218f},
-std::array<float,2>{0.276667714f, 0.0677553192f},
-std::array<float,2>{0.627306044f, 0.221060216f},
-std::array<float,2>{0.419849038f, 0.595031261f},
-std::array<float,2>{0.807319164f, 0.914725006f},
-std::array<float,2>{0.0986122787f, 0.48698324f},
-std::array<float,2>{0.724413693f, 0.29186964f},
-std::array<float,2>{0.447923839f, 0.805892646f},
-std::array<float,2>{0.833532095f, 0.67703104f},
-std::array<float,2>{0.0136403991f, 0.0106204962f},
-std::array<float,2>{0.930362642f, 0.174332067f},
-std::array<float,2>{0.17860575f, 0.558419228f},
-std::array<float,2>{0.6195333f, 0.993912578f},
-std::array<float,2>{0.365317434f, 0.382386267f},
-std::array<float,2>{0.780121446f, 0.441461354f},
-std::array<float,2>{0.0719507337f, 0.893635929f},
-std::array<float,2>{0.682883441f, 0.568289042f},
-std::array<float,2>{0.376448333f, 0.210737467f},
-std::array<float,2>{0.500277519f, 0.116465367f},
-std::array<float,2>{0.306006312f, 0.695936978f},
-std::array<float,2>{0.989632368f, 0.862652242f},
-std::array<float,2>{0.200557768f, 0.324191004f},
-std::array<float,2>{0.546494663f, 0.295590192f},
-std::array<float,2>{0.253622115f, 0.811108887f},
-std::array<float,2>{0.948273242f, 0.674014568f},
-std::array<float,2>{0.248207197f, 0.0146044968f},
-std::array<float,2>{0.783905327f, 0.177582145f},
-std::array<float,2>{0.117964953f, 0.559952259f},
-std::array<float,2>{0.649509013f, 0.997793853f},
-std::array<float,2>{0.427927077f, 0.375679135f},
-std::array<float,2>{0.886020243f, 0.440583378f},
-std::array<float,2>{0.134060428f, 0.897142231f},
-std::array<float,2>{0.57163769f, 0.564241111f},
-std::array<float,2>{0.339953631f, 0.203429937f},
-std::array<float,2>{0.718245029f, 0.11327447f},
-std::array<float,2>{0.491347879f, 0.701328099f},
-std::array<float,2>{0.854809582f, 0.863756418f},
-std::array<float,2>{0.0599403903f, 0.326435953f},
-std::array<float,2>{0.658394098f, 0.435906798f},
-std::array<float,2>{0.403673112f, 0.967227995f},
-std::array<float,2>{0.755155027f, 0.528734386f},
-std::array<float,2>{0.0889083296f, 0.139844656f},
-std::array<float,2>{0.979287982f, 0.0499043167f},
-std::array<float,2>{0.210368693f, 0.643619478f},
-std::array<float,2>{0.52040422f, 0.755894423f},
-std::array<float,2>{0.290693283f, 0.274892211f},
-std::array<float,2>{0.820866585f, 0.344893932f},
-std::array<float,2>{0.0288091302f, 0.831275821f},
-std::array<float,2>{0.740171611f, 0.723167121f},
-std::array<float,2>{0.453920573f, 0.0634256229f},
-std::array<float,2>{0.603259683f, 0.225159541f},
-std::array<float,2>{0.356721282f, 0.598791718f},
-std::array<float,2>{0.916777313f, 0.92172277f},
-std::array<float,2>{0.170039296f, 0.491519183f},
-std::array<float,2>{0.590069056f, 0.483071715f},
-std::array<float,2>{0.327304691f, 0.934629381f},
-std::array<float,2>{0.900305033f, 0.62115854f},
-std::array<float,2>{0.146854818f, 0.238071069f},
-std::array<float,2>{0.869264126f, 0.0857665539f},
-std::array<float,2>{0.0463675819f, 0.737870634f},
-std::array<float,2>{0.691566408f, 0.81300348f},
-std::array<float,2>{0.482873023f, 0.371331155f},
-std::array<float,2>{0.965349078f, 0.257657945f},
-std::array<float,2>{0.222608402f, 0.780979395f},
-std::array<float,2>{0.551559567f, 0.62849915f},
-std::array<float,2>{0.270461559f, 0.036822442f},
-std::array<float,2>{0.640463889f, 0.147147864f},
-std::array<float,2>{0.413859248f, 0.513178468f},
-std::array<float,2>{0.799774051f, 0.945233107f},
-std::array<float,2>{0.107077867f, 0.417092383f},
-std::array<float,2>{0.731762171f, 0.337808609f},
-std::array<float,2>{0.443069279f, 0.85098505f},
-std::array<float,2>{0.840770364f, 0.710260212f},
-std::array<float,2>{0.0036471677f, 0.098794803f},
-std::array<float,2>{0.927344203f, 0.202755168f},
-std::array<float,2>{0.181506529f, 0.590493023f},
-std::array<float,2>{0.613523841f, 0.879917502f},
-std::array<float,2>{0.370283842f, 0.463224858f},
-std::array<float,2>{0.770570815f, 0.394254714f},
-std::array<float,2>{0.065257825f, 0.975300729f},
-std::array<float,2>{0.673609793f, 0.531932652f},
-std::array<float,2>{0.385792434f, 0.168114439f},
-std::array<float,2>{0.515396178f, 0.0220826119f},
-std::array<float,2>{0.304446936f, 0.671042085f},
-std::array<float,2>{0.995306551f, 0.796596825f},
-std::array<float,2>{0.192845434f, 0.301036239f},
-std::array<float,2>{0.623663425f, 0.364168793f},
-std::array<float,2>{0.359608531f, 0.825257957f},
-std::array<float,2>{0.937475026f, 0.748786271f},
-std::array<float,2>{0.174887627f, 0.0866362527f},
-std::array<float,2>{0.829399168f, 0.242291316f},
-std::array<float,2>{0.00935378578f, 0.616469085f},
-std::array<float,2>{0.721060693f, 0.922508001f},
-std::array<float,2>{0.449644774f, 0.476421952f},
-std::array<float,2>{0.985049903f, 0.407797039f},
-std::array<float,2>{0.19889465f, 0.947618484f},
-std::array<float,2>{0.505736411f, 0.500086665f},
-std::array<float,2>{0.309101433f, 0.152733788f},
-std::array<float,2>{0.686632872f, 0.0395742767f},
-std::array<float,2>{0.380150884f, 0.634891212f},
-std::array<float,2>{0.776296318f, 0.768351495f},
-std::array<float,2>{0.074704878f, 0.260451168f},
-std::array<float,2>{0.702083409f, 0.457369477f},
-std::array<float,2>{0.472869158f, 0.889703631f},
-std::array<float,2>{0.859741569f, 0.583973289f},
-std::array<float,2>{0.0377835073f, 0.191556588f},
-std::array<float,2>{0.895342171f, 0.106120035f},
-std::array<float,2>{0.156115234f, 0.714475393f},
-std::array<float,2>{0.583536267f, 0.857546449f},
-std::array<float,2>{0.313492179f, 0.33431986f},
-std::array<float,2>{0.810422659f, 0.306309283f},
-std::array<float,2>{0.0967762545f, 0.784928143f},
-std::array<float,2>{0.632569015f, 0.659275532f},
-std::array<float,2>{0.414497256f, 0.0305361059f},
-std::array<float,2>{0.560890496f, 0.157213733f},
-std::array<float,2>{0.280306309f, 0.540276647f},
-std::array<float,2>{0.957717121f, 0.982676625f},
-std::array<float,2>{0.22728917f, 0.404361516f},
-std::array<float,2>{0.530295908f, 0.389420062f},
-std::array<float,2>{0.284074932f, 0.984787166f},
-std::array<float,2>{0.970565021f, 0.549845815f},
-std::array<float,2>{0.214260399f, 0.184546947f},
-std::array<float,2>{0.760621488f, 0.00177340338f},
-std::array<float,2>{0.08066006f, 0.686570823f},
-std::array<float,2>{0.664075732f, 0.800787389f},
-std::array<float,2>{0.398033768f, 0.283674508f},
-std::array<float,2>{0.913621187f, 0.314548552f},
-std::array<float,2>{0.161358565f, 0.871039093f},
-std::array<float,2>{0.597015381f, 0.692776382f},
-std::array<float,2>{0.344711125f, 0.122852728f},
-std::array<float,2>{0.749603629f, 0.217057884f},
-std::array<float,2>{0.468370199f, 0.572086632f},
-std::array<float,2>{0.813613474f, 0.904495478f},
-std::array<float,2>{0.0177478138f, 0.446631253f},
-std::array<float,2>{0.641788363f, 0.270527124f},
-std::array<float,2>{0.436108828f, 0.759239733f},
-std::array<float,2>{0.792603552f, 0.656155109f},
-std::array<float,2>{0.114516579f, 0.0574102998f},
-std::array<float,2>{0.939884067f, 0.131237641f},
-std::array<float,2>{0.235832497f, 0.520463288f},
-std::array<float,2>{0.536963701f, 0.956005037f},
-std::array<float,2>{0.258799225f, 0.429081589f},
-std::array<float,2>{0.844651401f, 0.493537486f},
-std::array<float,2>{0.053165935f, 0.911589086f},
-std::array<float,2>{0.704284608f, 0.60558486f},
-std::array<float,2>{0.498027146f, 0.23154515f},
-std::array<float,2>{0.566385388f, 0.0704968348f},
-std::array<float,2>{0.331738889f, 0.727759421f},
-std::array<float,2>{0.87606442f, 0.842766702f},
-std::array<float,2>{0.132444531f, 0.355706632f},
-std::array<float,2>{0.577731729f, 0.263020009f},
-std::array<float,2>{0.336043775f, 0.770914555f},
-std::array<float,2>{0.886925519f, 0.638533354f},
-std::array<float,2>{0.139046475f, 0.0452305339f},
-std::array<float,2>{0.856328905f, 0.149849728f},
-std::array<float,2>{0.0579167604f, 0.505910337f},
-std::array<float,2>{0.713898122f, 0.950321972f},
-std::array<float,2>{0.484870106f, 0.412834197f},
-std::array<float,2>{0.952630341f, 0.470369428f},
-std::array<float,2>{0.242467448f, 0.927687883f},
-std::array<float,2>{0.542850673f, 0.609694302f},
-std::array<float,2>{0.255369127f, 0.248745009f},
-std::array<float,2>{0.655038416f, 0.0929770842f},
-std::array<float,2>{0.42401731f, 0.745113015f},
-std::array<float,2>{0.788231075f, 0.821898401f},
-std::array<float,2>{0.122005306f, 0.362658292f},
-std::array<float,2>{0.736682415f, 0.401676118f},
-std::array<float,2>{0.457567632f, 0.979099095f},
-std::array<float,2>{0.826121688f, 0.544127464f},
-std::array<float,2>{0.0273409653f, 0.161586449f},
-std::array<float,2>{0.92173022f, 0.0234444756f},
-std::array<float,2>{0.167310223f, 0.664010286f},
-std::array<float,2>{0.605507553f, 0.788300693f},
-std::array<float,2>{0.35434106f, 0.308940351f},
-std::array<float,2>{0.750591636f, 0.331226289f},
-std::array<float,2>{0.0923904479f, 0.852765739f},
-std::array<float,2>{0.662390471f, 0.717743456f},
-std::array<float,2>{0.401411206f, 0.10182593f},
-std::array<float,2>{0.51571095f, 0.190962464f},
-std::array<float,2>{0.293473452f, 0.57906878f},
-std::array<float,2>{0.983405292f, 0.883985519f},
-std::array<float,2>{0.20695053f, 0.455646485f},
-std::array<float,2>{0.548767447f, 0.450710714f},
-std::array<float,2>{0.269347727f, 0.901915908f},
-std::array<float,2>{0.963748515f, 0.575000763f},
-std::array<float,2>{0.22635667f, 0.214749321f},
-std::array<float,2>{0.803818882f, 0.119485289f},
-std::array<float,2>{0.102794014f, 0.69094491f},
-std::array<float,2>{0.633118212f, 0.872479975f},
-std::array<float,2>{0.407898605f, 0.317668825f},
-std::array<float,2>{0.90503788f, 0.288379341f},
-std::array<float,2>{0.142885044f, 0.800363898f},
-std::array<float,2>{0.588546216f, 0.683413327f},
-std::array<float,2>{0.323052019f, 0.00536499685f},
-std::array<float,2>{0.688887298f, 0.182362035f},
-std::array<float,2>{0.478678137f, 0.55285573f},
-std::array<float,2>{0.873158157f, 0.989918113f},
-std::array<float,2>{0.0412917212f, 0.384806216f},
-std::array<float,2>{0.678113461f, 0.355317324f},
-std::array<float,2>{0.389917165f, 0.836813033f},
-std::array<float,2>{0.769213319f, 0.73409152f},
-std::array<float,2>{0.0676283687f, 0.0763445348f},
-std::array<float,2>{0.998618901f, 0.22723566f},
-std::array<float,2>{0.190608382f, 0.60518831f},
-std::array<float,2>{0.510517299f, 0.909765244f},
-std::array<float,2>{0.299762309f, 0.498074919f},
-std::array<float,2>{0.837413847f, 0.424042076f},
-std::array<float,2>{0.00552400015f, 0.957606792f},
-std::array<float,2>{0.728214562f, 0.517444432f},
-std::array<float,2>{0.440570593f, 0.126749605f},
-std::array<float,2>{0.612847686f, 0.0603955239f},
-std::array<float,2>{0.37491864f, 0.651825547f},
-std::array<float,2>{0.924340904f, 0.762424707f},
-std::array<float,2>{0.186499387f, 0.267114162f},
-std::array<float,2>{0.503863156f, 0.322777301f},
-std::array<float,2>{0.306739539f, 0.861629725f},
-std::array<float,2>{0.990525663f, 0.696920216f},
-std::array<float,2>{0.20270814f, 0.115458012f},
-std::array<float,2>{0.777830958f, 0.209042296f},
-std::array<float,2>{0.0738656819f, 0.566704333f},
-std::array<float,2>{0.681539714f, 0.893030167f},
-std::array<float,2>{0.377756596f, 0.443352401f},
-std::array<float,2>{0.932462633f, 0.381135464f},
-std::array<float,2>{0.177284628f, 0.993100166f},
-std::array<float,2>{0.617572069f, 0.556989133f},
-std::array<float,2>{0.364678115f, 0.174858958f},
-std::array<float,2>{0.725966096f, 0.0111839259f},
-std::array<float,2>{0.446553737f, 0.676461279f},
-std::array<float,2>{0.835000992f, 0.804999828f},
-std::array<float,2>{0.0138312671f, 0.292700559f},
-std::array<float,2>{0.625257313f, 0.48773545f},
-std::array<float,2>{0.420170814f, 0.915739477f},
-std::array<float,2>{0.805986762f, 0.59390372f},
-std::array<float,2>{0.100676924f, 0.221971273f},
-std::array<float,2>{0.953806281f, 0.0673064291f},
-std::array<float,2>{0.232345089f, 0.721817851f},
-std::array<float,2>{0.556335807f, 0.8327685f},
-std::array<float,2>{0.274152011f, 0.349347591f},
-std::array<float,2>{0.864963591f, 0.279220551f},
-std::array<float,2>{0.0321977213f, 0.753368676f},
-std::array<float,2>{0.697437167f, 0.645456553f},
-std::array<float,2>{0.471717268f, 0.0523778014f},
-std::array<float,2>{0.579456031f, 0.133669764f},
-std::array<float,2>{0.319153935f, 0.527163446f},
-std::array<float,2>{0.89214617f, 0.962025762f},
-std::array<float,2>{0.151572332f, 0.430420458f},
-std::array<float,2>{0.598040879f, 0.420968145f},
-std::array<float,2>{0.347857982f, 0.938266277f},
-std::array<float,2>{0.909022212f, 0.510101736f},
-std::array<float,2>{0.156856433f, 0.142344728f},
-std::array<float,2>{0.818104506f, 0.0328718759f},
-std::array<float,2>{0.0208673701f, 0.629409194f},
-std::array<float,2>{0.745349109f, 0.774914563f},
-std::array<float,2>{0.463822067f, 0.250699043f},
-std::array<float,2>{0.976272225f, 0.36811465f},
-std::array<float,2>{0.217500269f, 0.818453133f},
-std::array<float,2>{0.527190804f, 0.740671515f},
-std::array<float,2>{0.28696233f, 0.0819486603f},
-std::array<float,2>{0.669573545f, 0.240939274f},
-std::array<float,2>{0.392574549f, 0.617977083f},
-std::array<float,2>{0.762501419f, 0.93198055f},
-std::array<float,2>{0.0847011134f, 0.47914046f},
-std::array<float,2>{0.709255815f, 0.297645509f},
-std::array<float,2>{0.494401455f, 0.791879356f},
-std::array<float,2>{0.850226581f, 0.665378153f},
-std::array<float,2>{0.0499885231f, 0.016132975f},
-std::array<float,2>{0.879924953f, 0.167364076f},
-std::array<float,2>{0.12784265f, 0.538678467f},
-std::array<float,2>{0.567796767f, 0.969302177f},
-std::array<float,2>{0.335638285f, 0.398047864f},
-std::array<float,2>{0.79619658f, 0.467655808f},
-std::array<float,2>{0.111756787f, 0.877672195f},
-std::array<float,2>{0.645308197f, 0.587539732f},
-std::array<float,2>{0.430267066f, 0.197395563f},
-std::array<float,2>{0.533565402f, 0.0955678374f},
-std::array<float,2>{0.262293428f, 0.703215063f},
-std::array<float,2>{0.94387567f, 0.846942782f},
-std::array<float,2>{0.241183117f, 0.339883894f},
-std::array<float,2>{0.52163738f, 0.275614798f},
-std::array<float,2>{0.292170465f, 0.754888535f},
-std::array<float,2>{0.978346169f, 0.641825736f},
-std::array<float,2>{0.208234251f, 0.0477269255f},
-std::array<float,2>{0.757321417f, 0.138588548f},
-std::array<float,2>{0.0878824815f, 0.529753804f},
-std::array<float,2>{0.658101678f, 0.966453254f},
-std::array<float,2>{0.405987799f, 0.433939666f},
-std::array<float,2>{0.9145751f, 0.489350498f},
-std::array<float,2>{0.169638738f, 0.918346703f},
-std::array<float,2>{0.605057597f, 0.600650012f},
-std::array<float,2>{0.358590752f, 0.223359898f},
-std::array<float,2>{0.74122411f, 0.066174455f},
-std::array<float,2>{0.456681401f, 0.725414693f},
-std::array<float,2>{0.822528183f, 0.829069853f},
-std::array<float,2>{0.0306235868f, 0.346028417f},
-std::array<float,2>{0.652089536f, 0.378359735f},
-std::array<float,2>{0.427162409f, 0.998248875f},
-std::array<float,2>{0.781769931f, 0.5610919f},
-std::array<float,2>{0.119689874f, 0.178334951f},
-std::array<float,2>{0.946500361f, 0.0121758543f},
-std::array<float,2>{0.246929362f, 0.673464715f},
-std::array<float,2>{0.544729233f, 0.809767187f},
-std::array<float,2>{0.251750499f, 0.29332298f},
-std::array<float,2>{0.853052855f, 0.324357003f},
-std::array<float,2>{0.0610944703f, 0.865469635f},
-std::array<float,2>{0.715114713f, 0.699872613f},
-std::array<float,2>{0.489537984f, 0.110682122f},
-std::array<float,2>{0.573112607f, 0.205723614f},
-std::array<float,2>{0.342753053f, 0.564763606f},
-std::array<float,2>{0.883800328f, 0.89638871f},
-std::array<float,2>{0.135609254f, 0.439097106f},
-std::array<float,2>{0.615575016f, 0.462478518f},
-std::array<float,2>{0.368770838f, 0.881431043f},
-std::array<float,2>{0.9282161f, 0.593179047f},
-std::array<float,2>{0.182964027f, 0.20076479f},
-std::array<float,2>{0.841906905f, 0.101039536f},
-std::array<float,2>{0.000656324846f, 0.707884848f},
-std::array<float,2>{0.733915389f, 0.848865151f},
-std::array<float,2>{0.443857074f, 0.337917089f},
-std::array<float,2>{0.993846834f, 0.303839117f},
-std::array<float,2>{0.193486467f, 0.794532061f},
-std::array<float,2>{0.513482809f, 0.668597162f},
-std::array<float,2>{0.302333415f, 0.0214740299f},
-std::array<float,2>{0.674411297f, 0.170000181f},
-std::array<float,2>{0.38384065f, 0.534626544f},
-std::array<float,2>{0.772729576f, 0.972896636f},
-std::array<float,2>{0.0627892613f, 0.391161412f},
-std::array<float,2>{0.693676531f, 0.374957621f},
-std::array<float,2>{0.481513828f, 0.815991879f},
-std::array<float,2>{0.868037522f, 0.736013532f},
-std::array<float,2>{0.043023482f, 0.0835604444f},
-std::array<float,2>{0.901678264f, 0.235775456f},
-std::array<float,2>{0.145842642f, 0.624869883f},
-std::array<float,2>{0.593433559f, 0.936940074f},
-std::array<float,2>{0.325709164f, 0.481967002f},
-std::array<float,2>{0.797273457f, 0.415712118f},
-std::array<float,2>{0.108836219f, 0.942165554f},
-std::array<float,2>{0.63685298f, 0.51515311f},
-std::array<float,2>{0.411552995f, 0.14554657f},
-std::array<float,2>{0.554109693f, 0.0387511402f},
-std::array<float,2>{0.272722721f, 0.626587987f},
-std::array<float,2>{0.968233168f, 0.778968573f},
-std::array<float,2>{0.218758225f, 0.255307615f},
-std::array<float,2>{0.584502101f, 0.332179397f},
-std::array<float,2>{0.316399455f, 0.856698632f},
-std::array<float,2>{0.896496296f, 0.712346971f},
-std::array<float,2>{0.152660042f, 0.107433245f},
-std::array<float,2>{0.861511111f, 0.193464205f},
-std::array<float,2>{0.0354077704f, 0.584711611f},
-std::array<float,2>{0.7010535f, 0.886776447f},
-std::array<float,2>{0.476405114f, 0.46076116f},
-std::array<float,2>{0.960193038f, 0.402833372f},
-std::array<float,2>{0.229915023f, 0.982088447f},
-std::array<float,2>{0.558605731f, 0.542371511f},
-std::array<float,2>{0.277660966f, 0.160151303f},
-std::array<float,2>{0.630237937f, 0.0285797715f},
-std::array<float,2>{0.417241931f, 0.657795548f},
-std::array<float,2>{0.811005056f, 0.781438887f},
-std::array<float,2>{0.0950736478f, 0.307016611f},
-std::array<float,2>{0.719678223f, 0.474113524f},
-std::array<float,2>{0.451681018f, 0.924860835f},
-std::array<float,2>{0.832026243f, 0.614991248f},
-std::array<float,2>{0.0106717516f, 0.245114744f},
-std::array<float,2>{0.934024692f, 0.0892407149f},
-std::array<float,2>{0.173245117f, 0.747912705f},
-std::array<float,2>{0.621893525f, 0.827899277f},
-std::array<float,2>{0.36234048f, 0.366423786f},
-std::array<float,2>{0.774693131f, 0.258698404f},
-std::array<float,2>{0.0768788904f, 0.767334938f},
-std::array<float,2>{0.685127556f, 0.633200049f},
-std::array<float,2>{0.381064057f, 0.04188383f},
-std::array<float,2>{0.506908f, 0.155717239f},
-std::array<float,2>{0.311221391f, 0.501999795f},
-std::array<float,2>{0.988220692f, 0.946110964f},
-std::array<float,2>{0.196965575f, 0.408795536f},
-std::array<float,2>{0.537484765f, 0.426790923f},
-std::array<float,2>{0.259939045f, 0.954657674f},
-std::array<float,2>{0.938236237f, 0.522146285f},
-std::array<float,2>{0.236579627f, 0.130702838f},
-std::array<float,2>{0.790398896f, 0.0549051166f},
-std::array<float,2>{0.116629794f, 0.654168129f},
-std::array<float,2>{0.642889619f, 0.760905564f},
-std::array<float,2>{0.434042424f, 0.271953464f},
-std::array<float,2>{0.878398538f, 0.357696891f},
-std::array<float,2>{0.130229816f, 0.841150343f},
-std::array<float,2>{0.564088345f, 0.728802264f},
-std::array<float,2>{0.328172714f, 0.07284192f},
-std::array<float,2>{0.705964983f, 0.233713523f},
-std::array<float,2>{0.498110771f, 0.608516276f},
-std::array<float,2>{0.846495509f, 0.912188947f},
-std::array<float,2>{0.052346237f, 0.495427817f},
-std::array<float,2>{0.667484403f, 0.281423688f},
-std::array<float,2>{0.395712346f, 0.803718686f},
-std::array<float,2>{0.759601235f, 0.684224427f},
-std::array<float,2>{0.0784128085f, 0.00386012928f},
-std::array<float,2>{0.971561313f, 0.186714172f},
-std::array<float,2>{0.212821439f, 0.547098637f},
-std::array<float,2>{0.527976453f, 0.987385213f},
-std::array<float,2>{0.281842172f, 0.387231529f},
-std::array<float,2>{0.814516187f, 0.448525012f},
-std::array<float,2>{0.0171129052f, 0.903327763f},
-std::array<float,2>{0.748026788f, 0.572362363f},
-std::array<float,2>{0.466501862f, 0.216754436f},
-std::array<float,2>{0.594704151f, 0.124889418f},
-std::array<float,2>{0.346002549f, 0.693590164f},
-std::array<float,2>{0.911031604f, 0.867455125f},
-std::array<float,2>{0.163469732f, 0.31407091f},
-std::array<float,2>{0.60823524f, 0.312297404f},
-std::array<float,2>{0.353427619f, 0.785262764f},
-std::array<float,2>{0.918196976f, 0.661820471f},
-std::array<float,2>{0.16473408f, 0.0262761693f},
-std::array<float,2>{0.826900184f, 0.162964344f},
-std::array<float,2>{0.0243910998f, 0.546577096f},
-std::array<float,2>{0.735610306f, 0.977325261f},
-std::array<float,2>{0.459398419f, 0.400271803f},
-std::array<float,2>{0.981464207f, 0.454987794f},
-std::array<float,2>{0.20501034f, 0.88502878f},
-std::array<float,2>{0.518281639f, 0.581766307f},
-std::array<float,2>{0.296174437f, 0.188231409f},
-std::array<float,2>{0.660955489f, 0.103677854f},
-std::array<float,2>{0.398665845f, 0.716043293f},
-std::array<float,2>{0.752552748f, 0.854394913f},
-std::array<float,2>{0.0902609974f, 0.32981497f},
-std::array<float,2>{0.711072087f, 0.410758942f},
-std::array<float,2>{0.486738652f, 0.953038871f},
-std::array<float,2>{0.859283447f, 0.504837394f},
-std::array<float,2>{0.0562422685f, 0.150420234f},
-std::array<float,2>{0.889010668f, 0.0440566838f},
-std::array<float,2>{0.136722833f, 0.639472425f},
-std::array<float,2>{0.574272692f, 0.772197962f},
-std::array<float,2>{0.338062972f, 0.265179664f},
-std::array<float,2>{0.786836565f, 0.359469771f},
-std::array<float,2>{0.123972133f, 0.822881639f},
-std::array<float,2>{0.652564466f, 0.742686689f},
-std::array<float,2>{0.42345193f, 0.0903572813f},
-std::array<float,2>{0.539952278f, 0.246711195f},
-std::array<float,2>{0.256363064f, 0.611452043f},
-std::array<float,2>{0.950958967f, 0.92786634f},
-std::array<float,2>{0.244610295f, 0.472051442f},
-std::array<float,2>{0.509044886f, 0.49706912f},
-std::array<float,2>{0.29860568f, 0.906909049f},
-std::array<float,2>{0.996297717f, 0.601834595f},
-std::array<float,2>{0.188184664f, 0.229015961f},
-std::array<float,2>{0.765937924f, 0.0758382604f},
-std::array<float,2>{0.0698408633f, 0.730762362f},
-std::array<float,2>{0.676157117f, 0.839117229f},
-std::array<float,2>{0.387827516f, 0.353396922f},
-std::array<float,2>{0.923628926f, 0.268770516f},
-std::array<float,2>{0.185414448f, 0.764365673f},
-std::array<float,2>{0.609564662f, 0.648718655f},
-std::array<float,2>{0.372302473f, 0.0623774529f},
-std::array<float,2>{0.729770243f, 0.127845541f},
-std::array<float,2>{0.438349187f, 0.517764926f},
-std::array<float,2>{0.839191914f, 0.959326327f},
-std::array<float,2>{0.0073428778f, 0.42353183f},
-std::array<float,2>{0.635552108f, 0.319746196f},
-std::array<float,2>{0.409837335f, 0.873322368f},
-std::array<float,2>{0.801775932f, 0.688196063f},
-std::array<float,2>{0.103653029f, 0.11914029f},
-std::array<float,2>{0.961670339f, 0.211292565f},
-std::array<float,2>{0.222887337f, 0.577932775f},
-std::array<float,2>{0.550177932f, 0.899215221f},
-std::array<float,2>{0.266366839f, 0.451494336f},
-std::array<float,2>{0.872426152f, 0.382851839f},
-std::array<float,2>{0.0391937047f, 0.990867198f},
-std::array<float,2>{0.690621674f, 0.552728653f},
-std::array<float,2>{0.476573408f, 0.179841086f},
-std::array<float,2>{0.586708724f, 0.00696802139f},
-std::array<float,2>{0.320513099f, 0.681460083f},
-std::array<float,2>{0.904004514f, 0.797507226f},
-std::array<float,2>{0.141395047f, 0.286609501f},
-std::array<float,2>{0.558469892f, 0.351305872f},
-std::array<float,2>{0.275813431f, 0.834067404f},
-std::array<float,2>{0.955406725f, 0.71877861f},
-std::array<float,2>{0.234032065f, 0.0693763494f},
-std::array<float,2>{0.808154523f, 0.218864232f},
-std::array<float,2>{0.0990772843f, 0.597219706f},
-std::array<float,2>{0.62882185f, 0.917380273f},
-std::array<float,2>{0.418294162f, 0.484766841f},
-std::array<float,2>{0.893966138f, 0.432744771f},
-std::array<float,2>{0.149985567f, 0.963401556f},
-std::array<float,2>{0.581441224f, 0.524062216f},
-std::array<float,2>{0.316444874f, 0.136534348f},
-std::array<float,2>{0.695639729f, 0.0530203469f},
-std::array<float,2>{0.468887776f, 0.648323059f},
-std::array<float,2>{0.865372121f, 0.750454307f},
-std::array<float,2>{0.0350244194f, 0.280637205f},
-std::array<float,2>{0.682313502f, 0.444929719f},
-std::array<float,2>{0.375976443f, 0.890851438f},
-std::array<float,2>{0.780846417f, 0.569506764f},
-std::array<float,2>{0.0712394416f, 0.208536133f},
-std::array<float,2>{0.989240289f, 0.113393553f},
-std::array<float,2>{0.19936277f, 0.69918251f},
-std::array<float,2>{0.501870155f, 0.86007762f},
-std::array<float,2>{0.30541268f, 0.320677519f},
-std::array<float,2>{0.832786858f, 0.289908767f},
-std::array<float,2>{0.0125227515f, 0.807651222f},
-std::array<float,2>{0.722730696f, 0.679436505f},
-std::array<float,2>{0.449203581f, 0.0096448008f},
-std::array<float,2>{0.620813668f, 0.17245765f},
-std::array<float,2>{0.366929263f, 0.555275798f},
-std::array<float,2>{0.931147218f, 0.994633138f},
-std::array<float,2>{0.178934082f, 0.379159361f},
-std::array<float,2>{0.569322348f, 0.394622326f},
-std::array<float,2>{0.332927495f, 0.97092253f},
-std::array<float,2>{0.881279528f, 0.535661876f},
-std::array<float,2>{0.126450047f, 0.16416654f},
-std::array<float,2>{0.848100901f, 0.018122904f},
-std::array<float,2>{0.0481409766f, 0.666338384f},
-std::array<float,2>{0.708469033f, 0.789815187f},
-std::array<float,2>{0.493154883f, 0.298883379f},
-std::array<float,2>{0.942987204f, 0.341821253f},
-std::array<float,2>{0.23921448f, 0.845546842f},
-std::array<float,2>{0.531291962f, 0.705683231f},
-std::array<float,2>{0.264148623f, 0.0965324491f},
-std::array<float,2>{0.647699475f, 0.195747361f},
-std::array<float,2>{0.431822896f, 0.588693142f},
-std::array<float,2>{0.793096483f, 0.875057817f},
-std::array<float,2>{0.109722562f, 0.465071321f},
-std::array<float,2>{0.74381566f, 0.252770782f},
-std::array<float,2>{0.461464256f, 0.776685417f},
-std::array<float,2>{0.819535613f, 0.632314324f},
-std::array<float,2>{0.0228314232f, 0.0343505554f},
-std::array<float,2>{0.906478524f, 0.143359259f},
-std::array<float,2>{0.159711212f, 0.509346306f},
-std::array<float,2>{0.60072875f, 0.940425456f},
-std::array<float,2>{0.35138157f, 0.41975376f},
-std::array<float,2>{0.763724566f, 0.477826923f},
-std::array<float,2>{0.0836528018f, 0.931451738f},
-std::array<float,2>{0.671180129f, 0.620479286f},
-std::array<float,2>{0.394138902f, 0.239425078f},
-std::array<float,2>{0.52373904f, 0.0796301812f},
-std::array<float,2>{0.287524492f, 0.739079833f},
-std::array<float,2>{0.973433852f, 0.818071544f},
-std::array<float,2>{0.216577381f, 0.370108396f},
-std::array<float,2>{0.536384344f, 0.272206724f},
-std::array<float,2>{0.259727567f, 0.761464655f},
-std::array<float,2>{0.940356135f, 0.653362155f},
-std::array<float,2>{0.236233205f, 0.0554694943f},
-std::array<float,2>{0.792351782f, 0.129987597f},
-std::array<float,2>{0.115207128f, 0.521734953f},
-std::array<float,2>{0.642227232f, 0.954575539f},
-std::array<float,2>{0.435992122f, 0.427633792f},
-std::array<float,2>{0.876542628f, 0.495921224f},
-std::array<float,2>{0.13211596f, 0.912864804f},
-std::array<float,2>{0.565565586f, 0.609162211f},
-std::array<float,2>{0.331183046f, 0.234141469f},
-std::array<float,2>{0.704649746f, 0.0725768059f},
-std::array<float,2>{0.497149378f, 0.729366302f},
-std::array<float,2>{0.843804598f, 0.841607988f},
-std::array<float,2>{0.0533224866f, 0.357944816f},
-std::array<float,2>{0.664634109f, 0.386755347f},
-std::array<float,2>{0.397871822f, 0.987962425f},
-std::array<float,2>{0.760090828f, 0.54776901f},
-std::array<float,2>{0.0803766251f, 0.187237114f},
-std::array<float,2>{0.970123708f, 0.00315318955f},
-std::array<float,2>{0.214802131f, 0.683712661f},
-std::array<float,2>{0.531104565f, 0.804460585f},
-std::array<float,2>{0.283513099f, 0.281760365f},
-std::array<float,2>{0.814070642f, 0.313733786f},
-std::array<float,2>{0.0181472022f, 0.868042588f},
-std::array<float,2>{0.749438167f, 0.693868876f},
-std::array<float,2>{0.468145341f, 0.124216869f},
-std::array<float,2>{0.597286105f, 0.216035157f},
-std::array<float,2>{0.344113529f, 0.573173225f},
-std::array<float,2>{0.913391352f, 0.904100716f},
-std::array<float,2>{0.161774516f, 0.449079216f},
-std::array<float,2>{0.58347559f, 0.460261077f},
-std::array<float,2>{0.314235061f, 0.887317836f},
-std::array<float,2>{0.894910753f, 0.584082544f},
-std::array<float,2>{0.155689076f, 0.194155976f},
-std::array<float,2>{0.859990001f, 0.107959986f},
-std::array<float,2>{0.0371378362f, 0.712528646f},
-std::array<float,2>{0.701538265f, 0.857073665f},
-std::array<float,2>{0.473199934f, 0.332842618f},
-std::array<float,2>{0.95733732f, 0.307171375f},
-std::array<float,2>{0.22685653f, 0.781770289f},
-std::array<float,2>{0.56137675f, 0.657354534f},
-std::array<float,2>{0.280920029f, 0.0289755296f},
-std::array<float,2>{0.632029414f, 0.159252942f},
-std::array<float,2>{0.414978713f, 0.542864084f},
-std::array<float,2>{0.809745669f, 0.981850445f},
-std::array<float,2>{0.0974721611f, 0.402568728f},
-std::array<float,2>{0.72158891f, 0.367164642f},
-std::array<float,2>{0.450172424f, 0.82755661f},
-std::array<float,2>{0.829966247f, 0.747353077f},
-std::array<float,2>{0.00885060988f, 0.089790903f},
-std::array<float,2>{0.936763465f, 0.244267091f},
-std::array<float,2>{0.175736427f, 0.614294469f},
-std::array<float,2>{0.62336421f, 0.925645232f},
-std::array<float,2>{0.360256821f, 0.474377841f},
-std::array<float,2>{0.775765777f, 0.408445179f},
-std::array<float,2>{0.0750371292f, 0.945747256f},
-std::array<float,2>{0.687074125f, 0.502544641f},
-std::array<float,2>{0.380536199f, 0.155850425f},
-std::array<float,2>{0.505321801f, 0.0413221568f},
-std::array<float,2>{0.308963299f, 0.633585036f},
-std::array<float,2>{0.984734237f, 0.7669608f},
-std::array<float,2>{0.198535487f, 0.258099556f},
-std::array<float,2>{0.61401403f, 0.338761061f},
-std::array<float,2>{0.370672286f, 0.849398971f},
-std::array<float,2>{0.926998079f, 0.707162797f},
-std::array<float,2>{0.180736437f, 0.101468459f},
-std::array<float,2>{0.840117395f, 0.200199708f},
-std::array<float,2>{0.00335616781f, 0.593531132f},
-std::array<float,2>{0.73200202f, 0.881231844f},
-std::array<float,2>{0.442718327f, 0.462050021f},
-std::array<float,2>{0.995729268f, 0.390663266f},
-std::array<float,2>{0.19298853f, 0.973500907f},
-std::array<float,2>{0.514650643f, 0.535093367f},
-std::array<float,2>{0.303818971f, 0.17044507f},
-std::array<float,2>{0.672984838f, 0.0207612664f},
-std::array<float,2>{0.386664659f, 0.668092847f},
-std::array<float,2>{0.771254838f, 0.794159889f},
-std::array<float,2>{0.064540714f, 0.304529548f},
-std::array<float,2>{0.692077398f, 0.481761128f},
-std::array<float,2>{0.483114749f, 0.937340736f},
-std::array<float,2>{0.869778812f, 0.624279737f},
-std::array<float,2>{0.0464497879f, 0.236227483f},
-std::array<float,2>{0.89958322f, 0.0830545798f},
-std::array<float,2>{0.147374675f, 0.735802352f},
-std::array<float,2>{0.590734065f, 0.815480709f},
-std::array<float,2>{0.327811599f, 0.374036819f},
-std::array<float,2>{0.798889458f, 0.255539745f},
-std::array<float,2>{0.106767349f, 0.778654277f},
-std::array<float,2>{0.639652669f, 0.626429617f},
-std::array<float,2>{0.413373739f, 0.0385419987f},
-std::array<float,2>{0.550867617f, 0.146446839f},
-std::array<float,2>{0.269724607f, 0.51504153f},
-std::array<float,2>{0.965037048f, 0.941768527f},
-std::array<float,2>{0.222138613f, 0.41507411f},
-std::array<float,2>{0.519848943f, 0.434564054f},
-std::array<float,2>{0.290115803f, 0.965869665f},
-std::array<float,2>{0.978721082f, 0.529849946f},
-std::array<float,2>{0.210583419f, 0.137820974f},
-std::array<float,2>{0.755417824f, 0.0469823442f},
-std::array<float,2>{0.0898420438f, 0.642146349f},
-std::array<float,2>{0.659111321f, 0.755614936f},
-std::array<float,2>{0.404009402f, 0.276328415f},
-std::array<float,2>{0.916016042f, 0.346523166f},
-std::array<float,2>{0.170680255f, 0.828367889f},
-std::array<float,2>{0.602746546f, 0.725034177f},
-std::array<float,2>{0.357100844f, 0.0654502958f},
-std::array<float,2>{0.739526629f, 0.222786874f},
-std::array<float,2>{0.453525245f, 0.60142982f},
-std::array<float,2>{0.820446372f, 0.918661833f},
-std::array<float,2>{0.0285603926f, 0.489882827f},
-std::array<float,2>{0.650222182f, 0.293818444f},
-std::array<float,2>{0.428507239f, 0.810345531f},
-std::array<float,2>{0.783273995f, 0.67321378f},
-std::array<float,2>{0.117361136f, 0.0123920701f},
-std::array<float,2>{0.949070573f, 0.177739888f},
-std::array<float,2>{0.248595595f, 0.560548544f},
-std::array<float,2>{0.54616791f, 0.998838544f},
-std::array<float,2>{0.253076375f, 0.378447056f},
-std::array<float,2>{0.855058849f, 0.438670546f},
-std::array<float,2>{0.060283836f, 0.895579934f},
-std::array<float,2>{0.718599141f, 0.564958274f},
-std::array<float,2>{0.491777539f, 0.205104887f},
-std::array<float,2>{0.572157323f, 0.110935919f},
-std::array<float,2>{0.340649337f, 0.699229777f},
-std::array<float,2>{0.886250019f, 0.865840793f},
-std::array<float,2>{0.13462086f, 0.325150549f},
-std::array<float,2>{0.56790632f, 0.299393356f},
-std::array<float,2>{0.335069954f, 0.789485097f},
-std::array<float,2>{0.880580902f, 0.666536212f},
-std::array<float,2>{0.127165452f, 0.0177423712f},
-std::array<float,2>{0.849609673f, 0.165028498f},
-std::array<float,2>{0.0504709482f, 0.535373092f},
-std::array<float,2>{0.709718287f, 0.971304774f},
-std::array<float,2>{0.494798779f, 0.395145655f},
-std::array<float,2>{0.94380039f, 0.465653241f},
-std::array<float,2>{0.240602195f, 0.875963271f},
-std::array<float,2>{0.534055054f, 0.587931573f},
-std::array<float,2>{0.262047261f, 0.196218669f},
-std::array<float,2>{0.644903481f, 0.0957890525f},
-std::array<float,2>{0.429716498f, 0.70546037f},
-std::array<float,2>{0.796508014f, 0.844903946f},
-std::array<float,2>{0.111886024f, 0.342425406f},
-std::array<float,2>{0.745620131f, 0.418997526f},
-std::array<float,2>{0.463187337f, 0.939628363f},
-std::array<float,2>{0.817775726f, 0.50912571f},
-std::array<float,2>{0.0210557319f, 0.143030316f},
-std::array<float,2>{0.908538938f, 0.0346942134f},
-std::array<float,2>{0.15626362f, 0.632392287f},
-std::array<float,2>{0.598466456f, 0.777246118f},
-std::array<float,2>{0.348160714f, 0.252300471f},
-std::array<float,2>{0.761932492f, 0.369264543f},
-std::array<float,2>{0.0841877982f, 0.817618191f},
-std::array<float,2>{0.669011474f, 0.738588035f},
-std::array<float,2>{0.392011881f, 0.0793605372f},
-std::array<float,2>{0.526746392f, 0.240216777f},
-std::array<float,2>{0.286542118f, 0.620957673f},
-std::array<float,2>{0.975623965f, 0.930791676f},
-std::array<float,2>{0.217121527f, 0.478277147f},
-std::array<float,2>{0.55600059f, 0.485101044f},
-std::array<float,2>{0.273878634f, 0.91756922f},
-std::array<float,2>{0.953471422f, 0.597166836f},
-std::array<float,2>{0.231652603f, 0.219605699f},
-std::array<float,2>{0.806562483f, 0.0700748414f},
-std::array<float,2>{0.101334088f, 0.719336152f},
-std::array<float,2>{0.625953019f, 0.834600389f},
-std::array<float,2>{0.420725256f, 0.350738913f},
-std::array<float,2>{0.891905069f, 0.281112075f},
-std::array<float,2>{0.152274787f, 0.750804245f},
-std::array<float,2>{0.580026627f, 0.647762477f},
-std::array<float,2>{0.318547934f, 0.053663075f},
-std::array<float,2>{0.698151886f, 0.135914013f},
-std::array<float,2>{0.472196281f, 0.523795664f},
-std::array<float,2>{0.864275038f, 0.962938964f},
-std::array<float,2>{0.0313737094f, 0.433304489f},
-std::array<float,2>{0.680776596f, 0.320884794f},
-std::array<float,2>{0.377138227f, 0.85951376f},
-std::array<float,2>{0.777943313f, 0.698444545f},
-std::array<float,2>{0.0735350549f, 0.113782704f},
-std::array<float,2>{0.99082619f, 0.208248079f},
-std::array<float,2>{0.202455699f, 0.569842219f},
-std::array<float,2>{0.50333035f, 0.891590714f},
-std::array<float,2>{0.307327658f, 0.444399238f},
-std::array<float,2>{0.83574158f, 0.37975511f},
-std::array<float,2>{0.0141912205f, 0.994383693f},
-std::array<float,2>{0.726140201f, 0.555041671f},
-std::array<float,2>{0.447243154f, 0.172269046f},
-std::array<float,2>{0.618026793f, 0.00917790271f},
-std::array<float,2>{0.364828348f, 0.679004967f},
-std::array<float,2>{0.931996286f, 0.80851084f},
-std::array<float,2>{0.176800802f, 0.289085299f},
-std::array<float,2>{0.510103345f, 0.352987528f},
-std::array<float,2>{0.299226284f, 0.839677513f},
-std::array<float,2>{0.998365521f, 0.731051087f},
-std::array<float,2>{0.190997779f, 0.0754262581f},
-std::array<float,2>{0.768728495f, 0.228766501f},
-std::array<float,2>{0.0679959878f, 0.602517843f},
-std::array<float,2>{0.678663015f, 0.906263113f},
-std::array<float,2>{0.390444666f, 0.496209323f},
-std::array<float,2>{0.923857212f, 0.423171639f},
-std::array<float,2>{0.185624287f, 0.959880114f},
-std::array<float,2>{0.61260426f, 0.518412471f},
-std::array<float,2>{0.374105394f, 0.12709263f},
-std::array<float,2>{0.727654696f, 0.0618469492f},
-std::array<float,2>{0.441230834f, 0.649002373f},
-std::array<float,2>{0.836953402f, 0.763958395f},
-std::array<float,2>{0.00536911236f, 0.269456178f},
-std::array<float,2>{0.633363008f, 0.45188272f},
-std::array<float,2>{0.407230675f, 0.898485899f},
-std::array<float,2>{0.80441308f, 0.577368319f},
-std::array<float,2>{0.103068538f, 0.211865902f},
-std::array<float,2>{0.963043451f, 0.118451729f},
-std::array<float,2>{0.225823924f, 0.68762821f},
-std::array<float,2>{0.547912776f, 0.873784065f},
-std::array<float,2>{0.268570185f, 0.320296854f},
-std::array<float,2>{0.873589933f, 0.286975294f},
-std::array<float,2>{0.0418708734f, 0.797234774f},
-std::array<float,2>{0.689416885f, 0.680807889f},
-std::array<float,2>{0.479350954f, 0.00734982966f},
-std::array<float,2>{0.588116646f, 0.18028143f},
-std::array<float,2>{0.322463661f, 0.552101433f},
-std::array<float,2>{0.904732108f, 0.990676522f},
-std::array<float,2>{0.143090993f, 0.383371115f},
-std::array<float,2>{0.60595727f, 0.399861157f},
-std::array<float,2>{0.353545368f, 0.976806402f},
-std::array<float,2>{0.920911372f, 0.546384931f},
-std::array<float,2>{0.167647719f, 0.162502527f},
-std::array<float,2>{0.825362742f, 0.0257504433f},
-std::array<float,2>{0.0264398959f, 0.661310673f},
-std::array<float,2>{0.736917436f, 0.785988271f},
-std::array<float,2>{0.457460374f, 0.311625034f},
-std::array<float,2>{0.984276175f, 0.329305738f},
-std::array<float,2>{0.206401169f, 0.853858948f},
-std::array<float,2>{0.516297877f, 0.716454864f},
-std::array<float,2>{0.293389708f, 0.104183987f},
-std::array<float,2>{0.662707329f, 0.187921047f},
-std::array<float,2>{0.402334571f, 0.581534684f},
-std::array<float,2>{0.750388265f, 0.885286331f},
-std::array<float,2>{0.0919275433f, 0.454385281f},
-std::array<float,2>{0.714819431f, 0.264860511f},
-std::array<float,2>{0.484492421f, 0.77178669f},
-std::array<float,2>{0.855819881f, 0.639155388f},
-std::array<float,2>{0.0583633669f, 0.0447986871f},
-std::array<float,2>{0.887532175f, 0.15104939f},
-std::array<float,2>{0.139163852f, 0.504168332f},
-std::array<float,2>{0.57732302f, 0.952258527f},
-std::array<float,2>{0.336595416f, 0.410301954f},
-std::array<float,2>{0.788703024f, 0.472577095f},
-std::array<float,2>{0.121387385f, 0.928384066f},
-std::array<float,2>{0.654494941f, 0.611924291f},
-std::array<float,2>{0.424663216f, 0.246121362f},
-std::array<float,2>{0.542056739f, 0.0900025591f},
-std::array<float,2>{0.255596906f, 0.742532074f},
-std::array<float,2>{0.952942252f, 0.822679937f},
-std::array<float,2>{0.242723659f, 0.360096961f},
-std::array<float,2>{0.527620614f, 0.28393203f},
-std::array<float,2>{0.281394541f, 0.801335871f},
-std::array<float,2>{0.970813155f, 0.687128186f},
-std::array<float,2>{0.212307036f, 0.000983844395f},
-std::array<float,2>{0.758975029f, 0.184034854f},
-std::array<float,2>{0.0789389387f, 0.550352812f},
-std::array<float,2>{0.667310238f, 0.985235393f},
-std::array<float,2>{0.396444499f, 0.389063507f},
-std::array<float,2>{0.910372436f, 0.447132945f},
-std::array<float,2>{0.163587287f, 0.905059516f},
-std::array<float,2>{0.593818247f, 0.57152921f},
-std::array<float,2>{0.346547484f, 0.217410892f},
-std::array<float,2>{0.74725312f, 0.122410737f},
-std::array<float,2>{0.465861857f, 0.693003774f},
-std::array<float,2>{0.815396428f, 0.870387852f},
-std::array<float,2>{0.0169016346f, 0.315133095f},
-std::array<float,2>{0.643425584f, 0.429391831f},
-std::array<float,2>{0.434136868f, 0.955151558f},
-std::array<float,2>{0.790995896f, 0.519677162f},
-std::array<float,2>{0.117167786f, 0.131801531f},
-std::array<float,2>{0.937773049f, 0.0569739193f},
-std::array<float,2>{0.2369515f, 0.655679107f},
-std::array<float,2>{0.537680089f, 0.759446025f},
-std::array<float,2>{0.260738224f, 0.271000952f},
-std::array<float,2>{0.845975697f, 0.356084406f},
-std::array<float,2>{0.0517721623f, 0.841833889f},
-std::array<float,2>{0.705522239f, 0.72848171f},
-std::array<float,2>{0.498685509f, 0.0712638199f},
-std::array<float,2>{0.563907146f, 0.232293069f},
-std::array<float,2>{0.328831166f, 0.606043518f},
-std::array<float,2>{0.878479362f, 0.911710739f},
-std::array<float,2>{0.130698174f, 0.49393326f},
-std::array<float,2>{0.6211285f, 0.475845873f},
-std::array<float,2>{0.362815529f, 0.921901643f},
-std::array<float,2>{0.934360802f, 0.616913676f},
-std::array<float,2>{0.173753843f, 0.242729977f},
-std::array<float,2>{0.831429422f, 0.0859724209f},
-std::array<float,2>{0.00999475084f, 0.748448193f},
-std::array<float,2>{0.718792856f, 0.825775087f},
-std::array<float,2>{0.451599002f, 0.363469154f},
-std::array<float,2>{0.987762809f, 0.259769112f},
-std::array<float,2>{0.196746483f, 0.767695606f},
-std::array<float,2>{0.507783175f, 0.63564378f},
-std::array<float,2>{0.31076768f, 0.0394425169f},
-std::array<float,2>{0.684770286f, 0.152833179f},
-std::array<float,2>{0.38178274f, 0.50069648f},
-std::array<float,2>{0.775158763f, 0.94804734f},
-std::array<float,2>{0.0766092241f, 0.407271713f},
-std::array<float,2>{0.700609624f, 0.334654838f},
-std::array<float,2>{0.475867331f, 0.858200192f},
-std::array<float,2>{0.861929178f, 0.714324117f},
-std::array<float,2>{0.0359570868f, 0.105704337f},
-std::array<float,2>{0.897016108f, 0.192189261f},
-std::array<float,2>{0.153004959f, 0.583096206f},
-std::array<float,2>{0.5840891f, 0.89040339f},
-std::array<float,2>{0.315533042f, 0.457527697f},
-std::array<float,2>{0.811429262f, 0.405142128f},
-std::array<float,2>{0.0956168026f, 0.983014703f},
-std::array<float,2>{0.630467534f, 0.540917099f},
-std::array<float,2>{0.417937428f, 0.156436771f},
-std::array<float,2>{0.559541881f, 0.0309002604f},
-std::array<float,2>{0.277950794f, 0.659682214f},
-std::array<float,2>{0.960459769f, 0.784341872f},
-std::array<float,2>{0.23007305f, 0.305911034f},
-std::array<float,2>{0.593083024f, 0.371634275f},
-std::array<float,2>{0.325672656f, 0.812586248f},
-std::array<float,2>{0.902279139f, 0.737734556f},
-std::array<float,2>{0.14614971f, 0.0852138475f},
-std::array<float,2>{0.867628038f, 0.237321034f},
-std::array<float,2>{0.0437042154f, 0.621716678f},
-std::array<float,2>{0.693974316f, 0.935166121f},
-std::array<float,2>{0.482050151f, 0.482689172f},
-std::array<float,2>{0.968312144f, 0.417710036f},
-std::array<float,2>{0.219280556f, 0.944674253f},
-std::array<float,2>{0.554297805f, 0.513608873f},
-std::array<float,2>{0.273373723f, 0.146780103f},
-std::array<float,2>{0.637230694f, 0.0364156701f},
-std::array<float,2>{0.411692977f, 0.628105819f},
-std::array<float,2>{0.797647119f, 0.780659735f},
-std::array<float,2>{0.108991407f, 0.257285655f},
-std::array<float,2>{0.733683228f, 0.463494807f},
-std::array<float,2>{0.443685979f, 0.88080585f},
-std::array<float,2>{0.842694104f, 0.59007144f},
-std::array<float,2>{0.00048766387f, 0.202352777f},
-std::array<float,2>{0.92826432f, 0.0993751958f},
-std::array<float,2>{0.183241382f, 0.710719287f},
-std::array<float,2>{0.615936458f, 0.851433158f},
-std::array<float,2>{0.368596584f, 0.336997479f},
-std::array<float,2>{0.772974372f, 0.301334113f},
-std::array<float,2>{0.0630158186f, 0.796245158f},
-std::array<float,2>{0.673881412f, 0.671667039f},
-std::array<float,2>{0.384465575f, 0.0215199087f},
-std::array<float,2>{0.51276058f, 0.168783709f},
-std::array<float,2>{0.302142799f, 0.53167963f},
-std::array<float,2>{0.993284106f, 0.975040853f},
-std::array<float,2>{0.194331154f, 0.394034177f},
-std::array<float,2>{0.544095278f, 0.375429451f},
-std::array<float,2>{0.251213968f, 0.997206032f},
-std::array<float,2>{0.947232008f, 0.560442686f},
-std::array<float,2>{0.246490359f, 0.177151337f},
-std::array<float,2>{0.781351149f, 0.0137617076f},
-std::array<float,2>{0.119570553f, 0.674788952f},
-std::array<float,2>{0.651625931f, 0.810777962f},
-std::array<float,2>{0.427419931f, 0.295159578f},
-std::array<float,2>{0.884293795f, 0.326989174f},
-std::array<float,2>{0.13479133f, 0.864235759f},
-std::array<float,2>{0.572384179f, 0.702130675f},
-std::array<float,2>{0.34187296f, 0.112741776f},
-std::array<float,2>{0.715433776f, 0.203983933f},
-std::array<float,2>{0.490227699f, 0.563836336f},
-std::array<float,2>{0.852669537f, 0.896577835f},
-std::array<float,2>{0.0605590865f, 0.440955758f},
-std::array<float,2>{0.65749079f, 0.27516222f},
-std::array<float,2>{0.405595392f, 0.756566167f},
-std::array<float,2>{0.757622957f, 0.644531131f},
-std::array<float,2>{0.0873414055f, 0.0502936989f},
-std::array<float,2>{0.977565944f, 0.14024289f},
-std::array<float,2>{0.208624586f, 0.528837621f},
-std::array<float,2>{0.522430182f, 0.967501104f},
-std::array<float,2>{0.292679995f, 0.436511934f},
-std::array<float,2>{0.822814167f, 0.491981149f},
-std::array<float,2>{0.0311709754f, 0.92133826f},
-std::array<float,2>{0.742000878f, 0.599242806f},
-std::array<float,2>{0.456463665f, 0.224641606f},
-std::array<float,2>{0.604594767f, 0.0626092255f},
-std::array<float,2>{0.35899964f, 0.722691834f},
-std::array<float,2>{0.91449827f, 0.831964135f},
-std::array<float,2>{0.169428051f, 0.345514089f},
-std::array<float,2>{0.601230025f, 0.250293046f},
-std::array<float,2>{0.350650102f, 0.774798095f},
-std::array<float,2>{0.906879425f, 0.629259646f},
-std::array<float,2>{0.159560189f, 0.0325522199f},
-std::array<float,2>{0.82008487f, 0.141694382f},
-std::array<float,2>{0.0233143289f, 0.51029253f},
-std::array<float,2>{0.743461072f, 0.93778795f},
-std::array<float,2>{0.461360335f, 0.421718687f},
-std::array<float,2>{0.972971141f, 0.478947073f},
-std::array<float,2>{0.216067657f, 0.932486117f},
-std::array<float,2>{0.524209201f, 0.617225647f},
-std::array<float,2>{0.287827969f, 0.240532443f},
-std::array<float,2>{0.671793997f, 0.0812754855f},
-std::array<float,2>{0.39377743f, 0.740966856f},
-std::array<float,2>{0.764200389f, 0.818854094f},
-std::array<float,2>{0.0831012204f, 0.36737144f},
-std::array<float,2>{0.708729506f, 0.397627711f},
-std::array<float,2>{0.492287427f, 0.969053209f},
-std::array<float,2>{0.848181307f, 0.538474202f},
-std::array<float,2>{0.0486551896f, 0.167833924f},
-std::array<float,2>{0.881601751f, 0.0160831045f},
-std::array<float,2>{0.12652047f, 0.665583909f},
-std::array<float,2>{0.568800271f, 0.791018665f},
-std::array<float,2>{0.33231163f, 0.297191262f},
-std::array<float,2>{0.793602586f, 0.340687633f},
-std::array<float,2>{0.110123649f, 0.84763062f},
-std::array<float,2>{0.648259819f, 0.703967333f},
-std::array<float,2>{0.4321419f, 0.0949326828f},
-std::array<float,2>{0.531928837f, 0.197982788f},
-std::array<float,2>{0.264408112f, 0.587263167f},
-std::array<float,2>{0.942554295f, 0.877306879f},
-std::array<float,2>{0.238448426f, 0.466946632f},
-std::array<float,2>{0.501132548f, 0.442806661f},
-std::array<float,2>{0.305010557f, 0.893384159f},
-std::array<float,2>{0.988305211f, 0.567141712f},
-std::array<float,2>{0.199998811f, 0.209798723f},
-std::array<float,2>{0.780755579f, 0.116033278f},
-std::array<float,2>{0.0707301572f, 0.696400523f},
-std::array<float,2>{0.681706548f, 0.862153411f},
-std::array<float,2>{0.375048727f, 0.322580129f},
-std::array<float,2>{0.931539476f, 0.292366385f},
-std::array<float,2>{0.179361537f, 0.805343926f},
-std::array<float,2>{0.620141566f, 0.675841451f},
-std::array<float,2>{0.366403401f, 0.0115419822f},
-std::array<float,2>{0.723632336f, 0.175339639f},
-std::array<float,2>{0.448245972f, 0.557465613f},
-std::array<float,2>{0.832514107f, 0.992549121f},
-std::array<float,2>{0.0117793474f, 0.381820261f},
-std::array<float,2>{0.628402054f, 0.349093974f},
-std::array<float,2>{0.41867885f, 0.832378268f},
-std::array<float,2>{0.807846129f, 0.722505212f},
-std::array<float,2>{0.0994030461f, 0.0665335059f},
-std::array<float,2>{0.955873013f, 0.222644106f},
-std::array<float,2>{0.233598232f, 0.594355166f},
-std::array<float,2>{0.558003724f, 0.915087163f},
-std::array<float,2>{0.276197463f, 0.488100499f},
-std::array<float,2>{0.865739167f, 0.429737031f},
-std::array<float,2>{0.0344015099f, 0.962532282f},
-std::array<float,2>{0.69614619f, 0.52682662f},
-std::array<float,2>{0.469445586f, 0.133281708f},
-std::array<float,2>{0.581988454f, 0.0522220805f},
-std::array<float,2>{0.317373782f, 0.644857347f},
-std::array<float,2>{0.894130409f, 0.753669381f},
-std::array<float,2>{0.149793029f, 0.278414905f},
-std::array<float,2>{0.550388455f, 0.318312436f},
-std::array<float,2>{0.265659094f, 0.873037338f},
-std::array<float,2>{0.961226106f, 0.690437734f},
-std::array<float,2>{0.223446026f, 0.119803861f},
-std::array<float,2>{0.802300751f, 0.214112014f},
-std::array<float,2>{0.104037233f, 0.574229419f},
-std::array<float,2>{0.634907961f, 0.901439726f},
-std::array<float,2>{0.409297496f, 0.450545996f},
-std::array<float,2>{0.903604269f, 0.385302156f},
-std::array<float,2>{0.140809119f, 0.98962146f},
-std::array<float,2>{0.585992634f, 0.55360055f},
-std::array<float,2>{0.32101056f, 0.182073459f},
-std::array<float,2>{0.691120327f, 0.0057699834f},
-std::array<float,2>{0.4773601f, 0.683058023f},
-std::array<float,2>{0.872843504f, 0.799829066f},
-std::array<float,2>{0.0399435051f, 0.288941532f},
-std::array<float,2>{0.676315486f, 0.498834997f},
-std::array<float,2>{0.388359785f, 0.909282982f},
-std::array<float,2>{0.766519547f, 0.604794443f},
-std::array<float,2>{0.0695272088f, 0.226680636f},
-std::array<float,2>{0.996850073f, 0.0770631358f},
-std::array<float,2>{0.187709257f, 0.733542383f},
-std::array<float,2>{0.509535134f, 0.83641088f},
-std::array<float,2>{0.297988445f, 0.354530066f},
-std::array<float,2>{0.839372754f, 0.266652346f},
-std::array<float,2>{0.00730348285f, 0.76181066f},
-std::array<float,2>{0.730391324f, 0.652343512f},
-std::array<float,2>{0.43767488f, 0.0600526445f},
-std::array<float,2>{0.610348284f, 0.126374319f},
-std::array<float,2>{0.372561306f, 0.516954601f},
-std::array<float,2>{0.923259914f, 0.9572348f},
-std::array<float,2>{0.184774414f, 0.424614817f},
-std::array<float,2>{0.575012088f, 0.412545145f},
-std::array<float,2>{0.338405728f, 0.950886786f},
-std::array<float,2>{0.889630139f, 0.506815195f},
-std::array<float,2>{0.137271896f, 0.150256574f},
-std::array<float,2>{0.858621776f, 0.0456515588f},
-std::array<float,2>{0.0559253432f, 0.637845814f},
-std::array<float,2>{0.711674094f, 0.771040857f},
-std::array<float,2>{0.4868761f, 0.263666034f},
-std::array<float,2>{0.950494111f, 0.363135993f},
-std::array<float,2>{0.244925022f, 0.821624041f},
-std::array<float,2>{0.539143145f, 0.744327307f},
-std::array<float,2>{0.256050289f, 0.0933656991f},
-std::array<float,2>{0.652839422f, 0.248181432f},
-std::array<float,2>{0.422961652f, 0.609941125f},
-std::array<float,2>{0.786571026f, 0.927093208f},
-std::array<float,2>{0.123166621f, 0.470145971f},
-std::array<float,2>{0.736217082f, 0.309096456f},
-std::array<float,2>{0.459861815f, 0.789014339f},
-std::array<float,2>{0.826219141f, 0.663112164f},
-std::array<float,2>{0.0235105101f, 0.024295764f},
-std::array<float,2>{0.918577969f, 0.162064448f},
-std::array<float,2>{0.164465368f, 0.544553041f},
-std::array<float,2>{0.60771203f, 0.978929222f},
-std::array<float,2>{0.352599114f, 0.402195185f},
-std::array<float,2>{0.752420068f, 0.455296814f},
-std::array<float,2>{0.0907905325f, 0.884290457f},
-std::array<float,2>{0.660350502f, 0.578209221f},
-std::array<float,2>{0.399162352f, 0.190666556f},
-std::array<float,2>{0.517809629f, 0.102418922f},
-std::array<float,2>{0.296438009f, 0.716905653f},
-std::array<float,2>{0.982149363f, 0.853153467f},
-std::array<float,2>{0.204139292f, 0.331644952f},
-std::array<float,2>{0.561555505f, 0.305552095f},
-std::array<float,2>{0.279574007f, 0.78351593f},
-std::array<float,2>{0.958789468f, 0.658615232f},
-std::array<float,2>{0.2276638f, 0.0295721106f},
-std::array<float,2>{0.808714688f, 0.15770717f},
-std::array<float,2>{0.0960190892f, 0.539932728f},
-std::array<float,2>{0.631783068f, 0.983818352f},
-std::array<float,2>{0.415296406f, 0.406186849f},
-std::array<float,2>{0.896275342f, 0.458580852f},
-std::array<float,2>{0.154556528f, 0.889069378f},
-std::array<float,2>{0.582813323f, 0.582212627f},
-std::array<float,2>{0.312819421f, 0.192699388f},
-std::array<float,2>{0.702498376f, 0.106679752f},
-std::array<float,2>{0.474601656f, 0.713389874f},
-std::array<float,2>{0.86112082f, 0.85867703f},
-std::array<float,2>{0.0383496322f, 0.33499068f},
-std::array<float,2>{0.686111093f, 0.406513572f},
-std::array<float,2>{0.379293442f, 0.949179471f},
-std::array<float,2>{0.776767969f, 0.501775503f},
-std::array<float,2>{0.0756452382f, 0.153515458f},
-std::array<float,2>{0.985622168f, 0.040288277f},
-std::array<float,2>{0.197271258f, 0.635982037f},
-std::array<float,2>{0.503980041f, 0.769073009f},
-std::array<float,2>{0.310309708f, 0.261468887f},
-std::array<float,2>{0.829060316f, 0.364579707f},
-std::array<float,2>{0.00828333758f, 0.825041533f},
-std::array<float,2>{0.721939147f, 0.749048412f},
-std::array<float,2>{0.451020241f, 0.0871537626f},
-std::array<float,2>{0.62425977f, 0.243592992f},
-std::array<float,2>{0.361059815f, 0.615381718f},
-std::array<float,2>{0.936173737f, 0.922985673f},
-std::array<float,2>{0.174251676f, 0.475275666f},
-std::array<float,2>{0.565051496f, 0.492683858f},
-std::array<float,2>{0.330857068f, 0.911029041f},
-std::array<float,2>{0.87500149f, 0.606535017f},
-std::array<float,2>{0.131283f, 0.231382921f},
-std::array<float,2>{0.845265388f, 0.0713550299f},
-std::array<float,2>{0.0544358939f, 0.726780653f},
-std::array<float,2>{0.703383982f, 0.843338192f},
-std::array<float,2>{0.496339768f, 0.356573641f},
-std::array<float,2>{0.941393197f, 0.269674003f},
-std::array<float,2>{0.234603539f, 0.757946491f},
-std::array<float,2>{0.53536582f, 0.65470469f},
-std::array<float,2>{0.258526385f, 0.0583254769f},
-std::array<float,2>{0.640659928f, 0.132221386f},
-std::array<float,2>{0.437486231f, 0.521383703f},
-std::array<float,2>{0.791597784f, 0.956285834f},
-std::array<float,2>{0.113492146f, 0.428388923f},
-std::array<float,2>{0.748994827f, 0.315745324f},
-std::array<float,2>{0.466875106f, 0.86996007f},
-std::array<float,2>{0.813445151f, 0.692192674f},
-std::array<float,2>{0.0194889456f, 0.121214531f},
-std::array<float,2>{0.913031638f, 0.218595684f},
-std::array<float,2>{0.160659596f, 0.570902586f},
-std::array<float,2>{0.596616507f, 0.905554354f},
-std::array<float,2>{0.345185161f, 0.445674241f},
-std::array<float,2>{0.760965288f, 0.390022248f},
-std::array<float,2>{0.0818912461f, 0.986048281f},
-std::array<float,2>{0.665403068f, 0.549460649f},
-std::array<float,2>{0.397314817f, 0.184995145f},
-std::array<float,2>{0.529734731f, 4.75873567e-05f},
-std::array<float,2>{0.28445071f, 0.685803354f},
-std::array<float,2>{0.969482541f, 0.802134097f},
-std::array<float,2>{0.212969825f, 0.28500995f},
-std::array<float,2>{0.602147877f, 0.344391823f},
-std::array<float,2>{0.356309444f, 0.830558062f},
-std::array<float,2>{0.917096734f, 0.723646283f},
-std::array<float,2>{0.171792805f, 0.0641613081f},
-std::array<float,2>{0.821774065f, 0.225619316f},
-std::array<float,2>{0.0279947408f, 0.598181784f},
-std::array<float,2>{0.73902452f, 0.920480847f},
-std::array<float,2>{0.454676807f, 0.490450859f},
-std::array<float,2>{0.980466247f, 0.437253445f},
-std::array<float,2>{0.20936814f, 0.968637288f},
-std::array<float,2>{0.521226645f, 0.52811408f},
-std::array<float,2>{0.289127529f, 0.139233872f},
-std::array<float,2>{0.659803987f, 0.0493034944f},
-std::array<float,2>{0.402494043f, 0.642826796f},
-std::array<float,2>{0.75437659f, 0.757647157f},
-std::array<float,2>{0.0883847103f, 0.273715913f},
-std::array<float,2>{0.717648745f, 0.440067261f},
-std::array<float,2>{0.491085887f, 0.898035944f},
-std::array<float,2>{0.854213059f, 0.562928021f},
-std::array<float,2>{0.059166465f, 0.20429638f},
-std::array<float,2>{0.885586739f, 0.111546725f},
-std::array<float,2>{0.133300766f, 0.702833474f},
-std::array<float,2>{0.57090503f, 0.864376783f},
-std::array<float,2>{0.340977669f, 0.327380091f},
-std::array<float,2>{0.784693241f, 0.296244711f},
-std::array<float,2>{0.118674174f, 0.812097728f},
-std::array<float,2>{0.648870587f, 0.675412178f},
-std::array<float,2>{0.428863436f, 0.0146616055f},
-std::array<float,2>{0.545267165f, 0.176012367f},
-std::array<float,2>{0.252301782f, 0.559512138f},
-std::array<float,2>{0.947956324f, 0.997062743f},
-std::array<float,2>{0.249044985f, 0.376239568f},
-std::array<float,2>{0.513714552f, 0.393068343f},
-std::array<float,2>{0.302735656f, 0.976152658f},
-std::array<float,2>{0.994772911f, 0.532401562f},
-std::array<float,2>{0.191671416f, 0.169316933f},
-std::array<float,2>{0.770356059f, 0.022932576f},
-std::array<float,2>{0.0662613735f, 0.669952273f},
-std::array<float,2>{0.672059238f, 0.795230389f},
-std::array<float,2>{0.385741472f, 0.301806867f},
-std::array<float,2>{0.925915182f, 0.335974902f},
-std::array<float,2>{0.179690912f, 0.850034893f},
-std::array<float,2>{0.615152836f, 0.709797859f},
-std::array<float,2>{0.36934647f, 0.0978979841f},
-std::array<float,2>{0.730723917f, 0.201184928f},
-std::array<float,2>{0.441675425f, 0.591333807f},
-std::array<float,2>{0.841590106f, 0.879622221f},
-std::array<float,2>{0.00268229377f, 0.46446541f},
-std::array<float,2>{0.638945103f, 0.256472528f},
-std::array<float,2>{0.412356883f, 0.779602706f},
-std::array<float,2>{0.80015552f, 0.627184987f},
-std::array<float,2>{0.106330216f, 0.0360500626f},
-std::array<float,2>{0.965826869f, 0.147842392f},
-std::array<float,2>{0.221332684f, 0.512547135f},
-std::array<float,2>{0.552379549f, 0.943555593f},
-std::array<float,2>{0.271457911f, 0.416717619f},
-std::array<float,2>{0.870651305f, 0.484059781f},
-std::array<float,2>{0.0455509275f, 0.933724999f},
-std::array<float,2>{0.693301082f, 0.622188866f},
-std::array<float,2>{0.483789355f, 0.236396894f},
-std::array<float,2>{0.590823412f, 0.0842869356f},
-std::array<float,2>{0.326660633f, 0.737275898f},
-std::array<float,2>{0.899045825f, 0.813732266f},
-std::array<float,2>{0.148431867f, 0.372234881f},
-std::array<float,2>{0.578496814f, 0.277810842f},
-std::array<float,2>{0.320262641f, 0.752606511f},
-std::array<float,2>{0.89068383f, 0.646200538f},
-std::array<float,2>{0.150569186f, 0.0514498577f},
-std::array<float,2>{0.863963127f, 0.134464651f},
-std::array<float,2>{0.0329323262f, 0.525683582f},
-std::array<float,2>{0.698518276f, 0.961189687f},
-std::array<float,2>{0.471618891f, 0.431530029f},
-std::array<float,2>{0.954977036f, 0.486714602f},
-std::array<float,2>{0.230716571f, 0.914499581f},
-std::array<float,2>{0.555076361f, 0.595702827f},
-std::array<float,2>{0.274664342f, 0.221478626f},
-std::array<float,2>{0.626440942f, 0.0680031106f},
-std::array<float,2>{0.421772897f, 0.721367776f},
-std::array<float,2>{0.805330753f, 0.833046496f},
-std::array<float,2>{0.100357704f, 0.347686023f},
-std::array<float,2>{0.724912107f, 0.382215798f},
-std::array<float,2>{0.445565313f, 0.993371606f},
-std::array<float,2>{0.834650755f, 0.557988405f},
-std::array<float,2>{0.0149011267f, 0.174203679f},
-std::array<float,2>{0.932623446f, 0.00994904432f},
-std::array<float,2>{0.176070452f, 0.677249074f},
-std::array<float,2>{0.618510604f, 0.806286693f},
-std::array<float,2>{0.363908887f, 0.291153699f},
-std::array<float,2>{0.778833568f, 0.323415667f},
-std::array<float,2>{0.0732333958f, 0.863203764f},
-std::array<float,2>{0.680259764f, 0.695649862f},
-std::array<float,2>{0.378712386f, 0.116864175f},
-std::array<float,2>{0.502393305f, 0.210222423f},
-std::array<float,2>{0.308383793f, 0.567758203f},
-std::array<float,2>{0.991294503f, 0.894355118f},
-std::array<float,2>{0.201720148f, 0.442177653f},
-std::array<float,2>{0.534538686f, 0.468527257f},
-std::array<float,2>{0.26306197f, 0.878495812f},
-std::array<float,2>{0.944547892f, 0.586617231f},
-std::array<float,2>{0.242061526f, 0.198835611f},
-std::array<float,2>{0.795639098f, 0.0944103003f},
-std::array<float,2>{0.11261601f, 0.704617023f},
-std::array<float,2>{0.645639837f, 0.846301556f},
-std::array<float,2>{0.431138486f, 0.341061711f},
-std::array<float,2>{0.879696012f, 0.29869163f},
-std::array<float,2>{0.128694668f, 0.792728662f},
-std::array<float,2>{0.566643f, 0.664160967f},
-std::array<float,2>{0.334481388f, 0.0175230466f},
-std::array<float,2>{0.710651636f, 0.16680257f},
-std::array<float,2>{0.495439887f, 0.53724277f},
-std::array<float,2>{0.850805223f, 0.969862819f},
-std::array<float,2>{0.0493828468f, 0.396677315f},
-std::array<float,2>{0.668806732f, 0.369058937f},
-std::array<float,2>{0.391581774f, 0.819801271f},
-std::array<float,2>{0.763195992f, 0.742014349f},
-std::array<float,2>{0.0853970349f, 0.0805886164f},
-std::array<float,2>{0.974808276f, 0.242171943f},
-std::array<float,2>{0.217860416f, 0.618259132f},
-std::array<float,2>{0.525649488f, 0.932707548f},
-std::array<float,2>{0.285179764f, 0.479499519f},
-std::array<float,2>{0.817340076f, 0.420250714f},
-std::array<float,2>{0.0195863713f, 0.939003229f},
-std::array<float,2>{0.744867206f, 0.510882437f},
-std::array<float,2>{0.464835942f, 0.141235128f},
-std::array<float,2>{0.599041522f, 0.0320851617f},
-std::array<float,2>{0.349583983f, 0.630784035f},
-std::array<float,2>{0.909905255f, 0.773451924f},
-std::array<float,2>{0.158121929f, 0.251495451f},
-std::array<float,2>{0.516879141f, 0.330825061f},
-std::array<float,2>{0.293983132f, 0.851718187f},
-std::array<float,2>{0.982801855f, 0.718666315f},
-std::array<float,2>{0.205670312f, 0.103050128f},
-std::array<float,2>{0.751158834f, 0.189795956f},
-std::array<float,2>{0.0933403671f, 0.57992655f},
-std::array<float,2>{0.663789868f, 0.883482158f},
-std::array<float,2>{0.400424153f, 0.456305236f},
-std::array<float,2>{0.920563817f, 0.400747001f},
-std::array<float,2>{0.166472316f, 0.980391622f},
-std::array<float,2>{0.60716331f, 0.543388128f},
-std::array<float,2>{0.35478726f, 0.160867482f},
-std::array<float,2>{0.737827361f, 0.0253766868f},
-std::array<float,2>{0.458590835f, 0.663058221f},
-std::array<float,2>{0.824669361f, 0.787814856f},
-std::array<float,2>{0.0260187835f, 0.309671044f},
-std::array<float,2>{0.655705988f, 0.468928307f},
-std::array<float,2>{0.424878418f, 0.926461756f},
-std::array<float,2>{0.787679255f, 0.610931396f},
-std::array<float,2>{0.122208402f, 0.249465793f},
-std::array<float,2>{0.951424718f, 0.0923969895f},
-std::array<float,2>{0.244096428f, 0.745326817f},
-std::array<float,2>{0.541370988f, 0.821241319f},
-std::array<float,2>{0.253924638f, 0.361737967f},
-std::array<float,2>{0.857393742f, 0.262272537f},
-std::array<float,2>{0.0574544705f, 0.770419478f},
-std::array<float,2>{0.713736415f, 0.637262166f},
-std::array<float,2>{0.485931665f, 0.046055194f},
-std::array<float,2>{0.576481819f, 0.1490646f},
-std::array<float,2>{0.337794036f, 0.506935179f},
-std::array<float,2>{0.888169885f, 0.949489892f},
-std::array<float,2>{0.140444025f, 0.413205504f},
-std::array<float,2>{0.612082362f, 0.425005853f},
-std::array<float,2>{0.373522758f, 0.958268821f},
-std::array<float,2>{0.925474524f, 0.516185462f},
-std::array<float,2>{0.187316805f, 0.125734821f},
-std::array<float,2>{0.836907804f, 0.0594030507f},
-std::array<float,2>{0.00414287718f, 0.650769353f},
-std::array<float,2>{0.727328539f, 0.762762487f},
-std::array<float,2>{0.43981573f, 0.265758365f},
-std::array<float,2>{0.999930739f, 0.353864163f},
-std::array<float,2>{0.190094665f, 0.837291956f},
-std::array<float,2>{0.511467338f, 0.732658744f},
-std::array<float,2>{0.300719857f, 0.0775199756f},
-std::array<float,2>{0.679200888f, 0.228284612f},
-std::array<float,2>{0.389192045f, 0.604135334f},
-std::array<float,2>{0.767938137f, 0.908254564f},
-std::array<float,2>{0.0666229576f, 0.499131829f},
-std::array<float,2>{0.68753469f, 0.287837297f},
-std::array<float,2>{0.479492307f, 0.799511254f},
-std::array<float,2>{0.874870837f, 0.682274044f},
-std::array<float,2>{0.0425728448f, 0.00404249458f},
-std::array<float,2>{0.905656874f, 0.183049068f},
-std::array<float,2>{0.144253492f, 0.554302454f},
-std::array<float,2>{0.589707136f, 0.988952696f},
-std::array<float,2>{0.32385841f, 0.386414349f},
-std::array<float,2>{0.803432226f, 0.449782133f},
-std::array<float,2>{0.102498032f, 0.900399446f},
-std::array<float,2>{0.634718001f, 0.575283289f},
-std::array<float,2>{0.406575352f, 0.213819697f},
-std::array<float,2>{0.547154188f, 0.120374799f},
-std::array<float,2>{0.268372923f, 0.690303743f},
-std::array<float,2>{0.964511037f, 0.87186414f},
-std::array<float,2>{0.224767104f, 0.31727168f},
-std::array<float,2>{0.50631398f, 0.259185791f},
-std::array<float,2>{0.311839849f, 0.766091645f},
-std::array<float,2>{0.987087548f, 0.633862853f},
-std::array<float,2>{0.195489943f, 0.0423760191f},
-std::array<float,2>{0.773939848f, 0.154732719f},
-std::array<float,2>{0.0776354522f, 0.502956629f},
-std::array<float,2>{0.684238374f, 0.946866691f},
-std::array<float,2>{0.38200599f, 0.409889013f},
-std::array<float,2>{0.93529588f, 0.472970724f},
-std::array<float,2>{0.17227754f, 0.924799085f},
-std::array<float,2>{0.622774243f, 0.613704443f},
-std::array<float,2>{0.361419111f, 0.24557133f},
-std::array<float,2>{0.71981293f, 0.0879250392f},
-std::array<float,2>{0.45252201f, 0.746609211f},
-std::array<float,2>{0.831027031f, 0.826415598f},
-std::array<float,2>{0.0115769552f, 0.366149276f},
-std::array<float,2>{0.629635394f, 0.403924346f},
-std::array<float,2>{0.416318864f, 0.980559587f},
-std::array<float,2>{0.811826527f, 0.541306555f},
-std::array<float,2>{0.0940014198f, 0.158563003f},
-std::array<float,2>{0.959584951f, 0.0276302788f},
-std::array<float,2>{0.228877455f, 0.656475902f},
-std::array<float,2>{0.560220361f, 0.782668293f},
-std::array<float,2>{0.278540015f, 0.307744026f},
-std::array<float,2>{0.863150477f, 0.333679199f},
-std::array<float,2>{0.0367521793f, 0.85551852f},
-std::array<float,2>{0.699463069f, 0.711732626f},
-std::array<float,2>{0.475434065f, 0.108778656f},
-std::array<float,2>{0.58539027f, 0.194460273f},
-std::array<float,2>{0.315020949f, 0.585766792f},
-std::array<float,2>{0.898365021f, 0.888134301f},
-std::array<float,2>{0.153491765f, 0.459197551f},
-std::array<float,2>{0.595196962f, 0.44766596f},
-std::array<float,2>{0.346901089f, 0.90328002f},
-std::array<float,2>{0.912014961f, 0.573451161f},
-std::array<float,2>{0.162550509f, 0.214924306f},
-std::array<float,2>{0.815450788f, 0.12354254f},
-std::array<float,2>{0.0161142126f, 0.694556475f},
-std::array<float,2>{0.746581078f, 0.868398428f},
-std::array<float,2>{0.465104401f, 0.313268811f},
-std::array<float,2>{0.972295225f, 0.283034056f},
-std::array<float,2>{0.21142225f, 0.803068995f},
-std::array<float,2>{0.529076695f, 0.685271919f},
-std::array<float,2>{0.282314181f, 0.00260040071f},
-std::array<float,2>{0.666647255f, 0.18592073f},
-std::array<float,2>{0.394620031f, 0.548425734f},
-std::array<float,2>{0.757930279f, 0.986946821f},
-std::array<float,2>{0.0797481313f, 0.38849324f},
-std::array<float,2>{0.706730425f, 0.358421355f},
-std::array<float,2>{0.499775708f, 0.840374172f},
-std::array<float,2>{0.847456872f, 0.729570627f},
-std::array<float,2>{0.0510927588f, 0.0734955594f},
-std::array<float,2>{0.877012372f, 0.232511967f},
-std::array<float,2>{0.12914139f, 0.608357191f},
-std::array<float,2>{0.562773287f, 0.913570404f},
-std::array<float,2>{0.329621285f, 0.494745553f},
-std::array<float,2>{0.789379537f, 0.426730335f},
-std::array<float,2>{0.115645811f, 0.9532516f},
-std::array<float,2>{0.644130826f, 0.52308774f},
-std::array<float,2>{0.435056388f, 0.129341498f},
-std::array<float,2>{0.538541138f, 0.0566354617f},
-std::array<float,2>{0.261581033f, 0.65308255f},
-std::array<float,2>{0.938879907f, 0.760642648f},
-std::array<float,2>{0.237393752f, 0.273008287f},
-std::array<float,2>{0.573991835f, 0.326155543f},
-std::array<float,2>{0.343053371f, 0.867065966f},
-std::array<float,2>{0.883025944f, 0.700703442f},
-std::array<float,2>{0.136690959f, 0.110233225f},
-std::array<float,2>{0.851583183f, 0.206407309f},
-std::array<float,2>{0.0623271167f, 0.565529585f},
-std::array<float,2>{0.71635592f, 0.895451963f},
-std::array<float,2>{0.488584042f, 0.437505156f},
-std::array<float,2>{0.946167469f, 0.377160311f},
-std::array<float,2>{0.247092381f, 0.999470651f},
-std::array<float,2>{0.543710172f, 0.562340438f},
-std::array<float,2>{0.250468016f, 0.179030597f},
-std::array<float,2>{0.650504589f, 0.0126970597f},
-std::array<float,2>{0.425798059f, 0.672647715f},
-std::array<float,2>{0.782829523f, 0.809319198f},
-std::array<float,2>{0.120588638f, 0.294265479f},
-std::array<float,2>{0.740691423f, 0.488679677f},
-std::array<float,2>{0.455479026f, 0.918955207f},
-std::array<float,2>{0.823826551f, 0.599934638f},
-std::array<float,2>{0.029950263f, 0.223682225f},
-std::array<float,2>{0.915253758f, 0.0644788295f},
-std::array<float,2>{0.168920413f, 0.725650549f},
-std::array<float,2>{0.603734255f, 0.829609692f},
-std::array<float,2>{0.35772264f, 0.34752959f},
-std::array<float,2>{0.75619638f, 0.27701807f},
-std::array<float,2>{0.0861960649f, 0.754188538f},
-std::array<float,2>{0.656363845f, 0.640820503f},
-std::array<float,2>{0.405018926f, 0.0484841838f},
-std::array<float,2>{0.523002446f, 0.137372583f},
-std::array<float,2>{0.291947335f, 0.530757844f},
-std::array<float,2>{0.976716936f, 0.965018749f},
-std::array<float,2>{0.207691386f, 0.435134143f},
-std::array<float,2>{0.553271353f, 0.414136618f},
-std::array<float,2>{0.272391528f, 0.943333268f},
-std::array<float,2>{0.967398047f, 0.513985038f},
-std::array<float,2>{0.220170408f, 0.144658878f},
-std::array<float,2>{0.798800588f, 0.0371272005f},
-std::array<float,2>{0.10783793f, 0.625724912f},
-std::array<float,2>{0.63848722f, 0.778146327f},
-std::array<float,2>{0.410842091f, 0.254089177f},
-std::array<float,2>{0.90061003f, 0.373519003f},
-std::array<float,2>{0.145503625f, 0.815392554f},
-std::array<float,2>{0.592315912f, 0.734489262f},
-std::array<float,2>{0.324668974f, 0.082356371f},
-std::array<float,2>{0.694840431f, 0.234576747f},
-std::array<float,2>{0.481062829f, 0.623649418f},
-std::array<float,2>{0.868635714f, 0.935593009f},
-std::array<float,2>{0.0445983335f, 0.481076241f},
-std::array<float,2>{0.675416589f, 0.303144813f},
-std::array<float,2>{0.383153856f, 0.79332757f},
-std::array<float,2>{0.772120714f, 0.669511497f},
-std::array<float,2>{0.0639196709f, 0.0199856013f},
-std::array<float,2>{0.992689312f, 0.171433687f},
-std::array<float,2>{0.194729462f, 0.533495903f},
-std::array<float,2>{0.512037218f, 0.974384189f},
-std::array<float,2>{0.301266432f, 0.392556876f},
-std::array<float,2>{0.843016267f, 0.461414546f},
-std::array<float,2>{0.00156218233f, 0.882778823f},
-std::array<float,2>{0.733335793f, 0.59249109f},
-std::array<float,2>{0.444905728f, 0.200000972f},
-std::array<float,2>{0.617173433f, 0.100542657f},
-std::array<float,2>{0.367417097f, 0.708756447f},
-std::array<float,2>{0.928920269f, 0.847759485f},
-std::array<float,2>{0.182316393f, 0.339294642f},
-std::array<float,2>{0.620035291f, 0.290087879f},
-std::array<float,2>{0.365880638f, 0.807401538f},
-std::array<float,2>{0.929932296f, 0.677820027f},
-std::array<float,2>{0.178154245f, 0.00821248442f},
-std::array<float,2>{0.833080053f, 0.17344746f},
-std::array<float,2>{0.0128086628f, 0.556300461f},
-std::array<float,2>{0.72380513f, 0.995927632f},
-std::array<float,2>{0.447708696f, 0.380837053f},
-std::array<float,2>{0.990216434f, 0.443364054f},
-std::array<float,2>{0.201089367f, 0.892254591f},
-std::array<float,2>{0.500805378f, 0.568970025f},
-std::array<float,2>{0.306509405f, 0.207084909f},
-std::array<float,2>{0.683247864f, 0.114937916f},
-std::array<float,2>{0.37685132f, 0.697469175f},
-std::array<float,2>{0.779569089f, 0.861014783f},
-std::array<float,2>{0.0714951828f, 0.321668327f},
-std::array<float,2>{0.697069585f, 0.431642622f},
-std::array<float,2>{0.470104486f, 0.964435816f},
-std::array<float,2>{0.866259158f, 0.524772465f},
-std::array<float,2>{0.0335865542f, 0.135345221f},
-std::array<float,2>{0.89285183f, 0.0545716062f},
-std::array<float,2>{0.148918748f, 0.64684093f},
-std::array<float,2>{0.580486119f, 0.751223028f},
-std::array<float,2>{0.317612946f, 0.279478878f},
-std::array<float,2>{0.806713581f, 0.349786222f},
-std::array<float,2>{0.0980894193f, 0.83523947f},
-std::array<float,2>{0.62759912f, 0.720131755f},
-std::array<float,2>{0.419074029f, 0.0689511672f},
-std::array<float,2>{0.556963503f, 0.22054553f},
-std::array<float,2>{0.277306825f, 0.596348524f},
-std::array<float,2>{0.956421494f, 0.916750014f},
-std::array<float,2>{0.232613415f, 0.486287475f},
-std::array<float,2>{0.524833024f, 0.477485776f},
-std::array<float,2>{0.288524479f, 0.930039406f},
-std::array<float,2>{0.974243939f, 0.619386673f},
-std::array<float,2>{0.215261668f, 0.238644749f},
-std::array<float,2>{0.765574634f, 0.0784458667f},
-std::array<float,2>{0.0827204585f, 0.739426136f},
-std::array<float,2>{0.670435607f, 0.817103982f},
-std::array<float,2>{0.393110633f, 0.371022224f},
-std::array<float,2>{0.907964408f, 0.253883451f},
-std::array<float,2>{0.158885688f, 0.775801301f},
-std::array<float,2>{0.600448966f, 0.631332636f},
-std::array<float,2>{0.350353867f, 0.0340221934f},
-std::array<float,2>{0.742328823f, 0.144201249f},
-std::array<float,2>{0.462195128f, 0.508589089f},
-std::array<float,2>{0.819212198f, 0.941316903f},
-std::array<float,2>{0.0216591135f, 0.418401927f},
-std::array<float,2>{0.64692682f, 0.343289703f},
-std::array<float,2>{0.433457136f, 0.844366014f},
-std::array<float,2>{0.79477185f, 0.70641315f},
-std::array<float,2>{0.11111474f, 0.0974450409f},
-std::array<float,2>{0.942182422f, 0.196887478f},
-std::array<float,2>{0.239442497f, 0.58968395f},
-std::array<float,2>{0.532479048f, 0.876897156f},
-std::array<float,2>{0.265050381f, 0.466067523f},
-std::array<float,2>{0.8490749f, 0.396205097f},
-std::array<float,2>{0.0476477407f, 0.972464919f},
-std::array<float,2>{0.707412362f, 0.536361754f},
-std::array<float,2>{0.493936658f, 0.165789828f},
-std::array<float,2>{0.569595933f, 0.0190248657f},
-std::array<float,2>{0.333346665f, 0.667905271f},
-std::array<float,2>{0.88236165f, 0.79011023f},
-std::array<float,2>{0.125436991f, 0.300595224f},
-std::array<float,2>{0.540138245f, 0.360626429f},
-std::array<float,2>{0.257004112f, 0.823369503f},
-std::array<float,2>{0.949269414f, 0.743618786f},
-std::array<float,2>{0.245201111f, 0.0911523998f},
-std::array<float,2>{0.786079109f, 0.247933686f},
-std::array<float,2>{0.124219306f, 0.613142073f},
-std::array<float,2>{0.654183447f, 0.929110885f},
-std::array<float,2>{0.422694623f, 0.471396297f},
-std::array<float,2>{0.889925301f, 0.411748856f},
-std::array<float,2>{0.138005167f, 0.951309025f},
-std::array<float,2>{0.575507045f, 0.50500989f},
-std::array<float,2>{0.338968456f, 0.151630849f},
-std::array<float,2>{0.71271795f, 0.0432636365f},
-std::array<float,2>{0.488241702f, 0.639820039f},
-std::array<float,2>{0.857809067f, 0.773158848f},
-std::array<float,2>{0.0551099963f, 0.264647514f},
-std::array<float,2>{0.661782503f, 0.453655571f},
-std::array<float,2>{0.399930894f, 0.886090457f},
-std::array<float,2>{0.75302422f, 0.580245197f},
-std::array<float,2>{0.0914120078f, 0.188541204f},
-std::array<float,2>{0.980870664f, 0.104595974f},
-std::array<float,2>{0.203255177f, 0.715575397f},
-std::array<float,2>{0.519184947f, 0.854950011f},
-std::array<float,2>{0.295094132f, 0.328821719f},
-std::array<float,2>{0.827194691f, 0.310614198f},
-std::array<float,2>{0.0252113771f, 0.78655678f},
-std::array<float,2>{0.734506071f, 0.660481989f},
-std::array<float,2>{0.46044457f, 0.0266249347f},
-std::array<float,2>{0.608845651f, 0.16365771f},
-std::array<float,2>{0.352004677f, 0.54511553f},
-std::array<float,2>{0.919473767f, 0.978494883f},
-std::array<float,2>{0.165382504f, 0.399397373f},
-std::array<float,2>{0.587333024f, 0.384527057f},
-std::array<float,2>{0.321355343f, 0.991985619f},
-std::array<float,2>{0.902776122f, 0.551109731f},
-std::array<float,2>{0.142236799f, 0.180960819f},
-std::array<float,2>{0.871762097f, 0.00620631035f},
-std::array<float,2>{0.0406972095f, 0.680216551f},
-std::array<float,2>{0.689741731f, 0.798656464f},
-std::array<float,2>{0.47849077f, 0.285433888f},
-std::array<float,2>{0.96224457f, 0.31837818f},
-std::array<float,2>{0.224325284f, 0.874453485f},
-std::array<float,2>{0.548836529f, 0.688863277f},
-std::array<float,2>{0.266911298f, 0.11776308f},
-std::array<float,2>{0.63578403f, 0.212372333f},
-std::array<float,2>{0.408674002f, 0.576441169f},
-std::array<float,2>{0.800927877f, 0.899828017f},
-std::array<float,2>{0.105091035f, 0.452331215f},
-std::array<float,2>{0.72898072f, 0.267592341f},
-std::array<float,2>{0.439281076f, 0.764847159f},
-std::array<float,2>{0.837974131f, 0.64989537f},
-std::array<float,2>{0.00624548132f, 0.0607352182f},
-std::array<float,2>{0.922312796f, 0.128356278f},
-std::array<float,2>{0.184215367f, 0.519236445f},
-std::array<float,2>{0.610533655f, 0.960197806f},
-std::array<float,2>{0.371481061f, 0.4223952f},
-std::array<float,2>{0.766756415f, 0.497607082f},
-std::array<float,2>{0.0688005984f, 0.907604456f},
-std::array<float,2>{0.677448034f, 0.603386343f},
-std::array<float,2>{0.38712281f, 0.230355367f},
-std::array<float,2>{0.507884622f, 0.0746960491f},
-std::array<float,2>{0.297820419f, 0.731519759f},
-std::array<float,2>{0.997759759f, 0.838417232f},
-std::array<float,2>{0.189010352f, 0.352239877f}}
\ No newline at end of file
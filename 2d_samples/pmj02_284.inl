@@ -1,4096 +0,0 @@
-{std::array<float,2>{0.770892143f, 0.531764746f},
-std::array<float,2>{0.465496987f, 0.494220167f},
-std::array<float,2>{0.113714047f, 0.79154253f},
-std::array<float,2>{0.518067181f, 0.0200993009f},
-std::array<float,2>{0.684750795f, 0.890331388f},
-std::array<float,2>{0.155724034f, 0.176546052f},
-std::array<float,2>{0.314155281f, 0.730486631f},
-std::array<float,2>{0.88267225f, 0.298945189f},
-std::array<float,2>{0.983786523f, 0.821374178f},
-std::array<float,2>{0.262545526f, 0.076275818f},
-std::array<float,2>{0.216234475f, 0.598413944f},
-std::array<float,2>{0.695886016f, 0.428007096f},
-std::array<float,2>{0.563820541f, 0.638492942f},
-std::array<float,2>{0.0239797644f, 0.338263154f},
-std::array<float,2>{0.405933619f, 0.966136038f},
-std::array<float,2>{0.830492973f, 0.242628574f},
-std::array<float,2>{0.916556001f, 0.690700412f},
-std::array<float,2>{0.37072891f, 0.27401185f},
-std::array<float,2>{0.174912974f, 0.912817359f},
-std::array<float,2>{0.636558831f, 0.136605397f},
-std::array<float,2>{0.547373772f, 0.753154397f},
-std::array<float,2>{0.0777563378f, 0.0621018335f},
-std::array<float,2>{0.491325974f, 0.514481425f},
-std::array<float,2>{0.810124159f, 0.444299936f},
-std::array<float,2>{0.871368527f, 0.981700361f},
-std::array<float,2>{0.431480944f, 0.216202423f},
-std::array<float,2>{0.0330343433f, 0.685567439f},
-std::array<float,2>{0.602670848f, 0.364146888f},
-std::array<float,2>{0.736055017f, 0.574417293f},
-std::array<float,2>{0.220762029f, 0.399775565f},
-std::array<float,2>{0.281769812f, 0.855352223f},
-std::array<float,2>{0.966449857f, 0.0998921692f},
-std::array<float,2>{0.937779784f, 0.617236793f},
-std::array<float,2>{0.307870656f, 0.420005798f},
-std::array<float,2>{0.24610284f, 0.840675116f},
-std::array<float,2>{0.719857872f, 0.0929581225f},
-std::array<float,2>{0.623908222f, 0.941110671f},
-std::array<float,2>{0.0598973036f, 0.226186708f},
-std::array<float,2>{0.406599849f, 0.653554559f},
-std::array<float,2>{0.847858906f, 0.324198067f},
-std::array<float,2>{0.784507513f, 0.809320211f},
-std::array<float,2>{0.474162012f, 0.00605066027f},
-std::array<float,2>{0.0876908898f, 0.554780006f},
-std::array<float,2>{0.541431069f, 0.481661737f},
-std::array<float,2>{0.651305139f, 0.734756231f},
-std::array<float,2>{0.168308184f, 0.29186058f},
-std::array<float,2>{0.34582144f, 0.902610779f},
-std::array<float,2>{0.925767958f, 0.162767485f},
-std::array<float,2>{0.818358481f, 0.666292012f},
-std::array<float,2>{0.381101102f, 0.357959658f},
-std::array<float,2>{0.0031029433f, 0.996182203f},
-std::array<float,2>{0.581395745f, 0.194112554f},
-std::array<float,2>{0.716581345f, 0.864834964f},
-std::array<float,2>{0.191581249f, 0.118885241f},
-std::array<float,2>{0.267707855f, 0.57975316f},
-std::array<float,2>{0.990816176f, 0.384454429f},
-std::array<float,2>{0.896935701f, 0.934199631f},
-std::array<float,2>{0.338206112f, 0.143121019f},
-std::array<float,2>{0.132206544f, 0.707637012f},
-std::array<float,2>{0.656600237f, 0.257989377f},
-std::array<float,2>{0.513665974f, 0.525715768f},
-std::array<float,2>{0.0965362787f, 0.466749728f},
-std::array<float,2>{0.450970918f, 0.779451132f},
-std::array<float,2>{0.764671385f, 0.0314396396f},
-std::array<float,2>{0.857855916f, 0.586376965f},
-std::array<float,2>{0.414947003f, 0.377891123f},
-std::array<float,2>{0.0503351428f, 0.874539912f},
-std::array<float,2>{0.609849155f, 0.109704345f},
-std::array<float,2>{0.727695167f, 0.988421082f},
-std::array<float,2>{0.239440307f, 0.199957043f},
-std::array<float,2>{0.303453743f, 0.661856234f},
-std::array<float,2>{0.951392293f, 0.346666992f},
-std::array<float,2>{0.933754683f, 0.771333098f},
-std::array<float,2>{0.358798176f, 0.0461224541f},
-std::array<float,2>{0.162548661f, 0.523376048f},
-std::array<float,2>{0.647490501f, 0.458513379f},
-std::array<float,2>{0.531731248f, 0.716062725f},
-std::array<float,2>{0.0853074715f, 0.25114727f},
-std::array<float,2>{0.480466723f, 0.923121631f},
-std::array<float,2>{0.792906404f, 0.14895089f},
-std::array<float,2>{0.997591138f, 0.645000875f},
-std::array<float,2>{0.280148417f, 0.319054902f},
-std::array<float,2>{0.195790052f, 0.951672673f},
-std::array<float,2>{0.710714459f, 0.228098348f},
-std::array<float,2>{0.5936445f, 0.829677463f},
-std::array<float,2>{0.0127153657f, 0.0843924358f},
-std::array<float,2>{0.383780867f, 0.610664368f},
-std::array<float,2>{0.822223902f, 0.408719748f},
-std::array<float,2>{0.755610228f, 0.895261168f},
-std::array<float,2>{0.440867603f, 0.166201472f},
-std::array<float,2>{0.108832523f, 0.744081974f},
-std::array<float,2>{0.505998969f, 0.287892312f},
-std::array<float,2>{0.671642363f, 0.553267241f},
-std::array<float,2>{0.139621183f, 0.473748475f},
-std::array<float,2>{0.33500132f, 0.800842464f},
-std::array<float,2>{0.900389731f, 0.00977867283f},
-std::array<float,2>{0.883611381f, 0.505029619f},
-std::array<float,2>{0.320407152f, 0.449705958f},
-std::array<float,2>{0.147796258f, 0.763616264f},
-std::array<float,2>{0.679274738f, 0.0504523031f},
-std::array<float,2>{0.526908815f, 0.91471827f},
-std::array<float,2>{0.124281459f, 0.125675276f},
-std::array<float,2>{0.460363448f, 0.702885091f},
-std::array<float,2>{0.778738797f, 0.272616118f},
-std::array<float,2>{0.835941434f, 0.847868204f},
-std::array<float,2>{0.392285496f, 0.103921406f},
-std::array<float,2>{0.0194531698f, 0.564815223f},
-std::array<float,2>{0.576644063f, 0.394304067f},
-std::array<float,2>{0.689970136f, 0.678668141f},
-std::array<float,2>{0.207604468f, 0.371411353f},
-std::array<float,2>{0.251842916f, 0.974581301f},
-std::array<float,2>{0.970066369f, 0.208241865f},
-std::array<float,2>{0.804569125f, 0.724481881f},
-std::array<float,2>{0.497034341f, 0.307163805f},
-std::array<float,2>{0.0647774562f, 0.880581498f},
-std::array<float,2>{0.559546173f, 0.183549464f},
-std::array<float,2>{0.632752717f, 0.782644808f},
-std::array<float,2>{0.186753258f, 0.0259830244f},
-std::array<float,2>{0.363706619f, 0.540004075f},
-std::array<float,2>{0.906695724f, 0.490840912f},
-std::array<float,2>{0.953556538f, 0.958075643f},
-std::array<float,2>{0.293727726f, 0.236968577f},
-std::array<float,2>{0.229523286f, 0.632389009f},
-std::array<float,2>{0.745451629f, 0.331820667f},
-std::array<float,2>{0.596913576f, 0.605561972f},
-std::array<float,2>{0.0436519682f, 0.431649685f},
-std::array<float,2>{0.427327484f, 0.813490748f},
-std::array<float,2>{0.86711508f, 0.0650862753f},
-std::array<float,2>{0.835259557f, 0.518012702f},
-std::array<float,2>{0.400805593f, 0.454529643f},
-std::array<float,2>{0.0297273323f, 0.7686885f},
-std::array<float,2>{0.567004025f, 0.0428098477f},
-std::array<float,2>{0.702288449f, 0.927285969f},
-std::array<float,2>{0.21216391f, 0.15441072f},
-std::array<float,2>{0.261422604f, 0.711628437f},
-std::array<float,2>{0.980159283f, 0.255907685f},
-std::array<float,2>{0.878175318f, 0.868864f},
-std::array<float,2>{0.316513121f, 0.114383847f},
-std::array<float,2>{0.151215389f, 0.592786074f},
-std::array<float,2>{0.68119204f, 0.38238737f},
-std::array<float,2>{0.520188391f, 0.657102346f},
-std::array<float,2>{0.113252901f, 0.348663956f},
-std::array<float,2>{0.463168114f, 0.987508178f},
-std::array<float,2>{0.769177079f, 0.199210808f},
-std::array<float,2>{0.962493718f, 0.748124421f},
-std::array<float,2>{0.287377805f, 0.284018517f},
-std::array<float,2>{0.226282939f, 0.894398451f},
-std::array<float,2>{0.741525471f, 0.169018537f},
-std::array<float,2>{0.607917726f, 0.797463655f},
-std::array<float,2>{0.038809415f, 0.0128717981f},
-std::array<float,2>{0.436321646f, 0.548004627f},
-std::array<float,2>{0.867375314f, 0.470579356f},
-std::array<float,2>{0.807240844f, 0.947180152f},
-std::array<float,2>{0.485094756f, 0.231654182f},
-std::array<float,2>{0.073085174f, 0.641285241f},
-std::array<float,2>{0.551113546f, 0.3148987f},
-std::array<float,2>{0.638276339f, 0.615464449f},
-std::array<float,2>{0.178822532f, 0.411295414f},
-std::array<float,2>{0.372468352f, 0.832712889f},
-std::array<float,2>{0.920513391f, 0.0797565058f},
-std::array<float,2>{0.928115368f, 0.567269802f},
-std::array<float,2>{0.351027995f, 0.396627903f},
-std::array<float,2>{0.166304067f, 0.846061766f},
-std::array<float,2>{0.652657747f, 0.107632406f},
-std::array<float,2>{0.543210328f, 0.971717298f},
-std::array<float,2>{0.0929397568f, 0.204918116f},
-std::array<float,2>{0.469922066f, 0.672260284f},
-std::array<float,2>{0.789031565f, 0.367882639f},
-std::array<float,2>{0.845626771f, 0.760850787f},
-std::array<float,2>{0.411708802f, 0.0533042513f},
-std::array<float,2>{0.0577400625f, 0.502732754f},
-std::array<float,2>{0.617665231f, 0.445905566f},
-std::array<float,2>{0.725004435f, 0.698398232f},
-std::array<float,2>{0.243749291f, 0.265803337f},
-std::array<float,2>{0.31245929f, 0.920470119f},
-std::array<float,2>{0.945037186f, 0.129247218f},
-std::array<float,2>{0.758657932f, 0.625760794f},
-std::array<float,2>{0.448679358f, 0.334843546f},
-std::array<float,2>{0.097997196f, 0.954535544f},
-std::array<float,2>{0.510668635f, 0.24116905f},
-std::array<float,2>{0.661171615f, 0.820129752f},
-std::array<float,2>{0.127536848f, 0.0703084916f},
-std::array<float,2>{0.343345135f, 0.604737341f},
-std::array<float,2>{0.89353013f, 0.434641242f},
-std::array<float,2>{0.987559974f, 0.875095367f},
-std::array<float,2>{0.271213651f, 0.186376154f},
-std::array<float,2>{0.188177928f, 0.721600652f},
-std::array<float,2>{0.712170422f, 0.30934456f},
-std::array<float,2>{0.58227396f, 0.546466351f},
-std::array<float,2>{0.00573854614f, 0.488146216f},
-std::array<float,2>{0.375602275f, 0.787447572f},
-std::array<float,2>{0.813747704f, 0.0293861609f},
-std::array<float,2>{0.792998195f, 0.595445156f},
-std::array<float,2>{0.482339263f, 0.424071223f},
-std::array<float,2>{0.0792742744f, 0.825169742f},
-std::array<float,2>{0.536979079f, 0.0737273842f},
-std::array<float,2>{0.64249438f, 0.96375227f},
-std::array<float,2>{0.159532547f, 0.246648088f},
-std::array<float,2>{0.352039427f, 0.635466218f},
-std::array<float,2>{0.932206571f, 0.341067284f},
-std::array<float,2>{0.94587785f, 0.793029249f},
-std::array<float,2>{0.299579173f, 0.0182332303f},
-std::array<float,2>{0.235322714f, 0.537572503f},
-std::array<float,2>{0.732323825f, 0.497940183f},
-std::array<float,2>{0.616427958f, 0.727025509f},
-std::array<float,2>{0.0543428659f, 0.302340508f},
-std::array<float,2>{0.420686871f, 0.88535744f},
-std::array<float,2>{0.855061591f, 0.175431058f},
-std::array<float,2>{0.904109478f, 0.680249453f},
-std::array<float,2>{0.330795497f, 0.360183924f},
-std::array<float,2>{0.136071548f, 0.978101373f},
-std::array<float,2>{0.664682627f, 0.213981688f},
-std::array<float,2>{0.502095759f, 0.859040737f},
-std::array<float,2>{0.103218049f, 0.0947219133f},
-std::array<float,2>{0.443113089f, 0.573065877f},
-std::array<float,2>{0.752591014f, 0.403076708f},
-std::array<float,2>{0.825373888f, 0.910140455f},
-std::array<float,2>{0.389539272f, 0.138213038f},
-std::array<float,2>{0.00981199369f, 0.695183337f},
-std::array<float,2>{0.588699222f, 0.278918684f},
-std::array<float,2>{0.706006169f, 0.510481477f},
-std::array<float,2>{0.201718077f, 0.440251023f},
-std::array<float,2>{0.275444478f, 0.75420779f},
-std::array<float,2>{0.9945575f, 0.0550525039f},
-std::array<float,2>{0.973514378f, 0.558789194f},
-std::array<float,2>{0.256961375f, 0.478049725f},
-std::array<float,2>{0.204493135f, 0.805837572f},
-std::array<float,2>{0.694516778f, 0.00354313757f},
-std::array<float,2>{0.573514163f, 0.900123537f},
-std::array<float,2>{0.0227882676f, 0.159191683f},
-std::array<float,2>{0.396424294f, 0.740098178f},
-std::array<float,2>{0.840753913f, 0.29393515f},
-std::array<float,2>{0.776644111f, 0.83801496f},
-std::array<float,2>{0.453426152f, 0.0888411403f},
-std::array<float,2>{0.120809995f, 0.623575091f},
-std::array<float,2>{0.530241072f, 0.415897638f},
-std::array<float,2>{0.672808766f, 0.652095199f},
-std::array<float,2>{0.141284123f, 0.325669378f},
-std::array<float,2>{0.326781005f, 0.942946196f},
-std::array<float,2>{0.890250206f, 0.221459404f},
-std::array<float,2>{0.859587491f, 0.703526676f},
-std::array<float,2>{0.422090173f, 0.263566166f},
-std::array<float,2>{0.0408339724f, 0.93294394f},
-std::array<float,2>{0.598186255f, 0.145366222f},
-std::array<float,2>{0.747022092f, 0.775141478f},
-std::array<float,2>{0.23301588f, 0.0387154073f},
-std::array<float,2>{0.290945262f, 0.528019726f},
-std::array<float,2>{0.959582746f, 0.46148023f},
-std::array<float,2>{0.912885547f, 0.993315101f},
-std::array<float,2>{0.36273092f, 0.187998295f},
-std::array<float,2>{0.179817408f, 0.669390142f},
-std::array<float,2>{0.627255917f, 0.354182512f},
-std::array<float,2>{0.558374584f, 0.583480358f},
-std::array<float,2>{0.068122603f, 0.390034169f},
-std::array<float,2>{0.495863676f, 0.86248225f},
-std::array<float,2>{0.798376739f, 0.123709798f},
-std::array<float,2>{0.811762214f, 0.513011694f},
-std::array<float,2>{0.488454342f, 0.442934752f},
-std::array<float,2>{0.0753480494f, 0.751216054f},
-std::array<float,2>{0.549307346f, 0.058918912f},
-std::array<float,2>{0.634556592f, 0.911093771f},
-std::array<float,2>{0.172899544f, 0.134400636f},
-std::array<float,2>{0.368770689f, 0.689364374f},
-std::array<float,2>{0.915573835f, 0.27723071f},
-std::array<float,2>{0.967438996f, 0.852094173f},
-std::array<float,2>{0.284901887f, 0.099408403f},
-std::array<float,2>{0.220069036f, 0.577033937f},
-std::array<float,2>{0.736470461f, 0.400819272f},
-std::array<float,2>{0.604451597f, 0.684987485f},
-std::array<float,2>{0.0335124396f, 0.365668744f},
-std::array<float,2>{0.433152288f, 0.98382014f},
-std::array<float,2>{0.873196542f, 0.217059791f},
-std::array<float,2>{0.879627407f, 0.733531177f},
-std::array<float,2>{0.315995008f, 0.297168761f},
-std::array<float,2>{0.15306206f, 0.887967587f},
-std::array<float,2>{0.686236918f, 0.179666296f},
-std::array<float,2>{0.51719141f, 0.789071023f},
-std::array<float,2>{0.115528777f, 0.0232332852f},
-std::array<float,2>{0.467963547f, 0.533485293f},
-std::array<float,2>{0.77276808f, 0.49222061f},
-std::array<float,2>{0.829782844f, 0.96831125f},
-std::array<float,2>{0.403219968f, 0.244531035f},
-std::array<float,2>{0.0258516911f, 0.640117943f},
-std::array<float,2>{0.565170228f, 0.337129474f},
-std::array<float,2>{0.698522389f, 0.600616992f},
-std::array<float,2>{0.216852993f, 0.426167071f},
-std::array<float,2>{0.263785422f, 0.823617578f},
-std::array<float,2>{0.980621755f, 0.0749266967f},
-std::array<float,2>{0.989884615f, 0.581818104f},
-std::array<float,2>{0.266663998f, 0.385741055f},
-std::array<float,2>{0.194084361f, 0.865644395f},
-std::array<float,2>{0.717263162f, 0.119562715f},
-std::array<float,2>{0.578248024f, 0.999586284f},
-std::array<float,2>{0.00104321539f, 0.191816702f},
-std::array<float,2>{0.380134106f, 0.665585399f},
-std::array<float,2>{0.819039226f, 0.356933683f},
-std::array<float,2>{0.762379289f, 0.777467191f},
-std::array<float,2>{0.453065366f, 0.0334398858f},
-std::array<float,2>{0.0946829021f, 0.524024844f},
-std::array<float,2>{0.513886809f, 0.468690455f},
-std::array<float,2>{0.65878576f, 0.709542036f},
-std::array<float,2>{0.129130796f, 0.2610358f},
-std::array<float,2>{0.337286055f, 0.937480688f},
-std::array<float,2>{0.895781338f, 0.140981868f},
-std::array<float,2>{0.850570381f, 0.654721141f},
-std::array<float,2>{0.408943206f, 0.320956796f},
-std::array<float,2>{0.0624585934f, 0.937780678f},
-std::array<float,2>{0.622669995f, 0.222994447f},
-std::array<float,2>{0.720735788f, 0.842310369f},
-std::array<float,2>{0.24972865f, 0.0915718228f},
-std::array<float,2>{0.306000024f, 0.62044847f},
-std::array<float,2>{0.940394282f, 0.418428212f},
-std::array<float,2>{0.923126698f, 0.905346036f},
-std::array<float,2>{0.343815535f, 0.161309481f},
-std::array<float,2>{0.169970468f, 0.736928165f},
-std::array<float,2>{0.650357902f, 0.29096818f},
-std::array<float,2>{0.540988982f, 0.557919502f},
-std::array<float,2>{0.089831911f, 0.483465642f},
-std::array<float,2>{0.475873202f, 0.811131537f},
-std::array<float,2>{0.782684803f, 0.00504009845f},
-std::array<float,2>{0.822908223f, 0.612694442f},
-std::array<float,2>{0.385566443f, 0.406756699f},
-std::array<float,2>{0.015129827f, 0.830930173f},
-std::array<float,2>{0.589880884f, 0.0831067637f},
-std::array<float,2>{0.707919002f, 0.949432671f},
-std::array<float,2>{0.197522685f, 0.229647428f},
-std::array<float,2>{0.278523207f, 0.647805691f},
-std::array<float,2>{0.998997867f, 0.316782922f},
-std::array<float,2>{0.902104676f, 0.803412259f},
-std::array<float,2>{0.332313448f, 0.00907848403f},
-std::array<float,2>{0.13834843f, 0.551831305f},
-std::array<float,2>{0.66878432f, 0.474717468f},
-std::array<float,2>{0.505152702f, 0.745151758f},
-std::array<float,2>{0.106681608f, 0.286938727f},
-std::array<float,2>{0.438212246f, 0.897020578f},
-std::array<float,2>{0.75607717f, 0.164801732f},
-std::array<float,2>{0.950483561f, 0.663257182f},
-std::array<float,2>{0.301930726f, 0.345377624f},
-std::array<float,2>{0.240725428f, 0.990235686f},
-std::array<float,2>{0.72914058f, 0.201451525f},
-std::array<float,2>{0.612140059f, 0.873019814f},
-std::array<float,2>{0.0468874946f, 0.111736499f},
-std::array<float,2>{0.416445613f, 0.588300347f},
-std::array<float,2>{0.857328534f, 0.376559854f},
-std::array<float,2>{0.789215922f, 0.924499035f},
-std::array<float,2>{0.477417111f, 0.151179761f},
-std::array<float,2>{0.0835306048f, 0.716924369f},
-std::array<float,2>{0.533724666f, 0.252103448f},
-std::array<float,2>{0.646352708f, 0.519868493f},
-std::array<float,2>{0.162005126f, 0.46037823f},
-std::array<float,2>{0.357394069f, 0.773308039f},
-std::array<float,2>{0.937227547f, 0.0440894216f},
-std::array<float,2>{0.909475923f, 0.542921185f},
-std::array<float,2>{0.365456671f, 0.489556313f},
-std::array<float,2>{0.185422301f, 0.784125805f},
-std::array<float,2>{0.630543709f, 0.024534842f},
-std::array<float,2>{0.560967982f, 0.882732928f},
-std::array<float,2>{0.0637420192f, 0.180050924f},
-std::array<float,2>{0.499303102f, 0.725882828f},
-std::array<float,2>{0.801924169f, 0.306319624f},
-std::array<float,2>{0.865222573f, 0.81499207f},
-std::array<float,2>{0.428863615f, 0.0627937168f},
-std::array<float,2>{0.0453241765f, 0.608315706f},
-std::array<float,2>{0.594424188f, 0.431595892f},
-std::array<float,2>{0.74309665f, 0.630002022f},
-std::array<float,2>{0.227468699f, 0.328848481f},
-std::array<float,2>{0.296694815f, 0.959441602f},
-std::array<float,2>{0.955487072f, 0.2351733f},
-std::array<float,2>{0.781199515f, 0.700388074f},
-std::array<float,2>{0.458947808f, 0.269743145f},
-std::array<float,2>{0.12129797f, 0.916515589f},
-std::array<float,2>{0.523601115f, 0.127588868f},
-std::array<float,2>{0.677340209f, 0.765045881f},
-std::array<float,2>{0.145946562f, 0.0483894497f},
-std::array<float,2>{0.32370612f, 0.506045759f},
-std::array<float,2>{0.886256039f, 0.452403873f},
-std::array<float,2>{0.971403837f, 0.976520658f},
-std::array<float,2>{0.253280491f, 0.209797546f},
-std::array<float,2>{0.210840508f, 0.677371204f},
-std::array<float,2>{0.68926686f, 0.374462873f},
-std::array<float,2>{0.574776649f, 0.563956022f},
-std::array<float,2>{0.0174758136f, 0.391076326f},
-std::array<float,2>{0.393504649f, 0.850682437f},
-std::array<float,2>{0.838787496f, 0.103053004f},
-std::array<float,2>{0.870424867f, 0.549119353f},
-std::array<float,2>{0.435070604f, 0.470762372f},
-std::array<float,2>{0.0357206576f, 0.799119234f},
-std::array<float,2>{0.60626471f, 0.0153974509f},
-std::array<float,2>{0.740148902f, 0.892309129f},
-std::array<float,2>{0.223262966f, 0.170438051f},
-std::array<float,2>{0.285804003f, 0.747212052f},
-std::array<float,2>{0.963334203f, 0.281785339f},
-std::array<float,2>{0.919109225f, 0.834131896f},
-std::array<float,2>{0.374651819f, 0.0813851506f},
-std::array<float,2>{0.176018894f, 0.613393247f},
-std::array<float,2>{0.640285373f, 0.412502289f},
-std::array<float,2>{0.55403167f, 0.64263612f},
-std::array<float,2>{0.0721586496f, 0.313441664f},
-std::array<float,2>{0.486911595f, 0.949055672f},
-std::array<float,2>{0.805216074f, 0.233470276f},
-std::array<float,2>{0.977599502f, 0.71296823f},
-std::array<float,2>{0.259730041f, 0.255498528f},
-std::array<float,2>{0.214177996f, 0.929498851f},
-std::array<float,2>{0.701076984f, 0.152422771f},
-std::array<float,2>{0.568938375f, 0.766948819f},
-std::array<float,2>{0.0276087616f, 0.0408357792f},
-std::array<float,2>{0.398949295f, 0.516565323f},
-std::array<float,2>{0.833061397f, 0.455218226f},
-std::array<float,2>{0.766074479f, 0.985726297f},
-std::array<float,2>{0.461119175f, 0.195729449f},
-std::array<float,2>{0.110775195f, 0.659343481f},
-std::array<float,2>{0.523029804f, 0.350235432f},
-std::array<float,2>{0.682557344f, 0.590879619f},
-std::array<float,2>{0.150170088f, 0.379426628f},
-std::array<float,2>{0.318932801f, 0.869921386f},
-std::array<float,2>{0.875794888f, 0.116628714f},
-std::array<float,2>{0.89187932f, 0.603342116f},
-std::array<float,2>{0.340868145f, 0.435547352f},
-std::array<float,2>{0.126211792f, 0.817610204f},
-std::array<float,2>{0.663035214f, 0.066569142f},
-std::array<float,2>{0.508416176f, 0.956647754f},
-std::array<float,2>{0.0998454541f, 0.239903167f},
-std::array<float,2>{0.446462482f, 0.627809286f},
-std::array<float,2>{0.760153174f, 0.333636463f},
-std::array<float,2>{0.816288769f, 0.785510957f},
-std::array<float,2>{0.377317131f, 0.0280275345f},
-std::array<float,2>{0.00751106627f, 0.543376267f},
-std::array<float,2>{0.585357785f, 0.484912425f},
-std::array<float,2>{0.714131594f, 0.718979418f},
-std::array<float,2>{0.191134244f, 0.310791105f},
-std::array<float,2>{0.271561921f, 0.878417432f},
-std::array<float,2>{0.985642016f, 0.184916422f},
-std::array<float,2>{0.786386609f, 0.674454391f},
-std::array<float,2>{0.472165555f, 0.370331317f},
-std::array<float,2>{0.0911444202f, 0.969032824f},
-std::array<float,2>{0.545356393f, 0.20644024f},
-std::array<float,2>{0.655130386f, 0.844733536f},
-std::array<float,2>{0.164947122f, 0.107193984f},
-std::array<float,2>{0.348720461f, 0.570283473f},
-std::array<float,2>{0.926653862f, 0.396142244f},
-std::array<float,2>{0.941506863f, 0.918742537f},
-std::array<float,2>{0.309336603f, 0.132479057f},
-std::array<float,2>{0.244505063f, 0.696139157f},
-std::array<float,2>{0.724421442f, 0.269244254f},
-std::array<float,2>{0.620229065f, 0.500598729f},
-std::array<float,2>{0.0550505035f, 0.449217439f},
-std::array<float,2>{0.41344136f, 0.758627236f},
-std::array<float,2>{0.846926153f, 0.0517039821f},
-std::array<float,2>{0.750232041f, 0.570923746f},
-std::array<float,2>{0.444556624f, 0.405756354f},
-std::array<float,2>{0.105065614f, 0.857200265f},
-std::array<float,2>{0.501670897f, 0.0973068178f},
-std::array<float,2>{0.667598903f, 0.979827583f},
-std::array<float,2>{0.134283885f, 0.212690622f},
-std::array<float,2>{0.330071002f, 0.681887925f},
-std::array<float,2>{0.904451013f, 0.361619264f},
-std::array<float,2>{0.992888331f, 0.757360101f},
-std::array<float,2>{0.273520261f, 0.0571431294f},
-std::array<float,2>{0.199463621f, 0.507871389f},
-std::array<float,2>{0.70463115f, 0.439416707f},
-std::array<float,2>{0.587173581f, 0.692030013f},
-std::array<float,2>{0.00810798071f, 0.279760361f},
-std::array<float,2>{0.387848496f, 0.906881273f},
-std::array<float,2>{0.826751947f, 0.139127567f},
-std::array<float,2>{0.930382371f, 0.633601665f},
-std::array<float,2>{0.35456413f, 0.34250322f},
-std::array<float,2>{0.157679766f, 0.962545574f},
-std::array<float,2>{0.642822087f, 0.249193788f},
-std::array<float,2>{0.537588716f, 0.827044964f},
-std::array<float,2>{0.0809989423f, 0.071764648f},
-std::array<float,2>{0.482952565f, 0.597069919f},
-std::array<float,2>{0.796806276f, 0.422796667f},
-std::array<float,2>{0.851655006f, 0.884198725f},
-std::array<float,2>{0.418896496f, 0.173407152f},
-std::array<float,2>{0.051498495f, 0.730246067f},
-std::array<float,2>{0.614714622f, 0.303715259f},
-std::array<float,2>{0.732803643f, 0.536792815f},
-std::array<float,2>{0.237510249f, 0.498466671f},
-std::array<float,2>{0.29830429f, 0.796046019f},
-std::array<float,2>{0.948559046f, 0.0166841466f},
-std::array<float,2>{0.957789063f, 0.530138314f},
-std::array<float,2>{0.291650325f, 0.464780211f},
-std::array<float,2>{0.231768698f, 0.776022792f},
-std::array<float,2>{0.749946773f, 0.0361641422f},
-std::array<float,2>{0.601074994f, 0.931103945f},
-std::array<float,2>{0.0410339497f, 0.148024783f},
-std::array<float,2>{0.424105436f, 0.705699921f},
-std::array<float,2>{0.861660421f, 0.265433341f},
-std::array<float,2>{0.800060153f, 0.859715402f},
-std::array<float,2>{0.492275953f, 0.122087352f},
-std::array<float,2>{0.0684930012f, 0.584192276f},
-std::array<float,2>{0.555020571f, 0.38823998f},
-std::array<float,2>{0.626945555f, 0.671221495f},
-std::array<float,2>{0.183160841f, 0.352402121f},
-std::array<float,2>{0.360403836f, 0.995931745f},
-std::array<float,2>{0.911458433f, 0.190886393f},
-std::array<float,2>{0.842425942f, 0.74149847f},
-std::array<float,2>{0.398426205f, 0.294955909f},
-std::array<float,2>{0.0202861074f, 0.900565028f},
-std::array<float,2>{0.571969569f, 0.156746909f},
-std::array<float,2>{0.692022979f, 0.807956278f},
-std::array<float,2>{0.206872955f, 0.000801076356f},
-std::array<float,2>{0.2550219f, 0.560650945f},
-std::array<float,2>{0.975718975f, 0.48035726f},
-std::array<float,2>{0.887226999f, 0.944687307f},
-std::array<float,2>{0.325806022f, 0.2191329f},
-std::array<float,2>{0.143788174f, 0.650326014f},
-std::array<float,2>{0.673887968f, 0.328046024f},
-std::array<float,2>{0.527584314f, 0.621940076f},
-std::array<float,2>{0.118076928f, 0.417128116f},
-std::array<float,2>{0.456715137f, 0.837136149f},
-std::array<float,2>{0.773759067f, 0.0863636434f},
-std::array<float,2>{0.764396191f, 0.525297105f},
-std::array<float,2>{0.449988604f, 0.467636317f},
-std::array<float,2>{0.0969201699f, 0.778808892f},
-std::array<float,2>{0.512571692f, 0.0347510837f},
-std::array<float,2>{0.657737672f, 0.935605705f},
-std::array<float,2>{0.131092265f, 0.142277762f},
-std::array<float,2>{0.339309216f, 0.710478842f},
-std::array<float,2>{0.897995591f, 0.260602772f},
-std::array<float,2>{0.991842151f, 0.866538584f},
-std::array<float,2>{0.269498348f, 0.12064378f},
-std::array<float,2>{0.192678273f, 0.580951631f},
-std::array<float,2>{0.715522945f, 0.385874301f},
-std::array<float,2>{0.580250084f, 0.664929748f},
-std::array<float,2>{0.00227208296f, 0.35573718f},
-std::array<float,2>{0.382032573f, 0.99868685f},
-std::array<float,2>{0.816481411f, 0.192841217f},
-std::array<float,2>{0.924586296f, 0.737563431f},
-std::array<float,2>{0.347515464f, 0.289109677f},
-std::array<float,2>{0.169227913f, 0.904813826f},
-std::array<float,2>{0.651782215f, 0.160568655f},
-std::array<float,2>{0.542342603f, 0.812445402f},
-std::array<float,2>{0.0866371319f, 0.00392169505f},
-std::array<float,2>{0.473536581f, 0.55716306f},
-std::array<float,2>{0.783529043f, 0.482474357f},
-std::array<float,2>{0.849033237f, 0.939384103f},
-std::array<float,2>{0.407428652f, 0.224035054f},
-std::array<float,2>{0.0593522936f, 0.655539453f},
-std::array<float,2>{0.624602973f, 0.322050214f},
-std::array<float,2>{0.719050527f, 0.61984992f},
-std::array<float,2>{0.247199178f, 0.419908166f},
-std::array<float,2>{0.306895882f, 0.843277335f},
-std::array<float,2>{0.939242661f, 0.0901573822f},
-std::array<float,2>{0.964912415f, 0.57762742f},
-std::array<float,2>{0.282979906f, 0.401646346f},
-std::array<float,2>{0.222536042f, 0.85273695f},
-std::array<float,2>{0.734493732f, 0.0979016721f},
-std::array<float,2>{0.602184057f, 0.982527018f},
-std::array<float,2>{0.0314796045f, 0.217803746f},
-std::array<float,2>{0.429871559f, 0.68419373f},
-std::array<float,2>{0.872981131f, 0.366648227f},
-std::array<float,2>{0.808827519f, 0.750028193f},
-std::array<float,2>{0.491188407f, 0.0603750087f},
-std::array<float,2>{0.0766297281f, 0.512341857f},
-std::array<float,2>{0.548384428f, 0.442081094f},
-std::array<float,2>{0.635734916f, 0.687791646f},
-std::array<float,2>{0.174366862f, 0.275635511f},
-std::array<float,2>{0.369462967f, 0.911695302f},
-std::array<float,2>{0.917414963f, 0.132831663f},
-std::array<float,2>{0.831370115f, 0.639543653f},
-std::array<float,2>{0.405091375f, 0.336672127f},
-std::array<float,2>{0.0250803977f, 0.966992974f},
-std::array<float,2>{0.563036203f, 0.245343566f},
-std::array<float,2>{0.696363926f, 0.822785497f},
-std::array<float,2>{0.214914516f, 0.0761309713f},
-std::array<float,2>{0.26325649f, 0.600417852f},
-std::array<float,2>{0.983302176f, 0.427316964f},
-std::array<float,2>{0.881470025f, 0.887092292f},
-std::array<float,2>{0.312769562f, 0.178037941f},
-std::array<float,2>{0.154474005f, 0.733015537f},
-std::array<float,2>{0.683631539f, 0.298270345f},
-std::array<float,2>{0.518936634f, 0.534529984f},
-std::array<float,2>{0.114260241f, 0.493674338f},
-std::array<float,2>{0.465964705f, 0.790974259f},
-std::array<float,2>{0.770139098f, 0.0221348219f},
-std::array<float,2>{0.865801752f, 0.609196901f},
-std::array<float,2>{0.425851673f, 0.42987296f},
-std::array<float,2>{0.0442485996f, 0.815903187f},
-std::array<float,2>{0.595770419f, 0.0642841905f},
-std::array<float,2>{0.744785368f, 0.960297167f},
-std::array<float,2>{0.228559956f, 0.235989243f},
-std::array<float,2>{0.294708461f, 0.629416823f},
-std::array<float,2>{0.954534352f, 0.329163432f},
-std::array<float,2>{0.907437742f, 0.784379959f},
-std::array<float,2>{0.364998907f, 0.0241633765f},
-std::array<float,2>{0.186470628f, 0.541745722f},
-std::array<float,2>{0.63104862f, 0.488686889f},
-std::array<float,2>{0.560197413f, 0.724964559f},
-std::array<float,2>{0.0659274831f, 0.304875702f},
-std::array<float,2>{0.497567594f, 0.881698549f},
-std::array<float,2>{0.802998066f, 0.181611463f},
-std::array<float,2>{0.969600439f, 0.676663876f},
-std::array<float,2>{0.250606567f, 0.373802572f},
-std::array<float,2>{0.208145306f, 0.975355685f},
-std::array<float,2>{0.690466464f, 0.21001333f},
-std::array<float,2>{0.577248693f, 0.849908412f},
-std::array<float,2>{0.0182547551f, 0.102480836f},
-std::array<float,2>{0.391056895f, 0.562568545f},
-std::array<float,2>{0.837321579f, 0.39180401f},
-std::array<float,2>{0.777557909f, 0.917111456f},
-std::array<float,2>{0.459462911f, 0.128536612f},
-std::array<float,2>{0.123845451f, 0.700119972f},
-std::array<float,2>{0.525680184f, 0.270885289f},
-std::array<float,2>{0.678266883f, 0.507111371f},
-std::array<float,2>{0.146521494f, 0.451906294f},
-std::array<float,2>{0.321356714f, 0.764589787f},
-std::array<float,2>{0.884325564f, 0.0477727354f},
-std::array<float,2>{0.898441732f, 0.550946712f},
-std::array<float,2>{0.334476084f, 0.476176292f},
-std::array<float,2>{0.13993305f, 0.80460453f},
-std::array<float,2>{0.67048645f, 0.00840344466f},
-std::array<float,2>{0.50735122f, 0.897636592f},
-std::array<float,2>{0.108128205f, 0.165452868f},
-std::array<float,2>{0.440032423f, 0.744427621f},
-std::array<float,2>{0.75475204f, 0.285992891f},
-std::array<float,2>{0.82101649f, 0.831501007f},
-std::array<float,2>{0.384261727f, 0.0820391402f},
-std::array<float,2>{0.0119000599f, 0.611939907f},
-std::array<float,2>{0.592279494f, 0.40726912f},
-std::array<float,2>{0.709339499f, 0.646872938f},
-std::array<float,2>{0.19673261f, 0.317686379f},
-std::array<float,2>{0.280905485f, 0.950386822f},
-std::array<float,2>{0.996789813f, 0.228858128f},
-std::array<float,2>{0.791376531f, 0.718656003f},
-std::array<float,2>{0.478897661f, 0.253351748f},
-std::array<float,2>{0.0847833902f, 0.925070584f},
-std::array<float,2>{0.533152342f, 0.151433557f},
-std::array<float,2>{0.647034943f, 0.771540403f},
-std::array<float,2>{0.163514465f, 0.0438662805f},
-std::array<float,2>{0.357868969f, 0.520935297f},
-std::array<float,2>{0.935541809f, 0.45972383f},
-std::array<float,2>{0.95251894f, 0.99216938f},
-std::array<float,2>{0.303826958f, 0.202249199f},
-std::array<float,2>{0.238795504f, 0.662868917f},
-std::array<float,2>{0.726959467f, 0.344239712f},
-std::array<float,2>{0.611110747f, 0.589288652f},
-std::array<float,2>{0.0491909869f, 0.375766188f},
-std::array<float,2>{0.415689617f, 0.871837318f},
-std::array<float,2>{0.858692527f, 0.112980947f},
-std::array<float,2>{0.813006639f, 0.544272125f},
-std::array<float,2>{0.376862466f, 0.485411376f},
-std::array<float,2>{0.00408137543f, 0.786819696f},
-std::array<float,2>{0.583676517f, 0.0289535001f},
-std::array<float,2>{0.711590528f, 0.877393484f},
-std::array<float,2>{0.189313352f, 0.184255913f},
-std::array<float,2>{0.270013779f, 0.720100462f},
-std::array<float,2>{0.986343086f, 0.312352091f},
-std::array<float,2>{0.893973351f, 0.817207634f},
-std::array<float,2>{0.342283845f, 0.0677016601f},
-std::array<float,2>{0.128883183f, 0.601837814f},
-std::array<float,2>{0.660864711f, 0.436709166f},
-std::array<float,2>{0.511552334f, 0.62847501f},
-std::array<float,2>{0.0991559401f, 0.332172573f},
-std::array<float,2>{0.447686166f, 0.95509845f},
-std::array<float,2>{0.758914948f, 0.238988012f},
-std::array<float,2>{0.943537533f, 0.696785152f},
-std::array<float,2>{0.311522871f, 0.267978549f},
-std::array<float,2>{0.242739618f, 0.918951809f},
-std::array<float,2>{0.726360679f, 0.131427854f},
-std::array<float,2>{0.618498921f, 0.758965135f},
-std::array<float,2>{0.0568598062f, 0.0521229431f},
-std::array<float,2>{0.410227507f, 0.501484275f},
-std::array<float,2>{0.844388425f, 0.447735399f},
-std::array<float,2>{0.787278712f, 0.970146894f},
-std::array<float,2>{0.469701439f, 0.205123454f},
-std::array<float,2>{0.0920966491f, 0.675001264f},
-std::array<float,2>{0.544684827f, 0.369872928f},
-std::array<float,2>{0.65424484f, 0.569091856f},
-std::array<float,2>{0.167262539f, 0.395066142f},
-std::array<float,2>{0.349866182f, 0.844514251f},
-std::array<float,2>{0.929244101f, 0.105697446f},
-std::array<float,2>{0.921453774f, 0.614728928f},
-std::array<float,2>{0.371908486f, 0.413900137f},
-std::array<float,2>{0.177745491f, 0.835153699f},
-std::array<float,2>{0.637496352f, 0.0802035853f},
-std::array<float,2>{0.551945269f, 0.947984993f},
-std::array<float,2>{0.0738435462f, 0.232820541f},
-std::array<float,2>{0.486163497f, 0.64447242f},
-std::array<float,2>{0.808135688f, 0.314083308f},
-std::array<float,2>{0.868438601f, 0.800215483f},
-std::array<float,2>{0.437220603f, 0.0141499555f},
-std::array<float,2>{0.0374639705f, 0.550732315f},
-std::array<float,2>{0.608940065f, 0.471772671f},
-std::array<float,2>{0.740818918f, 0.746269822f},
-std::array<float,2>{0.224866524f, 0.282364041f},
-std::array<float,2>{0.28855145f, 0.891189098f},
-std::array<float,2>{0.961222053f, 0.171446994f},
-std::array<float,2>{0.76784873f, 0.658842623f},
-std::array<float,2>{0.464570671f, 0.351275891f},
-std::array<float,2>{0.112041093f, 0.985316873f},
-std::array<float,2>{0.521121144f, 0.19641608f},
-std::array<float,2>{0.680270433f, 0.870189846f},
-std::array<float,2>{0.152044326f, 0.116079085f},
-std::array<float,2>{0.318029135f, 0.590442359f},
-std::array<float,2>{0.877110243f, 0.380510122f},
-std::array<float,2>{0.97870636f, 0.928522706f},
-std::array<float,2>{0.260588467f, 0.153614506f},
-std::array<float,2>{0.211299837f, 0.714717329f},
-std::array<float,2>{0.701624036f, 0.25409776f},
-std::array<float,2>{0.567558289f, 0.516608894f},
-std::array<float,2>{0.0310985893f, 0.456598103f},
-std::array<float,2>{0.401778579f, 0.765959322f},
-std::array<float,2>{0.834325194f, 0.039616093f},
-std::array<float,2>{0.796961248f, 0.585498571f},
-std::array<float,2>{0.494234413f, 0.386961699f},
-std::array<float,2>{0.0670309216f, 0.861094177f},
-std::array<float,2>{0.5570485f, 0.122041315f},
-std::array<float,2>{0.628238976f, 0.994712174f},
-std::array<float,2>{0.181285903f, 0.19010812f},
-std::array<float,2>{0.362121582f, 0.670011103f},
-std::array<float,2>{0.913917363f, 0.352725804f},
-std::array<float,2>{0.960803449f, 0.777248979f},
-std::array<float,2>{0.289890409f, 0.0359064303f},
-std::array<float,2>{0.23345907f, 0.530804992f},
-std::array<float,2>{0.74801904f, 0.463632107f},
-std::array<float,2>{0.598687828f, 0.706633985f},
-std::array<float,2>{0.039206516f, 0.26403144f},
-std::array<float,2>{0.423586488f, 0.930239499f},
-std::array<float,2>{0.860820055f, 0.146588817f},
-std::array<float,2>{0.888676882f, 0.648994684f},
-std::array<float,2>{0.32717818f, 0.326590657f},
-std::array<float,2>{0.141740531f, 0.943995595f},
-std::array<float,2>{0.673181832f, 0.220567867f},
-std::array<float,2>{0.530663967f, 0.836167872f},
-std::array<float,2>{0.119601242f, 0.0875458717f},
-std::array<float,2>{0.454242975f, 0.622522831f},
-std::array<float,2>{0.776152432f, 0.416485339f},
-std::array<float,2>{0.841783762f, 0.901463628f},
-std::array<float,2>{0.395241171f, 0.157909393f},
-std::array<float,2>{0.0222462919f, 0.740945339f},
-std::array<float,2>{0.572294772f, 0.296104342f},
-std::array<float,2>{0.693918586f, 0.561668098f},
-std::array<float,2>{0.203759089f, 0.479168475f},
-std::array<float,2>{0.256018013f, 0.80670017f},
-std::array<float,2>{0.97397387f, 0.00179812172f},
-std::array<float,2>{0.995919228f, 0.509252131f},
-std::array<float,2>{0.277168274f, 0.437893271f},
-std::array<float,2>{0.203047037f, 0.75641042f},
-std::array<float,2>{0.706109583f, 0.058030013f},
-std::array<float,2>{0.589505017f, 0.907637656f},
-std::array<float,2>{0.0116633298f, 0.140564591f},
-std::array<float,2>{0.390521646f, 0.692827761f},
-std::array<float,2>{0.824828386f, 0.280412495f},
-std::array<float,2>{0.753899753f, 0.856186748f},
-std::array<float,2>{0.442217976f, 0.0963748172f},
-std::array<float,2>{0.102052227f, 0.571927607f},
-std::array<float,2>{0.50315851f, 0.404409766f},
-std::array<float,2>{0.66550076f, 0.682669222f},
-std::array<float,2>{0.134823725f, 0.362960845f},
-std::array<float,2>{0.331236094f, 0.979458749f},
-std::array<float,2>{0.903174996f, 0.211790875f},
-std::array<float,2>{0.853672147f, 0.728770614f},
-std::array<float,2>{0.421552807f, 0.303462088f},
-std::array<float,2>{0.0527980886f, 0.88342011f},
-std::array<float,2>{0.615355253f, 0.171968088f},
-std::array<float,2>{0.731070697f, 0.795040786f},
-std::array<float,2>{0.235669062f, 0.0164802503f},
-std::array<float,2>{0.300639451f, 0.53579706f},
-std::array<float,2>{0.946308076f, 0.499223888f},
-std::array<float,2>{0.933307469f, 0.961907983f},
-std::array<float,2>{0.353161931f, 0.248247445f},
-std::array<float,2>{0.158716038f, 0.634502649f},
-std::array<float,2>{0.640765965f, 0.343490601f},
-std::array<float,2>{0.535188675f, 0.596081018f},
-std::array<float,2>{0.078460075f, 0.42317003f},
-std::array<float,2>{0.481407106f, 0.827548742f},
-std::array<float,2>{0.794243813f, 0.0709208995f},
-std::array<float,2>{0.78199333f, 0.556358159f},
-std::array<float,2>{0.474887282f, 0.481275111f},
-std::array<float,2>{0.088298291f, 0.810053229f},
-std::array<float,2>{0.539343297f, 0.00684219413f},
-std::array<float,2>{0.649315894f, 0.903945863f},
-std::array<float,2>{0.171608761f, 0.163706943f},
-std::array<float,2>{0.345177799f, 0.736231923f},
-std::array<float,2>{0.922071338f, 0.292883158f},
-std::array<float,2>{0.941095293f, 0.84145236f},
-std::array<float,2>{0.305358112f, 0.0924372301f},
-std::array<float,2>{0.248511791f, 0.618872046f},
-std::array<float,2>{0.722338438f, 0.421771616f},
-std::array<float,2>{0.621678054f, 0.653180301f},
-std::array<float,2>{0.0607457943f, 0.323011458f},
-std::array<float,2>{0.409844875f, 0.94039762f},
-std::array<float,2>{0.850962162f, 0.22483021f},
-std::array<float,2>{0.895256162f, 0.708127499f},
-std::array<float,2>{0.336493701f, 0.259522647f},
-std::array<float,2>{0.130683914f, 0.935417116f},
-std::array<float,2>{0.66014123f, 0.143727139f},
-std::array<float,2>{0.51546067f, 0.780523062f},
-std::array<float,2>{0.0950999483f, 0.0324584879f},
-std::array<float,2>{0.451700151f, 0.526615918f},
-std::array<float,2>{0.763356864f, 0.465316474f},
-std::array<float,2>{0.819437921f, 0.997984171f},
-std::array<float,2>{0.379866034f, 0.194780022f},
-std::array<float,2>{0.000773112406f, 0.667272151f},
-std::array<float,2>{0.579657316f, 0.358984858f},
-std::array<float,2>{0.718324482f, 0.578422248f},
-std::array<float,2>{0.194411799f, 0.383232474f},
-std::array<float,2>{0.266189158f, 0.86361438f},
-std::array<float,2>{0.988466144f, 0.118136741f},
-std::array<float,2>{0.982211947f, 0.59883076f},
-std::array<float,2>{0.264918208f, 0.428730369f},
-std::array<float,2>{0.218144625f, 0.820641458f},
-std::array<float,2>{0.69810015f, 0.077319786f},
-std::array<float,2>{0.566272736f, 0.965260327f},
-std::array<float,2>{0.0271679852f, 0.244018465f},
-std::array<float,2>{0.404166222f, 0.636896312f},
-std::array<float,2>{0.828517973f, 0.339770347f},
-std::array<float,2>{0.772349536f, 0.792524338f},
-std::array<float,2>{0.467037678f, 0.0211222488f},
-std::array<float,2>{0.11696253f, 0.532792747f},
-std::array<float,2>{0.516591132f, 0.495715886f},
-std::array<float,2>{0.687411129f, 0.732217431f},
-std::array<float,2>{0.154219642f, 0.300330788f},
-std::array<float,2>{0.314723939f, 0.888845623f},
-std::array<float,2>{0.880678415f, 0.177717045f},
-std::array<float,2>{0.87445122f, 0.686555147f},
-std::array<float,2>{0.431934088f, 0.364512175f},
-std::array<float,2>{0.0345158987f, 0.981410146f},
-std::array<float,2>{0.605249345f, 0.215383962f},
-std::array<float,2>{0.73807168f, 0.854216635f},
-std::array<float,2>{0.219244316f, 0.10151495f},
-std::array<float,2>{0.283447593f, 0.575938344f},
-std::array<float,2>{0.968519688f, 0.398627758f},
-std::array<float,2>{0.914359748f, 0.91394037f},
-std::array<float,2>{0.368016243f, 0.135301128f},
-std::array<float,2>{0.172069818f, 0.68961221f},
-std::array<float,2>{0.633368313f, 0.274943084f},
-std::array<float,2>{0.549948514f, 0.515332758f},
-std::array<float,2>{0.074367553f, 0.444994718f},
-std::array<float,2>{0.489942044f, 0.752439499f},
-std::array<float,2>{0.811242223f, 0.061233677f},
-std::array<float,2>{0.839752018f, 0.566257298f},
-std::array<float,2>{0.393954039f, 0.392593145f},
-std::array<float,2>{0.0161738917f, 0.849339426f},
-std::array<float,2>{0.575791538f, 0.105026275f},
-std::array<float,2>{0.688393831f, 0.972998619f},
-std::array<float,2>{0.209796771f, 0.20708324f},
-std::array<float,2>{0.252794176f, 0.679106593f},
-std::array<float,2>{0.971806645f, 0.372496992f},
-std::array<float,2>{0.885207355f, 0.762593508f},
-std::array<float,2>{0.322796553f, 0.0490397587f},
-std::array<float,2>{0.145460367f, 0.504021704f},
-std::array<float,2>{0.676212013f, 0.450264215f},
-std::array<float,2>{0.52462548f, 0.701458395f},
-std::array<float,2>{0.122741327f, 0.271811515f},
-std::array<float,2>{0.457596451f, 0.915859699f},
-std::array<float,2>{0.779855788f, 0.126872838f},
-std::array<float,2>{0.95634383f, 0.631021082f},
-std::array<float,2>{0.295520335f, 0.33059448f},
-std::array<float,2>{0.227603599f, 0.957427919f},
-std::array<float,2>{0.74408859f, 0.238132283f},
-std::array<float,2>{0.594962776f, 0.813385487f},
-std::array<float,2>{0.0464317165f, 0.0656818524f},
-std::array<float,2>{0.42808339f, 0.607324302f},
-std::array<float,2>{0.863847315f, 0.432719678f},
-std::array<float,2>{0.801000893f, 0.879583001f},
-std::array<float,2>{0.498870552f, 0.182580352f},
-std::array<float,2>{0.062662445f, 0.723536313f},
-std::array<float,2>{0.562112868f, 0.307894558f},
-std::array<float,2>{0.629037976f, 0.540465355f},
-std::array<float,2>{0.184291825f, 0.491259784f},
-std::array<float,2>{0.367103219f, 0.78183949f},
-std::array<float,2>{0.908614993f, 0.02639395f},
-std::array<float,2>{0.936151445f, 0.521782458f},
-std::array<float,2>{0.356051683f, 0.457930088f},
-std::array<float,2>{0.160711229f, 0.769573867f},
-std::array<float,2>{0.644930422f, 0.0457942076f},
-std::array<float,2>{0.534680188f, 0.922556341f},
-std::array<float,2>{0.082798712f, 0.149843916f},
-std::array<float,2>{0.477721304f, 0.715067863f},
-std::array<float,2>{0.790491641f, 0.250220627f},
-std::array<float,2>{0.855709255f, 0.873828471f},
-std::array<float,2>{0.417124659f, 0.110546738f},
-std::array<float,2>{0.0488050133f, 0.587547183f},
-std::array<float,2>{0.61249876f, 0.378510624f},
-std::array<float,2>{0.730275512f, 0.660808861f},
-std::array<float,2>{0.242031783f, 0.346976995f},
-std::array<float,2>{0.3014853f, 0.990154803f},
-std::array<float,2>{0.949429631f, 0.201135442f},
-std::array<float,2>{0.757511795f, 0.742688537f},
-std::array<float,2>{0.438560277f, 0.288760066f},
-std::array<float,2>{0.10634397f, 0.896259248f},
-std::array<float,2>{0.503982008f, 0.167495087f},
-std::array<float,2>{0.669079125f, 0.80229789f},
-std::array<float,2>{0.136799067f, 0.0109645044f},
-std::array<float,2>{0.333933711f, 0.554281116f},
-std::array<float,2>{0.900430083f, 0.473087788f},
-std::array<float,2>{0.999594927f, 0.952360511f},
-std::array<float,2>{0.277858287f, 0.227424577f},
-std::array<float,2>{0.19834438f, 0.646461368f},
-std::array<float,2>{0.708919525f, 0.319528162f},
-std::array<float,2>{0.591691196f, 0.610079706f},
-std::array<float,2>{0.0137893334f, 0.410156161f},
-std::array<float,2>{0.386698514f, 0.828689158f},
-std::array<float,2>{0.823892117f, 0.085286878f},
-std::array<float,2>{0.845795393f, 0.503796339f},
-std::array<float,2>{0.412340581f, 0.447211027f},
-std::array<float,2>{0.0557386056f, 0.759874463f},
-std::array<float,2>{0.619441092f, 0.0543310381f},
-std::array<float,2>{0.723158896f, 0.92116642f},
-std::array<float,2>{0.245189279f, 0.130104288f},
-std::array<float,2>{0.309908032f, 0.697768569f},
-std::array<float,2>{0.943285227f, 0.2672472f},
-std::array<float,2>{0.92732507f, 0.847405136f},
-std::array<float,2>{0.347815394f, 0.108906105f},
-std::array<float,2>{0.165565044f, 0.567641139f},
-std::array<float,2>{0.655747116f, 0.397478104f},
-std::array<float,2>{0.546613812f, 0.673216939f},
-std::array<float,2>{0.0902804211f, 0.368963301f},
-std::array<float,2>{0.471369267f, 0.97119242f},
-std::array<float,2>{0.786004007f, 0.203308061f},
-std::array<float,2>{0.985155046f, 0.722415328f},
-std::array<float,2>{0.272516966f, 0.30992046f},
-std::array<float,2>{0.189712584f, 0.876207173f},
-std::array<float,2>{0.713592887f, 0.186880976f},
-std::array<float,2>{0.584921718f, 0.788312018f},
-std::array<float,2>{0.00611054525f, 0.0303414948f},
-std::array<float,2>{0.378175586f, 0.545759141f},
-std::array<float,2>{0.814703465f, 0.486685574f},
-std::array<float,2>{0.761575043f, 0.953768075f},
-std::array<float,2>{0.445771784f, 0.241269827f},
-std::array<float,2>{0.101211108f, 0.626756847f},
-std::array<float,2>{0.509414792f, 0.335461915f},
-std::array<float,2>{0.663557291f, 0.603957295f},
-std::array<float,2>{0.125183821f, 0.433642298f},
-std::array<float,2>{0.340215504f, 0.819021642f},
-std::array<float,2>{0.891057789f, 0.0684137717f},
-std::array<float,2>{0.876406074f, 0.592349052f},
-std::array<float,2>{0.31991294f, 0.380923539f},
-std::array<float,2>{0.148909345f, 0.867360651f},
-std::array<float,2>{0.683506072f, 0.113485232f},
-std::array<float,2>{0.521917641f, 0.986546159f},
-std::array<float,2>{0.110251546f, 0.197395101f},
-std::array<float,2>{0.462293774f, 0.657796502f},
-std::array<float,2>{0.766951859f, 0.347946465f},
-std::array<float,2>{0.832434893f, 0.767823219f},
-std::array<float,2>{0.399705857f, 0.0412889123f},
-std::array<float,2>{0.0292901136f, 0.519511521f},
-std::array<float,2>{0.57015723f, 0.453466207f},
-std::array<float,2>{0.700136423f, 0.712141871f},
-std::array<float,2>{0.213745654f, 0.257027447f},
-std::array<float,2>{0.258758008f, 0.926007509f},
-std::array<float,2>{0.977220476f, 0.156011492f},
-std::array<float,2>{0.806458116f, 0.641836643f},
-std::array<float,2>{0.488144606f, 0.315974325f},
-std::array<float,2>{0.0708676279f, 0.945435047f},
-std::array<float,2>{0.55286938f, 0.231094569f},
-std::array<float,2>{0.639552951f, 0.833519757f},
-std::array<float,2>{0.177318767f, 0.0785598308f},
-std::array<float,2>{0.373921812f, 0.616734087f},
-std::array<float,2>{0.918531835f, 0.410289705f},
-std::array<float,2>{0.964566886f, 0.892808318f},
-std::array<float,2>{0.286833853f, 0.168281674f},
-std::array<float,2>{0.22370021f, 0.749248028f},
-std::array<float,2>{0.738889694f, 0.284980357f},
-std::array<float,2>{0.606469333f, 0.547816455f},
-std::array<float,2>{0.0369607024f, 0.469537407f},
-std::array<float,2>{0.434232056f, 0.798683345f},
-std::array<float,2>{0.86922431f, 0.0120552089f},
-std::array<float,2>{0.774871767f, 0.624408126f},
-std::array<float,2>{0.455467373f, 0.414551079f},
-std::array<float,2>{0.119045936f, 0.839638531f},
-std::array<float,2>{0.528654456f, 0.0892742425f},
-std::array<float,2>{0.675091088f, 0.941772401f},
-std::array<float,2>{0.143077701f, 0.222086057f},
-std::array<float,2>{0.324397027f, 0.65124166f},
-std::array<float,2>{0.888611317f, 0.325055182f},
-std::array<float,2>{0.975494027f, 0.805075645f},
-std::array<float,2>{0.254514873f, 0.00264574611f},
-std::array<float,2>{0.20527792f, 0.56036967f},
-std::array<float,2>{0.693205178f, 0.476953447f},
-std::array<float,2>{0.570735455f, 0.739223838f},
-std::array<float,2>{0.0205225665f, 0.294028193f},
-std::array<float,2>{0.396855235f, 0.898838341f},
-std::array<float,2>{0.843698144f, 0.158313721f},
-std::array<float,2>{0.910861135f, 0.667999268f},
-std::array<float,2>{0.35950011f, 0.354952067f},
-std::array<float,2>{0.182235435f, 0.992336512f},
-std::array<float,2>{0.625330865f, 0.188675106f},
-std::array<float,2>{0.556586981f, 0.861878932f},
-std::array<float,2>{0.0696208999f, 0.124922559f},
-std::array<float,2>{0.493591517f, 0.582691669f},
-std::array<float,2>{0.799491823f, 0.389353693f},
-std::array<float,2>{0.863140225f, 0.932287276f},
-std::array<float,2>{0.425182641f, 0.146316424f},
-std::array<float,2>{0.0426709466f, 0.704674304f},
-std::array<float,2>{0.599937081f, 0.261861563f},
-std::array<float,2>{0.748508692f, 0.528871655f},
-std::array<float,2>{0.230907336f, 0.462326527f},
-std::array<float,2>{0.292394698f, 0.774263918f},
-std::array<float,2>{0.95877111f, 0.0377927199f},
-std::array<float,2>{0.947518945f, 0.53872323f},
-std::array<float,2>{0.297647357f, 0.496330261f},
-std::array<float,2>{0.236566558f, 0.794062853f},
-std::array<float,2>{0.734037042f, 0.0190187301f},
-std::array<float,2>{0.613778055f, 0.885742903f},
-std::array<float,2>{0.0518841259f, 0.174040422f},
-std::array<float,2>{0.419234008f, 0.728036225f},
-std::array<float,2>{0.852937102f, 0.300987542f},
-std::array<float,2>{0.795219481f, 0.825504422f},
-std::array<float,2>{0.483552039f, 0.0727331489f},
-std::array<float,2>{0.081224218f, 0.59416151f},
-std::array<float,2>{0.538313031f, 0.425571501f},
-std::array<float,2>{0.644070208f, 0.636258185f},
-std::array<float,2>{0.156468675f, 0.340751797f},
-std::array<float,2>{0.353726476f, 0.964634478f},
-std::array<float,2>{0.931261539f, 0.24783349f},
-std::array<float,2>{0.827187896f, 0.693629622f},
-std::array<float,2>{0.387487113f, 0.277433246f},
-std::array<float,2>{0.00920362677f, 0.909077585f},
-std::array<float,2>{0.586454868f, 0.137440115f},
-std::array<float,2>{0.703574777f, 0.755331516f},
-std::array<float,2>{0.200737f, 0.0562457442f},
-std::array<float,2>{0.274850607f, 0.511354029f},
-std::array<float,2>{0.994132459f, 0.440659255f},
-std::array<float,2>{0.905334711f, 0.976801932f},
-std::array<float,2>{0.328858674f, 0.212998644f},
-std::array<float,2>{0.133630738f, 0.681168556f},
-std::array<float,2>{0.666339159f, 0.361302048f},
-std::array<float,2>{0.500148356f, 0.573910177f},
-std::array<float,2>{0.103525795f, 0.403915763f},
-std::array<float,2>{0.444005817f, 0.858203292f},
-std::array<float,2>{0.751206577f, 0.0949395075f},
-std::array<float,2>{0.754273832f, 0.553931653f},
-std::array<float,2>{0.439929247f, 0.473353684f},
-std::array<float,2>{0.107484594f, 0.801952302f},
-std::array<float,2>{0.50684768f, 0.0116466535f},
-std::array<float,2>{0.670000851f, 0.895572424f},
-std::array<float,2>{0.140241429f, 0.167160287f},
-std::array<float,2>{0.334006429f, 0.742534459f},
-std::array<float,2>{0.89920491f, 0.288347065f},
-std::array<float,2>{0.996544659f, 0.828575015f},
-std::array<float,2>{0.280603677f, 0.0856646001f},
-std::array<float,2>{0.196902141f, 0.609717309f},
-std::array<float,2>{0.709908128f, 0.409349859f},
-std::array<float,2>{0.592676163f, 0.645757914f},
-std::array<float,2>{0.0122357467f, 0.319865853f},
-std::array<float,2>{0.384610742f, 0.953049004f},
-std::array<float,2>{0.820549309f, 0.226640567f},
-std::array<float,2>{0.934918225f, 0.715431869f},
-std::array<float,2>{0.358034074f, 0.25073275f},
-std::array<float,2>{0.16375795f, 0.922086358f},
-std::array<float,2>{0.646963477f, 0.149978504f},
-std::array<float,2>{0.532268643f, 0.770427227f},
-std::array<float,2>{0.0840178132f, 0.04532573f},
-std::array<float,2>{0.479179531f, 0.522193134f},
-std::array<float,2>{0.791817546f, 0.457474887f},
-std::array<float,2>{0.859060347f, 0.989546835f},
-std::array<float,2>{0.415427923f, 0.20046322f},
-std::array<float,2>{0.0495400056f, 0.660516858f},
-std::array<float,2>{0.610415041f, 0.347510755f},
-std::array<float,2>{0.72709471f, 0.586996198f},
-std::array<float,2>{0.238562167f, 0.377978951f},
-std::array<float,2>{0.304549932f, 0.873374403f},
-std::array<float,2>{0.952762961f, 0.110853016f},
-std::array<float,2>{0.954604626f, 0.60664016f},
-std::array<float,2>{0.293952286f, 0.433546185f},
-std::array<float,2>{0.229313001f, 0.812830985f},
-std::array<float,2>{0.744542003f, 0.0659860671f},
-std::array<float,2>{0.596592247f, 0.957711279f},
-std::array<float,2>{0.0444950685f, 0.237656251f},
-std::array<float,2>{0.426719427f, 0.631561518f},
-std::array<float,2>{0.865504563f, 0.330286473f},
-std::array<float,2>{0.803430974f, 0.781492174f},
-std::array<float,2>{0.497331679f, 0.0268620234f},
-std::array<float,2>{0.0657886267f, 0.540532947f},
-std::array<float,2>{0.559768319f, 0.491960317f},
-std::array<float,2>{0.63155508f, 0.72302258f},
-std::array<float,2>{0.185790896f, 0.308452696f},
-std::array<float,2>{0.364584148f, 0.87911284f},
-std::array<float,2>{0.908144474f, 0.182096452f},
-std::array<float,2>{0.83786869f, 0.679488301f},
-std::array<float,2>{0.391556948f, 0.372697443f},
-std::array<float,2>{0.0180046745f, 0.973251998f},
-std::array<float,2>{0.578049004f, 0.207685679f},
-std::array<float,2>{0.691364586f, 0.848700523f},
-std::array<float,2>{0.208572507f, 0.104882881f},
-std::array<float,2>{0.250010759f, 0.565609038f},
-std::array<float,2>{0.968772709f, 0.393487334f},
-std::array<float,2>{0.884192348f, 0.915358484f},
-std::array<float,2>{0.321814805f, 0.126332104f},
-std::array<float,2>{0.147000194f, 0.702107668f},
-std::array<float,2>{0.678015828f, 0.272110105f},
-std::array<float,2>{0.526310027f, 0.504404783f},
-std::array<float,2>{0.123425201f, 0.450761288f},
-std::array<float,2>{0.459855497f, 0.761889994f},
-std::array<float,2>{0.777878523f, 0.0494016409f},
-std::array<float,2>{0.87209934f, 0.575197339f},
-std::array<float,2>{0.43058008f, 0.39939931f},
-std::array<float,2>{0.0317998193f, 0.853606462f},
-std::array<float,2>{0.601795077f, 0.101017751f},
-std::array<float,2>{0.735111833f, 0.980641782f},
-std::array<float,2>{0.221939772f, 0.215068847f},
-std::array<float,2>{0.28229171f, 0.68716836f},
-std::array<float,2>{0.965575933f, 0.365090281f},
-std::array<float,2>{0.917653799f, 0.752488971f},
-std::array<float,2>{0.369751096f, 0.0609362908f},
-std::array<float,2>{0.173859254f, 0.514709532f},
-std::array<float,2>{0.635177016f, 0.444510639f},
-std::array<float,2>{0.548218429f, 0.689973533f},
-std::array<float,2>{0.0771071687f, 0.2745924f},
-std::array<float,2>{0.490538448f, 0.913398683f},
-std::array<float,2>{0.809359133f, 0.134888291f},
-std::array<float,2>{0.982612491f, 0.63742888f},
-std::array<float,2>{0.262890875f, 0.339224279f},
-std::array<float,2>{0.215375394f, 0.965478182f},
-std::array<float,2>{0.697122812f, 0.24345915f},
-std::array<float,2>{0.56258148f, 0.820868254f},
-std::array<float,2>{0.0248301551f, 0.0779619515f},
-std::array<float,2>{0.404371351f, 0.599529862f},
-std::array<float,2>{0.831650436f, 0.429369539f},
-std::array<float,2>{0.769897044f, 0.889482617f},
-std::array<float,2>{0.46638757f, 0.176788688f},
-std::array<float,2>{0.114766039f, 0.731531262f},
-std::array<float,2>{0.519295096f, 0.300164878f},
-std::array<float,2>{0.684219897f, 0.532441616f},
-std::array<float,2>{0.155198172f, 0.495595366f},
-std::array<float,2>{0.313117117f, 0.792206824f},
-std::array<float,2>{0.881327868f, 0.0209873039f},
-std::array<float,2>{0.897534072f, 0.526869655f},
-std::array<float,2>{0.339497745f, 0.46546331f},
-std::array<float,2>{0.131419897f, 0.780844867f},
-std::array<float,2>{0.657315731f, 0.032970421f},
-std::array<float,2>{0.512147903f, 0.934787631f},
-std::array<float,2>{0.0975910127f, 0.144271985f},
-std::array<float,2>{0.449295849f, 0.708865464f},
-std::array<float,2>{0.764159143f, 0.259162694f},
-std::array<float,2>{0.817017496f, 0.86384517f},
-std::array<float,2>{0.382387221f, 0.117653243f},
-std::array<float,2>{0.00259081973f, 0.578706205f},
-std::array<float,2>{0.580832183f, 0.383601695f},
-std::array<float,2>{0.715188444f, 0.66774112f},
-std::array<float,2>{0.19312574f, 0.358487993f},
-std::array<float,2>{0.268899798f, 0.99736774f},
-std::array<float,2>{0.991529942f, 0.195250213f},
-std::array<float,2>{0.784013391f, 0.73567301f},
-std::array<float,2>{0.472999752f, 0.292110354f},
-std::array<float,2>{0.0862879604f, 0.903563678f},
-std::array<float,2>{0.542648196f, 0.163408518f},
-std::array<float,2>{0.652030766f, 0.810500443f},
-std::array<float,2>{0.169698775f, 0.00741374819f},
-std::array<float,2>{0.346880049f, 0.556003153f},
-std::array<float,2>{0.923981667f, 0.480729938f},
-std::array<float,2>{0.938545465f, 0.939688325f},
-std::array<float,2>{0.307492644f, 0.225296825f},
-std::array<float,2>{0.247751787f, 0.652390897f},
-std::array<float,2>{0.719633579f, 0.322559297f},
-std::array<float,2>{0.624425292f, 0.618308544f},
-std::array<float,2>{0.0590276867f, 0.421331882f},
-std::array<float,2>{0.408078432f, 0.84115696f},
-std::array<float,2>{0.849392354f, 0.0922848061f},
-std::array<float,2>{0.824336112f, 0.511074185f},
-std::array<float,2>{0.389804751f, 0.441349566f},
-std::array<float,2>{0.0109372083f, 0.755673647f},
-std::array<float,2>{0.589123428f, 0.0560380928f},
-std::array<float,2>{0.706889987f, 0.908227623f},
-std::array<float,2>{0.202462852f, 0.13710466f},
-std::array<float,2>{0.276853442f, 0.694119632f},
-std::array<float,2>{0.995572448f, 0.277870864f},
-std::array<float,2>{0.902587712f, 0.857600927f},
-std::array<float,2>{0.331574827f, 0.0953733474f},
-std::array<float,2>{0.135675505f, 0.57357496f},
-std::array<float,2>{0.665760338f, 0.403323323f},
-std::array<float,2>{0.503443956f, 0.680733979f},
-std::array<float,2>{0.101894923f, 0.360778511f},
-std::array<float,2>{0.441836357f, 0.977355599f},
-std::array<float,2>{0.753123939f, 0.21354489f},
-std::array<float,2>{0.94705075f, 0.72755605f},
-std::array<float,2>{0.300120384f, 0.301312596f},
-std::array<float,2>{0.236325175f, 0.886474252f},
-std::array<float,2>{0.730886281f, 0.174738273f},
-std::array<float,2>{0.615776181f, 0.794539928f},
-std::array<float,2>{0.0534882173f, 0.019300364f},
-std::array<float,2>{0.420944244f, 0.53856504f},
-std::array<float,2>{0.854352057f, 0.496622771f},
-std::array<float,2>{0.794513047f, 0.964024901f},
-std::array<float,2>{0.480859429f, 0.247217491f},
-std::array<float,2>{0.0787943676f, 0.636042714f},
-std::array<float,2>{0.535657287f, 0.340233266f},
-std::array<float,2>{0.641345263f, 0.594712496f},
-std::array<float,2>{0.158287436f, 0.425273955f},
-std::array<float,2>{0.352905452f, 0.825787723f},
-std::array<float,2>{0.933057368f, 0.0731228292f},
-std::array<float,2>{0.91321975f, 0.582216918f},
-std::array<float,2>{0.361617476f, 0.389111012f},
-std::array<float,2>{0.180924684f, 0.861399949f},
-std::array<float,2>{0.628740788f, 0.124093242f},
-std::array<float,2>{0.557412028f, 0.992970645f},
-std::array<float,2>{0.0666890666f, 0.189190149f},
-std::array<float,2>{0.494937897f, 0.668545604f},
-std::array<float,2>{0.797805429f, 0.35518679f},
-std::array<float,2>{0.86092031f, 0.773724914f},
-std::array<float,2>{0.422992766f, 0.0374922901f},
-std::array<float,2>{0.0399044678f, 0.528532267f},
-std::array<float,2>{0.599209189f, 0.462629259f},
-std::array<float,2>{0.747207165f, 0.704535663f},
-std::array<float,2>{0.233948916f, 0.262440413f},
-std::array<float,2>{0.289318532f, 0.93200022f},
-std::array<float,2>{0.960180819f, 0.145641163f},
-std::array<float,2>{0.775452197f, 0.650707126f},
-std::array<float,2>{0.454644501f, 0.324534684f},
-std::array<float,2>{0.120107576f, 0.941948116f},
-std::array<float,2>{0.531070232f, 0.222460061f},
-std::array<float,2>{0.6735394f, 0.838896751f},
-std::array<float,2>{0.142253205f, 0.0895020366f},
-std::array<float,2>{0.327675849f, 0.624918222f},
-std::array<float,2>{0.889252365f, 0.414124042f},
-std::array<float,2>{0.97459507f, 0.899027646f},
-std::array<float,2>{0.256619722f, 0.158766016f},
-std::array<float,2>{0.203380495f, 0.738660753f},
-std::array<float,2>{0.693605363f, 0.294465959f},
-std::array<float,2>{0.572982967f, 0.559909046f},
-std::array<float,2>{0.021542849f, 0.47748971f},
-std::array<float,2>{0.394596517f, 0.805392385f},
-std::array<float,2>{0.840843558f, 0.00203435495f},
-std::array<float,2>{0.807632804f, 0.616406441f},
-std::array<float,2>{0.485490203f, 0.410834253f},
-std::array<float,2>{0.0736751556f, 0.833490789f},
-std::array<float,2>{0.552585304f, 0.0786850899f},
-std::array<float,2>{0.637177944f, 0.946204305f},
-std::array<float,2>{0.178442135f, 0.230834261f},
-std::array<float,2>{0.371538103f, 0.642168224f},
-std::array<float,2>{0.92109555f, 0.315814823f},
-std::array<float,2>{0.961587906f, 0.797959626f},
-std::array<float,2>{0.288803965f, 0.0124152787f},
-std::array<float,2>{0.22551465f, 0.547205329f},
-std::array<float,2>{0.740374923f, 0.468825072f},
-std::array<float,2>{0.608477354f, 0.749806523f},
-std::array<float,2>{0.0380824432f, 0.284185231f},
-std::array<float,2>{0.436990172f, 0.893538833f},
-std::array<float,2>{0.868980765f, 0.168880627f},
-std::array<float,2>{0.87770462f, 0.657398701f},
-std::array<float,2>{0.317406178f, 0.34860599f},
-std::array<float,2>{0.151489615f, 0.987245619f},
-std::array<float,2>{0.679995537f, 0.197890878f},
-std::array<float,2>{0.520931244f, 0.867918134f},
-std::array<float,2>{0.111430839f, 0.113861471f},
-std::array<float,2>{0.463906527f, 0.592227459f},
-std::array<float,2>{0.768378854f, 0.381364495f},
-std::array<float,2>{0.834787071f, 0.926757574f},
-std::array<float,2>{0.401994437f, 0.155691087f},
-std::array<float,2>{0.0303437114f, 0.71275121f},
-std::array<float,2>{0.568183064f, 0.257469624f},
-std::array<float,2>{0.702023864f, 0.518903375f},
-std::array<float,2>{0.211908236f, 0.454009831f},
-std::array<float,2>{0.260220587f, 0.768206656f},
-std::array<float,2>{0.979077816f, 0.0416084975f},
-std::array<float,2>{0.987267077f, 0.545182765f},
-std::array<float,2>{0.270274043f, 0.486892998f},
-std::array<float,2>{0.188863546f, 0.788724065f},
-std::array<float,2>{0.711122453f, 0.031211637f},
-std::array<float,2>{0.583097577f, 0.876522005f},
-std::array<float,2>{0.00454965094f, 0.187449723f},
-std::array<float,2>{0.376280963f, 0.722063482f},
-std::array<float,2>{0.812812328f, 0.310192019f},
-std::array<float,2>{0.759706318f, 0.818593442f},
-std::array<float,2>{0.448214561f, 0.0691307038f},
-std::array<float,2>{0.0987337381f, 0.604383945f},
-std::array<float,2>{0.5109092f, 0.434136331f},
-std::array<float,2>{0.660492003f, 0.626318157f},
-std::array<float,2>{0.128245533f, 0.334996015f},
-std::array<float,2>{0.342345566f, 0.953478038f},
-std::array<float,2>{0.894192457f, 0.242037818f},
-std::array<float,2>{0.843977273f, 0.69741565f},
-std::array<float,2>{0.410978824f, 0.266621977f},
-std::array<float,2>{0.0573024005f, 0.921564996f},
-std::array<float,2>{0.619123816f, 0.130769357f},
-std::array<float,2>{0.725676f, 0.760446191f},
-std::array<float,2>{0.242245778f, 0.0538888499f},
-std::array<float,2>{0.310843587f, 0.503411591f},
-std::array<float,2>{0.943924665f, 0.446594149f},
-std::array<float,2>{0.928961992f, 0.970787346f},
-std::array<float,2>{0.350524992f, 0.203914464f},
-std::array<float,2>{0.167953685f, 0.67348212f},
-std::array<float,2>{0.653744757f, 0.368197709f},
-std::array<float,2>{0.544040799f, 0.567966223f},
-std::array<float,2>{0.0925396085f, 0.398073733f},
-std::array<float,2>{0.469057679f, 0.84673351f},
-std::array<float,2>{0.787708104f, 0.108853608f},
-std::array<float,2>{0.790638387f, 0.521108747f},
-std::array<float,2>{0.4782179f, 0.459435225f},
-std::array<float,2>{0.0824684575f, 0.77222091f},
-std::array<float,2>{0.534564912f, 0.043270804f},
-std::array<float,2>{0.645259321f, 0.925596952f},
-std::array<float,2>{0.160391569f, 0.151873276f},
-std::array<float,2>{0.355498254f, 0.718153715f},
-std::array<float,2>{0.935689449f, 0.253815502f},
-std::array<float,2>{0.94984448f, 0.871283352f},
-std::array<float,2>{0.301183373f, 0.112481527f},
-std::array<float,2>{0.241223708f, 0.58962971f},
-std::array<float,2>{0.729958653f, 0.375301152f},
-std::array<float,2>{0.612987697f, 0.662211716f},
-std::array<float,2>{0.0479593873f, 0.344036758f},
-std::array<float,2>{0.4175919f, 0.991437256f},
-std::array<float,2>{0.856123507f, 0.202649504f},
-std::array<float,2>{0.90089494f, 0.745101392f},
-std::array<float,2>{0.333049774f, 0.285399348f},
-std::array<float,2>{0.137604564f, 0.898426056f},
-std::array<float,2>{0.669724464f, 0.165831149f},
-std::array<float,2>{0.504824936f, 0.804085612f},
-std::array<float,2>{0.105933949f, 0.00826266874f},
-std::array<float,2>{0.43915081f, 0.551734507f},
-std::array<float,2>{0.757321954f, 0.475619674f},
-std::array<float,2>{0.823723674f, 0.951081872f},
-std::array<float,2>{0.385746598f, 0.229418069f},
-std::array<float,2>{0.0145685198f, 0.647389233f},
-std::array<float,2>{0.590858817f, 0.318262458f},
-std::array<float,2>{0.708339214f, 0.61173743f},
-std::array<float,2>{0.198775291f, 0.407793671f},
-std::array<float,2>{0.277405024f, 0.831697464f},
-std::array<float,2>{0.999284506f, 0.082721889f},
-std::array<float,2>{0.972371638f, 0.563301265f},
-std::array<float,2>{0.25199452f, 0.392131031f},
-std::array<float,2>{0.209175721f, 0.850460529f},
-std::array<float,2>{0.687924623f, 0.101723626f},
-std::array<float,2>{0.575545192f, 0.975089848f},
-std::array<float,2>{0.0158905704f, 0.2105297f},
-std::array<float,2>{0.394196838f, 0.676226616f},
-std::array<float,2>{0.839158833f, 0.373200029f},
-std::array<float,2>{0.779423952f, 0.763840079f},
-std::array<float,2>{0.4570553f, 0.0469068475f},
-std::array<float,2>{0.122426286f, 0.5074687f},
-std::array<float,2>{0.525346935f, 0.451471865f},
-std::array<float,2>{0.676514328f, 0.699270248f},
-std::array<float,2>{0.144872427f, 0.27141279f},
-std::array<float,2>{0.322610259f, 0.917733192f},
-std::array<float,2>{0.885257483f, 0.128409952f},
-std::array<float,2>{0.863647521f, 0.629211605f},
-std::array<float,2>{0.428548574f, 0.329808801f},
-std::array<float,2>{0.046116583f, 0.96089077f},
-std::array<float,2>{0.595319808f, 0.235738948f},
-std::array<float,2>{0.743298829f, 0.815979481f},
-std::array<float,2>{0.228271857f, 0.0638058111f},
-std::array<float,2>{0.295227706f, 0.608763516f},
-std::array<float,2>{0.956612825f, 0.430600911f},
-std::array<float,2>{0.909173906f, 0.881032109f},
-std::array<float,2>{0.366591603f, 0.18083863f},
-std::array<float,2>{0.183762208f, 0.725433886f},
-std::array<float,2>{0.629695594f, 0.305570871f},
-std::array<float,2>{0.561709046f, 0.541035235f},
-std::array<float,2>{0.0631152466f, 0.488911271f},
-std::array<float,2>{0.498427808f, 0.784748971f},
-std::array<float,2>{0.80148679f, 0.0236497708f},
-std::array<float,2>{0.829067826f, 0.599869847f},
-std::array<float,2>{0.403347194f, 0.427021205f},
-std::array<float,2>{0.0267971978f, 0.822571814f},
-std::array<float,2>{0.565764546f, 0.0755940825f},
-std::array<float,2>{0.697487414f, 0.967481732f},
-std::array<float,2>{0.218378007f, 0.245613515f},
-std::array<float,2>{0.265564859f, 0.639062524f},
-std::array<float,2>{0.981480002f, 0.336390853f},
-std::array<float,2>{0.879989922f, 0.790242434f},
-std::array<float,2>{0.315141022f, 0.0215701144f},
-std::array<float,2>{0.153739706f, 0.535036504f},
-std::array<float,2>{0.686600685f, 0.493185073f},
-std::array<float,2>{0.515924037f, 0.732614696f},
-std::array<float,2>{0.116300613f, 0.298611432f},
-std::array<float,2>{0.46742174f, 0.887421131f},
-std::array<float,2>{0.771581709f, 0.178375348f},
-std::array<float,2>{0.968216181f, 0.683995068f},
-std::array<float,2>{0.283708632f, 0.366769105f},
-std::array<float,2>{0.219158188f, 0.983377635f},
-std::array<float,2>{0.73745507f, 0.21858485f},
-std::array<float,2>{0.604789972f, 0.853265107f},
-std::array<float,2>{0.0349249467f, 0.0981843323f},
-std::array<float,2>{0.432462811f, 0.577674627f},
-std::array<float,2>{0.874802351f, 0.402237624f},
-std::array<float,2>{0.810958505f, 0.911473751f},
-std::array<float,2>{0.489715904f, 0.133574098f},
-std::array<float,2>{0.0751496851f, 0.688000739f},
-std::array<float,2>{0.550352037f, 0.276288867f},
-std::array<float,2>{0.633247495f, 0.511721313f},
-std::array<float,2>{0.172558203f, 0.4417831f},
-std::array<float,2>{0.367572755f, 0.750775516f},
-std::array<float,2>{0.914956212f, 0.0596271753f},
-std::array<float,2>{0.922587156f, 0.556936681f},
-std::array<float,2>{0.34555465f, 0.483310312f},
-std::array<float,2>{0.17108798f, 0.811844051f},
-std::array<float,2>{0.648900211f, 0.00454029907f},
-std::array<float,2>{0.53983438f, 0.904633105f},
-std::array<float,2>{0.0883982629f, 0.160872057f},
-std::array<float,2>{0.475117922f, 0.738089263f},
-std::array<float,2>{0.781290114f, 0.290014148f},
-std::array<float,2>{0.851117611f, 0.842872798f},
-std::array<float,2>{0.409224451f, 0.0907466337f},
-std::array<float,2>{0.0612413734f, 0.619365871f},
-std::array<float,2>{0.621503413f, 0.419154763f},
-std::array<float,2>{0.7220698f, 0.656135738f},
-std::array<float,2>{0.24859795f, 0.32137543f},
-std::array<float,2>{0.304921985f, 0.938830495f},
-std::array<float,2>{0.940783262f, 0.224596933f},
-std::array<float,2>{0.762959838f, 0.710157275f},
-std::array<float,2>{0.451310664f, 0.260075837f},
-std::array<float,2>{0.095436722f, 0.936313748f},
-std::array<float,2>{0.51473856f, 0.141623884f},
-std::array<float,2>{0.659331858f, 0.778344512f},
-std::array<float,2>{0.130103081f, 0.0343345068f},
-std::array<float,2>{0.336217731f, 0.52444768f},
-std::array<float,2>{0.894683957f, 0.466813385f},
-std::array<float,2>{0.988925219f, 0.998436928f},
-std::array<float,2>{0.265898049f, 0.193047971f},
-std::array<float,2>{0.195137009f, 0.664248526f},
-std::array<float,2>{0.718037367f, 0.356440365f},
-std::array<float,2>{0.579193711f, 0.58055985f},
-std::array<float,2>{0.000226383039f, 0.386472046f},
-std::array<float,2>{0.37904045f, 0.866985321f},
-std::array<float,2>{0.819832623f, 0.120332025f},
-std::array<float,2>{0.853143394f, 0.535536945f},
-std::array<float,2>{0.419759929f, 0.499992073f},
-std::array<float,2>{0.0523842573f, 0.795507252f},
-std::array<float,2>{0.613409162f, 0.0156575814f},
-std::array<float,2>{0.733543098f, 0.883206666f},
-std::array<float,2>{0.236954227f, 0.172460631f},
-std::array<float,2>{0.297247469f, 0.729340196f},
-std::array<float,2>{0.948157966f, 0.303024024f},
-std::array<float,2>{0.930793583f, 0.827990532f},
-std::array<float,2>{0.354381651f, 0.0707642287f},
-std::array<float,2>{0.156961426f, 0.596670568f},
-std::array<float,2>{0.643559158f, 0.423803568f},
-std::array<float,2>{0.538915515f, 0.634091675f},
-std::array<float,2>{0.0820157453f, 0.343025863f},
-std::array<float,2>{0.484256834f, 0.96134913f},
-std::array<float,2>{0.79568696f, 0.248760954f},
-std::array<float,2>{0.993469834f, 0.693317175f},
-std::array<float,2>{0.275215834f, 0.281119227f},
-std::array<float,2>{0.200344682f, 0.90786624f},
-std::array<float,2>{0.704100013f, 0.140101582f},
-std::array<float,2>{0.58624804f, 0.756238878f},
-std::array<float,2>{0.00952166039f, 0.0583534166f},
-std::array<float,2>{0.386917681f, 0.509306848f},
-std::array<float,2>{0.827837229f, 0.438282549f},
-std::array<float,2>{0.751497924f, 0.97852385f},
-std::array<float,2>{0.443539172f, 0.211048961f},
-std::array<float,2>{0.104241863f, 0.683232784f},
-std::array<float,2>{0.500896215f, 0.362582356f},
-std::array<float,2>{0.666780174f, 0.571530402f},
-std::array<float,2>{0.133154094f, 0.404922009f},
-std::array<float,2>{0.328419924f, 0.85548228f},
-std::array<float,2>{0.906203866f, 0.0961407945f},
-std::array<float,2>{0.887761116f, 0.622906029f},
-std::array<float,2>{0.324848056f, 0.416586161f},
-std::array<float,2>{0.142631084f, 0.836863101f},
-std::array<float,2>{0.675485849f, 0.0872016028f},
-std::array<float,2>{0.529227257f, 0.943772376f},
-std::array<float,2>{0.118558057f, 0.220154375f},
-std::array<float,2>{0.455767989f, 0.648579121f},
-std::array<float,2>{0.775027156f, 0.326769084f},
-std::array<float,2>{0.843144715f, 0.807458818f},
-std::array<float,2>{0.397326291f, 0.00122641132f},
-std::array<float,2>{0.0213782843f, 0.562492251f},
-std::array<float,2>{0.57082957f, 0.47858873f},
-std::array<float,2>{0.692629635f, 0.74034971f},
-std::array<float,2>{0.205870658f, 0.296552151f},
-std::array<float,2>{0.254022926f, 0.902040482f},
-std::array<float,2>{0.974792778f, 0.157579675f},
-std::array<float,2>{0.798858881f, 0.670647979f},
-std::array<float,2>{0.493920356f, 0.353437573f},
-std::array<float,2>{0.0699009225f, 0.994453251f},
-std::array<float,2>{0.555762887f, 0.189653173f},
-std::array<float,2>{0.625794828f, 0.860434711f},
-std::array<float,2>{0.181974053f, 0.12154147f},
-std::array<float,2>{0.360340983f, 0.585406125f},
-std::array<float,2>{0.910381436f, 0.387465149f},
-std::array<float,2>{0.958112419f, 0.92977643f},
-std::array<float,2>{0.292823255f, 0.147048295f},
-std::array<float,2>{0.231234029f, 0.706335008f},
-std::array<float,2>{0.748794913f, 0.264372379f},
-std::array<float,2>{0.600522637f, 0.53032285f},
-std::array<float,2>{0.0423284061f, 0.463208348f},
-std::array<float,2>{0.425506473f, 0.776555717f},
-std::array<float,2>{0.862371683f, 0.0351758935f},
-std::array<float,2>{0.767500997f, 0.590008438f},
-std::array<float,2>{0.462645113f, 0.380165011f},
-std::array<float,2>{0.109541319f, 0.870769501f},
-std::array<float,2>{0.522050917f, 0.115477934f},
-std::array<float,2>{0.682652295f, 0.984613776f},
-std::array<float,2>{0.149002686f, 0.197214931f},
-std::array<float,2>{0.319805712f, 0.658540845f},
-std::array<float,2>{0.876502573f, 0.350613415f},
-std::array<float,2>{0.976855516f, 0.766537905f},
-std::array<float,2>{0.258282155f, 0.0394392349f},
-std::array<float,2>{0.213079065f, 0.517277718f},
-std::array<float,2>{0.699281216f, 0.456459552f},
-std::array<float,2>{0.569758177f, 0.714213252f},
-std::array<float,2>{0.0284440313f, 0.254460812f},
-std::array<float,2>{0.400278717f, 0.92813915f},
-std::array<float,2>{0.832991302f, 0.153904676f},
-std::array<float,2>{0.918111026f, 0.643628836f},
-std::array<float,2>{0.373292625f, 0.313569099f},
-std::array<float,2>{0.177073091f, 0.947358489f},
-std::array<float,2>{0.63915801f, 0.23292923f},
-std::array<float,2>{0.553446412f, 0.835488677f},
-std::array<float,2>{0.0706656799f, 0.0805793107f},
-std::array<float,2>{0.487588882f, 0.614904106f},
-std::array<float,2>{0.805742443f, 0.413512796f},
-std::array<float,2>{0.870029867f, 0.890916884f},
-std::array<float,2>{0.43396917f, 0.171188086f},
-std::array<float,2>{0.0361830406f, 0.746657848f},
-std::array<float,2>{0.607212126f, 0.282745659f},
-std::array<float,2>{0.738490164f, 0.550035536f},
-std::array<float,2>{0.224248737f, 0.472191721f},
-std::array<float,2>{0.286459714f, 0.800598562f},
-std::array<float,2>{0.964167893f, 0.0142773557f},
-std::array<float,2>{0.94277221f, 0.501021326f},
-std::array<float,2>{0.310117036f, 0.447982848f},
-std::array<float,2>{0.246027842f, 0.759345114f},
-std::array<float,2>{0.72271347f, 0.0527117848f},
-std::array<float,2>{0.619766593f, 0.919644773f},
-std::array<float,2>{0.0565320402f, 0.131245837f},
-std::array<float,2>{0.412739277f, 0.696664393f},
-std::array<float,2>{0.846583605f, 0.268270671f},
-std::array<float,2>{0.785330892f, 0.844174027f},
-std::array<float,2>{0.470809549f, 0.105959661f},
-std::array<float,2>{0.0907003433f, 0.568704784f},
-std::array<float,2>{0.546043217f, 0.394873798f},
-std::array<float,2>{0.656025827f, 0.675404787f},
-std::array<float,2>{0.165416598f, 0.369146824f},
-std::array<float,2>{0.348279923f, 0.970232248f},
-std::array<float,2>{0.927171767f, 0.205607116f},
-std::array<float,2>{0.815386891f, 0.720474422f},
-std::array<float,2>{0.378717273f, 0.311953098f},
-std::array<float,2>{0.00681235688f, 0.877599657f},
-std::array<float,2>{0.584191382f, 0.183832124f},
-std::array<float,2>{0.713318229f, 0.786565185f},
-std::array<float,2>{0.190278292f, 0.0285767242f},
-std::array<float,2>{0.273091793f, 0.544668496f},
-std::array<float,2>{0.984772801f, 0.485878319f},
-std::array<float,2>{0.891320586f, 0.955962002f},
-std::array<float,2>{0.340444356f, 0.238321424f},
-std::array<float,2>{0.125661433f, 0.628003001f},
-std::array<float,2>{0.663936257f, 0.332959682f},
-std::array<float,2>{0.508811355f, 0.602211118f},
-std::array<float,2>{0.10059873f, 0.437456369f},
-std::array<float,2>{0.445933044f, 0.816628337f},
-std::array<float,2>{0.761196315f, 0.0681038573f},
-std::array<float,2>{0.779124081f, 0.506429136f},
-std::array<float,2>{0.46079421f, 0.452985436f},
-std::array<float,2>{0.124826789f, 0.765232563f},
-std::array<float,2>{0.526663542f, 0.0483120792f},
-std::array<float,2>{0.678872645f, 0.916298926f},
-std::array<float,2>{0.148171991f, 0.127216548f},
-std::array<float,2>{0.321099252f, 0.701004624f},
-std::array<float,2>{0.883288682f, 0.270119309f},
-std::array<float,2>{0.970318675f, 0.851460159f},
-std::array<float,2>{0.250982851f, 0.102894031f},
-std::array<float,2>{0.207327947f, 0.564300537f},
-std::array<float,2>{0.689623892f, 0.391186714f},
-std::array<float,2>{0.576773524f, 0.676887512f},
-std::array<float,2>{0.0190126393f, 0.374799907f},
-std::array<float,2>{0.391929924f, 0.976023972f},
-std::array<float,2>{0.836692929f, 0.209112033f},
-std::array<float,2>{0.906882882f, 0.726416826f},
-std::array<float,2>{0.364123583f, 0.305711538f},
-std::array<float,2>{0.18701981f, 0.882145107f},
-std::array<float,2>{0.632004738f, 0.180374607f},
-std::array<float,2>{0.558716178f, 0.783575237f},
-std::array<float,2>{0.0653456002f, 0.0251018591f},
-std::array<float,2>{0.496560305f, 0.542403221f},
-std::array<float,2>{0.803714693f, 0.490168989f},
-std::array<float,2>{0.866665065f, 0.959531724f},
-std::array<float,2>{0.426994354f, 0.234495059f},
-std::array<float,2>{0.043079745f, 0.630402565f},
-std::array<float,2>{0.597432673f, 0.328265131f},
-std::array<float,2>{0.746000707f, 0.607843041f},
-std::array<float,2>{0.230268389f, 0.431108087f},
-std::array<float,2>{0.293246716f, 0.814921021f},
-std::array<float,2>{0.953867614f, 0.0633072853f},
-std::array<float,2>{0.951723933f, 0.588518441f},
-std::array<float,2>{0.302975416f, 0.376121193f},
-std::array<float,2>{0.239958912f, 0.872546375f},
-std::array<float,2>{0.728340387f, 0.112042569f},
-std::array<float,2>{0.610182762f, 0.991018295f},
-std::array<float,2>{0.0499019288f, 0.201992273f},
-std::array<float,2>{0.41418159f, 0.663733542f},
-std::array<float,2>{0.858386159f, 0.344744593f},
-std::array<float,2>{0.792305052f, 0.772767305f},
-std::array<float,2>{0.479746908f, 0.0446302444f},
-std::array<float,2>{0.0857885107f, 0.520139396f},
-std::array<float,2>{0.531985223f, 0.460463166f},
-std::array<float,2>{0.648399532f, 0.717624605f},
-std::array<float,2>{0.163018182f, 0.252775073f},
-std::array<float,2>{0.358971477f, 0.924176693f},
-std::array<float,2>{0.934133768f, 0.150676876f},
-std::array<float,2>{0.821532667f, 0.647960305f},
-std::array<float,2>{0.383261383f, 0.317108691f},
-std::array<float,2>{0.0133740613f, 0.950080097f},
-std::array<float,2>{0.593244255f, 0.230468199f},
-std::array<float,2>{0.710247934f, 0.830222964f},
-std::array<float,2>{0.196059048f, 0.0837828368f},
-std::array<float,2>{0.279542327f, 0.613038778f},
-std::array<float,2>{0.997242451f, 0.406586736f},
-std::array<float,2>{0.899784505f, 0.8966977f},
-std::array<float,2>{0.33576116f, 0.164338231f},
-std::array<float,2>{0.13902694f, 0.746081591f},
-std::array<float,2>{0.67110008f, 0.286419779f},
-std::array<float,2>{0.506591201f, 0.552722692f},
-std::array<float,2>{0.108968139f, 0.475471735f},
-std::array<float,2>{0.441042632f, 0.80275774f},
-std::array<float,2>{0.755154967f, 0.00968388375f},
-std::array<float,2>{0.848222017f, 0.620922744f},
-std::array<float,2>{0.4070898f, 0.418621361f},
-std::array<float,2>{0.0605241358f, 0.842219472f},
-std::array<float,2>{0.623428702f, 0.0910972506f},
-std::array<float,2>{0.720621884f, 0.9381001f},
-std::array<float,2>{0.24706693f, 0.223348781f},
-std::array<float,2>{0.308146894f, 0.655082107f},
-std::array<float,2>{0.938415051f, 0.320655406f},
-std::array<float,2>{0.925046623f, 0.810824275f},
-std::array<float,2>{0.346253395f, 0.00549793616f},
-std::array<float,2>{0.16860503f, 0.558234751f},
-std::array<float,2>{0.650685906f, 0.483945221f},
-std::array<float,2>{0.54153645f, 0.73681438f},
-std::array<float,2>{0.0873711333f, 0.29047972f},
-std::array<float,2>{0.473684877f, 0.906240702f},
-std::array<float,2>{0.784888983f, 0.161674023f},
-std::array<float,2>{0.99029386f, 0.665286362f},
-std::array<float,2>{0.268246531f, 0.356883734f},
-std::array<float,2>{0.192140713f, 0.999434054f},
-std::array<float,2>{0.715832233f, 0.191992521f},
-std::array<float,2>{0.581548035f, 0.866105676f},
-std::array<float,2>{0.00389993656f, 0.120025538f},
-std::array<float,2>{0.381691843f, 0.581303954f},
-std::array<float,2>{0.817410707f, 0.384797037f},
-std::array<float,2>{0.765624225f, 0.936841011f},
-std::array<float,2>{0.450602889f, 0.141354769f},
-std::array<float,2>{0.0961523876f, 0.709010005f},
-std::array<float,2>{0.512814164f, 0.261667848f},
-std::array<float,2>{0.657058775f, 0.523531675f},
-std::array<float,2>{0.13245374f, 0.467909724f},
-std::array<float,2>{0.338585615f, 0.777971089f},
-std::array<float,2>{0.897393942f, 0.0339519531f},
-std::array<float,2>{0.882108092f, 0.534152746f},
-std::array<float,2>{0.313561559f, 0.492735952f},
-std::array<float,2>{0.155778632f, 0.789612949f},
-std::array<float,2>{0.685376525f, 0.0227329619f},
-std::array<float,2>{0.51768893f, 0.88865298f},
-std::array<float,2>{0.113906816f, 0.178769767f},
-std::array<float,2>{0.46526438f, 0.734307885f},
-std::array<float,2>{0.77107805f, 0.297823101f},
-std::array<float,2>{0.830954671f, 0.82397747f},
-std::array<float,2>{0.405760109f, 0.0743797347f},
-std::array<float,2>{0.0237915907f, 0.601161897f},
-std::array<float,2>{0.564109802f, 0.426548034f},
-std::array<float,2>{0.695397139f, 0.64044559f},
-std::array<float,2>{0.216354832f, 0.337461591f},
-std::array<float,2>{0.262085348f, 0.967897356f},
-std::array<float,2>{0.98426652f, 0.24492684f},
-std::array<float,2>{0.809901714f, 0.688522279f},
-std::array<float,2>{0.491755038f, 0.276834428f},
-std::array<float,2>{0.0773570314f, 0.910578907f},
-std::array<float,2>{0.546878874f, 0.133986458f},
-std::array<float,2>{0.636172354f, 0.751722038f},
-std::array<float,2>{0.1757797f, 0.0591456592f},
-std::array<float,2>{0.370340407f, 0.513484657f},
-std::array<float,2>{0.916318893f, 0.442385972f},
-std::array<float,2>{0.96620816f, 0.984341919f},
-std::array<float,2>{0.281658947f, 0.21752207f},
-std::array<float,2>{0.221279249f, 0.685353875f},
-std::array<float,2>{0.735589206f, 0.366055548f},
-std::array<float,2>{0.603293538f, 0.576573849f},
-std::array<float,2>{0.0326565355f, 0.401105493f},
-std::array<float,2>{0.430758119f, 0.851981044f},
-std::array<float,2>{0.871797204f, 0.0987721905f},
-std::array<float,2>{0.840195119f, 0.561319411f},
-std::array<float,2>{0.395782739f, 0.479728729f},
-std::array<float,2>{0.0232991558f, 0.808376014f},
-std::array<float,2>{0.573901653f, 0.000253393489f},
-std::array<float,2>{0.695052147f, 0.901146472f},
-std::array<float,2>{0.204787493f, 0.156729802f},
-std::array<float,2>{0.257732779f, 0.741701484f},
-std::array<float,2>{0.972680151f, 0.295858145f},
-std::array<float,2>{0.890026987f, 0.837792277f},
-std::array<float,2>{0.326298207f, 0.0867224187f},
-std::array<float,2>{0.140936345f, 0.621393025f},
-std::array<float,2>{0.67209518f, 0.417612791f},
-std::array<float,2>{0.529362679f, 0.64950788f},
-std::array<float,2>{0.120312698f, 0.327522546f},
-std::array<float,2>{0.453916252f, 0.945037127f},
-std::array<float,2>{0.777158439f, 0.21941942f},
-std::array<float,2>{0.95937407f, 0.705081761f},
-std::array<float,2>{0.290098369f, 0.264797717f},
-std::array<float,2>{0.232577577f, 0.93154788f},
-std::array<float,2>{0.74612993f, 0.147839502f},
-std::array<float,2>{0.597712457f, 0.775550425f},
-std::array<float,2>{0.0401111916f, 0.0368001498f},
-std::array<float,2>{0.42261219f, 0.529777408f},
-std::array<float,2>{0.860070229f, 0.464106619f},
-std::array<float,2>{0.797870994f, 0.995518208f},
-std::array<float,2>{0.495184064f, 0.190966398f},
-std::array<float,2>{0.0677586943f, 0.671662509f},
-std::array<float,2>{0.557925224f, 0.351592332f},
-std::array<float,2>{0.627795517f, 0.584757864f},
-std::array<float,2>{0.180238485f, 0.38799718f},
-std::array<float,2>{0.36303547f, 0.859971344f},
-std::array<float,2>{0.91220659f, 0.12264467f},
-std::array<float,2>{0.931761563f, 0.597170293f},
-std::array<float,2>{0.352234185f, 0.42195192f},
-std::array<float,2>{0.160143241f, 0.826409996f},
-std::array<float,2>{0.641629517f, 0.0718392059f},
-std::array<float,2>{0.536276937f, 0.962039888f},
-std::array<float,2>{0.0799357072f, 0.249909565f},
-std::array<float,2>{0.481699258f, 0.633018494f},
-std::array<float,2>{0.793506563f, 0.341989756f},
-std::array<float,2>{0.854970217f, 0.796572685f},
-std::array<float,2>{0.420015335f, 0.0172845498f},
-std::array<float,2>{0.0537813716f, 0.536584616f},
-std::array<float,2>{0.616903603f, 0.498689413f},
-std::array<float,2>{0.731850564f, 0.729739964f},
-std::array<float,2>{0.234750092f, 0.304462463f},
-std::array<float,2>{0.299019754f, 0.884286463f},
-std::array<float,2>{0.945768952f, 0.172961384f},
-std::array<float,2>{0.752298772f, 0.682318687f},
-std::array<float,2>{0.44267863f, 0.362245947f},
-std::array<float,2>{0.10258235f, 0.980063677f},
-std::array<float,2>{0.502891541f, 0.212090746f},
-std::array<float,2>{0.664372802f, 0.856743813f},
-std::array<float,2>{0.136596069f, 0.0971154049f},
-std::array<float,2>{0.330140084f, 0.570632398f},
-std::array<float,2>{0.903574109f, 0.406100094f},
-std::array<float,2>{0.994838774f, 0.906718731f},
-std::array<float,2>{0.276082784f, 0.139383212f},
-std::array<float,2>{0.201651782f, 0.691770613f},
-std::array<float,2>{0.705445528f, 0.279823065f},
-std::array<float,2>{0.588255048f, 0.508734643f},
-std::array<float,2>{0.0104880584f, 0.438679874f},
-std::array<float,2>{0.388900101f, 0.756990373f},
-std::array<float,2>{0.826115906f, 0.0567455254f},
-std::array<float,2>{0.788277864f, 0.569772899f},
-std::array<float,2>{0.470288128f, 0.395660251f},
-std::array<float,2>{0.0934725404f, 0.845289707f},
-std::array<float,2>{0.543914616f, 0.106808081f},
-std::array<float,2>{0.652869642f, 0.969311416f},
-std::array<float,2>{0.16672872f, 0.20655255f},
-std::array<float,2>{0.351287693f, 0.673956871f},
-std::array<float,2>{0.928383768f, 0.371049315f},
-std::array<float,2>{0.944370747f, 0.757886529f},
-std::array<float,2>{0.311707824f, 0.0512438379f},
-std::array<float,2>{0.243620872f, 0.500341415f},
-std::array<float,2>{0.72546196f, 0.448422283f},
-std::array<float,2>{0.618097365f, 0.695612967f},
-std::array<float,2>{0.0582783259f, 0.269004315f},
-std::array<float,2>{0.411232114f, 0.918255746f},
-std::array<float,2>{0.845037222f, 0.131912977f},
-std::array<float,2>{0.893048167f, 0.627001584f},
-std::array<float,2>{0.342997372f, 0.333214104f},
-std::array<float,2>{0.127101019f, 0.956384897f},
-std::array<float,2>{0.662044942f, 0.23957409f},
-std::array<float,2>{0.510222137f, 0.818105459f},
-std::array<float,2>{0.0983981118f, 0.0672272965f},
-std::array<float,2>{0.449079901f, 0.602694571f},
-std::array<float,2>{0.758277416f, 0.43622613f},
-std::array<float,2>{0.814443588f, 0.878520131f},
-std::array<float,2>{0.375197679f, 0.185213149f},
-std::array<float,2>{0.00514967786f, 0.71968925f},
-std::array<float,2>{0.582990944f, 0.311310172f},
-std::array<float,2>{0.7125296f, 0.543801725f},
-std::array<float,2>{0.187807649f, 0.484663874f},
-std::array<float,2>{0.270700842f, 0.785944283f},
-std::array<float,2>{0.988248885f, 0.027370045f},
-std::array<float,2>{0.979709268f, 0.516025186f},
-std::array<float,2>{0.261162966f, 0.455788612f},
-std::array<float,2>{0.212527126f, 0.767196596f},
-std::array<float,2>{0.703017116f, 0.0401820727f},
-std::array<float,2>{0.566845775f, 0.928783834f},
-std::array<float,2>{0.0302485228f, 0.153198019f},
-std::array<float,2>{0.401001453f, 0.713789642f},
-std::array<float,2>{0.835763395f, 0.255218863f},
-std::array<float,2>{0.7686342f, 0.869452894f},
-std::array<float,2>{0.463443309f, 0.117148817f},
-std::array<float,2>{0.112482227f, 0.591549575f},
-std::array<float,2>{0.519543886f, 0.379282653f},
-std::array<float,2>{0.681010902f, 0.659842789f},
-std::array<float,2>{0.150607362f, 0.350094646f},
-std::array<float,2>{0.31705156f, 0.986172795f},
-std::array<float,2>{0.878523648f, 0.195829779f},
-std::array<float,2>{0.867708743f, 0.747936487f},
-std::array<float,2>{0.435928345f, 0.281389892f},
-std::array<float,2>{0.0385236703f, 0.891637981f},
-std::array<float,2>{0.607662976f, 0.170392513f},
-std::array<float,2>{0.74203521f, 0.799667776f},
-std::array<float,2>{0.225717917f, 0.0146952439f},
-std::array<float,2>{0.287613988f, 0.549608231f},
-std::array<float,2>{0.961990952f, 0.471460789f},
-std::array<float,2>{0.92002207f, 0.94839704f},
-std::array<float,2>{0.372964561f, 0.23407732f},
-std::array<float,2>{0.179590389f, 0.643388689f},
-std::array<float,2>{0.638097405f, 0.312604219f},
-std::array<float,2>{0.551392913f, 0.61389637f},
-std::array<float,2>{0.0722744167f, 0.412764102f},
-std::array<float,2>{0.484529912f, 0.834863782f},
-std::array<float,2>{0.806860983f, 0.0817649215f},
-std::array<float,2>{0.802697957f, 0.539142191f},
-std::array<float,2>{0.49965027f, 0.490381181f},
-std::array<float,2>{0.064138405f, 0.782866776f},
-std::array<float,2>{0.561167121f, 0.0254097842f},
-std::array<float,2>{0.630027473f, 0.879909396f},
-std::array<float,2>{0.184924886f, 0.182650805f},
-std::array<float,2>{0.366003722f, 0.724073648f},
-std::array<float,2>{0.91010797f, 0.306768417f},
-std::array<float,2>{0.955677092f, 0.814428866f},
-std::array<float,2>{0.296261787f, 0.0647195578f},
-std::array<float,2>{0.226960629f, 0.606406331f},
-std::array<float,2>{0.742459774f, 0.432338119f},
-std::array<float,2>{0.594157577f, 0.63196671f},
-std::array<float,2>{0.0456735902f, 0.33142513f},
-std::array<float,2>{0.429272652f, 0.958918691f},
-std::array<float,2>{0.86457932f, 0.236701518f},
-std::array<float,2>{0.885758817f, 0.702355862f},
-std::array<float,2>{0.32402423f, 0.273432791f},
-std::array<float,2>{0.146211356f, 0.914517343f},
-std::array<float,2>{0.677046239f, 0.125179917f},
-std::array<float,2>{0.524202287f, 0.762721896f},
-std::array<float,2>{0.121600255f, 0.0502385274f},
-std::array<float,2>{0.458254904f, 0.505661905f},
-std::array<float,2>{0.780400455f, 0.450030416f},
-std::array<float,2>{0.838349938f, 0.973656178f},
-std::array<float,2>{0.392835528f, 0.208707601f},
-std::array<float,2>{0.0168526117f, 0.677816987f},
-std::array<float,2>{0.574274898f, 0.371859074f},
-std::array<float,2>{0.688859582f, 0.564985394f},
-std::array<float,2>{0.210442305f, 0.393932343f},
-std::array<float,2>{0.25356409f, 0.848395765f},
-std::array<float,2>{0.97116214f, 0.104023218f},
-std::array<float,2>{0.998304963f, 0.611162245f},
-std::array<float,2>{0.279227912f, 0.408557713f},
-std::array<float,2>{0.197973579f, 0.829142749f},
-std::array<float,2>{0.707104862f, 0.0846508741f},
-std::array<float,2>{0.590538681f, 0.9513008f},
-std::array<float,2>{0.0151397157f, 0.227965638f},
-std::array<float,2>{0.384934425f, 0.645234883f},
-std::array<float,2>{0.82247752f, 0.318378001f},
-std::array<float,2>{0.756409824f, 0.801282406f},
-std::array<float,2>{0.437789291f, 0.0106926383f},
-std::array<float,2>{0.107081972f, 0.552963436f},
-std::array<float,2>{0.505578458f, 0.474233687f},
-std::array<float,2>{0.668406785f, 0.743519187f},
-std::array<float,2>{0.137953728f, 0.287242472f},
-std::array<float,2>{0.332748294f, 0.894778013f},
-std::array<float,2>{0.901708722f, 0.166765019f},
-std::array<float,2>{0.856608808f, 0.66128087f},
-std::array<float,2>{0.416925251f, 0.346156925f},
-std::array<float,2>{0.0476750135f, 0.988958418f},
-std::array<float,2>{0.611387253f, 0.199359342f},
-std::array<float,2>{0.728942096f, 0.874230802f},
-std::array<float,2>{0.240370601f, 0.11024569f},
-std::array<float,2>{0.302380979f, 0.586620569f},
-std::array<float,2>{0.950930595f, 0.377133876f},
-std::array<float,2>{0.936989725f, 0.92375809f},
-std::array<float,2>{0.356787026f, 0.148913756f},
-std::array<float,2>{0.161573678f, 0.716763616f},
-std::array<float,2>{0.645699322f, 0.25173232f},
-std::array<float,2>{0.533257604f, 0.522631109f},
-std::array<float,2>{0.0834769979f, 0.458044946f},
-std::array<float,2>{0.476677179f, 0.770813823f},
-std::array<float,2>{0.789752841f, 0.0468298048f},
-std::array<float,2>{0.81878835f, 0.579341769f},
-std::array<float,2>{0.380449027f, 0.384019494f},
-std::array<float,2>{0.00186604925f, 0.86442548f},
-std::array<float,2>{0.57880652f, 0.118377432f},
-std::array<float,2>{0.717534661f, 0.996856928f},
-std::array<float,2>{0.1937408f, 0.193586022f},
-std::array<float,2>{0.267267853f, 0.666742921f},
-std::array<float,2>{0.989480972f, 0.357689261f},
-std::array<float,2>{0.89625752f, 0.780050218f},
-std::array<float,2>{0.337859005f, 0.0321902968f},
-std::array<float,2>{0.129808769f, 0.526333809f},
-std::array<float,2>{0.65826416f, 0.466258407f},
-std::array<float,2>{0.514613807f, 0.707301974f},
-std::array<float,2>{0.0939585865f, 0.258382738f},
-std::array<float,2>{0.45224449f, 0.933867693f},
-std::array<float,2>{0.761994898f, 0.142938823f},
-std::array<float,2>{0.9394961f, 0.654084861f},
-std::array<float,2>{0.306591511f, 0.323658854f},
-std::array<float,2>{0.249253958f, 0.940550387f},
-std::array<float,2>{0.72153157f, 0.225689918f},
-std::array<float,2>{0.622230411f, 0.839946508f},
-std::array<float,2>{0.0618713088f, 0.0937249735f},
-std::array<float,2>{0.408305079f, 0.618010759f},
-std::array<float,2>{0.849741817f, 0.42055729f},
-std::array<float,2>{0.783186018f, 0.902861834f},
-std::array<float,2>{0.476112962f, 0.162375659f},
-std::array<float,2>{0.0892136693f, 0.735154688f},
-std::array<float,2>{0.540148258f, 0.291220278f},
-std::array<float,2>{0.649733722f, 0.555265784f},
-std::array<float,2>{0.170541137f, 0.4823834f},
-std::array<float,2>{0.344267637f, 0.808742464f},
-std::array<float,2>{0.923509598f, 0.00674363971f},
-std::array<float,2>{0.915487707f, 0.514021933f},
-std::array<float,2>{0.368480742f, 0.443548471f},
-std::array<float,2>{0.173617423f, 0.75370115f},
-std::array<float,2>{0.634093225f, 0.0619479194f},
-std::array<float,2>{0.549707174f, 0.912206769f},
-std::array<float,2>{0.0756931752f, 0.135931075f},
-std::array<float,2>{0.489013642f, 0.691089213f},
-std::array<float,2>{0.812446892f, 0.273778111f},
-std::array<float,2>{0.873948276f, 0.854516506f},
-std::array<float,2>{0.432715327f, 0.100495383f},
-std::array<float,2>{0.0339011997f, 0.574824691f},
-std::array<float,2>{0.603728712f, 0.399979353f},
-std::array<float,2>{0.73693037f, 0.686037958f},
-std::array<float,2>{0.220407709f, 0.363586217f},
-std::array<float,2>{0.284565896f, 0.982113659f},
-std::array<float,2>{0.966946006f, 0.216367856f},
-std::array<float,2>{0.773103774f, 0.731030762f},
-std::array<float,2>{0.468661368f, 0.299367309f},
-std::array<float,2>{0.11593055f, 0.889948785f},
-std::array<float,2>{0.516966581f, 0.17615217f},
-std::array<float,2>{0.685575366f, 0.791180313f},
-std::array<float,2>{0.152789652f, 0.0197534654f},
-std::array<float,2>{0.315827549f, 0.531273007f},
-std::array<float,2>{0.879149795f, 0.494902939f},
-std::array<float,2>{0.981239796f, 0.966327846f},
-std::array<float,2>{0.264170796f, 0.242824793f},
-std::array<float,2>{0.217433974f, 0.63778019f},
-std::array<float,2>{0.699141681f, 0.338660449f},
-std::array<float,2>{0.564583123f, 0.597831011f},
-std::array<float,2>{0.025923308f, 0.42849651f},
-std::array<float,2>{0.402375847f, 0.821784794f},
-std::array<float,2>{0.829175115f, 0.0769583136f},
-std::array<float,2>{0.861877859f, 0.527387023f},
-std::array<float,2>{0.424535662f, 0.461327046f},
-std::array<float,2>{0.0417114012f, 0.774517357f},
-std::array<float,2>{0.600669086f, 0.0384324677f},
-std::array<float,2>{0.749394655f, 0.933481216f},
-std::array<float,2>{0.232152611f, 0.144916877f},
-std::array<float,2>{0.291350901f, 0.703973293f},
-std::array<float,2>{0.957142055f, 0.263116628f},
-std::array<float,2>{0.911742806f, 0.863080919f},
-std::array<float,2>{0.361260653f, 0.123390228f},
-std::array<float,2>{0.183101147f, 0.583792925f},
-std::array<float,2>{0.626433671f, 0.390147984f},
-std::array<float,2>{0.555636346f, 0.669498205f},
-std::array<float,2>{0.0691122934f, 0.353877723f},
-std::array<float,2>{0.492855728f, 0.994130194f},
-std::array<float,2>{0.800382376f, 0.187649503f},
-std::array<float,2>{0.976095676f, 0.73937583f},
-std::array<float,2>{0.25568673f, 0.292980045f},
-std::array<float,2>{0.206389844f, 0.899652898f},
-std::array<float,2>{0.691815853f, 0.160026252f},
-std::array<float,2>{0.571556985f, 0.806529403f},
-std::array<float,2>{0.0197600983f, 0.00339245261f},
-std::array<float,2>{0.39784354f, 0.559557855f},
-std::array<float,2>{0.842242718f, 0.47769326f},
-std::array<float,2>{0.774151444f, 0.942624509f},
-std::array<float,2>{0.456122637f, 0.220933482f},
-std::array<float,2>{0.117508881f, 0.651842475f},
-std::array<float,2>{0.528232098f, 0.326067716f},
-std::array<float,2>{0.674376011f, 0.62327069f},
-std::array<float,2>{0.144049287f, 0.415260106f},
-std::array<float,2>{0.325476468f, 0.838581085f},
-std::array<float,2>{0.887204885f, 0.088137731f},
-std::array<float,2>{0.905069292f, 0.572324574f},
-std::array<float,2>{0.329479963f, 0.402357459f},
-std::array<float,2>{0.133929834f, 0.858620822f},
-std::array<float,2>{0.667019486f, 0.0938322842f},
-std::array<float,2>{0.50144583f, 0.977565348f},
-std::array<float,2>{0.104558334f, 0.214543805f},
-std::array<float,2>{0.444895625f, 0.680071771f},
-std::array<float,2>{0.750572801f, 0.35969606f},
-std::array<float,2>{0.826347053f, 0.754414678f},
-std::array<float,2>{0.388374269f, 0.0554678477f},
-std::array<float,2>{0.00867448281f, 0.509836137f},
-std::array<float,2>{0.587880731f, 0.439463496f},
-std::array<float,2>{0.704332769f, 0.694482505f},
-std::array<float,2>{0.199745044f, 0.278602719f},
-std::array<float,2>{0.274194032f, 0.909298062f},
-std::array<float,2>{0.992431223f, 0.138014615f},
-std::array<float,2>{0.79599297f, 0.63501358f},
-std::array<float,2>{0.482718498f, 0.341333121f},
-std::array<float,2>{0.0803796276f, 0.963167667f},
-std::array<float,2>{0.5379287f, 0.246499315f},
-std::array<float,2>{0.643363655f, 0.824455559f},
-std::array<float,2>{0.157741934f, 0.0737767816f},
-std::array<float,2>{0.355427414f, 0.595018446f},
-std::array<float,2>{0.929998696f, 0.424748927f},
-std::array<float,2>{0.949120224f, 0.885175943f},
-std::array<float,2>{0.298529387f, 0.174892277f},
-std::array<float,2>{0.237832487f, 0.727300406f},
-std::array<float,2>{0.733349562f, 0.302106619f},
-std::array<float,2>{0.614839733f, 0.537735224f},
-std::array<float,2>{0.0508041568f, 0.49722597f},
-std::array<float,2>{0.417979658f, 0.793495297f},
-std::array<float,2>{0.852175713f, 0.0176448561f},
-std::array<float,2>{0.760523736f, 0.605285347f},
-std::array<float,2>{0.447250813f, 0.435499698f},
-std::array<float,2>{0.100189254f, 0.819426537f},
-std::array<float,2>{0.507974863f, 0.0696852505f},
-std::array<float,2>{0.662244022f, 0.955003619f},
-std::array<float,2>{0.126631737f, 0.240318686f},
-std::array<float,2>{0.341631442f, 0.625262439f},
-std::array<float,2>{0.892130077f, 0.334218204f},
-std::array<float,2>{0.985944688f, 0.787640452f},
-std::array<float,2>{0.272007227f, 0.0298392493f},
-std::array<float,2>{0.190738842f, 0.546013296f},
-std::array<float,2>{0.714672983f, 0.487734795f},
-std::array<float,2>{0.585579276f, 0.720936179f},
-std::array<float,2>{0.0070755356f, 0.308721274f},
-std::array<float,2>{0.377528608f, 0.87571758f},
-std::array<float,2>{0.81583935f, 0.185586959f},
-std::array<float,2>{0.92586118f, 0.67279017f},
-std::array<float,2>{0.349504203f, 0.367307574f},
-std::array<float,2>{0.16433914f, 0.972276032f},
-std::array<float,2>{0.654576838f, 0.20420666f},
-std::array<float,2>{0.545517385f, 0.846236527f},
-std::array<float,2>{0.0914839655f, 0.108300984f},
-std::array<float,2>{0.472529531f, 0.566448212f},
-std::array<float,2>{0.787000239f, 0.397259444f},
-std::array<float,2>{0.847440243f, 0.92015475f},
-std::array<float,2>{0.414037675f, 0.129682541f},
-std::array<float,2>{0.0555666499f, 0.69892168f},
-std::array<float,2>{0.620653391f, 0.266291261f},
-std::array<float,2>{0.723967135f, 0.50241226f},
-std::array<float,2>{0.244824514f, 0.445392758f},
-std::array<float,2>{0.309059769f, 0.76137203f},
-std::array<float,2>{0.941929162f, 0.0528335832f},
-std::array<float,2>{0.963839233f, 0.548449218f},
-std::array<float,2>{0.285229146f, 0.469946951f},
-std::array<float,2>{0.223085448f, 0.797034204f},
-std::array<float,2>{0.739305317f, 0.0132970912f},
-std::array<float,2>{0.60581553f, 0.893777728f},
-std::array<float,2>{0.0356057957f, 0.169715405f},
-std::array<float,2>{0.435043871f, 0.748594463f},
-std::array<float,2>{0.87103498f, 0.283552408f},
-std::array<float,2>{0.804764152f, 0.832483053f},
-std::array<float,2>{0.4864721f, 0.0795683041f},
-std::array<float,2>{0.0714285225f, 0.615761518f},
-std::array<float,2>{0.554647088f, 0.411895931f},
-std::array<float,2>{0.639848411f, 0.640980363f},
-std::array<float,2>{0.176677033f, 0.31510067f},
-std::array<float,2>{0.374167532f, 0.946494401f},
-std::array<float,2>{0.919776976f, 0.232029364f},
-std::array<float,2>{0.833941936f, 0.711391211f},
-std::array<float,2>{0.398854971f, 0.256507874f},
-std::array<float,2>{0.0281942822f, 0.927159727f},
-std::array<float,2>{0.568485558f, 0.154881686f},
-std::array<float,2>{0.700233936f, 0.76922828f},
-std::array<float,2>{0.214365333f, 0.0423383079f},
-std::array<float,2>{0.259152412f, 0.518398881f},
-std::array<float,2>{0.978181005f, 0.454765648f},
-std::array<float,2>{0.875484586f, 0.988180161f},
-std::array<float,2>{0.318735272f, 0.19852981f},
-std::array<float,2>{0.149745807f, 0.656685412f},
-std::array<float,2>{0.68187952f, 0.349310488f},
-std::array<float,2>{0.522574186f, 0.593637466f},
-std::array<float,2>{0.11123541f, 0.382003158f},
-std::array<float,2>{0.461603016f, 0.868410945f},
-std::array<float,2>{0.766297221f, 0.115174711f},
-std::array<float,2>{0.7591483f, 0.546151102f},
-std::array<float,2>{0.44731161f, 0.487352431f},
-std::array<float,2>{0.0994776711f, 0.78790158f},
-std::array<float,2>{0.511396646f, 0.0300848857f},
-std::array<float,2>{0.661001742f, 0.87582463f},
-std::array<float,2>{0.128517747f, 0.185843498f},
-std::array<float,2>{0.342020988f, 0.72118926f},
-std::array<float,2>{0.893788099f, 0.308856755f},
-std::array<float,2>{0.986717403f, 0.8197245f},
-std::array<float,2>{0.269558519f, 0.0695615411f},
-std::array<float,2>{0.189034909f, 0.605207145f},
-std::array<float,2>{0.711816251f, 0.435163319f},
-std::array<float,2>{0.583897471f, 0.625142217f},
-std::array<float,2>{0.00431147031f, 0.334432244f},
-std::array<float,2>{0.376646549f, 0.954668462f},
-std::array<float,2>{0.813400447f, 0.24066931f},
-std::array<float,2>{0.929661393f, 0.699149311f},
-std::array<float,2>{0.349840552f, 0.266449004f},
-std::array<float,2>{0.167088002f, 0.920248687f},
-std::array<float,2>{0.653922558f, 0.129510179f},
-std::array<float,2>{0.54447192f, 0.761536717f},
-std::array<float,2>{0.0919036046f, 0.0530295819f},
-std::array<float,2>{0.469259679f, 0.502145171f},
-std::array<float,2>{0.78747654f, 0.445603967f},
-std::array<float,2>{0.844579875f, 0.972484231f},
-std::array<float,2>{0.410543948f, 0.20442614f},
-std::array<float,2>{0.0569349565f, 0.672606766f},
-std::array<float,2>{0.618287921f, 0.367606074f},
-std::array<float,2>{0.726303756f, 0.566812754f},
-std::array<float,2>{0.242949143f, 0.397212327f},
-std::array<float,2>{0.311137319f, 0.84667176f},
-std::array<float,2>{0.943739951f, 0.108110823f},
-std::array<float,2>{0.960974157f, 0.616057932f},
-std::array<float,2>{0.288278639f, 0.411621541f},
-std::array<float,2>{0.224795341f, 0.832136393f},
-std::array<float,2>{0.741118073f, 0.0791924149f},
-std::array<float,2>{0.609207094f, 0.946635306f},
-std::array<float,2>{0.0371497646f, 0.232387558f},
-std::array<float,2>{0.437463045f, 0.640833795f},
-std::array<float,2>{0.868337154f, 0.315308541f},
-std::array<float,2>{0.808503509f, 0.797202408f},
-std::array<float,2>{0.485901833f, 0.0135030132f},
-std::array<float,2>{0.0740796998f, 0.548674107f},
-std::array<float,2>{0.552075803f, 0.47011438f},
-std::array<float,2>{0.637242913f, 0.748981714f},
-std::array<float,2>{0.177988783f, 0.283362716f},
-std::array<float,2>{0.371586025f, 0.893872857f},
-std::array<float,2>{0.921823263f, 0.16966565f},
-std::array<float,2>{0.834201396f, 0.656330943f},
-std::array<float,2>{0.401537567f, 0.349508584f},
-std::array<float,2>{0.030803496f, 0.987879157f},
-std::array<float,2>{0.567661524f, 0.198404387f},
-std::array<float,2>{0.701388657f, 0.868233085f},
-std::array<float,2>{0.211021096f, 0.114972696f},
-std::array<float,2>{0.260477692f, 0.593426645f},
-std::array<float,2>{0.978807271f, 0.382193953f},
-std::array<float,2>{0.877438903f, 0.926818907f},
-std::array<float,2>{0.318325758f, 0.155243665f},
-std::array<float,2>{0.152183622f, 0.710943818f},
-std::array<float,2>{0.680600703f, 0.256819397f},
-std::array<float,2>{0.521317601f, 0.518173158f},
-std::array<float,2>{0.112092003f, 0.454840302f},
-std::array<float,2>{0.464760125f, 0.76952368f},
-std::array<float,2>{0.767755389f, 0.0422349796f},
-std::array<float,2>{0.860420823f, 0.58371079f},
-std::array<float,2>{0.423540026f, 0.390613109f},
-std::array<float,2>{0.0395467132f, 0.862847984f},
-std::array<float,2>{0.598894298f, 0.123205043f},
-std::array<float,2>{0.747726917f, 0.993667841f},
-std::array<float,2>{0.233761832f, 0.187917784f},
-std::array<float,2>{0.289791256f, 0.669708014f},
-std::array<float,2>{0.960631251f, 0.353643626f},
-std::array<float,2>{0.913699448f, 0.774830759f},
-std::array<float,2>{0.36195311f, 0.0382622965f},
-std::array<float,2>{0.181505397f, 0.52769202f},
-std::array<float,2>{0.627945364f, 0.46094507f},
-std::array<float,2>{0.556640625f, 0.703804374f},
-std::array<float,2>{0.0671786517f, 0.262729347f},
-std::array<float,2>{0.494555712f, 0.93319422f},
-std::array<float,2>{0.797298908f, 0.144724205f},
-std::array<float,2>{0.973754644f, 0.651590526f},
-std::array<float,2>{0.256167978f, 0.32592088f},
-std::array<float,2>{0.204042122f, 0.942769051f},
-std::array<float,2>{0.694098055f, 0.221145555f},
-std::array<float,2>{0.572513998f, 0.838753402f},
-std::array<float,2>{0.0220625196f, 0.0879398957f},
-std::array<float,2>{0.395281047f, 0.623422027f},
-std::array<float,2>{0.84135294f, 0.415338725f},
-std::array<float,2>{0.776087701f, 0.899769068f},
-std::array<float,2>{0.454556793f, 0.159865379f},
-std::array<float,2>{0.119335219f, 0.73971945f},
-std::array<float,2>{0.530306578f, 0.293445379f},
-std::array<float,2>{0.673094392f, 0.559209168f},
-std::array<float,2>{0.141901612f, 0.477823079f},
-std::array<float,2>{0.327558547f, 0.806200445f},
-std::array<float,2>{0.889010251f, 0.00314168748f},
-std::array<float,2>{0.903070629f, 0.510121405f},
-std::array<float,2>{0.33148396f, 0.43990916f},
-std::array<float,2>{0.135209784f, 0.754665077f},
-std::array<float,2>{0.665054858f, 0.0552409664f},
-std::array<float,2>{0.503275156f, 0.909584343f},
-std::array<float,2>{0.102350652f, 0.137930363f},
-std::array<float,2>{0.442005098f, 0.694799781f},
-std::array<float,2>{0.753605545f, 0.278385162f},
-std::array<float,2>{0.825003922f, 0.858771682f},
-std::array<float,2>{0.390237302f, 0.094016239f},
-std::array<float,2>{0.0113645438f, 0.572630644f},
-std::array<float,2>{0.589625299f, 0.402780294f},
-std::array<float,2>{0.706432343f, 0.679812253f},
-std::array<float,2>{0.202796191f, 0.359447241f},
-std::array<float,2>{0.277049631f, 0.977951765f},
-std::array<float,2>{0.99583751f, 0.214754879f},
-std::array<float,2>{0.794164717f, 0.727063477f},
-std::array<float,2>{0.480997443f, 0.301988333f},
-std::array<float,2>{0.0781375691f, 0.884913325f},
-std::array<float,2>{0.535477638f, 0.175173134f},
-std::array<float,2>{0.64108181f, 0.793844819f},
-std::array<float,2>{0.15907979f, 0.0179804079f},
-std::array<float,2>{0.353444308f, 0.538053453f},
-std::array<float,2>{0.933546901f, 0.497460037f},
-std::array<float,2>{0.946558118f, 0.962917984f},
-std::array<float,2>{0.300477833f, 0.246290848f},
-std::array<float,2>{0.235567063f, 0.634913921f},
-std::array<float,2>{0.731334031f, 0.341701508f},
-std::array<float,2>{0.61555171f, 0.594734132f},
-std::array<float,2>{0.053184852f, 0.424459785f},
-std::array<float,2>{0.421869427f, 0.824545979f},
-std::array<float,2>{0.853808999f, 0.074119091f},
-std::array<float,2>{0.816882849f, 0.526059926f},
-std::array<float,2>{0.382197618f, 0.465918392f},
-std::array<float,2>{0.00196034997f, 0.77990818f},
-std::array<float,2>{0.580480576f, 0.0317644216f},
-std::array<float,2>{0.715628684f, 0.933721185f},
-std::array<float,2>{0.192562297f, 0.142676115f},
-std::array<float,2>{0.269235939f, 0.707103908f},
-std::array<float,2>{0.992049098f, 0.258713067f},
-std::array<float,2>{0.898385704f, 0.864654839f},
-std::array<float,2>{0.338985562f, 0.118602291f},
-std::array<float,2>{0.131171718f, 0.579393208f},
-std::array<float,2>{0.658027589f, 0.384074986f},
-std::array<float,2>{0.512313366f, 0.666873097f},
-std::array<float,2>{0.0970313251f, 0.357647032f},
-std::array<float,2>{0.449800879f, 0.996601403f},
-std::array<float,2>{0.764464319f, 0.193773225f},
-std::array<float,2>{0.939133942f, 0.735025704f},
-std::array<float,2>{0.306753367f, 0.291484863f},
-std::array<float,2>{0.247321844f, 0.903088927f},
-std::array<float,2>{0.718811333f, 0.162255302f},
-std::array<float,2>{0.624907613f, 0.809007764f},
-std::array<float,2>{0.0592286214f, 0.00637573702f},
-std::array<float,2>{0.407672912f, 0.555633247f},
-std::array<float,2>{0.848812342f, 0.482095838f},
-std::array<float,2>{0.783216f, 0.940699041f},
-std::array<float,2>{0.473233461f, 0.225930512f},
-std::array<float,2>{0.0868513361f, 0.653966606f},
-std::array<float,2>{0.542041957f, 0.323374718f},
-std::array<float,2>{0.651592255f, 0.617817223f},
-std::array<float,2>{0.169150919f, 0.420809805f},
-std::array<float,2>{0.347168416f, 0.840109229f},
-std::array<float,2>{0.924523294f, 0.0934680179f},
-std::array<float,2>{0.917170346f, 0.575168908f},
-std::array<float,2>{0.369234562f, 0.4003461f},
-std::array<float,2>{0.174719572f, 0.854936123f},
-std::array<float,2>{0.635454714f, 0.100253426f},
-std::array<float,2>{0.548827946f, 0.982361317f},
-std::array<float,2>{0.0763124675f, 0.216554254f},
-std::array<float,2>{0.490737408f, 0.686493695f},
-std::array<float,2>{0.808854759f, 0.363345176f},
-std::array<float,2>{0.872771323f, 0.753441155f},
-std::array<float,2>{0.429977685f, 0.0615894236f},
-std::array<float,2>{0.0317103192f, 0.513681591f},
-std::array<float,2>{0.602416873f, 0.443639308f},
-std::array<float,2>{0.734818518f, 0.691292048f},
-std::array<float,2>{0.222184375f, 0.273521215f},
-std::array<float,2>{0.282841831f, 0.912523806f},
-std::array<float,2>{0.96531862f, 0.136206016f},
-std::array<float,2>{0.770363271f, 0.638103008f},
-std::array<float,2>{0.466273248f, 0.338578403f},
-std::array<float,2>{0.114563465f, 0.966596603f},
-std::array<float,2>{0.518556237f, 0.24311994f},
-std::array<float,2>{0.683995605f, 0.822040498f},
-std::array<float,2>{0.154751465f, 0.0767257512f},
-std::array<float,2>{0.312612295f, 0.597928941f},
-std::array<float,2>{0.881830573f, 0.428233981f},
-std::array<float,2>{0.983152986f, 0.889754117f},
-std::array<float,2>{0.263643354f, 0.175783873f},
-std::array<float,2>{0.215229154f, 0.731420934f},
-std::array<float,2>{0.696680248f, 0.299660712f},
-std::array<float,2>{0.563476264f, 0.531618655f},
-std::array<float,2>{0.0252373554f, 0.494661272f},
-std::array<float,2>{0.404844314f, 0.791492879f},
-std::array<float,2>{0.831168771f, 0.0198999085f},
-std::array<float,2>{0.802867651f, 0.6060974f},
-std::array<float,2>{0.497848272f, 0.432452679f},
-std::array<float,2>{0.066358991f, 0.814078569f},
-std::array<float,2>{0.560415387f, 0.0646661073f},
-std::array<float,2>{0.631120205f, 0.958623052f},
-std::array<float,2>{0.186125398f, 0.236347437f},
-std::array<float,2>{0.364840478f, 0.632223666f},
-std::array<float,2>{0.907590091f, 0.331134528f},
-std::array<float,2>{0.954137504f, 0.783023775f},
-std::array<float,2>{0.294503242f, 0.0257247873f},
-std::array<float,2>{0.228934795f, 0.539426327f},
-std::array<float,2>{0.744997978f, 0.490501732f},
-std::array<float,2>{0.595999539f, 0.72364682f},
-std::array<float,2>{0.0439955294f, 0.307098478f},
-std::array<float,2>{0.426215887f, 0.880301476f},
-std::array<float,2>{0.866120219f, 0.183061898f},
-std::array<float,2>{0.884544909f, 0.678039312f},
-std::array<float,2>{0.32164529f, 0.371754766f},
-std::array<float,2>{0.146843612f, 0.974036336f},
-std::array<float,2>{0.678709567f, 0.208870277f},
-std::array<float,2>{0.525452852f, 0.848158598f},
-std::array<float,2>{0.123680294f, 0.104359694f},
-std::array<float,2>{0.458994329f, 0.565336704f},
-std::array<float,2>{0.777757049f, 0.393669128f},
-std::array<float,2>{0.836966336f, 0.914269924f},
-std::array<float,2>{0.390629739f, 0.125414878f},
-std::array<float,2>{0.0184007864f, 0.702521324f},
-std::array<float,2>{0.577491224f, 0.273001701f},
-std::array<float,2>{0.690802693f, 0.505481541f},
-std::array<float,2>{0.208344772f, 0.449735403f},
-std::array<float,2>{0.250864297f, 0.763144553f},
-std::array<float,2>{0.969474792f, 0.0498333983f},
-std::array<float,2>{0.996964335f, 0.553018034f},
-std::array<float,2>{0.281097323f, 0.474595726f},
-std::array<float,2>{0.196477503f, 0.801616609f},
-std::array<float,2>{0.709104478f, 0.0104377354f},
-std::array<float,2>{0.591933906f, 0.894579828f},
-std::array<float,2>{0.0121926228f, 0.166665539f},
-std::array<float,2>{0.384023726f, 0.743276596f},
-std::array<float,2>{0.821280479f, 0.28757447f},
-std::array<float,2>{0.754475415f, 0.829346776f},
-std::array<float,2>{0.440242112f, 0.0847747177f},
-std::array<float,2>{0.108240314f, 0.610972583f},
-std::array<float,2>{0.507578075f, 0.408434451f},
-std::array<float,2>{0.670857489f, 0.645398021f},
-std::array<float,2>{0.139800906f, 0.318747371f},
-std::array<float,2>{0.334834397f, 0.951532423f},
-std::array<float,2>{0.898870111f, 0.227740243f},
-std::array<float,2>{0.858433068f, 0.716386318f},
-std::array<float,2>{0.415774226f, 0.251495361f},
-std::array<float,2>{0.0489655286f, 0.923532605f},
-std::array<float,2>{0.610952616f, 0.14866823f},
-std::array<float,2>{0.726695657f, 0.770601213f},
-std::array<float,2>{0.239202127f, 0.0465100333f},
-std::array<float,2>{0.30398789f, 0.522794902f},
-std::array<float,2>{0.952386856f, 0.458451718f},
-std::array<float,2>{0.935070753f, 0.989021659f},
-std::array<float,2>{0.357509404f, 0.199468449f},
-std::array<float,2>{0.163103625f, 0.661564589f},
-std::array<float,2>{0.647315919f, 0.345853776f},
-std::array<float,2>{0.532936692f, 0.586827397f},
-std::array<float,2>{0.0846606791f, 0.377416939f},
-std::array<float,2>{0.478672266f, 0.874411047f},
-std::array<float,2>{0.791139722f, 0.109899156f},
-std::array<float,2>{0.785673797f, 0.500096142f},
-std::array<float,2>{0.471514136f, 0.448497802f},
-std::array<float,2>{0.089993827f, 0.758267045f},
-std::array<float,2>{0.546845973f, 0.0510228425f},
-std::array<float,2>{0.655511856f, 0.91800952f},
-std::array<float,2>{0.165980995f, 0.132102206f},
-std::array<float,2>{0.348007858f, 0.695396125f},
-std::array<float,2>{0.927602649f, 0.268784344f},
-std::array<float,2>{0.942942262f, 0.845525026f},
-std::array<float,2>{0.309592873f, 0.106515452f},
-std::array<float,2>{0.245435059f, 0.569510043f},
-std::array<float,2>{0.723568976f, 0.395874202f},
-std::array<float,2>{0.619144559f, 0.6740821f},
-std::array<float,2>{0.0559473298f, 0.370715857f},
-std::array<float,2>{0.412446678f, 0.969615221f},
-std::array<float,2>{0.846148372f, 0.206993937f},
-std::array<float,2>{0.890650928f, 0.719387412f},
-std::array<float,2>{0.339846313f, 0.311117738f},
-std::array<float,2>{0.125354365f, 0.878826857f},
-std::array<float,2>{0.663146675f, 0.185480669f},
-std::array<float,2>{0.509635925f, 0.785748124f},
-std::array<float,2>{0.101466276f, 0.0277366247f},
-std::array<float,2>{0.445478678f, 0.543503106f},
-std::array<float,2>{0.761349559f, 0.484403402f},
-std::array<float,2>{0.814655423f, 0.956128776f},
-std::array<float,2>{0.378052235f, 0.23942633f},
-std::array<float,2>{0.00595018314f, 0.627280116f},
-std::array<float,2>{0.584555447f, 0.333474517f},
-std::array<float,2>{0.713841975f, 0.603016138f},
-std::array<float,2>{0.189486846f, 0.436457455f},
-std::array<float,2>{0.27282384f, 0.818279088f},
-std::array<float,2>{0.984874964f, 0.0671212003f},
-std::array<float,2>{0.977385402f, 0.591584325f},
-std::array<float,2>{0.258512288f, 0.379063845f},
-std::array<float,2>{0.213482037f, 0.869234502f},
-std::array<float,2>{0.69988966f, 0.116766721f},
-std::array<float,2>{0.56986171f, 0.986055374f},
-std::array<float,2>{0.028823765f, 0.196152315f},
-std::array<float,2>{0.399549931f, 0.660031199f},
-std::array<float,2>{0.832057774f, 0.349626452f},
-std::array<float,2>{0.76674521f, 0.767452836f},
-std::array<float,2>{0.462077349f, 0.0404590666f},
-std::array<float,2>{0.110056929f, 0.515625298f},
-std::array<float,2>{0.521677852f, 0.455892473f},
-std::array<float,2>{0.683232069f, 0.713407099f},
-std::array<float,2>{0.148515567f, 0.254927307f},
-std::array<float,2>{0.320140123f, 0.929031372f},
-std::array<float,2>{0.876129448f, 0.152914941f},
-std::array<float,2>{0.869467735f, 0.643160403f},
-std::array<float,2>{0.434471428f, 0.312839329f},
-std::array<float,2>{0.0368452072f, 0.948630512f},
-std::array<float,2>{0.606876493f, 0.234342724f},
-std::array<float,2>{0.739164412f, 0.834592402f},
-std::array<float,2>{0.224085763f, 0.0819213763f},
-std::array<float,2>{0.287081599f, 0.614214361f},
-std::array<float,2>{0.964684427f, 0.412915945f},
-std::array<float,2>{0.918851435f, 0.892055035f},
-std::array<float,2>{0.373636991f, 0.169988886f},
-std::array<float,2>{0.177727669f, 0.747743428f},
-std::array<float,2>{0.639367759f, 0.28168723f},
-std::array<float,2>{0.55309701f, 0.54946208f},
-std::array<float,2>{0.0711213052f, 0.471221864f},
-std::array<float,2>{0.487833261f, 0.799459934f},
-std::array<float,2>{0.806354105f, 0.0149725666f},
-std::array<float,2>{0.843363702f, 0.621210635f},
-std::array<float,2>{0.396520764f, 0.417805165f},
-std::array<float,2>{0.0209878795f, 0.837590992f},
-std::array<float,2>{0.570312738f, 0.0864503905f},
-std::array<float,2>{0.692895949f, 0.945246994f},
-std::array<float,2>{0.205405146f, 0.219579309f},
-std::array<float,2>{0.254689038f, 0.649859369f},
-std::array<float,2>{0.975145996f, 0.327338189f},
-std::array<float,2>{0.88835001f, 0.808116257f},
-std::array<float,2>{0.324517161f, 2.3296303e-05f},
-std::array<float,2>{0.14351216f, 0.561073542f},
-std::array<float,2>{0.674823344f, 0.47974512f},
-std::array<float,2>{0.528364897f, 0.742184997f},
-std::array<float,2>{0.118694775f, 0.295520037f},
-std::array<float,2>{0.455161601f, 0.90097338f},
-std::array<float,2>{0.77457273f, 0.156344503f},
-std::array<float,2>{0.95860666f, 0.671532571f},
-std::array<float,2>{0.292016357f, 0.351825535f},
-std::array<float,2>{0.230551019f, 0.995311439f},
-std::array<float,2>{0.748183787f, 0.191405684f},
-std::array<float,2>{0.599789083f, 0.860270858f},
-std::array<float,2>{0.0428914316f, 0.122868158f},
-std::array<float,2>{0.424967349f, 0.584507883f},
-std::array<float,2>{0.862968922f, 0.38776952f},
-std::array<float,2>{0.799684823f, 0.931296527f},
-std::array<float,2>{0.493393987f, 0.147476375f},
-std::array<float,2>{0.0695734397f, 0.705333531f},
-std::array<float,2>{0.556265116f, 0.264894158f},
-std::array<float,2>{0.625142992f, 0.529434383f},
-std::array<float,2>{0.182410583f, 0.46423015f},
-std::array<float,2>{0.359808207f, 0.775661767f},
-std::array<float,2>{0.911026061f, 0.0368945748f},
-std::array<float,2>{0.931557238f, 0.536205113f},
-std::array<float,2>{0.353763372f, 0.498822808f},
-std::array<float,2>{0.156556949f, 0.796684921f},
-std::array<float,2>{0.644325018f, 0.0174879432f},
-std::array<float,2>{0.538429379f, 0.884705067f},
-std::array<float,2>{0.0814137533f, 0.173273101f},
-std::array<float,2>{0.483681858f, 0.729607463f},
-std::array<float,2>{0.794950128f, 0.30427742f},
-std::array<float,2>{0.852702141f, 0.826598585f},
-std::array<float,2>{0.419073373f, 0.0722152144f},
-std::array<float,2>{0.0520490259f, 0.597454727f},
-std::array<float,2>{0.614166915f, 0.422287166f},
-std::array<float,2>{0.734263599f, 0.633293509f},
-std::array<float,2>{0.236585498f, 0.342214078f},
-std::array<float,2>{0.297513217f, 0.962258637f},
-std::array<float,2>{0.947378933f, 0.249593243f},
-std::array<float,2>{0.751284301f, 0.691416919f},
-std::array<float,2>{0.444144189f, 0.280032516f},
-std::array<float,2>{0.103862673f, 0.906458378f},
-std::array<float,2>{0.500458956f, 0.139537975f},
-std::array<float,2>{0.666249156f, 0.757257581f},
-std::array<float,2>{0.133448482f, 0.0570787229f},
-std::array<float,2>{0.328633279f, 0.508445144f},
-std::array<float,2>{0.905571401f, 0.438829362f},
-std::array<float,2>{0.993750453f, 0.980230331f},
-std::array<float,2>{0.274431258f, 0.212327734f},
-std::array<float,2>{0.201024368f, 0.682375968f},
-std::array<float,2>{0.70324105f, 0.361961663f},
-std::array<float,2>{0.586862683f, 0.570424557f},
-std::array<float,2>{0.00900146645f, 0.405791491f},
-std::array<float,2>{0.38736999f, 0.856527627f},
-std::array<float,2>{0.827584088f, 0.0969010666f},
-std::array<float,2>{0.85074681f, 0.558363974f},
-std::array<float,2>{0.410051435f, 0.484262586f},
-std::array<float,2>{0.0609102696f, 0.810613453f},
-std::array<float,2>{0.62198025f, 0.00585907185f},
-std::array<float,2>{0.722551286f, 0.905784369f},
-std::array<float,2>{0.24819088f, 0.162025779f},
-std::array<float,2>{0.305600375f, 0.73638165f},
-std::array<float,2>{0.941275597f, 0.290153265f},
-std::array<float,2>{0.92218864f, 0.8417992f},
-std::array<float,2>{0.344779432f, 0.091011174f},
-std::array<float,2>{0.171705708f, 0.620804429f},
-std::array<float,2>{0.64908272f, 0.418890268f},
-std::array<float,2>{0.539218307f, 0.65495044f},
-std::array<float,2>{0.0879188925f, 0.320479959f},
-std::array<float,2>{0.474622309f, 0.938376546f},
-std::array<float,2>{0.781883717f, 0.223474264f},
-std::array<float,2>{0.988685906f, 0.70942992f},
-std::array<float,2>{0.266599566f, 0.261276335f},
-std::array<float,2>{0.19478178f, 0.936700642f},
-std::array<float,2>{0.718536377f, 0.141496599f},
-std::array<float,2>{0.580059707f, 0.778167486f},
-std::array<float,2>{0.000612848089f, 0.0338554941f},
-std::array<float,2>{0.37941277f, 0.523904026f},
-std::array<float,2>{0.819812238f, 0.468138725f},
-std::array<float,2>{0.763614058f, 0.999097407f},
-std::array<float,2>{0.452071398f, 0.192270547f},
-std::array<float,2>{0.0947887078f, 0.665093184f},
-std::array<float,2>{0.515184939f, 0.356500626f},
-std::array<float,2>{0.659758925f, 0.581236422f},
-std::array<float,2>{0.130387351f, 0.385064155f},
-std::array<float,2>{0.336776316f, 0.865787268f},
-std::array<float,2>{0.895329595f, 0.11970488f},
-std::array<float,2>{0.880377471f, 0.601347625f},
-std::array<float,2>{0.314467013f, 0.426406205f},
-std::array<float,2>{0.153900295f, 0.823875606f},
-std::array<float,2>{0.687017143f, 0.0745371729f},
-std::array<float,2>{0.516205013f, 0.968084574f},
-std::array<float,2>{0.116870597f, 0.244744167f},
-std::array<float,2>{0.467107773f, 0.640151262f},
-std::array<float,2>{0.772086978f, 0.337704569f},
-std::array<float,2>{0.828207374f, 0.789799988f},
-std::array<float,2>{0.40391466f, 0.0225996207f},
-std::array<float,2>{0.0269293077f, 0.533863902f},
-std::array<float,2>{0.56594038f, 0.493077636f},
-std::array<float,2>{0.697768331f, 0.73407644f},
-std::array<float,2>{0.217987701f, 0.297432274f},
-std::array<float,2>{0.264670163f, 0.88830024f},
-std::array<float,2>{0.98208648f, 0.179032192f},
-std::array<float,2>{0.811411738f, 0.685210645f},
-std::array<float,2>{0.490051836f, 0.365812391f},
-std::array<float,2>{0.0747002214f, 0.983925164f},
-std::array<float,2>{0.550190628f, 0.21764487f},
-std::array<float,2>{0.633730352f, 0.851802349f},
-std::array<float,2>{0.172124043f, 0.0988856405f},
-std::array<float,2>{0.367796004f, 0.576243222f},
-std::array<float,2>{0.914299726f, 0.401148319f},
-std::array<float,2>{0.968431294f, 0.910347879f},
-std::array<float,2>{0.283207119f, 0.134227931f},
-std::array<float,2>{0.219541028f, 0.688925505f},
-std::array<float,2>{0.737962663f, 0.276566684f},
-std::array<float,2>{0.605134487f, 0.51330775f},
-std::array<float,2>{0.0344006978f, 0.442836881f},
-std::array<float,2>{0.431751847f, 0.751559019f},
-std::array<float,2>{0.874147177f, 0.0594024174f},
-std::array<float,2>{0.780212939f, 0.564163327f},
-std::array<float,2>{0.457776189f, 0.391445577f},
-std::array<float,2>{0.122808568f, 0.851161778f},
-std::array<float,2>{0.524826169f, 0.102768458f},
-std::array<float,2>{0.675797999f, 0.97569555f},
-std::array<float,2>{0.14517802f, 0.209380284f},
-std::array<float,2>{0.323022872f, 0.677234113f},
-std::array<float,2>{0.884780824f, 0.37456876f},
-std::array<float,2>{0.972047925f, 0.76548171f},
-std::array<float,2>{0.252452284f, 0.0479909629f},
-std::array<float,2>{0.209607556f, 0.506723583f},
-std::array<float,2>{0.68807447f, 0.452743292f},
-std::array<float,2>{0.576140285f, 0.700868249f},
-std::array<float,2>{0.0163957123f, 0.270388186f},
-std::array<float,2>{0.393679798f, 0.916166008f},
-std::array<float,2>{0.839405894f, 0.126983598f},
-std::array<float,2>{0.908268452f, 0.630624175f},
-std::array<float,2>{0.366827607f, 0.328575909f},
-std::array<float,2>{0.184551224f, 0.959877312f},
-std::array<float,2>{0.62928164f, 0.234672695f},
-std::array<float,2>{0.562382936f, 0.814665914f},
-std::array<float,2>{0.0628242195f, 0.0630011335f},
-std::array<float,2>{0.498777986f, 0.607470572f},
-std::array<float,2>{0.801131904f, 0.430884063f},
-std::array<float,2>{0.864027143f, 0.881973267f},
-std::array<float,2>{0.427812606f, 0.180492744f},
-std::array<float,2>{0.046661213f, 0.726287961f},
-std::array<float,2>{0.59507066f, 0.306015164f},
-std::array<float,2>{0.743782103f, 0.542105079f},
-std::array<float,2>{0.22790572f, 0.489962459f},
-std::array<float,2>{0.295839012f, 0.783216596f},
-std::array<float,2>{0.956129909f, 0.0251783319f},
-std::array<float,2>{0.949483097f, 0.52029556f},
-std::array<float,2>{0.301542103f, 0.460908681f},
-std::array<float,2>{0.241745204f, 0.772616744f},
-std::array<float,2>{0.730016589f, 0.0448311344f},
-std::array<float,2>{0.612617671f, 0.924033582f},
-std::array<float,2>{0.0485517606f, 0.150434971f},
-std::array<float,2>{0.417451739f, 0.717368484f},
-std::array<float,2>{0.85586822f, 0.25249204f},
-std::array<float,2>{0.790065587f, 0.872192323f},
-std::array<float,2>{0.477925718f, 0.112197667f},
-std::array<float,2>{0.082667537f, 0.588661015f},
-std::array<float,2>{0.53500551f, 0.376248658f},
-std::array<float,2>{0.64466095f, 0.664054096f},
-std::array<float,2>{0.160964847f, 0.345200002f},
-std::array<float,2>{0.356227428f, 0.990838289f},
-std::array<float,2>{0.936355174f, 0.2017432f},
-std::array<float,2>{0.824003458f, 0.745644391f},
-std::array<float,2>{0.386460066f, 0.286260575f},
-std::array<float,2>{0.0141450865f, 0.896873534f},
-std::array<float,2>{0.591351092f, 0.164102167f},
-std::array<float,2>{0.708577037f, 0.803135574f},
-std::array<float,2>{0.198573679f, 0.00942505524f},
-std::array<float,2>{0.278276324f, 0.552332997f},
-std::array<float,2>{0.999929965f, 0.475274205f},
-std::array<float,2>{0.900705338f, 0.949840844f},
-std::array<float,2>{0.333618015f, 0.230151385f},
-std::array<float,2>{0.137105569f, 0.648281217f},
-std::array<float,2>{0.669283748f, 0.317372799f},
-std::array<float,2>{0.504223526f, 0.61296165f},
-std::array<float,2>{0.106087945f, 0.406475663f},
-std::array<float,2>{0.43874079f, 0.830383182f},
-std::array<float,2>{0.757681131f, 0.0836005509f},
-std::array<float,2>{0.769460678f, 0.517346084f},
-std::array<float,2>{0.463010192f, 0.456215113f},
-std::array<float,2>{0.112923503f, 0.76624918f},
-std::array<float,2>{0.520281076f, 0.039181415f},
-std::array<float,2>{0.681472898f, 0.927926362f},
-std::array<float,2>{0.150921643f, 0.154281333f},
-std::array<float,2>{0.316761732f, 0.714069605f},
-std::array<float,2>{0.878107607f, 0.254881799f},
-std::array<float,2>{0.980333328f, 0.871076047f},
-std::array<float,2>{0.261547595f, 0.115629286f},
-std::array<float,2>{0.212127224f, 0.590281546f},
-std::array<float,2>{0.702497959f, 0.379971355f},
-std::array<float,2>{0.567150772f, 0.658378363f},
-std::array<float,2>{0.0294907913f, 0.350906044f},
-std::array<float,2>{0.400393456f, 0.984751761f},
-std::array<float,2>{0.835061967f, 0.19693473f},
-std::array<float,2>{0.920737207f, 0.746940851f},
-std::array<float,2>{0.372243285f, 0.283148885f},
-std::array<float,2>{0.179144442f, 0.890732169f},
-std::array<float,2>{0.638651013f, 0.171052724f},
-std::array<float,2>{0.550925255f, 0.800425172f},
-std::array<float,2>{0.0728137195f, 0.0145331779f},
-std::array<float,2>{0.485261351f, 0.550135374f},
-std::array<float,2>{0.807566524f, 0.472460538f},
-std::array<float,2>{0.867455304f, 0.947685659f},
-std::array<float,2>{0.43611744f, 0.233306661f},
-std::array<float,2>{0.0389409587f, 0.643816411f},
-std::array<float,2>{0.608392596f, 0.313934535f},
-std::array<float,2>{0.741331935f, 0.615171492f},
-std::array<float,2>{0.226427659f, 0.413253188f},
-std::array<float,2>{0.287131011f, 0.835724354f},
-std::array<float,2>{0.962801456f, 0.0808394477f},
-std::array<float,2>{0.945192277f, 0.568469167f},
-std::array<float,2>{0.312155694f, 0.394610733f},
-std::array<float,2>{0.244079247f, 0.843794763f},
-std::array<float,2>{0.724694073f, 0.106229454f},
-std::array<float,2>{0.6173805f, 0.970669866f},
-std::array<float,2>{0.0579665415f, 0.205837756f},
-std::array<float,2>{0.411960304f, 0.675565362f},
-std::array<float,2>{0.845422983f, 0.36961928f},
-std::array<float,2>{0.788812399f, 0.759549201f},
-std::array<float,2>{0.470063686f, 0.0523901433f},
-std::array<float,2>{0.0930435658f, 0.501253307f},
-std::array<float,2>{0.543366492f, 0.448018402f},
-std::array<float,2>{0.652539909f, 0.696336091f},
-std::array<float,2>{0.166118994f, 0.268345177f},
-std::array<float,2>{0.35060671f, 0.919685602f},
-std::array<float,2>{0.927874804f, 0.1309845f},
-std::array<float,2>{0.813608706f, 0.628352761f},
-std::array<float,2>{0.375771999f, 0.332680941f},
-std::array<float,2>{0.00546904933f, 0.955681086f},
-std::array<float,2>{0.582513452f, 0.23860833f},
-std::array<float,2>{0.712091088f, 0.816689849f},
-std::array<float,2>{0.188410327f, 0.0681818575f},
-std::array<float,2>{0.271374345f, 0.602431655f},
-std::array<float,2>{0.987356007f, 0.437161148f},
-std::array<float,2>{0.893190205f, 0.877882004f},
-std::array<float,2>{0.343655467f, 0.183894336f},
-std::array<float,2>{0.127862886f, 0.720362306f},
-std::array<float,2>{0.66144371f, 0.311533064f},
-std::array<float,2>{0.510419548f, 0.544895589f},
-std::array<float,2>{0.0978053138f, 0.486234009f},
-std::array<float,2>{0.448368996f, 0.786177278f},
-std::array<float,2>{0.758383691f, 0.0283941403f},
-std::array<float,2>{0.855406761f, 0.596366346f},
-std::array<float,2>{0.42046538f, 0.423554093f},
-std::array<float,2>{0.0546537861f, 0.827712536f},
-std::array<float,2>{0.616528511f, 0.0705131069f},
-std::array<float,2>{0.732081831f, 0.961090803f},
-std::array<float,2>{0.234877661f, 0.248887986f},
-std::array<float,2>{0.299478203f, 0.633980632f},
-std::array<float,2>{0.946053863f, 0.342860609f},
-std::array<float,2>{0.932566345f, 0.79569602f},
-std::array<float,2>{0.351746559f, 0.0159662217f},
-std::array<float,2>{0.159308717f, 0.535328329f},
-std::array<float,2>{0.642141759f, 0.49954626f},
-std::array<float,2>{0.536692977f, 0.729230881f},
-std::array<float,2>{0.0795104951f, 0.302880794f},
-std::array<float,2>{0.482092202f, 0.882957995f},
-std::array<float,2>{0.793418407f, 0.172800004f},
-std::array<float,2>{0.994222701f, 0.683400929f},
-std::array<float,2>{0.27587375f, 0.362354159f},
-std::array<float,2>{0.201977387f, 0.97886616f},
-std::array<float,2>{0.705572248f, 0.211393297f},
-std::array<float,2>{0.588451087f, 0.85580188f},
-std::array<float,2>{0.0100664217f, 0.0957508981f},
-std::array<float,2>{0.389393866f, 0.571695089f},
-std::array<float,2>{0.825548291f, 0.405218035f},
-std::array<float,2>{0.752876639f, 0.907996833f},
-std::array<float,2>{0.443270683f, 0.139693961f},
-std::array<float,2>{0.103476375f, 0.69309628f},
-std::array<float,2>{0.502321899f, 0.280819893f},
-std::array<float,2>{0.664839625f, 0.509542465f},
-std::array<float,2>{0.135861114f, 0.437991142f},
-std::array<float,2>{0.330980957f, 0.75605303f},
-std::array<float,2>{0.904009581f, 0.0581751727f},
-std::array<float,2>{0.890474558f, 0.562086284f},
-std::array<float,2>{0.327079445f, 0.47895366f},
-std::array<float,2>{0.141427964f, 0.807322323f},
-std::array<float,2>{0.672467232f, 0.00104301772f},
-std::array<float,2>{0.529906809f, 0.902314484f},
-std::array<float,2>{0.121026777f, 0.157419771f},
-std::array<float,2>{0.453181595f, 0.740622699f},
-std::array<float,2>{0.776385784f, 0.29673174f},
-std::array<float,2>{0.840426207f, 0.836470246f},
-std::array<float,2>{0.39600414f, 0.0871274322f},
-std::array<float,2>{0.0224750564f, 0.622648716f},
-std::array<float,2>{0.573350072f, 0.416934073f},
-std::array<float,2>{0.694774389f, 0.648834944f},
-std::array<float,2>{0.204192713f, 0.327147692f},
-std::array<float,2>{0.257130891f, 0.943470955f},
-std::array<float,2>{0.973322451f, 0.219817519f},
-std::array<float,2>{0.79868418f, 0.706294715f},
-std::array<float,2>{0.49560979f, 0.264512062f},
-std::array<float,2>{0.0679780245f, 0.930080235f},
-std::array<float,2>{0.558304667f, 0.147299662f},
-std::array<float,2>{0.626958609f, 0.77684176f},
-std::array<float,2>{0.180145562f, 0.0355245024f},
-std::array<float,2>{0.362332314f, 0.530568779f},
-std::array<float,2>{0.912698746f, 0.463081479f},
-std::array<float,2>{0.959823132f, 0.994327724f},
-std::array<float,2>{0.290724158f, 0.189799652f},
-std::array<float,2>{0.233379021f, 0.670797884f},
-std::array<float,2>{0.746781945f, 0.353266001f},
-std::array<float,2>{0.598592877f, 0.585041344f},
-std::array<float,2>{0.0405623876f, 0.387287825f},
-std::array<float,2>{0.422241271f, 0.86075002f},
-std::array<float,2>{0.859796524f, 0.121160507f},
-std::array<float,2>{0.830268145f, 0.53475064f},
-std::array<float,2>{0.406147242f, 0.493556201f},
-std::array<float,2>{0.0243543684f, 0.790419221f},
-std::array<float,2>{0.563714445f, 0.0219262242f},
-std::array<float,2>{0.696255326f, 0.887637377f},
-std::array<float,2>{0.21585457f, 0.178514928f},
-std::array<float,2>{0.262248665f, 0.732701302f},
-std::array<float,2>{0.983398974f, 0.298583567f},
-std::array<float,2>{0.882397234f, 0.822430968f},
-std::array<float,2>{0.314404786f, 0.0753538981f},
-std::array<float,2>{0.155318275f, 0.59974587f},
-std::array<float,2>{0.68493706f, 0.4268139f},
-std::array<float,2>{0.518366039f, 0.638744235f},
-std::array<float,2>{0.113462262f, 0.33601433f},
-std::array<float,2>{0.465683192f, 0.967678964f},
-std::array<float,2>{0.77066505f, 0.245930672f},
-std::array<float,2>{0.966628492f, 0.688465774f},
-std::array<float,2>{0.282141834f, 0.276066065f},
-std::array<float,2>{0.221049488f, 0.91124332f},
-std::array<float,2>{0.736087263f, 0.133487687f},
-std::array<float,2>{0.602932274f, 0.750609696f},
-std::array<float,2>{0.0327229574f, 0.0598370172f},
-std::array<float,2>{0.431195676f, 0.51203382f},
-std::array<float,2>{0.871138215f, 0.441461623f},
-std::array<float,2>{0.810439587f, 0.98312062f},
-std::array<float,2>{0.491491288f, 0.218417779f},
-std::array<float,2>{0.078097038f, 0.683807015f},
-std::array<float,2>{0.547648191f, 0.367098391f},
-std::array<float,2>{0.63642031f, 0.578023672f},
-std::array<float,2>{0.175204501f, 0.402094424f},
-std::array<float,2>{0.370929986f, 0.853318095f},
-std::array<float,2>{0.916989267f, 0.0984834507f},
-std::array<float,2>{0.925382793f, 0.619623482f},
-std::array<float,2>{0.346019387f, 0.419311941f},
-std::array<float,2>{0.168147504f, 0.843068302f},
-std::array<float,2>{0.650900245f, 0.0905241072f},
-std::array<float,2>{0.541015923f, 0.938476682f},
-std::array<float,2>{0.0875569433f, 0.224311084f},
-std::array<float,2>{0.474566638f, 0.655892551f},
-std::array<float,2>{0.784227371f, 0.321574241f},
-std::array<float,2>{0.848007679f, 0.811733305f},
-std::array<float,2>{0.406287104f, 0.00476083718f},
-std::array<float,2>{0.0596090928f, 0.556779385f},
-std::array<float,2>{0.623549163f, 0.483102798f},
-std::array<float,2>{0.720151782f, 0.737841785f},
-std::array<float,2>{0.246358067f, 0.28977263f},
-std::array<float,2>{0.307824552f, 0.904533863f},
-std::array<float,2>{0.937566042f, 0.160998985f},
-std::array<float,2>{0.765030742f, 0.664445698f},
-std::array<float,2>{0.450752735f, 0.356158108f},
-std::array<float,2>{0.0961985737f, 0.998255432f},
-std::array<float,2>{0.513212502f, 0.193343699f},
-std::array<float,2>{0.656357229f, 0.86679095f},
-std::array<float,2>{0.131973073f, 0.120493695f},
-std::array<float,2>{0.337978244f, 0.580149412f},
-std::array<float,2>{0.89662534f, 0.386683643f},
-std::array<float,2>{0.990974128f, 0.936165631f},
-std::array<float,2>{0.267870098f, 0.142038286f},
-std::array<float,2>{0.191877902f, 0.710271716f},
-std::array<float,2>{0.716452777f, 0.259847015f},
-std::array<float,2>{0.581278026f, 0.524677217f},
-std::array<float,2>{0.00333679188f, 0.46721065f},
-std::array<float,2>{0.381291837f, 0.77877146f},
-std::array<float,2>{0.818048298f, 0.034453392f},
-std::array<float,2>{0.79253757f, 0.589414656f},
-std::array<float,2>{0.480189174f, 0.37513122f},
-std::array<float,2>{0.0850737318f, 0.871425033f},
-std::array<float,2>{0.531285226f, 0.112760738f},
-std::array<float,2>{0.647811115f, 0.991560996f},
-std::array<float,2>{0.162214145f, 0.202902094f},
-std::array<float,2>{0.358573049f, 0.662366152f},
-std::array<float,2>{0.93384099f, 0.343937486f},
-std::array<float,2>{0.951454401f, 0.772157729f},
-std::array<float,2>{0.303546846f, 0.0430369787f},
-std::array<float,2>{0.239646226f, 0.521389365f},
-std::array<float,2>{0.72799474f, 0.459216058f},
-std::array<float,2>{0.60953635f, 0.717786193f},
-std::array<float,2>{0.0506387576f, 0.253453851f},
-std::array<float,2>{0.414763004f, 0.925485849f},
-std::array<float,2>{0.857654572f, 0.152246982f},
-std::array<float,2>{0.899910033f, 0.64721328f},
-std::array<float,2>{0.335270405f, 0.317985922f},
-std::array<float,2>{0.139377296f, 0.950778127f},
-std::array<float,2>{0.671495199f, 0.229098886f},
-std::array<float,2>{0.506190062f, 0.831818283f},
-std::array<float,2>{0.108518429f, 0.0828472748f},
-std::array<float,2>{0.440579593f, 0.611452878f},
-std::array<float,2>{0.755665481f, 0.408154964f},
-std::array<float,2>{0.82185173f, 0.898073614f},
-std::array<float,2>{0.383375496f, 0.16567044f},
-std::array<float,2>{0.0129737137f, 0.7447294f},
-std::array<float,2>{0.593338192f, 0.285466313f},
-std::array<float,2>{0.710596204f, 0.551399171f},
-std::array<float,2>{0.195435613f, 0.475901008f},
-std::array<float,2>{0.279870927f, 0.803894341f},
-std::array<float,2>{0.997815371f, 0.00783713162f},
-std::array<float,2>{0.969905853f, 0.507761359f},
-std::array<float,2>{0.251629591f, 0.451219767f},
-std::array<float,2>{0.207793579f, 0.763943732f},
-std::array<float,2>{0.690295517f, 0.0473227575f},
-std::array<float,2>{0.576402307f, 0.917571723f},
-std::array<float,2>{0.0190560408f, 0.127977386f},
-std::array<float,2>{0.392360121f, 0.699513376f},
-std::array<float,2>{0.836218536f, 0.27123636f},
-std::array<float,2>{0.778518677f, 0.850288928f},
-std::array<float,2>{0.460023761f, 0.101838872f},
-std::array<float,2>{0.124184236f, 0.563069105f},
-std::array<float,2>{0.527190208f, 0.392492384f},
-std::array<float,2>{0.679627895f, 0.675953329f},
-std::array<float,2>{0.147702709f, 0.373299479f},
-std::array<float,2>{0.320633471f, 0.974716008f},
-std::array<float,2>{0.883436263f, 0.210882574f},
-std::array<float,2>{0.866889775f, 0.725257754f},
-std::array<float,2>{0.427547246f, 0.305268466f},
-std::array<float,2>{0.0438823625f, 0.881223083f},
-std::array<float,2>{0.597066641f, 0.180908427f},
-std::array<float,2>{0.745271862f, 0.785064578f},
-std::array<float,2>{0.229885876f, 0.0238654502f},
-std::array<float,2>{0.293505251f, 0.541291952f},
-std::array<float,2>{0.953197062f, 0.489255488f},
-std::array<float,2>{0.906348646f, 0.960550129f},
-std::array<float,2>{0.363348514f, 0.235460564f},
-std::array<float,2>{0.186790437f, 0.629141867f},
-std::array<float,2>{0.632406056f, 0.329983622f},
-std::array<float,2>{0.559084296f, 0.608560681f},
-std::array<float,2>{0.0644849911f, 0.430336237f},
-std::array<float,2>{0.496645838f, 0.81640476f},
-std::array<float,2>{0.804385185f, 0.0636797696f},
-std::array<float,2>{0.805474639f, 0.546878338f},
-std::array<float,2>{0.487173438f, 0.469022453f},
-std::array<float,2>{0.071884051f, 0.798127234f},
-std::array<float,2>{0.553828835f, 0.012495256f},
-std::array<float,2>{0.640556216f, 0.893163383f},
-std::array<float,2>{0.17604214f, 0.168632776f},
-std::array<float,2>{0.374886036f, 0.749516547f},
-std::array<float,2>{0.919332266f, 0.284621626f},
-std::array<float,2>{0.963044763f, 0.833229125f},
-std::array<float,2>{0.286051422f, 0.0789179876f},
-std::array<float,2>{0.223532677f, 0.616671562f},
-std::array<float,2>{0.739955366f, 0.411056101f},
-std::array<float,2>{0.606129825f, 0.642463505f},
-std::array<float,2>{0.0359088928f, 0.31559065f},
-std::array<float,2>{0.435521871f, 0.945983648f},
-std::array<float,2>{0.870193541f, 0.230598465f},
-std::array<float,2>{0.87569207f, 0.712545693f},
-std::array<float,2>{0.319096297f, 0.257692933f},
-std::array<float,2>{0.14992407f, 0.926484048f},
-std::array<float,2>{0.682357252f, 0.155418411f},
-std::array<float,2>{0.523337305f, 0.768316448f},
-std::array<float,2>{0.110372141f, 0.0418274067f},
-std::array<float,2>{0.461200356f, 0.518667698f},
-std::array<float,2>{0.765629292f, 0.45361349f},
-std::array<float,2>{0.833467841f, 0.986955225f},
-std::array<float,2>{0.399328023f, 0.198020726f},
-std::array<float,2>{0.0274286848f, 0.657586873f},
-std::array<float,2>{0.569115937f, 0.348169565f},
-std::array<float,2>{0.700859547f, 0.591960371f},
-std::array<float,2>{0.214102507f, 0.381764054f},
-std::array<float,2>{0.259414792f, 0.868026018f},
-std::array<float,2>{0.977897644f, 0.114195786f},
-std::array<float,2>{0.985568404f, 0.604029536f},
-std::array<float,2>{0.271808773f, 0.434492648f},
-std::array<float,2>{0.191305146f, 0.818664551f},
-std::array<float,2>{0.713890195f, 0.0688959509f},
-std::array<float,2>{0.585023105f, 0.95321095f},
-std::array<float,2>{0.00775053026f, 0.241892084f},
-std::array<float,2>{0.376990259f, 0.626097083f},
-std::array<float,2>{0.816138506f, 0.335298687f},
-std::array<float,2>{0.759898722f, 0.789035678f},
-std::array<float,2>{0.446564257f, 0.0308116637f},
-std::array<float,2>{0.100047961f, 0.544956744f},
-std::array<float,2>{0.508626699f, 0.487109184f},
-std::array<float,2>{0.6628232f, 0.721697807f},
-std::array<float,2>{0.12640135f, 0.310419291f},
-std::array<float,2>{0.341143548f, 0.876897335f},
-std::array<float,2>{0.891772747f, 0.187063634f},
-std::array<float,2>{0.846773148f, 0.673749387f},
-std::array<float,2>{0.413131773f, 0.368537247f},
-std::array<float,2>{0.0548866168f, 0.970982671f},
-std::array<float,2>{0.620377243f, 0.203750774f},
-std::array<float,2>{0.724340796f, 0.847067893f},
-std::array<float,2>{0.244195551f, 0.108594127f},
-std::array<float,2>{0.309207261f, 0.568356752f},
-std::array<float,2>{0.941821098f, 0.398432106f},
-std::array<float,2>{0.926420152f, 0.921700597f},
-std::array<float,2>{0.349094361f, 0.130467206f},
-std::array<float,2>{0.164579287f, 0.69762975f},
-std::array<float,2>{0.654890001f, 0.267064184f},
-std::array<float,2>{0.545139015f, 0.503131807f},
-std::array<float,2>{0.0910133943f, 0.446442276f},
-std::array<float,2>{0.471758157f, 0.760652006f},
-std::array<float,2>{0.786271095f, 0.0539569482f},
-std::array<float,2>{0.827096641f, 0.57331425f},
-std::array<float,2>{0.388142198f, 0.403676748f},
-std::array<float,2>{0.00802743901f, 0.857894838f},
-std::array<float,2>{0.586987913f, 0.0956009328f},
-std::array<float,2>{0.704947174f, 0.977112412f},
-std::array<float,2>{0.199368671f, 0.213745058f},
-std::array<float,2>{0.273841798f, 0.680952668f},
-std::array<float,2>{0.993083715f, 0.360461235f},
-std::array<float,2>{0.904773712f, 0.75541234f},
-std::array<float,2>{0.329648435f, 0.0557119623f},
-std::array<float,2>{0.134667397f, 0.510961294f},
-std::array<float,2>{0.667916715f, 0.441011876f},
-std::array<float,2>{0.501889348f, 0.693852425f},
-std::array<float,2>{0.1053949f, 0.278239578f},
-std::array<float,2>{0.444801837f, 0.908604801f},
-std::array<float,2>{0.750312626f, 0.136874497f},
-std::array<float,2>{0.948280454f, 0.63580364f},
-std::array<float,2>{0.298035085f, 0.340064615f},
-std::array<float,2>{0.237751484f, 0.964329422f},
-std::array<float,2>{0.732468247f, 0.24736546f},
-std::array<float,2>{0.61448437f, 0.826009154f},
-std::array<float,2>{0.0515619926f, 0.072843127f},
-std::array<float,2>{0.418598741f, 0.594299555f},
-std::array<float,2>{0.851925611f, 0.424978733f},
-std::array<float,2>{0.796394527f, 0.886545897f},
-std::array<float,2>{0.483180672f, 0.174395651f},
-std::array<float,2>{0.0807688534f, 0.727933288f},
-std::array<float,2>{0.53721875f, 0.301600128f},
-std::array<float,2>{0.642889738f, 0.538277984f},
-std::array<float,2>{0.15736191f, 0.496973455f},
-std::array<float,2>{0.354852021f, 0.794822097f},
-std::array<float,2>{0.93058008f, 0.0190537721f},
-std::array<float,2>{0.911347389f, 0.528788447f},
-std::array<float,2>{0.360712588f, 0.462775677f},
-std::array<float,2>{0.183524176f, 0.77359724f},
-std::array<float,2>{0.626493037f, 0.0372333564f},
-std::array<float,2>{0.554797709f, 0.931767166f},
-std::array<float,2>{0.0686526597f, 0.145775124f},
-std::array<float,2>{0.492538095f, 0.704327285f},
-std::array<float,2>{0.799941599f, 0.262640744f},
-std::array<float,2>{0.861537397f, 0.861652195f},
-std::array<float,2>{0.423920095f, 0.124344558f},
-std::array<float,2>{0.0412808247f, 0.582489848f},
-std::array<float,2>{0.601443946f, 0.388878763f},
-std::array<float,2>{0.749647379f, 0.668944776f},
-std::array<float,2>{0.231539235f, 0.355234146f},
-std::array<float,2>{0.291810781f, 0.992868066f},
-std::array<float,2>{0.957609355f, 0.189306527f},
-std::array<float,2>{0.773671627f, 0.738313496f},
-std::array<float,2>{0.457011312f, 0.294838637f},
-std::array<float,2>{0.117714956f, 0.899336696f},
-std::array<float,2>{0.527779162f, 0.159162357f},
-std::array<float,2>{0.67425257f, 0.805499136f},
-std::array<float,2>{0.144029662f, 0.00225919951f},
-std::array<float,2>{0.326139897f, 0.559576631f},
-std::array<float,2>{0.887536347f, 0.477145672f},
-std::array<float,2>{0.976048946f, 0.942252517f},
-std::array<float,2>{0.25536117f, 0.222307861f},
-std::array<float,2>{0.206694081f, 0.650432885f},
-std::array<float,2>{0.692317903f, 0.32442537f},
-std::array<float,2>{0.572046578f, 0.624675989f},
-std::array<float,2>{0.0202107802f, 0.414548755f},
-std::array<float,2>{0.397975028f, 0.839133263f},
-std::array<float,2>{0.842544556f, 0.0897098705f},
-std::array<float,2>{0.873477638f, 0.514915109f},
-std::array<float,2>{0.433361679f, 0.444784701f},
-std::array<float,2>{0.0332904197f, 0.75274229f},
-std::array<float,2>{0.604030252f, 0.0606442504f},
-std::array<float,2>{0.736694276f, 0.913149953f},
-std::array<float,2>{0.219820872f, 0.135232136f},
-std::array<float,2>{0.285020798f, 0.690376461f},
-std::array<float,2>{0.967601061f, 0.274859369f},
-std::array<float,2>{0.915777445f, 0.853858948f},
-std::array<float,2>{0.369067848f, 0.100717686f},
-std::array<float,2>{0.173226014f, 0.575555325f},
-std::array<float,2>{0.634345293f, 0.399012387f},
-std::array<float,2>{0.548838496f, 0.687280834f},
-std::array<float,2>{0.0754500777f, 0.364966691f},
-std::array<float,2>{0.488535821f, 0.980844796f},
-std::array<float,2>{0.811992764f, 0.215181589f},
-std::array<float,2>{0.980848551f, 0.731807888f},
-std::array<float,2>{0.264065295f, 0.29989332f},
-std::array<float,2>{0.217047408f, 0.889174283f},
-std::array<float,2>{0.698280632f, 0.17718555f},
-std::array<float,2>{0.565284133f, 0.792315125f},
-std::array<float,2>{0.0254933182f, 0.0205841698f},
-std::array<float,2>{0.40288797f, 0.532531381f},
-std::array<float,2>{0.830035567f, 0.495258182f},
-std::array<float,2>{0.772525012f, 0.965762615f},
-std::array<float,2>{0.468132198f, 0.243292898f},
-std::array<float,2>{0.1154484f, 0.637634099f},
-std::array<float,2>{0.517540097f, 0.33902669f},
-std::array<float,2>{0.686452687f, 0.599190712f},
-std::array<float,2>{0.153126359f, 0.429487854f},
-std::array<float,2>{0.316214502f, 0.821141779f},
-std::array<float,2>{0.879787028f, 0.0778252855f},
-std::array<float,2>{0.895665288f, 0.578911126f},
-std::array<float,2>{0.337073833f, 0.383336157f},
-std::array<float,2>{0.129266813f, 0.864177406f},
-std::array<float,2>{0.659055531f, 0.117291786f},
-std::array<float,2>{0.514028311f, 0.997293115f},
-std::array<float,2>{0.0944419056f, 0.194944918f},
-std::array<float,2>{0.452724338f, 0.667718589f},
-std::array<float,2>{0.762557387f, 0.358762622f},
-std::array<float,2>{0.819290161f, 0.781081855f},
-std::array<float,2>{0.380075902f, 0.0329039507f},
-std::array<float,2>{0.00125005865f, 0.527154088f},
-std::array<float,2>{0.578459561f, 0.465792775f},
-std::array<float,2>{0.71686095f, 0.708715856f},
-std::array<float,2>{0.194172457f, 0.258974522f},
-std::array<float,2>{0.26689598f, 0.934922874f},
-std::array<float,2>{0.990180671f, 0.144369736f},
-std::array<float,2>{0.782359302f, 0.652779162f},
-std::array<float,2>{0.475623071f, 0.322408348f},
-std::array<float,2>{0.0894362107f, 0.939937174f},
-std::array<float,2>{0.540704489f, 0.225570813f},
-std::array<float,2>{0.650007546f, 0.840840578f},
-std::array<float,2>{0.170316309f, 0.0919120014f},
-std::array<float,2>{0.344122201f, 0.618541658f},
-std::array<float,2>{0.92296344f, 0.420992613f},
-std::array<float,2>{0.94009459f, 0.903611898f},
-std::array<float,2>{0.305870324f, 0.163225561f},
-std::array<float,2>{0.24976781f, 0.735448003f},
-std::array<float,2>{0.720965266f, 0.292408973f},
-std::array<float,2>{0.622877777f, 0.555830181f},
-std::array<float,2>{0.0622473992f, 0.48060739f},
-std::array<float,2>{0.408924669f, 0.810278058f},
-std::array<float,2>{0.850273132f, 0.00769483531f},
-std::array<float,2>{0.756186008f, 0.609561503f},
-std::array<float,2>{0.438324392f, 0.409638375f},
-std::array<float,2>{0.106894411f, 0.828209937f},
-std::array<float,2>{0.505008936f, 0.0857805461f},
-std::array<float,2>{0.668477952f, 0.952767193f},
-std::array<float,2>{0.138437122f, 0.226867139f},
-std::array<float,2>{0.332043916f, 0.645570397f},
-std::array<float,2>{0.901910841f, 0.32022658f},
-std::array<float,2>{0.998678207f, 0.802213609f},
-std::array<float,2>{0.278769046f, 0.0114693306f},
-std::array<float,2>{0.197382286f, 0.55404985f},
-std::array<float,2>{0.707591057f, 0.473545939f},
-std::array<float,2>{0.590171158f, 0.742390335f},
-std::array<float,2>{0.0147229312f, 0.288227171f},
-std::array<float,2>{0.385337949f, 0.895946443f},
-std::array<float,2>{0.823059678f, 0.167281792f},
-std::array<float,2>{0.937454641f, 0.660370946f},
-std::array<float,2>{0.356967211f, 0.347178549f},
-std::array<float,2>{0.161632836f, 0.989316165f},
-std::array<float,2>{0.646039724f, 0.200357303f},
-std::array<float,2>{0.534170568f, 0.873273194f},
-std::array<float,2>{0.0839172974f, 0.111264125f},
-std::array<float,2>{0.477098703f, 0.587210178f},
-std::array<float,2>{0.789498866f, 0.378233582f},
-std::array<float,2>{0.857070029f, 0.922357321f},
-std::array<float,2>{0.416146219f, 0.150329649f},
-std::array<float,2>{0.0473216102f, 0.71573925f},
-std::array<float,2>{0.612001956f, 0.25050351f},
-std::array<float,2>{0.729343712f, 0.522427499f},
-std::array<float,2>{0.24101755f, 0.457042456f},
-std::array<float,2>{0.302234739f, 0.77012229f},
-std::array<float,2>{0.950313866f, 0.0449626632f},
-std::array<float,2>{0.955242872f, 0.540840745f},
-std::array<float,2>{0.296606421f, 0.491828591f},
-std::array<float,2>{0.227218643f, 0.781651199f},
-std::array<float,2>{0.742838681f, 0.0272543952f},
-std::array<float,2>{0.594638288f, 0.879228294f},
-std::array<float,2>{0.0449383594f, 0.181833148f},
-std::array<float,2>{0.429094642f, 0.72289747f},
-std::array<float,2>{0.864968121f, 0.308314741f},
-std::array<float,2>{0.802121639f, 0.81258148f},
-std::array<float,2>{0.499232352f, 0.0662119016f},
-std::array<float,2>{0.0635102019f, 0.606924653f},
-std::array<float,2>{0.560773551f, 0.433173776f},
-std::array<float,2>{0.630794108f, 0.631663918f},
-std::array<float,2>{0.185153887f, 0.330395848f},
-std::array<float,2>{0.365600765f, 0.958001196f},
-std::array<float,2>{0.909406006f, 0.237447411f},
-std::array<float,2>{0.838560462f, 0.701719642f},
-std::array<float,2>{0.393151373f, 0.27221781f},
-std::array<float,2>{0.0172314495f, 0.915280998f},
-std::array<float,2>{0.575096846f, 0.126064241f},
-std::array<float,2>{0.689016819f, 0.761977494f},
-std::array<float,2>{0.210524961f, 0.049591668f},
-std::array<float,2>{0.253011942f, 0.50483346f},
-std::array<float,2>{0.971624374f, 0.451133758f},
-std::array<float,2>{0.886476994f, 0.973551214f},
-std::array<float,2>{0.323349953f, 0.207821831f},
-std::array<float,2>{0.145591676f, 0.679290891f},
-std::array<float,2>{0.677506864f, 0.373022914f},
-std::array<float,2>{0.523750246f, 0.565742552f},
-std::array<float,2>{0.121413268f, 0.39311114f},
-std::array<float,2>{0.458598137f, 0.849037588f},
-std::array<float,2>{0.780977368f, 0.104527578f},
-std::array<float,2>{0.777010977f, 0.560097516f},
-std::array<float,2>{0.453761876f, 0.476746112f},
-std::array<float,2>{0.120517939f, 0.80473274f},
-std::array<float,2>{0.529554904f, 0.00269490527f},
-std::array<float,2>{0.672186017f, 0.898549914f},
-std::array<float,2>{0.140763476f, 0.158638865f},
-std::array<float,2>{0.326557428f, 0.738876641f},
-std::array<float,2>{0.889693558f, 0.29420197f},
-std::array<float,2>{0.973037839f, 0.839520514f},
-std::array<float,2>{0.257505178f, 0.0889314041f},
-std::array<float,2>{0.204989806f, 0.624054968f},
-std::array<float,2>{0.695286512f, 0.414848506f},
-std::array<float,2>{0.574098766f, 0.651001811f},
-std::array<float,2>{0.0230107345f, 0.324820757f},
-std::array<float,2>{0.395681679f, 0.941440403f},
-std::array<float,2>{0.840032876f, 0.221835822f},
-std::array<float,2>{0.912412822f, 0.704912782f},
-std::array<float,2>{0.363127559f, 0.262100637f},
-std::array<float,2>{0.180583715f, 0.932462513f},
-std::array<float,2>{0.627532542f, 0.146029979f},
-std::array<float,2>{0.557826519f, 0.774128556f},
-std::array<float,2>{0.067524381f, 0.0379836336f},
-std::array<float,2>{0.495521277f, 0.529276133f},
-std::array<float,2>{0.798154593f, 0.462114543f},
-std::array<float,2>{0.860283196f, 0.992610395f},
-std::array<float,2>{0.422510326f, 0.188794091f},
-std::array<float,2>{0.040446315f, 0.668351948f},
-std::array<float,2>{0.598127067f, 0.354518592f},
-std::array<float,2>{0.746418536f, 0.582996368f},
-std::array<float,2>{0.232893661f, 0.389495939f},
-std::array<float,2>{0.290315747f, 0.862113595f},
-std::array<float,2>{0.959038377f, 0.124516636f},
-std::array<float,2>{0.945420444f, 0.593868613f},
-std::array<float,2>{0.299205929f, 0.425455272f},
-std::array<float,2>{0.234615907f, 0.82533592f},
-std::array<float,2>{0.731525779f, 0.0723496601f},
-std::array<float,2>{0.617185175f, 0.964434981f},
-std::array<float,2>{0.0540169738f, 0.247581616f},
-std::array<float,2>{0.420317888f, 0.636607468f},
-std::array<float,2>{0.854593933f, 0.340407729f},
-std::array<float,2>{0.793911397f, 0.794241548f},
-std::array<float,2>{0.481513828f, 0.0186509155f},
-std::array<float,2>{0.0797311962f, 0.538957179f},
-std::array<float,2>{0.536599815f, 0.496340424f},
-std::array<float,2>{0.641896665f, 0.72840631f},
-std::array<float,2>{0.159694359f, 0.301155746f},
-std::array<float,2>{0.352487206f, 0.88606298f},
-std::array<float,2>{0.93211329f, 0.174097061f},
-std::array<float,2>{0.825807273f, 0.681564093f},
-std::array<float,2>{0.388976544f, 0.360978365f},
-std::array<float,2>{0.0106305992f, 0.976897657f},
-std::array<float,2>{0.587926447f, 0.213354066f},
-std::array<float,2>{0.705138266f, 0.85798341f},
-std::array<float,2>{0.201233491f, 0.0951040536f},
-std::array<float,2>{0.276144713f, 0.574082017f},
-std::array<float,2>{0.995084763f, 0.404269278f},
-std::array<float,2>{0.903506577f, 0.908911526f},
-std::array<float,2>{0.330450296f, 0.137467191f},
-std::array<float,2>{0.136245042f, 0.693540215f},
-std::array<float,2>{0.66409868f, 0.277742058f},
-std::array<float,2>{0.502487302f, 0.511654437f},
-std::array<float,2>{0.102988228f, 0.440816969f},
-std::array<float,2>{0.442466408f, 0.755041242f},
-std::array<float,2>{0.752034903f, 0.0564655811f},
-std::array<float,2>{0.844763756f, 0.567620158f},
-std::array<float,2>{0.411485732f, 0.397869349f},
-std::array<float,2>{0.0584711172f, 0.847456992f},
-std::array<float,2>{0.617839873f, 0.1093463f},
-std::array<float,2>{0.725252092f, 0.971677363f},
-std::array<float,2>{0.243255481f, 0.203527391f},
-std::array<float,2>{0.311985105f, 0.672901332f},
-std::array<float,2>{0.944801092f, 0.368809253f},
-std::array<float,2>{0.928670645f, 0.760166764f},
-std::array<float,2>{0.351451218f, 0.0546126813f},
-std::array<float,2>{0.16677165f, 0.503580332f},
-std::array<float,2>{0.6531775f, 0.446843326f},
-std::array<float,2>{0.543508589f, 0.698230207f},
-std::array<float,2>{0.09364409f, 0.267354757f},
-std::array<float,2>{0.470612228f, 0.92094928f},
-std::array<float,2>{0.788531363f, 0.130290747f},
-std::array<float,2>{0.987940788f, 0.626524925f},
-std::array<float,2>{0.270782411f, 0.33570978f},
-std::array<float,2>{0.187742889f, 0.953940094f},
-std::array<float,2>{0.712874591f, 0.241555899f},
-std::array<float,2>{0.582643688f, 0.819285095f},
-std::array<float,2>{0.00501807174f, 0.0687815323f},
-std::array<float,2>{0.375329256f, 0.603622556f},
-std::array<float,2>{0.814056933f, 0.433885634f},
-std::array<float,2>{0.757875979f, 0.876329005f},
-std::array<float,2>{0.448868573f, 0.186603665f},
-std::array<float,2>{0.0983675644f, 0.722251713f},
-std::array<float,2>{0.509975016f, 0.309709936f},
-std::array<float,2>{0.66175127f, 0.545555115f},
-std::array<float,2>{0.12736769f, 0.486520559f},
-std::array<float,2>{0.343081146f, 0.788387477f},
-std::array<float,2>{0.892679393f, 0.030584503f},
-std::array<float,2>{0.878861547f, 0.519240797f},
-std::array<float,2>{0.317228198f, 0.453205973f},
-std::array<float,2>{0.150684088f, 0.767713308f},
-std::array<float,2>{0.680854499f, 0.0411121026f},
-std::array<float,2>{0.519980609f, 0.926235557f},
-std::array<float,2>{0.112699859f, 0.155814812f},
-std::array<float,2>{0.463805646f, 0.712326348f},
-std::array<float,2>{0.768800735f, 0.257120639f},
-std::array<float,2>{0.835595191f, 0.867674291f},
-std::array<float,2>{0.401304454f, 0.113664553f},
-std::array<float,2>{0.0299448892f, 0.592684269f},
-std::array<float,2>{0.566640735f, 0.381129801f},
-std::array<float,2>{0.702820957f, 0.658137619f},
-std::array<float,2>{0.212784618f, 0.347693056f},
-std::array<float,2>{0.260859549f, 0.986577511f},
-std::array<float,2>{0.979918659f, 0.197550178f},
-std::array<float,2>{0.80705452f, 0.749379456f},
-std::array<float,2>{0.484715104f, 0.284796715f},
-std::array<float,2>{0.072724238f, 0.892942667f},
-std::array<float,2>{0.551601231f, 0.168125853f},
-std::array<float,2>{0.637912452f, 0.798464f},
-std::array<float,2>{0.179282978f, 0.0117772622f},
-std::array<float,2>{0.372749835f, 0.547595441f},
-std::array<float,2>{0.920304f, 0.469292313f},
-std::array<float,2>{0.962381184f, 0.945717812f},
-std::array<float,2>{0.288007319f, 0.231360659f},
-std::array<float,2>{0.225869805f, 0.641895354f},
-std::array<float,2>{0.741748631f, 0.316169441f},
-std::array<float,2>{0.607750773f, 0.617000043f},
-std::array<float,2>{0.0382652953f, 0.410426885f},
-std::array<float,2>{0.435730606f, 0.833856344f},
-std::array<float,2>{0.868073821f, 0.0781711265f},
-std::array<float,2>{0.836533844f, 0.504393935f},
-std::array<float,2>{0.391812354f, 0.450505555f},
-std::array<float,2>{0.0186627842f, 0.762300968f},
-std::array<float,2>{0.57691282f, 0.0491807647f},
-std::array<float,2>{0.689758837f, 0.915692627f},
-std::array<float,2>{0.207216948f, 0.126653567f},
-std::array<float,2>{0.251393378f, 0.701245844f},
-std::array<float,2>{0.970504224f, 0.271633774f},
-std::array<float,2>{0.882846475f, 0.849440157f},
-std::array<float,2>{0.320917249f, 0.105345331f},
-std::array<float,2>{0.148292944f, 0.56609112f},
-std::array<float,2>{0.679171801f, 0.392896771f},
-std::array<float,2>{0.526561201f, 0.678903222f},
-std::array<float,2>{0.12468534f, 0.372135192f},
-std::array<float,2>{0.460535258f, 0.972763002f},
-std::array<float,2>{0.778886616f, 0.207399935f},
-std::array<float,2>{0.953807592f, 0.723182857f},
-std::array<float,2>{0.292970985f, 0.307838023f},
-std::array<float,2>{0.230038762f, 0.879689991f},
-std::array<float,2>{0.745630562f, 0.182364911f},
-std::array<float,2>{0.597198427f, 0.782130778f},
-std::array<float,2>{0.0433236547f, 0.0266349241f},
-std::array<float,2>{0.427146405f, 0.540040016f},
-std::array<float,2>{0.866307616f, 0.491615623f},
-std::array<float,2>{0.804183662f, 0.957162142f},
-std::array<float,2>{0.496167839f, 0.238003582f},
-std::array<float,2>{0.0650512055f, 0.631146133f},
-std::array<float,2>{0.558879852f, 0.331045628f},
-std::array<float,2>{0.632293224f, 0.607159674f},
-std::array<float,2>{0.187265426f, 0.43297559f},
-std::array<float,2>{0.363870084f, 0.813128054f},
-std::array<float,2>{0.907066405f, 0.0654637739f},
-std::array<float,2>{0.934481978f, 0.587840617f},
-std::array<float,2>{0.359362811f, 0.378845364f},
-std::array<float,2>{0.162630707f, 0.873703063f},
-std::array<float,2>{0.648166478f, 0.110597037f},
-std::array<float,2>{0.531864166f, 0.989874482f},
-std::array<float,2>{0.0856199861f, 0.200807422f},
-std::array<float,2>{0.479692787f, 0.661087692f},
-std::array<float,2>{0.792109013f, 0.346850067f},
-std::array<float,2>{0.858109176f, 0.770002663f},
-std::array<float,2>{0.414384335f, 0.0455796272f},
-std::array<float,2>{0.0501534864f, 0.521692395f},
-std::array<float,2>{0.610098124f, 0.45775789f},
-std::array<float,2>{0.728162229f, 0.715321243f},
-std::array<float,2>{0.240128666f, 0.250456333f},
-std::array<float,2>{0.30318746f, 0.922688723f},
-std::array<float,2>{0.952041626f, 0.149445415f},
-std::array<float,2>{0.754889905f, 0.646154523f},
-std::array<float,2>{0.441385627f, 0.319736958f},
-std::array<float,2>{0.109260112f, 0.952501178f},
-std::array<float,2>{0.506712139f, 0.227286771f},
-std::array<float,2>{0.671197593f, 0.829068422f},
-std::array<float,2>{0.138813749f, 0.0850597396f},
-std::array<float,2>{0.335494727f, 0.610274792f},
-std::array<float,2>{0.899448872f, 0.409670621f},
-std::array<float,2>{0.997330785f, 0.896175146f},
-std::array<float,2>{0.279426277f, 0.167883694f},
-std::array<float,2>{0.195896819f, 0.743138492f},
-std::array<float,2>{0.710087121f, 0.288973033f},
-std::array<float,2>{0.592926323f, 0.554670811f},
-std::array<float,2>{0.013653351f, 0.472833395f},
-std::array<float,2>{0.383029222f, 0.802492678f},
-std::array<float,2>{0.821595252f, 0.0109863738f},
-std::array<float,2>{0.784984231f, 0.618919373f},
-std::array<float,2>{0.474090844f, 0.421406806f},
-std::array<float,2>{0.0870154724f, 0.841688693f},
-std::array<float,2>{0.541778624f, 0.0927006453f},
-std::array<float,2>{0.650516212f, 0.939966738f},
-std::array<float,2>{0.168866247f, 0.224933788f},
-std::array<float,2>{0.346631706f, 0.652979851f},
-std::array<float,2>{0.925139368f, 0.322873056f},
-std::array<float,2>{0.938076377f, 0.809597135f},
-std::array<float,2>{0.30856055f, 0.00709083444f},
-std::array<float,2>{0.246643797f, 0.556397259f},
-std::array<float,2>{0.720409393f, 0.481020421f},
-std::array<float,2>{0.623203397f, 0.735876501f},
-std::array<float,2>{0.0601305552f, 0.292556018f},
-std::array<float,2>{0.406975031f, 0.904111505f},
-std::array<float,2>{0.848453462f, 0.163992375f},
-std::array<float,2>{0.897119701f, 0.667009592f},
-std::array<float,2>{0.33873257f, 0.359272718f},
-std::array<float,2>{0.132578537f, 0.997762263f},
-std::array<float,2>{0.656973004f, 0.194473624f},
-std::array<float,2>{0.513117075f, 0.863401711f},
-std::array<float,2>{0.095863916f, 0.117772117f},
-std::array<float,2>{0.450412273f, 0.578296781f},
-std::array<float,2>{0.765277207f, 0.382842511f},
-std::array<float,2>{0.817694485f, 0.935228467f},
-std::array<float,2>{0.381421834f, 0.143850848f},
-std::array<float,2>{0.00353536895f, 0.708271623f},
-std::array<float,2>{0.581836998f, 0.259331226f},
-std::array<float,2>{0.716197133f, 0.526598752f},
-std::array<float,2>{0.191914544f, 0.465079784f},
-std::array<float,2>{0.268520325f, 0.78046912f},
-std::array<float,2>{0.990497708f, 0.0326402262f},
-std::array<float,2>{0.984043956f, 0.533162475f},
-std::array<float,2>{0.261827707f, 0.495896608f},
-std::array<float,2>{0.216619521f, 0.792854786f},
-std::array<float,2>{0.695615292f, 0.0214330405f},
-std::array<float,2>{0.564312994f, 0.889032245f},
-std::array<float,2>{0.0234901011f, 0.177444279f},
-std::array<float,2>{0.40547663f, 0.731963098f},
-std::array<float,2>{0.830679238f, 0.300605178f},
-std::array<float,2>{0.771380007f, 0.82054913f},
-std::array<float,2>{0.464875758f, 0.0776017979f},
-std::array<float,2>{0.114141196f, 0.59906131f},
-std::array<float,2>{0.517971992f, 0.429174572f},
-std::array<float,2>{0.685284913f, 0.637052298f},
-std::array<float,2>{0.156177685f, 0.339501083f},
-std::array<float,2>{0.313924611f, 0.964915812f},
-std::array<float,2>{0.881926477f, 0.243819863f},
-std::array<float,2>{0.871915042f, 0.689924359f},
-std::array<float,2>{0.431130946f, 0.275389493f},
-std::array<float,2>{0.032388594f, 0.913773835f},
-std::array<float,2>{0.6031546f, 0.135577559f},
-std::array<float,2>{0.735679328f, 0.751986623f},
-std::array<float,2>{0.221452326f, 0.0613668934f},
-std::array<float,2>{0.281472087f, 0.515554845f},
-std::array<float,2>{0.965954304f, 0.445252448f},
-std::array<float,2>{0.916176319f, 0.981148422f},
-std::array<float,2>{0.37049979f, 0.215688005f},
-std::array<float,2>{0.175327972f, 0.687010407f},
-std::array<float,2>{0.635774374f, 0.364268333f},
-std::array<float,2>{0.547241509f, 0.575738311f},
-std::array<float,2>{0.0775195882f, 0.398887694f},
-std::array<float,2>{0.492123783f, 0.854252875f},
-std::array<float,2>{0.80977416f, 0.101087853f},
-std::array<float,2>{0.800730288f, 0.531045198f},
-std::array<float,2>{0.493014872f, 0.463466823f},
-std::array<float,2>{0.0689945444f, 0.77696234f},
-std::array<float,2>{0.555177867f, 0.0356526449f},
-std::array<float,2>{0.626124024f, 0.930595696f},
-std::array<float,2>{0.182806239f, 0.146807149f},
-std::array<float,2>{0.361010432f, 0.706926763f},
-std::array<float,2>{0.912003815f, 0.263882428f},
-std::array<float,2>{0.957517922f, 0.86092788f},
-std::array<float,2>{0.291081071f, 0.121788964f},
-std::array<float,2>{0.23221153f, 0.585795343f},
-std::array<float,2>{0.74920857f, 0.387104988f},
-std::array<float,2>{0.600929797f, 0.67023766f},
-std::array<float,2>{0.0419451781f, 0.352884591f},
-std::array<float,2>{0.424788535f, 0.995104134f},
-std::array<float,2>{0.862290978f, 0.190276355f},
-std::array<float,2>{0.88681215f, 0.741049051f},
-std::array<float,2>{0.325303257f, 0.296208948f},
-std::array<float,2>{0.144330069f, 0.901724041f},
-std::array<float,2>{0.67463553f, 0.158048645f},
-std::array<float,2>{0.528023899f, 0.806991994f},
-std::array<float,2>{0.117426492f, 0.00163898012f},
-std::array<float,2>{0.456493765f, 0.561843157f},
-std::array<float,2>{0.774308264f, 0.47926271f},
-std::array<float,2>{0.841973901f, 0.94415319f},
-std::array<float,2>{0.397536397f, 0.220348537f},
-std::array<float,2>{0.0199713204f, 0.64936173f},
-std::array<float,2>{0.571408927f, 0.326301098f},
-std::array<float,2>{0.691411495f, 0.62228328f},
-std::array<float,2>{0.206095129f, 0.416241407f},
-std::array<float,2>{0.255377024f, 0.83635819f},
-std::array<float,2>{0.976466298f, 0.0878268778f},
-std::array<float,2>{0.992468119f, 0.572172999f},
-std::array<float,2>{0.274123102f, 0.404668808f},
-std::array<float,2>{0.2000902f, 0.856339335f},
-std::array<float,2>{0.704386115f, 0.0966647938f},
-std::array<float,2>{0.587622643f, 0.979070246f},
-std::array<float,2>{0.00831463933f, 0.211645886f},
-std::array<float,2>{0.388648838f, 0.682998657f},
-std::array<float,2>{0.826439202f, 0.363056421f},
-std::array<float,2>{0.750815928f, 0.756762385f},
-std::array<float,2>{0.445307106f, 0.0577647649f},
-std::array<float,2>{0.104936086f, 0.508918643f},
-std::array<float,2>{0.501152813f, 0.437673539f},
-std::array<float,2>{0.66729033f, 0.692497611f},
-std::array<float,2>{0.134160906f, 0.280590355f},
-std::array<float,2>{0.329291046f, 0.907294869f},
-std::array<float,2>{0.904945016f, 0.140152842f},
-std::array<float,2>{0.852401853f, 0.634664536f},
-std::array<float,2>{0.418317795f, 0.343518347f},
-std::array<float,2>{0.0512176752f, 0.961621344f},
-std::array<float,2>{0.615170777f, 0.248442546f},
-std::array<float,2>{0.732920825f, 0.827180684f},
-std::array<float,2>{0.238175347f, 0.0711445212f},
-std::array<float,2>{0.298764408f, 0.59584868f},
-std::array<float,2>{0.948798954f, 0.423055202f},
-std::array<float,2>{0.929799259f, 0.883752346f},
-std::array<float,2>{0.355159819f, 0.172262505f},
-std::array<float,2>{0.158200741f, 0.728550494f},
-std::array<float,2>{0.643244147f, 0.303685188f},
-std::array<float,2>{0.537799776f, 0.535912991f},
-std::array<float,2>{0.0801694393f, 0.49951154f},
-std::array<float,2>{0.482573509f, 0.795239985f},
-std::array<float,2>{0.796235323f, 0.0162635278f},
-std::array<float,2>{0.815452039f, 0.601662159f},
-std::array<float,2>{0.377754539f, 0.436801434f},
-std::array<float,2>{0.00717290863f, 0.81704253f},
-std::array<float,2>{0.585707843f, 0.0674453452f},
-std::array<float,2>{0.71454531f, 0.955484152f},
-std::array<float,2>{0.190660536f, 0.239193156f},
-std::array<float,2>{0.272256285f, 0.628757656f},
-std::array<float,2>{0.986150026f, 0.332377732f},
-std::array<float,2>{0.892462075f, 0.786923468f},
-std::array<float,2>{0.34133029f, 0.0292174369f},
-std::array<float,2>{0.126721457f, 0.544056356f},
-std::array<float,2>{0.662590981f, 0.485619903f},
-std::array<float,2>{0.508185148f, 0.719839275f},
-std::array<float,2>{0.100482628f, 0.312051117f},
-std::array<float,2>{0.446873963f, 0.877082527f},
-std::array<float,2>{0.760289788f, 0.184394285f},
-std::array<float,2>{0.942330003f, 0.675211072f},
-std::array<float,2>{0.308762789f, 0.370042294f},
-std::array<float,2>{0.244940072f, 0.969849348f},
-std::array<float,2>{0.723869503f, 0.205425784f},
-std::array<float,2>{0.620910287f, 0.844240904f},
-std::array<float,2>{0.0553303286f, 0.105936006f},
-std::array<float,2>{0.413750082f, 0.568876445f},
-std::array<float,2>{0.847278297f, 0.39535901f},
-std::array<float,2>{0.786762893f, 0.919339955f},
-std::array<float,2>{0.472329408f, 0.131604746f},
-std::array<float,2>{0.091775164f, 0.697201848f},
-std::array<float,2>{0.545889437f, 0.267628372f},
-std::array<float,2>{0.654489279f, 0.501727521f},
-std::array<float,2>{0.164205998f, 0.44745338f},
-std::array<float,2>{0.349140525f, 0.759229898f},
-std::array<float,2>{0.926257849f, 0.0519525334f},
-std::array<float,2>{0.919478297f, 0.550535738f},
-std::array<float,2>{0.374359548f, 0.471978277f},
-std::array<float,2>{0.176447347f, 0.800015867f},
-std::array<float,2>{0.64010787f, 0.0138960229f},
-std::array<float,2>{0.554425478f, 0.891579568f},
-std::array<float,2>{0.0717035234f, 0.171672404f},
-std::array<float,2>{0.486659259f, 0.746384621f},
-std::array<float,2>{0.804998398f, 0.282605797f},
-std::array<float,2>{0.870624602f, 0.835244119f},
-std::array<float,2>{0.434640229f, 0.0803811997f},
-std::array<float,2>{0.0351920687f, 0.614364445f},
-std::array<float,2>{0.605682492f, 0.413677454f},
-std::array<float,2>{0.739545107f, 0.644242465f},
-std::array<float,2>{0.222758278f, 0.314262658f},
-std::array<float,2>{0.285454363f, 0.94813329f},
-std::array<float,2>{0.963585854f, 0.232509628f},
-std::array<float,2>{0.766370952f, 0.714387059f},
-std::array<float,2>{0.461815655f, 0.25422591f},
-std::array<float,2>{0.111032538f, 0.928393483f},
-std::array<float,2>{0.522885799f, 0.153409913f},
-std::array<float,2>{0.681918621f, 0.765824974f},
-std::array<float,2>{0.149612486f, 0.0399915203f},
-std::array<float,2>{0.318483263f, 0.517021358f},
-std::array<float,2>{0.875134706f, 0.456939876f},
-std::array<float,2>{0.978495002f, 0.984969556f},
-std::array<float,2>{0.258935362f, 0.196737826f},
-std::array<float,2>{0.214683145f, 0.659065306f},
-std::array<float,2>{0.700542152f, 0.351541936f},
-std::array<float,2>{0.568696558f, 0.590732872f},
-std::array<float,2>{0.0280448683f, 0.380715311f},
-std::array<float,2>{0.398491293f, 0.870381355f},
-std::array<float,2>{0.833706021f, 0.115870327f},
-std::array<float,2>{0.864317656f, 0.541802943f},
-std::array<float,2>{0.429452181f, 0.488517553f},
-std::array<float,2>{0.0455965884f, 0.78460145f},
-std::array<float,2>{0.593814194f, 0.0242421031f},
-std::array<float,2>{0.742359161f, 0.881565511f},
-std::array<float,2>{0.226739973f, 0.181156158f},
-std::array<float,2>{0.296086967f, 0.724770606f},
-std::array<float,2>{0.956000149f, 0.305127025f},
-std::array<float,2>{0.909698904f, 0.815560579f},
-std::array<float,2>{0.365741223f, 0.0641002953f},
-std::array<float,2>{0.184782043f, 0.609027565f},
-std::array<float,2>{0.630367994f, 0.430019528f},
-std::array<float,2>{0.561388433f, 0.629841566f},
-std::array<float,2>{0.0642335191f, 0.3295151f},
-std::array<float,2>{0.499962419f, 0.960089207f},
-std::array<float,2>{0.802292407f, 0.236313939f},
-std::array<float,2>{0.97076273f, 0.699837983f},
-std::array<float,2>{0.25383535f, 0.270511895f},
-std::array<float,2>{0.209990039f, 0.917298794f},
-std::array<float,2>{0.688529193f, 0.12888661f},
-std::array<float,2>{0.574479938f, 0.764201522f},
-std::array<float,2>{0.0166981462f, 0.0475269631f},
-std::array<float,2>{0.392716259f, 0.506892443f},
-std::array<float,2>{0.838006139f, 0.451736033f},
-std::array<float,2>{0.780627549f, 0.975129962f},
-std::array<float,2>{0.458194315f, 0.210248843f},
-std::array<float,2>{0.121938407f, 0.676281095f},
-std::array<float,2>{0.524098337f, 0.373583972f},
-std::array<float,2>{0.676899552f, 0.562751174f},
-std::array<float,2>{0.14636068f, 0.39188832f},
-std::array<float,2>{0.323944181f, 0.849681854f},
-std::array<float,2>{0.886022091f, 0.102087788f},
-std::array<float,2>{0.901536703f, 0.612158298f},
-std::array<float,2>{0.332876652f, 0.407669514f},
-std::array<float,2>{0.137782067f, 0.831234932f},
-std::array<float,2>{0.668019056f, 0.0824708641f},
-std::array<float,2>{0.505679727f, 0.950502276f},
-std::array<float,2>{0.107195906f, 0.228569195f},
-std::array<float,2>{0.437557667f, 0.646534145f},
-std::array<float,2>{0.756753027f, 0.317490906f},
-std::array<float,2>{0.822574914f, 0.804306269f},
-std::array<float,2>{0.385145575f, 0.0086272154f},
-std::array<float,2>{0.015433237f, 0.551112354f},
-std::array<float,2>{0.590698004f, 0.476324439f},
-std::array<float,2>{0.707486212f, 0.744269371f},
-std::array<float,2>{0.198009759f, 0.285760909f},
-std::array<float,2>{0.278833002f, 0.89779681f},
-std::array<float,2>{0.998256922f, 0.165205061f},
-std::array<float,2>{0.789991081f, 0.66276288f},
-std::array<float,2>{0.476876497f, 0.344618797f},
-std::array<float,2>{0.0831277892f, 0.991933405f},
-std::array<float,2>{0.533615172f, 0.202393815f},
-std::array<float,2>{0.645864069f, 0.871743858f},
-std::array<float,2>{0.161254063f, 0.113219589f},
-std::array<float,2>{0.356616318f, 0.589110672f},
-std::array<float,2>{0.936748087f, 0.375669092f},
-std::array<float,2>{0.950736105f, 0.924999893f},
-std::array<float,2>{0.302565277f, 0.151825458f},
-std::array<float,2>{0.240610391f, 0.718330503f},
-std::array<float,2>{0.728668094f, 0.253032833f},
-std::array<float,2>{0.611646354f, 0.520573616f},
-std::array<float,2>{0.0474667884f, 0.459660113f},
-std::array<float,2>{0.4166888f, 0.77179116f},
-std::array<float,2>{0.856928825f, 0.0435115173f},
-std::array<float,2>{0.761785626f, 0.580728352f},
-std::array<float,2>{0.452433705f, 0.386169106f},
-std::array<float,2>{0.0941038355f, 0.866357148f},
-std::array<float,2>{0.514283597f, 0.120980866f},
-std::array<float,2>{0.658586264f, 0.998967707f},
-std::array<float,2>{0.12941879f, 0.192519665f},
-std::array<float,2>{0.337412506f, 0.664643109f},
-std::array<float,2>{0.896121919f, 0.355604887f},
-std::array<float,2>{0.989740551f, 0.779200017f},
-std::array<float,2>{0.267483622f, 0.034961164f},
-std::array<float,2>{0.193538964f, 0.524996161f},
-std::array<float,2>{0.7173388f, 0.467476875f},
-std::array<float,2>{0.579020679f, 0.71082747f},
-std::array<float,2>{0.00158720848f, 0.260347366f},
-std::array<float,2>{0.380812407f, 0.936025023f},
-std::array<float,2>{0.818602085f, 0.142335385f},
-std::array<float,2>{0.923627794f, 0.655336022f},
-std::array<float,2>{0.344554245f, 0.321927041f},
-std::array<float,2>{0.170672521f, 0.939019263f},
-std::array<float,2>{0.649424076f, 0.223738804f},
-std::array<float,2>{0.540336847f, 0.843560159f},
-std::array<float,2>{0.0890372023f, 0.0900819302f},
-std::array<float,2>{0.476473361f, 0.620034575f},
-std::array<float,2>{0.782895386f, 0.419514507f},
-std::array<float,2>{0.849970996f, 0.905203283f},
-std::array<float,2>{0.408687979f, 0.160382658f},
-std::array<float,2>{0.0616314411f, 0.737492263f},
-std::array<float,2>{0.622390807f, 0.289529175f},
-std::array<float,2>{0.721300244f, 0.557396531f},
-std::array<float,2>{0.249323428f, 0.482843995f},
-std::array<float,2>{0.306274414f, 0.812174678f},
-std::array<float,2>{0.939910889f, 0.00419214135f},
-std::array<float,2>{0.96720922f, 0.512683511f},
-std::array<float,2>{0.284249693f, 0.442361474f},
-std::array<float,2>{0.220580772f, 0.750468254f},
-std::array<float,2>{0.737288892f, 0.0601917095f},
-std::array<float,2>{0.603975832f, 0.912033677f},
-std::array<float,2>{0.0339553133f, 0.13312307f},
-std::array<float,2>{0.432941824f, 0.687567592f},
-std::array<float,2>{0.87371558f, 0.275418133f},
-std::array<float,2>{0.812078297f, 0.852860093f},
-std::array<float,2>{0.489059955f, 0.0977463648f},
-std::array<float,2>{0.0761351213f, 0.577318966f},
-std::array<float,2>{0.549549282f, 0.40144828f},
-std::array<float,2>{0.633925378f, 0.684417784f},
-std::array<float,2>{0.173557162f, 0.36640507f},
-std::array<float,2>{0.36835286f, 0.982666314f},
-std::array<float,2>{0.915154278f, 0.218196213f},
-std::array<float,2>{0.829503715f, 0.733235955f},
-std::array<float,2>{0.402686477f, 0.297876894f},
-std::array<float,2>{0.0261535831f, 0.88695848f},
-std::array<float,2>{0.564733744f, 0.177942097f},
-std::array<float,2>{0.698842943f, 0.7905913f},
-std::array<float,2>{0.217637256f, 0.0223760046f},
-std::array<float,2>{0.264424443f, 0.5342682f},
-std::array<float,2>{0.980977058f, 0.493984252f},
-std::array<float,2>{0.879238427f, 0.967094421f},
-std::array<float,2>{0.31550914f, 0.245482922f},
-std::array<float,2>{0.15239206f, 0.639211237f},
-std::array<float,2>{0.68595767f, 0.336465746f},
-std::array<float,2>{0.516658187f, 0.600288868f},
-std::array<float,2>{0.11610686f, 0.427597165f},
-std::array<float,2>{0.468478739f, 0.823065341f},
-std::array<float,2>{0.77332902f, 0.0758127049f},
-std::array<float,2>{0.753383577f, 0.508248031f},
-std::array<float,2>{0.441613674f, 0.439013243f},
-std::array<float,2>{0.101702355f, 0.757809103f},
-std::array<float,2>{0.503843606f, 0.0575245768f},
-std::array<float,2>{0.665785551f, 0.907039404f},
-std::array<float,2>{0.135489225f, 0.138845816f},
-std::array<float,2>{0.331920385f, 0.692171037f},
-std::array<float,2>{0.902810812f, 0.279423177f},
-std::array<float,2>{0.995152891f, 0.857143998f},
-std::array<float,2>{0.276496977f, 0.0976551175f},
-std::array<float,2>{0.20237419f, 0.571154594f},
-std::array<float,2>{0.706655025f, 0.405278862f},
-std::array<float,2>{0.588960648f, 0.681821048f},
-std::array<float,2>{0.0111861881f, 0.361476362f},
-std::array<float,2>{0.390047133f, 0.97964114f},
-std::array<float,2>{0.824650466f, 0.212558627f},
-std::array<float,2>{0.932743967f, 0.730213881f},
-std::array<float,2>{0.352723718f, 0.304148912f},
-std::array<float,2>{0.158480301f, 0.883880138f},
-std::array<float,2>{0.641577899f, 0.173647583f},
-std::array<float,2>{0.536037505f, 0.796289742f},
-std::array<float,2>{0.0790439248f, 0.0169232953f},
-std::array<float,2>{0.480606675f, 0.536956787f},
-std::array<float,2>{0.79477632f, 0.498117238f},
-std::array<float,2>{0.854202628f, 0.962737918f},
-std::array<float,2>{0.421256304f, 0.249321207f},
-std::array<float,2>{0.053265892f, 0.633310616f},
-std::array<float,2>{0.616165519f, 0.342536658f},
-std::array<float,2>{0.730629027f, 0.59670192f},
-std::array<float,2>{0.235924274f, 0.422405183f},
-std::array<float,2>{0.299869329f, 0.8268888f},
-std::array<float,2>{0.946962595f, 0.0712965801f},
-std::array<float,2>{0.960385919f, 0.584319711f},
-std::array<float,2>{0.289098829f, 0.388471633f},
-std::array<float,2>{0.234293759f, 0.85950768f},
-std::array<float,2>{0.747321963f, 0.122449383f},
-std::array<float,2>{0.599520028f, 0.99572432f},
-std::array<float,2>{0.0396019593f, 0.190601632f},
-std::array<float,2>{0.423215121f, 0.670963466f},
-std::array<float,2>{0.861269593f, 0.352189332f},
-std::array<float,2>{0.797454059f, 0.776153386f},
-std::array<float,2>{0.494685292f, 0.0364102162f},
-std::array<float,2>{0.0664610043f, 0.530016899f},
-std::array<float,2>{0.557162702f, 0.464401364f},
-std::array<float,2>{0.628567576f, 0.705962777f},
-std::array<float,2>{0.180904657f, 0.265174508f},
-std::array<float,2>{0.361554682f, 0.930761516f},
-std::array<float,2>{0.913414776f, 0.148304746f},
-std::array<float,2>{0.841250122f, 0.65004462f},
-std::array<float,2>{0.394776613f, 0.327774316f},
-std::array<float,2>{0.0218475647f, 0.944411814f},
-std::array<float,2>{0.573234737f, 0.218912736f},
-std::array<float,2>{0.693366289f, 0.837198615f},
-std::array<float,2>{0.203140751f, 0.0860526562f},
-std::array<float,2>{0.256558269f, 0.62158978f},
-std::array<float,2>{0.974333704f, 0.417335063f},
-std::array<float,2>{0.889601767f, 0.900639951f},
-std::array<float,2>{0.327983826f, 0.157002822f},
-std::array<float,2>{0.14253062f, 0.741371751f},
-std::array<float,2>{0.673728108f, 0.295167089f},
-std::array<float,2>{0.530796468f, 0.560816348f},
-std::array<float,2>{0.119659513f, 0.480098367f},
-std::array<float,2>{0.454926223f, 0.807751417f},
-std::array<float,2>{0.775797009f, 0.000565416063f},
-std::array<float,2>{0.868657708f, 0.613733828f},
-std::array<float,2>{0.436541408f, 0.412133873f},
-std::array<float,2>{0.0376886092f, 0.834281921f},
-std::array<float,2>{0.60886991f, 0.0812870562f},
-std::array<float,2>{0.740617931f, 0.948774457f},
-std::array<float,2>{0.225314751f, 0.233729705f},
-std::array<float,2>{0.289048225f, 0.643039107f},
-std::array<float,2>{0.961672962f, 0.313221484f},
-std::array<float,2>{0.921187103f, 0.798987269f},
-std::array<float,2>{0.371257812f, 0.0152282426f},
-std::array<float,2>{0.178690225f, 0.548964024f},
-std::array<float,2>{0.636767983f, 0.471075535f},
-std::array<float,2>{0.552446306f, 0.747425318f},
-std::array<float,2>{0.0734381303f, 0.282106638f},
-std::array<float,2>{0.485769689f, 0.892549098f},
-std::array<float,2>{0.808029473f, 0.170863792f},
-std::array<float,2>{0.97935611f, 0.659582973f},
-std::array<float,2>{0.259855926f, 0.350420892f},
-std::array<float,2>{0.211475596f, 0.985576808f},
-std::array<float,2>{0.701850533f, 0.195458531f},
-std::array<float,2>{0.567932546f, 0.869795918f},
-std::array<float,2>{0.0305224974f, 0.116371848f},
-std::array<float,2>{0.402150899f, 0.591203332f},
-std::array<float,2>{0.834670484f, 0.379778713f},
-std::array<float,2>{0.768121898f, 0.929318786f},
-std::array<float,2>{0.464200795f, 0.152764678f},
-std::array<float,2>{0.111608289f, 0.713203192f},
-std::array<float,2>{0.520691037f, 0.255817682f},
-std::array<float,2>{0.679706216f, 0.516343415f},
-std::array<float,2>{0.151709288f, 0.455405891f},
-std::array<float,2>{0.31775859f, 0.766744852f},
-std::array<float,2>{0.877545297f, 0.0406487212f},
-std::array<float,2>{0.894454956f, 0.543109238f},
-std::array<float,2>{0.34276408f, 0.485175937f},
-std::array<float,2>{0.128048494f, 0.78536588f},
-std::array<float,2>{0.660305679f, 0.0282562692f},
-std::array<float,2>{0.511218667f, 0.878084183f},
-std::array<float,2>{0.0988846123f, 0.184652388f},
-std::array<float,2>{0.447898567f, 0.719049096f},
-std::array<float,2>{0.759451449f, 0.310587078f},
-std::array<float,2>{0.81255424f, 0.817825317f},
-std::array<float,2>{0.376143008f, 0.0667551532f},
-std::array<float,2>{0.00476770196f, 0.603194118f},
-std::array<float,2>{0.583451688f, 0.435880333f},
-std::array<float,2>{0.711351097f, 0.627593279f},
-std::array<float,2>{0.188561022f, 0.333921671f},
-std::array<float,2>{0.270103931f, 0.956816673f},
-std::array<float,2>{0.986831129f, 0.240156353f},
-std::array<float,2>{0.787854731f, 0.695918441f},
-std::array<float,2>{0.46876964f, 0.269405574f},
-std::array<float,2>{0.0922967196f, 0.918512106f},
-std::array<float,2>{0.544327021f, 0.132679999f},
-std::array<float,2>{0.653353095f, 0.758431792f},
-std::array<float,2>{0.167563736f, 0.0512995869f},
-std::array<float,2>{0.350199312f, 0.500893295f},
-std::array<float,2>{0.928765595f, 0.448804826f},
-std::array<float,2>{0.944228232f, 0.968968034f},
-std::array<float,2>{0.310667098f, 0.206077293f},
-std::array<float,2>{0.242653906f, 0.674671948f},
-std::array<float,2>{0.725958705f, 0.370581329f},
-std::array<float,2>{0.618889868f, 0.56988591f},
-std::array<float,2>{0.0575697795f, 0.396355718f},
-std::array<float,2>{0.410696834f, 0.84517473f},
-std::array<float,2>{0.844080389f, 0.107037261f},
-std::array<float,2>{0.820678055f, 0.552148938f},
-std::array<float,2>{0.384469122f, 0.4749358f},
-std::array<float,2>{0.0125018721f, 0.803622484f},
-std::array<float,2>{0.592310965f, 0.00897327531f},
-std::array<float,2>{0.709647834f, 0.897369325f},
-std::array<float,2>{0.197086707f, 0.164617956f},
-std::array<float,2>{0.280307293f, 0.745377183f},
-std::array<float,2>{0.996275485f, 0.286758959f},
-std::array<float,2>{0.898989677f, 0.830787599f},
-std::array<float,2>{0.334352911f, 0.083412312f},
-std::array<float,2>{0.140385225f, 0.612495363f},
-std::array<float,2>{0.67035377f, 0.40708822f},
-std::array<float,2>{0.507149041f, 0.647565007f},
-std::array<float,2>{0.107852817f, 0.316465884f},
-std::array<float,2>{0.43963787f, 0.949570477f},
-std::array<float,2>{0.754053175f, 0.22986567f},
-std::array<float,2>{0.953056395f, 0.717238247f},
-std::array<float,2>{0.304329008f, 0.252327323f},
-std::array<float,2>{0.238358244f, 0.924701571f},
-std::array<float,2>{0.727297664f, 0.150904968f},
-std::array<float,2>{0.61060077f, 0.773042798f},
-std::array<float,2>{0.0497708656f, 0.0443633981f},
-std::array<float,2>{0.415136218f, 0.51969105f},
-std::array<float,2>{0.859337449f, 0.460180938f},
-std::array<float,2>{0.791642845f, 0.990631998f},
-std::array<float,2>{0.479450017f, 0.201251149f},
-std::array<float,2>{0.084276706f, 0.66335851f},
-std::array<float,2>{0.532614172f, 0.34562102f},
-std::array<float,2>{0.646594703f, 0.588016868f},
-std::array<float,2>{0.163940638f, 0.376803517f},
-std::array<float,2>{0.358320832f, 0.872664213f},
-std::array<float,2>{0.934727132f, 0.111358024f},
-std::array<float,2>{0.90793854f, 0.607950211f},
-std::array<float,2>{0.364394009f, 0.431237489f},
-std::array<float,2>{0.185872167f, 0.81541872f},
-std::array<float,2>{0.631783307f, 0.0625733435f},
-std::array<float,2>{0.560038745f, 0.95906359f},
-std::array<float,2>{0.0655978173f, 0.234880865f},
-std::array<float,2>{0.497128218f, 0.630315959f},
-std::array<float,2>{0.803610384f, 0.328929186f},
-std::array<float,2>{0.865467608f, 0.783860385f},
-std::array<float,2>{0.426332891f, 0.0248600245f},
-std::array<float,2>{0.0447748527f, 0.542717695f},
-std::array<float,2>{0.59620899f, 0.489344507f},
-std::array<float,2>{0.744216621f, 0.725808322f},
-std::array<float,2>{0.229134321f, 0.306539804f},
-std::array<float,2>{0.294329196f, 0.882432818f},
-std::array<float,2>{0.955049276f, 0.179859579f},
-std::array<float,2>{0.778180718f, 0.677499294f},
-std::array<float,2>{0.45953995f, 0.374160171f},
-std::array<float,2>{0.123122267f, 0.976167381f},
-std::array<float,2>{0.525904357f, 0.209642544f},
-std::array<float,2>{0.6777789f, 0.850940824f},
-std::array<float,2>{0.147316664f, 0.1033061f},
-std::array<float,2>{0.322228551f, 0.563494325f},
-std::array<float,2>{0.884009004f, 0.390638441f},
-std::array<float,2>{0.969196618f, 0.916772664f},
-std::array<float,2>{0.250466734f, 0.127772719f},
-std::array<float,2>{0.208934903f, 0.700643182f},
-std::array<float,2>{0.6910671f, 0.269914269f},
-std::array<float,2>{0.577840567f, 0.506186187f},
-std::array<float,2>{0.0175784566f, 0.452260852f},
-std::array<float,2>{0.391234487f, 0.764687657f},
-std::array<float,2>{0.837643385f, 0.0486193225f},
-std::array<float,2>{0.809264779f, 0.576670766f},
-std::array<float,2>{0.490401775f, 0.40045622f},
-std::array<float,2>{0.0766716376f, 0.852367342f},
-std::array<float,2>{0.547867119f, 0.0991654843f},
-std::array<float,2>{0.634994328f, 0.983459175f},
-std::array<float,2>{0.174111709f, 0.217007414f},
-std::array<float,2>{0.370051622f, 0.684707284f},
-std::array<float,2>{0.917910337f, 0.365283906f},
-std::array<float,2>{0.965758622f, 0.751357138f},
-std::array<float,2>{0.282592177f, 0.0587464683f},
-std::array<float,2>{0.221746758f, 0.512856841f},
-std::array<float,2>{0.734960496f, 0.4433029f},
-std::array<float,2>{0.601842105f, 0.68903631f},
-std::array<float,2>{0.0321181677f, 0.277059138f},
-std::array<float,2>{0.430314064f, 0.910646856f},
-std::array<float,2>{0.872514606f, 0.13457787f},
-std::array<float,2>{0.881085515f, 0.639783382f},
-std::array<float,2>{0.313421905f, 0.337374538f},
-std::array<float,2>{0.154954687f, 0.968514681f},
-std::array<float,2>{0.684483171f, 0.244288892f},
-std::array<float,2>{0.519119799f, 0.823373616f},
-std::array<float,2>{0.115023308f, 0.0751872361f},
-std::array<float,2>{0.466572195f, 0.601035774f},
-std::array<float,2>{0.76963377f, 0.425925881f},
-std::array<float,2>{0.831863165f, 0.887759507f},
-std::array<float,2>{0.404638469f, 0.17940864f},
-std::array<float,2>{0.0246068723f, 0.733854115f},
-std::array<float,2>{0.562950432f, 0.296986878f},
-std::array<float,2>{0.696820796f, 0.53327167f},
-std::array<float,2>{0.215746075f, 0.492631853f},
-std::array<float,2>{0.263080567f, 0.789494336f},
-std::array<float,2>{0.98289907f, 0.0230810028f},
-std::array<float,2>{0.991385639f, 0.524320364f},
-std::array<float,2>{0.268644243f, 0.468497694f},
-std::array<float,2>{0.19288145f, 0.777783751f},
-std::array<float,2>{0.714907646f, 0.0335254632f},
-std::array<float,2>{0.580757856f, 0.937127292f},
-std::array<float,2>{0.00286186254f, 0.140658855f},
-std::array<float,2>{0.382709295f, 0.709945321f},
-std::array<float,2>{0.817355752f, 0.260789841f},
-std::array<float,2>{0.763898909f, 0.865371287f},
-std::array<float,2>{0.449548364f, 0.119285986f},
-std::array<float,2>{0.097355485f, 0.581655264f},
-std::array<float,2>{0.511796117f, 0.385333538f},
-std::array<float,2>{0.657643735f, 0.665989876f},
-std::array<float,2>{0.131761193f, 0.357343316f},
-std::array<float,2>{0.339820802f, 0.999809504f},
-std::array<float,2>{0.897792399f, 0.191523582f},
-std::array<float,2>{0.849193752f, 0.737077892f},
-std::array<float,2>{0.407860368f, 0.290548682f},
-std::array<float,2>{0.0588164702f, 0.905713141f},
-std::array<float,2>{0.624069214f, 0.161463439f},
-std::array<float,2>{0.719343901f, 0.81152153f},
-std::array<float,2>{0.247919559f, 0.00513519766f},
-std::array<float,2>{0.30720678f, 0.557740808f},
-std::array<float,2>{0.9388237f, 0.48374483f},
-std::array<float,2>{0.924120843f, 0.937624574f},
-std::array<float,2>{0.3469778f, 0.222700268f},
-std::array<float,2>{0.169450536f, 0.654325247f},
-std::array<float,2>{0.652299523f, 0.321056724f},
-std::array<float,2>{0.542869389f, 0.620276272f},
-std::array<float,2>{0.086100474f, 0.418035299f},
-std::array<float,2>{0.472769648f, 0.84270221f},
-std::array<float,2>{0.783761442f, 0.0914055482f},
-std::array<float,2>{0.795607269f, 0.537148178f},
-std::array<float,2>{0.483978748f, 0.49777329f},
-std::array<float,2>{0.0815459341f, 0.793408036f},
-std::array<float,2>{0.538767278f, 0.01845048f},
-std::array<float,2>{0.643915951f, 0.885562897f},
-std::array<float,2>{0.157218322f, 0.175736099f},
-std::array<float,2>{0.354007304f, 0.726653099f},
-std::array<float,2>{0.930984318f, 0.30260396f},
-std::array<float,2>{0.947884202f, 0.824827373f},
-std::array<float,2>{0.296907455f, 0.0734408572f},
-std::array<float,2>{0.237290114f, 0.595491588f},
-std::array<float,2>{0.733665824f, 0.42427215f},
-std::array<float,2>{0.613714516f, 0.635567665f},
-std::array<float,2>{0.0526920371f, 0.340863347f},
-std::array<float,2>{0.419607729f, 0.963390708f},
-std::array<float,2>{0.853343785f, 0.246826187f},
-std::array<float,2>{0.905878842f, 0.694877207f},
-std::array<float,2>{0.328260809f, 0.279077441f},
-std::array<float,2>{0.1328585f, 0.909903467f},
-std::array<float,2>{0.666552842f, 0.138666004f},
-std::array<float,2>{0.500512898f, 0.753933072f},
-std::array<float,2>{0.104361854f, 0.0547124036f},
-std::array<float,2>{0.443768024f, 0.510575652f},
-std::array<float,2>{0.751801848f, 0.440056205f},
-std::array<float,2>{0.827899337f, 0.978291929f},
-std::array<float,2>{0.387001425f, 0.214211598f},
-std::array<float,2>{0.0093359556f, 0.680612862f},
-std::array<float,2>{0.586144805f, 0.359924972f},
-std::array<float,2>{0.703853965f, 0.572792828f},
-std::array<float,2>{0.200581014f, 0.403064966f},
-std::array<float,2>{0.275105923f, 0.859145045f},
-std::array<float,2>{0.993216097f, 0.0942580625f},
-std::array<float,2>{0.974948287f, 0.623815715f},
-std::array<float,2>{0.254308909f, 0.415756822f},
-std::array<float,2>{0.205612287f, 0.83826822f},
-std::array<float,2>{0.69255513f, 0.0885212347f},
-std::array<float,2>{0.571169138f, 0.943319201f},
-std::array<float,2>{0.0210511182f, 0.22139664f},
-std::array<float,2>{0.396996409f, 0.652213514f},
-std::array<float,2>{0.842902303f, 0.325339079f},
-std::array<float,2>{0.775300086f, 0.805922806f},
-std::array<float,2>{0.455871314f, 0.00370663381f},
-std::array<float,2>{0.118253559f, 0.558990955f},
-std::array<float,2>{0.528879046f, 0.47828573f},
-std::array<float,2>{0.675599813f, 0.739861369f},
-std::array<float,2>{0.143025875f, 0.293532372f},
-std::array<float,2>{0.325042367f, 0.900290668f},
-std::array<float,2>{0.888036489f, 0.15945144f},
-std::array<float,2>{0.862692416f, 0.669179022f},
-std::array<float,2>{0.425640762f, 0.35437277f},
-std::array<float,2>{0.0421554856f, 0.993430018f},
-std::array<float,2>{0.600295484f, 0.188377559f},
-std::array<float,2>{0.748703003f, 0.862787902f},
-std::array<float,2>{0.231028989f, 0.123997286f},
-std::array<float,2>{0.292714238f, 0.583069146f},
-std::array<float,2>{0.958352387f, 0.389727205f},
-std::array<float,2>{0.910643041f, 0.932701886f},
-std::array<float,2>{0.359958977f, 0.145190224f},
-std::array<float,2>{0.181809679f, 0.703148305f},
-std::array<float,2>{0.625634313f, 0.263232082f},
-std::array<float,2>{0.555944324f, 0.528150976f},
-std::array<float,2>{0.0702380985f, 0.461853534f},
-std::array<float,2>{0.493854135f, 0.775287449f},
-std::array<float,2>{0.799157262f, 0.0388941169f},
-std::array<float,2>{0.832744598f, 0.593110681f},
-std::array<float,2>{0.399956703f, 0.38279134f},
-std::array<float,2>{0.0286102481f, 0.869110405f},
-std::array<float,2>{0.569555819f, 0.114639148f},
-std::array<float,2>{0.699569046f, 0.987614274f},
-std::array<float,2>{0.213339463f, 0.198895767f},
-std::array<float,2>{0.258049101f, 0.656823397f},
-std::array<float,2>{0.976568699f, 0.349037886f},
-std::array<float,2>{0.876939774f, 0.768843114f},
-std::array<float,2>{0.319375962f, 0.042689804f},
-std::array<float,2>{0.149231791f, 0.517679095f},
-std::array<float,2>{0.68294394f, 0.454269916f},
-std::array<float,2>{0.522356153f, 0.711736679f},
-std::array<float,2>{0.109737478f, 0.256248295f},
-std::array<float,2>{0.462783128f, 0.927704334f},
-std::array<float,2>{0.767286241f, 0.154756784f},
-std::array<float,2>{0.964018345f, 0.641450167f},
-std::array<float,2>{0.286263973f, 0.31468609f},
-std::array<float,2>{0.22454609f, 0.946923256f},
-std::array<float,2>{0.738590837f, 0.231871441f},
-std::array<float,2>{0.606963217f, 0.832917988f},
-std::array<float,2>{0.0365513489f, 0.080029957f},
-std::array<float,2>{0.433643579f, 0.615490437f},
-std::array<float,2>{0.869718015f, 0.411421597f},
-std::array<float,2>{0.806119442f, 0.894225121f},
-std::array<float,2>{0.487443358f, 0.169286564f},
-std::array<float,2>{0.0704577491f, 0.748372436f},
-std::array<float,2>{0.553581953f, 0.283892602f},
-std::array<float,2>{0.638855934f, 0.548157036f},
-std::array<float,2>{0.176795229f, 0.470403939f},
-std::array<float,2>{0.373259842f, 0.797771752f},
-std::array<float,2>{0.918415904f, 0.0131360209f},
-std::array<float,2>{0.926837742f, 0.502546549f},
-std::array<float,2>{0.348545551f, 0.446146488f},
-std::array<float,2>{0.165156856f, 0.761017561f},
-std::array<float,2>{0.655892015f, 0.0535126701f},
-std::array<float,2>{0.546256304f, 0.920691848f},
-std::array<float,2>{0.0903807655f, 0.129094705f},
-std::array<float,2>{0.471017987f, 0.698535442f},
-std::array<float,2>{0.785513818f, 0.266042024f},
-std::array<float,2>{0.846277595f, 0.845911622f},
-std::array<float,2>{0.412856519f, 0.107829556f},
-std::array<float,2>{0.0563139506f, 0.567043424f},
-std::array<float,2>{0.619886041f, 0.396809757f},
-std::array<float,2>{0.723035634f, 0.672044277f},
-std::array<float,2>{0.245680958f, 0.368109882f},
-std::array<float,2>{0.31032455f, 0.972126901f},
-std::array<float,2>{0.942575037f, 0.204724252f},
-std::array<float,2>{0.760746956f, 0.721332252f},
-std::array<float,2>{0.446288884f, 0.309086472f},
-std::array<float,2>{0.101035036f, 0.875268281f},
-std::array<float,2>{0.50906992f, 0.186165154f},
-std::array<float,2>{0.663751245f, 0.78714031f},
-std::array<float,2>{0.125758842f, 0.0297021512f},
-std::array<float,2>{0.340717793f, 0.546801746f},
-std::array<float,2>{0.891540766f, 0.48801446f},
-std::array<float,2>{0.984534621f, 0.954157233f},
-std::array<float,2>{0.273251057f, 0.240955517f},
-std::array<float,2>{0.190178752f, 0.625611782f},
-std::array<float,2>{0.713024378f, 0.334547877f},
-std::array<float,2>{0.584450483f, 0.604659855f},
-std::array<float,2>{0.00658966834f, 0.435002774f},
-std::array<float,2>{0.378637969f, 0.819987655f},
-std::array<float,2>{0.815076649f, 0.0698289722f},
-std::array<float,2>{0.856222749f, 0.523167908f},
-std::array<float,2>{0.417948008f, 0.458818942f},
-std::array<float,2>{0.04815064f, 0.771146595f},
-std::array<float,2>{0.613047779f, 0.0462857746f},
-std::array<float,2>{0.729721725f, 0.923067451f},
-std::array<float,2>{0.241626605f, 0.149229854f},
-std::array<float,2>{0.300819963f, 0.716174603f},
-std::array<float,2>{0.950102329f, 0.251425356f},
-std::array<float,2>{0.935795844f, 0.874873877f},
-std::array<float,2>{0.355778992f, 0.109377593f},
-std::array<float,2>{0.160518467f, 0.586059988f},
-std::array<float,2>{0.645324349f, 0.377483964f},
-std::array<float,2>{0.534253538f, 0.661906362f},
-std::array<float,2>{0.0822184235f, 0.346247911f},
-std::array<float,2>{0.478475273f, 0.988660574f},
-std::array<float,2>{0.790947437f, 0.199890777f},
-std::array<float,2>{0.999121785f, 0.74374783f},
-std::array<float,2>{0.277831316f, 0.287736207f},
-std::array<float,2>{0.199016616f, 0.895505369f},
-std::array<float,2>{0.708119452f, 0.166378513f},
-std::array<float,2>{0.591265082f, 0.80105418f},
-std::array<float,2>{0.0142867127f, 0.0100222891f},
-std::array<float,2>{0.38614437f, 0.553521156f},
-std::array<float,2>{0.823395133f, 0.474064261f},
-std::array<float,2>{0.757068038f, 0.952097476f},
-std::array<float,2>{0.439356148f, 0.228351086f},
-std::array<float,2>{0.105572119f, 0.644596159f},
-std::array<float,2>{0.504483581f, 0.319229782f},
-std::array<float,2>{0.669532835f, 0.610508025f},
-std::array<float,2>{0.137394696f, 0.408940583f},
-std::array<float,2>{0.33340016f, 0.829993367f},
-std::array<float,2>{0.901221275f, 0.0841683373f},
-std::array<float,2>{0.885702252f, 0.564653635f},
-std::array<float,2>{0.322342694f, 0.394085228f},
-std::array<float,2>{0.144739836f, 0.848134875f},
-std::array<float,2>{0.676467896f, 0.103729934f},
-std::array<float,2>{0.524929225f, 0.974259317f},
-std::array<float,2>{0.122108169f, 0.208443716f},
-std::array<float,2>{0.457434326f, 0.678344488f},
-std::array<float,2>{0.779547334f, 0.371174991f},
-std::array<float,2>{0.83909297f, 0.763420165f},
-std::array<float,2>{0.394319445f, 0.0505492799f},
-std::array<float,2>{0.0157369953f, 0.505329788f},
-std::array<float,2>{0.575388014f, 0.449311435f},
-std::array<float,2>{0.687624991f, 0.70287329f},
-std::array<float,2>{0.20926711f, 0.272806287f},
-std::array<float,2>{0.252347022f, 0.914979696f},
-std::array<float,2>{0.972478747f, 0.125859365f},
-std::array<float,2>{0.801629782f, 0.632786691f},
-std::array<float,2>{0.498059571f, 0.331567883f},
-std::array<float,2>{0.0634239465f, 0.95829761f},
-std::array<float,2>{0.561853468f, 0.23728472f},
-std::array<float,2>{0.629397213f, 0.813777506f},
-std::array<float,2>{0.184003875f, 0.0652129427f},
-std::array<float,2>{0.36627084f, 0.60591948f},
-std::array<float,2>{0.908733189f, 0.431913793f},
-std::array<float,2>{0.956803799f, 0.880787611f},
-std::array<float,2>{0.295128047f, 0.183275744f},
-std::array<float,2>{0.228136644f, 0.724322557f},
-std::array<float,2>{0.743590236f, 0.307432771f},
-std::array<float,2>{0.595685184f, 0.539756298f},
-std::array<float,2>{0.0461769179f, 0.491146088f},
-std::array<float,2>{0.428311437f, 0.782370031f},
-std::array<float,2>{0.863363445f, 0.0261761434f},
-std::array<float,2>{0.771874487f, 0.598327875f},
-std::array<float,2>{0.467758983f, 0.427831113f},
-std::array<float,2>{0.116557501f, 0.821653962f},
-std::array<float,2>{0.515692115f, 0.076437667f},
-std::array<float,2>{0.686961114f, 0.965896964f},
-std::array<float,2>{0.153537825f, 0.242324561f},
-std::array<float,2>{0.315344095f, 0.638386667f},
-std::array<float,2>{0.880277395f, 0.337938935f},
-std::array<float,2>{0.981703699f, 0.791976869f},
-std::array<float,2>{0.265282243f, 0.0204042196f},
-std::array<float,2>{0.21852915f, 0.5321154f},
-std::array<float,2>{0.69769007f, 0.494453698f},
-std::array<float,2>{0.565434694f, 0.730880857f},
-std::array<float,2>{0.0264474787f, 0.299135327f},
-std::array<float,2>{0.403675437f, 0.89058429f},
-std::array<float,2>{0.828855634f, 0.17644316f},
-std::array<float,2>{0.914568365f, 0.685813248f},
-std::array<float,2>{0.367281139f, 0.363882393f},
-std::array<float,2>{0.172666058f, 0.981463134f},
-std::array<float,2>{0.633052826f, 0.216010466f},
-std::array<float,2>{0.550709188f, 0.855023146f},
-std::array<float,2>{0.0748710781f, 0.0997733772f},
-std::array<float,2>{0.489324182f, 0.574502468f},
-std::array<float,2>{0.810638666f, 0.399602592f},
-std::array<float,2>{0.874654353f, 0.913011789f},
-std::array<float,2>{0.432186007f, 0.136455685f},
-std::array<float,2>{0.0348241366f, 0.690446973f},
-std::array<float,2>{0.604678273f, 0.274202585f},
-std::array<float,2>{0.737781107f, 0.514250696f},
-std::array<float,2>{0.218974665f, 0.443985134f},
-std::array<float,2>{0.284006089f, 0.753264725f},
-std::array<float,2>{0.968006134f, 0.0623424351f},
-std::array<float,2>{0.940545857f, 0.555152893f},
-std::array<float,2>{0.304963768f, 0.481788963f},
-std::array<float,2>{0.248868287f, 0.809531391f},
-std::array<float,2>{0.721813738f, 0.00622448325f},
-std::array<float,2>{0.62129581f, 0.902539134f},
-std::array<float,2>{0.0614356659f, 0.162942484f},
-std::array<float,2>{0.409432262f, 0.734403729f},
-std::array<float,2>{0.851433575f, 0.291731119f},
-std::array<float,2>{0.781571448f, 0.84047091f},
-std::array<float,2>{0.47539103f, 0.0932552665f},
-std::array<float,2>{0.0887930989f, 0.617611468f},
-std::array<float,2>{0.539768815f, 0.420264065f},
-std::array<float,2>{0.648591578f, 0.653725505f},
-std::array<float,2>{0.171235591f, 0.323789388f},
-std::array<float,2>{0.345383346f, 0.941288233f},
-std::array<float,2>{0.922699988f, 0.226380557f},
-std::array<float,2>{0.820217729f, 0.707883179f},
-std::array<float,2>{0.37917614f, 0.258176595f},
-std::array<float,2>{0.000473578693f, 0.934467793f},
-std::array<float,2>{0.579585552f, 0.143534541f},
-std::array<float,2>{0.71793884f, 0.779625535f},
-std::array<float,2>{0.194842577f, 0.0314966477f},
-std::array<float,2>{0.265696526f, 0.525601745f},
-std::array<float,2>{0.989238262f, 0.466355979f},
-std::array<float,2>{0.894864142f, 0.99641782f},
-std::array<float,2>{0.336056232f, 0.19395943f},
-std::array<float,2>{0.130241647f, 0.666178465f},
-std::array<float,2>{0.659525096f, 0.358356148f},
-std::array<float,2>{0.515021265f, 0.579969168f},
-std::array<float,2>{0.0955790058f, 0.384683847f},
-std::array<float,2>{0.451453298f, 0.865095973f},
-std::array<float,2>{0.762779653f, 0.119051419f}}
\ No newline at end of file
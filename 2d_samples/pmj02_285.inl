@@ -1,4096 +0,0 @@
-{std::array<float,2>{0.521330357f, 0.990581095f},
-std::array<float,2>{0.300723076f, 0.0127546499f},
-std::array<float,2>{0.817559659f, 0.499319732f},
-std::array<float,2>{0.118161425f, 0.502667785f},
-std::array<float,2>{0.97874856f, 0.689053237f},
-std::array<float,2>{0.156516477f, 0.260863453f},
-std::array<float,2>{0.6901142f, 0.17764923f},
-std::array<float,2>{0.475965291f, 0.821806192f},
-std::array<float,2>{0.771156907f, 0.756711066f},
-std::array<float,2>{0.0422710553f, 0.198955968f},
-std::array<float,2>{0.581909299f, 0.318315327f},
-std::array<float,2>{0.363155484f, 0.62620914f},
-std::array<float,2>{0.683173716f, 0.602149487f},
-std::array<float,2>{0.386312783f, 0.419079185f},
-std::array<float,2>{0.894728661f, 0.0668190122f},
-std::array<float,2>{0.224065185f, 0.906631827f},
-std::array<float,2>{0.724695265f, 0.846277416f},
-std::array<float,2>{0.450116962f, 0.125577837f},
-std::array<float,2>{0.968651354f, 0.285877645f},
-std::array<float,2>{0.146850154f, 0.720129788f},
-std::array<float,2>{0.874167621f, 0.532353818f},
-std::array<float,2>{0.0782440975f, 0.43923071f},
-std::array<float,2>{0.555438817f, 0.0347987674f},
-std::array<float,2>{0.262258023f, 0.959337175f},
-std::array<float,2>{0.920883238f, 0.895675182f},
-std::array<float,2>{0.191414118f, 0.122090608f},
-std::array<float,2>{0.641609311f, 0.405807137f},
-std::array<float,2>{0.424045295f, 0.574531436f},
-std::array<float,2>{0.617116868f, 0.66311878f},
-std::array<float,2>{0.343101501f, 0.369748384f},
-std::array<float,2>{0.804102898f, 0.244496793f},
-std::array<float,2>{0.0287768301f, 0.803604543f},
-std::array<float,2>{0.57723552f, 0.791086614f},
-std::array<float,2>{0.353315234f, 0.229781657f},
-std::array<float,2>{0.762383342f, 0.354991466f},
-std::array<float,2>{0.056515459f, 0.674796224f},
-std::array<float,2>{0.885109663f, 0.585541248f},
-std::array<float,2>{0.237998828f, 0.377472818f},
-std::array<float,2>{0.662172973f, 0.0960076973f},
-std::array<float,2>{0.403818518f, 0.889930189f},
-std::array<float,2>{0.84245348f, 0.951160908f},
-std::array<float,2>{0.0939016566f, 0.0554127358f},
-std::array<float,2>{0.508977771f, 0.458179832f},
-std::array<float,2>{0.281413406f, 0.556951582f},
-std::array<float,2>{0.717035174f, 0.74956131f},
-std::array<float,2>{0.490210235f, 0.306046367f},
-std::array<float,2>{0.98462528f, 0.151369512f},
-std::array<float,2>{0.17594707f, 0.859412253f},
-std::array<float,2>{0.632289767f, 0.929464757f},
-std::array<float,2>{0.419361353f, 0.0895642489f},
-std::array<float,2>{0.932092786f, 0.427142531f},
-std::array<float,2>{0.211915866f, 0.614177227f},
-std::array<float,2>{0.792690754f, 0.64219135f},
-std::array<float,2>{0.00289998273f, 0.338999659f},
-std::array<float,2>{0.607214808f, 0.203961313f},
-std::array<float,2>{0.317990124f, 0.77274847f},
-std::array<float,2>{0.94706887f, 0.843403935f},
-std::array<float,2>{0.136418179f, 0.160055771f},
-std::array<float,2>{0.737953842f, 0.275188774f},
-std::array<float,2>{0.466228396f, 0.717366159f},
-std::array<float,2>{0.535913765f, 0.529314518f},
-std::array<float,2>{0.270762444f, 0.484323025f},
-std::array<float,2>{0.847810268f, 0.0303490609f},
-std::array<float,2>{0.0734848678f, 0.973783314f},
-std::array<float,2>{0.595983565f, 0.877765954f},
-std::array<float,2>{0.321849406f, 0.10226009f},
-std::array<float,2>{0.788186729f, 0.389455914f},
-std::array<float,2>{0.0148141868f, 0.592737257f},
-std::array<float,2>{0.926289082f, 0.684718013f},
-std::array<float,2>{0.208564252f, 0.345439136f},
-std::array<float,2>{0.634110808f, 0.226492226f},
-std::array<float,2>{0.408994853f, 0.78634268f},
-std::array<float,2>{0.856185794f, 0.869695544f},
-std::array<float,2>{0.0670879632f, 0.146795571f},
-std::array<float,2>{0.540721536f, 0.302874595f},
-std::array<float,2>{0.277568132f, 0.740095139f},
-std::array<float,2>{0.742390752f, 0.551848412f},
-std::array<float,2>{0.456159323f, 0.467516243f},
-std::array<float,2>{0.942656934f, 0.0495234504f},
-std::array<float,2>{0.127490491f, 0.940259218f},
-std::array<float,2>{0.666931927f, 0.778226137f},
-std::array<float,2>{0.393914193f, 0.212926194f},
-std::array<float,2>{0.878187358f, 0.335165143f},
-std::array<float,2>{0.245361507f, 0.655178308f},
-std::array<float,2>{0.751960754f, 0.618466914f},
-std::array<float,2>{0.0481932536f, 0.435885996f},
-std::array<float,2>{0.565065265f, 0.079894796f},
-std::array<float,2>{0.350931764f, 0.933456957f},
-std::array<float,2>{0.995311558f, 0.9836362f},
-std::array<float,2>{0.186554685f, 0.016604973f},
-std::array<float,2>{0.706187844f, 0.471348226f},
-std::array<float,2>{0.495035589f, 0.52070725f},
-std::array<float,2>{0.505619824f, 0.704911411f},
-std::array<float,2>{0.290278435f, 0.269620478f},
-std::array<float,2>{0.83145988f, 0.171082005f},
-std::array<float,2>{0.105659366f, 0.831095457f},
-std::array<float,2>{0.552639186f, 0.813769221f},
-std::array<float,2>{0.25163272f, 0.184372276f},
-std::array<float,2>{0.866823435f, 0.252996922f},
-std::array<float,2>{0.0935088098f, 0.699142456f},
-std::array<float,2>{0.954540372f, 0.508357704f},
-std::array<float,2>{0.150946051f, 0.489744574f},
-std::array<float,2>{0.731579006f, 0.00453641638f},
-std::array<float,2>{0.440510571f, 0.99903065f},
-std::array<float,2>{0.805574536f, 0.91810149f},
-std::array<float,2>{0.0177917648f, 0.0743173361f},
-std::array<float,2>{0.620394468f, 0.407520473f},
-std::array<float,2>{0.335102141f, 0.597330093f},
-std::array<float,2>{0.650693536f, 0.639175057f},
-std::array<float,2>{0.431861907f, 0.320560604f},
-std::array<float,2>{0.906469226f, 0.192572102f},
-std::array<float,2>{0.199592486f, 0.761885822f},
-std::array<float,2>{0.699115634f, 0.961425662f},
-std::array<float,2>{0.478546381f, 0.0391437076f},
-std::array<float,2>{0.976376772f, 0.446201324f},
-std::array<float,2>{0.169564337f, 0.542091489f},
-std::array<float,2>{0.820359707f, 0.730654836f},
-std::array<float,2>{0.116110668f, 0.295052916f},
-std::array<float,2>{0.529483557f, 0.136424676f},
-std::array<float,2>{0.307079881f, 0.851624846f},
-std::array<float,2>{0.903482795f, 0.804972589f},
-std::array<float,2>{0.23295331f, 0.237997115f},
-std::array<float,2>{0.676716864f, 0.360612899f},
-std::array<float,2>{0.377535611f, 0.665605843f},
-std::array<float,2>{0.58916682f, 0.566048622f},
-std::array<float,2>{0.367442101f, 0.39163506f},
-std::array<float,2>{0.780528188f, 0.114724569f},
-std::array<float,2>{0.0313124433f, 0.903265059f},
-std::array<float,2>{0.582843482f, 0.942970812f},
-std::array<float,2>{0.3637802f, 0.0529637635f},
-std::array<float,2>{0.768680274f, 0.464161932f},
-std::array<float,2>{0.0457204618f, 0.550026834f},
-std::array<float,2>{0.893010795f, 0.736766636f},
-std::array<float,2>{0.220568389f, 0.297315866f},
-std::array<float,2>{0.684116781f, 0.14332357f},
-std::array<float,2>{0.388950497f, 0.872304618f},
-std::array<float,2>{0.812781811f, 0.782696784f},
-std::array<float,2>{0.12466076f, 0.222602993f},
-std::array<float,2>{0.517149508f, 0.349328518f},
-std::array<float,2>{0.300945729f, 0.680154681f},
-std::array<float,2>{0.691760719f, 0.588742018f},
-std::array<float,2>{0.470896482f, 0.384207457f},
-std::array<float,2>{0.981386006f, 0.107966326f},
-std::array<float,2>{0.16376996f, 0.880100787f},
-std::array<float,2>{0.64595598f, 0.835027456f},
-std::array<float,2>{0.426221848f, 0.164614052f},
-std::array<float,2>{0.915121555f, 0.265871733f},
-std::array<float,2>{0.188096017f, 0.709321558f},
-std::array<float,2>{0.800017118f, 0.515787601f},
-std::array<float,2>{0.0268214531f, 0.472934365f},
-std::array<float,2>{0.610668063f, 0.0221978705f},
-std::array<float,2>{0.3398332f, 0.980001509f},
-std::array<float,2>{0.961501837f, 0.93494457f},
-std::array<float,2>{0.143335447f, 0.0836152881f},
-std::array<float,2>{0.72213459f, 0.43047744f},
-std::array<float,2>{0.447512567f, 0.622348905f},
-std::array<float,2>{0.559606314f, 0.650677681f},
-std::array<float,2>{0.261260659f, 0.330635667f},
-std::array<float,2>{0.868054271f, 0.21659717f},
-std::array<float,2>{0.0829356387f, 0.775731742f},
-std::array<float,2>{0.514035404f, 0.759521723f},
-std::array<float,2>{0.288877189f, 0.18960458f},
-std::array<float,2>{0.838985682f, 0.325900972f},
-std::array<float,2>{0.100887582f, 0.636364937f},
-std::array<float,2>{0.98862952f, 0.600751281f},
-std::array<float,2>{0.17550835f, 0.413003057f},
-std::array<float,2>{0.714418948f, 0.0712971166f},
-std::array<float,2>{0.484728456f, 0.914206386f},
-std::array<float,2>{0.759743452f, 0.994899452f},
-std::array<float,2>{0.0616218597f, 0.000841718167f},
-std::array<float,2>{0.572747231f, 0.485663056f},
-std::array<float,2>{0.35673961f, 0.513317943f},
-std::array<float,2>{0.657217205f, 0.701109886f},
-std::array<float,2>{0.40210858f, 0.256062597f},
-std::array<float,2>{0.888962567f, 0.182903245f},
-std::array<float,2>{0.23889631f, 0.81868571f},
-std::array<float,2>{0.738346338f, 0.902227581f},
-std::array<float,2>{0.464020193f, 0.111823782f},
-std::array<float,2>{0.949596584f, 0.395245552f},
-std::array<float,2>{0.14030996f, 0.569770515f},
-std::array<float,2>{0.843755364f, 0.669912934f},
-std::array<float,2>{0.0773312151f, 0.366538823f},
-std::array<float,2>{0.533009648f, 0.239364997f},
-std::array<float,2>{0.26740402f, 0.809284866f},
-std::array<float,2>{0.933929205f, 0.85931915f},
-std::array<float,2>{0.217687711f, 0.13757585f},
-std::array<float,2>{0.627366781f, 0.291471034f},
-std::array<float,2>{0.414230078f, 0.727553904f},
-std::array<float,2>{0.604353189f, 0.546030819f},
-std::array<float,2>{0.315688133f, 0.452917367f},
-std::array<float,2>{0.794748187f, 0.0462551937f},
-std::array<float,2>{0.00688624522f, 0.966096342f},
-std::array<float,2>{0.546103239f, 0.911712587f},
-std::array<float,2>{0.276164353f, 0.0663269386f},
-std::array<float,2>{0.851832747f, 0.417290419f},
-std::array<float,2>{0.0639267638f, 0.608853757f},
-std::array<float,2>{0.939983368f, 0.630547225f},
-std::array<float,2>{0.131272748f, 0.315851778f},
-std::array<float,2>{0.748804748f, 0.200761154f},
-std::array<float,2>{0.458287388f, 0.750211954f},
-std::array<float,2>{0.7824471f, 0.827167213f},
-std::array<float,2>{0.00954973232f, 0.173506036f},
-std::array<float,2>{0.599005103f, 0.263854355f},
-std::array<float,2>{0.32514298f, 0.695174098f},
-std::array<float,2>{0.638794541f, 0.504853845f},
-std::array<float,2>{0.410802931f, 0.493150622f},
-std::array<float,2>{0.923915505f, 0.00912706926f},
-std::array<float,2>{0.20543386f, 0.985350609f},
-std::array<float,2>{0.710372388f, 0.800062358f},
-std::array<float,2>{0.499760419f, 0.247704089f},
-std::array<float,2>{0.99705255f, 0.374405473f},
-std::array<float,2>{0.182271674f, 0.659972548f},
-std::array<float,2>{0.833002865f, 0.573441386f},
-std::array<float,2>{0.102426775f, 0.40174219f},
-std::array<float,2>{0.501750588f, 0.120375589f},
-std::array<float,2>{0.295808345f, 0.89417845f},
-std::array<float,2>{0.880451918f, 0.955511868f},
-std::array<float,2>{0.249908552f, 0.0353991501f},
-std::array<float,2>{0.671746731f, 0.442979723f},
-std::array<float,2>{0.396263033f, 0.535958946f},
-std::array<float,2>{0.566950679f, 0.725369096f},
-std::array<float,2>{0.344907552f, 0.284346431f},
-std::array<float,2>{0.756310284f, 0.129615307f},
-std::array<float,2>{0.054552082f, 0.848099828f},
-std::array<float,2>{0.622675419f, 0.863668501f},
-std::array<float,2>{0.32914409f, 0.15388763f},
-std::array<float,2>{0.811998785f, 0.311481625f},
-std::array<float,2>{0.021532774f, 0.745631576f},
-std::array<float,2>{0.911872029f, 0.562039196f},
-std::array<float,2>{0.196947962f, 0.456384808f},
-std::array<float,2>{0.654805124f, 0.0599516779f},
-std::array<float,2>{0.43497923f, 0.947054505f},
-std::array<float,2>{0.860651433f, 0.885653257f},
-std::array<float,2>{0.0862029865f, 0.100254446f},
-std::array<float,2>{0.549174905f, 0.380764723f},
-std::array<float,2>{0.254925132f, 0.57896781f},
-std::array<float,2>{0.728493869f, 0.676955462f},
-std::array<float,2>{0.442508817f, 0.356584519f},
-std::array<float,2>{0.959928989f, 0.233167544f},
-std::array<float,2>{0.15610905f, 0.792978466f},
-std::array<float,2>{0.672835529f, 0.972305f},
-std::array<float,2>{0.382480115f, 0.0235801153f},
-std::array<float,2>{0.901669562f, 0.479426861f},
-std::array<float,2>{0.226825312f, 0.527016461f},
-std::array<float,2>{0.775256574f, 0.713769197f},
-std::array<float,2>{0.0356978625f, 0.281184703f},
-std::array<float,2>{0.589938939f, 0.163690716f},
-std::array<float,2>{0.372634321f, 0.837814748f},
-std::array<float,2>{0.969755769f, 0.766427636f},
-std::array<float,2>{0.164573818f, 0.209179953f},
-std::array<float,2>{0.699869871f, 0.342540026f},
-std::array<float,2>{0.483521551f, 0.646537721f},
-std::array<float,2>{0.523990214f, 0.610867977f},
-std::array<float,2>{0.311362416f, 0.423119903f},
-std::array<float,2>{0.824897647f, 0.0936879292f},
-std::array<float,2>{0.109697618f, 0.923173904f},
-std::array<float,2>{0.557145774f, 0.957486093f},
-std::array<float,2>{0.264668852f, 0.0324674249f},
-std::array<float,2>{0.872866333f, 0.441362381f},
-std::array<float,2>{0.0817826614f, 0.533348322f},
-std::array<float,2>{0.965869009f, 0.722560644f},
-std::array<float,2>{0.146475405f, 0.2884745f},
-std::array<float,2>{0.72356683f, 0.127343729f},
-std::array<float,2>{0.45230034f, 0.844879448f},
-std::array<float,2>{0.801720381f, 0.802718818f},
-std::array<float,2>{0.0300864875f, 0.24399963f},
-std::array<float,2>{0.613811374f, 0.369082838f},
-std::array<float,2>{0.340381533f, 0.661392272f},
-std::array<float,2>{0.64419508f, 0.576387882f},
-std::array<float,2>{0.423284233f, 0.402967364f},
-std::array<float,2>{0.919710875f, 0.124199942f},
-std::array<float,2>{0.194131523f, 0.896815956f},
-std::array<float,2>{0.688727617f, 0.82286942f},
-std::array<float,2>{0.474001169f, 0.177974716f},
-std::array<float,2>{0.976633132f, 0.259041369f},
-std::array<float,2>{0.159609511f, 0.690806925f},
-std::array<float,2>{0.819704771f, 0.501720846f},
-std::array<float,2>{0.119522803f, 0.496604741f},
-std::array<float,2>{0.523045361f, 0.0141504668f},
-std::array<float,2>{0.297515184f, 0.989829898f},
-std::array<float,2>{0.897773325f, 0.909250259f},
-std::array<float,2>{0.22635442f, 0.0684346333f},
-std::array<float,2>{0.680810392f, 0.421209693f},
-std::array<float,2>{0.383363008f, 0.604154944f},
-std::array<float,2>{0.579330087f, 0.628354073f},
-std::array<float,2>{0.359490156f, 0.319598734f},
-std::array<float,2>{0.773030698f, 0.19592832f},
-std::array<float,2>{0.0400255509f, 0.755228221f},
-std::array<float,2>{0.608131051f, 0.77021873f},
-std::array<float,2>{0.319230497f, 0.2066091f},
-std::array<float,2>{0.790460885f, 0.337695956f},
-std::array<float,2>{0.00188710412f, 0.643483996f},
-std::array<float,2>{0.930428982f, 0.616308391f},
-std::array<float,2>{0.214291945f, 0.4278979f},
-std::array<float,2>{0.630432665f, 0.0877169073f},
-std::array<float,2>{0.421863735f, 0.926682472f},
-std::array<float,2>{0.849686801f, 0.97652328f},
-std::array<float,2>{0.0717856809f, 0.0291546397f},
-std::array<float,2>{0.537217379f, 0.481200516f},
-std::array<float,2>{0.272696227f, 0.528604448f},
-std::array<float,2>{0.735221803f, 0.71505928f},
-std::array<float,2>{0.467172205f, 0.276591867f},
-std::array<float,2>{0.947341621f, 0.157892033f},
-std::array<float,2>{0.134747088f, 0.841269493f},
-std::array<float,2>{0.660855711f, 0.88772428f},
-std::array<float,2>{0.405677021f, 0.0943828747f},
-std::array<float,2>{0.883089244f, 0.375489831f},
-std::array<float,2>{0.234807998f, 0.58353132f},
-std::array<float,2>{0.765101075f, 0.673299313f},
-std::array<float,2>{0.0580402128f, 0.352187186f},
-std::array<float,2>{0.575594366f, 0.226971373f},
-std::array<float,2>{0.354324311f, 0.790171683f},
-std::array<float,2>{0.987210333f, 0.862088442f},
-std::array<float,2>{0.179321811f, 0.149989232f},
-std::array<float,2>{0.715965927f, 0.308319747f},
-std::array<float,2>{0.492022574f, 0.746898293f},
-std::array<float,2>{0.511014223f, 0.555576801f},
-std::array<float,2>{0.283540905f, 0.45965609f},
-std::array<float,2>{0.840666711f, 0.0584402271f},
-std::array<float,2>{0.097216025f, 0.951699376f},
-std::array<float,2>{0.562871456f, 0.931208968f},
-std::array<float,2>{0.348420352f, 0.0803843811f},
-std::array<float,2>{0.750673771f, 0.435415089f},
-std::array<float,2>{0.0497503392f, 0.619799733f},
-std::array<float,2>{0.875697553f, 0.653553128f},
-std::array<float,2>{0.242265761f, 0.333551466f},
-std::array<float,2>{0.664236188f, 0.212429807f},
-std::array<float,2>{0.390955001f, 0.779551387f},
-std::array<float,2>{0.828419685f, 0.829992115f},
-std::array<float,2>{0.108038418f, 0.168384835f},
-std::array<float,2>{0.507189214f, 0.272023201f},
-std::array<float,2>{0.292523384f, 0.705967784f},
-std::array<float,2>{0.703678608f, 0.522409379f},
-std::array<float,2>{0.493598998f, 0.469510019f},
-std::array<float,2>{0.993449092f, 0.0193301197f},
-std::array<float,2>{0.184512258f, 0.981274068f},
-std::array<float,2>{0.634958327f, 0.787187278f},
-std::array<float,2>{0.407550544f, 0.222795829f},
-std::array<float,2>{0.928615153f, 0.346177459f},
-std::array<float,2>{0.209586114f, 0.687320709f},
-std::array<float,2>{0.786706269f, 0.590011835f},
-std::array<float,2>{0.0118919425f, 0.387063771f},
-std::array<float,2>{0.59438926f, 0.103753306f},
-std::array<float,2>{0.323021114f, 0.876089096f},
-std::array<float,2>{0.94467622f, 0.93856442f},
-std::array<float,2>{0.126746863f, 0.0476974472f},
-std::array<float,2>{0.745311975f, 0.46637851f},
-std::array<float,2>{0.454160094f, 0.554523289f},
-std::array<float,2>{0.541479409f, 0.740675867f},
-std::array<float,2>{0.280907929f, 0.301975578f},
-std::array<float,2>{0.857790053f, 0.145841286f},
-std::array<float,2>{0.0696503073f, 0.868728459f},
-std::array<float,2>{0.528987825f, 0.853855848f},
-std::array<float,2>{0.305339783f, 0.133461028f},
-std::array<float,2>{0.822963715f, 0.293052137f},
-std::array<float,2>{0.113841586f, 0.733297408f},
-std::array<float,2>{0.974538386f, 0.539546013f},
-std::array<float,2>{0.170275539f, 0.448546499f},
-std::array<float,2>{0.695695698f, 0.0418304205f},
-std::array<float,2>{0.477959484f, 0.964439809f},
-std::array<float,2>{0.777664304f, 0.904984236f},
-std::array<float,2>{0.0334198549f, 0.11632856f},
-std::array<float,2>{0.58779335f, 0.394357711f},
-std::array<float,2>{0.371036023f, 0.564185023f},
-std::array<float,2>{0.678296208f, 0.667544067f},
-std::array<float,2>{0.37602666f, 0.361367792f},
-std::array<float,2>{0.904931664f, 0.235491842f},
-std::array<float,2>{0.231818125f, 0.808407068f},
-std::array<float,2>{0.73341459f, 0.997135758f},
-std::array<float,2>{0.438954204f, 0.0060690525f},
-std::array<float,2>{0.955362141f, 0.491766274f},
-std::array<float,2>{0.148475096f, 0.510705829f},
-std::array<float,2>{0.86484617f, 0.696642935f},
-std::array<float,2>{0.0913964882f, 0.250414938f},
-std::array<float,2>{0.552895606f, 0.185976148f},
-std::array<float,2>{0.253124058f, 0.815164626f},
-std::array<float,2>{0.908690512f, 0.764641464f},
-std::array<float,2>{0.202328414f, 0.1942406f},
-std::array<float,2>{0.650295854f, 0.32343623f},
-std::array<float,2>{0.429795384f, 0.638346195f},
-std::array<float,2>{0.617251813f, 0.595456719f},
-std::array<float,2>{0.333890319f, 0.408656359f},
-std::array<float,2>{0.807915211f, 0.0774284005f},
-std::array<float,2>{0.0160682034f, 0.921085954f},
-std::array<float,2>{0.612090111f, 0.976809621f},
-std::array<float,2>{0.337810755f, 0.0196708757f},
-std::array<float,2>{0.798308372f, 0.474897534f},
-std::array<float,2>{0.0240298081f, 0.518115044f},
-std::array<float,2>{0.917771101f, 0.707197726f},
-std::array<float,2>{0.190615669f, 0.269227386f},
-std::array<float,2>{0.648158193f, 0.167944729f},
-std::array<float,2>{0.428313524f, 0.833401263f},
-std::array<float,2>{0.870721638f, 0.775364399f},
-std::array<float,2>{0.0847443864f, 0.217375919f},
-std::array<float,2>{0.56230396f, 0.329353452f},
-std::array<float,2>{0.258305252f, 0.650256336f},
-std::array<float,2>{0.720674276f, 0.623124957f},
-std::array<float,2>{0.446487635f, 0.432647973f},
-std::array<float,2>{0.963241696f, 0.0843253136f},
-std::array<float,2>{0.142461166f, 0.936585248f},
-std::array<float,2>{0.6864779f, 0.874855042f},
-std::array<float,2>{0.388616771f, 0.141307056f},
-std::array<float,2>{0.891522348f, 0.299486339f},
-std::array<float,2>{0.221211553f, 0.735134721f},
-std::array<float,2>{0.767324567f, 0.548232079f},
-std::array<float,2>{0.0445187874f, 0.461752832f},
-std::array<float,2>{0.585789621f, 0.0513820648f},
-std::array<float,2>{0.366401494f, 0.944035649f},
-std::array<float,2>{0.983382165f, 0.882453322f},
-std::array<float,2>{0.161546901f, 0.107290156f},
-std::array<float,2>{0.694464982f, 0.385354906f},
-std::array<float,2>{0.469258964f, 0.586209655f},
-std::array<float,2>{0.51785773f, 0.683244407f},
-std::array<float,2>{0.30363968f, 0.35025242f},
-std::array<float,2>{0.816010594f, 0.220648542f},
-std::array<float,2>{0.121320762f, 0.785037339f},
-std::array<float,2>{0.533272564f, 0.810584843f},
-std::array<float,2>{0.268279374f, 0.241399452f},
-std::array<float,2>{0.846661508f, 0.363778085f},
-std::array<float,2>{0.0753580481f, 0.671088874f},
-std::array<float,2>{0.951329648f, 0.568153441f},
-std::array<float,2>{0.136920586f, 0.397058517f},
-std::array<float,2>{0.741581917f, 0.11128784f},
-std::array<float,2>{0.461885989f, 0.900259614f},
-std::array<float,2>{0.795495212f, 0.968531013f},
-std::array<float,2>{0.00528193777f, 0.043072924f},
-std::array<float,2>{0.603294194f, 0.450479597f},
-std::array<float,2>{0.312792122f, 0.543004453f},
-std::array<float,2>{0.626585186f, 0.730313778f},
-std::array<float,2>{0.416141331f, 0.290867835f},
-std::array<float,2>{0.93722862f, 0.138975784f},
-std::array<float,2>{0.214923143f, 0.857087255f},
-std::array<float,2>{0.712131739f, 0.916912973f},
-std::array<float,2>{0.487703323f, 0.0732662603f},
-std::array<float,2>{0.990706444f, 0.411365062f},
-std::array<float,2>{0.172351301f, 0.599543929f},
-std::array<float,2>{0.836444199f, 0.633056283f},
-std::array<float,2>{0.0981506556f, 0.327871501f},
-std::array<float,2>{0.512364388f, 0.188251033f},
-std::array<float,2>{0.286954015f, 0.760921299f},
-std::array<float,2>{0.887350619f, 0.816798508f},
-std::array<float,2>{0.241574928f, 0.180523857f},
-std::array<float,2>{0.659006298f, 0.255047888f},
-std::array<float,2>{0.399829179f, 0.702721f},
-std::array<float,2>{0.570646167f, 0.515619636f},
-std::array<float,2>{0.359360546f, 0.487869114f},
-std::array<float,2>{0.761711538f, 0.00341957225f},
-std::array<float,2>{0.0605114922f, 0.993989706f},
-std::array<float,2>{0.50206852f, 0.891742826f},
-std::array<float,2>{0.294358492f, 0.118353993f},
-std::array<float,2>{0.834654748f, 0.399416566f},
-std::array<float,2>{0.105271652f, 0.570974886f},
-std::array<float,2>{0.998074114f, 0.658166826f},
-std::array<float,2>{0.180999637f, 0.3725833f},
-std::array<float,2>{0.70875746f, 0.249053672f},
-std::array<float,2>{0.49705717f, 0.797859907f},
-std::array<float,2>{0.754336894f, 0.850769043f},
-std::array<float,2>{0.0512432866f, 0.131408721f},
-std::array<float,2>{0.569184184f, 0.282246888f},
-std::array<float,2>{0.346679896f, 0.723068535f},
-std::array<float,2>{0.668058157f, 0.538972437f},
-std::array<float,2>{0.397260904f, 0.444111168f},
-std::array<float,2>{0.880940259f, 0.0387396701f},
-std::array<float,2>{0.247454971f, 0.954116225f},
-std::array<float,2>{0.746293247f, 0.753078759f},
-std::array<float,2>{0.459075153f, 0.20267123f},
-std::array<float,2>{0.938058436f, 0.313032478f},
-std::array<float,2>{0.130620494f, 0.631001115f},
-std::array<float,2>{0.854845524f, 0.605964005f},
-std::array<float,2>{0.0646731108f, 0.415614277f},
-std::array<float,2>{0.543530226f, 0.0627728105f},
-std::array<float,2>{0.275323004f, 0.913311779f},
-std::array<float,2>{0.923266947f, 0.986358523f},
-std::array<float,2>{0.204626843f, 0.0102554951f},
-std::array<float,2>{0.637810826f, 0.495141983f},
-std::array<float,2>{0.412678987f, 0.506752074f},
-std::array<float,2>{0.600880861f, 0.693126678f},
-std::array<float,2>{0.327306211f, 0.261861324f},
-std::array<float,2>{0.784299374f, 0.174441367f},
-std::array<float,2>{0.0100373328f, 0.824700594f},
-std::array<float,2>{0.593296111f, 0.839116991f},
-std::array<float,2>{0.373463422f, 0.161694974f},
-std::array<float,2>{0.775853515f, 0.278381407f},
-std::array<float,2>{0.0371123813f, 0.711402237f},
-std::array<float,2>{0.898550153f, 0.524549901f},
-std::array<float,2>{0.228871003f, 0.478260428f},
-std::array<float,2>{0.67441529f, 0.0264613703f},
-std::array<float,2>{0.379531771f, 0.969503522f},
-std::array<float,2>{0.827346861f, 0.924384356f},
-std::array<float,2>{0.113157876f, 0.0909500793f},
-std::array<float,2>{0.525572717f, 0.424685627f},
-std::array<float,2>{0.309024513f, 0.612981439f},
-std::array<float,2>{0.702414572f, 0.645284057f},
-std::array<float,2>{0.482345223f, 0.341595531f},
-std::array<float,2>{0.97162962f, 0.208884567f},
-std::array<float,2>{0.166369706f, 0.767886221f},
-std::array<float,2>{0.652846813f, 0.948706746f},
-std::array<float,2>{0.435896307f, 0.0612520278f},
-std::array<float,2>{0.912562966f, 0.45443055f},
-std::array<float,2>{0.197509915f, 0.559625268f},
-std::array<float,2>{0.809738576f, 0.744095802f},
-std::array<float,2>{0.0213939883f, 0.309656531f},
-std::array<float,2>{0.624041975f, 0.154384553f},
-std::array<float,2>{0.330861598f, 0.865625679f},
-std::array<float,2>{0.95838964f, 0.795870721f},
-std::array<float,2>{0.153168082f, 0.230742514f},
-std::array<float,2>{0.729120553f, 0.358248681f},
-std::array<float,2>{0.445218027f, 0.678602397f},
-std::array<float,2>{0.547701538f, 0.580586195f},
-std::array<float,2>{0.257405668f, 0.382195085f},
-std::array<float,2>{0.863261759f, 0.0987472162f},
-std::array<float,2>{0.0889209211f, 0.88450551f},
-std::array<float,2>{0.538674235f, 0.972725749f},
-std::array<float,2>{0.271526724f, 0.0295005012f},
-std::array<float,2>{0.851493418f, 0.482579708f},
-std::array<float,2>{0.0710535944f, 0.530804157f},
-std::array<float,2>{0.948671281f, 0.717931628f},
-std::array<float,2>{0.133480638f, 0.273620993f},
-std::array<float,2>{0.736179769f, 0.159032404f},
-std::array<float,2>{0.46783635f, 0.842585146f},
-std::array<float,2>{0.789932251f, 0.77167052f},
-std::array<float,2>{0.000903647218f, 0.204604819f},
-std::array<float,2>{0.609196424f, 0.338198006f},
-std::array<float,2>{0.320087224f, 0.641264319f},
-std::array<float,2>{0.629425824f, 0.615057707f},
-std::array<float,2>{0.420623273f, 0.426581115f},
-std::array<float,2>{0.930720627f, 0.0882170796f},
-std::array<float,2>{0.213181436f, 0.928175032f},
-std::array<float,2>{0.715399384f, 0.860786319f},
-std::array<float,2>{0.491152436f, 0.150687888f},
-std::array<float,2>{0.987350702f, 0.305531532f},
-std::array<float,2>{0.178535327f, 0.748349965f},
-std::array<float,2>{0.841446519f, 0.55766952f},
-std::array<float,2>{0.0959613845f, 0.457150728f},
-std::array<float,2>{0.509816349f, 0.0566087961f},
-std::array<float,2>{0.284411222f, 0.949785173f},
-std::array<float,2>{0.883803904f, 0.889434814f},
-std::array<float,2>{0.235937268f, 0.0973056257f},
-std::array<float,2>{0.661487401f, 0.378168941f},
-std::array<float,2>{0.404772669f, 0.584300637f},
-std::array<float,2>{0.575044692f, 0.675628304f},
-std::array<float,2>{0.355406016f, 0.354457825f},
-std::array<float,2>{0.764598131f, 0.229036897f},
-std::array<float,2>{0.0566411093f, 0.792194068f},
-std::array<float,2>{0.614952087f, 0.804368913f},
-std::array<float,2>{0.341324568f, 0.245228857f},
-std::array<float,2>{0.802197695f, 0.370671868f},
-std::array<float,2>{0.0305801928f, 0.662795842f},
-std::array<float,2>{0.918646514f, 0.57559818f},
-std::array<float,2>{0.194598138f, 0.405249745f},
-std::array<float,2>{0.643347263f, 0.121165626f},
-std::array<float,2>{0.4221237f, 0.894723833f},
-std::array<float,2>{0.871734023f, 0.960272193f},
-std::array<float,2>{0.0808851644f, 0.0334976651f},
-std::array<float,2>{0.558066785f, 0.437998325f},
-std::array<float,2>{0.264464229f, 0.5318138f},
-std::array<float,2>{0.723903179f, 0.719629765f},
-std::array<float,2>{0.451834232f, 0.286453873f},
-std::array<float,2>{0.96488905f, 0.126478419f},
-std::array<float,2>{0.145116284f, 0.846937358f},
-std::array<float,2>{0.679824471f, 0.907302082f},
-std::array<float,2>{0.38450712f, 0.0678649247f},
-std::array<float,2>{0.897270441f, 0.418730676f},
-std::array<float,2>{0.224668831f, 0.603075385f},
-std::array<float,2>{0.771973431f, 0.625128388f},
-std::array<float,2>{0.0404934138f, 0.317294836f},
-std::array<float,2>{0.578309f, 0.197680414f},
-std::array<float,2>{0.360654354f, 0.757767618f},
-std::array<float,2>{0.977839291f, 0.820318878f},
-std::array<float,2>{0.158827007f, 0.176205263f},
-std::array<float,2>{0.688169181f, 0.260092229f},
-std::array<float,2>{0.473487616f, 0.687694669f},
-std::array<float,2>{0.521639943f, 0.503177941f},
-std::array<float,2>{0.298580527f, 0.498607934f},
-std::array<float,2>{0.81891489f, 0.0117905252f},
-std::array<float,2>{0.120672144f, 0.992081702f},
-std::array<float,2>{0.586241663f, 0.903592169f},
-std::array<float,2>{0.370022714f, 0.113502689f},
-std::array<float,2>{0.778612316f, 0.391405582f},
-std::array<float,2>{0.0346583612f, 0.56514883f},
-std::array<float,2>{0.90613687f, 0.664496899f},
-std::array<float,2>{0.230513871f, 0.359645426f},
-std::array<float,2>{0.679617703f, 0.237045035f},
-std::array<float,2>{0.375947803f, 0.805705488f},
-std::array<float,2>{0.823779941f, 0.853149772f},
-std::array<float,2>{0.11431893f, 0.135556668f},
-std::array<float,2>{0.528305829f, 0.296328932f},
-std::array<float,2>{0.306450009f, 0.732086599f},
-std::array<float,2>{0.696716547f, 0.541462064f},
-std::array<float,2>{0.476760924f, 0.446735501f},
-std::array<float,2>{0.973240256f, 0.0403914079f},
-std::array<float,2>{0.171054438f, 0.962393761f},
-std::array<float,2>{0.649013042f, 0.76337719f},
-std::array<float,2>{0.431426525f, 0.192127079f},
-std::array<float,2>{0.909772277f, 0.321799248f},
-std::array<float,2>{0.201248065f, 0.640285552f},
-std::array<float,2>{0.807608604f, 0.596524179f},
-std::array<float,2>{0.0174015798f, 0.406261414f},
-std::array<float,2>{0.618894398f, 0.0760644153f},
-std::array<float,2>{0.332775205f, 0.919871151f},
-std::array<float,2>{0.956356227f, 0.998774827f},
-std::array<float,2>{0.149902999f, 0.00500621833f},
-std::array<float,2>{0.732863724f, 0.488580048f},
-std::array<float,2>{0.438214898f, 0.508928061f},
-std::array<float,2>{0.554356217f, 0.697957098f},
-std::array<float,2>{0.25284642f, 0.252510011f},
-std::array<float,2>{0.863766491f, 0.185302034f},
-std::array<float,2>{0.0898886025f, 0.813239574f},
-std::array<float,2>{0.506542921f, 0.830819368f},
-std::array<float,2>{0.291546226f, 0.17014724f},
-std::array<float,2>{0.829166532f, 0.270678729f},
-std::array<float,2>{0.10880284f, 0.703242064f},
-std::array<float,2>{0.992241859f, 0.519666433f},
-std::array<float,2>{0.185465455f, 0.472092628f},
-std::array<float,2>{0.704508126f, 0.0163460393f},
-std::array<float,2>{0.492767751f, 0.983024895f},
-std::array<float,2>{0.751916647f, 0.93249017f},
-std::array<float,2>{0.0499434397f, 0.0786122829f},
-std::array<float,2>{0.56392175f, 0.437130094f},
-std::array<float,2>{0.348830849f, 0.61731714f},
-std::array<float,2>{0.665809214f, 0.655714452f},
-std::array<float,2>{0.392215669f, 0.334400326f},
-std::array<float,2>{0.876461565f, 0.21435146f},
-std::array<float,2>{0.243931964f, 0.778568864f},
-std::array<float,2>{0.744321227f, 0.94136256f},
-std::array<float,2>{0.453202546f, 0.0507315621f},
-std::array<float,2>{0.944149792f, 0.468305409f},
-std::array<float,2>{0.125909299f, 0.551470041f},
-std::array<float,2>{0.859220028f, 0.739124894f},
-std::array<float,2>{0.0686191469f, 0.304059148f},
-std::array<float,2>{0.542754829f, 0.148194671f},
-std::array<float,2>{0.279658347f, 0.870859921f},
-std::array<float,2>{0.929074407f, 0.785972655f},
-std::array<float,2>{0.210576296f, 0.225120172f},
-std::array<float,2>{0.636677742f, 0.343906939f},
-std::array<float,2>{0.406412184f, 0.683877766f},
-std::array<float,2>{0.594796121f, 0.59315747f},
-std::array<float,2>{0.323967338f, 0.390414357f},
-std::array<float,2>{0.785645068f, 0.1031221f},
-std::array<float,2>{0.0132903038f, 0.878651977f},
-std::array<float,2>{0.601824403f, 0.964901567f},
-std::array<float,2>{0.31362018f, 0.0452563129f},
-std::array<float,2>{0.796575427f, 0.451328814f},
-std::array<float,2>{0.00424153032f, 0.545510113f},
-std::array<float,2>{0.936286032f, 0.727180839f},
-std::array<float,2>{0.216334283f, 0.292190611f},
-std::array<float,2>{0.625207841f, 0.138189673f},
-std::array<float,2>{0.417964816f, 0.858102679f},
-std::array<float,2>{0.84693718f, 0.809778392f},
-std::array<float,2>{0.0744266063f, 0.238388613f},
-std::array<float,2>{0.534948528f, 0.366084427f},
-std::array<float,2>{0.268662781f, 0.668431938f},
-std::array<float,2>{0.741006017f, 0.569307029f},
-std::array<float,2>{0.462104052f, 0.395578682f},
-std::array<float,2>{0.952852309f, 0.113180704f},
-std::array<float,2>{0.13791208f, 0.901313066f},
-std::array<float,2>{0.659237266f, 0.82028389f},
-std::array<float,2>{0.399376065f, 0.182189271f},
-std::array<float,2>{0.888106465f, 0.257490456f},
-std::array<float,2>{0.240712836f, 0.699544847f},
-std::array<float,2>{0.759804904f, 0.512654185f},
-std::array<float,2>{0.0586664602f, 0.485007167f},
-std::array<float,2>{0.571543932f, 0.00126826565f},
-std::array<float,2>{0.35831669f, 0.99543494f},
-std::array<float,2>{0.992171228f, 0.915423274f},
-std::array<float,2>{0.173539415f, 0.0710338056f},
-std::array<float,2>{0.711068034f, 0.413525999f},
-std::array<float,2>{0.48701182f, 0.599868238f},
-std::array<float,2>{0.513430476f, 0.635043204f},
-std::array<float,2>{0.285774291f, 0.32433036f},
-std::array<float,2>{0.837015212f, 0.191286385f},
-std::array<float,2>{0.0995877609f, 0.758786082f},
-std::array<float,2>{0.560880184f, 0.776585758f},
-std::array<float,2>{0.259616166f, 0.215280324f},
-std::array<float,2>{0.869642496f, 0.331381708f},
-std::array<float,2>{0.0855645612f, 0.651521862f},
-std::array<float,2>{0.964408278f, 0.621963084f},
-std::array<float,2>{0.1415402f, 0.431629896f},
-std::array<float,2>{0.719012737f, 0.082234174f},
-std::array<float,2>{0.446217537f, 0.934377372f},
-std::array<float,2>{0.797411144f, 0.979099512f},
-std::array<float,2>{0.0248819869f, 0.0233332682f},
-std::array<float,2>{0.612410367f, 0.473756582f},
-std::array<float,2>{0.336250186f, 0.517229855f},
-std::array<float,2>{0.647039413f, 0.710125804f},
-std::array<float,2>{0.429586351f, 0.267410308f},
-std::array<float,2>{0.916701376f, 0.165826008f},
-std::array<float,2>{0.190387785f, 0.834097326f},
-std::array<float,2>{0.694162965f, 0.879414976f},
-std::array<float,2>{0.470517129f, 0.109204553f},
-std::array<float,2>{0.983754575f, 0.383686453f},
-std::array<float,2>{0.160339907f, 0.589525521f},
-std::array<float,2>{0.814815998f, 0.680816889f},
-std::array<float,2>{0.12286444f, 0.348462969f},
-std::array<float,2>{0.518954158f, 0.221138731f},
-std::array<float,2>{0.304522872f, 0.782003462f},
-std::array<float,2>{0.892056584f, 0.871493518f},
-std::array<float,2>{0.222138062f, 0.144467354f},
-std::array<float,2>{0.686545253f, 0.298012704f},
-std::array<float,2>{0.386802077f, 0.737743855f},
-std::array<float,2>{0.584124386f, 0.548876822f},
-std::array<float,2>{0.366116613f, 0.462967753f},
-std::array<float,2>{0.766238451f, 0.0543439239f},
-std::array<float,2>{0.0437647738f, 0.94175899f},
-std::array<float,2>{0.526798308f, 0.921913445f},
-std::array<float,2>{0.309829384f, 0.0926998928f},
-std::array<float,2>{0.826561749f, 0.422440648f},
-std::array<float,2>{0.111364111f, 0.609871924f},
-std::array<float,2>{0.972049534f, 0.647507489f},
-std::array<float,2>{0.167820379f, 0.342973024f},
-std::array<float,2>{0.701925695f, 0.210535079f},
-std::array<float,2>{0.480662972f, 0.766756952f},
-std::array<float,2>{0.776372552f, 0.836473465f},
-std::array<float,2>{0.0386345573f, 0.162745655f},
-std::array<float,2>{0.592324138f, 0.279966623f},
-std::array<float,2>{0.374261439f, 0.714170456f},
-std::array<float,2>{0.675151348f, 0.525935054f},
-std::array<float,2>{0.380006433f, 0.479600877f},
-std::array<float,2>{0.899909258f, 0.025308039f},
-std::array<float,2>{0.22988528f, 0.971469164f},
-std::array<float,2>{0.730193436f, 0.794729888f},
-std::array<float,2>{0.444088489f, 0.233572394f},
-std::array<float,2>{0.957645595f, 0.356337965f},
-std::array<float,2>{0.154027849f, 0.67626971f},
-std::array<float,2>{0.862085044f, 0.579472184f},
-std::array<float,2>{0.0883746147f, 0.379519522f},
-std::array<float,2>{0.54849571f, 0.101509325f},
-std::array<float,2>{0.256612986f, 0.88586551f},
-std::array<float,2>{0.913210154f, 0.945817769f},
-std::array<float,2>{0.198489353f, 0.058958672f},
-std::array<float,2>{0.653832614f, 0.455488116f},
-std::array<float,2>{0.436717629f, 0.561341465f},
-std::array<float,2>{0.623099506f, 0.744716406f},
-std::array<float,2>{0.331964791f, 0.311768234f},
-std::array<float,2>{0.808659971f, 0.152624398f},
-std::array<float,2>{0.0199367329f, 0.864387333f},
-std::array<float,2>{0.56981492f, 0.848973215f},
-std::array<float,2>{0.34640801f, 0.130322397f},
-std::array<float,2>{0.755787194f, 0.283845633f},
-std::array<float,2>{0.0524866432f, 0.726498008f},
-std::array<float,2>{0.882581711f, 0.536512017f},
-std::array<float,2>{0.24661319f, 0.441852123f},
-std::array<float,2>{0.669135273f, 0.0368069001f},
-std::array<float,2>{0.398031116f, 0.956643939f},
-std::array<float,2>{0.835690558f, 0.893424928f},
-std::array<float,2>{0.10422013f, 0.119508803f},
-std::array<float,2>{0.503669381f, 0.400645822f},
-std::array<float,2>{0.293904006f, 0.573121607f},
-std::array<float,2>{0.707662225f, 0.658380806f},
-std::array<float,2>{0.497332066f, 0.373377085f},
-std::array<float,2>{0.99958843f, 0.246389359f},
-std::array<float,2>{0.179946065f, 0.798848987f},
-std::array<float,2>{0.636754453f, 0.985892355f},
-std::array<float,2>{0.413805276f, 0.00797260646f},
-std::array<float,2>{0.922541976f, 0.493570626f},
-std::array<float,2>{0.203424171f, 0.505653381f},
-std::array<float,2>{0.783424854f, 0.694245934f},
-std::array<float,2>{0.0109533435f, 0.265548915f},
-std::array<float,2>{0.600532413f, 0.1724751f},
-std::array<float,2>{0.326290697f, 0.826447427f},
-std::array<float,2>{0.939197719f, 0.751779974f},
-std::array<float,2>{0.129051313f, 0.200157315f},
-std::array<float,2>{0.747626305f, 0.315330178f},
-std::array<float,2>{0.460125834f, 0.628926158f},
-std::array<float,2>{0.544539213f, 0.608146071f},
-std::array<float,2>{0.273724049f, 0.416944563f},
-std::array<float,2>{0.854131997f, 0.0646584332f},
-std::array<float,2>{0.0656939223f, 0.910722554f},
-std::array<float,2>{0.508176446f, 0.952485263f},
-std::array<float,2>{0.282976329f, 0.0572588854f},
-std::array<float,2>{0.842839479f, 0.460449874f},
-std::array<float,2>{0.095037736f, 0.556144893f},
-std::array<float,2>{0.985675335f, 0.747624695f},
-std::array<float,2>{0.177449167f, 0.307258904f},
-std::array<float,2>{0.718362272f, 0.148921505f},
-std::array<float,2>{0.489198446f, 0.862921774f},
-std::array<float,2>{0.763496578f, 0.789588332f},
-std::array<float,2>{0.0548740253f, 0.228332385f},
-std::array<float,2>{0.576274097f, 0.352709591f},
-std::array<float,2>{0.352064252f, 0.671970546f},
-std::array<float,2>{0.663478017f, 0.582921505f},
-std::array<float,2>{0.402659684f, 0.376904428f},
-std::array<float,2>{0.885972083f, 0.0947537497f},
-std::array<float,2>{0.236988217f, 0.887517512f},
-std::array<float,2>{0.737179875f, 0.840551615f},
-std::array<float,2>{0.465593189f, 0.156379521f},
-std::array<float,2>{0.945495725f, 0.276176751f},
-std::array<float,2>{0.135250494f, 0.715821207f},
-std::array<float,2>{0.848833978f, 0.52754885f},
-std::array<float,2>{0.073033534f, 0.482195914f},
-std::array<float,2>{0.53616637f, 0.0282136053f},
-std::array<float,2>{0.270067453f, 0.975355029f},
-std::array<float,2>{0.93351692f, 0.927162051f},
-std::array<float,2>{0.21109058f, 0.0863771215f},
-std::array<float,2>{0.631360114f, 0.42941004f},
-std::array<float,2>{0.418474406f, 0.616198301f},
-std::array<float,2>{0.605718374f, 0.643730938f},
-std::array<float,2>{0.316864789f, 0.336484492f},
-std::array<float,2>{0.791382909f, 0.20516862f},
-std::array<float,2>{0.00334924995f, 0.771231353f},
-std::array<float,2>{0.58096236f, 0.754137516f},
-std::array<float,2>{0.361503422f, 0.196488157f},
-std::array<float,2>{0.76977694f, 0.318755478f},
-std::array<float,2>{0.0415040329f, 0.627031326f},
-std::array<float,2>{0.89630276f, 0.604688466f},
-std::array<float,2>{0.22346577f, 0.420659482f},
-std::array<float,2>{0.682194531f, 0.0695168301f},
-std::array<float,2>{0.385692894f, 0.908999443f},
-std::array<float,2>{0.816811204f, 0.988678098f},
-std::array<float,2>{0.119021155f, 0.0150931384f},
-std::array<float,2>{0.520257056f, 0.497686833f},
-std::array<float,2>{0.299248576f, 0.500657439f},
-std::array<float,2>{0.691280901f, 0.690149188f},
-std::array<float,2>{0.475361794f, 0.257981867f},
-std::array<float,2>{0.979694307f, 0.17925851f},
-std::array<float,2>{0.15800488f, 0.823296547f},
-std::array<float,2>{0.64088726f, 0.897857904f},
-std::array<float,2>{0.425070941f, 0.123280548f},
-std::array<float,2>{0.921335161f, 0.403395861f},
-std::array<float,2>{0.193181306f, 0.578090191f},
-std::array<float,2>{0.803595245f, 0.660554409f},
-std::array<float,2>{0.027937213f, 0.367358327f},
-std::array<float,2>{0.616158664f, 0.242923588f},
-std::array<float,2>{0.342051983f, 0.800811648f},
-std::array<float,2>{0.967695951f, 0.844019055f},
-std::array<float,2>{0.147505566f, 0.128759921f},
-std::array<float,2>{0.726162791f, 0.287626654f},
-std::array<float,2>{0.450677842f, 0.721100271f},
-std::array<float,2>{0.556134701f, 0.534302473f},
-std::array<float,2>{0.263041347f, 0.440324217f},
-std::array<float,2>{0.873311818f, 0.0313290544f},
-std::array<float,2>{0.0794873312f, 0.958886385f},
-std::array<float,2>{0.619970679f, 0.920052707f},
-std::array<float,2>{0.334804535f, 0.0769939423f},
-std::array<float,2>{0.805711091f, 0.409826398f},
-std::array<float,2>{0.0194211751f, 0.593935072f},
-std::array<float,2>{0.908190489f, 0.636845291f},
-std::array<float,2>{0.200609908f, 0.323059708f},
-std::array<float,2>{0.652312338f, 0.194445848f},
-std::array<float,2>{0.43333602f, 0.765399337f},
-std::array<float,2>{0.865314245f, 0.815519333f},
-std::array<float,2>{0.0921864733f, 0.18711406f},
-std::array<float,2>{0.550937951f, 0.251896143f},
-std::array<float,2>{0.250294656f, 0.69604075f},
-std::array<float,2>{0.730528474f, 0.511362314f},
-std::array<float,2>{0.439857423f, 0.490811288f},
-std::array<float,2>{0.953616679f, 0.00717656966f},
-std::array<float,2>{0.15221867f, 0.996294856f},
-std::array<float,2>{0.676824212f, 0.806710064f},
-std::array<float,2>{0.378242254f, 0.234823868f},
-std::array<float,2>{0.90266484f, 0.362710714f},
-std::array<float,2>{0.234289527f, 0.666181326f},
-std::array<float,2>{0.780025959f, 0.563440919f},
-std::array<float,2>{0.032615304f, 0.392748237f},
-std::array<float,2>{0.588634431f, 0.116150089f},
-std::array<float,2>{0.368169636f, 0.905837893f},
-std::array<float,2>{0.974749088f, 0.963808835f},
-std::array<float,2>{0.168221816f, 0.0422992297f},
-std::array<float,2>{0.697754264f, 0.447947174f},
-std::array<float,2>{0.479951948f, 0.540895879f},
-std::array<float,2>{0.530800045f, 0.73345834f},
-std::array<float,2>{0.307771683f, 0.29402703f},
-std::array<float,2>{0.821976125f, 0.134370878f},
-std::array<float,2>{0.116737232f, 0.85464865f},
-std::array<float,2>{0.539923251f, 0.867444098f},
-std::array<float,2>{0.278707266f, 0.144846722f},
-std::array<float,2>{0.857247472f, 0.301047921f},
-std::array<float,2>{0.0681016445f, 0.741231918f},
-std::array<float,2>{0.941880524f, 0.553638041f},
-std::array<float,2>{0.128309935f, 0.46565932f},
-std::array<float,2>{0.744012535f, 0.0481684841f},
-std::array<float,2>{0.455191433f, 0.93804127f},
-std::array<float,2>{0.787132859f, 0.875050902f},
-std::array<float,2>{0.0142038018f, 0.10452579f},
-std::array<float,2>{0.597176313f, 0.388051152f},
-std::array<float,2>{0.32057181f, 0.59116137f},
-std::array<float,2>{0.63364625f, 0.686294258f},
-std::array<float,2>{0.409742743f, 0.347567081f},
-std::array<float,2>{0.926826715f, 0.223938867f},
-std::array<float,2>{0.207328141f, 0.78868562f},
-std::array<float,2>{0.705897212f, 0.981707752f},
-std::array<float,2>{0.49519369f, 0.0176213384f},
-std::array<float,2>{0.994780958f, 0.470500439f},
-std::array<float,2>{0.185593382f, 0.522969902f},
-std::array<float,2>{0.830413043f, 0.706204236f},
-std::array<float,2>{0.106520541f, 0.272886425f},
-std::array<float,2>{0.504391193f, 0.169862941f},
-std::array<float,2>{0.289345056f, 0.828821242f},
-std::array<float,2>{0.877558589f, 0.781244516f},
-std::array<float,2>{0.24508594f, 0.210961014f},
-std::array<float,2>{0.667115211f, 0.332633406f},
-std::array<float,2>{0.392849833f, 0.653156459f},
-std::array<float,2>{0.565870166f, 0.620973766f},
-std::array<float,2>{0.349934787f, 0.434510767f},
-std::array<float,2>{0.753587425f, 0.0812230557f},
-std::array<float,2>{0.0469617508f, 0.930162907f},
-std::array<float,2>{0.573722124f, 0.992442131f},
-std::array<float,2>{0.355993122f, 0.00244442746f},
-std::array<float,2>{0.758163452f, 0.486390144f},
-std::array<float,2>{0.0613926835f, 0.513942063f},
-std::array<float,2>{0.889854729f, 0.702071548f},
-std::array<float,2>{0.240168586f, 0.253975272f},
-std::array<float,2>{0.657992661f, 0.181498155f},
-std::array<float,2>{0.400919378f, 0.817458987f},
-std::array<float,2>{0.838483751f, 0.760362983f},
-std::array<float,2>{0.100554682f, 0.188525662f},
-std::array<float,2>{0.515564442f, 0.326782763f},
-std::array<float,2>{0.287619293f, 0.634223521f},
-std::array<float,2>{0.713699102f, 0.598031282f},
-std::array<float,2>{0.485970706f, 0.41080755f},
-std::array<float,2>{0.990179777f, 0.0726057664f},
-std::array<float,2>{0.174736291f, 0.917736888f},
-std::array<float,2>{0.628109455f, 0.855965614f},
-std::array<float,2>{0.415955067f, 0.140189022f},
-std::array<float,2>{0.934736609f, 0.289824784f},
-std::array<float,2>{0.218703851f, 0.729435861f},
-std::array<float,2>{0.793742359f, 0.544603467f},
-std::array<float,2>{0.00670408318f, 0.449442565f},
-std::array<float,2>{0.605445087f, 0.0448546112f},
-std::array<float,2>{0.315337121f, 0.967704535f},
-std::array<float,2>{0.950934768f, 0.899242699f},
-std::array<float,2>{0.139584869f, 0.11027617f},
-std::array<float,2>{0.740126491f, 0.397848606f},
-std::array<float,2>{0.463744581f, 0.566627324f},
-std::array<float,2>{0.531693876f, 0.670620203f},
-std::array<float,2>{0.265809149f, 0.364490956f},
-std::array<float,2>{0.84472996f, 0.240429953f},
-std::array<float,2>{0.0769889429f, 0.812065601f},
-std::array<float,2>{0.516115069f, 0.783822179f},
-std::array<float,2>{0.302003443f, 0.219294086f},
-std::array<float,2>{0.814360678f, 0.350854635f},
-std::array<float,2>{0.123382449f, 0.682594717f},
-std::array<float,2>{0.982111216f, 0.587228775f},
-std::array<float,2>{0.162799612f, 0.386449069f},
-std::array<float,2>{0.692517161f, 0.106212132f},
-std::array<float,2>{0.472175747f, 0.881052554f},
-std::array<float,2>{0.768143713f, 0.944884658f},
-std::array<float,2>{0.0461014658f, 0.0519117489f},
-std::array<float,2>{0.583889306f, 0.462368935f},
-std::array<float,2>{0.364266366f, 0.547777355f},
-std::array<float,2>{0.685362816f, 0.736253381f},
-std::array<float,2>{0.389824986f, 0.30036968f},
-std::array<float,2>{0.893652022f, 0.141621783f},
-std::array<float,2>{0.2190492f, 0.873329461f},
-std::array<float,2>{0.720733702f, 0.935604334f},
-std::array<float,2>{0.448499084f, 0.085450612f},
-std::array<float,2>{0.962157428f, 0.432312489f},
-std::array<float,2>{0.143730387f, 0.624548912f},
-std::array<float,2>{0.868196249f, 0.648573995f},
-std::array<float,2>{0.0837303922f, 0.328900456f},
-std::array<float,2>{0.558971465f, 0.218503386f},
-std::array<float,2>{0.260141402f, 0.774163425f},
-std::array<float,2>{0.914546967f, 0.832431495f},
-std::array<float,2>{0.188708827f, 0.16671513f},
-std::array<float,2>{0.644859672f, 0.268021762f},
-std::array<float,2>{0.427525997f, 0.708585978f},
-std::array<float,2>{0.610191584f, 0.519257367f},
-std::array<float,2>{0.337941319f, 0.476331383f},
-std::array<float,2>{0.799125552f, 0.0209143944f},
-std::array<float,2>{0.0256490745f, 0.9780249f},
-std::array<float,2>{0.549829602f, 0.883338392f},
-std::array<float,2>{0.254670739f, 0.0977010056f},
-std::array<float,2>{0.859859586f, 0.381097734f},
-std::array<float,2>{0.0870075673f, 0.581252635f},
-std::array<float,2>{0.960935056f, 0.679503679f},
-std::array<float,2>{0.155035034f, 0.359182566f},
-std::array<float,2>{0.727297843f, 0.231508598f},
-std::array<float,2>{0.4421615f, 0.796545386f},
-std::array<float,2>{0.810844839f, 0.867089212f},
-std::array<float,2>{0.0229989681f, 0.156031191f},
-std::array<float,2>{0.621666729f, 0.308832556f},
-std::array<float,2>{0.328920692f, 0.742585599f},
-std::array<float,2>{0.655680776f, 0.559098601f},
-std::array<float,2>{0.433842421f, 0.45333907f},
-std::array<float,2>{0.910502255f, 0.0623070151f},
-std::array<float,2>{0.195436373f, 0.947907031f},
-std::array<float,2>{0.701134264f, 0.769156873f},
-std::array<float,2>{0.483186841f, 0.207648888f},
-std::array<float,2>{0.96925205f, 0.340545684f},
-std::array<float,2>{0.165158466f, 0.64598453f},
-std::array<float,2>{0.825866163f, 0.612225175f},
-std::array<float,2>{0.110685363f, 0.425295681f},
-std::array<float,2>{0.524502516f, 0.0905228406f},
-std::array<float,2>{0.311604887f, 0.92558074f},
-std::array<float,2>{0.90114522f, 0.970449865f},
-std::array<float,2>{0.227766246f, 0.0258679893f},
-std::array<float,2>{0.673587084f, 0.477027446f},
-std::array<float,2>{0.381726444f, 0.52384311f},
-std::array<float,2>{0.591584563f, 0.712832391f},
-std::array<float,2>{0.371167332f, 0.278194577f},
-std::array<float,2>{0.773586631f, 0.160617575f},
-std::array<float,2>{0.0369453095f, 0.838286638f},
-std::array<float,2>{0.59848088f, 0.826145351f},
-std::array<float,2>{0.325225621f, 0.174835429f},
-std::array<float,2>{0.781701922f, 0.263611019f},
-std::array<float,2>{0.00823841803f, 0.692340791f},
-std::array<float,2>{0.925001383f, 0.507177949f},
-std::array<float,2>{0.206137121f, 0.494835109f},
-std::array<float,2>{0.639795423f, 0.011705759f},
-std::array<float,2>{0.41152665f, 0.987636149f},
-std::array<float,2>{0.85276705f, 0.912923872f},
-std::array<float,2>{0.0628458038f, 0.0637163371f},
-std::array<float,2>{0.545368373f, 0.41471082f},
-std::array<float,2>{0.276486844f, 0.606874704f},
-std::array<float,2>{0.749294817f, 0.632789254f},
-std::array<float,2>{0.457913041f, 0.313694715f},
-std::array<float,2>{0.940925121f, 0.201660544f},
-std::array<float,2>{0.132042557f, 0.752064526f},
-std::array<float,2>{0.670372307f, 0.953573465f},
-std::array<float,2>{0.395203352f, 0.0373838767f},
-std::array<float,2>{0.87923789f, 0.445093334f},
-std::array<float,2>{0.248134568f, 0.538077056f},
-std::array<float,2>{0.757525325f, 0.723646879f},
-std::array<float,2>{0.0533526503f, 0.28201285f},
-std::array<float,2>{0.567596495f, 0.131981969f},
-std::array<float,2>{0.344608217f, 0.850248575f},
-std::array<float,2>{0.997656226f, 0.797675788f},
-std::array<float,2>{0.182634801f, 0.248702705f},
-std::array<float,2>{0.709593534f, 0.371111691f},
-std::array<float,2>{0.498204976f, 0.656457841f},
-std::array<float,2>{0.500697076f, 0.571832478f},
-std::array<float,2>{0.296842366f, 0.398474991f},
-std::array<float,2>{0.833141983f, 0.117865726f},
-std::array<float,2>{0.103202432f, 0.891479969f},
-std::array<float,2>{0.504724324f, 0.982454479f},
-std::array<float,2>{0.289677173f, 0.0157071855f},
-std::array<float,2>{0.831018806f, 0.472305864f},
-std::array<float,2>{0.106965199f, 0.520478189f},
-std::array<float,2>{0.994377553f, 0.703805089f},
-std::array<float,2>{0.1862638f, 0.271321148f},
-std::array<float,2>{0.705119252f, 0.170542255f},
-std::array<float,2>{0.49587512f, 0.830452085f},
-std::array<float,2>{0.753349662f, 0.779059768f},
-std::array<float,2>{0.0473695695f, 0.214416265f},
-std::array<float,2>{0.566110551f, 0.334568113f},
-std::array<float,2>{0.350156665f, 0.655939519f},
-std::array<float,2>{0.667867005f, 0.617737174f},
-std::array<float,2>{0.39338389f, 0.436743289f},
-std::array<float,2>{0.877416372f, 0.0788108855f},
-std::array<float,2>{0.24438566f, 0.931660116f},
-std::array<float,2>{0.743461072f, 0.870432854f},
-std::array<float,2>{0.455843806f, 0.147496432f},
-std::array<float,2>{0.942173064f, 0.304307014f},
-std::array<float,2>{0.128788322f, 0.738418877f},
-std::array<float,2>{0.856465459f, 0.550934196f},
-std::array<float,2>{0.0678475797f, 0.468181431f},
-std::array<float,2>{0.539517939f, 0.0499546304f},
-std::array<float,2>{0.278892726f, 0.940461934f},
-std::array<float,2>{0.927341759f, 0.878385961f},
-std::array<float,2>{0.207565874f, 0.102574073f},
-std::array<float,2>{0.63287133f, 0.39012602f},
-std::array<float,2>{0.409521341f, 0.59334451f},
-std::array<float,2>{0.596750498f, 0.684550524f},
-std::array<float,2>{0.32096228f, 0.344554663f},
-std::array<float,2>{0.788005233f, 0.22473219f},
-std::array<float,2>{0.0137230372f, 0.785618782f},
-std::array<float,2>{0.588245988f, 0.806432664f},
-std::array<float,2>{0.369123191f, 0.236632094f},
-std::array<float,2>{0.779581487f, 0.360123396f},
-std::array<float,2>{0.0331115276f, 0.664882123f},
-std::array<float,2>{0.903286159f, 0.564798772f},
-std::array<float,2>{0.23347114f, 0.390716761f},
-std::array<float,2>{0.677525461f, 0.11393524f},
-std::array<float,2>{0.378804386f, 0.904263377f},
-std::array<float,2>{0.821390986f, 0.962497175f},
-std::array<float,2>{0.116220385f, 0.040617723f},
-std::array<float,2>{0.530460656f, 0.4472543f},
-std::array<float,2>{0.308319271f, 0.541509628f},
-std::array<float,2>{0.697673678f, 0.731521428f},
-std::array<float,2>{0.480112702f, 0.296820253f},
-std::array<float,2>{0.975569904f, 0.134907156f},
-std::array<float,2>{0.168781817f, 0.852670133f},
-std::array<float,2>{0.65176183f, 0.919075966f},
-std::array<float,2>{0.432815135f, 0.0755287856f},
-std::array<float,2>{0.907710135f, 0.406986058f},
-std::array<float,2>{0.200835258f, 0.595992923f},
-std::array<float,2>{0.806321383f, 0.63985002f},
-std::array<float,2>{0.0187312923f, 0.321743131f},
-std::array<float,2>{0.619561851f, 0.191496819f},
-std::array<float,2>{0.334457725f, 0.762928307f},
-std::array<float,2>{0.953518927f, 0.81265372f},
-std::array<float,2>{0.151754364f, 0.184706092f},
-std::array<float,2>{0.731441975f, 0.251961589f},
-std::array<float,2>{0.44028157f, 0.697669685f},
-std::array<float,2>{0.551751018f, 0.509605527f},
-std::array<float,2>{0.250798792f, 0.489246249f},
-std::array<float,2>{0.865742922f, 0.00558766862f},
-std::array<float,2>{0.0926974937f, 0.998445094f},
-std::array<float,2>{0.615434647f, 0.89511174f},
-std::array<float,2>{0.342377365f, 0.12180502f},
-std::array<float,2>{0.803121328f, 0.404621601f},
-std::array<float,2>{0.0276471768f, 0.575950265f},
-std::array<float,2>{0.921785831f, 0.662533224f},
-std::array<float,2>{0.192449629f, 0.37041533f},
-std::array<float,2>{0.641395152f, 0.245963618f},
-std::array<float,2>{0.425565094f, 0.804068387f},
-std::array<float,2>{0.87382853f, 0.847331285f},
-std::array<float,2>{0.0798123628f, 0.126132101f},
-std::array<float,2>{0.55656755f, 0.28697589f},
-std::array<float,2>{0.263505399f, 0.71892637f},
-std::array<float,2>{0.72578907f, 0.531330824f},
-std::array<float,2>{0.450765818f, 0.437703043f},
-std::array<float,2>{0.967190623f, 0.0341072679f},
-std::array<float,2>{0.148098499f, 0.960730255f},
-std::array<float,2>{0.68185997f, 0.757095933f},
-std::array<float,2>{0.385046959f, 0.197967097f},
-std::array<float,2>{0.895970106f, 0.316755503f},
-std::array<float,2>{0.222843602f, 0.625706971f},
-std::array<float,2>{0.7701298f, 0.602927208f},
-std::array<float,2>{0.0413721651f, 0.418110847f},
-std::array<float,2>{0.580386817f, 0.0680923164f},
-std::array<float,2>{0.361954153f, 0.908195198f},
-std::array<float,2>{0.980114937f, 0.991477668f},
-std::array<float,2>{0.15740864f, 0.0125449579f},
-std::array<float,2>{0.690691411f, 0.498191535f},
-std::array<float,2>{0.474682331f, 0.503437519f},
-std::array<float,2>{0.519698501f, 0.688196063f},
-std::array<float,2>{0.299544811f, 0.260525972f},
-std::array<float,2>{0.817141771f, 0.176656231f},
-std::array<float,2>{0.1183827f, 0.82101357f},
-std::array<float,2>{0.536922336f, 0.84182179f},
-std::array<float,2>{0.269618213f, 0.158523172f},
-std::array<float,2>{0.849254191f, 0.274158925f},
-std::array<float,2>{0.0727125406f, 0.718383729f},
-std::array<float,2>{0.94614327f, 0.530406356f},
-std::array<float,2>{0.135391101f, 0.482937396f},
-std::array<float,2>{0.736441672f, 0.0300073177f},
-std::array<float,2>{0.464969188f, 0.973272264f},
-std::array<float,2>{0.791795671f, 0.928679347f},
-std::array<float,2>{0.00389511697f, 0.0884027928f},
-std::array<float,2>{0.606051028f, 0.426160246f},
-std::array<float,2>{0.317207694f, 0.614304006f},
-std::array<float,2>{0.631127954f, 0.640649676f},
-std::array<float,2>{0.418241918f, 0.338730484f},
-std::array<float,2>{0.93309164f, 0.20440647f},
-std::array<float,2>{0.211913392f, 0.772093713f},
-std::array<float,2>{0.717917919f, 0.949495614f},
-std::array<float,2>{0.488329023f, 0.0557695217f},
-std::array<float,2>{0.986060917f, 0.457881004f},
-std::array<float,2>{0.176942781f, 0.558538258f},
-std::array<float,2>{0.84345305f, 0.748867989f},
-std::array<float,2>{0.0955530778f, 0.30494839f},
-std::array<float,2>{0.508710086f, 0.151178524f},
-std::array<float,2>{0.282384515f, 0.861325681f},
-std::array<float,2>{0.886643112f, 0.792542279f},
-std::array<float,2>{0.236370638f, 0.228687495f},
-std::array<float,2>{0.66384387f, 0.353989363f},
-std::array<float,2>{0.403115898f, 0.674876571f},
-std::array<float,2>{0.57671386f, 0.584873438f},
-std::array<float,2>{0.351872563f, 0.378833085f},
-std::array<float,2>{0.762899816f, 0.0968442336f},
-std::array<float,2>{0.0556210987f, 0.888798118f},
-std::array<float,2>{0.568131149f, 0.956311107f},
-std::array<float,2>{0.344014198f, 0.0363118351f},
-std::array<float,2>{0.756987154f, 0.442259133f},
-std::array<float,2>{0.0531632192f, 0.536645532f},
-std::array<float,2>{0.879629374f, 0.725713968f},
-std::array<float,2>{0.248822093f, 0.283491105f},
-std::array<float,2>{0.67067349f, 0.130791366f},
-std::array<float,2>{0.394629866f, 0.849596143f},
-std::array<float,2>{0.833578289f, 0.799606621f},
-std::array<float,2>{0.102890655f, 0.246612459f},
-std::array<float,2>{0.500411451f, 0.373578817f},
-std::array<float,2>{0.296185166f, 0.658834934f},
-std::array<float,2>{0.709060431f, 0.572485209f},
-std::array<float,2>{0.498949826f, 0.401047558f},
-std::array<float,2>{0.997401834f, 0.119748376f},
-std::array<float,2>{0.183258295f, 0.892707348f},
-std::array<float,2>{0.640581131f, 0.826874316f},
-std::array<float,2>{0.411742806f, 0.172116488f},
-std::array<float,2>{0.925329447f, 0.265128344f},
-std::array<float,2>{0.206944659f, 0.693366587f},
-std::array<float,2>{0.781805277f, 0.505023003f},
-std::array<float,2>{0.0083155157f, 0.493907839f},
-std::array<float,2>{0.598019183f, 0.00835121609f},
-std::array<float,2>{0.325809747f, 0.985836804f},
-std::array<float,2>{0.940690517f, 0.910176694f},
-std::array<float,2>{0.132790923f, 0.0649457723f},
-std::array<float,2>{0.749691308f, 0.416384369f},
-std::array<float,2>{0.457442731f, 0.607523382f},
-std::array<float,2>{0.545536816f, 0.629699171f},
-std::array<float,2>{0.27690661f, 0.314670593f},
-std::array<float,2>{0.853200197f, 0.199260965f},
-std::array<float,2>{0.0634260252f, 0.751132548f},
-std::array<float,2>{0.525329351f, 0.767420053f},
-std::array<float,2>{0.312389046f, 0.210410699f},
-std::array<float,2>{0.825504184f, 0.343654305f},
-std::array<float,2>{0.110848822f, 0.648066878f},
-std::array<float,2>{0.969076395f, 0.609707236f},
-std::array<float,2>{0.165861234f, 0.42204085f},
-std::array<float,2>{0.700613379f, 0.091846779f},
-std::array<float,2>{0.482873082f, 0.922422469f},
-std::array<float,2>{0.774065077f, 0.970873237f},
-std::array<float,2>{0.0362584405f, 0.0247773398f},
-std::array<float,2>{0.591068685f, 0.480261803f},
-std::array<float,2>{0.371683687f, 0.525733709f},
-std::array<float,2>{0.672963381f, 0.714793265f},
-std::array<float,2>{0.381098777f, 0.27936253f},
-std::array<float,2>{0.900761545f, 0.162279859f},
-std::array<float,2>{0.228423283f, 0.836408973f},
-std::array<float,2>{0.726630569f, 0.88656956f},
-std::array<float,2>{0.441757411f, 0.100933529f},
-std::array<float,2>{0.960036159f, 0.379366606f},
-std::array<float,2>{0.154381245f, 0.580067396f},
-std::array<float,2>{0.860289574f, 0.676130414f},
-std::array<float,2>{0.0878671035f, 0.355907232f},
-std::array<float,2>{0.550716758f, 0.234351188f},
-std::array<float,2>{0.254356325f, 0.794025958f},
-std::array<float,2>{0.910943031f, 0.864858329f},
-std::array<float,2>{0.195940271f, 0.152920544f},
-std::array<float,2>{0.655789733f, 0.312152833f},
-std::array<float,2>{0.434445232f, 0.744172156f},
-std::array<float,2>{0.621488571f, 0.560952425f},
-std::array<float,2>{0.328230709f, 0.455709636f},
-std::array<float,2>{0.81108886f, 0.0592061318f},
-std::array<float,2>{0.0225182604f, 0.945606232f},
-std::array<float,2>{0.559462786f, 0.933975697f},
-std::array<float,2>{0.260627091f, 0.0829011425f},
-std::array<float,2>{0.86880064f, 0.43067947f},
-std::array<float,2>{0.0830382407f, 0.621395588f},
-std::array<float,2>{0.96257621f, 0.651919425f},
-std::array<float,2>{0.144245073f, 0.331667274f},
-std::array<float,2>{0.721393108f, 0.215627432f},
-std::array<float,2>{0.449113607f, 0.777266324f},
-std::array<float,2>{0.799789429f, 0.834825993f},
-std::array<float,2>{0.0262240097f, 0.165427908f},
-std::array<float,2>{0.609859347f, 0.2668899f},
-std::array<float,2>{0.338714629f, 0.710781038f},
-std::array<float,2>{0.645244241f, 0.516928673f},
-std::array<float,2>{0.426963001f, 0.47456938f},
-std::array<float,2>{0.914646924f, 0.0227274951f},
-std::array<float,2>{0.189197078f, 0.978976727f},
-std::array<float,2>{0.693125069f, 0.781563997f},
-std::array<float,2>{0.472035766f, 0.221448287f},
-std::array<float,2>{0.981492162f, 0.347723871f},
-std::array<float,2>{0.162184551f, 0.681599259f},
-std::array<float,2>{0.813538134f, 0.589266837f},
-std::array<float,2>{0.123542771f, 0.383152515f},
-std::array<float,2>{0.515797853f, 0.108522087f},
-std::array<float,2>{0.302321404f, 0.879353106f},
-std::array<float,2>{0.894412398f, 0.942102015f},
-std::array<float,2>{0.219457507f, 0.0538401976f},
-std::array<float,2>{0.684777856f, 0.463656187f},
-std::array<float,2>{0.390139878f, 0.549562454f},
-std::array<float,2>{0.583443761f, 0.737805426f},
-std::array<float,2>{0.364834338f, 0.298793495f},
-std::array<float,2>{0.767998517f, 0.14380461f},
-std::array<float,2>{0.0467007272f, 0.871617615f},
-std::array<float,2>{0.604632497f, 0.857688248f},
-std::array<float,2>{0.314726353f, 0.137743503f},
-std::array<float,2>{0.793257236f, 0.292853177f},
-std::array<float,2>{0.00602668431f, 0.726584554f},
-std::array<float,2>{0.935233951f, 0.545095563f},
-std::array<float,2>{0.217953458f, 0.451673299f},
-std::array<float,2>{0.628679574f, 0.0457975715f},
-std::array<float,2>{0.415481895f, 0.965796769f},
-std::array<float,2>{0.845443904f, 0.900570095f},
-std::array<float,2>{0.0766588151f, 0.112427048f},
-std::array<float,2>{0.531886399f, 0.396427751f},
-std::array<float,2>{0.266452253f, 0.568612278f},
-std::array<float,2>{0.739404976f, 0.668767989f},
-std::array<float,2>{0.463062108f, 0.365310818f},
-std::array<float,2>{0.950663209f, 0.239150062f},
-std::array<float,2>{0.139003024f, 0.810425162f},
-std::array<float,2>{0.657525778f, 0.995707631f},
-std::array<float,2>{0.400793463f, 0.00192093547f},
-std::array<float,2>{0.890584409f, 0.484789044f},
-std::array<float,2>{0.239539057f, 0.511853397f},
-std::array<float,2>{0.75854224f, 0.700143397f},
-std::array<float,2>{0.0606908984f, 0.257207483f},
-std::array<float,2>{0.574157894f, 0.181745976f},
-std::array<float,2>{0.355883777f, 0.819411159f},
-std::array<float,2>{0.989399672f, 0.758001029f},
-std::array<float,2>{0.173936665f, 0.190841615f},
-std::array<float,2>{0.713193715f, 0.325018495f},
-std::array<float,2>{0.485801756f, 0.635441661f},
-std::array<float,2>{0.515078783f, 0.600312948f},
-std::array<float,2>{0.287465036f, 0.413997084f},
-std::array<float,2>{0.837994754f, 0.0703700855f},
-std::array<float,2>{0.100003533f, 0.915543795f},
-std::array<float,2>{0.542456567f, 0.937883973f},
-std::array<float,2>{0.280239344f, 0.0484838337f},
-std::array<float,2>{0.858840942f, 0.465007633f},
-std::array<float,2>{0.0690552294f, 0.553003728f},
-std::array<float,2>{0.943653762f, 0.741726696f},
-std::array<float,2>{0.12542516f, 0.301302612f},
-std::array<float,2>{0.745000958f, 0.145424604f},
-std::array<float,2>{0.453657717f, 0.867961049f},
-std::array<float,2>{0.785246134f, 0.788227081f},
-std::array<float,2>{0.0130344704f, 0.224179432f},
-std::array<float,2>{0.595431805f, 0.347167581f},
-std::array<float,2>{0.323631883f, 0.685811639f},
-std::array<float,2>{0.636146247f, 0.591748595f},
-std::array<float,2>{0.406738371f, 0.388246238f},
-std::array<float,2>{0.929651499f, 0.105336703f},
-std::array<float,2>{0.210082069f, 0.875572801f},
-std::array<float,2>{0.705018461f, 0.828553379f},
-std::array<float,2>{0.492521763f, 0.168997511f},
-std::array<float,2>{0.993044436f, 0.273344427f},
-std::array<float,2>{0.184620842f, 0.70691216f},
-std::array<float,2>{0.829970479f, 0.522473156f},
-std::array<float,2>{0.109324232f, 0.470108956f},
-std::array<float,2>{0.506286919f, 0.0185215864f},
-std::array<float,2>{0.291078568f, 0.982115924f},
-std::array<float,2>{0.876827538f, 0.930308402f},
-std::array<float,2>{0.243549377f, 0.0819154456f},
-std::array<float,2>{0.665276468f, 0.433893383f},
-std::array<float,2>{0.391769886f, 0.620532036f},
-std::array<float,2>{0.564049542f, 0.652397752f},
-std::array<float,2>{0.349208117f, 0.332351208f},
-std::array<float,2>{0.751165628f, 0.21189408f},
-std::array<float,2>{0.0504403189f, 0.78033185f},
-std::array<float,2>{0.618165374f, 0.764766514f},
-std::array<float,2>{0.332227737f, 0.195061907f},
-std::array<float,2>{0.806818783f, 0.322355479f},
-std::array<float,2>{0.016649941f, 0.637268186f},
-std::array<float,2>{0.909567833f, 0.594568789f},
-std::array<float,2>{0.201800704f, 0.409265906f},
-std::array<float,2>{0.648595452f, 0.0763817132f},
-std::array<float,2>{0.430807233f, 0.920598269f},
-std::array<float,2>{0.864136934f, 0.996999979f},
-std::array<float,2>{0.0906929374f, 0.00751481717f},
-std::array<float,2>{0.553994358f, 0.490606755f},
-std::array<float,2>{0.252331704f, 0.51118809f},
-std::array<float,2>{0.732984781f, 0.695548832f},
-std::array<float,2>{0.437863201f, 0.251334131f},
-std::array<float,2>{0.95680052f, 0.186964825f},
-std::array<float,2>{0.149595976f, 0.815985739f},
-std::array<float,2>{0.679059803f, 0.905301452f},
-std::array<float,2>{0.375080556f, 0.115249433f},
-std::array<float,2>{0.905283451f, 0.393362015f},
-std::array<float,2>{0.231335729f, 0.562976897f},
-std::array<float,2>{0.778968394f, 0.666940391f},
-std::array<float,2>{0.0347910523f, 0.36286369f},
-std::array<float,2>{0.586504877f, 0.235170811f},
-std::array<float,2>{0.369353354f, 0.807379067f},
-std::array<float,2>{0.972815692f, 0.855084002f},
-std::array<float,2>{0.171574458f, 0.133953378f},
-std::array<float,2>{0.697008133f, 0.294443578f},
-std::array<float,2>{0.477115393f, 0.734344125f},
-std::array<float,2>{0.527678072f, 0.540343344f},
-std::array<float,2>{0.306108475f, 0.447654575f},
-std::array<float,2>{0.823415637f, 0.0427266769f},
-std::array<float,2>{0.114849523f, 0.963059127f},
-std::array<float,2>{0.578643322f, 0.90835011f},
-std::array<float,2>{0.360941082f, 0.0701908916f},
-std::array<float,2>{0.771506965f, 0.420060426f},
-std::array<float,2>{0.0407293402f, 0.605341673f},
-std::array<float,2>{0.896722436f, 0.627572f},
-std::array<float,2>{0.225248009f, 0.319105744f},
-std::array<float,2>{0.680417597f, 0.197071016f},
-std::array<float,2>{0.384137809f, 0.754531026f},
-std::array<float,2>{0.818406582f, 0.824141443f},
-std::array<float,2>{0.120300852f, 0.179166719f},
-std::array<float,2>{0.522063553f, 0.258332193f},
-std::array<float,2>{0.297900438f, 0.689540803f},
-std::array<float,2>{0.687781751f, 0.500306964f},
-std::array<float,2>{0.472776741f, 0.497110844f},
-std::array<float,2>{0.97809124f, 0.0152114276f},
-std::array<float,2>{0.158268243f, 0.989042044f},
-std::array<float,2>{0.642824411f, 0.801530778f},
-std::array<float,2>{0.422479868f, 0.242376238f},
-std::array<float,2>{0.918141723f, 0.367999703f},
-std::array<float,2>{0.19511424f, 0.661102295f},
-std::array<float,2>{0.802416444f, 0.577281892f},
-std::array<float,2>{0.0311543867f, 0.403887331f},
-std::array<float,2>{0.614604712f, 0.123993345f},
-std::array<float,2>{0.341015249f, 0.898121893f},
-std::array<float,2>{0.96577549f, 0.958020747f},
-std::array<float,2>{0.144839928f, 0.0319573991f},
-std::array<float,2>{0.724517524f, 0.439507097f},
-std::array<float,2>{0.451344222f, 0.535144031f},
-std::array<float,2>{0.558257163f, 0.721440494f},
-std::array<float,2>{0.264159858f, 0.287201971f},
-std::array<float,2>{0.871343195f, 0.127970859f},
-std::array<float,2>{0.0805261657f, 0.844631732f},
-std::array<float,2>{0.510731876f, 0.862364709f},
-std::array<float,2>{0.285155863f, 0.149132594f},
-std::array<float,2>{0.841128826f, 0.306729227f},
-std::array<float,2>{0.0963872671f, 0.74740541f},
-std::array<float,2>{0.988098502f, 0.556551516f},
-std::array<float,2>{0.177963838f, 0.46015659f},
-std::array<float,2>{0.715132654f, 0.0567382686f},
-std::array<float,2>{0.490430653f, 0.953002632f},
-std::array<float,2>{0.763695359f, 0.886967123f},
-std::array<float,2>{0.0574042797f, 0.0955901891f},
-std::array<float,2>{0.574395299f, 0.37597841f},
-std::array<float,2>{0.354711473f, 0.582505822f},
-std::array<float,2>{0.662107706f, 0.672777236f},
-std::array<float,2>{0.404856235f, 0.35340184f},
-std::array<float,2>{0.884476542f, 0.227791756f},
-std::array<float,2>{0.235407278f, 0.789456606f},
-std::array<float,2>{0.735691667f, 0.974791348f},
-std::array<float,2>{0.468702108f, 0.0275115576f},
-std::array<float,2>{0.948961556f, 0.481679618f},
-std::array<float,2>{0.132939756f, 0.527959585f},
-std::array<float,2>{0.850666881f, 0.716412485f},
-std::array<float,2>{0.070478335f, 0.27585265f},
-std::array<float,2>{0.538566768f, 0.157077894f},
-std::array<float,2>{0.272208214f, 0.840042353f},
-std::array<float,2>{0.931358933f, 0.770586193f},
-std::array<float,2>{0.213588104f, 0.206031889f},
-std::array<float,2>{0.628959894f, 0.336072028f},
-std::array<float,2>{0.419969469f, 0.644490659f},
-std::array<float,2>{0.608762383f, 0.615242302f},
-std::array<float,2>{0.31950888f, 0.428742081f},
-std::array<float,2>{0.78930527f, 0.0864744559f},
-std::array<float,2>{0.000175136563f, 0.927418053f},
-std::array<float,2>{0.599916697f, 0.988028347f},
-std::array<float,2>{0.327071637f, 0.0109363962f},
-std::array<float,2>{0.783805847f, 0.494555831f},
-std::array<float,2>{0.0116554582f, 0.507750988f},
-std::array<float,2>{0.922304869f, 0.691877544f},
-std::array<float,2>{0.203822523f, 0.262744606f},
-std::array<float,2>{0.637399197f, 0.175530478f},
-std::array<float,2>{0.413466603f, 0.825560391f},
-std::array<float,2>{0.853639722f, 0.752877176f},
-std::array<float,2>{0.0663122311f, 0.201523587f},
-std::array<float,2>{0.544163167f, 0.314237833f},
-std::array<float,2>{0.273959219f, 0.631929994f},
-std::array<float,2>{0.747235894f, 0.606951118f},
-std::array<float,2>{0.460892439f, 0.414418727f},
-std::array<float,2>{0.938649237f, 0.0642452464f},
-std::array<float,2>{0.12943925f, 0.912287831f},
-std::array<float,2>{0.669476688f, 0.849644721f},
-std::array<float,2>{0.397606969f, 0.132765993f},
-std::array<float,2>{0.882196665f, 0.281489849f},
-std::array<float,2>{0.246477023f, 0.724387407f},
-std::array<float,2>{0.755057514f, 0.537558913f},
-std::array<float,2>{0.0521561205f, 0.444414258f},
-std::array<float,2>{0.570156336f, 0.0378760099f},
-std::array<float,2>{0.345721215f, 0.953912377f},
-std::array<float,2>{0.999365926f, 0.890638471f},
-std::array<float,2>{0.180391729f, 0.117349103f},
-std::array<float,2>{0.70740068f, 0.399079472f},
-std::array<float,2>{0.497889429f, 0.571289659f},
-std::array<float,2>{0.503312767f, 0.656790555f},
-std::array<float,2>{0.293135881f, 0.371985018f},
-std::array<float,2>{0.835354626f, 0.248450637f},
-std::array<float,2>{0.10371618f, 0.79695487f},
-std::array<float,2>{0.548184991f, 0.796169996f},
-std::array<float,2>{0.255983233f, 0.232392728f},
-std::array<float,2>{0.861334383f, 0.358812273f},
-std::array<float,2>{0.0884817094f, 0.678851962f},
-std::array<float,2>{0.957510889f, 0.581842661f},
-std::array<float,2>{0.153614283f, 0.381437927f},
-std::array<float,2>{0.729944825f, 0.0983244404f},
-std::array<float,2>{0.443796307f, 0.882893801f},
-std::array<float,2>{0.809194684f, 0.947440922f},
-std::array<float,2>{0.0202099644f, 0.0616052151f},
-std::array<float,2>{0.623624206f, 0.4537462f},
-std::array<float,2>{0.331269711f, 0.558707476f},
-std::array<float,2>{0.653558135f, 0.742789984f},
-std::array<float,2>{0.437265635f, 0.309386373f},
-std::array<float,2>{0.913882315f, 0.155622333f},
-std::array<float,2>{0.199099347f, 0.86638844f},
-std::array<float,2>{0.701469123f, 0.925271451f},
-std::array<float,2>{0.481415838f, 0.0898640305f},
-std::array<float,2>{0.972355247f, 0.424993664f},
-std::array<float,2>{0.167366728f, 0.611465752f},
-std::array<float,2>{0.826901078f, 0.646473765f},
-std::array<float,2>{0.11184518f, 0.34006831f},
-std::array<float,2>{0.527251005f, 0.207438454f},
-std::array<float,2>{0.310072452f, 0.768776059f},
-std::array<float,2>{0.899889886f, 0.838536263f},
-std::array<float,2>{0.23004359f, 0.160798728f},
-std::array<float,2>{0.675293624f, 0.277426749f},
-std::array<float,2>{0.380437285f, 0.712073684f},
-std::array<float,2>{0.591946483f, 0.524054766f},
-std::array<float,2>{0.374857962f, 0.477119535f},
-std::array<float,2>{0.7769894f, 0.0260418709f},
-std::array<float,2>{0.03830323f, 0.970074952f},
-std::array<float,2>{0.519138396f, 0.881487489f},
-std::array<float,2>{0.303767681f, 0.105861709f},
-std::array<float,2>{0.815061629f, 0.385939151f},
-std::array<float,2>{0.122393474f, 0.587696254f},
-std::array<float,2>{0.9842453f, 0.68204087f},
-std::array<float,2>{0.160685435f, 0.351509243f},
-std::array<float,2>{0.693749726f, 0.218804941f},
-std::array<float,2>{0.470143169f, 0.783427238f},
-std::array<float,2>{0.765642285f, 0.873676717f},
-std::array<float,2>{0.0431903787f, 0.142402217f},
-std::array<float,2>{0.584928751f, 0.300116003f},
-std::array<float,2>{0.365342736f, 0.735386074f},
-std::array<float,2>{0.687373459f, 0.547170222f},
-std::array<float,2>{0.387617946f, 0.462569058f},
-std::array<float,2>{0.892090499f, 0.0526792817f},
-std::array<float,2>{0.222185388f, 0.944772482f},
-std::array<float,2>{0.719453096f, 0.773645639f},
-std::array<float,2>{0.445618451f, 0.217827603f},
-std::array<float,2>{0.963963032f, 0.328514993f},
-std::array<float,2>{0.140974224f, 0.649225771f},
-std::array<float,2>{0.869585335f, 0.624245226f},
-std::array<float,2>{0.0851211399f, 0.43201068f},
-std::array<float,2>{0.561214149f, 0.0852366388f},
-std::array<float,2>{0.259073436f, 0.936205626f},
-std::array<float,2>{0.916415393f, 0.978337705f},
-std::array<float,2>{0.189598233f, 0.0211297162f},
-std::array<float,2>{0.646752238f, 0.475661665f},
-std::array<float,2>{0.429198056f, 0.518874109f},
-std::array<float,2>{0.613099754f, 0.708039999f},
-std::array<float,2>{0.336778641f, 0.268408179f},
-std::array<float,2>{0.797049046f, 0.166313708f},
-std::array<float,2>{0.0253481567f, 0.832934201f},
-std::array<float,2>{0.57218796f, 0.818173826f},
-std::array<float,2>{0.357613236f, 0.180913165f},
-std::array<float,2>{0.760737836f, 0.254861593f},
-std::array<float,2>{0.0591099858f, 0.701237142f},
-std::array<float,2>{0.88834095f, 0.514282644f},
-std::array<float,2>{0.241130009f, 0.486865789f},
-std::array<float,2>{0.659697413f, 0.00233048503f},
-std::array<float,2>{0.398782223f, 0.992676497f},
-std::array<float,2>{0.837687552f, 0.917053044f},
-std::array<float,2>{0.0989139527f, 0.0730746761f},
-std::array<float,2>{0.513123453f, 0.410245359f},
-std::array<float,2>{0.285477251f, 0.598579049f},
-std::array<float,2>{0.711664081f, 0.634610057f},
-std::array<float,2>{0.486440957f, 0.326359332f},
-std::array<float,2>{0.991578341f, 0.189296693f},
-std::array<float,2>{0.17327255f, 0.7600528f},
-std::array<float,2>{0.625740409f, 0.96720469f},
-std::array<float,2>{0.417027056f, 0.0441219807f},
-std::array<float,2>{0.935707033f, 0.449728966f},
-std::array<float,2>{0.216187119f, 0.544113934f},
-std::array<float,2>{0.795921862f, 0.728978157f},
-std::array<float,2>{0.00444478123f, 0.289323032f},
-std::array<float,2>{0.60213238f, 0.13973771f},
-std::array<float,2>{0.314437807f, 0.855804443f},
-std::array<float,2>{0.952530086f, 0.811881006f},
-std::array<float,2>{0.138377637f, 0.24073875f},
-std::array<float,2>{0.740357518f, 0.364799201f},
-std::array<float,2>{0.462526798f, 0.670409203f},
-std::array<float,2>{0.534648776f, 0.566946805f},
-std::array<float,2>{0.269121051f, 0.398013949f},
-std::array<float,2>{0.847236216f, 0.109521709f},
-std::array<float,2>{0.0749058947f, 0.898789346f},
-std::array<float,2>{0.553668022f, 0.999846101f},
-std::array<float,2>{0.253612131f, 0.00403864076f},
-std::array<float,2>{0.864274323f, 0.489797562f},
-std::array<float,2>{0.0912219733f, 0.50792563f},
-std::array<float,2>{0.95595336f, 0.698358119f},
-std::array<float,2>{0.149000034f, 0.25354296f},
-std::array<float,2>{0.733957291f, 0.183736145f},
-std::array<float,2>{0.439196259f, 0.814112484f},
-std::array<float,2>{0.808155477f, 0.762610793f},
-std::array<float,2>{0.0161757022f, 0.193249226f},
-std::array<float,2>{0.617897749f, 0.321097463f},
-std::array<float,2>{0.333393067f, 0.63889432f},
-std::array<float,2>{0.649871409f, 0.597024918f},
-std::array<float,2>{0.430202097f, 0.407899976f},
-std::array<float,2>{0.908944845f, 0.0749775097f},
-std::array<float,2>{0.20272328f, 0.918590009f},
-std::array<float,2>{0.696104527f, 0.852240324f},
-std::array<float,2>{0.478437781f, 0.135975257f},
-std::array<float,2>{0.973990262f, 0.295615226f},
-std::array<float,2>{0.170898065f, 0.731266499f},
-std::array<float,2>{0.822367072f, 0.542668164f},
-std::array<float,2>{0.113677554f, 0.445766598f},
-std::array<float,2>{0.528679907f, 0.0399270542f},
-std::array<float,2>{0.304844588f, 0.961719036f},
-std::array<float,2>{0.904337287f, 0.90262115f},
-std::array<float,2>{0.232023299f, 0.115228638f},
-std::array<float,2>{0.678153455f, 0.392345935f},
-std::array<float,2>{0.376642436f, 0.565577567f},
-std::array<float,2>{0.587261379f, 0.665471494f},
-std::array<float,2>{0.370195419f, 0.360897422f},
-std::array<float,2>{0.777927637f, 0.237406641f},
-std::array<float,2>{0.0341104269f, 0.805462718f},
-std::array<float,2>{0.594169319f, 0.786786437f},
-std::array<float,2>{0.322620898f, 0.225938082f},
-std::array<float,2>{0.786573946f, 0.34505558f},
-std::array<float,2>{0.012520548f, 0.685342431f},
-std::array<float,2>{0.927899063f, 0.59214288f},
-std::array<float,2>{0.209087819f, 0.389035404f},
-std::array<float,2>{0.635645151f, 0.101680771f},
-std::array<float,2>{0.407828927f, 0.877162337f},
-std::array<float,2>{0.858141482f, 0.939676881f},
-std::array<float,2>{0.0700863674f, 0.0490935631f},
-std::array<float,2>{0.541953921f, 0.466898501f},
-std::array<float,2>{0.280709714f, 0.552246451f},
-std::array<float,2>{0.745623291f, 0.739672422f},
-std::array<float,2>{0.454920977f, 0.30351299f},
-std::array<float,2>{0.9451949f, 0.147176236f},
-std::array<float,2>{0.126099244f, 0.869394243f},
-std::array<float,2>{0.664912403f, 0.932904243f},
-std::array<float,2>{0.391483635f, 0.0793552995f},
-std::array<float,2>{0.875237942f, 0.436207205f},
-std::array<float,2>{0.243030071f, 0.618957281f},
-std::array<float,2>{0.750025928f, 0.654539764f},
-std::array<float,2>{0.048845116f, 0.335592538f},
-std::array<float,2>{0.563348174f, 0.213609844f},
-std::array<float,2>{0.347764432f, 0.777646899f},
-std::array<float,2>{0.993696988f, 0.831556499f},
-std::array<float,2>{0.183734015f, 0.171758607f},
-std::array<float,2>{0.703393161f, 0.270273626f},
-std::array<float,2>{0.493972957f, 0.704414546f},
-std::array<float,2>{0.507737875f, 0.521455586f},
-std::array<float,2>{0.292156249f, 0.470962375f},
-std::array<float,2>{0.82868439f, 0.0173907503f},
-std::array<float,2>{0.107619181f, 0.984288573f},
-std::array<float,2>{0.57591635f, 0.890354574f},
-std::array<float,2>{0.353931725f, 0.0962646306f},
-std::array<float,2>{0.765271127f, 0.377292603f},
-std::array<float,2>{0.0581574887f, 0.585100353f},
-std::array<float,2>{0.883533001f, 0.674066067f},
-std::array<float,2>{0.234972239f, 0.35472092f},
-std::array<float,2>{0.660299182f, 0.229996726f},
-std::array<float,2>{0.406033725f, 0.791985333f},
-std::array<float,2>{0.840233445f, 0.859902978f},
-std::array<float,2>{0.0970255062f, 0.152332991f},
-std::array<float,2>{0.511249661f, 0.306271583f},
-std::array<float,2>{0.284021944f, 0.749450624f},
-std::array<float,2>{0.71655798f, 0.557577133f},
-std::array<float,2>{0.491672993f, 0.45867753f},
-std::array<float,2>{0.986509144f, 0.054850217f},
-std::array<float,2>{0.178950295f, 0.950432539f},
-std::array<float,2>{0.630042732f, 0.773297548f},
-std::array<float,2>{0.420972735f, 0.20353353f},
-std::array<float,2>{0.929983675f, 0.339622021f},
-std::array<float,2>{0.214754343f, 0.641860723f},
-std::array<float,2>{0.79066968f, 0.613757968f},
-std::array<float,2>{0.00131071021f, 0.427420437f},
-std::array<float,2>{0.607650995f, 0.0891645551f},
-std::array<float,2>{0.31854707f, 0.92883265f},
-std::array<float,2>{0.947968662f, 0.974500954f},
-std::array<float,2>{0.134062678f, 0.0307739619f},
-std::array<float,2>{0.734543681f, 0.483555228f},
-std::array<float,2>{0.467598289f, 0.529860139f},
-std::array<float,2>{0.537723601f, 0.717007279f},
-std::array<float,2>{0.273390591f, 0.274580896f},
-std::array<float,2>{0.85010457f, 0.159260705f},
-std::array<float,2>{0.071495764f, 0.843148649f},
-std::array<float,2>{0.522800028f, 0.821589351f},
-std::array<float,2>{0.29688701f, 0.176765293f},
-std::array<float,2>{0.820183158f, 0.261353403f},
-std::array<float,2>{0.119701467f, 0.688613713f},
-std::array<float,2>{0.977237999f, 0.502305448f},
-std::array<float,2>{0.15976961f, 0.499714285f},
-std::array<float,2>{0.689127207f, 0.0136050452f},
-std::array<float,2>{0.474217802f, 0.990769148f},
-std::array<float,2>{0.772900283f, 0.907120347f},
-std::array<float,2>{0.0395436436f, 0.0670604631f},
-std::array<float,2>{0.580013871f, 0.419797689f},
-std::array<float,2>{0.360243142f, 0.60188961f},
-std::array<float,2>{0.681591094f, 0.626819611f},
-std::array<float,2>{0.382951915f, 0.317392409f},
-std::array<float,2>{0.897971332f, 0.198279187f},
-std::array<float,2>{0.225775495f, 0.756172478f},
-std::array<float,2>{0.722719908f, 0.959956586f},
-std::array<float,2>{0.452676177f, 0.0346159264f},
-std::array<float,2>{0.966418922f, 0.438660681f},
-std::array<float,2>{0.145873338f, 0.533178985f},
-std::array<float,2>{0.872419477f, 0.720324159f},
-std::array<float,2>{0.0814789906f, 0.285334349f},
-std::array<float,2>{0.556685865f, 0.125147387f},
-std::array<float,2>{0.265358537f, 0.845831752f},
-std::array<float,2>{0.91922313f, 0.803011656f},
-std::array<float,2>{0.193584517f, 0.244693115f},
-std::array<float,2>{0.643933415f, 0.369471401f},
-std::array<float,2>{0.423492461f, 0.663820207f},
-std::array<float,2>{0.613506794f, 0.574979424f},
-std::array<float,2>{0.34027794f, 0.405492127f},
-std::array<float,2>{0.800935626f, 0.122972563f},
-std::array<float,2>{0.0297433101f, 0.896355987f},
-std::array<float,2>{0.624742031f, 0.946776748f},
-std::array<float,2>{0.330542624f, 0.0604737289f},
-std::array<float,2>{0.810525f, 0.456550628f},
-std::array<float,2>{0.0209320541f, 0.561896682f},
-std::array<float,2>{0.912603915f, 0.745247841f},
-std::array<float,2>{0.19822523f, 0.310928285f},
-std::array<float,2>{0.652634203f, 0.153377101f},
-std::array<float,2>{0.436078638f, 0.863945663f},
-std::array<float,2>{0.862646401f, 0.793772519f},
-std::array<float,2>{0.0894084796f, 0.23282446f},
-std::array<float,2>{0.547236383f, 0.357332498f},
-std::array<float,2>{0.257050276f, 0.677535534f},
-std::array<float,2>{0.728582621f, 0.578231633f},
-std::array<float,2>{0.444459736f, 0.380014002f},
-std::array<float,2>{0.958702624f, 0.0996656418f},
-std::array<float,2>{0.152687222f, 0.885073185f},
-std::array<float,2>{0.674017191f, 0.837022364f},
-std::array<float,2>{0.379058599f, 0.163127765f},
-std::array<float,2>{0.898987234f, 0.280300766f},
-std::array<float,2>{0.229332075f, 0.713132203f},
-std::array<float,2>{0.776071608f, 0.526612639f},
-std::array<float,2>{0.037636824f, 0.478641838f},
-std::array<float,2>{0.592939496f, 0.0240117889f},
-std::array<float,2>{0.373781979f, 0.971835911f},
-std::array<float,2>{0.971043587f, 0.923376441f},
-std::array<float,2>{0.16651462f, 0.0928207189f},
-std::array<float,2>{0.703107536f, 0.423761994f},
-std::array<float,2>{0.48191908f, 0.610541403f},
-std::array<float,2>{0.525967121f, 0.647050261f},
-std::array<float,2>{0.309246212f, 0.34188661f},
-std::array<float,2>{0.827683866f, 0.209490046f},
-std::array<float,2>{0.112701155f, 0.766086638f},
-std::array<float,2>{0.54314059f, 0.750812113f},
-std::array<float,2>{0.27448833f, 0.200530514f},
-std::array<float,2>{0.855382442f, 0.316133589f},
-std::array<float,2>{0.0653777793f, 0.630215466f},
-std::array<float,2>{0.937789679f, 0.608924031f},
-std::array<float,2>{0.130022123f, 0.417881966f},
-std::array<float,2>{0.746951163f, 0.0658804029f},
-std::array<float,2>{0.459880948f, 0.911543131f},
-std::array<float,2>{0.784847975f, 0.984404564f},
-std::array<float,2>{0.0106909303f, 0.00952498149f},
-std::array<float,2>{0.601077855f, 0.492665797f},
-std::array<float,2>{0.327846736f, 0.503996253f},
-std::array<float,2>{0.638288975f, 0.694585383f},
-std::array<float,2>{0.412224352f, 0.264330298f},
-std::array<float,2>{0.923370779f, 0.173266694f},
-std::array<float,2>{0.204176098f, 0.827685773f},
-std::array<float,2>{0.70805186f, 0.893903017f},
-std::array<float,2>{0.496508241f, 0.121040918f},
-std::array<float,2>{0.998984873f, 0.402155817f},
-std::array<float,2>{0.181246206f, 0.574180186f},
-std::array<float,2>{0.834043205f, 0.659635007f},
-std::array<float,2>{0.104933776f, 0.37484768f},
-std::array<float,2>{0.502528727f, 0.247084007f},
-std::array<float,2>{0.294555664f, 0.80035156f},
-std::array<float,2>{0.88152957f, 0.848311067f},
-std::array<float,2>{0.247697443f, 0.129296914f},
-std::array<float,2>{0.668653667f, 0.284800261f},
-std::array<float,2>{0.396741152f, 0.724648595f},
-std::array<float,2>{0.568455756f, 0.53561753f},
-std::array<float,2>{0.347365946f, 0.442409396f},
-std::array<float,2>{0.754627168f, 0.0358965211f},
-std::array<float,2>{0.0516306013f, 0.956047714f},
-std::array<float,2>{0.511865377f, 0.91495043f},
-std::array<float,2>{0.286154658f, 0.0719062239f},
-std::array<float,2>{0.835982323f, 0.412162781f},
-std::array<float,2>{0.0977140442f, 0.601103246f},
-std::array<float,2>{0.990744293f, 0.635759473f},
-std::array<float,2>{0.1727245f, 0.325226724f},
-std::array<float,2>{0.712869823f, 0.190112159f},
-std::array<float,2>{0.488108158f, 0.758864284f},
-std::array<float,2>{0.760916293f, 0.818983912f},
-std::array<float,2>{0.0600126497f, 0.183542877f},
-std::array<float,2>{0.571247578f, 0.256783575f},
-std::array<float,2>{0.358867764f, 0.700578213f},
-std::array<float,2>{0.658442557f, 0.513118923f},
-std::array<float,2>{0.400258094f, 0.485926628f},
-std::array<float,2>{0.886991799f, 0.000374844763f},
-std::array<float,2>{0.241841882f, 0.99419874f},
-std::array<float,2>{0.74211067f, 0.809038639f},
-std::array<float,2>{0.4613159f, 0.240041569f},
-std::array<float,2>{0.951788485f, 0.366771102f},
-std::array<float,2>{0.137344718f, 0.669103205f},
-std::array<float,2>{0.846007407f, 0.569895566f},
-std::array<float,2>{0.0761127919f, 0.394892871f},
-std::array<float,2>{0.534060299f, 0.111399204f},
-std::array<float,2>{0.267894864f, 0.901637852f},
-std::array<float,2>{0.936617434f, 0.966607153f},
-std::array<float,2>{0.215335056f, 0.0465491712f},
-std::array<float,2>{0.626073897f, 0.452577293f},
-std::array<float,2>{0.416915119f, 0.546708822f},
-std::array<float,2>{0.602834046f, 0.728212476f},
-std::array<float,2>{0.313043356f, 0.291537553f},
-std::array<float,2>{0.795282423f, 0.136957332f},
-std::array<float,2>{0.00541965244f, 0.858516037f},
-std::array<float,2>{0.585009873f, 0.872571945f},
-std::array<float,2>{0.366944253f, 0.142663836f},
-std::array<float,2>{0.766703665f, 0.297660232f},
-std::array<float,2>{0.0442612097f, 0.737133086f},
-std::array<float,2>{0.890662253f, 0.550430417f},
-std::array<float,2>{0.220909283f, 0.464516312f},
-std::array<float,2>{0.685961187f, 0.0536825359f},
-std::array<float,2>{0.388020456f, 0.942550838f},
-std::array<float,2>{0.815525055f, 0.880739391f},
-std::array<float,2>{0.121695042f, 0.107596405f},
-std::array<float,2>{0.518521667f, 0.384394616f},
-std::array<float,2>{0.302820235f, 0.588264108f},
-std::array<float,2>{0.695017159f, 0.680525839f},
-std::array<float,2>{0.46889165f, 0.348931849f},
-std::array<float,2>{0.982704878f, 0.221848994f},
-std::array<float,2>{0.161876902f, 0.783182919f},
-std::array<float,2>{0.647875369f, 0.979693651f},
-std::array<float,2>{0.427738518f, 0.0215766355f},
-std::array<float,2>{0.917357385f, 0.473411024f},
-std::array<float,2>{0.191329241f, 0.516578674f},
-std::array<float,2>{0.798455179f, 0.709919095f},
-std::array<float,2>{0.0237540286f, 0.26628688f},
-std::array<float,2>{0.611764073f, 0.16443871f},
-std::array<float,2>{0.337292463f, 0.835886002f},
-std::array<float,2>{0.963650823f, 0.776273966f},
-std::array<float,2>{0.1417218f, 0.216074303f},
-std::array<float,2>{0.719871819f, 0.330264062f},
-std::array<float,2>{0.446993291f, 0.651277006f},
-std::array<float,2>{0.561862648f, 0.622749269f},
-std::array<float,2>{0.257893473f, 0.430066764f},
-std::array<float,2>{0.870339155f, 0.0831232369f},
-std::array<float,2>{0.0841518715f, 0.935064793f},
-std::array<float,2>{0.530145168f, 0.964348614f},
-std::array<float,2>{0.307445139f, 0.04146602f},
-std::array<float,2>{0.821073651f, 0.449173957f},
-std::array<float,2>{0.115288876f, 0.539955556f},
-std::array<float,2>{0.97582984f, 0.732579291f},
-std::array<float,2>{0.169305414f, 0.29383412f},
-std::array<float,2>{0.698525846f, 0.13290967f},
-std::array<float,2>{0.479475647f, 0.854430735f},
-std::array<float,2>{0.780892551f, 0.80784595f},
-std::array<float,2>{0.0320884399f, 0.236324549f},
-std::array<float,2>{0.589401066f, 0.361878574f},
-std::array<float,2>{0.367875189f, 0.667360306f},
-std::array<float,2>{0.675936401f, 0.563550174f},
-std::array<float,2>{0.377005696f, 0.393851817f},
-std::array<float,2>{0.903965294f, 0.116910249f},
-std::array<float,2>{0.232530698f, 0.904652774f},
-std::array<float,2>{0.731985807f, 0.814906359f},
-std::array<float,2>{0.441135764f, 0.186408922f},
-std::array<float,2>{0.954973817f, 0.250814497f},
-std::array<float,2>{0.150722429f, 0.697093427f},
-std::array<float,2>{0.866227746f, 0.510080755f},
-std::array<float,2>{0.0931071937f, 0.491422266f},
-std::array<float,2>{0.552225828f, 0.00647515897f},
-std::array<float,2>{0.251347691f, 0.997788489f},
-std::array<float,2>{0.907018781f, 0.921736181f},
-std::array<float,2>{0.199894235f, 0.078079015f},
-std::array<float,2>{0.651144862f, 0.408727795f},
-std::array<float,2>{0.432526946f, 0.595129669f},
-std::array<float,2>{0.620960057f, 0.637883067f},
-std::array<float,2>{0.335704714f, 0.324063748f},
-std::array<float,2>{0.805046201f, 0.193725541f},
-std::array<float,2>{0.0185344834f, 0.764050603f},
-std::array<float,2>{0.564875841f, 0.780261517f},
-std::array<float,2>{0.351222724f, 0.212051988f},
-std::array<float,2>{0.752888262f, 0.33321929f},
-std::array<float,2>{0.0484074168f, 0.65422523f},
-std::array<float,2>{0.878540456f, 0.619625628f},
-std::array<float,2>{0.246087477f, 0.435009211f},
-std::array<float,2>{0.666414261f, 0.0807608441f},
-std::array<float,2>{0.394159198f, 0.930673122f},
-std::array<float,2>{0.831945896f, 0.980770528f},
-std::array<float,2>{0.10604538f, 0.018791439f},
-std::array<float,2>{0.504926383f, 0.46896413f},
-std::array<float,2>{0.290703267f, 0.521564245f},
-std::array<float,2>{0.706658363f, 0.705521762f},
-std::array<float,2>{0.494597107f, 0.271491975f},
-std::array<float,2>{0.995713413f, 0.168710515f},
-std::array<float,2>{0.187247753f, 0.82925576f},
-std::array<float,2>{0.634446383f, 0.876475394f},
-std::array<float,2>{0.408475339f, 0.104132123f},
-std::array<float,2>{0.925929785f, 0.387283593f},
-std::array<float,2>{0.208070308f, 0.590529919f},
-std::array<float,2>{0.788766503f, 0.686818779f},
-std::array<float,2>{0.0155789834f, 0.346367449f},
-std::array<float,2>{0.596260905f, 0.223624513f},
-std::array<float,2>{0.321677297f, 0.787777603f},
-std::array<float,2>{0.943268061f, 0.868268609f},
-std::array<float,2>{0.127271056f, 0.146306202f},
-std::array<float,2>{0.742732465f, 0.302503884f},
-std::array<float,2>{0.456556171f, 0.740919709f},
-std::array<float,2>{0.54036659f, 0.554040134f},
-std::array<float,2>{0.278093368f, 0.465913624f},
-std::array<float,2>{0.855469048f, 0.0469922423f},
-std::array<float,2>{0.0665588602f, 0.93910265f},
-std::array<float,2>{0.60677284f, 0.925812066f},
-std::array<float,2>{0.317392856f, 0.0873414502f},
-std::array<float,2>{0.792234421f, 0.428297758f},
-std::array<float,2>{0.0023569339f, 0.616870999f},
-std::array<float,2>{0.932335615f, 0.64290601f},
-std::array<float,2>{0.212554395f, 0.337309241f},
-std::array<float,2>{0.632607341f, 0.206187561f},
-std::array<float,2>{0.419557899f, 0.770011067f},
-std::array<float,2>{0.848160386f, 0.84138757f},
-std::array<float,2>{0.0737461597f, 0.15734762f},
-std::array<float,2>{0.535397947f, 0.276972473f},
-std::array<float,2>{0.271431237f, 0.715765059f},
-std::array<float,2>{0.737713873f, 0.528847575f},
-std::array<float,2>{0.466536999f, 0.480801821f},
-std::array<float,2>{0.946365535f, 0.0284899212f},
-std::array<float,2>{0.135968834f, 0.975932181f},
-std::array<float,2>{0.663008571f, 0.790667892f},
-std::array<float,2>{0.403435349f, 0.227502123f},
-std::array<float,2>{0.885469973f, 0.351660073f},
-std::array<float,2>{0.237318158f, 0.673708618f},
-std::array<float,2>{0.762145936f, 0.583441794f},
-std::array<float,2>{0.0556999445f, 0.375122696f},
-std::array<float,2>{0.577932179f, 0.0942199007f},
-std::array<float,2>{0.352630228f, 0.888433456f},
-std::array<float,2>{0.984877944f, 0.951179624f},
-std::array<float,2>{0.176318884f, 0.0577774383f},
-std::array<float,2>{0.717366934f, 0.459335685f},
-std::array<float,2>{0.489267886f, 0.555141032f},
-std::array<float,2>{0.509734333f, 0.746158421f},
-std::array<float,2>{0.282149285f, 0.307649314f},
-std::array<float,2>{0.84224844f, 0.149708867f},
-std::array<float,2>{0.0945002437f, 0.861602545f},
-std::array<float,2>{0.554896235f, 0.845580935f},
-std::array<float,2>{0.261843234f, 0.127894983f},
-std::array<float,2>{0.874827266f, 0.288864404f},
-std::array<float,2>{0.0789466277f, 0.722132385f},
-std::array<float,2>{0.968035161f, 0.533756733f},
-std::array<float,2>{0.147347227f, 0.440766662f},
-std::array<float,2>{0.725339472f, 0.0331644006f},
-std::array<float,2>{0.449246317f, 0.957722723f},
-std::array<float,2>{0.804462314f, 0.897200286f},
-std::array<float,2>{0.028844079f, 0.124675408f},
-std::array<float,2>{0.616629899f, 0.402431697f},
-std::array<float,2>{0.343594342f, 0.577058554f},
-std::array<float,2>{0.642168403f, 0.662080705f},
-std::array<float,2>{0.424507171f, 0.368286252f},
-std::array<float,2>{0.92020458f, 0.243264452f},
-std::array<float,2>{0.192366257f, 0.801809132f},
-std::array<float,2>{0.689924002f, 0.989489198f},
-std::array<float,2>{0.476469666f, 0.0142171094f},
-std::array<float,2>{0.979281425f, 0.49632144f},
-std::array<float,2>{0.156793237f, 0.501438797f},
-std::array<float,2>{0.817949235f, 0.691116452f},
-std::array<float,2>{0.117649853f, 0.25940147f},
-std::array<float,2>{0.520798445f, 0.178227425f},
-std::array<float,2>{0.300137669f, 0.822686434f},
-std::array<float,2>{0.895338953f, 0.755427241f},
-std::array<float,2>{0.224444136f, 0.195788339f},
-std::array<float,2>{0.682658136f, 0.319844872f},
-std::array<float,2>{0.386126161f, 0.628419697f},
-std::array<float,2>{0.581537843f, 0.603701651f},
-std::array<float,2>{0.362636238f, 0.421525866f},
-std::array<float,2>{0.770793319f, 0.0691007376f},
-std::array<float,2>{0.0425838083f, 0.909843743f},
-std::array<float,2>{0.59041661f, 0.968931377f},
-std::array<float,2>{0.372389376f, 0.027151512f},
-std::array<float,2>{0.774880528f, 0.477587849f},
-std::array<float,2>{0.0354729369f, 0.525262535f},
-std::array<float,2>{0.902270377f, 0.711877584f},
-std::array<float,2>{0.227274641f, 0.278903931f},
-std::array<float,2>{0.672148526f, 0.161463052f},
-std::array<float,2>{0.382190317f, 0.839720011f},
-std::array<float,2>{0.824681818f, 0.768243015f},
-std::array<float,2>{0.110320672f, 0.208458394f},
-std::array<float,2>{0.523867488f, 0.340977997f},
-std::array<float,2>{0.31080389f, 0.644863307f},
-std::array<float,2>{0.699261844f, 0.612616301f},
-std::array<float,2>{0.484020561f, 0.424034446f},
-std::array<float,2>{0.970626891f, 0.0914721042f},
-std::array<float,2>{0.164231256f, 0.924296141f},
-std::array<float,2>{0.654653549f, 0.865763962f},
-std::array<float,2>{0.435444862f, 0.154872924f},
-std::array<float,2>{0.911337614f, 0.310170114f},
-std::array<float,2>{0.19669874f, 0.743360341f},
-std::array<float,2>{0.81233418f, 0.560073137f},
-std::array<float,2>{0.0221587922f, 0.455045998f},
-std::array<float,2>{0.622259915f, 0.0609682798f},
-std::array<float,2>{0.329693586f, 0.948858619f},
-std::array<float,2>{0.959164381f, 0.883951306f},
-std::array<float,2>{0.155376703f, 0.099496834f},
-std::array<float,2>{0.727921546f, 0.382611066f},
-std::array<float,2>{0.443009317f, 0.580197275f},
-std::array<float,2>{0.549593866f, 0.677832246f},
-std::array<float,2>{0.255826324f, 0.357882589f},
-std::array<float,2>{0.861130059f, 0.231353119f},
-std::array<float,2>{0.0867153183f, 0.79523325f},
-std::array<float,2>{0.501426578f, 0.79869318f},
-std::array<float,2>{0.295100003f, 0.249524906f},
-std::array<float,2>{0.832086205f, 0.372358382f},
-std::array<float,2>{0.10202387f, 0.657290459f},
-std::array<float,2>{0.99644798f, 0.570393384f},
-std::array<float,2>{0.181834713f, 0.400210589f},
-std::array<float,2>{0.710711658f, 0.118945748f},
-std::array<float,2>{0.499445051f, 0.892254829f},
-std::array<float,2>{0.756536126f, 0.954668105f},
-std::array<float,2>{0.0541325994f, 0.0382481702f},
-std::array<float,2>{0.566786408f, 0.443826795f},
-std::array<float,2>{0.345693916f, 0.538183391f},
-std::array<float,2>{0.670925736f, 0.723344982f},
-std::array<float,2>{0.395875812f, 0.282852799f},
-std::array<float,2>{0.880183637f, 0.131122321f},
-std::array<float,2>{0.249392167f, 0.85121268f},
-std::array<float,2>{0.748246551f, 0.913982749f},
-std::array<float,2>{0.458775938f, 0.0634052604f},
-std::array<float,2>{0.939937294f, 0.415129185f},
-std::array<float,2>{0.131454989f, 0.605933726f},
-std::array<float,2>{0.852133572f, 0.631729901f},
-std::array<float,2>{0.0641417578f, 0.312842935f},
-std::array<float,2>{0.546824753f, 0.202348024f},
-std::array<float,2>{0.275602579f, 0.753649831f},
-std::array<float,2>{0.924802661f, 0.82510668f},
-std::array<float,2>{0.20577459f, 0.173928723f},
-std::array<float,2>{0.639214993f, 0.262358218f},
-std::array<float,2>{0.410393089f, 0.69240725f},
-std::array<float,2>{0.599294543f, 0.506111085f},
-std::array<float,2>{0.324489623f, 0.495629847f},
-std::array<float,2>{0.782806218f, 0.010098191f},
-std::array<float,2>{0.00889873877f, 0.986822665f},
-std::array<float,2>{0.532286942f, 0.899525702f},
-std::array<float,2>{0.266620696f, 0.110568747f},
-std::array<float,2>{0.844379544f, 0.396762311f},
-std::array<float,2>{0.0778066963f, 0.567767084f},
-std::array<float,2>{0.949992836f, 0.671503603f},
-std::array<float,2>{0.140098736f, 0.36347726f},
-std::array<float,2>{0.739077151f, 0.242155224f},
-std::array<float,2>{0.464388072f, 0.811362088f},
-std::array<float,2>{0.794375002f, 0.85679251f},
-std::array<float,2>{0.00758265285f, 0.139615446f},
-std::array<float,2>{0.60370332f, 0.290132016f},
-std::array<float,2>{0.316128999f, 0.729627132f},
-std::array<float,2>{0.6275388f, 0.543840826f},
-std::array<float,2>{0.414748639f, 0.450753748f},
-std::array<float,2>{0.934145987f, 0.0438578837f},
-std::array<float,2>{0.217019692f, 0.967942715f},
-std::array<float,2>{0.713901579f, 0.761283696f},
-std::array<float,2>{0.484949768f, 0.187853023f},
-std::array<float,2>{0.98922658f, 0.327556849f},
-std::array<float,2>{0.174985901f, 0.633653164f},
-std::array<float,2>{0.839496553f, 0.598699629f},
-std::array<float,2>{0.101208583f, 0.412093014f},
-std::array<float,2>{0.514433086f, 0.0739354417f},
-std::array<float,2>{0.288487762f, 0.916422904f},
-std::array<float,2>{0.889576316f, 0.993329704f},
-std::array<float,2>{0.238693729f, 0.00326748402f},
-std::array<float,2>{0.65650779f, 0.487527013f},
-std::array<float,2>{0.401493728f, 0.514832377f},
-std::array<float,2>{0.573028982f, 0.702517152f},
-std::array<float,2>{0.357367039f, 0.255384624f},
-std::array<float,2>{0.758917212f, 0.180116087f},
-std::array<float,2>{0.0621049553f, 0.817359805f},
-std::array<float,2>{0.611185968f, 0.833814681f},
-std::array<float,2>{0.339124352f, 0.16726321f},
-std::array<float,2>{0.800302804f, 0.268879175f},
-std::array<float,2>{0.027127739f, 0.707694769f},
-std::array<float,2>{0.915856421f, 0.517662883f},
-std::array<float,2>{0.187529266f, 0.475283593f},
-std::array<float,2>{0.646156073f, 0.0201923084f},
-std::array<float,2>{0.426463783f, 0.977533042f},
-std::array<float,2>{0.867484272f, 0.937417448f},
-std::array<float,2>{0.0821025521f, 0.0848765746f},
-std::array<float,2>{0.560185015f, 0.433349639f},
-std::array<float,2>{0.261056513f, 0.623578191f},
-std::array<float,2>{0.722260654f, 0.649664938f},
-std::array<float,2>{0.448153645f, 0.329923898f},
-std::array<float,2>{0.961175025f, 0.216977f},
-std::array<float,2>{0.142674938f, 0.774693847f},
-std::array<float,2>{0.683710337f, 0.943428934f},
-std::array<float,2>{0.389627308f, 0.0508532673f},
-std::array<float,2>{0.89307034f, 0.461082578f},
-std::array<float,2>{0.220110297f, 0.548504591f},
-std::array<float,2>{0.769200921f, 0.734740317f},
-std::array<float,2>{0.0449758135f, 0.298993051f},
-std::array<float,2>{0.582073629f, 0.141043961f},
-std::array<float,2>{0.363697946f, 0.874302745f},
-std::array<float,2>{0.980750024f, 0.784586549f},
-std::array<float,2>{0.163364068f, 0.21978344f},
-std::array<float,2>{0.692127943f, 0.349705428f},
-std::array<float,2>{0.471251756f, 0.683037758f},
-std::array<float,2>{0.516920388f, 0.586496234f},
-std::array<float,2>{0.301674664f, 0.384858191f},
-std::array<float,2>{0.813476145f, 0.106729962f},
-std::array<float,2>{0.124379873f, 0.882274568f},
-std::array<float,2>{0.515284061f, 0.994432926f},
-std::array<float,2>{0.287848592f, 4.00173303e-05f},
-std::array<float,2>{0.838788867f, 0.486084759f},
-std::array<float,2>{0.100118443f, 0.512921989f},
-std::array<float,2>{0.989876688f, 0.700437725f},
-std::array<float,2>{0.174372673f, 0.256396115f},
-std::array<float,2>{0.713460505f, 0.183196723f},
-std::array<float,2>{0.486232638f, 0.819215477f},
-std::array<float,2>{0.757949293f, 0.75921309f},
-std::array<float,2>{0.0612199269f, 0.190397426f},
-std::array<float,2>{0.573307931f, 0.325541854f},
-std::array<float,2>{0.356387764f, 0.636179268f},
-std::array<float,2>{0.657842219f, 0.601498425f},
-std::array<float,2>{0.401208997f, 0.412446767f},
-std::array<float,2>{0.88998419f, 0.0722642839f},
-std::array<float,2>{0.239973962f, 0.914560437f},
-std::array<float,2>{0.739891648f, 0.858881176f},
-std::array<float,2>{0.463557482f, 0.137069225f},
-std::array<float,2>{0.950923502f, 0.291840106f},
-std::array<float,2>{0.139363185f, 0.728429675f},
-std::array<float,2>{0.845074415f, 0.546606243f},
-std::array<float,2>{0.0767753199f, 0.452263147f},
-std::array<float,2>{0.53130126f, 0.0467996635f},
-std::array<float,2>{0.266071409f, 0.966359198f},
-std::array<float,2>{0.934860826f, 0.901558995f},
-std::array<float,2>{0.218285099f, 0.1116025f},
-std::array<float,2>{0.628407657f, 0.394764543f},
-std::array<float,2>{0.415602416f, 0.570141554f},
-std::array<float,2>{0.605115354f, 0.669350207f},
-std::array<float,2>{0.314970106f, 0.3669644f},
-std::array<float,2>{0.793612003f, 0.23989889f},
-std::array<float,2>{0.00658200448f, 0.808614314f},
-std::array<float,2>{0.58354789f, 0.782930017f},
-std::array<float,2>{0.36460042f, 0.222092316f},
-std::array<float,2>{0.768350244f, 0.34870702f},
-std::array<float,2>{0.0462860875f, 0.680359244f},
-std::array<float,2>{0.893937707f, 0.58804214f},
-std::array<float,2>{0.218990192f, 0.384639889f},
-std::array<float,2>{0.685266435f, 0.107733846f},
-std::array<float,2>{0.38990128f, 0.880553424f},
-std::array<float,2>{0.814073026f, 0.942691028f},
-std::array<float,2>{0.123269446f, 0.0532965027f},
-std::array<float,2>{0.51638639f, 0.464837849f},
-std::array<float,2>{0.301887363f, 0.55068481f},
-std::array<float,2>{0.69271934f, 0.736968577f},
-std::array<float,2>{0.472579241f, 0.297557354f},
-std::array<float,2>{0.98233676f, 0.142835528f},
-std::array<float,2>{0.163005978f, 0.872947216f},
-std::array<float,2>{0.644652545f, 0.935398161f},
-std::array<float,2>{0.42724967f, 0.0834139436f},
-std::array<float,2>{0.914238274f, 0.429832876f},
-std::array<float,2>{0.188734829f, 0.623038352f},
-std::array<float,2>{0.798924565f, 0.650989711f},
-std::array<float,2>{0.0254802462f, 0.330470711f},
-std::array<float,2>{0.609912395f, 0.216027617f},
-std::array<float,2>{0.338317931f, 0.776092589f},
-std::array<float,2>{0.962196648f, 0.835647941f},
-std::array<float,2>{0.143861026f, 0.164088339f},
-std::array<float,2>{0.721010506f, 0.266412556f},
-std::array<float,2>{0.448441058f, 0.709472895f},
-std::array<float,2>{0.558811486f, 0.516285598f},
-std::array<float,2>{0.259953558f, 0.473156601f},
-std::array<float,2>{0.868522406f, 0.0218438599f},
-std::array<float,2>{0.0839358568f, 0.979915679f},
-std::array<float,2>{0.622013628f, 0.885004103f},
-std::array<float,2>{0.328827441f, 0.100014053f},
-std::array<float,2>{0.810696125f, 0.380331576f},
-std::array<float,2>{0.0233410262f, 0.57845217f},
-std::array<float,2>{0.910274088f, 0.677461267f},
-std::array<float,2>{0.195785165f, 0.357153296f},
-std::array<float,2>{0.655433416f, 0.232449263f},
-std::array<float,2>{0.433678001f, 0.793566525f},
-std::array<float,2>{0.859606624f, 0.864189923f},
-std::array<float,2>{0.0872811377f, 0.153788403f},
-std::array<float,2>{0.550075471f, 0.310601413f},
-std::array<float,2>{0.254443049f, 0.745601416f},
-std::array<float,2>{0.72722733f, 0.561607838f},
-std::array<float,2>{0.442120075f, 0.456927359f},
-std::array<float,2>{0.960671246f, 0.0601648353f},
-std::array<float,2>{0.154847085f, 0.946375012f},
-std::array<float,2>{0.673501015f, 0.765712321f},
-std::array<float,2>{0.381349206f, 0.209857538f},
-std::array<float,2>{0.900950491f, 0.34218061f},
-std::array<float,2>{0.227886021f, 0.647293925f},
-std::array<float,2>{0.773744881f, 0.610769689f},
-std::array<float,2>{0.0367935002f, 0.423401624f},
-std::array<float,2>{0.591445386f, 0.0931628048f},
-std::array<float,2>{0.371365249f, 0.923610687f},
-std::array<float,2>{0.969619989f, 0.971952736f},
-std::array<float,2>{0.16540958f, 0.0242067631f},
-std::array<float,2>{0.700868547f, 0.478836328f},
-std::array<float,2>{0.483117819f, 0.526498437f},
-std::array<float,2>{0.524766386f, 0.713319004f},
-std::array<float,2>{0.311989278f, 0.280662268f},
-std::array<float,2>{0.826016903f, 0.163563877f},
-std::array<float,2>{0.110487394f, 0.837181807f},
-std::array<float,2>{0.545060694f, 0.828013897f},
-std::array<float,2>{0.276733547f, 0.173055321f},
-std::array<float,2>{0.852893472f, 0.26463604f},
-std::array<float,2>{0.0625794157f, 0.694380641f},
-std::array<float,2>{0.941210389f, 0.504308343f},
-std::array<float,2>{0.132275924f, 0.492430568f},
-std::array<float,2>{0.749029756f, 0.0093737971f},
-std::array<float,2>{0.45771873f, 0.984696746f},
-std::array<float,2>{0.781298935f, 0.911287606f},
-std::array<float,2>{0.00795704778f, 0.0655596033f},
-std::array<float,2>{0.598285735f, 0.417528391f},
-std::array<float,2>{0.325484037f, 0.609310329f},
-std::array<float,2>{0.639937162f, 0.630096614f},
-std::array<float,2>{0.411297023f, 0.316347122f},
-std::array<float,2>{0.925291061f, 0.200295091f},
-std::array<float,2>{0.206438869f, 0.750693202f},
-std::array<float,2>{0.709830761f, 0.955607533f},
-std::array<float,2>{0.498401046f, 0.0358399004f},
-std::array<float,2>{0.998011112f, 0.442701042f},
-std::array<float,2>{0.182925358f, 0.535281956f},
-std::array<float,2>{0.833259881f, 0.725007534f},
-std::array<float,2>{0.103300206f, 0.285137475f},
-std::array<float,2>{0.50088644f, 0.128916636f},
-std::array<float,2>{0.296566874f, 0.848447144f},
-std::array<float,2>{0.878951669f, 0.800547361f},
-std::array<float,2>{0.248437196f, 0.24744235f},
-std::array<float,2>{0.66998595f, 0.374646604f},
-std::array<float,2>{0.39539665f, 0.659320891f},
-std::array<float,2>{0.567665875f, 0.573801994f},
-std::array<float,2>{0.344354331f, 0.40191409f},
-std::array<float,2>{0.75759387f, 0.120775729f},
-std::array<float,2>{0.0535559133f, 0.893734336f},
-std::array<float,2>{0.576447845f, 0.950539231f},
-std::array<float,2>{0.352437198f, 0.0551693887f},
-std::array<float,2>{0.763265431f, 0.458792031f},
-std::array<float,2>{0.0551586077f, 0.557179451f},
-std::array<float,2>{0.886007845f, 0.749165535f},
-std::array<float,2>{0.237200186f, 0.306627005f},
-std::array<float,2>{0.663282096f, 0.151990309f},
-std::array<float,2>{0.402344167f, 0.860242486f},
-std::array<float,2>{0.84308666f, 0.79158622f},
-std::array<float,2>{0.0949516371f, 0.230335936f},
-std::array<float,2>{0.507971525f, 0.354871064f},
-std::array<float,2>{0.282901645f, 0.674212754f},
-std::array<float,2>{0.718682647f, 0.585379422f},
-std::array<float,2>{0.489011616f, 0.377111673f},
-std::array<float,2>{0.98556298f, 0.0964922458f},
-std::array<float,2>{0.177512258f, 0.890450358f},
-std::array<float,2>{0.631630421f, 0.842838943f},
-std::array<float,2>{0.418849856f, 0.159638047f},
-std::array<float,2>{0.933246851f, 0.274822682f},
-std::array<float,2>{0.211360782f, 0.717138052f},
-std::array<float,2>{0.791062951f, 0.530126452f},
-std::array<float,2>{0.00309422123f, 0.483655274f},
-std::array<float,2>{0.605674744f, 0.0310070533f},
-std::array<float,2>{0.316461027f, 0.974179208f},
-std::array<float,2>{0.945771873f, 0.929116249f},
-std::array<float,2>{0.134799629f, 0.0889701098f},
-std::array<float,2>{0.736963987f, 0.427498847f},
-std::array<float,2>{0.465399802f, 0.613509476f},
-std::array<float,2>{0.536517799f, 0.641807556f},
-std::array<float,2>{0.270282477f, 0.339358687f},
-std::array<float,2>{0.849039316f, 0.203240514f},
-std::array<float,2>{0.0729917884f, 0.773181856f},
-std::array<float,2>{0.520300567f, 0.756020367f},
-std::array<float,2>{0.299003273f, 0.198604539f},
-std::array<float,2>{0.816611111f, 0.317684323f},
-std::array<float,2>{0.118878596f, 0.626469195f},
-std::array<float,2>{0.979846179f, 0.601702094f},
-std::array<float,2>{0.15794681f, 0.419471353f},
-std::array<float,2>{0.691042125f, 0.0673500374f},
-std::array<float,2>{0.47524175f, 0.906755149f},
-std::array<float,2>{0.769741952f, 0.9909814f},
-std::array<float,2>{0.0418614969f, 0.0134057095f},
-std::array<float,2>{0.580650747f, 0.499916643f},
-std::array<float,2>{0.361719936f, 0.501973867f},
-std::array<float,2>{0.682576835f, 0.688960075f},
-std::array<float,2>{0.385263562f, 0.26165849f},
-std::array<float,2>{0.896087229f, 0.177184492f},
-std::array<float,2>{0.223210186f, 0.821357667f},
-std::array<float,2>{0.726405919f, 0.896135211f},
-std::array<float,2>{0.45029828f, 0.122779481f},
-std::array<float,2>{0.967454314f, 0.405543357f},
-std::array<float,2>{0.147889644f, 0.574813128f},
-std::array<float,2>{0.873260081f, 0.663776755f},
-std::array<float,2>{0.0791747719f, 0.369154662f},
-std::array<float,2>{0.555887043f, 0.244913429f},
-std::array<float,2>{0.262812763f, 0.802906573f},
-std::array<float,2>{0.921142161f, 0.84613204f},
-std::array<float,2>{0.193022683f, 0.125367001f},
-std::array<float,2>{0.640751064f, 0.285618484f},
-std::array<float,2>{0.425019503f, 0.72062099f},
-std::array<float,2>{0.615761638f, 0.532871485f},
-std::array<float,2>{0.341801792f, 0.438730806f},
-std::array<float,2>{0.803322434f, 0.0343516022f},
-std::array<float,2>{0.0281720739f, 0.959534824f},
-std::array<float,2>{0.551233292f, 0.918828487f},
-std::array<float,2>{0.250037044f, 0.0748540238f},
-std::array<float,2>{0.865623474f, 0.408182353f},
-std::array<float,2>{0.0919359475f, 0.596868277f},
-std::array<float,2>{0.953943193f, 0.639013767f},
-std::array<float,2>{0.152062893f, 0.320870757f},
-std::array<float,2>{0.730761945f, 0.19301042f},
-std::array<float,2>{0.439615846f, 0.762214959f},
-std::array<float,2>{0.805975199f, 0.814319432f},
-std::array<float,2>{0.0192264635f, 0.183923542f},
-std::array<float,2>{0.619767666f, 0.253715098f},
-std::array<float,2>{0.334644079f, 0.698688209f},
-std::array<float,2>{0.651884198f, 0.508174717f},
-std::array<float,2>{0.43352896f, 0.490007907f},
-std::array<float,2>{0.907891035f, 0.00418952713f},
-std::array<float,2>{0.20042479f, 0.999652386f},
-std::array<float,2>{0.698169529f, 0.805186093f},
-std::array<float,2>{0.47960338f, 0.237568304f},
-std::array<float,2>{0.974954069f, 0.361182451f},
-std::array<float,2>{0.168179721f, 0.665188015f},
-std::array<float,2>{0.82225585f, 0.565832317f},
-std::array<float,2>{0.117182456f, 0.392305404f},
-std::array<float,2>{0.531211793f, 0.114896834f},
-std::array<float,2>{0.307871968f, 0.902582228f},
-std::array<float,2>{0.90247798f, 0.961661816f},
-std::array<float,2>{0.234100834f, 0.0396824293f},
-std::array<float,2>{0.677081764f, 0.445394069f},
-std::array<float,2>{0.378013194f, 0.542951286f},
-std::array<float,2>{0.588421822f, 0.731034398f},
-std::array<float,2>{0.368610054f, 0.295867205f},
-std::array<float,2>{0.780115128f, 0.136135519f},
-std::array<float,2>{0.0323650837f, 0.852407932f},
-std::array<float,2>{0.597455621f, 0.869326234f},
-std::array<float,2>{0.320351511f, 0.147295296f},
-std::array<float,2>{0.787390947f, 0.303370714f},
-std::array<float,2>{0.0145391338f, 0.739384949f},
-std::array<float,2>{0.927094281f, 0.552558661f},
-std::array<float,2>{0.20710063f, 0.467214763f},
-std::array<float,2>{0.633413434f, 0.0490106978f},
-std::array<float,2>{0.410061538f, 0.93989408f},
-std::array<float,2>{0.857131898f, 0.877414763f},
-std::array<float,2>{0.0681227967f, 0.102032229f},
-std::array<float,2>{0.539657533f, 0.388711751f},
-std::array<float,2>{0.278340131f, 0.591992855f},
-std::array<float,2>{0.743736804f, 0.685095727f},
-std::array<float,2>{0.455495298f, 0.344970286f},
-std::array<float,2>{0.941582143f, 0.225678861f},
-std::array<float,2>{0.127988875f, 0.78698957f},
-std::array<float,2>{0.667459667f, 0.984025657f},
-std::array<float,2>{0.392721891f, 0.0171763599f},
-std::array<float,2>{0.877782583f, 0.470815033f},
-std::array<float,2>{0.24485305f, 0.521155953f},
-std::array<float,2>{0.753715396f, 0.704124629f},
-std::array<float,2>{0.0473150127f, 0.270046562f},
-std::array<float,2>{0.56565547f, 0.171568394f},
-std::array<float,2>{0.349682391f, 0.832014382f},
-std::array<float,2>{0.995072067f, 0.777472734f},
-std::array<float,2>{0.185838088f, 0.213769063f},
-std::array<float,2>{0.705718458f, 0.335785091f},
-std::array<float,2>{0.495566934f, 0.654573143f},
-std::array<float,2>{0.504131019f, 0.618698776f},
-std::array<float,2>{0.289275795f, 0.436427444f},
-std::array<float,2>{0.830115259f, 0.0791678578f},
-std::array<float,2>{0.106930844f, 0.93267417f},
-std::array<float,2>{0.534893155f, 0.968160927f},
-std::array<float,2>{0.268910468f, 0.0435335375f},
-std::array<float,2>{0.846782982f, 0.451120704f},
-std::array<float,2>{0.0744748339f, 0.543651462f},
-std::array<float,2>{0.953108847f, 0.729778945f},
-std::array<float,2>{0.1381329f, 0.290400535f},
-std::array<float,2>{0.740930855f, 0.139374882f},
-std::array<float,2>{0.46222505f, 0.856626809f},
-std::array<float,2>{0.796841979f, 0.811255634f},
-std::array<float,2>{0.00406819256f, 0.241733938f},
-std::array<float,2>{0.601710558f, 0.363684446f},
-std::array<float,2>{0.3138538f, 0.671769977f},
-std::array<float,2>{0.625244141f, 0.56749779f},
-std::array<float,2>{0.417536139f, 0.396573037f},
-std::array<float,2>{0.936075747f, 0.110820703f},
-std::array<float,2>{0.216628313f, 0.899811029f},
-std::array<float,2>{0.711226165f, 0.816953897f},
-std::array<float,2>{0.487143576f, 0.179897845f},
-std::array<float,2>{0.991859257f, 0.255661607f},
-std::array<float,2>{0.173654184f, 0.702280402f},
-std::array<float,2>{0.837320983f, 0.514974296f},
-std::array<float,2>{0.0992654562f, 0.487770498f},
-std::array<float,2>{0.513378143f, 0.00309508992f},
-std::array<float,2>{0.285945147f, 0.993608654f},
-std::array<float,2>{0.88788259f, 0.916058242f},
-std::array<float,2>{0.240408897f, 0.0741419494f},
-std::array<float,2>{0.659531653f, 0.41178146f},
-std::array<float,2>{0.399130315f, 0.599057674f},
-std::array<float,2>{0.571337521f, 0.633471489f},
-std::array<float,2>{0.358104974f, 0.327359438f},
-std::array<float,2>{0.760011792f, 0.187706724f},
-std::array<float,2>{0.0589703843f, 0.761702418f},
-std::array<float,2>{0.612726986f, 0.774522722f},
-std::array<float,2>{0.335965067f, 0.217276648f},
-std::array<float,2>{0.797713459f, 0.329791695f},
-std::array<float,2>{0.0244917162f, 0.649494648f},
-std::array<float,2>{0.916906297f, 0.623886526f},
-std::array<float,2>{0.190128013f, 0.4331837f},
-std::array<float,2>{0.647339284f, 0.0846621692f},
-std::array<float,2>{0.429332078f, 0.937119186f},
-std::array<float,2>{0.869875371f, 0.977235377f},
-std::array<float,2>{0.0859233811f, 0.0202871542f},
-std::array<float,2>{0.560693622f, 0.475447178f},
-std::array<float,2>{0.259358704f, 0.518031895f},
-std::array<float,2>{0.718788326f, 0.707836747f},
-std::array<float,2>{0.445906848f, 0.268587351f},
-std::array<float,2>{0.96464479f, 0.167213023f},
-std::array<float,2>{0.141206503f, 0.833646476f},
-std::array<float,2>{0.686846018f, 0.881923079f},
-std::array<float,2>{0.387150437f, 0.106507793f},
-std::array<float,2>{0.891706288f, 0.385093629f},
-std::array<float,2>{0.221761003f, 0.586716115f},
-std::array<float,2>{0.766519964f, 0.682816744f},
-std::array<float,2>{0.0435810424f, 0.350015849f},
-std::array<float,2>{0.584304333f, 0.220009938f},
-std::array<float,2>{0.365827173f, 0.784342825f},
-std::array<float,2>{0.983499229f, 0.87405479f},
-std::array<float,2>{0.160482541f, 0.140677601f},
-std::array<float,2>{0.694070578f, 0.299118549f},
-std::array<float,2>{0.470363349f, 0.734412313f},
-std::array<float,2>{0.518776774f, 0.54861474f},
-std::array<float,2>{0.304318368f, 0.461338222f},
-std::array<float,2>{0.814460456f, 0.0510678664f},
-std::array<float,2>{0.122653253f, 0.943774283f},
-std::array<float,2>{0.592650771f, 0.923841655f},
-std::array<float,2>{0.37440455f, 0.0916780308f},
-std::array<float,2>{0.776795566f, 0.424089342f},
-std::array<float,2>{0.0390381105f, 0.612330198f},
-std::array<float,2>{0.900205612f, 0.644706011f},
-std::array<float,2>{0.229706928f, 0.341192871f},
-std::array<float,2>{0.674967527f, 0.208085239f},
-std::array<float,2>{0.380226403f, 0.768427372f},
-std::array<float,2>{0.82636565f, 0.839470685f},
-std::array<float,2>{0.11165493f, 0.161166549f},
-std::array<float,2>{0.526492655f, 0.279265195f},
-std::array<float,2>{0.309584975f, 0.711568177f},
-std::array<float,2>{0.701734185f, 0.524988949f},
-std::array<float,2>{0.480820626f, 0.478018492f},
-std::array<float,2>{0.971821249f, 0.0270932205f},
-std::array<float,2>{0.167635903f, 0.969110787f},
-std::array<float,2>{0.654294252f, 0.794942021f},
-std::array<float,2>{0.436955512f, 0.230985776f},
-std::array<float,2>{0.913434803f, 0.35754621f},
-std::array<float,2>{0.198369086f, 0.678194284f},
-std::array<float,2>{0.808930457f, 0.580331624f},
-std::array<float,2>{0.019551944f, 0.382494003f},
-std::array<float,2>{0.623431683f, 0.0992333144f},
-std::array<float,2>{0.331701785f, 0.884162307f},
-std::array<float,2>{0.957835197f, 0.949190199f},
-std::array<float,2>{0.154249325f, 0.0605789013f},
-std::array<float,2>{0.730461121f, 0.454743356f},
-std::array<float,2>{0.444225967f, 0.56049031f},
-std::array<float,2>{0.548608899f, 0.743414342f},
-std::array<float,2>{0.256584853f, 0.310530275f},
-std::array<float,2>{0.861997485f, 0.155056283f},
-std::array<float,2>{0.0879766569f, 0.865981221f},
-std::array<float,2>{0.50350517f, 0.851488709f},
-std::array<float,2>{0.293622792f, 0.131073534f},
-std::array<float,2>{0.835832596f, 0.283081502f},
-std::array<float,2>{0.104288302f, 0.723586082f},
-std::array<float,2>{0.999994576f, 0.538368344f},
-std::array<float,2>{0.179880902f, 0.443495899f},
-std::array<float,2>{0.707784593f, 0.0385337621f},
-std::array<float,2>{0.497132838f, 0.955000401f},
-std::array<float,2>{0.755402803f, 0.892398953f},
-std::array<float,2>{0.0526467003f, 0.118727773f},
-std::array<float,2>{0.569519818f, 0.39999041f},
-std::array<float,2>{0.346481234f, 0.570719182f},
-std::array<float,2>{0.669353485f, 0.657649755f},
-std::array<float,2>{0.398385644f, 0.372283578f},
-std::array<float,2>{0.882351995f, 0.249830112f},
-std::array<float,2>{0.247002482f, 0.798377991f},
-std::array<float,2>{0.748034954f, 0.987184107f},
-std::array<float,2>{0.460293233f, 0.00979470555f},
-std::array<float,2>{0.939375341f, 0.496057123f},
-std::array<float,2>{0.129347503f, 0.506002963f},
-std::array<float,2>{0.854285061f, 0.692715764f},
-std::array<float,2>{0.0654871315f, 0.262627721f},
-std::array<float,2>{0.544734836f, 0.174161017f},
-std::array<float,2>{0.273679435f, 0.824897945f},
-std::array<float,2>{0.92263335f, 0.753693938f},
-std::array<float,2>{0.203262895f, 0.202465191f},
-std::array<float,2>{0.637074471f, 0.312613934f},
-std::array<float,2>{0.413975596f, 0.63157177f},
-std::array<float,2>{0.600254834f, 0.605611324f},
-std::array<float,2>{0.326613903f, 0.415522814f},
-std::array<float,2>{0.783612907f, 0.063019596f},
-std::array<float,2>{0.01113756f, 0.91365844f},
-std::array<float,2>{0.608907461f, 0.975636184f},
-std::array<float,2>{0.319912523f, 0.0286922175f},
-std::array<float,2>{0.789777458f, 0.480507314f},
-std::array<float,2>{0.000638062251f, 0.529261351f},
-std::array<float,2>{0.930968583f, 0.715568066f},
-std::array<float,2>{0.212959215f, 0.277287841f},
-std::array<float,2>{0.629736304f, 0.157549247f},
-std::array<float,2>{0.420805126f, 0.841768742f},
-std::array<float,2>{0.851136029f, 0.76976198f},
-std::array<float,2>{0.0709991008f, 0.206425846f},
-std::array<float,2>{0.538820446f, 0.33694908f},
-std::array<float,2>{0.271899819f, 0.642786443f},
-std::array<float,2>{0.736007452f, 0.617145181f},
-std::array<float,2>{0.468148917f, 0.428622305f},
-std::array<float,2>{0.948476911f, 0.0871293321f},
-std::array<float,2>{0.133719742f, 0.926125765f},
-std::array<float,2>{0.661234617f, 0.861404538f},
-std::array<float,2>{0.404489428f, 0.149507865f},
-std::array<float,2>{0.884065092f, 0.308039874f},
-std::array<float,2>{0.236273944f, 0.746427119f},
-std::array<float,2>{0.764275014f, 0.554925561f},
-std::array<float,2>{0.0569023192f, 0.459078401f},
-std::array<float,2>{0.574931383f, 0.0580858961f},
-std::array<float,2>{0.354991972f, 0.951456249f},
-std::array<float,2>{0.987642169f, 0.88840425f},
-std::array<float,2>{0.178306252f, 0.093956396f},
-std::array<float,2>{0.715737939f, 0.375397831f},
-std::array<float,2>{0.490817994f, 0.583027601f},
-std::array<float,2>{0.510225356f, 0.673504055f},
-std::array<float,2>{0.284486681f, 0.352020979f},
-std::array<float,2>{0.841582417f, 0.227269813f},
-std::array<float,2>{0.0959161893f, 0.790942609f},
-std::array<float,2>{0.557646751f, 0.802148998f},
-std::array<float,2>{0.264200181f, 0.24341318f},
-std::array<float,2>{0.871985734f, 0.368449092f},
-std::array<float,2>{0.0807724074f, 0.661833346f},
-std::array<float,2>{0.965216517f, 0.576715589f},
-std::array<float,2>{0.145394474f, 0.402677417f},
-std::array<float,2>{0.723779559f, 0.124971345f},
-std::array<float,2>{0.452094674f, 0.897263765f},
-std::array<float,2>{0.801936507f, 0.957785308f},
-std::array<float,2>{0.0304778833f, 0.0328693576f},
-std::array<float,2>{0.615152776f, 0.440458059f},
-std::array<float,2>{0.341682553f, 0.534005225f},
-std::array<float,2>{0.643161952f, 0.721816957f},
-std::array<float,2>{0.422045231f, 0.288680434f},
-std::array<float,2>{0.918811321f, 0.127613485f},
-std::array<float,2>{0.194411546f, 0.8452757f},
-std::array<float,2>{0.688362837f, 0.910148859f},
-std::array<float,2>{0.473235011f, 0.0690137446f},
-std::array<float,2>{0.977717102f, 0.421681404f},
-std::array<float,2>{0.159030303f, 0.603835285f},
-std::array<float,2>{0.819124937f, 0.628717244f},
-std::array<float,2>{0.120974317f, 0.320238709f},
-std::array<float,2>{0.52197212f, 0.195455626f},
-std::array<float,2>{0.298653364f, 0.75578016f},
-std::array<float,2>{0.897142351f, 0.822378039f},
-std::array<float,2>{0.224874392f, 0.178621456f},
-std::array<float,2>{0.680166066f, 0.259737253f},
-std::array<float,2>{0.38460663f, 0.691400409f},
-std::array<float,2>{0.578461051f, 0.501129389f},
-std::array<float,2>{0.360572755f, 0.496505558f},
-std::array<float,2>{0.772414982f, 0.0144335544f},
-std::array<float,2>{0.0400568619f, 0.989736378f},
-std::array<float,2>{0.527883649f, 0.904358029f},
-std::array<float,2>{0.306346118f, 0.117070489f},
-std::array<float,2>{0.824068069f, 0.393593639f},
-std::array<float,2>{0.114688277f, 0.56377238f},
-std::array<float,2>{0.973450363f, 0.667078614f},
-std::array<float,2>{0.171237841f, 0.362242103f},
-std::array<float,2>{0.696440279f, 0.23601909f},
-std::array<float,2>{0.477043718f, 0.8080194f},
-std::array<float,2>{0.778521538f, 0.854053259f},
-std::array<float,2>{0.0343377553f, 0.133289948f},
-std::array<float,2>{0.585985065f, 0.293661714f},
-std::array<float,2>{0.369807601f, 0.732868195f},
-std::array<float,2>{0.679333806f, 0.539556324f},
-std::array<float,2>{0.375663608f, 0.448752344f},
-std::array<float,2>{0.905955017f, 0.0410889052f},
-std::array<float,2>{0.230788633f, 0.964032412f},
-std::array<float,2>{0.73249191f, 0.763791978f},
-std::array<float,2>{0.438406646f, 0.193597645f},
-std::array<float,2>{0.956073523f, 0.323791444f},
-std::array<float,2>{0.15017347f, 0.638134122f},
-std::array<float,2>{0.863350749f, 0.594865501f},
-std::array<float,2>{0.0901346058f, 0.409158289f},
-std::array<float,2>{0.554632008f, 0.0777306631f},
-std::array<float,2>{0.252558768f, 0.921522319f},
-std::array<float,2>{0.910041928f, 0.997901917f},
-std::array<float,2>{0.20165664f, 0.00679176813f},
-std::array<float,2>{0.649348795f, 0.49149102f},
-std::array<float,2>{0.43117401f, 0.509933233f},
-std::array<float,2>{0.618935704f, 0.696891308f},
-std::array<float,2>{0.332732737f, 0.250706971f},
-std::array<float,2>{0.807179391f, 0.186069176f},
-std::array<float,2>{0.0172687229f, 0.814609289f},
-std::array<float,2>{0.563636124f, 0.829519749f},
-std::array<float,2>{0.348943174f, 0.1686856f},
-std::array<float,2>{0.75169903f, 0.271871448f},
-std::array<float,2>{0.0502418242f, 0.705294073f},
-std::array<float,2>{0.876214445f, 0.521931887f},
-std::array<float,2>{0.24380134f, 0.469179004f},
-std::array<float,2>{0.665630937f, 0.0188503079f},
-std::array<float,2>{0.392406285f, 0.98064512f},
-std::array<float,2>{0.829448938f, 0.931147575f},
-std::array<float,2>{0.108437546f, 0.0809941888f},
-std::array<float,2>{0.506714523f, 0.434797019f},
-std::array<float,2>{0.291903079f, 0.6191746f},
-std::array<float,2>{0.704220653f, 0.654002309f},
-std::array<float,2>{0.492924035f, 0.333260924f},
-std::array<float,2>{0.992446899f, 0.212193459f},
-std::array<float,2>{0.185160488f, 0.779875934f},
-std::array<float,2>{0.636429429f, 0.939258754f},
-std::array<float,2>{0.406568468f, 0.0471645966f},
-std::array<float,2>{0.928772271f, 0.466230869f},
-std::array<float,2>{0.210869595f, 0.55378288f},
-std::array<float,2>{0.786119461f, 0.7410146f},
-std::array<float,2>{0.0135327429f, 0.302274883f},
-std::array<float,2>{0.594991148f, 0.146050662f},
-std::array<float,2>{0.324110508f, 0.868519425f},
-std::array<float,2>{0.944029868f, 0.787897289f},
-std::array<float,2>{0.125535339f, 0.223352417f},
-std::array<float,2>{0.744462371f, 0.346641451f},
-std::array<float,2>{0.453487217f, 0.686722279f},
-std::array<float,2>{0.542562187f, 0.590634823f},
-std::array<float,2>{0.279428452f, 0.387653917f},
-std::array<float,2>{0.859029412f, 0.104489863f},
-std::array<float,2>{0.0684667304f, 0.87684381f},
-std::array<float,2>{0.562038481f, 0.978613853f},
-std::array<float,2>{0.25873515f, 0.0225884747f},
-std::array<float,2>{0.870889723f, 0.474198908f},
-std::array<float,2>{0.0845240578f, 0.516748548f},
-std::array<float,2>{0.962931097f, 0.710564435f},
-std::array<float,2>{0.142097309f, 0.266653895f},
-std::array<float,2>{0.720356762f, 0.165093258f},
-std::array<float,2>{0.446617424f, 0.834588647f},
-std::array<float,2>{0.798092127f, 0.776867807f},
-std::array<float,2>{0.0243929829f, 0.215548128f},
-std::array<float,2>{0.611905873f, 0.331957579f},
-std::array<float,2>{0.337501436f, 0.652204454f},
-std::array<float,2>{0.648376465f, 0.621116757f},
-std::array<float,2>{0.428709716f, 0.430940539f},
-std::array<float,2>{0.917710721f, 0.0826574266f},
-std::array<float,2>{0.190773174f, 0.933835208f},
-std::array<float,2>{0.694777071f, 0.87205261f},
-std::array<float,2>{0.469520241f, 0.143744096f},
-std::array<float,2>{0.983070552f, 0.298464924f},
-std::array<float,2>{0.1613148f, 0.738205075f},
-std::array<float,2>{0.816269994f, 0.549435675f},
-std::array<float,2>{0.121565349f, 0.463453382f},
-std::array<float,2>{0.517689168f, 0.0541010424f},
-std::array<float,2>{0.303391039f, 0.942163885f},
-std::array<float,2>{0.89117521f, 0.878923476f},
-std::array<float,2>{0.221564949f, 0.108681999f},
-std::array<float,2>{0.686253965f, 0.382969022f},
-std::array<float,2>{0.388251841f, 0.588887751f},
-std::array<float,2>{0.585510194f, 0.681273103f},
-std::array<float,2>{0.366644621f, 0.34802705f},
-std::array<float,2>{0.76755029f, 0.221334919f},
-std::array<float,2>{0.0446854196f, 0.781394899f},
-std::array<float,2>{0.60309726f, 0.810245335f},
-std::array<float,2>{0.312591106f, 0.238943443f},
-std::array<float,2>{0.795882463f, 0.365715861f},
-std::array<float,2>{0.0049881353f, 0.668477118f},
-std::array<float,2>{0.937399805f, 0.568514884f},
-std::array<float,2>{0.215191424f, 0.396157473f},
-std::array<float,2>{0.626750231f, 0.112783626f},
-std::array<float,2>{0.416275263f, 0.900811732f},
-std::array<float,2>{0.846362472f, 0.965367317f},
-std::array<float,2>{0.075548403f, 0.0456167497f},
-std::array<float,2>{0.533679545f, 0.452038944f},
-std::array<float,2>{0.268414378f, 0.545225561f},
-std::array<float,2>{0.741444528f, 0.726838052f},
-std::array<float,2>{0.461614847f, 0.292567551f},
-std::array<float,2>{0.951611102f, 0.138055041f},
-std::array<float,2>{0.13715972f, 0.857566833f},
-std::array<float,2>{0.658791184f, 0.915797472f},
-std::array<float,2>{0.399611354f, 0.0706783608f},
-std::array<float,2>{0.88756305f, 0.413610965f},
-std::array<float,2>{0.24130097f, 0.600557029f},
-std::array<float,2>{0.761403322f, 0.635514259f},
-std::array<float,2>{0.0601751804f, 0.324875057f},
-std::array<float,2>{0.570344627f, 0.190568432f},
-std::array<float,2>{0.359098822f, 0.758186162f},
-std::array<float,2>{0.990363717f, 0.819658577f},
-std::array<float,2>{0.172037169f, 0.182035178f},
-std::array<float,2>{0.712280095f, 0.257006943f},
-std::array<float,2>{0.487346321f, 0.699863911f},
-std::array<float,2>{0.512616396f, 0.512093604f},
-std::array<float,2>{0.286710113f, 0.484553903f},
-std::array<float,2>{0.836696744f, 0.00147272518f},
-std::array<float,2>{0.0984434709f, 0.996020317f},
-std::array<float,2>{0.568987787f, 0.893050492f},
-std::array<float,2>{0.346950561f, 0.120044082f},
-std::array<float,2>{0.754128933f, 0.401215941f},
-std::array<float,2>{0.0509931333f, 0.572746456f},
-std::array<float,2>{0.881277978f, 0.65912658f},
-std::array<float,2>{0.247168317f, 0.373939842f},
-std::array<float,2>{0.668225229f, 0.246986955f},
-std::array<float,2>{0.39702335f, 0.799427807f},
-std::array<float,2>{0.83487922f, 0.849125028f},
-std::array<float,2>{0.105222397f, 0.130518183f},
-std::array<float,2>{0.5022946f, 0.283225685f},
-std::array<float,2>{0.294094473f, 0.7260288f},
-std::array<float,2>{0.708703756f, 0.536924839f},
-std::array<float,2>{0.496631652f, 0.442055792f},
-std::array<float,2>{0.998340845f, 0.0365715809f},
-std::array<float,2>{0.180763379f, 0.956090093f},
-std::array<float,2>{0.638048947f, 0.751329541f},
-std::array<float,2>{0.412878454f, 0.199695602f},
-std::array<float,2>{0.923021317f, 0.314870179f},
-std::array<float,2>{0.204979599f, 0.629566193f},
-std::array<float,2>{0.784655988f, 0.607729197f},
-std::array<float,2>{0.00989049114f, 0.41625765f},
-std::array<float,2>{0.600601315f, 0.0654052272f},
-std::array<float,2>{0.327457815f, 0.910461783f},
-std::array<float,2>{0.938262045f, 0.985462785f},
-std::array<float,2>{0.130520701f, 0.00871113222f},
-std::array<float,2>{0.746575654f, 0.493839413f},
-std::array<float,2>{0.459419131f, 0.505288959f},
-std::array<float,2>{0.543733895f, 0.693747222f},
-std::array<float,2>{0.275102288f, 0.264755428f},
-std::array<float,2>{0.854708374f, 0.172142223f},
-std::array<float,2>{0.0649074391f, 0.82698667f},
-std::array<float,2>{0.52574569f, 0.836130381f},
-std::array<float,2>{0.308745414f, 0.162494719f},
-std::array<float,2>{0.827532113f, 0.279606014f},
-std::array<float,2>{0.112956688f, 0.714519918f},
-std::array<float,2>{0.971401453f, 0.525496125f},
-std::array<float,2>{0.166175276f, 0.480119735f},
-std::array<float,2>{0.702250838f, 0.024512874f},
-std::array<float,2>{0.482058913f, 0.970951617f},
-std::array<float,2>{0.775553763f, 0.922636986f},
-std::array<float,2>{0.0374716446f, 0.0922791287f},
-std::array<float,2>{0.593522727f, 0.42227453f},
-std::array<float,2>{0.373100072f, 0.609386265f},
-std::array<float,2>{0.674762666f, 0.648281634f},
-std::array<float,2>{0.379693747f, 0.343314677f},
-std::array<float,2>{0.898715258f, 0.210012078f},
-std::array<float,2>{0.228708535f, 0.767270148f},
-std::array<float,2>{0.729364097f, 0.945359051f},
-std::array<float,2>{0.444968998f, 0.0594737083f},
-std::array<float,2>{0.958169878f, 0.455940366f},
-std::array<float,2>{0.15305379f, 0.560598314f},
-std::array<float,2>{0.862969279f, 0.744509935f},
-std::array<float,2>{0.089172408f, 0.312447578f},
-std::array<float,2>{0.547427177f, 0.153273299f},
-std::array<float,2>{0.257609606f, 0.865186214f},
-std::array<float,2>{0.912151575f, 0.794352233f},
-std::array<float,2>{0.197368696f, 0.234022751f},
-std::array<float,2>{0.653148413f, 0.3555682f},
-std::array<float,2>{0.435662955f, 0.675795436f},
-std::array<float,2>{0.624403894f, 0.579797447f},
-std::array<float,2>{0.330642283f, 0.378923833f},
-std::array<float,2>{0.809916258f, 0.100798987f},
-std::array<float,2>{0.0212277509f, 0.886240244f},
-std::array<float,2>{0.614238322f, 0.960476637f},
-std::array<float,2>{0.34069249f, 0.033803761f},
-std::array<float,2>{0.801296055f, 0.437850833f},
-std::array<float,2>{0.030002445f, 0.531504095f},
-std::array<float,2>{0.919561565f, 0.719201744f},
-std::array<float,2>{0.193859428f, 0.28662467f},
-std::array<float,2>{0.644468427f, 0.126304716f},
-std::array<float,2>{0.422905445f, 0.84757638f},
-std::array<float,2>{0.872589648f, 0.803792536f},
-std::array<float,2>{0.0817915797f, 0.245628223f},
-std::array<float,2>{0.557597101f, 0.370179474f},
-std::array<float,2>{0.265083373f, 0.662166178f},
-std::array<float,2>{0.723353982f, 0.575870931f},
-std::array<float,2>{0.452539325f, 0.404432535f},
-std::array<float,2>{0.966157019f, 0.122031622f},
-std::array<float,2>{0.146125898f, 0.895326614f},
-std::array<float,2>{0.681099892f, 0.821256995f},
-std::array<float,2>{0.383741379f, 0.17633453f},
-std::array<float,2>{0.897476971f, 0.260441482f},
-std::array<float,2>{0.226133808f, 0.688260138f},
-std::array<float,2>{0.773382962f, 0.503669024f},
-std::array<float,2>{0.0395899042f, 0.498360485f},
-std::array<float,2>{0.579388678f, 0.012413336f},
-std::array<float,2>{0.359691232f, 0.99138546f},
-std::array<float,2>{0.976962924f, 0.907759428f},
-std::array<float,2>{0.159197688f, 0.0683381855f},
-std::array<float,2>{0.688717186f, 0.41832909f},
-std::array<float,2>{0.473820686f, 0.602678657f},
-std::array<float,2>{0.523388267f, 0.625857711f},
-std::array<float,2>{0.29763338f, 0.316415876f},
-std::array<float,2>{0.819511473f, 0.198094264f},
-std::array<float,2>{0.119356237f, 0.756973803f},
-std::array<float,2>{0.537385464f, 0.77233094f},
-std::array<float,2>{0.272904307f, 0.204246834f},
-std::array<float,2>{0.850026965f, 0.338479131f},
-std::array<float,2>{0.0720220432f, 0.640948772f},
-std::array<float,2>{0.947740018f, 0.614629686f},
-std::array<float,2>{0.134329394f, 0.425936908f},
-std::array<float,2>{0.734909475f, 0.0887204334f},
-std::array<float,2>{0.467020124f, 0.92845422f},
-std::array<float,2>{0.790154159f, 0.973564804f},
-std::array<float,2>{0.00147881953f, 0.0300516095f},
-std::array<float,2>{0.608305037f, 0.48325637f},
-std::array<float,2>{0.319037229f, 0.53058064f},
-std::array<float,2>{0.630803764f, 0.718645394f},
-std::array<float,2>{0.421417475f, 0.274217904f},
-std::array<float,2>{0.930273533f, 0.158335462f},
-std::array<float,2>{0.213944405f, 0.842097342f},
-std::array<float,2>{0.716195464f, 0.88904655f},
-std::array<float,2>{0.49182567f, 0.0969460532f},
-std::array<float,2>{0.986959755f, 0.378506452f},
-std::array<float,2>{0.179661319f, 0.584478557f},
-std::array<float,2>{0.840486646f, 0.675226033f},
-std::array<float,2>{0.0976440534f, 0.353590578f},
-std::array<float,2>{0.510868609f, 0.22894229f},
-std::array<float,2>{0.283219784f, 0.792748153f},
-std::array<float,2>{0.882892072f, 0.860957325f},
-std::array<float,2>{0.234438822f, 0.150879964f},
-std::array<float,2>{0.660972178f, 0.304921687f},
-std::array<float,2>{0.405279964f, 0.748735607f},
-std::array<float,2>{0.575329721f, 0.558253646f},
-std::array<float,2>{0.35403198f, 0.457555026f},
-std::array<float,2>{0.76478982f, 0.0560234822f},
-std::array<float,2>{0.0576637611f, 0.949282408f},
-std::array<float,2>{0.50694418f, 0.93192637f},
-std::array<float,2>{0.292965323f, 0.0789296851f},
-std::array<float,2>{0.828258574f, 0.43681857f},
-std::array<float,2>{0.108311929f, 0.618148208f},
-std::array<float,2>{0.993403792f, 0.656114638f},
-std::array<float,2>{0.184322655f, 0.334929019f},
-std::array<float,2>{0.703984976f, 0.214829817f},
-std::array<float,2>{0.493203104f, 0.778848052f},
-std::array<float,2>{0.75075233f, 0.830268741f},
-std::array<float,2>{0.0495273694f, 0.170762524f},
-std::array<float,2>{0.562701523f, 0.271203905f},
-std::array<float,2>{0.348295748f, 0.703925371f},
-std::array<float,2>{0.664423108f, 0.520142138f},
-std::array<float,2>{0.390779734f, 0.472416192f},
-std::array<float,2>{0.875939846f, 0.0159107056f},
-std::array<float,2>{0.242612794f, 0.982903481f},
-std::array<float,2>{0.74552846f, 0.785179853f},
-std::array<float,2>{0.454538971f, 0.224933848f},
-std::array<float,2>{0.944578111f, 0.344447881f},
-std::array<float,2>{0.126472607f, 0.68423301f},
-std::array<float,2>{0.857537329f, 0.59371078f},
-std::array<float,2>{0.0693974644f, 0.389799386f},
-std::array<float,2>{0.541183233f, 0.102982022f},
-std::array<float,2>{0.281028658f, 0.878064692f},
-std::array<float,2>{0.928457022f, 0.940845728f},
-std::array<float,2>{0.209860355f, 0.0501564816f},
-std::array<float,2>{0.635232449f, 0.467844248f},
-std::array<float,2>{0.407408416f, 0.55126071f},
-std::array<float,2>{0.59470886f, 0.738731802f},
-std::array<float,2>{0.322884202f, 0.304608464f},
-std::array<float,2>{0.787031233f, 0.147768855f},
-std::array<float,2>{0.0119998427f, 0.870125413f},
-std::array<float,2>{0.587439716f, 0.853012621f},
-std::array<float,2>{0.370848656f, 0.135228753f},
-std::array<float,2>{0.777543664f, 0.29655984f},
-std::array<float,2>{0.0335813537f, 0.731874943f},
-std::array<float,2>{0.905239642f, 0.541814327f},
-std::array<float,2>{0.231547132f, 0.446803868f},
-std::array<float,2>{0.678578019f, 0.0408845544f},
-std::array<float,2>{0.376321524f, 0.962813079f},
-std::array<float,2>{0.823242009f, 0.903939188f},
-std::array<float,2>{0.11402864f, 0.114111431f},
-std::array<float,2>{0.529269278f, 0.390961409f},
-std::array<float,2>{0.305659771f, 0.564488769f},
-std::array<float,2>{0.695365787f, 0.664764345f},
-std::array<float,2>{0.477691621f, 0.35992378f},
-std::array<float,2>{0.974306285f, 0.236428291f},
-std::array<float,2>{0.169962272f, 0.806302249f},
-std::array<float,2>{0.649929404f, 0.998275757f},
-std::array<float,2>{0.430032611f, 0.00571341626f},
-std::array<float,2>{0.908335388f, 0.488985062f},
-std::array<float,2>{0.202431038f, 0.509293914f},
-std::array<float,2>{0.807706177f, 0.69727385f},
-std::array<float,2>{0.0157556441f, 0.252437085f},
-std::array<float,2>{0.617667854f, 0.184967101f},
-std::array<float,2>{0.333659112f, 0.812826157f},
-std::array<float,2>{0.955245912f, 0.762974322f},
-std::array<float,2>{0.148908317f, 0.191691533f},
-std::array<float,2>{0.733754396f, 0.321319282f},
-std::array<float,2>{0.43860364f, 0.639929354f},
-std::array<float,2>{0.553220987f, 0.595840573f},
-std::array<float,2>{0.253179431f, 0.406794429f},
-std::array<float,2>{0.864991724f, 0.0752943009f},
-std::array<float,2>{0.0917627141f, 0.919366002f},
-std::array<float,2>{0.517527938f, 0.944492877f},
-std::array<float,2>{0.301063538f, 0.0524616987f},
-std::array<float,2>{0.812554419f, 0.462863207f},
-std::array<float,2>{0.124970354f, 0.547099113f},
-std::array<float,2>{0.981116772f, 0.735608578f},
-std::array<float,2>{0.16390653f, 0.29993251f},
-std::array<float,2>{0.691516519f, 0.142319769f},
-std::array<float,2>{0.471122146f, 0.873934686f},
-std::array<float,2>{0.76885581f, 0.783600688f},
-std::array<float,2>{0.0456374846f, 0.219054654f},
-std::array<float,2>{0.582648039f, 0.351143867f},
-std::array<float,2>{0.364055544f, 0.681686699f},
-std::array<float,2>{0.684496403f, 0.587594271f},
-std::array<float,2>{0.388899118f, 0.386103183f},
-std::array<float,2>{0.892648458f, 0.105490811f},
-std::array<float,2>{0.220321625f, 0.881746352f},
-std::array<float,2>{0.721842051f, 0.832742512f},
-std::array<float,2>{0.447347194f, 0.16605252f},
-std::array<float,2>{0.961880028f, 0.268266797f},
-std::array<float,2>{0.143194094f, 0.708344579f},
-std::array<float,2>{0.867824852f, 0.51868546f},
-std::array<float,2>{0.0825721174f, 0.475902796f},
-std::array<float,2>{0.559992015f, 0.0213279799f},
-std::array<float,2>{0.261635125f, 0.978115678f},
-std::array<float,2>{0.915489435f, 0.936293483f},
-std::array<float,2>{0.188286498f, 0.0851056874f},
-std::array<float,2>{0.645682156f, 0.431741118f},
-std::array<float,2>{0.425897062f, 0.624333262f},
-std::array<float,2>{0.61047411f, 0.649139583f},
-std::array<float,2>{0.339368463f, 0.328128934f},
-std::array<float,2>{0.800213993f, 0.21807681f},
-std::array<float,2>{0.0265988559f, 0.773695886f},
-std::array<float,2>{0.57246989f, 0.759866476f},
-std::array<float,2>{0.356563002f, 0.188988104f},
-std::array<float,2>{0.759386539f, 0.326608926f},
-std::array<float,2>{0.06181724f, 0.634365976f},
-std::array<float,2>{0.888772249f, 0.598262608f},
-std::array<float,2>{0.239057854f, 0.410490483f},
-std::array<float,2>{0.656965375f, 0.0729538947f},
-std::array<float,2>{0.402008444f, 0.917341709f},
-std::array<float,2>{0.839158058f, 0.99301511f},
-std::array<float,2>{0.100626037f, 0.00207492383f},
-std::array<float,2>{0.513681054f, 0.487198681f},
-std::array<float,2>{0.288677156f, 0.514609814f},
-std::array<float,2>{0.71478337f, 0.701657414f},
-std::array<float,2>{0.484528691f, 0.254600048f},
-std::array<float,2>{0.988505781f, 0.1807307f},
-std::array<float,2>{0.175719276f, 0.818073392f},
-std::array<float,2>{0.627013206f, 0.898673415f},
-std::array<float,2>{0.414385229f, 0.109621264f},
-std::array<float,2>{0.933837056f, 0.398390085f},
-std::array<float,2>{0.217410043f, 0.567377448f},
-std::array<float,2>{0.794503629f, 0.670072258f},
-std::array<float,2>{0.00717414496f, 0.365222186f},
-std::array<float,2>{0.604184568f, 0.241179019f},
-std::array<float,2>{0.315560073f, 0.8116588f},
-std::array<float,2>{0.949291289f, 0.855606377f},
-std::array<float,2>{0.14043723f, 0.139986828f},
-std::array<float,2>{0.738665283f, 0.289083153f},
-std::array<float,2>{0.464185685f, 0.728538394f},
-std::array<float,2>{0.532733977f, 0.544271529f},
-std::array<float,2>{0.267134011f, 0.450095266f},
-std::array<float,2>{0.844149649f, 0.0443000272f},
-std::array<float,2>{0.077535212f, 0.96699661f},
-std::array<float,2>{0.598677158f, 0.91248554f},
-std::array<float,2>{0.324738055f, 0.0641852543f},
-std::array<float,2>{0.78263092f, 0.414274424f},
-std::array<float,2>{0.00928114541f, 0.607405365f},
-std::array<float,2>{0.924167275f, 0.632286787f},
-std::array<float,2>{0.205146909f, 0.314038485f},
-std::array<float,2>{0.639109313f, 0.201354623f},
-std::array<float,2>{0.410906374f, 0.752530098f},
-std::array<float,2>{0.851729572f, 0.825336516f},
-std::array<float,2>{0.0636217594f, 0.175642699f},
-std::array<float,2>{0.546247244f, 0.263074517f},
-std::array<float,2>{0.276099443f, 0.69144243f},
-std::array<float,2>{0.74861145f, 0.507431686f},
-std::array<float,2>{0.458142638f, 0.494155735f},
-std::array<float,2>{0.940243721f, 0.0111178653f},
-std::array<float,2>{0.13106294f, 0.988212287f},
-std::array<float,2>{0.67147398f, 0.79735297f},
-std::array<float,2>{0.396119952f, 0.24816978f},
-std::array<float,2>{0.880758882f, 0.371598363f},
-std::array<float,2>{0.249612272f, 0.657207131f},
-std::array<float,2>{0.75588572f, 0.57154417f},
-std::array<float,2>{0.0543960929f, 0.39917323f},
-std::array<float,2>{0.567264616f, 0.117519513f},
-std::array<float,2>{0.345145464f, 0.891085148f},
-std::array<float,2>{0.996791363f, 0.953733861f},
-std::array<float,2>{0.18256034f, 0.0377990752f},
-std::array<float,2>{0.710076749f, 0.444738507f},
-std::array<float,2>{0.499697417f, 0.537268519f},
-std::array<float,2>{0.501569808f, 0.724323332f},
-std::array<float,2>{0.29562974f, 0.281626552f},
-std::array<float,2>{0.832553804f, 0.132362723f},
-std::array<float,2>{0.102077894f, 0.84985894f},
-std::array<float,2>{0.548952878f, 0.86667496f},
-std::array<float,2>{0.255139887f, 0.155476809f},
-std::array<float,2>{0.860374331f, 0.309309185f},
-std::array<float,2>{0.0860592797f, 0.743128419f},
-std::array<float,2>{0.959531546f, 0.558913469f},
-std::array<float,2>{0.155844584f, 0.453909189f},
-std::array<float,2>{0.728190064f, 0.0618249066f},
-std::array<float,2>{0.442806154f, 0.947589993f},
-std::array<float,2>{0.811706066f, 0.883210063f},
-std::array<float,2>{0.0219166391f, 0.0983923078f},
-std::array<float,2>{0.622915506f, 0.381669849f},
-std::array<float,2>{0.329551756f, 0.581590474f},
-std::array<float,2>{0.655266345f, 0.67902863f},
-std::array<float,2>{0.434746653f, 0.358631194f},
-std::array<float,2>{0.911698043f, 0.232015312f},
-std::array<float,2>{0.197102487f, 0.796104789f},
-std::array<float,2>{0.700101316f, 0.969805479f},
-std::array<float,2>{0.483696699f, 0.0261900667f},
-std::array<float,2>{0.969980001f, 0.477463216f},
-std::array<float,2>{0.164985761f, 0.52430737f},
-std::array<float,2>{0.825187087f, 0.712259233f},
-std::array<float,2>{0.109472826f, 0.277681887f},
-std::array<float,2>{0.524307728f, 0.160892829f},
-std::array<float,2>{0.311164498f, 0.838692784f},
-std::array<float,2>{0.901455164f, 0.769025385f},
-std::array<float,2>{0.226574138f, 0.207250133f},
-std::array<float,2>{0.67256099f, 0.340283543f},
-std::array<float,2>{0.382667214f, 0.646128058f},
-std::array<float,2>{0.590205133f, 0.611807525f},
-std::array<float,2>{0.372826219f, 0.425254107f},
-std::array<float,2>{0.774922788f, 0.0902446657f},
-std::array<float,2>{0.035999842f, 0.924907565f},
-std::array<float,2>{0.581690073f, 0.988908708f},
-std::array<float,2>{0.362886757f, 0.0154198753f},
-std::array<float,2>{0.771421969f, 0.497347623f},
-std::array<float,2>{0.0420477092f, 0.500211418f},
-std::array<float,2>{0.894897342f, 0.689889371f},
-std::array<float,2>{0.223687693f, 0.25861907f},
-std::array<float,2>{0.68356812f, 0.178904578f},
-std::array<float,2>{0.386694998f, 0.82386601f},
-std::array<float,2>{0.817708433f, 0.754736543f},
-std::array<float,2>{0.117722489f, 0.196905255f},
-std::array<float,2>{0.521135211f, 0.318880051f},
-std::array<float,2>{0.300490052f, 0.627870321f},
-std::array<float,2>{0.690295458f, 0.605004251f},
-std::array<float,2>{0.475596249f, 0.420386195f},
-std::array<float,2>{0.978778839f, 0.0699615106f},
-std::array<float,2>{0.156302959f, 0.908624113f},
-std::array<float,2>{0.64187187f, 0.844409406f},
-std::array<float,2>{0.424218297f, 0.128271475f},
-std::array<float,2>{0.920469105f, 0.28754279f},
-std::array<float,2>{0.191809595f, 0.721384764f},
-std::array<float,2>{0.803718209f, 0.534843445f},
-std::array<float,2>{0.02855343f, 0.439814925f},
-std::array<float,2>{0.616762698f, 0.0322102085f},
-std::array<float,2>{0.342788577f, 0.958456933f},
-std::array<float,2>{0.968316853f, 0.898252606f},
-std::array<float,2>{0.146589354f, 0.123631001f},
-std::array<float,2>{0.725096881f, 0.404122531f},
-std::array<float,2>{0.449724674f, 0.577486873f},
-std::array<float,2>{0.555263937f, 0.660829484f},
-std::array<float,2>{0.262586772f, 0.367768079f},
-std::array<float,2>{0.874381542f, 0.242551729f},
-std::array<float,2>{0.0784031898f, 0.801300406f},
-std::array<float,2>{0.509033859f, 0.789133728f},
-std::array<float,2>{0.281603336f, 0.227593467f},
-std::array<float,2>{0.842548251f, 0.353197813f},
-std::array<float,2>{0.0940849185f, 0.672566772f},
-std::array<float,2>{0.984543264f, 0.582127035f},
-std::array<float,2>{0.176114619f, 0.376260966f},
-std::array<float,2>{0.717098773f, 0.0952793062f},
-std::array<float,2>{0.48996976f, 0.886941433f},
-std::array<float,2>{0.762503803f, 0.952716947f},
-std::array<float,2>{0.056393601f, 0.0570925884f},
-std::array<float,2>{0.577548563f, 0.460370302f},
-std::array<float,2>{0.353224814f, 0.556373417f},
-std::array<float,2>{0.662592947f, 0.747287452f},
-std::array<float,2>{0.404170305f, 0.306981951f},
-std::array<float,2>{0.884924948f, 0.149339274f},
-std::array<float,2>{0.23815091f, 0.862563372f},
-std::array<float,2>{0.738099396f, 0.927682936f},
-std::array<float,2>{0.465909392f, 0.0866699219f},
-std::array<float,2>{0.946878552f, 0.429033101f},
-std::array<float,2>{0.136514246f, 0.61565876f},
-std::array<float,2>{0.848106861f, 0.644045949f},
-std::array<float,2>{0.0736166984f, 0.336381763f},
-std::array<float,2>{0.535833001f, 0.205646962f},
-std::array<float,2>{0.27068913f, 0.770762086f},
-std::array<float,2>{0.931646109f, 0.840192497f},
-std::array<float,2>{0.212382868f, 0.156914338f},
-std::array<float,2>{0.631931305f, 0.275415987f},
-std::array<float,2>{0.419104755f, 0.716782987f},
-std::array<float,2>{0.607036054f, 0.528277397f},
-std::array<float,2>{0.318356007f, 0.481924772f},
-std::array<float,2>{0.792761743f, 0.0277275462f},
-std::array<float,2>{0.00263716397f, 0.974862754f},
-std::array<float,2>{0.540970027f, 0.875872612f},
-std::array<float,2>{0.277703375f, 0.105119616f},
-std::array<float,2>{0.856441915f, 0.388541818f},
-std::array<float,2>{0.0671511516f, 0.59133333f},
-std::array<float,2>{0.942433834f, 0.685681045f},
-std::array<float,2>{0.127842799f, 0.346830934f},
-std::array<float,2>{0.742454171f, 0.224496111f},
-std::array<float,2>{0.456303775f, 0.788430929f},
-std::array<float,2>{0.788501263f, 0.867853642f},
-std::array<float,2>{0.0150377173f, 0.145055696f},
-std::array<float,2>{0.595819533f, 0.301592559f},
-std::array<float,2>{0.322200298f, 0.742186129f},
-std::array<float,2>{0.63395232f, 0.552780271f},
-std::array<float,2>{0.40888831f, 0.465123594f},
-std::array<float,2>{0.926548183f, 0.0488031209f},
-std::array<float,2>{0.208788514f, 0.937717676f},
-std::array<float,2>{0.706463873f, 0.78071624f},
-std::array<float,2>{0.494715363f, 0.211599782f},
-std::array<float,2>{0.995460153f, 0.332096219f},
-std::array<float,2>{0.186858699f, 0.65259552f},
-std::array<float,2>{0.831215858f, 0.620202124f},
-std::array<float,2>{0.105926737f, 0.433803827f},
-std::array<float,2>{0.505422294f, 0.0816898793f},
-std::array<float,2>{0.290435016f, 0.930433512f},
-std::array<float,2>{0.87816292f, 0.982381701f},
-std::array<float,2>{0.245233953f, 0.0181974936f},
-std::array<float,2>{0.666569829f, 0.469947219f},
-std::array<float,2>{0.39373076f, 0.522722125f},
-std::array<float,2>{0.565311551f, 0.706736386f},
-std::array<float,2>{0.350785881f, 0.273021847f},
-std::array<float,2>{0.752416432f, 0.169316441f},
-std::array<float,2>{0.0480014235f, 0.828159213f},
-std::array<float,2>{0.620207965f, 0.816285551f},
-std::array<float,2>{0.335438877f, 0.186701015f},
-std::array<float,2>{0.805414557f, 0.251043469f},
-std::array<float,2>{0.0178698376f, 0.695686281f},
-std::array<float,2>{0.906558037f, 0.510817826f},
-std::array<float,2>{0.199412674f, 0.490294069f},
-std::array<float,2>{0.65047735f, 0.0077672964f},
-std::array<float,2>{0.432019591f, 0.996772289f},
-std::array<float,2>{0.867003024f, 0.920713603f},
-std::array<float,2>{0.093446441f, 0.076659739f},
-std::array<float,2>{0.552452147f, 0.409658194f},
-std::array<float,2>{0.251809686f, 0.594443083f},
-std::array<float,2>{0.731715679f, 0.63753742f},
-std::array<float,2>{0.440703601f, 0.322586268f},
-std::array<float,2>{0.954205811f, 0.195240781f},
-std::array<float,2>{0.151134193f, 0.765022218f},
-std::array<float,2>{0.676337719f, 0.963347435f},
-std::array<float,2>{0.377870888f, 0.0424932316f},
-std::array<float,2>{0.903759003f, 0.447294712f},
-std::array<float,2>{0.233296618f, 0.540134132f},
-std::array<float,2>{0.780357122f, 0.734071612f},
-std::array<float,2>{0.0317061022f, 0.294819504f},
-std::array<float,2>{0.589082539f, 0.134209901f},
-std::array<float,2>{0.367222339f, 0.85544306f},
-std::array<float,2>{0.976110876f, 0.807131052f},
-std::array<float,2>{0.169885308f, 0.235068515f},
-std::array<float,2>{0.698964298f, 0.363248825f},
-std::array<float,2>{0.478933007f, 0.666579008f},
-std::array<float,2>{0.529698074f, 0.562610626f},
-std::array<float,2>{0.306798875f, 0.39321658f},
-std::array<float,2>{0.820792675f, 0.115539402f},
-std::array<float,2>{0.115945421f, 0.90554136f},
-std::array<float,2>{0.523588657f, 0.971377313f},
-std::array<float,2>{0.310658514f, 0.0250247307f},
-std::array<float,2>{0.824282229f, 0.479966789f},
-std::array<float,2>{0.110090204f, 0.526126444f},
-std::array<float,2>{0.970457911f, 0.71388489f},
-std::array<float,2>{0.164538413f, 0.28025806f},
-std::array<float,2>{0.699693203f, 0.16307354f},
-std::array<float,2>{0.484273702f, 0.836744726f},
-std::array<float,2>{0.774633765f, 0.766967475f},
-std::array<float,2>{0.0353819802f, 0.210906297f},
-std::array<float,2>{0.590594411f, 0.343101233f},
-std::array<float,2>{0.372289836f, 0.647706091f},
-std::array<float,2>{0.672108293f, 0.610156715f},
-std::array<float,2>{0.381870568f, 0.422843754f},
-std::array<float,2>{0.901954174f, 0.092479378f},
-std::array<float,2>{0.227331251f, 0.922237158f},
-std::array<float,2>{0.727732182f, 0.864680052f},
-std::array<float,2>{0.443191528f, 0.152478829f},
-std::array<float,2>{0.959240317f, 0.311627001f},
-std::array<float,2>{0.155756637f, 0.744979739f},
-std::array<float,2>{0.861042917f, 0.561043739f},
-std::array<float,2>{0.0864445493f, 0.455103576f},
-std::array<float,2>{0.549432516f, 0.0586629063f},
-std::array<float,2>{0.255540967f, 0.946210265f},
-std::array<float,2>{0.911536753f, 0.886089385f},
-std::array<float,2>{0.196334332f, 0.101294935f},
-std::array<float,2>{0.654420435f, 0.379690826f},
-std::array<float,2>{0.435227454f, 0.579127192f},
-std::array<float,2>{0.622394979f, 0.67662549f},
-std::array<float,2>{0.32989496f, 0.355966181f},
-std::array<float,2>{0.812183619f, 0.233811572f},
-std::array<float,2>{0.0222356711f, 0.794660032f},
-std::array<float,2>{0.566429913f, 0.799093664f},
-std::array<float,2>{0.345389158f, 0.246298075f},
-std::array<float,2>{0.756699085f, 0.373059243f},
-std::array<float,2>{0.0539034642f, 0.658575714f},
-std::array<float,2>{0.880011857f, 0.572755933f},
-std::array<float,2>{0.249205634f, 0.400467575f},
-std::array<float,2>{0.671346128f, 0.119265184f},
-std::array<float,2>{0.395578653f, 0.893274009f},
-std::array<float,2>{0.832316101f, 0.956937492f},
-std::array<float,2>{0.101791844f, 0.0368758999f},
-std::array<float,2>{0.501110256f, 0.441485047f},
-std::array<float,2>{0.295218289f, 0.536341786f},
-std::array<float,2>{0.710686326f, 0.726089358f},
-std::array<float,2>{0.499237061f, 0.284043521f},
-std::array<float,2>{0.996120751f, 0.130031213f},
-std::array<float,2>{0.182111025f, 0.848874331f},
-std::array<float,2>{0.639432788f, 0.910984755f},
-std::array<float,2>{0.41054368f, 0.0648414642f},
-std::array<float,2>{0.924366057f, 0.416710526f},
-std::array<float,2>{0.205928937f, 0.608294427f},
-std::array<float,2>{0.78296113f, 0.629222929f},
-std::array<float,2>{0.00923738442f, 0.315134466f},
-std::array<float,2>{0.599590659f, 0.199810669f},
-std::array<float,2>{0.324327826f, 0.751663625f},
-std::array<float,2>{0.939470291f, 0.826296866f},
-std::array<float,2>{0.131740883f, 0.172670081f},
-std::array<float,2>{0.748509288f, 0.265186548f},
-std::array<float,2>{0.458593041f, 0.693960249f},
-std::array<float,2>{0.546451986f, 0.505392492f},
-std::array<float,2>{0.275763422f, 0.493164688f},
-std::array<float,2>{0.852396667f, 0.00825914927f},
-std::array<float,2>{0.0643575564f, 0.986150146f},
-std::array<float,2>{0.603959978f, 0.90103054f},
-std::array<float,2>{0.316171616f, 0.11296735f},
-std::array<float,2>{0.794045329f, 0.395937622f},
-std::array<float,2>{0.00754147442f, 0.568935573f},
-std::array<float,2>{0.934364498f, 0.668183088f},
-std::array<float,2>{0.21709381f, 0.365830541f},
-std::array<float,2>{0.627768695f, 0.23871994f},
-std::array<float,2>{0.414809406f, 0.809982717f},
-std::array<float,2>{0.844616771f, 0.858263671f},
-std::array<float,2>{0.0780763254f, 0.138524592f},
-std::array<float,2>{0.532562315f, 0.292479634f},
-std::array<float,2>{0.266920179f, 0.727456689f},
-std::array<float,2>{0.738998532f, 0.545741856f},
-std::array<float,2>{0.464617401f, 0.451652706f},
-std::array<float,2>{0.949751675f, 0.0450029895f},
-std::array<float,2>{0.139789447f, 0.965214729f},
-std::array<float,2>{0.656264365f, 0.758517444f},
-std::array<float,2>{0.401767671f, 0.190967157f},
-std::array<float,2>{0.889192402f, 0.324508637f},
-std::array<float,2>{0.238417491f, 0.634779513f},
-std::array<float,2>{0.759153008f, 0.599673092f},
-std::array<float,2>{0.0622897893f, 0.413278699f},
-std::array<float,2>{0.572827816f, 0.0711607561f},
-std::array<float,2>{0.357148379f, 0.915178895f},
-std::array<float,2>{0.988975167f, 0.995339036f},
-std::array<float,2>{0.175068557f, 0.00120995636f},
-std::array<float,2>{0.714210927f, 0.485230148f},
-std::array<float,2>{0.48516497f, 0.512304902f},
-std::array<float,2>{0.514163554f, 0.69937104f},
-std::array<float,2>{0.288233757f, 0.257674068f},
-std::array<float,2>{0.839668691f, 0.18255879f},
-std::array<float,2>{0.10144978f, 0.819951057f},
-std::array<float,2>{0.560325325f, 0.834342539f},
-std::array<float,2>{0.260914624f, 0.165719286f},
-std::array<float,2>{0.867411435f, 0.267233044f},
-std::array<float,2>{0.0823375955f, 0.71035862f},
-std::array<float,2>{0.961332381f, 0.517491162f},
-std::array<float,2>{0.143064737f, 0.473985672f},
-std::array<float,2>{0.722458124f, 0.0229826402f},
-std::array<float,2>{0.447866768f, 0.979450941f},
-std::array<float,2>{0.800742686f, 0.93417716f},
-std::array<float,2>{0.0268699452f, 0.0824594796f},
-std::array<float,2>{0.611015797f, 0.431386113f},
-std::array<float,2>{0.339020312f, 0.62160027f},
-std::array<float,2>{0.646262646f, 0.651701033f},
-std::array<float,2>{0.426688433f, 0.331154108f},
-std::array<float,2>{0.91569072f, 0.214954063f},
-std::array<float,2>{0.187978476f, 0.776785791f},
-std::array<float,2>{0.692248464f, 0.941496849f},
-std::array<float,2>{0.47165972f, 0.0545652173f},
-std::array<float,2>{0.980517089f, 0.463367254f},
-std::array<float,2>{0.163317829f, 0.549239993f},
-std::array<float,2>{0.813222885f, 0.737372518f},
-std::array<float,2>{0.1241166f, 0.298240453f},
-std::array<float,2>{0.516816676f, 0.144238263f},
-std::array<float,2>{0.301424891f, 0.871126354f},
-std::array<float,2>{0.893361747f, 0.781899512f},
-std::array<float,2>{0.219789818f, 0.22079888f},
-std::array<float,2>{0.683926523f, 0.348270506f},
-std::array<float,2>{0.389394879f, 0.681087434f},
-std::array<float,2>{0.582292795f, 0.589629591f},
-std::array<float,2>{0.363355428f, 0.383380026f},
-std::array<float,2>{0.769374847f, 0.108906604f},
-std::array<float,2>{0.0453590937f, 0.879647553f},
-std::array<float,2>{0.589629114f, 0.961973608f},
-std::array<float,2>{0.368100494f, 0.0402133726f},
-std::array<float,2>{0.781117082f, 0.446383238f},
-std::array<float,2>{0.0318931155f, 0.541220605f},
-std::array<float,2>{0.904230118f, 0.732373238f},
-std::array<float,2>{0.232689232f, 0.295955718f},
-std::array<float,2>{0.676046193f, 0.135441199f},
-std::array<float,2>{0.377216488f, 0.853386283f},
-std::array<float,2>{0.820837736f, 0.805943549f},
-std::array<float,2>{0.115716234f, 0.237262785f},
-std::array<float,2>{0.530011415f, 0.359607607f},
-std::array<float,2>{0.30733487f, 0.664114237f},
-std::array<float,2>{0.698316395f, 0.565315902f},
-std::array<float,2>{0.47914502f, 0.391132593f},
-std::array<float,2>{0.976071954f, 0.113618165f},
-std::array<float,2>{0.169068605f, 0.903429449f},
-std::array<float,2>{0.650996089f, 0.813065588f},
-std::array<float,2>{0.432224512f, 0.185436293f},
-std::array<float,2>{0.906769335f, 0.252806365f},
-std::array<float,2>{0.200044483f, 0.698077261f},
-std::array<float,2>{0.804844618f, 0.509255886f},
-std::array<float,2>{0.0182050243f, 0.48843348f},
-std::array<float,2>{0.620833695f, 0.0052047018f},
-std::array<float,2>{0.335549384f, 0.998909473f},
-std::array<float,2>{0.954687417f, 0.919461429f},
-std::array<float,2>{0.150629267f, 0.0757875592f},
-std::array<float,2>{0.732398272f, 0.406655967f},
-std::array<float,2>{0.441187739f, 0.596193016f},
-std::array<float,2>{0.551828921f, 0.640567958f},
-std::array<float,2>{0.251123458f, 0.32207796f},
-std::array<float,2>{0.866660357f, 0.192139715f},
-std::array<float,2>{0.0929629952f, 0.763637066f},
-std::array<float,2>{0.505346417f, 0.778355539f},
-std::array<float,2>{0.290990829f, 0.214047357f},
-std::array<float,2>{0.831734002f, 0.333984464f},
-std::array<float,2>{0.106298923f, 0.655485809f},
-std::array<float,2>{0.996026993f, 0.617560267f},
-std::array<float,2>{0.187375724f, 0.437342018f},
-std::array<float,2>{0.706945002f, 0.0782172307f},
-std::array<float,2>{0.494183153f, 0.932238996f},
-std::array<float,2>{0.752641499f, 0.983231902f},
-std::array<float,2>{0.048586607f, 0.0165472943f},
-std::array<float,2>{0.564586639f, 0.471892923f},
-std::array<float,2>{0.351380825f, 0.520001829f},
-std::array<float,2>{0.666042507f, 0.70338136f},
-std::array<float,2>{0.394416183f, 0.270960569f},
-std::array<float,2>{0.878839672f, 0.170320034f},
-std::array<float,2>{0.24569577f, 0.830788374f},
-std::array<float,2>{0.742971361f, 0.878890991f},
-std::array<float,2>{0.45696792f, 0.103300638f},
-std::array<float,2>{0.943001091f, 0.39022398f},
-std::array<float,2>{0.127108097f, 0.592993915f},
-std::array<float,2>{0.855738401f, 0.683634818f},
-std::array<float,2>{0.0666616485f, 0.344143182f},
-std::array<float,2>{0.540246367f, 0.225414589f},
-std::array<float,2>{0.278038859f, 0.785696328f},
-std::array<float,2>{0.926051199f, 0.870686769f},
-std::array<float,2>{0.208480358f, 0.148112595f},
-std::array<float,2>{0.634749949f, 0.303753316f},
-std::array<float,2>{0.408274949f, 0.738818705f},
-std::array<float,2>{0.59666568f, 0.551746011f},
-std::array<float,2>{0.321435273f, 0.468696654f},
-std::array<float,2>{0.788919568f, 0.0505278222f},
-std::array<float,2>{0.0153387515f, 0.941076934f},
-std::array<float,2>{0.535553932f, 0.927972078f},
-std::array<float,2>{0.271229655f, 0.087949641f},
-std::array<float,2>{0.848447144f, 0.426356286f},
-std::array<float,2>{0.0740086585f, 0.614755392f},
-std::array<float,2>{0.946662307f, 0.641569495f},
-std::array<float,2>{0.136095434f, 0.337961078f},
-std::array<float,2>{0.737413585f, 0.205017194f},
-std::array<float,2>{0.466710865f, 0.771963716f},
-std::array<float,2>{0.792305887f, 0.842358947f},
-std::array<float,2>{0.00209570583f, 0.158796757f},
-std::array<float,2>{0.60655427f, 0.273699999f},
-std::array<float,2>{0.317717046f, 0.718051612f},
-std::array<float,2>{0.63249135f, 0.531231403f},
-std::array<float,2>{0.419837087f, 0.482767224f},
-std::array<float,2>{0.932505131f, 0.0295742843f},
-std::array<float,2>{0.212697327f, 0.972955585f},
-std::array<float,2>{0.717750192f, 0.792441368f},
-std::array<float,2>{0.489585787f, 0.229460791f},
-std::array<float,2>{0.985229194f, 0.354059786f},
-std::array<float,2>{0.176677838f, 0.675294757f},
-std::array<float,2>{0.841939211f, 0.58411938f},
-std::array<float,2>{0.0942628235f, 0.378320903f},
-std::array<float,2>{0.509345114f, 0.0975888968f},
-std::array<float,2>{0.281940639f, 0.889178455f},
-std::array<float,2>{0.885518968f, 0.950101793f},
-std::array<float,2>{0.237652436f, 0.0562588498f},
-std::array<float,2>{0.662835777f, 0.457406491f},
-std::array<float,2>{0.403656125f, 0.557956994f},
-std::array<float,2>{0.577810466f, 0.74810338f},
-std::array<float,2>{0.352839768f, 0.305399686f},
-std::array<float,2>{0.761787713f, 0.150399595f},
-std::array<float,2>{0.0560141094f, 0.860562563f},
-std::array<float,2>{0.616443396f, 0.846781731f},
-std::array<float,2>{0.343294054f, 0.126895174f},
-std::array<float,2>{0.804230094f, 0.28632912f},
-std::array<float,2>{0.0292746946f, 0.719478548f},
-std::array<float,2>{0.920160711f, 0.532215595f},
-std::array<float,2>{0.191906109f, 0.438234299f},
-std::array<float,2>{0.642496407f, 0.033422254f},
-std::array<float,2>{0.424681365f, 0.960134327f},
-std::array<float,2>{0.874572873f, 0.89489913f},
-std::array<float,2>{0.078718327f, 0.121541239f},
-std::array<float,2>{0.555067241f, 0.404987007f},
-std::array<float,2>{0.261982232f, 0.575342655f},
-std::array<float,2>{0.725414515f, 0.662882209f},
-std::array<float,2>{0.449602753f, 0.370871812f},
-std::array<float,2>{0.967850924f, 0.245489821f},
-std::array<float,2>{0.147047117f, 0.804621041f},
-std::array<float,2>{0.683019102f, 0.991730034f},
-std::array<float,2>{0.385755926f, 0.0121740317f},
-std::array<float,2>{0.895251036f, 0.498902798f},
-std::array<float,2>{0.224238664f, 0.503045559f},
-std::array<float,2>{0.770645261f, 0.68794471f},
-std::array<float,2>{0.0428776182f, 0.259790629f},
-std::array<float,2>{0.581231296f, 0.175818458f},
-std::array<float,2>{0.362496048f, 0.820754826f},
-std::array<float,2>{0.979135692f, 0.757372141f},
-std::array<float,2>{0.157203451f, 0.197462127f},
-std::array<float,2>{0.689629912f, 0.317118108f},
-std::array<float,2>{0.476222992f, 0.625380695f},
-std::array<float,2>{0.520509124f, 0.603331268f},
-std::array<float,2>{0.299822181f, 0.418464333f},
-std::array<float,2>{0.818300068f, 0.0676197261f},
-std::array<float,2>{0.11721348f, 0.907479942f},
-std::array<float,2>{0.547010541f, 0.948075116f},
-std::array<float,2>{0.257243127f, 0.0621525981f},
-std::array<float,2>{0.862351835f, 0.45345521f},
-std::array<float,2>{0.0898201764f, 0.559515655f},
-std::array<float,2>{0.958828032f, 0.742247462f},
-std::array<float,2>{0.152432799f, 0.309050411f},
-std::array<float,2>{0.728886366f, 0.155847967f},
-std::array<float,2>{0.444618642f, 0.866860986f},
-std::array<float,2>{0.810278118f, 0.79677552f},
-std::array<float,2>{0.0207379777f, 0.231933385f},
-std::array<float,2>{0.624943852f, 0.359036982f},
-std::array<float,2>{0.330120742f, 0.679228127f},
-std::array<float,2>{0.652583897f, 0.581386209f},
-std::array<float,2>{0.436516166f, 0.381211907f},
-std::array<float,2>{0.912994623f, 0.0979797021f},
-std::array<float,2>{0.197800681f, 0.883682668f},
-std::array<float,2>{0.702689588f, 0.837931335f},
-std::array<float,2>{0.481495887f, 0.160191461f},
-std::array<float,2>{0.970905602f, 0.277892381f},
-std::array<float,2>{0.166940749f, 0.7125476f},
-std::array<float,2>{0.827932179f, 0.523622215f},
-std::array<float,2>{0.112444542f, 0.47676748f},
-std::array<float,2>{0.526223719f, 0.0256312508f},
-std::array<float,2>{0.309423536f, 0.970527351f},
-std::array<float,2>{0.899361074f, 0.925337374f},
-std::array<float,2>{0.229150385f, 0.0906387866f},
-std::array<float,2>{0.674114347f, 0.425752461f},
-std::array<float,2>{0.379347295f, 0.611971378f},
-std::array<float,2>{0.593098998f, 0.645713627f},
-std::array<float,2>{0.37367627f, 0.340614527f},
-std::array<float,2>{0.776253998f, 0.207865208f},
-std::array<float,2>{0.0379019156f, 0.769448519f},
-std::array<float,2>{0.601409554f, 0.752330482f},
-std::array<float,2>{0.327893645f, 0.201914668f},
-std::array<float,2>{0.784995377f, 0.313931465f},
-std::array<float,2>{0.0104083698f, 0.632376373f},
-std::array<float,2>{0.923725724f, 0.606522918f},
-std::array<float,2>{0.204555154f, 0.414800495f},
-std::array<float,2>{0.638560712f, 0.0639278516f},
-std::array<float,2>{0.412558615f, 0.912783623f},
-std::array<float,2>{0.855219066f, 0.987454414f},
-std::array<float,2>{0.0650068596f, 0.0112899682f},
-std::array<float,2>{0.543382585f, 0.494968385f},
-std::array<float,2>{0.274673134f, 0.506908417f},
-std::array<float,2>{0.746764004f, 0.691969812f},
-std::array<float,2>{0.459610909f, 0.263408929f},
-std::array<float,2>{0.937523425f, 0.175090134f},
-std::array<float,2>{0.130232319f, 0.825728118f},
-std::array<float,2>{0.668737113f, 0.891136467f},
-std::array<float,2>{0.396595806f, 0.117942549f},
-std::array<float,2>{0.881770492f, 0.398713827f},
-std::array<float,2>{0.247871786f, 0.572208822f},
-std::array<float,2>{0.754679799f, 0.65664041f},
-std::array<float,2>{0.0512719862f, 0.371525496f},
-std::array<float,2>{0.568728566f, 0.248878598f},
-std::array<float,2>{0.347556442f, 0.797380567f},
-std::array<float,2>{0.998557389f, 0.85041368f},
-std::array<float,2>{0.181627795f, 0.13229546f},
-std::array<float,2>{0.708289623f, 0.281761765f},
-std::array<float,2>{0.496284842f, 0.72402066f},
-std::array<float,2>{0.502742708f, 0.537665248f},
-std::array<float,2>{0.294877559f, 0.445025325f},
-std::array<float,2>{0.834278345f, 0.0372801647f},
-std::array<float,2>{0.104731269f, 0.953170598f},
-std::array<float,2>{0.570822895f, 0.917627275f},
-std::array<float,2>{0.358605325f, 0.0722952336f},
-std::array<float,2>{0.761053205f, 0.410921067f},
-std::array<float,2>{0.0595774353f, 0.597674727f},
-std::array<float,2>{0.88695246f, 0.633928061f},
-std::array<float,2>{0.242126003f, 0.326963782f},
-std::array<float,2>{0.658479989f, 0.188922822f},
-std::array<float,2>{0.400084496f, 0.760552645f},
-std::array<float,2>{0.836259067f, 0.817767918f},
-std::array<float,2>{0.0981009677f, 0.18118225f},
-std::array<float,2>{0.512083709f, 0.254378229f},
-std::array<float,2>{0.286531448f, 0.701810122f},
-std::array<float,2>{0.712450683f, 0.513686955f},
-std::array<float,2>{0.487919629f, 0.486765772f},
-std::array<float,2>{0.990968406f, 0.0027782023f},
-std::array<float,2>{0.172404408f, 0.992294908f},
-std::array<float,2>{0.626391768f, 0.812382936f},
-std::array<float,2>{0.416539788f, 0.240698725f},
-std::array<float,2>{0.937003791f, 0.364602685f},
-std::array<float,2>{0.215777829f, 0.670847058f},
-std::array<float,2>{0.795042098f, 0.56666261f},
-std::array<float,2>{0.00573859084f, 0.397642761f},
-std::array<float,2>{0.602657616f, 0.110028267f},
-std::array<float,2>{0.313374639f, 0.899093568f},
-std::array<float,2>{0.951980352f, 0.967402458f},
-std::array<float,2>{0.137557f, 0.0445042513f},
-std::array<float,2>{0.741699338f, 0.449568301f},
-std::array<float,2>{0.461111248f, 0.54489398f},
-std::array<float,2>{0.533780217f, 0.729022384f},
-std::array<float,2>{0.267734051f, 0.289592803f},
-std::array<float,2>{0.845944226f, 0.140476763f},
-std::array<float,2>{0.0758213028f, 0.856373727f},
-std::array<float,2>{0.518083513f, 0.873231173f},
-std::array<float,2>{0.30313617f, 0.14189671f},
-std::array<float,2>{0.815722406f, 0.300631613f},
-std::array<float,2>{0.121931441f, 0.736020088f},
-std::array<float,2>{0.982542276f, 0.54746896f},
-std::array<float,2>{0.161661148f, 0.461985588f},
-std::array<float,2>{0.695181727f, 0.0520351417f},
-std::array<float,2>{0.468999058f, 0.945270896f},
-std::array<float,2>{0.767077804f, 0.881130815f},
-std::array<float,2>{0.0441074036f, 0.10607627f},
-std::array<float,2>{0.585310578f, 0.386620611f},
-std::array<float,2>{0.366824329f, 0.587099552f},
-std::array<float,2>{0.685732543f, 0.682350338f},
-std::array<float,2>{0.387754023f, 0.350671351f},
-std::array<float,2>{0.891021132f, 0.219690964f},
-std::array<float,2>{0.22106342f, 0.783955932f},
-std::array<float,2>{0.720119238f, 0.977579892f},
-std::array<float,2>{0.447247297f, 0.0205506701f},
-std::array<float,2>{0.963410318f, 0.476136804f},
-std::array<float,2>{0.141999677f, 0.519333661f},
-std::array<float,2>{0.870444059f, 0.708762169f},
-std::array<float,2>{0.0844358727f, 0.26760295f},
-std::array<float,2>{0.561593294f, 0.166797191f},
-std::array<float,2>{0.258082062f, 0.832060039f},
-std::array<float,2>{0.917208374f, 0.774356425f},
-std::array<float,2>{0.190950081f, 0.218554869f},
-std::array<float,2>{0.647511005f, 0.328679323f},
-std::array<float,2>{0.428131193f, 0.648759902f},
-std::array<float,2>{0.611430764f, 0.624978662f},
-std::array<float,2>{0.336962342f, 0.432565302f},
-std::array<float,2>{0.798695087f, 0.0857870951f},
-std::array<float,2>{0.0236487892f, 0.935858071f},
-std::array<float,2>{0.618094385f, 0.99657166f},
-std::array<float,2>{0.333079964f, 0.00690712687f},
-std::array<float,2>{0.808368504f, 0.491089344f},
-std::array<float,2>{0.0165615734f, 0.511697769f},
-std::array<float,2>{0.908902109f, 0.696145713f},
-std::array<float,2>{0.203076303f, 0.251481324f},
-std::array<float,2>{0.649490237f, 0.187315896f},
-std::array<float,2>{0.430503815f, 0.815816522f},
-std::array<float,2>{0.864594519f, 0.765225112f},
-std::array<float,2>{0.0908359662f, 0.19480288f},
-std::array<float,2>{0.553332806f, 0.32281512f},
-std::array<float,2>{0.253842026f, 0.637033105f},
-std::array<float,2>{0.734254181f, 0.594201922f},
-std::array<float,2>{0.439429075f, 0.410038888f},
-std::array<float,2>{0.955621481f, 0.0768968761f},
-std::array<float,2>{0.149289742f, 0.920231462f},
-std::array<float,2>{0.677789986f, 0.854888797f},
-std::array<float,2>{0.376839966f, 0.134610474f},
-std::array<float,2>{0.904713571f, 0.294277728f},
-std::array<float,2>{0.232184693f, 0.733665228f},
-std::array<float,2>{0.778239429f, 0.540659308f},
-std::array<float,2>{0.033878807f, 0.448132843f},
-std::array<float,2>{0.58702904f, 0.0421133004f},
-std::array<float,2>{0.370411426f, 0.963573515f},
-std::array<float,2>{0.973859668f, 0.906082392f},
-std::array<float,2>{0.170436308f, 0.115812808f},
-std::array<float,2>{0.695858955f, 0.393024415f},
-std::array<float,2>{0.478219867f, 0.563129425f},
-std::array<float,2>{0.528508067f, 0.66648674f},
-std::array<float,2>{0.305175781f, 0.362500131f},
-std::array<float,2>{0.822539985f, 0.234617278f},
-std::array<float,2>{0.113394104f, 0.807095647f},
-std::array<float,2>{0.541638911f, 0.788847983f},
-std::array<float,2>{0.280402809f, 0.223636582f},
-std::array<float,2>{0.858347118f, 0.347247511f},
-std::array<float,2>{0.0700163394f, 0.686153769f},
-std::array<float,2>{0.945055962f, 0.591047883f},
-std::array<float,2>{0.12640059f, 0.387783438f},
-std::array<float,2>{0.746069729f, 0.10486456f},
-std::array<float,2>{0.454814851f, 0.87540251f},
-std::array<float,2>{0.786237657f, 0.938353062f},
-std::array<float,2>{0.0123971375f, 0.0478532463f},
-std::array<float,2>{0.593834937f, 0.465385437f},
-std::array<float,2>{0.322352707f, 0.553354084f},
-std::array<float,2>{0.635480285f, 0.741641402f},
-std::array<float,2>{0.408016413f, 0.300856143f},
-std::array<float,2>{0.928157449f, 0.144746989f},
-std::array<float,2>{0.209237933f, 0.867232203f},
-std::array<float,2>{0.703190744f, 0.929799497f},
-std::array<float,2>{0.493842691f, 0.0814495608f},
-std::array<float,2>{0.993977368f, 0.434160203f},
-std::array<float,2>{0.183915049f, 0.620759785f},
-std::array<float,2>{0.829024017f, 0.65293473f},
-std::array<float,2>{0.107751951f, 0.332812518f},
-std::array<float,2>{0.507528722f, 0.21129486f},
-std::array<float,2>{0.292239964f, 0.780920386f},
-std::array<float,2>{0.875461698f, 0.829028368f},
-std::array<float,2>{0.24276337f, 0.169647127f},
-std::array<float,2>{0.664727271f, 0.272464514f},
-std::array<float,2>{0.391266018f, 0.706498027f},
-std::array<float,2>{0.563013375f, 0.523282349f},
-std::array<float,2>{0.348128319f, 0.47027564f},
-std::array<float,2>{0.750325918f, 0.018024724f},
-std::array<float,2>{0.0491772853f, 0.981523812f},
-std::array<float,2>{0.51168716f, 0.887346208f},
-std::array<float,2>{0.283931077f, 0.0949738771f},
-std::array<float,2>{0.839957952f, 0.376708061f},
-std::array<float,2>{0.096886605f, 0.582725346f},
-std::array<float,2>{0.986712456f, 0.6721856f},
-std::array<float,2>{0.178973019f, 0.352909565f},
-std::array<float,2>{0.716352999f, 0.22826989f},
-std::array<float,2>{0.491276234f, 0.789801836f},
-std::array<float,2>{0.765589416f, 0.863211751f},
-std::array<float,2>{0.0585753694f, 0.148531556f},
-std::array<float,2>{0.576068282f, 0.307474941f},
-std::array<float,2>{0.353700042f, 0.74796623f},
-std::array<float,2>{0.660418332f, 0.555727184f},
-std::array<float,2>{0.40585801f, 0.460858434f},
-std::array<float,2>{0.883643568f, 0.0575645417f},
-std::array<float,2>{0.235341638f, 0.952189624f},
-std::array<float,2>{0.734668374f, 0.771411121f},
-std::array<float,2>{0.467371166f, 0.205387622f},
-std::array<float,2>{0.94811362f, 0.33680293f},
-std::array<float,2>{0.133939579f, 0.643871129f},
-std::array<float,2>{0.850418806f, 0.61589396f},
-std::array<float,2>{0.0717570111f, 0.429597378f},
-std::array<float,2>{0.53787607f, 0.085979633f},
-std::array<float,2>{0.272988707f, 0.926763296f},
-std::array<float,2>{0.929745078f, 0.975165844f},
-std::array<float,2>{0.21440509f, 0.0279555991f},
-std::array<float,2>{0.630202115f, 0.481946617f},
-std::array<float,2>{0.42119956f, 0.527612627f},
-std::array<float,2>{0.607699871f, 0.716258049f},
-std::array<float,2>{0.318653077f, 0.275902569f},
-std::array<float,2>{0.79092443f, 0.156708851f},
-std::array<float,2>{0.00110160455f, 0.840815842f},
-std::array<float,2>{0.57982868f, 0.823491693f},
-std::array<float,2>{0.360019118f, 0.179455668f},
-std::array<float,2>{0.772622168f, 0.258149177f},
-std::array<float,2>{0.0392658599f, 0.690307975f},
-std::array<float,2>{0.898369789f, 0.500843585f},
-std::array<float,2>{0.226062998f, 0.497954577f},
-std::array<float,2>{0.681384325f, 0.014823054f},
-std::array<float,2>{0.383237243f, 0.988384485f},
-std::array<float,2>{0.819958031f, 0.908930123f},
-std::array<float,2>{0.120034367f, 0.0696942359f},
-std::array<float,2>{0.522614658f, 0.420614392f},
-std::array<float,2>{0.297346056f, 0.604911268f},
-std::array<float,2>{0.689344406f, 0.627345145f},
-std::array<float,2>{0.474576145f, 0.318482429f},
-std::array<float,2>{0.977380157f, 0.196573243f},
-std::array<float,2>{0.159919262f, 0.754372895f},
-std::array<float,2>{0.643687308f, 0.958565354f},
-std::array<float,2>{0.423780501f, 0.0316518918f},
-std::array<float,2>{0.919147193f, 0.440121561f},
-std::array<float,2>{0.193697929f, 0.534532011f},
-std::array<float,2>{0.801211536f, 0.720732868f},
-std::array<float,2>{0.0293852389f, 0.287893802f},
-std::array<float,2>{0.613651931f, 0.128493398f},
-std::array<float,2>{0.339871168f, 0.843917191f},
-std::array<float,2>{0.96660322f, 0.801181316f},
-std::array<float,2>{0.145587087f, 0.242836729f},
-std::array<float,2>{0.723117709f, 0.367546022f},
-std::array<float,2>{0.453099936f, 0.660394788f},
-std::array<float,2>{0.556920767f, 0.577865481f},
-std::array<float,2>{0.265536427f, 0.403765023f},
-std::array<float,2>{0.872147322f, 0.123324119f},
-std::array<float,2>{0.0811757818f, 0.897531509f},
-std::array<float,2>{0.544189453f, 0.985088289f},
-std::array<float,2>{0.274313122f, 0.00903133769f},
-std::array<float,2>{0.85377723f, 0.492857516f},
-std::array<float,2>{0.0660186782f, 0.504537225f},
-std::array<float,2>{0.938877106f, 0.694877982f},
-std::array<float,2>{0.129793733f, 0.264076352f},
-std::array<float,2>{0.747448087f, 0.173664987f},
-std::array<float,2>{0.460487902f, 0.827466667f},
-std::array<float,2>{0.784132481f, 0.750383556f},
-std::array<float,2>{0.0112328334f, 0.201116338f},
-std::array<float,2>{0.599849999f, 0.315487772f},
-std::array<float,2>{0.326801509f, 0.630702853f},
-std::array<float,2>{0.63753891f, 0.608600259f},
-std::array<float,2>{0.413232803f, 0.417209715f},
-std::array<float,2>{0.922006965f, 0.0660854205f},
-std::array<float,2>{0.203974292f, 0.911991656f},
-std::array<float,2>{0.707248926f, 0.847880363f},
-std::array<float,2>{0.497752786f, 0.129786775f},
-std::array<float,2>{0.999188006f, 0.284570128f},
-std::array<float,2>{0.180603728f, 0.725234628f},
-std::array<float,2>{0.83501941f, 0.535874069f},
-std::array<float,2>{0.103950374f, 0.443210185f},
-std::array<float,2>{0.50302124f, 0.035596244f},
-std::array<float,2>{0.293342948f, 0.955303133f},
-std::array<float,2>{0.881980419f, 0.894333005f},
-std::array<float,2>{0.246284485f, 0.120172769f},
-std::array<float,2>{0.669737756f, 0.401592016f},
-std::array<float,2>{0.397732377f, 0.573495746f},
-std::array<float,2>{0.570052326f, 0.659746945f},
-std::array<float,2>{0.346183538f, 0.374071538f},
-std::array<float,2>{0.755331337f, 0.247829854f},
-std::array<float,2>{0.0518437028f, 0.800005436f},
-std::array<float,2>{0.623975813f, 0.793326437f},
-std::array<float,2>{0.331345946f, 0.232913882f},
-std::array<float,2>{0.809431911f, 0.35691458f},
-std::array<float,2>{0.0204016361f, 0.67708379f},
-std::array<float,2>{0.913752913f, 0.578618228f},
-std::array<float,2>{0.198845312f, 0.380453527f},
-std::array<float,2>{0.653599024f, 0.100398175f},
-std::array<float,2>{0.437122494f, 0.885389626f},
-std::array<float,2>{0.861600339f, 0.946982861f},
-std::array<float,2>{0.0886427239f, 0.0596659295f},
-std::array<float,2>{0.547974586f, 0.456264079f},
-std::array<float,2>{0.256308019f, 0.562404215f},
-std::array<float,2>{0.729694486f, 0.746055901f},
-std::array<float,2>{0.443574876f, 0.311168492f},
-std::array<float,2>{0.957115591f, 0.154183984f},
-std::array<float,2>{0.153452933f, 0.863458991f},
-std::array<float,2>{0.675753355f, 0.923078239f},
-std::array<float,2>{0.380773544f, 0.0934242308f},
-std::array<float,2>{0.89962697f, 0.422917426f},
-std::array<float,2>{0.230296671f, 0.611106575f},
-std::array<float,2>{0.777257204f, 0.646889925f},
-std::array<float,2>{0.0383920409f, 0.342527956f},
-std::array<float,2>{0.592196882f, 0.209279537f},
-std::array<float,2>{0.374702215f, 0.766211033f},
-std::array<float,2>{0.972627997f, 0.837604642f},
-std::array<float,2>{0.167108268f, 0.164021835f},
-std::array<float,2>{0.701336086f, 0.281000346f},
-std::array<float,2>{0.480976999f, 0.713517308f},
-std::array<float,2>{0.526872575f, 0.527150095f},
-std::array<float,2>{0.310376078f, 0.479234546f},
-std::array<float,2>{0.826936603f, 0.023719769f},
-std::array<float,2>{0.112250462f, 0.972564697f},
-std::array<float,2>{0.584513009f, 0.880357504f},
-std::array<float,2>{0.365639389f, 0.108222216f},
-std::array<float,2>{0.766062379f, 0.384022087f},
-std::array<float,2>{0.0433132574f, 0.588494062f},
-std::array<float,2>{0.892393172f, 0.679759204f},
-std::array<float,2>{0.222654268f, 0.349477977f},
-std::array<float,2>{0.687013626f, 0.222308129f},
-std::array<float,2>{0.387382329f, 0.782290459f},
-std::array<float,2>{0.815401793f, 0.872357547f},
-std::array<float,2>{0.12210802f, 0.143123612f},
-std::array<float,2>{0.51929307f, 0.297039539f},
-std::array<float,2>{0.304002851f, 0.736369073f},
-std::array<float,2>{0.693381846f, 0.550202131f},
-std::array<float,2>{0.469764858f, 0.463883013f},
-std::array<float,2>{0.983943582f, 0.0529832616f},
-std::array<float,2>{0.161022723f, 0.943266153f},
-std::array<float,2>{0.646575987f, 0.775482416f},
-std::array<float,2>{0.428863347f, 0.216467723f},
-std::array<float,2>{0.916211963f, 0.330825508f},
-std::array<float,2>{0.189822838f, 0.650498927f},
-std::array<float,2>{0.797239006f, 0.622105241f},
-std::array<float,2>{0.0250316709f, 0.430402905f},
-std::array<float,2>{0.612812459f, 0.0839345381f},
-std::array<float,2>{0.336603999f, 0.934700489f},
-std::array<float,2>{0.964275181f, 0.98029232f},
-std::array<float,2>{0.140822068f, 0.0223203916f},
-std::array<float,2>{0.719605386f, 0.472778231f},
-std::array<float,2>{0.445403785f, 0.515986025f},
-std::array<float,2>{0.561358929f, 0.708994627f},
-std::array<float,2>{0.259015948f, 0.265669823f},
-std::array<float,2>{0.869264245f, 0.165023789f},
-std::array<float,2>{0.0853434056f, 0.835434437f},
-std::array<float,2>{0.512808979f, 0.818403542f},
-std::array<float,2>{0.285322517f, 0.182654575f},
-std::array<float,2>{0.8374874f, 0.256213188f},
-std::array<float,2>{0.0986836925f, 0.700806916f},
-std::array<float,2>{0.991403997f, 0.513664246f},
-std::array<float,2>{0.172985196f, 0.485568941f},
-std::array<float,2>{0.711899161f, 0.000667699554f},
-std::array<float,2>{0.486714363f, 0.994743526f},
-std::array<float,2>{0.760360956f, 0.914309561f},
-std::array<float,2>{0.0595628582f, 0.0717037842f},
-std::array<float,2>{0.571873844f, 0.412749827f},
-std::array<float,2>{0.357813805f, 0.600833595f},
-std::array<float,2>{0.659963846f, 0.636523724f},
-std::array<float,2>{0.398593724f, 0.326061308f},
-std::array<float,2>{0.888439238f, 0.189793989f},
-std::array<float,2>{0.240785033f, 0.759299278f},
-std::array<float,2>{0.740517855f, 0.965827465f},
-std::array<float,2>{0.462711364f, 0.045982603f},
-std::array<float,2>{0.952319682f, 0.452745557f},
-std::array<float,2>{0.138620645f, 0.546168745f},
-std::array<float,2>{0.847454846f, 0.727846384f},
-std::array<float,2>{0.0751497969f, 0.291248888f},
-std::array<float,2>{0.534423172f, 0.137417123f},
-std::array<float,2>{0.269379139f, 0.858891428f},
-std::array<float,2>{0.935979068f, 0.80946815f},
-std::array<float,2>{0.215941042f, 0.239726931f},
-std::array<float,2>{0.625523269f, 0.366289288f},
-std::array<float,2>{0.417324334f, 0.669635832f},
-std::array<float,2>{0.602324426f, 0.569556236f},
-std::array<float,2>{0.314072877f, 0.395391732f},
-std::array<float,2>{0.796253145f, 0.112220161f},
-std::array<float,2>{0.00464276131f, 0.902019858f},
-std::array<float,2>{0.595633447f, 0.940086901f},
-std::array<float,2>{0.323367298f, 0.049673982f},
-std::array<float,2>{0.785412133f, 0.467629701f},
-std::array<float,2>{0.0128114568f, 0.552151322f},
-std::array<float,2>{0.929334998f, 0.739839911f},
-std::array<float,2>{0.210285142f, 0.30299747f},
-std::array<float,2>{0.635889411f, 0.146587297f},
-std::array<float,2>{0.407096446f, 0.869980812f},
-std::array<float,2>{0.85851723f, 0.786614776f},
-std::array<float,2>{0.0693089291f, 0.226240814f},
-std::array<float,2>{0.542194963f, 0.34546262f},
-std::array<float,2>{0.279992104f, 0.685015142f},
-std::array<float,2>{0.744722366f, 0.592389226f},
-std::array<float,2>{0.453968376f, 0.389330089f},
-std::array<float,2>{0.943422437f, 0.102359228f},
-std::array<float,2>{0.125193298f, 0.877620578f},
-std::array<float,2>{0.66545099f, 0.831307232f},
-std::array<float,2>{0.392037034f, 0.171256915f},
-std::array<float,2>{0.876660407f, 0.269795686f},
-std::array<float,2>{0.243298158f, 0.704687595f},
-std::array<float,2>{0.751223207f, 0.520870984f},
-std::array<float,2>{0.0506489426f, 0.471585125f},
-std::array<float,2>{0.564328194f, 0.0170004517f},
-std::array<float,2>{0.349472433f, 0.983657181f},
-std::array<float,2>{0.992808342f, 0.93330884f},
-std::array<float,2>{0.185033053f, 0.0797849149f},
-std::array<float,2>{0.704595268f, 0.435556442f},
-std::array<float,2>{0.492310673f, 0.618274391f},
-std::array<float,2>{0.505911529f, 0.654887199f},
-std::array<float,2>{0.291413546f, 0.335438013f},
-std::array<float,2>{0.829791427f, 0.213293806f},
-std::array<float,2>{0.10893707f, 0.778023422f},
-std::array<float,2>{0.553752184f, 0.762030184f},
-std::array<float,2>{0.252115726f, 0.192780808f},
-std::array<float,2>{0.863878787f, 0.320477992f},
-std::array<float,2>{0.0903598741f, 0.639621079f},
-std::array<float,2>{0.956565976f, 0.597420573f},
-std::array<float,2>{0.149833456f, 0.407466561f},
-std::array<float,2>{0.733336031f, 0.0745169371f},
-std::array<float,2>{0.437650263f, 0.918240428f},
-std::array<float,2>{0.807121217f, 0.999298334f},
-std::array<float,2>{0.0169927068f, 0.00468410552f},
-std::array<float,2>{0.618432581f, 0.489423156f},
-std::array<float,2>{0.332373202f, 0.508781493f},
-std::array<float,2>{0.648721874f, 0.698744893f},
-std::array<float,2>{0.430962235f, 0.253393114f},
-std::array<float,2>{0.909202695f, 0.184325144f},
-std::array<float,2>{0.202096269f, 0.81350857f},
-std::array<float,2>{0.697058678f, 0.903017879f},
-std::array<float,2>{0.477348f, 0.114442967f},
-std::array<float,2>{0.972901702f, 0.391926289f},
-std::array<float,2>{0.171859235f, 0.566366136f},
-std::array<float,2>{0.823496938f, 0.665853798f},
-std::array<float,2>{0.115162499f, 0.36042881f},
-std::array<float,2>{0.527531266f, 0.238200501f},
-std::array<float,2>{0.305665612f, 0.804780722f},
-std::array<float,2>{0.905734241f, 0.851878583f},
-std::array<float,2>{0.23096621f, 0.136556968f},
-std::array<float,2>{0.678812087f, 0.295406431f},
-std::array<float,2>{0.375409245f, 0.730844378f},
-std::array<float,2>{0.586899042f, 0.542354822f},
-std::array<float,2>{0.369527519f, 0.445872903f},
-std::array<float,2>{0.77922833f, 0.0394008867f},
-std::array<float,2>{0.0349521786f, 0.960981488f},
-std::array<float,2>{0.52231127f, 0.9064852f},
-std::array<float,2>{0.298185021f, 0.0666134804f},
-std::array<float,2>{0.818707526f, 0.419192731f},
-std::array<float,2>{0.120540507f, 0.60238117f},
-std::array<float,2>{0.97828418f, 0.626283407f},
-std::array<float,2>{0.158546865f, 0.317979485f},
-std::array<float,2>{0.687611639f, 0.199178264f},
-std::array<float,2>{0.473135829f, 0.756505668f},
-std::array<float,2>{0.771861255f, 0.822147489f},
-std::array<float,2>{0.0408052951f, 0.177271083f},
-std::array<float,2>{0.578924179f, 0.261056453f},
-std::array<float,2>{0.361167789f, 0.689267039f},
-std::array<float,2>{0.680622756f, 0.502784014f},
-std::array<float,2>{0.383789837f, 0.499223888f},
-std::array<float,2>{0.896804035f, 0.0131818876f},
-std::array<float,2>{0.22535345f, 0.990249157f},
-std::array<float,2>{0.724287689f, 0.803463221f},
-std::array<float,2>{0.451521605f, 0.244174853f},
-std::array<float,2>{0.965397596f, 0.369934887f},
-std::array<float,2>{0.144546941f, 0.663368523f},
-std::array<float,2>{0.871201158f, 0.57431829f},
-std::array<float,2>{0.0802450106f, 0.40602088f},
-std::array<float,2>{0.558577955f, 0.122494489f},
-std::array<float,2>{0.263696134f, 0.895876706f},
-std::array<float,2>{0.918304622f, 0.959014535f},
-std::array<float,2>{0.195041835f, 0.0351260006f},
-std::array<float,2>{0.64261961f, 0.438997537f},
-std::array<float,2>{0.422775596f, 0.53270793f},
-std::array<float,2>{0.61426574f, 0.719961643f},
-std::array<float,2>{0.341197312f, 0.286086261f},
-std::array<float,2>{0.802628994f, 0.125814706f},
-std::array<float,2>{0.0308706257f, 0.84663111f},
-std::array<float,2>{0.574502051f, 0.859779477f},
-std::array<float,2>{0.354771227f, 0.151792631f},
-std::array<float,2>{0.763952732f, 0.305716455f},
-std::array<float,2>{0.0573472977f, 0.749808192f},
-std::array<float,2>{0.884529114f, 0.556884646f},
-std::array<float,2>{0.235775203f, 0.458322316f},
-std::array<float,2>{0.661659598f, 0.0554980896f},
-std::array<float,2>{0.40507707f, 0.950781703f},
-std::array<float,2>{0.840871453f, 0.88986361f},
-std::array<float,2>{0.0966508016f, 0.0957434103f},
-std::array<float,2>{0.510353923f, 0.377860427f},
-std::array<float,2>{0.284697652f, 0.585776865f},
-std::array<float,2>{0.715065837f, 0.674449563f},
-std::array<float,2>{0.490598857f, 0.355371475f},
-std::array<float,2>{0.98801446f, 0.229546323f},
-std::array<float,2>{0.178146526f, 0.791261852f},
-std::array<float,2>{0.629348338f, 0.973970175f},
-std::array<float,2>{0.42028898f, 0.0306541268f},
-std::array<float,2>{0.931439221f, 0.484111816f},
-std::array<float,2>{0.213723287f, 0.529586732f},
-std::array<float,2>{0.78932476f, 0.717571855f},
-std::array<float,2>{0.000267892407f, 0.274942189f},
-std::array<float,2>{0.608454108f, 0.159903616f},
-std::array<float,2>{0.319713503f, 0.843664408f},
-std::array<float,2>{0.949099243f, 0.772579312f},
-std::array<float,2>{0.133221343f, 0.203671113f},
-std::array<float,2>{0.735475659f, 0.339339554f},
-std::array<float,2>{0.468501866f, 0.642354608f},
-std::array<float,2>{0.538130105f, 0.613987863f},
-std::array<float,2>{0.272240251f, 0.426931351f},
-std::array<float,2>{0.851066053f, 0.0896484032f},
-std::array<float,2>{0.0705672503f, 0.929387391f},
-std::array<float,2>{0.500059962f, 0.954389691f},
-std::array<float,2>{0.296090007f, 0.0390318111f},
-std::array<float,2>{0.833840668f, 0.444018006f},
-std::array<float,2>{0.102676138f, 0.538763165f},
-std::array<float,2>{0.997177422f, 0.722745478f},
-std::array<float,2>{0.183457717f, 0.28253004f},
-std::array<float,2>{0.709288239f, 0.131769136f},
-std::array<float,2>{0.498645633f, 0.850887716f},
-std::array<float,2>{0.757129192f, 0.798283398f},
-std::array<float,2>{0.052959308f, 0.249471456f},
-std::array<float,2>{0.568090558f, 0.372979939f},
-std::array<float,2>{0.343825161f, 0.657766044f},
-std::array<float,2>{0.670429289f, 0.571178973f},
-std::array<float,2>{0.394803494f, 0.399769604f},
-std::array<float,2>{0.879796565f, 0.118510574f},
-std::array<float,2>{0.248609796f, 0.891864002f},
-std::array<float,2>{0.749911129f, 0.824262559f},
-std::array<float,2>{0.457202226f, 0.174687445f},
-std::array<float,2>{0.940520108f, 0.26214245f},
-std::array<float,2>{0.132393479f, 0.692985356f},
-std::array<float,2>{0.853295445f, 0.506475866f},
-std::array<float,2>{0.0629957393f, 0.495541781f},
-std::array<float,2>{0.545655966f, 0.0106614204f},
-std::array<float,2>{0.277214825f, 0.986618519f},
-std::array<float,2>{0.925582826f, 0.913358986f},
-std::array<float,2>{0.206630319f, 0.0626685396f},
-std::array<float,2>{0.640222967f, 0.415908813f},
-std::array<float,2>{0.411932588f, 0.606250584f},
-std::array<float,2>{0.597895265f, 0.631297708f},
-std::array<float,2>{0.326104969f, 0.313385814f},
-std::array<float,2>{0.782194138f, 0.203079969f},
-std::array<float,2>{0.00857340451f, 0.75328964f},
-std::array<float,2>{0.590991974f, 0.767715752f},
-std::array<float,2>{0.371856064f, 0.208501101f},
-std::array<float,2>{0.774200976f, 0.341350287f},
-std::array<float,2>{0.0364352427f, 0.645256877f},
-std::array<float,2>{0.900544465f, 0.6130808f},
-std::array<float,2>{0.228050724f, 0.424412191f},
-std::array<float,2>{0.673109412f, 0.0911025628f},
-std::array<float,2>{0.381227404f, 0.924748003f},
-std::array<float,2>{0.825269818f, 0.969450772f},
-std::array<float,2>{0.111266047f, 0.0268336553f},
-std::array<float,2>{0.525055289f, 0.47849381f},
-std::array<float,2>{0.312129349f, 0.524821401f},
-std::array<float,2>{0.700214624f, 0.711180031f},
-std::array<float,2>{0.48259595f, 0.27869159f},
-std::array<float,2>{0.968895257f, 0.161922872f},
-std::array<float,2>{0.165613487f, 0.838913381f},
-std::array<float,2>{0.656064808f, 0.884609759f},
-std::array<float,2>{0.434087098f, 0.0989953279f},
-std::array<float,2>{0.910785735f, 0.381990641f},
-std::array<float,2>{0.196167082f, 0.580851197f},
-std::array<float,2>{0.811364472f, 0.678440809f},
-std::array<float,2>{0.0227641072f, 0.358040601f},
-std::array<float,2>{0.621305048f, 0.230631053f},
-std::array<float,2>{0.328502089f, 0.795598865f},
-std::array<float,2>{0.960437596f, 0.865358949f},
-std::array<float,2>{0.154748976f, 0.154721469f},
-std::array<float,2>{0.727022231f, 0.310047477f},
-std::array<float,2>{0.44158268f, 0.743687987f},
-std::array<float,2>{0.55037415f, 0.559866607f},
-std::array<float,2>{0.253987759f, 0.454218984f},
-std::array<float,2>{0.860019922f, 0.061515715f},
-std::array<float,2>{0.0875079632f, 0.948352516f},
-std::array<float,2>{0.609509945f, 0.936782539f},
-std::array<float,2>{0.338486671f, 0.08414042f},
-std::array<float,2>{0.799327314f, 0.432884425f},
-std::array<float,2>{0.0261100549f, 0.62348491f},
-std::array<float,2>{0.914870381f, 0.650075257f},
-std::array<float,2>{0.189448491f, 0.329221576f},
-std::array<float,2>{0.645481765f, 0.217620924f},
-std::array<float,2>{0.427233189f, 0.775134146f},
-std::array<float,2>{0.869018018f, 0.833189309f},
-std::array<float,2>{0.0834680796f, 0.16752398f},
-std::array<float,2>{0.559253156f, 0.269442797f},
-std::array<float,2>{0.260275185f, 0.707342446f},
-std::array<float,2>{0.721452415f, 0.518437326f},
-std::array<float,2>{0.448943585f, 0.474654913f},
-std::array<float,2>{0.962721527f, 0.0199330822f},
-std::array<float,2>{0.144345701f, 0.976671576f},
-std::array<float,2>{0.685013473f, 0.784822643f},
-std::array<float,2>{0.390566081f, 0.220225781f},
-std::array<float,2>{0.894278884f, 0.350386351f},
-std::array<float,2>{0.219496176f, 0.683411896f},
-std::array<float,2>{0.767596066f, 0.586111605f},
-std::array<float,2>{0.0465583391f, 0.385612041f},
-std::array<float,2>{0.583130121f, 0.106945708f},
-std::array<float,2>{0.365009874f, 0.882653892f},
-std::array<float,2>{0.981905103f, 0.944301188f},
-std::array<float,2>{0.162409529f, 0.0516293719f},
-std::array<float,2>{0.693028927f, 0.461549819f},
-std::array<float,2>{0.471814007f, 0.547982097f},
-std::array<float,2>{0.516079962f, 0.734954596f},
-std::array<float,2>{0.302668333f, 0.299689561f},
-std::array<float,2>{0.813928604f, 0.141538993f},
-std::array<float,2>{0.123882622f, 0.874536157f},
-std::array<float,2>{0.532030106f, 0.857307494f},
-std::array<float,2>{0.266217262f, 0.138780534f},
-std::array<float,2>{0.845686674f, 0.290572882f},
-std::array<float,2>{0.0763527602f, 0.730050564f},
-std::array<float,2>{0.950248778f, 0.543450594f},
-std::array<float,2>{0.138684303f, 0.450346708f},
-std::array<float,2>{0.73964709f, 0.0434329137f},
-std::array<float,2>{0.463167578f, 0.968499899f},
-std::array<float,2>{0.793106318f, 0.900144398f},
-std::array<float,2>{0.00614399463f, 0.110903062f},
-std::array<float,2>{0.604826391f, 0.397420704f},
-std::array<float,2>{0.31460923f, 0.567964673f},
-std::array<float,2>{0.628657222f, 0.671254039f},
-std::array<float,2>{0.415189028f, 0.364224732f},
-std::array<float,2>{0.935428739f, 0.241660342f},
-std::array<float,2>{0.218172401f, 0.810884714f},
-std::array<float,2>{0.713094652f, 0.993798614f},
-std::array<float,2>{0.48557809f, 0.00382093899f},
-std::array<float,2>{0.989524722f, 0.488090843f},
-std::array<float,2>{0.174218446f, 0.515294373f},
-std::array<float,2>{0.838204324f, 0.703111351f},
-std::array<float,2>{0.0997121111f, 0.255174607f},
-std::array<float,2>{0.514733076f, 0.180179819f},
-std::array<float,2>{0.287314832f, 0.816579044f},
-std::array<float,2>{0.890256882f, 0.76119101f},
-std::array<float,2>{0.239363879f, 0.188010886f},
-std::array<float,2>{0.657409608f, 0.327985793f},
-std::array<float,2>{0.400414258f, 0.633128226f},
-std::array<float,2>{0.57397455f, 0.599202573f},
-std::array<float,2>{0.355512828f, 0.411615461f},
-std::array<float,2>{0.758763492f, 0.0736577958f},
-std::array<float,2>{0.0608996637f, 0.916592658f},
-std::array<float,2>{0.566196144f, 0.980992794f},
-std::array<float,2>{0.35037601f, 0.0192621034f},
-std::array<float,2>{0.753083646f, 0.469370604f},
-std::array<float,2>{0.0477643311f, 0.522048771f},
-std::array<float,2>{0.877128899f, 0.70571202f},
-std::array<float,2>{0.244172186f, 0.272400379f},
-std::array<float,2>{0.667543173f, 0.167979717f},
-std::array<float,2>{0.393244743f, 0.829728603f},
-std::array<float,2>{0.830690563f, 0.779459298f},
-std::array<float,2>{0.107224986f, 0.212766737f},
-std::array<float,2>{0.504483104f, 0.333791137f},
-std::array<float,2>{0.28990078f, 0.653589725f},
-std::array<float,2>{0.705483079f, 0.6200158f},
-std::array<float,2>{0.4957003f, 0.435121298f},
-std::array<float,2>{0.994437754f, 0.0802216008f},
-std::array<float,2>{0.186485618f, 0.931598067f},
-std::array<float,2>{0.633205175f, 0.869110465f},
-std::array<float,2>{0.409384042f, 0.14568229f},
-std::array<float,2>{0.927541256f, 0.302140355f},
-std::array<float,2>{0.207815349f, 0.740276814f},
-std::array<float,2>{0.787790835f, 0.554433286f},
-std::array<float,2>{0.0139405914f, 0.466627508f},
-std::array<float,2>{0.596987486f, 0.047525119f},
-std::array<float,2>{0.321077198f, 0.938892305f},
-std::array<float,2>{0.941969573f, 0.87644738f},
-std::array<float,2>{0.128590107f, 0.103927396f},
-std::array<float,2>{0.743301868f, 0.386834204f},
-std::array<float,2>{0.455687463f, 0.590123594f},
-std::array<float,2>{0.539211333f, 0.687099755f},
-std::array<float,2>{0.279198527f, 0.345722735f},
-std::array<float,2>{0.85678035f, 0.223116025f},
-std::array<float,2>{0.0675946251f, 0.787552238f},
-std::array<float,2>{0.530754626f, 0.808307648f},
-std::array<float,2>{0.308497876f, 0.235773489f},
-std::array<float,2>{0.821643949f, 0.361669183f},
-std::array<float,2>{0.11649783f, 0.66796571f},
-std::array<float,2>{0.9751665f, 0.564286709f},
-std::array<float,2>{0.168654636f, 0.394258976f},
-std::array<float,2>{0.697441459f, 0.116580606f},
-std::array<float,2>{0.480282575f, 0.905129969f},
-std::array<float,2>{0.779419422f, 0.964729071f},
-std::array<float,2>{0.0328643732f, 0.0416701064f},
-std::array<float,2>{0.587952912f, 0.448381215f},
-std::array<float,2>{0.36889267f, 0.539078414f},
-std::array<float,2>{0.677367926f, 0.732931137f},
-std::array<float,2>{0.378457874f, 0.293277204f},
-std::array<float,2>{0.90288496f, 0.133643687f},
-std::array<float,2>{0.233664542f, 0.853712261f},
-std::array<float,2>{0.731154621f, 0.921168387f},
-std::array<float,2>{0.440100521f, 0.0772695318f},
-std::array<float,2>{0.953325868f, 0.408357203f},
-std::array<float,2>{0.151390702f, 0.595539033f},
-std::array<float,2>{0.866054356f, 0.63866961f},
-std::array<float,2>{0.092372559f, 0.323498636f},
-std::array<float,2>{0.55136925f, 0.193887129f},
-std::array<float,2>{0.250710309f, 0.764220715f},
-std::array<float,2>{0.907376885f, 0.815282822f},
-std::array<float,2>{0.201003134f, 0.185737938f},
-std::array<float,2>{0.65151757f, 0.250039071f},
-std::array<float,2>{0.432931095f, 0.696457803f},
-std::array<float,2>{0.619346261f, 0.510402739f},
-std::array<float,2>{0.334008008f, 0.491954058f},
-std::array<float,2>{0.806475878f, 0.00614888594f},
-std::array<float,2>{0.0190367084f, 0.997464418f},
-std::array<float,2>{0.556346416f, 0.896624088f},
-std::array<float,2>{0.263390094f, 0.124333695f},
-std::array<float,2>{0.873639464f, 0.403177917f},
-std::array<float,2>{0.079881072f, 0.576441944f},
-std::array<float,2>{0.966959596f, 0.661291838f},
-std::array<float,2>{0.148394823f, 0.368852735f},
-std::array<float,2>{0.725938201f, 0.2438104f},
-std::array<float,2>{0.451027006f, 0.802337289f},
-std::array<float,2>{0.802856326f, 0.845144629f},
-std::array<float,2>{0.027396217f, 0.12716186f},
-std::array<float,2>{0.615577221f, 0.288088709f},
-std::array<float,2>{0.342664152f, 0.722319901f},
-std::array<float,2>{0.641251564f, 0.533454835f},
-std::array<float,2>{0.425476551f, 0.441017419f},
-std::array<float,2>{0.921496987f, 0.0325906649f},
-std::array<float,2>{0.192776814f, 0.957172036f},
-std::array<float,2>{0.690573215f, 0.755019009f},
-std::array<float,2>{0.474914074f, 0.196276262f},
-std::array<float,2>{0.980331123f, 0.319419503f},
-std::array<float,2>{0.157627106f, 0.628102839f},
-std::array<float,2>{0.817093372f, 0.604377031f},
-std::array<float,2>{0.118622653f, 0.420899004f},
-std::array<float,2>{0.519910216f, 0.0686823651f},
-std::array<float,2>{0.299775809f, 0.909510314f},
-std::array<float,2>{0.895750046f, 0.990147531f},
-std::array<float,2>{0.223101586f, 0.0138411187f},
-std::array<float,2>{0.682055593f, 0.497066945f},
-std::array<float,2>{0.384900808f, 0.501517773f},
-std::array<float,2>{0.580185115f, 0.69048655f},
-std::array<float,2>{0.362181395f, 0.258920044f},
-std::array<float,2>{0.770381212f, 0.177988902f},
-std::array<float,2>{0.0411301628f, 0.823119283f},
-std::array<float,2>{0.606227696f, 0.84093684f},
-std::array<float,2>{0.316995382f, 0.158054456f},
-std::array<float,2>{0.791676939f, 0.276618719f},
-std::array<float,2>{0.00362638989f, 0.715158284f},
-std::array<float,2>{0.932696939f, 0.528535664f},
-std::array<float,2>{0.211520329f, 0.481246471f},
-std::array<float,2>{0.630989432f, 0.0290202517f},
-std::array<float,2>{0.418046445f, 0.976245582f},
-std::array<float,2>{0.849563837f, 0.926498115f},
-std::array<float,2>{0.0725077689f, 0.0874575675f},
-std::array<float,2>{0.536641419f, 0.428150505f},
-std::array<float,2>{0.269790888f, 0.616558611f},
-std::array<float,2>{0.736741602f, 0.643188119f},
-std::array<float,2>{0.465111434f, 0.33759135f},
-std::array<float,2>{0.945817053f, 0.206963435f},
-std::array<float,2>{0.135707095f, 0.770376384f},
-std::array<float,2>{0.663781941f, 0.952042043f},
-std::array<float,2>{0.402911693f, 0.0582746714f},
-std::array<float,2>{0.886421382f, 0.459768087f},
-std::array<float,2>{0.236710295f, 0.555287182f},
-std::array<float,2>{0.76300317f, 0.746698558f},
-std::array<float,2>{0.0552569926f, 0.308527678f},
-std::array<float,2>{0.576974154f, 0.150250107f},
-std::array<float,2>{0.35171032f, 0.86188817f},
-std::array<float,2>{0.986260653f, 0.790354729f},
-std::array<float,2>{0.177165642f, 0.226745605f},
-std::array<float,2>{0.718221724f, 0.352354884f},
-std::array<float,2>{0.488691628f, 0.673095047f},
-std::array<float,2>{0.508458138f, 0.583789885f},
-std::array<float,2>{0.282571316f, 0.375893682f},
-std::array<float,2>{0.843555033f, 0.0946502686f},
-std::array<float,2>{0.0952964276f, 0.88817054f}}
\ No newline at end of file
@@ -1,4096 +0,0 @@
-{std::array<float,2>{0.744067013f, 0.729886234f},
-std::array<float,2>{0.278545439f, 0.476247281f},
-std::array<float,2>{0.765862107f, 0.00710047316f},
-std::array<float,2>{0.144426003f, 0.962268889f},
-std::array<float,2>{0.998783469f, 0.811946929f},
-std::array<float,2>{0.0602892563f, 0.173075482f},
-std::array<float,2>{0.58114326f, 0.252237469f},
-std::array<float,2>{0.380748779f, 0.593691409f},
-std::array<float,2>{0.845776618f, 0.52806437f},
-std::array<float,2>{0.225274578f, 0.334217787f},
-std::array<float,2>{0.632852554f, 0.241493955f},
-std::array<float,2>{0.354561418f, 0.869097114f},
-std::array<float,2>{0.546488404f, 0.912840307f},
-std::array<float,2>{0.491406888f, 0.0670957193f},
-std::array<float,2>{0.937080264f, 0.424876362f},
-std::array<float,2>{0.0834325925f, 0.629260302f},
-std::array<float,2>{0.597344398f, 0.601268411f},
-std::array<float,2>{0.428435147f, 0.300282747f},
-std::array<float,2>{0.939287186f, 0.155823082f},
-std::array<float,2>{0.0131883333f, 0.754265189f},
-std::array<float,2>{0.793320596f, 0.96907115f},
-std::array<float,2>{0.156722754f, 0.0446306542f},
-std::array<float,2>{0.708819449f, 0.462099969f},
-std::array<float,2>{0.305938154f, 0.703487813f},
-std::array<float,2>{0.904928029f, 0.668630481f},
-std::array<float,2>{0.103441358f, 0.378807604f},
-std::array<float,2>{0.525674701f, 0.0946526155f},
-std::array<float,2>{0.437897831f, 0.891294181f},
-std::array<float,2>{0.666292131f, 0.822027028f},
-std::array<float,2>{0.341106087f, 0.192516625f},
-std::array<float,2>{0.839420021f, 0.357560277f},
-std::array<float,2>{0.19502762f, 0.558869243f},
-std::array<float,2>{0.653917253f, 0.532763064f},
-std::array<float,2>{0.360470206f, 0.371367991f},
-std::array<float,2>{0.87009269f, 0.213492155f},
-std::array<float,2>{0.234577253f, 0.836596727f},
-std::array<float,2>{0.90876174f, 0.879749775f},
-std::array<float,2>{0.06865675f, 0.119361155f},
-std::array<float,2>{0.560325801f, 0.395789921f},
-std::array<float,2>{0.480450422f, 0.672680557f},
-std::array<float,2>{0.75971359f, 0.694192648f},
-std::array<float,2>{0.128251761f, 0.437637985f},
-std::array<float,2>{0.7330302f, 0.0614375174f},
-std::array<float,2>{0.256679893f, 0.995218873f},
-std::array<float,2>{0.568533242f, 0.767198026f},
-std::array<float,2>{0.395737767f, 0.137543365f},
-std::array<float,2>{0.977363527f, 0.286178857f},
-std::array<float,2>{0.046695035f, 0.621943235f},
-std::array<float,2>{0.515175283f, 0.65280211f},
-std::array<float,2>{0.464686215f, 0.420563519f},
-std::array<float,2>{0.881121039f, 0.0873820335f},
-std::array<float,2>{0.122416914f, 0.926119387f},
-std::array<float,2>{0.823103905f, 0.848272562f},
-std::array<float,2>{0.209751129f, 0.232803151f},
-std::array<float,2>{0.671990097f, 0.317176431f},
-std::array<float,2>{0.326568276f, 0.509239852f},
-std::array<float,2>{0.961830497f, 0.574575961f},
-std::array<float,2>{0.0278121699f, 0.269373924f},
-std::array<float,2>{0.616885841f, 0.170140579f},
-std::array<float,2>{0.417999774f, 0.782681704f},
-std::array<float,2>{0.70122844f, 0.946971714f},
-std::array<float,2>{0.284148753f, 0.0232958198f},
-std::array<float,2>{0.797614336f, 0.489965767f},
-std::array<float,2>{0.179909974f, 0.738062203f},
-std::array<float,2>{0.681792676f, 0.686514437f},
-std::array<float,2>{0.314582318f, 0.402854681f},
-std::array<float,2>{0.819108605f, 0.113292836f},
-std::array<float,2>{0.217203617f, 0.884120166f},
-std::array<float,2>{0.88405627f, 0.82885915f},
-std::array<float,2>{0.116910465f, 0.210130259f},
-std::array<float,2>{0.505324066f, 0.360538304f},
-std::array<float,2>{0.454006493f, 0.546074092f},
-std::array<float,2>{0.80569768f, 0.611177504f},
-std::array<float,2>{0.172917143f, 0.294021428f},
-std::array<float,2>{0.690603197f, 0.125909269f},
-std::array<float,2>{0.296664596f, 0.776099324f},
-std::array<float,2>{0.623574972f, 0.985801697f},
-std::array<float,2>{0.412757695f, 0.0505049266f},
-std::array<float,2>{0.959043741f, 0.451983482f},
-std::array<float,2>{0.0202459302f, 0.702113092f},
-std::array<float,2>{0.552271545f, 0.506829202f},
-std::array<float,2>{0.474129677f, 0.322269976f},
-std::array<float,2>{0.919164777f, 0.221033886f},
-std::array<float,2>{0.071856536f, 0.853605032f},
-std::array<float,2>{0.864002407f, 0.934374213f},
-std::array<float,2>{0.242724657f, 0.0806068406f},
-std::array<float,2>{0.646019816f, 0.408136398f},
-std::array<float,2>{0.369486511f, 0.644628823f},
-std::array<float,2>{0.970379651f, 0.745858908f},
-std::array<float,2>{0.0361305065f, 0.496286541f},
-std::array<float,2>{0.571957171f, 0.0249118544f},
-std::array<float,2>{0.400208145f, 0.942067385f},
-std::array<float,2>{0.723896265f, 0.795502245f},
-std::array<float,2>{0.263755977f, 0.163910583f},
-std::array<float,2>{0.757739782f, 0.2766729f},
-std::array<float,2>{0.137158528f, 0.567035258f},
-std::array<float,2>{0.716094792f, 0.578432024f},
-std::array<float,2>{0.304582089f, 0.261232376f},
-std::array<float,2>{0.788301885f, 0.18541804f},
-std::array<float,2>{0.169574797f, 0.801750183f},
-std::array<float,2>{0.946244836f, 0.960753143f},
-std::array<float,2>{0.00722430181f, 0.0112999147f},
-std::array<float,2>{0.603241026f, 0.484022796f},
-std::array<float,2>{0.433412284f, 0.725176811f},
-std::array<float,2>{0.830039322f, 0.637699485f},
-std::array<float,2>{0.198212594f, 0.431650251f},
-std::array<float,2>{0.65735209f, 0.0773843974f},
-std::array<float,2>{0.332563192f, 0.917087197f},
-std::array<float,2>{0.518321633f, 0.864779115f},
-std::array<float,2>{0.445985734f, 0.249746919f},
-std::array<float,2>{0.897179544f, 0.339364648f},
-std::array<float,2>{0.0956410617f, 0.519803107f},
-std::array<float,2>{0.589918733f, 0.718325913f},
-std::array<float,2>{0.384249479f, 0.454472899f},
-std::array<float,2>{0.990891516f, 0.0390042923f},
-std::array<float,2>{0.0477248542f, 0.977900028f},
-std::array<float,2>{0.777991354f, 0.760905862f},
-std::array<float,2>{0.153732195f, 0.143209696f},
-std::array<float,2>{0.741519511f, 0.306031615f},
-std::array<float,2>{0.271784157f, 0.601569057f},
-std::array<float,2>{0.923362672f, 0.550958097f},
-std::array<float,2>{0.0887813941f, 0.350915611f},
-std::array<float,2>{0.53224808f, 0.198178589f},
-std::array<float,2>{0.493629575f, 0.818477213f},
-std::array<float,2>{0.628182411f, 0.904702365f},
-std::array<float,2>{0.344731033f, 0.105080068f},
-std::array<float,2>{0.855536759f, 0.389162332f},
-std::array<float,2>{0.230566308f, 0.662474275f},
-std::array<float,2>{0.637565255f, 0.695380449f},
-std::array<float,2>{0.358076543f, 0.446956396f},
-std::array<float,2>{0.850821495f, 0.0531966425f},
-std::array<float,2>{0.219954982f, 0.989914119f},
-std::array<float,2>{0.930246294f, 0.779069364f},
-std::array<float,2>{0.0793565884f, 0.129987538f},
-std::array<float,2>{0.542553604f, 0.291830301f},
-std::array<float,2>{0.487252206f, 0.614395261f},
-std::array<float,2>{0.771131814f, 0.541244805f},
-std::array<float,2>{0.146039993f, 0.363461375f},
-std::array<float,2>{0.748870075f, 0.205748677f},
-std::array<float,2>{0.274500132f, 0.832104325f},
-std::array<float,2>{0.582354784f, 0.887400389f},
-std::array<float,2>{0.37506476f, 0.109541245f},
-std::array<float,2>{0.994356155f, 0.401819408f},
-std::array<float,2>{0.0582550056f, 0.682166696f},
-std::array<float,2>{0.528266668f, 0.565551043f},
-std::array<float,2>{0.443009555f, 0.279969633f},
-std::array<float,2>{0.900619268f, 0.159471199f},
-std::array<float,2>{0.108899191f, 0.790742815f},
-std::array<float,2>{0.84357506f, 0.938109934f},
-std::array<float,2>{0.188677832f, 0.0289836135f},
-std::array<float,2>{0.669414163f, 0.493055016f},
-std::array<float,2>{0.336945385f, 0.746353507f},
-std::array<float,2>{0.942835808f, 0.64384228f},
-std::array<float,2>{0.0112131638f, 0.411840349f},
-std::array<float,2>{0.601491153f, 0.0823409557f},
-std::array<float,2>{0.424355865f, 0.9311589f},
-std::array<float,2>{0.704605103f, 0.859036803f},
-std::array<float,2>{0.312112123f, 0.22493349f},
-std::array<float,2>{0.79059875f, 0.325529605f},
-std::array<float,2>{0.161669225f, 0.501779914f},
-std::array<float,2>{0.728687704f, 0.518830895f},
-std::array<float,2>{0.250926435f, 0.339945316f},
-std::array<float,2>{0.762305081f, 0.242817521f},
-std::array<float,2>{0.129252404f, 0.861943007f},
-std::array<float,2>{0.983387053f, 0.918582022f},
-std::array<float,2>{0.0392616987f, 0.0741775855f},
-std::array<float,2>{0.565648258f, 0.434460551f},
-std::array<float,2>{0.391334772f, 0.63581121f},
-std::array<float,2>{0.872940719f, 0.722613692f},
-std::array<float,2>{0.240586177f, 0.479626089f},
-std::array<float,2>{0.649483919f, 0.0129698254f},
-std::array<float,2>{0.363441408f, 0.955012679f},
-std::array<float,2>{0.556046903f, 0.797730386f},
-std::array<float,2>{0.481107086f, 0.181405008f},
-std::array<float,2>{0.911692619f, 0.263000101f},
-std::array<float,2>{0.0631657615f, 0.583399236f},
-std::array<float,2>{0.610981047f, 0.657395005f},
-std::array<float,2>{0.416258514f, 0.385731876f},
-std::array<float,2>{0.965696871f, 0.105680928f},
-std::array<float,2>{0.0253227726f, 0.901242495f},
-std::array<float,2>{0.801496267f, 0.814560413f},
-std::array<float,2>{0.186027423f, 0.201025099f},
-std::array<float,2>{0.698970973f, 0.345150024f},
-std::array<float,2>{0.286596447f, 0.547340155f},
-std::array<float,2>{0.878748715f, 0.606945574f},
-std::array<float,2>{0.117574424f, 0.309877336f},
-std::array<float,2>{0.508277178f, 0.146634832f},
-std::array<float,2>{0.468534052f, 0.762896955f},
-std::array<float,2>{0.676912665f, 0.981973469f},
-std::array<float,2>{0.323269516f, 0.0315336548f},
-std::array<float,2>{0.824821532f, 0.458209276f},
-std::array<float,2>{0.204321861f, 0.71236366f},
-std::array<float,2>{0.694858432f, 0.625847697f},
-std::array<float,2>{0.29115653f, 0.426555157f},
-std::array<float,2>{0.811033487f, 0.0636307299f},
-std::array<float,2>{0.178877071f, 0.907083988f},
-std::array<float,2>{0.954408288f, 0.873557985f},
-std::array<float,2>{0.0165623762f, 0.237915963f},
-std::array<float,2>{0.61919868f, 0.33111909f},
-std::array<float,2>{0.408109128f, 0.526465833f},
-std::array<float,2>{0.814054787f, 0.586847067f},
-std::array<float,2>{0.212564543f, 0.257112682f},
-std::array<float,2>{0.686873853f, 0.177137494f},
-std::array<float,2>{0.31887126f, 0.808520973f},
-std::array<float,2>{0.50093925f, 0.968038619f},
-std::array<float,2>{0.460154742f, 0.000971330213f},
-std::array<float,2>{0.887772202f, 0.470797032f},
-std::array<float,2>{0.110973775f, 0.733469129f},
-std::array<float,2>{0.574872255f, 0.557227492f},
-std::array<float,2>{0.403585047f, 0.35476023f},
-std::array<float,2>{0.974164069f, 0.188344121f},
-std::array<float,2>{0.0332504734f, 0.82588917f},
-std::array<float,2>{0.752402961f, 0.897749424f},
-std::array<float,2>{0.134790808f, 0.099441573f},
-std::array<float,2>{0.719841182f, 0.381991416f},
-std::array<float,2>{0.261116534f, 0.665210485f},
-std::array<float,2>{0.915607393f, 0.708040774f},
-std::array<float,2>{0.0752580538f, 0.468677789f},
-std::array<float,2>{0.547398508f, 0.0427183211f},
-std::array<float,2>{0.471833557f, 0.974226177f},
-std::array<float,2>{0.641914785f, 0.751588821f},
-std::array<float,2>{0.371961057f, 0.148958147f},
-std::array<float,2>{0.863101482f, 0.301148474f},
-std::array<float,2>{0.248942137f, 0.594239891f},
-std::array<float,2>{0.662404358f, 0.618475258f},
-std::array<float,2>{0.329895645f, 0.284869701f},
-std::array<float,2>{0.835783184f, 0.134426415f},
-std::array<float,2>{0.20167464f, 0.770174205f},
-std::array<float,2>{0.890806496f, 0.99913615f},
-std::array<float,2>{0.0982884169f, 0.0576681755f},
-std::array<float,2>{0.522590518f, 0.442095429f},
-std::array<float,2>{0.450033963f, 0.687722325f},
-std::array<float,2>{0.782501221f, 0.679025531f},
-std::array<float,2>{0.16779609f, 0.393739283f},
-std::array<float,2>{0.713872254f, 0.122154929f},
-std::array<float,2>{0.299762189f, 0.875469863f},
-std::array<float,2>{0.60750252f, 0.84290725f},
-std::array<float,2>{0.436417907f, 0.215743288f},
-std::array<float,2>{0.952343345f, 0.367265224f},
-std::array<float,2>{0.00221339404f, 0.536732197f},
-std::array<float,2>{0.537087798f, 0.74157238f},
-std::array<float,2>{0.497548133f, 0.485243142f},
-std::array<float,2>{0.927843511f, 0.0180047099f},
-std::array<float,2>{0.0919636041f, 0.94956708f},
-std::array<float,2>{0.852309167f, 0.788266242f},
-std::array<float,2>{0.229903623f, 0.167533681f},
-std::array<float,2>{0.630524933f, 0.271943569f},
-std::array<float,2>{0.349874526f, 0.570637703f},
-std::array<float,2>{0.986785829f, 0.514806926f},
-std::array<float,2>{0.0523225255f, 0.313431621f},
-std::array<float,2>{0.586292028f, 0.230343893f},
-std::array<float,2>{0.390384197f, 0.843977749f},
-std::array<float,2>{0.736838281f, 0.922718465f},
-std::array<float,2>{0.269291043f, 0.0936228931f},
-std::array<float,2>{0.774542987f, 0.417541981f},
-std::array<float,2>{0.152285948f, 0.6510759f},
-std::array<float,2>{0.710029006f, 0.706916988f},
-std::array<float,2>{0.30802387f, 0.463984042f},
-std::array<float,2>{0.796332419f, 0.0467697494f},
-std::array<float,2>{0.160089642f, 0.9710958f},
-std::array<float,2>{0.940207303f, 0.756560564f},
-std::array<float,2>{0.0149101298f, 0.152795389f},
-std::array<float,2>{0.595680833f, 0.297757864f},
-std::array<float,2>{0.426920325f, 0.599072039f},
-std::array<float,2>{0.836757362f, 0.561938405f},
-std::array<float,2>{0.19227089f, 0.355815262f},
-std::array<float,2>{0.66491133f, 0.194435894f},
-std::array<float,2>{0.342054427f, 0.822394371f},
-std::array<float,2>{0.524611712f, 0.892984867f},
-std::array<float,2>{0.44084546f, 0.0969029218f},
-std::array<float,2>{0.902829409f, 0.375918686f},
-std::array<float,2>{0.104140572f, 0.66992414f},
-std::array<float,2>{0.579785049f, 0.591270387f},
-std::array<float,2>{0.381135076f, 0.251048714f},
-std::array<float,2>{0.996095896f, 0.174228042f},
-std::array<float,2>{0.0608770847f, 0.810323298f},
-std::array<float,2>{0.768747568f, 0.963712931f},
-std::array<float,2>{0.141748592f, 0.00490011275f},
-std::array<float,2>{0.746079445f, 0.472851783f},
-std::array<float,2>{0.279929698f, 0.726778984f},
-std::array<float,2>{0.933819354f, 0.631385863f},
-std::array<float,2>{0.0842614546f, 0.422337919f},
-std::array<float,2>{0.544320822f, 0.0685709491f},
-std::array<float,2>{0.488976181f, 0.910532594f},
-std::array<float,2>{0.636090636f, 0.870838284f},
-std::array<float,2>{0.352085561f, 0.239996567f},
-std::array<float,2>{0.843830228f, 0.333797872f},
-std::array<float,2>{0.223986045f, 0.530063629f},
-std::array<float,2>{0.674597979f, 0.51058048f},
-std::array<float,2>{0.324252099f, 0.318797588f},
-std::array<float,2>{0.820435464f, 0.231816337f},
-std::array<float,2>{0.208029553f, 0.851330817f},
-std::array<float,2>{0.879800797f, 0.929605305f},
-std::array<float,2>{0.12391381f, 0.0885205343f},
-std::array<float,2>{0.512736082f, 0.418563366f},
-std::array<float,2>{0.462400734f, 0.656008661f},
-std::array<float,2>{0.799614668f, 0.735510945f},
-std::array<float,2>{0.183573335f, 0.49084425f},
-std::array<float,2>{0.700981259f, 0.0195905864f},
-std::array<float,2>{0.281766444f, 0.948301256f},
-std::array<float,2>{0.614563882f, 0.785148561f},
-std::array<float,2>{0.419973016f, 0.169045627f},
-std::array<float,2>{0.96290946f, 0.266959012f},
-std::array<float,2>{0.0306902248f, 0.576954544f},
-std::array<float,2>{0.561480343f, 0.673876107f},
-std::array<float,2>{0.47848621f, 0.398054898f},
-std::array<float,2>{0.907097518f, 0.117203824f},
-std::array<float,2>{0.0674731135f, 0.882355452f},
-std::array<float,2>{0.867841363f, 0.839349747f},
-std::array<float,2>{0.237834275f, 0.212422669f},
-std::array<float,2>{0.654659986f, 0.373239249f},
-std::array<float,2>{0.361742854f, 0.533951998f},
-std::array<float,2>{0.979449749f, 0.624664009f},
-std::array<float,2>{0.0441415869f, 0.287337333f},
-std::array<float,2>{0.568215907f, 0.139192775f},
-std::array<float,2>{0.396648884f, 0.768102109f},
-std::array<float,2>{0.730924785f, 0.99371624f},
-std::array<float,2>{0.255463004f, 0.0593738146f},
-std::array<float,2>{0.761105299f, 0.439691901f},
-std::array<float,2>{0.126433641f, 0.691589534f},
-std::array<float,2>{0.64750874f, 0.647227764f},
-std::array<float,2>{0.36723569f, 0.408612698f},
-std::array<float,2>{0.865578532f, 0.0793398991f},
-std::array<float,2>{0.244891912f, 0.936400294f},
-std::array<float,2>{0.920386195f, 0.851830602f},
-std::array<float,2>{0.0734335408f, 0.220113963f},
-std::array<float,2>{0.553490877f, 0.321415633f},
-std::array<float,2>{0.475852817f, 0.505125344f},
-std::array<float,2>{0.754961848f, 0.56923908f},
-std::array<float,2>{0.140451148f, 0.275383055f},
-std::array<float,2>{0.725031197f, 0.160925701f},
-std::array<float,2>{0.263261259f, 0.79435581f},
-std::array<float,2>{0.573874772f, 0.944478452f},
-std::array<float,2>{0.401172876f, 0.0257952809f},
-std::array<float,2>{0.972515702f, 0.4994874f},
-std::array<float,2>{0.039016176f, 0.743976712f},
-std::array<float,2>{0.5066275f, 0.544897139f},
-std::array<float,2>{0.455150932f, 0.36185059f},
-std::array<float,2>{0.884932399f, 0.207082078f},
-std::array<float,2>{0.114465624f, 0.83081007f},
-std::array<float,2>{0.818351746f, 0.886438012f},
-std::array<float,2>{0.216755226f, 0.116639026f},
-std::array<float,2>{0.68043679f, 0.40498203f},
-std::array<float,2>{0.314213902f, 0.683977902f},
-std::array<float,2>{0.957899809f, 0.700511217f},
-std::array<float,2>{0.0232366379f, 0.449656814f},
-std::array<float,2>{0.622549236f, 0.0470359325f},
-std::array<float,2>{0.411483437f, 0.98720628f},
-std::array<float,2>{0.688886642f, 0.774273038f},
-std::array<float,2>{0.294415057f, 0.128772631f},
-std::array<float,2>{0.808420002f, 0.295549929f},
-std::array<float,2>{0.174006656f, 0.612702012f},
-std::array<float,2>{0.739552081f, 0.604164362f},
-std::array<float,2>{0.271003485f, 0.306930393f},
-std::array<float,2>{0.780628622f, 0.142282307f},
-std::array<float,2>{0.155581102f, 0.758227646f},
-std::array<float,2>{0.989460886f, 0.979852676f},
-std::array<float,2>{0.050453566f, 0.0360439047f},
-std::array<float,2>{0.592974663f, 0.456202596f},
-std::array<float,2>{0.386584878f, 0.714968681f},
-std::array<float,2>{0.857992649f, 0.661950946f},
-std::array<float,2>{0.23382692f, 0.387821466f},
-std::array<float,2>{0.625522971f, 0.102600202f},
-std::array<float,2>{0.346469402f, 0.902725637f},
-std::array<float,2>{0.533911288f, 0.816829503f},
-std::array<float,2>{0.494550467f, 0.196708769f},
-std::array<float,2>{0.924541414f, 0.349189878f},
-std::array<float,2>{0.08618588f, 0.553024411f},
-std::array<float,2>{0.604733586f, 0.723840535f},
-std::array<float,2>{0.43030414f, 0.481172055f},
-std::array<float,2>{0.948477507f, 0.00822835974f},
-std::array<float,2>{0.00493054371f, 0.958139896f},
-std::array<float,2>{0.785297573f, 0.803029418f},
-std::array<float,2>{0.171455324f, 0.187064484f},
-std::array<float,2>{0.718702912f, 0.258137554f},
-std::array<float,2>{0.302720398f, 0.580674469f},
-std::array<float,2>{0.89635098f, 0.523224294f},
-std::array<float,2>{0.0965712443f, 0.337518305f},
-std::array<float,2>{0.515916646f, 0.246456429f},
-std::array<float,2>{0.447917163f, 0.866242409f},
-std::array<float,2>{0.659470499f, 0.915304124f},
-std::array<float,2>{0.335354477f, 0.0757201388f},
-std::array<float,2>{0.831409574f, 0.430952936f},
-std::array<float,2>{0.196956411f, 0.639766574f},
-std::array<float,2>{0.670554399f, 0.749711514f},
-std::array<float,2>{0.338015229f, 0.495666891f},
-std::array<float,2>{0.840519905f, 0.029569054f},
-std::array<float,2>{0.190330505f, 0.940590382f},
-std::array<float,2>{0.900020719f, 0.791850686f},
-std::array<float,2>{0.106317975f, 0.157977238f},
-std::array<float,2>{0.529787421f, 0.277568698f},
-std::array<float,2>{0.444420993f, 0.5641554f},
-std::array<float,2>{0.792693377f, 0.503644466f},
-std::array<float,2>{0.163015634f, 0.327301562f},
-std::array<float,2>{0.706802309f, 0.224373505f},
-std::array<float,2>{0.310481727f, 0.855485797f},
-std::array<float,2>{0.599345446f, 0.933120072f},
-std::array<float,2>{0.422396511f, 0.085310556f},
-std::array<float,2>{0.943970501f, 0.41386795f},
-std::array<float,2>{0.00810040161f, 0.641743004f},
-std::array<float,2>{0.539995968f, 0.61704576f},
-std::array<float,2>{0.484431297f, 0.290326297f},
-std::array<float,2>{0.933554351f, 0.132559121f},
-std::array<float,2>{0.0800922513f, 0.779309392f},
-std::array<float,2>{0.848370254f, 0.991891682f},
-std::array<float,2>{0.221120507f, 0.0524486639f},
-std::array<float,2>{0.639574468f, 0.447368175f},
-std::array<float,2>{0.356738657f, 0.698330581f},
-std::array<float,2>{0.993478358f, 0.680374682f},
-std::array<float,2>{0.0552374907f, 0.400093764f},
-std::array<float,2>{0.584206581f, 0.112095974f},
-std::array<float,2>{0.377302885f, 0.890186846f},
-std::array<float,2>{0.746973276f, 0.833987355f},
-std::array<float,2>{0.276937455f, 0.204764143f},
-std::array<float,2>{0.773261249f, 0.367090672f},
-std::array<float,2>{0.146723732f, 0.539465189f},
-std::array<float,2>{0.695506632f, 0.5500471f},
-std::array<float,2>{0.28905353f, 0.346033961f},
-std::array<float,2>{0.804390252f, 0.203089297f},
-std::array<float,2>{0.185042158f, 0.813139558f},
-std::array<float,2>{0.967912912f, 0.898970842f},
-std::array<float,2>{0.0272777881f, 0.108250767f},
-std::array<float,2>{0.612504184f, 0.382816941f},
-std::array<float,2>{0.415657163f, 0.659208357f},
-std::array<float,2>{0.827008724f, 0.714568436f},
-std::array<float,2>{0.205451548f, 0.459511787f},
-std::array<float,2>{0.67781502f, 0.0332323611f},
-std::array<float,2>{0.321180612f, 0.98258388f},
-std::array<float,2>{0.511374891f, 0.764167666f},
-std::array<float,2>{0.4657754f, 0.145039737f},
-std::array<float,2>{0.876118302f, 0.31060645f},
-std::array<float,2>{0.120611407f, 0.608854771f},
-std::array<float,2>{0.563497663f, 0.634536862f},
-std::array<float,2>{0.392664492f, 0.435683072f},
-std::array<float,2>{0.981454074f, 0.0703280866f},
-std::array<float,2>{0.0418008007f, 0.921164751f},
-std::array<float,2>{0.76435411f, 0.861250103f},
-std::array<float,2>{0.132357106f, 0.244207382f},
-std::array<float,2>{0.728051305f, 0.342140347f},
-std::array<float,2>{0.253096819f, 0.515937269f},
-std::array<float,2>{0.912189841f, 0.584891915f},
-std::array<float,2>{0.0644878149f, 0.264119804f},
-std::array<float,2>{0.558417261f, 0.183316499f},
-std::array<float,2>{0.484069586f, 0.800186396f},
-std::array<float,2>{0.650991559f, 0.955710351f},
-std::array<float,2>{0.366004258f, 0.0150699941f},
-std::array<float,2>{0.87332356f, 0.477780432f},
-std::array<float,2>{0.23996599f, 0.720025539f},
-std::array<float,2>{0.72177124f, 0.667522728f},
-std::array<float,2>{0.258468807f, 0.380730838f},
-std::array<float,2>{0.750504196f, 0.100856051f},
-std::array<float,2>{0.133126497f, 0.895906627f},
-std::array<float,2>{0.974863052f, 0.827555239f},
-std::array<float,2>{0.0325525999f, 0.190919012f},
-std::array<float,2>{0.578090429f, 0.352636337f},
-std::array<float,2>{0.406190693f, 0.556232393f},
-std::array<float,2>{0.860330284f, 0.596668601f},
-std::array<float,2>{0.247592151f, 0.303842217f},
-std::array<float,2>{0.643001199f, 0.152320817f},
-std::array<float,2>{0.373792678f, 0.752976537f},
-std::array<float,2>{0.550108492f, 0.976100206f},
-std::array<float,2>{0.469170749f, 0.0391045734f},
-std::array<float,2>{0.916863382f, 0.465487182f},
-std::array<float,2>{0.0765680373f, 0.709568202f},
-std::array<float,2>{0.617492616f, 0.523547649f},
-std::array<float,2>{0.409219503f, 0.329200536f},
-std::array<float,2>{0.956905901f, 0.235444978f},
-std::array<float,2>{0.01823668f, 0.871738374f},
-std::array<float,2>{0.809717f, 0.90831846f},
-std::array<float,2>{0.175841674f, 0.0651490018f},
-std::array<float,2>{0.691729665f, 0.429288656f},
-std::array<float,2>{0.289107412f, 0.627661884f},
-std::array<float,2>{0.890111864f, 0.730848432f},
-std::array<float,2>{0.112183519f, 0.470283687f},
-std::array<float,2>{0.503746033f, 0.00263096741f},
-std::array<float,2>{0.458878726f, 0.965410233f},
-std::array<float,2>{0.685009003f, 0.806006134f},
-std::array<float,2>{0.317626804f, 0.179137483f},
-std::array<float,2>{0.816095412f, 0.255774319f},
-std::array<float,2>{0.21290262f, 0.589471221f},
-std::array<float,2>{0.631968141f, 0.572715044f},
-std::array<float,2>{0.348965973f, 0.270386249f},
-std::array<float,2>{0.853802621f, 0.16424498f},
-std::array<float,2>{0.227837652f, 0.785781622f},
-std::array<float,2>{0.926876962f, 0.951513112f},
-std::array<float,2>{0.0912844986f, 0.0171564836f},
-std::array<float,2>{0.538244486f, 0.48655498f},
-std::array<float,2>{0.498070568f, 0.73991251f},
-std::array<float,2>{0.775729597f, 0.649929523f},
-std::array<float,2>{0.149945617f, 0.415426433f},
-std::array<float,2>{0.735067666f, 0.090411365f},
-std::array<float,2>{0.266145796f, 0.925540328f},
-std::array<float,2>{0.588315964f, 0.846009195f},
-std::array<float,2>{0.387924224f, 0.226619482f},
-std::array<float,2>{0.985398471f, 0.315142065f},
-std::array<float,2>{0.0534118973f, 0.513087392f},
-std::array<float,2>{0.52140677f, 0.690205097f},
-std::array<float,2>{0.452952564f, 0.445041656f},
-std::array<float,2>{0.894506991f, 0.0566361621f},
-std::array<float,2>{0.100916147f, 0.997135401f},
-std::array<float,2>{0.832756579f, 0.771584034f},
-std::array<float,2>{0.200140044f, 0.136409491f},
-std::array<float,2>{0.66015631f, 0.282047242f},
-std::array<float,2>{0.33194837f, 0.620404601f},
-std::array<float,2>{0.949836016f, 0.537971199f},
-std::array<float,2>{0.000872550881f, 0.369215131f},
-std::array<float,2>{0.606723905f, 0.21794714f},
-std::array<float,2>{0.434799373f, 0.840455353f},
-std::array<float,2>{0.711977303f, 0.877082646f},
-std::array<float,2>{0.297959298f, 0.124806941f},
-std::array<float,2>{0.783376396f, 0.390950382f},
-std::array<float,2>{0.164248884f, 0.67750746f},
-std::array<float,2>{0.733765841f, 0.692959547f},
-std::array<float,2>{0.257368296f, 0.441044331f},
-std::array<float,2>{0.758427083f, 0.0597715005f},
-std::array<float,2>{0.127894089f, 0.993107736f},
-std::array<float,2>{0.978243232f, 0.769333422f},
-std::array<float,2>{0.0455634259f, 0.140428871f},
-std::array<float,2>{0.569833159f, 0.28904137f},
-std::array<float,2>{0.394978315f, 0.623434007f},
-std::array<float,2>{0.870512903f, 0.534297705f},
-std::array<float,2>{0.23551926f, 0.374200463f},
-std::array<float,2>{0.652550936f, 0.2117275f},
-std::array<float,2>{0.360229701f, 0.838604271f},
-std::array<float,2>{0.55884248f, 0.881704986f},
-std::array<float,2>{0.479376763f, 0.118192948f},
-std::array<float,2>{0.909828007f, 0.397149175f},
-std::array<float,2>{0.0699632689f, 0.67547828f},
-std::array<float,2>{0.615581214f, 0.577897727f},
-std::array<float,2>{0.419519454f, 0.266465873f},
-std::array<float,2>{0.962883413f, 0.16871725f},
-std::array<float,2>{0.0292342585f, 0.783639371f},
-std::array<float,2>{0.798169434f, 0.948007941f},
-std::array<float,2>{0.18147783f, 0.0209212191f},
-std::array<float,2>{0.702313304f, 0.492176771f},
-std::array<float,2>{0.284931988f, 0.734567642f},
-std::array<float,2>{0.882140756f, 0.655151188f},
-std::array<float,2>{0.121678159f, 0.419830084f},
-std::array<float,2>{0.514508367f, 0.0889521837f},
-std::array<float,2>{0.462914169f, 0.928190768f},
-std::array<float,2>{0.673033118f, 0.849750042f},
-std::array<float,2>{0.32807216f, 0.23049131f},
-std::array<float,2>{0.823570967f, 0.319488049f},
-std::array<float,2>{0.210346028f, 0.510944128f},
-std::array<float,2>{0.634577394f, 0.530859053f},
-std::array<float,2>{0.354415894f, 0.332592458f},
-std::array<float,2>{0.847249329f, 0.238569021f},
-std::array<float,2>{0.226301566f, 0.869241834f},
-std::array<float,2>{0.935663104f, 0.911241055f},
-std::array<float,2>{0.0824954659f, 0.0693471283f},
-std::array<float,2>{0.54552424f, 0.423641354f},
-std::array<float,2>{0.490326256f, 0.632582426f},
-std::array<float,2>{0.767265022f, 0.727924705f},
-std::array<float,2>{0.14343451f, 0.474030763f},
-std::array<float,2>{0.742907703f, 0.00438494235f},
-std::array<float,2>{0.278192759f, 0.964194477f},
-std::array<float,2>{0.58077234f, 0.808857262f},
-std::array<float,2>{0.379089266f, 0.175030738f},
-std::array<float,2>{0.999444842f, 0.250018805f},
-std::array<float,2>{0.0588367693f, 0.590588868f},
-std::array<float,2>{0.526689947f, 0.671194315f},
-std::array<float,2>{0.438487083f, 0.376637697f},
-std::array<float,2>{0.905938327f, 0.0958207399f},
-std::array<float,2>{0.102382407f, 0.893572211f},
-std::array<float,2>{0.837988973f, 0.823258221f},
-std::array<float,2>{0.193416968f, 0.193811998f},
-std::array<float,2>{0.667725682f, 0.357220322f},
-std::array<float,2>{0.340225726f, 0.561092079f},
-std::array<float,2>{0.938203454f, 0.598280311f},
-std::array<float,2>{0.0120223695f, 0.298606008f},
-std::array<float,2>{0.596435726f, 0.153934047f},
-std::array<float,2>{0.429012299f, 0.757255256f},
-std::array<float,2>{0.707579374f, 0.97246635f},
-std::array<float,2>{0.305198163f, 0.0454154946f},
-std::array<float,2>{0.794402838f, 0.463483572f},
-std::array<float,2>{0.158102334f, 0.705554187f},
-std::array<float,2>{0.656866908f, 0.639000416f},
-std::array<float,2>{0.333130538f, 0.430253178f},
-std::array<float,2>{0.828791022f, 0.0750792995f},
-std::array<float,2>{0.198955104f, 0.914948642f},
-std::array<float,2>{0.89765507f, 0.865397573f},
-std::array<float,2>{0.0938339308f, 0.247945905f},
-std::array<float,2>{0.518974602f, 0.33630541f},
-std::array<float,2>{0.446459651f, 0.521978438f},
-std::array<float,2>{0.78730005f, 0.581149757f},
-std::array<float,2>{0.167977706f, 0.259186953f},
-std::array<float,2>{0.715722263f, 0.186135218f},
-std::array<float,2>{0.303095281f, 0.804568887f},
-std::array<float,2>{0.602348208f, 0.957505941f},
-std::array<float,2>{0.432290524f, 0.00943809934f},
-std::array<float,2>{0.946538687f, 0.481587112f},
-std::array<float,2>{0.00669299625f, 0.723205507f},
-std::array<float,2>{0.531789124f, 0.553847611f},
-std::array<float,2>{0.493133366f, 0.347977132f},
-std::array<float,2>{0.922374666f, 0.195913926f},
-std::array<float,2>{0.0894370452f, 0.817583799f},
-std::array<float,2>{0.856788695f, 0.903348446f},
-std::array<float,2>{0.231831148f, 0.102077603f},
-std::array<float,2>{0.627798736f, 0.387280822f},
-std::array<float,2>{0.343995929f, 0.660465717f},
-std::array<float,2>{0.991262734f, 0.716244161f},
-std::array<float,2>{0.0483695269f, 0.455244184f},
-std::array<float,2>{0.591014147f, 0.0363636687f},
-std::array<float,2>{0.383732259f, 0.979014874f},
-std::array<float,2>{0.741037905f, 0.759355485f},
-std::array<float,2>{0.272751272f, 0.141086847f},
-std::array<float,2>{0.778541744f, 0.308194935f},
-std::array<float,2>{0.152953535f, 0.605333447f},
-std::array<float,2>{0.689914286f, 0.612037778f},
-std::array<float,2>{0.295418024f, 0.296850234f},
-std::array<float,2>{0.805038929f, 0.127891317f},
-std::array<float,2>{0.172812521f, 0.774567723f},
-std::array<float,2>{0.960211575f, 0.987996697f},
-std::array<float,2>{0.0207843818f, 0.0483170375f},
-std::array<float,2>{0.624455512f, 0.451159209f},
-std::array<float,2>{0.413972557f, 0.699573815f},
-std::array<float,2>{0.819865048f, 0.684679031f},
-std::array<float,2>{0.218253374f, 0.405937999f},
-std::array<float,2>{0.683013618f, 0.11581178f},
-std::array<float,2>{0.316079229f, 0.885129273f},
-std::array<float,2>{0.504287422f, 0.83181119f},
-std::array<float,2>{0.454418927f, 0.208279938f},
-std::array<float,2>{0.883399487f, 0.362541556f},
-std::array<float,2>{0.115502886f, 0.543331742f},
-std::array<float,2>{0.570934713f, 0.743086636f},
-std::array<float,2>{0.398850024f, 0.498336852f},
-std::array<float,2>{0.968863428f, 0.0271677617f},
-std::array<float,2>{0.0361428857f, 0.943567991f},
-std::array<float,2>{0.756495416f, 0.793500602f},
-std::array<float,2>{0.138665557f, 0.161531463f},
-std::array<float,2>{0.723567605f, 0.273955256f},
-std::array<float,2>{0.264713943f, 0.569668293f},
-std::array<float,2>{0.918891847f, 0.504047871f},
-std::array<float,2>{0.0709199086f, 0.320344239f},
-std::array<float,2>{0.551427007f, 0.218759447f},
-std::array<float,2>{0.473463535f, 0.853204668f},
-std::array<float,2>{0.645401716f, 0.937383354f},
-std::array<float,2>{0.370342106f, 0.0781439394f},
-std::array<float,2>{0.864603102f, 0.410120189f},
-std::array<float,2>{0.244036958f, 0.648273349f},
-std::array<float,2>{0.648762822f, 0.719363928f},
-std::array<float,2>{0.364699304f, 0.477350354f},
-std::array<float,2>{0.872047067f, 0.0144970957f},
-std::array<float,2>{0.241716489f, 0.956637442f},
-std::array<float,2>{0.91058892f, 0.798853397f},
-std::array<float,2>{0.0640093461f, 0.181998625f},
-std::array<float,2>{0.555021942f, 0.264699191f},
-std::array<float,2>{0.482209027f, 0.585579932f},
-std::array<float,2>{0.762778044f, 0.517172575f},
-std::array<float,2>{0.13060759f, 0.343370348f},
-std::array<float,2>{0.730446577f, 0.245912552f},
-std::array<float,2>{0.251501709f, 0.859521806f},
-std::array<float,2>{0.564895391f, 0.920742631f},
-std::array<float,2>{0.392176241f, 0.0714827925f},
-std::array<float,2>{0.983666301f, 0.436657339f},
-std::array<float,2>{0.0403728187f, 0.633622348f},
-std::array<float,2>{0.509659827f, 0.608346045f},
-std::array<float,2>{0.466815531f, 0.312308848f},
-std::array<float,2>{0.877430975f, 0.145765856f},
-std::array<float,2>{0.118182592f, 0.765186429f},
-std::array<float,2>{0.825647891f, 0.98370266f},
-std::array<float,2>{0.204063103f, 0.0350752138f},
-std::array<float,2>{0.676637053f, 0.460530102f},
-std::array<float,2>{0.322781891f, 0.713785946f},
-std::array<float,2>{0.966514409f, 0.658495724f},
-std::array<float,2>{0.0236843247f, 0.384147525f},
-std::array<float,2>{0.610002279f, 0.108859524f},
-std::array<float,2>{0.417003751f, 0.899537683f},
-std::array<float,2>{0.698084354f, 0.813747346f},
-std::array<float,2>{0.28583169f, 0.201317683f},
-std::array<float,2>{0.802580357f, 0.347426027f},
-std::array<float,2>{0.186981395f, 0.549027443f},
-std::array<float,2>{0.74955821f, 0.540862501f},
-std::array<float,2>{0.273482621f, 0.365851581f},
-std::array<float,2>{0.770169556f, 0.203185007f},
-std::array<float,2>{0.145219788f, 0.835058212f},
-std::array<float,2>{0.99573791f, 0.889162838f},
-std::array<float,2>{0.057604678f, 0.112725899f},
-std::array<float,2>{0.583469033f, 0.399187535f},
-std::array<float,2>{0.376437694f, 0.681157768f},
-std::array<float,2>{0.850559294f, 0.697425187f},
-std::array<float,2>{0.218806565f, 0.448317289f},
-std::array<float,2>{0.637984157f, 0.0512441359f},
-std::array<float,2>{0.359137565f, 0.990240335f},
-std::array<float,2>{0.541329563f, 0.780517459f},
-std::array<float,2>{0.488233089f, 0.130884871f},
-std::array<float,2>{0.930859864f, 0.289631456f},
-std::array<float,2>{0.0789854899f, 0.615634859f},
-std::array<float,2>{0.600173473f, 0.640860021f},
-std::array<float,2>{0.425266623f, 0.412856996f},
-std::array<float,2>{0.941549003f, 0.0848274976f},
-std::array<float,2>{0.0105994362f, 0.932582855f},
-std::array<float,2>{0.789565086f, 0.857185662f},
-std::array<float,2>{0.160855502f, 0.22270833f},
-std::array<float,2>{0.703162014f, 0.327080667f},
-std::array<float,2>{0.311416447f, 0.502764404f},
-std::array<float,2>{0.90163213f, 0.563046157f},
-std::array<float,2>{0.108246103f, 0.278415799f},
-std::array<float,2>{0.528907239f, 0.156666979f},
-std::array<float,2>{0.441951752f, 0.792374611f},
-std::array<float,2>{0.668790102f, 0.940055668f},
-std::array<float,2>{0.336851746f, 0.0303267688f},
-std::array<float,2>{0.841991961f, 0.494986713f},
-std::array<float,2>{0.188095599f, 0.748765111f},
-std::array<float,2>{0.7137447f, 0.676271677f},
-std::array<float,2>{0.300182164f, 0.392392904f},
-std::array<float,2>{0.782207608f, 0.123591624f},
-std::array<float,2>{0.166241497f, 0.878717601f},
-std::array<float,2>{0.951902032f, 0.841206551f},
-std::array<float,2>{0.0035372905f, 0.217018276f},
-std::array<float,2>{0.608502805f, 0.371088982f},
-std::array<float,2>{0.43672654f, 0.538813472f},
-std::array<float,2>{0.834710836f, 0.619715512f},
-std::array<float,2>{0.202226102f, 0.282479286f},
-std::array<float,2>{0.663270473f, 0.13568759f},
-std::array<float,2>{0.328307301f, 0.772541106f},
-std::array<float,2>{0.522064745f, 0.996557891f},
-std::array<float,2>{0.450389475f, 0.0547295772f},
-std::array<float,2>{0.891958892f, 0.444236249f},
-std::array<float,2>{0.0992516428f, 0.690818787f},
-std::array<float,2>{0.587631762f, 0.512216628f},
-std::array<float,2>{0.388771623f, 0.315629959f},
-std::array<float,2>{0.987891078f, 0.227856249f},
-std::array<float,2>{0.0508658029f, 0.847218275f},
-std::array<float,2>{0.773897886f, 0.924429536f},
-std::array<float,2>{0.151094466f, 0.091413945f},
-std::array<float,2>{0.737350523f, 0.414405406f},
-std::array<float,2>{0.267739177f, 0.648509681f},
-std::array<float,2>{0.929553032f, 0.739170492f},
-std::array<float,2>{0.0933218226f, 0.488080651f},
-std::array<float,2>{0.535874784f, 0.016104674f},
-std::array<float,2>{0.496698529f, 0.952731192f},
-std::array<float,2>{0.629098773f, 0.786640346f},
-std::array<float,2>{0.350593686f, 0.165271088f},
-std::array<float,2>{0.853190839f, 0.270728737f},
-std::array<float,2>{0.229293197f, 0.574117839f},
-std::array<float,2>{0.685608447f, 0.588737309f},
-std::array<float,2>{0.319560856f, 0.254429311f},
-std::array<float,2>{0.812570751f, 0.177943259f},
-std::array<float,2>{0.211555362f, 0.805247903f},
-std::array<float,2>{0.886999369f, 0.966685057f},
-std::array<float,2>{0.110008061f, 0.00295783766f},
-std::array<float,2>{0.500979841f, 0.469657332f},
-std::array<float,2>{0.4594495f, 0.732280254f},
-std::array<float,2>{0.811793149f, 0.628024817f},
-std::array<float,2>{0.178375602f, 0.428586036f},
-std::array<float,2>{0.6934129f, 0.0658749864f},
-std::array<float,2>{0.292314827f, 0.909615338f},
-std::array<float,2>{0.620500088f, 0.872077942f},
-std::array<float,2>{0.4066208f, 0.234587625f},
-std::array<float,2>{0.953654587f, 0.328412175f},
-std::array<float,2>{0.0173113476f, 0.525268674f},
-std::array<float,2>{0.548015296f, 0.710250676f},
-std::array<float,2>{0.470771939f, 0.466093391f},
-std::array<float,2>{0.914300799f, 0.0401717611f},
-std::array<float,2>{0.0742787048f, 0.975385606f},
-std::array<float,2>{0.86206156f, 0.752164066f},
-std::array<float,2>{0.2497482f, 0.151360571f},
-std::array<float,2>{0.641446173f, 0.303591788f},
-std::array<float,2>{0.372089505f, 0.597119391f},
-std::array<float,2>{0.973271251f, 0.555253506f},
-std::array<float,2>{0.0342037976f, 0.352081746f},
-std::array<float,2>{0.576107919f, 0.189974755f},
-std::array<float,2>{0.40242368f, 0.826703072f},
-std::array<float,2>{0.718845487f, 0.895152092f},
-std::array<float,2>{0.260522723f, 0.0998297632f},
-std::array<float,2>{0.75383836f, 0.379127532f},
-std::array<float,2>{0.135873944f, 0.666444659f},
-std::array<float,2>{0.699389756f, 0.736446023f},
-std::array<float,2>{0.283056885f, 0.488868296f},
-std::array<float,2>{0.80065167f, 0.0221857075f},
-std::array<float,2>{0.182154447f, 0.945322037f},
-std::array<float,2>{0.964672983f, 0.781729043f},
-std::array<float,2>{0.0297873132f, 0.171855375f},
-std::array<float,2>{0.613773346f, 0.267838418f},
-std::array<float,2>{0.421064436f, 0.575201929f},
-std::array<float,2>{0.82205236f, 0.508081079f},
-std::array<float,2>{0.207090601f, 0.317556947f},
-std::array<float,2>{0.675077558f, 0.233406559f},
-std::array<float,2>{0.325617284f, 0.849164069f},
-std::array<float,2>{0.512365758f, 0.92767185f},
-std::array<float,2>{0.46118781f, 0.0859635696f},
-std::array<float,2>{0.880857587f, 0.421031058f},
-std::array<float,2>{0.124752231f, 0.653955817f},
-std::array<float,2>{0.567308009f, 0.622569263f},
-std::array<float,2>{0.397902757f, 0.285707861f},
-std::array<float,2>{0.979943335f, 0.138034552f},
-std::array<float,2>{0.0438169166f, 0.765812814f},
-std::array<float,2>{0.76001662f, 0.994456947f},
-std::array<float,2>{0.125309706f, 0.0619743988f},
-std::array<float,2>{0.73182565f, 0.438603908f},
-std::array<float,2>{0.254882753f, 0.694345713f},
-std::array<float,2>{0.908171356f, 0.673056424f},
-std::array<float,2>{0.0669566542f, 0.395255297f},
-std::array<float,2>{0.561993957f, 0.120167606f},
-std::array<float,2>{0.476662129f, 0.880418479f},
-std::array<float,2>{0.655982852f, 0.837283313f},
-std::array<float,2>{0.362729967f, 0.214332387f},
-std::array<float,2>{0.86828053f, 0.372630149f},
-std::array<float,2>{0.236523181f, 0.531494439f},
-std::array<float,2>{0.665180027f, 0.560212433f},
-std::array<float,2>{0.342794329f, 0.359118342f},
-std::array<float,2>{0.837440014f, 0.191476464f},
-std::array<float,2>{0.193283245f, 0.820612609f},
-std::array<float,2>{0.903674662f, 0.892477274f},
-std::array<float,2>{0.104655705f, 0.095437482f},
-std::array<float,2>{0.523829162f, 0.377202421f},
-std::array<float,2>{0.439504266f, 0.669005275f},
-std::array<float,2>{0.795814812f, 0.704580724f},
-std::array<float,2>{0.159048319f, 0.461295128f},
-std::array<float,2>{0.709515154f, 0.0430247039f},
-std::array<float,2>{0.30700025f, 0.970463455f},
-std::array<float,2>{0.594130576f, 0.755590558f},
-std::array<float,2>{0.42594561f, 0.154426932f},
-std::array<float,2>{0.941283107f, 0.29932794f},
-std::array<float,2>{0.0142998248f, 0.599996507f},
-std::array<float,2>{0.543904781f, 0.630200267f},
-std::array<float,2>{0.489533544f, 0.424803048f},
-std::array<float,2>{0.935323298f, 0.0679954588f},
-std::array<float,2>{0.0851640403f, 0.913894594f},
-std::array<float,2>{0.845602274f, 0.868134975f},
-std::array<float,2>{0.223116636f, 0.24025324f},
-std::array<float,2>{0.635024548f, 0.335694432f},
-std::array<float,2>{0.352706343f, 0.528643668f},
-std::array<float,2>{0.997361362f, 0.591901183f},
-std::array<float,2>{0.0617060177f, 0.253760785f},
-std::array<float,2>{0.578899145f, 0.171976984f},
-std::array<float,2>{0.382522851f, 0.811452627f},
-std::array<float,2>{0.744970798f, 0.961740077f},
-std::array<float,2>{0.28076905f, 0.00589607609f},
-std::array<float,2>{0.768553734f, 0.474901259f},
-std::array<float,2>{0.141591966f, 0.729435861f},
-std::array<float,2>{0.626484811f, 0.663756847f},
-std::array<float,2>{0.347079635f, 0.390468329f},
-std::array<float,2>{0.859056234f, 0.104008362f},
-std::array<float,2>{0.232985511f, 0.905483365f},
-std::array<float,2>{0.92532897f, 0.819491148f},
-std::array<float,2>{0.087433517f, 0.198733047f},
-std::array<float,2>{0.535073519f, 0.349859267f},
-std::array<float,2>{0.495501012f, 0.552086115f},
-std::array<float,2>{0.779369593f, 0.602904856f},
-std::array<float,2>{0.155063584f, 0.305219501f},
-std::array<float,2>{0.738875806f, 0.143710881f},
-std::array<float,2>{0.269987226f, 0.760578752f},
-std::array<float,2>{0.591818035f, 0.977537274f},
-std::array<float,2>{0.384901047f, 0.037464615f},
-std::array<float,2>{0.989048362f, 0.45395121f},
-std::array<float,2>{0.0489018373f, 0.717122018f},
-std::array<float,2>{0.517108858f, 0.521113455f},
-std::array<float,2>{0.448687047f, 0.338174522f},
-std::array<float,2>{0.89529413f, 0.248582035f},
-std::array<float,2>{0.0976545587f, 0.864023387f},
-std::array<float,2>{0.830346823f, 0.916421473f},
-std::array<float,2>{0.196202919f, 0.0771249086f},
-std::array<float,2>{0.658392966f, 0.433522433f},
-std::array<float,2>{0.334055364f, 0.637159586f},
-std::array<float,2>{0.947609603f, 0.726436853f},
-std::array<float,2>{0.00440977514f, 0.483329207f},
-std::array<float,2>{0.604153514f, 0.0105004357f},
-std::array<float,2>{0.431162417f, 0.959288657f},
-std::array<float,2>{0.717332542f, 0.802144885f},
-std::array<float,2>{0.300885558f, 0.184382394f},
-std::array<float,2>{0.786744773f, 0.260034114f},
-std::array<float,2>{0.170341834f, 0.579160213f},
-std::array<float,2>{0.725755513f, 0.567745745f},
-std::array<float,2>{0.262323707f, 0.275556922f},
-std::array<float,2>{0.754084647f, 0.162219733f},
-std::array<float,2>{0.139092833f, 0.796867371f},
-std::array<float,2>{0.971515238f, 0.942783237f},
-std::array<float,2>{0.0371663086f, 0.0236801226f},
-std::array<float,2>{0.572492123f, 0.497434825f},
-std::array<float,2>{0.401739448f, 0.744905174f},
-std::array<float,2>{0.866921484f, 0.646329939f},
-std::array<float,2>{0.245456964f, 0.406625092f},
-std::array<float,2>{0.647363305f, 0.0817610994f},
-std::array<float,2>{0.36854288f, 0.935265303f},
-std::array<float,2>{0.554158628f, 0.854638696f},
-std::array<float,2>{0.474904865f, 0.222122088f},
-std::array<float,2>{0.921793461f, 0.323273987f},
-std::array<float,2>{0.0731605887f, 0.507457495f},
-std::array<float,2>{0.622038722f, 0.702365935f},
-std::array<float,2>{0.410970062f, 0.45216462f},
-std::array<float,2>{0.958301365f, 0.0493483655f},
-std::array<float,2>{0.0224357136f, 0.984396636f},
-std::array<float,2>{0.807396233f, 0.776962638f},
-std::array<float,2>{0.175143391f, 0.126544043f},
-std::array<float,2>{0.68784076f, 0.29325822f},
-std::array<float,2>{0.293860972f, 0.60960269f},
-std::array<float,2>{0.886157632f, 0.545028985f},
-std::array<float,2>{0.113716193f, 0.359724581f},
-std::array<float,2>{0.507046342f, 0.2090303f},
-std::array<float,2>{0.456251532f, 0.829282999f},
-std::array<float,2>{0.681185067f, 0.883603752f},
-std::array<float,2>{0.313194275f, 0.114258289f},
-std::array<float,2>{0.816910088f, 0.404123217f},
-std::array<float,2>{0.215810895f, 0.687080085f},
-std::array<float,2>{0.679587781f, 0.711027026f},
-std::array<float,2>{0.322212607f, 0.45755443f},
-std::array<float,2>{0.827991307f, 0.0325686336f},
-std::array<float,2>{0.206921354f, 0.981040239f},
-std::array<float,2>{0.875131011f, 0.761858225f},
-std::array<float,2>{0.120050073f, 0.147876337f},
-std::array<float,2>{0.510573864f, 0.309075058f},
-std::array<float,2>{0.466429979f, 0.605641723f},
-std::array<float,2>{0.802946091f, 0.548275769f},
-std::array<float,2>{0.184171945f, 0.344299823f},
-std::array<float,2>{0.696510196f, 0.199832335f},
-std::array<float,2>{0.287262589f, 0.815986633f},
-std::array<float,2>{0.611406803f, 0.901613653f},
-std::array<float,2>{0.414804161f, 0.107177831f},
-std::array<float,2>{0.967128754f, 0.3858307f},
-std::array<float,2>{0.0263435077f, 0.65718472f},
-std::array<float,2>{0.557512939f, 0.582398534f},
-std::array<float,2>{0.483205169f, 0.262546152f},
-std::array<float,2>{0.913706899f, 0.179872826f},
-std::array<float,2>{0.0655397177f, 0.798615336f},
-std::array<float,2>{0.874592304f, 0.953864276f},
-std::array<float,2>{0.238527372f, 0.012540766f},
-std::array<float,2>{0.651787698f, 0.479240566f},
-std::array<float,2>{0.366423011f, 0.721278608f},
-std::array<float,2>{0.981101811f, 0.63546145f},
-std::array<float,2>{0.0420763269f, 0.435322315f},
-std::array<float,2>{0.562615454f, 0.0723149851f},
-std::array<float,2>{0.393569946f, 0.919627547f},
-std::array<float,2>{0.727082014f, 0.86317569f},
-std::array<float,2>{0.252215654f, 0.243942961f},
-std::array<float,2>{0.765399456f, 0.341166794f},
-std::array<float,2>{0.131393418f, 0.517849743f},
-std::array<float,2>{0.705094635f, 0.50077033f},
-std::array<float,2>{0.309305072f, 0.32449609f},
-std::array<float,2>{0.791615188f, 0.226107299f},
-std::array<float,2>{0.163578376f, 0.857659936f},
-std::array<float,2>{0.944435f, 0.929953277f},
-std::array<float,2>{0.00945585873f, 0.0838885233f},
-std::array<float,2>{0.597744703f, 0.410564393f},
-std::array<float,2>{0.423101723f, 0.642947853f},
-std::array<float,2>{0.841192722f, 0.747771204f},
-std::array<float,2>{0.191102937f, 0.493516266f},
-std::array<float,2>{0.671224773f, 0.0279928781f},
-std::array<float,2>{0.339345247f, 0.938638687f},
-std::array<float,2>{0.530545354f, 0.789729118f},
-std::array<float,2>{0.443922162f, 0.15828307f},
-std::array<float,2>{0.898645878f, 0.28118071f},
-std::array<float,2>{0.107173085f, 0.565139651f},
-std::array<float,2>{0.585617721f, 0.683229864f},
-std::array<float,2>{0.378367186f, 0.400840223f},
-std::array<float,2>{0.993104815f, 0.111325622f},
-std::array<float,2>{0.0562777109f, 0.887988567f},
-std::array<float,2>{0.772266269f, 0.833135426f},
-std::array<float,2>{0.148219526f, 0.206727892f},
-std::array<float,2>{0.747408211f, 0.36446619f},
-std::array<float,2>{0.275756717f, 0.542158306f},
-std::array<float,2>{0.932021916f, 0.613303959f},
-std::array<float,2>{0.0819875896f, 0.292259783f},
-std::array<float,2>{0.540912092f, 0.129398376f},
-std::array<float,2>{0.485891849f, 0.778260708f},
-std::array<float,2>{0.640557706f, 0.988825202f},
-std::array<float,2>{0.356365621f, 0.0545634255f},
-std::array<float,2>{0.849397421f, 0.445407182f},
-std::array<float,2>{0.22231701f, 0.696614087f},
-std::array<float,2>{0.736230373f, 0.652323306f},
-std::array<float,2>{0.266778857f, 0.416435122f},
-std::array<float,2>{0.77703172f, 0.0918193012f},
-std::array<float,2>{0.148864597f, 0.922999144f},
-std::array<float,2>{0.985271573f, 0.845124602f},
-std::array<float,2>{0.0539466627f, 0.228944764f},
-std::array<float,2>{0.58907187f, 0.313645333f},
-std::array<float,2>{0.387051404f, 0.514193475f},
-std::array<float,2>{0.854694843f, 0.571888864f},
-std::array<float,2>{0.227345526f, 0.27339378f},
-std::array<float,2>{0.631689668f, 0.16631338f},
-std::array<float,2>{0.34774223f, 0.787158847f},
-std::array<float,2>{0.537153125f, 0.950769484f},
-std::array<float,2>{0.499407828f, 0.0188991241f},
-std::array<float,2>{0.926275671f, 0.485462666f},
-std::array<float,2>{0.0906598344f, 0.740412951f},
-std::array<float,2>{0.605821252f, 0.535741627f},
-std::array<float,2>{0.434161216f, 0.368333697f},
-std::array<float,2>{0.950918853f, 0.21669054f},
-std::array<float,2>{0.00121038198f, 0.841876864f},
-std::array<float,2>{0.784384191f, 0.876117051f},
-std::array<float,2>{0.165088236f, 0.121115334f},
-std::array<float,2>{0.711823702f, 0.393409997f},
-std::array<float,2>{0.297568917f, 0.67799437f},
-std::array<float,2>{0.893243968f, 0.688707709f},
-std::array<float,2>{0.0997998938f, 0.443157643f},
-std::array<float,2>{0.519973755f, 0.0568501316f},
-std::array<float,2>{0.451715797f, 0.998476088f},
-std::array<float,2>{0.661339104f, 0.771018445f},
-std::array<float,2>{0.330805123f, 0.132873222f},
-std::array<float,2>{0.833126128f, 0.283423185f},
-std::array<float,2>{0.201145917f, 0.61804074f},
-std::array<float,2>{0.643927813f, 0.595567822f},
-std::array<float,2>{0.374873519f, 0.302530497f},
-std::array<float,2>{0.86101073f, 0.150224239f},
-std::array<float,2>{0.246534348f, 0.750134587f},
-std::array<float,2>{0.917545915f, 0.973432839f},
-std::array<float,2>{0.0771833733f, 0.0419886373f},
-std::array<float,2>{0.548904777f, 0.467370957f},
-std::array<float,2>{0.470520854f, 0.707660079f},
-std::array<float,2>{0.751440763f, 0.664817452f},
-std::array<float,2>{0.133877978f, 0.381371021f},
-std::array<float,2>{0.721244693f, 0.0983365923f},
-std::array<float,2>{0.259499282f, 0.897415996f},
-std::array<float,2>{0.576513052f, 0.824369729f},
-std::array<float,2>{0.404831231f, 0.188677505f},
-std::array<float,2>{0.976123989f, 0.354059547f},
-std::array<float,2>{0.0318569802f, 0.558118224f},
-std::array<float,2>{0.502401233f, 0.733298302f},
-std::array<float,2>{0.457970113f, 0.47190693f},
-std::array<float,2>{0.889082432f, 0.00149699149f},
-std::array<float,2>{0.112327084f, 0.967760205f},
-std::array<float,2>{0.814742327f, 0.807318509f},
-std::array<float,2>{0.214070827f, 0.176631331f},
-std::array<float,2>{0.684440672f, 0.256336153f},
-std::array<float,2>{0.317161113f, 0.587395072f},
-std::array<float,2>{0.955306113f, 0.526213825f},
-std::array<float,2>{0.0193542466f, 0.330500931f},
-std::array<float,2>{0.618637383f, 0.237088785f},
-std::array<float,2>{0.408227623f, 0.874421477f},
-std::array<float,2>{0.69271785f, 0.907929659f},
-std::array<float,2>{0.290370673f, 0.0632264242f},
-std::array<float,2>{0.80907613f, 0.427202642f},
-std::array<float,2>{0.176841184f, 0.626753449f},
-std::array<float,2>{0.723117888f, 0.744296908f},
-std::array<float,2>{0.26561895f, 0.497800827f},
-std::array<float,2>{0.755885422f, 0.0239437036f},
-std::array<float,2>{0.138155729f, 0.94330585f},
-std::array<float,2>{0.969442487f, 0.795967817f},
-std::array<float,2>{0.0370007828f, 0.162993789f},
-std::array<float,2>{0.570379376f, 0.27611503f},
-std::array<float,2>{0.399053097f, 0.568327546f},
-std::array<float,2>{0.864756465f, 0.507046402f},
-std::array<float,2>{0.243359029f, 0.324154168f},
-std::array<float,2>{0.644703329f, 0.222455755f},
-std::array<float,2>{0.371088594f, 0.855268896f},
-std::array<float,2>{0.551133394f, 0.935038686f},
-std::array<float,2>{0.47279802f, 0.0812443346f},
-std::array<float,2>{0.917972505f, 0.406814158f},
-std::array<float,2>{0.0704153329f, 0.645979285f},
-std::array<float,2>{0.624743342f, 0.609959841f},
-std::array<float,2>{0.413394034f, 0.293505996f},
-std::array<float,2>{0.960744262f, 0.126309514f},
-std::array<float,2>{0.021061983f, 0.776794791f},
-std::array<float,2>{0.805246294f, 0.985200942f},
-std::array<float,2>{0.1720718f, 0.0490576513f},
-std::array<float,2>{0.690157413f, 0.45296976f},
-std::array<float,2>{0.295129955f, 0.702748656f},
-std::array<float,2>{0.882873178f, 0.686797261f},
-std::array<float,2>{0.115989469f, 0.403504282f},
-std::array<float,2>{0.504805088f, 0.115110658f},
-std::array<float,2>{0.45465821f, 0.883092165f},
-std::array<float,2>{0.683429241f, 0.82996583f},
-std::array<float,2>{0.315526664f, 0.209669143f},
-std::array<float,2>{0.819351554f, 0.359939724f},
-std::array<float,2>{0.218393281f, 0.545450926f},
-std::array<float,2>{0.627364099f, 0.552258432f},
-std::array<float,2>{0.344400078f, 0.350144207f},
-std::array<float,2>{0.856986642f, 0.198488444f},
-std::array<float,2>{0.23209317f, 0.820204675f},
-std::array<float,2>{0.922279477f, 0.905976892f},
-std::array<float,2>{0.0890338644f, 0.103761487f},
-std::array<float,2>{0.531276762f, 0.389984399f},
-std::array<float,2>{0.492224663f, 0.66312331f},
-std::array<float,2>{0.779187083f, 0.717640042f},
-std::array<float,2>{0.152448773f, 0.453310907f},
-std::array<float,2>{0.740680993f, 0.0376282409f},
-std::array<float,2>{0.27320084f, 0.9766469f},
-std::array<float,2>{0.59150511f, 0.759891629f},
-std::array<float,2>{0.382814854f, 0.144388899f},
-std::array<float,2>{0.991941214f, 0.304787576f},
-std::array<float,2>{0.0481697991f, 0.603117168f},
-std::array<float,2>{0.519250035f, 0.637387633f},
-std::array<float,2>{0.447165132f, 0.432838678f},
-std::array<float,2>{0.898035407f, 0.0761782676f},
-std::array<float,2>{0.0946535096f, 0.916540265f},
-std::array<float,2>{0.828432679f, 0.86331445f},
-std::array<float,2>{0.198625892f, 0.248109162f},
-std::array<float,2>{0.656412959f, 0.338783175f},
-std::array<float,2>{0.333979636f, 0.520835102f},
-std::array<float,2>{0.946797431f, 0.580052137f},
-std::array<float,2>{0.00614022883f, 0.260488361f},
-std::array<float,2>{0.601673424f, 0.184040457f},
-std::array<float,2>{0.43208003f, 0.802433848f},
-std::array<float,2>{0.714876175f, 0.959878862f},
-std::array<float,2>{0.30358696f, 0.00979031902f},
-std::array<float,2>{0.787908375f, 0.482751548f},
-std::array<float,2>{0.168829069f, 0.7257514f},
-std::array<float,2>{0.667425931f, 0.669479012f},
-std::array<float,2>{0.340768069f, 0.377831966f},
-std::array<float,2>{0.838580847f, 0.0949266925f},
-std::array<float,2>{0.193964168f, 0.891667008f},
-std::array<float,2>{0.905659974f, 0.82082665f},
-std::array<float,2>{0.101823993f, 0.192051902f},
-std::array<float,2>{0.526883364f, 0.358558029f},
-std::array<float,2>{0.439192772f, 0.559877336f},
-std::array<float,2>{0.794604003f, 0.600218475f},
-std::array<float,2>{0.157425195f, 0.299127281f},
-std::array<float,2>{0.707080662f, 0.154980123f},
-std::array<float,2>{0.305059344f, 0.755088449f},
-std::array<float,2>{0.59605372f, 0.970070899f},
-std::array<float,2>{0.429612696f, 0.0437730625f},
-std::array<float,2>{0.937978864f, 0.461529374f},
-std::array<float,2>{0.0122704934f, 0.704736888f},
-std::array<float,2>{0.545088053f, 0.529015839f},
-std::array<float,2>{0.490997672f, 0.335375816f},
-std::array<float,2>{0.936364293f, 0.240725085f},
-std::array<float,2>{0.0827665478f, 0.867588401f},
-std::array<float,2>{0.846770406f, 0.913121402f},
-std::array<float,2>{0.22604382f, 0.0677475259f},
-std::array<float,2>{0.634129822f, 0.424008429f},
-std::array<float,2>{0.353519708f, 0.630744696f},
-std::array<float,2>{0.999676943f, 0.728709936f},
-std::array<float,2>{0.059525948f, 0.475448281f},
-std::array<float,2>{0.580386043f, 0.00676702103f},
-std::array<float,2>{0.37953034f, 0.961305439f},
-std::array<float,2>{0.742538869f, 0.81077075f},
-std::array<float,2>{0.27736181f, 0.172523156f},
-std::array<float,2>{0.766786754f, 0.253252357f},
-std::array<float,2>{0.142958865f, 0.592331827f},
-std::array<float,2>{0.702822089f, 0.576055169f},
-std::array<float,2>{0.284228474f, 0.268144429f},
-std::array<float,2>{0.798435867f, 0.171016797f},
-std::array<float,2>{0.180818409f, 0.782118797f},
-std::array<float,2>{0.962252259f, 0.945996821f},
-std::array<float,2>{0.0283404347f, 0.021608131f},
-std::array<float,2>{0.615813434f, 0.488518298f},
-std::array<float,2>{0.419287413f, 0.736982048f},
-std::array<float,2>{0.823748589f, 0.653692842f},
-std::array<float,2>{0.210920319f, 0.421522319f},
-std::array<float,2>{0.673762977f, 0.0867373794f},
-std::array<float,2>{0.327612758f, 0.926867425f},
-std::array<float,2>{0.513997495f, 0.849010527f},
-std::array<float,2>{0.46356982f, 0.234305307f},
-std::array<float,2>{0.882327974f, 0.318123132f},
-std::array<float,2>{0.121176258f, 0.508538663f},
-std::array<float,2>{0.569521248f, 0.694848001f},
-std::array<float,2>{0.395269245f, 0.439231694f},
-std::array<float,2>{0.977611899f, 0.0624282919f},
-std::array<float,2>{0.0451257713f, 0.994822383f},
-std::array<float,2>{0.758148313f, 0.766348898f},
-std::array<float,2>{0.127422258f, 0.1384978f},
-std::array<float,2>{0.734030604f, 0.285507947f},
-std::array<float,2>{0.257272214f, 0.622123957f},
-std::array<float,2>{0.909350276f, 0.531926513f},
-std::array<float,2>{0.0695624426f, 0.372531235f},
-std::array<float,2>{0.559143662f, 0.214651331f},
-std::array<float,2>{0.478858709f, 0.837503016f},
-std::array<float,2>{0.653069854f, 0.879902601f},
-std::array<float,2>{0.359622717f, 0.120794848f},
-std::array<float,2>{0.870720506f, 0.39475745f},
-std::array<float,2>{0.236060038f, 0.67367661f},
-std::array<float,2>{0.640983522f, 0.707481623f},
-std::array<float,2>{0.373014361f, 0.467067897f},
-std::array<float,2>{0.861415088f, 0.0413846672f},
-std::array<float,2>{0.249385774f, 0.972755075f},
-std::array<float,2>{0.914949417f, 0.750604451f},
-std::array<float,2>{0.0748244449f, 0.14952293f},
-std::array<float,2>{0.548633158f, 0.302087814f},
-std::array<float,2>{0.471248806f, 0.594936073f},
-std::array<float,2>{0.75295037f, 0.557810783f},
-std::array<float,2>{0.136556253f, 0.353980213f},
-std::array<float,2>{0.719342172f, 0.189288169f},
-std::array<float,2>{0.26019749f, 0.825047314f},
-std::array<float,2>{0.575681984f, 0.896846533f},
-std::array<float,2>{0.402897745f, 0.0978565663f},
-std::array<float,2>{0.972746134f, 0.381271631f},
-std::array<float,2>{0.0350944176f, 0.664254189f},
-std::array<float,2>{0.501664937f, 0.587410986f},
-std::array<float,2>{0.45979625f, 0.256544203f},
-std::array<float,2>{0.887528121f, 0.175807849f},
-std::array<float,2>{0.109841928f, 0.806755841f},
-std::array<float,2>{0.81302309f, 0.967266023f},
-std::array<float,2>{0.211006865f, 0.00125237938f},
-std::array<float,2>{0.686145604f, 0.472210944f},
-std::array<float,2>{0.320080906f, 0.732528448f},
-std::array<float,2>{0.953310966f, 0.625992119f},
-std::array<float,2>{0.0166103505f, 0.427305579f},
-std::array<float,2>{0.621061206f, 0.0629295856f},
-std::array<float,2>{0.406742543f, 0.907239735f},
-std::array<float,2>{0.694334149f, 0.874833763f},
-std::array<float,2>{0.292802811f, 0.236622572f},
-std::array<float,2>{0.812224627f, 0.330594093f},
-std::array<float,2>{0.177947521f, 0.525772452f},
-std::array<float,2>{0.738087773f, 0.514101326f},
-std::array<float,2>{0.268070668f, 0.314339995f},
-std::array<float,2>{0.774030089f, 0.229401723f},
-std::array<float,2>{0.150475428f, 0.845631182f},
-std::array<float,2>{0.987343431f, 0.923716486f},
-std::array<float,2>{0.05130684f, 0.0923906118f},
-std::array<float,2>{0.586968124f, 0.416805714f},
-std::array<float,2>{0.38957119f, 0.651584446f},
-std::array<float,2>{0.852585316f, 0.741177857f},
-std::array<float,2>{0.228671104f, 0.486209989f},
-std::array<float,2>{0.629661202f, 0.0194788147f},
-std::array<float,2>{0.351435274f, 0.95033145f},
-std::array<float,2>{0.53537035f, 0.787844241f},
-std::array<float,2>{0.496294677f, 0.166887f},
-std::array<float,2>{0.92881608f, 0.272722214f},
-std::array<float,2>{0.0932235271f, 0.571506083f},
-std::array<float,2>{0.609041274f, 0.678372025f},
-std::array<float,2>{0.437277079f, 0.393009245f},
-std::array<float,2>{0.951257467f, 0.121944517f},
-std::array<float,2>{0.00306231435f, 0.876910985f},
-std::array<float,2>{0.781467795f, 0.842605293f},
-std::array<float,2>{0.166638106f, 0.21621947f},
-std::array<float,2>{0.712918878f, 0.369003505f},
-std::array<float,2>{0.300419986f, 0.535460174f},
-std::array<float,2>{0.892511368f, 0.617442131f},
-std::array<float,2>{0.0988173485f, 0.284013867f},
-std::array<float,2>{0.521837533f, 0.133551002f},
-std::array<float,2>{0.450841218f, 0.770703316f},
-std::array<float,2>{0.663785756f, 0.998769462f},
-std::array<float,2>{0.328861505f, 0.0573317967f},
-std::array<float,2>{0.834372818f, 0.442656755f},
-std::array<float,2>{0.202967063f, 0.689363897f},
-std::array<float,2>{0.703820229f, 0.643484831f},
-std::array<float,2>{0.310948074f, 0.410912722f},
-std::array<float,2>{0.789528787f, 0.0830878764f},
-std::array<float,2>{0.160275832f, 0.930306077f},
-std::array<float,2>{0.941918194f, 0.858151853f},
-std::array<float,2>{0.00978927966f, 0.225982368f},
-std::array<float,2>{0.599928319f, 0.325085729f},
-std::array<float,2>{0.425754666f, 0.500179529f},
-std::array<float,2>{0.84269619f, 0.564720631f},
-std::array<float,2>{0.187531218f, 0.280542284f},
-std::array<float,2>{0.668193638f, 0.159064889f},
-std::array<float,2>{0.336071551f, 0.789485812f},
-std::array<float,2>{0.528322697f, 0.939344287f},
-std::array<float,2>{0.441449076f, 0.0276882909f},
-std::array<float,2>{0.901872754f, 0.493890613f},
-std::array<float,2>{0.107737534f, 0.747419357f},
-std::array<float,2>{0.583866f, 0.542599499f},
-std::array<float,2>{0.376575828f, 0.365158319f},
-std::array<float,2>{0.995551109f, 0.206058487f},
-std::array<float,2>{0.0569307059f, 0.833942831f},
-std::array<float,2>{0.769870162f, 0.888294697f},
-std::array<float,2>{0.144996807f, 0.110710301f},
-std::array<float,2>{0.749487996f, 0.401102245f},
-std::array<float,2>{0.274377614f, 0.682826221f},
-std::array<float,2>{0.931634426f, 0.696847796f},
-std::array<float,2>{0.0785873234f, 0.446114659f},
-std::array<float,2>{0.541532278f, 0.0540404283f},
-std::array<float,2>{0.487487346f, 0.988375485f},
-std::array<float,2>{0.638489008f, 0.777382553f},
-std::array<float,2>{0.358823836f, 0.12899366f},
-std::array<float,2>{0.85006243f, 0.292867154f},
-std::array<float,2>{0.219628662f, 0.614239693f},
-std::array<float,2>{0.675869465f, 0.606427848f},
-std::array<float,2>{0.322401583f, 0.309107751f},
-std::array<float,2>{0.826104939f, 0.147965416f},
-std::array<float,2>{0.203555286f, 0.762252271f},
-std::array<float,2>{0.877679706f, 0.980790317f},
-std::array<float,2>{0.118800037f, 0.0328233615f},
-std::array<float,2>{0.508894265f, 0.457232445f},
-std::array<float,2>{0.467616409f, 0.711721301f},
-std::array<float,2>{0.801999271f, 0.656538725f},
-std::array<float,2>{0.187338755f, 0.386654198f},
-std::array<float,2>{0.69759661f, 0.106932461f},
-std::array<float,2>{0.285293311f, 0.902175426f},
-std::array<float,2>{0.609804213f, 0.815846443f},
-std::array<float,2>{0.417513013f, 0.199642688f},
-std::array<float,2>{0.966191232f, 0.344094276f},
-std::array<float,2>{0.0242157876f, 0.548468113f},
-std::array<float,2>{0.555547595f, 0.720750928f},
-std::array<float,2>{0.481883258f, 0.478686929f},
-std::array<float,2>{0.911076665f, 0.0120607121f},
-std::array<float,2>{0.0637156144f, 0.953462303f},
-std::array<float,2>{0.871476233f, 0.798104584f},
-std::array<float,2>{0.241326779f, 0.180414468f},
-std::array<float,2>{0.649270952f, 0.261854827f},
-std::array<float,2>{0.365210414f, 0.582700312f},
-std::array<float,2>{0.984061897f, 0.518373311f},
-std::array<float,2>{0.0406488851f, 0.341495067f},
-std::array<float,2>{0.565219283f, 0.243410349f},
-std::array<float,2>{0.391649365f, 0.862421036f},
-std::array<float,2>{0.729921281f, 0.919305146f},
-std::array<float,2>{0.251275092f, 0.0728095174f},
-std::array<float,2>{0.763445497f, 0.434838682f},
-std::array<float,2>{0.13016668f, 0.634832442f},
-std::array<float,2>{0.688427687f, 0.700126469f},
-std::array<float,2>{0.293352365f, 0.450488925f},
-std::array<float,2>{0.807025254f, 0.048743207f},
-std::array<float,2>{0.17575343f, 0.987478495f},
-std::array<float,2>{0.958816171f, 0.774933219f},
-std::array<float,2>{0.0215131436f, 0.127171174f},
-std::array<float,2>{0.621484518f, 0.295898467f},
-std::array<float,2>{0.410493076f, 0.611807644f},
-std::array<float,2>{0.81675601f, 0.543546438f},
-std::array<float,2>{0.214953795f, 0.363066077f},
-std::array<float,2>{0.680667639f, 0.208904386f},
-std::array<float,2>{0.312816054f, 0.831213236f},
-std::array<float,2>{0.50740391f, 0.885508478f},
-std::array<float,2>{0.456933737f, 0.1152585f},
-std::array<float,2>{0.886253476f, 0.405719459f},
-std::array<float,2>{0.114011131f, 0.685502768f},
-std::array<float,2>{0.573175013f, 0.570061684f},
-std::array<float,2>{0.402248085f, 0.273695886f},
-std::array<float,2>{0.970758915f, 0.161990792f},
-std::array<float,2>{0.0379998162f, 0.793137133f},
-std::array<float,2>{0.754657209f, 0.944040835f},
-std::array<float,2>{0.139546111f, 0.0268000551f},
-std::array<float,2>{0.726372063f, 0.498827279f},
-std::array<float,2>{0.261925161f, 0.742438912f},
-std::array<float,2>{0.921088815f, 0.64748317f},
-std::array<float,2>{0.0724811703f, 0.409457803f},
-std::array<float,2>{0.554424405f, 0.0786529109f},
-std::array<float,2>{0.475551069f, 0.936843336f},
-std::array<float,2>{0.646620572f, 0.852701247f},
-std::array<float,2>{0.368775487f, 0.219286397f},
-std::array<float,2>{0.866589963f, 0.320936859f},
-std::array<float,2>{0.245847359f, 0.504675031f},
-std::array<float,2>{0.65913403f, 0.521498263f},
-std::array<float,2>{0.334846795f, 0.33669433f},
-std::array<float,2>{0.830789745f, 0.247436672f},
-std::array<float,2>{0.195527956f, 0.865785599f},
-std::array<float,2>{0.894853652f, 0.914391637f},
-std::array<float,2>{0.0968404263f, 0.0747040287f},
-std::array<float,2>{0.516824722f, 0.429742336f},
-std::array<float,2>{0.448802918f, 0.639347076f},
-std::array<float,2>{0.786353827f, 0.722839653f},
-std::array<float,2>{0.170480579f, 0.482096314f},
-std::array<float,2>{0.716808259f, 0.00895731896f},
-std::array<float,2>{0.301571786f, 0.957753301f},
-std::array<float,2>{0.603888035f, 0.803926229f},
-std::array<float,2>{0.430911183f, 0.185927004f},
-std::array<float,2>{0.947778106f, 0.259279549f},
-std::array<float,2>{0.00400666567f, 0.581967235f},
-std::array<float,2>{0.534274399f, 0.660666347f},
-std::array<float,2>{0.495946854f, 0.387193143f},
-std::array<float,2>{0.92495513f, 0.101843342f},
-std::array<float,2>{0.0871123895f, 0.903889179f},
-std::array<float,2>{0.858507693f, 0.818025887f},
-std::array<float,2>{0.232823655f, 0.195763767f},
-std::array<float,2>{0.626243949f, 0.348609835f},
-std::array<float,2>{0.347517669f, 0.554381669f},
-std::array<float,2>{0.988598645f, 0.604644001f},
-std::array<float,2>{0.0497063436f, 0.307636112f},
-std::array<float,2>{0.592382014f, 0.141497433f},
-std::array<float,2>{0.385394871f, 0.758833349f},
-std::array<float,2>{0.738530219f, 0.978623033f},
-std::array<float,2>{0.270202637f, 0.0366740935f},
-std::array<float,2>{0.780248761f, 0.45560801f},
-std::array<float,2>{0.154592931f, 0.716566026f},
-std::array<float,2>{0.635278046f, 0.63185221f},
-std::array<float,2>{0.353094816f, 0.422979236f},
-std::array<float,2>{0.844789326f, 0.0700030848f},
-std::array<float,2>{0.22318159f, 0.911906362f},
-std::array<float,2>{0.934915781f, 0.869876504f},
-std::array<float,2>{0.0856145248f, 0.238962024f},
-std::array<float,2>{0.543000758f, 0.332314074f},
-std::array<float,2>{0.49019599f, 0.530565679f},
-std::array<float,2>{0.767623425f, 0.58994621f},
-std::array<float,2>{0.140751988f, 0.250732154f},
-std::array<float,2>{0.744326949f, 0.175545439f},
-std::array<float,2>{0.280739188f, 0.809506118f},
-std::array<float,2>{0.578600883f, 0.964673758f},
-std::array<float,2>{0.382100016f, 0.00442856783f},
-std::array<float,2>{0.997726738f, 0.474516928f},
-std::array<float,2>{0.0620843023f, 0.728109062f},
-std::array<float,2>{0.524113655f, 0.560641766f},
-std::array<float,2>{0.440020919f, 0.356678009f},
-std::array<float,2>{0.903952777f, 0.194057867f},
-std::array<float,2>{0.105149113f, 0.823880613f},
-std::array<float,2>{0.837202907f, 0.894411087f},
-std::array<float,2>{0.192719668f, 0.0963322669f},
-std::array<float,2>{0.665575087f, 0.376100332f},
-std::array<float,2>{0.343450904f, 0.671738863f},
-std::array<float,2>{0.940559506f, 0.706032276f},
-std::array<float,2>{0.013759695f, 0.462937623f},
-std::array<float,2>{0.594602942f, 0.0450473167f},
-std::array<float,2>{0.426284492f, 0.97197026f},
-std::array<float,2>{0.709467947f, 0.757464767f},
-std::array<float,2>{0.307336003f, 0.153568044f},
-std::array<float,2>{0.795214474f, 0.298313051f},
-std::array<float,2>{0.158395261f, 0.597808242f},
-std::array<float,2>{0.731985271f, 0.623948514f},
-std::array<float,2>{0.254252881f, 0.288561523f},
-std::array<float,2>{0.760637224f, 0.13994953f},
-std::array<float,2>{0.125767902f, 0.768609643f},
-std::array<float,2>{0.980450511f, 0.992493689f},
-std::array<float,2>{0.0431648642f, 0.0601401553f},
-std::array<float,2>{0.566566825f, 0.440471053f},
-std::array<float,2>{0.398341894f, 0.692652225f},
-std::array<float,2>{0.868851781f, 0.675103188f},
-std::array<float,2>{0.237273797f, 0.396815121f},
-std::array<float,2>{0.655586243f, 0.118700005f},
-std::array<float,2>{0.362870276f, 0.880920351f},
-std::array<float,2>{0.562256038f, 0.837907016f},
-std::array<float,2>{0.477513701f, 0.211281285f},
-std::array<float,2>{0.907415807f, 0.374687403f},
-std::array<float,2>{0.0667241886f, 0.535152197f},
-std::array<float,2>{0.61364305f, 0.735249698f},
-std::array<float,2>{0.421633869f, 0.491246104f},
-std::array<float,2>{0.963901043f, 0.0211746432f},
-std::array<float,2>{0.0295054987f, 0.94762665f},
-std::array<float,2>{0.800071418f, 0.783937097f},
-std::array<float,2>{0.181876436f, 0.168296948f},
-std::array<float,2>{0.699718118f, 0.265755624f},
-std::array<float,2>{0.28234157f, 0.577151716f},
-std::array<float,2>{0.880334496f, 0.511444151f},
-std::array<float,2>{0.124129929f, 0.320192069f},
-std::array<float,2>{0.511746109f, 0.231011152f},
-std::array<float,2>{0.461601585f, 0.850298345f},
-std::array<float,2>{0.675652862f, 0.928280711f},
-std::array<float,2>{0.325691849f, 0.0897766054f},
-std::array<float,2>{0.821444988f, 0.419280112f},
-std::array<float,2>{0.207903519f, 0.654693305f},
-std::array<float,2>{0.684004545f, 0.731927931f},
-std::array<float,2>{0.31649211f, 0.468978286f},
-std::array<float,2>{0.815226674f, 0.00389204361f},
-std::array<float,2>{0.214816749f, 0.966154456f},
-std::array<float,2>{0.88954711f, 0.804799199f},
-std::array<float,2>{0.112812392f, 0.178613916f},
-std::array<float,2>{0.502905607f, 0.254190922f},
-std::array<float,2>{0.45740214f, 0.588292658f},
-std::array<float,2>{0.809465587f, 0.524688005f},
-std::array<float,2>{0.177498043f, 0.328892767f},
-std::array<float,2>{0.693184376f, 0.235075489f},
-std::array<float,2>{0.290884584f, 0.87264955f},
-std::array<float,2>{0.618886828f, 0.910069883f},
-std::array<float,2>{0.409017414f, 0.0663646907f},
-std::array<float,2>{0.955653548f, 0.427993864f},
-std::array<float,2>{0.0189925674f, 0.628799319f},
-std::array<float,2>{0.549565554f, 0.597396195f},
-std::array<float,2>{0.470071048f, 0.302809387f},
-std::array<float,2>{0.917214692f, 0.150693342f},
-std::array<float,2>{0.0777200758f, 0.752523661f},
-std::array<float,2>{0.860464513f, 0.975039959f},
-std::array<float,2>{0.246586516f, 0.0409171544f},
-std::array<float,2>{0.644154191f, 0.46672532f},
-std::array<float,2>{0.374452591f, 0.710592508f},
-std::array<float,2>{0.976017594f, 0.666598201f},
-std::array<float,2>{0.0313315019f, 0.379756689f},
-std::array<float,2>{0.576832294f, 0.100128271f},
-std::array<float,2>{0.404580265f, 0.894644618f},
-std::array<float,2>{0.721011698f, 0.82642132f},
-std::array<float,2>{0.258891076f, 0.189751357f},
-std::array<float,2>{0.751587987f, 0.351949811f},
-std::array<float,2>{0.13447912f, 0.554861009f},
-std::array<float,2>{0.711384952f, 0.538446069f},
-std::array<float,2>{0.297361791f, 0.370282859f},
-std::array<float,2>{0.784668624f, 0.217646986f},
-std::array<float,2>{0.165609136f, 0.841671824f},
-std::array<float,2>{0.950463533f, 0.878371656f},
-std::array<float,2>{0.00156303158f, 0.123239204f},
-std::array<float,2>{0.606172502f, 0.391712368f},
-std::array<float,2>{0.433998346f, 0.676251173f},
-std::array<float,2>{0.833785892f, 0.691384554f},
-std::array<float,2>{0.20052436f, 0.443801105f},
-std::array<float,2>{0.662103355f, 0.0552664585f},
-std::array<float,2>{0.330301672f, 0.996905386f},
-std::array<float,2>{0.520077348f, 0.773393393f},
-std::array<float,2>{0.45142439f, 0.13500993f},
-std::array<float,2>{0.892615497f, 0.283187002f},
-std::array<float,2>{0.100429207f, 0.619193316f},
-std::array<float,2>{0.589655578f, 0.649244726f},
-std::array<float,2>{0.387406021f, 0.414994568f},
-std::array<float,2>{0.984554112f, 0.0910013244f},
-std::array<float,2>{0.0545226447f, 0.924053669f},
-std::array<float,2>{0.776708961f, 0.847038686f},
-std::array<float,2>{0.148933053f, 0.228081927f},
-std::array<float,2>{0.735367775f, 0.31616208f},
-std::array<float,2>{0.267262995f, 0.512171626f},
-std::array<float,2>{0.925808311f, 0.573702753f},
-std::array<float,2>{0.0902389437f, 0.271307737f},
-std::array<float,2>{0.537808001f, 0.165851429f},
-std::array<float,2>{0.499794453f, 0.786260724f},
-std::array<float,2>{0.631129622f, 0.952198088f},
-std::array<float,2>{0.348446429f, 0.0163020268f},
-std::array<float,2>{0.855396688f, 0.487574399f},
-std::array<float,2>{0.226999208f, 0.738663435f},
-std::array<float,2>{0.747973323f, 0.681123734f},
-std::array<float,2>{0.275920898f, 0.398544639f},
-std::array<float,2>{0.771886408f, 0.112958699f},
-std::array<float,2>{0.147568733f, 0.888768494f},
-std::array<float,2>{0.992646813f, 0.835689962f},
-std::array<float,2>{0.0559202582f, 0.203835487f},
-std::array<float,2>{0.585244834f, 0.365306169f},
-std::array<float,2>{0.378473878f, 0.540251911f},
-std::array<float,2>{0.849013805f, 0.616092503f},
-std::array<float,2>{0.221883312f, 0.289369881f},
-std::array<float,2>{0.639829814f, 0.131452382f},
-std::array<float,2>{0.355621606f, 0.781154513f},
-std::array<float,2>{0.540232062f, 0.990765572f},
-std::array<float,2>{0.48580575f, 0.0517213568f},
-std::array<float,2>{0.932470381f, 0.449038148f},
-std::array<float,2>{0.0813100934f, 0.698079467f},
-std::array<float,2>{0.59848237f, 0.502124667f},
-std::array<float,2>{0.42378217f, 0.326415181f},
-std::array<float,2>{0.945138454f, 0.223449126f},
-std::array<float,2>{0.00905450899f, 0.856545627f},
-std::array<float,2>{0.791228771f, 0.931984961f},
-std::array<float,2>{0.163557857f, 0.0840450525f},
-std::array<float,2>{0.705863953f, 0.412556887f},
-std::array<float,2>{0.308772475f, 0.641278028f},
-std::array<float,2>{0.899227858f, 0.748459339f},
-std::array<float,2>{0.106839567f, 0.494473845f},
-std::array<float,2>{0.530847847f, 0.0310089719f},
-std::array<float,2>{0.443398774f, 0.939816236f},
-std::array<float,2>{0.671437323f, 0.792641044f},
-std::array<float,2>{0.339601815f, 0.156964004f},
-std::array<float,2>{0.841491878f, 0.278982073f},
-std::array<float,2>{0.190598488f, 0.562912166f},
-std::array<float,2>{0.652070582f, 0.585411727f},
-std::array<float,2>{0.366745502f, 0.265521914f},
-std::array<float,2>{0.874353886f, 0.182191715f},
-std::array<float,2>{0.238835633f, 0.799413681f},
-std::array<float,2>{0.913516939f, 0.956396282f},
-std::array<float,2>{0.0662917122f, 0.0136756497f},
-std::array<float,2>{0.556853354f, 0.476841509f},
-std::array<float,2>{0.482858241f, 0.718871057f},
-std::array<float,2>{0.76502955f, 0.63316679f},
-std::array<float,2>{0.130957365f, 0.437250793f},
-std::array<float,2>{0.727048099f, 0.071957469f},
-std::array<float,2>{0.252479911f, 0.920365512f},
-std::array<float,2>{0.563374877f, 0.860087872f},
-std::array<float,2>{0.394474953f, 0.245456964f},
-std::array<float,2>{0.98083061f, 0.342815697f},
-std::array<float,2>{0.0424948335f, 0.516698539f},
-std::array<float,2>{0.510132909f, 0.713140786f},
-std::array<float,2>{0.465899855f, 0.4603993f},
-std::array<float,2>{0.875513196f, 0.034435194f},
-std::array<float,2>{0.119196676f, 0.983909309f},
-std::array<float,2>{0.827354848f, 0.764899731f},
-std::array<float,2>{0.206079379f, 0.146115333f},
-std::array<float,2>{0.679144919f, 0.311691672f},
-std::array<float,2>{0.321425527f, 0.60749197f},
-std::array<float,2>{0.967724979f, 0.549563408f},
-std::array<float,2>{0.0255811177f, 0.346694559f},
-std::array<float,2>{0.611904323f, 0.202125311f},
-std::array<float,2>{0.414178491f, 0.81428498f},
-std::array<float,2>{0.696988523f, 0.900322437f},
-std::array<float,2>{0.287812382f, 0.109141618f},
-std::array<float,2>{0.803248286f, 0.384631634f},
-std::array<float,2>{0.183824375f, 0.659061134f},
-std::array<float,2>{0.742123842f, 0.715451777f},
-std::array<float,2>{0.272002041f, 0.456951678f},
-std::array<float,2>{0.777681053f, 0.0352187864f},
-std::array<float,2>{0.154226333f, 0.980178297f},
-std::array<float,2>{0.990669787f, 0.758664668f},
-std::array<float,2>{0.0471871793f, 0.141616791f},
-std::array<float,2>{0.590571463f, 0.307544798f},
-std::array<float,2>{0.384369403f, 0.603990436f},
-std::array<float,2>{0.856090009f, 0.553226352f},
-std::array<float,2>{0.231363878f, 0.348906755f},
-std::array<float,2>{0.628463149f, 0.197101206f},
-std::array<float,2>{0.345392674f, 0.81725198f},
-std::array<float,2>{0.533144116f, 0.903116584f},
-std::array<float,2>{0.493945986f, 0.103349559f},
-std::array<float,2>{0.923028886f, 0.388556272f},
-std::array<float,2>{0.0881339163f, 0.661527932f},
-std::array<float,2>{0.602730691f, 0.580211997f},
-std::array<float,2>{0.433076024f, 0.258532107f},
-std::array<float,2>{0.945597351f, 0.186938003f},
-std::array<float,2>{0.00736049376f, 0.803235173f},
-std::array<float,2>{0.788756132f, 0.958872914f},
-std::array<float,2>{0.169002622f, 0.00835532695f},
-std::array<float,2>{0.71667248f, 0.480530888f},
-std::array<float,2>{0.304004848f, 0.724414587f},
-std::array<float,2>{0.896688759f, 0.640508115f},
-std::array<float,2>{0.0948852226f, 0.431330264f},
-std::array<float,2>{0.517837465f, 0.0754282027f},
-std::array<float,2>{0.445484787f, 0.915904462f},
-std::array<float,2>{0.658104181f, 0.866821706f},
-std::array<float,2>{0.332421422f, 0.247068375f},
-std::array<float,2>{0.829340816f, 0.336981773f},
-std::array<float,2>{0.197721586f, 0.522922277f},
-std::array<float,2>{0.645740032f, 0.505712748f},
-std::array<float,2>{0.3700068f, 0.321893573f},
-std::array<float,2>{0.863314629f, 0.220341638f},
-std::array<float,2>{0.242585376f, 0.852398098f},
-std::array<float,2>{0.919835448f, 0.935682476f},
-std::array<float,2>{0.0713508353f, 0.079955332f},
-std::array<float,2>{0.552080929f, 0.408951133f},
-std::array<float,2>{0.474024445f, 0.646932244f},
-std::array<float,2>{0.757319629f, 0.743225396f},
-std::array<float,2>{0.137232035f, 0.499631405f},
-std::array<float,2>{0.724254966f, 0.0262897443f},
-std::array<float,2>{0.264413387f, 0.945177734f},
-std::array<float,2>{0.571758151f, 0.794724584f},
-std::array<float,2>{0.399826944f, 0.160176322f},
-std::array<float,2>{0.970212579f, 0.274545193f},
-std::array<float,2>{0.0351730026f, 0.568618894f},
-std::array<float,2>{0.505808473f, 0.684350908f},
-std::array<float,2>{0.453551412f, 0.404710352f},
-std::array<float,2>{0.884664357f, 0.117108718f},
-std::array<float,2>{0.116320066f, 0.886134267f},
-std::array<float,2>{0.818490267f, 0.830375552f},
-std::array<float,2>{0.217410058f, 0.207902864f},
-std::array<float,2>{0.68224597f, 0.361426026f},
-std::array<float,2>{0.315073252f, 0.543980062f},
-std::array<float,2>{0.959507883f, 0.613148749f},
-std::array<float,2>{0.0195987094f, 0.294953346f},
-std::array<float,2>{0.623338699f, 0.12797384f},
-std::array<float,2>{0.412527561f, 0.773920536f},
-std::array<float,2>{0.691340208f, 0.986514091f},
-std::array<float,2>{0.296264917f, 0.0476171002f},
-std::array<float,2>{0.806153059f, 0.449773937f},
-std::array<float,2>{0.173603117f, 0.700721085f},
-std::array<float,2>{0.672471821f, 0.655699492f},
-std::array<float,2>{0.327119768f, 0.418331146f},
-std::array<float,2>{0.822380841f, 0.0880632102f},
-std::array<float,2>{0.209335938f, 0.929139495f},
-std::array<float,2>{0.881355822f, 0.850681722f},
-std::array<float,2>{0.122598201f, 0.232164487f},
-std::array<float,2>{0.514938951f, 0.319139063f},
-std::array<float,2>{0.464264184f, 0.509830296f},
-std::array<float,2>{0.797131717f, 0.576466143f},
-std::array<float,2>{0.180242315f, 0.267299771f},
-std::array<float,2>{0.701939642f, 0.169888496f},
-std::array<float,2>{0.28344512f, 0.784234226f},
-std::array<float,2>{0.616678894f, 0.948848307f},
-std::array<float,2>{0.418681204f, 0.0202505086f},
-std::array<float,2>{0.961024284f, 0.490285367f},
-std::array<float,2>{0.0279476941f, 0.736052811f},
-std::array<float,2>{0.559674799f, 0.533511639f},
-std::array<float,2>{0.479587853f, 0.37398091f},
-std::array<float,2>{0.90826124f, 0.212151319f},
-std::array<float,2>{0.069144018f, 0.839642525f},
-std::array<float,2>{0.869552732f, 0.882095873f},
-std::array<float,2>{0.235171095f, 0.11791797f},
-std::array<float,2>{0.653387308f, 0.39793855f},
-std::array<float,2>{0.361110687f, 0.674715698f},
-std::array<float,2>{0.976633728f, 0.692216218f},
-std::array<float,2>{0.0460337363f, 0.440195441f},
-std::array<float,2>{0.568908513f, 0.0586302504f},
-std::array<float,2>{0.396123081f, 0.993392885f},
-std::array<float,2>{0.732519865f, 0.767724276f},
-std::array<float,2>{0.255956888f, 0.138823017f},
-std::array<float,2>{0.759065509f, 0.28795594f},
-std::array<float,2>{0.12857604f, 0.624505043f},
-std::array<float,2>{0.708473563f, 0.599207163f},
-std::array<float,2>{0.306524575f, 0.297214538f},
-std::array<float,2>{0.793931723f, 0.152900532f},
-std::array<float,2>{0.156811431f, 0.756120145f},
-std::array<float,2>{0.938748598f, 0.971654534f},
-std::array<float,2>{0.0129492003f, 0.0461766161f},
-std::array<float,2>{0.597078383f, 0.464766264f},
-std::array<float,2>{0.427898228f, 0.706175327f},
-std::array<float,2>{0.83931452f, 0.670604646f},
-std::array<float,2>{0.194495499f, 0.375278592f},
-std::array<float,2>{0.666608393f, 0.097175546f},
-std::array<float,2>{0.341691017f, 0.893298209f},
-std::array<float,2>{0.526144803f, 0.823235869f},
-std::array<float,2>{0.438365906f, 0.195010304f},
-std::array<float,2>{0.904455662f, 0.356023133f},
-std::array<float,2>{0.102984183f, 0.562243283f},
-std::array<float,2>{0.581749976f, 0.727237761f},
-std::array<float,2>{0.379896611f, 0.473510653f},
-std::array<float,2>{0.998266399f, 0.00549475336f},
-std::array<float,2>{0.0597895049f, 0.962994576f},
-std::array<float,2>{0.766375422f, 0.809755504f},
-std::array<float,2>{0.143841043f, 0.17452392f},
-std::array<float,2>{0.743550301f, 0.251480579f},
-std::array<float,2>{0.279178262f, 0.591500759f},
-std::array<float,2>{0.936669767f, 0.529455543f},
-std::array<float,2>{0.0836065412f, 0.333439052f},
-std::array<float,2>{0.546319067f, 0.23972398f},
-std::array<float,2>{0.491706312f, 0.870334744f},
-std::array<float,2>{0.633557618f, 0.910958946f},
-std::array<float,2>{0.355397463f, 0.0690259114f},
-std::array<float,2>{0.84626013f, 0.422776639f},
-std::array<float,2>{0.22508505f, 0.631139815f},
-std::array<float,2>{0.62999624f, 0.73945272f},
-std::array<float,2>{0.35027197f, 0.486850351f},
-std::array<float,2>{0.851991236f, 0.0169971716f},
-std::array<float,2>{0.230258942f, 0.951852798f},
-std::array<float,2>{0.928693295f, 0.785391808f},
-std::array<float,2>{0.09253674f, 0.164870992f},
-std::array<float,2>{0.536560833f, 0.269652516f},
-std::array<float,2>{0.497835994f, 0.573152065f},
-std::array<float,2>{0.774934649f, 0.513640583f},
-std::array<float,2>{0.151793823f, 0.314643085f},
-std::array<float,2>{0.736779094f, 0.227105707f},
-std::array<float,2>{0.268860221f, 0.846445024f},
-std::array<float,2>{0.586876333f, 0.925263524f},
-std::array<float,2>{0.389885306f, 0.0898739994f},
-std::array<float,2>{0.987157643f, 0.415997744f},
-std::array<float,2>{0.0520534404f, 0.649453044f},
-std::array<float,2>{0.522953391f, 0.620878458f},
-std::array<float,2>{0.449700326f, 0.28148067f},
-std::array<float,2>{0.891297162f, 0.136112243f},
-std::array<float,2>{0.0981263742f, 0.772280693f},
-std::array<float,2>{0.835057497f, 0.997584343f},
-std::array<float,2>{0.201314062f, 0.0557193458f},
-std::array<float,2>{0.662842453f, 0.444409758f},
-std::array<float,2>{0.329271853f, 0.68963635f},
-std::array<float,2>{0.952919066f, 0.676908731f},
-std::array<float,2>{0.0028200103f, 0.391184926f},
-std::array<float,2>{0.608003199f, 0.12426351f},
-std::array<float,2>{0.435890108f, 0.877711773f},
-std::array<float,2>{0.714781523f, 0.840014815f},
-std::array<float,2>{0.298964858f, 0.218670473f},
-std::array<float,2>{0.783007741f, 0.369863749f},
-std::array<float,2>{0.167403281f, 0.537476361f},
-std::array<float,2>{0.720217347f, 0.555692792f},
-std::array<float,2>{0.261625171f, 0.353417873f},
-std::array<float,2>{0.752725184f, 0.19087255f},
-std::array<float,2>{0.135607123f, 0.82789886f},
-std::array<float,2>{0.974102557f, 0.896059036f},
-std::array<float,2>{0.0340004116f, 0.101448871f},
-std::array<float,2>{0.574548364f, 0.380322844f},
-std::array<float,2>{0.403877944f, 0.667356491f},
-std::array<float,2>{0.862677276f, 0.709411919f},
-std::array<float,2>{0.248300359f, 0.465311587f},
-std::array<float,2>{0.642227471f, 0.039889086f},
-std::array<float,2>{0.371438742f, 0.975668013f},
-std::array<float,2>{0.547151148f, 0.753622115f},
-std::array<float,2>{0.472213298f, 0.151843116f},
-std::array<float,2>{0.915258944f, 0.304672301f},
-std::array<float,2>{0.0758522227f, 0.595769346f},
-std::array<float,2>{0.619923353f, 0.627016068f},
-std::array<float,2>{0.407686353f, 0.429094821f},
-std::array<float,2>{0.954914689f, 0.0646757856f},
-std::array<float,2>{0.0156777278f, 0.908715189f},
-std::array<float,2>{0.811436713f, 0.871458173f},
-std::array<float,2>{0.179329753f, 0.235961884f},
-std::array<float,2>{0.694704592f, 0.329683006f},
-std::array<float,2>{0.291670561f, 0.524344146f},
-std::array<float,2>{0.888395905f, 0.588936031f},
-std::array<float,2>{0.110705115f, 0.254970133f},
-std::array<float,2>{0.500388682f, 0.179599822f},
-std::array<float,2>{0.460527927f, 0.806179345f},
-std::array<float,2>{0.687112033f, 0.965218127f},
-std::array<float,2>{0.318658531f, 0.00200667698f},
-std::array<float,2>{0.813708425f, 0.469792455f},
-std::array<float,2>{0.212069169f, 0.731321394f},
-std::array<float,2>{0.698316693f, 0.660096228f},
-std::array<float,2>{0.287002981f, 0.383611351f},
-std::array<float,2>{0.801047206f, 0.107811563f},
-std::array<float,2>{0.186253399f, 0.898448408f},
-std::array<float,2>{0.965274811f, 0.812761962f},
-std::array<float,2>{0.0246783569f, 0.202486083f},
-std::array<float,2>{0.610708654f, 0.3465828f},
-std::array<float,2>{0.416631609f, 0.550319493f},
-std::array<float,2>{0.824537039f, 0.609184146f},
-std::array<float,2>{0.204881236f, 0.31144467f},
-std::array<float,2>{0.677722394f, 0.144976124f},
-std::array<float,2>{0.323982179f, 0.76389426f},
-std::array<float,2>{0.508449316f, 0.982968688f},
-std::array<float,2>{0.468242317f, 0.0339929312f},
-std::array<float,2>{0.87840575f, 0.45899272f},
-std::array<float,2>{0.117697798f, 0.713871658f},
-std::array<float,2>{0.566380441f, 0.516184032f},
-std::array<float,2>{0.391070724f, 0.342324108f},
-std::array<float,2>{0.982582808f, 0.24466835f},
-std::array<float,2>{0.0397256501f, 0.860469043f},
-std::array<float,2>{0.761749268f, 0.92181474f},
-std::array<float,2>{0.129625842f, 0.0708937049f},
-std::array<float,2>{0.729379535f, 0.436425686f},
-std::array<float,2>{0.250330627f, 0.633893549f},
-std::array<float,2>{0.911421001f, 0.720599949f},
-std::array<float,2>{0.0626455173f, 0.478326887f},
-std::array<float,2>{0.556490123f, 0.0152675733f},
-std::array<float,2>{0.480694324f, 0.955244184f},
-std::array<float,2>{0.650308847f, 0.800779819f},
-std::array<float,2>{0.363917023f, 0.182959005f},
-std::array<float,2>{0.872316658f, 0.264259994f},
-std::array<float,2>{0.2410855f, 0.584375024f},
-std::array<float,2>{0.669707894f, 0.563629746f},
-std::array<float,2>{0.337634206f, 0.277945668f},
-std::array<float,2>{0.842784703f, 0.157494992f},
-std::array<float,2>{0.189281598f, 0.791214108f},
-std::array<float,2>{0.900997877f, 0.941218257f},
-std::array<float,2>{0.108492643f, 0.0299300328f},
-std::array<float,2>{0.527635694f, 0.495276242f},
-std::array<float,2>{0.44279024f, 0.749211133f},
-std::array<float,2>{0.790278912f, 0.642357528f},
-std::array<float,2>{0.161240771f, 0.413269907f},
-std::array<float,2>{0.704287052f, 0.0858407691f},
-std::array<float,2>{0.311681688f, 0.93268162f},
-std::array<float,2>{0.600727379f, 0.856179118f},
-std::array<float,2>{0.423841745f, 0.22364907f},
-std::array<float,2>{0.943298399f, 0.32795018f},
-std::array<float,2>{0.011441499f, 0.503200114f},
-std::array<float,2>{0.542385936f, 0.698959589f},
-std::array<float,2>{0.486481518f, 0.447871894f},
-std::array<float,2>{0.929720759f, 0.0520483181f},
-std::array<float,2>{0.0798590407f, 0.991312385f},
-std::array<float,2>{0.851447761f, 0.78000921f},
-std::array<float,2>{0.220559239f, 0.132175818f},
-std::array<float,2>{0.636856079f, 0.290771544f},
-std::array<float,2>{0.357583672f, 0.616293788f},
-std::array<float,2>{0.994725585f, 0.539717555f},
-std::array<float,2>{0.0577889122f, 0.366334647f},
-std::array<float,2>{0.582749188f, 0.204421505f},
-std::array<float,2>{0.375913203f, 0.834831834f},
-std::array<float,2>{0.748141289f, 0.890108168f},
-std::array<float,2>{0.274963379f, 0.111751258f},
-std::array<float,2>{0.770688176f, 0.399762124f},
-std::array<float,2>{0.14590621f, 0.679864526f},
-std::array<float,2>{0.718194783f, 0.724791288f},
-std::array<float,2>{0.301895499f, 0.483560711f},
-std::array<float,2>{0.785777748f, 0.0112174265f},
-std::array<float,2>{0.17116034f, 0.960255444f},
-std::array<float,2>{0.948854744f, 0.801162064f},
-std::array<float,2>{0.00570215471f, 0.184902027f},
-std::array<float,2>{0.605419815f, 0.260956615f},
-std::array<float,2>{0.429715574f, 0.579032063f},
-std::array<float,2>{0.831753135f, 0.520385623f},
-std::array<float,2>{0.196647108f, 0.339321434f},
-std::array<float,2>{0.659718871f, 0.249411136f},
-std::array<float,2>{0.33564204f, 0.864275992f},
-std::array<float,2>{0.516286612f, 0.917782485f},
-std::array<float,2>{0.447435081f, 0.0778608918f},
-std::array<float,2>{0.895577073f, 0.432202578f},
-std::array<float,2>{0.0957523659f, 0.638638735f},
-std::array<float,2>{0.593703866f, 0.602230072f},
-std::array<float,2>{0.386179507f, 0.306572467f},
-std::array<float,2>{0.989860773f, 0.142975494f},
-std::array<float,2>{0.0502580814f, 0.761261344f},
-std::array<float,2>{0.781107247f, 0.978478074f},
-std::array<float,2>{0.155879065f, 0.0384081453f},
-std::array<float,2>{0.739964128f, 0.454795122f},
-std::array<float,2>{0.270843089f, 0.718104005f},
-std::array<float,2>{0.924113214f, 0.662818968f},
-std::array<float,2>{0.0865759775f, 0.388759464f},
-std::array<float,2>{0.533445358f, 0.104814351f},
-std::array<float,2>{0.494745642f, 0.905074f},
-std::array<float,2>{0.625022411f, 0.819065928f},
-std::array<float,2>{0.345997155f, 0.197303236f},
-std::array<float,2>{0.857737422f, 0.35146305f},
-std::array<float,2>{0.23421213f, 0.551458478f},
-std::array<float,2>{0.679923534f, 0.546776175f},
-std::array<float,2>{0.313577861f, 0.360899985f},
-std::array<float,2>{0.81755048f, 0.21083039f},
-std::array<float,2>{0.216304883f, 0.828186989f},
-std::array<float,2>{0.885571837f, 0.884438694f},
-std::array<float,2>{0.114868917f, 0.113789126f},
-std::array<float,2>{0.506006122f, 0.402716219f},
-std::array<float,2>{0.455598742f, 0.685769022f},
-std::array<float,2>{0.807726979f, 0.701376379f},
-std::array<float,2>{0.174779251f, 0.451376051f},
-std::array<float,2>{0.689265311f, 0.0500889122f},
-std::array<float,2>{0.29456526f, 0.986288548f},
-std::array<float,2>{0.622595251f, 0.775393903f},
-std::array<float,2>{0.411891878f, 0.125044674f},
-std::array<float,2>{0.957330704f, 0.294885486f},
-std::array<float,2>{0.0225679018f, 0.610605896f},
-std::array<float,2>{0.552953541f, 0.645345092f},
-std::array<float,2>{0.476419985f, 0.407623023f},
-std::array<float,2>{0.920538068f, 0.0803963095f},
-std::array<float,2>{0.0739881545f, 0.933676898f},
-std::array<float,2>{0.866147816f, 0.854273915f},
-std::array<float,2>{0.244456947f, 0.221195638f},
-std::array<float,2>{0.648059368f, 0.323116899f},
-std::array<float,2>{0.367990166f, 0.506104946f},
-std::array<float,2>{0.972089708f, 0.566878915f},
-std::array<float,2>{0.0385025516f, 0.276901394f},
-std::array<float,2>{0.573383749f, 0.163141116f},
-std::array<float,2>{0.400818855f, 0.795202613f},
-std::array<float,2>{0.725269914f, 0.941492677f},
-std::array<float,2>{0.26301536f, 0.0244371779f},
-std::array<float,2>{0.755555511f, 0.496587425f},
-std::array<float,2>{0.140074089f, 0.745578051f},
-std::array<float,2>{0.655103683f, 0.672218859f},
-std::array<float,2>{0.362120599f, 0.396238148f},
-std::array<float,2>{0.867252231f, 0.119974852f},
-std::array<float,2>{0.237655014f, 0.879068255f},
-std::array<float,2>{0.906280816f, 0.835945964f},
-std::array<float,2>{0.0679746866f, 0.212937862f},
-std::array<float,2>{0.560839772f, 0.37160933f},
-std::array<float,2>{0.477635741f, 0.532392025f},
-std::array<float,2>{0.761304557f, 0.621328771f},
-std::array<float,2>{0.126584858f, 0.286745071f},
-std::array<float,2>{0.731239557f, 0.136888668f},
-std::array<float,2>{0.255045503f, 0.767029107f},
-std::array<float,2>{0.567755818f, 0.995935738f},
-std::array<float,2>{0.397186458f, 0.0608289689f},
-std::array<float,2>{0.978520095f, 0.438052028f},
-std::array<float,2>{0.0449121743f, 0.693712831f},
-std::array<float,2>{0.513376474f, 0.509554744f},
-std::array<float,2>{0.462648004f, 0.316647172f},
-std::array<float,2>{0.879232407f, 0.233313501f},
-std::array<float,2>{0.123130739f, 0.847827733f},
-std::array<float,2>{0.821083009f, 0.926562548f},
-std::array<float,2>{0.208541021f, 0.0877230316f},
-std::array<float,2>{0.674183726f, 0.420107454f},
-std::array<float,2>{0.325066626f, 0.652921617f},
-std::array<float,2>{0.963381469f, 0.737697482f},
-std::array<float,2>{0.0311952941f, 0.48938933f},
-std::array<float,2>{0.615160406f, 0.0225678794f},
-std::array<float,2>{0.420715302f, 0.946729839f},
-std::array<float,2>{0.700540125f, 0.783043146f},
-std::array<float,2>{0.281648785f, 0.170728326f},
-std::array<float,2>{0.799254f, 0.268757731f},
-std::array<float,2>{0.182981178f, 0.575109541f},
-std::array<float,2>{0.74552542f, 0.592964768f},
-std::array<float,2>{0.279655308f, 0.252825737f},
-std::array<float,2>{0.769123614f, 0.17357029f},
-std::array<float,2>{0.142301813f, 0.812033176f},
-std::array<float,2>{0.99703151f, 0.962715089f},
-std::array<float,2>{0.0612751208f, 0.0077664936f},
-std::array<float,2>{0.579175353f, 0.476063043f},
-std::array<float,2>{0.381434321f, 0.73009342f},
-std::array<float,2>{0.844708383f, 0.62955904f},
-std::array<float,2>{0.224274635f, 0.425512344f},
-std::array<float,2>{0.636393726f, 0.0664283037f},
-std::array<float,2>{0.351654947f, 0.912183166f},
-std::array<float,2>{0.544699728f, 0.868649781f},
-std::array<float,2>{0.488679439f, 0.242043987f},
-std::array<float,2>{0.934441924f, 0.33468917f},
-std::array<float,2>{0.0844993219f, 0.527800322f},
-std::array<float,2>{0.595104992f, 0.704046071f},
-std::array<float,2>{0.42735821f, 0.46288076f},
-std::array<float,2>{0.939765811f, 0.0441619828f},
-std::array<float,2>{0.0155172832f, 0.969461143f},
-std::array<float,2>{0.796848118f, 0.754428625f},
-std::array<float,2>{0.159563974f, 0.155465111f},
-std::array<float,2>{0.710621536f, 0.300744414f},
-std::array<float,2>{0.308462977f, 0.600705683f},
-std::array<float,2>{0.903116047f, 0.559229374f},
-std::array<float,2>{0.103966527f, 0.358016729f},
-std::array<float,2>{0.525004387f, 0.19310765f},
-std::array<float,2>{0.441030741f, 0.821463823f},
-std::array<float,2>{0.664541066f, 0.890796244f},
-std::array<float,2>{0.342360586f, 0.0940347165f},
-std::array<float,2>{0.836144209f, 0.378237247f},
-std::array<float,2>{0.191754326f, 0.668442845f},
-std::array<float,2>{0.660909772f, 0.688053906f},
-std::array<float,2>{0.331091523f, 0.441788167f},
-std::array<float,2>{0.832196951f, 0.0582962409f},
-std::array<float,2>{0.199241772f, 0.999833882f},
-std::array<float,2>{0.893794477f, 0.769589245f},
-std::array<float,2>{0.1012576f, 0.134203345f},
-std::array<float,2>{0.52061522f, 0.284637153f},
-std::array<float,2>{0.452305496f, 0.619139314f},
-std::array<float,2>{0.783767164f, 0.536443889f},
-std::array<float,2>{0.164585918f, 0.368127257f},
-std::array<float,2>{0.712519884f, 0.214944094f},
-std::array<float,2>{0.298816562f, 0.843642831f},
-std::array<float,2>{0.60700655f, 0.875670671f},
-std::array<float,2>{0.435516298f, 0.122561224f},
-std::array<float,2>{0.949592769f, 0.3944076f},
-std::array<float,2>{7.34591085e-05f, 0.679570794f},
-std::array<float,2>{0.538961947f, 0.571203887f},
-std::array<float,2>{0.498677969f, 0.272321284f},
-std::array<float,2>{0.927518487f, 0.167233601f},
-std::array<float,2>{0.09163443f, 0.788799882f},
-std::array<float,2>{0.854327857f, 0.949956715f},
-std::array<float,2>{0.228170663f, 0.0183257647f},
-std::array<float,2>{0.632524312f, 0.484565079f},
-std::array<float,2>{0.349185139f, 0.742121398f},
-std::array<float,2>{0.986162245f, 0.650565445f},
-std::array<float,2>{0.053176567f, 0.417381734f},
-std::array<float,2>{0.588659346f, 0.0927785039f},
-std::array<float,2>{0.388503194f, 0.921969056f},
-std::array<float,2>{0.734579802f, 0.844390988f},
-std::array<float,2>{0.266047418f, 0.229966298f},
-std::array<float,2>{0.776143432f, 0.312976241f},
-std::array<float,2>{0.149655133f, 0.515529871f},
-std::array<float,2>{0.691952467f, 0.52687037f},
-std::array<float,2>{0.289758295f, 0.331826806f},
-std::array<float,2>{0.810447216f, 0.237600073f},
-std::array<float,2>{0.17663525f, 0.873326063f},
-std::array<float,2>{0.95646137f, 0.906598687f},
-std::array<float,2>{0.0177933928f, 0.064120166f},
-std::array<float,2>{0.618131518f, 0.426028907f},
-std::array<float,2>{0.410058409f, 0.625128448f},
-std::array<float,2>{0.81569773f, 0.7342363f},
-std::array<float,2>{0.21363312f, 0.471562237f},
-std::array<float,2>{0.685250044f, 0.000472480664f},
-std::array<float,2>{0.317975551f, 0.968311071f},
-std::array<float,2>{0.50294435f, 0.807857096f},
-std::array<float,2>{0.458189368f, 0.177260861f},
-std::array<float,2>{0.890416086f, 0.257589698f},
-std::array<float,2>{0.111419342f, 0.586220682f},
-std::array<float,2>{0.577503622f, 0.665971875f},
-std::array<float,2>{0.405443817f, 0.382373542f},
-std::array<float,2>{0.975173235f, 0.0988673121f},
-std::array<float,2>{0.0328530967f, 0.897985697f},
-std::array<float,2>{0.75029701f, 0.825451672f},
-std::array<float,2>{0.133668438f, 0.187665984f},
-std::array<float,2>{0.722230256f, 0.355436385f},
-std::array<float,2>{0.258159518f, 0.556801677f},
-std::array<float,2>{0.916104555f, 0.594057977f},
-std::array<float,2>{0.0767977163f, 0.301360428f},
-std::array<float,2>{0.550780594f, 0.148769096f},
-std::array<float,2>{0.469309956f, 0.751114547f},
-std::array<float,2>{0.643114448f, 0.973997772f},
-std::array<float,2>{0.373082846f, 0.0420281477f},
-std::array<float,2>{0.859708726f, 0.467846781f},
-std::array<float,2>{0.247547671f, 0.70893389f},
-std::array<float,2>{0.728009701f, 0.636686027f},
-std::array<float,2>{0.25345093f, 0.433725208f},
-std::array<float,2>{0.763676345f, 0.0735204518f},
-std::array<float,2>{0.132324159f, 0.918153167f},
-std::array<float,2>{0.982239604f, 0.861745417f},
-std::array<float,2>{0.0411733016f, 0.242595226f},
-std::array<float,2>{0.564320028f, 0.340557963f},
-std::array<float,2>{0.393527448f, 0.519289792f},
-std::array<float,2>{0.873858094f, 0.583670616f},
-std::array<float,2>{0.239449486f, 0.263191313f},
-std::array<float,2>{0.650463223f, 0.180747077f},
-std::array<float,2>{0.36532858f, 0.797075689f},
-std::array<float,2>{0.5577389f, 0.954321384f},
-std::array<float,2>{0.483718216f, 0.0136701046f},
-std::array<float,2>{0.912801981f, 0.480332971f},
-std::array<float,2>{0.0652304292f, 0.722153008f},
-std::array<float,2>{0.613058269f, 0.547367811f},
-std::array<float,2>{0.415440381f, 0.345353067f},
-std::array<float,2>{0.968407989f, 0.200447232f},
-std::array<float,2>{0.0263753589f, 0.815031648f},
-std::array<float,2>{0.803935885f, 0.900785446f},
-std::array<float,2>{0.185070544f, 0.106247731f},
-std::array<float,2>{0.696240723f, 0.384946823f},
-std::array<float,2>{0.288086921f, 0.657756805f},
-std::array<float,2>{0.876760125f, 0.712531209f},
-std::array<float,2>{0.120446131f, 0.458630472f},
-std::array<float,2>{0.510946989f, 0.03177163f},
-std::array<float,2>{0.465213805f, 0.98168391f},
-std::array<float,2>{0.678442359f, 0.763452828f},
-std::array<float,2>{0.320455074f, 0.14743726f},
-std::array<float,2>{0.826611876f, 0.310231656f},
-std::array<float,2>{0.205916598f, 0.606860042f},
-std::array<float,2>{0.638877451f, 0.614755809f},
-std::array<float,2>{0.357075363f, 0.291401535f},
-std::array<float,2>{0.847875774f, 0.130457178f},
-std::array<float,2>{0.221452206f, 0.778563559f},
-std::array<float,2>{0.932955384f, 0.989700317f},
-std::array<float,2>{0.08097855f, 0.0534414537f},
-std::array<float,2>{0.539448082f, 0.446509987f},
-std::array<float,2>{0.485146105f, 0.696212709f},
-std::array<float,2>{0.772608757f, 0.681767881f},
-std::array<float,2>{0.147050902f, 0.401964724f},
-std::array<float,2>{0.746100068f, 0.110216729f},
-std::array<float,2>{0.27667141f, 0.886804581f},
-std::array<float,2>{0.58458519f, 0.832607567f},
-std::array<float,2>{0.377445549f, 0.205552235f},
-std::array<float,2>{0.993671298f, 0.363942951f},
-std::array<float,2>{0.0548265837f, 0.541854501f},
-std::array<float,2>{0.529529512f, 0.746879637f},
-std::array<float,2>{0.444973201f, 0.492439121f},
-std::array<float,2>{0.899705946f, 0.0286446009f},
-std::array<float,2>{0.105641231f, 0.937545002f},
-std::array<float,2>{0.839936256f, 0.790491581f},
-std::array<float,2>{0.189788237f, 0.160037205f},
-std::array<float,2>{0.670183063f, 0.279634148f},
-std::array<float,2>{0.338833749f, 0.566003561f},
-std::array<float,2>{0.943558812f, 0.501073897f},
-std::array<float,2>{0.00840555225f, 0.325875968f},
-std::array<float,2>{0.598855495f, 0.22510983f},
-std::array<float,2>{0.422145456f, 0.858485043f},
-std::array<float,2>{0.70623976f, 0.931150556f},
-std::array<float,2>{0.309910685f, 0.0827647895f},
-std::array<float,2>{0.79223609f, 0.411545843f},
-std::array<float,2>{0.162373573f, 0.644105792f},
-std::array<float,2>{0.736569107f, 0.740495324f},
-std::array<float,2>{0.268621802f, 0.485720009f},
-std::array<float,2>{0.775212348f, 0.0187544711f},
-std::array<float,2>{0.151512951f, 0.951163471f},
-std::array<float,2>{0.986942768f, 0.787555993f},
-std::array<float,2>{0.0517738871f, 0.166190401f},
-std::array<float,2>{0.586581588f, 0.273078144f},
-std::array<float,2>{0.389992237f, 0.572254717f},
-std::array<float,2>{0.851727366f, 0.514590383f},
-std::array<float,2>{0.230111107f, 0.313726813f},
-std::array<float,2>{0.630163193f, 0.228729084f},
-std::array<float,2>{0.350530922f, 0.844920039f},
-std::array<float,2>{0.536312819f, 0.923268735f},
-std::array<float,2>{0.497661144f, 0.0921890438f},
-std::array<float,2>{0.928328156f, 0.416188091f},
-std::array<float,2>{0.0925058648f, 0.652085304f},
-std::array<float,2>{0.608192205f, 0.617748737f},
-std::array<float,2>{0.435570091f, 0.283497214f},
-std::array<float,2>{0.952673674f, 0.133273512f},
-std::array<float,2>{0.00251319469f, 0.77144748f},
-std::array<float,2>{0.782755435f, 0.99812007f},
-std::array<float,2>{0.167042464f, 0.057096459f},
-std::array<float,2>{0.714536071f, 0.442889482f},
-std::array<float,2>{0.299257308f, 0.68876493f},
-std::array<float,2>{0.891471922f, 0.677834272f},
-std::array<float,2>{0.0977360383f, 0.393175215f},
-std::array<float,2>{0.52320087f, 0.121502563f},
-std::array<float,2>{0.449459702f, 0.876337349f},
-std::array<float,2>{0.662795246f, 0.842091978f},
-std::array<float,2>{0.329488695f, 0.216313764f},
-std::array<float,2>{0.835232556f, 0.368520617f},
-std::array<float,2>{0.201615021f, 0.536038697f},
-std::array<float,2>{0.642398536f, 0.558574259f},
-std::array<float,2>{0.37123394f, 0.35440889f},
-std::array<float,2>{0.862334251f, 0.188757375f},
-std::array<float,2>{0.248179704f, 0.824583054f},
-std::array<float,2>{0.915497899f, 0.897097766f},
-std::array<float,2>{0.0759869739f, 0.0983942673f},
-std::array<float,2>{0.546980977f, 0.381819725f},
-std::array<float,2>{0.47260654f, 0.664735973f},
-std::array<float,2>{0.752520502f, 0.708001733f},
-std::array<float,2>{0.13526237f, 0.467568874f},
-std::array<float,2>{0.720596194f, 0.0415536016f},
-std::array<float,2>{0.261399001f, 0.97315377f},
-std::array<float,2>{0.574243605f, 0.750465691f},
-std::array<float,2>{0.404291481f, 0.149945423f},
-std::array<float,2>{0.973739386f, 0.302267522f},
-std::array<float,2>{0.0338102765f, 0.595340431f},
-std::array<float,2>{0.500077724f, 0.626644015f},
-std::array<float,2>{0.460734189f, 0.426870763f},
-std::array<float,2>{0.888489187f, 0.0633758605f},
-std::array<float,2>{0.110455513f, 0.908037722f},
-std::array<float,2>{0.813748062f, 0.874081552f},
-std::array<float,2>{0.212401345f, 0.237025544f},
-std::array<float,2>{0.687458217f, 0.330113351f},
-std::array<float,2>{0.318394691f, 0.525952995f},
-std::array<float,2>{0.954728186f, 0.587045729f},
-std::array<float,2>{0.0161043406f, 0.256020933f},
-std::array<float,2>{0.619709909f, 0.176490009f},
-std::array<float,2>{0.407468677f, 0.807496071f},
-std::array<float,2>{0.694503307f, 0.967473745f},
-std::array<float,2>{0.291949987f, 0.00185905234f},
-std::array<float,2>{0.811189592f, 0.472163111f},
-std::array<float,2>{0.179622084f, 0.733076036f},
-std::array<float,2>{0.677485526f, 0.656931818f},
-std::array<float,2>{0.32385993f, 0.386160553f},
-std::array<float,2>{0.824359238f, 0.106945619f},
-std::array<float,2>{0.20470348f, 0.901504159f},
-std::array<float,2>{0.878088117f, 0.816164553f},
-std::array<float,2>{0.118051194f, 0.200190827f},
-std::array<float,2>{0.508741677f, 0.34450075f},
-std::array<float,2>{0.468002528f, 0.548090816f},
-std::array<float,2>{0.800842762f, 0.605814397f},
-std::array<float,2>{0.186320603f, 0.308795363f},
-std::array<float,2>{0.698594034f, 0.147586793f},
-std::array<float,2>{0.286671162f, 0.761990547f},
-std::array<float,2>{0.610577524f, 0.981439292f},
-std::array<float,2>{0.416822731f, 0.0324225053f},
-std::array<float,2>{0.964972258f, 0.457973927f},
-std::array<float,2>{0.0246323571f, 0.711198509f},
-std::array<float,2>{0.55629313f, 0.517702579f},
-std::array<float,2>{0.480866998f, 0.340878069f},
-std::array<float,2>{0.911186337f, 0.243702114f},
-std::array<float,2>{0.0627717525f, 0.862877548f},
-std::array<float,2>{0.872247279f, 0.919816196f},
-std::array<float,2>{0.240784213f, 0.0726836324f},
-std::array<float,2>{0.650022149f, 0.43514809f},
-std::array<float,2>{0.364068508f, 0.635513246f},
-std::array<float,2>{0.982832909f, 0.721520126f},
-std::array<float,2>{0.040008273f, 0.479249924f},
-std::array<float,2>{0.566046774f, 0.0122086061f},
-std::array<float,2>{0.390695572f, 0.953648865f},
-std::array<float,2>{0.729013562f, 0.798407018f},
-std::array<float,2>{0.250147194f, 0.179968804f},
-std::array<float,2>{0.762115061f, 0.262313962f},
-std::array<float,2>{0.129639417f, 0.58224982f},
-std::array<float,2>{0.704512775f, 0.565246224f},
-std::array<float,2>{0.311870486f, 0.280967742f},
-std::array<float,2>{0.790451109f, 0.158688888f},
-std::array<float,2>{0.161563754f, 0.789832354f},
-std::array<float,2>{0.942997754f, 0.938744187f},
-std::array<float,2>{0.0115225706f, 0.0281095598f},
-std::array<float,2>{0.600832462f, 0.493380874f},
-std::array<float,2>{0.424105495f, 0.747934818f},
-std::array<float,2>{0.843060791f, 0.642777562f},
-std::array<float,2>{0.189061493f, 0.41017735f},
-std::array<float,2>{0.669460714f, 0.0835046247f},
-std::array<float,2>{0.337785304f, 0.92990768f},
-std::array<float,2>{0.527415335f, 0.857684791f},
-std::array<float,2>{0.442584902f, 0.226401389f},
-std::array<float,2>{0.901264548f, 0.324302882f},
-std::array<float,2>{0.108802378f, 0.500645339f},
-std::array<float,2>{0.582905173f, 0.696407497f},
-std::array<float,2>{0.375528872f, 0.445752263f},
-std::array<float,2>{0.995062828f, 0.0542159453f},
-std::array<float,2>{0.0579801239f, 0.989189684f},
-std::array<float,2>{0.770881236f, 0.777902007f},
-std::array<float,2>{0.145578563f, 0.129812792f},
-std::array<float,2>{0.748506129f, 0.292007953f},
-std::array<float,2>{0.275162727f, 0.61370784f},
-std::array<float,2>{0.930128932f, 0.542288721f},
-std::array<float,2>{0.0798062384f, 0.364544243f},
-std::array<float,2>{0.542156577f, 0.206954926f},
-std::array<float,2>{0.486586332f, 0.833336949f},
-std::array<float,2>{0.637027144f, 0.887930095f},
-std::array<float,2>{0.357852668f, 0.111065529f},
-std::array<float,2>{0.851121187f, 0.400432318f},
-std::array<float,2>{0.22037898f, 0.683383763f},
-std::array<float,2>{0.628862321f, 0.716917276f},
-std::array<float,2>{0.345583439f, 0.453832626f},
-std::array<float,2>{0.856291533f, 0.0372490995f},
-std::array<float,2>{0.231139258f, 0.977102876f},
-std::array<float,2>{0.92319411f, 0.76047194f},
-std::array<float,2>{0.0881909132f, 0.143972352f},
-std::array<float,2>{0.532786012f, 0.305434734f},
-std::array<float,2>{0.493860155f, 0.602605104f},
-std::array<float,2>{0.777416706f, 0.551949978f},
-std::array<float,2>{0.154006675f, 0.349656403f},
-std::array<float,2>{0.741878092f, 0.198982835f},
-std::array<float,2>{0.272406578f, 0.819606066f},
-std::array<float,2>{0.590775847f, 0.905695736f},
-std::array<float,2>{0.384748966f, 0.104315363f},
-std::array<float,2>{0.990368187f, 0.390188158f},
-std::array<float,2>{0.0468958393f, 0.663954616f},
-std::array<float,2>{0.517663538f, 0.579490185f},
-std::array<float,2>{0.445719749f, 0.259942234f},
-std::array<float,2>{0.89694488f, 0.184286237f},
-std::array<float,2>{0.0950634107f, 0.80176127f},
-std::array<float,2>{0.829587162f, 0.959105849f},
-std::array<float,2>{0.197450802f, 0.0103729367f},
-std::array<float,2>{0.657793701f, 0.482929885f},
-std::array<float,2>{0.33209005f, 0.726298392f},
-std::array<float,2>{0.945387006f, 0.636923432f},
-std::array<float,2>{0.00766843837f, 0.433304816f},
-std::array<float,2>{0.602901876f, 0.0768314153f},
-std::array<float,2>{0.432716817f, 0.916147888f},
-std::array<float,2>{0.716550589f, 0.863968551f},
-std::array<float,2>{0.303907454f, 0.248943806f},
-std::array<float,2>{0.788984239f, 0.337897301f},
-std::array<float,2>{0.169268489f, 0.521459877f},
-std::array<float,2>{0.724552572f, 0.507694125f},
-std::array<float,2>{0.264207184f, 0.32371974f},
-std::array<float,2>{0.757043898f, 0.221724436f},
-std::array<float,2>{0.1375736f, 0.854892015f},
-std::array<float,2>{0.969841123f, 0.935474813f},
-std::array<float,2>{0.0354800895f, 0.0820005909f},
-std::array<float,2>{0.571400404f, 0.406371683f},
-std::array<float,2>{0.39959681f, 0.646154404f},
-std::array<float,2>{0.86352694f, 0.744680882f},
-std::array<float,2>{0.242354855f, 0.497219354f},
-std::array<float,2>{0.645873427f, 0.0238955505f},
-std::array<float,2>{0.369775981f, 0.942447305f},
-std::array<float,2>{0.551907003f, 0.796482265f},
-std::array<float,2>{0.473797858f, 0.162385911f},
-std::array<float,2>{0.91957444f, 0.275853306f},
-std::array<float,2>{0.071553573f, 0.567511499f},
-std::array<float,2>{0.623103082f, 0.687305272f},
-std::array<float,2>{0.412316293f, 0.404031575f},
-std::array<float,2>{0.959861934f, 0.114716657f},
-std::array<float,2>{0.0199795831f, 0.883361638f},
-std::array<float,2>{0.806452692f, 0.829443753f},
-std::array<float,2>{0.173552036f, 0.209443524f},
-std::array<float,2>{0.690973103f, 0.359412998f},
-std::array<float,2>{0.296043962f, 0.545286298f},
-std::array<float,2>{0.884453654f, 0.609724164f},
-std::array<float,2>{0.116666079f, 0.293114454f},
-std::array<float,2>{0.505453646f, 0.126837626f},
-std::array<float,2>{0.453129917f, 0.777114034f},
-std::array<float,2>{0.682384551f, 0.984692931f},
-std::array<float,2>{0.315192491f, 0.0497115478f},
-std::array<float,2>{0.81872344f, 0.452577829f},
-std::array<float,2>{0.217611015f, 0.702597141f},
-std::array<float,2>{0.701891422f, 0.654116988f},
-std::array<float,2>{0.283565313f, 0.42135933f},
-std::array<float,2>{0.797029912f, 0.0863928497f},
-std::array<float,2>{0.180491269f, 0.927305222f},
-std::array<float,2>{0.961366236f, 0.849374175f},
-std::array<float,2>{0.0282145292f, 0.233763635f},
-std::array<float,2>{0.616330922f, 0.317817032f},
-std::array<float,2>{0.418841273f, 0.508055151f},
-std::array<float,2>{0.822567403f, 0.575505555f},
-std::array<float,2>{0.209068164f, 0.267802626f},
-std::array<float,2>{0.672701061f, 0.171565011f},
-std::array<float,2>{0.326886892f, 0.781326711f},
-std::array<float,2>{0.514743209f, 0.945591807f},
-std::array<float,2>{0.46410653f, 0.0224005133f},
-std::array<float,2>{0.881696641f, 0.4891105f},
-std::array<float,2>{0.122860469f, 0.736710727f},
-std::array<float,2>{0.56923908f, 0.531373143f},
-std::array<float,2>{0.396423995f, 0.372982621f},
-std::array<float,2>{0.976900518f, 0.214051932f},
-std::array<float,2>{0.0462733433f, 0.837146044f},
-std::array<float,2>{0.75900805f, 0.880695999f},
-std::array<float,2>{0.128681123f, 0.120530725f},
-std::array<float,2>{0.732673287f, 0.395326942f},
-std::array<float,2>{0.256134659f, 0.673324168f},
-std::array<float,2>{0.908660948f, 0.694617033f},
-std::array<float,2>{0.0689263791f, 0.438786209f},
-std::array<float,2>{0.559820235f, 0.0617473796f},
-std::array<float,2>{0.479881674f, 0.994143724f},
-std::array<float,2>{0.653594971f, 0.765935481f},
-std::array<float,2>{0.361049265f, 0.137716621f},
-std::array<float,2>{0.869230092f, 0.286003143f},
-std::array<float,2>{0.235007718f, 0.623001397f},
-std::array<float,2>{0.666986287f, 0.599729657f},
-std::array<float,2>{0.341510922f, 0.29974702f},
-std::array<float,2>{0.838873684f, 0.154544532f},
-std::array<float,2>{0.194801435f, 0.75570637f},
-std::array<float,2>{0.904666722f, 0.97032851f},
-std::array<float,2>{0.102734201f, 0.0433907658f},
-std::array<float,2>{0.526067376f, 0.460949302f},
-std::array<float,2>{0.438095957f, 0.704107106f},
-std::array<float,2>{0.793519676f, 0.669431269f},
-std::array<float,2>{0.157124177f, 0.377140135f},
-std::array<float,2>{0.708192408f, 0.0956008881f},
-std::array<float,2>{0.306277663f, 0.892254353f},
-std::array<float,2>{0.596801102f, 0.820319653f},
-std::array<float,2>{0.42810753f, 0.191866606f},
-std::array<float,2>{0.93855834f, 0.3592453f},
-std::array<float,2>{0.0128547559f, 0.560448229f},
-std::array<float,2>{0.546102762f, 0.729171515f},
-std::array<float,2>{0.491998941f, 0.474666893f},
-std::array<float,2>{0.937008977f, 0.0063361167f},
-std::array<float,2>{0.0838404149f, 0.961616397f},
-std::array<float,2>{0.846670687f, 0.811264098f},
-std::array<float,2>{0.224744588f, 0.17211999f},
-std::array<float,2>{0.633500099f, 0.253555208f},
-std::array<float,2>{0.355114967f, 0.592232049f},
-std::array<float,2>{0.998321354f, 0.528321326f},
-std::array<float,2>{0.060038399f, 0.335653156f},
-std::array<float,2>{0.582012892f, 0.240552828f},
-std::array<float,2>{0.38023594f, 0.867801011f},
-std::array<float,2>{0.743299663f, 0.91365093f},
-std::array<float,2>{0.278912276f, 0.0681421533f},
-std::array<float,2>{0.766221642f, 0.424480557f},
-std::array<float,2>{0.143719256f, 0.629975438f},
-std::array<float,2>{0.712813854f, 0.690567553f},
-std::array<float,2>{0.298416644f, 0.443986505f},
-std::array<float,2>{0.784167528f, 0.0551144853f},
-std::array<float,2>{0.164876133f, 0.996261418f},
-std::array<float,2>{0.949244499f, 0.772747874f},
-std::array<float,2>{0.000365861721f, 0.135458335f},
-std::array<float,2>{0.607342184f, 0.282404006f},
-std::array<float,2>{0.435102284f, 0.619949281f},
-std::array<float,2>{0.832485855f, 0.538980186f},
-std::array<float,2>{0.199535489f, 0.370655894f},
-std::array<float,2>{0.66076237f, 0.217155129f},
-std::array<float,2>{0.331381828f, 0.840987802f},
-std::array<float,2>{0.520765722f, 0.878467917f},
-std::array<float,2>{0.45261234f, 0.12397971f},
-std::array<float,2>{0.893895924f, 0.392151266f},
-std::array<float,2>{0.101346761f, 0.676563501f},
-std::array<float,2>{0.588540077f, 0.573818445f},
-std::array<float,2>{0.388210386f, 0.270825028f},
-std::array<float,2>{0.985901117f, 0.165345594f},
-std::array<float,2>{0.0529004559f, 0.786920249f},
-std::array<float,2>{0.776112914f, 0.953120947f},
-std::array<float,2>{0.14973855f, 0.0156800244f},
-std::array<float,2>{0.734733045f, 0.487799734f},
-std::array<float,2>{0.265813082f, 0.738987267f},
-std::array<float,2>{0.927336931f, 0.648894191f},
-std::array<float,2>{0.0914448425f, 0.414265215f},
-std::array<float,2>{0.538611889f, 0.091616787f},
-std::array<float,2>{0.498956889f, 0.924627542f},
-std::array<float,2>{0.632711649f, 0.847568452f},
-std::array<float,2>{0.349377483f, 0.227541819f},
-std::array<float,2>{0.854073942f, 0.31571269f},
-std::array<float,2>{0.228437141f, 0.512643456f},
-std::array<float,2>{0.68531394f, 0.525096834f},
-std::array<float,2>{0.318309158f, 0.328146696f},
-std::array<float,2>{0.815476954f, 0.234727159f},
-std::array<float,2>{0.213393092f, 0.872328997f},
-std::array<float,2>{0.890308142f, 0.909193516f},
-std::array<float,2>{0.111693352f, 0.0654835701f},
-std::array<float,2>{0.503229439f, 0.428284675f},
-std::array<float,2>{0.458483875f, 0.628279924f},
-std::array<float,2>{0.810251653f, 0.732176363f},
-std::array<float,2>{0.176476523f, 0.469368279f},
-std::array<float,2>{0.692150772f, 0.00341064902f},
-std::array<float,2>{0.289952934f, 0.966541767f},
-std::array<float,2>{0.617813528f, 0.805511415f},
-std::array<float,2>{0.409684271f, 0.17814292f},
-std::array<float,2>{0.956284225f, 0.254819155f},
-std::array<float,2>{0.0180571917f, 0.58846128f},
-std::array<float,2>{0.550465226f, 0.666037738f},
-std::array<float,2>{0.469559968f, 0.379377961f},
-std::array<float,2>{0.91629231f, 0.100011408f},
-std::array<float,2>{0.0770689696f, 0.895289898f},
-std::array<float,2>{0.859563172f, 0.827114165f},
-std::array<float,2>{0.247156724f, 0.190266162f},
-std::array<float,2>{0.64344573f, 0.352390349f},
-std::array<float,2>{0.373351395f, 0.555484116f},
-std::array<float,2>{0.975509167f, 0.596812487f},
-std::array<float,2>{0.0330752134f, 0.303305924f},
-std::array<float,2>{0.577357948f, 0.150975928f},
-std::array<float,2>{0.405727863f, 0.752219975f},
-std::array<float,2>{0.722450852f, 0.975270987f},
-std::array<float,2>{0.258016139f, 0.0404516533f},
-std::array<float,2>{0.750138462f, 0.465916991f},
-std::array<float,2>{0.13339144f, 0.710135281f},
-std::array<float,2>{0.650667548f, 0.633486092f},
-std::array<float,2>{0.365708828f, 0.436793476f},
-std::array<float,2>{0.873641312f, 0.0715885088f},
-std::array<float,2>{0.239563823f, 0.920570254f},
-std::array<float,2>{0.913063169f, 0.859730422f},
-std::array<float,2>{0.0649699643f, 0.245765984f},
-std::array<float,2>{0.558045268f, 0.343527883f},
-std::array<float,2>{0.483591974f, 0.517456353f},
-std::array<float,2>{0.763967752f, 0.585872293f},
-std::array<float,2>{0.131897286f, 0.26507917f},
-std::array<float,2>{0.727628946f, 0.181831509f},
-std::array<float,2>{0.253803939f, 0.799089968f},
-std::array<float,2>{0.564143777f, 0.956827343f},
-std::array<float,2>{0.393128991f, 0.0142154656f},
-std::array<float,2>{0.98213315f, 0.477239788f},
-std::array<float,2>{0.0413948558f, 0.719647706f},
-std::array<float,2>{0.511138141f, 0.549124241f},
-std::array<float,2>{0.46501559f, 0.347190231f},
-std::array<float,2>{0.876567304f, 0.201432899f},
-std::array<float,2>{0.120171249f, 0.813651562f},
-std::array<float,2>{0.826206803f, 0.899812877f},
-std::array<float,2>{0.205774277f, 0.10849148f},
-std::array<float,2>{0.67865634f, 0.383831382f},
-std::array<float,2>{0.320605218f, 0.658363461f},
-std::array<float,2>{0.968643963f, 0.713533342f},
-std::array<float,2>{0.0267828405f, 0.46077016f},
-std::array<float,2>{0.612858951f, 0.0348578244f},
-std::array<float,2>{0.415048867f, 0.983449101f},
-std::array<float,2>{0.695806205f, 0.765414953f},
-std::array<float,2>{0.288517296f, 0.14559947f},
-std::array<float,2>{0.804178059f, 0.312173456f},
-std::array<float,2>{0.185441732f, 0.607935071f},
-std::array<float,2>{0.746470153f, 0.615393043f},
-std::array<float,2>{0.276446193f, 0.290008634f},
-std::array<float,2>{0.772724569f, 0.131289557f},
-std::array<float,2>{0.14742665f, 0.780593216f},
-std::array<float,2>{0.994059801f, 0.990590453f},
-std::array<float,2>{0.0549498536f, 0.0509167463f},
-std::array<float,2>{0.584720135f, 0.448495477f},
-std::array<float,2>{0.377738863f, 0.697612822f},
-std::array<float,2>{0.848125398f, 0.681550324f},
-std::array<float,2>{0.221303686f, 0.399095714f},
-std::array<float,2>{0.638980091f, 0.112431474f},
-std::array<float,2>{0.357288748f, 0.889493465f},
-std::array<float,2>{0.539208949f, 0.835253656f},
-std::array<float,2>{0.485092968f, 0.203523636f},
-std::array<float,2>{0.932855129f, 0.366162032f},
-std::array<float,2>{0.0805989057f, 0.540674806f},
-std::array<float,2>{0.599089861f, 0.748924911f},
-std::array<float,2>{0.42207709f, 0.494771957f},
-std::array<float,2>{0.943839192f, 0.0306120645f},
-std::array<float,2>{0.00862989761f, 0.940411329f},
-std::array<float,2>{0.792241275f, 0.792095542f},
-std::array<float,2>{0.162211359f, 0.156427577f},
-std::array<float,2>{0.70653528f, 0.278733999f},
-std::array<float,2>{0.30965361f, 0.563385129f},
-std::array<float,2>{0.899562955f, 0.50268054f},
-std::array<float,2>{0.10572236f, 0.326746523f},
-std::array<float,2>{0.529592037f, 0.222984448f},
-std::array<float,2>{0.445295632f, 0.857077181f},
-std::array<float,2>{0.670084834f, 0.932358682f},
-std::array<float,2>{0.33855173f, 0.0844921768f},
-std::array<float,2>{0.840297163f, 0.412793338f},
-std::array<float,2>{0.189631358f, 0.640999675f},
-std::array<float,2>{0.659990251f, 0.723389328f},
-std::array<float,2>{0.335781783f, 0.481894642f},
-std::array<float,2>{0.831835866f, 0.00965926889f},
-std::array<float,2>{0.196317583f, 0.957236886f},
-std::array<float,2>{0.895758867f, 0.804386139f},
-std::array<float,2>{0.0960447714f, 0.186388254f},
-std::array<float,2>{0.516599953f, 0.258924067f},
-std::array<float,2>{0.447557777f, 0.581359982f},
-std::array<float,2>{0.785909235f, 0.522451222f},
-std::array<float,2>{0.171132013f, 0.336033046f},
-std::array<float,2>{0.71778214f, 0.24768889f},
-std::array<float,2>{0.302029282f, 0.865596354f},
-std::array<float,2>{0.605149746f, 0.914636552f},
-std::array<float,2>{0.430093467f, 0.0749483556f},
-std::array<float,2>{0.949010134f, 0.430626005f},
-std::array<float,2>{0.00538001629f, 0.638898492f},
-std::array<float,2>{0.533670962f, 0.605202079f},
-std::array<float,2>{0.495071232f, 0.308572352f},
-std::array<float,2>{0.923905969f, 0.140818134f},
-std::array<float,2>{0.0868803188f, 0.759576499f},
-std::array<float,2>{0.857498348f, 0.979329169f},
-std::array<float,2>{0.233912453f, 0.0363901071f},
-std::array<float,2>{0.625460446f, 0.455393285f},
-std::array<float,2>{0.345773131f, 0.715887725f},
-std::array<float,2>{0.990169048f, 0.6603688f},
-std::array<float,2>{0.0498405993f, 0.387608916f},
-std::array<float,2>{0.593411744f, 0.10233409f},
-std::array<float,2>{0.385881066f, 0.903751612f},
-std::array<float,2>{0.740129411f, 0.817641675f},
-std::array<float,2>{0.270544857f, 0.196110889f},
-std::array<float,2>{0.780900419f, 0.347820252f},
-std::array<float,2>{0.156077251f, 0.554029942f},
-std::array<float,2>{0.688992143f, 0.543021023f},
-std::array<float,2>{0.294796079f, 0.362646103f},
-std::array<float,2>{0.807990313f, 0.208128527f},
-std::array<float,2>{0.174518049f, 0.831618071f},
-std::array<float,2>{0.957267046f, 0.884833336f},
-std::array<float,2>{0.0229235869f, 0.1162007f},
-std::array<float,2>{0.62291038f, 0.406099111f},
-std::array<float,2>{0.411797911f, 0.68500787f},
-std::array<float,2>{0.817776382f, 0.699330688f},
-std::array<float,2>{0.21606344f, 0.450740099f},
-std::array<float,2>{0.679999292f, 0.0479743518f},
-std::array<float,2>{0.313750297f, 0.988200605f},
-std::array<float,2>{0.506284535f, 0.774683416f},
-std::array<float,2>{0.45603177f, 0.127683207f},
-std::array<float,2>{0.885364115f, 0.296491832f},
-std::array<float,2>{0.115088262f, 0.612221539f},
-std::array<float,2>{0.573582947f, 0.648079336f},
-std::array<float,2>{0.400462449f, 0.409768373f},
-std::array<float,2>{0.971857786f, 0.0785644203f},
-std::array<float,2>{0.0383226238f, 0.937145829f},
-std::array<float,2>{0.755760491f, 0.853446186f},
-std::array<float,2>{0.139692634f, 0.219171375f},
-std::array<float,2>{0.72541821f, 0.320574611f},
-std::array<float,2>{0.262877226f, 0.504209578f},
-std::array<float,2>{0.92071408f, 0.569394112f},
-std::array<float,2>{0.0739437342f, 0.274220645f},
-std::array<float,2>{0.552993178f, 0.161271781f},
-std::array<float,2>{0.476237118f, 0.793865323f},
-std::array<float,2>{0.648335636f, 0.943663359f},
-std::array<float,2>{0.367848814f, 0.0270614605f},
-std::array<float,2>{0.86582917f, 0.498272717f},
-std::array<float,2>{0.244308978f, 0.742875576f},
-std::array<float,2>{0.73099196f, 0.67555958f},
-std::array<float,2>{0.255310714f, 0.397241175f},
-std::array<float,2>{0.761570573f, 0.118531212f},
-std::array<float,2>{0.126925737f, 0.881502092f},
-std::array<float,2>{0.978877485f, 0.838668406f},
-std::array<float,2>{0.0446481258f, 0.211454809f},
-std::array<float,2>{0.567586899f, 0.374329776f},
-std::array<float,2>{0.397326469f, 0.534425557f},
-std::array<float,2>{0.867597401f, 0.623120725f},
-std::array<float,2>{0.237359047f, 0.288630545f},
-std::array<float,2>{0.654822767f, 0.140297934f},
-std::array<float,2>{0.361950397f, 0.769277692f},
-std::array<float,2>{0.560560524f, 0.992795646f},
-std::array<float,2>{0.477937311f, 0.0598713271f},
-std::array<float,2>{0.906665385f, 0.44117409f},
-std::array<float,2>{0.0683550462f, 0.693131387f},
-std::array<float,2>{0.614856124f, 0.511172414f},
-std::array<float,2>{0.420488089f, 0.319634408f},
-std::array<float,2>{0.963650048f, 0.230865732f},
-std::array<float,2>{0.0309835877f, 0.850091696f},
-std::array<float,2>{0.799069524f, 0.927835107f},
-std::array<float,2>{0.182783827f, 0.0892039463f},
-std::array<float,2>{0.700438619f, 0.419677615f},
-std::array<float,2>{0.281440437f, 0.655004144f},
-std::array<float,2>{0.878967047f, 0.73475492f},
-std::array<float,2>{0.123497464f, 0.491854131f},
-std::array<float,2>{0.513477027f, 0.0206507575f},
-std::array<float,2>{0.462555379f, 0.947788417f},
-std::array<float,2>{0.673986971f, 0.78327024f},
-std::array<float,2>{0.324932575f, 0.168561518f},
-std::array<float,2>{0.820850551f, 0.266334355f},
-std::array<float,2>{0.208786547f, 0.577879965f},
-std::array<float,2>{0.636544943f, 0.590381324f},
-std::array<float,2>{0.351970881f, 0.2504839f},
-std::array<float,2>{0.844294548f, 0.175059259f},
-std::array<float,2>{0.224389121f, 0.808649421f},
-std::array<float,2>{0.934259236f, 0.963867605f},
-std::array<float,2>{0.0848936811f, 0.00404331228f},
-std::array<float,2>{0.544480979f, 0.473677784f},
-std::array<float,2>{0.4884606f, 0.727748036f},
-std::array<float,2>{0.769342065f, 0.632558227f},
-std::array<float,2>{0.142437622f, 0.423523247f},
-std::array<float,2>{0.745156407f, 0.0697604567f},
-std::array<float,2>{0.27951315f, 0.911451995f},
-std::array<float,2>{0.57947129f, 0.869454563f},
-std::array<float,2>{0.381824642f, 0.238383368f},
-std::array<float,2>{0.99664104f, 0.333004266f},
-std::array<float,2>{0.0613921098f, 0.531111062f},
-std::array<float,2>{0.525290608f, 0.705125928f},
-std::array<float,2>{0.441212475f, 0.463778198f},
-std::array<float,2>{0.903007209f, 0.0456821844f},
-std::array<float,2>{0.10364949f, 0.972303271f},
-std::array<float,2>{0.836378634f, 0.756838441f},
-std::array<float,2>{0.191643804f, 0.154289842f},
-std::array<float,2>{0.664219081f, 0.298573017f},
-std::array<float,2>{0.342685103f, 0.598596156f},
-std::array<float,2>{0.939662576f, 0.561412156f},
-std::array<float,2>{0.015265407f, 0.357156783f},
-std::array<float,2>{0.594781458f, 0.193598926f},
-std::array<float,2>{0.427538663f, 0.823697627f},
-std::array<float,2>{0.710713267f, 0.893912435f},
-std::array<float,2>{0.308159322f, 0.0960380137f},
-std::array<float,2>{0.796555698f, 0.376809239f},
-std::array<float,2>{0.159194231f, 0.67106998f},
-std::array<float,2>{0.719488084f, 0.70987612f},
-std::array<float,2>{0.259912282f, 0.465665013f},
-std::array<float,2>{0.753333211f, 0.0394522995f},
-std::array<float,2>{0.136274546f, 0.976336598f},
-std::array<float,2>{0.973013699f, 0.753391325f},
-std::array<float,2>{0.0347765461f, 0.151978537f},
-std::array<float,2>{0.575200319f, 0.304125518f},
-std::array<float,2>{0.403297007f, 0.596414208f},
-std::array<float,2>{0.86178714f, 0.556432366f},
-std::array<float,2>{0.249155864f, 0.353012949f},
-std::array<float,2>{0.640719473f, 0.1914033f},
-std::array<float,2>{0.37274152f, 0.827359736f},
-std::array<float,2>{0.548485696f, 0.895540774f},
-std::array<float,2>{0.471440643f, 0.100622468f},
-std::array<float,2>{0.914778769f, 0.380510569f},
-std::array<float,2>{0.0751172081f, 0.667918861f},
-std::array<float,2>{0.620801806f, 0.589631796f},
-std::array<float,2>{0.407061458f, 0.255470067f},
-std::array<float,2>{0.953440845f, 0.178796589f},
-std::array<float,2>{0.0169698298f, 0.805795431f},
-std::array<float,2>{0.812299788f, 0.96576494f},
-std::array<float,2>{0.178200349f, 0.00274453871f},
-std::array<float,2>{0.693929672f, 0.470611095f},
-std::array<float,2>{0.29266566f, 0.730607927f},
-std::array<float,2>{0.887372613f, 0.627878726f},
-std::array<float,2>{0.109486625f, 0.429670066f},
-std::array<float,2>{0.501817048f, 0.0652311668f},
-std::array<float,2>{0.459627718f, 0.908585906f},
-std::array<float,2>{0.686334729f, 0.871906102f},
-std::array<float,2>{0.319862217f, 0.235643715f},
-std::array<float,2>{0.813465774f, 0.329413652f},
-std::array<float,2>{0.211344019f, 0.523719668f},
-std::array<float,2>{0.629534185f, 0.512772977f},
-std::array<float,2>{0.351240993f, 0.315263003f},
-std::array<float,2>{0.852998614f, 0.227013066f},
-std::array<float,2>{0.228969127f, 0.845882416f},
-std::array<float,2>{0.929093599f, 0.925487757f},
-std::array<float,2>{0.0928699821f, 0.0906535015f},
-std::array<float,2>{0.535585344f, 0.415161401f},
-std::array<float,2>{0.4963907f, 0.650363803f},
-std::array<float,2>{0.774272442f, 0.740055084f},
-std::array<float,2>{0.150685072f, 0.486674339f},
-std::array<float,2>{0.737810075f, 0.0175139327f},
-std::array<float,2>{0.268466085f, 0.951280653f},
-std::array<float,2>{0.587307155f, 0.7860021f},
-std::array<float,2>{0.389241815f, 0.164433748f},
-std::array<float,2>{0.987695634f, 0.270039916f},
-std::array<float,2>{0.0516580716f, 0.572293699f},
-std::array<float,2>{0.521621108f, 0.677264869f},
-std::array<float,2>{0.451140553f, 0.39078635f},
-std::array<float,2>{0.892149389f, 0.124743156f},
-std::array<float,2>{0.0990993977f, 0.877368867f},
-std::array<float,2>{0.83419919f, 0.840609431f},
-std::array<float,2>{0.202761739f, 0.218081206f},
-std::array<float,2>{0.663842082f, 0.369611681f},
-std::array<float,2>{0.328836024f, 0.537625074f},
-std::array<float,2>{0.951525688f, 0.620152116f},
-std::array<float,2>{0.00317542464f, 0.281955928f},
-std::array<float,2>{0.609262764f, 0.136624873f},
-std::array<float,2>{0.437021315f, 0.771932423f},
-std::array<float,2>{0.713219881f, 0.997364581f},
-std::array<float,2>{0.300539494f, 0.0562333316f},
-std::array<float,2>{0.781616807f, 0.445162207f},
-std::array<float,2>{0.16677627f, 0.69005549f},
-std::array<float,2>{0.66838479f, 0.642024934f},
-std::array<float,2>{0.33631444f, 0.413726389f},
-std::array<float,2>{0.842288613f, 0.0850415751f},
-std::array<float,2>{0.187951922f, 0.933562338f},
-std::array<float,2>{0.902248979f, 0.85582453f},
-std::array<float,2>{0.10756892f, 0.224195346f},
-std::array<float,2>{0.528709888f, 0.327566415f},
-std::array<float,2>{0.441727757f, 0.503898501f},
-std::array<float,2>{0.789259136f, 0.564226389f},
-std::array<float,2>{0.160550028f, 0.277625054f},
-std::array<float,2>{0.703922987f, 0.15782319f},
-std::array<float,2>{0.310652256f, 0.791670501f},
-std::array<float,2>{0.599675f, 0.940896988f},
-std::array<float,2>{0.425523907f, 0.029389197f},
-std::array<float,2>{0.942367792f, 0.49601689f},
-std::array<float,2>{0.0101578729f, 0.749785185f},
-std::array<float,2>{0.541890264f, 0.539123178f},
-std::array<float,2>{0.487662077f, 0.366794974f},
-std::array<float,2>{0.931343377f, 0.204871938f},
-std::array<float,2>{0.0782008693f, 0.834270954f},
-std::array<float,2>{0.849804521f, 0.890494406f},
-std::array<float,2>{0.219452053f, 0.112016812f},
-std::array<float,2>{0.638373852f, 0.40025112f},
-std::array<float,2>{0.358516634f, 0.680501878f},
-std::array<float,2>{0.995358407f, 0.698575139f},
-std::array<float,2>{0.0567089915f, 0.447595924f},
-std::array<float,2>{0.583664179f, 0.0525277816f},
-std::array<float,2>{0.376857638f, 0.992041588f},
-std::array<float,2>{0.749172926f, 0.779706955f},
-std::array<float,2>{0.273932934f, 0.132719949f},
-std::array<float,2>{0.769580007f, 0.290282369f},
-std::array<float,2>{0.144665629f, 0.616907775f},
-std::array<float,2>{0.697459042f, 0.608564258f},
-std::array<float,2>{0.285438299f, 0.310984522f},
-std::array<float,2>{0.802216053f, 0.14546749f},
-std::array<float,2>{0.187121406f, 0.764569104f},
-std::array<float,2>{0.965965867f, 0.982869327f},
-std::array<float,2>{0.0241657495f, 0.0334640145f},
-std::array<float,2>{0.609527767f, 0.459797055f},
-std::array<float,2>{0.417739689f, 0.714709878f},
-std::array<float,2>{0.825727761f, 0.659632146f},
-std::array<float,2>{0.203288496f, 0.383163601f},
-std::array<float,2>{0.676150084f, 0.107962564f},
-std::array<float,2>{0.322752535f, 0.899329603f},
-std::array<float,2>{0.50920403f, 0.813385069f},
-std::array<float,2>{0.46730569f, 0.202682048f},
-std::array<float,2>{0.877839684f, 0.345847368f},
-std::array<float,2>{0.119102307f, 0.550058007f},
-std::array<float,2>{0.565103769f, 0.719889998f},
-std::array<float,2>{0.392080843f, 0.477876902f},
-std::array<float,2>{0.984260261f, 0.0147965606f},
-std::array<float,2>{0.0408294052f, 0.955857873f},
-std::array<float,2>{0.763269424f, 0.799836636f},
-std::array<float,2>{0.129923105f, 0.183580533f},
-std::array<float,2>{0.729609072f, 0.263901383f},
-std::array<float,2>{0.251051992f, 0.584670365f},
-std::array<float,2>{0.910685778f, 0.515712082f},
-std::array<float,2>{0.0638837591f, 0.341798663f},
-std::array<float,2>{0.555340171f, 0.244395912f},
-std::array<float,2>{0.481620848f, 0.86087954f},
-std::array<float,2>{0.649165869f, 0.921052277f},
-std::array<float,2>{0.364759982f, 0.0707659498f},
-std::array<float,2>{0.871322155f, 0.435822666f},
-std::array<float,2>{0.241498545f, 0.634286463f},
-std::array<float,2>{0.644908547f, 0.743809342f},
-std::array<float,2>{0.370840222f, 0.49903959f},
-std::array<float,2>{0.865189254f, 0.0255559031f},
-std::array<float,2>{0.243575245f, 0.944659472f},
-std::array<float,2>{0.9184497f, 0.793975294f},
-std::array<float,2>{0.0705641434f, 0.16082716f},
-std::array<float,2>{0.550972819f, 0.275096446f},
-std::array<float,2>{0.473020017f, 0.568888426f},
-std::array<float,2>{0.756166577f, 0.505351841f},
-std::array<float,2>{0.137697682f, 0.321759313f},
-std::array<float,2>{0.722853184f, 0.219812304f},
-std::array<float,2>{0.265168905f, 0.85157007f},
-std::array<float,2>{0.570760727f, 0.936162472f},
-std::array<float,2>{0.399253696f, 0.0795111805f},
-std::array<float,2>{0.969663262f, 0.408214867f},
-std::array<float,2>{0.0366761424f, 0.647151232f},
-std::array<float,2>{0.504483938f, 0.612457573f},
-std::array<float,2>{0.45491913f, 0.295748442f},
-std::array<float,2>{0.883069515f, 0.12849097f},
-std::array<float,2>{0.115915202f, 0.774129748f},
-std::array<float,2>{0.819753349f, 0.987048507f},
-std::array<float,2>{0.21860294f, 0.0472899191f},
-std::array<float,2>{0.683281124f, 0.449281335f},
-std::array<float,2>{0.315858811f, 0.700311422f},
-std::array<float,2>{0.960660994f, 0.683648288f},
-std::array<float,2>{0.021283159f, 0.405193269f},
-std::array<float,2>{0.624786258f, 0.11638023f},
-std::array<float,2>{0.413296819f, 0.886591017f},
-std::array<float,2>{0.690227211f, 0.831021011f},
-std::array<float,2>{0.295178801f, 0.20751895f},
-std::array<float,2>{0.805640459f, 0.362175971f},
-std::array<float,2>{0.172258422f, 0.544493616f},
-std::array<float,2>{0.740354121f, 0.552780151f},
-std::array<float,2>{0.273019433f, 0.349380106f},
-std::array<float,2>{0.779042184f, 0.196319133f},
-std::array<float,2>{0.152750194f, 0.81661284f},
-std::array<float,2>{0.992149413f, 0.902560294f},
-std::array<float,2>{0.0479942411f, 0.103003137f},
-std::array<float,2>{0.591785014f, 0.388113171f},
-std::array<float,2>{0.383295417f, 0.661862016f},
-std::array<float,2>{0.857307792f, 0.71528095f},
-std::array<float,2>{0.232263505f, 0.456320912f},
-std::array<float,2>{0.627103388f, 0.0358512923f},
-std::array<float,2>{0.344491988f, 0.979573667f},
-std::array<float,2>{0.531549394f, 0.758004367f},
-std::array<float,2>{0.492520362f, 0.142531753f},
-std::array<float,2>{0.922107339f, 0.306700736f},
-std::array<float,2>{0.0891611427f, 0.60435462f},
-std::array<float,2>{0.601980686f, 0.640051603f},
-std::array<float,2>{0.431813329f, 0.430672556f},
-std::array<float,2>{0.947060049f, 0.0760388598f},
-std::array<float,2>{0.00607325044f, 0.915229559f},
-std::array<float,2>{0.787666917f, 0.866608083f},
-std::array<float,2>{0.168555439f, 0.246139228f},
-std::array<float,2>{0.715261698f, 0.337845147f},
-std::array<float,2>{0.30330959f, 0.523123443f},
-std::array<float,2>{0.898231149f, 0.581036687f},
-std::array<float,2>{0.094382219f, 0.257880211f},
-std::array<float,2>{0.51947093f, 0.187266633f},
-std::array<float,2>{0.446890324f, 0.80291003f},
-std::array<float,2>{0.656531811f, 0.958325386f},
-std::array<float,2>{0.333576143f, 0.00800384767f},
-std::array<float,2>{0.828254461f, 0.48133868f},
-std::array<float,2>{0.198421612f, 0.72405231f},
-std::array<float,2>{0.707416952f, 0.670169711f},
-std::array<float,2>{0.304849148f, 0.375723839f},
-std::array<float,2>{0.794681787f, 0.0971253216f},
-std::array<float,2>{0.157688096f, 0.892780185f},
-std::array<float,2>{0.937565684f, 0.822632074f},
-std::array<float,2>{0.0125240656f, 0.1945896f},
-std::array<float,2>{0.595794082f, 0.355539173f},
-std::array<float,2>{0.429316282f, 0.561736345f},
-std::array<float,2>{0.838802934f, 0.598667443f},
-std::array<float,2>{0.194313914f, 0.297374308f},
-std::array<float,2>{0.667068005f, 0.152517647f},
-std::array<float,2>{0.340502083f, 0.756704032f},
-std::array<float,2>{0.527276039f, 0.9707793f},
-std::array<float,2>{0.439322948f, 0.0464243628f},
-std::array<float,2>{0.905386209f, 0.46423322f},
-std::array<float,2>{0.101676784f, 0.706570983f},
-std::array<float,2>{0.580307364f, 0.529845834f},
-std::array<float,2>{0.379712671f, 0.333556861f},
-std::array<float,2>{0.999832928f, 0.239776716f},
-std::array<float,2>{0.0593187138f, 0.870954752f},
-std::array<float,2>{0.76686883f, 0.910179138f},
-std::array<float,2>{0.142719969f, 0.068675898f},
-std::array<float,2>{0.742284715f, 0.421984255f},
-std::array<float,2>{0.277776152f, 0.63164562f},
-std::array<float,2>{0.936039567f, 0.726835251f},
-std::array<float,2>{0.0827573538f, 0.473061234f},
-std::array<float,2>{0.545350611f, 0.00528822653f},
-std::array<float,2>{0.490763098f, 0.963515937f},
-std::array<float,2>{0.633909047f, 0.810189188f},
-std::array<float,2>{0.353777111f, 0.173848659f},
-std::array<float,2>{0.847115755f, 0.251260132f},
-std::array<float,2>{0.225589707f, 0.590958953f},
-std::array<float,2>{0.673487246f, 0.576894879f},
-std::array<float,2>{0.327321053f, 0.266638696f},
-std::array<float,2>{0.824024141f, 0.16926457f},
-std::array<float,2>{0.210616887f, 0.784866989f},
-std::array<float,2>{0.882594645f, 0.948513985f},
-std::array<float,2>{0.121547706f, 0.0199215692f},
-std::array<float,2>{0.513833702f, 0.491029292f},
-std::array<float,2>{0.463646829f, 0.735714018f},
-std::array<float,2>{0.798824728f, 0.655766606f},
-std::array<float,2>{0.180911094f, 0.418742657f},
-std::array<float,2>{0.703083575f, 0.0886266157f},
-std::array<float,2>{0.284655362f, 0.929345906f},
-std::array<float,2>{0.615991652f, 0.85131532f},
-std::array<float,2>{0.418999285f, 0.231645361f},
-std::array<float,2>{0.961937964f, 0.318521321f},
-std::array<float,2>{0.0287189484f, 0.51025784f},
-std::array<float,2>{0.559498549f, 0.691810071f},
-std::array<float,2>{0.478613794f, 0.439885914f},
-std::array<float,2>{0.90948385f, 0.0591237694f},
-std::array<float,2>{0.0697367936f, 0.994133294f},
-std::array<float,2>{0.871086836f, 0.768358469f},
-std::array<float,2>{0.236220628f, 0.13954553f},
-std::array<float,2>{0.653100193f, 0.287518144f},
-std::array<float,2>{0.359596252f, 0.624837458f},
-std::array<float,2>{0.978021204f, 0.533760607f},
-std::array<float,2>{0.0453252308f, 0.373445451f},
-std::array<float,2>{0.569590271f, 0.212858438f},
-std::array<float,2>{0.395137787f, 0.838995874f},
-std::array<float,2>{0.734197557f, 0.882665932f},
-std::array<float,2>{0.257016897f, 0.117440492f},
-std::array<float,2>{0.758054972f, 0.398390412f},
-std::array<float,2>{0.127108544f, 0.674255192f},
-std::array<float,2>{0.693023086f, 0.733673573f},
-std::array<float,2>{0.290599376f, 0.471037179f},
-std::array<float,2>{0.809306741f, 0.000586293405f},
-std::array<float,2>{0.177333295f, 0.967851341f},
-std::array<float,2>{0.955937028f, 0.808288753f},
-std::array<float,2>{0.0187053941f, 0.176914886f},
-std::array<float,2>{0.618974268f, 0.256975621f},
-std::array<float,2>{0.40882206f, 0.586555362f},
-std::array<float,2>{0.815144837f, 0.526758075f},
-std::array<float,2>{0.214469001f, 0.331468672f},
-std::array<float,2>{0.683687627f, 0.238089561f},
-std::array<float,2>{0.316789448f, 0.873921633f},
-std::array<float,2>{0.502446234f, 0.906905115f},
-std::array<float,2>{0.457113475f, 0.0637525618f},
-std::array<float,2>{0.88916707f, 0.426484197f},
-std::array<float,2>{0.113239817f, 0.625727654f},
-std::array<float,2>{0.576928616f, 0.594641984f},
-std::array<float,2>{0.404535592f, 0.300805956f},
-std::array<float,2>{0.975641489f, 0.149277106f},
-std::array<float,2>{0.0316080898f, 0.751731038f},
-std::array<float,2>{0.751781404f, 0.974443316f},
-std::array<float,2>{0.134582624f, 0.0428508036f},
-std::array<float,2>{0.720776558f, 0.468288004f},
-std::array<float,2>{0.259071976f, 0.708444118f},
-std::array<float,2>{0.91730094f, 0.665412486f},
-std::array<float,2>{0.0779927671f, 0.382218659f},
-std::array<float,2>{0.549532115f, 0.0991299003f},
-std::array<float,2>{0.469938099f, 0.897582173f},
-std::array<float,2>{0.644317627f, 0.82605654f},
-std::array<float,2>{0.374101907f, 0.188010648f},
-std::array<float,2>{0.860731959f, 0.354618609f},
-std::array<float,2>{0.246846005f, 0.55740428f},
-std::array<float,2>{0.661809564f, 0.537059009f},
-std::array<float,2>{0.330511659f, 0.36753729f},
-std::array<float,2>{0.833536565f, 0.215415373f},
-std::array<float,2>{0.200398907f, 0.843146086f},
-std::array<float,2>{0.892920852f, 0.875071466f},
-std::array<float,2>{0.100135833f, 0.122518212f},
-std::array<float,2>{0.520439625f, 0.3939794f},
-std::array<float,2>{0.451399267f, 0.678882122f},
-std::array<float,2>{0.785036325f, 0.68783623f},
-std::array<float,2>{0.165826812f, 0.442212194f},
-std::array<float,2>{0.711139441f, 0.0579324961f},
-std::array<float,2>{0.296943009f, 0.999472678f},
-std::array<float,2>{0.606442988f, 0.770265818f},
-std::array<float,2>{0.433832794f, 0.134699687f},
-std::array<float,2>{0.950208366f, 0.28511709f},
-std::array<float,2>{0.0018138747f, 0.618203402f},
-std::array<float,2>{0.537994385f, 0.651278317f},
-std::array<float,2>{0.499741107f, 0.417853773f},
-std::array<float,2>{0.92620337f, 0.093479909f},
-std::array<float,2>{0.0900666937f, 0.922555804f},
-std::array<float,2>{0.855125666f, 0.844059289f},
-std::array<float,2>{0.226666734f, 0.230102137f},
-std::array<float,2>{0.631059468f, 0.313153028f},
-std::array<float,2>{0.348225653f, 0.514911175f},
-std::array<float,2>{0.984680414f, 0.570347667f},
-std::array<float,2>{0.0542691723f, 0.271724939f},
-std::array<float,2>{0.589359939f, 0.167854667f},
-std::array<float,2>{0.387511253f, 0.788386762f},
-std::array<float,2>{0.735805333f, 0.949334502f},
-std::array<float,2>{0.267540962f, 0.0177371409f},
-std::array<float,2>{0.776559532f, 0.485041142f},
-std::array<float,2>{0.149264589f, 0.741451323f},
-std::array<float,2>{0.640046418f, 0.682413936f},
-std::array<float,2>{0.355822355f, 0.401390076f},
-std::array<float,2>{0.848763883f, 0.109781474f},
-std::array<float,2>{0.221937045f, 0.887599826f},
-std::array<float,2>{0.932319105f, 0.832518041f},
-std::array<float,2>{0.0812956244f, 0.205879137f},
-std::array<float,2>{0.540479183f, 0.363616675f},
-std::array<float,2>{0.485485554f, 0.5413571f},
-std::array<float,2>{0.771496058f, 0.614731014f},
-std::array<float,2>{0.147758573f, 0.291569978f},
-std::array<float,2>{0.747646391f, 0.130148157f},
-std::array<float,2>{0.276203305f, 0.779016793f},
-std::array<float,2>{0.5849967f, 0.990143061f},
-std::array<float,2>{0.378831804f, 0.0529440381f},
-std::array<float,2>{0.99228549f, 0.447034925f},
-std::array<float,2>{0.0557350889f, 0.695694268f},
-std::array<float,2>{0.531060696f, 0.501636088f},
-std::array<float,2>{0.443711817f, 0.325228482f},
-std::array<float,2>{0.898943365f, 0.22477822f},
-std::array<float,2>{0.106449783f, 0.859232306f},
-std::array<float,2>{0.841703892f, 0.931591272f},
-std::array<float,2>{0.190856442f, 0.0820873007f},
-std::array<float,2>{0.67186749f, 0.41188702f},
-std::array<float,2>{0.339492112f, 0.643707275f},
-std::array<float,2>{0.944987714f, 0.746228218f},
-std::array<float,2>{0.00883051846f, 0.492696106f},
-std::array<float,2>{0.598206818f, 0.0292433705f},
-std::array<float,2>{0.423343539f, 0.938269436f},
-std::array<float,2>{0.705567718f, 0.790932775f},
-std::array<float,2>{0.308862597f, 0.15935269f},
-std::array<float,2>{0.791456401f, 0.28023994f},
-std::array<float,2>{0.163129762f, 0.565829396f},
-std::array<float,2>{0.726779342f, 0.583085656f},
-std::array<float,2>{0.252876908f, 0.262695968f},
-std::array<float,2>{0.76470983f, 0.181395277f},
-std::array<float,2>{0.131265581f, 0.797370553f},
-std::array<float,2>{0.980641246f, 0.954695106f},
-std::array<float,2>{0.042725455f, 0.0128847146f},
-std::array<float,2>{0.563020408f, 0.479747027f},
-std::array<float,2>{0.394156665f, 0.722193003f},
-std::array<float,2>{0.874073803f, 0.636032581f},
-std::array<float,2>{0.239015013f, 0.434241533f},
-std::array<float,2>{0.652245641f, 0.0738034695f},
-std::array<float,2>{0.367097259f, 0.918936193f},
-std::array<float,2>{0.557098985f, 0.862285554f},
-std::array<float,2>{0.482512742f, 0.242939308f},
-std::array<float,2>{0.913180768f, 0.340151131f},
-std::array<float,2>{0.066099368f, 0.518645585f},
-std::array<float,2>{0.612087309f, 0.712081194f},
-std::array<float,2>{0.414437234f, 0.45841831f},
-std::array<float,2>{0.967309833f, 0.0313569196f},
-std::array<float,2>{0.0257746875f, 0.982283473f},
-std::array<float,2>{0.803675056f, 0.763119698f},
-std::array<float,2>{0.183872387f, 0.146758646f},
-std::array<float,2>{0.697187185f, 0.30959636f},
-std::array<float,2>{0.287904382f, 0.607377708f},
-std::array<float,2>{0.875873685f, 0.546947122f},
-std::array<float,2>{0.119524457f, 0.344813704f},
-std::array<float,2>{0.509786665f, 0.200927436f},
-std::array<float,2>{0.466269463f, 0.814816713f},
-std::array<float,2>{0.678892374f, 0.901083946f},
-std::array<float,2>{0.321743131f, 0.105824873f},
-std::array<float,2>{0.827587843f, 0.385496587f},
-std::array<float,2>{0.20646587f, 0.657521486f},
-std::array<float,2>{0.68104142f, 0.701873779f},
-std::array<float,2>{0.312738329f, 0.451743126f},
-std::array<float,2>{0.816530108f, 0.050718572f},
-std::array<float,2>{0.215187013f, 0.985529542f},
-std::array<float,2>{0.886603355f, 0.77614516f},
-std::array<float,2>{0.114152767f, 0.125676081f},
-std::array<float,2>{0.507780552f, 0.294237345f},
-std::array<float,2>{0.456739038f, 0.611027896f},
-std::array<float,2>{0.806756914f, 0.546245694f},
-std::array<float,2>{0.175536409f, 0.360662907f},
-std::array<float,2>{0.688055873f, 0.210427985f},
-std::array<float,2>{0.293117195f, 0.828627825f},
-std::array<float,2>{0.621188343f, 0.883818388f},
-std::array<float,2>{0.410274774f, 0.113570251f},
-std::array<float,2>{0.958612204f, 0.403233647f},
-std::array<float,2>{0.0217603631f, 0.686150551f},
-std::array<float,2>{0.554648578f, 0.567254186f},
-std::array<float,2>{0.47518748f, 0.27653414f},
-std::array<float,2>{0.921353996f, 0.163618445f},
-std::array<float,2>{0.0726841912f, 0.795711517f},
-std::array<float,2>{0.866273999f, 0.942308068f},
-std::array<float,2>{0.245934293f, 0.0251953993f},
-std::array<float,2>{0.646946192f, 0.496388167f},
-std::array<float,2>{0.369067609f, 0.745811045f},
-std::array<float,2>{0.971141458f, 0.64501369f},
-std::array<float,2>{0.0378137492f, 0.407723188f},
-std::array<float,2>{0.572780013f, 0.0808812976f},
-std::array<float,2>{0.402071476f, 0.934152901f},
-std::array<float,2>{0.726177812f, 0.853897214f},
-std::array<float,2>{0.262108445f, 0.220720753f},
-std::array<float,2>{0.754412413f, 0.322562873f},
-std::array<float,2>{0.139357716f, 0.506500602f},
-std::array<float,2>{0.71725589f, 0.519632399f},
-std::array<float,2>{0.301349342f, 0.339718848f},
-std::array<float,2>{0.786409318f, 0.249858618f},
-std::array<float,2>{0.170716092f, 0.8650648f},
-std::array<float,2>{0.94820112f, 0.917270601f},
-std::array<float,2>{0.00417389395f, 0.0776240677f},
-std::array<float,2>{0.60353148f, 0.431914389f},
-std::array<float,2>{0.430695504f, 0.637954235f},
-std::array<float,2>{0.830853522f, 0.725384295f},
-std::array<float,2>{0.195644096f, 0.484272391f},
-std::array<float,2>{0.658913136f, 0.0115227653f},
-std::array<float,2>{0.334562689f, 0.960513234f},
-std::array<float,2>{0.516897857f, 0.801313877f},
-std::array<float,2>{0.449175715f, 0.185165569f},
-std::array<float,2>{0.89472115f, 0.261704355f},
-std::array<float,2>{0.0970482081f, 0.578308582f},
-std::array<float,2>{0.592531145f, 0.662277281f},
-std::array<float,2>{0.385740668f, 0.38961494f},
-std::array<float,2>{0.988447905f, 0.105388798f},
-std::array<float,2>{0.0495171733f, 0.904423594f},
-std::array<float,2>{0.779917657f, 0.818770111f},
-std::array<float,2>{0.154475659f, 0.197861791f},
-std::array<float,2>{0.73843348f, 0.350642055f},
-std::array<float,2>{0.270462096f, 0.551029801f},
-std::array<float,2>{0.92511797f, 0.601976216f},
-std::array<float,2>{0.087203823f, 0.305730194f},
-std::array<float,2>{0.534501433f, 0.14350003f},
-std::array<float,2>{0.495681435f, 0.76101172f},
-std::array<float,2>{0.626024067f, 0.977560997f},
-std::array<float,2>{0.347200692f, 0.0386449657f},
-std::array<float,2>{0.858886302f, 0.454318792f},
-std::array<float,2>{0.232557192f, 0.718650579f},
-std::array<float,2>{0.744496346f, 0.629083991f},
-std::array<float,2>{0.280356586f, 0.425105155f},
-std::array<float,2>{0.767898619f, 0.0672273189f},
-std::array<float,2>{0.141072154f, 0.912894785f},
-std::array<float,2>{0.997879505f, 0.868805647f},
-std::array<float,2>{0.0624229237f, 0.241453156f},
-std::array<float,2>{0.578183353f, 0.334392369f},
-std::array<float,2>{0.381875277f, 0.528276265f},
-std::array<float,2>{0.845059633f, 0.593265355f},
-std::array<float,2>{0.223619178f, 0.252150446f},
-std::array<float,2>{0.635573387f, 0.173189446f},
-std::array<float,2>{0.353442401f, 0.811707199f},
-std::array<float,2>{0.543456316f, 0.961944938f},
-std::array<float,2>{0.48983565f, 0.00707914168f},
-std::array<float,2>{0.934612811f, 0.47641477f},
-std::array<float,2>{0.0858705193f, 0.729561567f},
-std::array<float,2>{0.594441473f, 0.558732271f},
-std::array<float,2>{0.426579863f, 0.357823819f},
-std::array<float,2>{0.940679014f, 0.192755952f},
-std::array<float,2>{0.0141308866f, 0.821863174f},
-std::array<float,2>{0.79508847f, 0.891543865f},
-std::array<float,2>{0.158586577f, 0.0943851694f},
-std::array<float,2>{0.709097445f, 0.378598511f},
-std::array<float,2>{0.307540238f, 0.668730259f},
-std::array<float,2>{0.904230773f, 0.703301013f},
-std::array<float,2>{0.105424635f, 0.46238789f},
-std::array<float,2>{0.524221659f, 0.0447232574f},
-std::array<float,2>{0.440286517f, 0.968992889f},
-std::array<float,2>{0.665823877f, 0.754070044f},
-std::array<float,2>{0.343516886f, 0.156080112f},
-std::array<float,2>{0.837110579f, 0.299951255f},
-std::array<float,2>{0.192571118f, 0.601552188f},
-std::array<float,2>{0.65544641f, 0.621805549f},
-std::array<float,2>{0.363165975f, 0.286447912f},
-std::array<float,2>{0.869104683f, 0.137369141f},
-std::array<float,2>{0.237019256f, 0.767524838f},
-std::array<float,2>{0.907662332f, 0.995503008f},
-std::array<float,2>{0.0665234551f, 0.0612684004f},
-std::array<float,2>{0.562051833f, 0.437844396f},
-std::array<float,2>{0.477142215f, 0.694036543f},
-std::array<float,2>{0.760336757f, 0.672440469f},
-std::array<float,2>{0.125681266f, 0.395685941f},
-std::array<float,2>{0.732241809f, 0.119625412f},
-std::array<float,2>{0.25394085f, 0.879592597f},
-std::array<float,2>{0.566871762f, 0.836818397f},
-std::array<float,2>{0.39810276f, 0.21380192f},
-std::array<float,2>{0.980223954f, 0.371248722f},
-std::array<float,2>{0.0432174429f, 0.533133864f},
-std::array<float,2>{0.51196754f, 0.737953246f},
-std::array<float,2>{0.46174702f, 0.490214795f},
-std::array<float,2>{0.880023956f, 0.0231158677f},
-std::array<float,2>{0.124330491f, 0.947048903f},
-std::array<float,2>{0.821574569f, 0.782406151f},
-std::array<float,2>{0.207587689f, 0.170305938f},
-std::array<float,2>{0.675489962f, 0.269096345f},
-std::array<float,2>{0.326068819f, 0.57429409f},
-std::array<float,2>{0.964276671f, 0.508931339f},
-std::array<float,2>{0.0296904072f, 0.317137986f},
-std::array<float,2>{0.613363862f, 0.232462004f},
-std::array<float,2>{0.421500534f, 0.848471165f},
-std::array<float,2>{0.700087667f, 0.925870359f},
-std::array<float,2>{0.28264904f, 0.0869840384f},
-std::array<float,2>{0.799932599f, 0.420758963f},
-std::array<float,2>{0.181928024f, 0.652513921f},
-std::array<float,2>{0.730142057f, 0.721700609f},
-std::array<float,2>{0.251778334f, 0.48006016f},
-std::array<float,2>{0.763174057f, 0.0132892421f},
-std::array<float,2>{0.130729392f, 0.954455316f},
-std::array<float,2>{0.983413458f, 0.797139823f},
-std::array<float,2>{0.040058855f, 0.181082577f},
-std::array<float,2>{0.564571261f, 0.263431966f},
-std::array<float,2>{0.392414272f, 0.58384192f},
-std::array<float,2>{0.871735096f, 0.519191563f},
-std::array<float,2>{0.242097035f, 0.340634972f},
-std::array<float,2>{0.648577869f, 0.242273733f},
-std::array<float,2>{0.364468127f, 0.861406267f},
-std::array<float,2>{0.554893494f, 0.918358803f},
-std::array<float,2>{0.482011855f, 0.0734451339f},
-std::array<float,2>{0.910156488f, 0.434013993f},
-std::array<float,2>{0.0642214715f, 0.636352539f},
-std::array<float,2>{0.610129237f, 0.606684089f},
-std::array<float,2>{0.417330831f, 0.310532987f},
-std::array<float,2>{0.966624558f, 0.147171438f},
-std::array<float,2>{0.0236333963f, 0.763218224f},
-std::array<float,2>{0.802292466f, 0.981890321f},
-std::array<float,2>{0.186758846f, 0.0321474746f},
-std::array<float,2>{0.69776696f, 0.458981782f},
-std::array<float,2>{0.286019146f, 0.712808311f},
-std::array<float,2>{0.877061248f, 0.657967627f},
-std::array<float,2>{0.118475214f, 0.385144949f},
-std::array<float,2>{0.509294987f, 0.105988726f},
-std::array<float,2>{0.467248261f, 0.900603354f},
-std::array<float,2>{0.676513314f, 0.815279245f},
-std::array<float,2>{0.323100805f, 0.200432062f},
-std::array<float,2>{0.825283051f, 0.345645607f},
-std::array<float,2>{0.203793138f, 0.547706306f},
-std::array<float,2>{0.637703776f, 0.541617274f},
-std::array<float,2>{0.358974278f, 0.364238083f},
-std::array<float,2>{0.850230336f, 0.205263317f},
-std::array<float,2>{0.219237521f, 0.832976997f},
-std::array<float,2>{0.931116283f, 0.887063086f},
-std::array<float,2>{0.0786741227f, 0.109897114f},
-std::array<float,2>{0.541125536f, 0.402240455f},
-std::array<float,2>{0.487933427f, 0.682112455f},
-std::array<float,2>{0.77033174f, 0.695938528f},
-std::array<float,2>{0.145273849f, 0.446566999f},
-std::array<float,2>{0.749791861f, 0.0535764545f},
-std::array<float,2>{0.273766786f, 0.989424825f},
-std::array<float,2>{0.583227515f, 0.778744817f},
-std::array<float,2>{0.37601158f, 0.130658522f},
-std::array<float,2>{0.996057272f, 0.291098982f},
-std::array<float,2>{0.0573313907f, 0.615015626f},
-std::array<float,2>{0.529205978f, 0.644314289f},
-std::array<float,2>{0.442212075f, 0.411259949f},
-std::array<float,2>{0.901418984f, 0.0825855136f},
-std::array<float,2>{0.107990637f, 0.930841267f},
-std::array<float,2>{0.842118204f, 0.858674586f},
-std::array<float,2>{0.18837367f, 0.225384936f},
-std::array<float,2>{0.668640196f, 0.326045066f},
-std::array<float,2>{0.336513609f, 0.501326442f},
-std::array<float,2>{0.941833019f, 0.566349983f},
-std::array<float,2>{0.0104788719f, 0.279529542f},
-std::array<float,2>{0.600454271f, 0.159749001f},
-std::array<float,2>{0.424996078f, 0.790199339f},
-std::array<float,2>{0.703549802f, 0.937901437f},
-std::array<float,2>{0.311222434f, 0.0285382196f},
-std::array<float,2>{0.790016294f, 0.492376059f},
-std::array<float,2>{0.161113158f, 0.746663809f},
-std::array<float,2>{0.663507044f, 0.679205298f},
-std::array<float,2>{0.328552723f, 0.394270122f},
-std::array<float,2>{0.834769368f, 0.122871593f},
-std::array<float,2>{0.202613488f, 0.875901759f},
-std::array<float,2>{0.891622841f, 0.843264043f},
-std::array<float,2>{0.0994210839f, 0.215102673f},
-std::array<float,2>{0.522408485f, 0.367789596f},
-std::array<float,2>{0.450668752f, 0.536275148f},
-std::array<float,2>{0.781806231f, 0.618853688f},
-std::array<float,2>{0.166263267f, 0.28440541f},
-std::array<float,2>{0.71347928f, 0.133923337f},
-std::array<float,2>{0.299964935f, 0.769821048f},
-std::array<float,2>{0.608792424f, 0.999702334f},
-std::array<float,2>{0.436977386f, 0.0585051477f},
-std::array<float,2>{0.952113748f, 0.441502154f},
-std::array<float,2>{0.0038887253f, 0.688411832f},
-std::array<float,2>{0.536002934f, 0.515309215f},
-std::array<float,2>{0.496830195f, 0.312669575f},
-std::array<float,2>{0.929404199f, 0.229732677f},
-std::array<float,2>{0.0937203243f, 0.844671667f},
-std::array<float,2>{0.853439152f, 0.922219455f},
-std::array<float,2>{0.229226187f, 0.0931086093f},
-std::array<float,2>{0.629384756f, 0.417222917f},
-std::array<float,2>{0.350986212f, 0.650752425f},
-std::array<float,2>{0.988099277f, 0.741879702f},
-std::array<float,2>{0.0512450114f, 0.48474884f},
-std::array<float,2>{0.587852061f, 0.0182211641f},
-std::array<float,2>{0.389003962f, 0.949760914f},
-std::array<float,2>{0.737558544f, 0.789033294f},
-std::array<float,2>{0.26786077f, 0.167366281f},
-std::array<float,2>{0.773537993f, 0.272213191f},
-std::array<float,2>{0.151264086f, 0.570993662f},
-std::array<float,2>{0.693836927f, 0.585997403f},
-std::array<float,2>{0.292203635f, 0.257499814f},
-std::array<float,2>{0.811628819f, 0.177512273f},
-std::array<float,2>{0.178543448f, 0.807961047f},
-std::array<float,2>{0.954028308f, 0.968554556f},
-std::array<float,2>{0.0173694585f, 7.21000542e-05f},
-std::array<float,2>{0.620207131f, 0.471381903f},
-std::array<float,2>{0.4062756f, 0.7340886f},
-std::array<float,2>{0.812967181f, 0.625352025f},
-std::array<float,2>{0.211835504f, 0.425920844f},
-std::array<float,2>{0.686005712f, 0.0642494336f},
-std::array<float,2>{0.319712162f, 0.906414568f},
-std::array<float,2>{0.501425087f, 0.873166859f},
-std::array<float,2>{0.459130287f, 0.237432748f},
-std::array<float,2>{0.886751056f, 0.331709564f},
-std::array<float,2>{0.110339172f, 0.527278423f},
-std::array<float,2>{0.575880706f, 0.708705127f},
-std::array<float,2>{0.402796209f, 0.468148559f},
-std::array<float,2>{0.973613322f, 0.0423021875f},
-std::array<float,2>{0.0345498137f, 0.973753095f},
-std::array<float,2>{0.753532529f, 0.75142467f},
-std::array<float,2>{0.135988027f, 0.148572266f},
-std::array<float,2>{0.719212294f, 0.301676214f},
-std::array<float,2>{0.260474443f, 0.59382236f},
-std::array<float,2>{0.914492071f, 0.556888402f},
-std::array<float,2>{0.0747036561f, 0.355153233f},
-std::array<float,2>{0.548243344f, 0.187888786f},
-std::array<float,2>{0.47104308f, 0.82540679f},
-std::array<float,2>{0.641298294f, 0.89828229f},
-std::array<float,2>{0.372395724f, 0.0990329459f},
-std::array<float,2>{0.861886561f, 0.382809639f},
-std::array<float,2>{0.249933377f, 0.665680647f},
-std::array<float,2>{0.652757168f, 0.693563223f},
-std::array<float,2>{0.359922767f, 0.438442111f},
-std::array<float,2>{0.870220482f, 0.0607225485f},
-std::array<float,2>{0.235834986f, 0.995680511f},
-std::array<float,2>{0.910108805f, 0.766723096f},
-std::array<float,2>{0.0701141953f, 0.13717398f},
-std::array<float,2>{0.558658957f, 0.28710112f},
-std::array<float,2>{0.479146302f, 0.621358693f},
-std::array<float,2>{0.758769453f, 0.532559633f},
-std::array<float,2>{0.127618372f, 0.371949047f},
-std::array<float,2>{0.733534634f, 0.213251099f},
-std::array<float,2>{0.257799119f, 0.836398602f},
-std::array<float,2>{0.570266128f, 0.87915647f},
-std::array<float,2>{0.394552708f, 0.119726107f},
-std::array<float,2>{0.978487074f, 0.396368027f},
-std::array<float,2>{0.0456605479f, 0.672047436f},
-std::array<float,2>{0.514297247f, 0.574730515f},
-std::array<float,2>{0.46314308f, 0.268987119f},
-std::array<float,2>{0.881987333f, 0.17043978f},
-std::array<float,2>{0.122018375f, 0.782718778f},
-std::array<float,2>{0.823346674f, 0.946395218f},
-std::array<float,2>{0.210020244f, 0.0227276795f},
-std::array<float,2>{0.673233569f, 0.489608288f},
-std::array<float,2>{0.327700675f, 0.737531722f},
-std::array<float,2>{0.962499857f, 0.653256595f},
-std::array<float,2>{0.0288514197f, 0.420331359f},
-std::array<float,2>{0.615237594f, 0.0875731558f},
-std::array<float,2>{0.419909626f, 0.926272273f},
-std::array<float,2>{0.70245564f, 0.848121583f},
-std::array<float,2>{0.284820378f, 0.233090803f},
-std::array<float,2>{0.798016191f, 0.31681025f},
-std::array<float,2>{0.181347206f, 0.509451389f},
-std::array<float,2>{0.742932856f, 0.527393818f},
-std::array<float,2>{0.277954161f, 0.334816426f},
-std::array<float,2>{0.767486691f, 0.241733432f},
-std::array<float,2>{0.143174753f, 0.868262231f},
-std::array<float,2>{0.999063611f, 0.912560403f},
-std::array<float,2>{0.0588735268f, 0.0668043941f},
-std::array<float,2>{0.580862522f, 0.425742805f},
-std::array<float,2>{0.379224241f, 0.629747152f},
-std::array<float,2>{0.847505212f, 0.730385423f},
-std::array<float,2>{0.226363286f, 0.475626618f},
-std::array<float,2>{0.634288549f, 0.00753889233f},
-std::array<float,2>{0.354015708f, 0.962435246f},
-std::array<float,2>{0.545897901f, 0.812457979f},
-std::array<float,2>{0.490518779f, 0.173739552f},
-std::array<float,2>{0.935865939f, 0.252455294f},
-std::array<float,2>{0.0822066367f, 0.593102872f},
-std::array<float,2>{0.596214771f, 0.668087244f},
-std::array<float,2>{0.428746521f, 0.377995431f},
-std::array<float,2>{0.938416958f, 0.0939940736f},
-std::array<float,2>{0.0119266808f, 0.89095062f},
-std::array<float,2>{0.794172823f, 0.821556449f},
-std::array<float,2>{0.157813475f, 0.193263516f},
-std::array<float,2>{0.707970798f, 0.358388484f},
-std::array<float,2>{0.305529565f, 0.559330106f},
-std::array<float,2>{0.906062365f, 0.600877583f},
-std::array<float,2>{0.102275342f, 0.300369203f},
-std::array<float,2>{0.52645427f, 0.15555881f},
-std::array<float,2>{0.438876152f, 0.75486815f},
-std::array<float,2>{0.667565227f, 0.969698668f},
-std::array<float,2>{0.340038091f, 0.0442509092f},
-std::array<float,2>{0.83828938f, 0.462438226f},
-std::array<float,2>{0.193688676f, 0.703625917f},
-std::array<float,2>{0.715407252f, 0.638225734f},
-std::array<float,2>{0.30290845f, 0.432391554f},
-std::array<float,2>{0.7874704f, 0.0778816268f},
-std::array<float,2>{0.168322027f, 0.917601943f},
-std::array<float,2>{0.946339428f, 0.864716411f},
-std::array<float,2>{0.00640250649f, 0.249214321f},
-std::array<float,2>{0.602273405f, 0.339107513f},
-std::array<float,2>{0.432517767f, 0.520186961f},
-std::array<float,2>{0.828932762f, 0.578743339f},
-std::array<float,2>{0.199143976f, 0.261178583f},
-std::array<float,2>{0.657084167f, 0.184650213f},
-std::array<float,2>{0.333265245f, 0.800966561f},
-std::array<float,2>{0.518620074f, 0.960077584f},
-std::array<float,2>{0.446711957f, 0.0108603444f},
-std::array<float,2>{0.897916377f, 0.483783603f},
-std::array<float,2>{0.094019115f, 0.724958122f},
-std::array<float,2>{0.591263711f, 0.551533759f},
-std::array<float,2>{0.383441359f, 0.351262569f},
-std::array<float,2>{0.99161309f, 0.197601423f},
-std::array<float,2>{0.0487178005f, 0.819287539f},
-std::array<float,2>{0.778806388f, 0.904892206f},
-std::array<float,2>{0.153150797f, 0.104535036f},
-std::array<float,2>{0.740747333f, 0.388986617f},
-std::array<float,2>{0.272572339f, 0.662988424f},
-std::array<float,2>{0.922829866f, 0.71786952f},
-std::array<float,2>{0.0896347687f, 0.45486626f},
-std::array<float,2>{0.532031894f, 0.038139645f},
-std::array<float,2>{0.492910624f, 0.978064656f},
-std::array<float,2>{0.627552748f, 0.761598289f},
-std::array<float,2>{0.343966365f, 0.142632529f},
-std::array<float,2>{0.856649697f, 0.306307256f},
-std::array<float,2>{0.231593981f, 0.602435529f},
-std::array<float,2>{0.682756662f, 0.610421062f},
-std::array<float,2>{0.316274166f, 0.29459855f},
-std::array<float,2>{0.820191681f, 0.125476673f},
-std::array<float,2>{0.217876136f, 0.775819123f},
-std::array<float,2>{0.883571863f, 0.985990286f},
-std::array<float,2>{0.115394115f, 0.0499731936f},
-std::array<float,2>{0.504149497f, 0.451457918f},
-std::array<float,2>{0.454112679f, 0.701561451f},
-std::array<float,2>{0.804870307f, 0.685941458f},
-std::array<float,2>{0.172585174f, 0.4024131f},
-std::array<float,2>{0.689489007f, 0.114130497f},
-std::array<float,2>{0.295727253f, 0.884666741f},
-std::array<float,2>{0.624218524f, 0.828533173f},
-std::array<float,2>{0.413769782f, 0.210682407f},
-std::array<float,2>{0.960095942f, 0.361174345f},
-std::array<float,2>{0.0206910241f, 0.546392381f},
-std::array<float,2>{0.551715136f, 0.745118976f},
-std::array<float,2>{0.473355561f, 0.497006863f},
-std::array<float,2>{0.918578029f, 0.0247268341f},
-std::array<float,2>{0.0711615905f, 0.94176048f},
-std::array<float,2>{0.864422262f, 0.794977188f},
-std::array<float,2>{0.243757904f, 0.16339688f},
-std::array<float,2>{0.645134509f, 0.277305543f},
-std::array<float,2>{0.370494634f, 0.566632271f},
-std::array<float,2>{0.969074011f, 0.505904377f},
-std::array<float,2>{0.0366028696f, 0.322789431f},
-std::array<float,2>{0.571154058f, 0.221495509f},
-std::array<float,2>{0.398465723f, 0.85423702f},
-std::array<float,2>{0.723330915f, 0.934066534f},
-std::array<float,2>{0.265050769f, 0.0802630782f},
-std::array<float,2>{0.756711006f, 0.407270879f},
-std::array<float,2>{0.138338536f, 0.645209372f},
-std::array<float,2>{0.696736336f, 0.714231849f},
-std::array<float,2>{0.287588328f, 0.459456444f},
-std::array<float,2>{0.803160608f, 0.0338661075f},
-std::array<float,2>{0.184368163f, 0.98333776f},
-std::array<float,2>{0.966975868f, 0.76409781f},
-std::array<float,2>{0.0260444432f, 0.144545332f},
-std::array<float,2>{0.611742914f, 0.31121707f},
-std::array<float,2>{0.414710552f, 0.609108567f},
-std::array<float,2>{0.827771485f, 0.550767481f},
-std::array<float,2>{0.206690744f, 0.346192181f},
-std::array<float,2>{0.6793769f, 0.202213407f},
-std::array<float,2>{0.321990371f, 0.81271261f},
-std::array<float,2>{0.510364115f, 0.898782849f},
-std::array<float,2>{0.466756582f, 0.10759411f},
-std::array<float,2>{0.875452518f, 0.38338536f},
-std::array<float,2>{0.119765125f, 0.659693122f},
-std::array<float,2>{0.562929094f, 0.584117115f},
-std::array<float,2>{0.393801033f, 0.264508665f},
-std::array<float,2>{0.981237113f, 0.182635441f},
-std::array<float,2>{0.0424302295f, 0.800332069f},
-std::array<float,2>{0.76530093f, 0.955511868f},
-std::array<float,2>{0.131756753f, 0.0156012075f},
-std::array<float,2>{0.727306545f, 0.478260368f},
-std::array<float,2>{0.252132058f, 0.720357597f},
-std::array<float,2>{0.91397047f, 0.634034932f},
-std::array<float,2>{0.0656861737f, 0.436188817f},
-std::array<float,2>{0.55727011f, 0.0710519403f},
-std::array<float,2>{0.483033657f, 0.921409249f},
-std::array<float,2>{0.651606977f, 0.860747933f},
-std::array<float,2>{0.366695076f, 0.244928241f},
-std::array<float,2>{0.874879599f, 0.342644066f},
-std::array<float,2>{0.238292888f, 0.516486526f},
-std::array<float,2>{0.671137333f, 0.503039122f},
-std::array<float,2>{0.338939607f, 0.327851743f},
-std::array<float,2>{0.840977728f, 0.223983809f},
-std::array<float,2>{0.191164643f, 0.856404126f},
-std::array<float,2>{0.898880363f, 0.932952225f},
-std::array<float,2>{0.107308373f, 0.0856807232f},
-std::array<float,2>{0.530393898f, 0.413469851f},
-std::array<float,2>{0.44432348f, 0.642297864f},
-std::array<float,2>{0.791964114f, 0.74936223f},
-std::array<float,2>{0.16398558f, 0.49543795f},
-std::array<float,2>{0.705430567f, 0.0301077627f},
-std::array<float,2>{0.309337974f, 0.941131473f},
-std::array<float,2>{0.597955823f, 0.791371226f},
-std::array<float,2>{0.422990918f, 0.15728654f},
-std::array<float,2>{0.944597781f, 0.278263986f},
-std::array<float,2>{0.00966492109f, 0.563786745f},
-std::array<float,2>{0.540530205f, 0.679980159f},
-std::array<float,2>{0.486190587f, 0.399545252f},
-std::array<float,2>{0.931789815f, 0.111542672f},
-std::array<float,2>{0.0816170499f, 0.889700711f},
-std::array<float,2>{0.849197567f, 0.834699869f},
-std::array<float,2>{0.222431064f, 0.204249889f},
-std::array<float,2>{0.640259743f, 0.366642684f},
-std::array<float,2>{0.356089771f, 0.539915621f},
-std::array<float,2>{0.992883146f, 0.616596222f},
-std::array<float,2>{0.0565842837f, 0.290535837f},
-std::array<float,2>{0.585771263f, 0.132022902f},
-std::array<float,2>{0.378107786f, 0.780138612f},
-std::array<float,2>{0.747263908f, 0.991670668f},
-std::array<float,2>{0.275429666f, 0.0519252196f},
-std::array<float,2>{0.771998465f, 0.448175669f},
-std::array<float,2>{0.147973359f, 0.699155927f},
-std::array<float,2>{0.631352186f, 0.649798572f},
-std::array<float,2>{0.348034799f, 0.415574521f},
-std::array<float,2>{0.854893208f, 0.0902380645f},
-std::array<float,2>{0.22709851f, 0.924993157f},
-std::array<float,2>{0.926591694f, 0.846315682f},
-std::array<float,2>{0.0903455243f, 0.227503687f},
-std::array<float,2>{0.537491262f, 0.314761817f},
-std::array<float,2>{0.499035299f, 0.51341027f},
-std::array<float,2>{0.777236819f, 0.572980285f},
-std::array<float,2>{0.148538738f, 0.269910753f},
-std::array<float,2>{0.735857725f, 0.164778635f},
-std::array<float,2>{0.266917527f, 0.785404921f},
-std::array<float,2>{0.589334786f, 0.951984882f},
-std::array<float,2>{0.386822551f, 0.0168327037f},
-std::array<float,2>{0.98489666f, 0.48709777f},
-std::array<float,2>{0.0539889f, 0.739651859f},
-std::array<float,2>{0.519535065f, 0.537297487f},
-std::array<float,2>{0.452002764f, 0.370001137f},
-std::array<float,2>{0.893542349f, 0.218437061f},
-std::array<float,2>{0.100061215f, 0.840256453f},
-std::array<float,2>{0.83331418f, 0.877638757f},
-std::array<float,2>{0.200781316f, 0.124350809f},
-std::array<float,2>{0.661384046f, 0.391547233f},
-std::array<float,2>{0.330896616f, 0.67724514f},
-std::array<float,2>{0.951168418f, 0.689781666f},
-std::array<float,2>{0.00143510685f, 0.444640875f},
-std::array<float,2>{0.605566561f, 0.0561088622f},
-std::array<float,2>{0.434541464f, 0.997947037f},
-std::array<float,2>{0.711539149f, 0.772147775f},
-std::array<float,2>{0.297702521f, 0.135921806f},
-std::array<float,2>{0.78442806f, 0.281735659f},
-std::array<float,2>{0.165486038f, 0.620636225f},
-std::array<float,2>{0.721589267f, 0.596143126f},
-std::array<float,2>{0.259561479f, 0.304199547f},
-std::array<float,2>{0.751153171f, 0.151414096f},
-std::array<float,2>{0.13418752f, 0.753760517f},
-std::array<float,2>{0.976410568f, 0.976002574f},
-std::array<float,2>{0.032182049f, 0.0395998843f},
-std::array<float,2>{0.576208651f, 0.464943498f},
-std::array<float,2>{0.405132741f, 0.709061921f},
-std::array<float,2>{0.861181319f, 0.667138457f},
-std::array<float,2>{0.246243551f, 0.380108207f},
-std::array<float,2>{0.643663883f, 0.101080626f},
-std::array<float,2>{0.374715149f, 0.896382809f},
-std::array<float,2>{0.549176335f, 0.827684939f},
-std::array<float,2>{0.470218152f, 0.190593779f},
-std::array<float,2>{0.917789459f, 0.353170484f},
-std::array<float,2>{0.0776151195f, 0.555965662f},
-std::array<float,2>{0.618344486f, 0.73107028f},
-std::array<float,2>{0.4084934f, 0.470144272f},
-std::array<float,2>{0.95541358f, 0.00226560608f},
-std::array<float,2>{0.0191637408f, 0.964861453f},
-std::array<float,2>{0.808837473f, 0.806448281f},
-std::array<float,2>{0.177037463f, 0.179264918f},
-std::array<float,2>{0.692427337f, 0.255313128f},
-std::array<float,2>{0.290075451f, 0.58932507f},
-std::array<float,2>{0.888820648f, 0.524159431f},
-std::array<float,2>{0.112736903f, 0.329950362f},
-std::array<float,2>{0.502188623f, 0.236159921f},
-std::array<float,2>{0.457660526f, 0.871177137f},
-std::array<float,2>{0.684316397f, 0.908937693f},
-std::array<float,2>{0.316897482f, 0.0648102984f},
-std::array<float,2>{0.814617634f, 0.428730637f},
-std::array<float,2>{0.214144841f, 0.627313197f},
-std::array<float,2>{0.674948692f, 0.736259103f},
-std::array<float,2>{0.325239003f, 0.490649253f},
-std::array<float,2>{0.821881175f, 0.0203593671f},
-std::array<float,2>{0.207335189f, 0.949200809f},
-std::array<float,2>{0.880405366f, 0.784574628f},
-std::array<float,2>{0.124897987f, 0.169668823f},
-std::array<float,2>{0.512656689f, 0.267338485f},
-std::array<float,2>{0.461037666f, 0.576230228f},
-std::array<float,2>{0.800481439f, 0.51009196f},
-std::array<float,2>{0.182459846f, 0.318960011f},
-std::array<float,2>{0.699513435f, 0.232349783f},
-std::array<float,2>{0.282955408f, 0.850865543f},
-std::array<float,2>{0.614176095f, 0.928870857f},
-std::array<float,2>{0.421252578f, 0.0882635713f},
-std::array<float,2>{0.964515448f, 0.418093026f},
-std::array<float,2>{0.0301268883f, 0.655510485f},
-std::array<float,2>{0.561623752f, 0.624162495f},
-std::array<float,2>{0.477021784f, 0.287781835f},
-std::array<float,2>{0.907847106f, 0.139017716f},
-std::array<float,2>{0.067363359f, 0.767865002f},
-std::array<float,2>{0.868541181f, 0.993622005f},
-std::array<float,2>{0.236717716f, 0.0588731766f},
-std::array<float,2>{0.656107306f, 0.440128356f},
-std::array<float,2>{0.362475723f, 0.691940963f},
-std::array<float,2>{0.97960484f, 0.674359083f},
-std::array<float,2>{0.043629542f, 0.39754504f},
-std::array<float,2>{0.567101598f, 0.118036762f},
-std::array<float,2>{0.397695929f, 0.881991744f},
-std::array<float,2>{0.731596947f, 0.839401424f},
-std::array<float,2>{0.254452884f, 0.212221041f},
-std::array<float,2>{0.759826124f, 0.373764098f},
-std::array<float,2>{0.125078782f, 0.533301115f},
-std::array<float,2>{0.709862471f, 0.562426984f},
-std::array<float,2>{0.306760699f, 0.356400609f},
-std::array<float,2>{0.795457304f, 0.195241019f},
-std::array<float,2>{0.158858776f, 0.822869301f},
-std::array<float,2>{0.941119373f, 0.893411338f},
-std::array<float,2>{0.0144527052f, 0.0976378396f},
-std::array<float,2>{0.593911588f, 0.375105649f},
-std::array<float,2>{0.426244527f, 0.670884311f},
-std::array<float,2>{0.837750614f, 0.70640409f},
-std::array<float,2>{0.193027914f, 0.464468628f},
-std::array<float,2>{0.665369511f, 0.0461315587f},
-std::array<float,2>{0.343160093f, 0.971353412f},
-std::array<float,2>{0.523549855f, 0.75600034f},
-std::array<float,2>{0.439861983f, 0.153095394f},
-std::array<float,2>{0.90353471f, 0.296883017f},
-std::array<float,2>{0.104894765f, 0.599531174f},
-std::array<float,2>{0.578790247f, 0.631036937f},
-std::array<float,2>{0.382707685f, 0.42236799f},
-std::array<float,2>{0.997294128f, 0.069285959f},
-std::array<float,2>{0.0619288646f, 0.910789907f},
-std::array<float,2>{0.768284678f, 0.870541632f},
-std::array<float,2>{0.14114058f, 0.239355788f},
-std::array<float,2>{0.744762182f, 0.333046138f},
-std::array<float,2>{0.281033099f, 0.529759347f},
-std::array<float,2>{0.9352265f, 0.591610312f},
-std::array<float,2>{0.0852592811f, 0.251739562f},
-std::array<float,2>{0.543662667f, 0.174653918f},
-std::array<float,2>{0.489370227f, 0.809830725f},
-std::array<float,2>{0.634928048f, 0.96324873f},
-std::array<float,2>{0.352983564f, 0.00565807475f},
-std::array<float,2>{0.845453143f, 0.473153144f},
-std::array<float,2>{0.222885147f, 0.727508724f},
-std::array<float,2>{0.739222944f, 0.661312222f},
-std::array<float,2>{0.269667566f, 0.388322115f},
-std::array<float,2>{0.779566646f, 0.103149921f},
-std::array<float,2>{0.154971018f, 0.903055668f},
-std::array<float,2>{0.98884213f, 0.817133367f},
-std::array<float,2>{0.0492819324f, 0.196949914f},
-std::array<float,2>{0.59216249f, 0.348870993f},
-std::array<float,2>{0.385212153f, 0.553559542f},
-std::array<float,2>{0.859373748f, 0.603585362f},
-std::array<float,2>{0.233282641f, 0.307288915f},
-std::array<float,2>{0.62673974f, 0.142089278f},
-std::array<float,2>{0.346891642f, 0.758498132f},
-std::array<float,2>{0.534840882f, 0.980423152f},
-std::array<float,2>{0.495314807f, 0.0356091112f},
-std::array<float,2>{0.925644219f, 0.456634551f},
-std::array<float,2>{0.0878896788f, 0.71579057f},
-std::array<float,2>{0.604459703f, 0.522572696f},
-std::array<float,2>{0.431508601f, 0.337246329f},
-std::array<float,2>{0.947503269f, 0.246645972f},
-std::array<float,2>{0.00484380033f, 0.866956532f},
-std::array<float,2>{0.786910534f, 0.915680885f},
-std::array<float,2>{0.169948265f, 0.0755695403f},
-std::array<float,2>{0.717602015f, 0.431450933f},
-std::array<float,2>{0.301191598f, 0.640296996f},
-std::array<float,2>{0.895247519f, 0.724158704f},
-std::array<float,2>{0.0973954275f, 0.480735153f},
-std::array<float,2>{0.517380178f, 0.00867477804f},
-std::array<float,2>{0.448437363f, 0.958499312f},
-std::array<float,2>{0.658515275f, 0.803515017f},
-std::array<float,2>{0.334351033f, 0.186625838f},
-std::array<float,2>{0.830246627f, 0.25860399f},
-std::array<float,2>{0.195854202f, 0.580523729f},
-std::array<float,2>{0.647135019f, 0.568394601f},
-std::array<float,2>{0.368247867f, 0.274709284f},
-std::array<float,2>{0.867004573f, 0.160581917f},
-std::array<float,2>{0.245337486f, 0.794654727f},
-std::array<float,2>{0.921416223f, 0.945036411f},
-std::array<float,2>{0.0728507563f, 0.0260270108f},
-std::array<float,2>{0.553851306f, 0.499774098f},
-std::array<float,2>{0.474795938f, 0.743569374f},
-std::array<float,2>{0.754391193f, 0.64672637f},
-std::array<float,2>{0.138805375f, 0.408905625f},
-std::array<float,2>{0.726027668f, 0.0795978382f},
-std::array<float,2>{0.262530535f, 0.935813963f},
-std::array<float,2>{0.572595894f, 0.85212791f},
-std::array<float,2>{0.401592642f, 0.220667198f},
-std::array<float,2>{0.971223891f, 0.322229207f},
-std::array<float,2>{0.0375240892f, 0.505571127f},
-std::array<float,2>{0.50731194f, 0.701145053f},
-std::array<float,2>{0.456469327f, 0.45018822f},
-std::array<float,2>{0.885755539f, 0.0473823659f},
-std::array<float,2>{0.113407783f, 0.986588418f},
-std::array<float,2>{0.817320764f, 0.773525774f},
-std::array<float,2>{0.215525314f, 0.128281549f},
-std::array<float,2>{0.681604803f, 0.295179695f},
-std::array<float,2>{0.313261032f, 0.613035977f},
-std::array<float,2>{0.958215177f, 0.544410944f},
-std::array<float,2>{0.0220736824f, 0.361717671f},
-std::array<float,2>{0.621629298f, 0.207745746f},
-std::array<float,2>{0.410843581f, 0.83013308f},
-std::array<float,2>{0.68750304f, 0.885968864f},
-std::array<float,2>{0.293531179f, 0.116779462f},
-std::array<float,2>{0.807359219f, 0.404459178f},
-std::array<float,2>{0.174978793f, 0.684167564f},
-std::array<float,2>{0.748768628f, 0.697778463f},
-std::array<float,2>{0.274862409f, 0.44886452f},
-std::array<float,2>{0.771452904f, 0.0514258519f},
-std::array<float,2>{0.146283999f, 0.991141379f},
-std::array<float,2>{0.994412005f, 0.780841887f},
-std::array<float,2>{0.0583525524f, 0.131824613f},
-std::array<float,2>{0.582138658f, 0.289266497f},
-std::array<float,2>{0.375467658f, 0.615956545f},
-std::array<float,2>{0.850925982f, 0.540372014f},
-std::array<float,2>{0.220072106f, 0.365544111f},
-std::array<float,2>{0.637238085f, 0.203893214f},
-std::array<float,2>{0.35829547f, 0.835901678f},
-std::array<float,2>{0.542784572f, 0.888921499f},
-std::array<float,2>{0.486927271f, 0.113053024f},
-std::array<float,2>{0.930574119f, 0.398787379f},
-std::array<float,2>{0.079169713f, 0.680801809f},
-std::array<float,2>{0.601103961f, 0.562572837f},
-std::array<float,2>{0.424577147f, 0.279118299f},
-std::array<float,2>{0.94242394f, 0.157046095f},
-std::array<float,2>{0.0107965507f, 0.792798638f},
-std::array<float,2>{0.790819824f, 0.93963486f},
-std::array<float,2>{0.161988199f, 0.0307856631f},
-std::array<float,2>{0.704963744f, 0.494276792f},
-std::array<float,2>{0.312321097f, 0.74812758f},
-std::array<float,2>{0.90064621f, 0.641532183f},
-std::array<float,2>{0.109220698f, 0.412201524f},
-std::array<float,2>{0.527865469f, 0.0844361633f},
-std::array<float,2>{0.443138599f, 0.931679666f},
-std::array<float,2>{0.669030666f, 0.856774509f},
-std::array<float,2>{0.337262899f, 0.223161668f},
-std::array<float,2>{0.843313813f, 0.326425821f},
-std::array<float,2>{0.188821301f, 0.502274334f},
-std::array<float,2>{0.649749458f, 0.516911447f},
-std::array<float,2>{0.363562405f, 0.343100429f},
-std::array<float,2>{0.872658968f, 0.245203838f},
-std::array<float,2>{0.240333065f, 0.86018765f},
-std::array<float,2>{0.911920846f, 0.920075655f},
-std::array<float,2>{0.063426666f, 0.0721592158f},
-std::array<float,2>{0.555714726f, 0.437483341f},
-std::array<float,2>{0.481273711f, 0.633006752f},
-std::array<float,2>{0.762652934f, 0.719136775f},
-std::array<float,2>{0.129024759f, 0.476604015f},
-std::array<float,2>{0.728830338f, 0.0140698934f},
-std::array<float,2>{0.250504375f, 0.956284523f},
-std::array<float,2>{0.565784693f, 0.799794376f},
-std::array<float,2>{0.391566753f, 0.182557479f},
-std::array<float,2>{0.983107209f, 0.265299946f},
-std::array<float,2>{0.0393427573f, 0.585082293f},
-std::array<float,2>{0.50798279f, 0.658806205f},
-std::array<float,2>{0.468450308f, 0.384297401f},
-std::array<float,2>{0.878651321f, 0.109022312f},
-std::array<float,2>{0.117275342f, 0.900069833f},
-std::array<float,2>{0.825175524f, 0.814159214f},
-std::array<float,2>{0.204438537f, 0.201822087f},
-std::array<float,2>{0.677025497f, 0.347113758f},
-std::array<float,2>{0.323597938f, 0.54940176f},
-std::array<float,2>{0.96533519f, 0.607850134f},
-std::array<float,2>{0.0249221828f, 0.311888576f},
-std::array<float,2>{0.611132264f, 0.146429256f},
-std::array<float,2>{0.416448146f, 0.764750957f},
-std::array<float,2>{0.699169576f, 0.984337628f},
-std::array<float,2>{0.28628698f, 0.0342295952f},
-std::array<float,2>{0.80168426f, 0.460047811f},
-std::array<float,2>{0.185555682f, 0.713001251f},
-std::array<float,2>{0.686601222f, 0.628520906f},
-std::array<float,2>{0.319331229f, 0.427857399f},
-std::array<float,2>{0.814450562f, 0.0660223663f},
-std::array<float,2>{0.212672204f, 0.909689367f},
-std::array<float,2>{0.888048768f, 0.872849345f},
-std::array<float,2>{0.111192264f, 0.23514162f},
-std::array<float,2>{0.500560284f, 0.328661501f},
-std::array<float,2>{0.460329533f, 0.524553716f},
-std::array<float,2>{0.81067723f, 0.587946296f},
-std::array<float,2>{0.179189011f, 0.253912657f},
-std::array<float,2>{0.695233583f, 0.178389117f},
-std::array<float,2>{0.29128021f, 0.804951072f},
-std::array<float,2>{0.619420886f, 0.965974867f},
-std::array<float,2>{0.407926559f, 0.00343112391f},
-std::array<float,2>{0.954201341f, 0.469045162f},
-std::array<float,2>{0.0163051505f, 0.731557965f},
-std::array<float,2>{0.547655702f, 0.55515343f},
-std::array<float,2>{0.472126335f, 0.351756245f},
-std::array<float,2>{0.915798724f, 0.189483702f},
-std::array<float,2>{0.0754419342f, 0.826228619f},
-std::array<float,2>{0.862940133f, 0.894997656f},
-std::array<float,2>{0.248630419f, 0.10052333f},
-std::array<float,2>{0.6417377f, 0.379612416f},
-std::array<float,2>{0.371792793f, 0.666758776f},
-std::array<float,2>{0.974496424f, 0.710879922f},
-std::array<float,2>{0.033463344f, 0.466400921f},
-std::array<float,2>{0.575002968f, 0.0407708958f},
-std::array<float,2>{0.403505057f, 0.974618375f},
-std::array<float,2>{0.719982564f, 0.752730608f},
-std::array<float,2>{0.260929108f, 0.150510296f},
-std::array<float,2>{0.751983881f, 0.303123444f},
-std::array<float,2>{0.135241449f, 0.597635031f},
-std::array<float,2>{0.714342535f, 0.619590938f},
-std::array<float,2>{0.299547136f, 0.282770514f},
-std::array<float,2>{0.78242743f, 0.134900615f},
-std::array<float,2>{0.167600915f, 0.772965193f},
-std::array<float,2>{0.952552497f, 0.996601641f},
-std::array<float,2>{0.00199604291f, 0.0555849485f},
-std::array<float,2>{0.607818723f, 0.443370283f},
-std::array<float,2>{0.436155617f, 0.690995634f},
-std::array<float,2>{0.835508823f, 0.675888479f},
-std::array<float,2>{0.202023789f, 0.392020851f},
-std::array<float,2>{0.66215688f, 0.123472013f},
-std::array<float,2>{0.329602659f, 0.878139436f},
-std::array<float,2>{0.522743046f, 0.8414011f},
-std::array<float,2>{0.449840277f, 0.217415705f},
-std::array<float,2>{0.891041875f, 0.370427489f},
-std::array<float,2>{0.0984627679f, 0.538281441f},
-std::array<float,2>{0.586166501f, 0.738328278f},
-std::array<float,2>{0.390353054f, 0.487371802f},
-std::array<float,2>{0.986442685f, 0.0163845774f},
-std::array<float,2>{0.0524904169f, 0.952511966f},
-std::array<float,2>{0.774851918f, 0.7865206f},
-std::array<float,2>{0.151957527f, 0.165610537f},
-std::array<float,2>{0.737122059f, 0.271101713f},
-std::array<float,2>{0.269064754f, 0.573276699f},
-std::array<float,2>{0.928084731f, 0.511919379f},
-std::array<float,2>{0.0920892879f, 0.316204607f},
-std::array<float,2>{0.536648095f, 0.228411958f},
-std::array<float,2>{0.497167051f, 0.846748531f},
-std::array<float,2>{0.630647123f, 0.924309611f},
-std::array<float,2>{0.349637747f, 0.0912100375f},
-std::array<float,2>{0.852184653f, 0.414760828f},
-std::array<float,2>{0.229520932f, 0.648934782f},
-std::array<float,2>{0.63310504f, 0.728318334f},
-std::array<float,2>{0.354819506f, 0.474299014f},
-std::array<float,2>{0.846080899f, 0.00471680099f},
-std::array<float,2>{0.225494549f, 0.964474201f},
-std::array<float,2>{0.937420428f, 0.809313893f},
-std::array<float,2>{0.0832171887f, 0.17543532f},
-std::array<float,2>{0.546772718f, 0.250925899f},
-std::array<float,2>{0.491687626f, 0.590199769f},
-std::array<float,2>{0.765961409f, 0.530310929f},
-std::array<float,2>{0.144254401f, 0.332119823f},
-std::array<float,2>{0.743852496f, 0.239198804f},
-std::array<float,2>{0.278592736f, 0.869853854f},
-std::array<float,2>{0.581374049f, 0.911635578f},
-std::array<float,2>{0.380608827f, 0.0700868443f},
-std::array<float,2>{0.998720407f, 0.423226058f},
-std::array<float,2>{0.0603114851f, 0.63209796f},
-std::array<float,2>{0.525595546f, 0.597906888f},
-std::array<float,2>{0.437604547f, 0.298023194f},
-std::array<float,2>{0.905248225f, 0.153351143f},
-std::array<float,2>{0.103224933f, 0.757736027f},
-std::array<float,2>{0.839792967f, 0.971793771f},
-std::array<float,2>{0.195209414f, 0.0452260897f},
-std::array<float,2>{0.666109502f, 0.463306904f},
-std::array<float,2>{0.340866774f, 0.705693543f},
-std::array<float,2>{0.939080179f, 0.671494126f},
-std::array<float,2>{0.013497822f, 0.376328915f},
-std::array<float,2>{0.59749496f, 0.096494399f},
-std::array<float,2>{0.428661495f, 0.894063532f},
-std::array<float,2>{0.708562672f, 0.824131548f},
-std::array<float,2>{0.305906266f, 0.194117755f},
-std::array<float,2>{0.793123841f, 0.35669139f},
-std::array<float,2>{0.156318039f, 0.560812533f},
-std::array<float,2>{0.733328342f, 0.534781873f},
-std::array<float,2>{0.256556451f, 0.374823898f},
-std::array<float,2>{0.759299278f, 0.211003751f},
-std::array<float,2>{0.128003433f, 0.838336051f},
-std::array<float,2>{0.977247655f, 0.88128823f},
-std::array<float,2>{0.0464789607f, 0.119021177f},
-std::array<float,2>{0.568684638f, 0.396656901f},
-std::array<float,2>{0.395864934f, 0.67495811f},
-std::array<float,2>{0.869743943f, 0.692387164f},
-std::array<float,2>{0.23476088f, 0.440685302f},
-std::array<float,2>{0.65406996f, 0.0604672916f},
-std::array<float,2>{0.360675871f, 0.992360055f},
-std::array<float,2>{0.560132682f, 0.76893729f},
-std::array<float,2>{0.480219692f, 0.139788449f},
-std::array<float,2>{0.90904808f, 0.288121551f},
-std::array<float,2>{0.0684609115f, 0.623766303f},
-std::array<float,2>{0.617152035f, 0.654456198f},
-std::array<float,2>{0.418361157f, 0.419018984f},
-std::array<float,2>{0.961589813f, 0.0895431563f},
-std::array<float,2>{0.0275069308f, 0.928658426f},
-std::array<float,2>{0.797557354f, 0.850527406f},
-std::array<float,2>{0.180013537f, 0.231241256f},
-std::array<float,2>{0.701623857f, 0.32000035f},
-std::array<float,2>{0.283839017f, 0.511664152f},
-std::array<float,2>{0.880966306f, 0.577575505f},
-std::array<float,2>{0.122270815f, 0.265981555f},
-std::array<float,2>{0.515550673f, 0.168024868f},
-std::array<float,2>{0.464590669f, 0.783846855f},
-std::array<float,2>{0.672352672f, 0.947349906f},
-std::array<float,2>{0.326348692f, 0.0212573372f},
-std::array<float,2>{0.822965562f, 0.491520107f},
-std::array<float,2>{0.209546596f, 0.734987676f},
-std::array<float,2>{0.690812051f, 0.685243368f},
-std::array<float,2>{0.296477377f, 0.405326277f},
-std::array<float,2>{0.806045175f, 0.115660116f},
-std::array<float,2>{0.173223048f, 0.885317802f},
-std::array<float,2>{0.959398866f, 0.831441224f},
-std::array<float,2>{0.0204434711f, 0.208601147f},
-std::array<float,2>{0.623853385f, 0.363002181f},
-std::array<float,2>{0.412933439f, 0.543886006f},
-std::array<float,2>{0.818864584f, 0.611463368f},
-std::array<float,2>{0.216958225f, 0.296367407f},
-std::array<float,2>{0.68211472f, 0.127353996f},
-std::array<float,2>{0.314700902f, 0.775305867f},
-std::array<float,2>{0.504963279f, 0.987669647f},
-std::array<float,2>{0.453715116f, 0.0485692248f},
-std::array<float,2>{0.883893967f, 0.450248152f},
-std::array<float,2>{0.117107898f, 0.699861169f},
-std::array<float,2>{0.572146356f, 0.504534781f},
-std::array<float,2>{0.400126636f, 0.321267217f},
-std::array<float,2>{0.970474124f, 0.219575211f},
-std::array<float,2>{0.0358718112f, 0.852928817f},
-std::array<float,2>{0.757356405f, 0.936589658f},
-std::array<float,2>{0.136841699f, 0.0790060163f},
-std::array<float,2>{0.723686457f, 0.409375161f},
-std::array<float,2>{0.264133722f, 0.647733152f},
-std::array<float,2>{0.919386446f, 0.74241066f},
-std::array<float,2>{0.0720429495f, 0.498709798f},
-std::array<float,2>{0.552577078f, 0.0264513232f},
-std::array<float,2>{0.474413723f, 0.944190264f},
-std::array<float,2>{0.646341741f, 0.793239832f},
-std::array<float,2>{0.369320154f, 0.16172114f},
-std::array<float,2>{0.864220083f, 0.273565829f},
-std::array<float,2>{0.243082121f, 0.570239544f},
-std::array<float,2>{0.657522798f, 0.581777275f},
-std::array<float,2>{0.332929552f, 0.259628713f},
-std::array<float,2>{0.829758048f, 0.185750753f},
-std::array<float,2>{0.197991475f, 0.804022014f},
-std::array<float,2>{0.897365868f, 0.957793474f},
-std::array<float,2>{0.0954017043f, 0.00922526699f},
-std::array<float,2>{0.518102348f, 0.482236743f},
-std::array<float,2>{0.446125358f, 0.723075032f},
-std::array<float,2>{0.788574159f, 0.63944006f},
-std::array<float,2>{0.16973795f, 0.430113703f},
-std::array<float,2>{0.715890229f, 0.0742895901f},
-std::array<float,2>{0.304352283f, 0.91413784f},
-std::array<float,2>{0.603502035f, 0.866139412f},
-std::array<float,2>{0.433247924f, 0.247071266f},
-std::array<float,2>{0.945970118f, 0.336560816f},
-std::array<float,2>{0.00684231473f, 0.521934509f},
-std::array<float,2>{0.532552898f, 0.716523767f},
-std::array<float,2>{0.493391186f, 0.456036717f},
-std::array<float,2>{0.923679709f, 0.0370588452f},
-std::array<float,2>{0.0885077491f, 0.978762567f},
-std::array<float,2>{0.8557446f, 0.759043276f},
-std::array<float,2>{0.230748743f, 0.141355336f},
-std::array<float,2>{0.628091395f, 0.30793047f},
-std::array<float,2>{0.345159262f, 0.604936957f},
-std::array<float,2>{0.991164625f, 0.55451405f},
-std::array<float,2>{0.0474513024f, 0.348362327f},
-std::array<float,2>{0.590208292f, 0.19552815f},
-std::array<float,2>{0.383999437f, 0.818326652f},
-std::array<float,2>{0.741379559f, 0.904198587f},
-std::array<float,2>{0.271671027f, 0.101747274f},
-std::array<float,2>{0.778206348f, 0.386736959f},
-std::array<float,2>{0.153539553f, 0.661127031f},
-std::array<float,2>{0.70657599f, 0.747266948f},
-std::array<float,2>{0.310108483f, 0.493956149f},
-std::array<float,2>{0.792861521f, 0.0274799336f},
-std::array<float,2>{0.16264984f, 0.939172506f},
-std::array<float,2>{0.944127738f, 0.789292336f},
-std::array<float,2>{0.00800960511f, 0.158859298f},
-std::array<float,2>{0.599494159f, 0.280279756f},
-std::array<float,2>{0.42270419f, 0.564498901f},
-std::array<float,2>{0.840739846f, 0.50045532f},
-std::array<float,2>{0.189976677f, 0.324877113f},
-std::array<float,2>{0.670832157f, 0.225616872f},
-std::array<float,2>{0.338182658f, 0.858340621f},
-std::array<float,2>{0.53026849f, 0.930581689f},
-std::array<float,2>{0.444658965f, 0.0832856297f},
-std::array<float,2>{0.90015322f, 0.410672545f},
-std::array<float,2>{0.10607627f, 0.643162429f},
-std::array<float,2>{0.584258735f, 0.613948643f},
-std::array<float,2>{0.377187878f, 0.292625397f},
-std::array<float,2>{0.993324399f, 0.129370049f},
-std::array<float,2>{0.0554360896f, 0.777715385f},
-std::array<float,2>{0.773031116f, 0.988595545f},
-std::array<float,2>{0.146967858f, 0.0539464876f},
-std::array<float,2>{0.746761084f, 0.445967972f},
-std::array<float,2>{0.277166605f, 0.697129428f},
-std::array<float,2>{0.933344185f, 0.682891905f},
-std::array<float,2>{0.0803788751f, 0.401360929f},
-std::array<float,2>{0.539684892f, 0.110444136f},
-std::array<float,2>{0.484647959f, 0.888641834f},
-std::array<float,2>{0.639199734f, 0.833580315f},
-std::array<float,2>{0.356493711f, 0.206516668f},
-std::array<float,2>{0.848454177f, 0.364801347f},
-std::array<float,2>{0.220727891f, 0.542962193f},
-std::array<float,2>{0.6781739f, 0.548708856f},
-std::array<float,2>{0.320959866f, 0.343826264f},
-std::array<float,2>{0.826798201f, 0.199299663f},
-std::array<float,2>{0.205245644f, 0.815571487f},
-std::array<float,2>{0.876317918f, 0.901929855f},
-std::array<float,2>{0.121000737f, 0.10664659f},
-std::array<float,2>{0.511628568f, 0.386299402f},
-std::array<float,2>{0.465368658f, 0.656406999f},
-std::array<float,2>{0.804564416f, 0.71154201f},
-std::array<float,2>{0.184715286f, 0.457417041f},
-std::array<float,2>{0.695619226f, 0.0329717956f},
-std::array<float,2>{0.288618118f, 0.980607092f},
-std::array<float,2>{0.612553298f, 0.762493193f},
-std::array<float,2>{0.416004211f, 0.148286581f},
-std::array<float,2>{0.968207479f, 0.309543878f},
-std::array<float,2>{0.0269345846f, 0.606086135f},
-std::array<float,2>{0.558246613f, 0.635138512f},
-std::array<float,2>{0.484361976f, 0.43458271f},
-std::array<float,2>{0.912385166f, 0.0730058849f},
-std::array<float,2>{0.0648657307f, 0.919037402f},
-std::array<float,2>{0.873253286f, 0.862742245f},
-std::array<float,2>{0.240008324f, 0.243285269f},
-std::array<float,2>{0.651201725f, 0.34165135f},
-std::array<float,2>{0.365833014f, 0.518135965f},
-std::array<float,2>{0.98184371f, 0.582997739f},
-std::array<float,2>{0.0416935757f, 0.262102008f},
-std::array<float,2>{0.563842118f, 0.180598393f},
-std::array<float,2>{0.392861664f, 0.797996044f},
-std::array<float,2>{0.728389025f, 0.953267753f},
-std::array<float,2>{0.253175825f, 0.0117712878f},
-std::array<float,2>{0.764647305f, 0.478886604f},
-std::array<float,2>{0.13262026f, 0.721055865f},
-std::array<float,2>{0.642715633f, 0.664352953f},
-std::array<float,2>{0.373622328f, 0.381024599f},
-std::array<float,2>{0.859890819f, 0.097961612f},
-std::array<float,2>{0.248010918f, 0.896536708f},
-std::array<float,2>{0.916695833f, 0.824903786f},
-std::array<float,2>{0.0762533769f, 0.189158365f},
-std::array<float,2>{0.549957454f, 0.353703439f},
-std::array<float,2>{0.468774438f, 0.557923019f},
-std::array<float,2>{0.75097549f, 0.595084131f},
-std::array<float,2>{0.133017212f, 0.301808715f},
-std::array<float,2>{0.722006321f, 0.14985691f},
-std::array<float,2>{0.258559704f, 0.750863612f},
-std::array<float,2>{0.577666402f, 0.97307241f},
-std::array<float,2>{0.405973822f, 0.0411716327f},
-std::array<float,2>{0.974632144f, 0.466848522f},
-std::array<float,2>{0.0323261507f, 0.70717144f},
-std::array<float,2>{0.5036484f, 0.52555424f},
-std::array<float,2>{0.458726287f, 0.330988616f},
-std::array<float,2>{0.889850974f, 0.236472458f},
-std::array<float,2>{0.112032637f, 0.874706805f},
-std::array<float,2>{0.816276968f, 0.907501161f},
-std::array<float,2>{0.213202491f, 0.0626624599f},
-std::array<float,2>{0.684681535f, 0.427705288f},
-std::array<float,2>{0.317663252f, 0.626297116f},
-std::array<float,2>{0.956681013f, 0.732797801f},
-std::array<float,2>{0.0183396284f, 0.472463369f},
-std::array<float,2>{0.617208302f, 0.0010659562f},
-std::array<float,2>{0.409424514f, 0.967006028f},
-std::array<float,2>{0.691618025f, 0.807092249f},
-std::array<float,2>{0.289490849f, 0.176214933f},
-std::array<float,2>{0.810026109f, 0.256817907f},
-std::array<float,2>{0.176036716f, 0.587793112f},
-std::array<float,2>{0.735170066f, 0.571745276f},
-std::array<float,2>{0.266450673f, 0.272689611f},
-std::array<float,2>{0.775409937f, 0.166639224f},
-std::array<float,2>{0.150146946f, 0.787644088f},
-std::array<float,2>{0.985646665f, 0.950660288f},
-std::array<float,2>{0.0536384918f, 0.0191381369f},
-std::array<float,2>{0.587966144f, 0.485903591f},
-std::array<float,2>{0.388057739f, 0.740800619f},
-std::array<float,2>{0.853640139f, 0.651618302f},
-std::array<float,2>{0.227676377f, 0.416668355f},
-std::array<float,2>{0.632138729f, 0.0927032307f},
-std::array<float,2>{0.348710299f, 0.923564374f},
-std::array<float,2>{0.538552761f, 0.845276773f},
-std::array<float,2>{0.498344958f, 0.229143396f},
-std::array<float,2>{0.927112997f, 0.314109832f},
-std::array<float,2>{0.0908912867f, 0.513710856f},
-std::array<float,2>{0.606679976f, 0.689087927f},
-std::array<float,2>{0.434885532f, 0.44261992f},
-std::array<float,2>{0.950137615f, 0.0574187487f},
-std::array<float,2>{0.000521124981f, 0.998812735f},
-std::array<float,2>{0.78363508f, 0.770798087f},
-std::array<float,2>{0.164489403f, 0.133344978f},
-std::array<float,2>{0.712249994f, 0.283759445f},
-std::array<float,2>{0.298309922f, 0.617364466f},
-std::array<float,2>{0.894047379f, 0.535396576f},
-std::array<float,2>{0.100804448f, 0.368829072f},
-std::array<float,2>{0.521003008f, 0.21597226f},
-std::array<float,2>{0.452668011f, 0.842524886f},
-std::array<float,2>{0.660531223f, 0.876566947f},
-std::array<float,2>{0.331737548f, 0.121741064f},
-std::array<float,2>{0.832792997f, 0.392718881f},
-std::array<float,2>{0.199755833f, 0.678468704f},
-std::array<float,2>{0.664722741f, 0.704880357f},
-std::array<float,2>{0.342000961f, 0.461784154f},
-std::array<float,2>{0.836631298f, 0.043638438f},
-std::array<float,2>{0.191970602f, 0.969920397f},
-std::array<float,2>{0.902514935f, 0.755129039f},
-std::array<float,2>{0.104331076f, 0.155187339f},
-std::array<float,2>{0.524706066f, 0.298897058f},
-std::array<float,2>{0.440658748f, 0.600431025f},
-std::array<float,2>{0.796099305f, 0.559787333f},
-std::array<float,2>{0.159803987f, 0.35865742f},
-std::array<float,2>{0.710323989f, 0.192143187f},
-std::array<float,2>{0.307860792f, 0.821111619f},
-std::array<float,2>{0.595219016f, 0.89201647f},
-std::array<float,2>{0.427070439f, 0.095189169f},
-std::array<float,2>{0.94004035f, 0.377649665f},
-std::array<float,2>{0.0146654528f, 0.669704258f},
-std::array<float,2>{0.54413867f, 0.592549682f},
-std::array<float,2>{0.489240378f, 0.253135353f},
-std::array<float,2>{0.934045732f, 0.17275396f},
-std::array<float,2>{0.0841643065f, 0.810861707f},
-std::array<float,2>{0.844094157f, 0.96100086f},
-std::array<float,2>{0.22363846f, 0.00650006812f},
-std::array<float,2>{0.635761082f, 0.475108653f},
-std::array<float,2>{0.352495432f, 0.728836477f},
-std::array<float,2>{0.996341944f, 0.630480647f},
-std::array<float,2>{0.0605846196f, 0.42424491f},
-std::array<float,2>{0.580044389f, 0.0676122159f},
-std::array<float,2>{0.381008863f, 0.913448274f},
-std::array<float,2>{0.745691895f, 0.867428184f},
-std::array<float,2>{0.280039907f, 0.241088361f},
-std::array<float,2>{0.768979251f, 0.335192442f},
-std::array<float,2>{0.142033711f, 0.529159844f},
-std::array<float,2>{0.700899243f, 0.508726001f},
-std::array<float,2>{0.282221258f, 0.317973733f},
-std::array<float,2>{0.799509585f, 0.234122485f},
-std::array<float,2>{0.183220506f, 0.848835528f},
-std::array<float,2>{0.963230312f, 0.927006364f},
-std::array<float,2>{0.0304170251f, 0.0865812004f},
-std::array<float,2>{0.614408791f, 0.421701372f},
-std::array<float,2>{0.420239687f, 0.653514683f},
-std::array<float,2>{0.820560098f, 0.7372545f},
-std::array<float,2>{0.208309799f, 0.488740504f},
-std::array<float,2>{0.67438525f, 0.0219336338f},
-std::array<float,2>{0.324699283f, 0.946104884f},
-std::array<float,2>{0.51297307f, 0.781916499f},
-std::array<float,2>{0.46199283f, 0.171238601f},
-std::array<float,2>{0.879429042f, 0.268450379f},
-std::array<float,2>{0.123663381f, 0.57583636f},
-std::array<float,2>{0.567896307f, 0.673489809f},
-std::array<float,2>{0.39686662f, 0.394925863f},
-std::array<float,2>{0.979045689f, 0.120960422f},
-std::array<float,2>{0.0443312377f, 0.880314589f},
-std::array<float,2>{0.76081872f, 0.837789774f},
-std::array<float,2>{0.126076698f, 0.214465916f},
-std::array<float,2>{0.730527222f, 0.372276813f},
-std::array<float,2>{0.255707264f, 0.532162309f},
-std::array<float,2>{0.906977296f, 0.622429669f},
-std::array<float,2>{0.0677425563f, 0.285165638f},
-std::array<float,2>{0.561091602f, 0.138387054f},
-std::array<float,2>{0.47812736f, 0.766559958f},
-std::array<float,2>{0.654449999f, 0.995066464f},
-std::array<float,2>{0.361370325f, 0.0622179322f},
-std::array<float,2>{0.867926598f, 0.439080298f},
-std::array<float,2>{0.238146722f, 0.695176601f},
-std::array<float,2>{0.724650204f, 0.645741224f},
-std::array<float,2>{0.263644457f, 0.407108158f},
-std::array<float,2>{0.755299032f, 0.0813768208f},
-std::array<float,2>{0.140209302f, 0.934629083f},
-std::array<float,2>{0.972193956f, 0.854996741f},
-std::array<float,2>{0.0387783647f, 0.22234863f},
-std::array<float,2>{0.574083388f, 0.323959559f},
-std::array<float,2>{0.401061535f, 0.507199168f},
-std::array<float,2>{0.865295291f, 0.568058848f},
-std::array<float,2>{0.24481f, 0.276204884f},
-std::array<float,2>{0.647946119f, 0.162773713f},
-std::array<float,2>{0.367528468f, 0.796144485f},
-std::array<float,2>{0.553322315f, 0.943064809f},
-std::array<float,2>{0.475828648f, 0.0241782125f},
-std::array<float,2>{0.920067489f, 0.497937649f},
-std::array<float,2>{0.0736434013f, 0.74455893f},
-std::array<float,2>{0.622169316f, 0.545695603f},
-std::array<float,2>{0.411276042f, 0.360204101f},
-std::array<float,2>{0.957733452f, 0.20976226f},
-std::array<float,2>{0.0230099615f, 0.829629064f},
-std::array<float,2>{0.808331966f, 0.882948279f},
-std::array<float,2>{0.174073905f, 0.114803664f},
-std::array<float,2>{0.688634157f, 0.403569728f},
-std::array<float,2>{0.293976635f, 0.686655462f},
-std::array<float,2>{0.885089278f, 0.703109682f},
-std::array<float,2>{0.114525102f, 0.452868879f},
-std::array<float,2>{0.506368518f, 0.049162548f},
-std::array<float,2>{0.455323756f, 0.98499608f},
-std::array<float,2>{0.680183411f, 0.77651906f},
-std::array<float,2>{0.313977331f, 0.126020163f},
-std::array<float,2>{0.817971349f, 0.293777257f},
-std::array<float,2>{0.216419831f, 0.610135496f},
-std::array<float,2>{0.625797331f, 0.603409767f},
-std::array<float,2>{0.346262246f, 0.305087894f},
-std::array<float,2>{0.858226538f, 0.144264385f},
-std::array<float,2>{0.233559012f, 0.7600317f},
-std::array<float,2>{0.924691737f, 0.976813018f},
-std::array<float,2>{0.0861172155f, 0.0380370319f},
-std::array<float,2>{0.534144938f, 0.453597873f},
-std::array<float,2>{0.494150549f, 0.717405081f},
-std::array<float,2>{0.780362844f, 0.663534939f},
-std::array<float,2>{0.155329734f, 0.389769942f},
-std::array<float,2>{0.73937434f, 0.103530943f},
-std::array<float,2>{0.271425724f, 0.906056702f},
-std::array<float,2>{0.593116462f, 0.819845498f},
-std::array<float,2>{0.386352271f, 0.198399246f},
-std::array<float,2>{0.98960638f, 0.350550652f},
-std::array<float,2>{0.0506547205f, 0.552595615f},
-std::array<float,2>{0.515788257f, 0.726016223f},
-std::array<float,2>{0.448060364f, 0.482441872f},
-std::array<float,2>{0.8961339f, 0.0101735704f},
-std::array<float,2>{0.0963518992f, 0.959681988f},
-std::array<float,2>{0.831062675f, 0.802644789f},
-std::array<float,2>{0.197101355f, 0.183791801f},
-std::array<float,2>{0.659384549f, 0.260576665f},
-std::array<float,2>{0.335031718f, 0.579799712f},
-std::array<float,2>{0.948668361f, 0.520598352f},
-std::array<float,2>{0.00517542101f, 0.338498026f},
-std::array<float,2>{0.604922712f, 0.248519063f},
-std::array<float,2>{0.430601329f, 0.863645434f},
-std::array<float,2>{0.718294621f, 0.916867733f},
-std::array<float,2>{0.302305341f, 0.0765950531f},
-std::array<float,2>{0.785546422f, 0.432930678f},
-std::array<float,2>{0.171685353f, 0.637573361f}}
\ No newline at end of file
@@ -1,4096 +0,0 @@
-{std::array<float,2>{0.503052652f, 0.825950146f},
-std::array<float,2>{0.104491986f, 0.0828106552f},
-std::array<float,2>{0.259602845f, 0.624039054f},
-std::array<float,2>{0.863131225f, 0.357805073f},
-std::array<float,2>{0.939357042f, 0.697920382f},
-std::array<float,2>{0.465210319f, 0.440788001f},
-std::array<float,2>{0.248190433f, 0.948651075f},
-std::array<float,2>{0.719911158f, 0.237137049f},
-std::array<float,2>{0.757115066f, 0.897204578f},
-std::array<float,2>{0.347862303f, 0.137011513f},
-std::array<float,2>{0.0286172889f, 0.655231059f},
-std::array<float,2>{0.602543235f, 0.409348696f},
-std::array<float,2>{0.674993396f, 0.558073759f},
-std::array<float,2>{0.134542227f, 0.288829505f},
-std::array<float,2>{0.39301011f, 0.752465904f},
-std::array<float,2>{0.896195412f, 0.0339082703f},
-std::array<float,2>{0.694061637f, 0.998757243f},
-std::array<float,2>{0.217711017f, 0.217926785f},
-std::array<float,2>{0.488105744f, 0.747652054f},
-std::array<float,2>{0.981130004f, 0.47765258f},
-std::array<float,2>{0.822153151f, 0.577134013f},
-std::array<float,2>{0.295704901f, 0.31453526f},
-std::array<float,2>{0.065654546f, 0.867469788f},
-std::array<float,2>{0.534974396f, 0.100431129f},
-std::array<float,2>{0.929376543f, 0.781927407f},
-std::array<float,2>{0.416357845f, 0.0184102487f},
-std::array<float,2>{0.187065005f, 0.522800505f},
-std::array<float,2>{0.635989606f, 0.253149241f},
-std::array<float,2>{0.588323653f, 0.674381077f},
-std::array<float,2>{0.0398463234f, 0.397177637f},
-std::array<float,2>{0.324541241f, 0.924739838f},
-std::array<float,2>{0.809176087f, 0.169222921f},
-std::array<float,2>{0.611537337f, 0.912669182f},
-std::array<float,2>{0.0150696794f, 0.175829113f},
-std::array<float,2>{0.360094786f, 0.658025146f},
-std::array<float,2>{0.779374957f, 0.390153468f},
-std::array<float,2>{0.880841017f, 0.50967288f},
-std::array<float,2>{0.390289992f, 0.274131507f},
-std::array<float,2>{0.141808003f, 0.812493205f},
-std::array<float,2>{0.658455372f, 0.0145235695f},
-std::array<float,2>{0.857517242f, 0.847590923f},
-std::array<float,2>{0.269892633f, 0.123992413f},
-std::array<float,2>{0.110591188f, 0.579173386f},
-std::array<float,2>{0.52934581f, 0.340672106f},
-std::array<float,2>{0.740248024f, 0.72356689f},
-std::array<float,2>{0.22865954f, 0.492769063f},
-std::array<float,2>{0.443489671f, 0.976285517f},
-std::array<float,2>{0.960746706f, 0.196019039f},
-std::array<float,2>{0.647014737f, 0.766569793f},
-std::array<float,2>{0.165200472f, 0.0541470796f},
-std::array<float,2>{0.432533026f, 0.545463681f},
-std::array<float,2>{0.907247007f, 0.312054574f},
-std::array<float,2>{0.785238385f, 0.637415528f},
-std::array<float,2>{0.338361293f, 0.430679232f},
-std::array<float,2>{0.0518105924f, 0.8784886f},
-std::array<float,2>{0.573538065f, 0.148183808f},
-std::array<float,2>{0.995072722f, 0.953441978f},
-std::array<float,2>{0.477843732f, 0.233836874f},
-std::array<float,2>{0.195439339f, 0.707214832f},
-std::array<float,2>{0.717655301f, 0.457294554f},
-std::array<float,2>{0.55857569f, 0.602602839f},
-std::array<float,2>{0.0843961686f, 0.373757482f},
-std::array<float,2>{0.310904086f, 0.829973102f},
-std::array<float,2>{0.840793967f, 0.0631541684f},
-std::array<float,2>{0.56732446f, 0.803245842f},
-std::array<float,2>{0.0610844828f, 0.00462855585f},
-std::array<float,2>{0.334986627f, 0.50693506f},
-std::array<float,2>{0.791415811f, 0.266394556f},
-std::array<float,2>{0.920285583f, 0.671259999f},
-std::array<float,2>{0.42757234f, 0.376796186f},
-std::array<float,2>{0.159207165f, 0.91650629f},
-std::array<float,2>{0.65453428f, 0.180446818f},
-std::array<float,2>{0.835792422f, 0.977489233f},
-std::array<float,2>{0.301572502f, 0.190684944f},
-std::array<float,2>{0.0911605731f, 0.726643324f},
-std::array<float,2>{0.549378157f, 0.486711055f},
-std::array<float,2>{0.7035833f, 0.587200046f},
-std::array<float,2>{0.188137308f, 0.332632482f},
-std::array<float,2>{0.469145566f, 0.854281843f},
-std::array<float,2>{0.985508144f, 0.116152443f},
-std::array<float,2>{0.668911695f, 0.88874352f},
-std::array<float,2>{0.153128535f, 0.152360916f},
-std::array<float,2>{0.381467134f, 0.627649784f},
-std::array<float,2>{0.884342432f, 0.424927801f},
-std::array<float,2>{0.767098427f, 0.533725917f},
-std::array<float,2>{0.371685773f, 0.304568321f},
-std::array<float,2>{0.00650920952f, 0.774965644f},
-std::array<float,2>{0.622442544f, 0.0594775826f},
-std::array<float,2>{0.961984217f, 0.836414218f},
-std::array<float,2>{0.450537562f, 0.0772825927f},
-std::array<float,2>{0.223890826f, 0.601113796f},
-std::array<float,2>{0.744728506f, 0.364300847f},
-std::array<float,2>{0.518572569f, 0.711227238f},
-std::array<float,2>{0.120594241f, 0.466404557f},
-std::array<float,2>{0.279468805f, 0.967489123f},
-std::array<float,2>{0.848347008f, 0.223464116f},
-std::array<float,2>{0.54161185f, 0.943556428f},
-std::array<float,2>{0.0732758269f, 0.249448404f},
-std::array<float,2>{0.282362103f, 0.69003278f},
-std::array<float,2>{0.818309069f, 0.450538099f},
-std::array<float,2>{0.974535942f, 0.611875415f},
-std::array<float,2>{0.496488065f, 0.346172065f},
-std::array<float,2>{0.205295295f, 0.816470385f},
-std::array<float,2>{0.696954131f, 0.0914387181f},
-std::array<float,2>{0.802081645f, 0.760635495f},
-std::array<float,2>{0.317507744f, 0.0403753892f},
-std::array<float,2>{0.0350628234f, 0.553333819f},
-std::array<float,2>{0.581993937f, 0.295681417f},
-std::array<float,2>{0.63042742f, 0.648041546f},
-std::array<float,2>{0.17717047f, 0.417583555f},
-std::array<float,2>{0.411048353f, 0.905086339f},
-std::array<float,2>{0.930855155f, 0.130148068f},
-std::array<float,2>{0.72903651f, 0.86405319f},
-std::array<float,2>{0.237429649f, 0.106863238f},
-std::array<float,2>{0.459501028f, 0.566095948f},
-std::array<float,2>{0.949170768f, 0.322566628f},
-std::array<float,2>{0.867833614f, 0.735469997f},
-std::array<float,2>{0.255507767f, 0.473518372f},
-std::array<float,2>{0.0989303663f, 0.988648176f},
-std::array<float,2>{0.509096384f, 0.20656921f},
-std::array<float,2>{0.901671886f, 0.936748624f},
-std::array<float,2>{0.400155962f, 0.164005175f},
-std::array<float,2>{0.125627413f, 0.687180877f},
-std::array<float,2>{0.681506991f, 0.402079344f},
-std::array<float,2>{0.600784004f, 0.530149758f},
-std::array<float,2>{0.0166110881f, 0.258280098f},
-std::array<float,2>{0.354846239f, 0.790950239f},
-std::array<float,2>{0.764974654f, 0.0252801869f},
-std::array<float,2>{0.551821172f, 0.75723964f},
-std::array<float,2>{0.0874751657f, 0.0375682898f},
-std::array<float,2>{0.299054086f, 0.558997571f},
-std::array<float,2>{0.830378771f, 0.283166856f},
-std::array<float,2>{0.988526583f, 0.648867548f},
-std::array<float,2>{0.475878835f, 0.410242766f},
-std::array<float,2>{0.193017244f, 0.892761648f},
-std::array<float,2>{0.708806992f, 0.13336955f},
-std::array<float,2>{0.796347976f, 0.95050931f},
-std::array<float,2>{0.331553817f, 0.240313932f},
-std::array<float,2>{0.0550745614f, 0.701821029f},
-std::array<float,2>{0.564766705f, 0.442039847f},
-std::array<float,2>{0.650190294f, 0.618739963f},
-std::array<float,2>{0.16377385f, 0.354103386f},
-std::array<float,2>{0.425337315f, 0.821001589f},
-std::array<float,2>{0.916444063f, 0.0788065046f},
-std::array<float,2>{0.746263087f, 0.929528713f},
-std::array<float,2>{0.220588431f, 0.164129362f},
-std::array<float,2>{0.44759053f, 0.676804185f},
-std::array<float,2>{0.965667546f, 0.393519521f},
-std::array<float,2>{0.846602738f, 0.517346978f},
-std::array<float,2>{0.276316196f, 0.257635593f},
-std::array<float,2>{0.121484227f, 0.786653578f},
-std::array<float,2>{0.521915019f, 0.0217617787f},
-std::array<float,2>{0.889516473f, 0.874719501f},
-std::array<float,2>{0.37684232f, 0.0952296853f},
-std::array<float,2>{0.150598824f, 0.570926607f},
-std::array<float,2>{0.665376902f, 0.319909632f},
-std::array<float,2>{0.617216587f, 0.744713902f},
-std::array<float,2>{0.00355800427f, 0.48094067f},
-std::array<float,2>{0.368091345f, 0.995141268f},
-std::array<float,2>{0.772222757f, 0.214784756f},
-std::array<float,2>{0.584778547f, 0.972192466f},
-std::array<float,2>{0.0352475271f, 0.199684322f},
-std::array<float,2>{0.316050977f, 0.719477177f},
-std::array<float,2>{0.797276437f, 0.499060363f},
-std::array<float,2>{0.937278271f, 0.585562766f},
-std::array<float,2>{0.407890767f, 0.337511271f},
-std::array<float,2>{0.175412223f, 0.85022831f},
-std::array<float,2>{0.625745893f, 0.1210161f},
-std::array<float,2>{0.814795613f, 0.807942033f},
-std::array<float,2>{0.287059218f, 0.0111386031f},
-std::array<float,2>{0.0771961287f, 0.514997482f},
-std::array<float,2>{0.545728505f, 0.281042784f},
-std::array<float,2>{0.701591253f, 0.662842274f},
-std::array<float,2>{0.208016515f, 0.384100109f},
-std::array<float,2>{0.494447798f, 0.907894671f},
-std::array<float,2>{0.970224202f, 0.175066724f},
-std::array<float,2>{0.687306345f, 0.833591342f},
-std::array<float,2>{0.130678341f, 0.0688020587f},
-std::array<float,2>{0.404486746f, 0.606998146f},
-std::array<float,2>{0.903419197f, 0.37109226f},
-std::array<float,2>{0.757974803f, 0.706874073f},
-std::array<float,2>{0.359012276f, 0.455011219f},
-std::array<float,2>{0.0228395686f, 0.957277894f},
-std::array<float,2>{0.595011353f, 0.230248332f},
-std::array<float,2>{0.951077759f, 0.8827824f},
-std::array<float,2>{0.454366505f, 0.141450167f},
-std::array<float,2>{0.241024807f, 0.636693358f},
-std::array<float,2>{0.730973005f, 0.435483396f},
-std::array<float,2>{0.513954401f, 0.541145265f},
-std::array<float,2>{0.0967914611f, 0.304871142f},
-std::array<float,2>{0.253777951f, 0.772393048f},
-std::array<float,2>{0.871541977f, 0.0483293943f},
-std::array<float,2>{0.607426047f, 0.858858645f},
-std::array<float,2>{0.0242164601f, 0.110503092f},
-std::array<float,2>{0.347500205f, 0.591402113f},
-std::array<float,2>{0.752377033f, 0.330523908f},
-std::array<float,2>{0.892840743f, 0.731223106f},
-std::array<float,2>{0.395699114f, 0.491431504f},
-std::array<float,2>{0.139031693f, 0.982339263f},
-std::array<float,2>{0.677339077f, 0.193422735f},
-std::array<float,2>{0.866718113f, 0.920379758f},
-std::array<float,2>{0.264981329f, 0.184557229f},
-std::array<float,2>{0.107399888f, 0.666576862f},
-std::array<float,2>{0.503951848f, 0.380121082f},
-std::array<float,2>{0.724904597f, 0.502712369f},
-std::array<float,2>{0.242740005f, 0.272956759f},
-std::array<float,2>{0.463183105f, 0.799928129f},
-std::array<float,2>{0.945004821f, 0.00187411567f},
-std::array<float,2>{0.638635635f, 0.96164304f},
-std::array<float,2>{0.180948257f, 0.221856162f},
-std::array<float,2>{0.420437425f, 0.71681267f},
-std::array<float,2>{0.924513578f, 0.463205218f},
-std::array<float,2>{0.807037652f, 0.594567835f},
-std::array<float,2>{0.322811693f, 0.36020714f},
-std::array<float,2>{0.0445443206f, 0.840033352f},
-std::array<float,2>{0.593354642f, 0.0737955645f},
-std::array<float,2>{0.979284227f, 0.778144121f},
-std::array<float,2>{0.488886148f, 0.0568076633f},
-std::array<float,2>{0.211051792f, 0.536522567f},
-std::array<float,2>{0.688577235f, 0.297002971f},
-std::array<float,2>{0.538428426f, 0.630171657f},
-std::array<float,2>{0.0690444186f, 0.426005602f},
-std::array<float,2>{0.29013288f, 0.883864462f},
-std::array<float,2>{0.824876606f, 0.148588493f},
-std::array<float,2>{0.523899138f, 0.898486733f},
-std::array<float,2>{0.113698527f, 0.127825111f},
-std::array<float,2>{0.269433826f, 0.6429708f},
-std::array<float,2>{0.855288804f, 0.419988364f},
-std::array<float,2>{0.95411092f, 0.547367156f},
-std::array<float,2>{0.438581258f, 0.291879416f},
-std::array<float,2>{0.231609508f, 0.764406562f},
-std::array<float,2>{0.73823148f, 0.0452355742f},
-std::array<float,2>{0.775895417f, 0.813149989f},
-std::array<float,2>{0.365795791f, 0.0879740715f},
-std::array<float,2>{0.00983560923f, 0.613685906f},
-std::array<float,2>{0.614284873f, 0.35020262f},
-std::array<float,2>{0.663100004f, 0.693830848f},
-std::array<float,2>{0.148069575f, 0.446528554f},
-std::array<float,2>{0.383366972f, 0.939060509f},
-std::array<float,2>{0.878888905f, 0.24592033f},
-std::array<float,2>{0.71235317f, 0.793236673f},
-std::array<float,2>{0.199461445f, 0.0288121086f},
-std::array<float,2>{0.481462687f, 0.526145637f},
-std::array<float,2>{0.997634828f, 0.262044281f},
-std::array<float,2>{0.837382555f, 0.683276415f},
-std::array<float,2>{0.307190716f, 0.405370712f},
-std::array<float,2>{0.0814087614f, 0.932448685f},
-std::array<float,2>{0.559490323f, 0.157241195f},
-std::array<float,2>{0.910250902f, 0.986689746f},
-std::array<float,2>{0.436466396f, 0.210627809f},
-std::array<float,2>{0.168919325f, 0.741152167f},
-std::array<float,2>{0.643729448f, 0.469801605f},
-std::array<float,2>{0.576610029f, 0.566702068f},
-std::array<float,2>{0.0474067554f, 0.324375063f},
-std::array<float,2>{0.339904338f, 0.861173987f},
-std::array<float,2>{0.781790495f, 0.103933364f},
-std::array<float,2>{0.531407237f, 0.869553268f},
-std::array<float,2>{0.063279368f, 0.0977512151f},
-std::array<float,2>{0.293835193f, 0.575298727f},
-std::array<float,2>{0.824116528f, 0.314303517f},
-std::array<float,2>{0.983608723f, 0.748053193f},
-std::array<float,2>{0.484740615f, 0.47863996f},
-std::array<float,2>{0.216453984f, 0.997639358f},
-std::array<float,2>{0.692122519f, 0.216286093f},
-std::array<float,2>{0.810804784f, 0.923538864f},
-std::array<float,2>{0.327507854f, 0.170261636f},
-std::array<float,2>{0.0423159525f, 0.672976434f},
-std::array<float,2>{0.586819947f, 0.394765288f},
-std::array<float,2>{0.633278012f, 0.520156622f},
-std::array<float,2>{0.183776617f, 0.250374228f},
-std::array<float,2>{0.415744215f, 0.784895241f},
-std::array<float,2>{0.926164031f, 0.0172550213f},
-std::array<float,2>{0.721564651f, 0.946191728f},
-std::array<float,2>{0.24709861f, 0.23611778f},
-std::array<float,2>{0.467516154f, 0.695641816f},
-std::array<float,2>{0.94051826f, 0.438423634f},
-std::array<float,2>{0.860942185f, 0.621466279f},
-std::array<float,2>{0.259973645f, 0.356310695f},
-std::array<float,2>{0.10262908f, 0.828059256f},
-std::array<float,2>{0.501832426f, 0.0844519064f},
-std::array<float,2>{0.898006797f, 0.750570059f},
-std::array<float,2>{0.391704112f, 0.0313672721f},
-std::array<float,2>{0.136175975f, 0.556108654f},
-std::array<float,2>{0.673407912f, 0.285788119f},
-std::array<float,2>{0.603967786f, 0.653035223f},
-std::array<float,2>{0.0309499558f, 0.406653553f},
-std::array<float,2>{0.350415349f, 0.89567107f},
-std::array<float,2>{0.755079567f, 0.140005291f},
-std::array<float,2>{0.572006166f, 0.875903845f},
-std::array<float,2>{0.0541472994f, 0.144651383f},
-std::array<float,2>{0.33654809f, 0.640240014f},
-std::array<float,2>{0.787834108f, 0.433001518f},
-std::array<float,2>{0.909342706f, 0.544882238f},
-std::array<float,2>{0.43024227f, 0.309853852f},
-std::array<float,2>{0.167639092f, 0.769301534f},
-std::array<float,2>{0.645141661f, 0.0513740405f},
-std::array<float,2>{0.843223214f, 0.831575811f},
-std::array<float,2>{0.309609681f, 0.0660189688f},
-std::array<float,2>{0.0827688277f, 0.604917705f},
-std::array<float,2>{0.55621475f, 0.371644437f},
-std::array<float,2>{0.715662181f, 0.710043669f},
-std::array<float,2>{0.198272616f, 0.45958817f},
-std::array<float,2>{0.479315519f, 0.955509961f},
-std::array<float,2>{0.99377805f, 0.231777817f},
-std::array<float,2>{0.656781673f, 0.809667647f},
-std::array<float,2>{0.142711878f, 0.0125564868f},
-std::array<float,2>{0.387716472f, 0.510242879f},
-std::array<float,2>{0.881897867f, 0.276376605f},
-std::array<float,2>{0.779236734f, 0.658838272f},
-std::array<float,2>{0.362497807f, 0.388569832f},
-std::array<float,2>{0.012205461f, 0.91168195f},
-std::array<float,2>{0.611209393f, 0.177835926f},
-std::array<float,2>{0.958120286f, 0.973601818f},
-std::array<float,2>{0.442143232f, 0.197707459f},
-std::array<float,2>{0.227708682f, 0.725598812f},
-std::array<float,2>{0.738489866f, 0.494318336f},
-std::array<float,2>{0.529099047f, 0.580612242f},
-std::array<float,2>{0.113041364f, 0.3418957f},
-std::array<float,2>{0.272238582f, 0.844697773f},
-std::array<float,2>{0.857118607f, 0.122893251f},
-std::array<float,2>{0.623431504f, 0.77560854f},
-std::array<float,2>{0.00574184395f, 0.0621840656f},
-std::array<float,2>{0.373861104f, 0.532732368f},
-std::array<float,2>{0.769106209f, 0.301824272f},
-std::array<float,2>{0.886675358f, 0.625882268f},
-std::array<float,2>{0.38004598f, 0.422964066f},
-std::array<float,2>{0.155646577f, 0.887111843f},
-std::array<float,2>{0.670605481f, 0.155831844f},
-std::array<float,2>{0.850114644f, 0.96637249f},
-std::array<float,2>{0.278648287f, 0.226516202f},
-std::array<float,2>{0.117736153f, 0.713749349f},
-std::array<float,2>{0.515780568f, 0.467636287f},
-std::array<float,2>{0.743556917f, 0.598233044f},
-std::array<float,2>{0.225886717f, 0.365984917f},
-std::array<float,2>{0.452587456f, 0.839725077f},
-std::array<float,2>{0.964185774f, 0.0760140866f},
-std::array<float,2>{0.652479231f, 0.915032446f},
-std::array<float,2>{0.15656504f, 0.183202803f},
-std::array<float,2>{0.428100556f, 0.669114232f},
-std::array<float,2>{0.918859899f, 0.377866983f},
-std::array<float,2>{0.791015267f, 0.504760921f},
-std::array<float,2>{0.332642972f, 0.26917249f},
-std::array<float,2>{0.0586347207f, 0.800997078f},
-std::array<float,2>{0.569474697f, 0.00680462597f},
-std::array<float,2>{0.987136245f, 0.85214889f},
-std::array<float,2>{0.471074969f, 0.114558809f},
-std::array<float,2>{0.190686107f, 0.589102924f},
-std::array<float,2>{0.706602812f, 0.335469216f},
-std::array<float,2>{0.547282219f, 0.728654385f},
-std::array<float,2>{0.0926137194f, 0.484817296f},
-std::array<float,2>{0.303116918f, 0.980119884f},
-std::array<float,2>{0.833690822f, 0.189297438f},
-std::array<float,2>{0.51087749f, 0.990771294f},
-std::array<float,2>{0.100232996f, 0.204299435f},
-std::array<float,2>{0.257129282f, 0.737063468f},
-std::array<float,2>{0.870544553f, 0.474766403f},
-std::array<float,2>{0.946797431f, 0.564295828f},
-std::array<float,2>{0.457405925f, 0.320953697f},
-std::array<float,2>{0.235117793f, 0.867023051f},
-std::array<float,2>{0.727299154f, 0.109011099f},
-std::array<float,2>{0.763526142f, 0.791867435f},
-std::array<float,2>{0.352366507f, 0.0271652844f},
-std::array<float,2>{0.0185800493f, 0.528321087f},
-std::array<float,2>{0.599360824f, 0.261181563f},
-std::array<float,2>{0.683228254f, 0.683759868f},
-std::array<float,2>{0.128806651f, 0.399434507f},
-std::array<float,2>{0.401505172f, 0.934643269f},
-std::array<float,2>{0.90029192f, 0.161243558f},
-std::array<float,2>{0.697432578f, 0.820231915f},
-std::array<float,2>{0.204369262f, 0.0932351053f},
-std::array<float,2>{0.499229282f, 0.610557973f},
-std::array<float,2>{0.975466967f, 0.344406724f},
-std::array<float,2>{0.819769561f, 0.688021541f},
-std::array<float,2>{0.284486115f, 0.451280653f},
-std::array<float,2>{0.0716279149f, 0.942810059f},
-std::array<float,2>{0.540751517f, 0.246903062f},
-std::array<float,2>{0.932689786f, 0.903843582f},
-std::array<float,2>{0.413644224f, 0.132487118f},
-std::array<float,2>{0.179112986f, 0.644629955f},
-std::array<float,2>{0.631578803f, 0.415438801f},
-std::array<float,2>{0.578798592f, 0.552712262f},
-std::array<float,2>{0.0321396068f, 0.294177681f},
-std::array<float,2>{0.319533437f, 0.759381711f},
-std::array<float,2>{0.804196894f, 0.0423454382f},
-std::array<float,2>{0.521251619f, 0.787766993f},
-std::array<float,2>{0.123768315f, 0.0198516212f},
-std::array<float,2>{0.27372691f, 0.517774522f},
-std::array<float,2>{0.845204532f, 0.254600435f},
-std::array<float,2>{0.968061924f, 0.678729057f},
-std::array<float,2>{0.446118981f, 0.390830457f},
-std::array<float,2>{0.22115545f, 0.9272632f},
-std::array<float,2>{0.748717546f, 0.167823568f},
-std::array<float,2>{0.77062571f, 0.993048847f},
-std::array<float,2>{0.369261384f, 0.211057335f},
-std::array<float,2>{0.00136544241f, 0.74254632f},
-std::array<float,2>{0.619458377f, 0.482803792f},
-std::array<float,2>{0.667285562f, 0.573930919f},
-std::array<float,2>{0.14865908f, 0.31703797f},
-std::array<float,2>{0.378148824f, 0.872143388f},
-std::array<float,2>{0.887640178f, 0.097312592f},
-std::array<float,2>{0.709450245f, 0.890648663f},
-std::array<float,2>{0.194921225f, 0.135037959f},
-std::array<float,2>{0.47337234f, 0.652295709f},
-std::array<float,2>{0.991955459f, 0.414059728f},
-std::array<float,2>{0.828127205f, 0.562059164f},
-std::array<float,2>{0.298074156f, 0.284021825f},
-std::array<float,2>{0.0886611268f, 0.754393578f},
-std::array<float,2>{0.55401969f, 0.035420239f},
-std::array<float,2>{0.916012466f, 0.822670341f},
-std::array<float,2>{0.423804998f, 0.0810097381f},
-std::array<float,2>{0.160193041f, 0.620053291f},
-std::array<float,2>{0.651787341f, 0.352655202f},
-std::array<float,2>{0.563976645f, 0.699568748f},
-std::array<float,2>{0.0570286736f, 0.443711311f},
-std::array<float,2>{0.328414232f, 0.952118278f},
-std::array<float,2>{0.793660223f, 0.238380298f},
-std::array<float,2>{0.59606111f, 0.960018218f},
-std::array<float,2>{0.0212078113f, 0.227257982f},
-std::array<float,2>{0.356396824f, 0.703934252f},
-std::array<float,2>{0.760534704f, 0.456783503f},
-std::array<float,2>{0.904407799f, 0.607814252f},
-std::array<float,2>{0.403556824f, 0.36858812f},
-std::array<float,2>{0.131957084f, 0.834203482f},
-std::array<float,2>{0.685509801f, 0.0681486428f},
-std::array<float,2>{0.874594629f, 0.771109521f},
-std::array<float,2>{0.250986338f, 0.0491885059f},
-std::array<float,2>{0.0949000344f, 0.539880991f},
-std::array<float,2>{0.512380183f, 0.306704968f},
-std::array<float,2>{0.733267844f, 0.632949591f},
-std::array<float,2>{0.238391086f, 0.435947061f},
-std::array<float,2>{0.456733078f, 0.879259884f},
-std::array<float,2>{0.951403975f, 0.144502863f},
-std::array<float,2>{0.627152205f, 0.848969698f},
-std::array<float,2>{0.172109887f, 0.11817757f},
-std::array<float,2>{0.410078347f, 0.582834065f},
-std::array<float,2>{0.934343696f, 0.338248432f},
-std::array<float,2>{0.800752997f, 0.721331775f},
-std::array<float,2>{0.313672394f, 0.496982872f},
-std::array<float,2>{0.0387962684f, 0.969293714f},
-std::array<float,2>{0.582374692f, 0.202149853f},
-std::array<float,2>{0.972476482f, 0.909636796f},
-std::array<float,2>{0.494064331f, 0.17372708f},
-std::array<float,2>{0.209382355f, 0.66091603f},
-std::array<float,2>{0.701161861f, 0.385408342f},
-std::array<float,2>{0.543945372f, 0.513371468f},
-std::array<float,2>{0.0760869682f, 0.27804777f},
-std::array<float,2>{0.287349164f, 0.805054247f},
-std::array<float,2>{0.813047647f, 0.00809382927f},
-std::array<float,2>{0.591100097f, 0.842537045f},
-std::array<float,2>{0.0450579487f, 0.0710970834f},
-std::array<float,2>{0.320605993f, 0.59668535f},
-std::array<float,2>{0.806206763f, 0.361890614f},
-std::array<float,2>{0.923009872f, 0.715586185f},
-std::array<float,2>{0.419657201f, 0.462157965f},
-std::array<float,2>{0.182393655f, 0.963729501f},
-std::array<float,2>{0.640239716f, 0.220171109f},
-std::array<float,2>{0.827048957f, 0.885865867f},
-std::array<float,2>{0.291848391f, 0.150721177f},
-std::array<float,2>{0.0669607893f, 0.631490588f},
-std::array<float,2>{0.536365092f, 0.429076791f},
-std::array<float,2>{0.690773785f, 0.537307918f},
-std::array<float,2>{0.213647231f, 0.299533546f},
-std::array<float,2>{0.490612447f, 0.780652463f},
-std::array<float,2>{0.978151083f, 0.0547369644f},
-std::array<float,2>{0.67845571f, 0.983314991f},
-std::array<float,2>{0.136813328f, 0.19239755f},
-std::array<float,2>{0.396880478f, 0.734106123f},
-std::array<float,2>{0.890938282f, 0.489720702f},
-std::array<float,2>{0.751391292f, 0.592295825f},
-std::array<float,2>{0.343913108f, 0.329753429f},
-std::array<float,2>{0.0258114655f, 0.855668306f},
-std::array<float,2>{0.606887162f, 0.112773791f},
-std::array<float,2>{0.943208635f, 0.79859978f},
-std::array<float,2>{0.461176664f, 0.00276042311f},
-std::array<float,2>{0.245454416f, 0.501724601f},
-std::array<float,2>{0.722982764f, 0.270099252f},
-std::array<float,2>{0.506769359f, 0.664353192f},
-std::array<float,2>{0.10885492f, 0.38214162f},
-std::array<float,2>{0.262267113f, 0.919825971f},
-std::array<float,2>{0.864962101f, 0.187206835f},
-std::array<float,2>{0.561274171f, 0.930742145f},
-std::array<float,2>{0.0786179975f, 0.158954009f},
-std::array<float,2>{0.306309313f, 0.680920064f},
-std::array<float,2>{0.838802814f, 0.402687341f},
-std::array<float,2>{0.998955786f, 0.52461946f},
-std::array<float,2>{0.483639717f, 0.263785601f},
-std::array<float,2>{0.202343628f, 0.796739757f},
-std::array<float,2>{0.714063704f, 0.0301237181f},
-std::array<float,2>{0.784011841f, 0.862254202f},
-std::array<float,2>{0.341866314f, 0.102634326f},
-std::array<float,2>{0.0489472933f, 0.570180953f},
-std::array<float,2>{0.574829757f, 0.326252788f},
-std::array<float,2>{0.641637802f, 0.738756597f},
-std::array<float,2>{0.171795204f, 0.472391844f},
-std::array<float,2>{0.434716403f, 0.985279679f},
-std::array<float,2>{0.912251711f, 0.207350671f},
-std::array<float,2>{0.735851109f, 0.763369083f},
-std::array<float,2>{0.234244257f, 0.0440835617f},
-std::array<float,2>{0.44131875f, 0.549744368f},
-std::array<float,2>{0.956154287f, 0.290721267f},
-std::array<float,2>{0.852262259f, 0.641990364f},
-std::array<float,2>{0.267448097f, 0.417974681f},
-std::array<float,2>{0.115383685f, 0.901004314f},
-std::array<float,2>{0.526778936f, 0.125054136f},
-std::array<float,2>{0.875925362f, 0.940440476f},
-std::array<float,2>{0.38631162f, 0.243154973f},
-std::array<float,2>{0.145835117f, 0.693165839f},
-std::array<float,2>{0.660303771f, 0.448505133f},
-std::array<float,2>{0.616832376f, 0.616769552f},
-std::array<float,2>{0.00810465775f, 0.349372655f},
-std::array<float,2>{0.364522189f, 0.815804422f},
-std::array<float,2>{0.773826063f, 0.0865399316f},
-std::array<float,2>{0.55517292f, 0.828458905f},
-std::array<float,2>{0.0833190084f, 0.0641346425f},
-std::array<float,2>{0.308900148f, 0.601849318f},
-std::array<float,2>{0.841839135f, 0.374723375f},
-std::array<float,2>{0.992436051f, 0.708131015f},
-std::array<float,2>{0.48011601f, 0.458689392f},
-std::array<float,2>{0.197842225f, 0.954847574f},
-std::array<float,2>{0.716154337f, 0.232549891f},
-std::array<float,2>{0.788285434f, 0.877749145f},
-std::array<float,2>{0.337285846f, 0.147168681f},
-std::array<float,2>{0.0535919629f, 0.637943745f},
-std::array<float,2>{0.570802152f, 0.429814935f},
-std::array<float,2>{0.645515501f, 0.546718717f},
-std::array<float,2>{0.166419521f, 0.311038941f},
-std::array<float,2>{0.431450129f, 0.766998768f},
-std::array<float,2>{0.908216894f, 0.0532699861f},
-std::array<float,2>{0.739890814f, 0.975358069f},
-std::array<float,2>{0.2273819f, 0.19693245f},
-std::array<float,2>{0.443029463f, 0.723779023f},
-std::array<float,2>{0.957970262f, 0.493932605f},
-std::array<float,2>{0.855924547f, 0.579051614f},
-std::array<float,2>{0.272856772f, 0.341735601f},
-std::array<float,2>{0.111365765f, 0.846143544f},
-std::array<float,2>{0.528037846f, 0.124348305f},
-std::array<float,2>{0.881594241f, 0.811101437f},
-std::array<float,2>{0.387167484f, 0.0147911496f},
-std::array<float,2>{0.144284427f, 0.507858336f},
-std::array<float,2>{0.657925665f, 0.274865508f},
-std::array<float,2>{0.610037565f, 0.65699923f},
-std::array<float,2>{0.0136675313f, 0.388820559f},
-std::array<float,2>{0.361675322f, 0.913170218f},
-std::array<float,2>{0.777465522f, 0.177493557f},
-std::array<float,2>{0.586961389f, 0.924821019f},
-std::array<float,2>{0.0414935015f, 0.168698594f},
-std::array<float,2>{0.326817304f, 0.675312579f},
-std::array<float,2>{0.812425554f, 0.397598386f},
-std::array<float,2>{0.927135646f, 0.521599531f},
-std::array<float,2>{0.414710104f, 0.252183408f},
-std::array<float,2>{0.184824154f, 0.783091545f},
-std::array<float,2>{0.634289324f, 0.0189275108f},
-std::array<float,2>{0.822860003f, 0.868984222f},
-std::array<float,2>{0.294285506f, 0.100991473f},
-std::array<float,2>{0.0640516803f, 0.577629566f},
-std::array<float,2>{0.533181906f, 0.315766603f},
-std::array<float,2>{0.692804992f, 0.746846199f},
-std::array<float,2>{0.215501502f, 0.477379024f},
-std::array<float,2>{0.486115992f, 0.999634087f},
-std::array<float,2>{0.982487321f, 0.217654869f},
-std::array<float,2>{0.672685385f, 0.753021359f},
-std::array<float,2>{0.135626376f, 0.0345760696f},
-std::array<float,2>{0.391216844f, 0.5574525f},
-std::array<float,2>{0.897328675f, 0.287956715f},
-std::array<float,2>{0.754016519f, 0.656084001f},
-std::array<float,2>{0.351219475f, 0.408283949f},
-std::array<float,2>{0.0301182289f, 0.898039997f},
-std::array<float,2>{0.60457623f, 0.138360247f},
-std::array<float,2>{0.939492166f, 0.947319329f},
-std::array<float,2>{0.468138248f, 0.237743571f},
-std::array<float,2>{0.246119544f, 0.698673964f},
-std::array<float,2>{0.721784234f, 0.439472765f},
-std::array<float,2>{0.500858009f, 0.623725295f},
-std::array<float,2>{0.10212481f, 0.359175861f},
-std::array<float,2>{0.260802478f, 0.824956954f},
-std::array<float,2>{0.859492242f, 0.0832587034f},
-std::array<float,2>{0.598196507f, 0.789333463f},
-std::array<float,2>{0.0184264071f, 0.0238812789f},
-std::array<float,2>{0.353225887f, 0.530438364f},
-std::array<float,2>{0.762423277f, 0.259468526f},
-std::array<float,2>{0.899020612f, 0.685774326f},
-std::array<float,2>{0.400483817f, 0.400840819f},
-std::array<float,2>{0.127249435f, 0.936004639f},
-std::array<float,2>{0.68242836f, 0.162902832f},
-std::array<float,2>{0.869941056f, 0.98993206f},
-std::array<float,2>{0.256504625f, 0.205950305f},
-std::array<float,2>{0.10122323f, 0.735088348f},
-std::array<float,2>{0.510616899f, 0.473756611f},
-std::array<float,2>{0.728108048f, 0.564834774f},
-std::array<float,2>{0.236168399f, 0.323778719f},
-std::array<float,2>{0.458118975f, 0.864640951f},
-std::array<float,2>{0.945766568f, 0.105685979f},
-std::array<float,2>{0.632090569f, 0.906042635f},
-std::array<float,2>{0.178592786f, 0.129206702f},
-std::array<float,2>{0.412686169f, 0.6473822f},
-std::array<float,2>{0.932580233f, 0.416407853f},
-std::array<float,2>{0.803498924f, 0.554235399f},
-std::array<float,2>{0.318753988f, 0.295982867f},
-std::array<float,2>{0.0329565294f, 0.761297047f},
-std::array<float,2>{0.579999089f, 0.0392056815f},
-std::array<float,2>{0.975819349f, 0.818335116f},
-std::array<float,2>{0.498131603f, 0.0902403146f},
-std::array<float,2>{0.203392208f, 0.612899899f},
-std::array<float,2>{0.698272943f, 0.347508997f},
-std::array<float,2>{0.539566755f, 0.690643609f},
-std::array<float,2>{0.0704180524f, 0.449796349f},
-std::array<float,2>{0.283737808f, 0.945052326f},
-std::array<float,2>{0.818752289f, 0.248782411f},
-std::array<float,2>{0.516815543f, 0.967944026f},
-std::array<float,2>{0.118774168f, 0.223889843f},
-std::array<float,2>{0.277845651f, 0.712769449f},
-std::array<float,2>{0.851130605f, 0.465630293f},
-std::array<float,2>{0.963513315f, 0.600184143f},
-std::array<float,2>{0.451293856f, 0.363750875f},
-std::array<float,2>{0.225513518f, 0.837663114f},
-std::array<float,2>{0.742580235f, 0.0762845129f},
-std::array<float,2>{0.768418729f, 0.774163127f},
-std::array<float,2>{0.37456122f, 0.0601374358f},
-std::array<float,2>{0.00446482794f, 0.534941196f},
-std::array<float,2>{0.624652624f, 0.302936345f},
-std::array<float,2>{0.671582282f, 0.628901005f},
-std::array<float,2>{0.154616788f, 0.424454719f},
-std::array<float,2>{0.379361212f, 0.890472233f},
-std::array<float,2>{0.885308385f, 0.153684422f},
-std::array<float,2>{0.705402076f, 0.855333567f},
-std::array<float,2>{0.189987779f, 0.117018722f},
-std::array<float,2>{0.472237974f, 0.586047053f},
-std::array<float,2>{0.987532437f, 0.333677053f},
-std::array<float,2>{0.83203429f, 0.728493273f},
-std::array<float,2>{0.304067582f, 0.487388492f},
-std::array<float,2>{0.0937347934f, 0.977781296f},
-std::array<float,2>{0.548042893f, 0.189558819f},
-std::array<float,2>{0.919544339f, 0.917198002f},
-std::array<float,2>{0.429282516f, 0.180842623f},
-std::array<float,2>{0.158000842f, 0.670329213f},
-std::array<float,2>{0.653678894f, 0.375937372f},
-std::array<float,2>{0.568594992f, 0.506626964f},
-std::array<float,2>{0.0599433035f, 0.267167658f},
-std::array<float,2>{0.333902806f, 0.803742886f},
-std::array<float,2>{0.78941977f, 0.00517994817f},
-std::array<float,2>{0.513439f, 0.77286154f},
-std::array<float,2>{0.0940605775f, 0.0474914014f},
-std::array<float,2>{0.250967264f, 0.542145669f},
-std::array<float,2>{0.873256683f, 0.306419522f},
-std::array<float,2>{0.952962756f, 0.635642588f},
-std::array<float,2>{0.45552963f, 0.434342742f},
-std::array<float,2>{0.240138024f, 0.881404519f},
-std::array<float,2>{0.733856738f, 0.14256686f},
-std::array<float,2>{0.761412978f, 0.958460331f},
-std::array<float,2>{0.356705338f, 0.229022399f},
-std::array<float,2>{0.0200440902f, 0.706005991f},
-std::array<float,2>{0.596713781f, 0.453662068f},
-std::array<float,2>{0.683820486f, 0.606150806f},
-std::array<float,2>{0.130903795f, 0.369716614f},
-std::array<float,2>{0.402731001f, 0.83237648f},
-std::array<float,2>{0.90592587f, 0.069521822f},
-std::array<float,2>{0.699976683f, 0.906568646f},
-std::array<float,2>{0.210912779f, 0.174654186f},
-std::array<float,2>{0.492986947f, 0.663160503f},
-std::array<float,2>{0.971512377f, 0.382960737f},
-std::array<float,2>{0.8136186f, 0.514067888f},
-std::array<float,2>{0.288739353f, 0.28025955f},
-std::array<float,2>{0.0749671906f, 0.806866467f},
-std::array<float,2>{0.543572426f, 0.0104144886f},
-std::array<float,2>{0.935543776f, 0.851179659f},
-std::array<float,2>{0.408463806f, 0.119174458f},
-std::array<float,2>{0.173409387f, 0.584834695f},
-std::array<float,2>{0.628802299f, 0.336855233f},
-std::array<float,2>{0.583606899f, 0.720034182f},
-std::array<float,2>{0.0380734317f, 0.498557478f},
-std::array<float,2>{0.312948763f, 0.971444309f},
-std::array<float,2>{0.799726248f, 0.200478375f},
-std::array<float,2>{0.620707452f, 0.994435847f},
-std::array<float,2>{0.000129391963f, 0.213543639f},
-std::array<float,2>{0.370144188f, 0.745733917f},
-std::array<float,2>{0.770117283f, 0.482254326f},
-std::array<float,2>{0.888299882f, 0.571891308f},
-std::array<float,2>{0.377847612f, 0.319273263f},
-std::array<float,2>{0.149516299f, 0.873671174f},
-std::array<float,2>{0.666756988f, 0.0943558589f},
-std::array<float,2>{0.844096661f, 0.785789251f},
-std::array<float,2>{0.275307685f, 0.0232304782f},
-std::array<float,2>{0.12413919f, 0.515743136f},
-std::array<float,2>{0.520143509f, 0.255946726f},
-std::array<float,2>{0.749437273f, 0.675947964f},
-std::array<float,2>{0.222308978f, 0.393737793f},
-std::array<float,2>{0.446469098f, 0.928341985f},
-std::array<float,2>{0.967303514f, 0.165686131f},
-std::array<float,2>{0.650894105f, 0.822195709f},
-std::array<float,2>{0.161176428f, 0.079541482f},
-std::array<float,2>{0.422281891f, 0.61733681f},
-std::array<float,2>{0.914980888f, 0.354735702f},
-std::array<float,2>{0.794912398f, 0.702437222f},
-std::array<float,2>{0.329138249f, 0.443008542f},
-std::array<float,2>{0.0578586683f, 0.949603617f},
-std::array<float,2>{0.56302613f, 0.241868094f},
-std::array<float,2>{0.99041754f, 0.894262075f},
-std::array<float,2>{0.474030197f, 0.134547353f},
-std::array<float,2>{0.193888873f, 0.649865329f},
-std::array<float,2>{0.710372448f, 0.41203317f},
-std::array<float,2>{0.552760005f, 0.559789181f},
-std::array<float,2>{0.0891649649f, 0.281859308f},
-std::array<float,2>{0.297668815f, 0.756369531f},
-std::array<float,2>{0.829349279f, 0.0380962379f},
-std::array<float,2>{0.575640559f, 0.859740078f},
-std::array<float,2>{0.0503047556f, 0.105255671f},
-std::array<float,2>{0.343005955f, 0.568248272f},
-std::array<float,2>{0.784835875f, 0.325833082f},
-std::array<float,2>{0.914052188f, 0.7415151f},
-std::array<float,2>{0.434143007f, 0.469224542f},
-std::array<float,2>{0.170690119f, 0.987944722f},
-std::array<float,2>{0.641280234f, 0.20941636f},
-std::array<float,2>{0.839173973f, 0.933483779f},
-std::array<float,2>{0.305169404f, 0.156794146f},
-std::array<float,2>{0.0796087161f, 0.682002485f},
-std::array<float,2>{0.561592877f, 0.404469073f},
-std::array<float,2>{0.712958157f, 0.526759446f},
-std::array<float,2>{0.201424927f, 0.26339075f},
-std::array<float,2>{0.483339071f, 0.794003904f},
-std::array<float,2>{0.999113321f, 0.0274559297f},
-std::array<float,2>{0.661313176f, 0.93754518f},
-std::array<float,2>{0.145219237f, 0.24436897f},
-std::array<float,2>{0.38496834f, 0.69478333f},
-std::array<float,2>{0.876537144f, 0.445463091f},
-std::array<float,2>{0.774965405f, 0.614796162f},
-std::array<float,2>{0.364242822f, 0.351379722f},
-std::array<float,2>{0.00939474907f, 0.813930452f},
-std::array<float,2>{0.615959167f, 0.0889967605f},
-std::array<float,2>{0.955873549f, 0.765547335f},
-std::array<float,2>{0.440262586f, 0.0461229086f},
-std::array<float,2>{0.232774675f, 0.548562288f},
-std::array<float,2>{0.734746039f, 0.292359352f},
-std::array<float,2>{0.525405109f, 0.643629372f},
-std::array<float,2>{0.11628262f, 0.420982152f},
-std::array<float,2>{0.266438097f, 0.900236666f},
-std::array<float,2>{0.852943897f, 0.128223464f},
-std::array<float,2>{0.536062837f, 0.883703232f},
-std::array<float,2>{0.0675444975f, 0.149496704f},
-std::array<float,2>{0.292727262f, 0.628923833f},
-std::array<float,2>{0.827431023f, 0.427487761f},
-std::array<float,2>{0.977330327f, 0.535612285f},
-std::array<float,2>{0.491959363f, 0.298049748f},
-std::array<float,2>{0.21441628f, 0.778755486f},
-std::array<float,2>{0.689529836f, 0.0582669117f},
-std::array<float,2>{0.805523992f, 0.841323078f},
-std::array<float,2>{0.322179854f, 0.0731906667f},
-std::array<float,2>{0.046821706f, 0.59534955f},
-std::array<float,2>{0.589923859f, 0.360889345f},
-std::array<float,2>{0.639258742f, 0.71784544f},
-std::array<float,2>{0.183019415f, 0.464455992f},
-std::array<float,2>{0.418902844f, 0.962520599f},
-std::array<float,2>{0.922390699f, 0.221549302f},
-std::array<float,2>{0.72392416f, 0.799287736f},
-std::array<float,2>{0.245076984f, 0.000925346569f},
-std::array<float,2>{0.462748617f, 0.503404558f},
-std::array<float,2>{0.94213444f, 0.27231276f},
-std::array<float,2>{0.863878667f, 0.66784966f},
-std::array<float,2>{0.262889117f, 0.37976265f},
-std::array<float,2>{0.107785195f, 0.921304822f},
-std::array<float,2>{0.50757885f, 0.18510659f},
-std::array<float,2>{0.892538011f, 0.981238544f},
-std::array<float,2>{0.39782992f, 0.194477916f},
-std::array<float,2>{0.137868032f, 0.732113898f},
-std::array<float,2>{0.679098129f, 0.490622342f},
-std::array<float,2>{0.605614305f, 0.590112805f},
-std::array<float,2>{0.0267216228f, 0.331614166f},
-std::array<float,2>{0.344729185f, 0.858384192f},
-std::array<float,2>{0.750198126f, 0.110012874f},
-std::array<float,2>{0.530376375f, 0.845692098f},
-std::array<float,2>{0.1103101f, 0.121865585f},
-std::array<float,2>{0.271309525f, 0.581499696f},
-std::array<float,2>{0.858751059f, 0.343108207f},
-std::array<float,2>{0.959881902f, 0.725332916f},
-std::array<float,2>{0.444732964f, 0.4954364f},
-std::array<float,2>{0.230084568f, 0.974200308f},
-std::array<float,2>{0.742016554f, 0.199189112f},
-std::array<float,2>{0.781198144f, 0.910566568f},
-std::array<float,2>{0.360684991f, 0.178943887f},
-std::array<float,2>{0.0140924202f, 0.65940702f},
-std::array<float,2>{0.612322986f, 0.387145817f},
-std::array<float,2>{0.659452081f, 0.511106491f},
-std::array<float,2>{0.141502693f, 0.27549234f},
-std::array<float,2>{0.389369726f, 0.808778226f},
-std::array<float,2>{0.879053354f, 0.0127396313f},
-std::array<float,2>{0.718531787f, 0.956575811f},
-std::array<float,2>{0.196455613f, 0.230603561f},
-std::array<float,2>{0.476770639f, 0.709123015f},
-std::array<float,2>{0.995423317f, 0.460928589f},
-std::array<float,2>{0.841223538f, 0.603970051f},
-std::array<float,2>{0.312486976f, 0.37241298f},
-std::array<float,2>{0.0852218792f, 0.830361784f},
-std::array<float,2>{0.556675136f, 0.0651960596f},
-std::array<float,2>{0.907010257f, 0.767629147f},
-std::array<float,2>{0.432975709f, 0.0520281196f},
-std::array<float,2>{0.164613232f, 0.543139696f},
-std::array<float,2>{0.647543132f, 0.309221685f},
-std::array<float,2>{0.573163867f, 0.639082789f},
-std::array<float,2>{0.051447548f, 0.432401687f},
-std::array<float,2>{0.339327812f, 0.876840174f},
-std::array<float,2>{0.786309361f, 0.146149695f},
-std::array<float,2>{0.601625443f, 0.894632518f},
-std::array<float,2>{0.0277012307f, 0.138679042f},
-std::array<float,2>{0.349549085f, 0.65378511f},
-std::array<float,2>{0.75646162f, 0.407394111f},
-std::array<float,2>{0.894532084f, 0.554789007f},
-std::array<float,2>{0.39423272f, 0.286916286f},
-std::array<float,2>{0.133425057f, 0.75183177f},
-std::array<float,2>{0.67405659f, 0.0328607708f},
-std::array<float,2>{0.861845136f, 0.826181173f},
-std::array<float,2>{0.257842779f, 0.0849934816f},
-std::array<float,2>{0.104837775f, 0.622587025f},
-std::array<float,2>{0.502522945f, 0.35724321f},
-std::array<float,2>{0.71951431f, 0.696510553f},
-std::array<float,2>{0.249915704f, 0.43855229f},
-std::array<float,2>{0.466138333f, 0.946854532f},
-std::array<float,2>{0.937557578f, 0.234611258f},
-std::array<float,2>{0.635703146f, 0.783495009f},
-std::array<float,2>{0.186057121f, 0.0165875815f},
-std::array<float,2>{0.417871326f, 0.521430731f},
-std::array<float,2>{0.927952766f, 0.251354814f},
-std::array<float,2>{0.810255766f, 0.67216903f},
-std::array<float,2>{0.325848371f, 0.395887256f},
-std::array<float,2>{0.0402207561f, 0.921935558f},
-std::array<float,2>{0.589754522f, 0.171605185f},
-std::array<float,2>{0.981921971f, 0.996583283f},
-std::array<float,2>{0.487269193f, 0.215775654f},
-std::array<float,2>{0.218292743f, 0.74947238f},
-std::array<float,2>{0.695241928f, 0.479595065f},
-std::array<float,2>{0.534003973f, 0.57452625f},
-std::array<float,2>{0.0645402819f, 0.313247055f},
-std::array<float,2>{0.296499372f, 0.870798349f},
-std::array<float,2>{0.82042104f, 0.0986455083f},
-std::array<float,2>{0.580209315f, 0.75824827f},
-std::array<float,2>{0.0333561823f, 0.0411733985f},
-std::array<float,2>{0.316616029f, 0.550958931f},
-std::array<float,2>{0.801106751f, 0.293489039f},
-std::array<float,2>{0.930065691f, 0.645771027f},
-std::array<float,2>{0.411260784f, 0.414105624f},
-std::array<float,2>{0.176058471f, 0.902727008f},
-std::array<float,2>{0.629082203f, 0.131524965f},
-std::array<float,2>{0.817276478f, 0.942049205f},
-std::array<float,2>{0.282103986f, 0.247687653f},
-std::array<float,2>{0.0726362169f, 0.689143836f},
-std::array<float,2>{0.542464554f, 0.453063965f},
-std::array<float,2>{0.69604528f, 0.610032558f},
-std::array<float,2>{0.20644857f, 0.34489727f},
-std::array<float,2>{0.497375131f, 0.81910944f},
-std::array<float,2>{0.973595023f, 0.0924811512f},
-std::array<float,2>{0.679797649f, 0.933756232f},
-std::array<float,2>{0.126143053f, 0.160216808f},
-std::array<float,2>{0.399026066f, 0.685539782f},
-std::array<float,2>{0.900782347f, 0.398585677f},
-std::array<float,2>{0.764045537f, 0.528034151f},
-std::array<float,2>{0.354059428f, 0.26026842f},
-std::array<float,2>{0.0161082055f, 0.792049944f},
-std::array<float,2>{0.600058675f, 0.0255935658f},
-std::array<float,2>{0.947433889f, 0.866192758f},
-std::array<float,2>{0.46036306f, 0.107787505f},
-std::array<float,2>{0.23688896f, 0.563460708f},
-std::array<float,2>{0.72983706f, 0.322216988f},
-std::array<float,2>{0.507961035f, 0.738126397f},
-std::array<float,2>{0.0981012434f, 0.476465285f},
-std::array<float,2>{0.254715055f, 0.992123723f},
-std::array<float,2>{0.868964016f, 0.203513041f},
-std::array<float,2>{0.54999125f, 0.979443431f},
-std::array<float,2>{0.0903147236f, 0.187628731f},
-std::array<float,2>{0.301803529f, 0.730202615f},
-std::array<float,2>{0.834425151f, 0.48586598f},
-std::array<float,2>{0.984839559f, 0.588168323f},
-std::array<float,2>{0.470471829f, 0.334701955f},
-std::array<float,2>{0.188539505f, 0.852704406f},
-std::array<float,2>{0.704897165f, 0.113495521f},
-std::array<float,2>{0.792123795f, 0.802172899f},
-std::array<float,2>{0.334015787f, 0.0074786609f},
-std::array<float,2>{0.0620528422f, 0.505795896f},
-std::array<float,2>{0.568319142f, 0.267754465f},
-std::array<float,2>{0.655989349f, 0.668808281f},
-std::array<float,2>{0.158598647f, 0.378611833f},
-std::array<float,2>{0.426595092f, 0.915812492f},
-std::array<float,2>{0.921561778f, 0.182312399f},
-std::array<float,2>{0.746004939f, 0.838825166f},
-std::array<float,2>{0.222963914f, 0.0750899836f},
-std::array<float,2>{0.449632913f, 0.599344611f},
-std::array<float,2>{0.96145612f, 0.366976917f},
-std::array<float,2>{0.848838449f, 0.713980913f},
-std::array<float,2>{0.28050819f, 0.468371928f},
-std::array<float,2>{0.119491912f, 0.965280771f},
-std::array<float,2>{0.518396199f, 0.225299388f},
-std::array<float,2>{0.883064032f, 0.887977898f},
-std::array<float,2>{0.381924599f, 0.154971078f},
-std::array<float,2>{0.153570771f, 0.626564324f},
-std::array<float,2>{0.669270456f, 0.422200084f},
-std::array<float,2>{0.621785104f, 0.531449318f},
-std::array<float,2>{0.00770104304f, 0.30090183f},
-std::array<float,2>{0.372433424f, 0.776824176f},
-std::array<float,2>{0.766533196f, 0.0610751472f},
-std::array<float,2>{0.546467364f, 0.805926681f},
-std::array<float,2>{0.0769966245f, 0.00941002183f},
-std::array<float,2>{0.286079049f, 0.511763155f},
-std::array<float,2>{0.815711915f, 0.27919355f},
-std::array<float,2>{0.96952641f, 0.662044168f},
-std::array<float,2>{0.495257795f, 0.386210352f},
-std::array<float,2>{0.207596004f, 0.908746362f},
-std::array<float,2>{0.702655256f, 0.172009289f},
-std::array<float,2>{0.797870874f, 0.970042169f},
-std::array<float,2>{0.315111578f, 0.202009961f},
-std::array<float,2>{0.0370307751f, 0.722058833f},
-std::array<float,2>{0.585599184f, 0.497552693f},
-std::array<float,2>{0.626821399f, 0.583841085f},
-std::array<float,2>{0.174751073f, 0.33902517f},
-std::array<float,2>{0.407088369f, 0.847894967f},
-std::array<float,2>{0.936241627f, 0.11806149f},
-std::array<float,2>{0.731634557f, 0.880788386f},
-std::array<float,2>{0.241973341f, 0.143432528f},
-std::array<float,2>{0.45320797f, 0.634180665f},
-std::array<float,2>{0.949314654f, 0.436774492f},
-std::array<float,2>{0.872331619f, 0.540635228f},
-std::array<float,2>{0.252839357f, 0.308185935f},
-std::array<float,2>{0.0958660617f, 0.769794941f},
-std::array<float,2>{0.515535295f, 0.0506237075f},
-std::array<float,2>{0.902492166f, 0.835588992f},
-std::array<float,2>{0.406162411f, 0.0666083097f},
-std::array<float,2>{0.129372731f, 0.609236956f},
-std::array<float,2>{0.685899854f, 0.367663532f},
-std::array<float,2>{0.59425211f, 0.704802454f},
-std::array<float,2>{0.0217063483f, 0.455102235f},
-std::array<float,2>{0.357733756f, 0.959766626f},
-std::array<float,2>{0.759342313f, 0.22846669f},
-std::array<float,2>{0.565904379f, 0.953015387f},
-std::array<float,2>{0.0564015619f, 0.239987388f},
-std::array<float,2>{0.330453873f, 0.700196445f},
-std::array<float,2>{0.795658052f, 0.44440484f},
-std::array<float,2>{0.917594373f, 0.620941639f},
-std::array<float,2>{0.423936218f, 0.352069795f},
-std::array<float,2>{0.162568897f, 0.823352396f},
-std::array<float,2>{0.648967206f, 0.0815897137f},
-std::array<float,2>{0.831992328f, 0.7553581f},
-std::array<float,2>{0.300448477f, 0.0363872722f},
-std::array<float,2>{0.0867160261f, 0.561308444f},
-std::array<float,2>{0.550960004f, 0.285079211f},
-std::array<float,2>{0.707953572f, 0.650947034f},
-std::array<float,2>{0.191564783f, 0.412592351f},
-std::array<float,2>{0.475004137f, 0.891658604f},
-std::array<float,2>{0.989744484f, 0.135987088f},
-std::array<float,2>{0.664518476f, 0.871844471f},
-std::array<float,2>{0.152113095f, 0.0961902663f},
-std::array<float,2>{0.375103503f, 0.573136806f},
-std::array<float,2>{0.890477657f, 0.318234384f},
-std::array<float,2>{0.772899508f, 0.743828595f},
-std::array<float,2>{0.368977696f, 0.484248608f},
-std::array<float,2>{0.00284389709f, 0.99379164f},
-std::array<float,2>{0.619034529f, 0.212788329f},
-std::array<float,2>{0.966386974f, 0.926030397f},
-std::array<float,2>{0.448634446f, 0.166890264f},
-std::array<float,2>{0.219412029f, 0.678216398f},
-std::array<float,2>{0.747902989f, 0.391809106f},
-std::array<float,2>{0.523351669f, 0.519409478f},
-std::array<float,2>{0.122968152f, 0.255818158f},
-std::array<float,2>{0.277134091f, 0.78817296f},
-std::array<float,2>{0.847334146f, 0.0213080924f},
-std::array<float,2>{0.614120603f, 0.81538409f},
-std::array<float,2>{0.0110131409f, 0.0877533779f},
-std::array<float,2>{0.366561413f, 0.616204023f},
-std::array<float,2>{0.776589632f, 0.347901881f},
-std::array<float,2>{0.877315283f, 0.691555381f},
-std::array<float,2>{0.38380447f, 0.447542101f},
-std::array<float,2>{0.146842659f, 0.939674795f},
-std::array<float,2>{0.662443519f, 0.243388474f},
-std::array<float,2>{0.853695095f, 0.901945114f},
-std::array<float,2>{0.268354386f, 0.126618609f},
-std::array<float,2>{0.114555143f, 0.64131254f},
-std::array<float,2>{0.525001228f, 0.419053674f},
-std::array<float,2>{0.736903727f, 0.550160348f},
-std::array<float,2>{0.231045768f, 0.289720148f},
-std::array<float,2>{0.437684834f, 0.762127995f},
-std::array<float,2>{0.953219235f, 0.0436866879f},
-std::array<float,2>{0.642607033f, 0.985956132f},
-std::array<float,2>{0.169109687f, 0.208932072f},
-std::array<float,2>{0.43666783f, 0.740063667f},
-std::array<float,2>{0.911289573f, 0.471072048f},
-std::array<float,2>{0.782757878f, 0.56903249f},
-std::array<float,2>{0.341186643f, 0.327827215f},
-std::array<float,2>{0.0484468751f, 0.862734795f},
-std::array<float,2>{0.577409506f, 0.101925761f},
-std::array<float,2>{0.996117592f, 0.794984281f},
-std::array<float,2>{0.481401473f, 0.0310791414f},
-std::array<float,2>{0.200689003f, 0.524383664f},
-std::array<float,2>{0.71155858f, 0.265239418f},
-std::array<float,2>{0.559997082f, 0.67979449f},
-std::array<float,2>{0.0803422183f, 0.404075325f},
-std::array<float,2>{0.308285773f, 0.930484235f},
-std::array<float,2>{0.836412311f, 0.159607679f},
-std::array<float,2>{0.504888535f, 0.918127954f},
-std::array<float,2>{0.105955213f, 0.186510667f},
-std::array<float,2>{0.263733536f, 0.665893912f},
-std::array<float,2>{0.866171002f, 0.381732196f},
-std::array<float,2>{0.943390667f, 0.500178277f},
-std::array<float,2>{0.464729816f, 0.271016866f},
-std::array<float,2>{0.243334666f, 0.797567427f},
-std::array<float,2>{0.725688577f, 0.00330514391f},
-std::array<float,2>{0.753637373f, 0.856955469f},
-std::array<float,2>{0.346084654f, 0.111944415f},
-std::array<float,2>{0.0249056332f, 0.593271911f},
-std::array<float,2>{0.608788013f, 0.328879327f},
-std::array<float,2>{0.675863206f, 0.732486308f},
-std::array<float,2>{0.139882773f, 0.488622427f},
-std::array<float,2>{0.395150483f, 0.983663082f},
-std::array<float,2>{0.893989325f, 0.191882849f},
-std::array<float,2>{0.687776208f, 0.780085385f},
-std::array<float,2>{0.212304786f, 0.0559443533f},
-std::array<float,2>{0.489337891f, 0.538104177f},
-std::array<float,2>{0.980359495f, 0.3001315f},
-std::array<float,2>{0.825631857f, 0.631841719f},
-std::array<float,2>{0.289121509f, 0.428612411f},
-std::array<float,2>{0.0697582737f, 0.885562778f},
-std::array<float,2>{0.537928998f, 0.151838586f},
-std::array<float,2>{0.925490379f, 0.96397984f},
-std::array<float,2>{0.42148906f, 0.219127744f},
-std::array<float,2>{0.179688498f, 0.715935588f},
-std::array<float,2>{0.637618005f, 0.461311251f},
-std::array<float,2>{0.592696667f, 0.595779359f},
-std::array<float,2>{0.0431330428f, 0.36241594f},
-std::array<float,2>{0.323987067f, 0.843384981f},
-std::array<float,2>{0.807864547f, 0.0713148862f},
-std::array<float,2>{0.518040419f, 0.837296426f},
-std::array<float,2>{0.119765066f, 0.0766875744f},
-std::array<float,2>{0.280836344f, 0.600053847f},
-std::array<float,2>{0.849502146f, 0.363916397f},
-std::array<float,2>{0.961267531f, 0.711985052f},
-std::array<float,2>{0.449810237f, 0.464888364f},
-std::array<float,2>{0.223189354f, 0.968723655f},
-std::array<float,2>{0.74535799f, 0.224169925f},
-std::array<float,2>{0.765956819f, 0.889861763f},
-std::array<float,2>{0.372870684f, 0.154050395f},
-std::array<float,2>{0.00694298605f, 0.628176987f},
-std::array<float,2>{0.621176779f, 0.424004197f},
-std::array<float,2>{0.669575214f, 0.534611404f},
-std::array<float,2>{0.153955698f, 0.303701997f},
-std::array<float,2>{0.382525504f, 0.773554265f},
-std::array<float,2>{0.883742332f, 0.0598109663f},
-std::array<float,2>{0.70441854f, 0.978129864f},
-std::array<float,2>{0.189169526f, 0.190111116f},
-std::array<float,2>{0.469928712f, 0.727914333f},
-std::array<float,2>{0.984954894f, 0.488167584f},
-std::array<float,2>{0.834895313f, 0.586851001f},
-std::array<float,2>{0.302630514f, 0.333302468f},
-std::array<float,2>{0.0906397775f, 0.85480231f},
-std::array<float,2>{0.550656557f, 0.11649657f},
-std::array<float,2>{0.921319664f, 0.80463016f},
-std::array<float,2>{0.42585665f, 0.00560148107f},
-std::array<float,2>{0.158985466f, 0.506277084f},
-std::array<float,2>{0.65531683f, 0.267017424f},
-std::array<float,2>{0.567507088f, 0.670890749f},
-std::array<float,2>{0.0617871396f, 0.375320613f},
-std::array<float,2>{0.334934235f, 0.917660177f},
-std::array<float,2>{0.792779565f, 0.181437775f},
-std::array<float,2>{0.600239694f, 0.93643111f},
-std::array<float,2>{0.0165322758f, 0.162512571f},
-std::array<float,2>{0.353531092f, 0.68603754f},
-std::array<float,2>{0.764521599f, 0.401034683f},
-std::array<float,2>{0.90107584f, 0.53123945f},
-std::array<float,2>{0.398750335f, 0.258791536f},
-std::array<float,2>{0.126477137f, 0.789775133f},
-std::array<float,2>{0.680417776f, 0.0243831277f},
-std::array<float,2>{0.868615031f, 0.864874423f},
-std::array<float,2>{0.254142553f, 0.10615088f},
-std::array<float,2>{0.0982591435f, 0.565221846f},
-std::array<float,2>{0.508533537f, 0.323706597f},
-std::array<float,2>{0.730175793f, 0.734572411f},
-std::array<float,2>{0.236444071f, 0.474425465f},
-std::array<float,2>{0.460758507f, 0.989450932f},
-std::array<float,2>{0.948163033f, 0.205477059f},
-std::array<float,2>{0.629862964f, 0.760809541f},
-std::array<float,2>{0.176471099f, 0.0400016308f},
-std::array<float,2>{0.411830842f, 0.55380857f},
-std::array<float,2>{0.930303216f, 0.296433568f},
-std::array<float,2>{0.801741719f, 0.646589637f},
-std::array<float,2>{0.317364961f, 0.416629493f},
-std::array<float,2>{0.0339206643f, 0.905457616f},
-std::array<float,2>{0.581035733f, 0.129709497f},
-std::array<float,2>{0.972934484f, 0.944493294f},
-std::array<float,2>{0.497768492f, 0.248169243f},
-std::array<float,2>{0.206729606f, 0.690976501f},
-std::array<float,2>{0.695498168f, 0.449361205f},
-std::array<float,2>{0.542901278f, 0.612727523f},
-std::array<float,2>{0.0731988549f, 0.346785158f},
-std::array<float,2>{0.281709135f, 0.817746758f},
-std::array<float,2>{0.816603243f, 0.090369232f},
-std::array<float,2>{0.588868499f, 0.782362223f},
-std::array<float,2>{0.0407796539f, 0.0194921885f},
-std::array<float,2>{0.325215489f, 0.522135258f},
-std::array<float,2>{0.809992731f, 0.252445042f},
-std::array<float,2>{0.928536713f, 0.674968004f},
-std::array<float,2>{0.417051256f, 0.398124546f},
-std::array<float,2>{0.185751081f, 0.925454199f},
-std::array<float,2>{0.634988427f, 0.168004781f},
-std::array<float,2>{0.821114659f, 0.999208808f},
-std::array<float,2>{0.295899987f, 0.217244312f},
-std::array<float,2>{0.0651541725f, 0.746345043f},
-std::array<float,2>{0.533578575f, 0.476991624f},
-std::array<float,2>{0.69465971f, 0.577958465f},
-std::array<float,2>{0.217955738f, 0.316356719f},
-std::array<float,2>{0.486794889f, 0.868258476f},
-std::array<float,2>{0.982053995f, 0.101214953f},
-std::array<float,2>{0.674622834f, 0.897605002f},
-std::array<float,2>{0.133219987f, 0.13769944f},
-std::array<float,2>{0.393887103f, 0.6555233f},
-std::array<float,2>{0.895340264f, 0.408992559f},
-std::array<float,2>{0.75631845f, 0.556751192f},
-std::array<float,2>{0.349075675f, 0.287151724f},
-std::array<float,2>{0.0282639712f, 0.753824294f},
-std::array<float,2>{0.602155447f, 0.0349084698f},
-std::array<float,2>{0.938316643f, 0.824369907f},
-std::array<float,2>{0.466547966f, 0.0835062638f},
-std::array<float,2>{0.249457136f, 0.623217344f},
-std::array<float,2>{0.719111204f, 0.358405769f},
-std::array<float,2>{0.502024412f, 0.69879657f},
-std::array<float,2>{0.105433539f, 0.440103769f},
-std::array<float,2>{0.258416295f, 0.947971165f},
-std::array<float,2>{0.861796796f, 0.238096923f},
-std::array<float,2>{0.557337403f, 0.954311311f},
-std::array<float,2>{0.0856379122f, 0.233374521f},
-std::array<float,2>{0.311531514f, 0.708572686f},
-std::array<float,2>{0.841607332f, 0.458184958f},
-std::array<float,2>{0.996018648f, 0.602499604f},
-std::array<float,2>{0.477229595f, 0.374499679f},
-std::array<float,2>{0.196811259f, 0.82890439f},
-std::array<float,2>{0.718113542f, 0.0635931045f},
-std::array<float,2>{0.786824524f, 0.767302632f},
-std::array<float,2>{0.339588016f, 0.0529945791f},
-std::array<float,2>{0.0511114895f, 0.54593575f},
-std::array<float,2>{0.572428763f, 0.310589075f},
-std::array<float,2>{0.648200214f, 0.638610184f},
-std::array<float,2>{0.164499775f, 0.430318117f},
-std::array<float,2>{0.433383763f, 0.877150714f},
-std::array<float,2>{0.906680703f, 0.146921888f},
-std::array<float,2>{0.741483808f, 0.846636415f},
-std::array<float,2>{0.229889721f, 0.12488573f},
-std::array<float,2>{0.444838107f, 0.578497946f},
-std::array<float,2>{0.959017694f, 0.340954512f},
-std::array<float,2>{0.859167218f, 0.724563658f},
-std::array<float,2>{0.270833611f, 0.493316889f},
-std::array<float,2>{0.1095642f, 0.974631131f},
-std::array<float,2>{0.530786991f, 0.19639419f},
-std::array<float,2>{0.879535735f, 0.913996935f},
-std::array<float,2>{0.388783395f, 0.176802009f},
-std::array<float,2>{0.140633479f, 0.65664506f},
-std::array<float,2>{0.65999043f, 0.389468402f},
-std::array<float,2>{0.612973213f, 0.508478224f},
-std::array<float,2>{0.0144169275f, 0.275216937f},
-std::array<float,2>{0.361312747f, 0.810946465f},
-std::array<float,2>{0.780305564f, 0.0152535429f},
-std::array<float,2>{0.537378669f, 0.779231071f},
-std::array<float,2>{0.0700569972f, 0.0579308681f},
-std::array<float,2>{0.289922625f, 0.535738528f},
-std::array<float,2>{0.825742245f, 0.298803806f},
-std::array<float,2>{0.979655623f, 0.629742801f},
-std::array<float,2>{0.48985669f, 0.427012324f},
-std::array<float,2>{0.2127745f, 0.882939279f},
-std::array<float,2>{0.688179076f, 0.150025785f},
-std::array<float,2>{0.808356881f, 0.962321937f},
-std::array<float,2>{0.323593765f, 0.220766574f},
-std::array<float,2>{0.0437655225f, 0.718535483f},
-std::array<float,2>{0.592150867f, 0.464009106f},
-std::array<float,2>{0.637029827f, 0.594935298f},
-std::array<float,2>{0.18061994f, 0.360433251f},
-std::array<float,2>{0.421073824f, 0.841292322f},
-std::array<float,2>{0.924870431f, 0.072480157f},
-std::array<float,2>{0.726525068f, 0.921454251f},
-std::array<float,2>{0.243786141f, 0.184706554f},
-std::array<float,2>{0.46421957f, 0.667321205f},
-std::array<float,2>{0.944209158f, 0.379269511f},
-std::array<float,2>{0.865289807f, 0.503832042f},
-std::array<float,2>{0.264524966f, 0.271530092f},
-std::array<float,2>{0.106383212f, 0.799675703f},
-std::array<float,2>{0.505634308f, 1.41586388e-05f},
-std::array<float,2>{0.894080579f, 0.857443452f},
-std::array<float,2>{0.394781023f, 0.109551787f},
-std::array<float,2>{0.140406668f, 0.590713143f},
-std::array<float,2>{0.676716924f, 0.331494749f},
-std::array<float,2>{0.609018385f, 0.731707752f},
-std::array<float,2>{0.0244487375f, 0.490945339f},
-std::array<float,2>{0.346365213f, 0.980539739f},
-std::array<float,2>{0.753252923f, 0.194864601f},
-std::array<float,2>{0.577697217f, 0.987432957f},
-std::array<float,2>{0.0482099615f, 0.20952937f},
-std::array<float,2>{0.341398358f, 0.741719544f},
-std::array<float,2>{0.782236636f, 0.469503731f},
-std::array<float,2>{0.91207689f, 0.567575932f},
-std::array<float,2>{0.437166959f, 0.325350791f},
-std::array<float,2>{0.169892117f, 0.860009193f},
-std::array<float,2>{0.643133521f, 0.104602307f},
-std::array<float,2>{0.836797655f, 0.794521093f},
-std::array<float,2>{0.307830364f, 0.028313566f},
-std::array<float,2>{0.0806971565f, 0.526994944f},
-std::array<float,2>{0.56012857f, 0.263070434f},
-std::array<float,2>{0.711018324f, 0.682287037f},
-std::array<float,2>{0.200365946f, 0.404884756f},
-std::array<float,2>{0.48095578f, 0.932784557f},
-std::array<float,2>{0.996991098f, 0.156357855f},
-std::array<float,2>{0.662998497f, 0.814414382f},
-std::array<float,2>{0.147225738f, 0.0894200802f},
-std::array<float,2>{0.384639293f, 0.614274383f},
-std::array<float,2>{0.877917051f, 0.351047516f},
-std::array<float,2>{0.777143538f, 0.694947124f},
-std::array<float,2>{0.366793603f, 0.446172208f},
-std::array<float,2>{0.0115821324f, 0.938026726f},
-std::array<float,2>{0.613636315f, 0.24485074f},
-std::array<float,2>{0.953855991f, 0.899822414f},
-std::array<float,2>{0.438280582f, 0.128834948f},
-std::array<float,2>{0.230845138f, 0.644147038f},
-std::array<float,2>{0.736516833f, 0.421642065f},
-std::array<float,2>{0.52477783f, 0.548134983f},
-std::array<float,2>{0.115047909f, 0.292543411f},
-std::array<float,2>{0.267698377f, 0.765068352f},
-std::array<float,2>{0.854332209f, 0.0466870479f},
-std::array<float,2>{0.618602037f, 0.87321955f},
-std::array<float,2>{0.00217550574f, 0.0940612927f},
-std::array<float,2>{0.368489921f, 0.571606815f},
-std::array<float,2>{0.773208976f, 0.318792015f},
-std::array<float,2>{0.890042186f, 0.745443583f},
-std::array<float,2>{0.375628442f, 0.481591076f},
-std::array<float,2>{0.151793361f, 0.994848073f},
-std::array<float,2>{0.664565802f, 0.213166341f},
-std::array<float,2>{0.846873045f, 0.927850902f},
-std::array<float,2>{0.27668637f, 0.165326253f},
-std::array<float,2>{0.122324117f, 0.676619351f},
-std::array<float,2>{0.522720039f, 0.394378513f},
-std::array<float,2>{0.747331679f, 0.516541481f},
-std::array<float,2>{0.218894839f, 0.256744593f},
-std::array<float,2>{0.449180484f, 0.785418749f},
-std::array<float,2>{0.966031432f, 0.0225986447f},
-std::array<float,2>{0.648610234f, 0.949940205f},
-std::array<float,2>{0.162956581f, 0.241361558f},
-std::array<float,2>{0.424755305f, 0.703005612f},
-std::array<float,2>{0.917038918f, 0.442571223f},
-std::array<float,2>{0.795334101f, 0.617861569f},
-std::array<float,2>{0.331046551f, 0.355136901f},
-std::array<float,2>{0.0560099967f, 0.821690321f},
-std::array<float,2>{0.565957308f, 0.0796320438f},
-std::array<float,2>{0.990088105f, 0.756088197f},
-std::array<float,2>{0.475241095f, 0.0390238501f},
-std::array<float,2>{0.192239642f, 0.560277104f},
-std::array<float,2>{0.707260609f, 0.28165856f},
-std::array<float,2>{0.551585972f, 0.650259912f},
-std::array<float,2>{0.0862790048f, 0.411589295f},
-std::array<float,2>{0.299862832f, 0.893748581f},
-std::array<float,2>{0.831446528f, 0.134134859f},
-std::array<float,2>{0.515082061f, 0.880919993f},
-std::array<float,2>{0.0964597166f, 0.141869247f},
-std::array<float,2>{0.25220874f, 0.635019064f},
-std::array<float,2>{0.872629404f, 0.433969468f},
-std::array<float,2>{0.949775219f, 0.542684555f},
-std::array<float,2>{0.453632176f, 0.30602622f},
-std::array<float,2>{0.241555914f, 0.773124754f},
-std::array<float,2>{0.732202351f, 0.0470932722f},
-std::array<float,2>{0.759201288f, 0.832996666f},
-std::array<float,2>{0.358199835f, 0.069989644f},
-std::array<float,2>{0.0222201496f, 0.605624616f},
-std::array<float,2>{0.594010055f, 0.369299173f},
-std::array<float,2>{0.686249733f, 0.705222726f},
-std::array<float,2>{0.129726902f, 0.453420609f},
-std::array<float,2>{0.405638069f, 0.958782911f},
-std::array<float,2>{0.90303725f, 0.22853744f},
-std::array<float,2>{0.702633619f, 0.807382226f},
-std::array<float,2>{0.207506999f, 0.00985355582f},
-std::array<float,2>{0.496065319f, 0.514549971f},
-std::array<float,2>{0.968896449f, 0.279629201f},
-std::array<float,2>{0.816200137f, 0.664035559f},
-std::array<float,2>{0.285551339f, 0.383458406f},
-std::array<float,2>{0.0766486228f, 0.907207608f},
-std::array<float,2>{0.546156108f, 0.174029678f},
-std::array<float,2>{0.935705245f, 0.971112132f},
-std::array<float,2>{0.406644344f, 0.20093888f},
-std::array<float,2>{0.17392233f, 0.720347226f},
-std::array<float,2>{0.626345456f, 0.4983868f},
-std::array<float,2>{0.585017085f, 0.58402735f},
-std::array<float,2>{0.0364467986f, 0.336237699f},
-std::array<float,2>{0.314904004f, 0.850683153f},
-std::array<float,2>{0.798538327f, 0.120079175f},
-std::array<float,2>{0.548675179f, 0.85348773f},
-std::array<float,2>{0.0928411335f, 0.113940895f},
-std::array<float,2>{0.304335147f, 0.588465393f},
-std::array<float,2>{0.832539678f, 0.334424615f},
-std::array<float,2>{0.987939656f, 0.729783177f},
-std::array<float,2>{0.472014099f, 0.485437304f},
-std::array<float,2>{0.189515233f, 0.978741646f},
-std::array<float,2>{0.705907226f, 0.188085273f},
-std::array<float,2>{0.789872944f, 0.915362895f},
-std::array<float,2>{0.333162129f, 0.182116345f},
-std::array<float,2>{0.0604981668f, 0.668007374f},
-std::array<float,2>{0.568873227f, 0.378333032f},
-std::array<float,2>{0.654152155f, 0.505037546f},
-std::array<float,2>{0.157308996f, 0.268142611f},
-std::array<float,2>{0.429064602f, 0.802706182f},
-std::array<float,2>{0.919299722f, 0.00691511203f},
-std::array<float,2>{0.7429896f, 0.965804935f},
-std::array<float,2>{0.225041285f, 0.224821299f},
-std::array<float,2>{0.451907367f, 0.714663029f},
-std::array<float,2>{0.963139832f, 0.467841059f},
-std::array<float,2>{0.850790203f, 0.599036336f},
-std::array<float,2>{0.2774674f, 0.366619378f},
-std::array<float,2>{0.118425503f, 0.838291109f},
-std::array<float,2>{0.517090023f, 0.0745221227f},
-std::array<float,2>{0.884838104f, 0.777328253f},
-std::array<float,2>{0.379530817f, 0.0606559739f},
-std::array<float,2>{0.155201226f, 0.532031536f},
-std::array<float,2>{0.671018481f, 0.301568717f},
-std::array<float,2>{0.624332249f, 0.62620163f},
-std::array<float,2>{0.00396319339f, 0.422666788f},
-std::array<float,2>{0.374410361f, 0.888206661f},
-std::array<float,2>{0.767896652f, 0.154640004f},
-std::array<float,2>{0.579347134f, 0.903235734f},
-std::array<float,2>{0.0326686837f, 0.130943477f},
-std::array<float,2>{0.319237173f, 0.646075964f},
-std::array<float,2>{0.803111136f, 0.414619237f},
-std::array<float,2>{0.931860328f, 0.551397145f},
-std::array<float,2>{0.412168384f, 0.293081105f},
-std::array<float,2>{0.177845374f, 0.758649945f},
-std::array<float,2>{0.632720947f, 0.0419308506f},
-std::array<float,2>{0.819012105f, 0.818645239f},
-std::array<float,2>{0.283539683f, 0.0919935703f},
-std::array<float,2>{0.071172379f, 0.609693468f},
-std::array<float,2>{0.539262235f, 0.345373005f},
-std::array<float,2>{0.698929548f, 0.688836336f},
-std::array<float,2>{0.204067081f, 0.452618986f},
-std::array<float,2>{0.498932391f, 0.941814244f},
-std::array<float,2>{0.976097047f, 0.247544229f},
-std::array<float,2>{0.682044029f, 0.792561591f},
-std::array<float,2>{0.12745437f, 0.0262480192f},
-std::array<float,2>{0.400997549f, 0.527635157f},
-std::array<float,2>{0.89848572f, 0.259773076f},
-std::array<float,2>{0.761727571f, 0.684583306f},
-std::array<float,2>{0.352595508f, 0.399258494f},
-std::array<float,2>{0.0176430643f, 0.934161961f},
-std::array<float,2>{0.597747087f, 0.1609025f},
-std::array<float,2>{0.946214139f, 0.991396904f},
-std::array<float,2>{0.458976924f, 0.203664809f},
-std::array<float,2>{0.235483035f, 0.737697005f},
-std::array<float,2>{0.72791934f, 0.476004958f},
-std::array<float,2>{0.509848416f, 0.562709987f},
-std::array<float,2>{0.100586027f, 0.321608096f},
-std::array<float,2>{0.256302297f, 0.865713656f},
-std::array<float,2>{0.869608462f, 0.108004794f},
-std::array<float,2>{0.605045557f, 0.751265526f},
-std::array<float,2>{0.0296883993f, 0.0324252844f},
-std::array<float,2>{0.350698978f, 0.555571556f},
-std::array<float,2>{0.754408419f, 0.286153436f},
-std::array<float,2>{0.896597147f, 0.654111445f},
-std::array<float,2>{0.390770644f, 0.408152789f},
-std::array<float,2>{0.134862334f, 0.895362496f},
-std::array<float,2>{0.671903849f, 0.139435545f},
-std::array<float,2>{0.859954f, 0.946440995f},
-std::array<float,2>{0.261295468f, 0.235074431f},
-std::array<float,2>{0.101813376f, 0.697045624f},
-std::array<float,2>{0.500025094f, 0.439050227f},
-std::array<float,2>{0.722597599f, 0.622180402f},
-std::array<float,2>{0.246603444f, 0.356764346f},
-std::array<float,2>{0.468742728f, 0.826762676f},
-std::array<float,2>{0.940252364f, 0.0858504772f},
-std::array<float,2>{0.63426739f, 0.922436297f},
-std::array<float,2>{0.18517603f, 0.171077713f},
-std::array<float,2>{0.414338201f, 0.67251128f},
-std::array<float,2>{0.927529216f, 0.396439761f},
-std::array<float,2>{0.811953187f, 0.520842552f},
-std::array<float,2>{0.32659781f, 0.251869261f},
-std::array<float,2>{0.0419864208f, 0.784035623f},
-std::array<float,2>{0.587619424f, 0.0159456786f},
-std::array<float,2>{0.983225822f, 0.870283604f},
-std::array<float,2>{0.485537201f, 0.0995050296f},
-std::array<float,2>{0.215048492f, 0.574709773f},
-std::array<float,2>{0.69326818f, 0.312869519f},
-std::array<float,2>{0.532313585f, 0.749536693f},
-std::array<float,2>{0.0636426508f, 0.480030417f},
-std::array<float,2>{0.294867188f, 0.9961766f},
-std::array<float,2>{0.822397232f, 0.215024769f},
-std::array<float,2>{0.52754277f, 0.973926723f},
-std::array<float,2>{0.112142667f, 0.198564798f},
-std::array<float,2>{0.273202717f, 0.724644125f},
-std::array<float,2>{0.8560853f, 0.496003985f},
-std::array<float,2>{0.957077086f, 0.581753552f},
-std::array<float,2>{0.442411035f, 0.343280315f},
-std::array<float,2>{0.226983383f, 0.844880164f},
-std::array<float,2>{0.739302874f, 0.121138796f},
-std::array<float,2>{0.778039217f, 0.809447825f},
-std::array<float,2>{0.362186432f, 0.0135508254f},
-std::array<float,2>{0.0127654308f, 0.51151979f},
-std::array<float,2>{0.609813273f, 0.276225299f},
-std::array<float,2>{0.657261908f, 0.659911513f},
-std::array<float,2>{0.143635541f, 0.387493074f},
-std::array<float,2>{0.387651384f, 0.910959423f},
-std::array<float,2>{0.880905747f, 0.179386273f},
-std::array<float,2>{0.716348946f, 0.830881596f},
-std::array<float,2>{0.197391212f, 0.0646735579f},
-std::array<float,2>{0.479643077f, 0.604445934f},
-std::array<float,2>{0.993147194f, 0.372639f},
-std::array<float,2>{0.842460275f, 0.709473431f},
-std::array<float,2>{0.309086353f, 0.460124701f},
-std::array<float,2>{0.0837179795f, 0.956468165f},
-std::array<float,2>{0.555318773f, 0.231169924f},
-std::array<float,2>{0.908757985f, 0.87615478f},
-std::array<float,2>{0.430929244f, 0.14582637f},
-std::array<float,2>{0.166655689f, 0.639516532f},
-std::array<float,2>{0.646396637f, 0.431928843f},
-std::array<float,2>{0.570503592f, 0.543539047f},
-std::array<float,2>{0.0527972691f, 0.309076577f},
-std::array<float,2>{0.337527335f, 0.768374503f},
-std::array<float,2>{0.788989604f, 0.0523617268f},
-std::array<float,2>{0.507102668f, 0.797351062f},
-std::array<float,2>{0.108300567f, 0.00365387439f},
-std::array<float,2>{0.263566226f, 0.500881553f},
-std::array<float,2>{0.863598287f, 0.270893365f},
-std::array<float,2>{0.941803873f, 0.66524905f},
-std::array<float,2>{0.461933792f, 0.38101235f},
-std::array<float,2>{0.244146258f, 0.918578446f},
-std::array<float,2>{0.724401355f, 0.185836539f},
-std::array<float,2>{0.750556171f, 0.984016955f},
-std::array<float,2>{0.345641822f, 0.192263514f},
-std::array<float,2>{0.027192127f, 0.733318746f},
-std::array<float,2>{0.606343031f, 0.489135534f},
-std::array<float,2>{0.679418564f, 0.592962742f},
-std::array<float,2>{0.138596311f, 0.328425914f},
-std::array<float,2>{0.397957087f, 0.856814265f},
-std::array<float,2>{0.891903639f, 0.111374803f},
-std::array<float,2>{0.690020382f, 0.884782016f},
-std::array<float,2>{0.214181989f, 0.152126625f},
-std::array<float,2>{0.49164483f, 0.632487178f},
-std::array<float,2>{0.976731539f, 0.427928805f},
-std::array<float,2>{0.827915668f, 0.538685739f},
-std::array<float,2>{0.292407095f, 0.300489724f},
-std::array<float,2>{0.0683462396f, 0.779349208f},
-std::array<float,2>{0.53546834f, 0.056557864f},
-std::array<float,2>{0.922326863f, 0.842973948f},
-std::array<float,2>{0.418016642f, 0.0719410256f},
-std::array<float,2>{0.18316479f, 0.596232355f},
-std::array<float,2>{0.639062941f, 0.363128901f},
-std::array<float,2>{0.590803981f, 0.716500878f},
-std::array<float,2>{0.046345517f, 0.46167922f},
-std::array<float,2>{0.321740389f, 0.964738905f},
-std::array<float,2>{0.80484122f, 0.219455317f},
-std::array<float,2>{0.615540445f, 0.940335214f},
-std::array<float,2>{0.00903955568f, 0.243704528f},
-std::array<float,2>{0.363701135f, 0.692353964f},
-std::array<float,2>{0.774625242f, 0.448195219f},
-std::array<float,2>{0.876017451f, 0.615289748f},
-std::array<float,2>{0.38533169f, 0.348242581f},
-std::array<float,2>{0.144930556f, 0.814504623f},
-std::array<float,2>{0.661843598f, 0.086987637f},
-std::array<float,2>{0.853436708f, 0.762212873f},
-std::array<float,2>{0.265799701f, 0.0433240272f},
-std::array<float,2>{0.116835453f, 0.550459623f},
-std::array<float,2>{0.526041985f, 0.28951785f},
-std::array<float,2>{0.73510474f, 0.640773237f},
-std::array<float,2>{0.233270705f, 0.419739723f},
-std::array<float,2>{0.439563692f, 0.901779532f},
-std::array<float,2>{0.955407858f, 0.126000091f},
-std::array<float,2>{0.640856564f, 0.862797856f},
-std::array<float,2>{0.169941545f, 0.102315642f},
-std::array<float,2>{0.433968812f, 0.568726659f},
-std::array<float,2>{0.913424134f, 0.327360749f},
-std::array<float,2>{0.78454715f, 0.739669204f},
-std::array<float,2>{0.343695462f, 0.471354157f},
-std::array<float,2>{0.0499559678f, 0.985681713f},
-std::array<float,2>{0.575732648f, 0.208172679f},
-std::array<float,2>{0.999888659f, 0.929907978f},
-std::array<float,2>{0.482494354f, 0.159996226f},
-std::array<float,2>{0.202100083f, 0.680272996f},
-std::array<float,2>{0.713394165f, 0.403323978f},
-std::array<float,2>{0.562149763f, 0.523852706f},
-std::array<float,2>{0.0792216659f, 0.264805466f},
-std::array<float,2>{0.305332005f, 0.795742393f},
-std::array<float,2>{0.839370489f, 0.0305551719f},
-std::array<float,2>{0.562740743f, 0.823760986f},
-std::array<float,2>{0.0582023524f, 0.0814713016f},
-std::array<float,2>{0.330077112f, 0.620341182f},
-std::array<float,2>{0.794262707f, 0.351734132f},
-std::array<float,2>{0.914299071f, 0.701106966f},
-std::array<float,2>{0.422578722f, 0.445174903f},
-std::array<float,2>{0.161956877f, 0.952585161f},
-std::array<float,2>{0.650595009f, 0.239696681f},
-std::array<float,2>{0.829743743f, 0.89226222f},
-std::array<float,2>{0.297172725f, 0.136283726f},
-std::array<float,2>{0.0897191837f, 0.650478244f},
-std::array<float,2>{0.553586364f, 0.412940234f},
-std::array<float,2>{0.710458338f, 0.560742855f},
-std::array<float,2>{0.193385988f, 0.28421551f},
-std::array<float,2>{0.474600136f, 0.755855858f},
-std::array<float,2>{0.991037846f, 0.036928501f},
-std::array<float,2>{0.666328311f, 0.993609667f},
-std::array<float,2>{0.150191188f, 0.212354198f},
-std::array<float,2>{0.376996011f, 0.743210614f},
-std::array<float,2>{0.88792634f, 0.483833343f},
-std::array<float,2>{0.769987047f, 0.572714627f},
-std::array<float,2>{0.370634764f, 0.317719907f},
-std::array<float,2>{0.000773255771f, 0.871127725f},
-std::array<float,2>{0.620330989f, 0.0962680876f},
-std::array<float,2>{0.967181206f, 0.788850844f},
-std::array<float,2>{0.447224438f, 0.0206829924f},
-std::array<float,2>{0.222108588f, 0.519025922f},
-std::array<float,2>{0.7499789f, 0.254952848f},
-std::array<float,2>{0.519798458f, 0.678472459f},
-std::array<float,2>{0.124700092f, 0.392171502f},
-std::array<float,2>{0.274803579f, 0.926328063f},
-std::array<float,2>{0.844431758f, 0.166165203f},
-std::array<float,2>{0.543437004f, 0.908237278f},
-std::array<float,2>{0.0744129643f, 0.172595292f},
-std::array<float,2>{0.288108259f, 0.661453843f},
-std::array<float,2>{0.814017177f, 0.386331946f},
-std::array<float,2>{0.971024632f, 0.512510598f},
-std::array<float,2>{0.49242866f, 0.278475165f},
-std::array<float,2>{0.210368544f, 0.806400537f},
-std::array<float,2>{0.699294329f, 0.00883387309f},
-std::array<float,2>{0.799043715f, 0.848528206f},
-std::array<float,2>{0.31301707f, 0.117650121f},
-std::array<float,2>{0.0375274457f, 0.583059132f},
-std::array<float,2>{0.583423495f, 0.339553863f},
-std::array<float,2>{0.628145516f, 0.722471774f},
-std::array<float,2>{0.17294547f, 0.497994751f},
-std::array<float,2>{0.408830851f, 0.970307469f},
-std::array<float,2>{0.934762537f, 0.201328248f},
-std::array<float,2>{0.73397398f, 0.770253181f},
-std::array<float,2>{0.239550397f, 0.0501276329f},
-std::array<float,2>{0.455935329f, 0.540411532f},
-std::array<float,2>{0.952563882f, 0.307717144f},
-std::array<float,2>{0.873553991f, 0.634361684f},
-std::array<float,2>{0.250151455f, 0.437357336f},
-std::array<float,2>{0.0942968503f, 0.880158067f},
-std::array<float,2>{0.512850463f, 0.142850935f},
-std::array<float,2>{0.905552566f, 0.959127307f},
-std::array<float,2>{0.402910918f, 0.227622539f},
-std::array<float,2>{0.131788507f, 0.704374194f},
-std::array<float,2>{0.68440336f, 0.455859274f},
-std::array<float,2>{0.597439706f, 0.608780503f},
-std::array<float,2>{0.0196479857f, 0.367681801f},
-std::array<float,2>{0.357184947f, 0.835201442f},
-std::array<float,2>{0.760939598f, 0.0672819391f},
-std::array<float,2>{0.540061593f, 0.81714052f},
-std::array<float,2>{0.0721477121f, 0.0911599845f},
-std::array<float,2>{0.285086662f, 0.611455142f},
-std::array<float,2>{0.819840431f, 0.346517622f},
-std::array<float,2>{0.975089669f, 0.68959415f},
-std::array<float,2>{0.499534935f, 0.450921208f},
-std::array<float,2>{0.2047299f, 0.944114745f},
-std::array<float,2>{0.698007762f, 0.249618813f},
-std::array<float,2>{0.804376662f, 0.904681504f},
-std::array<float,2>{0.31989795f, 0.130544409f},
-std::array<float,2>{0.031526532f, 0.647854745f},
-std::array<float,2>{0.578309119f, 0.417069435f},
-std::array<float,2>{0.631069839f, 0.553082943f},
-std::array<float,2>{0.17957741f, 0.295076162f},
-std::array<float,2>{0.413296103f, 0.759918511f},
-std::array<float,2>{0.933108389f, 0.0407072529f},
-std::array<float,2>{0.727007866f, 0.989151657f},
-std::array<float,2>{0.234455526f, 0.206502169f},
-std::array<float,2>{0.457830906f, 0.735956252f},
-std::array<float,2>{0.946567893f, 0.472972929f},
-std::array<float,2>{0.870616376f, 0.565582752f},
-std::array<float,2>{0.257463753f, 0.32294929f},
-std::array<float,2>{0.0996442065f, 0.863735735f},
-std::array<float,2>{0.511682868f, 0.107420452f},
-std::array<float,2>{0.899680018f, 0.790039778f},
-std::array<float,2>{0.402300686f, 0.024525648f},
-std::array<float,2>{0.128168017f, 0.529733479f},
-std::array<float,2>{0.683018506f, 0.258652002f},
-std::array<float,2>{0.599002719f, 0.686805248f},
-std::array<float,2>{0.0193690825f, 0.401495367f},
-std::array<float,2>{0.351691514f, 0.937363207f},
-std::array<float,2>{0.763014197f, 0.163385183f},
-std::array<float,2>{0.570301116f, 0.916430235f},
-std::array<float,2>{0.0590873472f, 0.179884389f},
-std::array<float,2>{0.332189232f, 0.671738386f},
-std::array<float,2>{0.790106833f, 0.376455009f},
-std::array<float,2>{0.918007612f, 0.50737375f},
-std::array<float,2>{0.428355932f, 0.265915662f},
-std::array<float,2>{0.156758577f, 0.803169489f},
-std::array<float,2>{0.652857006f, 0.00431634905f},
-std::array<float,2>{0.833492458f, 0.853702486f},
-std::array<float,2>{0.303455234f, 0.115379818f},
-std::array<float,2>{0.0920739099f, 0.587553799f},
-std::array<float,2>{0.547839224f, 0.332105011f},
-std::array<float,2>{0.706313252f, 0.72712189f},
-std::array<float,2>{0.191190228f, 0.487287551f},
-std::array<float,2>{0.471664578f, 0.977035999f},
-std::array<float,2>{0.986621082f, 0.191164359f},
-std::array<float,2>{0.670326412f, 0.774845183f},
-std::array<float,2>{0.155971497f, 0.0589221977f},
-std::array<float,2>{0.380412549f, 0.533468962f},
-std::array<float,2>{0.885942101f, 0.303851157f},
-std::array<float,2>{0.769020855f, 0.627156436f},
-std::array<float,2>{0.373464376f, 0.425356656f},
-std::array<float,2>{0.00529969949f, 0.889327109f},
-std::array<float,2>{0.623939633f, 0.15317513f},
-std::array<float,2>{0.964604378f, 0.967042625f},
-std::array<float,2>{0.45279339f, 0.222772077f},
-std::array<float,2>{0.226135239f, 0.711441457f},
-std::array<float,2>{0.743966699f, 0.465944678f},
-std::array<float,2>{0.516585648f, 0.601056516f},
-std::array<float,2>{0.117284991f, 0.365222216f},
-std::array<float,2>{0.279134065f, 0.836768866f},
-std::array<float,2>{0.849804819f, 0.0776852146f},
-std::array<float,2>{0.610514522f, 0.811690032f},
-std::array<float,2>{0.0122382287f, 0.0137747573f},
-std::array<float,2>{0.362897217f, 0.509249866f},
-std::array<float,2>{0.778558254f, 0.27362296f},
-std::array<float,2>{0.882593751f, 0.657251537f},
-std::array<float,2>{0.388392627f, 0.389937133f},
-std::array<float,2>{0.143079355f, 0.912394583f},
-std::array<float,2>{0.65631187f, 0.176542386f},
-std::array<float,2>{0.8567788f, 0.975811422f},
-std::array<float,2>{0.271620005f, 0.195658311f},
-std::array<float,2>{0.112790115f, 0.722777963f},
-std::array<float,2>{0.528623521f, 0.492290109f},
-std::array<float,2>{0.738930583f, 0.579678833f},
-std::array<float,2>{0.228212699f, 0.340226591f},
-std::array<float,2>{0.441415936f, 0.847156644f},
-std::array<float,2>{0.958562672f, 0.123417377f},
-std::array<float,2>{0.644905984f, 0.878332376f},
-std::array<float,2>{0.167273626f, 0.147502393f},
-std::array<float,2>{0.429960668f, 0.636915982f},
-std::array<float,2>{0.910150707f, 0.431588948f},
-std::array<float,2>{0.787148833f, 0.545408189f},
-std::array<float,2>{0.335944474f, 0.311565042f},
-std::array<float,2>{0.0545472801f, 0.765651166f},
-std::array<float,2>{0.57157284f, 0.0542855933f},
-std::array<float,2>{0.993578672f, 0.829143763f},
-std::array<float,2>{0.478795946f, 0.062626645f},
-std::array<float,2>{0.198733792f, 0.603180885f},
-std::array<float,2>{0.714898765f, 0.37324813f},
-std::array<float,2>{0.555791318f, 0.707867444f},
-std::array<float,2>{0.0823885426f, 0.45776403f},
-std::array<float,2>{0.310389757f, 0.953661621f},
-std::array<float,2>{0.843372703f, 0.234094456f},
-std::array<float,2>{0.501195133f, 0.948812842f},
-std::array<float,2>{0.103240117f, 0.236546576f},
-std::array<float,2>{0.26047641f, 0.697667956f},
-std::array<float,2>{0.860632062f, 0.441052735f},
-std::array<float,2>{0.941237271f, 0.624651194f},
-std::array<float,2>{0.467190951f, 0.357912272f},
-std::array<float,2>{0.247732759f, 0.825471759f},
-std::array<float,2>{0.721157193f, 0.082268022f},
-std::array<float,2>{0.755685091f, 0.7521469f},
-std::array<float,2>{0.349896848f, 0.0336440876f},
-std::array<float,2>{0.030397566f, 0.558149219f},
-std::array<float,2>{0.604061604f, 0.288214505f},
-std::array<float,2>{0.672941029f, 0.654408753f},
-std::array<float,2>{0.136379495f, 0.410138994f},
-std::array<float,2>{0.392384291f, 0.896953166f},
-std::array<float,2>{0.897591829f, 0.137339994f},
-std::array<float,2>{0.691777289f, 0.868071914f},
-std::array<float,2>{0.216215029f, 0.0998911783f},
-std::array<float,2>{0.485072285f, 0.576530457f},
-std::array<float,2>{0.984017074f, 0.315219939f},
-std::array<float,2>{0.823670506f, 0.747277081f},
-std::array<float,2>{0.293003529f, 0.478352308f},
-std::array<float,2>{0.0626666695f, 0.998280644f},
-std::array<float,2>{0.531786323f, 0.218417957f},
-std::array<float,2>{0.926706672f, 0.924101651f},
-std::array<float,2>{0.41524893f, 0.169648424f},
-std::array<float,2>{0.184316486f, 0.673968136f},
-std::array<float,2>{0.633513868f, 0.396620095f},
-std::array<float,2>{0.586014509f, 0.522951365f},
-std::array<float,2>{0.0429307967f, 0.253729433f},
-std::array<float,2>{0.328026146f, 0.781451643f},
-std::array<float,2>{0.811151743f, 0.017871568f},
-std::array<float,2>{0.527227223f, 0.764070809f},
-std::array<float,2>{0.11589735f, 0.0458544865f},
-std::array<float,2>{0.26681757f, 0.547282696f},
-std::array<float,2>{0.851601124f, 0.291262805f},
-std::array<float,2>{0.956810772f, 0.643517673f},
-std::array<float,2>{0.440735817f, 0.420719236f},
-std::array<float,2>{0.233454093f, 0.899375975f},
-std::array<float,2>{0.735429049f, 0.127001792f},
-std::array<float,2>{0.774013162f, 0.938909709f},
-std::array<float,2>{0.364915013f, 0.245441109f},
-std::array<float,2>{0.00835518911f, 0.694179773f},
-std::array<float,2>{0.616322219f, 0.446993381f},
-std::array<float,2>{0.66073215f, 0.61420244f},
-std::array<float,2>{0.14635475f, 0.349750578f},
-std::array<float,2>{0.386057466f, 0.812923908f},
-std::array<float,2>{0.875330925f, 0.0886683241f},
-std::array<float,2>{0.714709938f, 0.932042897f},
-std::array<float,2>{0.202673599f, 0.157830194f},
-std::array<float,2>{0.483912528f, 0.682957351f},
-std::array<float,2>{0.998059034f, 0.405767232f},
-std::array<float,2>{0.838024795f, 0.525562525f},
-std::array<float,2>{0.305879772f, 0.262292087f},
-std::array<float,2>{0.0781844184f, 0.793818772f},
-std::array<float,2>{0.560680926f, 0.0286790337f},
-std::array<float,2>{0.913028479f, 0.860493243f},
-std::array<float,2>{0.435353249f, 0.104395658f},
-std::array<float,2>{0.171152368f, 0.567348957f},
-std::array<float,2>{0.642565131f, 0.325107276f},
-std::array<float,2>{0.574631274f, 0.740278542f},
-std::array<float,2>{0.0496404916f, 0.470561385f},
-std::array<float,2>{0.342449725f, 0.987208426f},
-std::array<float,2>{0.783389151f, 0.209997654f},
-std::array<float,2>{0.607106328f, 0.9815799f},
-std::array<float,2>{0.026312504f, 0.19407405f},
-std::array<float,2>{0.34445703f, 0.730703294f},
-std::array<float,2>{0.75157994f, 0.491884798f},
-std::array<float,2>{0.891542852f, 0.590822339f},
-std::array<float,2>{0.397436023f, 0.330716729f},
-std::array<float,2>{0.137523443f, 0.858972728f},
-std::array<float,2>{0.677824616f, 0.111253276f},
-std::array<float,2>{0.864320278f, 0.800462663f},
-std::array<float,2>{0.262053847f, 0.00143518508f},
-std::array<float,2>{0.108898826f, 0.502398252f},
-std::array<float,2>{0.505947292f, 0.27264598f},
-std::array<float,2>{0.723231196f, 0.666101038f},
-std::array<float,2>{0.245758772f, 0.38055867f},
-std::array<float,2>{0.461545944f, 0.920896649f},
-std::array<float,2>{0.942514122f, 0.183993623f},
-std::array<float,2>{0.639678836f, 0.84062916f},
-std::array<float,2>{0.1818863f, 0.0734250173f},
-std::array<float,2>{0.419323862f, 0.594192326f},
-std::array<float,2>{0.923588157f, 0.359787226f},
-std::array<float,2>{0.8061167f, 0.71754694f},
-std::array<float,2>{0.321116626f, 0.463607609f},
-std::array<float,2>{0.0456607901f, 0.96116209f},
-std::array<float,2>{0.59161967f, 0.222332001f},
-std::array<float,2>{0.977905512f, 0.884505928f},
-std::array<float,2>{0.490997434f, 0.14922668f},
-std::array<float,2>{0.213336438f, 0.630461633f},
-std::array<float,2>{0.691213429f, 0.426510721f},
-std::array<float,2>{0.536722422f, 0.537026882f},
-std::array<float,2>{0.0668531656f, 0.297811478f},
-std::array<float,2>{0.291193008f, 0.777820468f},
-std::array<float,2>{0.826516747f, 0.0575152338f},
-std::array<float,2>{0.582562745f, 0.849649191f},
-std::array<float,2>{0.0381278507f, 0.120230787f},
-std::array<float,2>{0.314250916f, 0.585354507f},
-std::array<float,2>{0.799867392f, 0.337038308f},
-std::array<float,2>{0.933618844f, 0.719179928f},
-std::array<float,2>{0.409229606f, 0.499951959f},
-std::array<float,2>{0.172677934f, 0.971737087f},
-std::array<float,2>{0.627784133f, 0.199840456f},
-std::array<float,2>{0.812945724f, 0.907299042f},
-std::array<float,2>{0.287849605f, 0.175450727f},
-std::array<float,2>{0.0756524056f, 0.662504196f},
-std::array<float,2>{0.544833124f, 0.384547591f},
-std::array<float,2>{0.700375199f, 0.515282094f},
-std::array<float,2>{0.209554702f, 0.28037554f},
-std::array<float,2>{0.493561447f, 0.808344185f},
-std::array<float,2>{0.972115457f, 0.0117168333f},
-std::array<float,2>{0.684750915f, 0.957919836f},
-std::array<float,2>{0.132391125f, 0.229764268f},
-std::array<float,2>{0.403927654f, 0.706434369f},
-std::array<float,2>{0.904797435f, 0.454199314f},
-std::array<float,2>{0.760220885f, 0.606485128f},
-std::array<float,2>{0.355954319f, 0.370501757f},
-std::array<float,2>{0.0209615566f, 0.83342272f},
-std::array<float,2>{0.59644264f, 0.0690643936f},
-std::array<float,2>{0.951689422f, 0.771857917f},
-std::array<float,2>{0.456097245f, 0.0485748798f},
-std::array<float,2>{0.238966867f, 0.541817069f},
-std::array<float,2>{0.732863426f, 0.305521458f},
-std::array<float,2>{0.512096941f, 0.636057734f},
-std::array<float,2>{0.0956174731f, 0.434754759f},
-std::array<float,2>{0.251540303f, 0.882083416f},
-std::array<float,2>{0.874248326f, 0.140990168f},
-std::array<float,2>{0.554671288f, 0.893420637f},
-std::array<float,2>{0.0880491585f, 0.133245662f},
-std::array<float,2>{0.298777938f, 0.649154365f},
-std::array<float,2>{0.828975618f, 0.411055148f},
-std::array<float,2>{0.991356552f, 0.55924058f},
-std::array<float,2>{0.472689688f, 0.282536924f},
-std::array<float,2>{0.194527552f, 0.75779748f},
-std::array<float,2>{0.709627509f, 0.0380834155f},
-std::array<float,2>{0.793074965f, 0.820344687f},
-std::array<float,2>{0.329011142f, 0.0784421712f},
-std::array<float,2>{0.0572485216f, 0.618573666f},
-std::array<float,2>{0.563763559f, 0.353783906f},
-std::array<float,2>{0.652330458f, 0.7016536f},
-std::array<float,2>{0.160997376f, 0.441603959f},
-std::array<float,2>{0.423148841f, 0.950694084f},
-std::array<float,2>{0.915183485f, 0.241178602f},
-std::array<float,2>{0.748420417f, 0.786358595f},
-std::array<float,2>{0.221623167f, 0.0224293154f},
-std::array<float,2>{0.44558236f, 0.516903698f},
-std::array<float,2>{0.96859771f, 0.2571702f},
-std::array<float,2>{0.845646262f, 0.677262247f},
-std::array<float,2>{0.274180084f, 0.393021196f},
-std::array<float,2>{0.12332765f, 0.928906143f},
-std::array<float,2>{0.520594299f, 0.164731652f},
-std::array<float,2>{0.887095869f, 0.995724738f},
-std::array<float,2>{0.378899097f, 0.214007258f},
-std::array<float,2>{0.149257883f, 0.74449271f},
-std::array<float,2>{0.667909145f, 0.481348097f},
-std::array<float,2>{0.620028734f, 0.570390582f},
-std::array<float,2>{0.0019380739f, 0.31950438f},
-std::array<float,2>{0.369717479f, 0.874333262f},
-std::array<float,2>{0.771261096f, 0.0951453f},
-std::array<float,2>{0.509626269f, 0.866536319f},
-std::array<float,2>{0.0991275609f, 0.108448878f},
-std::array<float,2>{0.254885465f, 0.563800752f},
-std::array<float,2>{0.86732626f, 0.320643157f},
-std::array<float,2>{0.948500454f, 0.736731112f},
-std::array<float,2>{0.459116399f, 0.475486934f},
-std::array<float,2>{0.23791635f, 0.990534604f},
-std::array<float,2>{0.728542864f, 0.204941884f},
-std::array<float,2>{0.765307248f, 0.935379386f},
-std::array<float,2>{0.355195612f, 0.161874637f},
-std::array<float,2>{0.0174102224f, 0.684533834f},
-std::array<float,2>{0.601127923f, 0.400234818f},
-std::array<float,2>{0.680679262f, 0.52892071f},
-std::array<float,2>{0.12531139f, 0.261458069f},
-std::array<float,2>{0.399821043f, 0.791247249f},
-std::array<float,2>{0.901954114f, 0.0265038442f},
-std::array<float,2>{0.696314633f, 0.943276286f},
-std::array<float,2>{0.205657497f, 0.246222734f},
-std::array<float,2>{0.496650606f, 0.687657356f},
-std::array<float,2>{0.973756373f, 0.452005327f},
-std::array<float,2>{0.817421615f, 0.611051738f},
-std::array<float,2>{0.282845467f, 0.343912154f},
-std::array<float,2>{0.0738037452f, 0.819633603f},
-std::array<float,2>{0.541286826f, 0.0937265828f},
-std::array<float,2>{0.931435525f, 0.759018481f},
-std::array<float,2>{0.410531521f, 0.0427026786f},
-std::array<float,2>{0.177612633f, 0.551912963f},
-std::array<float,2>{0.630212069f, 0.29450509f},
-std::array<float,2>{0.581341386f, 0.645187557f},
-std::array<float,2>{0.0346026085f, 0.415945798f},
-std::array<float,2>{0.318059772f, 0.903382957f},
-std::array<float,2>{0.802396655f, 0.131971076f},
-std::array<float,2>{0.622823417f, 0.887670994f},
-std::array<float,2>{0.00626432244f, 0.155280069f},
-std::array<float,2>{0.371193916f, 0.625480711f},
-std::array<float,2>{0.766844273f, 0.423811764f},
-std::array<float,2>{0.884007156f, 0.532545388f},
-std::array<float,2>{0.381285906f, 0.302498221f},
-std::array<float,2>{0.152762145f, 0.776207089f},
-std::array<float,2>{0.668046594f, 0.0618490539f},
-std::array<float,2>{0.8477543f, 0.839279056f},
-std::array<float,2>{0.279815674f, 0.0754454285f},
-std::array<float,2>{0.120778553f, 0.598077118f},
-std::array<float,2>{0.519390821f, 0.365714073f},
-std::array<float,2>{0.744486749f, 0.713254035f},
-std::array<float,2>{0.224277467f, 0.467071146f},
-std::array<float,2>{0.450800985f, 0.966284215f},
-std::array<float,2>{0.962822437f, 0.226022378f},
-std::array<float,2>{0.655100703f, 0.801671684f},
-std::array<float,2>{0.159979388f, 0.00629270636f},
-std::array<float,2>{0.426884204f, 0.504378855f},
-std::array<float,2>{0.920531154f, 0.268618733f},
-std::array<float,2>{0.791979671f, 0.669706702f},
-std::array<float,2>{0.335723221f, 0.377341092f},
-std::array<float,2>{0.0609744899f, 0.914093852f},
-std::array<float,2>{0.566494703f, 0.182960123f},
-std::array<float,2>{0.986320078f, 0.979637265f},
-std::array<float,2>{0.469242781f, 0.188780934f},
-std::array<float,2>{0.187654585f, 0.729276597f},
-std::array<float,2>{0.703671515f, 0.485070705f},
-std::array<float,2>{0.549079418f, 0.589618623f},
-std::array<float,2>{0.0915868953f, 0.335161924f},
-std::array<float,2>{0.301027328f, 0.851814806f},
-std::array<float,2>{0.835240424f, 0.11500252f},
-std::array<float,2>{0.573804557f, 0.768601775f},
-std::array<float,2>{0.0524144582f, 0.0508001968f},
-std::array<float,2>{0.338720143f, 0.544341743f},
-std::array<float,2>{0.786092877f, 0.310210019f},
-std::array<float,2>{0.908148766f, 0.639772654f},
-std::array<float,2>{0.431757987f, 0.433160812f},
-std::array<float,2>{0.165689141f, 0.87533766f},
-std::array<float,2>{0.646527469f, 0.145480841f},
-std::array<float,2>{0.839918613f, 0.955656946f},
-std::array<float,2>{0.311490864f, 0.231954589f},
-std::array<float,2>{0.0845239833f, 0.710903406f},
-std::array<float,2>{0.55763346f, 0.45916903f},
-std::array<float,2>{0.717277586f, 0.605115056f},
-std::array<float,2>{0.196153656f, 0.371295661f},
-std::array<float,2>{0.478501976f, 0.831390202f},
-std::array<float,2>{0.994472265f, 0.0658386201f},
-std::array<float,2>{0.658738732f, 0.911470115f},
-std::array<float,2>{0.14229764f, 0.178595901f},
-std::array<float,2>{0.389902741f, 0.658219278f},
-std::array<float,2>{0.880143642f, 0.387761682f},
-std::array<float,2>{0.779917359f, 0.510344267f},
-std::array<float,2>{0.359720349f, 0.277339876f},
-std::array<float,2>{0.015172746f, 0.810183287f},
-std::array<float,2>{0.611834049f, 0.0117389131f},
-std::array<float,2>{0.960090935f, 0.844013095f},
-std::array<float,2>{0.443883032f, 0.122335799f},
-std::array<float,2>{0.229236335f, 0.580297351f},
-std::array<float,2>{0.741209984f, 0.342590332f},
-std::array<float,2>{0.529854119f, 0.726386666f},
-std::array<float,2>{0.111128703f, 0.494726151f},
-std::array<float,2>{0.270241261f, 0.972971737f},
-std::array<float,2>{0.858106315f, 0.197814927f},
-std::array<float,2>{0.53455776f, 0.997404397f},
-std::array<float,2>{0.0660240278f, 0.216475889f},
-std::array<float,2>{0.295396119f, 0.748552799f},
-std::array<float,2>{0.82165122f, 0.47902146f},
-std::array<float,2>{0.980943382f, 0.575900972f},
-std::array<float,2>{0.48775056f, 0.313651085f},
-std::array<float,2>{0.217222422f, 0.870099723f},
-std::array<float,2>{0.693405271f, 0.0981533825f},
-std::array<float,2>{0.808841109f, 0.784600794f},
-std::array<float,2>{0.325131625f, 0.0168807656f},
-std::array<float,2>{0.0394206829f, 0.519860804f},
-std::array<float,2>{0.58884716f, 0.250530511f},
-std::array<float,2>{0.636359513f, 0.673538923f},
-std::array<float,2>{0.186931655f, 0.395042807f},
-std::array<float,2>{0.416641206f, 0.922910571f},
-std::array<float,2>{0.929013431f, 0.170826957f},
-std::array<float,2>{0.72060895f, 0.827189565f},
-std::array<float,2>{0.248754933f, 0.0847962424f},
-std::array<float,2>{0.465729445f, 0.621821463f},
-std::array<float,2>{0.938575208f, 0.355917901f},
-std::array<float,2>{0.862486422f, 0.695806146f},
-std::array<float,2>{0.259107143f, 0.437834203f},
-std::array<float,2>{0.103983842f, 0.945796788f},
-std::array<float,2>{0.503827393f, 0.235655338f},
-std::array<float,2>{0.895669043f, 0.896092951f},
-std::array<float,2>{0.393526822f, 0.140517592f},
-std::array<float,2>{0.134031519f, 0.652561724f},
-std::array<float,2>{0.675618351f, 0.40708831f},
-std::array<float,2>{0.60333097f, 0.556239665f},
-std::array<float,2>{0.029193975f, 0.285435885f},
-std::array<float,2>{0.348503888f, 0.750358999f},
-std::array<float,2>{0.757425189f, 0.0318619534f},
-std::array<float,2>{0.558716595f, 0.796327412f},
-std::array<float,2>{0.0817527696f, 0.02967765f},
-std::array<float,2>{0.306812674f, 0.525062382f},
-std::array<float,2>{0.837463439f, 0.264306188f},
-std::array<float,2>{0.997146189f, 0.681375802f},
-std::array<float,2>{0.482135504f, 0.40316537f},
-std::array<float,2>{0.200101063f, 0.931253791f},
-std::array<float,2>{0.712848604f, 0.158248141f},
-std::array<float,2>{0.781421006f, 0.98472476f},
-std::array<float,2>{0.340440392f, 0.207645431f},
-std::array<float,2>{0.0469224267f, 0.739193976f},
-std::array<float,2>{0.576804638f, 0.471900076f},
-std::array<float,2>{0.644415438f, 0.569413543f},
-std::array<float,2>{0.168417051f, 0.326952279f},
-std::array<float,2>{0.435551703f, 0.861624777f},
-std::array<float,2>{0.910985768f, 0.103275277f},
-std::array<float,2>{0.737339616f, 0.900501072f},
-std::array<float,2>{0.232334062f, 0.125629306f},
-std::array<float,2>{0.439053059f, 0.642434955f},
-std::array<float,2>{0.954640865f, 0.418636322f},
-std::array<float,2>{0.854834914f, 0.548841715f},
-std::array<float,2>{0.268883169f, 0.290489763f},
-std::array<float,2>{0.11384178f, 0.763070226f},
-std::array<float,2>{0.524095774f, 0.044533208f},
-std::array<float,2>{0.878170013f, 0.816325665f},
-std::array<float,2>{0.383257866f, 0.08609505f},
-std::array<float,2>{0.147692174f, 0.616329253f},
-std::array<float,2>{0.663976729f, 0.348728359f},
-std::array<float,2>{0.615042746f, 0.692816556f},
-std::array<float,2>{0.010263551f, 0.449197769f},
-std::array<float,2>{0.365588516f, 0.941354752f},
-std::array<float,2>{0.775453925f, 0.242310047f},
-std::array<float,2>{0.592835367f, 0.963348687f},
-std::array<float,2>{0.044222068f, 0.220452189f},
-std::array<float,2>{0.322274178f, 0.715103388f},
-std::array<float,2>{0.807366014f, 0.462868661f},
-std::array<float,2>{0.924082577f, 0.597376823f},
-std::array<float,2>{0.420084327f, 0.361468971f},
-std::array<float,2>{0.181232452f, 0.842113435f},
-std::array<float,2>{0.637975037f, 0.0705858395f},
-std::array<float,2>{0.824701548f, 0.781067789f},
-std::array<float,2>{0.290771186f, 0.0554300323f},
-std::array<float,2>{0.0683681741f, 0.537867188f},
-std::array<float,2>{0.538610458f, 0.299204886f},
-std::array<float,2>{0.689097464f, 0.630951345f},
-std::array<float,2>{0.211639896f, 0.429251164f},
-std::array<float,2>{0.488439679f, 0.886445582f},
-std::array<float,2>{0.978986442f, 0.151138335f},
-std::array<float,2>{0.676945508f, 0.855962336f},
-std::array<float,2>{0.139507577f, 0.1129428f},
-std::array<float,2>{0.396467119f, 0.591856003f},
-std::array<float,2>{0.893453121f, 0.329282165f},
-std::array<float,2>{0.752914846f, 0.733513176f},
-std::array<float,2>{0.346718967f, 0.490011305f},
-std::array<float,2>{0.0237135123f, 0.982732594f},
-std::array<float,2>{0.608236969f, 0.19299382f},
-std::array<float,2>{0.944580972f, 0.919034123f},
-std::array<float,2>{0.463640183f, 0.187001735f},
-std::array<float,2>{0.242609501f, 0.664991438f},
-std::array<float,2>{0.725444376f, 0.382642686f},
-std::array<float,2>{0.504603624f, 0.501090527f},
-std::array<float,2>{0.106557213f, 0.269969612f},
-std::array<float,2>{0.265544504f, 0.797925532f},
-std::array<float,2>{0.866510928f, 0.00230358401f},
-std::array<float,2>{0.595378399f, 0.834853768f},
-std::array<float,2>{0.0230538733f, 0.0676160827f},
-std::array<float,2>{0.35886997f, 0.608264625f},
-std::array<float,2>{0.758526981f, 0.369030535f},
-std::array<float,2>{0.904256701f, 0.703567445f},
-std::array<float,2>{0.404791236f, 0.456541657f},
-std::array<float,2>{0.129922226f, 0.96067822f},
-std::array<float,2>{0.686990678f, 0.22691229f},
-std::array<float,2>{0.871841848f, 0.879571199f},
-std::array<float,2>{0.253361255f, 0.143687502f},
-std::array<float,2>{0.0972450227f, 0.633636475f},
-std::array<float,2>{0.514635801f, 0.436105192f},
-std::array<float,2>{0.730713129f, 0.539429724f},
-std::array<float,2>{0.240442738f, 0.307538182f},
-std::array<float,2>{0.454996407f, 0.770537257f},
-std::array<float,2>{0.950668693f, 0.0494774319f},
-std::array<float,2>{0.625274956f, 0.969076991f},
-std::array<float,2>{0.17497085f, 0.20269452f},
-std::array<float,2>{0.407242298f, 0.720747113f},
-std::array<float,2>{0.936995268f, 0.496513367f},
-std::array<float,2>{0.797461152f, 0.582369745f},
-std::array<float,2>{0.315894783f, 0.338697404f},
-std::array<float,2>{0.0358722098f, 0.849563122f},
-std::array<float,2>{0.584265232f, 0.118676238f},
-std::array<float,2>{0.969834924f, 0.805194139f},
-std::array<float,2>{0.495105803f, 0.00848421827f},
-std::array<float,2>{0.208916217f, 0.512806356f},
-std::array<float,2>{0.701844573f, 0.27735284f},
-std::array<float,2>{0.545133054f, 0.660383701f},
-std::array<float,2>{0.0778726563f, 0.384943426f},
-std::array<float,2>{0.286366105f, 0.909670115f},
-std::array<float,2>{0.8152107f, 0.173301101f},
-std::array<float,2>{0.522457361f, 0.927173913f},
-std::array<float,2>{0.121852338f, 0.167243212f},
-std::array<float,2>{0.275780886f, 0.679406941f},
-std::array<float,2>{0.845875561f, 0.391217589f},
-std::array<float,2>{0.965097666f, 0.518505096f},
-std::array<float,2>{0.447989643f, 0.254237413f},
-std::array<float,2>{0.219769746f, 0.787275553f},
-std::array<float,2>{0.746943772f, 0.0203439593f},
-std::array<float,2>{0.771682084f, 0.872805297f},
-std::array<float,2>{0.367274016f, 0.0966888517f},
-std::array<float,2>{0.00320780789f, 0.573577583f},
-std::array<float,2>{0.617933095f, 0.316609949f},
-std::array<float,2>{0.665951014f, 0.743135333f},
-std::array<float,2>{0.151047647f, 0.483215362f},
-std::array<float,2>{0.376217037f, 0.992603838f},
-std::array<float,2>{0.888902247f, 0.211574182f},
-std::array<float,2>{0.708477437f, 0.754414439f},
-std::array<float,2>{0.192724854f, 0.0358623825f},
-std::array<float,2>{0.476362407f, 0.561994433f},
-std::array<float,2>{0.988783836f, 0.283495426f},
-std::array<float,2>{0.830776572f, 0.651596248f},
-std::array<float,2>{0.299469352f, 0.413358361f},
-std::array<float,2>{0.0872713998f, 0.891224921f},
-std::array<float,2>{0.5525195f, 0.135466844f},
-std::array<float,2>{0.916906178f, 0.951281071f},
-std::array<float,2>{0.425254762f, 0.238772213f},
-std::array<float,2>{0.163400903f, 0.700027049f},
-std::array<float,2>{0.649752676f, 0.443925291f},
-std::array<float,2>{0.565336704f, 0.619260073f},
-std::array<float,2>{0.0553133413f, 0.353100777f},
-std::array<float,2>{0.331247807f, 0.823122799f},
-std::array<float,2>{0.796568334f, 0.0805297345f},
-std::array<float,2>{0.525370538f, 0.812701166f},
-std::array<float,2>{0.114408657f, 0.0884922519f},
-std::array<float,2>{0.26820311f, 0.613876283f},
-std::array<float,2>{0.853778243f, 0.349862069f},
-std::array<float,2>{0.953434646f, 0.693954289f},
-std::array<float,2>{0.437892288f, 0.447263122f},
-std::array<float,2>{0.231324643f, 0.938574314f},
-std::array<float,2>{0.737241983f, 0.245334461f},
-std::array<float,2>{0.776781619f, 0.899021804f},
-std::array<float,2>{0.366286904f, 0.127383932f},
-std::array<float,2>{0.0108294468f, 0.643094182f},
-std::array<float,2>{0.613973677f, 0.420646727f},
-std::array<float,2>{0.662179232f, 0.546983778f},
-std::array<float,2>{0.146617636f, 0.29124245f},
-std::array<float,2>{0.384070516f, 0.763896286f},
-std::array<float,2>{0.877191544f, 0.0455885492f},
-std::array<float,2>{0.71169126f, 0.987054825f},
-std::array<float,2>{0.201047748f, 0.210318834f},
-std::array<float,2>{0.481140733f, 0.740684092f},
-std::array<float,2>{0.996547103f, 0.470242232f},
-std::array<float,2>{0.836102903f, 0.567079127f},
-std::array<float,2>{0.308419168f, 0.324786663f},
-std::array<float,2>{0.0801238567f, 0.860674739f},
-std::array<float,2>{0.559782326f, 0.104134604f},
-std::array<float,2>{0.911553204f, 0.793535471f},
-std::array<float,2>{0.43700853f, 0.0283264872f},
-std::array<float,2>{0.169355169f, 0.525648594f},
-std::array<float,2>{0.642969549f, 0.262607008f},
-std::array<float,2>{0.577149391f, 0.682668209f},
-std::array<float,2>{0.0486404821f, 0.406120688f},
-std::array<float,2>{0.341059357f, 0.931868851f},
-std::array<float,2>{0.782988966f, 0.158075124f},
-std::array<float,2>{0.608620226f, 0.920512676f},
-std::array<float,2>{0.0252245162f, 0.183626562f},
-std::array<float,2>{0.345778108f, 0.666351378f},
-std::array<float,2>{0.753801584f, 0.38068378f},
-std::array<float,2>{0.893792927f, 0.502130926f},
-std::array<float,2>{0.395393938f, 0.272897035f},
-std::array<float,2>{0.140110344f, 0.800778925f},
-std::array<float,2>{0.676210105f, 0.00106064021f},
-std::array<float,2>{0.865729868f, 0.85921061f},
-std::array<float,2>{0.264094442f, 0.111083008f},
-std::array<float,2>{0.105712019f, 0.59113121f},
-std::array<float,2>{0.505292773f, 0.330880076f},
-std::array<float,2>{0.725966454f, 0.730872929f},
-std::array<float,2>{0.243566811f, 0.492186815f},
-std::array<float,2>{0.46439451f, 0.981755078f},
-std::array<float,2>{0.943655372f, 0.194323495f},
-std::array<float,2>{0.637227356f, 0.777359962f},
-std::array<float,2>{0.180040449f, 0.0572424904f},
-std::array<float,2>{0.421702683f, 0.536705792f},
-std::array<float,2>{0.925666153f, 0.297526807f},
-std::array<float,2>{0.807780147f, 0.630661011f},
-std::array<float,2>{0.323829859f, 0.426737845f},
-std::array<float,2>{0.043401666f, 0.884651303f},
-std::array<float,2>{0.592499793f, 0.148993269f},
-std::array<float,2>{0.979995549f, 0.961324215f},
-std::array<float,2>{0.489628822f, 0.222496003f},
-std::array<float,2>{0.211959079f, 0.717388332f},
-std::array<float,2>{0.687719226f, 0.463740498f},
-std::array<float,2>{0.53767401f, 0.593968391f},
-std::array<float,2>{0.0693880245f, 0.359524846f},
-std::array<float,2>{0.28946057f, 0.840499878f},
-std::array<float,2>{0.825407028f, 0.0735026225f},
-std::array<float,2>{0.585855603f, 0.808540344f},
-std::array<float,2>{0.0368498825f, 0.011385316f},
-std::array<float,2>{0.31531623f, 0.515511692f},
-std::array<float,2>{0.79824096f, 0.280760258f},
-std::array<float,2>{0.936457932f, 0.662300527f},
-std::array<float,2>{0.406839937f, 0.384451032f},
-std::array<float,2>{0.174496517f, 0.907582045f},
-std::array<float,2>{0.626661479f, 0.175575182f},
-std::array<float,2>{0.81565994f, 0.972028613f},
-std::array<float,2>{0.285852015f, 0.200057834f},
-std::array<float,2>{0.0768350139f, 0.718946099f},
-std::array<float,2>{0.546793699f, 0.499673277f},
-std::array<float,2>{0.703030825f, 0.585060179f},
-std::array<float,2>{0.207892269f, 0.337253153f},
-std::array<float,2>{0.495577693f, 0.850002408f},
-std::array<float,2>{0.969268262f, 0.120459951f},
-std::array<float,2>{0.685574114f, 0.882000625f},
-std::array<float,2>{0.128987864f, 0.140853345f},
-std::array<float,2>{0.405823946f, 0.63583529f},
-std::array<float,2>{0.902681828f, 0.434888989f},
-std::array<float,2>{0.759725034f, 0.541703761f},
-std::array<float,2>{0.357531399f, 0.305399477f},
-std::array<float,2>{0.0219197068f, 0.771687388f},
-std::array<float,2>{0.59466356f, 0.0487588011f},
-std::array<float,2>{0.94960171f, 0.833100796f},
-std::array<float,2>{0.453495622f, 0.069255352f},
-std::array<float,2>{0.24191311f, 0.606799483f},
-std::array<float,2>{0.731811047f, 0.370328128f},
-std::array<float,2>{0.515221715f, 0.706105113f},
-std::array<float,2>{0.0961356461f, 0.454588741f},
-std::array<float,2>{0.25260514f, 0.957621217f},
-std::array<float,2>{0.8720842f, 0.229714781f},
-std::array<float,2>{0.551134288f, 0.950957954f},
-std::array<float,2>{0.086588867f, 0.240775242f},
-std::array<float,2>{0.300752491f, 0.701230705f},
-std::array<float,2>{0.831770718f, 0.441878021f},
-std::array<float,2>{0.989441156f, 0.618247509f},
-std::array<float,2>{0.474650353f, 0.353529781f},
-std::array<float,2>{0.191763014f, 0.820777655f},
-std::array<float,2>{0.707563519f, 0.0781272203f},
-std::array<float,2>{0.795607269f, 0.757350028f},
-std::array<float,2>{0.330239296f, 0.0377647243f},
-std::array<float,2>{0.0562689267f, 0.559353948f},
-std::array<float,2>{0.565478146f, 0.282411486f},
-std::array<float,2>{0.649290204f, 0.649281204f},
-std::array<float,2>{0.16231446f, 0.410815597f},
-std::array<float,2>{0.424081653f, 0.893299401f},
-std::array<float,2>{0.917854071f, 0.132928088f},
-std::array<float,2>{0.74771136f, 0.87411803f},
-std::array<float,2>{0.219726235f, 0.0949486271f},
-std::array<float,2>{0.448389918f, 0.570593536f},
-std::array<float,2>{0.966565073f, 0.319646299f},
-std::array<float,2>{0.847509205f, 0.744200647f},
-std::array<float,2>{0.277094752f, 0.481187731f},
-std::array<float,2>{0.122668408f, 0.995934546f},
-std::array<float,2>{0.52309829f, 0.214320347f},
-std::array<float,2>{0.890276372f, 0.929163098f},
-std::array<float,2>{0.375317514f, 0.164908439f},
-std::array<float,2>{0.15209201f, 0.677623868f},
-std::array<float,2>{0.66421032f, 0.392707974f},
-std::array<float,2>{0.618894875f, 0.516819894f},
-std::array<float,2>{0.00259845797f, 0.256867409f},
-std::array<float,2>{0.368806779f, 0.786541939f},
-std::array<float,2>{0.772612572f, 0.0221112147f},
-std::array<float,2>{0.542174876f, 0.760104299f},
-std::array<float,2>{0.072407797f, 0.0408590771f},
-std::array<float,2>{0.281890363f, 0.552851975f},
-std::array<float,2>{0.816921175f, 0.295214862f},
-std::array<float,2>{0.973186731f, 0.64746809f},
-std::array<float,2>{0.497313023f, 0.417409807f},
-std::array<float,2>{0.206275269f, 0.90441823f},
-std::array<float,2>{0.695811152f, 0.130830392f},
-std::array<float,2>{0.800899982f, 0.944046915f},
-std::array<float,2>{0.316860974f, 0.249932617f},
-std::array<float,2>{0.0335739963f, 0.689748883f},
-std::array<float,2>{0.580370426f, 0.451145858f},
-std::array<float,2>{0.629353106f, 0.611761689f},
-std::array<float,2>{0.175924212f, 0.346392155f},
-std::array<float,2>{0.41139701f, 0.816930771f},
-std::array<float,2>{0.92983067f, 0.0909636691f},
-std::array<float,2>{0.729680717f, 0.937192142f},
-std::array<float,2>{0.237291008f, 0.163102925f},
-std::array<float,2>{0.460020155f, 0.686545551f},
-std::array<float,2>{0.9476524f, 0.401729047f},
-std::array<float,2>{0.868741453f, 0.529519737f},
-std::array<float,2>{0.254571795f, 0.258393377f},
-std::array<float,2>{0.0978959054f, 0.790288687f},
-std::array<float,2>{0.508288682f, 0.0248016603f},
-std::array<float,2>{0.900520742f, 0.863435864f},
-std::array<float,2>{0.399175197f, 0.106946491f},
-std::array<float,2>{0.126274943f, 0.56584698f},
-std::array<float,2>{0.680001199f, 0.323100358f},
-std::array<float,2>{0.599724293f, 0.736186862f},
-std::array<float,2>{0.0157089643f, 0.472721159f},
-std::array<float,2>{0.354393899f, 0.988864362f},
-std::array<float,2>{0.763739109f, 0.206091672f},
-std::array<float,2>{0.568020105f, 0.976661205f},
-std::array<float,2>{0.0624711365f, 0.190951511f},
-std::array<float,2>{0.334429055f, 0.727406025f},
-std::array<float,2>{0.792321444f, 0.486895859f},
-std::array<float,2>{0.921824455f, 0.587670922f},
-std::array<float,2>{0.426364243f, 0.332300216f},
-std::array<float,2>{0.158335865f, 0.853953004f},
-std::array<float,2>{0.656077743f, 0.115667529f},
-std::array<float,2>{0.834059238f, 0.802810431f},
-std::array<float,2>{0.302159995f, 0.00395412464f},
-std::array<float,2>{0.0900791287f, 0.507677615f},
-std::array<float,2>{0.550110459f, 0.265664637f},
-std::array<float,2>{0.704656422f, 0.671589136f},
-std::array<float,2>{0.18892172f, 0.37602219f},
-std::array<float,2>{0.470454574f, 0.916136563f},
-std::array<float,2>{0.984486759f, 0.179965734f},
-std::array<float,2>{0.669169724f, 0.836456478f},
-std::array<float,2>{0.153476149f, 0.0778874606f},
-std::array<float,2>{0.382300645f, 0.600602567f},
-std::array<float,2>{0.882913351f, 0.364798278f},
-std::array<float,2>{0.766257048f, 0.71182096f},
-std::array<float,2>{0.372136772f, 0.46612969f},
-std::array<float,2>{0.00755208777f, 0.967017293f},
-std::array<float,2>{0.622019529f, 0.222956285f},
-std::array<float,2>{0.96177727f, 0.889596462f},
-std::array<float,2>{0.44934845f, 0.152886033f},
-std::array<float,2>{0.222762689f, 0.62725991f},
-std::array<float,2>{0.745618463f, 0.42559427f},
-std::array<float,2>{0.518153012f, 0.533220112f},
-std::array<float,2>{0.119166471f, 0.304189444f},
-std::array<float,2>{0.280595928f, 0.774578929f},
-std::array<float,2>{0.848912179f, 0.0588308349f},
-std::array<float,2>{0.612649381f, 0.846769631f},
-std::array<float,2>{0.0138444901f, 0.123136677f},
-std::array<float,2>{0.36046192f, 0.579903543f},
-std::array<float,2>{0.780893445f, 0.339999765f},
-std::array<float,2>{0.879385233f, 0.723070323f},
-std::array<float,2>{0.389452875f, 0.492650837f},
-std::array<float,2>{0.141279131f, 0.975928009f},
-std::array<float,2>{0.659386277f, 0.195417717f},
-std::array<float,2>{0.858636677f, 0.912214458f},
-std::array<float,2>{0.271073431f, 0.176495254f},
-std::array<float,2>{0.109987572f, 0.657651365f},
-std::array<float,2>{0.530752599f, 0.389792383f},
-std::array<float,2>{0.741839111f, 0.508867979f},
-std::array<float,2>{0.23028101f, 0.273714751f},
-std::array<float,2>{0.44447878f, 0.811808884f},
-std::array<float,2>{0.95955503f, 0.0141013581f},
-std::array<float,2>{0.647947609f, 0.95387727f},
-std::array<float,2>{0.165031359f, 0.234138146f},
-std::array<float,2>{0.432784766f, 0.707629919f},
-std::array<float,2>{0.906764388f, 0.457714021f},
-std::array<float,2>{0.786608815f, 0.603302538f},
-std::array<float,2>{0.339067876f, 0.373293996f},
-std::array<float,2>{0.051703386f, 0.829365492f},
-std::array<float,2>{0.572914481f, 0.062877588f},
-std::array<float,2>{0.995135844f, 0.765920341f},
-std::array<float,2>{0.476936847f, 0.0544799902f},
-std::array<float,2>{0.196714237f, 0.545149565f},
-std::array<float,2>{0.718403161f, 0.311807752f},
-std::array<float,2>{0.556959808f, 0.637192249f},
-std::array<float,2>{0.0849930644f, 0.431276679f},
-std::array<float,2>{0.312176794f, 0.878024697f},
-std::array<float,2>{0.84095192f, 0.147786856f},
-std::array<float,2>{0.50271666f, 0.896672904f},
-std::array<float,2>{0.10449826f, 0.137692019f},
-std::array<float,2>{0.258080602f, 0.654602289f},
-std::array<float,2>{0.862250626f, 0.409846872f},
-std::array<float,2>{0.937785685f, 0.558373988f},
-std::array<float,2>{0.465872943f, 0.28849864f},
-std::array<float,2>{0.249682695f, 0.752345204f},
-std::array<float,2>{0.719304144f, 0.0332883745f},
-std::array<float,2>{0.756808102f, 0.825240433f},
-std::array<float,2>{0.349313229f, 0.0823801085f},
-std::array<float,2>{0.0274439156f, 0.624997199f},
-std::array<float,2>{0.601972163f, 0.358223677f},
-std::array<float,2>{0.674218535f, 0.697267413f},
-std::array<float,2>{0.133679956f, 0.441264093f},
-std::array<float,2>{0.394479901f, 0.949149072f},
-std::array<float,2>{0.894889057f, 0.236637861f},
-std::array<float,2>{0.695063114f, 0.781562746f},
-std::array<float,2>{0.218583032f, 0.0176726356f},
-std::array<float,2>{0.487054646f, 0.523370147f},
-std::array<float,2>{0.981613517f, 0.253422469f},
-std::array<float,2>{0.820694447f, 0.674076378f},
-std::array<float,2>{0.296753705f, 0.396859646f},
-std::array<float,2>{0.0647229329f, 0.923950613f},
-std::array<float,2>{0.533879519f, 0.169713467f},
-std::array<float,2>{0.928122044f, 0.998484612f},
-std::array<float,2>{0.417689264f, 0.218577117f},
-std::array<float,2>{0.186380967f, 0.747531116f},
-std::array<float,2>{0.635349154f, 0.478256464f},
-std::array<float,2>{0.58952719f, 0.576349676f},
-std::array<float,2>{0.0404703803f, 0.314944506f},
-std::array<float,2>{0.32611531f, 0.867714286f},
-std::array<float,2>{0.810535252f, 0.09976013f},
-std::array<float,2>{0.561991334f, 0.861410201f},
-std::array<float,2>{0.0799664482f, 0.103059098f},
-std::array<float,2>{0.304766089f, 0.569745362f},
-std::array<float,2>{0.839049518f, 0.326684624f},
-std::array<float,2>{0.999340773f, 0.738951027f},
-std::array<float,2>{0.483082771f, 0.472028971f},
-std::array<float,2>{0.201176152f, 0.984498799f},
-std::array<float,2>{0.713198423f, 0.207966164f},
-std::array<float,2>{0.785088956f, 0.931549668f},
-std::array<float,2>{0.343106687f, 0.158546969f},
-std::array<float,2>{0.050543122f, 0.68156898f},
-std::array<float,2>{0.575200617f, 0.402897149f},
-std::array<float,2>{0.641514301f, 0.525347292f},
-std::array<float,2>{0.17060332f, 0.264416516f},
-std::array<float,2>{0.434398115f, 0.795950413f},
-std::array<float,2>{0.913627088f, 0.029327957f},
-std::array<float,2>{0.734399259f, 0.941161454f},
-std::array<float,2>{0.232471868f, 0.24262467f},
-std::array<float,2>{0.440070093f, 0.692507744f},
-std::array<float,2>{0.955669224f, 0.448764592f},
-std::array<float,2>{0.852665722f, 0.616583407f},
-std::array<float,2>{0.266147137f, 0.349051356f},
-std::array<float,2>{0.116561696f, 0.816032887f},
-std::array<float,2>{0.525676489f, 0.0862192214f},
-std::array<float,2>{0.876824319f, 0.762800276f},
-std::array<float,2>{0.38503173f, 0.044778537f},
-std::array<float,2>{0.145451888f, 0.549114645f},
-std::array<float,2>{0.661419213f, 0.29006952f},
-std::array<float,2>{0.615972757f, 0.642106652f},
-std::array<float,2>{0.00953394081f, 0.418862581f},
-std::array<float,2>{0.363831669f, 0.900811493f},
-std::array<float,2>{0.775157988f, 0.125764295f},
-std::array<float,2>{0.590207398f, 0.886636078f},
-std::array<float,2>{0.0465178117f, 0.150987312f},
-std::array<float,2>{0.321871817f, 0.631263435f},
-std::array<float,2>{0.805263102f, 0.429495871f},
-std::array<float,2>{0.922675908f, 0.537703037f},
-std::array<float,2>{0.418648005f, 0.298903078f},
-std::array<float,2>{0.182718724f, 0.780850112f},
-std::array<float,2>{0.639555454f, 0.0553125441f},
-std::array<float,2>{0.827286839f, 0.841822386f},
-std::array<float,2>{0.292493343f, 0.0705087334f},
-std::array<float,2>{0.0677713677f, 0.5974195f},
-std::array<float,2>{0.535721064f, 0.361796319f},
-std::array<float,2>{0.689764678f, 0.714893579f},
-std::array<float,2>{0.214840129f, 0.462586462f},
-std::array<float,2>{0.491931915f, 0.962993562f},
-std::array<float,2>{0.977054119f, 0.220534459f},
-std::array<float,2>{0.678917944f, 0.798247755f},
-std::array<float,2>{0.138107479f, 0.00197760039f},
-std::array<float,2>{0.397578448f, 0.501364887f},
-std::array<float,2>{0.892139077f, 0.269702405f},
-std::array<float,2>{0.750285208f, 0.664606571f},
-std::array<float,2>{0.344970763f, 0.382332414f},
-std::array<float,2>{0.026456099f, 0.919241846f},
-std::array<float,2>{0.60594213f, 0.186767235f},
-std::array<float,2>{0.942193151f, 0.982606649f},
-std::array<float,2>{0.462514281f, 0.193253741f},
-std::array<float,2>{0.244724199f, 0.733876646f},
-std::array<float,2>{0.723653376f, 0.489955455f},
-std::array<float,2>{0.507476151f, 0.592276931f},
-std::array<float,2>{0.107424453f, 0.329473972f},
-std::array<float,2>{0.263117373f, 0.856307805f},
-std::array<float,2>{0.864224255f, 0.11308834f},
-std::array<float,2>{0.5969733f, 0.770767033f},
-std::array<float,2>{0.020387549f, 0.0497565195f},
-std::array<float,2>{0.356501192f, 0.539171934f},
-std::array<float,2>{0.761594296f, 0.307170033f},
-std::array<float,2>{0.906116605f, 0.633361578f},
-std::array<float,2>{0.402421594f, 0.436355233f},
-std::array<float,2>{0.131172806f, 0.879676819f},
-std::array<float,2>{0.683961451f, 0.14383924f},
-std::array<float,2>{0.873338521f, 0.960798204f},
-std::array<float,2>{0.250673771f, 0.22674194f},
-std::array<float,2>{0.0939068645f, 0.703277111f},
-std::array<float,2>{0.513411283f, 0.456198484f},
-std::array<float,2>{0.733443141f, 0.607950568f},
-std::array<float,2>{0.239935115f, 0.368674934f},
-std::array<float,2>{0.455275685f, 0.834545255f},
-std::array<float,2>{0.952810347f, 0.0677276552f},
-std::array<float,2>{0.628483772f, 0.909998775f},
-std::array<float,2>{0.173649594f, 0.172861278f},
-std::array<float,2>{0.408213317f, 0.66057843f},
-std::array<float,2>{0.935187638f, 0.385226697f},
-std::array<float,2>{0.799346149f, 0.513011515f},
-std::array<float,2>{0.312635422f, 0.277758956f},
-std::array<float,2>{0.0377737917f, 0.805520236f},
-std::array<float,2>{0.583794594f, 0.00857228041f},
-std::array<float,2>{0.971398294f, 0.849126697f},
-std::array<float,2>{0.492718756f, 0.11890398f},
-std::array<float,2>{0.210563913f, 0.582145691f},
-std::array<float,2>{0.699892521f, 0.338416159f},
-std::array<float,2>{0.543854654f, 0.721088529f},
-std::array<float,2>{0.0749499276f, 0.496270895f},
-std::array<float,2>{0.288963497f, 0.968768775f},
-std::array<float,2>{0.813822329f, 0.20295237f},
-std::array<float,2>{0.520387769f, 0.992188752f},
-std::array<float,2>{0.124397539f, 0.211880401f},
-std::array<float,2>{0.275043577f, 0.742783785f},
-std::array<float,2>{0.843910336f, 0.48299998f},
-std::array<float,2>{0.967587709f, 0.573287904f},
-std::array<float,2>{0.446698576f, 0.316866249f},
-std::array<float,2>{0.222423583f, 0.872783363f},
-std::array<float,2>{0.749095976f, 0.0970592871f},
-std::array<float,2>{0.770351708f, 0.787583053f},
-std::array<float,2>{0.37054199f, 0.0200765468f},
-std::array<float,2>{0.000472498883f, 0.518178105f},
-std::array<float,2>{0.62108016f, 0.254128367f},
-std::array<float,2>{0.666526437f, 0.67960155f},
-std::array<float,2>{0.149840996f, 0.391562343f},
-std::array<float,2>{0.377453297f, 0.926879108f},
-std::array<float,2>{0.88863796f, 0.167184174f},
-std::array<float,2>{0.71012038f, 0.822771072f},
-std::array<float,2>{0.194278121f, 0.0801409334f},
-std::array<float,2>{0.47374776f, 0.619569004f},
-std::array<float,2>{0.990697026f, 0.353377998f},
-std::array<float,2>{0.829323113f, 0.699737966f},
-std::array<float,2>{0.297583371f, 0.444134265f},
-std::array<float,2>{0.0889491439f, 0.951624036f},
-std::array<float,2>{0.553215027f, 0.239128605f},
-std::array<float,2>{0.914561212f, 0.891519547f},
-std::array<float,2>{0.421945691f, 0.13568458f},
-std::array<float,2>{0.161578387f, 0.651853859f},
-std::array<float,2>{0.651269257f, 0.413140327f},
-std::array<float,2>{0.563376546f, 0.561553001f},
-std::array<float,2>{0.0578769147f, 0.283276647f},
-std::array<float,2>{0.329390168f, 0.754830956f},
-std::array<float,2>{0.794519484f, 0.0360935628f},
-std::array<float,2>{0.510457695f, 0.791445613f},
-std::array<float,2>{0.101497807f, 0.0266651455f},
-std::array<float,2>{0.256705254f, 0.529055774f},
-std::array<float,2>{0.869783103f, 0.261489034f},
-std::array<float,2>{0.945433736f, 0.684261322f},
-std::array<float,2>{0.458301157f, 0.400094509f},
-std::array<float,2>{0.236032695f, 0.935302019f},
-std::array<float,2>{0.728384852f, 0.161637098f},
-std::array<float,2>{0.762669504f, 0.990471482f},
-std::array<float,2>{0.353293926f, 0.204669163f},
-std::array<float,2>{0.0181422643f, 0.736497998f},
-std::array<float,2>{0.598541975f, 0.475152969f},
-std::array<float,2>{0.682267964f, 0.563512981f},
-std::array<float,2>{0.127186373f, 0.320404887f},
-std::array<float,2>{0.400668323f, 0.866443574f},
-std::array<float,2>{0.899376273f, 0.108876832f},
-std::array<float,2>{0.698526442f, 0.903801441f},
-std::array<float,2>{0.203256607f, 0.132084101f},
-std::array<float,2>{0.49848938f, 0.645294785f},
-std::array<float,2>{0.976016402f, 0.415634334f},
-std::array<float,2>{0.818477273f, 0.552054584f},
-std::array<float,2>{0.283938617f, 0.294711947f},
-std::array<float,2>{0.0707437098f, 0.759164155f},
-std::array<float,2>{0.539994478f, 0.0428072289f},
-std::array<float,2>{0.932160854f, 0.81947422f},
-std::array<float,2>{0.412855208f, 0.0934811682f},
-std::array<float,2>{0.178332537f, 0.61128819f},
-std::array<float,2>{0.631849229f, 0.344185561f},
-std::array<float,2>{0.579718888f, 0.687851489f},
-std::array<float,2>{0.0330338106f, 0.451687366f},
-std::array<float,2>{0.318517268f, 0.94305706f},
-std::array<float,2>{0.803292453f, 0.246448711f},
-std::array<float,2>{0.624860287f, 0.96601361f},
-std::array<float,2>{0.00487190392f, 0.225628629f},
-std::array<float,2>{0.374760807f, 0.712892294f},
-std::array<float,2>{0.768236458f, 0.466922492f},
-std::array<float,2>{0.885628343f, 0.597697914f},
-std::array<float,2>{0.379125535f, 0.365380734f},
-std::array<float,2>{0.154419109f, 0.838952482f},
-std::array<float,2>{0.671681941f, 0.0752705038f},
-std::array<float,2>{0.851539314f, 0.776067793f},
-std::array<float,2>{0.278275251f, 0.0615965016f},
-std::array<float,2>{0.11895261f, 0.532242298f},
-std::array<float,2>{0.517013967f, 0.302470118f},
-std::array<float,2>{0.742225885f, 0.625011683f},
-std::array<float,2>{0.225308746f, 0.423509121f},
-std::array<float,2>{0.451621324f, 0.887283981f},
-std::array<float,2>{0.96379149f, 0.155674532f},
-std::array<float,2>{0.653342605f, 0.851679921f},
-std::array<float,2>{0.157838404f, 0.114862256f},
-std::array<float,2>{0.429549098f, 0.58946681f},
-std::array<float,2>{0.919825554f, 0.335303217f},
-std::array<float,2>{0.789149702f, 0.729121923f},
-std::array<float,2>{0.333600044f, 0.485351443f},
-std::array<float,2>{0.0595790595f, 0.97996664f},
-std::array<float,2>{0.56869936f, 0.188689157f},
-std::array<float,2>{0.987789571f, 0.914362431f},
-std::array<float,2>{0.472630531f, 0.182703272f},
-std::array<float,2>{0.19018662f, 0.669513464f},
-std::array<float,2>{0.705097854f, 0.377171665f},
-std::array<float,2>{0.548293173f, 0.50403589f},
-std::array<float,2>{0.0934433192f, 0.26902324f},
-std::array<float,2>{0.303806186f, 0.801319718f},
-std::array<float,2>{0.832361221f, 0.00599272503f},
-std::array<float,2>{0.571218073f, 0.831084073f},
-std::array<float,2>{0.0534560345f, 0.0656293184f},
-std::array<float,2>{0.336934477f, 0.605344415f},
-std::array<float,2>{0.788517594f, 0.371496946f},
-std::array<float,2>{0.908565104f, 0.710514009f},
-std::array<float,2>{0.43130818f, 0.459424019f},
-std::array<float,2>{0.166186303f, 0.955827534f},
-std::array<float,2>{0.645838082f, 0.232221678f},
-std::array<float,2>{0.842152119f, 0.875224471f},
-std::array<float,2>{0.308805406f, 0.145076543f},
-std::array<float,2>{0.083129622f, 0.640032232f},
-std::array<float,2>{0.554830909f, 0.433485866f},
-std::array<float,2>{0.716000974f, 0.544035077f},
-std::array<float,2>{0.198031887f, 0.310495764f},
-std::array<float,2>{0.480310351f, 0.768878937f},
-std::array<float,2>{0.992378771f, 0.0510353222f},
-std::array<float,2>{0.658123732f, 0.972763181f},
-std::array<float,2>{0.14433296f, 0.198200494f},
-std::array<float,2>{0.386962652f, 0.726102173f},
-std::array<float,2>{0.881569624f, 0.494899571f},
-std::array<float,2>{0.777678907f, 0.580524147f},
-std::array<float,2>{0.36144948f, 0.342429727f},
-std::array<float,2>{0.0133628119f, 0.84378022f},
-std::array<float,2>{0.610342979f, 0.122142695f},
-std::array<float,2>{0.95760107f, 0.810334146f},
-std::array<float,2>{0.443211526f, 0.012025971f},
-std::array<float,2>{0.227065653f, 0.510615408f},
-std::array<float,2>{0.740214348f, 0.277030915f},
-std::array<float,2>{0.528223574f, 0.658448935f},
-std::array<float,2>{0.111694932f, 0.388094127f},
-std::array<float,2>{0.272502184f, 0.911191225f},
-std::array<float,2>{0.855656147f, 0.178306416f},
-std::array<float,2>{0.532853961f, 0.923101485f},
-std::array<float,2>{0.064374961f, 0.170592263f},
-std::array<float,2>{0.294186473f, 0.673720479f},
-std::array<float,2>{0.823128879f, 0.395270199f},
-std::array<float,2>{0.982756734f, 0.519679666f},
-std::array<float,2>{0.485942096f, 0.250926286f},
-std::array<float,2>{0.215645477f, 0.784230113f},
-std::array<float,2>{0.692470133f, 0.0167976096f},
-std::array<float,2>{0.812102914f, 0.869753063f},
-std::array<float,2>{0.32714057f, 0.0985075235f},
-std::array<float,2>{0.0410681069f, 0.576110423f},
-std::array<float,2>{0.587288499f, 0.313755304f},
-std::array<float,2>{0.634532511f, 0.748924673f},
-std::array<float,2>{0.184594765f, 0.479423851f},
-std::array<float,2>{0.414825231f, 0.99730885f},
-std::array<float,2>{0.92682302f, 0.21672456f},
-std::array<float,2>{0.722066045f, 0.750050545f},
-std::array<float,2>{0.246415749f, 0.0322146229f},
-std::array<float,2>{0.468015552f, 0.556408465f},
-std::array<float,2>{0.939782858f, 0.285213143f},
-std::array<float,2>{0.859735072f, 0.652813256f},
-std::array<float,2>{0.261043489f, 0.406750083f},
-std::array<float,2>{0.102497265f, 0.896365583f},
-std::array<float,2>{0.500623524f, 0.140219226f},
-std::array<float,2>{0.897044241f, 0.945477068f},
-std::array<float,2>{0.391585857f, 0.235573307f},
-std::array<float,2>{0.135385036f, 0.696282923f},
-std::array<float,2>{0.672399282f, 0.43767187f},
-std::array<float,2>{0.604978621f, 0.622069836f},
-std::array<float,2>{0.0298126731f, 0.355579883f},
-std::array<float,2>{0.351355255f, 0.827619135f},
-std::array<float,2>{0.754234493f, 0.0846535414f},
-std::array<float,2>{0.536466539f, 0.840962589f},
-std::array<float,2>{0.0672498941f, 0.0725405812f},
-std::array<float,2>{0.291633189f, 0.595186174f},
-std::array<float,2>{0.826875448f, 0.360675693f},
-std::array<float,2>{0.97827673f, 0.718478262f},
-std::array<float,2>{0.490472078f, 0.464153528f},
-std::array<float,2>{0.213492081f, 0.96205914f},
-std::array<float,2>{0.690577865f, 0.221179873f},
-std::array<float,2>{0.80651778f, 0.88315171f},
-std::array<float,2>{0.320408285f, 0.150314212f},
-std::array<float,2>{0.0452685915f, 0.629542351f},
-std::array<float,2>{0.590976298f, 0.426916629f},
-std::array<float,2>{0.640594184f, 0.535912752f},
-std::array<float,2>{0.182181299f, 0.298372298f},
-std::array<float,2>{0.419871807f, 0.77897042f},
-std::array<float,2>{0.923332334f, 0.0576567426f},
-std::array<float,2>{0.72287786f, 0.980814755f},
-std::array<float,2>{0.245196462f, 0.195247814f},
-std::array<float,2>{0.461381227f, 0.731542945f},
-std::array<float,2>{0.943007588f, 0.491078794f},
-std::array<float,2>{0.865189493f, 0.590460896f},
-std::array<float,2>{0.262585938f, 0.331153095f},
-std::array<float,2>{0.108527757f, 0.857784212f},
-std::array<float,2>{0.506365418f, 0.109821498f},
-std::array<float,2>{0.890846848f, 0.799455047f},
-std::array<float,2>{0.396629661f, 0.000460550073f},
-std::array<float,2>{0.136983737f, 0.503544509f},
-std::array<float,2>{0.678616166f, 0.271940172f},
-std::array<float,2>{0.606462777f, 0.667035043f},
-std::array<float,2>{0.025458226f, 0.37893486f},
-std::array<float,2>{0.344144374f, 0.921874106f},
-std::array<float,2>{0.75110513f, 0.184860572f},
-std::array<float,2>{0.57503742f, 0.932928622f},
-std::array<float,2>{0.0491596423f, 0.156677306f},
-std::array<float,2>{0.342050821f, 0.682473123f},
-std::array<float,2>{0.783854306f, 0.40516144f},
-std::array<float,2>{0.912374675f, 0.527212918f},
-std::array<float,2>{0.435052752f, 0.262884319f},
-std::array<float,2>{0.171404764f, 0.794757664f},
-std::array<float,2>{0.641898572f, 0.0280476306f},
-std::array<float,2>{0.83849746f, 0.860224068f},
-std::array<float,2>{0.306540132f, 0.104753204f},
-std::array<float,2>{0.0788799077f, 0.56783855f},
-std::array<float,2>{0.561351359f, 0.325532496f},
-std::array<float,2>{0.714188933f, 0.741965234f},
-std::array<float,2>{0.202598497f, 0.469446123f},
-std::array<float,2>{0.483812988f, 0.987730801f},
-std::array<float,2>{0.998658836f, 0.209871724f},
-std::array<float,2>{0.660473287f, 0.764751613f},
-std::array<float,2>{0.14568077f, 0.0465707108f},
-std::array<float,2>{0.386480033f, 0.547879517f},
-std::array<float,2>{0.875493586f, 0.292856008f},
-std::array<float,2>{0.773531735f, 0.644466221f},
-std::array<float,2>{0.364393979f, 0.421450943f},
-std::array<float,2>{0.00783428177f, 0.899605036f},
-std::array<float,2>{0.61711812f, 0.128427133f},
-std::array<float,2>{0.956442833f, 0.938271344f},
-std::array<float,2>{0.441095024f, 0.2450881f},
-std::array<float,2>{0.234093398f, 0.695114017f},
-std::array<float,2>{0.736278176f, 0.445969075f},
-std::array<float,2>{0.526403308f, 0.614622176f},
-std::array<float,2>{0.11556302f, 0.350783229f},
-std::array<float,2>{0.267257929f, 0.81401968f},
-std::array<float,2>{0.852521718f, 0.0898408368f},
-std::array<float,2>{0.619292855f, 0.785306454f},
-std::array<float,2>{0.00110242062f, 0.0228597894f},
-std::array<float,2>{0.369577795f, 0.516314566f},
-std::array<float,2>{0.770819068f, 0.256577104f},
-std::array<float,2>{0.887361169f, 0.676342845f},
-std::array<float,2>{0.378313988f, 0.394198775f},
-std::array<float,2>{0.148707524f, 0.928124785f},
-std::array<float,2>{0.667226017f, 0.165201902f},
-std::array<float,2>{0.844926775f, 0.994997859f},
-std::array<float,2>{0.27358225f, 0.213024706f},
-std::array<float,2>{0.123939082f, 0.745169997f},
-std::array<float,2>{0.521209121f, 0.481878132f},
-std::array<float,2>{0.748978615f, 0.571483791f},
-std::array<float,2>{0.220713794f, 0.318489015f},
-std::array<float,2>{0.445901185f, 0.873472452f},
-std::array<float,2>{0.967927098f, 0.0939312652f},
-std::array<float,2>{0.651482582f, 0.893902481f},
-std::array<float,2>{0.160615236f, 0.133791342f},
-std::array<float,2>{0.423532784f, 0.649924159f},
-std::array<float,2>{0.915636897f, 0.411366194f},
-std::array<float,2>{0.793825209f, 0.560455322f},
-std::array<float,2>{0.328139067f, 0.281270117f},
-std::array<float,2>{0.0566824414f, 0.756237507f},
-std::array<float,2>{0.564346194f, 0.0386618786f},
-std::array<float,2>{0.991797507f, 0.82147032f},
-std::array<float,2>{0.473584473f, 0.0799413472f},
-std::array<float,2>{0.195077017f, 0.618102491f},
-std::array<float,2>{0.708986163f, 0.355283439f},
-std::array<float,2>{0.553921461f, 0.702751219f},
-std::array<float,2>{0.0885548741f, 0.442834496f},
-std::array<float,2>{0.298185647f, 0.950106442f},
-std::array<float,2>{0.828606784f, 0.241481125f},
-std::array<float,2>{0.512511611f, 0.958570182f},
-std::array<float,2>{0.0950314552f, 0.228872091f},
-std::array<float,2>{0.251437992f, 0.705369174f},
-std::array<float,2>{0.874807477f, 0.453276396f},
-std::array<float,2>{0.951457024f, 0.605790854f},
-std::array<float,2>{0.456906408f, 0.369556427f},
-std::array<float,2>{0.238590315f, 0.832700014f},
-std::array<float,2>{0.732910573f, 0.0700732842f},
-std::array<float,2>{0.760269225f, 0.773427844f},
-std::array<float,2>{0.356024325f, 0.0471985526f},
-std::array<float,2>{0.0212836172f, 0.542835355f},
-std::array<float,2>{0.595745444f, 0.305850714f},
-std::array<float,2>{0.685106158f, 0.634909451f},
-std::array<float,2>{0.132185489f, 0.433734059f},
-std::array<float,2>{0.403747588f, 0.881118715f},
-std::array<float,2>{0.904738486f, 0.141744345f},
-std::array<float,2>{0.700825274f, 0.851056099f},
-std::array<float,2>{0.209208995f, 0.119834237f},
-std::array<float,2>{0.49373126f, 0.584365606f},
-std::array<float,2>{0.972188592f, 0.336094737f},
-std::array<float,2>{0.813450813f, 0.720497668f},
-std::array<float,2>{0.287421167f, 0.498206258f},
-std::array<float,2>{0.0758795589f, 0.970792592f},
-std::array<float,2>{0.544269383f, 0.200849161f},
-std::array<float,2>{0.934269905f, 0.906861186f},
-std::array<float,2>{0.409801245f, 0.174243048f},
-std::array<float,2>{0.172355607f, 0.66358006f},
-std::array<float,2>{0.62742734f, 0.383699745f},
-std::array<float,2>{0.582208991f, 0.514227331f},
-std::array<float,2>{0.0389762223f, 0.279334247f},
-std::array<float,2>{0.313894272f, 0.807278216f},
-std::array<float,2>{0.800399363f, 0.010134412f},
-std::array<float,2>{0.516017437f, 0.773761928f},
-std::array<float,2>{0.118063003f, 0.0598248653f},
-std::array<float,2>{0.278437823f, 0.534242868f},
-std::array<float,2>{0.850475252f, 0.303374738f},
-std::array<float,2>{0.9640733f, 0.628008127f},
-std::array<float,2>{0.452201575f, 0.424274325f},
-std::array<float,2>{0.225758836f, 0.890000045f},
-std::array<float,2>{0.743282557f, 0.154236346f},
-std::array<float,2>{0.769378185f, 0.968499839f},
-std::array<float,2>{0.373538882f, 0.224388734f},
-std::array<float,2>{0.00556592457f, 0.712347209f},
-std::array<float,2>{0.623084605f, 0.465171367f},
-std::array<float,2>{0.670726717f, 0.599836409f},
-std::array<float,2>{0.155343831f, 0.364178032f},
-std::array<float,2>{0.380329847f, 0.837141216f},
-std::array<float,2>{0.886249602f, 0.0770840943f},
-std::array<float,2>{0.707010806f, 0.917913496f},
-std::array<float,2>{0.190612748f, 0.181349948f},
-std::array<float,2>{0.470838308f, 0.670573473f},
-std::array<float,2>{0.986999273f, 0.375134826f},
-std::array<float,2>{0.833918571f, 0.505901635f},
-std::array<float,2>{0.302892685f, 0.26677227f},
-std::array<float,2>{0.0924448296f, 0.804419637f},
-std::array<float,2>{0.547103107f, 0.00583043462f},
-std::array<float,2>{0.918655753f, 0.854575753f},
-std::array<float,2>{0.427964002f, 0.116423517f},
-std::array<float,2>{0.156313837f, 0.586468816f},
-std::array<float,2>{0.652623415f, 0.333238423f},
-std::array<float,2>{0.569615483f, 0.72767961f},
-std::array<float,2>{0.058932256f, 0.487973183f},
-std::array<float,2>{0.332868725f, 0.978378117f},
-std::array<float,2>{0.790710926f, 0.190276518f},
-std::array<float,2>{0.599374652f, 0.989633143f},
-std::array<float,2>{0.0188178178f, 0.20508948f},
-std::array<float,2>{0.352116287f, 0.734771609f},
-std::array<float,2>{0.763403773f, 0.474159122f},
-std::array<float,2>{0.900092125f, 0.565077245f},
-std::array<float,2>{0.401616663f, 0.323325187f},
-std::array<float,2>{0.128584608f, 0.864998698f},
-std::array<float,2>{0.683477998f, 0.106428042f},
-std::array<float,2>{0.870257914f, 0.789942265f},
-std::array<float,2>{0.256854773f, 0.0241171066f},
-std::array<float,2>{0.100412995f, 0.530812681f},
-std::array<float,2>{0.511195838f, 0.259097904f},
-std::array<float,2>{0.727163374f, 0.68643713f},
-std::array<float,2>{0.234919325f, 0.401168317f},
-std::array<float,2>{0.457134753f, 0.936189711f},
-std::array<float,2>{0.947130799f, 0.162336186f},
-std::array<float,2>{0.631726682f, 0.817407191f},
-std::array<float,2>{0.178826585f, 0.090642035f},
-std::array<float,2>{0.413905203f, 0.612333059f},
-std::array<float,2>{0.932888508f, 0.346990258f},
-std::array<float,2>{0.803738236f, 0.691382885f},
-std::array<float,2>{0.319699407f, 0.44949317f},
-std::array<float,2>{0.0319747329f, 0.944661856f},
-std::array<float,2>{0.57892102f, 0.248512313f},
-std::array<float,2>{0.975180507f, 0.90557152f},
-std::array<float,2>{0.499314666f, 0.129458994f},
-std::array<float,2>{0.204313785f, 0.646740079f},
-std::array<float,2>{0.697738647f, 0.416756421f},
-std::array<float,2>{0.540873349f, 0.554037154f},
-std::array<float,2>{0.0715042427f, 0.296797097f},
-std::array<float,2>{0.284376442f, 0.761216044f},
-std::array<float,2>{0.819420755f, 0.039751146f},
-std::array<float,2>{0.586464584f, 0.868509173f},
-std::array<float,2>{0.0420605578f, 0.101380929f},
-std::array<float,2>{0.327247769f, 0.57784909f},
-std::array<float,2>{0.810744166f, 0.316130459f},
-std::array<float,2>{0.925952733f, 0.746130407f},
-std::array<float,2>{0.415878177f, 0.476664126f},
-std::array<float,2>{0.183915302f, 0.999421179f},
-std::array<float,2>{0.633051217f, 0.216841519f},
-std::array<float,2>{0.823934913f, 0.925593853f},
-std::array<float,2>{0.293479711f, 0.168347985f},
-std::array<float,2>{0.063048251f, 0.675071776f},
-std::array<float,2>{0.531610191f, 0.398259968f},
-std::array<float,2>{0.692273259f, 0.522314727f},
-std::array<float,2>{0.216716722f, 0.252821594f},
-std::array<float,2>{0.484451026f, 0.782673001f},
-std::array<float,2>{0.983646691f, 0.0190776121f},
-std::array<float,2>{0.673638344f, 0.948079288f},
-std::array<float,2>{0.135975376f, 0.237901002f},
-std::array<float,2>{0.391982973f, 0.699135661f},
-std::array<float,2>{0.89828819f, 0.440192014f},
-std::array<float,2>{0.755231559f, 0.623320282f},
-std::array<float,2>{0.350138932f, 0.358743757f},
-std::array<float,2>{0.0310974941f, 0.824627221f},
-std::array<float,2>{0.603650987f, 0.0838609859f},
-std::array<float,2>{0.940840185f, 0.753605127f},
-std::array<float,2>{0.467676014f, 0.0351131819f},
-std::array<float,2>{0.247450188f, 0.557052553f},
-std::array<float,2>{0.721274555f, 0.287541091f},
-std::array<float,2>{0.501470983f, 0.655455649f},
-std::array<float,2>{0.102907777f, 0.408798337f},
-std::array<float,2>{0.260041326f, 0.897794366f},
-std::array<float,2>{0.861224353f, 0.13817437f},
-std::array<float,2>{0.556439519f, 0.877373338f},
-std::array<float,2>{0.0826063231f, 0.146696538f},
-std::array<float,2>{0.309827805f, 0.638267279f},
-std::array<float,2>{0.842844725f, 0.430471301f},
-std::array<float,2>{0.993981719f, 0.546382964f},
-std::array<float,2>{0.479085624f, 0.310987502f},
-std::array<float,2>{0.198698819f, 0.767573595f},
-std::array<float,2>{0.715382099f, 0.0529724471f},
-std::array<float,2>{0.787867844f, 0.828810811f},
-std::array<float,2>{0.336885482f, 0.063885048f},
-std::array<float,2>{0.0538233109f, 0.602275789f},
-std::array<float,2>{0.572121501f, 0.37410152f},
-std::array<float,2>{0.645267129f, 0.708784163f},
-std::array<float,2>{0.167765841f, 0.458357304f},
-std::array<float,2>{0.430444568f, 0.954402506f},
-std::array<float,2>{0.909652054f, 0.232952893f},
-std::array<float,2>{0.738724828f, 0.810773551f},
-std::array<float,2>{0.227813095f, 0.0155711602f},
-std::array<float,2>{0.441927969f, 0.508565843f},
-std::array<float,2>{0.95832783f, 0.274917752f},
-std::array<float,2>{0.857299387f, 0.656348228f},
-std::array<float,2>{0.272212476f, 0.389362842f},
-std::array<float,2>{0.112923495f, 0.913632154f},
-std::array<float,2>{0.52887255f, 0.177035183f},
-std::array<float,2>{0.882238925f, 0.975069761f},
-std::array<float,2>{0.388180912f, 0.19655177f},
-std::array<float,2>{0.143045515f, 0.724317491f},
-std::array<float,2>{0.657028913f, 0.493484378f},
-std::array<float,2>{0.611046255f, 0.57836163f},
-std::array<float,2>{0.0117532331f, 0.341136873f},
-std::array<float,2>{0.362569958f, 0.846346676f},
-std::array<float,2>{0.778944016f, 0.12461216f},
-std::array<float,2>{0.504288197f, 0.856506288f},
-std::array<float,2>{0.107042998f, 0.111661993f},
-std::array<float,2>{0.264652699f, 0.593228281f},
-std::array<float,2>{0.867011011f, 0.328318059f},
-std::array<float,2>{0.945095181f, 0.732943654f},
-std::array<float,2>{0.462928593f, 0.489002168f},
-std::array<float,2>{0.243115276f, 0.984312236f},
-std::array<float,2>{0.724848211f, 0.192113206f},
-std::array<float,2>{0.752106965f, 0.918834627f},
-std::array<float,2>{0.347292036f, 0.18568255f},
-std::array<float,2>{0.023944743f, 0.665502548f},
-std::array<float,2>{0.607878327f, 0.381121725f},
-std::array<float,2>{0.6776371f, 0.500700355f},
-std::array<float,2>{0.138776168f, 0.270688951f},
-std::array<float,2>{0.395884663f, 0.796896756f},
-std::array<float,2>{0.89273715f, 0.00372002949f},
-std::array<float,2>{0.688894749f, 0.964390814f},
-std::array<float,2>{0.211413965f, 0.219581783f},
-std::array<float,2>{0.489086658f, 0.716558695f},
-std::array<float,2>{0.979035497f, 0.461660445f},
-std::array<float,2>{0.825099409f, 0.596480727f},
-std::array<float,2>{0.290295362f, 0.362990022f},
-std::array<float,2>{0.0693200082f, 0.843025923f},
-std::array<float,2>{0.538196981f, 0.0721336678f},
-std::array<float,2>{0.924675345f, 0.779584944f},
-std::array<float,2>{0.420865089f, 0.0561952852f},
-std::array<float,2>{0.180727392f, 0.53893894f},
-std::array<float,2>{0.63832593f, 0.300663143f},
-std::array<float,2>{0.593633533f, 0.63277024f},
-std::array<float,2>{0.044824481f, 0.428114355f},
-std::array<float,2>{0.323185384f, 0.885110021f},
-std::array<float,2>{0.806675494f, 0.151975468f},
-std::array<float,2>{0.614694118f, 0.901528656f},
-std::array<float,2>{0.0101555586f, 0.126422822f},
-std::array<float,2>{0.366198957f, 0.640991986f},
-std::array<float,2>{0.776233137f, 0.419554412f},
-std::array<float,2>{0.878480911f, 0.550683975f},
-std::array<float,2>{0.383694619f, 0.289217591f},
-std::array<float,2>{0.148382351f, 0.762618065f},
-std::array<float,2>{0.663351774f, 0.043014273f},
-std::array<float,2>{0.855072916f, 0.814779043f},
-std::array<float,2>{0.269196689f, 0.0873776376f},
-std::array<float,2>{0.113390118f, 0.615520239f},
-std::array<float,2>{0.523490548f, 0.348580927f},
-std::array<float,2>{0.737989724f, 0.692036152f},
-std::array<float,2>{0.231872693f, 0.447817951f},
-std::array<float,2>{0.438813001f, 0.940132737f},
-std::array<float,2>{0.954488337f, 0.244112298f},
-std::array<float,2>{0.643927991f, 0.795431733f},
-std::array<float,2>{0.16867952f, 0.0303288512f},
-std::array<float,2>{0.43604517f, 0.523580015f},
-std::array<float,2>{0.910629034f, 0.264895588f},
-std::array<float,2>{0.782015324f, 0.680597603f},
-std::array<float,2>{0.340211868f, 0.403774947f},
-std::array<float,2>{0.0476547666f, 0.929973006f},
-std::array<float,2>{0.576289356f, 0.159831405f},
-std::array<float,2>{0.997911096f, 0.985533059f},
-std::array<float,2>{0.481853724f, 0.208390579f},
-std::array<float,2>{0.199658677f, 0.739489794f},
-std::array<float,2>{0.711954117f, 0.471547008f},
-std::array<float,2>{0.559227705f, 0.568573117f},
-std::array<float,2>{0.081258446f, 0.32748428f},
-std::array<float,2>{0.307394743f, 0.863058686f},
-std::array<float,2>{0.837156892f, 0.102277569f},
-std::array<float,2>{0.56445998f, 0.755595565f},
-std::array<float,2>{0.0548391342f, 0.0366984718f},
-std::array<float,2>{0.331912458f, 0.561032772f},
-std::array<float,2>{0.796112657f, 0.284588218f},
-std::array<float,2>{0.916175425f, 0.650664687f},
-std::array<float,2>{0.425622791f, 0.412763923f},
-std::array<float,2>{0.164054871f, 0.892548919f},
-std::array<float,2>{0.650018811f, 0.136554718f},
-std::array<float,2>{0.830276251f, 0.952161908f},
-std::array<float,2>{0.299164563f, 0.239497408f},
-std::array<float,2>{0.0878273621f, 0.700713575f},
-std::array<float,2>{0.552142382f, 0.445035964f},
-std::array<float,2>{0.708521247f, 0.62053138f},
-std::array<float,2>{0.193150595f, 0.352027178f},
-std::array<float,2>{0.475739419f, 0.824016035f},
-std::array<float,2>{0.988475204f, 0.0811691806f},
-std::array<float,2>{0.66522485f, 0.926645994f},
-std::array<float,2>{0.150703192f, 0.166461602f},
-std::array<float,2>{0.37648806f, 0.678442061f},
-std::array<float,2>{0.889359057f, 0.392543018f},
-std::array<float,2>{0.77215296f, 0.518762708f},
-std::array<float,2>{0.367918402f, 0.255222678f},
-std::array<float,2>{0.00384746352f, 0.788794696f},
-std::array<float,2>{0.61744374f, 0.0209249444f},
-std::array<float,2>{0.965495408f, 0.871570647f},
-std::array<float,2>{0.447509378f, 0.0964673534f},
-std::array<float,2>{0.220316604f, 0.572337151f},
-std::array<float,2>{0.74638164f, 0.31739822f},
-std::array<float,2>{0.521701276f, 0.743448555f},
-std::array<float,2>{0.12120638f, 0.483484715f},
-std::array<float,2>{0.275881946f, 0.993407309f},
-std::array<float,2>{0.846244276f, 0.212032109f},
-std::array<float,2>{0.545482576f, 0.970671117f},
-std::array<float,2>{0.0775801316f, 0.201465845f},
-std::array<float,2>{0.286664993f, 0.722186863f},
-std::array<float,2>{0.814570844f, 0.497791201f},
-std::array<float,2>{0.970616043f, 0.583348989f},
-std::array<float,2>{0.494188905f, 0.339621782f},
-std::array<float,2>{0.208261997f, 0.848220646f},
-std::array<float,2>{0.701413631f, 0.117201596f},
-std::array<float,2>{0.79689461f, 0.806174815f},
-std::array<float,2>{0.316301733f, 0.00923191942f},
-std::array<float,2>{0.0355583094f, 0.512311995f},
-std::array<float,2>{0.584485769f, 0.278636485f},
-std::array<float,2>{0.625645101f, 0.661290467f},
-std::array<float,2>{0.175629929f, 0.38667807f},
-std::array<float,2>{0.408162206f, 0.908654392f},
-std::array<float,2>{0.937239707f, 0.172795609f},
-std::array<float,2>{0.731367052f, 0.835351825f},
-std::array<float,2>{0.240933657f, 0.0669951066f},
-std::array<float,2>{0.454121202f, 0.608523548f},
-std::array<float,2>{0.950719357f, 0.367953897f},
-std::array<float,2>{0.871095359f, 0.704267263f},
-std::array<float,2>{0.253535748f, 0.45558244f},
-std::array<float,2>{0.0971225649f, 0.959389985f},
-std::array<float,2>{0.513684928f, 0.227800891f},
-std::array<float,2>{0.903660178f, 0.880014181f},
-std::array<float,2>{0.404776275f, 0.142599091f},
-std::array<float,2>{0.130481213f, 0.634525716f},
-std::array<float,2>{0.687116861f, 0.437139273f},
-std::array<float,2>{0.594953597f, 0.540221155f},
-std::array<float,2>{0.0226889886f, 0.307978451f},
-std::array<float,2>{0.35935387f, 0.770367026f},
-std::array<float,2>{0.758186638f, 0.0498867221f},
-std::array<float,2>{0.549697816f, 0.80231154f},
-std::array<float,2>{0.0908993855f, 0.00709485123f},
-std::array<float,2>{0.301308095f, 0.505247831f},
-std::array<float,2>{0.835491598f, 0.268320173f},
-std::array<float,2>{0.985819221f, 0.668292105f},
-std::array<float,2>{0.468945354f, 0.377977818f},
-std::array<float,2>{0.188434616f, 0.915266335f},
-std::array<float,2>{0.703225374f, 0.181695148f},
-std::array<float,2>{0.7911641f, 0.978898644f},
-std::array<float,2>{0.335265368f, 0.18831946f},
-std::array<float,2>{0.0615223087f, 0.729580522f},
-std::array<float,2>{0.567076504f, 0.48560077f},
-std::array<float,2>{0.654611051f, 0.588753939f},
-std::array<float,2>{0.159544542f, 0.333994091f},
-std::array<float,2>{0.427468807f, 0.85319829f},
-std::array<float,2>{0.920062602f, 0.11414592f},
-std::array<float,2>{0.745033681f, 0.888457417f},
-std::array<float,2>{0.223833218f, 0.154393196f},
-std::array<float,2>{0.450379044f, 0.626289845f},
-std::array<float,2>{0.962379098f, 0.422572792f},
-std::array<float,2>{0.848448813f, 0.531824946f},
-std::array<float,2>{0.279670477f, 0.301420689f},
-std::array<float,2>{0.120297953f, 0.776894927f},
-std::array<float,2>{0.518895328f, 0.060838744f},
-std::array<float,2>{0.884612739f, 0.837891519f},
-std::array<float,2>{0.381701112f, 0.0743745938f},
-std::array<float,2>{0.152975559f, 0.598739445f},
-std::array<float,2>{0.668475628f, 0.366387755f},
-std::array<float,2>{0.622130454f, 0.714435518f},
-std::array<float,2>{0.00682287617f, 0.468248188f},
-std::array<float,2>{0.371985137f, 0.96547246f},
-std::array<float,2>{0.767468929f, 0.224942416f},
-std::array<float,2>{0.58175081f, 0.94147265f},
-std::array<float,2>{0.0347013883f, 0.247285485f},
-std::array<float,2>{0.317736387f, 0.688525438f},
-std::array<float,2>{0.801943243f, 0.452248514f},
-std::array<float,2>{0.930948019f, 0.609486282f},
-std::array<float,2>{0.410862684f, 0.345660388f},
-std::array<float,2>{0.176870003f, 0.818365633f},
-std::array<float,2>{0.630825758f, 0.0922536328f},
-std::array<float,2>{0.817991495f, 0.75841558f},
-std::array<float,2>{0.28257215f, 0.0415175632f},
-std::array<float,2>{0.0735109448f, 0.551720321f},
-std::array<float,2>{0.541857123f, 0.293231606f},
-std::array<float,2>{0.697141111f, 0.646381795f},
-std::array<float,2>{0.205395073f, 0.414938271f},
-std::array<float,2>{0.496118277f, 0.90304631f},
-std::array<float,2>{0.974217236f, 0.131278306f},
-std::array<float,2>{0.681231856f, 0.865354419f},
-std::array<float,2>{0.12575829f, 0.108221099f},
-std::array<float,2>{0.400052577f, 0.562779069f},
-std::array<float,2>{0.901547611f, 0.3214387f},
-std::array<float,2>{0.764690816f, 0.737430513f},
-std::array<float,2>{0.354615062f, 0.475748539f},
-std::array<float,2>{0.0168910958f, 0.991516173f},
-std::array<float,2>{0.600872278f, 0.203951001f},
-std::array<float,2>{0.948874772f, 0.934548378f},
-std::array<float,2>{0.459840596f, 0.160725176f},
-std::array<float,2>{0.237729311f, 0.684887767f},
-std::array<float,2>{0.729434073f, 0.399011493f},
-std::array<float,2>{0.508882225f, 0.527365088f},
-std::array<float,2>{0.0988088623f, 0.260107398f},
-std::array<float,2>{0.255815864f, 0.792789698f},
-std::array<float,2>{0.868067503f, 0.0259779915f},
-std::array<float,2>{0.602998555f, 0.826976895f},
-std::array<float,2>{0.0284698438f, 0.0855378881f},
-std::array<float,2>{0.348028928f, 0.622330248f},
-std::array<float,2>{0.756895661f, 0.356611192f},
-std::array<float,2>{0.896359563f, 0.696792245f},
-std::array<float,2>{0.392791659f, 0.439439029f},
-std::array<float,2>{0.134498224f, 0.946752846f},
-std::array<float,2>{0.675064623f, 0.235117316f},
-std::array<float,2>{0.862879932f, 0.89517051f},
-std::array<float,2>{0.25934121f, 0.139176965f},
-std::array<float,2>{0.104158163f, 0.653946638f},
-std::array<float,2>{0.503267825f, 0.407782257f},
-std::array<float,2>{0.720108986f, 0.555234373f},
-std::array<float,2>{0.248317048f, 0.286444545f},
-std::array<float,2>{0.464898169f, 0.751116693f},
-std::array<float,2>{0.93915385f, 0.0326149203f},
-std::array<float,2>{0.635871112f, 0.996369481f},
-std::array<float,2>{0.187367752f, 0.215327919f},
-std::array<float,2>{0.416225463f, 0.749836862f},
-std::array<float,2>{0.929616988f, 0.480340064f},
-std::array<float,2>{0.809418857f, 0.575190187f},
-std::array<float,2>{0.324323833f, 0.312677354f},
-std::array<float,2>{0.0397697575f, 0.870417774f},
-std::array<float,2>{0.587927401f, 0.0993197933f},
-std::array<float,2>{0.981437802f, 0.783915699f},
-std::array<float,2>{0.488015503f, 0.0157230757f},
-std::array<float,2>{0.217439204f, 0.520632267f},
-std::array<float,2>{0.694156051f, 0.251662165f},
-std::array<float,2>{0.534812331f, 0.672835886f},
-std::array<float,2>{0.0656829923f, 0.396161765f},
-std::array<float,2>{0.295543909f, 0.922833204f},
-std::array<float,2>{0.821834445f, 0.171238273f},
-std::array<float,2>{0.529647112f, 0.910846353f},
-std::array<float,2>{0.110769205f, 0.179603741f},
-std::array<float,2>{0.26957348f, 0.66015476f},
-std::array<float,2>{0.857720792f, 0.387313724f},
-std::array<float,2>{0.960656762f, 0.511262298f},
-std::array<float,2>{0.443667054f, 0.276085258f},
-std::array<float,2>{0.228957415f, 0.809272051f},
-std::array<float,2>{0.740558147f, 0.0134147108f},
-std::array<float,2>{0.77965641f, 0.844985962f},
-std::array<float,2>{0.360122442f, 0.121394478f},
-std::array<float,2>{0.0148136755f, 0.581844449f},
-std::array<float,2>{0.611703753f, 0.343749285f},
-std::array<float,2>{0.658432126f, 0.725064456f},
-std::array<float,2>{0.141895071f, 0.495823085f},
-std::array<float,2>{0.390451699f, 0.973859668f},
-std::array<float,2>{0.880412877f, 0.198334724f},
-std::array<float,2>{0.717415869f, 0.768156588f},
-std::array<float,2>{0.195736915f, 0.0525003485f},
-std::array<float,2>{0.477663577f, 0.543911874f},
-std::array<float,2>{0.994679868f, 0.308775216f},
-std::array<float,2>{0.840467453f, 0.639262438f},
-std::array<float,2>{0.31071505f, 0.431649268f},
-std::array<float,2>{0.0841713995f, 0.876225889f},
-std::array<float,2>{0.55820173f, 0.145583123f},
-std::array<float,2>{0.907648146f, 0.956227303f},
-std::array<float,2>{0.432148546f, 0.231426507f},
-std::array<float,2>{0.165450975f, 0.709911525f},
-std::array<float,2>{0.647350967f, 0.460369855f},
-std::array<float,2>{0.573277414f, 0.604017138f},
-std::array<float,2>{0.0522077009f, 0.37294805f},
-std::array<float,2>{0.337948531f, 0.830764949f},
-std::array<float,2>{0.785568118f, 0.0647556037f},
-std::array<float,2>{0.5143435f, 0.832229257f},
-std::array<float,2>{0.0974729657f, 0.0695809573f},
-std::array<float,2>{0.252965122f, 0.606412232f},
-std::array<float,2>{0.871653497f, 0.370048016f},
-std::array<float,2>{0.950311661f, 0.705679536f},
-std::array<float,2>{0.454757899f, 0.453970194f},
-std::array<float,2>{0.24062258f, 0.958105862f},
-std::array<float,2>{0.730666339f, 0.229436502f},
-std::array<float,2>{0.75865227f, 0.8816576f},
-std::array<float,2>{0.358601958f, 0.142219633f},
-std::array<float,2>{0.0232206639f, 0.635320902f},
-std::array<float,2>{0.595643997f, 0.434211105f},
-std::array<float,2>{0.686574697f, 0.542336345f},
-std::array<float,2>{0.130370736f, 0.306156784f},
-std::array<float,2>{0.405222058f, 0.772590637f},
-std::array<float,2>{0.903868139f, 0.0478319377f},
-std::array<float,2>{0.70206362f, 0.971264064f},
-std::array<float,2>{0.208717123f, 0.200282574f},
-std::array<float,2>{0.494751066f, 0.719782829f},
-std::array<float,2>{0.970042467f, 0.498862386f},
-std::array<float,2>{0.815179944f, 0.584523261f},
-std::array<float,2>{0.28659606f, 0.33653599f},
-std::array<float,2>{0.0779699162f, 0.851387799f},
-std::array<float,2>{0.545239151f, 0.119435273f},
-std::array<float,2>{0.936617911f, 0.806962311f},
-std::array<float,2>{0.40770033f, 0.0107144956f},
-std::array<float,2>{0.175160661f, 0.513879538f},
-std::array<float,2>{0.625104427f, 0.279940397f},
-std::array<float,2>{0.5841524f, 0.663464665f},
-std::array<float,2>{0.0359936692f, 0.383113295f},
-std::array<float,2>{0.315637052f, 0.906480432f},
-std::array<float,2>{0.797624588f, 0.174529746f},
-std::array<float,2>{0.61784935f, 0.928643346f},
-std::array<float,2>{0.00315048289f, 0.165899366f},
-std::array<float,2>{0.367660195f, 0.676163256f},
-std::array<float,2>{0.771963537f, 0.393804967f},
-std::array<float,2>{0.889011562f, 0.516044617f},
-std::array<float,2>{0.376315415f, 0.256279558f},
-std::array<float,2>{0.151246354f, 0.786106169f},
-std::array<float,2>{0.665568471f, 0.023022579f},
-std::array<float,2>{0.845983863f, 0.873876274f},
-std::array<float,2>{0.275604606f, 0.094698146f},
-std::array<float,2>{0.121690333f, 0.572052896f},
-std::array<float,2>{0.522201896f, 0.318984717f},
-std::array<float,2>{0.746607184f, 0.745852172f},
-std::array<float,2>{0.220095202f, 0.482034892f},
-std::array<float,2>{0.448037148f, 0.994324386f},
-std::array<float,2>{0.964871883f, 0.213857427f},
-std::array<float,2>{0.64945817f, 0.756626368f},
-std::array<float,2>{0.163288593f, 0.0384730175f},
-std::array<float,2>{0.425002962f, 0.559851825f},
-std::array<float,2>{0.916688085f, 0.282188177f},
-std::array<float,2>{0.796775699f, 0.649647236f},
-std::array<float,2>{0.331523329f, 0.411805987f},
-std::array<float,2>{0.0554460436f, 0.894488156f},
-std::array<float,2>{0.565008044f, 0.134400144f},
-std::array<float,2>{0.989062369f, 0.949219346f},
-std::array<float,2>{0.476187885f, 0.242092073f},
-std::array<float,2>{0.192415401f, 0.702304661f},
-std::array<float,2>{0.70813477f, 0.443258494f},
-std::array<float,2>{0.552409828f, 0.617574632f},
-std::array<float,2>{0.0871020332f, 0.354762137f},
-std::array<float,2>{0.299777269f, 0.821869135f},
-std::array<float,2>{0.83087194f, 0.0793429017f},
-std::array<float,2>{0.576957703f, 0.794333458f},
-std::array<float,2>{0.0472214334f, 0.027802065f},
-std::array<float,2>{0.340770036f, 0.526567757f},
-std::array<float,2>{0.781597137f, 0.263657421f},
-std::array<float,2>{0.910864294f, 0.68182236f},
-std::array<float,2>{0.436020702f, 0.404668182f},
-std::array<float,2>{0.168017969f, 0.933152497f},
-std::array<float,2>{0.644143283f, 0.157045171f},
-std::array<float,2>{0.837660968f, 0.988212109f},
-std::array<float,2>{0.306999326f, 0.209031865f},
-std::array<float,2>{0.0820289627f, 0.741299868f},
-std::array<float,2>{0.559000313f, 0.468779385f},
-std::array<float,2>{0.712445498f, 0.568100333f},
-std::array<float,2>{0.19971554f, 0.326013923f},
-std::array<float,2>{0.482248902f, 0.859481156f},
-std::array<float,2>{0.997453213f, 0.105081774f},
-std::array<float,2>{0.663660347f, 0.900125563f},
-std::array<float,2>{0.147786245f, 0.127936676f},
-std::array<float,2>{0.38304615f, 0.643896043f},
-std::array<float,2>{0.878344178f, 0.421325296f},
-std::array<float,2>{0.775834084f, 0.548643768f},
-std::array<float,2>{0.365308285f, 0.292067736f},
-std::array<float,2>{0.01063943f, 0.765170813f},
-std::array<float,2>{0.614908993f, 0.0462567918f},
-std::array<float,2>{0.954835653f, 0.813616216f},
-std::array<float,2>{0.439381182f, 0.0891814902f},
-std::array<float,2>{0.232057706f, 0.615145326f},
-std::array<float,2>{0.737649798f, 0.351291418f},
-std::array<float,2>{0.524367094f, 0.694336176f},
-std::array<float,2>{0.114201576f, 0.445772022f},
-std::array<float,2>{0.268597156f, 0.937753975f},
-std::array<float,2>{0.854526758f, 0.244423524f},
-std::array<float,2>{0.538886189f, 0.962726831f},
-std::array<float,2>{0.0686134547f, 0.221389174f},
-std::array<float,2>{0.290908903f, 0.718056321f},
-std::array<float,2>{0.824303508f, 0.464696258f},
-std::array<float,2>{0.978594005f, 0.595490992f},
-std::array<float,2>{0.488648951f, 0.361112416f},
-std::array<float,2>{0.211731285f, 0.841570437f},
-std::array<float,2>{0.68943429f, 0.0727584064f},
-std::array<float,2>{0.807490349f, 0.778472424f},
-std::array<float,2>{0.322623491f, 0.0585818999f},
-std::array<float,2>{0.0440731905f, 0.535374105f},
-std::array<float,2>{0.593081713f, 0.298301369f},
-std::array<float,2>{0.63779062f, 0.629199505f},
-std::array<float,2>{0.181627959f, 0.427494079f},
-std::array<float,2>{0.420345008f, 0.883331001f},
-std::array<float,2>{0.923936248f, 0.149661526f},
-std::array<float,2>{0.725187659f, 0.857975721f},
-std::array<float,2>{0.242326766f, 0.110114992f},
-std::array<float,2>{0.463561594f, 0.590078652f},
-std::array<float,2>{0.944439232f, 0.331959754f},
-std::array<float,2>{0.866312504f, 0.732243419f},
-std::array<float,2>{0.265146673f, 0.490467906f},
-std::array<float,2>{0.106743194f, 0.981119096f},
-std::array<float,2>{0.504706502f, 0.194676012f},
-std::array<float,2>{0.89323163f, 0.92091006f},
-std::array<float,2>{0.396181494f, 0.185501277f},
-std::array<float,2>{0.139390871f, 0.667722881f},
-std::array<float,2>{0.677058876f, 0.379578888f},
-std::array<float,2>{0.608139515f, 0.503078401f},
-std::array<float,2>{0.0236597564f, 0.272142291f},
-std::array<float,2>{0.347037822f, 0.799013793f},
-std::array<float,2>{0.752552211f, 0.000568949908f},
-std::array<float,2>{0.557918251f, 0.766806841f},
-std::array<float,2>{0.0847343057f, 0.0535019487f},
-std::array<float,2>{0.311120868f, 0.546598673f},
-std::array<float,2>{0.840323329f, 0.311512083f},
-std::array<float,2>{0.994187951f, 0.637779295f},
-std::array<float,2>{0.4782511f, 0.430065423f},
-std::array<float,2>{0.195838496f, 0.87768513f},
-std::array<float,2>{0.716865301f, 0.147426084f},
-std::array<float,2>{0.785763502f, 0.954747915f},
-std::array<float,2>{0.338433176f, 0.232666641f},
-std::array<float,2>{0.0526075847f, 0.70830518f},
-std::array<float,2>{0.574095011f, 0.458911568f},
-std::array<float,2>{0.646733463f, 0.601680815f},
-std::array<float,2>{0.165845633f, 0.374938071f},
-std::array<float,2>{0.431989133f, 0.828173459f},
-std::array<float,2>{0.907811582f, 0.0642326102f},
-std::array<float,2>{0.740755022f, 0.913455427f},
-std::array<float,2>{0.229255214f, 0.17739813f},
-std::array<float,2>{0.444301188f, 0.656963766f},
-std::array<float,2>{0.960433185f, 0.389064461f},
-std::array<float,2>{0.858340025f, 0.508215427f},
-std::array<float,2>{0.27049315f, 0.274628967f},
-std::array<float,2>{0.110940523f, 0.811404049f},
-std::array<float,2>{0.530036032f, 0.0150528932f},
-std::array<float,2>{0.880100369f, 0.845796525f},
-std::array<float,2>{0.389699042f, 0.124133483f},
-std::array<float,2>{0.142442554f, 0.578825116f},
-std::array<float,2>{0.659035146f, 0.341534823f},
-std::array<float,2>{0.612144947f, 0.723981321f},
-std::array<float,2>{0.0156080583f, 0.493711263f},
-std::array<float,2>{0.359451503f, 0.975305796f},
-std::array<float,2>{0.780167878f, 0.197155923f},
-std::array<float,2>{0.588454187f, 0.999949992f},
-std::array<float,2>{0.0392880291f, 0.217431799f},
-std::array<float,2>{0.324787378f, 0.746582747f},
-std::array<float,2>{0.808756411f, 0.477166414f},
-std::array<float,2>{0.928916216f, 0.577244997f},
-std::array<float,2>{0.416928589f, 0.315503299f},
-std::array<float,2>{0.186651722f, 0.86878854f},
-std::array<float,2>{0.636553526f, 0.10067711f},
-std::array<float,2>{0.821464479f, 0.78282088f},
-std::array<float,2>{0.295089394f, 0.0185696092f},
-std::array<float,2>{0.0662693158f, 0.521938145f},
-std::array<float,2>{0.534227133f, 0.25230068f},
-std::array<float,2>{0.693675995f, 0.675712943f},
-std::array<float,2>{0.216910943f, 0.397827953f},
-std::array<float,2>{0.487547487f, 0.925076246f},
-std::array<float,2>{0.980570436f, 0.168845221f},
-std::array<float,2>{0.675479531f, 0.824910164f},
-std::array<float,2>{0.134274378f, 0.0831415057f},
-std::array<float,2>{0.393207043f, 0.623916268f},
-std::array<float,2>{0.895812571f, 0.358979881f},
-std::array<float,2>{0.757647753f, 0.698265433f},
-std::array<float,2>{0.348323315f, 0.439829171f},
-std::array<float,2>{0.0290374719f, 0.947591662f},
-std::array<float,2>{0.603125632f, 0.237477079f},
-std::array<float,2>{0.938806891f, 0.898393631f},
-std::array<float,2>{0.46556434f, 0.138496414f},
-std::array<float,2>{0.248793408f, 0.655935943f},
-std::array<float,2>{0.720323622f, 0.408598125f},
-std::array<float,2>{0.503608227f, 0.557286441f},
-std::array<float,2>{0.10352923f, 0.287673563f},
-std::array<float,2>{0.259006917f, 0.753411591f},
-std::array<float,2>{0.862576962f, 0.0343373083f},
-std::array<float,2>{0.601455092f, 0.864461005f},
-std::array<float,2>{0.0171936322f, 0.105804972f},
-std::array<float,2>{0.355370969f, 0.564526081f},
-std::array<float,2>{0.765509725f, 0.324197173f},
-std::array<float,2>{0.902254522f, 0.735183299f},
-std::array<float,2>{0.39963758f, 0.473932356f},
-std::array<float,2>{0.125158712f, 0.990038693f},
-std::array<float,2>{0.681131601f, 0.205739215f},
-std::array<float,2>{0.867432415f, 0.935764432f},
-std::array<float,2>{0.255281478f, 0.162735626f},
-std::array<float,2>{0.0995082334f, 0.685837388f},
-std::array<float,2>{0.509301424f, 0.400397241f},
-std::array<float,2>{0.728764117f, 0.530531764f},
-std::array<float,2>{0.238151446f, 0.259662837f},
-std::array<float,2>{0.459417611f, 0.789260685f},
-std::array<float,2>{0.948354602f, 0.0236530118f},
-std::array<float,2>{0.629987836f, 0.945148647f},
-std::array<float,2>{0.177485839f, 0.248638764f},
-std::array<float,2>{0.41016081f, 0.690792322f},
-std::array<float,2>{0.931356907f, 0.45016852f},
-std::array<float,2>{0.802631021f, 0.613142312f},
-std::array<float,2>{0.318263859f, 0.347178042f},
-std::array<float,2>{0.034302678f, 0.818048358f},
-std::array<float,2>{0.581214249f, 0.0898770317f},
-std::array<float,2>{0.973991334f, 0.761700273f},
-std::array<float,2>{0.496977687f, 0.0394335017f},
-std::array<float,2>{0.206053302f, 0.554499149f},
-std::array<float,2>{0.696679056f, 0.296226293f},
-std::array<float,2>{0.541164041f, 0.646992922f},
-std::array<float,2>{0.0740507171f, 0.416143537f},
-std::array<float,2>{0.282985568f, 0.905793548f},
-std::array<float,2>{0.817676067f, 0.128980502f},
-std::array<float,2>{0.519188583f, 0.890362322f},
-std::array<float,2>{0.120950066f, 0.153392777f},
-std::array<float,2>{0.280132979f, 0.628439963f},
-std::array<float,2>{0.848006308f, 0.424705535f},
-std::array<float,2>{0.962515831f, 0.534679651f},
-std::array<float,2>{0.450967848f, 0.30317986f},
-std::array<float,2>{0.224372029f, 0.774222255f},
-std::array<float,2>{0.744360566f, 0.0605273545f},
-std::array<float,2>{0.766973615f, 0.83752501f},
-std::array<float,2>{0.371566385f, 0.0764349699f},
-std::array<float,2>{0.00603790022f, 0.600362778f},
-std::array<float,2>{0.622675002f, 0.363413334f},
-std::array<float,2>{0.668359399f, 0.712420881f},
-std::array<float,2>{0.152490422f, 0.465513766f},
-std::array<float,2>{0.381075591f, 0.968107283f},
-std::array<float,2>{0.884088635f, 0.223659799f},
-std::array<float,2>{0.703909576f, 0.803968847f},
-std::array<float,2>{0.187768206f, 0.00490955869f},
-std::array<float,2>{0.469573408f, 0.506563187f},
-std::array<float,2>{0.986081898f, 0.267462373f},
-std::array<float,2>{0.835119128f, 0.670047045f},
-std::array<float,2>{0.301002204f, 0.375557333f},
-std::array<float,2>{0.0914291367f, 0.91741693f},
-std::array<float,2>{0.549040139f, 0.180975422f},
-std::array<float,2>{0.920857608f, 0.977935672f},
-std::array<float,2>{0.427062422f, 0.189937398f},
-std::array<float,2>{0.159832284f, 0.728223085f},
-std::array<float,2>{0.654895663f, 0.487762451f},
-std::array<float,2>{0.566738784f, 0.586265624f},
-std::array<float,2>{0.0606806651f, 0.333926111f},
-std::array<float,2>{0.335526854f, 0.855112731f},
-std::array<float,2>{0.79158783f, 0.11680308f},
-std::array<float,2>{0.544606626f, 0.847909391f},
-std::array<float,2>{0.0752607659f, 0.117736869f},
-std::array<float,2>{0.287819058f, 0.583536625f},
-std::array<float,2>{0.812642872f, 0.339293092f},
-std::array<float,2>{0.971763134f, 0.721766829f},
-std::array<float,2>{0.493220568f, 0.497252762f},
-std::array<float,2>{0.209722117f, 0.969875753f},
-std::array<float,2>{0.70059073f, 0.20188719f},
-std::array<float,2>{0.800175667f, 0.909092069f},
-std::array<float,2>{0.314135671f, 0.172308758f},
-std::array<float,2>{0.0384958312f, 0.661776304f},
-std::array<float,2>{0.582992256f, 0.385747492f},
-std::array<float,2>{0.627512395f, 0.512100458f},
-std::array<float,2>{0.172419026f, 0.278941661f},
-std::array<float,2>{0.409473211f, 0.805887759f},
-std::array<float,2>{0.933970213f, 0.00968974549f},
-std::array<float,2>{0.732645631f, 0.959635973f},
-std::array<float,2>{0.239024475f, 0.228185311f},
-std::array<float,2>{0.456513703f, 0.704917729f},
-std::array<float,2>{0.95197475f, 0.455473602f},
-std::array<float,2>{0.874384761f, 0.608991146f},
-std::array<float,2>{0.25173822f, 0.367215782f},
-std::array<float,2>{0.0952741802f, 0.835858583f},
-std::array<float,2>{0.511745274f, 0.0668930486f},
-std::array<float,2>{0.905252934f, 0.769652307f},
-std::array<float,2>{0.404211134f, 0.0503607169f},
-std::array<float,2>{0.132684588f, 0.540968001f},
-std::array<float,2>{0.685005128f, 0.308574736f},
-std::array<float,2>{0.59637779f, 0.633799672f},
-std::array<float,2>{0.0206956305f, 0.43672806f},
-std::array<float,2>{0.35551393f, 0.88046962f},
-std::array<float,2>{0.759941041f, 0.14327094f},
-std::array<float,2>{0.563643694f, 0.891964674f},
-std::array<float,2>{0.0574957542f, 0.135970071f},
-std::array<float,2>{0.328811109f, 0.651211798f},
-std::array<float,2>{0.793401062f, 0.412168205f},
-std::array<float,2>{0.915458858f, 0.56124121f},
-std::array<float,2>{0.423065543f, 0.284804225f},
-std::array<float,2>{0.160738081f, 0.754926682f},
-std::array<float,2>{0.651964843f, 0.0361796431f},
-std::array<float,2>{0.828754067f, 0.823674023f},
-std::array<float,2>{0.298404396f, 0.081882894f},
-std::array<float,2>{0.088173829f, 0.620842397f},
-std::array<float,2>{0.554302454f, 0.352446705f},
-std::array<float,2>{0.709810615f, 0.700557768f},
-std::array<float,2>{0.19478941f, 0.444791853f},
-std::array<float,2>{0.473087221f, 0.952860177f},
-std::array<float,2>{0.991577208f, 0.240134642f},
-std::array<float,2>{0.667506516f, 0.788334072f},
-std::array<float,2>{0.148948997f, 0.0212047547f},
-std::array<float,2>{0.378467083f, 0.519259155f},
-std::array<float,2>{0.886744916f, 0.255385846f},
-std::array<float,2>{0.7710253f, 0.677849233f},
-std::array<float,2>{0.369914562f, 0.391954929f},
-std::array<float,2>{0.00170269643f, 0.925839245f},
-std::array<float,2>{0.619823813f, 0.166569158f},
-std::array<float,2>{0.968269825f, 0.993908644f},
-std::array<float,2>{0.445391357f, 0.212624833f},
-std::array<float,2>{0.22127609f, 0.744095206f},
-std::array<float,2>{0.748214245f, 0.484053284f},
-std::array<float,2>{0.520987332f, 0.57275933f},
-std::array<float,2>{0.123257838f, 0.318011671f},
-std::array<float,2>{0.27410993f, 0.871668458f},
-std::array<float,2>{0.845428824f, 0.0958698317f},
-std::array<float,2>{0.616617024f, 0.761829972f},
-std::array<float,2>{0.00859485008f, 0.0439379923f},
-std::array<float,2>{0.365138769f, 0.549968958f},
-std::array<float,2>{0.774266005f, 0.290014356f},
-std::array<float,2>{0.875192523f, 0.641376555f},
-std::array<float,2>{0.38584131f, 0.419430554f},
-std::array<float,2>{0.146201938f, 0.902275622f},
-std::array<float,2>{0.661092818f, 0.126768395f},
-std::array<float,2>{0.851986408f, 0.939702868f},
-std::array<float,2>{0.266917318f, 0.243512526f},
-std::array<float,2>{0.115969807f, 0.69180572f},
-std::array<float,2>{0.526891649f, 0.447498262f},
-std::array<float,2>{0.735688984f, 0.615879357f},
-std::array<float,2>{0.233673051f, 0.34766835f},
-std::array<float,2>{0.440643668f, 0.815086544f},
-std::array<float,2>{0.956737638f, 0.0875467509f},
-std::array<float,2>{0.64218086f, 0.9303087f},
-std::array<float,2>{0.171089038f, 0.159242138f},
-std::array<float,2>{0.435083449f, 0.679937899f},
-std::array<float,2>{0.912682116f, 0.404003471f},
-std::array<float,2>{0.783614576f, 0.523934543f},
-std::array<float,2>{0.342729419f, 0.26538226f},
-std::array<float,2>{0.0495283045f, 0.795221746f},
-std::array<float,2>{0.574285388f, 0.0308019761f},
-std::array<float,2>{0.998523831f, 0.862460732f},
-std::array<float,2>{0.484147221f, 0.101793125f},
-std::array<float,2>{0.20301877f, 0.56920594f},
-std::array<float,2>{0.714441359f, 0.327957481f},
-std::array<float,2>{0.56083709f, 0.739922822f},
-std::array<float,2>{0.0785873681f, 0.470945925f},
-std::array<float,2>{0.305936664f, 0.986235797f},
-std::array<float,2>{0.838369071f, 0.208530337f},
-std::array<float,2>{0.50631249f, 0.983486712f},
-std::array<float,2>{0.109153979f, 0.191564783f},
-std::array<float,2>{0.261887133f, 0.7327317f},
-std::array<float,2>{0.864587843f, 0.488323897f},
-std::array<float,2>{0.942841947f, 0.593591928f},
-std::array<float,2>{0.46189183f, 0.328731358f},
-std::array<float,2>{0.246030703f, 0.857372344f},
-std::array<float,2>{0.72361809f, 0.112125494f},
-std::array<float,2>{0.751859665f, 0.797706485f},
-std::array<float,2>{0.344518065f, 0.00311601488f},
-std::array<float,2>{0.0260630604f, 0.50037092f},
-std::array<float,2>{0.60739094f, 0.271304965f},
-std::array<float,2>{0.678068876f, 0.665633619f},
-std::array<float,2>{0.137364879f, 0.381365478f},
-std::array<float,2>{0.397106141f, 0.918327928f},
-std::array<float,2>{0.891263425f, 0.186172828f},
-std::array<float,2>{0.691037357f, 0.843618572f},
-std::array<float,2>{0.212934405f, 0.0716878325f},
-std::array<float,2>{0.490788132f, 0.596159816f},
-std::array<float,2>{0.977690995f, 0.362642646f},
-std::array<float,2>{0.826386333f, 0.716102481f},
-std::array<float,2>{0.29141745f, 0.461162895f},
-std::array<float,2>{0.0665289238f, 0.964148939f},
-std::array<float,2>{0.537066638f, 0.21889101f},
-std::array<float,2>{0.923498273f, 0.885481596f},
-std::array<float,2>{0.41896382f, 0.151592046f},
-std::array<float,2>{0.181709573f, 0.632320225f},
-std::array<float,2>{0.640041649f, 0.428380489f},
-std::array<float,2>{0.59153688f, 0.538464427f},
-std::array<float,2>{0.0455828607f, 0.299869984f},
-std::array<float,2>{0.320892453f, 0.779973745f},
-std::array<float,2>{0.805873096f, 0.0557297692f},
-std::array<float,2>{0.528356194f, 0.808962286f},
-std::array<float,2>{0.112306684f, 0.0131794615f},
-std::array<float,2>{0.271774381f, 0.510753751f},
-std::array<float,2>{0.856621504f, 0.275664598f},
-std::array<float,2>{0.95884788f, 0.659567535f},
-std::array<float,2>{0.441748828f, 0.386799484f},
-std::array<float,2>{0.228354841f, 0.910183668f},
-std::array<float,2>{0.739170611f, 0.179067835f},
-std::array<float,2>{0.778649688f, 0.974496841f},
-std::array<float,2>{0.363068789f, 0.198760763f},
-std::array<float,2>{0.0125414543f, 0.725506246f},
-std::array<float,2>{0.610611796f, 0.495198995f},
-std::array<float,2>{0.656641543f, 0.58114177f},
-std::array<float,2>{0.143489793f, 0.34285289f},
-std::array<float,2>{0.388489455f, 0.845335186f},
-std::array<float,2>{0.882432401f, 0.121659458f},
-std::array<float,2>{0.715266287f, 0.87661618f},
-std::array<float,2>{0.199085474f, 0.146266803f},
-std::array<float,2>{0.478524804f, 0.638853788f},
-std::array<float,2>{0.99328059f, 0.432135224f},
-std::array<float,2>{0.843714952f, 0.543322384f},
-std::array<float,2>{0.310095251f, 0.309555501f},
-std::array<float,2>{0.08215978f, 0.767880917f},
-std::array<float,2>{0.556142092f, 0.0518214293f},
-std::array<float,2>{0.909806967f, 0.830221474f},
-std::array<float,2>{0.429731667f, 0.0650262311f},
-std::array<float,2>{0.167168096f, 0.603682458f},
-std::array<float,2>{0.644691467f, 0.372283101f},
-std::array<float,2>{0.571401119f, 0.709277272f},
-std::array<float,2>{0.0544004925f, 0.460548162f},
-std::array<float,2>{0.336310208f, 0.956973791f},
-std::array<float,2>{0.787403107f, 0.230879709f},
-std::array<float,2>{0.604299724f, 0.947134137f},
-std::array<float,2>{0.0307090972f, 0.234629244f},
-std::array<float,2>{0.349770486f, 0.696548641f},
-std::array<float,2>{0.755408466f, 0.438893527f},
-std::array<float,2>{0.897734046f, 0.622833014f},
-std::array<float,2>{0.392167091f, 0.35695681f},
-std::array<float,2>{0.136638626f, 0.826521158f},
-std::array<float,2>{0.673332155f, 0.0852389485f},
-std::array<float,2>{0.860463202f, 0.751465082f},
-std::array<float,2>{0.260567367f, 0.0329796635f},
-std::array<float,2>{0.103401773f, 0.555143595f},
-std::array<float,2>{0.501245499f, 0.286836892f},
-std::array<float,2>{0.720861197f, 0.653473735f},
-std::array<float,2>{0.247879416f, 0.40755412f},
-std::array<float,2>{0.466804326f, 0.894907176f},
-std::array<float,2>{0.940918684f, 0.138976678f},
-std::array<float,2>{0.63361001f, 0.870850146f},
-std::array<float,2>{0.184431732f, 0.099052459f},
-std::array<float,2>{0.415294379f, 0.574449778f},
-std::array<float,2>{0.92628777f, 0.313023061f},
-std::array<float,2>{0.811308384f, 0.749069452f},
-std::array<float,2>{0.327747315f, 0.479784399f},
-std::array<float,2>{0.0425261743f, 0.996972382f},
-std::array<float,2>{0.586228371f, 0.215440154f},
-std::array<float,2>{0.984308362f, 0.922221184f},
-std::array<float,2>{0.485191077f, 0.171835288f},
-std::array<float,2>{0.215989426f, 0.671883285f},
-std::array<float,2>{0.69151777f, 0.395601034f},
-std::array<float,2>{0.532181501f, 0.521039307f},
-std::array<float,2>{0.062926881f, 0.251200557f},
-std::array<float,2>{0.293334216f, 0.783376932f},
-std::array<float,2>{0.823473811f, 0.0161513537f},
-std::array<float,2>{0.578609943f, 0.818976104f},
-std::array<float,2>{0.0314213522f, 0.0925915316f},
-std::array<float,2>{0.320212662f, 0.610223413f},
-std::array<float,2>{0.804540515f, 0.344974488f},
-std::array<float,2>{0.93344599f, 0.68931514f},
-std::array<float,2>{0.413382947f, 0.452856392f},
-std::array<float,2>{0.179322973f, 0.942250431f},
-std::array<float,2>{0.631346345f, 0.247802794f},
-std::array<float,2>{0.820096493f, 0.902514219f},
-std::array<float,2>{0.284692526f, 0.131770596f},
-std::array<float,2>{0.0720036626f, 0.645524025f},
-std::array<float,2>{0.540363133f, 0.414400846f},
-std::array<float,2>{0.697922111f, 0.551245332f},
-std::array<float,2>{0.20492515f, 0.293813854f},
-std::array<float,2>{0.499920338f, 0.757986426f},
-std::array<float,2>{0.974649549f, 0.0412681028f},
-std::array<float,2>{0.682765603f, 0.991741955f},
-std::array<float,2>{0.128228709f, 0.203243345f},
-std::array<float,2>{0.401878119f, 0.737983286f},
-std::array<float,2>{0.899497926f, 0.476091295f},
-std::array<float,2>{0.762708306f, 0.56301868f},
-std::array<float,2>{0.352014661f, 0.321880102f},
-std::array<float,2>{0.0191194136f, 0.865812778f},
-std::array<float,2>{0.598832786f, 0.10755828f},
-std::array<float,2>{0.94637835f, 0.792427659f},
-std::array<float,2>{0.457681775f, 0.0258106198f},
-std::array<float,2>{0.234809205f, 0.528107464f},
-std::array<float,2>{0.726564527f, 0.260718763f},
-std::array<float,2>{0.511275291f, 0.685127974f},
-std::array<float,2>{0.0998842344f, 0.398876131f},
-std::array<float,2>{0.257629424f, 0.934050262f},
-std::array<float,2>{0.870875776f, 0.160479367f},
-std::array<float,2>{0.547388673f, 0.915632546f},
-std::array<float,2>{0.0920319855f, 0.182491496f},
-std::array<float,2>{0.303654969f, 0.668484271f},
-std::array<float,2>{0.833078742f, 0.37868458f},
-std::array<float,2>{0.986350656f, 0.505556285f},
-std::array<float,2>{0.471417516f, 0.267875612f},
-std::array<float,2>{0.191095352f, 0.801826179f},
-std::array<float,2>{0.706184566f, 0.0075932066f},
-std::array<float,2>{0.79045707f, 0.852811277f},
-std::array<float,2>{0.332308352f, 0.113538481f},
-std::array<float,2>{0.0595242605f, 0.588000238f},
-std::array<float,2>{0.569986284f, 0.334743589f},
-std::array<float,2>{0.65317893f, 0.73022902f},
-std::array<float,2>{0.157064706f, 0.486199081f},
-std::array<float,2>{0.428589165f, 0.979162335f},
-std::array<float,2>{0.918311059f, 0.187875032f},
-std::array<float,2>{0.743774712f, 0.776516378f},
-std::array<float,2>{0.226320446f, 0.0614745617f},
-std::array<float,2>{0.452953577f, 0.531727254f},
-std::array<float,2>{0.964404166f, 0.301078349f},
-std::array<float,2>{0.850032091f, 0.626838982f},
-std::array<float,2>{0.278871f, 0.421952218f},
-std::array<float,2>{0.117440201f, 0.887799978f},
-std::array<float,2>{0.516260386f, 0.155149192f},
-std::array<float,2>{0.886212349f, 0.964871526f},
-std::array<float,2>{0.380666345f, 0.225516453f},
-std::array<float,2>{0.156141058f, 0.714169979f},
-std::array<float,2>{0.669935107f, 0.468554497f},
-std::array<float,2>{0.623771071f, 0.599509656f},
-std::array<float,2>{0.0049563041f, 0.366896212f},
-std::array<float,2>{0.373190552f, 0.83856523f},
-std::array<float,2>{0.768584251f, 0.0748357251f},
-std::array<float,2>{0.553299785f, 0.821154535f},
-std::array<float,2>{0.0893711671f, 0.0790773928f},
-std::array<float,2>{0.297056317f, 0.619111776f},
-std::array<float,2>{0.82995528f, 0.354326129f},
-std::array<float,2>{0.990794182f, 0.702038288f},
-std::array<float,2>{0.474207789f, 0.442326128f},
-std::array<float,2>{0.193808377f, 0.950422227f},
-std::array<float,2>{0.710794449f, 0.240612283f},
-std::array<float,2>{0.793968141f, 0.892862499f},
-std::array<float,2>{0.329700589f, 0.133663788f},
-std::array<float,2>{0.0583836399f, 0.648497224f},
-std::array<float,2>{0.562857091f, 0.410485268f},
-std::array<float,2>{0.650834441f, 0.558833301f},
-std::array<float,2>{0.161729664f, 0.282806456f},
-std::array<float,2>{0.422759503f, 0.756876826f},
-std::array<float,2>{0.914490402f, 0.0371174552f},
-std::array<float,2>{0.749569952f, 0.995409548f},
-std::array<float,2>{0.221778721f, 0.214393839f},
-std::array<float,2>{0.446929216f, 0.744984806f},
-std::array<float,2>{0.966888666f, 0.480582535f},
-std::array<float,2>{0.844633043f, 0.571093857f},
-std::array<float,2>{0.274417281f, 0.320256531f},
-std::array<float,2>{0.124964878f, 0.874970675f},
-std::array<float,2>{0.519667923f, 0.095560953f},
-std::array<float,2>{0.887982309f, 0.787059247f},
-std::array<float,2>{0.377402037f, 0.0216285959f},
-std::array<float,2>{0.150064632f, 0.517150402f},
-std::array<float,2>{0.666016579f, 0.257405579f},
-std::array<float,2>{0.620438874f, 0.677222788f},
-std::array<float,2>{0.000555820821f, 0.39321968f},
-std::array<float,2>{0.370919317f, 0.929396212f},
-std::array<float,2>{0.769538999f, 0.164507136f},
-std::array<float,2>{0.583213985f, 0.908198833f},
-std::array<float,2>{0.0371380113f, 0.17491512f},
-std::array<float,2>{0.313443571f, 0.66269356f},
-std::array<float,2>{0.799305022f, 0.383941233f},
-std::array<float,2>{0.934839785f, 0.514876544f},
-std::array<float,2>{0.408946812f, 0.28097719f},
-std::array<float,2>{0.173198581f, 0.807676733f},
-std::array<float,2>{0.628220141f, 0.0108664082f},
-std::array<float,2>{0.814236939f, 0.850440323f},
-std::array<float,2>{0.28854385f, 0.120615587f},
-std::array<float,2>{0.0746384785f, 0.585905612f},
-std::array<float,2>{0.543206394f, 0.337705642f},
-std::array<float,2>{0.699475348f, 0.719592631f},
-std::array<float,2>{0.210054651f, 0.499480516f},
-std::array<float,2>{0.492675096f, 0.972598433f},
-std::array<float,2>{0.970707834f, 0.199300155f},
-std::array<float,2>{0.684317052f, 0.772107244f},
-std::array<float,2>{0.13140209f, 0.047885485f},
-std::array<float,2>{0.403267622f, 0.541343808f},
-std::array<float,2>{0.905335426f, 0.305069357f},
-std::array<float,2>{0.761105597f, 0.636258602f},
-std::array<float,2>{0.357101679f, 0.435278654f},
-std::array<float,2>{0.0198168457f, 0.882440269f},
-std::array<float,2>{0.597355783f, 0.141179681f},
-std::array<float,2>{0.952224433f, 0.957165599f},
-std::array<float,2>{0.455572665f, 0.230131611f},
-std::array<float,2>{0.239295527f, 0.70674926f},
-std::array<float,2>{0.734314024f, 0.454716951f},
-std::array<float,2>{0.51302582f, 0.607383192f},
-std::array<float,2>{0.0947049111f, 0.370606959f},
-std::array<float,2>{0.250411749f, 0.833906949f},
-std::array<float,2>{0.873977661f, 0.0683672577f},
-std::array<float,2>{0.606038332f, 0.800064862f},
-std::array<float,2>{0.0269271098f, 0.00169339788f},
-std::array<float,2>{0.345312506f, 0.502486706f},
-std::array<float,2>{0.750747323f, 0.273281485f},
-std::array<float,2>{0.891753912f, 0.666820765f},
-std::array<float,2>{0.398205191f, 0.380147666f},
-std::array<float,2>{0.138389364f, 0.91997689f},
-std::array<float,2>{0.679494858f, 0.184121221f},
-std::array<float,2>{0.863459766f, 0.982097507f},
-std::array<float,2>{0.263223171f, 0.193642259f},
-std::array<float,2>{0.10807281f, 0.730968595f},
-std::array<float,2>{0.506895721f, 0.491526544f},
-std::array<float,2>{0.724256814f, 0.59177494f},
-std::array<float,2>{0.24460423f, 0.330154657f},
-std::array<float,2>{0.462303221f, 0.858492494f},
-std::array<float,2>{0.941601038f, 0.110635735f},
-std::array<float,2>{0.63891089f, 0.884228289f},
-std::array<float,2>{0.183565229f, 0.148826018f},
-std::array<float,2>{0.418276489f, 0.62988323f},
-std::array<float,2>{0.922054291f, 0.426147491f},
-std::array<float,2>{0.805061042f, 0.53622216f},
-std::array<float,2>{0.321404338f, 0.297195852f},
-std::array<float,2>{0.0459675118f, 0.777988434f},
-std::array<float,2>{0.590375423f, 0.0570762902f},
-std::array<float,2>{0.976819456f, 0.840197146f},
-std::array<float,2>{0.491265029f, 0.0741403326f},
-std::array<float,2>{0.213870734f, 0.594436288f},
-std::array<float,2>{0.690308928f, 0.359919012f},
-std::array<float,2>{0.535185397f, 0.717086434f},
-std::array<float,2>{0.0679049864f, 0.463092983f},
-std::array<float,2>{0.292057961f, 0.961765409f},
-std::array<float,2>{0.827847362f, 0.222102806f},
-std::array<float,2>{0.526251495f, 0.939275444f},
-std::array<float,2>{0.117071971f, 0.245637998f},
-std::array<float,2>{0.266059548f, 0.693564236f},
-std::array<float,2>{0.853174627f, 0.446711987f},
-std::array<float,2>{0.955095828f, 0.613473952f},
-std::array<float,2>{0.439825833f, 0.350444198f},
-std::array<float,2>{0.233054414f, 0.813360691f},
-std::array<float,2>{0.735140264f, 0.0882045031f},
-std::array<float,2>{0.774778843f, 0.764301896f},
-std::array<float,2>{0.363491029f, 0.0449303091f},
-std::array<float,2>{0.00883235782f, 0.547802925f},
-std::array<float,2>{0.615426242f, 0.29165253f},
-std::array<float,2>{0.66193217f, 0.642690539f},
-std::array<float,2>{0.144550398f, 0.420237899f},
-std::array<float,2>{0.385615468f, 0.898737788f},
-std::array<float,2>{0.876454175f, 0.127466768f},
-std::array<float,2>{0.713826776f, 0.861054182f},
-std::array<float,2>{0.201895654f, 0.10372442f},
-std::array<float,2>{0.482830465f, 0.566457152f},
-std::array<float,2>{0.99963665f, 0.324522316f},
-std::array<float,2>{0.839602888f, 0.740811646f},
-std::array<float,2>{0.305535465f, 0.470197171f},
-std::array<float,2>{0.0794274807f, 0.986390948f},
-std::array<float,2>{0.562484264f, 0.210802749f},
-std::array<float,2>{0.913164318f, 0.932366669f},
-std::array<float,2>{0.433705628f, 0.157623336f},
-std::array<float,2>{0.170406938f, 0.683590472f},
-std::array<float,2>{0.640951514f, 0.405570567f},
-std::array<float,2>{0.576111734f, 0.526024997f},
-std::array<float,2>{0.0501476824f, 0.261850923f},
-std::array<float,2>{0.343388826f, 0.793063223f},
-std::array<float,2>{0.784315825f, 0.0290767364f},
-std::array<float,2>{0.500286043f, 0.75282222f},
-std::array<float,2>{0.10158246f, 0.0340022035f},
-std::array<float,2>{0.261649311f, 0.55777818f},
-std::array<float,2>{0.860271335f, 0.288758934f},
-std::array<float,2>{0.94008708f, 0.654797971f},
-std::array<float,2>{0.468365639f, 0.409602314f},
-std::array<float,2>{0.246909782f, 0.897272825f},
-std::array<float,2>{0.722317278f, 0.136721656f},
-std::array<float,2>{0.754680693f, 0.948337317f},
-std::array<float,2>{0.351019084f, 0.236940533f},
-std::array<float,2>{0.0293724183f, 0.698006332f},
-std::array<float,2>{0.605404913f, 0.440517932f},
-std::array<float,2>{0.672192931f, 0.624367833f},
-std::array<float,2>{0.135100022f, 0.357471973f},
-std::array<float,2>{0.391001016f, 0.82569617f},
-std::array<float,2>{0.896907926f, 0.0825903788f},
-std::array<float,2>{0.692923665f, 0.924373329f},
-std::array<float,2>{0.215127006f, 0.169139072f},
-std::array<float,2>{0.48580429f, 0.674630225f},
-std::array<float,2>{0.983138204f, 0.397442788f},
-std::array<float,2>{0.822701097f, 0.522678137f},
-std::array<float,2>{0.294473678f, 0.253381103f},
-std::array<float,2>{0.0639145449f, 0.782125115f},
-std::array<float,2>{0.532563806f, 0.0180985555f},
-std::array<float,2>{0.927360952f, 0.867239833f},
-std::array<float,2>{0.414199978f, 0.100175731f},
-std::array<float,2>{0.18543236f, 0.576772451f},
-std::array<float,2>{0.633982837f, 0.314827681f},
-std::array<float,2>{0.587703645f, 0.747827709f},
-std::array<float,2>{0.0416814126f, 0.477871507f},
-std::array<float,2>{0.326218635f, 0.998920202f},
-std::array<float,2>{0.811658144f, 0.218048662f},
-std::array<float,2>{0.609592855f, 0.976320624f},
-std::array<float,2>{0.0130514102f, 0.196083084f},
-std::array<float,2>{0.361893624f, 0.723305047f},
-std::array<float,2>{0.778205514f, 0.493054479f},
-std::array<float,2>{0.881325662f, 0.579459786f},
-std::array<float,2>{0.387438506f, 0.340414345f},
-std::array<float,2>{0.143933728f, 0.847200811f},
-std::array<float,2>{0.6575495f, 0.123553321f},
-std::array<float,2>{0.85637486f, 0.812155485f},
-std::array<float,2>{0.273106724f, 0.0143118072f},
-std::array<float,2>{0.111974292f, 0.509433746f},
-std::array<float,2>{0.527777016f, 0.274274737f},
-std::array<float,2>{0.739669204f, 0.657849669f},
-std::array<float,2>{0.226581931f, 0.390496254f},
-std::array<float,2>{0.44282937f, 0.913062632f},
-std::array<float,2>{0.95739311f, 0.176165685f},
-std::array<float,2>{0.646181762f, 0.829827547f},
-std::array<float,2>{0.166898146f, 0.0633553416f},
-std::array<float,2>{0.430882305f, 0.602829814f},
-std::array<float,2>{0.909101069f, 0.373905838f},
-std::array<float,2>{0.788734078f, 0.707377672f},
-std::array<float,2>{0.337688029f, 0.457254469f},
-std::array<float,2>{0.0531444326f, 0.953362644f},
-std::array<float,2>{0.570668101f, 0.23349975f},
-std::array<float,2>{0.992805243f, 0.878811002f},
-std::array<float,2>{0.479787499f, 0.148326561f},
-std::array<float,2>{0.197650462f, 0.637462556f},
-std::array<float,2>{0.71677494f, 0.431148469f},
-std::array<float,2>{0.555473268f, 0.545788348f},
-std::array<float,2>{0.0837685168f, 0.312354118f},
-std::array<float,2>{0.309536219f, 0.766352594f},
-std::array<float,2>{0.842695892f, 0.053723745f},
-std::array<float,2>{0.569271624f, 0.854246378f},
-std::array<float,2>{0.0601875223f, 0.115795597f},
-std::array<float,2>{0.333376765f, 0.587125003f},
-std::array<float,2>{0.789684355f, 0.332976758f},
-std::array<float,2>{0.919126034f, 0.727009535f},
-std::array<float,2>{0.428839028f, 0.486530453f},
-std::array<float,2>{0.157588601f, 0.977096677f},
-std::array<float,2>{0.6540218f, 0.190591022f},
-std::array<float,2>{0.83278656f, 0.916905224f},
-std::array<float,2>{0.304668278f, 0.180385843f},
-std::array<float,2>{0.0932458565f, 0.670981348f},
-std::array<float,2>{0.548401952f, 0.376466036f},
-std::array<float,2>{0.705628753f, 0.507101178f},
-std::array<float,2>{0.189823046f, 0.266253829f},
-std::array<float,2>{0.471868694f, 0.803698719f},
-std::array<float,2>{0.988245904f, 0.00475401431f},
-std::array<float,2>{0.671199858f, 0.967652977f},
-std::array<float,2>{0.154797032f, 0.223280564f},
-std::array<float,2>{0.379807889f, 0.711075485f},
-std::array<float,2>{0.88517499f, 0.466570318f},
-std::array<float,2>{0.767690301f, 0.601467788f},
-std::array<float,2>{0.374234825f, 0.364686757f},
-std::array<float,2>{0.00418914715f, 0.836031199f},
-std::array<float,2>{0.624098241f, 0.0775559247f},
-std::array<float,2>{0.963043094f, 0.775186479f},
-std::array<float,2>{0.451859236f, 0.0590930432f},
-std::array<float,2>{0.224637538f, 0.534097672f},
-std::array<float,2>{0.742684603f, 0.304362148f},
-std::array<float,2>{0.51744771f, 0.627725184f},
-std::array<float,2>{0.11834126f, 0.42527926f},
-std::array<float,2>{0.277635038f, 0.888997436f},
-std::array<float,2>{0.850857913f, 0.15262334f},
-std::array<float,2>{0.539330184f, 0.904788077f},
-std::array<float,2>{0.0709301531f, 0.129985869f},
-std::array<float,2>{0.283291727f, 0.648260713f},
-std::array<float,2>{0.819265604f, 0.417956799f},
-std::array<float,2>{0.976461947f, 0.553675234f},
-std::array<float,2>{0.49862358f, 0.295612693f},
-std::array<float,2>{0.203805327f, 0.760390341f},
-std::array<float,2>{0.699213743f, 0.0400807597f},
-std::array<float,2>{0.802796841f, 0.816839755f},
-std::array<float,2>{0.318941087f, 0.0917271897f},
-std::array<float,2>{0.032270357f, 0.612275064f},
-std::array<float,2>{0.579207361f, 0.345781922f},
-std::array<float,2>{0.632471144f, 0.690223277f},
-std::array<float,2>{0.178020701f, 0.450383544f},
-std::array<float,2>{0.412517041f, 0.943783104f},
-std::array<float,2>{0.931894541f, 0.249089777f},
-std::array<float,2>{0.727647185f, 0.790555894f},
-std::array<float,2>{0.235805154f, 0.0250484776f},
-std::array<float,2>{0.458604306f, 0.529825807f},
-std::array<float,2>{0.945927858f, 0.25803107f},
-std::array<float,2>{0.869141042f, 0.687287927f},
-std::array<float,2>{0.255889088f, 0.402103126f},
-std::array<float,2>{0.101027422f, 0.936879456f},
-std::array<float,2>{0.51002866f, 0.163769975f},
-std::array<float,2>{0.898733556f, 0.988311708f},
-std::array<float,2>{0.401125252f, 0.206984222f},
-std::array<float,2>{0.12788038f, 0.73566705f},
-std::array<float,2>{0.681641221f, 0.47325772f},
-std::array<float,2>{0.597922742f, 0.566295326f},
-std::array<float,2>{0.017928401f, 0.322266757f},
-std::array<float,2>{0.352871209f, 0.863953531f},
-std::array<float,2>{0.762133956f, 0.106593855f},
-std::array<float,2>{0.522573769f, 0.87245518f},
-std::array<float,2>{0.122158587f, 0.0975193381f},
-std::array<float,2>{0.276513249f, 0.574182749f},
-std::array<float,2>{0.847063124f, 0.31723249f},
-std::array<float,2>{0.966122746f, 0.742228329f},
-std::array<float,2>{0.44873184f, 0.482625842f},
-std::array<float,2>{0.218995079f, 0.992843568f},
-std::array<float,2>{0.747175157f, 0.211293325f},
-std::array<float,2>{0.773081183f, 0.927498221f},
-std::array<float,2>{0.36821878f, 0.167547867f},
-std::array<float,2>{0.00231366907f, 0.679153144f},
-std::array<float,2>{0.618167043f, 0.391061336f},
-std::array<float,2>{0.664913774f, 0.518025815f},
-std::array<float,2>{0.151471391f, 0.254716903f},
-std::array<float,2>{0.375769675f, 0.788065732f},
-std::array<float,2>{0.889665902f, 0.0196377859f},
-std::array<float,2>{0.707341909f, 0.951857448f},
-std::array<float,2>{0.191986248f, 0.238706812f},
-std::array<float,2>{0.475498408f, 0.69932723f},
-std::array<float,2>{0.989841402f, 0.443377137f},
-std::array<float,2>{0.831103146f, 0.619777739f},
-std::array<float,2>{0.300287902f, 0.352886766f},
-std::array<float,2>{0.0859748721f, 0.822398365f},
-std::array<float,2>{0.551364005f, 0.080607973f},
-std::array<float,2>{0.917463541f, 0.754099488f},
-std::array<float,2>{0.424429238f, 0.0353664234f},
-std::array<float,2>{0.16268155f, 0.562319696f},
-std::array<float,2>{0.648872793f, 0.283743411f},
-std::array<float,2>{0.566396952f, 0.651949286f},
-std::array<float,2>{0.0556895435f, 0.413658381f},
-std::array<float,2>{0.330585301f, 0.891009331f},
-std::array<float,2>{0.795125961f, 0.134937271f},
-std::array<float,2>{0.593783259f, 0.878914714f},
-std::array<float,2>{0.0222153831f, 0.144174889f},
-std::array<float,2>{0.358043522f, 0.633068979f},
-std::array<float,2>{0.758892298f, 0.435719341f},
-std::array<float,2>{0.903258085f, 0.539609253f},
-std::array<float,2>{0.405309111f, 0.306916654f},
-std::array<float,2>{0.129409462f, 0.771345556f},
-std::array<float,2>{0.686474383f, 0.049060639f},
-std::array<float,2>{0.872907102f, 0.834315777f},
-std::array<float,2>{0.252133876f, 0.0680058748f},
-std::array<float,2>{0.0963517651f, 0.607454121f},
-std::array<float,2>{0.514745712f, 0.368242502f},
-std::array<float,2>{0.732105017f, 0.703771055f},
-std::array<float,2>{0.241246283f, 0.456986606f},
-std::array<float,2>{0.453969747f, 0.96042788f},
-std::array<float,2>{0.950166702f, 0.227393746f},
-std::array<float,2>{0.626021862f, 0.804784596f},
-std::array<float,2>{0.174246922f, 0.00790484808f},
-std::array<float,2>{0.406414419f, 0.513564527f},
-std::array<float,2>{0.935995519f, 0.278222322f},
-std::array<float,2>{0.798826694f, 0.660736859f},
-std::array<float,2>{0.314598471f, 0.385726571f},
-std::array<float,2>{0.0361938179f, 0.909237504f},
-std::array<float,2>{0.585339308f, 0.173393995f},
-std::array<float,2>{0.969215751f, 0.969676137f},
-std::array<float,2>{0.495735466f, 0.202531964f},
-std::array<float,2>{0.207100481f, 0.72148639f},
-std::array<float,2>{0.702391863f, 0.496682614f},
-std::array<float,2>{0.546129048f, 0.582530856f},
-std::array<float,2>{0.0762703493f, 0.337968528f},
-std::array<float,2>{0.285219342f, 0.848839998f},
-std::array<float,2>{0.816161454f, 0.118430555f},
-std::array<float,2>{0.592027724f, 0.780422747f},
-std::array<float,2>{0.0435047932f, 0.0550913773f},
-std::array<float,2>{0.323403716f, 0.537534058f},
-std::array<float,2>{0.80810684f, 0.299744666f},
-std::array<float,2>{0.925081611f, 0.631674409f},
-std::array<float,2>{0.421146572f, 0.428722709f},
-std::array<float,2>{0.18023476f, 0.886125863f},
-std::array<float,2>{0.636874139f, 0.150487363f},
-std::array<float,2>{0.826168597f, 0.963613808f},
-std::array<float,2>{0.289701849f, 0.219750986f},
-std::array<float,2>{0.0700732246f, 0.71548301f},
-std::array<float,2>{0.537340462f, 0.46234715f},
-std::array<float,2>{0.688333154f, 0.597006798f},
-std::array<float,2>{0.212590739f, 0.362280995f},
-std::array<float,2>{0.490025729f, 0.842360854f},
-std::array<float,2>{0.979790211f, 0.0708797872f},
-std::array<float,2>{0.676324606f, 0.919485629f},
-std::array<float,2>{0.140184745f, 0.18731685f},
-std::array<float,2>{0.394635588f, 0.664217174f},
-std::array<float,2>{0.894465208f, 0.382049292f},
-std::array<float,2>{0.753030121f, 0.501500845f},
-std::array<float,2>{0.346658915f, 0.270281553f},
-std::array<float,2>{0.02483771f, 0.798366249f},
-std::array<float,2>{0.609244943f, 0.00267856033f},
-std::array<float,2>{0.94395417f, 0.855815589f},
-std::array<float,2>{0.463883698f, 0.112435065f},
-std::array<float,2>{0.244071588f, 0.59253633f},
-std::array<float,2>{0.726254046f, 0.329984546f},
-std::array<float,2>{0.505471885f, 0.734321952f},
-std::array<float,2>{0.106167041f, 0.489484727f},
-std::array<float,2>{0.264259607f, 0.983093917f},
-std::array<float,2>{0.865501463f, 0.192749754f},
-std::array<float,2>{0.560378075f, 0.984879494f},
-std::array<float,2>{0.0810025483f, 0.2071798f},
-std::array<float,2>{0.308014512f, 0.738523722f},
-std::array<float,2>{0.83661139f, 0.472486556f},
-std::array<float,2>{0.99680692f, 0.569993317f},
-std::array<float,2>{0.480503649f, 0.326531261f},
-std::array<float,2>{0.200620696f, 0.861873269f},
-std::array<float,2>{0.711294055f, 0.103019752f},
-std::array<float,2>{0.78252548f, 0.796555519f},
-std::array<float,2>{0.341671973f, 0.0298061725f},
-std::array<float,2>{0.0479498766f, 0.524659336f},
-std::array<float,2>{0.577884555f, 0.264067471f},
-std::array<float,2>{0.643475652f, 0.680877805f},
-std::array<float,2>{0.169580638f, 0.402450681f},
-std::array<float,2>{0.437478811f, 0.931064725f},
-std::array<float,2>{0.911722898f, 0.158738479f},
-std::array<float,2>{0.736702621f, 0.815621614f},
-std::array<float,2>{0.23068352f, 0.0868727043f},
-std::array<float,2>{0.438198805f, 0.61701417f},
-std::array<float,2>{0.95399195f, 0.34913823f},
-std::array<float,2>{0.854143441f, 0.692961395f},
-std::array<float,2>{0.267923743f, 0.448409915f},
-std::array<float,2>{0.114819303f, 0.940736473f},
-std::array<float,2>{0.52455616f, 0.242801324f},
-std::array<float,2>{0.877584398f, 0.901247919f},
-std::array<float,2>{0.384351999f, 0.125455052f},
-std::array<float,2>{0.147115216f, 0.641773105f},
-std::array<float,2>{0.662599862f, 0.418231428f},
-std::array<float,2>{0.613515019f, 0.54942596f},
-std::array<float,2>{0.0113810496f, 0.29088667f},
-std::array<float,2>{0.367154986f, 0.763561547f},
-std::array<float,2>{0.77706635f, 0.044202961f},
-std::array<float,2>{0.533363581f, 0.785074234f},
-std::array<float,2>{0.0652678013f, 0.0173779055f},
-std::array<float,2>{0.296308875f, 0.520313144f},
-std::array<float,2>{0.820843101f, 0.250117362f},
-std::array<float,2>{0.982397556f, 0.673235238f},
-std::array<float,2>{0.486372411f, 0.394775838f},
-std::array<float,2>{0.218260393f, 0.923789918f},
-std::array<float,2>{0.694345891f, 0.170026854f},
-std::array<float,2>{0.8095994f, 0.997984111f},
-std::array<float,2>{0.325522602f, 0.216024399f},
-std::array<float,2>{0.0406498127f, 0.748331249f},
-std::array<float,2>{0.58919692f, 0.478915036f},
-std::array<float,2>{0.635182202f, 0.5754776f},
-std::array<float,2>{0.185993493f, 0.314121902f},
-std::array<float,2>{0.41736266f, 0.869235873f},
-std::array<float,2>{0.928263903f, 0.0981382281f},
-std::array<float,2>{0.718807459f, 0.895830572f},
-std::array<float,2>{0.249178246f, 0.139695972f},
-std::array<float,2>{0.466605932f, 0.653217256f},
-std::array<float,2>{0.938079298f, 0.406279773f},
-std::array<float,2>{0.86139977f, 0.555686414f},
-std::array<float,2>{0.258588403f, 0.286001354f},
-std::array<float,2>{0.105058827f, 0.75081563f},
-std::array<float,2>{0.502368808f, 0.0317266546f},
-std::array<float,2>{0.895234287f, 0.827739298f},
-std::array<float,2>{0.393628865f, 0.0840051323f},
-std::array<float,2>{0.132954508f, 0.621334255f},
-std::array<float,2>{0.674537301f, 0.356088221f},
-std::array<float,2>{0.602345467f, 0.695426941f},
-std::array<float,2>{0.0279296152f, 0.438041896f},
-std::array<float,2>{0.348713785f, 0.945912123f},
-std::array<float,2>{0.756079137f, 0.236039683f},
-std::array<float,2>{0.572685897f, 0.955086648f},
-std::array<float,2>{0.0508742817f, 0.231619105f},
-std::array<float,2>{0.33981511f, 0.710431993f},
-std::array<float,2>{0.786977768f, 0.459817529f},
-std::array<float,2>{0.906340718f, 0.604604304f},
-std::array<float,2>{0.433111429f, 0.371826649f},
-std::array<float,2>{0.164281487f, 0.83184582f},
-std::array<float,2>{0.648062885f, 0.0662383288f},
-std::array<float,2>{0.841418684f, 0.769055188f},
-std::array<float,2>{0.311954886f, 0.0516014956f},
-std::array<float,2>{0.0859363899f, 0.544581234f},
-std::array<float,2>{0.557571292f, 0.309624672f},
-std::array<float,2>{0.717940807f, 0.640409291f},
-std::array<float,2>{0.197038114f, 0.432618886f},
-std::array<float,2>{0.477441341f, 0.875576437f},
-std::array<float,2>{0.995659471f, 0.144915819f},
-std::array<float,2>{0.659786344f, 0.844245553f},
-std::array<float,2>{0.141042411f, 0.122646004f},
-std::array<float,2>{0.389046639f, 0.580970824f},
-std::array<float,2>{0.8796525f, 0.342130154f},
-std::array<float,2>{0.780694008f, 0.726062059f},
-std::array<float,2>{0.360890567f, 0.494607151f},
-std::array<float,2>{0.0142538296f, 0.973338544f},
-std::array<float,2>{0.61312151f, 0.19737491f},
-std::array<float,2>{0.959404469f, 0.912008524f},
-std::array<float,2>{0.445078164f, 0.178041726f},
-std::array<float,2>{0.229609996f, 0.65916419f},
-std::array<float,2>{0.741277158f, 0.388232291f},
-std::array<float,2>{0.531071603f, 0.509895027f},
-std::array<float,2>{0.109658666f, 0.276831627f},
-std::array<float,2>{0.270674288f, 0.809923291f},
-std::array<float,2>{0.85904032f, 0.0122195957f},
-std::array<float,2>{0.621523023f, 0.839597046f},
-std::array<float,2>{0.00708226208f, 0.0758631453f},
-std::array<float,2>{0.372781456f, 0.598622203f},
-std::array<float,2>{0.765784681f, 0.365779936f},
-std::array<float,2>{0.883416772f, 0.713467717f},
-std::array<float,2>{0.382676959f, 0.467393368f},
-std::array<float,2>{0.154220179f, 0.966736913f},
-std::array<float,2>{0.669818521f, 0.226286829f},
-std::array<float,2>{0.84915638f, 0.886884093f},
-std::array<float,2>{0.281009316f, 0.156078488f},
-std::array<float,2>{0.120064229f, 0.625681579f},
-std::array<float,2>{0.517617762f, 0.423311085f},
-std::array<float,2>{0.745445967f, 0.532996714f},
-std::array<float,2>{0.223444358f, 0.302213609f},
-std::array<float,2>{0.450159729f, 0.775831461f},
-std::array<float,2>{0.961122215f, 0.0624057688f},
-std::array<float,2>{0.65574795f, 0.980343759f},
-std::array<float,2>{0.15880315f, 0.189197421f},
-std::array<float,2>{0.426146626f, 0.728858411f},
-std::array<float,2>{0.92112571f, 0.484474152f},
-std::array<float,2>{0.792689681f, 0.589127421f},
-std::array<float,2>{0.334592223f, 0.335931689f},
-std::array<float,2>{0.0615858287f, 0.852372348f},
-std::array<float,2>{0.567717433f, 0.114345178f},
-std::array<float,2>{0.985335648f, 0.801137388f},
-std::array<float,2>{0.470193714f, 0.00643922482f},
-std::array<float,2>{0.189321756f, 0.504497945f},
-std::array<float,2>{0.704172254f, 0.269308269f},
-std::array<float,2>{0.550389171f, 0.66931349f},
-std::array<float,2>{0.0905157924f, 0.377505183f},
-std::array<float,2>{0.302342713f, 0.914704442f},
-std::array<float,2>{0.834648728f, 0.183509454f},
-std::array<float,2>{0.508697212f, 0.934929609f},
-std::array<float,2>{0.0984355584f, 0.16148527f},
-std::array<float,2>{0.254201442f, 0.684073269f},
-std::array<float,2>{0.868371248f, 0.399691254f},
-std::array<float,2>{0.947945535f, 0.528711498f},
-std::array<float,2>{0.4604671f, 0.260788023f},
-std::array<float,2>{0.236662328f, 0.791677415f},
-std::array<float,2>{0.730363965f, 0.0269764345f},
-std::array<float,2>{0.76418668f, 0.866907239f},
-std::array<float,2>{0.353871167f, 0.109222919f},
-std::array<float,2>{0.0162531193f, 0.564141631f},
-std::array<float,2>{0.600543439f, 0.321248025f},
-std::array<float,2>{0.680659473f, 0.737031102f},
-std::array<float,2>{0.126838997f, 0.474977136f},
-std::array<float,2>{0.39865768f, 0.991007805f},
-std::array<float,2>{0.90124929f, 0.204381496f},
-std::array<float,2>{0.695774972f, 0.759577096f},
-std::array<float,2>{0.206960499f, 0.0420772098f},
-std::array<float,2>{0.497963101f, 0.552443504f},
-std::array<float,2>{0.972715497f, 0.294380069f},
-std::array<float,2>{0.816731691f, 0.644868553f},
-std::array<float,2>{0.281364799f, 0.415197939f},
-std::array<float,2>{0.0728869587f, 0.904281318f},
-std::array<float,2>{0.542644382f, 0.132677436f},
-std::array<float,2>{0.930447102f, 0.942480922f},
-std::array<float,2>{0.411883324f, 0.246655062f},
-std::array<float,2>{0.176583156f, 0.688289464f},
-std::array<float,2>{0.62951076f, 0.45161283f},
-std::array<float,2>{0.580570281f, 0.610613406f},
-std::array<float,2>{0.0340275541f, 0.344592154f},
-std::array<float,2>{0.317136288f, 0.820062518f},
-std::array<float,2>{0.801415563f, 0.0929472148f}}
\ No newline at end of file
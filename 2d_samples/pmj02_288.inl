@@ -1,4096 +0,0 @@
-{std::array<float,2>{0.938519597f, 0.439441413f},
-std::array<float,2>{0.0707576573f, 0.844665766f},
-std::array<float,2>{0.318652004f, 0.119679138f},
-std::array<float,2>{0.543062091f, 0.672526777f},
-std::array<float,2>{0.670924246f, 0.183200046f},
-std::array<float,2>{0.426387131f, 0.51993221f},
-std::array<float,2>{0.176506728f, 0.363914222f},
-std::array<float,2>{0.790259898f, 0.936067998f},
-std::array<float,2>{0.614103794f, 0.250138104f},
-std::array<float,2>{0.309112996f, 0.999939144f},
-std::array<float,2>{0.0392106399f, 0.19540821f},
-std::array<float,2>{0.886437118f, 0.601747274f},
-std::array<float,2>{0.867835522f, 0.0241204854f},
-std::array<float,2>{0.227266863f, 0.72517848f},
-std::array<float,2>{0.456763685f, 0.391689748f},
-std::array<float,2>{0.729742229f, 0.773531973f},
-std::array<float,2>{0.756762803f, 0.325624198f},
-std::array<float,2>{0.125936955f, 0.875779569f},
-std::array<float,2>{0.379322231f, 0.155664831f},
-std::array<float,2>{0.640971065f, 0.536434531f},
-std::array<float,2>{0.522423863f, 0.0856182426f},
-std::array<float,2>{0.346049249f, 0.634511471f},
-std::array<float,2>{0.11896643f, 0.493880183f},
-std::array<float,2>{0.970656395f, 0.832053065f},
-std::array<float,2>{0.699389577f, 0.430668175f},
-std::array<float,2>{0.497456044f, 0.802584767f},
-std::array<float,2>{0.207660228f, 0.0435182936f},
-std::array<float,2>{0.838392138f, 0.692269504f},
-std::array<float,2>{0.930628479f, 0.236573875f},
-std::array<float,2>{0.0101474253f, 0.578349948f},
-std::array<float,2>{0.262115836f, 0.296281517f},
-std::array<float,2>{0.567991674f, 0.963546872f},
-std::array<float,2>{0.894931614f, 0.302387059f},
-std::array<float,2>{0.0620781481f, 0.945569277f},
-std::array<float,2>{0.283559412f, 0.226947621f},
-std::array<float,2>{0.607986212f, 0.575579286f},
-std::array<float,2>{0.736567616f, 0.0577533394f},
-std::array<float,2>{0.451271534f, 0.708988249f},
-std::array<float,2>{0.235579878f, 0.413557738f},
-std::array<float,2>{0.85875839f, 0.786445737f},
-std::array<float,2>{0.559226215f, 0.469324917f},
-std::array<float,2>{0.332275569f, 0.817023933f},
-std::array<float,2>{0.088726148f, 0.0673944056f},
-std::array<float,2>{0.965314984f, 0.647256434f},
-std::array<float,2>{0.812476218f, 0.130385667f},
-std::array<float,2>{0.157905117f, 0.547207534f},
-std::array<float,2>{0.414580792f, 0.336941808f},
-std::array<float,2>{0.685546339f, 0.898732483f},
-std::array<float,2>{0.822530389f, 0.378532588f},
-std::array<float,2>{0.195889339f, 0.761286795f},
-std::array<float,2>{0.47492668f, 0.0131055415f},
-std::array<float,2>{0.705606163f, 0.745751679f},
-std::array<float,2>{0.58166045f, 0.211715266f},
-std::array<float,2>{0.271721989f, 0.610287964f},
-std::array<float,2>{0.0301846862f, 0.272864968f},
-std::array<float,2>{0.913369477f, 0.97735548f},
-std::array<float,2>{0.635482609f, 0.345786512f},
-std::array<float,2>{0.3973566f, 0.91976881f},
-std::array<float,2>{0.14913924f, 0.161216497f},
-std::array<float,2>{0.778794944f, 0.501413882f},
-std::array<float,2>{0.992401779f, 0.0938585475f},
-std::array<float,2>{0.103392959f, 0.671318114f},
-std::array<float,2>{0.361937732f, 0.462319493f},
-std::array<float,2>{0.511643291f, 0.865123391f},
-std::array<float,2>{0.919133067f, 0.414494425f},
-std::array<float,2>{0.0162288956f, 0.795153499f},
-std::array<float,2>{0.275041819f, 0.0493579581f},
-std::array<float,2>{0.592681289f, 0.714822173f},
-std::array<float,2>{0.711927414f, 0.223777577f},
-std::array<float,2>{0.483617395f, 0.569315195f},
-std::array<float,2>{0.192327946f, 0.310459584f},
-std::array<float,2>{0.820122123f, 0.942913949f},
-std::array<float,2>{0.502791464f, 0.33189714f},
-std::array<float,2>{0.372235894f, 0.896568477f},
-std::array<float,2>{0.10140457f, 0.135511443f},
-std::array<float,2>{0.990020156f, 0.561747491f},
-std::array<float,2>{0.767086565f, 0.073176235f},
-std::array<float,2>{0.143174037f, 0.655142248f},
-std::array<float,2>{0.402972639f, 0.479183882f},
-std::array<float,2>{0.630216599f, 0.823777497f},
-std::array<float,2>{0.850280702f, 0.279023468f},
-std::array<float,2>{0.24848178f, 0.972396195f},
-std::array<float,2>{0.442369401f, 0.207425267f},
-std::array<float,2>{0.744364858f, 0.622400582f},
-std::array<float,2>{0.599305928f, 0.00496497983f},
-std::array<float,2>{0.291197032f, 0.740926445f},
-std::array<float,2>{0.0482766218f, 0.382987738f},
-std::array<float,2>{0.899061084f, 0.753318608f},
-std::array<float,2>{0.674918473f, 0.45579347f},
-std::array<float,2>{0.410685927f, 0.871964872f},
-std::array<float,2>{0.169576481f, 0.104313821f},
-std::array<float,2>{0.80270344f, 0.659165323f},
-std::array<float,2>{0.959996939f, 0.165669054f},
-std::array<float,2>{0.0807599053f, 0.510915756f},
-std::array<float,2>{0.34205249f, 0.358302146f},
-std::array<float,2>{0.547059417f, 0.91159445f},
-std::array<float,2>{0.981094897f, 0.367376596f},
-std::array<float,2>{0.11694698f, 0.922130108f},
-std::array<float,2>{0.351998568f, 0.17770353f},
-std::array<float,2>{0.523451507f, 0.524799407f},
-std::array<float,2>{0.64963311f, 0.113862783f},
-std::array<float,2>{0.385699332f, 0.686961651f},
-std::array<float,2>{0.133441493f, 0.448109299f},
-std::array<float,2>{0.757839561f, 0.858701348f},
-std::array<float,2>{0.571057677f, 0.400655299f},
-std::array<float,2>{0.252258748f, 0.768034339f},
-std::array<float,2>{0.00250818161f, 0.0222379584f},
-std::array<float,2>{0.927587926f, 0.727309167f},
-std::array<float,2>{0.830218911f, 0.191060409f},
-std::array<float,2>{0.211960688f, 0.600164652f},
-std::array<float,2>{0.486081839f, 0.258336961f},
-std::array<float,2>{0.68876338f, 0.985119224f},
-std::array<float,2>{0.78567338f, 0.488476127f},
-std::array<float,2>{0.183062345f, 0.840637982f},
-std::array<float,2>{0.437115908f, 0.0900476947f},
-std::array<float,2>{0.659041524f, 0.628865063f},
-std::array<float,2>{0.532993317f, 0.147445306f},
-std::array<float,2>{0.326514751f, 0.542826355f},
-std::array<float,2>{0.0637243092f, 0.317868978f},
-std::array<float,2>{0.953072906f, 0.883633018f},
-std::array<float,2>{0.720460832f, 0.283621669f},
-std::array<float,2>{0.465480447f, 0.956581533f},
-std::array<float,2>{0.218810424f, 0.24876529f},
-std::array<float,2>{0.865023494f, 0.589056849f},
-std::array<float,2>{0.877700746f, 0.0321933068f},
-std::array<float,2>{0.0375356227f, 0.703101277f},
-std::array<float,2>{0.300673693f, 0.42807129f},
-std::array<float,2>{0.624411106f, 0.808395565f},
-std::array<float,2>{0.888839364f, 0.481940866f},
-std::array<float,2>{0.0443620309f, 0.826065779f},
-std::array<float,2>{0.306471914f, 0.075293541f},
-std::array<float,2>{0.61000222f, 0.650097787f},
-std::array<float,2>{0.732728481f, 0.140266046f},
-std::array<float,2>{0.459525704f, 0.556495368f},
-std::array<float,2>{0.231193438f, 0.334844261f},
-std::array<float,2>{0.873925507f, 0.892026067f},
-std::array<float,2>{0.542156816f, 0.306440085f},
-std::array<float,2>{0.315841198f, 0.940684676f},
-std::array<float,2>{0.0753884614f, 0.221219704f},
-std::array<float,2>{0.943142891f, 0.564136803f},
-std::array<float,2>{0.79313302f, 0.0523856357f},
-std::array<float,2>{0.172780216f, 0.717484534f},
-std::array<float,2>{0.425701737f, 0.421480507f},
-std::array<float,2>{0.664876163f, 0.789673924f},
-std::array<float,2>{0.843421936f, 0.353335768f},
-std::array<float,2>{0.203956202f, 0.906483054f},
-std::array<float,2>{0.493226677f, 0.171219841f},
-std::array<float,2>{0.697872698f, 0.512823522f},
-std::array<float,2>{0.564419627f, 0.106444374f},
-std::array<float,2>{0.260188162f, 0.661612749f},
-std::array<float,2>{0.0124028847f, 0.459740251f},
-std::array<float,2>{0.934859037f, 0.87086606f},
-std::array<float,2>{0.646342695f, 0.386842579f},
-std::array<float,2>{0.375447989f, 0.755956411f},
-std::array<float,2>{0.129420325f, 0.000491056067f},
-std::array<float,2>{0.753204226f, 0.734647751f},
-std::array<float,2>{0.9745996f, 0.205273554f},
-std::array<float,2>{0.122416943f, 0.618694127f},
-std::array<float,2>{0.348199606f, 0.27553001f},
-std::array<float,2>{0.51853174f, 0.975642443f},
-std::array<float,2>{0.962902665f, 0.264422476f},
-std::array<float,2>{0.0916743577f, 0.989520788f},
-std::array<float,2>{0.329670757f, 0.191611454f},
-std::array<float,2>{0.558310509f, 0.597160757f},
-std::array<float,2>{0.681936622f, 0.0164864939f},
-std::array<float,2>{0.419500917f, 0.731924474f},
-std::array<float,2>{0.163089827f, 0.403851002f},
-std::array<float,2>{0.806278467f, 0.769608915f},
-std::array<float,2>{0.603049994f, 0.450616807f},
-std::array<float,2>{0.285652339f, 0.855285048f},
-std::array<float,2>{0.0577712283f, 0.110134646f},
-std::array<float,2>{0.890982091f, 0.681549251f},
-std::array<float,2>{0.852444887f, 0.174778044f},
-std::array<float,2>{0.242106289f, 0.529699981f},
-std::array<float,2>{0.446882516f, 0.374321669f},
-std::array<float,2>{0.738377452f, 0.926036f},
-std::array<float,2>{0.77545321f, 0.425177693f},
-std::array<float,2>{0.15387024f, 0.810228944f},
-std::array<float,2>{0.390750021f, 0.0356610045f},
-std::array<float,2>{0.637333095f, 0.696243942f},
-std::array<float,2>{0.512178898f, 0.244619101f},
-std::array<float,2>{0.367095828f, 0.589902341f},
-std::array<float,2>{0.109043442f, 0.287645936f},
-std::array<float,2>{0.999037623f, 0.958394587f},
-std::array<float,2>{0.709213495f, 0.314730197f},
-std::array<float,2>{0.47132349f, 0.888755798f},
-std::array<float,2>{0.199731216f, 0.142580658f},
-std::array<float,2>{0.824646294f, 0.545960426f},
-std::array<float,2>{0.909034252f, 0.0877654031f},
-std::array<float,2>{0.0260400586f, 0.631791532f},
-std::array<float,2>{0.268664837f, 0.487457633f},
-std::array<float,2>{0.585107565f, 0.839074612f},
-std::array<float,2>{0.985117495f, 0.397446454f},
-std::array<float,2>{0.0946336836f, 0.777898908f},
-std::array<float,2>{0.370840579f, 0.02959463f},
-std::array<float,2>{0.507500768f, 0.718992651f},
-std::array<float,2>{0.625187814f, 0.201670319f},
-std::array<float,2>{0.399068445f, 0.606182694f},
-std::array<float,2>{0.145131201f, 0.257034034f},
-std::array<float,2>{0.770314515f, 0.994892478f},
-std::array<float,2>{0.589123309f, 0.360077679f},
-std::array<float,2>{0.280226737f, 0.933320761f},
-std::array<float,2>{0.0213075727f, 0.186144307f},
-std::array<float,2>{0.915760219f, 0.51715076f},
-std::array<float,2>{0.812989473f, 0.121360771f},
-std::array<float,2>{0.189639375f, 0.679408133f},
-std::array<float,2>{0.478035361f, 0.443953842f},
-std::array<float,2>{0.715469241f, 0.850407839f},
-std::array<float,2>{0.799975455f, 0.292330205f},
-std::array<float,2>{0.166867718f, 0.967832744f},
-std::array<float,2>{0.407354802f, 0.239389554f},
-std::array<float,2>{0.676493526f, 0.583422005f},
-std::array<float,2>{0.553203404f, 0.0399235673f},
-std::array<float,2>{0.337366968f, 0.687527597f},
-std::array<float,2>{0.0836466253f, 0.434176505f},
-std::array<float,2>{0.956018806f, 0.79740417f},
-std::array<float,2>{0.749838531f, 0.49942416f},
-std::array<float,2>{0.441100419f, 0.831720769f},
-std::array<float,2>{0.245274141f, 0.0783267468f},
-std::array<float,2>{0.844672203f, 0.637225688f},
-std::array<float,2>{0.904229879f, 0.151845679f},
-std::array<float,2>{0.0512139536f, 0.533284426f},
-std::array<float,2>{0.296446234f, 0.323840201f},
-std::array<float,2>{0.596820116f, 0.881646514f},
-std::array<float,2>{0.924912512f, 0.340980411f},
-std::array<float,2>{0.00404829299f, 0.906054497f},
-std::array<float,2>{0.257666022f, 0.127544925f},
-std::array<float,2>{0.57644093f, 0.551485538f},
-std::array<float,2>{0.693241477f, 0.0629884377f},
-std::array<float,2>{0.489137292f, 0.643120944f},
-std::array<float,2>{0.217363447f, 0.474923044f},
-std::array<float,2>{0.834406137f, 0.813257158f},
-std::array<float,2>{0.527362823f, 0.406359017f},
-std::array<float,2>{0.358725458f, 0.7836411f},
-std::array<float,2>{0.111882389f, 0.062361829f},
-std::array<float,2>{0.978071868f, 0.703619599f},
-std::array<float,2>{0.764793932f, 0.23423709f},
-std::array<float,2>{0.139276683f, 0.572598577f},
-std::array<float,2>{0.38844195f, 0.298710138f},
-std::array<float,2>{0.653532028f, 0.95070529f},
-std::array<float,2>{0.862747312f, 0.468705684f},
-std::array<float,2>{0.226251155f, 0.862851679f},
-std::array<float,2>{0.464302987f, 0.0993418545f},
-std::array<float,2>{0.724618495f, 0.666998267f},
-std::array<float,2>{0.617648244f, 0.159318224f},
-std::array<float,2>{0.301704496f, 0.505117953f},
-std::array<float,2>{0.0318956189f, 0.350188106f},
-std::array<float,2>{0.881482184f, 0.917491496f},
-std::array<float,2>{0.663389921f, 0.267998636f},
-std::array<float,2>{0.431146234f, 0.984295785f},
-std::array<float,2>{0.187197626f, 0.216708228f},
-std::array<float,2>{0.783671618f, 0.615150869f},
-std::array<float,2>{0.946183085f, 0.0112578981f},
-std::array<float,2>{0.0678268597f, 0.74622947f},
-std::array<float,2>{0.322604775f, 0.38200745f},
-std::array<float,2>{0.538815379f, 0.764882982f},
-std::array<float,2>{0.972082436f, 0.494561166f},
-std::array<float,2>{0.120921597f, 0.83577764f},
-std::array<float,2>{0.34427169f, 0.0828402638f},
-std::array<float,2>{0.520317554f, 0.635040998f},
-std::array<float,2>{0.642671585f, 0.153438747f},
-std::array<float,2>{0.381551921f, 0.537376046f},
-std::array<float,2>{0.127203226f, 0.32663694f},
-std::array<float,2>{0.755840659f, 0.877328336f},
-std::array<float,2>{0.56972301f, 0.294698596f},
-std::array<float,2>{0.264869928f, 0.961534798f},
-std::array<float,2>{0.00796340127f, 0.235150546f},
-std::array<float,2>{0.931816757f, 0.580664515f},
-std::array<float,2>{0.836458147f, 0.0456101485f},
-std::array<float,2>{0.210015908f, 0.694411695f},
-std::array<float,2>{0.499136895f, 0.432541043f},
-std::array<float,2>{0.703074276f, 0.803330898f},
-std::array<float,2>{0.7911731f, 0.366827637f},
-std::array<float,2>{0.179596066f, 0.934932709f},
-std::array<float,2>{0.428334028f, 0.180567071f},
-std::array<float,2>{0.669371367f, 0.521878839f},
-std::array<float,2>{0.545302927f, 0.118135318f},
-std::array<float,2>{0.316414863f, 0.674052715f},
-std::array<float,2>{0.0731378198f, 0.439468026f},
-std::array<float,2>{0.939545572f, 0.847203732f},
-std::array<float,2>{0.727461398f, 0.393099517f},
-std::array<float,2>{0.454931408f, 0.776450515f},
-std::array<float,2>{0.228771597f, 0.0265128072f},
-std::array<float,2>{0.869458675f, 0.724153757f},
-std::array<float,2>{0.884687662f, 0.197489917f},
-std::array<float,2>{0.0419816561f, 0.604783714f},
-std::array<float,2>{0.311060548f, 0.253784269f},
-std::array<float,2>{0.61692512f, 0.997344375f},
-std::array<float,2>{0.910558164f, 0.271361589f},
-std::array<float,2>{0.0276479647f, 0.980404913f},
-std::array<float,2>{0.269747913f, 0.213250637f},
-std::array<float,2>{0.578483403f, 0.611883104f},
-std::array<float,2>{0.703895271f, 0.0147542376f},
-std::array<float,2>{0.474347681f, 0.742487788f},
-std::array<float,2>{0.198690608f, 0.376790613f},
-std::array<float,2>{0.821305752f, 0.758356988f},
-std::array<float,2>{0.507882535f, 0.464831084f},
-std::array<float,2>{0.360858351f, 0.866694033f},
-std::array<float,2>{0.10452839f, 0.0975439996f},
-std::array<float,2>{0.995328665f, 0.669535339f},
-std::array<float,2>{0.780326307f, 0.162614897f},
-std::array<float,2>{0.150407091f, 0.502156675f},
-std::array<float,2>{0.395897359f, 0.345620424f},
-std::array<float,2>{0.633120596f, 0.920752287f},
-std::array<float,2>{0.856602848f, 0.411988795f},
-std::array<float,2>{0.237060443f, 0.788641095f},
-std::array<float,2>{0.449674726f, 0.0552095547f},
-std::array<float,2>{0.734915972f, 0.707935154f},
-std::array<float,2>{0.606998205f, 0.23038882f},
-std::array<float,2>{0.281615287f, 0.577482343f},
-std::array<float,2>{0.0599554814f, 0.303482533f},
-std::array<float,2>{0.898108721f, 0.947800279f},
-std::array<float,2>{0.686534345f, 0.338777393f},
-std::array<float,2>{0.416122675f, 0.901503623f},
-std::array<float,2>{0.158889651f, 0.132798001f},
-std::array<float,2>{0.809063911f, 0.549860299f},
-std::array<float,2>{0.968671739f, 0.0698349327f},
-std::array<float,2>{0.0877692774f, 0.645479739f},
-std::array<float,2>{0.334925592f, 0.470875055f},
-std::array<float,2>{0.561589658f, 0.819349706f},
-std::array<float,2>{0.900541782f, 0.386366218f},
-std::array<float,2>{0.0500863902f, 0.751576602f},
-std::array<float,2>{0.28932932f, 0.00681857252f},
-std::array<float,2>{0.599809051f, 0.739012122f},
-std::array<float,2>{0.742895305f, 0.209822446f},
-std::array<float,2>{0.444052696f, 0.623488665f},
-std::array<float,2>{0.246748343f, 0.279835045f},
-std::array<float,2>{0.849449813f, 0.969152033f},
-std::array<float,2>{0.549960434f, 0.355703175f},
-std::array<float,2>{0.340003788f, 0.913493752f},
-std::array<float,2>{0.0787913799f, 0.167660579f},
-std::array<float,2>{0.958960533f, 0.509707689f},
-std::array<float,2>{0.804132342f, 0.102471016f},
-std::array<float,2>{0.171319231f, 0.656314552f},
-std::array<float,2>{0.413476944f, 0.4537597f},
-std::array<float,2>{0.67251879f, 0.873564839f},
-std::array<float,2>{0.817935526f, 0.311505407f},
-std::array<float,2>{0.195133045f, 0.945056498f},
-std::array<float,2>{0.481574208f, 0.225913569f},
-std::array<float,2>{0.713273585f, 0.566964626f},
-std::array<float,2>{0.591716349f, 0.0482686162f},
-std::array<float,2>{0.276796073f, 0.71227783f},
-std::array<float,2>{0.0187393893f, 0.417303443f},
-std::array<float,2>{0.920762002f, 0.793627441f},
-std::array<float,2>{0.631730318f, 0.478259146f},
-std::array<float,2>{0.404533207f, 0.822169185f},
-std::array<float,2>{0.142453864f, 0.0707851276f},
-std::array<float,2>{0.769448459f, 0.6536327f},
-std::array<float,2>{0.99105072f, 0.134253144f},
-std::array<float,2>{0.0983760357f, 0.560150206f},
-std::array<float,2>{0.374334037f, 0.329282433f},
-std::array<float,2>{0.500194728f, 0.894720316f},
-std::array<float,2>{0.949632704f, 0.320204586f},
-std::array<float,2>{0.0660446361f, 0.885953128f},
-std::array<float,2>{0.324595511f, 0.1457095f},
-std::array<float,2>{0.533799231f, 0.539805412f},
-std::array<float,2>{0.657372773f, 0.0928250104f},
-std::array<float,2>{0.434884459f, 0.625790715f},
-std::array<float,2>{0.180235028f, 0.491440982f},
-std::array<float,2>{0.787575364f, 0.842983007f},
-std::array<float,2>{0.622390866f, 0.426530272f},
-std::array<float,2>{0.297545195f, 0.805349767f},
-std::array<float,2>{0.0363373458f, 0.034558326f},
-std::array<float,2>{0.876633465f, 0.70008409f},
-std::array<float,2>{0.866329134f, 0.246410668f},
-std::array<float,2>{0.222536996f, 0.586766422f},
-std::array<float,2>{0.46869728f, 0.281792939f},
-std::array<float,2>{0.721952498f, 0.954661012f},
-std::array<float,2>{0.761323929f, 0.446988434f},
-std::array<float,2>{0.13514258f, 0.855662405f},
-std::array<float,2>{0.383854955f, 0.116029039f},
-std::array<float,2>{0.651569009f, 0.68453002f},
-std::array<float,2>{0.52655822f, 0.179515243f},
-std::array<float,2>{0.35468626f, 0.525874734f},
-std::array<float,2>{0.113912381f, 0.370699733f},
-std::array<float,2>{0.983782828f, 0.924171269f},
-std::array<float,2>{0.690850079f, 0.260488302f},
-std::array<float,2>{0.487587988f, 0.986485898f},
-std::array<float,2>{0.214573532f, 0.187524602f},
-std::array<float,2>{0.829776585f, 0.599208534f},
-std::array<float,2>{0.928950131f, 0.0201176517f},
-std::array<float,2>{0.000761732343f, 0.730165958f},
-std::array<float,2>{0.251799911f, 0.398818582f},
-std::array<float,2>{0.573122561f, 0.765792847f},
-std::array<float,2>{0.93669492f, 0.458243072f},
-std::array<float,2>{0.0140809854f, 0.868075311f},
-std::array<float,2>{0.259272963f, 0.10899242f},
-std::array<float,2>{0.564588308f, 0.662319183f},
-std::array<float,2>{0.696184158f, 0.168544963f},
-std::array<float,2>{0.495483011f, 0.514349163f},
-std::array<float,2>{0.206639096f, 0.354473382f},
-std::array<float,2>{0.840040684f, 0.909773171f},
-std::array<float,2>{0.517202795f, 0.2750296f},
-std::array<float,2>{0.351546675f, 0.973016858f},
-std::array<float,2>{0.123107672f, 0.204040855f},
-std::array<float,2>{0.976134658f, 0.619638562f},
-std::array<float,2>{0.750577509f, 0.00202799705f},
-std::array<float,2>{0.130927131f, 0.737840116f},
-std::array<float,2>{0.378394872f, 0.389293969f},
-std::array<float,2>{0.648045063f, 0.754170477f},
-std::array<float,2>{0.872558296f, 0.332979143f},
-std::array<float,2>{0.233955473f, 0.89276737f},
-std::array<float,2>{0.458660483f, 0.137275651f},
-std::array<float,2>{0.731862605f, 0.557060003f},
-std::array<float,2>{0.613160253f, 0.0773563683f},
-std::array<float,2>{0.308106929f, 0.650871754f},
-std::array<float,2>{0.0462581366f, 0.483012825f},
-std::array<float,2>{0.88685149f, 0.827558339f},
-std::array<float,2>{0.667478561f, 0.419739634f},
-std::array<float,2>{0.423590004f, 0.7921139f},
-std::array<float,2>{0.175175369f, 0.054553505f},
-std::array<float,2>{0.795715511f, 0.716163635f},
-std::array<float,2>{0.944186568f, 0.220615789f},
-std::array<float,2>{0.0762544274f, 0.565553546f},
-std::array<float,2>{0.313170373f, 0.308303148f},
-std::array<float,2>{0.540016055f, 0.938016951f},
-std::array<float,2>{0.997597456f, 0.286352307f},
-std::array<float,2>{0.107026957f, 0.95930773f},
-std::array<float,2>{0.36334601f, 0.243938938f},
-std::array<float,2>{0.514747024f, 0.593125165f},
-std::array<float,2>{0.638982773f, 0.0372791849f},
-std::array<float,2>{0.394073308f, 0.697646856f},
-std::array<float,2>{0.154700369f, 0.42245388f},
-std::array<float,2>{0.775356889f, 0.811389565f},
-std::array<float,2>{0.582580328f, 0.485491574f},
-std::array<float,2>{0.26600337f, 0.837110341f},
-std::array<float,2>{0.0235345233f, 0.0896965042f},
-std::array<float,2>{0.906564355f, 0.630239725f},
-std::array<float,2>{0.826438963f, 0.141526565f},
-std::array<float,2>{0.201992929f, 0.543623328f},
-std::array<float,2>{0.469503433f, 0.313898802f},
-std::array<float,2>{0.707139969f, 0.887488723f},
-std::array<float,2>{0.807142019f, 0.405749142f},
-std::array<float,2>{0.160922751f, 0.772617102f},
-std::array<float,2>{0.420918137f, 0.0176873375f},
-std::array<float,2>{0.680850804f, 0.732452929f},
-std::array<float,2>{0.55492872f, 0.19430919f},
-std::array<float,2>{0.331336945f, 0.594464302f},
-std::array<float,2>{0.0920405015f, 0.26290977f},
-std::array<float,2>{0.962446213f, 0.990390241f},
-std::array<float,2>{0.741513073f, 0.37132591f},
-std::array<float,2>{0.448677689f, 0.929023087f},
-std::array<float,2>{0.239446685f, 0.173120737f},
-std::array<float,2>{0.855273008f, 0.528996348f},
-std::array<float,2>{0.893001378f, 0.111505039f},
-std::array<float,2>{0.0559489317f, 0.683185756f},
-std::array<float,2>{0.287963152f, 0.452917635f},
-std::array<float,2>{0.604107976f, 0.852286339f},
-std::array<float,2>{0.953949511f, 0.43656373f},
-std::array<float,2>{0.0850094259f, 0.800092757f},
-std::array<float,2>{0.339007586f, 0.0417805649f},
-std::array<float,2>{0.551109552f, 0.690589786f},
-std::array<float,2>{0.678253174f, 0.240243852f},
-std::array<float,2>{0.409425139f, 0.584857583f},
-std::array<float,2>{0.165348873f, 0.289302081f},
-std::array<float,2>{0.796968579f, 0.964844346f},
-std::array<float,2>{0.594955087f, 0.321371853f},
-std::array<float,2>{0.294229448f, 0.878968835f},
-std::array<float,2>{0.0546081886f, 0.150376901f},
-std::array<float,2>{0.905516863f, 0.532961667f},
-std::array<float,2>{0.846750855f, 0.0811406299f},
-std::array<float,2>{0.242592335f, 0.639840186f},
-std::array<float,2>{0.439025074f, 0.497720003f},
-std::array<float,2>{0.747413456f, 0.830000222f},
-std::array<float,2>{0.772665858f, 0.254273206f},
-std::array<float,2>{0.146763802f, 0.992968976f},
-std::array<float,2>{0.401824951f, 0.201142699f},
-std::array<float,2>{0.627506375f, 0.608709991f},
-std::array<float,2>{0.505004406f, 0.0291573051f},
-std::array<float,2>{0.368938595f, 0.72084409f},
-std::array<float,2>{0.0959332064f, 0.396004111f},
-std::array<float,2>{0.987622142f, 0.781070769f},
-std::array<float,2>{0.718075514f, 0.443258137f},
-std::array<float,2>{0.479005516f, 0.849363983f},
-std::array<float,2>{0.188200966f, 0.12306013f},
-std::array<float,2>{0.815072596f, 0.67642808f},
-std::array<float,2>{0.916943789f, 0.18535699f},
-std::array<float,2>{0.0216909219f, 0.518892348f},
-std::array<float,2>{0.279171675f, 0.3613455f},
-std::array<float,2>{0.587861896f, 0.930291891f},
-std::array<float,2>{0.8805933f, 0.349263787f},
-std::array<float,2>{0.0333135575f, 0.914272249f},
-std::array<float,2>{0.303426355f, 0.157299489f},
-std::array<float,2>{0.620887578f, 0.507337749f},
-std::array<float,2>{0.722738683f, 0.100400411f},
-std::array<float,2>{0.461365461f, 0.664258718f},
-std::array<float,2>{0.224579737f, 0.465026915f},
-std::array<float,2>{0.859927654f, 0.860525906f},
-std::array<float,2>{0.535938203f, 0.379307538f},
-std::array<float,2>{0.321872354f, 0.763634562f},
-std::array<float,2>{0.0688025802f, 0.00972421374f},
-std::array<float,2>{0.949095905f, 0.748564959f},
-std::array<float,2>{0.783053517f, 0.217412367f},
-std::array<float,2>{0.185180336f, 0.615279317f},
-std::array<float,2>{0.431949466f, 0.265676051f},
-std::array<float,2>{0.660286784f, 0.982371032f},
-std::array<float,2>{0.833192825f, 0.473930627f},
-std::array<float,2>{0.215778083f, 0.814458966f},
-std::array<float,2>{0.491019547f, 0.0652947798f},
-std::array<float,2>{0.693629503f, 0.641086638f},
-std::array<float,2>{0.575028419f, 0.126743928f},
-std::array<float,2>{0.255759835f, 0.554665804f},
-std::array<float,2>{0.00775648188f, 0.343185186f},
-std::array<float,2>{0.922982454f, 0.90330255f},
-std::array<float,2>{0.655835986f, 0.299354255f},
-std::array<float,2>{0.389354587f, 0.952721715f},
-std::array<float,2>{0.137275755f, 0.23215206f},
-std::array<float,2>{0.762966871f, 0.571722567f},
-std::array<float,2>{0.980142832f, 0.0595010072f},
-std::array<float,2>{0.109426886f, 0.706049144f},
-std::array<float,2>{0.357227892f, 0.408628494f},
-std::array<float,2>{0.530424058f, 0.781474352f},
-std::array<float,2>{0.994579732f, 0.461241901f},
-std::array<float,2>{0.103531085f, 0.863663435f},
-std::array<float,2>{0.360059738f, 0.0949043483f},
-std::array<float,2>{0.509545267f, 0.670825601f},
-std::array<float,2>{0.634521186f, 0.160450175f},
-std::array<float,2>{0.394728005f, 0.500068307f},
-std::array<float,2>{0.152266115f, 0.347566366f},
-std::array<float,2>{0.779334068f, 0.918138266f},
-std::array<float,2>{0.580066621f, 0.271871448f},
-std::array<float,2>{0.270576656f, 0.978001058f},
-std::array<float,2>{0.0289971512f, 0.21201919f},
-std::array<float,2>{0.912079692f, 0.610402644f},
-std::array<float,2>{0.820833623f, 0.0126494681f},
-std::array<float,2>{0.197837889f, 0.744455695f},
-std::array<float,2>{0.472804368f, 0.377049923f},
-std::array<float,2>{0.704281032f, 0.760481954f},
-std::array<float,2>{0.810051322f, 0.335991859f},
-std::array<float,2>{0.15946205f, 0.899678946f},
-std::array<float,2>{0.417834312f, 0.129181623f},
-std::array<float,2>{0.686419249f, 0.548478127f},
-std::array<float,2>{0.560783148f, 0.0668026879f},
-std::array<float,2>{0.335926116f, 0.64817512f},
-std::array<float,2>{0.0867348462f, 0.469810188f},
-std::array<float,2>{0.967401206f, 0.81754595f},
-std::array<float,2>{0.736141443f, 0.41233626f},
-std::array<float,2>{0.4510279f, 0.785336196f},
-std::array<float,2>{0.23765035f, 0.0569813475f},
-std::array<float,2>{0.856375515f, 0.710509241f},
-std::array<float,2>{0.897339702f, 0.227952182f},
-std::array<float,2>{0.0593568459f, 0.574627042f},
-std::array<float,2>{0.282735437f, 0.300792754f},
-std::array<float,2>{0.606268466f, 0.947006345f},
-std::array<float,2>{0.932775795f, 0.295365691f},
-std::array<float,2>{0.00905230362f, 0.964165509f},
-std::array<float,2>{0.26404947f, 0.238068014f},
-std::array<float,2>{0.568737686f, 0.580045462f},
-std::array<float,2>{0.702001393f, 0.0446388647f},
-std::array<float,2>{0.498586446f, 0.693086326f},
-std::array<float,2>{0.209229112f, 0.430121183f},
-std::array<float,2>{0.836975813f, 0.800847292f},
-std::array<float,2>{0.520935833f, 0.492801577f},
-std::array<float,2>{0.344906211f, 0.833532572f},
-std::array<float,2>{0.119723774f, 0.0846836641f},
-std::array<float,2>{0.97081238f, 0.633129597f},
-std::array<float,2>{0.754071176f, 0.154980913f},
-std::array<float,2>{0.128343865f, 0.535780013f},
-std::array<float,2>{0.382806838f, 0.32427901f},
-std::array<float,2>{0.644251823f, 0.876714766f},
-std::array<float,2>{0.870544553f, 0.391282648f},
-std::array<float,2>{0.230041742f, 0.774568558f},
-std::array<float,2>{0.454027027f, 0.025130447f},
-std::array<float,2>{0.72837621f, 0.726288915f},
-std::array<float,2>{0.615717351f, 0.196910024f},
-std::array<float,2>{0.311620116f, 0.603459001f},
-std::array<float,2>{0.0425823852f, 0.251651883f},
-std::array<float,2>{0.883166432f, 0.998561323f},
-std::array<float,2>{0.668152511f, 0.364690185f},
-std::array<float,2>{0.429198056f, 0.937359512f},
-std::array<float,2>{0.17840597f, 0.182329834f},
-std::array<float,2>{0.792060494f, 0.520877182f},
-std::array<float,2>{0.940723896f, 0.12085744f},
-std::array<float,2>{0.0734730735f, 0.673037112f},
-std::array<float,2>{0.317786008f, 0.437849313f},
-std::array<float,2>{0.546368301f, 0.845147192f},
-std::array<float,2>{0.875401497f, 0.429373592f},
-std::array<float,2>{0.0358238891f, 0.807180405f},
-std::array<float,2>{0.29864499f, 0.0323259495f},
-std::array<float,2>{0.621136606f, 0.701764107f},
-std::array<float,2>{0.720982254f, 0.249084994f},
-std::array<float,2>{0.467259794f, 0.588315666f},
-std::array<float,2>{0.221534312f, 0.284338266f},
-std::array<float,2>{0.86536324f, 0.955981553f},
-std::array<float,2>{0.534748912f, 0.316558421f},
-std::array<float,2>{0.325936139f, 0.88393265f},
-std::array<float,2>{0.0646044537f, 0.148232996f},
-std::array<float,2>{0.950933516f, 0.541540086f},
-std::array<float,2>{0.788675666f, 0.0912357494f},
-std::array<float,2>{0.181258127f, 0.627344489f},
-std::array<float,2>{0.433815062f, 0.489575714f},
-std::array<float,2>{0.656795323f, 0.841263831f},
-std::array<float,2>{0.828710794f, 0.259704798f},
-std::array<float,2>{0.2130775f, 0.986015856f},
-std::array<float,2>{0.48635456f, 0.190189779f},
-std::array<float,2>{0.689548492f, 0.601402879f},
-std::array<float,2>{0.573922157f, 0.0226984993f},
-std::array<float,2>{0.250598878f, 0.727588356f},
-std::array<float,2>{0.00189861108f, 0.402196765f},
-std::array<float,2>{0.928568363f, 0.769262791f},
-std::array<float,2>{0.65061152f, 0.448279351f},
-std::array<float,2>{0.383419573f, 0.858229101f},
-std::array<float,2>{0.136344254f, 0.11499045f},
-std::array<float,2>{0.759823918f, 0.686021268f},
-std::array<float,2>{0.983009458f, 0.176027775f},
-std::array<float,2>{0.115171388f, 0.524219871f},
-std::array<float,2>{0.353641093f, 0.369102776f},
-std::array<float,2>{0.526162267f, 0.923238337f},
-std::array<float,2>{0.957239509f, 0.358630002f},
-std::array<float,2>{0.079307735f, 0.910608828f},
-std::array<float,2>{0.341324091f, 0.164145038f},
-std::array<float,2>{0.54917258f, 0.51016742f},
-std::array<float,2>{0.673459888f, 0.105201095f},
-std::array<float,2>{0.412952662f, 0.659242094f},
-std::array<float,2>{0.170642242f, 0.457015008f},
-std::array<float,2>{0.803460538f, 0.872488201f},
-std::array<float,2>{0.601164103f, 0.384124964f},
-std::array<float,2>{0.290280968f, 0.752030969f},
-std::array<float,2>{0.0496354289f, 0.00470238086f},
-std::array<float,2>{0.901713073f, 0.741962194f},
-std::array<float,2>{0.848070383f, 0.208382756f},
-std::array<float,2>{0.24745585f, 0.621135592f},
-std::array<float,2>{0.444514215f, 0.277885139f},
-std::array<float,2>{0.743859291f, 0.971207798f},
-std::array<float,2>{0.768037736f, 0.479542732f},
-std::array<float,2>{0.141262069f, 0.823046327f},
-std::array<float,2>{0.40532133f, 0.0733776763f},
-std::array<float,2>{0.632685661f, 0.655414164f},
-std::array<float,2>{0.501558423f, 0.136368498f},
-std::array<float,2>{0.373134434f, 0.561121106f},
-std::array<float,2>{0.0989283845f, 0.330149502f},
-std::array<float,2>{0.991883814f, 0.898066461f},
-std::array<float,2>{0.714785397f, 0.308747798f},
-std::array<float,2>{0.480488539f, 0.942349315f},
-std::array<float,2>{0.193674862f, 0.223517239f},
-std::array<float,2>{0.816754282f, 0.569776952f},
-std::array<float,2>{0.921741724f, 0.0498187467f},
-std::array<float,2>{0.0180610977f, 0.713523269f},
-std::array<float,2>{0.276033521f, 0.415534794f},
-std::array<float,2>{0.590812683f, 0.79662025f},
-std::array<float,2>{0.907999754f, 0.486783653f},
-std::array<float,2>{0.0252094548f, 0.838766336f},
-std::array<float,2>{0.26726073f, 0.0859427676f},
-std::array<float,2>{0.583723664f, 0.632280469f},
-std::array<float,2>{0.708507538f, 0.144344598f},
-std::array<float,2>{0.470119417f, 0.545507371f},
-std::array<float,2>{0.202429667f, 0.315620124f},
-std::array<float,2>{0.827959597f, 0.890262246f},
-std::array<float,2>{0.514389217f, 0.288578063f},
-std::array<float,2>{0.364408404f, 0.957562029f},
-std::array<float,2>{0.105552256f, 0.245875552f},
-std::array<float,2>{0.996474743f, 0.590942323f},
-std::array<float,2>{0.774291337f, 0.0366169699f},
-std::array<float,2>{0.15562433f, 0.697059333f},
-std::array<float,2>{0.392962068f, 0.42460385f},
-std::array<float,2>{0.640592933f, 0.809352636f},
-std::array<float,2>{0.853775442f, 0.37363404f},
-std::array<float,2>{0.238563776f, 0.927614093f},
-std::array<float,2>{0.447385103f, 0.174817652f},
-std::array<float,2>{0.740275741f, 0.530337036f},
-std::array<float,2>{0.604938507f, 0.111255847f},
-std::array<float,2>{0.288610667f, 0.679721832f},
-std::array<float,2>{0.0552620888f, 0.450012773f},
-std::array<float,2>{0.894112408f, 0.854136467f},
-std::array<float,2>{0.679825306f, 0.402964622f},
-std::array<float,2>{0.420448929f, 0.771122992f},
-std::array<float,2>{0.162036225f, 0.0175085515f},
-std::array<float,2>{0.808153093f, 0.730971575f},
-std::array<float,2>{0.961178124f, 0.192614853f},
-std::array<float,2>{0.0932510272f, 0.596299112f},
-std::array<float,2>{0.330750346f, 0.265534252f},
-std::array<float,2>{0.555704713f, 0.988971233f},
-std::array<float,2>{0.975406051f, 0.277192026f},
-std::array<float,2>{0.124923967f, 0.974653542f},
-std::array<float,2>{0.350565225f, 0.206815749f},
-std::array<float,2>{0.516175926f, 0.617344916f},
-std::array<float,2>{0.647211194f, 0.00120914413f},
-std::array<float,2>{0.377264708f, 0.73587805f},
-std::array<float,2>{0.132069156f, 0.38797617f},
-std::array<float,2>{0.751424551f, 0.75770539f},
-std::array<float,2>{0.566268563f, 0.460527837f},
-std::array<float,2>{0.258019984f, 0.869529307f},
-std::array<float,2>{0.0155520104f, 0.107420608f},
-std::array<float,2>{0.936141431f, 0.660967171f},
-std::array<float,2>{0.840827227f, 0.16997467f},
-std::array<float,2>{0.205610543f, 0.512694001f},
-std::array<float,2>{0.494247407f, 0.351840079f},
-std::array<float,2>{0.696901143f, 0.907244444f},
-std::array<float,2>{0.796145141f, 0.42030105f},
-std::array<float,2>{0.174302444f, 0.790207386f},
-std::array<float,2>{0.422344655f, 0.051730331f},
-std::array<float,2>{0.666843772f, 0.717902601f},
-std::array<float,2>{0.540040374f, 0.222396359f},
-std::array<float,2>{0.313708067f, 0.563281178f},
-std::array<float,2>{0.0778226182f, 0.3050161f},
-std::array<float,2>{0.945012987f, 0.939962029f},
-std::array<float,2>{0.731442988f, 0.335366964f},
-std::array<float,2>{0.4579705f, 0.891051292f},
-std::array<float,2>{0.232651085f, 0.139062136f},
-std::array<float,2>{0.871181428f, 0.554782391f},
-std::array<float,2>{0.888498962f, 0.0747150034f},
-std::array<float,2>{0.0455529615f, 0.648997128f},
-std::array<float,2>{0.306668401f, 0.481050789f},
-std::array<float,2>{0.611473501f, 0.82507807f},
-std::array<float,2>{0.947351694f, 0.381002545f},
-std::array<float,2>{0.070144996f, 0.76398629f},
-std::array<float,2>{0.320346862f, 0.0104999011f},
-std::array<float,2>{0.536499262f, 0.747871935f},
-std::array<float,2>{0.661869287f, 0.215529233f},
-std::array<float,2>{0.433285356f, 0.614255488f},
-std::array<float,2>{0.184394479f, 0.268677264f},
-std::array<float,2>{0.782019794f, 0.982935548f},
-std::array<float,2>{0.619931459f, 0.351378411f},
-std::array<float,2>{0.304638594f, 0.916715682f},
-std::array<float,2>{0.034373641f, 0.158210352f},
-std::array<float,2>{0.879526019f, 0.504565895f},
-std::array<float,2>{0.860837996f, 0.0985605344f},
-std::array<float,2>{0.222820804f, 0.66651535f},
-std::array<float,2>{0.462795675f, 0.467420369f},
-std::array<float,2>{0.723871768f, 0.862083554f},
-std::array<float,2>{0.761936069f, 0.297291875f},
-std::array<float,2>{0.137989044f, 0.949313045f},
-std::array<float,2>{0.390243232f, 0.232584491f},
-std::array<float,2>{0.654912949f, 0.573700428f},
-std::array<float,2>{0.529399991f, 0.0606937632f},
-std::array<float,2>{0.356428802f, 0.704903066f},
-std::array<float,2>{0.110498875f, 0.40734753f},
-std::array<float,2>{0.978818297f, 0.784551919f},
-std::array<float,2>{0.694878757f, 0.476387411f},
-std::array<float,2>{0.492093951f, 0.81390214f},
-std::array<float,2>{0.216736197f, 0.0641331375f},
-std::array<float,2>{0.83234185f, 0.644180775f},
-std::array<float,2>{0.922126591f, 0.12840648f},
-std::array<float,2>{0.00663561421f, 0.551887095f},
-std::array<float,2>{0.254114717f, 0.340415627f},
-std::array<float,2>{0.575830042f, 0.904421628f},
-std::array<float,2>{0.904326975f, 0.323215485f},
-std::array<float,2>{0.0535269566f, 0.882713139f},
-std::array<float,2>{0.293321133f, 0.151336059f},
-std::array<float,2>{0.593929291f, 0.534479201f},
-std::array<float,2>{0.746095002f, 0.0795518458f},
-std::array<float,2>{0.437770069f, 0.637973666f},
-std::array<float,2>{0.243883342f, 0.498834074f},
-std::array<float,2>{0.846369743f, 0.830720663f},
-std::array<float,2>{0.552016795f, 0.435040921f},
-std::array<float,2>{0.338176847f, 0.797857523f},
-std::array<float,2>{0.0843248889f, 0.0409935974f},
-std::array<float,2>{0.954590321f, 0.688500404f},
-std::array<float,2>{0.798422873f, 0.238346502f},
-std::array<float,2>{0.164517209f, 0.582942605f},
-std::array<float,2>{0.408245325f, 0.291447282f},
-std::array<float,2>{0.678785801f, 0.966943324f},
-std::array<float,2>{0.815689385f, 0.444593579f},
-std::array<float,2>{0.189280704f, 0.851208925f},
-std::array<float,2>{0.479954183f, 0.122080199f},
-std::array<float,2>{0.717195034f, 0.678229809f},
-std::array<float,2>{0.586785436f, 0.187369436f},
-std::array<float,2>{0.277638137f, 0.516487241f},
-std::array<float,2>{0.0234347712f, 0.36083746f},
-std::array<float,2>{0.917347431f, 0.932282209f},
-std::array<float,2>{0.62819618f, 0.256828129f},
-std::array<float,2>{0.401280493f, 0.995872855f},
-std::array<float,2>{0.148323387f, 0.203066379f},
-std::array<float,2>{0.772239983f, 0.606985807f},
-std::array<float,2>{0.987250805f, 0.0303807072f},
-std::array<float,2>{0.0966975614f, 0.719916761f},
-std::array<float,2>{0.367901951f, 0.397569627f},
-std::array<float,2>{0.504730582f, 0.778833747f},
-std::array<float,2>{0.966461778f, 0.47254464f},
-std::array<float,2>{0.0890772492f, 0.818952978f},
-std::array<float,2>{0.333821297f, 0.0689595491f},
-std::array<float,2>{0.560317695f, 0.645918489f},
-std::array<float,2>{0.684032321f, 0.131336808f},
-std::array<float,2>{0.415751189f, 0.549583197f},
-std::array<float,2>{0.156338334f, 0.339199394f},
-std::array<float,2>{0.810715735f, 0.901310444f},
-std::array<float,2>{0.609096646f, 0.304562896f},
-std::array<float,2>{0.284460098f, 0.94853282f},
-std::array<float,2>{0.0606287345f, 0.228635103f},
-std::array<float,2>{0.895949662f, 0.57672435f},
-std::array<float,2>{0.857606947f, 0.056365028f},
-std::array<float,2>{0.23440665f, 0.708643556f},
-std::array<float,2>{0.452578694f, 0.410209268f},
-std::array<float,2>{0.737438917f, 0.787277997f},
-std::array<float,2>{0.777503431f, 0.343912929f},
-std::array<float,2>{0.149686441f, 0.921423078f},
-std::array<float,2>{0.398424983f, 0.163482279f},
-std::array<float,2>{0.635819674f, 0.503717005f},
-std::array<float,2>{0.510299504f, 0.0960904658f},
-std::array<float,2>{0.362899661f, 0.668793559f},
-std::array<float,2>{0.102002047f, 0.463402063f},
-std::array<float,2>{0.993713915f, 0.865571916f},
-std::array<float,2>{0.706230104f, 0.375102788f},
-std::array<float,2>{0.475865215f, 0.759113133f},
-std::array<float,2>{0.197024897f, 0.0140934996f},
-std::array<float,2>{0.824142992f, 0.743747652f},
-std::array<float,2>{0.912119985f, 0.214654252f},
-std::array<float,2>{0.0305439457f, 0.612410188f},
-std::array<float,2>{0.273042738f, 0.270400316f},
-std::array<float,2>{0.580673277f, 0.979327321f},
-std::array<float,2>{0.885411203f, 0.252254367f},
-std::array<float,2>{0.0404299013f, 0.996936381f},
-std::array<float,2>{0.310343325f, 0.19918716f},
-std::array<float,2>{0.61473316f, 0.604371905f},
-std::array<float,2>{0.728653193f, 0.0255981758f},
-std::array<float,2>{0.455342889f, 0.72332418f},
-std::array<float,2>{0.227707177f, 0.394055367f},
-std::array<float,2>{0.868943036f, 0.775879383f},
-std::array<float,2>{0.544279695f, 0.44129613f},
-std::array<float,2>{0.319599688f, 0.846357286f},
-std::array<float,2>{0.0715393275f, 0.118707307f},
-std::array<float,2>{0.937826693f, 0.675565779f},
-std::array<float,2>{0.790031552f, 0.181028202f},
-std::array<float,2>{0.177675605f, 0.522888422f},
-std::array<float,2>{0.427719563f, 0.365762264f},
-std::array<float,2>{0.670356154f, 0.934155583f},
-std::array<float,2>{0.839234591f, 0.432846218f},
-std::array<float,2>{0.20898433f, 0.804308414f},
-std::array<float,2>{0.496988237f, 0.0466956161f},
-std::array<float,2>{0.700582743f, 0.693849027f},
-std::array<float,2>{0.566888809f, 0.235619739f},
-std::array<float,2>{0.263437927f, 0.581330001f},
-std::array<float,2>{0.0112602683f, 0.293767005f},
-std::array<float,2>{0.930883229f, 0.962792099f},
-std::array<float,2>{0.641925097f, 0.32786265f},
-std::array<float,2>{0.380672604f, 0.87804991f},
-std::array<float,2>{0.126292616f, 0.152973101f},
-std::array<float,2>{0.757361054f, 0.538982749f},
-std::array<float,2>{0.969423354f, 0.0836556256f},
-std::array<float,2>{0.117948398f, 0.636123717f},
-std::array<float,2>{0.347103626f, 0.495244354f},
-std::array<float,2>{0.523231924f, 0.834742367f},
-std::array<float,2>{0.926158845f, 0.399758369f},
-std::array<float,2>{0.00373894721f, 0.767075658f},
-std::array<float,2>{0.253571033f, 0.0213550534f},
-std::array<float,2>{0.572247386f, 0.729139745f},
-std::array<float,2>{0.687875628f, 0.188743562f},
-std::array<float,2>{0.484886825f, 0.598229945f},
-std::array<float,2>{0.211787283f, 0.260810405f},
-std::array<float,2>{0.831760347f, 0.988093376f},
-std::array<float,2>{0.524507105f, 0.369331032f},
-std::array<float,2>{0.353059143f, 0.925358951f},
-std::array<float,2>{0.116020896f, 0.178450763f},
-std::array<float,2>{0.981838405f, 0.527089357f},
-std::array<float,2>{0.759720802f, 0.116741277f},
-std::array<float,2>{0.134192139f, 0.684733033f},
-std::array<float,2>{0.38609758f, 0.44567728f},
-std::array<float,2>{0.649264574f, 0.857146025f},
-std::array<float,2>{0.86351043f, 0.2825872f},
-std::array<float,2>{0.220067948f, 0.953322887f},
-std::array<float,2>{0.466079533f, 0.24744682f},
-std::array<float,2>{0.719716907f, 0.587238252f},
-std::array<float,2>{0.623401403f, 0.0337661318f},
-std::array<float,2>{0.298941076f, 0.700833321f},
-std::array<float,2>{0.0389790758f, 0.427074522f},
-std::array<float,2>{0.87836045f, 0.806074739f},
-std::array<float,2>{0.659553528f, 0.490527093f},
-std::array<float,2>{0.436430126f, 0.841996729f},
-std::array<float,2>{0.182126269f, 0.0921668336f},
-std::array<float,2>{0.786380351f, 0.626643658f},
-std::array<float,2>{0.951818705f, 0.145350218f},
-std::array<float,2>{0.0630422458f, 0.540830076f},
-std::array<float,2>{0.327329814f, 0.318395138f},
-std::array<float,2>{0.531795859f, 0.885044575f},
-std::array<float,2>{0.989118636f, 0.328887075f},
-std::array<float,2>{0.0999552086f, 0.896420538f},
-std::array<float,2>{0.371840209f, 0.13329789f},
-std::array<float,2>{0.503033221f, 0.558683038f},
-std::array<float,2>{0.62943393f, 0.0715234056f},
-std::array<float,2>{0.403668821f, 0.652411282f},
-std::array<float,2>{0.144222349f, 0.476643354f},
-std::array<float,2>{0.766033292f, 0.820552707f},
-std::array<float,2>{0.593584836f, 0.416271716f},
-std::array<float,2>{0.27414915f, 0.794139981f},
-std::array<float,2>{0.0166944358f, 0.0476303101f},
-std::array<float,2>{0.91849041f, 0.711643338f},
-std::array<float,2>{0.819092035f, 0.225085363f},
-std::array<float,2>{0.192795023f, 0.567890048f},
-std::array<float,2>{0.483131319f, 0.311751276f},
-std::array<float,2>{0.711397707f, 0.944327831f},
-std::array<float,2>{0.801196456f, 0.454596996f},
-std::array<float,2>{0.168771461f, 0.874992669f},
-std::array<float,2>{0.411167651f, 0.103141934f},
-std::array<float,2>{0.674117327f, 0.65730989f},
-std::array<float,2>{0.548552334f, 0.166046575f},
-std::array<float,2>{0.343315005f, 0.508600473f},
-std::array<float,2>{0.0817527398f, 0.356661081f},
-std::array<float,2>{0.959004164f, 0.912789643f},
-std::array<float,2>{0.745198607f, 0.280853033f},
-std::array<float,2>{0.44265905f, 0.969825327f},
-std::array<float,2>{0.249992609f, 0.210072115f},
-std::array<float,2>{0.851191103f, 0.624238789f},
-std::array<float,2>{0.899447978f, 0.00745727587f},
-std::array<float,2>{0.0471711829f, 0.73938936f},
-std::array<float,2>{0.292288631f, 0.385556012f},
-std::array<float,2>{0.598057985f, 0.750707746f},
-std::array<float,2>{0.892100394f, 0.451309651f},
-std::array<float,2>{0.0567423776f, 0.852555394f},
-std::array<float,2>{0.28633216f, 0.113079414f},
-std::array<float,2>{0.601673186f, 0.682082534f},
-std::array<float,2>{0.73950398f, 0.172787577f},
-std::array<float,2>{0.44552362f, 0.527487755f},
-std::array<float,2>{0.240981698f, 0.372825742f},
-std::array<float,2>{0.852561295f, 0.928638816f},
-std::array<float,2>{0.55723083f, 0.262084186f},
-std::array<float,2>{0.328554839f, 0.991247833f},
-std::array<float,2>{0.0900598839f, 0.194881111f},
-std::array<float,2>{0.964023292f, 0.59494859f},
-std::array<float,2>{0.804977059f, 0.0189871136f},
-std::array<float,2>{0.162699103f, 0.733615756f},
-std::array<float,2>{0.418324232f, 0.405063331f},
-std::array<float,2>{0.682944834f, 0.771952391f},
-std::array<float,2>{0.825609386f, 0.313231707f},
-std::array<float,2>{0.200977713f, 0.887964666f},
-std::array<float,2>{0.472107947f, 0.142559081f},
-std::array<float,2>{0.710597217f, 0.543953717f},
-std::array<float,2>{0.584875762f, 0.087977767f},
-std::array<float,2>{0.267652869f, 0.629590094f},
-std::array<float,2>{0.0265698601f, 0.484834701f},
-std::array<float,2>{0.909568429f, 0.836528599f},
-std::array<float,2>{0.638035297f, 0.423462093f},
-std::array<float,2>{0.392424077f, 0.812177241f},
-std::array<float,2>{0.153199032f, 0.0384036973f},
-std::array<float,2>{0.777185678f, 0.698569417f},
-std::array<float,2>{0.998160362f, 0.242645249f},
-std::array<float,2>{0.108150832f, 0.592341363f},
-std::array<float,2>{0.365244359f, 0.285860449f},
-std::array<float,2>{0.513377309f, 0.960748553f},
-std::array<float,2>{0.941897929f, 0.306925327f},
-std::array<float,2>{0.0745951012f, 0.938492537f},
-std::array<float,2>{0.315033734f, 0.218942389f},
-std::array<float,2>{0.54176563f, 0.565259695f},
-std::array<float,2>{0.665741622f, 0.0534053631f},
-std::array<float,2>{0.424555272f, 0.7149055f},
-std::array<float,2>{0.173280656f, 0.418450922f},
-std::array<float,2>{0.794504821f, 0.791812539f},
-std::array<float,2>{0.610965669f, 0.484302968f},
-std::array<float,2>{0.305394292f, 0.826724648f},
-std::array<float,2>{0.0433318354f, 0.0767530501f},
-std::array<float,2>{0.890328526f, 0.652239442f},
-std::array<float,2>{0.874615073f, 0.138497055f},
-std::array<float,2>{0.232221514f, 0.557973266f},
-std::array<float,2>{0.460467517f, 0.333740503f},
-std::array<float,2>{0.733464956f, 0.894528031f},
-std::array<float,2>{0.752591789f, 0.390065759f},
-std::array<float,2>{0.130406082f, 0.755631208f},
-std::array<float,2>{0.376701057f, 0.00338572194f},
-std::array<float,2>{0.644986808f, 0.737010419f},
-std::array<float,2>{0.519168019f, 0.204725206f},
-std::array<float,2>{0.34918949f, 0.620276928f},
-std::array<float,2>{0.12204241f, 0.273632288f},
-std::array<float,2>{0.972817123f, 0.974311292f},
-std::array<float,2>{0.699193299f, 0.354756862f},
-std::array<float,2>{0.492848188f, 0.908265352f},
-std::array<float,2>{0.204341903f, 0.169426739f},
-std::array<float,2>{0.842050612f, 0.515061855f},
-std::array<float,2>{0.933997869f, 0.107552849f},
-std::array<float,2>{0.0130559271f, 0.663722754f},
-std::array<float,2>{0.261224478f, 0.45748499f},
-std::array<float,2>{0.562619746f, 0.868602157f},
-std::array<float,2>{0.976844728f, 0.409928173f},
-std::array<float,2>{0.112973161f, 0.782526433f},
-std::array<float,2>{0.357608408f, 0.0597740412f},
-std::array<float,2>{0.52920711f, 0.706668675f},
-std::array<float,2>{0.652885139f, 0.230628982f},
-std::array<float,2>{0.387325764f, 0.570342422f},
-std::array<float,2>{0.140261769f, 0.300211489f},
-std::array<float,2>{0.764307559f, 0.951560915f},
-std::array<float,2>{0.577347219f, 0.342762977f},
-std::array<float,2>{0.256344438f, 0.903819382f},
-std::array<float,2>{0.00502061285f, 0.125940204f},
-std::array<float,2>{0.924423873f, 0.553106964f},
-std::array<float,2>{0.835353315f, 0.066281274f},
-std::array<float,2>{0.218449041f, 0.641843677f},
-std::array<float,2>{0.489376396f, 0.47330296f},
-std::array<float,2>{0.692284763f, 0.816189647f},
-std::array<float,2>{0.785030961f, 0.267508596f},
-std::array<float,2>{0.18577309f, 0.980883479f},
-std::array<float,2>{0.430310696f, 0.218380824f},
-std::array<float,2>{0.662880063f, 0.616897047f},
-std::array<float,2>{0.537670553f, 0.00824854895f},
-std::array<float,2>{0.324010938f, 0.749175251f},
-std::array<float,2>{0.0665874109f, 0.380345583f},
-std::array<float,2>{0.946310222f, 0.762491226f},
-std::array<float,2>{0.72600019f, 0.466674447f},
-std::array<float,2>{0.463839829f, 0.859793484f},
-std::array<float,2>{0.225467637f, 0.101021536f},
-std::array<float,2>{0.861508012f, 0.665870786f},
-std::array<float,2>{0.881898522f, 0.15687035f},
-std::array<float,2>{0.0331843086f, 0.506037652f},
-std::array<float,2>{0.302074701f, 0.348221123f},
-std::array<float,2>{0.618308783f, 0.915531456f},
-std::array<float,2>{0.914736509f, 0.362443119f},
-std::array<float,2>{0.0199535619f, 0.930974603f},
-std::array<float,2>{0.280287594f, 0.184095249f},
-std::array<float,2>{0.588052452f, 0.517994165f},
-std::array<float,2>{0.716255963f, 0.124392591f},
-std::array<float,2>{0.477124363f, 0.677553177f},
-std::array<float,2>{0.19075574f, 0.442136168f},
-std::array<float,2>{0.813500762f, 0.847671092f},
-std::array<float,2>{0.506138861f, 0.394989967f},
-std::array<float,2>{0.369187504f, 0.779450059f},
-std::array<float,2>{0.0948854834f, 0.0280805174f},
-std::array<float,2>{0.985643446f, 0.72181803f},
-std::array<float,2>{0.771259248f, 0.199537948f},
-std::array<float,2>{0.146483332f, 0.608018458f},
-std::array<float,2>{0.400327057f, 0.25578177f},
-std::array<float,2>{0.62683934f, 0.99361968f},
-std::array<float,2>{0.844832838f, 0.496982574f},
-std::array<float,2>{0.244171828f, 0.829004109f},
-std::array<float,2>{0.43977958f, 0.0803495422f},
-std::array<float,2>{0.748775542f, 0.638935447f},
-std::array<float,2>{0.5957793f, 0.149129614f},
-std::array<float,2>{0.295762002f, 0.53176403f},
-std::array<float,2>{0.0521191545f, 0.320692956f},
-std::array<float,2>{0.902753294f, 0.880342126f},
-std::array<float,2>{0.676965714f, 0.290469676f},
-std::array<float,2>{0.406303167f, 0.966079295f},
-std::array<float,2>{0.16749689f, 0.241417289f},
-std::array<float,2>{0.799643338f, 0.584991097f},
-std::array<float,2>{0.956873715f, 0.0426139161f},
-std::array<float,2>{0.0829753503f, 0.690062523f},
-std::array<float,2>{0.336646944f, 0.435692012f},
-std::array<float,2>{0.553878665f, 0.799016297f},
-std::array<float,2>{0.959741712f, 0.456437647f},
-std::array<float,2>{0.0813226849f, 0.872688949f},
-std::array<float,2>{0.343036056f, 0.104727864f},
-std::array<float,2>{0.547988534f, 0.659848571f},
-std::array<float,2>{0.674407482f, 0.16470781f},
-std::array<float,2>{0.411841273f, 0.510290146f},
-std::array<float,2>{0.168420672f, 0.358970225f},
-std::array<float,2>{0.801419616f, 0.910794675f},
-std::array<float,2>{0.59861058f, 0.277540773f},
-std::array<float,2>{0.292910367f, 0.970879555f},
-std::array<float,2>{0.0478057489f, 0.208774865f},
-std::array<float,2>{0.900320172f, 0.621861577f},
-std::array<float,2>{0.85062927f, 0.00396873429f},
-std::array<float,2>{0.249039084f, 0.741645217f},
-std::array<float,2>{0.443333924f, 0.384287626f},
-std::array<float,2>{0.74602741f, 0.752453446f},
-std::array<float,2>{0.766397834f, 0.330795407f},
-std::array<float,2>{0.143586591f, 0.897853076f},
-std::array<float,2>{0.403860211f, 0.136212856f},
-std::array<float,2>{0.629257798f, 0.56084913f},
-std::array<float,2>{0.503631115f, 0.0739929676f},
-std::array<float,2>{0.371411532f, 0.656034589f},
-std::array<float,2>{0.100507654f, 0.480381697f},
-std::array<float,2>{0.988572776f, 0.822378993f},
-std::array<float,2>{0.711435497f, 0.415500313f},
-std::array<float,2>{0.48290509f, 0.795914948f},
-std::array<float,2>{0.193217307f, 0.0503940471f},
-std::array<float,2>{0.818766296f, 0.713022292f},
-std::array<float,2>{0.918024659f, 0.2227595f},
-std::array<float,2>{0.0173115395f, 0.570028722f},
-std::array<float,2>{0.273546427f, 0.309215993f},
-std::array<float,2>{0.593170106f, 0.941816568f},
-std::array<float,2>{0.878426015f, 0.28506279f},
-std::array<float,2>{0.0381835774f, 0.955240667f},
-std::array<float,2>{0.29945299f, 0.249766007f},
-std::array<float,2>{0.623754203f, 0.588811576f},
-std::array<float,2>{0.718913019f, 0.0330633409f},
-std::array<float,2>{0.466603398f, 0.701396286f},
-std::array<float,2>{0.220252886f, 0.429120272f},
-std::array<float,2>{0.86416024f, 0.807081103f},
-std::array<float,2>{0.531427085f, 0.490193725f},
-std::array<float,2>{0.327824205f, 0.841717005f},
-std::array<float,2>{0.062707603f, 0.0914078578f},
-std::array<float,2>{0.951486826f, 0.627592444f},
-std::array<float,2>{0.786739945f, 0.147834092f},
-std::array<float,2>{0.182288706f, 0.541331828f},
-std::array<float,2>{0.435793281f, 0.317032248f},
-std::array<float,2>{0.659722924f, 0.884541392f},
-std::array<float,2>{0.831186652f, 0.401626736f},
-std::array<float,2>{0.211183712f, 0.768912554f},
-std::array<float,2>{0.484793901f, 0.0230588205f},
-std::array<float,2>{0.688220322f, 0.728423417f},
-std::array<float,2>{0.571424305f, 0.189732939f},
-std::array<float,2>{0.253351122f, 0.600852489f},
-std::array<float,2>{0.00325824949f, 0.258831382f},
-std::array<float,2>{0.926529109f, 0.985646486f},
-std::array<float,2>{0.648459792f, 0.368168235f},
-std::array<float,2>{0.386480361f, 0.923441589f},
-std::array<float,2>{0.134398431f, 0.176600486f},
-std::array<float,2>{0.758839607f, 0.52392143f},
-std::array<float,2>{0.982337415f, 0.114665598f},
-std::array<float,2>{0.115644999f, 0.686122239f},
-std::array<float,2>{0.352947891f, 0.449155152f},
-std::array<float,2>{0.525227487f, 0.85765326f},
-std::array<float,2>{0.931171179f, 0.43021524f},
-std::array<float,2>{0.0112095168f, 0.80135107f},
-std::array<float,2>{0.263117462f, 0.0440078527f},
-std::array<float,2>{0.567005515f, 0.692740262f},
-std::array<float,2>{0.700804412f, 0.237569898f},
-std::array<float,2>{0.49657774f, 0.579327703f},
-std::array<float,2>{0.208458766f, 0.295661032f},
-std::array<float,2>{0.839411974f, 0.964700997f},
-std::array<float,2>{0.522533178f, 0.324826479f},
-std::array<float,2>{0.347255588f, 0.87599647f},
-std::array<float,2>{0.117230862f, 0.154319063f},
-std::array<float,2>{0.968852639f, 0.535571456f},
-std::array<float,2>{0.756935894f, 0.0843739584f},
-std::array<float,2>{0.126709595f, 0.633723199f},
-std::array<float,2>{0.380013853f, 0.492265612f},
-std::array<float,2>{0.642111659f, 0.833176196f},
-std::array<float,2>{0.868263364f, 0.251204699f},
-std::array<float,2>{0.228462949f, 0.998206139f},
-std::array<float,2>{0.455902517f, 0.196454957f},
-std::array<float,2>{0.729253054f, 0.602921605f},
-std::array<float,2>{0.61522007f, 0.0246379934f},
-std::array<float,2>{0.310040861f, 0.72578156f},
-std::array<float,2>{0.0406959355f, 0.390841037f},
-std::array<float,2>{0.885020494f, 0.775181532f},
-std::array<float,2>{0.670687139f, 0.438038081f},
-std::array<float,2>{0.427103847f, 0.845570922f},
-std::array<float,2>{0.176930219f, 0.120448925f},
-std::array<float,2>{0.789307356f, 0.673392415f},
-std::array<float,2>{0.938347578f, 0.181712687f},
-std::array<float,2>{0.0722031221f, 0.521077871f},
-std::array<float,2>{0.320168644f, 0.365156829f},
-std::array<float,2>{0.544573009f, 0.936792254f},
-std::array<float,2>{0.993288577f, 0.347122461f},
-std::array<float,2>{0.102111124f, 0.918724775f},
-std::array<float,2>{0.362394154f, 0.161123976f},
-std::array<float,2>{0.509940922f, 0.50087285f},
-std::array<float,2>{0.636580825f, 0.0953575596f},
-std::array<float,2>{0.397800505f, 0.670145273f},
-std::array<float,2>{0.150180086f, 0.461478323f},
-std::array<float,2>{0.778050601f, 0.863924265f},
-std::array<float,2>{0.580147743f, 0.377653748f},
-std::array<float,2>{0.272904426f, 0.759766817f},
-std::array<float,2>{0.0311673749f, 0.0121999085f},
-std::array<float,2>{0.912831485f, 0.74498117f},
-std::array<float,2>{0.823435962f, 0.212683365f},
-std::array<float,2>{0.19644706f, 0.61118108f},
-std::array<float,2>{0.476448536f, 0.272081792f},
-std::array<float,2>{0.706680954f, 0.978211045f},
-std::array<float,2>{0.811272919f, 0.470626891f},
-std::array<float,2>{0.156875238f, 0.818271518f},
-std::array<float,2>{0.415388852f, 0.0673417524f},
-std::array<float,2>{0.684462965f, 0.647858083f},
-std::array<float,2>{0.559967875f, 0.129701272f},
-std::array<float,2>{0.33316651f, 0.548253119f},
-std::array<float,2>{0.0898226574f, 0.336750537f},
-std::array<float,2>{0.966119945f, 0.900172114f},
-std::array<float,2>{0.738275588f, 0.301518202f},
-std::array<float,2>{0.452922195f, 0.946419775f},
-std::array<float,2>{0.235133573f, 0.228104547f},
-std::array<float,2>{0.85802561f, 0.575127542f},
-std::array<float,2>{0.896100402f, 0.0574878752f},
-std::array<float,2>{0.0614982359f, 0.71026057f},
-std::array<float,2>{0.284705013f, 0.413022906f},
-std::array<float,2>{0.608630538f, 0.785901845f},
-std::array<float,2>{0.903225839f, 0.498118162f},
-std::array<float,2>{0.0523795299f, 0.830097675f},
-std::array<float,2>{0.295076758f, 0.0799739137f},
-std::array<float,2>{0.59654206f, 0.638661981f},
-std::array<float,2>{0.748474061f, 0.150428221f},
-std::array<float,2>{0.44022271f, 0.534705162f},
-std::array<float,2>{0.244780302f, 0.322484583f},
-std::array<float,2>{0.845510304f, 0.882193983f},
-std::array<float,2>{0.554454207f, 0.291719884f},
-std::array<float,2>{0.335953683f, 0.967765868f},
-std::array<float,2>{0.0822860301f, 0.239227608f},
-std::array<float,2>{0.956472278f, 0.582510352f},
-std::array<float,2>{0.799002945f, 0.0400527455f},
-std::array<float,2>{0.16738154f, 0.689221323f},
-std::array<float,2>{0.406761229f, 0.43519187f},
-std::array<float,2>{0.677673161f, 0.798761785f},
-std::array<float,2>{0.814187467f, 0.361229867f},
-std::array<float,2>{0.191056505f, 0.931937218f},
-std::array<float,2>{0.476933092f, 0.186774909f},
-std::array<float,2>{0.716573417f, 0.515976548f},
-std::array<float,2>{0.588786066f, 0.122866243f},
-std::array<float,2>{0.280771971f, 0.678170443f},
-std::array<float,2>{0.0204728823f, 0.44512096f},
-std::array<float,2>{0.914229035f, 0.850665331f},
-std::array<float,2>{0.626101375f, 0.397972852f},
-std::array<float,2>{0.399527669f, 0.778553367f},
-std::array<float,2>{0.145604834f, 0.0309487414f},
-std::array<float,2>{0.770936072f, 0.720635474f},
-std::array<float,2>{0.986275136f, 0.202276349f},
-std::array<float,2>{0.0956113189f, 0.606707335f},
-std::array<float,2>{0.369974047f, 0.25596261f},
-std::array<float,2>{0.506787956f, 0.995340645f},
-std::array<float,2>{0.947139025f, 0.269346714f},
-std::array<float,2>{0.0669695511f, 0.982455909f},
-std::array<float,2>{0.323420554f, 0.214945003f},
-std::array<float,2>{0.537353694f, 0.613645136f},
-std::array<float,2>{0.662263513f, 0.0101764426f},
-std::array<float,2>{0.429700911f, 0.747155368f},
-std::array<float,2>{0.186103225f, 0.381545126f},
-std::array<float,2>{0.784539819f, 0.764279962f},
-std::array<float,2>{0.618777096f, 0.467264861f},
-std::array<float,2>{0.302667379f, 0.86179781f},
-std::array<float,2>{0.0323302522f, 0.0979578942f},
-std::array<float,2>{0.882520497f, 0.66606307f},
-std::array<float,2>{0.861864328f, 0.15904206f},
-std::array<float,2>{0.224987522f, 0.504081845f},
-std::array<float,2>{0.463161349f, 0.350610495f},
-std::array<float,2>{0.726373971f, 0.916162789f},
-std::array<float,2>{0.764039874f, 0.407783568f},
-std::array<float,2>{0.139815122f, 0.784696996f},
-std::array<float,2>{0.386869699f, 0.061268352f},
-std::array<float,2>{0.652517259f, 0.704360366f},
-std::array<float,2>{0.528680325f, 0.233004168f},
-std::array<float,2>{0.357925534f, 0.574196696f},
-std::array<float,2>{0.11250829f, 0.297779262f},
-std::array<float,2>{0.977470219f, 0.950056553f},
-std::array<float,2>{0.691867709f, 0.340088964f},
-std::array<float,2>{0.489806414f, 0.905014455f},
-std::array<float,2>{0.217849925f, 0.128445864f},
-std::array<float,2>{0.835542738f, 0.552473605f},
-std::array<float,2>{0.924083889f, 0.063690044f},
-std::array<float,2>{0.00574227469f, 0.643657148f},
-std::array<float,2>{0.256755084f, 0.476001382f},
-std::array<float,2>{0.578104496f, 0.814092517f},
-std::array<float,2>{0.973166823f, 0.388603956f},
-std::array<float,2>{0.121319249f, 0.757103324f},
-std::array<float,2>{0.34864381f, 0.00147305988f},
-std::array<float,2>{0.518784881f, 0.73567766f},
-std::array<float,2>{0.645116746f, 0.206449568f},
-std::array<float,2>{0.376078784f, 0.618090928f},
-std::array<float,2>{0.129914984f, 0.276735425f},
-std::array<float,2>{0.752215981f, 0.975175202f},
-std::array<float,2>{0.56316793f, 0.352292717f},
-std::array<float,2>{0.261356384f, 0.907766163f},
-std::array<float,2>{0.0136296786f, 0.170748651f},
-std::array<float,2>{0.934343278f, 0.511761606f},
-std::array<float,2>{0.842603564f, 0.106569663f},
-std::array<float,2>{0.204779372f, 0.660341442f},
-std::array<float,2>{0.49229148f, 0.460059702f},
-std::array<float,2>{0.698244333f, 0.869892299f},
-std::array<float,2>{0.794333339f, 0.305259287f},
-std::array<float,2>{0.17339088f, 0.939934552f},
-std::array<float,2>{0.423983932f, 0.222096309f},
-std::array<float,2>{0.665340304f, 0.562856734f},
-std::array<float,2>{0.541148067f, 0.0511009432f},
-std::array<float,2>{0.314544201f, 0.718565881f},
-std::array<float,2>{0.0748792142f, 0.420569509f},
-std::array<float,2>{0.941606998f, 0.790905356f},
-std::array<float,2>{0.734095335f, 0.480820805f},
-std::array<float,2>{0.46007055f, 0.824623942f},
-std::array<float,2>{0.231623486f, 0.0743967593f},
-std::array<float,2>{0.874258518f, 0.648873925f},
-std::array<float,2>{0.889957964f, 0.139332488f},
-std::array<float,2>{0.0434880964f, 0.555467606f},
-std::array<float,2>{0.304709375f, 0.335715085f},
-std::array<float,2>{0.610526145f, 0.891269624f},
-std::array<float,2>{0.909945369f, 0.315989882f},
-std::array<float,2>{0.0269991141f, 0.889826834f},
-std::array<float,2>{0.268167585f, 0.143892139f},
-std::array<float,2>{0.584357679f, 0.545316815f},
-std::array<float,2>{0.710026741f, 0.0864615738f},
-std::array<float,2>{0.472452462f, 0.632626593f},
-std::array<float,2>{0.200364247f, 0.487165093f},
-std::array<float,2>{0.825811982f, 0.838035285f},
-std::array<float,2>{0.513015151f, 0.424182206f},
-std::array<float,2>{0.366125613f, 0.808712482f},
-std::array<float,2>{0.107566476f, 0.0368114859f},
-std::array<float,2>{0.998827994f, 0.696321368f},
-std::array<float,2>{0.776712596f, 0.245379061f},
-std::array<float,2>{0.152502045f, 0.591447294f},
-std::array<float,2>{0.391850859f, 0.288453788f},
-std::array<float,2>{0.638599932f, 0.957378685f},
-std::array<float,2>{0.853484213f, 0.449296236f},
-std::array<float,2>{0.240376875f, 0.853625953f},
-std::array<float,2>{0.445972294f, 0.110806569f},
-std::array<float,2>{0.739973009f, 0.680345476f},
-std::array<float,2>{0.602187753f, 0.175652683f},
-std::array<float,2>{0.286846697f, 0.530767858f},
-std::array<float,2>{0.0574923269f, 0.37345776f},
-std::array<float,2>{0.89168328f, 0.926797688f},
-std::array<float,2>{0.683504164f, 0.264970124f},
-std::array<float,2>{0.41884014f, 0.988734126f},
-std::array<float,2>{0.16234614f, 0.192988664f},
-std::array<float,2>{0.805212379f, 0.596080661f},
-std::array<float,2>{0.964461565f, 0.0170715563f},
-std::array<float,2>{0.0906434506f, 0.730706394f},
-std::array<float,2>{0.329089969f, 0.40255788f},
-std::array<float,2>{0.556863189f, 0.770584047f},
-std::array<float,2>{0.991415858f, 0.477222681f},
-std::array<float,2>{0.0994522721f, 0.82104373f},
-std::array<float,2>{0.374017805f, 0.0721608028f},
-std::array<float,2>{0.501035333f, 0.652925968f},
-std::array<float,2>{0.631866276f, 0.133370206f},
-std::array<float,2>{0.406022489f, 0.559254646f},
-std::array<float,2>{0.141053766f, 0.328597665f},
-std::array<float,2>{0.768519282f, 0.895972788f},
-std::array<float,2>{0.590331495f, 0.312096328f},
-std::array<float,2>{0.275427163f, 0.943660021f},
-std::array<float,2>{0.0182690714f, 0.225255802f},
-std::array<float,2>{0.921138942f, 0.567401588f},
-std::array<float,2>{0.816995203f, 0.0471083038f},
-std::array<float,2>{0.194243059f, 0.711046994f},
-std::array<float,2>{0.481107026f, 0.416528702f},
-std::array<float,2>{0.714224637f, 0.79475832f},
-std::array<float,2>{0.802795112f, 0.357187539f},
-std::array<float,2>{0.170389414f, 0.912345469f},
-std::array<float,2>{0.412381947f, 0.16679506f},
-std::array<float,2>{0.672869861f, 0.508249342f},
-std::array<float,2>{0.549656153f, 0.102655105f},
-std::array<float,2>{0.341149539f, 0.65800339f},
-std::array<float,2>{0.0797159225f, 0.454413474f},
-std::array<float,2>{0.957729518f, 0.874123454f},
-std::array<float,2>{0.74349165f, 0.385079056f},
-std::array<float,2>{0.444869816f, 0.750468731f},
-std::array<float,2>{0.247593239f, 0.00728141097f},
-std::array<float,2>{0.848471642f, 0.739806354f},
-std::array<float,2>{0.902148306f, 0.210456237f},
-std::array<float,2>{0.0492497385f, 0.624825656f},
-std::array<float,2>{0.290813327f, 0.280625015f},
-std::array<float,2>{0.60092324f, 0.970387757f},
-std::array<float,2>{0.928139985f, 0.26145944f},
-std::array<float,2>{0.00128934137f, 0.987556875f},
-std::array<float,2>{0.250436753f, 0.189194351f},
-std::array<float,2>{0.573500872f, 0.597759366f},
-std::array<float,2>{0.689983428f, 0.0207280777f},
-std::array<float,2>{0.487008214f, 0.728845119f},
-std::array<float,2>{0.213657767f, 0.400351793f},
-std::array<float,2>{0.828570247f, 0.767542601f},
-std::array<float,2>{0.525425315f, 0.445997536f},
-std::array<float,2>{0.354483753f, 0.856680214f},
-std::array<float,2>{0.11432229f, 0.116438515f},
-std::array<float,2>{0.982640445f, 0.685073018f},
-std::array<float,2>{0.760475338f, 0.177763805f},
-std::array<float,2>{0.135766223f, 0.526510298f},
-std::array<float,2>{0.382866502f, 0.36972177f},
-std::array<float,2>{0.650957227f, 0.925234735f},
-std::array<float,2>{0.866134465f, 0.42730394f},
-std::array<float,2>{0.220955923f, 0.806340754f},
-std::array<float,2>{0.467336327f, 0.0333227664f},
-std::array<float,2>{0.721587896f, 0.70046401f},
-std::array<float,2>{0.621729791f, 0.247718811f},
-std::array<float,2>{0.298110694f, 0.587649047f},
-std::array<float,2>{0.0351874977f, 0.283107013f},
-std::array<float,2>{0.875796437f, 0.954069436f},
-std::array<float,2>{0.656494915f, 0.319331497f},
-std::array<float,2>{0.434131175f, 0.885378182f},
-std::array<float,2>{0.181082711f, 0.144646138f},
-std::array<float,2>{0.788260996f, 0.540521979f},
-std::array<float,2>{0.950537026f, 0.0924011543f},
-std::array<float,2>{0.0651031137f, 0.626144767f},
-std::array<float,2>{0.32552585f, 0.491030037f},
-std::array<float,2>{0.534204304f, 0.842753768f},
-std::array<float,2>{0.883347571f, 0.393989891f},
-std::array<float,2>{0.0420784429f, 0.775573492f},
-std::array<float,2>{0.312421948f, 0.0262778942f},
-std::array<float,2>{0.615804434f, 0.723065853f},
-std::array<float,2>{0.727774322f, 0.198527932f},
-std::array<float,2>{0.453351229f, 0.603577614f},
-std::array<float,2>{0.229762182f, 0.252601445f},
-std::array<float,2>{0.870978296f, 0.996394396f},
-std::array<float,2>{0.546473205f, 0.365544826f},
-std::array<float,2>{0.318204761f, 0.933958411f},
-std::array<float,2>{0.0737353489f, 0.181615487f},
-std::array<float,2>{0.941214681f, 0.523011804f},
-std::array<float,2>{0.79270649f, 0.118517831f},
-std::array<float,2>{0.177947104f, 0.675128043f},
-std::array<float,2>{0.429394603f, 0.440600574f},
-std::array<float,2>{0.668848574f, 0.845899642f},
-std::array<float,2>{0.83766216f, 0.292969972f},
-std::array<float,2>{0.209860638f, 0.962015867f},
-std::array<float,2>{0.498188525f, 0.235926628f},
-std::array<float,2>{0.701365173f, 0.581599653f},
-std::array<float,2>{0.568858683f, 0.0463352613f},
-std::array<float,2>{0.264428705f, 0.693818688f},
-std::array<float,2>{0.00963629782f, 0.433504254f},
-std::array<float,2>{0.933131158f, 0.804149151f},
-std::array<float,2>{0.643710911f, 0.495623857f},
-std::array<float,2>{0.382162809f, 0.834235787f},
-std::array<float,2>{0.128505006f, 0.0832823142f},
-std::array<float,2>{0.754593611f, 0.636578262f},
-std::array<float,2>{0.971335292f, 0.152758941f},
-std::array<float,2>{0.119511299f, 0.538308382f},
-std::array<float,2>{0.345643699f, 0.327528059f},
-std::array<float,2>{0.521454632f, 0.878875494f},
-std::array<float,2>{0.967148662f, 0.339832455f},
-std::array<float,2>{0.0859383941f, 0.900496542f},
-std::array<float,2>{0.335087359f, 0.131372213f},
-std::array<float,2>{0.561077952f, 0.549122334f},
-std::array<float,2>{0.685955584f, 0.0688157976f},
-std::array<float,2>{0.417086333f, 0.646213591f},
-std::array<float,2>{0.159741551f, 0.471684068f},
-std::array<float,2>{0.810349643f, 0.818687379f},
-std::array<float,2>{0.605811834f, 0.411110938f},
-std::array<float,2>{0.282659173f, 0.787699223f},
-std::array<float,2>{0.0587408654f, 0.0561463051f},
-std::array<float,2>{0.896750152f, 0.708383203f},
-std::array<float,2>{0.855792284f, 0.229326963f},
-std::array<float,2>{0.237995148f, 0.576175809f},
-std::array<float,2>{0.450400025f, 0.303782403f},
-std::array<float,2>{0.735688865f, 0.948957384f},
-std::array<float,2>{0.77987504f, 0.463030189f},
-std::array<float,2>{0.151425481f, 0.866069198f},
-std::array<float,2>{0.3954539f, 0.0964577645f},
-std::array<float,2>{0.634038687f, 0.668414652f},
-std::array<float,2>{0.509226263f, 0.163868248f},
-std::array<float,2>{0.359711796f, 0.503037155f},
-std::array<float,2>{0.104438111f, 0.34465301f},
-std::array<float,2>{0.994745076f, 0.920975149f},
-std::array<float,2>{0.704837501f, 0.269599974f},
-std::array<float,2>{0.473459899f, 0.978881061f},
-std::array<float,2>{0.197681218f, 0.214000076f},
-std::array<float,2>{0.820353508f, 0.612910926f},
-std::array<float,2>{0.911215544f, 0.0146162072f},
-std::array<float,2>{0.0286841318f, 0.743592918f},
-std::array<float,2>{0.271300465f, 0.3757824f},
-std::array<float,2>{0.579464793f, 0.75973469f},
-std::array<float,2>{0.91776979f, 0.441871703f},
-std::array<float,2>{0.0225427654f, 0.848616898f},
-std::array<float,2>{0.277897894f, 0.12497171f},
-std::array<float,2>{0.586401463f, 0.67681098f},
-std::array<float,2>{0.717680752f, 0.183749661f},
-std::array<float,2>{0.480265766f, 0.51851505f},
-std::array<float,2>{0.188515022f, 0.363113999f},
-std::array<float,2>{0.816378832f, 0.931223571f},
-std::array<float,2>{0.504365683f, 0.255343944f},
-std::array<float,2>{0.367268741f, 0.993792892f},
-std::array<float,2>{0.0975074917f, 0.199810475f},
-std::array<float,2>{0.986415327f, 0.607641637f},
-std::array<float,2>{0.771781683f, 0.0274062753f},
-std::array<float,2>{0.147804543f, 0.722267687f},
-std::array<float,2>{0.400487006f, 0.395078361f},
-std::array<float,2>{0.628837526f, 0.779824257f},
-std::array<float,2>{0.846079111f, 0.320847601f},
-std::array<float,2>{0.243503854f, 0.880714834f},
-std::array<float,2>{0.438356161f, 0.148671031f},
-std::array<float,2>{0.746775687f, 0.531513214f},
-std::array<float,2>{0.594391644f, 0.080944255f},
-std::array<float,2>{0.293584496f, 0.639394462f},
-std::array<float,2>{0.0527428128f, 0.49622187f},
-std::array<float,2>{0.904861927f, 0.828218162f},
-std::array<float,2>{0.679390252f, 0.43651554f},
-std::array<float,2>{0.409000725f, 0.799586117f},
-std::array<float,2>{0.164895162f, 0.0421307571f},
-std::array<float,2>{0.798212528f, 0.689640582f},
-std::array<float,2>{0.954296768f, 0.241870552f},
-std::array<float,2>{0.0847909003f, 0.58583951f},
-std::array<float,2>{0.338784993f, 0.290760785f},
-std::array<float,2>{0.552617073f, 0.966734588f},
-std::array<float,2>{0.979458869f, 0.300776333f},
-std::array<float,2>{0.110889927f, 0.951752305f},
-std::array<float,2>{0.355795354f, 0.231246307f},
-std::array<float,2>{0.529845297f, 0.571211338f},
-std::array<float,2>{0.65468967f, 0.0605052747f},
-std::array<float,2>{0.389678001f, 0.706492305f},
-std::array<float,2>{0.138185203f, 0.409233063f},
-std::array<float,2>{0.762355089f, 0.783114672f},
-std::array<float,2>{0.57545507f, 0.472884446f},
-std::array<float,2>{0.254579484f, 0.815745413f},
-std::array<float,2>{0.00590966595f, 0.0654667243f},
-std::array<float,2>{0.92280519f, 0.642208993f},
-std::array<float,2>{0.832594156f, 0.12538369f},
-std::array<float,2>{0.216168061f, 0.553368568f},
-std::array<float,2>{0.491454035f, 0.342092067f},
-std::array<float,2>{0.694490969f, 0.903443098f},
-std::array<float,2>{0.781703651f, 0.380459249f},
-std::array<float,2>{0.183770746f, 0.762091398f},
-std::array<float,2>{0.432952195f, 0.00855523348f},
-std::array<float,2>{0.661325395f, 0.749841332f},
-std::array<float,2>{0.536854625f, 0.218184978f},
-std::array<float,2>{0.321232677f, 0.616592348f},
-std::array<float,2>{0.0695385337f, 0.266968608f},
-std::array<float,2>{0.948167622f, 0.981370568f},
-std::array<float,2>{0.724361598f, 0.347746313f},
-std::array<float,2>{0.461997777f, 0.915313959f},
-std::array<float,2>{0.223467126f, 0.15650706f},
-std::array<float,2>{0.860854089f, 0.506783962f},
-std::array<float,2>{0.879115462f, 0.10126137f},
-std::array<float,2>{0.0348763913f, 0.665334463f},
-std::array<float,2>{0.303789675f, 0.466058731f},
-std::array<float,2>{0.619390428f, 0.859972239f},
-std::array<float,2>{0.94479537f, 0.418729752f},
-std::array<float,2>{0.0773744881f, 0.791469276f},
-std::array<float,2>{0.314093202f, 0.0529452935f},
-std::array<float,2>{0.540667236f, 0.715412557f},
-std::array<float,2>{0.666314125f, 0.219281793f},
-std::array<float,2>{0.422760427f, 0.564866126f},
-std::array<float,2>{0.17439647f, 0.307483792f},
-std::array<float,2>{0.796468377f, 0.939198077f},
-std::array<float,2>{0.611862957f, 0.333391696f},
-std::array<float,2>{0.307592422f, 0.894022286f},
-std::array<float,2>{0.045245491f, 0.137748256f},
-std::array<float,2>{0.887991667f, 0.55828023f},
-std::array<float,2>{0.871970534f, 0.0764204264f},
-std::array<float,2>{0.232991964f, 0.65143472f},
-std::array<float,2>{0.457301855f, 0.483441263f},
-std::array<float,2>{0.730912745f, 0.826403201f},
-std::array<float,2>{0.751649618f, 0.274073541f},
-std::array<float,2>{0.132707983f, 0.973756373f},
-std::array<float,2>{0.377670556f, 0.204534888f},
-std::array<float,2>{0.646766663f, 0.621073425f},
-std::array<float,2>{0.515900493f, 0.00346781523f},
-std::array<float,2>{0.349788398f, 0.736551344f},
-std::array<float,2>{0.124364369f, 0.390529752f},
-std::array<float,2>{0.974660873f, 0.755262375f},
-std::array<float,2>{0.696298897f, 0.457907826f},
-std::array<float,2>{0.494880855f, 0.869082868f},
-std::array<float,2>{0.205200016f, 0.107922718f},
-std::array<float,2>{0.841490984f, 0.663171709f},
-std::array<float,2>{0.935697079f, 0.169472069f},
-std::array<float,2>{0.0147861848f, 0.515508294f},
-std::array<float,2>{0.258629322f, 0.355325133f},
-std::array<float,2>{0.565489531f, 0.908954203f},
-std::array<float,2>{0.894026577f, 0.372546971f},
-std::array<float,2>{0.0551259518f, 0.927887619f},
-std::array<float,2>{0.28846103f, 0.17199786f},
-std::array<float,2>{0.60515821f, 0.528243542f},
-std::array<float,2>{0.740978062f, 0.112446606f},
-std::array<float,2>{0.448147506f, 0.682449162f},
-std::array<float,2>{0.238896281f, 0.452094585f},
-std::array<float,2>{0.854319572f, 0.853228331f},
-std::array<float,2>{0.556173742f, 0.404737711f},
-std::array<float,2>{0.330290556f, 0.771977484f},
-std::array<float,2>{0.0933668241f, 0.019214917f},
-std::array<float,2>{0.961658061f, 0.734195828f},
-std::array<float,2>{0.807644606f, 0.194606304f},
-std::array<float,2>{0.161519736f, 0.595631838f},
-std::array<float,2>{0.420262158f, 0.262545884f},
-std::array<float,2>{0.680210054f, 0.991831958f},
-std::array<float,2>{0.827582836f, 0.485177696f},
-std::array<float,2>{0.202658892f, 0.836304486f},
-std::array<float,2>{0.47068736f, 0.0884839967f},
-std::array<float,2>{0.708186269f, 0.629248142f},
-std::array<float,2>{0.583485365f, 0.141997099f},
-std::array<float,2>{0.266934395f, 0.544919014f},
-std::array<float,2>{0.0247155651f, 0.312958688f},
-std::array<float,2>{0.907414317f, 0.888393342f},
-std::array<float,2>{0.640015543f, 0.285345972f},
-std::array<float,2>{0.393142492f, 0.96036303f},
-std::array<float,2>{0.156165034f, 0.242697969f},
-std::array<float,2>{0.773691356f, 0.591952205f},
-std::array<float,2>{0.996671855f, 0.0389587916f},
-std::array<float,2>{0.106199808f, 0.699183047f},
-std::array<float,2>{0.364945948f, 0.42318967f},
-std::array<float,2>{0.514137626f, 0.811725914f},
-std::array<float,2>{0.984186471f, 0.447736502f},
-std::array<float,2>{0.113325216f, 0.85897857f},
-std::array<float,2>{0.354986787f, 0.113629751f},
-std::array<float,2>{0.527154028f, 0.687339246f},
-std::array<float,2>{0.652336597f, 0.17720896f},
-std::array<float,2>{0.384396762f, 0.52506119f},
-std::array<float,2>{0.135515198f, 0.367926568f},
-std::array<float,2>{0.760884821f, 0.922751546f},
-std::array<float,2>{0.572276056f, 0.258153945f},
-std::array<float,2>{0.251260459f, 0.984410107f},
-std::array<float,2>{0.000113113296f, 0.190750539f},
-std::array<float,2>{0.929214716f, 0.599793494f},
-std::array<float,2>{0.829380035f, 0.0217780881f},
-std::array<float,2>{0.214239195f, 0.726606131f},
-std::array<float,2>{0.487946659f, 0.401176542f},
-std::array<float,2>{0.690966308f, 0.768096745f},
-std::array<float,2>{0.787765443f, 0.31789577f},
-std::array<float,2>{0.179814324f, 0.883199453f},
-std::array<float,2>{0.435350716f, 0.146885008f},
-std::array<float,2>{0.657943368f, 0.542458236f},
-std::array<float,2>{0.533623934f, 0.0903635398f},
-std::array<float,2>{0.324972928f, 0.628229618f},
-std::array<float,2>{0.0658987164f, 0.48915422f},
-std::array<float,2>{0.949785709f, 0.840100944f},
-std::array<float,2>{0.722510874f, 0.428586334f},
-std::array<float,2>{0.468079358f, 0.808057308f},
-std::array<float,2>{0.222142026f, 0.0314077213f},
-std::array<float,2>{0.867093861f, 0.702148795f},
-std::array<float,2>{0.876228094f, 0.248464838f},
-std::array<float,2>{0.0369566232f, 0.589620173f},
-std::array<float,2>{0.297254831f, 0.283735573f},
-std::array<float,2>{0.622574329f, 0.956396639f},
-std::array<float,2>{0.920403838f, 0.309743583f},
-std::array<float,2>{0.019530192f, 0.942622423f},
-std::array<float,2>{0.276919544f, 0.224318981f},
-std::array<float,2>{0.591171205f, 0.568464875f},
-std::array<float,2>{0.713783026f, 0.0489305593f},
-std::array<float,2>{0.482322991f, 0.713924289f},
-std::array<float,2>{0.194390416f, 0.414935321f},
-std::array<float,2>{0.817446351f, 0.795614719f},
-std::array<float,2>{0.500494242f, 0.47895363f},
-std::array<float,2>{0.37464866f, 0.823368609f},
-std::array<float,2>{0.0979681462f, 0.0726451725f},
-std::array<float,2>{0.99063468f, 0.654654503f},
-std::array<float,2>{0.768944085f, 0.13519305f},
-std::array<float,2>{0.141864985f, 0.562084556f},
-std::array<float,2>{0.404962718f, 0.331434339f},
-std::array<float,2>{0.631127715f, 0.897325933f},
-std::array<float,2>{0.848765731f, 0.383395255f},
-std::array<float,2>{0.246131837f, 0.753648937f},
-std::array<float,2>{0.44358179f, 0.00562059134f},
-std::array<float,2>{0.742292166f, 0.740280449f},
-std::array<float,2>{0.600454688f, 0.207901672f},
-std::array<float,2>{0.289826453f, 0.622921526f},
-std::array<float,2>{0.0503923669f, 0.278441995f},
-std::array<float,2>{0.900908291f, 0.971788824f},
-std::array<float,2>{0.672022462f, 0.357433766f},
-std::array<float,2>{0.413918346f, 0.912059367f},
-std::array<float,2>{0.171399206f, 0.165120065f},
-std::array<float,2>{0.80422771f, 0.51125145f},
-std::array<float,2>{0.958347261f, 0.103840545f},
-std::array<float,2>{0.0783449709f, 0.658526123f},
-std::array<float,2>{0.34033367f, 0.455525458f},
-std::array<float,2>{0.550394058f, 0.871321082f},
-std::array<float,2>{0.897534549f, 0.413906157f},
-std::array<float,2>{0.0600822717f, 0.786643505f},
-std::array<float,2>{0.282123119f, 0.0583865345f},
-std::array<float,2>{0.606492519f, 0.709744394f},
-std::array<float,2>{0.734386444f, 0.227094039f},
-std::array<float,2>{0.450105697f, 0.575956464f},
-std::array<float,2>{0.236675605f, 0.301870346f},
-std::array<float,2>{0.856981874f, 0.945885777f},
-std::array<float,2>{0.562014759f, 0.337844461f},
-std::array<float,2>{0.334007591f, 0.898981154f},
-std::array<float,2>{0.0873260498f, 0.130066261f},
-std::array<float,2>{0.967960894f, 0.547616959f},
-std::array<float,2>{0.809476078f, 0.0680773556f},
-std::array<float,2>{0.158387855f, 0.646715045f},
-std::array<float,2>{0.416541278f, 0.468938082f},
-std::array<float,2>{0.687306643f, 0.816877365f},
-std::array<float,2>{0.822018683f, 0.273357332f},
-std::array<float,2>{0.198894605f, 0.977050126f},
-std::array<float,2>{0.473687261f, 0.211185634f},
-std::array<float,2>{0.70312798f, 0.609449804f},
-std::array<float,2>{0.578939378f, 0.0133193042f},
-std::array<float,2>{0.270356089f, 0.745403409f},
-std::array<float,2>{0.0279890727f, 0.378377378f},
-std::array<float,2>{0.910934746f, 0.760971129f},
-std::array<float,2>{0.633660197f, 0.46243f},
-std::array<float,2>{0.396314532f, 0.864382446f},
-std::array<float,2>{0.151083753f, 0.0945314243f},
-std::array<float,2>{0.781174421f, 0.671446383f},
-std::array<float,2>{0.996005833f, 0.161890045f},
-std::array<float,2>{0.10516569f, 0.501610756f},
-std::array<float,2>{0.360539317f, 0.346251428f},
-std::array<float,2>{0.508543968f, 0.919302285f},
-std::array<float,2>{0.940264285f, 0.363629311f},
-std::array<float,2>{0.0726929829f, 0.935765862f},
-std::array<float,2>{0.317299455f, 0.182766691f},
-std::array<float,2>{0.54573673f, 0.520409107f},
-std::array<float,2>{0.669536352f, 0.119570754f},
-std::array<float,2>{0.428193957f, 0.672289431f},
-std::array<float,2>{0.178857446f, 0.438577831f},
-std::array<float,2>{0.791725755f, 0.843946993f},
-std::array<float,2>{0.616607368f, 0.392144024f},
-std::array<float,2>{0.310943007f, 0.774338245f},
-std::array<float,2>{0.0414714739f, 0.0234546605f},
-std::array<float,2>{0.884158432f, 0.724956334f},
-std::array<float,2>{0.869747281f, 0.196012065f},
-std::array<float,2>{0.229487985f, 0.60229969f},
-std::array<float,2>{0.454173476f, 0.25055182f},
-std::array<float,2>{0.727012992f, 0.999289036f},
-std::array<float,2>{0.755262971f, 0.493415266f},
-std::array<float,2>{0.127518073f, 0.83261776f},
-std::array<float,2>{0.381327093f, 0.0851600766f},
-std::array<float,2>{0.643441617f, 0.633814156f},
-std::array<float,2>{0.519657612f, 0.156215176f},
-std::array<float,2>{0.343816102f, 0.536801279f},
-std::array<float,2>{0.12021701f, 0.325779051f},
-std::array<float,2>{0.972314775f, 0.875204504f},
-std::array<float,2>{0.702454686f, 0.296626747f},
-std::array<float,2>{0.499680996f, 0.962943792f},
-std::array<float,2>{0.210867003f, 0.23696515f},
-std::array<float,2>{0.836145878f, 0.578923523f},
-std::array<float,2>{0.932560265f, 0.0434328429f},
-std::array<float,2>{0.00876440294f, 0.691500723f},
-std::array<float,2>{0.265296996f, 0.431302845f},
-std::array<float,2>{0.569906175f, 0.80191052f},
-std::array<float,2>{0.923780203f, 0.475169599f},
-std::array<float,2>{0.00715008564f, 0.812903225f},
-std::array<float,2>{0.255346596f, 0.0628411993f},
-std::array<float,2>{0.574330688f, 0.642610729f},
-std::array<float,2>{0.694018662f, 0.127331182f},
-std::array<float,2>{0.490305215f, 0.550801337f},
-std::array<float,2>{0.214997694f, 0.341472596f},
-std::array<float,2>{0.833918989f, 0.905330539f},
-std::array<float,2>{0.530881345f, 0.298020929f},
-std::array<float,2>{0.35661152f, 0.950218916f},
-std::array<float,2>{0.110125318f, 0.23379381f},
-std::array<float,2>{0.979530931f, 0.572833896f},
-std::array<float,2>{0.763278425f, 0.0617854148f},
-std::array<float,2>{0.13677901f, 0.703457892f},
-std::array<float,2>{0.389126867f, 0.406879425f},
-std::array<float,2>{0.655713677f, 0.783916593f},
-std::array<float,2>{0.859434485f, 0.349688351f},
-std::array<float,2>{0.224017575f, 0.917461514f},
-std::array<float,2>{0.461454749f, 0.159953639f},
-std::array<float,2>{0.723412812f, 0.505737901f},
-std::array<float,2>{0.620505095f, 0.0990642458f},
-std::array<float,2>{0.302876621f, 0.667500973f},
-std::array<float,2>{0.0339605846f, 0.46819976f},
-std::array<float,2>{0.879911661f, 0.862505913f},
-std::array<float,2>{0.660648942f, 0.382474512f},
-std::array<float,2>{0.43261224f, 0.765268087f},
-std::array<float,2>{0.184929341f, 0.011048249f},
-std::array<float,2>{0.782516301f, 0.746970594f},
-std::array<float,2>{0.94853574f, 0.215970472f},
-std::array<float,2>{0.0692933947f, 0.614736915f},
-std::array<float,2>{0.321473181f, 0.268524617f},
-std::array<float,2>{0.53559202f, 0.983776212f},
-std::array<float,2>{0.987879634f, 0.257726818f},
-std::array<float,2>{0.0963750854f, 0.99441874f},
-std::array<float,2>{0.368366778f, 0.201532871f},
-std::array<float,2>{0.505578518f, 0.605920255f},
-std::array<float,2>{0.626983762f, 0.0297864955f},
-std::array<float,2>{0.401878089f, 0.719594359f},
-std::array<float,2>{0.147360906f, 0.396847606f},
-std::array<float,2>{0.773184776f, 0.777367532f},
-std::array<float,2>{0.586931229f, 0.443640709f},
-std::array<float,2>{0.278662682f, 0.849639833f},
-std::array<float,2>{0.0224502254f, 0.121678285f},
-std::array<float,2>{0.916074991f, 0.679162741f},
-std::array<float,2>{0.814474046f, 0.1857986f},
-std::array<float,2>{0.187857732f, 0.516773164f},
-std::array<float,2>{0.478814214f, 0.359796077f},
-std::array<float,2>{0.718580782f, 0.932700574f},
-std::array<float,2>{0.797483683f, 0.433928281f},
-std::array<float,2>{0.165546641f, 0.796899974f},
-std::array<float,2>{0.410140991f, 0.0391764343f},
-std::array<float,2>{0.677982867f, 0.688368082f},
-std::array<float,2>{0.551307559f, 0.240036622f},
-std::array<float,2>{0.339816779f, 0.583608985f},
-std::array<float,2>{0.0857506618f, 0.292931646f},
-std::array<float,2>{0.953195333f, 0.968416572f},
-std::array<float,2>{0.747568309f, 0.323617488f},
-std::array<float,2>{0.438901722f, 0.880968094f},
-std::array<float,2>{0.242814615f, 0.152061537f},
-std::array<float,2>{0.847550929f, 0.534118712f},
-std::array<float,2>{0.905813932f, 0.0790688172f},
-std::array<float,2>{0.05416907f, 0.637095749f},
-std::array<float,2>{0.294833392f, 0.499881953f},
-std::array<float,2>{0.595224977f, 0.831194878f},
-std::array<float,2>{0.962076783f, 0.403713167f},
-std::array<float,2>{0.092329748f, 0.770194232f},
-std::array<float,2>{0.331832558f, 0.0157401897f},
-std::array<float,2>{0.555339217f, 0.732240617f},
-std::array<float,2>{0.681465268f, 0.192098677f},
-std::array<float,2>{0.42179969f, 0.597248137f},
-std::array<float,2>{0.160395741f, 0.263715893f},
-std::array<float,2>{0.806851864f, 0.990023553f},
-std::array<float,2>{0.603962421f, 0.374809593f},
-std::array<float,2>{0.287185729f, 0.926688135f},
-std::array<float,2>{0.0563940741f, 0.174189299f},
-std::array<float,2>{0.893332839f, 0.530025065f},
-std::array<float,2>{0.85454458f, 0.109418452f},
-std::array<float,2>{0.23983638f, 0.681043446f},
-std::array<float,2>{0.449028611f, 0.451069862f},
-std::array<float,2>{0.742148995f, 0.85464412f},
-std::array<float,2>{0.774550617f, 0.287239224f},
-std::array<float,2>{0.155025497f, 0.958749652f},
-std::array<float,2>{0.39395687f, 0.244725823f},
-std::array<float,2>{0.639497876f, 0.590586722f},
-std::array<float,2>{0.515516579f, 0.0353017785f},
-std::array<float,2>{0.36422044f, 0.695493281f},
-std::array<float,2>{0.106702417f, 0.425699353f},
-std::array<float,2>{0.997227848f, 0.809938431f},
-std::array<float,2>{0.707555234f, 0.487961769f},
-std::array<float,2>{0.468835443f, 0.839380085f},
-std::array<float,2>{0.201516792f, 0.0870656222f},
-std::array<float,2>{0.827094197f, 0.631239772f},
-std::array<float,2>{0.907179713f, 0.143420801f},
-std::array<float,2>{0.0239552148f, 0.546622694f},
-std::array<float,2>{0.266193897f, 0.315360397f},
-std::array<float,2>{0.582461953f, 0.889441669f},
-std::array<float,2>{0.887215853f, 0.334139615f},
-std::array<float,2>{0.0467616171f, 0.892162621f},
-std::array<float,2>{0.307844132f, 0.139891014f},
-std::array<float,2>{0.612759292f, 0.555711925f},
-std::array<float,2>{0.731986821f, 0.0760404766f},
-std::array<float,2>{0.45803526f, 0.649897635f},
-std::array<float,2>{0.233622015f, 0.481725633f},
-std::array<float,2>{0.872940063f, 0.825244963f},
-std::array<float,2>{0.539068997f, 0.421364635f},
-std::array<float,2>{0.312512338f, 0.789280474f},
-std::array<float,2>{0.0770696625f, 0.0521099865f},
-std::array<float,2>{0.943414032f, 0.716924489f},
-std::array<float,2>{0.795252919f, 0.220895588f},
-std::array<float,2>{0.175712794f, 0.563792527f},
-std::array<float,2>{0.423332602f, 0.305737734f},
-std::array<float,2>{0.667942584f, 0.941400409f},
-std::array<float,2>{0.840361953f, 0.459285468f},
-std::array<float,2>{0.206153721f, 0.870444119f},
-std::array<float,2>{0.495761663f, 0.105501562f},
-std::array<float,2>{0.695750833f, 0.661697626f},
-std::array<float,2>{0.565385282f, 0.171505719f},
-std::array<float,2>{0.259515703f, 0.513322532f},
-std::array<float,2>{0.014162343f, 0.352613866f},
-std::array<float,2>{0.937471449f, 0.906868041f},
-std::array<float,2>{0.64789778f, 0.276189446f},
-std::array<float,2>{0.378828168f, 0.97636199f},
-std::array<float,2>{0.131355047f, 0.205995843f},
-std::array<float,2>{0.7502653f, 0.6184479f},
-std::array<float,2>{0.9760741f, 0.000182819349f},
-std::array<float,2>{0.123583876f, 0.73509258f},
-std::array<float,2>{0.351026148f, 0.387568444f},
-std::array<float,2>{0.516824603f, 0.756383181f},
-std::array<float,2>{0.952193618f, 0.491750091f},
-std::array<float,2>{0.0643164515f, 0.84329015f},
-std::array<float,2>{0.326840013f, 0.0934993848f},
-std::array<float,2>{0.532330453f, 0.625429153f},
-std::array<float,2>{0.658378601f, 0.146300122f},
-std::array<float,2>{0.436832935f, 0.539372146f},
-std::array<float,2>{0.183563232f, 0.31944564f},
-std::array<float,2>{0.785593212f, 0.886585712f},
-std::array<float,2>{0.624976277f, 0.281323075f},
-std::array<float,2>{0.299986035f, 0.954557955f},
-std::array<float,2>{0.0376038775f, 0.246700987f},
-std::array<float,2>{0.876962006f, 0.58616817f},
-std::array<float,2>{0.864489675f, 0.0349237211f},
-std::array<float,2>{0.2195099f, 0.699682117f},
-std::array<float,2>{0.465288222f, 0.425995857f},
-std::array<float,2>{0.719928324f, 0.804981112f},
-std::array<float,2>{0.758667707f, 0.370335788f},
-std::array<float,2>{0.133048996f, 0.924711108f},
-std::array<float,2>{0.385218143f, 0.178854391f},
-std::array<float,2>{0.649955511f, 0.526022613f},
-std::array<float,2>{0.524404764f, 0.115372345f},
-std::array<float,2>{0.352107346f, 0.68388015f},
-std::array<float,2>{0.116522126f, 0.44634071f},
-std::array<float,2>{0.980532229f, 0.85637933f},
-std::array<float,2>{0.689197779f, 0.399409533f},
-std::array<float,2>{0.485742033f, 0.766161799f},
-std::array<float,2>{0.212728471f, 0.019566942f},
-std::array<float,2>{0.830854058f, 0.729722679f},
-std::array<float,2>{0.926824033f, 0.18817769f},
-std::array<float,2>{0.00238686707f, 0.59891361f},
-std::array<float,2>{0.25266993f, 0.2600573f},
-std::array<float,2>{0.570389271f, 0.987087607f},
-std::array<float,2>{0.898583829f, 0.279622555f},
-std::array<float,2>{0.0486964323f, 0.969651222f},
-std::array<float,2>{0.2917988f, 0.209449768f},
-std::array<float,2>{0.598880649f, 0.623894453f},
-std::array<float,2>{0.74475801f, 0.0059972899f},
-std::array<float,2>{0.441638917f, 0.738482237f},
-std::array<float,2>{0.248755977f, 0.385804385f},
-std::array<float,2>{0.84961921f, 0.75114578f},
-std::array<float,2>{0.547750711f, 0.453566194f},
-std::array<float,2>{0.342700213f, 0.873058617f},
-std::array<float,2>{0.080322355f, 0.101904027f},
-std::array<float,2>{0.960827827f, 0.656884909f},
-std::array<float,2>{0.802101016f, 0.167129695f},
-std::array<float,2>{0.169145703f, 0.508921325f},
-std::array<float,2>{0.410243481f, 0.356202602f},
-std::array<float,2>{0.675729573f, 0.913617015f},
-std::array<float,2>{0.819611311f, 0.417897642f},
-std::array<float,2>{0.191686332f, 0.793365657f},
-std::array<float,2>{0.483943909f, 0.048779916f},
-std::array<float,2>{0.712426662f, 0.712876022f},
-std::array<float,2>{0.592005789f, 0.22655946f},
-std::array<float,2>{0.274642736f, 0.566687822f},
-std::array<float,2>{0.0161077958f, 0.310846746f},
-std::array<float,2>{0.91952014f, 0.944575906f},
-std::array<float,2>{0.630670786f, 0.330013782f},
-std::array<float,2>{0.402564317f, 0.895221591f},
-std::array<float,2>{0.142805219f, 0.134499252f},
-std::array<float,2>{0.767116785f, 0.559730709f},
-std::array<float,2>{0.989301205f, 0.0710200071f},
-std::array<float,2>{0.100930795f, 0.654281735f},
-std::array<float,2>{0.37265408f, 0.477743685f},
-std::array<float,2>{0.502254963f, 0.821610749f},
-std::array<float,2>{0.913824499f, 0.376075596f},
-std::array<float,2>{0.0297396071f, 0.757834852f},
-std::array<float,2>{0.272049904f, 0.0154064633f},
-std::array<float,2>{0.58107847f, 0.743079305f},
-std::array<float,2>{0.70530355f, 0.213822961f},
-std::array<float,2>{0.475135773f, 0.611475766f},
-std::array<float,2>{0.195364743f, 0.270707577f},
-std::array<float,2>{0.822847664f, 0.979819655f},
-std::array<float,2>{0.511094868f, 0.344796658f},
-std::array<float,2>{0.361809701f, 0.920268774f},
-std::array<float,2>{0.10284619f, 0.162506163f},
-std::array<float,2>{0.992924511f, 0.502891123f},
-std::array<float,2>{0.77929163f, 0.0969917923f},
-std::array<float,2>{0.148462564f, 0.6691401f},
-std::array<float,2>{0.396918207f, 0.463886201f},
-std::array<float,2>{0.6350407f, 0.86704886f},
-std::array<float,2>{0.85893631f, 0.302800536f},
-std::array<float,2>{0.236212999f, 0.947537839f},
-std::array<float,2>{0.451711684f, 0.229962528f},
-std::array<float,2>{0.7371912f, 0.578076422f},
-std::array<float,2>{0.607736766f, 0.0548078865f},
-std::array<float,2>{0.284112751f, 0.707120001f},
-std::array<float,2>{0.0616386384f, 0.411232769f},
-std::array<float,2>{0.895184934f, 0.788094223f},
-std::array<float,2>{0.685015023f, 0.471392334f},
-std::array<float,2>{0.414158016f, 0.820084691f},
-std::array<float,2>{0.157418534f, 0.0695639253f},
-std::array<float,2>{0.811791301f, 0.644542038f},
-std::array<float,2>{0.965531111f, 0.131882533f},
-std::array<float,2>{0.0882286057f, 0.550439417f},
-std::array<float,2>{0.332606316f, 0.338239938f},
-std::array<float,2>{0.559038043f, 0.902169466f},
-std::array<float,2>{0.9697721f, 0.326679438f},
-std::array<float,2>{0.11816442f, 0.877812266f},
-std::array<float,2>{0.346244574f, 0.153930828f},
-std::array<float,2>{0.521502495f, 0.537945569f},
-std::array<float,2>{0.641484797f, 0.0824743509f},
-std::array<float,2>{0.379811525f, 0.635328531f},
-std::array<float,2>{0.125270888f, 0.49510923f},
-std::array<float,2>{0.756028354f, 0.835044205f},
-std::array<float,2>{0.567853987f, 0.432122141f},
-std::array<float,2>{0.262681693f, 0.80288291f},
-std::array<float,2>{0.0102669382f, 0.0451403745f},
-std::array<float,2>{0.929705441f, 0.695015609f},
-std::array<float,2>{0.837911248f, 0.234621286f},
-std::array<float,2>{0.207257479f, 0.580450475f},
-std::array<float,2>{0.49794665f, 0.293982804f},
-std::array<float,2>{0.699774206f, 0.961404204f},
-std::array<float,2>{0.790590584f, 0.440230727f},
-std::array<float,2>{0.175927684f, 0.84695226f},
-std::array<float,2>{0.426103801f, 0.11764998f},
-std::array<float,2>{0.671775997f, 0.6744017f},
-std::array<float,2>{0.543727458f, 0.180006623f},
-std::array<float,2>{0.319072545f, 0.522119582f},
-std::array<float,2>{0.0710733905f, 0.366336882f},
-std::array<float,2>{0.939263225f, 0.935306072f},
-std::array<float,2>{0.730377257f, 0.253287554f},
-std::array<float,2>{0.456302375f, 0.997580409f},
-std::array<float,2>{0.22684823f, 0.198213175f},
-std::array<float,2>{0.867411077f, 0.605134368f},
-std::array<float,2>{0.886027515f, 0.0271886066f},
-std::array<float,2>{0.0398366116f, 0.723727703f},
-std::array<float,2>{0.308688223f, 0.392692536f},
-std::array<float,2>{0.613353789f, 0.776904225f},
-std::array<float,2>{0.881255507f, 0.465742558f},
-std::array<float,2>{0.0314268693f, 0.861082733f},
-std::array<float,2>{0.300987244f, 0.0998605266f},
-std::array<float,2>{0.617748857f, 0.664785147f},
-std::array<float,2>{0.725505114f, 0.158033192f},
-std::array<float,2>{0.464838862f, 0.507166564f},
-std::array<float,2>{0.225887686f, 0.348877311f},
-std::array<float,2>{0.863047183f, 0.914771438f},
-std::array<float,2>{0.538454354f, 0.266287267f},
-std::array<float,2>{0.322877616f, 0.981769562f},
-std::array<float,2>{0.0679079816f, 0.216989264f},
-std::array<float,2>{0.945482492f, 0.61592412f},
-std::array<float,2>{0.784156322f, 0.00883716252f},
-std::array<float,2>{0.186790764f, 0.748473644f},
-std::array<float,2>{0.431347013f, 0.379722774f},
-std::array<float,2>{0.663605213f, 0.762755394f},
-std::array<float,2>{0.834687233f, 0.343498677f},
-std::array<float,2>{0.216951028f, 0.902484119f},
-std::array<float,2>{0.488298148f, 0.126045495f},
-std::array<float,2>{0.692851961f, 0.55389142f},
-std::array<float,2>{0.577057481f, 0.0647638664f},
-std::array<float,2>{0.257313102f, 0.641535342f},
-std::array<float,2>{0.00476295641f, 0.474411458f},
-std::array<float,2>{0.925544262f, 0.815391004f},
-std::array<float,2>{0.654028893f, 0.408702046f},
-std::array<float,2>{0.387896568f, 0.782180309f},
-std::array<float,2>{0.139040068f, 0.0586465783f},
-std::array<float,2>{0.765511632f, 0.705426872f},
-std::array<float,2>{0.977891386f, 0.231802687f},
-std::array<float,2>{0.11152079f, 0.572209001f},
-std::array<float,2>{0.358897716f, 0.299300432f},
-std::array<float,2>{0.528042436f, 0.952401638f},
-std::array<float,2>{0.955161095f, 0.289904654f},
-std::array<float,2>{0.0831107646f, 0.965700984f},
-std::array<float,2>{0.337770522f, 0.241116509f},
-std::array<float,2>{0.553473294f, 0.584396303f},
-std::array<float,2>{0.676127434f, 0.0413373075f},
-std::array<float,2>{0.40811643f, 0.691081166f},
-std::array<float,2>{0.166124746f, 0.437359273f},
-std::array<float,2>{0.80050981f, 0.800772369f},
-std::array<float,2>{0.597441435f, 0.497468621f},
-std::array<float,2>{0.296125799f, 0.829218268f},
-std::array<float,2>{0.0514164343f, 0.0820173249f},
-std::array<float,2>{0.903706789f, 0.640389681f},
-std::array<float,2>{0.84395057f, 0.149676338f},
-std::array<float,2>{0.245746702f, 0.532271087f},
-std::array<float,2>{0.44049871f, 0.32199958f},
-std::array<float,2>{0.749231815f, 0.879585087f},
-std::array<float,2>{0.769574523f, 0.395831764f},
-std::array<float,2>{0.144982129f, 0.780752897f},
-std::array<float,2>{0.39867717f, 0.0286490247f},
-std::array<float,2>{0.625904739f, 0.721491218f},
-std::array<float,2>{0.507120788f, 0.200614974f},
-std::array<float,2>{0.370124936f, 0.608999014f},
-std::array<float,2>{0.0940458998f, 0.254754245f},
-std::array<float,2>{0.984436572f, 0.992201805f},
-std::array<float,2>{0.714994967f, 0.361905277f},
-std::array<float,2>{0.477737337f, 0.929958344f},
-std::array<float,2>{0.190386713f, 0.184592247f},
-std::array<float,2>{0.812796056f, 0.519170165f},
-std::array<float,2>{0.915138423f, 0.123780072f},
-std::array<float,2>{0.0207599849f, 0.676177323f},
-std::array<float,2>{0.279725522f, 0.442606121f},
-std::array<float,2>{0.589435339f, 0.848713219f},
-std::array<float,2>{0.999804258f, 0.422107756f},
-std::array<float,2>{0.108639278f, 0.810611963f},
-std::array<float,2>{0.366617084f, 0.0377819762f},
-std::array<float,2>{0.512695193f, 0.697879136f},
-std::array<float,2>{0.636867523f, 0.243261293f},
-std::array<float,2>{0.391436577f, 0.593353033f},
-std::array<float,2>{0.153409362f, 0.286656231f},
-std::array<float,2>{0.776072264f, 0.959662676f},
-std::array<float,2>{0.585849881f, 0.314350098f},
-std::array<float,2>{0.269373626f, 0.886868119f},
-std::array<float,2>{0.0257287305f, 0.140682921f},
-std::array<float,2>{0.908380747f, 0.543385744f},
-std::array<float,2>{0.824787498f, 0.0890357718f},
-std::array<float,2>{0.199492946f, 0.630628109f},
-std::array<float,2>{0.471018821f, 0.486080378f},
-std::array<float,2>{0.709593892f, 0.837630033f},
-std::array<float,2>{0.80601418f, 0.263288081f},
-std::array<float,2>{0.163780034f, 0.990789592f},
-std::array<float,2>{0.419193774f, 0.193795919f},
-std::array<float,2>{0.682315707f, 0.593765318f},
-std::array<float,2>{0.557619095f, 0.01840307f},
-std::array<float,2>{0.329353005f, 0.733289182f},
-std::array<float,2>{0.0912305191f, 0.405781925f},
-std::array<float,2>{0.963837087f, 0.773131251f},
-std::array<float,2>{0.738814771f, 0.452458084f},
-std::array<float,2>{0.446762115f, 0.851979733f},
-std::array<float,2>{0.241297066f, 0.112221085f},
-std::array<float,2>{0.85179162f, 0.68273133f},
-std::array<float,2>{0.891490579f, 0.173597202f},
-std::array<float,2>{0.0584529191f, 0.52861166f},
-std::array<float,2>{0.28541404f, 0.371720493f},
-std::array<float,2>{0.6026842f, 0.929443538f},
-std::array<float,2>{0.935092926f, 0.353847206f},
-std::array<float,2>{0.0120763713f, 0.909658432f},
-std::array<float,2>{0.260353863f, 0.168073118f},
-std::array<float,2>{0.563621581f, 0.514157116f},
-std::array<float,2>{0.697685659f, 0.108829357f},
-std::array<float,2>{0.493770033f, 0.662788749f},
-std::array<float,2>{0.203472242f, 0.458906353f},
-std::array<float,2>{0.843110681f, 0.86749053f},
-std::array<float,2>{0.517972708f, 0.388797581f},
-std::array<float,2>{0.34799242f, 0.754784346f},
-std::array<float,2>{0.123009354f, 0.00287968339f},
-std::array<float,2>{0.973721802f, 0.737619042f},
-std::array<float,2>{0.75375396f, 0.203162283f},
-std::array<float,2>{0.129059523f, 0.619408667f},
-std::array<float,2>{0.37578088f, 0.274503678f},
-std::array<float,2>{0.645522118f, 0.973370373f},
-std::array<float,2>{0.873479784f, 0.482849956f},
-std::array<float,2>{0.230939984f, 0.827681661f},
-std::array<float,2>{0.459460258f, 0.077805005f},
-std::array<float,2>{0.732966244f, 0.651292324f},
-std::array<float,2>{0.609506369f, 0.136986107f},
-std::array<float,2>{0.305697203f, 0.55736649f},
-std::array<float,2>{0.0447006598f, 0.33250311f},
-std::array<float,2>{0.88933748f, 0.893353164f},
-std::array<float,2>{0.664445579f, 0.307798177f},
-std::array<float,2>{0.424843788f, 0.937578976f},
-std::array<float,2>{0.171920553f, 0.219775289f},
-std::array<float,2>{0.793878913f, 0.566358387f},
-std::array<float,2>{0.942643046f, 0.053996928f},
-std::array<float,2>{0.0756879374f, 0.716362298f},
-std::array<float,2>{0.316326648f, 0.419372112f},
-std::array<float,2>{0.542699158f, 0.792787254f},
-std::array<float,2>{0.964190364f, 0.450711697f},
-std::array<float,2>{0.0901468322f, 0.854941547f},
-std::array<float,2>{0.32828933f, 0.109768644f},
-std::array<float,2>{0.557448864f, 0.680764854f},
-std::array<float,2>{0.682769656f, 0.174033895f},
-std::array<float,2>{0.418205589f, 0.53003633f},
-std::array<float,2>{0.163062826f, 0.37471357f},
-std::array<float,2>{0.804741263f, 0.926321566f},
-std::array<float,2>{0.602015078f, 0.263935119f},
-std::array<float,2>{0.286597908f, 0.989951372f},
-std::array<float,2>{0.057104364f, 0.192241043f},
-std::array<float,2>{0.892335713f, 0.59745729f},
-std::array<float,2>{0.852912664f, 0.015935082f},
-std::array<float,2>{0.240952209f, 0.732070923f},
-std::array<float,2>{0.445609778f, 0.40345788f},
-std::array<float,2>{0.739368737f, 0.770293355f},
-std::array<float,2>{0.777079999f, 0.314988822f},
-std::array<float,2>{0.152980924f, 0.889385521f},
-std::array<float,2>{0.392219424f, 0.143248424f},
-std::array<float,2>{0.637717068f, 0.546661139f},
-std::array<float,2>{0.513471663f, 0.0872642323f},
-std::array<float,2>{0.365503639f, 0.630978227f},
-std::array<float,2>{0.108317971f, 0.48809135f},
-std::array<float,2>{0.99850148f, 0.839633107f},
-std::array<float,2>{0.710755467f, 0.425355315f},
-std::array<float,2>{0.471785396f, 0.809632957f},
-std::array<float,2>{0.200746477f, 0.0355382785f},
-std::array<float,2>{0.825306118f, 0.695596576f},
-std::array<float,2>{0.909299552f, 0.244963348f},
-std::array<float,2>{0.0266690738f, 0.590354979f},
-std::array<float,2>{0.267930835f, 0.287565857f},
-std::array<float,2>{0.584693074f, 0.958580911f},
-std::array<float,2>{0.89043206f, 0.306140751f},
-std::array<float,2>{0.0431107543f, 0.940918863f},
-std::array<float,2>{0.305638731f, 0.221096545f},
-std::array<float,2>{0.611230791f, 0.563693583f},
-std::array<float,2>{0.733650327f, 0.0518950522f},
-std::array<float,2>{0.460924596f, 0.717208087f},
-std::array<float,2>{0.232105926f, 0.420973957f},
-std::array<float,2>{0.874983132f, 0.789506018f},
-std::array<float,2>{0.541589081f, 0.481644064f},
-std::array<float,2>{0.315235853f, 0.825573742f},
-std::array<float,2>{0.0743743107f, 0.0757859498f},
-std::array<float,2>{0.942270041f, 0.649424493f},
-std::array<float,2>{0.794695258f, 0.139984205f},
-std::array<float,2>{0.172933206f, 0.556133032f},
-std::array<float,2>{0.424566507f, 0.334252894f},
-std::array<float,2>{0.665795922f, 0.892513752f},
-std::array<float,2>{0.842013955f, 0.387301743f},
-std::array<float,2>{0.204446658f, 0.756807268f},
-std::array<float,2>{0.492965281f, 0.000337010046f},
-std::array<float,2>{0.698915064f, 0.735172987f},
-std::array<float,2>{0.562948346f, 0.205739737f},
-std::array<float,2>{0.260943681f, 0.618379831f},
-std::array<float,2>{0.0128533524f, 0.276072294f},
-std::array<float,2>{0.933763921f, 0.976173401f},
-std::array<float,2>{0.644614577f, 0.352836251f},
-std::array<float,2>{0.376829684f, 0.907062292f},
-std::array<float,2>{0.130625337f, 0.171790704f},
-std::array<float,2>{0.752858162f, 0.513436854f},
-std::array<float,2>{0.972980082f, 0.1059516f},
-std::array<float,2>{0.1215837f, 0.662056744f},
-std::array<float,2>{0.349373996f, 0.4590635f},
-std::array<float,2>{0.519482791f, 0.870345891f},
-std::array<float,2>{0.924576461f, 0.407046109f},
-std::array<float,2>{0.00525110587f, 0.783995867f},
-std::array<float,2>{0.255977601f, 0.0617073625f},
-std::array<float,2>{0.57759285f, 0.70313561f},
-std::array<float,2>{0.691922128f, 0.233416855f},
-std::array<float,2>{0.489692062f, 0.573105872f},
-std::array<float,2>{0.218742162f, 0.298141032f},
-std::array<float,2>{0.835051477f, 0.950587988f},
-std::array<float,2>{0.528980494f, 0.341625571f},
-std::array<float,2>{0.357782692f, 0.905755579f},
-std::array<float,2>{0.113216043f, 0.127018213f},
-std::array<float,2>{0.976689339f, 0.551208615f},
-std::array<float,2>{0.764568865f, 0.0625622198f},
-std::array<float,2>{0.140585214f, 0.642922342f},
-std::array<float,2>{0.387677193f, 0.475558907f},
-std::array<float,2>{0.653173447f, 0.812650323f},
-std::array<float,2>{0.86174643f, 0.268193394f},
-std::array<float,2>{0.22509788f, 0.983526051f},
-std::array<float,2>{0.463530272f, 0.216162682f},
-std::array<float,2>{0.725691378f, 0.614430726f},
-std::array<float,2>{0.618644178f, 0.0108289504f},
-std::array<float,2>{0.301991761f, 0.74674356f},
-std::array<float,2>{0.032715369f, 0.382702321f},
-std::array<float,2>{0.88218838f, 0.765614271f},
-std::array<float,2>{0.662628472f, 0.467899591f},
-std::array<float,2>{0.430645525f, 0.86262989f},
-std::array<float,2>{0.186001331f, 0.098732613f},
-std::array<float,2>{0.784887612f, 0.66786474f},
-std::array<float,2>{0.946572125f, 0.159789562f},
-std::array<float,2>{0.0668856353f, 0.505387187f},
-std::array<float,2>{0.323894054f, 0.350066811f},
-std::array<float,2>{0.537971914f, 0.917102933f},
-std::array<float,2>{0.985421717f, 0.359439999f},
-std::array<float,2>{0.0949739069f, 0.933056533f},
-std::array<float,2>{0.369482666f, 0.185655877f},
-std::array<float,2>{0.506056666f, 0.516883671f},
-std::array<float,2>{0.62655139f, 0.121882468f},
-std::array<float,2>{0.399934053f, 0.678827047f},
-std::array<float,2>{0.146078914f, 0.443497717f},
-std::array<float,2>{0.771181822f, 0.849877536f},
-std::array<float,2>{0.588330925f, 0.396540821f},
-std::array<float,2>{0.280571759f, 0.77764219f},
-std::array<float,2>{0.0197605751f, 0.0302451067f},
-std::array<float,2>{0.915005624f, 0.719345033f},
-std::array<float,2>{0.813847363f, 0.201244816f},
-std::array<float,2>{0.190515712f, 0.605508387f},
-std::array<float,2>{0.477426261f, 0.257496208f},
-std::array<float,2>{0.715992749f, 0.994154751f},
-std::array<float,2>{0.799358487f, 0.499729693f},
-std::array<float,2>{0.167875066f, 0.83146894f},
-std::array<float,2>{0.406603396f, 0.0788362026f},
-std::array<float,2>{0.677134931f, 0.636940598f},
-std::array<float,2>{0.554096699f, 0.152125567f},
-std::array<float,2>{0.336884558f, 0.533887863f},
-std::array<float,2>{0.0827466398f, 0.323342979f},
-std::array<float,2>{0.956637859f, 0.88123858f},
-std::array<float,2>{0.748868942f, 0.292555183f},
-std::array<float,2>{0.43969065f, 0.968718171f},
-std::array<float,2>{0.244570583f, 0.239902809f},
-std::array<float,2>{0.845049441f, 0.58375138f},
-std::array<float,2>{0.902532697f, 0.0394764133f},
-std::array<float,2>{0.0519707128f, 0.688068509f},
-std::array<float,2>{0.295412034f, 0.433615237f},
-std::array<float,2>{0.595980287f, 0.797165573f},
-std::array<float,2>{0.895579696f, 0.469196409f},
-std::array<float,2>{0.060918577f, 0.81657356f},
-std::array<float,2>{0.284413934f, 0.0682928786f},
-std::array<float,2>{0.609293282f, 0.64681375f},
-std::array<float,2>{0.737641215f, 0.130254775f},
-std::array<float,2>{0.452212781f, 0.54759568f},
-std::array<float,2>{0.234647334f, 0.337405115f},
-std::array<float,2>{0.857834399f, 0.899377167f},
-std::array<float,2>{0.560097933f, 0.302205026f},
-std::array<float,2>{0.333605558f, 0.946266413f},
-std::array<float,2>{0.0891620964f, 0.227512687f},
-std::array<float,2>{0.966743171f, 0.575823963f},
-std::array<float,2>{0.810815156f, 0.0581270829f},
-std::array<float,2>{0.156496659f, 0.709497035f},
-std::array<float,2>{0.415871561f, 0.413638979f},
-std::array<float,2>{0.683755457f, 0.787100255f},
-std::array<float,2>{0.823912799f, 0.346591383f},
-std::array<float,2>{0.196862161f, 0.918993771f},
-std::array<float,2>{0.4757047f, 0.161629081f},
-std::array<float,2>{0.706367135f, 0.501840174f},
-std::array<float,2>{0.580932736f, 0.094322294f},
-std::array<float,2>{0.273302585f, 0.671854258f},
-std::array<float,2>{0.0304292943f, 0.462814063f},
-std::array<float,2>{0.912544847f, 0.864697933f},
-std::array<float,2>{0.636001408f, 0.377976447f},
-std::array<float,2>{0.398169816f, 0.761094928f},
-std::array<float,2>{0.149548575f, 0.0136105996f},
-std::array<float,2>{0.777598381f, 0.745150328f},
-std::array<float,2>{0.994129658f, 0.211057723f},
-std::array<float,2>{0.101592407f, 0.609774053f},
-std::array<float,2>{0.363148153f, 0.272992134f},
-std::array<float,2>{0.510548532f, 0.976690888f},
-std::array<float,2>{0.937503338f, 0.250961065f},
-std::array<float,2>{0.0714793131f, 0.999101043f},
-std::array<float,2>{0.319457024f, 0.196124449f},
-std::array<float,2>{0.544041038f, 0.602092743f},
-std::array<float,2>{0.670151293f, 0.0237668399f},
-std::array<float,2>{0.427312613f, 0.724632561f},
-std::array<float,2>{0.177395165f, 0.392572612f},
-std::array<float,2>{0.789631248f, 0.774041116f},
-std::array<float,2>{0.614279211f, 0.438962936f},
-std::array<float,2>{0.310171872f, 0.844166636f},
-std::array<float,2>{0.0401762165f, 0.119199604f},
-std::array<float,2>{0.885689378f, 0.672062278f},
-std::array<float,2>{0.86879766f, 0.183076903f},
-std::array<float,2>{0.227935851f, 0.52013576f},
-std::array<float,2>{0.455111504f, 0.363365859f},
-std::array<float,2>{0.728845239f, 0.935830951f},
-std::array<float,2>{0.75762862f, 0.431543082f},
-std::array<float,2>{0.126004651f, 0.802009881f},
-std::array<float,2>{0.380418211f, 0.0432071015f},
-std::array<float,2>{0.641770303f, 0.691729724f},
-std::array<float,2>{0.523131907f, 0.237189919f},
-std::array<float,2>{0.346906394f, 0.57876581f},
-std::array<float,2>{0.117903031f, 0.296845406f},
-std::array<float,2>{0.96961087f, 0.963248789f},
-std::array<float,2>{0.700272501f, 0.326051474f},
-std::array<float,2>{0.496679127f, 0.875380337f},
-std::array<float,2>{0.208718687f, 0.156003848f},
-std::array<float,2>{0.838997006f, 0.537096202f},
-std::array<float,2>{0.930982232f, 0.0852967128f},
-std::array<float,2>{0.0115258507f, 0.634257615f},
-std::array<float,2>{0.263213307f, 0.493288875f},
-std::array<float,2>{0.566424966f, 0.832769096f},
-std::array<float,2>{0.981658638f, 0.40111053f},
-std::array<float,2>{0.115960345f, 0.768530786f},
-std::array<float,2>{0.353313953f, 0.0217133667f},
-std::array<float,2>{0.524735868f, 0.726893902f},
-std::array<float,2>{0.649038374f, 0.190441564f},
-std::array<float,2>{0.38578251f, 0.599894822f},
-std::array<float,2>{0.133843467f, 0.258024424f},
-std::array<float,2>{0.759382963f, 0.98482573f},
-std::array<float,2>{0.571986616f, 0.36776492f},
-std::array<float,2>{0.253702641f, 0.922445416f},
-std::array<float,2>{0.00363272522f, 0.176954627f},
-std::array<float,2>{0.926022887f, 0.525365531f},
-std::array<float,2>{0.831930637f, 0.113446385f},
-std::array<float,2>{0.211619169f, 0.687250674f},
-std::array<float,2>{0.485113442f, 0.447320104f},
-std::array<float,2>{0.687640011f, 0.859199703f},
-std::array<float,2>{0.786232769f, 0.28405568f},
-std::array<float,2>{0.181810006f, 0.956165314f},
-std::array<float,2>{0.436184108f, 0.248169377f},
-std::array<float,2>{0.659335732f, 0.589552999f},
-std::array<float,2>{0.532033622f, 0.0315242894f},
-std::array<float,2>{0.327464968f, 0.702524722f},
-std::array<float,2>{0.0633348897f, 0.428405732f},
-std::array<float,2>{0.951985657f, 0.80782789f},
-std::array<float,2>{0.719394565f, 0.488794923f},
-std::array<float,2>{0.46597603f, 0.840060174f},
-std::array<float,2>{0.219788522f, 0.0907319114f},
-std::array<float,2>{0.863681376f, 0.627942145f},
-std::array<float,2>{0.878148437f, 0.146564797f},
-std::array<float,2>{0.0386461429f, 0.542117119f},
-std::array<float,2>{0.299120039f, 0.318253636f},
-std::array<float,2>{0.623243451f, 0.883012831f},
-std::array<float,2>{0.91892767f, 0.331131846f},
-std::array<float,2>{0.0169392414f, 0.897081017f},
-std::array<float,2>{0.274279922f, 0.134866625f},
-std::array<float,2>{0.593325078f, 0.562272489f},
-std::array<float,2>{0.710973144f, 0.0722772703f},
-std::array<float,2>{0.483310372f, 0.654396117f},
-std::array<float,2>{0.192406714f, 0.478721827f},
-std::array<float,2>{0.818961143f, 0.823561966f},
-std::array<float,2>{0.503313124f, 0.414576143f},
-std::array<float,2>{0.371631503f, 0.795844018f},
-std::array<float,2>{0.0997462347f, 0.0490902252f},
-std::array<float,2>{0.988988459f, 0.714176059f},
-std::array<float,2>{0.765651464f, 0.224574238f},
-std::array<float,2>{0.144518524f, 0.568759918f},
-std::array<float,2>{0.403486371f, 0.309854567f},
-std::array<float,2>{0.629727304f, 0.942835808f},
-std::array<float,2>{0.851463854f, 0.455206037f},
-std::array<float,2>{0.249588102f, 0.871486187f},
-std::array<float,2>{0.442484021f, 0.103578731f},
-std::array<float,2>{0.745415926f, 0.658222497f},
-std::array<float,2>{0.597682595f, 0.165342256f},
-std::array<float,2>{0.292105615f, 0.511673987f},
-std::array<float,2>{0.0470482074f, 0.357896149f},
-std::array<float,2>{0.899805307f, 0.911836982f},
-std::array<float,2>{0.673951864f, 0.278754085f},
-std::array<float,2>{0.411431164f, 0.972118616f},
-std::array<float,2>{0.168686315f, 0.207731083f},
-std::array<float,2>{0.801014602f, 0.622606397f},
-std::array<float,2>{0.959368646f, 0.00551455421f},
-std::array<float,2>{0.0819888413f, 0.740645528f},
-std::array<float,2>{0.343547344f, 0.383610725f},
-std::array<float,2>{0.548731029f, 0.753902853f},
-std::array<float,2>{0.996193528f, 0.486166418f},
-std::array<float,2>{0.105945885f, 0.837660491f},
-std::array<float,2>{0.364511311f, 0.0892396197f},
-std::array<float,2>{0.514548957f, 0.630488932f},
-std::array<float,2>{0.64035219f, 0.14092651f},
-std::array<float,2>{0.39263624f, 0.543191016f},
-std::array<float,2>{0.155491218f, 0.314039588f},
-std::array<float,2>{0.774025679f, 0.88711375f},
-std::array<float,2>{0.583982348f, 0.286890805f},
-std::array<float,2>{0.267471462f, 0.959833443f},
-std::array<float,2>{0.0250224117f, 0.243615016f},
-std::array<float,2>{0.907848001f, 0.593723178f},
-std::array<float,2>{0.82784754f, 0.0380732343f},
-std::array<float,2>{0.202153102f, 0.698200643f},
-std::array<float,2>{0.469964564f, 0.422252417f},
-std::array<float,2>{0.708925664f, 0.810921311f},
-std::array<float,2>{0.808380187f, 0.371939331f},
-std::array<float,2>{0.161633432f, 0.929360569f},
-std::array<float,2>{0.420713961f, 0.173550978f},
-std::array<float,2>{0.679965377f, 0.528467417f},
-std::array<float,2>{0.556011915f, 0.112014808f},
-std::array<float,2>{0.330848008f, 0.683023989f},
-std::array<float,2>{0.0929005966f, 0.452162385f},
-std::array<float,2>{0.961344302f, 0.851583064f},
-std::array<float,2>{0.740483582f, 0.406134039f},
-std::array<float,2>{0.447714001f, 0.773210526f},
-std::array<float,2>{0.238483295f, 0.0182722472f},
-std::array<float,2>{0.853516161f, 0.73304975f},
-std::array<float,2>{0.894365072f, 0.193476051f},
-std::array<float,2>{0.0555137657f, 0.594120622f},
-std::array<float,2>{0.288841158f, 0.263618976f},
-std::array<float,2>{0.604576051f, 0.991161942f},
-std::array<float,2>{0.936316311f, 0.274702102f},
-std::array<float,2>{0.0153668355f, 0.973504126f},
-std::array<float,2>{0.258237153f, 0.203577295f},
-std::array<float,2>{0.56603539f, 0.619247854f},
-std::array<float,2>{0.697046816f, 0.00248340098f},
-std::array<float,2>{0.494483441f, 0.737357616f},
-std::array<float,2>{0.205938831f, 0.388932258f},
-std::array<float,2>{0.841066897f, 0.754433215f},
-std::array<float,2>{0.516590416f, 0.458592832f},
-std::array<float,2>{0.350234866f, 0.867359817f},
-std::array<float,2>{0.124674745f, 0.108485073f},
-std::array<float,2>{0.975314021f, 0.663055599f},
-std::array<float,2>{0.751161158f, 0.168437168f},
-std::array<float,2>{0.132136166f, 0.51372993f},
-std::array<float,2>{0.377110124f, 0.353555679f},
-std::array<float,2>{0.64734292f, 0.909312844f},
-std::array<float,2>{0.871427655f, 0.419126123f},
-std::array<float,2>{0.232804596f, 0.792662442f},
-std::array<float,2>{0.45766601f, 0.0538272373f},
-std::array<float,2>{0.731106997f, 0.716741443f},
-std::array<float,2>{0.611605644f, 0.220070481f},
-std::array<float,2>{0.30697149f, 0.565944433f},
-std::array<float,2>{0.0456562378f, 0.308103263f},
-std::array<float,2>{0.888253331f, 0.93775779f},
-std::array<float,2>{0.666582763f, 0.332244307f},
-std::array<float,2>{0.422074318f, 0.893214166f},
-std::array<float,2>{0.174012214f, 0.136731148f},
-std::array<float,2>{0.795906842f, 0.557383597f},
-std::array<float,2>{0.945192993f, 0.0780045241f},
-std::array<float,2>{0.0781150237f, 0.65091455f},
-std::array<float,2>{0.313932478f, 0.482490212f},
-std::array<float,2>{0.540285528f, 0.827945352f},
-std::array<float,2>{0.879839599f, 0.379612774f},
-std::array<float,2>{0.0345521793f, 0.763029635f},
-std::array<float,2>{0.304263145f, 0.00922507606f},
-std::array<float,2>{0.619718015f, 0.748272777f},
-std::array<float,2>{0.72387892f, 0.217246786f},
-std::array<float,2>{0.462440521f, 0.61597538f},
-std::array<float,2>{0.222906485f, 0.266600698f},
-std::array<float,2>{0.860502124f, 0.981611013f},
-std::array<float,2>{0.536191761f, 0.348718315f},
-std::array<float,2>{0.320661962f, 0.914839923f},
-std::array<float,2>{0.0699239001f, 0.15795064f},
-std::array<float,2>{0.947720647f, 0.506945312f},
-std::array<float,2>{0.781861901f, 0.0996926874f},
-std::array<float,2>{0.184091911f, 0.665013731f},
-std::array<float,2>{0.433565646f, 0.465528786f},
-std::array<float,2>{0.661815166f, 0.861281872f},
-std::array<float,2>{0.832264006f, 0.298889548f},
-std::array<float,2>{0.21644859f, 0.952302396f},
-std::array<float,2>{0.491927683f, 0.231683433f},
-std::array<float,2>{0.695113599f, 0.571836948f},
-std::array<float,2>{0.575953364f, 0.0590531789f},
-std::array<float,2>{0.254301578f, 0.705306351f},
-std::array<float,2>{0.00652027316f, 0.408941746f},
-std::array<float,2>{0.922089159f, 0.78180629f},
-std::array<float,2>{0.655239284f, 0.474291831f},
-std::array<float,2>{0.390602916f, 0.814956427f},
-std::array<float,2>{0.137899727f, 0.0646869615f},
-std::array<float,2>{0.76202172f, 0.641250312f},
-std::array<float,2>{0.978625774f, 0.126376972f},
-std::array<float,2>{0.110746905f, 0.554171264f},
-std::array<float,2>{0.356008023f, 0.343688846f},
-std::array<float,2>{0.529577672f, 0.902665854f},
-std::array<float,2>{0.955055833f, 0.322192401f},
-std::array<float,2>{0.0841187239f, 0.879707098f},
-std::array<float,2>{0.337979972f, 0.149600297f},
-std::array<float,2>{0.551888525f, 0.532617629f},
-std::array<float,2>{0.679189563f, 0.0817807615f},
-std::array<float,2>{0.408602417f, 0.640200019f},
-std::array<float,2>{0.164079592f, 0.497294575f},
-std::array<float,2>{0.798735201f, 0.829387605f},
-std::array<float,2>{0.59422493f, 0.437145561f},
-std::array<float,2>{0.293209463f, 0.800329864f},
-std::array<float,2>{0.0532961152f, 0.0410521217f},
-std::array<float,2>{0.90462923f, 0.691245258f},
-std::array<float,2>{0.846609175f, 0.24081926f},
-std::array<float,2>{0.244133621f, 0.584057927f},
-std::array<float,2>{0.437527031f, 0.289685249f},
-std::array<float,2>{0.746432543f, 0.965343177f},
-std::array<float,2>{0.771986723f, 0.44270426f},
-std::array<float,2>{0.148018688f, 0.848894715f},
-std::array<float,2>{0.401082724f, 0.123685397f},
-std::array<float,2>{0.628136039f, 0.675975144f},
-std::array<float,2>{0.504564404f, 0.184950903f},
-std::array<float,2>{0.368033946f, 0.519495428f},
-std::array<float,2>{0.097139366f, 0.362127274f},
-std::array<float,2>{0.986937404f, 0.929876685f},
-std::array<float,2>{0.716924787f, 0.254449129f},
-std::array<float,2>{0.479600132f, 0.992526829f},
-std::array<float,2>{0.189052403f, 0.200331569f},
-std::array<float,2>{0.815486491f, 0.609253943f},
-std::array<float,2>{0.91705519f, 0.0284708384f},
-std::array<float,2>{0.0231405608f, 0.721307456f},
-std::array<float,2>{0.277577132f, 0.39562729f},
-std::array<float,2>{0.586509466f, 0.780453563f},
-std::array<float,2>{0.911830604f, 0.464199096f},
-std::array<float,2>{0.0292735845f, 0.866938174f},
-std::array<float,2>{0.270791411f, 0.0967098102f},
-std::array<float,2>{0.579777122f, 0.669389069f},
-std::array<float,2>{0.704528987f, 0.16226092f},
-std::array<float,2>{0.473000437f, 0.50262779f},
-std::array<float,2>{0.198060945f, 0.344997823f},
-std::array<float,2>{0.821112931f, 0.919922233f},
-std::array<float,2>{0.509366095f, 0.270825058f},
-std::array<float,2>{0.360294342f, 0.979568064f},
-std::array<float,2>{0.103918992f, 0.2134047f},
-std::array<float,2>{0.994250953f, 0.611718655f},
-std::array<float,2>{0.779594004f, 0.0151794348f},
-std::array<float,2>{0.15193589f, 0.742822468f},
-std::array<float,2>{0.394946367f, 0.37643981f},
-std::array<float,2>{0.634528339f, 0.758289516f},
-std::array<float,2>{0.85595876f, 0.338046044f},
-std::array<float,2>{0.237329334f, 0.901862979f},
-std::array<float,2>{0.450843722f, 0.132131115f},
-std::array<float,2>{0.736083567f, 0.550672531f},
-std::array<float,2>{0.606148064f, 0.0695808083f},
-std::array<float,2>{0.283120751f, 0.644865572f},
-std::array<float,2>{0.0592656769f, 0.471580893f},
-std::array<float,2>{0.897054076f, 0.820025861f},
-std::array<float,2>{0.686247349f, 0.41146791f},
-std::array<float,2>{0.417528272f, 0.788500309f},
-std::array<float,2>{0.159323081f, 0.0549434163f},
-std::array<float,2>{0.80968523f, 0.707317352f},
-std::array<float,2>{0.967732549f, 0.229616687f},
-std::array<float,2>{0.0865733698f, 0.577714324f},
-std::array<float,2>{0.335633904f, 0.303192765f},
-std::array<float,2>{0.561033607f, 0.947507679f},
-std::array<float,2>{0.971032441f, 0.294424027f},
-std::array<float,2>{0.120017141f, 0.961104095f},
-std::array<float,2>{0.345167607f, 0.23442997f},
-std::array<float,2>{0.52057457f, 0.580096126f},
-std::array<float,2>{0.644399703f, 0.0452315286f},
-std::array<float,2>{0.382366896f, 0.695081353f},
-std::array<float,2>{0.128049821f, 0.431757689f},
-std::array<float,2>{0.7543239f, 0.803147733f},
-std::array<float,2>{0.568602681f, 0.494752884f},
-std::array<float,2>{0.26384607f, 0.835279822f},
-std::array<float,2>{0.00903095584f, 0.0821003169f},
-std::array<float,2>{0.932877123f, 0.635599315f},
-std::array<float,2>{0.837175965f, 0.154266864f},
-std::array<float,2>{0.209136307f, 0.537630022f},
-std::array<float,2>{0.498996317f, 0.327088386f},
-std::array<float,2>{0.701862454f, 0.877512038f},
-std::array<float,2>{0.792433918f, 0.392985076f},
-std::array<float,2>{0.178526431f, 0.77734077f},
-std::array<float,2>{0.42881918f, 0.0269246958f},
-std::array<float,2>{0.668299496f, 0.723908961f},
-std::array<float,2>{0.545975089f, 0.197783053f},
-std::array<float,2>{0.317529261f, 0.605317235f},
-std::array<float,2>{0.0736425743f, 0.25297451f},
-std::array<float,2>{0.940567136f, 0.997831643f},
-std::array<float,2>{0.728160977f, 0.36666441f},
-std::array<float,2>{0.453632355f, 0.935170114f},
-std::array<float,2>{0.230306149f, 0.179843262f},
-std::array<float,2>{0.87030822f, 0.52237922f},
-std::array<float,2>{0.882862628f, 0.117303513f},
-std::array<float,2>{0.0428955555f, 0.674644351f},
-std::array<float,2>{0.31187284f, 0.439991623f},
-std::array<float,2>{0.615336597f, 0.846892893f},
-std::array<float,2>{0.950889468f, 0.426242292f},
-std::array<float,2>{0.0649032071f, 0.804778159f},
-std::array<float,2>{0.325769961f, 0.0347232223f},
-std::array<float,2>{0.534950256f, 0.699374437f},
-std::array<float,2>{0.657046974f, 0.246911928f},
-std::array<float,2>{0.433937371f, 0.58638376f},
-std::array<float,2>{0.181566238f, 0.281638891f},
-std::array<float,2>{0.78885746f, 0.954341173f},
-std::array<float,2>{0.621338904f, 0.319700152f},
-std::array<float,2>{0.298367172f, 0.886460423f},
-std::array<float,2>{0.0360716917f, 0.14623408f},
-std::array<float,2>{0.875031054f, 0.539171457f},
-std::array<float,2>{0.865533113f, 0.0936785191f},
-std::array<float,2>{0.221362531f, 0.625186563f},
-std::array<float,2>{0.466879398f, 0.49207288f},
-std::array<float,2>{0.720826864f, 0.843713343f},
-std::array<float,2>{0.760199547f, 0.259826392f},
-std::array<float,2>{0.136481285f, 0.986909389f},
-std::array<float,2>{0.383726329f, 0.188301757f},
-std::array<float,2>{0.650728703f, 0.598645151f},
-std::array<float,2>{0.525963128f, 0.0199101642f},
-std::array<float,2>{0.353967726f, 0.729917169f},
-std::array<float,2>{0.114898555f, 0.399169773f},
-std::array<float,2>{0.983176887f, 0.766463876f},
-std::array<float,2>{0.689777076f, 0.446560472f},
-std::array<float,2>{0.48670873f, 0.855965614f},
-std::array<float,2>{0.213373825f, 0.115684971f},
-std::array<float,2>{0.829085648f, 0.683715701f},
-std::array<float,2>{0.928398073f, 0.179021433f},
-std::array<float,2>{0.00165406044f, 0.526282966f},
-std::array<float,2>{0.250796854f, 0.370477021f},
-std::array<float,2>{0.573976219f, 0.924410701f},
-std::array<float,2>{0.901581526f, 0.356178701f},
-std::array<float,2>{0.0493535548f, 0.913943946f},
-std::array<float,2>{0.290342897f, 0.167432711f},
-std::array<float,2>{0.601416767f, 0.509218454f},
-std::array<float,2>{0.743984759f, 0.101707034f},
-std::array<float,2>{0.444764048f, 0.657089174f},
-std::array<float,2>{0.247086748f, 0.453174174f},
-std::array<float,2>{0.847856045f, 0.873430133f},
-std::array<float,2>{0.548952222f, 0.386105657f},
-std::array<float,2>{0.341653526f, 0.7514292f},
-std::array<float,2>{0.0795587078f, 0.00633181492f},
-std::array<float,2>{0.957396984f, 0.73861891f},
-std::array<float,2>{0.80351907f, 0.209128335f},
-std::array<float,2>{0.170765698f, 0.623748183f},
-std::array<float,2>{0.412817895f, 0.279426068f},
-std::array<float,2>{0.673723936f, 0.969322801f},
-std::array<float,2>{0.816573441f, 0.477907628f},
-std::array<float,2>{0.193528131f, 0.821420014f},
-std::array<float,2>{0.480914891f, 0.0712014064f},
-std::array<float,2>{0.714494288f, 0.65394491f},
-std::array<float,2>{0.590548038f, 0.134658948f},
-std::array<float,2>{0.276170731f, 0.56001538f},
-std::array<float,2>{0.0177672766f, 0.329821229f},
-std::array<float,2>{0.921506166f, 0.895293415f},
-std::array<float,2>{0.632353008f, 0.310601383f},
-std::array<float,2>{0.405639052f, 0.94464308f},
-std::array<float,2>{0.141429216f, 0.226225466f},
-std::array<float,2>{0.7677598f, 0.566436768f},
-std::array<float,2>{0.992007554f, 0.0485246181f},
-std::array<float,2>{0.0988206714f, 0.712445259f},
-std::array<float,2>{0.373390853f, 0.417635143f},
-std::array<float,2>{0.501710713f, 0.793208838f},
-std::array<float,2>{0.976556182f, 0.460254371f},
-std::array<float,2>{0.123512834f, 0.869666457f},
-std::array<float,2>{0.351201922f, 0.106751978f},
-std::array<float,2>{0.517440736f, 0.660643816f},
-std::array<float,2>{0.648292243f, 0.170623675f},
-std::array<float,2>{0.378078341f, 0.511980534f},
-std::array<float,2>{0.131127775f, 0.352393568f},
-std::array<float,2>{0.750742733f, 0.908146679f},
-std::array<float,2>{0.564847648f, 0.276468933f},
-std::array<float,2>{0.259020567f, 0.975344181f},
-std::array<float,2>{0.0138842743f, 0.206112623f},
-std::array<float,2>{0.937010169f, 0.61772269f},
-std::array<float,2>{0.840207517f, 0.00188263552f},
-std::array<float,2>{0.206971541f, 0.735456884f},
-std::array<float,2>{0.495171368f, 0.388425171f},
-std::array<float,2>{0.695868254f, 0.7569893f},
-std::array<float,2>{0.795542181f, 0.335596859f},
-std::array<float,2>{0.175025657f, 0.891466439f},
-std::array<float,2>{0.423519582f, 0.139488682f},
-std::array<float,2>{0.667217791f, 0.555367112f},
-std::array<float,2>{0.539617658f, 0.074530825f},
-std::array<float,2>{0.313291132f, 0.648657024f},
-std::array<float,2>{0.0765676051f, 0.480608642f},
-std::array<float,2>{0.943981767f, 0.824359f},
-std::array<float,2>{0.731614232f, 0.420896053f},
-std::array<float,2>{0.458904922f, 0.79068172f},
-std::array<float,2>{0.234237999f, 0.0507956259f},
-std::array<float,2>{0.872257471f, 0.718396544f},
-std::array<float,2>{0.887183785f, 0.221903801f},
-std::array<float,2>{0.046034757f, 0.562603056f},
-std::array<float,2>{0.308550566f, 0.305540055f},
-std::array<float,2>{0.612888873f, 0.939589262f},
-std::array<float,2>{0.906366467f, 0.288152307f},
-std::array<float,2>{0.0238234978f, 0.957130492f},
-std::array<float,2>{0.265796632f, 0.245210543f},
-std::array<float,2>{0.582979679f, 0.591667116f},
-std::array<float,2>{0.707386911f, 0.0371056348f},
-std::array<float,2>{0.469475478f, 0.696606398f},
-std::array<float,2>{0.201720372f, 0.423973083f},
-std::array<float,2>{0.826218009f, 0.809002757f},
-std::array<float,2>{0.514896929f, 0.48702094f},
-std::array<float,2>{0.36363709f, 0.838150918f},
-std::array<float,2>{0.107394293f, 0.0867887661f},
-std::array<float,2>{0.997830689f, 0.632512689f},
-std::array<float,2>{0.775103986f, 0.143632904f},
-std::array<float,2>{0.154328495f, 0.545023322f},
-std::array<float,2>{0.394512832f, 0.31624037f},
-std::array<float,2>{0.63885355f, 0.890093625f},
-std::array<float,2>{0.855172932f, 0.402625322f},
-std::array<float,2>{0.239568964f, 0.770795345f},
-std::array<float,2>{0.448298514f, 0.0167796854f},
-std::array<float,2>{0.741426766f, 0.730902731f},
-std::array<float,2>{0.604317248f, 0.193302184f},
-std::array<float,2>{0.287676454f, 0.59593749f},
-std::array<float,2>{0.0558164194f, 0.264798313f},
-std::array<float,2>{0.892579377f, 0.988297522f},
-std::array<float,2>{0.681031585f, 0.373059362f},
-std::array<float,2>{0.42119512f, 0.927219748f},
-std::array<float,2>{0.160862908f, 0.175494462f},
-std::array<float,2>{0.807491243f, 0.531121433f},
-std::array<float,2>{0.96267873f, 0.110539757f},
-std::array<float,2>{0.0921280086f, 0.680618346f},
-std::array<float,2>{0.331265032f, 0.449515611f},
-std::array<float,2>{0.555160105f, 0.853785753f},
-std::array<float,2>{0.905718386f, 0.435365081f},
-std::array<float,2>{0.0543162599f, 0.798400283f},
-std::array<float,2>{0.294082075f, 0.040344812f},
-std::array<float,2>{0.595098436f, 0.689062536f},
-std::array<float,2>{0.747123182f, 0.238982022f},
-std::array<float,2>{0.439436197f, 0.582194865f},
-std::array<float,2>{0.242215335f, 0.291831672f},
-std::array<float,2>{0.846953332f, 0.96734637f},
-std::array<float,2>{0.550836146f, 0.32268545f},
-std::array<float,2>{0.339348763f, 0.881985068f},
-std::array<float,2>{0.0853006467f, 0.150816113f},
-std::array<float,2>{0.953652143f, 0.535056651f},
-std::array<float,2>{0.797320366f, 0.07960774f},
-std::array<float,2>{0.165131137f, 0.638416052f},
-std::array<float,2>{0.40918386f, 0.498522103f},
-std::array<float,2>{0.678499579f, 0.830505848f},
-std::array<float,2>{0.815301716f, 0.256261498f},
-std::array<float,2>{0.18831642f, 0.995383382f},
-std::array<float,2>{0.479370356f, 0.202538222f},
-std::array<float,2>{0.717933118f, 0.606676996f},
-std::array<float,2>{0.587427855f, 0.0310338996f},
-std::array<float,2>{0.278910428f, 0.720278978f},
-std::array<float,2>{0.0219122339f, 0.398435742f},
-std::array<float,2>{0.916507602f, 0.778800845f},
-std::array<float,2>{0.627743602f, 0.444969386f},
-std::array<float,2>{0.401541591f, 0.85103029f},
-std::array<float,2>{0.146698639f, 0.122739322f},
-std::array<float,2>{0.772913396f, 0.677911162f},
-std::array<float,2>{0.987430334f, 0.18668732f},
-std::array<float,2>{0.0959743336f, 0.515674472f},
-std::array<float,2>{0.368745506f, 0.36090672f},
-std::array<float,2>{0.505199432f, 0.931800365f},
-std::array<float,2>{0.948933959f, 0.350989163f},
-std::array<float,2>{0.0684003979f, 0.916361213f},
-std::array<float,2>{0.322120219f, 0.158798113f},
-std::array<float,2>{0.535707712f, 0.504301727f},
-std::array<float,2>{0.660510898f, 0.0978667066f},
-std::array<float,2>{0.431739628f, 0.666261554f},
-std::array<float,2>{0.185478494f, 0.466831654f},
-std::array<float,2>{0.782864809f, 0.861548543f},
-std::array<float,2>{0.620821118f, 0.381759256f},
-std::array<float,2>{0.303665519f, 0.764453232f},
-std::array<float,2>{0.0336688682f, 0.00986343157f},
-std::array<float,2>{0.880658209f, 0.747370064f},
-std::array<float,2>{0.860214114f, 0.215205327f},
-std::array<float,2>{0.224241227f, 0.61346525f},
-std::array<float,2>{0.461169332f, 0.269230515f},
-std::array<float,2>{0.723035216f, 0.982884705f},
-std::array<float,2>{0.762930453f, 0.475647897f},
-std::array<float,2>{0.137636036f, 0.814322889f},
-std::array<float,2>{0.389457166f, 0.0639011487f},
-std::array<float,2>{0.656112909f, 0.643949807f},
-std::array<float,2>{0.530721068f, 0.128690615f},
-std::array<float,2>{0.357053876f, 0.552563012f},
-std::array<float,2>{0.109724224f, 0.3399387f},
-std::array<float,2>{0.980326653f, 0.905044138f},
-std::array<float,2>{0.693413138f, 0.297516942f},
-std::array<float,2>{0.490802735f, 0.94990468f},
-std::array<float,2>{0.215479061f, 0.233157575f},
-std::array<float,2>{0.83336401f, 0.573813677f},
-std::array<float,2>{0.923234999f, 0.0614884086f},
-std::array<float,2>{0.00735015934f, 0.70414257f},
-std::array<float,2>{0.255420983f, 0.408147484f},
-std::array<float,2>{0.574822545f, 0.785113394f},
-std::array<float,2>{0.932014763f, 0.492673099f},
-std::array<float,2>{0.00807419419f, 0.833361864f},
-std::array<float,2>{0.264985412f, 0.084034659f},
-std::array<float,2>{0.569407403f, 0.633473873f},
-std::array<float,2>{0.702701211f, 0.154778555f},
-std::array<float,2>{0.499438643f, 0.535361707f},
-std::array<float,2>{0.210428059f, 0.325052619f},
-std::array<float,2>{0.836752176f, 0.876372278f},
-std::array<float,2>{0.520169497f, 0.295558989f},
-std::array<float,2>{0.344512641f, 0.964507639f},
-std::array<float,2>{0.120679773f, 0.237530753f},
-std::array<float,2>{0.971852899f, 0.579405546f},
-std::array<float,2>{0.755478323f, 0.0442299172f},
-std::array<float,2>{0.12709707f, 0.692423999f},
-std::array<float,2>{0.38175416f, 0.430594027f},
-std::array<float,2>{0.642953277f, 0.801706254f},
-std::array<float,2>{0.869368076f, 0.364923626f},
-std::array<float,2>{0.228653193f, 0.936564088f},
-std::array<float,2>{0.454643011f, 0.182104081f},
-std::array<float,2>{0.727069616f, 0.521468818f},
-std::array<float,2>{0.617022276f, 0.120143995f},
-std::array<float,2>{0.311313331f, 0.673797548f},
-std::array<float,2>{0.0416179523f, 0.438274652f},
-std::array<float,2>{0.884416282f, 0.845381796f},
-std::array<float,2>{0.669157088f, 0.390897989f},
-std::array<float,2>{0.428696364f, 0.775103569f},
-std::array<float,2>{0.179322466f, 0.0248472206f},
-std::array<float,2>{0.791396201f, 0.725923955f},
-std::array<float,2>{0.939698219f, 0.196719825f},
-std::array<float,2>{0.0728219599f, 0.602657914f},
-std::array<float,2>{0.316776931f, 0.251250416f},
-std::array<float,2>{0.544973016f, 0.998490572f},
-std::array<float,2>{0.995605052f, 0.27235356f},
-std::array<float,2>{0.104927272f, 0.978429496f},
-std::array<float,2>{0.361175895f, 0.212644845f},
-std::array<float,2>{0.508220434f, 0.610989094f},
-std::array<float,2>{0.632843852f, 0.0119008208f},
-std::array<float,2>{0.3955926f, 0.744735003f},
-std::array<float,2>{0.15066734f, 0.377908796f},
-std::array<float,2>{0.780524373f, 0.760077298f},
-std::array<float,2>{0.57814306f, 0.461875886f},
-std::array<float,2>{0.269819856f, 0.864163935f},
-std::array<float,2>{0.0275786594f, 0.0955984145f},
-std::array<float,2>{0.91026026f, 0.670271039f},
-std::array<float,2>{0.821736813f, 0.160656124f},
-std::array<float,2>{0.198382765f, 0.500638008f},
-std::array<float,2>{0.474442482f, 0.346852779f},
-std::array<float,2>{0.703744292f, 0.918689132f},
-std::array<float,2>{0.808634877f, 0.412661135f},
-std::array<float,2>{0.158956379f, 0.785875261f},
-std::array<float,2>{0.416449308f, 0.0573012307f},
-std::array<float,2>{0.686796665f, 0.709974289f},
-std::array<float,2>{0.562002838f, 0.228408083f},
-std::array<float,2>{0.334652871f, 0.574904323f},
-std::array<float,2>{0.08761549f, 0.301419169f},
-std::array<float,2>{0.968314648f, 0.946700931f},
-std::array<float,2>{0.735208571f, 0.336596847f},
-std::array<float,2>{0.449367732f, 0.90007633f},
-std::array<float,2>{0.237078756f, 0.129522726f},
-std::array<float,2>{0.85691005f, 0.548027575f},
-std::array<float,2>{0.898347855f, 0.066989921f},
-std::array<float,2>{0.0597198606f, 0.647467017f},
-std::array<float,2>{0.281437933f, 0.470233798f},
-std::array<float,2>{0.607333422f, 0.817941189f},
-std::array<float,2>{0.958596885f, 0.384639561f},
-std::array<float,2>{0.078910023f, 0.752885401f},
-std::array<float,2>{0.340301991f, 0.00431171805f},
-std::array<float,2>{0.550052345f, 0.741370559f},
-std::array<float,2>{0.672636092f, 0.208536163f},
-std::array<float,2>{0.413309455f, 0.6217646f},
-std::array<float,2>{0.171104461f, 0.277781993f},
-std::array<float,2>{0.803943694f, 0.971072912f},
-std::array<float,2>{0.599989712f, 0.359275162f},
-std::array<float,2>{0.28924042f, 0.910891891f},
-std::array<float,2>{0.0500443727f, 0.164823785f},
-std::array<float,2>{0.900780618f, 0.510670543f},
-std::array<float,2>{0.849286616f, 0.104893468f},
-std::array<float,2>{0.2469019f, 0.659993351f},
-std::array<float,2>{0.444154531f, 0.456236511f},
-std::array<float,2>{0.743092418f, 0.872831762f},
-std::array<float,2>{0.769203544f, 0.309363872f},
-std::array<float,2>{0.142116264f, 0.941512585f},
-std::array<float,2>{0.404613763f, 0.223060668f},
-std::array<float,2>{0.63140589f, 0.570084691f},
-std::array<float,2>{0.500336111f, 0.0506464615f},
-std::array<float,2>{0.374106795f, 0.713196039f},
-std::array<float,2>{0.0983991921f, 0.415111244f},
-std::array<float,2>{0.990946531f, 0.796224952f},
-std::array<float,2>{0.71295476f, 0.480178982f},
-std::array<float,2>{0.481925905f, 0.822650135f},
-std::array<float,2>{0.19506596f, 0.0739344284f},
-std::array<float,2>{0.81819427f, 0.655993044f},
-std::array<float,2>{0.920564115f, 0.135929912f},
-std::array<float,2>{0.0188066978f, 0.560744047f},
-std::array<float,2>{0.276523948f, 0.331045926f},
-std::array<float,2>{0.591406167f, 0.897482038f},
-std::array<float,2>{0.876838326f, 0.317290813f},
-std::array<float,2>{0.0364710391f, 0.884476423f},
-std::array<float,2>{0.297616869f, 0.14770171f},
-std::array<float,2>{0.622306645f, 0.541016459f},
-std::array<float,2>{0.721817613f, 0.0916378126f},
-std::array<float,2>{0.468415797f, 0.627710462f},
-std::array<float,2>{0.222381458f, 0.489937246f},
-std::array<float,2>{0.86665839f, 0.84131974f},
-std::array<float,2>{0.534158945f, 0.428829581f},
-std::array<float,2>{0.324238151f, 0.806765318f},
-std::array<float,2>{0.0663378462f, 0.0328241289f},
-std::array<float,2>{0.949443221f, 0.7015903f},
-std::array<float,2>{0.787306249f, 0.249697983f},
-std::array<float,2>{0.180461645f, 0.58840245f},
-std::array<float,2>{0.434758246f, 0.284725785f},
-std::array<float,2>{0.657613814f, 0.955433965f},
-std::array<float,2>{0.829918683f, 0.448933303f},
-std::array<float,2>{0.214823827f, 0.857678354f},
-std::array<float,2>{0.487367094f, 0.114288837f},
-std::array<float,2>{0.690615475f, 0.686480463f},
-std::array<float,2>{0.572935879f, 0.176292688f},
-std::array<float,2>{0.251539528f, 0.523490071f},
-std::array<float,2>{0.000555636012f, 0.368563533f},
-std::array<float,2>{0.929018319f, 0.923637211f},
-std::array<float,2>{0.651675403f, 0.259234279f},
-std::array<float,2>{0.384193927f, 0.985546112f},
-std::array<float,2>{0.134923667f, 0.189569905f},
-std::array<float,2>{0.761520267f, 0.600786328f},
-std::array<float,2>{0.983498394f, 0.0233295485f},
-std::array<float,2>{0.114044145f, 0.728056312f},
-std::array<float,2>{0.354829192f, 0.401455611f},
-std::array<float,2>{0.526623487f, 0.768665016f},
-std::array<float,2>{0.943010509f, 0.483806163f},
-std::array<float,2>{0.0756456107f, 0.826568186f},
-std::array<float,2>{0.315568835f, 0.076263763f},
-std::array<float,2>{0.542384267f, 0.651841879f},
-std::array<float,2>{0.664589405f, 0.137950137f},
-std::array<float,2>{0.425487697f, 0.558567405f},
-std::array<float,2>{0.172374368f, 0.333225131f},
-std::array<float,2>{0.793314517f, 0.893572628f},
-std::array<float,2>{0.610123813f, 0.307338238f},
-std::array<float,2>{0.306183398f, 0.939389229f},
-std::array<float,2>{0.0440333895f, 0.219676077f},
-std::array<float,2>{0.889138401f, 0.564464986f},
-std::array<float,2>{0.873563826f, 0.053069178f},
-std::array<float,2>{0.231377572f, 0.71571213f},
-std::array<float,2>{0.459832132f, 0.418478101f},
-std::array<float,2>{0.732531309f, 0.791072965f},
-std::array<float,2>{0.7530213f, 0.355114788f},
-std::array<float,2>{0.129823118f, 0.908892155f},
-std::array<float,2>{0.375198871f, 0.169743299f},
-std::array<float,2>{0.646227956f, 0.515254676f},
-std::array<float,2>{0.518190563f, 0.108217768f},
-std::array<float,2>{0.348420948f, 0.663517296f},
-std::array<float,2>{0.12226636f, 0.457692206f},
-std::array<float,2>{0.974278927f, 0.868694305f},
-std::array<float,2>{0.698025346f, 0.390294194f},
-std::array<float,2>{0.493561119f, 0.754890978f},
-std::array<float,2>{0.203788146f, 0.00373675302f},
-std::array<float,2>{0.843523502f, 0.736662745f},
-std::array<float,2>{0.934647024f, 0.204255253f},
-std::array<float,2>{0.0124635492f, 0.620668173f},
-std::array<float,2>{0.259890288f, 0.2742908f},
-std::array<float,2>{0.56413579f, 0.973985553f},
-std::array<float,2>{0.890727818f, 0.262329012f},
-std::array<float,2>{0.0579302274f, 0.992084146f},
-std::array<float,2>{0.286124617f, 0.194523156f},
-std::array<float,2>{0.603364289f, 0.595234513f},
-std::array<float,2>{0.738585234f, 0.0193735622f},
-std::array<float,2>{0.447106004f, 0.734045744f},
-std::array<float,2>{0.241815835f, 0.404352307f},
-std::array<float,2>{0.852086067f, 0.772381186f},
-std::array<float,2>{0.558525562f, 0.451807886f},
-std::array<float,2>{0.329977214f, 0.853339911f},
-std::array<float,2>{0.091364339f, 0.112567492f},
-std::array<float,2>{0.963236511f, 0.68218255f},
-std::array<float,2>{0.806556284f, 0.17214112f},
-std::array<float,2>{0.163453996f, 0.52805692f},
-std::array<float,2>{0.419845074f, 0.372231573f},
-std::array<float,2>{0.68166554f, 0.928014278f},
-std::array<float,2>{0.824304283f, 0.423078239f},
-std::array<float,2>{0.200115159f, 0.811863124f},
-std::array<float,2>{0.471660674f, 0.0388056263f},
-std::array<float,2>{0.709288836f, 0.698751152f},
-std::array<float,2>{0.585215926f, 0.243113264f},
-std::array<float,2>{0.268932015f, 0.592157662f},
-std::array<float,2>{0.0262091551f, 0.285448104f},
-std::array<float,2>{0.908810556f, 0.96004504f},
-std::array<float,2>{0.637623072f, 0.312511325f},
-std::array<float,2>{0.39109388f, 0.888604164f},
-std::array<float,2>{0.154234573f, 0.141652495f},
-std::array<float,2>{0.775642157f, 0.54460758f},
-std::array<float,2>{0.99938482f, 0.088670142f},
-std::array<float,2>{0.109346561f, 0.629107058f},
-std::array<float,2>{0.366921246f, 0.485047311f},
-std::array<float,2>{0.51173836f, 0.836033285f},
-std::array<float,2>{0.915897667f, 0.3954494f},
-std::array<float,2>{0.0211565159f, 0.780105472f},
-std::array<float,2>{0.279812336f, 0.0277630836f},
-std::array<float,2>{0.589044511f, 0.722579837f},
-std::array<float,2>{0.715711355f, 0.200182676f},
-std::array<float,2>{0.478282332f, 0.607822418f},
-std::array<float,2>{0.189875618f, 0.254954815f},
-std::array<float,2>{0.813370466f, 0.994101465f},
-std::array<float,2>{0.507674336f, 0.362906396f},
-std::array<float,2>{0.371049017f, 0.931450307f},
-std::array<float,2>{0.0944769382f, 0.18390888f},
-std::array<float,2>{0.985048056f, 0.518271863f},
-std::array<float,2>{0.770067632f, 0.124539025f},
-std::array<float,2>{0.145461038f, 0.677143931f},
-std::array<float,2>{0.399411798f, 0.441632688f},
-std::array<float,2>{0.625245214f, 0.848148286f},
-std::array<float,2>{0.844296277f, 0.290878594f},
-std::array<float,2>{0.245383278f, 0.966543615f},
-std::array<float,2>{0.441312313f, 0.242086947f},
-std::array<float,2>{0.749647379f, 0.585626125f},
-std::array<float,2>{0.596939206f, 0.0423802249f},
-std::array<float,2>{0.296787232f, 0.689822555f},
-std::array<float,2>{0.0510001071f, 0.436069608f},
-std::array<float,2>{0.903915107f, 0.799559653f},
-std::array<float,2>{0.676658154f, 0.49657169f},
-std::array<float,2>{0.407713026f, 0.82855463f},
-std::array<float,2>{0.166643009f, 0.0806907937f},
-std::array<float,2>{0.800263345f, 0.639608204f},
-std::array<float,2>{0.955725491f, 0.148706913f},
-std::array<float,2>{0.0838476643f, 0.531346858f},
-std::array<float,2>{0.336969316f, 0.32123068f},
-std::array<float,2>{0.552762806f, 0.880505621f},
-std::array<float,2>{0.978282452f, 0.342023194f},
-std::array<float,2>{0.112294272f, 0.903588533f},
-std::array<float,2>{0.358596474f, 0.125160426f},
-std::array<float,2>{0.527682364f, 0.553655386f},
-std::array<float,2>{0.653711379f, 0.0657460615f},
-std::array<float,2>{0.388203651f, 0.642477036f},
-std::array<float,2>{0.139404595f, 0.473133236f},
-std::array<float,2>{0.765111983f, 0.815561056f},
-std::array<float,2>{0.576369524f, 0.409661084f},
-std::array<float,2>{0.257338196f, 0.782835245f},
-std::array<float,2>{0.00438746624f, 0.0602657795f},
-std::array<float,2>{0.925228775f, 0.706240475f},
-std::array<float,2>{0.834088445f, 0.230979457f},
-std::array<float,2>{0.217660114f, 0.571034789f},
-std::array<float,2>{0.488782525f, 0.300347477f},
-std::array<float,2>{0.693047225f, 0.951985121f},
-std::array<float,2>{0.783321798f, 0.466153204f},
-std::array<float,2>{0.187485933f, 0.860188305f},
-std::array<float,2>{0.430860221f, 0.101388946f},
-std::array<float,2>{0.663304269f, 0.665233076f},
-std::array<float,2>{0.539054632f, 0.156287968f},
-std::array<float,2>{0.322464764f, 0.506433964f},
-std::array<float,2>{0.0675723776f, 0.348125815f},
-std::array<float,2>{0.945902944f, 0.915136755f},
-std::array<float,2>{0.724861264f, 0.266754955f},
-std::array<float,2>{0.464052022f, 0.981159985f},
-std::array<float,2>{0.226456299f, 0.217774004f},
-std::array<float,2>{0.862501681f, 0.616381466f},
-std::array<float,2>{0.881757915f, 0.0085075656f},
-std::array<float,2>{0.0320137851f, 0.749560416f},
-std::array<float,2>{0.301275611f, 0.38083598f},
-std::array<float,2>{0.61726892f, 0.76182586f},
-std::array<float,2>{0.886718214f, 0.440724105f},
-std::array<float,2>{0.0393300913f, 0.845968187f},
-std::array<float,2>{0.309331864f, 0.118164808f},
-std::array<float,2>{0.613984823f, 0.674977839f},
-std::array<float,2>{0.729611456f, 0.18137756f},
-std::array<float,2>{0.457016706f, 0.523328006f},
-std::array<float,2>{0.227336466f, 0.365295529f},
-std::array<float,2>{0.868137956f, 0.933719516f},
-std::array<float,2>{0.543228984f, 0.252910972f},
-std::array<float,2>{0.318588674f, 0.996139109f},
-std::array<float,2>{0.0703626573f, 0.198245257f},
-std::array<float,2>{0.938769758f, 0.603842378f},
-std::array<float,2>{0.790338039f, 0.025940612f},
-std::array<float,2>{0.176601484f, 0.722703755f},
-std::array<float,2>{0.426647484f, 0.393669158f},
-std::array<float,2>{0.671377063f, 0.775846064f},
-std::array<float,2>{0.838725507f, 0.327302158f},
-std::array<float,2>{0.207954824f, 0.878631115f},
-std::array<float,2>{0.497271687f, 0.152448639f},
-std::array<float,2>{0.699599206f, 0.53853029f},
-std::array<float,2>{0.568341672f, 0.0831360817f},
-std::array<float,2>{0.261923432f, 0.636246026f},
-std::array<float,2>{0.00988261402f, 0.495991349f},
-std::array<float,2>{0.930288672f, 0.834112942f},
-std::array<float,2>{0.640636861f, 0.433308452f},
-std::array<float,2>{0.379141301f, 0.803739786f},
-std::array<float,2>{0.12571764f, 0.046076674f},
-std::array<float,2>{0.756523609f, 0.693592548f},
-std::array<float,2>{0.970344901f, 0.236219198f},
-std::array<float,2>{0.118887506f, 0.581792295f},
-std::array<float,2>{0.345881134f, 0.293311566f},
-std::array<float,2>{0.521975458f, 0.962379158f},
-std::array<float,2>{0.964885294f, 0.304124683f},
-std::array<float,2>{0.0885380581f, 0.949135005f},
-std::array<float,2>{0.33204782f, 0.229162902f},
-std::array<float,2>{0.559566319f, 0.576482236f},
-std::array<float,2>{0.685085356f, 0.0558513477f},
-std::array<float,2>{0.414949894f, 0.708145916f},
-std::array<float,2>{0.158198819f, 0.410728991f},
-std::array<float,2>{0.812034845f, 0.788022399f},
-std::array<float,2>{0.608250558f, 0.472160757f},
-std::array<float,2>{0.283385158f, 0.818422258f},
-std::array<float,2>{0.0623874851f, 0.0685453936f},
-std::array<float,2>{0.894597352f, 0.646294177f},
-std::array<float,2>{0.8586151f, 0.131835088f},
-std::array<float,2>{0.235671386f, 0.549036086f},
-std::array<float,2>{0.451617002f, 0.339357078f},
-std::array<float,2>{0.736663759f, 0.900727212f},
-std::array<float,2>{0.778562307f, 0.375642389f},
-std::array<float,2>{0.149301559f, 0.75929147f},
-std::array<float,2>{0.39700526f, 0.0141616603f},
-std::array<float,2>{0.635584652f, 0.743397117f},
-std::array<float,2>{0.511417806f, 0.214335084f},
-std::array<float,2>{0.362123877f, 0.61311996f},
-std::array<float,2>{0.103233695f, 0.269937366f},
-std::array<float,2>{0.992608488f, 0.978541195f},
-std::array<float,2>{0.705959558f, 0.344438404f},
-std::array<float,2>{0.474746734f, 0.921368897f},
-std::array<float,2>{0.196239009f, 0.163750321f},
-std::array<float,2>{0.822437406f, 0.503279686f},
-std::array<float,2>{0.913153231f, 0.0964059383f},
-std::array<float,2>{0.0298106242f, 0.667982936f},
-std::array<float,2>{0.271865338f, 0.463321626f},
-std::array<float,2>{0.581923246f, 0.865758359f},
-std::array<float,2>{0.98987937f, 0.416826934f},
-std::array<float,2>{0.101275139f, 0.794657171f},
-std::array<float,2>{0.372382164f, 0.0472394861f},
-std::array<float,2>{0.502646744f, 0.711281061f},
-std::array<float,2>{0.630097747f, 0.22547929f},
-std::array<float,2>{0.4032031f, 0.567810416f},
-std::array<float,2>{0.143443167f, 0.312436819f},
-std::array<float,2>{0.766683578f, 0.943415105f},
-std::array<float,2>{0.592517555f, 0.328365952f},
-std::array<float,2>{0.27523008f, 0.895536482f},
-std::array<float,2>{0.0165642574f, 0.133727878f},
-std::array<float,2>{0.919200957f, 0.559520006f},
-std::array<float,2>{0.819993615f, 0.0719155818f},
-std::array<float,2>{0.191916287f, 0.653125763f},
-std::array<float,2>{0.48380059f, 0.477461487f},
-std::array<float,2>{0.712272227f, 0.821104646f},
-std::array<float,2>{0.802396595f, 0.280457586f},
-std::array<float,2>{0.169762954f, 0.970568538f},
-std::array<float,2>{0.410973161f, 0.21091795f},
-std::array<float,2>{0.675081849f, 0.624746501f},
-std::array<float,2>{0.547211826f, 0.00690705609f},
-std::array<float,2>{0.341860592f, 0.740016818f},
-std::array<float,2>{0.0809489116f, 0.384815514f},
-std::array<float,2>{0.960403442f, 0.750137269f},
-std::array<float,2>{0.744625688f, 0.454158843f},
-std::array<float,2>{0.441946745f, 0.874499679f},
-std::array<float,2>{0.248256624f, 0.102920182f},
-std::array<float,2>{0.850527942f, 0.657860577f},
-std::array<float,2>{0.899335027f, 0.16661796f},
-std::array<float,2>{0.0480174609f, 0.508056223f},
-std::array<float,2>{0.291444421f, 0.357010216f},
-std::array<float,2>{0.599539995f, 0.91240114f},
-std::array<float,2>{0.927361012f, 0.369974375f},
-std::array<float,2>{0.00268991059f, 0.925023079f},
-std::array<float,2>{0.252045929f, 0.178011388f},
-std::array<float,2>{0.570957422f, 0.526801944f},
-std::array<float,2>{0.688624144f, 0.116577201f},
-std::array<float,2>{0.486206323f, 0.685347021f},
-std::array<float,2>{0.212317437f, 0.446203053f},
-std::array<float,2>{0.830549181f, 0.856777847f},
-std::array<float,2>{0.523849964f, 0.400067657f},
-std::array<float,2>{0.351588368f, 0.767300785f},
-std::array<float,2>{0.11688327f, 0.0209547151f},
-std::array<float,2>{0.981256425f, 0.728690565f},
-std::array<float,2>{0.758222401f, 0.189213365f},
-std::array<float,2>{0.13359727f, 0.598033607f},
-std::array<float,2>{0.385353357f, 0.261703372f},
-std::array<float,2>{0.649693429f, 0.987514317f},
-std::array<float,2>{0.864928961f, 0.490882874f},
-std::array<float,2>{0.219161972f, 0.84239763f},
-std::array<float,2>{0.465738893f, 0.0927150697f},
-std::array<float,2>{0.720390618f, 0.626443028f},
-std::array<float,2>{0.624039769f, 0.144953415f},
-std::array<float,2>{0.30031845f, 0.540273249f},
-std::array<float,2>{0.0373158567f, 0.319067985f},
-std::array<float,2>{0.877441585f, 0.885667264f},
-std::array<float,2>{0.658757806f, 0.282829404f},
-std::array<float,2>{0.437311858f, 0.953742564f},
-std::array<float,2>{0.182701036f, 0.247956067f},
-std::array<float,2>{0.786015689f, 0.587587893f},
-std::array<float,2>{0.952735603f, 0.0336598381f},
-std::array<float,2>{0.0634847134f, 0.700391889f},
-std::array<float,2>{0.326248229f, 0.427579105f},
-std::array<float,2>{0.532767415f, 0.806438267f},
-std::array<float,2>{0.945747137f, 0.467762262f},
-std::array<float,2>{0.0682832226f, 0.861936629f},
-std::array<float,2>{0.32313773f, 0.0982121155f},
-std::array<float,2>{0.538150847f, 0.666815162f},
-std::array<float,2>{0.663993418f, 0.158612058f},
-std::array<float,2>{0.431592971f, 0.504688144f},
-std::array<float,2>{0.186753005f, 0.351111948f},
-std::array<float,2>{0.783753872f, 0.916793644f},
-std::array<float,2>{0.618087471f, 0.269003063f},
-std::array<float,2>{0.301205754f, 0.983279049f},
-std::array<float,2>{0.0315645672f, 0.215754285f},
-std::array<float,2>{0.881057262f, 0.613859415f},
-std::array<float,2>{0.862930536f, 0.0102881743f},
-std::array<float,2>{0.225623757f, 0.747724235f},
-std::array<float,2>{0.464512587f, 0.381134927f},
-std::array<float,2>{0.725177944f, 0.763880253f},
-std::array<float,2>{0.765286624f, 0.340718627f},
-std::array<float,2>{0.138877019f, 0.904732645f},
-std::array<float,2>{0.388109148f, 0.127961352f},
-std::array<float,2>{0.654259026f, 0.552242994f},
-std::array<float,2>{0.528273761f, 0.0643488765f},
-std::array<float,2>{0.359272778f, 0.644449651f},
-std::array<float,2>{0.111805156f, 0.476091415f},
-std::array<float,2>{0.977590263f, 0.813527465f},
-std::array<float,2>{0.692473412f, 0.407712907f},
-std::array<float,2>{0.488688052f, 0.78433609f},
-std::array<float,2>{0.217041507f, 0.0610209666f},
-std::array<float,2>{0.834803343f, 0.704671025f},
-std::array<float,2>{0.925334275f, 0.23276931f},
-std::array<float,2>{0.00462759938f, 0.573325694f},
-std::array<float,2>{0.257072359f, 0.296992064f},
-std::array<float,2>{0.576876223f, 0.94963479f},
-std::array<float,2>{0.903512597f, 0.291259348f},
-std::array<float,2>{0.0515441895f, 0.967269778f},
-std::array<float,2>{0.296183944f, 0.23866871f},
-std::array<float,2>{0.597191513f, 0.582560837f},
-std::array<float,2>{0.749342084f, 0.0406314619f},
-std::array<float,2>{0.440810442f, 0.688777924f},
-std::array<float,2>{0.246079266f, 0.43469581f},
-std::array<float,2>{0.844050705f, 0.798199713f},
-std::array<float,2>{0.553283036f, 0.498697996f},
-std::array<float,2>{0.337599576f, 0.830935359f},
-std::array<float,2>{0.0834928751f, 0.0791527554f},
-std::array<float,2>{0.955465794f, 0.637739718f},
-std::array<float,2>{0.800635219f, 0.151106477f},
-std::array<float,2>{0.166339442f, 0.534263015f},
-std::array<float,2>{0.407941252f, 0.322948873f},
-std::array<float,2>{0.675843954f, 0.882461607f},
-std::array<float,2>{0.812588513f, 0.397844821f},
-std::array<float,2>{0.190177321f, 0.779117048f},
-std::array<float,2>{0.477961928f, 0.0307037067f},
-std::array<float,2>{0.715094626f, 0.719979823f},
-std::array<float,2>{0.589632034f, 0.202723503f},
-std::array<float,2>{0.279317081f, 0.60737896f},
-std::array<float,2>{0.020621784f, 0.256577075f},
-std::array<float,2>{0.915308535f, 0.995667994f},
-std::array<float,2>{0.625617921f, 0.360489398f},
-std::array<float,2>{0.398712307f, 0.932513058f},
-std::array<float,2>{0.14474833f, 0.187049016f},
-std::array<float,2>{0.769903421f, 0.516348541f},
-std::array<float,2>{0.984769404f, 0.122389287f},
-std::array<float,2>{0.0937777609f, 0.678527117f},
-std::array<float,2>{0.37037158f, 0.444575757f},
-std::array<float,2>{0.506897092f, 0.851350904f},
-std::array<float,2>{0.908564448f, 0.424531609f},
-std::array<float,2>{0.0256273802f, 0.809125841f},
-std::array<float,2>{0.269161493f, 0.0363356285f},
-std::array<float,2>{0.585676849f, 0.696944773f},
-std::array<float,2>{0.709951758f, 0.245640054f},
-std::array<float,2>{0.470825762f, 0.591106176f},
-std::array<float,2>{0.199272454f, 0.288984507f},
-std::array<float,2>{0.824969172f, 0.957797647f},
-std::array<float,2>{0.512393117f, 0.315694064f},
-std::array<float,2>{0.366434127f, 0.890466452f},
-std::array<float,2>{0.108688056f, 0.144064143f},
-std::array<float,2>{0.999677837f, 0.54573679f},
-std::array<float,2>{0.776301801f, 0.0862630978f},
-std::array<float,2>{0.153802842f, 0.631890178f},
-std::array<float,2>{0.391133577f, 0.486455977f},
-std::array<float,2>{0.637161374f, 0.838573694f},
-std::array<float,2>{0.852044463f, 0.265311897f},
-std::array<float,2>{0.241543636f, 0.989140391f},
-std::array<float,2>{0.44650051f, 0.192864195f},
-std::array<float,2>{0.739248812f, 0.596517801f},
-std::array<float,2>{0.603020489f, 0.0172582958f},
-std::array<float,2>{0.2853311f, 0.731226385f},
-std::array<float,2>{0.0583011657f, 0.403286964f},
-std::array<float,2>{0.891210854f, 0.771470547f},
-std::array<float,2>{0.682416797f, 0.449895144f},
-std::array<float,2>{0.419041455f, 0.854489267f},
-std::array<float,2>{0.163903177f, 0.110865571f},
-std::array<float,2>{0.80572325f, 0.680116653f},
-std::array<float,2>{0.96340549f, 0.175251007f},
-std::array<float,2>{0.0909103528f, 0.530666411f},
-std::array<float,2>{0.329149812f, 0.374014258f},
-std::array<float,2>{0.557920575f, 0.927489042f},
-std::array<float,2>{0.97397697f, 0.351790994f},
-std::array<float,2>{0.122683197f, 0.907650352f},
-std::array<float,2>{0.347834289f, 0.17027995f},
-std::array<float,2>{0.51781255f, 0.512296498f},
-std::array<float,2>{0.645970166f, 0.106943041f},
-std::array<float,2>{0.375570774f, 0.660681486f},
-std::array<float,2>{0.12933588f, 0.460800946f},
-std::array<float,2>{0.753548384f, 0.869339406f},
-std::array<float,2>{0.563749075f, 0.387720287f},
-std::array<float,2>{0.26067546f, 0.757458508f},
-std::array<float,2>{0.011787978f, 0.00137759f},
-std::array<float,2>{0.935452223f, 0.736305296f},
-std::array<float,2>{0.842915475f, 0.20669505f},
-std::array<float,2>{0.203281701f, 0.61757642f},
-std::array<float,2>{0.493930221f, 0.276952505f},
-std::array<float,2>{0.697330832f, 0.974996626f},
-std::array<float,2>{0.793533087f, 0.48129335f},
-std::array<float,2>{0.172183126f, 0.824797511f},
-std::array<float,2>{0.425169796f, 0.0751103982f},
-std::array<float,2>{0.664220214f, 0.649181783f},
-std::array<float,2>{0.54290396f, 0.138736069f},
-std::array<float,2>{0.316083938f, 0.555074036f},
-std::array<float,2>{0.0759776235f, 0.335099131f},
-std::array<float,2>{0.942389667f, 0.890794277f},
-std::array<float,2>{0.733274341f, 0.304709822f},
-std::array<float,2>{0.459189892f, 0.940366566f},
-std::array<float,2>{0.23047784f, 0.222647309f},
-std::array<float,2>{0.873181522f, 0.56323117f},
-std::array<float,2>{0.889608204f, 0.0513202883f},
-std::array<float,2>{0.044638861f, 0.718173087f},
-std::array<float,2>{0.30604443f, 0.420052648f},
-std::array<float,2>{0.609701276f, 0.790402114f},
-std::array<float,2>{0.877296209f, 0.489258766f},
-std::array<float,2>{0.0379618779f, 0.840846479f},
-std::array<float,2>{0.300249696f, 0.0908931494f},
-std::array<float,2>{0.624751508f, 0.627108634f},
-std::array<float,2>{0.720089555f, 0.148171067f},
-std::array<float,2>{0.464847207f, 0.541920781f},
-std::array<float,2>{0.219320476f, 0.316778362f},
-std::array<float,2>{0.864686191f, 0.884148777f},
-std::array<float,2>{0.532586694f, 0.284601003f},
-std::array<float,2>{0.326922327f, 0.955802202f},
-std::array<float,2>{0.0639707223f, 0.249500513f},
-std::array<float,2>{0.952610373f, 0.588103235f},
-std::array<float,2>{0.785227299f, 0.0324954055f},
-std::array<float,2>{0.183305264f, 0.702124476f},
-std::array<float,2>{0.43670541f, 0.429472715f},
-std::array<float,2>{0.658587694f, 0.807493567f},
-std::array<float,2>{0.83080709f, 0.368783653f},
-std::array<float,2>{0.21241425f, 0.923012912f},
-std::array<float,2>{0.485524207f, 0.175835386f},
-std::array<float,2>{0.689312875f, 0.523985267f},
-std::array<float,2>{0.570623577f, 0.114940599f},
-std::array<float,2>{0.252738565f, 0.685562193f},
-std::array<float,2>{0.00212442386f, 0.448719054f},
-std::array<float,2>{0.927019477f, 0.858078718f},
-std::array<float,2>{0.650275409f, 0.401962638f},
-std::array<float,2>{0.384929329f, 0.769357741f},
-std::array<float,2>{0.133279115f, 0.0227172319f},
-std::array<float,2>{0.758513749f, 0.727847099f},
-std::array<float,2>{0.980841875f, 0.190080285f},
-std::array<float,2>{0.11632356f, 0.601284623f},
-std::array<float,2>{0.352307498f, 0.25943768f},
-std::array<float,2>{0.523939013f, 0.986148834f},
-std::array<float,2>{0.96064955f, 0.278084397f},
-std::array<float,2>{0.080283612f, 0.971439183f},
-std::array<float,2>{0.342467457f, 0.208066151f},
-std::array<float,2>{0.547571778f, 0.621546149f},
-std::array<float,2>{0.675416172f, 0.00455151126f},
-std::array<float,2>{0.410515517f, 0.741899371f},
-std::array<float,2>{0.169224232f, 0.383825123f},
-std::array<float,2>{0.801901639f, 0.752418756f},
-std::array<float,2>{0.598689377f, 0.45673126f},
-std::array<float,2>{0.291736275f, 0.872133553f},
-std::array<float,2>{0.0483414903f, 0.105346009f},
-std::array<float,2>{0.898757696f, 0.659632921f},
-std::array<float,2>{0.84987551f, 0.164318845f},
-std::array<float,2>{0.248861179f, 0.509955525f},
-std::array<float,2>{0.441853076f, 0.358847022f},
-std::array<float,2>{0.744994581f, 0.91032815f},
-std::array<float,2>{0.767359197f, 0.415775239f},
-std::array<float,2>{0.142982081f, 0.796670258f},
-std::array<float,2>{0.402767569f, 0.0502759069f},
-std::array<float,2>{0.630568027f, 0.713713884f},
-std::array<float,2>{0.501976073f, 0.223374575f},
-std::array<float,2>{0.372837722f, 0.569355547f},
-std::array<float,2>{0.100680709f, 0.308873892f},
-std::array<float,2>{0.989709616f, 0.942057729f},
-std::array<float,2>{0.712855339f, 0.330459088f},
-std::array<float,2>{0.484234124f, 0.898325086f},
-std::array<float,2>{0.191445723f, 0.136635661f},
-std::array<float,2>{0.819503307f, 0.561377406f},
-std::array<float,2>{0.919793427f, 0.0735715404f},
-std::array<float,2>{0.0157421771f, 0.655693114f},
-std::array<float,2>{0.274698287f, 0.479742348f},
-std::array<float,2>{0.592140198f, 0.822876275f},
-std::array<float,2>{0.992687881f, 0.377205282f},
-std::array<float,2>{0.102721237f, 0.760705233f},
-std::array<float,2>{0.361513346f, 0.0122930408f},
-std::array<float,2>{0.51088959f, 0.7443344f},
-std::array<float,2>{0.634769738f, 0.212327167f},
-std::array<float,2>{0.39649123f, 0.610793531f},
-std::array<float,2>{0.148859024f, 0.271505028f},
-std::array<float,2>{0.778838158f, 0.977659881f},
-std::array<float,2>{0.581474543f, 0.347181708f},
-std::array<float,2>{0.272268534f, 0.918236256f},
-std::array<float,2>{0.0294225868f, 0.160266563f},
-std::array<float,2>{0.913662553f, 0.500366926f},
-std::array<float,2>{0.823124409f, 0.0950493291f},
-std::array<float,2>{0.195663363f, 0.670595169f},
-std::array<float,2>{0.475469142f, 0.461059242f},
-std::array<float,2>{0.705362618f, 0.863291264f},
-std::array<float,2>{0.811561704f, 0.301163435f},
-std::array<float,2>{0.15762274f, 0.947160006f},
-std::array<float,2>{0.414353758f, 0.227712497f},
-std::array<float,2>{0.684687555f, 0.574424744f},
-std::array<float,2>{0.55870986f, 0.0568028539f},
-std::array<float,2>{0.33290118f, 0.710843027f},
-std::array<float,2>{0.0879777148f, 0.412592649f},
-std::array<float,2>{0.965712011f, 0.785478413f},
-std::array<float,2>{0.736991584f, 0.470211953f},
-std::array<float,2>{0.452027589f, 0.817860663f},
-std::array<float,2>{0.23603572f, 0.0664085969f},
-std::array<float,2>{0.859181643f, 0.648359478f},
-std::array<float,2>{0.895368278f, 0.128907546f},
-std::array<float,2>{0.0619757324f, 0.548707128f},
-std::array<float,2>{0.28379488f, 0.336390585f},
-std::array<float,2>{0.60755235f, 0.899571419f},
-std::array<float,2>{0.930116177f, 0.324598461f},
-std::array<float,2>{0.0105648311f, 0.876524568f},
-std::array<float,2>{0.262420982f, 0.155196428f},
-std::array<float,2>{0.567549288f, 0.536028922f},
-std::array<float,2>{0.700030804f, 0.0849164501f},
-std::array<float,2>{0.497615576f, 0.632915735f},
-std::array<float,2>{0.207344785f, 0.493084371f},
-std::array<float,2>{0.838221312f, 0.833789408f},
-std::array<float,2>{0.521763742f, 0.429830551f},
-std::array<float,2>{0.346653849f, 0.801121235f},
-std::array<float,2>{0.11861074f, 0.0449182987f},
-std::array<float,2>{0.970205247f, 0.693184137f},
-std::array<float,2>{0.756149948f, 0.237914056f},
-std::array<float,2>{0.125236735f, 0.579704404f},
-std::array<float,2>{0.379480511f, 0.295155823f},
-std::array<float,2>{0.641165257f, 0.963919401f},
-std::array<float,2>{0.867536902f, 0.437553555f},
-std::array<float,2>{0.226596192f, 0.844891012f},
-std::array<float,2>{0.456222594f, 0.120640494f},
-std::array<float,2>{0.73016125f, 0.67320025f},
-std::array<float,2>{0.61376816f, 0.182433054f},
-std::array<float,2>{0.308900863f, 0.520532906f},
-std::array<float,2>{0.0397497676f, 0.364365965f},
-std::array<float,2>{0.885975182f, 0.937230885f},
-std::array<float,2>{0.671614051f, 0.251857072f},
-std::array<float,2>{0.425793886f, 0.998834908f},
-std::array<float,2>{0.176103592f, 0.197050363f},
-std::array<float,2>{0.790823579f, 0.603249013f},
-std::array<float,2>{0.939080656f, 0.0252608526f},
-std::array<float,2>{0.0709276199f, 0.726346076f},
-std::array<float,2>{0.31914863f, 0.391466916f},
-std::array<float,2>{0.543628454f, 0.774863541f},
-std::array<float,2>{0.979922414f, 0.473506451f},
-std::array<float,2>{0.110041216f, 0.815933883f},
-std::array<float,2>{0.356836259f, 0.0660520643f},
-std::array<float,2>{0.531103849f, 0.641968191f},
-std::array<float,2>{0.655311882f, 0.125498936f},
-std::array<float,2>{0.388752282f, 0.552739382f},
-std::array<float,2>{0.137144864f, 0.342388511f},
-std::array<float,2>{0.763460636f, 0.904217005f},
-std::array<float,2>{0.574671745f, 0.300023109f},
-std::array<float,2>{0.254916281f, 0.951182961f},
-std::array<float,2>{0.00702193752f, 0.230892494f},
-std::array<float,2>{0.923448563f, 0.570782006f},
-std::array<float,2>{0.833600521f, 0.059839163f},
-std::array<float,2>{0.215158761f, 0.706883132f},
-std::array<float,2>{0.490698487f, 0.409864545f},
-std::array<float,2>{0.694312334f, 0.78244251f},
-std::array<float,2>{0.782295942f, 0.348440647f},
-std::array<float,2>{0.184701979f, 0.916012287f},
-std::array<float,2>{0.432344615f, 0.157165378f},
-std::array<float,2>{0.661088109f, 0.5062958f},
-std::array<float,2>{0.535341859f, 0.100661747f},
-std::array<float,2>{0.321651548f, 0.665646017f},
-std::array<float,2>{0.0688567311f, 0.466346025f},
-std::array<float,2>{0.948351324f, 0.859578371f},
-std::array<float,2>{0.723160863f, 0.380113333f},
-std::array<float,2>{0.46168834f, 0.762264132f},
-std::array<float,2>{0.223712996f, 0.00792364404f},
-std::array<float,2>{0.859657288f, 0.749306679f},
-std::array<float,2>{0.880244434f, 0.218672305f},
-std::array<float,2>{0.0338653661f, 0.617038548f},
-std::array<float,2>{0.303191721f, 0.26717177f},
-std::array<float,2>{0.620265126f, 0.980507851f},
-std::array<float,2>{0.916442037f, 0.255571842f},
-std::array<float,2>{0.0220222119f, 0.993393779f},
-std::array<float,2>{0.278340191f, 0.199318975f},
-std::array<float,2>{0.587349594f, 0.608281732f},
-std::array<float,2>{0.718499124f, 0.0279063098f},
-std::array<float,2>{0.4787471f, 0.722126603f},
-std::array<float,2>{0.18771711f, 0.394733042f},
-std::array<float,2>{0.814765275f, 0.779667318f},
-std::array<float,2>{0.505679429f, 0.442285925f},
-std::array<float,2>{0.368518233f, 0.847990751f},
-std::array<float,2>{0.0966622829f, 0.124124773f},
-std::array<float,2>{0.988044381f, 0.67735225f},
-std::array<float,2>{0.773306191f, 0.184544221f},
-std::array<float,2>{0.146996722f, 0.517683387f},
-std::array<float,2>{0.40227133f, 0.362647235f},
-std::array<float,2>{0.627385974f, 0.93075633f},
-std::array<float,2>{0.847354054f, 0.436007231f},
-std::array<float,2>{0.24298124f, 0.799090564f},
-std::array<float,2>{0.438626856f, 0.0427271388f},
-std::array<float,2>{0.747865081f, 0.690204322f},
-std::array<float,2>{0.595634758f, 0.241682515f},
-std::array<float,2>{0.294626772f, 0.585293233f},
-std::array<float,2>{0.053833805f, 0.290162235f},
-std::array<float,2>{0.906074166f, 0.965862811f},
-std::array<float,2>{0.677882493f, 0.320331693f},
-std::array<float,2>{0.409785569f, 0.879907846f},
-std::array<float,2>{0.16585806f, 0.14936544f},
-std::array<float,2>{0.797632873f, 0.532179832f},
-std::array<float,2>{0.953463852f, 0.0803039521f},
-std::array<float,2>{0.0855527595f, 0.638729811f},
-std::array<float,2>{0.339586109f, 0.496664882f},
-std::array<float,2>{0.551624417f, 0.828686774f},
-std::array<float,2>{0.893299699f, 0.404883534f},
-std::array<float,2>{0.0565969013f, 0.771722794f},
-std::array<float,2>{0.287530869f, 0.0187407024f},
-std::array<float,2>{0.603665292f, 0.733654916f},
-std::array<float,2>{0.741769314f, 0.195189089f},
-std::array<float,2>{0.448770821f, 0.59514904f},
-std::array<float,2>{0.240204588f, 0.261956334f},
-std::array<float,2>{0.854870021f, 0.991511047f},
-std::array<float,2>{0.555647075f, 0.372778565f},
-std::array<float,2>{0.331607431f, 0.92840457f},
-std::array<float,2>{0.0926414803f, 0.172462434f},
-std::array<float,2>{0.962382436f, 0.527665555f},
-std::array<float,2>{0.806895852f, 0.112800948f},
-std::array<float,2>{0.160541296f, 0.681839406f},
-std::array<float,2>{0.421399325f, 0.451524258f},
-std::array<float,2>{0.681319296f, 0.852952003f},
-std::array<float,2>{0.826845527f, 0.2860201f},
-std::array<float,2>{0.201261252f, 0.960540414f},
-std::array<float,2>{0.469042957f, 0.242307708f},
-std::array<float,2>{0.707935572f, 0.592555583f},
-std::array<float,2>{0.582136691f, 0.0382927544f},
-std::array<float,2>{0.266552418f, 0.698317945f},
-std::array<float,2>{0.024388168f, 0.423720419f},
-std::array<float,2>{0.906888425f, 0.812257886f},
-std::array<float,2>{0.639294982f, 0.48442319f},
-std::array<float,2>{0.393694967f, 0.836785257f},
-std::array<float,2>{0.155212075f, 0.0883431435f},
-std::array<float,2>{0.774896264f, 0.629655838f},
-std::array<float,2>{0.997423172f, 0.14216499f},
-std::array<float,2>{0.106549226f, 0.544250786f},
-std::array<float,2>{0.36380136f, 0.313405871f},
-std::array<float,2>{0.515286267f, 0.887816489f},
-std::array<float,2>{0.94377929f, 0.33360666f},
-std::array<float,2>{0.0768792629f, 0.89406991f},
-std::array<float,2>{0.312769443f, 0.138410985f},
-std::array<float,2>{0.53932488f, 0.557690978f},
-std::array<float,2>{0.667622864f, 0.0770154521f},
-std::array<float,2>{0.423089027f, 0.652042329f},
-std::array<float,2>{0.175521478f, 0.484008044f},
-std::array<float,2>{0.795025349f, 0.827118933f},
-std::array<float,2>{0.612487793f, 0.418177128f},
-std::array<float,2>{0.307924837f, 0.791710258f},
-std::array<float,2>{0.0466036573f, 0.053535413f},
-std::array<float,2>{0.887491882f, 0.715228379f},
-std::array<float,2>{0.872680724f, 0.219164282f},
-std::array<float,2>{0.233652934f, 0.565122664f},
-std::array<float,2>{0.458422482f, 0.306678832f},
-std::array<float,2>{0.732326269f, 0.93880415f},
-std::array<float,2>{0.750045955f, 0.45711568f},
-std::array<float,2>{0.131711483f, 0.868394792f},
-std::array<float,2>{0.378576219f, 0.107755132f},
-std::array<float,2>{0.647651494f, 0.66399765f},
-std::array<float,2>{0.516985536f, 0.169032514f},
-std::array<float,2>{0.350636482f, 0.51479739f},
-std::array<float,2>{0.123946086f, 0.354502767f},
-std::array<float,2>{0.97567749f, 0.908450425f},
-std::array<float,2>{0.695479989f, 0.273696959f},
-std::array<float,2>{0.496019393f, 0.974427938f},
-std::array<float,2>{0.206353649f, 0.204903588f},
-std::array<float,2>{0.840706289f, 0.620524466f},
-std::array<float,2>{0.937222123f, 0.00305489381f},
-std::array<float,2>{0.014643711f, 0.737165749f},
-std::array<float,2>{0.259542525f, 0.389851213f},
-std::array<float,2>{0.565153122f, 0.755516887f},
-std::array<float,2>{0.92962563f, 0.445368081f},
-std::array<float,2>{0.000358041434f, 0.857413888f},
-std::array<float,2>{0.250977576f, 0.117110454f},
-std::array<float,2>{0.572731495f, 0.684891701f},
-std::array<float,2>{0.69137764f, 0.178603157f},
-std::array<float,2>{0.488041937f, 0.527207553f},
-std::array<float,2>{0.214001298f, 0.36944136f},
-std::array<float,2>{0.829139769f, 0.925733984f},
-std::array<float,2>{0.526928663f, 0.261160642f},
-std::array<float,2>{0.355256438f, 0.987977803f},
-std::array<float,2>{0.113633685f, 0.188668415f},
-std::array<float,2>{0.983887255f, 0.598568022f},
-std::array<float,2>{0.761002898f, 0.0210604239f},
-std::array<float,2>{0.135432839f, 0.729428172f},
-std::array<float,2>{0.384577066f, 0.399477422f},
-std::array<float,2>{0.651938796f, 0.766756356f},
-std::array<float,2>{0.866856158f, 0.318614691f},
-std::array<float,2>{0.221850246f, 0.884855986f},
-std::array<float,2>{0.467927665f, 0.145151734f},
-std::array<float,2>{0.722286642f, 0.540769517f},
-std::array<float,2>{0.622944355f, 0.0917984024f},
-std::array<float,2>{0.297019064f, 0.626734436f},
-std::array<float,2>{0.0367465205f, 0.490299046f},
-std::array<float,2>{0.876085937f, 0.842279434f},
-std::array<float,2>{0.65809381f, 0.426784962f},
-std::array<float,2>{0.435199708f, 0.805889547f},
-std::array<float,2>{0.179977059f, 0.0340223424f},
-std::array<float,2>{0.788083434f, 0.700937748f},
-std::array<float,2>{0.949981511f, 0.247292951f},
-std::array<float,2>{0.0655123815f, 0.586963713f},
-std::array<float,2>{0.324735492f, 0.282320946f},
-std::array<float,2>{0.533434451f, 0.953472495f},
-std::array<float,2>{0.990420818f, 0.311802685f},
-std::array<float,2>{0.0976910666f, 0.943945169f},
-std::array<float,2>{0.374880999f, 0.224789456f},
-std::array<float,2>{0.50085187f, 0.568349063f},
-std::array<float,2>{0.631011724f, 0.0475252233f},
-std::array<float,2>{0.405109167f, 0.711890817f},
-std::array<float,2>{0.141706869f, 0.416162193f},
-std::array<float,2>{0.768760383f, 0.79422152f},
-std::array<float,2>{0.590901196f, 0.477038413f},
-std::array<float,2>{0.277226061f, 0.820633233f},
-std::array<float,2>{0.0192580782f, 0.0717479289f},
-std::array<float,2>{0.919994533f, 0.652642369f},
-std::array<float,2>{0.81763494f, 0.132935449f},
-std::array<float,2>{0.194598183f, 0.558959246f},
-std::array<float,2>{0.482142538f, 0.328840971f},
-std::array<float,2>{0.713417232f, 0.896156907f},
-std::array<float,2>{0.804674447f, 0.385282367f},
-std::array<float,2>{0.171775207f, 0.750775278f},
-std::array<float,2>{0.413615108f, 0.0076922928f},
-std::array<float,2>{0.672184467f, 0.739704669f},
-std::array<float,2>{0.550619125f, 0.210365266f},
-std::array<float,2>{0.340703785f, 0.624462605f},
-std::array<float,2>{0.078530103f, 0.281226844f},
-std::array<float,2>{0.958027542f, 0.970165312f},
-std::array<float,2>{0.742442846f, 0.356839627f},
-std::array<float,2>{0.443748027f, 0.912995577f},
-std::array<float,2>{0.246429667f, 0.166365683f},
-std::array<float,2>{0.849072397f, 0.50831902f},
-std::array<float,2>{0.901288688f, 0.103281364f},
-std::array<float,2>{0.0505425446f, 0.657494068f},
-std::array<float,2>{0.289575398f, 0.454992801f},
-std::array<float,2>{0.600267708f, 0.874674916f},
-std::array<float,2>{0.968248248f, 0.410472691f},
-std::array<float,2>{0.0869612992f, 0.787522435f},
-std::array<float,2>{0.334418029f, 0.0565749854f},
-std::array<float,2>{0.56230545f, 0.708937347f},
-std::array<float,2>{0.687097251f, 0.228918448f},
-std::array<float,2>{0.416911006f, 0.577133119f},
-std::array<float,2>{0.158587143f, 0.304267257f},
-std::array<float,2>{0.809090674f, 0.948391438f},
-std::array<float,2>{0.606717587f, 0.339024723f},
-std::array<float,2>{0.281770617f, 0.900986493f},
-std::array<float,2>{0.0604271106f, 0.130889207f},
-std::array<float,2>{0.897913516f, 0.549358726f},
-std::array<float,2>{0.857347846f, 0.0691348538f},
-std::array<float,2>{0.23638019f, 0.645732403f},
-std::array<float,2>{0.449903369f, 0.472220093f},
-std::array<float,2>{0.734839499f, 0.819295645f},
-std::array<float,2>{0.780888557f, 0.270136774f},
-std::array<float,2>{0.151167482f, 0.97906971f},
-std::array<float,2>{0.396172792f, 0.214493319f},
-std::array<float,2>{0.633503139f, 0.612550557f},
-std::array<float,2>{0.508772135f, 0.0138173085f},
-std::array<float,2>{0.360712558f, 0.744088948f},
-std::array<float,2>{0.105233192f, 0.375456899f},
-std::array<float,2>{0.995621443f, 0.758889675f},
-std::array<float,2>{0.70351392f, 0.463857174f},
-std::array<float,2>{0.47394383f, 0.865361333f},
-std::array<float,2>{0.1989806f, 0.0959012732f},
-std::array<float,2>{0.82225728f, 0.6685673f},
-std::array<float,2>{0.910681129f, 0.163284212f},
-std::array<float,2>{0.0282389428f, 0.503612459f},
-std::array<float,2>{0.270198554f, 0.344166934f},
-std::array<float,2>{0.578806818f, 0.921809137f},
-std::array<float,2>{0.88392669f, 0.366149783f},
-std::array<float,2>{0.0412477478f, 0.934569538f},
-std::array<float,2>{0.310557365f, 0.180904433f},
-std::array<float,2>{0.616232216f, 0.522624433f},
-std::array<float,2>{0.726576269f, 0.118899561f},
-std::array<float,2>{0.454440087f, 0.675479531f},
-std::array<float,2>{0.229194269f, 0.441124618f},
-std::array<float,2>{0.870097876f, 0.846586049f},
-std::array<float,2>{0.545635819f, 0.394501507f},
-std::array<float,2>{0.317130893f, 0.776323557f},
-std::array<float,2>{0.0723540559f, 0.025642639f},
-std::array<float,2>{0.940083385f, 0.723512471f},
-std::array<float,2>{0.791766763f, 0.198933005f},
-std::array<float,2>{0.179176152f, 0.604215324f},
-std::array<float,2>{0.427854389f, 0.252136737f},
-std::array<float,2>{0.669846594f, 0.996783912f},
-std::array<float,2>{0.836364448f, 0.495551825f},
-std::array<float,2>{0.210613057f, 0.834647417f},
-std::array<float,2>{0.499814481f, 0.0837529749f},
-std::array<float,2>{0.702275336f, 0.635878921f},
-std::array<float,2>{0.570147574f, 0.153115764f},
-std::array<float,2>{0.265412062f, 0.538587868f},
-std::array<float,2>{0.00852837041f, 0.327896506f},
-std::array<float,2>{0.93221575f, 0.878247976f},
-std::array<float,2>{0.643212974f, 0.293560147f},
-std::array<float,2>{0.381008476f, 0.962538838f},
-std::array<float,2>{0.127709076f, 0.235395014f},
-std::array<float,2>{0.754896462f, 0.581278801f},
-std::array<float,2>{0.972565711f, 0.0465629734f},
-std::array<float,2>{0.120476171f, 0.694316208f},
-std::array<float,2>{0.344209343f, 0.432935089f},
-std::array<float,2>{0.519890964f, 0.804685533f},
-std::array<float,2>{0.986752629f, 0.444203973f},
-std::array<float,2>{0.0974089131f, 0.850270867f},
-std::array<float,2>{0.367523015f, 0.121320553f},
-std::array<float,2>{0.504099309f, 0.679647565f},
-std::array<float,2>{0.62843883f, 0.186426312f},
-std::array<float,2>{0.400855005f, 0.517482042f},
-std::array<float,2>{0.147677019f, 0.360345393f},
-std::array<float,2>{0.771664441f, 0.933585882f},
-std::array<float,2>{0.585978508f, 0.257139564f},
-std::array<float,2>{0.278261572f, 0.994712591f},
-std::array<float,2>{0.0228308383f, 0.20194982f},
-std::array<float,2>{0.917708993f, 0.606359184f},
-std::array<float,2>{0.81612128f, 0.0293185711f},
-std::array<float,2>{0.188786134f, 0.719067574f},
-std::array<float,2>{0.480167747f, 0.397001892f},
-std::array<float,2>{0.717504859f, 0.778099954f},
-std::array<float,2>{0.797987819f, 0.324064374f},
-std::array<float,2>{0.164566651f, 0.881407499f},
-std::array<float,2>{0.408881485f, 0.151587218f},
-std::array<float,2>{0.679621279f, 0.533514321f},
-std::array<float,2>{0.55236882f, 0.0785837471f},
-std::array<float,2>{0.338417619f, 0.637485147f},
-std::array<float,2>{0.0846286938f, 0.499210626f},
-std::array<float,2>{0.954542041f, 0.831915617f},
-std::array<float,2>{0.746963382f, 0.434387773f},
-std::array<float,2>{0.438175142f, 0.797738552f},
-std::array<float,2>{0.243178278f, 0.0396775231f},
-std::array<float,2>{0.84574753f, 0.687827766f},
-std::array<float,2>{0.90513283f, 0.239523843f},
-std::array<float,2>{0.0530560389f, 0.583153725f},
-std::array<float,2>{0.29388836f, 0.292090148f},
-std::array<float,2>{0.594612062f, 0.968248069f},
-std::array<float,2>{0.922524691f, 0.298478067f},
-std::array<float,2>{0.00629534246f, 0.951156378f},
-std::array<float,2>{0.254843205f, 0.233922556f},
-std::array<float,2>{0.575334251f, 0.572378635f},
-std::array<float,2>{0.694742858f, 0.0621320792f},
-std::array<float,2>{0.491466254f, 0.703920424f},
-std::array<float,2>{0.215826169f, 0.406673789f},
-std::array<float,2>{0.832916856f, 0.783416808f},
-std::array<float,2>{0.530066073f, 0.474746078f},
-std::array<float,2>{0.355469972f, 0.813220322f},
-std::array<float,2>{0.111261994f, 0.0634241104f},
-std::array<float,2>{0.979196906f, 0.643371642f},
-std::array<float,2>{0.762575507f, 0.127739772f},
-std::array<float,2>{0.138539746f, 0.55172962f},
-std::array<float,2>{0.390008777f, 0.341269493f},
-std::array<float,2>{0.654361427f, 0.905770063f},
-std::array<float,2>{0.861216545f, 0.382190228f},
-std::array<float,2>{0.223238334f, 0.7650069f},
-std::array<float,2>{0.462249488f, 0.0115101682f},
-std::array<float,2>{0.724491179f, 0.746387124f},
-std::array<float,2>{0.619269013f, 0.216445968f},
-std::array<float,2>{0.304149032f, 0.614959836f},
-std::array<float,2>{0.0349753872f, 0.267753631f},
-std::array<float,2>{0.879349768f, 0.984010458f},
-std::array<float,2>{0.66148448f, 0.350544691f},
-std::array<float,2>{0.432650864f, 0.917826831f},
-std::array<float,2>{0.184009954f, 0.159430683f},
-std::array<float,2>{0.781488061f, 0.505245805f},
-std::array<float,2>{0.947950482f, 0.0995013416f},
-std::array<float,2>{0.0697598383f, 0.667371571f},
-std::array<float,2>{0.320895672f, 0.468423456f},
-std::array<float,2>{0.536878526f, 0.863216996f},
-std::array<float,2>{0.887735307f, 0.421782613f},
-std::array<float,2>{0.0449998453f, 0.789906323f},
-std::array<float,2>{0.307168365f, 0.0526002981f},
-std::array<float,2>{0.612266123f, 0.717539549f},
-std::array<float,2>{0.730616331f, 0.221449643f},
-std::array<float,2>{0.457053512f, 0.564393938f},
-std::array<float,2>{0.233275294f, 0.306312263f},
-std::array<float,2>{0.871684432f, 0.940443814f},
-std::array<float,2>{0.540933073f, 0.334502608f},
-std::array<float,2>{0.314280719f, 0.891628146f},
-std::array<float,2>{0.0775630325f, 0.140567079f},
-std::array<float,2>{0.944402575f, 0.556282103f},
-std::array<float,2>{0.796702862f, 0.0756594911f},
-std::array<float,2>{0.174785167f, 0.650185406f},
-std::array<float,2>{0.422565371f, 0.482290328f},
-std::array<float,2>{0.666045249f, 0.825890481f},
-std::array<float,2>{0.841578245f, 0.275672078f},
-std::array<float,2>{0.2054362f, 0.975972295f},
-std::array<float,2>{0.494691849f, 0.205448419f},
-std::array<float,2>{0.696690559f, 0.618974924f},
-std::array<float,2>{0.565751195f, 0.000954990508f},
-std::array<float,2>{0.25854221f, 0.734409094f},
-std::array<float,2>{0.0150506785f, 0.387201399f},
-std::array<float,2>{0.935875833f, 0.756286025f},
-std::array<float,2>{0.646664977f, 0.459641576f},
-std::array<float,2>{0.377928466f, 0.87062192f},
-std::array<float,2>{0.132552668f, 0.106094152f},
-std::array<float,2>{0.751733482f, 0.661264598f},
-std::array<float,2>{0.974953055f, 0.171085328f},
-std::array<float,2>{0.124254368f, 0.51302731f},
-std::array<float,2>{0.349957854f, 0.353212148f},
-std::array<float,2>{0.515799165f, 0.906532645f},
-std::array<float,2>{0.961778939f, 0.374247044f},
-std::array<float,2>{0.0936129764f, 0.92587924f},
-std::array<float,2>{0.330534637f, 0.174494371f},
-std::array<float,2>{0.556449831f, 0.529461443f},
-std::array<float,2>{0.680449963f, 0.109937921f},
-std::array<float,2>{0.420130789f, 0.681290865f},
-std::array<float,2>{0.161155641f, 0.450212568f},
-std::array<float,2>{0.807861805f, 0.855150342f},
-std::array<float,2>{0.605298698f, 0.404203832f},
-std::array<float,2>{0.288244963f, 0.769988477f},
-std::array<float,2>{0.0547259077f, 0.0161328539f},
-std::array<float,2>{0.89364785f, 0.731587768f},
-std::array<float,2>{0.854212046f, 0.191770375f},
-std::array<float,2>{0.239230976f, 0.596786737f},
-std::array<float,2>{0.447813749f, 0.264352322f},
-std::array<float,2>{0.740786076f, 0.989448428f},
-std::array<float,2>{0.773506165f, 0.487578422f},
-std::array<float,2>{0.15592593f, 0.83919698f},
-std::array<float,2>{0.393388093f, 0.0876310244f},
-std::array<float,2>{0.63964957f, 0.631387472f},
-std::array<float,2>{0.513734698f, 0.142946109f},
-std::array<float,2>{0.365063816f, 0.546244383f},
-std::array<float,2>{0.106323235f, 0.31449306f},
-std::array<float,2>{0.996841729f, 0.889035404f},
-std::array<float,2>{0.708427608f, 0.288041949f},
-std::array<float,2>{0.470267534f, 0.958115041f},
-std::array<float,2>{0.203124657f, 0.244146273f},
-std::array<float,2>{0.827345312f, 0.59029901f},
-std::array<float,2>{0.907507837f, 0.0358998664f},
-std::array<float,2>{0.0244228765f, 0.695846856f},
-std::array<float,2>{0.266840041f, 0.424901962f},
-std::array<float,2>{0.583189726f, 0.810541928f},
-std::array<float,2>{0.921368778f, 0.479451835f},
-std::array<float,2>{0.0184565987f, 0.824097216f},
-std::array<float,2>{0.275850624f, 0.0729165897f},
-std::array<float,2>{0.589914739f, 0.654826403f},
-std::array<float,2>{0.713877678f, 0.135336444f},
-std::array<float,2>{0.481203496f, 0.562010765f},
-std::array<float,2>{0.19384928f, 0.331601471f},
-std::array<float,2>{0.817249596f, 0.896961212f},
-std::array<float,2>{0.501386344f, 0.310226381f},
-std::array<float,2>{0.373722017f, 0.943222821f},
-std::array<float,2>{0.0993591547f, 0.224045932f},
-std::array<float,2>{0.991695642f, 0.569043756f},
-std::array<float,2>{0.768159509f, 0.0496643744f},
-std::array<float,2>{0.140671521f, 0.714466333f},
-std::array<float,2>{0.405949295f, 0.414202362f},
-std::array<float,2>{0.632320642f, 0.795234978f},
-std::array<float,2>{0.848264635f, 0.358013302f},
-std::array<float,2>{0.247935966f, 0.911317945f},
-std::array<float,2>{0.445226938f, 0.165959477f},
-std::array<float,2>{0.743246615f, 0.511173368f},
-std::array<float,2>{0.600641906f, 0.104106203f},
-std::array<float,2>{0.290544182f, 0.658767998f},
-std::array<float,2>{0.0490434989f, 0.45585835f},
-std::array<float,2>{0.90196228f, 0.871686935f},
-std::array<float,2>{0.67310375f, 0.383206546f},
-std::array<float,2>{0.412237555f, 0.752962589f},
-std::array<float,2>{0.17016314f, 0.00536389463f},
-std::array<float,2>{0.803152442f, 0.741090655f},
-std::array<float,2>{0.957922399f, 0.207108453f},
-std::array<float,2>{0.0799546093f, 0.622308314f},
-std::array<float,2>{0.340872079f, 0.279141366f},
-std::array<float,2>{0.549325049f, 0.972621322f},
-std::array<float,2>{0.982821524f, 0.258681506f},
-std::array<float,2>{0.114598982f, 0.984975815f},
-std::array<float,2>{0.35418123f, 0.191374868f},
-std::array<float,2>{0.525709152f, 0.600358427f},
-std::array<float,2>{0.651162565f, 0.0221378319f},
-std::array<float,2>{0.383300245f, 0.727089465f},
-std::array<float,2>{0.136059448f, 0.400426358f},
-std::array<float,2>{0.760661304f, 0.767638922f},
-std::array<float,2>{0.573466063f, 0.44790715f},
-std::array<float,2>{0.250130594f, 0.858440101f},
-std::array<float,2>{0.00112133741f, 0.114102088f},
-std::array<float,2>{0.927783608f, 0.686743736f},
-std::array<float,2>{0.828161955f, 0.177476868f},
-std::array<float,2>{0.21338442f, 0.524425626f},
-std::array<float,2>{0.487060636f, 0.36743933f},
-std::array<float,2>{0.6902107f, 0.921958983f},
-std::array<float,2>{0.788459897f, 0.427891463f},
-std::array<float,2>{0.180773675f, 0.808239102f},
-std::array<float,2>{0.434497297f, 0.0318453424f},
-std::array<float,2>{0.656414509f, 0.702820301f},
-std::array<float,2>{0.534496903f, 0.248978376f},
-std::array<float,2>{0.325239569f, 0.589140952f},
-std::array<float,2>{0.065192461f, 0.283438891f},
-std::array<float,2>{0.950411201f, 0.956971645f},
-std::array<float,2>{0.721343935f, 0.317589819f},
-std::array<float,2>{0.467590779f, 0.883368194f},
-std::array<float,2>{0.220866904f, 0.147084102f},
-std::array<float,2>{0.865907192f, 0.542651296f},
-std::array<float,2>{0.875593603f, 0.0902621299f},
-std::array<float,2>{0.0355951004f, 0.628478825f},
-std::array<float,2>{0.297946423f, 0.488631874f},
-std::array<float,2>{0.621957302f, 0.840527296f},
-std::array<float,2>{0.940945506f, 0.392022818f},
-std::array<float,2>{0.073978819f, 0.773906767f},
-std::array<float,2>{0.317912519f, 0.0243957713f},
-std::array<float,2>{0.546726346f, 0.725449979f},
-std::array<float,2>{0.668586552f, 0.195681959f},
-std::array<float,2>{0.429543078f, 0.601878226f},
-std::array<float,2>{0.17821534f, 0.250252873f},
-std::array<float,2>{0.792910278f, 0.999539018f},
-std::array<float,2>{0.616210282f, 0.364241511f},
-std::array<float,2>{0.312207997f, 0.936356008f},
-std::array<float,2>{0.0423012711f, 0.18344596f},
-std::array<float,2>{0.883586407f, 0.519744277f},
-std::array<float,2>{0.870710015f, 0.119997449f},
-std::array<float,2>{0.229536906f, 0.672638297f},
-std::array<float,2>{0.453549117f, 0.439206392f},
-std::array<float,2>{0.727812827f, 0.844429195f},
-std::array<float,2>{0.754640698f, 0.296062857f},
-std::array<float,2>{0.128687471f, 0.963632762f},
-std::array<float,2>{0.381843418f, 0.236454844f},
-std::array<float,2>{0.644006729f, 0.578605473f},
-std::array<float,2>{0.521210253f, 0.043909125f},
-std::array<float,2>{0.345228672f, 0.692123473f},
-std::array<float,2>{0.119212128f, 0.430991232f},
-std::array<float,2>{0.971452892f, 0.802476048f},
-std::array<float,2>{0.701417148f, 0.494088888f},
-std::array<float,2>{0.498489499f, 0.832489789f},
-std::array<float,2>{0.209662318f, 0.0859117955f},
-std::array<float,2>{0.837416828f, 0.634581208f},
-std::array<float,2>{0.933544874f, 0.155460224f},
-std::array<float,2>{0.00944892131f, 0.536219835f},
-std::array<float,2>{0.264355272f, 0.325244397f},
-std::array<float,2>{0.569276989f, 0.875516951f},
-std::array<float,2>{0.896657765f, 0.337221563f},
-std::array<float,2>{0.0589114688f, 0.898611069f},
-std::array<float,2>{0.282321155f, 0.130736455f},
-std::array<float,2>{0.605584145f, 0.54697293f},
-std::array<float,2>{0.735538542f, 0.0677404478f},
-std::array<float,2>{0.450609922f, 0.647076249f},
-std::array<float,2>{0.23824811f, 0.469650954f},
-std::array<float,2>{0.855673313f, 0.817257166f},
-std::array<float,2>{0.56146431f, 0.413197517f},
-std::array<float,2>{0.335286766f, 0.786144435f},
-std::array<float,2>{0.0863930285f, 0.0579232723f},
-std::array<float,2>{0.967034578f, 0.709362924f},
-std::array<float,2>{0.810267806f, 0.226754069f},
-std::array<float,2>{0.159952745f, 0.575361669f},
-std::array<float,2>{0.417385638f, 0.302721351f},
-std::array<float,2>{0.685618162f, 0.9455356f},
-std::array<float,2>{0.820664465f, 0.461925507f},
-std::array<float,2>{0.197498575f, 0.864928067f},
-std::array<float,2>{0.473288774f, 0.0940805376f},
-std::array<float,2>{0.704703033f, 0.670943856f},
-std::array<float,2>{0.579204142f, 0.161467448f},
-std::array<float,2>{0.271208346f, 0.501143932f},
-std::array<float,2>{0.0283366665f, 0.346042097f},
-std::array<float,2>{0.911477447f, 0.919517219f},
-std::array<float,2>{0.633907437f, 0.272579432f},
-std::array<float,2>{0.395082295f, 0.977057815f},
-std::array<float,2>{0.151781663f, 0.211467683f},
-std::array<float,2>{0.780061722f, 0.609943748f},
-std::array<float,2>{0.994994104f, 0.0127003798f},
-std::array<float,2>{0.104024015f, 0.746031642f},
-std::array<float,2>{0.359587699f, 0.378751129f},
-std::array<float,2>{0.509012997f, 0.761695862f},
-std::array<float,2>{0.956125259f, 0.497847974f},
-std::array<float,2>{0.0820652023f, 0.829825044f},
-std::array<float,2>{0.336260647f, 0.0815237015f},
-std::array<float,2>{0.554301083f, 0.639949024f},
-std::array<float,2>{0.67735219f, 0.149976224f},
-std::array<float,2>{0.407112479f, 0.53282088f},
-std::array<float,2>{0.167165235f, 0.321601689f},
-std::array<float,2>{0.799245596f, 0.879172266f},
-std::array<float,2>{0.596346617f, 0.289501578f},
-std::array<float,2>{0.295203656f, 0.965320587f},
-std::array<float,2>{0.0525149629f, 0.240539759f},
-std::array<float,2>{0.903033555f, 0.584594429f},
-std::array<float,2>{0.845447719f, 0.0415684246f},
-std::array<float,2>{0.245046839f, 0.690839171f},
-std::array<float,2>{0.440134257f, 0.436792493f},
-std::array<float,2>{0.748047709f, 0.800019026f},
-std::array<float,2>{0.770578444f, 0.361642629f},
-std::array<float,2>{0.145938665f, 0.93043232f},
-std::array<float,2>{0.399770796f, 0.185268328f},
-std::array<float,2>{0.626276791f, 0.518706739f},
-std::array<float,2>{0.506590188f, 0.123302482f},
-std::array<float,2>{0.369675368f, 0.676579356f},
-std::array<float,2>{0.0952801257f, 0.443095863f},
-std::array<float,2>{0.985872209f, 0.849558532f},
-std::array<float,2>{0.716317892f, 0.396409214f},
-std::array<float,2>{0.47664845f, 0.780883849f},
-std::array<float,2>{0.191197276f, 0.0288998317f},
-std::array<float,2>{0.814245462f, 0.721131086f},
-std::array<float,2>{0.914339244f, 0.20073162f},
-std::array<float,2>{0.0200463571f, 0.608473063f},
-std::array<float,2>{0.281074762f, 0.253907859f},
-std::array<float,2>{0.588554621f, 0.992879093f},
-std::array<float,2>{0.88280195f, 0.266029835f},
-std::array<float,2>{0.0325902067f, 0.982086003f},
-std::array<float,2>{0.302466363f, 0.217637166f},
-std::array<float,2>{0.619079113f, 0.615671635f},
-std::array<float,2>{0.726076066f, 0.00937626697f},
-std::array<float,2>{0.462943256f, 0.748946428f},
-std::array<float,2>{0.224839538f, 0.379143268f},
-std::array<float,2>{0.862284362f, 0.76332587f},
-std::array<float,2>{0.537185669f, 0.465090841f},
-std::array<float,2>{0.323528975f, 0.860680759f},
-std::array<float,2>{0.0672498345f, 0.10014312f},
-std::array<float,2>{0.946939707f, 0.664459586f},
-std::array<float,2>{0.784345806f, 0.157648236f},
-std::array<float,2>{0.186300233f, 0.507782042f},
-std::array<float,2>{0.43001768f, 0.349424005f},
-std::array<float,2>{0.662489176f, 0.914410949f},
-std::array<float,2>{0.835704327f, 0.408213377f},
-std::array<float,2>{0.218040451f, 0.781699598f},
-std::array<float,2>{0.490114689f, 0.0591358244f},
-std::array<float,2>{0.691491365f, 0.705619454f},
-std::array<float,2>{0.577862799f, 0.232237622f},
-std::array<float,2>{0.256559849f, 0.571471155f},
-std::array<float,2>{0.00554964319f, 0.299606532f},
-std::array<float,2>{0.923959553f, 0.953032672f},
-std::array<float,2>{0.652667344f, 0.342863828f},
-std::array<float,2>{0.386984199f, 0.902974367f},
-std::array<float,2>{0.140070722f, 0.126682833f},
-std::array<float,2>{0.763809025f, 0.554408133f},
-std::array<float,2>{0.977199495f, 0.0650548115f},
-std::array<float,2>{0.112668633f, 0.640864968f},
-std::array<float,2>{0.358278692f, 0.473654091f},
-std::array<float,2>{0.528464496f, 0.8148911f},
-std::array<float,2>{0.934179604f, 0.389573604f},
-std::array<float,2>{0.0132335071f, 0.754063427f},
-std::array<float,2>{0.261703968f, 0.0023002096f},
-std::array<float,2>{0.563429952f, 0.738127589f},
-std::array<float,2>{0.698646009f, 0.20378162f},
-std::array<float,2>{0.492442369f, 0.619983673f},
-std::array<float,2>{0.204895973f, 0.275220871f},
-std::array<float,2>{0.84251976f, 0.972714603f},
-std::array<float,2>{0.518873334f, 0.354166776f},
-std::array<float,2>{0.349093944f, 0.909976423f},
-std::array<float,2>{0.121384196f, 0.168716252f},
-std::array<float,2>{0.973389924f, 0.514446199f},
-std::array<float,2>{0.752071559f, 0.109183356f},
-std::array<float,2>{0.130192444f, 0.662383437f},
-std::array<float,2>{0.376231343f, 0.458473414f},
-std::array<float,2>{0.645279109f, 0.867892683f},
-std::array<float,2>{0.874467552f, 0.308393836f},
-std::array<float,2>{0.231834263f, 0.938252866f},
-std::array<float,2>{0.4603405f, 0.220381305f},
-std::array<float,2>{0.734246671f, 0.56583333f},
-std::array<float,2>{0.61065954f, 0.0541999899f},
-std::array<float,2>{0.304946184f, 0.715983868f},
-std::array<float,2>{0.043938715f, 0.4194628f},
-std::array<float,2>{0.889789402f, 0.792450547f},
-std::array<float,2>{0.665137231f, 0.483225316f},
-std::array<float,2>{0.424314678f, 0.827273905f},
-std::array<float,2>{0.173759252f, 0.0773985013f},
-std::array<float,2>{0.794031143f, 0.65048933f},
-std::array<float,2>{0.941711307f, 0.137451604f},
-std::array<float,2>{0.0751660019f, 0.556705117f},
-std::array<float,2>{0.314803094f, 0.332645923f},
-std::array<float,2>{0.541496158f, 0.89297092f},
-std::array<float,2>{0.998596668f, 0.313654393f},
-std::array<float,2>{0.107854195f, 0.88723892f},
-std::array<float,2>{0.365730286f, 0.14131166f},
-std::array<float,2>{0.512824357f, 0.543840349f},
-std::array<float,2>{0.638300955f, 0.089545995f},
-std::array<float,2>{0.391606718f, 0.629909337f},
-std::array<float,2>{0.152815253f, 0.485837221f},
-std::array<float,2>{0.776403666f, 0.837328792f},
-std::array<float,2>{0.58410418f, 0.422650009f},
-std::array<float,2>{0.2685076f, 0.811076403f},
-std::array<float,2>{0.0272557288f, 0.0374988467f},
-std::array<float,2>{0.909777105f, 0.697326839f},
-std::array<float,2>{0.825969756f, 0.243888736f},
-std::array<float,2>{0.200490221f, 0.592937112f},
-std::array<float,2>{0.472244918f, 0.286608934f},
-std::array<float,2>{0.710327625f, 0.959120989f},
-std::array<float,2>{0.80550909f, 0.452830076f},
-std::array<float,2>{0.162507311f, 0.852465987f},
-std::array<float,2>{0.418595433f, 0.111796901f},
-std::array<float,2>{0.683124423f, 0.683375776f},
-std::array<float,2>{0.556941688f, 0.172922075f},
-std::array<float,2>{0.328850091f, 0.529224217f},
-std::array<float,2>{0.0904101282f, 0.371507227f},
-std::array<float,2>{0.964751422f, 0.928764939f},
-std::array<float,2>{0.740172088f, 0.263089925f},
-std::array<float,2>{0.446285009f, 0.990667224f},
-std::array<float,2>{0.240505964f, 0.193897456f},
-std::array<float,2>{0.853040993f, 0.594542682f},
-std::array<float,2>{0.892082453f, 0.0179625694f},
-std::array<float,2>{0.0572863482f, 0.732673883f},
-std::array<float,2>{0.287059367f, 0.405475944f},
-std::array<float,2>{0.602301002f, 0.772816718f},
-std::array<float,2>{0.900006592f, 0.453953356f},
-std::array<float,2>{0.0475252904f, 0.873831987f},
-std::array<float,2>{0.29254064f, 0.102258123f},
-std::array<float,2>{0.598202527f, 0.656575561f},
-std::array<float,2>{0.745820642f, 0.167907625f},
-std::array<float,2>{0.443101555f, 0.509316087f},
-std::array<float,2>{0.249460936f, 0.355720162f},
-std::array<float,2>{0.851049423f, 0.913293839f},
-std::array<float,2>{0.548118711f, 0.280143082f},
-std::array<float,2>{0.342879981f, 0.968913674f},
-std::array<float,2>{0.081282258f, 0.20966655f},
-std::array<float,2>{0.95969981f, 0.62320137f},
-std::array<float,2>{0.801750898f, 0.00651232013f},
-std::array<float,2>{0.168051511f, 0.739105463f},
-std::array<float,2>{0.412005156f, 0.386683285f},
-std::array<float,2>{0.674690962f, 0.751932442f},
-std::array<float,2>{0.818543375f, 0.329507679f},
-std::array<float,2>{0.193055823f, 0.894982159f},
-std::array<float,2>{0.482475191f, 0.133796886f},
-std::array<float,2>{0.711767673f, 0.560336411f},
-std::array<float,2>{0.592931747f, 0.0704180375f},
-std::array<float,2>{0.273842335f, 0.653521597f},
-std::array<float,2>{0.0174646322f, 0.47848168f},
-std::array<float,2>{0.91845125f, 0.821888387f},
-std::array<float,2>{0.629009724f, 0.417148173f},
-std::array<float,2>{0.404129744f, 0.793806314f},
-std::array<float,2>{0.14383471f, 0.048053883f},
-std::array<float,2>{0.766198814f, 0.711943269f},
-std::array<float,2>{0.98843509f, 0.22574994f},
-std::array<float,2>{0.100199774f, 0.567266583f},
-std::array<float,2>{0.371121287f, 0.311207116f},
-std::array<float,2>{0.503902435f, 0.945304453f},
-std::array<float,2>{0.951397777f, 0.282086164f},
-std::array<float,2>{0.0629361942f, 0.954987586f},
-std::array<float,2>{0.328075498f, 0.246238187f},
-std::array<float,2>{0.531729102f, 0.586589575f},
-std::array<float,2>{0.660114706f, 0.0343291909f},
-std::array<float,2>{0.435702384f, 0.699722946f},
-std::array<float,2>{0.182572693f, 0.426308513f},
-std::array<float,2>{0.786926925f, 0.80550164f},
-std::array<float,2>{0.623794854f, 0.491607904f},
-std::array<float,2>{0.299703538f, 0.843117714f},
-std::array<float,2>{0.0384803377f, 0.0931863412f},
-std::array<float,2>{0.878841996f, 0.625638902f},
-std::array<float,2>{0.863960862f, 0.145955458f},
-std::array<float,2>{0.220582679f, 0.539685428f},
-std::array<float,2>{0.466339946f, 0.319917083f},
-std::array<float,2>{0.719136596f, 0.886222661f},
-std::array<float,2>{0.759083331f, 0.39846462f},
-std::array<float,2>{0.134677187f, 0.765956044f},
-std::array<float,2>{0.386387527f, 0.0202688351f},
-std::array<float,2>{0.648797572f, 0.730444729f},
-std::array<float,2>{0.525125682f, 0.187971637f},
-std::array<float,2>{0.35261488f, 0.599378467f},
-std::array<float,2>{0.115425378f, 0.260526896f},
-std::array<float,2>{0.981951118f, 0.986683726f},
-std::array<float,2>{0.688415647f, 0.371062636f},
-std::array<float,2>{0.48442179f, 0.923944771f},
-std::array<float,2>{0.210981488f, 0.17942819f},
-std::array<float,2>{0.831325233f, 0.525400043f},
-std::array<float,2>{0.926406324f, 0.115946345f},
-std::array<float,2>{0.00305806263f, 0.684292495f},
-std::array<float,2>{0.253085375f, 0.447129667f},
-std::array<float,2>{0.571629345f, 0.85590899f},
-std::array<float,2>{0.969180524f, 0.432182878f},
-std::array<float,2>{0.117455326f, 0.803660691f},
-std::array<float,2>{0.347630173f, 0.0458540767f},
-std::array<float,2>{0.522830904f, 0.694637716f},
-std::array<float,2>{0.642472565f, 0.235004917f},
-std::array<float,2>{0.380368829f, 0.580986321f},
-std::array<float,2>{0.126609787f, 0.294525653f},
-std::array<float,2>{0.757297993f, 0.961787701f},
-std::array<float,2>{0.567266881f, 0.326259017f},
-std::array<float,2>{0.262706161f, 0.877010882f},
-std::array<float,2>{0.0109057948f, 0.153605863f},
-std::array<float,2>{0.931436121f, 0.537249684f},
-std::array<float,2>{0.839841604f, 0.0825483128f},
-std::array<float,2>{0.208217219f, 0.634999692f},
-std::array<float,2>{0.496287286f, 0.494262785f},
-std::array<float,2>{0.70108366f, 0.83557719f},
-std::array<float,2>{0.789064944f, 0.253609151f},
-std::array<float,2>{0.177189842f, 0.99714905f},
-std::array<float,2>{0.426959068f, 0.197541401f},
-std::array<float,2>{0.670551002f, 0.604522169f},
-std::array<float,2>{0.54491818f, 0.0266785845f},
-std::array<float,2>{0.320063233f, 0.724367917f},
-std::array<float,2>{0.0719466656f, 0.393534303f},
-std::array<float,2>{0.938189209f, 0.776653886f},
-std::array<float,2>{0.729087412f, 0.439920038f},
-std::array<float,2>{0.45579046f, 0.847579658f},
-std::array<float,2>{0.228059113f, 0.117832176f},
-std::array<float,2>{0.868600011f, 0.674278617f},
-std::array<float,2>{0.884942114f, 0.180357128f},
-std::array<float,2>{0.0408823378f, 0.521637559f},
-std::array<float,2>{0.309747845f, 0.36714676f},
-std::array<float,2>{0.614777625f, 0.934791684f},
-std::array<float,2>{0.912896395f, 0.345418096f},
-std::array<float,2>{0.0309669599f, 0.92054522f},
-std::array<float,2>{0.272553176f, 0.163003534f},
-std::array<float,2>{0.580508828f, 0.502356052f},
-std::array<float,2>{0.706847548f, 0.0973707438f},
-std::array<float,2>{0.476221025f, 0.669759512f},
-std::array<float,2>{0.196763158f, 0.464500517f},
-std::array<float,2>{0.823683679f, 0.866422951f},
-std::array<float,2>{0.510128319f, 0.376605123f},
-std::array<float,2>{0.362722456f, 0.758685589f},
-std::array<float,2>{0.102496296f, 0.0148959402f},
-std::array<float,2>{0.993560016f, 0.742272198f},
-std::array<float,2>{0.778170705f, 0.213029847f},
-std::array<float,2>{0.149982318f, 0.612291276f},
-std::array<float,2>{0.397560745f, 0.27102524f},
-std::array<float,2>{0.636391461f, 0.980095148f},
-std::array<float,2>{0.858370066f, 0.471137136f},
-std::array<float,2>{0.234871015f, 0.819771349f},
-std::array<float,2>{0.45281896f, 0.0702241138f},
-std::array<float,2>{0.737909794f, 0.645158589f},
-std::array<float,2>{0.608696103f, 0.132519722f},
-std::array<float,2>{0.285105914f, 0.550148547f},
-std::array<float,2>{0.0611474775f, 0.338380367f},
-std::array<float,2>{0.896304548f, 0.901683271f},
-std::array<float,2>{0.68429029f, 0.303343654f},
-std::array<float,2>{0.41514343f, 0.948129892f},
-std::array<float,2>{0.15717946f, 0.23022373f},
-std::array<float,2>{0.811312258f, 0.577389717f},
-std::array<float,2>{0.965922832f, 0.0555331148f},
-std::array<float,2>{0.0894603878f, 0.707728744f},
-std::array<float,2>{0.333323747f, 0.411786318f},
-std::array<float,2>{0.559794426f, 0.788882315f}}
\ No newline at end of file
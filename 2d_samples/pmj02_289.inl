@@ -1,4096 +0,0 @@
-{std::array<float,2>{0.776304781f, 0.354557931f},
-std::array<float,2>{0.469241291f, 0.81531781f},
-std::array<float,2>{0.0521778949f, 0.178725109f},
-std::array<float,2>{0.621463597f, 0.567163944f},
-std::array<float,2>{0.686204374f, 0.113917157f},
-std::array<float,2>{0.168635756f, 0.743765831f},
-std::array<float,2>{0.251830757f, 0.382047355f},
-std::array<float,2>{0.980316818f, 0.923573256f},
-std::array<float,2>{0.90765363f, 0.214107469f},
-std::array<float,2>{0.347449958f, 0.523677528f},
-std::array<float,2>{0.203511566f, 0.25641489f},
-std::array<float,2>{0.69632262f, 0.761558294f},
-std::array<float,2>{0.546576202f, 0.446884632f},
-std::array<float,2>{0.0750081539f, 0.947708607f},
-std::array<float,2>{0.38948831f, 0.00879501551f},
-std::array<float,2>{0.849970639f, 0.644755602f},
-std::array<float,2>{0.955217481f, 0.415486872f},
-std::array<float,2>{0.303087741f, 0.903660297f},
-std::array<float,2>{0.140112713f, 0.0897221044f},
-std::array<float,2>{0.641840756f, 0.718676329f},
-std::array<float,2>{0.56845212f, 0.143422559f},
-std::array<float,2>{0.0219844244f, 0.620728493f},
-std::array<float,2>{0.444995552f, 0.330928385f},
-std::array<float,2>{0.801286459f, 0.848734975f},
-std::array<float,2>{0.839822948f, 0.0573729314f},
-std::array<float,2>{0.425480813f, 0.681622624f},
-std::array<float,2>{0.0940421f, 0.488092631f},
-std::array<float,2>{0.521641612f, 0.98154372f},
-std::array<float,2>{0.748980701f, 0.294987589f},
-std::array<float,2>{0.222855538f, 0.804162741f},
-std::array<float,2>{0.335946739f, 0.246505275f},
-std::array<float,2>{0.903904021f, 0.555676222f},
-std::array<float,2>{0.877082229f, 0.27274698f},
-std::array<float,2>{0.321143329f, 0.770635784f},
-std::array<float,2>{0.246165112f, 0.188355923f},
-std::array<float,2>{0.72141856f, 0.507839203f},
-std::array<float,2>{0.506437182f, 0.0294860546f},
-std::array<float,2>{0.115093432f, 0.640278339f},
-std::array<float,2>{0.412449509f, 0.467118949f},
-std::array<float,2>{0.826488256f, 0.962933362f},
-std::array<float,2>{0.792999506f, 0.167138234f},
-std::array<float,2>{0.459340513f, 0.578238845f},
-std::array<float,2>{0.00669082068f, 0.371831834f},
-std::array<float,2>{0.583567142f, 0.842458904f},
-std::array<float,2>{0.635083377f, 0.395506978f},
-std::array<float,2>{0.150053144f, 0.920968413f},
-std::array<float,2>{0.284971982f, 0.0960479751f},
-std::array<float,2>{0.944494307f, 0.726514101f},
-std::array<float,2>{0.874384284f, 0.471823692f},
-std::array<float,2>{0.395860434f, 0.984918356f},
-std::array<float,2>{0.0825082138f, 0.0445875488f},
-std::array<float,2>{0.554458261f, 0.665896654f},
-std::array<float,2>{0.705286503f, 0.225327387f},
-std::array<float,2>{0.202751577f, 0.543094337f},
-std::array<float,2>{0.363924742f, 0.302656174f},
-std::array<float,2>{0.931935728f, 0.790867448f},
-std::array<float,2>{0.998085797f, 0.0696967095f},
-std::array<float,2>{0.28080079f, 0.694800556f},
-std::array<float,2>{0.180168197f, 0.436089456f},
-std::array<float,2>{0.669762492f, 0.880827367f},
-std::array<float,2>{0.597613156f, 0.316450715f},
-std::array<float,2>{0.0405404903f, 0.869540572f},
-std::array<float,2>{0.495265096f, 0.131129608f},
-std::array<float,2>{0.762540042f, 0.601091385f},
-std::array<float,2>{0.81715709f, 0.3077299f},
-std::array<float,2>{0.417708576f, 0.786330998f},
-std::array<float,2>{0.120688587f, 0.231493026f},
-std::array<float,2>{0.511270404f, 0.532396019f},
-std::array<float,2>{0.7286461f, 0.0333196148f},
-std::array<float,2>{0.239521191f, 0.661627591f},
-std::array<float,2>{0.314057559f, 0.483136922f},
-std::array<float,2>{0.88450259f, 0.998902678f},
-std::array<float,2>{0.951517582f, 0.139473766f},
-std::array<float,2>{0.289336532f, 0.60285449f},
-std::array<float,2>{0.146211937f, 0.323949903f},
-std::array<float,2>{0.625727415f, 0.86607182f},
-std::array<float,2>{0.591478348f, 0.429430425f},
-std::array<float,2>{0.00783601496f, 0.88720274f},
-std::array<float,2>{0.464150488f, 0.0775268748f},
-std::array<float,2>{0.7832008f, 0.701488853f},
-std::array<float,2>{0.923596919f, 0.454018295f},
-std::array<float,2>{0.369271278f, 0.958034992f},
-std::array<float,2>{0.187621534f, 0.0190531202f},
-std::array<float,2>{0.718228579f, 0.62567395f},
-std::array<float,2>{0.556683362f, 0.199676409f},
-std::array<float,2>{0.0911304206f, 0.501179516f},
-std::array<float,2>{0.402837276f, 0.276681632f},
-std::array<float,2>{0.861072361f, 0.776575089f},
-std::array<float,2>{0.75190115f, 0.105983414f},
-std::array<float,2>{0.486457467f, 0.73214817f},
-std::array<float,2>{0.0375037491f, 0.402897835f},
-std::array<float,2>{0.60272795f, 0.913541317f},
-std::array<float,2>{0.661274672f, 0.363223821f},
-std::array<float,2>{0.17908591f, 0.835698068f},
-std::array<float,2>{0.26642105f, 0.158603415f},
-std::array<float,2>{0.988299608f, 0.588717103f},
-std::array<float,2>{0.97196722f, 0.336904258f},
-std::array<float,2>{0.260842115f, 0.856339455f},
-std::array<float,2>{0.162357539f, 0.153309241f},
-std::array<float,2>{0.673437119f, 0.615010321f},
-std::array<float,2>{0.615452647f, 0.0803050101f},
-std::array<float,2>{0.0624470897f, 0.7062096f},
-std::array<float,2>{0.479022175f, 0.409109086f},
-std::array<float,2>{0.766978979f, 0.892446458f},
-std::array<float,2>{0.854335725f, 0.235782221f},
-std::array<float,2>{0.380660415f, 0.551377892f},
-std::array<float,2>{0.0652368441f, 0.284652978f},
-std::array<float,2>{0.535589635f, 0.806950748f},
-std::array<float,2>{0.692814589f, 0.492313743f},
-std::array<float,2>{0.217512801f, 0.971822739f},
-std::array<float,2>{0.355207413f, 0.0480982512f},
-std::array<float,2>{0.921227038f, 0.673529088f},
-std::array<float,2>{0.807299614f, 0.387148887f},
-std::array<float,2>{0.449860096f, 0.929926336f},
-std::array<float,2>{0.0239578802f, 0.120960087f},
-std::array<float,2>{0.571374118f, 0.739000976f},
-std::array<float,2>{0.65568167f, 0.185636833f},
-std::array<float,2>{0.13047725f, 0.570806503f},
-std::array<float,2>{0.309097052f, 0.34638527f},
-std::array<float,2>{0.965967059f, 0.820999086f},
-std::array<float,2>{0.895686746f, 0.00411053561f},
-std::array<float,2>{0.329764128f, 0.653303385f},
-std::array<float,2>{0.232058555f, 0.44469595f},
-std::array<float,2>{0.734580636f, 0.943421781f},
-std::array<float,2>{0.526272118f, 0.259667128f},
-std::array<float,2>{0.108314469f, 0.750580728f},
-std::array<float,2>{0.431358546f, 0.207158163f},
-std::array<float,2>{0.832266092f, 0.518521428f},
-std::array<float,2>{0.8452847f, 0.324402899f},
-std::array<float,2>{0.385275215f, 0.859913528f},
-std::array<float,2>{0.0725854486f, 0.133987144f},
-std::array<float,2>{0.541498721f, 0.606515408f},
-std::array<float,2>{0.700868487f, 0.0732729211f},
-std::array<float,2>{0.209051013f, 0.696999848f},
-std::array<float,2>{0.35104689f, 0.424073815f},
-std::array<float,2>{0.91222471f, 0.884937286f},
-std::array<float,2>{0.983811975f, 0.22984308f},
-std::array<float,2>{0.257318765f, 0.537347794f},
-std::array<float,2>{0.165902689f, 0.31010139f},
-std::array<float,2>{0.682483554f, 0.781672895f},
-std::array<float,2>{0.620621145f, 0.478052437f},
-std::array<float,2>{0.0481869206f, 0.994073033f},
-std::array<float,2>{0.472880155f, 0.035769958f},
-std::array<float,2>{0.780097902f, 0.658409536f},
-std::array<float,2>{0.900555253f, 0.398632467f},
-std::array<float,2>{0.340886861f, 0.908717453f},
-std::array<float,2>{0.221799746f, 0.105426297f},
-std::array<float,2>{0.745924175f, 0.727571666f},
-std::array<float,2>{0.517191827f, 0.163257852f},
-std::array<float,2>{0.100784965f, 0.590384066f},
-std::array<float,2>{0.428134292f, 0.363770157f},
-std::array<float,2>{0.839976966f, 0.829596817f},
-std::array<float,2>{0.798366785f, 0.0206034034f},
-std::array<float,2>{0.43873316f, 0.632147849f},
-std::array<float,2>{0.0190553591f, 0.458803385f},
-std::array<float,2>{0.563441336f, 0.955168307f},
-std::array<float,2>{0.644723296f, 0.279638588f},
-std::array<float,2>{0.133907512f, 0.781075001f},
-std::array<float,2>{0.298403502f, 0.198858216f},
-std::array<float,2>{0.95829165f, 0.505954564f},
-std::array<float,2>{0.940661609f, 0.285398602f},
-std::array<float,2>{0.287526309f, 0.809615076f},
-std::array<float,2>{0.152560562f, 0.239558905f},
-std::array<float,2>{0.637821913f, 0.549235344f},
-std::array<float,2>{0.578762531f, 0.0521816686f},
-std::array<float,2>{0.00276664249f, 0.678644657f},
-std::array<float,2>{0.455835879f, 0.498535067f},
-std::array<float,2>{0.790799737f, 0.975979805f},
-std::array<float,2>{0.820929945f, 0.151943475f},
-std::array<float,2>{0.407504797f, 0.610536218f},
-std::array<float,2>{0.11051897f, 0.342956096f},
-std::array<float,2>{0.503604889f, 0.85225898f},
-std::array<float,2>{0.723043859f, 0.413817108f},
-std::array<float,2>{0.244536623f, 0.894769728f},
-std::array<float,2>{0.324694037f, 0.0848005489f},
-std::array<float,2>{0.880232036f, 0.708585799f},
-std::array<float,2>{0.760582268f, 0.440805674f},
-std::array<float,2>{0.498961538f, 0.939076662f},
-std::array<float,2>{0.0439882316f, 0.000499682734f},
-std::array<float,2>{0.598668456f, 0.651953936f},
-std::array<float,2>{0.664514124f, 0.2031831f},
-std::array<float,2>{0.185645476f, 0.521708131f},
-std::array<float,2>{0.27510941f, 0.265162528f},
-std::array<float,2>{0.995661438f, 0.757185876f},
-std::array<float,2>{0.934323967f, 0.124333993f},
-std::array<float,2>{0.363115549f, 0.737746537f},
-std::array<float,2>{0.195852503f, 0.385819852f},
-std::array<float,2>{0.708237469f, 0.934597492f},
-std::array<float,2>{0.54904449f, 0.35024339f},
-std::array<float,2>{0.0812888294f, 0.825748503f},
-std::array<float,2>{0.393574715f, 0.182205126f},
-std::array<float,2>{0.868415773f, 0.577024817f},
-std::array<float,2>{0.785935283f, 0.251713932f},
-std::array<float,2>{0.468193918f, 0.762106001f},
-std::array<float,2>{0.0125973783f, 0.215898588f},
-std::array<float,2>{0.587119579f, 0.528965235f},
-std::array<float,2>{0.629057825f, 0.0133631816f},
-std::array<float,2>{0.143593952f, 0.643276215f},
-std::array<float,2>{0.296594411f, 0.453065813f},
-std::array<float,2>{0.949210048f, 0.952156723f},
-std::array<float,2>{0.888127983f, 0.17384249f},
-std::array<float,2>{0.317060202f, 0.56530875f},
-std::array<float,2>{0.235778287f, 0.359324336f},
-std::array<float,2>{0.732670188f, 0.819170415f},
-std::array<float,2>{0.512575209f, 0.376512408f},
-std::array<float,2>{0.122142419f, 0.926712573f},
-std::array<float,2>{0.421085358f, 0.109529704f},
-std::array<float,2>{0.813975871f, 0.746138334f},
-std::array<float,2>{0.987989426f, 0.489557594f},
-std::array<float,2>{0.272875607f, 0.978985131f},
-std::array<float,2>{0.173599675f, 0.0611077026f},
-std::array<float,2>{0.657642722f, 0.683893263f},
-std::array<float,2>{0.607400358f, 0.24236019f},
-std::array<float,2>{0.0314531773f, 0.562398434f},
-std::array<float,2>{0.491309106f, 0.289943129f},
-std::array<float,2>{0.757074118f, 0.797939122f},
-std::array<float,2>{0.864732027f, 0.0901398212f},
-std::array<float,2>{0.399748325f, 0.714413762f},
-std::array<float,2>{0.0873666704f, 0.418167204f},
-std::array<float,2>{0.55861181f, 0.898831189f},
-std::array<float,2>{0.71315968f, 0.333377331f},
-std::array<float,2>{0.192537904f, 0.846364081f},
-std::array<float,2>{0.37487483f, 0.148330003f},
-std::array<float,2>{0.927417099f, 0.622415125f},
-std::array<float,2>{0.914203763f, 0.369753689f},
-std::array<float,2>{0.356295258f, 0.839473546f},
-std::array<float,2>{0.211699039f, 0.168671891f},
-std::array<float,2>{0.688593745f, 0.582923889f},
-std::array<float,2>{0.534153879f, 0.10136582f},
-std::array<float,2>{0.070129253f, 0.718770564f},
-std::array<float,2>{0.37511006f, 0.390891671f},
-std::array<float,2>{0.856442153f, 0.916637123f},
-std::array<float,2>{0.770926178f, 0.19189918f},
-std::array<float,2>{0.482993573f, 0.514520049f},
-std::array<float,2>{0.0562585779f, 0.266449362f},
-std::array<float,2>{0.61276865f, 0.76929462f},
-std::array<float,2>{0.676276028f, 0.46386236f},
-std::array<float,2>{0.159301475f, 0.966742575f},
-std::array<float,2>{0.263928026f, 0.0245343409f},
-std::array<float,2>{0.975898921f, 0.634205043f},
-std::array<float,2>{0.830217123f, 0.43279469f},
-std::array<float,2>{0.434128433f, 0.876792133f},
-std::array<float,2>{0.10342139f, 0.0640201867f},
-std::array<float,2>{0.529281616f, 0.689129949f},
-std::array<float,2>{0.739765048f, 0.125189558f},
-std::array<float,2>{0.226876855f, 0.594518721f},
-std::array<float,2>{0.332688063f, 0.315942794f},
-std::array<float,2>{0.892444372f, 0.874689162f},
-std::array<float,2>{0.96382457f, 0.0423637405f},
-std::array<float,2>{0.30778107f, 0.670384526f},
-std::array<float,2>{0.12856333f, 0.474208355f},
-std::array<float,2>{0.652255833f, 0.990389943f},
-std::array<float,2>{0.576109111f, 0.299779207f},
-std::array<float,2>{0.0312061161f, 0.795614064f},
-std::array<float,2>{0.44788751f, 0.221077219f},
-std::array<float,2>{0.809957445f, 0.541103005f},
-std::array<float,2>{0.803102314f, 0.328941971f},
-std::array<float,2>{0.441778839f, 0.850582778f},
-std::array<float,2>{0.0206998214f, 0.141470328f},
-std::array<float,2>{0.567071319f, 0.617614686f},
-std::array<float,2>{0.64355886f, 0.0873062685f},
-std::array<float,2>{0.13781397f, 0.716622949f},
-std::array<float,2>{0.300788134f, 0.41658479f},
-std::array<float,2>{0.953228176f, 0.905514836f},
-std::array<float,2>{0.904353499f, 0.248231292f},
-std::array<float,2>{0.338323623f, 0.558569968f},
-std::array<float,2>{0.225472987f, 0.293706477f},
-std::array<float,2>{0.747388005f, 0.8015185f},
-std::array<float,2>{0.520211816f, 0.484507591f},
-std::array<float,2>{0.0961884931f, 0.982909441f},
-std::array<float,2>{0.422409564f, 0.0557377003f},
-std::array<float,2>{0.837652624f, 0.682894051f},
-std::array<float,2>{0.9770419f, 0.380409658f},
-std::array<float,2>{0.252213687f, 0.924733818f},
-std::array<float,2>{0.171745569f, 0.116553761f},
-std::array<float,2>{0.684243143f, 0.745040774f},
-std::array<float,2>{0.624936223f, 0.176963389f},
-std::array<float,2>{0.0531830229f, 0.569994867f},
-std::array<float,2>{0.470900148f, 0.351717263f},
-std::array<float,2>{0.775268853f, 0.813718975f},
-std::array<float,2>{0.84856075f, 0.0114185233f},
-std::array<float,2>{0.387347668f, 0.647118092f},
-std::array<float,2>{0.0770958364f, 0.448518932f},
-std::array<float,2>{0.544283032f, 0.945988536f},
-std::array<float,2>{0.698818743f, 0.254565954f},
-std::array<float,2>{0.206949741f, 0.759504616f},
-std::array<float,2>{0.344079465f, 0.211171463f},
-std::array<float,2>{0.909927011f, 0.527336001f},
-std::array<float,2>{0.929916561f, 0.30300948f},
-std::array<float,2>{0.365689665f, 0.791649699f},
-std::array<float,2>{0.199452311f, 0.223103195f},
-std::array<float,2>{0.704782963f, 0.544960797f},
-std::array<float,2>{0.551557541f, 0.0464671068f},
-std::array<float,2>{0.0858459473f, 0.667662263f},
-std::array<float,2>{0.396971852f, 0.469819784f},
-std::array<float,2>{0.871325195f, 0.987928331f},
-std::array<float,2>{0.763702214f, 0.130607188f},
-std::array<float,2>{0.493031889f, 0.599187195f},
-std::array<float,2>{0.0427457951f, 0.320031822f},
-std::array<float,2>{0.59409678f, 0.869009554f},
-std::array<float,2>{0.671731591f, 0.434625119f},
-std::array<float,2>{0.183355138f, 0.881867349f},
-std::array<float,2>{0.279028594f, 0.0670762211f},
-std::array<float,2>{0.996317565f, 0.692892253f},
-std::array<float,2>{0.824732959f, 0.466344565f},
-std::array<float,2>{0.410575628f, 0.961277246f},
-std::array<float,2>{0.116338216f, 0.0280311685f},
-std::array<float,2>{0.504146814f, 0.637264848f},
-std::array<float,2>{0.71901685f, 0.190945223f},
-std::array<float,2>{0.248745844f, 0.510537565f},
-std::array<float,2>{0.322631627f, 0.270838946f},
-std::array<float,2>{0.875518143f, 0.772329867f},
-std::array<float,2>{0.942761242f, 0.0938784182f},
-std::array<float,2>{0.281659245f, 0.723424375f},
-std::array<float,2>{0.151403069f, 0.39698112f},
-std::array<float,2>{0.633995056f, 0.919012547f},
-std::array<float,2>{0.584913135f, 0.373517603f},
-std::array<float,2>{0.00480092084f, 0.839958966f},
-std::array<float,2>{0.458627015f, 0.165733546f},
-std::array<float,2>{0.795677423f, 0.580393076f},
-std::array<float,2>{0.862882614f, 0.274057895f},
-std::array<float,2>{0.40520528f, 0.774550438f},
-std::array<float,2>{0.0919652432f, 0.202495039f},
-std::array<float,2>{0.556490839f, 0.503014505f},
-std::array<float,2>{0.716607749f, 0.0175741129f},
-std::array<float,2>{0.189883977f, 0.626977921f},
-std::array<float,2>{0.368717968f, 0.455580741f},
-std::array<float,2>{0.924550533f, 0.959173143f},
-std::array<float,2>{0.990834832f, 0.157513052f},
-std::array<float,2>{0.268375158f, 0.586490333f},
-std::array<float,2>{0.177625045f, 0.361215234f},
-std::array<float,2>{0.662411094f, 0.832975626f},
-std::array<float,2>{0.604364574f, 0.405847341f},
-std::array<float,2>{0.0356208831f, 0.910332799f},
-std::array<float,2>{0.484969467f, 0.109003328f},
-std::array<float,2>{0.752012253f, 0.73420763f},
-std::array<float,2>{0.886669636f, 0.481064409f},
-std::array<float,2>{0.315431178f, 0.997443497f},
-std::array<float,2>{0.241369605f, 0.0317786299f},
-std::array<float,2>{0.727141321f, 0.662677288f},
-std::array<float,2>{0.50923121f, 0.233310193f},
-std::array<float,2>{0.118249878f, 0.533545732f},
-std::array<float,2>{0.414435059f, 0.305752158f},
-std::array<float,2>{0.818888664f, 0.788732767f},
-std::array<float,2>{0.783687532f, 0.0745684355f},
-std::array<float,2>{0.461627603f, 0.70105046f},
-std::array<float,2>{0.0106398175f, 0.426454157f},
-std::array<float,2>{0.592647672f, 0.889043152f},
-std::array<float,2>{0.62853545f, 0.320915788f},
-std::array<float,2>{0.146578044f, 0.863451362f},
-std::array<float,2>{0.292886227f, 0.137431696f},
-std::array<float,2>{0.949487925f, 0.604001522f},
-std::array<float,2>{0.968095124f, 0.344181865f},
-std::array<float,2>{0.311204374f, 0.823322058f},
-std::array<float,2>{0.131332919f, 0.185121164f},
-std::array<float,2>{0.65314126f, 0.573964119f},
-std::array<float,2>{0.572895527f, 0.118376009f},
-std::array<float,2>{0.0271847825f, 0.741920114f},
-std::array<float,2>{0.452696651f, 0.389999449f},
-std::array<float,2>{0.806503475f, 0.932573199f},
-std::array<float,2>{0.835297883f, 0.210717097f},
-std::array<float,2>{0.432617694f, 0.516920388f},
-std::array<float,2>{0.105856575f, 0.260288686f},
-std::array<float,2>{0.525296092f, 0.75344491f},
-std::array<float,2>{0.736626983f, 0.441841155f},
-std::array<float,2>{0.234218687f, 0.943148792f},
-std::array<float,2>{0.331805438f, 0.00612705899f},
-std::array<float,2>{0.897085249f, 0.654354513f},
-std::array<float,2>{0.767611861f, 0.406541705f},
-std::array<float,2>{0.47794795f, 0.894244194f},
-std::array<float,2>{0.0601246543f, 0.078992933f},
-std::array<float,2>{0.614554107f, 0.704050422f},
-std::array<float,2>{0.673957705f, 0.154365331f},
-std::array<float,2>{0.160429925f, 0.615650296f},
-std::array<float,2>{0.258408099f, 0.338069499f},
-std::array<float,2>{0.96969384f, 0.857465744f},
-std::array<float,2>{0.918537617f, 0.0499358997f},
-std::array<float,2>{0.352506667f, 0.674247444f},
-std::array<float,2>{0.216684312f, 0.494161099f},
-std::array<float,2>{0.695281804f, 0.969015002f},
-std::array<float,2>{0.537590027f, 0.28187561f},
-std::array<float,2>{0.062822476f, 0.806257725f},
-std::array<float,2>{0.382118225f, 0.238138318f},
-std::array<float,2>{0.853179276f, 0.554402053f},
-std::array<float,2>{0.842436731f, 0.366715401f},
-std::array<float,2>{0.426719218f, 0.830559373f},
-std::array<float,2>{0.0978922099f, 0.161357f},
-std::array<float,2>{0.51927346f, 0.593030393f},
-std::array<float,2>{0.74410224f, 0.103153057f},
-std::array<float,2>{0.21991758f, 0.730171382f},
-std::array<float,2>{0.34280771f, 0.400754303f},
-std::array<float,2>{0.898616016f, 0.907688677f},
-std::array<float,2>{0.959149361f, 0.197190896f},
-std::array<float,2>{0.298850089f, 0.504638314f},
-std::array<float,2>{0.135539562f, 0.278683364f},
-std::array<float,2>{0.647020757f, 0.777764499f},
-std::array<float,2>{0.565439761f, 0.459760725f},
-std::array<float,2>{0.0156584177f, 0.953386605f},
-std::array<float,2>{0.440463156f, 0.0229791235f},
-std::array<float,2>{0.799190164f, 0.629264176f},
-std::array<float,2>{0.910903871f, 0.422094107f},
-std::array<float,2>{0.34883818f, 0.883416533f},
-std::array<float,2>{0.208542302f, 0.0710525587f},
-std::array<float,2>{0.701641798f, 0.698414087f},
-std::array<float,2>{0.541012764f, 0.135922953f},
-std::array<float,2>{0.0707769692f, 0.608556926f},
-std::array<float,2>{0.384714156f, 0.32740131f},
-std::array<float,2>{0.847359836f, 0.862531722f},
-std::array<float,2>{0.778284013f, 0.0387219377f},
-std::array<float,2>{0.476163536f, 0.656472504f},
-std::array<float,2>{0.0505220927f, 0.479672462f},
-std::array<float,2>{0.618638813f, 0.995530069f},
-std::array<float,2>{0.680727541f, 0.310714781f},
-std::array<float,2>{0.167756498f, 0.785140991f},
-std::array<float,2>{0.254566193f, 0.228428289f},
-std::array<float,2>{0.980960011f, 0.535236895f},
-std::array<float,2>{0.992870629f, 0.262476474f},
-std::array<float,2>{0.276086956f, 0.754003882f},
-std::array<float,2>{0.184736744f, 0.205552503f},
-std::array<float,2>{0.667218864f, 0.521472335f},
-std::array<float,2>{0.600706518f, 0.00317207957f},
-std::array<float,2>{0.0462210327f, 0.648895681f},
-std::array<float,2>{0.497529715f, 0.439175695f},
-std::array<float,2>{0.758490324f, 0.939507246f},
-std::array<float,2>{0.87042284f, 0.179937169f},
-std::array<float,2>{0.391946316f, 0.575128198f},
-std::array<float,2>{0.0785223246f, 0.349126726f},
-std::array<float,2>{0.548704982f, 0.827325881f},
-std::array<float,2>{0.709253311f, 0.383867532f},
-std::array<float,2>{0.19830586f, 0.937122047f},
-std::array<float,2>{0.359385937f, 0.122835219f},
-std::array<float,2>{0.936709821f, 0.735182405f},
-std::array<float,2>{0.79206121f, 0.496511757f},
-std::array<float,2>{0.45374456f, 0.97287786f},
-std::array<float,2>{0.000447143218f, 0.0531193651f},
-std::array<float,2>{0.580696225f, 0.677480936f},
-std::array<float,2>{0.640491009f, 0.241244987f},
-std::array<float,2>{0.155924156f, 0.548385799f},
-std::array<float,2>{0.285982579f, 0.288476586f},
-std::array<float,2>{0.938784003f, 0.810612142f},
-std::array<float,2>{0.881896019f, 0.0838945135f},
-std::array<float,2>{0.326762259f, 0.710753918f},
-std::array<float,2>{0.242339164f, 0.411395252f},
-std::array<float,2>{0.724891901f, 0.898070812f},
-std::array<float,2>{0.500710368f, 0.340216488f},
-std::array<float,2>{0.112188421f, 0.854660451f},
-std::array<float,2>{0.409200281f, 0.148876399f},
-std::array<float,2>{0.823989034f, 0.612256467f},
-std::array<float,2>{0.755330741f, 0.29233247f},
-std::array<float,2>{0.488817096f, 0.800694346f},
-std::array<float,2>{0.0351014622f, 0.244682342f},
-std::array<float,2>{0.609121442f, 0.559138536f},
-std::array<float,2>{0.658534706f, 0.0605411045f},
-std::array<float,2>{0.175159097f, 0.685842276f},
-std::array<float,2>{0.27146706f, 0.491044611f},
-std::array<float,2>{0.984819293f, 0.977530777f},
-std::array<float,2>{0.928218961f, 0.146345079f},
-std::array<float,2>{0.371893555f, 0.623667181f},
-std::array<float,2>{0.193675682f, 0.33501038f},
-std::array<float,2>{0.712173164f, 0.844783664f},
-std::array<float,2>{0.562498808f, 0.420002967f},
-std::array<float,2>{0.0886006504f, 0.901623189f},
-std::array<float,2>{0.401367426f, 0.0933151394f},
-std::array<float,2>{0.866230965f, 0.712314904f},
-std::array<float,2>{0.946340084f, 0.44938904f},
-std::array<float,2>{0.294208288f, 0.950803518f},
-std::array<float,2>{0.141567066f, 0.0155941192f},
-std::array<float,2>{0.631799817f, 0.642241359f},
-std::array<float,2>{0.589594245f, 0.217247561f},
-std::array<float,2>{0.0143319042f, 0.529811382f},
-std::array<float,2>{0.465204835f, 0.253714502f},
-std::array<float,2>{0.787317455f, 0.764032841f},
-std::array<float,2>{0.814481974f, 0.111537017f},
-std::array<float,2>{0.419764072f, 0.748499095f},
-std::array<float,2>{0.123996191f, 0.376992434f},
-std::array<float,2>{0.51440531f, 0.929543853f},
-std::array<float,2>{0.732024193f, 0.35634923f},
-std::array<float,2>{0.237832233f, 0.817346931f},
-std::array<float,2>{0.318476677f, 0.172385484f},
-std::array<float,2>{0.889908612f, 0.562564731f},
-std::array<float,2>{0.892787218f, 0.314231932f},
-std::array<float,2>{0.334538817f, 0.872389555f},
-std::array<float,2>{0.229028568f, 0.128000945f},
-std::array<float,2>{0.742145538f, 0.596699417f},
-std::array<float,2>{0.529903471f, 0.0647854507f},
-std::array<float,2>{0.103521839f, 0.69058466f},
-std::array<float,2>{0.437330693f, 0.431235015f},
-std::array<float,2>{0.828285575f, 0.878572643f},
-std::array<float,2>{0.811609089f, 0.219867036f},
-std::array<float,2>{0.4459894f, 0.540492117f},
-std::array<float,2>{0.0276273917f, 0.297468305f},
-std::array<float,2>{0.577453732f, 0.794505775f},
-std::array<float,2>{0.649230957f, 0.476332366f},
-std::array<float,2>{0.126343548f, 0.988346696f},
-std::array<float,2>{0.304954737f, 0.0393428877f},
-std::array<float,2>{0.961427808f, 0.668959618f},
-std::array<float,2>{0.858299673f, 0.394324422f},
-std::array<float,2>{0.377525926f, 0.915414751f},
-std::array<float,2>{0.0672191754f, 0.0983564407f},
-std::array<float,2>{0.532662451f, 0.722006261f},
-std::array<float,2>{0.68998456f, 0.171174616f},
-std::array<float,2>{0.213119358f, 0.584718585f},
-std::array<float,2>{0.358149916f, 0.36829856f},
-std::array<float,2>{0.916379333f, 0.836785674f},
-std::array<float,2>{0.974306226f, 0.0256703906f},
-std::array<float,2>{0.262960762f, 0.636193216f},
-std::array<float,2>{0.156653509f, 0.462091386f},
-std::array<float,2>{0.678884447f, 0.96861881f},
-std::array<float,2>{0.609423578f, 0.26875928f},
-std::array<float,2>{0.0569356643f, 0.765761018f},
-std::array<float,2>{0.481075495f, 0.195110634f},
-std::array<float,2>{0.773374081f, 0.51256609f},
-std::array<float,2>{0.763564944f, 0.318763286f},
-std::array<float,2>{0.494148374f, 0.867677271f},
-std::array<float,2>{0.0396176986f, 0.129810825f},
-std::array<float,2>{0.596518576f, 0.598617792f},
-std::array<float,2>{0.668333828f, 0.0681473315f},
-std::array<float,2>{0.180845484f, 0.6914621f},
-std::array<float,2>{0.279569238f, 0.433916569f},
-std::array<float,2>{0.999582648f, 0.881733775f},
-std::array<float,2>{0.933119178f, 0.224211365f},
-std::array<float,2>{0.365027279f, 0.546010196f},
-std::array<float,2>{0.201428846f, 0.303761423f},
-std::array<float,2>{0.706456542f, 0.792493701f},
-std::array<float,2>{0.553642869f, 0.469232321f},
-std::array<float,2>{0.0837677419f, 0.987066865f},
-std::array<float,2>{0.394803822f, 0.0451734886f},
-std::array<float,2>{0.873804331f, 0.666329205f},
-std::array<float,2>{0.944100022f, 0.397738457f},
-std::array<float,2>{0.284101099f, 0.91877991f},
-std::array<float,2>{0.148486331f, 0.0948248357f},
-std::array<float,2>{0.6357885f, 0.724219739f},
-std::array<float,2>{0.582211554f, 0.164323479f},
-std::array<float,2>{0.00721168565f, 0.581170917f},
-std::array<float,2>{0.460849583f, 0.374431968f},
-std::array<float,2>{0.794225514f, 0.841362238f},
-std::array<float,2>{0.827446938f, 0.0292448569f},
-std::array<float,2>{0.41313836f, 0.6385414f},
-std::array<float,2>{0.113427944f, 0.465311557f},
-std::array<float,2>{0.507492483f, 0.962000191f},
-std::array<float,2>{0.721763968f, 0.269986629f},
-std::array<float,2>{0.247082457f, 0.772750854f},
-std::array<float,2>{0.322122514f, 0.190283388f},
-std::array<float,2>{0.878307045f, 0.51117754f},
-std::array<float,2>{0.902792811f, 0.294629514f},
-std::array<float,2>{0.337715447f, 0.801852763f},
-std::array<float,2>{0.223678559f, 0.249905109f},
-std::array<float,2>{0.749963045f, 0.557540655f},
-std::array<float,2>{0.522949278f, 0.0556388274f},
-std::array<float,2>{0.0951837301f, 0.682255626f},
-std::array<float,2>{0.424547017f, 0.485632092f},
-std::array<float,2>{0.83829987f, 0.983834982f},
-std::array<float,2>{0.801970005f, 0.1416789f},
-std::array<float,2>{0.443690836f, 0.618981183f},
-std::array<float,2>{0.0226991028f, 0.329962581f},
-std::array<float,2>{0.569421589f, 0.851307452f},
-std::array<float,2>{0.6406703f, 0.417185932f},
-std::array<float,2>{0.139028609f, 0.904472649f},
-std::array<float,2>{0.303969324f, 0.0861490741f},
-std::array<float,2>{0.95642215f, 0.715069532f},
-std::array<float,2>{0.850682557f, 0.447478443f},
-std::array<float,2>{0.390412837f, 0.946662605f},
-std::array<float,2>{0.0753895119f, 0.0098960828f},
-std::array<float,2>{0.544956386f, 0.647955239f},
-std::array<float,2>{0.695483327f, 0.212210864f},
-std::array<float,2>{0.204476416f, 0.525616646f},
-std::array<float,2>{0.345804751f, 0.255247384f},
-std::array<float,2>{0.906555891f, 0.758722603f},
-std::array<float,2>{0.979048431f, 0.115646899f},
-std::array<float,2>{0.250860244f, 0.745391488f},
-std::array<float,2>{0.169313863f, 0.379431546f},
-std::array<float,2>{0.686823189f, 0.924965918f},
-std::array<float,2>{0.622366786f, 0.353042334f},
-std::array<float,2>{0.0514820255f, 0.812867284f},
-std::array<float,2>{0.470047981f, 0.176492125f},
-std::array<float,2>{0.776745021f, 0.569312096f},
-std::array<float,2>{0.833812535f, 0.261474609f},
-std::array<float,2>{0.430079818f, 0.752379f},
-std::array<float,2>{0.108527951f, 0.209494367f},
-std::array<float,2>{0.526423872f, 0.516562045f},
-std::array<float,2>{0.735415459f, 0.00692977244f},
-std::array<float,2>{0.23107703f, 0.65542984f},
-std::array<float,2>{0.328747243f, 0.442821741f},
-std::array<float,2>{0.895263255f, 0.942266762f},
-std::array<float,2>{0.965138078f, 0.184197292f},
-std::array<float,2>{0.309779495f, 0.572524846f},
-std::array<float,2>{0.129139081f, 0.345344663f},
-std::array<float,2>{0.654485703f, 0.822338462f},
-std::array<float,2>{0.570382655f, 0.389426976f},
-std::array<float,2>{0.0246918835f, 0.933391094f},
-std::array<float,2>{0.450729787f, 0.117313057f},
-std::array<float,2>{0.808122218f, 0.740990043f},
-std::array<float,2>{0.920612335f, 0.495839804f},
-std::array<float,2>{0.353653282f, 0.970055878f},
-std::array<float,2>{0.218023703f, 0.04927136f},
-std::array<float,2>{0.691462398f, 0.675371885f},
-std::array<float,2>{0.53704071f, 0.23638767f},
-std::array<float,2>{0.0662552267f, 0.553259134f},
-std::array<float,2>{0.379175931f, 0.282246828f},
-std::array<float,2>{0.854674518f, 0.80489254f},
-std::array<float,2>{0.766463995f, 0.0793584734f},
-std::array<float,2>{0.479564935f, 0.704874337f},
-std::array<float,2>{0.0611535423f, 0.407320857f},
-std::array<float,2>{0.61685735f, 0.892714798f},
-std::array<float,2>{0.672608614f, 0.339645296f},
-std::array<float,2>{0.163238183f, 0.858616054f},
-std::array<float,2>{0.259814799f, 0.15600355f},
-std::array<float,2>{0.970891118f, 0.616563022f},
-std::array<float,2>{0.989361167f, 0.359633356f},
-std::array<float,2>{0.267256021f, 0.833910346f},
-std::array<float,2>{0.178239375f, 0.157203868f},
-std::array<float,2>{0.660655141f, 0.587783277f},
-std::array<float,2>{0.601628125f, 0.107747577f},
-std::array<float,2>{0.0382602029f, 0.732861757f},
-std::array<float,2>{0.48750785f, 0.404631138f},
-std::array<float,2>{0.750268638f, 0.912072122f},
-std::array<float,2>{0.859637678f, 0.201868847f},
-std::array<float,2>{0.403470129f, 0.502457738f},
-std::array<float,2>{0.0906721801f, 0.27496326f},
-std::array<float,2>{0.558505237f, 0.774264753f},
-std::array<float,2>{0.717216551f, 0.456951648f},
-std::array<float,2>{0.189241976f, 0.960473895f},
-std::array<float,2>{0.370208651f, 0.0160459243f},
-std::array<float,2>{0.922425568f, 0.628114581f},
-std::array<float,2>{0.781927049f, 0.427293479f},
-std::array<float,2>{0.462950677f, 0.889879048f},
-std::array<float,2>{0.00932833925f, 0.0756645799f},
-std::array<float,2>{0.590403616f, 0.69945395f},
-std::array<float,2>{0.626174688f, 0.137760296f},
-std::array<float,2>{0.144557625f, 0.604813874f},
-std::array<float,2>{0.290921032f, 0.321378589f},
-std::array<float,2>{0.952770233f, 0.865091026f},
-std::array<float,2>{0.883335292f, 0.0323429555f},
-std::array<float,2>{0.313116759f, 0.663979411f},
-std::array<float,2>{0.238969177f, 0.482241452f},
-std::array<float,2>{0.729578316f, 0.99694705f},
-std::array<float,2>{0.510295093f, 0.30549112f},
-std::array<float,2>{0.119631812f, 0.787345111f},
-std::array<float,2>{0.416458488f, 0.233612239f},
-std::array<float,2>{0.817866206f, 0.534471273f},
-std::array<float,2>{0.867910564f, 0.348141968f},
-std::array<float,2>{0.393383026f, 0.827146053f},
-std::array<float,2>{0.0801648051f, 0.181585327f},
-std::array<float,2>{0.550707459f, 0.575495362f},
-std::array<float,2>{0.707563341f, 0.121811323f},
-std::array<float,2>{0.196947694f, 0.735378027f},
-std::array<float,2>{0.361739784f, 0.382890254f},
-std::array<float,2>{0.935452402f, 0.936167955f},
-std::array<float,2>{0.994959831f, 0.206891835f},
-std::array<float,2>{0.274293303f, 0.51999259f},
-std::array<float,2>{0.18672052f, 0.263523936f},
-std::array<float,2>{0.665514827f, 0.755402982f},
-std::array<float,2>{0.598178625f, 0.437540799f},
-std::array<float,2>{0.043830689f, 0.941190124f},
-std::array<float,2>{0.499758005f, 0.00217200327f},
-std::array<float,2>{0.761333346f, 0.650203407f},
-std::array<float,2>{0.878984034f, 0.410276115f},
-std::array<float,2>{0.326070815f, 0.896922171f},
-std::array<float,2>{0.245821789f, 0.0828855783f},
-std::array<float,2>{0.724334598f, 0.709949374f},
-std::array<float,2>{0.50269419f, 0.149773702f},
-std::array<float,2>{0.110200211f, 0.612938702f},
-std::array<float,2>{0.406908095f, 0.341759622f},
-std::array<float,2>{0.821403563f, 0.853542328f},
-std::array<float,2>{0.789992571f, 0.0539283603f},
-std::array<float,2>{0.456527412f, 0.676525295f},
-std::array<float,2>{0.00382690225f, 0.497846872f},
-std::array<float,2>{0.579725742f, 0.974097371f},
-std::array<float,2>{0.637654662f, 0.287182003f},
-std::array<float,2>{0.153323159f, 0.811934054f},
-std::array<float,2>{0.288761199f, 0.240589291f},
-std::array<float,2>{0.940130413f, 0.547096968f},
-std::array<float,2>{0.957965195f, 0.278131753f},
-std::array<float,2>{0.297190905f, 0.778428435f},
-std::array<float,2>{0.133659616f, 0.195440292f},
-std::array<float,2>{0.645824492f, 0.505561769f},
-std::array<float,2>{0.563492954f, 0.0215445757f},
-std::array<float,2>{0.0180353858f, 0.630058825f},
-std::array<float,2>{0.437882841f, 0.460034907f},
-std::array<float,2>{0.797504723f, 0.95420444f},
-std::array<float,2>{0.841532469f, 0.161039606f},
-std::array<float,2>{0.429658324f, 0.592009485f},
-std::array<float,2>{0.099745743f, 0.365968227f},
-std::array<float,2>{0.516153395f, 0.831056356f},
-std::array<float,2>{0.744325936f, 0.402026594f},
-std::array<float,2>{0.22157836f, 0.906819165f},
-std::array<float,2>{0.340535641f, 0.101734616f},
-std::array<float,2>{0.901985824f, 0.729343891f},
-std::array<float,2>{0.781107664f, 0.478880137f},
-std::array<float,2>{0.473875672f, 0.994838297f},
-std::array<float,2>{0.0473478697f, 0.0379421636f},
-std::array<float,2>{0.619797289f, 0.65748477f},
-std::array<float,2>{0.682706475f, 0.22711651f},
-std::array<float,2>{0.164489478f, 0.536463916f},
-std::array<float,2>{0.255985677f, 0.312080055f},
-std::array<float,2>{0.983236134f, 0.784175575f},
-std::array<float,2>{0.913279772f, 0.071336396f},
-std::array<float,2>{0.349711657f, 0.697614908f},
-std::array<float,2>{0.210881114f, 0.423205703f},
-std::array<float,2>{0.699448824f, 0.884350717f},
-std::array<float,2>{0.542060316f, 0.326303869f},
-std::array<float,2>{0.073763527f, 0.862101316f},
-std::array<float,2>{0.385899305f, 0.134925485f},
-std::array<float,2>{0.844211936f, 0.60779202f},
-std::array<float,2>{0.808690012f, 0.298076898f},
-std::array<float,2>{0.448722333f, 0.79342407f},
-std::array<float,2>{0.0301783737f, 0.219017729f},
-std::array<float,2>{0.574538708f, 0.539790809f},
-std::array<float,2>{0.650906742f, 0.0404123701f},
-std::array<float,2>{0.127607197f, 0.668446958f},
-std::array<float,2>{0.307326704f, 0.47485739f},
-std::array<float,2>{0.964729309f, 0.989447415f},
-std::array<float,2>{0.891048312f, 0.127831563f},
-std::array<float,2>{0.333273619f, 0.59583807f},
-std::array<float,2>{0.228221372f, 0.313357711f},
-std::array<float,2>{0.738437414f, 0.871658266f},
-std::array<float,2>{0.527456582f, 0.42973274f},
-std::array<float,2>{0.10214489f, 0.877701104f},
-std::array<float,2>{0.434738964f, 0.0654925928f},
-std::array<float,2>{0.831576943f, 0.689501345f},
-std::array<float,2>{0.975239813f, 0.461524576f},
-std::array<float,2>{0.26557222f, 0.96743834f},
-std::array<float,2>{0.158981904f, 0.0265428014f},
-std::array<float,2>{0.677599728f, 0.635399818f},
-std::array<float,2>{0.611798167f, 0.193707913f},
-std::array<float,2>{0.0550499968f, 0.513178527f},
-std::array<float,2>{0.483799428f, 0.267725289f},
-std::array<float,2>{0.76978004f, 0.766982377f},
-std::array<float,2>{0.856504083f, 0.0987674966f},
-std::array<float,2>{0.376778692f, 0.7211501f},
-std::array<float,2>{0.0687703267f, 0.393246591f},
-std::array<float,2>{0.534521461f, 0.914502323f},
-std::array<float,2>{0.687862933f, 0.368133098f},
-std::array<float,2>{0.212462813f, 0.837009728f},
-std::array<float,2>{0.357018679f, 0.170135334f},
-std::array<float,2>{0.915326774f, 0.585885644f},
-std::array<float,2>{0.926737249f, 0.334860861f},
-std::array<float,2>{0.373604745f, 0.844439089f},
-std::array<float,2>{0.191955253f, 0.144559219f},
-std::array<float,2>{0.714581311f, 0.624613225f},
-std::array<float,2>{0.560451031f, 0.0925230384f},
-std::array<float,2>{0.0867737606f, 0.711846232f},
-std::array<float,2>{0.398964614f, 0.421104819f},
-std::array<float,2>{0.864206016f, 0.900951803f},
-std::array<float,2>{0.756014287f, 0.245585665f},
-std::array<float,2>{0.49097982f, 0.560202599f},
-std::array<float,2>{0.032520514f, 0.291460812f},
-std::array<float,2>{0.605708241f, 0.79952985f},
-std::array<float,2>{0.657173753f, 0.491221875f},
-std::array<float,2>{0.172586948f, 0.9780913f},
-std::array<float,2>{0.27233693f, 0.0593753494f},
-std::array<float,2>{0.986681342f, 0.686934412f},
-std::array<float,2>{0.812710106f, 0.378147542f},
-std::array<float,2>{0.419959009f, 0.9282583f},
-std::array<float,2>{0.12175265f, 0.112307683f},
-std::array<float,2>{0.513284147f, 0.749956489f},
-std::array<float,2>{0.734216094f, 0.173068091f},
-std::array<float,2>{0.234513655f, 0.56373173f},
-std::array<float,2>{0.317861259f, 0.357156217f},
-std::array<float,2>{0.887627125f, 0.818165481f},
-std::array<float,2>{0.94742614f, 0.0139365988f},
-std::array<float,2>{0.295270234f, 0.641050816f},
-std::array<float,2>{0.143406853f, 0.450216383f},
-std::array<float,2>{0.63064152f, 0.950182855f},
-std::array<float,2>{0.586431205f, 0.252781659f},
-std::array<float,2>{0.0134719182f, 0.765355766f},
-std::array<float,2>{0.467671603f, 0.21839115f},
-std::array<float,2>{0.786415637f, 0.530913949f},
-std::array<float,2>{0.796085536f, 0.372854412f},
-std::array<float,2>{0.457855105f, 0.843723953f},
-std::array<float,2>{0.00526431529f, 0.166428968f},
-std::array<float,2>{0.585304976f, 0.579519153f},
-std::array<float,2>{0.633633494f, 0.097424224f},
-std::array<float,2>{0.151239395f, 0.724753082f},
-std::array<float,2>{0.282257617f, 0.395626545f},
-std::array<float,2>{0.942371368f, 0.920187414f},
-std::array<float,2>{0.876391649f, 0.18885763f},
-std::array<float,2>{0.32329464f, 0.509109437f},
-std::array<float,2>{0.249300063f, 0.271559358f},
-std::array<float,2>{0.720546007f, 0.770315886f},
-std::array<float,2>{0.505025685f, 0.468250543f},
-std::array<float,2>{0.115385205f, 0.964253247f},
-std::array<float,2>{0.411473066f, 0.0304656308f},
-std::array<float,2>{0.82609731f, 0.639394403f},
-std::array<float,2>{0.997920454f, 0.436561078f},
-std::array<float,2>{0.277748495f, 0.878995061f},
-std::array<float,2>{0.182449669f, 0.0684818998f},
-std::array<float,2>{0.670707226f, 0.69380337f},
-std::array<float,2>{0.595121086f, 0.132255524f},
-std::array<float,2>{0.041356612f, 0.599785626f},
-std::array<float,2>{0.49324742f, 0.317479372f},
-std::array<float,2>{0.764754593f, 0.870438159f},
-std::array<float,2>{0.872630596f, 0.043474596f},
-std::array<float,2>{0.397667527f, 0.664362252f},
-std::array<float,2>{0.0847179443f, 0.471481234f},
-std::array<float,2>{0.552047551f, 0.985905588f},
-std::array<float,2>{0.70410037f, 0.301738501f},
-std::array<float,2>{0.200690418f, 0.789485216f},
-std::array<float,2>{0.366863638f, 0.225930467f},
-std::array<float,2>{0.931322873f, 0.544615924f},
-std::array<float,2>{0.908752143f, 0.256946057f},
-std::array<float,2>{0.344984114f, 0.759970605f},
-std::array<float,2>{0.205378622f, 0.213854119f},
-std::array<float,2>{0.697462976f, 0.524992943f},
-std::array<float,2>{0.543143213f, 0.00826312043f},
-std::array<float,2>{0.0777857229f, 0.646091104f},
-std::array<float,2>{0.388189644f, 0.445342183f},
-std::array<float,2>{0.84920013f, 0.948626697f},
-std::array<float,2>{0.774054468f, 0.178285241f},
-std::array<float,2>{0.472334146f, 0.568339646f},
-std::array<float,2>{0.0541521907f, 0.353883088f},
-std::array<float,2>{0.623427331f, 0.815555811f},
-std::array<float,2>{0.68478477f, 0.380886883f},
-std::array<float,2>{0.170885116f, 0.922814488f},
-std::array<float,2>{0.253017157f, 0.114412203f},
-std::array<float,2>{0.978514433f, 0.742846668f},
-std::array<float,2>{0.83682245f, 0.486552745f},
-std::array<float,2>{0.423028022f, 0.980959177f},
-std::array<float,2>{0.0968301371f, 0.0583980158f},
-std::array<float,2>{0.520794272f, 0.679754913f},
-std::array<float,2>{0.746634364f, 0.247078091f},
-std::array<float,2>{0.226058781f, 0.554805398f},
-std::array<float,2>{0.339541882f, 0.296112478f},
-std::array<float,2>{0.905786753f, 0.803473175f},
-std::array<float,2>{0.954451144f, 0.0881841183f},
-std::array<float,2>{0.301848024f, 0.717157245f},
-std::array<float,2>{0.136891052f, 0.414584607f},
-std::array<float,2>{0.64309442f, 0.902737975f},
-std::array<float,2>{0.568216085f, 0.331799477f},
-std::array<float,2>{0.0196395516f, 0.848096967f},
-std::array<float,2>{0.442970812f, 0.143829644f},
-std::array<float,2>{0.804035366f, 0.619468629f},
-std::array<float,2>{0.852452219f, 0.284087688f},
-std::array<float,2>{0.381556988f, 0.808363795f},
-std::array<float,2>{0.0636186674f, 0.234889671f},
-std::array<float,2>{0.538115919f, 0.552071571f},
-std::array<float,2>{0.694300234f, 0.0473505035f},
-std::array<float,2>{0.215280324f, 0.672223389f},
-std::array<float,2>{0.353014916f, 0.493224084f},
-std::array<float,2>{0.919524968f, 0.971551239f},
-std::array<float,2>{0.970167875f, 0.153606549f},
-std::array<float,2>{0.259114981f, 0.613947928f},
-std::array<float,2>{0.161902308f, 0.336961687f},
-std::array<float,2>{0.675006509f, 0.856719494f},
-std::array<float,2>{0.61332655f, 0.409233958f},
-std::array<float,2>{0.0592879839f, 0.891090333f},
-std::array<float,2>{0.477348208f, 0.0819611475f},
-std::array<float,2>{0.768606484f, 0.705145836f},
-std::array<float,2>{0.898055613f, 0.443901807f},
-std::array<float,2>{0.330879599f, 0.945079684f},
-std::array<float,2>{0.232457608f, 0.00516653107f},
-std::array<float,2>{0.737630785f, 0.654198647f},
-std::array<float,2>{0.523922503f, 0.208520129f},
-std::array<float,2>{0.106738828f, 0.518889785f},
-std::array<float,2>{0.432349682f, 0.25822556f},
-std::array<float,2>{0.834225476f, 0.751943231f},
-std::array<float,2>{0.804882824f, 0.119938076f},
-std::array<float,2>{0.452102602f, 0.739952266f},
-std::array<float,2>{0.0259190928f, 0.388315767f},
-std::array<float,2>{0.573804379f, 0.931568444f},
-std::array<float,2>{0.654272735f, 0.34691447f},
-std::array<float,2>{0.13192302f, 0.822211087f},
-std::array<float,2>{0.312285781f, 0.187365413f},
-std::array<float,2>{0.967541754f, 0.571652114f},
-std::array<float,2>{0.950873017f, 0.322825521f},
-std::array<float,2>{0.291645527f, 0.866457641f},
-std::array<float,2>{0.147559598f, 0.140477046f},
-std::array<float,2>{0.62771827f, 0.602043092f},
-std::array<float,2>{0.593430161f, 0.0769991428f},
-std::array<float,2>{0.0116152391f, 0.702227294f},
-std::array<float,2>{0.462618619f, 0.428335071f},
-std::array<float,2>{0.784555018f, 0.887901008f},
-std::array<float,2>{0.820224047f, 0.231024623f},
-std::array<float,2>{0.415653169f, 0.53163439f},
-std::array<float,2>{0.117593639f, 0.306974769f},
-std::array<float,2>{0.508093357f, 0.785238564f},
-std::array<float,2>{0.727991104f, 0.483616233f},
-std::array<float,2>{0.241108268f, 0.999940276f},
-std::array<float,2>{0.31480509f, 0.0351312049f},
-std::array<float,2>{0.884806395f, 0.660832286f},
-std::array<float,2>{0.753527224f, 0.403624713f},
-std::array<float,2>{0.486223459f, 0.912990689f},
-std::array<float,2>{0.0364370085f, 0.106541678f},
-std::array<float,2>{0.605225384f, 0.730601668f},
-std::array<float,2>{0.663766205f, 0.159214452f},
-std::array<float,2>{0.176169008f, 0.58903116f},
-std::array<float,2>{0.268762529f, 0.361834913f},
-std::array<float,2>{0.99135375f, 0.834002078f},
-std::array<float,2>{0.925116122f, 0.0179009996f},
-std::array<float,2>{0.3674272f, 0.626321018f},
-std::array<float,2>{0.190771639f, 0.454640359f},
-std::array<float,2>{0.714999378f, 0.957970381f},
-std::array<float,2>{0.554748654f, 0.275418311f},
-std::array<float,2>{0.0931376666f, 0.775619209f},
-std::array<float,2>{0.405730098f, 0.200529069f},
-std::array<float,2>{0.861875832f, 0.500622153f},
-std::array<float,2>{0.822853506f, 0.342378885f},
-std::array<float,2>{0.408858001f, 0.852607906f},
-std::array<float,2>{0.113013513f, 0.150962338f},
-std::array<float,2>{0.501009822f, 0.610182285f},
-std::array<float,2>{0.726041436f, 0.0858695656f},
-std::array<float,2>{0.24345997f, 0.707251251f},
-std::array<float,2>{0.327164382f, 0.413028657f},
-std::array<float,2>{0.881101131f, 0.895525575f},
-std::array<float,2>{0.938392282f, 0.238439336f},
-std::array<float,2>{0.287057161f, 0.550561965f},
-std::array<float,2>{0.155105293f, 0.286635637f},
-std::array<float,2>{0.63952136f, 0.808739543f},
-std::array<float,2>{0.581996739f, 0.499825895f},
-std::array<float,2>{0.00111165608f, 0.974665165f},
-std::array<float,2>{0.454697579f, 0.0515679494f},
-std::array<float,2>{0.791726828f, 0.679480195f},
-std::array<float,2>{0.935871363f, 0.384775549f},
-std::array<float,2>{0.36129424f, 0.934021771f},
-std::array<float,2>{0.197861329f, 0.1233055f},
-std::array<float,2>{0.710859716f, 0.736576974f},
-std::array<float,2>{0.547760367f, 0.183329821f},
-std::array<float,2>{0.079194963f, 0.577571988f},
-std::array<float,2>{0.391207933f, 0.351447344f},
-std::array<float,2>{0.870008171f, 0.824361086f},
-std::array<float,2>{0.759698749f, 0.0012481045f},
-std::array<float,2>{0.496617258f, 0.651082814f},
-std::array<float,2>{0.0456361957f, 0.440158308f},
-std::array<float,2>{0.600101233f, 0.93839401f},
-std::array<float,2>{0.666564345f, 0.263719201f},
-std::array<float,2>{0.184325472f, 0.756108999f},
-std::array<float,2>{0.276681393f, 0.204784334f},
-std::array<float,2>{0.993732214f, 0.522766829f},
-std::array<float,2>{0.981839359f, 0.309007645f},
-std::array<float,2>{0.255394906f, 0.78253597f},
-std::array<float,2>{0.16610606f, 0.229193866f},
-std::array<float,2>{0.680392504f, 0.538213372f},
-std::array<float,2>{0.617538333f, 0.0363297276f},
-std::array<float,2>{0.048962906f, 0.660111606f},
-std::array<float,2>{0.474791765f, 0.47658062f},
-std::array<float,2>{0.779251575f, 0.992795408f},
-std::array<float,2>{0.846540034f, 0.133282512f},
-std::array<float,2>{0.383564383f, 0.605476975f},
-std::array<float,2>{0.0715448931f, 0.325994492f},
-std::array<float,2>{0.539571345f, 0.861072183f},
-std::array<float,2>{0.702723563f, 0.425646067f},
-std::array<float,2>{0.207456902f, 0.88613677f},
-std::array<float,2>{0.347941667f, 0.0725235045f},
-std::array<float,2>{0.911779284f, 0.695626795f},
-std::array<float,2>{0.799871683f, 0.457611978f},
-std::array<float,2>{0.440031201f, 0.956726253f},
-std::array<float,2>{0.016747389f, 0.0201862045f},
-std::array<float,2>{0.564688623f, 0.631807864f},
-std::array<float,2>{0.648107171f, 0.197976083f},
-std::array<float,2>{0.136621311f, 0.507296383f},
-std::array<float,2>{0.300474167f, 0.28065002f},
-std::array<float,2>{0.960029244f, 0.779312134f},
-std::array<float,2>{0.90016067f, 0.10419707f},
-std::array<float,2>{0.342266977f, 0.726833701f},
-std::array<float,2>{0.219585553f, 0.399631113f},
-std::array<float,2>{0.743079126f, 0.909212768f},
-std::array<float,2>{0.517863691f, 0.364862025f},
-std::array<float,2>{0.0991140902f, 0.829032004f},
-std::array<float,2>{0.427109957f, 0.162289232f},
-std::array<float,2>{0.843462586f, 0.591433883f},
-std::array<float,2>{0.7716344f, 0.267577171f},
-std::array<float,2>{0.481472164f, 0.76765132f},
-std::array<float,2>{0.0576787218f, 0.193087012f},
-std::array<float,2>{0.611156881f, 0.515610039f},
-std::array<float,2>{0.677985013f, 0.023497818f},
-std::array<float,2>{0.157908663f, 0.632834792f},
-std::array<float,2>{0.262639523f, 0.46412769f},
-std::array<float,2>{0.973572552f, 0.964985371f},
-std::array<float,2>{0.917820036f, 0.169291943f},
-std::array<float,2>{0.358608752f, 0.583961725f},
-std::array<float,2>{0.214272082f, 0.370354503f},
-std::array<float,2>{0.690951228f, 0.838071227f},
-std::array<float,2>{0.531518877f, 0.392087817f},
-std::array<float,2>{0.0683191717f, 0.917235136f},
-std::array<float,2>{0.378182173f, 0.0996542796f},
-std::array<float,2>{0.858695209f, 0.720610499f},
-std::array<float,2>{0.962139308f, 0.473083735f},
-std::array<float,2>{0.30634588f, 0.991973877f},
-std::array<float,2>{0.125240952f, 0.0410732627f},
-std::array<float,2>{0.649670959f, 0.67112565f},
-std::array<float,2>{0.57670635f, 0.2223223f},
-std::array<float,2>{0.0285774488f, 0.542387843f},
-std::array<float,2>{0.446494788f, 0.299845666f},
-std::array<float,2>{0.810896695f, 0.796462059f},
-std::array<float,2>{0.829625309f, 0.0632001087f},
-std::array<float,2>{0.436323404f, 0.68778789f},
-std::array<float,2>{0.104816616f, 0.432303637f},
-std::array<float,2>{0.530976474f, 0.87531209f},
-std::array<float,2>{0.740314543f, 0.314902723f},
-std::array<float,2>{0.230092466f, 0.873714149f},
-std::array<float,2>{0.335079342f, 0.126030102f},
-std::array<float,2>{0.894208074f, 0.594792068f},
-std::array<float,2>{0.888712168f, 0.358352333f},
-std::array<float,2>{0.319476217f, 0.820064723f},
-std::array<float,2>{0.236814812f, 0.174892351f},
-std::array<float,2>{0.730608225f, 0.565669835f},
-std::array<float,2>{0.514683425f, 0.111256436f},
-std::array<float,2>{0.124343261f, 0.747540414f},
-std::array<float,2>{0.418546349f, 0.375826061f},
-std::array<float,2>{0.816263139f, 0.927318811f},
-std::array<float,2>{0.788650393f, 0.214877129f},
-std::array<float,2>{0.466682881f, 0.527918875f},
-std::array<float,2>{0.0148110166f, 0.250357985f},
-std::array<float,2>{0.588182688f, 0.762907684f},
-std::array<float,2>{0.632624328f, 0.451182097f},
-std::array<float,2>{0.142182812f, 0.951287806f},
-std::array<float,2>{0.293135554f, 0.0125350105f},
-std::array<float,2>{0.9455477f, 0.644408643f},
-std::array<float,2>{0.865578771f, 0.41984728f},
-std::array<float,2>{0.40083757f, 0.89979136f},
-std::array<float,2>{0.0898147747f, 0.0916122422f},
-std::array<float,2>{0.561225295f, 0.712988377f},
-std::array<float,2>{0.711891413f, 0.147120491f},
-std::array<float,2>{0.194455847f, 0.621994197f},
-std::array<float,2>{0.372942775f, 0.332251132f},
-std::array<float,2>{0.929267108f, 0.846780777f},
-std::array<float,2>{0.985722899f, 0.0621385016f},
-std::array<float,2>{0.270169675f, 0.685494483f},
-std::array<float,2>{0.174190119f, 0.489048511f},
-std::array<float,2>{0.659205139f, 0.979502499f},
-std::array<float,2>{0.607834399f, 0.290789783f},
-std::array<float,2>{0.0336557217f, 0.796981275f},
-std::array<float,2>{0.489725053f, 0.243185177f},
-std::array<float,2>{0.753980994f, 0.561252773f},
-std::array<float,2>{0.750870764f, 0.36133489f},
-std::array<float,2>{0.487992227f, 0.834669411f},
-std::array<float,2>{0.0386131033f, 0.159898341f},
-std::array<float,2>{0.602214456f, 0.589396596f},
-std::array<float,2>{0.66053462f, 0.107073151f},
-std::array<float,2>{0.177955851f, 0.731345832f},
-std::array<float,2>{0.266904175f, 0.404014975f},
-std::array<float,2>{0.989959598f, 0.912248969f},
-std::array<float,2>{0.922039688f, 0.201033175f},
-std::array<float,2>{0.370711505f, 0.500225425f},
-std::array<float,2>{0.188500449f, 0.276169926f},
-std::array<float,2>{0.717302144f, 0.776020765f},
-std::array<float,2>{0.557724416f, 0.454187304f},
-std::array<float,2>{0.090001218f, 0.957483888f},
-std::array<float,2>{0.403982997f, 0.0181599483f},
-std::array<float,2>{0.859989226f, 0.626677454f},
-std::array<float,2>{0.952206373f, 0.427924216f},
-std::array<float,2>{0.290332854f, 0.888493538f},
-std::array<float,2>{0.145444244f, 0.0766154602f},
-std::array<float,2>{0.626731992f, 0.702735543f},
-std::array<float,2>{0.590100765f, 0.13988255f},
-std::array<float,2>{0.00892227981f, 0.602476478f},
-std::array<float,2>{0.46371448f, 0.322584838f},
-std::array<float,2>{0.781415761f, 0.866850257f},
-std::array<float,2>{0.818295598f, 0.0346061215f},
-std::array<float,2>{0.416955978f, 0.660555661f},
-std::array<float,2>{0.11922387f, 0.484127134f},
-std::array<float,2>{0.50990504f, 0.999449313f},
-std::array<float,2>{0.730113685f, 0.307311743f},
-std::array<float,2>{0.238577977f, 0.785938263f},
-std::array<float,2>{0.312691957f, 0.230550483f},
-std::array<float,2>{0.883251488f, 0.53195256f},
-std::array<float,2>{0.894775569f, 0.25854975f},
-std::array<float,2>{0.32816121f, 0.751069129f},
-std::array<float,2>{0.230773225f, 0.208346635f},
-std::array<float,2>{0.735990584f, 0.519479573f},
-std::array<float,2>{0.526950538f, 0.00539051788f},
-std::array<float,2>{0.109304614f, 0.653754592f},
-std::array<float,2>{0.430430621f, 0.443490803f},
-std::array<float,2>{0.833334386f, 0.944813848f},
-std::array<float,2>{0.807870209f, 0.186881676f},
-std::array<float,2>{0.450499594f, 0.571936548f},
-std::array<float,2>{0.025059795f, 0.3474648f},
-std::array<float,2>{0.571180224f, 0.821667731f},
-std::array<float,2>{0.655228138f, 0.38808462f},
-std::array<float,2>{0.129790619f, 0.931049287f},
-std::array<float,2>{0.310266525f, 0.119279422f},
-std::array<float,2>{0.965756059f, 0.739295185f},
-std::array<float,2>{0.854995906f, 0.493773222f},
-std::array<float,2>{0.379555881f, 0.970809937f},
-std::array<float,2>{0.0654587671f, 0.047793597f},
-std::array<float,2>{0.536224782f, 0.672832012f},
-std::array<float,2>{0.691904545f, 0.234441563f},
-std::array<float,2>{0.218590066f, 0.552614748f},
-std::array<float,2>{0.354377568f, 0.283204228f},
-std::array<float,2>{0.920117438f, 0.808080256f},
-std::array<float,2>{0.971500993f, 0.0812417716f},
-std::array<float,2>{0.260541111f, 0.705749273f},
-std::array<float,2>{0.16370365f, 0.409985095f},
-std::array<float,2>{0.672073126f, 0.891357183f},
-std::array<float,2>{0.616391063f, 0.337486535f},
-std::array<float,2>{0.0607441999f, 0.857408166f},
-std::array<float,2>{0.48010695f, 0.154272437f},
-std::array<float,2>{0.765927017f, 0.613653958f},
-std::array<float,2>{0.838686109f, 0.296391696f},
-std::array<float,2>{0.424276263f, 0.802803814f},
-std::array<float,2>{0.0955134705f, 0.247919992f},
-std::array<float,2>{0.522650659f, 0.555621505f},
-std::array<float,2>{0.749403358f, 0.0579219982f},
-std::array<float,2>{0.224593252f, 0.68042767f},
-std::array<float,2>{0.337166131f, 0.487188935f},
-std::array<float,2>{0.903148592f, 0.980843723f},
-std::array<float,2>{0.956944764f, 0.144335181f},
-std::array<float,2>{0.30424124f, 0.619805038f},
-std::array<float,2>{0.139436007f, 0.331140369f},
-std::array<float,2>{0.641433179f, 0.848483264f},
-std::array<float,2>{0.570284963f, 0.414203793f},
-std::array<float,2>{0.0231087282f, 0.903252959f},
-std::array<float,2>{0.444115698f, 0.0887769833f},
-std::array<float,2>{0.802574396f, 0.717334807f},
-std::array<float,2>{0.906927228f, 0.445838332f},
-std::array<float,2>{0.346567482f, 0.949040234f},
-std::array<float,2>{0.204725161f, 0.00863662548f},
-std::array<float,2>{0.695916831f, 0.645729482f},
-std::array<float,2>{0.545885503f, 0.21324569f},
-std::array<float,2>{0.075863421f, 0.524850726f},
-std::array<float,2>{0.389967948f, 0.257589817f},
-std::array<float,2>{0.851267934f, 0.760634303f},
-std::array<float,2>{0.777231812f, 0.114921123f},
-std::array<float,2>{0.470676601f, 0.742427945f},
-std::array<float,2>{0.0510539263f, 0.381621182f},
-std::array<float,2>{0.622721374f, 0.922038555f},
-std::array<float,2>{0.687485516f, 0.354361385f},
-std::array<float,2>{0.169615731f, 0.816244721f},
-std::array<float,2>{0.250458091f, 0.178036958f},
-std::array<float,2>{0.97852999f, 0.567736089f},
-std::array<float,2>{0.999185503f, 0.317930281f},
-std::array<float,2>{0.279888958f, 0.870649338f},
-std::array<float,2>{0.181561545f, 0.132745251f},
-std::array<float,2>{0.668761015f, 0.600400209f},
-std::array<float,2>{0.595716655f, 0.0690299869f},
-std::array<float,2>{0.0395156927f, 0.694137275f},
-std::array<float,2>{0.494774848f, 0.437245458f},
-std::array<float,2>{0.763020754f, 0.879855335f},
-std::array<float,2>{0.873091221f, 0.22610499f},
-std::array<float,2>{0.395139337f, 0.544254303f},
-std::array<float,2>{0.0831533f, 0.300952882f},
-std::array<float,2>{0.552852213f, 0.789889455f},
-std::array<float,2>{0.706838727f, 0.470831186f},
-std::array<float,2>{0.202095062f, 0.985473394f},
-std::array<float,2>{0.364515513f, 0.0432834104f},
-std::array<float,2>{0.932649255f, 0.664981127f},
-std::array<float,2>{0.794681132f, 0.396392375f},
-std::array<float,2>{0.460329145f, 0.920810699f},
-std::array<float,2>{0.00759056816f, 0.0970198587f},
-std::array<float,2>{0.582934976f, 0.725445569f},
-std::array<float,2>{0.636535048f, 0.166786388f},
-std::array<float,2>{0.149253085f, 0.580015659f},
-std::array<float,2>{0.283635229f, 0.372314453f},
-std::array<float,2>{0.94341749f, 0.843250513f},
-std::array<float,2>{0.878830612f, 0.0307761766f},
-std::array<float,2>{0.321396172f, 0.639055371f},
-std::array<float,2>{0.24778378f, 0.468682677f},
-std::array<float,2>{0.722464085f, 0.964636564f},
-std::array<float,2>{0.50729692f, 0.27222079f},
-std::array<float,2>{0.114067391f, 0.769547284f},
-std::array<float,2>{0.413932711f, 0.18904227f},
-std::array<float,2>{0.827909529f, 0.509355843f},
-std::array<float,2>{0.863304675f, 0.33279413f},
-std::array<float,2>{0.398718983f, 0.847271979f},
-std::array<float,2>{0.0862755775f, 0.146508396f},
-std::array<float,2>{0.55993402f, 0.62145865f},
-std::array<float,2>{0.714010835f, 0.0908343047f},
-std::array<float,2>{0.19166103f, 0.713604689f},
-std::array<float,2>{0.373319268f, 0.419204384f},
-std::array<float,2>{0.926122129f, 0.900282025f},
-std::array<float,2>{0.98698926f, 0.243712887f},
-std::array<float,2>{0.271500885f, 0.560784459f},
-std::array<float,2>{0.172274292f, 0.290322453f},
-std::array<float,2>{0.656329155f, 0.797776341f},
-std::array<float,2>{0.60636276f, 0.488375187f},
-std::array<float,2>{0.032811489f, 0.980383694f},
-std::array<float,2>{0.490408033f, 0.0619630925f},
-std::array<float,2>{0.756600797f, 0.684999168f},
-std::array<float,2>{0.886992812f, 0.37546286f},
-std::array<float,2>{0.318093032f, 0.926909745f},
-std::array<float,2>{0.234932452f, 0.110805951f},
-std::array<float,2>{0.733679056f, 0.74764657f},
-std::array<float,2>{0.513019741f, 0.175491855f},
-std::array<float,2>{0.121115193f, 0.56594342f},
-std::array<float,2>{0.420742363f, 0.357909501f},
-std::array<float,2>{0.813354373f, 0.819530249f},
-std::array<float,2>{0.786906719f, 0.0120905079f},
-std::array<float,2>{0.466825426f, 0.643903613f},
-std::array<float,2>{0.0130774993f, 0.451704174f},
-std::array<float,2>{0.586369634f, 0.952083409f},
-std::array<float,2>{0.629931331f, 0.250567317f},
-std::array<float,2>{0.142708644f, 0.763225973f},
-std::array<float,2>{0.295684367f, 0.215504199f},
-std::array<float,2>{0.947921932f, 0.527518094f},
-std::array<float,2>{0.964264691f, 0.300460309f},
-std::array<float,2>{0.306882769f, 0.79622829f},
-std::array<float,2>{0.127365544f, 0.2219152f},
-std::array<float,2>{0.6504879f, 0.542769134f},
-std::array<float,2>{0.575106502f, 0.0415383875f},
-std::array<float,2>{0.0297246892f, 0.671813965f},
-std::array<float,2>{0.448967397f, 0.473608375f},
-std::array<float,2>{0.809557855f, 0.991341114f},
-std::array<float,2>{0.831401289f, 0.126540676f},
-std::array<float,2>{0.435291111f, 0.595491171f},
-std::array<float,2>{0.101801172f, 0.315102518f},
-std::array<float,2>{0.528051138f, 0.873319924f},
-std::array<float,2>{0.738844633f, 0.432119817f},
-std::array<float,2>{0.227821857f, 0.875789762f},
-std::array<float,2>{0.333933502f, 0.06253694f},
-std::array<float,2>{0.89113462f, 0.688160956f},
-std::array<float,2>{0.770155191f, 0.464606583f},
-std::array<float,2>{0.48392269f, 0.965564609f},
-std::array<float,2>{0.0555707403f, 0.0240460522f},
-std::array<float,2>{0.612199008f, 0.633482873f},
-std::array<float,2>{0.676798642f, 0.192762539f},
-std::array<float,2>{0.158544526f, 0.514665544f},
-std::array<float,2>{0.264991403f, 0.267007887f},
-std::array<float,2>{0.974952936f, 0.768280804f},
-std::array<float,2>{0.915625155f, 0.100463681f},
-std::array<float,2>{0.356655002f, 0.720164478f},
-std::array<float,2>{0.212004721f, 0.392476529f},
-std::array<float,2>{0.688013017f, 0.91755867f},
-std::array<float,2>{0.534719408f, 0.37086311f},
-std::array<float,2>{0.0691816211f, 0.838723421f},
-std::array<float,2>{0.376434296f, 0.169479549f},
-std::array<float,2>{0.857190788f, 0.58311379f},
-std::array<float,2>{0.796932638f, 0.281112164f},
-std::array<float,2>{0.438406706f, 0.780188799f},
-std::array<float,2>{0.0182056464f, 0.197378576f},
-std::array<float,2>{0.564149857f, 0.507428288f},
-std::array<float,2>{0.646247566f, 0.0195669457f},
-std::array<float,2>{0.133031309f, 0.631222486f},
-std::array<float,2>{0.297849476f, 0.457460105f},
-std::array<float,2>{0.957391739f, 0.956188083f},
-std::array<float,2>{0.901565075f, 0.162686855f},
-std::array<float,2>{0.339910835f, 0.591038108f},
-std::array<float,2>{0.22091651f, 0.364546806f},
-std::array<float,2>{0.745000958f, 0.828346074f},
-std::array<float,2>{0.515841007f, 0.400109947f},
-std::array<float,2>{0.100352272f, 0.909689605f},
-std::array<float,2>{0.428957164f, 0.103754453f},
-std::array<float,2>{0.841193557f, 0.727254212f},
-std::array<float,2>{0.982709706f, 0.477157414f},
-std::array<float,2>{0.256780267f, 0.992620587f},
-std::array<float,2>{0.164575368f, 0.0369692519f},
-std::array<float,2>{0.683363557f, 0.659275174f},
-std::array<float,2>{0.619326234f, 0.228778988f},
-std::array<float,2>{0.0477211811f, 0.538692117f},
-std::array<float,2>{0.474583238f, 0.309385538f},
-std::array<float,2>{0.780515432f, 0.783150434f},
-std::array<float,2>{0.844441056f, 0.0730888322f},
-std::array<float,2>{0.386580467f, 0.695837021f},
-std::array<float,2>{0.0733034015f, 0.424838096f},
-std::array<float,2>{0.542571604f, 0.886646032f},
-std::array<float,2>{0.700169027f, 0.325436831f},
-std::array<float,2>{0.210077897f, 0.860487282f},
-std::array<float,2>{0.350540608f, 0.133690462f},
-std::array<float,2>{0.913579106f, 0.606007397f},
-std::array<float,2>{0.934698164f, 0.351007342f},
-std::array<float,2>{0.361950994f, 0.825151622f},
-std::array<float,2>{0.19648461f, 0.182847679f},
-std::array<float,2>{0.707111597f, 0.577815831f},
-std::array<float,2>{0.549974382f, 0.124009527f},
-std::array<float,2>{0.0809041262f, 0.736896694f},
-std::array<float,2>{0.39269793f, 0.385496646f},
-std::array<float,2>{0.867200971f, 0.934565008f},
-std::array<float,2>{0.761174917f, 0.204104111f},
-std::array<float,2>{0.499027878f, 0.523062885f},
-std::array<float,2>{0.0430727638f, 0.264466435f},
-std::array<float,2>{0.598035157f, 0.756525874f},
-std::array<float,2>{0.665681422f, 0.439843655f},
-std::array<float,2>{0.187487766f, 0.937525809f},
-std::array<float,2>{0.27351737f, 0.00154874497f},
-std::array<float,2>{0.99417752f, 0.650457859f},
-std::array<float,2>{0.821979046f, 0.412405789f},
-std::array<float,2>{0.406668276f, 0.896163642f},
-std::array<float,2>{0.109518625f, 0.085198909f},
-std::array<float,2>{0.502026558f, 0.707858503f},
-std::array<float,2>{0.723684847f, 0.15074876f},
-std::array<float,2>{0.245132059f, 0.609626472f},
-std::array<float,2>{0.325286746f, 0.341906667f},
-std::array<float,2>{0.87941128f, 0.853378057f},
-std::array<float,2>{0.939649165f, 0.0510275364f},
-std::array<float,2>{0.288512349f, 0.679170132f},
-std::array<float,2>{0.154101983f, 0.499082178f},
-std::array<float,2>{0.637112617f, 0.975173831f},
-std::array<float,2>{0.579455972f, 0.286570579f},
-std::array<float,2>{0.0030373435f, 0.809549034f},
-std::array<float,2>{0.457010895f, 0.239248618f},
-std::array<float,2>{0.789456666f, 0.549887776f},
-std::array<float,2>{0.784987271f, 0.321783662f},
-std::array<float,2>{0.46219629f, 0.864615202f},
-std::array<float,2>{0.0111264354f, 0.138550788f},
-std::array<float,2>{0.592918396f, 0.604994357f},
-std::array<float,2>{0.627200246f, 0.0759839565f},
-std::array<float,2>{0.148362905f, 0.700177848f},
-std::array<float,2>{0.291200936f, 0.42677322f},
-std::array<float,2>{0.950342178f, 0.890302777f},
-std::array<float,2>{0.885463476f, 0.234250128f},
-std::array<float,2>{0.31519708f, 0.534806907f},
-std::array<float,2>{0.240398422f, 0.30516699f},
-std::array<float,2>{0.728041232f, 0.787932813f},
-std::array<float,2>{0.508541048f, 0.48174724f},
-std::array<float,2>{0.117850453f, 0.996097863f},
-std::array<float,2>{0.415186703f, 0.0330358595f},
-std::array<float,2>{0.819692314f, 0.663134456f},
-std::array<float,2>{0.991765261f, 0.404855013f},
-std::array<float,2>{0.269161344f, 0.911163628f},
-std::array<float,2>{0.176676169f, 0.108314864f},
-std::array<float,2>{0.663270831f, 0.73320514f},
-std::array<float,2>{0.604505777f, 0.156288087f},
-std::array<float,2>{0.0370576754f, 0.587325513f},
-std::array<float,2>{0.485550642f, 0.360158354f},
-std::array<float,2>{0.753136396f, 0.833193481f},
-std::array<float,2>{0.861374557f, 0.0162071772f},
-std::array<float,2>{0.405794799f, 0.628848493f},
-std::array<float,2>{0.0936150253f, 0.456459343f},
-std::array<float,2>{0.555643916f, 0.960330188f},
-std::array<float,2>{0.715618968f, 0.274845034f},
-std::array<float,2>{0.191115245f, 0.773592353f},
-std::array<float,2>{0.367956936f, 0.201521486f},
-std::array<float,2>{0.925357103f, 0.502034009f},
-std::array<float,2>{0.919314444f, 0.282949299f},
-std::array<float,2>{0.353179544f, 0.805646122f},
-std::array<float,2>{0.215472221f, 0.237146109f},
-std::array<float,2>{0.69375366f, 0.553179681f},
-std::array<float,2>{0.538933396f, 0.0494052321f},
-std::array<float,2>{0.064069055f, 0.674954176f},
-std::array<float,2>{0.381307662f, 0.495265156f},
-std::array<float,2>{0.851815343f, 0.970627308f},
-std::array<float,2>{0.76924634f, 0.155612633f},
-std::array<float,2>{0.476861f, 0.616753161f},
-std::array<float,2>{0.059080299f, 0.338981003f},
-std::array<float,2>{0.614198744f, 0.859306931f},
-std::array<float,2>{0.675596952f, 0.408162922f},
-std::array<float,2>{0.161237031f, 0.893491864f},
-std::array<float,2>{0.259721905f, 0.0798389092f},
-std::array<float,2>{0.970613956f, 0.704194665f},
-std::array<float,2>{0.834688425f, 0.443351001f},
-std::array<float,2>{0.431767762f, 0.941599369f},
-std::array<float,2>{0.107294217f, 0.00778299989f},
-std::array<float,2>{0.524078667f, 0.65615046f},
-std::array<float,2>{0.738088429f, 0.209362149f},
-std::array<float,2>{0.233181685f, 0.515828371f},
-std::array<float,2>{0.330286086f, 0.261177838f},
-std::array<float,2>{0.897868514f, 0.752742648f},
-std::array<float,2>{0.967250943f, 0.117856435f},
-std::array<float,2>{0.3115578f, 0.740682483f},
-std::array<float,2>{0.132508397f, 0.388834804f},
-std::array<float,2>{0.653717995f, 0.932901144f},
-std::array<float,2>{0.573644876f, 0.344735384f},
-std::array<float,2>{0.0254353359f, 0.822917223f},
-std::array<float,2>{0.451472819f, 0.183631837f},
-std::array<float,2>{0.805237174f, 0.572988093f},
-std::array<float,2>{0.848713279f, 0.255798191f},
-std::array<float,2>{0.387998253f, 0.757915199f},
-std::array<float,2>{0.0773670152f, 0.212692097f},
-std::array<float,2>{0.543637693f, 0.526315212f},
-std::array<float,2>{0.698146105f, 0.010555598f},
-std::array<float,2>{0.205809712f, 0.647902429f},
-std::array<float,2>{0.345663875f, 0.448037893f},
-std::array<float,2>{0.908246815f, 0.947038233f},
-std::array<float,2>{0.977779448f, 0.176235005f},
-std::array<float,2>{0.253770053f, 0.56852901f},
-std::array<float,2>{0.17040126f, 0.352658778f},
-std::array<float,2>{0.685100675f, 0.813036799f},
-std::array<float,2>{0.623660386f, 0.37918672f},
-std::array<float,2>{0.0543777794f, 0.925567269f},
-std::array<float,2>{0.471867412f, 0.116151251f},
-std::array<float,2>{0.773720562f, 0.745976806f},
-std::array<float,2>{0.905478358f, 0.485983342f},
-std::array<float,2>{0.339093804f, 0.984344482f},
-std::array<float,2>{0.226245686f, 0.0549084432f},
-std::array<float,2>{0.746281624f, 0.682045102f},
-std::array<float,2>{0.521304965f, 0.249366507f},
-std::array<float,2>{0.0974570811f, 0.556743503f},
-std::array<float,2>{0.423482388f, 0.294419467f},
-std::array<float,2>{0.835977852f, 0.802440464f},
-std::array<float,2>{0.804370284f, 0.0864731595f},
-std::array<float,2>{0.442738295f, 0.715458333f},
-std::array<float,2>{0.0200862195f, 0.417813838f},
-std::array<float,2>{0.567483485f, 0.905015409f},
-std::array<float,2>{0.642668009f, 0.329458773f},
-std::array<float,2>{0.137242883f, 0.850673616f},
-std::array<float,2>{0.302343965f, 0.142411247f},
-std::array<float,2>{0.954605877f, 0.618556559f},
-std::array<float,2>{0.941491127f, 0.374751568f},
-std::array<float,2>{0.282950252f, 0.840993941f},
-std::array<float,2>{0.150421754f, 0.165038943f},
-std::array<float,2>{0.633239627f, 0.581678271f},
-std::array<float,2>{0.585478723f, 0.0954589769f},
-std::array<float,2>{0.0054922658f, 0.723964751f},
-std::array<float,2>{0.457224667f, 0.398003608f},
-std::array<float,2>{0.796546936f, 0.918255568f},
-std::array<float,2>{0.825270832f, 0.189491123f},
-std::array<float,2>{0.411648721f, 0.511383891f},
-std::array<float,2>{0.115913175f, 0.270226479f},
-std::array<float,2>{0.505665362f, 0.773302913f},
-std::array<float,2>{0.720154107f, 0.465535551f},
-std::array<float,2>{0.249755219f, 0.962680876f},
-std::array<float,2>{0.3240228f, 0.0283915475f},
-std::array<float,2>{0.876923382f, 0.638018966f},
-std::array<float,2>{0.76562351f, 0.434150845f},
-std::array<float,2>{0.494042903f, 0.881085932f},
-std::array<float,2>{0.0417553261f, 0.0677735433f},
-std::array<float,2>{0.595347404f, 0.692004561f},
-std::array<float,2>{0.669927478f, 0.129036501f},
-std::array<float,2>{0.182058424f, 0.59799844f},
-std::array<float,2>{0.277845472f, 0.319288671f},
-std::array<float,2>{0.997494042f, 0.867275596f},
-std::array<float,2>{0.930941522f, 0.0458018929f},
-std::array<float,2>{0.366449535f, 0.666557074f},
-std::array<float,2>{0.200486392f, 0.469277352f},
-std::array<float,2>{0.703324795f, 0.986519277f},
-std::array<float,2>{0.552252114f, 0.304420978f},
-std::array<float,2>{0.0840480998f, 0.792127132f},
-std::array<float,2>{0.398419142f, 0.22402072f},
-std::array<float,2>{0.872521281f, 0.546759009f},
-std::array<float,2>{0.815875709f, 0.356834024f},
-std::array<float,2>{0.418283492f, 0.817463338f},
-std::array<float,2>{0.124535866f, 0.173550084f},
-std::array<float,2>{0.515218258f, 0.564344943f},
-std::array<float,2>{0.731084168f, 0.113006629f},
-std::array<float,2>{0.237295136f, 0.749163747f},
-std::array<float,2>{0.320118487f, 0.37851879f},
-std::array<float,2>{0.88922745f, 0.927813232f},
-std::array<float,2>{0.94626224f, 0.218221247f},
-std::array<float,2>{0.293825865f, 0.530513465f},
-std::array<float,2>{0.14163655f, 0.252106845f},
-std::array<float,2>{0.632190526f, 0.76499939f},
-std::array<float,2>{0.588497043f, 0.451075882f},
-std::array<float,2>{0.0153711094f, 0.949576735f},
-std::array<float,2>{0.466170162f, 0.0144478986f},
-std::array<float,2>{0.788222015f, 0.641447067f},
-std::array<float,2>{0.929147959f, 0.421501964f},
-std::array<float,2>{0.372317493f, 0.900847077f},
-std::array<float,2>{0.194949254f, 0.0919996202f},
-std::array<float,2>{0.711087108f, 0.71130538f},
-std::array<float,2>{0.560948431f, 0.145234883f},
-std::array<float,2>{0.0888894573f, 0.624295294f},
-std::array<float,2>{0.401278228f, 0.33430177f},
-std::array<float,2>{0.865727603f, 0.844183326f},
-std::array<float,2>{0.754400909f, 0.0589704774f},
-std::array<float,2>{0.489802867f, 0.687085032f},
-std::array<float,2>{0.0340869874f, 0.491961241f},
-std::array<float,2>{0.608205855f, 0.977743685f},
-std::array<float,2>{0.659672141f, 0.291524142f},
-std::array<float,2>{0.174708977f, 0.798838794f},
-std::array<float,2>{0.269729525f, 0.245806053f},
-std::array<float,2>{0.985924363f, 0.559874535f},
-std::array<float,2>{0.972657919f, 0.26816386f},
-std::array<float,2>{0.261967868f, 0.767494082f},
-std::array<float,2>{0.157714054f, 0.193849578f},
-std::array<float,2>{0.678484559f, 0.513282359f},
-std::array<float,2>{0.610690653f, 0.0269975718f},
-std::array<float,2>{0.0583208501f, 0.634806156f},
-std::array<float,2>{0.482153475f, 0.461295038f},
-std::array<float,2>{0.772328317f, 0.967279673f},
-std::array<float,2>{0.859197855f, 0.170415059f},
-std::array<float,2>{0.378699005f, 0.584993005f},
-std::array<float,2>{0.0674545765f, 0.367604494f},
-std::array<float,2>{0.53213346f, 0.83772105f},
-std::array<float,2>{0.690485954f, 0.392689556f},
-std::array<float,2>{0.214747459f, 0.915002882f},
-std::array<float,2>{0.359365702f, 0.0993357897f},
-std::array<float,2>{0.917384088f, 0.721191585f},
-std::array<float,2>{0.811265111f, 0.475114405f},
-std::array<float,2>{0.44716537f, 0.989863217f},
-std::array<float,2>{0.0289636161f, 0.0410043485f},
-std::array<float,2>{0.576246262f, 0.668870807f},
-std::array<float,2>{0.650219738f, 0.219315305f},
-std::array<float,2>{0.125677541f, 0.539438784f},
-std::array<float,2>{0.305729926f, 0.298476964f},
-std::array<float,2>{0.962672472f, 0.793787897f},
-std::array<float,2>{0.893759549f, 0.066349566f},
-std::array<float,2>{0.33587864f, 0.690352201f},
-std::array<float,2>{0.229667187f, 0.430433393f},
-std::array<float,2>{0.741201639f, 0.877057791f},
-std::array<float,2>{0.530325055f, 0.31281212f},
-std::array<float,2>{0.105025411f, 0.87135458f},
-std::array<float,2>{0.435663283f, 0.127400756f},
-std::array<float,2>{0.829301f, 0.596535146f},
-std::array<float,2>{0.77870518f, 0.31184265f},
-std::array<float,2>{0.475463092f, 0.783559263f},
-std::array<float,2>{0.0495868698f, 0.226768285f},
-std::array<float,2>{0.617811978f, 0.537021458f},
-std::array<float,2>{0.679861128f, 0.0374005437f},
-std::array<float,2>{0.166778147f, 0.658167958f},
-std::array<float,2>{0.255005628f, 0.479013562f},
-std::array<float,2>{0.981978416f, 0.994251668f},
-std::array<float,2>{0.911256194f, 0.135317937f},
-std::array<float,2>{0.348552972f, 0.608307421f},
-std::array<float,2>{0.207615137f, 0.326661438f},
-std::array<float,2>{0.702481329f, 0.861432672f},
-std::array<float,2>{0.539274335f, 0.423693776f},
-std::array<float,2>{0.0718358606f, 0.88408488f},
-std::array<float,2>{0.383283645f, 0.0719136149f},
-std::array<float,2>{0.846178472f, 0.69793731f},
-std::array<float,2>{0.960887194f, 0.460732102f},
-std::array<float,2>{0.300087899f, 0.954780459f},
-std::array<float,2>{0.136211887f, 0.0221708044f},
-std::array<float,2>{0.647868156f, 0.630534589f},
-std::array<float,2>{0.565208256f, 0.196131229f},
-std::array<float,2>{0.0171251856f, 0.505314112f},
-std::array<float,2>{0.439885587f, 0.277778655f},
-std::array<float,2>{0.800591767f, 0.778943956f},
-std::array<float,2>{0.84308964f, 0.102503523f},
-std::array<float,2>{0.427574426f, 0.728657663f},
-std::array<float,2>{0.0992611721f, 0.401695698f},
-std::array<float,2>{0.518513322f, 0.90658778f},
-std::array<float,2>{0.742661059f, 0.365531474f},
-std::array<float,2>{0.219025418f, 0.831624031f},
-std::array<float,2>{0.342589885f, 0.160190806f},
-std::array<float,2>{0.899432421f, 0.592389226f},
-std::array<float,2>{0.881727517f, 0.340871066f},
-std::array<float,2>{0.328059524f, 0.854050994f},
-std::array<float,2>{0.243908525f, 0.150105536f},
-std::array<float,2>{0.7265293f, 0.61272943f},
-std::array<float,2>{0.501519918f, 0.0822775885f},
-std::array<float,2>{0.112439044f, 0.709079683f},
-std::array<float,2>{0.408378661f, 0.410820872f},
-std::array<float,2>{0.822456658f, 0.897267699f},
-std::array<float,2>{0.791117072f, 0.240986511f},
-std::array<float,2>{0.454275727f, 0.547558069f},
-std::array<float,2>{0.00169179216f, 0.28771013f},
-std::array<float,2>{0.581214666f, 0.812167168f},
-std::array<float,2>{0.639049292f, 0.49745506f},
-std::array<float,2>{0.154763058f, 0.974385083f},
-std::array<float,2>{0.286334246f, 0.0544475503f},
-std::array<float,2>{0.937902093f, 0.675857008f},
-std::array<float,2>{0.86924541f, 0.383367926f},
-std::array<float,2>{0.390713662f, 0.935751021f},
-std::array<float,2>{0.0800320879f, 0.121189944f},
-std::array<float,2>{0.547335982f, 0.736168087f},
-std::array<float,2>{0.710166454f, 0.180847183f},
-std::array<float,2>{0.197584957f, 0.575759053f},
-std::array<float,2>{0.360380858f, 0.348150611f},
-std::array<float,2>{0.936247289f, 0.826319098f},
-std::array<float,2>{0.993627965f, 0.00250869733f},
-std::array<float,2>{0.277317077f, 0.649852633f},
-std::array<float,2>{0.183874533f, 0.438025743f},
-std::array<float,2>{0.666043401f, 0.94081074f},
-std::array<float,2>{0.599847376f, 0.263058335f},
-std::array<float,2>{0.0453420654f, 0.755262196f},
-std::array<float,2>{0.496107668f, 0.206287682f},
-std::array<float,2>{0.758813202f, 0.520041049f},
-std::array<float,2>{0.767537475f, 0.338847429f},
-std::array<float,2>{0.478926748f, 0.857960284f},
-std::array<float,2>{0.0618980154f, 0.154928282f},
-std::array<float,2>{0.615756929f, 0.615836501f},
-std::array<float,2>{0.673164666f, 0.0781298056f},
-std::array<float,2>{0.162941441f, 0.703441799f},
-std::array<float,2>{0.261685103f, 0.406752139f},
-std::array<float,2>{0.972615957f, 0.893632174f},
-std::array<float,2>{0.921811223f, 0.237471864f},
-std::array<float,2>{0.354796737f, 0.554036677f},
-std::array<float,2>{0.217099681f, 0.281597406f},
-std::array<float,2>{0.693327367f, 0.805687547f},
-std::array<float,2>{0.535894811f, 0.494770348f},
-std::array<float,2>{0.0646878779f, 0.969498456f},
-std::array<float,2>{0.380084932f, 0.0507204682f},
-std::array<float,2>{0.853694677f, 0.674785197f},
-std::array<float,2>{0.966415167f, 0.390553117f},
-std::array<float,2>{0.308800697f, 0.931863606f},
-std::array<float,2>{0.130071014f, 0.118946008f},
-std::array<float,2>{0.655842423f, 0.741387367f},
-std::array<float,2>{0.572221279f, 0.184767842f},
-std::array<float,2>{0.0238213334f, 0.573703408f},
-std::array<float,2>{0.449301988f, 0.344415396f},
-std::array<float,2>{0.806985736f, 0.824010611f},
-std::array<float,2>{0.832866788f, 0.00635002414f},
-std::array<float,2>{0.430939287f, 0.655108392f},
-std::array<float,2>{0.107454792f, 0.442111075f},
-std::array<float,2>{0.525398791f, 0.942410529f},
-std::array<float,2>{0.735251367f, 0.259950012f},
-std::array<float,2>{0.231683776f, 0.752938688f},
-std::array<float,2>{0.329188079f, 0.210350052f},
-std::array<float,2>{0.896174014f, 0.517391384f},
-std::array<float,2>{0.884139121f, 0.306559801f},
-std::array<float,2>{0.313756108f, 0.78824234f},
-std::array<float,2>{0.240199372f, 0.232511938f},
-std::array<float,2>{0.729314744f, 0.533870101f},
-std::array<float,2>{0.511075735f, 0.0315867774f},
-std::array<float,2>{0.120247826f, 0.662132382f},
-std::array<float,2>{0.417043924f, 0.480511755f},
-std::array<float,2>{0.816421449f, 0.997754633f},
-std::array<float,2>{0.782403231f, 0.136749521f},
-std::array<float,2>{0.464559466f, 0.604265988f},
-std::array<float,2>{0.00866521802f, 0.320375562f},
-std::array<float,2>{0.59111625f, 0.863896012f},
-std::array<float,2>{0.625322342f, 0.42579481f},
-std::array<float,2>{0.145535871f, 0.889379919f},
-std::array<float,2>{0.289788395f, 0.0750865042f},
-std::array<float,2>{0.951964498f, 0.700351715f},
-std::array<float,2>{0.860580206f, 0.455529034f},
-std::array<float,2>{0.402420402f, 0.959615052f},
-std::array<float,2>{0.0914556161f, 0.016672954f},
-std::array<float,2>{0.557147443f, 0.627887309f},
-std::array<float,2>{0.718619466f, 0.202765688f},
-std::array<float,2>{0.188393563f, 0.503767848f},
-std::array<float,2>{0.370099813f, 0.273690283f},
-std::array<float,2>{0.923236787f, 0.775283158f},
-std::array<float,2>{0.989148378f, 0.10855604f},
-std::array<float,2>{0.266067117f, 0.733685255f},
-std::array<float,2>{0.179245666f, 0.405691713f},
-std::array<float,2>{0.661870599f, 0.910970032f},
-std::array<float,2>{0.603193939f, 0.360760689f},
-std::array<float,2>{0.0376827121f, 0.832307756f},
-std::array<float,2>{0.487201512f, 0.158117712f},
-std::array<float,2>{0.751336634f, 0.586068571f},
-std::array<float,2>{0.826883316f, 0.27122286f},
-std::array<float,2>{0.412939161f, 0.771945059f},
-std::array<float,2>{0.114400744f, 0.190824136f},
-std::array<float,2>{0.506059945f, 0.510232925f},
-std::array<float,2>{0.72100842f, 0.0275359806f},
-std::array<float,2>{0.24690786f, 0.63673842f},
-std::array<float,2>{0.320527583f, 0.465989649f},
-std::array<float,2>{0.877476692f, 0.96187979f},
-std::array<float,2>{0.94509232f, 0.165137365f},
-std::array<float,2>{0.284666538f, 0.580974877f},
-std::array<float,2>{0.149883956f, 0.373833239f},
-std::array<float,2>{0.635613739f, 0.840649068f},
-std::array<float,2>{0.583109438f, 0.396681517f},
-std::array<float,2>{0.0062028151f, 0.919850707f},
-std::array<float,2>{0.459487438f, 0.094405584f},
-std::array<float,2>{0.793581724f, 0.72269696f},
-std::array<float,2>{0.932286859f, 0.470343024f},
-std::array<float,2>{0.363502711f, 0.987420022f},
-std::array<float,2>{0.202164009f, 0.0460815281f},
-std::array<float,2>{0.705923855f, 0.667309523f},
-std::array<float,2>{0.554147065f, 0.223386452f},
-std::array<float,2>{0.082884714f, 0.545539379f},
-std::array<float,2>{0.396391392f, 0.303490847f},
-std::array<float,2>{0.874667048f, 0.791184783f},
-std::array<float,2>{0.761948764f, 0.0668761507f},
-std::array<float,2>{0.495882034f, 0.692509353f},
-std::array<float,2>{0.0403602645f, 0.435421169f},
-std::array<float,2>{0.597111464f, 0.882680833f},
-std::array<float,2>{0.669303775f, 0.31943047f},
-std::array<float,2>{0.180370584f, 0.868467212f},
-std::array<float,2>{0.280667216f, 0.130021468f},
-std::array<float,2>{0.998719633f, 0.598937809f},
-std::array<float,2>{0.979535639f, 0.352160662f},
-std::array<float,2>{0.251048565f, 0.814311087f},
-std::array<float,2>{0.168048441f, 0.177542701f},
-std::array<float,2>{0.685669184f, 0.569821954f},
-std::array<float,2>{0.62199986f, 0.11691542f},
-std::array<float,2>{0.0525874197f, 0.744237661f},
-std::array<float,2>{0.469019651f, 0.379937142f},
-std::array<float,2>{0.775505126f, 0.924019933f},
-std::array<float,2>{0.850186229f, 0.211565748f},
-std::array<float,2>{0.388707966f, 0.526591003f},
-std::array<float,2>{0.0744226202f, 0.253983378f},
-std::array<float,2>{0.546067894f, 0.75919795f},
-std::array<float,2>{0.696802378f, 0.448888361f},
-std::array<float,2>{0.20407179f, 0.945774257f},
-std::array<float,2>{0.346840858f, 0.0108585013f},
-std::array<float,2>{0.907924652f, 0.646683753f},
-std::array<float,2>{0.80088383f, 0.416374803f},
-std::array<float,2>{0.444528401f, 0.905780852f},
-std::array<float,2>{0.0216704216f, 0.0875400379f},
-std::array<float,2>{0.568953991f, 0.716041923f},
-std::array<float,2>{0.642210543f, 0.141047329f},
-std::array<float,2>{0.140474334f, 0.61785996f},
-std::array<float,2>{0.303355306f, 0.328514367f},
-std::array<float,2>{0.955644071f, 0.849983275f},
-std::array<float,2>{0.903633714f, 0.0563710444f},
-std::array<float,2>{0.336506367f, 0.683452547f},
-std::array<float,2>{0.223507822f, 0.48495248f},
-std::array<float,2>{0.748369813f, 0.983014345f},
-std::array<float,2>{0.522027194f, 0.293264836f},
-std::array<float,2>{0.094695814f, 0.800804615f},
-std::array<float,2>{0.425154656f, 0.248676509f},
-std::array<float,2>{0.839140296f, 0.558021486f},
-std::array<float,2>{0.855682373f, 0.369060665f},
-std::array<float,2>{0.375906706f, 0.836315989f},
-std::array<float,2>{0.069648318f, 0.171774805f},
-std::array<float,2>{0.533322573f, 0.584297597f},
-std::array<float,2>{0.689239442f, 0.0979194939f},
-std::array<float,2>{0.211372763f, 0.722442448f},
-std::array<float,2>{0.355754405f, 0.393933207f},
-std::array<float,2>{0.914730549f, 0.915784776f},
-std::array<float,2>{0.976254642f, 0.194709584f},
-std::array<float,2>{0.264443874f, 0.512016952f},
-std::array<float,2>{0.160152569f, 0.269479483f},
-std::array<float,2>{0.676081121f, 0.766145468f},
-std::array<float,2>{0.612899184f, 0.462826461f},
-std::array<float,2>{0.0560349524f, 0.968228817f},
-std::array<float,2>{0.482833445f, 0.026011372f},
-std::array<float,2>{0.771468163f, 0.636630535f},
-std::array<float,2>{0.89179337f, 0.430948079f},
-std::array<float,2>{0.332274944f, 0.878102481f},
-std::array<float,2>{0.227094635f, 0.0653242692f},
-std::array<float,2>{0.739516258f, 0.691300511f},
-std::array<float,2>{0.52879709f, 0.128701702f},
-std::array<float,2>{0.102573723f, 0.597199917f},
-std::array<float,2>{0.433611691f, 0.31352362f},
-std::array<float,2>{0.831045747f, 0.872561216f},
-std::array<float,2>{0.810213327f, 0.0397763513f},
-std::array<float,2>{0.447399586f, 0.669806182f},
-std::array<float,2>{0.0307227299f, 0.475623369f},
-std::array<float,2>{0.57539171f, 0.989058971f},
-std::array<float,2>{0.651690245f, 0.297343343f},
-std::array<float,2>{0.128257722f, 0.793997765f},
-std::array<float,2>{0.308300197f, 0.22064501f},
-std::array<float,2>{0.963075399f, 0.540679991f},
-std::array<float,2>{0.948571503f, 0.253398538f},
-std::array<float,2>{0.295992285f, 0.764648438f},
-std::array<float,2>{0.144058779f, 0.21746859f},
-std::array<float,2>{0.629729152f, 0.529365182f},
-std::array<float,2>{0.587437212f, 0.0150944851f},
-std::array<float,2>{0.0117499372f, 0.642058849f},
-std::array<float,2>{0.468737572f, 0.450131238f},
-std::array<float,2>{0.785611212f, 0.95067966f},
-std::array<float,2>{0.813624144f, 0.1719255f},
-std::array<float,2>{0.421709806f, 0.563187242f},
-std::array<float,2>{0.122985639f, 0.355595559f},
-std::array<float,2>{0.512090325f, 0.816805363f},
-std::array<float,2>{0.733140528f, 0.37767455f},
-std::array<float,2>{0.236168966f, 0.928791046f},
-std::array<float,2>{0.316597849f, 0.111889489f},
-std::array<float,2>{0.888189554f, 0.748933673f},
-std::array<float,2>{0.757497013f, 0.490498424f},
-std::array<float,2>{0.491940886f, 0.976688504f},
-std::array<float,2>{0.0321154334f, 0.0596164167f},
-std::array<float,2>{0.606929302f, 0.686297536f},
-std::array<float,2>{0.658103883f, 0.244310305f},
-std::array<float,2>{0.172905341f, 0.558642924f},
-std::array<float,2>{0.273397505f, 0.292846739f},
-std::array<float,2>{0.987335443f, 0.800257444f},
-std::array<float,2>{0.927063763f, 0.0929998606f},
-std::array<float,2>{0.374158382f, 0.712535679f},
-std::array<float,2>{0.192927241f, 0.420660615f},
-std::array<float,2>{0.713619947f, 0.902315974f},
-std::array<float,2>{0.559221208f, 0.335672289f},
-std::array<float,2>{0.0875510573f, 0.845519245f},
-std::array<float,2>{0.400152385f, 0.145884886f},
-std::array<float,2>{0.865048289f, 0.623378813f},
-std::array<float,2>{0.790278316f, 0.288805783f},
-std::array<float,2>{0.45554769f, 0.811085761f},
-std::array<float,2>{0.00221191463f, 0.242095053f},
-std::array<float,2>{0.578506887f, 0.548111081f},
-std::array<float,2>{0.638386667f, 0.0536283143f},
-std::array<float,2>{0.153096423f, 0.677183449f},
-std::array<float,2>{0.288061947f, 0.496627092f},
-std::array<float,2>{0.940938473f, 0.973622561f},
-std::array<float,2>{0.880778372f, 0.149170056f},
-std::array<float,2>{0.325192004f, 0.611724913f},
-std::array<float,2>{0.244758859f, 0.340387762f},
-std::array<float,2>{0.723181844f, 0.85510534f},
-std::array<float,2>{0.50293982f, 0.411646158f},
-std::array<float,2>{0.111224271f, 0.897733867f},
-std::array<float,2>{0.407858372f, 0.0833820701f},
-std::array<float,2>{0.820471883f, 0.710365415f},
-std::array<float,2>{0.995284796f, 0.43871665f},
-std::array<float,2>{0.274466783f, 0.940148652f},
-std::array<float,2>{0.186271012f, 0.00353338756f},
-std::array<float,2>{0.664577186f, 0.649140537f},
-std::array<float,2>{0.599417865f, 0.205950975f},
-std::array<float,2>{0.0445088446f, 0.520551682f},
-std::array<float,2>{0.498047978f, 0.261742473f},
-std::array<float,2>{0.75995326f, 0.754816771f},
-std::array<float,2>{0.868866086f, 0.122508995f},
-std::array<float,2>{0.39417398f, 0.734796882f},
-std::array<float,2>{0.0819823369f, 0.384758234f},
-std::array<float,2>{0.549387634f, 0.937002182f},
-std::array<float,2>{0.708760619f, 0.348861992f},
-std::array<float,2>{0.195481673f, 0.827870727f},
-std::array<float,2>{0.362477213f, 0.180546135f},
-std::array<float,2>{0.933733582f, 0.574662745f},
-std::array<float,2>{0.912712872f, 0.327966392f},
-std::array<float,2>{0.351555049f, 0.863196671f},
-std::array<float,2>{0.209589094f, 0.136523753f},
-std::array<float,2>{0.700280488f, 0.609259129f},
-std::array<float,2>{0.541836321f, 0.070413433f},
-std::array<float,2>{0.0731685981f, 0.698973715f},
-std::array<float,2>{0.385226727f, 0.422702998f},
-std::array<float,2>{0.844751477f, 0.882834077f},
-std::array<float,2>{0.779684007f, 0.227792054f},
-std::array<float,2>{0.47334674f, 0.535948753f},
-std::array<float,2>{0.0487478301f, 0.311327726f},
-std::array<float,2>{0.620241046f, 0.784489632f},
-std::array<float,2>{0.68196857f, 0.48007825f},
-std::array<float,2>{0.165287971f, 0.995793223f},
-std::array<float,2>{0.25772053f, 0.0382878669f},
-std::array<float,2>{0.984226525f, 0.656867683f},
-std::array<float,2>{0.840554893f, 0.401231617f},
-std::array<float,2>{0.428687364f, 0.907821059f},
-std::array<float,2>{0.101142414f, 0.102979191f},
-std::array<float,2>{0.516923249f, 0.729704499f},
-std::array<float,2>{0.745258093f, 0.161746174f},
-std::array<float,2>{0.222284064f, 0.593339324f},
-std::array<float,2>{0.341685742f, 0.366572738f},
-std::array<float,2>{0.90112555f, 0.831028998f},
-std::array<float,2>{0.958671689f, 0.0225227438f},
-std::array<float,2>{0.298105687f, 0.629870594f},
-std::array<float,2>{0.134760156f, 0.459084511f},
-std::array<float,2>{0.645274997f, 0.954022288f},
-std::array<float,2>{0.562760949f, 0.278955996f},
-std::array<float,2>{0.0186019801f, 0.778167963f},
-std::array<float,2>{0.439298481f, 0.196347162f},
-std::array<float,2>{0.798336923f, 0.504153788f},
-std::array<float,2>{0.805759609f, 0.34602198f},
-std::array<float,2>{0.452372074f, 0.820777714f},
-std::array<float,2>{0.0267541781f, 0.186368003f},
-std::array<float,2>{0.572357774f, 0.570431232f},
-std::array<float,2>{0.652482688f, 0.120461121f},
-std::array<float,2>{0.131678298f, 0.738542497f},
-std::array<float,2>{0.310660839f, 0.387453347f},
-std::array<float,2>{0.968332589f, 0.930506766f},
-std::array<float,2>{0.896567583f, 0.207939178f},
-std::array<float,2>{0.331401736f, 0.51763165f},
-std::array<float,2>{0.233566254f, 0.259136647f},
-std::array<float,2>{0.737029493f, 0.75023973f},
-std::array<float,2>{0.524661422f, 0.444985777f},
-std::array<float,2>{0.106233776f, 0.944178641f},
-std::array<float,2>{0.433231533f, 0.00451376196f},
-std::array<float,2>{0.835841715f, 0.652659297f},
-std::array<float,2>{0.969150305f, 0.408597797f},
-std::array<float,2>{0.257852405f, 0.891677141f},
-std::array<float,2>{0.160732493f, 0.0810276717f},
-std::array<float,2>{0.674423277f, 0.706616044f},
-std::array<float,2>{0.615074277f, 0.152704492f},
-std::array<float,2>{0.0596151501f, 0.614326119f},
-std::array<float,2>{0.478360623f, 0.336189568f},
-std::array<float,2>{0.768457472f, 0.855834007f},
-std::array<float,2>{0.85257411f, 0.048606094f},
-std::array<float,2>{0.382666171f, 0.673199177f},
-std::array<float,2>{0.0631060526f, 0.492688417f},
-std::array<float,2>{0.537877798f, 0.972290277f},
-std::array<float,2>{0.694699168f, 0.284932524f},
-std::array<float,2>{0.216188878f, 0.807132006f},
-std::array<float,2>{0.351773113f, 0.23630859f},
-std::array<float,2>{0.918090522f, 0.551132917f},
-std::array<float,2>{0.924254656f, 0.277222455f},
-std::array<float,2>{0.368427187f, 0.777241051f},
-std::array<float,2>{0.190199301f, 0.200193897f},
-std::array<float,2>{0.715939283f, 0.501495183f},
-std::array<float,2>{0.555787861f, 0.0188565794f},
-std::array<float,2>{0.092364043f, 0.625356376f},
-std::array<float,2>{0.404299349f, 0.453244418f},
-std::array<float,2>{0.862578154f, 0.958805919f},
-std::array<float,2>{0.752520561f, 0.158747897f},
-std::array<float,2>{0.4844096f, 0.588055611f},
-std::array<float,2>{0.0358902402f, 0.362677038f},
-std::array<float,2>{0.603890061f, 0.835336745f},
-std::array<float,2>{0.662742615f, 0.402572781f},
-std::array<float,2>{0.176823556f, 0.913783312f},
-std::array<float,2>{0.267775565f, 0.105955012f},
-std::array<float,2>{0.99040401f, 0.731684029f},
-std::array<float,2>{0.818545103f, 0.482740194f},
-std::array<float,2>{0.414912343f, 0.998116076f},
-std::array<float,2>{0.118677028f, 0.0340762734f},
-std::array<float,2>{0.509760261f, 0.661592305f},
-std::array<float,2>{0.726700783f, 0.232042015f},
-std::array<float,2>{0.242009893f, 0.532740474f},
-std::array<float,2>{0.316342026f, 0.308340818f},
-std::array<float,2>{0.885976851f, 0.787011385f},
-std::array<float,2>{0.949988484f, 0.0777850151f},
-std::array<float,2>{0.292013943f, 0.702143312f},
-std::array<float,2>{0.14738448f, 0.429173201f},
-std::array<float,2>{0.627949476f, 0.887339056f},
-std::array<float,2>{0.591922939f, 0.323502898f},
-std::array<float,2>{0.0098393634f, 0.865627587f},
-std::array<float,2>{0.461081356f, 0.139090627f},
-std::array<float,2>{0.78384304f, 0.603461802f},
-std::array<float,2>{0.871673226f, 0.301775575f},
-std::array<float,2>{0.397098362f, 0.790474594f},
-std::array<float,2>{0.0851157606f, 0.224664956f},
-std::array<float,2>{0.551155448f, 0.543735147f},
-std::array<float,2>{0.704482436f, 0.0439571254f},
-std::array<float,2>{0.200056717f, 0.665367544f},
-std::array<float,2>{0.365989119f, 0.47247687f},
-std::array<float,2>{0.930428982f, 0.984534025f},
-std::array<float,2>{0.997019351f, 0.131535783f},
-std::array<float,2>{0.278664291f, 0.600857496f},
-std::array<float,2>{0.182977051f, 0.317037463f},
-std::array<float,2>{0.670991957f, 0.869914532f},
-std::array<float,2>{0.594280303f, 0.43591702f},
-std::array<float,2>{0.0423338525f, 0.880287766f},
-std::array<float,2>{0.492468864f, 0.0702556521f},
-std::array<float,2>{0.764363825f, 0.694836199f},
-std::array<float,2>{0.875100136f, 0.467496037f},
-std::array<float,2>{0.323045552f, 0.963851631f},
-std::array<float,2>{0.248313755f, 0.0301097147f},
-std::array<float,2>{0.719398439f, 0.639979541f},
-std::array<float,2>{0.50481832f, 0.187546656f},
-std::array<float,2>{0.116985373f, 0.508628488f},
-std::array<float,2>{0.410672426f, 0.272994161f},
-std::array<float,2>{0.824328899f, 0.771403491f},
-std::array<float,2>{0.795008242f, 0.0963640288f},
-std::array<float,2>{0.458064586f, 0.725620687f},
-std::array<float,2>{0.00413180096f, 0.394705623f},
-std::array<float,2>{0.584136546f, 0.921855986f},
-std::array<float,2>{0.634588838f, 0.37113905f},
-std::array<float,2>{0.151865646f, 0.84224093f},
-std::array<float,2>{0.281982154f, 0.167552948f},
-std::array<float,2>{0.943147898f, 0.578993738f},
-std::array<float,2>{0.953743219f, 0.330551982f},
-std::array<float,2>{0.301653773f, 0.849366069f},
-std::array<float,2>{0.138287008f, 0.142665029f},
-std::array<float,2>{0.644325554f, 0.620361269f},
-std::array<float,2>{0.566633642f, 0.0891521871f},
-std::array<float,2>{0.0211062506f, 0.717931986f},
-std::array<float,2>{0.442350715f, 0.415969878f},
-std::array<float,2>{0.803254604f, 0.903914392f},
-std::array<float,2>{0.837398648f, 0.246629477f},
-std::array<float,2>{0.42212227f, 0.556546092f},
-std::array<float,2>{0.09643884f, 0.295847088f},
-std::array<float,2>{0.519651294f, 0.804256558f},
-std::array<float,2>{0.747947633f, 0.487606794f},
-std::array<float,2>{0.225021794f, 0.982328951f},
-std::array<float,2>{0.338796705f, 0.0569461025f},
-std::array<float,2>{0.905070901f, 0.680952251f},
-std::array<float,2>{0.77445519f, 0.382641584f},
-std::array<float,2>{0.471647352f, 0.92308718f},
-std::array<float,2>{0.0534800962f, 0.113713033f},
-std::array<float,2>{0.624026f, 0.743498027f},
-std::array<float,2>{0.6836254f, 0.179655805f},
-std::array<float,2>{0.171256557f, 0.56681186f},
-std::array<float,2>{0.252758294f, 0.35528776f},
-std::array<float,2>{0.977242708f, 0.814913988f},
-std::array<float,2>{0.909614563f, 0.00951306615f},
-std::array<float,2>{0.344342113f, 0.645035923f},
-std::array<float,2>{0.20629777f, 0.446402729f},
-std::array<float,2>{0.698437333f, 0.947813272f},
-std::array<float,2>{0.544498324f, 0.256196052f},
-std::array<float,2>{0.0766252205f, 0.761028647f},
-std::array<float,2>{0.386959553f, 0.21476914f},
-std::array<float,2>{0.847969413f, 0.524070203f},
-std::array<float,2>{0.828723073f, 0.315590709f},
-std::array<float,2>{0.436733216f, 0.874434829f},
-std::array<float,2>{0.104346551f, 0.125755101f},
-std::array<float,2>{0.529695272f, 0.593949378f},
-std::array<float,2>{0.741233289f, 0.0638085902f},
-std::array<float,2>{0.228971809f, 0.688890457f},
-std::array<float,2>{0.334253609f, 0.433436483f},
-std::array<float,2>{0.89311862f, 0.876250267f},
-std::array<float,2>{0.961100042f, 0.221600413f},
-std::array<float,2>{0.305218726f, 0.541738093f},
-std::array<float,2>{0.126929224f, 0.298988879f},
-std::array<float,2>{0.648458481f, 0.794974625f},
-std::array<float,2>{0.577991903f, 0.473839223f},
-std::array<float,2>{0.0278745387f, 0.99107039f},
-std::array<float,2>{0.445798159f, 0.0427293181f},
-std::array<float,2>{0.812113166f, 0.670758426f},
-std::array<float,2>{0.916836202f, 0.391578704f},
-std::array<float,2>{0.357688248f, 0.916357517f},
-std::array<float,2>{0.213744029f, 0.100770019f},
-std::array<float,2>{0.689602077f, 0.719320536f},
-std::array<float,2>{0.53278029f, 0.168259203f},
-std::array<float,2>{0.0667309165f, 0.58235538f},
-std::array<float,2>{0.377246916f, 0.36957559f},
-std::array<float,2>{0.857909501f, 0.839208126f},
-std::array<float,2>{0.77288568f, 0.0251252502f},
-std::array<float,2>{0.480521768f, 0.634506881f},
-std::array<float,2>{0.0574333481f, 0.463277131f},
-std::array<float,2>{0.610252976f, 0.966159284f},
-std::array<float,2>{0.67952168f, 0.26586327f},
-std::array<float,2>{0.156955779f, 0.768632412f},
-std::array<float,2>{0.263439894f, 0.191612393f},
-std::array<float,2>{0.973739684f, 0.513890147f},
-std::array<float,2>{0.985101104f, 0.289167106f},
-std::array<float,2>{0.270941973f, 0.79878509f},
-std::array<float,2>{0.175392509f, 0.242812157f},
-std::array<float,2>{0.659162045f, 0.561772466f},
-std::array<float,2>{0.608433902f, 0.0607612841f},
-std::array<float,2>{0.0346398428f, 0.684567809f},
-std::array<float,2>{0.488610089f, 0.490168601f},
-std::array<float,2>{0.755503297f, 0.979405582f},
-std::array<float,2>{0.866984725f, 0.147708192f},
-std::array<float,2>{0.401982486f, 0.62273103f},
-std::array<float,2>{0.0883564055f, 0.333902687f},
-std::array<float,2>{0.561537147f, 0.845799506f},
-std::array<float,2>{0.712774098f, 0.418771058f},
-std::array<float,2>{0.194059581f, 0.899120331f},
-std::array<float,2>{0.371516228f, 0.0907996148f},
-std::array<float,2>{0.928605139f, 0.713983476f},
-std::array<float,2>{0.787616253f, 0.452437699f},
-std::array<float,2>{0.465694338f, 0.952777445f},
-std::array<float,2>{0.0139288222f, 0.0130563518f},
-std::array<float,2>{0.58927536f, 0.642919242f},
-std::array<float,2>{0.630934954f, 0.216626883f},
-std::array<float,2>{0.140708089f, 0.528407156f},
-std::array<float,2>{0.294781506f, 0.25137499f},
-std::array<float,2>{0.947077513f, 0.762401342f},
-std::array<float,2>{0.890567958f, 0.110200986f},
-std::array<float,2>{0.319182515f, 0.746792674f},
-std::array<float,2>{0.237770543f, 0.37645179f},
-std::array<float,2>{0.731829584f, 0.926134169f},
-std::array<float,2>{0.513862431f, 0.358711571f},
-std::array<float,2>{0.123487189f, 0.818393528f},
-std::array<float,2>{0.419406056f, 0.174553528f},
-std::array<float,2>{0.81519413f, 0.564742923f},
-std::array<float,2>{0.757954419f, 0.264909834f},
-std::array<float,2>{0.497817069f, 0.757653415f},
-std::array<float,2>{0.0465151295f, 0.203753576f},
-std::array<float,2>{0.601229548f, 0.522436917f},
-std::array<float,2>{0.667707622f, 8.75656842e-05f},
-std::array<float,2>{0.185401097f, 0.651827633f},
-std::array<float,2>{0.275574476f, 0.440957993f},
-std::array<float,2>{0.992353082f, 0.938848436f},
-std::array<float,2>{0.937148988f, 0.182045266f},
-std::array<float,2>{0.359917939f, 0.576466084f},
-std::array<float,2>{0.199044928f, 0.349727124f},
-std::array<float,2>{0.709576964f, 0.825606287f},
-std::array<float,2>{0.548285782f, 0.38655749f},
-std::array<float,2>{0.0787539408f, 0.935182035f},
-std::array<float,2>{0.392559052f, 0.124615885f},
-std::array<float,2>{0.870680749f, 0.738141716f},
-std::array<float,2>{0.939123034f, 0.498540998f},
-std::array<float,2>{0.285239875f, 0.976360381f},
-std::array<float,2>{0.155556723f, 0.0524696f},
-std::array<float,2>{0.639782965f, 0.677903533f},
-std::array<float,2>{0.58037883f, 0.240127563f},
-std::array<float,2>{0.000747062266f, 0.549773991f},
-std::array<float,2>{0.453125894f, 0.285851359f},
-std::array<float,2>{0.792701781f, 0.810462832f},
-std::array<float,2>{0.823325455f, 0.0844196007f},
-std::array<float,2>{0.410151243f, 0.708429098f},
-std::array<float,2>{0.111433044f, 0.413226604f},
-std::array<float,2>{0.500237107f, 0.895078003f},
-std::array<float,2>{0.725221097f, 0.343378335f},
-std::array<float,2>{0.243139774f, 0.851649582f},
-std::array<float,2>{0.326618046f, 0.151458442f},
-std::array<float,2>{0.88237375f, 0.611132979f},
-std::array<float,2>{0.899224997f, 0.363292843f},
-std::array<float,2>{0.343301922f, 0.829248667f},
-std::array<float,2>{0.22029537f, 0.164051145f},
-std::array<float,2>{0.74340868f, 0.590029776f},
-std::array<float,2>{0.519040585f, 0.104972631f},
-std::array<float,2>{0.0986299589f, 0.728374541f},
-std::array<float,2>{0.425957948f, 0.399104863f},
-std::array<float,2>{0.84212172f, 0.908401549f},
-std::array<float,2>{0.799435318f, 0.198406801f},
-std::array<float,2>{0.441208094f, 0.506383002f},
-std::array<float,2>{0.0164027829f, 0.280232161f},
-std::array<float,2>{0.566096485f, 0.780713141f},
-std::array<float,2>{0.646852434f, 0.458445489f},
-std::array<float,2>{0.135123163f, 0.955642223f},
-std::array<float,2>{0.299725592f, 0.0213200282f},
-std::array<float,2>{0.959921181f, 0.632410944f},
-std::array<float,2>{0.846714258f, 0.424506694f},
-std::array<float,2>{0.384087443f, 0.885643721f},
-std::array<float,2>{0.0712773427f, 0.0740772262f},
-std::array<float,2>{0.540400743f, 0.696371615f},
-std::array<float,2>{0.701709867f, 0.134552181f},
-std::array<float,2>{0.20849207f, 0.607356966f},
-std::array<float,2>{0.349550426f, 0.324784815f},
-std::array<float,2>{0.910551429f, 0.859396696f},
-std::array<float,2>{0.980866253f, 0.0354011878f},
-std::array<float,2>{0.25414896f, 0.658928573f},
-std::array<float,2>{0.167020306f, 0.477585793f},
-std::array<float,2>{0.681599855f, 0.993337214f},
-std::array<float,2>{0.619011998f, 0.309760958f},
-std::array<float,2>{0.0501819141f, 0.782194018f},
-std::array<float,2>{0.476064563f, 0.230445817f},
-std::array<float,2>{0.777372837f, 0.537908971f},
-std::array<float,2>{0.771124184f, 0.370493203f},
-std::array<float,2>{0.482474625f, 0.838139117f},
-std::array<float,2>{0.0556858964f, 0.169077188f},
-std::array<float,2>{0.613159359f, 0.583685398f},
-std::array<float,2>{0.675845683f, 0.0999289155f},
-std::array<float,2>{0.159710199f, 0.720255733f},
-std::array<float,2>{0.264385521f, 0.391782999f},
-std::array<float,2>{0.97645694f, 0.917380095f},
-std::array<float,2>{0.914895415f, 0.193236813f},
-std::array<float,2>{0.355623275f, 0.515146673f},
-std::array<float,2>{0.211127207f, 0.267212808f},
-std::array<float,2>{0.689201534f, 0.767861068f},
-std::array<float,2>{0.533665121f, 0.463971525f},
-std::array<float,2>{0.0694575831f, 0.965208709f},
-std::array<float,2>{0.375630468f, 0.0238549691f},
-std::array<float,2>{0.855898321f, 0.633205712f},
-std::array<float,2>{0.963324249f, 0.432381809f},
-std::array<float,2>{0.308453172f, 0.875184894f},
-std::array<float,2>{0.128018215f, 0.063364476f},
-std::array<float,2>{0.651414633f, 0.68757087f},
-std::array<float,2>{0.57551527f, 0.126253292f},
-std::array<float,2>{0.0302773211f, 0.595169961f},
-std::array<float,2>{0.44774884f, 0.314464062f},
-std::array<float,2>{0.810502887f, 0.873987257f},
-std::array<float,2>{0.830774724f, 0.0412986316f},
-std::array<float,2>{0.434070915f, 0.671257615f},
-std::array<float,2>{0.102996148f, 0.472660869f},
-std::array<float,2>{0.52834475f, 0.991797805f},
-std::array<float,2>{0.739486933f, 0.30006361f},
-std::array<float,2>{0.227366507f, 0.796781123f},
-std::array<float,2>{0.332446158f, 0.222464561f},
-std::array<float,2>{0.892038524f, 0.542022228f},
-std::array<float,2>{0.888460159f, 0.250215411f},
-std::array<float,2>{0.316845834f, 0.763063014f},
-std::array<float,2>{0.235937878f, 0.215171635f},
-std::array<float,2>{0.733241022f, 0.528216779f},
-std::array<float,2>{0.51181978f, 0.0123200594f},
-std::array<float,2>{0.122597463f, 0.644085109f},
-std::array<float,2>{0.42149958f, 0.451602846f},
-std::array<float,2>{0.813847899f, 0.951560199f},
-std::array<float,2>{0.785285711f, 0.175257832f},
-std::array<float,2>{0.468411416f, 0.565916002f},
-std::array<float,2>{0.0121894144f, 0.357910931f},
-std::array<float,2>{0.587865174f, 0.820247769f},
-std::array<float,2>{0.629529715f, 0.375713617f},
-std::array<float,2>{0.144524693f, 0.927718103f},
-std::array<float,2>{0.29637f, 0.110918544f},
-std::array<float,2>{0.948334634f, 0.747220337f},
-std::array<float,2>{0.864910722f, 0.488959014f},
-std::array<float,2>{0.399964929f, 0.97976017f},
-std::array<float,2>{0.0877726674f, 0.0622994229f},
-std::array<float,2>{0.559414446f, 0.685199857f},
-std::array<float,2>{0.713690639f, 0.243503153f},
-std::array<float,2>{0.193239406f, 0.561390102f},
-std::array<float,2>{0.374284834f, 0.29076466f},
-std::array<float,2>{0.926937163f, 0.797320187f},
-std::array<float,2>{0.987661541f, 0.0914239883f},
-std::array<float,2>{0.273039162f, 0.713204861f},
-std::array<float,2>{0.173178986f, 0.419552356f},
-std::array<float,2>{0.657950878f, 0.899510205f},
-std::array<float,2>{0.606490493f, 0.332287133f},
-std::array<float,2>{0.0319645517f, 0.846971691f},
-std::array<float,2>{0.492056936f, 0.147298023f},
-std::array<float,2>{0.75771302f, 0.621669173f},
-std::array<float,2>{0.820786417f, 0.286876351f},
-std::array<float,2>{0.40809831f, 0.808882952f},
-std::array<float,2>{0.111074671f, 0.238623604f},
-std::array<float,2>{0.503296077f, 0.550521016f},
-std::array<float,2>{0.723474681f, 0.0512892157f},
-std::array<float,2>{0.24490492f, 0.679223001f},
-std::array<float,2>{0.32474032f, 0.499616951f},
-std::array<float,2>{0.880572438f, 0.975007057f},
-std::array<float,2>{0.941292822f, 0.15127112f},
-std::array<float,2>{0.287642628f, 0.60991776f},
-std::array<float,2>{0.152844727f, 0.342545331f},
-std::array<float,2>{0.638620317f, 0.853018761f},
-std::array<float,2>{0.578250408f, 0.412715584f},
-std::array<float,2>{0.00202156324f, 0.895987511f},
-std::array<float,2>{0.455232382f, 0.08556889f},
-std::array<float,2>{0.790441275f, 0.707386971f},
-std::array<float,2>{0.934060514f, 0.440429568f},
-std::array<float,2>{0.362688631f, 0.938138127f},
-std::array<float,2>{0.195711747f, 0.00109689694f},
-std::array<float,2>{0.708633006f, 0.651229918f},
-std::array<float,2>{0.549592495f, 0.205068588f},
-std::array<float,2>{0.0816028416f, 0.522609115f},
-std::array<float,2>{0.39440465f, 0.264093608f},
-std::array<float,2>{0.869104505f, 0.755901754f},
-std::array<float,2>{0.760066092f, 0.123159885f},
-std::array<float,2>{0.498322874f, 0.736466229f},
-std::array<float,2>{0.0447941162f, 0.385055959f},
-std::array<float,2>{0.599211514f, 0.933809638f},
-std::array<float,2>{0.664842248f, 0.351168185f},
-std::array<float,2>{0.18640916f, 0.824509263f},
-std::array<float,2>{0.274827242f, 0.183489993f},
-std::array<float,2>{0.995522499f, 0.577218115f},
-std::array<float,2>{0.984051824f, 0.325729549f},
-std::array<float,2>{0.257396579f, 0.861099303f},
-std::array<float,2>{0.165116772f, 0.13301073f},
-std::array<float,2>{0.681650102f, 0.605830729f},
-std::array<float,2>{0.620500803f, 0.0724565089f},
-std::array<float,2>{0.0483960733f, 0.69538337f},
-std::array<float,2>{0.473461747f, 0.42534253f},
-std::array<float,2>{0.77941525f, 0.88581419f},
-std::array<float,2>{0.845016837f, 0.22942856f},
-std::array<float,2>{0.384812504f, 0.538383603f},
-std::array<float,2>{0.0728770196f, 0.308594108f},
-std::array<float,2>{0.541698635f, 0.782356918f},
-std::array<float,2>{0.700512826f, 0.477040499f},
-std::array<float,2>{0.209890172f, 0.993132055f},
-std::array<float,2>{0.351257026f, 0.0366204977f},
-std::array<float,2>{0.913072169f, 0.659744322f},
-std::array<float,2>{0.797864497f, 0.399827808f},
-std::array<float,2>{0.43902868f, 0.909627199f},
-std::array<float,2>{0.0189928841f, 0.10438066f},
-std::array<float,2>{0.562541127f, 0.726762354f},
-std::array<float,2>{0.645052314f, 0.162386239f},
-std::array<float,2>{0.134318307f, 0.591769576f},
-std::array<float,2>{0.297893137f, 0.365206897f},
-std::array<float,2>{0.958826184f, 0.828825235f},
-std::array<float,2>{0.901032031f, 0.02040549f},
-std::array<float,2>{0.341334879f, 0.631454229f},
-std::array<float,2>{0.222425535f, 0.457970619f},
-std::array<float,2>{0.7453686f, 0.956934869f},
-std::array<float,2>{0.51679194f, 0.280427545f},
-std::array<float,2>{0.10149423f, 0.779668272f},
-std::array<float,2>{0.428329289f, 0.198242053f},
-std::array<float,2>{0.840739787f, 0.506944895f},
-std::array<float,2>{0.853761375f, 0.337352097f},
-std::array<float,2>{0.380342722f, 0.856586874f},
-std::array<float,2>{0.0648441538f, 0.153397098f},
-std::array<float,2>{0.535817266f, 0.61403358f},
-std::array<float,2>{0.692901909f, 0.0816028789f},
-std::array<float,2>{0.216881841f, 0.705447793f},
-std::array<float,2>{0.354565084f, 0.409632474f},
-std::array<float,2>{0.92155683f, 0.890827f},
-std::array<float,2>{0.97227639f, 0.235274538f},
-std::array<float,2>{0.261237085f, 0.551981211f},
-std::array<float,2>{0.162660763f, 0.283934504f},
-std::array<float,2>{0.673015773f, 0.808105588f},
-std::array<float,2>{0.616097212f, 0.493477494f},
-std::array<float,2>{0.0615469702f, 0.971285045f},
-std::array<float,2>{0.478759348f, 0.0470908657f},
-std::array<float,2>{0.767179072f, 0.672016442f},
-std::array<float,2>{0.896401703f, 0.388552934f},
-std::array<float,2>{0.329367965f, 0.931372881f},
-std::array<float,2>{0.231903017f, 0.119740568f},
-std::array<float,2>{0.735102534f, 0.740181565f},
-std::array<float,2>{0.525712609f, 0.187237188f},
-std::array<float,2>{0.107767724f, 0.571464598f},
-std::array<float,2>{0.430873632f, 0.347020984f},
-std::array<float,2>{0.832608581f, 0.821784496f},
-std::array<float,2>{0.806848049f, 0.00509695197f},
-std::array<float,2>{0.449560881f, 0.653832972f},
-std::array<float,2>{0.0235013757f, 0.444272399f},
-std::array<float,2>{0.571793616f, 0.944920182f},
-std::array<float,2>{0.656016648f, 0.258009702f},
-std::array<float,2>{0.130315527f, 0.751646638f},
-std::array<float,2>{0.30899629f, 0.208763033f},
-std::array<float,2>{0.966742814f, 0.518571258f},
-std::array<float,2>{0.951871932f, 0.306836456f},
-std::array<float,2>{0.289871722f, 0.78548038f},
-std::array<float,2>{0.145815253f, 0.23142077f},
-std::array<float,2>{0.625177681f, 0.531330943f},
-std::array<float,2>{0.590968609f, 0.0347624756f},
-std::array<float,2>{0.00846925844f, 0.66106838f},
-std::array<float,2>{0.464813828f, 0.483796209f},
-std::array<float,2>{0.782709777f, 0.999587357f},
-std::array<float,2>{0.81679976f, 0.140206486f},
-std::array<float,2>{0.41743353f, 0.601689637f},
-std::array<float,2>{0.120436132f, 0.323070019f},
-std::array<float,2>{0.510926127f, 0.866392434f},
-std::array<float,2>{0.729133785f, 0.428589821f},
-std::array<float,2>{0.239812776f, 0.887989342f},
-std::array<float,2>{0.313605666f, 0.0768764988f},
-std::array<float,2>{0.883936763f, 0.702573478f},
-std::array<float,2>{0.751118302f, 0.454994321f},
-std::array<float,2>{0.487009615f, 0.957566142f},
-std::array<float,2>{0.0380560309f, 0.0176515058f},
-std::array<float,2>{0.603282332f, 0.626151264f},
-std::array<float,2>{0.6616804f, 0.200417161f},
-std::array<float,2>{0.179531425f, 0.500893891f},
-std::array<float,2>{0.265826136f, 0.275759846f},
-std::array<float,2>{0.988944709f, 0.77569139f},
-std::array<float,2>{0.923036337f, 0.106849626f},
-std::array<float,2>{0.369644225f, 0.730938375f},
-std::array<float,2>{0.188212484f, 0.403389305f},
-std::array<float,2>{0.718501866f, 0.912649155f},
-std::array<float,2>{0.557548344f, 0.362171441f},
-std::array<float,2>{0.0916933715f, 0.834329605f},
-std::array<float,2>{0.402709544f, 0.159594581f},
-std::array<float,2>{0.86068064f, 0.589267075f},
-std::array<float,2>{0.793832541f, 0.271929145f},
-std::array<float,2>{0.459789693f, 0.77008903f},
-std::array<float,2>{0.00588960014f, 0.188482255f},
-std::array<float,2>{0.58343488f, 0.508842409f},
-std::array<float,2>{0.63527745f, 0.0307126474f},
-std::array<float,2>{0.149537906f, 0.639640033f},
-std::array<float,2>{0.284421414f, 0.467841685f},
-std::array<float,2>{0.944928288f, 0.963990688f},
-std::array<float,2>{0.877766192f, 0.166169241f},
-std::array<float,2>{0.320619255f, 0.579131663f},
-std::array<float,2>{0.246590197f, 0.37275973f},
-std::array<float,2>{0.720825851f, 0.84348017f},
-std::array<float,2>{0.506155729f, 0.395894438f},
-std::array<float,2>{0.114570215f, 0.919961393f},
-std::array<float,2>{0.412785381f, 0.0973588824f},
-std::array<float,2>{0.826968312f, 0.724928379f},
-std::array<float,2>{0.998901963f, 0.471207678f},
-std::array<float,2>{0.280388325f, 0.986103594f},
-std::array<float,2>{0.180651978f, 0.0439171307f},
-std::array<float,2>{0.669081986f, 0.664190769f},
-std::array<float,2>{0.596720159f, 0.225702092f},
-std::array<float,2>{0.0401223637f, 0.544816315f},
-std::array<float,2>{0.495730162f, 0.301454723f},
-std::array<float,2>{0.761967719f, 0.789178967f},
-std::array<float,2>{0.87483269f, 0.0688277781f},
-std::array<float,2>{0.396124572f, 0.693540752f},
-std::array<float,2>{0.0827167109f, 0.436800838f},
-std::array<float,2>{0.553765833f, 0.879156947f},
-std::array<float,2>{0.705792785f, 0.317844242f},
-std::array<float,2>{0.202586591f, 0.870333493f},
-std::array<float,2>{0.363529354f, 0.131877258f},
-std::array<float,2>{0.932400703f, 0.6000458f},
-std::array<float,2>{0.907987475f, 0.353693783f},
-std::array<float,2>{0.347050518f, 0.81578207f},
-std::array<float,2>{0.203836903f, 0.178683966f},
-std::array<float,2>{0.697086155f, 0.567872345f},
-std::array<float,2>{0.546357334f, 0.114645414f},
-std::array<float,2>{0.0745732859f, 0.743055999f},
-std::array<float,2>{0.388952047f, 0.381206334f},
-std::array<float,2>{0.850361824f, 0.922563493f},
-std::array<float,2>{0.775640011f, 0.213445336f},
-std::array<float,2>{0.468911946f, 0.525355756f},
-std::array<float,2>{0.0524145439f, 0.257212639f},
-std::array<float,2>{0.621750057f, 0.760026932f},
-std::array<float,2>{0.685812891f, 0.445699483f},
-std::array<float,2>{0.168388471f, 0.948292077f},
-std::array<float,2>{0.25127691f, 0.00792937726f},
-std::array<float,2>{0.979781508f, 0.646298468f},
-std::array<float,2>{0.839045525f, 0.414906591f},
-std::array<float,2>{0.425001681f, 0.902550042f},
-std::array<float,2>{0.0943195894f, 0.0880705044f},
-std::array<float,2>{0.522439897f, 0.716867447f},
-std::array<float,2>{0.748140275f, 0.143683672f},
-std::array<float,2>{0.22317563f, 0.619184434f},
-std::array<float,2>{0.336892337f, 0.331749707f},
-std::array<float,2>{0.903455198f, 0.847680986f},
-std::array<float,2>{0.956020951f, 0.0583033413f},
-std::array<float,2>{0.303590178f, 0.680144727f},
-std::array<float,2>{0.140231803f, 0.48666656f},
-std::array<float,2>{0.64234066f, 0.981269062f},
-std::array<float,2>{0.56924957f, 0.296204239f},
-std::array<float,2>{0.021868933f, 0.803464949f},
-std::array<float,2>{0.444655448f, 0.247328311f},
-std::array<float,2>{0.801207125f, 0.555049539f},
-std::array<float,2>{0.812477231f, 0.313001215f},
-std::array<float,2>{0.44544068f, 0.871882975f},
-std::array<float,2>{0.0281788483f, 0.127539381f},
-std::array<float,2>{0.577745974f, 0.596153677f},
-std::array<float,2>{0.648801506f, 0.0657737702f},
-std::array<float,2>{0.126532823f, 0.689860761f},
-std::array<float,2>{0.305544347f, 0.430146188f},
-std::array<float,2>{0.961216807f, 0.877526283f},
-std::array<float,2>{0.893490851f, 0.218844503f},
-std::array<float,2>{0.334118634f, 0.539895713f},
-std::array<float,2>{0.228564814f, 0.298138231f},
-std::array<float,2>{0.741599381f, 0.792970061f},
-std::array<float,2>{0.529375136f, 0.474804491f},
-std::array<float,2>{0.104043707f, 0.989579976f},
-std::array<float,2>{0.436972201f, 0.040243458f},
-std::array<float,2>{0.828983545f, 0.668140888f},
-std::array<float,2>{0.97389394f, 0.393380582f},
-std::array<float,2>{0.263426721f, 0.914142489f},
-std::array<float,2>{0.157216728f, 0.0990167335f},
-std::array<float,2>{0.679284811f, 0.720811546f},
-std::array<float,2>{0.610004842f, 0.170175716f},
-std::array<float,2>{0.0571787953f, 0.585634351f},
-std::array<float,2>{0.480775356f, 0.367756754f},
-std::array<float,2>{0.772646666f, 0.837204039f},
-std::array<float,2>{0.857586443f, 0.0267430376f},
-std::array<float,2>{0.377189755f, 0.635660291f},
-std::array<float,2>{0.0665481761f, 0.461885631f},
-std::array<float,2>{0.533115387f, 0.967588365f},
-std::array<float,2>{0.689932585f, 0.268032491f},
-std::array<float,2>{0.213522434f, 0.766648412f},
-std::array<float,2>{0.35753575f, 0.193378165f},
-std::array<float,2>{0.91671145f, 0.512906194f},
-std::array<float,2>{0.928394914f, 0.291253895f},
-std::array<float,2>{0.371167064f, 0.799623489f},
-std::array<float,2>{0.194215074f, 0.245210826f},
-std::array<float,2>{0.712472737f, 0.560362756f},
-std::array<float,2>{0.561804295f, 0.0591087155f},
-std::array<float,2>{0.0880742073f, 0.68666321f},
-std::array<float,2>{0.40232417f, 0.49145937f},
-std::array<float,2>{0.866941571f, 0.978436649f},
-std::array<float,2>{0.755677164f, 0.144961998f},
-std::array<float,2>{0.48846069f, 0.624819219f},
-std::array<float,2>{0.0343549438f, 0.334501714f},
-std::array<float,2>{0.608727992f, 0.84464246f},
-std::array<float,2>{0.658708811f, 0.421187103f},
-std::array<float,2>{0.175540179f, 0.901232421f},
-std::array<float,2>{0.270661324f, 0.0926154777f},
-std::array<float,2>{0.98526305f, 0.711473167f},
-std::array<float,2>{0.814997494f, 0.450507581f},
-std::array<float,2>{0.419132233f, 0.949850142f},
-std::array<float,2>{0.123169944f, 0.0136888018f},
-std::array<float,2>{0.514107645f, 0.640765727f},
-std::array<float,2>{0.731530547f, 0.218721554f},
-std::array<float,2>{0.237498701f, 0.531021595f},
-std::array<float,2>{0.318968236f, 0.252570629f},
-std::array<float,2>{0.890339494f, 0.765468478f},
-std::array<float,2>{0.946787238f, 0.112567261f},
-std::array<float,2>{0.29465571f, 0.74963671f},
-std::array<float,2>{0.140915886f, 0.378173858f},
-std::array<float,2>{0.631216407f, 0.928699672f},
-std::array<float,2>{0.588935494f, 0.35741812f},
-std::array<float,2>{0.0137927644f, 0.817894161f},
-std::array<float,2>{0.46544224f, 0.173308477f},
-std::array<float,2>{0.788034201f, 0.563589752f},
-std::array<float,2>{0.870994151f, 0.263356179f},
-std::array<float,2>{0.392313719f, 0.755621433f},
-std::array<float,2>{0.0790103078f, 0.206609473f},
-std::array<float,2>{0.548036516f, 0.519698977f},
-std::array<float,2>{0.709764898f, 0.00235832413f},
-std::array<float,2>{0.198806688f, 0.650082231f},
-std::array<float,2>{0.360212922f, 0.437861264f},
-std::array<float,2>{0.937494397f, 0.940928936f},
-std::array<float,2>{0.992506802f, 0.181225598f},
-std::array<float,2>{0.275711924f, 0.575204134f},
-std::array<float,2>{0.185129091f, 0.347720474f},
-std::array<float,2>{0.667923808f, 0.826750517f},
-std::array<float,2>{0.601513088f, 0.383277178f},
-std::array<float,2>{0.0468321964f, 0.93636018f},
-std::array<float,2>{0.497572005f, 0.121938437f},
-std::array<float,2>{0.75819397f, 0.735640228f},
-std::array<float,2>{0.882610857f, 0.497797608f},
-std::array<float,2>{0.326242894f, 0.973689675f},
-std::array<float,2>{0.242839679f, 0.0539556928f},
-std::array<float,2>{0.725584805f, 0.676275969f},
-std::array<float,2>{0.500341833f, 0.240281731f},
-std::array<float,2>{0.111765072f, 0.547294736f},
-std::array<float,2>{0.409810454f, 0.287418574f},
-std::array<float,2>{0.823559344f, 0.811531305f},
-std::array<float,2>{0.792902887f, 0.0825314745f},
-std::array<float,2>{0.45353213f, 0.70959866f},
-std::array<float,2>{0.00059874478f, 0.410465032f},
-std::array<float,2>{0.580096841f, 0.896712601f},
-std::array<float,2>{0.640110672f, 0.341420978f},
-std::array<float,2>{0.155514419f, 0.853806913f},
-std::array<float,2>{0.285543233f, 0.149541035f},
-std::array<float,2>{0.939406395f, 0.613090038f},
-std::array<float,2>{0.959676743f, 0.365880996f},
-std::array<float,2>{0.299527138f, 0.831404865f},
-std::array<float,2>{0.13494131f, 0.16072081f},
-std::array<float,2>{0.646620214f, 0.59204179f},
-std::array<float,2>{0.566204786f, 0.101983309f},
-std::array<float,2>{0.016248066f, 0.729139447f},
-std::array<float,2>{0.441096932f, 0.402157247f},
-std::array<float,2>{0.799675584f, 0.907084584f},
-std::array<float,2>{0.842032313f, 0.195615426f},
-std::array<float,2>{0.426092476f, 0.505682111f},
-std::array<float,2>{0.0983675867f, 0.277999252f},
-std::array<float,2>{0.518751621f, 0.778714716f},
-std::array<float,2>{0.743258238f, 0.460290402f},
-std::array<float,2>{0.220557019f, 0.954365075f},
-std::array<float,2>{0.343531787f, 0.0219067372f},
-std::array<float,2>{0.898980796f, 0.630224347f},
-std::array<float,2>{0.777815998f, 0.422944725f},
-std::array<float,2>{0.475669146f, 0.88465184f},
-std::array<float,2>{0.0499371067f, 0.0717355311f},
-std::array<float,2>{0.618816078f, 0.69744873f},
-std::array<float,2>{0.681337297f, 0.135163248f},
-std::array<float,2>{0.167366579f, 0.607527316f},
-std::array<float,2>{0.254365474f, 0.326468855f},
-std::array<float,2>{0.980520427f, 0.861938715f},
-std::array<float,2>{0.910365582f, 0.0378371291f},
-std::array<float,2>{0.349151701f, 0.657325625f},
-std::array<float,2>{0.208171308f, 0.478698939f},
-std::array<float,2>{0.701984465f, 0.99500072f},
-std::array<float,2>{0.540189207f, 0.312263697f},
-std::array<float,2>{0.071019344f, 0.783884525f},
-std::array<float,2>{0.383858562f, 0.227377042f},
-std::array<float,2>{0.847155154f, 0.536311567f},
-std::array<float,2>{0.835505545f, 0.345589131f},
-std::array<float,2>{0.433497161f, 0.822648942f},
-std::array<float,2>{0.106075548f, 0.184558645f},
-std::array<float,2>{0.52456969f, 0.572400391f},
-std::array<float,2>{0.737100601f, 0.117545463f},
-std::array<float,2>{0.233702883f, 0.740831494f},
-std::array<float,2>{0.331156522f, 0.389376968f},
-std::array<float,2>{0.896824241f, 0.9331882f},
-std::array<float,2>{0.968678772f, 0.209855601f},
-std::array<float,2>{0.310879618f, 0.516252756f},
-std::array<float,2>{0.13154158f, 0.261651874f},
-std::array<float,2>{0.652737498f, 0.751974344f},
-std::array<float,2>{0.572661519f, 0.442537159f},
-std::array<float,2>{0.0265778154f, 0.941974401f},
-std::array<float,2>{0.452521056f, 0.00720969215f},
-std::array<float,2>{0.806114018f, 0.655676126f},
-std::array<float,2>{0.918393433f, 0.407562703f},
-std::array<float,2>{0.351985961f, 0.892872691f},
-std::array<float,2>{0.215904132f, 0.079296276f},
-std::array<float,2>{0.694516659f, 0.70479697f},
-std::array<float,2>{0.53774488f, 0.156007558f},
-std::array<float,2>{0.063327685f, 0.61629355f},
-std::array<float,2>{0.382436842f, 0.339589626f},
-std::array<float,2>{0.852818429f, 0.858747244f},
-std::array<float,2>{0.768067598f, 0.0490215719f},
-std::array<float,2>{0.478256762f, 0.675590932f},
-std::array<float,2>{0.0599840358f, 0.495946556f},
-std::array<float,2>{0.61479634f, 0.969932616f},
-std::array<float,2>{0.674714327f, 0.282499433f},
-std::array<float,2>{0.160974056f, 0.805162668f},
-std::array<float,2>{0.258095413f, 0.236757204f},
-std::array<float,2>{0.968808353f, 0.553484857f},
-std::array<float,2>{0.990669847f, 0.275322825f},
-std::array<float,2>{0.267920971f, 0.774163604f},
-std::array<float,2>{0.177075386f, 0.20211409f},
-std::array<float,2>{0.663068831f, 0.502763808f},
-std::array<float,2>{0.603595078f, 0.015664136f},
-std::array<float,2>{0.0358673297f, 0.628179491f},
-std::array<float,2>{0.484858304f, 0.456659645f},
-std::array<float,2>{0.752910078f, 0.960761249f},
-std::array<float,2>{0.862394214f, 0.156980321f},
-std::array<float,2>{0.404753685f, 0.587587237f},
-std::array<float,2>{0.0927185416f, 0.359566778f},
-std::array<float,2>{0.556108832f, 0.833554506f},
-std::array<float,2>{0.716214657f, 0.404412359f},
-std::array<float,2>{0.190182403f, 0.911859095f},
-std::array<float,2>{0.368238121f, 0.107632779f},
-std::array<float,2>{0.924056351f, 0.732580662f},
-std::array<float,2>{0.784004331f, 0.482055813f},
-std::array<float,2>{0.461290896f, 0.996622562f},
-std::array<float,2>{0.0102285314f, 0.0327119753f},
-std::array<float,2>{0.59228152f, 0.663606942f},
-std::array<float,2>{0.628378212f, 0.233716652f},
-std::array<float,2>{0.147213206f, 0.534355223f},
-std::array<float,2>{0.292451054f, 0.30524838f},
-std::array<float,2>{0.949827135f, 0.787470996f},
-std::array<float,2>{0.886092246f, 0.0752699822f},
-std::array<float,2>{0.315978259f, 0.699620485f},
-std::array<float,2>{0.241806388f, 0.42766422f},
-std::array<float,2>{0.726868927f, 0.889941752f},
-std::array<float,2>{0.509279311f, 0.321723819f},
-std::array<float,2>{0.119081654f, 0.864932477f},
-std::array<float,2>{0.414731234f, 0.137951955f},
-std::array<float,2>{0.818844259f, 0.604623675f},
-std::array<float,2>{0.764590681f, 0.303979427f},
-std::array<float,2>{0.492331564f, 0.792846441f},
-std::array<float,2>{0.042139262f, 0.22446844f},
-std::array<float,2>{0.594573677f, 0.546186268f},
-std::array<float,2>{0.671156049f, 0.0449420214f},
-std::array<float,2>{0.182831839f, 0.666221738f},
-std::array<float,2>{0.278518975f, 0.468773782f},
-std::array<float,2>{0.996601284f, 0.986875236f},
-std::array<float,2>{0.930246353f, 0.12948975f},
-std::array<float,2>{0.365907997f, 0.598371983f},
-std::array<float,2>{0.199709103f, 0.318601668f},
-std::array<float,2>{0.704254687f, 0.867947996f},
-std::array<float,2>{0.550808668f, 0.433721781f},
-std::array<float,2>{0.085237883f, 0.881364763f},
-std::array<float,2>{0.397390485f, 0.0680986121f},
-std::array<float,2>{0.871956408f, 0.691753745f},
-std::array<float,2>{0.943004966f, 0.464850813f},
-std::array<float,2>{0.282113165f, 0.962369978f},
-std::array<float,2>{0.152230725f, 0.028844662f},
-std::array<float,2>{0.634395659f, 0.638229907f},
-std::array<float,2>{0.584315002f, 0.19009994f},
-std::array<float,2>{0.00428207498f, 0.510758102f},
-std::array<float,2>{0.458350539f, 0.269686818f},
-std::array<float,2>{0.795278251f, 0.772659123f},
-std::array<float,2>{0.824638844f, 0.095062077f},
-std::array<float,2>{0.411013573f, 0.7245242f},
-std::array<float,2>{0.116767198f, 0.397633344f},
-std::array<float,2>{0.504398525f, 0.918606043f},
-std::array<float,2>{0.719698191f, 0.374163628f},
-std::array<float,2>{0.24810563f, 0.841725409f},
-std::array<float,2>{0.322966188f, 0.164120287f},
-std::array<float,2>{0.875249684f, 0.581336796f},
-std::array<float,2>{0.905001402f, 0.329639763f},
-std::array<float,2>{0.338485032f, 0.851541877f},
-std::array<float,2>{0.22482349f, 0.141939804f},
-std::array<float,2>{0.747789621f, 0.618820012f},
-std::array<float,2>{0.51995945f, 0.0862075612f},
-std::array<float,2>{0.0964139551f, 0.715168536f},
-std::array<float,2>{0.422054052f, 0.417476982f},
-std::array<float,2>{0.837050498f, 0.904552639f},
-std::array<float,2>{0.803655386f, 0.249711588f},
-std::array<float,2>{0.441897273f, 0.557202935f},
-std::array<float,2>{0.021378072f, 0.294856727f},
-std::array<float,2>{0.56668216f, 0.802222252f},
-std::array<float,2>{0.644215643f, 0.485440284f},
-std::array<float,2>{0.138489068f, 0.983628094f},
-std::array<float,2>{0.301420778f, 0.055292625f},
-std::array<float,2>{0.953869641f, 0.682471275f},
-std::array<float,2>{0.847809613f, 0.379722059f},
-std::array<float,2>{0.387077361f, 0.925142586f},
-std::array<float,2>{0.0762040764f, 0.115247793f},
-std::array<float,2>{0.544681728f, 0.745237947f},
-std::array<float,2>{0.698541641f, 0.176605627f},
-std::array<float,2>{0.206515208f, 0.568936884f},
-std::array<float,2>{0.344496995f, 0.353324413f},
-std::array<float,2>{0.909350872f, 0.81268692f},
-std::array<float,2>{0.977396131f, 0.0101747373f},
-std::array<float,2>{0.252548575f, 0.648437083f},
-std::array<float,2>{0.171128705f, 0.447538584f},
-std::array<float,2>{0.683954716f, 0.946452022f},
-std::array<float,2>{0.624412715f, 0.254884005f},
-std::array<float,2>{0.0533609129f, 0.758313119f},
-std::array<float,2>{0.471194446f, 0.212146878f},
-std::array<float,2>{0.774884164f, 0.52572459f},
-std::array<float,2>{0.75657922f, 0.335314929f},
-std::array<float,2>{0.490579873f, 0.845205307f},
-std::array<float,2>{0.0329654105f, 0.146036282f},
-std::array<float,2>{0.605995178f, 0.624004006f},
-std::array<float,2>{0.656560481f, 0.0936192349f},
-std::array<float,2>{0.171987027f, 0.71210742f},
-std::array<float,2>{0.271845579f, 0.420358777f},
-std::array<float,2>{0.987245142f, 0.90144676f},
-std::array<float,2>{0.92580533f, 0.244979784f},
-std::array<float,2>{0.373135805f, 0.55956763f},
-std::array<float,2>{0.191615984f, 0.292096347f},
-std::array<float,2>{0.714185417f, 0.800434589f},
-std::array<float,2>{0.559741855f, 0.490810573f},
-std::array<float,2>{0.086140722f, 0.977195978f},
-std::array<float,2>{0.398496807f, 0.0600665472f},
-std::array<float,2>{0.863645017f, 0.685732961f},
-std::array<float,2>{0.948043108f, 0.377198964f},
-std::array<float,2>{0.295433104f, 0.929417372f},
-std::array<float,2>{0.143021733f, 0.111690529f},
-std::array<float,2>{0.630260885f, 0.748114586f},
-std::array<float,2>{0.586124301f, 0.172633141f},
-std::array<float,2>{0.0129059581f, 0.562901318f},
-std::array<float,2>{0.467177331f, 0.355964094f},
-std::array<float,2>{0.786821127f, 0.817116737f},
-std::array<float,2>{0.813193738f, 0.015311013f},
-std::array<float,2>{0.420626014f, 0.642524719f},
-std::array<float,2>{0.121389516f, 0.449656725f},
-std::array<float,2>{0.512794077f, 0.951143444f},
-std::array<float,2>{0.733487129f, 0.253510565f},
-std::array<float,2>{0.235221222f, 0.76371944f},
-std::array<float,2>{0.318192929f, 0.216917202f},
-std::array<float,2>{0.886788785f, 0.530116796f},
-std::array<float,2>{0.89157021f, 0.297748417f},
-std::array<float,2>{0.333577394f, 0.794818223f},
-std::array<float,2>{0.227753878f, 0.220165983f},
-std::array<float,2>{0.739049971f, 0.540081143f},
-std::array<float,2>{0.528249562f, 0.0392702594f},
-std::array<float,2>{0.102030411f, 0.66932559f},
-std::array<float,2>{0.43551001f, 0.47628513f},
-std::array<float,2>{0.831187546f, 0.988741398f},
-std::array<float,2>{0.809099734f, 0.128293931f},
-std::array<float,2>{0.449056983f, 0.597152174f},
-std::array<float,2>{0.0293168034f, 0.314066023f},
-std::array<float,2>{0.57487452f, 0.87220329f},
-std::array<float,2>{0.650811493f, 0.431506693f},
-std::array<float,2>{0.127005413f, 0.878774881f},
-std::array<float,2>{0.307083219f, 0.0645656511f},
-std::array<float,2>{0.963908494f, 0.690804362f},
-std::array<float,2>{0.857029438f, 0.462372392f},
-std::array<float,2>{0.376120597f, 0.968370378f},
-std::array<float,2>{0.0689087361f, 0.0254617501f},
-std::array<float,2>{0.535106719f, 0.635948479f},
-std::array<float,2>{0.688309014f, 0.195000529f},
-std::array<float,2>{0.212346971f, 0.512246788f},
-std::array<float,2>{0.356902122f, 0.269014925f},
-std::array<float,2>{0.916014612f, 0.76593703f},
-std::array<float,2>{0.974613249f, 0.0985040367f},
-std::array<float,2>{0.264792085f, 0.721698642f},
-std::array<float,2>{0.158352956f, 0.394146323f},
-std::array<float,2>{0.677015007f, 0.915187061f},
-std::array<float,2>{0.612052977f, 0.368465394f},
-std::array<float,2>{0.0552068464f, 0.836438775f},
-std::array<float,2>{0.484225363f, 0.170951709f},
-std::array<float,2>{0.77034992f, 0.584614098f},
-std::array<float,2>{0.840902567f, 0.278530836f},
-std::array<float,2>{0.428935915f, 0.777425349f},
-std::array<float,2>{0.100105725f, 0.196963221f},
-std::array<float,2>{0.516019225f, 0.504761696f},
-std::array<float,2>{0.744680524f, 0.0233682245f},
-std::array<float,2>{0.22103329f, 0.629104197f},
-std::array<float,2>{0.340111673f, 0.459684461f},
-std::array<float,2>{0.901694179f, 0.953167558f},
-std::array<float,2>{0.957214117f, 0.161600307f},
-std::array<float,2>{0.297504872f, 0.592843294f},
-std::array<float,2>{0.133227751f, 0.367043525f},
-std::array<float,2>{0.646024346f, 0.8301332f},
-std::array<float,2>{0.564284325f, 0.400492936f},
-std::array<float,2>{0.0183768924f, 0.907337725f},
-std::array<float,2>{0.438022345f, 0.103409238f},
-std::array<float,2>{0.797252417f, 0.73042345f},
-std::array<float,2>{0.91385895f, 0.479912817f},
-std::array<float,2>{0.350111187f, 0.995297253f},
-std::array<float,2>{0.210379064f, 0.0389429852f},
-std::array<float,2>{0.699895442f, 0.656574428f},
-std::array<float,2>{0.542920649f, 0.228124291f},
-std::array<float,2>{0.0735547096f, 0.535579205f},
-std::array<float,2>{0.386376679f, 0.311017275f},
-std::array<float,2>{0.844629884f, 0.784827173f},
-std::array<float,2>{0.780610621f, 0.0708338991f},
-std::array<float,2>{0.474157989f, 0.698693097f},
-std::array<float,2>{0.0475469604f, 0.422204942f},
-std::array<float,2>{0.6194821f, 0.883738995f},
-std::array<float,2>{0.683118045f, 0.327188611f},
-std::array<float,2>{0.164889663f, 0.862689137f},
-std::array<float,2>{0.256420314f, 0.136215672f},
-std::array<float,2>{0.982598901f, 0.60877794f},
-std::array<float,2>{0.994517267f, 0.349546552f},
-std::array<float,2>{0.273704499f, 0.827432275f},
-std::array<float,2>{0.187174857f, 0.179730251f},
-std::array<float,2>{0.665905654f, 0.574930847f},
-std::array<float,2>{0.597878516f, 0.122689053f},
-std::array<float,2>{0.0432295315f, 0.73494184f},
-std::array<float,2>{0.499406457f, 0.384169787f},
-std::array<float,2>{0.760913372f, 0.937355876f},
-std::array<float,2>{0.867533088f, 0.205169722f},
-std::array<float,2>{0.393014282f, 0.521121502f},
-std::array<float,2>{0.0807845369f, 0.262395024f},
-std::array<float,2>{0.550073802f, 0.754288137f},
-std::array<float,2>{0.707440615f, 0.439320534f},
-std::array<float,2>{0.196697578f, 0.939912081f},
-std::array<float,2>{0.362071067f, 0.00319624273f},
-std::array<float,2>{0.934931219f, 0.648470879f},
-std::array<float,2>{0.789303601f, 0.411189407f},
-std::array<float,2>{0.456582278f, 0.898359716f},
-std::array<float,2>{0.0032962393f, 0.0836312622f},
-std::array<float,2>{0.579306543f, 0.710489213f},
-std::array<float,2>{0.636953235f, 0.148645088f},
-std::array<float,2>{0.154007301f, 0.611989856f},
-std::array<float,2>{0.288127005f, 0.339905232f},
-std::array<float,2>{0.939913332f, 0.854921222f},
-std::array<float,2>{0.879748881f, 0.052869536f},
-std::array<float,2>{0.325532436f, 0.677577198f},
-std::array<float,2>{0.245543733f, 0.496306419f},
-std::array<float,2>{0.724009693f, 0.972931027f},
-std::array<float,2>{0.502266049f, 0.288245261f},
-std::array<float,2>{0.109782241f, 0.810932279f},
-std::array<float,2>{0.406256706f, 0.241602302f},
-std::array<float,2>{0.822212338f, 0.548584819f},
-std::array<float,2>{0.860331118f, 0.360992253f},
-std::array<float,2>{0.404260844f, 0.832755506f},
-std::array<float,2>{0.0901291668f, 0.157372877f},
-std::array<float,2>{0.557996511f, 0.586742938f},
-std::array<float,2>{0.717747569f, 0.109307148f},
-std::array<float,2>{0.188825741f, 0.733913183f},
-std::array<float,2>{0.370943725f, 0.406131446f},
-std::array<float,2>{0.922249496f, 0.910558522f},
-std::array<float,2>{0.990158916f, 0.202242464f},
-std::array<float,2>{0.266645372f, 0.50333631f},
-std::array<float,2>{0.178049728f, 0.27436468f},
-std::array<float,2>{0.660194993f, 0.774867713f},
-std::array<float,2>{0.602371037f, 0.455991834f},
-std::array<float,2>{0.0389912799f, 0.959304631f},
-std::array<float,2>{0.488220006f, 0.0171296578f},
-std::array<float,2>{0.75063318f, 0.627324402f},
-std::array<float,2>{0.883055687f, 0.426715165f},
-std::array<float,2>{0.312821686f, 0.888758719f},
-std::array<float,2>{0.238312587f, 0.0743003562f},
-std::array<float,2>{0.730462134f, 0.700749218f},
-std::array<float,2>{0.510165334f, 0.13753438f},
-std::array<float,2>{0.119534545f, 0.603643954f},
-std::array<float,2>{0.416562915f, 0.32112512f},
-std::array<float,2>{0.818109214f, 0.863635898f},
-std::array<float,2>{0.781590223f, 0.0320112444f},
-std::array<float,2>{0.463503867f, 0.6630373f},
-std::array<float,2>{0.00913116336f, 0.481357455f},
-std::array<float,2>{0.590076625f, 0.99710989f},
-std::array<float,2>{0.626583874f, 0.305930227f},
-std::array<float,2>{0.145152479f, 0.788959742f},
-std::array<float,2>{0.29008773f, 0.233112901f},
-std::array<float,2>{0.952452004f, 0.533309102f},
-std::array<float,2>{0.965558708f, 0.26073429f},
-std::array<float,2>{0.310354203f, 0.753719807f},
-std::array<float,2>{0.12953271f, 0.21051833f},
-std::array<float,2>{0.654787362f, 0.516788721f},
-std::array<float,2>{0.570809782f, 0.00605588453f},
-std::array<float,2>{0.0253118724f, 0.654707909f},
-std::array<float,2>{0.450228274f, 0.44143191f},
-std::array<float,2>{0.80772543f, 0.942887783f},
-std::array<float,2>{0.833208919f, 0.185409293f},
-std::array<float,2>{0.430200875f, 0.574060798f},
-std::array<float,2>{0.108982556f, 0.343987554f},
-std::array<float,2>{0.527172446f, 0.823613346f},
-std::array<float,2>{0.736281693f, 0.389853984f},
-std::array<float,2>{0.230495229f, 0.932352364f},
-std::array<float,2>{0.328405619f, 0.118648417f},
-std::array<float,2>{0.89465332f, 0.742062628f},
-std::array<float,2>{0.765667081f, 0.494532615f},
-std::array<float,2>{0.480251968f, 0.968984783f},
-std::array<float,2>{0.060844332f, 0.0502811074f},
-std::array<float,2>{0.616557837f, 0.674018502f},
-std::array<float,2>{0.672174275f, 0.237950891f},
-std::array<float,2>{0.163963959f, 0.554603279f},
-std::array<float,2>{0.26030004f, 0.282145888f},
-std::array<float,2>{0.97121197f, 0.806583226f},
-std::array<float,2>{0.920240104f, 0.0788305104f},
-std::array<float,2>{0.354245424f, 0.703748524f},
-std::array<float,2>{0.218403235f, 0.406258374f},
-std::array<float,2>{0.69224453f, 0.894326985f},
-std::array<float,2>{0.536416054f, 0.338356137f},
-std::array<float,2>{0.0657852739f, 0.857857645f},
-std::array<float,2>{0.37975198f, 0.154771134f},
-std::array<float,2>{0.855310142f, 0.615292788f},
-std::array<float,2>{0.80245769f, 0.293668419f},
-std::array<float,2>{0.443850398f, 0.801452577f},
-std::array<float,2>{0.0233114418f, 0.248527125f},
-std::array<float,2>{0.57002449f, 0.558209002f},
-std::array<float,2>{0.641298711f, 0.0560388304f},
-std::array<float,2>{0.139178053f, 0.682720721f},
-std::array<float,2>{0.304670066f, 0.484773159f},
-std::array<float,2>{0.956683159f, 0.982645988f},
-std::array<float,2>{0.90287745f, 0.141217545f},
-std::array<float,2>{0.337122202f, 0.617274761f},
-std::array<float,2>{0.22428447f, 0.328749627f},
-std::array<float,2>{0.749123991f, 0.850166023f},
-std::array<float,2>{0.522842646f, 0.416880906f},
-std::array<float,2>{0.0952576399f, 0.905575693f},
-std::array<float,2>{0.424027592f, 0.0870904326f},
-std::array<float,2>{0.838433564f, 0.716369927f},
-std::array<float,2>{0.978967369f, 0.448280483f},
-std::array<float,2>{0.250210404f, 0.946068048f},
-std::array<float,2>{0.169869795f, 0.0117018111f},
-std::array<float,2>{0.687230825f, 0.64729017f},
-std::array<float,2>{0.62281549f, 0.211246744f},
-std::array<float,2>{0.0509806536f, 0.527073026f},
-std::array<float,2>{0.470305741f, 0.254773587f},
-std::array<float,2>{0.776901007f, 0.759692848f},
-std::array<float,2>{0.851527154f, 0.116373897f},
-std::array<float,2>{0.389801681f, 0.744802177f},
-std::array<float,2>{0.0760212317f, 0.380844921f},
-std::array<float,2>{0.545427561f, 0.924489856f},
-std::array<float,2>{0.696262121f, 0.351958334f},
-std::array<float,2>{0.2048572f, 0.813797355f},
-std::array<float,2>{0.346326292f, 0.177005634f},
-std::array<float,2>{0.907090545f, 0.57012409f},
-std::array<float,2>{0.93288511f, 0.320233643f},
-std::array<float,2>{0.364370286f, 0.868686497f},
-std::array<float,2>{0.201664671f, 0.13076596f},
-std::array<float,2>{0.706676245f, 0.599589109f},
-std::array<float,2>{0.553082585f, 0.0672022849f},
-std::array<float,2>{0.0833459422f, 0.693121135f},
-std::array<float,2>{0.395279855f, 0.434866816f},
-std::array<float,2>{0.873310804f, 0.882303536f},
-std::array<float,2>{0.762700737f, 0.222822636f},
-std::array<float,2>{0.495044589f, 0.545202732f},
-std::array<float,2>{0.039252121f, 0.302759618f},
-std::array<float,2>{0.596084714f, 0.791972041f},
-std::array<float,2>{0.668560386f, 0.47015816f},
-std::array<float,2>{0.181310043f, 0.988216043f},
-std::array<float,2>{0.280190259f, 0.0466479883f},
-std::array<float,2>{0.999311268f, 0.667735338f},
-std::array<float,2>{0.827676892f, 0.397270471f},
-std::array<float,2>{0.413589954f, 0.919312418f},
-std::array<float,2>{0.11399769f, 0.0942342356f},
-std::array<float,2>{0.506967902f, 0.723202407f},
-std::array<float,2>{0.72223109f, 0.165978342f},
-std::array<float,2>{0.24794057f, 0.580168426f},
-std::array<float,2>{0.321636021f, 0.373114407f},
-std::array<float,2>{0.878508687f, 0.840160787f},
-std::array<float,2>{0.943741202f, 0.0282523166f},
-std::array<float,2>{0.283423901f, 0.63766253f},
-std::array<float,2>{0.149083734f, 0.466660887f},
-std::array<float,2>{0.636282504f, 0.961109281f},
-std::array<float,2>{0.582573175f, 0.270547926f},
-std::array<float,2>{0.00755597651f, 0.772126436f},
-std::array<float,2>{0.460014075f, 0.191309795f},
-std::array<float,2>{0.794554055f, 0.510357857f},
-std::array<float,2>{0.788555026f, 0.358931154f},
-std::array<float,2>{0.465820611f, 0.819050789f},
-std::array<float,2>{0.015593756f, 0.17417407f},
-std::array<float,2>{0.588740587f, 0.565066159f},
-std::array<float,2>{0.631869078f, 0.109649554f},
-std::array<float,2>{0.142071798f, 0.746527433f},
-std::array<float,2>{0.293517232f, 0.376844615f},
-std::array<float,2>{0.945889592f, 0.926469207f},
-std::array<float,2>{0.889513373f, 0.216084629f},
-std::array<float,2>{0.319865346f, 0.529226661f},
-std::array<float,2>{0.237014323f, 0.25164175f},
-std::array<float,2>{0.731359005f, 0.761820316f},
-std::array<float,2>{0.515386999f, 0.452706456f},
-std::array<float,2>{0.124819115f, 0.952483475f},
-std::array<float,2>{0.417980701f, 0.0135709709f},
-std::array<float,2>{0.815498948f, 0.643540442f},
-std::array<float,2>{0.986308157f, 0.418237716f},
-std::array<float,2>{0.269837081f, 0.898572564f},
-std::array<float,2>{0.174512699f, 0.0898808688f},
-std::array<float,2>{0.659932196f, 0.714722037f},
-std::array<float,2>{0.608136415f, 0.148037136f},
-std::array<float,2>{0.0339072272f, 0.622127354f},
-std::array<float,2>{0.490156472f, 0.333218187f},
-std::array<float,2>{0.754698813f, 0.846540034f},
-std::array<float,2>{0.866061866f, 0.061504133f},
-std::array<float,2>{0.400951415f, 0.683627248f},
-std::array<float,2>{0.0893101916f, 0.489395678f},
-std::array<float,2>{0.560778618f, 0.978731334f},
-std::array<float,2>{0.711296916f, 0.289698929f},
-std::array<float,2>{0.195109829f, 0.798158884f},
-std::array<float,2>{0.372100323f, 0.242559493f},
-std::array<float,2>{0.928715408f, 0.562049568f},
-std::array<float,2>{0.917211175f, 0.266195565f},
-std::array<float,2>{0.359126121f, 0.769106507f},
-std::array<float,2>{0.214359179f, 0.192306697f},
-std::array<float,2>{0.690744579f, 0.514354229f},
-std::array<float,2>{0.531892657f, 0.024679726f},
-std::array<float,2>{0.0677086189f, 0.633912683f},
-std::array<float,2>{0.378499895f, 0.463551939f},
-std::array<float,2>{0.858997643f, 0.966398597f},
-std::array<float,2>{0.772120595f, 0.16893515f},
-std::array<float,2>{0.482294112f, 0.582533777f},
-std::array<float,2>{0.0584017187f, 0.370093912f},
-std::array<float,2>{0.61035496f, 0.839731514f},
-std::array<float,2>{0.678308368f, 0.390754312f},
-std::array<float,2>{0.157286882f, 0.916940689f},
-std::array<float,2>{0.261936396f, 0.101311781f},
-std::array<float,2>{0.973043025f, 0.719068229f},
-std::array<float,2>{0.829476058f, 0.474377096f},
-std::array<float,2>{0.435983539f, 0.990545571f},
-std::array<float,2>{0.105307966f, 0.0422101766f},
-std::array<float,2>{0.530578613f, 0.670004547f},
-std::array<float,2>{0.740741551f, 0.220892057f},
-std::array<float,2>{0.22996296f, 0.541434109f},
-std::array<float,2>{0.335621208f, 0.299377948f},
-std::array<float,2>{0.893875301f, 0.79568553f},
-std::array<float,2>{0.962563872f, 0.0643019155f},
-std::array<float,2>{0.305965304f, 0.689261675f},
-std::array<float,2>{0.125962168f, 0.432890862f},
-std::array<float,2>{0.650117397f, 0.876579463f},
-std::array<float,2>{0.576643705f, 0.316399932f},
-std::array<float,2>{0.0292551462f, 0.874863327f},
-std::array<float,2>{0.446780384f, 0.125388131f},
-std::array<float,2>{0.811492324f, 0.594352603f},
-std::array<float,2>{0.845869839f, 0.310465425f},
-std::array<float,2>{0.382814437f, 0.781382561f},
-std::array<float,2>{0.0722461566f, 0.229561314f},
-std::array<float,2>{0.539339364f, 0.537541747f},
-std::array<float,2>{0.702311933f, 0.0361032858f},
-std::array<float,2>{0.207845017f, 0.658659518f},
-std::array<float,2>{0.348147064f, 0.478459626f},
-std::array<float,2>{0.911507964f, 0.993812323f},
-std::array<float,2>{0.98221916f, 0.134180367f},
-std::array<float,2>{0.255138338f, 0.606750011f},
-std::array<float,2>{0.166636452f, 0.324665546f},
-std::array<float,2>{0.680049658f, 0.860291243f},
-std::array<float,2>{0.617973387f, 0.423925906f},
-std::array<float,2>{0.0493347459f, 0.885009825f},
-std::array<float,2>{0.47519213f, 0.0736355335f},
-std::array<float,2>{0.778508484f, 0.697263896f},
-std::array<float,2>{0.899879038f, 0.458512276f},
-std::array<float,2>{0.342330396f, 0.955355346f},
-std::array<float,2>{0.218761832f, 0.0209752582f},
-std::array<float,2>{0.742210329f, 0.631918371f},
-std::array<float,2>{0.518251896f, 0.199095339f},
-std::array<float,2>{0.0995590463f, 0.506256282f},
-std::array<float,2>{0.427460462f, 0.279434204f},
-std::array<float,2>{0.842814922f, 0.780780554f},
-std::array<float,2>{0.800514519f, 0.105013035f},
-std::array<float,2>{0.439677656f, 0.72801882f},
-std::array<float,2>{0.017488433f, 0.398877174f},
-std::array<float,2>{0.564999104f, 0.909159064f},
-std::array<float,2>{0.647608757f, 0.364147127f},
-std::array<float,2>{0.135757178f, 0.829969525f},
-std::array<float,2>{0.299829394f, 0.163460165f},
-std::array<float,2>{0.960577071f, 0.590709329f},
-std::array<float,2>{0.93755734f, 0.343169838f},
-std::array<float,2>{0.286504328f, 0.852469623f},
-std::array<float,2>{0.154437095f, 0.152196199f},
-std::array<float,2>{0.638729036f, 0.610598266f},
-std::array<float,2>{0.581397593f, 0.0845456347f},
-std::array<float,2>{0.00186606217f, 0.708840728f},
-std::array<float,2>{0.454461068f, 0.413988262f},
-std::array<float,2>{0.791374207f, 0.894988477f},
-std::array<float,2>{0.822739422f, 0.23944369f},
-std::array<float,2>{0.408543497f, 0.548976183f},
-std::array<float,2>{0.112588696f, 0.285501957f},
-std::array<float,2>{0.501770616f, 0.809822977f},
-std::array<float,2>{0.726275206f, 0.498110086f},
-std::array<float,2>{0.243786499f, 0.975653648f},
-std::array<float,2>{0.327800333f, 0.0519040637f},
-std::array<float,2>{0.881437719f, 0.678266704f},
-std::array<float,2>{0.759175301f, 0.386020631f},
-std::array<float,2>{0.496528506f, 0.934941351f},
-std::array<float,2>{0.0451205596f, 0.124110498f},
-std::array<float,2>{0.599927425f, 0.73737663f},
-std::array<float,2>{0.666422248f, 0.18252936f},
-std::array<float,2>{0.183626011f, 0.576792359f},
-std::array<float,2>{0.277026594f, 0.35057947f},
-std::array<float,2>{0.993201911f, 0.826171696f},
-std::array<float,2>{0.936365485f, 0.000805994961f},
-std::array<float,2>{0.360700458f, 0.652204335f},
-std::array<float,2>{0.197357848f, 0.440650731f},
-std::array<float,2>{0.710236788f, 0.939230382f},
-std::array<float,2>{0.54711169f, 0.265616357f},
-std::array<float,2>{0.0797872841f, 0.756906927f},
-std::array<float,2>{0.391097277f, 0.203543961f},
-std::array<float,2>{0.869428337f, 0.521905065f},
-std::array<float,2>{0.819423378f, 0.324001968f},
-std::array<float,2>{0.415284216f, 0.865758598f},
-std::array<float,2>{0.118133411f, 0.139290974f},
-std::array<float,2>{0.508620441f, 0.602731347f},
-std::array<float,2>{0.728410184f, 0.0772899017f},
-std::array<float,2>{0.240652889f, 0.701308668f},
-std::array<float,2>{0.315184772f, 0.429531217f},
-std::array<float,2>{0.885559022f, 0.886952221f},
-std::array<float,2>{0.950565755f, 0.231854334f},
-std::array<float,2>{0.291313857f, 0.532668948f},
-std::array<float,2>{0.148167834f, 0.307897091f},
-std::array<float,2>{0.627163291f, 0.786587f},
-std::array<float,2>{0.593220174f, 0.48336646f},
-std::array<float,2>{0.0108722514f, 0.998546898f},
-std::array<float,2>{0.462062687f, 0.0336654745f},
-std::array<float,2>{0.784854114f, 0.661960065f},
-std::array<float,2>{0.925603867f, 0.403181225f},
-std::array<float,2>{0.367677391f, 0.913120925f},
-std::array<float,2>{0.191191375f, 0.106208347f},
-std::array<float,2>{0.715478241f, 0.732394814f},
-std::array<float,2>{0.555381119f, 0.158295766f},
-std::array<float,2>{0.0934675112f, 0.5885337f},
-std::array<float,2>{0.406238526f, 0.362926602f},
-std::array<float,2>{0.86180222f, 0.835615575f},
-std::array<float,2>{0.753305912f, 0.0193124749f},
-std::array<float,2>{0.48568061f, 0.625929058f},
-std::array<float,2>{0.036838036f, 0.453758478f},
-std::array<float,2>{0.60479188f, 0.958372414f},
-std::array<float,2>{0.663485944f, 0.276408404f},
-std::array<float,2>{0.17649591f, 0.776693463f},
-std::array<float,2>{0.269450575f, 0.19942008f},
-std::array<float,2>{0.991949439f, 0.501263678f},
-std::array<float,2>{0.970430493f, 0.284268856f},
-std::array<float,2>{0.259408474f, 0.806865275f},
-std::array<float,2>{0.161514103f, 0.235364005f},
-std::array<float,2>{0.675395608f, 0.551750839f},
-std::array<float,2>{0.613822877f, 0.0479054153f},
-std::array<float,2>{0.0586174317f, 0.673780382f},
-std::array<float,2>{0.476760805f, 0.492432475f},
-std::array<float,2>{0.769517958f, 0.972074866f},
-std::array<float,2>{0.851570606f, 0.15292789f},
-std::array<float,2>{0.380862385f, 0.614836633f},
-std::array<float,2>{0.0644411743f, 0.336461484f},
-std::array<float,2>{0.538651168f, 0.856105387f},
-std::array<float,2>{0.693498611f, 0.408741534f},
-std::array<float,2>{0.215748802f, 0.892221332f},
-std::array<float,2>{0.353367001f, 0.080391787f},
-std::array<float,2>{0.919188797f, 0.706432223f},
-std::array<float,2>{0.805428207f, 0.444499403f},
-std::array<float,2>{0.451369703f, 0.943846345f},
-std::array<float,2>{0.0256778821f, 0.00428877817f},
-std::array<float,2>{0.57333082f, 0.653066814f},
-std::array<float,2>{0.653395414f, 0.207432896f},
-std::array<float,2>{0.132620513f, 0.51824379f},
-std::array<float,2>{0.311772823f, 0.259444445f},
-std::array<float,2>{0.966847003f, 0.750970066f},
-std::array<float,2>{0.897612691f, 0.120693803f},
-std::array<float,2>{0.330379516f, 0.73916322f},
-std::array<float,2>{0.233059019f, 0.386806756f},
-std::array<float,2>{0.737897873f, 0.930172682f},
-std::array<float,2>{0.524211109f, 0.346490324f},
-std::array<float,2>{0.107000947f, 0.821286976f},
-std::array<float,2>{0.431930333f, 0.185969606f},
-std::array<float,2>{0.834729791f, 0.571219981f},
-std::array<float,2>{0.773521602f, 0.256636858f},
-std::array<float,2>{0.472098649f, 0.761417329f},
-std::array<float,2>{0.0546047948f, 0.214294776f},
-std::array<float,2>{0.62380296f, 0.52376318f},
-std::array<float,2>{0.685526192f, 0.00927311555f},
-std::array<float,2>{0.170026407f, 0.644832611f},
-std::array<float,2>{0.253524631f, 0.447122544f},
-std::array<float,2>{0.977905333f, 0.947282195f},
-std::array<float,2>{0.90851903f, 0.179066896f},
-std::array<float,2>{0.345396876f, 0.567072511f},
-std::array<float,2>{0.206025779f, 0.354877532f},
-std::array<float,2>{0.69784224f, 0.81507206f},
-std::array<float,2>{0.543890238f, 0.382303089f},
-std::array<float,2>{0.0775724649f, 0.923666537f},
-std::array<float,2>{0.387833923f, 0.114255622f},
-std::array<float,2>{0.848943412f, 0.744069457f},
-std::array<float,2>{0.954844534f, 0.487912744f},
-std::array<float,2>{0.302604616f, 0.981794775f},
-std::array<float,2>{0.137688428f, 0.0574995205f},
-std::array<float,2>{0.642984867f, 0.681307733f},
-std::array<float,2>{0.567857802f, 0.246278688f},
-std::array<float,2>{0.0204297621f, 0.556080997f},
-std::array<float,2>{0.442460477f, 0.295293093f},
-std::array<float,2>{0.804679573f, 0.803940356f},
-std::array<float,2>{0.836293876f, 0.0894696862f},
-std::array<float,2>{0.423766583f, 0.718470156f},
-std::array<float,2>{0.0972819924f, 0.415158778f},
-std::array<float,2>{0.521032155f, 0.903504968f},
-std::array<float,2>{0.74637115f, 0.330778867f},
-std::array<float,2>{0.226342633f, 0.848931372f},
-std::array<float,2>{0.339211136f, 0.143293932f},
-std::array<float,2>{0.905604422f, 0.621083796f},
-std::array<float,2>{0.87646848f, 0.371794522f},
-std::array<float,2>{0.323735505f, 0.842625916f},
-std::array<float,2>{0.249908015f, 0.167342782f},
-std::array<float,2>{0.719819486f, 0.578384101f},
-std::array<float,2>{0.505408466f, 0.0958672687f},
-std::array<float,2>{0.116079733f, 0.726211071f},
-std::array<float,2>{0.411929399f, 0.395134568f},
-std::array<float,2>{0.82560128f, 0.921159506f},
-std::array<float,2>{0.79683882f, 0.188190773f},
-std::array<float,2>{0.457445771f, 0.508184195f},
-std::array<float,2>{0.00570253422f, 0.272507668f},
-std::array<float,2>{0.585765123f, 0.770825207f},
-std::array<float,2>{0.632899821f, 0.466966122f},
-std::array<float,2>{0.150668785f, 0.963285506f},
-std::array<float,2>{0.283152074f, 0.0295849498f},
-std::array<float,2>{0.941732287f, 0.640435755f},
-std::array<float,2>{0.872109294f, 0.436475158f},
-std::array<float,2>{0.398039699f, 0.880482316f},
-std::array<float,2>{0.0842676461f, 0.0693643317f},
-std::array<float,2>{0.552712023f, 0.694445014f},
-std::array<float,2>{0.703473508f, 0.130955204f},
-std::array<float,2>{0.2002801f, 0.601403236f},
-std::array<float,2>{0.366614223f, 0.31683284f},
-std::array<float,2>{0.930807412f, 0.869342625f},
-std::array<float,2>{0.997083545f, 0.0448103547f},
-std::array<float,2>{0.278297752f, 0.665737927f},
-std::array<float,2>{0.181702092f, 0.472063124f},
-std::array<float,2>{0.670209944f, 0.985113025f},
-std::array<float,2>{0.595590711f, 0.302478462f},
-std::array<float,2>{0.041526448f, 0.790541291f},
-std::array<float,2>{0.493680924f, 0.225360051f},
-std::array<float,2>{0.765326977f, 0.543397069f},
-std::array<float,2>{0.761682808f, 0.350029916f},
-std::array<float,2>{0.499665797f, 0.825347841f},
-std::array<float,2>{0.0436310098f, 0.181760147f},
-std::array<float,2>{0.598457217f, 0.57626009f},
-std::array<float,2>{0.665080011f, 0.124989808f},
-std::array<float,2>{0.18687956f, 0.737882435f},
-std::array<float,2>{0.273934931f, 0.386430681f},
-std::array<float,2>{0.994637191f, 0.935530961f},
-std::array<float,2>{0.935139954f, 0.204049155f},
-std::array<float,2>{0.361528754f, 0.522114515f},
-std::array<float,2>{0.197223797f, 0.264781386f},
-std::array<float,2>{0.707764566f, 0.757365882f},
-std::array<float,2>{0.550511479f, 0.441187292f},
-std::array<float,2>{0.0804459304f, 0.938571393f},
-std::array<float,2>{0.393081605f, 0.000261092908f},
-std::array<float,2>{0.868056774f, 0.651478469f},
-std::array<float,2>{0.940338969f, 0.413375556f},
-std::array<float,2>{0.288933337f, 0.895327389f},
-std::array<float,2>{0.153584659f, 0.0840365589f},
-std::array<float,2>{0.637352407f, 0.708040357f},
-std::array<float,2>{0.580042005f, 0.151719332f},
-std::array<float,2>{0.00351542165f, 0.611040413f},
-std::array<float,2>{0.456194818f, 0.343728364f},
-std::array<float,2>{0.789678812f, 0.851830602f},
-std::array<float,2>{0.821738601f, 0.0526511036f},
-std::array<float,2>{0.407061487f, 0.678039014f},
-std::array<float,2>{0.109930746f, 0.498896539f},
-std::array<float,2>{0.502617002f, 0.976107299f},
-std::array<float,2>{0.724381328f, 0.285985887f},
-std::array<float,2>{0.24589321f, 0.810221374f},
-std::array<float,2>{0.32592231f, 0.239969939f},
-std::array<float,2>{0.879285097f, 0.549555182f},
-std::array<float,2>{0.902204931f, 0.280005574f},
-std::array<float,2>{0.340719461f, 0.780296147f},
-std::array<float,2>{0.221337676f, 0.198600456f},
-std::array<float,2>{0.744546592f, 0.506688476f},
-std::array<float,2>{0.516600668f, 0.0211453065f},
-std::array<float,2>{0.100009345f, 0.632715046f},
-std::array<float,2>{0.429440916f, 0.458080471f},
-std::array<float,2>{0.8417449f, 0.955838919f},
-std::array<float,2>{0.797621965f, 0.163792625f},
-std::array<float,2>{0.437567741f, 0.590132415f},
-std::array<float,2>{0.01779617f, 0.363598645f},
-std::array<float,2>{0.563775003f, 0.829388678f},
-std::array<float,2>{0.645612955f, 0.399321467f},
-std::array<float,2>{0.133323684f, 0.908549547f},
-std::array<float,2>{0.296887994f, 0.104622588f},
-std::array<float,2>{0.957551777f, 0.728252769f},
-std::array<float,2>{0.843972743f, 0.477827877f},
-std::array<float,2>{0.386178464f, 0.993475437f},
-std::array<float,2>{0.0740829781f, 0.0353797898f},
-std::array<float,2>{0.542243958f, 0.659050822f},
-std::array<float,2>{0.699660659f, 0.230211824f},
-std::array<float,2>{0.21064201f, 0.537740946f},
-std::array<float,2>{0.350049913f, 0.309890211f},
-std::array<float,2>{0.913530171f, 0.781786561f},
-std::array<float,2>{0.982942045f, 0.0737485886f},
-std::array<float,2>{0.2562747f, 0.696624756f},
-std::array<float,2>{0.164192215f, 0.424677074f},
-std::array<float,2>{0.683002532f, 0.885464728f},
-std::array<float,2>{0.61995852f, 0.325130165f},
-std::array<float,2>{0.0469256602f, 0.859682322f},
-std::array<float,2>{0.474110752f, 0.134413928f},
-std::array<float,2>{0.780772805f, 0.607164979f},
-std::array<float,2>{0.831891477f, 0.2992163f},
-std::array<float,2>{0.434916109f, 0.795353413f},
-std::array<float,2>{0.102471061f, 0.221343562f},
-std::array<float,2>{0.527769208f, 0.541846573f},
-std::array<float,2>{0.738748968f, 0.0427195393f},
-std::array<float,2>{0.228374615f, 0.670498252f},
-std::array<float,2>{0.33315289f, 0.473889649f},
-std::array<float,2>{0.890753269f, 0.990871668f},
-std::array<float,2>{0.964402795f, 0.125701368f},
-std::array<float,2>{0.307603508f, 0.593996823f},
-std::array<float,2>{0.127764478f, 0.315717578f},
-std::array<float,2>{0.651266217f, 0.874090075f},
-std::array<float,2>{0.574460149f, 0.433330923f},
-std::array<float,2>{0.0297898035f, 0.876130998f},
-std::array<float,2>{0.448416114f, 0.0634832829f},
-std::array<float,2>{0.808875978f, 0.688530862f},
-std::array<float,2>{0.915259957f, 0.463117838f},
-std::array<float,2>{0.35738942f, 0.965975165f},
-std::array<float,2>{0.212708279f, 0.0253737755f},
-std::array<float,2>{0.687681794f, 0.634696424f},
-std::array<float,2>{0.53437072f, 0.191729948f},
-std::array<float,2>{0.0684449971f, 0.514148593f},
-std::array<float,2>{0.376703173f, 0.266097128f},
-std::array<float,2>{0.856863856f, 0.769022882f},
-std::array<float,2>{0.769587457f, 0.101055965f},
-std::array<float,2>{0.483599246f, 0.719673693f},
-std::array<float,2>{0.0548153892f, 0.391238749f},
-std::array<float,2>{0.611384273f, 0.916228533f},
-std::array<float,2>{0.677253425f, 0.369151324f},
-std::array<float,2>{0.158743635f, 0.839090884f},
-std::array<float,2>{0.265336066f, 0.16815725f},
-std::array<float,2>{0.975385666f, 0.582183897f},
-std::array<float,2>{0.986526787f, 0.333621591f},
-std::array<float,2>{0.271982998f, 0.846025407f},
-std::array<float,2>{0.172684655f, 0.147548288f},
-std::array<float,2>{0.65675956f, 0.622990549f},
-std::array<float,2>{0.60576272f, 0.0904847309f},
-std::array<float,2>{0.0324535072f, 0.71411854f},
-std::array<float,2>{0.490869612f, 0.418636411f},
-std::array<float,2>{0.756222963f, 0.899220765f},
-std::array<float,2>{0.863937318f, 0.242977962f},
-std::array<float,2>{0.399261773f, 0.561544836f},
-std::array<float,2>{0.0864438117f, 0.289426744f},
-std::array<float,2>{0.560092211f, 0.798571527f},
-std::array<float,2>{0.714814067f, 0.489751637f},
-std::array<float,2>{0.192366421f, 0.979142249f},
-std::array<float,2>{0.373790056f, 0.0608506799f},
-std::array<float,2>{0.92650646f, 0.684171021f},
-std::array<float,2>{0.786332965f, 0.376015961f},
-std::array<float,2>{0.467521518f, 0.925938666f},
-std::array<float,2>{0.0132697085f, 0.109947376f},
-std::array<float,2>{0.586785376f, 0.746834636f},
-std::array<float,2>{0.630499661f, 0.174681634f},
-std::array<float,2>{0.143280223f, 0.564586878f},
-std::array<float,2>{0.295092821f, 0.358576894f},
-std::array<float,2>{0.947547197f, 0.818742394f},
-std::array<float,2>{0.887369633f, 0.0128331408f},
-std::array<float,2>{0.317535251f, 0.6427176f},
-std::array<float,2>{0.234744236f, 0.452279359f},
-std::array<float,2>{0.734005749f, 0.953106165f},
-std::array<float,2>{0.513620317f, 0.25108242f},
-std::array<float,2>{0.121864758f, 0.762682915f},
-std::array<float,2>{0.420294464f, 0.216374025f},
-std::array<float,2>{0.812857032f, 0.528690994f},
-std::array<float,2>{0.873697042f, 0.317139655f},
-std::array<float,2>{0.394533157f, 0.869682193f},
-std::array<float,2>{0.0836437047f, 0.13168098f},
-std::array<float,2>{0.553354502f, 0.600802124f},
-std::array<float,2>{0.706071198f, 0.0699619353f},
-std::array<float,2>{0.201246887f, 0.695188224f},
-std::array<float,2>{0.364947081f, 0.435572684f},
-std::array<float,2>{0.933402836f, 0.879979908f},
-std::array<float,2>{0.999790192f, 0.225045294f},
-std::array<float,2>{0.279522747f, 0.543469012f},
-std::array<float,2>{0.180970043f, 0.302164674f},
-std::array<float,2>{0.668209136f, 0.790134132f},
-std::array<float,2>{0.596228898f, 0.472399354f},
-std::array<float,2>{0.0398140363f, 0.984811425f},
-std::array<float,2>{0.49449715f, 0.0443574972f},
-std::array<float,2>{0.763242245f, 0.665080488f},
-std::array<float,2>{0.878158092f, 0.39488852f},
-std::array<float,2>{0.321968228f, 0.921586692f},
-std::array<float,2>{0.247478679f, 0.0964770764f},
-std::array<float,2>{0.722138226f, 0.726059914f},
-std::array<float,2>{0.50761795f, 0.167917639f},
-std::array<float,2>{0.113572486f, 0.578842938f},
-std::array<float,2>{0.413441867f, 0.371504098f},
-std::array<float,2>{0.82720542f, 0.841959774f},
-std::array<float,2>{0.793976367f, 0.029816363f},
-std::array<float,2>{0.460518152f, 0.639693677f},
-std::array<float,2>{0.00694768876f, 0.467649251f},
-std::array<float,2>{0.582369626f, 0.96358043f},
-std::array<float,2>{0.636124849f, 0.273260057f},
-std::array<float,2>{0.14876464f, 0.771032453f},
-std::array<float,2>{0.283908844f, 0.187812895f},
-std::array<float,2>{0.94389832f, 0.50833863f},
-std::array<float,2>{0.956275403f, 0.295464545f},
-std::array<float,2>{0.303896606f, 0.804484487f},
-std::array<float,2>{0.138752252f, 0.246851519f},
-std::array<float,2>{0.640899122f, 0.556182742f},
-std::array<float,2>{0.569749236f, 0.0568331219f},
-std::array<float,2>{0.0229033139f, 0.680827558f},
-std::array<float,2>{0.443366259f, 0.487307757f},
-std::array<float,2>{0.802056134f, 0.982163012f},
-std::array<float,2>{0.838052571f, 0.142825514f},
-std::array<float,2>{0.42460832f, 0.620407522f},
-std::array<float,2>{0.0947539583f, 0.330202341f},
-std::array<float,2>{0.52327925f, 0.849357903f},
-std::array<float,2>{0.749602199f, 0.415588558f},
-std::array<float,2>{0.22399056f, 0.904144228f},
-std::array<float,2>{0.337606162f, 0.0890113339f},
-std::array<float,2>{0.902569354f, 0.718144357f},
-std::array<float,2>{0.776456892f, 0.446586907f},
-std::array<float,2>{0.46975863f, 0.948060095f},
-std::array<float,2>{0.0516376421f, 0.00970420428f},
-std::array<float,2>{0.622180223f, 0.645405829f},
-std::array<float,2>{0.686542392f, 0.214543477f},
-std::array<float,2>{0.169130489f, 0.52434212f},
-std::array<float,2>{0.25066492f, 0.25609085f},
-std::array<float,2>{0.979480684f, 0.760790586f},
-std::array<float,2>{0.906468451f, 0.113427959f},
-std::array<float,2>{0.346100032f, 0.743193507f},
-std::array<float,2>{0.20423457f, 0.382524163f},
-std::array<float,2>{0.695755541f, 0.923142552f},
-std::array<float,2>{0.545409203f, 0.355183452f},
-std::array<float,2>{0.0754523948f, 0.814655542f},
-std::array<float,2>{0.390358895f, 0.17922473f},
-std::array<float,2>{0.850962818f, 0.566480756f},
-std::array<float,2>{0.808498621f, 0.25883323f},
-std::array<float,2>{0.450945169f, 0.750427842f},
-std::array<float,2>{0.024522623f, 0.207741112f},
-std::array<float,2>{0.570648253f, 0.517965436f},
-std::array<float,2>{0.654602945f, 0.00469671143f},
-std::array<float,2>{0.129252553f, 0.652397692f},
-std::array<float,2>{0.309922725f, 0.445201278f},
-std::array<float,2>{0.964982152f, 0.944021285f},
-std::array<float,2>{0.89545846f, 0.186037794f},
-std::array<float,2>{0.329065084f, 0.570798695f},
-std::array<float,2>{0.231226355f, 0.345868558f},
-std::array<float,2>{0.735762239f, 0.820319355f},
-std::array<float,2>{0.526691973f, 0.387217551f},
-std::array<float,2>{0.10873989f, 0.930189013f},
-std::array<float,2>{0.429856747f, 0.120272592f},
-std::array<float,2>{0.833609521f, 0.738431454f},
-std::array<float,2>{0.971097648f, 0.493035555f},
-std::array<float,2>{0.26016739f, 0.972618282f},
-std::array<float,2>{0.163404197f, 0.0484949648f},
-std::array<float,2>{0.672513485f, 0.673004448f},
-std::array<float,2>{0.617090106f, 0.235916749f},
-std::array<float,2>{0.0613076836f, 0.550847054f},
-std::array<float,2>{0.479867131f, 0.284721941f},
-std::array<float,2>{0.76618576f, 0.807581425f},
-std::array<float,2>{0.854884744f, 0.0806278437f},
-std::array<float,2>{0.378996223f, 0.706854761f},
-std::array<float,2>{0.0659220591f, 0.408429861f},
-std::array<float,2>{0.536724687f, 0.891928375f},
-std::array<float,2>{0.691776574f, 0.335989982f},
-std::array<float,2>{0.217924073f, 0.855520904f},
-std::array<float,2>{0.35379234f, 0.152430862f},
-std::array<float,2>{0.920685828f, 0.614594042f},
-std::array<float,2>{0.922701418f, 0.36251986f},
-std::array<float,2>{0.370488763f, 0.835053086f},
-std::array<float,2>{0.189175352f, 0.159079432f},
-std::array<float,2>{0.716797352f, 0.588182807f},
-std::array<float,2>{0.558318973f, 0.105703853f},
-std::array<float,2>{0.0903726891f, 0.731917024f},
-std::array<float,2>{0.403659344f, 0.402640849f},
-std::array<float,2>{0.859447956f, 0.913995087f},
-std::array<float,2>{0.75011158f, 0.199829429f},
-std::array<float,2>{0.487711161f, 0.501814127f},
-std::array<float,2>{0.0384151787f, 0.27700752f},
-std::array<float,2>{0.602034688f, 0.776964247f},
-std::array<float,2>{0.661000252f, 0.453593075f},
-std::array<float,2>{0.178525403f, 0.95872575f},
-std::array<float,2>{0.267520666f, 0.0186418183f},
-std::array<float,2>{0.989565492f, 0.625119746f},
-std::array<float,2>{0.8175928f, 0.428952336f},
-std::array<float,2>{0.416176081f, 0.887480617f},
-std::array<float,2>{0.119884625f, 0.0779262632f},
-std::array<float,2>{0.51053077f, 0.701673746f},
-std::array<float,2>{0.729829848f, 0.138902321f},
-std::array<float,2>{0.239233896f, 0.603258371f},
-std::array<float,2>{0.31342271f, 0.32328552f},
-std::array<float,2>{0.883788526f, 0.86547482f},
-std::array<float,2>{0.952921987f, 0.0338948518f},
-std::array<float,2>{0.290744632f, 0.661286175f},
-std::array<float,2>{0.144780666f, 0.482557803f},
-std::array<float,2>{0.626323521f, 0.998344004f},
-std::array<float,2>{0.590805769f, 0.308382481f},
-std::array<float,2>{0.00970197935f, 0.786638498f},
-std::array<float,2>{0.463367283f, 0.232228443f},
-std::array<float,2>{0.782222748f, 0.533198178f},
-std::array<float,2>{0.791770816f, 0.340647578f},
-std::array<float,2>{0.45489946f, 0.855428576f},
-std::array<float,2>{0.00142446242f, 0.149091378f},
-std::array<float,2>{0.581715167f, 0.611483574f},
-std::array<float,2>{0.639305413f, 0.0831044465f},
-std::array<float,2>{0.15499635f, 0.710078239f},
-std::array<float,2>{0.286839455f, 0.411935776f},
-std::array<float,2>{0.938180089f, 0.89761281f},
-std::array<float,2>{0.881321073f, 0.241935447f},
-std::array<float,2>{0.327610433f, 0.547903061f},
-std::array<float,2>{0.243232191f, 0.28888002f},
-std::array<float,2>{0.725710928f, 0.811402917f},
-std::array<float,2>{0.501248181f, 0.497023135f},
-std::array<float,2>{0.113196462f, 0.973348439f},
-std::array<float,2>{0.409041196f, 0.0532473065f},
-std::array<float,2>{0.823132098f, 0.676929653f},
-std::array<float,2>{0.994021535f, 0.384377867f},
-std::array<float,2>{0.276587784f, 0.936717808f},
-std::array<float,2>{0.184463844f, 0.122117721f},
-std::array<float,2>{0.666868746f, 0.734561563f},
-std::array<float,2>{0.600496233f, 0.180259943f},
-std::array<float,2>{0.0457343087f, 0.574294388f},
-std::array<float,2>{0.497016639f, 0.348947138f},
-std::array<float,2>{0.759405375f, 0.827928603f},
-std::array<float,2>{0.869760215f, 0.0037256889f},
-std::array<float,2>{0.391599357f, 0.64927727f},
-std::array<float,2>{0.0794593394f, 0.438855678f},
-std::array<float,2>{0.547442853f, 0.940407753f},
-std::array<float,2>{0.710542917f, 0.262145758f},
-std::array<float,2>{0.198003396f, 0.754588783f},
-std::array<float,2>{0.36086911f, 0.205771253f},
-std::array<float,2>{0.935656071f, 0.520869613f},
-std::array<float,2>{0.911950588f, 0.311252654f},
-std::array<float,2>{0.347702265f, 0.784272254f},
-std::array<float,2>{0.207230076f, 0.227684051f},
-std::array<float,2>{0.70296818f, 0.53581357f},
-std::array<float,2>{0.539906263f, 0.0384624489f},
-std::array<float,2>{0.0713643879f, 0.657040119f},
-std::array<float,2>{0.383406729f, 0.480246216f},
-std::array<float,2>{0.846372366f, 0.995943427f},
-std::array<float,2>{0.779019237f, 0.136465773f},
-std::array<float,2>{0.475073457f, 0.608892322f},
-std::array<float,2>{0.0491926596f, 0.327666223f},
-std::array<float,2>{0.617206573f, 0.862813592f},
-std::array<float,2>{0.680532157f, 0.422378004f},
-std::array<float,2>{0.166441008f, 0.883066237f},
-std::array<float,2>{0.255676091f, 0.0706241727f},
-std::array<float,2>{0.981500149f, 0.699083924f},
-std::array<float,2>{0.843583167f, 0.45936209f},
-std::array<float,2>{0.426773161f, 0.953835428f},
-std::array<float,2>{0.0986632109f, 0.0228502993f},
-std::array<float,2>{0.517686486f, 0.629451752f},
-std::array<float,2>{0.74286902f, 0.196546718f},
-std::array<float,2>{0.219339311f, 0.50411123f},
-std::array<float,2>{0.341834813f, 0.279197246f},
-std::array<float,2>{0.900044322f, 0.778057277f},
-std::array<float,2>{0.960293293f, 0.102648593f},
-std::array<float,2>{0.300682545f, 0.729930937f},
-std::array<float,2>{0.13645418f, 0.401061028f},
-std::array<float,2>{0.648419917f, 0.908202648f},
-std::array<float,2>{0.564776361f, 0.366328716f},
-std::array<float,2>{0.0170301385f, 0.830701709f},
-std::array<float,2>{0.440380901f, 0.161875784f},
-std::array<float,2>{0.800285041f, 0.593539476f},
-std::array<float,2>{0.858476996f, 0.269273341f},
-std::array<float,2>{0.378136694f, 0.766497195f},
-std::array<float,2>{0.0680086091f, 0.194392741f},
-std::array<float,2>{0.531325519f, 0.511897981f},
-std::array<float,2>{0.69136554f, 0.0261461493f},
-std::array<float,2>{0.214069411f, 0.636263728f},
-std::array<float,2>{0.358788043f, 0.462422878f},
-std::array<float,2>{0.917577744f, 0.967858255f},
-std::array<float,2>{0.973156035f, 0.17149432f},
-std::array<float,2>{0.262248188f, 0.584021866f},
-std::array<float,2>{0.158043802f, 0.368886977f},
-std::array<float,2>{0.677810967f, 0.835992157f},
-std::array<float,2>{0.610961676f, 0.393683106f},
-std::array<float,2>{0.057993345f, 0.91552937f},
-std::array<float,2>{0.481775492f, 0.0978160799f},
-std::array<float,2>{0.771948338f, 0.722300947f},
-std::array<float,2>{0.894472837f, 0.475998759f},
-std::array<float,2>{0.335365474f, 0.988787174f},
-std::array<float,2>{0.230238229f, 0.0399843976f},
-std::array<float,2>{0.740649879f, 0.669556439f},
-std::array<float,2>{0.531123281f, 0.220221177f},
-std::array<float,2>{0.104608826f, 0.540825963f},
-std::array<float,2>{0.436040789f, 0.297043234f},
-std::array<float,2>{0.83004719f, 0.794350564f},
-std::array<float,2>{0.810606122f, 0.0650853738f},
-std::array<float,2>{0.446665525f, 0.690965414f},
-std::array<float,2>{0.0283637028f, 0.430843115f},
-std::array<float,2>{0.576970458f, 0.878207803f},
-std::array<float,2>{0.649540007f, 0.313810647f},
-std::array<float,2>{0.125313908f, 0.87291652f},
-std::array<float,2>{0.306579381f, 0.128436953f},
-std::array<float,2>{0.962264299f, 0.597463071f},
-std::array<float,2>{0.945761383f, 0.355895638f},
-std::array<float,2>{0.293412805f, 0.816585422f},
-std::array<float,2>{0.142404661f, 0.172149509f},
-std::array<float,2>{0.632327139f, 0.563404977f},
-std::array<float,2>{0.588108003f, 0.112228133f},
-std::array<float,2>{0.0150256753f, 0.748586774f},
-std::array<float,2>{0.466379493f, 0.377839804f},
-std::array<float,2>{0.788909733f, 0.929037094f},
-std::array<float,2>{0.8161273f, 0.217712298f},
-std::array<float,2>{0.418819785f, 0.529728949f},
-std::array<float,2>{0.124098554f, 0.253109574f},
-std::array<float,2>{0.515039563f, 0.764248192f},
-std::array<float,2>{0.730744481f, 0.44977966f},
-std::array<float,2>{0.236402705f, 0.950314403f},
-std::array<float,2>{0.319654703f, 0.0148145501f},
-std::array<float,2>{0.889120579f, 0.641824365f},
-std::array<float,2>{0.754272521f, 0.420439452f},
-std::array<float,2>{0.489445478f, 0.902054489f},
-std::array<float,2>{0.0332395658f, 0.093126893f},
-std::array<float,2>{0.607498169f, 0.712710202f},
-std::array<float,2>{0.659457922f, 0.145637199f},
-std::array<float,2>{0.173866123f, 0.623233736f},
-std::array<float,2>{0.270294636f, 0.335898131f},
-std::array<float,2>{0.985484064f, 0.845350802f},
-std::array<float,2>{0.929611802f, 0.0599301048f},
-std::array<float,2>{0.3726165f, 0.68626529f},
-std::array<float,2>{0.194608405f, 0.49047628f},
-std::array<float,2>{0.711556435f, 0.976955712f},
-std::array<float,2>{0.561451733f, 0.292715967f},
-std::array<float,2>{0.0895670354f, 0.799994171f},
-std::array<float,2>{0.400473028f, 0.244478434f},
-std::array<float,2>{0.865241408f, 0.559018731f},
-std::array<float,2>{0.825857699f, 0.373627603f},
-std::array<float,2>{0.411182046f, 0.840472281f},
-std::array<float,2>{0.115607873f, 0.165319011f},
-std::array<float,2>{0.505340874f, 0.580595434f},
-std::array<float,2>{0.72027874f, 0.0947206095f},
-std::array<float,2>{0.249050498f, 0.72295332f},
-std::array<float,2>{0.32359919f, 0.396730721f},
-std::array<float,2>{0.876172841f, 0.919593096f},
-std::array<float,2>{0.941941202f, 0.190455019f},
-std::array<float,2>{0.282616913f, 0.509921134f},
-std::array<float,2>{0.15091899f, 0.271282524f},
-std::array<float,2>{0.633323073f, 0.771536291f},
-std::array<float,2>{0.585113287f, 0.466132492f},
-std::array<float,2>{0.0049471641f, 0.961442649f},
-std::array<float,2>{0.457696497f, 0.027807381f},
-std::array<float,2>{0.796233952f, 0.636964023f},
-std::array<float,2>{0.931405008f, 0.435192883f},
-std::array<float,2>{0.367064595f, 0.882501602f},
-std::array<float,2>{0.20097886f, 0.0664135143f},
-std::array<float,2>{0.70368278f, 0.692700624f},
-std::array<float,2>{0.551853955f, 0.130232796f},
-std::array<float,2>{0.0846548006f, 0.598820925f},
-std::array<float,2>{0.397941947f, 0.319717854f},
-std::array<float,2>{0.87294358f, 0.868181705f},
-std::array<float,2>{0.765130401f, 0.0461434983f},
-std::array<float,2>{0.493530363f, 0.667226791f},
-std::array<float,2>{0.0411040634f, 0.47061336f},
-std::array<float,2>{0.594927728f, 0.987588346f},
-std::array<float,2>{0.670505941f, 0.303339124f},
-std::array<float,2>{0.182356715f, 0.791474283f},
-std::array<float,2>{0.277413279f, 0.223510802f},
-std::array<float,2>{0.997702897f, 0.545893848f},
-std::array<float,2>{0.978258491f, 0.254362851f},
-std::array<float,2>{0.253299296f, 0.758935332f},
-std::array<float,2>{0.170431569f, 0.211815104f},
-std::array<float,2>{0.684926033f, 0.526724994f},
-std::array<float,2>{0.623122096f, 0.011011444f},
-std::array<float,2>{0.053861849f, 0.64686352f},
-std::array<float,2>{0.472548574f, 0.448992372f},
-std::array<float,2>{0.774327457f, 0.945329309f},
-std::array<float,2>{0.849415541f, 0.177315295f},
-std::array<float,2>{0.388643563f, 0.569358647f},
-std::array<float,2>{0.0779845566f, 0.352424264f},
-std::array<float,2>{0.54330653f, 0.81419605f},
-std::array<float,2>{0.697676957f, 0.380137473f},
-std::array<float,2>{0.205134019f, 0.924179256f},
-std::array<float,2>{0.344762743f, 0.11695902f},
-std::array<float,2>{0.909053922f, 0.744410455f},
-std::array<float,2>{0.803868592f, 0.485262215f},
-std::array<float,2>{0.443309098f, 0.983371437f},
-std::array<float,2>{0.0198871717f, 0.0566146299f},
-std::array<float,2>{0.568060458f, 0.683127999f},
-std::array<float,2>{0.643385112f, 0.24892652f},
-std::array<float,2>{0.137160107f, 0.557854772f},
-std::array<float,2>{0.302086055f, 0.292999804f},
-std::array<float,2>{0.954326391f, 0.801087022f},
-std::array<float,2>{0.906089425f, 0.0878716633f},
-std::array<float,2>{0.339691103f, 0.716103017f},
-std::array<float,2>{0.225629553f, 0.416190863f},
-std::array<float,2>{0.746832073f, 0.906039834f},
-std::array<float,2>{0.520535767f, 0.328318328f},
-std::array<float,2>{0.0970000923f, 0.849815309f},
-std::array<float,2>{0.423303068f, 0.140829548f},
-std::array<float,2>{0.836653233f, 0.617945313f},
-std::array<float,2>{0.768998921f, 0.281493813f},
-std::array<float,2>{0.477137655f, 0.80605185f},
-std::array<float,2>{0.0595232919f, 0.237658724f},
-std::array<float,2>{0.61368531f, 0.55379349f},
-std::array<float,2>{0.675203145f, 0.0504866987f},
-std::array<float,2>{0.161769658f, 0.674356699f},
-std::array<float,2>{0.258822024f, 0.494933724f},
-std::array<float,2>{0.969822645f, 0.969243467f},
-std::array<float,2>{0.919697285f, 0.155049995f},
-std::array<float,2>{0.352570742f, 0.616082668f},
-std::array<float,2>{0.214890853f, 0.338380516f},
-std::array<float,2>{0.69397223f, 0.858330607f},
-std::array<float,2>{0.538365841f, 0.407051116f},
-std::array<float,2>{0.0638701916f, 0.893920958f},
-std::array<float,2>{0.381732702f, 0.0784689859f},
-std::array<float,2>{0.85219264f, 0.703275263f},
-std::array<float,2>{0.96742177f, 0.442303181f},
-std::array<float,2>{0.312020332f, 0.942856729f},
-std::array<float,2>{0.132288143f, 0.00671327068f},
-std::array<float,2>{0.65389663f, 0.65502882f},
-std::array<float,2>{0.574015975f, 0.209974095f},
-std::array<float,2>{0.0262885988f, 0.517143965f},
-std::array<float,2>{0.451842755f, 0.260099322f},
-std::array<float,2>{0.805049539f, 0.753398061f},
-std::array<float,2>{0.83439064f, 0.118894868f},
-std::array<float,2>{0.432494074f, 0.741693616f},
-std::array<float,2>{0.106572643f, 0.390231043f},
-std::array<float,2>{0.523451447f, 0.931973159f},
-std::array<float,2>{0.737386167f, 0.344686866f},
-std::array<float,2>{0.232754573f, 0.823826969f},
-std::array<float,2>{0.3306849f, 0.185003504f},
-std::array<float,2>{0.898369014f, 0.573384643f},
-std::array<float,2>{0.88518405f, 0.320710808f},
-std::array<float,2>{0.314612061f, 0.864101648f},
-std::array<float,2>{0.240791425f, 0.136983037f},
-std::array<float,2>{0.727699876f, 0.604013264f},
-std::array<float,2>{0.508012593f, 0.0747389719f},
-std::array<float,2>{0.117278524f, 0.700640678f},
-std::array<float,2>{0.415819257f, 0.426098198f},
-std::array<float,2>{0.820035517f, 0.889529049f},
-std::array<float,2>{0.784204721f, 0.232707366f},
-std::array<float,2>{0.462878406f, 0.533971667f},
-std::array<float,2>{0.0113683715f, 0.306387216f},
-std::array<float,2>{0.593747258f, 0.788535655f},
-std::array<float,2>{0.627593935f, 0.480946511f},
-std::array<float,2>{0.147808447f, 0.997944891f},
-std::array<float,2>{0.291946977f, 0.0313744694f},
-std::array<float,2>{0.951060653f, 0.662394762f},
-std::array<float,2>{0.862192333f, 0.405508041f},
-std::array<float,2>{0.405483872f, 0.910821319f},
-std::array<float,2>{0.0928298905f, 0.108731546f},
-std::array<float,2>{0.555024862f, 0.733463585f},
-std::array<float,2>{0.715123832f, 0.157897711f},
-std::array<float,2>{0.19064422f, 0.586251199f},
-std::array<float,2>{0.367573768f, 0.360469609f},
-std::array<float,2>{0.924853027f, 0.832123578f},
-std::array<float,2>{0.991465688f, 0.0169982426f},
-std::array<float,2>{0.269003898f, 0.627595007f},
-std::array<float,2>{0.176017806f, 0.455254436f},
-std::array<float,2>{0.663934827f, 0.959752619f},
-std::array<float,2>{0.605033457f, 0.273475409f},
-std::array<float,2>{0.0363107398f, 0.775019944f},
-std::array<float,2>{0.485909969f, 0.203044146f},
-std::array<float,2>{0.753902316f, 0.503625035f},
-std::array<float,2>{0.779929399f, 0.326997489f},
-std::array<float,2>{0.472919613f, 0.861592174f},
-std::array<float,2>{0.0478861891f, 0.135712162f},
-std::array<float,2>{0.620978355f, 0.608039141f},
-std::array<float,2>{0.682171464f, 0.0720820278f},
-std::array<float,2>{0.16552797f, 0.698055744f},
-std::array<float,2>{0.257032126f, 0.423486322f},
-std::array<float,2>{0.983549356f, 0.883868515f},
-std::array<float,2>{0.912447453f, 0.22701107f},
-std::array<float,2>{0.350788236f, 0.536653459f},
-std::array<float,2>{0.209229395f, 0.31153366f},
-std::array<float,2>{0.701067448f, 0.783287525f},
-std::array<float,2>{0.541197121f, 0.479319811f},
-std::array<float,2>{0.0724399835f, 0.994411409f},
-std::array<float,2>{0.385675281f, 0.0372505002f},
-std::array<float,2>{0.845649958f, 0.657840252f},
-std::array<float,2>{0.95805037f, 0.40143773f},
-std::array<float,2>{0.298799425f, 0.906471252f},
-std::array<float,2>{0.134156585f, 0.10220132f},
-std::array<float,2>{0.644991755f, 0.728931129f},
-std::array<float,2>{0.563061357f, 0.160552099f},
-std::array<float,2>{0.0195001755f, 0.592684746f},
-std::array<float,2>{0.438680857f, 0.365320921f},
-std::array<float,2>{0.798797846f, 0.831817031f},
-std::array<float,2>{0.840195298f, 0.0223250184f},
-std::array<float,2>{0.427977473f, 0.630666137f},
-std::array<float,2>{0.100901112f, 0.460505098f},
-std::array<float,2>{0.517560661f, 0.954990804f},
-std::array<float,2>{0.74560672f, 0.27742371f},
-std::array<float,2>{0.222163439f, 0.779241621f},
-std::array<float,2>{0.341105938f, 0.195839852f},
-std::array<float,2>{0.90082258f, 0.505063057f},
-std::array<float,2>{0.880100667f, 0.288051635f},
-std::array<float,2>{0.3243514f, 0.812477946f},
-std::array<float,2>{0.244207442f, 0.240945503f},
-std::array<float,2>{0.722849011f, 0.547725916f},
-std::array<float,2>{0.503903866f, 0.0543379821f},
-std::array<float,2>{0.11061123f, 0.676230729f},
-std::array<float,2>{0.407243043f, 0.497145623f},
-std::array<float,2>{0.821119726f, 0.97435832f},
-std::array<float,2>{0.790624917f, 0.150265902f},
-std::array<float,2>{0.455684483f, 0.612523615f},
-std::array<float,2>{0.00257216743f, 0.341257066f},
-std::array<float,2>{0.579060674f, 0.854336798f},
-std::array<float,2>{0.637972832f, 0.410905242f},
-std::array<float,2>{0.152734667f, 0.897103369f},
-std::array<float,2>{0.287166178f, 0.0820394754f},
-std::array<float,2>{0.940800607f, 0.709375262f},
-std::array<float,2>{0.868395448f, 0.438317567f},
-std::array<float,2>{0.393900096f, 0.940620005f},
-std::array<float,2>{0.0814922675f, 0.00279693119f},
-std::array<float,2>{0.549131989f, 0.649539709f},
-std::array<float,2>{0.708367825f, 0.206491575f},
-std::array<float,2>{0.196282595f, 0.520376027f},
-std::array<float,2>{0.363036603f, 0.26292029f},
-std::array<float,2>{0.934533715f, 0.754912376f},
-std::array<float,2>{0.995939434f, 0.121402852f},
-std::array<float,2>{0.275358021f, 0.735939562f},
-std::array<float,2>{0.185956508f, 0.383753181f},
-std::array<float,2>{0.664203227f, 0.935933471f},
-std::array<float,2>{0.598926663f, 0.348466843f},
-std::array<float,2>{0.044330772f, 0.826480985f},
-std::array<float,2>{0.498759091f, 0.181140676f},
-std::array<float,2>{0.760268092f, 0.576117098f},
-std::array<float,2>{0.814228952f, 0.252210677f},
-std::array<float,2>{0.421305448f, 0.764811456f},
-std::array<float,2>{0.122451492f, 0.217845827f},
-std::array<float,2>{0.512366951f, 0.530715346f},
-std::array<float,2>{0.732435226f, 0.0143411858f},
-std::array<float,2>{0.235390306f, 0.641313851f},
-std::array<float,2>{0.317167401f, 0.450699121f},
-std::array<float,2>{0.887760282f, 0.949434638f},
-std::array<float,2>{0.948767424f, 0.173591375f},
-std::array<float,2>{0.29665041f, 0.564169347f},
-std::array<float,2>{0.143924296f, 0.3566643f},
-std::array<float,2>{0.62915796f, 0.817682207f},
-std::array<float,2>{0.587364972f, 0.378891289f},
-std::array<float,2>{0.0124368863f, 0.92797929f},
-std::array<float,2>{0.46784845f, 0.113180943f},
-std::array<float,2>{0.785706937f, 0.749398589f},
-std::array<float,2>{0.927722871f, 0.491878897f},
-std::array<float,2>{0.374751389f, 0.97799772f},
-std::array<float,2>{0.192800194f, 0.0587753691f},
-std::array<float,2>{0.713025093f, 0.687300324f},
-std::array<float,2>{0.55886066f, 0.246064529f},
-std::array<float,2>{0.0869763196f, 0.559759617f},
-std::array<float,2>{0.399470419f, 0.29192856f},
-std::array<float,2>{0.864486217f, 0.799314201f},
-std::array<float,2>{0.757208586f, 0.092067115f},
-std::array<float,2>{0.491478145f, 0.711080551f},
-std::array<float,2>{0.0317253433f, 0.421870172f},
-std::array<float,2>{0.606985152f, 0.900600791f},
-std::array<float,2>{0.657403767f, 0.334081411f},
-std::array<float,2>{0.173426703f, 0.843859851f},
-std::array<float,2>{0.272620559f, 0.145287558f},
-std::array<float,2>{0.988238454f, 0.624240994f},
-std::array<float,2>{0.975679278f, 0.367238492f},
-std::array<float,2>{0.263807505f, 0.837456584f},
-std::array<float,2>{0.159537137f, 0.17087312f},
-std::array<float,2>{0.676687777f, 0.585398316f},
-std::array<float,2>{0.612315357f, 0.0995286405f},
-std::array<float,2>{0.0565697476f, 0.721476853f},
-std::array<float,2>{0.483364314f, 0.392887205f},
-std::array<float,2>{0.770696044f, 0.914728165f},
-std::array<float,2>{0.855999589f, 0.194249257f},
-std::array<float,2>{0.37538293f, 0.51349324f},
-std::array<float,2>{0.069865033f, 0.26836887f},
-std::array<float,2>{0.533878744f, 0.767142355f},
-std::array<float,2>{0.688742399f, 0.460994244f},
-std::array<float,2>{0.211614668f, 0.967020631f},
-std::array<float,2>{0.356167108f, 0.0272586457f},
-std::array<float,2>{0.914517164f, 0.635239184f},
-std::array<float,2>{0.809754491f, 0.430294394f},
-std::array<float,2>{0.448091388f, 0.877297103f},
-std::array<float,2>{0.030798357f, 0.0660431087f},
-std::array<float,2>{0.575840712f, 0.6899634f},
-std::array<float,2>{0.652052581f, 0.127159849f},
-std::array<float,2>{0.128787011f, 0.596262097f},
-std::array<float,2>{0.307906032f, 0.312673897f},
-std::array<float,2>{0.963472426f, 0.87128526f},
-std::array<float,2>{0.892305434f, 0.0407060422f},
-std::array<float,2>{0.332985461f, 0.668674052f},
-std::array<float,2>{0.226742059f, 0.475441605f},
-std::array<float,2>{0.740030885f, 0.990006268f},
-std::array<float,2>{0.528888524f, 0.298746258f},
-std::array<float,2>{0.103103042f, 0.793485343f},
-std::array<float,2>{0.434502006f, 0.219720989f},
-std::array<float,2>{0.830557048f, 0.539214551f},
-std::array<float,2>{0.849748015f, 0.353003412f},
-std::array<float,2>{0.389359325f, 0.813470423f},
-std::array<float,2>{0.0747649372f, 0.175795555f},
-std::array<float,2>{0.546704471f, 0.568691134f},
-std::array<float,2>{0.696661174f, 0.115910359f},
-std::array<float,2>{0.203131944f, 0.745662451f},
-std::array<float,2>{0.347377658f, 0.378979802f},
-std::array<float,2>{0.907243848f, 0.92543596f},
-std::array<float,2>{0.980018198f, 0.212473363f},
-std::array<float,2>{0.251467973f, 0.525955498f},
-std::array<float,2>{0.168825671f, 0.255593032f},
-std::array<float,2>{0.68642658f, 0.75816381f},
-std::array<float,2>{0.621116281f, 0.447780281f},
-std::array<float,2>{0.0519631803f, 0.94681555f},
-std::array<float,2>{0.469609976f, 0.0103438459f},
-std::array<float,2>{0.775950432f, 0.647686064f},
-std::array<float,2>{0.904117465f, 0.41751796f},
-std::array<float,2>{0.336229295f, 0.905250371f},
-std::array<float,2>{0.223012671f, 0.0867606699f},
-std::array<float,2>{0.748714864f, 0.715809643f},
-std::array<float,2>{0.521948397f, 0.142323151f},
-std::array<float,2>{0.0939766094f, 0.618184447f},
-std::array<float,2>{0.42563799f, 0.329194188f},
-std::array<float,2>{0.839500606f, 0.850928485f},
-std::array<float,2>{0.801710904f, 0.0550743379f},
-std::array<float,2>{0.44522652f, 0.681863308f},
-std::array<float,2>{0.0224052798f, 0.486267418f},
-std::array<float,2>{0.568724155f, 0.983985543f},
-std::array<float,2>{0.641928673f, 0.294024259f},
-std::array<float,2>{0.139652655f, 0.802694559f},
-std::array<float,2>{0.302752078f, 0.249134511f},
-std::array<float,2>{0.955405593f, 0.557121575f},
-std::array<float,2>{0.944657862f, 0.270344079f},
-std::array<float,2>{0.284704864f, 0.773110569f},
-std::array<float,2>{0.150388613f, 0.189774111f},
-std::array<float,2>{0.635007024f, 0.511535287f},
-std::array<float,2>{0.583845615f, 0.0286760665f},
-std::array<float,2>{0.00654422631f, 0.637748301f},
-std::array<float,2>{0.45906505f, 0.465816498f},
-std::array<float,2>{0.793455839f, 0.96246767f},
-std::array<float,2>{0.826353073f, 0.164581537f},
-std::array<float,2>{0.412318885f, 0.582024157f},
-std::array<float,2>{0.114902273f, 0.374971867f},
-std::array<float,2>{0.506684661f, 0.841240466f},
-std::array<float,2>{0.721532881f, 0.398210704f},
-std::array<float,2>{0.246392995f, 0.917999506f},
-std::array<float,2>{0.3209894f, 0.095541425f},
-std::array<float,2>{0.877297521f, 0.723720133f},
-std::array<float,2>{0.762383401f, 0.469579488f},
-std::array<float,2>{0.495394528f, 0.986622095f},
-std::array<float,2>{0.0408043526f, 0.0454688109f},
-std::array<float,2>{0.597219288f, 0.666868746f},
-std::array<float,2>{0.669552743f, 0.223866642f},
-std::array<float,2>{0.179719776f, 0.546624184f},
-std::array<float,2>{0.281097591f, 0.304504752f},
-std::array<float,2>{0.998377621f, 0.792265773f},
-std::array<float,2>{0.931799293f, 0.0675963387f},
-std::array<float,2>{0.364211738f, 0.692147374f},
-std::array<float,2>{0.203009292f, 0.434513092f},
-std::array<float,2>{0.705430865f, 0.881258667f},
-std::array<float,2>{0.554357708f, 0.318936706f},
-std::array<float,2>{0.0821976736f, 0.867560327f},
-std::array<float,2>{0.395529449f, 0.129279032f},
-std::array<float,2>{0.87407726f, 0.597840667f},
-std::array<float,2>{0.782920659f, 0.304745167f},
-std::array<float,2>{0.464104563f, 0.787645936f},
-std::array<float,2>{0.00823038537f, 0.233980134f},
-std::array<float,2>{0.591580212f, 0.535075963f},
-std::array<float,2>{0.625886083f, 0.0329199582f},
-std::array<float,2>{0.146364406f, 0.663532078f},
-std::array<float,2>{0.289086878f, 0.481549352f},
-std::array<float,2>{0.951211154f, 0.99636215f},
-std::array<float,2>{0.88454175f, 0.138398394f},
-std::array<float,2>{0.314383477f, 0.60529238f},
-std::array<float,2>{0.239495397f, 0.322108746f},
-std::array<float,2>{0.728967726f, 0.86428076f},
-std::array<float,2>{0.511601627f, 0.427142859f},
-std::array<float,2>{0.121041849f, 0.890438676f},
-std::array<float,2>{0.417753249f, 0.0758179575f},
-std::array<float,2>{0.816952109f, 0.699918807f},
-std::array<float,2>{0.988592267f, 0.456157535f},
-std::array<float,2>{0.266338348f, 0.960018814f},
-std::array<float,2>{0.178718135f, 0.0164431538f},
-std::array<float,2>{0.661477983f, 0.628450692f},
-std::array<float,2>{0.602828205f, 0.2011749f},
-std::array<float,2>{0.0373202935f, 0.502372324f},
-std::array<float,2>{0.486700714f, 0.274605036f},
-std::array<float,2>{0.751544118f, 0.773775697f},
-std::array<float,2>{0.861185014f, 0.108154252f},
-std::array<float,2>{0.403107017f, 0.733066142f},
-std::array<float,2>{0.0909547806f, 0.405136406f},
-std::array<float,2>{0.556920767f, 0.911561072f},
-std::array<float,2>{0.717876136f, 0.360066116f},
-std::array<float,2>{0.187758714f, 0.833425164f},
-std::array<float,2>{0.369601458f, 0.156535164f},
-std::array<float,2>{0.923502982f, 0.587133467f},
-std::array<float,2>{0.921044827f, 0.339213282f},
-std::array<float,2>{0.355336994f, 0.859018624f},
-std::array<float,2>{0.217601433f, 0.155493826f},
-std::array<float,2>{0.692523003f, 0.61700958f},
-std::array<float,2>{0.535379529f, 0.0798124373f},
-std::array<float,2>{0.0650253147f, 0.704467654f},
-std::array<float,2>{0.380583018f, 0.407757491f},
-std::array<float,2>{0.854078293f, 0.893070281f},
-std::array<float,2>{0.76667583f, 0.23684293f},
-std::array<float,2>{0.479261041f, 0.552920759f},
-std::array<float,2>{0.0621750467f, 0.283100486f},
-std::array<float,2>{0.615537584f, 0.805215597f},
-std::array<float,2>{0.67359823f, 0.495396614f},
-std::array<float,2>{0.162332579f, 0.970433176f},
-std::array<float,2>{0.261139035f, 0.0497136563f},
-std::array<float,2>{0.971680939f, 0.675062239f},
-std::array<float,2>{0.832302094f, 0.389123321f},
-std::array<float,2>{0.431537867f, 0.932778239f},
-std::array<float,2>{0.107988939f, 0.117935337f},
-std::array<float,2>{0.526114047f, 0.740359247f},
-std::array<float,2>{0.734718561f, 0.183976695f},
-std::array<float,2>{0.232281923f, 0.573085487f},
-std::array<float,2>{0.329933822f, 0.345008016f},
-std::array<float,2>{0.895772696f, 0.82315439f},
-std::array<float,2>{0.966122389f, 0.00740147289f},
-std::array<float,2>{0.309393972f, 0.655842423f},
-std::array<float,2>{0.130616695f, 0.442976445f},
-std::array<float,2>{0.655315876f, 0.941688001f},
-std::array<float,2>{0.571635187f, 0.260899812f},
-std::array<float,2>{0.0243574716f, 0.752658427f},
-std::array<float,2>{0.450188637f, 0.209165588f},
-std::array<float,2>{0.807583451f, 0.515995681f},
-std::array<float,2>{0.798965216f, 0.364473939f},
-std::array<float,2>{0.440847993f, 0.828500271f},
-std::array<float,2>{0.0159454867f, 0.162937909f},
-std::array<float,2>{0.56585747f, 0.591097713f},
-std::array<float,2>{0.647303879f, 0.103903994f},
-std::array<float,2>{0.135483086f, 0.727443159f},
-std::array<float,2>{0.299172193f, 0.400174797f},
-std::array<float,2>{0.959395647f, 0.90993017f},
-std::array<float,2>{0.898864329f, 0.197677195f},
-std::array<float,2>{0.343034267f, 0.507744431f},
-std::array<float,2>{0.220104203f, 0.28092429f},
-std::array<float,2>{0.74373275f, 0.77982527f},
-std::array<float,2>{0.519462407f, 0.45712775f},
-std::array<float,2>{0.097947821f, 0.956519425f},
-std::array<float,2>{0.426373392f, 0.0198050234f},
-std::array<float,2>{0.842646599f, 0.630977213f},
-std::array<float,2>{0.981303871f, 0.42507863f},
-std::array<float,2>{0.254846871f, 0.886357784f},
-std::array<float,2>{0.167521432f, 0.0729330331f},
-std::array<float,2>{0.681085885f, 0.696176946f},
-std::array<float,2>{0.618267715f, 0.13350974f},
-std::array<float,2>{0.0506680161f, 0.606246948f},
-std::array<float,2>{0.476447523f, 0.325637043f},
-std::array<float,2>{0.777912498f, 0.860799432f},
-std::array<float,2>{0.847655952f, 0.03664295f},
-std::array<float,2>{0.384373158f, 0.659529984f},
-std::array<float,2>{0.0705005378f, 0.477303118f},
-std::array<float,2>{0.54073143f, 0.992362976f},
-std::array<float,2>{0.701192856f, 0.309137613f},
-std::array<float,2>{0.208871752f, 0.782929778f},
-std::array<float,2>{0.348927259f, 0.228740633f},
-std::array<float,2>{0.9108693f, 0.538877368f},
-std::array<float,2>{0.936989963f, 0.264306337f},
-std::array<float,2>{0.359722823f, 0.756657898f},
-std::array<float,2>{0.198699549f, 0.204489529f},
-std::array<float,2>{0.709049404f, 0.523295999f},
-std::array<float,2>{0.548395693f, 0.00180451374f},
-std::array<float,2>{0.078337729f, 0.650866866f},
-std::array<float,2>{0.391642421f, 0.439554781f},
-std::array<float,2>{0.870229661f, 0.937955022f},
-std::array<float,2>{0.758635998f, 0.183035165f},
-std::array<float,2>{0.49718979f, 0.577889144f},
-std::array<float,2>{0.0459202826f, 0.350766271f},
-std::array<float,2>{0.601034939f, 0.82486999f},
-std::array<float,2>{0.667337179f, 0.385654598f},
-std::array<float,2>{0.184822053f, 0.934149027f},
-std::array<float,2>{0.276366323f, 0.123621561f},
-std::array<float,2>{0.992933333f, 0.73725915f},
-std::array<float,2>{0.82379508f, 0.499457002f},
-std::array<float,2>{0.409580499f, 0.975410402f},
-std::array<float,2>{0.112000138f, 0.0507977791f},
-std::array<float,2>{0.500792444f, 0.678928971f},
-std::array<float,2>{0.724642575f, 0.239001766f},
-std::array<float,2>{0.242547616f, 0.550225377f},
-std::array<float,2>{0.327063769f, 0.286273241f},
-std::array<float,2>{0.882232368f, 0.809219778f},
-std::array<float,2>{0.9386549f, 0.0853226408f},
-std::array<float,2>{0.285724193f, 0.707698643f},
-std::array<float,2>{0.156024382f, 0.412255168f},
-std::array<float,2>{0.640375197f, 0.896459103f},
-std::array<float,2>{0.580923855f, 0.342239201f},
-std::array<float,2>{0.000164467594f, 0.853126287f},
-std::array<float,2>{0.453903317f, 0.15050754f},
-std::array<float,2>{0.792316079f, 0.609399259f},
-std::array<float,2>{0.86660856f, 0.290141284f},
-std::array<float,2>{0.401841998f, 0.797406256f},
-std::array<float,2>{0.0888145715f, 0.244124055f},
-std::array<float,2>{0.562158823f, 0.560877144f},
-std::array<float,2>{0.712085485f, 0.0616359673f},
-std::array<float,2>{0.193449035f, 0.684808791f},
-std::array<float,2>{0.371716052f, 0.488751829f},
-std::array<float,2>{0.927749574f, 0.980095148f},
-std::array<float,2>{0.984401107f, 0.146794468f},
-std::array<float,2>{0.271157026f, 0.621326029f},
-std::array<float,2>{0.17483148f, 0.332714915f},
-std::array<float,2>{0.658204854f, 0.847470522f},
-std::array<float,2>{0.609332383f, 0.41895318f},
-std::array<float,2>{0.0348599553f, 0.90009439f},
-std::array<float,2>{0.489065051f, 0.0912468508f},
-std::array<float,2>{0.754966199f, 0.713707268f},
-std::array<float,2>{0.88979733f, 0.452015162f},
-std::array<float,2>{0.318806857f, 0.951879025f},
-std::array<float,2>{0.238193229f, 0.0119396718f},
-std::array<float,2>{0.732307374f, 0.643617749f},
-std::array<float,2>{0.514370918f, 0.215715691f},
-std::array<float,2>{0.123729818f, 0.527658939f},
-std::array<float,2>{0.419638962f, 0.250837177f},
-std::array<float,2>{0.814889371f, 0.763606966f},
-std::array<float,2>{0.787528098f, 0.110574648f},
-std::array<float,2>{0.46506539f, 0.747875452f},
-std::array<float,2>{0.0145732509f, 0.375062525f},
-std::array<float,2>{0.589754522f, 0.927222311f},
-std::array<float,2>{0.631475091f, 0.357599914f},
-std::array<float,2>{0.141238868f, 0.819778919f},
-std::array<float,2>{0.294007391f, 0.175599098f},
-std::array<float,2>{0.946575105f, 0.566249371f},
-std::array<float,2>{0.961764812f, 0.315364361f},
-std::array<float,2>{0.304920822f, 0.873114169f},
-std::array<float,2>{0.126185656f, 0.126721993f},
-std::array<float,2>{0.649119198f, 0.595283449f},
-std::array<float,2>{0.577162981f, 0.0627695322f},
-std::array<float,2>{0.0273507517f, 0.688251913f},
-std::array<float,2>{0.446088731f, 0.431714833f},
-std::array<float,2>{0.811975837f, 0.875554919f},
-std::array<float,2>{0.828496277f, 0.222158983f},
-std::array<float,2>{0.437108189f, 0.542558014f},
-std::array<float,2>{0.103923202f, 0.300717682f},
-std::array<float,2>{0.530181527f, 0.796135068f},
-std::array<float,2>{0.741863251f, 0.473234236f},
-std::array<float,2>{0.229352862f, 0.99165231f},
-std::array<float,2>{0.334902197f, 0.041906856f},
-std::array<float,2>{0.892885387f, 0.671614945f},
-std::array<float,2>{0.773116648f, 0.392139345f},
-std::array<float,2>{0.481288135f, 0.917777896f},
-std::array<float,2>{0.0567077249f, 0.100290231f},
-std::array<float,2>{0.609774411f, 0.719958603f},
-std::array<float,2>{0.679085433f, 0.169684678f},
-std::array<float,2>{0.15649268f, 0.583328605f},
-std::array<float,2>{0.262809902f, 0.370746851f},
-std::array<float,2>{0.974447429f, 0.838540137f},
-std::array<float,2>{0.916175604f, 0.0242709443f},
-std::array<float,2>{0.358350158f, 0.633668303f},
-std::array<float,2>{0.213139042f, 0.464509606f},
-std::array<float,2>{0.690350831f, 0.965814769f},
-std::array<float,2>{0.532239318f, 0.266636848f},
-std::array<float,2>{0.0669367239f, 0.768340707f},
-std::array<float,2>{0.377771825f, 0.192427218f},
-std::array<float,2>{0.858135879f, 0.514953315f},
-std::array<float,2>{0.837537944f, 0.331426471f},
-std::array<float,2>{0.422769725f, 0.848273098f},
-std::array<float,2>{0.09577398f, 0.144131407f},
-std::array<float,2>{0.520326436f, 0.619898081f},
-std::array<float,2>{0.747163355f, 0.0885969549f},
-std::array<float,2>{0.225127041f, 0.717646837f},
-std::array<float,2>{0.337922662f, 0.414452791f},
-std::array<float,2>{0.904697001f, 0.902864158f},
-std::array<float,2>{0.95346874f, 0.247701973f},
-std::array<float,2>{0.301221609f, 0.555409551f},
-std::array<float,2>{0.138062507f, 0.296784788f},
-std::array<float,2>{0.643921137f, 0.803162038f},
-std::array<float,2>{0.567183912f, 0.486997873f},
-std::array<float,2>{0.0209049769f, 0.980650246f},
-std::array<float,2>{0.441555738f, 0.0578156337f},
-std::array<float,2>{0.802743614f, 0.680265963f},
-std::array<float,2>{0.909722328f, 0.381513655f},
-std::array<float,2>{0.343888819f, 0.922133386f},
-std::array<float,2>{0.206549823f, 0.115150876f},
-std::array<float,2>{0.699112058f, 0.742441654f},
-std::array<float,2>{0.544121206f, 0.177976072f},
-std::array<float,2>{0.0768241733f, 0.567471623f},
-std::array<float,2>{0.387537003f, 0.354060829f},
-std::array<float,2>{0.848364294f, 0.815956235f},
-std::array<float,2>{0.775130033f, 0.00834733341f},
-std::array<float,2>{0.471098751f, 0.645816028f},
-std::array<float,2>{0.0529066697f, 0.446059912f},
-std::array<float,2>{0.624523878f, 0.948844671f},
-std::array<float,2>{0.684350133f, 0.25755468f},
-std::array<float,2>{0.171594307f, 0.760303259f},
-std::array<float,2>{0.251958549f, 0.212984145f},
-std::array<float,2>{0.97671771f, 0.524624884f},
-std::array<float,2>{0.996492386f, 0.301245153f},
-std::array<float,2>{0.279072255f, 0.789751053f},
-std::array<float,2>{0.183214903f, 0.226504982f},
-std::array<float,2>{0.671560407f, 0.543992639f},
-std::array<float,2>{0.593750358f, 0.0431016497f},
-std::array<float,2>{0.0426833369f, 0.664598465f},
-std::array<float,2>{0.4927935f, 0.471059293f},
-std::array<float,2>{0.76403594f, 0.985714793f},
-std::array<float,2>{0.871494114f, 0.132521719f},
-std::array<float,2>{0.396617681f, 0.600340605f},
-std::array<float,2>{0.0855090991f, 0.318243772f},
-std::array<float,2>{0.551298618f, 0.870853484f},
-std::array<float,2>{0.704863429f, 0.437328607f},
-std::array<float,2>{0.199587211f, 0.879486799f},
-std::array<float,2>{0.365243912f, 0.0692008212f},
-std::array<float,2>{0.929945529f, 0.693964124f},
-std::array<float,2>{0.795478523f, 0.468369067f},
-std::array<float,2>{0.458884984f, 0.96441406f},
-std::array<float,2>{0.00453816401f, 0.0311554782f},
-std::array<float,2>{0.584677637f, 0.638878107f},
-std::array<float,2>{0.634221673f, 0.189450592f},
-std::array<float,2>{0.151758105f, 0.509643555f},
-std::array<float,2>{0.281443536f, 0.272088289f},
-std::array<float,2>{0.942503929f, 0.769789636f},
-std::array<float,2>{0.875930369f, 0.096849747f},
-std::array<float,2>{0.322495967f, 0.725296795f},
-std::array<float,2>{0.24893406f, 0.396194547f},
-std::array<float,2>{0.718823493f, 0.920651555f},
-std::array<float,2>{0.504374743f, 0.372190535f},
-std::array<float,2>{0.116659686f, 0.842815757f},
-std::array<float,2>{0.410259128f, 0.166729346f},
-std::array<float,2>{0.825154662f, 0.579795003f},
-std::array<float,2>{0.752254546f, 0.275967151f},
-std::array<float,2>{0.485309631f, 0.776245952f},
-std::array<float,2>{0.0353366882f, 0.200865939f},
-std::array<float,2>{0.604218543f, 0.500282228f},
-std::array<float,2>{0.662349343f, 0.0184418987f},
-std::array<float,2>{0.177337974f, 0.626901686f},
-std::array<float,2>{0.268146634f, 0.454457968f},
-std::array<float,2>{0.990996182f, 0.957246602f},
-std::array<float,2>{0.92470026f, 0.159916744f},
-std::array<float,2>{0.36909315f, 0.589704096f},
-std::array<float,2>{0.189521968f, 0.361745805f},
-std::array<float,2>{0.716413379f, 0.834869921f},
-std::array<float,2>{0.556179762f, 0.404289067f},
-std::array<float,2>{0.0921783373f, 0.912537873f},
-std::array<float,2>{0.404970169f, 0.107223138f},
-std::array<float,2>{0.863068521f, 0.731081307f},
-std::array<float,2>{0.949356198f, 0.484178394f},
-std::array<float,2>{0.292715788f, 0.999056816f},
-std::array<float,2>{0.146745622f, 0.0343587883f},
-std::array<float,2>{0.6288504f, 0.660191655f},
-std::array<float,2>{0.592365563f, 0.230763733f},
-std::array<float,2>{0.0102895815f, 0.532187641f},
-std::array<float,2>{0.461792588f, 0.307588875f},
-std::array<float,2>{0.783310294f, 0.78582257f},
-std::array<float,2>{0.819171071f, 0.0762221515f},
-std::array<float,2>{0.414196253f, 0.702898145f},
-std::array<float,2>{0.118602999f, 0.428182125f},
-std::array<float,2>{0.50894165f, 0.888256848f},
-std::array<float,2>{0.727530301f, 0.322295934f},
-std::array<float,2>{0.241518542f, 0.867183924f},
-std::array<float,2>{0.315833807f, 0.139985219f},
-std::array<float,2>{0.886232018f, 0.602099121f},
-std::array<float,2>{0.897258878f, 0.347170681f},
-std::array<float,2>{0.331713319f, 0.821320474f},
-std::array<float,2>{0.234121293f, 0.186627224f},
-std::array<float,2>{0.736568928f, 0.572098494f},
-std::array<float,2>{0.525089025f, 0.119413376f},
-std::array<float,2>{0.105595194f, 0.739620924f},
-std::array<float,2>{0.43306312f, 0.387858182f},
-std::array<float,2>{0.835144758f, 0.930672169f},
-std::array<float,2>{0.806168795f, 0.20807144f},
-std::array<float,2>{0.452989072f, 0.519218266f},
-std::array<float,2>{0.0269922409f, 0.258456469f},
-std::array<float,2>{0.573167384f, 0.751249015f},
-std::array<float,2>{0.652987659f, 0.443686545f},
-std::array<float,2>{0.131047875f, 0.944444597f},
-std::array<float,2>{0.311298311f, 0.00564622972f},
-std::array<float,2>{0.967777967f, 0.653331935f},
-std::array<float,2>{0.853274703f, 0.40983364f},
-std::array<float,2>{0.382070482f, 0.891471088f},
-std::array<float,2>{0.0625005215f, 0.0815081224f},
-std::array<float,2>{0.537118614f, 0.706023574f},
-std::array<float,2>{0.694961429f, 0.153973356f},
-std::array<float,2>{0.216538265f, 0.61338383f},
-std::array<float,2>{0.352068156f, 0.337746948f},
-std::array<float,2>{0.918903947f, 0.857155204f},
-std::array<float,2>{0.969277799f, 0.0475426652f},
-std::array<float,2>{0.258611768f, 0.672500074f},
-std::array<float,2>{0.160167128f, 0.49391672f},
-std::array<float,2>{0.674241006f, 0.970959723f},
-std::array<float,2>{0.614484429f, 0.283604652f},
-std::array<float,2>{0.060414955f, 0.807654858f},
-std::array<float,2>{0.477576762f, 0.234655857f},
-std::array<float,2>{0.767956316f, 0.552318037f}}
\ No newline at end of file
@@ -1,4096 +0,0 @@
-{std::array<float,2>{0.77197057f, 0.159965158f},
-std::array<float,2>{0.314040244f, 0.67355293f},
-std::array<float,2>{0.690257668f, 0.943677008f},
-std::array<float,2>{0.150954336f, 0.3202838f},
-std::array<float,2>{0.608072758f, 0.43829456f},
-std::array<float,2>{0.0308462977f, 0.846367657f},
-std::array<float,2>{0.915859938f, 0.564904273f},
-std::array<float,2>{0.464850903f, 0.001398828f},
-std::array<float,2>{0.658550978f, 0.124799967f},
-std::array<float,2>{0.192445666f, 0.560391545f},
-std::array<float,2>{0.835187674f, 0.774763405f},
-std::array<float,2>{0.310155869f, 0.426224977f},
-std::array<float,2>{0.96169275f, 0.306921542f},
-std::array<float,2>{0.408992112f, 0.891240597f},
-std::array<float,2>{0.50170666f, 0.741198599f},
-std::array<float,2>{0.0860660747f, 0.195111245f},
-std::array<float,2>{0.898931146f, 0.0340967216f},
-std::array<float,2>{0.48938024f, 0.617756546f},
-std::array<float,2>{0.581528842f, 0.814896822f},
-std::array<float,2>{0.0607516803f, 0.474117756f},
-std::array<float,2>{0.730308771f, 0.366954833f},
-std::array<float,2>{0.183420539f, 0.975749314f},
-std::array<float,2>{0.808517575f, 0.651080668f},
-std::array<float,2>{0.369700938f, 0.127716586f},
-std::array<float,2>{0.543814301f, 0.239771008f},
-std::array<float,2>{0.103566647f, 0.70950532f},
-std::array<float,2>{0.996800959f, 0.912479341f},
-std::array<float,2>{0.390047371f, 0.251506925f},
-std::array<float,2>{0.866660178f, 0.380274892f},
-std::array<float,2>{0.280828565f, 0.798157513f},
-std::array<float,2>{0.63187623f, 0.511099279f},
-std::array<float,2>{0.225920379f, 0.0685440749f},
-std::array<float,2>{0.981165051f, 0.210816771f},
-std::array<float,2>{0.403405428f, 0.732184052f},
-std::array<float,2>{0.553277016f, 0.887428045f},
-std::array<float,2>{0.115482084f, 0.281545043f},
-std::array<float,2>{0.646293283f, 0.412100345f},
-std::array<float,2>{0.247436956f, 0.764310241f},
-std::array<float,2>{0.854835153f, 0.544116139f},
-std::array<float,2>{0.258954972f, 0.0992053449f},
-std::array<float,2>{0.567924857f, 0.0293904133f},
-std::array<float,2>{0.04672952f, 0.582915843f},
-std::array<float,2>{0.884535789f, 0.862414777f},
-std::array<float,2>{0.481861711f, 0.46214658f},
-std::array<float,2>{0.787852824f, 0.336271703f},
-std::array<float,2>{0.348257929f, 0.966915488f},
-std::array<float,2>{0.749606788f, 0.658668935f},
-std::array<float,2>{0.170145899f, 0.176484674f},
-std::array<float,2>{0.812609315f, 0.0935509279f},
-std::array<float,2>{0.284188986f, 0.523530364f},
-std::array<float,2>{0.680796742f, 0.796448052f},
-std::array<float,2>{0.20570904f, 0.402812362f},
-std::array<float,2>{0.525089443f, 0.266714394f},
-std::array<float,2>{0.0668648109f, 0.929915369f},
-std::array<float,2>{0.937884927f, 0.700128376f},
-std::array<float,2>{0.433902293f, 0.227370694f},
-std::array<float,2>{0.70539701f, 0.151066348f},
-std::array<float,2>{0.133894324f, 0.626333177f},
-std::array<float,2>{0.760130405f, 0.985671043f},
-std::array<float,2>{0.337261647f, 0.35930267f},
-std::array<float,2>{0.927571118f, 0.491428882f},
-std::array<float,2>{0.451503277f, 0.839347064f},
-std::array<float,2>{0.611381292f, 0.597307563f},
-std::array<float,2>{0.00834878068f, 0.0550041497f},
-std::array<float,2>{0.847638369f, 0.221973613f},
-std::array<float,2>{0.254898816f, 0.695198894f},
-std::array<float,2>{0.649404228f, 0.923736453f},
-std::array<float,2>{0.236835882f, 0.274378836f},
-std::array<float,2>{0.55833298f, 0.395931125f},
-std::array<float,2>{0.120781943f, 0.784469724f},
-std::array<float,2>{0.975868285f, 0.516880691f},
-std::array<float,2>{0.397930503f, 0.0793703273f},
-std::array<float,2>{0.740778625f, 0.0506425165f},
-std::array<float,2>{0.162742525f, 0.603184462f},
-std::array<float,2>{0.796789408f, 0.830237389f},
-std::array<float,2>{0.353856772f, 0.494787663f},
-std::array<float,2>{0.877490938f, 0.350503534f},
-std::array<float,2>{0.471977025f, 0.999585152f},
-std::array<float,2>{0.577730238f, 0.632833362f},
-std::array<float,2>{0.0324891023f, 0.144507661f},
-std::array<float,2>{0.945454478f, 0.102727555f},
-std::array<float,2>{0.427363455f, 0.531873047f},
-std::array<float,2>{0.51891613f, 0.753315449f},
-std::array<float,2>{0.0757767633f, 0.420349509f},
-std::array<float,2>{0.679122031f, 0.289588213f},
-std::array<float,2>{0.216368437f, 0.877625644f},
-std::array<float,2>{0.824233353f, 0.721816063f},
-std::array<float,2>{0.292410195f, 0.216467515f},
-std::array<float,2>{0.624603271f, 0.183114052f},
-std::array<float,2>{0.00205794303f, 0.664484203f},
-std::array<float,2>{0.933195949f, 0.958542585f},
-std::array<float,2>{0.443669856f, 0.329744369f},
-std::array<float,2>{0.755782962f, 0.45516786f},
-std::array<float,2>{0.332774162f, 0.871360004f},
-std::array<float,2>{0.711256146f, 0.593707979f},
-std::array<float,2>{0.127314895f, 0.0213450789f},
-std::array<float,2>{0.906549513f, 0.135493487f},
-std::array<float,2>{0.457683116f, 0.64180249f},
-std::array<float,2>{0.594220638f, 0.97764653f},
-std::array<float,2>{0.021634372f, 0.371570349f},
-std::array<float,2>{0.695837021f, 0.477095515f},
-std::array<float,2>{0.141716495f, 0.824491382f},
-std::array<float,2>{0.777468383f, 0.614292443f},
-std::array<float,2>{0.320622891f, 0.0393265188f},
-std::array<float,2>{0.514391184f, 0.0705505386f},
-std::array<float,2>{0.0817825049f, 0.502098739f},
-std::array<float,2>{0.956825972f, 0.805137515f},
-std::array<float,2>{0.420420527f, 0.387097776f},
-std::array<float,2>{0.837225139f, 0.260806203f},
-std::array<float,2>{0.297863483f, 0.914727926f},
-std::array<float,2>{0.668012023f, 0.716028452f},
-std::array<float,2>{0.198307708f, 0.246225342f},
-std::array<float,2>{0.802707136f, 0.0104500679f},
-std::array<float,2>{0.359549224f, 0.571196198f},
-std::array<float,2>{0.721151292f, 0.852559328f},
-std::array<float,2>{0.179410547f, 0.452604741f},
-std::array<float,2>{0.586755276f, 0.326271802f},
-std::array<float,2>{0.053644713f, 0.949903905f},
-std::array<float,2>{0.895356953f, 0.684562504f},
-std::array<float,2>{0.492285669f, 0.171812803f},
-std::array<float,2>{0.636065125f, 0.202318132f},
-std::array<float,2>{0.229248032f, 0.745888293f},
-std::array<float,2>{0.867663026f, 0.903424621f},
-std::array<float,2>{0.269045204f, 0.303881198f},
-std::array<float,2>{0.988012433f, 0.43642959f},
-std::array<float,2>{0.375901967f, 0.766833901f},
-std::array<float,2>{0.532255709f, 0.549156725f},
-std::array<float,2>{0.0977798253f, 0.114757434f},
-std::array<float,2>{0.831938744f, 0.147990063f},
-std::array<float,2>{0.307513803f, 0.637809455f},
-std::array<float,2>{0.660878062f, 0.994139671f},
-std::array<float,2>{0.18925181f, 0.344376862f},
-std::array<float,2>{0.50648737f, 0.498020709f},
-std::array<float,2>{0.0930822417f, 0.835210979f},
-std::array<float,2>{0.967295706f, 0.606744945f},
-std::array<float,2>{0.412457854f, 0.0520337075f},
-std::array<float,2>{0.69284904f, 0.0824822783f},
-std::array<float,2>{0.155967966f, 0.522037268f},
-std::array<float,2>{0.768337846f, 0.787515223f},
-std::array<float,2>{0.316918164f, 0.394446492f},
-std::array<float,2>{0.919544697f, 0.277575016f},
-std::array<float,2>{0.463343769f, 0.928256333f},
-std::array<float,2>{0.60545224f, 0.689066768f},
-std::array<float,2>{0.0266534481f, 0.224457681f},
-std::array<float,2>{0.99449569f, 0.0189439058f},
-std::array<float,2>{0.383880287f, 0.586026192f},
-std::array<float,2>{0.54047662f, 0.868774295f},
-std::array<float,2>{0.10676977f, 0.460832983f},
-std::array<float,2>{0.627330661f, 0.332059264f},
-std::array<float,2>{0.222297654f, 0.953495264f},
-std::array<float,2>{0.861384809f, 0.671808481f},
-std::array<float,2>{0.276131749f, 0.186058298f},
-std::array<float,2>{0.585690141f, 0.212508544f},
-std::array<float,2>{0.0567865036f, 0.722801745f},
-std::array<float,2>{0.906024992f, 0.882380605f},
-std::array<float,2>{0.48627612f, 0.29659465f},
-std::array<float,2>{0.810459614f, 0.415335059f},
-std::array<float,2>{0.37328124f, 0.755080462f},
-std::array<float,2>{0.734197378f, 0.537126541f},
-std::array<float,2>{0.184480578f, 0.106038392f},
-std::array<float,2>{0.888737917f, 0.242193237f},
-std::array<float,2>{0.479004741f, 0.711966872f},
-std::array<float,2>{0.566130459f, 0.918389499f},
-std::array<float,2>{0.0413242392f, 0.261742324f},
-std::array<float,2>{0.745721996f, 0.38460055f},
-std::array<float,2>{0.167174578f, 0.810898542f},
-std::array<float,2>{0.784243464f, 0.506139219f},
-std::array<float,2>{0.344273776f, 0.0746115074f},
-std::array<float,2>{0.549342632f, 0.0467390977f},
-std::array<float,2>{0.112821408f, 0.6106354f},
-std::array<float,2>{0.978667378f, 0.824204624f},
-std::array<float,2>{0.402051121f, 0.484222442f},
-std::array<float,2>{0.856963754f, 0.367918491f},
-std::array<float,2>{0.261747956f, 0.980689704f},
-std::array<float,2>{0.641905189f, 0.645461798f},
-std::array<float,2>{0.243465424f, 0.140463635f},
-std::array<float,2>{0.762645006f, 0.109878436f},
-std::array<float,2>{0.342442542f, 0.552721441f},
-std::array<float,2>{0.708170533f, 0.771755338f},
-std::array<float,2>{0.140595987f, 0.430563241f},
-std::array<float,2>{0.613934457f, 0.300419629f},
-std::array<float,2>{0.0134142041f, 0.89996773f},
-std::array<float,2>{0.925356507f, 0.747896731f},
-std::array<float,2>{0.445968479f, 0.198454306f},
-std::array<float,2>{0.683798432f, 0.166960105f},
-std::array<float,2>{0.209300131f, 0.682416737f},
-std::array<float,2>{0.816486716f, 0.947237968f},
-std::array<float,2>{0.287419409f, 0.322629124f},
-std::array<float,2>{0.944666326f, 0.446091384f},
-std::array<float,2>{0.432390541f, 0.857156038f},
-std::array<float,2>{0.529030383f, 0.576012075f},
-std::array<float,2>{0.0657042786f, 0.0131948013f},
-std::array<float,2>{0.790572822f, 0.187950641f},
-std::array<float,2>{0.357086033f, 0.736982822f},
-std::array<float,2>{0.736387789f, 0.898431897f},
-std::array<float,2>{0.158892483f, 0.310391188f},
-std::array<float,2>{0.570729792f, 0.422553569f},
-std::array<float,2>{0.0361831002f, 0.778069854f},
-std::array<float,2>{0.882509828f, 0.556244433f},
-std::array<float,2>{0.475765586f, 0.120078556f},
-std::array<float,2>{0.652779877f, 0.00545561872f},
-std::array<float,2>{0.241293833f, 0.569101393f},
-std::array<float,2>{0.850764334f, 0.848484457f},
-std::array<float,2>{0.250740409f, 0.442018121f},
-std::array<float,2>{0.969675303f, 0.312840283f},
-std::array<float,2>{0.390900224f, 0.939461052f},
-std::array<float,2>{0.558647037f, 0.676609218f},
-std::array<float,2>{0.122201562f, 0.160239339f},
-std::array<float,2>{0.935047925f, 0.0640227944f},
-std::array<float,2>{0.440915197f, 0.514268458f},
-std::array<float,2>{0.617263913f, 0.802554905f},
-std::array<float,2>{0.00770131219f, 0.376158684f},
-std::array<float,2>{0.716228783f, 0.255475998f},
-std::array<float,2>{0.132362291f, 0.908511698f},
-std::array<float,2>{0.750360548f, 0.704594791f},
-std::array<float,2>{0.32828331f, 0.234459415f},
-std::array<float,2>{0.52005738f, 0.130708337f},
-std::array<float,2>{0.0706094056f, 0.655878723f},
-std::array<float,2>{0.951225042f, 0.97159797f},
-std::array<float,2>{0.424631506f, 0.362059832f},
-std::array<float,2>{0.823678136f, 0.470231891f},
-std::array<float,2>{0.294421881f, 0.81912756f},
-std::array<float,2>{0.672287047f, 0.622119486f},
-std::array<float,2>{0.211911589f, 0.0371292643f},
-std::array<float,2>{0.959590912f, 0.172303721f},
-std::array<float,2>{0.416504681f, 0.663367808f},
-std::array<float,2>{0.508692503f, 0.963977456f},
-std::array<float,2>{0.0847972333f, 0.34195137f},
-std::array<float,2>{0.667340994f, 0.466386348f},
-std::array<float,2>{0.202073529f, 0.866630256f},
-std::array<float,2>{0.843393803f, 0.5800488f},
-std::array<float,2>{0.302377224f, 0.0245515183f},
-std::array<float,2>{0.59894532f, 0.0943508297f},
-std::array<float,2>{0.0189731847f, 0.53998673f},
-std::array<float,2>{0.912401259f, 0.761021256f},
-std::array<float,2>{0.455080062f, 0.407921553f},
-std::array<float,2>{0.77351284f, 0.286498338f},
-std::array<float,2>{0.325580984f, 0.886526287f},
-std::array<float,2>{0.702629924f, 0.729678869f},
-std::array<float,2>{0.14741905f, 0.205528662f},
-std::array<float,2>{0.871660888f, 0.0590780191f},
-std::array<float,2>{0.272668183f, 0.601296484f},
-std::array<float,2>{0.63721472f, 0.842470109f},
-std::array<float,2>{0.231361538f, 0.486240506f},
-std::array<float,2>{0.538166046f, 0.354213476f},
-std::array<float,2>{0.0940487534f, 0.988553584f},
-std::array<float,2>{0.991740644f, 0.629375219f},
-std::array<float,2>{0.38270402f, 0.154727295f},
-std::array<float,2>{0.72454226f, 0.23216325f},
-std::array<float,2>{0.173264533f, 0.698251903f},
-std::array<float,2>{0.797086954f, 0.936105013f},
-std::array<float,2>{0.36482197f, 0.270612746f},
-std::array<float,2>{0.891981959f, 0.39867568f},
-std::array<float,2>{0.496811152f, 0.792377889f},
-std::array<float,2>{0.590373158f, 0.530050397f},
-std::array<float,2>{0.0497818589f, 0.0887434259f},
-std::array<float,2>{0.805854201f, 0.125950873f},
-std::array<float,2>{0.367245078f, 0.650072277f},
-std::array<float,2>{0.727484107f, 0.974372506f},
-std::array<float,2>{0.181444585f, 0.3639144f},
-std::array<float,2>{0.579011142f, 0.474638015f},
-std::array<float,2>{0.060192164f, 0.81415391f},
-std::array<float,2>{0.900425971f, 0.619881988f},
-std::array<float,2>{0.490487784f, 0.0323914774f},
-std::array<float,2>{0.630806744f, 0.0676068068f},
-std::array<float,2>{0.2241171f, 0.509637177f},
-std::array<float,2>{0.864342034f, 0.800581336f},
-std::array<float,2>{0.278978705f, 0.381365836f},
-std::array<float,2>{0.998497128f, 0.252964973f},
-std::array<float,2>{0.387903243f, 0.910565853f},
-std::array<float,2>{0.544998527f, 0.708671272f},
-std::array<float,2>{0.102542214f, 0.241036251f},
-std::array<float,2>{0.916971684f, 0.0023375731f},
-std::array<float,2>{0.468089908f, 0.562669098f},
-std::array<float,2>{0.606223881f, 0.844681799f},
-std::array<float,2>{0.0277796462f, 0.440151215f},
-std::array<float,2>{0.687707901f, 0.317289263f},
-std::array<float,2>{0.14853549f, 0.943096101f},
-std::array<float,2>{0.771200418f, 0.675507069f},
-std::array<float,2>{0.315639615f, 0.156658784f},
-std::array<float,2>{0.503582716f, 0.192373648f},
-std::array<float,2>{0.0883361697f, 0.739182889f},
-std::array<float,2>{0.964715004f, 0.893183589f},
-std::array<float,2>{0.407887876f, 0.305486292f},
-std::array<float,2>{0.833466768f, 0.428273857f},
-std::array<float,2>{0.311043024f, 0.776274025f},
-std::array<float,2>{0.657063663f, 0.560856044f},
-std::array<float,2>{0.194016144f, 0.121218927f},
-std::array<float,2>{0.941381872f, 0.229012921f},
-std::array<float,2>{0.43727833f, 0.702677548f},
-std::array<float,2>{0.525954783f, 0.933440387f},
-std::array<float,2>{0.068668209f, 0.269509971f},
-std::array<float,2>{0.681753039f, 0.404447794f},
-std::array<float,2>{0.204200506f, 0.79372263f},
-std::array<float,2>{0.816283166f, 0.526499689f},
-std::array<float,2>{0.283104002f, 0.0917297229f},
-std::array<float,2>{0.611283123f, 0.0566529073f},
-std::array<float,2>{0.0115856444f, 0.594244063f},
-std::array<float,2>{0.928334355f, 0.837660372f},
-std::array<float,2>{0.451063037f, 0.489365697f},
-std::array<float,2>{0.758839428f, 0.355603516f},
-std::array<float,2>{0.339102894f, 0.987675428f},
-std::array<float,2>{0.704732656f, 0.627938509f},
-std::array<float,2>{0.13590312f, 0.14980714f},
-std::array<float,2>{0.853196859f, 0.100411505f},
-std::array<float,2>{0.260463715f, 0.546840131f},
-std::array<float,2>{0.647079229f, 0.762182295f},
-std::array<float,2>{0.24896358f, 0.413305014f},
-std::array<float,2>{0.552019119f, 0.284521222f},
-std::array<float,2>{0.114094295f, 0.889163077f},
-std::array<float,2>{0.984250546f, 0.734209836f},
-std::array<float,2>{0.405763417f, 0.207325503f},
-std::array<float,2>{0.747415185f, 0.179671764f},
-std::array<float,2>{0.16833058f, 0.657432318f},
-std::array<float,2>{0.786726296f, 0.966499627f},
-std::array<float,2>{0.351049602f, 0.339530408f},
-std::array<float,2>{0.885229647f, 0.46442318f},
-std::array<float,2>{0.482537836f, 0.860011578f},
-std::array<float,2>{0.570123315f, 0.585281372f},
-std::array<float,2>{0.0440871231f, 0.0291711316f},
-std::array<float,2>{0.828076005f, 0.217217311f},
-std::array<float,2>{0.28939712f, 0.719975114f},
-std::array<float,2>{0.676792443f, 0.87546885f},
-std::array<float,2>{0.218033537f, 0.291255563f},
-std::array<float,2>{0.516477525f, 0.419825345f},
-std::array<float,2>{0.0768503696f, 0.751355648f},
-std::array<float,2>{0.949073851f, 0.53457886f},
-std::array<float,2>{0.428258628f, 0.103543647f},
-std::array<float,2>{0.713881135f, 0.0227567945f},
-std::array<float,2>{0.125523701f, 0.590664208f},
-std::array<float,2>{0.75764823f, 0.874236584f},
-std::array<float,2>{0.335591942f, 0.453821778f},
-std::array<float,2>{0.930916131f, 0.330253273f},
-std::array<float,2>{0.443121612f, 0.959897161f},
-std::array<float,2>{0.622573793f, 0.666283429f},
-std::array<float,2>{0.00163558195f, 0.17969957f},
-std::array<float,2>{0.973781109f, 0.0810584202f},
-std::array<float,2>{0.396265388f, 0.518088758f},
-std::array<float,2>{0.555541515f, 0.782004178f},
-std::array<float,2>{0.117851183f, 0.39692679f},
-std::array<float,2>{0.652144909f, 0.275729597f},
-std::array<float,2>{0.234567344f, 0.924000442f},
-std::array<float,2>{0.84469676f, 0.691409349f},
-std::array<float,2>{0.256147414f, 0.218949541f},
-std::array<float,2>{0.574398875f, 0.141438007f},
-std::array<float,2>{0.0340098664f, 0.634871125f},
-std::array<float,2>{0.875302911f, 0.997937858f},
-std::array<float,2>{0.47024706f, 0.349424154f},
-std::array<float,2>{0.794789016f, 0.493657142f},
-std::array<float,2>{0.352889448f, 0.828231573f},
-std::array<float,2>{0.739046276f, 0.604393363f},
-std::array<float,2>{0.161738023f, 0.0476621799f},
-std::array<float,2>{0.897002816f, 0.168832779f},
-std::array<float,2>{0.495397955f, 0.687025964f},
-std::array<float,2>{0.589469612f, 0.952193618f},
-std::array<float,2>{0.0521862321f, 0.324493736f},
-std::array<float,2>{0.719540179f, 0.451145083f},
-std::array<float,2>{0.176197872f, 0.855330467f},
-std::array<float,2>{0.803785324f, 0.574026465f},
-std::array<float,2>{0.362248152f, 0.00953861605f},
-std::array<float,2>{0.534860313f, 0.116518773f},
-std::array<float,2>{0.100265302f, 0.547609031f},
-std::array<float,2>{0.98605597f, 0.768393755f},
-std::array<float,2>{0.378762066f, 0.434535533f},
-std::array<float,2>{0.870899975f, 0.301470488f},
-std::array<float,2>{0.26627329f, 0.905040681f},
-std::array<float,2>{0.634069264f, 0.743977785f},
-std::array<float,2>{0.228426576f, 0.199958846f},
-std::array<float,2>{0.780998468f, 0.0417059436f},
-std::array<float,2>{0.323137939f, 0.616774142f},
-std::array<float,2>{0.698234439f, 0.827644646f},
-std::array<float,2>{0.144167811f, 0.478868157f},
-std::array<float,2>{0.596492469f, 0.37346971f},
-std::array<float,2>{0.0209438223f, 0.980039537f},
-std::array<float,2>{0.909549296f, 0.643556774f},
-std::array<float,2>{0.45901823f, 0.134072796f},
-std::array<float,2>{0.67059201f, 0.248539284f},
-std::array<float,2>{0.197118506f, 0.71693337f},
-std::array<float,2>{0.839436173f, 0.916018188f},
-std::array<float,2>{0.300143719f, 0.259758949f},
-std::array<float,2>{0.953513861f, 0.389864445f},
-std::array<float,2>{0.41870746f, 0.808082521f},
-std::array<float,2>{0.512434483f, 0.500720859f},
-std::array<float,2>{0.079526484f, 0.0731624812f},
-std::array<float,2>{0.861107886f, 0.184535176f},
-std::array<float,2>{0.275178105f, 0.668766916f},
-std::array<float,2>{0.625200868f, 0.956206143f},
-std::array<float,2>{0.220067561f, 0.33401677f},
-std::array<float,2>{0.542599082f, 0.457735181f},
-std::array<float,2>{0.107591398f, 0.870355427f},
-std::array<float,2>{0.992193997f, 0.589098215f},
-std::array<float,2>{0.384919047f, 0.0160044376f},
-std::array<float,2>{0.730724394f, 0.108318776f},
-std::array<float,2>{0.187145844f, 0.53609246f},
-std::array<float,2>{0.810810387f, 0.756168187f},
-std::array<float,2>{0.371346295f, 0.417549789f},
-std::array<float,2>{0.903615594f, 0.294632524f},
-std::array<float,2>{0.48766309f, 0.880417168f},
-std::array<float,2>{0.582967222f, 0.724941015f},
-std::array<float,2>{0.0561952405f, 0.213519156f},
-std::array<float,2>{0.966265798f, 0.0532519259f},
-std::array<float,2>{0.41155073f, 0.607716382f},
-std::array<float,2>{0.504504859f, 0.833953202f},
-std::array<float,2>{0.0912099481f, 0.499021947f},
-std::array<float,2>{0.662274539f, 0.347652614f},
-std::array<float,2>{0.190654382f, 0.994221807f},
-std::array<float,2>{0.828312814f, 0.640026331f},
-std::array<float,2>{0.304830641f, 0.145822883f},
-std::array<float,2>{0.603058815f, 0.225327998f},
-std::array<float,2>{0.023934098f, 0.690524101f},
-std::array<float,2>{0.921285927f, 0.926700115f},
-std::array<float,2>{0.462106436f, 0.279439688f},
-std::array<float,2>{0.76683861f, 0.391529143f},
-std::array<float,2>{0.319054455f, 0.785475194f},
-std::array<float,2>{0.695116162f, 0.521279573f},
-std::array<float,2>{0.152990088f, 0.0847347975f},
-std::array<float,2>{0.922744751f, 0.197161734f},
-std::array<float,2>{0.448556513f, 0.749441564f},
-std::array<float,2>{0.616118133f, 0.901090443f},
-std::array<float,2>{0.0137907919f, 0.298152536f},
-std::array<float,2>{0.7095263f, 0.432076961f},
-std::array<float,2>{0.138220444f, 0.770001113f},
-std::array<float,2>{0.764594138f, 0.553415537f},
-std::array<float,2>{0.341727555f, 0.112015828f},
-std::array<float,2>{0.529940665f, 0.0148406373f},
-std::array<float,2>{0.0644421428f, 0.578074455f},
-std::array<float,2>{0.943304956f, 0.858043909f},
-std::array<float,2>{0.431145251f, 0.447471023f},
-std::array<float,2>{0.818579912f, 0.320768118f},
-std::array<float,2>{0.286092341f, 0.948300958f},
-std::array<float,2>{0.685561657f, 0.681534171f},
-std::array<float,2>{0.208684191f, 0.164357245f},
-std::array<float,2>{0.783103704f, 0.0764216408f},
-std::array<float,2>{0.34647283f, 0.505007267f},
-std::array<float,2>{0.744020224f, 0.810296237f},
-std::array<float,2>{0.164968967f, 0.384889632f},
-std::array<float,2>{0.563459277f, 0.263864845f},
-std::array<float,2>{0.0403443985f, 0.920989513f},
-std::array<float,2>{0.887558341f, 0.713811934f},
-std::array<float,2>{0.478448987f, 0.246007279f},
-std::array<float,2>{0.644171298f, 0.137762398f},
-std::array<float,2>{0.245199785f, 0.64802438f},
-std::array<float,2>{0.858381808f, 0.984016001f},
-std::array<float,2>{0.264201403f, 0.370275468f},
-std::array<float,2>{0.978335738f, 0.48122701f},
-std::array<float,2>{0.399969369f, 0.821842968f},
-std::array<float,2>{0.548270345f, 0.612440348f},
-std::array<float,2>{0.110114045f, 0.0435844511f},
-std::array<float,2>{0.753875971f, 0.237497494f},
-std::array<float,2>{0.331363291f, 0.705788672f},
-std::array<float,2>{0.718021452f, 0.907110035f},
-std::array<float,2>{0.129311591f, 0.257189453f},
-std::array<float,2>{0.620672643f, 0.378034025f},
-std::array<float,2>{0.00582700176f, 0.803152382f},
-std::array<float,2>{0.936246514f, 0.513015032f},
-std::array<float,2>{0.438093811f, 0.0648206398f},
-std::array<float,2>{0.674371362f, 0.0353839844f},
-std::array<float,2>{0.21480298f, 0.623860478f},
-std::array<float,2>{0.821443081f, 0.816806018f},
-std::array<float,2>{0.296058416f, 0.471221507f},
-std::array<float,2>{0.950791299f, 0.359539002f},
-std::array<float,2>{0.422933757f, 0.970642269f},
-std::array<float,2>{0.522372425f, 0.653338552f},
-std::array<float,2>{0.0729103684f, 0.131398827f},
-std::array<float,2>{0.88075459f, 0.119028397f},
-std::array<float,2>{0.474483639f, 0.557687104f},
-std::array<float,2>{0.573267579f, 0.780958176f},
-std::array<float,2>{0.0377539322f, 0.424820274f},
-std::array<float,2>{0.735252738f, 0.3121503f},
-std::array<float,2>{0.156314388f, 0.895990968f},
-std::array<float,2>{0.791404724f, 0.735457659f},
-std::array<float,2>{0.359053493f, 0.191254914f},
-std::array<float,2>{0.560717463f, 0.162177384f},
-std::array<float,2>{0.123478629f, 0.678251922f},
-std::array<float,2>{0.972155154f, 0.939081669f},
-std::array<float,2>{0.392770022f, 0.314792633f},
-std::array<float,2>{0.847768366f, 0.443363935f},
-std::array<float,2>{0.253033459f, 0.849854529f},
-std::array<float,2>{0.655863345f, 0.567026496f},
-std::array<float,2>{0.239846319f, 0.00775010372f},
-std::array<float,2>{0.988761723f, 0.153222978f},
-std::array<float,2>{0.380470991f, 0.631501913f},
-std::array<float,2>{0.535485804f, 0.992173314f},
-std::array<float,2>{0.0960164592f, 0.353396416f},
-std::array<float,2>{0.640186548f, 0.486530781f},
-std::array<float,2>{0.233525127f, 0.840214789f},
-std::array<float,2>{0.874897361f, 0.599251926f},
-std::array<float,2>{0.270187438f, 0.0614494309f},
-std::array<float,2>{0.592886865f, 0.0873648301f},
-std::array<float,2>{0.0471985824f, 0.528176367f},
-std::array<float,2>{0.893071115f, 0.78983146f},
-std::array<float,2>{0.498726845f, 0.401007265f},
-std::array<float,2>{0.7988379f, 0.271764576f},
-std::array<float,2>{0.367035985f, 0.933737159f},
-std::array<float,2>{0.724867404f, 0.696911931f},
-std::array<float,2>{0.174093679f, 0.234274387f},
-std::array<float,2>{0.841240466f, 0.0264280066f},
-std::array<float,2>{0.304101914f, 0.581953824f},
-std::array<float,2>{0.664610207f, 0.863745153f},
-std::array<float,2>{0.200659603f, 0.468681157f},
-std::array<float,2>{0.511123061f, 0.340092272f},
-std::array<float,2>{0.0824905261f, 0.961381853f},
-std::array<float,2>{0.957669914f, 0.661312044f},
-std::array<float,2>{0.414236248f, 0.175713331f},
-std::array<float,2>{0.699894726f, 0.204525635f},
-std::array<float,2>{0.144714177f, 0.727601886f},
-std::array<float,2>{0.776454628f, 0.883361876f},
-std::array<float,2>{0.327593476f, 0.288894832f},
-std::array<float,2>{0.911937833f, 0.408609688f},
-std::array<float,2>{0.453216702f, 0.758722484f},
-std::array<float,2>{0.600842953f, 0.541828334f},
-std::array<float,2>{0.0161808748f, 0.096408762f},
-std::array<float,2>{0.761006474f, 0.148748949f},
-std::array<float,2>{0.336783141f, 0.62709409f},
-std::array<float,2>{0.706158042f, 0.986421049f},
-std::array<float,2>{0.1329896f, 0.356633365f},
-std::array<float,2>{0.612314343f, 0.488762915f},
-std::array<float,2>{0.00905044377f, 0.836050928f},
-std::array<float,2>{0.926497579f, 0.595253229f},
-std::array<float,2>{0.452635765f, 0.0580754578f},
-std::array<float,2>{0.679818273f, 0.0899067074f},
-std::array<float,2>{0.206684276f, 0.525448561f},
-std::array<float,2>{0.813652337f, 0.794102967f},
-std::array<float,2>{0.284000576f, 0.40623793f},
-std::array<float,2>{0.938611507f, 0.268273085f},
-std::array<float,2>{0.435488641f, 0.932163417f},
-std::array<float,2>{0.524409473f, 0.702003896f},
-std::array<float,2>{0.0678605288f, 0.230230853f},
-std::array<float,2>{0.883068204f, 0.0277703423f},
-std::array<float,2>{0.481205463f, 0.584551811f},
-std::array<float,2>{0.566997766f, 0.861196935f},
-std::array<float,2>{0.0457338579f, 0.46299991f},
-std::array<float,2>{0.748945773f, 0.338759214f},
-std::array<float,2>{0.171572074f, 0.965577781f},
-std::array<float,2>{0.788686395f, 0.656897008f},
-std::array<float,2>{0.34887889f, 0.178075343f},
-std::array<float,2>{0.554560304f, 0.208442777f},
-std::array<float,2>{0.116756342f, 0.733363092f},
-std::array<float,2>{0.981734812f, 0.890300691f},
-std::array<float,2>{0.402520806f, 0.283817947f},
-std::array<float,2>{0.854472101f, 0.413009197f},
-std::array<float,2>{0.257863492f, 0.763253391f},
-std::array<float,2>{0.645359993f, 0.545382738f},
-std::array<float,2>{0.246389255f, 0.101418078f},
-std::array<float,2>{0.997444212f, 0.241937205f},
-std::array<float,2>{0.389599383f, 0.707555115f},
-std::array<float,2>{0.544174373f, 0.911662877f},
-std::array<float,2>{0.104676835f, 0.252786428f},
-std::array<float,2>{0.631769121f, 0.38191092f},
-std::array<float,2>{0.225054666f, 0.798883796f},
-std::array<float,2>{0.865965724f, 0.508717775f},
-std::array<float,2>{0.279854506f, 0.0673563629f},
-std::array<float,2>{0.580523789f, 0.0317936316f},
-std::array<float,2>{0.0615477748f, 0.621031165f},
-std::array<float,2>{0.899848402f, 0.81270802f},
-std::array<float,2>{0.489230514f, 0.475644439f},
-std::array<float,2>{0.80692327f, 0.364496589f},
-std::array<float,2>{0.370317221f, 0.97310847f},
-std::array<float,2>{0.728548467f, 0.649397969f},
-std::array<float,2>{0.181810677f, 0.126805589f},
-std::array<float,2>{0.834597945f, 0.123007178f},
-std::array<float,2>{0.309464723f, 0.562021792f},
-std::array<float,2>{0.659556091f, 0.77655381f},
-std::array<float,2>{0.192119658f, 0.429531246f},
-std::array<float,2>{0.500151753f, 0.306178659f},
-std::array<float,2>{0.0875909254f, 0.894519508f},
-std::array<float,2>{0.962036133f, 0.739550173f},
-std::array<float,2>{0.409933716f, 0.192596212f},
-std::array<float,2>{0.690831184f, 0.157743216f},
-std::array<float,2>{0.152229875f, 0.674457908f},
-std::array<float,2>{0.772839904f, 0.942200541f},
-std::array<float,2>{0.312641621f, 0.3178505f},
-std::array<float,2>{0.914444387f, 0.441170365f},
-std::array<float,2>{0.466476291f, 0.844997346f},
-std::array<float,2>{0.608856618f, 0.563750207f},
-std::array<float,2>{0.0293269306f, 0.00338390283f},
-std::array<float,2>{0.869125366f, 0.200667441f},
-std::array<float,2>{0.268203169f, 0.74311161f},
-std::array<float,2>{0.634837389f, 0.905788362f},
-std::array<float,2>{0.229509041f, 0.301956445f},
-std::array<float,2>{0.531718612f, 0.434851974f},
-std::array<float,2>{0.0993691459f, 0.769172132f},
-std::array<float,2>{0.986916423f, 0.548248112f},
-std::array<float,2>{0.376153409f, 0.115602054f},
-std::array<float,2>{0.722649574f, 0.008445994f},
-std::array<float,2>{0.178252041f, 0.572798014f},
-std::array<float,2>{0.801313818f, 0.853559375f},
-std::array<float,2>{0.361145407f, 0.449403316f},
-std::array<float,2>{0.896194339f, 0.325904161f},
-std::array<float,2>{0.493983597f, 0.951854706f},
-std::array<float,2>{0.58706063f, 0.6859442f},
-std::array<float,2>{0.0539975166f, 0.169716328f},
-std::array<float,2>{0.955334604f, 0.0737644807f},
-std::array<float,2>{0.421513021f, 0.501861632f},
-std::array<float,2>{0.515402436f, 0.807003319f},
-std::array<float,2>{0.0802782252f, 0.38881892f},
-std::array<float,2>{0.669195294f, 0.258047819f},
-std::array<float,2>{0.198030338f, 0.917130709f},
-std::array<float,2>{0.836895168f, 0.718498588f},
-std::array<float,2>{0.297279477f, 0.249070287f},
-std::array<float,2>{0.594953775f, 0.13333039f},
-std::array<float,2>{0.0228216369f, 0.643419027f},
-std::array<float,2>{0.90756917f, 0.979142427f},
-std::array<float,2>{0.458951652f, 0.374985158f},
-std::array<float,2>{0.779246509f, 0.480397224f},
-std::array<float,2>{0.322123259f, 0.826520085f},
-std::array<float,2>{0.697062016f, 0.61609751f},
-std::array<float,2>{0.140877232f, 0.0429482311f},
-std::array<float,2>{0.932065606f, 0.180680752f},
-std::array<float,2>{0.444431037f, 0.667257309f},
-std::array<float,2>{0.623243392f, 0.960784078f},
-std::array<float,2>{0.00346459961f, 0.331237614f},
-std::array<float,2>{0.712066114f, 0.454851151f},
-std::array<float,2>{0.128119752f, 0.873643458f},
-std::array<float,2>{0.754312694f, 0.591285944f},
-std::array<float,2>{0.333397895f, 0.022193905f},
-std::array<float,2>{0.518235445f, 0.104961805f},
-std::array<float,2>{0.074566476f, 0.533947289f},
-std::array<float,2>{0.946551859f, 0.750242412f},
-std::array<float,2>{0.426611871f, 0.418857604f},
-std::array<float,2>{0.825879455f, 0.29252255f},
-std::array<float,2>{0.291493237f, 0.876850605f},
-std::array<float,2>{0.678243101f, 0.718789399f},
-std::array<float,2>{0.215508506f, 0.217854798f},
-std::array<float,2>{0.795078337f, 0.0486668609f},
-std::array<float,2>{0.354577154f, 0.60505265f},
-std::array<float,2>{0.741369843f, 0.829504013f},
-std::array<float,2>{0.163577944f, 0.492580473f},
-std::array<float,2>{0.576765418f, 0.348107636f},
-std::array<float,2>{0.0315825082f, 0.99670136f},
-std::array<float,2>{0.878172994f, 0.635771751f},
-std::array<float,2>{0.471427023f, 0.142311782f},
-std::array<float,2>{0.650134742f, 0.220541552f},
-std::array<float,2>{0.237814069f, 0.692607224f},
-std::array<float,2>{0.845944703f, 0.924812138f},
-std::array<float,2>{0.254110903f, 0.276710302f},
-std::array<float,2>{0.97551614f, 0.398203701f},
-std::array<float,2>{0.39664647f, 0.782370985f},
-std::array<float,2>{0.556668758f, 0.519509792f},
-std::array<float,2>{0.12002258f, 0.0809067562f},
-std::array<float,2>{0.818081498f, 0.165635765f},
-std::array<float,2>{0.288310915f, 0.680350542f},
-std::array<float,2>{0.684932232f, 0.94757086f},
-std::array<float,2>{0.209998861f, 0.321482837f},
-std::array<float,2>{0.527566731f, 0.449103653f},
-std::array<float,2>{0.0650533661f, 0.859152496f},
-std::array<float,2>{0.944323719f, 0.576930046f},
-std::array<float,2>{0.433332652f, 0.0137489513f},
-std::array<float,2>{0.707430661f, 0.112635262f},
-std::array<float,2>{0.139002889f, 0.554475367f},
-std::array<float,2>{0.763565242f, 0.771463692f},
-std::array<float,2>{0.342894822f, 0.432888567f},
-std::array<float,2>{0.924586833f, 0.297405422f},
-std::array<float,2>{0.44697082f, 0.90214467f},
-std::array<float,2>{0.615201831f, 0.748607516f},
-std::array<float,2>{0.0122764297f, 0.195957378f},
-std::array<float,2>{0.980004311f, 0.0445825011f},
-std::array<float,2>{0.401085079f, 0.612061918f},
-std::array<float,2>{0.550011754f, 0.821020544f},
-std::array<float,2>{0.111748688f, 0.48225531f},
-std::array<float,2>{0.641131401f, 0.369716108f},
-std::array<float,2>{0.243004009f, 0.983308613f},
-std::array<float,2>{0.855515361f, 0.647134185f},
-std::array<float,2>{0.263468325f, 0.137247443f},
-std::array<float,2>{0.564634502f, 0.2444143f},
-std::array<float,2>{0.0428012982f, 0.714385867f},
-std::array<float,2>{0.890179873f, 0.920686662f},
-std::array<float,2>{0.479559749f, 0.265020341f},
-std::array<float,2>{0.783690989f, 0.386706203f},
-std::array<float,2>{0.345398307f, 0.808923125f},
-std::array<float,2>{0.744773746f, 0.504058123f},
-std::array<float,2>{0.166229382f, 0.0772380456f},
-std::array<float,2>{0.904357076f, 0.213875204f},
-std::array<float,2>{0.484542102f, 0.72604692f},
-std::array<float,2>{0.584000707f, 0.878943264f},
-std::array<float,2>{0.0577390566f, 0.29365325f},
-std::array<float,2>{0.733387351f, 0.416160375f},
-std::array<float,2>{0.184747905f, 0.757401705f},
-std::array<float,2>{0.80927062f, 0.536221206f},
-std::array<float,2>{0.374153823f, 0.109121464f},
-std::array<float,2>{0.539276183f, 0.0168424007f},
-std::array<float,2>{0.106331296f, 0.588707209f},
-std::array<float,2>{0.995300353f, 0.869450092f},
-std::array<float,2>{0.383372307f, 0.458662421f},
-std::array<float,2>{0.862962365f, 0.335756421f},
-std::array<float,2>{0.276453584f, 0.955789506f},
-std::array<float,2>{0.628369451f, 0.669876516f},
-std::array<float,2>{0.221291959f, 0.185157597f},
-std::array<float,2>{0.769034982f, 0.0850770101f},
-std::array<float,2>{0.317794383f, 0.520201802f},
-std::array<float,2>{0.69206506f, 0.78682214f},
-std::array<float,2>{0.154941216f, 0.391778499f},
-std::array<float,2>{0.604178846f, 0.280600637f},
-std::array<float,2>{0.0254382472f, 0.927079916f},
-std::array<float,2>{0.918656647f, 0.690288186f},
-std::array<float,2>{0.46404615f, 0.226510406f},
-std::array<float,2>{0.661247671f, 0.145199642f},
-std::array<float,2>{0.18779169f, 0.639396489f},
-std::array<float,2>{0.830493748f, 0.995771945f},
-std::array<float,2>{0.308166742f, 0.345903277f},
-std::array<float,2>{0.967942894f, 0.499231219f},
-std::array<float,2>{0.413306743f, 0.832928598f},
-std::array<float,2>{0.506971061f, 0.608406663f},
-std::array<float,2>{0.0923024118f, 0.0544527546f},
-std::array<float,2>{0.798188984f, 0.232507244f},
-std::array<float,2>{0.36340189f, 0.695312619f},
-std::array<float,2>{0.723435342f, 0.934718668f},
-std::array<float,2>{0.171936348f, 0.273325682f},
-std::array<float,2>{0.591324568f, 0.401591837f},
-std::array<float,2>{0.0504342839f, 0.790313065f},
-std::array<float,2>{0.891504228f, 0.528918326f},
-std::array<float,2>{0.497801274f, 0.086541988f},
-std::array<float,2>{0.638084948f, 0.0615833998f},
-std::array<float,2>{0.231840149f, 0.59826082f},
-std::array<float,2>{0.872292697f, 0.841197312f},
-std::array<float,2>{0.27152887f, 0.487585068f},
-std::array<float,2>{0.9905532f, 0.351960778f},
-std::array<float,2>{0.381662041f, 0.990910232f},
-std::array<float,2>{0.537812829f, 0.632329464f},
-std::array<float,2>{0.0950514674f, 0.153949961f},
-std::array<float,2>{0.913284004f, 0.0972938165f},
-std::array<float,2>{0.456798524f, 0.542628884f},
-std::array<float,2>{0.597971022f, 0.759059072f},
-std::array<float,2>{0.0183768366f, 0.410118103f},
-std::array<float,2>{0.701583445f, 0.287466168f},
-std::array<float,2>{0.147590488f, 0.884428322f},
-std::array<float,2>{0.774633646f, 0.727286816f},
-std::array<float,2>{0.324444532f, 0.203627318f},
-std::array<float,2>{0.5091995f, 0.174132347f},
-std::array<float,2>{0.0856562182f, 0.660778821f},
-std::array<float,2>{0.960867763f, 0.962479711f},
-std::array<float,2>{0.417856008f, 0.341002256f},
-std::array<float,2>{0.842158496f, 0.467129439f},
-std::array<float,2>{0.301384658f, 0.864481866f},
-std::array<float,2>{0.666709781f, 0.580160141f},
-std::array<float,2>{0.202866226f, 0.0260080993f},
-std::array<float,2>{0.952318132f, 0.132191822f},
-std::array<float,2>{0.425327271f, 0.653271914f},
-std::array<float,2>{0.520599902f, 0.968877256f},
-std::array<float,2>{0.0718771666f, 0.360835701f},
-std::array<float,2>{0.672953963f, 0.471857429f},
-std::array<float,2>{0.212159187f, 0.818303943f},
-std::array<float,2>{0.822975218f, 0.624067485f},
-std::array<float,2>{0.293717235f, 0.0369788669f},
-std::array<float,2>{0.618513048f, 0.0656723604f},
-std::array<float,2>{0.00592416804f, 0.512605608f},
-std::array<float,2>{0.933769584f, 0.804566801f},
-std::array<float,2>{0.439506352f, 0.376992941f},
-std::array<float,2>{0.75117588f, 0.256532967f},
-std::array<float,2>{0.329702258f, 0.908125579f},
-std::array<float,2>{0.715381086f, 0.706505239f},
-std::array<float,2>{0.13102673f, 0.236628875f},
-std::array<float,2>{0.849750817f, 0.00647015078f},
-std::array<float,2>{0.251449049f, 0.567605734f},
-std::array<float,2>{0.654031813f, 0.850735843f},
-std::array<float,2>{0.24099125f, 0.445278525f},
-std::array<float,2>{0.56024617f, 0.316167176f},
-std::array<float,2>{0.121706441f, 0.938191414f},
-std::array<float,2>{0.96990943f, 0.679421127f},
-std::array<float,2>{0.391668916f, 0.16334182f},
-std::array<float,2>{0.737449586f, 0.189618006f},
-std::array<float,2>{0.160097882f, 0.735183716f},
-std::array<float,2>{0.789566636f, 0.895402253f},
-std::array<float,2>{0.355629951f, 0.310905427f},
-std::array<float,2>{0.880903304f, 0.424587876f},
-std::array<float,2>{0.474905401f, 0.780169606f},
-std::array<float,2>{0.571685076f, 0.556795359f},
-std::array<float,2>{0.035747055f, 0.11779882f},
-std::array<float,2>{0.785559773f, 0.177294999f},
-std::array<float,2>{0.350285351f, 0.659466743f},
-std::array<float,2>{0.746719122f, 0.968567431f},
-std::array<float,2>{0.168983564f, 0.33769697f},
-std::array<float,2>{0.56848222f, 0.46115315f},
-std::array<float,2>{0.0436645076f, 0.861942589f},
-std::array<float,2>{0.886579752f, 0.583347142f},
-std::array<float,2>{0.483398587f, 0.0306048207f},
-std::array<float,2>{0.648433506f, 0.0983915105f},
-std::array<float,2>{0.249380618f, 0.543657839f},
-std::array<float,2>{0.851850867f, 0.764656126f},
-std::array<float,2>{0.261261195f, 0.410534769f},
-std::array<float,2>{0.983108222f, 0.282307237f},
-std::array<float,2>{0.404517382f, 0.888473988f},
-std::array<float,2>{0.550807834f, 0.731443465f},
-std::array<float,2>{0.115055695f, 0.209605023f},
-std::array<float,2>{0.929560661f, 0.0561494976f},
-std::array<float,2>{0.449293971f, 0.59644407f},
-std::array<float,2>{0.609521329f, 0.838198483f},
-std::array<float,2>{0.0101114241f, 0.491149902f},
-std::array<float,2>{0.703374386f, 0.357466608f},
-std::array<float,2>{0.135497868f, 0.984725595f},
-std::array<float,2>{0.75878644f, 0.625318348f},
-std::array<float,2>{0.33805123f, 0.151744992f},
-std::array<float,2>{0.526918411f, 0.228482187f},
-std::array<float,2>{0.0697354302f, 0.700367093f},
-std::array<float,2>{0.939552724f, 0.93104738f},
-std::array<float,2>{0.435680896f, 0.266224563f},
-std::array<float,2>{0.814478159f, 0.403810233f},
-std::array<float,2>{0.282061756f, 0.795177221f},
-std::array<float,2>{0.682722628f, 0.525134206f},
-std::array<float,2>{0.203229547f, 0.092344135f},
-std::array<float,2>{0.963327706f, 0.193671167f},
-std::array<float,2>{0.406713307f, 0.741552174f},
-std::array<float,2>{0.502199531f, 0.891893327f},
-std::array<float,2>{0.0890276879f, 0.308143586f},
-std::array<float,2>{0.658066273f, 0.426906019f},
-std::array<float,2>{0.195243403f, 0.773999751f},
-std::array<float,2>{0.832218707f, 0.558838964f},
-std::array<float,2>{0.31202969f, 0.123868048f},
-std::array<float,2>{0.607237875f, 0.000592526107f},
-std::array<float,2>{0.0285130832f, 0.566397369f},
-std::array<float,2>{0.917920053f, 0.846857786f},
-std::array<float,2>{0.467270225f, 0.439295709f},
-std::array<float,2>{0.770256579f, 0.319075257f},
-std::array<float,2>{0.314884424f, 0.944657266f},
-std::array<float,2>{0.688924432f, 0.672663927f},
-std::array<float,2>{0.150043547f, 0.158412665f},
-std::array<float,2>{0.864203691f, 0.0699415728f},
-std::array<float,2>{0.277443677f, 0.510471165f},
-std::array<float,2>{0.629830241f, 0.797038376f},
-std::array<float,2>{0.222920284f, 0.379092544f},
-std::array<float,2>{0.546721399f, 0.250468522f},
-std::array<float,2>{0.102438986f, 0.913223565f},
-std::array<float,2>{0.999030352f, 0.71014607f},
-std::array<float,2>{0.387093574f, 0.238515466f},
-std::array<float,2>{0.727633655f, 0.128783017f},
-std::array<float,2>{0.180413574f, 0.651637733f},
-std::array<float,2>{0.805098057f, 0.975264251f},
-std::array<float,2>{0.368860632f, 0.366207421f},
-std::array<float,2>{0.901490808f, 0.472775936f},
-std::array<float,2>{0.491369843f, 0.816086888f},
-std::array<float,2>{0.579907775f, 0.619104743f},
-std::array<float,2>{0.059218511f, 0.034426365f},
-std::array<float,2>{0.838506103f, 0.247328043f},
-std::array<float,2>{0.299407899f, 0.715476751f},
-std::array<float,2>{0.671420395f, 0.915890157f},
-std::array<float,2>{0.195945069f, 0.260115802f},
-std::array<float,2>{0.512957275f, 0.387759924f},
-std::array<float,2>{0.0787555873f, 0.805825412f},
-std::array<float,2>{0.954281807f, 0.503545523f},
-std::array<float,2>{0.419307798f, 0.0719769225f},
-std::array<float,2>{0.698916674f, 0.0401410684f},
-std::array<float,2>{0.143426776f, 0.613548577f},
-std::array<float,2>{0.779753089f, 0.825323641f},
-std::array<float,2>{0.323596478f, 0.477818936f},
-std::array<float,2>{0.908849657f, 0.372530788f},
-std::array<float,2>{0.460895777f, 0.976653159f},
-std::array<float,2>{0.59705013f, 0.640630901f},
-std::array<float,2>{0.0201291665f, 0.136705413f},
-std::array<float,2>{0.985292256f, 0.114122845f},
-std::array<float,2>{0.37792626f, 0.550756693f},
-std::array<float,2>{0.533516943f, 0.765841067f},
-std::array<float,2>{0.101558156f, 0.437095672f},
-std::array<float,2>{0.632813692f, 0.30293107f},
-std::array<float,2>{0.226794302f, 0.902357042f},
-std::array<float,2>{0.869881153f, 0.74484092f},
-std::array<float,2>{0.266958982f, 0.201900199f},
-std::array<float,2>{0.588509202f, 0.170623586f},
-std::array<float,2>{0.0508651771f, 0.685371101f},
-std::array<float,2>{0.898351312f, 0.950869083f},
-std::array<float,2>{0.494966328f, 0.328080267f},
-std::array<float,2>{0.803635895f, 0.451370537f},
-std::array<float,2>{0.362458855f, 0.852147043f},
-std::array<float,2>{0.720520258f, 0.572183371f},
-std::array<float,2>{0.177310303f, 0.0107716294f},
-std::array<float,2>{0.87613219f, 0.142684534f},
-std::array<float,2>{0.468760878f, 0.633952498f},
-std::array<float,2>{0.57612741f, 0.998714566f},
-std::array<float,2>{0.0346962847f, 0.351489782f},
-std::array<float,2>{0.739907265f, 0.495848596f},
-std::array<float,2>{0.160903454f, 0.831853449f},
-std::array<float,2>{0.793263078f, 0.60222888f},
-std::array<float,2>{0.351920694f, 0.0491903499f},
-std::array<float,2>{0.556061447f, 0.0787458941f},
-std::array<float,2>{0.118520506f, 0.516242981f},
-std::array<float,2>{0.973046064f, 0.783271372f},
-std::array<float,2>{0.394872278f, 0.395488948f},
-std::array<float,2>{0.844939232f, 0.274839699f},
-std::array<float,2>{0.257000178f, 0.922796488f},
-std::array<float,2>{0.65122956f, 0.693922818f},
-std::array<float,2>{0.236210585f, 0.221565396f},
-std::array<float,2>{0.756273806f, 0.0199864097f},
-std::array<float,2>{0.334893584f, 0.592472553f},
-std::array<float,2>{0.712928116f, 0.872993827f},
-std::array<float,2>{0.126401946f, 0.456606776f},
-std::array<float,2>{0.621931851f, 0.328874469f},
-std::array<float,2>{0.000282364432f, 0.957299292f},
-std::array<float,2>{0.930144787f, 0.665204823f},
-std::array<float,2>{0.441557974f, 0.181997404f},
-std::array<float,2>{0.676308811f, 0.215263948f},
-std::array<float,2>{0.217598557f, 0.721331477f},
-std::array<float,2>{0.826933026f, 0.878229141f},
-std::array<float,2>{0.290735275f, 0.290078998f},
-std::array<float,2>{0.9482373f, 0.420903623f},
-std::array<float,2>{0.429662317f, 0.751978755f},
-std::array<float,2>{0.516921341f, 0.532813251f},
-std::array<float,2>{0.0773976669f, 0.102234937f},
-std::array<float,2>{0.858825207f, 0.139067665f},
-std::array<float,2>{0.265518099f, 0.646295309f},
-std::array<float,2>{0.643424034f, 0.981705606f},
-std::array<float,2>{0.244916379f, 0.368206739f},
-std::array<float,2>{0.547436655f, 0.482560307f},
-std::array<float,2>{0.111150354f, 0.822449088f},
-std::array<float,2>{0.977294505f, 0.610258818f},
-std::array<float,2>{0.399062783f, 0.0453927405f},
-std::array<float,2>{0.74264878f, 0.0754742548f},
-std::array<float,2>{0.165725783f, 0.507682085f},
-std::array<float,2>{0.782001972f, 0.812434316f},
-std::array<float,2>{0.346804589f, 0.383760959f},
-std::array<float,2>{0.888038218f, 0.263257861f},
-std::array<float,2>{0.477133423f, 0.919058084f},
-std::array<float,2>{0.56415844f, 0.711476743f},
-std::array<float,2>{0.0400272012f, 0.243406147f},
-std::array<float,2>{0.941476405f, 0.0126342028f},
-std::array<float,2>{0.430112034f, 0.575132787f},
-std::array<float,2>{0.530292749f, 0.855810106f},
-std::array<float,2>{0.0626953766f, 0.446838856f},
-std::array<float,2>{0.686641872f, 0.323855877f},
-std::array<float,2>{0.207425073f, 0.945862949f},
-std::array<float,2>{0.819903731f, 0.68305546f},
-std::array<float,2>{0.286549091f, 0.167512909f},
-std::array<float,2>{0.616948545f, 0.197780192f},
-std::array<float,2>{0.0149197225f, 0.746410906f},
-std::array<float,2>{0.923137307f, 0.898526907f},
-std::array<float,2>{0.447756082f, 0.299709678f},
-std::array<float,2>{0.7647717f, 0.43072933f},
-std::array<float,2>{0.340388209f, 0.772559881f},
-std::array<float,2>{0.710238159f, 0.55125457f},
-std::array<float,2>{0.13756682f, 0.110638961f},
-std::array<float,2>{0.920163274f, 0.223120302f},
-std::array<float,2>{0.461340338f, 0.688233674f},
-std::array<float,2>{0.601613939f, 0.929665506f},
-std::array<float,2>{0.0248437282f, 0.279182404f},
-std::array<float,2>{0.694149077f, 0.393502474f},
-std::array<float,2>{0.153334454f, 0.788901687f},
-std::array<float,2>{0.766028106f, 0.52327013f},
-std::array<float,2>{0.319571912f, 0.0836853459f},
-std::array<float,2>{0.505531073f, 0.051035542f},
-std::array<float,2>{0.0900778696f, 0.605539918f},
-std::array<float,2>{0.965180159f, 0.834067166f},
-std::array<float,2>{0.410887778f, 0.49629432f},
-std::array<float,2>{0.829164505f, 0.345511079f},
-std::array<float,2>{0.306247234f, 0.992673993f},
-std::array<float,2>{0.663797796f, 0.636722624f},
-std::array<float,2>{0.190315545f, 0.146981493f},
-std::array<float,2>{0.812343061f, 0.107148431f},
-std::array<float,2>{0.373006195f, 0.538127124f},
-std::array<float,2>{0.731808186f, 0.754818857f},
-std::array<float,2>{0.186510354f, 0.414434344f},
-std::array<float,2>{0.583453298f, 0.295028985f},
-std::array<float,2>{0.0551383235f, 0.881270528f},
-std::array<float,2>{0.902456224f, 0.723917723f},
-std::array<float,2>{0.486365438f, 0.21133402f},
-std::array<float,2>{0.62618196f, 0.186844677f},
-std::array<float,2>{0.218941391f, 0.670770824f},
-std::array<float,2>{0.859916449f, 0.95437783f},
-std::array<float,2>{0.273470849f, 0.333793968f},
-std::array<float,2>{0.993935704f, 0.459439397f},
-std::array<float,2>{0.386529148f, 0.867629409f},
-std::array<float,2>{0.541072607f, 0.587832153f},
-std::array<float,2>{0.109197751f, 0.0179364495f},
-std::array<float,2>{0.775511026f, 0.2065707f},
-std::array<float,2>{0.326731682f, 0.729272485f},
-std::array<float,2>{0.700608969f, 0.884919822f},
-std::array<float,2>{0.145641416f, 0.285774261f},
-std::array<float,2>{0.600055575f, 0.406374395f},
-std::array<float,2>{0.0166364387f, 0.760733366f},
-std::array<float,2>{0.911097944f, 0.540490329f},
-std::array<float,2>{0.454797894f, 0.094873257f},
-std::array<float,2>{0.665288448f, 0.0242066402f},
-std::array<float,2>{0.19938916f, 0.578293979f},
-std::array<float,2>{0.840765715f, 0.866118729f},
-std::array<float,2>{0.303659558f, 0.465696365f},
-std::array<float,2>{0.958702564f, 0.342953891f},
-std::array<float,2>{0.415657669f, 0.963287294f},
-std::array<float,2>{0.509834409f, 0.662888646f},
-std::array<float,2>{0.0836054757f, 0.17379804f},
-std::array<float,2>{0.894127905f, 0.0893939212f},
-std::array<float,2>{0.499942809f, 0.530767918f},
-std::array<float,2>{0.592368007f, 0.791740537f},
-std::array<float,2>{0.0483593494f, 0.399701864f},
-std::array<float,2>{0.726278424f, 0.269581586f},
-std::array<float,2>{0.175456688f, 0.936687291f},
-std::array<float,2>{0.799969077f, 0.697898328f},
-std::array<float,2>{0.365407795f, 0.231042579f},
-std::array<float,2>{0.536409795f, 0.156144649f},
-std::array<float,2>{0.0967709199f, 0.629951298f},
-std::array<float,2>{0.98980546f, 0.989733279f},
-std::array<float,2>{0.379309982f, 0.354608506f},
-std::array<float,2>{0.873667002f, 0.484910518f},
-std::array<float,2>{0.271313518f, 0.84342289f},
-std::array<float,2>{0.639010549f, 0.600547314f},
-std::array<float,2>{0.23318243f, 0.0596072301f},
-std::array<float,2>{0.971400619f, 0.162072107f},
-std::array<float,2>{0.393978536f, 0.677644789f},
-std::array<float,2>{0.561715066f, 0.941401541f},
-std::array<float,2>{0.124215953f, 0.313596219f},
-std::array<float,2>{0.654366851f, 0.44242236f},
-std::array<float,2>{0.238623619f, 0.848660886f},
-std::array<float,2>{0.848818302f, 0.569362044f},
-std::array<float,2>{0.252587885f, 0.00425608596f},
-std::array<float,2>{0.572330415f, 0.121017508f},
-std::array<float,2>{0.0383059159f, 0.555332899f},
-std::array<float,2>{0.879372418f, 0.778589725f},
-std::array<float,2>{0.472667992f, 0.423325628f},
-std::array<float,2>{0.792756319f, 0.308993667f},
-std::array<float,2>{0.35832727f, 0.897457302f},
-std::array<float,2>{0.736163855f, 0.737407684f},
-std::array<float,2>{0.158009797f, 0.188676968f},
-std::array<float,2>{0.820671141f, 0.0383836813f},
-std::array<float,2>{0.295746684f, 0.621818304f},
-std::array<float,2>{0.675420046f, 0.81974417f},
-std::array<float,2>{0.213803202f, 0.469323516f},
-std::array<float,2>{0.522582769f, 0.362899333f},
-std::array<float,2>{0.0741250664f, 0.972036064f},
-std::array<float,2>{0.949748397f, 0.654714406f},
-std::array<float,2>{0.422094643f, 0.129743278f},
-std::array<float,2>{0.717005789f, 0.236170575f},
-std::array<float,2>{0.130001232f, 0.703171074f},
-std::array<float,2>{0.752824843f, 0.909597039f},
-std::array<float,2>{0.330930889f, 0.254174978f},
-std::array<float,2>{0.937188387f, 0.37517181f},
-std::array<float,2>{0.438686311f, 0.801643789f},
-std::array<float,2>{0.620062828f, 0.514751434f},
-std::array<float,2>{0.00431998959f, 0.0633461326f},
-std::array<float,2>{0.75449568f, 0.182229325f},
-std::array<float,2>{0.333828211f, 0.665611804f},
-std::array<float,2>{0.712595642f, 0.957969546f},
-std::array<float,2>{0.128542811f, 0.32838878f},
-std::array<float,2>{0.623894334f, 0.456447482f},
-std::array<float,2>{0.00340322545f, 0.872393727f},
-std::array<float,2>{0.932195365f, 0.591867447f},
-std::array<float,2>{0.445307612f, 0.0201495048f},
-std::array<float,2>{0.677793503f, 0.1016993f},
-std::array<float,2>{0.215052411f, 0.532414198f},
-std::array<float,2>{0.825602829f, 0.75292629f},
-std::array<float,2>{0.291856796f, 0.421806544f},
-std::array<float,2>{0.946879089f, 0.290814936f},
-std::array<float,2>{0.42617777f, 0.878449857f},
-std::array<float,2>{0.517603338f, 0.720870256f},
-std::array<float,2>{0.0749576166f, 0.215500295f},
-std::array<float,2>{0.878881574f, 0.0495692231f},
-std::array<float,2>{0.471152663f, 0.601778567f},
-std::array<float,2>{0.576309383f, 0.831137598f},
-std::array<float,2>{0.0320286117f, 0.495286018f},
-std::array<float,2>{0.741909862f, 0.350713551f},
-std::array<float,2>{0.163288862f, 0.998047113f},
-std::array<float,2>{0.795665562f, 0.63466543f},
-std::array<float,2>{0.355247498f, 0.143140286f},
-std::array<float,2>{0.557384729f, 0.221028626f},
-std::array<float,2>{0.119481482f, 0.693608105f},
-std::array<float,2>{0.975011885f, 0.922197104f},
-std::array<float,2>{0.397313446f, 0.275149465f},
-std::array<float,2>{0.84625268f, 0.394807756f},
-std::array<float,2>{0.254847467f, 0.784104049f},
-std::array<float,2>{0.649543405f, 0.515654922f},
-std::array<float,2>{0.237711102f, 0.0783159658f},
-std::array<float,2>{0.986810982f, 0.201402128f},
-std::array<float,2>{0.376877397f, 0.744593978f},
-std::array<float,2>{0.532213628f, 0.903212726f},
-std::array<float,2>{0.0989108235f, 0.30370751f},
-std::array<float,2>{0.635548592f, 0.436527342f},
-std::array<float,2>{0.23044093f, 0.766566575f},
-std::array<float,2>{0.868605554f, 0.549901545f},
-std::array<float,2>{0.267966747f, 0.113447949f},
-std::array<float,2>{0.587521732f, 0.0116697969f},
-std::array<float,2>{0.0543502159f, 0.571556449f},
-std::array<float,2>{0.895800948f, 0.851799428f},
-std::array<float,2>{0.493226528f, 0.452029556f},
-std::array<float,2>{0.801115334f, 0.327153116f},
-std::array<float,2>{0.360743225f, 0.950493336f},
-std::array<float,2>{0.722028732f, 0.684733808f},
-std::array<float,2>{0.177952439f, 0.170222461f},
-std::array<float,2>{0.835959196f, 0.0716732219f},
-std::array<float,2>{0.297395378f, 0.503251672f},
-std::array<float,2>{0.669763803f, 0.806463301f},
-std::array<float,2>{0.197436139f, 0.388496131f},
-std::array<float,2>{0.514864028f, 0.260596246f},
-std::array<float,2>{0.0809674412f, 0.915522575f},
-std::array<float,2>{0.955610216f, 0.715325058f},
-std::array<float,2>{0.421320856f, 0.247616574f},
-std::array<float,2>{0.69654578f, 0.135773897f},
-std::array<float,2>{0.14119114f, 0.641122341f},
-std::array<float,2>{0.778676629f, 0.977182984f},
-std::array<float,2>{0.321676105f, 0.372766405f},
-std::array<float,2>{0.907881796f, 0.478041023f},
-std::array<float,2>{0.458277345f, 0.826161563f},
-std::array<float,2>{0.595697224f, 0.613933861f},
-std::array<float,2>{0.0233341549f, 0.0405822583f},
-std::array<float,2>{0.86558634f, 0.238953963f},
-std::array<float,2>{0.279687792f, 0.710818708f},
-std::array<float,2>{0.631245673f, 0.913958669f},
-std::array<float,2>{0.225427791f, 0.250880063f},
-std::array<float,2>{0.544546604f, 0.379756242f},
-std::array<float,2>{0.105352372f, 0.797759295f},
-std::array<float,2>{0.998028338f, 0.509826005f},
-std::array<float,2>{0.389114588f, 0.0695084035f},
-std::array<float,2>{0.729469776f, 0.034694735f},
-std::array<float,2>{0.182316363f, 0.618449569f},
-std::array<float,2>{0.807488024f, 0.815880358f},
-std::array<float,2>{0.371017665f, 0.473287493f},
-std::array<float,2>{0.900121093f, 0.365680128f},
-std::array<float,2>{0.488687545f, 0.975034237f},
-std::array<float,2>{0.580909252f, 0.652182341f},
-std::array<float,2>{0.0621574149f, 0.128019646f},
-std::array<float,2>{0.96282053f, 0.123339303f},
-std::array<float,2>{0.409282684f, 0.559083581f},
-std::array<float,2>{0.500925064f, 0.773784697f},
-std::array<float,2>{0.0871831328f, 0.427568376f},
-std::array<float,2>{0.659870446f, 0.307955921f},
-std::array<float,2>{0.191796929f, 0.892331183f},
-std::array<float,2>{0.834162951f, 0.741917431f},
-std::array<float,2>{0.308966547f, 0.194030255f},
-std::array<float,2>{0.609001279f, 0.159097821f},
-std::array<float,2>{0.0302557033f, 0.672141969f},
-std::array<float,2>{0.914594829f, 0.945212245f},
-std::array<float,2>{0.466255069f, 0.318822742f},
-std::array<float,2>{0.773282766f, 0.43876493f},
-std::array<float,2>{0.313027859f, 0.847410798f},
-std::array<float,2>{0.691382706f, 0.565851986f},
-std::array<float,2>{0.151723251f, 0.000404178369f},
-std::array<float,2>{0.926042676f, 0.152172253f},
-std::array<float,2>{0.453025609f, 0.625847638f},
-std::array<float,2>{0.612936914f, 0.984880209f},
-std::array<float,2>{0.00965760276f, 0.358072788f},
-std::array<float,2>{0.706841588f, 0.49028188f},
-std::array<float,2>{0.133705437f, 0.83857125f},
-std::array<float,2>{0.761649907f, 0.595767319f},
-std::array<float,2>{0.336088419f, 0.0564012118f},
-std::array<float,2>{0.523607254f, 0.0918424577f},
-std::array<float,2>{0.0682974085f, 0.524576545f},
-std::array<float,2>{0.93905735f, 0.79565376f},
-std::array<float,2>{0.434960067f, 0.403455228f},
-std::array<float,2>{0.814343452f, 0.265721083f},
-std::array<float,2>{0.283591479f, 0.931468606f},
-std::array<float,2>{0.680246174f, 0.700820982f},
-std::array<float,2>{0.206150889f, 0.228026271f},
-std::array<float,2>{0.788235724f, 0.0307634193f},
-std::array<float,2>{0.349583834f, 0.583928525f},
-std::array<float,2>{0.748371124f, 0.861728728f},
-std::array<float,2>{0.171128452f, 0.461747229f},
-std::array<float,2>{0.566779256f, 0.337143779f},
-std::array<float,2>{0.0450540893f, 0.967915952f},
-std::array<float,2>{0.883352816f, 0.660116136f},
-std::array<float,2>{0.480912536f, 0.176837042f},
-std::array<float,2>{0.644667387f, 0.20910576f},
-std::array<float,2>{0.246750683f, 0.730691135f},
-std::array<float,2>{0.853611767f, 0.887802541f},
-std::array<float,2>{0.258544177f, 0.282839656f},
-std::array<float,2>{0.982316136f, 0.410753608f},
-std::array<float,2>{0.403168231f, 0.765255094f},
-std::array<float,2>{0.553900003f, 0.543173373f},
-std::array<float,2>{0.116213962f, 0.0980103463f},
-std::array<float,2>{0.822313011f, 0.129133761f},
-std::array<float,2>{0.293150604f, 0.65517503f},
-std::array<float,2>{0.673382819f, 0.972592354f},
-std::array<float,2>{0.212693155f, 0.36262089f},
-std::array<float,2>{0.521405339f, 0.469234794f},
-std::array<float,2>{0.0714674369f, 0.819836259f},
-std::array<float,2>{0.952766716f, 0.621195257f},
-std::array<float,2>{0.425114155f, 0.0387336202f},
-std::array<float,2>{0.715045989f, 0.0626021922f},
-std::array<float,2>{0.131654054f, 0.515184045f},
-std::array<float,2>{0.751481473f, 0.800964117f},
-std::array<float,2>{0.329437792f, 0.375682026f},
-std::array<float,2>{0.934495807f, 0.25454706f},
-std::array<float,2>{0.44011718f, 0.910071373f},
-std::array<float,2>{0.618746519f, 0.703956604f},
-std::array<float,2>{0.00641160086f, 0.235698313f},
-std::array<float,2>{0.970473588f, 0.00448161922f},
-std::array<float,2>{0.392374128f, 0.570078552f},
-std::array<float,2>{0.559630692f, 0.849197745f},
-std::array<float,2>{0.121143326f, 0.443044454f},
-std::array<float,2>{0.653493941f, 0.314032018f},
-std::array<float,2>{0.240713567f, 0.940781653f},
-std::array<float,2>{0.850505948f, 0.676843643f},
-std::array<float,2>{0.251843572f, 0.161488861f},
-std::array<float,2>{0.572021425f, 0.189417914f},
-std::array<float,2>{0.0352563821f, 0.737886131f},
-std::array<float,2>{0.881652713f, 0.896694183f},
-std::array<float,2>{0.475119501f, 0.309494317f},
-std::array<float,2>{0.789160669f, 0.4237037f},
-std::array<float,2>{0.356413275f, 0.779208004f},
-std::array<float,2>{0.738174379f, 0.554711163f},
-std::array<float,2>{0.159554347f, 0.120516479f},
-std::array<float,2>{0.890854239f, 0.230867937f},
-std::array<float,2>{0.497171015f, 0.697442234f},
-std::array<float,2>{0.591256201f, 0.937311471f},
-std::array<float,2>{0.050260812f, 0.27010563f},
-std::array<float,2>{0.722672045f, 0.400385469f},
-std::array<float,2>{0.172625288f, 0.791427135f},
-std::array<float,2>{0.798484862f, 0.530659139f},
-std::array<float,2>{0.363975227f, 0.0892001092f},
-std::array<float,2>{0.537580967f, 0.0604541339f},
-std::array<float,2>{0.0956560746f, 0.60007149f},
-std::array<float,2>{0.990821242f, 0.8429389f},
-std::array<float,2>{0.381017566f, 0.484606355f},
-std::array<float,2>{0.872567475f, 0.35541001f},
-std::array<float,2>{0.272316813f, 0.990136981f},
-std::array<float,2>{0.63852948f, 0.630825937f},
-std::array<float,2>{0.232018277f, 0.155638322f},
-std::array<float,2>{0.775017381f, 0.0954489037f},
-std::array<float,2>{0.324997425f, 0.540881038f},
-std::array<float,2>{0.702020347f, 0.759935319f},
-std::array<float,2>{0.148174897f, 0.407226026f},
-std::array<float,2>{0.598477483f, 0.285349667f},
-std::array<float,2>{0.0175837707f, 0.885654986f},
-std::array<float,2>{0.913704991f, 0.728841186f},
-std::array<float,2>{0.456161082f, 0.206301406f},
-std::array<float,2>{0.666049361f, 0.173156694f},
-std::array<float,2>{0.202304676f, 0.662315547f},
-std::array<float,2>{0.842681825f, 0.963739693f},
-std::array<float,2>{0.300985724f, 0.343728423f},
-std::array<float,2>{0.960042894f, 0.464902759f},
-std::array<float,2>{0.417164385f, 0.865288854f},
-std::array<float,2>{0.50951159f, 0.57870096f},
-std::array<float,2>{0.0851957127f, 0.0238163508f},
-std::array<float,2>{0.808766067f, 0.21175015f},
-std::array<float,2>{0.374559522f, 0.72435987f},
-std::array<float,2>{0.732658207f, 0.881493628f},
-std::array<float,2>{0.185190141f, 0.295584917f},
-std::array<float,2>{0.584942341f, 0.414984941f},
-std::array<float,2>{0.0581291355f, 0.754282057f},
-std::array<float,2>{0.904942811f, 0.538983107f},
-std::array<float,2>{0.485006362f, 0.106898107f},
-std::array<float,2>{0.628781736f, 0.0185409319f},
-std::array<float,2>{0.221128762f, 0.58714062f},
-std::array<float,2>{0.862597048f, 0.867712975f},
-std::array<float,2>{0.277343035f, 0.45961988f},
-std::array<float,2>{0.996093631f, 0.333343774f},
-std::array<float,2>{0.383097291f, 0.954739451f},
-std::array<float,2>{0.539833128f, 0.670397162f},
-std::array<float,2>{0.105736822f, 0.187270984f},
-std::array<float,2>{0.918228447f, 0.0831974074f},
-std::array<float,2>{0.464759529f, 0.522653818f},
-std::array<float,2>{0.603544772f, 0.788436592f},
-std::array<float,2>{0.0262056012f, 0.392645329f},
-std::array<float,2>{0.691623509f, 0.278640836f},
-std::array<float,2>{0.154365584f, 0.928817332f},
-std::array<float,2>{0.769048035f, 0.687514365f},
-std::array<float,2>{0.31795606f, 0.223408416f},
-std::array<float,2>{0.507598817f, 0.146588489f},
-std::array<float,2>{0.0918411091f, 0.637289345f},
-std::array<float,2>{0.968691945f, 0.992847621f},
-std::array<float,2>{0.413667768f, 0.345201373f},
-std::array<float,2>{0.83080405f, 0.497005165f},
-std::array<float,2>{0.30801788f, 0.834660292f},
-std::array<float,2>{0.661709249f, 0.60618782f},
-std::array<float,2>{0.18810451f, 0.0514280833f},
-std::array<float,2>{0.943440735f, 0.167052135f},
-std::array<float,2>{0.43267259f, 0.683581829f},
-std::array<float,2>{0.52822262f, 0.945609093f},
-std::array<float,2>{0.0645361319f, 0.323362708f},
-std::array<float,2>{0.685379207f, 0.446368963f},
-std::array<float,2>{0.210517004f, 0.855978906f},
-std::array<float,2>{0.817397356f, 0.574647486f},
-std::array<float,2>{0.28887549f, 0.0118887872f},
-std::array<float,2>{0.61433202f, 0.111283064f},
-std::array<float,2>{0.0117860772f, 0.551579237f},
-std::array<float,2>{0.923837841f, 0.773230731f},
-std::array<float,2>{0.446478218f, 0.431522548f},
-std::array<float,2>{0.763027549f, 0.298937201f},
-std::array<float,2>{0.34342593f, 0.898943007f},
-std::array<float,2>{0.707759261f, 0.746930003f},
-std::array<float,2>{0.139536902f, 0.197456986f},
-std::array<float,2>{0.856018662f, 0.0457639657f},
-std::array<float,2>{0.263157934f, 0.609375834f},
-std::array<float,2>{0.640992284f, 0.822933376f},
-std::array<float,2>{0.242581293f, 0.483384758f},
-std::array<float,2>{0.550549626f, 0.369124115f},
-std::array<float,2>{0.112080559f, 0.98208946f},
-std::array<float,2>{0.97985667f, 0.645738125f},
-std::array<float,2>{0.400530726f, 0.139356643f},
-std::array<float,2>{0.744203448f, 0.243694365f},
-std::array<float,2>{0.166835293f, 0.710994482f},
-std::array<float,2>{0.784097493f, 0.919720531f},
-std::array<float,2>{0.344878286f, 0.262961745f},
-std::array<float,2>{0.890067399f, 0.383271188f},
-std::array<float,2>{0.480283499f, 0.811789274f},
-std::array<float,2>{0.565199137f, 0.507166684f},
-std::array<float,2>{0.0421091877f, 0.0757314339f},
-std::array<float,2>{0.793821156f, 0.14184837f},
-std::array<float,2>{0.352333248f, 0.636231422f},
-std::array<float,2>{0.73969543f, 0.996295035f},
-std::array<float,2>{0.160430953f, 0.348271817f},
-std::array<float,2>{0.575521171f, 0.492803097f},
-std::array<float,2>{0.0343977958f, 0.829709232f},
-std::array<float,2>{0.876862526f, 0.604661763f},
-std::array<float,2>{0.469676197f, 0.0478610918f},
-std::array<float,2>{0.650459945f, 0.080512315f},
-std::array<float,2>{0.235368311f, 0.518720686f},
-std::array<float,2>{0.8456918f, 0.782760203f},
-std::array<float,2>{0.257656991f, 0.397603452f},
-std::array<float,2>{0.973471999f, 0.277124852f},
-std::array<float,2>{0.395176947f, 0.925684333f},
-std::array<float,2>{0.55635947f, 0.693026543f},
-std::array<float,2>{0.119006999f, 0.220206842f},
-std::array<float,2>{0.930271924f, 0.0218475461f},
-std::array<float,2>{0.44236052f, 0.591466546f},
-std::array<float,2>{0.62128216f, 0.873350441f},
-std::array<float,2>{0.000664929161f, 0.454461336f},
-std::array<float,2>{0.713783324f, 0.331872076f},
-std::array<float,2>{0.12680462f, 0.960104167f},
-std::array<float,2>{0.756720364f, 0.667554736f},
-std::array<float,2>{0.334013522f, 0.181325838f},
-std::array<float,2>{0.517171681f, 0.218345016f},
-std::array<float,2>{0.0779015869f, 0.719688296f},
-std::array<float,2>{0.947555184f, 0.876352668f},
-std::array<float,2>{0.429102629f, 0.292090654f},
-std::array<float,2>{0.826410353f, 0.418004274f},
-std::array<float,2>{0.290177196f, 0.750636816f},
-std::array<float,2>{0.675993741f, 0.533294261f},
-std::array<float,2>{0.216853052f, 0.105009392f},
-std::array<float,2>{0.954607606f, 0.24961248f},
-std::array<float,2>{0.419710577f, 0.71819222f},
-std::array<float,2>{0.513642967f, 0.917504013f},
-std::array<float,2>{0.0785224587f, 0.258535355f},
-std::array<float,2>{0.671133459f, 0.389253706f},
-std::array<float,2>{0.195579216f, 0.807431996f},
-std::array<float,2>{0.837916493f, 0.501336515f},
-std::array<float,2>{0.299024731f, 0.0734384805f},
-std::array<float,2>{0.597346425f, 0.0421836302f},
-std::array<float,2>{0.0199875887f, 0.615274966f},
-std::array<float,2>{0.908536911f, 0.826774776f},
-std::array<float,2>{0.460281342f, 0.479592472f},
-std::array<float,2>{0.779974878f, 0.374495f},
-std::array<float,2>{0.323989272f, 0.978961229f},
-std::array<float,2>{0.698415101f, 0.642763078f},
-std::array<float,2>{0.142635688f, 0.132942572f},
-std::array<float,2>{0.869626701f, 0.115794346f},
-std::array<float,2>{0.267276436f, 0.548488796f},
-std::array<float,2>{0.633775771f, 0.768795073f},
-std::array<float,2>{0.227120593f, 0.435109138f},
-std::array<float,2>{0.533757448f, 0.302482754f},
-std::array<float,2>{0.100612722f, 0.905513465f},
-std::array<float,2>{0.984467268f, 0.742283106f},
-std::array<float,2>{0.377198189f, 0.200912073f},
-std::array<float,2>{0.720209956f, 0.168988943f},
-std::array<float,2>{0.177149922f, 0.686166525f},
-std::array<float,2>{0.802965522f, 0.951639175f},
-std::array<float,2>{0.362848788f, 0.325252533f},
-std::array<float,2>{0.897737145f, 0.449709743f},
-std::array<float,2>{0.494228929f, 0.854286671f},
-std::array<float,2>{0.588016987f, 0.572585404f},
-std::array<float,2>{0.0515654944f, 0.00793971587f},
-std::array<float,2>{0.83259505f, 0.193159774f},
-std::array<float,2>{0.311860204f, 0.739935935f},
-std::array<float,2>{0.657518387f, 0.893833399f},
-std::array<float,2>{0.194483668f, 0.306111217f},
-std::array<float,2>{0.502711117f, 0.429029614f},
-std::array<float,2>{0.0896579325f, 0.777333081f},
-std::array<float,2>{0.963675261f, 0.561683953f},
-std::array<float,2>{0.406744242f, 0.122519426f},
-std::array<float,2>{0.689006567f, 0.00377781806f},
-std::array<float,2>{0.149882928f, 0.564373791f},
-std::array<float,2>{0.769741178f, 0.845624745f},
-std::array<float,2>{0.315261841f, 0.440900564f},
-std::array<float,2>{0.917468548f, 0.3183406f},
-std::array<float,2>{0.467316091f, 0.941524506f},
-std::array<float,2>{0.606452525f, 0.674188256f},
-std::array<float,2>{0.0290704332f, 0.157269686f},
-std::array<float,2>{0.999894083f, 0.0667603835f},
-std::array<float,2>{0.387275606f, 0.508037746f},
-std::array<float,2>{0.546342313f, 0.79942584f},
-std::array<float,2>{0.101667091f, 0.382773966f},
-std::array<float,2>{0.629177928f, 0.251968622f},
-std::array<float,2>{0.223308712f, 0.911227405f},
-std::array<float,2>{0.863557756f, 0.707301259f},
-std::array<float,2>{0.27805087f, 0.241279528f},
-std::array<float,2>{0.579264104f, 0.126397043f},
-std::array<float,2>{0.058829993f, 0.648785651f},
-std::array<float,2>{0.902314425f, 0.973368824f},
-std::array<float,2>{0.491824359f, 0.364999145f},
-std::array<float,2>{0.805431068f, 0.476435065f},
-std::array<float,2>{0.368357241f, 0.813409507f},
-std::array<float,2>{0.72847724f, 0.620255351f},
-std::array<float,2>{0.179887518f, 0.0314737484f},
-std::array<float,2>{0.886030495f, 0.178442985f},
-std::array<float,2>{0.484149367f, 0.656562448f},
-std::array<float,2>{0.569120109f, 0.965176642f},
-std::array<float,2>{0.0431913175f, 0.338248909f},
-std::array<float,2>{0.746181011f, 0.463761508f},
-std::array<float,2>{0.169823691f, 0.860459507f},
-std::array<float,2>{0.785929084f, 0.584367514f},
-std::array<float,2>{0.350050211f, 0.0281818267f},
-std::array<float,2>{0.551610351f, 0.100824997f},
-std::array<float,2>{0.114330478f, 0.545784831f},
-std::array<float,2>{0.982859433f, 0.762935758f},
-std::array<float,2>{0.405169785f, 0.412339509f},
-std::array<float,2>{0.852152944f, 0.28353712f},
-std::array<float,2>{0.260900289f, 0.889772832f},
-std::array<float,2>{0.647578895f, 0.732730269f},
-std::array<float,2>{0.249871835f, 0.208895624f},
-std::array<float,2>{0.757968426f, 0.058257442f},
-std::array<float,2>{0.338477314f, 0.59506619f},
-std::array<float,2>{0.703906298f, 0.836826086f},
-std::array<float,2>{0.135234758f, 0.48898679f},
-std::array<float,2>{0.61018616f, 0.357090831f},
-std::array<float,2>{0.0106802974f, 0.986849308f},
-std::array<float,2>{0.928999782f, 0.627897918f},
-std::array<float,2>{0.450080246f, 0.149158657f},
-std::array<float,2>{0.683113456f, 0.229797125f},
-std::array<float,2>{0.2040025f, 0.701277435f},
-std::array<float,2>{0.815207064f, 0.931663752f},
-std::array<float,2>{0.281560242f, 0.268001169f},
-std::array<float,2>{0.940268278f, 0.40541026f},
-std::array<float,2>{0.436079741f, 0.794887424f},
-std::array<float,2>{0.526444495f, 0.526023388f},
-std::array<float,2>{0.0701119378f, 0.090615198f},
-std::array<float,2>{0.84921068f, 0.163662821f},
-std::array<float,2>{0.251975864f, 0.678863227f},
-std::array<float,2>{0.655208349f, 0.937939763f},
-std::array<float,2>{0.238806561f, 0.315757871f},
-std::array<float,2>{0.562097907f, 0.444559336f},
-std::array<float,2>{0.124981403f, 0.851481855f},
-std::array<float,2>{0.97078073f, 0.568000853f},
-std::array<float,2>{0.394180924f, 0.00603003474f},
-std::array<float,2>{0.735725999f, 0.117388509f},
-std::array<float,2>{0.157678932f, 0.557339489f},
-std::array<float,2>{0.792399228f, 0.779602528f},
-std::array<float,2>{0.357557297f, 0.424199879f},
-std::array<float,2>{0.879663885f, 0.311416924f},
-std::array<float,2>{0.473337084f, 0.894749701f},
-std::array<float,2>{0.572790325f, 0.734759212f},
-std::array<float,2>{0.0386050306f, 0.190194681f},
-std::array<float,2>{0.949252844f, 0.0364269055f},
-std::array<float,2>{0.422553211f, 0.624547899f},
-std::array<float,2>{0.523240566f, 0.817813277f},
-std::array<float,2>{0.0735141262f, 0.472616017f},
-std::array<float,2>{0.675092518f, 0.361170501f},
-std::array<float,2>{0.21316345f, 0.969440401f},
-std::array<float,2>{0.820937812f, 0.652554154f},
-std::array<float,2>{0.294991702f, 0.132581562f},
-std::array<float,2>{0.619440913f, 0.237272069f},
-std::array<float,2>{0.0048826714f, 0.706551731f},
-std::array<float,2>{0.936791897f, 0.907704771f},
-std::array<float,2>{0.439360917f, 0.25627771f},
-std::array<float,2>{0.752124846f, 0.377622336f},
-std::array<float,2>{0.330323547f, 0.803936541f},
-std::array<float,2>{0.717330694f, 0.512037396f},
-std::array<float,2>{0.130505159f, 0.0661739334f},
-std::array<float,2>{0.910469413f, 0.203272313f},
-std::array<float,2>{0.454131782f, 0.726735055f},
-std::array<float,2>{0.60025233f, 0.883936167f},
-std::array<float,2>{0.0173667166f, 0.287598163f},
-std::array<float,2>{0.700776279f, 0.409350961f},
-std::array<float,2>{0.146337941f, 0.759579659f},
-std::array<float,2>{0.776307642f, 0.542311609f},
-std::array<float,2>{0.326597154f, 0.0970527306f},
-std::array<float,2>{0.510406613f, 0.0256568287f},
-std::array<float,2>{0.0834590644f, 0.580892086f},
-std::array<float,2>{0.958067775f, 0.86487323f},
-std::array<float,2>{0.415126443f, 0.467416257f},
-std::array<float,2>{0.840089977f, 0.341492027f},
-std::array<float,2>{0.302848011f, 0.961964726f},
-std::array<float,2>{0.665900528f, 0.660427928f},
-std::array<float,2>{0.199872226f, 0.174762115f},
-std::array<float,2>{0.80032593f, 0.0863448381f},
-std::array<float,2>{0.365809321f, 0.528425097f},
-std::array<float,2>{0.725634933f, 0.79059267f},
-std::array<float,2>{0.175281316f, 0.402296364f},
-std::array<float,2>{0.592233598f, 0.27284047f},
-std::array<float,2>{0.0482944585f, 0.935314417f},
-std::array<float,2>{0.893718064f, 0.695943356f},
-std::array<float,2>{0.499117851f, 0.233139142f},
-std::array<float,2>{0.639427662f, 0.153759554f},
-std::array<float,2>{0.232746467f, 0.632320523f},
-std::array<float,2>{0.873392582f, 0.990384638f},
-std::array<float,2>{0.270519078f, 0.352333009f},
-std::array<float,2>{0.989571691f, 0.488175541f},
-std::array<float,2>{0.379420996f, 0.841774404f},
-std::array<float,2>{0.536775589f, 0.597841084f},
-std::array<float,2>{0.097497724f, 0.0623397157f},
-std::array<float,2>{0.766503811f, 0.225998759f},
-std::array<float,2>{0.319847375f, 0.689707637f},
-std::array<float,2>{0.693410456f, 0.927728474f},
-std::array<float,2>{0.15404056f, 0.280936748f},
-std::array<float,2>{0.602354288f, 0.392135829f},
-std::array<float,2>{0.0249046478f, 0.786194801f},
-std::array<float,2>{0.920665085f, 0.519816279f},
-std::array<float,2>{0.461511403f, 0.0857314318f},
-std::array<float,2>{0.663536787f, 0.0538081788f},
-std::array<float,2>{0.189483717f, 0.609133601f},
-std::array<float,2>{0.830072641f, 0.832427025f},
-std::array<float,2>{0.306132227f, 0.499570757f},
-std::array<float,2>{0.965718329f, 0.346226513f},
-std::array<float,2>{0.410337895f, 0.995273709f},
-std::array<float,2>{0.505065441f, 0.639027715f},
-std::array<float,2>{0.0905887708f, 0.144713849f},
-std::array<float,2>{0.902950823f, 0.108480811f},
-std::array<float,2>{0.486908704f, 0.536761582f},
-std::array<float,2>{0.583907187f, 0.756873727f},
-std::array<float,2>{0.0556466728f, 0.416671664f},
-std::array<float,2>{0.732366681f, 0.293234557f},
-std::array<float,2>{0.185584441f, 0.879579127f},
-std::array<float,2>{0.811693668f, 0.726468861f},
-std::array<float,2>{0.372286856f, 0.214557618f},
-std::array<float,2>{0.541721404f, 0.184903353f},
-std::array<float,2>{0.108741365f, 0.66939944f},
-std::array<float,2>{0.993271232f, 0.955560386f},
-std::array<float,2>{0.386192054f, 0.335265666f},
-std::array<float,2>{0.85951966f, 0.458455473f},
-std::array<float,2>{0.274126142f, 0.870094478f},
-std::array<float,2>{0.626538277f, 0.588318825f},
-std::array<float,2>{0.219305709f, 0.017131133f},
-std::array<float,2>{0.976882875f, 0.136813268f},
-std::array<float,2>{0.398534745f, 0.646816134f},
-std::array<float,2>{0.547071338f, 0.982597709f},
-std::array<float,2>{0.110409074f, 0.369517535f},
-std::array<float,2>{0.642783165f, 0.481726021f},
-std::array<float,2>{0.244316697f, 0.820611358f},
-std::array<float,2>{0.859114289f, 0.611667573f},
-std::array<float,2>{0.264768392f, 0.0441609845f},
-std::array<float,2>{0.563894451f, 0.0776765719f},
-std::array<float,2>{0.0392994843f, 0.504823923f},
-std::array<float,2>{0.888561428f, 0.809392095f},
-std::array<float,2>{0.476788253f, 0.386027068f},
-std::array<float,2>{0.781655073f, 0.26551953f},
-std::array<float,2>{0.34735465f, 0.919947445f},
-std::array<float,2>{0.74296242f, 0.713911653f},
-std::array<float,2>{0.165171906f, 0.244641319f},
-std::array<float,2>{0.819675624f, 0.014449792f},
-std::array<float,2>{0.286719292f, 0.576327562f},
-std::array<float,2>{0.68731457f, 0.858539999f},
-std::array<float,2>{0.207611263f, 0.448332876f},
-std::array<float,2>{0.53077817f, 0.32195586f},
-std::array<float,2>{0.0633036867f, 0.94792825f},
-std::array<float,2>{0.942369163f, 0.680093527f},
-std::array<float,2>{0.430242568f, 0.165247917f},
-std::array<float,2>{0.710466146f, 0.195738688f},
-std::array<float,2>{0.136733398f, 0.748174906f},
-std::array<float,2>{0.765535831f, 0.901771128f},
-std::array<float,2>{0.340242416f, 0.297106862f},
-std::array<float,2>{0.923784494f, 0.433528781f},
-std::array<float,2>{0.447303265f, 0.770823836f},
-std::array<float,2>{0.616229534f, 0.554028273f},
-std::array<float,2>{0.0151387574f, 0.112800509f},
-std::array<float,2>{0.77786392f, 0.134689793f},
-std::array<float,2>{0.320824057f, 0.64420557f},
-std::array<float,2>{0.695684254f, 0.979895353f},
-std::array<float,2>{0.142349333f, 0.373691767f},
-std::array<float,2>{0.594263017f, 0.479044795f},
-std::array<float,2>{0.0223712325f, 0.827527225f},
-std::array<float,2>{0.907063603f, 0.616414189f},
-std::array<float,2>{0.457296818f, 0.0412405618f},
-std::array<float,2>{0.668477178f, 0.0723058283f},
-std::array<float,2>{0.199007869f, 0.50043112f},
-std::array<float,2>{0.837469399f, 0.808584929f},
-std::array<float,2>{0.298633665f, 0.390583217f},
-std::array<float,2>{0.956200123f, 0.259219915f},
-std::array<float,2>{0.420210838f, 0.916928232f},
-std::array<float,2>{0.513813257f, 0.717481434f},
-std::array<float,2>{0.0811806321f, 0.248199537f},
-std::array<float,2>{0.894711137f, 0.00909513049f},
-std::array<float,2>{0.492950052f, 0.573515177f},
-std::array<float,2>{0.586181045f, 0.854714155f},
-std::array<float,2>{0.0529104881f, 0.450206965f},
-std::array<float,2>{0.721369445f, 0.324854463f},
-std::array<float,2>{0.179162323f, 0.953119099f},
-std::array<float,2>{0.801781416f, 0.686736584f},
-std::array<float,2>{0.360014439f, 0.168420479f},
-std::array<float,2>{0.532783151f, 0.199417323f},
-std::array<float,2>{0.0982264355f, 0.743531346f},
-std::array<float,2>{0.987617016f, 0.904407442f},
-std::array<float,2>{0.375139117f, 0.30106622f},
-std::array<float,2>{0.868103802f, 0.433714986f},
-std::array<float,2>{0.268741757f, 0.767663896f},
-std::array<float,2>{0.636443436f, 0.54696697f},
-std::array<float,2>{0.228651002f, 0.117052063f},
-std::array<float,2>{0.976542652f, 0.219595358f},
-std::array<float,2>{0.398122579f, 0.691998124f},
-std::array<float,2>{0.558036208f, 0.924497008f},
-std::array<float,2>{0.120179594f, 0.276304662f},
-std::array<float,2>{0.648580015f, 0.397242963f},
-std::array<float,2>{0.236525714f, 0.78167969f},
-std::array<float,2>{0.846894622f, 0.517994106f},
-std::array<float,2>{0.255479932f, 0.0816611424f},
-std::array<float,2>{0.577559233f, 0.0472008586f},
-std::array<float,2>{0.032746926f, 0.603778005f},
-std::array<float,2>{0.877205551f, 0.82892102f},
-std::array<float,2>{0.472644836f, 0.493473798f},
-std::array<float,2>{0.796227455f, 0.34890154f},
-std::array<float,2>{0.354282916f, 0.997089386f},
-std::array<float,2>{0.740625262f, 0.635325372f},
-std::array<float,2>{0.162472561f, 0.14089027f},
-std::array<float,2>{0.825011492f, 0.104286447f},
-std::array<float,2>{0.292859107f, 0.534784019f},
-std::array<float,2>{0.679339647f, 0.751704931f},
-std::array<float,2>{0.215898365f, 0.419294029f},
-std::array<float,2>{0.519173443f, 0.291600376f},
-std::array<float,2>{0.0752505213f, 0.875849903f},
-std::array<float,2>{0.946159124f, 0.720448852f},
-std::array<float,2>{0.426959097f, 0.217595667f},
-std::array<float,2>{0.711504877f, 0.180218399f},
-std::array<float,2>{0.127861664f, 0.666971385f},
-std::array<float,2>{0.755206168f, 0.959151566f},
-std::array<float,2>{0.332407892f, 0.331044316f},
-std::array<float,2>{0.932897508f, 0.453504622f},
-std::array<float,2>{0.444125205f, 0.874576211f},
-std::array<float,2>{0.624445975f, 0.590163767f},
-std::array<float,2>{0.00282222987f, 0.0232455023f},
-std::array<float,2>{0.855310917f, 0.207613066f},
-std::array<float,2>{0.259527028f, 0.733479738f},
-std::array<float,2>{0.645912468f, 0.888786674f},
-std::array<float,2>{0.248014227f, 0.285146594f},
-std::array<float,2>{0.552821338f, 0.413937926f},
-std::array<float,2>{0.115814358f, 0.76267904f},
-std::array<float,2>{0.980486989f, 0.546030462f},
-std::array<float,2>{0.404242933f, 0.0998599902f},
-std::array<float,2>{0.749141037f, 0.0285667032f},
-std::array<float,2>{0.170713603f, 0.585828662f},
-std::array<float,2>{0.787291527f, 0.859633267f},
-std::array<float,2>{0.347793519f, 0.464112282f},
-std::array<float,2>{0.884149313f, 0.338867247f},
-std::array<float,2>{0.48227486f, 0.966228843f},
-std::array<float,2>{0.567596972f, 0.658118963f},
-std::array<float,2>{0.0460204668f, 0.17911534f},
-std::array<float,2>{0.938169718f, 0.0913009644f},
-std::array<float,2>{0.434510529f, 0.527266085f},
-std::array<float,2>{0.524872839f, 0.79307127f},
-std::array<float,2>{0.0670963451f, 0.405032098f},
-std::array<float,2>{0.681506991f, 0.268842995f},
-std::array<float,2>{0.205163762f, 0.932917535f},
-std::array<float,2>{0.813465238f, 0.702339351f},
-std::array<float,2>{0.285052836f, 0.228655815f},
-std::array<float,2>{0.612213016f, 0.150312379f},
-std::array<float,2>{0.00820958056f, 0.628847241f},
-std::array<float,2>{0.926864624f, 0.988206387f},
-std::array<float,2>{0.452087045f, 0.356149584f},
-std::array<float,2>{0.760556757f, 0.490090698f},
-std::array<float,2>{0.337753534f, 0.837053835f},
-std::array<float,2>{0.705791771f, 0.594066501f},
-std::array<float,2>{0.134743214f, 0.057351198f},
-std::array<float,2>{0.9154073f, 0.157207668f},
-std::array<float,2>{0.465803385f, 0.674940407f},
-std::array<float,2>{0.607499421f, 0.942417979f},
-std::array<float,2>{0.0304931551f, 0.316543579f},
-std::array<float,2>{0.689758003f, 0.439655393f},
-std::array<float,2>{0.150722757f, 0.843829453f},
-std::array<float,2>{0.772246242f, 0.563405454f},
-std::array<float,2>{0.313872814f, 0.00278019207f},
-std::array<float,2>{0.501120985f, 0.122030698f},
-std::array<float,2>{0.0866155028f, 0.561268568f},
-std::array<float,2>{0.961221159f, 0.775672078f},
-std::array<float,2>{0.408443034f, 0.427835405f},
-std::array<float,2>{0.835911572f, 0.304732531f},
-std::array<float,2>{0.309996992f, 0.892927647f},
-std::array<float,2>{0.658942282f, 0.738631964f},
-std::array<float,2>{0.193164676f, 0.191408753f},
-std::array<float,2>{0.807895362f, 0.0330385007f},
-std::array<float,2>{0.369516492f, 0.619262218f},
-std::array<float,2>{0.729597747f, 0.813509285f},
-std::array<float,2>{0.182945088f, 0.475497872f},
-std::array<float,2>{0.581985831f, 0.363444537f},
-std::array<float,2>{0.0612818748f, 0.974063694f},
-std::array<float,2>{0.898805261f, 0.64978832f},
-std::array<float,2>{0.490172982f, 0.125173062f},
-std::array<float,2>{0.63235265f, 0.2404387f},
-std::array<float,2>{0.226525217f, 0.708080351f},
-std::array<float,2>{0.866785347f, 0.910980999f},
-std::array<float,2>{0.280328214f, 0.253464252f},
-std::array<float,2>{0.996449828f, 0.380863011f},
-std::array<float,2>{0.390388876f, 0.800252378f},
-std::array<float,2>{0.543331623f, 0.509275913f},
-std::array<float,2>{0.104034163f, 0.0679255873f},
-std::array<float,2>{0.843255401f, 0.175076947f},
-std::array<float,2>{0.302175075f, 0.661758125f},
-std::array<float,2>{0.66764462f, 0.961751819f},
-std::array<float,2>{0.201491803f, 0.340695471f},
-std::array<float,2>{0.508065462f, 0.468176156f},
-std::array<float,2>{0.0841271803f, 0.864211917f},
-std::array<float,2>{0.959180772f, 0.58107239f},
-std::array<float,2>{0.416358441f, 0.0272550825f},
-std::array<float,2>{0.702652335f, 0.0960828513f},
-std::array<float,2>{0.146873087f, 0.541401327f},
-std::array<float,2>{0.774064779f, 0.758023202f},
-std::array<float,2>{0.326096088f, 0.408847123f},
-std::array<float,2>{0.912910283f, 0.2881293f},
-std::array<float,2>{0.455911309f, 0.883292496f},
-std::array<float,2>{0.599150658f, 0.728045106f},
-std::array<float,2>{0.0194277782f, 0.204902381f},
-std::array<float,2>{0.991339028f, 0.0608366169f},
-std::array<float,2>{0.382066846f, 0.598766029f},
-std::array<float,2>{0.539059937f, 0.840658426f},
-std::array<float,2>{0.0946091488f, 0.487234235f},
-std::array<float,2>{0.636767387f, 0.352724165f},
-std::array<float,2>{0.230848715f, 0.991625488f},
-std::array<float,2>{0.871570468f, 0.630894721f},
-std::array<float,2>{0.273418337f, 0.152575895f},
-std::array<float,2>{0.590121567f, 0.23354964f},
-std::array<float,2>{0.0491379052f, 0.696703553f},
-std::array<float,2>{0.892499745f, 0.934569538f},
-std::array<float,2>{0.496198207f, 0.272262275f},
-std::array<float,2>{0.797658026f, 0.400811672f},
-std::array<float,2>{0.364296734f, 0.789184928f},
-std::array<float,2>{0.723823488f, 0.527427256f},
-std::array<float,2>{0.173783511f, 0.087834768f},
-std::array<float,2>{0.882252216f, 0.190648079f},
-std::array<float,2>{0.476148874f, 0.736222684f},
-std::array<float,2>{0.570995212f, 0.896380961f},
-std::array<float,2>{0.0370174944f, 0.312003523f},
-std::array<float,2>{0.737074614f, 0.425542176f},
-std::array<float,2>{0.158511549f, 0.780370176f},
-std::array<float,2>{0.790281475f, 0.558431625f},
-std::array<float,2>{0.356462032f, 0.118362628f},
-std::array<float,2>{0.559208274f, 0.00728841498f},
-std::array<float,2>{0.12262591f, 0.566774845f},
-std::array<float,2>{0.969030499f, 0.85017246f},
-std::array<float,2>{0.39154616f, 0.444268912f},
-std::array<float,2>{0.851090908f, 0.31538254f},
-std::array<float,2>{0.250119597f, 0.938923776f},
-std::array<float,2>{0.653000057f, 0.677916586f},
-std::array<float,2>{0.241915256f, 0.162665233f},
-std::array<float,2>{0.750559449f, 0.0651687533f},
-std::array<float,2>{0.329036951f, 0.513295174f},
-std::array<float,2>{0.716676116f, 0.80343014f},
-std::array<float,2>{0.132207692f, 0.378434151f},
-std::array<float,2>{0.617821813f, 0.257474154f},
-std::array<float,2>{0.00701886369f, 0.906422734f},
-std::array<float,2>{0.935335636f, 0.705157697f},
-std::array<float,2>{0.441135228f, 0.237891495f},
-std::array<float,2>{0.672380269f, 0.131158888f},
-std::array<float,2>{0.21141088f, 0.654101789f},
-std::array<float,2>{0.82404989f, 0.970151007f},
-std::array<float,2>{0.294445783f, 0.360215455f},
-std::array<float,2>{0.951758146f, 0.470979333f},
-std::array<float,2>{0.424183697f, 0.817048848f},
-std::array<float,2>{0.519781947f, 0.623482227f},
-std::array<float,2>{0.0708651096f, 0.0358626619f},
-std::array<float,2>{0.785008371f, 0.24528107f},
-std::array<float,2>{0.344141304f, 0.713273585f},
-std::array<float,2>{0.7454561f, 0.921645582f},
-std::array<float,2>{0.167584494f, 0.264616817f},
-std::array<float,2>{0.565709352f, 0.385552019f},
-std::array<float,2>{0.0417850949f, 0.809671819f},
-std::array<float,2>{0.889185965f, 0.505704403f},
-std::array<float,2>{0.478815347f, 0.0769906715f},
-std::array<float,2>{0.642111301f, 0.0431961119f},
-std::array<float,2>{0.243737787f, 0.613130271f},
-std::array<float,2>{0.85678947f, 0.821335018f},
-std::array<float,2>{0.262431234f, 0.480785847f},
-std::array<float,2>{0.979045808f, 0.370737523f},
-std::array<float,2>{0.401709676f, 0.98373884f},
-std::array<float,2>{0.548922598f, 0.647571266f},
-std::array<float,2>{0.112647377f, 0.138338059f},
-std::array<float,2>{0.925020397f, 0.111523829f},
-std::array<float,2>{0.445314735f, 0.552901447f},
-std::array<float,2>{0.613496184f, 0.770126224f},
-std::array<float,2>{0.0128805218f, 0.432551056f},
-std::array<float,2>{0.708527505f, 0.298405558f},
-std::array<float,2>{0.140005872f, 0.900812864f},
-std::array<float,2>{0.761876166f, 0.749893785f},
-std::array<float,2>{0.342100441f, 0.196658224f},
-std::array<float,2>{0.528409243f, 0.16482839f},
-std::array<float,2>{0.0660915151f, 0.681027353f},
-std::array<float,2>{0.944862425f, 0.949178457f},
-std::array<float,2>{0.431642503f, 0.321237057f},
-std::array<float,2>{0.817358077f, 0.447930574f},
-std::array<float,2>{0.288071275f, 0.857771099f},
-std::array<float,2>{0.68444711f, 0.577624083f},
-std::array<float,2>{0.209532201f, 0.015605486f},
-std::array<float,2>{0.967125177f, 0.146171272f},
-std::array<float,2>{0.413082272f, 0.640149474f},
-std::array<float,2>{0.505892158f, 0.994703233f},
-std::array<float,2>{0.0934694409f, 0.347001642f},
-std::array<float,2>{0.660246134f, 0.498301387f},
-std::array<float,2>{0.188721746f, 0.833296716f},
-std::array<float,2>{0.831511319f, 0.608067334f},
-std::array<float,2>{0.307090014f, 0.0528043136f},
-std::array<float,2>{0.604873776f, 0.0841050968f},
-std::array<float,2>{0.0272321515f, 0.520638108f},
-std::array<float,2>{0.919011831f, 0.78587997f},
-std::array<float,2>{0.463713408f, 0.390839815f},
-std::array<float,2>{0.76761806f, 0.280051678f},
-std::array<float,2>{0.316865504f, 0.925880134f},
-std::array<float,2>{0.693256438f, 0.691272914f},
-std::array<float,2>{0.155515373f, 0.225031272f},
-std::array<float,2>{0.862247944f, 0.0165566877f},
-std::array<float,2>{0.275869697f, 0.589406371f},
-std::array<float,2>{0.627682209f, 0.870679975f},
-std::array<float,2>{0.22193341f, 0.457254976f},
-std::array<float,2>{0.540604234f, 0.33486414f},
-std::array<float,2>{0.107346155f, 0.956654906f},
-std::array<float,2>{0.994832456f, 0.668047845f},
-std::array<float,2>{0.384488314f, 0.183628485f},
-std::array<float,2>{0.733870268f, 0.213330343f},
-std::array<float,2>{0.183828816f, 0.725100756f},
-std::array<float,2>{0.809724033f, 0.880125761f},
-std::array<float,2>{0.37363413f, 0.294266194f},
-std::array<float,2>{0.905321836f, 0.417265534f},
-std::array<float,2>{0.485418707f, 0.7566818f},
-std::array<float,2>{0.585379481f, 0.535461605f},
-std::array<float,2>{0.0572292432f, 0.107649066f},
-std::array<float,2>{0.804242969f, 0.171133563f},
-std::array<float,2>{0.361741394f, 0.68397367f},
-std::array<float,2>{0.718810141f, 0.949513257f},
-std::array<float,2>{0.176732913f, 0.32703796f},
-std::array<float,2>{0.589219928f, 0.452925265f},
-std::array<float,2>{0.052708067f, 0.853151023f},
-std::array<float,2>{0.896715701f, 0.570632458f},
-std::array<float,2>{0.49605152f, 0.0100868475f},
-std::array<float,2>{0.634383976f, 0.114416823f},
-std::array<float,2>{0.227612883f, 0.549734294f},
-std::array<float,2>{0.870391011f, 0.767556369f},
-std::array<float,2>{0.265685618f, 0.435567528f},
-std::array<float,2>{0.985416949f, 0.304376215f},
-std::array<float,2>{0.378388911f, 0.904015481f},
-std::array<float,2>{0.53437674f, 0.745137155f},
-std::array<float,2>{0.0999209657f, 0.202820674f},
-std::array<float,2>{0.909949064f, 0.039661061f},
-std::array<float,2>{0.45969817f, 0.614901125f},
-std::array<float,2>{0.595935822f, 0.824854016f},
-std::array<float,2>{0.021035742f, 0.476935476f},
-std::array<float,2>{0.697321832f, 0.371613562f},
-std::array<float,2>{0.143942192f, 0.978507936f},
-std::array<float,2>{0.780609727f, 0.642108202f},
-std::array<float,2>{0.322741359f, 0.134888813f},
-std::array<float,2>{0.511974037f, 0.246776119f},
-std::array<float,2>{0.0798274204f, 0.716496527f},
-std::array<float,2>{0.953758895f, 0.914159298f},
-std::array<float,2>{0.418092787f, 0.261287183f},
-std::array<float,2>{0.839095414f, 0.387521803f},
-std::array<float,2>{0.300727904f, 0.805661976f},
-std::array<float,2>{0.670149803f, 0.502747476f},
-std::array<float,2>{0.196590006f, 0.0710679218f},
-std::array<float,2>{0.948551834f, 0.215856388f},
-std::array<float,2>{0.428144187f, 0.722382307f},
-std::array<float,2>{0.515954435f, 0.87716186f},
-std::array<float,2>{0.0763006955f, 0.289146245f},
-std::array<float,2>{0.677339792f, 0.420526445f},
-std::array<float,2>{0.218703732f, 0.753435016f},
-std::array<float,2>{0.827630937f, 0.531277716f},
-std::array<float,2>{0.289750695f, 0.103483722f},
-std::array<float,2>{0.622166157f, 0.0206039213f},
-std::array<float,2>{0.00126060087f, 0.592953205f},
-std::array<float,2>{0.931370914f, 0.872044265f},
-std::array<float,2>{0.442734033f, 0.455990493f},
-std::array<float,2>{0.757199228f, 0.329321325f},
-std::array<float,2>{0.335208833f, 0.958302021f},
-std::array<float,2>{0.714826763f, 0.664864779f},
-std::array<float,2>{0.125355363f, 0.18306911f},
-std::array<float,2>{0.844010055f, 0.0800158605f},
-std::array<float,2>{0.256649166f, 0.51731801f},
-std::array<float,2>{0.651632667f, 0.784754634f},
-std::array<float,2>{0.235257983f, 0.39642483f},
-std::array<float,2>{0.555158138f, 0.273650676f},
-std::array<float,2>{0.117648765f, 0.923106611f},
-std::array<float,2>{0.974383831f, 0.694408774f},
-std::array<float,2>{0.395552605f, 0.222624049f},
-std::array<float,2>{0.738470376f, 0.144009575f},
-std::array<float,2>{0.161395296f, 0.633506179f},
-std::array<float,2>{0.794154644f, 0.999421477f},
-std::array<float,2>{0.35349685f, 0.349746853f},
-std::array<float,2>{0.875653028f, 0.494153768f},
-std::array<float,2>{0.469872087f, 0.830732524f},
-std::array<float,2>{0.574924231f, 0.602827907f},
-std::array<float,2>{0.0333174989f, 0.0502201393f},
-std::array<float,2>{0.815749288f, 0.226917952f},
-std::array<float,2>{0.282266408f, 0.699448407f},
-std::array<float,2>{0.682176113f, 0.930351853f},
-std::array<float,2>{0.204908147f, 0.267238408f},
-std::array<float,2>{0.525453389f, 0.403086632f},
-std::array<float,2>{0.0691075698f, 0.796194017f},
-std::array<float,2>{0.940840364f, 0.524096906f},
-std::array<float,2>{0.436640799f, 0.0932397768f},
-std::array<float,2>{0.704125404f, 0.0552000515f},
-std::array<float,2>{0.136333093f, 0.596900642f},
-std::array<float,2>{0.759446859f, 0.839475632f},
-std::array<float,2>{0.339742839f, 0.492045969f},
-std::array<float,2>{0.92780745f, 0.358865082f},
-std::array<float,2>{0.450541496f, 0.98592943f},
-std::array<float,2>{0.610405862f, 0.626546085f},
-std::array<float,2>{0.0111591555f, 0.150408998f},
-std::array<float,2>{0.983430505f, 0.0989367142f},
-std::array<float,2>{0.405332267f, 0.544500649f},
-std::array<float,2>{0.552515149f, 0.763869584f},
-std::array<float,2>{0.113339365f, 0.41138947f},
-std::array<float,2>{0.646844327f, 0.282106459f},
-std::array<float,2>{0.248179644f, 0.8869977f},
-std::array<float,2>{0.852751791f, 0.731779456f},
-std::array<float,2>{0.259994745f, 0.210448578f},
-std::array<float,2>{0.569362998f, 0.175935686f},
-std::array<float,2>{0.0446730033f, 0.658734918f},
-std::array<float,2>{0.885486066f, 0.967469335f},
-std::array<float,2>{0.483274609f, 0.336828768f},
-std::array<float,2>{0.786538184f, 0.462509274f},
-std::array<float,2>{0.351332217f, 0.862794578f},
-std::array<float,2>{0.74783057f, 0.582220614f},
-std::array<float,2>{0.168888241f, 0.0301534534f},
-std::array<float,2>{0.900904715f, 0.127049178f},
-std::array<float,2>{0.490757376f, 0.65047425f},
-std::array<float,2>{0.57845813f, 0.976459444f},
-std::array<float,2>{0.0596147031f, 0.366255254f},
-std::array<float,2>{0.726739645f, 0.474529356f},
-std::array<float,2>{0.180709079f, 0.815093517f},
-std::array<float,2>{0.806346893f, 0.617520809f},
-std::array<float,2>{0.368136108f, 0.0334960036f},
-std::array<float,2>{0.545835853f, 0.0692300424f},
-std::array<float,2>{0.103405051f, 0.511288881f},
-std::array<float,2>{0.998650849f, 0.798470318f},
-std::array<float,2>{0.388234645f, 0.380501628f},
-std::array<float,2>{0.864976048f, 0.251135498f},
-std::array<float,2>{0.278615862f, 0.912889898f},
-std::array<float,2>{0.629894495f, 0.70929265f},
-std::array<float,2>{0.224226877f, 0.239420578f},
-std::array<float,2>{0.770827532f, 0.00189480965f},
-std::array<float,2>{0.316005886f, 0.565290093f},
-std::array<float,2>{0.688146591f, 0.8459692f},
-std::array<float,2>{0.149026796f, 0.437601924f},
-std::array<float,2>{0.605610251f, 0.319777548f},
-std::array<float,2>{0.0280354656f, 0.944055557f},
-std::array<float,2>{0.916027427f, 0.673126042f},
-std::array<float,2>{0.468489408f, 0.159653321f},
-std::array<float,2>{0.65642482f, 0.194693565f},
-std::array<float,2>{0.193536267f, 0.740298688f},
-std::array<float,2>{0.833737969f, 0.890903234f},
-std::array<float,2>{0.310626477f, 0.30758062f},
-std::array<float,2>{0.964282691f, 0.426367819f},
-std::array<float,2>{0.407341093f, 0.775250852f},
-std::array<float,2>{0.502996683f, 0.559597254f},
-std::array<float,2>{0.088485606f, 0.124180458f},
-std::array<float,2>{0.874414325f, 0.155242562f},
-std::array<float,2>{0.269727498f, 0.62975961f},
-std::array<float,2>{0.640088618f, 0.988814056f},
-std::array<float,2>{0.233926579f, 0.353909284f},
-std::array<float,2>{0.535724878f, 0.485393196f},
-std::array<float,2>{0.0966483727f, 0.841839015f},
-std::array<float,2>{0.989103854f, 0.600958884f},
-std::array<float,2>{0.380177081f, 0.0595043227f},
-std::array<float,2>{0.725454628f, 0.0883746967f},
-std::array<float,2>{0.174509048f, 0.529436588f},
-std::array<float,2>{0.799364686f, 0.792624831f},
-std::array<float,2>{0.36629802f, 0.399407297f},
-std::array<float,2>{0.892807305f, 0.271344811f},
-std::array<float,2>{0.498084933f, 0.935600162f},
-std::array<float,2>{0.593481839f, 0.699040949f},
-std::array<float,2>{0.0474035069f, 0.231772289f},
-std::array<float,2>{0.957197368f, 0.0251971427f},
-std::array<float,2>{0.414813936f, 0.579472423f},
-std::array<float,2>{0.511499286f, 0.867045343f},
-std::array<float,2>{0.082749404f, 0.466303349f},
-std::array<float,2>{0.664184809f, 0.342688769f},
-std::array<float,2>{0.201060921f, 0.964759231f},
-std::array<float,2>{0.841420531f, 0.663592577f},
-std::array<float,2>{0.304353446f, 0.172838911f},
-std::array<float,2>{0.60150063f, 0.205783561f},
-std::array<float,2>{0.0156756733f, 0.73014468f},
-std::array<float,2>{0.911212027f, 0.88619107f},
-std::array<float,2>{0.453694582f, 0.287009925f},
-std::array<float,2>{0.777098119f, 0.407460213f},
-std::array<float,2>{0.328027785f, 0.761368096f},
-std::array<float,2>{0.699602485f, 0.539424896f},
-std::array<float,2>{0.145045787f, 0.0938142091f},
-std::array<float,2>{0.935557425f, 0.23501052f},
-std::array<float,2>{0.43757844f, 0.704171002f},
-std::array<float,2>{0.620473623f, 0.908970654f},
-std::array<float,2>{0.00520270178f, 0.255314171f},
-std::array<float,2>{0.71874249f, 0.376507372f},
-std::array<float,2>{0.129712895f, 0.802118301f},
-std::array<float,2>{0.752976716f, 0.514051259f},
-std::array<float,2>{0.331769884f, 0.0635085106f},
-std::array<float,2>{0.521968663f, 0.0379843861f},
-std::array<float,2>{0.0726296231f, 0.622641385f},
-std::array<float,2>{0.950620711f, 0.818588316f},
-std::array<float,2>{0.4235107f, 0.470080197f},
-std::array<float,2>{0.822101057f, 0.361717433f},
-std::array<float,2>{0.296729952f, 0.971039295f},
-std::array<float,2>{0.674114883f, 0.655298114f},
-std::array<float,2>{0.214267716f, 0.130191877f},
-std::array<float,2>{0.791798294f, 0.119577676f},
-std::array<float,2>{0.358858854f, 0.556013405f},
-std::array<float,2>{0.734529972f, 0.777633011f},
-std::array<float,2>{0.15685679f, 0.422015488f},
-std::array<float,2>{0.573814929f, 0.309995353f},
-std::array<float,2>{0.0372266695f, 0.897591591f},
-std::array<float,2>{0.879942179f, 0.736473799f},
-std::array<float,2>{0.473863482f, 0.18841292f},
-std::array<float,2>{0.655710101f, 0.16103825f},
-std::array<float,2>{0.239695922f, 0.675795317f},
-std::array<float,2>{0.848596156f, 0.940123737f},
-std::array<float,2>{0.253477931f, 0.313415289f},
-std::array<float,2>{0.972583055f, 0.441798985f},
-std::array<float,2>{0.393299341f, 0.848143697f},
-std::array<float,2>{0.561294854f, 0.568576097f},
-std::array<float,2>{0.123610556f, 0.00499791047f},
-std::array<float,2>{0.764047742f, 0.198949397f},
-std::array<float,2>{0.340828896f, 0.747217476f},
-std::array<float,2>{0.709385037f, 0.899497509f},
-std::array<float,2>{0.137724906f, 0.299913913f},
-std::array<float,2>{0.615563095f, 0.430156708f},
-std::array<float,2>{0.0141819129f, 0.772257447f},
-std::array<float,2>{0.921880245f, 0.551973164f},
-std::array<float,2>{0.448890895f, 0.109794483f},
-std::array<float,2>{0.686166704f, 0.0131471464f},
-std::array<float,2>{0.20808734f, 0.575299263f},
-std::array<float,2>{0.818930626f, 0.856576264f},
-std::array<float,2>{0.285337985f, 0.44553262f},
-std::array<float,2>{0.942842007f, 0.323163509f},
-std::array<float,2>{0.431509554f, 0.946392596f},
-std::array<float,2>{0.529338241f, 0.681725204f},
-std::array<float,2>{0.0637101382f, 0.16611211f},
-std::array<float,2>{0.886921704f, 0.0748373196f},
-std::array<float,2>{0.477876216f, 0.506701112f},
-std::array<float,2>{0.562530875f, 0.811109185f},
-std::array<float,2>{0.0407281667f, 0.384131134f},
-std::array<float,2>{0.743434906f, 0.26251483f},
-std::array<float,2>{0.164138258f, 0.918499351f},
-std::array<float,2>{0.78242135f, 0.712634385f},
-std::array<float,2>{0.345840812f, 0.242930651f},
-std::array<float,2>{0.54869318f, 0.140018925f},
-std::array<float,2>{0.109433293f, 0.644560218f},
-std::array<float,2>{0.977540374f, 0.980983734f},
-std::array<float,2>{0.399520516f, 0.367641777f},
-std::array<float,2>{0.857548594f, 0.483711094f},
-std::array<float,2>{0.264124781f, 0.823715091f},
-std::array<float,2>{0.643630922f, 0.610852122f},
-std::array<float,2>{0.245631129f, 0.0460379533f},
-std::array<float,2>{0.992780507f, 0.186018795f},
-std::array<float,2>{0.385496825f, 0.671073556f},
-std::array<float,2>{0.542035818f, 0.953773737f},
-std::array<float,2>{0.108019382f, 0.332565069f},
-std::array<float,2>{0.625836432f, 0.460178852f},
-std::array<float,2>{0.220515564f, 0.868293643f},
-std::array<float,2>{0.860629499f, 0.586756527f},
-std::array<float,2>{0.27485466f, 0.0194453392f},
-std::array<float,2>{0.582106411f, 0.10582418f},
-std::array<float,2>{0.0560505725f, 0.538002849f},
-std::array<float,2>{0.90402317f, 0.755624473f},
-std::array<float,2>{0.487954825f, 0.41575703f},
-std::array<float,2>{0.811098874f, 0.295947284f},
-std::array<float,2>{0.371584982f, 0.882130802f},
-std::array<float,2>{0.731115997f, 0.723214209f},
-std::array<float,2>{0.186971575f, 0.212384209f},
-std::array<float,2>{0.828641713f, 0.0526678488f},
-std::array<float,2>{0.305350363f, 0.607376337f},
-std::array<float,2>{0.662967086f, 0.835777819f},
-std::array<float,2>{0.191205963f, 0.497083277f},
-std::array<float,2>{0.504245341f, 0.344223946f},
-std::array<float,2>{0.0914317518f, 0.993411899f},
-std::array<float,2>{0.966686547f, 0.638354003f},
-std::array<float,2>{0.411754251f, 0.147594333f},
-std::array<float,2>{0.694551408f, 0.22411342f},
-std::array<float,2>{0.152360991f, 0.688960314f},
-std::array<float,2>{0.767181575f, 0.92780906f},
-std::array<float,2>{0.31848675f, 0.278218776f},
-std::array<float,2>{0.92141974f, 0.393794894f},
-std::array<float,2>{0.462703198f, 0.787610054f},
-std::array<float,2>{0.602732122f, 0.521698713f},
-std::array<float,2>{0.0235324465f, 0.0827476457f},
-std::array<float,2>{0.774296165f, 0.173378468f},
-std::array<float,2>{0.325907201f, 0.66272831f},
-std::array<float,2>{0.703110635f, 0.962934196f},
-std::array<float,2>{0.146493509f, 0.343248397f},
-std::array<float,2>{0.599456966f, 0.465337962f},
-std::array<float,2>{0.0192226507f, 0.865891159f},
-std::array<float,2>{0.912699282f, 0.578428805f},
-std::array<float,2>{0.455728114f, 0.0240333769f},
-std::array<float,2>{0.667941213f, 0.0950959697f},
-std::array<float,2>{0.201233655f, 0.540170074f},
-std::array<float,2>{0.842781961f, 0.760263741f},
-std::array<float,2>{0.301988631f, 0.406727552f},
-std::array<float,2>{0.959304988f, 0.285942465f},
-std::array<float,2>{0.4161731f, 0.885131717f},
-std::array<float,2>{0.507925093f, 0.729185224f},
-std::array<float,2>{0.084320955f, 0.206929609f},
-std::array<float,2>{0.892133832f, 0.0599658266f},
-std::array<float,2>{0.496462762f, 0.600262821f},
-std::array<float,2>{0.590073228f, 0.84360975f},
-std::array<float,2>{0.048964303f, 0.485108197f},
-std::array<float,2>{0.724089265f, 0.354855031f},
-std::array<float,2>{0.173401594f, 0.989284277f},
-std::array<float,2>{0.797528088f, 0.630340159f},
-std::array<float,2>{0.36464569f, 0.155930713f},
-std::array<float,2>{0.538610637f, 0.231438726f},
-std::array<float,2>{0.0942744017f, 0.698133111f},
-std::array<float,2>{0.991639674f, 0.936867833f},
-std::array<float,2>{0.382104099f, 0.269803435f},
-std::array<float,2>{0.87114799f, 0.399437189f},
-std::array<float,2>{0.273006469f, 0.791874051f},
-std::array<float,2>{0.637137651f, 0.531226218f},
-std::array<float,2>{0.230545714f, 0.0896091908f},
-std::array<float,2>{0.968861461f, 0.188933477f},
-std::array<float,2>{0.391306609f, 0.737752378f},
-std::array<float,2>{0.559463322f, 0.897039711f},
-std::array<float,2>{0.122940801f, 0.308726221f},
-std::array<float,2>{0.653076828f, 0.422872484f},
-std::array<float,2>{0.242005289f, 0.778366327f},
-std::array<float,2>{0.85154295f, 0.555434406f},
-std::array<float,2>{0.250249833f, 0.120732844f},
-std::array<float,2>{0.571130693f, 0.00392197771f},
-std::array<float,2>{0.0367817506f, 0.569794536f},
-std::array<float,2>{0.882007182f, 0.849018872f},
-std::array<float,2>{0.4764494f, 0.442850143f},
-std::array<float,2>{0.790293157f, 0.313729972f},
-std::array<float,2>{0.356908232f, 0.940924883f},
-std::array<float,2>{0.736929595f, 0.677320182f},
-std::array<float,2>{0.158361048f, 0.161842018f},
-std::array<float,2>{0.823790193f, 0.0631716996f},
-std::array<float,2>{0.294746369f, 0.514939249f},
-std::array<float,2>{0.672781885f, 0.801326632f},
-std::array<float,2>{0.211171582f, 0.375390857f},
-std::array<float,2>{0.519724607f, 0.253920913f},
-std::array<float,2>{0.0712201595f, 0.909240425f},
-std::array<float,2>{0.952024519f, 0.703422248f},
-std::array<float,2>{0.42385745f, 0.235973105f},
-std::array<float,2>{0.716449797f, 0.129473746f},
-std::array<float,2>{0.132076472f, 0.65448755f},
-std::array<float,2>{0.750784934f, 0.971885145f},
-std::array<float,2>{0.32885173f, 0.36322245f},
-std::array<float,2>{0.935184002f, 0.469570458f},
-std::array<float,2>{0.441250741f, 0.819572091f},
-std::array<float,2>{0.618071258f, 0.621909678f},
-std::array<float,2>{0.0071349768f, 0.038122382f},
-std::array<float,2>{0.856651545f, 0.243624911f},
-std::array<float,2>{0.262648106f, 0.711678267f},
-std::array<float,2>{0.642441094f, 0.919305861f},
-std::array<float,2>{0.243940532f, 0.263647348f},
-std::array<float,2>{0.549287796f, 0.38337633f},
-std::array<float,2>{0.112479351f, 0.812123895f},
-std::array<float,2>{0.979320407f, 0.507428646f},
-std::array<float,2>{0.401492447f, 0.0753556341f},
-std::array<float,2>{0.745217144f, 0.045101326f},
-std::array<float,2>{0.167880192f, 0.610072553f},
-std::array<float,2>{0.784786761f, 0.822738767f},
-std::array<float,2>{0.343970507f, 0.482799798f},
-std::array<float,2>{0.889529943f, 0.368647635f},
-std::array<float,2>{0.478675157f, 0.981471717f},
-std::array<float,2>{0.565468013f, 0.64621079f},
-std::array<float,2>{0.0415936001f, 0.138787732f},
-std::array<float,2>{0.945304751f, 0.110514343f},
-std::array<float,2>{0.431946903f, 0.551001012f},
-std::array<float,2>{0.528692126f, 0.772775769f},
-std::array<float,2>{0.0663801432f, 0.431093752f},
-std::array<float,2>{0.68427062f, 0.299467742f},
-std::array<float,2>{0.209863842f, 0.898771346f},
-std::array<float,2>{0.817011416f, 0.746205926f},
-std::array<float,2>{0.287771642f, 0.198108166f},
-std::array<float,2>{0.613527954f, 0.167834774f},
-std::array<float,2>{0.0131709073f, 0.682842493f},
-std::array<float,2>{0.925215602f, 0.946213543f},
-std::array<float,2>{0.445735037f, 0.324069679f},
-std::array<float,2>{0.761988759f, 0.447047561f},
-std::array<float,2>{0.341876596f, 0.855513573f},
-std::array<float,2>{0.708851635f, 0.574836612f},
-std::array<float,2>{0.139702618f, 0.0122385239f},
-std::array<float,2>{0.919196725f, 0.147445768f},
-std::array<float,2>{0.463590741f, 0.637075007f},
-std::array<float,2>{0.604499638f, 0.992246211f},
-std::array<float,2>{0.0270428304f, 0.345273376f},
-std::array<float,2>{0.692944527f, 0.49644205f},
-std::array<float,2>{0.155588239f, 0.834359229f},
-std::array<float,2>{0.768022835f, 0.605952203f},
-std::array<float,2>{0.316474885f, 0.0509162173f},
-std::array<float,2>{0.506193697f, 0.0839263052f},
-std::array<float,2>{0.0936589837f, 0.523090065f},
-std::array<float,2>{0.966938615f, 0.788621604f},
-std::array<float,2>{0.412695765f, 0.393107057f},
-std::array<float,2>{0.831108153f, 0.278868794f},
-std::array<float,2>{0.306646615f, 0.929215431f},
-std::array<float,2>{0.660602868f, 0.688137949f},
-std::array<float,2>{0.188513607f, 0.222751483f},
-std::array<float,2>{0.809818506f, 0.0176401455f},
-std::array<float,2>{0.373967409f, 0.58757472f},
-std::array<float,2>{0.73348546f, 0.867405653f},
-std::array<float,2>{0.183961555f, 0.459044248f},
-std::array<float,2>{0.585005581f, 0.333535284f},
-std::array<float,2>{0.0574319176f, 0.95428437f},
-std::array<float,2>{0.905556798f, 0.670509994f},
-std::array<float,2>{0.485667467f, 0.186652571f},
-std::array<float,2>{0.627853215f, 0.211134046f},
-std::array<float,2>{0.221763253f, 0.723682642f},
-std::array<float,2>{0.86197722f, 0.881013215f},
-std::array<float,2>{0.275517136f, 0.295182407f},
-std::array<float,2>{0.994960666f, 0.414123654f},
-std::array<float,2>{0.384660423f, 0.754401863f},
-std::array<float,2>{0.540951073f, 0.538529515f},
-std::array<float,2>{0.107132807f, 0.107244924f},
-std::array<float,2>{0.837766409f, 0.136282831f},
-std::array<float,2>{0.298547506f, 0.640932441f},
-std::array<float,2>{0.668705106f, 0.976899683f},
-std::array<float,2>{0.198735431f, 0.37210989f},
-std::array<float,2>{0.514147043f, 0.477690428f},
-std::array<float,2>{0.0813376456f, 0.825520992f},
-std::array<float,2>{0.956412256f, 0.613282502f},
-std::array<float,2>{0.420083255f, 0.0404173397f},
-std::array<float,2>{0.695412099f, 0.0721421987f},
-std::array<float,2>{0.142125458f, 0.503897786f},
-std::array<float,2>{0.778228343f, 0.806029677f},
-std::array<float,2>{0.321150929f, 0.387953877f},
-std::array<float,2>{0.906862557f, 0.259985059f},
-std::array<float,2>{0.457122386f, 0.915649891f},
-std::array<float,2>{0.594567955f, 0.715686738f},
-std::array<float,2>{0.0221887641f, 0.247208148f},
-std::array<float,2>{0.987419546f, 0.0110901082f},
-std::array<float,2>{0.375320107f, 0.571798921f},
-std::array<float,2>{0.533086479f, 0.852503955f},
-std::array<float,2>{0.0983970836f, 0.451555431f},
-std::array<float,2>{0.636531532f, 0.32776323f},
-std::array<float,2>{0.228882492f, 0.951081395f},
-std::array<float,2>{0.867723942f, 0.68526119f},
-std::array<float,2>{0.268837661f, 0.170762986f},
-std::array<float,2>{0.586312652f, 0.202146083f},
-std::array<float,2>{0.0530944206f, 0.745083928f},
-std::array<float,2>{0.894852102f, 0.902684093f},
-std::array<float,2>{0.492896914f, 0.303138256f},
-std::array<float,2>{0.802093148f, 0.437434673f},
-std::array<float,2>{0.360327631f, 0.765969932f},
-std::array<float,2>{0.721445084f, 0.550314784f},
-std::array<float,2>{0.178862497f, 0.113946624f},
-std::array<float,2>{0.877112091f, 0.221380919f},
-std::array<float,2>{0.472408444f, 0.694309413f},
-std::array<float,2>{0.577254772f, 0.922579825f},
-std::array<float,2>{0.0331341997f, 0.274498045f},
-std::array<float,2>{0.74033165f, 0.395021111f},
-std::array<float,2>{0.162196994f, 0.783554435f},
-std::array<float,2>{0.796131074f, 0.516514599f},
-std::array<float,2>{0.354150891f, 0.0790012777f},
-std::array<float,2>{0.557665765f, 0.0490434729f},
-std::array<float,2>{0.120406017f, 0.602442682f},
-std::array<float,2>{0.976207852f, 0.831572831f},
-std::array<float,2>{0.398323953f, 0.496049523f},
-std::array<float,2>{0.846969664f, 0.351225197f},
-std::array<float,2>{0.255782932f, 0.998827279f},
-std::array<float,2>{0.648861706f, 0.634193122f},
-std::array<float,2>{0.23665677f, 0.142872542f},
-std::array<float,2>{0.75505048f, 0.102324426f},
-std::array<float,2>{0.332174182f, 0.533050656f},
-std::array<float,2>{0.71168375f, 0.752415001f},
-std::array<float,2>{0.127542406f, 0.421358258f},
-std::array<float,2>{0.624240041f, 0.290499985f},
-std::array<float,2>{0.00252882019f, 0.878018677f},
-std::array<float,2>{0.932618856f, 0.72151798f},
-std::array<float,2>{0.443897575f, 0.215072617f},
-std::array<float,2>{0.67957747f, 0.181834742f},
-std::array<float,2>{0.216253191f, 0.665444613f},
-std::array<float,2>{0.824903727f, 0.957235098f},
-std::array<float,2>{0.292500049f, 0.328824788f},
-std::array<float,2>{0.945852935f, 0.456911862f},
-std::array<float,2>{0.427220583f, 0.872681916f},
-std::array<float,2>{0.519500732f, 0.592600882f},
-std::array<float,2>{0.0754582286f, 0.0195330549f},
-std::array<float,2>{0.787421227f, 0.209745437f},
-std::array<float,2>{0.348115504f, 0.731123447f},
-std::array<float,2>{0.74945569f, 0.888383627f},
-std::array<float,2>{0.170418322f, 0.282511264f},
-std::array<float,2>{0.567730844f, 0.410167754f},
-std::array<float,2>{0.0461531021f, 0.765014529f},
-std::array<float,2>{0.883849084f, 0.543865144f},
-std::array<float,2>{0.482006013f, 0.0982499644f},
-std::array<float,2>{0.645623267f, 0.0304667428f},
-std::array<float,2>{0.247758031f, 0.583164573f},
-std::array<float,2>{0.85509181f, 0.862129271f},
-std::array<float,2>{0.259353757f, 0.461314768f},
-std::array<float,2>{0.98087734f, 0.33748579f},
-std::array<float,2>{0.403961509f, 0.96829319f},
-std::array<float,2>{0.553180039f, 0.659220338f},
-std::array<float,2>{0.115981534f, 0.177530169f},
-std::array<float,2>{0.927137196f, 0.0925553218f},
-std::array<float,2>{0.451804757f, 0.525166512f},
-std::array<float,2>{0.611855268f, 0.795008361f},
-std::array<float,2>{0.0080048535f, 0.404058099f},
-std::array<float,2>{0.706020772f, 0.266538829f},
-std::array<float,2>{0.134301156f, 0.93068099f},
-std::array<float,2>{0.760258615f, 0.700637698f},
-std::array<float,2>{0.337570667f, 0.228172511f},
-std::array<float,2>{0.524441481f, 0.151395708f},
-std::array<float,2>{0.0673002228f, 0.625010073f},
-std::array<float,2>{0.938299239f, 0.984482884f},
-std::array<float,2>{0.434111595f, 0.357826263f},
-std::array<float,2>{0.81319803f, 0.490917176f},
-std::array<float,2>{0.284800231f, 0.838014364f},
-std::array<float,2>{0.68121022f, 0.596231639f},
-std::array<float,2>{0.20545873f, 0.0557400584f},
-std::array<float,2>{0.961130977f, 0.158625439f},
-std::array<float,2>{0.408664197f, 0.672388852f},
-std::array<float,2>{0.501443088f, 0.944400311f},
-std::array<float,2>{0.0868861824f, 0.319204032f},
-std::array<float,2>{0.658727765f, 0.439031571f},
-std::array<float,2>{0.192877576f, 0.846934378f},
-std::array<float,2>{0.835574567f, 0.566108823f},
-std::array<float,2>{0.309782982f, 0.000929456786f},
-std::array<float,2>{0.607730746f, 0.123682253f},
-std::array<float,2>{0.0306749623f, 0.558718443f},
-std::array<float,2>{0.915063083f, 0.774214387f},
-std::array<float,2>{0.46557343f, 0.427135438f},
-std::array<float,2>{0.772111535f, 0.308576763f},
-std::array<float,2>{0.313636243f, 0.891790807f},
-std::array<float,2>{0.689656436f, 0.741322577f},
-std::array<float,2>{0.150559098f, 0.193459272f},
-std::array<float,2>{0.867075861f, 0.0343870856f},
-std::array<float,2>{0.28060025f, 0.618878603f},
-std::array<float,2>{0.632710099f, 0.81630969f},
-std::array<float,2>{0.226124778f, 0.473108649f},
-std::array<float,2>{0.543194771f, 0.36588937f},
-std::array<float,2>{0.104388312f, 0.975342572f},
-std::array<float,2>{0.996236265f, 0.651560068f},
-std::array<float,2>{0.390211254f, 0.128558353f},
-std::array<float,2>{0.729811251f, 0.23868978f},
-std::array<float,2>{0.182694361f, 0.710309386f},
-std::array<float,2>{0.807690442f, 0.913508773f},
-std::array<float,2>{0.369281203f, 0.250034779f},
-std::array<float,2>{0.898495734f, 0.379340321f},
-std::array<float,2>{0.489951462f, 0.797280967f},
-std::array<float,2>{0.581716239f, 0.510561526f},
-std::array<float,2>{0.061105404f, 0.0702796206f},
-std::array<float,2>{0.799792886f, 0.15424183f},
-std::array<float,2>{0.366571814f, 0.632696152f},
-std::array<float,2>{0.725192249f, 0.99111259f},
-std::array<float,2>{0.174647644f, 0.351705641f},
-std::array<float,2>{0.593579471f, 0.487433225f},
-std::array<float,2>{0.0478458181f, 0.841052115f},
-std::array<float,2>{0.892894208f, 0.598563731f},
-std::array<float,2>{0.498341829f, 0.0619711205f},
-std::array<float,2>{0.639783502f, 0.0869065672f},
-std::array<float,2>{0.234344214f, 0.529208481f},
-std::array<float,2>{0.874153316f, 0.790242136f},
-std::array<float,2>{0.269785255f, 0.401818424f},
-std::array<float,2>{0.988882363f, 0.272953629f},
-std::array<float,2>{0.380107492f, 0.935011983f},
-std::array<float,2>{0.535980344f, 0.69560039f},
-std::array<float,2>{0.0962703601f, 0.232686102f},
-std::array<float,2>{0.911445975f, 0.0263319891f},
-std::array<float,2>{0.453876495f, 0.580535293f},
-std::array<float,2>{0.601276875f, 0.864659488f},
-std::array<float,2>{0.015956495f, 0.466984957f},
-std::array<float,2>{0.699341774f, 0.341280669f},
-std::array<float,2>{0.145293549f, 0.9628672f},
-std::array<float,2>{0.777301431f, 0.661001921f},
-std::array<float,2>{0.327790916f, 0.173915461f},
-std::array<float,2>{0.511344433f, 0.204094693f},
-std::array<float,2>{0.0827828199f, 0.7273615f},
-std::array<float,2>{0.957334101f, 0.884671926f},
-std::array<float,2>{0.41461885f, 0.287176192f},
-std::array<float,2>{0.841574848f, 0.409739405f},
-std::array<float,2>{0.304620177f, 0.758825302f},
-std::array<float,2>{0.664431155f, 0.542747676f},
-std::array<float,2>{0.200741246f, 0.0974343494f},
-std::array<float,2>{0.950267673f, 0.23634772f},
-std::array<float,2>{0.423798144f, 0.706059992f},
-std::array<float,2>{0.521518648f, 0.907752514f},
-std::array<float,2>{0.0724901035f, 0.256771833f},
-std::array<float,2>{0.673987269f, 0.37735939f},
-std::array<float,2>{0.214100018f, 0.804300368f},
-std::array<float,2>{0.821891546f, 0.512270868f},
-std::array<float,2>{0.296404123f, 0.0657710806f},
-std::array<float,2>{0.620335996f, 0.0367999785f},
-std::array<float,2>{0.00510384096f, 0.624294937f},
-std::array<float,2>{0.935930908f, 0.81788522f},
-std::array<float,2>{0.437798679f, 0.472066343f},
-std::array<float,2>{0.753245473f, 0.360544413f},
-std::array<float,2>{0.331879288f, 0.969207466f},
-std::array<float,2>{0.718322158f, 0.652920544f},
-std::array<float,2>{0.129544288f, 0.131911546f},
-std::array<float,2>{0.848200679f, 0.118101813f},
-std::array<float,2>{0.253744662f, 0.557026148f},
-std::array<float,2>{0.655489743f, 0.779806077f},
-std::array<float,2>{0.239476472f, 0.424410462f},
-std::array<float,2>{0.56106621f, 0.310662925f},
-std::array<float,2>{0.123846591f, 0.895032704f},
-std::array<float,2>{0.972265363f, 0.734973013f},
-std::array<float,2>{0.393445879f, 0.18978858f},
-std::array<float,2>{0.734714508f, 0.163167045f},
-std::array<float,2>{0.15712218f, 0.679466665f},
-std::array<float,2>{0.791705668f, 0.938307643f},
-std::array<float,2>{0.358490497f, 0.316108316f},
-std::array<float,2>{0.880240321f, 0.444901079f},
-std::array<float,2>{0.474114716f, 0.850978017f},
-std::array<float,2>{0.574149728f, 0.567699373f},
-std::array<float,2>{0.0374389105f, 0.00664036395f},
-std::array<float,2>{0.819271147f, 0.196118012f},
-std::array<float,2>{0.285541594f, 0.748991787f},
-std::array<float,2>{0.686299324f, 0.901909232f},
-std::array<float,2>{0.208364815f, 0.2978113f},
-std::array<float,2>{0.529687107f, 0.432755619f},
-std::array<float,2>{0.0637265295f, 0.771166444f},
-std::array<float,2>{0.942482948f, 0.554340005f},
-std::array<float,2>{0.431335002f, 0.112381257f},
-std::array<float,2>{0.709111273f, 0.0139471572f},
-std::array<float,2>{0.13796024f, 0.576665044f},
-std::array<float,2>{0.763741314f, 0.859058678f},
-std::array<float,2>{0.341252267f, 0.448967069f},
-std::array<float,2>{0.922205806f, 0.321610034f},
-std::array<float,2>{0.449018419f, 0.947476447f},
-std::array<float,2>{0.615447223f, 0.68059051f},
-std::array<float,2>{0.0145674897f, 0.165783226f},
-std::array<float,2>{0.977908909f, 0.0775617138f},
-std::array<float,2>{0.399893671f, 0.504336417f},
-std::array<float,2>{0.548525274f, 0.808751762f},
-std::array<float,2>{0.109709747f, 0.386317879f},
-std::array<float,2>{0.643927455f, 0.264651805f},
-std::array<float,2>{0.24595432f, 0.920422196f},
-std::array<float,2>{0.857743442f, 0.714770555f},
-std::array<float,2>{0.263834059f, 0.244190514f},
-std::array<float,2>{0.562829554f, 0.137666658f},
-std::array<float,2>{0.0408452265f, 0.647436857f},
-std::array<float,2>{0.887174487f, 0.983015358f},
-std::array<float,2>{0.477616161f, 0.369903266f},
-std::array<float,2>{0.782565296f, 0.481945395f},
-std::array<float,2>{0.346065909f, 0.821106493f},
-std::array<float,2>{0.74327004f, 0.611965239f},
-std::array<float,2>{0.164423063f, 0.0449141972f},
-std::array<float,2>{0.904177248f, 0.185505852f},
-std::array<float,2>{0.488095343f, 0.669475317f},
-std::array<float,2>{0.582461119f, 0.955904305f},
-std::array<float,2>{0.0557495281f, 0.335673243f},
-std::array<float,2>{0.73121357f, 0.458938718f},
-std::array<float,2>{0.186571464f, 0.869239688f},
-std::array<float,2>{0.811363995f, 0.588622332f},
-std::array<float,2>{0.372036904f, 0.0170254167f},
-std::array<float,2>{0.542384923f, 0.10925062f},
-std::array<float,2>{0.108396687f, 0.536379755f},
-std::array<float,2>{0.993122101f, 0.757703722f},
-std::array<float,2>{0.385499299f, 0.416459054f},
-std::array<float,2>{0.860408008f, 0.293904185f},
-std::array<float,2>{0.274464339f, 0.87919569f},
-std::array<float,2>{0.625532806f, 0.725618482f},
-std::array<float,2>{0.220382631f, 0.214301929f},
-std::array<float,2>{0.767429709f, 0.0544349775f},
-std::array<float,2>{0.318831742f, 0.608837366f},
-std::array<float,2>{0.694702923f, 0.832759738f},
-std::array<float,2>{0.152668133f, 0.499348044f},
-std::array<float,2>{0.6029917f, 0.346137464f},
-std::array<float,2>{0.0237002354f, 0.996060014f},
-std::array<float,2>{0.921661556f, 0.639576852f},
-std::array<float,2>{0.462612033f, 0.145499095f},
-std::array<float,2>{0.66282618f, 0.226242483f},
-std::array<float,2>{0.190955579f, 0.69014281f},
-std::array<float,2>{0.828879774f, 0.926856279f},
-std::array<float,2>{0.305564314f, 0.280466169f},
-std::array<float,2>{0.966320872f, 0.391958028f},
-std::array<float,2>{0.412008524f, 0.786890566f},
-std::array<float,2>{0.503963053f, 0.520286024f},
-std::array<float,2>{0.0917909592f, 0.0852187127f},
-std::array<float,2>{0.870273173f, 0.169580743f},
-std::array<float,2>{0.2660546f, 0.685701668f},
-std::array<float,2>{0.634566724f, 0.951925397f},
-std::array<float,2>{0.227877766f, 0.32596007f},
-std::array<float,2>{0.534630537f, 0.449499488f},
-std::array<float,2>{0.099729225f, 0.853829682f},
-std::array<float,2>{0.985652506f, 0.573123991f},
-std::array<float,2>{0.378150672f, 0.00855211727f},
-std::array<float,2>{0.719142973f, 0.115454815f},
-std::array<float,2>{0.176304981f, 0.547851801f},
-std::array<float,2>{0.804464877f, 0.769351363f},
-std::array<float,2>{0.361557484f, 0.434759289f},
-std::array<float,2>{0.896940231f, 0.302175641f},
-std::array<float,2>{0.49583593f, 0.906022727f},
-std::array<float,2>{0.588952124f, 0.742794037f},
-std::array<float,2>{0.0523555949f, 0.200427487f},
-std::array<float,2>{0.953889132f, 0.0425607003f},
-std::array<float,2>{0.41821903f, 0.615902126f},
-std::array<float,2>{0.511866033f, 0.82631439f},
-std::array<float,2>{0.0800349712f, 0.480207115f},
-std::array<float,2>{0.670354426f, 0.374540091f},
-std::array<float,2>{0.196359247f, 0.979424f},
-std::array<float,2>{0.83919847f, 0.643233299f},
-std::array<float,2>{0.300378561f, 0.133762002f},
-std::array<float,2>{0.596176445f, 0.249273613f},
-std::array<float,2>{0.0213368759f, 0.718739569f},
-std::array<float,2>{0.909775436f, 0.917303264f},
-std::array<float,2>{0.459820241f, 0.258116394f},
-std::array<float,2>{0.780393302f, 0.388982594f},
-std::array<float,2>{0.32249108f, 0.806784391f},
-std::array<float,2>{0.697512627f, 0.501566887f},
-std::array<float,2>{0.14359802f, 0.0741714984f},
-std::array<float,2>{0.931404471f, 0.218168974f},
-std::array<float,2>{0.442485094f, 0.719116032f},
-std::array<float,2>{0.622349739f, 0.876479983f},
-std::array<float,2>{0.00112363137f, 0.292836875f},
-std::array<float,2>{0.714444697f, 0.418586195f},
-std::array<float,2>{0.1251643f, 0.750307679f},
-std::array<float,2>{0.756937444f, 0.533797741f},
-std::array<float,2>{0.334982067f, 0.104560114f},
-std::array<float,2>{0.515752852f, 0.0222595222f},
-std::array<float,2>{0.0766152665f, 0.590984523f},
-std::array<float,2>{0.948364913f, 0.873796523f},
-std::array<float,2>{0.427795291f, 0.454664379f},
-std::array<float,2>{0.827192366f, 0.33151558f},
-std::array<float,2>{0.289920926f, 0.960675836f},
-std::array<float,2>{0.67766273f, 0.667066991f},
-std::array<float,2>{0.21849215f, 0.180937111f},
-std::array<float,2>{0.794323921f, 0.0806284547f},
-std::array<float,2>{0.353101641f, 0.519091845f},
-std::array<float,2>{0.738569736f, 0.782711029f},
-std::array<float,2>{0.16131793f, 0.39811036f},
-std::array<float,2>{0.57506156f, 0.276372522f},
-std::array<float,2>{0.033563491f, 0.925091743f},
-std::array<float,2>{0.87581259f, 0.692634106f},
-std::array<float,2>{0.470062226f, 0.220309913f},
-std::array<float,2>{0.651417494f, 0.142350003f},
-std::array<float,2>{0.235050187f, 0.636181772f},
-std::array<float,2>{0.843823969f, 0.997016191f},
-std::array<float,2>{0.256515324f, 0.347894639f},
-std::array<float,2>{0.974212587f, 0.492252648f},
-std::array<float,2>{0.395961106f, 0.829116464f},
-std::array<float,2>{0.554856598f, 0.605344236f},
-std::array<float,2>{0.117220797f, 0.048352655f},
-std::array<float,2>{0.759601831f, 0.230022833f},
-std::array<float,2>{0.3394548f, 0.701664209f},
-std::array<float,2>{0.704515278f, 0.932448804f},
-std::array<float,2>{0.136705175f, 0.268410593f},
-std::array<float,2>{0.610759616f, 0.405906588f},
-std::array<float,2>{0.0109707229f, 0.794189453f},
-std::array<float,2>{0.928029358f, 0.525867939f},
-std::array<float,2>{0.450251997f, 0.0903253779f},
-std::array<float,2>{0.682498455f, 0.0577635728f},
-std::array<float,2>{0.204654187f, 0.595459938f},
-std::array<float,2>{0.815624118f, 0.836278915f},
-std::array<float,2>{0.282692462f, 0.488326222f},
-std::array<float,2>{0.940591693f, 0.356694907f},
-std::array<float,2>{0.436833143f, 0.986772776f},
-std::array<float,2>{0.525635123f, 0.627245188f},
-std::array<float,2>{0.0689263865f, 0.148465857f},
-std::array<float,2>{0.885656416f, 0.101157926f},
-std::array<float,2>{0.4830423f, 0.545146585f},
-std::array<float,2>{0.569761574f, 0.763459742f},
-std::array<float,2>{0.0448523089f, 0.412841409f},
-std::array<float,2>{0.747773707f, 0.283990949f},
-std::array<float,2>{0.168528944f, 0.890609264f},
-std::array<float,2>{0.786311686f, 0.732969224f},
-std::array<float,2>{0.351248175f, 0.208018348f},
-std::array<float,2>{0.552387059f, 0.177794203f},
-std::array<float,2>{0.113724276f, 0.657093346f},
-std::array<float,2>{0.983646095f, 0.965394616f},
-std::array<float,2>{0.405537128f, 0.3384597f},
-std::array<float,2>{0.852941394f, 0.463233054f},
-std::array<float,2>{0.260237038f, 0.861043215f},
-std::array<float,2>{0.646678984f, 0.58482486f},
-std::array<float,2>{0.248438224f, 0.0273648389f},
-std::array<float,2>{0.998926282f, 0.126650453f},
-std::array<float,2>{0.38854748f, 0.649075866f},
-std::array<float,2>{0.545526028f, 0.972880602f},
-std::array<float,2>{0.103224553f, 0.364644676f},
-std::array<float,2>{0.630345345f, 0.475926161f},
-std::array<float,2>{0.224489674f, 0.812769175f},
-std::array<float,2>{0.865082443f, 0.620729804f},
-std::array<float,2>{0.278536528f, 0.032051295f},
-std::array<float,2>{0.578191102f, 0.0671349913f},
-std::array<float,2>{0.0598418899f, 0.50849998f},
-std::array<float,2>{0.901172161f, 0.799315929f},
-std::array<float,2>{0.491132319f, 0.38216275f},
-std::array<float,2>{0.806400776f, 0.252579927f},
-std::array<float,2>{0.367900729f, 0.912057042f},
-std::array<float,2>{0.726829171f, 0.707794547f},
-std::array<float,2>{0.181087762f, 0.242015541f},
-std::array<float,2>{0.833973765f, 0.00293149031f},
-std::array<float,2>{0.310944468f, 0.563510478f},
-std::array<float,2>{0.65672344f, 0.844784021f},
-std::array<float,2>{0.193746388f, 0.441153109f},
-std::array<float,2>{0.503364921f, 0.317540854f},
-std::array<float,2>{0.088721849f, 0.94196409f},
-std::array<float,2>{0.964037955f, 0.674631715f},
-std::array<float,2>{0.407583475f, 0.157979921f},
-std::array<float,2>{0.688401222f, 0.192833975f},
-std::array<float,2>{0.149266034f, 0.739263594f},
-std::array<float,2>{0.770638645f, 0.894181848f},
-std::array<float,2>{0.31625551f, 0.306406736f},
-std::array<float,2>{0.916348696f, 0.429219604f},
-std::array<float,2>{0.468709737f, 0.776772141f},
-std::array<float,2>{0.605791509f, 0.562299371f},
-std::array<float,2>{0.0281475056f, 0.122665733f},
-std::array<float,2>{0.751827359f, 0.131598234f},
-std::array<float,2>{0.329215169f, 0.653670251f},
-std::array<float,2>{0.715184867f, 0.970252395f},
-std::array<float,2>{0.131577879f, 0.359720409f},
-std::array<float,2>{0.619032502f, 0.471540004f},
-std::array<float,2>{0.00674575381f, 0.816544652f},
-std::array<float,2>{0.934123933f, 0.623570681f},
-std::array<float,2>{0.440238506f, 0.0355088301f},
-std::array<float,2>{0.673649669f, 0.0646684244f},
-std::array<float,2>{0.212418005f, 0.512833714f},
-std::array<float,2>{0.822689772f, 0.80287379f},
-std::array<float,2>{0.293216735f, 0.37839368f},
-std::array<float,2>{0.953038037f, 0.256994784f},
-std::array<float,2>{0.424945533f, 0.906878948f},
-std::array<float,2>{0.521186829f, 0.706044018f},
-std::array<float,2>{0.0715375096f, 0.23760961f},
-std::array<float,2>{0.881518304f, 0.00743666152f},
-std::array<float,2>{0.475499362f, 0.567249f},
-std::array<float,2>{0.572123706f, 0.849632204f},
-std::array<float,2>{0.0355646312f, 0.443751305f},
-std::array<float,2>{0.738002896f, 0.314631075f},
-std::array<float,2>{0.159319684f, 0.939372122f},
-std::array<float,2>{0.789476156f, 0.678593397f},
-std::array<float,2>{0.356023282f, 0.162573725f},
-std::array<float,2>{0.559953392f, 0.191048905f},
-std::array<float,2>{0.121521242f, 0.735595763f},
-std::array<float,2>{0.970327616f, 0.895667017f},
-std::array<float,2>{0.392233312f, 0.312431753f},
-std::array<float,2>{0.850314915f, 0.425250173f},
-std::array<float,2>{0.251613528f, 0.781083047f},
-std::array<float,2>{0.653729975f, 0.558070958f},
-std::array<float,2>{0.240299731f, 0.118845239f},
-std::array<float,2>{0.991153657f, 0.233899564f},
-std::array<float,2>{0.381247908f, 0.697116017f},
-std::array<float,2>{0.537198663f, 0.934005678f},
-std::array<float,2>{0.095453538f, 0.271499991f},
-std::array<float,2>{0.638394892f, 0.401348591f},
-std::array<float,2>{0.232396424f, 0.789637208f},
-std::array<float,2>{0.872876704f, 0.528014719f},
-std::array<float,2>{0.272038251f, 0.0869683623f},
-std::array<float,2>{0.590975821f, 0.0611191429f},
-std::array<float,2>{0.0499612801f, 0.599502206f},
-std::array<float,2>{0.891029239f, 0.840011358f},
-std::array<float,2>{0.49754715f, 0.48658365f},
-std::array<float,2>{0.798616469f, 0.353257716f},
-std::array<float,2>{0.364211559f, 0.991722286f},
-std::array<float,2>{0.723088264f, 0.631620586f},
-std::array<float,2>{0.172423825f, 0.152971372f},
-std::array<float,2>{0.842500091f, 0.0965583548f},
-std::array<float,2>{0.301218987f, 0.541586459f},
-std::array<float,2>{0.666484952f, 0.758479297f},
-std::array<float,2>{0.202558711f, 0.408352166f},
-std::array<float,2>{0.509760499f, 0.288611501f},
-std::array<float,2>{0.0854424909f, 0.883575439f},
-std::array<float,2>{0.960381091f, 0.727984369f},
-std::array<float,2>{0.417268038f, 0.204312533f},
-std::array<float,2>{0.701765656f, 0.175525486f},
-std::array<float,2>{0.148240507f, 0.66160512f},
-std::array<float,2>{0.775288522f, 0.961148143f},
-std::array<float,2>{0.324829906f, 0.340005964f},
-std::array<float,2>{0.913877428f, 0.468266368f},
-std::array<float,2>{0.456481159f, 0.863344014f},
-std::array<float,2>{0.598387539f, 0.581665516f},
-std::array<float,2>{0.0178559367f, 0.0266382769f},
-std::array<float,2>{0.862405896f, 0.21382314f},
-std::array<float,2>{0.276913881f, 0.724701226f},
-std::array<float,2>{0.628652453f, 0.88079083f},
-std::array<float,2>{0.220750615f, 0.294709861f},
-std::array<float,2>{0.539773762f, 0.417733967f},
-std::array<float,2>{0.105520718f, 0.756086707f},
-std::array<float,2>{0.995750904f, 0.535843372f},
-std::array<float,2>{0.382918835f, 0.107977457f},
-std::array<float,2>{0.732786477f, 0.0156400912f},
-std::array<float,2>{0.185397491f, 0.589144647f},
-std::array<float,2>{0.808895171f, 0.870505571f},
-std::array<float,2>{0.374992371f, 0.45800516f},
-std::array<float,2>{0.905220985f, 0.334324211f},
-std::array<float,2>{0.485161215f, 0.956521213f},
-std::array<float,2>{0.584523141f, 0.668678999f},
-std::array<float,2>{0.0585520826f, 0.184250534f},
-std::array<float,2>{0.968406081f, 0.0845780224f},
-std::array<float,2>{0.413998246f, 0.521182418f},
-std::array<float,2>{0.50745976f, 0.785384357f},
-std::array<float,2>{0.0920728445f, 0.391199946f},
-std::array<float,2>{0.66199255f, 0.279692173f},
-std::array<float,2>{0.188275784f, 0.926451266f},
-std::array<float,2>{0.830896914f, 0.690806925f},
-std::array<float,2>{0.307844102f, 0.225378975f},
-std::array<float,2>{0.603796124f, 0.145611495f},
-std::array<float,2>{0.0260692723f, 0.639742255f},
-std::array<float,2>{0.918015838f, 0.994515121f},
-std::array<float,2>{0.464511245f, 0.347228795f},
-std::array<float,2>{0.769426465f, 0.498742908f},
-std::array<float,2>{0.318262905f, 0.833520949f},
-std::array<float,2>{0.691677511f, 0.607606947f},
-std::array<float,2>{0.154618949f, 0.0535423905f},
-std::array<float,2>{0.924142659f, 0.164292574f},
-std::array<float,2>{0.446748346f, 0.681387603f},
-std::array<float,2>{0.614593863f, 0.948591769f},
-std::array<float,2>{0.0120099336f, 0.320487112f},
-std::array<float,2>{0.707812786f, 0.447729409f},
-std::array<float,2>{0.139190942f, 0.858387113f},
-std::array<float,2>{0.762822032f, 0.577848077f},
-std::array<float,2>{0.343564659f, 0.0150052793f},
-std::array<float,2>{0.528033078f, 0.112275735f},
-std::array<float,2>{0.0648377091f, 0.553506494f},
-std::array<float,2>{0.943820953f, 0.769739091f},
-std::array<float,2>{0.433103412f, 0.431760252f},
-std::array<float,2>{0.817688584f, 0.297919035f},
-std::array<float,2>{0.288580298f, 0.901301801f},
-std::array<float,2>{0.685147166f, 0.749111414f},
-std::array<float,2>{0.21085836f, 0.196970791f},
-std::array<float,2>{0.783854604f, 0.0437334292f},
-std::array<float,2>{0.345196247f, 0.612699032f},
-std::array<float,2>{0.744422555f, 0.822216213f},
-std::array<float,2>{0.166633695f, 0.481062889f},
-std::array<float,2>{0.565148175f, 0.370471954f},
-std::array<float,2>{0.0423014984f, 0.984217525f},
-std::array<float,2>{0.88985008f, 0.648197591f},
-std::array<float,2>{0.480012089f, 0.138127565f},
-std::array<float,2>{0.640646994f, 0.245633215f},
-std::array<float,2>{0.242295772f, 0.713557303f},
-std::array<float,2>{0.856222034f, 0.921323001f},
-std::array<float,2>{0.262902141f, 0.264086783f},
-std::array<float,2>{0.979522765f, 0.38521868f},
-std::array<float,2>{0.400757641f, 0.810350537f},
-std::array<float,2>{0.550323725f, 0.505303562f},
-std::array<float,2>{0.111849509f, 0.0763599575f},
-std::array<float,2>{0.825360656f, 0.1801081f},
-std::array<float,2>{0.291697502f, 0.666186154f},
-std::array<float,2>{0.678120315f, 0.959539533f},
-std::array<float,2>{0.215170249f, 0.330385178f},
-std::array<float,2>{0.517925143f, 0.454100162f},
-std::array<float,2>{0.0748359933f, 0.874345839f},
-std::array<float,2>{0.94718039f, 0.590502739f},
-std::array<float,2>{0.425904691f, 0.0224954672f},
-std::array<float,2>{0.712821722f, 0.103831321f},
-std::array<float,2>{0.128888011f, 0.534212768f},
-std::array<float,2>{0.754835308f, 0.75098145f},
-std::array<float,2>{0.333527923f, 0.41948086f},
-std::array<float,2>{0.932420075f, 0.291412055f},
-std::array<float,2>{0.444841951f, 0.875165641f},
-std::array<float,2>{0.623544157f, 0.719939768f},
-std::array<float,2>{0.00300509227f, 0.216798559f},
-std::array<float,2>{0.974810302f, 0.0474683493f},
-std::array<float,2>{0.397072643f, 0.604186058f},
-std::array<float,2>{0.557330549f, 0.828466833f},
-std::array<float,2>{0.119308971f, 0.494101733f},
-std::array<float,2>{0.6497401f, 0.349252611f},
-std::array<float,2>{0.237433732f, 0.997597039f},
-std::array<float,2>{0.846596897f, 0.63520968f},
-std::array<float,2>{0.254626781f, 0.141260982f},
-std::array<float,2>{0.576471269f, 0.219067365f},
-std::array<float,2>{0.0318365358f, 0.69165051f},
-std::array<float,2>{0.87846595f, 0.924246967f},
-std::array<float,2>{0.47092548f, 0.275455207f},
-std::array<float,2>{0.79549855f, 0.396663427f},
-std::array<float,2>{0.355085433f, 0.781853855f},
-std::array<float,2>{0.742023587f, 0.518402517f},
-std::array<float,2>{0.163410276f, 0.0814399421f},
-std::array<float,2>{0.895657063f, 0.199808612f},
-std::array<float,2>{0.493566871f, 0.743663907f},
-std::array<float,2>{0.587691367f, 0.904907286f},
-std::array<float,2>{0.054549206f, 0.301674247f},
-std::array<float,2>{0.721715093f, 0.434223801f},
-std::array<float,2>{0.177988857f, 0.768309116f},
-std::array<float,2>{0.80100286f, 0.547462225f},
-std::array<float,2>{0.360403985f, 0.116415329f},
-std::array<float,2>{0.531792879f, 0.00940913707f},
-std::array<float,2>{0.0987828299f, 0.573763132f},
-std::array<float,2>{0.98654294f, 0.855150938f},
-std::array<float,2>{0.376615345f, 0.450684875f},
-std::array<float,2>{0.868296981f, 0.324224383f},
-std::array<float,2>{0.267760366f, 0.952535152f},
-std::array<float,2>{0.635341763f, 0.687497139f},
-std::array<float,2>{0.230004683f, 0.16861248f},
-std::array<float,2>{0.778547168f, 0.0729006752f},
-std::array<float,2>{0.321332842f, 0.500965476f},
-std::array<float,2>{0.696444869f, 0.807669342f},
-std::array<float,2>{0.14153038f, 0.389955461f},
-std::array<float,2>{0.595394611f, 0.259487629f},
-std::array<float,2>{0.0229567364f, 0.916476786f},
-std::array<float,2>{0.907998145f, 0.717060864f},
-std::array<float,2>{0.458036244f, 0.248782083f},
-std::array<float,2>{0.669629514f, 0.133796334f},
-std::array<float,2>{0.19764702f, 0.643841624f},
-std::array<float,2>{0.836263597f, 0.98033911f},
-std::array<float,2>{0.297742575f, 0.373162717f},
-std::array<float,2>{0.955858827f, 0.478592664f},
-std::array<float,2>{0.420960248f, 0.827894211f},
-std::array<float,2>{0.515012443f, 0.617091417f},
-std::array<float,2>{0.0807134211f, 0.0417832285f},
-std::array<float,2>{0.807257712f, 0.240900889f},
-std::array<float,2>{0.370700061f, 0.708904088f},
-std::array<float,2>{0.729180396f, 0.910312474f},
-std::array<float,2>{0.182579681f, 0.253411174f},
-std::array<float,2>{0.580739558f, 0.38160336f},
-std::array<float,2>{0.0623988025f, 0.800294518f},
-std::array<float,2>{0.900299191f, 0.509454072f},
-std::array<float,2>{0.488422185f, 0.0676830411f},
-std::array<float,2>{0.631014645f, 0.0325155482f},
-std::array<float,2>{0.225192949f, 0.619687557f},
-std::array<float,2>{0.865254343f, 0.814250052f},
-std::array<float,2>{0.279464841f, 0.474940598f},
-std::array<float,2>{0.997602105f, 0.364070028f},
-std::array<float,2>{0.388841629f, 0.97421366f},
-std::array<float,2>{0.544811189f, 0.650334358f},
-std::array<float,2>{0.10521581f, 0.125592157f},
-std::array<float,2>{0.914849401f, 0.121385157f},
-std::array<float,2>{0.465955913f, 0.560674548f},
-std::array<float,2>{0.609167218f, 0.775977015f},
-std::array<float,2>{0.0298445597f, 0.428628832f},
-std::array<float,2>{0.69103694f, 0.305360705f},
-std::array<float,2>{0.151525944f, 0.893490076f},
-std::array<float,2>{0.77297765f, 0.738918424f},
-std::array<float,2>{0.313291401f, 0.192089319f},
-std::array<float,2>{0.500585973f, 0.156476855f},
-std::array<float,2>{0.0869340971f, 0.675572753f},
-std::array<float,2>{0.962534249f, 0.943137467f},
-std::array<float,2>{0.40961355f, 0.317078054f},
-std::array<float,2>{0.834466159f, 0.440260172f},
-std::array<float,2>{0.308756202f, 0.844346046f},
-std::array<float,2>{0.659952044f, 0.562761545f},
-std::array<float,2>{0.191547841f, 0.00208737329f},
-std::array<float,2>{0.939440906f, 0.149476632f},
-std::array<float,2>{0.43464461f, 0.628244519f},
-std::array<float,2>{0.523811877f, 0.987355947f},
-std::array<float,2>{0.0679671019f, 0.355880558f},
-std::array<float,2>{0.680448771f, 0.489581585f},
-std::array<float,2>{0.206397787f, 0.837627053f},
-std::array<float,2>{0.813970149f, 0.594503462f},
-std::array<float,2>{0.283312917f, 0.056960173f},
-std::array<float,2>{0.613214731f, 0.091315642f},
-std::array<float,2>{0.00930507481f, 0.526794612f},
-std::array<float,2>{0.926005542f, 0.793542385f},
-std::array<float,2>{0.452657759f, 0.404699475f},
-std::array<float,2>{0.76130563f, 0.269235939f},
-std::array<float,2>{0.336413532f, 0.933326483f},
-std::array<float,2>{0.706548452f, 0.702929974f},
-std::array<float,2>{0.13348943f, 0.229305252f},
-std::array<float,2>{0.853962243f, 0.0289535429f},
-std::array<float,2>{0.258722633f, 0.585071206f},
-std::array<float,2>{0.644855797f, 0.860128224f},
-std::array<float,2>{0.247034773f, 0.464838058f},
-std::array<float,2>{0.554088593f, 0.339797497f},
-std::array<float,2>{0.116589151f, 0.966668725f},
-std::array<float,2>{0.982115984f, 0.65760833f},
-std::array<float,2>{0.402877867f, 0.17924884f},
-std::array<float,2>{0.748100102f, 0.207197458f},
-std::array<float,2>{0.171226189f, 0.734039545f},
-std::array<float,2>{0.788361549f, 0.889443815f},
-std::array<float,2>{0.349162728f, 0.284200013f},
-std::array<float,2>{0.883634508f, 0.41337654f},
-std::array<float,2>{0.480475962f, 0.761808634f},
-std::array<float,2>{0.56649524f, 0.546613157f},
-std::array<float,2>{0.0453822277f, 0.100241378f},
-std::array<float,2>{0.792204082f, 0.16044265f},
-std::array<float,2>{0.357815355f, 0.676512539f},
-std::array<float,2>{0.735368073f, 0.939740598f},
-std::array<float,2>{0.157244906f, 0.312525511f},
-std::array<float,2>{0.573126078f, 0.442364037f},
-std::array<float,2>{0.0388851166f, 0.848362982f},
-std::array<float,2>{0.87953341f, 0.568957031f},
-std::array<float,2>{0.47358954f, 0.00571498508f},
-std::array<float,2>{0.654987574f, 0.119765505f},
-std::array<float,2>{0.239064738f, 0.556449711f},
-std::array<float,2>{0.849422812f, 0.778081775f},
-std::array<float,2>{0.252320796f, 0.422846705f},
-std::array<float,2>{0.97097683f, 0.310134679f},
-std::array<float,2>{0.394431382f, 0.898172081f},
-std::array<float,2>{0.562352121f, 0.737072647f},
-std::array<float,2>{0.124674425f, 0.187720403f},
-std::array<float,2>{0.936559856f, 0.0374881066f},
-std::array<float,2>{0.439071238f, 0.622317553f},
-std::array<float,2>{0.619322062f, 0.818978786f},
-std::array<float,2>{0.00457645487f, 0.470540047f},
-std::array<float,2>{0.717670619f, 0.362284482f},
-std::array<float,2>{0.130635336f, 0.97122699f},
-std::array<float,2>{0.752373397f, 0.656013072f},
-std::array<float,2>{0.33017984f, 0.130403444f},
-std::array<float,2>{0.523085892f, 0.234620541f},
-std::array<float,2>{0.0734442994f, 0.704933047f},
-std::array<float,2>{0.949477375f, 0.908427835f},
-std::array<float,2>{0.422668844f, 0.255841315f},
-std::array<float,2>{0.821110964f, 0.37622422f},
-std::array<float,2>{0.295260876f, 0.802391768f},
-std::array<float,2>{0.674895525f, 0.514642298f},
-std::array<float,2>{0.213015273f, 0.064331688f},
-std::array<float,2>{0.958258569f, 0.205179855f},
-std::array<float,2>{0.415477335f, 0.729977965f},
-std::array<float,2>{0.510561585f, 0.886360407f},
-std::array<float,2>{0.083144553f, 0.286217988f},
-std::array<float,2>{0.665609837f, 0.408073664f},
-std::array<float,2>{0.200145811f, 0.760772943f},
-std::array<float,2>{0.839929461f, 0.539731741f},
-std::array<float,2>{0.303182751f, 0.094638221f},
-std::array<float,2>{0.600353122f, 0.0247975662f},
-std::array<float,2>{0.017280655f, 0.579771817f},
-std::array<float,2>{0.910379291f, 0.866431594f},
-std::array<float,2>{0.454373866f, 0.466766983f},
-std::array<float,2>{0.776061118f, 0.342267722f},
-std::array<float,2>{0.326360613f, 0.964342296f},
-std::array<float,2>{0.701085687f, 0.663127482f},
-std::array<float,2>{0.146129951f, 0.17201677f},
-std::array<float,2>{0.87324965f, 0.0884783939f},
-std::array<float,2>{0.270776898f, 0.529970109f},
-std::array<float,2>{0.639377952f, 0.792206705f},
-std::array<float,2>{0.232452348f, 0.398917854f},
-std::array<float,2>{0.537096918f, 0.270819306f},
-std::array<float,2>{0.0972892493f, 0.936483383f},
-std::array<float,2>{0.989497304f, 0.698564827f},
-std::array<float,2>{0.379733056f, 0.232236251f},
-std::array<float,2>{0.726020992f, 0.154489979f},
-std::array<float,2>{0.174977958f, 0.628944516f},
-std::array<float,2>{0.800651371f, 0.988509774f},
-std::array<float,2>{0.366053492f, 0.35443151f},
-std::array<float,2>{0.893993318f, 0.485976338f},
-std::array<float,2>{0.499468446f, 0.842711866f},
-std::array<float,2>{0.591942251f, 0.601438403f},
-std::array<float,2>{0.047990758f, 0.0587396696f},
-std::array<float,2>{0.829684734f, 0.224151075f},
-std::array<float,2>{0.30588159f, 0.68929255f},
-std::array<float,2>{0.663234711f, 0.928546667f},
-std::array<float,2>{0.189910039f, 0.277808249f},
-std::array<float,2>{0.505202413f, 0.394204974f},
-std::array<float,2>{0.0904442668f, 0.787349463f},
-std::array<float,2>{0.965538383f, 0.522429466f},
-std::array<float,2>{0.410603315f, 0.0822490826f},
-std::array<float,2>{0.693722427f, 0.0518346541f},
-std::array<float,2>{0.154173672f, 0.606506824f},
-std::array<float,2>{0.766260147f, 0.835121095f},
-std::array<float,2>{0.320088655f, 0.497775406f},
-std::array<float,2>{0.920477569f, 0.344614923f},
-std::array<float,2>{0.461847901f, 0.993815243f},
-std::array<float,2>{0.602175474f, 0.637992918f},
-std::array<float,2>{0.0252986774f, 0.148267567f},
-std::array<float,2>{0.993576705f, 0.106343083f},
-std::array<float,2>{0.385920346f, 0.537580907f},
-std::array<float,2>{0.541916788f, 0.755229831f},
-std::array<float,2>{0.108613342f, 0.4151043f},
-std::array<float,2>{0.626941383f, 0.29677406f},
-std::array<float,2>{0.219544381f, 0.882673264f},
-std::array<float,2>{0.859744668f, 0.723110199f},
-std::array<float,2>{0.274258137f, 0.212685362f},
-std::array<float,2>{0.583695531f, 0.186370701f},
-std::array<float,2>{0.0552504063f, 0.671431661f},
-std::array<float,2>{0.903261542f, 0.953237534f},
-std::array<float,2>{0.487234116f, 0.332327694f},
-std::array<float,2>{0.811802387f, 0.460684955f},
-std::array<float,2>{0.372390509f, 0.8690961f},
-std::array<float,2>{0.732127309f, 0.586277187f},
-std::array<float,2>{0.186001107f, 0.0186319053f},
-std::array<float,2>{0.888373375f, 0.140237167f},
-std::array<float,2>{0.477043271f, 0.645084202f},
-std::array<float,2>{0.56362927f, 0.98094207f},
-std::array<float,2>{0.0394492f, 0.368037909f},
-std::array<float,2>{0.742837965f, 0.484125346f},
-std::array<float,2>{0.165483266f, 0.82374084f},
-std::array<float,2>{0.781355381f, 0.610425055f},
-std::array<float,2>{0.347480923f, 0.0463926233f},
-std::array<float,2>{0.547236383f, 0.074330382f},
-std::array<float,2>{0.110773452f, 0.505868852f},
-std::array<float,2>{0.976784885f, 0.810741007f},
-std::array<float,2>{0.398902953f, 0.384467512f},
-std::array<float,2>{0.859139204f, 0.262005717f},
-std::array<float,2>{0.264963061f, 0.918137491f},
-std::array<float,2>{0.642835021f, 0.712366581f},
-std::array<float,2>{0.24461399f, 0.242665961f},
-std::array<float,2>{0.765238047f, 0.0135992933f},
-std::array<float,2>{0.33993867f, 0.575744867f},
-std::array<float,2>{0.71076709f, 0.857381046f},
-std::array<float,2>{0.137085885f, 0.44601202f},
-std::array<float,2>{0.616514564f, 0.322285712f},
-std::array<float,2>{0.0153914783f, 0.947012663f},
-std::array<float,2>{0.923556745f, 0.682162166f},
-std::array<float,2>{0.447734416f, 0.16665782f},
-std::array<float,2>{0.687139332f, 0.19849579f},
-std::array<float,2>{0.20788762f, 0.747569621f},
-std::array<float,2>{0.819556534f, 0.90020442f},
-std::array<float,2>{0.286991924f, 0.30071646f},
-std::array<float,2>{0.942030072f, 0.430279732f},
-std::array<float,2>{0.430496991f, 0.771522701f},
-std::array<float,2>{0.531156778f, 0.552394032f},
-std::array<float,2>{0.0632309541f, 0.110248744f},
-std::array<float,2>{0.845283926f, 0.144113585f},
-std::array<float,2>{0.257365525f, 0.633289695f},
-std::array<float,2>{0.650816917f, 0.999933183f},
-std::array<float,2>{0.235728055f, 0.350126714f},
-std::array<float,2>{0.556462109f, 0.494895428f},
-std::array<float,2>{0.118886851f, 0.830418944f},
-std::array<float,2>{0.973304689f, 0.60332948f},
-std::array<float,2>{0.395321071f, 0.0504598804f},
-std::array<float,2>{0.73947233f, 0.0793089271f},
-std::array<float,2>{0.160384595f, 0.516823888f},
-std::array<float,2>{0.793627083f, 0.784251809f},
-std::array<float,2>{0.352160484f, 0.395598322f},
-std::array<float,2>{0.876580119f, 0.274118483f},
-std::array<float,2>{0.469352901f, 0.923457444f},
-std::array<float,2>{0.575359166f, 0.694927394f},
-std::array<float,2>{0.0345187075f, 0.221815318f},
-std::array<float,2>{0.947482526f, 0.0211121626f},
-std::array<float,2>{0.428733438f, 0.593462169f},
-std::array<float,2>{0.517502308f, 0.87113148f},
-std::array<float,2>{0.0776677355f, 0.455520779f},
-std::array<float,2>{0.676112652f, 0.329902887f},
-std::array<float,2>{0.217201978f, 0.958782196f},
-std::array<float,2>{0.826596022f, 0.66408056f},
-std::array<float,2>{0.290501058f, 0.183449835f},
-std::array<float,2>{0.621398389f, 0.216694355f},
-std::array<float,2>{0.000943524356f, 0.722049892f},
-std::array<float,2>{0.930629313f, 0.877812147f},
-std::array<float,2>{0.442042202f, 0.289797455f},
-std::array<float,2>{0.756415606f, 0.420148641f},
-std::array<float,2>{0.334422469f, 0.752930343f},
-std::array<float,2>{0.713437915f, 0.532000661f},
-std::array<float,2>{0.126677305f, 0.102817371f},
-std::array<float,2>{0.90826726f, 0.246403545f},
-std::array<float,2>{0.460048109f, 0.716178954f},
-std::array<float,2>{0.597432792f, 0.915030718f},
-std::array<float,2>{0.0197306518f, 0.261071354f},
-std::array<float,2>{0.698701382f, 0.386746943f},
-std::array<float,2>{0.142946348f, 0.804777503f},
-std::array<float,2>{0.780094683f, 0.502255023f},
-std::array<float,2>{0.323771834f, 0.0707845017f},
-std::array<float,2>{0.513335288f, 0.0391448438f},
-std::array<float,2>{0.0781679973f, 0.614699364f},
-std::array<float,2>{0.954987824f, 0.824241221f},
-std::array<float,2>{0.419561952f, 0.477449924f},
-std::array<float,2>{0.838196337f, 0.371259004f},
-std::array<float,2>{0.29929775f, 0.977851391f},
-std::array<float,2>{0.67119807f, 0.641975522f},
-std::array<float,2>{0.195435256f, 0.135698393f},
-std::array<float,2>{0.803061783f, 0.115145408f},
-std::array<float,2>{0.363276005f, 0.549031377f},
-std::array<float,2>{0.719790757f, 0.767071247f},
-std::array<float,2>{0.176796705f, 0.436223507f},
-std::array<float,2>{0.588291585f, 0.3041659f},
-std::array<float,2>{0.0513343327f, 0.903677166f},
-std::array<float,2>{0.897507548f, 0.74572593f},
-std::array<float,2>{0.494389087f, 0.20259662f},
-std::array<float,2>{0.633531511f, 0.171410799f},
-std::array<float,2>{0.227440625f, 0.684295177f},
-std::array<float,2>{0.869252563f, 0.949991643f},
-std::array<float,2>{0.267349422f, 0.326483637f},
-std::array<float,2>{0.984711707f, 0.452339172f},
-std::array<float,2>{0.377013087f, 0.852831066f},
-std::array<float,2>{0.534136355f, 0.570989251f},
-std::array<float,2>{0.100982785f, 0.0104990928f},
-std::array<float,2>{0.769902647f, 0.194869578f},
-std::array<float,2>{0.315175593f, 0.740755677f},
-std::array<float,2>{0.689322114f, 0.89147377f},
-std::array<float,2>{0.149585292f, 0.306867719f},
-std::array<float,2>{0.60676831f, 0.425979078f},
-std::array<float,2>{0.0289430749f, 0.774502397f},
-std::array<float,2>{0.917060792f, 0.56007427f},
-std::array<float,2>{0.467702627f, 0.124686643f},
-std::array<float,2>{0.657307982f, 0.00121377991f},
-std::array<float,2>{0.194816083f, 0.564571738f},
-std::array<float,2>{0.83297348f, 0.846669376f},
-std::array<float,2>{0.311673671f, 0.43816027f},
-std::array<float,2>{0.963493288f, 0.319972068f},
-std::array<float,2>{0.407222629f, 0.943510771f},
-std::array<float,2>{0.502589405f, 0.673716724f},
-std::array<float,2>{0.0895521119f, 0.159720153f},
-std::array<float,2>{0.902098119f, 0.06875626f},
-std::array<float,2>{0.492122918f, 0.510975301f},
-std::array<float,2>{0.579490781f, 0.7980932f},
-std::array<float,2>{0.0590799078f, 0.380031556f},
-std::array<float,2>{0.728052974f, 0.251856059f},
-std::array<float,2>{0.180175066f, 0.912131548f},
-std::array<float,2>{0.80535692f, 0.709911227f},
-std::array<float,2>{0.368535429f, 0.240015775f},
-std::array<float,2>{0.546140671f, 0.127677143f},
-std::array<float,2>{0.101903491f, 0.651177406f},
-std::array<float,2>{0.999717295f, 0.975999951f},
-std::array<float,2>{0.387454391f, 0.366804868f},
-std::array<float,2>{0.863517344f, 0.473843843f},
-std::array<float,2>{0.278110355f, 0.814469457f},
-std::array<float,2>{0.629099905f, 0.618018448f},
-std::array<float,2>{0.223603085f, 0.0338749178f},
-std::array<float,2>{0.982614279f, 0.176753938f},
-std::array<float,2>{0.404823154f, 0.65838027f},
-std::array<float,2>{0.551509619f, 0.967221975f},
-std::array<float,2>{0.11470554f, 0.336019665f},
-std::array<float,2>{0.647919476f, 0.462337404f},
-std::array<float,2>{0.249556795f, 0.862693727f},
-std::array<float,2>{0.852460742f, 0.582635641f},
-std::array<float,2>{0.261008114f, 0.0296738483f},
-std::array<float,2>{0.568903863f, 0.0994429812f},
-std::array<float,2>{0.0432812348f, 0.544375718f},
-std::array<float,2>{0.885820568f, 0.764499247f},
-std::array<float,2>{0.483896941f, 0.411773056f},
-std::array<float,2>{0.785832107f, 0.281466156f},
-std::array<float,2>{0.349818349f, 0.887507498f},
-std::array<float,2>{0.746433437f, 0.731949925f},
-std::array<float,2>{0.169618085f, 0.210560501f},
-std::array<float,2>{0.815036595f, 0.0548765175f},
-std::array<float,2>{0.281446278f, 0.597606361f},
-std::array<float,2>{0.683467746f, 0.839108109f},
-std::array<float,2>{0.203784883f, 0.491483867f},
-std::array<float,2>{0.526797533f, 0.358958095f},
-std::array<float,2>{0.0698267967f, 0.985430181f},
-std::array<float,2>{0.940002561f, 0.626077533f},
-std::array<float,2>{0.436348379f, 0.151271313f},
-std::array<float,2>{0.703772306f, 0.227254659f},
-std::array<float,2>{0.135004878f, 0.699791789f},
-std::array<float,2>{0.758107662f, 0.929933667f},
-std::array<float,2>{0.338846534f, 0.266996473f},
-std::array<float,2>{0.928947508f, 0.402432054f},
-std::array<float,2>{0.4499273f, 0.796807051f},
-std::array<float,2>{0.609996617f, 0.523692489f},
-std::array<float,2>{0.0103300875f, 0.0934001431f},
-std::array<float,2>{0.763225555f, 0.166489229f},
-std::array<float,2>{0.343226612f, 0.681927264f},
-std::array<float,2>{0.707065225f, 0.946574807f},
-std::array<float,2>{0.138833985f, 0.322851896f},
-std::array<float,2>{0.614872754f, 0.445632249f},
-std::array<float,2>{0.0126230503f, 0.85674113f},
-std::array<float,2>{0.924380064f, 0.57564348f},
-std::array<float,2>{0.447132826f, 0.0127581134f},
-std::array<float,2>{0.684665024f, 0.109472238f},
-std::array<float,2>{0.210235626f, 0.552183926f},
-std::array<float,2>{0.818138838f, 0.772181034f},
-std::array<float,2>{0.288494915f, 0.429736435f},
-std::array<float,2>{0.94405812f, 0.300174773f},
-std::array<float,2>{0.433441252f, 0.899857461f},
-std::array<float,2>{0.527626038f, 0.747422874f},
-std::array<float,2>{0.0653212517f, 0.199182704f},
-std::array<float,2>{0.890423298f, 0.0461673029f},
-std::array<float,2>{0.479806334f, 0.611290932f},
-std::array<float,2>{0.564900041f, 0.823417008f},
-std::array<float,2>{0.0425247885f, 0.483476788f},
-std::array<float,2>{0.745036006f, 0.367301077f},
-std::array<float,2>{0.166479439f, 0.981202483f},
-std::array<float,2>{0.783444583f, 0.644976377f},
-std::array<float,2>{0.345649213f, 0.139826238f},
-std::array<float,2>{0.550248027f, 0.242765009f},
-std::array<float,2>{0.111513548f, 0.712690353f},
-std::array<float,2>{0.980403185f, 0.918783188f},
-std::array<float,2>{0.401171029f, 0.262384593f},
-std::array<float,2>{0.855813682f, 0.383936435f},
-std::array<float,2>{0.263375819f, 0.81129998f},
-std::array<float,2>{0.641496718f, 0.506412983f},
-std::array<float,2>{0.242879078f, 0.0750022084f},
-std::array<float,2>{0.995435178f, 0.211954549f},
-std::array<float,2>{0.383675665f, 0.723411977f},
-std::array<float,2>{0.539357781f, 0.882035792f},
-std::array<float,2>{0.10599453f, 0.296221286f},
-std::array<float,2>{0.628140032f, 0.41585958f},
-std::array<float,2>{0.221510202f, 0.755578458f},
-std::array<float,2>{0.863115788f, 0.537611663f},
-std::array<float,2>{0.276690394f, 0.105511054f},
-std::array<float,2>{0.584408581f, 0.0192810632f},
-std::array<float,2>{0.0580811948f, 0.586541474f},
-std::array<float,2>{0.904770315f, 0.868547142f},
-std::array<float,2>{0.484853476f, 0.460402876f},
-std::array<float,2>{0.809472322f, 0.332986325f},
-std::array<float,2>{0.374375641f, 0.954077065f},
-std::array<float,2>{0.733086348f, 0.671321034f},
-std::array<float,2>{0.184920326f, 0.18575421f},
-std::array<float,2>{0.830101371f, 0.0828618705f},
-std::array<float,2>{0.308504552f, 0.521943986f},
-std::array<float,2>{0.661451459f, 0.788021207f},
-std::array<float,2>{0.187694579f, 0.393994868f},
-std::array<float,2>{0.507177174f, 0.277919561f},
-std::array<float,2>{0.0925444514f, 0.928157389f},
-std::array<float,2>{0.968078434f, 0.6885342f},
-std::array<float,2>{0.413362682f, 0.223693088f},
-std::array<float,2>{0.692373395f, 0.147935316f},
-std::array<float,2>{0.155141905f, 0.638448596f},
-std::array<float,2>{0.768781126f, 0.993306756f},
-std::array<float,2>{0.317512006f, 0.343941242f},
-std::array<float,2>{0.918723345f, 0.497357666f},
-std::array<float,2>{0.464297891f, 0.835662067f},
-std::array<float,2>{0.604266107f, 0.607035756f},
-std::array<float,2>{0.0257134996f, 0.052266866f},
-std::array<float,2>{0.872502804f, 0.231683567f},
-std::array<float,2>{0.271790892f, 0.698931336f},
-std::array<float,2>{0.637931347f, 0.935911655f},
-std::array<float,2>{0.231509373f, 0.271077126f},
-std::array<float,2>{0.538085103f, 0.399094969f},
-std::array<float,2>{0.0949238837f, 0.792923391f},
-std::array<float,2>{0.990318477f, 0.529778838f},
-std::array<float,2>{0.38154f, 0.088093169f},
-std::array<float,2>{0.723246336f, 0.0591067523f},
-std::array<float,2>{0.172314003f, 0.600803673f},
-std::array<float,2>{0.797928512f, 0.842115462f},
-std::array<float,2>{0.363552779f, 0.485729486f},
-std::array<float,2>{0.891230822f, 0.353611559f},
-std::array<float,2>{0.498016f, 0.989169836f},
-std::array<float,2>{0.591666639f, 0.629625738f},
-std::array<float,2>{0.0506549552f, 0.15480867f},
-std::array<float,2>{0.960643888f, 0.0940414518f},
-std::array<float,2>{0.417624503f, 0.53924948f},
-std::array<float,2>{0.508901715f, 0.761690915f},
-std::array<float,2>{0.0857608765f, 0.40766862f},
-std::array<float,2>{0.666824341f, 0.286753625f},
-std::array<float,2>{0.203005865f, 0.885886848f},
-std::array<float,2>{0.842006385f, 0.730259895f},
-std::array<float,2>{0.30151993f, 0.205844283f},
-std::array<float,2>{0.597851694f, 0.172456279f},
-std::array<float,2>{0.0182240624f, 0.663949311f},
-std::array<float,2>{0.913389385f, 0.964415908f},
-std::array<float,2>{0.456758887f, 0.342490643f},
-std::array<float,2>{0.774877727f, 0.46591419f},
-std::array<float,2>{0.324638903f, 0.866912246f},
-std::array<float,2>{0.70123899f, 0.579263687f},
-std::array<float,2>{0.147802845f, 0.0251111649f},
-std::array<float,2>{0.933875084f, 0.13008514f},
-std::array<float,2>{0.439821392f, 0.655676663f},
-std::array<float,2>{0.618291616f, 0.970878124f},
-std::array<float,2>{0.00626266655f, 0.361404359f},
-std::array<float,2>{0.715711176f, 0.46979633f},
-std::array<float,2>{0.131127551f, 0.818716526f},
-std::array<float,2>{0.751380801f, 0.622900546f},
-std::array<float,2>{0.329999775f, 0.0378044583f},
-std::array<float,2>{0.52084285f, 0.0638380647f},
-std::array<float,2>{0.0722435489f, 0.513869822f},
-std::array<float,2>{0.952482581f, 0.801760435f},
-std::array<float,2>{0.425556481f, 0.376881331f},
-std::array<float,2>{0.823145986f, 0.255060524f},
-std::array<float,2>{0.293465823f, 0.908871174f},
-std::array<float,2>{0.67326355f, 0.704460323f},
-std::array<float,2>{0.212083682f, 0.235159189f},
-std::array<float,2>{0.789852202f, 0.00513170986f},
-std::array<float,2>{0.355832875f, 0.568758249f},
-std::array<float,2>{0.737597704f, 0.847755671f},
-std::array<float,2>{0.159906685f, 0.441574305f},
-std::array<float,2>{0.571296036f, 0.313231498f},
-std::array<float,2>{0.0359638594f, 0.940369606f},
-std::array<float,2>{0.881134331f, 0.676120937f},
-std::array<float,2>{0.474739611f, 0.160725608f},
-std::array<float,2>{0.654206991f, 0.188008234f},
-std::array<float,2>{0.240728706f, 0.736578166f},
-std::array<float,2>{0.849966943f, 0.897791266f},
-std::array<float,2>{0.250984699f, 0.309789896f},
-std::array<float,2>{0.970077693f, 0.422188759f},
-std::array<float,2>{0.392036051f, 0.777527571f},
-std::array<float,2>{0.56040448f, 0.555674553f},
-std::array<float,2>{0.121836245f, 0.119280465f},
-std::array<float,2>{0.813887298f, 0.150826097f},
-std::array<float,2>{0.28370738f, 0.62681669f},
-std::array<float,2>{0.680009425f, 0.986190379f},
-std::array<float,2>{0.206958085f, 0.358437896f},
-std::array<float,2>{0.523941875f, 0.491764873f},
-std::array<float,2>{0.0675152317f, 0.839627266f},
-std::array<float,2>{0.938962936f, 0.597015083f},
-std::array<float,2>{0.435179472f, 0.0554722138f},
-std::array<float,2>{0.706324816f, 0.0928636715f},
-std::array<float,2>{0.133245692f, 0.524302542f},
-std::array<float,2>{0.760784268f, 0.796030641f},
-std::array<float,2>{0.336611748f, 0.40286684f},
-std::array<float,2>{0.926604152f, 0.267481923f},
-std::array<float,2>{0.452193916f, 0.930657387f},
-std::array<float,2>{0.612577498f, 0.699659109f},
-std::array<float,2>{0.00885614101f, 0.226746008f},
-std::array<float,2>{0.981595039f, 0.0298429094f},
-std::array<float,2>{0.402713776f, 0.582401633f},
-std::array<float,2>{0.554243624f, 0.863203108f},
-std::array<float,2>{0.1170692f, 0.462752432f},
-std::array<float,2>{0.645156622f, 0.33647421f},
-std::array<float,2>{0.24614504f, 0.967610776f},
-std::array<float,2>{0.854182601f, 0.659005225f},
-std::array<float,2>{0.258197039f, 0.17622669f},
-std::array<float,2>{0.567234695f, 0.210056469f},
-std::array<float,2>{0.0455835164f, 0.731583714f},
-std::array<float,2>{0.883008361f, 0.886891365f},
-std::array<float,2>{0.481164902f, 0.281871289f},
-std::array<float,2>{0.789025128f, 0.411150157f},
-std::array<float,2>{0.348853916f, 0.764062226f},
-std::array<float,2>{0.748636901f, 0.544719517f},
-std::array<float,2>{0.171741128f, 0.0986761749f},
-std::array<float,2>{0.899629772f, 0.239565f},
-std::array<float,2>{0.48881191f, 0.709222019f},
-std::array<float,2>{0.580144644f, 0.912691653f},
-std::array<float,2>{0.0618777759f, 0.251244962f},
-std::array<float,2>{0.728828073f, 0.380669981f},
-std::array<float,2>{0.181905091f, 0.798812449f},
-std::array<float,2>{0.806777894f, 0.511649311f},
-std::array<float,2>{0.370387495f, 0.0689160004f},
-std::array<float,2>{0.54431361f, 0.0334140994f},
-std::array<float,2>{0.10497795f, 0.617277503f},
-std::array<float,2>{0.997178137f, 0.815186143f},
-std::array<float,2>{0.389351755f, 0.474141657f},
-std::array<float,2>{0.866133571f, 0.366502106f},
-std::array<float,2>{0.280095667f, 0.976311088f},
-std::array<float,2>{0.631439805f, 0.650651574f},
-std::array<float,2>{0.224762365f, 0.127407849f},
-std::array<float,2>{0.772529364f, 0.12436156f},
-std::array<float,2>{0.312762082f, 0.559825182f},
-std::array<float,2>{0.690495431f, 0.774926066f},
-std::array<float,2>{0.151911706f, 0.426596791f},
-std::array<float,2>{0.608583689f, 0.30722639f},
-std::array<float,2>{0.029744219f, 0.890840471f},
-std::array<float,2>{0.914111555f, 0.74048388f},
-std::array<float,2>{0.466600806f, 0.194419309f},
-std::array<float,2>{0.659196079f, 0.159268618f},
-std::array<float,2>{0.192314565f, 0.673033595f},
-std::array<float,2>{0.83481276f, 0.944106162f},
-std::array<float,2>{0.309229523f, 0.319410741f},
-std::array<float,2>{0.96224916f, 0.437948138f},
-std::array<float,2>{0.409729511f, 0.845901668f},
-std::array<float,2>{0.500306547f, 0.565052509f},
-std::array<float,2>{0.0877023116f, 0.00154946686f},
-std::array<float,2>{0.801675379f, 0.203029618f},
-std::array<float,2>{0.361016452f, 0.7455194f},
-std::array<float,2>{0.722408473f, 0.904137313f},
-std::array<float,2>{0.178561524f, 0.304461181f},
-std::array<float,2>{0.587343991f, 0.436021835f},
-std::array<float,2>{0.0537444688f, 0.767095387f},
-std::array<float,2>{0.896366417f, 0.549481809f},
-std::array<float,2>{0.493860394f, 0.114520602f},
-std::array<float,2>{0.635222018f, 0.00999347586f},
-std::array<float,2>{0.22987403f, 0.570496857f},
-std::array<float,2>{0.868831813f, 0.853371322f},
-std::array<float,2>{0.268338114f, 0.452796459f},
-std::array<float,2>{0.987222135f, 0.326726437f},
-std::array<float,2>{0.3764081f, 0.949289382f},
-std::array<float,2>{0.531401157f, 0.683696568f},
-std::array<float,2>{0.0992325991f, 0.171216846f},
-std::array<float,2>{0.907465518f, 0.0708549172f},
-std::array<float,2>{0.458696246f, 0.502544761f},
-std::array<float,2>{0.595209479f, 0.805359721f},
-std::array<float,2>{0.0225205366f, 0.387346745f},
-std::array<float,2>{0.696826816f, 0.26149267f},
-std::array<float,2>{0.140784383f, 0.914465606f},
-std::array<float,2>{0.779030085f, 0.716570377f},
-std::array<float,2>{0.322017699f, 0.246862799f},
-std::array<float,2>{0.51529628f, 0.135207772f},
-std::array<float,2>{0.0804778337f, 0.642556131f},
-std::array<float,2>{0.955185831f, 0.978128076f},
-std::array<float,2>{0.421715468f, 0.371886522f},
-std::array<float,2>{0.836601019f, 0.4768053f},
-std::array<float,2>{0.296910286f, 0.824988484f},
-std::array<float,2>{0.669117093f, 0.615036428f},
-std::array<float,2>{0.197820902f, 0.0399251394f},
-std::array<float,2>{0.946484804f, 0.182800934f},
-std::array<float,2>{0.426495999f, 0.664781153f},
-std::array<float,2>{0.518389523f, 0.958090961f},
-std::array<float,2>{0.0742400512f, 0.329584152f},
-std::array<float,2>{0.67857492f, 0.455702037f},
-std::array<float,2>{0.215802178f, 0.871684492f},
-std::array<float,2>{0.826068521f, 0.593072653f},
-std::array<float,2>{0.291214973f, 0.0208758097f},
-std::array<float,2>{0.62334913f, 0.103149943f},
-std::array<float,2>{0.00373865641f, 0.531535327f},
-std::array<float,2>{0.931797743f, 0.753780901f},
-std::array<float,2>{0.444759399f, 0.420894653f},
-std::array<float,2>{0.754093647f, 0.289444119f},
-std::array<float,2>{0.33324632f, 0.877369881f},
-std::array<float,2>{0.712365925f, 0.722511172f},
-std::array<float,2>{0.128238276f, 0.216255888f},
-std::array<float,2>{0.84604162f, 0.0499616303f},
-std::array<float,2>{0.254239559f, 0.602751732f},
-std::array<float,2>{0.650255203f, 0.830833673f},
-std::array<float,2>{0.238056868f, 0.494544506f},
-std::array<float,2>{0.557113707f, 0.349979103f},
-std::array<float,2>{0.119845219f, 0.999099135f},
-std::array<float,2>{0.975301206f, 0.633547902f},
-std::array<float,2>{0.396958441f, 0.143599406f},
-std::array<float,2>{0.741546094f, 0.222315416f},
-std::array<float,2>{0.164015293f, 0.694591582f},
-std::array<float,2>{0.795364797f, 0.922852397f},
-std::array<float,2>{0.354759574f, 0.273788035f},
-std::array<float,2>{0.878188431f, 0.396037012f},
-std::array<float,2>{0.471671224f, 0.784963429f},
-std::array<float,2>{0.577094495f, 0.517505586f},
-std::array<float,2>{0.0314640068f, 0.0797853768f},
-std::array<float,2>{0.781757772f, 0.138452649f},
-std::array<float,2>{0.347067088f, 0.64777267f},
-std::array<float,2>{0.74242121f, 0.983496845f},
-std::array<float,2>{0.165777251f, 0.370920628f},
-std::array<float,2>{0.564273298f, 0.480563819f},
-std::array<float,2>{0.0395801924f, 0.821628451f},
-std::array<float,2>{0.887831688f, 0.612809539f},
-std::array<float,2>{0.477496594f, 0.0433156565f},
-std::array<float,2>{0.643192232f, 0.0766656771f},
-std::array<float,2>{0.244833916f, 0.505559623f},
-std::array<float,2>{0.858461261f, 0.810021341f},
-std::array<float,2>{0.265299708f, 0.385328799f},
-std::array<float,2>{0.977382183f, 0.264392257f},
-std::array<float,2>{0.399192423f, 0.921581686f},
-std::array<float,2>{0.547627687f, 0.712923169f},
-std::array<float,2>{0.11093989f, 0.245543301f},
-std::array<float,2>{0.923001587f, 0.0151465684f},
-std::array<float,2>{0.448062956f, 0.577183604f},
-std::array<float,2>{0.616744518f, 0.857617378f},
-std::array<float,2>{0.0147020845f, 0.448231369f},
-std::array<float,2>{0.710099697f, 0.321012974f},
-std::array<float,2>{0.137310281f, 0.948897064f},
-std::array<float,2>{0.765038073f, 0.680817962f},
-std::array<float,2>{0.340738088f, 0.164737642f},
-std::array<float,2>{0.530564249f, 0.196327329f},
-std::array<float,2>{0.0629018322f, 0.74961704f},
-std::array<float,2>{0.941753507f, 0.900572777f},
-std::array<float,2>{0.42983216f, 0.298598528f},
-std::array<float,2>{0.820214152f, 0.432254374f},
-std::array<float,2>{0.286241561f, 0.770393729f},
-std::array<float,2>{0.686929762f, 0.553159833f},
-std::array<float,2>{0.207247645f, 0.111739643f},
-std::array<float,2>{0.964944243f, 0.224682257f},
-std::array<float,2>{0.411107779f, 0.691010118f},
-std::array<float,2>{0.50566107f, 0.926171899f},
-std::array<float,2>{0.0902921855f, 0.279871255f},
-std::array<float,2>{0.664058805f, 0.390998781f},
-std::array<float,2>{0.190012828f, 0.786031067f},
-std::array<float,2>{0.829446912f, 0.520832956f},
-std::array<float,2>{0.306509197f, 0.0844390988f},
-std::array<float,2>{0.601990581f, 0.052990716f},
-std::array<float,2>{0.0244993661f, 0.608258069f},
-std::array<float,2>{0.920228243f, 0.833083212f},
-std::array<float,2>{0.460937858f, 0.498149365f},
-std::array<float,2>{0.765704691f, 0.346791267f},
-std::array<float,2>{0.319773257f, 0.99509567f},
-std::array<float,2>{0.693876803f, 0.640523612f},
-std::array<float,2>{0.153688446f, 0.146422759f},
-std::array<float,2>{0.860134482f, 0.107891522f},
-std::array<float,2>{0.273753196f, 0.535390317f},
-std::array<float,2>{0.626229703f, 0.756542742f},
-std::array<float,2>{0.219187528f, 0.417147309f},
-std::array<float,2>{0.541287661f, 0.294015527f},
-std::array<float,2>{0.109023876f, 0.880218446f},
-std::array<float,2>{0.993742526f, 0.725487411f},
-std::array<float,2>{0.38624987f, 0.213087171f},
-std::array<float,2>{0.731551766f, 0.18403697f},
-std::array<float,2>{0.186255977f, 0.668386102f},
-std::array<float,2>{0.81202805f, 0.957009077f},
-std::array<float,2>{0.372581512f, 0.334605396f},
-std::array<float,2>{0.902814507f, 0.457382232f},
-std::array<float,2>{0.486761779f, 0.870856643f},
-std::array<float,2>{0.583188832f, 0.589615822f},
-std::array<float,2>{0.0548407957f, 0.0162232518f},
-std::array<float,2>{0.840355992f, 0.204789251f},
-std::array<float,2>{0.303460389f, 0.728511572f},
-std::array<float,2>{0.665224075f, 0.883024514f},
-std::array<float,2>{0.199556231f, 0.288441807f},
-std::array<float,2>{0.510106683f, 0.409111381f},
-std::array<float,2>{0.0839719102f, 0.758122087f},
-std::array<float,2>{0.958887041f, 0.541046858f},
-std::array<float,2>{0.415952832f, 0.0957871154f},
-std::array<float,2>{0.700280368f, 0.0268764626f},
-std::array<float,2>{0.145945951f, 0.581392884f},
-std::array<float,2>{0.775714397f, 0.863919497f},
-std::array<float,2>{0.327089757f, 0.467777014f},
-std::array<float,2>{0.910852015f, 0.340570897f},
-std::array<float,2>{0.455029666f, 0.961491048f},
-std::array<float,2>{0.599627972f, 0.661886334f},
-std::array<float,2>{0.017005533f, 0.174861297f},
-std::array<float,2>{0.990016818f, 0.0874403641f},
-std::array<float,2>{0.378929794f, 0.527727902f},
-std::array<float,2>{0.536278009f, 0.789425433f},
-std::array<float,2>{0.0969907343f, 0.400576621f},
-std::array<float,2>{0.63873589f, 0.27200225f},
-std::array<float,2>{0.23304607f, 0.934170365f},
-std::array<float,2>{0.874015927f, 0.696364582f},
-std::array<float,2>{0.270998567f, 0.233845726f},
-std::array<float,2>{0.592562377f, 0.152734041f},
-std::array<float,2>{0.0486328155f, 0.631251812f},
-std::array<float,2>{0.894518137f, 0.991452038f},
-std::array<float,2>{0.499736279f, 0.352912366f},
-std::array<float,2>{0.800129235f, 0.487008572f},
-std::array<float,2>{0.36552766f, 0.840424478f},
-std::array<float,2>{0.726477325f, 0.599012196f},
-std::array<float,2>{0.175604776f, 0.0607072897f},
-std::array<float,2>{0.87898469f, 0.162906334f},
-std::array<float,2>{0.47299397f, 0.678126991f},
-std::array<float,2>{0.572716773f, 0.938702226f},
-std::array<float,2>{0.0383698642f, 0.315113217f},
-std::array<float,2>{0.736078203f, 0.443991393f},
-std::array<float,2>{0.157807603f, 0.850489497f},
-std::array<float,2>{0.792551577f, 0.566512287f},
-std::array<float,2>{0.358078837f, 0.00695061265f},
-std::array<float,2>{0.5619995f, 0.118507884f},
-std::array<float,2>{0.124472179f, 0.558261931f},
-std::array<float,2>{0.971595585f, 0.780685365f},
-std::array<float,2>{0.393642128f, 0.425388366f},
-std::array<float,2>{0.849068344f, 0.311557382f},
-std::array<float,2>{0.252756149f, 0.896102607f},
-std::array<float,2>{0.654585123f, 0.73590374f},
-std::array<float,2>{0.238401994f, 0.190715641f},
-std::array<float,2>{0.752519727f, 0.0360434204f},
-std::array<float,2>{0.330779046f, 0.623103321f},
-std::array<float,2>{0.717104554f, 0.817174673f},
-std::array<float,2>{0.130169645f, 0.470766246f},
-std::array<float,2>{0.619752169f, 0.360017598f},
-std::array<float,2>{0.00394334458f, 0.969947636f},
-std::array<float,2>{0.937306345f, 0.653925061f},
-std::array<float,2>{0.438877672f, 0.130870447f},
-std::array<float,2>{0.675600171f, 0.238264799f},
-std::array<float,2>{0.213410228f, 0.705363452f},
-std::array<float,2>{0.820556104f, 0.906729102f},
-std::array<float,2>{0.295607626f, 0.257640034f},
-std::array<float,2>{0.950173438f, 0.378884643f},
-std::array<float,2>{0.422158688f, 0.803569138f},
-std::array<float,2>{0.522845089f, 0.513463855f},
-std::array<float,2>{0.0738872215f, 0.065187864f},
-std::array<float,2>{0.851588547f, 0.17894958f},
-std::array<float,2>{0.261507064f, 0.657842934f},
-std::array<float,2>{0.648169458f, 0.965858221f},
-std::array<float,2>{0.249193773f, 0.339187175f},
-std::array<float,2>{0.551087916f, 0.463882118f},
-std::array<float,2>{0.114953808f, 0.85956645f},
-std::array<float,2>{0.983364403f, 0.585669875f},
-std::array<float,2>{0.404767394f, 0.028529698f},
-std::array<float,2>{0.747042358f, 0.0997447893f},
-std::array<float,2>{0.169231728f, 0.546265066f},
-std::array<float,2>{0.785331309f, 0.762334704f},
-std::array<float,2>{0.350438267f, 0.413676947f},
-std::array<float,2>{0.886407971f, 0.284899503f},
-std::array<float,2>{0.48367402f, 0.888917506f},
-std::array<float,2>{0.568838954f, 0.73377192f},
-std::array<float,2>{0.0438227728f, 0.207981452f},
-std::array<float,2>{0.939927042f, 0.0576026589f},
-std::array<float,2>{0.436016053f, 0.593873501f},
-std::array<float,2>{0.527179122f, 0.837188184f},
-std::array<float,2>{0.0694640577f, 0.489875704f},
-std::array<float,2>{0.682993114f, 0.356309146f},
-std::array<float,2>{0.203412309f, 0.987854302f},
-std::array<float,2>{0.814874172f, 0.628513396f},
-std::array<float,2>{0.28174141f, 0.14994517f},
-std::array<float,2>{0.609842777f, 0.228781998f},
-std::array<float,2>{0.00996286608f, 0.702427208f},
-std::array<float,2>{0.929353118f, 0.932816207f},
-std::array<float,2>{0.449497104f, 0.26863119f},
-std::array<float,2>{0.758409202f, 0.404838175f},
-std::array<float,2>{0.338296086f, 0.793242931f},
-std::array<float,2>{0.703349888f, 0.526974261f},
-std::array<float,2>{0.135697514f, 0.0909202695f},
-std::array<float,2>{0.917668879f, 0.191805512f},
-std::array<float,2>{0.46699363f, 0.738487184f},
-std::array<float,2>{0.607076406f, 0.892736316f},
-std::array<float,2>{0.0287920088f, 0.305120677f},
-std::array<float,2>{0.688493609f, 0.428003103f},
-std::array<float,2>{0.150278315f, 0.775613546f},
-std::array<float,2>{0.770362496f, 0.561429322f},
-std::array<float,2>{0.314670563f, 0.12165834f},
-std::array<float,2>{0.502031863f, 0.00263707573f},
-std::array<float,2>{0.0891353562f, 0.56306988f},
-std::array<float,2>{0.962926745f, 0.843994975f},
-std::array<float,2>{0.406319797f, 0.439698488f},
-std::array<float,2>{0.832379818f, 0.316858888f},
-std::array<float,2>{0.31228292f, 0.942761719f},
-std::array<float,2>{0.657776415f, 0.675056398f},
-std::array<float,2>{0.194999531f, 0.156778365f},
-std::array<float,2>{0.804699302f, 0.0681714937f},
-std::array<float,2>{0.369028032f, 0.508986771f},
-std::array<float,2>{0.72791034f, 0.799933851f},
-std::array<float,2>{0.180426434f, 0.381177932f},
-std::array<float,2>{0.579777777f, 0.253787696f},
-std::array<float,2>{0.0593916997f, 0.910839796f},
-std::array<float,2>{0.901693821f, 0.708441734f},
-std::array<float,2>{0.491555899f, 0.240591124f},
-std::array<float,2>{0.629500329f, 0.125304103f},
-std::array<float,2>{0.222668976f, 0.649474263f},
-std::array<float,2>{0.863821149f, 0.973705888f},
-std::array<float,2>{0.277730018f, 0.363728076f},
-std::array<float,2>{0.99941504f, 0.475179464f},
-std::array<float,2>{0.386737317f, 0.813792288f},
-std::array<float,2>{0.546600401f, 0.619597733f},
-std::array<float,2>{0.102234825f, 0.0329119302f},
-std::array<float,2>{0.77936089f, 0.248438552f},
-std::array<float,2>{0.323256314f, 0.717770159f},
-std::array<float,2>{0.699092031f, 0.916725099f},
-std::array<float,2>{0.143096164f, 0.259023607f},
-std::array<float,2>{0.596767545f, 0.390176624f},
-std::array<float,2>{0.0204899516f, 0.808304131f},
-std::array<float,2>{0.909107149f, 0.500227928f},
-std::array<float,2>{0.460576862f, 0.0726762563f},
-std::array<float,2>{0.671824932f, 0.041278597f},
-std::array<float,2>{0.196229175f, 0.616602182f},
-std::array<float,2>{0.838823318f, 0.827271104f},
-std::array<float,2>{0.29971689f, 0.479404986f},
-std::array<float,2>{0.954569161f, 0.373784065f},
-std::array<float,2>{0.419011146f, 0.979529381f},
-std::array<float,2>{0.512837887f, 0.644520998f},
-std::array<float,2>{0.0789027736f, 0.13428539f},
-std::array<float,2>{0.897993624f, 0.116815269f},
-std::array<float,2>{0.494793743f, 0.547298014f},
-std::array<float,2>{0.588719308f, 0.767871618f},
-std::array<float,2>{0.0511215925f, 0.433861256f},
-std::array<float,2>{0.720393121f, 0.300808936f},
-std::array<float,2>{0.177556068f, 0.904611647f},
-std::array<float,2>{0.803323925f, 0.743275166f},
-std::array<float,2>{0.362727761f, 0.199489161f},
-std::array<float,2>{0.53342545f, 0.168061867f},
-std::array<float,2>{0.10114561f, 0.686799943f},
-std::array<float,2>{0.98494035f, 0.952664971f},
-std::array<float,2>{0.377581805f, 0.325090915f},
-std::array<float,2>{0.869760871f, 0.450621903f},
-std::array<float,2>{0.266640007f, 0.854915857f},
-std::array<float,2>{0.633093059f, 0.573407829f},
-std::array<float,2>{0.226867899f, 0.00885626115f},
-std::array<float,2>{0.972801089f, 0.140749872f},
-std::array<float,2>{0.39476946f, 0.635729313f},
-std::array<float,2>{0.5556674f, 0.997527063f},
-std::array<float,2>{0.118385792f, 0.348650455f},
-std::array<float,2>{0.650989771f, 0.493329793f},
-std::array<float,2>{0.23584798f, 0.828727603f},
-std::array<float,2>{0.845144272f, 0.603577435f},
-std::array<float,2>{0.257322907f, 0.0469797365f},
-std::array<float,2>{0.575773835f, 0.0819300339f},
-std::array<float,2>{0.0351317748f, 0.517691374f},
-std::array<float,2>{0.876235902f, 0.781311095f},
-std::array<float,2>{0.469175965f, 0.397125244f},
-std::array<float,2>{0.792991877f, 0.275990307f},
-std::array<float,2>{0.351787031f, 0.924752355f},
-std::array<float,2>{0.740049362f, 0.692243874f},
-std::array<float,2>{0.160821617f, 0.219271988f},
-std::array<float,2>{0.826880217f, 0.0231455229f},
-std::array<float,2>{0.290987819f, 0.589940071f},
-std::array<float,2>{0.676704347f, 0.874775052f},
-std::array<float,2>{0.217525005f, 0.453247011f},
-std::array<float,2>{0.516713321f, 0.330771625f},
-std::array<float,2>{0.0772842094f, 0.959400356f},
-std::array<float,2>{0.947755098f, 0.666601658f},
-std::array<float,2>{0.429309726f, 0.180508718f},
-std::array<float,2>{0.713219464f, 0.217404321f},
-std::array<float,2>{0.126153991f, 0.720528126f},
-std::array<float,2>{0.756000698f, 0.875571549f},
-std::array<float,2>{0.334627032f, 0.291931689f},
-std::array<float,2>{0.929909587f, 0.4190512f},
-std::array<float,2>{0.441668123f, 0.751858592f},
-std::array<float,2>{0.621755838f, 0.534996271f},
-std::array<float,2>{8.00431881e-05f, 0.104068637f},
-std::array<float,2>{0.768306017f, 0.144975498f},
-std::array<float,2>{0.317146331f, 0.638688982f},
-std::array<float,2>{0.692511499f, 0.995533109f},
-std::array<float,2>{0.156136259f, 0.346542776f},
-std::array<float,2>{0.605021894f, 0.499796271f},
-std::array<float,2>{0.0263988078f, 0.832171381f},
-std::array<float,2>{0.919761658f, 0.609027684f},
-std::array<float,2>{0.462919593f, 0.0541270711f},
-std::array<float,2>{0.660931349f, 0.0855761468f},
-std::array<float,2>{0.189037636f, 0.51977396f},
-std::array<float,2>{0.831564426f, 0.786475182f},
-std::array<float,2>{0.307192445f, 0.392380625f},
-std::array<float,2>{0.967636645f, 0.281088918f},
-std::array<float,2>{0.412124336f, 0.927440822f},
-std::array<float,2>{0.506666958f, 0.689535141f},
-std::array<float,2>{0.0930043161f, 0.225758865f},
-std::array<float,2>{0.905839562f, 0.017345462f},
-std::array<float,2>{0.485861242f, 0.588122547f},
-std::array<float,2>{0.585838914f, 0.869718611f},
-std::array<float,2>{0.0571250245f, 0.458049357f},
-std::array<float,2>{0.73393023f, 0.335048109f},
-std::array<float,2>{0.184280634f, 0.955261111f},
-std::array<float,2>{0.810288072f, 0.669080913f},
-std::array<float,2>{0.373296469f, 0.184742585f},
-std::array<float,2>{0.540219247f, 0.214611694f},
-std::array<float,2>{0.106508724f, 0.726251423f},
-std::array<float,2>{0.994301736f, 0.879765034f},
-std::array<float,2>{0.384037197f, 0.293105572f},
-std::array<float,2>{0.861785591f, 0.416759163f},
-std::array<float,2>{0.276046634f, 0.757155001f},
-std::array<float,2>{0.627036691f, 0.537004054f},
-std::array<float,2>{0.222584933f, 0.10880316f},
-std::array<float,2>{0.978897333f, 0.245017856f},
-std::array<float,2>{0.402239263f, 0.714353561f},
-std::array<float,2>{0.54978025f, 0.920280814f},
-std::array<float,2>{0.11318475f, 0.265261471f},
-std::array<float,2>{0.641768992f, 0.385747939f},
-std::array<float,2>{0.243375152f, 0.809126854f},
-std::array<float,2>{0.857263565f, 0.504488885f},
-std::array<float,2>{0.262182981f, 0.0779875815f},
-std::array<float,2>{0.566342354f, 0.0442179404f},
-std::array<float,2>{0.0410534777f, 0.611416638f},
-std::array<float,2>{0.888927817f, 0.820339382f},
-std::array<float,2>{0.479441047f, 0.481506079f},
-std::array<float,2>{0.784617782f, 0.369366646f},
-std::array<float,2>{0.344566435f, 0.982671082f},
-std::array<float,2>{0.746034861f, 0.646653354f},
-std::array<float,2>{0.167300075f, 0.137082145f},
-std::array<float,2>{0.816834748f, 0.113237925f},
-std::array<float,2>{0.287340283f, 0.553832233f},
-std::array<float,2>{0.68406111f, 0.770712256f},
-std::array<float,2>{0.209121719f, 0.433129847f},
-std::array<float,2>{0.529295743f, 0.297263652f},
-std::array<float,2>{0.0655685514f, 0.90153712f},
-std::array<float,2>{0.94436574f, 0.748306036f},
-std::array<float,2>{0.43224442f, 0.195381731f},
-std::array<float,2>{0.708440959f, 0.16531688f},
-std::array<float,2>{0.140346572f, 0.679863036f},
-std::array<float,2>{0.762284875f, 0.948091507f},
-std::array<float,2>{0.34270069f, 0.322089255f},
-std::array<float,2>{0.925691962f, 0.448515207f},
-std::array<float,2>{0.446123391f, 0.858679891f},
-std::array<float,2>{0.614228487f, 0.576510608f},
-std::array<float,2>{0.0135156149f, 0.0143004628f},
-std::array<float,2>{0.850840032f, 0.190107644f},
-std::array<float,2>{0.250607193f, 0.734597445f},
-std::array<float,2>{0.652534962f, 0.8948071f},
-std::array<float,2>{0.241596729f, 0.311268002f},
-std::array<float,2>{0.558860898f, 0.423922181f},
-std::array<float,2>{0.122408845f, 0.779334545f},
-std::array<float,2>{0.96930325f, 0.557405055f},
-std::array<float,2>{0.390764952f, 0.117618732f},
-std::array<float,2>{0.736763418f, 0.0062335832f},
-std::array<float,2>{0.159010842f, 0.56814158f},
-std::array<float,2>{0.790827692f, 0.851171732f},
-std::array<float,2>{0.357189476f, 0.444724113f},
-std::array<float,2>{0.882590353f, 0.315572977f},
-std::array<float,2>{0.476018071f, 0.937584043f},
-std::array<float,2>{0.570515692f, 0.679162741f},
-std::array<float,2>{0.0365912244f, 0.164056078f},
-std::array<float,2>{0.951573253f, 0.0659790635f},
-std::array<float,2>{0.424496084f, 0.511753261f},
-std::array<float,2>{0.520403445f, 0.804088056f},
-std::array<float,2>{0.0704939738f, 0.377688855f},
-std::array<float,2>{0.672101796f, 0.256086409f},
-std::array<float,2>{0.211540684f, 0.907229304f},
-std::array<float,2>{0.823313653f, 0.706992447f},
-std::array<float,2>{0.293964326f, 0.236877665f},
-std::array<float,2>{0.617589414f, 0.132501587f},
-std::array<float,2>{0.00756699825f, 0.652779102f},
-std::array<float,2>{0.934595287f, 0.969635844f},
-std::array<float,2>{0.440579385f, 0.360976309f},
-std::array<float,2>{0.750198066f, 0.472363681f},
-std::array<float,2>{0.328452826f, 0.817612529f},
-std::array<float,2>{0.715859413f, 0.624777317f},
-std::array<float,2>{0.132678583f, 0.0362755954f},
-std::array<float,2>{0.912316561f, 0.174468055f},
-std::array<float,2>{0.455436647f, 0.660266697f},
-std::array<float,2>{0.598726392f, 0.962181926f},
-std::array<float,2>{0.0187420435f, 0.341646224f},
-std::array<float,2>{0.702264488f, 0.467734784f},
-std::array<float,2>{0.147089869f, 0.865222812f},
-std::array<float,2>{0.773727715f, 0.580591023f},
-std::array<float,2>{0.325215906f, 0.025425097f},
-std::array<float,2>{0.508395553f, 0.0969061926f},
-std::array<float,2>{0.0847004652f, 0.542045534f},
-std::array<float,2>{0.95988965f, 0.759462655f},
-std::array<float,2>{0.416791826f, 0.409638256f},
-std::array<float,2>{0.843682528f, 0.28792879f},
-std::array<float,2>{0.302513629f, 0.884123743f},
-std::array<float,2>{0.667122602f, 0.727014959f},
-std::array<float,2>{0.20188795f, 0.20348452f},
-std::array<float,2>{0.797346711f, 0.062045984f},
-std::array<float,2>{0.365083098f, 0.597907066f},
-std::array<float,2>{0.724231958f, 0.841374874f},
-std::array<float,2>{0.172879905f, 0.487852603f},
-std::array<float,2>{0.590785205f, 0.352067739f},
-std::array<float,2>{0.0494716503f, 0.990553856f},
-std::array<float,2>{0.89168781f, 0.632043004f},
-std::array<float,2>{0.496922761f, 0.153378963f},
-std::array<float,2>{0.637650669f, 0.233344927f},
-std::array<float,2>{0.230967224f, 0.696201324f},
-std::array<float,2>{0.871876061f, 0.935096383f},
-std::array<float,2>{0.272867978f, 0.272545069f},
-std::array<float,2>{0.992180109f, 0.402041674f},
-std::array<float,2>{0.382494658f, 0.790817678f},
-std::array<float,2>{0.538502455f, 0.528595686f},
-std::array<float,2>{0.0939839929f, 0.0859531462f},
-std::array<float,2>{0.835261047f, 0.157518312f},
-std::array<float,2>{0.3103894f, 0.673857629f},
-std::array<float,2>{0.65833509f, 0.941840708f},
-std::array<float,2>{0.192860514f, 0.31791994f},
-std::array<float,2>{0.501892328f, 0.440523297f},
-std::array<float,2>{0.0862656236f, 0.845425487f},
-std::array<float,2>{0.961585104f, 0.564049125f},
-std::array<float,2>{0.408792913f, 0.00366031029f},
-std::array<float,2>{0.69013989f, 0.122219741f},
-std::array<float,2>{0.151277304f, 0.562008023f},
-std::array<float,2>{0.771568894f, 0.77705729f},
-std::array<float,2>{0.314320177f, 0.428915113f},
-std::array<float,2>{0.915622354f, 0.305820167f},
-std::array<float,2>{0.465311319f, 0.893788695f},
-std::array<float,2>{0.608185589f, 0.740065217f},
-std::array<float,2>{0.0311987046f, 0.192956924f},
-std::array<float,2>{0.996951938f, 0.0316210091f},
-std::array<float,2>{0.389886588f, 0.620464444f},
-std::array<float,2>{0.543590784f, 0.813225627f},
-std::array<float,2>{0.103969343f, 0.47622633f},
-std::array<float,2>{0.632187545f, 0.36474964f},
-std::array<float,2>{0.225606874f, 0.973540902f},
-std::array<float,2>{0.866426528f, 0.648606777f},
-std::array<float,2>{0.281063765f, 0.126058534f},
-std::array<float,2>{0.581263542f, 0.241588086f},
-std::array<float,2>{0.0610162467f, 0.707034767f},
-std::array<float,2>{0.899270296f, 0.911500752f},
-std::array<float,2>{0.489626586f, 0.25223276f},
-std::array<float,2>{0.80826807f, 0.382431209f},
-std::array<float,2>{0.370008528f, 0.799587727f},
-std::array<float,2>{0.730211377f, 0.508098841f},
-std::array<float,2>{0.183278695f, 0.0665354505f},
-std::array<float,2>{0.884310246f, 0.2086979f},
-std::array<float,2>{0.481567502f, 0.732561111f},
-std::array<float,2>{0.568332314f, 0.88996762f},
-std::array<float,2>{0.0466098972f, 0.283366799f},
-std::array<float,2>{0.749820411f, 0.41236636f},
-std::array<float,2>{0.170212492f, 0.762965977f},
-std::array<float,2>{0.787617326f, 0.545594752f},
-std::array<float,2>{0.348590374f, 0.100893088f},
-std::array<float,2>{0.553624034f, 0.0279113483f},
-std::array<float,2>{0.115396075f, 0.58409971f},
-std::array<float,2>{0.981220067f, 0.860788584f},
-std::array<float,2>{0.403581053f, 0.463383645f},
-std::array<float,2>{0.854554653f, 0.338094085f},
-std::array<float,2>{0.259059519f, 0.965070009f},
-std::array<float,2>{0.646114886f, 0.656351626f},
-std::array<float,2>{0.247168094f, 0.178654954f},
-std::array<float,2>{0.759863079f, 0.0904864594f},
-std::array<float,2>{0.337008893f, 0.526342094f},
-std::array<float,2>{0.705085576f, 0.794612229f},
-std::array<float,2>{0.134224951f, 0.405749142f},
-std::array<float,2>{0.611619532f, 0.267762363f},
-std::array<float,2>{0.00867042691f, 0.932018399f},
-std::array<float,2>{0.927482128f, 0.7015692f},
-std::array<float,2>{0.451407909f, 0.229576126f},
-std::array<float,2>{0.681117594f, 0.149377808f},
-std::array<float,2>{0.206037715f, 0.627463281f},
-std::array<float,2>{0.812752783f, 0.987105668f},
-std::array<float,2>{0.284426779f, 0.35736385f},
-std::array<float,2>{0.937621891f, 0.489038527f},
-std::array<float,2>{0.433800161f, 0.836540639f},
-std::array<float,2>{0.525276363f, 0.59487009f},
-std::array<float,2>{0.066566281f, 0.0584419109f},
-std::array<float,2>{0.796499968f, 0.219847545f},
-std::array<float,2>{0.353540003f, 0.693304956f},
-std::array<float,2>{0.741170585f, 0.925474465f},
-std::array<float,2>{0.163081482f, 0.27692461f},
-std::array<float,2>{0.577932298f, 0.397752047f},
-std::array<float,2>{0.0322633088f, 0.783174634f},
-std::array<float,2>{0.877756f, 0.519019544f},
-std::array<float,2>{0.471866637f, 0.0801027641f},
-std::array<float,2>{0.64911449f, 0.0483246185f},
-std::array<float,2>{0.237125546f, 0.604970217f},
-std::array<float,2>{0.847348273f, 0.829977572f},
-std::array<float,2>{0.255247504f, 0.493001759f},
-std::array<float,2>{0.975678921f, 0.348545909f},
-std::array<float,2>{0.397511542f, 0.996378958f},
-std::array<float,2>{0.558428466f, 0.636513352f},
-std::array<float,2>{0.121011585f, 0.141639665f},
-std::array<float,2>{0.933477581f, 0.105446443f},
-std::array<float,2>{0.443601996f, 0.533646762f},
-std::array<float,2>{0.624942422f, 0.750828385f},
-std::array<float,2>{0.00227880268f, 0.418321222f},
-std::array<float,2>{0.710974693f, 0.292462379f},
-std::array<float,2>{0.127169788f, 0.876154244f},
-std::array<float,2>{0.75549686f, 0.719388723f},
-std::array<float,2>{0.332616776f, 0.218734458f},
-std::array<float,2>{0.518796444f, 0.181591853f},
-std::array<float,2>{0.0760124102f, 0.667937577f},
-std::array<float,2>{0.945648372f, 0.960365891f},
-std::array<float,2>{0.427649081f, 0.33177948f},
-std::array<float,2>{0.824551165f, 0.454175949f},
-std::array<float,2>{0.292015493f, 0.873150945f},
-std::array<float,2>{0.678859591f, 0.591754317f},
-std::array<float,2>{0.216643959f, 0.0216838904f},
-std::array<float,2>{0.956755638f, 0.133206159f},
-std::array<float,2>{0.42070058f, 0.643048048f},
-std::array<float,2>{0.514644742f, 0.978618085f},
-std::array<float,2>{0.0818268508f, 0.374141991f},
-std::array<float,2>{0.66844362f, 0.479799211f},
-std::array<float,2>{0.198486999f, 0.826945841f},
-std::array<float,2>{0.836936176f, 0.615573287f},
-std::array<float,2>{0.298271298f, 0.0423372686f},
-std::array<float,2>{0.593946576f, 0.0735061616f},
-std::array<float,2>{0.021835627f, 0.501036644f},
-std::array<float,2>{0.906371355f, 0.807330489f},
-std::array<float,2>{0.457781017f, 0.389493853f},
-std::array<float,2>{0.777648211f, 0.258708924f},
-std::array<float,2>{0.320388854f, 0.917862177f},
-std::array<float,2>{0.696193099f, 0.717875421f},
-std::array<float,2>{0.14200969f, 0.249933004f},
-std::array<float,2>{0.867343962f, 0.00807341747f},
-std::array<float,2>{0.269529432f, 0.572282195f},
-std::array<float,2>{0.635938048f, 0.854151785f},
-std::array<float,2>{0.229482085f, 0.449996561f},
-std::array<float,2>{0.532701075f, 0.325475842f},
-std::array<float,2>{0.0979196727f, 0.951378524f},
-std::array<float,2>{0.988237739f, 0.686427832f},
-std::array<float,2>{0.375726581f, 0.169307321f},
-std::array<float,2>{0.720844746f, 0.201111034f},
-std::array<float,2>{0.179506674f, 0.74264437f},
-std::array<float,2>{0.802260697f, 0.905718863f},
-std::array<float,2>{0.35963586f, 0.302512646f},
-std::array<float,2>{0.89520061f, 0.435312629f},
-std::array<float,2>{0.492457837f, 0.76882422f},
-std::array<float,2>{0.586661756f, 0.548616648f},
-std::array<float,2>{0.0532290861f, 0.11616759f},
-std::array<float,2>{0.810592055f, 0.187193245f},
-std::array<float,2>{0.371169209f, 0.669968188f},
-std::array<float,2>{0.730585039f, 0.954844534f},
-std::array<float,2>{0.187468588f, 0.333066911f},
-std::array<float,2>{0.582562625f, 0.459773421f},
-std::array<float,2>{0.0565848164f, 0.868044615f},
-std::array<float,2>{0.903394699f, 0.587173641f},
-std::array<float,2>{0.487538934f, 0.0182660539f},
-std::array<float,2>{0.62543124f, 0.106499337f},
-std::array<float,2>{0.219740108f, 0.538804054f},
-std::array<float,2>{0.861047924f, 0.75402236f},
-std::array<float,2>{0.275079042f, 0.414637715f},
-std::array<float,2>{0.992670119f, 0.295728117f},
-std::array<float,2>{0.385123014f, 0.881726861f},
-std::array<float,2>{0.542811871f, 0.724582314f},
-std::array<float,2>{0.107721783f, 0.211655587f},
-std::array<float,2>{0.920946121f, 0.0516663119f},
-std::array<float,2>{0.462245554f, 0.606301367f},
-std::array<float,2>{0.60345f, 0.834899127f},
-std::array<float,2>{0.024358483f, 0.496692032f},
-std::array<float,2>{0.694908917f, 0.344799846f},
-std::array<float,2>{0.153255597f, 0.992940009f},
-std::array<float,2>{0.76686579f, 0.637593448f},
-std::array<float,2>{0.319267958f, 0.146956995f},
-std::array<float,2>{0.504860461f, 0.223353982f},
-std::array<float,2>{0.0909878835f, 0.68782562f},
-std::array<float,2>{0.965950191f, 0.929053128f},
-std::array<float,2>{0.411367387f, 0.278543115f},
-std::array<float,2>{0.828518987f, 0.392919153f},
-std::array<float,2>{0.305053949f, 0.78812325f},
-std::array<float,2>{0.662478566f, 0.522843719f},
-std::array<float,2>{0.190698311f, 0.0833089128f},
-std::array<float,2>{0.942980707f, 0.197659716f},
-std::array<float,2>{0.4307428f, 0.746816218f},
-std::array<float,2>{0.530121148f, 0.899292827f},
-std::array<float,2>{0.0641232878f, 0.299072742f},
-std::array<float,2>{0.685926259f, 0.431319118f},
-std::array<float,2>{0.208790198f, 0.772965729f},
-std::array<float,2>{0.818685532f, 0.551425278f},
-std::array<float,2>{0.285757154f, 0.110943407f},
-std::array<float,2>{0.615784466f, 0.0120101655f},
-std::array<float,2>{0.0140853385f, 0.574396133f},
-std::array<float,2>{0.922483206f, 0.85634762f},
-std::array<float,2>{0.44838807f, 0.446574718f},
-std::array<float,2>{0.764210165f, 0.323492706f},
-std::array<float,2>{0.341403872f, 0.945416331f},
-std::array<float,2>{0.709878266f, 0.683212221f},
-std::array<float,2>{0.138595745f, 0.167337134f},
-std::array<float,2>{0.858006716f, 0.0761592239f},
-std::array<float,2>{0.264426082f, 0.507030487f},
-std::array<float,2>{0.644383848f, 0.811736465f},
-std::array<float,2>{0.245449632f, 0.383051634f},
-std::array<float,2>{0.547953725f, 0.262835383f},
-std::array<float,2>{0.109949246f, 0.919481516f},
-std::array<float,2>{0.97810328f, 0.711207747f},
-std::array<float,2>{0.400159925f, 0.243904337f},
-std::array<float,2>{0.743736446f, 0.13964574f},
-std::array<float,2>{0.164644569f, 0.645913363f},
-std::array<float,2>{0.782839239f, 0.982256234f},
-std::array<float,2>{0.34624061f, 0.368654907f},
-std::array<float,2>{0.88735348f, 0.483031303f},
-std::array<float,2>{0.478063464f, 0.823132157f},
-std::array<float,2>{0.563135624f, 0.609634459f},
-std::array<float,2>{0.040246699f, 0.0456142947f},
-std::array<float,2>{0.821680307f, 0.235439762f},
-std::array<float,2>{0.296354234f, 0.703776777f},
-std::array<float,2>{0.67459631f, 0.90988481f},
-std::array<float,2>{0.214358807f, 0.254709631f},
-std::array<float,2>{0.522006392f, 0.375790477f},
-std::array<float,2>{0.073044613f, 0.801060855f},
-std::array<float,2>{0.9510445f, 0.515476763f},
-std::array<float,2>{0.423269331f, 0.062902607f},
-std::array<float,2>{0.717864096f, 0.038882535f},
-std::array<float,2>{0.129121333f, 0.621465743f},
-std::array<float,2>{0.753638208f, 0.820252001f},
-std::array<float,2>{0.331078321f, 0.468916982f},
-std::array<float,2>{0.936302304f, 0.362313151f},
-std::array<float,2>{0.438289344f, 0.972222149f},
-std::array<float,2>{0.620873511f, 0.654994249f},
-std::array<float,2>{0.00540068932f, 0.129348248f},
-std::array<float,2>{0.97190398f, 0.120344885f},
-std::array<float,2>{0.393048942f, 0.555137336f},
-std::array<float,2>{0.560822368f, 0.778973162f},
-std::array<float,2>{0.123166174f, 0.423546731f},
-std::array<float,2>{0.656015694f, 0.3091093f},
-std::array<float,2>{0.240158394f, 0.896934807f},
-std::array<float,2>{0.847975016f, 0.738108099f},
-std::array<float,2>{0.253187776f, 0.189176008f},
-std::array<float,2>{0.573706508f, 0.161354944f},
-std::array<float,2>{0.0380406603f, 0.677107751f},
-std::array<float,2>{0.88058275f, 0.94062978f},
-std::array<float,2>{0.474230796f, 0.314443588f},
-std::array<float,2>{0.791196883f, 0.443266392f},
-std::array<float,2>{0.359149486f, 0.849482477f},
-std::array<float,2>{0.734916687f, 0.569846511f},
-std::array<float,2>{0.156645626f, 0.00483381748f},
-std::array<float,2>{0.893379211f, 0.155510783f},
-std::array<float,2>{0.498779386f, 0.630545259f},
-std::array<float,2>{0.593211055f, 0.989815891f},
-std::array<float,2>{0.0471078418f, 0.355108708f},
-std::array<float,2>{0.72463578f, 0.484649837f},
-std::array<float,2>{0.173954427f, 0.843167484f},
-std::array<float,2>{0.799151003f, 0.59981972f},
-std::array<float,2>{0.366737157f, 0.0601711385f},
-std::array<float,2>{0.535351336f, 0.0890716761f},
-std::array<float,2>{0.0958463326f, 0.530275047f},
-std::array<float,2>{0.988429248f, 0.79120177f},
-std::array<float,2>{0.380824894f, 0.400067925f},
-std::array<float,2>{0.8746292f, 0.270405143f},
-std::array<float,2>{0.270316213f, 0.937123656f},
-std::array<float,2>{0.640461028f, 0.697533846f},
-std::array<float,2>{0.233863622f, 0.230689853f},
-std::array<float,2>{0.776785612f, 0.0235235039f},
-std::array<float,2>{0.327207327f, 0.579022527f},
-std::array<float,2>{0.700094819f, 0.865516186f},
-std::array<float,2>{0.14494741f, 0.465228468f},
-std::array<float,2>{0.600756526f, 0.343381166f},
-std::array<float,2>{0.0163661074f, 0.963616014f},
-std::array<float,2>{0.911633551f, 0.662424386f},
-std::array<float,2>{0.453369766f, 0.172881544f},
-std::array<float,2>{0.664869785f, 0.206175432f},
-std::array<float,2>{0.200427771f, 0.728705406f},
-std::array<float,2>{0.840962589f, 0.885474503f},
-std::array<float,2>{0.303814709f, 0.285515487f},
-std::array<float,2>{0.957863271f, 0.406845212f},
-std::array<float,2>{0.414390326f, 0.760217547f},
-std::array<float,2>{0.510896564f, 0.540665805f},
-std::array<float,2>{0.0822225958f, 0.0955961421f},
-std::array<float,2>{0.864579678f, 0.128317401f},
-std::array<float,2>{0.279226869f, 0.652072072f},
-std::array<float,2>{0.630444944f, 0.974628091f},
-std::array<float,2>{0.223748863f, 0.365364343f},
-std::array<float,2>{0.545333743f, 0.473564863f},
-std::array<float,2>{0.103007056f, 0.815518558f},
-std::array<float,2>{0.998208106f, 0.618217528f},
-std::array<float,2>{0.388137072f, 0.0350831337f},
-std::array<float,2>{0.727091789f, 0.06975995f},
-std::array<float,2>{0.181254283f, 0.510115266f},
-std::array<float,2>{0.805997491f, 0.797407091f},
-std::array<float,2>{0.367462009f, 0.379586488f},
-std::array<float,2>{0.900776982f, 0.250619948f},
-std::array<float,2>{0.490422964f, 0.913689375f},
-std::array<float,2>{0.57882762f, 0.710652649f},
-std::array<float,2>{0.0604491979f, 0.239060625f},
-std::array<float,2>{0.964465678f, 0.000219182737f},
-std::array<float,2>{0.407960385f, 0.565608084f},
-std::array<float,2>{0.50381881f, 0.847425699f},
-std::array<float,2>{0.0880763084f, 0.438525498f},
-std::array<float,2>{0.656981409f, 0.318526119f},
-std::array<float,2>{0.19425787f, 0.944893718f},
-std::array<float,2>{0.833237231f, 0.672019958f},
-std::array<float,2>{0.311442018f, 0.15884389f},
-std::array<float,2>{0.606120467f, 0.194195256f},
-std::array<float,2>{0.0275787376f, 0.742035985f},
-std::array<float,2>{0.916643977f, 0.892410934f},
-std::array<float,2>{0.467917144f, 0.307633579f},
-std::array<float,2>{0.77124095f, 0.427418023f},
-std::array<float,2>{0.315731674f, 0.773582041f},
-std::array<float,2>{0.687776744f, 0.55956918f},
-std::array<float,2>{0.148762077f, 0.123236097f},
-std::array<float,2>{0.928543985f, 0.227741435f},
-std::array<float,2>{0.450850785f, 0.701056182f},
-std::array<float,2>{0.611068547f, 0.931391299f},
-std::array<float,2>{0.011271528f, 0.265952379f},
-std::array<float,2>{0.705061555f, 0.403659433f},
-std::array<float,2>{0.136155501f, 0.795768857f},
-std::array<float,2>{0.759182394f, 0.524844527f},
-std::array<float,2>{0.339166939f, 0.0922080651f},
-std::array<float,2>{0.526148438f, 0.0562152639f},
-std::array<float,2>{0.0684410781f, 0.59602958f},
-std::array<float,2>{0.940990388f, 0.838752568f},
-std::array<float,2>{0.437117755f, 0.490511745f},
-std::array<float,2>{0.815945208f, 0.358263314f},
-std::array<float,2>{0.28286463f, 0.985165954f},
-std::array<float,2>{0.681995213f, 0.62570554f},
-std::array<float,2>{0.204555899f, 0.151942074f},
-std::array<float,2>{0.787106216f, 0.0976896957f},
-std::array<float,2>{0.350625217f, 0.543429434f},
-std::array<float,2>{0.747291565f, 0.765409887f},
-std::array<float,2>{0.168127671f, 0.41098395f},
-std::array<float,2>{0.569981098f, 0.283107907f},
-std::array<float,2>{0.0442954302f, 0.888004065f},
-std::array<float,2>{0.884947777f, 0.730831385f},
-std::array<float,2>{0.48273623f, 0.209229961f},
-std::array<float,2>{0.647259951f, 0.17718327f},
-std::array<float,2>{0.248764783f, 0.659831762f},
-std::array<float,2>{0.853470862f, 0.968123138f},
-std::array<float,2>{0.260679632f, 0.337236524f},
-std::array<float,2>{0.984042406f, 0.461547643f},
-std::array<float,2>{0.406133503f, 0.861555219f},
-std::array<float,2>{0.551951766f, 0.583644688f},
-std::array<float,2>{0.113862909f, 0.0311789773f},
-std::array<float,2>{0.757443249f, 0.215768144f},
-std::array<float,2>{0.33573693f, 0.721075892f},
-std::array<float,2>{0.714190722f, 0.878756344f},
-std::array<float,2>{0.125962839f, 0.290694535f},
-std::array<float,2>{0.622820437f, 0.421443403f},
-std::array<float,2>{0.00180549116f, 0.752587616f},
-std::array<float,2>{0.930679619f, 0.53249675f},
-std::array<float,2>{0.443033636f, 0.101991773f},
-std::array<float,2>{0.677010179f, 0.0204674248f},
-std::array<float,2>{0.217876673f, 0.592214108f},
-std::array<float,2>{0.827700794f, 0.872236252f},
-std::array<float,2>{0.289261073f, 0.456112832f},
-std::array<float,2>{0.948792815f, 0.328197956f},
-std::array<float,2>{0.428692579f, 0.957547665f},
-std::array<float,2>{0.516334951f, 0.665986359f},
-std::array<float,2>{0.077034764f, 0.182489753f},
-std::array<float,2>{0.875223756f, 0.0784334689f},
-std::array<float,2>{0.470650584f, 0.515954614f},
-std::array<float,2>{0.574562848f, 0.783914268f},
-std::array<float,2>{0.0339107029f, 0.394646138f},
-std::array<float,2>{0.738830149f, 0.275092334f},
-std::array<float,2>{0.1619021f, 0.92201376f},
-std::array<float,2>{0.794574261f, 0.693405509f},
-std::array<float,2>{0.352710128f, 0.220839724f},
-std::array<float,2>{0.555236816f, 0.143451259f},
-std::array<float,2>{0.117972478f, 0.634369016f},
-std::array<float,2>{0.974011183f, 0.998440325f},
-std::array<float,2>{0.396220356f, 0.350963771f},
-std::array<float,2>{0.844440639f, 0.495402962f},
-std::array<float,2>{0.256016672f, 0.831334352f},
-std::array<float,2>{0.651905894f, 0.601908386f},
-std::array<float,2>{0.234790012f, 0.0494698957f},
-std::array<float,2>{0.986232162f, 0.170127288f},
-std::array<float,2>{0.378564656f, 0.68501997f},
-std::array<float,2>{0.535004795f, 0.950386405f},
-std::array<float,2>{0.10054639f, 0.327506363f},
-std::array<float,2>{0.633984745f, 0.451811254f},
-std::array<float,2>{0.2281643f, 0.851859987f},
-std::array<float,2>{0.87077719f, 0.571442962f},
-std::array<float,2>{0.266556263f, 0.0114081409f},
-std::array<float,2>{0.589730084f, 0.113593049f},
-std::array<float,2>{0.0519061349f, 0.550179243f},
-std::array<float,2>{0.897393227f, 0.766327858f},
-std::array<float,2>{0.495150924f, 0.436933249f},
-std::array<float,2>{0.804035783f, 0.303336918f},
-std::array<float,2>{0.362045139f, 0.902884662f},
-std::array<float,2>{0.719348311f, 0.744179428f},
-std::array<float,2>{0.17595759f, 0.201605633f},
-std::array<float,2>{0.839701116f, 0.0408968218f},
-std::array<float,2>{0.299918085f, 0.614095509f},
-std::array<float,2>{0.670744121f, 0.825846374f},
-std::array<float,2>{0.196985826f, 0.478376836f},
-std::array<float,2>{0.512597322f, 0.372831553f},
-std::array<float,2>{0.0791580677f, 0.977404118f},
-std::array<float,2>{0.953237355f, 0.64154315f},
-std::array<float,2>{0.418662995f, 0.136178717f},
-std::array<float,2>{0.697979867f, 0.24798584f},
-std::array<float,2>{0.144298166f, 0.714887142f},
-std::array<float,2>{0.78116709f, 0.915128708f},
-std::array<float,2>{0.322953105f, 0.260451496f},
-std::array<float,2>{0.909335196f, 0.388313621f},
-std::array<float,2>{0.45936808f, 0.806342185f},
-std::array<float,2>{0.596258879f, 0.503034055f},
-std::array<float,2>{0.0205364153f, 0.0713851973f}}
\ No newline at end of file
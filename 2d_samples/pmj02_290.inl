@@ -1,4096 +0,0 @@
-{std::array<float,2>{0.144642547f, 0.75008899f},
-std::array<float,2>{0.562347114f, 0.347975552f},
-std::array<float,2>{0.256443322f, 0.0547718927f},
-std::array<float,2>{0.912053227f, 0.649113595f},
-std::array<float,2>{0.493609369f, 0.553341269f},
-std::array<float,2>{0.782846689f, 0.156386405f},
-std::array<float,2>{0.0887202919f, 0.458607316f},
-std::array<float,2>{0.702512443f, 0.908050895f},
-std::array<float,2>{0.0127866445f, 0.707289875f},
-std::array<float,2>{0.634728968f, 0.116244622f},
-std::array<float,2>{0.379243195f, 0.303958923f},
-std::array<float,2>{0.837642133f, 0.815069556f},
-std::array<float,2>{0.345875174f, 0.969506741f},
-std::array<float,2>{0.95690012f, 0.384771228f},
-std::array<float,2>{0.223938391f, 0.188412622f},
-std::array<float,2>{0.587000549f, 0.568202674f},
-std::array<float,2>{0.11934416f, 0.898773253f},
-std::array<float,2>{0.725254238f, 0.469170243f},
-std::array<float,2>{0.467818916f, 0.127750903f},
-std::array<float,2>{0.77000916f, 0.526297033f},
-std::array<float,2>{0.297291756f, 0.66639185f},
-std::array<float,2>{0.888668835f, 0.000543804374f},
-std::array<float,2>{0.166627288f, 0.33502993f},
-std::array<float,2>{0.516419888f, 0.810344577f},
-std::array<float,2>{0.214335188f, 0.620768547f},
-std::array<float,2>{0.614667714f, 0.218996868f},
-std::array<float,2>{0.329401135f, 0.414363354f},
-std::array<float,2>{0.990433991f, 0.966615796f},
-std::array<float,2>{0.416232437f, 0.874953389f},
-std::array<float,2>{0.846945047f, 0.271822959f},
-std::array<float,2>{0.0338301174f, 0.0930132344f},
-std::array<float,2>{0.660509646f, 0.722952962f},
-std::array<float,2>{0.0624200404f, 0.829811811f},
-std::array<float,2>{0.678141117f, 0.293301105f},
-std::array<float,2>{0.424491972f, 0.101293758f},
-std::array<float,2>{0.874009311f, 0.69636929f},
-std::array<float,2>{0.324217469f, 0.589645207f},
-std::array<float,2>{0.984158814f, 0.216981828f},
-std::array<float,2>{0.195884824f, 0.392075717f},
-std::array<float,2>{0.598135233f, 0.986227512f},
-std::array<float,2>{0.182885364f, 0.634153545f},
-std::array<float,2>{0.512134731f, 0.0382996574f},
-std::array<float,2>{0.289589107f, 0.370916694f},
-std::array<float,2>{0.892186165f, 0.776037097f},
-std::array<float,2>{0.446049362f, 0.92965132f},
-std::array<float,2>{0.750979185f, 0.44589898f},
-std::array<float,2>{0.0974477828f, 0.174999088f},
-std::array<float,2>{0.741085887f, 0.536931157f},
-std::array<float,2>{0.243200019f, 0.94778055f},
-std::array<float,2>{0.569331586f, 0.426003098f},
-std::array<float,2>{0.366052061f, 0.245334014f},
-std::array<float,2>{0.941613972f, 0.601860464f},
-std::array<float,2>{0.393971384f, 0.735028505f},
-std::array<float,2>{0.82469672f, 0.0626422688f},
-std::array<float,2>{0.0173708033f, 0.256418496f},
-std::array<float,2>{0.640793622f, 0.846903682f},
-std::array<float,2>{0.0682930648f, 0.509308279f},
-std::array<float,2>{0.705163598f, 0.143320099f},
-std::array<float,2>{0.471730769f, 0.484881967f},
-std::array<float,2>{0.800450265f, 0.882998466f},
-std::array<float,2>{0.276687145f, 0.782844603f},
-std::array<float,2>{0.925885975f, 0.313274562f},
-std::array<float,2>{0.13605231f, 0.0208754539f},
-std::array<float,2>{0.53417778f, 0.673755527f},
-std::array<float,2>{0.187727317f, 0.854957938f},
-std::array<float,2>{0.60712111f, 0.262195915f},
-std::array<float,2>{0.316524088f, 0.0732203126f},
-std::array<float,2>{0.97081852f, 0.746583879f},
-std::array<float,2>{0.436523378f, 0.597940028f},
-std::array<float,2>{0.862562418f, 0.236229077f},
-std::array<float,2>{0.0534380674f, 0.430761158f},
-std::array<float,2>{0.682366312f, 0.942164898f},
-std::array<float,2>{0.102997966f, 0.685340285f},
-std::array<float,2>{0.747252107f, 0.0284669194f},
-std::array<float,2>{0.439435333f, 0.325575501f},
-std::array<float,2>{0.763204455f, 0.792646885f},
-std::array<float,2>{0.282608211f, 0.88200593f},
-std::array<float,2>{0.904713869f, 0.496049285f},
-std::array<float,2>{0.176892713f, 0.148699328f},
-std::array<float,2>{0.50431174f, 0.506753027f},
-std::array<float,2>{0.0302624293f, 0.997868001f},
-std::array<float,2>{0.649997652f, 0.398969769f},
-std::array<float,2>{0.398736179f, 0.206176326f},
-std::array<float,2>{0.814365447f, 0.584842563f},
-std::array<float,2>{0.373228669f, 0.692161739f},
-std::array<float,2>{0.946528852f, 0.108772442f},
-std::array<float,2>{0.239668697f, 0.284224242f},
-std::array<float,2>{0.576602042f, 0.841769278f},
-std::array<float,2>{0.129519433f, 0.539356112f},
-std::array<float,2>{0.545922339f, 0.18718645f},
-std::array<float,2>{0.267144918f, 0.444255412f},
-std::array<float,2>{0.934275746f, 0.932506263f},
-std::array<float,2>{0.477265716f, 0.765806556f},
-std::array<float,2>{0.811319888f, 0.366372645f},
-std::array<float,2>{0.0776007846f, 0.0438949615f},
-std::array<float,2>{0.714779258f, 0.6325562f},
-std::array<float,2>{0.0814497769f, 0.801512122f},
-std::array<float,2>{0.693041742f, 0.339424133f},
-std::array<float,2>{0.490184903f, 0.00999883469f},
-std::array<float,2>{0.79301995f, 0.661972821f},
-std::array<float,2>{0.265140563f, 0.520741701f},
-std::array<float,2>{0.919100821f, 0.139339492f},
-std::array<float,2>{0.152052432f, 0.476644069f},
-std::array<float,2>{0.550074875f, 0.89730221f},
-std::array<float,2>{0.230087653f, 0.72759366f},
-std::array<float,2>{0.582351029f, 0.0812695101f},
-std::array<float,2>{0.352083415f, 0.280830085f},
-std::array<float,2>{0.967832386f, 0.865795076f},
-std::array<float,2>{0.389035463f, 0.95871532f},
-std::array<float,2>{0.831621289f, 0.409862816f},
-std::array<float,2>{0.000699032797f, 0.228361651f},
-std::array<float,2>{0.628186405f, 0.613796532f},
-std::array<float,2>{0.16206117f, 0.916938245f},
-std::array<float,2>{0.525868475f, 0.465942144f},
-std::array<float,2>{0.307463616f, 0.168283343f},
-std::array<float,2>{0.878513694f, 0.558296502f},
-std::array<float,2>{0.460574061f, 0.645760238f},
-std::array<float,2>{0.777711868f, 0.0508523621f},
-std::array<float,2>{0.109825365f, 0.352315545f},
-std::array<float,2>{0.728221595f, 0.76252985f},
-std::array<float,2>{0.0432249419f, 0.576174438f},
-std::array<float,2>{0.66778326f, 0.202289522f},
-std::array<float,2>{0.408520222f, 0.377531439f},
-std::array<float,2>{0.853980362f, 0.97827065f},
-std::array<float,2>{0.341207534f, 0.821258843f},
-std::array<float,2>{0.992575586f, 0.306204349f},
-std::array<float,2>{0.204949349f, 0.122931056f},
-std::array<float,2>{0.619049549f, 0.716715217f},
-std::array<float,2>{0.173366889f, 0.817882061f},
-std::array<float,2>{0.500821233f, 0.298954487f},
-std::array<float,2>{0.288528949f, 0.110397585f},
-std::array<float,2>{0.899281144f, 0.704987586f},
-std::array<float,2>{0.444984704f, 0.563840151f},
-std::array<float,2>{0.761564612f, 0.194950134f},
-std::array<float,2>{0.106247753f, 0.38774997f},
-std::array<float,2>{0.744886518f, 0.976476967f},
-std::array<float,2>{0.0473839715f, 0.653511524f},
-std::array<float,2>{0.684834063f, 0.0614021756f},
-std::array<float,2>{0.432648033f, 0.345983118f},
-std::array<float,2>{0.866307616f, 0.756410539f},
-std::array<float,2>{0.312628478f, 0.911242962f},
-std::array<float,2>{0.974871993f, 0.454204798f},
-std::array<float,2>{0.195099428f, 0.160745859f},
-std::array<float,2>{0.603357077f, 0.550554097f},
-std::array<float,2>{0.071256645f, 0.963015258f},
-std::array<float,2>{0.718578041f, 0.421029925f},
-std::array<float,2>{0.480647683f, 0.223336935f},
-std::array<float,2>{0.806883752f, 0.621772289f},
-std::array<float,2>{0.270149946f, 0.720990419f},
-std::array<float,2>{0.931109607f, 0.0868825167f},
-std::array<float,2>{0.128864929f, 0.265631944f},
-std::array<float,2>{0.542341471f, 0.869358659f},
-std::array<float,2>{0.236431643f, 0.528163075f},
-std::array<float,2>{0.570321083f, 0.129876286f},
-std::array<float,2>{0.369823217f, 0.474401981f},
-std::array<float,2>{0.952800214f, 0.902518511f},
-std::array<float,2>{0.403087705f, 0.807302594f},
-std::array<float,2>{0.819140196f, 0.328221947f},
-std::array<float,2>{0.0240765661f, 0.00708586723f},
-std::array<float,2>{0.655873895f, 0.670143783f},
-std::array<float,2>{0.00670407992f, 0.780458093f},
-std::array<float,2>{0.631237447f, 0.374897718f},
-std::array<float,2>{0.386576533f, 0.034536574f},
-std::array<float,2>{0.832221448f, 0.636831284f},
-std::array<float,2>{0.357296169f, 0.532767415f},
-std::array<float,2>{0.964174688f, 0.177924305f},
-std::array<float,2>{0.230821878f, 0.452918917f},
-std::array<float,2>{0.58040303f, 0.925525129f},
-std::array<float,2>{0.152754128f, 0.699370265f},
-std::array<float,2>{0.551442802f, 0.0966162607f},
-std::array<float,2>{0.257985175f, 0.291270316f},
-std::array<float,2>{0.917818367f, 0.832915068f},
-std::array<float,2>{0.487565845f, 0.989070237f},
-std::array<float,2>{0.790471494f, 0.394965917f},
-std::array<float,2>{0.0850293189f, 0.214155421f},
-std::array<float,2>{0.690454304f, 0.591385424f},
-std::array<float,2>{0.209299132f, 0.88699764f},
-std::array<float,2>{0.62307328f, 0.489572525f},
-std::array<float,2>{0.33897844f, 0.144900352f},
-std::array<float,2>{0.998456538f, 0.515215397f},
-std::array<float,2>{0.411724716f, 0.678677976f},
-std::array<float,2>{0.858916998f, 0.0171320606f},
-std::array<float,2>{0.0415231325f, 0.317643583f},
-std::array<float,2>{0.671519041f, 0.786384463f},
-std::array<float,2>{0.116075799f, 0.608065665f},
-std::array<float,2>{0.732450426f, 0.246685013f},
-std::array<float,2>{0.456505448f, 0.424991995f},
-std::array<float,2>{0.774307728f, 0.952820361f},
-std::array<float,2>{0.309576333f, 0.848852277f},
-std::array<float,2>{0.882659495f, 0.253561705f},
-std::array<float,2>{0.156769276f, 0.0683901906f},
-std::array<float,2>{0.527636051f, 0.738457978f},
-std::array<float,2>{0.21957761f, 0.796647727f},
-std::array<float,2>{0.593069315f, 0.322191775f},
-std::array<float,2>{0.351283014f, 0.0262728967f},
-std::array<float,2>{0.957356751f, 0.682785809f},
-std::array<float,2>{0.375845194f, 0.501310229f},
-std::array<float,2>{0.841768205f, 0.156040743f},
-std::array<float,2>{0.00920079276f, 0.497049034f},
-std::array<float,2>{0.639168084f, 0.87594682f},
-std::array<float,2>{0.0926395133f, 0.743634284f},
-std::array<float,2>{0.697803319f, 0.0757554024f},
-std::array<float,2>{0.49743858f, 0.25957787f},
-std::array<float,2>{0.788692713f, 0.858591914f},
-std::array<float,2>{0.253226906f, 0.940599263f},
-std::array<float,2>{0.90835762f, 0.434167236f},
-std::array<float,2>{0.143192455f, 0.242064014f},
-std::array<float,2>{0.557813883f, 0.593846083f},
-std::array<float,2>{0.0380756222f, 0.933650613f},
-std::array<float,2>{0.657458305f, 0.438767225f},
-std::array<float,2>{0.42031756f, 0.182097241f},
-std::array<float,2>{0.849072337f, 0.545630038f},
-std::array<float,2>{0.334548086f, 0.627369344f},
-std::array<float,2>{0.98593992f, 0.0395047031f},
-std::array<float,2>{0.21503675f, 0.360538453f},
-std::array<float,2>{0.609959602f, 0.772208393f},
-std::array<float,2>{0.17046985f, 0.578136981f},
-std::array<float,2>{0.520429134f, 0.20760113f},
-std::array<float,2>{0.301674098f, 0.404949903f},
-std::array<float,2>{0.886119843f, 0.994412422f},
-std::array<float,2>{0.461930931f, 0.836419463f},
-std::array<float,2>{0.767353594f, 0.288162321f},
-std::array<float,2>{0.121580146f, 0.102120653f},
-std::array<float,2>{0.72078383f, 0.690394938f},
-std::array<float,2>{0.0986026749f, 0.859384775f},
-std::array<float,2>{0.736112595f, 0.274842262f},
-std::array<float,2>{0.44952631f, 0.082939975f},
-std::array<float,2>{0.753960252f, 0.732144892f},
-std::array<float,2>{0.293146044f, 0.613259077f},
-std::array<float,2>{0.898346424f, 0.231658936f},
-std::array<float,2>{0.18401736f, 0.412189484f},
-std::array<float,2>{0.511714756f, 0.956970155f},
-std::array<float,2>{0.201040506f, 0.658915043f},
-std::array<float,2>{0.595243871f, 0.0124856327f},
-std::array<float,2>{0.325114429f, 0.341654658f},
-std::array<float,2>{0.978937209f, 0.798315227f},
-std::array<float,2>{0.427174091f, 0.893705487f},
-std::array<float,2>{0.869368374f, 0.4817608f},
-std::array<float,2>{0.0555605441f, 0.134090483f},
-std::array<float,2>{0.674341619f, 0.517020047f},
-std::array<float,2>{0.136887565f, 0.981678009f},
-std::array<float,2>{0.537557602f, 0.382272154f},
-std::array<float,2>{0.278238267f, 0.195841804f},
-std::array<float,2>{0.922368884f, 0.570871472f},
-std::array<float,2>{0.475672305f, 0.714709878f},
-std::array<float,2>{0.803149104f, 0.117391899f},
-std::array<float,2>{0.0634083301f, 0.3108823f},
-std::array<float,2>{0.707856119f, 0.824433506f},
-std::array<float,2>{0.0223487914f, 0.562279701f},
-std::array<float,2>{0.646705627f, 0.164839074f},
-std::array<float,2>{0.39645952f, 0.464439452f},
-std::array<float,2>{0.821963966f, 0.921107888f},
-std::array<float,2>{0.361804128f, 0.757844567f},
-std::array<float,2>{0.937758505f, 0.357719988f},
-std::array<float,2>{0.247298837f, 0.0504262261f},
-std::array<float,2>{0.562526166f, 0.644488037f},
-std::array<float,2>{0.164620161f, 0.810795605f},
-std::array<float,2>{0.518619657f, 0.332908899f},
-std::array<float,2>{0.300425917f, 0.00227433187f},
-std::array<float,2>{0.889604092f, 0.664756358f},
-std::array<float,2>{0.466536939f, 0.524529994f},
-std::array<float,2>{0.773110747f, 0.126467451f},
-std::array<float,2>{0.117326312f, 0.472080231f},
-std::array<float,2>{0.723490238f, 0.901296675f},
-std::array<float,2>{0.0315460488f, 0.726133645f},
-std::array<float,2>{0.662411213f, 0.0908340663f},
-std::array<float,2>{0.415194541f, 0.271125615f},
-std::array<float,2>{0.84382242f, 0.87114352f},
-std::array<float,2>{0.331836313f, 0.9677158f},
-std::array<float,2>{0.989455104f, 0.417318881f},
-std::array<float,2>{0.212748289f, 0.221178085f},
-std::array<float,2>{0.616004884f, 0.61755079f},
-std::array<float,2>{0.0868229046f, 0.908462882f},
-std::array<float,2>{0.70014888f, 0.460132927f},
-std::array<float,2>{0.495324671f, 0.158209622f},
-std::array<float,2>{0.784835637f, 0.552405834f},
-std::array<float,2>{0.254156679f, 0.650990427f},
-std::array<float,2>{0.912774384f, 0.0579761714f},
-std::array<float,2>{0.147892937f, 0.350258082f},
-std::array<float,2>{0.559552252f, 0.753530562f},
-std::array<float,2>{0.226284981f, 0.569038749f},
-std::array<float,2>{0.589097261f, 0.191155598f},
-std::array<float,2>{0.344492406f, 0.384231001f},
-std::array<float,2>{0.955019951f, 0.971557975f},
-std::array<float,2>{0.381505072f, 0.81334275f},
-std::array<float,2>{0.839221716f, 0.30191496f},
-std::array<float,2>{0.0148320477f, 0.113654487f},
-std::array<float,2>{0.634964168f, 0.7106511f},
-std::array<float,2>{0.0177760925f, 0.844929755f},
-std::array<float,2>{0.643900633f, 0.255432159f},
-std::array<float,2>{0.392514288f, 0.065527603f},
-std::array<float,2>{0.82660228f, 0.737347662f},
-std::array<float,2>{0.363408536f, 0.604768455f},
-std::array<float,2>{0.943421543f, 0.24396269f},
-std::array<float,2>{0.244641811f, 0.428890646f},
-std::array<float,2>{0.567327082f, 0.94582051f},
-std::array<float,2>{0.134635881f, 0.674963593f},
-std::array<float,2>{0.533150256f, 0.021687245f},
-std::array<float,2>{0.273931712f, 0.315995872f},
-std::array<float,2>{0.928618252f, 0.784274101f},
-std::array<float,2>{0.469027102f, 0.884800017f},
-std::array<float,2>{0.798500657f, 0.48783353f},
-std::array<float,2>{0.0700469986f, 0.14092049f},
-std::array<float,2>{0.705053627f, 0.509767115f},
-std::array<float,2>{0.198696554f, 0.987397909f},
-std::array<float,2>{0.600256383f, 0.393847644f},
-std::array<float,2>{0.321724653f, 0.21634908f},
-std::array<float,2>{0.982187629f, 0.586238325f},
-std::array<float,2>{0.422591597f, 0.698726594f},
-std::array<float,2>{0.871985495f, 0.098511681f},
-std::array<float,2>{0.0599376559f, 0.296301305f},
-std::array<float,2>{0.675894499f, 0.830225945f},
-std::array<float,2>{0.0949973613f, 0.537675798f},
-std::array<float,2>{0.73886323f, 0.173637167f},
-std::array<float,2>{0.4475725f, 0.44901365f},
-std::array<float,2>{0.753613591f, 0.926666439f},
-std::array<float,2>{0.291587114f, 0.774864376f},
-std::array<float,2>{0.893407762f, 0.367798299f},
-std::array<float,2>{0.17998223f, 0.0369450599f},
-std::array<float,2>{0.513870239f, 0.634905696f},
-std::array<float,2>{0.240303099f, 0.842020214f},
-std::array<float,2>{0.575001478f, 0.281975597f},
-std::array<float,2>{0.372280329f, 0.107076116f},
-std::array<float,2>{0.948183477f, 0.693516672f},
-std::array<float,2>{0.400618315f, 0.582657039f},
-std::array<float,2>{0.815788209f, 0.205065653f},
-std::array<float,2>{0.0292290784f, 0.401085794f},
-std::array<float,2>{0.651921093f, 0.999239445f},
-std::array<float,2>{0.0742811114f, 0.62914902f},
-std::array<float,2>{0.712003112f, 0.0454641469f},
-std::array<float,2>{0.479144275f, 0.363610983f},
-std::array<float,2>{0.810147941f, 0.767860353f},
-std::array<float,2>{0.267835617f, 0.93149972f},
-std::array<float,2>{0.936490595f, 0.442981631f},
-std::array<float,2>{0.132747591f, 0.185412049f},
-std::array<float,2>{0.544040501f, 0.542074621f},
-std::array<float,2>{0.051817406f, 0.944904029f},
-std::array<float,2>{0.680785f, 0.43277204f},
-std::array<float,2>{0.434830248f, 0.236528233f},
-std::array<float,2>{0.860310018f, 0.600832283f},
-std::array<float,2>{0.319772631f, 0.749151051f},
-std::array<float,2>{0.969052732f, 0.0719698295f},
-std::array<float,2>{0.190900132f, 0.263988644f},
-std::array<float,2>{0.60923779f, 0.852530718f},
-std::array<float,2>{0.178643346f, 0.504891336f},
-std::array<float,2>{0.506426632f, 0.150568217f},
-std::array<float,2>{0.285084933f, 0.493642747f},
-std::array<float,2>{0.902542591f, 0.880724847f},
-std::array<float,2>{0.43959865f, 0.789402843f},
-std::array<float,2>{0.76387161f, 0.327468872f},
-std::array<float,2>{0.103645533f, 0.0311251599f},
-std::array<float,2>{0.749626338f, 0.686697781f},
-std::array<float,2>{0.112793721f, 0.765218735f},
-std::array<float,2>{0.728774905f, 0.35494405f},
-std::array<float,2>{0.457468003f, 0.0536328889f},
-std::array<float,2>{0.780771017f, 0.647631288f},
-std::array<float,2>{0.305571318f, 0.556372523f},
-std::array<float,2>{0.876824677f, 0.169990569f},
-std::array<float,2>{0.163254485f, 0.467861831f},
-std::array<float,2>{0.524739504f, 0.914297938f},
-std::array<float,2>{0.205971882f, 0.718719721f},
-std::array<float,2>{0.619191587f, 0.12398918f},
-std::array<float,2>{0.342379957f, 0.306863159f},
-std::array<float,2>{0.994647443f, 0.823821664f},
-std::array<float,2>{0.407578111f, 0.978703618f},
-std::array<float,2>{0.852183044f, 0.376591563f},
-std::array<float,2>{0.0453088395f, 0.200732335f},
-std::array<float,2>{0.664866567f, 0.576116085f},
-std::array<float,2>{0.150363296f, 0.895317793f},
-std::array<float,2>{0.548396587f, 0.478596807f},
-std::array<float,2>{0.262259871f, 0.137076661f},
-std::array<float,2>{0.921158075f, 0.523106277f},
-std::array<float,2>{0.49078244f, 0.663455248f},
-std::array<float,2>{0.795103192f, 0.00899918564f},
-std::array<float,2>{0.0782684088f, 0.337414145f},
-std::array<float,2>{0.694156289f, 0.803041041f},
-std::array<float,2>{0.00349716842f, 0.616169393f},
-std::array<float,2>{0.626774669f, 0.229531899f},
-std::array<float,2>{0.387434959f, 0.407863081f},
-std::array<float,2>{0.828833938f, 0.960284173f},
-std::array<float,2>{0.353841662f, 0.863309622f},
-std::array<float,2>{0.966031432f, 0.277507305f},
-std::array<float,2>{0.227354214f, 0.0790481344f},
-std::array<float,2>{0.58504349f, 0.72991699f},
-std::array<float,2>{0.126108527f, 0.867970705f},
-std::array<float,2>{0.54012382f, 0.269493401f},
-std::array<float,2>{0.272171617f, 0.0888470039f},
-std::array<float,2>{0.932499826f, 0.719849944f},
-std::array<float,2>{0.482678294f, 0.624488413f},
-std::array<float,2>{0.805608749f, 0.226229846f},
-std::array<float,2>{0.0727905855f, 0.41823107f},
-std::array<float,2>{0.71527487f, 0.961002707f},
-std::array<float,2>{0.025970282f, 0.668723762f},
-std::array<float,2>{0.653470337f, 0.0049444926f},
-std::array<float,2>{0.404554307f, 0.330369413f},
-std::array<float,2>{0.817595184f, 0.805918157f},
-std::array<float,2>{0.367209107f, 0.904755652f},
-std::array<float,2>{0.949242473f, 0.476391643f},
-std::array<float,2>{0.234927118f, 0.131261855f},
-std::array<float,2>{0.573767006f, 0.529921889f},
-std::array<float,2>{0.107871167f, 0.973608673f},
-std::array<float,2>{0.742293954f, 0.39045471f},
-std::array<float,2>{0.441752195f, 0.191760689f},
-std::array<float,2>{0.759078324f, 0.564816535f},
-std::array<float,2>{0.286925465f, 0.705977976f},
-std::array<float,2>{0.901654541f, 0.112892896f},
-std::array<float,2>{0.174899966f, 0.297917962f},
-std::array<float,2>{0.5026595f, 0.820024729f},
-std::array<float,2>{0.192052186f, 0.548484683f},
-std::array<float,2>{0.60436368f, 0.162293375f},
-std::array<float,2>{0.315866977f, 0.455572993f},
-std::array<float,2>{0.973704934f, 0.913331926f},
-std::array<float,2>{0.430357128f, 0.754862905f},
-std::array<float,2>{0.864588916f, 0.344646007f},
-std::array<float,2>{0.0492088608f, 0.0591418967f},
-std::array<float,2>{0.685866594f, 0.655328214f},
-std::array<float,2>{0.0402069353f, 0.788960576f},
-std::array<float,2>{0.66985786f, 0.320083708f},
-std::array<float,2>{0.413433313f, 0.0190307349f},
-std::array<float,2>{0.857308269f, 0.677328944f},
-std::array<float,2>{0.336506754f, 0.513348579f},
-std::array<float,2>{0.996162117f, 0.148405194f},
-std::array<float,2>{0.208238244f, 0.491016835f},
-std::array<float,2>{0.621366203f, 0.889291763f},
-std::array<float,2>{0.158625752f, 0.741012156f},
-std::array<float,2>{0.529840648f, 0.0681669489f},
-std::array<float,2>{0.311638921f, 0.250702977f},
-std::array<float,2>{0.880850732f, 0.850640535f},
-std::array<float,2>{0.453526914f, 0.950842083f},
-std::array<float,2>{0.776731849f, 0.42304337f},
-std::array<float,2>{0.114249878f, 0.249164835f},
-std::array<float,2>{0.731886148f, 0.606088877f},
-std::array<float,2>{0.232967868f, 0.921902776f},
-std::array<float,2>{0.579107106f, 0.449448556f},
-std::array<float,2>{0.357434392f, 0.176883921f},
-std::array<float,2>{0.962887466f, 0.533270121f},
-std::array<float,2>{0.383197725f, 0.640055418f},
-std::array<float,2>{0.835386693f, 0.0326586589f},
-std::array<float,2>{0.0054796231f, 0.371176302f},
-std::array<float,2>{0.629598022f, 0.779081523f},
-std::array<float,2>{0.082152769f, 0.591950238f},
-std::array<float,2>{0.689218581f, 0.212272689f},
-std::array<float,2>{0.485472739f, 0.396799535f},
-std::array<float,2>{0.791134477f, 0.991921902f},
-std::array<float,2>{0.260011733f, 0.835768282f},
-std::array<float,2>{0.914545417f, 0.290257633f},
-std::array<float,2>{0.156131536f, 0.0948051438f},
-std::array<float,2>{0.554491341f, 0.701180696f},
-std::array<float,2>{0.218743235f, 0.770584166f},
-std::array<float,2>{0.612808645f, 0.36282444f},
-std::array<float,2>{0.332969189f, 0.0410926603f},
-std::array<float,2>{0.987173617f, 0.626707554f},
-std::array<float,2>{0.418573737f, 0.544219315f},
-std::array<float,2>{0.849728465f, 0.181011066f},
-std::array<float,2>{0.0361020267f, 0.439624369f},
-std::array<float,2>{0.65952307f, 0.937068999f},
-std::array<float,2>{0.123739965f, 0.688374043f},
-std::array<float,2>{0.718978226f, 0.104848742f},
-std::array<float,2>{0.463407516f, 0.285893351f},
-std::array<float,2>{0.76926434f, 0.838398993f},
-std::array<float,2>{0.303411871f, 0.992224276f},
-std::array<float,2>{0.884528697f, 0.402347505f},
-std::array<float,2>{0.169254616f, 0.209938154f},
-std::array<float,2>{0.521743059f, 0.581933975f},
-std::array<float,2>{0.0103223072f, 0.877646565f},
-std::array<float,2>{0.638055384f, 0.499514639f},
-std::array<float,2>{0.378274709f, 0.154253572f},
-std::array<float,2>{0.842087328f, 0.502276361f},
-std::array<float,2>{0.349566907f, 0.680398226f},
-std::array<float,2>{0.960277021f, 0.025354363f},
-std::array<float,2>{0.22111015f, 0.323938102f},
-std::array<float,2>{0.590948939f, 0.793231547f},
-std::array<float,2>{0.140801042f, 0.596689761f},
-std::array<float,2>{0.554698646f, 0.239041284f},
-std::array<float,2>{0.25055325f, 0.437324524f},
-std::array<float,2>{0.906920969f, 0.939312994f},
-std::array<float,2>{0.498741269f, 0.856887221f},
-std::array<float,2>{0.786850274f, 0.261432946f},
-std::array<float,2>{0.0899453908f, 0.0765590146f},
-std::array<float,2>{0.696318865f, 0.74469012f},
-std::array<float,2>{0.0658487529f, 0.826272011f},
-std::array<float,2>{0.710674763f, 0.309390664f},
-std::array<float,2>{0.472770542f, 0.120659761f},
-std::array<float,2>{0.801599562f, 0.711633027f},
-std::array<float,2>{0.28035748f, 0.574215591f},
-std::array<float,2>{0.924650609f, 0.198120192f},
-std::array<float,2>{0.138782561f, 0.380661756f},
-std::array<float,2>{0.536567986f, 0.983303368f},
-std::array<float,2>{0.249225289f, 0.641997933f},
-std::array<float,2>{0.565998435f, 0.0478662923f},
-std::array<float,2>{0.360384852f, 0.356390089f},
-std::array<float,2>{0.940421879f, 0.760588706f},
-std::array<float,2>{0.398212582f, 0.918221116f},
-std::array<float,2>{0.822582185f, 0.462660074f},
-std::array<float,2>{0.0214373525f, 0.166218072f},
-std::array<float,2>{0.645667255f, 0.559071898f},
-std::array<float,2>{0.185806885f, 0.953472495f},
-std::array<float,2>{0.508334279f, 0.410447478f},
-std::array<float,2>{0.295013636f, 0.233287573f},
-std::array<float,2>{0.895715594f, 0.609775722f},
-std::array<float,2>{0.452110767f, 0.733156443f},
-std::array<float,2>{0.756281614f, 0.0855652168f},
-std::array<float,2>{0.101295315f, 0.277005315f},
-std::array<float,2>{0.736957312f, 0.862097681f},
-std::array<float,2>{0.057061661f, 0.51842171f},
-std::array<float,2>{0.673357666f, 0.136465088f},
-std::array<float,2>{0.4285326f, 0.48296389f},
-std::array<float,2>{0.867597997f, 0.89254564f},
-std::array<float,2>{0.327508718f, 0.799785435f},
-std::array<float,2>{0.976945698f, 0.343102545f},
-std::array<float,2>{0.202168524f, 0.0145848645f},
-std::array<float,2>{0.597322524f, 0.657885194f},
-std::array<float,2>{0.135573581f, 0.783557236f},
-std::array<float,2>{0.53422308f, 0.314697146f},
-std::array<float,2>{0.275426507f, 0.0228041355f},
-std::array<float,2>{0.927226484f, 0.674179435f},
-std::array<float,2>{0.471128851f, 0.510779798f},
-std::array<float,2>{0.799774826f, 0.141747028f},
-std::array<float,2>{0.0667890757f, 0.486749947f},
-std::array<float,2>{0.706205845f, 0.885771215f},
-std::array<float,2>{0.016201267f, 0.736442208f},
-std::array<float,2>{0.642116487f, 0.065401271f},
-std::array<float,2>{0.392584682f, 0.254594982f},
-std::array<float,2>{0.825199723f, 0.844655097f},
-std::array<float,2>{0.366462022f, 0.946407497f},
-std::array<float,2>{0.942708135f, 0.427875519f},
-std::array<float,2>{0.242392868f, 0.243047118f},
-std::array<float,2>{0.569355011f, 0.604109645f},
-std::array<float,2>{0.0959137678f, 0.926939845f},
-std::array<float,2>{0.741872966f, 0.447677374f},
-std::array<float,2>{0.446395159f, 0.171979547f},
-std::array<float,2>{0.750200689f, 0.539006293f},
-std::array<float,2>{0.290899932f, 0.636226237f},
-std::array<float,2>{0.890760303f, 0.0361007638f},
-std::array<float,2>{0.182302326f, 0.368943423f},
-std::array<float,2>{0.513321698f, 0.773589492f},
-std::array<float,2>{0.197132185f, 0.58750385f},
-std::array<float,2>{0.599318802f, 0.215715587f},
-std::array<float,2>{0.32249251f, 0.392825007f},
-std::array<float,2>{0.982860148f, 0.986673474f},
-std::array<float,2>{0.425544798f, 0.831658244f},
-std::array<float,2>{0.874606371f, 0.295633346f},
-std::array<float,2>{0.0610215589f, 0.0988498777f},
-std::array<float,2>{0.679165304f, 0.697776675f},
-std::array<float,2>{0.0347001888f, 0.872298121f},
-std::array<float,2>{0.661893845f, 0.270455688f},
-std::array<float,2>{0.417862773f, 0.0908122733f},
-std::array<float,2>{0.846502125f, 0.724735796f},
-std::array<float,2>{0.328334153f, 0.61911726f},
-std::array<float,2>{0.991767406f, 0.221754417f},
-std::array<float,2>{0.213695243f, 0.416479856f},
-std::array<float,2>{0.613482714f, 0.968665302f},
-std::array<float,2>{0.167317852f, 0.666015029f},
-std::array<float,2>{0.516881108f, 0.00389620382f},
-std::array<float,2>{0.297867686f, 0.333682239f},
-std::array<float,2>{0.886825919f, 0.812066674f},
-std::array<float,2>{0.466962039f, 0.901618719f},
-std::array<float,2>{0.770775974f, 0.471232295f},
-std::array<float,2>{0.120128058f, 0.125139013f},
-std::array<float,2>{0.725665629f, 0.523860812f},
-std::array<float,2>{0.222982571f, 0.972602904f},
-std::array<float,2>{0.586274922f, 0.38319242f},
-std::array<float,2>{0.34713918f, 0.189639255f},
-std::array<float,2>{0.955688775f, 0.569432437f},
-std::array<float,2>{0.380794138f, 0.709246576f},
-std::array<float,2>{0.836716294f, 0.114918113f},
-std::array<float,2>{0.0119794272f, 0.301729441f},
-std::array<float,2>{0.633342326f, 0.813775599f},
-std::array<float,2>{0.0890354738f, 0.551494718f},
-std::array<float,2>{0.701714456f, 0.159767047f},
-std::array<float,2>{0.492897063f, 0.459516227f},
-std::array<float,2>{0.781552851f, 0.910020828f},
-std::array<float,2>{0.257285625f, 0.752583385f},
-std::array<float,2>{0.910816669f, 0.35127905f},
-std::array<float,2>{0.145788893f, 0.0569632165f},
-std::array<float,2>{0.561066568f, 0.651727498f},
-std::array<float,2>{0.203644797f, 0.822891831f},
-std::array<float,2>{0.617604077f, 0.308327705f},
-std::array<float,2>{0.340418875f, 0.124242246f},
-std::array<float,2>{0.993201733f, 0.716831565f},
-std::array<float,2>{0.409772485f, 0.574827969f},
-std::array<float,2>{0.854726851f, 0.19974637f},
-std::array<float,2>{0.0448213629f, 0.375169545f},
-std::array<float,2>{0.666793227f, 0.980129361f},
-std::array<float,2>{0.110652894f, 0.646487474f},
-std::array<float,2>{0.727212429f, 0.0542788096f},
-std::array<float,2>{0.459299803f, 0.354000568f},
-std::array<float,2>{0.779242337f, 0.764381766f},
-std::array<float,2>{0.307697296f, 0.915710032f},
-std::array<float,2>{0.87725389f, 0.466825962f},
-std::array<float,2>{0.160655975f, 0.171761528f},
-std::array<float,2>{0.526925147f, 0.555354059f},
-std::array<float,2>{0.00105334655f, 0.959910095f},
-std::array<float,2>{0.627250433f, 0.406341493f},
-std::array<float,2>{0.390555173f, 0.229259223f},
-std::array<float,2>{0.830997944f, 0.616741121f},
-std::array<float,2>{0.35285756f, 0.729292572f},
-std::array<float,2>{0.966897368f, 0.0799004287f},
-std::array<float,2>{0.229117334f, 0.27853474f},
-std::array<float,2>{0.583372593f, 0.864574492f},
-std::array<float,2>{0.15103744f, 0.521670759f},
-std::array<float,2>{0.548957825f, 0.137811854f},
-std::array<float,2>{0.263946384f, 0.480366349f},
-std::array<float,2>{0.918069065f, 0.8961519f},
-std::array<float,2>{0.488946438f, 0.80452925f},
-std::array<float,2>{0.794875085f, 0.336664826f},
-std::array<float,2>{0.0805723518f, 0.00828049611f},
-std::array<float,2>{0.69177568f, 0.662251055f},
-std::array<float,2>{0.0765821412f, 0.768897235f},
-std::array<float,2>{0.713707983f, 0.364692718f},
-std::array<float,2>{0.477818578f, 0.0459579453f},
-std::array<float,2>{0.812390208f, 0.630337894f},
-std::array<float,2>{0.266170651f, 0.541885316f},
-std::array<float,2>{0.935264409f, 0.18420361f},
-std::array<float,2>{0.129960135f, 0.442293733f},
-std::array<float,2>{0.545356095f, 0.929770947f},
-std::array<float,2>{0.238399789f, 0.695162773f},
-std::array<float,2>{0.577495277f, 0.105963215f},
-std::array<float,2>{0.374438077f, 0.282413334f},
-std::array<float,2>{0.945639968f, 0.843063831f},
-std::array<float,2>{0.400356829f, 0.998751163f},
-std::array<float,2>{0.813206434f, 0.401870042f},
-std::array<float,2>{0.0310166478f, 0.203454778f},
-std::array<float,2>{0.648691177f, 0.583943784f},
-std::array<float,2>{0.176440299f, 0.879539669f},
-std::array<float,2>{0.505801141f, 0.49239552f},
-std::array<float,2>{0.281382412f, 0.15177545f},
-std::array<float,2>{0.905417979f, 0.504334092f},
-std::array<float,2>{0.438311607f, 0.685741067f},
-std::array<float,2>{0.761770725f, 0.0294327457f},
-std::array<float,2>{0.102142684f, 0.326267302f},
-std::array<float,2>{0.746281862f, 0.790813446f},
-std::array<float,2>{0.0544914789f, 0.600282788f},
-std::array<float,2>{0.683059335f, 0.237666488f},
-std::array<float,2>{0.436682582f, 0.432596505f},
-std::array<float,2>{0.861973405f, 0.9438079f},
-std::array<float,2>{0.317880094f, 0.853440344f},
-std::array<float,2>{0.97249186f, 0.264961153f},
-std::array<float,2>{0.188839778f, 0.0711295754f},
-std::array<float,2>{0.605653822f, 0.748075128f},
-std::array<float,2>{0.157745689f, 0.850423396f},
-std::array<float,2>{0.528544843f, 0.251859188f},
-std::array<float,2>{0.309127033f, 0.0667040795f},
-std::array<float,2>{0.881452382f, 0.741581321f},
-std::array<float,2>{0.456004381f, 0.606742203f},
-std::array<float,2>{0.775262356f, 0.24811089f},
-std::array<float,2>{0.116466895f, 0.422636598f},
-std::array<float,2>{0.734284639f, 0.949508846f},
-std::array<float,2>{0.0423483364f, 0.676520884f},
-std::array<float,2>{0.670648932f, 0.0177203752f},
-std::array<float,2>{0.410428554f, 0.318436921f},
-std::array<float,2>{0.858146846f, 0.787234306f},
-std::array<float,2>{0.33886376f, 0.890556335f},
-std::array<float,2>{0.999236405f, 0.491366774f},
-std::array<float,2>{0.210067391f, 0.146825612f},
-std::array<float,2>{0.624564826f, 0.512448549f},
-std::array<float,2>{0.0843085125f, 0.990314126f},
-std::array<float,2>{0.689774513f, 0.397856623f},
-std::array<float,2>{0.486472458f, 0.211107969f},
-std::array<float,2>{0.789746761f, 0.593296409f},
-std::array<float,2>{0.259024888f, 0.70245266f},
-std::array<float,2>{0.916680455f, 0.0939869955f},
-std::array<float,2>{0.154291317f, 0.289462328f},
-std::array<float,2>{0.552078187f, 0.834096432f},
-std::array<float,2>{0.232254356f, 0.534493864f},
-std::array<float,2>{0.581583619f, 0.176551685f},
-std::array<float,2>{0.356347501f, 0.450310916f},
-std::array<float,2>{0.963854849f, 0.923333228f},
-std::array<float,2>{0.385344416f, 0.777422071f},
-std::array<float,2>{0.833313525f, 0.37288028f},
-std::array<float,2>{0.00752790831f, 0.0320350938f},
-std::array<float,2>{0.631923735f, 0.639409661f},
-std::array<float,2>{0.024639789f, 0.805369437f},
-std::array<float,2>{0.654751778f, 0.331244677f},
-std::array<float,2>{0.40407759f, 0.00462280028f},
-std::array<float,2>{0.81962043f, 0.669111431f},
-std::array<float,2>{0.370664656f, 0.53108865f},
-std::array<float,2>{0.95175761f, 0.131892458f},
-std::array<float,2>{0.237938136f, 0.475063056f},
-std::array<float,2>{0.571615458f, 0.905753314f},
-std::array<float,2>{0.127553493f, 0.719162285f},
-std::array<float,2>{0.541757643f, 0.0896620452f},
-std::array<float,2>{0.270606309f, 0.268231511f},
-std::array<float,2>{0.930144191f, 0.868173361f},
-std::array<float,2>{0.482282043f, 0.962686777f},
-std::array<float,2>{0.807831466f, 0.419609487f},
-std::array<float,2>{0.0713551566f, 0.22461848f},
-std::array<float,2>{0.717094958f, 0.623436213f},
-std::array<float,2>{0.193929538f, 0.912252963f},
-std::array<float,2>{0.602032721f, 0.456946969f},
-std::array<float,2>{0.314372271f, 0.163871244f},
-std::array<float,2>{0.975619197f, 0.546992421f},
-std::array<float,2>{0.431822747f, 0.654463172f},
-std::array<float,2>{0.865730643f, 0.0600374341f},
-std::array<float,2>{0.0483113304f, 0.345472544f},
-std::array<float,2>{0.684517324f, 0.75576812f},
-std::array<float,2>{0.106665291f, 0.566228449f},
-std::array<float,2>{0.745965898f, 0.192562208f},
-std::array<float,2>{0.444311023f, 0.389359325f},
-std::array<float,2>{0.760300338f, 0.974063456f},
-std::array<float,2>{0.28724739f, 0.818482578f},
-std::array<float,2>{0.899962842f, 0.296969295f},
-std::array<float,2>{0.172589391f, 0.111892328f},
-std::array<float,2>{0.501202643f, 0.706885338f},
-std::array<float,2>{0.247018978f, 0.761403739f},
-std::array<float,2>{0.563481867f, 0.356515318f},
-std::array<float,2>{0.36305657f, 0.0474974997f},
-std::array<float,2>{0.938718498f, 0.641110003f},
-std::array<float,2>{0.395204455f, 0.559683204f},
-std::array<float,2>{0.820959508f, 0.167163655f},
-std::array<float,2>{0.0234234594f, 0.461033493f},
-std::array<float,2>{0.648194075f, 0.919214845f},
-std::array<float,2>{0.0641054139f, 0.712096572f},
-std::array<float,2>{0.708186328f, 0.119245715f},
-std::array<float,2>{0.474811673f, 0.310435265f},
-std::array<float,2>{0.80388999f, 0.827165365f},
-std::array<float,2>{0.279100865f, 0.983626306f},
-std::array<float,2>{0.923275352f, 0.37978369f},
-std::array<float,2>{0.137789518f, 0.198981643f},
-std::array<float,2>{0.538887501f, 0.572678268f},
-std::array<float,2>{0.055941157f, 0.890796304f},
-std::array<float,2>{0.675729692f, 0.484145224f},
-std::array<float,2>{0.426381409f, 0.135374501f},
-std::array<float,2>{0.870524108f, 0.519200027f},
-std::array<float,2>{0.326026827f, 0.656874359f},
-std::array<float,2>{0.980399251f, 0.0150782904f},
-std::array<float,2>{0.199915573f, 0.342105299f},
-std::array<float,2>{0.594311714f, 0.800079942f},
-std::array<float,2>{0.184655651f, 0.610819936f},
-std::array<float,2>{0.510112345f, 0.233441949f},
-std::array<float,2>{0.294018984f, 0.41170904f},
-std::array<float,2>{0.896619141f, 0.954590738f},
-std::array<float,2>{0.450227976f, 0.863271356f},
-std::array<float,2>{0.755796969f, 0.275459915f},
-std::array<float,2>{0.0992824361f, 0.0841365755f},
-std::array<float,2>{0.735097468f, 0.733688414f},
-std::array<float,2>{0.122636862f, 0.838905931f},
-std::array<float,2>{0.722400546f, 0.286440879f},
-std::array<float,2>{0.461349934f, 0.103693746f},
-std::array<float,2>{0.766405523f, 0.688500106f},
-std::array<float,2>{0.302114725f, 0.580403328f},
-std::array<float,2>{0.885124385f, 0.210007042f},
-std::array<float,2>{0.171179295f, 0.404146165f},
-std::array<float,2>{0.52141422f, 0.993883014f},
-std::array<float,2>{0.216334313f, 0.625521064f},
-std::array<float,2>{0.610484242f, 0.0426045954f},
-std::array<float,2>{0.335422277f, 0.362026781f},
-std::array<float,2>{0.984949589f, 0.769604266f},
-std::array<float,2>{0.421353698f, 0.935942769f},
-std::array<float,2>{0.848060787f, 0.440827549f},
-std::array<float,2>{0.038503848f, 0.180401236f},
-std::array<float,2>{0.65627569f, 0.543446779f},
-std::array<float,2>{0.144040972f, 0.938184738f},
-std::array<float,2>{0.557058275f, 0.436242878f},
-std::array<float,2>{0.252025515f, 0.239462629f},
-std::array<float,2>{0.910103977f, 0.59650892f},
-std::array<float,2>{0.496890068f, 0.74514097f},
-std::array<float,2>{0.787715077f, 0.0780929253f},
-std::array<float,2>{0.0936999619f, 0.260141283f},
-std::array<float,2>{0.699131191f, 0.855616331f},
-std::array<float,2>{0.00828681327f, 0.503156722f},
-std::array<float,2>{0.640156507f, 0.152882844f},
-std::array<float,2>{0.376047879f, 0.49890393f},
-std::array<float,2>{0.840133965f, 0.878800273f},
-std::array<float,2>{0.349839449f, 0.794359148f},
-std::array<float,2>{0.958712697f, 0.322428435f},
-std::array<float,2>{0.220670626f, 0.0241329037f},
-std::array<float,2>{0.59237951f, 0.681388855f},
-std::array<float,2>{0.181108952f, 0.776818395f},
-std::array<float,2>{0.514758587f, 0.369967163f},
-std::array<float,2>{0.292499423f, 0.0378366858f},
-std::array<float,2>{0.893636107f, 0.633620083f},
-std::array<float,2>{0.449213177f, 0.535389543f},
-std::array<float,2>{0.752617002f, 0.17469883f},
-std::array<float,2>{0.0945212096f, 0.446563154f},
-std::array<float,2>{0.73987788f, 0.928236246f},
-std::array<float,2>{0.0588241741f, 0.69557941f},
-std::array<float,2>{0.676767349f, 0.0996292159f},
-std::array<float,2>{0.422983468f, 0.294281632f},
-std::array<float,2>{0.872505546f, 0.828625739f},
-std::array<float,2>{0.320642143f, 0.985124826f},
-std::array<float,2>{0.981075227f, 0.39138189f},
-std::array<float,2>{0.197769403f, 0.218138203f},
-std::array<float,2>{0.601471066f, 0.588504732f},
-std::array<float,2>{0.0687246993f, 0.884637654f},
-std::array<float,2>{0.70399195f, 0.486313999f},
-std::array<float,2>{0.470374674f, 0.143732429f},
-std::array<float,2>{0.797775865f, 0.508035898f},
-std::array<float,2>{0.275380492f, 0.67234689f},
-std::array<float,2>{0.929619133f, 0.0201373398f},
-std::array<float,2>{0.132895872f, 0.313933074f},
-std::array<float,2>{0.531536043f, 0.781403959f},
-std::array<float,2>{0.245547608f, 0.602767646f},
-std::array<float,2>{0.567421317f, 0.245056778f},
-std::array<float,2>{0.364521056f, 0.427538067f},
-std::array<float,2>{0.944353998f, 0.949198961f},
-std::array<float,2>{0.39083451f, 0.84581995f},
-std::array<float,2>{0.82744199f, 0.256902218f},
-std::array<float,2>{0.0195159204f, 0.0637946576f},
-std::array<float,2>{0.64272964f, 0.736304224f},
-std::array<float,2>{0.0140341893f, 0.816196442f},
-std::array<float,2>{0.635888517f, 0.303439975f},
-std::array<float,2>{0.381933004f, 0.115677029f},
-std::array<float,2>{0.838633895f, 0.708655655f},
-std::array<float,2>{0.345233083f, 0.56676209f},
-std::array<float,2>{0.953876853f, 0.188486874f},
-std::array<float,2>{0.224935487f, 0.386054695f},
-std::array<float,2>{0.588717163f, 0.970216513f},
-std::array<float,2>{0.146516129f, 0.650155723f},
-std::array<float,2>{0.560107946f, 0.056198258f},
-std::array<float,2>{0.255503118f, 0.348729968f},
-std::array<float,2>{0.913465917f, 0.751832843f},
-std::array<float,2>{0.494807273f, 0.906635582f},
-std::array<float,2>{0.783981085f, 0.457662255f},
-std::array<float,2>{0.0874482617f, 0.157877803f},
-std::array<float,2>{0.700509667f, 0.554148912f},
-std::array<float,2>{0.211659312f, 0.965192795f},
-std::array<float,2>{0.616728604f, 0.415263265f},
-std::array<float,2>{0.330812544f, 0.220143303f},
-std::array<float,2>{0.989162207f, 0.61931473f},
-std::array<float,2>{0.414605677f, 0.72380048f},
-std::array<float,2>{0.845489562f, 0.0918334275f},
-std::array<float,2>{0.0324994214f, 0.272499055f},
-std::array<float,2>{0.664007246f, 0.873399436f},
-std::array<float,2>{0.118301086f, 0.52674067f},
-std::array<float,2>{0.724193335f, 0.12888284f},
-std::array<float,2>{0.465040356f, 0.470355958f},
-std::array<float,2>{0.771672189f, 0.900033593f},
-std::array<float,2>{0.299095333f, 0.808994055f},
-std::array<float,2>{0.890230179f, 0.334284544f},
-std::array<float,2>{0.165960461f, 0.0018874777f},
-std::array<float,2>{0.518430948f, 0.66740346f},
-std::array<float,2>{0.228247583f, 0.866845191f},
-std::array<float,2>{0.584569991f, 0.280154109f},
-std::array<float,2>{0.355427682f, 0.0803027526f},
-std::array<float,2>{0.965704679f, 0.726998746f},
-std::array<float,2>{0.38789928f, 0.614675283f},
-std::array<float,2>{0.829897225f, 0.226881266f},
-std::array<float,2>{0.00268566981f, 0.40854913f},
-std::array<float,2>{0.625876665f, 0.957662344f},
-std::array<float,2>{0.0797429308f, 0.660987735f},
-std::array<float,2>{0.695003211f, 0.0111745354f},
-std::array<float,2>{0.491658658f, 0.338252723f},
-std::array<float,2>{0.79629904f, 0.802609921f},
-std::array<float,2>{0.262990981f, 0.898106813f},
-std::array<float,2>{0.920737267f, 0.477728695f},
-std::array<float,2>{0.149058878f, 0.139834002f},
-std::array<float,2>{0.547240078f, 0.52036351f},
-std::array<float,2>{0.0465635359f, 0.97703141f},
-std::array<float,2>{0.665951252f, 0.378359169f},
-std::array<float,2>{0.406287789f, 0.201253295f},
-std::array<float,2>{0.852968276f, 0.57753855f},
-std::array<float,2>{0.343137324f, 0.714962542f},
-std::array<float,2>{0.99577713f, 0.121639833f},
-std::array<float,2>{0.20683001f, 0.305164188f},
-std::array<float,2>{0.620816886f, 0.8218835f},
-std::array<float,2>{0.162761092f, 0.55715698f},
-std::array<float,2>{0.524150014f, 0.169167325f},
-std::array<float,2>{0.306067079f, 0.465797395f},
-std::array<float,2>{0.875689268f, 0.917899609f},
-std::array<float,2>{0.458819032f, 0.763604939f},
-std::array<float,2>{0.779635668f, 0.35285449f},
-std::array<float,2>{0.111623518f, 0.0519205034f},
-std::array<float,2>{0.729676068f, 0.645207703f},
-std::array<float,2>{0.105453812f, 0.791496396f},
-std::array<float,2>{0.748089612f, 0.324280679f},
-std::array<float,2>{0.440800577f, 0.0275054947f},
-std::array<float,2>{0.764805675f, 0.683621347f},
-std::array<float,2>{0.283715516f, 0.506989419f},
-std::array<float,2>{0.903870285f, 0.150138855f},
-std::array<float,2>{0.179038972f, 0.494314313f},
-std::array<float,2>{0.507669449f, 0.881707013f},
-std::array<float,2>{0.189868972f, 0.747741342f},
-std::array<float,2>{0.608160079f, 0.0741144344f},
-std::array<float,2>{0.319266409f, 0.263388753f},
-std::array<float,2>{0.970546126f, 0.854360819f},
-std::array<float,2>{0.433776647f, 0.942785442f},
-std::array<float,2>{0.860802114f, 0.429713637f},
-std::array<float,2>{0.0515552945f, 0.234917521f},
-std::array<float,2>{0.679877043f, 0.599176288f},
-std::array<float,2>{0.130963519f, 0.932740211f},
-std::array<float,2>{0.543156743f, 0.444463581f},
-std::array<float,2>{0.269415528f, 0.18633157f},
-std::array<float,2>{0.936920285f, 0.540191889f},
-std::array<float,2>{0.480087906f, 0.631178021f},
-std::array<float,2>{0.809514642f, 0.044813361f},
-std::array<float,2>{0.076037325f, 0.365842402f},
-std::array<float,2>{0.711651266f, 0.766926169f},
-std::array<float,2>{0.0273469146f, 0.585839331f},
-std::array<float,2>{0.651152849f, 0.205188498f},
-std::array<float,2>{0.401984394f, 0.399488389f},
-std::array<float,2>{0.815256476f, 0.996283054f},
-std::array<float,2>{0.371772081f, 0.840715706f},
-std::array<float,2>{0.948743403f, 0.283567578f},
-std::array<float,2>{0.241698176f, 0.108105063f},
-std::array<float,2>{0.575502276f, 0.692468405f},
-std::array<float,2>{0.154744893f, 0.833885133f},
-std::array<float,2>{0.553071439f, 0.292174429f},
-std::array<float,2>{0.261607766f, 0.0975188166f},
-std::array<float,2>{0.91506511f, 0.700670719f},
-std::array<float,2>{0.484989434f, 0.590136588f},
-std::array<float,2>{0.792298138f, 0.213208854f},
-std::array<float,2>{0.0832224935f, 0.395652592f},
-std::array<float,2>{0.688118756f, 0.990123987f},
-std::array<float,2>{0.00475117564f, 0.638294518f},
-std::array<float,2>{0.630248666f, 0.0340498015f},
-std::array<float,2>{0.383958936f, 0.373524457f},
-std::array<float,2>{0.834372163f, 0.78019774f},
-std::array<float,2>{0.358845115f, 0.923881471f},
-std::array<float,2>{0.96135211f, 0.451980293f},
-std::array<float,2>{0.233618423f, 0.178738669f},
-std::array<float,2>{0.579071462f, 0.532058299f},
-std::array<float,2>{0.114812121f, 0.952070534f},
-std::array<float,2>{0.730894864f, 0.42480278f},
-std::array<float,2>{0.455063581f, 0.247906834f},
-std::array<float,2>{0.775598228f, 0.608470321f},
-std::array<float,2>{0.311181754f, 0.739777684f},
-std::array<float,2>{0.879821897f, 0.0699994639f},
-std::array<float,2>{0.159391552f, 0.252280802f},
-std::array<float,2>{0.53029567f, 0.848300636f},
-std::array<float,2>{0.207776517f, 0.513979495f},
-std::array<float,2>{0.622261167f, 0.145587072f},
-std::array<float,2>{0.337411076f, 0.489170432f},
-std::array<float,2>{0.997666538f, 0.888600647f},
-std::array<float,2>{0.413006246f, 0.785449922f},
-std::array<float,2>{0.856321931f, 0.317151517f},
-std::array<float,2>{0.0395198502f, 0.016272461f},
-std::array<float,2>{0.668591261f, 0.678727508f},
-std::array<float,2>{0.0503808297f, 0.756848872f},
-std::array<float,2>{0.687192559f, 0.346701652f},
-std::array<float,2>{0.431256771f, 0.0616208948f},
-std::array<float,2>{0.864042819f, 0.653180897f},
-std::array<float,2>{0.314599037f, 0.549675763f},
-std::array<float,2>{0.972778201f, 0.161978155f},
-std::array<float,2>{0.192781344f, 0.453898787f},
-std::array<float,2>{0.604682922f, 0.910873055f},
-std::array<float,2>{0.174611822f, 0.703212082f},
-std::array<float,2>{0.503551245f, 0.110343128f},
-std::array<float,2>{0.285333395f, 0.300591379f},
-std::array<float,2>{0.900702119f, 0.816749215f},
-std::array<float,2>{0.443020165f, 0.97494626f},
-std::array<float,2>{0.758562386f, 0.387566417f},
-std::array<float,2>{0.10880357f, 0.193781346f},
-std::array<float,2>{0.743437529f, 0.562993109f},
-std::array<float,2>{0.235538095f, 0.903458238f},
-std::array<float,2>{0.572588384f, 0.473189205f},
-std::array<float,2>{0.368458807f, 0.130215973f},
-std::array<float,2>{0.950208962f, 0.528778732f},
-std::array<float,2>{0.406009287f, 0.671859741f},
-std::array<float,2>{0.817178786f, 0.00608615624f},
-std::array<float,2>{0.0268656556f, 0.329551429f},
-std::array<float,2>{0.652877927f, 0.808499634f},
-std::array<float,2>{0.0741246492f, 0.62256062f},
-std::array<float,2>{0.71665287f, 0.223924741f},
-std::array<float,2>{0.484264225f, 0.420178026f},
-std::array<float,2>{0.806553245f, 0.96431613f},
-std::array<float,2>{0.273210645f, 0.871076286f},
-std::array<float,2>{0.932960927f, 0.267553687f},
-std::array<float,2>{0.125438839f, 0.0873299539f},
-std::array<float,2>{0.539532602f, 0.721781909f},
-std::array<float,2>{0.201665178f, 0.797772884f},
-std::array<float,2>{0.596266687f, 0.339978337f},
-std::array<float,2>{0.32675305f, 0.0134861702f},
-std::array<float,2>{0.978260815f, 0.659706831f},
-std::array<float,2>{0.429327756f, 0.516485691f},
-std::array<float,2>{0.86854434f, 0.13319993f},
-std::array<float,2>{0.0582707115f, 0.480821252f},
-std::array<float,2>{0.672717929f, 0.893164277f},
-std::array<float,2>{0.100279383f, 0.730736434f},
-std::array<float,2>{0.738073826f, 0.0833000764f},
-std::array<float,2>{0.452290535f, 0.273828208f},
-std::array<float,2>{0.757317841f, 0.861234307f},
-std::array<float,2>{0.296144158f, 0.955270886f},
-std::array<float,2>{0.894897759f, 0.413953573f},
-std::array<float,2>{0.186796188f, 0.230498865f},
-std::array<float,2>{0.509132147f, 0.611931562f},
-std::array<float,2>{0.0201925505f, 0.920705557f},
-std::array<float,2>{0.645413697f, 0.463335842f},
-std::array<float,2>{0.396677464f, 0.165336475f},
-std::array<float,2>{0.823864341f, 0.561501026f},
-std::array<float,2>{0.359965056f, 0.642612636f},
-std::array<float,2>{0.941371441f, 0.0498012304f},
-std::array<float,2>{0.248619363f, 0.359356791f},
-std::array<float,2>{0.5653404f, 0.758963227f},
-std::array<float,2>{0.13972488f, 0.572247148f},
-std::array<float,2>{0.536091447f, 0.196957722f},
-std::array<float,2>{0.279572099f, 0.381626815f},
-std::array<float,2>{0.925521851f, 0.980897963f},
-std::array<float,2>{0.474322349f, 0.825240433f},
-std::array<float,2>{0.802102089f, 0.311523587f},
-std::array<float,2>{0.0645067468f, 0.11872638f},
-std::array<float,2>{0.709121287f, 0.713858962f},
-std::array<float,2>{0.0917914063f, 0.858035564f},
-std::array<float,2>{0.69610256f, 0.25876072f},
-std::array<float,2>{0.499249309f, 0.0747367889f},
-std::array<float,2>{0.785905361f, 0.742595971f},
-std::array<float,2>{0.251430571f, 0.595666468f},
-std::array<float,2>{0.907541692f, 0.240410849f},
-std::array<float,2>{0.141907215f, 0.435394168f},
-std::array<float,2>{0.555961549f, 0.940212905f},
-std::array<float,2>{0.22260803f, 0.682020903f},
-std::array<float,2>{0.589936018f, 0.0271954592f},
-std::array<float,2>{0.348483264f, 0.320529729f},
-std::array<float,2>{0.959825635f, 0.795045197f},
-std::array<float,2>{0.377102017f, 0.876718402f},
-std::array<float,2>{0.843574166f, 0.497197211f},
-std::array<float,2>{0.0110677173f, 0.154465273f},
-std::array<float,2>{0.636836886f, 0.500163853f},
-std::array<float,2>{0.168267176f, 0.995984495f},
-std::array<float,2>{0.522497416f, 0.405293077f},
-std::array<float,2>{0.303898484f, 0.208485126f},
-std::array<float,2>{0.883788764f, 0.580051899f},
-std::array<float,2>{0.464294761f, 0.690989375f},
-std::array<float,2>{0.767897844f, 0.103387728f},
-std::array<float,2>{0.124191917f, 0.288065314f},
-std::array<float,2>{0.720174789f, 0.837860882f},
-std::array<float,2>{0.0368952006f, 0.546872199f},
-std::array<float,2>{0.658407211f, 0.182924211f},
-std::array<float,2>{0.419549108f, 0.437583387f},
-std::array<float,2>{0.850610971f, 0.934642076f},
-std::array<float,2>{0.333786637f, 0.77340287f},
-std::array<float,2>{0.987327099f, 0.359880149f},
-std::array<float,2>{0.216912225f, 0.040721897f},
-std::array<float,2>{0.611579835f, 0.628118932f},
-std::array<float,2>{0.130723715f, 0.767237484f},
-std::array<float,2>{0.545870543f, 0.365400285f},
-std::array<float,2>{0.265853107f, 0.0443591401f},
-std::array<float,2>{0.934902668f, 0.631563902f},
-std::array<float,2>{0.478381574f, 0.540681064f},
-std::array<float,2>{0.811525285f, 0.185887426f},
-std::array<float,2>{0.0769057274f, 0.445216924f},
-std::array<float,2>{0.713326812f, 0.933541358f},
-std::array<float,2>{0.0304076318f, 0.693046749f},
-std::array<float,2>{0.649200201f, 0.107534356f},
-std::array<float,2>{0.399896324f, 0.283960342f},
-std::array<float,2>{0.81294781f, 0.840104997f},
-std::array<float,2>{0.374830633f, 0.996875942f},
-std::array<float,2>{0.946030855f, 0.400158107f},
-std::array<float,2>{0.238798141f, 0.205985352f},
-std::array<float,2>{0.57776016f, 0.585398972f},
-std::array<float,2>{0.101875052f, 0.880887449f},
-std::array<float,2>{0.74688977f, 0.49476248f},
-std::array<float,2>{0.437733084f, 0.149845108f},
-std::array<float,2>{0.7626369f, 0.507563651f},
-std::array<float,2>{0.282013506f, 0.684333265f},
-std::array<float,2>{0.905774593f, 0.0283128079f},
-std::array<float,2>{0.176084086f, 0.325065076f},
-std::array<float,2>{0.505095243f, 0.791972995f},
-std::array<float,2>{0.189405322f, 0.598982394f},
-std::array<float,2>{0.606141984f, 0.23458074f},
-std::array<float,2>{0.317725211f, 0.430283576f},
-std::array<float,2>{0.971873701f, 0.943092763f},
-std::array<float,2>{0.437254012f, 0.853909254f},
-std::array<float,2>{0.861537755f, 0.263126045f},
-std::array<float,2>{0.0540802218f, 0.0733241364f},
-std::array<float,2>{0.683334231f, 0.747331619f},
-std::array<float,2>{0.0439597704f, 0.821574271f},
-std::array<float,2>{0.66621238f, 0.30530256f},
-std::array<float,2>{0.409559637f, 0.121527672f},
-std::array<float,2>{0.855299115f, 0.715798616f},
-std::array<float,2>{0.340063274f, 0.57784158f},
-std::array<float,2>{0.994087577f, 0.201948687f},
-std::array<float,2>{0.203524023f, 0.378559142f},
-std::array<float,2>{0.617831588f, 0.977278411f},
-std::array<float,2>{0.160470724f, 0.644538045f},
-std::array<float,2>{0.526399434f, 0.0524193496f},
-std::array<float,2>{0.308265567f, 0.353105247f},
-std::array<float,2>{0.877618551f, 0.763067126f},
-std::array<float,2>{0.459897816f, 0.917223811f},
-std::array<float,2>{0.77833122f, 0.465198725f},
-std::array<float,2>{0.111190714f, 0.169555902f},
-std::array<float,2>{0.727011025f, 0.556652009f},
-std::array<float,2>{0.228766531f, 0.957249582f},
-std::array<float,2>{0.583979666f, 0.409169793f},
-std::array<float,2>{0.353441268f, 0.2275365f},
-std::array<float,2>{0.967686176f, 0.614971697f},
-std::array<float,2>{0.390098482f, 0.727068245f},
-std::array<float,2>{0.830556452f, 0.0807088241f},
-std::array<float,2>{0.00168224261f, 0.279563248f},
-std::array<float,2>{0.627929211f, 0.866610169f},
-std::array<float,2>{0.0805069804f, 0.519769132f},
-std::array<float,2>{0.692273736f, 0.140410274f},
-std::array<float,2>{0.488595665f, 0.478070676f},
-std::array<float,2>{0.794350326f, 0.897548556f},
-std::array<float,2>{0.264312923f, 0.801843941f},
-std::array<float,2>{0.918637693f, 0.338651657f},
-std::array<float,2>{0.150876895f, 0.0112544987f},
-std::array<float,2>{0.549393594f, 0.660304964f},
-std::array<float,2>{0.212918743f, 0.873833537f},
-std::array<float,2>{0.614242971f, 0.27298674f},
-std::array<float,2>{0.328817993f, 0.0924205855f},
-std::array<float,2>{0.991616249f, 0.724559486f},
-std::array<float,2>{0.417450041f, 0.619649231f},
-std::array<float,2>{0.845847309f, 0.22047168f},
-std::array<float,2>{0.0342553221f, 0.415550292f},
-std::array<float,2>{0.661407888f, 0.965785921f},
-std::array<float,2>{0.120621055f, 0.667543769f},
-std::array<float,2>{0.726344645f, 0.00110664358f},
-std::array<float,2>{0.467594206f, 0.334738225f},
-std::array<float,2>{0.771214247f, 0.809129894f},
-std::array<float,2>{0.298371643f, 0.89961344f},
-std::array<float,2>{0.887619495f, 0.469830155f},
-std::array<float,2>{0.167847574f, 0.128313884f},
-std::array<float,2>{0.517128706f, 0.527247965f},
-std::array<float,2>{0.0123659102f, 0.969840944f},
-std::array<float,2>{0.632910013f, 0.386510819f},
-std::array<float,2>{0.380216599f, 0.1891087f},
-std::array<float,2>{0.836242557f, 0.567256689f},
-std::array<float,2>{0.347498417f, 0.708383739f},
-std::array<float,2>{0.955208302f, 0.11607711f},
-std::array<float,2>{0.223500609f, 0.303076744f},
-std::array<float,2>{0.586588562f, 0.815577805f},
-std::array<float,2>{0.146086603f, 0.554603338f},
-std::array<float,2>{0.560874283f, 0.157645941f},
-std::array<float,2>{0.25777337f, 0.457444847f},
-std::array<float,2>{0.910232067f, 0.906779408f},
-std::array<float,2>{0.492252439f, 0.751040995f},
-std::array<float,2>{0.781981289f, 0.349449754f},
-std::array<float,2>{0.089556165f, 0.055804763f},
-std::array<float,2>{0.70165956f, 0.649810135f},
-std::array<float,2>{0.0671659932f, 0.782206774f},
-std::array<float,2>{0.706698239f, 0.314007193f},
-std::array<float,2>{0.471425891f, 0.0198806506f},
-std::array<float,2>{0.799180508f, 0.672621548f},
-std::array<float,2>{0.276053429f, 0.508334756f},
-std::array<float,2>{0.927408636f, 0.144465148f},
-std::array<float,2>{0.135203153f, 0.485652566f},
-std::array<float,2>{0.535143912f, 0.884123266f},
-std::array<float,2>{0.24278599f, 0.735809863f},
-std::array<float,2>{0.569947779f, 0.0643112212f},
-std::array<float,2>{0.366799086f, 0.257535547f},
-std::array<float,2>{0.942921579f, 0.846654475f},
-std::array<float,2>{0.393138736f, 0.948246062f},
-std::array<float,2>{0.825738966f, 0.42681247f},
-std::array<float,2>{0.0156358927f, 0.244532466f},
-std::array<float,2>{0.641905963f, 0.603106797f},
-std::array<float,2>{0.182020053f, 0.928184927f},
-std::array<float,2>{0.513007641f, 0.447232842f},
-std::array<float,2>{0.290215909f, 0.173905015f},
-std::array<float,2>{0.891413689f, 0.535722136f},
-std::array<float,2>{0.446937174f, 0.63322407f},
-std::array<float,2>{0.750778258f, 0.037419077f},
-std::array<float,2>{0.0966691896f, 0.369366825f},
-std::array<float,2>{0.741219044f, 0.777048707f},
-std::array<float,2>{0.0615004003f, 0.588313162f},
-std::array<float,2>{0.67968142f, 0.218664885f},
-std::array<float,2>{0.424932569f, 0.390975893f},
-std::array<float,2>{0.8742854f, 0.984683275f},
-std::array<float,2>{0.323030233f, 0.828527749f},
-std::array<float,2>{0.98336482f, 0.294787318f},
-std::array<float,2>{0.196741164f, 0.100098081f},
-std::array<float,2>{0.598828316f, 0.695947409f},
-std::array<float,2>{0.171638384f, 0.837179303f},
-std::array<float,2>{0.52058202f, 0.287448376f},
-std::array<float,2>{0.302461326f, 0.102687724f},
-std::array<float,2>{0.885739148f, 0.690905273f},
-std::array<float,2>{0.4616566f, 0.579142153f},
-std::array<float,2>{0.765647352f, 0.208644927f},
-std::array<float,2>{0.122341737f, 0.406147331f},
-std::array<float,2>{0.721966088f, 0.995411634f},
-std::array<float,2>{0.0389097929f, 0.628771782f},
-std::array<float,2>{0.656899035f, 0.0401834659f},
-std::array<float,2>{0.421463281f, 0.359824836f},
-std::array<float,2>{0.848390043f, 0.772851348f},
-std::array<float,2>{0.335827768f, 0.935495555f},
-std::array<float,2>{0.984840989f, 0.43828541f},
-std::array<float,2>{0.215892568f, 0.183383077f},
-std::array<float,2>{0.610984325f, 0.54626888f},
-std::array<float,2>{0.0928483978f, 0.93959409f},
-std::array<float,2>{0.698311031f, 0.434904277f},
-std::array<float,2>{0.496133327f, 0.241015881f},
-std::array<float,2>{0.787195623f, 0.594807982f},
-std::array<float,2>{0.252655327f, 0.742931306f},
-std::array<float,2>{0.909384608f, 0.074528195f},
-std::array<float,2>{0.14436008f, 0.25826022f},
-std::array<float,2>{0.557143867f, 0.857585907f},
-std::array<float,2>{0.219995514f, 0.500545084f},
-std::array<float,2>{0.592143834f, 0.154902101f},
-std::array<float,2>{0.350399524f, 0.497692257f},
-std::array<float,2>{0.958416224f, 0.876140535f},
-std::array<float,2>{0.376784474f, 0.795577168f},
-std::array<float,2>{0.840501726f, 0.321110159f},
-std::array<float,2>{0.00876805093f, 0.0265188608f},
-std::array<float,2>{0.640013874f, 0.682433486f},
-std::array<float,2>{0.0225734711f, 0.759701848f},
-std::array<float,2>{0.647944033f, 0.358854622f},
-std::array<float,2>{0.394897759f, 0.0492984653f},
-std::array<float,2>{0.820494294f, 0.643357217f},
-std::array<float,2>{0.36260891f, 0.5608567f},
-std::array<float,2>{0.939222991f, 0.165924221f},
-std::array<float,2>{0.24650076f, 0.463518739f},
-std::array<float,2>{0.564190447f, 0.919951797f},
-std::array<float,2>{0.138248071f, 0.71308279f},
-std::array<float,2>{0.538291633f, 0.118404329f},
-std::array<float,2>{0.278771937f, 0.312017739f},
-std::array<float,2>{0.923622191f, 0.825717866f},
-std::array<float,2>{0.475417286f, 0.98114115f},
-std::array<float,2>{0.804458797f, 0.381108463f},
-std::array<float,2>{0.0636783987f, 0.196369424f},
-std::array<float,2>{0.708852351f, 0.571418643f},
-std::array<float,2>{0.199274585f, 0.892651558f},
-std::array<float,2>{0.593779922f, 0.481189936f},
-std::array<float,2>{0.325461954f, 0.133500606f},
-std::array<float,2>{0.979619145f, 0.516079187f},
-std::array<float,2>{0.426174223f, 0.659590304f},
-std::array<float,2>{0.870624363f, 0.0127660781f},
-std::array<float,2>{0.0565672815f, 0.340751737f},
-std::array<float,2>{0.674811721f, 0.797167182f},
-std::array<float,2>{0.0988813043f, 0.61163795f},
-std::array<float,2>{0.734525621f, 0.231226802f},
-std::array<float,2>{0.451106668f, 0.413323522f},
-std::array<float,2>{0.755103886f, 0.955968678f},
-std::array<float,2>{0.294740736f, 0.860380948f},
-std::array<float,2>{0.897449076f, 0.274321139f},
-std::array<float,2>{0.185354203f, 0.0837088451f},
-std::array<float,2>{0.510580063f, 0.731041312f},
-std::array<float,2>{0.23749651f, 0.807943583f},
-std::array<float,2>{0.572256148f, 0.329844207f},
-std::array<float,2>{0.370376289f, 0.00646162033f},
-std::array<float,2>{0.951439977f, 0.670939445f},
-std::array<float,2>{0.403442889f, 0.528971612f},
-std::array<float,2>{0.820205748f, 0.13040331f},
-std::array<float,2>{0.0250404477f, 0.472902238f},
-std::array<float,2>{0.654920042f, 0.903857946f},
-std::array<float,2>{0.0721681193f, 0.72217679f},
-std::array<float,2>{0.717516482f, 0.0875962973f},
-std::array<float,2>{0.481776118f, 0.266734958f},
-std::array<float,2>{0.808455944f, 0.870180786f},
-std::array<float,2>{0.271052629f, 0.964491963f},
-std::array<float,2>{0.930534959f, 0.420568228f},
-std::array<float,2>{0.127068982f, 0.224401519f},
-std::array<float,2>{0.5411008f, 0.622516572f},
-std::array<float,2>{0.0488056168f, 0.910352468f},
-std::array<float,2>{0.68360728f, 0.453512073f},
-std::array<float,2>{0.432233959f, 0.161195293f},
-std::array<float,2>{0.865608513f, 0.548855066f},
-std::array<float,2>{0.313896418f, 0.652365685f},
-std::array<float,2>{0.976225436f, 0.0624595024f},
-std::array<float,2>{0.193786353f, 0.347372651f},
-std::array<float,2>{0.602377713f, 0.757460654f},
-std::array<float,2>{0.172074378f, 0.562861323f},
-std::array<float,2>{0.501645088f, 0.194050595f},
-std::array<float,2>{0.288062364f, 0.386763215f},
-std::array<float,2>{0.899680376f, 0.975153685f},
-std::array<float,2>{0.443465024f, 0.816911757f},
-std::array<float,2>{0.759994268f, 0.300103128f},
-std::array<float,2>{0.107329659f, 0.109702237f},
-std::array<float,2>{0.745252788f, 0.703875959f},
-std::array<float,2>{0.11712414f, 0.847884357f},
-std::array<float,2>{0.73377192f, 0.252510577f},
-std::array<float,2>{0.455176443f, 0.0695855021f},
-std::array<float,2>{0.77475965f, 0.739487112f},
-std::array<float,2>{0.308692217f, 0.608941793f},
-std::array<float,2>{0.881257594f, 0.24743098f},
-std::array<float,2>{0.157615274f, 0.423984915f},
-std::array<float,2>{0.529138267f, 0.951256216f},
-std::array<float,2>{0.210819408f, 0.679262578f},
-std::array<float,2>{0.624294639f, 0.015674293f},
-std::array<float,2>{0.338022411f, 0.316725492f},
-std::array<float,2>{0.999863267f, 0.785739601f},
-std::array<float,2>{0.41103828f, 0.888085723f},
-std::array<float,2>{0.857423544f, 0.488677949f},
-std::array<float,2>{0.0425233468f, 0.146212578f},
-std::array<float,2>{0.670409799f, 0.514412344f},
-std::array<float,2>{0.153414607f, 0.98931849f},
-std::array<float,2>{0.552253306f, 0.396045774f},
-std::array<float,2>{0.259599626f, 0.213394463f},
-std::array<float,2>{0.916496754f, 0.590551734f},
-std::array<float,2>{0.48686862f, 0.700792789f},
-std::array<float,2>{0.789374292f, 0.0968784317f},
-std::array<float,2>{0.0844981968f, 0.292902231f},
-std::array<float,2>{0.690059543f, 0.833069921f},
-std::array<float,2>{0.00721315201f, 0.531683981f},
-std::array<float,2>{0.632608473f, 0.179317683f},
-std::array<float,2>{0.385026157f, 0.451307267f},
-std::array<float,2>{0.833834827f, 0.924656212f},
-std::array<float,2>{0.355771065f, 0.77958554f},
-std::array<float,2>{0.963077247f, 0.373842537f},
-std::array<float,2>{0.23155798f, 0.0333485268f},
-std::array<float,2>{0.581094325f, 0.63780725f},
-std::array<float,2>{0.179289386f, 0.7900424f},
-std::array<float,2>{0.506922841f, 0.327098221f},
-std::array<float,2>{0.283445448f, 0.0298262443f},
-std::array<float,2>{0.903729737f, 0.686450958f},
-std::array<float,2>{0.441399455f, 0.504845321f},
-std::array<float,2>{0.765304029f, 0.151884839f},
-std::array<float,2>{0.104659893f, 0.49311471f},
-std::array<float,2>{0.748945594f, 0.879343033f},
-std::array<float,2>{0.0509770997f, 0.748894572f},
-std::array<float,2>{0.680215061f, 0.0705768019f},
-std::array<float,2>{0.434297085f, 0.265378326f},
-std::array<float,2>{0.860871673f, 0.852647185f},
-std::array<float,2>{0.318380743f, 0.944215f},
-std::array<float,2>{0.97015655f, 0.432120651f},
-std::array<float,2>{0.190122917f, 0.237880245f},
-std::array<float,2>{0.607478559f, 0.599621534f},
-std::array<float,2>{0.0752536282f, 0.930434465f},
-std::array<float,2>{0.711262882f, 0.441606969f},
-std::array<float,2>{0.479966819f, 0.183695436f},
-std::array<float,2>{0.808712423f, 0.541364014f},
-std::array<float,2>{0.268747628f, 0.630855858f},
-std::array<float,2>{0.937096357f, 0.0467760116f},
-std::array<float,2>{0.131613702f, 0.364865005f},
-std::array<float,2>{0.543687284f, 0.769374311f},
-std::array<float,2>{0.242138013f, 0.583009779f},
-std::array<float,2>{0.575723708f, 0.204080895f},
-std::array<float,2>{0.371449947f, 0.401771814f},
-std::array<float,2>{0.948691428f, 0.998229563f},
-std::array<float,2>{0.401684076f, 0.843354166f},
-std::array<float,2>{0.814856708f, 0.283120096f},
-std::array<float,2>{0.0281606615f, 0.105781853f},
-std::array<float,2>{0.650425613f, 0.694815874f},
-std::array<float,2>{0.0023942478f, 0.86506927f},
-std::array<float,2>{0.625010252f, 0.278893501f},
-std::array<float,2>{0.388594598f, 0.0791295767f},
-std::array<float,2>{0.829343557f, 0.728694797f},
-std::array<float,2>{0.354781896f, 0.616313875f},
-std::array<float,2>{0.964880228f, 0.228729665f},
-std::array<float,2>{0.227760345f, 0.407186329f},
-std::array<float,2>{0.584273636f, 0.959118664f},
-std::array<float,2>{0.148861438f, 0.662972271f},
-std::array<float,2>{0.54744935f, 0.00844199769f},
-std::array<float,2>{0.26330933f, 0.336335242f},
-std::array<float,2>{0.919963241f, 0.804137588f},
-std::array<float,2>{0.491820097f, 0.895900369f},
-std::array<float,2>{0.796677232f, 0.479784518f},
-std::array<float,2>{0.0793680325f, 0.138590246f},
-std::array<float,2>{0.694481671f, 0.522041738f},
-std::array<float,2>{0.206249133f, 0.979682744f},
-std::array<float,2>{0.620439053f, 0.375940084f},
-std::array<float,2>{0.343725473f, 0.199533895f},
-std::array<float,2>{0.995416641f, 0.574536324f},
-std::array<float,2>{0.40699929f, 0.71760267f},
-std::array<float,2>{0.853183389f, 0.124682024f},
-std::array<float,2>{0.0459803566f, 0.308069319f},
-std::array<float,2>{0.665322721f, 0.822404623f},
-std::array<float,2>{0.111957163f, 0.5549559f},
-std::array<float,2>{0.730067015f, 0.171074346f},
-std::array<float,2>{0.458043665f, 0.467671871f},
-std::array<float,2>{0.779803574f, 0.915443957f},
-std::array<float,2>{0.306553036f, 0.763800144f},
-std::array<float,2>{0.875088096f, 0.354052842f},
-std::array<float,2>{0.162190035f, 0.0538526103f},
-std::array<float,2>{0.523692548f, 0.647218943f},
-std::array<float,2>{0.225239366f, 0.814410031f},
-std::array<float,2>{0.588310122f, 0.301099002f},
-std::array<float,2>{0.344810218f, 0.114281774f},
-std::array<float,2>{0.953258634f, 0.70956552f},
-std::array<float,2>{0.382633954f, 0.570042968f},
-std::array<float,2>{0.838285029f, 0.190273479f},
-std::array<float,2>{0.0144588063f, 0.383697867f},
-std::array<float,2>{0.63655591f, 0.971877158f},
-std::array<float,2>{0.0871197954f, 0.652107954f},
-std::array<float,2>{0.70110327f, 0.0571798831f},
-std::array<float,2>{0.494570762f, 0.350905269f},
-std::array<float,2>{0.78333056f, 0.752038538f},
-std::array<float,2>{0.255081922f, 0.909528792f},
-std::array<float,2>{0.913609505f, 0.459271967f},
-std::array<float,2>{0.147040233f, 0.159257367f},
-std::array<float,2>{0.559680879f, 0.551244199f},
-std::array<float,2>{0.0327694155f, 0.968133926f},
-std::array<float,2>{0.663119316f, 0.416933298f},
-std::array<float,2>{0.414452255f, 0.222628891f},
-std::array<float,2>{0.845120609f, 0.618321717f},
-std::array<float,2>{0.330199599f, 0.725240171f},
-std::array<float,2>{0.988600135f, 0.0899765715f},
-std::array<float,2>{0.210962281f, 0.269808531f},
-std::array<float,2>{0.616643846f, 0.872988164f},
-std::array<float,2>{0.16551137f, 0.523999214f},
-std::array<float,2>{0.517832041f, 0.125685275f},
-std::array<float,2>{0.299484044f, 0.471184194f},
-std::array<float,2>{0.88981837f, 0.901888251f},
-std::array<float,2>{0.465416074f, 0.811993062f},
-std::array<float,2>{0.772252619f, 0.333484262f},
-std::array<float,2>{0.118775629f, 0.00329168327f},
-std::array<float,2>{0.723973572f, 0.665354729f},
-std::array<float,2>{0.0938632414f, 0.774097562f},
-std::array<float,2>{0.73926419f, 0.368533164f},
-std::array<float,2>{0.448428988f, 0.0356252491f},
-std::array<float,2>{0.752097726f, 0.636366069f},
-std::array<float,2>{0.292391449f, 0.538211465f},
-std::array<float,2>{0.894119143f, 0.172779247f},
-std::array<float,2>{0.181269139f, 0.447997034f},
-std::array<float,2>{0.515190601f, 0.927557647f},
-std::array<float,2>{0.197287515f, 0.69762516f},
-std::array<float,2>{0.600656569f, 0.0994313359f},
-std::array<float,2>{0.321113467f, 0.295316011f},
-std::array<float,2>{0.980651438f, 0.831292152f},
-std::array<float,2>{0.423626751f, 0.986976683f},
-std::array<float,2>{0.872772038f, 0.393207818f},
-std::array<float,2>{0.0594372004f, 0.215067193f},
-std::array<float,2>{0.67757839f, 0.587251306f},
-std::array<float,2>{0.133308291f, 0.886660159f},
-std::array<float,2>{0.531799674f, 0.48682639f},
-std::array<float,2>{0.274673551f, 0.142173022f},
-std::array<float,2>{0.929050148f, 0.511481345f},
-std::array<float,2>{0.470008284f, 0.6746068f},
-std::array<float,2>{0.796959817f, 0.0232780315f},
-std::array<float,2>{0.0688830391f, 0.315184474f},
-std::array<float,2>{0.703515351f, 0.783778608f},
-std::array<float,2>{0.0189796593f, 0.603714466f},
-std::array<float,2>{0.643113256f, 0.242542297f},
-std::array<float,2>{0.391567141f, 0.428381026f},
-std::array<float,2>{0.828060985f, 0.946919978f},
-std::array<float,2>{0.36519143f, 0.844044268f},
-std::array<float,2>{0.944825709f, 0.254266649f},
-std::array<float,2>{0.245855942f, 0.0644891113f},
-std::array<float,2>{0.568330765f, 0.737085104f},
-std::array<float,2>{0.142347991f, 0.85610956f},
-std::array<float,2>{0.55657959f, 0.260729373f},
-std::array<float,2>{0.251705289f, 0.0771506354f},
-std::array<float,2>{0.907833457f, 0.74562937f},
-std::array<float,2>{0.499657899f, 0.595931649f},
-std::array<float,2>{0.78516227f, 0.240088299f},
-std::array<float,2>{0.091298528f, 0.435869634f},
-std::array<float,2>{0.695632756f, 0.937546253f},
-std::array<float,2>{0.0115526011f, 0.680899799f},
-std::array<float,2>{0.637333751f, 0.0235301871f},
-std::array<float,2>{0.377753764f, 0.322940975f},
-std::array<float,2>{0.84286499f, 0.794503748f},
-std::array<float,2>{0.347904772f, 0.878257632f},
-std::array<float,2>{0.959169745f, 0.498188972f},
-std::array<float,2>{0.221688613f, 0.15251793f},
-std::array<float,2>{0.590469241f, 0.503758252f},
-std::array<float,2>{0.124835633f, 0.993214369f},
-std::array<float,2>{0.720273376f, 0.403750271f},
-std::array<float,2>{0.464386404f, 0.210872516f},
-std::array<float,2>{0.768463135f, 0.580623686f},
-std::array<float,2>{0.304381013f, 0.689171612f},
-std::array<float,2>{0.883148193f, 0.104320996f},
-std::array<float,2>{0.168485954f, 0.286902666f},
-std::array<float,2>{0.523152053f, 0.839365482f},
-std::array<float,2>{0.217637882f, 0.543575406f},
-std::array<float,2>{0.612225592f, 0.17972368f},
-std::array<float,2>{0.333191276f, 0.441268623f},
-std::array<float,2>{0.988099515f, 0.936450064f},
-std::array<float,2>{0.419066012f, 0.770439446f},
-std::array<float,2>{0.851349831f, 0.361414701f},
-std::array<float,2>{0.0361924581f, 0.042338226f},
-std::array<float,2>{0.658922136f, 0.6250965f},
-std::array<float,2>{0.058060728f, 0.800747991f},
-std::array<float,2>{0.67215246f, 0.342535138f},
-std::array<float,2>{0.428771287f, 0.0154032782f},
-std::array<float,2>{0.868878603f, 0.656423628f},
-std::array<float,2>{0.326482177f, 0.518966734f},
-std::array<float,2>{0.977989316f, 0.135212183f},
-std::array<float,2>{0.201379701f, 0.48370558f},
-std::array<float,2>{0.595752418f, 0.891592622f},
-std::array<float,2>{0.187320948f, 0.734113157f},
-std::array<float,2>{0.509583652f, 0.084543772f},
-std::array<float,2>{0.296547323f, 0.276230961f},
-std::array<float,2>{0.895231605f, 0.86272943f},
-std::array<float,2>{0.452828884f, 0.954191983f},
-std::array<float,2>{0.757759273f, 0.41134131f},
-std::array<float,2>{0.0996335894f, 0.234116524f},
-std::array<float,2>{0.737643659f, 0.611258924f},
-std::array<float,2>{0.248484731f, 0.919658899f},
-std::array<float,2>{0.564707041f, 0.461526453f},
-std::array<float,2>{0.359797508f, 0.167650968f},
-std::array<float,2>{0.940628588f, 0.560419083f},
-std::array<float,2>{0.397140473f, 0.641292632f},
-std::array<float,2>{0.823498607f, 0.0473412499f},
-std::array<float,2>{0.0196962897f, 0.357025146f},
-std::array<float,2>{0.644620478f, 0.760838449f},
-std::array<float,2>{0.0649687797f, 0.573202133f},
-std::array<float,2>{0.709498286f, 0.198499441f},
-std::array<float,2>{0.473975748f, 0.379269481f},
-std::array<float,2>{0.802418411f, 0.984284163f},
-std::array<float,2>{0.280137777f, 0.828105032f},
-std::array<float,2>{0.92485714f, 0.309656948f},
-std::array<float,2>{0.140548915f, 0.119983099f},
-std::array<float,2>{0.535612404f, 0.712664306f},
-std::array<float,2>{0.193072885f, 0.755162477f},
-std::array<float,2>{0.605345964f, 0.345150709f},
-std::array<float,2>{0.31535393f, 0.0601229742f},
-std::array<float,2>{0.973403692f, 0.654934406f},
-std::array<float,2>{0.431147307f, 0.547472835f},
-std::array<float,2>{0.863370359f, 0.163510263f},
-std::array<float,2>{0.0500250906f, 0.45649147f},
-std::array<float,2>{0.686985254f, 0.912871122f},
-std::array<float,2>{0.109101817f, 0.70617044f},
-std::array<float,2>{0.744130552f, 0.111459441f},
-std::array<float,2>{0.442389637f, 0.297456324f},
-std::array<float,2>{0.758152425f, 0.81886375f},
-std::array<float,2>{0.286099315f, 0.974467993f},
-std::array<float,2>{0.901242375f, 0.388909727f},
-std::array<float,2>{0.173913285f, 0.193232402f},
-std::array<float,2>{0.50312072f, 0.565902174f},
-std::array<float,2>{0.0267975815f, 0.905797362f},
-std::array<float,2>{0.65275389f, 0.475237459f},
-std::array<float,2>{0.405342996f, 0.132696182f},
-std::array<float,2>{0.816739798f, 0.530450284f},
-std::array<float,2>{0.369015127f, 0.669509351f},
-std::array<float,2>{0.950907409f, 0.00413261121f},
-std::array<float,2>{0.236262232f, 0.331929982f},
-std::array<float,2>{0.572965801f, 0.805124342f},
-std::array<float,2>{0.125506014f, 0.623891175f},
-std::array<float,2>{0.539740145f, 0.225106239f},
-std::array<float,2>{0.27293089f, 0.419079691f},
-std::array<float,2>{0.933135629f, 0.96196723f},
-std::array<float,2>{0.483730793f, 0.869024754f},
-std::array<float,2>{0.805736005f, 0.267918527f},
-std::array<float,2>{0.0733455718f, 0.0891604871f},
-std::array<float,2>{0.715835571f, 0.719461262f},
-std::array<float,2>{0.0836085454f, 0.834489226f},
-std::array<float,2>{0.687746584f, 0.289913058f},
-std::array<float,2>{0.484539896f, 0.0946152508f},
-std::array<float,2>{0.792602539f, 0.702844262f},
-std::array<float,2>{0.260989398f, 0.59293437f},
-std::array<float,2>{0.915796816f, 0.211608618f},
-std::array<float,2>{0.154996946f, 0.398290813f},
-std::array<float,2>{0.553674281f, 0.99082768f},
-std::array<float,2>{0.234350756f, 0.638720274f},
-std::array<float,2>{0.57822907f, 0.0313840918f},
-std::array<float,2>{0.359362245f, 0.372429699f},
-std::array<float,2>{0.961452127f, 0.778118193f},
-std::array<float,2>{0.38454631f, 0.923686981f},
-std::array<float,2>{0.834684312f, 0.450876921f},
-std::array<float,2>{0.00425841054f, 0.176149875f},
-std::array<float,2>{0.630586624f, 0.534835219f},
-std::array<float,2>{0.159786671f, 0.94990623f},
-std::array<float,2>{0.531085074f, 0.422260761f},
-std::array<float,2>{0.310710192f, 0.248762339f},
-std::array<float,2>{0.879122138f, 0.607041776f},
-std::array<float,2>{0.454481602f, 0.741751552f},
-std::array<float,2>{0.775911808f, 0.0670816079f},
-std::array<float,2>{0.114287555f, 0.251266778f},
-std::array<float,2>{0.731228352f, 0.849691629f},
-std::array<float,2>{0.0396573842f, 0.512103319f},
-std::array<float,2>{0.668271005f, 0.147285014f},
-std::array<float,2>{0.412175328f, 0.492181838f},
-std::array<float,2>{0.85564822f, 0.889994919f},
-std::array<float,2>{0.337326318f, 0.787917137f},
-std::array<float,2>{0.997335792f, 0.319234669f},
-std::array<float,2>{0.207108751f, 0.0184373222f},
-std::array<float,2>{0.623030782f, 0.675858915f},
-std::array<float,2>{0.151567981f, 0.803395391f},
-std::array<float,2>{0.550619185f, 0.337227494f},
-std::array<float,2>{0.265101641f, 0.0097153727f},
-std::array<float,2>{0.919728339f, 0.663854957f},
-std::array<float,2>{0.489319414f, 0.522875071f},
-std::array<float,2>{0.793636501f, 0.137217671f},
-std::array<float,2>{0.0816895813f, 0.479073316f},
-std::array<float,2>{0.692777514f, 0.894708693f},
-std::array<float,2>{0.000307381881f, 0.73041153f},
-std::array<float,2>{0.628709376f, 0.078494437f},
-std::array<float,2>{0.389351457f, 0.277836382f},
-std::array<float,2>{0.831500351f, 0.864175975f},
-std::array<float,2>{0.351607621f, 0.960511267f},
-std::array<float,2>{0.968287826f, 0.407571614f},
-std::array<float,2>{0.229650572f, 0.230157897f},
-std::array<float,2>{0.582683206f, 0.615349114f},
-std::array<float,2>{0.11029733f, 0.914964259f},
-std::array<float,2>{0.727701306f, 0.468320161f},
-std::array<float,2>{0.460335523f, 0.170567602f},
-std::array<float,2>{0.77818644f, 0.555863976f},
-std::array<float,2>{0.306667924f, 0.648124993f},
-std::array<float,2>{0.878413141f, 0.0529189631f},
-std::array<float,2>{0.161410362f, 0.355421454f},
-std::array<float,2>{0.526157856f, 0.765015185f},
-std::array<float,2>{0.204461038f, 0.575260818f},
-std::array<float,2>{0.618434846f, 0.200577006f},
-std::array<float,2>{0.341751903f, 0.376241177f},
-std::array<float,2>{0.992863834f, 0.979083955f},
-std::array<float,2>{0.409074664f, 0.823396802f},
-std::array<float,2>{0.854125321f, 0.307449222f},
-std::array<float,2>{0.0436532944f, 0.123259403f},
-std::array<float,2>{0.667067647f, 0.71817708f},
-std::array<float,2>{0.0529286154f, 0.851742804f},
-std::array<float,2>{0.681898594f, 0.264288932f},
-std::array<float,2>{0.435721993f, 0.0714048371f},
-std::array<float,2>{0.862883031f, 0.749714792f},
-std::array<float,2>{0.317040324f, 0.60150367f},
-std::array<float,2>{0.971241474f, 0.237237915f},
-std::array<float,2>{0.188192829f, 0.433295131f},
-std::array<float,2>{0.606863797f, 0.944734573f},
-std::array<float,2>{0.177579731f, 0.687360406f},
-std::array<float,2>{0.504585683f, 0.0305354521f},
-std::array<float,2>{0.283179671f, 0.327998281f},
-std::array<float,2>{0.905123055f, 0.789643288f},
-std::array<float,2>{0.438846678f, 0.880098403f},
-std::array<float,2>{0.762782276f, 0.494110703f},
-std::array<float,2>{0.1034244f, 0.150992945f},
-std::array<float,2>{0.748036325f, 0.505627036f},
-std::array<float,2>{0.240007922f, 0.999989808f},
-std::array<float,2>{0.577104867f, 0.400710285f},
-std::array<float,2>{0.373691201f, 0.204571247f},
-std::array<float,2>{0.9471457f, 0.582394242f},
-std::array<float,2>{0.39912641f, 0.69391346f},
-std::array<float,2>{0.813582718f, 0.106629871f},
-std::array<float,2>{0.029560199f, 0.281686962f},
-std::array<float,2>{0.649475336f, 0.842623711f},
-std::array<float,2>{0.0779692084f, 0.542610288f},
-std::array<float,2>{0.713870645f, 0.184781268f},
-std::array<float,2>{0.476941407f, 0.442660391f},
-std::array<float,2>{0.810958087f, 0.931078017f},
-std::array<float,2>{0.266937524f, 0.76807332f},
-std::array<float,2>{0.933950722f, 0.364080846f},
-std::array<float,2>{0.129239976f, 0.0451615006f},
-std::array<float,2>{0.54677844f, 0.629714847f},
-std::array<float,2>{0.195529386f, 0.830686092f},
-std::array<float,2>{0.598561049f, 0.296435326f},
-std::array<float,2>{0.323293f, 0.097769402f},
-std::array<float,2>{0.983529091f, 0.698919833f},
-std::array<float,2>{0.424028814f, 0.586854994f},
-std::array<float,2>{0.873391509f, 0.215934947f},
-std::array<float,2>{0.0619665347f, 0.394311845f},
-std::array<float,2>{0.678654194f, 0.988177419f},
-std::array<float,2>{0.096965313f, 0.635458291f},
-std::array<float,2>{0.740414381f, 0.0363131426f},
-std::array<float,2>{0.445549428f, 0.367526531f},
-std::array<float,2>{0.751948893f, 0.775045872f},
-std::array<float,2>{0.289410472f, 0.926087618f},
-std::array<float,2>{0.891966164f, 0.448686004f},
-std::array<float,2>{0.183136538f, 0.173153207f},
-std::array<float,2>{0.512242496f, 0.537192225f},
-std::array<float,2>{0.0170864351f, 0.945673943f},
-std::array<float,2>{0.641159236f, 0.429556251f},
-std::array<float,2>{0.394414514f, 0.243166178f},
-std::array<float,2>{0.825182199f, 0.605378926f},
-std::array<float,2>{0.365492582f, 0.737964094f},
-std::array<float,2>{0.941993415f, 0.0659857541f},
-std::array<float,2>{0.243718758f, 0.254986972f},
-std::array<float,2>{0.568374515f, 0.845482826f},
-std::array<float,2>{0.136526078f, 0.510599673f},
-std::array<float,2>{0.533628166f, 0.141453326f},
-std::array<float,2>{0.277200848f, 0.487332225f},
-std::array<float,2>{0.926433802f, 0.88536489f},
-std::array<float,2>{0.472385645f, 0.784671247f},
-std::array<float,2>{0.800166428f, 0.31580767f},
-std::array<float,2>{0.0674130023f, 0.0221266989f},
-std::array<float,2>{0.706002235f, 0.675335407f},
-std::array<float,2>{0.0882111862f, 0.752966106f},
-std::array<float,2>{0.702816963f, 0.349791288f},
-std::array<float,2>{0.493766218f, 0.0583905131f},
-std::array<float,2>{0.78236413f, 0.650605857f},
-std::array<float,2>{0.255916774f, 0.552083194f},
-std::array<float,2>{0.911368966f, 0.159161627f},
-std::array<float,2>{0.145050749f, 0.46056971f},
-std::array<float,2>{0.561911523f, 0.908980131f},
-std::array<float,2>{0.22430858f, 0.71035403f},
-std::array<float,2>{0.587796688f, 0.113960885f},
-std::array<float,2>{0.346262783f, 0.302323163f},
-std::array<float,2>{0.956453502f, 0.812897503f},
-std::array<float,2>{0.379510403f, 0.970754385f},
-std::array<float,2>{0.837333858f, 0.38442573f},
-std::array<float,2>{0.0134309828f, 0.190593973f},
-std::array<float,2>{0.633936703f, 0.568447113f},
-std::array<float,2>{0.166260421f, 0.900630653f},
-std::array<float,2>{0.515673041f, 0.472344428f},
-std::array<float,2>{0.297690362f, 0.126384869f},
-std::array<float,2>{0.887825906f, 0.525384605f},
-std::array<float,2>{0.468741864f, 0.664183319f},
-std::array<float,2>{0.770044863f, 0.00278623239f},
-std::array<float,2>{0.119912192f, 0.332493782f},
-std::array<float,2>{0.725040317f, 0.811332822f},
-std::array<float,2>{0.033624284f, 0.618020892f},
-std::array<float,2>{0.660971463f, 0.221231654f},
-std::array<float,2>{0.416947305f, 0.417940468f},
-std::array<float,2>{0.847586393f, 0.966841161f},
-std::array<float,2>{0.329648584f, 0.871757865f},
-std::array<float,2>{0.991141558f, 0.270924538f},
-std::array<float,2>{0.214748457f, 0.0917509496f},
-std::array<float,2>{0.61481601f, 0.725626528f},
-std::array<float,2>{0.184138954f, 0.861372054f},
-std::array<float,2>{0.511088789f, 0.276799858f},
-std::array<float,2>{0.293778986f, 0.085057117f},
-std::array<float,2>{0.897926748f, 0.732783556f},
-std::array<float,2>{0.450090379f, 0.610118687f},
-std::array<float,2>{0.754759371f, 0.232504889f},
-std::array<float,2>{0.0979719311f, 0.410766006f},
-std::array<float,2>{0.735450745f, 0.953946829f},
-std::array<float,2>{0.0551586151f, 0.657705069f},
-std::array<float,2>{0.673850954f, 0.0140088657f},
-std::array<float,2>{0.427625239f, 0.343729883f},
-std::array<float,2>{0.869925439f, 0.799193919f},
-std::array<float,2>{0.324641168f, 0.892078102f},
-std::array<float,2>{0.97913897f, 0.482780278f},
-std::array<float,2>{0.200591713f, 0.135938823f},
-std::array<float,2>{0.59502399f, 0.517641366f},
-std::array<float,2>{0.0627885014f, 0.982468009f},
-std::array<float,2>{0.707204282f, 0.380182534f},
-std::array<float,2>{0.476284325f, 0.197749183f},
-std::array<float,2>{0.803612113f, 0.57326436f},
-std::array<float,2>{0.277585953f, 0.711346805f},
-std::array<float,2>{0.921882868f, 0.120208561f},
-std::array<float,2>{0.137249202f, 0.308873057f},
-std::array<float,2>{0.537675679f, 0.826860964f},
-std::array<float,2>{0.247725606f, 0.559241116f},
-std::array<float,2>{0.56331414f, 0.166659564f},
-std::array<float,2>{0.362171263f, 0.462097526f},
-std::array<float,2>{0.937993944f, 0.918519378f},
-std::array<float,2>{0.395826906f, 0.759993434f},
-std::array<float,2>{0.821695268f, 0.355718225f},
-std::array<float,2>{0.0215145946f, 0.0485292412f},
-std::array<float,2>{0.647232056f, 0.642479718f},
-std::array<float,2>{0.00952094421f, 0.793720067f},
-std::array<float,2>{0.638985455f, 0.323446721f},
-std::array<float,2>{0.375283629f, 0.0245849155f},
-std::array<float,2>{0.841139019f, 0.680127323f},
-std::array<float,2>{0.350811839f, 0.502501607f},
-std::array<float,2>{0.957841277f, 0.15367946f},
-std::array<float,2>{0.218971908f, 0.499354988f},
-std::array<float,2>{0.593581796f, 0.87725383f},
-std::array<float,2>{0.142695472f, 0.744206011f},
-std::array<float,2>{0.558397114f, 0.0768816099f},
-std::array<float,2>{0.25383994f, 0.261213362f},
-std::array<float,2>{0.909096837f, 0.857390642f},
-std::array<float,2>{0.497952908f, 0.938515663f},
-std::array<float,2>{0.788203657f, 0.436943173f},
-std::array<float,2>{0.0922803059f, 0.23859483f},
-std::array<float,2>{0.697666943f, 0.597332001f},
-std::array<float,2>{0.215548664f, 0.936643243f},
-std::array<float,2>{0.609489858f, 0.440204531f},
-std::array<float,2>{0.334110528f, 0.181533799f},
-std::array<float,2>{0.985810161f, 0.544910669f},
-std::array<float,2>{0.420653641f, 0.626107216f},
-std::array<float,2>{0.849525332f, 0.0417166799f},
-std::array<float,2>{0.0373125449f, 0.36265552f},
-std::array<float,2>{0.657995522f, 0.771146774f},
-std::array<float,2>{0.121808037f, 0.581408143f},
-std::array<float,2>{0.721496344f, 0.209069312f},
-std::array<float,2>{0.462524563f, 0.403005362f},
-std::array<float,2>{0.766890824f, 0.993039668f},
-std::array<float,2>{0.300913841f, 0.838293433f},
-std::array<float,2>{0.886337101f, 0.285630345f},
-std::array<float,2>{0.169964388f, 0.105265886f},
-std::array<float,2>{0.519778013f, 0.687626719f},
-std::array<float,2>{0.231151193f, 0.778416097f},
-std::array<float,2>{0.580607891f, 0.371950835f},
-std::array<float,2>{0.356696486f, 0.0329119861f},
-std::array<float,2>{0.964807034f, 0.64019841f},
-std::array<float,2>{0.385879964f, 0.534154654f},
-std::array<float,2>{0.832549095f, 0.177339688f},
-std::array<float,2>{0.00596155087f, 0.449984401f},
-std::array<float,2>{0.631613016f, 0.922489941f},
-std::array<float,2>{0.0856274739f, 0.701731384f},
-std::array<float,2>{0.691219747f, 0.0954931304f},
-std::array<float,2>{0.488093376f, 0.290584743f},
-std::array<float,2>{0.79074347f, 0.835302889f},
-std::array<float,2>{0.258552253f, 0.991271496f},
-std::array<float,2>{0.91707629f, 0.397375762f},
-std::array<float,2>{0.153192863f, 0.212642774f},
-std::array<float,2>{0.550868392f, 0.592516005f},
-std::array<float,2>{0.0410348102f, 0.88901931f},
-std::array<float,2>{0.671201169f, 0.490655243f},
-std::array<float,2>{0.411433697f, 0.147754997f},
-std::array<float,2>{0.858559728f, 0.512915432f},
-std::array<float,2>{0.339787245f, 0.676764846f},
-std::array<float,2>{0.998736382f, 0.0191932954f},
-std::array<float,2>{0.209904075f, 0.319791853f},
-std::array<float,2>{0.623547733f, 0.788102686f},
-std::array<float,2>{0.156530976f, 0.605576992f},
-std::array<float,2>{0.528176308f, 0.249635935f},
-std::array<float,2>{0.310458332f, 0.423483312f},
-std::array<float,2>{0.881898344f, 0.950438142f},
-std::array<float,2>{0.456647187f, 0.851305842f},
-std::array<float,2>{0.773773432f, 0.250004321f},
-std::array<float,2>{0.11545819f, 0.0676858947f},
-std::array<float,2>{0.733011961f, 0.740564346f},
-std::array<float,2>{0.105597131f, 0.819704294f},
-std::array<float,2>{0.744524002f, 0.298594475f},
-std::array<float,2>{0.444590598f, 0.112426676f},
-std::array<float,2>{0.76090014f, 0.705399096f},
-std::array<float,2>{0.289052039f, 0.565005004f},
-std::array<float,2>{0.898667336f, 0.192179501f},
-std::array<float,2>{0.173199788f, 0.389982641f},
-std::array<float,2>{0.500079989f, 0.973003864f},
-std::array<float,2>{0.194668069f, 0.656123638f},
-std::array<float,2>{0.602957726f, 0.0587897412f},
-std::array<float,2>{0.313144952f, 0.343858004f},
-std::array<float,2>{0.975331485f, 0.754243016f},
-std::array<float,2>{0.43338266f, 0.913757741f},
-std::array<float,2>{0.867157996f, 0.455260575f},
-std::array<float,2>{0.0471026525f, 0.163016021f},
-std::array<float,2>{0.685061932f, 0.548068345f},
-std::array<float,2>{0.127940312f, 0.961577058f},
-std::array<float,2>{0.54274708f, 0.418930471f},
-std::array<float,2>{0.269865692f, 0.22581622f},
-std::array<float,2>{0.931635737f, 0.624632895f},
-std::array<float,2>{0.481037736f, 0.720291376f},
-std::array<float,2>{0.807186127f, 0.0882460922f},
-std::array<float,2>{0.0706798062f, 0.268704623f},
-std::array<float,2>{0.717954397f, 0.867365181f},
-std::array<float,2>{0.0238210056f, 0.529443085f},
-std::array<float,2>{0.655651748f, 0.131386071f},
-std::array<float,2>{0.402635664f, 0.475623488f},
-std::array<float,2>{0.818439662f, 0.90513134f},
-std::array<float,2>{0.369463921f, 0.806483984f},
-std::array<float,2>{0.952470183f, 0.330814421f},
-std::array<float,2>{0.236886561f, 0.00577565702f},
-std::array<float,2>{0.570967972f, 0.668110669f},
-std::array<float,2>{0.163797617f, 0.761945844f},
-std::array<float,2>{0.525098503f, 0.351671159f},
-std::array<float,2>{0.304824799f, 0.051284574f},
-std::array<float,2>{0.876029849f, 0.646425545f},
-std::array<float,2>{0.457795739f, 0.557690382f},
-std::array<float,2>{0.780724883f, 0.168688223f},
-std::array<float,2>{0.112421215f, 0.466410875f},
-std::array<float,2>{0.729412913f, 0.916111052f},
-std::array<float,2>{0.045427613f, 0.716073096f},
-std::array<float,2>{0.664434254f, 0.122330196f},
-std::array<float,2>{0.407803595f, 0.305784166f},
-std::array<float,2>{0.851952434f, 0.820502579f},
-std::array<float,2>{0.342196733f, 0.977994859f},
-std::array<float,2>{0.994471192f, 0.377266407f},
-std::array<float,2>{0.205298513f, 0.202946424f},
-std::array<float,2>{0.619682133f, 0.576961696f},
-std::array<float,2>{0.0787532777f, 0.896678686f},
-std::array<float,2>{0.69371289f, 0.477489412f},
-std::array<float,2>{0.490538418f, 0.139125735f},
-std::array<float,2>{0.795667171f, 0.521406829f},
-std::array<float,2>{0.261842728f, 0.661264598f},
-std::array<float,2>{0.921693027f, 0.0105827581f},
-std::array<float,2>{0.149562031f, 0.339272141f},
-std::array<float,2>{0.548271835f, 0.801079988f},
-std::array<float,2>{0.226857945f, 0.613345683f},
-std::array<float,2>{0.585471451f, 0.22779429f},
-std::array<float,2>{0.354393154f, 0.409665287f},
-std::array<float,2>{0.966570914f, 0.958220184f},
-std::array<float,2>{0.386928469f, 0.865369201f},
-std::array<float,2>{0.828242898f, 0.280529559f},
-std::array<float,2>{0.0029977269f, 0.0818114504f},
-std::array<float,2>{0.626067758f, 0.728197455f},
-std::array<float,2>{0.028724445f, 0.841296732f},
-std::array<float,2>{0.651501417f, 0.284907669f},
-std::array<float,2>{0.401012868f, 0.108893953f},
-std::array<float,2>{0.816284537f, 0.691748798f},
-std::array<float,2>{0.372632533f, 0.584395409f},
-std::array<float,2>{0.947642326f, 0.206974015f},
-std::array<float,2>{0.241078869f, 0.398912668f},
-std::array<float,2>{0.574319184f, 0.997195423f},
-std::array<float,2>{0.131951988f, 0.632229149f},
-std::array<float,2>{0.54484427f, 0.0430725999f},
-std::array<float,2>{0.268420905f, 0.366886139f},
-std::array<float,2>{0.935556293f, 0.7661286f},
-std::array<float,2>{0.478798836f, 0.931840897f},
-std::array<float,2>{0.809722245f, 0.443568498f},
-std::array<float,2>{0.0748848096f, 0.186672285f},
-std::array<float,2>{0.712748647f, 0.539739072f},
-std::array<float,2>{0.191154018f, 0.941515446f},
-std::array<float,2>{0.608825207f, 0.431353658f},
-std::array<float,2>{0.319937438f, 0.235608876f},
-std::array<float,2>{0.969549894f, 0.598509133f},
-std::array<float,2>{0.43510747f, 0.746316731f},
-std::array<float,2>{0.859393716f, 0.072507225f},
-std::array<float,2>{0.0526514798f, 0.262429059f},
-std::array<float,2>{0.681257427f, 0.855270267f},
-std::array<float,2>{0.104151793f, 0.505962789f},
-std::array<float,2>{0.749250174f, 0.149040088f},
-std::array<float,2>{0.440237701f, 0.495323271f},
-std::array<float,2>{0.764457285f, 0.882777035f},
-std::array<float,2>{0.284223676f, 0.792408526f},
-std::array<float,2>{0.902968824f, 0.325713366f},
-std::array<float,2>{0.177943423f, 0.0289403852f},
-std::array<float,2>{0.506287456f, 0.685045898f},
-std::array<float,2>{0.244396105f, 0.847466052f},
-std::array<float,2>{0.566616714f, 0.255913198f},
-std::array<float,2>{0.363875449f, 0.0633265227f},
-std::array<float,2>{0.943867207f, 0.734483242f},
-std::array<float,2>{0.391750723f, 0.602080584f},
-std::array<float,2>{0.826821327f, 0.245708287f},
-std::array<float,2>{0.0184923075f, 0.426574707f},
-std::array<float,2>{0.644113421f, 0.947748601f},
-std::array<float,2>{0.0694769546f, 0.673334599f},
-std::array<float,2>{0.704187751f, 0.0211890861f},
-std::array<float,2>{0.46948573f, 0.3126643f},
-std::array<float,2>{0.798296213f, 0.782531381f},
-std::array<float,2>{0.273614854f, 0.883332014f},
-std::array<float,2>{0.927815616f, 0.484638512f},
-std::array<float,2>{0.134220123f, 0.142668277f},
-std::array<float,2>{0.532669306f, 0.508795381f},
-std::array<float,2>{0.0605006069f, 0.985758364f},
-std::array<float,2>{0.676742792f, 0.392335802f},
-std::array<float,2>{0.422172666f, 0.217330769f},
-std::array<float,2>{0.871458173f, 0.588904321f},
-std::array<float,2>{0.321959764f, 0.697235942f},
-std::array<float,2>{0.981483698f, 0.10090024f},
-std::array<float,2>{0.199070141f, 0.293598324f},
-std::array<float,2>{0.599984705f, 0.829496861f},
-std::array<float,2>{0.180416569f, 0.53629607f},
-std::array<float,2>{0.514454722f, 0.175637692f},
-std::array<float,2>{0.291082442f, 0.445359707f},
-std::array<float,2>{0.892610908f, 0.929003596f},
-std::array<float,2>{0.448066562f, 0.775460243f},
-std::array<float,2>{0.753257096f, 0.370313853f},
-std::array<float,2>{0.0953407884f, 0.0389272608f},
-std::array<float,2>{0.738314271f, 0.634363413f},
-std::array<float,2>{0.117909871f, 0.809998333f},
-std::array<float,2>{0.722890615f, 0.335624695f},
-std::array<float,2>{0.465884715f, 0.00016132943f},
-std::array<float,2>{0.772592425f, 0.666553378f},
-std::array<float,2>{0.299912095f, 0.525479555f},
-std::array<float,2>{0.888909578f, 0.127172574f},
-std::array<float,2>{0.164128125f, 0.469437152f},
-std::array<float,2>{0.519221902f, 0.899189413f},
-std::array<float,2>{0.212043256f, 0.723153293f},
-std::array<float,2>{0.615485251f, 0.093700245f},
-std::array<float,2>{0.331429303f, 0.27241841f},
-std::array<float,2>{0.989817619f, 0.874351263f},
-std::array<float,2>{0.415592521f, 0.966304839f},
-std::array<float,2>{0.844428062f, 0.414879292f},
-std::array<float,2>{0.0318287089f, 0.219389796f},
-std::array<float,2>{0.662831604f, 0.620204091f},
-std::array<float,2>{0.148270875f, 0.907561183f},
-std::array<float,2>{0.558773994f, 0.458247781f},
-std::array<float,2>{0.254404217f, 0.156917453f},
-std::array<float,2>{0.912185371f, 0.55313921f},
-std::array<float,2>{0.495702952f, 0.648778498f},
-std::array<float,2>{0.784641385f, 0.0553129576f},
-std::array<float,2>{0.085952118f, 0.348526061f},
-std::array<float,2>{0.699657917f, 0.750592709f},
-std::array<float,2>{0.0153963119f, 0.567594349f},
-std::array<float,2>{0.635260701f, 0.187836349f},
-std::array<float,2>{0.380976021f, 0.385462582f},
-std::array<float,2>{0.839784026f, 0.969175398f},
-std::array<float,2>{0.343754947f, 0.814796746f},
-std::array<float,2>{0.954440653f, 0.304451078f},
-std::array<float,2>{0.225728333f, 0.117120489f},
-std::array<float,2>{0.589759231f, 0.707548797f},
-std::array<float,2>{0.139192179f, 0.8251791f},
-std::array<float,2>{0.537073135f, 0.311297089f},
-std::array<float,2>{0.281215966f, 0.117885597f},
-std::array<float,2>{0.924284279f, 0.714342892f},
-std::array<float,2>{0.473611355f, 0.570414901f},
-std::array<float,2>{0.801159322f, 0.195461527f},
-std::array<float,2>{0.0661906525f, 0.382579952f},
-std::array<float,2>{0.710005343f, 0.982241869f},
-std::array<float,2>{0.0207004827f, 0.644016445f},
-std::array<float,2>{0.646366715f, 0.0499498211f},
-std::array<float,2>{0.397629082f, 0.35792917f},
-std::array<float,2>{0.822840869f, 0.758391678f},
-std::array<float,2>{0.360855818f, 0.921699584f},
-std::array<float,2>{0.93987149f, 0.464340538f},
-std::array<float,2>{0.249643311f, 0.16437912f},
-std::array<float,2>{0.565854132f, 0.561682403f},
-std::array<float,2>{0.100821979f, 0.956356823f},
-std::array<float,2>{0.73639822f, 0.412832171f},
-std::array<float,2>{0.451335818f, 0.232242778f},
-std::array<float,2>{0.756349385f, 0.612665653f},
-std::array<float,2>{0.295745462f, 0.731520474f},
-std::array<float,2>{0.896403253f, 0.0822655037f},
-std::array<float,2>{0.186518982f, 0.275052369f},
-std::array<float,2>{0.507943153f, 0.860061944f},
-std::array<float,2>{0.203007594f, 0.517167151f},
-std::array<float,2>{0.596831501f, 0.134548321f},
-std::array<float,2>{0.327766627f, 0.48224771f},
-std::array<float,2>{0.977348924f, 0.894342303f},
-std::array<float,2>{0.428196222f, 0.798396528f},
-std::array<float,2>{0.868099034f, 0.341179103f},
-std::array<float,2>{0.0574255437f, 0.011859661f},
-std::array<float,2>{0.673127949f, 0.658579767f},
-std::array<float,2>{0.0355254635f, 0.771806419f},
-std::array<float,2>{0.66004318f, 0.361225754f},
-std::array<float,2>{0.417993784f, 0.0400213301f},
-std::array<float,2>{0.850486636f, 0.627629399f},
-std::array<float,2>{0.332496047f, 0.545349598f},
-std::array<float,2>{0.986473143f, 0.182558894f},
-std::array<float,2>{0.217914432f, 0.439385355f},
-std::array<float,2>{0.612508833f, 0.934396744f},
-std::array<float,2>{0.169509619f, 0.689885616f},
-std::array<float,2>{0.522406518f, 0.101668403f},
-std::array<float,2>{0.302853256f, 0.288771957f},
-std::array<float,2>{0.884103119f, 0.836892843f},
-std::array<float,2>{0.463256508f, 0.994846106f},
-std::array<float,2>{0.768914521f, 0.404557645f},
-std::array<float,2>{0.123086199f, 0.207033962f},
-std::array<float,2>{0.719532192f, 0.578633845f},
-std::array<float,2>{0.221582502f, 0.875407934f},
-std::array<float,2>{0.591342509f, 0.496432871f},
-std::array<float,2>{0.348837793f, 0.155491278f},
-std::array<float,2>{0.96072793f, 0.501777411f},
-std::array<float,2>{0.378653646f, 0.683263898f},
-std::array<float,2>{0.842484415f, 0.0254018158f},
-std::array<float,2>{0.00983953848f, 0.321433038f},
-std::array<float,2>{0.638516665f, 0.795976281f},
-std::array<float,2>{0.0905572921f, 0.594246745f},
-std::array<float,2>{0.69689858f, 0.241270661f},
-std::array<float,2>{0.498242617f, 0.433673203f},
-std::array<float,2>{0.786314607f, 0.941361129f},
-std::array<float,2>{0.250225693f, 0.859063268f},
-std::array<float,2>{0.906638563f, 0.259051353f},
-std::array<float,2>{0.141224593f, 0.0756701007f},
-std::array<float,2>{0.555477381f, 0.744110227f},
-std::array<float,2>{0.208651274f, 0.786760807f},
-std::array<float,2>{0.621824622f, 0.317959934f},
-std::array<float,2>{0.336188763f, 0.0170089062f},
-std::array<float,2>{0.996999443f, 0.677916527f},
-std::array<float,2>{0.413859785f, 0.514934659f},
-std::array<float,2>{0.85665673f, 0.145428777f},
-std::array<float,2>{0.040708933f, 0.490005136f},
-std::array<float,2>{0.669374406f, 0.887208164f},
-std::array<float,2>{0.113430791f, 0.739068806f},
-std::array<float,2>{0.732192636f, 0.0689112023f},
-std::array<float,2>{0.453924268f, 0.253337324f},
-std::array<float,2>{0.77726537f, 0.849334478f},
-std::array<float,2>{0.312403142f, 0.952279508f},
-std::array<float,2>{0.879998028f, 0.425519377f},
-std::array<float,2>{0.159120843f, 0.246510208f},
-std::array<float,2>{0.529314697f, 0.607570469f},
-std::array<float,2>{0.00498399464f, 0.925281107f},
-std::array<float,2>{0.629184842f, 0.452242941f},
-std::array<float,2>{0.383553982f, 0.178234279f},
-std::array<float,2>{0.835766494f, 0.53264612f},
-std::array<float,2>{0.35805136f, 0.637321413f},
-std::array<float,2>{0.962352157f, 0.0350002386f},
-std::array<float,2>{0.232681021f, 0.374458045f},
-std::array<float,2>{0.580069602f, 0.781037509f},
-std::array<float,2>{0.155731067f, 0.591093242f},
-std::array<float,2>{0.554160833f, 0.214550912f},
-std::array<float,2>{0.260329932f, 0.395488709f},
-std::array<float,2>{0.914927423f, 0.988767445f},
-std::array<float,2>{0.486324191f, 0.832414746f},
-std::array<float,2>{0.7917431f, 0.291984648f},
-std::array<float,2>{0.0826947689f, 0.0959813967f},
-std::array<float,2>{0.688835561f, 0.70006299f},
-std::array<float,2>{0.0724496171f, 0.869644225f},
-std::array<float,2>{0.715424061f, 0.266561002f},
-std::array<float,2>{0.483027637f, 0.0862661079f},
-std::array<float,2>{0.80517298f, 0.721455455f},
-std::array<float,2>{0.27179864f, 0.62150532f},
-std::array<float,2>{0.931940854f, 0.222692341f},
-std::array<float,2>{0.12674889f, 0.421549827f},
-std::array<float,2>{0.541011274f, 0.963594019f},
-std::array<float,2>{0.234583393f, 0.670641243f},
-std::array<float,2>{0.573704302f, 0.00758732622f},
-std::array<float,2>{0.367892623f, 0.328629106f},
-std::array<float,2>{0.95003289f, 0.806707382f},
-std::array<float,2>{0.404888332f, 0.90283531f},
-std::array<float,2>{0.818195581f, 0.473991185f},
-std::array<float,2>{0.0258551873f, 0.12906532f},
-std::array<float,2>{0.653856754f, 0.527436733f},
-std::array<float,2>{0.175439119f, 0.975879371f},
-std::array<float,2>{0.502019107f, 0.388205647f},
-std::array<float,2>{0.28647235f, 0.194409519f},
-std::array<float,2>{0.902202785f, 0.564267993f},
-std::array<float,2>{0.442009985f, 0.704365909f},
-std::array<float,2>{0.759336948f, 0.11130476f},
-std::array<float,2>{0.108136795f, 0.29960835f},
-std::array<float,2>{0.742898822f, 0.817504764f},
-std::array<float,2>{0.0493771993f, 0.55020076f},
-std::array<float,2>{0.686343729f, 0.160211399f},
-std::array<float,2>{0.429912865f, 0.455041736f},
-std::array<float,2>{0.86512965f, 0.911914408f},
-std::array<float,2>{0.316209733f, 0.756263733f},
-std::array<float,2>{0.974239647f, 0.34621641f},
-std::array<float,2>{0.191531584f, 0.0607852042f},
-std::array<float,2>{0.603980064f, 0.654098988f},
-std::array<float,2>{0.138083339f, 0.758627951f},
-std::array<float,2>{0.538771152f, 0.358366936f},
-std::array<float,2>{0.27895245f, 0.0500623025f},
-std::array<float,2>{0.923066676f, 0.643684626f},
-std::array<float,2>{0.47496137f, 0.561948538f},
-std::array<float,2>{0.80419296f, 0.164077446f},
-std::array<float,2>{0.0642124638f, 0.464030921f},
-std::array<float,2>{0.70836854f, 0.921401322f},
-std::array<float,2>{0.0229934771f, 0.714072406f},
-std::array<float,2>{0.648140788f, 0.118143715f},
-std::array<float,2>{0.395265132f, 0.311197281f},
-std::array<float,2>{0.82113719f, 0.824866772f},
-std::array<float,2>{0.362896413f, 0.982150793f},
-std::array<float,2>{0.938808799f, 0.382464051f},
-std::array<float,2>{0.246600732f, 0.195766419f},
-std::array<float,2>{0.563897491f, 0.570683599f},
-std::array<float,2>{0.0996007398f, 0.894251406f},
-std::array<float,2>{0.735246897f, 0.481954634f},
-std::array<float,2>{0.450613022f, 0.13447164f},
-std::array<float,2>{0.755395114f, 0.51734376f},
-std::array<float,2>{0.294277757f, 0.658284903f},
-std::array<float,2>{0.896799147f, 0.0121382121f},
-std::array<float,2>{0.184915066f, 0.341059506f},
-std::array<float,2>{0.509826303f, 0.79866159f},
-std::array<float,2>{0.200172141f, 0.612514913f},
-std::array<float,2>{0.594620645f, 0.232169688f},
-std::array<float,2>{0.325735271f, 0.412951052f},
-std::array<float,2>{0.980013549f, 0.956159055f},
-std::array<float,2>{0.426640719f, 0.860147238f},
-std::array<float,2>{0.870184422f, 0.275152951f},
-std::array<float,2>{0.0557123125f, 0.0823346153f},
-std::array<float,2>{0.675312698f, 0.731888235f},
-std::array<float,2>{0.0383163355f, 0.836613476f},
-std::array<float,2>{0.656497657f, 0.289047867f},
-std::array<float,2>{0.420987666f, 0.101894088f},
-std::array<float,2>{0.847740769f, 0.689559221f},
-std::array<float,2>{0.335027277f, 0.579088032f},
-std::array<float,2>{0.985306799f, 0.207306668f},
-std::array<float,2>{0.216749072f, 0.404304534f},
-std::array<float,2>{0.610610604f, 0.995018601f},
-std::array<float,2>{0.171118364f, 0.627696037f},
-std::array<float,2>{0.52107054f, 0.0397320762f},
-std::array<float,2>{0.301924586f, 0.360943228f},
-std::array<float,2>{0.884793341f, 0.771712661f},
-std::array<float,2>{0.461075157f, 0.934163272f},
-std::array<float,2>{0.76621443f, 0.439103127f},
-std::array<float,2>{0.122804269f, 0.182280749f},
-std::array<float,2>{0.722583175f, 0.545005262f},
-std::array<float,2>{0.220216766f, 0.941064477f},
-std::array<float,2>{0.592743635f, 0.433939576f},
-std::array<float,2>{0.349921763f, 0.241641909f},
-std::array<float,2>{0.958848953f, 0.594632864f},
-std::array<float,2>{0.376340598f, 0.743679643f},
-std::array<float,2>{0.839901924f, 0.0754367113f},
-std::array<float,2>{0.00802069902f, 0.258957058f},
-std::array<float,2>{0.640497625f, 0.85936749f},
-std::array<float,2>{0.093478635f, 0.501600504f},
-std::array<float,2>{0.698758543f, 0.155696079f},
-std::array<float,2>{0.496794045f, 0.496290267f},
-std::array<float,2>{0.788004577f, 0.875234485f},
-std::array<float,2>{0.252300054f, 0.79620409f},
-std::array<float,2>{0.90971446f, 0.32167539f},
-std::array<float,2>{0.143739119f, 0.0257257707f},
-std::array<float,2>{0.556873679f, 0.68357724f},
-std::array<float,2>{0.210236475f, 0.849473357f},
-std::array<float,2>{0.624817073f, 0.253110409f},
-std::array<float,2>{0.338386714f, 0.0693334788f},
-std::array<float,2>{0.999437213f, 0.738941789f},
-std::array<float,2>{0.41020757f, 0.607820809f},
-std::array<float,2>{0.85815835f, 0.246318191f},
-std::array<float,2>{0.0421951413f, 0.425780028f},
-std::array<float,2>{0.670873225f, 0.952489972f},
-std::array<float,2>{0.116358019f, 0.67800504f},
-std::array<float,2>{0.734019101f, 0.0166842639f},
-std::array<float,2>{0.455809742f, 0.31818524f},
-std::array<float,2>{0.774983585f, 0.786997616f},
-std::array<float,2>{0.309400588f, 0.88768065f},
-std::array<float,2>{0.881652713f, 0.489904761f},
-std::array<float,2>{0.158060864f, 0.14509128f},
-std::array<float,2>{0.528797925f, 0.514676571f},
-std::array<float,2>{0.00763324089f, 0.988323569f},
-std::array<float,2>{0.632190704f, 0.395084292f},
-std::array<float,2>{0.385560304f, 0.214760378f},
-std::array<float,2>{0.833103657f, 0.591009319f},
-std::array<float,2>{0.355998874f, 0.699745893f},
-std::array<float,2>{0.963455617f, 0.0957268029f},
-std::array<float,2>{0.232076168f, 0.291566432f},
-std::array<float,2>{0.581874609f, 0.832177579f},
-std::array<float,2>{0.154024258f, 0.532278061f},
-std::array<float,2>{0.55180347f, 0.17868492f},
-std::array<float,2>{0.259142876f, 0.45261535f},
-std::array<float,2>{0.91690129f, 0.924905121f},
-std::array<float,2>{0.486602038f, 0.780953109f},
-std::array<float,2>{0.78979665f, 0.374254107f},
-std::array<float,2>{0.0841830224f, 0.0347345099f},
-std::array<float,2>{0.689510942f, 0.637455404f},
-std::array<float,2>{0.071725212f, 0.807033658f},
-std::array<float,2>{0.716799796f, 0.329025924f},
-std::array<float,2>{0.481970519f, 0.00739285909f},
-std::array<float,2>{0.808039308f, 0.670851827f},
-std::array<float,2>{0.270791054f, 0.527732551f},
-std::array<float,2>{0.929803371f, 0.129275486f},
-std::array<float,2>{0.127913818f, 0.473758101f},
-std::array<float,2>{0.541736603f, 0.903152108f},
-std::array<float,2>{0.238274679f, 0.721324444f},
-std::array<float,2>{0.571451783f, 0.0859932676f},
-std::array<float,2>{0.370995492f, 0.266165078f},
-std::array<float,2>{0.951978981f, 0.869880259f},
-std::array<float,2>{0.403987169f, 0.96377027f},
-std::array<float,2>{0.819550693f, 0.42181465f},
-std::array<float,2>{0.0247838292f, 0.223101869f},
-std::array<float,2>{0.654472828f, 0.621285379f},
-std::array<float,2>{0.172676042f, 0.911708653f},
-std::array<float,2>{0.501328051f, 0.454809934f},
-std::array<float,2>{0.287425011f, 0.160452172f},
-std::array<float,2>{0.900268018f, 0.550007582f},
-std::array<float,2>{0.443916887f, 0.653829336f},
-std::array<float,2>{0.760592639f, 0.0608244985f},
-std::array<float,2>{0.106841125f, 0.346586168f},
-std::array<float,2>{0.745802462f, 0.756095886f},
-std::array<float,2>{0.0480300225f, 0.5641101f},
-std::array<float,2>{0.684299409f, 0.194596589f},
-std::array<float,2>{0.431977898f, 0.388618976f},
-std::array<float,2>{0.866111338f, 0.975794852f},
-std::array<float,2>{0.314079553f, 0.817799985f},
-std::array<float,2>{0.97592479f, 0.29945305f},
-std::array<float,2>{0.194328368f, 0.110862784f},
-std::array<float,2>{0.601772904f, 0.704221427f},
-std::array<float,2>{0.160945714f, 0.820781887f},
-std::array<float,2>{0.527258873f, 0.305936664f},
-std::array<float,2>{0.307946771f, 0.122131765f},
-std::array<float,2>{0.877122581f, 0.715887427f},
-std::array<float,2>{0.459194362f, 0.576792121f},
-std::array<float,2>{0.778942227f, 0.202679172f},
-std::array<float,2>{0.110398792f, 0.376998752f},
-std::array<float,2>{0.727442145f, 0.977629721f},
-std::array<float,2>{0.0445913412f, 0.646064878f},
-std::array<float,2>{0.666507483f, 0.051554013f},
-std::array<float,2>{0.410081267f, 0.351886183f},
-std::array<float,2>{0.854775012f, 0.762085676f},
-std::array<float,2>{0.340795636f, 0.916401923f},
-std::array<float,2>{0.993549287f, 0.466794431f},
-std::array<float,2>{0.203931779f, 0.16890274f},
-std::array<float,2>{0.617357016f, 0.558029532f},
-std::array<float,2>{0.0808521733f, 0.958333969f},
-std::array<float,2>{0.691600919f, 0.409368277f},
-std::array<float,2>{0.489080876f, 0.227545097f},
-std::array<float,2>{0.794519126f, 0.613540173f},
-std::array<float,2>{0.263896883f, 0.728370547f},
-std::array<float,2>{0.918305755f, 0.0817477703f},
-std::array<float,2>{0.151319876f, 0.280399293f},
-std::array<float,2>{0.549262464f, 0.865501821f},
-std::array<float,2>{0.229455337f, 0.521035612f},
-std::array<float,2>{0.583251655f, 0.138678178f},
-std::array<float,2>{0.352627963f, 0.477235377f},
-std::array<float,2>{0.967222214f, 0.896945298f},
-std::array<float,2>{0.390147001f, 0.800940573f},
-std::array<float,2>{0.830714345f, 0.339013845f},
-std::array<float,2>{0.00123704725f, 0.0103022205f},
-std::array<float,2>{0.627101541f, 0.661396742f},
-std::array<float,2>{0.0307966657f, 0.766594946f},
-std::array<float,2>{0.648563623f, 0.367101789f},
-std::array<float,2>{0.40007937f, 0.0434394516f},
-std::array<float,2>{0.813310802f, 0.632076621f},
-std::array<float,2>{0.374104083f, 0.539854407f},
-std::array<float,2>{0.945476592f, 0.186970919f},
-std::array<float,2>{0.238689259f, 0.443687499f},
-std::array<float,2>{0.577193856f, 0.931931913f},
-std::array<float,2>{0.130351603f, 0.691587806f},
-std::array<float,2>{0.545062065f, 0.109181128f},
-std::array<float,2>{0.266560495f, 0.284973055f},
-std::array<float,2>{0.935535908f, 0.840869546f},
-std::array<float,2>{0.477761596f, 0.997406244f},
-std::array<float,2>{0.812014878f, 0.398521125f},
-std::array<float,2>{0.0762886107f, 0.206611484f},
-std::array<float,2>{0.713399291f, 0.583984792f},
-std::array<float,2>{0.18865788f, 0.882337868f},
-std::array<float,2>{0.605805933f, 0.495363474f},
-std::array<float,2>{0.318253309f, 0.149268776f},
-std::array<float,2>{0.9723894f, 0.506275177f},
-std::array<float,2>{0.436843455f, 0.684591651f},
-std::array<float,2>{0.862246811f, 0.0291104242f},
-std::array<float,2>{0.0543888547f, 0.326102346f},
-std::array<float,2>{0.682741702f, 0.792016029f},
-std::array<float,2>{0.102348804f, 0.598291695f},
-std::array<float,2>{0.746439338f, 0.235363841f},
-std::array<float,2>{0.438012898f, 0.431473732f},
-std::array<float,2>{0.761972547f, 0.9417454f},
-std::array<float,2>{0.281569123f, 0.855204225f},
-std::array<float,2>{0.905693948f, 0.26252833f},
-std::array<float,2>{0.176744327f, 0.0726563781f},
-std::array<float,2>{0.50551635f, 0.746507466f},
-std::array<float,2>{0.242610991f, 0.782455921f},
-std::array<float,2>{0.569592893f, 0.312796175f},
-std::array<float,2>{0.366325617f, 0.0212690271f},
-std::array<float,2>{0.942594171f, 0.673040986f},
-std::array<float,2>{0.392882675f, 0.509094298f},
-std::array<float,2>{0.825657427f, 0.142933756f},
-std::array<float,2>{0.0163801331f, 0.484521687f},
-std::array<float,2>{0.642401338f, 0.883687377f},
-std::array<float,2>{0.066476278f, 0.734667182f},
-std::array<float,2>{0.706394792f, 0.0629969835f},
-std::array<float,2>{0.470813096f, 0.256332844f},
-std::array<float,2>{0.799554765f, 0.847204387f},
-std::array<float,2>{0.27586031f, 0.947318077f},
-std::array<float,2>{0.926891267f, 0.426304102f},
-std::array<float,2>{0.135349855f, 0.245865449f},
-std::array<float,2>{0.534648716f, 0.602411091f},
-std::array<float,2>{0.0607326515f, 0.92889452f},
-std::array<float,2>{0.678860724f, 0.445624441f},
-std::array<float,2>{0.425346643f, 0.175448015f},
-std::array<float,2>{0.874945343f, 0.536462426f},
-std::array<float,2>{0.322686374f, 0.634691834f},
-std::array<float,2>{0.982503533f, 0.0387393571f},
-std::array<float,2>{0.196898028f, 0.370531827f},
-std::array<float,2>{0.599479914f, 0.775769293f},
-std::array<float,2>{0.182490259f, 0.589274883f},
-std::array<float,2>{0.513605416f, 0.217673481f},
-std::array<float,2>{0.290719479f, 0.392125398f},
-std::array<float,2>{0.890963137f, 0.985466659f},
-std::array<float,2>{0.446769655f, 0.829259038f},
-std::array<float,2>{0.750310063f, 0.293944836f},
-std::array<float,2>{0.0961605459f, 0.10073863f},
-std::array<float,2>{0.741950393f, 0.696988285f},
-std::array<float,2>{0.120604657f, 0.874214768f},
-std::array<float,2>{0.725891948f, 0.272207081f},
-std::array<float,2>{0.467273295f, 0.0932887644f},
-std::array<float,2>{0.770531356f, 0.723523438f},
-std::array<float,2>{0.298197299f, 0.620535791f},
-std::array<float,2>{0.88713485f, 0.219613135f},
-std::array<float,2>{0.167188749f, 0.414788514f},
-std::array<float,2>{0.516820788f, 0.965877116f},
-std::array<float,2>{0.213571399f, 0.666756868f},
-std::array<float,2>{0.613698661f, 0.000359144091f},
-std::array<float,2>{0.328594029f, 0.335730553f},
-std::array<float,2>{0.992079198f, 0.809643805f},
-std::array<float,2>{0.417582393f, 0.899070024f},
-std::array<float,2>{0.846256137f, 0.469624549f},
-std::array<float,2>{0.0349121168f, 0.127227738f},
-std::array<float,2>{0.6617347f, 0.525858343f},
-std::array<float,2>{0.145602152f, 0.968878329f},
-std::array<float,2>{0.56143266f, 0.385637283f},
-std::array<float,2>{0.256858736f, 0.187716722f},
-std::array<float,2>{0.911108255f, 0.567728281f},
-std::array<float,2>{0.492931545f, 0.707992077f},
-std::array<float,2>{0.781449258f, 0.116803363f},
-std::array<float,2>{0.0892054662f, 0.304391056f},
-std::array<float,2>{0.701946259f, 0.814528167f},
-std::array<float,2>{0.0118070059f, 0.552866936f},
-std::array<float,2>{0.633708298f, 0.157189965f},
-std::array<float,2>{0.380514771f, 0.458298028f},
-std::array<float,2>{0.836444795f, 0.907434046f},
-std::array<float,2>{0.346850216f, 0.750832915f},
-std::array<float,2>{0.955827951f, 0.348291755f},
-std::array<float,2>{0.222767293f, 0.0556017943f},
-std::array<float,2>{0.585980415f, 0.648594499f},
-std::array<float,2>{0.186709017f, 0.79886508f},
-std::array<float,2>{0.5088135f, 0.343403131f},
-std::array<float,2>{0.296042502f, 0.0138671715f},
-std::array<float,2>{0.894596219f, 0.657357931f},
-std::array<float,2>{0.452568114f, 0.517866731f},
-std::array<float,2>{0.756841779f, 0.136066705f},
-std::array<float,2>{0.100522861f, 0.482634872f},
-std::array<float,2>{0.738019526f, 0.891673863f},
-std::array<float,2>{0.0584623329f, 0.732627332f},
-std::array<float,2>{0.672435939f, 0.085247986f},
-std::array<float,2>{0.429581642f, 0.276407123f},
-std::array<float,2>{0.868272245f, 0.861726165f},
-std::array<float,2>{0.327099621f, 0.953828692f},
-std::array<float,2>{0.978317738f, 0.410969704f},
-std::array<float,2>{0.202064157f, 0.232733503f},
-std::array<float,2>{0.596578717f, 0.609925449f},
-std::array<float,2>{0.0647354349f, 0.918854058f},
-std::array<float,2>{0.709397614f, 0.462304026f},
-std::array<float,2>{0.47452727f, 0.166808769f},
-std::array<float,2>{0.80177331f, 0.559501469f},
-std::array<float,2>{0.279418349f, 0.642264068f},
-std::array<float,2>{0.925663888f, 0.0486205705f},
-std::array<float,2>{0.139913827f, 0.355576277f},
-std::array<float,2>{0.535863876f, 0.760249078f},
-std::array<float,2>{0.249002516f, 0.573493719f},
-std::array<float,2>{0.565047324f, 0.197326094f},
-std::array<float,2>{0.360233665f, 0.380117387f},
-std::array<float,2>{0.941102207f, 0.982832372f},
-std::array<float,2>{0.396911591f, 0.82702446f},
-std::array<float,2>{0.824181497f, 0.308638513f},
-std::array<float,2>{0.0204620566f, 0.120544165f},
-std::array<float,2>{0.645083845f, 0.71099937f},
-std::array<float,2>{0.0109625226f, 0.857124507f},
-std::array<float,2>{0.637155473f, 0.260884345f},
-std::array<float,2>{0.377436489f, 0.076971598f},
-std::array<float,2>{0.843407452f, 0.744605124f},
-std::array<float,2>{0.348281264f, 0.597452641f},
-std::array<float,2>{0.959597945f, 0.238289624f},
-std::array<float,2>{0.222333923f, 0.436554551f},
-std::array<float,2>{0.590252578f, 0.938828588f},
-std::array<float,2>{0.141672775f, 0.679752648f},
-std::array<float,2>{0.555766642f, 0.0248952415f},
-std::array<float,2>{0.25103721f, 0.323719591f},
-std::array<float,2>{0.907441199f, 0.793560684f},
-std::array<float,2>{0.499272346f, 0.877144158f},
-std::array<float,2>{0.785684049f, 0.499198526f},
-std::array<float,2>{0.0913228318f, 0.153535485f},
-std::array<float,2>{0.696032107f, 0.502802789f},
-std::array<float,2>{0.217104211f, 0.992841303f},
-std::array<float,2>{0.611380219f, 0.403082222f},
-std::array<float,2>{0.333690673f, 0.209303916f},
-std::array<float,2>{0.987606645f, 0.581114948f},
-std::array<float,2>{0.419842571f, 0.687771797f},
-std::array<float,2>{0.850947678f, 0.10498368f},
-std::array<float,2>{0.0367057659f, 0.285398364f},
-std::array<float,2>{0.658488095f, 0.838113844f},
-std::array<float,2>{0.124487691f, 0.544641316f},
-std::array<float,2>{0.719966352f, 0.181298316f},
-std::array<float,2>{0.464091897f, 0.440152258f},
-std::array<float,2>{0.767652631f, 0.936828315f},
-std::array<float,2>{0.304099947f, 0.771299124f},
-std::array<float,2>{0.883387923f, 0.362382919f},
-std::array<float,2>{0.168119997f, 0.041772835f},
-std::array<float,2>{0.522712767f, 0.626456022f},
-std::array<float,2>{0.233814836f, 0.835107863f},
-std::array<float,2>{0.578634143f, 0.290874243f},
-std::array<float,2>{0.35852626f, 0.095388189f},
-std::array<float,2>{0.961002529f, 0.702040076f},
-std::array<float,2>{0.384071231f, 0.592583716f},
-std::array<float,2>{0.834038556f, 0.212785676f},
-std::array<float,2>{0.00460161036f, 0.397183418f},
-std::array<float,2>{0.629988194f, 0.991633832f},
-std::array<float,2>{0.0832844675f, 0.640533566f},
-std::array<float,2>{0.68827492f, 0.0329717137f},
-std::array<float,2>{0.485257089f, 0.371586859f},
-std::array<float,2>{0.792235374f, 0.778664649f},
-std::array<float,2>{0.261271954f, 0.922658443f},
-std::array<float,2>{0.915323853f, 0.449799329f},
-std::array<float,2>{0.154460102f, 0.177654013f},
-std::array<float,2>{0.55278033f, 0.533890843f},
-std::array<float,2>{0.039279718f, 0.950471342f},
-std::array<float,2>{0.668815911f, 0.423776686f},
-std::array<float,2>{0.412699223f, 0.249958038f},
-std::array<float,2>{0.856010318f, 0.605786562f},
-std::array<float,2>{0.337696314f, 0.740367949f},
-std::array<float,2>{0.99791038f, 0.0674714148f},
-std::array<float,2>{0.207663909f, 0.25039807f},
-std::array<float,2>{0.622398496f, 0.851356447f},
-std::array<float,2>{0.159483686f, 0.512988389f},
-std::array<float,2>{0.530618906f, 0.14762491f},
-std::array<float,2>{0.31144616f, 0.490379006f},
-std::array<float,2>{0.8794837f, 0.888745427f},
-std::array<float,2>{0.45466727f, 0.788413882f},
-std::array<float,2>{0.775643229f, 0.319450289f},
-std::array<float,2>{0.115110748f, 0.0194630101f},
-std::array<float,2>{0.730557919f, 0.677233517f},
-std::array<float,2>{0.108547755f, 0.754092634f},
-std::array<float,2>{0.743173838f, 0.344231516f},
-std::array<float,2>{0.443140119f, 0.0590470806f},
-std::array<float,2>{0.758495152f, 0.655998051f},
-std::array<float,2>{0.285643429f, 0.548241794f},
-std::array<float,2>{0.900413513f, 0.162697762f},
-std::array<float,2>{0.174471885f, 0.455412924f},
-std::array<float,2>{0.503720284f, 0.913859129f},
-std::array<float,2>{0.192389175f, 0.705189049f},
-std::array<float,2>{0.604932189f, 0.112653643f},
-std::array<float,2>{0.314789146f, 0.298340827f},
-std::array<float,2>{0.972914398f, 0.819547892f},
-std::array<float,2>{0.431399077f, 0.972898185f},
-std::array<float,2>{0.863975227f, 0.389813066f},
-std::array<float,2>{0.0507637635f, 0.192050219f},
-std::array<float,2>{0.687327206f, 0.56535697f},
-std::array<float,2>{0.125188798f, 0.904954851f},
-std::array<float,2>{0.539296508f, 0.475956738f},
-std::array<float,2>{0.273038536f, 0.131659552f},
-std::array<float,2>{0.9326424f, 0.529741168f},
-std::array<float,2>{0.483904243f, 0.66841948f},
-std::array<float,2>{0.806248665f, 0.0054456112f},
-std::array<float,2>{0.0738021359f, 0.330639422f},
-std::array<float,2>{0.716443837f, 0.806370199f},
-std::array<float,2>{0.0272233561f, 0.624800563f},
-std::array<float,2>{0.653203547f, 0.225956514f},
-std::array<float,2>{0.405974418f, 0.418592304f},
-std::array<float,2>{0.817000508f, 0.961734116f},
-std::array<float,2>{0.368269503f, 0.867453396f},
-std::array<float,2>{0.950661182f, 0.268877208f},
-std::array<float,2>{0.235625982f, 0.0879771113f},
-std::array<float,2>{0.572476208f, 0.720541358f},
-std::array<float,2>{0.14923659f, 0.863799334f},
-std::array<float,2>{0.546931326f, 0.2781744f},
-std::array<float,2>{0.262781054f, 0.0782291964f},
-std::array<float,2>{0.920588851f, 0.730091214f},
-std::array<float,2>{0.491378993f, 0.615493417f},
-std::array<float,2>{0.795981109f, 0.230282262f},
-std::array<float,2>{0.0799359903f, 0.407258451f},
-std::array<float,2>{0.69510752f, 0.960718989f},
-std::array<float,2>{0.00259566936f, 0.663622797f},
-std::array<float,2>{0.625623703f, 0.00940514915f},
-std::array<float,2>{0.388089627f, 0.33711338f},
-std::array<float,2>{0.829740107f, 0.803548753f},
-std::array<float,2>{0.355157435f, 0.894834578f},
-std::array<float,2>{0.965351999f, 0.479432106f},
-std::array<float,2>{0.2285133f, 0.137602761f},
-std::array<float,2>{0.584945142f, 0.522488296f},
-std::array<float,2>{0.111494057f, 0.979251027f},
-std::array<float,2>{0.729851484f, 0.376070499f},
-std::array<float,2>{0.458522528f, 0.200343296f},
-std::array<float,2>{0.779451549f, 0.575641334f},
-std::array<float,2>{0.305903256f, 0.717848957f},
-std::array<float,2>{0.875824988f, 0.123421773f},
-std::array<float,2>{0.162890419f, 0.30736208f},
-std::array<float,2>{0.524336338f, 0.823661029f},
-std::array<float,2>{0.206632435f, 0.555909097f},
-std::array<float,2>{0.620922267f, 0.170754164f},
-std::array<float,2>{0.342933834f, 0.468703866f},
-std::array<float,2>{0.996015847f, 0.914726079f},
-std::array<float,2>{0.406533092f, 0.764858425f},
-std::array<float,2>{0.852694511f, 0.355196238f},
-std::array<float,2>{0.0467992611f, 0.0531221405f},
-std::array<float,2>{0.665559173f, 0.648204982f},
-std::array<float,2>{0.0514735468f, 0.79003495f},
-std::array<float,2>{0.679952025f, 0.327868313f},
-std::array<float,2>{0.433931381f, 0.0303244051f},
-std::array<float,2>{0.860553086f, 0.687167227f},
-std::array<float,2>{0.318886697f, 0.505461574f},
-std::array<float,2>{0.970246017f, 0.151202902f},
-std::array<float,2>{0.189645976f, 0.493791729f},
-std::array<float,2>{0.608109236f, 0.88020581f},
-std::array<float,2>{0.178816423f, 0.749832451f},
-std::array<float,2>{0.507434309f, 0.0716672391f},
-std::array<float,2>{0.283945739f, 0.264612794f},
-std::array<float,2>{0.904188871f, 0.851823211f},
-std::array<float,2>{0.440672725f, 0.944534838f},
-std::array<float,2>{0.765064597f, 0.433400333f},
-std::array<float,2>{0.10518688f, 0.236817062f},
-std::array<float,2>{0.748490572f, 0.601267695f},
-std::array<float,2>{0.241439551f, 0.930738866f},
-std::array<float,2>{0.575232983f, 0.442397594f},
-std::array<float,2>{0.371891588f, 0.184876814f},
-std::array<float,2>{0.949175358f, 0.542956352f},
-std::array<float,2>{0.402194351f, 0.629438996f},
-std::array<float,2>{0.815046549f, 0.0453685857f},
-std::array<float,2>{0.0278081093f, 0.363936961f},
-std::array<float,2>{0.650896072f, 0.768468738f},
-std::array<float,2>{0.0758084431f, 0.582079351f},
-std::array<float,2>{0.711723864f, 0.204341725f},
-std::array<float,2>{0.480307788f, 0.40042153f},
-std::array<float,2>{0.809306681f, 0.999538779f},
-std::array<float,2>{0.269210726f, 0.842352629f},
-std::array<float,2>{0.936596274f, 0.281457931f},
-std::array<float,2>{0.131138548f, 0.106823988f},
-std::array<float,2>{0.543456852f, 0.694274843f},
-std::array<float,2>{0.198002741f, 0.77532804f},
-std::array<float,2>{0.601095855f, 0.367370427f},
-std::array<float,2>{0.320344567f, 0.0363919958f},
-std::array<float,2>{0.981373787f, 0.635683239f},
-std::array<float,2>{0.423137695f, 0.537375808f},
-std::array<float,2>{0.87211597f, 0.172969148f},
-std::array<float,2>{0.0590755381f, 0.448297083f},
-std::array<float,2>{0.677120984f, 0.925934196f},
-std::array<float,2>{0.0942717046f, 0.699046254f},
-std::array<float,2>{0.74014914f, 0.0980261415f},
-std::array<float,2>{0.448764265f, 0.296631753f},
-std::array<float,2>{0.752814412f, 0.830825329f},
-std::array<float,2>{0.292818785f, 0.987903059f},
-std::array<float,2>{0.893867493f, 0.394166678f},
-std::array<float,2>{0.180841938f, 0.216179356f},
-std::array<float,2>{0.514903605f, 0.586572289f},
-std::array<float,2>{0.0192404445f, 0.885648429f},
-std::array<float,2>{0.6430372f, 0.487600565f},
-std::array<float,2>{0.391050875f, 0.141284183f},
-std::array<float,2>{0.82722342f, 0.510269284f},
-std::array<float,2>{0.364259094f, 0.675763309f},
-std::array<float,2>{0.944694817f, 0.0222644415f},
-std::array<float,2>{0.245302662f, 0.315670401f},
-std::array<float,2>{0.567773461f, 0.785136223f},
-std::array<float,2>{0.133160219f, 0.605038941f},
-std::array<float,2>{0.53144455f, 0.243650839f},
-std::array<float,2>{0.275143981f, 0.42924884f},
-std::array<float,2>{0.929213166f, 0.945457578f},
-std::array<float,2>{0.470554709f, 0.845341921f},
-std::array<float,2>{0.797373831f, 0.255349845f},
-std::array<float,2>{0.0684143528f, 0.0661925673f},
-std::array<float,2>{0.703832507f, 0.738157451f},
-std::array<float,2>{0.0878518969f, 0.812739789f},
-std::array<float,2>{0.700413585f, 0.302585751f},
-std::array<float,2>{0.494884878f, 0.114070319f},
-std::array<float,2>{0.783836186f, 0.710182488f},
-std::array<float,2>{0.25566116f, 0.568754315f},
-std::array<float,2>{0.913311839f, 0.190769061f},
-std::array<float,2>{0.146924078f, 0.384572625f},
-std::array<float,2>{0.560533464f, 0.971125543f},
-std::array<float,2>{0.224816531f, 0.650853157f},
-std::array<float,2>{0.58847928f, 0.0582012683f},
-std::array<float,2>{0.345568717f, 0.349868536f},
-std::array<float,2>{0.953625321f, 0.753350496f},
-std::array<float,2>{0.382116884f, 0.908765435f},
-std::array<float,2>{0.838550866f, 0.460810721f},
-std::array<float,2>{0.013798574f, 0.158799306f},
-std::array<float,2>{0.636069894f, 0.551958859f},
-std::array<float,2>{0.165720701f, 0.967147827f},
-std::array<float,2>{0.518247366f, 0.41751945f},
-std::array<float,2>{0.299021482f, 0.221545696f},
-std::array<float,2>{0.890391052f, 0.617863834f},
-std::array<float,2>{0.46522212f, 0.726022661f},
-std::array<float,2>{0.771842182f, 0.091456987f},
-std::array<float,2>{0.118506126f, 0.270702362f},
-std::array<float,2>{0.724604309f, 0.871981025f},
-std::array<float,2>{0.0324581936f, 0.525047362f},
-std::array<float,2>{0.663717449f, 0.126043811f},
-std::array<float,2>{0.414888501f, 0.472522289f},
-std::array<float,2>{0.845424175f, 0.900795817f},
-std::array<float,2>{0.330776602f, 0.811111808f},
-std::array<float,2>{0.988935471f, 0.33225897f},
-std::array<float,2>{0.211859167f, 0.00249069394f},
-std::array<float,2>{0.617048979f, 0.664449632f},
-std::array<float,2>{0.143508002f, 0.794686139f},
-std::array<float,2>{0.557892323f, 0.323077053f},
-std::array<float,2>{0.253112912f, 0.0236862767f},
-std::array<float,2>{0.908547997f, 0.680968344f},
-std::array<float,2>{0.497216254f, 0.503644705f},
-std::array<float,2>{0.789059103f, 0.152805671f},
-std::array<float,2>{0.0924912319f, 0.498368442f},
-std::array<float,2>{0.698221385f, 0.87794131f},
-std::array<float,2>{0.00903063826f, 0.745978475f},
-std::array<float,2>{0.639407933f, 0.0774884224f},
-std::array<float,2>{0.375639796f, 0.260489613f},
-std::array<float,2>{0.841535807f, 0.856238186f},
-std::array<float,2>{0.351436049f, 0.937833726f},
-std::array<float,2>{0.957061708f, 0.435578585f},
-std::array<float,2>{0.219338432f, 0.239777461f},
-std::array<float,2>{0.592818558f, 0.596184015f},
-std::array<float,2>{0.121196292f, 0.936058879f},
-std::array<float,2>{0.721029103f, 0.440936595f},
-std::array<float,2>{0.462201834f, 0.180130184f},
-std::array<float,2>{0.767221332f, 0.543792129f},
-std::array<float,2>{0.301322073f, 0.625307024f},
-std::array<float,2>{0.885926485f, 0.0420755036f},
-std::array<float,2>{0.170820117f, 0.361815035f},
-std::array<float,2>{0.520154953f, 0.770060956f},
-std::array<float,2>{0.215319276f, 0.58091563f},
-std::array<float,2>{0.610182345f, 0.21048525f},
-std::array<float,2>{0.334718943f, 0.403429657f},
-std::array<float,2>{0.986105144f, 0.993427992f},
-std::array<float,2>{0.420069635f, 0.839617491f},
-std::array<float,2>{0.848855138f, 0.286741644f},
-std::array<float,2>{0.0377104655f, 0.104191333f},
-std::array<float,2>{0.657605767f, 0.689302683f},
-std::array<float,2>{0.0553852208f, 0.862435341f},
-std::array<float,2>{0.674572527f, 0.276100963f},
-std::array<float,2>{0.426812291f, 0.0848684758f},
-std::array<float,2>{0.869390905f, 0.734301448f},
-std::array<float,2>{0.324832797f, 0.610850036f},
-std::array<float,2>{0.978557169f, 0.234282061f},
-std::array<float,2>{0.200864956f, 0.411380708f},
-std::array<float,2>{0.595643878f, 0.954567373f},
-std::array<float,2>{0.183623955f, 0.656528473f},
-std::array<float,2>{0.511244833f, 0.0153771434f},
-std::array<float,2>{0.293399483f, 0.34236753f},
-std::array<float,2>{0.898067176f, 0.800304651f},
-std::array<float,2>{0.449451357f, 0.891183257f},
-std::array<float,2>{0.75415647f, 0.483546734f},
-std::array<float,2>{0.0983711407f, 0.134990856f},
-std::array<float,2>{0.73608315f, 0.518685699f},
-std::array<float,2>{0.24732706f, 0.984120369f},
-std::array<float,2>{0.562922597f, 0.378989398f},
-std::array<float,2>{0.361549824f, 0.198411942f},
-std::array<float,2>{0.937632084f, 0.57287395f},
-std::array<float,2>{0.396046579f, 0.712593675f},
-std::array<float,2>{0.82217586f, 0.119793616f},
-std::array<float,2>{0.0221164413f, 0.309961736f},
-std::array<float,2>{0.646775126f, 0.827836275f},
-std::array<float,2>{0.0632233173f, 0.56023711f},
-std::array<float,2>{0.707606018f, 0.167929515f},
-std::array<float,2>{0.475879312f, 0.461728275f},
-std::array<float,2>{0.802947283f, 0.919742942f},
-std::array<float,2>{0.277851969f, 0.761109173f},
-std::array<float,2>{0.922716439f, 0.3571814f},
-std::array<float,2>{0.137131736f, 0.0469746441f},
-std::array<float,2>{0.537177026f, 0.641470492f},
-std::array<float,2>{0.195020884f, 0.819330633f},
-std::array<float,2>{0.6032691f, 0.297669291f},
-std::array<float,2>{0.312802792f, 0.111691453f},
-std::array<float,2>{0.974700809f, 0.706464231f},
-std::array<float,2>{0.433093846f, 0.565585554f},
-std::array<float,2>{0.866485715f, 0.193049043f},
-std::array<float,2>{0.047750935f, 0.38892585f},
-std::array<float,2>{0.684631467f, 0.974182367f},
-std::array<float,2>{0.106055297f, 0.655195117f},
-std::array<float,2>{0.744673669f, 0.0604786165f},
-std::array<float,2>{0.445264578f, 0.344898701f},
-std::array<float,2>{0.761399031f, 0.755080342f},
-std::array<float,2>{0.288147688f, 0.912827551f},
-std::array<float,2>{0.898993194f, 0.456066251f},
-std::array<float,2>{0.173599824f, 0.163244024f},
-std::array<float,2>{0.500706673f, 0.547829509f},
-std::array<float,2>{0.0241729617f, 0.962243617f},
-std::array<float,2>{0.65602684f, 0.419230968f},
-std::array<float,2>{0.403068334f, 0.225544393f},
-std::array<float,2>{0.819048226f, 0.623745441f},
-std::array<float,2>{0.370004565f, 0.719498277f},
-std::array<float,2>{0.952924073f, 0.0890841708f},
-std::array<float,2>{0.236774206f, 0.2676121f},
-std::array<float,2>{0.570683658f, 0.86869365f},
-std::array<float,2>{0.128589392f, 0.530560672f},
-std::array<float,2>{0.542024851f, 0.132338345f},
-std::array<float,2>{0.270381153f, 0.475417078f},
-std::array<float,2>{0.930856764f, 0.906023622f},
-std::array<float,2>{0.480770558f, 0.804730952f},
-std::array<float,2>{0.807019889f, 0.331734627f},
-std::array<float,2>{0.0708944201f, 0.00432183035f},
-std::array<float,2>{0.718461931f, 0.669788957f},
-std::array<float,2>{0.0852517486f, 0.778060377f},
-std::array<float,2>{0.690809488f, 0.372241467f},
-std::array<float,2>{0.487361014f, 0.0316454247f},
-std::array<float,2>{0.790072918f, 0.639008045f},
-std::array<float,2>{0.258106679f, 0.535075128f},
-std::array<float,2>{0.917644441f, 0.175875038f},
-std::array<float,2>{0.152582645f, 0.450945437f},
-std::array<float,2>{0.551539838f, 0.923421502f},
-std::array<float,2>{0.230598181f, 0.702970684f},
-std::array<float,2>{0.580171227f, 0.0943207964f},
-std::array<float,2>{0.357067823f, 0.289710164f},
-std::array<float,2>{0.963873923f, 0.83475399f},
-std::array<float,2>{0.386436105f, 0.991076589f},
-std::array<float,2>{0.83246845f, 0.398140222f},
-std::array<float,2>{0.00646652374f, 0.211883545f},
-std::array<float,2>{0.63092792f, 0.593258023f},
-std::array<float,2>{0.157110423f, 0.889686882f},
-std::array<float,2>{0.527555287f, 0.491864949f},
-std::array<float,2>{0.309973031f, 0.146996692f},
-std::array<float,2>{0.882445693f, 0.511919618f},
-std::array<float,2>{0.456184715f, 0.676163316f},
-std::array<float,2>{0.774134874f, 0.0181085039f},
-std::array<float,2>{0.115812406f, 0.318977833f},
-std::array<float,2>{0.732734382f, 0.787818551f},
-std::array<float,2>{0.0419377722f, 0.607339859f},
-std::array<float,2>{0.671718538f, 0.248875886f},
-std::array<float,2>{0.412096769f, 0.422085136f},
-std::array<float,2>{0.859315813f, 0.949956f},
-std::array<float,2>{0.339159399f, 0.850037813f},
-std::array<float,2>{0.99816674f, 0.250979632f},
-std::array<float,2>{0.209164724f, 0.0672608688f},
-std::array<float,2>{0.623463869f, 0.742090464f},
-std::array<float,2>{0.177003935f, 0.852920115f},
-std::array<float,2>{0.5040223f, 0.265539348f},
-std::array<float,2>{0.28234303f, 0.0704741776f},
-std::array<float,2>{0.904430568f, 0.748739481f},
-std::array<float,2>{0.439173937f, 0.600095212f},
-std::array<float,2>{0.763486207f, 0.238069534f},
-std::array<float,2>{0.10263367f, 0.431764811f},
-std::array<float,2>{0.747493327f, 0.944026172f},
-std::array<float,2>{0.0536695495f, 0.686269164f},
-std::array<float,2>{0.682493627f, 0.0301209595f},
-std::array<float,2>{0.436080456f, 0.32682699f},
-std::array<float,2>{0.86237514f, 0.790481806f},
-std::array<float,2>{0.316835314f, 0.879047155f},
-std::array<float,2>{0.971038163f, 0.492888331f},
-std::array<float,2>{0.187914968f, 0.152330652f},
-std::array<float,2>{0.607297242f, 0.504546344f},
-std::array<float,2>{0.0772875845f, 0.998447657f},
-std::array<float,2>{0.714528978f, 0.401472449f},
-std::array<float,2>{0.477394998f, 0.203663111f},
-std::array<float,2>{0.811048329f, 0.583472431f},
-std::array<float,2>{0.267512858f, 0.694520354f},
-std::array<float,2>{0.934371889f, 0.1055241f},
-std::array<float,2>{0.129738778f, 0.282732099f},
-std::array<float,2>{0.546190262f, 0.843683958f},
-std::array<float,2>{0.239489466f, 0.541044772f},
-std::array<float,2>{0.576289058f, 0.184003934f},
-std::array<float,2>{0.373451054f, 0.441672832f},
-std::array<float,2>{0.946619391f, 0.930371642f},
-std::array<float,2>{0.398647219f, 0.76917547f},
-std::array<float,2>{0.814026177f, 0.365153462f},
-std::array<float,2>{0.0299762934f, 0.046509929f},
-std::array<float,2>{0.650279164f, 0.630533576f},
-std::array<float,2>{0.000910932315f, 0.803789794f},
-std::array<float,2>{0.628125787f, 0.336125135f},
-std::array<float,2>{0.388764292f, 0.00876833592f},
-std::array<float,2>{0.831870496f, 0.662777126f},
-std::array<float,2>{0.352382869f, 0.52243191f},
-std::array<float,2>{0.96825093f, 0.138286799f},
-std::array<float,2>{0.230254456f, 0.479702204f},
-std::array<float,2>{0.582230568f, 0.895614445f},
-std::array<float,2>{0.152105346f, 0.728800714f},
-std::array<float,2>{0.549901962f, 0.0794161186f},
-std::array<float,2>{0.265493691f, 0.279262275f},
-std::array<float,2>{0.919273973f, 0.864911079f},
-std::array<float,2>{0.489896148f, 0.959386706f},
-std::array<float,2>{0.793279171f, 0.40686208f},
-std::array<float,2>{0.0811494887f, 0.228990346f},
-std::array<float,2>{0.693286955f, 0.616696179f},
-std::array<float,2>{0.204815581f, 0.915159941f},
-std::array<float,2>{0.618795156f, 0.467519641f},
-std::array<float,2>{0.340894639f, 0.171177804f},
-std::array<float,2>{0.992272615f, 0.554720521f},
-std::array<float,2>{0.4084436f, 0.646999359f},
-std::array<float,2>{0.853660703f, 0.054137066f},
-std::array<float,2>{0.0429856032f, 0.354435205f},
-std::array<float,2>{0.667637467f, 0.764142096f},
-std::array<float,2>{0.10947068f, 0.574439347f},
-std::array<float,2>{0.728390753f, 0.199341208f},
-std::array<float,2>{0.460713863f, 0.37565428f},
-std::array<float,2>{0.777510226f, 0.979968309f},
-std::array<float,2>{0.307201028f, 0.822663844f},
-std::array<float,2>{0.878873467f, 0.307755798f},
-std::array<float,2>{0.161696091f, 0.124954261f},
-std::array<float,2>{0.525462568f, 0.717522144f},
-std::array<float,2>{0.223864228f, 0.752315044f},
-std::array<float,2>{0.587297261f, 0.350642264f},
-std::array<float,2>{0.346150875f, 0.0575999394f},
-std::array<float,2>{0.956635654f, 0.652026296f},
-std::array<float,2>{0.379007965f, 0.55086112f},
-std::array<float,2>{0.837840259f, 0.159564093f},
-std::array<float,2>{0.0131500131f, 0.45918414f},
-std::array<float,2>{0.634354055f, 0.909309924f},
-std::array<float,2>{0.0883881524f, 0.709860325f},
-std::array<float,2>{0.702284575f, 0.114705414f},
-std::array<float,2>{0.49339664f, 0.300897747f},
-std::array<float,2>{0.782992363f, 0.814039648f},
-std::array<float,2>{0.256694853f, 0.97200352f},
-std::array<float,2>{0.911778152f, 0.383498877f},
-std::array<float,2>{0.144865945f, 0.190035537f},
-std::array<float,2>{0.562036514f, 0.570180178f},
-std::array<float,2>{0.0339911319f, 0.9023f},
-std::array<float,2>{0.660196126f, 0.470934212f},
-std::array<float,2>{0.416325241f, 0.125738367f},
-std::array<float,2>{0.846704006f, 0.524189711f},
-std::array<float,2>{0.329280585f, 0.665208876f},
-std::array<float,2>{0.99070859f, 0.00302442024f},
-std::array<float,2>{0.214051947f, 0.333211839f},
-std::array<float,2>{0.614344716f, 0.811611056f},
-std::array<float,2>{0.166862607f, 0.618476331f},
-std::array<float,2>{0.516208827f, 0.222370058f},
-std::array<float,2>{0.297107369f, 0.416618258f},
-std::array<float,2>{0.888300896f, 0.967879713f},
-std::array<float,2>{0.46805492f, 0.872616887f},
-std::array<float,2>{0.769732893f, 0.269689322f},
-std::array<float,2>{0.119623818f, 0.0902217999f},
-std::array<float,2>{0.725396872f, 0.725409031f},
-std::array<float,2>{0.0971721187f, 0.831434309f},
-std::array<float,2>{0.740859032f, 0.294989377f},
-std::array<float,2>{0.4458749f, 0.0991775021f},
-std::array<float,2>{0.751361609f, 0.697427392f},
-std::array<float,2>{0.289982826f, 0.586925328f},
-std::array<float,2>{0.892499089f, 0.21510236f},
-std::array<float,2>{0.182669923f, 0.393359333f},
-std::array<float,2>{0.511867404f, 0.987216473f},
-std::array<float,2>{0.196118116f, 0.636477768f},
-std::array<float,2>{0.597827196f, 0.0351793692f},
-std::array<float,2>{0.323873311f, 0.368186682f},
-std::array<float,2>{0.984079242f, 0.774315f},
-std::array<float,2>{0.424794197f, 0.927309453f},
-std::array<float,2>{0.873702407f, 0.448178887f},
-std::array<float,2>{0.0622398816f, 0.172370657f},
-std::array<float,2>{0.67782414f, 0.538524687f},
-std::array<float,2>{0.135763839f, 0.947091103f},
-std::array<float,2>{0.533691645f, 0.428681165f},
-std::array<float,2>{0.276457936f, 0.242304265f},
-std::array<float,2>{0.926128328f, 0.603806555f},
-std::array<float,2>{0.472004116f, 0.737056375f},
-std::array<float,2>{0.80056262f, 0.0647684112f},
-std::array<float,2>{0.0678806081f, 0.253936648f},
-std::array<float,2>{0.705364943f, 0.843965173f},
-std::array<float,2>{0.0171795227f, 0.511261046f},
-std::array<float,2>{0.640908003f, 0.142545342f},
-std::array<float,2>{0.393615186f, 0.48728773f},
-std::array<float,2>{0.824299514f, 0.886352837f},
-std::array<float,2>{0.365801573f, 0.784080088f},
-std::array<float,2>{0.941885054f, 0.315223068f},
-std::array<float,2>{0.243639782f, 0.0231127422f},
-std::array<float,2>{0.568973064f, 0.674394786f},
-std::array<float,2>{0.169031203f, 0.772673249f},
-std::array<float,2>{0.52154839f, 0.359522253f},
-std::array<float,2>{0.303709745f, 0.0404160842f},
-std::array<float,2>{0.884330153f, 0.628434122f},
-std::array<float,2>{0.463742882f, 0.546127379f},
-std::array<float,2>{0.769333661f, 0.183327109f},
-std::array<float,2>{0.12386886f, 0.438120097f},
-std::array<float,2>{0.719078362f, 0.935101986f},
-std::array<float,2>{0.0357505716f, 0.690604866f},
-std::array<float,2>{0.659322977f, 0.102902748f},
-std::array<float,2>{0.418815732f, 0.287166983f},
-std::array<float,2>{0.849899411f, 0.837050676f},
-std::array<float,2>{0.332529694f, 0.995222032f},
-std::array<float,2>{0.987033069f, 0.405948281f},
-std::array<float,2>{0.218290657f, 0.208837226f},
-std::array<float,2>{0.613135993f, 0.579560637f},
-std::array<float,2>{0.0902160332f, 0.876366854f},
-std::array<float,2>{0.696735144f, 0.497922748f},
-std::array<float,2>{0.499007612f, 0.155238733f},
-std::array<float,2>{0.787102222f, 0.500944793f},
-std::array<float,2>{0.250884801f, 0.682341456f},
-std::array<float,2>{0.907198131f, 0.0267061964f},
-std::array<float,2>{0.141006708f, 0.320986331f},
-std::array<float,2>{0.555171847f, 0.795837283f},
-std::array<float,2>{0.220875189f, 0.595140696f},
-std::array<float,2>{0.591275871f, 0.240753353f},
-std::array<float,2>{0.349253386f, 0.434705913f},
-std::array<float,2>{0.960075915f, 0.939804971f},
-std::array<float,2>{0.378072143f, 0.857741117f},
-std::array<float,2>{0.841938376f, 0.257924706f},
-std::array<float,2>{0.0105954921f, 0.0744215548f},
-std::array<float,2>{0.637729526f, 0.742827296f},
-std::array<float,2>{0.0210439172f, 0.826031327f},
-std::array<float,2>{0.645828724f, 0.312345296f},
-std::array<float,2>{0.398172081f, 0.118629426f},
-std::array<float,2>{0.822309911f, 0.713160872f},
-std::array<float,2>{0.360802382f, 0.57167834f},
-std::array<float,2>{0.940045476f, 0.196681932f},
-std::array<float,2>{0.249502078f, 0.380933493f},
-std::array<float,2>{0.566181123f, 0.981321156f},
-std::array<float,2>{0.138945371f, 0.643268883f},
-std::array<float,2>{0.53628999f, 0.0489275604f},
-std::array<float,2>{0.280743212f, 0.358420759f},
-std::array<float,2>{0.924338937f, 0.759472609f},
-std::array<float,2>{0.472992927f, 0.920224607f},
-std::array<float,2>{0.801376402f, 0.463791907f},
-std::array<float,2>{0.0656392425f, 0.165763855f},
-std::array<float,2>{0.710810483f, 0.560712516f},
-std::array<float,2>{0.202486649f, 0.955808282f},
-std::array<float,2>{0.597572029f, 0.413484484f},
-std::array<float,2>{0.327170014f, 0.231139749f},
-std::array<float,2>{0.976702809f, 0.611481428f},
-std::array<float,2>{0.428346038f, 0.731381595f},
-std::array<float,2>{0.867199779f, 0.0837844312f},
-std::array<float,2>{0.0566525981f, 0.273955286f},
-std::array<float,2>{0.673627615f, 0.860607624f},
-std::array<float,2>{0.101428129f, 0.515728772f},
-std::array<float,2>{0.737279177f, 0.133752495f},
-std::array<float,2>{0.451825261f, 0.481401443f},
-std::array<float,2>{0.755917013f, 0.893011391f},
-std::array<float,2>{0.295385391f, 0.797092199f},
-std::array<float,2>{0.895831227f, 0.340501994f},
-std::array<float,2>{0.185576111f, 0.0129633956f},
-std::array<float,2>{0.508648396f, 0.659220815f},
-std::array<float,2>{0.235179424f, 0.870538652f},
-std::array<float,2>{0.574075699f, 0.266903579f},
-std::array<float,2>{0.367475688f, 0.0877112076f},
-std::array<float,2>{0.949695945f, 0.722464263f},
-std::array<float,2>{0.404491156f, 0.622107983f},
-std::array<float,2>{0.817771614f, 0.224180475f},
-std::array<float,2>{0.0261939503f, 0.420816451f},
-std::array<float,2>{0.65372932f, 0.964653969f},
-std::array<float,2>{0.0732028037f, 0.67134881f},
-std::array<float,2>{0.715042472f, 0.00680080475f},
-std::array<float,2>{0.482621163f, 0.329760104f},
-std::array<float,2>{0.805360019f, 0.807819963f},
-std::array<float,2>{0.272459656f, 0.90419805f},
-std::array<float,2>{0.932297051f, 0.472696692f},
-std::array<float,2>{0.126381308f, 0.130671337f},
-std::array<float,2>{0.540401638f, 0.529068172f},
-std::array<float,2>{0.0488806516f, 0.975537837f},
-std::array<float,2>{0.685575187f, 0.38719511f},
-std::array<float,2>{0.430629492f, 0.194297284f},
-std::array<float,2>{0.864385784f, 0.56273365f},
-std::array<float,2>{0.315498084f, 0.703820169f},
-std::array<float,2>{0.973968267f, 0.109519579f},
-std::array<float,2>{0.192351475f, 0.299818784f},
-std::array<float,2>{0.604106963f, 0.817176282f},
-std::array<float,2>{0.175192535f, 0.549257278f},
-std::array<float,2>{0.502888501f, 0.161584333f},
-std::array<float,2>{0.286647439f, 0.453273624f},
-std::array<float,2>{0.901558638f, 0.91059643f},
-std::array<float,2>{0.441573322f, 0.757623255f},
-std::array<float,2>{0.758819938f, 0.347507119f},
-std::array<float,2>{0.107523851f, 0.0621144995f},
-std::array<float,2>{0.742509365f, 0.652799428f},
-std::array<float,2>{0.113907032f, 0.785932541f},
-std::array<float,2>{0.731623292f, 0.316471756f},
-std::array<float,2>{0.453149855f, 0.0160484314f},
-std::array<float,2>{0.776502073f, 0.679467857f},
-std::array<float,2>{0.311941355f, 0.514259458f},
-std::array<float,2>{0.88049221f, 0.1464151f},
-std::array<float,2>{0.1582672f, 0.488388389f},
-std::array<float,2>{0.530156136f, 0.887769103f},
-std::array<float,2>{0.208461627f, 0.73972863f},
-std::array<float,2>{0.621133029f, 0.0693499297f},
-std::array<float,2>{0.336677313f, 0.252905548f},
-std::array<float,2>{0.996461689f, 0.848012388f},
-std::array<float,2>{0.413274169f, 0.951484621f},
-std::array<float,2>{0.856959462f, 0.424213678f},
-std::array<float,2>{0.0404209904f, 0.247155592f},
-std::array<float,2>{0.669582129f, 0.609137237f},
-std::array<float,2>{0.155797884f, 0.924376547f},
-std::array<float,2>{0.554404736f, 0.451558352f},
-std::array<float,2>{0.259916514f, 0.17961584f},
-std::array<float,2>{0.914105713f, 0.531277835f},
-std::array<float,2>{0.485705256f, 0.638144851f},
-std::array<float,2>{0.791459262f, 0.0336476117f},
-std::array<float,2>{0.0824465007f, 0.373745829f},
-std::array<float,2>{0.689199269f, 0.779314816f},
-std::array<float,2>{0.00567599246f, 0.590681016f},
-std::array<float,2>{0.629822552f, 0.213688895f},
-std::array<float,2>{0.382846385f, 0.396380901f},
-std::array<float,2>{0.83497107f, 0.989744961f},
-std::array<float,2>{0.357830375f, 0.833474815f},
-std::array<float,2>{0.962436974f, 0.292639047f},
-std::array<float,2>{0.233309299f, 0.0971635729f},
-std::array<float,2>{0.579407871f, 0.701117337f},
-std::array<float,2>{0.132428959f, 0.839877784f},
-std::array<float,2>{0.544340014f, 0.283698499f},
-std::array<float,2>{0.267808974f, 0.107816093f},
-std::array<float,2>{0.936231852f, 0.693181515f},
-std::array<float,2>{0.479339749f, 0.58503592f},
-std::array<float,2>{0.810312033f, 0.20566982f},
-std::array<float,2>{0.0746205077f, 0.400111109f},
-std::array<float,2>{0.71217829f, 0.996663451f},
-std::array<float,2>{0.02888887f, 0.63168031f},
-std::array<float,2>{0.652171016f, 0.0439511426f},
-std::array<float,2>{0.40075168f, 0.365721583f},
-std::array<float,2>{0.81563437f, 0.767538249f},
-std::array<float,2>{0.372542799f, 0.933330834f},
-std::array<float,2>{0.947904706f, 0.444990605f},
-std::array<float,2>{0.240525663f, 0.185601994f},
-std::array<float,2>{0.574859917f, 0.540959895f},
-std::array<float,2>{0.103922486f, 0.943234563f},
-std::array<float,2>{0.749800563f, 0.430434078f},
-std::array<float,2>{0.439838111f, 0.234768063f},
-std::array<float,2>{0.763941705f, 0.598773599f},
-std::array<float,2>{0.284732819f, 0.747094572f},
-std::array<float,2>{0.902746677f, 0.0736302659f},
-std::array<float,2>{0.17834571f, 0.262730271f},
-std::array<float,2>{0.506815851f, 0.853751361f},
-std::array<float,2>{0.190461546f, 0.507622778f},
-std::array<float,2>{0.609109998f, 0.149476781f},
-std::array<float,2>{0.319516659f, 0.495004803f},
-std::array<float,2>{0.968898416f, 0.881184816f},
-std::array<float,2>{0.434811324f, 0.791605234f},
-std::array<float,2>{0.859921932f, 0.32474193f},
-std::array<float,2>{0.0520277657f, 0.0278443452f},
-std::array<float,2>{0.681123018f, 0.684211791f},
-std::array<float,2>{0.0451052003f, 0.762902975f},
-std::array<float,2>{0.664671361f, 0.353458405f},
-std::array<float,2>{0.407291591f, 0.0526634976f},
-std::array<float,2>{0.852327943f, 0.644830883f},
-std::array<float,2>{0.342565775f, 0.557022393f},
-std::array<float,2>{0.995030224f, 0.169793531f},
-std::array<float,2>{0.205789968f, 0.465061426f},
-std::array<float,2>{0.619398057f, 0.917247653f},
-std::array<float,2>{0.163555086f, 0.715517402f},
-std::array<float,2>{0.524594426f, 0.121097602f},
-std::array<float,2>{0.305316389f, 0.305587202f},
-std::array<float,2>{0.876479685f, 0.821460009f},
-std::array<float,2>{0.457259864f, 0.977526188f},
-std::array<float,2>{0.781120658f, 0.378752351f},
-std::array<float,2>{0.113162272f, 0.201762259f},
-std::array<float,2>{0.728624642f, 0.578110933f},
-std::array<float,2>{0.227099195f, 0.897865295f},
-std::array<float,2>{0.585334063f, 0.478305399f},
-std::array<float,2>{0.353721946f, 0.140209168f},
-std::array<float,2>{0.966226697f, 0.51990509f},
-std::array<float,2>{0.387610912f, 0.660417497f},
-std::array<float,2>{0.829084158f, 0.0114936428f},
-std::array<float,2>{0.00369885238f, 0.338467866f},
-std::array<float,2>{0.626659334f, 0.802131295f},
-std::array<float,2>{0.0785627291f, 0.615127623f},
-std::array<float,2>{0.693962097f, 0.227246746f},
-std::array<float,2>{0.491053909f, 0.408908844f},
-std::array<float,2>{0.795201182f, 0.957490444f},
-std::array<float,2>{0.262595952f, 0.866228282f},
-std::array<float,2>{0.921049833f, 0.2794137f},
-std::array<float,2>{0.150086984f, 0.0809456483f},
-std::array<float,2>{0.548788309f, 0.727495611f},
-std::array<float,2>{0.212490574f, 0.80956614f},
-std::array<float,2>{0.615929604f, 0.334534258f},
-std::array<float,2>{0.331647128f, 0.0013141965f},
-std::array<float,2>{0.989686787f, 0.667743266f},
-std::array<float,2>{0.415381819f, 0.526998162f},
-std::array<float,2>{0.844119787f, 0.128033444f},
-std::array<float,2>{0.0314452536f, 0.46998927f},
-std::array<float,2>{0.662315667f, 0.899704874f},
-std::array<float,2>{0.117580481f, 0.724300981f},
-std::array<float,2>{0.723383963f, 0.0926436111f},
-std::array<float,2>{0.466783702f, 0.273202688f},
-std::array<float,2>{0.773282647f, 0.873749971f},
-std::array<float,2>{0.300595969f, 0.965491414f},
-std::array<float,2>{0.889213502f, 0.415962845f},
-std::array<float,2>{0.164862707f, 0.22041221f},
-std::array<float,2>{0.518920541f, 0.619917393f},
-std::array<float,2>{0.0150589254f, 0.907058656f},
-std::array<float,2>{0.635159791f, 0.457073539f},
-std::array<float,2>{0.381659806f, 0.15737839f},
-std::array<float,2>{0.839028418f, 0.554279268f},
-std::array<float,2>{0.344475627f, 0.649610519f},
-std::array<float,2>{0.954707742f, 0.0560186841f},
-std::array<float,2>{0.226546288f, 0.349364042f},
-std::array<float,2>{0.589216888f, 0.751392305f},
-std::array<float,2>{0.147547737f, 0.566969872f},
-std::array<float,2>{0.559159458f, 0.189391762f},
-std::array<float,2>{0.254103839f, 0.386231542f},
-std::array<float,2>{0.912919402f, 0.970162511f},
-std::array<float,2>{0.495425105f, 0.81586808f},
-std::array<float,2>{0.785105824f, 0.302787989f},
-std::array<float,2>{0.0865075663f, 0.115765683f},
-std::array<float,2>{0.6999017f, 0.708091199f},
-std::array<float,2>{0.070139654f, 0.846259952f},
-std::array<float,2>{0.704720974f, 0.257707685f},
-std::array<float,2>{0.468992829f, 0.0640280396f},
-std::array<float,2>{0.79877305f, 0.735561371f},
-std::array<float,2>{0.27426061f, 0.603338718f},
-std::array<float,2>{0.928395987f, 0.244256765f},
-std::array<float,2>{0.134405345f, 0.427196503f},
-std::array<float,2>{0.532767713f, 0.94860363f},
-std::array<float,2>{0.245017067f, 0.672412694f},
-std::array<float,2>{0.567086756f, 0.0197555926f},
-std::array<float,2>{0.363553464f, 0.314435989f},
-std::array<float,2>{0.943801224f, 0.781894743f},
-std::array<float,2>{0.392294735f, 0.884007454f},
-std::array<float,2>{0.826192617f, 0.485497415f},
-std::array<float,2>{0.0178800486f, 0.144100204f},
-std::array<float,2>{0.643658161f, 0.508576155f},
-std::array<float,2>{0.179690972f, 0.984441102f},
-std::array<float,2>{0.513985276f, 0.390863806f},
-std::array<float,2>{0.291988283f, 0.218379363f},
-std::array<float,2>{0.893148005f, 0.588102102f},
-std::array<float,2>{0.447468251f, 0.696073353f},
-std::array<float,2>{0.753899634f, 0.100359812f},
-std::array<float,2>{0.0948884189f, 0.294513553f},
-std::array<float,2>{0.73910296f, 0.828139484f},
-std::array<float,2>{0.0596525185f, 0.53598696f},
-std::array<float,2>{0.676160097f, 0.174295589f},
-std::array<float,2>{0.422691911f, 0.446986049f},
-std::array<float,2>{0.87178421f, 0.927938819f},
-std::array<float,2>{0.321302921f, 0.777154446f},
-std::array<float,2>{0.982168972f, 0.369460613f},
-std::array<float,2>{0.198308632f, 0.0373477004f},
-std::array<float,2>{0.600385725f, 0.633000672f},
-std::array<float,2>{0.152843729f, 0.779851317f},
-std::array<float,2>{0.551187515f, 0.373155951f},
-std::array<float,2>{0.258459151f, 0.0337206908f},
-std::array<float,2>{0.917442799f, 0.638641238f},
-std::array<float,2>{0.488033414f, 0.531748056f},
-std::array<float,2>{0.79091388f, 0.179003343f},
-std::array<float,2>{0.0857829377f, 0.451894253f},
-std::array<float,2>{0.691017389f, 0.924168169f},
-std::array<float,2>{0.00628308719f, 0.700424492f},
-std::array<float,2>{0.631567359f, 0.0973200351f},
-std::array<float,2>{0.386177182f, 0.292327076f},
-std::array<float,2>{0.832778513f, 0.833684862f},
-std::array<float,2>{0.356490046f, 0.989764392f},
-std::array<float,2>{0.964529574f, 0.395978749f},
-std::array<float,2>{0.231232867f, 0.213126004f},
-std::array<float,2>{0.580842316f, 0.590055943f},
-std::array<float,2>{0.115595862f, 0.888314247f},
-std::array<float,2>{0.733201981f, 0.48888132f},
-std::array<float,2>{0.456910312f, 0.145860359f},
-std::array<float,2>{0.773446441f, 0.513677001f},
-std::array<float,2>{0.310179353f, 0.67907989f},
-std::array<float,2>{0.882118762f, 0.0164436139f},
-std::array<float,2>{0.156272903f, 0.316943824f},
-std::array<float,2>{0.528021574f, 0.785206974f},
-std::array<float,2>{0.209684432f, 0.608749211f},
-std::array<float,2>{0.62388587f, 0.247623309f},
-std::array<float,2>{0.339511216f, 0.424387157f},
-std::array<float,2>{0.998852611f, 0.951681793f},
-std::array<float,2>{0.411336899f, 0.848507047f},
-std::array<float,2>{0.858771563f, 0.252077281f},
-std::array<float,2>{0.0414670333f, 0.070295468f},
-std::array<float,2>{0.671097934f, 0.740116298f},
-std::array<float,2>{0.0472900234f, 0.81655699f},
-std::array<float,2>{0.685539305f, 0.300446868f},
-std::array<float,2>{0.433252931f, 0.110046797f},
-std::array<float,2>{0.86681217f, 0.703412414f},
-std::array<float,2>{0.313265204f, 0.563394725f},
-std::array<float,2>{0.975476921f, 0.193397656f},
-std::array<float,2>{0.194508448f, 0.38725698f},
-std::array<float,2>{0.602716982f, 0.974760532f},
-std::array<float,2>{0.173053667f, 0.652864337f},
-std::array<float,2>{0.500253141f, 0.0619400442f},
-std::array<float,2>{0.288808167f, 0.346974015f},
-std::array<float,2>{0.89878732f, 0.757261813f},
-std::array<float,2>{0.444377691f, 0.911113739f},
-std::array<float,2>{0.7611745f, 0.453636378f},
-std::array<float,2>{0.105807729f, 0.161672086f},
-std::array<float,2>{0.744193733f, 0.549464047f},
-std::array<float,2>{0.237109944f, 0.964025676f},
-std::array<float,2>{0.571167529f, 0.419998974f},
-std::array<float,2>{0.369344682f, 0.223665416f},
-std::array<float,2>{0.95237416f, 0.622843087f},
-std::array<float,2>{0.402578592f, 0.722123563f},
-std::array<float,2>{0.818622112f, 0.086994566f},
-std::array<float,2>{0.0235502254f, 0.267304242f},
-std::array<float,2>{0.65544939f, 0.87079823f},
-std::array<float,2>{0.070390664f, 0.52852875f},
-std::array<float,2>{0.718242049f, 0.129888609f},
-std::array<float,2>{0.481366992f, 0.473447144f},
-std::array<float,2>{0.807423949f, 0.903591871f},
-std::array<float,2>{0.269537449f, 0.808205426f},
-std::array<float,2>{0.93135494f, 0.329274982f},
-std::array<float,2>{0.128359661f, 0.00611777185f},
-std::array<float,2>{0.54257828f, 0.671534777f},
-std::array<float,2>{0.200241119f, 0.860969961f},
-std::array<float,2>{0.59484899f, 0.2734707f},
-std::array<float,2>{0.324298024f, 0.0830449313f},
-std::array<float,2>{0.979387224f, 0.7306723f},
-std::array<float,2>{0.42739898f, 0.612280905f},
-std::array<float,2>{0.869647145f, 0.230850846f},
-std::array<float,2>{0.0547475331f, 0.413613558f},
-std::array<float,2>{0.674228311f, 0.955485106f},
-std::array<float,2>{0.0977919102f, 0.65997982f},
-std::array<float,2>{0.735612333f, 0.0133884475f},
-std::array<float,2>{0.44986245f, 0.340223819f},
-std::array<float,2>{0.754576862f, 0.797452152f},
-std::array<float,2>{0.293610334f, 0.893333018f},
-std::array<float,2>{0.897640705f, 0.48049894f},
-std::array<float,2>{0.18439208f, 0.133040145f},
-std::array<float,2>{0.51083082f, 0.516252816f},
-std::array<float,2>{0.0219054315f, 0.980544746f},
-std::array<float,2>{0.647044539f, 0.381557405f},
-std::array<float,2>{0.395539671f, 0.197156161f},
-std::array<float,2>{0.821460962f, 0.57199502f},
-std::array<float,2>{0.361820161f, 0.713568568f},
-std::array<float,2>{0.93841368f, 0.119098514f},
-std::array<float,2>{0.247912079f, 0.31180504f},
-std::array<float,2>{0.563108206f, 0.825589001f},
-std::array<float,2>{0.137690797f, 0.56104517f},
-std::array<float,2>{0.538016856f, 0.165115625f},
-std::array<float,2>{0.277661055f, 0.462944567f},
-std::array<float,2>{0.922131181f, 0.920592904f},
-std::array<float,2>{0.476331592f, 0.759040892f},
-std::array<float,2>{0.803370714f, 0.359065175f},
-std::array<float,2>{0.0627074912f, 0.049364537f},
-std::array<float,2>{0.70740664f, 0.642837822f},
-std::array<float,2>{0.0918263271f, 0.795247555f},
-std::array<float,2>{0.697322249f, 0.320619076f},
-std::array<float,2>{0.497699559f, 0.0268964451f},
-std::array<float,2>{0.788547575f, 0.681771874f},
-std::array<float,2>{0.253501266f, 0.500352979f},
-std::array<float,2>{0.908707321f, 0.154650331f},
-std::array<float,2>{0.142969966f, 0.497338593f},
-std::array<float,2>{0.558330059f, 0.876545548f},
-std::array<float,2>{0.21916306f, 0.742348492f},
-std::array<float,2>{0.593439698f, 0.0750713795f},
-std::array<float,2>{0.35086894f, 0.258412629f},
-std::array<float,2>{0.957738936f, 0.858297229f},
-std::array<float,2>{0.375026494f, 0.939994812f},
-std::array<float,2>{0.840938628f, 0.435229689f},
-std::array<float,2>{0.00962772314f, 0.240497202f},
-std::array<float,2>{0.638896585f, 0.595456719f},
-std::array<float,2>{0.170206055f, 0.935039282f},
-std::array<float,2>{0.519636631f, 0.43790701f},
-std::array<float,2>{0.30117318f, 0.182832628f},
-std::array<float,2>{0.886639476f, 0.546630144f},
-std::array<float,2>{0.462755382f, 0.628227532f},
-std::array<float,2>{0.766747296f, 0.0409865081f},
-std::array<float,2>{0.121864252f, 0.360181361f},
-std::array<float,2>{0.721286774f, 0.773028731f},
-std::array<float,2>{0.0375522934f, 0.579764962f},
-std::array<float,2>{0.657848656f, 0.208225563f},
-std::array<float,2>{0.420898259f, 0.405759454f},
-std::array<float,2>{0.849162042f, 0.995781183f},
-std::array<float,2>{0.334324092f, 0.837641537f},
-std::array<float,2>{0.985493779f, 0.287781894f},
-std::array<float,2>{0.21571359f, 0.103196658f},
-std::array<float,2>{0.60972029f, 0.691178858f},
-std::array<float,2>{0.183455348f, 0.829005599f},
-std::array<float,2>{0.51251924f, 0.294066697f},
-std::array<float,2>{0.289128631f, 0.100087143f},
-std::array<float,2>{0.891689718f, 0.695359111f},
-std::array<float,2>{0.445721775f, 0.588663638f},
-std::array<float,2>{0.751636624f, 0.217948243f},
-std::array<float,2>{0.096876733f, 0.391253769f},
-std::array<float,2>{0.740504563f, 0.984963f},
-std::array<float,2>{0.0616656989f, 0.633446574f},
-std::array<float,2>{0.678281724f, 0.0380512364f},
-std::array<float,2>{0.424279809f, 0.369694471f},
-std::array<float,2>{0.873279095f, 0.776513278f},
-std::array<float,2>{0.323624283f, 0.92867595f},
-std::array<float,2>{0.983663201f, 0.446378261f},
-std::array<float,2>{0.195584759f, 0.174329162f},
-std::array<float,2>{0.598280191f, 0.535599589f},
-std::array<float,2>{0.0676746815f, 0.948862314f},
-std::array<float,2>{0.705610752f, 0.427352905f},
-std::array<float,2>{0.472617388f, 0.244786352f},
-std::array<float,2>{0.799934745f, 0.602937579f},
-std::array<float,2>{0.276881963f, 0.73587817f},
-std::array<float,2>{0.926693141f, 0.0635838583f},
-std::array<float,2>{0.136289239f, 0.257171571f},
-std::array<float,2>{0.533424199f, 0.846186042f},
-std::array<float,2>{0.244048223f, 0.508229256f},
-std::array<float,2>{0.568699419f, 0.143917874f},
-std::array<float,2>{0.365416944f, 0.485947609f},
-std::array<float,2>{0.942196608f, 0.884409428f},
-std::array<float,2>{0.394243181f, 0.781658351f},
-std::array<float,2>{0.824763298f, 0.313688457f},
-std::array<float,2>{0.0167492535f, 0.020321589f},
-std::array<float,2>{0.64144522f, 0.672115982f},
-std::array<float,2>{0.0133213885f, 0.751581788f},
-std::array<float,2>{0.634181142f, 0.349002481f},
-std::array<float,2>{0.379833132f, 0.056526687f},
-std::array<float,2>{0.837001741f, 0.650083542f},
-std::array<float,2>{0.34661454f, 0.553818762f},
-std::array<float,2>{0.956212759f, 0.158187166f},
-std::array<float,2>{0.224403664f, 0.457829148f},
-std::array<float,2>{0.587485969f, 0.906352699f},
-std::array<float,2>{0.145495266f, 0.708963931f},
-std::array<float,2>{0.561651707f, 0.115286149f},
-std::array<float,2>{0.2562415f, 0.303564101f},
-std::array<float,2>{0.911454022f, 0.816047907f},
-std::array<float,2>{0.494029045f, 0.970524073f},
-std::array<float,2>{0.782644749f, 0.38589415f},
-std::array<float,2>{0.088008754f, 0.188932016f},
-std::array<float,2>{0.703077197f, 0.566471517f},
-std::array<float,2>{0.214436978f, 0.900261045f},
-std::array<float,2>{0.615218997f, 0.470567167f},
-std::array<float,2>{0.330066174f, 0.128482491f},
-std::array<float,2>{0.990920544f, 0.526551962f},
-std::array<float,2>{0.416697562f, 0.667026639f},
-std::array<float,2>{0.847188413f, 0.0016853956f},
-std::array<float,2>{0.0332036503f, 0.334030181f},
-std::array<float,2>{0.660765111f, 0.808783948f},
-std::array<float,2>{0.119828694f, 0.61948657f},
-std::array<float,2>{0.724798799f, 0.219927564f},
-std::array<float,2>{0.468372732f, 0.415478051f},
-std::array<float,2>{0.770385802f, 0.964940667f},
-std::array<float,2>{0.297476411f, 0.873131275f},
-std::array<float,2>{0.88806057f, 0.272931099f},
-std::array<float,2>{0.16601795f, 0.0921891928f},
-std::array<float,2>{0.515955508f, 0.723989844f},
-std::array<float,2>{0.229920715f, 0.802339017f},
-std::array<float,2>{0.582903385f, 0.338084757f},
-std::array<float,2>{0.35186246f, 0.0109217968f},
-std::array<float,2>{0.968537629f, 0.660826862f},
-std::array<float,2>{0.389597803f, 0.520134866f},
-std::array<float,2>{0.831175447f, 0.140032277f},
-std::array<float,2>{0.000234524938f, 0.47788009f},
-std::array<float,2>{0.628499806f, 0.898335814f},
-std::array<float,2>{0.0818519369f, 0.726753831f},
-std::array<float,2>{0.692394078f, 0.080405429f},
-std::array<float,2>{0.48966679f, 0.279961884f},
-std::array<float,2>{0.793725967f, 0.867119849f},
-std::array<float,2>{0.264823139f, 0.957897186f},
-std::array<float,2>{0.919535518f, 0.408266753f},
-std::array<float,2>{0.151720718f, 0.226708561f},
-std::array<float,2>{0.550369322f, 0.614312768f},
-std::array<float,2>{0.0438743681f, 0.91750145f},
-std::array<float,2>{0.66726476f, 0.465356618f},
-std::array<float,2>{0.408752501f, 0.169291735f},
-std::array<float,2>{0.854436219f, 0.55758208f},
-std::array<float,2>{0.341496646f, 0.645411193f},
-std::array<float,2>{0.993130624f, 0.0521638617f},
-std::array<float,2>{0.204333976f, 0.352630615f},
-std::array<float,2>{0.618284285f, 0.763396561f},
-std::array<float,2>{0.161135301f, 0.577318251f},
-std::array<float,2>{0.526019037f, 0.201563045f},
-std::array<float,2>{0.306932092f, 0.378043562f},
-std::array<float,2>{0.878086984f, 0.976633489f},
-std::array<float,2>{0.460056454f, 0.822141528f},
-std::array<float,2>{0.777858436f, 0.304737777f},
-std::array<float,2>{0.109895244f, 0.121929213f},
-std::array<float,2>{0.728011966f, 0.715330958f},
-std::array<float,2>{0.103212483f, 0.854234099f},
-std::array<float,2>{0.747777283f, 0.263640463f},
-std::array<float,2>{0.438486427f, 0.073766157f},
-std::array<float,2>{0.763083637f, 0.747873366f},
-std::array<float,2>{0.282944381f, 0.599372447f},
-std::array<float,2>{0.904932916f, 0.235289484f},
-std::array<float,2>{0.177484527f, 0.430053651f},
-std::array<float,2>{0.504699707f, 0.942535877f},
-std::array<float,2>{0.188342378f, 0.683864594f},
-std::array<float,2>{0.606680453f, 0.0276930295f},
-std::array<float,2>{0.317282766f, 0.324665785f},
-std::array<float,2>{0.971638381f, 0.79119581f},
-std::array<float,2>{0.435888797f, 0.881480634f},
-std::array<float,2>{0.86307621f, 0.494488865f},
-std::array<float,2>{0.0530197322f, 0.150329441f},
-std::array<float,2>{0.68167752f, 0.507322311f},
-std::array<float,2>{0.129101768f, 0.996508062f},
-std::array<float,2>{0.546387672f, 0.399669677f},
-std::array<float,2>{0.266664833f, 0.205557972f},
-std::array<float,2>{0.933745444f, 0.585594773f},
-std::array<float,2>{0.476672947f, 0.692777455f},
-std::array<float,2>{0.810691416f, 0.108287327f},
-std::array<float,2>{0.0777952224f, 0.283234566f},
-std::array<float,2>{0.714283168f, 0.840371132f},
-std::array<float,2>{0.0295223594f, 0.540487468f},
-std::array<float,2>{0.649773896f, 0.186176047f},
-std::array<float,2>{0.399253309f, 0.444765419f},
-std::array<float,2>{0.813944161f, 0.933044136f},
-std::array<float,2>{0.373838961f, 0.766729534f},
-std::array<float,2>{0.9468894f, 0.366162777f},
-std::array<float,2>{0.239755452f, 0.0445899442f},
-std::array<float,2>{0.576826274f, 0.63090843f},
-std::array<float,2>{0.158800736f, 0.787460804f},
-std::array<float,2>{0.529585838f, 0.318631887f},
-std::array<float,2>{0.312044859f, 0.0179096535f},
-std::array<float,2>{0.880328894f, 0.676310778f},
-std::array<float,2>{0.453786433f, 0.512692451f},
-std::array<float,2>{0.776886821f, 0.146688685f},
-std::array<float,2>{0.113640271f, 0.491527677f},
-std::array<float,2>{0.731970787f, 0.89024359f},
-std::array<float,2>{0.0408778675f, 0.741266251f},
-std::array<float,2>{0.669030309f, 0.0665049776f},
-std::array<float,2>{0.413620144f, 0.251622826f},
-std::array<float,2>{0.856868982f, 0.850275338f},
-std::array<float,2>{0.335971296f, 0.94922781f},
-std::array<float,2>{0.99678129f, 0.422541618f},
-std::array<float,2>{0.20887439f, 0.248422235f},
-std::array<float,2>{0.621992946f, 0.606684387f},
-std::array<float,2>{0.0828427151f, 0.922956407f},
-std::array<float,2>{0.688516021f, 0.450505644f},
-std::array<float,2>{0.485862911f, 0.176376492f},
-std::array<float,2>{0.791850865f, 0.534400165f},
-std::array<float,2>{0.26072672f, 0.639303267f},
-std::array<float,2>{0.914631844f, 0.0319114588f},
-std::array<float,2>{0.155472711f, 0.372751594f},
-std::array<float,2>{0.553767562f, 0.777775824f},
-std::array<float,2>{0.23264873f, 0.593606174f},
-std::array<float,2>{0.579695582f, 0.211378336f},
-std::array<float,2>{0.358386785f, 0.397573531f},
-std::array<float,2>{0.96204114f, 0.99064225f},
-std::array<float,2>{0.383463532f, 0.834372699f},
-std::array<float,2>{0.835473359f, 0.289141059f},
-std::array<float,2>{0.00536542851f, 0.0940375775f},
-std::array<float,2>{0.629086673f, 0.702168465f},
-std::array<float,2>{0.0254355893f, 0.868510067f},
-std::array<float,2>{0.654113889f, 0.268477529f},
-std::array<float,2>{0.40520978f, 0.089505285f},
-std::array<float,2>{0.8179245f, 0.718857288f},
-std::array<float,2>{0.368116021f, 0.623265207f},
-std::array<float,2>{0.949837923f, 0.224879891f},
-std::array<float,2>{0.234628752f, 0.419810086f},
-std::array<float,2>{0.573281825f, 0.962522984f},
-std::array<float,2>{0.126589239f, 0.669299901f},
-std::array<float,2>{0.540615857f, 0.00481434911f},
-std::array<float,2>{0.27154094f, 0.331343889f},
-std::array<float,2>{0.931656003f, 0.805628598f},
-std::array<float,2>{0.483331919f, 0.905384183f},
-std::array<float,2>{0.804863751f, 0.47466132f},
-std::array<float,2>{0.0726777092f, 0.132119983f},
-std::array<float,2>{0.715600371f, 0.530893207f},
-std::array<float,2>{0.19166185f, 0.973783433f},
-std::array<float,2>{0.603749275f, 0.389493495f},
-std::array<float,2>{0.3159298f, 0.192836553f},
-std::array<float,2>{0.97447598f, 0.566061258f},
-std::array<float,2>{0.430058718f, 0.706635535f},
-std::array<float,2>{0.864746332f, 0.112135202f},
-std::array<float,2>{0.0497540832f, 0.297300726f},
-std::array<float,2>{0.68626982f, 0.818703473f},
-std::array<float,2>{0.108392455f, 0.547131836f},
-std::array<float,2>{0.743041754f, 0.163647577f},
-std::array<float,2>{0.442162931f, 0.456658483f},
-std::array<float,2>{0.759596765f, 0.912416279f},
-std::array<float,2>{0.286367118f, 0.755435407f},
-std::array<float,2>{0.901986241f, 0.345443636f},
-std::array<float,2>{0.175642014f, 0.0596606843f},
-std::array<float,2>{0.502207398f, 0.654625833f},
-std::array<float,2>{0.249955699f, 0.82744509f},
-std::array<float,2>{0.565472722f, 0.310142994f},
-std::array<float,2>{0.36119014f, 0.119613707f},
-std::array<float,2>{0.93964541f, 0.712193131f},
-std::array<float,2>{0.397906542f, 0.572333813f},
-std::array<float,2>{0.823093951f, 0.198797986f},
-std::array<float,2>{0.0209594667f, 0.379425377f},
-std::array<float,2>{0.646110535f, 0.983782887f},
-std::array<float,2>{0.066160284f, 0.640785456f},
-std::array<float,2>{0.710358202f, 0.0477636121f},
-std::array<float,2>{0.473386645f, 0.356751591f},
-std::array<float,2>{0.800830185f, 0.761689305f},
-std::array<float,2>{0.280858457f, 0.919166744f},
-std::array<float,2>{0.92385906f, 0.461379111f},
-std::array<float,2>{0.139540166f, 0.167461887f},
-std::array<float,2>{0.536699176f, 0.559973061f},
-std::array<float,2>{0.0572514273f, 0.954886079f},
-std::array<float,2>{0.672995389f, 0.41199398f},
-std::array<float,2>{0.427948236f, 0.233657226f},
-std::array<float,2>{0.867825866f, 0.610514045f},
-std::array<float,2>{0.32799986f, 0.733415961f},
-std::array<float,2>{0.977094412f, 0.0843775794f},
-std::array<float,2>{0.202734306f, 0.275636703f},
-std::array<float,2>{0.597026408f, 0.862906814f},
-std::array<float,2>{0.186261058f, 0.519292235f},
-std::array<float,2>{0.508076966f, 0.135705993f},
-std::array<float,2>{0.295501232f, 0.484043062f},
-std::array<float,2>{0.89616847f, 0.890894949f},
-std::array<float,2>{0.451435179f, 0.799996197f},
-std::array<float,2>{0.756605804f, 0.342009902f},
-std::array<float,2>{0.1010077f, 0.0147328274f},
-std::array<float,2>{0.736694992f, 0.657128096f},
-std::array<float,2>{0.123504385f, 0.770000994f},
-std::array<float,2>{0.719329715f, 0.362247944f},
-std::array<float,2>{0.463053048f, 0.0429196283f},
-std::array<float,2>{0.768658042f, 0.625854373f},
-std::array<float,2>{0.303153008f, 0.543149352f},
-std::array<float,2>{0.884025812f, 0.180468142f},
-std::array<float,2>{0.169861823f, 0.440431386f},
-std::array<float,2>{0.522104502f, 0.935581267f},
-std::array<float,2>{0.218249336f, 0.688724399f},
-std::array<float,2>{0.612710059f, 0.103956938f},
-std::array<float,2>{0.33227101f, 0.286138475f},
-std::array<float,2>{0.986601353f, 0.839159012f},
-std::array<float,2>{0.418224692f, 0.993913293f},
-std::array<float,2>{0.850328505f, 0.40400058f},
-std::array<float,2>{0.035217721f, 0.210210726f},
-std::array<float,2>{0.659868598f, 0.580245256f},
-std::array<float,2>{0.141460836f, 0.878448665f},
-std::array<float,2>{0.555413187f, 0.498623371f},
-std::array<float,2>{0.250481486f, 0.153178945f},
-std::array<float,2>{0.906320274f, 0.503254831f},
-std::array<float,2>{0.498373896f, 0.681636989f},
-std::array<float,2>{0.786489725f, 0.0242623873f},
-std::array<float,2>{0.0906840637f, 0.322682738f},
-std::array<float,2>{0.697039604f, 0.794179797f},
-std::array<float,2>{0.0101224901f, 0.596391082f},
-std::array<float,2>{0.638202548f, 0.239594743f},
-std::array<float,2>{0.378754526f, 0.436387539f},
-std::array<float,2>{0.84266448f, 0.938471794f},
-std::array<float,2>{0.349103302f, 0.855767369f},
-std::array<float,2>{0.960526943f, 0.259896547f},
-std::array<float,2>{0.221358478f, 0.0777231604f},
-std::array<float,2>{0.591780782f, 0.745548129f},
-std::array<float,2>{0.133803487f, 0.844352245f},
-std::array<float,2>{0.532397687f, 0.254662573f},
-std::array<float,2>{0.273767382f, 0.0650425777f},
-std::array<float,2>{0.928026974f, 0.736790419f},
-std::array<float,2>{0.46939227f, 0.604440868f},
-std::array<float,2>{0.797944903f, 0.242780879f},
-std::array<float,2>{0.0696604103f, 0.42802012f},
-std::array<float,2>{0.704567015f, 0.946626008f},
-std::array<float,2>{0.0181954429f, 0.673984766f},
-std::array<float,2>{0.644519269f, 0.0226489305f},
-std::array<float,2>{0.391855836f, 0.314746231f},
-std::array<float,2>{0.827037215f, 0.783434927f},
-std::array<float,2>{0.36407423f, 0.886108935f},
-std::array<float,2>{0.944092393f, 0.486470699f},
-std::array<float,2>{0.244155362f, 0.142022759f},
-std::array<float,2>{0.566732645f, 0.511131942f},
-std::array<float,2>{0.0956819281f, 0.986337721f},
-std::array<float,2>{0.738724709f, 0.392756879f},
-std::array<float,2>{0.447961628f, 0.215332612f},
-std::array<float,2>{0.753120482f, 0.587764323f},
-std::array<float,2>{0.291350067f, 0.698063135f},
-std::array<float,2>{0.892948985f, 0.098944366f},
-std::array<float,2>{0.180591345f, 0.295832902f},
-std::array<float,2>{0.514363408f, 0.831832349f},
-std::array<float,2>{0.198961303f, 0.538786471f},
-std::array<float,2>{0.599647939f, 0.172344506f},
-std::array<float,2>{0.322137684f, 0.447288543f},
-std::array<float,2>{0.981839955f, 0.927204192f},
-std::array<float,2>{0.421975434f, 0.773840725f},
-std::array<float,2>{0.871196866f, 0.368873149f},
-std::array<float,2>{0.0601162463f, 0.0358346514f},
-std::array<float,2>{0.676490784f, 0.635782123f},
-std::array<float,2>{0.032024473f, 0.812475204f},
-std::array<float,2>{0.663010418f, 0.33376807f},
-std::array<float,2>{0.415905774f, 0.00349658704f},
-std::array<float,2>{0.844667196f, 0.665750504f},
-std::array<float,2>{0.331220061f, 0.52366513f},
-std::array<float,2>{0.990057647f, 0.125420973f},
-std::array<float,2>{0.212388813f, 0.471449584f},
-std::array<float,2>{0.615383208f, 0.901467025f},
-std::array<float,2>{0.164523348f, 0.725058615f},
-std::array<float,2>{0.519393146f, 0.0905581415f},
-std::array<float,2>{0.300082862f, 0.270037353f},
-std::array<float,2>{0.889140546f, 0.872475803f},
-std::array<float,2>{0.466164917f, 0.968462527f},
-std::array<float,2>{0.772891283f, 0.416149259f},
-std::array<float,2>{0.118006475f, 0.22204949f},
-std::array<float,2>{0.723009467f, 0.618777514f},
-std::array<float,2>{0.225926012f, 0.909844279f},
-std::array<float,2>{0.589370012f, 0.459819883f},
-std::array<float,2>{0.344022095f, 0.160104945f},
-std::array<float,2>{0.954133272f, 0.551657677f},
-std::array<float,2>{0.381247431f, 0.65137893f},
-std::array<float,2>{0.839580297f, 0.0568558611f},
-std::array<float,2>{0.0152007323f, 0.351325542f},
-std::array<float,2>{0.635738134f, 0.752707064f},
-std::array<float,2>{0.0862381086f, 0.569811702f},
-std::array<float,2>{0.699295282f, 0.189856261f},
-std::array<float,2>{0.49596861f, 0.383031934f},
-std::array<float,2>{0.78425926f, 0.972168028f},
-std::array<float,2>{0.254880637f, 0.813637257f},
-std::array<float,2>{0.912408113f, 0.301394343f},
-std::array<float,2>{0.148179159f, 0.11502783f},
-std::array<float,2>{0.55907321f, 0.709206343f},
-std::array<float,2>{0.205353931f, 0.764416099f},
-std::array<float,2>{0.619973481f, 0.353608012f},
-std::array<float,2>{0.341797739f, 0.0545702428f},
-std::array<float,2>{0.994301617f, 0.646905124f},
-std::array<float,2>{0.40799278f, 0.55561024f},
-std::array<float,2>{0.851735413f, 0.171537176f},
-std::array<float,2>{0.0458857827f, 0.467280209f},
-std::array<float,2>{0.664183497f, 0.915989399f},
-std::array<float,2>{0.112608425f, 0.717216969f},
-std::array<float,2>{0.729075432f, 0.124306135f},
-std::array<float,2>{0.457602441f, 0.308488667f},
-std::array<float,2>{0.780426562f, 0.82307452f},
-std::array<float,2>{0.304989964f, 0.980231524f},
-std::array<float,2>{0.876317918f, 0.37529996f},
-std::array<float,2>{0.163988248f, 0.200103134f},
-std::array<float,2>{0.525249243f, 0.575108469f},
-std::array<float,2>{0.00322639896f, 0.896410525f},
-std::array<float,2>{0.626284182f, 0.48010233f},
-std::array<float,2>{0.38708064f, 0.138011664f},
-std::array<float,2>{0.828533411f, 0.521833479f},
-std::array<float,2>{0.354184866f, 0.66254276f},
-std::array<float,2>{0.966401458f, 0.00792715233f},
-std::array<float,2>{0.22660777f, 0.336692572f},
-std::array<float,2>{0.585734189f, 0.804391325f},
-std::array<float,2>{0.149658948f, 0.617065072f},
-std::array<float,2>{0.547999918f, 0.229141697f},
-std::array<float,2>{0.262057602f, 0.40649417f},
-std::array<float,2>{0.921461642f, 0.95947659f},
-std::array<float,2>{0.490403593f, 0.864433527f},
-std::array<float,2>{0.79548347f, 0.278644741f},
-std::array<float,2>{0.0789953843f, 0.0797187611f},
-std::array<float,2>{0.693559408f, 0.729045808f},
-std::array<float,2>{0.0749567077f, 0.842965722f},
-std::array<float,2>{0.712451041f, 0.282696605f},
-std::array<float,2>{0.478693068f, 0.106282249f},
-std::array<float,2>{0.809836447f, 0.694965005f},
-std::array<float,2>{0.268091261f, 0.583586395f},
-std::array<float,2>{0.935935497f, 0.203286886f},
-std::array<float,2>{0.13208729f, 0.402321905f},
-std::array<float,2>{0.544640422f, 0.998818994f},
-std::array<float,2>{0.240902081f, 0.630025506f},
-std::array<float,2>{0.574507535f, 0.0463129096f},
-std::array<float,2>{0.372809589f, 0.364269495f},
-std::array<float,2>{0.947508872f, 0.768756986f},
-std::array<float,2>{0.401333511f, 0.930001795f},
-std::array<float,2>{0.816156268f, 0.442020953f},
-std::array<float,2>{0.0283809695f, 0.184448868f},
-std::array<float,2>{0.651774645f, 0.541510403f},
-std::array<float,2>{0.178044751f, 0.943388879f},
-std::array<float,2>{0.505913436f, 0.432181418f},
-std::array<float,2>{0.284621477f, 0.237478435f},
-std::array<float,2>{0.903079391f, 0.600524664f},
-std::array<float,2>{0.440091759f, 0.748355925f},
-std::array<float,2>{0.764375508f, 0.0709442198f},
-std::array<float,2>{0.104353398f, 0.264699519f},
-std::array<float,2>{0.749413669f, 0.853243172f},
-std::array<float,2>{0.0523684733f, 0.503938973f},
-std::array<float,2>{0.681574285f, 0.151411384f},
-std::array<float,2>{0.435449362f, 0.492583096f},
-std::array<float,2>{0.859785318f, 0.879814923f},
-std::array<float,2>{0.320090592f, 0.790699184f},
-std::array<float,2>{0.969242096f, 0.326443017f},
-std::array<float,2>{0.191204861f, 0.0297052301f},
-std::array<float,2>{0.608547986f, 0.685849965f},
-std::array<float,2>{0.127281696f, 0.805827081f},
-std::array<float,2>{0.541427553f, 0.330274552f},
-std::array<float,2>{0.271300346f, 0.00514375838f},
-std::array<float,2>{0.930309236f, 0.668567657f},
-std::array<float,2>{0.481560975f, 0.530252695f},
-std::array<float,2>{0.808314383f, 0.131102115f},
-std::array<float,2>{0.0718350559f, 0.476228893f},
-std::array<float,2>{0.717571139f, 0.904453695f},
-std::array<float,2>{0.0252078008f, 0.720110416f},
-std::array<float,2>{0.655252814f, 0.0885730982f},
-std::array<float,2>{0.403731495f, 0.269078076f},
-std::array<float,2>{0.819896579f, 0.867851615f},
-std::array<float,2>{0.370249212f, 0.961332858f},
-std::array<float,2>{0.951245904f, 0.418141305f},
-std::array<float,2>{0.237772897f, 0.226473883f},
-std::array<float,2>{0.571954191f, 0.624190569f},
-std::array<float,2>{0.107146911f, 0.913271427f},
-std::array<float,2>{0.745378315f, 0.455951333f},
-std::array<float,2>{0.443744332f, 0.162362501f},
-std::array<float,2>{0.760227323f, 0.548777282f},
-std::array<float,2>{0.287709028f, 0.655696273f},
-std::array<float,2>{0.899514556f, 0.0595120788f},
-std::array<float,2>{0.172255933f, 0.344392568f},
-std::array<float,2>{0.501913905f, 0.754499853f},
-std::array<float,2>{0.193363607f, 0.564662158f},
-std::array<float,2>{0.602091312f, 0.191600084f},
-std::array<float,2>{0.313550949f, 0.390198052f},
-std::array<float,2>{0.976397812f, 0.973151267f},
-std::array<float,2>{0.432611018f, 0.820146143f},
-std::array<float,2>{0.865452528f, 0.298275322f},
-std::array<float,2>{0.0484523214f, 0.113139279f},
-std::array<float,2>{0.684022009f, 0.705643117f},
-std::array<float,2>{0.0427927673f, 0.850903869f},
-std::array<float,2>{0.66992563f, 0.250766724f},
-std::array<float,2>{0.410866618f, 0.0679499805f},
-std::array<float,2>{0.857765257f, 0.740904093f},
-std::array<float,2>{0.3383632f, 0.606287301f},
-std::array<float,2>{0.999616325f, 0.249268144f},
-std::array<float,2>{0.210496545f, 0.423334181f},
-std::array<float,2>{0.624239028f, 0.951139152f},
-std::array<float,2>{0.157280713f, 0.677511871f},
-std::array<float,2>{0.528902233f, 0.018747462f},
-std::array<float,2>{0.3088772f, 0.319857299f},
-std::array<float,2>{0.881082833f, 0.788754463f},
-std::array<float,2>{0.455517828f, 0.889623523f},
-std::array<float,2>{0.774620652f, 0.490831941f},
-std::array<float,2>{0.116893195f, 0.148003906f},
-std::array<float,2>{0.733561277f, 0.513432503f},
-std::array<float,2>{0.231916741f, 0.99195832f},
-std::array<float,2>{0.581451178f, 0.396551549f},
-std::array<float,2>{0.355516315f, 0.2120841f},
-std::array<float,2>{0.963304341f, 0.592222393f},
-std::array<float,2>{0.384843886f, 0.701456785f},
-std::array<float,2>{0.833498895f, 0.0950521529f},
-std::array<float,2>{0.00700179581f, 0.290410697f},
-std::array<float,2>{0.632346869f, 0.835553586f},
-std::array<float,2>{0.0848522112f, 0.533503354f},
-std::array<float,2>{0.690259874f, 0.177167609f},
-std::array<float,2>{0.487298489f, 0.44960916f},
-std::array<float,2>{0.789113104f, 0.922140002f},
-std::array<float,2>{0.259362936f, 0.779004335f},
-std::array<float,2>{0.91620028f, 0.371395469f},
-std::array<float,2>{0.153575793f, 0.0323426574f},
-std::array<float,2>{0.552615702f, 0.639890969f},
-std::array<float,2>{0.216198877f, 0.838815808f},
-std::array<float,2>{0.611219764f, 0.285762757f},
-std::array<float,2>{0.33556208f, 0.104670584f},
-std::array<float,2>{0.984473526f, 0.687995255f},
-std::array<float,2>{0.421767235f, 0.581567287f},
-std::array<float,2>{0.848256111f, 0.209484741f},
-std::array<float,2>{0.038815558f, 0.402690172f},
-std::array<float,2>{0.657113552f, 0.992656529f},
-std::array<float,2>{0.122277454f, 0.626726031f},
-std::array<float,2>{0.721905768f, 0.0413859189f},
-std::array<float,2>{0.461895943f, 0.363182425f},
-std::array<float,2>{0.76598841f, 0.770816326f},
-std::array<float,2>{0.302612603f, 0.937262177f},
-std::array<float,2>{0.8853544f, 0.439885885f},
-std::array<float,2>{0.171531901f, 0.180667341f},
-std::array<float,2>{0.5207811f, 0.544154465f},
-std::array<float,2>{0.00851181615f, 0.939105392f},
-std::array<float,2>{0.639676809f, 0.43706122f},
-std::array<float,2>{0.37663427f, 0.239005715f},
-std::array<float,2>{0.84060353f, 0.596967041f},
-std::array<float,2>{0.35025692f, 0.745046616f},
-std::array<float,2>{0.958171844f, 0.0763586462f},
-std::array<float,2>{0.219759926f, 0.261701018f},
-std::array<float,2>{0.592040181f, 0.856487274f},
-std::array<float,2>{0.144171491f, 0.502078354f},
-std::array<float,2>{0.557528436f, 0.153857619f},
-std::array<float,2>{0.252913326f, 0.499899626f},
-std::array<float,2>{0.909496725f, 0.877787709f},
-std::array<float,2>{0.496471494f, 0.792990565f},
-std::array<float,2>{0.787509382f, 0.32411176f},
-std::array<float,2>{0.093113713f, 0.0250356328f},
-std::array<float,2>{0.698671222f, 0.680545509f},
-std::array<float,2>{0.0639240667f, 0.760378718f},
-std::array<float,2>{0.708628058f, 0.355985999f},
-std::array<float,2>{0.475278378f, 0.0482893772f},
-std::array<float,2>{0.80440551f, 0.641794026f},
-std::array<float,2>{0.278378278f, 0.558632612f},
-std::array<float,2>{0.923446536f, 0.166416198f},
-std::array<float,2>{0.138657942f, 0.462424099f},
-std::array<float,2>{0.538376033f, 0.918006659f},
-std::array<float,2>{0.246165603f, 0.711729109f},
-std::array<float,2>{0.564324975f, 0.120937854f},
-std::array<float,2>{0.362510741f, 0.309298187f},
-std::array<float,2>{0.938972831f, 0.826443076f},
-std::array<float,2>{0.394618332f, 0.982928813f},
-std::array<float,2>{0.820697844f, 0.380382776f},
-std::array<float,2>{0.0228836108f, 0.197893977f},
-std::array<float,2>{0.647476792f, 0.573925734f},
-std::array<float,2>{0.185066387f, 0.892111897f},
-std::array<float,2>{0.510461748f, 0.48327443f},
-std::array<float,2>{0.294463038f, 0.136660129f},
-std::array<float,2>{0.897067189f, 0.518074989f},
-std::array<float,2>{0.45082134f, 0.657989025f},
-std::array<float,2>{0.755313754f, 0.0141857294f},
-std::array<float,2>{0.0987594426f, 0.342863768f},
-std::array<float,2>{0.734772623f, 0.799392164f},
-std::array<float,2>{0.0561765954f, 0.609548628f},
-std::array<float,2>{0.675158858f, 0.233018875f},
-std::array<float,2>{0.425845981f, 0.410300553f},
-std::array<float,2>{0.87085551f, 0.953331649f},
-std::array<float,2>{0.325324178f, 0.861860514f},
-std::array<float,2>{0.979755044f, 0.277291358f},
-std::array<float,2>{0.199473932f, 0.085794352f},
-std::array<float,2>{0.594024062f, 0.733058929f},
-std::array<float,2>{0.167708516f, 0.871533394f},
-std::array<float,2>{0.51748383f, 0.271329522f},
-std::array<float,2>{0.29866752f, 0.0910880864f},
-std::array<float,2>{0.887287498f, 0.726319551f},
-std::array<float,2>{0.467454791f, 0.617297769f},
-std::array<float,2>{0.771452963f, 0.220891416f},
-std::array<float,2>{0.120954357f, 0.41721198f},
-std::array<float,2>{0.726269424f, 0.967312038f},
-std::array<float,2>{0.0346081816f, 0.664817989f},
-std::array<float,2>{0.661168933f, 0.00199301611f},
-std::array<float,2>{0.417235613f, 0.332675576f},
-std::array<float,2>{0.846039593f, 0.810751319f},
-std::array<float,2>{0.328859121f, 0.900928199f},
-std::array<float,2>{0.991408885f, 0.471869439f},
-std::array<float,2>{0.213298827f, 0.12694405f},
-std::array<float,2>{0.613981128f, 0.52475667f},
-std::array<float,2>{0.0897815749f, 0.971291244f},
-std::array<float,2>{0.701181769f, 0.383818477f},
-std::array<float,2>{0.492522955f, 0.19132103f},
-std::array<float,2>{0.782106638f, 0.569188058f},
-std::array<float,2>{0.257526815f, 0.710897088f},
-std::array<float,2>{0.910417914f, 0.113514423f},
-std::array<float,2>{0.14639467f, 0.302018642f},
-std::array<float,2>{0.560715497f, 0.813199103f},
-std::array<float,2>{0.22329773f, 0.552512705f},
-std::array<float,2>{0.586830139f, 0.15868257f},
-std::array<float,2>{0.347253263f, 0.460232675f},
-std::array<float,2>{0.955454946f, 0.908446014f},
-std::array<float,2>{0.379980922f, 0.75384438f},
-std::array<float,2>{0.835996032f, 0.350413084f},
-std::array<float,2>{0.0125677465f, 0.0578112863f},
-std::array<float,2>{0.633057117f, 0.651229978f},
-std::array<float,2>{0.0159609281f, 0.784559965f},
-std::array<float,2>{0.641844809f, 0.316316515f},
-std::array<float,2>{0.393381864f, 0.0217397977f},
-std::array<float,2>{0.826094687f, 0.675167978f},
-std::array<float,2>{0.366992652f, 0.510012746f},
-std::array<float,2>{0.943346143f, 0.140659675f},
-std::array<float,2>{0.243071556f, 0.488191247f},
-std::array<float,2>{0.570116103f, 0.885044277f},
-std::array<float,2>{0.134860903f, 0.737667322f},
-std::array<float,2>{0.534705579f, 0.0657750666f},
-std::array<float,2>{0.276161879f, 0.255661517f},
-std::array<float,2>{0.9277125f, 0.845059931f},
-std::array<float,2>{0.471546978f, 0.94620353f},
-std::array<float,2>{0.799016416f, 0.429081649f},
-std::array<float,2>{0.0670626014f, 0.243744135f},
-std::array<float,2>{0.706934273f, 0.604721844f},
-std::array<float,2>{0.196476787f, 0.926434338f},
-std::array<float,2>{0.599118829f, 0.448924303f},
-std::array<float,2>{0.322835654f, 0.173391342f},
-std::array<float,2>{0.983040929f, 0.537937999f},
-std::array<float,2>{0.425222963f, 0.635187387f},
-std::array<float,2>{0.874146402f, 0.0367664173f},
-std::array<float,2>{0.0610563532f, 0.367961168f},
-std::array<float,2>{0.679206789f, 0.774536073f},
-std::array<float,2>{0.0962497517f, 0.586070895f},
-std::array<float,2>{0.74165076f, 0.216590598f},
-std::array<float,2>{0.447039515f, 0.393687606f},
-std::array<float,2>{0.750639856f, 0.98770082f},
-std::array<float,2>{0.290385216f, 0.83032608f},
-std::array<float,2>{0.891204119f, 0.296022475f},
-std::array<float,2>{0.18166092f, 0.0982939377f},
-std::array<float,2>{0.512819111f, 0.698475063f},
-std::array<float,2>{0.239125237f, 0.767718971f},
-std::array<float,2>{0.578027487f, 0.3634817f},
-std::array<float,2>{0.374734938f, 0.0458477214f},
-std::array<float,2>{0.946062326f, 0.629230082f},
-std::array<float,2>{0.399592131f, 0.542409182f},
-std::array<float,2>{0.812661171f, 0.185160607f},
-std::array<float,2>{0.0305975862f, 0.44329378f},
-std::array<float,2>{0.648952246f, 0.931358874f},
-std::array<float,2>{0.0768090785f, 0.693668365f},
-std::array<float,2>{0.712930501f, 0.107388735f},
-std::array<float,2>{0.478130877f, 0.282183468f},
-std::array<float,2>{0.811959207f, 0.84225142f},
-std::array<float,2>{0.265958846f, 0.999365151f},
-std::array<float,2>{0.934811711f, 0.401327789f},
-std::array<float,2>{0.130429447f, 0.20478566f},
-std::array<float,2>{0.545567334f, 0.582954943f},
-std::array<float,2>{0.0537408851f, 0.880576074f},
-std::array<float,2>{0.683358371f, 0.493214637f},
-std::array<float,2>{0.437324345f, 0.15079087f},
-std::array<float,2>{0.861753821f, 0.505159914f},
-std::array<float,2>{0.31743136f, 0.686942637f},
-std::array<float,2>{0.971982241f, 0.0308887064f},
-std::array<float,2>{0.18905063f, 0.327391356f},
-std::array<float,2>{0.606359243f, 0.78911531f},
-std::array<float,2>{0.175950363f, 0.600790262f},
-std::array<float,2>{0.505264878f, 0.236579239f},
-std::array<float,2>{0.281778574f, 0.432964951f},
-std::array<float,2>{0.906246364f, 0.945157409f},
-std::array<float,2>{0.437749624f, 0.852245867f},
-std::array<float,2>{0.762250125f, 0.263684511f},
-std::array<float,2>{0.101704828f, 0.0721639991f},
-std::array<float,2>{0.746807754f, 0.749382854f},
-std::array<float,2>{0.110852711f, 0.82421124f},
-std::array<float,2>{0.726574898f, 0.306936443f},
-std::array<float,2>{0.459495842f, 0.1236002f},
-std::array<float,2>{0.778615594f, 0.718377173f},
-std::array<float,2>{0.308431119f, 0.575807035f},
-std::array<float,2>{0.877771318f, 0.20113647f},
-std::array<float,2>{0.160370052f, 0.376859605f},
-std::array<float,2>{0.526614904f, 0.978819251f},
-std::array<float,2>{0.203278959f, 0.647894144f},
-std::array<float,2>{0.617985725f, 0.0534011684f},
-std::array<float,2>{0.340152472f, 0.354639083f},
-std::array<float,2>{0.993879199f, 0.765454173f},
-std::array<float,2>{0.409382045f, 0.914496541f},
-std::array<float,2>{0.855049729f, 0.46803537f},
-std::array<float,2>{0.0444111302f, 0.170372471f},
-std::array<float,2>{0.66637224f, 0.556475878f},
-std::array<float,2>{0.150618434f, 0.960194945f},
-std::array<float,2>{0.54971844f, 0.408045471f},
-std::array<float,2>{0.264426529f, 0.22980234f},
-std::array<float,2>{0.918732405f, 0.615963519f},
-std::array<float,2>{0.488452584f, 0.729627669f},
-std::array<float,2>{0.794081509f, 0.0787836611f},
-std::array<float,2>{0.0801480487f, 0.277790517f},
-std::array<float,2>{0.691941261f, 0.86360997f},
-std::array<float,2>{0.00174786919f, 0.523396015f},
-std::array<float,2>{0.627563417f, 0.136946529f},
-std::array<float,2>{0.389686435f, 0.478776157f},
-std::array<float,2>{0.830146492f, 0.895030499f},
-std::array<float,2>{0.353062302f, 0.802735567f},
-std::array<float,2>{0.967341661f, 0.337708175f},
-std::array<float,2>{0.228617176f, 0.00914231595f},
-std::array<float,2>{0.583638728f, 0.663093388f},
-std::array<float,2>{0.174137056f, 0.756615222f},
-std::array<float,2>{0.503340483f, 0.345911354f},
-std::array<float,2>{0.285748184f, 0.0610680766f},
-std::array<float,2>{0.90092057f, 0.653618157f},
-std::array<float,2>{0.442834496f, 0.550432086f},
-std::array<float,2>{0.758029342f, 0.161119059f},
-std::array<float,2>{0.109351359f, 0.454501271f},
-std::array<float,2>{0.743704557f, 0.911490858f},
-std::array<float,2>{0.0502307303f, 0.704601467f},
-std::array<float,2>{0.686638951f, 0.110696115f},
-std::array<float,2>{0.430830568f, 0.29921332f},
-std::array<float,2>{0.863710046f, 0.818152726f},
-std::array<float,2>{0.315036088f, 0.976269543f},
-std::array<float,2>{0.973272085f, 0.388082325f},
-std::array<float,2>{0.193126291f, 0.195265487f},
-std::array<float,2>{0.605065286f, 0.563639462f},
-std::array<float,2>{0.0737043247f, 0.902641475f},
-std::array<float,2>{0.716215074f, 0.474322945f},
-std::array<float,2>{0.483574212f, 0.129437074f},
-std::array<float,2>{0.80614239f, 0.527887523f},
-std::array<float,2>{0.272537649f, 0.670339286f},
-std::array<float,2>{0.933565438f, 0.00705860788f},
-std::array<float,2>{0.125955656f, 0.328488946f},
-std::array<float,2>{0.539952457f, 0.807527661f},
-std::array<float,2>{0.23585476f, 0.621858478f},
-std::array<float,2>{0.573184133f, 0.223486438f},
-std::array<float,2>{0.368668377f, 0.421331674f},
-std::array<float,2>{0.951041162f, 0.963191807f},
-std::array<float,2>{0.405736804f, 0.869440198f},
-std::array<float,2>{0.816525698f, 0.265935242f},
-std::array<float,2>{0.0266063064f, 0.0864818841f},
-std::array<float,2>{0.652369261f, 0.720825315f},
-std::array<float,2>{0.00407120911f, 0.83265841f},
-std::array<float,2>{0.630746186f, 0.291135848f},
-std::array<float,2>{0.384380043f, 0.0964188054f},
-std::array<float,2>{0.834717989f, 0.699698508f},
-std::array<float,2>{0.358922005f, 0.591725171f},
-std::array<float,2>{0.96184206f, 0.214005589f},
-std::array<float,2>{0.233898982f, 0.394609213f},
-std::array<float,2>{0.578480959f, 0.988842547f},
-std::array<float,2>{0.15511328f, 0.637108922f},
-std::array<float,2>{0.553299546f, 0.0341922678f},
-std::array<float,2>{0.260896564f, 0.374587953f},
-std::array<float,2>{0.91564548f, 0.780679762f},
-std::array<float,2>{0.4848153f, 0.925538063f},
-std::array<float,2>{0.792940736f, 0.452726185f},
-std::array<float,2>{0.0838124901f, 0.178169519f},
-std::array<float,2>{0.687648237f, 0.533113897f},
-std::array<float,2>{0.207467183f, 0.95302099f},
-std::array<float,2>{0.622765422f, 0.425245017f},
-std::array<float,2>{0.337127626f, 0.246937469f},
-std::array<float,2>{0.997223318f, 0.608264267f},
-std::array<float,2>{0.412433714f, 0.738593996f},
-std::array<float,2>{0.855928719f, 0.0687610582f},
-std::array<float,2>{0.0399224386f, 0.253721178f},
-std::array<float,2>{0.668203771f, 0.848944783f},
-std::array<float,2>{0.114573561f, 0.515412688f},
-std::array<float,2>{0.731200933f, 0.144668266f},
-std::array<float,2>{0.454340428f, 0.489446998f},
-std::array<float,2>{0.776253343f, 0.886958539f},
-std::array<float,2>{0.310888708f, 0.786228001f},
-std::array<float,2>{0.879380167f, 0.317570955f},
-std::array<float,2>{0.160104766f, 0.0174265075f},
-std::array<float,2>{0.530974686f, 0.678296685f},
-std::array<float,2>{0.222085908f, 0.858867764f},
-std::array<float,2>{0.59075433f, 0.259415805f},
-std::array<float,2>{0.34777227f, 0.075938426f},
-std::array<float,2>{0.959364355f, 0.743342817f},
-std::array<float,2>{0.377673596f, 0.594150007f},
-std::array<float,2>{0.843218505f, 0.241798684f},
-std::array<float,2>{0.0114058508f, 0.434565008f},
-std::array<float,2>{0.637574315f, 0.940694034f},
-std::array<float,2>{0.0910284817f, 0.682960987f},
-std::array<float,2>{0.6953215f, 0.0259224046f},
-std::array<float,2>{0.499968171f, 0.321934551f},
-std::array<float,2>{0.785420239f, 0.796535611f},
-std::array<float,2>{0.251802295f, 0.875655353f},
-std::array<float,2>{0.908049762f, 0.496766508f},
-std::array<float,2>{0.142147541f, 0.155898958f},
-std::array<float,2>{0.556184709f, 0.501193345f},
-std::array<float,2>{0.0365979448f, 0.99426651f},
-std::array<float,2>{0.659062028f, 0.405263305f},
-std::array<float,2>{0.419266313f, 0.207843989f},
-std::array<float,2>{0.851228297f, 0.578503609f},
-std::array<float,2>{0.333381593f, 0.689987779f},
-std::array<float,2>{0.98795718f, 0.102441333f},
-std::array<float,2>{0.217472494f, 0.288544714f},
-std::array<float,2>{0.611902177f, 0.835963666f},
-std::array<float,2>{0.168753266f, 0.545659661f},
-std::array<float,2>{0.523245513f, 0.181748107f},
-std::array<float,2>{0.30463329f, 0.438502342f},
-std::array<float,2>{0.88303709f, 0.933885276f},
-std::array<float,2>{0.464646488f, 0.772340059f},
-std::array<float,2>{0.768269241f, 0.360828876f},
-std::array<float,2>{0.124546848f, 0.0391112119f},
-std::array<float,2>{0.720691323f, 0.626983762f},
-std::array<float,2>{0.100065947f, 0.797968328f},
-std::array<float,2>{0.737399757f, 0.341439307f},
-std::array<float,2>{0.452935517f, 0.0122940345f},
-std::array<float,2>{0.757410645f, 0.659149408f},
-std::array<float,2>{0.296729535f, 0.516658783f},
-std::array<float,2>{0.895373523f, 0.134025589f},
-std::array<float,2>{0.18717967f, 0.481663793f},
-std::array<float,2>{0.509331346f, 0.893816113f},
-std::array<float,2>{0.201496422f, 0.732195795f},
-std::array<float,2>{0.596145213f, 0.0826434344f},
-std::array<float,2>{0.32635361f, 0.274654388f},
-std::array<float,2>{0.977579474f, 0.859668374f},
-std::array<float,2>{0.42919299f, 0.9565624f},
-std::array<float,2>{0.868966699f, 0.412431479f},
-std::array<float,2>{0.0577300116f, 0.231691524f},
-std::array<float,2>{0.672047436f, 0.61303103f},
-std::array<float,2>{0.140211403f, 0.921306849f},
-std::array<float,2>{0.535277903f, 0.46481812f},
-std::array<float,2>{0.279916644f, 0.164675787f},
-std::array<float,2>{0.92506057f, 0.562245011f},
-std::array<float,2>{0.473783106f, 0.64425981f},
-std::array<float,2>{0.802513719f, 0.0505542792f},
-std::array<float,2>{0.0652703419f, 0.357647896f},
-std::array<float,2>{0.709722579f, 0.75810796f},
-std::array<float,2>{0.0198372472f, 0.571180046f},
-std::array<float,2>{0.645017266f, 0.196126625f},
-std::array<float,2>{0.397335261f, 0.381958783f},
-std::array<float,2>{0.823383629f, 0.981839895f},
-std::array<float,2>{0.359611958f, 0.824467719f},
-std::array<float,2>{0.940835476f, 0.310554087f},
-std::array<float,2>{0.248231247f, 0.11748378f},
-std::array<float,2>{0.564538419f, 0.71445483f},
-std::array<float,2>{0.147340268f, 0.815210223f},
-std::array<float,2>{0.55986315f, 0.303819239f},
-std::array<float,2>{0.255268425f, 0.116681248f},
-std::array<float,2>{0.913882315f, 0.707198799f},
-std::array<float,2>{0.494332641f, 0.568106115f},
-std::array<float,2>{0.783565462f, 0.188136131f},
-std::array<float,2>{0.0872515589f, 0.385173559f},
-std::array<float,2>{0.700807631f, 0.969425559f},
-std::array<float,2>{0.0143273333f, 0.649241745f},
-std::array<float,2>{0.636340559f, 0.0551174581f},
-std::array<float,2>{0.382520467f, 0.34769398f},
-std::array<float,2>{0.838131487f, 0.750459433f},
-std::array<float,2>{0.345113993f, 0.907956064f},
-std::array<float,2>{0.953372061f, 0.458894134f},
-std::array<float,2>{0.225374594f, 0.156669959f},
-std::array<float,2>{0.587965667f, 0.553624511f},
-std::array<float,2>{0.118995942f, 0.966440439f},
-std::array<float,2>{0.723637462f, 0.414133877f},
-std::array<float,2>{0.465661705f, 0.218961746f},
-std::array<float,2>{0.772155881f, 0.620917737f},
-std::array<float,2>{0.299709588f, 0.722721279f},
-std::array<float,2>{0.889937103f, 0.093243517f},
-std::array<float,2>{0.165078625f, 0.271652609f},
-std::array<float,2>{0.517607868f, 0.87466228f},
-std::array<float,2>{0.211375192f, 0.526098907f},
-std::array<float,2>{0.616378903f, 0.127536401f},
-std::array<float,2>{0.330331713f, 0.468909115f},
-std::array<float,2>{0.988454998f, 0.898589969f},
-std::array<float,2>{0.414224267f, 0.810094655f},
-std::array<float,2>{0.844927847f, 0.335323632f},
-std::array<float,2>{0.0331953764f, 0.000943492341f},
-std::array<float,2>{0.663444519f, 0.666076958f},
-std::array<float,2>{0.0591368936f, 0.776325285f},
-std::array<float,2>{0.677401721f, 0.370610952f},
-std::array<float,2>{0.423530042f, 0.0385527946f},
-std::array<float,2>{0.872845292f, 0.633862615f},
-std::array<float,2>{0.320830166f, 0.536639333f},
-std::array<float,2>{0.980956674f, 0.175076723f},
-std::array<float,2>{0.197675467f, 0.446171045f},
-std::array<float,2>{0.601069689f, 0.929290533f},
-std::array<float,2>{0.181598246f, 0.696628273f},
-std::array<float,2>{0.515387297f, 0.101414979f},
-std::array<float,2>{0.292088628f, 0.293163836f},
-std::array<float,2>{0.89444989f, 0.83000809f},
-std::array<float,2>{0.44872579f, 0.985895097f},
-std::array<float,2>{0.752230525f, 0.391637862f},
-std::array<float,2>{0.094031252f, 0.217212364f},
-std::array<float,2>{0.73971957f, 0.589589834f},
-std::array<float,2>{0.245747894f, 0.883220553f},
-std::array<float,2>{0.567877054f, 0.485330731f},
-std::array<float,2>{0.364942074f, 0.143076628f},
-std::array<float,2>{0.945185363f, 0.509731531f},
-std::array<float,2>{0.391135007f, 0.673573613f},
-std::array<float,2>{0.827807009f, 0.020627562f},
-std::array<float,2>{0.0186994877f, 0.313209414f},
-std::array<float,2>{0.643405735f, 0.783015609f},
-std::array<float,2>{0.0691616833f, 0.601676583f},
-std::array<float,2>{0.703315914f, 0.245559946f},
-std::array<float,2>{0.46981895f, 0.426246464f},
-std::array<float,2>{0.797359943f, 0.9481619f},
-std::array<float,2>{0.274572492f, 0.846943021f},
-std::array<float,2>{0.928845763f, 0.256717712f},
-std::array<float,2>{0.133553445f, 0.0627629086f},
-std::array<float,2>{0.532007873f, 0.735239685f},
-std::array<float,2>{0.190405995f, 0.792839527f},
-std::array<float,2>{0.607722938f, 0.325425923f},
-std::array<float,2>{0.31875357f, 0.0287736412f},
-std::array<float,2>{0.96983099f, 0.685283184f},
-std::array<float,2>{0.434461743f, 0.506356061f},
-std::array<float,2>{0.861327291f, 0.148470789f},
-std::array<float,2>{0.0511228815f, 0.495606869f},
-std::array<float,2>{0.680642307f, 0.882191598f},
-std::array<float,2>{0.104907334f, 0.746856451f},
-std::array<float,2>{0.74868983f, 0.0728993341f},
-std::array<float,2>{0.44109568f, 0.261840612f},
-std::array<float,2>{0.765552521f, 0.854517937f},
-std::array<float,2>{0.28361097f, 0.942131221f},
-std::array<float,2>{0.903394639f, 0.430914968f},
-std::array<float,2>{0.179451793f, 0.235989019f},
-std::array<float,2>{0.507178605f, 0.597717285f},
-std::array<float,2>{0.0278711375f, 0.932211757f},
-std::array<float,2>{0.650769174f, 0.44408378f},
-std::array<float,2>{0.401419401f, 0.18729347f},
-std::array<float,2>{0.81450212f, 0.53929913f},
-std::array<float,2>{0.371300191f, 0.632766247f},
-std::array<float,2>{0.948400199f, 0.0435221009f},
-std::array<float,2>{0.241778135f, 0.366691917f},
-std::array<float,2>{0.576141298f, 0.765882671f},
-std::array<float,2>{0.131405935f, 0.584601343f},
-std::array<float,2>{0.543865323f, 0.206503212f},
-std::array<float,2>{0.268936694f, 0.399175316f},
-std::array<float,2>{0.937338948f, 0.99770242f},
-std::array<float,2>{0.479602993f, 0.841415405f},
-std::array<float,2>{0.808925688f, 0.284492105f},
-std::array<float,2>{0.0756442696f, 0.108623847f},
-std::array<float,2>{0.710995436f, 0.692098916f},
-std::array<float,2>{0.0793360248f, 0.866068721f},
-std::array<float,2>{0.694614887f, 0.281115055f},
-std::array<float,2>{0.49217701f, 0.0814945176f},
-std::array<float,2>{0.796445787f, 0.728000879f},
-std::array<float,2>{0.263657421f, 0.614068568f},
-std::array<float,2>{0.92027241f, 0.228110895f},
-std::array<float,2>{0.148658141f, 0.40993166f},
-std::array<float,2>{0.547826767f, 0.958930075f},
-std::array<float,2>{0.228021115f, 0.66162312f},
-std::array<float,2>{0.584212899f, 0.0101348748f},
-std::array<float,2>{0.354692072f, 0.339636981f},
-std::array<float,2>{0.965186656f, 0.801745832f},
-std::array<float,2>{0.388215423f, 0.897147715f},
-std::array<float,2>{0.829466283f, 0.476970851f},
-std::array<float,2>{0.00208020187f, 0.139407456f},
-std::array<float,2>{0.625386953f, 0.520783126f},
-std::array<float,2>{0.162544608f, 0.978352129f},
-std::array<float,2>{0.52366817f, 0.377782017f},
-std::array<float,2>{0.306349456f, 0.202582017f},
-std::array<float,2>{0.875394106f, 0.576568127f},
-std::array<float,2>{0.458425462f, 0.716439962f},
-std::array<float,2>{0.780054748f, 0.122713879f},
-std::array<float,2>{0.112246156f, 0.306523442f},
-std::array<float,2>{0.730438232f, 0.820875525f},
-std::array<float,2>{0.0463605151f, 0.558593631f},
-std::array<float,2>{0.665077388f, 0.168091685f},
-std::array<float,2>{0.406804293f, 0.466125041f},
-std::array<float,2>{0.853434682f, 0.916618824f},
-std::array<float,2>{0.343487233f, 0.762265623f},
-std::array<float,2>{0.995298028f, 0.352236509f},
-std::array<float,2>{0.206303954f, 0.0510541573f},
-std::array<float,2>{0.620154679f, 0.645576656f}}
\ No newline at end of file
@@ -1,4096 +0,0 @@
-{std::array<float,2>{0.261031091f, 0.573835552f},
-std::array<float,2>{0.619873881f, 0.0593113042f},
-std::array<float,2>{0.888462663f, 0.90339005f},
-std::array<float,2>{0.0495356396f, 0.283745348f},
-std::array<float,2>{0.22239171f, 0.842199683f},
-std::array<float,2>{0.77795881f, 0.397960007f},
-std::array<float,2>{0.632026553f, 0.648083329f},
-std::array<float,2>{0.48567915f, 0.140898377f},
-std::array<float,2>{0.0633048937f, 0.724983156f},
-std::array<float,2>{0.94822371f, 0.245911956f},
-std::array<float,2>{0.503131926f, 0.780363441f},
-std::array<float,2>{0.324440926f, 0.473010451f},
-std::array<float,2>{0.39688614f, 0.956922352f},
-std::array<float,2>{0.746812165f, 0.321484804f},
-std::array<float,2>{0.85325551f, 0.512144923f},
-std::array<float,2>{0.164687902f, 0.0689483434f},
-std::array<float,2>{0.438440531f, 0.682169735f},
-std::array<float,2>{0.666739941f, 0.181840584f},
-std::array<float,2>{0.793143153f, 0.864985108f},
-std::array<float,2>{0.214451596f, 0.436255813f},
-std::array<float,2>{0.0309390984f, 0.92673558f},
-std::array<float,2>{0.910760164f, 0.256954312f},
-std::array<float,2>{0.564989984f, 0.609857857f},
-std::array<float,2>{0.293683261f, 0.0270443261f},
-std::array<float,2>{0.155263543f, 0.552453697f},
-std::array<float,2>{0.821009755f, 0.105121337f},
-std::array<float,2>{0.718599439f, 0.979357719f},
-std::array<float,2>{0.431359082f, 0.371854037f},
-std::array<float,2>{0.343981951f, 0.800315022f},
-std::array<float,2>{0.549379647f, 0.463336259f},
-std::array<float,2>{0.977895856f, 0.716866493f},
-std::array<float,2>{0.109715559f, 0.200775355f},
-std::array<float,2>{0.417415351f, 0.527724862f},
-std::array<float,2>{0.695195019f, 0.0801915377f},
-std::array<float,2>{0.841219664f, 0.94431299f},
-std::array<float,2>{0.139042601f, 0.329746842f},
-std::array<float,2>{0.0965126082f, 0.764542639f},
-std::array<float,2>{0.99990201f, 0.497311294f},
-std::array<float,2>{0.542621315f, 0.745794713f},
-std::array<float,2>{0.369959235f, 0.233244628f},
-std::array<float,2>{0.19437547f, 0.629705608f},
-std::array<float,2>{0.800222158f, 0.138047352f},
-std::array<float,2>{0.673258543f, 0.820924044f},
-std::array<float,2>{0.454710782f, 0.383994877f},
-std::array<float,2>{0.302457005f, 0.881563604f},
-std::array<float,2>{0.587162554f, 0.300484717f},
-std::array<float,2>{0.924779177f, 0.589084506f},
-std::array<float,2>{0.0072038332f, 0.0441565216f},
-std::array<float,2>{0.340490133f, 0.693407297f},
-std::array<float,2>{0.524855018f, 0.21739307f},
-std::array<float,2>{0.960588634f, 0.78342396f},
-std::array<float,2>{0.0811077952f, 0.452529371f},
-std::array<float,2>{0.178921267f, 0.996866524f},
-std::array<float,2>{0.874985039f, 0.348303676f},
-std::array<float,2>{0.731522977f, 0.533313036f},
-std::array<float,2>{0.376078784f, 0.119912609f},
-std::array<float,2>{0.0315093212f, 0.596171796f},
-std::array<float,2>{0.892867982f, 0.0107902009f},
-std::array<float,2>{0.597459614f, 0.919068098f},
-std::array<float,2>{0.281131268f, 0.280674547f},
-std::array<float,2>{0.479818106f, 0.856965244f},
-std::array<float,2>{0.643942177f, 0.408579677f},
-std::array<float,2>{0.761830926f, 0.667892933f},
-std::array<float,2>{0.236859664f, 0.161743075f},
-std::array<float,2>{0.364687294f, 0.544406533f},
-std::array<float,2>{0.537172735f, 0.110562615f},
-std::array<float,2>{0.990939438f, 0.99115169f},
-std::array<float,2>{0.108286656f, 0.356135011f},
-std::array<float,2>{0.127234563f, 0.791741252f},
-std::array<float,2>{0.830874383f, 0.445020646f},
-std::array<float,2>{0.698304296f, 0.695938289f},
-std::array<float,2>{0.411280215f, 0.203982159f},
-std::array<float,2>{0.00811272673f, 0.660720646f},
-std::array<float,2>{0.932485104f, 0.164739057f},
-std::array<float,2>{0.580456197f, 0.844785631f},
-std::array<float,2>{0.309777617f, 0.41896987f},
-std::array<float,2>{0.461261958f, 0.908449769f},
-std::array<float,2>{0.680892467f, 0.272542268f},
-std::array<float,2>{0.809706867f, 0.604522884f},
-std::array<float,2>{0.198526561f, 0.00304306578f},
-std::array<float,2>{0.385795027f, 0.736857176f},
-std::array<float,2>{0.723730743f, 0.220943823f},
-std::array<float,2>{0.860666096f, 0.755696356f},
-std::array<float,2>{0.180824772f, 0.485392481f},
-std::array<float,2>{0.0859902948f, 0.947476029f},
-std::array<float,2>{0.962567568f, 0.343041867f},
-std::array<float,2>{0.516256154f, 0.522772014f},
-std::array<float,2>{0.335586905f, 0.0896983892f},
-std::array<float,2>{0.2462852f, 0.585855246f},
-std::array<float,2>{0.755371332f, 0.0371620841f},
-std::array<float,2>{0.654983222f, 0.889605939f},
-std::array<float,2>{0.469005734f, 0.311121821f},
-std::array<float,2>{0.271051347f, 0.815126777f},
-std::array<float,2>{0.606781065f, 0.381471217f},
-std::array<float,2>{0.902752638f, 0.634188771f},
-std::array<float,2>{0.0449128486f, 0.127490416f},
-std::array<float,2>{0.497701675f, 0.617945015f},
-std::array<float,2>{0.640392959f, 0.0160877053f},
-std::array<float,2>{0.768090725f, 0.929748118f},
-std::array<float,2>{0.23240146f, 0.261810392f},
-std::array<float,2>{0.0614422895f, 0.874496579f},
-std::array<float,2>{0.877851486f, 0.428017259f},
-std::array<float,2>{0.613708436f, 0.675873995f},
-std::array<float,2>{0.250607491f, 0.174876317f},
-std::array<float,2>{0.158886701f, 0.709430099f},
-std::array<float,2>{0.848238766f, 0.193440393f},
-std::array<float,2>{0.736076772f, 0.807442009f},
-std::array<float,2>{0.402996093f, 0.456569761f},
-std::array<float,2>{0.313277602f, 0.974356532f},
-std::array<float,2>{0.510340571f, 0.361759633f},
-std::array<float,2>{0.944764376f, 0.561540127f},
-std::array<float,2>{0.0758064017f, 0.0984769985f},
-std::array<float,2>{0.288638562f, 0.650054157f},
-std::array<float,2>{0.576496363f, 0.149537489f},
-std::array<float,2>{0.914235771f, 0.834526241f},
-std::array<float,2>{0.0164591782f, 0.405126303f},
-std::array<float,2>{0.207538769f, 0.891869009f},
-std::array<float,2>{0.788203776f, 0.291272789f},
-std::array<float,2>{0.662479162f, 0.563363552f},
-std::array<float,2>{0.450963348f, 0.052254539f},
-std::array<float,2>{0.11806073f, 0.503889859f},
-std::array<float,2>{0.975215018f, 0.0737566128f},
-std::array<float,2>{0.561814487f, 0.964267313f},
-std::array<float,2>{0.356232136f, 0.318479955f},
-std::array<float,2>{0.428237051f, 0.768201947f},
-std::array<float,2>{0.708790362f, 0.482421607f},
-std::array<float,2>{0.812758505f, 0.732328832f},
-std::array<float,2>{0.145469114f, 0.24151282f},
-std::array<float,2>{0.306307763f, 0.510699153f},
-std::array<float,2>{0.585062683f, 0.0626118258f},
-std::array<float,2>{0.934679866f, 0.959749103f},
-std::array<float,2>{0.0123688988f, 0.327947408f},
-std::array<float,2>{0.19952634f, 0.774827838f},
-std::array<float,2>{0.804695845f, 0.470031053f},
-std::array<float,2>{0.684475958f, 0.721367478f},
-std::array<float,2>{0.466791689f, 0.24970834f},
-std::array<float,2>{0.104306512f, 0.641004682f},
-std::array<float,2>{0.986448169f, 0.148306176f},
-std::array<float,2>{0.531278253f, 0.837065101f},
-std::array<float,2>{0.362464815f, 0.392219722f},
-std::array<float,2>{0.407916933f, 0.898771465f},
-std::array<float,2>{0.702794969f, 0.288485736f},
-std::array<float,2>{0.833403826f, 0.575727761f},
-std::array<float,2>{0.131703228f, 0.0582489111f},
-std::array<float,2>{0.474277884f, 0.712131321f},
-std::array<float,2>{0.64958787f, 0.19550246f},
-std::array<float,2>{0.751186192f, 0.802256167f},
-std::array<float,2>{0.245477498f, 0.467681557f},
-std::array<float,2>{0.0424560271f, 0.982625067f},
-std::array<float,2>{0.901703775f, 0.369166881f},
-std::array<float,2>{0.605084121f, 0.550366104f},
-std::array<float,2>{0.266657412f, 0.106909402f},
-std::array<float,2>{0.186215684f, 0.61535728f},
-std::array<float,2>{0.866897702f, 0.0295088813f},
-std::array<float,2>{0.721127689f, 0.924193978f},
-std::array<float,2>{0.389841467f, 0.25003621f},
-std::array<float,2>{0.328686208f, 0.860922337f},
-std::array<float,2>{0.522187769f, 0.430583477f},
-std::array<float,2>{0.965138316f, 0.684970379f},
-std::array<float,2>{0.0899659023f, 0.184621871f},
-std::array<float,2>{0.401610821f, 0.591507554f},
-std::array<float,2>{0.742177129f, 0.0422582068f},
-std::array<float,2>{0.84699446f, 0.875303447f},
-std::array<float,2>{0.160497338f, 0.301015913f},
-std::array<float,2>{0.0723658875f, 0.826704741f},
-std::array<float,2>{0.938695014f, 0.390190542f},
-std::array<float,2>{0.515225172f, 0.626189411f},
-std::array<float,2>{0.319773227f, 0.136599839f},
-std::array<float,2>{0.229505301f, 0.74673605f},
-std::array<float,2>{0.770859778f, 0.227932826f},
-std::array<float,2>{0.635265708f, 0.758381784f},
-std::array<float,2>{0.49261871f, 0.494262099f},
-std::array<float,2>{0.256738216f, 0.938276947f},
-std::array<float,2>{0.612670064f, 0.333675206f},
-std::array<float,2>{0.881599069f, 0.526881635f},
-std::array<float,2>{0.0549078286f, 0.0837177634f},
-std::array<float,2>{0.352196902f, 0.671052039f},
-std::array<float,2>{0.556037068f, 0.158717409f},
-std::array<float,2>{0.970089138f, 0.854160309f},
-std::array<float,2>{0.124498948f, 0.412227988f},
-std::array<float,2>{0.142085284f, 0.914123178f},
-std::array<float,2>{0.819134653f, 0.276877642f},
-std::array<float,2>{0.703634024f, 0.59972477f},
-std::array<float,2>{0.42318511f, 0.0121938903f},
-std::array<float,2>{0.0224426184f, 0.536115646f},
-std::array<float,2>{0.921431482f, 0.121503837f},
-std::array<float,2>{0.572974145f, 0.992861092f},
-std::array<float,2>{0.283718348f, 0.347377956f},
-std::array<float,2>{0.447813958f, 0.787127972f},
-std::array<float,2>{0.658814132f, 0.446380436f},
-std::array<float,2>{0.783496439f, 0.688423574f},
-std::array<float,2>{0.205349743f, 0.214678302f},
-std::array<float,2>{0.323569477f, 0.608337581f},
-std::array<float,2>{0.507381022f, 0.00610021967f},
-std::array<float,2>{0.949695289f, 0.910790205f},
-std::array<float,2>{0.066871196f, 0.266810864f},
-std::array<float,2>{0.170734465f, 0.848134339f},
-std::array<float,2>{0.856495261f, 0.415619731f},
-std::array<float,2>{0.744002461f, 0.659467161f},
-std::array<float,2>{0.394431204f, 0.168809816f},
-std::array<float,2>{0.0532698631f, 0.699939072f},
-std::array<float,2>{0.885382771f, 0.208303764f},
-std::array<float,2>{0.622385025f, 0.795464873f},
-std::array<float,2>{0.26548624f, 0.440647602f},
-std::array<float,2>{0.489342391f, 0.984750688f},
-std::array<float,2>{0.626400352f, 0.35522756f},
-std::array<float,2>{0.776680708f, 0.53982842f},
-std::array<float,2>{0.2245868f, 0.11558757f},
-std::array<float,2>{0.437203676f, 0.636972964f},
-std::array<float,2>{0.712478459f, 0.130416945f},
-std::array<float,2>{0.82745415f, 0.818099737f},
-std::array<float,2>{0.148820952f, 0.376979858f},
-std::array<float,2>{0.116790555f, 0.884064853f},
-std::array<float,2>{0.983062327f, 0.304751843f},
-std::array<float,2>{0.552833319f, 0.581151426f},
-std::array<float,2>{0.347692192f, 0.0343819782f},
-std::array<float,2>{0.216982573f, 0.517332315f},
-std::array<float,2>{0.7894485f, 0.0923620984f},
-std::array<float,2>{0.670137465f, 0.952266753f},
-std::array<float,2>{0.443027586f, 0.33797434f},
-std::array<float,2>{0.2911174f, 0.751872122f},
-std::array<float,2>{0.569258094f, 0.488721818f},
-std::array<float,2>{0.908952355f, 0.74009949f},
-std::array<float,2>{0.0235485174f, 0.224869445f},
-std::array<float,2>{0.457563281f, 0.556077421f},
-std::array<float,2>{0.678494394f, 0.0956356078f},
-std::array<float,2>{0.802171648f, 0.971919179f},
-std::array<float,2>{0.18824248f, 0.365013003f},
-std::array<float,2>{0.000453597604f, 0.81105727f},
-std::array<float,2>{0.92913878f, 0.458620489f},
-std::array<float,2>{0.591080189f, 0.704266548f},
-std::array<float,2>{0.299543917f, 0.19038339f},
-std::array<float,2>{0.134306118f, 0.672870338f},
-std::array<float,2>{0.8361727f, 0.17884548f},
-std::array<float,2>{0.688448668f, 0.869327724f},
-std::array<float,2>{0.418627411f, 0.424178928f},
-std::array<float,2>{0.372898519f, 0.935513616f},
-std::array<float,2>{0.54671967f, 0.258721232f},
-std::array<float,2>{0.99369818f, 0.624432445f},
-std::array<float,2>{0.0994635746f, 0.02059309f},
-std::array<float,2>{0.27514258f, 0.729557812f},
-std::array<float,2>{0.600952327f, 0.237494811f},
-std::array<float,2>{0.896371841f, 0.772146344f},
-std::array<float,2>{0.0378462076f, 0.479965866f},
-std::array<float,2>{0.238293022f, 0.968039274f},
-std::array<float,2>{0.761385143f, 0.314874142f},
-std::array<float,2>{0.648349941f, 0.505653024f},
-std::array<float,2>{0.484351069f, 0.0770711675f},
-std::array<float,2>{0.0820512325f, 0.567447305f},
-std::array<float,2>{0.954875946f, 0.048332382f},
-std::array<float,2>{0.528272271f, 0.895022631f},
-std::array<float,2>{0.336588472f, 0.294543535f},
-std::array<float,2>{0.382416874f, 0.82872963f},
-std::array<float,2>{0.726778328f, 0.399118006f},
-std::array<float,2>{0.869764447f, 0.655935526f},
-std::array<float,2>{0.174816415f, 0.15313141f},
-std::array<float,2>{0.295654535f, 0.611766815f},
-std::array<float,2>{0.563556135f, 0.0248270575f},
-std::array<float,2>{0.91289252f, 0.928557694f},
-std::array<float,2>{0.0289809201f, 0.255801171f},
-std::array<float,2>{0.211326763f, 0.866150975f},
-std::array<float,2>{0.795925617f, 0.435527503f},
-std::array<float,2>{0.664263964f, 0.681236148f},
-std::array<float,2>{0.44075954f, 0.179847315f},
-std::array<float,2>{0.112272024f, 0.716059744f},
-std::array<float,2>{0.979127765f, 0.202127129f},
-std::array<float,2>{0.547493517f, 0.798705399f},
-std::array<float,2>{0.346413672f, 0.462244391f},
-std::array<float,2>{0.432526439f, 0.978386045f},
-std::array<float,2>{0.715706944f, 0.374170095f},
-std::array<float,2>{0.82302165f, 0.553924382f},
-std::array<float,2>{0.152995229f, 0.102899276f},
-std::array<float,2>{0.487688035f, 0.64511925f},
-std::array<float,2>{0.629076123f, 0.142902434f},
-std::array<float,2>{0.780016422f, 0.840094864f},
-std::array<float,2>{0.220584974f, 0.396047175f},
-std::array<float,2>{0.0469113104f, 0.905471742f},
-std::array<float,2>{0.890240788f, 0.282276034f},
-std::array<float,2>{0.617349803f, 0.571609616f},
-std::array<float,2>{0.258446693f, 0.0624139719f},
-std::array<float,2>{0.166351601f, 0.514259636f},
-std::array<float,2>{0.854849756f, 0.0672633201f},
-std::array<float,2>{0.749254167f, 0.9534958f},
-std::array<float,2>{0.396028131f, 0.322908312f},
-std::array<float,2>{0.326803893f, 0.778257668f},
-std::array<float,2>{0.500962913f, 0.474877596f},
-std::array<float,2>{0.946735322f, 0.722682774f},
-std::array<float,2>{0.0648817271f, 0.24290885f},
-std::array<float,2>{0.377039999f, 0.53172493f},
-std::array<float,2>{0.733525574f, 0.117505826f},
-std::array<float,2>{0.872924089f, 0.998788238f},
-std::array<float,2>{0.177635416f, 0.350261986f},
-std::array<float,2>{0.0781991854f, 0.781323075f},
-std::array<float,2>{0.957571566f, 0.45083034f},
-std::array<float,2>{0.527002692f, 0.6919626f},
-std::array<float,2>{0.341953307f, 0.216315806f},
-std::array<float,2>{0.236249387f, 0.664091647f},
-std::array<float,2>{0.765130937f, 0.162208363f},
-std::array<float,2>{0.642113507f, 0.858959913f},
-std::array<float,2>{0.47742942f, 0.407937169f},
-std::array<float,2>{0.278871417f, 0.920324564f},
-std::array<float,2>{0.595623434f, 0.278732538f},
-std::array<float,2>{0.89212352f, 0.594076395f},
-std::array<float,2>{0.0341684483f, 0.00925053004f},
-std::array<float,2>{0.368261814f, 0.74286896f},
-std::array<float,2>{0.540415406f, 0.231374741f},
-std::array<float,2>{0.996813655f, 0.762380362f},
-std::array<float,2>{0.0952474996f, 0.498194963f},
-std::array<float,2>{0.137328237f, 0.941609025f},
-std::array<float,2>{0.843350589f, 0.331787735f},
-std::array<float,2>{0.693242311f, 0.530817568f},
-std::array<float,2>{0.41572237f, 0.0795927122f},
-std::array<float,2>{0.00556222023f, 0.587152541f},
-std::array<float,2>{0.923776805f, 0.0462134257f},
-std::array<float,2>{0.589059353f, 0.879518032f},
-std::array<float,2>{0.302782655f, 0.297894508f},
-std::array<float,2>{0.455211937f, 0.823918343f},
-std::array<float,2>{0.674144924f, 0.384792656f},
-std::array<float,2>{0.797239542f, 0.631491482f},
-std::array<float,2>{0.191791207f, 0.139827549f},
-std::array<float,2>{0.333344728f, 0.521395802f},
-std::array<float,2>{0.519218743f, 0.0868490934f},
-std::array<float,2>{0.963950098f, 0.945462942f},
-std::array<float,2>{0.0897426903f, 0.340091705f},
-std::array<float,2>{0.182663232f, 0.756679952f},
-std::array<float,2>{0.862030387f, 0.488013357f},
-std::array<float,2>{0.725870848f, 0.734421015f},
-std::array<float,2>{0.38321346f, 0.21981141f},
-std::array<float,2>{0.0458781756f, 0.636078119f},
-std::array<float,2>{0.905860662f, 0.126540557f},
-std::array<float,2>{0.608281374f, 0.814101338f},
-std::array<float,2>{0.273061007f, 0.38061285f},
-std::array<float,2>{0.47162807f, 0.888090491f},
-std::array<float,2>{0.653195858f, 0.309533954f},
-std::array<float,2>{0.757591665f, 0.582497418f},
-std::array<float,2>{0.249397546f, 0.0360068046f},
-std::array<float,2>{0.413996786f, 0.698025286f},
-std::array<float,2>{0.697247624f, 0.206288576f},
-std::array<float,2>{0.828393936f, 0.789979041f},
-std::array<float,2>{0.126885951f, 0.442850024f},
-std::array<float,2>{0.105970331f, 0.989462793f},
-std::array<float,2>{0.988722324f, 0.358000517f},
-std::array<float,2>{0.535935044f, 0.545756698f},
-std::array<float,2>{0.365897208f, 0.113046624f},
-std::array<float,2>{0.19599618f, 0.601982296f},
-std::array<float,2>{0.810620308f, 0.00194661936f},
-std::array<float,2>{0.682310641f, 0.907702923f},
-std::array<float,2>{0.463785619f, 0.271240443f},
-std::array<float,2>{0.311073571f, 0.84677875f},
-std::array<float,2>{0.57996881f, 0.421240002f},
-std::array<float,2>{0.930074394f, 0.662554562f},
-std::array<float,2>{0.0104295695f, 0.167567685f},
-std::array<float,2>{0.451453269f, 0.565499187f},
-std::array<float,2>{0.661770403f, 0.0542023443f},
-std::array<float,2>{0.786367536f, 0.894189894f},
-std::array<float,2>{0.210704535f, 0.290666699f},
-std::array<float,2>{0.0194775071f, 0.832080662f},
-std::array<float,2>{0.917514741f, 0.402502418f},
-std::array<float,2>{0.575209737f, 0.65070504f},
-std::array<float,2>{0.28555271f, 0.151006743f},
-std::array<float,2>{0.147476196f, 0.733663499f},
-std::array<float,2>{0.81572336f, 0.239002556f},
-std::array<float,2>{0.710680127f, 0.766426921f},
-std::array<float,2>{0.426032394f, 0.482630223f},
-std::array<float,2>{0.357890129f, 0.961689115f},
-std::array<float,2>{0.559528828f, 0.317027062f},
-std::array<float,2>{0.974389255f, 0.501249611f},
-std::array<float,2>{0.119840734f, 0.071939081f},
-std::array<float,2>{0.252693534f, 0.678185403f},
-std::array<float,2>{0.616283655f, 0.173151478f},
-std::array<float,2>{0.875021994f, 0.872873187f},
-std::array<float,2>{0.0593030527f, 0.426356912f},
-std::array<float,2>{0.232678518f, 0.932231486f},
-std::array<float,2>{0.766780257f, 0.264828891f},
-std::array<float,2>{0.636726677f, 0.62098664f},
-std::array<float,2>{0.498073995f, 0.0192847829f},
-std::array<float,2>{0.0778989047f, 0.559116721f},
-std::array<float,2>{0.942260802f, 0.100341536f},
-std::array<float,2>{0.508298099f, 0.975593984f},
-std::array<float,2>{0.315134436f, 0.359600723f},
-std::array<float,2>{0.404739827f, 0.80638808f},
-std::array<float,2>{0.736705124f, 0.453754842f},
-std::array<float,2>{0.850065529f, 0.707108676f},
-std::array<float,2>{0.156339079f, 0.19140771f},
-std::array<float,2>{0.267585784f, 0.547512293f},
-std::array<float,2>{0.602921665f, 0.107976541f},
-std::array<float,2>{0.898951411f, 0.980496228f},
-std::array<float,2>{0.0409140177f, 0.368118167f},
-std::array<float,2>{0.243584573f, 0.803801179f},
-std::array<float,2>{0.752370715f, 0.46571371f},
-std::array<float,2>{0.651901424f, 0.712985575f},
-std::array<float,2>{0.47586596f, 0.198147088f},
-std::array<float,2>{0.0919932127f, 0.686629713f},
-std::array<float,2>{0.968406379f, 0.186441734f},
-std::array<float,2>{0.52001363f, 0.862897456f},
-std::array<float,2>{0.331047714f, 0.431931823f},
-std::array<float,2>{0.387253612f, 0.922411799f},
-std::array<float,2>{0.720058262f, 0.252157509f},
-std::array<float,2>{0.863694072f, 0.613333285f},
-std::array<float,2>{0.184102774f, 0.0278084669f},
-std::array<float,2>{0.467225134f, 0.720013857f},
-std::array<float,2>{0.685829401f, 0.246100739f},
-std::array<float,2>{0.807140887f, 0.777148366f},
-std::array<float,2>{0.201908126f, 0.472099274f},
-std::array<float,2>{0.0143656833f, 0.958518505f},
-std::array<float,2>{0.936644197f, 0.325133383f},
-std::array<float,2>{0.582077146f, 0.5092116f},
-std::array<float,2>{0.30808574f, 0.0657824203f},
-std::array<float,2>{0.129509106f, 0.5777964f},
-std::array<float,2>{0.83555758f, 0.0549075939f},
-std::array<float,2>{0.699545443f, 0.901748776f},
-std::array<float,2>{0.409421176f, 0.285286278f},
-std::array<float,2>{0.360017061f, 0.838454902f},
-std::array<float,2>{0.534297347f, 0.393343747f},
-std::array<float,2>{0.985673249f, 0.643401444f},
-std::array<float,2>{0.103364974f, 0.145258427f},
-std::array<float,2>{0.424839526f, 0.598219275f},
-std::array<float,2>{0.705144823f, 0.0149115892f},
-std::array<float,2>{0.817251801f, 0.916053653f},
-std::array<float,2>{0.142942011f, 0.273979813f},
-std::array<float,2>{0.121713057f, 0.852272511f},
-std::array<float,2>{0.970902383f, 0.411667109f},
-std::array<float,2>{0.557940125f, 0.669430137f},
-std::array<float,2>{0.353857547f, 0.15787895f},
-std::array<float,2>{0.203165203f, 0.690897346f},
-std::array<float,2>{0.781819463f, 0.211645871f},
-std::array<float,2>{0.656311631f, 0.785372972f},
-std::array<float,2>{0.446968317f, 0.448681653f},
-std::array<float,2>{0.282996356f, 0.994861782f},
-std::array<float,2>{0.572097301f, 0.34550342f},
-std::array<float,2>{0.918892264f, 0.538300276f},
-std::array<float,2>{0.0204549823f, 0.123233624f},
-std::array<float,2>{0.317899823f, 0.627715588f},
-std::array<float,2>{0.513548374f, 0.134515658f},
-std::array<float,2>{0.94024086f, 0.825630069f},
-std::array<float,2>{0.0713297129f, 0.387533665f},
-std::array<float,2>{0.16314742f, 0.878013492f},
-std::array<float,2>{0.844112873f, 0.304399163f},
-std::array<float,2>{0.739481747f, 0.591927826f},
-std::array<float,2>{0.398840338f, 0.0396662429f},
-std::array<float,2>{0.0566836149f, 0.523661196f},
-std::array<float,2>{0.88029021f, 0.0851557255f},
-std::array<float,2>{0.61014694f, 0.941154897f},
-std::array<float,2>{0.254666626f, 0.334820896f},
-std::array<float,2>{0.495122015f, 0.760332227f},
-std::array<float,2>{0.634178042f, 0.493690073f},
-std::array<float,2>{0.772891879f, 0.748605192f},
-std::array<float,2>{0.228012085f, 0.230148867f},
-std::array<float,2>{0.35100311f, 0.580074787f},
-std::array<float,2>{0.551213145f, 0.032561969f},
-std::array<float,2>{0.981939256f, 0.885734975f},
-std::array<float,2>{0.114328489f, 0.307900459f},
-std::array<float,2>{0.150731161f, 0.820287466f},
-std::array<float,2>{0.824507535f, 0.376738071f},
-std::array<float,2>{0.714827538f, 0.638839602f},
-std::array<float,2>{0.435191214f, 0.131137073f},
-std::array<float,2>{0.0271680281f, 0.740485072f},
-std::array<float,2>{0.908188701f, 0.222726017f},
-std::array<float,2>{0.56662035f, 0.752272606f},
-std::array<float,2>{0.290701717f, 0.491529316f},
-std::array<float,2>{0.444694072f, 0.949689209f},
-std::array<float,2>{0.669498682f, 0.336394906f},
-std::array<float,2>{0.791617811f, 0.517897785f},
-std::array<float,2>{0.214907572f, 0.0913489982f},
-std::array<float,2>{0.390847921f, 0.657950103f},
-std::array<float,2>{0.745969832f, 0.170836061f},
-std::array<float,2>{0.857962012f, 0.849883318f},
-std::array<float,2>{0.169657812f, 0.417268127f},
-std::array<float,2>{0.069928728f, 0.913019121f},
-std::array<float,2>{0.951534629f, 0.267690003f},
-std::array<float,2>{0.505208015f, 0.605774462f},
-std::array<float,2>{0.320817918f, 0.00484226597f},
-std::array<float,2>{0.225999713f, 0.542517781f},
-std::array<float,2>{0.77518791f, 0.113596484f},
-std::array<float,2>{0.627970695f, 0.988207638f},
-std::array<float,2>{0.491203934f, 0.351583093f},
-std::array<float,2>{0.262779593f, 0.794612825f},
-std::array<float,2>{0.623785317f, 0.438317955f},
-std::array<float,2>{0.883142948f, 0.701770365f},
-std::array<float,2>{0.0521012954f, 0.210763931f},
-std::array<float,2>{0.480936229f, 0.507417142f},
-std::array<float,2>{0.645430923f, 0.0761441514f},
-std::array<float,2>{0.759041011f, 0.966343641f},
-std::array<float,2>{0.240486145f, 0.31397894f},
-std::array<float,2>{0.0368937328f, 0.770249307f},
-std::array<float,2>{0.896972358f, 0.477371067f},
-std::array<float,2>{0.598516345f, 0.72792685f},
-std::array<float,2>{0.27573812f, 0.235453501f},
-std::array<float,2>{0.171967223f, 0.652909935f},
-std::array<float,2>{0.868189633f, 0.155255288f},
-std::array<float,2>{0.729596078f, 0.831327736f},
-std::array<float,2>{0.380170643f, 0.401413262f},
-std::array<float,2>{0.339490265f, 0.898317695f},
-std::array<float,2>{0.530515254f, 0.296238869f},
-std::array<float,2>{0.955757737f, 0.569275677f},
-std::array<float,2>{0.0854243264f, 0.0503526516f},
-std::array<float,2>{0.297693431f, 0.706351817f},
-std::array<float,2>{0.593321025f, 0.188824698f},
-std::array<float,2>{0.926354647f, 0.810152471f},
-std::array<float,2>{0.0033305902f, 0.460134476f},
-std::array<float,2>{0.190521032f, 0.969731331f},
-std::array<float,2>{0.80350703f, 0.366956264f},
-std::array<float,2>{0.676773012f, 0.5582847f},
-std::array<float,2>{0.460787922f, 0.0972503126f},
-std::array<float,2>{0.100703165f, 0.622542799f},
-std::array<float,2>{0.995642126f, 0.0228522178f},
-std::array<float,2>{0.543631196f, 0.936669528f},
-std::array<float,2>{0.374776363f, 0.26121363f},
-std::array<float,2>{0.420611531f, 0.868108034f},
-std::array<float,2>{0.689724207f, 0.423118293f},
-std::array<float,2>{0.838461876f, 0.67571044f},
-std::array<float,2>{0.136295766f, 0.177406192f},
-std::array<float,2>{0.303929418f, 0.58872807f},
-std::array<float,2>{0.588862836f, 0.043338038f},
-std::array<float,2>{0.922034025f, 0.882003248f},
-std::array<float,2>{0.00485993922f, 0.299611658f},
-std::array<float,2>{0.192820206f, 0.822251558f},
-std::array<float,2>{0.798792958f, 0.383455932f},
-std::array<float,2>{0.675123692f, 0.630637169f},
-std::array<float,2>{0.456127137f, 0.137491971f},
-std::array<float,2>{0.094253011f, 0.745050013f},
-std::array<float,2>{0.997471869f, 0.233929843f},
-std::array<float,2>{0.539510131f, 0.76473248f},
-std::array<float,2>{0.367476195f, 0.496254474f},
-std::array<float,2>{0.414134264f, 0.945074201f},
-std::array<float,2>{0.691989779f, 0.328527212f},
-std::array<float,2>{0.84234935f, 0.528450787f},
-std::array<float,2>{0.138186857f, 0.0815226883f},
-std::array<float,2>{0.478310794f, 0.666174829f},
-std::array<float,2>{0.641029418f, 0.160402432f},
-std::array<float,2>{0.76375562f, 0.85576719f},
-std::array<float,2>{0.23494716f, 0.409621477f},
-std::array<float,2>{0.0347982459f, 0.918420374f},
-std::array<float,2>{0.891391814f, 0.279611319f},
-std::array<float,2>{0.593984425f, 0.597528934f},
-std::array<float,2>{0.278001338f, 0.0105943345f},
-std::array<float,2>{0.176102415f, 0.53440541f},
-std::array<float,2>{0.871789455f, 0.120378561f},
-std::array<float,2>{0.732938051f, 0.997854948f},
-std::array<float,2>{0.378818482f, 0.348968178f},
-std::array<float,2>{0.342889011f, 0.78452903f},
-std::array<float,2>{0.525594056f, 0.451423138f},
-std::array<float,2>{0.958831906f, 0.694383502f},
-std::array<float,2>{0.079821147f, 0.218332797f},
-std::array<float,2>{0.395080298f, 0.512992144f},
-std::array<float,2>{0.748737037f, 0.0695813075f},
-std::array<float,2>{0.853955388f, 0.955984175f},
-std::array<float,2>{0.167541102f, 0.320815355f},
-std::array<float,2>{0.065593943f, 0.780107439f},
-std::array<float,2>{0.946002066f, 0.4745f},
-std::array<float,2>{0.501866758f, 0.726042211f},
-std::array<float,2>{0.327931762f, 0.244885072f},
-std::array<float,2>{0.218764365f, 0.646617234f},
-std::array<float,2>{0.780382812f, 0.14250274f},
-std::array<float,2>{0.630012274f, 0.843689322f},
-std::array<float,2>{0.487213165f, 0.397306919f},
-std::array<float,2>{0.25902608f, 0.902364552f},
-std::array<float,2>{0.618720293f, 0.28426832f},
-std::array<float,2>{0.889554918f, 0.572582662f},
-std::array<float,2>{0.0478711911f, 0.0603990927f},
-std::array<float,2>{0.347096741f, 0.718558729f},
-std::array<float,2>{0.548766077f, 0.200058416f},
-std::array<float,2>{0.979588509f, 0.799034774f},
-std::array<float,2>{0.112384096f, 0.464204162f},
-std::array<float,2>{0.153505683f, 0.979834259f},
-std::array<float,2>{0.823908389f, 0.372280449f},
-std::array<float,2>{0.716035187f, 0.551737428f},
-std::array<float,2>{0.432935625f, 0.104444697f},
-std::array<float,2>{0.0275676288f, 0.610446513f},
-std::array<float,2>{0.913337708f, 0.0261346437f},
-std::array<float,2>{0.56338501f, 0.927561164f},
-std::array<float,2>{0.29644835f, 0.256249487f},
-std::array<float,2>{0.43976149f, 0.863508999f},
-std::array<float,2>{0.665851891f, 0.437094361f},
-std::array<float,2>{0.79553026f, 0.68269825f},
-std::array<float,2>{0.212288201f, 0.183528706f},
-std::array<float,2>{0.315774024f, 0.560725629f},
-std::array<float,2>{0.509157598f, 0.0993199199f},
-std::array<float,2>{0.942563534f, 0.973180056f},
-std::array<float,2>{0.076339595f, 0.363067776f},
-std::array<float,2>{0.157347843f, 0.808461368f},
-std::array<float,2>{0.851042211f, 0.455557346f},
-std::array<float,2>{0.737668991f, 0.710788548f},
-std::array<float,2>{0.405946314f, 0.194680095f},
-std::array<float,2>{0.0600662977f, 0.677232206f},
-std::array<float,2>{0.876832426f, 0.174172595f},
-std::array<float,2>{0.615690708f, 0.873986363f},
-std::array<float,2>{0.253873914f, 0.429453701f},
-std::array<float,2>{0.499670982f, 0.931567669f},
-std::array<float,2>{0.637965202f, 0.263476163f},
-std::array<float,2>{0.765926123f, 0.618900061f},
-std::array<float,2>{0.233638495f, 0.016966708f},
-std::array<float,2>{0.42749849f, 0.730637491f},
-std::array<float,2>{0.709175229f, 0.241202429f},
-std::array<float,2>{0.814830303f, 0.769299209f},
-std::array<float,2>{0.146538258f, 0.481031805f},
-std::array<float,2>{0.120694056f, 0.963172078f},
-std::array<float,2>{0.973053396f, 0.319852799f},
-std::array<float,2>{0.559923708f, 0.502782464f},
-std::array<float,2>{0.358775347f, 0.0722859353f},
-std::array<float,2>{0.209289819f, 0.563680589f},
-std::array<float,2>{0.785652339f, 0.051698193f},
-std::array<float,2>{0.660602629f, 0.891519308f},
-std::array<float,2>{0.452313244f, 0.292170167f},
-std::array<float,2>{0.286488622f, 0.835198224f},
-std::array<float,2>{0.574824989f, 0.405477196f},
-std::array<float,2>{0.916435182f, 0.648789465f},
-std::array<float,2>{0.0184977558f, 0.148544252f},
-std::array<float,2>{0.464299023f, 0.604018748f},
-std::array<float,2>{0.682996333f, 0.00242247269f},
-std::array<float,2>{0.811554074f, 0.909837604f},
-std::array<float,2>{0.196496397f, 0.272206903f},
-std::array<float,2>{0.0113202315f, 0.844318151f},
-std::array<float,2>{0.93083787f, 0.418939441f},
-std::array<float,2>{0.578665555f, 0.662017226f},
-std::array<float,2>{0.312211752f, 0.165639281f},
-std::array<float,2>{0.12554267f, 0.696732044f},
-std::array<float,2>{0.830011785f, 0.204794779f},
-std::array<float,2>{0.695722282f, 0.792287886f},
-std::array<float,2>{0.412543088f, 0.443714827f},
-std::array<float,2>{0.366925985f, 0.991408765f},
-std::array<float,2>{0.536907256f, 0.356927574f},
-std::array<float,2>{0.989890635f, 0.543215752f},
-std::array<float,2>{0.10679201f, 0.109753475f},
-std::array<float,2>{0.271784335f, 0.633713841f},
-std::array<float,2>{0.60844177f, 0.128865287f},
-std::array<float,2>{0.904990315f, 0.815439999f},
-std::array<float,2>{0.0463816077f, 0.382246494f},
-std::array<float,2>{0.248107225f, 0.889881611f},
-std::array<float,2>{0.756181836f, 0.311625898f},
-std::array<float,2>{0.653951049f, 0.583992124f},
-std::array<float,2>{0.472475618f, 0.0389498062f},
-std::array<float,2>{0.0888478905f, 0.521955013f},
-std::array<float,2>{0.96379745f, 0.0880950838f},
-std::array<float,2>{0.517865419f, 0.948617458f},
-std::array<float,2>{0.332259834f, 0.342495829f},
-std::array<float,2>{0.384026527f, 0.754875779f},
-std::array<float,2>{0.724918485f, 0.484445572f},
-std::array<float,2>{0.862755477f, 0.73787117f},
-std::array<float,2>{0.182162762f, 0.222076148f},
-std::array<float,2>{0.255512238f, 0.526243508f},
-std::array<float,2>{0.610485315f, 0.0826799423f},
-std::array<float,2>{0.879026532f, 0.939305842f},
-std::array<float,2>{0.0579700097f, 0.332582712f},
-std::array<float,2>{0.227217942f, 0.759080827f},
-std::array<float,2>{0.772132874f, 0.496036798f},
-std::array<float,2>{0.633737266f, 0.747646272f},
-std::array<float,2>{0.494779497f, 0.227082476f},
-std::array<float,2>{0.0704462081f, 0.625299156f},
-std::array<float,2>{0.941345513f, 0.135206163f},
-std::array<float,2>{0.512392759f, 0.827646494f},
-std::array<float,2>{0.316543639f, 0.389385402f},
-std::array<float,2>{0.400226891f, 0.876577973f},
-std::array<float,2>{0.73850745f, 0.302433997f},
-std::array<float,2>{0.84477824f, 0.590573549f},
-std::array<float,2>{0.162604272f, 0.041237127f},
-std::array<float,2>{0.445728093f, 0.68898654f},
-std::array<float,2>{0.658199906f, 0.213439435f},
-std::array<float,2>{0.782880247f, 0.788346589f},
-std::array<float,2>{0.204379112f, 0.445587695f},
-std::array<float,2>{0.0213631783f, 0.993809342f},
-std::array<float,2>{0.919855773f, 0.346631825f},
-std::array<float,2>{0.570726216f, 0.536221385f},
-std::array<float,2>{0.281288803f, 0.122638099f},
-std::array<float,2>{0.14394407f, 0.60139221f},
-std::array<float,2>{0.817566633f, 0.012780319f},
-std::array<float,2>{0.706504583f, 0.915643215f},
-std::array<float,2>{0.424242198f, 0.275647849f},
-std::array<float,2>{0.355020046f, 0.854828954f},
-std::array<float,2>{0.557291985f, 0.413898885f},
-std::array<float,2>{0.972129345f, 0.670117915f},
-std::array<float,2>{0.122535549f, 0.159530222f},
-std::array<float,2>{0.408589929f, 0.574318945f},
-std::array<float,2>{0.700655639f, 0.0575770102f},
-std::array<float,2>{0.834273279f, 0.899874628f},
-std::array<float,2>{0.130818352f, 0.287965953f},
-std::array<float,2>{0.102302067f, 0.836598873f},
-std::array<float,2>{0.984499633f, 0.390638649f},
-std::array<float,2>{0.534130633f, 0.641839266f},
-std::array<float,2>{0.360733956f, 0.146838278f},
-std::array<float,2>{0.202825665f, 0.721721411f},
-std::array<float,2>{0.808308125f, 0.249018073f},
-std::array<float,2>{0.686795652f, 0.773953497f},
-std::array<float,2>{0.467870384f, 0.469153821f},
-std::array<float,2>{0.307441354f, 0.960807025f},
-std::array<float,2>{0.583176434f, 0.327067256f},
-std::array<float,2>{0.935835242f, 0.510872662f},
-std::array<float,2>{0.0152782006f, 0.0637551919f},
-std::array<float,2>{0.331756979f, 0.683959603f},
-std::array<float,2>{0.521236181f, 0.184390903f},
-std::array<float,2>{0.966971993f, 0.860092461f},
-std::array<float,2>{0.0935459957f, 0.431592017f},
-std::array<float,2>{0.18482995f, 0.925596833f},
-std::array<float,2>{0.864757776f, 0.251538664f},
-std::array<float,2>{0.719055295f, 0.616917551f},
-std::array<float,2>{0.388121814f, 0.0305023938f},
-std::array<float,2>{0.0400383286f, 0.549751461f},
-std::array<float,2>{0.900242627f, 0.106107973f},
-std::array<float,2>{0.602025867f, 0.98404485f},
-std::array<float,2>{0.26881218f, 0.370694727f},
-std::array<float,2>{0.474621236f, 0.801187456f},
-std::array<float,2>{0.650765896f, 0.468673378f},
-std::array<float,2>{0.753156424f, 0.711590052f},
-std::array<float,2>{0.242834151f, 0.196331248f},
-std::array<float,2>{0.373845696f, 0.623578787f},
-std::array<float,2>{0.544139028f, 0.0202448275f},
-std::array<float,2>{0.994451642f, 0.934316993f},
-std::array<float,2>{0.10014338f, 0.259001046f},
-std::array<float,2>{0.135422722f, 0.870856822f},
-std::array<float,2>{0.83972472f, 0.425626129f},
-std::array<float,2>{0.690763593f, 0.672373295f},
-std::array<float,2>{0.421048433f, 0.17824702f},
-std::array<float,2>{0.00291688321f, 0.704011977f},
-std::array<float,2>{0.926881492f, 0.190816045f},
-std::array<float,2>{0.592657506f, 0.811698198f},
-std::array<float,2>{0.29826048f, 0.45765245f},
-std::array<float,2>{0.459282637f, 0.970969439f},
-std::array<float,2>{0.675956905f, 0.363631248f},
-std::array<float,2>{0.804432869f, 0.555487216f},
-std::array<float,2>{0.189937264f, 0.0944670513f},
-std::array<float,2>{0.379604667f, 0.654768765f},
-std::array<float,2>{0.728877306f, 0.153689459f},
-std::array<float,2>{0.86808008f, 0.829270899f},
-std::array<float,2>{0.17355676f, 0.399778187f},
-std::array<float,2>{0.0846754536f, 0.89562577f},
-std::array<float,2>{0.956928849f, 0.293434352f},
-std::array<float,2>{0.529407501f, 0.567196369f},
-std::array<float,2>{0.338518798f, 0.0475075915f},
-std::array<float,2>{0.241443947f, 0.504537165f},
-std::array<float,2>{0.758092821f, 0.078039147f},
-std::array<float,2>{0.645595372f, 0.967621386f},
-std::array<float,2>{0.482258379f, 0.31592384f},
-std::array<float,2>{0.277023584f, 0.773147404f},
-std::array<float,2>{0.599600554f, 0.479027152f},
-std::array<float,2>{0.898418307f, 0.72911346f},
-std::array<float,2>{0.0354545414f, 0.236391172f},
-std::array<float,2>{0.491918683f, 0.540593207f},
-std::array<float,2>{0.62742269f, 0.116954409f},
-std::array<float,2>{0.773543894f, 0.985903919f},
-std::array<float,2>{0.225428805f, 0.354174942f},
-std::array<float,2>{0.0510437898f, 0.796552122f},
-std::array<float,2>{0.884505033f, 0.44008255f},
-std::array<float,2>{0.624756694f, 0.700396538f},
-std::array<float,2>{0.261816502f, 0.207892463f},
-std::array<float,2>{0.168127313f, 0.6582551f},
-std::array<float,2>{0.858578861f, 0.169423729f},
-std::array<float,2>{0.744408071f, 0.848778546f},
-std::array<float,2>{0.392476261f, 0.414070576f},
-std::array<float,2>{0.322019249f, 0.912069917f},
-std::array<float,2>{0.504806817f, 0.265777886f},
-std::array<float,2>{0.952241242f, 0.60845685f},
-std::array<float,2>{0.068417348f, 0.00780331437f},
-std::array<float,2>{0.28997317f, 0.73899591f},
-std::array<float,2>{0.567852199f, 0.226094753f},
-std::array<float,2>{0.906499326f, 0.750065684f},
-std::array<float,2>{0.0263144393f, 0.489919633f},
-std::array<float,2>{0.216790393f, 0.951797962f},
-std::array<float,2>{0.79260385f, 0.339236528f},
-std::array<float,2>{0.668362439f, 0.515995622f},
-std::array<float,2>{0.443658501f, 0.0935011283f},
-std::array<float,2>{0.113630913f, 0.580186486f},
-std::array<float,2>{0.980712831f, 0.0332305804f},
-std::array<float,2>{0.552202463f, 0.883448064f},
-std::array<float,2>{0.350438058f, 0.305963993f},
-std::array<float,2>{0.434107631f, 0.817246139f},
-std::array<float,2>{0.713271976f, 0.378198534f},
-std::array<float,2>{0.825833976f, 0.638433993f},
-std::array<float,2>{0.151878744f, 0.129744127f},
-std::array<float,2>{0.279903501f, 0.59540683f},
-std::array<float,2>{0.596160173f, 0.00786955561f},
-std::array<float,2>{0.894095719f, 0.92132628f},
-std::array<float,2>{0.0329154134f, 0.277512133f},
-std::array<float,2>{0.238158524f, 0.857617199f},
-std::array<float,2>{0.763464332f, 0.407011807f},
-std::array<float,2>{0.64291507f, 0.665725112f},
-std::array<float,2>{0.479175031f, 0.163487092f},
-std::array<float,2>{0.080837138f, 0.692890763f},
-std::array<float,2>{0.959315002f, 0.21512188f},
-std::array<float,2>{0.523875654f, 0.782553434f},
-std::array<float,2>{0.341245562f, 0.449415565f},
-std::array<float,2>{0.375540823f, 0.999776423f},
-std::array<float,2>{0.730606139f, 0.350812882f},
-std::array<float,2>{0.873222172f, 0.532573164f},
-std::array<float,2>{0.177777469f, 0.118719995f},
-std::array<float,2>{0.453597784f, 0.632669449f},
-std::array<float,2>{0.672192097f, 0.139624864f},
-std::array<float,2>{0.798997343f, 0.822438896f},
-std::array<float,2>{0.193421215f, 0.386164725f},
-std::array<float,2>{0.0067059258f, 0.87990582f},
-std::array<float,2>{0.924815834f, 0.297812045f},
-std::array<float,2>{0.586464643f, 0.58627373f},
-std::array<float,2>{0.300970137f, 0.0455103256f},
-std::array<float,2>{0.139736444f, 0.52946949f},
-std::array<float,2>{0.840227067f, 0.0781732574f},
-std::array<float,2>{0.69339931f, 0.943036497f},
-std::array<float,2>{0.41608724f, 0.330236822f},
-std::array<float,2>{0.370821118f, 0.763484895f},
-std::array<float,2>{0.541019142f, 0.499362946f},
-std::array<float,2>{0.998431146f, 0.743299603f},
-std::array<float,2>{0.0976027325f, 0.232085839f},
-std::array<float,2>{0.430059493f, 0.553046107f},
-std::array<float,2>{0.717014134f, 0.102280676f},
-std::array<float,2>{0.821431637f, 0.976781309f},
-std::array<float,2>{0.155502558f, 0.373554498f},
-std::array<float,2>{0.110610403f, 0.797174633f},
-std::array<float,2>{0.977089703f, 0.461637229f},
-std::array<float,2>{0.550068736f, 0.715201735f},
-std::array<float,2>{0.344908565f, 0.202772424f},
-std::array<float,2>{0.213818282f, 0.680427969f},
-std::array<float,2>{0.794590294f, 0.180889368f},
-std::array<float,2>{0.667162955f, 0.866625428f},
-std::array<float,2>{0.438571185f, 0.434276611f},
-std::array<float,2>{0.294900298f, 0.929491341f},
-std::array<float,2>{0.566392779f, 0.254422069f},
-std::array<float,2>{0.911324918f, 0.61296463f},
-std::array<float,2>{0.0297412891f, 0.0234375484f},
-std::array<float,2>{0.325243145f, 0.724392414f},
-std::array<float,2>{0.502907872f, 0.243353322f},
-std::array<float,2>{0.948486805f, 0.778552651f},
-std::array<float,2>{0.0637014061f, 0.475805461f},
-std::array<float,2>{0.16505675f, 0.954183519f},
-std::array<float,2>{0.852042973f, 0.323246628f},
-std::array<float,2>{0.747426987f, 0.51472199f},
-std::array<float,2>{0.39788574f, 0.067856364f},
-std::array<float,2>{0.0505799949f, 0.570932031f},
-std::array<float,2>{0.887500703f, 0.061291296f},
-std::array<float,2>{0.620691836f, 0.904424727f},
-std::array<float,2>{0.25979206f, 0.281888157f},
-std::array<float,2>{0.485168815f, 0.841693223f},
-std::array<float,2>{0.631048143f, 0.394937873f},
-std::array<float,2>{0.778447866f, 0.646286547f},
-std::array<float,2>{0.221372142f, 0.143991426f},
-std::array<float,2>{0.356728315f, 0.500438809f},
-std::array<float,2>{0.560785592f, 0.0706958845f},
-std::array<float,2>{0.975773156f, 0.962011039f},
-std::array<float,2>{0.118540451f, 0.317624062f},
-std::array<float,2>{0.146149009f, 0.767475486f},
-std::array<float,2>{0.813903213f, 0.483412921f},
-std::array<float,2>{0.707141817f, 0.733149469f},
-std::array<float,2>{0.42948702f, 0.23950237f},
-std::array<float,2>{0.0173537936f, 0.652041793f},
-std::array<float,2>{0.915319741f, 0.151956707f},
-std::array<float,2>{0.577568591f, 0.833132744f},
-std::array<float,2>{0.287327677f, 0.403346986f},
-std::array<float,2>{0.449377447f, 0.89338541f},
-std::array<float,2>{0.663166106f, 0.289102912f},
-std::array<float,2>{0.787420869f, 0.565238178f},
-std::array<float,2>{0.208063111f, 0.0534445122f},
-std::array<float,2>{0.404046208f, 0.708035469f},
-std::array<float,2>{0.735043049f, 0.192908391f},
-std::array<float,2>{0.849249184f, 0.805289447f},
-std::array<float,2>{0.159452483f, 0.454612553f},
-std::array<float,2>{0.0750835612f, 0.974771738f},
-std::array<float,2>{0.943438053f, 0.360353291f},
-std::array<float,2>{0.511697412f, 0.560303092f},
-std::array<float,2>{0.314336807f, 0.101012267f},
-std::array<float,2>{0.230689675f, 0.61997813f},
-std::array<float,2>{0.769046605f, 0.0176622011f},
-std::array<float,2>{0.639591336f, 0.933119237f},
-std::array<float,2>{0.496261835f, 0.263684422f},
-std::array<float,2>{0.251568437f, 0.871465743f},
-std::array<float,2>{0.615079284f, 0.427060962f},
-std::array<float,2>{0.878230751f, 0.679090261f},
-std::array<float,2>{0.0624934696f, 0.172282085f},
-std::array<float,2>{0.470441341f, 0.583164692f},
-std::array<float,2>{0.655836761f, 0.0362530947f},
-std::array<float,2>{0.754128039f, 0.886857212f},
-std::array<float,2>{0.247628361f, 0.310014635f},
-std::array<float,2>{0.0435339026f, 0.813211322f},
-std::array<float,2>{0.904208362f, 0.379079223f},
-std::array<float,2>{0.606264651f, 0.635528505f},
-std::array<float,2>{0.269632131f, 0.125318423f},
-std::array<float,2>{0.180048436f, 0.735830069f},
-std::array<float,2>{0.859691381f, 0.219017997f},
-std::array<float,2>{0.723190546f, 0.757074833f},
-std::array<float,2>{0.385038555f, 0.486657083f},
-std::array<float,2>{0.334437519f, 0.946360767f},
-std::array<float,2>{0.5175699f, 0.340912282f},
-std::array<float,2>{0.961913884f, 0.519542754f},
-std::array<float,2>{0.0873263925f, 0.086977385f},
-std::array<float,2>{0.308787197f, 0.663667321f},
-std::array<float,2>{0.581625998f, 0.166860312f},
-std::array<float,2>{0.933556616f, 0.846307755f},
-std::array<float,2>{0.00937203784f, 0.420152158f},
-std::array<float,2>{0.197394952f, 0.906959772f},
-std::array<float,2>{0.808601618f, 0.270157665f},
-std::array<float,2>{0.680449903f, 0.603507221f},
-std::array<float,2>{0.462380826f, 0.000417750009f},
-std::array<float,2>{0.108906604f, 0.54662627f},
-std::array<float,2>{0.991923094f, 0.111963712f},
-std::array<float,2>{0.538483322f, 0.989152908f},
-std::array<float,2>{0.363884449f, 0.359339446f},
-std::array<float,2>{0.410321414f, 0.79015404f},
-std::array<float,2>{0.697309792f, 0.442203015f},
-std::array<float,2>{0.831674993f, 0.698900342f},
-std::array<float,2>{0.128119484f, 0.205346286f},
-std::array<float,2>{0.284561872f, 0.537518024f},
-std::array<float,2>{0.57341665f, 0.124752045f},
-std::array<float,2>{0.920244992f, 0.995672762f},
-std::array<float,2>{0.0226782747f, 0.344657868f},
-std::array<float,2>{0.206386983f, 0.786243021f},
-std::array<float,2>{0.78489548f, 0.447582662f},
-std::array<float,2>{0.659410179f, 0.690056741f},
-std::array<float,2>{0.448617131f, 0.211954445f},
-std::array<float,2>{0.123117f, 0.668867409f},
-std::array<float,2>{0.96932143f, 0.157037973f},
-std::array<float,2>{0.555401027f, 0.852927983f},
-std::array<float,2>{0.352760434f, 0.411013424f},
-std::array<float,2>{0.422515631f, 0.91715461f},
-std::array<float,2>{0.704276443f, 0.274676353f},
-std::array<float,2>{0.820117056f, 0.599382341f},
-std::array<float,2>{0.141403511f, 0.0145286033f},
-std::array<float,2>{0.494070202f, 0.749557853f},
-std::array<float,2>{0.636469841f, 0.228633195f},
-std::array<float,2>{0.769890308f, 0.761529624f},
-std::array<float,2>{0.22860463f, 0.492901057f},
-std::array<float,2>{0.0558449626f, 0.939658761f},
-std::array<float,2>{0.882151425f, 0.335204005f},
-std::array<float,2>{0.612285256f, 0.524556518f},
-std::array<float,2>{0.257361889f, 0.0843205377f},
-std::array<float,2>{0.161318809f, 0.593166411f},
-std::array<float,2>{0.845934629f, 0.0407541059f},
-std::array<float,2>{0.74076587f, 0.877458274f},
-std::array<float,2>{0.40095374f, 0.30294013f},
-std::array<float,2>{0.318681508f, 0.824859917f},
-std::array<float,2>{0.514349222f, 0.387871921f},
-std::array<float,2>{0.938426912f, 0.628007591f},
-std::array<float,2>{0.0734768882f, 0.133221731f},
-std::array<float,2>{0.38903603f, 0.614470243f},
-std::array<float,2>{0.722434163f, 0.0285465829f},
-std::array<float,2>{0.865650594f, 0.923583567f},
-std::array<float,2>{0.187259585f, 0.253076762f},
-std::array<float,2>{0.0909888223f, 0.861855388f},
-std::array<float,2>{0.965888202f, 0.433490008f},
-std::array<float,2>{0.522969604f, 0.686329901f},
-std::array<float,2>{0.329820544f, 0.187117919f},
-std::array<float,2>{0.244662151f, 0.714697003f},
-std::array<float,2>{0.750646114f, 0.19913435f},
-std::array<float,2>{0.649263442f, 0.802878797f},
-std::array<float,2>{0.473364651f, 0.466483802f},
-std::array<float,2>{0.265904635f, 0.98182559f},
-std::array<float,2>{0.603819966f, 0.368590444f},
-std::array<float,2>{0.901092947f, 0.548378885f},
-std::array<float,2>{0.0416506566f, 0.10847538f},
-std::array<float,2>{0.361397386f, 0.644375622f},
-std::array<float,2>{0.533139527f, 0.145722643f},
-std::array<float,2>{0.98800987f, 0.839276373f},
-std::array<float,2>{0.104587935f, 0.393639743f},
-std::array<float,2>{0.132793605f, 0.900705099f},
-std::array<float,2>{0.832550228f, 0.286411405f},
-std::array<float,2>{0.701875865f, 0.576552927f},
-std::array<float,2>{0.406283587f, 0.0558549948f},
-std::array<float,2>{0.0135081382f, 0.508243322f},
-std::array<float,2>{0.934311092f, 0.0654024109f},
-std::array<float,2>{0.584213495f, 0.957899153f},
-std::array<float,2>{0.305285662f, 0.325683057f},
-std::array<float,2>{0.464998633f, 0.775632441f},
-std::array<float,2>{0.685503721f, 0.47087422f},
-std::array<float,2>{0.806455255f, 0.718880057f},
-std::array<float,2>{0.200315401f, 0.247185186f},
-std::array<float,2>{0.337882817f, 0.569985509f},
-std::array<float,2>{0.529255629f, 0.0492451042f},
-std::array<float,2>{0.953772485f, 0.896531045f},
-std::array<float,2>{0.0839108303f, 0.295072287f},
-std::array<float,2>{0.173838958f, 0.830619693f},
-std::array<float,2>{0.870880902f, 0.40082112f},
-std::array<float,2>{0.728164554f, 0.653403819f},
-std::array<float,2>{0.381065398f, 0.156101078f},
-std::array<float,2>{0.0388017781f, 0.726893246f},
-std::array<float,2>{0.894586802f, 0.235293239f},
-std::array<float,2>{0.600461304f, 0.771003544f},
-std::array<float,2>{0.273964316f, 0.47823894f},
-std::array<float,2>{0.483153969f, 0.965567291f},
-std::array<float,2>{0.646778226f, 0.31344682f},
-std::array<float,2>{0.760662079f, 0.506321549f},
-std::array<float,2>{0.239931256f, 0.0749665722f},
-std::array<float,2>{0.419641405f, 0.673885226f},
-std::array<float,2>{0.688957095f, 0.176145762f},
-std::array<float,2>{0.837859511f, 0.868255913f},
-std::array<float,2>{0.133192047f, 0.421990633f},
-std::array<float,2>{0.0977490842f, 0.936020434f},
-std::array<float,2>{0.992293477f, 0.26052323f},
-std::array<float,2>{0.545799136f, 0.62205267f},
-std::array<float,2>{0.371333867f, 0.0215698294f},
-std::array<float,2>{0.189009771f, 0.557575881f},
-std::array<float,2>{0.801084578f, 0.0962360129f},
-std::array<float,2>{0.678937554f, 0.969675958f},
-std::array<float,2>{0.458332479f, 0.366097093f},
-std::array<float,2>{0.30024907f, 0.809233665f},
-std::array<float,2>{0.590670645f, 0.459438533f},
-std::array<float,2>{0.928115189f, 0.705258012f},
-std::array<float,2>{0.00166109996f, 0.187557444f},
-std::array<float,2>{0.441485107f, 0.519186437f},
-std::array<float,2>{0.671627998f, 0.0901091546f},
-std::array<float,2>{0.790346742f, 0.950337231f},
-std::array<float,2>{0.217941463f, 0.337730825f},
-std::array<float,2>{0.0248547178f, 0.753645957f},
-std::array<float,2>{0.909803629f, 0.490916133f},
-std::array<float,2>{0.569770992f, 0.741884768f},
-std::array<float,2>{0.292911768f, 0.223686188f},
-std::array<float,2>{0.149566069f, 0.639743865f},
-std::array<float,2>{0.826308012f, 0.131843597f},
-std::array<float,2>{0.711690307f, 0.818776965f},
-std::array<float,2>{0.435999185f, 0.37507537f},
-std::array<float,2>{0.349399567f, 0.886392057f},
-std::array<float,2>{0.5544945f, 0.307284474f},
-std::array<float,2>{0.983921051f, 0.57888633f},
-std::array<float,2>{0.115678482f, 0.0314958803f},
-std::array<float,2>{0.263828814f, 0.702349484f},
-std::array<float,2>{0.622002482f, 0.209809139f},
-std::array<float,2>{0.886450529f, 0.793612063f},
-std::array<float,2>{0.0543284751f, 0.439370811f},
-std::array<float,2>{0.222808823f, 0.987079203f},
-std::array<float,2>{0.775957346f, 0.353481591f},
-std::array<float,2>{0.625866294f, 0.541644037f},
-std::array<float,2>{0.489257276f, 0.115024827f},
-std::array<float,2>{0.0674141794f, 0.60708493f},
-std::array<float,2>{0.950313687f, 0.00555364974f},
-std::array<float,2>{0.506178379f, 0.913285494f},
-std::array<float,2>{0.322296232f, 0.269044697f},
-std::array<float,2>{0.393102139f, 0.850749612f},
-std::array<float,2>{0.742325246f, 0.416873306f},
-std::array<float,2>{0.856103361f, 0.656624854f},
-std::array<float,2>{0.170976773f, 0.17126371f},
-std::array<float,2>{0.270312667f, 0.584697247f},
-std::array<float,2>{0.6057868f, 0.0384164453f},
-std::array<float,2>{0.90369761f, 0.890314639f},
-std::array<float,2>{0.0431703217f, 0.312189758f},
-std::array<float,2>{0.247395813f, 0.816071808f},
-std::array<float,2>{0.754839718f, 0.382463962f},
-std::array<float,2>{0.655538619f, 0.633212864f},
-std::array<float,2>{0.469804436f, 0.12796922f},
-std::array<float,2>{0.0875829384f, 0.737504303f},
-std::array<float,2>{0.961265087f, 0.222565755f},
-std::array<float,2>{0.517020404f, 0.754384756f},
-std::array<float,2>{0.334529579f, 0.484976619f},
-std::array<float,2>{0.385401487f, 0.949165285f},
-std::array<float,2>{0.723037064f, 0.341941088f},
-std::array<float,2>{0.860083103f, 0.52221483f},
-std::array<float,2>{0.180561498f, 0.0885960087f},
-std::array<float,2>{0.462781578f, 0.661299407f},
-std::array<float,2>{0.679967165f, 0.165146634f},
-std::array<float,2>{0.809416175f, 0.844018877f},
-std::array<float,2>{0.197894633f, 0.418388724f},
-std::array<float,2>{0.00905884057f, 0.909180582f},
-std::array<float,2>{0.932820082f, 0.271898329f},
-std::array<float,2>{0.581217051f, 0.603572726f},
-std::array<float,2>{0.309178531f, 0.00251794676f},
-std::array<float,2>{0.128874347f, 0.543738484f},
-std::array<float,2>{0.831462562f, 0.110003442f},
-std::array<float,2>{0.698233545f, 0.992139101f},
-std::array<float,2>{0.410812318f, 0.357086688f},
-std::array<float,2>{0.363462627f, 0.792617381f},
-std::array<float,2>{0.538752675f, 0.444260716f},
-std::array<float,2>{0.991361499f, 0.69712013f},
-std::array<float,2>{0.108601272f, 0.204246923f},
-std::array<float,2>{0.429196388f, 0.50236994f},
-std::array<float,2>{0.707835078f, 0.0731400922f},
-std::array<float,2>{0.814387381f, 0.963476419f},
-std::array<float,2>{0.145690322f, 0.319417089f},
-std::array<float,2>{0.118728444f, 0.769029498f},
-std::array<float,2>{0.976080835f, 0.480918854f},
-std::array<float,2>{0.561229765f, 0.731251955f},
-std::array<float,2>{0.357295215f, 0.240294471f},
-std::array<float,2>{0.208787456f, 0.648981929f},
-std::array<float,2>{0.787851453f, 0.148999989f},
-std::array<float,2>{0.663652301f, 0.835797608f},
-std::array<float,2>{0.450005025f, 0.406186998f},
-std::array<float,2>{0.288030237f, 0.890733957f},
-std::array<float,2>{0.577690244f, 0.292525917f},
-std::array<float,2>{0.915632486f, 0.56407541f},
-std::array<float,2>{0.016701106f, 0.0511934608f},
-std::array<float,2>{0.313801348f, 0.710420072f},
-std::array<float,2>{0.511207581f, 0.195272893f},
-std::array<float,2>{0.944239438f, 0.807902634f},
-std::array<float,2>{0.0744019002f, 0.456005156f},
-std::array<float,2>{0.159908757f, 0.973064661f},
-std::array<float,2>{0.849101245f, 0.362620622f},
-std::array<float,2>{0.734755039f, 0.561187029f},
-std::array<float,2>{0.403696656f, 0.0989315957f},
-std::array<float,2>{0.0617675707f, 0.618464649f},
-std::array<float,2>{0.878540695f, 0.0170949791f},
-std::array<float,2>{0.614469111f, 0.93081671f},
-std::array<float,2>{0.251012236f, 0.263118893f},
-std::array<float,2>{0.496973097f, 0.873352349f},
-std::array<float,2>{0.6388399f, 0.429102749f},
-std::array<float,2>{0.768781066f, 0.677352846f},
-std::array<float,2>{0.231158838f, 0.174647033f},
-std::array<float,2>{0.345669031f, 0.551013589f},
-std::array<float,2>{0.550307155f, 0.103783548f},
-std::array<float,2>{0.976795495f, 0.980117917f},
-std::array<float,2>{0.110853888f, 0.372944564f},
-std::array<float,2>{0.155873671f, 0.799345016f},
-std::array<float,2>{0.822063804f, 0.464457333f},
-std::array<float,2>{0.717297971f, 0.718241513f},
-std::array<float,2>{0.430331558f, 0.199388757f},
-std::array<float,2>{0.0299802423f, 0.683142424f},
-std::array<float,2>{0.911637068f, 0.182917058f},
-std::array<float,2>{0.565707445f, 0.864035189f},
-std::array<float,2>{0.29442209f, 0.436729491f},
-std::array<float,2>{0.439321518f, 0.926979423f},
-std::array<float,2>{0.667612851f, 0.256473631f},
-std::array<float,2>{0.793985665f, 0.610988438f},
-std::array<float,2>{0.21307157f, 0.0258754212f},
-std::array<float,2>{0.398188084f, 0.726270974f},
-std::array<float,2>{0.747730911f, 0.24459359f},
-std::array<float,2>{0.85243094f, 0.779589295f},
-std::array<float,2>{0.16592215f, 0.474060327f},
-std::array<float,2>{0.0641767606f, 0.955542445f},
-std::array<float,2>{0.949067235f, 0.320457548f},
-std::array<float,2>{0.502246797f, 0.51336807f},
-std::array<float,2>{0.325696319f, 0.0702118874f},
-std::array<float,2>{0.221019641f, 0.573050499f},
-std::array<float,2>{0.779054284f, 0.0598937646f},
-std::array<float,2>{0.631368101f, 0.902938783f},
-std::array<float,2>{0.484404653f, 0.284852803f},
-std::array<float,2>{0.260732353f, 0.842986166f},
-std::array<float,2>{0.62031281f, 0.396902621f},
-std::array<float,2>{0.886877716f, 0.646983981f},
-std::array<float,2>{0.0501501746f, 0.141854197f},
-std::array<float,2>{0.478867471f, 0.596711099f},
-std::array<float,2>{0.643195212f, 0.00995810982f},
-std::array<float,2>{0.762764812f, 0.918566644f},
-std::array<float,2>{0.237453818f, 0.279865742f},
-std::array<float,2>{0.0324569009f, 0.856080055f},
-std::array<float,2>{0.893958449f, 0.409848988f},
-std::array<float,2>{0.596456409f, 0.666511714f},
-std::array<float,2>{0.279592305f, 0.161067888f},
-std::array<float,2>{0.178251907f, 0.694875181f},
-std::array<float,2>{0.873835742f, 0.217838943f},
-std::array<float,2>{0.731375217f, 0.784671485f},
-std::array<float,2>{0.375217766f, 0.451957941f},
-std::array<float,2>{0.341628671f, 0.997448087f},
-std::array<float,2>{0.52436161f, 0.349217653f},
-std::array<float,2>{0.959718525f, 0.535085201f},
-std::array<float,2>{0.0802360252f, 0.12073648f},
-std::array<float,2>{0.301755369f, 0.630306602f},
-std::array<float,2>{0.586110651f, 0.136748105f},
-std::array<float,2>{0.925504744f, 0.821344554f},
-std::array<float,2>{0.00627944525f, 0.382924974f},
-std::array<float,2>{0.193897456f, 0.882437348f},
-std::array<float,2>{0.799726427f, 0.299238145f},
-std::array<float,2>{0.672633231f, 0.588064313f},
-std::array<float,2>{0.453774422f, 0.0437504761f},
-std::array<float,2>{0.0967148542f, 0.529160082f},
-std::array<float,2>{0.998565018f, 0.0818862244f},
-std::array<float,2>{0.541629076f, 0.944608986f},
-std::array<float,2>{0.370191276f, 0.32870999f},
-std::array<float,2>{0.416947156f, 0.765470743f},
-std::array<float,2>{0.694126844f, 0.497026354f},
-std::array<float,2>{0.840380728f, 0.744472146f},
-std::array<float,2>{0.140272588f, 0.233761325f},
-std::array<float,2>{0.292157203f, 0.516442478f},
-std::array<float,2>{0.570083976f, 0.0930546522f},
-std::array<float,2>{0.90938592f, 0.951505065f},
-std::array<float,2>{0.0250721499f, 0.339595497f},
-std::array<float,2>{0.2186746f, 0.750597477f},
-std::array<float,2>{0.790779114f, 0.489311546f},
-std::array<float,2>{0.671268702f, 0.738485813f},
-std::array<float,2>{0.44196099f, 0.226051122f},
-std::array<float,2>{0.116196096f, 0.637835264f},
-std::array<float,2>{0.983537793f, 0.129157186f},
-std::array<float,2>{0.554069698f, 0.816581011f},
-std::array<float,2>{0.348832846f, 0.378455579f},
-std::array<float,2>{0.436235517f, 0.883038521f},
-std::array<float,2>{0.711200356f, 0.306290925f},
-std::array<float,2>{0.826798141f, 0.58060497f},
-std::array<float,2>{0.150116324f, 0.0340909995f},
-std::array<float,2>{0.488294154f, 0.70111239f},
-std::array<float,2>{0.625155389f, 0.207324162f},
-std::array<float,2>{0.77577734f, 0.796104133f},
-std::array<float,2>{0.223386705f, 0.439747602f},
-std::array<float,2>{0.0537815168f, 0.985749364f},
-std::array<float,2>{0.886202335f, 0.353802204f},
-std::array<float,2>{0.621348739f, 0.540153205f},
-std::array<float,2>{0.26451537f, 0.116641931f},
-std::array<float,2>{0.171781778f, 0.60930872f},
-std::array<float,2>{0.855720282f, 0.00723754801f},
-std::array<float,2>{0.74276495f, 0.911557019f},
-std::array<float,2>{0.392863125f, 0.266563863f},
-std::array<float,2>{0.32312429f, 0.849374354f},
-std::array<float,2>{0.506712198f, 0.414575428f},
-std::array<float,2>{0.950820684f, 0.659172118f},
-std::array<float,2>{0.0682924166f, 0.169538915f},
-std::array<float,2>{0.381588846f, 0.566530287f},
-std::array<float,2>{0.727552235f, 0.0470799804f},
-std::array<float,2>{0.870527864f, 0.896219492f},
-std::array<float,2>{0.17470406f, 0.293477774f},
-std::array<float,2>{0.0834016725f, 0.829801798f},
-std::array<float,2>{0.953143537f, 0.400356948f},
-std::array<float,2>{0.528559566f, 0.655239642f},
-std::array<float,2>{0.337175757f, 0.153994352f},
-std::array<float,2>{0.239345536f, 0.728680909f},
-std::array<float,2>{0.760095596f, 0.23692131f},
-std::array<float,2>{0.647126198f, 0.7724967f},
-std::array<float,2>{0.48286894f, 0.478791058f},
-std::array<float,2>{0.273810118f, 0.967196703f},
-std::array<float,2>{0.599627674f, 0.315547407f},
-std::array<float,2>{0.895110071f, 0.504058778f},
-std::array<float,2>{0.0384241976f, 0.0775369331f},
-std::array<float,2>{0.371737868f, 0.672269881f},
-std::array<float,2>{0.545241833f, 0.17810379f},
-std::array<float,2>{0.992801905f, 0.870263994f},
-std::array<float,2>{0.098563619f, 0.425223291f},
-std::array<float,2>{0.133639589f, 0.93408072f},
-std::array<float,2>{0.837213755f, 0.259301245f},
-std::array<float,2>{0.689148426f, 0.623129904f},
-std::array<float,2>{0.419391066f, 0.0196249373f},
-std::array<float,2>{0.00127632229f, 0.55478394f},
-std::array<float,2>{0.928702176f, 0.0939349383f},
-std::array<float,2>{0.590159476f, 0.971586347f},
-std::array<float,2>{0.300343603f, 0.364152133f},
-std::array<float,2>{0.458968461f, 0.812214255f},
-std::array<float,2>{0.679392219f, 0.457079113f},
-std::array<float,2>{0.801294863f, 0.703269899f},
-std::array<float,2>{0.188567251f, 0.191332519f},
-std::array<float,2>{0.329389662f, 0.616694093f},
-std::array<float,2>{0.52287966f, 0.031087853f},
-std::array<float,2>{0.966430843f, 0.925229907f},
-std::array<float,2>{0.0913508907f, 0.251306802f},
-std::array<float,2>{0.186935633f, 0.859478414f},
-std::array<float,2>{0.86586535f, 0.430790931f},
-std::array<float,2>{0.721863687f, 0.684125125f},
-std::array<float,2>{0.389539123f, 0.183970213f},
-std::array<float,2>{0.0410772823f, 0.711021543f},
-std::array<float,2>{0.900672317f, 0.197238907f},
-std::array<float,2>{0.604430318f, 0.801427126f},
-std::array<float,2>{0.266260475f, 0.468104273f},
-std::array<float,2>{0.473031551f, 0.983509421f},
-std::array<float,2>{0.648723245f, 0.370325685f},
-std::array<float,2>{0.750222087f, 0.549297452f},
-std::array<float,2>{0.244197771f, 0.105488382f},
-std::array<float,2>{0.407076389f, 0.642417073f},
-std::array<float,2>{0.701459169f, 0.147087902f},
-std::array<float,2>{0.832268775f, 0.835975349f},
-std::array<float,2>{0.13216494f, 0.391366422f},
-std::array<float,2>{0.105260983f, 0.900322556f},
-std::array<float,2>{0.987558365f, 0.287157595f},
-std::array<float,2>{0.532513499f, 0.575052083f},
-std::array<float,2>{0.362198651f, 0.0567375049f},
-std::array<float,2>{0.200721905f, 0.511463523f},
-std::array<float,2>{0.805948794f, 0.0642699674f},
-std::array<float,2>{0.684823573f, 0.960314333f},
-std::array<float,2>{0.465530097f, 0.326502383f},
-std::array<float,2>{0.305154175f, 0.773827374f},
-std::array<float,2>{0.58457315f, 0.469369799f},
-std::array<float,2>{0.933663011f, 0.722357333f},
-std::array<float,2>{0.0127361882f, 0.248353928f},
-std::array<float,2>{0.449062198f, 0.536688209f},
-std::array<float,2>{0.660019815f, 0.122201473f},
-std::array<float,2>{0.784180999f, 0.993444145f},
-std::array<float,2>{0.206868008f, 0.345707744f},
-std::array<float,2>{0.0232181624f, 0.78889823f},
-std::array<float,2>{0.92087388f, 0.446049482f},
-std::array<float,2>{0.574054599f, 0.688867033f},
-std::array<float,2>{0.284853876f, 0.213109523f},
-std::array<float,2>{0.140671715f, 0.670799196f},
-std::array<float,2>{0.81965518f, 0.159987241f},
-std::array<float,2>{0.704772472f, 0.855071664f},
-std::array<float,2>{0.422135144f, 0.413267761f},
-std::array<float,2>{0.353231132f, 0.91505444f},
-std::array<float,2>{0.555130243f, 0.276038408f},
-std::array<float,2>{0.969159245f, 0.600750864f},
-std::array<float,2>{0.123749904f, 0.0136349732f},
-std::array<float,2>{0.256927013f, 0.747151494f},
-std::array<float,2>{0.61175561f, 0.227043256f},
-std::array<float,2>{0.882676601f, 0.759290755f},
-std::array<float,2>{0.056557674f, 0.495196939f},
-std::array<float,2>{0.229134485f, 0.938834906f},
-std::array<float,2>{0.770218074f, 0.33208257f},
-std::array<float,2>{0.636013508f, 0.525719464f},
-std::array<float,2>{0.493621886f, 0.0824533403f},
-std::array<float,2>{0.0738461167f, 0.589878142f},
-std::array<float,2>{0.937982321f, 0.0417802744f},
-std::array<float,2>{0.51376605f, 0.876338184f},
-std::array<float,2>{0.318963647f, 0.301952749f},
-std::array<float,2>{0.400764644f, 0.827545106f},
-std::array<float,2>{0.740703166f, 0.388696492f},
-std::array<float,2>{0.846397221f, 0.625943482f},
-std::array<float,2>{0.161927983f, 0.135560095f},
-std::array<float,2>{0.312004715f, 0.602716744f},
-std::array<float,2>{0.578437507f, 0.00073363015f},
-std::array<float,2>{0.931538224f, 0.906697273f},
-std::array<float,2>{0.0109234955f, 0.269543827f},
-std::array<float,2>{0.197233081f, 0.846152425f},
-std::array<float,2>{0.812490642f, 0.42048797f},
-std::array<float,2>{0.683242857f, 0.663556397f},
-std::array<float,2>{0.464690566f, 0.166427717f},
-std::array<float,2>{0.10738726f, 0.698665977f},
-std::array<float,2>{0.989338934f, 0.205972105f},
-std::array<float,2>{0.536234558f, 0.79096514f},
-std::array<float,2>{0.366344512f, 0.441522866f},
-std::array<float,2>{0.412700802f, 0.988461494f},
-std::array<float,2>{0.695870936f, 0.358731359f},
-std::array<float,2>{0.829126298f, 0.546131909f},
-std::array<float,2>{0.125050381f, 0.111588366f},
-std::array<float,2>{0.472150683f, 0.634777784f},
-std::array<float,2>{0.653502941f, 0.125648633f},
-std::array<float,2>{0.756789148f, 0.812939823f},
-std::array<float,2>{0.248598799f, 0.379665554f},
-std::array<float,2>{0.0468714759f, 0.88726151f},
-std::array<float,2>{0.904704452f, 0.310446501f},
-std::array<float,2>{0.608954191f, 0.583677709f},
-std::array<float,2>{0.271979928f, 0.0370941535f},
-std::array<float,2>{0.181803986f, 0.520264268f},
-std::array<float,2>{0.862897038f, 0.087462917f},
-std::array<float,2>{0.725317478f, 0.946868777f},
-std::array<float,2>{0.384725451f, 0.341641992f},
-std::array<float,2>{0.332618415f, 0.757567406f},
-std::array<float,2>{0.51826036f, 0.487297416f},
-std::array<float,2>{0.963011563f, 0.73614496f},
-std::array<float,2>{0.0882683471f, 0.219653577f},
-std::array<float,2>{0.40556252f, 0.559866428f},
-std::array<float,2>{0.738241553f, 0.10119354f},
-std::array<float,2>{0.851268172f, 0.975295126f},
-std::array<float,2>{0.157930776f, 0.361249894f},
-std::array<float,2>{0.0768681467f, 0.804957628f},
-std::array<float,2>{0.943108976f, 0.45452854f},
-std::array<float,2>{0.509597421f, 0.708939373f},
-std::array<float,2>{0.316108853f, 0.192400932f},
-std::array<float,2>{0.234268323f, 0.679679096f},
-std::array<float,2>{0.76655972f, 0.172365516f},
-std::array<float,2>{0.638450742f, 0.871739686f},
-std::array<float,2>{0.499080181f, 0.42731905f},
-std::array<float,2>{0.253234595f, 0.932692289f},
-std::array<float,2>{0.615747333f, 0.264170706f},
-std::array<float,2>{0.876273394f, 0.619511187f},
-std::array<float,2>{0.0596463159f, 0.0181279387f},
-std::array<float,2>{0.359134763f, 0.73255831f},
-std::array<float,2>{0.560540318f, 0.239828631f},
-std::array<float,2>{0.973524392f, 0.766984582f},
-std::array<float,2>{0.120239414f, 0.484243065f},
-std::array<float,2>{0.147016406f, 0.962409258f},
-std::array<float,2>{0.814977944f, 0.318170637f},
-std::array<float,2>{0.709801495f, 0.500694156f},
-std::array<float,2>{0.427192807f, 0.0708799362f},
-std::array<float,2>{0.0179061648f, 0.564751506f},
-std::array<float,2>{0.91683656f, 0.0529817827f},
-std::array<float,2>{0.574228466f, 0.892853796f},
-std::array<float,2>{0.287094176f, 0.289813012f},
-std::array<float,2>{0.452754408f, 0.833695471f},
-std::array<float,2>{0.660752654f, 0.40389061f},
-std::array<float,2>{0.785364807f, 0.651536584f},
-std::array<float,2>{0.209765553f, 0.151369721f},
-std::array<float,2>{0.32720989f, 0.515191019f},
-std::array<float,2>{0.501102805f, 0.0683061481f},
-std::array<float,2>{0.945747912f, 0.954677343f},
-std::array<float,2>{0.0662981421f, 0.323783815f},
-std::array<float,2>{0.167030483f, 0.779206276f},
-std::array<float,2>{0.854328692f, 0.476504624f},
-std::array<float,2>{0.748164296f, 0.724083662f},
-std::array<float,2>{0.394683897f, 0.243679494f},
-std::array<float,2>{0.0485031344f, 0.645539343f},
-std::array<float,2>{0.888969243f, 0.144218773f},
-std::array<float,2>{0.618545055f, 0.840976417f},
-std::array<float,2>{0.259764344f, 0.395405501f},
-std::array<float,2>{0.486751914f, 0.905235231f},
-std::array<float,2>{0.63081497f, 0.281563014f},
-std::array<float,2>{0.780867994f, 0.570588827f},
-std::array<float,2>{0.219635323f, 0.0608743094f},
-std::array<float,2>{0.433209121f, 0.715810776f},
-std::array<float,2>{0.716545284f, 0.202575386f},
-std::array<float,2>{0.823688507f, 0.797624767f},
-std::array<float,2>{0.15422307f, 0.461224586f},
-std::array<float,2>{0.113268197f, 0.977474034f},
-std::array<float,2>{0.980327845f, 0.373208225f},
-std::array<float,2>{0.547866285f, 0.553591371f},
-std::array<float,2>{0.347195923f, 0.101861611f},
-std::array<float,2>{0.212536022f, 0.612604439f},
-std::array<float,2>{0.795356274f, 0.024137767f},
-std::array<float,2>{0.665438592f, 0.92892462f},
-std::array<float,2>{0.440250069f, 0.254198045f},
-std::array<float,2>{0.296373516f, 0.866815627f},
-std::array<float,2>{0.562976778f, 0.434001327f},
-std::array<float,2>{0.913862288f, 0.679734051f},
-std::array<float,2>{0.0282603428f, 0.181332648f},
-std::array<float,2>{0.456577897f, 0.586569965f},
-std::array<float,2>{0.675322115f, 0.0449357107f},
-std::array<float,2>{0.797982991f, 0.880433202f},
-std::array<float,2>{0.193073601f, 0.297140896f},
-std::array<float,2>{0.00392572256f, 0.822828233f},
-std::array<float,2>{0.922446668f, 0.386635572f},
-std::array<float,2>{0.588092029f, 0.631931365f},
-std::array<float,2>{0.304229856f, 0.138777375f},
-std::array<float,2>{0.137853876f, 0.744076788f},
-std::array<float,2>{0.842155576f, 0.231654778f},
-std::array<float,2>{0.691857338f, 0.762941658f},
-std::array<float,2>{0.41498068f, 0.499747783f},
-std::array<float,2>{0.368112087f, 0.942807257f},
-std::array<float,2>{0.539980173f, 0.330572277f},
-std::array<float,2>{0.997688711f, 0.529865086f},
-std::array<float,2>{0.0937687159f, 0.0789980665f},
-std::array<float,2>{0.277784377f, 0.665317357f},
-std::array<float,2>{0.594249129f, 0.163899675f},
-std::array<float,2>{0.890823007f, 0.858180881f},
-std::array<float,2>{0.034183275f, 0.406463355f},
-std::array<float,2>{0.234762371f, 0.921771288f},
-std::array<float,2>{0.764376819f, 0.27785033f},
-std::array<float,2>{0.641277075f, 0.594996452f},
-std::array<float,2>{0.477823794f, 0.0083153192f},
-std::array<float,2>{0.0793974474f, 0.53293699f},
-std::array<float,2>{0.958152175f, 0.118630089f},
-std::array<float,2>{0.525984406f, 0.999445319f},
-std::array<float,2>{0.343403399f, 0.351417482f},
-std::array<float,2>{0.378333092f, 0.782732368f},
-std::array<float,2>{0.73267895f, 0.449757248f},
-std::array<float,2>{0.87123543f, 0.692514539f},
-std::array<float,2>{0.176534295f, 0.215693951f},
-std::array<float,2>{0.262582898f, 0.541333079f},
-std::array<float,2>{0.62417239f, 0.11455667f},
-std::array<float,2>{0.883904457f, 0.986472607f},
-std::array<float,2>{0.0513344109f, 0.352996945f},
-std::array<float,2>{0.224748924f, 0.7930848f},
-std::array<float,2>{0.774163306f, 0.438669235f},
-std::array<float,2>{0.627452672f, 0.702957034f},
-std::array<float,2>{0.491470665f, 0.209155336f},
-std::array<float,2>{0.0692383274f, 0.656854033f},
-std::array<float,2>{0.952698171f, 0.171479583f},
-std::array<float,2>{0.503927112f, 0.851523995f},
-std::array<float,2>{0.321291566f, 0.416298717f},
-std::array<float,2>{0.391778916f, 0.913805544f},
-std::array<float,2>{0.744653463f, 0.268980205f},
-std::array<float,2>{0.858983755f, 0.606769204f},
-std::array<float,2>{0.168918133f, 0.00518329442f},
-std::array<float,2>{0.444207549f, 0.74138546f},
-std::array<float,2>{0.668552101f, 0.224121764f},
-std::array<float,2>{0.792338312f, 0.75330919f},
-std::array<float,2>{0.216222927f, 0.490418792f},
-std::array<float,2>{0.0254896786f, 0.950943112f},
-std::array<float,2>{0.907028317f, 0.336966157f},
-std::array<float,2>{0.56835109f, 0.519025683f},
-std::array<float,2>{0.289260298f, 0.0907152072f},
-std::array<float,2>{0.151497245f, 0.57816267f},
-std::array<float,2>{0.825563908f, 0.0318320468f},
-std::array<float,2>{0.71356082f, 0.885766387f},
-std::array<float,2>{0.433889449f, 0.306925714f},
-std::array<float,2>{0.350007653f, 0.819097459f},
-std::array<float,2>{0.552491963f, 0.375859559f},
-std::array<float,2>{0.981305301f, 0.64042294f},
-std::array<float,2>{0.114152484f, 0.132773921f},
-std::array<float,2>{0.421496063f, 0.621420503f},
-std::array<float,2>{0.690933049f, 0.0223827567f},
-std::array<float,2>{0.83890444f, 0.936220646f},
-std::array<float,2>{0.134927228f, 0.259796053f},
-std::array<float,2>{0.0997685418f, 0.869119763f},
-std::array<float,2>{0.994889081f, 0.422582775f},
-std::array<float,2>{0.544761658f, 0.674528003f},
-std::array<float,2>{0.373533696f, 0.176312655f},
-std::array<float,2>{0.189954191f, 0.706005692f},
-std::array<float,2>{0.803832829f, 0.187990591f},
-std::array<float,2>{0.676724076f, 0.808707476f},
-std::array<float,2>{0.459866047f, 0.459960312f},
-std::array<float,2>{0.298572719f, 0.969059587f},
-std::array<float,2>{0.591890633f, 0.365476996f},
-std::array<float,2>{0.927696168f, 0.556850493f},
-std::array<float,2>{0.00240788865f, 0.0961801857f},
-std::array<float,2>{0.338204533f, 0.65418601f},
-std::array<float,2>{0.52997148f, 0.155465305f},
-std::array<float,2>{0.956246197f, 0.830449641f},
-std::array<float,2>{0.084254384f, 0.401364684f},
-std::array<float,2>{0.173056811f, 0.89745599f},
-std::array<float,2>{0.867672682f, 0.295552343f},
-std::array<float,2>{0.729228973f, 0.569405913f},
-std::array<float,2>{0.379185736f, 0.0496273562f},
-std::array<float,2>{0.0360917151f, 0.506592572f},
-std::array<float,2>{0.897577226f, 0.074242264f},
-std::array<float,2>{0.598749459f, 0.965227187f},
-std::array<float,2>{0.276481897f, 0.312977284f},
-std::array<float,2>{0.481460065f, 0.770666361f},
-std::array<float,2>{0.646393955f, 0.477636218f},
-std::array<float,2>{0.758479953f, 0.72716856f},
-std::array<float,2>{0.242127374f, 0.234495997f},
-std::array<float,2>{0.361147493f, 0.576994896f},
-std::array<float,2>{0.533513367f, 0.0561605319f},
-std::array<float,2>{0.985295177f, 0.901125848f},
-std::array<float,2>{0.1017491f, 0.287049711f},
-std::array<float,2>{0.130047038f, 0.839827359f},
-std::array<float,2>{0.834715903f, 0.394264936f},
-std::array<float,2>{0.700889051f, 0.643712282f},
-std::array<float,2>{0.409032851f, 0.146314263f},
-std::array<float,2>{0.0147241978f, 0.719646513f},
-std::array<float,2>{0.936282933f, 0.247856006f},
-std::array<float,2>{0.583780169f, 0.776320994f},
-std::array<float,2>{0.306968272f, 0.471670955f},
-std::array<float,2>{0.468294859f, 0.957174897f},
-std::array<float,2>{0.687397599f, 0.325816303f},
-std::array<float,2>{0.807991385f, 0.508599162f},
-std::array<float,2>{0.202234372f, 0.0647833273f},
-std::array<float,2>{0.388523757f, 0.68602258f},
-std::array<float,2>{0.719298601f, 0.186681107f},
-std::array<float,2>{0.864290833f, 0.861538589f},
-std::array<float,2>{0.18549484f, 0.432797879f},
-std::array<float,2>{0.0931093916f, 0.923217714f},
-std::array<float,2>{0.967772007f, 0.253502548f},
-std::array<float,2>{0.520808876f, 0.614978194f},
-std::array<float,2>{0.331319839f, 0.0290986113f},
-std::array<float,2>{0.242367864f, 0.548172295f},
-std::array<float,2>{0.753540456f, 0.109074749f},
-std::array<float,2>{0.650884867f, 0.981954217f},
-std::array<float,2>{0.475479722f, 0.368653208f},
-std::array<float,2>{0.269282103f, 0.80325228f},
-std::array<float,2>{0.602171123f, 0.466207504f},
-std::array<float,2>{0.899609029f, 0.713928699f},
-std::array<float,2>{0.0390809737f, 0.198555574f},
-std::array<float,2>{0.494279236f, 0.525377691f},
-std::array<float,2>{0.632930338f, 0.0845459402f},
-std::array<float,2>{0.771877646f, 0.940256119f},
-std::array<float,2>{0.226628497f, 0.335632235f},
-std::array<float,2>{0.0582178347f, 0.761085212f},
-std::array<float,2>{0.879676044f, 0.492385447f},
-std::array<float,2>{0.611112893f, 0.749321401f},
-std::array<float,2>{0.255167454f, 0.229338855f},
-std::array<float,2>{0.162209854f, 0.628613353f},
-std::array<float,2>{0.845491827f, 0.133361846f},
-std::array<float,2>{0.739198983f, 0.824588478f},
-std::array<float,2>{0.39964965f, 0.388374448f},
-std::array<float,2>{0.317173034f, 0.877393782f},
-std::array<float,2>{0.512130976f, 0.303415209f},
-std::array<float,2>{0.94079423f, 0.593520582f},
-std::array<float,2>{0.0710650012f, 0.0402969643f},
-std::array<float,2>{0.282224387f, 0.689497054f},
-std::array<float,2>{0.571270585f, 0.212612197f},
-std::array<float,2>{0.919425845f, 0.786970496f},
-std::array<float,2>{0.02071096f, 0.447836459f},
-std::array<float,2>{0.20481959f, 0.995338321f},
-std::array<float,2>{0.782519579f, 0.34380576f},
-std::array<float,2>{0.657701194f, 0.537753344f},
-std::array<float,2>{0.446053445f, 0.124036945f},
-std::array<float,2>{0.122574814f, 0.598904848f},
-std::array<float,2>{0.972236693f, 0.0137882661f},
-std::array<float,2>{0.556906879f, 0.917692721f},
-std::array<float,2>{0.354618758f, 0.275345653f},
-std::array<float,2>{0.424377799f, 0.853127241f},
-std::array<float,2>{0.706616223f, 0.410353869f},
-std::array<float,2>{0.818245828f, 0.667971134f},
-std::array<float,2>{0.144530326f, 0.156580165f},
-std::array<float,2>{0.285987705f, 0.562549472f},
-std::array<float,2>{0.575931728f, 0.0520742685f},
-std::array<float,2>{0.917402744f, 0.892228723f},
-std::array<float,2>{0.0188547466f, 0.291834205f},
-std::array<float,2>{0.210172385f, 0.83446151f},
-std::array<float,2>{0.78681761f, 0.404756963f},
-std::array<float,2>{0.661337256f, 0.649849534f},
-std::array<float,2>{0.4520441f, 0.150360301f},
-std::array<float,2>{0.119191639f, 0.731656551f},
-std::array<float,2>{0.974106252f, 0.241860196f},
-std::array<float,2>{0.558931291f, 0.768051028f},
-std::array<float,2>{0.358252466f, 0.481559128f},
-std::array<float,2>{0.426564485f, 0.964481711f},
-std::array<float,2>{0.71024847f, 0.319321424f},
-std::array<float,2>{0.816380143f, 0.503249109f},
-std::array<float,2>{0.148318931f, 0.0737090111f},
-std::array<float,2>{0.498580098f, 0.67664057f},
-std::array<float,2>{0.637354076f, 0.175697193f},
-std::array<float,2>{0.767380536f, 0.874929368f},
-std::array<float,2>{0.233302429f, 0.428547144f},
-std::array<float,2>{0.0590366162f, 0.930253983f},
-std::array<float,2>{0.875662327f, 0.262287825f},
-std::array<float,2>{0.616853774f, 0.617417276f},
-std::array<float,2>{0.252165079f, 0.0163432099f},
-std::array<float,2>{0.157158613f, 0.562020063f},
-std::array<float,2>{0.850392878f, 0.0976640508f},
-std::array<float,2>{0.737059355f, 0.973837972f},
-std::array<float,2>{0.404930413f, 0.362054765f},
-std::array<float,2>{0.314698488f, 0.807029903f},
-std::array<float,2>{0.508402765f, 0.456376374f},
-std::array<float,2>{0.941780746f, 0.709480107f},
-std::array<float,2>{0.0773484334f, 0.193929225f},
-std::array<float,2>{0.38355884f, 0.523435473f},
-std::array<float,2>{0.726537347f, 0.0892221406f},
-std::array<float,2>{0.861626983f, 0.948144078f},
-std::array<float,2>{0.18332316f, 0.343308777f},
-std::array<float,2>{0.0890392438f, 0.755084276f},
-std::array<float,2>{0.964704871f, 0.486266971f},
-std::array<float,2>{0.518773794f, 0.736351013f},
-std::array<float,2>{0.333912134f, 0.221243456f},
-std::array<float,2>{0.249634877f, 0.63456744f},
-std::array<float,2>{0.757055342f, 0.127197474f},
-std::array<float,2>{0.652803063f, 0.814561129f},
-std::array<float,2>{0.471088827f, 0.381293327f},
-std::array<float,2>{0.272662193f, 0.889006436f},
-std::array<float,2>{0.607447386f, 0.31093961f},
-std::array<float,2>{0.90547806f, 0.585160077f},
-std::array<float,2>{0.0453172736f, 0.0379936248f},
-std::array<float,2>{0.365575343f, 0.695684969f},
-std::array<float,2>{0.535197198f, 0.203204319f},
-std::array<float,2>{0.988873541f, 0.791166961f},
-std::array<float,2>{0.105756529f, 0.444749981f},
-std::array<float,2>{0.126066774f, 0.990466475f},
-std::array<float,2>{0.828978419f, 0.355701089f},
-std::array<float,2>{0.696311831f, 0.544758618f},
-std::array<float,2>{0.413398206f, 0.111102469f},
-std::array<float,2>{0.0100001357f, 0.605427444f},
-std::array<float,2>{0.930272222f, 0.00372877694f},
-std::array<float,2>{0.579179585f, 0.908704579f},
-std::array<float,2>{0.310603291f, 0.273429662f},
-std::array<float,2>{0.463105917f, 0.845404744f},
-std::array<float,2>{0.682099998f, 0.419453263f},
-std::array<float,2>{0.811285794f, 0.660351455f},
-std::array<float,2>{0.195376337f, 0.164326847f},
-std::array<float,2>{0.342434257f, 0.53390944f},
-std::array<float,2>{0.52674675f, 0.119140677f},
-std::array<float,2>{0.957053065f, 0.996412396f},
-std::array<float,2>{0.0789143145f, 0.347957134f},
-std::array<float,2>{0.177206188f, 0.784176946f},
-std::array<float,2>{0.872218072f, 0.452850521f},
-std::array<float,2>{0.734145999f, 0.694260895f},
-std::array<float,2>{0.377824277f, 0.217255935f},
-std::array<float,2>{0.0335126258f, 0.667433858f},
-std::array<float,2>{0.891626179f, 0.161474749f},
-std::array<float,2>{0.59495008f, 0.856573761f},
-std::array<float,2>{0.278739661f, 0.408747166f},
-std::array<float,2>{0.477046877f, 0.919570565f},
-std::array<float,2>{0.641672432f, 0.28115347f},
-std::array<float,2>{0.765208125f, 0.596455872f},
-std::array<float,2>{0.235387579f, 0.0116097033f},
-std::array<float,2>{0.415497661f, 0.74546808f},
-std::array<float,2>{0.692439973f, 0.232454047f},
-std::array<float,2>{0.842774332f, 0.76392293f},
-std::array<float,2>{0.13697651f, 0.497953475f},
-std::array<float,2>{0.0951289907f, 0.943588555f},
-std::array<float,2>{0.996504545f, 0.329396933f},
-std::array<float,2>{0.540773928f, 0.52821666f},
-std::array<float,2>{0.368736655f, 0.0810222328f},
-std::array<float,2>{0.192261934f, 0.589826286f},
-std::array<float,2>{0.797788501f, 0.044511281f},
-std::array<float,2>{0.674783409f, 0.881163061f},
-std::array<float,2>{0.4559277f, 0.299859434f},
-std::array<float,2>{0.303425431f, 0.820425212f},
-std::array<float,2>{0.589537442f, 0.384439886f},
-std::array<float,2>{0.923312485f, 0.628925502f},
-std::array<float,2>{0.00513467938f, 0.138190001f},
-std::array<float,2>{0.440918535f, 0.610158443f},
-std::array<float,2>{0.665029049f, 0.0267922599f},
-std::array<float,2>{0.796661019f, 0.925800622f},
-std::array<float,2>{0.211700261f, 0.257337749f},
-std::array<float,2>{0.0286812633f, 0.864358127f},
-std::array<float,2>{0.912389636f, 0.435959429f},
-std::array<float,2>{0.564347923f, 0.681763649f},
-std::array<float,2>{0.295407116f, 0.182254508f},
-std::array<float,2>{0.152442828f, 0.717331111f},
-std::array<float,2>{0.822697341f, 0.20030959f},
-std::array<float,2>{0.715324938f, 0.800027132f},
-std::array<float,2>{0.431953043f, 0.46364212f},
-std::array<float,2>{0.346106201f, 0.978915095f},
-std::array<float,2>{0.547239065f, 0.371127248f},
-std::array<float,2>{0.978978455f, 0.551996768f},
-std::array<float,2>{0.111802302f, 0.104550034f},
-std::array<float,2>{0.257990748f, 0.647762775f},
-std::array<float,2>{0.617729962f, 0.141443342f},
-std::array<float,2>{0.889848113f, 0.842603445f},
-std::array<float,2>{0.04771512f, 0.39756453f},
-std::array<float,2>{0.219839007f, 0.904266238f},
-std::array<float,2>{0.779483318f, 0.283373624f},
-std::array<float,2>{0.629839718f, 0.573516309f},
-std::array<float,2>{0.488114953f, 0.0589900985f},
-std::array<float,2>{0.0652619153f, 0.512450039f},
-std::array<float,2>{0.94696784f, 0.0683913901f},
-std::array<float,2>{0.500420809f, 0.956309378f},
-std::array<float,2>{0.326475263f, 0.321804672f},
-std::array<float,2>{0.3959544f, 0.780935347f},
-std::array<float,2>{0.749557555f, 0.473303288f},
-std::array<float,2>{0.855338931f, 0.72540462f},
-std::array<float,2>{0.166670248f, 0.245528579f},
-std::array<float,2>{0.276341379f, 0.505122304f},
-std::array<float,2>{0.597818077f, 0.0762955919f},
-std::array<float,2>{0.897060335f, 0.968631804f},
-std::array<float,2>{0.0362889096f, 0.31498906f},
-std::array<float,2>{0.241094127f, 0.771954775f},
-std::array<float,2>{0.759421587f, 0.480198592f},
-std::array<float,2>{0.644623995f, 0.730032563f},
-std::array<float,2>{0.481089771f, 0.238098249f},
-std::array<float,2>{0.0857348144f, 0.655636609f},
-std::array<float,2>{0.955222964f, 0.152555108f},
-std::array<float,2>{0.531216562f, 0.828378379f},
-std::array<float,2>{0.339195102f, 0.39880541f},
-std::array<float,2>{0.380738884f, 0.894907773f},
-std::array<float,2>{0.730443478f, 0.293973178f},
-std::array<float,2>{0.868992805f, 0.568190753f},
-std::array<float,2>{0.172390446f, 0.0484454408f},
-std::array<float,2>{0.460188717f, 0.704681695f},
-std::array<float,2>{0.6775437f, 0.189841971f},
-std::array<float,2>{0.802842736f, 0.810786903f},
-std::array<float,2>{0.19106552f, 0.458481431f},
-std::array<float,2>{0.00364194857f, 0.972622871f},
-std::array<float,2>{0.926122844f, 0.364466697f},
-std::array<float,2>{0.593071222f, 0.55634439f},
-std::array<float,2>{0.297094464f, 0.0947472304f},
-std::array<float,2>{0.135978878f, 0.624726951f},
-std::array<float,2>{0.838142157f, 0.0214364752f},
-std::array<float,2>{0.690172791f, 0.934901834f},
-std::array<float,2>{0.41999355f, 0.257944703f},
-std::array<float,2>{0.374209285f, 0.869770825f},
-std::array<float,2>{0.543120682f, 0.424660534f},
-std::array<float,2>{0.995573699f, 0.673483551f},
-std::array<float,2>{0.101371512f, 0.179233357f},
-std::array<float,2>{0.434602886f, 0.581896961f},
-std::array<float,2>{0.713877618f, 0.0346808359f},
-std::array<float,2>{0.825154364f, 0.884693146f},
-std::array<float,2>{0.151304826f, 0.305195481f},
-std::array<float,2>{0.114776857f, 0.817411244f},
-std::array<float,2>{0.981528819f, 0.377572924f},
-std::array<float,2>{0.55133903f, 0.63754952f},
-std::array<float,2>{0.35131523f, 0.130053595f},
-std::array<float,2>{0.215355098f, 0.739636779f},
-std::array<float,2>{0.791167736f, 0.225429624f},
-std::array<float,2>{0.669180512f, 0.750979125f},
-std::array<float,2>{0.445257455f, 0.488835067f},
-std::array<float,2>{0.290404588f, 0.953066111f},
-std::array<float,2>{0.566932321f, 0.338434011f},
-std::array<float,2>{0.907316148f, 0.516668379f},
-std::array<float,2>{0.0264471695f, 0.0922072455f},
-std::array<float,2>{0.320651531f, 0.659753621f},
-std::array<float,2>{0.505749643f, 0.168232858f},
-std::array<float,2>{0.951903641f, 0.848456621f},
-std::array<float,2>{0.0694268644f, 0.415054381f},
-std::array<float,2>{0.169031978f, 0.910185337f},
-std::array<float,2>{0.857529879f, 0.267184258f},
-std::array<float,2>{0.745265603f, 0.607567489f},
-std::array<float,2>{0.391496658f, 0.00651954161f},
-std::array<float,2>{0.0524685569f, 0.539276063f},
-std::array<float,2>{0.883474112f, 0.116179258f},
-std::array<float,2>{0.623507202f, 0.984971106f},
-std::array<float,2>{0.263479084f, 0.354690135f},
-std::array<float,2>{0.490588218f, 0.795022488f},
-std::array<float,2>{0.62845993f, 0.441233426f},
-std::array<float,2>{0.774638295f, 0.699278414f},
-std::array<float,2>{0.226533443f, 0.208592266f},
-std::array<float,2>{0.35441944f, 0.600116611f},
-std::array<float,2>{0.558201194f, 0.0125880623f},
-std::array<float,2>{0.971673727f, 0.91488415f},
-std::array<float,2>{0.121575676f, 0.276567668f},
-std::array<float,2>{0.143222734f, 0.853865325f},
-std::array<float,2>{0.816746175f, 0.412709087f},
-std::array<float,2>{0.705600083f, 0.671429396f},
-std::array<float,2>{0.42565617f, 0.158578277f},
-std::array<float,2>{0.019988725f, 0.687911749f},
-std::array<float,2>{0.91841805f, 0.214354366f},
-std::array<float,2>{0.571474671f, 0.787735879f},
-std::array<float,2>{0.282538772f, 0.447043389f},
-std::array<float,2>{0.44652161f, 0.992453575f},
-std::array<float,2>{0.657188952f, 0.346967399f},
-std::array<float,2>{0.781457305f, 0.535319924f},
-std::array<float,2>{0.203632325f, 0.121887699f},
-std::array<float,2>{0.399275243f, 0.626760066f},
-std::array<float,2>{0.739944816f, 0.135986745f},
-std::array<float,2>{0.844687104f, 0.82645309f},
-std::array<float,2>{0.163656309f, 0.389951825f},
-std::array<float,2>{0.0718909353f, 0.875882506f},
-std::array<float,2>{0.939600527f, 0.301597178f},
-std::array<float,2>{0.512991369f, 0.59088552f},
-std::array<float,2>{0.317516834f, 0.0427386723f},
-std::array<float,2>{0.2283528f, 0.526413083f},
-std::array<float,2>{0.773376048f, 0.0830895156f},
-std::array<float,2>{0.634359658f, 0.937735558f},
-std::array<float,2>{0.496091843f, 0.333130538f},
-std::array<float,2>{0.254218936f, 0.757923961f},
-std::array<float,2>{0.609530747f, 0.495091915f},
-std::array<float,2>{0.880585372f, 0.746415257f},
-std::array<float,2>{0.0574213713f, 0.228204027f},
-std::array<float,2>{0.476431161f, 0.549999595f},
-std::array<float,2>{0.651779771f, 0.107008398f},
-std::array<float,2>{0.7529127f, 0.983295679f},
-std::array<float,2>{0.243939295f, 0.369930089f},
-std::array<float,2>{0.0402926356f, 0.802102447f},
-std::array<float,2>{0.898718119f, 0.467233509f},
-std::array<float,2>{0.603486776f, 0.712666035f},
-std::array<float,2>{0.268305272f, 0.195996881f},
-std::array<float,2>{0.183737665f, 0.685107708f},
-std::array<float,2>{0.864091396f, 0.185383931f},
-std::array<float,2>{0.720300615f, 0.860422432f},
-std::array<float,2>{0.387072295f, 0.430005491f},
-std::array<float,2>{0.330522567f, 0.924464107f},
-std::array<float,2>{0.520067215f, 0.250655919f},
-std::array<float,2>{0.96804589f, 0.61572665f},
-std::array<float,2>{0.0924128219f, 0.0300780796f},
-std::array<float,2>{0.308232278f, 0.721045136f},
-std::array<float,2>{0.582770348f, 0.249041587f},
-std::array<float,2>{0.937416255f, 0.775294304f},
-std::array<float,2>{0.0138640627f, 0.470620662f},
-std::array<float,2>{0.201477021f, 0.959332287f},
-std::array<float,2>{0.80706203f, 0.327435732f},
-std::array<float,2>{0.686118424f, 0.509823203f},
-std::array<float,2>{0.46747458f, 0.0633316115f},
-std::array<float,2>{0.102897555f, 0.575394034f},
-std::array<float,2>{0.986078262f, 0.0578084514f},
-std::array<float,2>{0.534992218f, 0.899110198f},
-std::array<float,2>{0.359613538f, 0.288949639f},
-std::array<float,2>{0.409810215f, 0.837473869f},
-std::array<float,2>{0.700178862f, 0.391672134f},
-std::array<float,2>{0.834964216f, 0.641569972f},
-std::array<float,2>{0.12918365f, 0.147553295f},
-std::array<float,2>{0.250035942f, 0.620172858f},
-std::array<float,2>{0.613975525f, 0.0189123843f},
-std::array<float,2>{0.877346635f, 0.931655645f},
-std::array<float,2>{0.0606021695f, 0.265439868f},
-std::array<float,2>{0.231804386f, 0.872290254f},
-std::array<float,2>{0.767783821f, 0.426019251f},
-std::array<float,2>{0.63997364f, 0.678549826f},
-std::array<float,2>{0.497221351f, 0.173382029f},
-std::array<float,2>{0.0756474957f, 0.707833469f},
-std::array<float,2>{0.944959641f, 0.192202047f},
-std::array<float,2>{0.510080755f, 0.805740118f},
-std::array<float,2>{0.312584132f, 0.453228295f},
-std::array<float,2>{0.402817994f, 0.97651726f},
-std::array<float,2>{0.735809982f, 0.359928042f},
-std::array<float,2>{0.848001838f, 0.559029877f},
-std::array<float,2>{0.158236802f, 0.0997984856f},
-std::array<float,2>{0.450413346f, 0.651293397f},
-std::array<float,2>{0.662770867f, 0.150528014f},
-std::array<float,2>{0.788619518f, 0.83281666f},
-std::array<float,2>{0.207215697f, 0.40298903f},
-std::array<float,2>{0.0157909971f, 0.893940866f},
-std::array<float,2>{0.914796233f, 0.290379524f},
-std::array<float,2>{0.576894581f, 0.566046894f},
-std::array<float,2>{0.288462996f, 0.0537814423f},
-std::array<float,2>{0.144914389f, 0.501551151f},
-std::array<float,2>{0.813294291f, 0.0715835616f},
-std::array<float,2>{0.708252609f, 0.961138785f},
-std::array<float,2>{0.428128511f, 0.316675365f},
-std::array<float,2>{0.355520874f, 0.765863419f},
-std::array<float,2>{0.562326849f, 0.483015478f},
-std::array<float,2>{0.974813879f, 0.734176338f},
-std::array<float,2>{0.117381707f, 0.238474771f},
-std::array<float,2>{0.412028402f, 0.544967294f},
-std::array<float,2>{0.698881686f, 0.112372383f},
-std::array<float,2>{0.830502033f, 0.989795029f},
-std::array<float,2>{0.127731651f, 0.357757956f},
-std::array<float,2>{0.107827008f, 0.789523542f},
-std::array<float,2>{0.99052763f, 0.443098903f},
-std::array<float,2>{0.538079739f, 0.697276235f},
-std::array<float,2>{0.364846498f, 0.206583411f},
-std::array<float,2>{0.199144125f, 0.663055003f},
-std::array<float,2>{0.810193181f, 0.167307362f},
-std::array<float,2>{0.681387126f, 0.847473085f},
-std::array<float,2>{0.461690784f, 0.421852559f},
-std::array<float,2>{0.310394377f, 0.908020914f},
-std::array<float,2>{0.58103931f, 0.270839959f},
-std::array<float,2>{0.932004452f, 0.602368772f},
-std::array<float,2>{0.00866659638f, 0.00114530989f},
-std::array<float,2>{0.335046619f, 0.734962881f},
-std::array<float,2>{0.516029239f, 0.220369339f},
-std::array<float,2>{0.962326586f, 0.755954921f},
-std::array<float,2>{0.0868194848f, 0.487476349f},
-std::array<float,2>{0.181371391f, 0.94618398f},
-std::array<float,2>{0.860900223f, 0.340667456f},
-std::array<float,2>{0.724246919f, 0.520913839f},
-std::array<float,2>{0.386400729f, 0.086233303f},
-std::array<float,2>{0.0444040895f, 0.582637966f},
-std::array<float,2>{0.903206766f, 0.0355905853f},
-std::array<float,2>{0.607040048f, 0.888446391f},
-std::array<float,2>{0.270536155f, 0.308692336f},
-std::array<float,2>{0.469691813f, 0.813656509f},
-std::array<float,2>{0.654316545f, 0.380006909f},
-std::array<float,2>{0.755276084f, 0.636372149f},
-std::array<float,2>{0.246879309f, 0.126153186f},
-std::array<float,2>{0.369302541f, 0.530382872f},
-std::array<float,2>{0.542431056f, 0.0792783052f},
-std::array<float,2>{0.999025106f, 0.94199872f},
-std::array<float,2>{0.0961571932f, 0.331302196f},
-std::array<float,2>{0.139563665f, 0.762031972f},
-std::array<float,2>{0.841570139f, 0.498839468f},
-std::array<float,2>{0.694457829f, 0.742430806f},
-std::array<float,2>{0.417548746f, 0.230718672f},
-std::array<float,2>{0.00737021584f, 0.63105005f},
-std::array<float,2>{0.924180031f, 0.140198842f},
-std::array<float,2>{0.58747834f, 0.823479593f},
-std::array<float,2>{0.301823884f, 0.385477781f},
-std::array<float,2>{0.454220146f, 0.879141927f},
-std::array<float,2>{0.673801303f, 0.298624605f},
-std::array<float,2>{0.800354004f, 0.587871611f},
-std::array<float,2>{0.195160747f, 0.0465632044f},
-std::array<float,2>{0.376724839f, 0.691451728f},
-std::array<float,2>{0.732242286f, 0.216152981f},
-std::array<float,2>{0.874229312f, 0.782162666f},
-std::array<float,2>{0.179279581f, 0.450661689f},
-std::array<float,2>{0.0817235783f, 0.998467803f},
-std::array<float,2>{0.96004498f, 0.350092411f},
-std::array<float,2>{0.524914622f, 0.531986237f},
-std::array<float,2>{0.33995232f, 0.11788705f},
-std::array<float,2>{0.236571491f, 0.594390512f},
-std::array<float,2>{0.762321234f, 0.00962857064f},
-std::array<float,2>{0.644117534f, 0.92075336f},
-std::array<float,2>{0.480266333f, 0.279189527f},
-std::array<float,2>{0.280599564f, 0.858499408f},
-std::array<float,2>{0.596804023f, 0.407493711f},
-std::array<float,2>{0.893254638f, 0.664838254f},
-std::array<float,2>{0.0319974758f, 0.162678301f},
-std::array<float,2>{0.486279696f, 0.572258592f},
-std::array<float,2>{0.632579684f, 0.0615463145f},
-std::array<float,2>{0.777509034f, 0.906171501f},
-std::array<float,2>{0.222002923f, 0.283182591f},
-std::array<float,2>{0.0489884205f, 0.84069711f},
-std::array<float,2>{0.887999952f, 0.395851046f},
-std::array<float,2>{0.619456291f, 0.644746125f},
-std::array<float,2>{0.26169005f, 0.143179014f},
-std::array<float,2>{0.164540336f, 0.723452747f},
-std::array<float,2>{0.85268867f, 0.242654189f},
-std::array<float,2>{0.746285319f, 0.777433455f},
-std::array<float,2>{0.397110999f, 0.475486755f},
-std::array<float,2>{0.324864805f, 0.953674257f},
-std::array<float,2>{0.50362891f, 0.322683305f},
-std::array<float,2>{0.94731015f, 0.514127016f},
-std::array<float,2>{0.0626663268f, 0.0666607991f},
-std::array<float,2>{0.293158025f, 0.681099892f},
-std::array<float,2>{0.564682722f, 0.180529863f},
-std::array<float,2>{0.910511136f, 0.865279973f},
-std::array<float,2>{0.0305230785f, 0.434958369f},
-std::array<float,2>{0.21389246f, 0.927953959f},
-std::array<float,2>{0.793498576f, 0.255235255f},
-std::array<float,2>{0.666044235f, 0.612129271f},
-std::array<float,2>{0.437772155f, 0.0250883922f},
-std::array<float,2>{0.110004239f, 0.554518402f},
-std::array<float,2>{0.978359938f, 0.103093855f},
-std::array<float,2>{0.54909128f, 0.977971613f},
-std::array<float,2>{0.344310939f, 0.374621511f},
-std::array<float,2>{0.430842429f, 0.797965169f},
-std::array<float,2>{0.718166471f, 0.462459296f},
-std::array<float,2>{0.820741296f, 0.716757953f},
-std::array<float,2>{0.154700607f, 0.201320708f},
-std::array<float,2>{0.299289018f, 0.557798684f},
-std::array<float,2>{0.591766477f, 0.0968184918f},
-std::array<float,2>{0.929586709f, 0.970699072f},
-std::array<float,2>{0.000824934279f, 0.366279125f},
-std::array<float,2>{0.187537476f, 0.809911489f},
-std::array<float,2>{0.802405179f, 0.460921407f},
-std::array<float,2>{0.678111792f, 0.706614375f},
-std::array<float,2>{0.457179368f, 0.189112484f},
-std::array<float,2>{0.0990406945f, 0.674989402f},
-std::array<float,2>{0.993267298f, 0.177197605f},
-std::array<float,2>{0.545972526f, 0.867654026f},
-std::array<float,2>{0.372240335f, 0.423467964f},
-std::array<float,2>{0.418272853f, 0.937147021f},
-std::array<float,2>{0.687775135f, 0.261288702f},
-std::array<float,2>{0.836515307f, 0.622890353f},
-std::array<float,2>{0.134186357f, 0.0230315626f},
-std::array<float,2>{0.483763367f, 0.728432655f},
-std::array<float,2>{0.647793889f, 0.236273453f},
-std::array<float,2>{0.761083722f, 0.769916117f},
-std::array<float,2>{0.239096165f, 0.476901144f},
-std::array<float,2>{0.0371452346f, 0.96604234f},
-std::array<float,2>{0.895572126f, 0.313481599f},
-std::array<float,2>{0.601513565f, 0.507066905f},
-std::array<float,2>{0.274705827f, 0.0754304603f},
-std::array<float,2>{0.175639138f, 0.568692029f},
-std::array<float,2>{0.869412422f, 0.050179895f},
-std::array<float,2>{0.727347732f, 0.897866607f},
-std::array<float,2>{0.382077575f, 0.296750307f},
-std::array<float,2>{0.336325914f, 0.831837535f},
-std::array<float,2>{0.527385652f, 0.401981473f},
-std::array<float,2>{0.954549372f, 0.65279597f},
-std::array<float,2>{0.082981497f, 0.154667795f},
-std::array<float,2>{0.393617243f, 0.606328726f},
-std::array<float,2>{0.743226767f, 0.00433461741f},
-std::array<float,2>{0.857126117f, 0.912307203f},
-std::array<float,2>{0.170070246f, 0.268253326f},
-std::array<float,2>{0.0671121404f, 0.850209177f},
-std::array<float,2>{0.950078487f, 0.417635739f},
-std::array<float,2>{0.507103801f, 0.657269061f},
-std::array<float,2>{0.323890239f, 0.170114234f},
-std::array<float,2>{0.223793462f, 0.70155412f},
-std::array<float,2>{0.776990592f, 0.210125387f},
-std::array<float,2>{0.626511812f, 0.794347763f},
-std::array<float,2>{0.489974618f, 0.437949449f},
-std::array<float,2>{0.265065789f, 0.987415135f},
-std::array<float,2>{0.622581005f, 0.352249295f},
-std::array<float,2>{0.885081887f, 0.542232037f},
-std::array<float,2>{0.0531188548f, 0.114053257f},
-std::array<float,2>{0.348459542f, 0.63964349f},
-std::array<float,2>{0.553305745f, 0.131479934f},
-std::array<float,2>{0.982516766f, 0.819516778f},
-std::array<float,2>{0.116550036f, 0.376035601f},
-std::array<float,2>{0.149231344f, 0.885070384f},
-std::array<float,2>{0.827851355f, 0.308407575f},
-std::array<float,2>{0.712290049f, 0.579521477f},
-std::array<float,2>{0.436568677f, 0.0328279734f},
-std::array<float,2>{0.0244109295f, 0.518159449f},
-std::array<float,2>{0.908613861f, 0.0913018361f},
-std::array<float,2>{0.568457246f, 0.949714422f},
-std::array<float,2>{0.291760653f, 0.336877316f},
-std::array<float,2>{0.442643315f, 0.752570629f},
-std::array<float,2>{0.67081964f, 0.492129415f},
-std::array<float,2>{0.789763212f, 0.740812361f},
-std::array<float,2>{0.217406794f, 0.223501071f},
-std::array<float,2>{0.319967806f, 0.592516005f},
-std::array<float,2>{0.514968276f, 0.0393061116f},
-std::array<float,2>{0.939435959f, 0.878740728f},
-std::array<float,2>{0.0732098296f, 0.303949445f},
-std::array<float,2>{0.160959885f, 0.82597506f},
-std::array<float,2>{0.847553372f, 0.387015551f},
-std::array<float,2>{0.741483927f, 0.627214074f},
-std::array<float,2>{0.401968926f, 0.134252757f},
-std::array<float,2>{0.0553281754f, 0.748092592f},
-std::array<float,2>{0.881067872f, 0.229503125f},
-std::array<float,2>{0.61314261f, 0.75986743f},
-std::array<float,2>{0.256298602f, 0.493322432f},
-std::array<float,2>{0.492742389f, 0.940599024f},
-std::array<float,2>{0.634949088f, 0.334053069f},
-std::array<float,2>{0.77105248f, 0.524365067f},
-std::array<float,2>{0.23040244f, 0.0856873542f},
-std::array<float,2>{0.42375657f, 0.6695714f},
-std::array<float,2>{0.703557372f, 0.157296583f},
-std::array<float,2>{0.818403423f, 0.852049947f},
-std::array<float,2>{0.142252669f, 0.411562055f},
-std::array<float,2>{0.124712043f, 0.916511536f},
-std::array<float,2>{0.970518887f, 0.273455143f},
-std::array<float,2>{0.556210637f, 0.598023117f},
-std::array<float,2>{0.351716876f, 0.0154666044f},
-std::array<float,2>{0.205663547f, 0.538810909f},
-std::array<float,2>{0.783928037f, 0.123870946f},
-std::array<float,2>{0.658271134f, 0.994598866f},
-std::array<float,2>{0.447529107f, 0.344798326f},
-std::array<float,2>{0.283339173f, 0.785812676f},
-std::array<float,2>{0.57272619f, 0.449110508f},
-std::array<float,2>{0.921299815f, 0.691281319f},
-std::array<float,2>{0.0216029361f, 0.2109382f},
-std::array<float,2>{0.465906531f, 0.50959903f},
-std::array<float,2>{0.68378216f, 0.0663589537f},
-std::array<float,2>{0.805585623f, 0.958102167f},
-std::array<float,2>{0.199899897f, 0.324473679f},
-std::array<float,2>{0.0118943136f, 0.776371419f},
-std::array<float,2>{0.935214877f, 0.472330093f},
-std::array<float,2>{0.585760236f, 0.720693052f},
-std::array<float,2>{0.305686623f, 0.246980637f},
-std::array<float,2>{0.131127745f, 0.642702818f},
-std::array<float,2>{0.833604932f, 0.144634798f},
-std::array<float,2>{0.702613056f, 0.837931514f},
-std::array<float,2>{0.407696545f, 0.392788589f},
-std::array<float,2>{0.363190442f, 0.90204066f},
-std::array<float,2>{0.532036364f, 0.286116272f},
-std::array<float,2>{0.987184048f, 0.577254713f},
-std::array<float,2>{0.103762388f, 0.0553916879f},
-std::array<float,2>{0.267368138f, 0.713814318f},
-std::array<float,2>{0.604813993f, 0.197591081f},
-std::array<float,2>{0.902266026f, 0.804653645f},
-std::array<float,2>{0.0428980216f, 0.465261906f},
-std::array<float,2>{0.245606869f, 0.981434941f},
-std::array<float,2>{0.751783311f, 0.367657244f},
-std::array<float,2>{0.650254846f, 0.54706037f},
-std::array<float,2>{0.473849297f, 0.107642382f},
-std::array<float,2>{0.0907756612f, 0.614176452f},
-std::array<float,2>{0.965441406f, 0.0282296073f},
-std::array<float,2>{0.521738172f, 0.922192991f},
-std::array<float,2>{0.328440577f, 0.252676696f},
-std::array<float,2>{0.390503377f, 0.862583756f},
-std::array<float,2>{0.721292615f, 0.432558239f},
-std::array<float,2>{0.866257429f, 0.687463582f},
-std::array<float,2>{0.185786456f, 0.186031818f},
-std::array<float,2>{0.25603655f, 0.590683997f},
-std::array<float,2>{0.612814426f, 0.0414070673f},
-std::array<float,2>{0.881265163f, 0.87673974f},
-std::array<float,2>{0.0554224215f, 0.302673042f},
-std::array<float,2>{0.23019892f, 0.82800597f},
-std::array<float,2>{0.77127403f, 0.389619231f},
-std::array<float,2>{0.635148942f, 0.625156164f},
-std::array<float,2>{0.493142694f, 0.134776682f},
-std::array<float,2>{0.0729420856f, 0.747871399f},
-std::array<float,2>{0.938973427f, 0.227418721f},
-std::array<float,2>{0.514688969f, 0.759016335f},
-std::array<float,2>{0.320147723f, 0.495606214f},
-std::array<float,2>{0.40225774f, 0.939149678f},
-std::array<float,2>{0.741283715f, 0.332808495f},
-std::array<float,2>{0.847396076f, 0.525994301f},
-std::array<float,2>{0.160750315f, 0.0829879567f},
-std::array<float,2>{0.447474122f, 0.670185983f},
-std::array<float,2>{0.658463657f, 0.159254119f},
-std::array<float,2>{0.783967614f, 0.854632854f},
-std::array<float,2>{0.206027105f, 0.413611054f},
-std::array<float,2>{0.0218742806f, 0.91586417f},
-std::array<float,2>{0.921081066f, 0.275476277f},
-std::array<float,2>{0.572287261f, 0.601210594f},
-std::array<float,2>{0.28348738f, 0.0130460532f},
-std::array<float,2>{0.142483756f, 0.536482215f},
-std::array<float,2>{0.818743646f, 0.12293309f},
-std::array<float,2>{0.703151584f, 0.994078577f},
-std::array<float,2>{0.423513234f, 0.346419483f},
-std::array<float,2>{0.351856977f, 0.78822124f},
-std::array<float,2>{0.55657649f, 0.445315689f},
-std::array<float,2>{0.970263839f, 0.689238012f},
-std::array<float,2>{0.124985591f, 0.213677868f},
-std::array<float,2>{0.407456726f, 0.511051059f},
-std::array<float,2>{0.702178121f, 0.0635842532f},
-std::array<float,2>{0.833836854f, 0.960502088f},
-std::array<float,2>{0.13102138f, 0.3267681f},
-std::array<float,2>{0.103541717f, 0.774275243f},
-std::array<float,2>{0.986962914f, 0.468807369f},
-std::array<float,2>{0.531942189f, 0.721977293f},
-std::array<float,2>{0.363003433f, 0.24855642f},
-std::array<float,2>{0.20008719f, 0.642036021f},
-std::array<float,2>{0.805218935f, 0.146644324f},
-std::array<float,2>{0.683992863f, 0.836690426f},
-std::array<float,2>{0.466295183f, 0.391066074f},
-std::array<float,2>{0.306032211f, 0.899612188f},
-std::array<float,2>{0.5855425f, 0.287656307f},
-std::array<float,2>{0.935375988f, 0.574627757f},
-std::array<float,2>{0.0120224189f, 0.0573661923f},
-std::array<float,2>{0.328349531f, 0.711906135f},
-std::array<float,2>{0.521585524f, 0.196598887f},
-std::array<float,2>{0.965592682f, 0.80089426f},
-std::array<float,2>{0.0904999375f, 0.468350172f},
-std::array<float,2>{0.186013877f, 0.984365523f},
-std::array<float,2>{0.866589785f, 0.37097159f},
-std::array<float,2>{0.72151202f, 0.549362779f},
-std::array<float,2>{0.390198439f, 0.106384501f},
-std::array<float,2>{0.0424935445f, 0.617088974f},
-std::array<float,2>{0.902010858f, 0.0305707268f},
-std::array<float,2>{0.604658365f, 0.925368726f},
-std::array<float,2>{0.267150998f, 0.2517322f},
-std::array<float,2>{0.474044412f, 0.860202074f},
-std::array<float,2>{0.650097489f, 0.431337416f},
-std::array<float,2>{0.75158006f, 0.683720648f},
-std::array<float,2>{0.245980769f, 0.184298813f},
-std::array<float,2>{0.372515827f, 0.555252373f},
-std::array<float,2>{0.546293855f, 0.0947103724f},
-std::array<float,2>{0.993573308f, 0.970878482f},
-std::array<float,2>{0.0987303928f, 0.363500804f},
-std::array<float,2>{0.133797035f, 0.811771035f},
-std::array<float,2>{0.836909831f, 0.457879096f},
-std::array<float,2>{0.687735081f, 0.703770041f},
-std::array<float,2>{0.418096453f, 0.190481201f},
-std::array<float,2>{0.000730118307f, 0.672706187f},
-std::array<float,2>{0.929324687f, 0.17860575f},
-std::array<float,2>{0.591368735f, 0.870614171f},
-std::array<float,2>{0.298947096f, 0.425468296f},
-std::array<float,2>{0.457427114f, 0.934348404f},
-std::array<float,2>{0.677815557f, 0.259224176f},
-std::array<float,2>{0.802491963f, 0.623864472f},
-std::array<float,2>{0.187888682f, 0.0204646457f},
-std::array<float,2>{0.382092237f, 0.729432046f},
-std::array<float,2>{0.727132916f, 0.236612424f},
-std::array<float,2>{0.869156539f, 0.773296893f},
-std::array<float,2>{0.175451547f, 0.47932893f},
-std::array<float,2>{0.0827382579f, 0.967297494f},
-std::array<float,2>{0.954270184f, 0.316395879f},
-std::array<float,2>{0.527729928f, 0.504657328f},
-std::array<float,2>{0.336000502f, 0.0776627436f},
-std::array<float,2>{0.23899509f, 0.566987634f},
-std::array<float,2>{0.760794461f, 0.0477844328f},
-std::array<float,2>{0.647590995f, 0.895847976f},
-std::array<float,2>{0.483593315f, 0.293001086f},
-std::array<float,2>{0.274487525f, 0.829541743f},
-std::array<float,2>{0.601161242f, 0.399420589f},
-std::array<float,2>{0.895834744f, 0.654432595f},
-std::array<float,2>{0.0374523103f, 0.153426215f},
-std::array<float,2>{0.49021858f, 0.608689606f},
-std::array<float,2>{0.626824737f, 0.00750255492f},
-std::array<float,2>{0.777164102f, 0.911724269f},
-std::array<float,2>{0.224016994f, 0.265895844f},
-std::array<float,2>{0.0527381413f, 0.849032521f},
-std::array<float,2>{0.884912431f, 0.41447556f},
-std::array<float,2>{0.62290889f, 0.658621848f},
-std::array<float,2>{0.264689445f, 0.169102028f},
-std::array<float,2>{0.170371592f, 0.700463891f},
-std::array<float,2>{0.857197881f, 0.207705095f},
-std::array<float,2>{0.743456841f, 0.796744823f},
-std::array<float,2>{0.394007683f, 0.440263629f},
-std::array<float,2>{0.324168473f, 0.986179054f},
-std::array<float,2>{0.507054746f, 0.354368806f},
-std::array<float,2>{0.949710548f, 0.540776432f},
-std::array<float,2>{0.0671754479f, 0.116940625f},
-std::array<float,2>{0.291654408f, 0.638200998f},
-std::array<float,2>{0.568652451f, 0.129612774f},
-std::array<float,2>{0.908294976f, 0.817105293f},
-std::array<float,2>{0.0241491701f, 0.377989829f},
-std::array<float,2>{0.217565313f, 0.883606613f},
-std::array<float,2>{0.790017366f, 0.305779099f},
-std::array<float,2>{0.670512795f, 0.580485225f},
-std::array<float,2>{0.44248119f, 0.0335694589f},
-std::array<float,2>{0.116315663f, 0.515667081f},
-std::array<float,2>{0.98267287f, 0.0936620012f},
-std::array<float,2>{0.553564429f, 0.951967478f},
-std::array<float,2>{0.348383039f, 0.338868082f},
-std::array<float,2>{0.4368774f, 0.750465393f},
-std::array<float,2>{0.712034285f, 0.490222663f},
-std::array<float,2>{0.828066349f, 0.739105344f},
-std::array<float,2>{0.149111316f, 0.226434395f},
-std::array<float,2>{0.302141845f, 0.528749824f},
-std::array<float,2>{0.587876081f, 0.0811263323f},
-std::array<float,2>{0.923857212f, 0.94494766f},
-std::array<float,2>{0.00757386349f, 0.328141451f},
-std::array<float,2>{0.194977328f, 0.764895856f},
-std::array<float,2>{0.800556183f, 0.496566236f},
-std::array<float,2>{0.673483729f, 0.744836867f},
-std::array<float,2>{0.454420477f, 0.234243035f},
-std::array<float,2>{0.095848456f, 0.630473852f},
-std::array<float,2>{0.999363005f, 0.137294039f},
-std::array<float,2>{0.54207176f, 0.821879864f},
-std::array<float,2>{0.369560361f, 0.383643031f},
-std::array<float,2>{0.417866439f, 0.882223487f},
-std::array<float,2>{0.694617093f, 0.299457908f},
-std::array<float,2>{0.84143436f, 0.588422477f},
-std::array<float,2>{0.139353931f, 0.0430804603f},
-std::array<float,2>{0.480189651f, 0.694765627f},
-std::array<float,2>{0.644371688f, 0.21851626f},
-std::array<float,2>{0.762508273f, 0.784364104f},
-std::array<float,2>{0.236636445f, 0.451271176f},
-std::array<float,2>{0.0319360234f, 0.997579396f},
-std::array<float,2>{0.893481374f, 0.348741204f},
-std::array<float,2>{0.597027361f, 0.534570336f},
-std::array<float,2>{0.28030172f, 0.120289795f},
-std::array<float,2>{0.17959775f, 0.597204149f},
-std::array<float,2>{0.874412596f, 0.0104539497f},
-std::array<float,2>{0.731944084f, 0.918061316f},
-std::array<float,2>{0.376551867f, 0.279511809f},
-std::array<float,2>{0.340314597f, 0.855598748f},
-std::array<float,2>{0.525198221f, 0.409372061f},
-std::array<float,2>{0.960318089f, 0.66635257f},
-std::array<float,2>{0.0819742829f, 0.160398543f},
-std::array<float,2>{0.397417963f, 0.572424412f},
-std::array<float,2>{0.74641186f, 0.0602376983f},
-std::array<float,2>{0.852884889f, 0.902753711f},
-std::array<float,2>{0.164188519f, 0.284657657f},
-std::array<float,2>{0.062831603f, 0.843445599f},
-std::array<float,2>{0.947731078f, 0.397125185f},
-std::array<float,2>{0.503687203f, 0.646811128f},
-std::array<float,2>{0.325015336f, 0.142204657f},
-std::array<float,2>{0.221858561f, 0.725711107f},
-std::array<float,2>{0.777742147f, 0.244759381f},
-std::array<float,2>{0.63254714f, 0.77985394f},
-std::array<float,2>{0.485935837f, 0.474320024f},
-std::array<float,2>{0.261360556f, 0.955727637f},
-std::array<float,2>{0.619154871f, 0.321103215f},
-std::array<float,2>{0.887906253f, 0.512759626f},
-std::array<float,2>{0.0490923375f, 0.0695465356f},
-std::array<float,2>{0.34462437f, 0.682868898f},
-std::array<float,2>{0.548906386f, 0.183257669f},
-std::array<float,2>{0.978254259f, 0.863531947f},
-std::array<float,2>{0.110114001f, 0.437300384f},
-std::array<float,2>{0.154337451f, 0.927329302f},
-std::array<float,2>{0.820542097f, 0.25600034f},
-std::array<float,2>{0.717858315f, 0.610828102f},
-std::array<float,2>{0.431082338f, 0.025925966f},
-std::array<float,2>{0.0303617362f, 0.55130595f},
-std::array<float,2>{0.910299301f, 0.104225583f},
-std::array<float,2>{0.564932764f, 0.979523897f},
-std::array<float,2>{0.293436855f, 0.372499019f},
-std::array<float,2>{0.43760848f, 0.799102783f},
-std::array<float,2>{0.666455448f, 0.464007199f},
-std::array<float,2>{0.793848276f, 0.718318045f},
-std::array<float,2>{0.214164346f, 0.199821815f},
-std::array<float,2>{0.312845767f, 0.618894279f},
-std::array<float,2>{0.509978116f, 0.0166108496f},
-std::array<float,2>{0.945138097f, 0.931164324f},
-std::array<float,2>{0.0753277913f, 0.263271689f},
-std::array<float,2>{0.158551797f, 0.873698771f},
-std::array<float,2>{0.847679973f, 0.429395527f},
-std::array<float,2>{0.735589743f, 0.676854372f},
-std::array<float,2>{0.402382523f, 0.17405051f},
-std::array<float,2>{0.0609410815f, 0.710509956f},
-std::array<float,2>{0.877196014f, 0.194348335f},
-std::array<float,2>{0.614045441f, 0.808276236f},
-std::array<float,2>{0.25025177f, 0.455231041f},
-std::array<float,2>{0.497556746f, 0.97363174f},
-std::array<float,2>{0.639649689f, 0.362793684f},
-std::array<float,2>{0.768003285f, 0.560888767f},
-std::array<float,2>{0.231531054f, 0.0994107649f},
-std::array<float,2>{0.427975774f, 0.648610234f},
-std::array<float,2>{0.708185971f, 0.14870353f},
-std::array<float,2>{0.81314218f, 0.835335076f},
-std::array<float,2>{0.14471525f, 0.40568617f},
-std::array<float,2>{0.117637269f, 0.891343534f},
-std::array<float,2>{0.975021243f, 0.292238414f},
-std::array<float,2>{0.562128425f, 0.563834965f},
-std::array<float,2>{0.355864316f, 0.0513405204f},
-std::array<float,2>{0.207441837f, 0.502442896f},
-std::array<float,2>{0.788999259f, 0.0726695359f},
-std::array<float,2>{0.663074434f, 0.9630211f},
-std::array<float,2>{0.450675577f, 0.320291102f},
-std::array<float,2>{0.288230836f, 0.76912421f},
-std::array<float,2>{0.576995909f, 0.481366009f},
-std::array<float,2>{0.914664924f, 0.730766475f},
-std::array<float,2>{0.0160983037f, 0.240758181f},
-std::array<float,2>{0.461538374f, 0.543007314f},
-std::array<float,2>{0.681432486f, 0.109400958f},
-std::array<float,2>{0.810372293f, 0.991535664f},
-std::array<float,2>{0.198947892f, 0.356446266f},
-std::array<float,2>{0.00837951805f, 0.792145133f},
-std::array<float,2>{0.931849837f, 0.443466783f},
-std::array<float,2>{0.58072865f, 0.696349442f},
-std::array<float,2>{0.310060382f, 0.204912007f},
-std::array<float,2>{0.127647623f, 0.661645174f},
-std::array<float,2>{0.83012861f, 0.165931821f},
-std::array<float,2>{0.699042976f, 0.844701409f},
-std::array<float,2>{0.411744893f, 0.418471992f},
-std::array<float,2>{0.365164965f, 0.909915924f},
-std::array<float,2>{0.537773192f, 0.272236764f},
-std::array<float,2>{0.990327775f, 0.604466796f},
-std::array<float,2>{0.107541874f, 0.00203081383f},
-std::array<float,2>{0.270947039f, 0.738093376f},
-std::array<float,2>{0.607397079f, 0.221720904f},
-std::array<float,2>{0.902851045f, 0.754616976f},
-std::array<float,2>{0.0441449545f, 0.484642357f},
-std::array<float,2>{0.24665378f, 0.948294342f},
-std::array<float,2>{0.754912734f, 0.342559069f},
-std::array<float,2>{0.654722393f, 0.521595657f},
-std::array<float,2>{0.469333619f, 0.0882168859f},
-std::array<float,2>{0.0866274685f, 0.584247947f},
-std::array<float,2>{0.961920202f, 0.0387535691f},
-std::array<float,2>{0.515699029f, 0.890040338f},
-std::array<float,2>{0.335345477f, 0.311944485f},
-std::array<float,2>{0.386556149f, 0.8157987f},
-std::array<float,2>{0.724438071f, 0.382017821f},
-std::array<float,2>{0.861084998f, 0.63331008f},
-std::array<float,2>{0.181441158f, 0.128509641f},
-std::array<float,2>{0.282389283f, 0.599167943f},
-std::array<float,2>{0.571600556f, 0.0141894696f},
-std::array<float,2>{0.918016672f, 0.917370737f},
-std::array<float,2>{0.0197328459f, 0.274645805f},
-std::array<float,2>{0.203985408f, 0.85261476f},
-std::array<float,2>{0.78172946f, 0.410681427f},
-std::array<float,2>{0.656858027f, 0.668495059f},
-std::array<float,2>{0.446661234f, 0.156843856f},
-std::array<float,2>{0.121126115f, 0.69024545f},
-std::array<float,2>{0.971285522f, 0.212295532f},
-std::array<float,2>{0.558551908f, 0.786410391f},
-std::array<float,2>{0.354053915f, 0.447331995f},
-std::array<float,2>{0.425338238f, 0.995988667f},
-std::array<float,2>{0.706034958f, 0.34429571f},
-std::array<float,2>{0.816422284f, 0.537113428f},
-std::array<float,2>{0.143460467f, 0.124953687f},
-std::array<float,2>{0.49569276f, 0.628343165f},
-std::array<float,2>{0.634590983f, 0.132946461f},
-std::array<float,2>{0.773052514f, 0.825156927f},
-std::array<float,2>{0.228252977f, 0.388161838f},
-std::array<float,2>{0.0572032779f, 0.87784636f},
-std::array<float,2>{0.880719662f, 0.303196102f},
-std::array<float,2>{0.609731317f, 0.592834473f},
-std::array<float,2>{0.254113466f, 0.0408990569f},
-std::array<float,2>{0.16392605f, 0.524789274f},
-std::array<float,2>{0.844367445f, 0.0841906816f},
-std::array<float,2>{0.740134001f, 0.939780653f},
-std::array<float,2>{0.398944259f, 0.335281938f},
-std::array<float,2>{0.317677528f, 0.761238873f},
-std::array<float,2>{0.51290524f, 0.49301371f},
-std::array<float,2>{0.939886808f, 0.7499336f},
-std::array<float,2>{0.0720749572f, 0.228804052f},
-std::array<float,2>{0.386944443f, 0.548765481f},
-std::array<float,2>{0.720631778f, 0.108713351f},
-std::array<float,2>{0.863880455f, 0.981541693f},
-std::array<float,2>{0.183917359f, 0.368322134f},
-std::array<float,2>{0.0927504003f, 0.803173125f},
-std::array<float,2>{0.967844725f, 0.466693908f},
-std::array<float,2>{0.520466924f, 0.714374423f},
-std::array<float,2>{0.330318958f, 0.19886522f},
-std::array<float,2>{0.243665993f, 0.686103463f},
-std::array<float,2>{0.75266248f, 0.187408715f},
-std::array<float,2>{0.651435971f, 0.862218976f},
-std::array<float,2>{0.476256013f, 0.433145911f},
-std::array<float,2>{0.26833275f, 0.923727274f},
-std::array<float,2>{0.603037298f, 0.253303319f},
-std::array<float,2>{0.898660779f, 0.614612281f},
-std::array<float,2>{0.0402392931f, 0.0287607871f},
-std::array<float,2>{0.35985148f, 0.719202697f},
-std::array<float,2>{0.53471607f, 0.247491568f},
-std::array<float,2>{0.986295521f, 0.775683641f},
-std::array<float,2>{0.102715954f, 0.471065432f},
-std::array<float,2>{0.129076481f, 0.957743168f},
-std::array<float,2>{0.835217714f, 0.325354099f},
-std::array<float,2>{0.699744105f, 0.507955253f},
-std::array<float,2>{0.410041094f, 0.0651045144f},
-std::array<float,2>{0.0141463252f, 0.576368034f},
-std::array<float,2>{0.937199712f, 0.0560677312f},
-std::array<float,2>{0.58264643f, 0.900593281f},
-std::array<float,2>{0.308362693f, 0.286292851f},
-std::array<float,2>{0.467715621f, 0.839059532f},
-std::array<float,2>{0.686306596f, 0.394006222f},
-std::array<float,2>{0.806827724f, 0.644251943f},
-std::array<float,2>{0.201391608f, 0.145976424f},
-std::array<float,2>{0.339059085f, 0.505919099f},
-std::array<float,2>{0.530859768f, 0.0748568624f},
-std::array<float,2>{0.955507636f, 0.965778351f},
-std::array<float,2>{0.08554589f, 0.313199371f},
-std::array<float,2>{0.172664076f, 0.771444201f},
-std::array<float,2>{0.868659735f, 0.478360057f},
-std::array<float,2>{0.730022728f, 0.726768076f},
-std::array<float,2>{0.380546331f, 0.235039085f},
-std::array<float,2>{0.0365421027f, 0.653599381f},
-std::array<float,2>{0.897421062f, 0.155893266f},
-std::array<float,2>{0.597936034f, 0.83088994f},
-std::array<float,2>{0.276042372f, 0.400609046f},
-std::array<float,2>{0.481259465f, 0.896915853f},
-std::array<float,2>{0.644988656f, 0.295311451f},
-std::array<float,2>{0.759744704f, 0.57029599f},
-std::array<float,2>{0.240787551f, 0.0490344167f},
-std::array<float,2>{0.420396984f, 0.705337524f},
-std::array<float,2>{0.690381289f, 0.187875092f},
-std::array<float,2>{0.838059366f, 0.809336066f},
-std::array<float,2>{0.136113256f, 0.459011674f},
-std::array<float,2>{0.101244971f, 0.9694767f},
-std::array<float,2>{0.995341837f, 0.365825623f},
-std::array<float,2>{0.54343152f, 0.557295442f},
-std::array<float,2>{0.374430805f, 0.0966394022f},
-std::array<float,2>{0.191256538f, 0.621822476f},
-std::array<float,2>{0.803099513f, 0.0219019838f},
-std::array<float,2>{0.6772874f, 0.935746491f},
-std::array<float,2>{0.460427433f, 0.260403872f},
-std::array<float,2>{0.297326595f, 0.868441701f},
-std::array<float,2>{0.59290576f, 0.422337174f},
-std::array<float,2>{0.925997019f, 0.674082041f},
-std::array<float,2>{0.00389501546f, 0.175792158f},
-std::array<float,2>{0.444873035f, 0.578731894f},
-std::array<float,2>{0.669298828f, 0.0312590003f},
-std::array<float,2>{0.791315019f, 0.886690557f},
-std::array<float,2>{0.215800807f, 0.307536036f},
-std::array<float,2>{0.0268132649f, 0.8184672f},
-std::array<float,2>{0.907573938f, 0.375249445f},
-std::array<float,2>{0.567222774f, 0.639896452f},
-std::array<float,2>{0.290185034f, 0.132093817f},
-std::array<float,2>{0.150961667f, 0.742044151f},
-std::array<float,2>{0.824914813f, 0.224001229f},
-std::array<float,2>{0.714158714f, 0.753775775f},
-std::array<float,2>{0.435038447f, 0.491135716f},
-std::array<float,2>{0.351468235f, 0.950478494f},
-std::array<float,2>{0.551624179f, 0.337590456f},
-std::array<float,2>{0.981902301f, 0.51938808f},
-std::array<float,2>{0.115116775f, 0.0899388492f},
-std::array<float,2>{0.263232768f, 0.656255722f},
-std::array<float,2>{0.623090148f, 0.170977339f},
-std::array<float,2>{0.883648813f, 0.851039648f},
-std::array<float,2>{0.0525189936f, 0.416695267f},
-std::array<float,2>{0.226187468f, 0.913550138f},
-std::array<float,2>{0.774754584f, 0.269293129f},
-std::array<float,2>{0.628757238f, 0.607406557f},
-std::array<float,2>{0.490459412f, 0.00563698635f},
-std::array<float,2>{0.0697523654f, 0.541888297f},
-std::array<float,2>{0.952026904f, 0.114900403f},
-std::array<float,2>{0.505402207f, 0.986862123f},
-std::array<float,2>{0.320480436f, 0.353118211f},
-std::array<float,2>{0.391214281f, 0.793906808f},
-std::array<float,2>{0.745505035f, 0.438971758f},
-std::array<float,2>{0.857805073f, 0.702497661f},
-std::array<float,2>{0.169254303f, 0.20965375f},
-std::array<float,2>{0.278442502f, 0.532261252f},
-std::array<float,2>{0.595194638f, 0.119104564f},
-std::array<float,2>{0.892074406f, 0.999524891f},
-std::array<float,2>{0.0333403945f, 0.350983739f},
-std::array<float,2>{0.23573783f, 0.782363474f},
-std::array<float,2>{0.765456855f, 0.44959709f},
-std::array<float,2>{0.641965806f, 0.693137288f},
-std::array<float,2>{0.476672262f, 0.214958832f},
-std::array<float,2>{0.0787196234f, 0.665860116f},
-std::array<float,2>{0.957407057f, 0.163143486f},
-std::array<float,2>{0.526426017f, 0.857722044f},
-std::array<float,2>{0.342671007f, 0.406846732f},
-std::array<float,2>{0.377675325f, 0.921132982f},
-std::array<float,2>{0.734086514f, 0.27770555f},
-std::array<float,2>{0.872468174f, 0.595593393f},
-std::array<float,2>{0.176887646f, 0.00826010667f},
-std::array<float,2>{0.45570758f, 0.743636608f},
-std::array<float,2>{0.674411416f, 0.232261881f},
-std::array<float,2>{0.79755497f, 0.763403773f},
-std::array<float,2>{0.192113072f, 0.499112576f},
-std::array<float,2>{0.00496055791f, 0.943341315f},
-std::array<float,2>{0.922861993f, 0.330412179f},
-std::array<float,2>{0.589767337f, 0.529608727f},
-std::array<float,2>{0.303483844f, 0.0785233378f},
-std::array<float,2>{0.136790916f, 0.586050093f},
-std::array<float,2>{0.843066633f, 0.0457584895f},
-std::array<float,2>{0.692739367f, 0.880223691f},
-std::array<float,2>{0.415149271f, 0.297391444f},
-std::array<float,2>{0.369035363f, 0.822563171f},
-std::array<float,2>{0.540571392f, 0.385864496f},
-std::array<float,2>{0.996192276f, 0.63245219f},
-std::array<float,2>{0.0948810726f, 0.139395609f},
-std::array<float,2>{0.431778044f, 0.613165259f},
-std::array<float,2>{0.714926839f, 0.0238414947f},
-std::array<float,2>{0.822459102f, 0.92939043f},
-std::array<float,2>{0.152664766f, 0.254703701f},
-std::array<float,2>{0.111560374f, 0.866389811f},
-std::array<float,2>{0.978544056f, 0.434373319f},
-std::array<float,2>{0.547088146f, 0.680260301f},
-std::array<float,2>{0.345766723f, 0.18097873f},
-std::array<float,2>{0.211560369f, 0.714914024f},
-std::array<float,2>{0.796400487f, 0.202911749f},
-std::array<float,2>{0.664672911f, 0.797028899f},
-std::array<float,2>{0.441270351f, 0.461728722f},
-std::array<float,2>{0.29511705f, 0.977047682f},
-std::array<float,2>{0.564160645f, 0.373842865f},
-std::array<float,2>{0.912196934f, 0.552780271f},
-std::array<float,2>{0.0285060462f, 0.102301635f},
-std::array<float,2>{0.326237082f, 0.646152794f},
-std::array<float,2>{0.500044048f, 0.143604934f},
-std::array<float,2>{0.947163343f, 0.841348171f},
-std::array<float,2>{0.0650944486f, 0.394595653f},
-std::array<float,2>{0.166795284f, 0.904633284f},
-std::array<float,2>{0.85510999f, 0.282024831f},
-std::array<float,2>{0.749862075f, 0.57118845f},
-std::array<float,2>{0.395719975f, 0.0611303076f},
-std::array<float,2>{0.0475420393f, 0.515109301f},
-std::array<float,2>{0.890108824f, 0.0674163252f},
-std::array<float,2>{0.617987275f, 0.954351127f},
-std::array<float,2>{0.258230239f, 0.323603511f},
-std::array<float,2>{0.487991214f, 0.778648674f},
-std::array<float,2>{0.629557788f, 0.475997388f},
-std::array<float,2>{0.77969718f, 0.724268258f},
-std::array<float,2>{0.219981283f, 0.243591741f},
-std::array<float,2>{0.358044118f, 0.565153599f},
-std::array<float,2>{0.558675885f, 0.0535923764f},
-std::array<float,2>{0.973846376f, 0.893086553f},
-std::array<float,2>{0.119601555f, 0.289523244f},
-std::array<float,2>{0.148102537f, 0.833449125f},
-std::array<float,2>{0.815958023f, 0.403635025f},
-std::array<float,2>{0.710044622f, 0.652136683f},
-std::array<float,2>{0.426311702f, 0.152315542f},
-std::array<float,2>{0.0187028032f, 0.733257115f},
-std::array<float,2>{0.917230844f, 0.239405841f},
-std::array<float,2>{0.575730741f, 0.767117083f},
-std::array<float,2>{0.285676032f, 0.483840048f},
-std::array<float,2>{0.451847821f, 0.962244689f},
-std::array<float,2>{0.661582232f, 0.317664891f},
-std::array<float,2>{0.786931098f, 0.500191748f},
-std::array<float,2>{0.210341752f, 0.0704013258f},
-std::array<float,2>{0.405218601f, 0.678838968f},
-std::array<float,2>{0.737261176f, 0.172109738f},
-std::array<float,2>{0.850139439f, 0.87116605f},
-std::array<float,2>{0.156884313f, 0.426783562f},
-std::array<float,2>{0.077559486f, 0.933422506f},
-std::array<float,2>{0.941416442f, 0.263944775f},
-std::array<float,2>{0.508566558f, 0.619748175f},
-std::array<float,2>{0.314642161f, 0.0179217607f},
-std::array<float,2>{0.233110949f, 0.560251653f},
-std::array<float,2>{0.767302871f, 0.100771926f},
-std::array<float,2>{0.637568951f, 0.974925458f},
-std::array<float,2>{0.498961687f, 0.360714942f},
-std::array<float,2>{0.252359957f, 0.805514514f},
-std::array<float,2>{0.617088318f, 0.4549613f},
-std::array<float,2>{0.87589854f, 0.708415985f},
-std::array<float,2>{0.0586392954f, 0.193219349f},
-std::array<float,2>{0.470839351f, 0.519962251f},
-std::array<float,2>{0.652576387f, 0.0872532055f},
-std::array<float,2>{0.757202268f, 0.946597338f},
-std::array<float,2>{0.249901116f, 0.341119856f},
-std::array<float,2>{0.0451558195f, 0.757153869f},
-std::array<float,2>{0.905572653f, 0.486459434f},
-std::array<float,2>{0.607879221f, 0.735411406f},
-std::array<float,2>{0.272815496f, 0.218915209f},
-std::array<float,2>{0.183411196f, 0.63540417f},
-std::array<float,2>{0.861407161f, 0.125137791f},
-std::array<float,2>{0.726272047f, 0.813330114f},
-std::array<float,2>{0.38331908f, 0.379342377f},
-std::array<float,2>{0.333594471f, 0.887020051f},
-std::array<float,2>{0.518988609f, 0.309660167f},
-std::array<float,2>{0.964491844f, 0.583334446f},
-std::array<float,2>{0.0891802013f, 0.036516089f},
-std::array<float,2>{0.310998827f, 0.698984504f},
-std::array<float,2>{0.579375684f, 0.205163747f},
-std::array<float,2>{0.930586159f, 0.790474534f},
-std::array<float,2>{0.0102152983f, 0.442046463f},
-std::array<float,2>{0.195627421f, 0.988770247f},
-std::array<float,2>{0.811274886f, 0.359039992f},
-std::array<float,2>{0.68176192f, 0.546755075f},
-std::array<float,2>{0.46323669f, 0.112180859f},
-std::array<float,2>{0.105499968f, 0.603187859f},
-std::array<float,2>{0.989046931f, 0.000121258206f},
-std::array<float,2>{0.535528243f, 0.907022953f},
-std::array<float,2>{0.365290105f, 0.270431459f},
-std::array<float,2>{0.413318634f, 0.846633673f},
-std::array<float,2>{0.696542263f, 0.420192599f},
-std::array<float,2>{0.828792036f, 0.663901448f},
-std::array<float,2>{0.126413956f, 0.166733727f},
-std::array<float,2>{0.306794584f, 0.576067567f},
-std::array<float,2>{0.583548665f, 0.0583703332f},
-std::array<float,2>{0.936184645f, 0.898579836f},
-std::array<float,2>{0.0150072621f, 0.288206011f},
-std::array<float,2>{0.202456266f, 0.83734858f},
-std::array<float,2>{0.807734787f, 0.392377377f},
-std::array<float,2>{0.687249303f, 0.640759647f},
-std::array<float,2>{0.468674034f, 0.148132101f},
-std::array<float,2>{0.10189122f, 0.721436679f},
-std::array<float,2>{0.984938443f, 0.249784961f},
-std::array<float,2>{0.533440709f, 0.774436057f},
-std::array<float,2>{0.361023992f, 0.469875038f},
-std::array<float,2>{0.408882767f, 0.9595415f},
-std::array<float,2>{0.700955808f, 0.327871621f},
-std::array<float,2>{0.834789157f, 0.510266781f},
-std::array<float,2>{0.13016203f, 0.0629396364f},
-std::array<float,2>{0.475164473f, 0.684813917f},
-std::array<float,2>{0.651242673f, 0.185040876f},
-std::array<float,2>{0.753790259f, 0.86111331f},
-std::array<float,2>{0.242628217f, 0.430405796f},
-std::array<float,2>{0.0393493176f, 0.92386961f},
-std::array<float,2>{0.89970547f, 0.250446677f},
-std::array<float,2>{0.602533758f, 0.615511835f},
-std::array<float,2>{0.269440562f, 0.0295631103f},
-std::array<float,2>{0.185141638f, 0.550574303f},
-std::array<float,2>{0.864667416f, 0.106680997f},
-std::array<float,2>{0.71956563f, 0.982872546f},
-std::array<float,2>{0.388263851f, 0.369608372f},
-std::array<float,2>{0.33121559f, 0.802541077f},
-std::array<float,2>{0.52054143f, 0.467476308f},
-std::array<float,2>{0.967321634f, 0.712269247f},
-std::array<float,2>{0.0929973423f, 0.195610538f},
-std::array<float,2>{0.399760813f, 0.527128518f},
-std::array<float,2>{0.738953233f, 0.0839597955f},
-std::array<float,2>{0.845225513f, 0.938032329f},
-std::array<float,2>{0.162386358f, 0.333743393f},
-std::array<float,2>{0.0710300729f, 0.758624017f},
-std::array<float,2>{0.940603316f, 0.494443417f},
-std::array<float,2>{0.511873364f, 0.746973991f},
-std::array<float,2>{0.316924393f, 0.227626354f},
-std::array<float,2>{0.226869479f, 0.626331031f},
-std::array<float,2>{0.771507323f, 0.136360019f},
-std::array<float,2>{0.633191705f, 0.827098846f},
-std::array<float,2>{0.494520217f, 0.390516639f},
-std::array<float,2>{0.255085051f, 0.875208914f},
-std::array<float,2>{0.610878587f, 0.301037818f},
-std::array<float,2>{0.879466057f, 0.591737509f},
-std::array<float,2>{0.0584646761f, 0.0421492197f},
-std::array<float,2>{0.354794472f, 0.688189805f},
-std::array<float,2>{0.556856275f, 0.214459583f},
-std::array<float,2>{0.97258848f, 0.787396193f},
-std::array<float,2>{0.122886717f, 0.446559817f},
-std::array<float,2>{0.144069612f, 0.993025243f},
-std::array<float,2>{0.817882359f, 0.34746471f},
-std::array<float,2>{0.706985593f, 0.535862923f},
-std::array<float,2>{0.424684256f, 0.121145569f},
-std::array<float,2>{0.0208381619f, 0.599913597f},
-std::array<float,2>{0.919041395f, 0.0117799677f},
-std::array<float,2>{0.570991218f, 0.914332211f},
-std::array<float,2>{0.28178978f, 0.277165473f},
-std::array<float,2>{0.44587937f, 0.854261041f},
-std::array<float,2>{0.657247603f, 0.412400603f},
-std::array<float,2>{0.782273471f, 0.671236157f},
-std::array<float,2>{0.205059335f, 0.15915589f},
-std::array<float,2>{0.321749508f, 0.539560258f},
-std::array<float,2>{0.50429827f, 0.115317456f},
-std::array<float,2>{0.953009963f, 0.98452276f},
-std::array<float,2>{0.0688681602f, 0.355159283f},
-std::array<float,2>{0.168519899f, 0.795884669f},
-std::array<float,2>{0.859289467f, 0.440795332f},
-std::array<float,2>{0.74502033f, 0.700034738f},
-std::array<float,2>{0.392047912f, 0.208098352f},
-std::array<float,2>{0.0516276173f, 0.659353852f},
-std::array<float,2>{0.884183943f, 0.168623701f},
-std::array<float,2>{0.624482572f, 0.847656727f},
-std::array<float,2>{0.262231171f, 0.415791512f},
-std::array<float,2>{0.491352111f, 0.911033034f},
-std::array<float,2>{0.627784014f, 0.267063648f},
-std::array<float,2>{0.774282157f, 0.60804683f},
-std::array<float,2>{0.225038484f, 0.00631440897f},
-std::array<float,2>{0.433768988f, 0.739955366f},
-std::array<float,2>{0.713701725f, 0.224609464f},
-std::array<float,2>{0.825379312f, 0.751676202f},
-std::array<float,2>{0.151679248f, 0.488419145f},
-std::array<float,2>{0.113848314f, 0.952615559f},
-std::array<float,2>{0.981174231f, 0.338225991f},
-std::array<float,2>{0.552487731f, 0.51745671f},
-std::array<float,2>{0.34969905f, 0.0926211253f},
-std::array<float,2>{0.216002628f, 0.581513941f},
-std::array<float,2>{0.792109251f, 0.0344447903f},
-std::array<float,2>{0.668884635f, 0.884032428f},
-std::array<float,2>{0.443996698f, 0.305161178f},
-std::array<float,2>{0.289469689f, 0.818319321f},
-std::array<float,2>{0.567993224f, 0.377353102f},
-std::array<float,2>{0.906878054f, 0.636840582f},
-std::array<float,2>{0.0257554781f, 0.130648166f},
-std::array<float,2>{0.459647685f, 0.624259531f},
-std::array<float,2>{0.676311314f, 0.0208065398f},
-std::array<float,2>{0.804067791f, 0.935229838f},
-std::array<float,2>{0.190408662f, 0.258371115f},
-std::array<float,2>{0.0020185078f, 0.869437933f},
-std::array<float,2>{0.927483082f, 0.42387706f},
-std::array<float,2>{0.59223479f, 0.673239052f},
-std::array<float,2>{0.298682719f, 0.179124653f},
-std::array<float,2>{0.135133684f, 0.704364896f},
-std::array<float,2>{0.839111924f, 0.190100685f},
-std::array<float,2>{0.69138366f, 0.811319888f},
-std::array<float,2>{0.421719253f, 0.458969563f},
-std::array<float,2>{0.373165846f, 0.972113907f},
-std::array<float,2>{0.544600368f, 0.364914656f},
-std::array<float,2>{0.994717002f, 0.555690944f},
-std::array<float,2>{0.100060053f, 0.0953641906f},
-std::array<float,2>{0.276643902f, 0.656213582f},
-std::array<float,2>{0.599005878f, 0.153019607f},
-std::array<float,2>{0.897871256f, 0.828983009f},
-std::array<float,2>{0.0358643979f, 0.399364829f},
-std::array<float,2>{0.241736576f, 0.895283043f},
-std::array<float,2>{0.758597791f, 0.294780493f},
-std::array<float,2>{0.646085382f, 0.567831993f},
-std::array<float,2>{0.481729507f, 0.0478545688f},
-std::array<float,2>{0.0841705725f, 0.505389273f},
-std::array<float,2>{0.956482112f, 0.0768552497f},
-std::array<float,2>{0.530148149f, 0.967862785f},
-std::array<float,2>{0.337892532f, 0.314677f},
-std::array<float,2>{0.379149914f, 0.772368014f},
-std::array<float,2>{0.729474008f, 0.479734451f},
-std::array<float,2>{0.867394328f, 0.729856968f},
-std::array<float,2>{0.173257679f, 0.237773702f},
-std::array<float,2>{0.259512037f, 0.511928618f},
-std::array<float,2>{0.618333817f, 0.0692839175f},
-std::array<float,2>{0.888744354f, 0.956728041f},
-std::array<float,2>{0.0487907119f, 0.321664244f},
-std::array<float,2>{0.219367728f, 0.780629933f},
-std::array<float,2>{0.781174541f, 0.472736031f},
-std::array<float,2>{0.630383015f, 0.724663913f},
-std::array<float,2>{0.486484468f, 0.245605752f},
-std::array<float,2>{0.0660275519f, 0.648296118f},
-std::array<float,2>{0.945391238f, 0.140812889f},
-std::array<float,2>{0.501359522f, 0.841887236f},
-std::array<float,2>{0.327413827f, 0.398250014f},
-std::array<float,2>{0.394926578f, 0.903717518f},
-std::array<float,2>{0.748402536f, 0.284028977f},
-std::array<float,2>{0.854094505f, 0.574179471f},
-std::array<float,2>{0.167373881f, 0.0595239215f},
-std::array<float,2>{0.439963549f, 0.717120945f},
-std::array<float,2>{0.665167332f, 0.201126531f},
-std::array<float,2>{0.795025766f, 0.800603509f},
-std::array<float,2>{0.212650791f, 0.463097781f},
-std::array<float,2>{0.0279617347f, 0.979069889f},
-std::array<float,2>{0.913689375f, 0.37180987f},
-std::array<float,2>{0.562672198f, 0.552691519f},
-std::array<float,2>{0.296097368f, 0.10544502f},
-std::array<float,2>{0.15382196f, 0.609567404f},
-std::array<float,2>{0.82339251f, 0.0271245651f},
-std::array<float,2>{0.7167207f, 0.926271021f},
-std::array<float,2>{0.433473945f, 0.257094622f},
-std::array<float,2>{0.347454458f, 0.865104854f},
-std::array<float,2>{0.54823947f, 0.436307639f},
-std::array<float,2>{0.980017006f, 0.682377636f},
-std::array<float,2>{0.112919129f, 0.18195115f},
-std::array<float,2>{0.414654523f, 0.589306772f},
-std::array<float,2>{0.691528678f, 0.0443800949f},
-std::array<float,2>{0.84187454f, 0.881624937f},
-std::array<float,2>{0.138168633f, 0.300613135f},
-std::array<float,2>{0.0942168832f, 0.821259916f},
-std::array<float,2>{0.997808874f, 0.384220541f},
-std::array<float,2>{0.539733887f, 0.629469931f},
-std::array<float,2>{0.367891043f, 0.137828633f},
-std::array<float,2>{0.193240941f, 0.746077001f},
-std::array<float,2>{0.798274517f, 0.233133093f},
-std::array<float,2>{0.675754786f, 0.764198959f},
-std::array<float,2>{0.456837982f, 0.497463584f},
-std::array<float,2>{0.304477721f, 0.94391346f},
-std::array<float,2>{0.588157237f, 0.329883397f},
-std::array<float,2>{0.922807932f, 0.527372599f},
-std::array<float,2>{0.00439284323f, 0.0805201307f},
-std::array<float,2>{0.343656391f, 0.667638183f},
-std::array<float,2>{0.526268661f, 0.161911547f},
-std::array<float,2>{0.95837903f, 0.857268155f},
-std::array<float,2>{0.0791895092f, 0.408369303f},
-std::array<float,2>{0.17650497f, 0.919242859f},
-std::array<float,2>{0.871517181f, 0.280439794f},
-std::array<float,2>{0.732663035f, 0.595862091f},
-std::array<float,2>{0.378082246f, 0.0110901482f},
-std::array<float,2>{0.0344619863f, 0.533610165f},
-std::array<float,2>{0.891085267f, 0.119707033f},
-std::array<float,2>{0.594644248f, 0.996597648f},
-std::array<float,2>{0.277401328f, 0.348457485f},
-std::array<float,2>{0.477592349f, 0.783603132f},
-std::array<float,2>{0.64157778f, 0.452321082f},
-std::array<float,2>{0.764630973f, 0.693804324f},
-std::array<float,2>{0.234383449f, 0.217645913f},
-std::array<float,2>{0.366526723f, 0.604975522f},
-std::array<float,2>{0.536497414f, 0.00328241871f},
-std::array<float,2>{0.989736736f, 0.908208907f},
-std::array<float,2>{0.107044481f, 0.272768736f},
-std::array<float,2>{0.12532334f, 0.845120788f},
-std::array<float,2>{0.829556108f, 0.419226497f},
-std::array<float,2>{0.696273923f, 0.660900474f},
-std::array<float,2>{0.412907749f, 0.164988652f},
-std::array<float,2>{0.0110246334f, 0.696193337f},
-std::array<float,2>{0.931171179f, 0.20363161f},
-std::array<float,2>{0.578309178f, 0.791850984f},
-std::array<float,2>{0.311624676f, 0.445298612f},
-std::array<float,2>{0.464504778f, 0.99078548f},
-std::array<float,2>{0.683366299f, 0.356249601f},
-std::array<float,2>{0.812120199f, 0.544172704f},
-std::array<float,2>{0.196952522f, 0.110695459f},
-std::array<float,2>{0.384418279f, 0.634027064f},
-std::array<float,2>{0.725363612f, 0.127881989f},
-std::array<float,2>{0.863070726f, 0.815259933f},
-std::array<float,2>{0.181975231f, 0.381724387f},
-std::array<float,2>{0.0879237577f, 0.889185488f},
-std::array<float,2>{0.963148534f, 0.311324447f},
-std::array<float,2>{0.518494606f, 0.585661709f},
-std::array<float,2>{0.332914293f, 0.037397787f},
-std::array<float,2>{0.248979241f, 0.52262038f},
-std::array<float,2>{0.756390095f, 0.0893645212f},
-std::array<float,2>{0.65375638f, 0.94765532f},
-std::array<float,2>{0.471804768f, 0.342953384f},
-std::array<float,2>{0.272240222f, 0.755587816f},
-std::array<float,2>{0.609173417f, 0.4857077f},
-std::array<float,2>{0.904312253f, 0.737102509f},
-std::array<float,2>{0.046484109f, 0.221125871f},
-std::array<float,2>{0.49938944f, 0.561987817f},
-std::array<float,2>{0.638283491f, 0.0981549919f},
-std::array<float,2>{0.766178131f, 0.974423349f},
-std::array<float,2>{0.23392497f, 0.361464918f},
-std::array<float,2>{0.060024742f, 0.807143629f},
-std::array<float,2>{0.876127839f, 0.456954747f},
-std::array<float,2>{0.616140723f, 0.709227204f},
-std::array<float,2>{0.252951175f, 0.193638369f},
-std::array<float,2>{0.158070117f, 0.676112175f},
-std::array<float,2>{0.851467669f, 0.175167143f},
-std::array<float,2>{0.738009155f, 0.874044418f},
-std::array<float,2>{0.405342281f, 0.427869618f},
-std::array<float,2>{0.316341221f, 0.930143714f},
-std::array<float,2>{0.5094437f, 0.262033284f},
-std::array<float,2>{0.943155646f, 0.617783844f},
-std::array<float,2>{0.07709454f, 0.0157810617f},
-std::array<float,2>{0.286838979f, 0.732035458f},
-std::array<float,2>{0.574641943f, 0.241326034f},
-std::array<float,2>{0.916522205f, 0.768507063f},
-std::array<float,2>{0.0177927241f, 0.481950492f},
-std::array<float,2>{0.209672391f, 0.96390456f},
-std::array<float,2>{0.785567582f, 0.318843424f},
-std::array<float,2>{0.661119998f, 0.503660083f},
-std::array<float,2>{0.452961594f, 0.0741882026f},
-std::array<float,2>{0.120435476f, 0.563021421f},
-std::array<float,2>{0.973281443f, 0.0524920449f},
-std::array<float,2>{0.560129344f, 0.891648054f},
-std::array<float,2>{0.359130561f, 0.291030973f},
-std::array<float,2>{0.426986605f, 0.834940553f},
-std::array<float,2>{0.709539413f, 0.404821366f},
-std::array<float,2>{0.815211296f, 0.650152504f},
-std::array<float,2>{0.147238642f, 0.149846241f},
-std::array<float,2>{0.266582936f, 0.613694668f},
-std::array<float,2>{0.604036093f, 0.0273605827f},
-std::array<float,2>{0.900621891f, 0.922774196f},
-std::array<float,2>{0.0414932221f, 0.252393901f},
-std::array<float,2>{0.244545162f, 0.863241911f},
-std::array<float,2>{0.750460505f, 0.431793451f},
-std::array<float,2>{0.64858973f, 0.686959624f},
-std::array<float,2>{0.472679168f, 0.186136127f},
-std::array<float,2>{0.0915648192f, 0.713173985f},
-std::array<float,2>{0.96678865f, 0.197865129f},
-std::array<float,2>{0.522524297f, 0.804082513f},
-std::array<float,2>{0.329177976f, 0.465515345f},
-std::array<float,2>{0.389370829f, 0.980905592f},
-std::array<float,2>{0.721948326f, 0.367758185f},
-std::array<float,2>{0.86618644f, 0.547818482f},
-std::array<float,2>{0.186722636f, 0.108330928f},
-std::array<float,2>{0.465627164f, 0.64324218f},
-std::array<float,2>{0.684783518f, 0.145450965f},
-std::array<float,2>{0.805749774f, 0.838768601f},
-std::array<float,2>{0.200974017f, 0.393266946f},
-std::array<float,2>{0.0131335659f, 0.901418686f},
-std::array<float,2>{0.933912694f, 0.285636574f},
-std::array<float,2>{0.584733963f, 0.578115344f},
-std::array<float,2>{0.304811925f, 0.0550679117f},
-std::array<float,2>{0.132028282f, 0.508954883f},
-std::array<float,2>{0.832484961f, 0.0655139238f},
-std::array<float,2>{0.701294601f, 0.958953798f},
-std::array<float,2>{0.406792313f, 0.324719638f},
-std::array<float,2>{0.361937642f, 0.77707988f},
-std::array<float,2>{0.532288194f, 0.471895963f},
-std::array<float,2>{0.987342656f, 0.719784379f},
-std::array<float,2>{0.105021872f, 0.246468231f},
-std::array<float,2>{0.42202577f, 0.538392007f},
-std::array<float,2>{0.704999804f, 0.123475261f},
-std::array<float,2>{0.819477141f, 0.995023608f},
-std::array<float,2>{0.14098084f, 0.345444083f},
-std::array<float,2>{0.123907678f, 0.785524189f},
-std::array<float,2>{0.96879971f, 0.448460072f},
-std::array<float,2>{0.554706633f, 0.690579116f},
-std::array<float,2>{0.353477508f, 0.211680204f},
-std::array<float,2>{0.20657222f, 0.669049025f},
-std::array<float,2>{0.784649849f, 0.158003867f},
-std::array<float,2>{0.659889519f, 0.852339387f},
-std::array<float,2>{0.448851794f, 0.412053734f},
-std::array<float,2>{0.285073668f, 0.916471243f},
-std::array<float,2>{0.573959827f, 0.274225563f},
-std::array<float,2>{0.920611024f, 0.598395109f},
-std::array<float,2>{0.0230181441f, 0.014716344f},
-std::array<float,2>{0.319208175f, 0.748916209f},
-std::array<float,2>{0.514086306f, 0.230252951f},
-std::array<float,2>{0.937635422f, 0.760593832f},
-std::array<float,2>{0.0741950125f, 0.493904263f},
-std::array<float,2>{0.161829174f, 0.94120729f},
-std::array<float,2>{0.846555293f, 0.334701061f},
-std::array<float,2>{0.740469575f, 0.523797154f},
-std::array<float,2>{0.400569379f, 0.0852469727f},
-std::array<float,2>{0.0563447513f, 0.5922153f},
-std::array<float,2>{0.882493854f, 0.0398203097f},
-std::array<float,2>{0.611394227f, 0.878229856f},
-std::array<float,2>{0.257083118f, 0.304564655f},
-std::array<float,2>{0.493186384f, 0.825360894f},
-std::array<float,2>{0.635810554f, 0.38730213f},
-std::array<float,2>{0.770417869f, 0.627593219f},
-std::array<float,2>{0.229458362f, 0.134676486f},
-std::array<float,2>{0.349021643f, 0.517593563f},
-std::array<float,2>{0.553788602f, 0.09173356f},
-std::array<float,2>{0.983722091f, 0.949392736f},
-std::array<float,2>{0.115918905f, 0.336109728f},
-std::array<float,2>{0.150328115f, 0.752000034f},
-std::array<float,2>{0.827015817f, 0.491420299f},
-std::array<float,2>{0.710960567f, 0.740282059f},
-std::array<float,2>{0.436349809f, 0.22290422f},
-std::array<float,2>{0.0253104437f, 0.639067888f},
-std::array<float,2>{0.909424126f, 0.130934224f},
-std::array<float,2>{0.569982648f, 0.819897175f},
-std::array<float,2>{0.292280048f, 0.376476169f},
-std::array<float,2>{0.442381591f, 0.885399938f},
-std::array<float,2>{0.671074808f, 0.307732791f},
-std::array<float,2>{0.790599883f, 0.579757273f},
-std::array<float,2>{0.218323514f, 0.0324443057f},
-std::array<float,2>{0.392762661f, 0.702060103f},
-std::array<float,2>{0.742975593f, 0.210490569f},
-std::array<float,2>{0.855630875f, 0.794788241f},
-std::array<float,2>{0.171604216f, 0.438114285f},
-std::array<float,2>{0.0680774823f, 0.987794399f},
-std::array<float,2>{0.950940609f, 0.351932436f},
-std::array<float,2>{0.506407559f, 0.542839766f},
-std::array<float,2>{0.322996974f, 0.113306813f},
-std::array<float,2>{0.223484278f, 0.605481923f},
-std::array<float,2>{0.775528848f, 0.00447766483f},
-std::array<float,2>{0.625364184f, 0.912625134f},
-std::array<float,2>{0.488708884f, 0.26804167f},
-std::array<float,2>{0.264345556f, 0.849687397f},
-std::array<float,2>{0.62130034f, 0.417133868f},
-std::array<float,2>{0.885787606f, 0.658038557f},
-std::array<float,2>{0.0541989356f, 0.170603722f},
-std::array<float,2>{0.482570499f, 0.568891764f},
-std::array<float,2>{0.647364557f, 0.0505814403f},
-std::array<float,2>{0.759797394f, 0.898185313f},
-std::array<float,2>{0.239625916f, 0.296043336f},
-std::array<float,2>{0.0382856056f, 0.831084847f},
-std::array<float,2>{0.8952986f, 0.401737452f},
-std::array<float,2>{0.599983573f, 0.653170049f},
-std::array<float,2>{0.273637176f, 0.154985428f},
-std::array<float,2>{0.174371734f, 0.72778064f},
-std::array<float,2>{0.8702842f, 0.235769972f},
-std::array<float,2>{0.727915764f, 0.770423412f},
-std::array<float,2>{0.381827176f, 0.477060974f},
-std::array<float,2>{0.336928487f, 0.966659307f},
-std::array<float,2>{0.528652787f, 0.314415634f},
-std::array<float,2>{0.953480005f, 0.507597804f},
-std::array<float,2>{0.08301045f, 0.0756903961f},
-std::array<float,2>{0.300677419f, 0.675414324f},
-std::array<float,2>{0.589897633f, 0.177574798f},
-std::array<float,2>{0.928272188f, 0.867745399f},
-std::array<float,2>{0.00111338228f, 0.423080981f},
-std::array<float,2>{0.188938335f, 0.936890423f},
-std::array<float,2>{0.80166322f, 0.260831714f},
-std::array<float,2>{0.679653227f, 0.622183979f},
-std::array<float,2>{0.458603233f, 0.0225282032f},
-std::array<float,2>{0.0982496738f, 0.558556437f},
-std::array<float,2>{0.993072212f, 0.0975102186f},
-std::array<float,2>{0.545090795f, 0.970104516f},
-std::array<float,2>{0.371869355f, 0.366787434f},
-std::array<float,2>{0.419151455f, 0.810470223f},
-std::array<float,2>{0.68933022f, 0.460370094f},
-std::array<float,2>{0.837099195f, 0.706126034f},
-std::array<float,2>{0.133506134f, 0.188574612f},
-std::array<float,2>{0.294152886f, 0.554062724f},
-std::array<float,2>{0.565453827f, 0.102748409f},
-std::array<float,2>{0.912014902f, 0.978107929f},
-std::array<float,2>{0.0301856343f, 0.374437302f},
-std::array<float,2>{0.213335261f, 0.798489273f},
-std::array<float,2>{0.79427433f, 0.462135345f},
-std::array<float,2>{0.667780936f, 0.716250956f},
-std::array<float,2>{0.439134002f, 0.20166418f},
-std::array<float,2>{0.111183994f, 0.681535006f},
-std::array<float,2>{0.976881981f, 0.180019572f},
-std::array<float,2>{0.550643563f, 0.865884244f},
-std::array<float,2>{0.345245987f, 0.43527621f},
-std::array<float,2>{0.430467635f, 0.928406239f},
-std::array<float,2>{0.71774894f, 0.255479217f},
-std::array<float,2>{0.821920991f, 0.611558557f},
-std::array<float,2>{0.156211495f, 0.0244656559f},
-std::array<float,2>{0.484622598f, 0.722970366f},
-std::array<float,2>{0.63177675f, 0.243069395f},
-std::array<float,2>{0.778982222f, 0.778025985f},
-std::array<float,2>{0.22089164f, 0.474692672f},
-std::array<float,2>{0.0498827472f, 0.953169465f},
-std::array<float,2>{0.887035668f, 0.323008269f},
-std::array<float,2>{0.620380461f, 0.51444906f},
-std::array<float,2>{0.260271966f, 0.0669018999f},
-std::array<float,2>{0.165594161f, 0.571531892f},
-std::array<float,2>{0.852055848f, 0.0621715635f},
-std::array<float,2>{0.747988105f, 0.905709267f},
-std::array<float,2>{0.398214638f, 0.282554954f},
-std::array<float,2>{0.325982898f, 0.840024769f},
-std::array<float,2>{0.501985431f, 0.396315187f},
-std::array<float,2>{0.948958993f, 0.645381153f},
-std::array<float,2>{0.0643860921f, 0.142769217f},
-std::array<float,2>{0.375265718f, 0.59393847f},
-std::array<float,2>{0.731074691f, 0.00887962803f},
-std::array<float,2>{0.873631835f, 0.920083106f},
-std::array<float,2>{0.178475365f, 0.27847749f},
-std::array<float,2>{0.0803505331f, 0.859286904f},
-std::array<float,2>{0.959646165f, 0.408152193f},
-std::array<float,2>{0.524026334f, 0.664374471f},
-std::array<float,2>{0.341483265f, 0.162504658f},
-std::array<float,2>{0.237571061f, 0.692182541f},
-std::array<float,2>{0.763049245f, 0.216595769f},
-std::array<float,2>{0.64339149f, 0.781570256f},
-std::array<float,2>{0.478670985f, 0.450944811f},
-std::array<float,2>{0.279356152f, 0.998764098f},
-std::array<float,2>{0.596349001f, 0.350533873f},
-std::array<float,2>{0.893699229f, 0.531308651f},
-std::array<float,2>{0.0325396508f, 0.117268898f},
-std::array<float,2>{0.370582193f, 0.63160789f},
-std::array<float,2>{0.541948199f, 0.140007645f},
-std::array<float,2>{0.999007285f, 0.82405442f},
-std::array<float,2>{0.0971432254f, 0.385082394f},
-std::array<float,2>{0.140451893f, 0.879806638f},
-std::array<float,2>{0.840584219f, 0.298166633f},
-std::array<float,2>{0.69399488f, 0.58719337f},
-std::array<float,2>{0.416522413f, 0.046112258f},
-std::array<float,2>{0.00608269358f, 0.531224072f},
-std::array<float,2>{0.925673902f, 0.0800708011f},
-std::array<float,2>{0.586328149f, 0.941686571f},
-std::array<float,2>{0.301288158f, 0.331565499f},
-std::array<float,2>{0.454095781f, 0.762455225f},
-std::array<float,2>{0.672520161f, 0.49853012f},
-std::array<float,2>{0.799427748f, 0.743000627f},
-std::array<float,2>{0.194096267f, 0.231109038f},
-std::array<float,2>{0.334863782f, 0.582042158f},
-std::array<float,2>{0.516644895f, 0.0358718038f},
-std::array<float,2>{0.961129963f, 0.887834311f},
-std::array<float,2>{0.0877195969f, 0.30914095f},
-std::array<float,2>{0.180208489f, 0.814383447f},
-std::array<float,2>{0.860341549f, 0.380635858f},
-std::array<float,2>{0.722694576f, 0.635940671f},
-std::array<float,2>{0.385658741f, 0.126734972f},
-std::array<float,2>{0.0434150398f, 0.734749794f},
-std::array<float,2>{0.903355718f, 0.220005289f},
-std::array<float,2>{0.605476379f, 0.756507933f},
-std::array<float,2>{0.270217717f, 0.488133013f},
-std::array<float,2>{0.4700692f, 0.945740819f},
-std::array<float,2>{0.655377269f, 0.339911103f},
-std::array<float,2>{0.754638076f, 0.521171093f},
-std::array<float,2>{0.247080982f, 0.0866347179f},
-std::array<float,2>{0.411126286f, 0.662172019f},
-std::array<float,2>{0.697819293f, 0.167948186f},
-std::array<float,2>{0.831224144f, 0.84697175f},
-std::array<float,2>{0.128581807f, 0.421141386f},
-std::array<float,2>{0.10877765f, 0.90739429f},
-std::array<float,2>{0.991686106f, 0.271184206f},
-std::array<float,2>{0.5388785f, 0.601598263f},
-std::array<float,2>{0.363546848f, 0.00168510748f},
-std::array<float,2>{0.198127747f, 0.545580804f},
-std::array<float,2>{0.809197962f, 0.112941772f},
-std::array<float,2>{0.67976433f, 0.989590049f},
-std::array<float,2>{0.462483495f, 0.35823667f},
-std::array<float,2>{0.309386611f, 0.78966403f},
-std::array<float,2>{0.581461251f, 0.442491561f},
-std::array<float,2>{0.932910442f, 0.697766542f},
-std::array<float,2>{0.0089717079f, 0.206517398f},
-std::array<float,2>{0.449708045f, 0.501067519f},
-std::array<float,2>{0.664006293f, 0.0721078739f},
-std::array<float,2>{0.787669063f, 0.961494207f},
-std::array<float,2>{0.208738178f, 0.317326099f},
-std::array<float,2>{0.016867334f, 0.766331613f},
-std::array<float,2>{0.915831387f, 0.482688665f},
-std::array<float,2>{0.57792443f, 0.733494818f},
-std::array<float,2>{0.287631005f, 0.239093691f},
-std::array<float,2>{0.145971641f, 0.650472164f},
-std::array<float,2>{0.814095736f, 0.151267529f},
-std::array<float,2>{0.707632244f, 0.832402706f},
-std::array<float,2>{0.428726852f, 0.402599663f},
-std::array<float,2>{0.356966257f, 0.894510567f},
-std::array<float,2>{0.561403692f, 0.291000247f},
-std::array<float,2>{0.976534843f, 0.565692902f},
-std::array<float,2>{0.118899018f, 0.0545743033f},
-std::array<float,2>{0.251415521f, 0.707281709f},
-std::array<float,2>{0.614575684f, 0.191833228f},
-std::array<float,2>{0.878856242f, 0.806597054f},
-std::array<float,2>{0.0617765673f, 0.453962207f},
-std::array<float,2>{0.231292397f, 0.975962281f},
-std::array<float,2>{0.768878698f, 0.35967502f},
-std::array<float,2>{0.639105737f, 0.559387982f},
-std::array<float,2>{0.496635437f, 0.100497365f},
-std::array<float,2>{0.0744972378f, 0.620616078f},
-std::array<float,2>{0.944033265f, 0.0194801223f},
-std::array<float,2>{0.510765016f, 0.932381153f},
-std::array<float,2>{0.313611209f, 0.265036672f},
-std::array<float,2>{0.403410494f, 0.872766733f},
-std::array<float,2>{0.734397829f, 0.426541328f},
-std::array<float,2>{0.84872371f, 0.677783132f},
-std::array<float,2>{0.159957394f, 0.17302987f},
-std::array<float,2>{0.274242222f, 0.567968249f},
-std::array<float,2>{0.600115299f, 0.0487927422f},
-std::array<float,2>{0.894874752f, 0.894715011f},
-std::array<float,2>{0.0388562009f, 0.294329435f},
-std::array<float,2>{0.239997506f, 0.828257561f},
-std::array<float,2>{0.760387003f, 0.398620963f},
-std::array<float,2>{0.646642506f, 0.655485392f},
-std::array<float,2>{0.483248949f, 0.152762562f},
-std::array<float,2>{0.0835386515f, 0.730438471f},
-std::array<float,2>{0.953941464f, 0.237954617f},
-std::array<float,2>{0.529002428f, 0.771497846f},
-std::array<float,2>{0.337532729f, 0.480428696f},
-std::array<float,2>{0.381238908f, 0.968331873f},
-std::array<float,2>{0.728348434f, 0.315261006f},
-std::array<float,2>{0.870759428f, 0.505235791f},
-std::array<float,2>{0.174203455f, 0.07649488f},
-std::array<float,2>{0.458240241f, 0.673598826f},
-std::array<float,2>{0.678975463f, 0.179675594f},
-std::array<float,2>{0.800900996f, 0.870034397f},
-std::array<float,2>{0.189266369f, 0.42435658f},
-std::array<float,2>{0.00174638699f, 0.934796154f},
-std::array<float,2>{0.927857876f, 0.258106083f},
-std::array<float,2>{0.590457916f, 0.624904156f},
-std::array<float,2>{0.29997918f, 0.0211604498f},
-std::array<float,2>{0.132949278f, 0.556628585f},
-std::array<float,2>{0.837556183f, 0.0950909927f},
-std::array<float,2>{0.688556731f, 0.972172439f},
-std::array<float,2>{0.419810325f, 0.364549369f},
-std::array<float,2>{0.37157768f, 0.810907423f},
-std::array<float,2>{0.545537055f, 0.458152145f},
-std::array<float,2>{0.992552936f, 0.704842567f},
-std::array<float,2>{0.0979698971f, 0.189663976f},
-std::array<float,2>{0.43569538f, 0.516856611f},
-std::array<float,2>{0.711531878f, 0.0919986516f},
-std::array<float,2>{0.826442242f, 0.952810824f},
-std::array<float,2>{0.149694741f, 0.338718861f},
-std::array<float,2>{0.115336582f, 0.751269221f},
-std::array<float,2>{0.984345019f, 0.489035398f},
-std::array<float,2>{0.554218531f, 0.739334583f},
-std::array<float,2>{0.349268287f, 0.225272939f},
-std::array<float,2>{0.218061507f, 0.637366176f},
-std::array<float,2>{0.790213585f, 0.13034299f},
-std::array<float,2>{0.671639621f, 0.817648888f},
-std::array<float,2>{0.441842139f, 0.377770424f},
-std::array<float,2>{0.2926642f, 0.884469151f},
-std::array<float,2>{0.569424391f, 0.305498302f},
-std::array<float,2>{0.910041988f, 0.581733584f},
-std::array<float,2>{0.0246104989f, 0.0350027233f},
-std::array<float,2>{0.322540015f, 0.699597001f},
-std::array<float,2>{0.505967915f, 0.208962262f},
-std::array<float,2>{0.950607717f, 0.795189738f},
-std::array<float,2>{0.0678563789f, 0.441127688f},
-std::array<float,2>{0.171193153f, 0.985342264f},
-std::array<float,2>{0.856382072f, 0.354864925f},
-std::array<float,2>{0.74253732f, 0.539503515f},
-std::array<float,2>{0.393420368f, 0.115753233f},
-std::array<float,2>{0.0546841919f, 0.607846618f},
-std::array<float,2>{0.886582911f, 0.00677872123f},
-std::array<float,2>{0.621824205f, 0.910560548f},
-std::array<float,2>{0.264125645f, 0.267561555f},
-std::array<float,2>{0.488821238f, 0.848388076f},
-std::array<float,2>{0.625717998f, 0.415504187f},
-std::array<float,2>{0.776194334f, 0.660108685f},
-std::array<float,2>{0.22310403f, 0.168179125f},
-std::array<float,2>{0.352912366f, 0.535466909f},
-std::array<float,2>{0.555630922f, 0.121774942f},
-std::array<float,2>{0.969553113f, 0.992384315f},
-std::array<float,2>{0.123291276f, 0.346867681f},
-std::array<float,2>{0.141193554f, 0.787887096f},
-std::array<float,2>{0.819849133f, 0.446881324f},
-std::array<float,2>{0.704392672f, 0.687651277f},
-std::array<float,2>{0.422711402f, 0.213984817f},
-std::array<float,2>{0.0228565037f, 0.671833098f},
-std::array<float,2>{0.920082629f, 0.158305019f},
-std::array<float,2>{0.573628783f, 0.853592575f},
-std::array<float,2>{0.284339786f, 0.41289565f},
-std::array<float,2>{0.448384672f, 0.914581478f},
-std::array<float,2>{0.659546018f, 0.276813239f},
-std::array<float,2>{0.785050035f, 0.600449979f},
-std::array<float,2>{0.206278339f, 0.0123396246f},
-std::array<float,2>{0.401228487f, 0.746191323f},
-std::array<float,2>{0.74117589f, 0.228348151f},
-std::array<float,2>{0.846063316f, 0.758253157f},
-std::array<float,2>{0.161429629f, 0.494657099f},
-std::array<float,2>{0.0736091435f, 0.937938333f},
-std::array<float,2>{0.938034952f, 0.333328009f},
-std::array<float,2>{0.514412105f, 0.526683211f},
-std::array<float,2>{0.318435699f, 0.0834257528f},
-std::array<float,2>{0.228808373f, 0.591289937f},
-std::array<float,2>{0.769711375f, 0.0424888134f},
-std::array<float,2>{0.636620104f, 0.875685692f},
-std::array<float,2>{0.493822277f, 0.301287293f},
-std::array<float,2>{0.257631779f, 0.82628119f},
-std::array<float,2>{0.611836731f, 0.389759511f},
-std::array<float,2>{0.881978214f, 0.626500487f},
-std::array<float,2>{0.056007795f, 0.135912612f},
-std::array<float,2>{0.473532468f, 0.616185427f},
-std::array<float,2>{0.649011374f, 0.0300103929f},
-std::array<float,2>{0.750970662f, 0.924706519f},
-std::array<float,2>{0.245038241f, 0.25092414f},
-std::array<float,2>{0.0419824831f, 0.860681117f},
-std::array<float,2>{0.901126385f, 0.429758042f},
-std::array<float,2>{0.603655577f, 0.685428798f},
-std::array<float,2>{0.26570192f, 0.185138896f},
-std::array<float,2>{0.187029287f, 0.712622643f},
-std::array<float,2>{0.865280569f, 0.196070164f},
-std::array<float,2>{0.722204328f, 0.801991105f},
-std::array<float,2>{0.388719738f, 0.466828823f},
-std::array<float,2>{0.329940528f, 0.98293972f},
-std::array<float,2>{0.523199797f, 0.369725406f},
-std::array<float,2>{0.966228485f, 0.550052643f},
-std::array<float,2>{0.0911099836f, 0.107344881f},
-std::array<float,2>{0.305437386f, 0.641140044f},
-std::array<float,2>{0.584447801f, 0.147755325f},
-std::array<float,2>{0.934431314f, 0.837729156f},
-std::array<float,2>{0.0133951288f, 0.391950786f},
-std::array<float,2>{0.200622827f, 0.899226367f},
-std::array<float,2>{0.806221187f, 0.288657516f},
-std::array<float,2>{0.685277343f, 0.575452089f},
-std::array<float,2>{0.465317011f, 0.0578709841f},
-std::array<float,2>{0.104852639f, 0.51017189f},
-std::array<float,2>{0.988155663f, 0.0631825775f},
-std::array<float,2>{0.532728851f, 0.958988845f},
-std::array<float,2>{0.361583203f, 0.327223182f},
-std::array<float,2>{0.406727403f, 0.775077879f},
-std::array<float,2>{0.701963902f, 0.470284909f},
-std::array<float,2>{0.832987249f, 0.720898509f},
-std::array<float,2>{0.132529974f, 0.249412403f},
-std::array<float,2>{0.287485272f, 0.502979994f},
-std::array<float,2>{0.577335656f, 0.0734564513f},
-std::array<float,2>{0.915160775f, 0.964731097f},
-std::array<float,2>{0.0172173698f, 0.318989009f},
-std::array<float,2>{0.208282247f, 0.767803431f},
-std::array<float,2>{0.787243426f, 0.481694937f},
-std::array<float,2>{0.663378358f, 0.731743574f},
-std::array<float,2>{0.449491858f, 0.242163822f},
-std::array<float,2>{0.11831937f, 0.649465322f},
-std::array<float,2>{0.976066768f, 0.150017202f},
-std::array<float,2>{0.560853422f, 0.83416456f},
-std::array<float,2>{0.356620163f, 0.404444695f},
-std::array<float,2>{0.429251701f, 0.892341614f},
-std::array<float,2>{0.707276285f, 0.291712403f},
-std::array<float,2>{0.813518405f, 0.562970817f},
-std::array<float,2>{0.146331951f, 0.0517780073f},
-std::array<float,2>{0.496369779f, 0.709783852f},
-std::array<float,2>{0.639291584f, 0.194193706f},
-std::array<float,2>{0.769530356f, 0.806684256f},
-std::array<float,2>{0.23091349f, 0.456146985f},
-std::array<float,2>{0.062178988f, 0.974049687f},
-std::array<float,2>{0.878132701f, 0.362276793f},
-std::array<float,2>{0.61487478f, 0.562383235f},
-std::array<float,2>{0.251842648f, 0.0979312509f},
-std::array<float,2>{0.159216434f, 0.617590785f},
-std::array<float,2>{0.849415004f, 0.0164378956f},
-std::array<float,2>{0.735122502f, 0.930601358f},
-std::array<float,2>{0.404125005f, 0.262647897f},
-std::array<float,2>{0.314152747f, 0.874561429f},
-std::array<float,2>{0.511233151f, 0.428368598f},
-std::array<float,2>{0.943712831f, 0.676344812f},
-std::array<float,2>{0.0748597458f, 0.175413415f},
-std::array<float,2>{0.384837747f, 0.585372269f},
-std::array<float,2>{0.723432064f, 0.0376302041f},
-std::array<float,2>{0.8595348f, 0.888787925f},
-std::array<float,2>{0.179806694f, 0.310640126f},
-std::array<float,2>{0.0869948715f, 0.814813316f},
-std::array<float,2>{0.961510897f, 0.381094366f},
-std::array<float,2>{0.517307281f, 0.634369075f},
-std::array<float,2>{0.334110916f, 0.127100006f},
-std::array<float,2>{0.247995988f, 0.736722589f},
-std::array<float,2>{0.754213214f, 0.221574903f},
-std::array<float,2>{0.656110168f, 0.755350709f},
-std::array<float,2>{0.470503271f, 0.485877395f},
-std::array<float,2>{0.269877464f, 0.947834074f},
-std::array<float,2>{0.606182039f, 0.34373647f},
-std::array<float,2>{0.903999269f, 0.523137152f},
-std::array<float,2>{0.0437852368f, 0.0889096037f},
-std::array<float,2>{0.364021897f, 0.660456777f},
-std::array<float,2>{0.538213253f, 0.164225861f},
-std::array<float,2>{0.991985857f, 0.845570266f},
-std::array<float,2>{0.109358646f, 0.41984877f},
-std::array<float,2>{0.128219232f, 0.9090873f},
-std::array<float,2>{0.83202219f, 0.273008466f},
-std::array<float,2>{0.697628975f, 0.605166912f},
-std::array<float,2>{0.41042313f, 0.00342213549f},
-std::array<float,2>{0.00956705865f, 0.544446051f},
-std::array<float,2>{0.933226764f, 0.110931508f},
-std::array<float,2>{0.581892252f, 0.990483463f},
-std::array<float,2>{0.309077948f, 0.355934262f},
-std::array<float,2>{0.462123275f, 0.79145062f},
-std::array<float,2>{0.680211604f, 0.444354594f},
-std::array<float,2>{0.808994114f, 0.695507586f},
-std::array<float,2>{0.197524071f, 0.203596503f},
-std::array<float,2>{0.340864927f, 0.596250653f},
-std::array<float,2>{0.523470104f, 0.0114683071f},
-std::array<float,2>{0.959133029f, 0.919918716f},
-std::array<float,2>{0.0807314441f, 0.280777335f},
-std::array<float,2>{0.178154498f, 0.856751025f},
-std::array<float,2>{0.873346925f, 0.409142226f},
-std::array<float,2>{0.73080653f, 0.667128086f},
-std::array<float,2>{0.375961661f, 0.161189273f},
-std::array<float,2>{0.0330203362f, 0.694047689f},
-std::array<float,2>{0.894449115f, 0.216894865f},
-std::array<float,2>{0.595863938f, 0.783906937f},
-std::array<float,2>{0.280094206f, 0.452958316f},
-std::array<float,2>{0.47925958f, 0.996243477f},
-std::array<float,2>{0.642689764f, 0.347813219f},
-std::array<float,2>{0.763192654f, 0.534113884f},
-std::array<float,2>{0.237902373f, 0.119451515f},
-std::array<float,2>{0.416393608f, 0.62927866f},
-std::array<float,2>{0.693607152f, 0.138446391f},
-std::array<float,2>{0.839915454f, 0.820756495f},
-std::array<float,2>{0.139969498f, 0.384708822f},
-std::array<float,2>{0.0971730128f, 0.881019294f},
-std::array<float,2>{0.998108506f, 0.300259352f},
-std::array<float,2>{0.541472018f, 0.589595735f},
-std::array<float,2>{0.371027499f, 0.0447516292f},
-std::array<float,2>{0.193711713f, 0.528045177f},
-std::array<float,2>{0.799259126f, 0.0807036683f},
-std::array<float,2>{0.672105491f, 0.943774641f},
-std::array<float,2>{0.453285575f, 0.329224646f},
-std::array<float,2>{0.301208556f, 0.763672113f},
-std::array<float,2>{0.586751163f, 0.497693747f},
-std::array<float,2>{0.925141335f, 0.745117545f},
-std::array<float,2>{0.00636375556f, 0.232832685f},
-std::array<float,2>{0.438854545f, 0.552078843f},
-std::array<float,2>{0.667443514f, 0.104946576f},
-std::array<float,2>{0.794712126f, 0.978553414f},
-std::array<float,2>{0.213477835f, 0.371368974f},
-std::array<float,2>{0.029520629f, 0.800230086f},
-std::array<float,2>{0.911502957f, 0.463618219f},
-std::array<float,2>{0.566157818f, 0.717607617f},
-std::array<float,2>{0.294445813f, 0.200630173f},
-std::array<float,2>{0.155725226f, 0.681988299f},
-std::array<float,2>{0.821737349f, 0.182564139f},
-std::array<float,2>{0.717041254f, 0.86452198f},
-std::array<float,2>{0.429750979f, 0.435631514f},
-std::array<float,2>{0.345090508f, 0.926259875f},
-std::array<float,2>{0.549956322f, 0.257688314f},
-std::array<float,2>{0.977364063f, 0.609911501f},
-std::array<float,2>{0.110538013f, 0.026528215f},
-std::array<float,2>{0.260230809f, 0.725119174f},
-std::array<float,2>{0.621020794f, 0.245216832f},
-std::array<float,2>{0.887252271f, 0.781210899f},
-std::array<float,2>{0.050370656f, 0.473392308f},
-std::array<float,2>{0.221599296f, 0.95628041f},
-std::array<float,2>{0.778600752f, 0.322073251f},
-std::array<float,2>{0.631240845f, 0.512493134f},
-std::array<float,2>{0.484913647f, 0.0688261241f},
-std::array<float,2>{0.0638416782f, 0.573463202f},
-std::array<float,2>{0.948400736f, 0.058833532f},
-std::array<float,2>{0.502683043f, 0.903885365f},
-std::array<float,2>{0.325616181f, 0.283497781f},
-std::array<float,2>{0.397483736f, 0.842324793f},
-std::array<float,2>{0.747252643f, 0.397898436f},
-std::array<float,2>{0.851732612f, 0.647578657f},
-std::array<float,2>{0.165447727f, 0.141240552f},
-std::array<float,2>{0.297917098f, 0.622676134f},
-std::array<float,2>{0.592508018f, 0.023258321f},
-std::array<float,2>{0.9272241f, 0.9374879f},
-std::array<float,2>{0.00256717182f, 0.261604756f},
-std::array<float,2>{0.189605489f, 0.867231131f},
-std::array<float,2>{0.804554582f, 0.423653811f},
-std::array<float,2>{0.676073253f, 0.675130785f},
-std::array<float,2>{0.459096104f, 0.176936656f},
-std::array<float,2>{0.100432515f, 0.706859231f},
-std::array<float,2>{0.994226098f, 0.189276084f},
-std::array<float,2>{0.544305086f, 0.809724867f},
-std::array<float,2>{0.373668134f, 0.460665971f},
-std::array<float,2>{0.421374112f, 0.970408797f},
-std::array<float,2>{0.69050175f, 0.366487622f},
-std::array<float,2>{0.839549422f, 0.55809921f},
-std::array<float,2>{0.135562703f, 0.0970113352f},
-std::array<float,2>{0.48212713f, 0.652545452f},
-std::array<float,2>{0.645966768f, 0.154390499f},
-std::array<float,2>{0.757978261f, 0.831556737f},
-std::array<float,2>{0.241493732f, 0.402242601f},
-std::array<float,2>{0.0352429636f, 0.897687674f},
-std::array<float,2>{0.898131073f, 0.296422899f},
-std::array<float,2>{0.599303842f, 0.568424344f},
-std::array<float,2>{0.277261406f, 0.0498055704f},
-std::array<float,2>{0.173755482f, 0.507288337f},
-std::array<float,2>{0.867877066f, 0.0754704997f},
-std::array<float,2>{0.728656232f, 0.96623373f},
-std::array<float,2>{0.379652768f, 0.313947767f},
-std::array<float,2>{0.338822901f, 0.769564509f},
-std::array<float,2>{0.529560387f, 0.476626664f},
-std::array<float,2>{0.95654881f, 0.728207588f},
-std::array<float,2>{0.0847897083f, 0.235984191f},
-std::array<float,2>{0.392101377f, 0.542256176f},
-std::array<float,2>{0.744267642f, 0.113877341f},
-std::array<float,2>{0.858676255f, 0.987637877f},
-std::array<float,2>{0.168264583f, 0.352429748f},
-std::array<float,2>{0.0687133223f, 0.794169962f},
-std::array<float,2>{0.952575505f, 0.437530488f},
-std::array<float,2>{0.504411101f, 0.701363385f},
-std::array<float,2>{0.322129309f, 0.21037294f},
-std::array<float,2>{0.225323796f, 0.65762645f},
-std::array<float,2>{0.773715258f, 0.170259833f},
-std::array<float,2>{0.627174854f, 0.85057354f},
-std::array<float,2>{0.492124826f, 0.417905152f},
-std::array<float,2>{0.262035608f, 0.912454545f},
-std::array<float,2>{0.624532163f, 0.268342823f},
-std::array<float,2>{0.884728253f, 0.606060565f},
-std::array<float,2>{0.0509628356f, 0.00392195024f},
-std::array<float,2>{0.350208938f, 0.741018593f},
-std::array<float,2>{0.551926136f, 0.223345563f},
-std::array<float,2>{0.980873466f, 0.752714336f},
-std::array<float,2>{0.113424905f, 0.491887808f},
-std::array<float,2>{0.15216732f, 0.950011849f},
-std::array<float,2>{0.826105893f, 0.336473495f},
-std::array<float,2>{0.71297282f, 0.518382668f},
-std::array<float,2>{0.434468776f, 0.0908820108f},
-std::array<float,2>{0.0260368455f, 0.579213977f},
-std::array<float,2>{0.906378269f, 0.0330644548f},
-std::array<float,2>{0.567525327f, 0.88488394f},
-std::array<float,2>{0.289651841f, 0.30822295f},
-std::array<float,2>{0.443382144f, 0.819584966f},
-std::array<float,2>{0.668187082f, 0.376340091f},
-std::array<float,2>{0.792935669f, 0.639352441f},
-std::array<float,2>{0.21631436f, 0.131704822f},
-std::array<float,2>{0.31670329f, 0.52415067f},
-std::array<float,2>{0.512455106f, 0.0858679265f},
-std::array<float,2>{0.941157579f, 0.94071722f},
-std::array<float,2>{0.0707386807f, 0.334356546f},
-std::array<float,2>{0.1629702f, 0.760165572f},
-std::array<float,2>{0.845176041f, 0.49362883f},
-std::array<float,2>{0.738635898f, 0.748529732f},
-std::array<float,2>{0.400093943f, 0.229824126f},
-std::array<float,2>{0.0578457192f, 0.62714833f},
-std::array<float,2>{0.879215121f, 0.133978426f},
-std::array<float,2>{0.61083442f, 0.825720906f},
-std::array<float,2>{0.255786479f, 0.386731714f},
-std::array<float,2>{0.495103836f, 0.878456831f},
-std::array<float,2>{0.633526206f, 0.304049373f},
-std::array<float,2>{0.77230078f, 0.592772722f},
-std::array<float,2>{0.227308214f, 0.0393396914f},
-std::array<float,2>{0.423932344f, 0.691016436f},
-std::array<float,2>{0.706145346f, 0.211394057f},
-std::array<float,2>{0.817632616f, 0.786046028f},
-std::array<float,2>{0.143644914f, 0.448900938f},
-std::array<float,2>{0.12222185f, 0.994183183f},
-std::array<float,2>{0.97178489f, 0.345210195f},
-std::array<float,2>{0.557457745f, 0.538962245f},
-std::array<float,2>{0.355370522f, 0.123659365f},
-std::array<float,2>{0.204192415f, 0.597837925f},
-std::array<float,2>{0.783002913f, 0.0151482411f},
-std::array<float,2>{0.657896101f, 0.916978538f},
-std::array<float,2>{0.445502698f, 0.273764253f},
-std::array<float,2>{0.281690836f, 0.851683855f},
-std::array<float,2>{0.570350647f, 0.41128993f},
-std::array<float,2>{0.919588566f, 0.669689059f},
-std::array<float,2>{0.0211835355f, 0.157488719f},
-std::array<float,2>{0.468099385f, 0.577450335f},
-std::array<float,2>{0.686632037f, 0.0555093624f},
-std::array<float,2>{0.808442116f, 0.90224576f},
-std::array<float,2>{0.203100815f, 0.285865873f},
-std::array<float,2>{0.0154311778f, 0.838191211f},
-std::array<float,2>{0.935655534f, 0.392996788f},
-std::array<float,2>{0.583390355f, 0.642834961f},
-std::array<float,2>{0.30718413f, 0.14492178f},
-std::array<float,2>{0.130382687f, 0.720451295f},
-std::array<float,2>{0.834218383f, 0.246678159f},
-std::array<float,2>{0.700324833f, 0.776631474f},
-std::array<float,2>{0.408314645f, 0.472607166f},
-std::array<float,2>{0.360412747f, 0.958482146f},
-std::array<float,2>{0.533782482f, 0.324378699f},
-std::array<float,2>{0.984827399f, 0.509343147f},
-std::array<float,2>{0.102142833f, 0.0661174953f},
-std::array<float,2>{0.268793017f, 0.687103629f},
-std::array<float,2>{0.601641178f, 0.185769662f},
-std::array<float,2>{0.899975061f, 0.862511456f},
-std::array<float,2>{0.0397792496f, 0.432203531f},
-std::array<float,2>{0.24297753f, 0.92206496f},
-std::array<float,2>{0.753234625f, 0.252917796f},
-std::array<float,2>{0.650452077f, 0.613847077f},
-std::array<float,2>{0.475049406f, 0.0278516803f},
-std::array<float,2>{0.0934014916f, 0.547256172f},
-std::array<float,2>{0.96707058f, 0.107777275f},
-std::array<float,2>{0.521391809f, 0.980984211f},
-std::array<float,2>{0.331888735f, 0.367425978f},
-std::array<float,2>{0.387823522f, 0.804266334f},
-std::array<float,2>{0.718900025f, 0.464992732f},
-std::array<float,2>{0.865062714f, 0.713613391f},
-std::array<float,2>{0.184636638f, 0.197315812f},
-std::array<float,2>{0.253507704f, 0.55874604f},
-std::array<float,2>{0.615270436f, 0.0998740792f},
-std::array<float,2>{0.876520813f, 0.976195872f},
-std::array<float,2>{0.0604519472f, 0.360189199f},
-std::array<float,2>{0.23379761f, 0.806088567f},
-std::array<float,2>{0.765790284f, 0.453601331f},
-std::array<float,2>{0.637896001f, 0.707722545f},
-std::array<float,2>{0.499886602f, 0.192054883f},
-std::array<float,2>{0.0766033307f, 0.678247809f},
-std::array<float,2>{0.942777097f, 0.173794165f},
-std::array<float,2>{0.508880496f, 0.872344613f},
-std::array<float,2>{0.315596104f, 0.42621097f},
-std::array<float,2>{0.4062033f, 0.931887031f},
-std::array<float,2>{0.73742801f, 0.265206128f},
-std::array<float,2>{0.85076791f, 0.620418429f},
-std::array<float,2>{0.157644197f, 0.0187099334f},
-std::array<float,2>{0.452521414f, 0.734097838f},
-std::array<float,2>{0.660318911f, 0.238652512f},
-std::array<float,2>{0.785996974f, 0.765989542f},
-std::array<float,2>{0.209139466f, 0.483391225f},
-std::array<float,2>{0.0182181355f, 0.961197913f},
-std::array<float,2>{0.916081727f, 0.316411197f},
-std::array<float,2>{0.575186014f, 0.501797795f},
-std::array<float,2>{0.286250472f, 0.0713184923f},
-std::array<float,2>{0.14673236f, 0.566236317f},
-std::array<float,2>{0.814510882f, 0.0541548878f},
-std::array<float,2>{0.709432304f, 0.893778086f},
-std::array<float,2>{0.427473277f, 0.290094763f},
-std::array<float,2>{0.358501643f, 0.83254081f},
-std::array<float,2>{0.559643328f, 0.403168797f},
-std::array<float,2>{0.972809017f, 0.650937378f},
-std::array<float,2>{0.121026278f, 0.150645331f},
-std::array<float,2>{0.412236363f, 0.602068245f},
-std::array<float,2>{0.695379436f, 0.00130190526f},
-std::array<float,2>{0.82960999f, 0.907751441f},
-std::array<float,2>{0.125955671f, 0.27071023f},
-std::array<float,2>{0.106588714f, 0.847203612f},
-std::array<float,2>{0.990232229f, 0.421468645f},
-std::array<float,2>{0.536791682f, 0.662668884f},
-std::array<float,2>{0.367058009f, 0.167146116f},
-std::array<float,2>{0.19664076f, 0.697752655f},
-std::array<float,2>{0.811980963f, 0.20702821f},
-std::array<float,2>{0.682674766f, 0.789120853f},
-std::array<float,2>{0.463911831f, 0.443200469f},
-std::array<float,2>{0.312472999f, 0.990085602f},
-std::array<float,2>{0.578904092f, 0.357573569f},
-std::array<float,2>{0.931046128f, 0.54518652f},
-std::array<float,2>{0.0115000643f, 0.112656027f},
-std::array<float,2>{0.332277596f, 0.636599422f},
-std::array<float,2>{0.517620385f, 0.126412675f},
-std::array<float,2>{0.963487208f, 0.813847482f},
-std::array<float,2>{0.088438727f, 0.380292714f},
-std::array<float,2>{0.182495728f, 0.888404906f},
-std::array<float,2>{0.862380445f, 0.309000075f},
-std::array<float,2>{0.724828899f, 0.582953393f},
-std::array<float,2>{0.384141326f, 0.035377983f},
-std::array<float,2>{0.0460687578f, 0.520619214f},
-std::array<float,2>{0.905230522f, 0.0859943032f},
-std::array<float,2>{0.60876298f, 0.945825517f},
-std::array<float,2>{0.271691471f, 0.340335965f},
-std::array<float,2>{0.472337157f, 0.756214321f},
-std::array<float,2>{0.654155076f, 0.487685859f},
-std::array<float,2>{0.755938172f, 0.735226214f},
-std::array<float,2>{0.2483152f, 0.220591679f},
-std::array<float,2>{0.367347181f, 0.587637305f},
-std::array<float,2>{0.539210856f, 0.0468534455f},
-std::array<float,2>{0.997126698f, 0.879256964f},
-std::array<float,2>{0.0946722403f, 0.298422992f},
-std::array<float,2>{0.138430297f, 0.823643148f},
-std::array<float,2>{0.842709601f, 0.385552853f},
-std::array<float,2>{0.692207575f, 0.631236434f},
-std::array<float,2>{0.414487481f, 0.140512496f},
-std::array<float,2>{0.00451192865f, 0.74263525f},
-std::array<float,2>{0.922235012f, 0.23068957f},
-std::array<float,2>{0.588603616f, 0.761950195f},
-std::array<float,2>{0.304180026f, 0.498737752f},
-std::array<float,2>{0.456351787f, 0.942286849f},
-std::array<float,2>{0.674870253f, 0.331269145f},
-std::array<float,2>{0.798486888f, 0.530757248f},
-std::array<float,2>{0.19250223f, 0.0795401931f},
-std::array<float,2>{0.378476083f, 0.664623678f},
-std::array<float,2>{0.733274281f, 0.163019747f},
-std::array<float,2>{0.871915519f, 0.858826101f},
-std::array<float,2>{0.17578207f, 0.407355428f},
-std::array<float,2>{0.0800178126f, 0.920410752f},
-std::array<float,2>{0.958566308f, 0.278976083f},
-std::array<float,2>{0.525720119f, 0.594723582f},
-std::array<float,2>{0.343169004f, 0.00930056162f},
-std::array<float,2>{0.235128373f, 0.531923652f},
-std::array<float,2>{0.763944983f, 0.118126988f},
-std::array<float,2>{0.640730739f, 0.998269081f},
-std::array<float,2>{0.47819984f, 0.34973973f},
-std::array<float,2>{0.278081268f, 0.781840503f},
-std::array<float,2>{0.594093561f, 0.450295299f},
-std::array<float,2>{0.891164601f, 0.691727519f},
-std::array<float,2>{0.0350469127f, 0.21596323f},
-std::array<float,2>{0.486822218f, 0.513784885f},
-std::array<float,2>{0.630184293f, 0.066492565f},
-std::array<float,2>{0.780550718f, 0.954069138f},
-std::array<float,2>{0.21905525f, 0.322428972f},
-std::array<float,2>{0.0482681096f, 0.777626991f},
-std::array<float,2>{0.889384806f, 0.475134134f},
-std::array<float,2>{0.619057059f, 0.723160446f},
-std::array<float,2>{0.259155661f, 0.242253333f},
-std::array<float,2>{0.16772981f, 0.644919634f},
-std::array<float,2>{0.853569448f, 0.14340046f},
-std::array<float,2>{0.748912156f, 0.840462685f},
-std::array<float,2>{0.395309716f, 0.395731837f},
-std::array<float,2>{0.327866703f, 0.905805767f},
-std::array<float,2>{0.501610398f, 0.282870322f},
-std::array<float,2>{0.946243644f, 0.571892202f},
-std::array<float,2>{0.0659165084f, 0.061798729f},
-std::array<float,2>{0.296748966f, 0.716390848f},
-std::array<float,2>{0.563004673f, 0.201585785f},
-std::array<float,2>{0.913303435f, 0.798117936f},
-std::array<float,2>{0.0277178306f, 0.462665588f},
-std::array<float,2>{0.212064534f, 0.977756023f},
-std::array<float,2>{0.795863271f, 0.374903411f},
-std::array<float,2>{0.665712833f, 0.554277897f},
-std::array<float,2>{0.439632475f, 0.103505105f},
-std::array<float,2>{0.112595946f, 0.611845434f},
-std::array<float,2>{0.97977978f, 0.0253748689f},
-std::array<float,2>{0.548340976f, 0.928017437f},
-std::array<float,2>{0.346840858f, 0.255118191f},
-std::array<float,2>{0.432772607f, 0.865587056f},
-std::array<float,2>{0.7162925f, 0.434589058f},
-std::array<float,2>{0.824064791f, 0.68069762f},
-std::array<float,2>{0.153720707f, 0.18040584f},
-std::array<float,2>{0.291008115f, 0.580860317f},
-std::array<float,2>{0.566870809f, 0.0337606035f},
-std::array<float,2>{0.907928824f, 0.883250535f},
-std::array<float,2>{0.0269694701f, 0.306563318f},
-std::array<float,2>{0.215186104f, 0.816650569f},
-std::array<float,2>{0.791965902f, 0.378901124f},
-std::array<float,2>{0.669860601f, 0.638120055f},
-std::array<float,2>{0.444449723f, 0.129102767f},
-std::array<float,2>{0.114718013f, 0.738697588f},
-std::array<float,2>{0.98221314f, 0.225600839f},
-std::array<float,2>{0.550919771f, 0.750835776f},
-std::array<float,2>{0.350692391f, 0.489576638f},
-std::array<float,2>{0.435329914f, 0.951398909f},
-std::array<float,2>{0.714553237f, 0.339658737f},
-std::array<float,2>{0.824245393f, 0.516332626f},
-std::array<float,2>{0.150589049f, 0.0929949656f},
-std::array<float,2>{0.490938902f, 0.658833563f},
-std::array<float,2>{0.628180325f, 0.169815093f},
-std::array<float,2>{0.774912298f, 0.849147081f},
-std::array<float,2>{0.225812539f, 0.414821535f},
-std::array<float,2>{0.0517868437f, 0.911229014f},
-std::array<float,2>{0.883012056f, 0.266189128f},
-std::array<float,2>{0.623553634f, 0.608908832f},
-std::array<float,2>{0.262954533f, 0.00698390463f},
-std::array<float,2>{0.169883743f, 0.540510952f},
-std::array<float,2>{0.858173728f, 0.116302557f},
-std::array<float,2>{0.745656192f, 0.985586464f},
-std::array<float,2>{0.391088128f, 0.35357213f},
-std::array<float,2>{0.321076363f, 0.796273887f},
-std::array<float,2>{0.504905045f, 0.439693898f},
-std::array<float,2>{0.951214015f, 0.700906456f},
-std::array<float,2>{0.0702568963f, 0.207182765f},
-std::array<float,2>{0.379991144f, 0.504259765f},
-std::array<float,2>{0.729893208f, 0.0773098245f},
-std::array<float,2>{0.868571639f, 0.967005908f},
-std::array<float,2>{0.172214627f, 0.315891266f},
-std::array<float,2>{0.0850828141f, 0.77276808f},
-std::array<float,2>{0.955830634f, 0.478631228f},
-std::array<float,2>{0.530675411f, 0.728925526f},
-std::array<float,2>{0.339607269f, 0.237188041f},
-std::array<float,2>{0.240461498f, 0.654868841f},
-std::array<float,2>{0.758931756f, 0.154284582f},
-std::array<float,2>{0.645174503f, 0.829994023f},
-std::array<float,2>{0.48066321f, 0.399944037f},
-std::array<float,2>{0.275587082f, 0.896273255f},
-std::array<float,2>{0.598279238f, 0.293808758f},
-std::array<float,2>{0.896505177f, 0.566883624f},
-std::array<float,2>{0.0367210433f, 0.0472624116f},
-std::array<float,2>{0.374635547f, 0.703384936f},
-std::array<float,2>{0.543897033f, 0.191146195f},
-std::array<float,2>{0.995892406f, 0.81233561f},
-std::array<float,2>{0.100937746f, 0.457416415f},
-std::array<float,2>{0.136644304f, 0.97139138f},
-std::array<float,2>{0.838704348f, 0.363947928f},
-std::array<float,2>{0.689690113f, 0.554962993f},
-std::array<float,2>{0.420826703f, 0.0942263082f},
-std::array<float,2>{0.0030989293f, 0.623460174f},
-std::array<float,2>{0.926648915f, 0.0197836552f},
-std::array<float,2>{0.593664348f, 0.933783352f},
-std::array<float,2>{0.297588706f, 0.259711653f},
-std::array<float,2>{0.460468441f, 0.870380461f},
-std::array<float,2>{0.677017748f, 0.424815774f},
-std::array<float,2>{0.803367496f, 0.672042131f},
-std::array<float,2>{0.190833107f, 0.1777637f},
-std::array<float,2>{0.3307181f, 0.549026072f},
-std::array<float,2>{0.519721806f, 0.10577815f},
-std::array<float,2>{0.968631625f, 0.983859479f},
-std::array<float,2>{0.0922155902f, 0.370375007f},
-std::array<float,2>{0.184569806f, 0.801756442f},
-std::array<float,2>{0.863461912f, 0.467993379f},
-std::array<float,2>{0.719880819f, 0.711306572f},
-std::array<float,2>{0.387523711f, 0.196819544f},
-std::array<float,2>{0.0405648574f, 0.684410632f},
-std::array<float,2>{0.899231791f, 0.18380487f},
-std::array<float,2>{0.602744818f, 0.859652281f},
-std::array<float,2>{0.268017948f, 0.431109011f},
-std::array<float,2>{0.475693434f, 0.925020754f},
-std::array<float,2>{0.652329922f, 0.250991583f},
-std::array<float,2>{0.752156794f, 0.616291463f},
-std::array<float,2>{0.243327945f, 0.030873863f},
-std::array<float,2>{0.40954569f, 0.7224406f},
-std::array<float,2>{0.699302912f, 0.248136446f},
-std::array<float,2>{0.835855484f, 0.773444116f},
-std::array<float,2>{0.129824817f, 0.469572991f},
-std::array<float,2>{0.103224389f, 0.960092843f},
-std::array<float,2>{0.985527337f, 0.326256245f},
-std::array<float,2>{0.534440935f, 0.511696041f},
-std::array<float,2>{0.360268444f, 0.0641372055f},
-std::array<float,2>{0.201860875f, 0.57478559f},
-std::array<float,2>{0.807590902f, 0.0569951721f},
-std::array<float,2>{0.685729802f, 0.900020361f},
-std::array<float,2>{0.467026651f, 0.287566632f},
-std::array<float,2>{0.307797939f, 0.83632648f},
-std::array<float,2>{0.582362413f, 0.391268283f},
-std::array<float,2>{0.936974466f, 0.642110348f},
-std::array<float,2>{0.0146269072f, 0.147367552f},
-std::array<float,2>{0.447133332f, 0.600912929f},
-std::array<float,2>{0.6567294f, 0.013427224f},
-std::array<float,2>{0.782169521f, 0.915514946f},
-std::array<float,2>{0.203483939f, 0.276138723f},
-std::array<float,2>{0.0200753715f, 0.855468154f},
-std::array<float,2>{0.918629944f, 0.413509369f},
-std::array<float,2>{0.571854532f, 0.670557022f},
-std::array<float,2>{0.282896578f, 0.159873232f},
-std::array<float,2>{0.142718956f, 0.688528359f},
-std::array<float,2>{0.817100227f, 0.213294044f},
-std::array<float,2>{0.705430984f, 0.788640559f},
-std::array<float,2>{0.425129145f, 0.445889831f},
-std::array<float,2>{0.3537305f, 0.993322849f},
-std::array<float,2>{0.557824969f, 0.346059084f},
-std::array<float,2>{0.970959902f, 0.536884725f},
-std::array<float,2>{0.12201681f, 0.122369111f},
-std::array<float,2>{0.254629999f, 0.625583112f},
-std::array<float,2>{0.61006099f, 0.135395885f},
-std::array<float,2>{0.879999697f, 0.827337503f},
-std::array<float,2>{0.0569328852f, 0.389132917f},
-std::array<float,2>{0.22774516f, 0.876201332f},
-std::array<float,2>{0.772554815f, 0.302237809f},
-std::array<float,2>{0.633962452f, 0.590247273f},
-std::array<float,2>{0.495462745f, 0.0415428132f},
-std::array<float,2>{0.0715771392f, 0.525464535f},
-std::array<float,2>{0.940031409f, 0.0821701214f},
-std::array<float,2>{0.513378263f, 0.938611448f},
-std::array<float,2>{0.31820035f, 0.332366407f},
-std::array<float,2>{0.398528755f, 0.759746552f},
-std::array<float,2>{0.739600956f, 0.495565921f},
-std::array<float,2>{0.843969941f, 0.747512579f},
-std::array<float,2>{0.163423672f, 0.226692334f},
-std::array<float,2>{0.273371786f, 0.52243185f},
-std::array<float,2>{0.608030796f, 0.0888624862f},
-std::array<float,2>{0.906048f, 0.948747635f},
-std::array<float,2>{0.0454438664f, 0.342168689f},
-std::array<float,2>{0.249041989f, 0.754123569f},
-std::array<float,2>{0.757552385f, 0.485243767f},
-std::array<float,2>{0.652916551f, 0.737668991f},
-std::array<float,2>{0.471239984f, 0.222279593f},
-std::array<float,2>{0.0894742906f, 0.63291955f},
-std::array<float,2>{0.964137852f, 0.128257334f},
-std::array<float,2>{0.51934129f, 0.816257f},
-std::array<float,2>{0.333111793f, 0.382704407f},
-std::array<float,2>{0.383013874f, 0.890591323f},
-std::array<float,2>{0.725716174f, 0.312483907f},
-std::array<float,2>{0.862208724f, 0.58482343f},
-std::array<float,2>{0.18288897f, 0.0381373316f},
-std::array<float,2>{0.463563025f, 0.696856976f},
-std::array<float,2>{0.682596028f, 0.20450224f},
-std::array<float,2>{0.810984373f, 0.792962193f},
-std::array<float,2>{0.196199343f, 0.443909198f},
-std::array<float,2>{0.0105798291f, 0.991724432f},
-std::array<float,2>{0.929694951f, 0.357265532f},
-std::array<float,2>{0.579724193f, 0.543500781f},
-std::array<float,2>{0.311380863f, 0.110115878f},
-std::array<float,2>{0.126684919f, 0.603898823f},
-std::array<float,2>{0.828219056f, 0.00269644894f},
-std::array<float,2>{0.696978033f, 0.909482002f},
-std::array<float,2>{0.413657695f, 0.271550596f},
-std::array<float,2>{0.366078049f, 0.843914688f},
-std::array<float,2>{0.535856128f, 0.418136716f},
-std::array<float,2>{0.988292098f, 0.661589563f},
-std::array<float,2>{0.10625159f, 0.165456548f},
-std::array<float,2>{0.426011711f, 0.564319372f},
-std::array<float,2>{0.710879624f, 0.0508985929f},
-std::array<float,2>{0.815501332f, 0.890942276f},
-std::array<float,2>{0.147745654f, 0.292733908f},
-std::array<float,2>{0.11996074f, 0.835479021f},
-std::array<float,2>{0.974267602f, 0.405923456f},
-std::array<float,2>{0.559298337f, 0.649247885f},
-std::array<float,2>{0.357531309f, 0.149352089f},
-std::array<float,2>{0.21063152f, 0.731169045f},
-std::array<float,2>{0.786587477f, 0.240612909f},
-std::array<float,2>{0.661981463f, 0.768701911f},
-std::array<float,2>{0.451193452f, 0.480527073f},
-std::array<float,2>{0.285213649f, 0.963683069f},
-std::array<float,2>{0.575560153f, 0.31960535f},
-std::array<float,2>{0.917794049f, 0.502147317f},
-std::array<float,2>{0.0191167612f, 0.0729540288f},
-std::array<float,2>{0.315339744f, 0.677592218f},
-std::array<float,2>{0.508004904f, 0.174347341f},
-std::array<float,2>{0.942112684f, 0.873180389f},
-std::array<float,2>{0.0777415559f, 0.428849071f},
-std::array<float,2>{0.156538799f, 0.931012034f},
-std::array<float,2>{0.849806726f, 0.262906015f},
-std::array<float,2>{0.736559808f, 0.61826545f},
-std::array<float,2>{0.404483765f, 0.0174278915f},
-std::array<float,2>{0.059487652f, 0.561477363f},
-std::array<float,2>{0.875248492f, 0.0988113806f},
-std::array<float,2>{0.616641462f, 0.972776234f},
-std::array<float,2>{0.252542138f, 0.362416059f},
-std::array<float,2>{0.498416066f, 0.80766356f},
-std::array<float,2>{0.636968791f, 0.455739975f},
-std::array<float,2>{0.766926825f, 0.71010536f},
-std::array<float,2>{0.232448816f, 0.195039555f},
-std::array<float,2>{0.346616715f, 0.611175179f},
-std::array<float,2>{0.547789812f, 0.0256086737f},
-std::array<float,2>{0.979272723f, 0.927094519f},
-std::array<float,2>{0.112046003f, 0.256765544f},
-std::array<float,2>{0.15322037f, 0.864005208f},
-std::array<float,2>{0.822914124f, 0.436820954f},
-std::array<float,2>{0.715414286f, 0.683555543f},
-std::array<float,2>{0.432239771f, 0.182823166f},
-std::array<float,2>{0.0291966517f, 0.717951059f},
-std::array<float,2>{0.912651539f, 0.199657381f},
-std::array<float,2>{0.563887775f, 0.799769282f},
-std::array<float,2>{0.295594782f, 0.464677721f},
-std::array<float,2>{0.44061619f, 0.980400681f},
-std::array<float,2>{0.66444087f, 0.37279883f},
-std::array<float,2>{0.79626292f, 0.551054239f},
-std::array<float,2>{0.210976392f, 0.103543848f},
-std::array<float,2>{0.396347314f, 0.647231579f},
-std::array<float,2>{0.749466717f, 0.141637921f},
-std::array<float,2>{0.854671299f, 0.84302634f},
-std::array<float,2>{0.16606319f, 0.396622926f},
-std::array<float,2>{0.0646030903f, 0.903291047f},
-std::array<float,2>{0.946438313f, 0.28515467f},
-std::array<float,2>{0.5005548f, 0.572964787f},
-std::array<float,2>{0.327101588f, 0.0597741827f},
-std::array<float,2>{0.220324114f, 0.513483822f},
-std::array<float,2>{0.780039966f, 0.0699758679f},
-std::array<float,2>{0.629339993f, 0.955235183f},
-std::array<float,2>{0.487419575f, 0.320703208f},
-std::array<float,2>{0.258776784f, 0.779515743f},
-std::array<float,2>{0.617483854f, 0.473778635f},
-std::array<float,2>{0.890392423f, 0.726559281f},
-std::array<float,2>{0.047301475f, 0.244237244f},
-std::array<float,2>{0.477093607f, 0.534815133f},
-std::array<float,2>{0.642388582f, 0.121089786f},
-std::array<float,2>{0.764878273f, 0.997108042f},
-std::array<float,2>{0.235965312f, 0.349445164f},
-std::array<float,2>{0.0337355919f, 0.784990251f},
-std::array<float,2>{0.892563164f, 0.451766998f},
-std::array<float,2>{0.595375001f, 0.695155323f},
-std::array<float,2>{0.279055983f, 0.218054339f},
-std::array<float,2>{0.17739673f, 0.666983306f},
-std::array<float,2>{0.872560799f, 0.160811454f},
-std::array<float,2>{0.733861685f, 0.856259882f},
-std::array<float,2>{0.377260685f, 0.409953117f},
-std::array<float,2>{0.342121452f, 0.918822467f},
-std::array<float,2>{0.527333915f, 0.280151188f},
-std::array<float,2>{0.957942843f, 0.596932828f},
-std::array<float,2>{0.0783879757f, 0.0102503207f},
-std::array<float,2>{0.303074747f, 0.744355381f},
-std::array<float,2>{0.589268565f, 0.233555287f},
-std::array<float,2>{0.923568606f, 0.765306175f},
-std::array<float,2>{0.00582957547f, 0.49660182f},
-std::array<float,2>{0.191551536f, 0.944369435f},
-std::array<float,2>{0.79697156f, 0.328997612f},
-std::array<float,2>{0.673925459f, 0.528906465f},
-std::array<float,2>{0.455468118f, 0.0815848708f},
-std::array<float,2>{0.0954877436f, 0.588352919f},
-std::array<float,2>{0.996927738f, 0.0435102172f},
-std::array<float,2>{0.540278673f, 0.882764339f},
-std::array<float,2>{0.368500054f, 0.298991323f},
-std::array<float,2>{0.415866733f, 0.821753144f},
-std::array<float,2>{0.69304049f, 0.383294463f},
-std::array<float,2>{0.843625665f, 0.629921854f},
-std::array<float,2>{0.137618855f, 0.137146935f},
-std::array<float,2>{0.265282243f, 0.606686711f},
-std::array<float,2>{0.622266948f, 0.00500416895f},
-std::array<float,2>{0.885693133f, 0.913918436f},
-std::array<float,2>{0.0537017845f, 0.268718034f},
-std::array<float,2>{0.224198565f, 0.851231694f},
-std::array<float,2>{0.776451826f, 0.416125834f},
-std::array<float,2>{0.62601608f, 0.657117546f},
-std::array<float,2>{0.48962158f, 0.171701968f},
-std::array<float,2>{0.0664827749f, 0.702878833f},
-std::array<float,2>{0.949440122f, 0.209298268f},
-std::array<float,2>{0.507737756f, 0.793369055f},
-std::array<float,2>{0.323382318f, 0.438834935f},
-std::array<float,2>{0.39405039f, 0.986777723f},
-std::array<float,2>{0.743709743f, 0.352772772f},
-std::array<float,2>{0.856862247f, 0.541034937f},
-std::array<float,2>{0.170410514f, 0.114290111f},
-std::array<float,2>{0.443165392f, 0.640371382f},
-std::array<float,2>{0.670303822f, 0.132349551f},
-std::array<float,2>{0.789286911f, 0.818852246f},
-std::array<float,2>{0.21720691f, 0.375626713f},
-std::array<float,2>{0.023689745f, 0.88598907f},
-std::array<float,2>{0.908784866f, 0.306815147f},
-std::array<float,2>{0.568886161f, 0.578516245f},
-std::array<float,2>{0.291395307f, 0.0320776924f},
-std::array<float,2>{0.148648143f, 0.51871717f},
-std::array<float,2>{0.827225089f, 0.0905473307f},
-std::array<float,2>{0.712854087f, 0.950775206f},
-std::array<float,2>{0.437278092f, 0.337401599f},
-std::array<float,2>{0.34791863f, 0.753001571f},
-std::array<float,2>{0.5531497f, 0.490616292f},
-std::array<float,2>{0.983327329f, 0.741463065f},
-std::array<float,2>{0.116984457f, 0.224497586f},
-std::array<float,2>{0.418930113f, 0.556922197f},
-std::array<float,2>{0.688227534f, 0.0958356261f},
-std::array<float,2>{0.836307168f, 0.968838871f},
-std::array<float,2>{0.13471967f, 0.36563015f},
-std::array<float,2>{0.0992644355f, 0.809066176f},
-std::array<float,2>{0.994139671f, 0.459521413f},
-std::array<float,2>{0.546454251f, 0.705683768f},
-std::array<float,2>{0.372578502f, 0.188437939f},
-std::array<float,2>{0.188016415f, 0.674626231f},
-std::array<float,2>{0.801798642f, 0.176600769f},
-std::array<float,2>{0.678303003f, 0.868852854f},
-std::array<float,2>{0.457901597f, 0.422773242f},
-std::array<float,2>{0.299666822f, 0.936282158f},
-std::array<float,2>{0.590945423f, 0.260031164f},
-std::array<float,2>{0.92874074f, 0.621165216f},
-std::array<float,2>{8.98779981e-05f, 0.0221547186f},
-std::array<float,2>{0.336784929f, 0.72735703f},
-std::array<float,2>{0.527881265f, 0.23484455f},
-std::array<float,2>{0.954709113f, 0.770907402f},
-std::array<float,2>{0.0823800191f, 0.477800876f},
-std::array<float,2>{0.175171062f, 0.965032697f},
-std::array<float,2>{0.869966149f, 0.312508225f},
-std::array<float,2>{0.726846039f, 0.506489575f},
-std::array<float,2>{0.382653862f, 0.07449352f},
-std::array<float,2>{0.0378416926f, 0.569725394f},
-std::array<float,2>{0.896091819f, 0.0494733937f},
-std::array<float,2>{0.600640774f, 0.89698559f},
-std::array<float,2>{0.275319278f, 0.295812845f},
-std::array<float,2>{0.484117389f, 0.830102921f},
-std::array<float,2>{0.648157597f, 0.40111962f},
-std::array<float,2>{0.761707127f, 0.65385741f},
-std::array<float,2>{0.238618031f, 0.15555726f},
-std::array<float,2>{0.362690628f, 0.508329511f},
-std::array<float,2>{0.531526208f, 0.0646319911f},
-std::array<float,2>{0.986575663f, 0.95731765f},
-std::array<float,2>{0.104043901f, 0.326067328f},
-std::array<float,2>{0.131368399f, 0.775992513f},
-std::array<float,2>{0.833172262f, 0.47126019f},
-std::array<float,2>{0.703118801f, 0.719329715f},
-std::array<float,2>{0.40802896f, 0.247559816f},
-std::array<float,2>{0.0126861203f, 0.643843412f},
-std::array<float,2>{0.934976518f, 0.146125406f},
-std::array<float,2>{0.585404932f, 0.839395106f},
-std::array<float,2>{0.306633472f, 0.39444828f},
-std::array<float,2>{0.466504335f, 0.900889516f},
-std::array<float,2>{0.684318125f, 0.286713868f},
-std::array<float,2>{0.804958403f, 0.576824069f},
-std::array<float,2>{0.199338391f, 0.0565806516f},
-std::array<float,2>{0.390114725f, 0.71430397f},
-std::array<float,2>{0.720777631f, 0.198390156f},
-std::array<float,2>{0.867087245f, 0.803567588f},
-std::array<float,2>{0.18645367f, 0.465868503f},
-std::array<float,2>{0.0901560709f, 0.982272804f},
-std::array<float,2>{0.964921057f, 0.368930787f},
-std::array<float,2>{0.522240639f, 0.547978163f},
-std::array<float,2>{0.328947276f, 0.10928677f},
-std::array<float,2>{0.245265856f, 0.615196168f},
-std::array<float,2>{0.751366794f, 0.0289511606f},
-std::array<float,2>{0.649777949f, 0.923001945f},
-std::array<float,2>{0.474403888f, 0.25387001f},
-std::array<float,2>{0.266973138f, 0.86160028f},
-std::array<float,2>{0.605306685f, 0.432983071f},
-std::array<float,2>{0.90157032f, 0.685713828f},
-std::array<float,2>{0.0421960913f, 0.186916485f},
-std::array<float,2>{0.492286593f, 0.593373001f},
-std::array<float,2>{0.635596573f, 0.0400908329f},
-std::array<float,2>{0.770718813f, 0.877056599f},
-std::array<float,2>{0.229736522f, 0.303504765f},
-std::array<float,2>{0.0551672839f, 0.824302793f},
-std::array<float,2>{0.881434679f, 0.388438672f},
-std::array<float,2>{0.612547696f, 0.628798366f},
-std::array<float,2>{0.256518155f, 0.133660331f},
-std::array<float,2>{0.160185516f, 0.749082625f},
-std::array<float,2>{0.846860528f, 0.22910504f},
-std::array<float,2>{0.741768599f, 0.760907173f},
-std::array<float,2>{0.401783198f, 0.492593378f},
-std::array<float,2>{0.319559216f, 0.940178454f},
-std::array<float,2>{0.515437663f, 0.33588624f},
-std::array<float,2>{0.938816011f, 0.52507329f},
-std::array<float,2>{0.0725609139f, 0.0848580524f},
-std::array<float,2>{0.283939034f, 0.668311894f},
-std::array<float,2>{0.573149323f, 0.156263277f},
-std::array<float,2>{0.921793759f, 0.853279173f},
-std::array<float,2>{0.0220731795f, 0.410402834f},
-std::array<float,2>{0.205289155f, 0.917909503f},
-std::array<float,2>{0.783413231f, 0.275060833f},
-std::array<float,2>{0.658964992f, 0.598641932f},
-std::array<float,2>{0.44803533f, 0.0140648279f},
-std::array<float,2>{0.124230444f, 0.537974179f},
-std::array<float,2>{0.969731808f, 0.124461666f},
-std::array<float,2>{0.555751026f, 0.99550879f},
-std::array<float,2>{0.35230571f, 0.344169617f},
-std::array<float,2>{0.423004955f, 0.786664486f},
-std::array<float,2>{0.703966558f, 0.448094875f},
-std::array<float,2>{0.818909168f, 0.689827919f},
-std::array<float,2>{0.141710296f, 0.212852165f},
-std::array<float,2>{0.309897095f, 0.546328723f},
-std::array<float,2>{0.580156207f, 0.111501187f},
-std::array<float,2>{0.932324231f, 0.988673329f},
-std::array<float,2>{0.00797750708f, 0.358537376f},
-std::array<float,2>{0.19841738f, 0.790597737f},
-std::array<float,2>{0.80988574f, 0.441869795f},
-std::array<float,2>{0.680940211f, 0.698396921f},
-std::array<float,2>{0.460988909f, 0.20577006f},
-std::array<float,2>{0.108044565f, 0.663092077f},
-std::array<float,2>{0.991206706f, 0.166205019f},
-std::array<float,2>{0.537474632f, 0.845937133f},
-std::array<float,2>{0.364460617f, 0.420704365f},
-std::array<float,2>{0.411392987f, 0.906417549f},
-std::array<float,2>{0.698517442f, 0.269879341f},
-std::array<float,2>{0.830662608f, 0.602949619f},
-std::array<float,2>{0.127060041f, 0.000671444403f},
-std::array<float,2>{0.468783945f, 0.736045659f},
-std::array<float,2>{0.655176222f, 0.219264805f},
-std::array<float,2>{0.755846202f, 0.757581592f},
-std::array<float,2>{0.246345043f, 0.487004101f},
-std::array<float,2>{0.0446150862f, 0.94717294f},
-std::array<float,2>{0.902405083f, 0.341361761f},
-std::array<float,2>{0.606491923f, 0.520071089f},
-std::array<float,2>{0.271453798f, 0.0878262892f},
-std::array<float,2>{0.180912003f, 0.583852291f},
-std::array<float,2>{0.860424876f, 0.0367462672f},
-std::array<float,2>{0.723985255f, 0.887500882f},
-std::array<float,2>{0.386077225f, 0.310222745f},
-std::array<float,2>{0.335707456f, 0.81254971f},
-std::array<float,2>{0.51657027f, 0.37959674f},
-std::array<float,2>{0.962665975f, 0.635071635f},
-std::array<float,2>{0.0863947645f, 0.125830933f},
-std::array<float,2>{0.403177917f, 0.619355261f},
-std::array<float,2>{0.736157477f, 0.0183775462f},
-std::array<float,2>{0.848559439f, 0.933039308f},
-std::array<float,2>{0.158965692f, 0.264632255f},
-std::array<float,2>{0.0760633796f, 0.872069895f},
-std::array<float,2>{0.944370806f, 0.427497596f},
-std::array<float,2>{0.510716856f, 0.679426253f},
-std::array<float,2>{0.312993854f, 0.172743276f},
-std::array<float,2>{0.232123077f, 0.70856756f},
-std::array<float,2>{0.768407047f, 0.192724437f},
-std::array<float,2>{0.640194237f, 0.80471766f},
-std::array<float,2>{0.497866571f, 0.454341024f},
-std::array<float,2>{0.250879616f, 0.975389421f},
-std::array<float,2>{0.613289356f, 0.360991687f},
-std::array<float,2>{0.877544284f, 0.559720278f},
-std::array<float,2>{0.0611848272f, 0.10133671f},
-std::array<float,2>{0.3560251f, 0.65184468f},
-std::array<float,2>{0.561571956f, 0.151714921f},
-std::array<float,2>{0.97539866f, 0.83397162f},
-std::array<float,2>{0.117832638f, 0.404270589f},
-std::array<float,2>{0.145225063f, 0.892645955f},
-std::array<float,2>{0.812630117f, 0.289704204f},
-std::array<float,2>{0.708675802f, 0.564687967f},
-std::array<float,2>{0.428637207f, 0.0528074279f},
-std::array<float,2>{0.0161814243f, 0.500960648f},
-std::array<float,2>{0.91454947f, 0.0711749196f},
-std::array<float,2>{0.576178253f, 0.962648571f},
-std::array<float,2>{0.289056718f, 0.317934155f},
-std::array<float,2>{0.450787663f, 0.766603053f},
-std::array<float,2>{0.662135661f, 0.483922333f},
-std::array<float,2>{0.788416684f, 0.732717991f},
-std::array<float,2>{0.207958058f, 0.240112245f},
-std::array<float,2>{0.324599266f, 0.570505619f},
-std::array<float,2>{0.503242493f, 0.0606535487f},
-std::array<float,2>{0.947984874f, 0.90481317f},
-std::array<float,2>{0.0631663948f, 0.281348884f},
-std::array<float,2>{0.164953008f, 0.841241956f},
-std::array<float,2>{0.853492558f, 0.395118803f},
-std::array<float,2>{0.746842086f, 0.645959258f},
-std::array<float,2>{0.396720529f, 0.144500494f},
-std::array<float,2>{0.0496771559f, 0.723775506f},
-std::array<float,2>{0.888202727f, 0.243925124f},
-std::array<float,2>{0.619696558f, 0.779007494f},
-std::array<float,2>{0.260912001f, 0.476192117f},
-std::array<float,2>{0.485388517f, 0.954913139f},
-std::array<float,2>{0.632116318f, 0.323994339f},
-std::array<float,2>{0.778100789f, 0.515554845f},
-std::array<float,2>{0.222641513f, 0.0680890307f},
-std::array<float,2>{0.431546539f, 0.680102646f},
-std::array<float,2>{0.71849972f, 0.181619465f},
-std::array<float,2>{0.821145058f, 0.867153883f},
-std::array<float,2>{0.154967964f, 0.433662862f},
-std::array<float,2>{0.109445237f, 0.929153562f},
-std::array<float,2>{0.977740586f, 0.254015893f},
-std::array<float,2>{0.549784541f, 0.61251086f},
-std::array<float,2>{0.344027042f, 0.0242766533f},
-std::array<float,2>{0.214727923f, 0.553381979f},
-std::array<float,2>{0.793303311f, 0.101693138f},
-std::array<float,2>{0.666837692f, 0.977059901f},
-std::array<float,2>{0.438012451f, 0.373323113f},
-std::array<float,2>{0.293822169f, 0.797593474f},
-std::array<float,2>{0.565407813f, 0.461140841f},
-std::array<float,2>{0.910924971f, 0.715435982f},
-std::array<float,2>{0.0311735664f, 0.2021503f},
-std::array<float,2>{0.454945028f, 0.530201614f},
-std::array<float,2>{0.673069298f, 0.078627564f},
-std::array<float,2>{0.799886346f, 0.942452312f},
-std::array<float,2>{0.194705516f, 0.330990225f},
-std::array<float,2>{0.00705042062f, 0.762823701f},
-std::array<float,2>{0.924505472f, 0.499968052f},
-std::array<float,2>{0.587033391f, 0.743667006f},
-std::array<float,2>{0.302615374f, 0.231754005f},
-std::array<float,2>{0.138749257f, 0.632203579f},
-std::array<float,2>{0.841015577f, 0.138923138f},
-std::array<float,2>{0.695039511f, 0.823218226f},
-std::array<float,2>{0.417230517f, 0.386468202f},
-std::array<float,2>{0.369684577f, 0.880659223f},
-std::array<float,2>{0.542942464f, 0.29704693f},
-std::array<float,2>{0.99953407f, 0.586792886f},
-std::array<float,2>{0.0962610692f, 0.0454044715f},
-std::array<float,2>{0.280977994f, 0.692679942f},
-std::array<float,2>{0.597281814f, 0.215345159f},
-std::array<float,2>{0.892713726f, 0.783024073f},
-std::array<float,2>{0.0314129516f, 0.450193733f},
-std::array<float,2>{0.237156659f, 0.999252856f},
-std::array<float,2>{0.762073457f, 0.351228148f},
-std::array<float,2>{0.6437428f, 0.533199847f},
-std::array<float,2>{0.479615033f, 0.118172817f},
-std::array<float,2>{0.0815151408f, 0.594734609f},
-std::array<float,2>{0.960902631f, 0.00876637921f},
-std::array<float,2>{0.524415195f, 0.921429813f},
-std::array<float,2>{0.340767294f, 0.278189927f},
-std::array<float,2>{0.376388401f, 0.858053446f},
-std::array<float,2>{0.731818318f, 0.406652302f},
-std::array<float,2>{0.874682248f, 0.665137529f},
-std::array<float,2>{0.179130256f, 0.163580358f}}
\ No newline at end of file
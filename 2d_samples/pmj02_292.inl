@@ -1,4096 +0,0 @@
-{std::array<float,2>{0.996187985f, 0.887981653f},
-std::array<float,2>{0.271909773f, 0.38825649f},
-std::array<float,2>{0.574902058f, 0.0347264446f},
-std::array<float,2>{0.065646112f, 0.693609834f},
-std::array<float,2>{0.712756515f, 0.563582957f},
-std::array<float,2>{0.191158488f, 0.197555169f},
-std::array<float,2>{0.752293706f, 0.28366521f},
-std::array<float,2>{0.402754307f, 0.823952794f},
-std::array<float,2>{0.864289463f, 0.6769135f},
-std::array<float,2>{0.467235297f, 0.121324897f},
-std::array<float,2>{0.660417914f, 0.468441993f},
-std::array<float,2>{0.125660181f, 0.993101895f},
-std::array<float,2>{0.509230375f, 0.8054052f},
-std::array<float,2>{0.0584975071f, 0.352787584f},
-std::array<float,2>{0.879291177f, 0.135461777f},
-std::array<float,2>{0.366437465f, 0.552622139f},
-std::array<float,2>{0.802798867f, 0.848373055f},
-std::array<float,2>{0.41338703f, 0.280501097f},
-std::array<float,2>{0.744501472f, 0.24052988f},
-std::array<float,2>{0.225971326f, 0.62368983f},
-std::array<float,2>{0.614339232f, 0.741933405f},
-std::array<float,2>{0.124472275f, 0.0073970505f},
-std::array<float,2>{0.966531754f, 0.428310364f},
-std::array<float,2>{0.296108842f, 0.906718612f},
-std::array<float,2>{0.929606438f, 0.500726759f},
-std::array<float,2>{0.319752067f, 0.172632322f},
-std::array<float,2>{0.531870961f, 0.333457261f},
-std::array<float,2>{0.0150665818f, 0.756292939f},
-std::array<float,2>{0.641798437f, 0.954227269f},
-std::array<float,2>{0.186289832f, 0.491520047f},
-std::array<float,2>{0.84198761f, 0.0681189969f},
-std::array<float,2>{0.475914776f, 0.643311858f},
-std::array<float,2>{0.826518059f, 0.982398391f},
-std::array<float,2>{0.484463274f, 0.451051563f},
-std::array<float,2>{0.628453493f, 0.103104219f},
-std::array<float,2>{0.159264565f, 0.662969589f},
-std::array<float,2>{0.551605225f, 0.5347417f},
-std::array<float,2>{0.0217000004f, 0.150102034f},
-std::array<float,2>{0.919961154f, 0.366735756f},
-std::array<float,2>{0.338946849f, 0.7959162f},
-std::array<float,2>{0.94190228f, 0.717964947f},
-std::array<float,2>{0.301052988f, 0.0615065955f},
-std::array<float,2>{0.601369977f, 0.396208674f},
-std::array<float,2>{0.104609929f, 0.901636899f},
-std::array<float,2>{0.72210145f, 0.834248304f},
-std::array<float,2>{0.2489077f, 0.300629973f},
-std::array<float,2>{0.785771847f, 0.208105773f},
-std::array<float,2>{0.428946823f, 0.581114829f},
-std::array<float,2>{0.897393465f, 0.777796984f},
-std::array<float,2>{0.345866829f, 0.327807903f},
-std::array<float,2>{0.529681683f, 0.16506508f},
-std::array<float,2>{0.0429918133f, 0.528476119f},
-std::array<float,2>{0.67867285f, 0.632414758f},
-std::array<float,2>{0.155874103f, 0.0799017176f},
-std::array<float,2>{0.855981469f, 0.468822509f},
-std::array<float,2>{0.439897746f, 0.938893914f},
-std::array<float,2>{0.775402427f, 0.605526686f},
-std::array<float,2>{0.390222102f, 0.228466719f},
-std::array<float,2>{0.697660208f, 0.261165559f},
-std::array<float,2>{0.216478243f, 0.868395209f},
-std::array<float,2>{0.592463195f, 0.931585789f},
-std::array<float,2>{0.0852716193f, 0.419118226f},
-std::array<float,2>{0.982602417f, 0.0267744642f},
-std::array<float,2>{0.257925212f, 0.722277224f},
-std::array<float,2>{0.912605464f, 0.948476017f},
-std::array<float,2>{0.332858711f, 0.477344662f},
-std::array<float,2>{0.557149351f, 0.0921952054f},
-std::array<float,2>{0.0245825779f, 0.638315558f},
-std::array<float,2>{0.637417793f, 0.521747708f},
-std::array<float,2>{0.165762588f, 0.16324456f},
-std::array<float,2>{0.819551468f, 0.314719141f},
-std::array<float,2>{0.497934163f, 0.768916547f},
-std::array<float,2>{0.789507687f, 0.734169245f},
-std::array<float,2>{0.432530165f, 0.0175749697f},
-std::array<float,2>{0.730099082f, 0.411742091f},
-std::array<float,2>{0.234505802f, 0.924774468f},
-std::array<float,2>{0.607975245f, 0.866760015f},
-std::array<float,2>{0.0992112234f, 0.25752154f},
-std::array<float,2>{0.952004135f, 0.221243396f},
-std::array<float,2>{0.309841514f, 0.595557511f},
-std::array<float,2>{0.846310556f, 0.788285375f},
-std::array<float,2>{0.449048579f, 0.371164411f},
-std::array<float,2>{0.680054545f, 0.144134656f},
-std::array<float,2>{0.147117108f, 0.539490342f},
-std::array<float,2>{0.51604706f, 0.667333126f},
-std::array<float,2>{0.0334323123f, 0.0971928835f},
-std::array<float,2>{0.901135504f, 0.443876088f},
-std::array<float,2>{0.353392929f, 0.970654547f},
-std::array<float,2>{0.970658243f, 0.591683269f},
-std::array<float,2>{0.255402744f, 0.213312626f},
-std::array<float,2>{0.579800248f, 0.311909914f},
-std::array<float,2>{0.0913398936f, 0.842667282f},
-std::array<float,2>{0.692339659f, 0.897351086f},
-std::array<float,2>{0.210195184f, 0.399384469f},
-std::array<float,2>{0.769631267f, 0.0538301393f},
-std::array<float,2>{0.382135957f, 0.704574764f},
-std::array<float,2>{0.761171401f, 0.920529246f},
-std::array<float,2>{0.396821141f, 0.433968723f},
-std::array<float,2>{0.704056859f, 0.0113494694f},
-std::array<float,2>{0.195328563f, 0.742355704f},
-std::array<float,2>{0.56737572f, 0.616146386f},
-std::array<float,2>{0.0769855902f, 0.248738438f},
-std::array<float,2>{0.990919709f, 0.270508766f},
-std::array<float,2>{0.278704137f, 0.853473246f},
-std::array<float,2>{0.888436377f, 0.653544009f},
-std::array<float,2>{0.37175557f, 0.0748266056f},
-std::array<float,2>{0.502575636f, 0.496761233f},
-std::array<float,2>{0.0469305813f, 0.96218276f},
-std::array<float,2>{0.667475343f, 0.76116854f},
-std::array<float,2>{0.133056372f, 0.336492896f},
-std::array<float,2>{0.873061657f, 0.186567426f},
-std::array<float,2>{0.460406899f, 0.510786891f},
-std::array<float,2>{0.957734764f, 0.813298762f},
-std::array<float,2>{0.288589835f, 0.292622685f},
-std::array<float,2>{0.617577732f, 0.193429664f},
-std::array<float,2>{0.114136718f, 0.570836723f},
-std::array<float,2>{0.736200094f, 0.697677255f},
-std::array<float,2>{0.230100304f, 0.0459409431f},
-std::array<float,2>{0.807308793f, 0.375979215f},
-std::array<float,2>{0.419530272f, 0.875175178f},
-std::array<float,2>{0.829870999f, 0.558240712f},
-std::array<float,2>{0.482014f, 0.130375504f},
-std::array<float,2>{0.650895894f, 0.344260812f},
-std::array<float,2>{0.17189765f, 0.798399389f},
-std::array<float,2>{0.545249522f, 0.990749776f},
-std::array<float,2>{0.00201878767f, 0.460085392f},
-std::array<float,2>{0.935927808f, 0.116981052f},
-std::array<float,2>{0.322424442f, 0.681031168f},
-std::array<float,2>{0.946616471f, 0.999546289f},
-std::array<float,2>{0.30601424f, 0.463008225f},
-std::array<float,2>{0.60372889f, 0.118200913f},
-std::array<float,2>{0.0955732688f, 0.67480123f},
-std::array<float,2>{0.731037498f, 0.550129294f},
-std::array<float,2>{0.239322737f, 0.138963759f},
-std::array<float,2>{0.796093822f, 0.359072089f},
-std::array<float,2>{0.436925501f, 0.809144795f},
-std::array<float,2>{0.812868536f, 0.689943314f},
-std::array<float,2>{0.493915796f, 0.038879618f},
-std::array<float,2>{0.634852052f, 0.386333138f},
-std::array<float,2>{0.168695375f, 0.885380268f},
-std::array<float,2>{0.55958271f, 0.824662387f},
-std::array<float,2>{0.0311160181f, 0.286416322f},
-std::array<float,2>{0.906965852f, 0.20179458f},
-std::array<float,2>{0.331864595f, 0.567836046f},
-std::array<float,2>{0.768623173f, 0.753565133f},
-std::array<float,2>{0.376881868f, 0.331139445f},
-std::array<float,2>{0.690217614f, 0.179104179f},
-std::array<float,2>{0.205312684f, 0.506421745f},
-std::array<float,2>{0.583637834f, 0.644698381f},
-std::array<float,2>{0.0898159593f, 0.0625846088f},
-std::array<float,2>{0.973976314f, 0.486865461f},
-std::array<float,2>{0.253401965f, 0.959697425f},
-std::array<float,2>{0.905312538f, 0.621009409f},
-std::array<float,2>{0.356486112f, 0.237891719f},
-std::array<float,2>{0.521337569f, 0.275904506f},
-std::array<float,2>{0.0354539379f, 0.844274223f},
-std::array<float,2>{0.685375214f, 0.91267103f},
-std::array<float,2>{0.143909395f, 0.423451036f},
-std::array<float,2>{0.849998772f, 0.00357994251f},
-std::array<float,2>{0.45277819f, 0.735773265f},
-std::array<float,2>{0.868561625f, 0.905622721f},
-std::array<float,2>{0.454476178f, 0.391683072f},
-std::array<float,2>{0.670455635f, 0.0547329783f},
-std::array<float,2>{0.137641415f, 0.711191475f},
-std::array<float,2>{0.507433712f, 0.583050966f},
-std::array<float,2>{0.0535933487f, 0.204400361f},
-std::array<float,2>{0.883737862f, 0.304166675f},
-std::array<float,2>{0.368781567f, 0.82820636f},
-std::array<float,2>{0.988161266f, 0.659870267f},
-std::array<float,2>{0.273889035f, 0.107160643f},
-std::array<float,2>{0.565291703f, 0.447040319f},
-std::array<float,2>{0.0721546933f, 0.978532195f},
-std::array<float,2>{0.709789395f, 0.792490542f},
-std::array<float,2>{0.201786235f, 0.360196084f},
-std::array<float,2>{0.762778461f, 0.156244203f},
-std::array<float,2>{0.391021907f, 0.535277545f},
-std::array<float,2>{0.93258357f, 0.873934448f},
-std::array<float,2>{0.328083187f, 0.265356272f},
-std::array<float,2>{0.540642858f, 0.232376561f},
-std::array<float,2>{0.00440985151f, 0.6031425f},
-std::array<float,2>{0.653182507f, 0.723695099f},
-std::array<float,2>{0.179540858f, 0.0280781407f},
-std::array<float,2>{0.832265913f, 0.414961547f},
-std::array<float,2>{0.478551656f, 0.934315264f},
-std::array<float,2>{0.808920443f, 0.525147617f},
-std::array<float,2>{0.416499972f, 0.171570554f},
-std::array<float,2>{0.739313185f, 0.323872209f},
-std::array<float,2>{0.233752161f, 0.776672304f},
-std::array<float,2>{0.624157786f, 0.944093108f},
-std::array<float,2>{0.112324826f, 0.473763496f},
-std::array<float,2>{0.955582678f, 0.084255971f},
-std::array<float,2>{0.281466961f, 0.628042817f},
-std::array<float,2>{0.877334952f, 0.927885532f},
-std::array<float,2>{0.361499518f, 0.409775496f},
-std::array<float,2>{0.515130162f, 0.0221963208f},
-std::array<float,2>{0.0599150956f, 0.730418146f},
-std::array<float,2>{0.656448543f, 0.599743783f},
-std::array<float,2>{0.130520031f, 0.224883348f},
-std::array<float,2>{0.860053003f, 0.251235574f},
-std::array<float,2>{0.462975651f, 0.860408306f},
-std::array<float,2>{0.756968737f, 0.635333121f},
-std::array<float,2>{0.402191997f, 0.0862845406f},
-std::array<float,2>{0.718054116f, 0.482694596f},
-std::array<float,2>{0.194044098f, 0.949588478f},
-std::array<float,2>{0.572864473f, 0.77127099f},
-std::array<float,2>{0.0682514608f, 0.319532245f},
-std::array<float,2>{0.995517969f, 0.159299061f},
-std::array<float,2>{0.267530918f, 0.51933974f},
-std::array<float,2>{0.8385849f, 0.837676287f},
-std::array<float,2>{0.470960557f, 0.305845797f},
-std::array<float,2>{0.646909595f, 0.217237413f},
-std::array<float,2>{0.18014726f, 0.588657558f},
-std::array<float,2>{0.53802669f, 0.709022462f},
-std::array<float,2>{0.00895029493f, 0.0491179973f},
-std::array<float,2>{0.924540639f, 0.405922621f},
-std::array<float,2>{0.314129949f, 0.89399606f},
-std::array<float,2>{0.961384356f, 0.5453192f},
-std::array<float,2>{0.289430767f, 0.148356855f},
-std::array<float,2>{0.609784245f, 0.370461792f},
-std::array<float,2>{0.121062733f, 0.781713247f},
-std::array<float,2>{0.74859333f, 0.974655628f},
-std::array<float,2>{0.218783021f, 0.439372271f},
-std::array<float,2>{0.800362647f, 0.0991245732f},
-std::array<float,2>{0.408174425f, 0.670908093f},
-std::array<float,2>{0.782827437f, 0.965264976f},
-std::array<float,2>{0.423493713f, 0.495878667f},
-std::array<float,2>{0.726148248f, 0.0723373219f},
-std::array<float,2>{0.24476777f, 0.65008837f},
-std::array<float,2>{0.596458733f, 0.515555322f},
-std::array<float,2>{0.107629962f, 0.179981753f},
-std::array<float,2>{0.939201117f, 0.341120243f},
-std::array<float,2>{0.300633013f, 0.762959123f},
-std::array<float,2>{0.917173564f, 0.748625517f},
-std::array<float,2>{0.34007439f, 0.0146428738f},
-std::array<float,2>{0.550464213f, 0.433588952f},
-std::array<float,2>{0.016136501f, 0.915297687f},
-std::array<float,2>{0.630907178f, 0.859069407f},
-std::array<float,2>{0.163378224f, 0.268929243f},
-std::array<float,2>{0.823125184f, 0.244135633f},
-std::array<float,2>{0.489559442f, 0.612887561f},
-std::array<float,2>{0.978490651f, 0.803898215f},
-std::array<float,2>{0.262642682f, 0.348090708f},
-std::array<float,2>{0.588669896f, 0.126450717f},
-std::array<float,2>{0.0793140978f, 0.562388003f},
-std::array<float,2>{0.700725555f, 0.686165154f},
-std::array<float,2>{0.212246627f, 0.112488993f},
-std::array<float,2>{0.777713954f, 0.453567237f},
-std::array<float,2>{0.384466976f, 0.98603344f},
-std::array<float,2>{0.852234244f, 0.576303661f},
-std::array<float,2>{0.442033321f, 0.188160628f},
-std::array<float,2>{0.674285412f, 0.293794453f},
-std::array<float,2>{0.150467053f, 0.819795012f},
-std::array<float,2>{0.524199247f, 0.881062746f},
-std::array<float,2>{0.0396815725f, 0.380998731f},
-std::array<float,2>{0.89154464f, 0.0407008342f},
-std::array<float,2>{0.350169361f, 0.702534795f},
-std::array<float,2>{0.967153192f, 0.90931356f},
-std::array<float,2>{0.293879658f, 0.426527202f},
-std::array<float,2>{0.616613328f, 0.00391994277f},
-std::array<float,2>{0.122724511f, 0.739971578f},
-std::array<float,2>{0.742524564f, 0.622147262f},
-std::array<float,2>{0.223978758f, 0.239443839f},
-std::array<float,2>{0.801675141f, 0.278758436f},
-std::array<float,2>{0.410156488f, 0.849943042f},
-std::array<float,2>{0.839966416f, 0.641959906f},
-std::array<float,2>{0.473971575f, 0.0685832873f},
-std::array<float,2>{0.643839419f, 0.489940077f},
-std::array<float,2>{0.185106367f, 0.955569744f},
-std::array<float,2>{0.534107089f, 0.755561113f},
-std::array<float,2>{0.0126317842f, 0.334205359f},
-std::array<float,2>{0.926439524f, 0.175567999f},
-std::array<float,2>{0.317972153f, 0.501955092f},
-std::array<float,2>{0.75164777f, 0.821010709f},
-std::array<float,2>{0.406181931f, 0.283029467f},
-std::array<float,2>{0.714313745f, 0.195964262f},
-std::array<float,2>{0.188555881f, 0.5663535f},
-std::array<float,2>{0.577213764f, 0.692548692f},
-std::array<float,2>{0.0631382018f, 0.0326016322f},
-std::array<float,2>{0.998895407f, 0.38890788f},
-std::array<float,2>{0.270192355f, 0.889520168f},
-std::array<float,2>{0.882412076f, 0.554608524f},
-std::array<float,2>{0.365079492f, 0.133584216f},
-std::array<float,2>{0.511659682f, 0.35545215f},
-std::array<float,2>{0.0564184003f, 0.808509052f},
-std::array<float,2>{0.66398561f, 0.99508214f},
-std::array<float,2>{0.127952635f, 0.465706855f},
-std::array<float,2>{0.866893232f, 0.124900535f},
-std::array<float,2>{0.465917379f, 0.679309368f},
-std::array<float,2>{0.858777344f, 0.939879358f},
-std::array<float,2>{0.439021707f, 0.47183758f},
-std::array<float,2>{0.676597774f, 0.081169337f},
-std::array<float,2>{0.153093964f, 0.629965723f},
-std::array<float,2>{0.527705789f, 0.529565632f},
-std::array<float,2>{0.0457079187f, 0.167951196f},
-std::array<float,2>{0.894548893f, 0.325449675f},
-std::array<float,2>{0.343938351f, 0.779657304f},
-std::array<float,2>{0.982058942f, 0.719328821f},
-std::array<float,2>{0.261537969f, 0.0237072408f},
-std::array<float,2>{0.591500282f, 0.421304941f},
-std::array<float,2>{0.0823787749f, 0.933393061f},
-std::array<float,2>{0.695421457f, 0.870348394f},
-std::array<float,2>{0.218503237f, 0.257815599f},
-std::array<float,2>{0.774948895f, 0.228935421f},
-std::array<float,2>{0.388075203f, 0.607733786f},
-std::array<float,2>{0.919796824f, 0.793164134f},
-std::array<float,2>{0.337673306f, 0.363916308f},
-std::array<float,2>{0.552917004f, 0.15133746f},
-std::array<float,2>{0.019770151f, 0.531935036f},
-std::array<float,2>{0.625165939f, 0.661130965f},
-std::array<float,2>{0.157957777f, 0.103719465f},
-std::array<float,2>{0.825586915f, 0.451330155f},
-std::array<float,2>{0.488141328f, 0.984190583f},
-std::array<float,2>{0.787965655f, 0.578261852f},
-std::array<float,2>{0.427490234f, 0.210811347f},
-std::array<float,2>{0.719115376f, 0.296877325f},
-std::array<float,2>{0.246427387f, 0.833664358f},
-std::array<float,2>{0.598660529f, 0.898641646f},
-std::array<float,2>{0.10223753f, 0.397853732f},
-std::array<float,2>{0.944566965f, 0.0590642169f},
-std::array<float,2>{0.304175347f, 0.71636349f},
-std::array<float,2>{0.899409771f, 0.971673429f},
-std::array<float,2>{0.353672951f, 0.44157958f},
-std::array<float,2>{0.51892364f, 0.0954148322f},
-std::array<float,2>{0.0324865989f, 0.664352298f},
-std::array<float,2>{0.681883931f, 0.541833043f},
-std::array<float,2>{0.144812614f, 0.141627014f},
-std::array<float,2>{0.844118893f, 0.373762965f},
-std::array<float,2>{0.446293801f, 0.785984099f},
-std::array<float,2>{0.773168683f, 0.706126571f},
-std::array<float,2>{0.380660057f, 0.0508457273f},
-std::array<float,2>{0.695089102f, 0.400937527f},
-std::array<float,2>{0.208821684f, 0.896305799f},
-std::array<float,2>{0.580462575f, 0.840866268f},
-std::array<float,2>{0.0934855416f, 0.309195161f},
-std::array<float,2>{0.971987545f, 0.212242052f},
-std::array<float,2>{0.257789314f, 0.593733847f},
-std::array<float,2>{0.816881061f, 0.765927076f},
-std::array<float,2>{0.499651819f, 0.313208461f},
-std::array<float,2>{0.639842451f, 0.161410987f},
-std::array<float,2>{0.167413279f, 0.521106958f},
-std::array<float,2>{0.554865479f, 0.64031142f},
-std::array<float,2>{0.0270510968f, 0.0910592228f},
-std::array<float,2>{0.911544263f, 0.479332745f},
-std::array<float,2>{0.335928202f, 0.946982503f},
-std::array<float,2>{0.950849175f, 0.596377969f},
-std::array<float,2>{0.312132627f, 0.219852477f},
-std::array<float,2>{0.607223988f, 0.254496515f},
-std::array<float,2>{0.100373834f, 0.863553107f},
-std::array<float,2>{0.728373647f, 0.923736274f},
-std::array<float,2>{0.236351997f, 0.413988471f},
-std::array<float,2>{0.792163253f, 0.0183269884f},
-std::array<float,2>{0.43156594f, 0.732117176f},
-std::array<float,2>{0.804915428f, 0.877989173f},
-std::array<float,2>{0.420101643f, 0.377155334f},
-std::array<float,2>{0.736664236f, 0.0448062532f},
-std::array<float,2>{0.22715342f, 0.696760178f},
-std::array<float,2>{0.619334936f, 0.572709918f},
-std::array<float,2>{0.11617706f, 0.192645669f},
-std::array<float,2>{0.960927069f, 0.289444089f},
-std::array<float,2>{0.285443068f, 0.816285372f},
-std::array<float,2>{0.934200585f, 0.683388472f},
-std::array<float,2>{0.320548058f, 0.113550037f},
-std::array<float,2>{0.544674039f, 0.458096534f},
-std::array<float,2>{0.00183345668f, 0.989698112f},
-std::array<float,2>{0.648785293f, 0.799795151f},
-std::array<float,2>{0.175586715f, 0.347240925f},
-std::array<float,2>{0.830635965f, 0.132627174f},
-std::array<float,2>{0.483294547f, 0.555842042f},
-std::array<float,2>{0.989934504f, 0.854092717f},
-std::array<float,2>{0.279721767f, 0.272166044f},
-std::array<float,2>{0.568847358f, 0.24639529f},
-std::array<float,2>{0.074632965f, 0.613394558f},
-std::array<float,2>{0.70530808f, 0.745843351f},
-std::array<float,2>{0.198046744f, 0.00794197526f},
-std::array<float,2>{0.758278012f, 0.436995089f},
-std::array<float,2>{0.396430701f, 0.918129385f},
-std::array<float,2>{0.871391892f, 0.509275377f},
-std::array<float,2>{0.457689196f, 0.185202703f},
-std::array<float,2>{0.664422512f, 0.338300049f},
-std::array<float,2>{0.135924459f, 0.758691013f},
-std::array<float,2>{0.500683129f, 0.963612556f},
-std::array<float,2>{0.048896119f, 0.498782426f},
-std::array<float,2>{0.889584303f, 0.0779985934f},
-std::array<float,2>{0.373192996f, 0.655508041f},
-std::array<float,2>{0.976484597f, 0.958926439f},
-std::array<float,2>{0.251569778f, 0.485145897f},
-std::array<float,2>{0.585081816f, 0.0657209158f},
-std::array<float,2>{0.0872041509f, 0.646947324f},
-std::array<float,2>{0.6891886f, 0.505593956f},
-std::array<float,2>{0.203581348f, 0.177172184f},
-std::array<float,2>{0.766394019f, 0.329260707f},
-std::array<float,2>{0.377699494f, 0.751394689f},
-std::array<float,2>{0.848605514f, 0.73789376f},
-std::array<float,2>{0.449753731f, 0.000854161102f},
-std::array<float,2>{0.685890138f, 0.424098074f},
-std::array<float,2>{0.141160443f, 0.911599219f},
-std::array<float,2>{0.521964192f, 0.846200943f},
-std::array<float,2>{0.0377930216f, 0.273687243f},
-std::array<float,2>{0.903291583f, 0.235909671f},
-std::array<float,2>{0.359307587f, 0.617877722f},
-std::array<float,2>{0.794685841f, 0.81099683f},
-std::array<float,2>{0.434319913f, 0.356438518f},
-std::array<float,2>{0.733237624f, 0.138439372f},
-std::array<float,2>{0.241930634f, 0.547481239f},
-std::array<float,2>{0.602997661f, 0.673684418f},
-std::array<float,2>{0.0959255695f, 0.119743809f},
-std::array<float,2>{0.948752403f, 0.462209642f},
-std::array<float,2>{0.307482302f, 0.99732095f},
-std::array<float,2>{0.909663022f, 0.568645597f},
-std::array<float,2>{0.328891218f, 0.199475288f},
-std::array<float,2>{0.561619699f, 0.288891762f},
-std::array<float,2>{0.0285039563f, 0.828002036f},
-std::array<float,2>{0.63354528f, 0.883133888f},
-std::array<float,2>{0.171538413f, 0.382814795f},
-std::array<float,2>{0.815327466f, 0.0365621597f},
-std::array<float,2>{0.495541781f, 0.687888145f},
-std::array<float,2>{0.834976673f, 0.936847925f},
-std::array<float,2>{0.477412522f, 0.416884333f},
-std::array<float,2>{0.655860305f, 0.0295150056f},
-std::array<float,2>{0.176427305f, 0.725760281f},
-std::array<float,2>{0.541186333f, 0.603610396f},
-std::array<float,2>{0.00674963137f, 0.233016253f},
-std::array<float,2>{0.931526363f, 0.263085634f},
-std::array<float,2>{0.325197041f, 0.872907102f},
-std::array<float,2>{0.954391301f, 0.626617849f},
-std::array<float,2>{0.285119504f, 0.0825137943f},
-std::array<float,2>{0.62183845f, 0.475402534f},
-std::array<float,2>{0.110227212f, 0.943196237f},
-std::array<float,2>{0.740932584f, 0.774446487f},
-std::array<float,2>{0.230781496f, 0.321331799f},
-std::array<float,2>{0.811906874f, 0.169754267f},
-std::array<float,2>{0.415103048f, 0.526638746f},
-std::array<float,2>{0.885253668f, 0.831535339f},
-std::array<float,2>{0.370223016f, 0.301820576f},
-std::array<float,2>{0.505504191f, 0.205171764f},
-std::array<float,2>{0.0524432883f, 0.585281491f},
-std::array<float,2>{0.669299424f, 0.714774907f},
-std::array<float,2>{0.140152916f, 0.0582137369f},
-std::array<float,2>{0.870170116f, 0.392804831f},
-std::array<float,2>{0.455735147f, 0.904011905f},
-std::array<float,2>{0.76526016f, 0.538243175f},
-std::array<float,2>{0.394198656f, 0.153162897f},
-std::array<float,2>{0.708809972f, 0.363264173f},
-std::array<float,2>{0.200578853f, 0.790756345f},
-std::array<float,2>{0.562725663f, 0.976692915f},
-std::array<float,2>{0.0735885277f, 0.449000448f},
-std::array<float,2>{0.984997451f, 0.108080149f},
-std::array<float,2>{0.276592314f, 0.656511009f},
-std::array<float,2>{0.922960281f, 0.89112705f},
-std::array<float,2>{0.316037536f, 0.402888805f},
-std::array<float,2>{0.536503136f, 0.0485821813f},
-std::array<float,2>{0.0104340138f, 0.708046138f},
-std::array<float,2>{0.646084785f, 0.587458849f},
-std::array<float,2>{0.182487547f, 0.215130299f},
-std::array<float,2>{0.83676064f, 0.307396978f},
-std::array<float,2>{0.469401628f, 0.838761389f},
-std::array<float,2>{0.798042834f, 0.669044077f},
-std::array<float,2>{0.408655018f, 0.101107314f},
-std::array<float,2>{0.747308493f, 0.441102684f},
-std::array<float,2>{0.221366197f, 0.972842038f},
-std::array<float,2>{0.611913502f, 0.783396959f},
-std::array<float,2>{0.117842481f, 0.368516326f},
-std::array<float,2>{0.962936699f, 0.145252943f},
-std::array<float,2>{0.29216662f, 0.544042528f},
-std::array<float,2>{0.862521589f, 0.861847103f},
-std::array<float,2>{0.461691558f, 0.253733546f},
-std::array<float,2>{0.658332646f, 0.222909242f},
-std::array<float,2>{0.132764161f, 0.597852707f},
-std::array<float,2>{0.51245147f, 0.727455497f},
-std::array<float,2>{0.0620279908f, 0.0195875801f},
-std::array<float,2>{0.875744522f, 0.408028275f},
-std::array<float,2>{0.360744953f, 0.9274472f},
-std::array<float,2>{0.993758619f, 0.516144753f},
-std::array<float,2>{0.269511521f, 0.156686753f},
-std::array<float,2>{0.571228087f, 0.316799819f},
-std::array<float,2>{0.0702247471f, 0.772937894f},
-std::array<float,2>{0.715423644f, 0.952492118f},
-std::array<float,2>{0.19316797f, 0.481557071f},
-std::array<float,2>{0.754876137f, 0.0892178491f},
-std::array<float,2>{0.399528295f, 0.634584844f},
-std::array<float,2>{0.779795766f, 0.986863256f},
-std::array<float,2>{0.385315508f, 0.456416965f},
-std::array<float,2>{0.702574193f, 0.109816447f},
-std::array<float,2>{0.213588879f, 0.683644533f},
-std::array<float,2>{0.587438166f, 0.559885979f},
-std::array<float,2>{0.0807094648f, 0.128581226f},
-std::array<float,2>{0.980314434f, 0.350816369f},
-std::array<float,2>{0.264455408f, 0.802529454f},
-std::array<float,2>{0.892918169f, 0.700530052f},
-std::array<float,2>{0.348571032f, 0.0429335386f},
-std::array<float,2>{0.525548458f, 0.380503893f},
-std::array<float,2>{0.041883409f, 0.879419327f},
-std::array<float,2>{0.672680378f, 0.816787243f},
-std::array<float,2>{0.150193483f, 0.296809971f},
-std::array<float,2>{0.855233848f, 0.191388249f},
-std::array<float,2>{0.444556773f, 0.575398624f},
-std::array<float,2>{0.939526856f, 0.764963269f},
-std::array<float,2>{0.298342794f, 0.342424482f},
-std::array<float,2>{0.595540404f, 0.183145151f},
-std::array<float,2>{0.106913105f, 0.512344778f},
-std::array<float,2>{0.72376138f, 0.651171029f},
-std::array<float,2>{0.243703276f, 0.071879372f},
-std::array<float,2>{0.783536792f, 0.493422061f},
-std::array<float,2>{0.423957646f, 0.968167663f},
-std::array<float,2>{0.820784152f, 0.610902965f},
-std::array<float,2>{0.491285831f, 0.245001525f},
-std::array<float,2>{0.629311085f, 0.267133564f},
-std::array<float,2>{0.160508916f, 0.856954336f},
-std::array<float,2>{0.547464788f, 0.91689688f},
-std::array<float,2>{0.0188723747f, 0.431290656f},
-std::array<float,2>{0.91516602f, 0.0124312853f},
-std::array<float,2>{0.342597008f, 0.746738076f},
-std::array<float,2>{0.943561256f, 0.90045917f},
-std::array<float,2>{0.303142428f, 0.394766718f},
-std::array<float,2>{0.59812808f, 0.0619568154f},
-std::array<float,2>{0.102933057f, 0.716916144f},
-std::array<float,2>{0.720252395f, 0.580277085f},
-std::array<float,2>{0.247749984f, 0.207915246f},
-std::array<float,2>{0.788839996f, 0.298998028f},
-std::array<float,2>{0.426723331f, 0.835736334f},
-std::array<float,2>{0.824437439f, 0.66399008f},
-std::array<float,2>{0.486880422f, 0.102290399f},
-std::array<float,2>{0.626402855f, 0.450152755f},
-std::array<float,2>{0.157148406f, 0.981142223f},
-std::array<float,2>{0.554344773f, 0.795628071f},
-std::array<float,2>{0.0207475983f, 0.365742922f},
-std::array<float,2>{0.918120384f, 0.148780033f},
-std::array<float,2>{0.336867601f, 0.534096777f},
-std::array<float,2>{0.774281383f, 0.867868364f},
-std::array<float,2>{0.38709417f, 0.26020211f},
-std::array<float,2>{0.696962357f, 0.226779565f},
-std::array<float,2>{0.216908872f, 0.607169151f},
-std::array<float,2>{0.589940846f, 0.720968127f},
-std::array<float,2>{0.0830154344f, 0.0254052095f},
-std::array<float,2>{0.980725586f, 0.418903291f},
-std::array<float,2>{0.260211796f, 0.930343509f},
-std::array<float,2>{0.895602107f, 0.528090596f},
-std::array<float,2>{0.345374554f, 0.164569557f},
-std::array<float,2>{0.529008567f, 0.326527387f},
-std::array<float,2>{0.046577137f, 0.778384268f},
-std::array<float,2>{0.677674949f, 0.937854826f},
-std::array<float,2>{0.153689891f, 0.470626354f},
-std::array<float,2>{0.857708097f, 0.0783320516f},
-std::array<float,2>{0.437668294f, 0.63157475f},
-std::array<float,2>{0.865623474f, 0.993328333f},
-std::array<float,2>{0.465566903f, 0.466841668f},
-std::array<float,2>{0.662964046f, 0.122557387f},
-std::array<float,2>{0.127157524f, 0.675892711f},
-std::array<float,2>{0.510236621f, 0.55145818f},
-std::array<float,2>{0.0555964075f, 0.136603281f},
-std::array<float,2>{0.8810395f, 0.351668894f},
-std::array<float,2>{0.36344102f, 0.806087136f},
-std::array<float,2>{0.999459326f, 0.694791317f},
-std::array<float,2>{0.270999581f, 0.0335997455f},
-std::array<float,2>{0.577115953f, 0.387539178f},
-std::array<float,2>{0.0638704374f, 0.887224197f},
-std::array<float,2>{0.713808715f, 0.822530866f},
-std::array<float,2>{0.187647521f, 0.284660995f},
-std::array<float,2>{0.750702739f, 0.198536471f},
-std::array<float,2>{0.405249625f, 0.562518537f},
-std::array<float,2>{0.926895022f, 0.757158041f},
-std::array<float,2>{0.317308486f, 0.332124323f},
-std::array<float,2>{0.534327626f, 0.172906637f},
-std::array<float,2>{0.0131107494f, 0.501482248f},
-std::array<float,2>{0.642803729f, 0.643844604f},
-std::array<float,2>{0.183771998f, 0.0673067421f},
-std::array<float,2>{0.840877354f, 0.490340739f},
-std::array<float,2>{0.47356689f, 0.953463495f},
-std::array<float,2>{0.802728117f, 0.624046028f},
-std::array<float,2>{0.411215931f, 0.242143467f},
-std::array<float,2>{0.743619084f, 0.279365569f},
-std::array<float,2>{0.223188102f, 0.848741412f},
-std::array<float,2>{0.615514338f, 0.907679796f},
-std::array<float,2>{0.121692747f, 0.429134339f},
-std::array<float,2>{0.967788935f, 0.00616695778f},
-std::array<float,2>{0.294623226f, 0.740239084f},
-std::array<float,2>{0.889987171f, 0.961098552f},
-std::array<float,2>{0.374266714f, 0.497519195f},
-std::array<float,2>{0.501583636f, 0.0756474957f},
-std::array<float,2>{0.0498604104f, 0.653138161f},
-std::array<float,2>{0.665302396f, 0.510160923f},
-std::array<float,2>{0.135704309f, 0.185588986f},
-std::array<float,2>{0.872969687f, 0.33773151f},
-std::array<float,2>{0.458606601f, 0.759871125f},
-std::array<float,2>{0.759050548f, 0.743684411f},
-std::array<float,2>{0.39531979f, 0.0101275248f},
-std::array<float,2>{0.706504703f, 0.435022473f},
-std::array<float,2>{0.198270649f, 0.921119809f},
-std::array<float,2>{0.569612205f, 0.85206908f},
-std::array<float,2>{0.0756952688f, 0.270254731f},
-std::array<float,2>{0.988432825f, 0.249164328f},
-std::array<float,2>{0.280488878f, 0.616930425f},
-std::array<float,2>{0.831890762f, 0.797634065f},
-std::array<float,2>{0.484104604f, 0.345395416f},
-std::array<float,2>{0.649489999f, 0.129231125f},
-std::array<float,2>{0.174762204f, 0.557029903f},
-std::array<float,2>{0.543558776f, 0.680301547f},
-std::array<float,2>{0.000149803542f, 0.115983218f},
-std::array<float,2>{0.935305178f, 0.459475189f},
-std::array<float,2>{0.321932405f, 0.991268218f},
-std::array<float,2>{0.959910989f, 0.571560323f},
-std::array<float,2>{0.286769837f, 0.194780797f},
-std::array<float,2>{0.620402694f, 0.291622728f},
-std::array<float,2>{0.11704693f, 0.813539565f},
-std::array<float,2>{0.737633705f, 0.876367688f},
-std::array<float,2>{0.22837384f, 0.375188798f},
-std::array<float,2>{0.80578047f, 0.045465894f},
-std::array<float,2>{0.421718627f, 0.698449373f},
-std::array<float,2>{0.79112345f, 0.924952388f},
-std::array<float,2>{0.43029362f, 0.410726845f},
-std::array<float,2>{0.726942956f, 0.0157089625f},
-std::array<float,2>{0.237355128f, 0.733254969f},
-std::array<float,2>{0.606375694f, 0.593848169f},
-std::array<float,2>{0.101080127f, 0.221850246f},
-std::array<float,2>{0.94953537f, 0.256252348f},
-std::array<float,2>{0.311443686f, 0.865288258f},
-std::array<float,2>{0.910778999f, 0.636979759f},
-std::array<float,2>{0.334523708f, 0.0937027037f},
-std::array<float,2>{0.556429386f, 0.47759515f},
-std::array<float,2>{0.0263112839f, 0.948143959f},
-std::array<float,2>{0.638995886f, 0.767687142f},
-std::array<float,2>{0.166900054f, 0.315478832f},
-std::array<float,2>{0.817636967f, 0.162518233f},
-std::array<float,2>{0.498276561f, 0.523390353f},
-std::array<float,2>{0.97072351f, 0.843249738f},
-std::array<float,2>{0.256430715f, 0.310846865f},
-std::array<float,2>{0.58124125f, 0.213996813f},
-std::array<float,2>{0.0923589468f, 0.590160847f},
-std::array<float,2>{0.694121301f, 0.703134537f},
-std::array<float,2>{0.207763776f, 0.0531438552f},
-std::array<float,2>{0.771899521f, 0.39990586f},
-std::array<float,2>{0.379357606f, 0.898284256f},
-std::array<float,2>{0.845299065f, 0.540620089f},
-std::array<float,2>{0.445387781f, 0.143114433f},
-std::array<float,2>{0.683346272f, 0.372620732f},
-std::array<float,2>{0.145720333f, 0.787997901f},
-std::array<float,2>{0.518104196f, 0.969554603f},
-std::array<float,2>{0.0320564695f, 0.445045322f},
-std::array<float,2>{0.89987129f, 0.0957739204f},
-std::array<float,2>{0.354949027f, 0.666958809f},
-std::array<float,2>{0.986037195f, 0.980054677f},
-std::array<float,2>{0.276273698f, 0.445778459f},
-std::array<float,2>{0.563686252f, 0.10571871f},
-std::array<float,2>{0.0724885836f, 0.658830643f},
-std::array<float,2>{0.707285047f, 0.536713958f},
-std::array<float,2>{0.199843854f, 0.15433456f},
-std::array<float,2>{0.763697445f, 0.360515714f},
-std::array<float,2>{0.393102825f, 0.791464984f},
-std::array<float,2>{0.870025456f, 0.712261498f},
-std::array<float,2>{0.456203967f, 0.0558297709f},
-std::array<float,2>{0.668484986f, 0.391401887f},
-std::array<float,2>{0.138901249f, 0.90465647f},
-std::array<float,2>{0.504260302f, 0.829399467f},
-std::array<float,2>{0.0515392385f, 0.30318138f},
-std::array<float,2>{0.885918558f, 0.203704417f},
-std::array<float,2>{0.369196355f, 0.582938969f},
-std::array<float,2>{0.8113572f, 0.776042223f},
-std::array<float,2>{0.414409488f, 0.322855324f},
-std::array<float,2>{0.741635025f, 0.170635954f},
-std::array<float,2>{0.232415244f, 0.523780763f},
-std::array<float,2>{0.622385681f, 0.627566993f},
-std::array<float,2>{0.111246675f, 0.0857242793f},
-std::array<float,2>{0.953218281f, 0.473590583f},
-std::array<float,2>{0.284152746f, 0.945274413f},
-std::array<float,2>{0.930468738f, 0.602163553f},
-std::array<float,2>{0.325164914f, 0.231353194f},
-std::array<float,2>{0.54260534f, 0.264085591f},
-std::array<float,2>{0.00697718374f, 0.874726832f},
-std::array<float,2>{0.655133128f, 0.935047209f},
-std::array<float,2>{0.177014008f, 0.415696383f},
-std::array<float,2>{0.834799707f, 0.0284442287f},
-std::array<float,2>{0.478022069f, 0.723591447f},
-std::array<float,2>{0.816348493f, 0.886691391f},
-std::array<float,2>{0.494421393f, 0.385092527f},
-std::array<float,2>{0.634031534f, 0.0380392298f},
-std::array<float,2>{0.17070879f, 0.690856159f},
-std::array<float,2>{0.561371207f, 0.567108393f},
-std::array<float,2>{0.0274512209f, 0.202721581f},
-std::array<float,2>{0.908764958f, 0.285848707f},
-std::array<float,2>{0.329443097f, 0.826168597f},
-std::array<float,2>{0.94754678f, 0.675150931f},
-std::array<float,2>{0.308459729f, 0.11794357f},
-std::array<float,2>{0.602428198f, 0.46481815f},
-std::array<float,2>{0.0970928222f, 0.998702049f},
-std::array<float,2>{0.734187543f, 0.810422778f},
-std::array<float,2>{0.241102442f, 0.357524514f},
-std::array<float,2>{0.793639958f, 0.140207812f},
-std::array<float,2>{0.434900343f, 0.549626827f},
-std::array<float,2>{0.903649211f, 0.845282257f},
-std::array<float,2>{0.357993066f, 0.276553482f},
-std::array<float,2>{0.522521496f, 0.236570597f},
-std::array<float,2>{0.0386953466f, 0.619348586f},
-std::array<float,2>{0.687444031f, 0.73463881f},
-std::array<float,2>{0.141792804f, 0.00195420999f},
-std::array<float,2>{0.848893166f, 0.421913087f},
-std::array<float,2>{0.450523108f, 0.913553298f},
-std::array<float,2>{0.766895056f, 0.506927729f},
-std::array<float,2>{0.377975792f, 0.178267181f},
-std::array<float,2>{0.688074946f, 0.330843091f},
-std::array<float,2>{0.204458401f, 0.751993597f},
-std::array<float,2>{0.584643662f, 0.959974408f},
-std::array<float,2>{0.086646758f, 0.488126397f},
-std::array<float,2>{0.97522974f, 0.0636889488f},
-std::array<float,2>{0.250528425f, 0.645991385f},
-std::array<float,2>{0.914942384f, 0.914318144f},
-std::array<float,2>{0.34302482f, 0.43205893f},
-std::array<float,2>{0.548292339f, 0.0154450573f},
-std::array<float,2>{0.0183855258f, 0.749331534f},
-std::array<float,2>{0.630330205f, 0.611368775f},
-std::array<float,2>{0.161608711f, 0.242754579f},
-std::array<float,2>{0.821871698f, 0.268312812f},
-std::array<float,2>{0.490553111f, 0.858029842f},
-std::array<float,2>{0.784579575f, 0.649287283f},
-std::array<float,2>{0.425750792f, 0.0735528693f},
-std::array<float,2>{0.722680151f, 0.494707286f},
-std::array<float,2>{0.24314703f, 0.966210127f},
-std::array<float,2>{0.593837738f, 0.762368917f},
-std::array<float,2>{0.106211394f, 0.340238571f},
-std::array<float,2>{0.941172421f, 0.181511551f},
-std::array<float,2>{0.297396243f, 0.514498115f},
-std::array<float,2>{0.854158521f, 0.818580449f},
-std::array<float,2>{0.444025397f, 0.294312268f},
-std::array<float,2>{0.673270285f, 0.188747287f},
-std::array<float,2>{0.14916262f, 0.577152252f},
-std::array<float,2>{0.527248383f, 0.702072442f},
-std::array<float,2>{0.0426854342f, 0.0398850739f},
-std::array<float,2>{0.894279361f, 0.382202625f},
-std::array<float,2>{0.34946698f, 0.882312477f},
-std::array<float,2>{0.978788078f, 0.560859621f},
-std::array<float,2>{0.265032828f, 0.125290394f},
-std::array<float,2>{0.586001158f, 0.349294156f},
-std::array<float,2>{0.0814768746f, 0.803365469f},
-std::array<float,2>{0.702124238f, 0.984485805f},
-std::array<float,2>{0.214711592f, 0.454667509f},
-std::array<float,2>{0.780631125f, 0.111690842f},
-std::array<float,2>{0.38632369f, 0.686612129f},
-std::array<float,2>{0.75516808f, 0.950862825f},
-std::array<float,2>{0.399161994f, 0.48345232f},
-std::array<float,2>{0.716147006f, 0.0873315409f},
-std::array<float,2>{0.191587731f, 0.636705101f},
-std::array<float,2>{0.572035909f, 0.518460035f},
-std::array<float,2>{0.0684595481f, 0.159057513f},
-std::array<float,2>{0.992342591f, 0.31836617f},
-std::array<float,2>{0.267764807f, 0.769708395f},
-std::array<float,2>{0.876401246f, 0.72920543f},
-std::array<float,2>{0.359765202f, 0.0230504964f},
-std::array<float,2>{0.51303339f, 0.408714652f},
-std::array<float,2>{0.0610820279f, 0.929210067f},
-std::array<float,2>{0.659540594f, 0.859674037f},
-std::array<float,2>{0.131750837f, 0.250682473f},
-std::array<float,2>{0.862214327f, 0.225667492f},
-std::array<float,2>{0.462888628f, 0.600612283f},
-std::array<float,2>{0.964298844f, 0.782647073f},
-std::array<float,2>{0.291282564f, 0.369565964f},
-std::array<float,2>{0.6123963f, 0.147104219f},
-std::array<float,2>{0.118429378f, 0.545930982f},
-std::array<float,2>{0.746364892f, 0.670387745f},
-std::array<float,2>{0.222417355f, 0.0980182067f},
-std::array<float,2>{0.797095776f, 0.438438863f},
-std::array<float,2>{0.409968644f, 0.976316392f},
-std::array<float,2>{0.83762002f, 0.589282155f},
-std::array<float,2>{0.470335931f, 0.21836029f},
-std::array<float,2>{0.644866765f, 0.304917991f},
-std::array<float,2>{0.183152795f, 0.836076498f},
-std::array<float,2>{0.535557628f, 0.893160939f},
-std::array<float,2>{0.0108009353f, 0.405216932f},
-std::array<float,2>{0.922082007f, 0.0501893423f},
-std::array<float,2>{0.315258026f, 0.710579455f},
-std::array<float,2>{0.983945072f, 0.932253182f},
-std::array<float,2>{0.259384602f, 0.420810521f},
-std::array<float,2>{0.593140364f, 0.0253437478f},
-std::array<float,2>{0.084625788f, 0.720227301f},
-std::array<float,2>{0.698836923f, 0.609306872f},
-std::array<float,2>{0.215016678f, 0.230162203f},
-std::array<float,2>{0.777237713f, 0.259615719f},
-std::array<float,2>{0.389135301f, 0.869411826f},
-std::array<float,2>{0.857165933f, 0.628919899f},
-std::array<float,2>{0.440881371f, 0.0809884369f},
-std::array<float,2>{0.679652929f, 0.471286654f},
-std::array<float,2>{0.154715717f, 0.940897703f},
-std::array<float,2>{0.530677676f, 0.780563295f},
-std::array<float,2>{0.0441851579f, 0.325049579f},
-std::array<float,2>{0.897958815f, 0.166733801f},
-std::array<float,2>{0.347231179f, 0.53070879f},
-std::array<float,2>{0.786258459f, 0.832383692f},
-std::array<float,2>{0.427972794f, 0.29874891f},
-std::array<float,2>{0.721572936f, 0.209575742f},
-std::array<float,2>{0.249292538f, 0.579929948f},
-std::array<float,2>{0.600425065f, 0.714948535f},
-std::array<float,2>{0.104174845f, 0.0603152588f},
-std::array<float,2>{0.942505062f, 0.396493018f},
-std::array<float,2>{0.302176952f, 0.900212169f},
-std::array<float,2>{0.921728373f, 0.533008516f},
-std::array<float,2>{0.338000685f, 0.151595399f},
-std::array<float,2>{0.552673042f, 0.364759892f},
-std::array<float,2>{0.0233761463f, 0.794342816f},
-std::array<float,2>{0.627284586f, 0.982445717f},
-std::array<float,2>{0.159082144f, 0.452270538f},
-std::array<float,2>{0.827920198f, 0.104543477f},
-std::array<float,2>{0.485591531f, 0.661205947f},
-std::array<float,2>{0.843004823f, 0.956894398f},
-std::array<float,2>{0.474792331f, 0.488323539f},
-std::array<float,2>{0.641226709f, 0.0694743395f},
-std::array<float,2>{0.186764196f, 0.641091943f},
-std::array<float,2>{0.532234132f, 0.503802836f},
-std::array<float,2>{0.0143677089f, 0.173935249f},
-std::array<float,2>{0.928134501f, 0.335362345f},
-std::array<float,2>{0.318825275f, 0.754618883f},
-std::array<float,2>{0.965267301f, 0.738518834f},
-std::array<float,2>{0.295853943f, 0.00563255884f},
-std::array<float,2>{0.613298178f, 0.426988572f},
-std::array<float,2>{0.123427145f, 0.908668935f},
-std::array<float,2>{0.745926619f, 0.851451278f},
-std::array<float,2>{0.225135401f, 0.277968258f},
-std::array<float,2>{0.804498255f, 0.239110216f},
-std::array<float,2>{0.412827045f, 0.621828794f},
-std::array<float,2>{0.880447447f, 0.807137609f},
-std::array<float,2>{0.365784705f, 0.353927106f},
-std::array<float,2>{0.508395553f, 0.133969069f},
-std::array<float,2>{0.0567636415f, 0.552942276f},
-std::array<float,2>{0.661565304f, 0.678625286f},
-std::array<float,2>{0.126862809f, 0.123077072f},
-std::array<float,2>{0.863315165f, 0.466023207f},
-std::array<float,2>{0.468165487f, 0.996074438f},
-std::array<float,2>{0.753259778f, 0.564925969f},
-std::array<float,2>{0.403773874f, 0.196317971f},
-std::array<float,2>{0.711759567f, 0.28162095f},
-std::array<float,2>{0.189964071f, 0.822050452f},
-std::array<float,2>{0.576007307f, 0.889893949f},
-std::array<float,2>{0.0648058206f, 0.38979131f},
-std::array<float,2>{0.997772634f, 0.0320385508f},
-std::array<float,2>{0.273277193f, 0.691669166f},
-std::array<float,2>{0.936989307f, 0.988381207f},
-std::array<float,2>{0.324128151f, 0.457065672f},
-std::array<float,2>{0.546451032f, 0.114405572f},
-std::array<float,2>{0.00297366036f, 0.681668103f},
-std::array<float,2>{0.651522458f, 0.555477798f},
-std::array<float,2>{0.172872484f, 0.130870342f},
-std::array<float,2>{0.828230321f, 0.346431792f},
-std::array<float,2>{0.480665326f, 0.800373733f},
-std::array<float,2>{0.808126748f, 0.696167648f},
-std::array<float,2>{0.418867111f, 0.0432979539f},
-std::array<float,2>{0.734969318f, 0.378836781f},
-std::array<float,2>{0.228888676f, 0.877177596f},
-std::array<float,2>{0.619000196f, 0.814612687f},
-std::array<float,2>{0.115173608f, 0.290579319f},
-std::array<float,2>{0.958410025f, 0.192288831f},
-std::array<float,2>{0.287714958f, 0.573961318f},
-std::array<float,2>{0.874876201f, 0.759638309f},
-std::array<float,2>{0.459245265f, 0.339567721f},
-std::array<float,2>{0.666817665f, 0.184546605f},
-std::array<float,2>{0.134735316f, 0.508481383f},
-std::array<float,2>{0.503055155f, 0.654735088f},
-std::array<float,2>{0.0484572649f, 0.0768200755f},
-std::array<float,2>{0.886724412f, 0.499129802f},
-std::array<float,2>{0.372858018f, 0.963920116f},
-std::array<float,2>{0.99212271f, 0.614566803f},
-std::array<float,2>{0.277378976f, 0.247652218f},
-std::array<float,2>{0.568260014f, 0.272804528f},
-std::array<float,2>{0.0771991611f, 0.85449928f},
-std::array<float,2>{0.704120517f, 0.919531405f},
-std::array<float,2>{0.196575418f, 0.436371058f},
-std::array<float,2>{0.760245204f, 0.00972093455f},
-std::array<float,2>{0.39797765f, 0.744683325f},
-std::array<float,2>{0.770718634f, 0.894704223f},
-std::array<float,2>{0.381123692f, 0.401844889f},
-std::array<float,2>{0.69287616f, 0.0519194528f},
-std::array<float,2>{0.209292546f, 0.705858052f},
-std::array<float,2>{0.578921437f, 0.592344999f},
-std::array<float,2>{0.0904609561f, 0.211537421f},
-std::array<float,2>{0.969152451f, 0.310191959f},
-std::array<float,2>{0.253987163f, 0.840386987f},
-std::array<float,2>{0.90191257f, 0.665870488f},
-std::array<float,2>{0.352451831f, 0.0937786698f},
-std::array<float,2>{0.517493546f, 0.442656398f},
-std::array<float,2>{0.0349849612f, 0.971923411f},
-std::array<float,2>{0.681541443f, 0.78619498f},
-std::array<float,2>{0.147638768f, 0.374756634f},
-std::array<float,2>{0.847113192f, 0.141078472f},
-std::array<float,2>{0.44769004f, 0.542681754f},
-std::array<float,2>{0.952894866f, 0.864770293f},
-std::array<float,2>{0.30911693f, 0.255333722f},
-std::array<float,2>{0.609315157f, 0.219663292f},
-std::array<float,2>{0.0978069827f, 0.597263813f},
-std::array<float,2>{0.728560805f, 0.73067373f},
-std::array<float,2>{0.235410765f, 0.0191577673f},
-std::array<float,2>{0.790257633f, 0.412112445f},
-std::array<float,2>{0.433185339f, 0.92283392f},
-std::array<float,2>{0.819262505f, 0.520157039f},
-std::array<float,2>{0.49632135f, 0.16055274f},
-std::array<float,2>{0.637865424f, 0.313688934f},
-std::array<float,2>{0.164933518f, 0.766774178f},
-std::array<float,2>{0.557903171f, 0.946209788f},
-std::array<float,2>{0.0239306334f, 0.479593843f},
-std::array<float,2>{0.91309613f, 0.0905314237f},
-std::array<float,2>{0.333570808f, 0.638746321f},
-std::array<float,2>{0.956874728f, 0.941675842f},
-std::array<float,2>{0.282538593f, 0.476308793f},
-std::array<float,2>{0.623854101f, 0.0836266056f},
-std::array<float,2>{0.111372814f, 0.625169396f},
-std::array<float,2>{0.739079118f, 0.525641322f},
-std::array<float,2>{0.232976824f, 0.167994261f},
-std::array<float,2>{0.809741855f, 0.320964515f},
-std::array<float,2>{0.4179582f, 0.773443699f},
-std::array<float,2>{0.833348453f, 0.724827468f},
-std::array<float,2>{0.479777217f, 0.0305909086f},
-std::array<float,2>{0.653402567f, 0.417074621f},
-std::array<float,2>{0.178098604f, 0.936073601f},
-std::array<float,2>{0.539417505f, 0.871143281f},
-std::array<float,2>{0.00578094926f, 0.261911869f},
-std::array<float,2>{0.932638764f, 0.234205663f},
-std::array<float,2>{0.326724261f, 0.605440021f},
-std::array<float,2>{0.761775911f, 0.789594114f},
-std::array<float,2>{0.392490387f, 0.361723304f},
-std::array<float,2>{0.710851371f, 0.153375864f},
-std::array<float,2>{0.202980906f, 0.537976205f},
-std::array<float,2>{0.566016197f, 0.657897353f},
-std::array<float,2>{0.0710716471f, 0.109292991f},
-std::array<float,2>{0.987224042f, 0.44767502f},
-std::array<float,2>{0.27472952f, 0.977583706f},
-std::array<float,2>{0.884546041f, 0.584328711f},
-std::array<float,2>{0.368117094f, 0.206561714f},
-std::array<float,2>{0.506640434f, 0.300810844f},
-std::array<float,2>{0.0541768521f, 0.830316365f},
-std::array<float,2>{0.671218157f, 0.90280658f},
-std::array<float,2>{0.137798429f, 0.393649578f},
-std::array<float,2>{0.867589176f, 0.0573238097f},
-std::array<float,2>{0.453141272f, 0.71339339f},
-std::array<float,2>{0.851334453f, 0.910432458f},
-std::array<float,2>{0.451962918f, 0.425491959f},
-std::array<float,2>{0.684458256f, 0.00112127187f},
-std::array<float,2>{0.142578796f, 0.736629844f},
-std::array<float,2>{0.520272732f, 0.61896795f},
-std::array<float,2>{0.0370710678f, 0.234596908f},
-std::array<float,2>{0.905205429f, 0.275249392f},
-std::array<float,2>{0.355896056f, 0.847558379f},
-std::array<float,2>{0.972746909f, 0.647598684f},
-std::array<float,2>{0.252502382f, 0.0651831552f},
-std::array<float,2>{0.582912087f, 0.48550576f},
-std::array<float,2>{0.0883071572f, 0.95716697f},
-std::array<float,2>{0.69121927f, 0.750334442f},
-std::array<float,2>{0.206951857f, 0.328191578f},
-std::array<float,2>{0.767746329f, 0.17622681f},
-std::array<float,2>{0.375222921f, 0.504820466f},
-std::array<float,2>{0.908015668f, 0.826295614f},
-std::array<float,2>{0.3305628f, 0.287817836f},
-std::array<float,2>{0.55946362f, 0.201050416f},
-std::array<float,2>{0.0302655362f, 0.569624901f},
-std::array<float,2>{0.636604428f, 0.68918097f},
-std::array<float,2>{0.169054866f, 0.0357855149f},
-std::array<float,2>{0.814058363f, 0.384359121f},
-std::array<float,2>{0.492647022f, 0.884289861f},
-std::array<float,2>{0.795688212f, 0.548490286f},
-std::array<float,2>{0.435830861f, 0.136918157f},
-std::array<float,2>{0.731568336f, 0.356982559f},
-std::array<float,2>{0.238333657f, 0.811743259f},
-std::array<float,2>{0.605426967f, 0.996201634f},
-std::array<float,2>{0.0944511667f, 0.461409092f},
-std::array<float,2>{0.94553858f, 0.120832816f},
-std::array<float,2>{0.305352718f, 0.67232734f},
-std::array<float,2>{0.891693234f, 0.880271912f},
-std::array<float,2>{0.350851446f, 0.379426867f},
-std::array<float,2>{0.524416625f, 0.0412773602f},
-std::array<float,2>{0.040751677f, 0.699936271f},
-std::array<float,2>{0.675744534f, 0.574640393f},
-std::array<float,2>{0.152325824f, 0.189775109f},
-std::array<float,2>{0.852583945f, 0.295128226f},
-std::array<float,2>{0.443246752f, 0.817391455f},
-std::array<float,2>{0.778508961f, 0.685256183f},
-std::array<float,2>{0.382884622f, 0.110851452f},
-std::array<float,2>{0.699247003f, 0.456014812f},
-std::array<float,2>{0.210954577f, 0.987357497f},
-std::array<float,2>{0.589725077f, 0.801487505f},
-std::array<float,2>{0.0787374303f, 0.349999756f},
-std::array<float,2>{0.977377653f, 0.12772578f},
-std::array<float,2>{0.263215065f, 0.559066653f},
-std::array<float,2>{0.823977411f, 0.855708063f},
-std::array<float,2>{0.488316655f, 0.266090721f},
-std::array<float,2>{0.632207513f, 0.245324165f},
-std::array<float,2>{0.162585139f, 0.610318601f},
-std::array<float,2>{0.54963249f, 0.747860312f},
-std::array<float,2>{0.0166175812f, 0.0134034539f},
-std::array<float,2>{0.91628474f, 0.429827273f},
-std::array<float,2>{0.341088116f, 0.917356372f},
-std::array<float,2>{0.937936366f, 0.513401747f},
-std::array<float,2>{0.298858285f, 0.182250217f},
-std::array<float,2>{0.597470224f, 0.343609393f},
-std::array<float,2>{0.10844928f, 0.763818026f},
-std::array<float,2>{0.725065231f, 0.967315018f},
-std::array<float,2>{0.245130166f, 0.493033141f},
-std::array<float,2>{0.782166779f, 0.071281299f},
-std::array<float,2>{0.422160804f, 0.652133226f},
-std::array<float,2>{0.798962951f, 0.974142075f},
-std::array<float,2>{0.406404883f, 0.439850956f},
-std::array<float,2>{0.749769151f, 0.100447789f},
-std::array<float,2>{0.219753653f, 0.668783367f},
-std::array<float,2>{0.610401928f, 0.543208778f},
-std::array<float,2>{0.119835608f, 0.145709559f},
-std::array<float,2>{0.962548733f, 0.367620617f},
-std::array<float,2>{0.290534049f, 0.78508085f},
-std::array<float,2>{0.925077856f, 0.707229316f},
-std::array<float,2>{0.313090861f, 0.0469164588f},
-std::array<float,2>{0.539039016f, 0.404171675f},
-std::array<float,2>{0.00854721852f, 0.892086446f},
-std::array<float,2>{0.648207128f, 0.839768231f},
-std::array<float,2>{0.181060478f, 0.307675004f},
-std::array<float,2>{0.83909601f, 0.216023445f},
-std::array<float,2>{0.471695006f, 0.586627305f},
-std::array<float,2>{0.99445498f, 0.771824956f},
-std::array<float,2>{0.266026497f, 0.318085998f},
-std::array<float,2>{0.573732853f, 0.15734762f},
-std::array<float,2>{0.066730082f, 0.516762197f},
-std::array<float,2>{0.717606544f, 0.632969856f},
-std::array<float,2>{0.194631845f, 0.0886565149f},
-std::array<float,2>{0.756018281f, 0.481369883f},
-std::array<float,2>{0.401202083f, 0.951726496f},
-std::array<float,2>{0.861134171f, 0.598719895f},
-std::array<float,2>{0.464042932f, 0.224017546f},
-std::array<float,2>{0.657307088f, 0.25227505f},
-std::array<float,2>{0.129152253f, 0.862850964f},
-std::array<float,2>{0.514472425f, 0.926423073f},
-std::array<float,2>{0.0592586696f, 0.40678364f},
-std::array<float,2>{0.878256142f, 0.0210926402f},
-std::array<float,2>{0.362929881f, 0.727730989f},
-std::array<float,2>{0.969294369f, 0.897933722f},
-std::array<float,2>{0.254861534f, 0.399837524f},
-std::array<float,2>{0.578536749f, 0.0535754003f},
-std::array<float,2>{0.0899838209f, 0.703807294f},
-std::array<float,2>{0.692568481f, 0.590581179f},
-std::array<float,2>{0.209661275f, 0.2144894f},
-std::array<float,2>{0.771030545f, 0.311176687f},
-std::array<float,2>{0.381661981f, 0.843433857f},
-std::array<float,2>{0.847502887f, 0.666356742f},
-std::array<float,2>{0.448230863f, 0.0965262875f},
-std::array<float,2>{0.680729866f, 0.444449663f},
-std::array<float,2>{0.148324743f, 0.969202399f},
-std::array<float,2>{0.51680696f, 0.787432313f},
-std::array<float,2>{0.0342367887f, 0.372409582f},
-std::array<float,2>{0.901582599f, 0.142866015f},
-std::array<float,2>{0.352022499f, 0.540145397f},
-std::array<float,2>{0.790584326f, 0.865743697f},
-std::array<float,2>{0.432988137f, 0.256605595f},
-std::array<float,2>{0.729153812f, 0.222468421f},
-std::array<float,2>{0.23594138f, 0.594240308f},
-std::array<float,2>{0.608619153f, 0.732674658f},
-std::array<float,2>{0.0983442664f, 0.0165090114f},
-std::array<float,2>{0.952535272f, 0.410258204f},
-std::array<float,2>{0.30866611f, 0.925735116f},
-std::array<float,2>{0.913632035f, 0.522699296f},
-std::array<float,2>{0.333276331f, 0.162607074f},
-std::array<float,2>{0.558311522f, 0.315944552f},
-std::array<float,2>{0.0239131078f, 0.768520832f},
-std::array<float,2>{0.638216853f, 0.947415888f},
-std::array<float,2>{0.164451301f, 0.478155255f},
-std::array<float,2>{0.818528414f, 0.0929209515f},
-std::array<float,2>{0.497052789f, 0.637606382f},
-std::array<float,2>{0.828956246f, 0.991932273f},
-std::array<float,2>{0.481295079f, 0.459378719f},
-std::array<float,2>{0.652062356f, 0.115390576f},
-std::array<float,2>{0.17369011f, 0.679971814f},
-std::array<float,2>{0.546228826f, 0.557147622f},
-std::array<float,2>{0.00379596278f, 0.129408434f},
-std::array<float,2>{0.93725276f, 0.345061302f},
-std::array<float,2>{0.323253274f, 0.796963334f},
-std::array<float,2>{0.958877206f, 0.699017644f},
-std::array<float,2>{0.28747046f, 0.0451242849f},
-std::array<float,2>{0.618396282f, 0.375587434f},
-std::array<float,2>{0.114259385f, 0.876643836f},
-std::array<float,2>{0.734472275f, 0.814286649f},
-std::array<float,2>{0.229274824f, 0.291400284f},
-std::array<float,2>{0.8078264f, 0.195150942f},
-std::array<float,2>{0.41807431f, 0.571798623f},
-std::array<float,2>{0.887341619f, 0.760540187f},
-std::array<float,2>{0.372518629f, 0.337013781f},
-std::array<float,2>{0.503560483f, 0.186265767f},
-std::array<float,2>{0.0483192801f, 0.510473728f},
-std::array<float,2>{0.666291833f, 0.652443349f},
-std::array<float,2>{0.133853242f, 0.0759986341f},
-std::array<float,2>{0.87437588f, 0.497755617f},
-std::array<float,2>{0.459602773f, 0.961519063f},
-std::array<float,2>{0.760312378f, 0.616286635f},
-std::array<float,2>{0.397909701f, 0.249854818f},
-std::array<float,2>{0.70476836f, 0.269702941f},
-std::array<float,2>{0.197118402f, 0.851957202f},
-std::array<float,2>{0.567835927f, 0.921657383f},
-std::array<float,2>{0.0776396096f, 0.435382664f},
-std::array<float,2>{0.99167496f, 0.0103820963f},
-std::array<float,2>{0.278080106f, 0.743473947f},
-std::array<float,2>{0.928522944f, 0.953831613f},
-std::array<float,2>{0.318967521f, 0.490783185f},
-std::array<float,2>{0.532862723f, 0.0664691851f},
-std::array<float,2>{0.0140885413f, 0.644453228f},
-std::array<float,2>{0.641027212f, 0.501329541f},
-std::array<float,2>{0.187165678f, 0.173617303f},
-std::array<float,2>{0.843397141f, 0.332723975f},
-std::array<float,2>{0.475318581f, 0.757487535f},
-std::array<float,2>{0.803970933f, 0.740983963f},
-std::array<float,2>{0.412228584f, 0.0066153896f},
-std::array<float,2>{0.74546355f, 0.429222733f},
-std::array<float,2>{0.224839821f, 0.907789767f},
-std::array<float,2>{0.614188135f, 0.849398196f},
-std::array<float,2>{0.123703197f, 0.28004092f},
-std::array<float,2>{0.96581018f, 0.241512984f},
-std::array<float,2>{0.295196801f, 0.624780416f},
-std::array<float,2>{0.863878191f, 0.806637108f},
-std::array<float,2>{0.468510509f, 0.352131069f},
-std::array<float,2>{0.66170454f, 0.135830089f},
-std::array<float,2>{0.126009896f, 0.5509938f},
-std::array<float,2>{0.507960677f, 0.676730692f},
-std::array<float,2>{0.0572636016f, 0.12303292f},
-std::array<float,2>{0.880287349f, 0.467532754f},
-std::array<float,2>{0.365573257f, 0.993852258f},
-std::array<float,2>{0.997514367f, 0.563266337f},
-std::array<float,2>{0.272589475f, 0.199072793f},
-std::array<float,2>{0.575605333f, 0.284803331f},
-std::array<float,2>{0.0651214868f, 0.822932303f},
-std::array<float,2>{0.710994601f, 0.886830389f},
-std::array<float,2>{0.189651459f, 0.387205809f},
-std::array<float,2>{0.753654897f, 0.034097854f},
-std::array<float,2>{0.404059857f, 0.694857478f},
-std::array<float,2>{0.776646078f, 0.930167615f},
-std::array<float,2>{0.389477193f, 0.418387502f},
-std::array<float,2>{0.69831121f, 0.0259568114f},
-std::array<float,2>{0.215495631f, 0.721448958f},
-std::array<float,2>{0.593526185f, 0.606459558f},
-std::array<float,2>{0.0840466544f, 0.227356195f},
-std::array<float,2>{0.983687699f, 0.260659009f},
-std::array<float,2>{0.259177417f, 0.86722964f},
-std::array<float,2>{0.89747411f, 0.631085336f},
-std::array<float,2>{0.347021729f, 0.0787642747f},
-std::array<float,2>{0.530764699f, 0.470189989f},
-std::array<float,2>{0.0445409715f, 0.938415647f},
-std::array<float,2>{0.678996682f, 0.779134452f},
-std::array<float,2>{0.154903159f, 0.326717168f},
-std::array<float,2>{0.856476486f, 0.164288625f},
-std::array<float,2>{0.441122472f, 0.527500212f},
-std::array<float,2>{0.943297625f, 0.835262597f},
-std::array<float,2>{0.30243811f, 0.299594134f},
-std::array<float,2>{0.599988818f, 0.207196623f},
-std::array<float,2>{0.103566907f, 0.580792069f},
-std::array<float,2>{0.720815599f, 0.717769802f},
-std::array<float,2>{0.249952346f, 0.0620967448f},
-std::array<float,2>{0.787035644f, 0.395405501f},
-std::array<float,2>{0.428387105f, 0.901161849f},
-std::array<float,2>{0.827214003f, 0.533668876f},
-std::array<float,2>{0.486066431f, 0.149278387f},
-std::array<float,2>{0.627654672f, 0.365557313f},
-std::array<float,2>{0.158661857f, 0.795079112f},
-std::array<float,2>{0.552227378f, 0.980842173f},
-std::array<float,2>{0.0228617769f, 0.44927004f},
-std::array<float,2>{0.921085775f, 0.10197667f},
-std::array<float,2>{0.338648379f, 0.66351378f},
-std::array<float,2>{0.96205008f, 0.975649953f},
-std::array<float,2>{0.290363699f, 0.437811643f},
-std::array<float,2>{0.611270726f, 0.0981733873f},
-std::array<float,2>{0.119531944f, 0.670676589f},
-std::array<float,2>{0.749185205f, 0.546753705f},
-std::array<float,2>{0.220309317f, 0.146531343f},
-std::array<float,2>{0.799774468f, 0.369813621f},
-std::array<float,2>{0.406860411f, 0.782853365f},
-std::array<float,2>{0.83953321f, 0.710320354f},
-std::array<float,2>{0.472241372f, 0.0503483564f},
-std::array<float,2>{0.647571445f, 0.404382408f},
-std::array<float,2>{0.181295961f, 0.892789364f},
-std::array<float,2>{0.538471162f, 0.83667165f},
-std::array<float,2>{0.00804151967f, 0.305408031f},
-std::array<float,2>{0.925525606f, 0.217909947f},
-std::array<float,2>{0.3125664f, 0.589675844f},
-std::array<float,2>{0.756498396f, 0.770480692f},
-std::array<float,2>{0.400854141f, 0.319210082f},
-std::array<float,2>{0.716833293f, 0.158294559f},
-std::array<float,2>{0.19503583f, 0.518015265f},
-std::array<float,2>{0.573388577f, 0.636209667f},
-std::array<float,2>{0.0672381073f, 0.0878190324f},
-std::array<float,2>{0.994921207f, 0.4840087f},
-std::array<float,2>{0.26628381f, 0.950420797f},
-std::array<float,2>{0.878695071f, 0.601157486f},
-std::array<float,2>{0.36270541f, 0.226115271f},
-std::array<float,2>{0.513786912f, 0.250256747f},
-std::array<float,2>{0.0587049723f, 0.860079467f},
-std::array<float,2>{0.657768071f, 0.92905283f},
-std::array<float,2>{0.129408956f, 0.408659339f},
-std::array<float,2>{0.860657454f, 0.022701472f},
-std::array<float,2>{0.464823216f, 0.728737652f},
-std::array<float,2>{0.853447199f, 0.882636487f},
-std::array<float,2>{0.442506313f, 0.382717967f},
-std::array<float,2>{0.675029218f, 0.0394655317f},
-std::array<float,2>{0.15179719f, 0.701484561f},
-std::array<float,2>{0.525059044f, 0.57800585f},
-std::array<float,2>{0.0402283333f, 0.189195052f},
-std::array<float,2>{0.892238855f, 0.294692576f},
-std::array<float,2>{0.351266116f, 0.819256902f},
-std::array<float,2>{0.976925433f, 0.687191606f},
-std::array<float,2>{0.263048857f, 0.112088837f},
-std::array<float,2>{0.588973105f, 0.454277247f},
-std::array<float,2>{0.0781898201f, 0.985081255f},
-std::array<float,2>{0.700166821f, 0.80305618f},
-std::array<float,2>{0.211582899f, 0.348644018f},
-std::array<float,2>{0.779112995f, 0.125614211f},
-std::array<float,2>{0.383339584f, 0.561465859f},
-std::array<float,2>{0.916582882f, 0.857500494f},
-std::array<float,2>{0.341634214f, 0.267866731f},
-std::array<float,2>{0.549061775f, 0.242468059f},
-std::array<float,2>{0.0173106845f, 0.611883581f},
-std::array<float,2>{0.632681906f, 0.749812484f},
-std::array<float,2>{0.162947014f, 0.0149443625f},
-std::array<float,2>{0.823720813f, 0.43246156f},
-std::array<float,2>{0.489110768f, 0.914589822f},
-std::array<float,2>{0.781270802f, 0.513868093f},
-std::array<float,2>{0.422418058f, 0.180938631f},
-std::array<float,2>{0.725454092f, 0.340384215f},
-std::array<float,2>{0.24574104f, 0.761895001f},
-std::array<float,2>{0.597011685f, 0.966732979f},
-std::array<float,2>{0.109120287f, 0.494514465f},
-std::array<float,2>{0.938373446f, 0.0738067329f},
-std::array<float,2>{0.299508125f, 0.648620546f},
-std::array<float,2>{0.904415309f, 0.91398865f},
-std::array<float,2>{0.356057554f, 0.422767639f},
-std::array<float,2>{0.519934416f, 0.00281741656f},
-std::array<float,2>{0.0364219919f, 0.735258639f},
-std::array<float,2>{0.683630705f, 0.620067716f},
-std::array<float,2>{0.143331856f, 0.237272516f},
-std::array<float,2>{0.850625336f, 0.27715829f},
-std::array<float,2>{0.451604545f, 0.844968319f},
-std::array<float,2>{0.768072546f, 0.646251976f},
-std::array<float,2>{0.375964284f, 0.0641963631f},
-std::array<float,2>{0.690618098f, 0.487594366f},
-std::array<float,2>{0.206236243f, 0.96049279f},
-std::array<float,2>{0.582260609f, 0.752528787f},
-std::array<float,2>{0.0885285735f, 0.330496341f},
-std::array<float,2>{0.97332257f, 0.177934945f},
-std::array<float,2>{0.252049416f, 0.507792234f},
-std::array<float,2>{0.813771725f, 0.8252514f},
-std::array<float,2>{0.492738634f, 0.285236895f},
-std::array<float,2>{0.636166275f, 0.20234625f},
-std::array<float,2>{0.169800192f, 0.566759884f},
-std::array<float,2>{0.558770537f, 0.691200256f},
-std::array<float,2>{0.0297356788f, 0.0374409407f},
-std::array<float,2>{0.907620251f, 0.385619223f},
-std::array<float,2>{0.330631465f, 0.885755777f},
-std::array<float,2>{0.945959866f, 0.548847377f},
-std::array<float,2>{0.304903507f, 0.139812425f},
-std::array<float,2>{0.604908705f, 0.357928008f},
-std::array<float,2>{0.0938085169f, 0.809970617f},
-std::array<float,2>{0.732158065f, 0.998183548f},
-std::array<float,2>{0.238855124f, 0.464222789f},
-std::array<float,2>{0.795288324f, 0.117535599f},
-std::array<float,2>{0.436510772f, 0.675686836f},
-std::array<float,2>{0.810402811f, 0.94465673f},
-std::array<float,2>{0.417470157f, 0.472947955f},
-std::array<float,2>{0.738326609f, 0.0850036293f},
-std::array<float,2>{0.232460335f, 0.627128601f},
-std::array<float,2>{0.623485863f, 0.524410367f},
-std::array<float,2>{0.112259328f, 0.170048863f},
-std::array<float,2>{0.956524611f, 0.322582066f},
-std::array<float,2>{0.282950401f, 0.77551806f},
-std::array<float,2>{0.933111966f, 0.723085999f},
-std::array<float,2>{0.326250345f, 0.0292760357f},
-std::array<float,2>{0.539766371f, 0.415077835f},
-std::array<float,2>{0.00491902418f, 0.935397208f},
-std::array<float,2>{0.654263914f, 0.874056756f},
-std::array<float,2>{0.178322956f, 0.264439613f},
-std::array<float,2>{0.833870292f, 0.230647877f},
-std::array<float,2>{0.480042189f, 0.601712048f},
-std::array<float,2>{0.986455441f, 0.791655302f},
-std::array<float,2>{0.275134027f, 0.360967845f},
-std::array<float,2>{0.565797329f, 0.155140474f},
-std::array<float,2>{0.0703445002f, 0.536335289f},
-std::array<float,2>{0.710105062f, 0.65822202f},
-std::array<float,2>{0.202427343f, 0.106140174f},
-std::array<float,2>{0.762605071f, 0.445969462f},
-std::array<float,2>{0.391628802f, 0.979978383f},
-std::array<float,2>{0.868115783f, 0.582344711f},
-std::array<float,2>{0.45386982f, 0.203267738f},
-std::array<float,2>{0.671557784f, 0.303236872f},
-std::array<float,2>{0.138469756f, 0.829672337f},
-std::array<float,2>{0.506089747f, 0.904890656f},
-std::array<float,2>{0.0543323159f, 0.390799552f},
-std::array<float,2>{0.884079456f, 0.0561916679f},
-std::array<float,2>{0.367622435f, 0.712853491f},
-std::array<float,2>{0.949875057f, 0.922313213f},
-std::array<float,2>{0.310572565f, 0.412777305f},
-std::array<float,2>{0.605796337f, 0.0187213738f},
-std::array<float,2>{0.100647464f, 0.731442392f},
-std::array<float,2>{0.727176487f, 0.596898437f},
-std::array<float,2>{0.23782672f, 0.219040886f},
-std::array<float,2>{0.791978955f, 0.25564909f},
-std::array<float,2>{0.429806232f, 0.864425659f},
-std::array<float,2>{0.818018973f, 0.639535606f},
-std::array<float,2>{0.498856336f, 0.0902257264f},
-std::array<float,2>{0.639616728f, 0.480228543f},
-std::array<float,2>{0.166322291f, 0.945576251f},
-std::array<float,2>{0.556109667f, 0.767347336f},
-std::array<float,2>{0.0255746804f, 0.31418094f},
-std::array<float,2>{0.910243809f, 0.161126077f},
-std::array<float,2>{0.334229767f, 0.519778609f},
-std::array<float,2>{0.772434056f, 0.840214968f},
-std::array<float,2>{0.379417181f, 0.310017496f},
-std::array<float,2>{0.693684816f, 0.211128026f},
-std::array<float,2>{0.20705986f, 0.591898143f},
-std::array<float,2>{0.58191514f, 0.705359757f},
-std::array<float,2>{0.0921046436f, 0.0524461456f},
-std::array<float,2>{0.971642792f, 0.402063429f},
-std::array<float,2>{0.256328881f, 0.895136058f},
-std::array<float,2>{0.90004319f, 0.542441547f},
-std::array<float,2>{0.355132133f, 0.141493544f},
-std::array<float,2>{0.51779145f, 0.374116957f},
-std::array<float,2>{0.0313786604f, 0.787000656f},
-std::array<float,2>{0.683033049f, 0.972634435f},
-std::array<float,2>{0.146306083f, 0.442918301f},
-std::array<float,2>{0.845156074f, 0.0942431465f},
-std::array<float,2>{0.445911139f, 0.66548413f},
-std::array<float,2>{0.87246424f, 0.964561224f},
-std::array<float,2>{0.458495259f, 0.499688566f},
-std::array<float,2>{0.665707648f, 0.0765816346f},
-std::array<float,2>{0.134800002f, 0.655010819f},
-std::array<float,2>{0.50100559f, 0.508048594f},
-std::array<float,2>{0.0506135672f, 0.183785334f},
-std::array<float,2>{0.890571773f, 0.339336693f},
-std::array<float,2>{0.374738604f, 0.758930385f},
-std::array<float,2>{0.989236474f, 0.74429214f},
-std::array<float,2>{0.281046599f, 0.00913927797f},
-std::array<float,2>{0.570168734f, 0.435937673f},
-std::array<float,2>{0.0752322748f, 0.919026852f},
-std::array<float,2>{0.706798196f, 0.855012834f},
-std::array<float,2>{0.198833242f, 0.273334056f},
-std::array<float,2>{0.759308159f, 0.247130737f},
-std::array<float,2>{0.394988745f, 0.61481899f},
-std::array<float,2>{0.934951961f, 0.799978852f},
-std::array<float,2>{0.321685344f, 0.345857531f},
-std::array<float,2>{0.543385744f, 0.131691366f},
-std::array<float,2>{0.000827919343f, 0.554878235f},
-std::array<float,2>{0.650122046f, 0.68250984f},
-std::array<float,2>{0.174077764f, 0.114786424f},
-std::array<float,2>{0.831326246f, 0.457540065f},
-std::array<float,2>{0.483665019f, 0.988901258f},
-std::array<float,2>{0.806505024f, 0.573602676f},
-std::array<float,2>{0.421296507f, 0.191408172f},
-std::array<float,2>{0.738047481f, 0.290240467f},
-std::array<float,2>{0.22787267f, 0.815410078f},
-std::array<float,2>{0.620879412f, 0.877722442f},
-std::array<float,2>{0.116511241f, 0.37838909f},
-std::array<float,2>{0.959111691f, 0.0436614193f},
-std::array<float,2>{0.286310643f, 0.695323229f},
-std::array<float,2>{0.881722748f, 0.995473385f},
-std::array<float,2>{0.364104003f, 0.466684818f},
-std::array<float,2>{0.510436952f, 0.123997115f},
-std::array<float,2>{0.0550180115f, 0.678083956f},
-std::array<float,2>{0.662259281f, 0.553672552f},
-std::array<float,2>{0.127772048f, 0.134727493f},
-std::array<float,2>{0.865748048f, 0.354032993f},
-std::array<float,2>{0.465052575f, 0.806884944f},
-std::array<float,2>{0.750216782f, 0.691919744f},
-std::array<float,2>{0.404607862f, 0.0316925645f},
-std::array<float,2>{0.713020504f, 0.390145093f},
-std::array<float,2>{0.188395381f, 0.890580475f},
-std::array<float,2>{0.576577723f, 0.821522057f},
-std::array<float,2>{0.064139232f, 0.282087266f},
-std::array<float,2>{0.99998033f, 0.196964994f},
-std::array<float,2>{0.270655245f, 0.565381885f},
-std::array<float,2>{0.841706097f, 0.754222929f},
-std::array<float,2>{0.472787529f, 0.335666001f},
-std::array<float,2>{0.643512249f, 0.174553454f},
-std::array<float,2>{0.184496939f, 0.503204167f},
-std::array<float,2>{0.53478229f, 0.641274571f},
-std::array<float,2>{0.0136087649f, 0.0703010261f},
-std::array<float,2>{0.927506268f, 0.489174664f},
-std::array<float,2>{0.316544354f, 0.956514835f},
-std::array<float,2>{0.968362987f, 0.621243656f},
-std::array<float,2>{0.294158816f, 0.238617331f},
-std::array<float,2>{0.615815103f, 0.277627915f},
-std::array<float,2>{0.12110845f, 0.850664318f},
-std::array<float,2>{0.743656278f, 0.908977628f},
-std::array<float,2>{0.223095268f, 0.427289575f},
-std::array<float,2>{0.801811397f, 0.00490293326f},
-std::array<float,2>{0.412071496f, 0.739038587f},
-std::array<float,2>{0.788264036f, 0.899490356f},
-std::array<float,2>{0.426086307f, 0.397252917f},
-std::array<float,2>{0.719737232f, 0.0597671345f},
-std::array<float,2>{0.247531384f, 0.715530336f},
-std::array<float,2>{0.598524749f, 0.57942307f},
-std::array<float,2>{0.103372462f, 0.209108338f},
-std::array<float,2>{0.944081426f, 0.298279941f},
-std::array<float,2>{0.303286642f, 0.832721472f},
-std::array<float,2>{0.918522418f, 0.661987305f},
-std::array<float,2>{0.335987926f, 0.105103828f},
-std::array<float,2>{0.554011583f, 0.452920914f},
-std::array<float,2>{0.0213044696f, 0.983285069f},
-std::array<float,2>{0.626900673f, 0.79457581f},
-std::array<float,2>{0.156251565f, 0.36465472f},
-std::array<float,2>{0.824736834f, 0.152180865f},
-std::array<float,2>{0.48646608f, 0.532525957f},
-std::array<float,2>{0.98105073f, 0.869968414f},
-std::array<float,2>{0.260701209f, 0.25923115f},
-std::array<float,2>{0.590518773f, 0.229578659f},
-std::array<float,2>{0.0836529359f, 0.608715832f},
-std::array<float,2>{0.696761608f, 0.720165253f},
-std::array<float,2>{0.217387795f, 0.02461146f},
-std::array<float,2>{0.773671627f, 0.420119911f},
-std::array<float,2>{0.387338907f, 0.931849897f},
-std::array<float,2>{0.85795176f, 0.531035662f},
-std::array<float,2>{0.438099861f, 0.166487604f},
-std::array<float,2>{0.67724514f, 0.324499398f},
-std::array<float,2>{0.154072747f, 0.780810118f},
-std::array<float,2>{0.528464675f, 0.941102922f},
-std::array<float,2>{0.0459608324f, 0.470845252f},
-std::array<float,2>{0.896403551f, 0.0805246532f},
-std::array<float,2>{0.344827622f, 0.629667401f},
-std::array<float,2>{0.992797494f, 0.951657712f},
-std::array<float,2>{0.268127829f, 0.480769187f},
-std::array<float,2>{0.571585536f, 0.0883522034f},
-std::array<float,2>{0.069006145f, 0.633527815f},
-std::array<float,2>{0.71661824f, 0.517450154f},
-std::array<float,2>{0.192036748f, 0.157992393f},
-std::array<float,2>{0.755805492f, 0.317474484f},
-std::array<float,2>{0.398540825f, 0.772421479f},
-std::array<float,2>{0.861587465f, 0.728389263f},
-std::array<float,2>{0.461973667f, 0.0206688717f},
-std::array<float,2>{0.660017908f, 0.406466693f},
-std::array<float,2>{0.130892515f, 0.926145434f},
-std::array<float,2>{0.513635099f, 0.862449229f},
-std::array<float,2>{0.0610200316f, 0.252564162f},
-std::array<float,2>{0.876698554f, 0.224416092f},
-std::array<float,2>{0.359890401f, 0.599394381f},
-std::array<float,2>{0.797637582f, 0.784552455f},
-std::array<float,2>{0.409302354f, 0.36789605f},
-std::array<float,2>{0.747001112f, 0.146022335f},
-std::array<float,2>{0.222109705f, 0.543944955f},
-std::array<float,2>{0.613234162f, 0.668420494f},
-std::array<float,2>{0.118895963f, 0.0996569246f},
-std::array<float,2>{0.964409232f, 0.440330893f},
-std::array<float,2>{0.291532695f, 0.973852336f},
-std::array<float,2>{0.922449708f, 0.586402833f},
-std::array<float,2>{0.314765841f, 0.216525018f},
-std::array<float,2>{0.535710931f, 0.308567822f},
-std::array<float,2>{0.0115684243f, 0.839256465f},
-std::array<float,2>{0.645231128f, 0.892190039f},
-std::array<float,2>{0.182938069f, 0.403415501f},
-std::array<float,2>{0.837103367f, 0.0474775806f},
-std::array<float,2>{0.469896764f, 0.707873464f},
-std::array<float,2>{0.821602881f, 0.917923748f},
-std::array<float,2>{0.491042703f, 0.430537909f},
-std::array<float,2>{0.630505025f, 0.0130093833f},
-std::array<float,2>{0.161659986f, 0.7470963f},
-std::array<float,2>{0.548385084f, 0.609717786f},
-std::array<float,2>{0.0176859684f, 0.246001303f},
-std::array<float,2>{0.914102674f, 0.266239196f},
-std::array<float,2>{0.343606442f, 0.85596925f},
-std::array<float,2>{0.940441489f, 0.651686132f},
-std::array<float,2>{0.296995193f, 0.0704599991f},
-std::array<float,2>{0.594420016f, 0.492278695f},
-std::array<float,2>{0.105885915f, 0.967040598f},
-std::array<float,2>{0.723175228f, 0.764344037f},
-std::array<float,2>{0.24227412f, 0.343061984f},
-std::array<float,2>{0.784940779f, 0.181784585f},
-std::array<float,2>{0.425262958f, 0.513106883f},
-std::array<float,2>{0.893889606f, 0.818277597f},
-std::array<float,2>{0.34886685f, 0.295534492f},
-std::array<float,2>{0.526789427f, 0.190041557f},
-std::array<float,2>{0.0420381501f, 0.574857354f},
-std::array<float,2>{0.673658013f, 0.699570775f},
-std::array<float,2>{0.148916706f, 0.0419181362f},
-std::array<float,2>{0.85382086f, 0.379173398f},
-std::array<float,2>{0.443653405f, 0.880792797f},
-std::array<float,2>{0.781246722f, 0.559453964f},
-std::array<float,2>{0.385899305f, 0.12709932f},
-std::array<float,2>{0.70158726f, 0.350447565f},
-std::array<float,2>{0.214342996f, 0.801024199f},
-std::array<float,2>{0.586830676f, 0.98783195f},
-std::array<float,2>{0.0815955102f, 0.455298424f},
-std::array<float,2>{0.979087532f, 0.110611975f},
-std::array<float,2>{0.265439957f, 0.684750021f},
-std::array<float,2>{0.90853858f, 0.884150326f},
-std::array<float,2>{0.329792321f, 0.384020984f},
-std::array<float,2>{0.560829818f, 0.0356136337f},
-std::array<float,2>{0.0281615295f, 0.68888396f},
-std::array<float,2>{0.634615242f, 0.569847524f},
-std::array<float,2>{0.170271724f, 0.200501367f},
-std::array<float,2>{0.815671623f, 0.28722617f},
-std::array<float,2>{0.494810671f, 0.82706666f},
-std::array<float,2>{0.793060184f, 0.672432423f},
-std::array<float,2>{0.435164005f, 0.120442174f},
-std::array<float,2>{0.733488858f, 0.461657822f},
-std::array<float,2>{0.240449458f, 0.996977448f},
-std::array<float,2>{0.601699769f, 0.81245178f},
-std::array<float,2>{0.0972956195f, 0.356903285f},
-std::array<float,2>{0.948093116f, 0.137418434f},
-std::array<float,2>{0.308102638f, 0.547994673f},
-std::array<float,2>{0.849476516f, 0.84681958f},
-std::array<float,2>{0.45078361f, 0.274457961f},
-std::array<float,2>{0.686757982f, 0.235325083f},
-std::array<float,2>{0.142478973f, 0.618255198f},
-std::array<float,2>{0.523324609f, 0.737264156f},
-std::array<float,2>{0.0383091681f, 0.00153939228f},
-std::array<float,2>{0.904074132f, 0.424961001f},
-std::array<float,2>{0.357895285f, 0.910890818f},
-std::array<float,2>{0.974922776f, 0.503948271f},
-std::array<float,2>{0.250373632f, 0.176329598f},
-std::array<float,2>{0.584334552f, 0.328733176f},
-std::array<float,2>{0.0860471278f, 0.750719726f},
-std::array<float,2>{0.687661588f, 0.957937777f},
-std::array<float,2>{0.20491685f, 0.485984027f},
-std::array<float,2>{0.767499328f, 0.0649240986f},
-std::array<float,2>{0.378470749f, 0.648084342f},
-std::array<float,2>{0.764341652f, 0.978329837f},
-std::array<float,2>{0.392780393f, 0.447870463f},
-std::array<float,2>{0.707984805f, 0.108727448f},
-std::array<float,2>{0.199572802f, 0.657635331f},
-std::array<float,2>{0.563996851f, 0.537155688f},
-std::array<float,2>{0.072997421f, 0.154180557f},
-std::array<float,2>{0.985819399f, 0.361850291f},
-std::array<float,2>{0.275437355f, 0.789095581f},
-std::array<float,2>{0.886392117f, 0.712957144f},
-std::array<float,2>{0.369799376f, 0.0568192862f},
-std::array<float,2>{0.50476867f, 0.394477457f},
-std::array<float,2>{0.0511488467f, 0.90312314f},
-std::array<float,2>{0.668145478f, 0.831042409f},
-std::array<float,2>{0.139223322f, 0.301581621f},
-std::array<float,2>{0.869174421f, 0.206057549f},
-std::array<float,2>{0.456950694f, 0.584777892f},
-std::array<float,2>{0.953945756f, 0.774360299f},
-std::array<float,2>{0.283496827f, 0.320743352f},
-std::array<float,2>{0.622866631f, 0.168660879f},
-std::array<float,2>{0.110518128f, 0.526194036f},
-std::array<float,2>{0.742079377f, 0.625951707f},
-std::array<float,2>{0.231749386f, 0.0830109939f},
-std::array<float,2>{0.810571015f, 0.475586206f},
-std::array<float,2>{0.415019572f, 0.94204849f},
-std::array<float,2>{0.834198117f, 0.604896784f},
-std::array<float,2>{0.478279948f, 0.233768329f},
-std::array<float,2>{0.654627919f, 0.262298256f},
-std::array<float,2>{0.177501947f, 0.871963799f},
-std::array<float,2>{0.542006254f, 0.936025202f},
-std::array<float,2>{0.00765389251f, 0.417661875f},
-std::array<float,2>{0.930074513f, 0.0308452472f},
-std::array<float,2>{0.324334055f, 0.725572348f},
-std::array<float,2>{0.960203171f, 0.875722587f},
-std::array<float,2>{0.285658658f, 0.376654565f},
-std::array<float,2>{0.620013535f, 0.046837613f},
-std::array<float,2>{0.115701362f, 0.698115051f},
-std::array<float,2>{0.736851633f, 0.570750773f},
-std::array<float,2>{0.226995394f, 0.194019333f},
-std::array<float,2>{0.805611193f, 0.292246193f},
-std::array<float,2>{0.42062965f, 0.812719822f},
-std::array<float,2>{0.830352128f, 0.681298375f},
-std::array<float,2>{0.482748866f, 0.116238691f},
-std::array<float,2>{0.649392605f, 0.460611224f},
-std::array<float,2>{0.175092608f, 0.990671575f},
-std::array<float,2>{0.544059157f, 0.798045456f},
-std::array<float,2>{0.00130803511f, 0.344019532f},
-std::array<float,2>{0.933670521f, 0.130269349f},
-std::array<float,2>{0.320985794f, 0.557888508f},
-std::array<float,2>{0.758564115f, 0.852903903f},
-std::array<float,2>{0.395957649f, 0.271421313f},
-std::array<float,2>{0.705826521f, 0.248109117f},
-std::array<float,2>{0.197651342f, 0.615643382f},
-std::array<float,2>{0.568888843f, 0.743053675f},
-std::array<float,2>{0.0749963149f, 0.0109986532f},
-std::array<float,2>{0.989701688f, 0.434239477f},
-std::array<float,2>{0.279991299f, 0.920356214f},
-std::array<float,2>{0.888846159f, 0.511523962f},
-std::array<float,2>{0.373943835f, 0.187152177f},
-std::array<float,2>{0.500169814f, 0.336275876f},
-std::array<float,2>{0.0497749895f, 0.761568606f},
-std::array<float,2>{0.664781451f, 0.962475598f},
-std::array<float,2>{0.136700019f, 0.496367306f},
-std::array<float,2>{0.871944726f, 0.0742794499f},
-std::array<float,2>{0.457181454f, 0.654217839f},
-std::array<float,2>{0.844299257f, 0.969941497f},
-std::array<float,2>{0.447154731f, 0.443713069f},
-std::array<float,2>{0.682587445f, 0.0971228629f},
-std::array<float,2>{0.145494282f, 0.667715251f},
-std::array<float,2>{0.519420028f, 0.540035605f},
-std::array<float,2>{0.0330442265f, 0.143792897f},
-std::array<float,2>{0.898910284f, 0.371844321f},
-std::array<float,2>{0.354271472f, 0.788666368f},
-std::array<float,2>{0.972311378f, 0.70501411f},
-std::array<float,2>{0.257100195f, 0.0543454103f},
-std::array<float,2>{0.580861688f, 0.398504108f},
-std::array<float,2>{0.0930915698f, 0.896601319f},
-std::array<float,2>{0.694740951f, 0.842200935f},
-std::array<float,2>{0.208326042f, 0.312377572f},
-std::array<float,2>{0.772601902f, 0.213458911f},
-std::array<float,2>{0.380090952f, 0.591185749f},
-std::array<float,2>{0.912057638f, 0.769424021f},
-std::array<float,2>{0.335281968f, 0.315234274f},
-std::array<float,2>{0.555324137f, 0.163588196f},
-std::array<float,2>{0.0265020709f, 0.522247672f},
-std::array<float,2>{0.640547395f, 0.637770176f},
-std::array<float,2>{0.167508483f, 0.0926880389f},
-std::array<float,2>{0.81737268f, 0.476772934f},
-std::array<float,2>{0.499160796f, 0.948828876f},
-std::array<float,2>{0.792932212f, 0.594766378f},
-std::array<float,2>{0.430908889f, 0.221149042f},
-std::array<float,2>{0.727874517f, 0.2569426f},
-std::array<float,2>{0.237044603f, 0.86645627f},
-std::array<float,2>{0.60646832f, 0.924265027f},
-std::array<float,2>{0.0998356268f, 0.411264569f},
-std::array<float,2>{0.95031178f, 0.0167944599f},
-std::array<float,2>{0.311828196f, 0.733514488f},
-std::array<float,2>{0.895398378f, 0.939375162f},
-std::array<float,2>{0.344655484f, 0.469420731f},
-std::array<float,2>{0.527979612f, 0.0791491047f},
-std::array<float,2>{0.0452578217f, 0.632211328f},
-std::array<float,2>{0.67602098f, 0.529009879f},
-std::array<float,2>{0.152497768f, 0.165984124f},
-std::array<float,2>{0.858991325f, 0.327173561f},
-std::array<float,2>{0.43853426f, 0.778089166f},
-std::array<float,2>{0.774607778f, 0.721740484f},
-std::array<float,2>{0.388383597f, 0.0269848444f},
-std::array<float,2>{0.69593662f, 0.419479758f},
-std::array<float,2>{0.217835024f, 0.931040645f},
-std::array<float,2>{0.590994f, 0.868834019f},
-std::array<float,2>{0.0827615783f, 0.261664033f},
-std::array<float,2>{0.98182106f, 0.227666393f},
-std::array<float,2>{0.261077493f, 0.606033444f},
-std::array<float,2>{0.825685143f, 0.796764553f},
-std::array<float,2>{0.487552851f, 0.366425037f},
-std::array<float,2>{0.625755727f, 0.149608999f},
-std::array<float,2>{0.157577768f, 0.534478128f},
-std::array<float,2>{0.553232133f, 0.662320495f},
-std::array<float,2>{0.0200881548f, 0.102922238f},
-std::array<float,2>{0.91906321f, 0.450238317f},
-std::array<float,2>{0.336951941f, 0.981767178f},
-std::array<float,2>{0.945224106f, 0.581838727f},
-std::array<float,2>{0.304665208f, 0.20858328f},
-std::array<float,2>{0.599557042f, 0.299844176f},
-std::array<float,2>{0.101728432f, 0.834858835f},
-std::array<float,2>{0.719567478f, 0.902109265f},
-std::array<float,2>{0.246648356f, 0.395882189f},
-std::array<float,2>{0.787157238f, 0.0608456917f},
-std::array<float,2>{0.42687875f, 0.718690515f},
-std::array<float,2>{0.800919771f, 0.907069564f},
-std::array<float,2>{0.410939187f, 0.42799893f},
-std::array<float,2>{0.743035197f, 0.00714256614f},
-std::array<float,2>{0.224169075f, 0.741331458f},
-std::array<float,2>{0.616994083f, 0.623169661f},
-std::array<float,2>{0.122466944f, 0.240870222f},
-std::array<float,2>{0.96743989f, 0.281005561f},
-std::array<float,2>{0.293247312f, 0.84800148f},
-std::array<float,2>{0.926236033f, 0.642756581f},
-std::array<float,2>{0.317565829f, 0.0674224868f},
-std::array<float,2>{0.533390105f, 0.491734147f},
-std::array<float,2>{0.0118408063f, 0.955061555f},
-std::array<float,2>{0.644505739f, 0.756542206f},
-std::array<float,2>{0.184577554f, 0.333722144f},
-std::array<float,2>{0.840750277f, 0.172212034f},
-std::array<float,2>{0.474136144f, 0.500439942f},
-std::array<float,2>{0.998114407f, 0.823650658f},
-std::array<float,2>{0.269819826f, 0.284168184f},
-std::array<float,2>{0.577980936f, 0.1978461f},
-std::array<float,2>{0.0629774705f, 0.564277649f},
-std::array<float,2>{0.714404285f, 0.693875492f},
-std::array<float,2>{0.189258784f, 0.0344328992f},
-std::array<float,2>{0.751259327f, 0.387780756f},
-std::array<float,2>{0.405349374f, 0.888209224f},
-std::array<float,2>{0.866290748f, 0.551989019f},
-std::array<float,2>{0.466727793f, 0.134852916f},
-std::array<float,2>{0.663115323f, 0.353269815f},
-std::array<float,2>{0.128877476f, 0.804756761f},
-std::array<float,2>{0.511115193f, 0.992616236f},
-std::array<float,2>{0.0558591634f, 0.468214929f},
-std::array<float,2>{0.882249296f, 0.121716522f},
-std::array<float,2>{0.364326864f, 0.677587509f},
-std::array<float,2>{0.97972697f, 0.985534906f},
-std::array<float,2>{0.263998985f, 0.45372802f},
-std::array<float,2>{0.587192655f, 0.112956658f},
-std::array<float,2>{0.0802074894f, 0.685709178f},
-std::array<float,2>{0.702861965f, 0.561937869f},
-std::array<float,2>{0.21329613f, 0.126607373f},
-std::array<float,2>{0.779327214f, 0.348245472f},
-std::array<float,2>{0.384877205f, 0.804417312f},
-std::array<float,2>{0.854812264f, 0.702652454f},
-std::array<float,2>{0.445254922f, 0.0405069813f},
-std::array<float,2>{0.672118247f, 0.381486803f},
-std::array<float,2>{0.149421647f, 0.88169384f},
-std::array<float,2>{0.52596581f, 0.820168138f},
-std::array<float,2>{0.0414735302f, 0.293451697f},
-std::array<float,2>{0.893366277f, 0.187637463f},
-std::array<float,2>{0.348000258f, 0.57672137f},
-std::array<float,2>{0.783945739f, 0.763559699f},
-std::array<float,2>{0.424466908f, 0.341334075f},
-std::array<float,2>{0.724516809f, 0.180348232f},
-std::array<float,2>{0.24356918f, 0.51509881f},
-std::array<float,2>{0.594814181f, 0.64987421f},
-std::array<float,2>{0.106997922f, 0.0728944913f},
-std::array<float,2>{0.940234005f, 0.495349646f},
-std::array<float,2>{0.298008531f, 0.965553403f},
-std::array<float,2>{0.915988445f, 0.612445533f},
-std::array<float,2>{0.341862172f, 0.243564546f},
-std::array<float,2>{0.547333062f, 0.269206226f},
-std::array<float,2>{0.0190699976f, 0.858643889f},
-std::array<float,2>{0.629794598f, 0.915948272f},
-std::array<float,2>{0.161010504f, 0.432817906f},
-std::array<float,2>{0.82100904f, 0.0140286582f},
-std::array<float,2>{0.492093146f, 0.748242259f},
-std::array<float,2>{0.836387277f, 0.894097626f},
-std::array<float,2>{0.468966544f, 0.405675799f},
-std::array<float,2>{0.645597637f, 0.0493428819f},
-std::array<float,2>{0.182092041f, 0.709603965f},
-std::array<float,2>{0.537082195f, 0.588000655f},
-std::array<float,2>{0.0101226568f, 0.217336088f},
-std::array<float,2>{0.923699617f, 0.306334287f},
-std::array<float,2>{0.315727741f, 0.837294877f},
-std::array<float,2>{0.963796496f, 0.671718776f},
-std::array<float,2>{0.292922705f, 0.0988494456f},
-std::array<float,2>{0.611379743f, 0.438530087f},
-std::array<float,2>{0.117388584f, 0.975329161f},
-std::array<float,2>{0.74770236f, 0.78176868f},
-std::array<float,2>{0.220806733f, 0.370872557f},
-std::array<float,2>{0.798715115f, 0.147740647f},
-std::array<float,2>{0.408738464f, 0.545859575f},
-std::array<float,2>{0.875058472f, 0.861089885f},
-std::array<float,2>{0.361023843f, 0.251821458f},
-std::array<float,2>{0.512144923f, 0.225560352f},
-std::array<float,2>{0.0615455955f, 0.600413084f},
-std::array<float,2>{0.659150064f, 0.729574859f},
-std::array<float,2>{0.132298425f, 0.0217405278f},
-std::array<float,2>{0.862926066f, 0.409433812f},
-std::array<float,2>{0.460995346f, 0.928475618f},
-std::array<float,2>{0.754204869f, 0.51870662f},
-std::array<float,2>{0.400329143f, 0.160022944f},
-std::array<float,2>{0.714974046f, 0.319969028f},
-std::array<float,2>{0.192713782f, 0.77052176f},
-std::array<float,2>{0.570337832f, 0.950139284f},
-std::array<float,2>{0.0695192739f, 0.48331669f},
-std::array<float,2>{0.993297994f, 0.0866568759f},
-std::array<float,2>{0.268666565f, 0.635010302f},
-std::array<float,2>{0.930776119f, 0.933794439f},
-std::array<float,2>{0.325807124f, 0.41454789f},
-std::array<float,2>{0.54159075f, 0.0277883541f},
-std::array<float,2>{0.00619675079f, 0.724393427f},
-std::array<float,2>{0.655667543f, 0.602573454f},
-std::array<float,2>{0.176191807f, 0.231801197f},
-std::array<float,2>{0.835552096f, 0.264745027f},
-std::array<float,2>{0.47685945f, 0.873310506f},
-std::array<float,2>{0.812203825f, 0.628645778f},
-std::array<float,2>{0.415967554f, 0.084799327f},
-std::array<float,2>{0.740427792f, 0.474141836f},
-std::array<float,2>{0.231381044f, 0.943415523f},
-std::array<float,2>{0.621378779f, 0.777213097f},
-std::array<float,2>{0.109443456f, 0.323624372f},
-std::array<float,2>{0.954945385f, 0.171068937f},
-std::array<float,2>{0.28437537f, 0.524862528f},
-std::array<float,2>{0.870915592f, 0.828957319f},
-std::array<float,2>{0.455385923f, 0.304410487f},
-std::array<float,2>{0.669817924f, 0.204597816f},
-std::array<float,2>{0.140106827f, 0.583524764f},
-std::array<float,2>{0.505103171f, 0.711826324f},
-std::array<float,2>{0.0517930537f, 0.0555862375f},
-std::array<float,2>{0.885621488f, 0.392470956f},
-std::array<float,2>{0.371066988f, 0.905818343f},
-std::array<float,2>{0.984545767f, 0.536109805f},
-std::array<float,2>{0.277090192f, 0.155468509f},
-std::array<float,2>{0.562990367f, 0.359611303f},
-std::array<float,2>{0.0740641952f, 0.792210996f},
-std::array<float,2>{0.708365023f, 0.979137361f},
-std::array<float,2>{0.20096609f, 0.44665578f},
-std::array<float,2>{0.764700234f, 0.106548116f},
-std::array<float,2>{0.393688768f, 0.659311056f},
-std::array<float,2>{0.76594013f, 0.959108829f},
-std::array<float,2>{0.376960665f, 0.486440688f},
-std::array<float,2>{0.688535511f, 0.0630183741f},
-std::array<float,2>{0.203771919f, 0.645079911f},
-std::array<float,2>{0.585853219f, 0.506129622f},
-std::array<float,2>{0.0877434984f, 0.179600656f},
-std::array<float,2>{0.97599256f, 0.331972688f},
-std::array<float,2>{0.25106132f, 0.753286004f},
-std::array<float,2>{0.902689338f, 0.736149073f},
-std::array<float,2>{0.358834743f, 0.00311844144f},
-std::array<float,2>{0.522297442f, 0.423063785f},
-std::array<float,2>{0.0374618433f, 0.912397146f},
-std::array<float,2>{0.686209857f, 0.844098032f},
-std::array<float,2>{0.141087249f, 0.275709093f},
-std::array<float,2>{0.848003983f, 0.237348005f},
-std::array<float,2>{0.449568003f, 0.620354414f},
-std::array<float,2>{0.948436916f, 0.808753669f},
-std::array<float,2>{0.306876451f, 0.358433634f},
-std::array<float,2>{0.603363156f, 0.139303163f},
-std::array<float,2>{0.0962425992f, 0.550530016f},
-std::array<float,2>{0.732714474f, 0.674116969f},
-std::array<float,2>{0.241671249f, 0.119050071f},
-std::array<float,2>{0.794199765f, 0.463771015f},
-std::array<float,2>{0.43365711f, 0.999285221f},
-std::array<float,2>{0.814558387f, 0.568183899f},
-std::array<float,2>{0.49583295f, 0.201472223f},
-std::array<float,2>{0.633194268f, 0.286709011f},
-std::array<float,2>{0.170907542f, 0.824959755f},
-std::array<float,2>{0.562240839f, 0.884949327f},
-std::array<float,2>{0.0289460253f, 0.385944098f},
-std::array<float,2>{0.910081089f, 0.0381635204f},
-std::array<float,2>{0.328612536f, 0.689507782f},
-std::array<float,2>{0.990655184f, 0.918923497f},
-std::array<float,2>{0.27895394f, 0.437328666f},
-std::array<float,2>{0.566764891f, 0.00873336755f},
-std::array<float,2>{0.0765698925f, 0.745322645f},
-std::array<float,2>{0.703374624f, 0.613886833f},
-std::array<float,2>{0.196272343f, 0.246754795f},
-std::array<float,2>{0.76131171f, 0.271564156f},
-std::array<float,2>{0.396988422f, 0.853799999f},
-std::array<float,2>{0.873590291f, 0.656045794f},
-std::array<float,2>{0.460897326f, 0.0772991478f},
-std::array<float,2>{0.667885363f, 0.498422921f},
-std::array<float,2>{0.133320883f, 0.963374138f},
-std::array<float,2>{0.502395689f, 0.757821679f},
-std::array<float,2>{0.047381103f, 0.338667661f},
-std::array<float,2>{0.887861788f, 0.184836641f},
-std::array<float,2>{0.371507019f, 0.509568632f},
-std::array<float,2>{0.806731045f, 0.815513849f},
-std::array<float,2>{0.419089437f, 0.289650947f},
-std::array<float,2>{0.73552388f, 0.193141818f},
-std::array<float,2>{0.229808673f, 0.572988391f},
-std::array<float,2>{0.6181494f, 0.697253168f},
-std::array<float,2>{0.113663085f, 0.0443227254f},
-std::array<float,2>{0.957384348f, 0.377712578f},
-std::array<float,2>{0.288305998f, 0.878422678f},
-std::array<float,2>{0.93616277f, 0.556479573f},
-std::array<float,2>{0.323019534f, 0.132055655f},
-std::array<float,2>{0.545775056f, 0.346750647f},
-std::array<float,2>{0.00268605188f, 0.799077928f},
-std::array<float,2>{0.650849819f, 0.99002701f},
-std::array<float,2>{0.172504321f, 0.458682507f},
-std::array<float,2>{0.829428136f, 0.114067547f},
-std::array<float,2>{0.481896818f, 0.683009088f},
-std::array<float,2>{0.819917858f, 0.946334779f},
-std::array<float,2>{0.497342676f, 0.478667557f},
-std::array<float,2>{0.636861205f, 0.0917173848f},
-std::array<float,2>{0.165091842f, 0.639704108f},
-std::array<float,2>{0.556914866f, 0.52093643f},
-std::array<float,2>{0.0252203345f, 0.161854953f},
-std::array<float,2>{0.912497938f, 0.312698781f},
-std::array<float,2>{0.33248359f, 0.766492248f},
-std::array<float,2>{0.951303303f, 0.731739819f},
-std::array<float,2>{0.310365468f, 0.018006511f},
-std::array<float,2>{0.607770443f, 0.413509011f},
-std::array<float,2>{0.0989201292f, 0.923000038f},
-std::array<float,2>{0.729973316f, 0.864021063f},
-std::array<float,2>{0.235018283f, 0.254052132f},
-std::array<float,2>{0.789889932f, 0.220584035f},
-std::array<float,2>{0.431795269f, 0.59579277f},
-std::array<float,2>{0.900574028f, 0.785429716f},
-std::array<float,2>{0.352864712f, 0.373272747f},
-std::array<float,2>{0.516355217f, 0.142335996f},
-std::array<float,2>{0.0341479592f, 0.541177571f},
-std::array<float,2>{0.680581093f, 0.664668262f},
-std::array<float,2>{0.146820948f, 0.094838284f},
-std::array<float,2>{0.846045196f, 0.442151129f},
-std::array<float,2>{0.448405981f, 0.970731378f},
-std::array<float,2>{0.770279109f, 0.592793703f},
-std::array<float,2>{0.382585585f, 0.212474748f},
-std::array<float,2>{0.691419423f, 0.308980703f},
-std::array<float,2>{0.210648015f, 0.84158659f},
-std::array<float,2>{0.579209149f, 0.895654202f},
-std::array<float,2>{0.090885058f, 0.400419503f},
-std::array<float,2>{0.969868004f, 0.0514911413f},
-std::array<float,2>{0.255038053f, 0.70664525f},
-std::array<float,2>{0.920477271f, 0.983531237f},
-std::array<float,2>{0.339479208f, 0.451986015f},
-std::array<float,2>{0.550862372f, 0.10402479f},
-std::array<float,2>{0.022097962f, 0.660401046f},
-std::array<float,2>{0.628293335f, 0.531457603f},
-std::array<float,2>{0.159877852f, 0.150868908f},
-std::array<float,2>{0.826677442f, 0.363396883f},
-std::array<float,2>{0.484926224f, 0.793457091f},
-std::array<float,2>{0.785418689f, 0.716005743f},
-std::array<float,2>{0.429473549f, 0.0591194928f},
-std::array<float,2>{0.722432017f, 0.398167163f},
-std::array<float,2>{0.248084009f, 0.899024367f},
-std::array<float,2>{0.600636721f, 0.833439827f},
-std::array<float,2>{0.10514494f, 0.297414124f},
-std::array<float,2>{0.941651642f, 0.210046127f},
-std::array<float,2>{0.301576406f, 0.578974783f},
-std::array<float,2>{0.855639637f, 0.780070186f},
-std::array<float,2>{0.440069079f, 0.325930506f},
-std::array<float,2>{0.678098738f, 0.167025194f},
-std::array<float,2>{0.155551732f, 0.53017962f},
-std::array<float,2>{0.530141771f, 0.630805671f},
-std::array<float,2>{0.0435310267f, 0.0817151591f},
-std::array<float,2>{0.896767199f, 0.47220698f},
-std::array<float,2>{0.346248776f, 0.940000594f},
-std::array<float,2>{0.983303368f, 0.608244717f},
-std::array<float,2>{0.25851661f, 0.229342476f},
-std::array<float,2>{0.592247367f, 0.258459061f},
-std::array<float,2>{0.0858330503f, 0.870747745f},
-std::array<float,2>{0.698056996f, 0.932917416f},
-std::array<float,2>{0.216025785f, 0.421756446f},
-std::array<float,2>{0.775892735f, 0.0243368857f},
-std::array<float,2>{0.390014768f, 0.71876955f},
-std::array<float,2>{0.752499461f, 0.888889551f},
-std::array<float,2>{0.403260291f, 0.389317274f},
-std::array<float,2>{0.711987972f, 0.0330431052f},
-std::array<float,2>{0.190668672f, 0.692903757f},
-std::array<float,2>{0.574575424f, 0.565512538f},
-std::array<float,2>{0.0660634711f, 0.19562383f},
-std::array<float,2>{0.996936977f, 0.282363951f},
-std::array<float,2>{0.272095561f, 0.820751488f},
-std::array<float,2>{0.879719436f, 0.679174602f},
-std::array<float,2>{0.366755068f, 0.124092445f},
-std::array<float,2>{0.509304047f, 0.464991182f},
-std::array<float,2>{0.0580614023f, 0.994254351f},
-std::array<float,2>{0.66092509f, 0.807868421f},
-std::array<float,2>{0.125277191f, 0.354629934f},
-std::array<float,2>{0.865100622f, 0.13316378f},
-std::array<float,2>{0.46766147f, 0.554116845f},
-std::array<float,2>{0.96598947f, 0.850164056f},
-std::array<float,2>{0.296762139f, 0.27920264f},
-std::array<float,2>{0.615162671f, 0.240225703f},
-std::array<float,2>{0.124563999f, 0.622811615f},
-std::array<float,2>{0.745066941f, 0.739574313f},
-std::array<float,2>{0.226239964f, 0.00487507228f},
-std::array<float,2>{0.803490877f, 0.425961256f},
-std::array<float,2>{0.41389066f, 0.909913182f},
-std::array<float,2>{0.842428803f, 0.502716601f},
-std::array<float,2>{0.476404905f, 0.175159022f},
-std::array<float,2>{0.642105937f, 0.334490418f},
-std::array<float,2>{0.185563922f, 0.75505197f},
-std::array<float,2>{0.531336308f, 0.95536828f},
-std::array<float,2>{0.0151389288f, 0.489623308f},
-std::array<float,2>{0.928736687f, 0.0693317056f},
-std::array<float,2>{0.320121497f, 0.642261147f},
-std::array<float,2>{0.938694835f, 0.968451679f},
-std::array<float,2>{0.299998105f, 0.493899882f},
-std::array<float,2>{0.596066058f, 0.0715197623f},
-std::array<float,2>{0.108195342f, 0.650835097f},
-std::array<float,2>{0.725720048f, 0.512031436f},
-std::array<float,2>{0.244581178f, 0.182777643f},
-std::array<float,2>{0.782291412f, 0.341972768f},
-std::array<float,2>{0.422947437f, 0.765237749f},
-std::array<float,2>{0.822579145f, 0.746476352f},
-std::array<float,2>{0.489999771f, 0.012024113f},
-std::array<float,2>{0.631720424f, 0.430859774f},
-std::array<float,2>{0.163627297f, 0.916279495f},
-std::array<float,2>{0.550071836f, 0.856615901f},
-std::array<float,2>{0.0157685746f, 0.266947389f},
-std::array<float,2>{0.917810678f, 0.244344637f},
-std::array<float,2>{0.340764791f, 0.610457122f},
-std::array<float,2>{0.777909279f, 0.802072525f},
-std::array<float,2>{0.384211272f, 0.351490349f},
-std::array<float,2>{0.700432241f, 0.12830928f},
-std::array<float,2>{0.212853491f, 0.560518801f},
-std::array<float,2>{0.58819437f, 0.684308112f},
-std::array<float,2>{0.0796956792f, 0.110039927f},
-std::array<float,2>{0.977892697f, 0.45699051f},
-std::array<float,2>{0.261754185f, 0.986768425f},
-std::array<float,2>{0.890627563f, 0.57581228f},
-std::array<float,2>{0.349788606f, 0.190826207f},
-std::array<float,2>{0.523853302f, 0.296112359f},
-std::array<float,2>{0.039507091f, 0.81720227f},
-std::array<float,2>{0.67472595f, 0.878966987f},
-std::array<float,2>{0.151332706f, 0.380262345f},
-std::array<float,2>{0.851837635f, 0.0422682241f},
-std::array<float,2>{0.441705763f, 0.700959802f},
-std::array<float,2>{0.859459817f, 0.927194893f},
-std::array<float,2>{0.463393986f, 0.407268345f},
-std::array<float,2>{0.657163978f, 0.0202197116f},
-std::array<float,2>{0.130020574f, 0.727013528f},
-std::array<float,2>{0.515609145f, 0.598246336f},
-std::array<float,2>{0.0603183433f, 0.223468214f},
-std::array<float,2>{0.877743065f, 0.253195971f},
-std::array<float,2>{0.362180859f, 0.861605644f},
-std::array<float,2>{0.995721817f, 0.633831501f},
-std::array<float,2>{0.266701996f, 0.089712128f},
-std::array<float,2>{0.572597384f, 0.482233912f},
-std::array<float,2>{0.0675966218f, 0.952815831f},
-std::array<float,2>{0.718329072f, 0.773224652f},
-std::array<float,2>{0.193587244f, 0.316984266f},
-std::array<float,2>{0.757736623f, 0.156886116f},
-std::array<float,2>{0.401426554f, 0.515758693f},
-std::array<float,2>{0.924123228f, 0.837935507f},
-std::array<float,2>{0.313513935f, 0.306796819f},
-std::array<float,2>{0.537166059f, 0.215786219f},
-std::array<float,2>{0.00976236258f, 0.587336659f},
-std::array<float,2>{0.647059083f, 0.708583593f},
-std::array<float,2>{0.180435315f, 0.0480973944f},
-std::array<float,2>{0.837991059f, 0.402401596f},
-std::array<float,2>{0.471512407f, 0.890948117f},
-std::array<float,2>{0.799927652f, 0.544798255f},
-std::array<float,2>{0.40726313f, 0.144656941f},
-std::array<float,2>{0.748399913f, 0.368667692f},
-std::array<float,2>{0.21927008f, 0.783740163f},
-std::array<float,2>{0.610303879f, 0.973217607f},
-std::array<float,2>{0.120198257f, 0.440748245f},
-std::array<float,2>{0.961498499f, 0.10099639f},
-std::array<float,2>{0.290014476f, 0.669688284f},
-std::array<float,2>{0.883054972f, 0.903611004f},
-std::array<float,2>{0.368535906f, 0.393199891f},
-std::array<float,2>{0.507170737f, 0.0579057597f},
-std::array<float,2>{0.0527576171f, 0.713903785f},
-std::array<float,2>{0.67009443f, 0.585806966f},
-std::array<float,2>{0.137051702f, 0.20583944f},
-std::array<float,2>{0.868860006f, 0.302437723f},
-std::array<float,2>{0.454954803f, 0.831587613f},
-std::array<float,2>{0.763400793f, 0.657059491f},
-std::array<float,2>{0.391416669f, 0.107460193f},
-std::array<float,2>{0.709460497f, 0.448564351f},
-std::array<float,2>{0.201538235f, 0.977288961f},
-std::array<float,2>{0.564921796f, 0.790418744f},
-std::array<float,2>{0.071720399f, 0.362524778f},
-std::array<float,2>{0.987558603f, 0.152731672f},
-std::array<float,2>{0.274374187f, 0.538924694f},
-std::array<float,2>{0.832810104f, 0.872477233f},
-std::array<float,2>{0.479069799f, 0.26356113f},
-std::array<float,2>{0.65264672f, 0.232427508f},
-std::array<float,2>{0.17900525f, 0.604397893f},
-std::array<float,2>{0.540265858f, 0.726404905f},
-std::array<float,2>{0.00399010954f, 0.0301517043f},
-std::array<float,2>{0.9319399f, 0.416038781f},
-std::array<float,2>{0.327631563f, 0.937033355f},
-std::array<float,2>{0.955105186f, 0.52729398f},
-std::array<float,2>{0.281975508f, 0.169357285f},
-std::array<float,2>{0.624541938f, 0.322022557f},
-std::array<float,2>{0.113049872f, 0.775123894f},
-std::array<float,2>{0.739904284f, 0.942489982f},
-std::array<float,2>{0.234123692f, 0.474694908f},
-std::array<float,2>{0.809403479f, 0.0828595757f},
-std::array<float,2>{0.41689837f, 0.626208007f},
-std::array<float,2>{0.796399355f, 0.99772346f},
-std::array<float,2>{0.437342435f, 0.462536275f},
-std::array<float,2>{0.73089689f, 0.119500056f},
-std::array<float,2>{0.240211919f, 0.673229277f},
-std::array<float,2>{0.604069889f, 0.546961606f},
-std::array<float,2>{0.0951107815f, 0.13782905f},
-std::array<float,2>{0.947165549f, 0.355561763f},
-std::array<float,2>{0.306384921f, 0.811062515f},
-std::array<float,2>{0.906305671f, 0.688419342f},
-std::array<float,2>{0.331077516f, 0.0367301218f},
-std::array<float,2>{0.560108542f, 0.383587241f},
-std::array<float,2>{0.0304441042f, 0.883757353f},
-std::array<float,2>{0.635568142f, 0.827372432f},
-std::array<float,2>{0.16800344f, 0.28811726f},
-std::array<float,2>{0.813433886f, 0.200047851f},
-std::array<float,2>{0.493311822f, 0.569152951f},
-std::array<float,2>{0.974444807f, 0.751781523f},
-std::array<float,2>{0.253566414f, 0.329727173f},
-std::array<float,2>{0.583034694f, 0.17733258f},
-std::array<float,2>{0.0893212929f, 0.505297661f},
-std::array<float,2>{0.689561069f, 0.647207379f},
-std::array<float,2>{0.206036091f, 0.0660688654f},
-std::array<float,2>{0.76916194f, 0.484730303f},
-std::array<float,2>{0.376416206f, 0.958100557f},
-std::array<float,2>{0.850582182f, 0.617583752f},
-std::array<float,2>{0.4522295f, 0.235424772f},
-std::array<float,2>{0.684810996f, 0.274375409f},
-std::array<float,2>{0.14407222f, 0.84575367f},
-std::array<float,2>{0.520681202f, 0.912098706f},
-std::array<float,2>{0.0360901915f, 0.424719125f},
-std::array<float,2>{0.906128883f, 0.000165012258f},
-std::array<float,2>{0.35727787f, 0.73777914f},
-std::array<float,2>{0.977101743f, 0.881588101f},
-std::array<float,2>{0.263665289f, 0.381782562f},
-std::array<float,2>{0.589410603f, 0.0401032381f},
-std::array<float,2>{0.079079017f, 0.703020334f},
-std::array<float,2>{0.699492037f, 0.577137947f},
-std::array<float,2>{0.211266354f, 0.187800825f},
-std::array<float,2>{0.77863729f, 0.293059617f},
-std::array<float,2>{0.383115143f, 0.819938838f},
-std::array<float,2>{0.852820396f, 0.685821712f},
-std::array<float,2>{0.442986667f, 0.113208443f},
-std::array<float,2>{0.675429404f, 0.453988314f},
-std::array<float,2>{0.15197365f, 0.985774577f},
-std::array<float,2>{0.524706304f, 0.804455042f},
-std::array<float,2>{0.0409337766f, 0.348554194f},
-std::array<float,2>{0.892004728f, 0.12677297f},
-std::array<float,2>{0.350611627f, 0.561612189f},
-std::array<float,2>{0.781970739f, 0.858609855f},
-std::array<float,2>{0.42208457f, 0.269464612f},
-std::array<float,2>{0.724622309f, 0.243408129f},
-std::array<float,2>{0.245535284f, 0.612668276f},
-std::array<float,2>{0.597291291f, 0.748492122f},
-std::array<float,2>{0.108667485f, 0.0138493842f},
-std::array<float,2>{0.937695086f, 0.432950586f},
-std::array<float,2>{0.29908213f, 0.915618896f},
-std::array<float,2>{0.916220844f, 0.514867783f},
-std::array<float,2>{0.340894133f, 0.180660978f},
-std::array<float,2>{0.549425125f, 0.341689795f},
-std::array<float,2>{0.0168892611f, 0.763386548f},
-std::array<float,2>{0.631940305f, 0.965613604f},
-std::array<float,2>{0.162250742f, 0.495444149f},
-std::array<float,2>{0.823800802f, 0.0731565803f},
-std::array<float,2>{0.488576591f, 0.649561942f},
-std::array<float,2>{0.839242339f, 0.975372076f},
-std::array<float,2>{0.471995741f, 0.43874526f},
-std::array<float,2>{0.64806807f, 0.0988946036f},
-std::array<float,2>{0.180696636f, 0.671512604f},
-std::array<float,2>{0.53878665f, 0.545627117f},
-std::array<float,2>{0.00851709209f, 0.147680327f},
-std::array<float,2>{0.924825549f, 0.370809972f},
-std::array<float,2>{0.313411564f, 0.782048464f},
-std::array<float,2>{0.962654114f, 0.70993042f},
-std::array<float,2>{0.29086116f, 0.0496007986f},
-std::array<float,2>{0.610830843f, 0.405312955f},
-std::array<float,2>{0.1199717f, 0.89451313f},
-std::array<float,2>{0.749746382f, 0.836988151f},
-std::array<float,2>{0.22005567f, 0.306589812f},
-std::array<float,2>{0.799196601f, 0.217618942f},
-std::array<float,2>{0.406572819f, 0.58827889f},
-std::array<float,2>{0.878039837f, 0.770835996f},
-std::array<float,2>{0.363250881f, 0.320109546f},
-std::array<float,2>{0.514358342f, 0.159690306f},
-std::array<float,2>{0.059391696f, 0.519003451f},
-std::array<float,2>{0.657513738f, 0.634903908f},
-std::array<float,2>{0.128970936f, 0.0867670327f},
-std::array<float,2>{0.861017823f, 0.482946932f},
-std::array<float,2>{0.464318603f, 0.949789405f},
-std::array<float,2>{0.756253719f, 0.600261748f},
-std::array<float,2>{0.400997192f, 0.225219995f},
-std::array<float,2>{0.717468798f, 0.251505733f},
-std::array<float,2>{0.194559693f, 0.860910594f},
-std::array<float,2>{0.574165463f, 0.928466499f},
-std::array<float,2>{0.0664753988f, 0.409246355f},
-std::array<float,2>{0.994353414f, 0.0216415673f},
-std::array<float,2>{0.265750319f, 0.729952931f},
-std::array<float,2>{0.933030307f, 0.943616092f},
-std::array<float,2>{0.327021956f, 0.474373668f},
-std::array<float,2>{0.539245725f, 0.0847162157f},
-std::array<float,2>{0.00538525265f, 0.62867105f},
-std::array<float,2>{0.653619885f, 0.524485409f},
-std::array<float,2>{0.177784398f, 0.171382934f},
-std::array<float,2>{0.833072007f, 0.323371738f},
-std::array<float,2>{0.479564607f, 0.776957929f},
-std::array<float,2>{0.809993327f, 0.724198222f},
-std::array<float,2>{0.417541772f, 0.027512392f},
-std::array<float,2>{0.738809645f, 0.414140731f},
-std::array<float,2>{0.233252272f, 0.933914721f},
-std::array<float,2>{0.623615623f, 0.873278677f},
-std::array<float,2>{0.111696675f, 0.265070051f},
-std::array<float,2>{0.956664145f, 0.231543109f},
-std::array<float,2>{0.282451928f, 0.602808535f},
-std::array<float,2>{0.867321253f, 0.792330682f},
-std::array<float,2>{0.453416735f, 0.359687865f},
-std::array<float,2>{0.670960069f, 0.155755818f},
-std::array<float,2>{0.137983575f, 0.535782278f},
-std::array<float,2>{0.506365061f, 0.659433544f},
-std::array<float,2>{0.0538048632f, 0.10680984f},
-std::array<float,2>{0.884380877f, 0.446408898f},
-std::array<float,2>{0.367820174f, 0.97943908f},
-std::array<float,2>{0.987051129f, 0.583892822f},
-std::array<float,2>{0.27450031f, 0.204886183f},
-std::array<float,2>{0.566261172f, 0.304517239f},
-std::array<float,2>{0.0709935576f, 0.828826129f},
-std::array<float,2>{0.710461736f, 0.90601027f},
-std::array<float,2>{0.202734381f, 0.392232597f},
-std::array<float,2>{0.762194872f, 0.0554177985f},
-std::array<float,2>{0.392137706f, 0.711659968f},
-std::array<float,2>{0.767949939f, 0.912175119f},
-std::array<float,2>{0.375406921f, 0.423261255f},
-std::array<float,2>{0.691048026f, 0.00322445319f},
-std::array<float,2>{0.206594035f, 0.736064017f},
-std::array<float,2>{0.582652986f, 0.620546758f},
-std::array<float,2>{0.0879058689f, 0.237740949f},
-std::array<float,2>{0.972953916f, 0.275610268f},
-std::array<float,2>{0.252708614f, 0.843885303f},
-std::array<float,2>{0.904860198f, 0.645272315f},
-std::array<float,2>{0.355615854f, 0.0632789508f},
-std::array<float,2>{0.520024478f, 0.486813873f},
-std::array<float,2>{0.0367440246f, 0.959437191f},
-std::array<float,2>{0.684140563f, 0.752966404f},
-std::array<float,2>{0.142824471f, 0.331623942f},
-std::array<float,2>{0.851154506f, 0.179231748f},
-std::array<float,2>{0.451902688f, 0.506017327f},
-std::array<float,2>{0.945570827f, 0.824714184f},
-std::array<float,2>{0.305463374f, 0.286905676f},
-std::array<float,2>{0.60521704f, 0.20121564f},
-std::array<float,2>{0.0945907459f, 0.568047345f},
-std::array<float,2>{0.731916428f, 0.689882934f},
-std::array<float,2>{0.23861292f, 0.0384772681f},
-std::array<float,2>{0.795570552f, 0.386005253f},
-std::array<float,2>{0.435631365f, 0.885092676f},
-std::array<float,2>{0.814356267f, 0.550636411f},
-std::array<float,2>{0.492193609f, 0.139592648f},
-std::array<float,2>{0.636307776f, 0.358699054f},
-std::array<float,2>{0.169206798f, 0.809041739f},
-std::array<float,2>{0.559230864f, 0.999167919f},
-std::array<float,2>{0.0298901107f, 0.463577896f},
-std::array<float,2>{0.907780349f, 0.11873351f},
-std::array<float,2>{0.330238968f, 0.674055815f},
-std::array<float,2>{0.958197832f, 0.990271807f},
-std::array<float,2>{0.288006216f, 0.460807413f},
-std::array<float,2>{0.618770421f, 0.116566725f},
-std::array<float,2>{0.114888132f, 0.681568921f},
-std::array<float,2>{0.735146642f, 0.557745218f},
-std::array<float,2>{0.228598148f, 0.130080387f},
-std::array<float,2>{0.808545411f, 0.343769759f},
-std::array<float,2>{0.418590277f, 0.798287213f},
-std::array<float,2>{0.828467846f, 0.697888732f},
-std::array<float,2>{0.480864167f, 0.0465533212f},
-std::array<float,2>{0.651688874f, 0.37689954f},
-std::array<float,2>{0.173156142f, 0.875835001f},
-std::array<float,2>{0.5468629f, 0.812941968f},
-std::array<float,2>{0.00321231899f, 0.292147309f},
-std::array<float,2>{0.936729312f, 0.194141299f},
-std::array<float,2>{0.323924512f, 0.570352972f},
-std::array<float,2>{0.75980854f, 0.761324644f},
-std::array<float,2>{0.398325682f, 0.335979164f},
-std::array<float,2>{0.704408586f, 0.187270254f},
-std::array<float,2>{0.196313351f, 0.51123935f},
-std::array<float,2>{0.567999125f, 0.65389508f},
-std::array<float,2>{0.0775142685f, 0.0746140555f},
-std::array<float,2>{0.991767883f, 0.496171474f},
-std::array<float,2>{0.27767843f, 0.962822199f},
-std::array<float,2>{0.887143731f, 0.615280867f},
-std::array<float,2>{0.372665823f, 0.2483183f},
-std::array<float,2>{0.503327549f, 0.271112889f},
-std::array<float,2>{0.0488085113f, 0.852751553f},
-std::array<float,2>{0.666745901f, 0.920141041f},
-std::array<float,2>{0.134373397f, 0.434338033f},
-std::array<float,2>{0.874672651f, 0.010777384f},
-std::array<float,2>{0.459002405f, 0.742713332f},
-std::array<float,2>{0.846688747f, 0.896861672f},
-std::array<float,2>{0.447405666f, 0.398803264f},
-std::array<float,2>{0.681317627f, 0.0546286777f},
-std::array<float,2>{0.147924259f, 0.704593658f},
-std::array<float,2>{0.517156601f, 0.59095329f},
-std::array<float,2>{0.0348737761f, 0.213844597f},
-std::array<float,2>{0.902238846f, 0.312106669f},
-std::array<float,2>{0.352080733f, 0.841974914f},
-std::array<float,2>{0.968792975f, 0.667810857f},
-std::array<float,2>{0.254218042f, 0.0967159867f},
-std::array<float,2>{0.578739107f, 0.443424851f},
-std::array<float,2>{0.090651609f, 0.970198393f},
-std::array<float,2>{0.693343937f, 0.788980782f},
-std::array<float,2>{0.209017113f, 0.371623963f},
-std::array<float,2>{0.770763993f, 0.143882662f},
-std::array<float,2>{0.380880207f, 0.539703488f},
-std::array<float,2>{0.913540423f, 0.86623621f},
-std::array<float,2>{0.33382836f, 0.257104188f},
-std::array<float,2>{0.557732582f, 0.22077994f},
-std::array<float,2>{0.0244125761f, 0.595035195f},
-std::array<float,2>{0.638125837f, 0.73382777f},
-std::array<float,2>{0.164668754f, 0.0169208087f},
-std::array<float,2>{0.81892091f, 0.411619991f},
-std::array<float,2>{0.496375799f, 0.923971653f},
-std::array<float,2>{0.790320039f, 0.522150755f},
-std::array<float,2>{0.43358767f, 0.163936779f},
-std::array<float,2>{0.728959322f, 0.315165251f},
-std::array<float,2>{0.235674307f, 0.769281328f},
-std::array<float,2>{0.609075963f, 0.949049711f},
-std::array<float,2>{0.0979160964f, 0.476947069f},
-std::array<float,2>{0.952697873f, 0.0924832523f},
-std::array<float,2>{0.309481978f, 0.638147354f},
-std::array<float,2>{0.898263335f, 0.930795014f},
-std::array<float,2>{0.347558498f, 0.419776708f},
-std::array<float,2>{0.530350327f, 0.0272684991f},
-std::array<float,2>{0.0443401411f, 0.721991897f},
-std::array<float,2>{0.679218769f, 0.606271863f},
-std::array<float,2>{0.154471338f, 0.227868602f},
-std::array<float,2>{0.857183933f, 0.261450291f},
-std::array<float,2>{0.440603197f, 0.869120717f},
-std::array<float,2>{0.776968837f, 0.632063985f},
-std::array<float,2>{0.38886252f, 0.0794784352f},
-std::array<float,2>{0.699137807f, 0.469566762f},
-std::array<float,2>{0.215236306f, 0.938968122f},
-std::array<float,2>{0.59299314f, 0.777885437f},
-std::array<float,2>{0.0848241448f, 0.327528656f},
-std::array<float,2>{0.984316647f, 0.165537864f},
-std::array<float,2>{0.259548664f, 0.529195249f},
-std::array<float,2>{0.82779026f, 0.834592462f},
-std::array<float,2>{0.485824227f, 0.300207168f},
-std::array<float,2>{0.627178252f, 0.208808541f},
-std::array<float,2>{0.158883736f, 0.581681371f},
-std::array<float,2>{0.55241096f, 0.718479693f},
-std::array<float,2>{0.0230202377f, 0.0606351346f},
-std::array<float,2>{0.921549797f, 0.395725131f},
-std::array<float,2>{0.338253647f, 0.901874304f},
-std::array<float,2>{0.942766905f, 0.534367204f},
-std::array<float,2>{0.301835239f, 0.149847716f},
-std::array<float,2>{0.600214064f, 0.366614789f},
-std::array<float,2>{0.104400642f, 0.796507478f},
-std::array<float,2>{0.721354902f, 0.981572866f},
-std::array<float,2>{0.249184564f, 0.450581402f},
-std::array<float,2>{0.786474049f, 0.102720536f},
-std::array<float,2>{0.428008288f, 0.662530422f},
-std::array<float,2>{0.80424732f, 0.95462817f},
-std::array<float,2>{0.412873983f, 0.49203518f},
-std::array<float,2>{0.745693266f, 0.0676486716f},
-std::array<float,2>{0.225355789f, 0.643023372f},
-std::array<float,2>{0.613639414f, 0.500078321f},
-std::array<float,2>{0.123101287f, 0.171917498f},
-std::array<float,2>{0.965041339f, 0.333848655f},
-std::array<float,2>{0.295566946f, 0.756599903f},
-std::array<float,2>{0.927950799f, 0.741502225f},
-std::array<float,2>{0.318371385f, 0.00694785826f},
-std::array<float,2>{0.532676518f, 0.42791611f},
-std::array<float,2>{0.0145759527f, 0.90684098f},
-std::array<float,2>{0.641454399f, 0.847722948f},
-std::array<float,2>{0.186945885f, 0.281235605f},
-std::array<float,2>{0.843104541f, 0.241080567f},
-std::array<float,2>{0.474979699f, 0.623343527f},
-std::array<float,2>{0.99788034f, 0.805170417f},
-std::array<float,2>{0.273147047f, 0.353467494f},
-std::array<float,2>{0.575804591f, 0.135104641f},
-std::array<float,2>{0.0644726679f, 0.552104592f},
-std::array<float,2>{0.711620271f, 0.677381873f},
-std::array<float,2>{0.19038488f, 0.12206053f},
-std::array<float,2>{0.753075659f, 0.467917293f},
-std::array<float,2>{0.403468609f, 0.992386222f},
-std::array<float,2>{0.863679409f, 0.564208627f},
-std::array<float,2>{0.46794042f, 0.198194072f},
-std::array<float,2>{0.661276817f, 0.283789158f},
-std::array<float,2>{0.126589939f, 0.8234604f},
-std::array<float,2>{0.508551061f, 0.888475657f},
-std::array<float,2>{0.0568998493f, 0.388014734f},
-std::array<float,2>{0.880697429f, 0.0341888405f},
-std::array<float,2>{0.366016299f, 0.694313586f},
-std::array<float,2>{0.940930843f, 0.916046202f},
-std::array<float,2>{0.297650695f, 0.431028068f},
-std::array<float,2>{0.594174027f, 0.0119161941f},
-std::array<float,2>{0.106138229f, 0.746330857f},
-std::array<float,2>{0.722957671f, 0.610770047f},
-std::array<float,2>{0.242806196f, 0.244621292f},
-std::array<float,2>{0.784283936f, 0.266676366f},
-std::array<float,2>{0.425423533f, 0.856852353f},
-std::array<float,2>{0.822102666f, 0.650602996f},
-std::array<float,2>{0.49039799f, 0.0715745687f},
-std::array<float,2>{0.629915953f, 0.493854016f},
-std::array<float,2>{0.161312506f, 0.968674719f},
-std::array<float,2>{0.547993302f, 0.765431762f},
-std::array<float,2>{0.0182058048f, 0.342161119f},
-std::array<float,2>{0.914572537f, 0.182928577f},
-std::array<float,2>{0.343004435f, 0.511891305f},
-std::array<float,2>{0.780288935f, 0.816997111f},
-std::array<float,2>{0.386583f, 0.296195209f},
-std::array<float,2>{0.701876998f, 0.190604076f},
-std::array<float,2>{0.21439226f, 0.576138437f},
-std::array<float,2>{0.586315274f, 0.700798035f},
-std::array<float,2>{0.0812660456f, 0.042020712f},
-std::array<float,2>{0.978549361f, 0.379989833f},
-std::array<float,2>{0.264688611f, 0.879346371f},
-std::array<float,2>{0.894394457f, 0.560176492f},
-std::array<float,2>{0.349251688f, 0.128073946f},
-std::array<float,2>{0.526999533f, 0.351250172f},
-std::array<float,2>{0.0428238697f, 0.801965058f},
-std::array<float,2>{0.672979355f, 0.986555874f},
-std::array<float,2>{0.149385214f, 0.456623018f},
-std::array<float,2>{0.854415774f, 0.110243686f},
-std::array<float,2>{0.444286644f, 0.684433997f},
-std::array<float,2>{0.862016678f, 0.953104973f},
-std::array<float,2>{0.462632358f, 0.48215887f},
-std::array<float,2>{0.6592623f, 0.0895937681f},
-std::array<float,2>{0.131453902f, 0.634116828f},
-std::array<float,2>{0.512748957f, 0.515884399f},
-std::array<float,2>{0.061474558f, 0.157181665f},
-std::array<float,2>{0.876064718f, 0.317350358f},
-std::array<float,2>{0.359614938f, 0.773038983f},
-std::array<float,2>{0.992474973f, 0.726619601f},
-std::array<float,2>{0.26784271f, 0.0204116926f},
-std::array<float,2>{0.571947813f, 0.407524824f},
-std::array<float,2>{0.0687495619f, 0.92695272f},
-std::array<float,2>{0.715837061f, 0.861500561f},
-std::array<float,2>{0.191866338f, 0.252993941f},
-std::array<float,2>{0.755048156f, 0.223265737f},
-std::array<float,2>{0.399241596f, 0.598435938f},
-std::array<float,2>{0.922277629f, 0.784064949f},
-std::array<float,2>{0.315015644f, 0.368948936f},
-std::array<float,2>{0.535251498f, 0.144800827f},
-std::array<float,2>{0.0111013837f, 0.544490457f},
-std::array<float,2>{0.644627333f, 0.669510841f},
-std::array<float,2>{0.183562458f, 0.100822501f},
-std::array<float,2>{0.837751091f, 0.440650672f},
-std::array<float,2>{0.470593482f, 0.973573804f},
-std::array<float,2>{0.797221601f, 0.587058127f},
-std::array<float,2>{0.40987578f, 0.215372041f},
-std::array<float,2>{0.746093988f, 0.306978315f},
-std::array<float,2>{0.222319394f, 0.838256121f},
-std::array<float,2>{0.61256367f, 0.890763164f},
-std::array<float,2>{0.118218243f, 0.402613372f},
-std::array<float,2>{0.963906705f, 0.0478906594f},
-std::array<float,2>{0.291027784f, 0.708977759f},
-std::array<float,2>{0.886047184f, 0.977329552f},
-std::array<float,2>{0.369588822f, 0.448420823f},
-std::array<float,2>{0.503992915f, 0.107844576f},
-std::array<float,2>{0.0515065677f, 0.656795502f},
-std::array<float,2>{0.668835521f, 0.538598716f},
-std::array<float,2>{0.139015302f, 0.152531922f},
-std::array<float,2>{0.86974293f, 0.362615526f},
-std::array<float,2>{0.456526428f, 0.790133297f},
-std::array<float,2>{0.763985813f, 0.714336932f},
-std::array<float,2>{0.39346838f, 0.0576404966f},
-std::array<float,2>{0.707046092f, 0.393352687f},
-std::array<float,2>{0.200077459f, 0.903505325f},
-std::array<float,2>{0.563948631f, 0.8319996f},
-std::array<float,2>{0.0725319013f, 0.302605152f},
-std::array<float,2>{0.986129045f, 0.205808178f},
-std::array<float,2>{0.275943041f, 0.585462451f},
-std::array<float,2>{0.834687293f, 0.775212824f},
-std::array<float,2>{0.47763288f, 0.32179004f},
-std::array<float,2>{0.654825211f, 0.169053331f},
-std::array<float,2>{0.176997706f, 0.526969969f},
-std::array<float,2>{0.542933166f, 0.626364589f},
-std::array<float,2>{0.00731363567f, 0.0826287046f},
-std::array<float,2>{0.930335224f, 0.474918276f},
-std::array<float,2>{0.324840814f, 0.942630768f},
-std::array<float,2>{0.953599453f, 0.60414207f},
-std::array<float,2>{0.283741504f, 0.232764482f},
-std::array<float,2>{0.622291863f, 0.263263553f},
-std::array<float,2>{0.111059025f, 0.872277975f},
-std::array<float,2>{0.741235495f, 0.93738395f},
-std::array<float,2>{0.232015491f, 0.416386157f},
-std::array<float,2>{0.811231494f, 0.0299135298f},
-std::array<float,2>{0.414126456f, 0.726141036f},
-std::array<float,2>{0.793827415f, 0.883382142f},
-std::array<float,2>{0.434721768f, 0.38352403f},
-std::array<float,2>{0.733933747f, 0.0369548202f},
-std::array<float,2>{0.240740061f, 0.688096762f},
-std::array<float,2>{0.602087379f, 0.56886816f},
-std::array<float,2>{0.0968003869f, 0.199845836f},
-std::array<float,2>{0.94736594f, 0.288356155f},
-std::array<float,2>{0.308207333f, 0.827598274f},
-std::array<float,2>{0.908981383f, 0.673008084f},
-std::array<float,2>{0.329314202f, 0.119185597f},
-std::array<float,2>{0.561183929f, 0.462652624f},
-std::array<float,2>{0.0276234392f, 0.997859061f},
-std::array<float,2>{0.634129107f, 0.811495125f},
-std::array<float,2>{0.170440391f, 0.355801076f},
-std::array<float,2>{0.816062987f, 0.138168618f},
-std::array<float,2>{0.494344354f, 0.547274113f},
-std::array<float,2>{0.975490093f, 0.846133411f},
-std::array<float,2>{0.250866443f, 0.274127364f},
-std::array<float,2>{0.584725797f, 0.235650688f},
-std::array<float,2>{0.0867087618f, 0.617383599f},
-std::array<float,2>{0.688473225f, 0.737406373f},
-std::array<float,2>{0.204177186f, 0.000331665186f},
-std::array<float,2>{0.766780496f, 0.424538642f},
-std::array<float,2>{0.378286928f, 0.911675632f},
-std::array<float,2>{0.848647177f, 0.504900873f},
-std::array<float,2>{0.450317085f, 0.17771396f},
-std::array<float,2>{0.687116027f, 0.329874188f},
-std::array<float,2>{0.141913697f, 0.751588464f},
-std::array<float,2>{0.522875845f, 0.95832026f},
-std::array<float,2>{0.0388548262f, 0.484375387f},
-std::array<float,2>{0.903330386f, 0.0661991239f},
-std::array<float,2>{0.358361244f, 0.647262752f},
-std::array<float,2>{0.988636553f, 0.962908566f},
-std::array<float,2>{0.280629843f, 0.498056829f},
-std::array<float,2>{0.569423497f, 0.07756228f},
-std::array<float,2>{0.0759895593f, 0.655824244f},
-std::array<float,2>{0.706196427f, 0.509361804f},
-std::array<float,2>{0.198512465f, 0.184653372f},
-std::array<float,2>{0.759032428f, 0.33843416f},
-std::array<float,2>{0.395096511f, 0.758114755f},
-std::array<float,2>{0.872792482f, 0.745392382f},
-std::array<float,2>{0.458909333f, 0.00854033325f},
-std::array<float,2>{0.665106833f, 0.437148243f},
-std::array<float,2>{0.135435626f, 0.918614626f},
-std::array<float,2>{0.50193876f, 0.853578389f},
-std::array<float,2>{0.0501031205f, 0.271914393f},
-std::array<float,2>{0.889872551f, 0.246989071f},
-std::array<float,2>{0.374328375f, 0.614126325f},
-std::array<float,2>{0.805931151f, 0.799039245f},
-std::array<float,2>{0.421415478f, 0.347108424f},
-std::array<float,2>{0.737396896f, 0.132095203f},
-std::array<float,2>{0.228027612f, 0.556249559f},
-std::array<float,2>{0.620241225f, 0.682859123f},
-std::array<float,2>{0.116764106f, 0.113944322f},
-std::array<float,2>{0.959486008f, 0.458879113f},
-std::array<float,2>{0.286907822f, 0.989979088f},
-std::array<float,2>{0.935127676f, 0.573213458f},
-std::array<float,2>{0.322092682f, 0.192971304f},
-std::array<float,2>{0.543805599f, 0.289831609f},
-std::array<float,2>{0.000358197954f, 0.815747142f},
-std::array<float,2>{0.649705768f, 0.878830969f},
-std::array<float,2>{0.174546421f, 0.377548248f},
-std::array<float,2>{0.831683636f, 0.0440626517f},
-std::array<float,2>{0.484256864f, 0.696872771f},
-std::array<float,2>{0.817464232f, 0.92327255f},
-std::array<float,2>{0.498490691f, 0.413115859f},
-std::array<float,2>{0.638895929f, 0.017688917f},
-std::array<float,2>{0.166611671f, 0.731537938f},
-std::array<float,2>{0.556184888f, 0.596004903f},
-std::array<float,2>{0.0260341819f, 0.220399529f},
-std::array<float,2>{0.910961986f, 0.254227787f},
-std::array<float,2>{0.334763467f, 0.863888621f},
-std::array<float,2>{0.949402988f, 0.640120864f},
-std::array<float,2>{0.311145961f, 0.0913481042f},
-std::array<float,2>{0.606034636f, 0.478809506f},
-std::array<float,2>{0.101440176f, 0.946705401f},
-std::array<float,2>{0.726799428f, 0.766162336f},
-std::array<float,2>{0.237589836f, 0.312854826f},
-std::array<float,2>{0.791344762f, 0.162016571f},
-std::array<float,2>{0.430657923f, 0.520513952f},
-std::array<float,2>{0.899539351f, 0.841353238f},
-std::array<float,2>{0.354614615f, 0.308704585f},
-std::array<float,2>{0.51849252f, 0.21266517f},
-std::array<float,2>{0.0318333507f, 0.593240857f},
-std::array<float,2>{0.683415592f, 0.706787407f},
-std::array<float,2>{0.145976663f, 0.0517247878f},
-std::array<float,2>{0.845690727f, 0.400757134f},
-std::array<float,2>{0.445744932f, 0.895791948f},
-std::array<float,2>{0.771610022f, 0.541290045f},
-std::array<float,2>{0.379150271f, 0.142174274f},
-std::array<float,2>{0.693848491f, 0.373486131f},
-std::array<float,2>{0.207534298f, 0.785171628f},
-std::array<float,2>{0.581356049f, 0.971180797f},
-std::array<float,2>{0.0927563682f, 0.441928983f},
-std::array<float,2>{0.971174538f, 0.0949855298f},
-std::array<float,2>{0.256823599f, 0.664893091f},
-std::array<float,2>{0.918345094f, 0.899191976f},
-std::array<float,2>{0.336441785f, 0.398318559f},
-std::array<float,2>{0.554673731f, 0.0594416298f},
-std::array<float,2>{0.0208341498f, 0.716258407f},
-std::array<float,2>{0.626105487f, 0.578649342f},
-std::array<float,2>{0.156856775f, 0.2102139f},
-std::array<float,2>{0.824658096f, 0.297849834f},
-std::array<float,2>{0.487211138f, 0.833044589f},
-std::array<float,2>{0.788607359f, 0.660187423f},
-std::array<float,2>{0.426354259f, 0.104254015f},
-std::array<float,2>{0.720673501f, 0.451790005f},
-std::array<float,2>{0.247818723f, 0.983685493f},
-std::array<float,2>{0.5977332f, 0.793850958f},
-std::array<float,2>{0.102749206f, 0.363678247f},
-std::array<float,2>{0.943808615f, 0.150397614f},
-std::array<float,2>{0.302850425f, 0.531738043f},
-std::array<float,2>{0.857602537f, 0.871024847f},
-std::array<float,2>{0.437751889f, 0.258648515f},
-std::array<float,2>{0.677443206f, 0.22900553f},
-std::array<float,2>{0.15334022f, 0.608079433f},
-std::array<float,2>{0.529172838f, 0.719091654f},
-std::array<float,2>{0.0468019284f, 0.0241002329f},
-std::array<float,2>{0.895776033f, 0.421396166f},
-std::array<float,2>{0.345503002f, 0.932790518f},
-std::array<float,2>{0.980626881f, 0.529941797f},
-std::array<float,2>{0.259880275f, 0.167241439f},
-std::array<float,2>{0.590125978f, 0.325735986f},
-std::array<float,2>{0.083456479f, 0.779882789f},
-std::array<float,2>{0.697259068f, 0.940223157f},
-std::array<float,2>{0.217258051f, 0.472487718f},
-std::array<float,2>{0.773997605f, 0.0819359571f},
-std::array<float,2>{0.386899859f, 0.630543888f},
-std::array<float,2>{0.750864267f, 0.994604886f},
-std::array<float,2>{0.404917508f, 0.465108365f},
-std::array<float,2>{0.713556588f, 0.124479301f},
-std::array<float,2>{0.187872365f, 0.678766668f},
-std::array<float,2>{0.576779366f, 0.553909838f},
-std::array<float,2>{0.0635115951f, 0.133049026f},
-std::array<float,2>{0.999072671f, 0.35490939f},
-std::array<float,2>{0.271267593f, 0.807851851f},
-std::array<float,2>{0.881194353f, 0.693205535f},
-std::array<float,2>{0.363627583f, 0.0328631587f},
-std::array<float,2>{0.509767294f, 0.389477968f},
-std::array<float,2>{0.0554140359f, 0.889137805f},
-std::array<float,2>{0.662641525f, 0.82051754f},
-std::array<float,2>{0.12743403f, 0.282582223f},
-std::array<float,2>{0.865384877f, 0.195336312f},
-std::array<float,2>{0.465769589f, 0.565715313f},
-std::array<float,2>{0.968051195f, 0.755261421f},
-std::array<float,2>{0.294845164f, 0.334814221f},
-std::array<float,2>{0.615264714f, 0.174812123f},
-std::array<float,2>{0.121942848f, 0.502623916f},
-std::array<float,2>{0.7432338f, 0.642494738f},
-std::array<float,2>{0.223618597f, 0.068999745f},
-std::array<float,2>{0.802453816f, 0.489288956f},
-std::array<float,2>{0.411538392f, 0.955287755f},
-std::array<float,2>{0.84115994f, 0.622770011f},
-std::array<float,2>{0.473360896f, 0.239848822f},
-std::array<float,2>{0.643043458f, 0.278814912f},
-std::array<float,2>{0.183890879f, 0.850579798f},
-std::array<float,2>{0.534424543f, 0.909712434f},
-std::array<float,2>{0.0128036216f, 0.426250935f},
-std::array<float,2>{0.9270733f, 0.00460069347f},
-std::array<float,2>{0.316934317f, 0.739383042f},
-std::array<float,2>{0.963140309f, 0.893012881f},
-std::array<float,2>{0.292299986f, 0.40466857f},
-std::array<float,2>{0.612295866f, 0.0505555943f},
-std::array<float,2>{0.117947765f, 0.710061967f},
-std::array<float,2>{0.747387826f, 0.589440823f},
-std::array<float,2>{0.221562296f, 0.218019724f},
-std::array<float,2>{0.798262775f, 0.30554688f},
-std::array<float,2>{0.408282071f, 0.836583495f},
-std::array<float,2>{0.836628139f, 0.670538068f},
-std::array<float,2>{0.469697028f, 0.09854462f},
-std::array<float,2>{0.646425962f, 0.437592566f},
-std::array<float,2>{0.182228521f, 0.975917339f},
-std::array<float,2>{0.536262453f, 0.7830742f},
-std::array<float,2>{0.0105241053f, 0.369996101f},
-std::array<float,2>{0.923236728f, 0.146939009f},
-std::array<float,2>{0.31629324f, 0.546592891f},
-std::array<float,2>{0.754407406f, 0.860210836f},
-std::array<float,2>{0.399695337f, 0.250083894f},
-std::array<float,2>{0.715761423f, 0.226367608f},
-std::array<float,2>{0.192917734f, 0.60153389f},
-std::array<float,2>{0.570924878f, 0.728974164f},
-std::array<float,2>{0.0699489415f, 0.0228441227f},
-std::array<float,2>{0.994119525f, 0.408410966f},
-std::array<float,2>{0.269129574f, 0.928770661f},
-std::array<float,2>{0.875674307f, 0.517654896f},
-std::array<float,2>{0.360458761f, 0.158570588f},
-std::array<float,2>{0.512246549f, 0.318904012f},
-std::array<float,2>{0.0622816347f, 0.770149052f},
-std::array<float,2>{0.658470809f, 0.950595081f},
-std::array<float,2>{0.132430136f, 0.48432526f},
-std::array<float,2>{0.862602532f, 0.0874795094f},
-std::array<float,2>{0.461602867f, 0.635956049f},
-std::array<float,2>{0.855076611f, 0.985108137f},
-std::array<float,2>{0.444596529f, 0.454497188f},
-std::array<float,2>{0.67249769f, 0.111861698f},
-std::array<float,2>{0.149923325f, 0.687456667f},
-std::array<float,2>{0.525834143f, 0.561268508f},
-std::array<float,2>{0.0415524766f, 0.125890017f},
-std::array<float,2>{0.892655075f, 0.348937392f},
-std::array<float,2>{0.348240197f, 0.802931726f},
-std::array<float,2>{0.980115056f, 0.70125705f},
-std::array<float,2>{0.264268726f, 0.0391731225f},
-std::array<float,2>{0.587654293f, 0.382467836f},
-std::array<float,2>{0.0810540542f, 0.882533848f},
-std::array<float,2>{0.702283144f, 0.819091618f},
-std::array<float,2>{0.213667646f, 0.29447484f},
-std::array<float,2>{0.780257404f, 0.189240217f},
-std::array<float,2>{0.385638297f, 0.577670097f},
-std::array<float,2>{0.915349364f, 0.761997342f},
-std::array<float,2>{0.342390984f, 0.340749115f},
-std::array<float,2>{0.547775507f, 0.180847734f},
-std::array<float,2>{0.0187030379f, 0.514088035f},
-std::array<float,2>{0.629024744f, 0.648824096f},
-std::array<float,2>{0.160293803f, 0.0741185322f},
-std::array<float,2>{0.820443928f, 0.494314611f},
-std::array<float,2>{0.491631389f, 0.966428638f},
-std::array<float,2>{0.783340037f, 0.612148702f},
-std::array<float,2>{0.42407766f, 0.242279336f},
-std::array<float,2>{0.723994255f, 0.267717659f},
-std::array<float,2>{0.243932158f, 0.857787848f},
-std::array<float,2>{0.595451117f, 0.914868355f},
-std::array<float,2>{0.106499292f, 0.43214041f},
-std::array<float,2>{0.939785242f, 0.0147678517f},
-std::array<float,2>{0.298782349f, 0.749751568f},
-std::array<float,2>{0.902947426f, 0.960713744f},
-std::array<float,2>{0.359012991f, 0.487330556f},
-std::array<float,2>{0.521596611f, 0.0643301234f},
-std::array<float,2>{0.0379273184f, 0.64616096f},
-std::array<float,2>{0.685580909f, 0.507422268f},
-std::array<float,2>{0.141440213f, 0.177982524f},
-std::array<float,2>{0.848248661f, 0.330215961f},
-std::array<float,2>{0.450123072f, 0.752858698f},
-std::array<float,2>{0.766329825f, 0.734983087f},
-std::array<float,2>{0.377479613f, 0.00253119506f},
-std::array<float,2>{0.689243019f, 0.422503203f},
-std::array<float,2>{0.20316942f, 0.913775504f},
-std::array<float,2>{0.585412443f, 0.845053852f},
-std::array<float,2>{0.0869833529f, 0.276897728f},
-std::array<float,2>{0.976132989f, 0.237049699f},
-std::array<float,2>{0.251920253f, 0.619854629f},
-std::array<float,2>{0.815159142f, 0.809687972f},
-std::array<float,2>{0.495137393f, 0.358274102f},
-std::array<float,2>{0.633318961f, 0.140025899f},
-std::array<float,2>{0.171841234f, 0.549292684f},
-std::array<float,2>{0.561886787f, 0.675318778f},
-std::array<float,2>{0.0287899021f, 0.117394902f},
-std::array<float,2>{0.909228742f, 0.463889927f},
-std::array<float,2>{0.328653544f, 0.998303711f},
-std::array<float,2>{0.949090898f, 0.566523373f},
-std::array<float,2>{0.307265252f, 0.202450722f},
-std::array<float,2>{0.602573037f, 0.285540104f},
-std::array<float,2>{0.0960579813f, 0.825606048f},
-std::array<float,2>{0.732983112f, 0.886170626f},
-std::array<float,2>{0.242083043f, 0.385289997f},
-std::array<float,2>{0.794643402f, 0.0372417457f},
-std::array<float,2>{0.43450585f, 0.691029787f},
-std::array<float,2>{0.811740935f, 0.935143232f},
-std::array<float,2>{0.415469199f, 0.415441096f},
-std::array<float,2>{0.741127431f, 0.0289805233f},
-std::array<float,2>{0.230518728f, 0.722831607f},
-std::array<float,2>{0.621814013f, 0.601963341f},
-std::array<float,2>{0.110030904f, 0.230781093f},
-std::array<float,2>{0.95423162f, 0.264384061f},
-std::array<float,2>{0.284758925f, 0.874395907f},
-std::array<float,2>{0.931164205f, 0.627405167f},
-std::array<float,2>{0.325635016f, 0.0853242949f},
-std::array<float,2>{0.54145503f, 0.472777158f},
-std::array<float,2>{0.00650682626f, 0.944477558f},
-std::array<float,2>{0.656146467f, 0.77584368f},
-std::array<float,2>{0.176679179f, 0.322402239f},
-std::array<float,2>{0.835345387f, 0.170325845f},
-std::array<float,2>{0.477075577f, 0.524072766f},
-std::array<float,2>{0.98522836f, 0.82990694f},
-std::array<float,2>{0.276634276f, 0.30368343f},
-std::array<float,2>{0.562924266f, 0.203514278f},
-std::array<float,2>{0.0732590556f, 0.582122684f},
-std::array<float,2>{0.70849967f, 0.712607145f},
-std::array<float,2>{0.200293601f, 0.0565670468f},
-std::array<float,2>{0.765486121f, 0.390923113f},
-std::array<float,2>{0.394455522f, 0.905142546f},
-std::array<float,2>{0.870430291f, 0.536567032f},
-std::array<float,2>{0.45584476f, 0.154874831f},
-std::array<float,2>{0.669139624f, 0.361196995f},
-std::array<float,2>{0.140513733f, 0.79184413f},
-std::array<float,2>{0.505712509f, 0.979540944f},
-std::array<float,2>{0.0525250025f, 0.446225464f},
-std::array<float,2>{0.884774625f, 0.106355608f},
-std::array<float,2>{0.370368153f, 0.658447921f},
-std::array<float,2>{0.971852422f, 0.968808949f},
-std::array<float,2>{0.257483482f, 0.44463861f},
-std::array<float,2>{0.580241382f, 0.0963744894f},
-std::array<float,2>{0.0936519131f, 0.666220248f},
-std::array<float,2>{0.694895327f, 0.540330172f},
-std::array<float,2>{0.208527207f, 0.142621085f},
-std::array<float,2>{0.773383975f, 0.372196794f},
-std::array<float,2>{0.380397379f, 0.7872082f},
-std::array<float,2>{0.843941748f, 0.703901887f},
-std::array<float,2>{0.446699411f, 0.0533276498f},
-std::array<float,2>{0.681949973f, 0.399549872f},
-std::array<float,2>{0.144725695f, 0.897629023f},
-std::array<float,2>{0.518692434f, 0.84366858f},
-std::array<float,2>{0.032466732f, 0.311285764f},
-std::array<float,2>{0.89908874f, 0.21462369f},
-std::array<float,2>{0.353792846f, 0.590533197f},
-std::array<float,2>{0.792382121f, 0.768273234f},
-std::array<float,2>{0.431227744f, 0.31637454f},
-std::array<float,2>{0.728168547f, 0.162894562f},
-std::array<float,2>{0.236609563f, 0.522765577f},
-std::array<float,2>{0.606973231f, 0.637337923f},
-std::array<float,2>{0.100255333f, 0.0931515694f},
-std::array<float,2>{0.951063514f, 0.478289753f},
-std::array<float,2>{0.312368065f, 0.947555602f},
-std::array<float,2>{0.911193669f, 0.594686508f},
-std::array<float,2>{0.335567772f, 0.22238341f},
-std::array<float,2>{0.555133104f, 0.256467164f},
-std::array<float,2>{0.0272284709f, 0.86599803f},
-std::array<float,2>{0.640039623f, 0.925404429f},
-std::array<float,2>{0.167017341f, 0.410442412f},
-std::array<float,2>{0.816507697f, 0.0162610803f},
-std::array<float,2>{0.499763966f, 0.732664526f},
-std::array<float,2>{0.831045032f, 0.87673831f},
-std::array<float,2>{0.483045012f, 0.375810534f},
-std::array<float,2>{0.648629725f, 0.0453764461f},
-std::array<float,2>{0.175372332f, 0.698919713f},
-std::array<float,2>{0.544814765f, 0.572111547f},
-std::array<float,2>{0.00168927491f, 0.194977343f},
-std::array<float,2>{0.934446275f, 0.291211694f},
-std::array<float,2>{0.320615351f, 0.814024091f},
-std::array<float,2>{0.960468173f, 0.67971468f},
-std::array<float,2>{0.2852332f, 0.115588464f},
-std::array<float,2>{0.619509995f, 0.459137291f},
-std::array<float,2>{0.115947321f, 0.991955936f},
-std::array<float,2>{0.736393929f, 0.797346115f},
-std::array<float,2>{0.227404311f, 0.34483555f},
-std::array<float,2>{0.805044532f, 0.129661083f},
-std::array<float,2>{0.420370579f, 0.557608962f},
-std::array<float,2>{0.889285386f, 0.851700246f},
-std::array<float,2>{0.373315305f, 0.269985497f},
-std::array<float,2>{0.500841081f, 0.249566182f},
-std::array<float,2>{0.0492211878f, 0.616562963f},
-std::array<float,2>{0.664188445f, 0.743219078f},
-std::array<float,2>{0.136060923f, 0.0106880749f},
-std::array<float,2>{0.871267259f, 0.435256153f},
-std::array<float,2>{0.457812548f, 0.92146194f},
-std::array<float,2>{0.758013189f, 0.510648608f},
-std::array<float,2>{0.396138102f, 0.186289817f},
-std::array<float,2>{0.705326557f, 0.337298721f},
-std::array<float,2>{0.197802812f, 0.76039803f},
-std::array<float,2>{0.568497241f, 0.961876035f},
-std::array<float,2>{0.0742767155f, 0.498042226f},
-std::array<float,2>{0.990081429f, 0.0758923963f},
-std::array<float,2>{0.279337674f, 0.652716815f},
-std::array<float,2>{0.926694155f, 0.908138812f},
-std::array<float,2>{0.318172216f, 0.429499358f},
-std::array<float,2>{0.533693135f, 0.0064477683f},
-std::array<float,2>{0.0124011897f, 0.74084717f},
-std::array<float,2>{0.643787026f, 0.624747038f},
-std::array<float,2>{0.185374498f, 0.241239205f},
-std::array<float,2>{0.840296268f, 0.279798508f},
-std::array<float,2>{0.473818272f, 0.849348783f},
-std::array<float,2>{0.801368892f, 0.644145668f},
-std::array<float,2>{0.410436332f, 0.0668644309f},
-std::array<float,2>{0.742231131f, 0.491007298f},
-std::array<float,2>{0.223708585f, 0.953957319f},
-std::array<float,2>{0.616323948f, 0.757632971f},
-std::array<float,2>{0.1229081f, 0.332992017f},
-std::array<float,2>{0.966867507f, 0.17346397f},
-std::array<float,2>{0.293685049f, 0.501087606f},
-std::array<float,2>{0.867119968f, 0.823121369f},
-std::array<float,2>{0.466282964f, 0.285070747f},
-std::array<float,2>{0.663657248f, 0.19883503f},
-std::array<float,2>{0.128360286f, 0.563070416f},
-std::array<float,2>{0.511318922f, 0.695209742f},
-std::array<float,2>{0.0563666038f, 0.0337270796f},
-std::array<float,2>{0.882776618f, 0.386832386f},
-std::array<float,2>{0.364794523f, 0.88700074f},
-std::array<float,2>{0.998572052f, 0.551187754f},
-std::array<float,2>{0.270324796f, 0.136181563f},
-std::array<float,2>{0.577398956f, 0.352452666f},
-std::array<float,2>{0.0633837879f, 0.806206703f},
-std::array<float,2>{0.713905215f, 0.994124532f},
-std::array<float,2>{0.188757002f, 0.467378974f},
-std::array<float,2>{0.751780152f, 0.122617498f},
-std::array<float,2>{0.405802667f, 0.676383734f},
-std::array<float,2>{0.775287628f, 0.937992096f},
-std::array<float,2>{0.387833536f, 0.469856143f},
-std::array<float,2>{0.695603907f, 0.0790933371f},
-std::array<float,2>{0.218690425f, 0.631136775f},
-std::array<float,2>{0.591715097f, 0.527664185f},
-std::array<float,2>{0.0821568072f, 0.164442912f},
-std::array<float,2>{0.982385695f, 0.326989323f},
-std::array<float,2>{0.261270225f, 0.778872669f},
-std::array<float,2>{0.894868612f, 0.721249998f},
-std::array<float,2>{0.344008058f, 0.0261321943f},
-std::array<float,2>{0.527408421f, 0.418066651f},
-std::array<float,2>{0.0455337986f, 0.929897666f},
-std::array<float,2>{0.676456749f, 0.867569268f},
-std::array<float,2>{0.152890489f, 0.260293931f},
-std::array<float,2>{0.858588874f, 0.227078766f},
-std::array<float,2>{0.439299822f, 0.606802702f},
-std::array<float,2>{0.944607615f, 0.795237601f},
-std::array<float,2>{0.303929895f, 0.365441531f},
-std::array<float,2>{0.598973751f, 0.149139076f},
-std::array<float,2>{0.102491096f, 0.533430517f},
-std::array<float,2>{0.718807042f, 0.663262546f},
-std::array<float,2>{0.24613589f, 0.101595923f},
-std::array<float,2>{0.787677586f, 0.449471891f},
-std::array<float,2>{0.427665383f, 0.980585754f},
-std::array<float,2>{0.825327158f, 0.580890357f},
-std::array<float,2>{0.487897515f, 0.207363963f},
-std::array<float,2>{0.62528652f, 0.299533367f},
-std::array<float,2>{0.158196524f, 0.835103989f},
-std::array<float,2>{0.553119421f, 0.900970817f},
-std::array<float,2>{0.0197770018f, 0.395141304f},
-std::array<float,2>{0.919576526f, 0.0624514595f},
-std::array<float,2>{0.337535769f, 0.717285216f},
-std::array<float,2>{0.995257854f, 0.925920367f},
-std::array<float,2>{0.267188668f, 0.406526238f},
-std::array<float,2>{0.573046982f, 0.0208297707f},
-std::array<float,2>{0.0680489987f, 0.728177071f},
-std::array<float,2>{0.717933595f, 0.599339426f},
-std::array<float,2>{0.194160312f, 0.22423166f},
-std::array<float,2>{0.757125378f, 0.252789855f},
-std::array<float,2>{0.402005225f, 0.862651527f},
-std::array<float,2>{0.8602736f, 0.633631408f},
-std::array<float,2>{0.463136941f, 0.0879247412f},
-std::array<float,2>{0.656669378f, 0.480531186f},
-std::array<float,2>{0.13079153f, 0.951268852f},
-std::array<float,2>{0.514722228f, 0.772135854f},
-std::array<float,2>{0.0597460903f, 0.317672282f},
-std::array<float,2>{0.877132297f, 0.157727838f},
-std::array<float,2>{0.361769378f, 0.517135859f},
-std::array<float,2>{0.800630212f, 0.839097798f},
-std::array<float,2>{0.407837361f, 0.308294833f},
-std::array<float,2>{0.74897337f, 0.216746509f},
-std::array<float,2>{0.219230294f, 0.586026609f},
-std::array<float,2>{0.609379768f, 0.707733631f},
-std::array<float,2>{0.120830603f, 0.047810439f},
-std::array<float,2>{0.961118102f, 0.403677225f},
-std::array<float,2>{0.289289325f, 0.892455399f},
-std::array<float,2>{0.924571931f, 0.543485165f},
-std::array<float,2>{0.314334095f, 0.1464369f},
-std::array<float,2>{0.537739873f, 0.36795339f},
-std::array<float,2>{0.00914597418f, 0.784352422f},
-std::array<float,2>{0.646723747f, 0.973909259f},
-std::array<float,2>{0.179726496f, 0.439942002f},
-std::array<float,2>{0.838861942f, 0.0999909565f},
-std::array<float,2>{0.470779747f, 0.668104291f},
-std::array<float,2>{0.822820604f, 0.967212141f},
-std::array<float,2>{0.48935464f, 0.492600739f},
-std::array<float,2>{0.631209552f, 0.0705865845f},
-std::array<float,2>{0.163119406f, 0.651539505f},
-std::array<float,2>{0.550568223f, 0.512926221f},
-std::array<float,2>{0.016407147f, 0.181991816f},
-std::array<float,2>{0.917313695f, 0.342814267f},
-std::array<float,2>{0.340191901f, 0.764500797f},
-std::array<float,2>{0.939351559f, 0.747460842f},
-std::array<float,2>{0.300429612f, 0.0127714239f},
-std::array<float,2>{0.596268117f, 0.430416107f},
-std::array<float,2>{0.107761793f, 0.917599499f},
-std::array<float,2>{0.726321042f, 0.856399477f},
-std::array<float,2>{0.244951516f, 0.266550422f},
-std::array<float,2>{0.783182681f, 0.24577114f},
-std::array<float,2>{0.42373395f, 0.609389007f},
-std::array<float,2>{0.891245604f, 0.801034153f},
-std::array<float,2>{0.350530267f, 0.350169361f},
-std::array<float,2>{0.524138331f, 0.127320066f},
-std::array<float,2>{0.0398925617f, 0.559131026f},
-std::array<float,2>{0.674014449f, 0.68489486f},
-std::array<float,2>{0.150758252f, 0.110507041f},
-std::array<float,2>{0.852299988f, 0.455379754f},
-std::array<float,2>{0.442165703f, 0.988107204f},
-std::array<float,2>{0.777464747f, 0.575084865f},
-std::array<float,2>{0.384728491f, 0.190323815f},
-std::array<float,2>{0.700987816f, 0.295669734f},
-std::array<float,2>{0.212138936f, 0.818070769f},
-std::array<float,2>{0.588494062f, 0.880524933f},
-std::array<float,2>{0.0795566663f, 0.379139692f},
-std::array<float,2>{0.978039145f, 0.0415236168f},
-std::array<float,2>{0.262289405f, 0.699281991f},
-std::array<float,2>{0.907088876f, 0.996682584f},
-std::array<float,2>{0.331703931f, 0.461865664f},
-std::array<float,2>{0.559879303f, 0.120235115f},
-std::array<float,2>{0.0309068728f, 0.672729313f},
-std::array<float,2>{0.635231555f, 0.548329592f},
-std::array<float,2>{0.168767229f, 0.137583062f},
-std::array<float,2>{0.812700093f, 0.356508702f},
-std::array<float,2>{0.493847936f, 0.81221509f},
-std::array<float,2>{0.796155989f, 0.688585877f},
-std::array<float,2>{0.436650008f, 0.0353651978f},
-std::array<float,2>{0.731235325f, 0.384171486f},
-std::array<float,2>{0.239591613f, 0.884030998f},
-std::array<float,2>{0.604002774f, 0.826746881f},
-std::array<float,2>{0.0952503532f, 0.287483782f},
-std::array<float,2>{0.946382642f, 0.200303063f},
-std::array<float,2>{0.305770516f, 0.570109129f},
-std::array<float,2>{0.849696815f, 0.750849068f},
-std::array<float,2>{0.453055412f, 0.329095215f},
-std::array<float,2>{0.685186505f, 0.176531494f},
-std::array<float,2>{0.143721953f, 0.504193544f},
-std::array<float,2>{0.52110815f, 0.648327231f},
-std::array<float,2>{0.0352226011f, 0.0645473227f},
-std::array<float,2>{0.905560851f, 0.486310273f},
-std::array<float,2>{0.356853127f, 0.957624257f},
-std::array<float,2>{0.973684251f, 0.618426859f},
-std::array<float,2>{0.252993166f, 0.234868556f},
-std::array<float,2>{0.583781898f, 0.274769485f},
-std::array<float,2>{0.0894392729f, 0.846966684f},
-std::array<float,2>{0.690040767f, 0.910710156f},
-std::array<float,2>{0.205360219f, 0.425174087f},
-std::array<float,2>{0.76896131f, 0.00189211825f},
-std::array<float,2>{0.376496196f, 0.736853778f},
-std::array<float,2>{0.763176024f, 0.90289712f},
-std::array<float,2>{0.390728444f, 0.394122243f},
-std::array<float,2>{0.709527135f, 0.0569839031f},
-std::array<float,2>{0.202071115f, 0.713225901f},
-std::array<float,2>{0.565035641f, 0.584684312f},
-std::array<float,2>{0.0718490407f, 0.206426904f},
-std::array<float,2>{0.987803757f, 0.301352024f},
-std::array<float,2>{0.273529679f, 0.830567181f},
-std::array<float,2>{0.883482039f, 0.657393932f},
-std::array<float,2>{0.369130224f, 0.108534351f},
-std::array<float,2>{0.507741213f, 0.448190689f},
-std::array<float,2>{0.0533007681f, 0.978191614f},
-std::array<float,2>{0.67065835f, 0.789467216f},
-std::array<float,2>{0.137308672f, 0.362151176f},
-std::array<float,2>{0.86819452f, 0.153829306f},
-std::array<float,2>{0.454152912f, 0.537357807f},
-std::array<float,2>{0.955818176f, 0.871585846f},
-std::array<float,2>{0.281723827f, 0.262491405f},
-std::array<float,2>{0.624333203f, 0.233483642f},
-std::array<float,2>{0.112551585f, 0.604561388f},
-std::array<float,2>{0.739573896f, 0.725121856f},
-std::array<float,2>{0.233431146f, 0.0311583951f},
-std::array<float,2>{0.808797896f, 0.417953223f},
-std::array<float,2>{0.416162521f, 0.935659766f},
-std::array<float,2>{0.832356095f, 0.525901854f},
-std::array<float,2>{0.478847891f, 0.168774724f},
-std::array<float,2>{0.652841449f, 0.320392549f},
-std::array<float,2>{0.179389566f, 0.774087012f},
-std::array<float,2>{0.540901959f, 0.942282319f},
-std::array<float,2>{0.00469389278f, 0.475993872f},
-std::array<float,2>{0.93219614f, 0.0832743794f},
-std::array<float,2>{0.327731043f, 0.625498474f},
-std::array<float,2>{0.951723278f, 0.945368826f},
-std::array<float,2>{0.309684843f, 0.480126888f},
-std::array<float,2>{0.608224988f, 0.089961879f},
-std::array<float,2>{0.099472791f, 0.63929975f},
-std::array<float,2>{0.730300486f, 0.519634068f},
-std::array<float,2>{0.234693617f, 0.160687596f},
-std::array<float,2>{0.789256871f, 0.31436491f},
-std::array<float,2>{0.43216303f, 0.767220497f},
-std::array<float,2>{0.819586694f, 0.730990946f},
-std::array<float,2>{0.497788429f, 0.0190002453f},
-std::array<float,2>{0.637600958f, 0.412862062f},
-std::array<float,2>{0.165952057f, 0.921989858f},
-std::array<float,2>{0.557543218f, 0.864660621f},
-std::array<float,2>{0.0248655248f, 0.255524427f},
-std::array<float,2>{0.913032949f, 0.218849376f},
-std::array<float,2>{0.332673669f, 0.597154915f},
-std::array<float,2>{0.769952834f, 0.78664881f},
-std::array<float,2>{0.381837428f, 0.374422431f},
-std::array<float,2>{0.692116082f, 0.141148955f},
-std::array<float,2>{0.21022962f, 0.54217875f},
-std::array<float,2>{0.579930425f, 0.665085137f},
-std::array<float,2>{0.0916212052f, 0.0946175531f},
-std::array<float,2>{0.970231652f, 0.443320543f},
-std::array<float,2>{0.255801439f, 0.972254753f},
-std::array<float,2>{0.900984049f, 0.592183709f},
-std::array<float,2>{0.353241712f, 0.211294904f},
-std::array<float,2>{0.515803874f, 0.309612751f},
-std::array<float,2>{0.0336414576f, 0.839917362f},
-std::array<float,2>{0.679819405f, 0.895412803f},
-std::array<float,2>{0.147335276f, 0.402340531f},
-std::array<float,2>{0.846486449f, 0.0526150949f},
-std::array<float,2>{0.448823661f, 0.705140173f},
-std::array<float,2>{0.873442829f, 0.919347584f},
-std::array<float,2>{0.460137933f, 0.435718119f},
-std::array<float,2>{0.667015195f, 0.00902539957f},
-std::array<float,2>{0.13317059f, 0.74453789f},
-std::array<float,2>{0.502928555f, 0.614997208f},
-std::array<float,2>{0.0472956635f, 0.24753578f},
-std::array<float,2>{0.88825798f, 0.273114741f},
-std::array<float,2>{0.371983588f, 0.85544771f},
-std::array<float,2>{0.991122663f, 0.655209601f},
-std::array<float,2>{0.278425157f, 0.0761954635f},
-std::array<float,2>{0.566998959f, 0.499841183f},
-std::array<float,2>{0.0767569095f, 0.964830995f},
-std::array<float,2>{0.703616023f, 0.759056151f},
-std::array<float,2>{0.195655167f, 0.339074165f},
-std::array<float,2>{0.760885298f, 0.18391569f},
-std::array<float,2>{0.396698207f, 0.508289397f},
-std::array<float,2>{0.935647845f, 0.815017283f},
-std::array<float,2>{0.322647303f, 0.290306121f},
-std::array<float,2>{0.545053482f, 0.19180201f},
-std::array<float,2>{0.00219853874f, 0.57343781f},
-std::array<float,2>{0.651245654f, 0.695584595f},
-std::array<float,2>{0.172135964f, 0.0438037701f},
-std::array<float,2>{0.829817593f, 0.377986461f},
-std::array<float,2>{0.482225984f, 0.877614856f},
-std::array<float,2>{0.807509124f, 0.555012226f},
-std::array<float,2>{0.419861823f, 0.131549492f},
-std::array<float,2>{0.736013949f, 0.345990479f},
-std::array<float,2>{0.230393916f, 0.800206304f},
-std::array<float,2>{0.617416561f, 0.989021778f},
-std::array<float,2>{0.113997519f, 0.457862139f},
-std::array<float,2>{0.95789665f, 0.115087241f},
-std::array<float,2>{0.288888574f, 0.682199955f},
-std::array<float,2>{0.879055917f, 0.890308917f},
-std::array<float,2>{0.366527408f, 0.390554845f},
-std::array<float,2>{0.508845448f, 0.0313252695f},
-std::array<float,2>{0.0582671277f, 0.69219774f},
-std::array<float,2>{0.660322368f, 0.565155685f},
-std::array<float,2>{0.125861838f, 0.197030202f},
-std::array<float,2>{0.864735067f, 0.28184855f},
-std::array<float,2>{0.466946334f, 0.821620703f},
-std::array<float,2>{0.752031147f, 0.677878618f},
-std::array<float,2>{0.402555645f, 0.123738952f},
-std::array<float,2>{0.712462544f, 0.466446221f},
-std::array<float,2>{0.19130832f, 0.995169163f},
-std::array<float,2>{0.575178444f, 0.8067258f},
-std::array<float,2>{0.0658330992f, 0.354358166f},
-std::array<float,2>{0.996485949f, 0.134431332f},
-std::array<float,2>{0.271629989f, 0.553338766f},
-std::array<float,2>{0.842203796f, 0.850868404f},
-std::array<float,2>{0.475696683f, 0.27736631f},
-std::array<float,2>{0.641981781f, 0.238520801f},
-std::array<float,2>{0.186106741f, 0.621344984f},
-std::array<float,2>{0.532003939f, 0.738957524f},
-std::array<float,2>{0.0148817208f, 0.00529800029f},
-std::array<float,2>{0.929306209f, 0.427670479f},
-std::array<float,2>{0.31954214f, 0.908738136f},
-std::array<float,2>{0.966570139f, 0.503067493f},
-std::array<float,2>{0.296305895f, 0.174733907f},
-std::array<float,2>{0.614723921f, 0.335915357f},
-std::array<float,2>{0.12407589f, 0.753938079f},
-std::array<float,2>{0.744155884f, 0.956296563f},
-std::array<float,2>{0.225746602f, 0.488794059f},
-std::array<float,2>{0.803068757f, 0.0698572919f},
-std::array<float,2>{0.413113981f, 0.641584277f},
-std::array<float,2>{0.785910964f, 0.983025491f},
-std::array<float,2>{0.429078221f, 0.452825516f},
-std::array<float,2>{0.721722126f, 0.105413422f},
-std::array<float,2>{0.248647004f, 0.661681533f},
-std::array<float,2>{0.601192117f, 0.532237291f},
-std::array<float,2>{0.104942255f, 0.151968345f},
-std::array<float,2>{0.942156196f, 0.364432752f},
-std::array<float,2>{0.300796539f, 0.794796944f},
-std::array<float,2>{0.920280635f, 0.715644717f},
-std::array<float,2>{0.339207351f, 0.0598283894f},
-std::array<float,2>{0.551446974f, 0.39707467f},
-std::array<float,2>{0.0219464917f, 0.899727523f},
-std::array<float,2>{0.628712296f, 0.832954824f},
-std::array<float,2>{0.159596711f, 0.297880799f},
-std::array<float,2>{0.826256037f, 0.20927766f},
-std::array<float,2>{0.484821826f, 0.579333723f},
-std::array<float,2>{0.982806623f, 0.781157196f},
-std::array<float,2>{0.258223265f, 0.324376494f},
-std::array<float,2>{0.592769384f, 0.166229442f},
-std::array<float,2>{0.0850464255f, 0.53090328f},
-std::array<float,2>{0.697464406f, 0.629525721f},
-std::array<float,2>{0.216630965f, 0.0801128596f},
-std::array<float,2>{0.775711656f, 0.471039653f},
-std::array<float,2>{0.390507132f, 0.941293538f},
-std::array<float,2>{0.8563568f, 0.608592868f},
-std::array<float,2>{0.439474136f, 0.229839638f},
-std::array<float,2>{0.678226471f, 0.258803368f},
-std::array<float,2>{0.156190962f, 0.869733393f},
-std::array<float,2>{0.529507995f, 0.931953728f},
-std::array<float,2>{0.0433270745f, 0.420355976f},
-std::array<float,2>{0.897170901f, 0.0248492677f},
-std::array<float,2>{0.346129149f, 0.719969153f},
-std::array<float,2>{0.987338543f, 0.904498637f},
-std::array<float,2>{0.274055541f, 0.391194463f},
-std::array<float,2>{0.564457953f, 0.0560637526f},
-std::array<float,2>{0.0714018047f, 0.712012529f},
-std::array<float,2>{0.709056735f, 0.582682848f},
-std::array<float,2>{0.201395959f, 0.20390673f},
-std::array<float,2>{0.76366514f, 0.302909583f},
-std::array<float,2>{0.391237378f, 0.829152405f},
-std::array<float,2>{0.869069993f, 0.659156919f},
-std::array<float,2>{0.45481196f, 0.105674088f},
-std::array<float,2>{0.670354009f, 0.445554137f},
-std::array<float,2>{0.136908546f, 0.980387449f},
-std::array<float,2>{0.50692004f, 0.791181326f},
-std::array<float,2>{0.0530893877f, 0.360829562f},
-std::array<float,2>{0.883181036f, 0.154689819f},
-std::array<float,2>{0.368324518f, 0.537034273f},
-std::array<float,2>{0.809139132f, 0.874907672f},
-std::array<float,2>{0.416633666f, 0.263857514f},
-std::array<float,2>{0.739990294f, 0.231063694f},
-std::array<float,2>{0.234139726f, 0.602483153f},
-std::array<float,2>{0.624934316f, 0.723151803f},
-std::array<float,2>{0.112955131f, 0.0286402665f},
-std::array<float,2>{0.955474913f, 0.415836781f},
-std::array<float,2>{0.282150835f, 0.934573829f},
-std::array<float,2>{0.931883693f, 0.523631275f},
-std::array<float,2>{0.327228606f, 0.170830548f},
-std::array<float,2>{0.540428817f, 0.323103905f},
-std::array<float,2>{0.00422294252f, 0.776219726f},
-std::array<float,2>{0.652464986f, 0.944978237f},
-std::array<float,2>{0.178885922f, 0.473162204f},
-std::array<float,2>{0.83253473f, 0.0856369063f},
-std::array<float,2>{0.479416579f, 0.627789259f},
-std::array<float,2>{0.813177466f, 0.998902082f},
-std::array<float,2>{0.493448883f, 0.464565158f},
-std::array<float,2>{0.635350943f, 0.117899217f},
-std::array<float,2>{0.168308377f, 0.674869895f},
-std::array<float,2>{0.560414016f, 0.549559891f},
-std::array<float,2>{0.0306799971f, 0.140386552f},
-std::array<float,2>{0.906543672f, 0.357723475f},
-std::array<float,2>{0.331336558f, 0.810089409f},
-std::array<float,2>{0.946959913f, 0.690632641f},
-std::array<float,2>{0.306498826f, 0.0376542695f},
-std::array<float,2>{0.604267299f, 0.384939343f},
-std::array<float,2>{0.0948859975f, 0.886383116f},
-std::array<float,2>{0.730589986f, 0.825828135f},
-std::array<float,2>{0.239769116f, 0.285993546f},
-std::array<float,2>{0.796633065f, 0.2029607f},
-std::array<float,2>{0.437189072f, 0.56720221f},
-std::array<float,2>{0.905937433f, 0.752342403f},
-std::array<float,2>{0.357034624f, 0.330740362f},
-std::array<float,2>{0.520804942f, 0.178596526f},
-std::array<float,2>{0.0356956311f, 0.507276475f},
-std::array<float,2>{0.685014904f, 0.645655513f},
-std::array<float,2>{0.144477114f, 0.0637304261f},
-std::array<float,2>{0.850293577f, 0.487879127f},
-std::array<float,2>{0.452418387f, 0.960344315f},
-std::array<float,2>{0.769495249f, 0.619578779f},
-std::array<float,2>{0.37601316f, 0.236693427f},
-std::array<float,2>{0.689721227f, 0.276739895f},
-std::array<float,2>{0.205676332f, 0.845588207f},
-std::array<float,2>{0.583313048f, 0.913286805f},
-std::array<float,2>{0.0889378339f, 0.422361791f},
-std::array<float,2>{0.9742589f, 0.00239448994f},
-std::array<float,2>{0.253789812f, 0.73451221f},
-std::array<float,2>{0.917660892f, 0.966020942f},
-std::array<float,2>{0.340527654f, 0.495058f},
-std::array<float,2>{0.54981339f, 0.0734716132f},
-std::array<float,2>{0.0161051732f, 0.648962438f},
-std::array<float,2>{0.631586134f, 0.514345348f},
-std::array<float,2>{0.163978174f, 0.181331411f},
-std::array<float,2>{0.822454333f, 0.340009034f},
-std::array<float,2>{0.489906818f, 0.762473881f},
-std::array<float,2>{0.782632887f, 0.749127269f},
-std::array<float,2>{0.423236549f, 0.0151993064f},
-std::array<float,2>{0.725940406f, 0.431858808f},
-std::array<float,2>{0.244293153f, 0.914116085f},
-std::array<float,2>{0.595817626f, 0.858310878f},
-std::array<float,2>{0.108103149f, 0.268188834f},
-std::array<float,2>{0.938921809f, 0.243131056f},
-std::array<float,2>{0.300275713f, 0.611779451f},
-std::array<float,2>{0.851629913f, 0.803576589f},
-std::array<float,2>{0.441574156f, 0.349506497f},
-std::array<float,2>{0.674413085f, 0.12508443f},
-std::array<float,2>{0.150901616f, 0.560566366f},
-std::array<float,2>{0.523580194f, 0.686839461f},
-std::array<float,2>{0.0391409136f, 0.111534059f},
-std::array<float,2>{0.890951514f, 0.454951614f},
-std::array<float,2>{0.349996209f, 0.984855771f},
-std::array<float,2>{0.977775991f, 0.577602744f},
-std::array<float,2>{0.26204893f, 0.188695297f},
-std::array<float,2>{0.588060737f, 0.294102848f},
-std::array<float,2>{0.0799467117f, 0.818628192f},
-std::array<float,2>{0.700551748f, 0.881895781f},
-std::array<float,2>{0.212418675f, 0.381932735f},
-std::array<float,2>{0.7780931f, 0.0397390239f},
-std::array<float,2>{0.383987904f, 0.701769829f},
-std::array<float,2>{0.75749135f, 0.929683745f},
-std::array<float,2>{0.401655525f, 0.409019142f},
-std::array<float,2>{0.718529344f, 0.0233585928f},
-std::array<float,2>{0.193670094f, 0.729321301f},
-std::array<float,2>{0.572396398f, 0.600933909f},
-std::array<float,2>{0.0676516593f, 0.226005465f},
-std::array<float,2>{0.996093214f, 0.250835121f},
-std::array<float,2>{0.266936243f, 0.859426558f},
-std::array<float,2>{0.877679288f, 0.636234641f},
-std::array<float,2>{0.361979812f, 0.0870257393f},
-std::array<float,2>{0.51524955f, 0.483777344f},
-std::array<float,2>{0.0602855198f, 0.951052785f},
-std::array<float,2>{0.656884789f, 0.769850791f},
-std::array<float,2>{0.130127773f, 0.31877476f},
-std::array<float,2>{0.859740198f, 0.158838838f},
-std::array<float,2>{0.463790715f, 0.518227458f},
-std::array<float,2>{0.961861074f, 0.836238921f},
-std::array<float,2>{0.289757133f, 0.305090427f},
-std::array<float,2>{0.610059321f, 0.2187161f},
-std::array<float,2>{0.120516323f, 0.588959575f},
-std::array<float,2>{0.748258889f, 0.710931659f},
-std::array<float,2>{0.219651952f, 0.0499391668f},
-std::array<float,2>{0.800107896f, 0.40483135f},
-std::array<float,2>{0.407672495f, 0.893492162f},
-std::array<float,2>{0.83817625f, 0.546156108f},
-std::array<float,2>{0.471431732f, 0.147262543f},
-std::array<float,2>{0.647383988f, 0.369345993f},
-std::array<float,2>{0.18036896f, 0.782396317f},
-std::array<float,2>{0.537417412f, 0.976392925f},
-std::array<float,2>{0.00941444468f, 0.438175052f},
-std::array<float,2>{0.923986375f, 0.0977035686f},
-std::array<float,2>{0.313925058f, 0.669957936f},
-std::array<float,2>{0.941511512f, 0.981206f},
-std::array<float,2>{0.301479667f, 0.449712634f},
-std::array<float,2>{0.600949585f, 0.1023385f},
-std::array<float,2>{0.105426013f, 0.663616717f},
-std::array<float,2>{0.722391367f, 0.533821881f},
-std::array<float,2>{0.248334035f, 0.148507342f},
-std::array<float,2>{0.785291672f, 0.366208941f},
-std::array<float,2>{0.429409772f, 0.795744359f},
-std::array<float,2>{0.82706368f, 0.717200696f},
-std::array<float,2>{0.485307842f, 0.0616552979f},
-std::array<float,2>{0.627970457f, 0.394819051f},
-std::array<float,2>{0.159989715f, 0.900820673f},
-std::array<float,2>{0.551248252f, 0.835655212f},
-std::array<float,2>{0.0222199559f, 0.299267173f},
-std::array<float,2>{0.920735776f, 0.207614496f},
-std::array<float,2>{0.339696825f, 0.580421925f},
-std::array<float,2>{0.776300073f, 0.778787911f},
-std::array<float,2>{0.389770776f, 0.326236397f},
-std::array<float,2>{0.697997749f, 0.164798215f},
-std::array<float,2>{0.2161984f, 0.527983725f},
-std::array<float,2>{0.591819942f, 0.631613314f},
-std::array<float,2>{0.0854963288f, 0.0783825442f},
-std::array<float,2>{0.983059466f, 0.470242381f},
-std::array<float,2>{0.258575827f, 0.937678933f},
-std::array<float,2>{0.896619499f, 0.607287049f},
-std::array<float,2>{0.346651077f, 0.226869106f},
-std::array<float,2>{0.529787958f, 0.259848237f},
-std::array<float,2>{0.0438991524f, 0.868002236f},
-std::array<float,2>{0.677828968f, 0.930523336f},
-std::array<float,2>{0.15533188f, 0.418479085f},
-std::array<float,2>{0.855834305f, 0.0256715026f},
-std::array<float,2>{0.440271437f, 0.72072196f},
-std::array<float,2>{0.86491257f, 0.887559414f},
-std::array<float,2>{0.467326462f, 0.387411654f},
-std::array<float,2>{0.660657585f, 0.0333443172f},
-std::array<float,2>{0.125025257f, 0.694339216f},
-std::array<float,2>{0.509743452f, 0.562845528f},
-std::array<float,2>{0.0577088818f, 0.19830896f},
-std::array<float,2>{0.879590333f, 0.284303635f},
-std::array<float,2>{0.36695978f, 0.822502732f},
-std::array<float,2>{0.996687233f, 0.676207304f},
-std::array<float,2>{0.272337109f, 0.122291528f},
-std::array<float,2>{0.574377f, 0.467047364f},
-std::array<float,2>{0.0662107468f, 0.993516088f},
-std::array<float,2>{0.71236372f, 0.805841088f},
-std::array<float,2>{0.190832719f, 0.351849765f},
-std::array<float,2>{0.752749562f, 0.136245683f},
-std::array<float,2>{0.402870446f, 0.551588118f},
-std::array<float,2>{0.929069817f, 0.849033833f},
-std::array<float,2>{0.319857866f, 0.279744357f},
-std::array<float,2>{0.531698763f, 0.241849229f},
-std::array<float,2>{0.0153900394f, 0.62440145f},
-std::array<float,2>{0.642342448f, 0.740561604f},
-std::array<float,2>{0.185791031f, 0.00607508933f},
-std::array<float,2>{0.842742026f, 0.428711265f},
-std::array<float,2>{0.476255327f, 0.907458901f},
-std::array<float,2>{0.803326786f, 0.501930654f},
-std::array<float,2>{0.413629472f, 0.173323497f},
-std::array<float,2>{0.744755626f, 0.332458615f},
-std::array<float,2>{0.22649768f, 0.756943226f},
-std::array<float,2>{0.614957273f, 0.953325927f},
-std::array<float,2>{0.124858528f, 0.490572512f},
-std::array<float,2>{0.96622026f, 0.0669285804f},
-std::array<float,2>{0.296548635f, 0.643729389f},
-std::array<float,2>{0.888035417f, 0.921362817f},
-std::array<float,2>{0.371257514f, 0.434635848f},
-std::array<float,2>{0.501961231f, 0.00980032142f},
-std::array<float,2>{0.0476670191f, 0.743970394f},
-std::array<float,2>{0.667669237f, 0.617107809f},
-std::array<float,2>{0.13368465f, 0.249282092f},
-std::array<float,2>{0.873999357f, 0.270323217f},
-std::array<float,2>{0.460640252f, 0.852349162f},
-std::array<float,2>{0.761481643f, 0.653013706f},
-std::array<float,2>{0.397404432f, 0.0754233971f},
-std::array<float,2>{0.703187883f, 0.497188866f},
-std::array<float,2>{0.195877165f, 0.961373448f},
-std::array<float,2>{0.566503584f, 0.760169804f},
-std::array<float,2>{0.0762855113f, 0.337633789f},
-std::array<float,2>{0.990299046f, 0.185883522f},
-std::array<float,2>{0.279239237f, 0.510001898f},
-std::array<float,2>{0.829218268f, 0.813905537f},
-std::array<float,2>{0.481621176f, 0.291775137f},
-std::array<float,2>{0.650436282f, 0.194364682f},
-std::array<float,2>{0.172740772f, 0.57136631f},
-std::array<float,2>{0.54553473f, 0.698609352f},
-std::array<float,2>{0.00263732951f, 0.0458734371f},
-std::array<float,2>{0.936508238f, 0.375309199f},
-std::array<float,2>{0.322869152f, 0.876019418f},
-std::array<float,2>{0.957227349f, 0.556742787f},
-std::array<float,2>{0.288348526f, 0.128977954f},
-std::array<float,2>{0.617829025f, 0.345575362f},
-std::array<float,2>{0.113491535f, 0.797586739f},
-std::array<float,2>{0.73569113f, 0.991497517f},
-std::array<float,2>{0.229700789f, 0.459836125f},
-std::array<float,2>{0.807085454f, 0.115951352f},
-std::array<float,2>{0.419341028f, 0.680437505f},
-std::array<float,2>{0.789774477f, 0.947848797f},
-std::array<float,2>{0.431901634f, 0.477863073f},
-std::array<float,2>{0.729530334f, 0.0932758152f},
-std::array<float,2>{0.23533693f, 0.636801958f},
-std::array<float,2>{0.607465625f, 0.523120463f},
-std::array<float,2>{0.098670572f, 0.162142172f},
-std::array<float,2>{0.951648474f, 0.315856546f},
-std::array<float,2>{0.310106516f, 0.767877936f},
-std::array<float,2>{0.912244022f, 0.732923567f},
-std::array<float,2>{0.332165122f, 0.0160933044f},
-std::array<float,2>{0.556834519f, 0.410971373f},
-std::array<float,2>{0.0250680614f, 0.925123811f},
-std::array<float,2>{0.636969626f, 0.865549326f},
-std::array<float,2>{0.165401325f, 0.255993456f},
-std::array<float,2>{0.820262313f, 0.222116321f},
-std::array<float,2>{0.497109592f, 0.59418726f},
-std::array<float,2>{0.970063031f, 0.787649214f},
-std::array<float,2>{0.255211025f, 0.372825563f},
-std::array<float,2>{0.579440773f, 0.143541202f},
-std::array<float,2>{0.0911131725f, 0.540836155f},
-std::array<float,2>{0.691787064f, 0.666645169f},
-std::array<float,2>{0.210921854f, 0.0959603935f},
-std::array<float,2>{0.770038962f, 0.445109636f},
-std::array<float,2>{0.382549137f, 0.969414592f},
-std::array<float,2>{0.845759511f, 0.590003729f},
-std::array<float,2>{0.448539555f, 0.214293301f},
-std::array<float,2>{0.680295527f, 0.310575277f},
-std::array<float,2>{0.146521524f, 0.842836261f},
-std::array<float,2>{0.516441405f, 0.898034394f},
-std::array<float,2>{0.0337487794f, 0.400276124f},
-std::array<float,2>{0.900711358f, 0.0528019965f},
-std::array<float,2>{0.35258323f, 0.703494549f},
-std::array<float,2>{0.95481354f, 0.936420858f},
-std::array<float,2>{0.284472376f, 0.417341322f},
-std::array<float,2>{0.621168971f, 0.0303067937f},
-std::array<float,2>{0.109651282f, 0.724958062f},
-std::array<float,2>{0.740620613f, 0.605121553f},
-std::array<float,2>{0.231003776f, 0.233925015f},
-std::array<float,2>{0.812375069f, 0.262039006f},
-std::array<float,2>{0.41563338f, 0.871472597f},
-std::array<float,2>{0.835888982f, 0.625351131f},
-std::array<float,2>{0.476664066f, 0.0839461982f},
-std::array<float,2>{0.655292928f, 0.476539135f},
-std::array<float,2>{0.175875381f, 0.941615522f},
-std::array<float,2>{0.541879058f, 0.773692846f},
-std::array<float,2>{0.00592916552f, 0.321186453f},
-std::array<float,2>{0.93114686f, 0.168316826f},
-std::array<float,2>{0.32604605f, 0.525506139f},
-std::array<float,2>{0.764897048f, 0.830344021f},
-std::array<float,2>{0.393998533f, 0.301158935f},
-std::array<float,2>{0.708206117f, 0.206840813f},
-std::array<float,2>{0.200745285f, 0.584122479f},
-std::array<float,2>{0.563421249f, 0.713760436f},
-std::array<float,2>{0.073964715f, 0.0575477071f},
-std::array<float,2>{0.984642804f, 0.393940806f},
-std::array<float,2>{0.277139038f, 0.902377546f},
-std::array<float,2>{0.885391057f, 0.537623525f},
-std::array<float,2>{0.370714694f, 0.153767943f},
-std::array<float,2>{0.505293071f, 0.361510515f},
-std::array<float,2>{0.052003812f, 0.789883673f},
-std::array<float,2>{0.669482112f, 0.977915585f},
-std::array<float,2>{0.139773592f, 0.447504669f},
-std::array<float,2>{0.870734453f, 0.109084576f},
-std::array<float,2>{0.455227196f, 0.658100843f},
-std::array<float,2>{0.847724438f, 0.957406461f},
-std::array<float,2>{0.449294299f, 0.485736012f},
-std::array<float,2>{0.686367333f, 0.0653035119f},
-std::array<float,2>{0.140798703f, 0.647904396f},
-std::array<float,2>{0.52200067f, 0.504455209f},
-std::array<float,2>{0.0371161699f, 0.175866842f},
-std::array<float,2>{0.902378142f, 0.328530699f},
-std::array<float,2>{0.358496994f, 0.750123799f},
-std::array<float,2>{0.975600898f, 0.736494303f},
-std::array<float,2>{0.251321286f, 0.00128382188f},
-std::array<float,2>{0.585577607f, 0.425565571f},
-std::array<float,2>{0.0875375867f, 0.910215855f},
-std::array<float,2>{0.688885331f, 0.847325981f},
-std::array<float,2>{0.203888595f, 0.274953663f},
-std::array<float,2>{0.765789568f, 0.234776914f},
-std::array<float,2>{0.377345324f, 0.618864655f},
-std::array<float,2>{0.909747362f, 0.811963916f},
-std::array<float,2>{0.32824567f, 0.357335746f},
-std::array<float,2>{0.562389433f, 0.136965901f},
-std::array<float,2>{0.0290851183f, 0.548599422f},
-std::array<float,2>{0.632915199f, 0.672003329f},
-std::array<float,2>{0.17131047f, 0.120985277f},
-std::array<float,2>{0.814701676f, 0.461063594f},
-std::array<float,2>{0.496035695f, 0.996490419f},
-std::array<float,2>{0.794168949f, 0.569506049f},
-std::array<float,2>{0.433986664f, 0.200921655f},
-std::array<float,2>{0.732591569f, 0.287899524f},
-std::array<float,2>{0.241424367f, 0.826570749f},
-std::array<float,2>{0.603121221f, 0.88476193f},
-std::array<float,2>{0.0965895951f, 0.384653419f},
-std::array<float,2>{0.948511899f, 0.0359435044f},
-std::array<float,2>{0.307078332f, 0.689274848f},
-std::array<float,2>{0.893130958f, 0.987709761f},
-std::array<float,2>{0.347836196f, 0.455776095f},
-std::array<float,2>{0.526302576f, 0.111260928f},
-std::array<float,2>{0.0411983952f, 0.685340047f},
-std::array<float,2>{0.672261894f, 0.558615208f},
-std::array<float,2>{0.149688274f, 0.127495661f},
-std::array<float,2>{0.854613245f, 0.349710137f},
-std::array<float,2>{0.445059001f, 0.801524341f},
-std::array<float,2>{0.779553294f, 0.700137854f},
-std::array<float,2>{0.385154366f, 0.0412441678f},
-std::array<float,2>{0.703102469f, 0.379874229f},
-std::array<float,2>{0.213109091f, 0.87996763f},
-std::array<float,2>{0.587039053f, 0.817740023f},
-std::array<float,2>{0.0805216655f, 0.295219392f},
-std::array<float,2>{0.979962766f, 0.189678356f},
-std::array<float,2>{0.263804048f, 0.574364424f},
-std::array<float,2>{0.821052909f, 0.764079988f},
-std::array<float,2>{0.49181056f, 0.343381613f},
-std::array<float,2>{0.629496336f, 0.182388008f},
-std::array<float,2>{0.160763428f, 0.513626814f},
-std::array<float,2>{0.547048151f, 0.651943922f},
-std::array<float,2>{0.0193956234f, 0.0708833486f},
-std::array<float,2>{0.915738285f, 0.492821246f},
-std::array<float,2>{0.342091054f, 0.967748582f},
-std::array<float,2>{0.939953744f, 0.610074282f},
-std::array<float,2>{0.29819259f, 0.245582029f},
-std::array<float,2>{0.595004737f, 0.265679896f},
-std::array<float,2>{0.107193649f, 0.855786264f},
-std::array<float,2>{0.724158704f, 0.917151451f},
-std::array<float,2>{0.243228957f, 0.430035979f},
-std::array<float,2>{0.783723474f, 0.0136546446f},
-std::array<float,2>{0.424657017f, 0.747778952f},
-std::array<float,2>{0.798487723f, 0.891747236f},
-std::array<float,2>{0.409018755f, 0.403958201f},
-std::array<float,2>{0.74796319f, 0.0472031049f},
-std::array<float,2>{0.22099638f, 0.707300186f},
-std::array<float,2>{0.611698091f, 0.586833954f},
-std::array<float,2>{0.11749807f, 0.216129273f},
-std::array<float,2>{0.963414967f, 0.307998687f},
-std::array<float,2>{0.29266125f, 0.839459002f},
-std::array<float,2>{0.923379719f, 0.668529093f},
-std::array<float,2>{0.315650553f, 0.100188963f},
-std::array<float,2>{0.536824286f, 0.439656854f},
-std::array<float,2>{0.00989533402f, 0.974548995f},
-std::array<float,2>{0.645894647f, 0.784909368f},
-std::array<float,2>{0.181788534f, 0.367233247f},
-std::array<float,2>{0.836163223f, 0.145810187f},
-std::array<float,2>{0.469112933f, 0.543406069f},
-std::array<float,2>{0.993519843f, 0.86317724f},
-std::array<float,2>{0.268856853f, 0.25209254f},
-std::array<float,2>{0.570710778f, 0.223788917f},
-std::array<float,2>{0.0696255341f, 0.598976791f},
-std::array<float,2>{0.715220749f, 0.727905571f},
-std::array<float,2>{0.192511082f, 0.0213612802f},
-std::array<float,2>{0.753940761f, 0.407008111f},
-std::array<float,2>{0.400015414f, 0.926652908f},
-std::array<float,2>{0.863263547f, 0.516999543f},
-std::array<float,2>{0.461329639f, 0.157703549f},
-std::array<float,2>{0.658924282f, 0.318255275f},
-std::array<float,2>{0.131951615f, 0.771617293f},
-std::array<float,2>{0.511880219f, 0.952027678f},
-std::array<float,2>{0.0618046373f, 0.481141925f},
-std::array<float,2>{0.875289738f, 0.0885134563f},
-std::array<float,2>{0.361132741f, 0.633057773f},
-std::array<float,2>{0.981648803f, 0.940524518f},
-std::array<float,2>{0.260917127f, 0.471494317f},
-std::array<float,2>{0.591159999f, 0.080596447f},
-std::array<float,2>{0.0830011442f, 0.629220545f},
-std::array<float,2>{0.696067035f, 0.53030479f},
-std::array<float,2>{0.218112662f, 0.16680935f},
-std::array<float,2>{0.774682879f, 0.324753314f},
-std::array<float,2>{0.388481617f, 0.780342519f},
-std::array<float,2>{0.859301388f, 0.720498502f},
-std::array<float,2>{0.438726038f, 0.0250740107f},
-std::array<float,2>{0.67617476f, 0.420506209f},
-std::array<float,2>{0.152671874f, 0.932597399f},
-std::array<float,2>{0.528288484f, 0.869183779f},
-std::array<float,2>{0.0449503101f, 0.259361982f},
-std::array<float,2>{0.895116806f, 0.23024109f},
-std::array<float,2>{0.344299078f, 0.608932495f},
-std::array<float,2>{0.787564456f, 0.794187427f},
-std::array<float,2>{0.42709747f, 0.365162522f},
-std::array<float,2>{0.719336033f, 0.15161635f},
-std::array<float,2>{0.246893674f, 0.532943964f},
-std::array<float,2>{0.599167287f, 0.661528051f},
-std::array<float,2>{0.101808667f, 0.104905613f},
-std::array<float,2>{0.944983304f, 0.452519327f},
-std::array<float,2>{0.304239511f, 0.982783556f},
-std::array<float,2>{0.919404626f, 0.579722226f},
-std::array<float,2>{0.337342173f, 0.209778607f},
-std::array<float,2>{0.553693652f, 0.298583627f},
-std::array<float,2>{0.0204931535f, 0.832177699f},
-std::array<float,2>{0.625695169f, 0.899918139f},
-std::array<float,2>{0.15728873f, 0.396732152f},
-std::array<float,2>{0.825929582f, 0.0600742586f},
-std::array<float,2>{0.487410873f, 0.715176523f},
-std::array<float,2>{0.840554714f, 0.908346534f},
-std::array<float,2>{0.474578381f, 0.427094221f},
-std::array<float,2>{0.64421767f, 0.00548822712f},
-std::array<float,2>{0.184868991f, 0.738592327f},
-std::array<float,2>{0.53355217f, 0.621707857f},
-std::array<float,2>{0.0120041342f, 0.238817289f},
-std::array<float,2>{0.925845802f, 0.278099656f},
-std::array<float,2>{0.317727417f, 0.851264894f},
-std::array<float,2>{0.967687726f, 0.640739739f},
-std::array<float,2>{0.293204159f, 0.0697612092f},
-std::array<float,2>{0.616885245f, 0.488675386f},
-std::array<float,2>{0.122253314f, 0.956578255f},
-std::array<float,2>{0.742858469f, 0.754682064f},
-std::array<float,2>{0.224385262f, 0.335125029f},
-std::array<float,2>{0.801153898f, 0.174236551f},
-std::array<float,2>{0.410667956f, 0.503626108f},
-std::array<float,2>{0.88191098f, 0.821838439f},
-std::array<float,2>{0.364513963f, 0.281255901f},
-std::array<float,2>{0.510820389f, 0.19667232f},
-std::array<float,2>{0.056123253f, 0.564628363f},
-std::array<float,2>{0.663441658f, 0.691609502f},
-std::array<float,2>{0.128499195f, 0.0318805948f},
-std::array<float,2>{0.866631329f, 0.389923096f},
-std::array<float,2>{0.466353327f, 0.889705598f},
-std::array<float,2>{0.751203597f, 0.553187728f},
-std::array<float,2>{0.405683577f, 0.134178489f},
-std::array<float,2>{0.714710832f, 0.353685111f},
-std::array<float,2>{0.189029232f, 0.807580411f},
-std::array<float,2>{0.577640355f, 0.995638728f},
-std::array<float,2>{0.0625296384f, 0.466067016f},
-std::array<float,2>{0.998450875f, 0.123373762f},
-std::array<float,2>{0.269639343f, 0.678319335f},
-std::array<float,2>{0.933853745f, 0.877220809f},
-std::array<float,2>{0.321064562f, 0.37848106f},
-std::array<float,2>{0.544402719f, 0.0431756601f},
-std::array<float,2>{0.00121549307f, 0.695826948f},
-std::array<float,2>{0.649040937f, 0.574039042f},
-std::array<float,2>{0.175032407f, 0.192026153f},
-std::array<float,2>{0.830245316f, 0.290779352f},
-std::array<float,2>{0.482620984f, 0.81483084f},
-std::array<float,2>{0.805253327f, 0.681965113f},
-std::array<float,2>{0.420763731f, 0.114616163f},
-std::array<float,2>{0.737267673f, 0.457409948f},
-std::array<float,2>{0.226636335f, 0.988769531f},
-std::array<float,2>{0.619832397f, 0.800576627f},
-std::array<float,2>{0.115269132f, 0.346670568f},
-std::array<float,2>{0.960222423f, 0.131248564f},
-std::array<float,2>{0.286046356f, 0.555238128f},
-std::array<float,2>{0.871766865f, 0.85481745f},
-std::array<float,2>{0.457376391f, 0.272535622f},
-std::array<float,2>{0.6649822f, 0.247895285f},
-std::array<float,2>{0.136427373f, 0.61437583f},
-std::array<float,2>{0.500364244f, 0.745095611f},
-std::array<float,2>{0.0494471341f, 0.00936889276f},
-std::array<float,2>{0.888966143f, 0.436226964f},
-std::array<float,2>{0.373568684f, 0.919879556f},
-std::array<float,2>{0.989472866f, 0.508756161f},
-std::array<float,2>{0.280029386f, 0.184228271f},
-std::array<float,2>{0.569287539f, 0.339687496f},
-std::array<float,2>{0.0748487711f, 0.759445369f},
-std::array<float,2>{0.705810368f, 0.964114845f},
-std::array<float,2>{0.197294593f, 0.499480486f},
-std::array<float,2>{0.758366764f, 0.0769903585f},
-std::array<float,2>{0.395650715f, 0.654336929f},
-std::array<float,2>{0.772766292f, 0.971961319f},
-std::array<float,2>{0.380257547f, 0.442417234f},
-std::array<float,2>{0.694471121f, 0.0940159708f},
-std::array<float,2>{0.208142757f, 0.665725648f},
-std::array<float,2>{0.580664456f, 0.542891681f},
-std::array<float,2>{0.0930067748f, 0.140803322f},
-std::array<float,2>{0.972458899f, 0.374656409f},
-std::array<float,2>{0.256871223f, 0.786614358f},
-std::array<float,2>{0.898549318f, 0.705575109f},
-std::array<float,2>{0.354231417f, 0.052062016f},
-std::array<float,2>{0.519191027f, 0.401552439f},
-std::array<float,2>{0.0327368267f, 0.894851685f},
-std::array<float,2>{0.682168126f, 0.840601623f},
-std::array<float,2>{0.145098493f, 0.31052345f},
-std::array<float,2>{0.844524145f, 0.211681083f},
-std::array<float,2>{0.44681856f, 0.592761934f},
-std::array<float,2>{0.950528562f, 0.767086744f},
-std::array<float,2>{0.311576277f, 0.313930571f},
-std::array<float,2>{0.606852293f, 0.160235673f},
-std::array<float,2>{0.099868387f, 0.520307064f},
-std::array<float,2>{0.727702975f, 0.639060557f},
-std::array<float,2>{0.237068295f, 0.0906857476f},
-std::array<float,2>{0.792558193f, 0.479842871f},
-std::array<float,2>{0.430888772f, 0.946012259f},
-std::array<float,2>{0.816915691f, 0.597587109f},
-std::array<float,2>{0.499371231f, 0.219430849f},
-std::array<float,2>{0.640243948f, 0.254916072f},
-std::array<float,2>{0.167839587f, 0.865114152f},
-std::array<float,2>{0.555537641f, 0.922590494f},
-std::array<float,2>{0.0267322101f, 0.412413597f},
-std::array<float,2>{0.911646307f, 0.0194209199f},
-std::array<float,2>{0.334974468f, 0.730857134f},
-std::array<float,2>{0.947834074f, 0.885590374f},
-std::array<float,2>{0.307764262f, 0.386602253f},
-std::array<float,2>{0.601823151f, 0.0386636406f},
-std::array<float,2>{0.0976295769f, 0.690390468f},
-std::array<float,2>{0.73382777f, 0.567576706f},
-std::array<float,2>{0.240511775f, 0.201970801f},
-std::array<float,2>{0.793401003f, 0.286176443f},
-std::array<float,2>{0.435313404f, 0.824396253f},
-std::array<float,2>{0.815784276f, 0.674542964f},
-std::array<float,2>{0.495018005f, 0.118626073f},
-std::array<float,2>{0.634458721f, 0.463139236f},
-std::array<float,2>{0.169958919f, 0.99985534f},
-std::array<float,2>{0.560669065f, 0.809494793f},
-std::array<float,2>{0.0279500727f, 0.35927552f},
-std::array<float,2>{0.908303499f, 0.138881788f},
-std::array<float,2>{0.329986781f, 0.549978733f},
-std::array<float,2>{0.767314017f, 0.844607949f},
-std::array<float,2>{0.378698111f, 0.276193351f},
-std::array<float,2>{0.687808275f, 0.238144711f},
-std::array<float,2>{0.204609528f, 0.620649457f},
-std::array<float,2>{0.584222615f, 0.73558706f},
-std::array<float,2>{0.0862053335f, 0.00379641214f},
-std::array<float,2>{0.974769056f, 0.423631221f},
-std::array<float,2>{0.250074267f, 0.913065672f},
-std::array<float,2>{0.90388763f, 0.506728649f},
-std::array<float,2>{0.357483506f, 0.178876862f},
-std::array<float,2>{0.523123682f, 0.331502706f},
-std::array<float,2>{0.0384718738f, 0.753779352f},
-std::array<float,2>{0.686797261f, 0.959763229f},
-std::array<float,2>{0.142093495f, 0.487089038f},
-std::array<float,2>{0.849350572f, 0.0629801899f},
-std::array<float,2>{0.450933039f, 0.644797683f},
-std::array<float,2>{0.869417906f, 0.978798151f},
-std::array<float,2>{0.456596404f, 0.446827173f},
-std::array<float,2>{0.668291926f, 0.107412875f},
-std::array<float,2>{0.13945888f, 0.660062015f},
-std::array<float,2>{0.504540503f, 0.53560394f},
-std::array<float,2>{0.0508094281f, 0.155774847f},
-std::array<float,2>{0.886642992f, 0.359909117f},
-std::array<float,2>{0.369895041f, 0.792818487f},
-std::array<float,2>{0.985506833f, 0.711047888f},
-std::array<float,2>{0.275735855f, 0.0550666936f},
-std::array<float,2>{0.564352155f, 0.392068982f},
-std::array<float,2>{0.0730984062f, 0.90532881f},
-std::array<float,2>{0.70758903f, 0.82849133f},
-std::array<float,2>{0.199327588f, 0.303716183f},
-std::array<float,2>{0.764612556f, 0.20427987f},
-std::array<float,2>{0.39287138f, 0.583309174f},
-std::array<float,2>{0.929703534f, 0.776501596f},
-std::array<float,2>{0.324626952f, 0.324078053f},
-std::array<float,2>{0.542336166f, 0.171690822f},
-std::array<float,2>{0.00738397473f, 0.524915636f},
-std::array<float,2>{0.65441829f, 0.628378808f},
-std::array<float,2>{0.17738758f, 0.0841118172f},
-std::array<float,2>{0.834260583f, 0.473975301f},
-std::array<float,2>{0.478061527f, 0.944047868f},
-std::array<float,2>{0.810973108f, 0.603408694f},
-std::array<float,2>{0.414692521f, 0.232045636f},
-std::array<float,2>{0.741744339f, 0.265478164f},
-std::array<float,2>{0.23152937f, 0.873601258f},
-std::array<float,2>{0.622583985f, 0.934566379f},
-std::array<float,2>{0.11075896f, 0.414700568f},
-std::array<float,2>{0.953796506f, 0.027963277f},
-std::array<float,2>{0.283262461f, 0.724042714f},
-std::array<float,2>{0.876757383f, 0.949229062f},
-std::array<float,2>{0.360270441f, 0.482506901f},
-std::array<float,2>{0.513207316f, 0.0859422088f},
-std::array<float,2>{0.0607350245f, 0.63555479f},
-std::array<float,2>{0.659873188f, 0.519056022f},
-std::array<float,2>{0.131212413f, 0.15965718f},
-std::array<float,2>{0.861396849f, 0.319728047f},
-std::array<float,2>{0.462201118f, 0.771046102f},
-std::array<float,2>{0.755518734f, 0.730098367f},
-std::array<float,2>{0.398810744f, 0.0222510286f},
-std::array<float,2>{0.716439009f, 0.410062492f},
-std::array<float,2>{0.192360967f, 0.928001881f},
-std::array<float,2>{0.571440935f, 0.860781848f},
-std::array<float,2>{0.0691580921f, 0.251054138f},
-std::array<float,2>{0.993101537f, 0.224652022f},
-std::array<float,2>{0.26852861f, 0.599861503f},
-std::array<float,2>{0.83736515f, 0.781400502f},
-std::array<float,2>{0.470200837f, 0.370304585f},
-std::array<float,2>{0.645456731f, 0.14802058f},
-std::array<float,2>{0.1827555f, 0.545121074f},
-std::array<float,2>{0.536086857f, 0.671291709f},
-std::array<float,2>{0.011395569f, 0.0994161889f},
-std::array<float,2>{0.922722101f, 0.439088076f},
-std::array<float,2>{0.314521313f, 0.975087464f},
-std::array<float,2>{0.964701533f, 0.588476598f},
-std::array<float,2>{0.291983306f, 0.216950282f},
-std::array<float,2>{0.612971425f, 0.305924356f},
-std::array<float,2>{0.118951134f, 0.837568879f},
-std::array<float,2>{0.746739149f, 0.893740237f},
-std::array<float,2>{0.221730098f, 0.406217366f},
-std::array<float,2>{0.797572017f, 0.0489431359f},
-std::array<float,2>{0.409496874f, 0.709372938f},
-std::array<float,2>{0.784853101f, 0.915211201f},
-std::array<float,2>{0.424830526f, 0.433206975f},
-std::array<float,2>{0.723527491f, 0.0142150503f},
-std::array<float,2>{0.242502525f, 0.74899143f},
-std::array<float,2>{0.594626546f, 0.613207281f},
-std::array<float,2>{0.105565123f, 0.2438052f},
-std::array<float,2>{0.940899312f, 0.268575042f},
-std::array<float,2>{0.297148466f, 0.859320164f},
-std::array<float,2>{0.914545596f, 0.650200963f},
-std::array<float,2>{0.343273908f, 0.0727438405f},
-std::array<float,2>{0.548692942f, 0.495667011f},
-std::array<float,2>{0.0179362539f, 0.964945734f},
-std::array<float,2>{0.630653322f, 0.762799382f},
-std::array<float,2>{0.162052467f, 0.341048867f},
-std::array<float,2>{0.821380377f, 0.179697335f},
-std::array<float,2>{0.490852565f, 0.515218914f},
-std::array<float,2>{0.979365766f, 0.819571674f},
-std::array<float,2>{0.26529175f, 0.293659031f},
-std::array<float,2>{0.586640179f, 0.188448995f},
-std::array<float,2>{0.0819713101f, 0.576571882f},
-std::array<float,2>{0.701369762f, 0.702237844f},
-std::array<float,2>{0.213966802f, 0.0408986472f},
-std::array<float,2>{0.780967653f, 0.381195903f},
-std::array<float,2>{0.386028826f, 0.881177664f},
-std::array<float,2>{0.853704572f, 0.562071264f},
-std::array<float,2>{0.443473876f, 0.126110092f},
-std::array<float,2>{0.673386037f, 0.347696245f},
-std::array<float,2>{0.148488835f, 0.804118395f},
-std::array<float,2>{0.526496828f, 0.986180484f},
-std::array<float,2>{0.0422390997f, 0.453304797f},
-std::array<float,2>{0.893746853f, 0.112566337f},
-std::array<float,2>{0.348992288f, 0.686478257f},
-std::array<float,2>{0.999675214f, 0.992732108f},
-std::array<float,2>{0.270936549f, 0.468544871f},
-std::array<float,2>{0.576404154f, 0.121475898f},
-std::array<float,2>{0.0644421875f, 0.677194655f},
-std::array<float,2>{0.713141143f, 0.552424014f},
-std::array<float,2>{0.188006997f, 0.13560909f},
-std::array<float,2>{0.750248075f, 0.35257709f},
-std::array<float,2>{0.404506058f, 0.805535257f},
-std::array<float,2>{0.865976691f, 0.693580866f},
-std::array<float,2>{0.46518001f, 0.0349608995f},
-std::array<float,2>{0.66246736f, 0.388470292f},
-std::array<float,2>{0.127445653f, 0.887823105f},
-std::array<float,2>{0.510583878f, 0.824029386f},
-std::array<float,2>{0.054797139f, 0.283395141f},
-std::array<float,2>{0.881562352f, 0.197343871f},
-std::array<float,2>{0.36401087f, 0.563841164f},
-std::array<float,2>{0.802036524f, 0.75610292f},
-std::array<float,2>{0.411676496f, 0.333051533f},
-std::array<float,2>{0.743914545f, 0.172468007f},
-std::array<float,2>{0.222755104f, 0.500887156f},
-std::array<float,2>{0.616199553f, 0.643108785f},
-std::array<float,2>{0.121479169f, 0.0680694953f},
-std::array<float,2>{0.968528807f, 0.491366476f},
-std::array<float,2>{0.294206798f, 0.954357445f},
-std::array<float,2>{0.927376747f, 0.623806953f},
-std::array<float,2>{0.316856056f, 0.240241751f},
-std::array<float,2>{0.534974992f, 0.280676723f},
-std::array<float,2>{0.0134216556f, 0.848391294f},
-std::array<float,2>{0.643180668f, 0.906354189f},
-std::array<float,2>{0.184213907f, 0.42863673f},
-std::array<float,2>{0.841470063f, 0.00780262612f},
-std::array<float,2>{0.47292459f, 0.742093146f},
-std::array<float,2>{0.825102806f, 0.90138489f},
-std::array<float,2>{0.486782253f, 0.396433324f},
-std::array<float,2>{0.62664181f, 0.0611191913f},
-std::array<float,2>{0.156722605f, 0.718060553f},
-std::array<float,2>{0.55377996f, 0.5814417f},
-std::array<float,2>{0.0210649688f, 0.208295718f},
-std::array<float,2>{0.918705225f, 0.3004767f},
-std::array<float,2>{0.336203337f, 0.834140182f},
-std::array<float,2>{0.944181681f, 0.662667334f},
-std::array<float,2>{0.303572267f, 0.103384443f},
-std::array<float,2>{0.598315418f, 0.450776726f},
-std::array<float,2>{0.103109114f, 0.982099652f},
-std::array<float,2>{0.720004141f, 0.796189904f},
-std::array<float,2>{0.247289047f, 0.366999298f},
-std::array<float,2>{0.788359404f, 0.15021801f},
-std::array<float,2>{0.425821692f, 0.534982622f},
-std::array<float,2>{0.896036565f, 0.868460238f},
-std::array<float,2>{0.345027924f, 0.260877043f},
-std::array<float,2>{0.528593898f, 0.228082702f},
-std::array<float,2>{0.0463177785f, 0.605954826f},
-std::array<float,2>{0.676788092f, 0.722608566f},
-std::array<float,2>{0.154005587f, 0.026462866f},
-std::array<float,2>{0.858212173f, 0.41941765f},
-std::array<float,2>{0.438442051f, 0.931258261f},
-std::array<float,2>{0.773798704f, 0.528649509f},
-std::array<float,2>{0.387504756f, 0.165305063f},
-std::array<float,2>{0.696394384f, 0.32803455f},
-std::array<float,2>{0.217746705f, 0.777526557f},
-std::array<float,2>{0.590717137f, 0.938669622f},
-std::array<float,2>{0.0837402493f, 0.469119191f},
-std::array<float,2>{0.981222212f, 0.0797746778f},
-std::array<float,2>{0.260495543f, 0.63256973f},
-std::array<float,2>{0.910605133f, 0.924441814f},
-std::array<float,2>{0.334042549f, 0.411898941f},
-std::array<float,2>{0.555801928f, 0.0170911793f},
-std::array<float,2>{0.0257665459f, 0.73394233f},
-std::array<float,2>{0.639214635f, 0.595335662f},
-std::array<float,2>{0.166066051f, 0.221545354f},
-std::array<float,2>{0.818148971f, 0.257781595f},
-std::array<float,2>{0.498537511f, 0.86718142f},
-std::array<float,2>{0.791580439f, 0.638664961f},
-std::array<float,2>{0.430042982f, 0.0919778794f},
-std::array<float,2>{0.72742182f, 0.477162689f},
-std::array<float,2>{0.238242343f, 0.948491096f},
-std::array<float,2>{0.605492055f, 0.768697917f},
-std::array<float,2>{0.101020098f, 0.314533591f},
-std::array<float,2>{0.950182378f, 0.163409576f},
-std::array<float,2>{0.310919017f, 0.521675587f},
-std::array<float,2>{0.844843745f, 0.842289865f},
-std::array<float,2>{0.446047962f, 0.311748594f},
-std::array<float,2>{0.682653725f, 0.213053092f},
-std::array<float,2>{0.146014392f, 0.591547132f},
-std::array<float,2>{0.517985642f, 0.704124689f},
-std::array<float,2>{0.0315414779f, 0.0540159345f},
-std::array<float,2>{0.900339425f, 0.39914152f},
-std::array<float,2>{0.355386972f, 0.897159815f},
-std::array<float,2>{0.971396446f, 0.539099693f},
-std::array<float,2>{0.255969226f, 0.144299895f},
-std::array<float,2>{0.581661284f, 0.371501833f},
-std::array<float,2>{0.0919333994f, 0.788370967f},
-std::array<float,2>{0.693365037f, 0.970389545f},
-std::array<float,2>{0.207341731f, 0.444296241f},
-std::array<float,2>{0.772087455f, 0.0976177156f},
-std::array<float,2>{0.379699171f, 0.667087555f},
-std::array<float,2>{0.759724796f, 0.962138832f},
-std::array<float,2>{0.394619495f, 0.497065395f},
-std::array<float,2>{0.706623554f, 0.0751843229f},
-std::array<float,2>{0.199103415f, 0.653732717f},
-std::array<float,2>{0.569829822f, 0.511044979f},
-std::array<float,2>{0.0755309314f, 0.186830655f},
-std::array<float,2>{0.988790095f, 0.336741537f},
-std::array<float,2>{0.280943573f, 0.760759234f},
-std::array<float,2>{0.890348554f, 0.742470324f},
-std::array<float,2>{0.37495625f, 0.0115742786f},
-std::array<float,2>{0.501308978f, 0.433674663f},
-std::array<float,2>{0.0504918918f, 0.920675576f},
-std::array<float,2>{0.665912151f, 0.853048682f},
-std::array<float,2>{0.135187581f, 0.270950258f},
-std::array<float,2>{0.872268736f, 0.249014139f},
-std::array<float,2>{0.458031476f, 0.615805864f},
-std::array<float,2>{0.959275723f, 0.798629582f},
-std::array<float,2>{0.286558539f, 0.344657183f},
-std::array<float,2>{0.620750606f, 0.130740821f},
-std::array<float,2>{0.116291314f, 0.558407605f},
-std::array<float,2>{0.737855315f, 0.680765152f},
-std::array<float,2>{0.227578849f, 0.116764046f},
-std::array<float,2>{0.806382835f, 0.460380435f},
-std::array<float,2>{0.420979202f, 0.991042435f},
-std::array<float,2>{0.831187785f, 0.571161807f},
-std::array<float,2>{0.483573735f, 0.193806469f},
-std::array<float,2>{0.650180936f, 0.292835742f},
-std::array<float,2>{0.173870847f, 0.813087881f},
-std::array<float,2>{0.54309386f, 0.875327468f},
-std::array<float,2>{0.000678171637f, 0.376449615f},
-std::array<float,2>{0.934742451f, 0.0462420322f},
-std::array<float,2>{0.321323544f, 0.697502792f},
-std::array<float,2>{0.97359091f, 0.911370397f},
-std::array<float,2>{0.252291203f, 0.423998863f},
-std::array<float,2>{0.582513452f, 0.000673565082f},
-std::array<float,2>{0.0887259468f, 0.738232076f},
-std::array<float,2>{0.690859497f, 0.61800921f},
-std::array<float,2>{0.206464738f, 0.23616378f},
-std::array<float,2>{0.768407226f, 0.273535669f},
-std::array<float,2>{0.375540376f, 0.846646011f},
-std::array<float,2>{0.850834489f, 0.646711648f},
-std::array<float,2>{0.451385319f, 0.065630056f},
-std::array<float,2>{0.684031665f, 0.485080391f},
-std::array<float,2>{0.143155292f, 0.95871985f},
-std::array<float,2>{0.519746244f, 0.750983417f},
-std::array<float,2>{0.0361853316f, 0.329547733f},
-std::array<float,2>{0.904781222f, 0.176935747f},
-std::array<float,2>{0.356366277f, 0.505695343f},
-std::array<float,2>{0.79499644f, 0.827650309f},
-std::array<float,2>{0.436086863f, 0.288660973f},
-std::array<float,2>{0.732255876f, 0.199288934f},
-std::array<float,2>{0.239060089f, 0.568446934f},
-std::array<float,2>{0.604661465f, 0.687508225f},
-std::array<float,2>{0.0941072032f, 0.0362646393f},
-std::array<float,2>{0.946224034f, 0.383139223f},
-std::array<float,2>{0.30512765f, 0.883007765f},
-std::array<float,2>{0.907245815f, 0.547625244f},
-std::array<float,2>{0.330917895f, 0.13825582f},
-std::array<float,2>{0.55890739f, 0.356070131f},
-std::array<float,2>{0.029522676f, 0.810724974f},
-std::array<float,2>{0.635794461f, 0.997219026f},
-std::array<float,2>{0.169586003f, 0.461938262f},
-std::array<float,2>{0.813613534f, 0.120002948f},
-std::array<float,2>{0.493068755f, 0.673434138f},
-std::array<float,2>{0.833503366f, 0.943047404f},
-std::array<float,2>{0.480428249f, 0.475244075f},
-std::array<float,2>{0.6539343f, 0.0821372718f},
-std::array<float,2>{0.178593993f, 0.626884401f},
-std::array<float,2>{0.539996505f, 0.52639693f},
-std::array<float,2>{0.00517482543f, 0.169436097f},
-std::array<float,2>{0.933397114f, 0.321678996f},
-std::array<float,2>{0.32661733f, 0.774680078f},
-std::array<float,2>{0.956108987f, 0.725957692f},
-std::array<float,2>{0.282979488f, 0.0297716968f},
-std::array<float,2>{0.623182952f, 0.416626513f},
-std::array<float,2>{0.111873955f, 0.936652541f},
-std::array<float,2>{0.738584816f, 0.872636318f},
-std::array<float,2>{0.232819512f, 0.262696236f},
-std::array<float,2>{0.810187697f, 0.233220637f},
-std::array<float,2>{0.417042643f, 0.603928745f},
-std::array<float,2>{0.883954048f, 0.790811002f},
-std::array<float,2>{0.367394716f, 0.362814695f},
-std::array<float,2>{0.506242812f, 0.152850017f},
-std::array<float,2>{0.0546358936f, 0.53851378f},
-std::array<float,2>{0.671697974f, 0.656492829f},
-std::array<float,2>{0.138285041f, 0.10825447f},
-std::array<float,2>{0.867859006f, 0.448890954f},
-std::array<float,2>{0.453825057f, 0.976977289f},
-std::array<float,2>{0.762323558f, 0.585168898f},
-std::array<float,2>{0.39190343f, 0.20551458f},
-std::array<float,2>{0.710215211f, 0.302129686f},
-std::array<float,2>{0.202359036f, 0.831116498f},
-std::array<float,2>{0.565481484f, 0.904137135f},
-std::array<float,2>{0.0706031173f, 0.39290598f},
-std::array<float,2>{0.986692667f, 0.058475472f},
-std::array<float,2>{0.275249571f, 0.714372158f},
-std::array<float,2>{0.925713003f, 0.972989559f},
-std::array<float,2>{0.312954366f, 0.441174924f},
-std::array<float,2>{0.538143158f, 0.101493306f},
-std::array<float,2>{0.00829814933f, 0.66935581f},
-std::array<float,2>{0.647776663f, 0.544371784f},
-std::array<float,2>{0.181439951f, 0.145373359f},
-std::array<float,2>{0.839623094f, 0.368189424f},
-std::array<float,2>{0.472531855f, 0.783602536f},
-std::array<float,2>{0.799339294f, 0.708290219f},
-std::array<float,2>{0.407066017f, 0.0487453751f},
-std::array<float,2>{0.749405265f, 0.403137028f},
-std::array<float,2>{0.220658347f, 0.891389728f},
-std::array<float,2>{0.61107564f, 0.838520825f},
-std::array<float,2>{0.119174302f, 0.307180792f},
-std::array<float,2>{0.962351739f, 0.21501039f},
-std::array<float,2>{0.290213406f, 0.587722898f},
-std::array<float,2>{0.860372424f, 0.772556245f},
-std::array<float,2>{0.464483261f, 0.316504538f},
-std::array<float,2>{0.658127487f, 0.156469941f},
-std::array<float,2>{0.12978752f, 0.516437054f},
-std::array<float,2>{0.513986826f, 0.634341657f},
-std::array<float,2>{0.0589906126f, 0.0889823735f},
-std::array<float,2>{0.878446519f, 0.481912255f},
-std::array<float,2>{0.362453133f, 0.952369869f},
-std::array<float,2>{0.994677067f, 0.59798044f},
-std::array<float,2>{0.266559929f, 0.222717941f},
-std::array<float,2>{0.573523045f, 0.253467321f},
-std::array<float,2>{0.066906333f, 0.862207413f},
-std::array<float,2>{0.71720612f, 0.927717149f},
-std::array<float,2>{0.195281893f, 0.407786906f},
-std::array<float,2>{0.756655931f, 0.0198289044f},
-std::array<float,2>{0.400537759f, 0.727203131f},
-std::array<float,2>{0.778832495f, 0.87970078f},
-std::array<float,2>{0.383653671f, 0.380783916f},
-std::array<float,2>{0.699744523f, 0.0425537862f},
-std::array<float,2>{0.211736485f, 0.700404763f},
-std::array<float,2>{0.589246392f, 0.575535417f},
-std::array<float,2>{0.0785791725f, 0.191157401f},
-std::array<float,2>{0.976619482f, 0.296445817f},
-std::array<float,2>{0.26273793f, 0.816501915f},
-std::array<float,2>{0.892476439f, 0.683997273f},
-std::array<float,2>{0.351495355f, 0.109473422f},
-std::array<float,2>{0.52520901f, 0.456232995f},
-std::array<float,2>{0.0405129418f, 0.987212658f},
-std::array<float,2>{0.675079763f, 0.802378953f},
-std::array<float,2>{0.151448488f, 0.350885272f},
-std::array<float,2>{0.853083432f, 0.128851473f},
-std::array<float,2>{0.442678243f, 0.559713781f},
-std::array<float,2>{0.938013077f, 0.85733062f},
-std::array<float,2>{0.299772918f, 0.26736173f},
-std::array<float,2>{0.596786261f, 0.244792804f},
-std::array<float,2>{0.109314509f, 0.61120224f},
-std::array<float,2>{0.725319624f, 0.747061789f},
-std::array<float,2>{0.245960355f, 0.0125092892f},
-std::array<float,2>{0.781650722f, 0.431464225f},
-std::array<float,2>{0.422847301f, 0.916514874f},
-std::array<float,2>{0.823448598f, 0.512506664f},
-std::array<float,2>{0.488879919f, 0.183460578f},
-std::array<float,2>{0.632562459f, 0.342679828f},
-std::array<float,2>{0.162813395f, 0.764886975f},
-std::array<float,2>{0.549241185f, 0.967965722f},
-std::array<float,2>{0.0173959378f, 0.49333328f},
-std::array<float,2>{0.9167611f, 0.0722019151f},
-std::array<float,2>{0.341319352f, 0.650986254f},
-std::array<float,2>{0.965430439f, 0.955870986f},
-std::array<float,2>{0.295090437f, 0.490027487f},
-std::array<float,2>{0.613923371f, 0.0686258599f},
-std::array<float,2>{0.123903304f, 0.641657948f},
-std::array<float,2>{0.745262265f, 0.502197683f},
-std::array<float,2>{0.224945977f, 0.175406903f},
-std::array<float,2>{0.803746045f, 0.33424896f},
-std::array<float,2>{0.412557751f, 0.755838752f},
-std::array<float,2>{0.843536258f, 0.740038514f},
-std::array<float,2>{0.47543034f, 0.00438559428f},
-std::array<float,2>{0.64064312f, 0.426460326f},
-std::array<float,2>{0.18744114f, 0.909485459f},
-std::array<float,2>{0.533081293f, 0.849704623f},
-std::array<float,2>{0.0137476148f, 0.278438061f},
-std::array<float,2>{0.928338826f, 0.239707589f},
-std::array<float,2>{0.319144934f, 0.622393727f},
-std::array<float,2>{0.753669381f, 0.808227837f},
-std::array<float,2>{0.404002041f, 0.355163932f},
-std::array<float,2>{0.711349726f, 0.133362532f},
-std::array<float,2>{0.189849481f, 0.554258764f},
-std::array<float,2>{0.575297236f, 0.679525554f},
-std::array<float,2>{0.065366514f, 0.12453115f},
-std::array<float,2>{0.997261345f, 0.465419501f},
-std::array<float,2>{0.272909462f, 0.994717896f},
-std::array<float,2>{0.879951298f, 0.566123068f},
-std::array<float,2>{0.365454853f, 0.196122527f},
-std::array<float,2>{0.508174717f, 0.282865793f},
-std::array<float,2>{0.0575985126f, 0.821234345f},
-std::array<float,2>{0.661942124f, 0.889205396f},
-std::array<float,2>{0.126250327f, 0.388931602f},
-std::array<float,2>{0.864072204f, 0.032322146f},
-std::array<float,2>{0.468471169f, 0.692672491f},
-std::array<float,2>{0.856839597f, 0.933287621f},
-std::array<float,2>{0.441295594f, 0.421070307f},
-std::array<float,2>{0.678913176f, 0.0234745797f},
-std::array<float,2>{0.155033514f, 0.719508469f},
-std::array<float,2>{0.53108114f, 0.607634544f},
-std::array<float,2>{0.0447252244f, 0.228530973f},
-std::array<float,2>{0.897948146f, 0.258191794f},
-std::array<float,2>{0.346740901f, 0.87051928f},
-std::array<float,2>{0.983511269f, 0.630305409f},
-std::array<float,2>{0.259019881f, 0.0813027546f},
-std::array<float,2>{0.593302608f, 0.471963108f},
-std::array<float,2>{0.0842871293f, 0.93957454f},
-std::array<float,2>{0.698525488f, 0.779353976f},
-std::array<float,2>{0.215676993f, 0.325397044f},
-std::array<float,2>{0.776596904f, 0.167515382f},
-std::array<float,2>{0.38933602f, 0.529369533f},
-std::array<float,2>{0.921186924f, 0.833877444f},
-std::array<float,2>{0.338536292f, 0.297270238f},
-std::array<float,2>{0.551891327f, 0.210628197f},
-std::array<float,2>{0.0224888213f, 0.578381062f},
-std::array<float,2>{0.627727568f, 0.716787517f},
-std::array<float,2>{0.15830113f, 0.0586590618f},
-std::array<float,2>{0.827613175f, 0.397503704f},
-std::array<float,2>{0.486110359f, 0.8988114f},
-std::array<float,2>{0.786862373f, 0.532055438f},
-std::array<float,2>{0.428632438f, 0.150992528f},
-std::array<float,2>{0.721049666f, 0.364020258f},
-std::array<float,2>{0.249564588f, 0.793426991f},
-std::array<float,2>{0.599701107f, 0.983913541f},
-std::array<float,2>{0.103857808f, 0.451634854f},
-std::array<float,2>{0.942951739f, 0.103809811f},
-std::array<float,2>{0.302718371f, 0.660845399f},
-std::array<float,2>{0.901742697f, 0.896232665f},
-std::array<float,2>{0.351722896f, 0.401223481f},
-std::array<float,2>{0.517080784f, 0.051038295f},
-std::array<float,2>{0.0344266184f, 0.706326962f},
-std::array<float,2>{0.681139708f, 0.593310118f},
-std::array<float,2>{0.14805305f, 0.212078512f},
-std::array<float,2>{0.847293913f, 0.309440225f},
-std::array<float,2>{0.447802454f, 0.841256261f},
-std::array<float,2>{0.7714625f, 0.664190292f},
-std::array<float,2>{0.381488204f, 0.0956855267f},
-std::array<float,2>{0.69284606f, 0.441698134f},
-std::array<float,2>{0.209872335f, 0.971225083f},
-std::array<float,2>{0.578280568f, 0.785835326f},
-std::array<float,2>{0.0901545808f, 0.373950809f},
-std::array<float,2>{0.969531059f, 0.142015055f},
-std::array<float,2>{0.254447937f, 0.541736543f},
-std::array<float,2>{0.818641186f, 0.863377512f},
-std::array<float,2>{0.496619463f, 0.254815996f},
-std::array<float,2>{0.638634384f, 0.220200554f},
-std::array<float,2>{0.164290398f, 0.5964849f},
-std::array<float,2>{0.558580041f, 0.732207f},
-std::array<float,2>{0.0235399324f, 0.0182681698f},
-std::array<float,2>{0.913976669f, 0.413690865f},
-std::array<float,2>{0.333061486f, 0.92352438f},
-std::array<float,2>{0.952159345f, 0.521392226f},
-std::array<float,2>{0.308881909f, 0.161237746f},
-std::array<float,2>{0.608657479f, 0.313456863f},
-std::array<float,2>{0.0985884964f, 0.765734017f},
-std::array<float,2>{0.729378343f, 0.947120845f},
-std::array<float,2>{0.236134425f, 0.479107201f},
-std::array<float,2>{0.790923119f, 0.0911897644f},
-std::array<float,2>{0.432716101f, 0.640499532f},
-std::array<float,2>{0.807933629f, 0.989462793f},
-std::array<float,2>{0.418427229f, 0.458424419f},
-std::array<float,2>{0.734844208f, 0.113386348f},
-std::array<float,2>{0.229197085f, 0.6831972f},
-std::array<float,2>{0.61855942f, 0.555954635f},
-std::array<float,2>{0.11471466f, 0.132552937f},
-std::array<float,2>{0.958621562f, 0.347457826f},
-std::array<float,2>{0.28715235f, 0.799330175f},
-std::array<float,2>{0.937377214f, 0.696469247f},
-std::array<float,2>{0.323512942f, 0.0444815829f},
-std::array<float,2>{0.545916319f, 0.377240866f},
-std::array<float,2>{0.00348065048f, 0.878243268f},
-std::array<float,2>{0.652304292f, 0.815982401f},
-std::array<float,2>{0.173368722f, 0.289075136f},
-std::array<float,2>{0.828617334f, 0.192455828f},
-std::array<float,2>{0.481125206f, 0.572296917f},
-std::array<float,2>{0.991360605f, 0.758394182f},
-std::array<float,2>{0.277919143f, 0.337898642f},
-std::array<float,2>{0.567413092f, 0.185476378f},
-std::array<float,2>{0.0779784396f, 0.508973002f},
-std::array<float,2>{0.704910696f, 0.655617774f},
-std::array<float,2>{0.196989596f, 0.0777641386f},
-std::array<float,2>{0.760528386f, 0.498755783f},
-std::array<float,2>{0.397551864f, 0.963733256f},
-std::array<float,2>{0.874253333f, 0.613639593f},
-std::array<float,2>{0.45980224f, 0.246319681f},
-std::array<float,2>{0.666052938f, 0.27232343f},
-std::array<float,2>{0.134263471f, 0.854263544f},
-std::array<float,2>{0.503838062f, 0.918287635f},
-std::array<float,2>{0.048015967f, 0.43662405f},
-std::array<float,2>{0.887471199f, 0.00822773203f},
-std::array<float,2>{0.372244805f, 0.746039391f}}
\ No newline at end of file
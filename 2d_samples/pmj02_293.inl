@@ -1,4096 +0,0 @@
-{std::array<float,2>{0.114278816f, 0.536945105f},
-std::array<float,2>{0.827421427f, 0.413322717f},
-std::array<float,2>{0.703243136f, 0.982811689f},
-std::array<float,2>{0.376761943f, 0.226738036f},
-std::array<float,2>{0.321020961f, 0.771875739f},
-std::array<float,2>{0.582814455f, 0.0974505469f},
-std::array<float,2>{0.898888052f, 0.730771303f},
-std::array<float,2>{0.192394108f, 0.318414956f},
-std::array<float,2>{0.498385996f, 0.679890752f},
-std::array<float,2>{0.647821903f, 0.299200714f},
-std::array<float,2>{0.779230893f, 0.837981224f},
-std::array<float,2>{0.0353051014f, 0.0408717655f},
-std::array<float,2>{0.148852468f, 0.928205252f},
-std::array<float,2>{0.946225822f, 0.137733713f},
-std::array<float,2>{0.558762968f, 0.619461715f},
-std::array<float,2>{0.299259752f, 0.458866358f},
-std::array<float,2>{0.238350213f, 0.700865865f},
-std::array<float,2>{0.928021073f, 0.349011868f},
-std::array<float,2>{0.624735236f, 0.791930854f},
-std::array<float,2>{0.352945209f, 0.0685057491f},
-std::array<float,2>{0.427792728f, 0.946724534f},
-std::array<float,2>{0.725775301f, 0.195436329f},
-std::array<float,2>{0.870178342f, 0.513809443f},
-std::array<float,2>{0.0638948977f, 0.37917313f},
-std::array<float,2>{0.251964748f, 0.575003624f},
-std::array<float,2>{0.526178181f, 0.495388359f},
-std::array<float,2>{0.990986049f, 0.902029753f},
-std::array<float,2>{0.157501489f, 0.162541494f},
-std::array<float,2>{0.00646544807f, 0.856002092f},
-std::array<float,2>{0.80493319f, 0.026538806f},
-std::array<float,2>{0.680843055f, 0.646776557f},
-std::array<float,2>{0.43919456f, 0.251522958f},
-std::array<float,2>{0.047984194f, 0.629113436f},
-std::array<float,2>{0.755367875f, 0.277614266f},
-std::array<float,2>{0.632788479f, 0.86590302f},
-std::array<float,2>{0.474366903f, 0.00871343166f},
-std::array<float,2>{0.293172628f, 0.878843725f},
-std::array<float,2>{0.533241034f, 0.174439967f},
-std::array<float,2>{0.954314291f, 0.593636572f},
-std::array<float,2>{0.134783357f, 0.472145885f},
-std::array<float,2>{0.391303092f, 0.529339314f},
-std::array<float,2>{0.688008547f, 0.405186981f},
-std::array<float,2>{0.832905293f, 0.958828926f},
-std::array<float,2>{0.107059404f, 0.204402357f},
-std::array<float,2>{0.214827731f, 0.808398604f},
-std::array<float,2>{0.887829185f, 0.09299808f},
-std::array<float,2>{0.571097195f, 0.711666584f},
-std::array<float,2>{0.338172376f, 0.369884551f},
-std::array<float,2>{0.18124637f, 0.601577938f},
-std::array<float,2>{0.982608557f, 0.43808642f},
-std::array<float,2>{0.505837321f, 0.914128184f},
-std::array<float,2>{0.266798705f, 0.149690047f},
-std::array<float,2>{0.460112572f, 0.819987178f},
-std::array<float,2>{0.664502859f, 0.0584808625f},
-std::array<float,2>{0.794077635f, 0.659750164f},
-std::array<float,2>{0.0226286445f, 0.28869766f},
-std::array<float,2>{0.368188173f, 0.749210119f},
-std::array<float,2>{0.601867735f, 0.332969755f},
-std::array<float,2>{0.911775112f, 0.763738334f},
-std::array<float,2>{0.225501493f, 0.113589585f},
-std::array<float,2>{0.0916253999f, 0.989481986f},
-std::array<float,2>{0.854150295f, 0.242011607f},
-std::array<float,2>{0.749385595f, 0.560881019f},
-std::array<float,2>{0.416062266f, 0.42761609f},
-std::array<float,2>{0.0248355567f, 0.585823119f},
-std::array<float,2>{0.781551301f, 0.479631454f},
-std::array<float,2>{0.660612524f, 0.887613058f},
-std::array<float,2>{0.462678969f, 0.186240256f},
-std::array<float,2>{0.273521215f, 0.868906379f},
-std::array<float,2>{0.514837623f, 0.00144409819f},
-std::array<float,2>{0.974661767f, 0.634064078f},
-std::array<float,2>{0.172402427f, 0.270011723f},
-std::array<float,2>{0.411354125f, 0.706531525f},
-std::array<float,2>{0.739527225f, 0.364136726f},
-std::array<float,2>{0.847214699f, 0.797679424f},
-std::array<float,2>{0.079150565f, 0.079212673f},
-std::array<float,2>{0.230804384f, 0.967406988f},
-std::array<float,2>{0.917244792f, 0.215014249f},
-std::array<float,2>{0.597201347f, 0.521819174f},
-std::array<float,2>{0.366385669f, 0.394197673f},
-std::array<float,2>{0.12963672f, 0.670808911f},
-std::array<float,2>{0.963475883f, 0.289791226f},
-std::array<float,2>{0.540501714f, 0.824952722f},
-std::array<float,2>{0.282042623f, 0.0506300367f},
-std::array<float,2>{0.480258733f, 0.912224174f},
-std::array<float,2>{0.636325598f, 0.147318169f},
-std::array<float,2>{0.758519232f, 0.600310266f},
-std::array<float,2>{0.0594256818f, 0.44586271f},
-std::array<float,2>{0.332631588f, 0.549271762f},
-std::array<float,2>{0.567140877f, 0.432985604f},
-std::array<float,2>{0.879137278f, 0.992977858f},
-std::array<float,2>{0.207642168f, 0.245657846f},
-std::array<float,2>{0.0978887454f, 0.754116774f},
-std::array<float,2>{0.838023305f, 0.124180742f},
-std::array<float,2>{0.703044832f, 0.736479342f},
-std::array<float,2>{0.405591697f, 0.341025889f},
-std::array<float,2>{0.0709221065f, 0.723718524f},
-std::array<float,2>{0.860934258f, 0.32563597f},
-std::array<float,2>{0.729825318f, 0.776613832f},
-std::array<float,2>{0.43646279f, 0.109112047f},
-std::array<float,2>{0.344553858f, 0.973611116f},
-std::array<float,2>{0.616517723f, 0.225280553f},
-std::array<float,2>{0.93720305f, 0.542182505f},
-std::array<float,2>{0.246670425f, 0.418239117f},
-std::array<float,2>{0.452257395f, 0.616175175f},
-std::array<float,2>{0.675465286f, 0.465590268f},
-std::array<float,2>{0.79796958f, 0.931006491f},
-std::array<float,2>{0.0102882097f, 0.126767933f},
-std::array<float,2>{0.167552665f, 0.834597349f},
-std::array<float,2>{0.993952215f, 0.0314073749f},
-std::array<float,2>{0.519582212f, 0.672192097f},
-std::array<float,2>{0.262071103f, 0.309731096f},
-std::array<float,2>{0.196328163f, 0.504599035f},
-std::array<float,2>{0.898014963f, 0.388134599f},
-std::array<float,2>{0.589345992f, 0.937676966f},
-std::array<float,2>{0.315378547f, 0.19432278f},
-std::array<float,2>{0.385812521f, 0.782774329f},
-std::array<float,2>{0.718258083f, 0.0728799626f},
-std::array<float,2>{0.818902612f, 0.695265591f},
-std::array<float,2>{0.121008262f, 0.356931537f},
-std::array<float,2>{0.307576805f, 0.655918062f},
-std::array<float,2>{0.547832072f, 0.258385032f},
-std::array<float,2>{0.944886148f, 0.850906193f},
-std::array<float,2>{0.147491187f, 0.0183290783f},
-std::array<float,2>{0.043100819f, 0.89385134f},
-std::array<float,2>{0.76940459f, 0.166442066f},
-std::array<float,2>{0.651395679f, 0.570178032f},
-std::array<float,2>{0.486122191f, 0.487593591f},
-std::array<float,2>{0.0344340838f, 0.516628981f},
-std::array<float,2>{0.776879489f, 0.397688538f},
-std::array<float,2>{0.641499698f, 0.961959183f},
-std::array<float,2>{0.494248092f, 0.212238446f},
-std::array<float,2>{0.304418892f, 0.80320245f},
-std::array<float,2>{0.558231235f, 0.0855469555f},
-std::array<float,2>{0.952094436f, 0.707469225f},
-std::array<float,2>{0.155806735f, 0.362406671f},
-std::array<float,2>{0.380135596f, 0.638503253f},
-std::array<float,2>{0.710529089f, 0.267394006f},
-std::array<float,2>{0.823099375f, 0.874510229f},
-std::array<float,2>{0.111968428f, 0.00449578231f},
-std::array<float,2>{0.187558666f, 0.883865237f},
-std::array<float,2>{0.905038953f, 0.180386469f},
-std::array<float,2>{0.579711258f, 0.579045951f},
-std::array<float,2>{0.326221824f, 0.482574552f},
-std::array<float,2>{0.16184935f, 0.740336001f},
-std::array<float,2>{0.987337351f, 0.339543223f},
-std::array<float,2>{0.529788911f, 0.750926673f},
-std::array<float,2>{0.254079074f, 0.1205801f},
-std::array<float,2>{0.444216818f, 0.999462187f},
-std::array<float,2>{0.68472904f, 0.24824734f},
-std::array<float,2>{0.809828997f, 0.552191317f},
-std::array<float,2>{0.00112316268f, 0.435151309f},
-std::array<float,2>{0.358048588f, 0.596145213f},
-std::array<float,2>{0.620160937f, 0.450726002f},
-std::array<float,2>{0.923303246f, 0.910016298f},
-std::array<float,2>{0.237500504f, 0.140654042f},
-std::array<float,2>{0.0698426515f, 0.82208252f},
-std::array<float,2>{0.874612033f, 0.0516440198f},
-std::array<float,2>{0.720152617f, 0.665782511f},
-std::array<float,2>{0.42553395f, 0.295247823f},
-std::array<float,2>{0.101663888f, 0.678907216f},
-std::array<float,2>{0.831259191f, 0.30574435f},
-std::array<float,2>{0.692857206f, 0.829492629f},
-std::array<float,2>{0.394866198f, 0.0370094292f},
-std::array<float,2>{0.343058944f, 0.934491992f},
-std::array<float,2>{0.574319899f, 0.129301012f},
-std::array<float,2>{0.885182619f, 0.612227678f},
-std::array<float,2>{0.217441544f, 0.463225901f},
-std::array<float,2>{0.470191628f, 0.546068013f},
-std::array<float,2>{0.625968993f, 0.415415436f},
-std::array<float,2>{0.75056529f, 0.968993366f},
-std::array<float,2>{0.0509164482f, 0.220573157f},
-std::array<float,2>{0.138384566f, 0.780044436f},
-std::array<float,2>{0.958659828f, 0.104212783f},
-std::array<float,2>{0.53791523f, 0.719245076f},
-std::array<float,2>{0.290188521f, 0.324018329f},
-std::array<float,2>{0.220661148f, 0.566053748f},
-std::array<float,2>{0.906968892f, 0.489119232f},
-std::array<float,2>{0.608279288f, 0.897961497f},
-std::array<float,2>{0.37153402f, 0.169262975f},
-std::array<float,2>{0.418723643f, 0.846288383f},
-std::array<float,2>{0.744685411f, 0.0224565435f},
-std::array<float,2>{0.856704175f, 0.649955869f},
-std::array<float,2>{0.0892909169f, 0.26562196f},
-std::array<float,2>{0.272267759f, 0.689861417f},
-std::array<float,2>{0.500535905f, 0.354041278f},
-std::array<float,2>{0.976841211f, 0.787229598f},
-std::array<float,2>{0.184081048f, 0.0756120533f},
-std::array<float,2>{0.0163235143f, 0.941929579f},
-std::array<float,2>{0.79163003f, 0.190028384f},
-std::array<float,2>{0.671405315f, 0.501364589f},
-std::array<float,2>{0.454903424f, 0.384096771f},
-std::array<float,2>{0.085687317f, 0.622005343f},
-std::array<float,2>{0.851196468f, 0.454201519f},
-std::array<float,2>{0.738067746f, 0.923850179f},
-std::array<float,2>{0.407863259f, 0.134613097f},
-std::array<float,2>{0.360791415f, 0.840631962f},
-std::array<float,2>{0.598106921f, 0.0441612937f},
-std::array<float,2>{0.920515835f, 0.687324524f},
-std::array<float,2>{0.230307922f, 0.30284673f},
-std::array<float,2>{0.467922091f, 0.728678644f},
-std::array<float,2>{0.660126984f, 0.315559149f},
-std::array<float,2>{0.787361503f, 0.766014695f},
-std::array<float,2>{0.0281527638f, 0.098189719f},
-std::array<float,2>{0.177329868f, 0.977102458f},
-std::array<float,2>{0.971194923f, 0.234321117f},
-std::array<float,2>{0.510403812f, 0.53425318f},
-std::array<float,2>{0.281233966f, 0.40776211f},
-std::array<float,2>{0.203927621f, 0.641449451f},
-std::array<float,2>{0.878327966f, 0.255012244f},
-std::array<float,2>{0.565121353f, 0.853062272f},
-std::array<float,2>{0.328602374f, 0.0292545445f},
-std::array<float,2>{0.40010792f, 0.903204858f},
-std::array<float,2>{0.698385477f, 0.156808123f},
-std::array<float,2>{0.840940595f, 0.574129522f},
-std::array<float,2>{0.0961884335f, 0.499352336f},
-std::array<float,2>{0.28704232f, 0.510913491f},
-std::array<float,2>{0.545363545f, 0.377547711f},
-std::array<float,2>{0.965041757f, 0.951020956f},
-std::array<float,2>{0.126439497f, 0.202120647f},
-std::array<float,2>{0.0558349155f, 0.795038223f},
-std::array<float,2>{0.762663722f, 0.0647714436f},
-std::array<float,2>{0.63853091f, 0.695441544f},
-std::array<float,2>{0.484329432f, 0.346085995f},
-std::array<float,2>{0.0129463207f, 0.716305554f},
-std::array<float,2>{0.801252544f, 0.374145448f},
-std::array<float,2>{0.675874472f, 0.811795831f},
-std::array<float,2>{0.447363973f, 0.0870629922f},
-std::array<float,2>{0.259528369f, 0.956267118f},
-std::array<float,2>{0.515646398f, 0.209704056f},
-std::array<float,2>{0.999739766f, 0.526087344f},
-std::array<float,2>{0.169169039f, 0.402340412f},
-std::array<float,2>{0.433089703f, 0.58637017f},
-std::array<float,2>{0.733019173f, 0.476292431f},
-std::array<float,2>{0.864832044f, 0.882374525f},
-std::array<float,2>{0.0747534186f, 0.177423432f},
-std::array<float,2>{0.244935468f, 0.860044837f},
-std::array<float,2>{0.930483937f, 0.0153448367f},
-std::array<float,2>{0.609785855f, 0.625884712f},
-std::array<float,2>{0.349781156f, 0.274563044f},
-std::array<float,2>{0.1439448f, 0.556303501f},
-std::array<float,2>{0.939577699f, 0.425617456f},
-std::array<float,2>{0.552982152f, 0.987130463f},
-std::array<float,2>{0.309666395f, 0.235987604f},
-std::array<float,2>{0.491864353f, 0.759618461f},
-std::array<float,2>{0.653898776f, 0.109434403f},
-std::array<float,2>{0.770798981f, 0.743268847f},
-std::array<float,2>{0.0428638123f, 0.32821098f},
-std::array<float,2>{0.317232996f, 0.663129151f},
-std::array<float,2>{0.590437412f, 0.281445503f},
-std::array<float,2>{0.894441485f, 0.81296891f},
-std::array<float,2>{0.202648804f, 0.0586960129f},
-std::array<float,2>{0.124090128f, 0.920381844f},
-std::array<float,2>{0.813402534f, 0.152748689f},
-std::array<float,2>{0.713356376f, 0.606853366f},
-std::array<float,2>{0.38850376f, 0.44158265f},
-std::array<float,2>{0.064673245f, 0.512280166f},
-std::array<float,2>{0.868767381f, 0.382058501f},
-std::array<float,2>{0.72328043f, 0.947695017f},
-std::array<float,2>{0.426407635f, 0.198686391f},
-std::array<float,2>{0.354756087f, 0.789487541f},
-std::array<float,2>{0.621410191f, 0.0683309659f},
-std::array<float,2>{0.926465988f, 0.703031182f},
-std::array<float,2>{0.240367174f, 0.350606531f},
-std::array<float,2>{0.440633237f, 0.644807637f},
-std::array<float,2>{0.68305552f, 0.252230972f},
-std::array<float,2>{0.807852387f, 0.858319342f},
-std::array<float,2>{0.00494482322f, 0.0250847209f},
-std::array<float,2>{0.158477575f, 0.89994663f},
-std::array<float,2>{0.989922881f, 0.160963982f},
-std::array<float,2>{0.523563385f, 0.577993989f},
-std::array<float,2>{0.251384586f, 0.493324578f},
-std::array<float,2>{0.193497062f, 0.732612014f},
-std::array<float,2>{0.901245356f, 0.318340272f},
-std::array<float,2>{0.584560931f, 0.77057606f},
-std::array<float,2>{0.323991299f, 0.0944859535f},
-std::array<float,2>{0.37707305f, 0.981291056f},
-std::array<float,2>{0.706169188f, 0.229293495f},
-std::array<float,2>{0.825320482f, 0.538871348f},
-std::array<float,2>{0.115941249f, 0.4107292f},
-std::array<float,2>{0.297984272f, 0.619077384f},
-std::array<float,2>{0.561614275f, 0.460471898f},
-std::array<float,2>{0.947312236f, 0.92682898f},
-std::array<float,2>{0.151582062f, 0.139916986f},
-std::array<float,2>{0.0390059315f, 0.836186707f},
-std::array<float,2>{0.781209826f, 0.0417031981f},
-std::array<float,2>{0.646320164f, 0.682345927f},
-std::array<float,2>{0.497848362f, 0.298043668f},
-std::array<float,2>{0.0202930253f, 0.657750189f},
-std::array<float,2>{0.795907259f, 0.285493702f},
-std::array<float,2>{0.667034805f, 0.816717148f},
-std::array<float,2>{0.457707644f, 0.0556588098f},
-std::array<float,2>{0.269489139f, 0.916790724f},
-std::array<float,2>{0.506210208f, 0.151591048f},
-std::array<float,2>{0.98075217f, 0.604848623f},
-std::array<float,2>{0.182754114f, 0.440519989f},
-std::array<float,2>{0.415875345f, 0.559230328f},
-std::array<float,2>{0.746849f, 0.42874667f},
-std::array<float,2>{0.852057099f, 0.991131961f},
-std::array<float,2>{0.0923418179f, 0.23848103f},
-std::array<float,2>{0.222986475f, 0.763413548f},
-std::array<float,2>{0.912410378f, 0.116810776f},
-std::array<float,2>{0.603841364f, 0.74735105f},
-std::array<float,2>{0.370472372f, 0.334895879f},
-std::array<float,2>{0.133287847f, 0.591439009f},
-std::array<float,2>{0.956867099f, 0.469867557f},
-std::array<float,2>{0.531523466f, 0.875644445f},
-std::array<float,2>{0.296595067f, 0.173568055f},
-std::array<float,2>{0.475609183f, 0.86409837f},
-std::array<float,2>{0.630102158f, 0.0107275415f},
-std::array<float,2>{0.757087529f, 0.630978584f},
-std::array<float,2>{0.0489530526f, 0.28002286f},
-std::array<float,2>{0.336927503f, 0.714821279f},
-std::array<float,2>{0.573258042f, 0.368519545f},
-std::array<float,2>{0.889295101f, 0.804817557f},
-std::array<float,2>{0.212471202f, 0.0898519978f},
-std::array<float,2>{0.109315567f, 0.959721327f},
-std::array<float,2>{0.834618807f, 0.205862403f},
-std::array<float,2>{0.690499723f, 0.528825164f},
-std::array<float,2>{0.393069565f, 0.402600467f},
-std::array<float,2>{0.0612121038f, 0.598424911f},
-std::array<float,2>{0.761313319f, 0.448252827f},
-std::array<float,2>{0.634513438f, 0.910330892f},
-std::array<float,2>{0.477660745f, 0.146217659f},
-std::array<float,2>{0.284173667f, 0.827398181f},
-std::array<float,2>{0.542929411f, 0.0484641306f},
-std::array<float,2>{0.961069167f, 0.668509662f},
-std::array<float,2>{0.132574245f, 0.292049617f},
-std::array<float,2>{0.404263437f, 0.736189663f},
-std::array<float,2>{0.699975967f, 0.34230113f},
-std::array<float,2>{0.836110532f, 0.756312788f},
-std::array<float,2>{0.100705609f, 0.122571811f},
-std::array<float,2>{0.210134193f, 0.994825363f},
-std::array<float,2>{0.88175863f, 0.242633119f},
-std::array<float,2>{0.568373621f, 0.5476439f},
-std::array<float,2>{0.334388018f, 0.430513263f},
-std::array<float,2>{0.174412996f, 0.635270655f},
-std::array<float,2>{0.973200619f, 0.272167712f},
-std::array<float,2>{0.511951625f, 0.870597422f},
-std::array<float,2>{0.275449276f, 0.00359684345f},
-std::array<float,2>{0.464354783f, 0.889501691f},
-std::array<float,2>{0.663427174f, 0.184740603f},
-std::array<float,2>{0.78511548f, 0.583076239f},
-std::array<float,2>{0.0265516546f, 0.476690173f},
-std::array<float,2>{0.364327252f, 0.520175636f},
-std::array<float,2>{0.594190896f, 0.391421169f},
-std::array<float,2>{0.91497314f, 0.966401458f},
-std::array<float,2>{0.232437104f, 0.217357323f},
-std::array<float,2>{0.0805821642f, 0.800433576f},
-std::array<float,2>{0.844410419f, 0.081503287f},
-std::array<float,2>{0.740845323f, 0.704491258f},
-std::array<float,2>{0.412249416f, 0.366225481f},
-std::array<float,2>{0.117537364f, 0.692504942f},
-std::array<float,2>{0.817129731f, 0.358043611f},
-std::array<float,2>{0.715735734f, 0.783489406f},
-std::array<float,2>{0.383467823f, 0.0710154623f},
-std::array<float,2>{0.313950449f, 0.940156221f},
-std::array<float,2>{0.587483168f, 0.192102104f},
-std::array<float,2>{0.89476794f, 0.506571054f},
-std::array<float,2>{0.198220089f, 0.388762623f},
-std::array<float,2>{0.487438262f, 0.566632867f},
-std::array<float,2>{0.650087535f, 0.485192478f},
-std::array<float,2>{0.766208351f, 0.891260743f},
-std::array<float,2>{0.0458157174f, 0.165969148f},
-std::array<float,2>{0.14529337f, 0.848300576f},
-std::array<float,2>{0.943060935f, 0.0157862827f},
-std::array<float,2>{0.549943626f, 0.652988195f},
-std::array<float,2>{0.304795653f, 0.261356562f},
-std::array<float,2>{0.248386458f, 0.540679693f},
-std::array<float,2>{0.934316754f, 0.421426743f},
-std::array<float,2>{0.613919079f, 0.974832654f},
-std::array<float,2>{0.34748587f, 0.222818553f},
-std::array<float,2>{0.434439868f, 0.774728417f},
-std::array<float,2>{0.727631927f, 0.106466308f},
-std::array<float,2>{0.863011062f, 0.726083219f},
-std::array<float,2>{0.0724152625f, 0.327391535f},
-std::array<float,2>{0.264339894f, 0.674572468f},
-std::array<float,2>{0.52313292f, 0.311967224f},
-std::array<float,2>{0.996027648f, 0.832953811f},
-std::array<float,2>{0.16505684f, 0.0345027968f},
-std::array<float,2>{0.00907074753f, 0.933237433f},
-std::array<float,2>{0.79929024f, 0.128098607f},
-std::array<float,2>{0.673262417f, 0.614571333f},
-std::array<float,2>{0.450567156f, 0.467310399f},
-std::array<float,2>{0.00324596907f, 0.554011106f},
-std::array<float,2>{0.81222719f, 0.436108947f},
-std::array<float,2>{0.686352491f, 0.998014808f},
-std::array<float,2>{0.442406654f, 0.246687144f},
-std::array<float,2>{0.257384539f, 0.752400875f},
-std::array<float,2>{0.527376831f, 0.118500777f},
-std::array<float,2>{0.985942185f, 0.739202261f},
-std::array<float,2>{0.162913889f, 0.33656615f},
-std::array<float,2>{0.422914177f, 0.667308331f},
-std::array<float,2>{0.721624792f, 0.294669777f},
-std::array<float,2>{0.87146318f, 0.822765112f},
-std::array<float,2>{0.0680573955f, 0.0542667843f},
-std::array<float,2>{0.23511067f, 0.906952083f},
-std::array<float,2>{0.925771236f, 0.143271878f},
-std::array<float,2>{0.617220461f, 0.594431639f},
-std::array<float,2>{0.356111884f, 0.451685727f},
-std::array<float,2>{0.153515741f, 0.709670305f},
-std::array<float,2>{0.951083899f, 0.359405488f},
-std::array<float,2>{0.555256367f, 0.802339554f},
-std::array<float,2>{0.302457392f, 0.0839166343f},
-std::array<float,2>{0.493962288f, 0.964840114f},
-std::array<float,2>{0.643129766f, 0.213634774f},
-std::array<float,2>{0.773637414f, 0.518844485f},
-std::array<float,2>{0.0328810215f, 0.394636869f},
-std::array<float,2>{0.324936092f, 0.581609428f},
-std::array<float,2>{0.580979764f, 0.481984824f},
-std::array<float,2>{0.903339684f, 0.88480413f},
-std::array<float,2>{0.189548954f, 0.182765171f},
-std::array<float,2>{0.110129088f, 0.871435702f},
-std::array<float,2>{0.820575237f, 0.00598686701f},
-std::array<float,2>{0.708956957f, 0.639181554f},
-std::array<float,2>{0.38229996f, 0.268021196f},
-std::array<float,2>{0.0870985165f, 0.651335359f},
-std::array<float,2>{0.857796907f, 0.262557298f},
-std::array<float,2>{0.743143499f, 0.844348669f},
-std::array<float,2>{0.421430677f, 0.0201055389f},
-std::array<float,2>{0.373726457f, 0.895657361f},
-std::array<float,2>{0.606501877f, 0.169931397f},
-std::array<float,2>{0.908822834f, 0.563743293f},
-std::array<float,2>{0.222185865f, 0.490866125f},
-std::array<float,2>{0.45672664f, 0.503673613f},
-std::array<float,2>{0.669566214f, 0.384889901f},
-std::array<float,2>{0.790564895f, 0.944546223f},
-std::array<float,2>{0.0178359225f, 0.18927291f},
-std::array<float,2>{0.187262937f, 0.787082791f},
-std::array<float,2>{0.979615629f, 0.076827392f},
-std::array<float,2>{0.502918422f, 0.688418329f},
-std::array<float,2>{0.270141721f, 0.351795107f},
-std::array<float,2>{0.215165287f, 0.609711349f},
-std::array<float,2>{0.884230494f, 0.462063968f},
-std::array<float,2>{0.578068197f, 0.935875177f},
-std::array<float,2>{0.341391951f, 0.132241443f},
-std::array<float,2>{0.396744072f, 0.830625594f},
-std::array<float,2>{0.694025755f, 0.0376476832f},
-std::array<float,2>{0.828828275f, 0.677451849f},
-std::array<float,2>{0.105147459f, 0.308491945f},
-std::array<float,2>{0.291532516f, 0.722419798f},
-std::array<float,2>{0.536737084f, 0.321008295f},
-std::array<float,2>{0.959958971f, 0.777474523f},
-std::array<float,2>{0.140315264f, 0.102993496f},
-std::array<float,2>{0.0544274822f, 0.97170037f},
-std::array<float,2>{0.751969934f, 0.221607238f},
-std::array<float,2>{0.627547324f, 0.543532372f},
-std::array<float,2>{0.472344846f, 0.416107714f},
-std::array<float,2>{0.0945089012f, 0.57098031f},
-std::array<float,2>{0.843125403f, 0.49733606f},
-std::array<float,2>{0.695633411f, 0.905131459f},
-std::array<float,2>{0.400396883f, 0.159036726f},
-std::array<float,2>{0.330509692f, 0.854868412f},
-std::array<float,2>{0.563190639f, 0.0301649701f},
-std::array<float,2>{0.876405358f, 0.644497812f},
-std::array<float,2>{0.205146044f, 0.256607234f},
-std::array<float,2>{0.481622219f, 0.697500825f},
-std::array<float,2>{0.639132679f, 0.343823671f},
-std::array<float,2>{0.765610635f, 0.794591546f},
-std::array<float,2>{0.0579406321f, 0.0637362674f},
-std::array<float,2>{0.128819034f, 0.951175213f},
-std::array<float,2>{0.968354464f, 0.199447468f},
-std::array<float,2>{0.543023527f, 0.509120524f},
-std::array<float,2>{0.287390918f, 0.376724064f},
-std::array<float,2>{0.228489116f, 0.685488582f},
-std::array<float,2>{0.919609606f, 0.302328706f},
-std::array<float,2>{0.601243377f, 0.84292227f},
-std::array<float,2>{0.36307773f, 0.0462233424f},
-std::array<float,2>{0.410013169f, 0.922294736f},
-std::array<float,2>{0.735215425f, 0.135772482f},
-std::array<float,2>{0.849538028f, 0.624877155f},
-std::array<float,2>{0.0836641565f, 0.456262797f},
-std::array<float,2>{0.279039204f, 0.532359362f},
-std::array<float,2>{0.508140147f, 0.408697933f},
-std::array<float,2>{0.970521569f, 0.979921401f},
-std::array<float,2>{0.178382128f, 0.230823666f},
-std::array<float,2>{0.0302267075f, 0.767781138f},
-std::array<float,2>{0.786203027f, 0.101365849f},
-std::array<float,2>{0.657294571f, 0.726753354f},
-std::array<float,2>{0.46514082f, 0.31321156f},
-std::array<float,2>{0.0391373783f, 0.745665789f},
-std::array<float,2>{0.773322761f, 0.330367148f},
-std::array<float,2>{0.655187547f, 0.761382341f},
-std::array<float,2>{0.490012318f, 0.111887671f},
-std::array<float,2>{0.311842114f, 0.984399736f},
-std::array<float,2>{0.551316321f, 0.238181353f},
-std::array<float,2>{0.937554359f, 0.557593524f},
-std::array<float,2>{0.14174886f, 0.423805058f},
-std::array<float,2>{0.389975429f, 0.607903838f},
-std::array<float,2>{0.712616324f, 0.444282055f},
-std::array<float,2>{0.815982044f, 0.91806823f},
-std::array<float,2>{0.121691383f, 0.155812502f},
-std::array<float,2>{0.200786337f, 0.815596223f},
-std::array<float,2>{0.892151237f, 0.0623047128f},
-std::array<float,2>{0.592234135f, 0.66059041f},
-std::array<float,2>{0.318808854f, 0.285021931f},
-std::array<float,2>{0.170959666f, 0.524430454f},
-std::array<float,2>{0.996191919f, 0.400113016f},
-std::array<float,2>{0.518600583f, 0.95343411f},
-std::array<float,2>{0.261291772f, 0.208740994f},
-std::array<float,2>{0.445551068f, 0.810340881f},
-std::array<float,2>{0.679600775f, 0.0884275362f},
-std::array<float,2>{0.804440141f, 0.718470216f},
-std::array<float,2>{0.0142449168f, 0.372499585f},
-std::array<float,2>{0.348164558f, 0.627600968f},
-std::array<float,2>{0.612352431f, 0.277050167f},
-std::array<float,2>{0.932165265f, 0.862843573f},
-std::array<float,2>{0.243528724f, 0.0131762987f},
-std::array<float,2>{0.0772475228f, 0.880284786f},
-std::array<float,2>{0.865875423f, 0.178656593f},
-std::array<float,2>{0.731347501f, 0.589060068f},
-std::array<float,2>{0.430651993f, 0.473170727f},
-std::array<float,2>{0.0935361236f, 0.561611712f},
-std::array<float,2>{0.853468239f, 0.425833166f},
-std::array<float,2>{0.747171164f, 0.988738298f},
-std::array<float,2>{0.414244443f, 0.241168573f},
-std::array<float,2>{0.369510621f, 0.76478678f},
-std::array<float,2>{0.604866862f, 0.115233451f},
-std::array<float,2>{0.913366377f, 0.748841107f},
-std::array<float,2>{0.223925903f, 0.333211154f},
-std::array<float,2>{0.458873898f, 0.658464551f},
-std::array<float,2>{0.666117787f, 0.287948847f},
-std::array<float,2>{0.795014918f, 0.818585634f},
-std::array<float,2>{0.0206324905f, 0.0575094968f},
-std::array<float,2>{0.182527408f, 0.91600585f},
-std::array<float,2>{0.981903136f, 0.14867948f},
-std::array<float,2>{0.506911039f, 0.60346967f},
-std::array<float,2>{0.26832667f, 0.438708454f},
-std::array<float,2>{0.21161896f, 0.712343872f},
-std::array<float,2>{0.889814198f, 0.370677829f},
-std::array<float,2>{0.572540462f, 0.807566941f},
-std::array<float,2>{0.33673051f, 0.0919601992f},
-std::array<float,2>{0.394236714f, 0.957971454f},
-std::array<float,2>{0.690042853f, 0.203677028f},
-std::array<float,2>{0.835641503f, 0.531037331f},
-std::array<float,2>{0.108060636f, 0.405821621f},
-std::array<float,2>{0.295050055f, 0.592324913f},
-std::array<float,2>{0.533183694f, 0.471070737f},
-std::array<float,2>{0.955423653f, 0.877500594f},
-std::array<float,2>{0.133907884f, 0.175039098f},
-std::array<float,2>{0.0505346544f, 0.866880715f},
-std::array<float,2>{0.75590688f, 0.00951739307f},
-std::array<float,2>{0.629545033f, 0.630136371f},
-std::array<float,2>{0.474613756f, 0.278401524f},
-std::array<float,2>{0.00452640979f, 0.647807181f},
-std::array<float,2>{0.806728065f, 0.250519305f},
-std::array<float,2>{0.681801379f, 0.857172012f},
-std::array<float,2>{0.440262705f, 0.0262645204f},
-std::array<float,2>{0.250373423f, 0.900719404f},
-std::array<float,2>{0.524789095f, 0.163353235f},
-std::array<float,2>{0.989088774f, 0.575818717f},
-std::array<float,2>{0.15965867f, 0.495045811f},
-std::array<float,2>{0.426857948f, 0.514760792f},
-std::array<float,2>{0.724044323f, 0.380587429f},
-std::array<float,2>{0.868120432f, 0.945929408f},
-std::array<float,2>{0.0658038631f, 0.197024167f},
-std::array<float,2>{0.241887465f, 0.792436421f},
-std::array<float,2>{0.926849127f, 0.0697325841f},
-std::array<float,2>{0.62257272f, 0.699819982f},
-std::array<float,2>{0.353519738f, 0.347748876f},
-std::array<float,2>{0.150540903f, 0.620574892f},
-std::array<float,2>{0.948783755f, 0.457856178f},
-std::array<float,2>{0.561310589f, 0.928796291f},
-std::array<float,2>{0.297804534f, 0.137020767f},
-std::array<float,2>{0.496794492f, 0.839638948f},
-std::array<float,2>{0.645060539f, 0.0397487544f},
-std::array<float,2>{0.780257285f, 0.681376457f},
-std::array<float,2>{0.0374465995f, 0.30060026f},
-std::array<float,2>{0.322682619f, 0.732058167f},
-std::array<float,2>{0.585268199f, 0.320310533f},
-std::array<float,2>{0.902027547f, 0.772776425f},
-std::array<float,2>{0.1950479f, 0.0958868563f},
-std::array<float,2>{0.116472989f, 0.983475745f},
-std::array<float,2>{0.824364007f, 0.227641344f},
-std::array<float,2>{0.705826938f, 0.535369217f},
-std::array<float,2>{0.378765702f, 0.412190944f},
-std::array<float,2>{0.0466626249f, 0.568959892f},
-std::array<float,2>{0.767011881f, 0.486615896f},
-std::array<float,2>{0.649193645f, 0.893335402f},
-std::array<float,2>{0.486824453f, 0.167172164f},
-std::array<float,2>{0.306530416f, 0.84988445f},
-std::array<float,2>{0.548833311f, 0.0189999286f},
-std::array<float,2>{0.942198277f, 0.654740155f},
-std::array<float,2>{0.145655259f, 0.259390116f},
-std::array<float,2>{0.384389371f, 0.693493426f},
-std::array<float,2>{0.716226637f, 0.355635822f},
-std::array<float,2>{0.817929804f, 0.781739354f},
-std::array<float,2>{0.118507467f, 0.0741862506f},
-std::array<float,2>{0.198652819f, 0.93853581f},
-std::array<float,2>{0.896300852f, 0.194780394f},
-std::array<float,2>{0.586028039f, 0.505555272f},
-std::array<float,2>{0.313304245f, 0.386866033f},
-std::array<float,2>{0.164118752f, 0.673049569f},
-std::array<float,2>{0.994384646f, 0.309286267f},
-std::array<float,2>{0.521495998f, 0.835790813f},
-std::array<float,2>{0.265619367f, 0.0322829038f},
-std::array<float,2>{0.449999094f, 0.930358827f},
-std::array<float,2>{0.671971023f, 0.125398815f},
-std::array<float,2>{0.800345838f, 0.616819203f},
-std::array<float,2>{0.00787127577f, 0.465939313f},
-std::array<float,2>{0.346394837f, 0.541895509f},
-std::array<float,2>{0.614379466f, 0.419462353f},
-std::array<float,2>{0.935383439f, 0.97402519f},
-std::array<float,2>{0.249773815f, 0.226504952f},
-std::array<float,2>{0.074165009f, 0.776163876f},
-std::array<float,2>{0.861516416f, 0.108186923f},
-std::array<float,2>{0.727044165f, 0.723067939f},
-std::array<float,2>{0.434825748f, 0.324271381f},
-std::array<float,2>{0.0999058783f, 0.737896323f},
-std::array<float,2>{0.837124109f, 0.340113401f},
-std::array<float,2>{0.700704515f, 0.754948497f},
-std::array<float,2>{0.402779192f, 0.123615429f},
-std::array<float,2>{0.335529596f, 0.994009376f},
-std::array<float,2>{0.570097506f, 0.244875699f},
-std::array<float,2>{0.882449627f, 0.550253451f},
-std::array<float,2>{0.209363252f, 0.431859136f},
-std::array<float,2>{0.476836056f, 0.601444364f},
-std::array<float,2>{0.632937849f, 0.446307272f},
-std::array<float,2>{0.760612249f, 0.913669825f},
-std::array<float,2>{0.0619424433f, 0.147979826f},
-std::array<float,2>{0.131408527f, 0.825960994f},
-std::array<float,2>{0.962282836f, 0.0493416525f},
-std::array<float,2>{0.541763365f, 0.670929551f},
-std::array<float,2>{0.284214169f, 0.290644497f},
-std::array<float,2>{0.233942479f, 0.523366928f},
-std::array<float,2>{0.915686905f, 0.393466532f},
-std::array<float,2>{0.595317304f, 0.968103051f},
-std::array<float,2>{0.363862664f, 0.215978473f},
-std::array<float,2>{0.41309458f, 0.798141897f},
-std::array<float,2>{0.741472781f, 0.0790155828f},
-std::array<float,2>{0.845010757f, 0.705589116f},
-std::array<float,2>{0.0819596872f, 0.364828944f},
-std::array<float,2>{0.276933789f, 0.633644283f},
-std::array<float,2>{0.51282692f, 0.271203071f},
-std::array<float,2>{0.974607944f, 0.867319226f},
-std::array<float,2>{0.175404593f, 0.000663332583f},
-std::array<float,2>{0.0254235249f, 0.888190091f},
-std::array<float,2>{0.783783436f, 0.186629698f},
-std::array<float,2>{0.66300261f, 0.583991706f},
-std::array<float,2>{0.463354796f, 0.478886187f},
-std::array<float,2>{0.0191987287f, 0.500537217f},
-std::array<float,2>{0.789148033f, 0.383396477f},
-std::array<float,2>{0.668348312f, 0.942712486f},
-std::array<float,2>{0.455223292f, 0.191217557f},
-std::array<float,2>{0.271315873f, 0.788394451f},
-std::array<float,2>{0.50382632f, 0.0746624172f},
-std::array<float,2>{0.979378283f, 0.690780997f},
-std::array<float,2>{0.185947135f, 0.355334997f},
-std::array<float,2>{0.420098096f, 0.648804545f},
-std::array<float,2>{0.743353367f, 0.264096349f},
-std::array<float,2>{0.858966172f, 0.847208083f},
-std::array<float,2>{0.0864750668f, 0.0234341361f},
-std::array<float,2>{0.221612304f, 0.89676398f},
-std::array<float,2>{0.909208834f, 0.168808296f},
-std::array<float,2>{0.605619609f, 0.564775765f},
-std::array<float,2>{0.374106914f, 0.489616722f},
-std::array<float,2>{0.138947427f, 0.719910324f},
-std::array<float,2>{0.960796654f, 0.323080599f},
-std::array<float,2>{0.535665572f, 0.780425549f},
-std::array<float,2>{0.292443424f, 0.105350137f},
-std::array<float,2>{0.471567273f, 0.970629632f},
-std::array<float,2>{0.628377378f, 0.219527155f},
-std::array<float,2>{0.753227592f, 0.545406342f},
-std::array<float,2>{0.0530721359f, 0.414486378f},
-std::array<float,2>{0.339858502f, 0.612782717f},
-std::array<float,2>{0.577014923f, 0.464172214f},
-std::array<float,2>{0.882929981f, 0.935279071f},
-std::array<float,2>{0.216711178f, 0.130088925f},
-std::array<float,2>{0.103963785f, 0.828625023f},
-std::array<float,2>{0.829526067f, 0.035209734f},
-std::array<float,2>{0.695033133f, 0.678528249f},
-std::array<float,2>{0.397713929f, 0.304763228f},
-std::array<float,2>{0.0672901645f, 0.664870262f},
-std::array<float,2>{0.872444451f, 0.296573251f},
-std::array<float,2>{0.722570419f, 0.821122825f},
-std::array<float,2>{0.422361881f, 0.0521199554f},
-std::array<float,2>{0.35666436f, 0.908750117f},
-std::array<float,2>{0.618926466f, 0.142496869f},
-std::array<float,2>{0.924594641f, 0.597423017f},
-std::array<float,2>{0.236112177f, 0.449810684f},
-std::array<float,2>{0.441423208f, 0.551318824f},
-std::array<float,2>{0.686645031f, 0.433855444f},
-std::array<float,2>{0.811152637f, 0.998988569f},
-std::array<float,2>{0.00200446299f, 0.249475896f},
-std::array<float,2>{0.163236484f, 0.751182616f},
-std::array<float,2>{0.985181749f, 0.119263612f},
-std::array<float,2>{0.528734803f, 0.742092669f},
-std::array<float,2>{0.256072104f, 0.338660121f},
-std::array<float,2>{0.190689087f, 0.579206169f},
-std::array<float,2>{0.902786434f, 0.484353364f},
-std::array<float,2>{0.581960261f, 0.88305378f},
-std::array<float,2>{0.325837582f, 0.180943459f},
-std::array<float,2>{0.381480277f, 0.87347436f},
-std::array<float,2>{0.707678556f, 0.0055136485f},
-std::array<float,2>{0.821695685f, 0.63737905f},
-std::array<float,2>{0.110775948f, 0.26612404f},
-std::array<float,2>{0.301053524f, 0.70800972f},
-std::array<float,2>{0.55604142f, 0.361527652f},
-std::array<float,2>{0.949474871f, 0.8046453f},
-std::array<float,2>{0.152792305f, 0.0848224685f},
-std::array<float,2>{0.0320072249f, 0.961283743f},
-std::array<float,2>{0.77474767f, 0.211498544f},
-std::array<float,2>{0.643809736f, 0.516175508f},
-std::array<float,2>{0.492272764f, 0.396747231f},
-std::array<float,2>{0.122547045f, 0.60553211f},
-std::array<float,2>{0.814693093f, 0.442851692f},
-std::array<float,2>{0.711779237f, 0.921727896f},
-std::array<float,2>{0.388900638f, 0.153845996f},
-std::array<float,2>{0.320239484f, 0.813486397f},
-std::array<float,2>{0.59357816f, 0.0596896f},
-std::array<float,2>{0.891079307f, 0.662483335f},
-std::array<float,2>{0.199467406f, 0.282948792f},
-std::array<float,2>{0.488618016f, 0.742646098f},
-std::array<float,2>{0.655453026f, 0.33005622f},
-std::array<float,2>{0.771592557f, 0.757998288f},
-std::array<float,2>{0.0400886349f, 0.111230537f},
-std::array<float,2>{0.140913561f, 0.987519026f},
-std::array<float,2>{0.938944042f, 0.234722838f},
-std::array<float,2>{0.551975906f, 0.554805815f},
-std::array<float,2>{0.310681403f, 0.42413637f},
-std::array<float,2>{0.242359072f, 0.626943111f},
-std::array<float,2>{0.932719171f, 0.273697674f},
-std::array<float,2>{0.611352444f, 0.860980511f},
-std::array<float,2>{0.348963201f, 0.014262707f},
-std::array<float,2>{0.431122392f, 0.8809039f},
-std::array<float,2>{0.731954515f, 0.176561445f},
-std::array<float,2>{0.867079735f, 0.587274671f},
-std::array<float,2>{0.0771398321f, 0.475057542f},
-std::array<float,2>{0.260556936f, 0.527332485f},
-std::array<float,2>{0.517746329f, 0.400830209f},
-std::array<float,2>{0.997336149f, 0.955902398f},
-std::array<float,2>{0.170752555f, 0.210320294f},
-std::array<float,2>{0.0147026554f, 0.811218202f},
-std::array<float,2>{0.803528428f, 0.0866543576f},
-std::array<float,2>{0.677883387f, 0.715775847f},
-std::array<float,2>{0.447112262f, 0.373099208f},
-std::array<float,2>{0.057038866f, 0.696348608f},
-std::array<float,2>{0.763970852f, 0.347636968f},
-std::array<float,2>{0.640224814f, 0.796557665f},
-std::array<float,2>{0.480597198f, 0.0655345023f},
-std::array<float,2>{0.288817853f, 0.949811876f},
-std::array<float,2>{0.544501066f, 0.202575684f},
-std::array<float,2>{0.967202187f, 0.510509193f},
-std::array<float,2>{0.127697304f, 0.378364533f},
-std::array<float,2>{0.401600599f, 0.572399259f},
-std::array<float,2>{0.696643353f, 0.498790681f},
-std::array<float,2>{0.841894448f, 0.903720021f},
-std::array<float,2>{0.095052585f, 0.158192918f},
-std::array<float,2>{0.206637844f, 0.85206145f},
-std::array<float,2>{0.875277758f, 0.0280249566f},
-std::array<float,2>{0.563526154f, 0.641893685f},
-std::array<float,2>{0.331127524f, 0.25486654f},
-std::array<float,2>{0.179501399f, 0.533256769f},
-std::array<float,2>{0.969135404f, 0.406863809f},
-std::array<float,2>{0.509081662f, 0.977825403f},
-std::array<float,2>{0.277486026f, 0.232994974f},
-std::array<float,2>{0.466400862f, 0.76696372f},
-std::array<float,2>{0.657063067f, 0.0992988572f},
-std::array<float,2>{0.785395503f, 0.730270505f},
-std::array<float,2>{0.0306199715f, 0.31484732f},
-std::array<float,2>{0.361828387f, 0.686439276f},
-std::array<float,2>{0.60006088f, 0.304612696f},
-std::array<float,2>{0.918224275f, 0.841059446f},
-std::array<float,2>{0.227343231f, 0.0432490222f},
-std::array<float,2>{0.08265277f, 0.925276756f},
-std::array<float,2>{0.848531067f, 0.133321315f},
-std::array<float,2>{0.736303985f, 0.622855723f},
-std::array<float,2>{0.408970147f, 0.453168541f},
-std::array<float,2>{0.105519749f, 0.527599514f},
-std::array<float,2>{0.833539426f, 0.404034704f},
-std::array<float,2>{0.688602626f, 0.960277259f},
-std::array<float,2>{0.391784549f, 0.206805691f},
-std::array<float,2>{0.338964552f, 0.805768847f},
-std::array<float,2>{0.571529329f, 0.0912782103f},
-std::array<float,2>{0.887561798f, 0.713326991f},
-std::array<float,2>{0.213378787f, 0.367533296f},
-std::array<float,2>{0.472999811f, 0.632447004f},
-std::array<float,2>{0.630873442f, 0.280892223f},
-std::array<float,2>{0.754088521f, 0.864720762f},
-std::array<float,2>{0.0471096858f, 0.0108485576f},
-std::array<float,2>{0.136342168f, 0.876305521f},
-std::array<float,2>{0.953543127f, 0.171896771f},
-std::array<float,2>{0.534382582f, 0.590721726f},
-std::array<float,2>{0.294776291f, 0.469704777f},
-std::array<float,2>{0.225794032f, 0.746900678f},
-std::array<float,2>{0.910711408f, 0.335349083f},
-std::array<float,2>{0.603159726f, 0.762513101f},
-std::array<float,2>{0.368023515f, 0.115269385f},
-std::array<float,2>{0.417275131f, 0.991724908f},
-std::array<float,2>{0.748568177f, 0.239259645f},
-std::array<float,2>{0.854923069f, 0.560522318f},
-std::array<float,2>{0.0901553184f, 0.428563684f},
-std::array<float,2>{0.265669584f, 0.603704035f},
-std::array<float,2>{0.504820943f, 0.439900905f},
-std::array<float,2>{0.983489931f, 0.917646646f},
-std::array<float,2>{0.179878682f, 0.15084821f},
-std::array<float,2>{0.0217322521f, 0.817696512f},
-std::array<float,2>{0.793088496f, 0.0563259907f},
-std::array<float,2>{0.665983021f, 0.65699935f},
-std::array<float,2>{0.459924251f, 0.286640376f},
-std::array<float,2>{0.0368914977f, 0.682763696f},
-std::array<float,2>{0.778262734f, 0.297554284f},
-std::array<float,2>{0.646633863f, 0.836993754f},
-std::array<float,2>{0.499864817f, 0.0422597453f},
-std::array<float,2>{0.300488859f, 0.926756501f},
-std::array<float,2>{0.560220778f, 0.139063224f},
-std::array<float,2>{0.947002292f, 0.618161082f},
-std::array<float,2>{0.14970693f, 0.459050298f},
-std::array<float,2>{0.375219315f, 0.537882507f},
-std::array<float,2>{0.704826832f, 0.411698312f},
-std::array<float,2>{0.82681638f, 0.981482863f},
-std::array<float,2>{0.113486499f, 0.229645461f},
-std::array<float,2>{0.192296878f, 0.770363748f},
-std::array<float,2>{0.899650156f, 0.0947334543f},
-std::array<float,2>{0.583435535f, 0.73341465f},
-std::array<float,2>{0.32139051f, 0.316978425f},
-std::array<float,2>{0.156310633f, 0.576438129f},
-std::array<float,2>{0.991437674f, 0.492751688f},
-std::array<float,2>{0.527091622f, 0.898656249f},
-std::array<float,2>{0.253014714f, 0.161566481f},
-std::array<float,2>{0.438410103f, 0.858652055f},
-std::array<float,2>{0.679777384f, 0.0234463234f},
-std::array<float,2>{0.806130648f, 0.645896137f},
-std::array<float,2>{0.00701250928f, 0.253523618f},
-std::array<float,2>{0.35169813f, 0.701458454f},
-std::array<float,2>{0.623979688f, 0.349979997f},
-std::array<float,2>{0.929473698f, 0.790351272f},
-std::array<float,2>{0.239579961f, 0.0672055408f},
-std::array<float,2>{0.0625566542f, 0.948366046f},
-std::array<float,2>{0.869275808f, 0.198153824f},
-std::array<float,2>{0.724713683f, 0.513425291f},
-std::array<float,2>{0.428961873f, 0.380952537f},
-std::array<float,2>{0.0112122763f, 0.613698423f},
-std::array<float,2>{0.797820926f, 0.467951924f},
-std::array<float,2>{0.674448133f, 0.931758881f},
-std::array<float,2>{0.451265275f, 0.127864853f},
-std::array<float,2>{0.262884527f, 0.833373249f},
-std::array<float,2>{0.520998061f, 0.0335890092f},
-std::array<float,2>{0.992281199f, 0.67537111f},
-std::array<float,2>{0.16610083f, 0.310722351f},
-std::array<float,2>{0.436824679f, 0.725144088f},
-std::array<float,2>{0.729452848f, 0.326191038f},
-std::array<float,2>{0.860142291f, 0.774082124f},
-std::array<float,2>{0.0718248412f, 0.106295176f},
-std::array<float,2>{0.247623309f, 0.975824058f},
-std::array<float,2>{0.93624258f, 0.223765925f},
-std::array<float,2>{0.615257263f, 0.539863765f},
-std::array<float,2>{0.345066935f, 0.42083627f},
-std::array<float,2>{0.146956563f, 0.654154003f},
-std::array<float,2>{0.944036543f, 0.260349602f},
-std::array<float,2>{0.548196614f, 0.84910357f},
-std::array<float,2>{0.30807057f, 0.0174054019f},
-std::array<float,2>{0.484817743f, 0.892316639f},
-std::array<float,2>{0.650898278f, 0.164969385f},
-std::array<float,2>{0.767662048f, 0.567453146f},
-std::array<float,2>{0.0443907678f, 0.485361964f},
-std::array<float,2>{0.315969348f, 0.507647216f},
-std::array<float,2>{0.588287055f, 0.390322149f},
-std::array<float,2>{0.897100687f, 0.940753818f},
-std::array<float,2>{0.196123302f, 0.192857921f},
-std::array<float,2>{0.119610004f, 0.784696758f},
-std::array<float,2>{0.819531083f, 0.0718194842f},
-std::array<float,2>{0.717033982f, 0.692054689f},
-std::array<float,2>{0.385597587f, 0.359033376f},
-std::array<float,2>{0.0784944668f, 0.70331651f},
-std::array<float,2>{0.846467972f, 0.365581274f},
-std::array<float,2>{0.738427103f, 0.799708903f},
-std::array<float,2>{0.410943121f, 0.0808926672f},
-std::array<float,2>{0.365854532f, 0.965777755f},
-std::array<float,2>{0.596028507f, 0.218402773f},
-std::array<float,2>{0.916864216f, 0.520716965f},
-std::array<float,2>{0.232168809f, 0.392052084f},
-std::array<float,2>{0.46158886f, 0.58293587f},
-std::array<float,2>{0.661924481f, 0.477998048f},
-std::array<float,2>{0.782879353f, 0.890403569f},
-std::array<float,2>{0.0240593497f, 0.184411958f},
-std::array<float,2>{0.173445299f, 0.870063782f},
-std::array<float,2>{0.97645545f, 0.00210671849f},
-std::array<float,2>{0.514245808f, 0.635790348f},
-std::array<float,2>{0.274544269f, 0.273185968f},
-std::array<float,2>{0.208811834f, 0.548484504f},
-std::array<float,2>{0.880171061f, 0.430918217f},
-std::array<float,2>{0.568239868f, 0.995223463f},
-std::array<float,2>{0.33304441f, 0.2437042f},
-std::array<float,2>{0.404669464f, 0.757214189f},
-std::array<float,2>{0.702088594f, 0.121907979f},
-std::array<float,2>{0.839746058f, 0.734644651f},
-std::array<float,2>{0.0986511111f, 0.342838675f},
-std::array<float,2>{0.282274723f, 0.669717789f},
-std::array<float,2>{0.540001631f, 0.291065007f},
-std::array<float,2>{0.964570701f, 0.826572299f},
-std::array<float,2>{0.130604774f, 0.0477624051f},
-std::array<float,2>{0.0598257184f, 0.911654711f},
-std::array<float,2>{0.759073853f, 0.145039037f},
-std::array<float,2>{0.635265291f, 0.599227667f},
-std::array<float,2>{0.478684813f, 0.44821623f},
-std::array<float,2>{0.0519758686f, 0.544520378f},
-std::array<float,2>{0.75188607f, 0.417591393f},
-std::array<float,2>{0.626694798f, 0.971377194f},
-std::array<float,2>{0.46918124f, 0.222007543f},
-std::array<float,2>{0.289880663f, 0.778980911f},
-std::array<float,2>{0.538449585f, 0.101875909f},
-std::array<float,2>{0.957161069f, 0.721182942f},
-std::array<float,2>{0.137257531f, 0.321917415f},
-std::array<float,2>{0.395924032f, 0.676387191f},
-std::array<float,2>{0.691960394f, 0.306787848f},
-std::array<float,2>{0.830736339f, 0.831296742f},
-std::array<float,2>{0.103282884f, 0.0384687558f},
-std::array<float,2>{0.218424201f, 0.936761916f},
-std::array<float,2>{0.886564493f, 0.130884349f},
-std::array<float,2>{0.575223029f, 0.610367239f},
-std::array<float,2>{0.341823012f, 0.461103618f},
-std::array<float,2>{0.184788033f, 0.689251006f},
-std::array<float,2>{0.978149533f, 0.353248328f},
-std::array<float,2>{0.501162827f, 0.785969973f},
-std::array<float,2>{0.273317248f, 0.078071557f},
-std::array<float,2>{0.453469574f, 0.944275796f},
-std::array<float,2>{0.670495927f, 0.188256741f},
-std::array<float,2>{0.792216063f, 0.502814472f},
-std::array<float,2>{0.016735021f, 0.385795951f},
-std::array<float,2>{0.373000801f, 0.563121378f},
-std::array<float,2>{0.608942091f, 0.491510063f},
-std::array<float,2>{0.907931328f, 0.895368338f},
-std::array<float,2>{0.219564393f, 0.171674043f},
-std::array<float,2>{0.0879675373f, 0.84542644f},
-std::array<float,2>{0.856040955f, 0.0214403793f},
-std::array<float,2>{0.745825946f, 0.651482999f},
-std::array<float,2>{0.419128776f, 0.263424069f},
-std::array<float,2>{0.113144219f, 0.640185654f},
-std::array<float,2>{0.823722184f, 0.269133836f},
-std::array<float,2>{0.709538281f, 0.872283995f},
-std::array<float,2>{0.378919572f, 0.00685840473f},
-std::array<float,2>{0.327777386f, 0.886449277f},
-std::array<float,2>{0.579042077f, 0.182547525f},
-std::array<float,2>{0.905601144f, 0.580112517f},
-std::array<float,2>{0.189199373f, 0.480840415f},
-std::array<float,2>{0.495300889f, 0.517903268f},
-std::array<float,2>{0.642273009f, 0.396371305f},
-std::array<float,2>{0.775439024f, 0.963047028f},
-std::array<float,2>{0.0335917063f, 0.214569658f},
-std::array<float,2>{0.154682994f, 0.800814986f},
-std::array<float,2>{0.95239532f, 0.082571201f},
-std::array<float,2>{0.557098866f, 0.710904181f},
-std::array<float,2>{0.303393334f, 0.360531121f},
-std::array<float,2>{0.23705405f, 0.595424891f},
-std::array<float,2>{0.922183156f, 0.452187777f},
-std::array<float,2>{0.619699895f, 0.908046246f},
-std::array<float,2>{0.358426213f, 0.143557936f},
-std::array<float,2>{0.424288392f, 0.823707581f},
-std::array<float,2>{0.718804002f, 0.0527372397f},
-std::array<float,2>{0.873427629f, 0.666467726f},
-std::array<float,2>{0.0686910376f, 0.293770045f},
-std::array<float,2>{0.255716562f, 0.739503145f},
-std::array<float,2>{0.530312359f, 0.336939394f},
-std::array<float,2>{0.987205327f, 0.753220439f},
-std::array<float,2>{0.160250425f, 0.118097849f},
-std::array<float,2>{0.000409441622f, 0.996742904f},
-std::array<float,2>{0.809322298f, 0.247309864f},
-std::array<float,2>{0.68399626f, 0.552960515f},
-std::array<float,2>{0.444731832f, 0.437317073f},
-std::array<float,2>{0.0760996938f, 0.588040769f},
-std::array<float,2>{0.864112556f, 0.473903149f},
-std::array<float,2>{0.733961582f, 0.879037023f},
-std::array<float,2>{0.432514817f, 0.178796515f},
-std::array<float,2>{0.350928128f, 0.861489594f},
-std::array<float,2>{0.61103797f, 0.0118288742f},
-std::array<float,2>{0.93147397f, 0.62800473f},
-std::array<float,2>{0.245203331f, 0.276105434f},
-std::array<float,2>{0.449114114f, 0.717235684f},
-std::array<float,2>{0.677394331f, 0.371125966f},
-std::array<float,2>{0.801961541f, 0.808874071f},
-std::array<float,2>{0.0119839357f, 0.0897645056f},
-std::array<float,2>{0.168416426f, 0.954466581f},
-std::array<float,2>{0.998083889f, 0.207066759f},
-std::array<float,2>{0.517034233f, 0.523747802f},
-std::array<float,2>{0.25866431f, 0.399128377f},
-std::array<float,2>{0.201491803f, 0.662100852f},
-std::array<float,2>{0.892730653f, 0.283626527f},
-std::array<float,2>{0.591527283f, 0.815067172f},
-std::array<float,2>{0.317859709f, 0.060581293f},
-std::array<float,2>{0.387028396f, 0.919882417f},
-std::array<float,2>{0.714011312f, 0.155063689f},
-std::array<float,2>{0.813526928f, 0.608986318f},
-std::array<float,2>{0.123340853f, 0.444843143f},
-std::array<float,2>{0.30863744f, 0.557957232f},
-std::array<float,2>{0.554058313f, 0.422810346f},
-std::array<float,2>{0.941316724f, 0.985369742f},
-std::array<float,2>{0.143327922f, 0.236430094f},
-std::array<float,2>{0.0419669747f, 0.760221243f},
-std::array<float,2>{0.770107567f, 0.113148436f},
-std::array<float,2>{0.652348042f, 0.744207859f},
-std::array<float,2>{0.491158277f, 0.331225485f},
-std::array<float,2>{0.0290239919f, 0.72847712f},
-std::array<float,2>{0.788807631f, 0.313587606f},
-std::array<float,2>{0.658384025f, 0.768872201f},
-std::array<float,2>{0.467757195f, 0.100171268f},
-std::array<float,2>{0.279911697f, 0.978608727f},
-std::array<float,2>{0.511463165f, 0.231859609f},
-std::array<float,2>{0.972268581f, 0.531952083f},
-std::array<float,2>{0.176009536f, 0.410050869f},
-std::array<float,2>{0.406396836f, 0.623425066f},
-std::array<float,2>{0.73671335f, 0.455279589f},
-std::array<float,2>{0.850500941f, 0.923710227f},
-std::array<float,2>{0.0844525024f, 0.134870097f},
-std::array<float,2>{0.22911337f, 0.842146456f},
-std::array<float,2>{0.921691895f, 0.0457135327f},
-std::array<float,2>{0.599041224f, 0.684460342f},
-std::array<float,2>{0.359579384f, 0.300933778f},
-std::array<float,2>{0.125006095f, 0.508413732f},
-std::array<float,2>{0.966611803f, 0.375801563f},
-std::array<float,2>{0.546494305f, 0.952430546f},
-std::array<float,2>{0.285603672f, 0.200646043f},
-std::array<float,2>{0.48287335f, 0.79375571f},
-std::array<float,2>{0.63739419f, 0.0626756698f},
-std::array<float,2>{0.763104975f, 0.69839114f},
-std::array<float,2>{0.0551820919f, 0.344822317f},
-std::array<float,2>{0.329967082f, 0.643433154f},
-std::array<float,2>{0.565927505f, 0.257151246f},
-std::array<float,2>{0.877134085f, 0.854443431f},
-std::array<float,2>{0.204124719f, 0.0309640579f},
-std::array<float,2>{0.0974134654f, 0.906189382f},
-std::array<float,2>{0.840617061f, 0.159968406f},
-std::array<float,2>{0.697645307f, 0.571472943f},
-std::array<float,2>{0.399307311f, 0.496847987f},
-std::array<float,2>{0.0994654298f, 0.550367296f},
-std::array<float,2>{0.838899553f, 0.432334989f},
-std::array<float,2>{0.701631427f, 0.993272185f},
-std::array<float,2>{0.404863864f, 0.244543597f},
-std::array<float,2>{0.333863258f, 0.755552173f},
-std::array<float,2>{0.567401111f, 0.123085678f},
-std::array<float,2>{0.880707622f, 0.737414062f},
-std::array<float,2>{0.208195329f, 0.340366632f},
-std::array<float,2>{0.479204416f, 0.671540141f},
-std::array<float,2>{0.634887874f, 0.290290236f},
-std::array<float,2>{0.759461999f, 0.825339377f},
-std::array<float,2>{0.060243696f, 0.048831556f},
-std::array<float,2>{0.130306572f, 0.91339916f},
-std::array<float,2>{0.963888884f, 0.14749679f},
-std::array<float,2>{0.539271653f, 0.600735724f},
-std::array<float,2>{0.282730371f, 0.447126985f},
-std::array<float,2>{0.231618315f, 0.705117404f},
-std::array<float,2>{0.916283727f, 0.364530116f},
-std::array<float,2>{0.596421957f, 0.798610032f},
-std::array<float,2>{0.365558594f, 0.0784711018f},
-std::array<float,2>{0.410424083f, 0.968438566f},
-std::array<float,2>{0.739011705f, 0.216376856f},
-std::array<float,2>{0.845903993f, 0.522657335f},
-std::array<float,2>{0.0786364004f, 0.393006712f},
-std::array<float,2>{0.274924994f, 0.584488988f},
-std::array<float,2>{0.514015436f, 0.479330838f},
-std::array<float,2>{0.975907564f, 0.887997091f},
-std::array<float,2>{0.173037946f, 0.187217131f},
-std::array<float,2>{0.0236863494f, 0.868146539f},
-std::array<float,2>{0.782396078f, 0.000466227822f},
-std::array<float,2>{0.661414802f, 0.63329047f},
-std::array<float,2>{0.461098999f, 0.270814806f},
-std::array<float,2>{0.0446494333f, 0.655115724f},
-std::array<float,2>{0.768465936f, 0.25884378f},
-std::array<float,2>{0.650433123f, 0.850530982f},
-std::array<float,2>{0.485271364f, 0.0192890037f},
-std::array<float,2>{0.308572143f, 0.892719984f},
-std::array<float,2>{0.548483789f, 0.167909846f},
-std::array<float,2>{0.943458617f, 0.568478227f},
-std::array<float,2>{0.147171751f, 0.487282127f},
-std::array<float,2>{0.384937227f, 0.505004704f},
-std::array<float,2>{0.717369139f, 0.387432575f},
-std::array<float,2>{0.820232034f, 0.939088583f},
-std::array<float,2>{0.120115802f, 0.194919869f},
-std::array<float,2>{0.195778802f, 0.781555057f},
-std::array<float,2>{0.896649241f, 0.0734577328f},
-std::array<float,2>{0.588747084f, 0.69431293f},
-std::array<float,2>{0.315439671f, 0.356404483f},
-std::array<float,2>{0.16658631f, 0.616221786f},
-std::array<float,2>{0.992835641f, 0.46661365f},
-std::array<float,2>{0.520552635f, 0.929807186f},
-std::array<float,2>{0.263487548f, 0.125962794f},
-std::array<float,2>{0.452078253f, 0.835397303f},
-std::array<float,2>{0.673932195f, 0.0330306329f},
-std::array<float,2>{0.79709971f, 0.673633814f},
-std::array<float,2>{0.0115794158f, 0.308869481f},
-std::array<float,2>{0.345236838f, 0.723186255f},
-std::array<float,2>{0.615732431f, 0.325143248f},
-std::array<float,2>{0.93598634f, 0.775531173f},
-std::array<float,2>{0.247485921f, 0.107424378f},
-std::array<float,2>{0.07138592f, 0.974135637f},
-std::array<float,2>{0.859380603f, 0.22601369f},
-std::array<float,2>{0.728618443f, 0.541341662f},
-std::array<float,2>{0.437387109f, 0.419358253f},
-std::array<float,2>{0.00739735831f, 0.575508296f},
-std::array<float,2>{0.806436479f, 0.494619012f},
-std::array<float,2>{0.680639565f, 0.900915146f},
-std::array<float,2>{0.437923789f, 0.163780928f},
-std::array<float,2>{0.253431171f, 0.85666275f},
-std::array<float,2>{0.52671814f, 0.0254786573f},
-std::array<float,2>{0.991877794f, 0.648201346f},
-std::array<float,2>{0.157062694f, 0.250026971f},
-std::array<float,2>{0.429538846f, 0.699549615f},
-std::array<float,2>{0.725535393f, 0.348341137f},
-std::array<float,2>{0.869670212f, 0.792619348f},
-std::array<float,2>{0.0630503744f, 0.0700087771f},
-std::array<float,2>{0.240233123f, 0.94568187f},
-std::array<float,2>{0.928772092f, 0.196343526f},
-std::array<float,2>{0.623327374f, 0.51556313f},
-std::array<float,2>{0.352437973f, 0.379989058f},
-std::array<float,2>{0.149982974f, 0.681136787f},
-std::array<float,2>{0.946350157f, 0.300131679f},
-std::array<float,2>{0.559581995f, 0.839337111f},
-std::array<float,2>{0.300253779f, 0.0393450744f},
-std::array<float,2>{0.499453425f, 0.929472744f},
-std::array<float,2>{0.647186875f, 0.1373f},
-std::array<float,2>{0.777420461f, 0.620631635f},
-std::array<float,2>{0.0361718014f, 0.457253546f},
-std::array<float,2>{0.322212875f, 0.536111653f},
-std::array<float,2>{0.583601832f, 0.412949413f},
-std::array<float,2>{0.900269032f, 0.984079659f},
-std::array<float,2>{0.191849336f, 0.228104442f},
-std::array<float,2>{0.114010014f, 0.773064792f},
-std::array<float,2>{0.826454699f, 0.0964733213f},
-std::array<float,2>{0.7041592f, 0.73177278f},
-std::array<float,2>{0.375933051f, 0.319432735f},
-std::array<float,2>{0.0905198827f, 0.748287857f},
-std::array<float,2>{0.8551597f, 0.33355546f},
-std::array<float,2>{0.748467147f, 0.765465021f},
-std::array<float,2>{0.417584419f, 0.114476725f},
-std::array<float,2>{0.367253244f, 0.989138484f},
-std::array<float,2>{0.602613866f, 0.240405336f},
-std::array<float,2>{0.91061008f, 0.562442482f},
-std::array<float,2>{0.226507157f, 0.426396489f},
-std::array<float,2>{0.459312111f, 0.602961421f},
-std::array<float,2>{0.66515559f, 0.439238012f},
-std::array<float,2>{0.793611646f, 0.915163338f},
-std::array<float,2>{0.0222414546f, 0.149016693f},
-std::array<float,2>{0.180461094f, 0.81897366f},
-std::array<float,2>{0.984213412f, 0.0567148924f},
-std::array<float,2>{0.504152298f, 0.658747792f},
-std::array<float,2>{0.266489059f, 0.287248194f},
-std::array<float,2>{0.213686064f, 0.530758142f},
-std::array<float,2>{0.887083054f, 0.405699521f},
-std::array<float,2>{0.572022796f, 0.957318842f},
-std::array<float,2>{0.339831233f, 0.203362539f},
-std::array<float,2>{0.392423987f, 0.807102621f},
-std::array<float,2>{0.689400852f, 0.0922851637f},
-std::array<float,2>{0.833377481f, 0.712641239f},
-std::array<float,2>{0.106068499f, 0.370182067f},
-std::array<float,2>{0.294076264f, 0.630546331f},
-std::array<float,2>{0.535048366f, 0.278993756f},
-std::array<float,2>{0.953698397f, 0.866532028f},
-std::array<float,2>{0.136209249f, 0.00921331253f},
-std::array<float,2>{0.0474273078f, 0.877133846f},
-std::array<float,2>{0.75459516f, 0.175613254f},
-std::array<float,2>{0.631423712f, 0.591869354f},
-std::array<float,2>{0.473262995f, 0.471484095f},
-std::array<float,2>{0.0547190122f, 0.509937286f},
-std::array<float,2>{0.763228893f, 0.378513008f},
-std::array<float,2>{0.636848807f, 0.949642837f},
-std::array<float,2>{0.483099312f, 0.202757984f},
-std::array<float,2>{0.285914093f, 0.796080112f},
-std::array<float,2>{0.546376348f, 0.0663999692f},
-std::array<float,2>{0.965848982f, 0.697155654f},
-std::array<float,2>{0.125638232f, 0.346834511f},
-std::array<float,2>{0.398657054f, 0.642109692f},
-std::array<float,2>{0.697828889f, 0.254037768f},
-std::array<float,2>{0.839890718f, 0.851687193f},
-std::array<float,2>{0.0971408114f, 0.0277058389f},
-std::array<float,2>{0.204809591f, 0.903981984f},
-std::array<float,2>{0.877673626f, 0.157282501f},
-std::array<float,2>{0.565705359f, 0.572771847f},
-std::array<float,2>{0.329126656f, 0.498487383f},
-std::array<float,2>{0.176725f, 0.729749858f},
-std::array<float,2>{0.971711099f, 0.315121025f},
-std::array<float,2>{0.510861814f, 0.767356277f},
-std::array<float,2>{0.279494882f, 0.0989100412f},
-std::array<float,2>{0.467248321f, 0.978491724f},
-std::array<float,2>{0.65884614f, 0.232609928f},
-std::array<float,2>{0.78828311f, 0.533859134f},
-std::array<float,2>{0.0286901072f, 0.406307876f},
-std::array<float,2>{0.360323161f, 0.622172832f},
-std::array<float,2>{0.599151313f, 0.453941613f},
-std::array<float,2>{0.921269596f, 0.925342917f},
-std::array<float,2>{0.228721365f, 0.132934824f},
-std::array<float,2>{0.0849203616f, 0.841564119f},
-std::array<float,2>{0.850093842f, 0.043694362f},
-std::array<float,2>{0.737293899f, 0.685931504f},
-std::array<float,2>{0.406901658f, 0.303955138f},
-std::array<float,2>{0.123645328f, 0.662764013f},
-std::array<float,2>{0.814095497f, 0.282322228f},
-std::array<float,2>{0.714767635f, 0.814109683f},
-std::array<float,2>{0.387263656f, 0.0603026748f},
-std::array<float,2>{0.318082839f, 0.921281219f},
-std::array<float,2>{0.591224313f, 0.153369337f},
-std::array<float,2>{0.893367231f, 0.60636586f},
-std::array<float,2>{0.202027336f, 0.44300279f},
-std::array<float,2>{0.490498573f, 0.555541277f},
-std::array<float,2>{0.652979016f, 0.424425423f},
-std::array<float,2>{0.76954478f, 0.987988889f},
-std::array<float,2>{0.0414871573f, 0.2351183f},
-std::array<float,2>{0.143000901f, 0.75863415f},
-std::array<float,2>{0.94056052f, 0.110353284f},
-std::array<float,2>{0.55463171f, 0.742767215f},
-std::array<float,2>{0.30949682f, 0.329499245f},
-std::array<float,2>{0.245972574f, 0.587829173f},
-std::array<float,2>{0.931084514f, 0.475561351f},
-std::array<float,2>{0.610358596f, 0.881780922f},
-std::array<float,2>{0.35139519f, 0.176015317f},
-std::array<float,2>{0.432103187f, 0.860362768f},
-std::array<float,2>{0.733734369f, 0.0138611486f},
-std::array<float,2>{0.863325477f, 0.626313984f},
-std::array<float,2>{0.0756022781f, 0.274245292f},
-std::array<float,2>{0.257974982f, 0.714889884f},
-std::array<float,2>{0.517469049f, 0.373857915f},
-std::array<float,2>{0.998799145f, 0.81070298f},
-std::array<float,2>{0.168922365f, 0.0861128122f},
-std::array<float,2>{0.0123699168f, 0.955373704f},
-std::array<float,2>{0.802607536f, 0.210723966f},
-std::array<float,2>{0.67706275f, 0.526464462f},
-std::array<float,2>{0.44833684f, 0.401195824f},
-std::array<float,2>{0.0692011788f, 0.597005188f},
-std::array<float,2>{0.873608589f, 0.449477106f},
-std::array<float,2>{0.71930486f, 0.908642411f},
-std::array<float,2>{0.424599171f, 0.142071024f},
-std::array<float,2>{0.358897716f, 0.820738316f},
-std::array<float,2>{0.619295716f, 0.0526993796f},
-std::array<float,2>{0.922719598f, 0.664105415f},
-std::array<float,2>{0.236443788f, 0.296207756f},
-std::array<float,2>{0.44508478f, 0.741394937f},
-std::array<float,2>{0.684454083f, 0.338340014f},
-std::array<float,2>{0.808900476f, 0.751545012f},
-std::array<float,2>{0.000933901931f, 0.119744159f},
-std::array<float,2>{0.16066283f, 0.998060346f},
-std::array<float,2>{0.986398876f, 0.24973236f},
-std::array<float,2>{0.531084955f, 0.550841928f},
-std::array<float,2>{0.25512144f, 0.434351087f},
-std::array<float,2>{0.188629881f, 0.636759758f},
-std::array<float,2>{0.905999124f, 0.265961528f},
-std::array<float,2>{0.578558862f, 0.873869419f},
-std::array<float,2>{0.327441931f, 0.00529898237f},
-std::array<float,2>{0.37958172f, 0.883649647f},
-std::array<float,2>{0.709410369f, 0.18120034f},
-std::array<float,2>{0.823906779f, 0.57989347f},
-std::array<float,2>{0.112542793f, 0.483497053f},
-std::array<float,2>{0.302816361f, 0.515937388f},
-std::array<float,2>{0.557199299f, 0.39726916f},
-std::array<float,2>{0.95286572f, 0.961589456f},
-std::array<float,2>{0.15511854f, 0.211204499f},
-std::array<float,2>{0.0338612683f, 0.803976536f},
-std::array<float,2>{0.775925517f, 0.0840979815f},
-std::array<float,2>{0.641743958f, 0.708982646f},
-std::array<float,2>{0.495891035f, 0.362038493f},
-std::array<float,2>{0.0171535667f, 0.690938175f},
-std::array<float,2>{0.792903543f, 0.354960799f},
-std::array<float,2>{0.670334578f, 0.788578391f},
-std::array<float,2>{0.454070061f, 0.0750094652f},
-std::array<float,2>{0.272474229f, 0.942952573f},
-std::array<float,2>{0.501652598f, 0.190435767f},
-std::array<float,2>{0.978020608f, 0.500011325f},
-std::array<float,2>{0.185452998f, 0.382909328f},
-std::array<float,2>{0.419707447f, 0.565164447f},
-std::array<float,2>{0.745168626f, 0.489859104f},
-std::array<float,2>{0.855536342f, 0.897259831f},
-std::array<float,2>{0.0888246223f, 0.168379962f},
-std::array<float,2>{0.219224572f, 0.84698832f},
-std::array<float,2>{0.907689154f, 0.0226961151f},
-std::array<float,2>{0.608645558f, 0.64935267f},
-std::array<float,2>{0.37227273f, 0.264428109f},
-std::array<float,2>{0.137090117f, 0.545581341f},
-std::array<float,2>{0.957807422f, 0.414810747f},
-std::array<float,2>{0.538978636f, 0.96996063f},
-std::array<float,2>{0.28908363f, 0.219011128f},
-std::array<float,2>{0.469551772f, 0.781163156f},
-std::array<float,2>{0.626138449f, 0.104747608f},
-std::array<float,2>{0.751265585f, 0.720457733f},
-std::array<float,2>{0.052571889f, 0.322589874f},
-std::array<float,2>{0.342297792f, 0.678025007f},
-std::array<float,2>{0.575731456f, 0.305391252f},
-std::array<float,2>{0.886120856f, 0.82817024f},
-std::array<float,2>{0.217795834f, 0.0356677175f},
-std::array<float,2>{0.102549262f, 0.934583426f},
-std::array<float,2>{0.830563784f, 0.130586028f},
-std::array<float,2>{0.691678822f, 0.612855732f},
-std::array<float,2>{0.396046221f, 0.464534432f},
-std::array<float,2>{0.0812960565f, 0.521113813f},
-std::array<float,2>{0.845585227f, 0.392481387f},
-std::array<float,2>{0.741749108f, 0.96492523f},
-std::array<float,2>{0.413922787f, 0.218023062f},
-std::array<float,2>{0.363330662f, 0.798953235f},
-std::array<float,2>{0.594804466f, 0.0803084299f},
-std::array<float,2>{0.915450871f, 0.703915775f},
-std::array<float,2>{0.233532205f, 0.365903109f},
-std::array<float,2>{0.463500917f, 0.636255801f},
-std::array<float,2>{0.662421823f, 0.272633463f},
-std::array<float,2>{0.783292949f, 0.869555593f},
-std::array<float,2>{0.0260770917f, 0.00284296717f},
-std::array<float,2>{0.175245836f, 0.889826834f},
-std::array<float,2>{0.973677695f, 0.184062466f},
-std::array<float,2>{0.513468206f, 0.582063198f},
-std::array<float,2>{0.276600182f, 0.478149623f},
-std::array<float,2>{0.209957585f, 0.735123277f},
-std::array<float,2>{0.882113695f, 0.343574017f},
-std::array<float,2>{0.569575608f, 0.757644236f},
-std::array<float,2>{0.335366756f, 0.121542655f},
-std::array<float,2>{0.40318045f, 0.995974422f},
-std::array<float,2>{0.700640857f, 0.243389145f},
-std::array<float,2>{0.837887466f, 0.547880173f},
-std::array<float,2>{0.100399151f, 0.43155995f},
-std::array<float,2>{0.284816414f, 0.598870516f},
-std::array<float,2>{0.541494071f, 0.447556943f},
-std::array<float,2>{0.962519586f, 0.91143477f},
-std::array<float,2>{0.131058186f, 0.144643813f},
-std::array<float,2>{0.0624959692f, 0.82696569f},
-std::array<float,2>{0.760218978f, 0.0473129712f},
-std::array<float,2>{0.6333915f, 0.669021785f},
-std::array<float,2>{0.477258801f, 0.291532069f},
-std::array<float,2>{0.00850698445f, 0.674852192f},
-std::array<float,2>{0.799839914f, 0.311442047f},
-std::array<float,2>{0.672644317f, 0.833669484f},
-std::array<float,2>{0.449388921f, 0.033787135f},
-std::array<float,2>{0.265116513f, 0.932605326f},
-std::array<float,2>{0.522212565f, 0.127260566f},
-std::array<float,2>{0.995060563f, 0.614165008f},
-std::array<float,2>{0.164689839f, 0.468521029f},
-std::array<float,2>{0.435198963f, 0.539276302f},
-std::array<float,2>{0.727077365f, 0.419953257f},
-std::array<float,2>{0.86202544f, 0.976179123f},
-std::array<float,2>{0.0733667016f, 0.224357709f},
-std::array<float,2>{0.24910824f, 0.77380693f},
-std::array<float,2>{0.934923351f, 0.105747893f},
-std::array<float,2>{0.614804089f, 0.724846363f},
-std::array<float,2>{0.345921576f, 0.326693326f},
-std::array<float,2>{0.146411568f, 0.568114102f},
-std::array<float,2>{0.941524923f, 0.48599422f},
-std::array<float,2>{0.549770474f, 0.891962647f},
-std::array<float,2>{0.30592218f, 0.164414003f},
-std::array<float,2>{0.48640734f, 0.849354088f},
-std::array<float,2>{0.648733914f, 0.0169352498f},
-std::array<float,2>{0.76747787f, 0.653565466f},
-std::array<float,2>{0.0460175388f, 0.260238111f},
-std::array<float,2>{0.312528193f, 0.691669464f},
-std::array<float,2>{0.586598516f, 0.358530343f},
-std::array<float,2>{0.895543694f, 0.78440392f},
-std::array<float,2>{0.19890824f, 0.0715840161f},
-std::array<float,2>{0.119098395f, 0.94093293f},
-std::array<float,2>{0.817406654f, 0.193098411f},
-std::array<float,2>{0.716670692f, 0.507106006f},
-std::array<float,2>{0.384167463f, 0.389906585f},
-std::array<float,2>{0.037647225f, 0.617582202f},
-std::array<float,2>{0.779751837f, 0.45951435f},
-std::array<float,2>{0.644793749f, 0.925797701f},
-std::array<float,2>{0.496208727f, 0.139338657f},
-std::array<float,2>{0.297008753f, 0.83743f},
-std::array<float,2>{0.560972989f, 0.0425827093f},
-std::array<float,2>{0.94872272f, 0.683508396f},
-std::array<float,2>{0.150976911f, 0.297066569f},
-std::array<float,2>{0.378346413f, 0.734166086f},
-std::array<float,2>{0.705563903f, 0.316417456f},
-std::array<float,2>{0.825027466f, 0.76954782f},
-std::array<float,2>{0.11716374f, 0.0954180211f},
-std::array<float,2>{0.194781706f, 0.982359648f},
-std::array<float,2>{0.901484847f, 0.230265066f},
-std::array<float,2>{0.585855842f, 0.537345767f},
-std::array<float,2>{0.323212206f, 0.411138564f},
-std::array<float,2>{0.159927413f, 0.646022797f},
-std::array<float,2>{0.988639474f, 0.25315702f},
-std::array<float,2>{0.525270641f, 0.859273314f},
-std::array<float,2>{0.250845701f, 0.0241076667f},
-std::array<float,2>{0.43993485f, 0.899263144f},
-std::array<float,2>{0.682530522f, 0.16188927f},
-std::array<float,2>{0.807604849f, 0.576728165f},
-std::array<float,2>{0.00397343282f, 0.49251616f},
-std::array<float,2>{0.354186237f, 0.512976646f},
-std::array<float,2>{0.622134507f, 0.381763965f},
-std::array<float,2>{0.927616179f, 0.948802412f},
-std::array<float,2>{0.241311714f, 0.197629303f},
-std::array<float,2>{0.0661588162f, 0.790593505f},
-std::array<float,2>{0.867237389f, 0.0665703118f},
-std::array<float,2>{0.724574864f, 0.701666355f},
-std::array<float,2>{0.427546591f, 0.35056749f},
-std::array<float,2>{0.107540093f, 0.71356982f},
-std::array<float,2>{0.835160971f, 0.367893815f},
-std::array<float,2>{0.689526498f, 0.806618214f},
-std::array<float,2>{0.393662244f, 0.0917443261f},
-std::array<float,2>{0.336281329f, 0.960608184f},
-std::array<float,2>{0.573014319f, 0.206288517f},
-std::array<float,2>{0.890228331f, 0.527849853f},
-std::array<float,2>{0.211352438f, 0.403482854f},
-std::array<float,2>{0.475354433f, 0.590259492f},
-std::array<float,2>{0.629338682f, 0.468991071f},
-std::array<float,2>{0.756804407f, 0.876705587f},
-std::array<float,2>{0.0499753132f, 0.172491387f},
-std::array<float,2>{0.134744182f, 0.864783525f},
-std::array<float,2>{0.955634832f, 0.011450829f},
-std::array<float,2>{0.532685935f, 0.631954551f},
-std::array<float,2>{0.295539051f, 0.280299157f},
-std::array<float,2>{0.224387914f, 0.559904873f},
-std::array<float,2>{0.913902819f, 0.428194672f},
-std::array<float,2>{0.605217099f, 0.991574526f},
-std::array<float,2>{0.369770825f, 0.239773542f},
-std::array<float,2>{0.414996266f, 0.762031198f},
-std::array<float,2>{0.747745693f, 0.116057426f},
-std::array<float,2>{0.852638423f, 0.746563613f},
-std::array<float,2>{0.0928730145f, 0.335748643f},
-std::array<float,2>{0.26780811f, 0.656368434f},
-std::array<float,2>{0.507779777f, 0.286254197f},
-std::array<float,2>{0.982337177f, 0.818062484f},
-std::array<float,2>{0.182080388f, 0.0557537451f},
-std::array<float,2>{0.0210161973f, 0.917099774f},
-std::array<float,2>{0.795433223f, 0.151055679f},
-std::array<float,2>{0.666657388f, 0.604405642f},
-std::array<float,2>{0.458116323f, 0.440072775f},
-std::array<float,2>{0.0312372539f, 0.531314075f},
-std::array<float,2>{0.785931647f, 0.409512788f},
-std::array<float,2>{0.656649709f, 0.979129493f},
-std::array<float,2>{0.466155767f, 0.232098028f},
-std::array<float,2>{0.277848393f, 0.769382536f},
-std::array<float,2>{0.509378314f, 0.0999861807f},
-std::array<float,2>{0.969433248f, 0.728017032f},
-std::array<float,2>{0.178941786f, 0.314257473f},
-std::array<float,2>{0.408660442f, 0.683722615f},
-std::array<float,2>{0.735665858f, 0.301317334f},
-std::array<float,2>{0.847720087f, 0.842761219f},
-std::array<float,2>{0.0820932835f, 0.0454098098f},
-std::array<float,2>{0.226899922f, 0.923178852f},
-std::array<float,2>{0.918495417f, 0.13530913f},
-std::array<float,2>{0.60030055f, 0.623667955f},
-std::array<float,2>{0.361488432f, 0.455833763f},
-std::array<float,2>{0.127158761f, 0.699203134f},
-std::array<float,2>{0.967580736f, 0.345543832f},
-std::array<float,2>{0.544325709f, 0.793455601f},
-std::array<float,2>{0.288231283f, 0.0633118078f},
-std::array<float,2>{0.481051594f, 0.952825963f},
-std::array<float,2>{0.640111148f, 0.200722486f},
-std::array<float,2>{0.764284253f, 0.508297861f},
-std::array<float,2>{0.0574021153f, 0.375358731f},
-std::array<float,2>{0.33173883f, 0.571898699f},
-std::array<float,2>{0.564248383f, 0.496519983f},
-std::array<float,2>{0.875669718f, 0.905522704f},
-std::array<float,2>{0.206239685f, 0.159502849f},
-std::array<float,2>{0.0955137089f, 0.853977442f},
-std::array<float,2>{0.842408657f, 0.0303455982f},
-std::array<float,2>{0.696806788f, 0.643056571f},
-std::array<float,2>{0.402176917f, 0.257700205f},
-std::array<float,2>{0.0763214156f, 0.628689408f},
-std::array<float,2>{0.866398096f, 0.275752872f},
-std::array<float,2>{0.731794953f, 0.861907125f},
-std::array<float,2>{0.431381404f, 0.0125687784f},
-std::array<float,2>{0.349228561f, 0.87973094f},
-std::array<float,2>{0.612283647f, 0.17952095f},
-std::array<float,2>{0.933420181f, 0.588637233f},
-std::array<float,2>{0.243041992f, 0.474399f},
-std::array<float,2>{0.446356088f, 0.524257004f},
-std::array<float,2>{0.67859149f, 0.398773402f},
-std::array<float,2>{0.802959502f, 0.954835474f},
-std::array<float,2>{0.0151719516f, 0.207730085f},
-std::array<float,2>{0.170393661f, 0.80919975f},
-std::array<float,2>{0.997959614f, 0.0888694897f},
-std::array<float,2>{0.518139005f, 0.717502356f},
-std::array<float,2>{0.260006845f, 0.371672422f},
-std::array<float,2>{0.199777544f, 0.608412206f},
-std::array<float,2>{0.891470492f, 0.444507211f},
-std::array<float,2>{0.593100607f, 0.919261038f},
-std::array<float,2>{0.319666207f, 0.154659927f},
-std::array<float,2>{0.389231056f, 0.81475693f},
-std::array<float,2>{0.71106118f, 0.0610383451f},
-std::array<float,2>{0.81506753f, 0.661601186f},
-std::array<float,2>{0.122654311f, 0.284111857f},
-std::array<float,2>{0.311429918f, 0.744757771f},
-std::array<float,2>{0.552412868f, 0.331939042f},
-std::array<float,2>{0.939354837f, 0.760411203f},
-std::array<float,2>{0.141366795f, 0.112644382f},
-std::array<float,2>{0.0408020578f, 0.986085713f},
-std::array<float,2>{0.771973908f, 0.236923888f},
-std::array<float,2>{0.655986965f, 0.558158398f},
-std::array<float,2>{0.488774657f, 0.42231825f},
-std::array<float,2>{0.111322694f, 0.580824375f},
-std::array<float,2>{0.82219708f, 0.481167525f},
-std::array<float,2>{0.707446158f, 0.886173725f},
-std::array<float,2>{0.380905092f, 0.182083458f},
-std::array<float,2>{0.325673908f, 0.872904539f},
-std::array<float,2>{0.581261456f, 0.0073725651f},
-std::array<float,2>{0.902871311f, 0.639756262f},
-std::array<float,2>{0.191049397f, 0.268782228f},
-std::array<float,2>{0.493073851f, 0.710413516f},
-std::array<float,2>{0.644332528f, 0.361269802f},
-std::array<float,2>{0.775324523f, 0.801387608f},
-std::array<float,2>{0.0315175913f, 0.0822264701f},
-std::array<float,2>{0.152886987f, 0.96371156f},
-std::array<float,2>{0.949936152f, 0.21417816f},
-std::array<float,2>{0.556349993f, 0.51831913f},
-std::array<float,2>{0.301403254f, 0.395975024f},
-std::array<float,2>{0.235557154f, 0.666937709f},
-std::array<float,2>{0.924189985f, 0.293218821f},
-std::array<float,2>{0.618264914f, 0.823854625f},
-std::array<float,2>{0.357234985f, 0.0534179918f},
-std::array<float,2>{0.422742218f, 0.907692373f},
-std::array<float,2>{0.721722305f, 0.144207388f},
-std::array<float,2>{0.872801542f, 0.594857931f},
-std::array<float,2>{0.0668290854f, 0.452832937f},
-std::array<float,2>{0.256811231f, 0.553311169f},
-std::array<float,2>{0.52911073f, 0.436675012f},
-std::array<float,2>{0.984525979f, 0.996402144f},
-std::array<float,2>{0.163877741f, 0.24784258f},
-std::array<float,2>{0.002750088f, 0.753519714f},
-std::array<float,2>{0.810673058f, 0.117489882f},
-std::array<float,2>{0.68709451f, 0.740067601f},
-std::array<float,2>{0.441990733f, 0.337776035f},
-std::array<float,2>{0.0535931662f, 0.721233785f},
-std::array<float,2>{0.753536999f, 0.321537703f},
-std::array<float,2>{0.628853381f, 0.778762877f},
-std::array<float,2>{0.471132755f, 0.102263756f},
-std::array<float,2>{0.292593926f, 0.97113663f},
-std::array<float,2>{0.535615802f, 0.222390741f},
-std::array<float,2>{0.960004747f, 0.544222176f},
-std::array<float,2>{0.139466137f, 0.417219698f},
-std::array<float,2>{0.398156077f, 0.611051559f},
-std::array<float,2>{0.694590986f, 0.461486965f},
-std::array<float,2>{0.829831421f, 0.937245011f},
-std::array<float,2>{0.104239456f, 0.131766185f},
-std::array<float,2>{0.215939417f, 0.831802487f},
-std::array<float,2>{0.883387148f, 0.0388469771f},
-std::array<float,2>{0.576251924f, 0.675991774f},
-std::array<float,2>{0.340362549f, 0.307462603f},
-std::array<float,2>{0.186165705f, 0.502427042f},
-std::array<float,2>{0.978587329f, 0.386254758f},
-std::array<float,2>{0.502951026f, 0.943816543f},
-std::array<float,2>{0.270807326f, 0.187897161f},
-std::array<float,2>{0.45563367f, 0.785388768f},
-std::array<float,2>{0.668737471f, 0.0773576349f},
-std::array<float,2>{0.790033877f, 0.688494802f},
-std::array<float,2>{0.0188265499f, 0.352575839f},
-std::array<float,2>{0.374997318f, 0.652037978f},
-std::array<float,2>{0.605973601f, 0.262890697f},
-std::array<float,2>{0.90995723f, 0.845206261f},
-std::array<float,2>{0.221182287f, 0.0205805488f},
-std::array<float,2>{0.0860502794f, 0.894799829f},
-std::array<float,2>{0.858540773f, 0.170950666f},
-std::array<float,2>{0.743852258f, 0.562605262f},
-std::array<float,2>{0.420547575f, 0.49187243f},
-std::array<float,2>{0.0727955252f, 0.54254818f},
-std::array<float,2>{0.862487912f, 0.418566436f},
-std::array<float,2>{0.728420377f, 0.973087013f},
-std::array<float,2>{0.433756411f, 0.224743739f},
-std::array<float,2>{0.346770674f, 0.777319193f},
-std::array<float,2>{0.61329174f, 0.108666547f},
-std::array<float,2>{0.93385452f, 0.724524021f},
-std::array<float,2>{0.248944238f, 0.325894088f},
-std::array<float,2>{0.451030016f, 0.67244941f},
-std::array<float,2>{0.673450291f, 0.310143948f},
-std::array<float,2>{0.799685717f, 0.83406955f},
-std::array<float,2>{0.00958595518f, 0.0318779573f},
-std::array<float,2>{0.165732548f, 0.931480885f},
-std::array<float,2>{0.995597363f, 0.126010343f},
-std::array<float,2>{0.522638083f, 0.615632474f},
-std::array<float,2>{0.263774157f, 0.465228826f},
-std::array<float,2>{0.197570771f, 0.694734395f},
-std::array<float,2>{0.895111978f, 0.357134759f},
-std::array<float,2>{0.587169647f, 0.782238722f},
-std::array<float,2>{0.314376384f, 0.0724744201f},
-std::array<float,2>{0.38286671f, 0.938233674f},
-std::array<float,2>{0.715181887f, 0.193749547f},
-std::array<float,2>{0.816687822f, 0.504230857f},
-std::array<float,2>{0.117711954f, 0.388398737f},
-std::array<float,2>{0.305360615f, 0.569727719f},
-std::array<float,2>{0.550656378f, 0.488138825f},
-std::array<float,2>{0.942483902f, 0.89421773f},
-std::array<float,2>{0.144983992f, 0.166667148f},
-std::array<float,2>{0.0453039967f, 0.851544261f},
-std::array<float,2>{0.765785873f, 0.0176560916f},
-std::array<float,2>{0.649431765f, 0.655338764f},
-std::array<float,2>{0.487981766f, 0.257889897f},
-std::array<float,2>{0.0270944778f, 0.63453263f},
-std::array<float,2>{0.784549773f, 0.270501137f},
-std::array<float,2>{0.664043784f, 0.868462086f},
-std::array<float,2>{0.46450159f, 0.00158969872f},
-std::array<float,2>{0.276179403f, 0.886819899f},
-std::array<float,2>{0.512418568f, 0.185961232f},
-std::array<float,2>{0.973007381f, 0.585445881f},
-std::array<float,2>{0.174276292f, 0.480323911f},
-std::array<float,2>{0.412979335f, 0.522069633f},
-std::array<float,2>{0.740314424f, 0.393978298f},
-std::array<float,2>{0.843795478f, 0.966899574f},
-std::array<float,2>{0.0801926777f, 0.215517446f},
-std::array<float,2>{0.233273774f, 0.797267675f},
-std::array<float,2>{0.914426148f, 0.0797763318f},
-std::array<float,2>{0.594344556f, 0.706791639f},
-std::array<float,2>{0.364890724f, 0.363701344f},
-std::array<float,2>{0.131964535f, 0.599815726f},
-std::array<float,2>{0.961651087f, 0.445710063f},
-std::array<float,2>{0.542142451f, 0.912772059f},
-std::array<float,2>{0.283680737f, 0.146864086f},
-std::array<float,2>{0.478452086f, 0.824454904f},
-std::array<float,2>{0.633998036f, 0.0498615727f},
-std::array<float,2>{0.76101017f, 0.670379877f},
-std::array<float,2>{0.0609142706f, 0.2893444f},
-std::array<float,2>{0.334695995f, 0.737293243f},
-std::array<float,2>{0.569231629f, 0.341539115f},
-std::array<float,2>{0.881186068f, 0.754853725f},
-std::array<float,2>{0.210828811f, 0.124885492f},
-std::array<float,2>{0.101281635f, 0.992301881f},
-std::array<float,2>{0.836712539f, 0.245349616f},
-std::array<float,2>{0.699561656f, 0.549405515f},
-std::array<float,2>{0.40361169f, 0.433140963f},
-std::array<float,2>{0.0496369638f, 0.592982531f},
-std::array<float,2>{0.757679403f, 0.472436279f},
-std::array<float,2>{0.630372524f, 0.878297627f},
-std::array<float,2>{0.476349384f, 0.173850328f},
-std::array<float,2>{0.295998484f, 0.865455031f},
-std::array<float,2>{0.532204628f, 0.00796230696f},
-std::array<float,2>{0.9561584f, 0.629838288f},
-std::array<float,2>{0.13354452f, 0.27814734f},
-std::array<float,2>{0.392841846f, 0.711332321f},
-std::array<float,2>{0.691274345f, 0.369594812f},
-std::array<float,2>{0.834435701f, 0.807742536f},
-std::array<float,2>{0.108824909f, 0.0933908224f},
-std::array<float,2>{0.212279499f, 0.958106458f},
-std::array<float,2>{0.888804615f, 0.204947725f},
-std::array<float,2>{0.57418555f, 0.530162513f},
-std::array<float,2>{0.337782204f, 0.404650152f},
-std::array<float,2>{0.183576137f, 0.659575582f},
-std::array<float,2>{0.981394112f, 0.288247645f},
-std::array<float,2>{0.506521225f, 0.819522858f},
-std::array<float,2>{0.268664837f, 0.0579470694f},
-std::array<float,2>{0.457351685f, 0.91483146f},
-std::array<float,2>{0.667528152f, 0.150380298f},
-std::array<float,2>{0.796633184f, 0.602173388f},
-std::array<float,2>{0.0199043993f, 0.437612325f},
-std::array<float,2>{0.370758027f, 0.56118834f},
-std::array<float,2>{0.604250014f, 0.427242309f},
-std::array<float,2>{0.913015902f, 0.98976779f},
-std::array<float,2>{0.223403618f, 0.241291761f},
-std::array<float,2>{0.0921785235f, 0.764594138f},
-std::array<float,2>{0.852046609f, 0.113901205f},
-std::array<float,2>{0.746112823f, 0.74979353f},
-std::array<float,2>{0.4150787f, 0.332310081f},
-std::array<float,2>{0.11543721f, 0.731317997f},
-std::array<float,2>{0.82613647f, 0.318905294f},
-std::array<float,2>{0.706947565f, 0.772226512f},
-std::array<float,2>{0.377836674f, 0.0969350338f},
-std::array<float,2>{0.323635459f, 0.98319f},
-std::array<float,2>{0.584253073f, 0.227491975f},
-std::array<float,2>{0.900792658f, 0.536494493f},
-std::array<float,2>{0.194170922f, 0.413806468f},
-std::array<float,2>{0.497235864f, 0.61981231f},
-std::array<float,2>{0.645966172f, 0.45827505f},
-std::array<float,2>{0.78032732f, 0.928701282f},
-std::array<float,2>{0.0384143293f, 0.138370335f},
-std::array<float,2>{0.151905581f, 0.838789642f},
-std::array<float,2>{0.948099196f, 0.0405143425f},
-std::array<float,2>{0.562146306f, 0.680312455f},
-std::array<float,2>{0.298425585f, 0.299343944f},
-std::array<float,2>{0.241063938f, 0.514234781f},
-std::array<float,2>{0.926161468f, 0.379836828f},
-std::array<float,2>{0.621653616f, 0.946969688f},
-std::array<float,2>{0.355390459f, 0.195921689f},
-std::array<float,2>{0.426010936f, 0.791229069f},
-std::array<float,2>{0.722859621f, 0.0690288544f},
-std::array<float,2>{0.868638098f, 0.700590312f},
-std::array<float,2>{0.0654203594f, 0.349415809f},
-std::array<float,2>{0.251811624f, 0.647163987f},
-std::array<float,2>{0.524246931f, 0.25134173f},
-std::array<float,2>{0.989418149f, 0.855746925f},
-std::array<float,2>{0.159113675f, 0.0271051303f},
-std::array<float,2>{0.0055000484f, 0.901850641f},
-std::array<float,2>{0.808558822f, 0.162943825f},
-std::array<float,2>{0.683284342f, 0.57448715f},
-std::array<float,2>{0.441392452f, 0.49605909f},
-std::array<float,2>{0.0138503006f, 0.525411785f},
-std::array<float,2>{0.80375737f, 0.401690125f},
-std::array<float,2>{0.678809345f, 0.956826866f},
-std::array<float,2>{0.446285576f, 0.209468022f},
-std::array<float,2>{0.261143446f, 0.812181652f},
-std::array<float,2>{0.519050837f, 0.0877648443f},
-std::array<float,2>{0.997023463f, 0.716683507f},
-std::array<float,2>{0.171725735f, 0.374644667f},
-std::array<float,2>{0.429827183f, 0.62537092f},
-std::array<float,2>{0.730767012f, 0.275114059f},
-std::array<float,2>{0.865710318f, 0.85977608f},
-std::array<float,2>{0.0777029395f, 0.0151065961f},
-std::array<float,2>{0.243965238f, 0.88203752f},
-std::array<float,2>{0.932109714f, 0.17723304f},
-std::array<float,2>{0.613135576f, 0.586845219f},
-std::array<float,2>{0.347700804f, 0.475997686f},
-std::array<float,2>{0.142267704f, 0.744108081f},
-std::array<float,2>{0.938028693f, 0.329061627f},
-std::array<float,2>{0.551171601f, 0.759112477f},
-std::array<float,2>{0.312436253f, 0.110147305f},
-std::array<float,2>{0.489632308f, 0.986550748f},
-std::array<float,2>{0.654337049f, 0.235486045f},
-std::array<float,2>{0.772835493f, 0.555928886f},
-std::array<float,2>{0.0396476723f, 0.425184727f},
-std::array<float,2>{0.318893224f, 0.607130826f},
-std::array<float,2>{0.592296541f, 0.441913337f},
-std::array<float,2>{0.892040491f, 0.920581102f},
-std::array<float,2>{0.200670406f, 0.153175756f},
-std::array<float,2>{0.121518537f, 0.813153923f},
-std::array<float,2>{0.815514386f, 0.0593741573f},
-std::array<float,2>{0.712090194f, 0.663894355f},
-std::array<float,2>{0.390143245f, 0.281854153f},
-std::array<float,2>{0.0830495656f, 0.686620772f},
-std::array<float,2>{0.848715246f, 0.303687304f},
-std::array<float,2>{0.734819591f, 0.840326965f},
-std::array<float,2>{0.409577042f, 0.0447226986f},
-std::array<float,2>{0.362355411f, 0.924551129f},
-std::array<float,2>{0.600636959f, 0.133921146f},
-std::array<float,2>{0.919311821f, 0.621261418f},
-std::array<float,2>{0.227829918f, 0.454725921f},
-std::array<float,2>{0.465403944f, 0.534799576f},
-std::array<float,2>{0.658077121f, 0.407433987f},
-std::array<float,2>{0.78694582f, 0.976961255f},
-std::array<float,2>{0.0294450037f, 0.233436644f},
-std::array<float,2>{0.177856207f, 0.766349614f},
-std::array<float,2>{0.969839156f, 0.097948879f},
-std::array<float,2>{0.508419335f, 0.72944057f},
-std::array<float,2>{0.278656721f, 0.315987617f},
-std::array<float,2>{0.205658093f, 0.573714018f},
-std::array<float,2>{0.876480758f, 0.499901265f},
-std::array<float,2>{0.56275022f, 0.902353287f},
-std::array<float,2>{0.330909491f, 0.156368837f},
-std::array<float,2>{0.401005119f, 0.852860212f},
-std::array<float,2>{0.6961146f, 0.0286331158f},
-std::array<float,2>{0.843342781f, 0.640967011f},
-std::array<float,2>{0.0939451829f, 0.255820453f},
-std::array<float,2>{0.287829757f, 0.696268022f},
-std::array<float,2>{0.543693602f, 0.346461356f},
-std::array<float,2>{0.96814841f, 0.795785666f},
-std::array<float,2>{0.127931625f, 0.065146476f},
-std::array<float,2>{0.0581989512f, 0.950445771f},
-std::array<float,2>{0.76491642f, 0.201449379f},
-std::array<float,2>{0.639404953f, 0.511512041f},
-std::array<float,2>{0.482360274f, 0.377234757f},
-std::array<float,2>{0.104781859f, 0.611412585f},
-std::array<float,2>{0.8282727f, 0.463416994f},
-std::array<float,2>{0.693551123f, 0.933601081f},
-std::array<float,2>{0.397391558f, 0.129600435f},
-std::array<float,2>{0.3409352f, 0.829600573f},
-std::array<float,2>{0.577542901f, 0.0363430344f},
-std::array<float,2>{0.884562731f, 0.679654539f},
-std::array<float,2>{0.215638027f, 0.306462556f},
-std::array<float,2>{0.471744478f, 0.719188571f},
-std::array<float,2>{0.627203166f, 0.323502839f},
-std::array<float,2>{0.752609432f, 0.779592693f},
-std::array<float,2>{0.0537793599f, 0.103809372f},
-std::array<float,2>{0.139954641f, 0.969439507f},
-std::array<float,2>{0.95909518f, 0.219785705f},
-std::array<float,2>{0.536595762f, 0.546611011f},
-std::array<float,2>{0.291079372f, 0.415688932f},
-std::array<float,2>{0.222061485f, 0.649901152f},
-std::array<float,2>{0.90866816f, 0.265116721f},
-std::array<float,2>{0.607267797f, 0.845988095f},
-std::array<float,2>{0.373302728f, 0.0219329149f},
-std::array<float,2>{0.421337426f, 0.897607088f},
-std::array<float,2>{0.742444694f, 0.169661805f},
-std::array<float,2>{0.858039498f, 0.56562984f},
-std::array<float,2>{0.0878379345f, 0.488547683f},
-std::array<float,2>{0.269996822f, 0.501489222f},
-std::array<float,2>{0.502008975f, 0.384520233f},
-std::array<float,2>{0.98040247f, 0.941576004f},
-std::array<float,2>{0.186907738f, 0.189483672f},
-std::array<float,2>{0.0180808138f, 0.788038909f},
-std::array<float,2>{0.790293157f, 0.0757071078f},
-std::array<float,2>{0.669234633f, 0.690273821f},
-std::array<float,2>{0.456418395f, 0.353862643f},
-std::array<float,2>{0.0323915891f, 0.707826734f},
-std::array<float,2>{0.77440834f, 0.362816632f},
-std::array<float,2>{0.642856896f, 0.803513587f},
-std::array<float,2>{0.493500352f, 0.0851216763f},
-std::array<float,2>{0.301900417f, 0.962593317f},
-std::array<float,2>{0.555019021f, 0.212890267f},
-std::array<float,2>{0.950482547f, 0.517225742f},
-std::array<float,2>{0.154245973f, 0.39820233f},
-std::array<float,2>{0.382405788f, 0.578411937f},
-std::array<float,2>{0.708349109f, 0.482944787f},
-std::array<float,2>{0.821138978f, 0.884617209f},
-std::array<float,2>{0.109605104f, 0.179842353f},
-std::array<float,2>{0.190004244f, 0.874564707f},
-std::array<float,2>{0.903971612f, 0.00392981805f},
-std::array<float,2>{0.580261528f, 0.637733281f},
-std::array<float,2>{0.324381769f, 0.266930729f},
-std::array<float,2>{0.162164286f, 0.552351654f},
-std::array<float,2>{0.985458553f, 0.434883684f},
-std::array<float,2>{0.527868271f, 0.999651968f},
-std::array<float,2>{0.256906271f, 0.248953968f},
-std::array<float,2>{0.442956537f, 0.750330091f},
-std::array<float,2>{0.685576022f, 0.120777503f},
-std::array<float,2>{0.811787069f, 0.740725994f},
-std::array<float,2>{0.00361434394f, 0.338996738f},
-std::array<float,2>{0.3557401f, 0.66516453f},
-std::array<float,2>{0.617729902f, 0.295605659f},
-std::array<float,2>{0.925149441f, 0.821529031f},
-std::array<float,2>{0.234492183f, 0.0508572236f},
-std::array<float,2>{0.0678129867f, 0.909468353f},
-std::array<float,2>{0.871990561f, 0.141202658f},
-std::array<float,2>{0.720863402f, 0.596592128f},
-std::array<float,2>{0.423773587f, 0.45037955f},
-std::array<float,2>{0.120271243f, 0.50590235f},
-std::array<float,2>{0.818634391f, 0.389463067f},
-std::array<float,2>{0.718672931f, 0.939864457f},
-std::array<float,2>{0.38637951f, 0.191470161f},
-std::array<float,2>{0.314460337f, 0.784111381f},
-std::array<float,2>{0.589766204f, 0.0707578063f},
-std::array<float,2>{0.897695899f, 0.693094373f},
-std::array<float,2>{0.19714886f, 0.357883632f},
-std::array<float,2>{0.485392809f, 0.65253067f},
-std::array<float,2>{0.651971757f, 0.260943085f},
-std::array<float,2>{0.768963754f, 0.847922266f},
-std::array<float,2>{0.0436179191f, 0.0161522254f},
-std::array<float,2>{0.148151577f, 0.891048253f},
-std::array<float,2>{0.944759786f, 0.165203452f},
-std::array<float,2>{0.547079206f, 0.567261159f},
-std::array<float,2>{0.306788951f, 0.484737933f},
-std::array<float,2>{0.246241301f, 0.725753129f},
-std::array<float,2>{0.936683834f, 0.328073293f},
-std::array<float,2>{0.616989434f, 0.77497381f},
-std::array<float,2>{0.344027221f, 0.107079782f},
-std::array<float,2>{0.435774177f, 0.975577176f},
-std::array<float,2>{0.730380177f, 0.223544955f},
-std::array<float,2>{0.860359728f, 0.540109456f},
-std::array<float,2>{0.0705918521f, 0.421286136f},
-std::array<float,2>{0.262561232f, 0.615150213f},
-std::array<float,2>{0.520459294f, 0.46682474f},
-std::array<float,2>{0.993627548f, 0.932979167f},
-std::array<float,2>{0.167322904f, 0.128621176f},
-std::array<float,2>{0.0102505619f, 0.8321895f},
-std::array<float,2>{0.798352242f, 0.0347940437f},
-std::array<float,2>{0.675229192f, 0.674105406f},
-std::array<float,2>{0.453066498f, 0.312286407f},
-std::array<float,2>{0.0586104318f, 0.668145299f},
-std::array<float,2>{0.757948458f, 0.292804152f},
-std::array<float,2>{0.636119902f, 0.827960074f},
-std::array<float,2>{0.479705751f, 0.0483044982f},
-std::array<float,2>{0.281427562f, 0.911003172f},
-std::array<float,2>{0.540963292f, 0.145536125f},
-std::array<float,2>{0.962947309f, 0.597716391f},
-std::array<float,2>{0.129036158f, 0.448995173f},
-std::array<float,2>{0.405787349f, 0.547089994f},
-std::array<float,2>{0.70236814f, 0.429937333f},
-std::array<float,2>{0.838488042f, 0.994446874f},
-std::array<float,2>{0.0984281972f, 0.243124589f},
-std::array<float,2>{0.207128286f, 0.756395936f},
-std::array<float,2>{0.879721999f, 0.122351937f},
-std::array<float,2>{0.566783369f, 0.735416293f},
-std::array<float,2>{0.332070529f, 0.342059195f},
-std::array<float,2>{0.172284365f, 0.583730042f},
-std::array<float,2>{0.975109041f, 0.477419496f},
-std::array<float,2>{0.515595496f, 0.888869286f},
-std::array<float,2>{0.274327755f, 0.185308695f},
-std::array<float,2>{0.462188393f, 0.870807111f},
-std::array<float,2>{0.661012828f, 0.0034121424f},
-std::array<float,2>{0.782073021f, 0.635112405f},
-std::array<float,2>{0.0251527689f, 0.271709383f},
-std::array<float,2>{0.366861671f, 0.704868674f},
-std::array<float,2>{0.596741855f, 0.366926849f},
-std::array<float,2>{0.917940855f, 0.799809098f},
-std::array<float,2>{0.231196776f, 0.0816550031f},
-std::array<float,2>{0.0799285844f, 0.966099679f},
-std::array<float,2>{0.847092927f, 0.217262059f},
-std::array<float,2>{0.739896059f, 0.519719243f},
-std::array<float,2>{0.412000299f, 0.391000986f},
-std::array<float,2>{0.0231680945f, 0.605216563f},
-std::array<float,2>{0.794739425f, 0.440935493f},
-std::array<float,2>{0.664793909f, 0.916393459f},
-std::array<float,2>{0.460890323f, 0.152303725f},
-std::array<float,2>{0.267283469f, 0.817111909f},
-std::array<float,2>{0.505323291f, 0.0550111122f},
-std::array<float,2>{0.983379543f, 0.657452047f},
-std::array<float,2>{0.180903196f, 0.285688072f},
-std::array<float,2>{0.416718245f, 0.747864664f},
-std::array<float,2>{0.749909163f, 0.334207684f},
-std::array<float,2>{0.853529572f, 0.762982845f},
-std::array<float,2>{0.0912239552f, 0.116396777f},
-std::array<float,2>{0.22465384f, 0.990307748f},
-std::array<float,2>{0.911322594f, 0.239075929f},
-std::array<float,2>{0.602443576f, 0.558734953f},
-std::array<float,2>{0.368724436f, 0.429355532f},
-std::array<float,2>{0.135408789f, 0.631704867f},
-std::array<float,2>{0.954598367f, 0.279779106f},
-std::array<float,2>{0.534025729f, 0.863571346f},
-std::array<float,2>{0.293867439f, 0.0102066295f},
-std::array<float,2>{0.473745555f, 0.875356615f},
-std::array<float,2>{0.632319689f, 0.173172727f},
-std::array<float,2>{0.755858302f, 0.591081202f},
-std::array<float,2>{0.0486795679f, 0.470511854f},
-std::array<float,2>{0.338521212f, 0.528808057f},
-std::array<float,2>{0.570742905f, 0.402966887f},
-std::array<float,2>{0.888487339f, 0.959062696f},
-std::array<float,2>{0.213960201f, 0.205481231f},
-std::array<float,2>{0.106868297f, 0.805600464f},
-std::array<float,2>{0.832048237f, 0.0903454199f},
-std::array<float,2>{0.687980592f, 0.713869214f},
-std::array<float,2>{0.390790939f, 0.368991286f},
-std::array<float,2>{0.0644253492f, 0.702425838f},
-std::array<float,2>{0.870869756f, 0.351097316f},
-std::array<float,2>{0.72641772f, 0.789779186f},
-std::array<float,2>{0.428694099f, 0.0674068108f},
-std::array<float,2>{0.353105605f, 0.948027134f},
-std::array<float,2>{0.624497414f, 0.199014693f},
-std::array<float,2>{0.92854774f, 0.512204766f},
-std::array<float,2>{0.239005655f, 0.382688314f},
-std::array<float,2>{0.438680083f, 0.577517271f},
-std::array<float,2>{0.681434035f, 0.493919075f},
-std::array<float,2>{0.80539602f, 0.899856865f},
-std::array<float,2>{0.00632304326f, 0.160299107f},
-std::array<float,2>{0.15809752f, 0.857666671f},
-std::array<float,2>{0.990542531f, 0.0248453468f},
-std::array<float,2>{0.525434613f, 0.645489156f},
-std::array<float,2>{0.252761126f, 0.252655834f},
-std::array<float,2>{0.193028137f, 0.538194835f},
-std::array<float,2>{0.899184883f, 0.410449684f},
-std::array<float,2>{0.582302868f, 0.980895877f},
-std::array<float,2>{0.320390731f, 0.228712723f},
-std::array<float,2>{0.376436025f, 0.771168053f},
-std::array<float,2>{0.703755379f, 0.0938333273f},
-std::array<float,2>{0.828116834f, 0.733264446f},
-std::array<float,2>{0.115076624f, 0.317549795f},
-std::array<float,2>{0.299380928f, 0.681958139f},
-std::array<float,2>{0.559533834f, 0.298788816f},
-std::array<float,2>{0.945594668f, 0.836581469f},
-std::array<float,2>{0.149001896f, 0.0411631949f},
-std::array<float,2>{0.0356822126f, 0.927504778f},
-std::array<float,2>{0.778609216f, 0.140267849f},
-std::array<float,2>{0.648359239f, 0.618207216f},
-std::array<float,2>{0.498783678f, 0.460124612f},
-std::array<float,2>{0.0420904793f, 0.557052016f},
-std::array<float,2>{0.771123707f, 0.422864169f},
-std::array<float,2>{0.653750837f, 0.985258162f},
-std::array<float,2>{0.491224319f, 0.237404794f},
-std::array<float,2>{0.310511827f, 0.760830581f},
-std::array<float,2>{0.553545058f, 0.111481018f},
-std::array<float,2>{0.940169871f, 0.745316088f},
-std::array<float,2>{0.144293055f, 0.330587149f},
-std::array<float,2>{0.387970895f, 0.66067493f},
-std::array<float,2>{0.713793516f, 0.284350991f},
-std::array<float,2>{0.812635481f, 0.816037953f},
-std::array<float,2>{0.124690622f, 0.061552614f},
-std::array<float,2>{0.20232442f, 0.918495595f},
-std::array<float,2>{0.893767059f, 0.155609205f},
-std::array<float,2>{0.590176404f, 0.608350754f},
-std::array<float,2>{0.316754371f, 0.44350335f},
-std::array<float,2>{0.169695541f, 0.717800021f},
-std::array<float,2>{0.999325156f, 0.372989058f},
-std::array<float,2>{0.516582251f, 0.810056567f},
-std::array<float,2>{0.2590532f, 0.0882122889f},
-std::array<float,2>{0.448182911f, 0.954079032f},
-std::array<float,2>{0.676492095f, 0.208219394f},
-std::array<float,2>{0.801630974f, 0.525328994f},
-std::array<float,2>{0.0133365551f, 0.399724931f},
-std::array<float,2>{0.35046795f, 0.589430392f},
-std::array<float,2>{0.610218465f, 0.473026246f},
-std::array<float,2>{0.929696083f, 0.880409479f},
-std::array<float,2>{0.244559094f, 0.177857965f},
-std::array<float,2>{0.0744040236f, 0.862750113f},
-std::array<float,2>{0.864347219f, 0.0132882828f},
-std::array<float,2>{0.732864499f, 0.627352834f},
-std::array<float,2>{0.43346104f, 0.276662678f},
-std::array<float,2>{0.0962909088f, 0.643908203f},
-std::array<float,2>{0.841493845f, 0.256337166f},
-std::array<float,2>{0.698877752f, 0.855314732f},
-std::array<float,2>{0.399712443f, 0.0295246914f},
-std::array<float,2>{0.328991473f, 0.90431118f},
-std::array<float,2>{0.564776599f, 0.15834628f},
-std::array<float,2>{0.878680706f, 0.570613623f},
-std::array<float,2>{0.203468949f, 0.497715712f},
-std::array<float,2>{0.483773977f, 0.509633005f},
-std::array<float,2>{0.637701392f, 0.376205385f},
-std::array<float,2>{0.762185633f, 0.951694846f},
-std::array<float,2>{0.0565565713f, 0.200075403f},
-std::array<float,2>{0.126918718f, 0.794345796f},
-std::array<float,2>{0.965547323f, 0.0643796027f},
-std::array<float,2>{0.545871675f, 0.698058844f},
-std::array<float,2>{0.286550701f, 0.344642401f},
-std::array<float,2>{0.229755193f, 0.624246955f},
-std::array<float,2>{0.919930518f, 0.456595302f},
-std::array<float,2>{0.598450541f, 0.922445238f},
-std::array<float,2>{0.360964626f, 0.136465982f},
-std::array<float,2>{0.407698393f, 0.843406796f},
-std::array<float,2>{0.73778373f, 0.0466844067f},
-std::array<float,2>{0.851019025f, 0.68462038f},
-std::array<float,2>{0.0853470936f, 0.301999569f},
-std::array<float,2>{0.280585617f, 0.727348328f},
-std::array<float,2>{0.509788632f, 0.312965989f},
-std::array<float,2>{0.970939815f, 0.768284202f},
-std::array<float,2>{0.177151099f, 0.100813165f},
-std::array<float,2>{0.0275269058f, 0.980265021f},
-std::array<float,2>{0.787935019f, 0.230964988f},
-std::array<float,2>{0.659286916f, 0.532860756f},
-std::array<float,2>{0.468437076f, 0.40861842f},
-std::array<float,2>{0.0896831602f, 0.564075291f},
-std::array<float,2>{0.857322335f, 0.490378529f},
-std::array<float,2>{0.744527876f, 0.896417558f},
-std::array<float,2>{0.418214142f, 0.17052035f},
-std::array<float,2>{0.37178877f, 0.844172835f},
-std::array<float,2>{0.607436478f, 0.0195991844f},
-std::array<float,2>{0.906377375f, 0.650414824f},
-std::array<float,2>{0.219728351f, 0.262157172f},
-std::array<float,2>{0.45452565f, 0.687508345f},
-std::array<float,2>{0.671383321f, 0.352251232f},
-std::array<float,2>{0.791030526f, 0.786192954f},
-std::array<float,2>{0.0159022491f, 0.0763378069f},
-std::array<float,2>{0.184508771f, 0.945239663f},
-std::array<float,2>{0.977351844f, 0.188540131f},
-std::array<float,2>{0.500254393f, 0.503148615f},
-std::array<float,2>{0.271501243f, 0.385693878f},
-std::array<float,2>{0.217167795f, 0.677056193f},
-std::array<float,2>{0.885480464f, 0.307971805f},
-std::array<float,2>{0.574732363f, 0.830375254f},
-std::array<float,2>{0.343389809f, 0.0375828743f},
-std::array<float,2>{0.395054907f, 0.936359465f},
-std::array<float,2>{0.693163514f, 0.132765874f},
-std::array<float,2>{0.831606209f, 0.610171258f},
-std::array<float,2>{0.10205812f, 0.462670565f},
-std::array<float,2>{0.291010886f, 0.543329954f},
-std::array<float,2>{0.537491798f, 0.416919559f},
-std::array<float,2>{0.958480537f, 0.972627282f},
-std::array<float,2>{0.13797684f, 0.220804274f},
-std::array<float,2>{0.0514507629f, 0.777905405f},
-std::array<float,2>{0.75044167f, 0.103509367f},
-std::array<float,2>{0.625096977f, 0.722128451f},
-std::array<float,2>{0.470643938f, 0.320643455f},
-std::array<float,2>{0.00190795981f, 0.73850733f},
-std::array<float,2>{0.810373008f, 0.33631435f},
-std::array<float,2>{0.685191929f, 0.752558827f},
-std::array<float,2>{0.443434536f, 0.119112894f},
-std::array<float,2>{0.254633754f, 0.997371852f},
-std::array<float,2>{0.529713988f, 0.246554717f},
-std::array<float,2>{0.987856686f, 0.554540634f},
-std::array<float,2>{0.161258012f, 0.435966849f},
-std::array<float,2>{0.424957752f, 0.594185293f},
-std::array<float,2>{0.720641375f, 0.451316923f},
-std::array<float,2>{0.874172628f, 0.906571209f},
-std::array<float,2>{0.0695864633f, 0.14286153f},
-std::array<float,2>{0.238125011f, 0.822518229f},
-std::array<float,2>{0.923659503f, 0.0540614873f},
-std::array<float,2>{0.621035576f, 0.667771637f},
-std::array<float,2>{0.357797652f, 0.294195712f},
-std::array<float,2>{0.155545563f, 0.519212484f},
-std::array<float,2>{0.951651335f, 0.395358413f},
-std::array<float,2>{0.55769825f, 0.96401912f},
-std::array<float,2>{0.303871214f, 0.213356093f},
-std::array<float,2>{0.494965583f, 0.8019858f},
-std::array<float,2>{0.641066909f, 0.0832233354f},
-std::array<float,2>{0.776582897f, 0.709010124f},
-std::array<float,2>{0.0349467546f, 0.359880954f},
-std::array<float,2>{0.327146292f, 0.63910526f},
-std::array<float,2>{0.579454482f, 0.268206269f},
-std::array<float,2>{0.904526412f, 0.871759236f},
-std::array<float,2>{0.188388631f, 0.00670185266f},
-std::array<float,2>{0.11134512f, 0.885698378f},
-std::array<float,2>{0.822547615f, 0.183253318f},
-std::array<float,2>{0.710308433f, 0.581237674f},
-std::array<float,2>{0.380698591f, 0.481621206f},
-std::array<float,2>{0.124974094f, 0.555084765f},
-std::array<float,2>{0.812972009f, 0.423924118f},
-std::array<float,2>{0.713439882f, 0.987710059f},
-std::array<float,2>{0.387786239f, 0.234451979f},
-std::array<float,2>{0.316446304f, 0.758136034f},
-std::array<float,2>{0.589976847f, 0.110910565f},
-std::array<float,2>{0.893925488f, 0.742431581f},
-std::array<float,2>{0.202556849f, 0.329795897f},
-std::array<float,2>{0.491662234f, 0.662231147f},
-std::array<float,2>{0.653535426f, 0.283000082f},
-std::array<float,2>{0.771338344f, 0.813909411f},
-std::array<float,2>{0.0424780175f, 0.0599265434f},
-std::array<float,2>{0.144192785f, 0.921582997f},
-std::array<float,2>{0.940208018f, 0.154176474f},
-std::array<float,2>{0.553245902f, 0.605885744f},
-std::array<float,2>{0.310127944f, 0.442619026f},
-std::array<float,2>{0.244179204f, 0.715461612f},
-std::array<float,2>{0.930144966f, 0.373510271f},
-std::array<float,2>{0.610022128f, 0.811392426f},
-std::array<float,2>{0.350119889f, 0.0867071673f},
-std::array<float,2>{0.433190048f, 0.955696583f},
-std::array<float,2>{0.732528448f, 0.210021138f},
-std::array<float,2>{0.864637196f, 0.527074218f},
-std::array<float,2>{0.0744851157f, 0.400584668f},
-std::array<float,2>{0.259010166f, 0.586989522f},
-std::array<float,2>{0.516218424f, 0.47463122f},
-std::array<float,2>{0.999122977f, 0.881173313f},
-std::array<float,2>{0.169574067f, 0.176501393f},
-std::array<float,2>{0.0134407822f, 0.861308634f},
-std::array<float,2>{0.801499546f, 0.0144786928f},
-std::array<float,2>{0.676715672f, 0.626500249f},
-std::array<float,2>{0.447878897f, 0.273496121f},
-std::array<float,2>{0.0562024675f, 0.641644597f},
-std::array<float,2>{0.761925876f, 0.254499793f},
-std::array<float,2>{0.63811022f, 0.852385283f},
-std::array<float,2>{0.48357895f, 0.028130237f},
-std::array<float,2>{0.286144674f, 0.903409362f},
-std::array<float,2>{0.545460224f, 0.157868177f},
-std::array<float,2>{0.965746045f, 0.572602451f},
-std::array<float,2>{0.126580402f, 0.498659909f},
-std::array<float,2>{0.399630576f, 0.510355771f},
-std::array<float,2>{0.699038506f, 0.377957851f},
-std::array<float,2>{0.841674447f, 0.950154781f},
-std::array<float,2>{0.096487537f, 0.202343434f},
-std::array<float,2>{0.203127593f, 0.79680866f},
-std::array<float,2>{0.878631949f, 0.0656746775f},
-std::array<float,2>{0.564571977f, 0.696615875f},
-std::array<float,2>{0.328687638f, 0.347238362f},
-std::array<float,2>{0.176793262f, 0.62272203f},
-std::array<float,2>{0.971006751f, 0.453596234f},
-std::array<float,2>{0.510214865f, 0.924856424f},
-std::array<float,2>{0.280393034f, 0.133678392f},
-std::array<float,2>{0.46871689f, 0.841298223f},
-std::array<float,2>{0.659629643f, 0.0431277417f},
-std::array<float,2>{0.787763536f, 0.686249673f},
-std::array<float,2>{0.0277609099f, 0.304318577f},
-std::array<float,2>{0.361133993f, 0.730117381f},
-std::array<float,2>{0.598249614f, 0.314566344f},
-std::array<float,2>{0.92036742f, 0.766704917f},
-std::array<float,2>{0.229716703f, 0.0994619131f},
-std::array<float,2>{0.0850617141f, 0.977654457f},
-std::array<float,2>{0.850659251f, 0.233277738f},
-std::array<float,2>{0.737467527f, 0.533578038f},
-std::array<float,2>{0.40740791f, 0.407108814f},
-std::array<float,2>{0.0158376582f, 0.56468612f},
-std::array<float,2>{0.791433454f, 0.48936376f},
-std::array<float,2>{0.670935929f, 0.896608114f},
-std::array<float,2>{0.454262853f, 0.168608323f},
-std::array<float,2>{0.271939278f, 0.847456217f},
-std::array<float,2>{0.500083447f, 0.0230743904f},
-std::array<float,2>{0.977138102f, 0.648443937f},
-std::array<float,2>{0.184244007f, 0.263709337f},
-std::array<float,2>{0.418005943f, 0.690534234f},
-std::array<float,2>{0.744243205f, 0.355187893f},
-std::array<float,2>{0.857149124f, 0.788303375f},
-std::array<float,2>{0.089411661f, 0.0742981285f},
-std::array<float,2>{0.220082149f, 0.942491472f},
-std::array<float,2>{0.906736493f, 0.191078857f},
-std::array<float,2>{0.607819557f, 0.500972509f},
-std::array<float,2>{0.371844143f, 0.383579254f},
-std::array<float,2>{0.137780458f, 0.678242326f},
-std::array<float,2>{0.95817095f, 0.304955959f},
-std::array<float,2>{0.537190318f, 0.828873575f},
-std::array<float,2>{0.290542275f, 0.0355890468f},
-std::array<float,2>{0.47040382f, 0.935303092f},
-std::array<float,2>{0.625393093f, 0.130344167f},
-std::array<float,2>{0.750223875f, 0.612543285f},
-std::array<float,2>{0.0515234955f, 0.463896692f},
-std::array<float,2>{0.343537897f, 0.545134425f},
-std::array<float,2>{0.575137138f, 0.414162517f},
-std::array<float,2>{0.885731637f, 0.970384896f},
-std::array<float,2>{0.216876909f, 0.219339162f},
-std::array<float,2>{0.102479033f, 0.780609965f},
-std::array<float,2>{0.831797779f, 0.105150416f},
-std::array<float,2>{0.693067491f, 0.72009182f},
-std::array<float,2>{0.395414919f, 0.322767884f},
-std::array<float,2>{0.0695422366f, 0.741855919f},
-std::array<float,2>{0.874283433f, 0.338480294f},
-std::array<float,2>{0.720252156f, 0.751222789f},
-std::array<float,2>{0.425068706f, 0.119500689f},
-std::array<float,2>{0.35766229f, 0.99869436f},
-std::array<float,2>{0.620672464f, 0.249186009f},
-std::array<float,2>{0.923373044f, 0.551666975f},
-std::array<float,2>{0.237865493f, 0.433598846f},
-std::array<float,2>{0.443777472f, 0.597244799f},
-std::array<float,2>{0.685533762f, 0.450015008f},
-std::array<float,2>{0.810101569f, 0.909000218f},
-std::array<float,2>{0.00161568762f, 0.142138734f},
-std::array<float,2>{0.161423773f, 0.820928454f},
-std::array<float,2>{0.988236547f, 0.0519216023f},
-std::array<float,2>{0.529411137f, 0.66456604f},
-std::array<float,2>{0.254829466f, 0.296767414f},
-std::array<float,2>{0.188071787f, 0.516415119f},
-std::array<float,2>{0.904733241f, 0.396709651f},
-std::array<float,2>{0.579213142f, 0.961067557f},
-std::array<float,2>{0.326863557f, 0.211810157f},
-std::array<float,2>{0.380384147f, 0.804342449f},
-std::array<float,2>{0.710174799f, 0.084663339f},
-std::array<float,2>{0.822474897f, 0.70845592f},
-std::array<float,2>{0.111729555f, 0.361613154f},
-std::array<float,2>{0.304030865f, 0.63751781f},
-std::array<float,2>{0.557888865f, 0.266517699f},
-std::array<float,2>{0.951247692f, 0.873283267f},
-std::array<float,2>{0.155483648f, 0.00567099266f},
-std::array<float,2>{0.0348123163f, 0.883253694f},
-std::array<float,2>{0.776690066f, 0.180781245f},
-std::array<float,2>{0.640857697f, 0.579428554f},
-std::array<float,2>{0.494797289f, 0.48412171f},
-std::array<float,2>{0.0437090248f, 0.505846202f},
-std::array<float,2>{0.76875639f, 0.387156844f},
-std::array<float,2>{0.652328432f, 0.938916922f},
-std::array<float,2>{0.485788763f, 0.194483191f},
-std::array<float,2>{0.306967467f, 0.782073021f},
-std::array<float,2>{0.547207534f, 0.0738894939f},
-std::array<float,2>{0.944508135f, 0.693658888f},
-std::array<float,2>{0.148383155f, 0.355840087f},
-std::array<float,2>{0.38667047f, 0.654422104f},
-std::array<float,2>{0.718296349f, 0.259623289f},
-std::array<float,2>{0.818602264f, 0.849763453f},
-std::array<float,2>{0.120466061f, 0.018698737f},
-std::array<float,2>{0.196929306f, 0.893076122f},
-std::array<float,2>{0.897784173f, 0.167472556f},
-std::array<float,2>{0.58946687f, 0.569114625f},
-std::array<float,2>{0.314771682f, 0.486439168f},
-std::array<float,2>{0.167195007f, 0.72282356f},
-std::array<float,2>{0.993286848f, 0.324563205f},
-std::array<float,2>{0.520260274f, 0.775966823f},
-std::array<float,2>{0.262448847f, 0.10796719f},
-std::array<float,2>{0.452637106f, 0.973686039f},
-std::array<float,2>{0.674994886f, 0.226253301f},
-std::array<float,2>{0.798671067f, 0.541565955f},
-std::array<float,2>{0.00980398618f, 0.419730216f},
-std::array<float,2>{0.343903571f, 0.616988182f},
-std::array<float,2>{0.616816282f, 0.466295779f},
-std::array<float,2>{0.936801612f, 0.930602193f},
-std::array<float,2>{0.246507719f, 0.125119835f},
-std::array<float,2>{0.070541285f, 0.835461855f},
-std::array<float,2>{0.860800445f, 0.0325096175f},
-std::array<float,2>{0.730004907f, 0.673299968f},
-std::array<float,2>{0.435802162f, 0.309368759f},
-std::array<float,2>{0.0982236192f, 0.671144664f},
-std::array<float,2>{0.838758886f, 0.290892661f},
-std::array<float,2>{0.702511966f, 0.825780392f},
-std::array<float,2>{0.406177938f, 0.049662061f},
-std::array<float,2>{0.33245641f, 0.913853824f},
-std::array<float,2>{0.566585422f, 0.148379803f},
-std::array<float,2>{0.879589736f, 0.601277053f},
-std::array<float,2>{0.207387492f, 0.446562588f},
-std::array<float,2>{0.479847312f, 0.550043464f},
-std::array<float,2>{0.635941386f, 0.432092607f},
-std::array<float,2>{0.758256257f, 0.993878007f},
-std::array<float,2>{0.0589469709f, 0.244787052f},
-std::array<float,2>{0.129342347f, 0.755133033f},
-std::array<float,2>{0.963306904f, 0.12394242f},
-std::array<float,2>{0.540644705f, 0.738056421f},
-std::array<float,2>{0.281564087f, 0.34005183f},
-std::array<float,2>{0.231367037f, 0.584273636f},
-std::array<float,2>{0.91760242f, 0.478677094f},
-std::array<float,2>{0.59715116f, 0.888486087f},
-std::array<float,2>{0.367096156f, 0.186827943f},
-std::array<float,2>{0.411700308f, 0.867463648f},
-std::array<float,2>{0.740131974f, 0.000830690667f},
-std::array<float,2>{0.846844912f, 0.633493721f},
-std::array<float,2>{0.0796446204f, 0.271252543f},
-std::array<float,2>{0.27401197f, 0.706013143f},
-std::array<float,2>{0.51516217f, 0.365029097f},
-std::array<float,2>{0.975515842f, 0.798017502f},
-std::array<float,2>{0.171935514f, 0.078616865f},
-std::array<float,2>{0.025078753f, 0.967959642f},
-std::array<float,2>{0.781928897f, 0.216211528f},
-std::array<float,2>{0.660886884f, 0.523130774f},
-std::array<float,2>{0.461920142f, 0.393269449f},
-std::array<float,2>{0.0908727497f, 0.603169262f},
-std::array<float,2>{0.853919506f, 0.438790083f},
-std::array<float,2>{0.749591529f, 0.915534556f},
-std::array<float,2>{0.416768879f, 0.148925632f},
-std::array<float,2>{0.369047284f, 0.818648696f},
-std::array<float,2>{0.602057159f, 0.0571737587f},
-std::array<float,2>{0.911492586f, 0.658407211f},
-std::array<float,2>{0.224969804f, 0.287707746f},
-std::array<float,2>{0.460581541f, 0.748740733f},
-std::array<float,2>{0.664923191f, 0.333410859f},
-std::array<float,2>{0.7946257f, 0.765013576f},
-std::array<float,2>{0.0233590305f, 0.114747338f},
-std::array<float,2>{0.180947259f, 0.988403916f},
-std::array<float,2>{0.9829669f, 0.240822777f},
-std::array<float,2>{0.505033255f, 0.561962664f},
-std::array<float,2>{0.267525852f, 0.426041931f},
-std::array<float,2>{0.214116633f, 0.630068541f},
-std::array<float,2>{0.888353884f, 0.278759092f},
-std::array<float,2>{0.57040745f, 0.867077827f},
-std::array<float,2>{0.338743508f, 0.00962006953f},
-std::array<float,2>{0.390874028f, 0.877810538f},
-std::array<float,2>{0.687657356f, 0.175205201f},
-std::array<float,2>{0.832463264f, 0.592724681f},
-std::array<float,2>{0.106534548f, 0.470896035f},
-std::array<float,2>{0.293679506f, 0.53093344f},
-std::array<float,2>{0.533804119f, 0.406174242f},
-std::array<float,2>{0.954919517f, 0.957762003f},
-std::array<float,2>{0.135602534f, 0.203937083f},
-std::array<float,2>{0.0485369079f, 0.807279229f},
-std::array<float,2>{0.755490363f, 0.0921700597f},
-std::array<float,2>{0.631866574f, 0.712031543f},
-std::array<float,2>{0.473991454f, 0.370950162f},
-std::array<float,2>{0.00588156329f, 0.700040817f},
-std::array<float,2>{0.805526316f, 0.347932905f},
-std::array<float,2>{0.681168079f, 0.79210192f},
-std::array<float,2>{0.438838094f, 0.0694165528f},
-std::array<float,2>{0.252519488f, 0.946213841f},
-std::array<float,2>{0.525865793f, 0.196959823f},
-std::array<float,2>{0.990462601f, 0.515081525f},
-std::array<float,2>{0.157717302f, 0.380849153f},
-std::array<float,2>{0.428258747f, 0.576130867f},
-std::array<float,2>{0.726270556f, 0.494695902f},
-std::array<float,2>{0.870711863f, 0.900448143f},
-std::array<float,2>{0.0640751049f, 0.163211539f},
-std::array<float,2>{0.239205241f, 0.857325315f},
-std::array<float,2>{0.928397775f, 0.0259446576f},
-std::array<float,2>{0.624100864f, 0.647642195f},
-std::array<float,2>{0.353404462f, 0.250876218f},
-std::array<float,2>{0.149295688f, 0.535417974f},
-std::array<float,2>{0.945471227f, 0.412406057f},
-std::array<float,2>{0.559225678f, 0.983774841f},
-std::array<float,2>{0.299623907f, 0.227989733f},
-std::array<float,2>{0.498716354f, 0.772588253f},
-std::array<float,2>{0.648004174f, 0.0961502567f},
-std::array<float,2>{0.778548717f, 0.732265234f},
-std::array<float,2>{0.0360308252f, 0.32002151f},
-std::array<float,2>{0.320759386f, 0.681415558f},
-std::array<float,2>{0.582125664f, 0.300330311f},
-std::array<float,2>{0.898945451f, 0.839545071f},
-std::array<float,2>{0.193232358f, 0.040001478f},
-std::array<float,2>{0.114772022f, 0.929181874f},
-std::array<float,2>{0.827767849f, 0.136816338f},
-std::array<float,2>{0.703872085f, 0.620330632f},
-std::array<float,2>{0.376089305f, 0.457729369f},
-std::array<float,2>{0.0779535249f, 0.523582637f},
-std::array<float,2>{0.865370631f, 0.39925167f},
-std::array<float,2>{0.730665922f, 0.954323828f},
-std::array<float,2>{0.430066854f, 0.207439259f},
-std::array<float,2>{0.348114908f, 0.808634341f},
-std::array<float,2>{0.612966716f, 0.0895255879f},
-std::array<float,2>{0.931798041f, 0.716892123f},
-std::array<float,2>{0.243816286f, 0.371342421f},
-std::array<float,2>{0.445839137f, 0.628294289f},
-std::array<float,2>{0.679082811f, 0.276311368f},
-std::array<float,2>{0.804098487f, 0.861732006f},
-std::array<float,2>{0.0139277177f, 0.0120953657f},
-std::array<float,2>{0.171621785f, 0.879190028f},
-std::array<float,2>{0.996825755f, 0.179111123f},
-std::array<float,2>{0.519456565f, 0.588156819f},
-std::array<float,2>{0.260780603f, 0.473741472f},
-std::array<float,2>{0.20033288f, 0.744506061f},
-std::array<float,2>{0.891831636f, 0.331436127f},
-std::array<float,2>{0.59276104f, 0.760000527f},
-std::array<float,2>{0.319282442f, 0.112818912f},
-std::array<float,2>{0.390607297f, 0.985622346f},
-std::array<float,2>{0.712209404f, 0.236613974f},
-std::array<float,2>{0.815883636f, 0.557844341f},
-std::array<float,2>{0.121171333f, 0.42244482f},
-std::array<float,2>{0.312114596f, 0.609226465f},
-std::array<float,2>{0.550968885f, 0.445123494f},
-std::array<float,2>{0.9383955f, 0.919664145f},
-std::array<float,2>{0.142403319f, 0.154848918f},
-std::array<float,2>{0.0399898998f, 0.815278828f},
-std::array<float,2>{0.772593975f, 0.0609030016f},
-std::array<float,2>{0.654739559f, 0.661622107f},
-std::array<float,2>{0.489264607f, 0.283246815f},
-std::array<float,2>{0.0297750663f, 0.684094846f},
-std::array<float,2>{0.78672564f, 0.301148951f},
-std::array<float,2>{0.657788038f, 0.841865003f},
-std::array<float,2>{0.465583533f, 0.0455674641f},
-std::array<float,2>{0.278546929f, 0.923402846f},
-std::array<float,2>{0.508723021f, 0.135056034f},
-std::array<float,2>{0.970028043f, 0.623134255f},
-std::array<float,2>{0.178183511f, 0.455393195f},
-std::array<float,2>{0.409333348f, 0.532082558f},
-std::array<float,2>{0.734532535f, 0.409886479f},
-std::array<float,2>{0.848945796f, 0.978976071f},
-std::array<float,2>{0.0834017694f, 0.231482476f},
-std::array<float,2>{0.227750227f, 0.768704653f},
-std::array<float,2>{0.918967903f, 0.100406237f},
-std::array<float,2>{0.60085994f, 0.728145301f},
-std::array<float,2>{0.362739295f, 0.313830972f},
-std::array<float,2>{0.12833856f, 0.571615994f},
-std::array<float,2>{0.967775941f, 0.496699572f},
-std::array<float,2>{0.543865681f, 0.905817568f},
-std::array<float,2>{0.288056582f, 0.159775704f},
-std::array<float,2>{0.482077181f, 0.854037285f},
-std::array<float,2>{0.639333248f, 0.0311874934f},
-std::array<float,2>{0.764743805f, 0.643249035f},
-std::array<float,2>{0.0585804209f, 0.256910384f},
-std::array<float,2>{0.330781162f, 0.698552072f},
-std::array<float,2>{0.562589347f, 0.345205486f},
-std::array<float,2>{0.876832008f, 0.793474555f},
-std::array<float,2>{0.20583044f, 0.0628412291f},
-std::array<float,2>{0.0941993967f, 0.952149034f},
-std::array<float,2>{0.843534827f, 0.200422436f},
-std::array<float,2>{0.695926487f, 0.508640289f},
-std::array<float,2>{0.401350081f, 0.375675499f},
-std::array<float,2>{0.05419866f, 0.610818565f},
-std::array<float,2>{0.752896726f, 0.461228907f},
-std::array<float,2>{0.626989305f, 0.936900675f},
-std::array<float,2>{0.471971661f, 0.13129954f},
-std::array<float,2>{0.291362882f, 0.831541896f},
-std::array<float,2>{0.536219537f, 0.0383086279f},
-std::array<float,2>{0.959344029f, 0.676719487f},
-std::array<float,2>{0.139854968f, 0.306934446f},
-std::array<float,2>{0.397042483f, 0.720720232f},
-std::array<float,2>{0.693714142f, 0.322092175f},
-std::array<float,2>{0.828500211f, 0.779090166f},
-std::array<float,2>{0.104716793f, 0.101729602f},
-std::array<float,2>{0.215548724f, 0.971488237f},
-std::array<float,2>{0.884441435f, 0.221801013f},
-std::array<float,2>{0.57724309f, 0.544800222f},
-std::array<float,2>{0.341202348f, 0.417820632f},
-std::array<float,2>{0.186708033f, 0.651718676f},
-std::array<float,2>{0.980136514f, 0.263660192f},
-std::array<float,2>{0.502201796f, 0.845700324f},
-std::array<float,2>{0.26969707f, 0.0210710615f},
-std::array<float,2>{0.456134796f, 0.895064175f},
-std::array<float,2>{0.669161856f, 0.171458408f},
-std::array<float,2>{0.790092885f, 0.563408017f},
-std::array<float,2>{0.0185077265f, 0.491285563f},
-std::array<float,2>{0.373080194f, 0.502606869f},
-std::array<float,2>{0.607171178f, 0.38601923f},
-std::array<float,2>{0.908263028f, 0.943975627f},
-std::array<float,2>{0.221879408f, 0.188129738f},
-std::array<float,2>{0.087520428f, 0.785710871f},
-std::array<float,2>{0.858199954f, 0.0776903108f},
-std::array<float,2>{0.742323875f, 0.689118505f},
-std::array<float,2>{0.420941651f, 0.353464246f},
-std::array<float,2>{0.109733574f, 0.710664332f},
-std::array<float,2>{0.820804954f, 0.360688418f},
-std::array<float,2>{0.70820564f, 0.801144481f},
-std::array<float,2>{0.382583976f, 0.0829079673f},
-std::array<float,2>{0.32459113f, 0.963187754f},
-std::array<float,2>{0.580413699f, 0.214610517f},
-std::array<float,2>{0.904133141f, 0.517785966f},
-std::array<float,2>{0.190200895f, 0.396168828f},
-std::array<float,2>{0.493261814f, 0.580490828f},
-std::array<float,2>{0.642647326f, 0.480594933f},
-std::array<float,2>{0.774096966f, 0.886550128f},
-std::array<float,2>{0.032697361f, 0.182154208f},
-std::array<float,2>{0.15392068f, 0.872421086f},
-std::array<float,2>{0.950280666f, 0.0073182066f},
-std::array<float,2>{0.554834604f, 0.640541911f},
-std::array<float,2>{0.302020282f, 0.269332707f},
-std::array<float,2>{0.234846696f, 0.553073108f},
-std::array<float,2>{0.924823046f, 0.437038064f},
-std::array<float,2>{0.618031383f, 0.99699235f},
-std::array<float,2>{0.355665803f, 0.247476116f},
-std::array<float,2>{0.423350126f, 0.753139257f},
-std::array<float,2>{0.721182287f, 0.1177103f},
-std::array<float,2>{0.871763825f, 0.739273787f},
-std::array<float,2>{0.0674496889f, 0.337305099f},
-std::array<float,2>{0.257246792f, 0.666169345f},
-std::array<float,2>{0.528253317f, 0.293523818f},
-std::array<float,2>{0.985623777f, 0.823443711f},
-std::array<float,2>{0.162590846f, 0.0530884117f},
-std::array<float,2>{0.00374827441f, 0.907863796f},
-std::array<float,2>{0.811601162f, 0.144006759f},
-std::array<float,2>{0.685958207f, 0.595647871f},
-std::array<float,2>{0.443126529f, 0.452519387f},
-std::array<float,2>{0.0094739683f, 0.539751887f},
-std::array<float,2>{0.79940486f, 0.420503259f},
-std::array<float,2>{0.673825562f, 0.975992441f},
-std::array<float,2>{0.450786859f, 0.224113882f},
-std::array<float,2>{0.264069587f, 0.77423799f},
-std::array<float,2>{0.522815406f, 0.106004231f},
-std::array<float,2>{0.995271266f, 0.725378633f},
-std::array<float,2>{0.165858194f, 0.32654801f},
-std::array<float,2>{0.433983147f, 0.675633132f},
-std::array<float,2>{0.728170335f, 0.310869157f},
-std::array<float,2>{0.862581968f, 0.833055496f},
-std::array<float,2>{0.0730474889f, 0.0334357172f},
-std::array<float,2>{0.248600945f, 0.931894422f},
-std::array<float,2>{0.933796823f, 0.127657205f},
-std::array<float,2>{0.613627076f, 0.613517761f},
-std::array<float,2>{0.346998125f, 0.46813193f},
-std::array<float,2>{0.144651175f, 0.692313433f},
-std::array<float,2>{0.942776263f, 0.359305531f},
-std::array<float,2>{0.550424397f, 0.785078526f},
-std::array<float,2>{0.305514276f, 0.0720767826f},
-std::array<float,2>{0.488083631f, 0.940493405f},
-std::array<float,2>{0.649844825f, 0.192514509f},
-std::array<float,2>{0.765971482f, 0.507414281f},
-std::array<float,2>{0.0450341702f, 0.390540779f},
-std::array<float,2>{0.314138919f, 0.567736506f},
-std::array<float,2>{0.587030411f, 0.485653341f},
-std::array<float,2>{0.895322561f, 0.892542422f},
-std::array<float,2>{0.19726862f, 0.164617702f},
-std::array<float,2>{0.11816071f, 0.848790169f},
-std::array<float,2>{0.816470683f, 0.0172652341f},
-std::array<float,2>{0.714916706f, 0.653932631f},
-std::array<float,2>{0.38320303f, 0.260517448f},
-std::array<float,2>{0.0805542916f, 0.635994732f},
-std::array<float,2>{0.84409821f, 0.273403734f},
-std::array<float,2>{0.740571678f, 0.869823754f},
-std::array<float,2>{0.412793249f, 0.002379613f},
-std::array<float,2>{0.365129262f, 0.890236497f},
-std::array<float,2>{0.594691753f, 0.18411842f},
-std::array<float,2>{0.91428858f, 0.582663476f},
-std::array<float,2>{0.232987672f, 0.477733612f},
-std::array<float,2>{0.464631766f, 0.520971537f},
-std::array<float,2>{0.663614988f, 0.391672134f},
-std::array<float,2>{0.784261823f, 0.965427756f},
-std::array<float,2>{0.0273399316f, 0.218681455f},
-std::array<float,2>{0.17402944f, 0.799372256f},
-std::array<float,2>{0.972838521f, 0.0807855278f},
-std::array<float,2>{0.512475431f, 0.703500211f},
-std::array<float,2>{0.276075214f, 0.365243137f},
-std::array<float,2>{0.210669219f, 0.599548042f},
-std::array<float,2>{0.880879641f, 0.447780579f},
-std::array<float,2>{0.568984389f, 0.911928058f},
-std::array<float,2>{0.334752947f, 0.145335078f},
-std::array<float,2>{0.403391987f, 0.826295257f},
-std::array<float,2>{0.699247539f, 0.0473857298f},
-std::array<float,2>{0.836576641f, 0.669526517f},
-std::array<float,2>{0.101398282f, 0.291457504f},
-std::array<float,2>{0.283427268f, 0.734618127f},
-std::array<float,2>{0.542324305f, 0.343110174f},
-std::array<float,2>{0.961903572f, 0.757010579f},
-std::array<float,2>{0.13211742f, 0.121587656f},
-std::array<float,2>{0.0606843717f, 0.995569587f},
-std::array<float,2>{0.760779381f, 0.244013593f},
-std::array<float,2>{0.63405776f, 0.548704505f},
-std::array<float,2>{0.478070378f, 0.4308047f},
-std::array<float,2>{0.108625084f, 0.590551615f},
-std::array<float,2>{0.834129035f, 0.469444454f},
-std::array<float,2>{0.690956771f, 0.876010537f},
-std::array<float,2>{0.392590165f, 0.172275454f},
-std::array<float,2>{0.337586731f, 0.864299238f},
-std::array<float,2>{0.573737025f, 0.0110382829f},
-std::array<float,2>{0.88898772f, 0.632611275f},
-std::array<float,2>{0.212033883f, 0.281059653f},
-std::array<float,2>{0.47630313f, 0.713066936f},
-std::array<float,2>{0.630787671f, 0.36740917f},
-std::array<float,2>{0.75756228f, 0.805925608f},
-std::array<float,2>{0.0495564975f, 0.0909236744f},
-std::array<float,2>{0.133743733f, 0.959974408f},
-std::array<float,2>{0.956474423f, 0.206660643f},
-std::array<float,2>{0.531740546f, 0.527556181f},
-std::array<float,2>{0.296250731f, 0.404273123f},
-std::array<float,2>{0.223207429f, 0.65682286f},
-std::array<float,2>{0.912633181f, 0.287050486f},
-std::array<float,2>{0.60409236f, 0.817474902f},
-std::array<float,2>{0.370948493f, 0.056444291f},
-std::array<float,2>{0.415480316f, 0.917869329f},
-std::array<float,2>{0.746467173f, 0.150579751f},
-std::array<float,2>{0.85170275f, 0.603761435f},
-std::array<float,2>{0.0919281915f, 0.439619392f},
-std::array<float,2>{0.269030541f, 0.560268879f},
-std::array<float,2>{0.506606281f, 0.428354859f},
-std::array<float,2>{0.981010318f, 0.991995275f},
-std::array<float,2>{0.183345944f, 0.239552513f},
-std::array<float,2>{0.0197388381f, 0.762422144f},
-std::array<float,2>{0.79657501f, 0.115504995f},
-std::array<float,2>{0.667875946f, 0.746652901f},
-std::array<float,2>{0.457116753f, 0.335150838f},
-std::array<float,2>{0.0381833166f, 0.733655632f},
-std::array<float,2>{0.780755699f, 0.317197174f},
-std::array<float,2>{0.645633876f, 0.770171165f},
-std::array<float,2>{0.497371286f, 0.0952012837f},
-std::array<float,2>{0.298688561f, 0.981826186f},
-std::array<float,2>{0.562431157f, 0.229976013f},
-std::array<float,2>{0.947794616f, 0.537701607f},
-std::array<float,2>{0.152268216f, 0.412036479f},
-std::array<float,2>{0.377464771f, 0.617688715f},
-std::array<float,2>{0.706607223f, 0.459344536f},
-std::array<float,2>{0.825901151f, 0.926504374f},
-std::array<float,2>{0.115692176f, 0.138676822f},
-std::array<float,2>{0.193881586f, 0.837290049f},
-std::array<float,2>{0.900534272f, 0.0421500206f},
-std::array<float,2>{0.584017932f, 0.683008373f},
-std::array<float,2>{0.323354006f, 0.297723919f},
-std::array<float,2>{0.158823103f, 0.513556182f},
-std::array<float,2>{0.989553273f, 0.381227463f},
-std::array<float,2>{0.523955822f, 0.948705375f},
-std::array<float,2>{0.251480877f, 0.197764054f},
-std::array<float,2>{0.441026062f, 0.790225923f},
-std::array<float,2>{0.683562219f, 0.066933319f},
-std::array<float,2>{0.808184087f, 0.701248646f},
-std::array<float,2>{0.00569239957f, 0.349652588f},
-std::array<float,2>{0.355062038f, 0.645739675f},
-std::array<float,2>{0.622001648f, 0.253742009f},
-std::array<float,2>{0.925886869f, 0.858637869f},
-std::array<float,2>{0.240818128f, 0.0237195008f},
-std::array<float,2>{0.0650703907f, 0.898737431f},
-std::array<float,2>{0.86816901f, 0.161181375f},
-std::array<float,2>{0.723097026f, 0.576192498f},
-std::array<float,2>{0.426204175f, 0.493155956f},
-std::array<float,2>{0.0823132247f, 0.53462261f},
-std::array<float,2>{0.84807837f, 0.408166826f},
-std::array<float,2>{0.735364795f, 0.977488816f},
-std::array<float,2>{0.40835309f, 0.234117806f},
-std::array<float,2>{0.361707449f, 0.765631318f},
-std::array<float,2>{0.600384772f, 0.0984135345f},
-std::array<float,2>{0.918830633f, 0.728881598f},
-std::array<float,2>{0.226802707f, 0.315708429f},
-std::array<float,2>{0.466007084f, 0.687232554f},
-std::array<float,2>{0.656304419f, 0.30308339f},
-std::array<float,2>{0.785663843f, 0.840480149f},
-std::array<float,2>{0.0308532454f, 0.0444328934f},
-std::array<float,2>{0.179078862f, 0.924300492f},
-std::array<float,2>{0.969687343f, 0.134437054f},
-std::array<float,2>{0.509689033f, 0.621619523f},
-std::array<float,2>{0.278239578f, 0.45445773f},
-std::array<float,2>{0.20633772f, 0.695630312f},
-std::array<float,2>{0.875883281f, 0.34577322f},
-std::array<float,2>{0.564041078f, 0.795315564f},
-std::array<float,2>{0.331988961f, 0.0646881387f},
-std::array<float,2>{0.40199393f, 0.950912237f},
-std::array<float,2>{0.69706285f, 0.201726943f},
-std::array<float,2>{0.842613339f, 0.511126697f},
-std::array<float,2>{0.0952178836f, 0.377907574f},
-std::array<float,2>{0.28853637f, 0.573775113f},
-std::array<float,2>{0.543968976f, 0.499116719f},
-std::array<float,2>{0.967297733f, 0.902973831f},
-std::array<float,2>{0.127335787f, 0.157177702f},
-std::array<float,2>{0.0571590774f, 0.853369594f},
-std::array<float,2>{0.764498293f, 0.028840933f},
-std::array<float,2>{0.63976562f, 0.641249478f},
-std::array<float,2>{0.481212705f, 0.255201012f},
-std::array<float,2>{0.0155956317f, 0.625652492f},
-std::array<float,2>{0.803191066f, 0.274761945f},
-std::array<float,2>{0.678245127f, 0.860215843f},
-std::array<float,2>{0.446760416f, 0.0154123437f},
-std::array<float,2>{0.260064244f, 0.882716298f},
-std::array<float,2>{0.518521488f, 0.177728221f},
-std::array<float,2>{0.99763602f, 0.585965395f},
-std::array<float,2>{0.169965029f, 0.476391703f},
-std::array<float,2>{0.431631535f, 0.526185036f},
-std::array<float,2>{0.731621385f, 0.402002424f},
-std::array<float,2>{0.866693735f, 0.956404924f},
-std::array<float,2>{0.0766359568f, 0.209872037f},
-std::array<float,2>{0.242898524f, 0.811729789f},
-std::array<float,2>{0.933277428f, 0.0872255191f},
-std::array<float,2>{0.612011015f, 0.715836465f},
-std::array<float,2>{0.349443406f, 0.374384105f},
-std::array<float,2>{0.141295716f, 0.606486022f},
-std::array<float,2>{0.939150155f, 0.441814482f},
-std::array<float,2>{0.552501023f, 0.920042515f},
-std::array<float,2>{0.311044335f, 0.152541757f},
-std::array<float,2>{0.489035428f, 0.812646866f},
-std::array<float,2>{0.656202316f, 0.0588898249f},
-std::array<float,2>{0.772320092f, 0.663477361f},
-std::array<float,2>{0.0405696183f, 0.281631678f},
-std::array<float,2>{0.319500446f, 0.743551254f},
-std::array<float,2>{0.592966557f, 0.328580618f},
-std::array<float,2>{0.891196609f, 0.759463906f},
-std::array<float,2>{0.200018227f, 0.109824553f},
-std::array<float,2>{0.122990921f, 0.986960948f},
-std::array<float,2>{0.815241754f, 0.23632361f},
-std::array<float,2>{0.711243927f, 0.556575418f},
-std::array<float,2>{0.389541447f, 0.425509185f},
-std::array<float,2>{0.0313534029f, 0.578708291f},
-std::array<float,2>{0.775027335f, 0.482724816f},
-std::array<float,2>{0.644202888f, 0.884204447f},
-std::array<float,2>{0.492889136f, 0.18046996f},
-std::array<float,2>{0.301690459f, 0.874256253f},
-std::array<float,2>{0.556477726f, 0.00464094244f},
-std::array<float,2>{0.950009525f, 0.63836062f},
-std::array<float,2>{0.15320459f, 0.26733315f},
-std::array<float,2>{0.381232649f, 0.707145214f},
-std::array<float,2>{0.707135797f, 0.362566531f},
-std::array<float,2>{0.82186389f, 0.802744806f},
-std::array<float,2>{0.111059822f, 0.0858805478f},
-std::array<float,2>{0.19124037f, 0.962383211f},
-std::array<float,2>{0.90326345f, 0.212006554f},
-std::array<float,2>{0.581508636f, 0.516875744f},
-std::array<float,2>{0.325383455f, 0.3977485f},
-std::array<float,2>{0.163708463f, 0.665748715f},
-std::array<float,2>{0.984801054f, 0.29507792f},
-std::array<float,2>{0.528878629f, 0.821951926f},
-std::array<float,2>{0.256530225f, 0.0514984168f},
-std::array<float,2>{0.442308366f, 0.909790635f},
-std::array<float,2>{0.6872949f, 0.141085997f},
-std::array<float,2>{0.810802221f, 0.595858216f},
-std::array<float,2>{0.0025121537f, 0.451059937f},
-std::array<float,2>{0.357173115f, 0.551765144f},
-std::array<float,2>{0.61857456f, 0.435369849f},
-std::array<float,2>{0.924057543f, 0.999171197f},
-std::array<float,2>{0.235695839f, 0.24831219f},
-std::array<float,2>{0.0665923581f, 0.75062722f},
-std::array<float,2>{0.872847736f, 0.120207362f},
-std::array<float,2>{0.72204107f, 0.740633726f},
-std::array<float,2>{0.422462881f, 0.339770377f},
-std::array<float,2>{0.10448999f, 0.719516397f},
-std::array<float,2>{0.829874933f, 0.32397157f},
-std::array<float,2>{0.694528461f, 0.779921472f},
-std::array<float,2>{0.398406684f, 0.104294457f},
-std::array<float,2>{0.340676039f, 0.969220042f},
-std::array<float,2>{0.576524377f, 0.220261395f},
-std::array<float,2>{0.883593857f, 0.54616791f},
-std::array<float,2>{0.21620746f, 0.415192991f},
-std::array<float,2>{0.47090438f, 0.612005651f},
-std::array<float,2>{0.628548622f, 0.463103205f},
-std::array<float,2>{0.753840983f, 0.934121609f},
-std::array<float,2>{0.0534168966f, 0.128972188f},
-std::array<float,2>{0.139205948f, 0.829275668f},
-std::array<float,2>{0.960411072f, 0.0367038064f},
-std::array<float,2>{0.535384297f, 0.678993404f},
-std::array<float,2>{0.292919427f, 0.305982888f},
-std::array<float,2>{0.220855638f, 0.50105685f},
-std::array<float,2>{0.909906149f, 0.383793801f},
-std::array<float,2>{0.606209755f, 0.942367196f},
-std::array<float,2>{0.374526292f, 0.190338507f},
-std::array<float,2>{0.420748711f, 0.787509918f},
-std::array<float,2>{0.74392736f, 0.0752348751f},
-std::array<float,2>{0.858791351f, 0.689632714f},
-std::array<float,2>{0.0862572342f, 0.354389966f},
-std::array<float,2>{0.270707905f, 0.650299311f},
-std::array<float,2>{0.503336549f, 0.26530242f},
-std::array<float,2>{0.978969455f, 0.846447468f},
-std::array<float,2>{0.186284021f, 0.0220910087f},
-std::array<float,2>{0.0187982861f, 0.898307383f},
-std::array<float,2>{0.789671063f, 0.169047803f},
-std::array<float,2>{0.668565452f, 0.566303372f},
-std::array<float,2>{0.455924094f, 0.48885262f},
-std::array<float,2>{0.0261560623f, 0.521593392f},
-std::array<float,2>{0.783606529f, 0.394422174f},
-std::array<float,2>{0.662147641f, 0.96757859f},
-std::array<float,2>{0.463725656f, 0.215326831f},
-std::array<float,2>{0.27670455f, 0.797593534f},
-std::array<float,2>{0.513189971f, 0.0794472545f},
-std::array<float,2>{0.97404021f, 0.70608747f},
-std::array<float,2>{0.174964175f, 0.363856822f},
-std::array<float,2>{0.413784683f, 0.633940339f},
-std::array<float,2>{0.742086768f, 0.269541949f},
-std::array<float,2>{0.845414102f, 0.868785322f},
-std::array<float,2>{0.0815365016f, 0.00103873957f},
-std::array<float,2>{0.233693808f, 0.887235582f},
-std::array<float,2>{0.915047944f, 0.186460197f},
-std::array<float,2>{0.595156789f, 0.585679591f},
-std::array<float,2>{0.363701254f, 0.479876757f},
-std::array<float,2>{0.131321922f, 0.736665547f},
-std::array<float,2>{0.962730169f, 0.34126842f},
-std::array<float,2>{0.541028559f, 0.754281998f},
-std::array<float,2>{0.284959078f, 0.124458089f},
-std::array<float,2>{0.477323145f, 0.992846012f},
-std::array<float,2>{0.633770585f, 0.24596329f},
-std::array<float,2>{0.759852469f, 0.548961699f},
-std::array<float,2>{0.062057402f, 0.432699144f},
-std::array<float,2>{0.335141629f, 0.600407243f},
-std::array<float,2>{0.569754362f, 0.446070313f},
-std::array<float,2>{0.881849766f, 0.912476778f},
-std::array<float,2>{0.209553376f, 0.14704594f},
-std::array<float,2>{0.10020528f, 0.824859738f},
-std::array<float,2>{0.837450266f, 0.0503476486f},
-std::array<float,2>{0.700281978f, 0.670482814f},
-std::array<float,2>{0.402908236f, 0.289840817f},
-std::array<float,2>{0.0735245422f, 0.672035813f},
-std::array<float,2>{0.862229049f, 0.309941143f},
-std::array<float,2>{0.727507234f, 0.834947824f},
-std::array<float,2>{0.435308516f, 0.0315358452f},
-std::array<float,2>{0.345952719f, 0.930812657f},
-std::array<float,2>{0.615196228f, 0.126644105f},
-std::array<float,2>{0.934793293f, 0.615769386f},
-std::array<float,2>{0.249367133f, 0.465379834f},
-std::array<float,2>{0.449616402f, 0.542294741f},
-std::array<float,2>{0.672436297f, 0.418207943f},
-std::array<float,2>{0.800277948f, 0.973157287f},
-std::array<float,2>{0.00861396547f, 0.225480586f},
-std::array<float,2>{0.165000737f, 0.776557863f},
-std::array<float,2>{0.994851112f, 0.109138429f},
-std::array<float,2>{0.522246242f, 0.724092364f},
-std::array<float,2>{0.264730185f, 0.32534796f},
-std::array<float,2>{0.199118689f, 0.569940865f},
-std::array<float,2>{0.895980239f, 0.487343788f},
-std::array<float,2>{0.586842179f, 0.893736243f},
-std::array<float,2>{0.312834382f, 0.166256741f},
-std::array<float,2>{0.383909166f, 0.850809813f},
-std::array<float,2>{0.716517687f, 0.0181680862f},
-std::array<float,2>{0.817825675f, 0.656240106f},
-std::array<float,2>{0.118821479f, 0.258781135f},
-std::array<float,2>{0.305815518f, 0.694942951f},
-std::array<float,2>{0.549487531f, 0.356459379f},
-std::array<float,2>{0.941795707f, 0.783028662f},
-std::array<float,2>{0.14622654f, 0.0731617659f},
-std::array<float,2>{0.0462589227f, 0.937807143f},
-std::array<float,2>{0.767220378f, 0.194083214f},
-std::array<float,2>{0.648486376f, 0.504872262f},
-std::array<float,2>{0.486641765f, 0.38787362f},
-std::array<float,2>{0.116930574f, 0.619248569f},
-std::array<float,2>{0.824844182f, 0.45852524f},
-std::array<float,2>{0.7050789f, 0.927828252f},
-std::array<float,2>{0.377949178f, 0.137969613f},
-std::array<float,2>{0.322945058f, 0.838280141f},
-std::array<float,2>{0.585681975f, 0.040702723f},
-std::array<float,2>{0.901729882f, 0.680000544f},
-std::array<float,2>{0.194360897f, 0.299024224f},
-std::array<float,2>{0.496342212f, 0.730702996f},
-std::array<float,2>{0.644730151f, 0.318795532f},
-std::array<float,2>{0.779526055f, 0.771688282f},
-std::array<float,2>{0.0380725414f, 0.0972099155f},
-std::array<float,2>{0.151332289f, 0.982621551f},
-std::array<float,2>{0.948407114f, 0.22704345f},
-std::array<float,2>{0.560779035f, 0.536626399f},
-std::array<float,2>{0.297256798f, 0.41342476f},
-std::array<float,2>{0.241489649f, 0.646559358f},
-std::array<float,2>{0.927356422f, 0.251838624f},
-std::array<float,2>{0.622488618f, 0.856265783f},
-std::array<float,2>{0.354323417f, 0.0266910866f},
-std::array<float,2>{0.427256346f, 0.90228045f},
-std::array<float,2>{0.724332988f, 0.162292406f},
-std::array<float,2>{0.867550969f, 0.574925542f},
-std::array<float,2>{0.0661869571f, 0.495352745f},
-std::array<float,2>{0.250708193f, 0.51394099f},
-std::array<float,2>{0.525005579f, 0.379142582f},
-std::array<float,2>{0.988407493f, 0.94634068f},
-std::array<float,2>{0.159886971f, 0.195741802f},
-std::array<float,2>{0.00430657296f, 0.791578114f},
-std::array<float,2>{0.807255268f, 0.0687767044f},
-std::array<float,2>{0.682150543f, 0.700946629f},
-std::array<float,2>{0.439656287f, 0.34869352f},
-std::array<float,2>{0.0501433685f, 0.711762547f},
-std::array<float,2>{0.756397009f, 0.369733632f},
-std::array<float,2>{0.629135907f, 0.808220387f},
-std::array<float,2>{0.475278854f, 0.0932607874f},
-std::array<float,2>{0.295669734f, 0.95865947f},
-std::array<float,2>{0.532238185f, 0.204207525f},
-std::array<float,2>{0.955923915f, 0.529558659f},
-std::array<float,2>{0.134381786f, 0.404785514f},
-std::array<float,2>{0.393980086f, 0.593483567f},
-std::array<float,2>{0.689717829f, 0.47188428f},
-std::array<float,2>{0.83523947f, 0.878641486f},
-std::array<float,2>{0.107829019f, 0.17470625f},
-std::array<float,2>{0.211000979f, 0.866190076f},
-std::array<float,2>{0.890417516f, 0.00833837595f},
-std::array<float,2>{0.572843075f, 0.629276097f},
-std::array<float,2>{0.335959375f, 0.277424783f},
-std::array<float,2>{0.181675479f, 0.560771346f},
-std::array<float,2>{0.98216939f, 0.427253991f},
-std::array<float,2>{0.507344365f, 0.989532351f},
-std::array<float,2>{0.268063605f, 0.241719142f},
-std::array<float,2>{0.458467275f, 0.763992488f},
-std::array<float,2>{0.666776657f, 0.113397285f},
-std::array<float,2>{0.795888841f, 0.74942565f},
-std::array<float,2>{0.0214096811f, 0.332653731f},
-std::array<float,2>{0.370087683f, 0.660092771f},
-std::array<float,2>{0.605432689f, 0.288872868f},
-std::array<float,2>{0.913666308f, 0.820251286f},
-std::array<float,2>{0.224352747f, 0.0582930595f},
-std::array<float,2>{0.0930283442f, 0.914383709f},
-std::array<float,2>{0.852945685f, 0.149585515f},
-std::array<float,2>{0.747916937f, 0.601827502f},
-std::array<float,2>{0.414596111f, 0.438293844f},
-std::array<float,2>{0.0967370346f, 0.508802295f},
-std::array<float,2>{0.840202391f, 0.376616955f},
-std::array<float,2>{0.698146999f, 0.951430261f},
-std::array<float,2>{0.398766458f, 0.199671209f},
-std::array<float,2>{0.329581708f, 0.794725239f},
-std::array<float,2>{0.565433979f, 0.0635340214f},
-std::array<float,2>{0.877809644f, 0.697684705f},
-std::array<float,2>{0.204865441f, 0.344012916f},
-std::array<float,2>{0.483227044f, 0.644270718f},
-std::array<float,2>{0.637080908f, 0.256365329f},
-std::array<float,2>{0.763598144f, 0.854529321f},
-std::array<float,2>{0.0549349897f, 0.0297884531f},
-std::array<float,2>{0.125894472f, 0.904892623f},
-std::array<float,2>{0.966144085f, 0.158835992f},
-std::array<float,2>{0.54599297f, 0.571142793f},
-std::array<float,2>{0.285845011f, 0.497233123f},
-std::array<float,2>{0.228875831f, 0.726940215f},
-std::array<float,2>{0.920998931f, 0.313440412f},
-std::array<float,2>{0.599455595f, 0.767992914f},
-std::array<float,2>{0.360018492f, 0.101197764f},
-std::array<float,2>{0.407157391f, 0.979492843f},
-std::array<float,2>{0.737048328f, 0.230639443f},
-std::array<float,2>{0.849693418f, 0.532569766f},
-std::array<float,2>{0.0847091079f, 0.408991814f},
-std::array<float,2>{0.279781848f, 0.624750853f},
-std::array<float,2>{0.511069417f, 0.456525952f},
-std::array<float,2>{0.972155333f, 0.921986103f},
-std::array<float,2>{0.176354513f, 0.136057317f},
-std::array<float,2>{0.0283826608f, 0.843186319f},
-std::array<float,2>{0.788391054f, 0.0459563322f},
-std::array<float,2>{0.658965409f, 0.68522644f},
-std::array<float,2>{0.466851532f, 0.302520722f},
-std::array<float,2>{0.0410954319f, 0.660257339f},
-std::array<float,2>{0.769862294f, 0.284823358f},
-std::array<float,2>{0.653204501f, 0.815827608f},
-std::array<float,2>{0.490257353f, 0.0620393679f},
-std::array<float,2>{0.309173226f, 0.918422103f},
-std::array<float,2>{0.554264009f, 0.156230688f},
-std::array<float,2>{0.940695345f, 0.607504904f},
-std::array<float,2>{0.142679244f, 0.444069535f},
-std::array<float,2>{0.387558579f, 0.557226062f},
-std::array<float,2>{0.714535654f, 0.423580348f},
-std::array<float,2>{0.814326584f, 0.984744847f},
-std::array<float,2>{0.123998187f, 0.238016874f},
-std::array<float,2>{0.201668933f, 0.761627793f},
-std::array<float,2>{0.893294454f, 0.112174623f},
-std::array<float,2>{0.591050804f, 0.745852709f},
-std::array<float,2>{0.318275213f, 0.330107957f},
-std::array<float,2>{0.168552727f, 0.589122713f},
-std::array<float,2>{0.998546481f, 0.4734267f},
-std::array<float,2>{0.517157495f, 0.879944026f},
-std::array<float,2>{0.258294106f, 0.17837742f},
-std::array<float,2>{0.448638797f, 0.863158762f},
-std::array<float,2>{0.676779687f, 0.0129323127f},
-std::array<float,2>{0.802354515f, 0.627918363f},
-std::array<float,2>{0.012658108f, 0.277130783f},
-std::array<float,2>{0.351208985f, 0.718595028f},
-std::array<float,2>{0.610792577f, 0.372078687f},
-std::array<float,2>{0.930868924f, 0.810143709f},
-std::array<float,2>{0.245716378f, 0.0887698233f},
-std::array<float,2>{0.0753962845f, 0.953220248f},
-std::array<float,2>{0.863711834f, 0.208614185f},
-std::array<float,2>{0.733596802f, 0.524692357f},
-std::array<float,2>{0.431845307f, 0.400387198f},
-std::array<float,2>{0.000524790143f, 0.594616234f},
-std::array<float,2>{0.808777273f, 0.452000409f},
-std::array<float,2>{0.684088588f, 0.907058477f},
-std::array<float,2>{0.445055485f, 0.143546924f},
-std::array<float,2>{0.255206674f, 0.823046088f},
-std::array<float,2>{0.530872285f, 0.0545491204f},
-std::array<float,2>{0.986640513f, 0.667094469f},
-std::array<float,2>{0.160957396f, 0.294806063f},
-std::array<float,2>{0.424328864f, 0.738986135f},
-std::array<float,2>{0.719503999f, 0.336806059f},
-std::array<float,2>{0.873816967f, 0.752101004f},
-std::array<float,2>{0.0688882098f, 0.118256927f},
-std::array<float,2>{0.236629218f, 0.997647464f},
-std::array<float,2>{0.922510326f, 0.246864274f},
-std::array<float,2>{0.619524419f, 0.553941011f},
-std::array<float,2>{0.359158933f, 0.436315238f},
-std::array<float,2>{0.155007467f, 0.63953352f},
-std::array<float,2>{0.952954829f, 0.267815143f},
-std::array<float,2>{0.557430863f, 0.871278167f},
-std::array<float,2>{0.303091645f, 0.00624092808f},
-std::array<float,2>{0.495637149f, 0.885156274f},
-std::array<float,2>{0.641907513f, 0.182960719f},
-std::array<float,2>{0.776126981f, 0.581826627f},
-std::array<float,2>{0.0339629166f, 0.482373029f},
-std::array<float,2>{0.327226818f, 0.518608332f},
-std::array<float,2>{0.578235328f, 0.394830674f},
-std::array<float,2>{0.906213105f, 0.964545131f},
-std::array<float,2>{0.18886283f, 0.21354638f},
-std::array<float,2>{0.112655617f, 0.80261755f},
-std::array<float,2>{0.824110746f, 0.0837347209f},
-std::array<float,2>{0.709090829f, 0.709734619f},
-std::array<float,2>{0.379737467f, 0.359683782f},
-std::array<float,2>{0.0885008797f, 0.688222229f},
-std::array<float,2>{0.855829477f, 0.35183093f},
-std::array<float,2>{0.745501816f, 0.786657453f},
-std::array<float,2>{0.419600427f, 0.0769853666f},
-std::array<float,2>{0.372420758f, 0.94461751f},
-std::array<float,2>{0.608558357f, 0.189103216f},
-std::array<float,2>{0.907279491f, 0.503568649f},
-std::array<float,2>{0.218954995f, 0.38523379f},
-std::array<float,2>{0.453828752f, 0.563571334f},
-std::array<float,2>{0.669931829f, 0.491145998f},
-std::array<float,2>{0.792503297f, 0.895810485f},
-std::array<float,2>{0.0173526853f, 0.170374215f},
-std::array<float,2>{0.185270801f, 0.844504952f},
-std::array<float,2>{0.977641463f, 0.0204394329f},
-std::array<float,2>{0.501748264f, 0.65107888f},
-std::array<float,2>{0.272766978f, 0.262306005f},
-std::array<float,2>{0.218207493f, 0.543748975f},
-std::array<float,2>{0.885791361f, 0.416281909f},
-std::array<float,2>{0.576014102f, 0.972110093f},
-std::array<float,2>{0.342533618f, 0.221399575f},
-std::array<float,2>{0.396302968f, 0.777824581f},
-std::array<float,2>{0.691584229f, 0.102687225f},
-std::array<float,2>{0.830171645f, 0.72217977f},
-std::array<float,2>{0.102791838f, 0.321173996f},
-std::array<float,2>{0.289509326f, 0.677547753f},
-std::array<float,2>{0.538800776f, 0.30828163f},
-std::array<float,2>{0.957550585f, 0.830933034f},
-std::array<float,2>{0.136857346f, 0.0378927551f},
-std::array<float,2>{0.0522812642f, 0.935673773f},
-std::array<float,2>{0.751080871f, 0.132053405f},
-std::array<float,2>{0.626289487f, 0.609447658f},
-std::array<float,2>{0.469418019f, 0.46224016f},
-std::array<float,2>{0.060494341f, 0.547574639f},
-std::array<float,2>{0.759609699f, 0.430412769f},
-std::array<float,2>{0.635050952f, 0.99505192f},
-std::array<float,2>{0.479315251f, 0.242424756f},
-std::array<float,2>{0.283078194f, 0.756080508f},
-std::array<float,2>{0.539378226f, 0.1229444f},
-std::array<float,2>{0.964227498f, 0.736000538f},
-std::array<float,2>{0.130077422f, 0.342690796f},
-std::array<float,2>{0.405241162f, 0.668930471f},
-std::array<float,2>{0.701409757f, 0.29245308f},
-std::array<float,2>{0.839317381f, 0.827279031f},
-std::array<float,2>{0.0992174f, 0.0486859083f},
-std::array<float,2>{0.208384335f, 0.910507023f},
-std::array<float,2>{0.88052541f, 0.146432996f},
-std::array<float,2>{0.567826509f, 0.598335028f},
-std::array<float,2>{0.333498836f, 0.448532939f},
-std::array<float,2>{0.173329741f, 0.704189897f},
-std::array<float,2>{0.975678623f, 0.366608411f},
-std::array<float,2>{0.513902903f, 0.800619483f},
-std::array<float,2>{0.275335282f, 0.0811725184f},
-std::array<float,2>{0.461242497f, 0.966762245f},
-std::array<float,2>{0.661185443f, 0.217707485f},
-std::array<float,2>{0.782599151f, 0.520307183f},
-std::array<float,2>{0.0235118028f, 0.391180903f},
-std::array<float,2>{0.365296721f, 0.583368182f},
-std::array<float,2>{0.596599221f, 0.476933092f},
-std::array<float,2>{0.916205525f, 0.889297485f},
-std::array<float,2>{0.231689572f, 0.184931532f},
-std::array<float,2>{0.0790783092f, 0.870325446f},
-std::array<float,2>{0.846004307f, 0.00384548353f},
-std::array<float,2>{0.739031732f, 0.635580242f},
-std::array<float,2>{0.410178512f, 0.272440344f},
-std::array<float,2>{0.119629525f, 0.653261542f},
-std::array<float,2>{0.819880843f, 0.261552453f},
-std::array<float,2>{0.717726648f, 0.848403633f},
-std::array<float,2>{0.385116339f, 0.0161124468f},
-std::array<float,2>{0.315786213f, 0.891528547f},
-std::array<float,2>{0.588517189f, 0.16575399f},
-std::array<float,2>{0.896921813f, 0.566892326f},
-std::array<float,2>{0.195346311f, 0.48506397f},
-std::array<float,2>{0.484901845f, 0.506715953f},
-std::array<float,2>{0.650723696f, 0.389107317f},
-std::array<float,2>{0.768171906f, 0.940356314f},
-std::array<float,2>{0.0449025147f, 0.192225993f},
-std::array<float,2>{0.147221059f, 0.783316433f},
-std::array<float,2>{0.943743348f, 0.0712402686f},
-std::array<float,2>{0.548624933f, 0.692681551f},
-std::array<float,2>{0.308173239f, 0.358260453f},
-std::array<float,2>{0.24729991f, 0.614421725f},
-std::array<float,2>{0.935773253f, 0.467567414f},
-std::array<float,2>{0.616019726f, 0.933561921f},
-std::array<float,2>{0.345576406f, 0.128209218f},
-std::array<float,2>{0.437033296f, 0.83265835f},
-std::array<float,2>{0.72878325f, 0.0343426391f},
-std::array<float,2>{0.859773278f, 0.674543858f},
-std::array<float,2>{0.0717241466f, 0.311584562f},
-std::array<float,2>{0.26320079f, 0.726409733f},
-std::array<float,2>{0.520831525f, 0.32751587f},
-std::array<float,2>{0.993132174f, 0.774538994f},
-std::array<float,2>{0.166970089f, 0.106769226f},
-std::array<float,2>{0.0113227209f, 0.974925578f},
-std::array<float,2>{0.797195375f, 0.223062575f},
-std::array<float,2>{0.674297273f, 0.540787816f},
-std::array<float,2>{0.451781094f, 0.421800673f},
-std::array<float,2>{0.0633805618f, 0.577739775f},
-std::array<float,2>{0.87001729f, 0.493501186f},
-std::array<float,2>{0.725259721f, 0.900332987f},
-std::array<float,2>{0.429266453f, 0.16069752f},
-std::array<float,2>{0.352111369f, 0.858150721f},
-std::array<float,2>{0.623085976f, 0.0253119878f},
-std::array<float,2>{0.929093659f, 0.644593f},
-std::array<float,2>{0.239876166f, 0.251987904f},
-std::array<float,2>{0.437605202f, 0.702844262f},
-std::array<float,2>{0.680310428f, 0.350969911f},
-std::array<float,2>{0.806284666f, 0.789278626f},
-std::array<float,2>{0.00766015286f, 0.067909658f},
-std::array<float,2>{0.15683639f, 0.947424531f},
-std::array<float,2>{0.992031157f, 0.198366374f},
-std::array<float,2>{0.526506066f, 0.512616754f},
-std::array<float,2>{0.253686696f, 0.382141739f},
-std::array<float,2>{0.19147867f, 0.682432413f},
-std::array<float,2>{0.90013057f, 0.298099697f},
-std::array<float,2>{0.583747029f, 0.836033285f},
-std::array<float,2>{0.321896493f, 0.0418465361f},
-std::array<float,2>{0.375624359f, 0.927096248f},
-std::array<float,2>{0.704433262f, 0.139766663f},
-std::array<float,2>{0.826196253f, 0.618680418f},
-std::array<float,2>{0.114130087f, 0.46076104f},
-std::array<float,2>{0.299966723f, 0.538643241f},
-std::array<float,2>{0.559987664f, 0.411005616f},
-std::array<float,2>{0.946671188f, 0.981143475f},
-std::array<float,2>{0.150369063f, 0.229008779f},
-std::array<float,2>{0.0365171321f, 0.77083683f},
-std::array<float,2>{0.77764827f, 0.0942561328f},
-std::array<float,2>{0.647302151f, 0.732724667f},
-std::array<float,2>{0.499091685f, 0.318055362f},
-std::array<float,2>{0.0220730491f, 0.747092843f},
-std::array<float,2>{0.793809235f, 0.334539294f},
-std::array<float,2>{0.665510595f, 0.763485849f},
-std::array<float,2>{0.45918119f, 0.117051445f},
-std::array<float,2>{0.266122758f, 0.99093312f},
-std::array<float,2>{0.503994823f, 0.238644138f},
-std::array<float,2>{0.983924568f, 0.559384763f},
-std::array<float,2>{0.180296049f, 0.428973496f},
-std::array<float,2>{0.417945027f, 0.604570746f},
-std::array<float,2>{0.748182714f, 0.440842777f},
-std::array<float,2>{0.855455101f, 0.916576803f},
-std::array<float,2>{0.0906686261f, 0.151852906f},
-std::array<float,2>{0.226305336f, 0.816576421f},
-std::array<float,2>{0.910261691f, 0.0551889315f},
-std::array<float,2>{0.602872968f, 0.658198833f},
-std::array<float,2>{0.367524892f, 0.285217315f},
-std::array<float,2>{0.1359763f, 0.529189885f},
-std::array<float,2>{0.954092264f, 0.402528912f},
-std::array<float,2>{0.534724414f, 0.959589124f},
-std::array<float,2>{0.294284403f, 0.205635101f},
-std::array<float,2>{0.473524868f, 0.805139661f},
-std::array<float,2>{0.631618202f, 0.0902554616f},
-std::array<float,2>{0.754802108f, 0.714518666f},
-std::array<float,2>{0.0477147847f, 0.368198544f},
-std::array<float,2>{0.3395814f, 0.631160736f},
-std::array<float,2>{0.572017431f, 0.280091196f},
-std::array<float,2>{0.886755049f, 0.8638044f},
-std::array<float,2>{0.213497564f, 0.0104830517f},
-std::array<float,2>{0.106356882f, 0.875908196f},
-std::array<float,2>{0.833130538f, 0.173812643f},
-std::array<float,2>{0.689090133f, 0.591598213f},
-std::array<float,2>{0.392332315f, 0.470152795f},
-std::array<float,2>{0.10310407f, 0.54687351f},
-std::array<float,2>{0.830969334f, 0.415922046f},
-std::array<float,2>{0.692324698f, 0.969685912f},
-std::array<float,2>{0.395612448f, 0.220110312f},
-std::array<float,2>{0.342056155f, 0.779373884f},
-std::array<float,2>{0.575661778f, 0.103642397f},
-std::array<float,2>{0.886419952f, 0.718805373f},
-std::array<float,2>{0.218661621f, 0.323453099f},
-std::array<float,2>{0.468797296f, 0.679252803f},
-std::array<float,2>{0.62687397f, 0.306384772f},
-std::array<float,2>{0.751692951f, 0.830036104f},
-std::array<float,2>{0.052131962f, 0.0364391617f},
-std::array<float,2>{0.137524515f, 0.933954597f},
-std::array<float,2>{0.957294762f, 0.129677743f},
-std::array<float,2>{0.538247824f, 0.611710131f},
-std::array<float,2>{0.289555252f, 0.463661313f},
-std::array<float,2>{0.219332725f, 0.690011084f},
-std::array<float,2>{0.908073127f, 0.353586853f},
-std::array<float,2>{0.609162092f, 0.78764385f},
-std::array<float,2>{0.372683048f, 0.0760337934f},
-std::array<float,2>{0.419417948f, 0.941781759f},
-std::array<float,2>{0.746079803f, 0.189812422f},
-std::array<float,2>{0.856206238f, 0.50188297f},
-std::array<float,2>{0.0882830769f, 0.384715617f},
-std::array<float,2>{0.273173004f, 0.565680325f},
-std::array<float,2>{0.501343429f, 0.488383263f},
-std::array<float,2>{0.978347778f, 0.897848845f},
-std::array<float,2>{0.184921756f, 0.169695765f},
-std::array<float,2>{0.0168885551f, 0.845839202f},
-std::array<float,2>{0.792404413f, 0.0216799136f},
-std::array<float,2>{0.670822084f, 0.649614036f},
-std::array<float,2>{0.453268379f, 0.264673471f},
-std::array<float,2>{0.0333900452f, 0.637951195f},
-std::array<float,2>{0.77587533f, 0.266765237f},
-std::array<float,2>{0.642415345f, 0.874964416f},
-std::array<float,2>{0.49557209f, 0.00433338713f},
-std::array<float,2>{0.303468317f, 0.884286165f},
-std::array<float,2>{0.556814194f, 0.17996341f},
-std::array<float,2>{0.95228231f, 0.578251421f},
-std::array<float,2>{0.154491678f, 0.483391345f},
-std::array<float,2>{0.37918964f, 0.517405033f},
-std::array<float,2>{0.70987308f, 0.398068517f},
-std::array<float,2>{0.823263884f, 0.962780297f},
-std::array<float,2>{0.112950787f, 0.212627679f},
-std::array<float,2>{0.189283505f, 0.803309202f},
-std::array<float,2>{0.90534687f, 0.0853944421f},
-std::array<float,2>{0.578753352f, 0.707521856f},
-std::array<float,2>{0.328113347f, 0.36326018f},
-std::array<float,2>{0.160505608f, 0.596213341f},
-std::array<float,2>{0.986857116f, 0.450451285f},
-std::array<float,2>{0.530664384f, 0.909233212f},
-std::array<float,2>{0.255428821f, 0.14144823f},
-std::array<float,2>{0.444414169f, 0.821574152f},
-std::array<float,2>{0.683754742f, 0.0511024445f},
-std::array<float,2>{0.809401691f, 0.665353656f},
-std::array<float,2>{0.000240404246f, 0.295868188f},
-std::array<float,2>{0.358792335f, 0.74098599f},
-std::array<float,2>{0.619965613f, 0.339252442f},
-std::array<float,2>{0.921953797f, 0.750238657f},
-std::array<float,2>{0.237262204f, 0.120965742f},
-std::array<float,2>{0.068390578f, 0.999859452f},
-std::array<float,2>{0.873209715f, 0.248590142f},
-std::array<float,2>{0.719098806f, 0.552693427f},
-std::array<float,2>{0.424058467f, 0.434677452f},
-std::array<float,2>{0.0118259918f, 0.586654484f},
-std::array<float,2>{0.802142918f, 0.475790769f},
-std::array<float,2>{0.677541852f, 0.882267892f},
-std::array<float,2>{0.448805511f, 0.17679958f},
-std::array<float,2>{0.258357912f, 0.859528899f},
-std::array<float,2>{0.516798437f, 0.0148524437f},
-std::array<float,2>{0.998296082f, 0.625075817f},
-std::array<float,2>{0.168165058f, 0.275344521f},
-std::array<float,2>{0.432243377f, 0.716375232f},
-std::array<float,2>{0.734155238f, 0.37491098f},
-std::array<float,2>{0.863875031f, 0.812463701f},
-std::array<float,2>{0.0758955702f, 0.0875063762f},
-std::array<float,2>{0.245568663f, 0.956632018f},
-std::array<float,2>{0.931267798f, 0.209097251f},
-std::array<float,2>{0.611147463f, 0.525861442f},
-std::array<float,2>{0.350590646f, 0.401489437f},
-std::array<float,2>{0.143307433f, 0.663657248f},
-std::array<float,2>{0.94105798f, 0.282072157f},
-std::array<float,2>{0.55380559f, 0.813415825f},
-std::array<float,2>{0.309058875f, 0.0591339245f},
-std::array<float,2>{0.490914702f, 0.920671642f},
-std::array<float,2>{0.652611434f, 0.152931124f},
-std::array<float,2>{0.770496309f, 0.607190251f},
-std::array<float,2>{0.0415607244f, 0.442290872f},
-std::array<float,2>{0.317460507f, 0.555817842f},
-std::array<float,2>{0.591711581f, 0.424961209f},
-std::array<float,2>{0.892870724f, 0.986663997f},
-std::array<float,2>{0.201311544f, 0.235601306f},
-std::array<float,2>{0.123200044f, 0.758860052f},
-std::array<float,2>{0.8137483f, 0.109872699f},
-std::array<float,2>{0.71432507f, 0.74381882f},
-std::array<float,2>{0.386892825f, 0.32862252f},
-std::array<float,2>{0.0840816498f, 0.729054034f},
-std::array<float,2>{0.850154877f, 0.31633386f},
-std::array<float,2>{0.736466229f, 0.766389191f},
-std::array<float,2>{0.406553954f, 0.0978641734f},
-std::array<float,2>{0.359859586f, 0.97664845f},
-std::array<float,2>{0.598819792f, 0.233753771f},
-std::array<float,2>{0.921542645f, 0.535095692f},
-std::array<float,2>{0.22942321f, 0.407632202f},
-std::array<float,2>{0.467431128f, 0.621476829f},
-std::array<float,2>{0.65846616f, 0.455049157f},
-std::array<float,2>{0.789043605f, 0.924591005f},
-std::array<float,2>{0.029213598f, 0.134050965f},
-std::array<float,2>{0.176243484f, 0.839912951f},
-std::array<float,2>{0.972499073f, 0.0444651358f},
-std::array<float,2>{0.511556089f, 0.686839342f},
-std::array<float,2>{0.280074149f, 0.303260148f},
-std::array<float,2>{0.204558775f, 0.511389971f},
-std::array<float,2>{0.877318501f, 0.377043784f},
-std::array<float,2>{0.566200733f, 0.950398564f},
-std::array<float,2>{0.329657853f, 0.201220915f},
-std::array<float,2>{0.398958445f, 0.795451641f},
-std::array<float,2>{0.697391152f, 0.06526573f},
-std::array<float,2>{0.840461493f, 0.696033239f},
-std::array<float,2>{0.0973971486f, 0.346365631f},
-std::array<float,2>{0.285199791f, 0.640738189f},
-std::array<float,2>{0.546764553f, 0.255588323f},
-std::array<float,2>{0.966465831f, 0.852601826f},
-std::array<float,2>{0.125286222f, 0.0283780992f},
-std::array<float,2>{0.0554840825f, 0.902672708f},
-std::array<float,2>{0.762749076f, 0.156501517f},
-std::array<float,2>{0.637573361f, 0.573357522f},
-std::array<float,2>{0.482459217f, 0.499518037f},
-std::array<float,2>{0.0472926572f, 0.529997826f},
-std::array<float,2>{0.754343569f, 0.404462487f},
-std::array<float,2>{0.631260157f, 0.958495378f},
-std::array<float,2>{0.472723931f, 0.204623967f},
-std::array<float,2>{0.29463318f, 0.807963014f},
-std::array<float,2>{0.534550309f, 0.0936794803f},
-std::array<float,2>{0.953227937f, 0.711130798f},
-std::array<float,2>{0.136480555f, 0.369177043f},
-std::array<float,2>{0.392083198f, 0.629615903f},
-std::array<float,2>{0.688725889f, 0.278015018f},
-std::array<float,2>{0.833876014f, 0.865602374f},
-std::array<float,2>{0.105940625f, 0.00827147439f},
-std::array<float,2>{0.21302475f, 0.878016949f},
-std::array<float,2>{0.8873353f, 0.174201742f},
-std::array<float,2>{0.571692169f, 0.593044043f},
-std::array<float,2>{0.339176297f, 0.472367674f},
-std::array<float,2>{0.179999903f, 0.749521911f},
-std::array<float,2>{0.983670175f, 0.332163274f},
-std::array<float,2>{0.504480243f, 0.764301062f},
-std::array<float,2>{0.265897989f, 0.114164017f},
-std::array<float,2>{0.459702551f, 0.990099788f},
-std::array<float,2>{0.665668607f, 0.241632536f},
-std::array<float,2>{0.793215156f, 0.561366022f},
-std::array<float,2>{0.0215764437f, 0.4267838f},
-std::array<float,2>{0.36780411f, 0.602505982f},
-std::array<float,2>{0.603423238f, 0.437795848f},
-std::array<float,2>{0.9110322f, 0.914580882f},
-std::array<float,2>{0.225874767f, 0.150121972f},
-std::array<float,2>{0.0899199098f, 0.819705725f},
-std::array<float,2>{0.85465169f, 0.0576594882f},
-std::array<float,2>{0.748892665f, 0.659180641f},
-std::array<float,2>{0.417160749f, 0.288462222f},
-std::array<float,2>{0.113590106f, 0.680533409f},
-std::array<float,2>{0.827038348f, 0.299591869f},
-std::array<float,2>{0.704871953f, 0.838398755f},
-std::array<float,2>{0.375447273f, 0.0402157567f},
-std::array<float,2>{0.321611911f, 0.928252935f},
-std::array<float,2>{0.583206236f, 0.138625115f},
-std::array<float,2>{0.899754763f, 0.619917452f},
-std::array<float,2>{0.191993162f, 0.45822221f},
-std::array<float,2>{0.499537826f, 0.536194265f},
-std::array<float,2>{0.646810889f, 0.413886219f},
-std::array<float,2>{0.778074145f, 0.983030438f},
-std::array<float,2>{0.036734838f, 0.227262095f},
-std::array<float,2>{0.14946869f, 0.772065043f},
-std::array<float,2>{0.947247326f, 0.0969108045f},
-std::array<float,2>{0.560311794f, 0.731088459f},
-std::array<float,2>{0.300694138f, 0.319227099f},
-std::array<float,2>{0.239457503f, 0.574265242f},
-std::array<float,2>{0.929294407f, 0.495640367f},
-std::array<float,2>{0.623737752f, 0.90154624f},
-std::array<float,2>{0.35204497f, 0.162690803f},
-std::array<float,2>{0.428762585f, 0.855672121f},
-std::array<float,2>{0.724985003f, 0.0270805247f},
-std::array<float,2>{0.869387567f, 0.647381783f},
-std::array<float,2>{0.0628577843f, 0.250991076f},
-std::array<float,2>{0.253277689f, 0.700428367f},
-std::array<float,2>{0.527329266f, 0.349197298f},
-std::array<float,2>{0.991686642f, 0.791465998f},
-std::array<float,2>{0.156563371f, 0.0691859946f},
-std::array<float,2>{0.00719477003f, 0.947129428f},
-std::array<float,2>{0.805676997f, 0.196176156f},
-std::array<float,2>{0.679992378f, 0.514510453f},
-std::array<float,2>{0.438081741f, 0.379549444f},
-std::array<float,2>{0.0721662045f, 0.615406454f},
-std::array<float,2>{0.860050619f, 0.465009362f},
-std::array<float,2>{0.729135752f, 0.93116951f},
-std::array<float,2>{0.4365426f, 0.126244381f},
-std::array<float,2>{0.344834805f, 0.834243119f},
-std::array<float,2>{0.615717888f, 0.0321350209f},
-std::array<float,2>{0.936332583f, 0.672849536f},
-std::array<float,2>{0.24794057f, 0.310482144f},
-std::array<float,2>{0.451456696f, 0.724231839f},
-std::array<float,2>{0.674792111f, 0.326016456f},
-std::array<float,2>{0.797398686f, 0.776899934f},
-std::array<float,2>{0.0108571108f, 0.10861551f},
-std::array<float,2>{0.166262254f, 0.972665191f},
-std::array<float,2>{0.992476344f, 0.224878252f},
-std::array<float,2>{0.521379113f, 0.542809427f},
-std::array<float,2>{0.263027817f, 0.418708056f},
-std::array<float,2>{0.195928976f, 0.655596316f},
-std::array<float,2>{0.897315025f, 0.258106679f},
-std::array<float,2>{0.587903917f, 0.851309419f},
-std::array<float,2>{0.316285223f, 0.0179076195f},
-std::array<float,2>{0.38529855f, 0.894486129f},
-std::array<float,2>{0.717190325f, 0.166975081f},
-std::array<float,2>{0.81966567f, 0.569386721f},
-std::array<float,2>{0.119204767f, 0.488005757f},
-std::array<float,2>{0.307736009f, 0.504112124f},
-std::array<float,2>{0.547931552f, 0.388480425f},
-std::array<float,2>{0.944148302f, 0.938125312f},
-std::array<float,2>{0.146662161f, 0.193551958f},
-std::array<float,2>{0.0440502651f, 0.782631814f},
-std::array<float,2>{0.767917275f, 0.0726054981f},
-std::array<float,2>{0.651363909f, 0.694416046f},
-std::array<float,2>{0.484538317f, 0.357355505f},
-std::array<float,2>{0.0242241342f, 0.706635892f},
-std::array<float,2>{0.783082008f, 0.363305777f},
-std::array<float,2>{0.661701977f, 0.796986878f},
-std::array<float,2>{0.461723149f, 0.0798413604f},
-std::array<float,2>{0.274755359f, 0.967046559f},
-std::array<float,2>{0.514448225f, 0.215678513f},
-std::array<float,2>{0.976313949f, 0.522297025f},
-std::array<float,2>{0.173755378f, 0.393790483f},
-std::array<float,2>{0.410746217f, 0.585148275f},
-std::array<float,2>{0.738573551f, 0.480024964f},
-std::array<float,2>{0.846328139f, 0.887068152f},
-std::array<float,2>{0.0781586245f, 0.185638502f},
-std::array<float,2>{0.232282817f, 0.868366778f},
-std::array<float,2>{0.916610062f, 0.00181715854f},
-std::array<float,2>{0.595798016f, 0.634495735f},
-std::array<float,2>{0.366039544f, 0.270034134f},
-std::array<float,2>{0.130731001f, 0.549777091f},
-std::array<float,2>{0.964759707f, 0.433465093f},
-std::array<float,2>{0.539625049f, 0.99261266f},
-std::array<float,2>{0.282529384f, 0.245532215f},
-std::array<float,2>{0.478982419f, 0.754555285f},
-std::array<float,2>{0.635550618f, 0.124535426f},
-std::array<float,2>{0.758993328f, 0.737044454f},
-std::array<float,2>{0.059811689f, 0.341734529f},
-std::array<float,2>{0.333443075f, 0.670018494f},
-std::array<float,2>{0.568032861f, 0.289123625f},
-std::array<float,2>{0.879959226f, 0.824480534f},
-std::array<float,2>{0.208719745f, 0.0501343384f},
-std::array<float,2>{0.0989836529f, 0.912980497f},
-std::array<float,2>{0.839384556f, 0.146664515f},
-std::array<float,2>{0.701834917f, 0.600083947f},
-std::array<float,2>{0.404400557f, 0.445441842f},
-std::array<float,2>{0.0867097601f, 0.503226101f},
-std::array<float,2>{0.859180272f, 0.385282755f},
-std::array<float,2>{0.743560255f, 0.944844723f},
-std::array<float,2>{0.420367211f, 0.188748524f},
-std::array<float,2>{0.374458253f, 0.7864272f},
-std::array<float,2>{0.605876386f, 0.0765013099f},
-std::array<float,2>{0.909580171f, 0.687930584f},
-std::array<float,2>{0.221308306f, 0.352489799f},
-std::array<float,2>{0.455468208f, 0.650779903f},
-std::array<float,2>{0.66802001f, 0.261851698f},
-std::array<float,2>{0.7893399f, 0.843905628f},
-std::array<float,2>{0.0194991156f, 0.0197969712f},
-std::array<float,2>{0.185657769f, 0.896044493f},
-std::array<float,2>{0.979058087f, 0.170868546f},
-std::array<float,2>{0.503639817f, 0.564305127f},
-std::array<float,2>{0.271223366f, 0.490705639f},
-std::array<float,2>{0.216380656f, 0.721823037f},
-std::array<float,2>{0.883219242f, 0.320382267f},
-std::array<float,2>{0.57688576f, 0.778312445f},
-std::array<float,2>{0.340242088f, 0.103107482f},
-std::array<float,2>{0.397682637f, 0.972346365f},
-std::array<float,2>{0.695220709f, 0.221119076f},
-std::array<float,2>{0.829162836f, 0.54297179f},
-std::array<float,2>{0.103657939f, 0.416637063f},
-std::array<float,2>{0.292200327f, 0.609895766f},
-std::array<float,2>{0.536070347f, 0.462613016f},
-std::array<float,2>{0.960663676f, 0.936219156f},
-std::array<float,2>{0.138787329f, 0.132457405f},
-std::array<float,2>{0.0528535582f, 0.830314696f},
-std::array<float,2>{0.753050089f, 0.0371361971f},
-std::array<float,2>{0.628081262f, 0.676949143f},
-std::array<float,2>{0.471347839f, 0.307830542f},
-std::array<float,2>{0.00236520031f, 0.667591631f},
-std::array<float,2>{0.811482191f, 0.294006824f},
-std::array<float,2>{0.686802864f, 0.822321475f},
-std::array<float,2>{0.441780746f, 0.0537562668f},
-std::array<float,2>{0.256341785f, 0.906307101f},
-std::array<float,2>{0.528362811f, 0.142631277f},
-std::array<float,2>{0.985083222f, 0.593842447f},
-std::array<float,2>{0.163359836f, 0.451478601f},
-std::array<float,2>{0.422064811f, 0.554201782f},
-std::array<float,2>{0.722180724f, 0.435651392f},
-std::array<float,2>{0.872170329f, 0.997077346f},
-std::array<float,2>{0.0671259761f, 0.246336669f},
-std::array<float,2>{0.235870957f, 0.752850294f},
-std::array<float,2>{0.924419165f, 0.118824437f},
-std::array<float,2>{0.618712366f, 0.7387532f},
-std::array<float,2>{0.356906176f, 0.336057961f},
-std::array<float,2>{0.152354941f, 0.581424773f},
-std::array<float,2>{0.949348927f, 0.481809884f},
-std::array<float,2>{0.555881143f, 0.885317862f},
-std::array<float,2>{0.300978154f, 0.183354974f},
-std::array<float,2>{0.492601097f, 0.871920347f},
-std::array<float,2>{0.643669248f, 0.00635763071f},
-std::array<float,2>{0.774558783f, 0.638685524f},
-std::array<float,2>{0.0318223462f, 0.268377185f},
-std::array<float,2>{0.325969696f, 0.709413111f},
-std::array<float,2>{0.581675291f, 0.360237658f},
-std::array<float,2>{0.902455986f, 0.802194953f},
-std::array<float,2>{0.190595433f, 0.0833049864f},
-std::array<float,2>{0.11045856f, 0.964309931f},
-std::array<float,2>{0.821387112f, 0.213131353f},
-std::array<float,2>{0.707822621f, 0.519522667f},
-std::array<float,2>{0.381739408f, 0.395263523f},
-std::array<float,2>{0.0405254215f, 0.608048081f},
-std::array<float,2>{0.771957517f, 0.443665892f},
-std::array<float,2>{0.655578375f, 0.918777049f},
-std::array<float,2>{0.488314062f, 0.155387044f},
-std::array<float,2>{0.310830534f, 0.816384315f},
-std::array<float,2>{0.552200973f, 0.0618733652f},
-std::array<float,2>{0.938666046f, 0.660899103f},
-std::array<float,2>{0.14072448f, 0.284507126f},
-std::array<float,2>{0.389038175f, 0.74545306f},
-std::array<float,2>{0.711600721f, 0.330980152f},
-std::array<float,2>{0.81476903f, 0.761181176f},
-std::array<float,2>{0.12207821f, 0.111628473f},
-std::array<float,2>{0.199268803f, 0.985027611f},
-std::array<float,2>{0.89064908f, 0.237686202f},
-std::array<float,2>{0.59335357f, 0.556729734f},
-std::array<float,2>{0.319880724f, 0.423219562f},
-std::array<float,2>{0.170471877f, 0.627162993f},
-std::array<float,2>{0.997151077f, 0.276411653f},
-std::array<float,2>{0.517904758f, 0.862500787f},
-std::array<float,2>{0.2603755f, 0.0136335185f},
-std::array<float,2>{0.446884394f, 0.880627275f},
-std::array<float,2>{0.677990615f, 0.178134575f},
-std::array<float,2>{0.803314447f, 0.589802504f},
-std::array<float,2>{0.0150649613f, 0.472850055f},
-std::array<float,2>{0.348703116f, 0.525138617f},
-std::array<float,2>{0.611722946f, 0.399553329f},
-std::array<float,2>{0.933011055f, 0.953746617f},
-std::array<float,2>{0.242482409f, 0.208488569f},
-std::array<float,2>{0.0768395811f, 0.809779167f},
-std::array<float,2>{0.866741419f, 0.0879474506f},
-std::array<float,2>{0.732251108f, 0.718023837f},
-std::array<float,2>{0.430696815f, 0.3726888f},
-std::array<float,2>{0.0947274715f, 0.697996318f},
-std::array<float,2>{0.842229068f, 0.344291747f},
-std::array<float,2>{0.696422815f, 0.794158578f},
-std::array<float,2>{0.401643246f, 0.0641671866f},
-std::array<float,2>{0.331445873f, 0.951997042f},
-std::array<float,2>{0.56391722f, 0.199760303f},
-std::array<float,2>{0.875138879f, 0.509516299f},
-std::array<float,2>{0.206876785f, 0.376331568f},
-std::array<float,2>{0.480818689f, 0.570376337f},
-std::array<float,2>{0.640422165f, 0.497932762f},
-std::array<float,2>{0.763906121f, 0.904613853f},
-std::array<float,2>{0.0568441637f, 0.158575147f},
-std::array<float,2>{0.127657712f, 0.855216563f},
-std::array<float,2>{0.966991186f, 0.0297030304f},
-std::array<float,2>{0.544741869f, 0.643609583f},
-std::array<float,2>{0.288824499f, 0.255905092f},
-std::array<float,2>{0.227136314f, 0.533115089f},
-std::array<float,2>{0.918108284f, 0.40834257f},
-std::array<float,2>{0.59971112f, 0.980184615f},
-std::array<float,2>{0.362168372f, 0.231304362f},
-std::array<float,2>{0.408810347f, 0.768511295f},
-std::array<float,2>{0.736013234f, 0.100950338f},
-std::array<float,2>{0.848146617f, 0.727114677f},
-std::array<float,2>{0.0828591511f, 0.312706083f},
-std::array<float,2>{0.277677834f, 0.685021341f},
-std::array<float,2>{0.508980393f, 0.302142203f},
-std::array<float,2>{0.968891203f, 0.843723059f},
-std::array<float,2>{0.179276481f, 0.0466073453f},
-std::array<float,2>{0.0303647853f, 0.922692657f},
-std::array<float,2>{0.785624921f, 0.136557013f},
-std::array<float,2>{0.656838357f, 0.62437588f},
-std::array<float,2>{0.466629952f, 0.456972718f},
-std::array<float,2>{0.0208166745f, 0.558989108f},
-std::array<float,2>{0.795311391f, 0.429517657f},
-std::array<float,2>{0.666454971f, 0.990663707f},
-std::array<float,2>{0.458738476f, 0.238770217f},
-std::array<float,2>{0.268226206f, 0.76273042f},
-std::array<float,2>{0.507176995f, 0.116593629f},
-std::array<float,2>{0.981565952f, 0.747695804f},
-std::array<float,2>{0.182150409f, 0.334397793f},
-std::array<float,2>{0.414371431f, 0.657545328f},
-std::array<float,2>{0.747500002f, 0.286040127f},
-std::array<float,2>{0.853267252f, 0.817183197f},
-std::array<float,2>{0.0935000852f, 0.0548591502f},
-std::array<float,2>{0.223693222f, 0.916194558f},
-std::array<float,2>{0.913120687f, 0.151886553f},
-std::array<float,2>{0.604611874f, 0.605310678f},
-std::array<float,2>{0.369376481f, 0.441246688f},
-std::array<float,2>{0.134180278f, 0.714278162f},
-std::array<float,2>{0.955111325f, 0.368702561f},
-std::array<float,2>{0.53272754f, 0.805352271f},
-std::array<float,2>{0.295259088f, 0.0906236097f},
-std::array<float,2>{0.47505039f, 0.959378839f},
-std::array<float,2>{0.629706919f, 0.205123082f},
-std::array<float,2>{0.756140351f, 0.52843833f},
-std::array<float,2>{0.0507356897f, 0.403080881f},
-std::array<float,2>{0.33651489f, 0.590903461f},
-std::array<float,2>{0.572499394f, 0.470310062f},
-std::array<float,2>{0.89007467f, 0.875142872f},
-std::array<float,2>{0.211670488f, 0.173021927f},
-std::array<float,2>{0.108277328f, 0.863355756f},
-std::array<float,2>{0.83570087f, 0.0099645732f},
-std::array<float,2>{0.69029218f, 0.631541491f},
-std::array<float,2>{0.394506723f, 0.27934289f},
-std::array<float,2>{0.0655808598f, 0.645142317f},
-std::array<float,2>{0.867744863f, 0.252710223f},
-std::array<float,2>{0.723787963f, 0.857608855f},
-std::array<float,2>{0.427158386f, 0.0246354397f},
-std::array<float,2>{0.353966862f, 0.899622738f},
-std::array<float,2>{0.62282604f, 0.160571501f},
-std::array<float,2>{0.927172422f, 0.577200115f},
-std::array<float,2>{0.242036998f, 0.493706405f},
-std::array<float,2>{0.439959466f, 0.511853099f},
-std::array<float,2>{0.681947112f, 0.382436484f},
-std::array<float,2>{0.806945503f, 0.947909653f},
-std::array<float,2>{0.0047939606f, 0.198840916f},
-std::array<float,2>{0.159256071f, 0.790011883f},
-std::array<float,2>{0.988812029f, 0.0676976591f},
-std::array<float,2>{0.524506927f, 0.702259779f},
-std::array<float,2>{0.250162244f, 0.351501286f},
-std::array<float,2>{0.195294708f, 0.618536234f},
-std::array<float,2>{0.902337253f, 0.460280001f},
-std::array<float,2>{0.585066438f, 0.927394032f},
-std::array<float,2>{0.322307259f, 0.140398964f},
-std::array<float,2>{0.37860921f, 0.836898029f},
-std::array<float,2>{0.705793917f, 0.0414924398f},
-std::array<float,2>{0.824679315f, 0.681732476f},
-std::array<float,2>{0.116239414f, 0.298497528f},
-std::array<float,2>{0.297423393f, 0.732971251f},
-std::array<float,2>{0.56116426f, 0.317670673f},
-std::array<float,2>{0.949172139f, 0.771484017f},
-std::array<float,2>{0.150758579f, 0.0941466838f},
-std::array<float,2>{0.0373378918f, 0.980639517f},
-std::array<float,2>{0.780014992f, 0.228971615f},
-std::array<float,2>{0.6453619f, 0.538547575f},
-std::array<float,2>{0.496829838f, 0.410262674f},
-std::array<float,2>{0.11829862f, 0.567076862f},
-std::array<float,2>{0.818303943f, 0.484390378f},
-std::array<float,2>{0.715995789f, 0.890820265f},
-std::array<float,2>{0.384539992f, 0.165409908f},
-std::array<float,2>{0.31314829f, 0.847735107f},
-std::array<float,2>{0.586342096f, 0.0164468884f},
-std::array<float,2>{0.896025479f, 0.652630746f},
-std::array<float,2>{0.198371619f, 0.261117756f},
-std::array<float,2>{0.487285018f, 0.693284869f},
-std::array<float,2>{0.649010599f, 0.357600451f},
-std::array<float,2>{0.7667557f, 0.783874571f},
-std::array<float,2>{0.0465927906f, 0.0705126002f},
-std::array<float,2>{0.145853654f, 0.93964982f},
-std::array<float,2>{0.942128062f, 0.191764772f},
-std::array<float,2>{0.54921174f, 0.506283879f},
-std::array<float,2>{0.306251407f, 0.38931787f},
-std::array<float,2>{0.24957186f, 0.67392832f},
-std::array<float,2>{0.93525809f, 0.312229991f},
-std::array<float,2>{0.614555895f, 0.832329273f},
-std::array<float,2>{0.34648335f, 0.0350122824f},
-std::array<float,2>{0.434576809f, 0.932819784f},
-std::array<float,2>{0.726612389f, 0.128702059f},
-std::array<float,2>{0.861627042f, 0.614954054f},
-std::array<float,2>{0.0739287734f, 0.467224509f},
-std::array<float,2>{0.265356183f, 0.540525019f},
-std::array<float,2>{0.521790385f, 0.420913666f},
-std::array<float,2>{0.994392216f, 0.975277901f},
-std::array<float,2>{0.164367214f, 0.223372802f},
-std::array<float,2>{0.00827819202f, 0.775243461f},
-std::array<float,2>{0.80071491f, 0.107262053f},
-std::array<float,2>{0.672328234f, 0.725833774f},
-std::array<float,2>{0.449767828f, 0.327880412f},
-std::array<float,2>{0.0615426823f, 0.735809922f},
-std::array<float,2>{0.760408342f, 0.341923416f},
-std::array<float,2>{0.633058786f, 0.756608784f},
-std::array<float,2>{0.476579964f, 0.122230805f},
-std::array<float,2>{0.284587651f, 0.994141698f},
-std::array<float,2>{0.541548133f, 0.24273394f},
-std::array<float,2>{0.962091148f, 0.547290146f},
-std::array<float,2>{0.131593391f, 0.429758728f},
-std::array<float,2>{0.402406871f, 0.597934067f},
-std::array<float,2>{0.701030076f, 0.448771119f},
-std::array<float,2>{0.837299168f, 0.910854399f},
-std::array<float,2>{0.0996527821f, 0.145852014f},
-std::array<float,2>{0.209000692f, 0.827776849f},
-std::array<float,2>{0.882571578f, 0.0480334386f},
-std::array<float,2>{0.569969475f, 0.668227673f},
-std::array<float,2>{0.335877359f, 0.292530239f},
-std::array<float,2>{0.175745606f, 0.519932091f},
-std::array<float,2>{0.974304616f, 0.390723109f},
-std::array<float,2>{0.512964666f, 0.966047287f},
-std::array<float,2>{0.277188361f, 0.217004284f},
-std::array<float,2>{0.462946087f, 0.800139606f},
-std::array<float,2>{0.662774861f, 0.0819373429f},
-std::array<float,2>{0.784138381f, 0.704639792f},
-std::array<float,2>{0.0256497338f, 0.366967648f},
-std::array<float,2>{0.364122003f, 0.635008693f},
-std::array<float,2>{0.59548825f, 0.271745056f},
-std::array<float,2>{0.915980339f, 0.871089399f},
-std::array<float,2>{0.234151959f, 0.00297116837f},
-std::array<float,2>{0.0816278979f, 0.888943136f},
-std::array<float,2>{0.844911754f, 0.185131401f},
-std::array<float,2>{0.741273463f, 0.583808005f},
-std::array<float,2>{0.41347298f, 0.477115601f},
-std::array<float,2>{0.0681847632f, 0.551206708f},
-std::array<float,2>{0.8711133f, 0.43416968f},
-std::array<float,2>{0.721425533f, 0.998428166f},
-std::array<float,2>{0.423215538f, 0.24995473f},
-std::array<float,2>{0.356337696f, 0.751796126f},
-std::array<float,2>{0.617471993f, 0.119916469f},
-std::array<float,2>{0.925295234f, 0.74153775f},
-std::array<float,2>{0.234875023f, 0.338030934f},
-std::array<float,2>{0.442788213f, 0.66433239f},
-std::array<float,2>{0.686268568f, 0.295930862f},
-std::array<float,2>{0.812308669f, 0.82054162f},
-std::array<float,2>{0.00309889135f, 0.0523350537f},
-std::array<float,2>{0.16272828f, 0.908309519f},
-std::array<float,2>{0.986230731f, 0.141796798f},
-std::array<float,2>{0.527633429f, 0.596763968f},
-std::array<float,2>{0.257659972f, 0.449335456f},
-std::array<float,2>{0.189831302f, 0.708524823f},
-std::array<float,2>{0.9035725f, 0.362296581f},
-std::array<float,2>{0.580669105f, 0.803919673f},
-std::array<float,2>{0.325061351f, 0.084273681f},
-std::array<float,2>{0.382071018f, 0.961908519f},
-std::array<float,2>{0.708599448f, 0.211178035f},
-std::array<float,2>{0.820517361f, 0.515854836f},
-std::array<float,2>{0.110092312f, 0.396977603f},
-std::array<float,2>{0.302643776f, 0.579598367f},
-std::array<float,2>{0.555633128f, 0.483822942f},
-std::array<float,2>{0.950782657f, 0.883332431f},
-std::array<float,2>{0.153614715f, 0.181617364f},
-std::array<float,2>{0.0331913605f, 0.873538971f},
-std::array<float,2>{0.773703635f, 0.00509527745f},
-std::array<float,2>{0.643347621f, 0.637041867f},
-std::array<float,2>{0.493854314f, 0.265805691f},
-std::array<float,2>{0.0176096614f, 0.648954332f},
-std::array<float,2>{0.790954769f, 0.264190704f},
-std::array<float,2>{0.669781327f, 0.846771121f},
-std::array<float,2>{0.456837952f, 0.022883065f},
-std::array<float,2>{0.270447969f, 0.897119462f},
-std::array<float,2>{0.502610385f, 0.168060213f},
-std::array<float,2>{0.979860663f, 0.565287828f},
-std::array<float,2>{0.187140435f, 0.490127236f},
-std::array<float,2>{0.421782345f, 0.500260234f},
-std::array<float,2>{0.742826164f, 0.38329941f},
-std::array<float,2>{0.857597768f, 0.943206191f},
-std::array<float,2>{0.0872245207f, 0.190708548f},
-std::array<float,2>{0.222557262f, 0.788999736f},
-std::array<float,2>{0.909178019f, 0.0748446956f},
-std::array<float,2>{0.606769323f, 0.691356301f},
-std::array<float,2>{0.374008328f, 0.354501814f},
-std::array<float,2>{0.140520558f, 0.613267064f},
-std::array<float,2>{0.959562004f, 0.464693964f},
-std::array<float,2>{0.537002385f, 0.934863687f},
-std::array<float,2>{0.291905403f, 0.130712643f},
-std::array<float,2>{0.472494721f, 0.82849282f},
-std::array<float,2>{0.62781924f, 0.035981752f},
-std::array<float,2>{0.75238353f, 0.67788136f},
-std::array<float,2>{0.0544472747f, 0.305593878f},
-std::array<float,2>{0.341746628f, 0.720569193f},
-std::array<float,2>{0.577663243f, 0.322324425f},
-std::array<float,2>{0.8840276f, 0.780799448f},
-std::array<float,2>{0.215068534f, 0.104691193f},
-std::array<float,2>{0.105310045f, 0.970114589f},
-std::array<float,2>{0.82888031f, 0.218763858f},
-std::array<float,2>{0.694154382f, 0.545662284f},
-std::array<float,2>{0.396703362f, 0.414551079f},
-std::array<float,2>{0.0577981472f, 0.573172152f},
-std::array<float,2>{0.765155137f, 0.498145372f},
-std::array<float,2>{0.638771474f, 0.904073417f},
-std::array<float,2>{0.481713623f, 0.157501787f},
-std::array<float,2>{0.28730163f, 0.851999521f},
-std::array<float,2>{0.543232203f, 0.0274042841f},
-std::array<float,2>{0.96862191f, 0.64234519f},
-std::array<float,2>{0.128575772f, 0.254313052f},
-std::array<float,2>{0.400731444f, 0.696912706f},
-std::array<float,2>{0.695443213f, 0.347118318f},
-std::array<float,2>{0.842967153f, 0.796327412f},
-std::array<float,2>{0.0942972377f, 0.0660228282f},
-std::array<float,2>{0.205419049f, 0.949249208f},
-std::array<float,2>{0.876147389f, 0.202946812f},
-std::array<float,2>{0.563308299f, 0.510213315f},
-std::array<float,2>{0.330264509f, 0.378704786f},
-std::array<float,2>{0.17864792f, 0.685771763f},
-std::array<float,2>{0.970376015f, 0.303747654f},
-std::array<float,2>{0.507838607f, 0.841417909f},
-std::array<float,2>{0.279260218f, 0.0438004732f},
-std::array<float,2>{0.464997083f, 0.925723314f},
-std::array<float,2>{0.657705009f, 0.133194074f},
-std::array<float,2>{0.786387742f, 0.622385323f},
-std::array<float,2>{0.0299549047f, 0.453774333f},
-std::array<float,2>{0.362812728f, 0.534115732f},
-std::array<float,2>{0.601325572f, 0.40668878f},
-std::array<float,2>{0.91970098f, 0.978055894f},
-std::array<float,2>{0.228131652f, 0.232909545f},
-std::array<float,2>{0.0837473273f, 0.767180026f},
-std::array<float,2>{0.849297166f, 0.0986862257f},
-std::array<float,2>{0.735093117f, 0.729723692f},
-std::array<float,2>{0.409816027f, 0.31533131f},
-std::array<float,2>{0.121842124f, 0.742933035f},
-std::array<float,2>{0.816215158f, 0.329239011f},
-std::array<float,2>{0.712866843f, 0.758340001f},
-std::array<float,2>{0.389671683f, 0.110758886f},
-std::array<float,2>{0.318365842f, 0.988104045f},
-std::array<float,2>{0.591981411f, 0.23498635f},
-std::array<float,2>{0.892340004f, 0.555379927f},
-std::array<float,2>{0.200990513f, 0.424568921f},
-std::array<float,2>{0.489794821f, 0.605987132f},
-std::array<float,2>{0.655009627f, 0.443214625f},
-std::array<float,2>{0.773172319f, 0.920943081f},
-std::array<float,2>{0.0393328108f, 0.153599501f},
-std::array<float,2>{0.14202626f, 0.814225137f},
-std::array<float,2>{0.937935054f, 0.0604209304f},
-std::array<float,2>{0.551645458f, 0.662964582f},
-std::array<float,2>{0.311682791f, 0.282574505f},
-std::array<float,2>{0.243333548f, 0.526789248f},
-std::array<float,2>{0.932452857f, 0.400968015f},
-std::array<float,2>{0.612741053f, 0.955120623f},
-std::array<float,2>{0.34841156f, 0.210526317f},
-std::array<float,2>{0.430205911f, 0.81097132f},
-std::array<float,2>{0.731028914f, 0.0864105672f},
-std::array<float,2>{0.866193295f, 0.715220094f},
-std::array<float,2>{0.0775293335f, 0.373767287f},
-std::array<float,2>{0.261555314f, 0.626067221f},
-std::array<float,2>{0.518874943f, 0.274023682f},
-std::array<float,2>{0.996495426f, 0.860732019f},
-std::array<float,2>{0.171361476f, 0.0140782464f},
-std::array<float,2>{0.0144328f, 0.881483138f},
-std::array<float,2>{0.804587424f, 0.176172331f},
-std::array<float,2>{0.679377437f, 0.587629914f},
-std::array<float,2>{0.445774108f, 0.475221455f},
-std::array<float,2>{0.00515205413f, 0.515374303f},
-std::array<float,2>{0.808077931f, 0.380301595f},
-std::array<float,2>{0.68266207f, 0.945399582f},
-std::array<float,2>{0.440845609f, 0.196640104f},
-std::array<float,2>{0.251067221f, 0.792933941f},
-std::array<float,2>{0.523833394f, 0.0701237246f},
-std::array<float,2>{0.990095556f, 0.699297369f},
-std::array<float,2>{0.158375606f, 0.348519206f},
-std::array<float,2>{0.426724315f, 0.648043215f},
-std::array<float,2>{0.723453224f, 0.250408828f},
-std::array<float,2>{0.869001746f, 0.856779397f},
-std::array<float,2>{0.0648714006f, 0.0257265717f},
-std::array<float,2>{0.240540192f, 0.901126266f},
-std::array<float,2>{0.92663449f, 0.164047942f},
-std::array<float,2>{0.621143103f, 0.575312674f},
-std::array<float,2>{0.354645073f, 0.494256079f},
-std::array<float,2>{0.151637211f, 0.731503665f},
-std::array<float,2>{0.947647393f, 0.319617242f},
-std::array<float,2>{0.561847448f, 0.773267567f},
-std::array<float,2>{0.298105121f, 0.0963515341f},
-std::array<float,2>{0.497759849f, 0.984195292f},
-std::array<float,2>{0.646218956f, 0.228354916f},
-std::array<float,2>{0.780868232f, 0.535702825f},
-std::array<float,2>{0.0387003087f, 0.412643105f},
-std::array<float,2>{0.323931754f, 0.620945811f},
-std::array<float,2>{0.584902525f, 0.457309753f},
-std::array<float,2>{0.901010454f, 0.929331541f},
-std::array<float,2>{0.193844467f, 0.137533024f},
-std::array<float,2>{0.116025098f, 0.838984489f},
-std::array<float,2>{0.825523317f, 0.0392713174f},
-std::array<float,2>{0.706385493f, 0.680711448f},
-std::array<float,2>{0.377360582f, 0.299946815f},
-std::array<float,2>{0.0925425366f, 0.65896219f},
-std::array<float,2>{0.852440655f, 0.287588388f},
-std::array<float,2>{0.746583998f, 0.819117486f},
-std::array<float,2>{0.415619493f, 0.0570425279f},
-std::array<float,2>{0.370143622f, 0.915364861f},
-std::array<float,2>{0.603749037f, 0.149288863f},
-std::array<float,2>{0.912298083f, 0.602671802f},
-std::array<float,2>{0.222804084f, 0.438976914f},
-std::array<float,2>{0.457998067f, 0.562067151f},
-std::array<float,2>{0.66730386f, 0.42662558f},
-std::array<float,2>{0.79634136f, 0.988921404f},
-std::array<float,2>{0.0202516299f, 0.240582615f},
-std::array<float,2>{0.183009282f, 0.765149534f},
-std::array<float,2>{0.98070401f, 0.114732079f},
-std::array<float,2>{0.506079555f, 0.748463809f},
-std::array<float,2>{0.269246817f, 0.333911836f},
-std::array<float,2>{0.212737188f, 0.592285097f},
-std::array<float,2>{0.889585733f, 0.471233636f},
-std::array<float,2>{0.57362622f, 0.877286077f},
-std::array<float,2>{0.337217569f, 0.175496519f},
-std::array<float,2>{0.393334866f, 0.866246164f},
-std::array<float,2>{0.690896332f, 0.00902077183f},
-std::array<float,2>{0.834767938f, 0.630757034f},
-std::array<float,2>{0.109097034f, 0.279189259f},
-std::array<float,2>{0.296708316f, 0.712887168f},
-std::array<float,2>{0.53137362f, 0.37043035f},
-std::array<float,2>{0.956724346f, 0.806700885f},
-std::array<float,2>{0.132989034f, 0.0926303789f},
-std::array<float,2>{0.0492571928f, 0.957079649f},
-std::array<float,2>{0.757070422f, 0.203499317f},
-std::array<float,2>{0.630262971f, 0.530491412f},
-std::array<float,2>{0.475836366f, 0.405428708f},
-std::array<float,2>{0.101050444f, 0.600940466f},
-std::array<float,2>{0.836278141f, 0.446840972f},
-std::array<float,2>{0.699891686f, 0.913278103f},
-std::array<float,2>{0.404016793f, 0.147840232f},
-std::array<float,2>{0.334092349f, 0.825652301f},
-std::array<float,2>{0.568714261f, 0.0491234772f},
-std::array<float,2>{0.881463706f, 0.671677768f},
-std::array<float,2>{0.210406035f, 0.290073156f},
-std::array<float,2>{0.477815449f, 0.737556279f},
-std::array<float,2>{0.634553492f, 0.340589821f},
-std::array<float,2>{0.761639595f, 0.755826414f},
-std::array<float,2>{0.0613682382f, 0.123308182f},
-std::array<float,2>{0.132502124f, 0.993597567f},
-std::array<float,2>{0.96135658f, 0.244382173f},
-std::array<float,2>{0.542480826f, 0.550737619f},
-std::array<float,2>{0.283793956f, 0.432488918f},
-std::array<float,2>{0.232844993f, 0.633027792f},
-std::array<float,2>{0.91476649f, 0.270617485f},
-std::array<float,2>{0.593909025f, 0.867730021f},
-std::array<float,2>{0.364642143f, 0.000107436805f},
-std::array<float,2>{0.412489474f, 0.887710392f},
-std::array<float,2>{0.741173983f, 0.187453762f},
-std::array<float,2>{0.844700217f, 0.58486414f},
-std::array<float,2>{0.0808149055f, 0.479019403f},
-std::array<float,2>{0.275872618f, 0.522768617f},
-std::array<float,2>{0.51196605f, 0.392757088f},
-std::array<float,2>{0.97353816f, 0.968674302f},
-std::array<float,2>{0.174593225f, 0.216633663f},
-std::array<float,2>{0.0268440451f, 0.798386276f},
-std::array<float,2>{0.784881949f, 0.078364417f},
-std::array<float,2>{0.663222313f, 0.705337524f},
-std::array<float,2>{0.463979721f, 0.364278376f},
-std::array<float,2>{0.0454651974f, 0.693929136f},
-std::array<float,2>{0.766357958f, 0.355966181f},
-std::array<float,2>{0.650174856f, 0.781477809f},
-std::array<float,2>{0.487719923f, 0.0735604018f},
-std::array<float,2>{0.305064589f, 0.939353406f},
-std::array<float,2>{0.550079226f, 0.195299312f},
-std::array<float,2>{0.943222463f, 0.505159438f},
-std::array<float,2>{0.145218939f, 0.387596458f},
-std::array<float,2>{0.383566082f, 0.568810582f},
-std::array<float,2>{0.715376139f, 0.487056315f},
-std::array<float,2>{0.817185163f, 0.89300251f},
-std::array<float,2>{0.117364094f, 0.167666227f},
-std::array<float,2>{0.197808012f, 0.850135088f},
-std::array<float,2>{0.894858897f, 0.0190490782f},
-std::array<float,2>{0.587746322f, 0.654925823f},
-std::array<float,2>{0.313597172f, 0.25904423f},
-std::array<float,2>{0.165343106f, 0.541235745f},
-std::array<float,2>{0.99562484f, 0.419133276f},
-std::array<float,2>{0.523362279f, 0.974491954f},
-std::array<float,2>{0.264580011f, 0.225742653f},
-std::array<float,2>{0.450203598f, 0.775714934f},
-std::array<float,2>{0.672870517f, 0.107864223f},
-std::array<float,2>{0.798971236f, 0.723505497f},
-std::array<float,2>{0.00880656205f, 0.324792087f},
-std::array<float,2>{0.347170562f, 0.673500776f},
-std::array<float,2>{0.614246547f, 0.308605015f},
-std::array<float,2>{0.934362233f, 0.83509779f},
-std::array<float,2>{0.248201385f, 0.0329451673f},
-std::array<float,2>{0.0725810826f, 0.93000257f},
-std::array<float,2>{0.863082886f, 0.125522673f},
-std::array<float,2>{0.727924109f, 0.616643369f},
-std::array<float,2>{0.434100986f, 0.466335446f},
-std::array<float,2>{0.112081312f, 0.518289804f},
-std::array<float,2>{0.822764814f, 0.395538956f},
-std::array<float,2>{0.71086365f, 0.963429213f},
-std::array<float,2>{0.379959941f, 0.214008123f},
-std::array<float,2>{0.326497555f, 0.801553071f},
-std::array<float,2>{0.580076993f, 0.0823055804f},
-std::array<float,2>{0.904856026f, 0.710151315f},
-std::array<float,2>{0.187911153f, 0.36093986f},
-std::array<float,2>{0.494409591f, 0.640122831f},
-std::array<float,2>{0.641115248f, 0.268981606f},
-std::array<float,2>{0.777148902f, 0.872570932f},
-std::array<float,2>{0.0342829712f, 0.0077767591f},
-std::array<float,2>{0.156016141f, 0.885842383f},
-std::array<float,2>{0.951799512f, 0.181791991f},
-std::array<float,2>{0.558422983f, 0.580697656f},
-std::array<float,2>{0.304650843f, 0.481231779f},
-std::array<float,2>{0.237558663f, 0.739853501f},
-std::array<float,2>{0.922888637f, 0.337586015f},
-std::array<float,2>{0.620380223f, 0.753881335f},
-std::array<float,2>{0.358270615f, 0.117188625f},
-std::array<float,2>{0.425574154f, 0.996255875f},
-std::array<float,2>{0.719766378f, 0.247560814f},
-std::array<float,2>{0.874880672f, 0.55352056f},
-std::array<float,2>{0.0701435357f, 0.436769545f},
-std::array<float,2>{0.25434348f, 0.595028877f},
-std::array<float,2>{0.530200064f, 0.452961743f},
-std::array<float,2>{0.987689078f, 0.90739876f},
-std::array<float,2>{0.162034452f, 0.144481987f},
-std::array<float,2>{0.00126811105f, 0.824064493f},
-std::array<float,2>{0.809738278f, 0.0535412058f},
-std::array<float,2>{0.684855163f, 0.66656357f},
-std::array<float,2>{0.444031507f, 0.293006927f},
-std::array<float,2>{0.051058393f, 0.676159143f},
-std::array<float,2>{0.750770926f, 0.307149947f},
-std::array<float,2>{0.625579536f, 0.831674874f},
-std::array<float,2>{0.469738543f, 0.0387096293f},
-std::array<float,2>{0.290495247f, 0.937367916f},
-std::array<float,2>{0.537657201f, 0.131396517f},
-std::array<float,2>{0.958956838f, 0.61111933f},
-std::array<float,2>{0.138660789f, 0.461697191f},
-std::array<float,2>{0.394647151f, 0.544071734f},
-std::array<float,2>{0.692402422f, 0.417236984f},
-std::array<float,2>{0.831409693f, 0.970736921f},
-std::array<float,2>{0.101921022f, 0.222552046f},
-std::array<float,2>{0.217593804f, 0.778453052f},
-std::array<float,2>{0.884897053f, 0.102424599f},
-std::array<float,2>{0.574463844f, 0.721657217f},
-std::array<float,2>{0.34294337f, 0.321448684f},
-std::array<float,2>{0.183836609f, 0.562755466f},
-std::array<float,2>{0.976739705f, 0.492040396f},
-std::array<float,2>{0.500895619f, 0.894653976f},
-std::array<float,2>{0.272204906f, 0.171361476f},
-std::array<float,2>{0.454767823f, 0.844745696f},
-std::array<float,2>{0.671676874f, 0.0208373293f},
-std::array<float,2>{0.791966498f, 0.652166843f},
-std::array<float,2>{0.0164727513f, 0.263175249f},
-std::array<float,2>{0.371226966f, 0.688845754f},
-std::array<float,2>{0.60808742f, 0.352897823f},
-std::array<float,2>{0.907101512f, 0.785465598f},
-std::array<float,2>{0.220395476f, 0.07755813f},
-std::array<float,2>{0.0889463797f, 0.943402708f},
-std::array<float,2>{0.856669426f, 0.187677979f},
-std::array<float,2>{0.744991124f, 0.502043307f},
-std::array<float,2>{0.418610364f, 0.386717498f},
-std::array<float,2>{0.0280495249f, 0.623954773f},
-std::array<float,2>{0.7872926f, 0.455766678f},
-std::array<float,2>{0.659763515f, 0.922884881f},
-std::array<float,2>{0.468065947f, 0.135556385f},
-std::array<float,2>{0.280948848f, 0.842435837f},
-std::array<float,2>{0.510560453f, 0.0450322106f},
-std::array<float,2>{0.971647859f, 0.684067488f},
-std::array<float,2>{0.177523926f, 0.301571488f},
-std::array<float,2>{0.408034265f, 0.727716684f},
-std::array<float,2>{0.737963438f, 0.314060807f},
-std::array<float,2>{0.851484001f, 0.769042969f},
-std::array<float,2>{0.0858658999f, 0.0997149944f},
-std::array<float,2>{0.230178505f, 0.979315877f},
-std::array<float,2>{0.920838535f, 0.232383996f},
-std::array<float,2>{0.597838163f, 0.531672597f},
-std::array<float,2>{0.360466838f, 0.409247309f},
-std::array<float,2>{0.126002505f, 0.642737031f},
-std::array<float,2>{0.965314925f, 0.257533967f},
-std::array<float,2>{0.545146286f, 0.853561997f},
-std::array<float,2>{0.286861479f, 0.0305460896f},
-std::array<float,2>{0.483959734f, 0.905412555f},
-std::array<float,2>{0.638406694f, 0.159271479f},
-std::array<float,2>{0.762211561f, 0.572230756f},
-std::array<float,2>{0.0560280606f, 0.496119678f},
-std::array<float,2>{0.328250945f, 0.507914662f},
-std::array<float,2>{0.565402985f, 0.375151873f},
-std::array<float,2>{0.877976179f, 0.953077495f},
-std::array<float,2>{0.203798592f, 0.201136783f},
-std::array<float,2>{0.0959143862f, 0.793192089f},
-std::array<float,2>{0.841105163f, 0.0630220771f},
-std::array<float,2>{0.698513567f, 0.698777676f},
-std::array<float,2>{0.40026316f, 0.345289618f},
-std::array<float,2>{0.0751577169f, 0.717616439f},
-std::array<float,2>{0.865047574f, 0.371971786f},
-std::array<float,2>{0.733318746f, 0.809329331f},
-std::array<float,2>{0.432695568f, 0.0892014802f},
-std::array<float,2>{0.34997642f, 0.95464623f},
-std::array<float,2>{0.609413147f, 0.207842752f},
-std::array<float,2>{0.930264294f, 0.52397716f},
-std::array<float,2>{0.244711265f, 0.39861834f},
-std::array<float,2>{0.447605908f, 0.588516295f},
-std::array<float,2>{0.676199257f, 0.474130213f},
-std::array<float,2>{0.801022053f, 0.879621923f},
-std::array<float,2>{0.0127633251f, 0.179252878f},
-std::array<float,2>{0.169312626f, 0.862209737f},
-std::array<float,2>{0.999924481f, 0.0123644294f},
-std::array<float,2>{0.516086876f, 0.628462195f},
-std::array<float,2>{0.25935179f, 0.275580972f},
-std::array<float,2>{0.202889711f, 0.558529437f},
-std::array<float,2>{0.894251883f, 0.421956539f},
-std::array<float,2>{0.59064579f, 0.986083448f},
-std::array<float,2>{0.316981047f, 0.23709397f},
-std::array<float,2>{0.388387918f, 0.760603786f},
-std::array<float,2>{0.712917387f, 0.112511896f},
-std::array<float,2>{0.813185751f, 0.744997203f},
-std::array<float,2>{0.124460198f, 0.331754476f},
-std::array<float,2>{0.31001702f, 0.661156774f},
-std::array<float,2>{0.552839518f, 0.28388226f},
-std::array<float,2>{0.939787388f, 0.814460814f},
-std::array<float,2>{0.143787697f, 0.0614463016f},
-std::array<float,2>{0.0426343828f, 0.919054508f},
-std::array<float,2>{0.770583272f, 0.154531315f},
-std::array<float,2>{0.65413475f, 0.608778656f},
-std::array<float,2>{0.492144823f, 0.444725811f},
-std::array<float,2>{0.0356043167f, 0.537469983f},
-std::array<float,2>{0.778942227f, 0.411411017f},
-std::array<float,2>{0.647668839f, 0.981973231f},
-std::array<float,2>{0.498217016f, 0.230187014f},
-std::array<float,2>{0.298864692f, 0.76985842f},
-std::array<float,2>{0.558855593f, 0.0954653546f},
-std::array<float,2>{0.945929527f, 0.73402065f},
-std::array<float,2>{0.148555711f, 0.316759706f},
-std::array<float,2>{0.376520574f, 0.683150709f},
-std::array<float,2>{0.70342344f, 0.29735744f},
-std::array<float,2>{0.827390254f, 0.837766588f},
-std::array<float,2>{0.114706345f, 0.0428961292f},
-std::array<float,2>{0.192759797f, 0.926208496f},
-std::array<float,2>{0.898615181f, 0.139421657f},
-std::array<float,2>{0.582533479f, 0.617342412f},
-std::array<float,2>{0.321111262f, 0.459798127f},
-std::array<float,2>{0.157351881f, 0.701988101f},
-std::array<float,2>{0.990955353f, 0.350227654f},
-std::array<float,2>{0.526100874f, 0.79079926f},
-std::array<float,2>{0.2524257f, 0.0668646097f},
-std::array<float,2>{0.439322829f, 0.94912684f},
-std::array<float,2>{0.681063116f, 0.197291896f},
-std::array<float,2>{0.804904044f, 0.512880147f},
-std::array<float,2>{0.0067279432f, 0.381554425f},
-std::array<float,2>{0.35256654f, 0.577085733f},
-std::array<float,2>{0.624986827f, 0.492287904f},
-std::array<float,2>{0.927864075f, 0.898948133f},
-std::array<float,2>{0.238752961f, 0.161799654f},
-std::array<float,2>{0.0636914596f, 0.859045327f},
-std::array<float,2>{0.87050879f, 0.0241990052f},
-std::array<float,2>{0.725850165f, 0.646274924f},
-std::array<float,2>{0.428065777f, 0.253210634f},
-std::array<float,2>{0.107303515f, 0.632145107f},
-std::array<float,2>{0.832667649f, 0.280718863f},
-std::array<float,2>{0.688275874f, 0.865071535f},
-std::array<float,2>{0.391508669f, 0.011708797f},
-std::array<float,2>{0.337910712f, 0.876858294f},
-std::array<float,2>{0.57094878f, 0.172653705f},
-std::array<float,2>{0.888037801f, 0.590059638f},
-std::array<float,2>{0.214431375f, 0.469080716f},
-std::array<float,2>{0.474275261f, 0.528268337f},
-std::array<float,2>{0.632373452f, 0.403747052f},
-std::array<float,2>{0.75495702f, 0.960720658f},
-std::array<float,2>{0.0482607223f, 0.206402883f},
-std::array<float,2>{0.135246754f, 0.806217074f},
-std::array<float,2>{0.954349816f, 0.0914883912f},
-std::array<float,2>{0.53357172f, 0.713778973f},
-std::array<float,2>{0.293271124f, 0.368159443f},
-std::array<float,2>{0.225330368f, 0.604065061f},
-std::array<float,2>{0.912057638f, 0.440221637f},
-std::array<float,2>{0.601590872f, 0.917421103f},
-std::array<float,2>{0.368517816f, 0.151299059f},
-std::array<float,2>{0.416353017f, 0.818163574f},
-std::array<float,2>{0.749259114f, 0.0559379607f},
-std::array<float,2>{0.854356945f, 0.65664655f},
-std::array<float,2>{0.0915099159f, 0.286401153f},
-std::array<float,2>{0.267031908f, 0.746149063f},
-std::array<float,2>{0.505474925f, 0.335570037f},
-std::array<float,2>{0.982802153f, 0.761737227f},
-std::array<float,2>{0.181466609f, 0.115891956f},
-std::array<float,2>{0.0227603316f, 0.991338015f},
-std::array<float,2>{0.794388175f, 0.240056306f},
-std::array<float,2>{0.664074957f, 0.559767008f},
-std::array<float,2>{0.460317671f, 0.427759588f},
-std::array<float,2>{0.0795398131f, 0.58230412f},
-std::array<float,2>{0.847528398f, 0.478371501f},
-std::array<float,2>{0.739406526f, 0.890057325f},
-std::array<float,2>{0.411453366f, 0.183784604f},
-std::array<float,2>{0.366690546f, 0.869291663f},
-std::array<float,2>{0.59749037f, 0.00249123224f},
-std::array<float,2>{0.916996241f, 0.636596918f},
-std::array<float,2>{0.230535015f, 0.272935748f},
-std::array<float,2>{0.462622076f, 0.703666389f},
-std::array<float,2>{0.660236478f, 0.36598888f},
-std::array<float,2>{0.781338573f, 0.799278438f},
-std::array<float,2>{0.0245273635f, 0.0804008022f},
-std::array<float,2>{0.172700003f, 0.965170264f},
-std::array<float,2>{0.974855244f, 0.217960402f},
-std::array<float,2>{0.515027165f, 0.521282434f},
-std::array<float,2>{0.273834229f, 0.392304093f},
-std::array<float,2>{0.207990825f, 0.669276655f},
-std::array<float,2>{0.879292488f, 0.291858554f},
-std::array<float,2>{0.567101836f, 0.826704502f},
-std::array<float,2>{0.332859457f, 0.0469588637f},
-std::array<float,2>{0.405414015f, 0.911191702f},
-std::array<float,2>{0.702682376f, 0.144821987f},
-std::array<float,2>{0.838343441f, 0.59894675f},
-std::array<float,2>{0.0981105044f, 0.447428465f},
-std::array<float,2>{0.281910777f, 0.548310876f},
-std::array<float,2>{0.540088594f, 0.431340516f},
-std::array<float,2>{0.963803053f, 0.995824099f},
-std::array<float,2>{0.129747376f, 0.243537232f},
-std::array<float,2>{0.0591400824f, 0.757392347f},
-std::array<float,2>{0.75877738f, 0.121231884f},
-std::array<float,2>{0.636564314f, 0.734878719f},
-std::array<float,2>{0.480220199f, 0.343313634f},
-std::array<float,2>{0.0105316779f, 0.725091279f},
-std::array<float,2>{0.79823494f, 0.326992869f},
-std::array<float,2>{0.675768971f, 0.773594499f},
-std::array<float,2>{0.452514946f, 0.105611078f},
-std::array<float,2>{0.261957914f, 0.976370931f},
-std::array<float,2>{0.519855499f, 0.224487767f},
-std::array<float,2>{0.993732989f, 0.539329767f},
-std::array<float,2>{0.167742848f, 0.420402527f},
-std::array<float,2>{0.43616572f, 0.613886297f},
-std::array<float,2>{0.729596853f, 0.468394667f},
-std::array<float,2>{0.861101806f, 0.932194412f},
-std::array<float,2>{0.0712180063f, 0.127016678f},
-std::array<float,2>{0.247004613f, 0.833831787f},
-std::array<float,2>{0.9374578f, 0.0341310203f},
-std::array<float,2>{0.616432726f, 0.675111294f},
-std::array<float,2>{0.344359279f, 0.311245292f},
-std::array<float,2>{0.147731051f, 0.506884217f},
-std::array<float,2>{0.945083857f, 0.389862716f},
-std::array<float,2>{0.547575414f, 0.9413234f},
-std::array<float,2>{0.307183594f, 0.193321466f},
-std::array<float,2>{0.485971063f, 0.78454721f},
-std::array<float,2>{0.651769698f, 0.0713441968f},
-std::array<float,2>{0.76911664f, 0.691482484f},
-std::array<float,2>{0.0432907417f, 0.358757466f},
-std::array<float,2>{0.314949811f, 0.65346998f},
-std::array<float,2>{0.589053035f, 0.259807169f},
-std::array<float,2>{0.898397088f, 0.849465847f},
-std::array<float,2>{0.196620435f, 0.0167614333f},
-std::array<float,2>{0.120637789f, 0.891620636f},
-std::array<float,2>{0.819251835f, 0.164158717f},
-std::array<float,2>{0.717933595f, 0.568250716f},
-std::array<float,2>{0.386044145f, 0.486220956f}}
\ No newline at end of file
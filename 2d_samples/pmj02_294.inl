@@ -1,4096 +0,0 @@
-{std::array<float,2>{0.551961124f, 0.524530649f},
-std::array<float,2>{0.430093467f, 0.227977678f},
-std::array<float,2>{0.93773061f, 0.387318999f},
-std::array<float,2>{0.05438485f, 0.904735267f},
-std::array<float,2>{0.796943367f, 0.83800292f},
-std::array<float,2>{0.228020877f, 0.273555607f},
-std::array<float,2>{0.686462581f, 0.0523688607f},
-std::array<float,2>{0.354691833f, 0.69715941f},
-std::array<float,2>{0.919245303f, 0.631501138f},
-std::array<float,2>{0.106708802f, 0.073450394f},
-std::array<float,2>{0.618115425f, 0.334132135f},
-std::array<float,2>{0.472272962f, 0.768038929f},
-std::array<float,2>{0.700641632f, 0.993784487f},
-std::array<float,2>{0.279946417f, 0.459660143f},
-std::array<float,2>{0.826177657f, 0.169083342f},
-std::array<float,2>{0.167734444f, 0.611016214f},
-std::array<float,2>{0.627665162f, 0.72143501f},
-std::array<float,2>{0.327985495f, 0.0163352601f},
-std::array<float,2>{0.773447931f, 0.311500877f},
-std::array<float,2>{0.200737357f, 0.851585448f},
-std::array<float,2>{0.999915123f, 0.931600273f},
-std::array<float,2>{0.0123038078f, 0.409272194f},
-std::array<float,2>{0.521991789f, 0.193557873f},
-std::array<float,2>{0.399520159f, 0.561635852f},
-std::array<float,2>{0.873554409f, 0.593594015f},
-std::array<float,2>{0.141803175f, 0.127334654f},
-std::array<float,2>{0.736962974f, 0.472988546f},
-std::array<float,2>{0.309037417f, 0.95040524f},
-std::array<float,2>{0.590442419f, 0.802868068f},
-std::array<float,2>{0.454662889f, 0.370917916f},
-std::array<float,2>{0.902487457f, 0.0987252668f},
-std::array<float,2>{0.0801062435f, 0.666700184f},
-std::array<float,2>{0.72308445f, 0.607565463f},
-std::array<float,2>{0.291817278f, 0.178724542f},
-std::array<float,2>{0.856867075f, 0.451960802f},
-std::array<float,2>{0.134949848f, 0.982281029f},
-std::array<float,2>{0.884957671f, 0.756492794f},
-std::array<float,2>{0.0711462051f, 0.32302627f},
-std::array<float,2>{0.573763072f, 0.0909206495f},
-std::array<float,2>{0.446416378f, 0.650897026f},
-std::array<float,2>{0.753464699f, 0.714083612f},
-std::array<float,2>{0.215041831f, 0.0460661054f},
-std::array<float,2>{0.649338663f, 0.260243922f},
-std::array<float,2>{0.339137703f, 0.824924171f},
-std::array<float,2>{0.510250032f, 0.885117769f},
-std::array<float,2>{0.377825767f, 0.404019833f},
-std::array<float,2>{0.973475397f, 0.248934597f},
-std::array<float,2>{0.019683769f, 0.514859796f},
-std::array<float,2>{0.5954687f, 0.678081214f},
-std::array<float,2>{0.49464941f, 0.120456666f},
-std::array<float,2>{0.93041569f, 0.347879857f},
-std::array<float,2>{0.11016082f, 0.790957451f},
-std::array<float,2>{0.835202336f, 0.962722778f},
-std::array<float,2>{0.180775315f, 0.49570471f},
-std::array<float,2>{0.711518824f, 0.154911846f},
-std::array<float,2>{0.251071811f, 0.569434941f},
-std::array<float,2>{0.956737339f, 0.541330576f},
-std::array<float,2>{0.0395779088f, 0.218687564f},
-std::array<float,2>{0.534536898f, 0.43698591f},
-std::array<float,2>{0.419176608f, 0.916332662f},
-std::array<float,2>{0.670752883f, 0.86999011f},
-std::array<float,2>{0.373010784f, 0.282941639f},
-std::array<float,2>{0.792038441f, 0.010632759f},
-std::array<float,2>{0.247948855f, 0.737936795f},
-std::array<float,2>{0.563268542f, 0.573537409f},
-std::array<float,2>{0.442921519f, 0.147630647f},
-std::array<float,2>{0.877022922f, 0.490668684f},
-std::array<float,2>{0.0692291781f, 0.953529477f},
-std::array<float,2>{0.849024177f, 0.78289628f},
-std::array<float,2>{0.128247067f, 0.351628244f},
-std::array<float,2>{0.728354633f, 0.110419877f},
-std::array<float,2>{0.28674385f, 0.683887064f},
-std::array<float,2>{0.978370667f, 0.746163309f},
-std::array<float,2>{0.0237694681f, 0.0072588888f},
-std::array<float,2>{0.506517768f, 0.295553803f},
-std::array<float,2>{0.385535151f, 0.866721749f},
-std::array<float,2>{0.646902442f, 0.908552468f},
-std::array<float,2>{0.329258561f, 0.426059335f},
-std::array<float,2>{0.762223303f, 0.203421459f},
-std::array<float,2>{0.207937375f, 0.53723675f},
-std::array<float,2>{0.707630754f, 0.64654541f},
-std::array<float,2>{0.265081435f, 0.0850744694f},
-std::array<float,2>{0.842682838f, 0.319749057f},
-std::array<float,2>{0.177172691f, 0.759892166f},
-std::array<float,2>{0.924598455f, 0.970808625f},
-std::array<float,2>{0.117695779f, 0.438397706f},
-std::array<float,2>{0.602123022f, 0.182284936f},
-std::array<float,2>{0.486468107f, 0.595840812f},
-std::array<float,2>{0.786021352f, 0.503513038f},
-std::array<float,2>{0.23505722f, 0.238221481f},
-std::array<float,2>{0.662020028f, 0.390858322f},
-std::array<float,2>{0.366360456f, 0.88135922f},
-std::array<float,2>{0.545182526f, 0.817572117f},
-std::array<float,2>{0.411257207f, 0.257421881f},
-std::array<float,2>{0.965816736f, 0.0349568352f},
-std::array<float,2>{0.0313675664f, 0.70417738f},
-std::array<float,2>{0.674607575f, 0.549791336f},
-std::array<float,2>{0.345867127f, 0.201893643f},
-std::array<float,2>{0.81016463f, 0.41992408f},
-std::array<float,2>{0.224376336f, 0.92406565f},
-std::array<float,2>{0.951311946f, 0.845964432f},
-std::array<float,2>{0.0560557209f, 0.301641911f},
-std::array<float,2>{0.560840249f, 0.0270599835f},
-std::array<float,2>{0.428419143f, 0.730712414f},
-std::array<float,2>{0.816990972f, 0.657704949f},
-std::array<float,2>{0.161855415f, 0.104956195f},
-std::array<float,2>{0.695012152f, 0.363999516f},
-std::array<float,2>{0.26888752f, 0.805955887f},
-std::array<float,2>{0.615382254f, 0.942859232f},
-std::array<float,2>{0.483126134f, 0.480748087f},
-std::array<float,2>{0.913945436f, 0.13975437f},
-std::array<float,2>{0.099892512f, 0.581618726f},
-std::array<float,2>{0.528899908f, 0.693399727f},
-std::array<float,2>{0.395486772f, 0.0547203422f},
-std::array<float,2>{0.990693986f, 0.271473408f},
-std::array<float,2>{0.00274350168f, 0.833611071f},
-std::array<float,2>{0.770393372f, 0.891920924f},
-std::array<float,2>{0.189661041f, 0.378626078f},
-std::array<float,2>{0.638655841f, 0.224178672f},
-std::array<float,2>{0.3133187f, 0.520333707f},
-std::array<float,2>{0.894560575f, 0.62488538f},
-std::array<float,2>{0.0898305178f, 0.16156517f},
-std::array<float,2>{0.580425262f, 0.467692852f},
-std::array<float,2>{0.467220217f, 0.986028194f},
-std::array<float,2>{0.748746932f, 0.777620375f},
-std::array<float,2>{0.297055602f, 0.336359292f},
-std::array<float,2>{0.859459639f, 0.0646714568f},
-std::array<float,2>{0.153522372f, 0.633950412f},
-std::array<float,2>{0.500484943f, 0.615601659f},
-std::array<float,2>{0.389685869f, 0.165577024f},
-std::array<float,2>{0.984072626f, 0.456971049f},
-std::array<float,2>{0.0311884265f, 0.997689247f},
-std::array<float,2>{0.758498013f, 0.771372855f},
-std::array<float,2>{0.205931291f, 0.32812795f},
-std::array<float,2>{0.642108679f, 0.0771380067f},
-std::array<float,2>{0.335465252f, 0.628216267f},
-std::array<float,2>{0.881508231f, 0.70179987f},
-std::array<float,2>{0.0642505065f, 0.0502773337f},
-std::array<float,2>{0.567904234f, 0.279713154f},
-std::array<float,2>{0.441033036f, 0.84210515f},
-std::array<float,2>{0.732148945f, 0.90094161f},
-std::array<float,2>{0.283768207f, 0.386046529f},
-std::array<float,2>{0.846841574f, 0.233344883f},
-std::array<float,2>{0.131422743f, 0.528002858f},
-std::array<float,2>{0.656364501f, 0.669135809f},
-std::array<float,2>{0.362028778f, 0.0951717719f},
-std::array<float,2>{0.784226179f, 0.374066591f},
-std::array<float,2>{0.240402743f, 0.798354506f},
-std::array<float,2>{0.962820053f, 0.947265863f},
-std::array<float,2>{0.0381023474f, 0.47018981f},
-std::array<float,2>{0.542510152f, 0.130867273f},
-std::array<float,2>{0.406303048f, 0.586936831f},
-std::array<float,2>{0.839096665f, 0.556256354f},
-std::array<float,2>{0.174377412f, 0.188091546f},
-std::array<float,2>{0.703845024f, 0.41166532f},
-std::array<float,2>{0.260958701f, 0.934858918f},
-std::array<float,2>{0.607478499f, 0.858118117f},
-std::array<float,2>{0.489008784f, 0.305548698f},
-std::array<float,2>{0.928285182f, 0.0231213365f},
-std::array<float,2>{0.124427147f, 0.723611474f},
-std::array<float,2>{0.689525664f, 0.508420467f},
-std::array<float,2>{0.270086527f, 0.24518843f},
-std::array<float,2>{0.815630972f, 0.398618579f},
-std::array<float,2>{0.156506047f, 0.889069736f},
-std::array<float,2>{0.907143056f, 0.821813107f},
-std::array<float,2>{0.0956520364f, 0.264545858f},
-std::array<float,2>{0.610817313f, 0.0420030728f},
-std::array<float,2>{0.478398621f, 0.715171814f},
-std::array<float,2>{0.807734966f, 0.653595924f},
-std::array<float,2>{0.221099168f, 0.08780168f},
-std::array<float,2>{0.67896986f, 0.324895084f},
-std::array<float,2>{0.349683553f, 0.75193572f},
-std::array<float,2>{0.558104634f, 0.977038682f},
-std::array<float,2>{0.424303442f, 0.445411742f},
-std::array<float,2>{0.947425067f, 0.17548877f},
-std::array<float,2>{0.0605436303f, 0.603103399f},
-std::array<float,2>{0.584081352f, 0.739849389f},
-std::array<float,2>{0.463212729f, 0.0137494998f},
-std::array<float,2>{0.893585742f, 0.287638426f},
-std::array<float,2>{0.0927934572f, 0.871800482f},
-std::array<float,2>{0.865705609f, 0.9184708f},
-std::array<float,2>{0.150815934f, 0.432620585f},
-std::array<float,2>{0.742678165f, 0.21184203f},
-std::array<float,2>{0.301717609f, 0.543869436f},
-std::array<float,2>{0.98706305f, 0.565723777f},
-std::array<float,2>{0.00706970226f, 0.150982007f},
-std::array<float,2>{0.524818003f, 0.498298496f},
-std::array<float,2>{0.39310354f, 0.96833539f},
-std::array<float,2>{0.63296777f, 0.796856046f},
-std::array<float,2>{0.316643476f, 0.346135885f},
-std::array<float,2>{0.766980231f, 0.12282075f},
-std::array<float,2>{0.195025817f, 0.673161149f},
-std::array<float,2>{0.622013927f, 0.534827709f},
-std::array<float,2>{0.472708493f, 0.210792989f},
-std::array<float,2>{0.914392233f, 0.423452914f},
-std::array<float,2>{0.103601366f, 0.91241169f},
-std::array<float,2>{0.821374059f, 0.860312462f},
-std::array<float,2>{0.170122549f, 0.291574389f},
-std::array<float,2>{0.696766555f, 0.00137434097f},
-std::array<float,2>{0.276056141f, 0.742856383f},
-std::array<float,2>{0.943716705f, 0.681455553f},
-std::array<float,2>{0.0498322695f, 0.115908511f},
-std::array<float,2>{0.547702014f, 0.356705844f},
-std::array<float,2>{0.437469333f, 0.786191404f},
-std::array<float,2>{0.680917203f, 0.959232092f},
-std::array<float,2>{0.356895328f, 0.486582398f},
-std::array<float,2>{0.801771522f, 0.141157851f},
-std::array<float,2>{0.234085217f, 0.577084899f},
-std::array<float,2>{0.741461039f, 0.708297253f},
-std::array<float,2>{0.307346016f, 0.0353091359f},
-std::array<float,2>{0.868168592f, 0.251844704f},
-std::array<float,2>{0.148012519f, 0.812534332f},
-std::array<float,2>{0.898925781f, 0.876950979f},
-std::array<float,2>{0.0840150341f, 0.397418171f},
-std::array<float,2>{0.586844444f, 0.238355726f},
-std::array<float,2>{0.459203273f, 0.505546629f},
-std::array<float,2>{0.778121889f, 0.601066649f},
-std::array<float,2>{0.196486443f, 0.187498406f},
-std::array<float,2>{0.632109046f, 0.442253202f},
-std::array<float,2>{0.322996736f, 0.976275444f},
-std::array<float,2>{0.519118309f, 0.763929248f},
-std::array<float,2>{0.402412087f, 0.315108061f},
-std::array<float,2>{0.994023025f, 0.0781766921f},
-std::array<float,2>{0.0110706221f, 0.643529534f},
-std::array<float,2>{0.653524101f, 0.58547169f},
-std::array<float,2>{0.340848714f, 0.133352309f},
-std::array<float,2>{0.755997062f, 0.47669819f},
-std::array<float,2>{0.214041367f, 0.940293372f},
-std::array<float,2>{0.972285509f, 0.810395062f},
-std::array<float,2>{0.0168218408f, 0.360602558f},
-std::array<float,2>{0.513495028f, 0.107973807f},
-std::array<float,2>{0.381500006f, 0.661304951f},
-std::array<float,2>{0.851890743f, 0.728255093f},
-std::array<float,2>{0.139783874f, 0.0294568986f},
-std::array<float,2>{0.720579863f, 0.300671697f},
-std::array<float,2>{0.293411583f, 0.850032151f},
-std::array<float,2>{0.577658951f, 0.927817464f},
-std::array<float,2>{0.452853531f, 0.414622813f},
-std::array<float,2>{0.889832199f, 0.196945906f},
-std::array<float,2>{0.0748174116f, 0.553174496f},
-std::array<float,2>{0.535849929f, 0.6372177f},
-std::array<float,2>{0.417650372f, 0.0667496845f},
-std::array<float,2>{0.959186614f, 0.34012118f},
-std::array<float,2>{0.0459858477f, 0.773878098f},
-std::array<float,2>{0.795773864f, 0.990559995f},
-std::array<float,2>{0.242293969f, 0.46221745f},
-std::array<float,2>{0.667398572f, 0.158183321f},
-std::array<float,2>{0.370343536f, 0.620059907f},
-std::array<float,2>{0.937105f, 0.519429088f},
-std::array<float,2>{0.116564207f, 0.220808715f},
-std::array<float,2>{0.599554598f, 0.38038826f},
-std::array<float,2>{0.497237831f, 0.89563179f},
-std::array<float,2>{0.716074526f, 0.829665601f},
-std::array<float,2>{0.256868899f, 0.267163724f},
-std::array<float,2>{0.829275012f, 0.0588523857f},
-std::array<float,2>{0.184278414f, 0.690000296f},
-std::array<float,2>{0.520002663f, 0.558977962f},
-std::array<float,2>{0.400627315f, 0.192763537f},
-std::array<float,2>{0.996218264f, 0.406291783f},
-std::array<float,2>{0.0154197197f, 0.931949377f},
-std::array<float,2>{0.775889754f, 0.854306877f},
-std::array<float,2>{0.201925755f, 0.310373217f},
-std::array<float,2>{0.625610173f, 0.0192732532f},
-std::array<float,2>{0.325757593f, 0.72031635f},
-std::array<float,2>{0.905184329f, 0.665908933f},
-std::array<float,2>{0.0793357641f, 0.100532964f},
-std::array<float,2>{0.591810942f, 0.367645353f},
-std::array<float,2>{0.456287831f, 0.801425278f},
-std::array<float,2>{0.735929966f, 0.951306462f},
-std::array<float,2>{0.311516315f, 0.47567302f},
-std::array<float,2>{0.872318745f, 0.125621229f},
-std::array<float,2>{0.144514501f, 0.59049511f},
-std::array<float,2>{0.683872283f, 0.699052453f},
-std::array<float,2>{0.351935774f, 0.0538384207f},
-std::array<float,2>{0.800325632f, 0.276254207f},
-std::array<float,2>{0.229473084f, 0.835942209f},
-std::array<float,2>{0.941204786f, 0.902881086f},
-std::array<float,2>{0.0514557324f, 0.389833748f},
-std::array<float,2>{0.553738236f, 0.230064139f},
-std::array<float,2>{0.432250708f, 0.525593936f},
-std::array<float,2>{0.82506007f, 0.613191903f},
-std::array<float,2>{0.165528268f, 0.171563864f},
-std::array<float,2>{0.702068627f, 0.457670659f},
-std::array<float,2>{0.277466983f, 0.994785607f},
-std::array<float,2>{0.620781839f, 0.765918374f},
-std::array<float,2>{0.469619602f, 0.333553135f},
-std::array<float,2>{0.921482086f, 0.0713785514f},
-std::array<float,2>{0.109235756f, 0.62948221f},
-std::array<float,2>{0.713888228f, 0.567985475f},
-std::array<float,2>{0.252045691f, 0.153422594f},
-std::array<float,2>{0.832606614f, 0.49298352f},
-std::array<float,2>{0.181754291f, 0.963388622f},
-std::array<float,2>{0.932231486f, 0.792809725f},
-std::array<float,2>{0.111842878f, 0.351434201f},
-std::array<float,2>{0.597159564f, 0.117520995f},
-std::array<float,2>{0.493496031f, 0.67728287f},
-std::array<float,2>{0.789343417f, 0.734741569f},
-std::array<float,2>{0.249355331f, 0.0088269012f},
-std::array<float,2>{0.669779658f, 0.28330493f},
-std::array<float,2>{0.37471658f, 0.867373765f},
-std::array<float,2>{0.531335533f, 0.914988756f},
-std::array<float,2>{0.420085549f, 0.433960289f},
-std::array<float,2>{0.954015255f, 0.216483399f},
-std::array<float,2>{0.0411017872f, 0.539693832f},
-std::array<float,2>{0.571674407f, 0.648765743f},
-std::array<float,2>{0.449161679f, 0.0934874788f},
-std::array<float,2>{0.883328378f, 0.321999609f},
-std::array<float,2>{0.0726609528f, 0.755429387f},
-std::array<float,2>{0.858992815f, 0.98292011f},
-std::array<float,2>{0.133026242f, 0.449449271f},
-std::array<float,2>{0.725425899f, 0.176152959f},
-std::array<float,2>{0.289900571f, 0.606735051f},
-std::array<float,2>{0.975839496f, 0.513054788f},
-std::array<float,2>{0.0223694518f, 0.247305274f},
-std::array<float,2>{0.509485245f, 0.40488717f},
-std::array<float,2>{0.376780391f, 0.884031475f},
-std::array<float,2>{0.651723862f, 0.826485395f},
-std::array<float,2>{0.336085021f, 0.258912712f},
-std::array<float,2>{0.750206172f, 0.0447299108f},
-std::array<float,2>{0.216943964f, 0.712628603f},
-std::array<float,2>{0.604322314f, 0.594220996f},
-std::array<float,2>{0.484642267f, 0.180301353f},
-std::array<float,2>{0.923468173f, 0.440649658f},
-std::array<float,2>{0.120121516f, 0.969529152f},
-std::array<float,2>{0.840183854f, 0.757891536f},
-std::array<float,2>{0.178983912f, 0.317845523f},
-std::array<float,2>{0.710739434f, 0.0838653073f},
-std::array<float,2>{0.263292283f, 0.645139098f},
-std::array<float,2>{0.967019022f, 0.705140769f},
-std::array<float,2>{0.034442585f, 0.0331471264f},
-std::array<float,2>{0.543466568f, 0.25502795f},
-std::array<float,2>{0.413762778f, 0.819045186f},
-std::array<float,2>{0.663654745f, 0.880217135f},
-std::array<float,2>{0.364643961f, 0.393038839f},
-std::array<float,2>{0.787976444f, 0.235012025f},
-std::array<float,2>{0.236404464f, 0.500673711f},
-std::array<float,2>{0.729635298f, 0.685976803f},
-std::array<float,2>{0.288947314f, 0.111394487f},
-std::array<float,2>{0.850982428f, 0.353814602f},
-std::array<float,2>{0.126875639f, 0.78512907f},
-std::array<float,2>{0.875861764f, 0.955899894f},
-std::array<float,2>{0.067387253f, 0.488777161f},
-std::array<float,2>{0.565757751f, 0.145641029f},
-std::array<float,2>{0.444017261f, 0.571503282f},
-std::array<float,2>{0.765113056f, 0.535612106f},
-std::array<float,2>{0.210009858f, 0.205968767f},
-std::array<float,2>{0.64553225f, 0.428662479f},
-std::array<float,2>{0.331486672f, 0.907925725f},
-std::array<float,2>{0.504088342f, 0.863853574f},
-std::array<float,2>{0.384653568f, 0.29435277f},
-std::array<float,2>{0.979468703f, 0.00446191989f},
-std::array<float,2>{0.0260437652f, 0.749739885f},
-std::array<float,2>{0.640569985f, 0.521659732f},
-std::array<float,2>{0.315507352f, 0.224647954f},
-std::array<float,2>{0.771573424f, 0.376295924f},
-std::array<float,2>{0.188267797f, 0.89260453f},
-std::array<float,2>{0.989543378f, 0.834383607f},
-std::array<float,2>{0.00113246334f, 0.272927582f},
-std::array<float,2>{0.529527187f, 0.0580545515f},
-std::array<float,2>{0.397211194f, 0.692514122f},
-std::array<float,2>{0.862469494f, 0.634915233f},
-std::array<float,2>{0.154967651f, 0.0642487481f},
-std::array<float,2>{0.746414006f, 0.33977142f},
-std::array<float,2>{0.299223214f, 0.779435754f},
-std::array<float,2>{0.578560174f, 0.986665428f},
-std::array<float,2>{0.466766626f, 0.465393066f},
-std::array<float,2>{0.897043586f, 0.162513793f},
-std::array<float,2>{0.0876293853f, 0.621813118f},
-std::array<float,2>{0.559343576f, 0.733276546f},
-std::array<float,2>{0.427154958f, 0.0247383937f},
-std::array<float,2>{0.949759245f, 0.303333789f},
-std::array<float,2>{0.0573452972f, 0.844535649f},
-std::array<float,2>{0.811108589f, 0.922444522f},
-std::array<float,2>{0.226048589f, 0.418449908f},
-std::array<float,2>{0.673327148f, 0.200207725f},
-std::array<float,2>{0.344423443f, 0.547173679f},
-std::array<float,2>{0.911579907f, 0.579219401f},
-std::array<float,2>{0.0988199413f, 0.137047499f},
-std::array<float,2>{0.614729285f, 0.483786166f},
-std::array<float,2>{0.481792361f, 0.943415821f},
-std::array<float,2>{0.693202317f, 0.808314383f},
-std::array<float,2>{0.26672411f, 0.366941422f},
-std::array<float,2>{0.820250392f, 0.102851197f},
-std::array<float,2>{0.163921356f, 0.659737468f},
-std::array<float,2>{0.53980577f, 0.588644385f},
-std::array<float,2>{0.409092039f, 0.130416095f},
-std::array<float,2>{0.963051379f, 0.471096188f},
-std::array<float,2>{0.0363168791f, 0.946459651f},
-std::array<float,2>{0.78161639f, 0.800327957f},
-std::array<float,2>{0.239112124f, 0.37160632f},
-std::array<float,2>{0.658308923f, 0.0963668525f},
-std::array<float,2>{0.361246288f, 0.671670914f},
-std::array<float,2>{0.92578131f, 0.72626549f},
-std::array<float,2>{0.121884704f, 0.0208841674f},
-std::array<float,2>{0.606373847f, 0.308560073f},
-std::array<float,2>{0.490258306f, 0.856455863f},
-std::array<float,2>{0.706119597f, 0.937423527f},
-std::array<float,2>{0.259396464f, 0.413786322f},
-std::array<float,2>{0.837357461f, 0.191088304f},
-std::array<float,2>{0.173052967f, 0.557858527f},
-std::array<float,2>{0.644345284f, 0.625359595f},
-std::array<float,2>{0.332759768f, 0.0756499991f},
-std::array<float,2>{0.761352658f, 0.330122083f},
-std::array<float,2>{0.204742044f, 0.772373378f},
-std::array<float,2>{0.982040405f, 0.999147713f},
-std::array<float,2>{0.0281435139f, 0.453710854f},
-std::array<float,2>{0.50267452f, 0.167510703f},
-std::array<float,2>{0.386863768f, 0.614624858f},
-std::array<float,2>{0.845262825f, 0.53033787f},
-std::array<float,2>{0.129134551f, 0.231693655f},
-std::array<float,2>{0.733453929f, 0.383661598f},
-std::array<float,2>{0.282400042f, 0.898464143f},
-std::array<float,2>{0.568479657f, 0.840213656f},
-std::array<float,2>{0.438547075f, 0.278420717f},
-std::array<float,2>{0.880197585f, 0.0472884104f},
-std::array<float,2>{0.0653044134f, 0.699701011f},
-std::array<float,2>{0.744987369f, 0.545199037f},
-std::array<float,2>{0.303670704f, 0.214506075f},
-std::array<float,2>{0.864871204f, 0.429891944f},
-std::array<float,2>{0.149429575f, 0.921189129f},
-std::array<float,2>{0.891527355f, 0.874281406f},
-std::array<float,2>{0.0904216096f, 0.287017554f},
-std::array<float,2>{0.583561897f, 0.0117736571f},
-std::array<float,2>{0.461833894f, 0.741077065f},
-std::array<float,2>{0.768097818f, 0.67446804f},
-std::array<float,2>{0.191815361f, 0.12389864f},
-std::array<float,2>{0.636458039f, 0.344915062f},
-std::array<float,2>{0.320148498f, 0.794237852f},
-std::array<float,2>{0.525619686f, 0.966073453f},
-std::array<float,2>{0.392058194f, 0.497252882f},
-std::array<float,2>{0.985049367f, 0.149315163f},
-std::array<float,2>{0.00562381651f, 0.56282109f},
-std::array<float,2>{0.612142384f, 0.717335522f},
-std::array<float,2>{0.478824377f, 0.0392802171f},
-std::array<float,2>{0.910046339f, 0.263107777f},
-std::array<float,2>{0.0960196778f, 0.822657406f},
-std::array<float,2>{0.81266433f, 0.888345301f},
-std::array<float,2>{0.158857942f, 0.40061146f},
-std::array<float,2>{0.688306272f, 0.242300838f},
-std::array<float,2>{0.271894991f, 0.510686219f},
-std::array<float,2>{0.946017444f, 0.604178309f},
-std::array<float,2>{0.0624824986f, 0.173266977f},
-std::array<float,2>{0.555321872f, 0.448053271f},
-std::array<float,2>{0.423569202f, 0.980108738f},
-std::array<float,2>{0.676491976f, 0.753596663f},
-std::array<float,2>{0.347918123f, 0.328082919f},
-std::array<float,2>{0.805214465f, 0.0893990174f},
-std::array<float,2>{0.219635725f, 0.655235648f},
-std::array<float,2>{0.588222325f, 0.50651437f},
-std::array<float,2>{0.45806852f, 0.240906298f},
-std::array<float,2>{0.900598288f, 0.395985067f},
-std::array<float,2>{0.0837224573f, 0.87803489f},
-std::array<float,2>{0.869472504f, 0.815613449f},
-std::array<float,2>{0.145996422f, 0.253760159f},
-std::array<float,2>{0.73848772f, 0.0380876027f},
-std::array<float,2>{0.306055963f, 0.710746944f},
-std::array<float,2>{0.995115936f, 0.641515434f},
-std::array<float,2>{0.00888261478f, 0.0818774179f},
-std::array<float,2>{0.516076803f, 0.31343019f},
-std::array<float,2>{0.40558058f, 0.762073338f},
-std::array<float,2>{0.630746186f, 0.97372967f},
-std::array<float,2>{0.320684373f, 0.443966627f},
-std::array<float,2>{0.779629707f, 0.184282944f},
-std::array<float,2>{0.198364869f, 0.597735465f},
-std::array<float,2>{0.698541582f, 0.745683432f},
-std::array<float,2>{0.274401844f, 0.00234919763f},
-std::array<float,2>{0.822778106f, 0.290793866f},
-std::array<float,2>{0.168310672f, 0.861540496f},
-std::array<float,2>{0.917073965f, 0.910637558f},
-std::array<float,2>{0.102869347f, 0.425518841f},
-std::array<float,2>{0.624442101f, 0.208631843f},
-std::array<float,2>{0.47543633f, 0.532421768f},
-std::array<float,2>{0.804067075f, 0.574302495f},
-std::array<float,2>{0.231428862f, 0.14413169f},
-std::array<float,2>{0.681753933f, 0.485271215f},
-std::array<float,2>{0.358223945f, 0.958269894f},
-std::array<float,2>{0.549065888f, 0.788212061f},
-std::array<float,2>{0.434335887f, 0.358175516f},
-std::array<float,2>{0.942171931f, 0.113816433f},
-std::array<float,2>{0.0486224182f, 0.682435632f},
-std::array<float,2>{0.665068924f, 0.617591858f},
-std::array<float,2>{0.367703468f, 0.158470124f},
-std::array<float,2>{0.793769002f, 0.464406729f},
-std::array<float,2>{0.245109066f, 0.988548338f},
-std::array<float,2>{0.957038164f, 0.775557756f},
-std::array<float,2>{0.0443285704f, 0.341958761f},
-std::array<float,2>{0.537795365f, 0.0688024387f},
-std::array<float,2>{0.415147871f, 0.639584541f},
-std::array<float,2>{0.831840694f, 0.688908339f},
-std::array<float,2>{0.186433077f, 0.0620172657f},
-std::array<float,2>{0.718669116f, 0.267910898f},
-std::array<float,2>{0.25507313f, 0.831612051f},
-std::array<float,2>{0.600099802f, 0.896818817f},
-std::array<float,2>{0.498499513f, 0.382076085f},
-std::array<float,2>{0.934046566f, 0.219414368f},
-std::array<float,2>{0.113814794f, 0.515893459f},
-std::array<float,2>{0.513766646f, 0.66327256f},
-std::array<float,2>{0.379969776f, 0.106026292f},
-std::array<float,2>{0.970331192f, 0.361699075f},
-std::array<float,2>{0.0190661307f, 0.810680747f},
-std::array<float,2>{0.754654765f, 0.937844396f},
-std::array<float,2>{0.2119115f, 0.480025947f},
-std::array<float,2>{0.654902458f, 0.136672214f},
-std::array<float,2>{0.341895163f, 0.583565235f},
-std::array<float,2>{0.887931228f, 0.551375687f},
-std::array<float,2>{0.0770866126f, 0.197333634f},
-std::array<float,2>{0.574658036f, 0.417084843f},
-std::array<float,2>{0.450513303f, 0.926985919f},
-std::array<float,2>{0.721113384f, 0.847983837f},
-std::array<float,2>{0.296511322f, 0.297555447f},
-std::array<float,2>{0.85444808f, 0.0290767644f},
-std::array<float,2>{0.137576044f, 0.730378866f},
-std::array<float,2>{0.50792557f, 0.513776481f},
-std::array<float,2>{0.375346422f, 0.249414295f},
-std::array<float,2>{0.975025237f, 0.403314918f},
-std::array<float,2>{0.0224666484f, 0.886404812f},
-std::array<float,2>{0.751174986f, 0.825745344f},
-std::array<float,2>{0.218355402f, 0.261509866f},
-std::array<float,2>{0.65049088f, 0.0458818786f},
-std::array<float,2>{0.337718248f, 0.713438809f},
-std::array<float,2>{0.884127915f, 0.652113736f},
-std::array<float,2>{0.0741308331f, 0.0902800858f},
-std::array<float,2>{0.571086168f, 0.323673397f},
-std::array<float,2>{0.44728303f, 0.756911039f},
-std::array<float,2>{0.726512432f, 0.980469525f},
-std::array<float,2>{0.290526479f, 0.452174723f},
-std::array<float,2>{0.858262718f, 0.177872449f},
-std::array<float,2>{0.134451061f, 0.608905196f},
-std::array<float,2>{0.66847086f, 0.737238169f},
-std::array<float,2>{0.373489767f, 0.0110039366f},
-std::array<float,2>{0.790923059f, 0.282099456f},
-std::array<float,2>{0.248825788f, 0.870595872f},
-std::array<float,2>{0.954566061f, 0.917437673f},
-std::array<float,2>{0.0424075909f, 0.436025292f},
-std::array<float,2>{0.532754898f, 0.217410132f},
-std::array<float,2>{0.42096892f, 0.542608142f},
-std::array<float,2>{0.83311224f, 0.568629682f},
-std::array<float,2>{0.18312794f, 0.15584074f},
-std::array<float,2>{0.713363171f, 0.494405866f},
-std::array<float,2>{0.253603309f, 0.961340666f},
-std::array<float,2>{0.596020043f, 0.78920567f},
-std::array<float,2>{0.49310559f, 0.349202454f},
-std::array<float,2>{0.933084965f, 0.119834237f},
-std::array<float,2>{0.112387709f, 0.678939939f},
-std::array<float,2>{0.702732921f, 0.610012114f},
-std::array<float,2>{0.278344512f, 0.167972982f},
-std::array<float,2>{0.826060772f, 0.460347354f},
-std::array<float,2>{0.164249673f, 0.992838621f},
-std::array<float,2>{0.920309484f, 0.768863201f},
-std::array<float,2>{0.107424594f, 0.335682154f},
-std::array<float,2>{0.62001121f, 0.0729192495f},
-std::array<float,2>{0.470055729f, 0.632147908f},
-std::array<float,2>{0.799541175f, 0.696195364f},
-std::array<float,2>{0.229555145f, 0.050887581f},
-std::array<float,2>{0.684755147f, 0.274762124f},
-std::array<float,2>{0.35314393f, 0.838968158f},
-std::array<float,2>{0.553389907f, 0.905721307f},
-std::array<float,2>{0.433564454f, 0.387893707f},
-std::array<float,2>{0.940219879f, 0.227441981f},
-std::array<float,2>{0.0520973615f, 0.523595512f},
-std::array<float,2>{0.593171358f, 0.667696357f},
-std::array<float,2>{0.455973983f, 0.0976983309f},
-std::array<float,2>{0.905730426f, 0.369949549f},
-std::array<float,2>{0.0789414868f, 0.803724706f},
-std::array<float,2>{0.872037292f, 0.949904561f},
-std::array<float,2>{0.142773896f, 0.473965675f},
-std::array<float,2>{0.73450017f, 0.128770977f},
-std::array<float,2>{0.312141836f, 0.59247607f},
-std::array<float,2>{0.997214854f, 0.561104178f},
-std::array<float,2>{0.0145044085f, 0.194356769f},
-std::array<float,2>{0.520630121f, 0.408610821f},
-std::array<float,2>{0.401444197f, 0.930551052f},
-std::array<float,2>{0.626216292f, 0.853454053f},
-std::array<float,2>{0.324407548f, 0.311861038f},
-std::array<float,2>{0.776500642f, 0.0166811831f},
-std::array<float,2>{0.203071937f, 0.72222209f},
-std::array<float,2>{0.614236891f, 0.580881536f},
-std::array<float,2>{0.481407136f, 0.139048234f},
-std::array<float,2>{0.910566509f, 0.481737018f},
-std::array<float,2>{0.0981612429f, 0.941538692f},
-std::array<float,2>{0.818846226f, 0.805549979f},
-std::array<float,2>{0.162408069f, 0.364943385f},
-std::array<float,2>{0.69201678f, 0.103530325f},
-std::array<float,2>{0.266235679f, 0.657209218f},
-std::array<float,2>{0.950740039f, 0.732215166f},
-std::array<float,2>{0.0583999418f, 0.0256607682f},
-std::array<float,2>{0.560361385f, 0.302514106f},
-std::array<float,2>{0.425999105f, 0.84695369f},
-std::array<float,2>{0.672302783f, 0.92512995f},
-std::array<float,2>{0.344970971f, 0.421562374f},
-std::array<float,2>{0.812237859f, 0.202480108f},
-std::array<float,2>{0.22497198f, 0.550036132f},
-std::array<float,2>{0.747297168f, 0.63367033f},
-std::array<float,2>{0.300205022f, 0.0663617551f},
-std::array<float,2>{0.861892045f, 0.337260306f},
-std::array<float,2>{0.156151325f, 0.779100478f},
-std::array<float,2>{0.897865117f, 0.985344827f},
-std::array<float,2>{0.0863014311f, 0.468628585f},
-std::array<float,2>{0.579509616f, 0.161064342f},
-std::array<float,2>{0.465593636f, 0.623298645f},
-std::array<float,2>{0.773030937f, 0.520694792f},
-std::array<float,2>{0.188728347f, 0.223010093f},
-std::array<float,2>{0.639264643f, 0.377292186f},
-std::array<float,2>{0.314943075f, 0.891183555f},
-std::array<float,2>{0.530371547f, 0.832780182f},
-std::array<float,2>{0.397809803f, 0.270196468f},
-std::array<float,2>{0.988863647f, 0.0565831549f},
-std::array<float,2>{0.000731864246f, 0.694365799f},
-std::array<float,2>{0.6446473f, 0.538268268f},
-std::array<float,2>{0.330440968f, 0.204667106f},
-std::array<float,2>{0.764529347f, 0.427692294f},
-std::array<float,2>{0.209460422f, 0.909484804f},
-std::array<float,2>{0.980383813f, 0.865246177f},
-std::array<float,2>{0.0271104351f, 0.29612124f},
-std::array<float,2>{0.505269647f, 0.00608636253f},
-std::array<float,2>{0.383253157f, 0.7479496f},
-std::array<float,2>{0.85011524f, 0.685224533f},
-std::array<float,2>{0.125459433f, 0.109562777f},
-std::array<float,2>{0.72919184f, 0.352663964f},
-std::array<float,2>{0.287970245f, 0.781775951f},
-std::array<float,2>{0.565139413f, 0.954407036f},
-std::array<float,2>{0.444354117f, 0.492182225f},
-std::array<float,2>{0.876128078f, 0.146731764f},
-std::array<float,2>{0.0671722144f, 0.57273829f},
-std::array<float,2>{0.544757366f, 0.703439236f},
-std::array<float,2>{0.412800431f, 0.0338118412f},
-std::array<float,2>{0.968509495f, 0.25642851f},
-std::array<float,2>{0.0332609639f, 0.816468239f},
-std::array<float,2>{0.788462937f, 0.882593095f},
-std::array<float,2>{0.237530813f, 0.392344177f},
-std::array<float,2>{0.662312448f, 0.237078607f},
-std::array<float,2>{0.363723129f, 0.502807438f},
-std::array<float,2>{0.92223227f, 0.596863031f},
-std::array<float,2>{0.119440123f, 0.183146134f},
-std::array<float,2>{0.605261803f, 0.439003199f},
-std::array<float,2>{0.485587835f, 0.97234261f},
-std::array<float,2>{0.709115088f, 0.761607349f},
-std::array<float,2>{0.262109637f, 0.31871444f},
-std::array<float,2>{0.841041148f, 0.0846647024f},
-std::array<float,2>{0.178227961f, 0.647995532f},
-std::array<float,2>{0.556437433f, 0.602462888f},
-std::array<float,2>{0.422172487f, 0.174161002f},
-std::array<float,2>{0.947143674f, 0.447093993f},
-std::array<float,2>{0.0610553287f, 0.977806807f},
-std::array<float,2>{0.805823088f, 0.75025177f},
-std::array<float,2>{0.219799474f, 0.326047808f},
-std::array<float,2>{0.677397013f, 0.0866160989f},
-std::array<float,2>{0.349140704f, 0.652761459f},
-std::array<float,2>{0.908370793f, 0.715901315f},
-std::array<float,2>{0.0972945467f, 0.0419394262f},
-std::array<float,2>{0.612958431f, 0.265389562f},
-std::array<float,2>{0.480041713f, 0.82045573f},
-std::array<float,2>{0.689172447f, 0.889815688f},
-std::array<float,2>{0.273292065f, 0.399643391f},
-std::array<float,2>{0.813983738f, 0.244668007f},
-std::array<float,2>{0.15970926f, 0.509141922f},
-std::array<float,2>{0.634912252f, 0.672652781f},
-std::array<float,2>{0.318845212f, 0.121720836f},
-std::array<float,2>{0.768645465f, 0.347236007f},
-std::array<float,2>{0.192436442f, 0.795703113f},
-std::array<float,2>{0.985647619f, 0.967740834f},
-std::array<float,2>{0.004332643f, 0.499188006f},
-std::array<float,2>{0.52686578f, 0.151530892f},
-std::array<float,2>{0.391037524f, 0.564486623f},
-std::array<float,2>{0.863780379f, 0.544166386f},
-std::array<float,2>{0.149413615f, 0.211984381f},
-std::array<float,2>{0.745687783f, 0.432184726f},
-std::array<float,2>{0.303957045f, 0.919356525f},
-std::array<float,2>{0.582936049f, 0.872659743f},
-std::array<float,2>{0.462463349f, 0.288765103f},
-std::array<float,2>{0.891834617f, 0.0149583723f},
-std::array<float,2>{0.0914396495f, 0.73915267f},
-std::array<float,2>{0.73272562f, 0.529292881f},
-std::array<float,2>{0.281521976f, 0.233826861f},
-std::array<float,2>{0.843842983f, 0.385203212f},
-std::array<float,2>{0.130509317f, 0.902101994f},
-std::array<float,2>{0.879059017f, 0.843593955f},
-std::array<float,2>{0.0661635324f, 0.281003505f},
-std::array<float,2>{0.569380641f, 0.049471356f},
-std::array<float,2>{0.438186377f, 0.702574015f},
-std::array<float,2>{0.760452032f, 0.627134144f},
-std::array<float,2>{0.203745544f, 0.0780092701f},
-std::array<float,2>{0.642709255f, 0.329936415f},
-std::array<float,2>{0.333747685f, 0.769841969f},
-std::array<float,2>{0.503695011f, 0.996968567f},
-std::array<float,2>{0.387825906f, 0.455818564f},
-std::array<float,2>{0.98117739f, 0.164636776f},
-std::array<float,2>{0.028410919f, 0.61657083f},
-std::array<float,2>{0.606493413f, 0.723667681f},
-std::array<float,2>{0.491226614f, 0.0223565474f},
-std::array<float,2>{0.927278697f, 0.306218624f},
-std::array<float,2>{0.122975171f, 0.858623743f},
-std::array<float,2>{0.836854696f, 0.933942437f},
-std::array<float,2>{0.172704875f, 0.410511404f},
-std::array<float,2>{0.705097258f, 0.188595593f},
-std::array<float,2>{0.2587277f, 0.555518985f},
-std::array<float,2>{0.964109659f, 0.586521983f},
-std::array<float,2>{0.0355201699f, 0.132311106f},
-std::array<float,2>{0.540708601f, 0.46949628f},
-std::array<float,2>{0.409701884f, 0.949211776f},
-std::array<float,2>{0.659361184f, 0.796892166f},
-std::array<float,2>{0.360312015f, 0.373823553f},
-std::array<float,2>{0.782287836f, 0.094008863f},
-std::array<float,2>{0.239626959f, 0.66805917f},
-std::array<float,2>{0.575989187f, 0.553816438f},
-std::array<float,2>{0.449598432f, 0.195489943f},
-std::array<float,2>{0.88672775f, 0.415621221f},
-std::array<float,2>{0.0780319944f, 0.929289281f},
-std::array<float,2>{0.854862213f, 0.850981057f},
-std::array<float,2>{0.13795124f, 0.299631417f},
-std::array<float,2>{0.721963763f, 0.0309887119f},
-std::array<float,2>{0.295437276f, 0.726611555f},
-std::array<float,2>{0.969136596f, 0.660373092f},
-std::array<float,2>{0.0184711516f, 0.108577058f},
-std::array<float,2>{0.515335619f, 0.359681547f},
-std::array<float,2>{0.379297227f, 0.809226334f},
-std::array<float,2>{0.655894101f, 0.940481782f},
-std::array<float,2>{0.343138784f, 0.478102088f},
-std::array<float,2>{0.755262554f, 0.133866251f},
-std::array<float,2>{0.212009534f, 0.584072411f},
-std::array<float,2>{0.717205405f, 0.690766871f},
-std::array<float,2>{0.254104674f, 0.0597882569f},
-std::array<float,2>{0.830956459f, 0.265915155f},
-std::array<float,2>{0.187032759f, 0.828426182f},
-std::array<float,2>{0.935435414f, 0.89474678f},
-std::array<float,2>{0.115231998f, 0.378931314f},
-std::array<float,2>{0.60123086f, 0.222452685f},
-std::array<float,2>{0.499230862f, 0.518552065f},
-std::array<float,2>{0.794753611f, 0.620223701f},
-std::array<float,2>{0.245553493f, 0.156838849f},
-std::array<float,2>{0.664110243f, 0.461438626f},
-std::array<float,2>{0.368775874f, 0.991291881f},
-std::array<float,2>{0.538567126f, 0.774719357f},
-std::array<float,2>{0.414678335f, 0.340896636f},
-std::array<float,2>{0.958680272f, 0.0677961931f},
-std::array<float,2>{0.0433764197f, 0.638000369f},
-std::array<float,2>{0.682854712f, 0.577716053f},
-std::array<float,2>{0.358617783f, 0.141959861f},
-std::array<float,2>{0.802977443f, 0.48788932f},
-std::array<float,2>{0.231716111f, 0.960053205f},
-std::array<float,2>{0.942869663f, 0.785387814f},
-std::array<float,2>{0.0471625105f, 0.35591498f},
-std::array<float,2>{0.550162852f, 0.116480485f},
-std::array<float,2>{0.434818566f, 0.679905176f},
-std::array<float,2>{0.823848009f, 0.744115949f},
-std::array<float,2>{0.169610769f, 0.000600473199f},
-std::array<float,2>{0.697353661f, 0.292360604f},
-std::array<float,2>{0.275322676f, 0.861187696f},
-std::array<float,2>{0.623225391f, 0.913883567f},
-std::array<float,2>{0.476252884f, 0.42254734f},
-std::array<float,2>{0.916748881f, 0.209298655f},
-std::array<float,2>{0.102443554f, 0.533352852f},
-std::array<float,2>{0.517497182f, 0.644015133f},
-std::array<float,2>{0.404339045f, 0.0793233812f},
-std::array<float,2>{0.995934248f, 0.315656334f},
-std::array<float,2>{0.00827541761f, 0.765003681f},
-std::array<float,2>{0.781036735f, 0.97551769f},
-std::array<float,2>{0.19734256f, 0.442967236f},
-std::array<float,2>{0.629076242f, 0.186448917f},
-std::array<float,2>{0.321766317f, 0.600311577f},
-std::array<float,2>{0.902184665f, 0.504207373f},
-std::array<float,2>{0.0827041492f, 0.239369094f},
-std::array<float,2>{0.589645684f, 0.398009062f},
-std::array<float,2>{0.457721591f, 0.875524879f},
-std::array<float,2>{0.740154922f, 0.814311266f},
-std::array<float,2>{0.305151522f, 0.250123531f},
-std::array<float,2>{0.870314538f, 0.036458604f},
-std::array<float,2>{0.145403653f, 0.707472324f},
-std::array<float,2>{0.534044623f, 0.540827036f},
-std::array<float,2>{0.418076485f, 0.215459064f},
-std::array<float,2>{0.955163598f, 0.434752315f},
-std::array<float,2>{0.0408189707f, 0.915091872f},
-std::array<float,2>{0.791323543f, 0.868374527f},
-std::array<float,2>{0.246880025f, 0.284671158f},
-std::array<float,2>{0.671114504f, 0.00873514917f},
-std::array<float,2>{0.37182954f, 0.735915005f},
-std::array<float,2>{0.931366742f, 0.676607966f},
-std::array<float,2>{0.111067362f, 0.118944734f},
-std::array<float,2>{0.594339013f, 0.350109458f},
-std::array<float,2>{0.495921642f, 0.791989088f},
-std::array<float,2>{0.712627232f, 0.963946164f},
-std::array<float,2>{0.250619054f, 0.493375629f},
-std::array<float,2>{0.834010005f, 0.152385056f},
-std::array<float,2>{0.179903582f, 0.566773593f},
-std::array<float,2>{0.650228083f, 0.711159647f},
-std::array<float,2>{0.337921351f, 0.0435942188f},
-std::array<float,2>{0.752180159f, 0.258196503f},
-std::array<float,2>{0.216087505f, 0.827588081f},
-std::array<float,2>{0.974557102f, 0.882874787f},
-std::array<float,2>{0.0205914937f, 0.405745178f},
-std::array<float,2>{0.511547685f, 0.24700433f},
-std::array<float,2>{0.37820816f, 0.512484074f},
-std::array<float,2>{0.856205046f, 0.606332779f},
-std::array<float,2>{0.13626875f, 0.176782519f},
-std::array<float,2>{0.72456187f, 0.450518161f},
-std::array<float,2>{0.292199314f, 0.983958066f},
-std::array<float,2>{0.572729111f, 0.754340589f},
-std::array<float,2>{0.445850641f, 0.320717245f},
-std::array<float,2>{0.886648238f, 0.0927606672f},
-std::array<float,2>{0.0719671622f, 0.649988055f},
-std::array<float,2>{0.738178134f, 0.591540992f},
-std::array<float,2>{0.310441136f, 0.126656994f},
-std::array<float,2>{0.874536097f, 0.475301951f},
-std::array<float,2>{0.140848979f, 0.95236218f},
-std::array<float,2>{0.903555453f, 0.802220166f},
-std::array<float,2>{0.0812950507f, 0.368976533f},
-std::array<float,2>{0.59127599f, 0.101388082f},
-std::array<float,2>{0.453847349f, 0.664417684f},
-std::array<float,2>{0.775131047f, 0.719199538f},
-std::array<float,2>{0.199733421f, 0.018288333f},
-std::array<float,2>{0.627947628f, 0.308850586f},
-std::array<float,2>{0.326681107f, 0.854810238f},
-std::array<float,2>{0.523346663f, 0.932785451f},
-std::array<float,2>{0.399357766f, 0.407694995f},
-std::array<float,2>{0.998984098f, 0.192328483f},
-std::array<float,2>{0.0128326863f, 0.559727311f},
-std::array<float,2>{0.618856311f, 0.630351126f},
-std::array<float,2>{0.471025884f, 0.0707166716f},
-std::array<float,2>{0.918561399f, 0.332271427f},
-std::array<float,2>{0.105903722f, 0.767403424f},
-std::array<float,2>{0.828109264f, 0.995656967f},
-std::array<float,2>{0.166942447f, 0.458078504f},
-std::array<float,2>{0.699237227f, 0.170603931f},
-std::array<float,2>{0.280365944f, 0.612092435f},
-std::array<float,2>{0.938573658f, 0.527012229f},
-std::array<float,2>{0.05276867f, 0.229186267f},
-std::array<float,2>{0.551139951f, 0.389581978f},
-std::array<float,2>{0.431400687f, 0.903505027f},
-std::array<float,2>{0.686544061f, 0.837097764f},
-std::array<float,2>{0.354326516f, 0.276717126f},
-std::array<float,2>{0.798712015f, 0.0532769002f},
-std::array<float,2>{0.227457717f, 0.697731674f},
-std::array<float,2>{0.581839859f, 0.622871399f},
-std::array<float,2>{0.468022704f, 0.163784385f},
-std::array<float,2>{0.895755649f, 0.466686308f},
-std::array<float,2>{0.0883901492f, 0.988196075f},
-std::array<float,2>{0.861114562f, 0.780307293f},
-std::array<float,2>{0.152791098f, 0.338760674f},
-std::array<float,2>{0.749585927f, 0.0627011284f},
-std::array<float,2>{0.298607588f, 0.63600117f},
-std::array<float,2>{0.991972923f, 0.691633761f},
-std::array<float,2>{0.00318839797f, 0.0570433475f},
-std::array<float,2>{0.527575612f, 0.271755278f},
-std::array<float,2>{0.395773232f, 0.835538268f},
-std::array<float,2>{0.637420535f, 0.893798709f},
-std::array<float,2>{0.314205468f, 0.375447005f},
-std::array<float,2>{0.771419048f, 0.225873679f},
-std::array<float,2>{0.191269889f, 0.523335934f},
-std::array<float,2>{0.694043517f, 0.658963561f},
-std::array<float,2>{0.268102467f, 0.102111846f},
-std::array<float,2>{0.818064094f, 0.365255743f},
-std::array<float,2>{0.160334453f, 0.807607055f},
-std::array<float,2>{0.912696064f, 0.944432318f},
-std::array<float,2>{0.100910723f, 0.483390719f},
-std::array<float,2>{0.616788626f, 0.13857086f},
-std::array<float,2>{0.483984143f, 0.578923941f},
-std::array<float,2>{0.809465587f, 0.548480809f},
-std::array<float,2>{0.222975001f, 0.200121999f},
-std::array<float,2>{0.675234258f, 0.419077963f},
-std::array<float,2>{0.346951872f, 0.92305541f},
-std::array<float,2>{0.562301159f, 0.844823778f},
-std::array<float,2>{0.429377228f, 0.303967983f},
-std::array<float,2>{0.952363193f, 0.0242654961f},
-std::array<float,2>{0.0553340875f, 0.733585477f},
-std::array<float,2>{0.660741866f, 0.501274765f},
-std::array<float,2>{0.365273148f, 0.236029506f},
-std::array<float,2>{0.786980748f, 0.393983722f},
-std::array<float,2>{0.236009687f, 0.879452169f},
-std::array<float,2>{0.965997517f, 0.819517732f},
-std::array<float,2>{0.0331266671f, 0.254298151f},
-std::array<float,2>{0.546835005f, 0.0321054906f},
-std::array<float,2>{0.410850197f, 0.706412613f},
-std::array<float,2>{0.843747079f, 0.646289051f},
-std::array<float,2>{0.175950721f, 0.0823281705f},
-std::array<float,2>{0.708405316f, 0.317279428f},
-std::array<float,2>{0.264465809f, 0.759073734f},
-std::array<float,2>{0.603006065f, 0.970217347f},
-std::array<float,2>{0.487814903f, 0.440059543f},
-std::array<float,2>{0.924813926f, 0.181453571f},
-std::array<float,2>{0.118704125f, 0.5949049f},
-std::array<float,2>{0.507625043f, 0.748511374f},
-std::array<float,2>{0.385820657f, 0.00519634457f},
-std::array<float,2>{0.976599514f, 0.293385297f},
-std::array<float,2>{0.024452664f, 0.864715695f},
-std::array<float,2>{0.763443112f, 0.90705061f},
-std::array<float,2>{0.208485663f, 0.429026246f},
-std::array<float,2>{0.647615731f, 0.206245184f},
-std::array<float,2>{0.329046726f, 0.536567986f},
-std::array<float,2>{0.87885046f, 0.570566893f},
-std::array<float,2>{0.0702220574f, 0.144804418f},
-std::array<float,2>{0.563966393f, 0.490049958f},
-std::array<float,2>{0.441876084f, 0.956981897f},
-std::array<float,2>{0.726596475f, 0.78339386f},
-std::array<float,2>{0.285913974f, 0.355455071f},
-std::array<float,2>{0.847811162f, 0.112697989f},
-std::array<float,2>{0.127416044f, 0.68656075f},
-std::array<float,2>{0.523487806f, 0.564043283f},
-std::array<float,2>{0.393858999f, 0.149527743f},
-std::array<float,2>{0.98784852f, 0.496790171f},
-std::array<float,2>{0.00608329475f, 0.964962721f},
-std::array<float,2>{0.766496599f, 0.793823481f},
-std::array<float,2>{0.194297493f, 0.343947977f},
-std::array<float,2>{0.634503484f, 0.124602161f},
-std::array<float,2>{0.317580879f, 0.675256193f},
-std::array<float,2>{0.892713249f, 0.741566122f},
-std::array<float,2>{0.0926407203f, 0.0131474379f},
-std::array<float,2>{0.585178614f, 0.286033541f},
-std::array<float,2>{0.464143604f, 0.873639762f},
-std::array<float,2>{0.743804574f, 0.920361578f},
-std::array<float,2>{0.301880091f, 0.430912733f},
-std::array<float,2>{0.866413176f, 0.213184342f},
-std::array<float,2>{0.15173316f, 0.546458483f},
-std::array<float,2>{0.678466201f, 0.655899465f},
-std::array<float,2>{0.351324588f, 0.0883232281f},
-std::array<float,2>{0.806803286f, 0.326389611f},
-std::array<float,2>{0.221809715f, 0.752096713f},
-std::array<float,2>{0.948451102f, 0.978852034f},
-std::array<float,2>{0.0595315695f, 0.449155778f},
-std::array<float,2>{0.557134569f, 0.172664091f},
-std::array<float,2>{0.424907804f, 0.604543328f},
-std::array<float,2>{0.815326333f, 0.511641324f},
-std::array<float,2>{0.157637194f, 0.243998572f},
-std::array<float,2>{0.690805376f, 0.402217418f},
-std::array<float,2>{0.270974755f, 0.887577951f},
-std::array<float,2>{0.609959245f, 0.823521495f},
-std::array<float,2>{0.477436036f, 0.261957675f},
-std::array<float,2>{0.907446325f, 0.0403234288f},
-std::array<float,2>{0.0942759439f, 0.718205273f},
-std::array<float,2>{0.704133391f, 0.557442307f},
-std::array<float,2>{0.259989977f, 0.190088198f},
-std::array<float,2>{0.838463008f, 0.413011223f},
-std::array<float,2>{0.174910739f, 0.935735226f},
-std::array<float,2>{0.929084301f, 0.856111646f},
-std::array<float,2>{0.12372762f, 0.306882322f},
-std::array<float,2>{0.608576357f, 0.0199235287f},
-std::array<float,2>{0.489843726f, 0.725054562f},
-std::array<float,2>{0.783465564f, 0.670529902f},
-std::array<float,2>{0.242018282f, 0.0973594934f},
-std::array<float,2>{0.657604158f, 0.372144431f},
-std::array<float,2>{0.362668097f, 0.79891789f},
-std::array<float,2>{0.541455388f, 0.94627887f},
-std::array<float,2>{0.407651633f, 0.472128808f},
-std::array<float,2>{0.961502075f, 0.129628032f},
-std::array<float,2>{0.0373970158f, 0.589625776f},
-std::array<float,2>{0.567008972f, 0.701011598f},
-std::array<float,2>{0.440240651f, 0.0484604016f},
-std::array<float,2>{0.882639408f, 0.277499527f},
-std::array<float,2>{0.0630423501f, 0.840873718f},
-std::array<float,2>{0.846350968f, 0.900082111f},
-std::array<float,2>{0.132425711f, 0.384051025f},
-std::array<float,2>{0.730972946f, 0.231068611f},
-std::array<float,2>{0.28445369f, 0.530004323f},
-std::array<float,2>{0.983096838f, 0.61333853f},
-std::array<float,2>{0.0297570564f, 0.166621163f},
-std::array<float,2>{0.501820564f, 0.454810023f},
-std::array<float,2>{0.388676167f, 0.998842955f},
-std::array<float,2>{0.641394615f, 0.772678018f},
-std::array<float,2>{0.33428809f, 0.331880122f},
-std::array<float,2>{0.759345472f, 0.0744631439f},
-std::array<float,2>{0.206375927f, 0.626755118f},
-std::array<float,2>{0.598336697f, 0.517454267f},
-std::array<float,2>{0.496246099f, 0.219773605f},
-std::array<float,2>{0.935553968f, 0.381162345f},
-std::array<float,2>{0.115540408f, 0.898043752f},
-std::array<float,2>{0.828803182f, 0.830512047f},
-std::array<float,2>{0.185109809f, 0.268779159f},
-std::array<float,2>{0.715329468f, 0.0611530691f},
-std::array<float,2>{0.256412119f, 0.688247979f},
-std::array<float,2>{0.9605878f, 0.64016974f},
-std::array<float,2>{0.0455742702f, 0.0696256086f},
-std::array<float,2>{0.536944568f, 0.343728721f},
-std::array<float,2>{0.416875064f, 0.776400506f},
-std::array<float,2>{0.666349053f, 0.989340663f},
-std::array<float,2>{0.369645596f, 0.463671595f},
-std::array<float,2>{0.796534002f, 0.160050169f},
-std::array<float,2>{0.243656561f, 0.61898917f},
-std::array<float,2>{0.719409347f, 0.728639424f},
-std::array<float,2>{0.294803709f, 0.0280009881f},
-std::array<float,2>{0.852901876f, 0.297897339f},
-std::array<float,2>{0.139280543f, 0.848857641f},
-std::array<float,2>{0.889564216f, 0.926420093f},
-std::array<float,2>{0.0754238144f, 0.416838139f},
-std::array<float,2>{0.576653838f, 0.198596597f},
-std::array<float,2>{0.451231509f, 0.552089274f},
-std::array<float,2>{0.756935596f, 0.583002985f},
-std::array<float,2>{0.213353559f, 0.1355367f},
-std::array<float,2>{0.652802706f, 0.478999346f},
-std::array<float,2>{0.340669394f, 0.938747406f},
-std::array<float,2>{0.51226449f, 0.811555088f},
-std::array<float,2>{0.382613689f, 0.36302188f},
-std::array<float,2>{0.971136034f, 0.106565729f},
-std::array<float,2>{0.0157886967f, 0.662188113f},
-std::array<float,2>{0.63116622f, 0.59914279f},
-std::array<float,2>{0.324161828f, 0.184926361f},
-std::array<float,2>{0.778485954f, 0.445121586f},
-std::array<float,2>{0.196112081f, 0.972968459f},
-std::array<float,2>{0.992778361f, 0.763007879f},
-std::array<float,2>{0.00981444027f, 0.314227879f},
-std::array<float,2>{0.518438876f, 0.0809284449f},
-std::array<float,2>{0.403506547f, 0.641753137f},
-std::array<float,2>{0.867549539f, 0.709794223f},
-std::array<float,2>{0.1473497f, 0.0377006084f},
-std::array<float,2>{0.74078095f, 0.252270699f},
-std::array<float,2>{0.308282107f, 0.814615369f},
-std::array<float,2>{0.587607265f, 0.877219439f},
-std::array<float,2>{0.460405856f, 0.395246983f},
-std::array<float,2>{0.899837017f, 0.242168739f},
-std::array<float,2>{0.0854643583f, 0.507431805f},
-std::array<float,2>{0.547978878f, 0.683166981f},
-std::array<float,2>{0.435665995f, 0.114618868f},
-std::array<float,2>{0.944853246f, 0.359318316f},
-std::array<float,2>{0.0488800183f, 0.787186205f},
-std::array<float,2>{0.80158931f, 0.957035661f},
-std::array<float,2>{0.23245655f, 0.485522717f},
-std::array<float,2>{0.68052727f, 0.143330336f},
-std::array<float,2>{0.355993688f, 0.575389802f},
-std::array<float,2>{0.915339112f, 0.531954229f},
-std::array<float,2>{0.104852788f, 0.207833469f},
-std::array<float,2>{0.622664213f, 0.424122721f},
-std::array<float,2>{0.473852217f, 0.911650121f},
-std::array<float,2>{0.695645452f, 0.86319828f},
-std::array<float,2>{0.276982874f, 0.289436489f},
-std::array<float,2>{0.820848227f, 0.0032187032f},
-std::array<float,2>{0.171873778f, 0.744185269f},
-std::array<float,2>{0.546313286f, 0.50220114f},
-std::array<float,2>{0.410193175f, 0.236417606f},
-std::array<float,2>{0.966563046f, 0.391670555f},
-std::array<float,2>{0.0322852619f, 0.88187176f},
-std::array<float,2>{0.786269128f, 0.816993535f},
-std::array<float,2>{0.235556036f, 0.25622341f},
-std::array<float,2>{0.660286188f, 0.0336590372f},
-std::array<float,2>{0.365900248f, 0.704046786f},
-std::array<float,2>{0.925516665f, 0.647699118f},
-std::array<float,2>{0.118214041f, 0.084036395f},
-std::array<float,2>{0.603313744f, 0.318958193f},
-std::array<float,2>{0.487405509f, 0.761008024f},
-std::array<float,2>{0.708771288f, 0.972057283f},
-std::array<float,2>{0.264073342f, 0.438848078f},
-std::array<float,2>{0.842962742f, 0.182941899f},
-std::array<float,2>{0.176659375f, 0.597557306f},
-std::array<float,2>{0.648429096f, 0.747368455f},
-std::array<float,2>{0.328519464f, 0.00668919506f},
-std::array<float,2>{0.763168752f, 0.296474755f},
-std::array<float,2>{0.208883747f, 0.865783989f},
-std::array<float,2>{0.977205276f, 0.909747839f},
-std::array<float,2>{0.0251019504f, 0.426760375f},
-std::array<float,2>{0.5072034f, 0.204355061f},
-std::array<float,2>{0.3865861f, 0.538605094f},
-std::array<float,2>{0.848383129f, 0.573031127f},
-std::array<float,2>{0.127779171f, 0.147229582f},
-std::array<float,2>{0.727137744f, 0.491636008f},
-std::array<float,2>{0.285563558f, 0.954907238f},
-std::array<float,2>{0.563883603f, 0.781389713f},
-std::array<float,2>{0.442343771f, 0.353063315f},
-std::array<float,2>{0.878185153f, 0.110025518f},
-std::array<float,2>{0.0696476325f, 0.684591949f},
-std::array<float,2>{0.749391079f, 0.623631477f},
-std::array<float,2>{0.298194498f, 0.16023688f},
-std::array<float,2>{0.860626042f, 0.467921853f},
-std::array<float,2>{0.153192103f, 0.984731078f},
-std::array<float,2>{0.896072984f, 0.778416932f},
-std::array<float,2>{0.0881706551f, 0.337846756f},
-std::array<float,2>{0.581088245f, 0.0656460598f},
-std::array<float,2>{0.468436837f, 0.63291055f},
-std::array<float,2>{0.770980775f, 0.695049226f},
-std::array<float,2>{0.1909073f, 0.0559176356f},
-std::array<float,2>{0.63709265f, 0.269649178f},
-std::array<float,2>{0.313499421f, 0.832429767f},
-std::array<float,2>{0.528103232f, 0.890882671f},
-std::array<float,2>{0.396214843f, 0.377592742f},
-std::array<float,2>{0.991573155f, 0.223300084f},
-std::array<float,2>{0.00379090128f, 0.521211267f},
-std::array<float,2>{0.616517305f, 0.656398416f},
-std::array<float,2>{0.483421773f, 0.10405235f},
-std::array<float,2>{0.912512362f, 0.36443761f},
-std::array<float,2>{0.101405196f, 0.804779172f},
-std::array<float,2>{0.817382932f, 0.941921711f},
-std::array<float,2>{0.160795748f, 0.482021391f},
-std::array<float,2>{0.69383651f, 0.139504418f},
-std::array<float,2>{0.267874867f, 0.580550492f},
-std::array<float,2>{0.953113377f, 0.550576746f},
-std::array<float,2>{0.0551176853f, 0.203088284f},
-std::array<float,2>{0.561800897f, 0.421083003f},
-std::array<float,2>{0.428770959f, 0.925487757f},
-std::array<float,2>{0.675347984f, 0.847545743f},
-std::array<float,2>{0.347434342f, 0.302227199f},
-std::array<float,2>{0.808662236f, 0.0263582375f},
-std::array<float,2>{0.223278195f, 0.731884837f},
-std::array<float,2>{0.59178859f, 0.592080474f},
-std::array<float,2>{0.45343399f, 0.128214449f},
-std::array<float,2>{0.903911531f, 0.474525601f},
-std::array<float,2>{0.0820272937f, 0.949576378f},
-std::array<float,2>{0.874476135f, 0.804231167f},
-std::array<float,2>{0.141139507f, 0.369286299f},
-std::array<float,2>{0.737531364f, 0.0984067172f},
-std::array<float,2>{0.309898794f, 0.66730386f},
-std::array<float,2>{0.998048186f, 0.721963763f},
-std::array<float,2>{0.0133846104f, 0.0171037558f},
-std::array<float,2>{0.522579789f, 0.31233272f},
-std::array<float,2>{0.398896992f, 0.852858007f},
-std::array<float,2>{0.62888211f, 0.929959238f},
-std::array<float,2>{0.326599836f, 0.40912348f},
-std::array<float,2>{0.77485919f, 0.195284963f},
-std::array<float,2>{0.199372962f, 0.560582936f},
-std::array<float,2>{0.700164497f, 0.632350564f},
-std::array<float,2>{0.281234115f, 0.0722665712f},
-std::array<float,2>{0.827487588f, 0.335074842f},
-std::array<float,2>{0.166266516f, 0.769321442f},
-std::array<float,2>{0.918349683f, 0.992393434f},
-std::array<float,2>{0.106164038f, 0.460780293f},
-std::array<float,2>{0.61839658f, 0.168563217f},
-std::array<float,2>{0.471216023f, 0.609644234f},
-std::array<float,2>{0.798157752f, 0.524284422f},
-std::array<float,2>{0.227030754f, 0.22663185f},
-std::array<float,2>{0.687315345f, 0.388538301f},
-std::array<float,2>{0.353639364f, 0.905785143f},
-std::array<float,2>{0.551582575f, 0.839687407f},
-std::array<float,2>{0.431101352f, 0.275381416f},
-std::array<float,2>{0.939150214f, 0.0514662005f},
-std::array<float,2>{0.0533056855f, 0.695599496f},
-std::array<float,2>{0.671806872f, 0.542133868f},
-std::array<float,2>{0.3712897f, 0.21692048f},
-std::array<float,2>{0.791769981f, 0.43632561f},
-std::array<float,2>{0.246319667f, 0.917894423f},
-std::array<float,2>{0.955796838f, 0.870947242f},
-std::array<float,2>{0.0400492102f, 0.28140673f},
-std::array<float,2>{0.533240199f, 0.0115306638f},
-std::array<float,2>{0.418665051f, 0.736389458f},
-std::array<float,2>{0.834481359f, 0.679484487f},
-std::array<float,2>{0.180655614f, 0.119302407f},
-std::array<float,2>{0.712269545f, 0.348988712f},
-std::array<float,2>{0.250149697f, 0.789587975f},
-std::array<float,2>{0.59398675f, 0.961448729f},
-std::array<float,2>{0.495312959f, 0.494919926f},
-std::array<float,2>{0.930883527f, 0.1554133f},
-std::array<float,2>{0.110698633f, 0.568913162f},
-std::array<float,2>{0.510959685f, 0.712909937f},
-std::array<float,2>{0.378765106f, 0.0449938029f},
-std::array<float,2>{0.97371316f, 0.261221945f},
-std::array<float,2>{0.0211541131f, 0.82559371f},
-std::array<float,2>{0.752695978f, 0.885776758f},
-std::array<float,2>{0.216338262f, 0.402671844f},
-std::array<float,2>{0.649742842f, 0.249964312f},
-std::array<float,2>{0.338550091f, 0.514493823f},
-std::array<float,2>{0.885987699f, 0.608445108f},
-std::array<float,2>{0.0713789463f, 0.178416654f},
-std::array<float,2>{0.572989464f, 0.452867061f},
-std::array<float,2>{0.445372283f, 0.981311619f},
-std::array<float,2>{0.723917425f, 0.757573783f},
-std::array<float,2>{0.292774796f, 0.323995501f},
-std::array<float,2>{0.855937362f, 0.0904042125f},
-std::array<float,2>{0.135945484f, 0.651854396f},
-std::array<float,2>{0.517691553f, 0.599729359f},
-std::array<float,2>{0.403945535f, 0.185610458f},
-std::array<float,2>{0.992671013f, 0.442400217f},
-std::array<float,2>{0.0104874196f, 0.974930525f},
-std::array<float,2>{0.77907145f, 0.765222847f},
-std::array<float,2>{0.195399493f, 0.316309541f},
-std::array<float,2>{0.631466091f, 0.0796070099f},
-std::array<float,2>{0.323312104f, 0.644065261f},
-std::array<float,2>{0.900371909f, 0.707703233f},
-std::array<float,2>{0.0851271152f, 0.0370573103f},
-std::array<float,2>{0.587043583f, 0.250697374f},
-std::array<float,2>{0.460730314f, 0.813509703f},
-std::array<float,2>{0.740668476f, 0.87531352f},
-std::array<float,2>{0.30766812f, 0.397750258f},
-std::array<float,2>{0.868121922f, 0.24010855f},
-std::array<float,2>{0.146832004f, 0.50488025f},
-std::array<float,2>{0.680149376f, 0.680244684f},
-std::array<float,2>{0.355677187f, 0.117154449f},
-std::array<float,2>{0.801027775f, 0.356186509f},
-std::array<float,2>{0.233389258f, 0.786105454f},
-std::array<float,2>{0.944455385f, 0.960520506f},
-std::array<float,2>{0.0493678786f, 0.487461358f},
-std::array<float,2>{0.54857254f, 0.142576426f},
-std::array<float,2>{0.436315238f, 0.577453077f},
-std::array<float,2>{0.82049191f, 0.534051538f},
-std::array<float,2>{0.171081766f, 0.209739462f},
-std::array<float,2>{0.696086943f, 0.422216386f},
-std::array<float,2>{0.276624471f, 0.913099647f},
-std::array<float,2>{0.622487068f, 0.860449612f},
-std::array<float,2>{0.474376112f, 0.292886466f},
-std::array<float,2>{0.915625811f, 0.000432891451f},
-std::array<float,2>{0.105111249f, 0.743266225f},
-std::array<float,2>{0.715689003f, 0.517684758f},
-std::array<float,2>{0.256164849f, 0.222114667f},
-std::array<float,2>{0.828440547f, 0.379561573f},
-std::array<float,2>{0.184633479f, 0.895217001f},
-std::array<float,2>{0.936523378f, 0.829062343f},
-std::array<float,2>{0.115728445f, 0.266258478f},
-std::array<float,2>{0.598134875f, 0.0602848642f},
-std::array<float,2>{0.496682495f, 0.691353917f},
-std::array<float,2>{0.796150208f, 0.638304651f},
-std::array<float,2>{0.243273601f, 0.0683430359f},
-std::array<float,2>{0.666519582f, 0.341607541f},
-std::array<float,2>{0.369425535f, 0.774946272f},
-std::array<float,2>{0.536250412f, 0.991911173f},
-std::array<float,2>{0.416403741f, 0.46101281f},
-std::array<float,2>{0.960369766f, 0.156394541f},
-std::array<float,2>{0.0451961271f, 0.620946229f},
-std::array<float,2>{0.576776624f, 0.727094531f},
-std::array<float,2>{0.451895237f, 0.0302965026f},
-std::array<float,2>{0.889003575f, 0.299281478f},
-std::array<float,2>{0.0759526119f, 0.851093113f},
-std::array<float,2>{0.853447974f, 0.928827465f},
-std::array<float,2>{0.138721615f, 0.415362209f},
-std::array<float,2>{0.719030738f, 0.196031839f},
-std::array<float,2>{0.29395023f, 0.554580569f},
-std::array<float,2>{0.971340537f, 0.584658086f},
-std::array<float,2>{0.0164392199f, 0.134704396f},
-std::array<float,2>{0.512176454f, 0.477908105f},
-std::array<float,2>{0.381983668f, 0.940981269f},
-std::array<float,2>{0.653123856f, 0.809075058f},
-std::array<float,2>{0.339857072f, 0.359933227f},
-std::array<float,2>{0.757800579f, 0.109300591f},
-std::array<float,2>{0.213728711f, 0.660992026f},
-std::array<float,2>{0.609173715f, 0.554803073f},
-std::array<float,2>{0.489279807f, 0.189361259f},
-std::array<float,2>{0.929619551f, 0.410675913f},
-std::array<float,2>{0.123100698f, 0.934169233f},
-std::array<float,2>{0.838102162f, 0.859037101f},
-std::array<float,2>{0.175340354f, 0.30608952f},
-std::array<float,2>{0.704838216f, 0.0216296259f},
-std::array<float,2>{0.260271758f, 0.724196911f},
-std::array<float,2>{0.96126765f, 0.66873461f},
-std::array<float,2>{0.0379331447f, 0.0946478397f},
-std::array<float,2>{0.541526437f, 0.373098493f},
-std::array<float,2>{0.408126801f, 0.797811151f},
-std::array<float,2>{0.657806218f, 0.948441803f},
-std::array<float,2>{0.363098562f, 0.468905449f},
-std::array<float,2>{0.783948183f, 0.132571161f},
-std::array<float,2>{0.241578698f, 0.586242318f},
-std::array<float,2>{0.730531096f, 0.702728748f},
-std::array<float,2>{0.2846753f, 0.0492395535f},
-std::array<float,2>{0.846114337f, 0.280333102f},
-std::array<float,2>{0.131888598f, 0.843261421f},
-std::array<float,2>{0.882062793f, 0.901820898f},
-std::array<float,2>{0.0628884509f, 0.385478407f},
-std::array<float,2>{0.566823244f, 0.234187678f},
-std::array<float,2>{0.439826131f, 0.528717101f},
-std::array<float,2>{0.758930743f, 0.616940141f},
-std::array<float,2>{0.206641927f, 0.164331704f},
-std::array<float,2>{0.641068161f, 0.455151469f},
-std::array<float,2>{0.334945053f, 0.996432483f},
-std::array<float,2>{0.50112021f, 0.770096838f},
-std::array<float,2>{0.389422327f, 0.329344332f},
-std::array<float,2>{0.982730687f, 0.0775909796f},
-std::array<float,2>{0.0298926551f, 0.627822518f},
-std::array<float,2>{0.63410598f, 0.565011561f},
-std::array<float,2>{0.317978889f, 0.15215005f},
-std::array<float,2>{0.765860379f, 0.499689788f},
-std::array<float,2>{0.193645343f, 0.966998935f},
-std::array<float,2>{0.987726927f, 0.794965088f},
-std::array<float,2>{0.00647055358f, 0.346979171f},
-std::array<float,2>{0.524138451f, 0.121115819f},
-std::array<float,2>{0.394060075f, 0.671969414f},
-std::array<float,2>{0.866912007f, 0.738580346f},
-std::array<float,2>{0.152300134f, 0.0153411413f},
-std::array<float,2>{0.743492246f, 0.288180888f},
-std::array<float,2>{0.30239892f, 0.872529685f},
-std::array<float,2>{0.585729241f, 0.919915915f},
-std::array<float,2>{0.464698315f, 0.431799948f},
-std::array<float,2>{0.893329024f, 0.212790579f},
-std::array<float,2>{0.0921006948f, 0.544561446f},
-std::array<float,2>{0.55701071f, 0.652874053f},
-std::array<float,2>{0.425724864f, 0.086364843f},
-std::array<float,2>{0.948835194f, 0.325531632f},
-std::array<float,2>{0.059000589f, 0.750707388f},
-std::array<float,2>{0.80723536f, 0.978288233f},
-std::array<float,2>{0.222655237f, 0.44637394f},
-std::array<float,2>{0.677976489f, 0.174786881f},
-std::array<float,2>{0.350937009f, 0.601735353f},
-std::array<float,2>{0.908164024f, 0.509587049f},
-std::array<float,2>{0.0940795541f, 0.244385242f},
-std::array<float,2>{0.609405458f, 0.40002951f},
-std::array<float,2>{0.476689011f, 0.890294552f},
-std::array<float,2>{0.690969646f, 0.820913017f},
-std::array<float,2>{0.271214187f, 0.264758289f},
-std::array<float,2>{0.814822376f, 0.0410652086f},
-std::array<float,2>{0.158098593f, 0.716755688f},
-std::array<float,2>{0.505441725f, 0.537050188f},
-std::array<float,2>{0.383579403f, 0.206665695f},
-std::array<float,2>{0.979740262f, 0.429328173f},
-std::array<float,2>{0.0264262576f, 0.906658649f},
-std::array<float,2>{0.763742387f, 0.865053892f},
-std::array<float,2>{0.20967795f, 0.29365322f},
-std::array<float,2>{0.645369291f, 0.00559585867f},
-std::array<float,2>{0.330731809f, 0.748671651f},
-std::array<float,2>{0.876680076f, 0.687124848f},
-std::array<float,2>{0.0668055043f, 0.113227546f},
-std::array<float,2>{0.564534545f, 0.354719251f},
-std::array<float,2>{0.445306629f, 0.783741772f},
-std::array<float,2>{0.72875762f, 0.956134975f},
-std::array<float,2>{0.287168026f, 0.489510447f},
-std::array<float,2>{0.849660099f, 0.14546673f},
-std::array<float,2>{0.125966936f, 0.571250498f},
-std::array<float,2>{0.662759542f, 0.706592917f},
-std::array<float,2>{0.36402747f, 0.0316525623f},
-std::array<float,2>{0.789051473f, 0.254697353f},
-std::array<float,2>{0.238197535f, 0.820267737f},
-std::array<float,2>{0.967917085f, 0.879132807f},
-std::array<float,2>{0.0338749141f, 0.394451618f},
-std::array<float,2>{0.544072568f, 0.235525876f},
-std::array<float,2>{0.412544787f, 0.501872241f},
-std::array<float,2>{0.8414675f, 0.595500767f},
-std::array<float,2>{0.17788136f, 0.180961803f},
-std::array<float,2>{0.709715843f, 0.439918458f},
-std::array<float,2>{0.262630135f, 0.970108449f},
-std::array<float,2>{0.604826808f, 0.759292543f},
-std::array<float,2>{0.485900611f, 0.316858917f},
-std::array<float,2>{0.922405303f, 0.082635954f},
-std::array<float,2>{0.119661324f, 0.645687282f},
-std::array<float,2>{0.691762626f, 0.578351021f},
-std::array<float,2>{0.26611051f, 0.137793511f},
-std::array<float,2>{0.818871558f, 0.482793719f},
-std::array<float,2>{0.162778825f, 0.945153415f},
-std::array<float,2>{0.91087836f, 0.806826353f},
-std::array<float,2>{0.0981182307f, 0.366195112f},
-std::array<float,2>{0.613439143f, 0.101630531f},
-std::array<float,2>{0.480648518f, 0.658399582f},
-std::array<float,2>{0.811958611f, 0.734335005f},
-std::array<float,2>{0.225543782f, 0.0238786973f},
-std::array<float,2>{0.672537982f, 0.304576308f},
-std::array<float,2>{0.345605612f, 0.845629692f},
-std::array<float,2>{0.559756935f, 0.92355305f},
-std::array<float,2>{0.426567614f, 0.419609815f},
-std::array<float,2>{0.950561047f, 0.19924587f},
-std::array<float,2>{0.0579181127f, 0.548227966f},
-std::array<float,2>{0.579968095f, 0.636245012f},
-std::array<float,2>{0.465077251f, 0.0631819516f},
-std::array<float,2>{0.89835602f, 0.338144034f},
-std::array<float,2>{0.0868711025f, 0.780894279f},
-std::array<float,2>{0.861566961f, 0.987725496f},
-std::array<float,2>{0.155453682f, 0.466301501f},
-std::array<float,2>{0.74756515f, 0.163274184f},
-std::array<float,2>{0.300458401f, 0.622455895f},
-std::array<float,2>{0.988464653f, 0.522509158f},
-std::array<float,2>{0.000462928932f, 0.226288781f},
-std::array<float,2>{0.530893624f, 0.375878364f},
-std::array<float,2>{0.398120165f, 0.894158363f},
-std::array<float,2>{0.638680696f, 0.835057437f},
-std::array<float,2>{0.314454049f, 0.271992892f},
-std::array<float,2>{0.772613406f, 0.0575218759f},
-std::array<float,2>{0.18908383f, 0.692368209f},
-std::array<float,2>{0.619588912f, 0.611632824f},
-std::array<float,2>{0.470377147f, 0.17010887f},
-std::array<float,2>{0.920859039f, 0.458623916f},
-std::array<float,2>{0.108113199f, 0.995199978f},
-std::array<float,2>{0.825541139f, 0.766945302f},
-std::array<float,2>{0.164573833f, 0.332837284f},
-std::array<float,2>{0.702567935f, 0.071210064f},
-std::array<float,2>{0.278879106f, 0.630407512f},
-std::array<float,2>{0.939807415f, 0.697825432f},
-std::array<float,2>{0.0524766743f, 0.0528109744f},
-std::array<float,2>{0.552814603f, 0.276906967f},
-std::array<float,2>{0.433093905f, 0.837772071f},
-std::array<float,2>{0.685501873f, 0.903955996f},
-std::array<float,2>{0.352964461f, 0.388844073f},
-std::array<float,2>{0.798895359f, 0.228812352f},
-std::array<float,2>{0.230184972f, 0.526471078f},
-std::array<float,2>{0.734913886f, 0.664877653f},
-std::array<float,2>{0.311705679f, 0.100838326f},
-std::array<float,2>{0.87135607f, 0.368253142f},
-std::array<float,2>{0.143268213f, 0.802377224f},
-std::array<float,2>{0.906219304f, 0.953065455f},
-std::array<float,2>{0.0784320161f, 0.474777162f},
-std::array<float,2>{0.593496442f, 0.126263082f},
-std::array<float,2>{0.455138028f, 0.591049373f},
-std::array<float,2>{0.776967347f, 0.560324371f},
-std::array<float,2>{0.202579141f, 0.191575736f},
-std::array<float,2>{0.626932144f, 0.407822549f},
-std::array<float,2>{0.324831903f, 0.933201373f},
-std::array<float,2>{0.521198869f, 0.854992092f},
-std::array<float,2>{0.402084291f, 0.309369564f},
-std::array<float,2>{0.997732043f, 0.0180502683f},
-std::array<float,2>{0.0140256267f, 0.719319999f},
-std::array<float,2>{0.650997221f, 0.511962295f},
-std::array<float,2>{0.337176234f, 0.24640061f},
-std::array<float,2>{0.751876235f, 0.405948818f},
-std::array<float,2>{0.218218043f, 0.883533955f},
-std::array<float,2>{0.975285292f, 0.827785254f},
-std::array<float,2>{0.0230026711f, 0.258499146f},
-std::array<float,2>{0.508471727f, 0.0430538692f},
-std::array<float,2>{0.375881642f, 0.71164614f},
-std::array<float,2>{0.857441068f, 0.649857104f},
-std::array<float,2>{0.134053767f, 0.0922746509f},
-std::array<float,2>{0.725835085f, 0.321021557f},
-std::array<float,2>{0.290539533f, 0.754619718f},
-std::array<float,2>{0.570533276f, 0.983502746f},
-std::array<float,2>{0.44821161f, 0.450931102f},
-std::array<float,2>{0.884678781f, 0.177592352f},
-std::array<float,2>{0.0735077038f, 0.605845511f},
-std::array<float,2>{0.532255769f, 0.735465527f},
-std::array<float,2>{0.421466321f, 0.00791570731f},
-std::array<float,2>{0.954973578f, 0.284402758f},
-std::array<float,2>{0.042809803f, 0.868915081f},
-std::array<float,2>{0.790232718f, 0.915707886f},
-std::array<float,2>{0.248288557f, 0.435274869f},
-std::array<float,2>{0.667983472f, 0.214896888f},
-std::array<float,2>{0.373957485f, 0.540262341f},
-std::array<float,2>{0.933514357f, 0.567368746f},
-std::array<float,2>{0.113113396f, 0.15315111f},
-std::array<float,2>{0.596482158f, 0.494066149f},
-std::array<float,2>{0.492355585f, 0.964693725f},
-std::array<float,2>{0.713467598f, 0.791107774f},
-std::array<float,2>{0.253318518f, 0.349645972f},
-std::array<float,2>{0.833641887f, 0.118340209f},
-std::array<float,2>{0.182790607f, 0.676104903f},
-std::array<float,2>{0.550347269f, 0.576048732f},
-std::array<float,2>{0.435516208f, 0.142890409f},
-std::array<float,2>{0.942915022f, 0.485902041f},
-std::array<float,2>{0.0476856492f, 0.957684457f},
-std::array<float,2>{0.803302705f, 0.787830472f},
-std::array<float,2>{0.232412606f, 0.358868539f},
-std::array<float,2>{0.683474481f, 0.11476852f},
-std::array<float,2>{0.359149009f, 0.683010817f},
-std::array<float,2>{0.916449487f, 0.74494648f},
-std::array<float,2>{0.101914905f, 0.00362647232f},
-std::array<float,2>{0.623804808f, 0.289823204f},
-std::array<float,2>{0.476009488f, 0.862462223f},
-std::array<float,2>{0.69815886f, 0.911345601f},
-std::array<float,2>{0.274657667f, 0.424410582f},
-std::array<float,2>{0.823562086f, 0.207279816f},
-std::array<float,2>{0.169368535f, 0.53134042f},
-std::array<float,2>{0.629702568f, 0.642502844f},
-std::array<float,2>{0.321958363f, 0.0801820979f},
-std::array<float,2>{0.780474424f, 0.313635498f},
-std::array<float,2>{0.198182374f, 0.763292313f},
-std::array<float,2>{0.995390832f, 0.973399103f},
-std::array<float,2>{0.00859838817f, 0.444481552f},
-std::array<float,2>{0.51696974f, 0.18548356f},
-std::array<float,2>{0.405148745f, 0.598923028f},
-std::array<float,2>{0.870842993f, 0.507179797f},
-std::array<float,2>{0.14476642f, 0.24148342f},
-std::array<float,2>{0.739564538f, 0.394704968f},
-std::array<float,2>{0.305459321f, 0.877677143f},
-std::array<float,2>{0.588886499f, 0.815130591f},
-std::array<float,2>{0.457348317f, 0.252924532f},
-std::array<float,2>{0.901532471f, 0.0373839699f},
-std::array<float,2>{0.0825079307f, 0.709291756f},
-std::array<float,2>{0.722563684f, 0.552542567f},
-std::array<float,2>{0.29501918f, 0.198859021f},
-std::array<float,2>{0.855211973f, 0.416128695f},
-std::array<float,2>{0.138268933f, 0.92605859f},
-std::array<float,2>{0.887520254f, 0.849313319f},
-std::array<float,2>{0.0773576498f, 0.29868722f},
-std::array<float,2>{0.575462103f, 0.0278231204f},
-std::array<float,2>{0.450160265f, 0.7290169f},
-std::array<float,2>{0.755378425f, 0.66297859f},
-std::array<float,2>{0.212638736f, 0.107206471f},
-std::array<float,2>{0.655673742f, 0.362372518f},
-std::array<float,2>{0.343672723f, 0.812387347f},
-std::array<float,2>{0.514715135f, 0.939323366f},
-std::array<float,2>{0.379504979f, 0.479395837f},
-std::array<float,2>{0.969591558f, 0.135110155f},
-std::array<float,2>{0.0176842138f, 0.582196712f},
-std::array<float,2>{0.600656688f, 0.687772512f},
-std::array<float,2>{0.49988544f, 0.0609379001f},
-std::array<float,2>{0.934827924f, 0.269090831f},
-std::array<float,2>{0.114674307f, 0.830728352f},
-std::array<float,2>{0.830202639f, 0.897575557f},
-std::array<float,2>{0.186896041f, 0.381728172f},
-std::array<float,2>{0.717504442f, 0.220245406f},
-std::array<float,2>{0.254573435f, 0.516765058f},
-std::array<float,2>{0.958335161f, 0.618190944f},
-std::array<float,2>{0.0435347073f, 0.159474209f},
-std::array<float,2>{0.53858906f, 0.462970257f},
-std::array<float,2>{0.41406557f, 0.990206778f},
-std::array<float,2>{0.664772511f, 0.777236879f},
-std::array<float,2>{0.36832422f, 0.342877656f},
-std::array<float,2>{0.794042826f, 0.0701434687f},
-std::array<float,2>{0.245651335f, 0.639733076f},
-std::array<float,2>{0.569950283f, 0.529487193f},
-std::array<float,2>{0.437926918f, 0.230529934f},
-std::array<float,2>{0.879655719f, 0.384560168f},
-std::array<float,2>{0.0657072514f, 0.899615884f},
-std::array<float,2>{0.844324052f, 0.841317773f},
-std::array<float,2>{0.12995261f, 0.278220713f},
-std::array<float,2>{0.733275712f, 0.0478927419f},
-std::array<float,2>{0.281876951f, 0.700317204f},
-std::array<float,2>{0.980884731f, 0.626390576f},
-std::array<float,2>{0.0291517507f, 0.0749089941f},
-std::array<float,2>{0.503284276f, 0.331472874f},
-std::array<float,2>{0.388279676f, 0.773360074f},
-std::array<float,2>{0.64329803f, 0.998340607f},
-std::array<float,2>{0.333280683f, 0.454267591f},
-std::array<float,2>{0.760235727f, 0.166211858f},
-std::array<float,2>{0.203482285f, 0.613984466f},
-std::array<float,2>{0.706005096f, 0.725133955f},
-std::array<float,2>{0.258197844f, 0.0203253534f},
-std::array<float,2>{0.836182475f, 0.307469755f},
-std::array<float,2>{0.172265604f, 0.855931342f},
-std::array<float,2>{0.927082002f, 0.936303496f},
-std::array<float,2>{0.122158907f, 0.412110329f},
-std::array<float,2>{0.607165575f, 0.189880446f},
-std::array<float,2>{0.491814047f, 0.557105005f},
-std::array<float,2>{0.783144236f, 0.589062572f},
-std::array<float,2>{0.240093529f, 0.129113644f},
-std::array<float,2>{0.659703374f, 0.47238487f},
-std::array<float,2>{0.359535575f, 0.945664942f},
-std::array<float,2>{0.540111482f, 0.799522996f},
-std::array<float,2>{0.409464419f, 0.372753441f},
-std::array<float,2>{0.964748025f, 0.0971477255f},
-std::array<float,2>{0.0358245708f, 0.67016685f},
-std::array<float,2>{0.677175105f, 0.605304062f},
-std::array<float,2>{0.348736942f, 0.172142789f},
-std::array<float,2>{0.806206763f, 0.448383361f},
-std::array<float,2>{0.220686331f, 0.979376316f},
-std::array<float,2>{0.946401298f, 0.752890229f},
-std::array<float,2>{0.0608769841f, 0.326984942f},
-std::array<float,2>{0.555861652f, 0.0888540968f},
-std::array<float,2>{0.422688723f, 0.655556738f},
-std::array<float,2>{0.813949049f, 0.718682945f},
-std::array<float,2>{0.159652427f, 0.040799804f},
-std::array<float,2>{0.688542783f, 0.262307346f},
-std::array<float,2>{0.272556692f, 0.823742867f},
-std::array<float,2>{0.612497568f, 0.886788905f},
-std::array<float,2>{0.479651839f, 0.401385903f},
-std::array<float,2>{0.909160018f, 0.243249297f},
-std::array<float,2>{0.0971205011f, 0.511171877f},
-std::array<float,2>{0.526430428f, 0.675519884f},
-std::array<float,2>{0.391253144f, 0.124446832f},
-std::array<float,2>{0.986165941f, 0.344461679f},
-std::array<float,2>{0.00460130582f, 0.793150783f},
-std::array<float,2>{0.76930207f, 0.965735674f},
-std::array<float,2>{0.19310458f, 0.49630928f},
-std::array<float,2>{0.635448575f, 0.150059789f},
-std::array<float,2>{0.319160968f, 0.563618481f},
-std::array<float,2>{0.892522991f, 0.546149015f},
-std::array<float,2>{0.0912018716f, 0.213724136f},
-std::array<float,2>{0.582358181f, 0.431570619f},
-std::array<float,2>{0.46213755f, 0.920510232f},
-std::array<float,2>{0.745597661f, 0.873220444f},
-std::array<float,2>{0.30464226f, 0.285240561f},
-std::array<float,2>{0.863569856f, 0.0133670717f},
-std::array<float,2>{0.148800969f, 0.741821945f},
-std::array<float,2>{0.529795229f, 0.519988f},
-std::array<float,2>{0.396692008f, 0.224056408f},
-std::array<float,2>{0.990141988f, 0.377995461f},
-std::array<float,2>{0.00166806183f, 0.892164052f},
-std::array<float,2>{0.772289038f, 0.833475649f},
-std::array<float,2>{0.18762669f, 0.270826489f},
-std::array<float,2>{0.639912128f, 0.0551910512f},
-std::array<float,2>{0.315944582f, 0.694299459f},
-std::array<float,2>{0.896502137f, 0.634631753f},
-std::array<float,2>{0.0870528221f, 0.0651549846f},
-std::array<float,2>{0.578990757f, 0.336428285f},
-std::array<float,2>{0.465948522f, 0.777944684f},
-std::array<float,2>{0.746619999f, 0.985512018f},
-std::array<float,2>{0.299597025f, 0.46685341f},
-std::array<float,2>{0.862814844f, 0.161663815f},
-std::array<float,2>{0.154616833f, 0.624400854f},
-std::array<float,2>{0.673349202f, 0.731436491f},
-std::array<float,2>{0.34401983f, 0.0264611039f},
-std::array<float,2>{0.810821831f, 0.301037908f},
-std::array<float,2>{0.226255953f, 0.84656328f},
-std::array<float,2>{0.949276328f, 0.924690783f},
-std::array<float,2>{0.0568332374f, 0.42086193f},
-std::array<float,2>{0.558748305f, 0.201275304f},
-std::array<float,2>{0.427282333f, 0.549094379f},
-std::array<float,2>{0.819781721f, 0.581068337f},
-std::array<float,2>{0.163308308f, 0.140427291f},
-std::array<float,2>{0.692678571f, 0.481186569f},
-std::array<float,2>{0.26733169f, 0.943227291f},
-std::array<float,2>{0.614908099f, 0.806487203f},
-std::array<float,2>{0.482177407f, 0.363310456f},
-std::array<float,2>{0.911661983f, 0.105111547f},
-std::array<float,2>{0.0994841009f, 0.658024907f},
-std::array<float,2>{0.710263073f, 0.596191466f},
-std::array<float,2>{0.263020188f, 0.181754142f},
-std::array<float,2>{0.840656102f, 0.437618166f},
-std::array<float,2>{0.179548338f, 0.971351266f},
-std::array<float,2>{0.923084438f, 0.760682285f},
-std::array<float,2>{0.12077269f, 0.320153296f},
-std::array<float,2>{0.603778362f, 0.0855139643f},
-std::array<float,2>{0.484897882f, 0.647382736f},
-std::array<float,2>{0.787438631f, 0.704621077f},
-std::array<float,2>{0.237196475f, 0.0342951827f},
-std::array<float,2>{0.663283169f, 0.257233977f},
-std::array<float,2>{0.364760846f, 0.81812501f},
-std::array<float,2>{0.543317616f, 0.881004095f},
-std::array<float,2>{0.413309395f, 0.391361684f},
-std::array<float,2>{0.967299044f, 0.237379447f},
-std::array<float,2>{0.0349878259f, 0.50316447f},
-std::array<float,2>{0.566266537f, 0.68409735f},
-std::array<float,2>{0.443726778f, 0.110899456f},
-std::array<float,2>{0.87532419f, 0.352327824f},
-std::array<float,2>{0.0682671294f, 0.782351315f},
-std::array<float,2>{0.851324975f, 0.953851461f},
-std::array<float,2>{0.126046151f, 0.490845174f},
-std::array<float,2>{0.730431736f, 0.147986054f},
-std::array<float,2>{0.288174689f, 0.573940158f},
-std::array<float,2>{0.978583455f, 0.538047433f},
-std::array<float,2>{0.0256453939f, 0.203688145f},
-std::array<float,2>{0.504589438f, 0.426566035f},
-std::array<float,2>{0.384204119f, 0.909167826f},
-std::array<float,2>{0.646001577f, 0.866446733f},
-std::array<float,2>{0.331596315f, 0.295051217f},
-std::array<float,2>{0.765412092f, 0.00740104541f},
-std::array<float,2>{0.210935757f, 0.74676615f},
-std::array<float,2>{0.597407341f, 0.570248723f},
-std::array<float,2>{0.493924737f, 0.154749677f},
-std::array<float,2>{0.931933045f, 0.49512893f},
-std::array<float,2>{0.111614533f, 0.962186396f},
-std::array<float,2>{0.832075417f, 0.790380836f},
-std::array<float,2>{0.182601243f, 0.348318696f},
-std::array<float,2>{0.714816034f, 0.120731689f},
-std::array<float,2>{0.252688438f, 0.678686619f},
-std::array<float,2>{0.953534722f, 0.737444758f},
-std::array<float,2>{0.0418244116f, 0.00991954189f},
-std::array<float,2>{0.531980097f, 0.282387465f},
-std::array<float,2>{0.420767903f, 0.869253755f},
-std::array<float,2>{0.669037938f, 0.916517854f},
-std::array<float,2>{0.374233663f, 0.437108129f},
-std::array<float,2>{0.789687097f, 0.218142569f},
-std::array<float,2>{0.249628618f, 0.541607857f},
-std::array<float,2>{0.725031257f, 0.650789022f},
-std::array<float,2>{0.289139479f, 0.0915102363f},
-std::array<float,2>{0.85868609f, 0.322444201f},
-std::array<float,2>{0.133753002f, 0.756139815f},
-std::array<float,2>{0.882841885f, 0.981889367f},
-std::array<float,2>{0.0729297549f, 0.451326996f},
-std::array<float,2>{0.571975172f, 0.179267257f},
-std::array<float,2>{0.448328197f, 0.608001351f},
-std::array<float,2>{0.750921667f, 0.51533711f},
-std::array<float,2>{0.217536077f, 0.248351857f},
-std::array<float,2>{0.652143955f, 0.403526813f},
-std::array<float,2>{0.336730301f, 0.885516167f},
-std::array<float,2>{0.509265006f, 0.82426697f},
-std::array<float,2>{0.376410156f, 0.260537684f},
-std::array<float,2>{0.976388395f, 0.0467044935f},
-std::array<float,2>{0.0215871651f, 0.714410186f},
-std::array<float,2>{0.625399649f, 0.562384903f},
-std::array<float,2>{0.325474024f, 0.19396244f},
-std::array<float,2>{0.775777221f, 0.410040885f},
-std::array<float,2>{0.201563194f, 0.930703342f},
-std::array<float,2>{0.996983051f, 0.852218509f},
-std::array<float,2>{0.0150606893f, 0.310709596f},
-std::array<float,2>{0.520467877f, 0.0159294326f},
-std::array<float,2>{0.401239157f, 0.721085906f},
-std::array<float,2>{0.872799456f, 0.666216552f},
-std::array<float,2>{0.143721879f, 0.0995453f},
-std::array<float,2>{0.735778093f, 0.370226175f},
-std::array<float,2>{0.310912818f, 0.803449035f},
-std::array<float,2>{0.592529237f, 0.950886905f},
-std::array<float,2>{0.456586212f, 0.473541498f},
-std::array<float,2>{0.904374778f, 0.127802908f},
-std::array<float,2>{0.0799486563f, 0.593214989f},
-std::array<float,2>{0.554670811f, 0.696365893f},
-std::array<float,2>{0.431966275f, 0.0518108495f},
-std::array<float,2>{0.940647066f, 0.274368852f},
-std::array<float,2>{0.0508230701f, 0.838606954f},
-std::array<float,2>{0.800251186f, 0.905059576f},
-std::array<float,2>{0.228537664f, 0.386945754f},
-std::array<float,2>{0.684491217f, 0.228196532f},
-std::array<float,2>{0.352089882f, 0.525226474f},
-std::array<float,2>{0.921055496f, 0.610658109f},
-std::array<float,2>{0.108807646f, 0.169465393f},
-std::array<float,2>{0.62057066f, 0.459022105f},
-std::array<float,2>{0.468762994f, 0.993566096f},
-std::array<float,2>{0.701342463f, 0.768425763f},
-std::array<float,2>{0.278163642f, 0.334823281f},
-std::array<float,2>{0.824415088f, 0.0739669427f},
-std::array<float,2>{0.165254653f, 0.631152332f},
-std::array<float,2>{0.537564874f, 0.619247139f},
-std::array<float,2>{0.415952206f, 0.157467738f},
-std::array<float,2>{0.957672238f, 0.46288082f},
-std::array<float,2>{0.044684127f, 0.990854561f},
-std::array<float,2>{0.793328404f, 0.774412572f},
-std::array<float,2>{0.244472802f, 0.340703577f},
-std::array<float,2>{0.66555953f, 0.0669332892f},
-std::array<float,2>{0.367628187f, 0.637186885f},
-std::array<float,2>{0.934241772f, 0.689612448f},
-std::array<float,2>{0.113484494f, 0.0593886413f},
-std::array<float,2>{0.600060284f, 0.266666353f},
-std::array<float,2>{0.498555243f, 0.829575479f},
-std::array<float,2>{0.717892766f, 0.896456838f},
-std::array<float,2>{0.255473107f, 0.380284429f},
-std::array<float,2>{0.831188381f, 0.221508443f},
-std::array<float,2>{0.185854107f, 0.518611073f},
-std::array<float,2>{0.654715717f, 0.661912978f},
-std::array<float,2>{0.342610806f, 0.107854389f},
-std::array<float,2>{0.754164994f, 0.360846817f},
-std::array<float,2>{0.211200178f, 0.809821427f},
-std::array<float,2>{0.969941616f, 0.939479828f},
-std::array<float,2>{0.0190368742f, 0.477342695f},
-std::array<float,2>{0.514611602f, 0.132870883f},
-std::array<float,2>{0.380843788f, 0.585390568f},
-std::array<float,2>{0.853762627f, 0.553420842f},
-std::array<float,2>{0.136969671f, 0.196525872f},
-std::array<float,2>{0.721578717f, 0.41446197f},
-std::array<float,2>{0.296198905f, 0.928304434f},
-std::array<float,2>{0.574984074f, 0.850444615f},
-std::array<float,2>{0.45090583f, 0.299997121f},
-std::array<float,2>{0.888183951f, 0.0300113168f},
-std::array<float,2>{0.0762574822f, 0.727744758f},
-std::array<float,2>{0.739078641f, 0.505279899f},
-std::array<float,2>{0.306515723f, 0.239012927f},
-std::array<float,2>{0.870016813f, 0.396737576f},
-std::array<float,2>{0.145638898f, 0.876418769f},
-std::array<float,2>{0.901137412f, 0.813079596f},
-std::array<float,2>{0.0832925215f, 0.251197189f},
-std::array<float,2>{0.588865399f, 0.0359924883f},
-std::array<float,2>{0.458848f, 0.708600879f},
-std::array<float,2>{0.780111611f, 0.643005133f},
-std::array<float,2>{0.198832229f, 0.0790174603f},
-std::array<float,2>{0.629921019f, 0.314841092f},
-std::array<float,2>{0.321193457f, 0.764386594f},
-std::array<float,2>{0.516169667f, 0.975634098f},
-std::array<float,2>{0.405817538f, 0.441722065f},
-std::array<float,2>{0.994566083f, 0.186606988f},
-std::array<float,2>{0.00962872338f, 0.601089418f},
-std::array<float,2>{0.624640524f, 0.742278576f},
-std::array<float,2>{0.474725604f, 0.00176909997f},
-std::array<float,2>{0.917717218f, 0.291262835f},
-std::array<float,2>{0.103095852f, 0.859588563f},
-std::array<float,2>{0.822345972f, 0.912647307f},
-std::array<float,2>{0.168530449f, 0.422932059f},
-std::array<float,2>{0.699035585f, 0.210024521f},
-std::array<float,2>{0.273774773f, 0.534498513f},
-std::array<float,2>{0.941825271f, 0.576627553f},
-std::array<float,2>{0.0480859205f, 0.140966058f},
-std::array<float,2>{0.549625874f, 0.486930966f},
-std::array<float,2>{0.43382144f, 0.959492683f},
-std::array<float,2>{0.682365477f, 0.786784112f},
-std::array<float,2>{0.357493252f, 0.357211143f},
-std::array<float,2>{0.804517925f, 0.115712233f},
-std::array<float,2>{0.230786875f, 0.681060195f},
-std::array<float,2>{0.583213508f, 0.54327929f},
-std::array<float,2>{0.461016387f, 0.21099931f},
-std::array<float,2>{0.890677989f, 0.433436215f},
-std::array<float,2>{0.0902581885f, 0.91841042f},
-std::array<float,2>{0.864658177f, 0.871503651f},
-std::array<float,2>{0.150080338f, 0.287490219f},
-std::array<float,2>{0.744273245f, 0.0145402523f},
-std::array<float,2>{0.302960008f, 0.73947984f},
-std::array<float,2>{0.984469533f, 0.673382819f},
-std::array<float,2>{0.00518964976f, 0.122117005f},
-std::array<float,2>{0.525913298f, 0.346335918f},
-std::array<float,2>{0.392505229f, 0.796218514f},
-std::array<float,2>{0.63614893f, 0.968092024f},
-std::array<float,2>{0.319353104f, 0.498766243f},
-std::array<float,2>{0.76779145f, 0.150848553f},
-std::array<float,2>{0.192365572f, 0.566152453f},
-std::array<float,2>{0.687741041f, 0.715628624f},
-std::array<float,2>{0.272046447f, 0.0425590426f},
-std::array<float,2>{0.813213289f, 0.263864189f},
-std::array<float,2>{0.158659652f, 0.821507215f},
-std::array<float,2>{0.909320354f, 0.889276445f},
-std::array<float,2>{0.0964425579f, 0.399379075f},
-std::array<float,2>{0.611737847f, 0.245636731f},
-std::array<float,2>{0.479251683f, 0.508238316f},
-std::array<float,2>{0.80492717f, 0.602640092f},
-std::array<float,2>{0.218936503f, 0.174888343f},
-std::array<float,2>{0.675931096f, 0.4460603f},
-std::array<float,2>{0.348242074f, 0.977460563f},
-std::array<float,2>{0.554799199f, 0.751097262f},
-std::array<float,2>{0.423262417f, 0.324586004f},
-std::array<float,2>{0.945383489f, 0.0871529579f},
-std::array<float,2>{0.061817389f, 0.654048681f},
-std::array<float,2>{0.659134567f, 0.587721288f},
-std::array<float,2>{0.360658318f, 0.131389663f},
-std::array<float,2>{0.782012165f, 0.470249116f},
-std::array<float,2>{0.238387063f, 0.947937369f},
-std::array<float,2>{0.963791132f, 0.798083127f},
-std::array<float,2>{0.0370528102f, 0.374961853f},
-std::array<float,2>{0.539114535f, 0.0952385515f},
-std::array<float,2>{0.408611596f, 0.669534683f},
-std::array<float,2>{0.837474227f, 0.7230618f},
-std::array<float,2>{0.173656046f, 0.0228784755f},
-std::array<float,2>{0.706677914f, 0.304849327f},
-std::array<float,2>{0.259145617f, 0.857771516f},
-std::array<float,2>{0.605855227f, 0.935109735f},
-std::array<float,2>{0.490961492f, 0.411228716f},
-std::array<float,2>{0.926437318f, 0.187885642f},
-std::array<float,2>{0.121252738f, 0.555692196f},
-std::array<float,2>{0.502076387f, 0.628717721f},
-std::array<float,2>{0.387390673f, 0.0764108673f},
-std::array<float,2>{0.981750727f, 0.328854263f},
-std::array<float,2>{0.027348252f, 0.77069366f},
-std::array<float,2>{0.760808408f, 0.997441769f},
-std::array<float,2>{0.204114914f, 0.456073374f},
-std::array<float,2>{0.643996f, 0.165160924f},
-std::array<float,2>{0.332295716f, 0.616050243f},
-std::array<float,2>{0.880568564f, 0.527817011f},
-std::array<float,2>{0.0648263618f, 0.232694089f},
-std::array<float,2>{0.568953156f, 0.386579812f},
-std::array<float,2>{0.43930766f, 0.900843024f},
-std::array<float,2>{0.733990252f, 0.842563987f},
-std::array<float,2>{0.282864034f, 0.27978912f},
-std::array<float,2>{0.844856203f, 0.0507175587f},
-std::array<float,2>{0.129486188f, 0.701642215f},
-std::array<float,2>{0.561346769f, 0.547508955f},
-std::array<float,2>{0.427800596f, 0.200912893f},
-std::array<float,2>{0.951795936f, 0.418767393f},
-std::array<float,2>{0.0564510636f, 0.921941102f},
-std::array<float,2>{0.809814513f, 0.844226301f},
-std::array<float,2>{0.223730743f, 0.302965194f},
-std::array<float,2>{0.673963428f, 0.02501937f},
-std::array<float,2>{0.34626022f, 0.732636094f},
-std::array<float,2>{0.9132815f, 0.659623742f},
-std::array<float,2>{0.100509658f, 0.103399158f},
-std::array<float,2>{0.61603415f, 0.366313696f},
-std::array<float,2>{0.482639402f, 0.8076244f},
-std::array<float,2>{0.694719553f, 0.943917453f},
-std::array<float,2>{0.269230604f, 0.484277219f},
-std::array<float,2>{0.816530168f, 0.137486234f},
-std::array<float,2>{0.161361113f, 0.580049396f},
-std::array<float,2>{0.638140917f, 0.693073869f},
-std::array<float,2>{0.312614202f, 0.0583769903f},
-std::array<float,2>{0.769627512f, 0.273019642f},
-std::array<float,2>{0.190184072f, 0.834616244f},
-std::array<float,2>{0.991043985f, 0.893362522f},
-std::array<float,2>{0.0022121123f, 0.376600862f},
-std::array<float,2>{0.528737545f, 0.225315511f},
-std::array<float,2>{0.394775629f, 0.522140205f},
-std::array<float,2>{0.86013943f, 0.62128073f},
-std::array<float,2>{0.154078022f, 0.162963986f},
-std::array<float,2>{0.748054206f, 0.465234935f},
-std::array<float,2>{0.297450066f, 0.987164319f},
-std::array<float,2>{0.58081615f, 0.779987335f},
-std::array<float,2>{0.46741429f, 0.339182466f},
-std::array<float,2>{0.895430684f, 0.063723959f},
-std::array<float,2>{0.0892496854f, 0.635314107f},
-std::array<float,2>{0.727925599f, 0.5722574f},
-std::array<float,2>{0.286524475f, 0.146368384f},
-std::array<float,2>{0.849248767f, 0.48858276f},
-std::array<float,2>{0.128832877f, 0.955211937f},
-std::array<float,2>{0.877449155f, 0.784200311f},
-std::array<float,2>{0.0685800985f, 0.354395002f},
-std::array<float,2>{0.562742233f, 0.111899085f},
-std::array<float,2>{0.442680389f, 0.686255753f},
-std::array<float,2>{0.762091875f, 0.749195635f},
-std::array<float,2>{0.207216546f, 0.00432516122f},
-std::array<float,2>{0.647115946f, 0.294780552f},
-std::array<float,2>{0.330012739f, 0.863442719f},
-std::array<float,2>{0.505958021f, 0.907270253f},
-std::array<float,2>{0.384953737f, 0.427823991f},
-std::array<float,2>{0.977705717f, 0.205146745f},
-std::array<float,2>{0.024404414f, 0.535825014f},
-std::array<float,2>{0.601642668f, 0.644993603f},
-std::array<float,2>{0.486898959f, 0.0833928585f},
-std::array<float,2>{0.923903227f, 0.318248808f},
-std::array<float,2>{0.117198654f, 0.758379877f},
-std::array<float,2>{0.841906846f, 0.968941927f},
-std::array<float,2>{0.17755188f, 0.441120207f},
-std::array<float,2>{0.707412839f, 0.180153847f},
-std::array<float,2>{0.26535812f, 0.594370365f},
-std::array<float,2>{0.965209126f, 0.500143528f},
-std::array<float,2>{0.0317594185f, 0.234657109f},
-std::array<float,2>{0.545693755f, 0.393096864f},
-std::array<float,2>{0.411659062f, 0.880430698f},
-std::array<float,2>{0.661277771f, 0.818466961f},
-std::array<float,2>{0.367175758f, 0.255499244f},
-std::array<float,2>{0.785389066f, 0.0326748304f},
-std::array<float,2>{0.234646887f, 0.705894828f},
-std::array<float,2>{0.573445141f, 0.607363522f},
-std::array<float,2>{0.447256923f, 0.17670536f},
-std::array<float,2>{0.885377824f, 0.450135738f},
-std::array<float,2>{0.0707914755f, 0.982497156f},
-std::array<float,2>{0.857028425f, 0.755113304f},
-std::array<float,2>{0.1355149f, 0.321699232f},
-std::array<float,2>{0.72326678f, 0.0929101855f},
-std::array<float,2>{0.291138619f, 0.649335802f},
-std::array<float,2>{0.973059177f, 0.712192059f},
-std::array<float,2>{0.0202239454f, 0.0439639874f},
-std::array<float,2>{0.510463893f, 0.259582847f},
-std::array<float,2>{0.376982778f, 0.826750398f},
-std::array<float,2>{0.648464262f, 0.88430053f},
-std::array<float,2>{0.339571923f, 0.404778004f},
-std::array<float,2>{0.753311038f, 0.24800849f},
-std::array<float,2>{0.215796947f, 0.513454616f},
-std::array<float,2>{0.711239994f, 0.677169502f},
-std::array<float,2>{0.251941264f, 0.118040204f},
-std::array<float,2>{0.835672796f, 0.350908279f},
-std::array<float,2>{0.181205213f, 0.792114139f},
-std::array<float,2>{0.92983377f, 0.963056743f},
-std::array<float,2>{0.109824136f, 0.492435068f},
-std::array<float,2>{0.59479785f, 0.154073477f},
-std::array<float,2>{0.494264871f, 0.56770438f},
-std::array<float,2>{0.792800605f, 0.53913337f},
-std::array<float,2>{0.24719505f, 0.216019779f},
-std::array<float,2>{0.670122147f, 0.434132248f},
-std::array<float,2>{0.372542888f, 0.914280057f},
-std::array<float,2>{0.534812212f, 0.867870212f},
-std::array<float,2>{0.419577986f, 0.28394413f},
-std::array<float,2>{0.95629555f, 0.00972525869f},
-std::array<float,2>{0.0391812883f, 0.735155702f},
-std::array<float,2>{0.68583709f, 0.525980234f},
-std::array<float,2>{0.355111659f, 0.229823589f},
-std::array<float,2>{0.797507167f, 0.390497386f},
-std::array<float,2>{0.228162616f, 0.902648985f},
-std::array<float,2>{0.938269138f, 0.83657068f},
-std::array<float,2>{0.0538535118f, 0.275759608f},
-std::array<float,2>{0.552397192f, 0.0546080023f},
-std::array<float,2>{0.43044281f, 0.698675215f},
-std::array<float,2>{0.826970518f, 0.628926098f},
-std::array<float,2>{0.167338148f, 0.0717854202f},
-std::array<float,2>{0.7011621f, 0.333167195f},
-std::array<float,2>{0.279570043f, 0.766186416f},
-std::array<float,2>{0.617629528f, 0.994559288f},
-std::array<float,2>{0.472084105f, 0.457070023f},
-std::array<float,2>{0.919725776f, 0.171016768f},
-std::array<float,2>{0.10705816f, 0.612435758f},
-std::array<float,2>{0.521613061f, 0.72007972f},
-std::array<float,2>{0.399995744f, 0.0187433735f},
-std::array<float,2>{0.999465764f, 0.30999577f},
-std::array<float,2>{0.0118320575f, 0.853884161f},
-std::array<float,2>{0.774303377f, 0.93215096f},
-std::array<float,2>{0.200344533f, 0.406950831f},
-std::array<float,2>{0.62732476f, 0.192895964f},
-std::array<float,2>{0.327580094f, 0.559267402f},
-std::array<float,2>{0.902850747f, 0.590033174f},
-std::array<float,2>{0.0810198635f, 0.125108063f},
-std::array<float,2>{0.589993894f, 0.476187915f},
-std::array<float,2>{0.454375535f, 0.952079177f},
-std::array<float,2>{0.736404002f, 0.801191211f},
-std::array<float,2>{0.309127003f, 0.367727816f},
-std::array<float,2>{0.873368621f, 0.0999805331f},
-std::array<float,2>{0.142331243f, 0.665119588f},
-std::array<float,2>{0.513096809f, 0.583334208f},
-std::array<float,2>{0.381157935f, 0.135911927f},
-std::array<float,2>{0.972056925f, 0.479499072f},
-std::array<float,2>{0.0171604883f, 0.938452482f},
-std::array<float,2>{0.756402373f, 0.811118424f},
-std::array<float,2>{0.214432836f, 0.361992538f},
-std::array<float,2>{0.654080808f, 0.105853915f},
-std::array<float,2>{0.341624558f, 0.663616538f},
-std::array<float,2>{0.89034462f, 0.729892492f},
-std::array<float,2>{0.0746650547f, 0.0284818001f},
-std::array<float,2>{0.577391267f, 0.297059178f},
-std::array<float,2>{0.452589989f, 0.848183215f},
-std::array<float,2>{0.719787061f, 0.927265525f},
-std::array<float,2>{0.29382664f, 0.417666614f},
-std::array<float,2>{0.85230881f, 0.19799085f},
-std::array<float,2>{0.140263587f, 0.551073372f},
-std::array<float,2>{0.667624176f, 0.639136255f},
-std::array<float,2>{0.370811403f, 0.0689700469f},
-std::array<float,2>{0.795337796f, 0.342638463f},
-std::array<float,2>{0.243075728f, 0.77595973f},
-std::array<float,2>{0.959709406f, 0.989257634f},
-std::array<float,2>{0.0466969982f, 0.463877171f},
-std::array<float,2>{0.535398066f, 0.159114257f},
-std::array<float,2>{0.417002559f, 0.617722273f},
-std::array<float,2>{0.829674304f, 0.516236305f},
-std::array<float,2>{0.183932483f, 0.218987316f},
-std::array<float,2>{0.716364264f, 0.38253516f},
-std::array<float,2>{0.257767767f, 0.897132337f},
-std::array<float,2>{0.598964572f, 0.831391096f},
-std::array<float,2>{0.497974962f, 0.268227965f},
-std::array<float,2>{0.936772168f, 0.0617343821f},
-std::array<float,2>{0.116933428f, 0.689047039f},
-std::array<float,2>{0.697263956f, 0.533125401f},
-std::array<float,2>{0.275676519f, 0.208490297f},
-std::array<float,2>{0.822022557f, 0.425052464f},
-std::array<float,2>{0.170441121f, 0.911091089f},
-std::array<float,2>{0.915020406f, 0.86214608f},
-std::array<float,2>{0.104127951f, 0.290355176f},
-std::array<float,2>{0.621144891f, 0.00286494079f},
-std::array<float,2>{0.473409086f, 0.745194256f},
-std::array<float,2>{0.802375674f, 0.682003558f},
-std::array<float,2>{0.233752757f, 0.113367453f},
-std::array<float,2>{0.681419432f, 0.357607514f},
-std::array<float,2>{0.357371807f, 0.789042652f},
-std::array<float,2>{0.547009647f, 0.958825469f},
-std::array<float,2>{0.436639726f, 0.484546542f},
-std::array<float,2>{0.943878353f, 0.144039378f},
-std::array<float,2>{0.0504240431f, 0.575085104f},
-std::array<float,2>{0.585940778f, 0.710281909f},
-std::array<float,2>{0.459763318f, 0.0390410349f},
-std::array<float,2>{0.899099946f, 0.253107786f},
-std::array<float,2>{0.0844852999f, 0.816050231f},
-std::array<float,2>{0.868877649f, 0.87842375f},
-std::array<float,2>{0.147939548f, 0.39634797f},
-std::array<float,2>{0.741733968f, 0.240358904f},
-std::array<float,2>{0.307046533f, 0.506005049f},
-std::array<float,2>{0.993292272f, 0.598434448f},
-std::array<float,2>{0.0113500115f, 0.184065819f},
-std::array<float,2>{0.518701971f, 0.443417609f},
-std::array<float,2>{0.403295457f, 0.974540472f},
-std::array<float,2>{0.632421196f, 0.762485743f},
-std::array<float,2>{0.322532386f, 0.312517703f},
-std::array<float,2>{0.777771056f, 0.0814243183f},
-std::array<float,2>{0.196786091f, 0.641095936f},
-std::array<float,2>{0.610985816f, 0.509873033f},
-std::array<float,2>{0.477910399f, 0.242822781f},
-std::array<float,2>{0.906290114f, 0.400961339f},
-std::array<float,2>{0.0950092748f, 0.887753487f},
-std::array<float,2>{0.81618911f, 0.823233247f},
-std::array<float,2>{0.15696305f, 0.263655156f},
-std::array<float,2>{0.690111995f, 0.0396291129f},
-std::array<float,2>{0.269979089f, 0.716804206f},
-std::array<float,2>{0.94786036f, 0.65465796f},
-std::array<float,2>{0.0600572973f, 0.0891158208f},
-std::array<float,2>{0.55857563f, 0.327603042f},
-std::array<float,2>{0.424637944f, 0.752990425f},
-std::array<float,2>{0.67936933f, 0.979830921f},
-std::array<float,2>{0.350258172f, 0.447714269f},
-std::array<float,2>{0.808185339f, 0.173620239f},
-std::array<float,2>{0.221560389f, 0.603659868f},
-std::array<float,2>{0.742615759f, 0.74059552f},
-std::array<float,2>{0.300891519f, 0.0123136286f},
-std::array<float,2>{0.866169333f, 0.286246747f},
-std::array<float,2>{0.15122357f, 0.874643266f},
-std::array<float,2>{0.894405901f, 0.921593666f},
-std::array<float,2>{0.0937297121f, 0.430214226f},
-std::array<float,2>{0.584527373f, 0.213972807f},
-std::array<float,2>{0.463468254f, 0.545789599f},
-std::array<float,2>{0.767497599f, 0.563468158f},
-std::array<float,2>{0.194632009f, 0.148864776f},
-std::array<float,2>{0.633424759f, 0.497756094f},
-std::array<float,2>{0.317027032f, 0.966469646f},
-std::array<float,2>{0.525344968f, 0.794767559f},
-std::array<float,2>{0.392726779f, 0.345547706f},
-std::array<float,2>{0.986368537f, 0.123434782f},
-std::array<float,2>{0.00758880004f, 0.673956454f},
-std::array<float,2>{0.641673863f, 0.615220845f},
-std::array<float,2>{0.335360587f, 0.167297781f},
-std::array<float,2>{0.758007646f, 0.453289151f},
-std::array<float,2>{0.205339417f, 0.999623001f},
-std::array<float,2>{0.983665526f, 0.771802664f},
-std::array<float,2>{0.0305607636f, 0.33062318f},
-std::array<float,2>{0.500711381f, 0.0760180131f},
-std::array<float,2>{0.390274584f, 0.625506043f},
-std::array<float,2>{0.847560108f, 0.699902654f},
-std::array<float,2>{0.13099955f, 0.0474918596f},
-std::array<float,2>{0.731699884f, 0.279042572f},
-std::array<float,2>{0.283384115f, 0.840357363f},
-std::array<float,2>{0.567784727f, 0.899303973f},
-std::array<float,2>{0.440910935f, 0.382915229f},
-std::array<float,2>{0.8812958f, 0.232012928f},
-std::array<float,2>{0.0637823045f, 0.530775845f},
-std::array<float,2>{0.542084217f, 0.67105478f},
-std::array<float,2>{0.406979501f, 0.0957224146f},
-std::array<float,2>{0.962255538f, 0.37141338f},
-std::array<float,2>{0.0388727076f, 0.799891293f},
-std::array<float,2>{0.785152376f, 0.947149754f},
-std::array<float,2>{0.240865827f, 0.471655816f},
-std::array<float,2>{0.657177389f, 0.129922867f},
-std::array<float,2>{0.361422449f, 0.588281333f},
-std::array<float,2>{0.928091288f, 0.558247447f},
-std::array<float,2>{0.124702945f, 0.190493032f},
-std::array<float,2>{0.608136117f, 0.413473576f},
-std::array<float,2>{0.488499165f, 0.936681747f},
-std::array<float,2>{0.703324676f, 0.856979609f},
-std::array<float,2>{0.261608213f, 0.307757854f},
-std::array<float,2>{0.839554667f, 0.0212969352f},
-std::array<float,2>{0.17417264f, 0.726011753f},
-std::array<float,2>{0.558272004f, 0.50897646f},
-std::array<float,2>{0.424553037f, 0.245034084f},
-std::array<float,2>{0.948013246f, 0.39971742f},
-std::array<float,2>{0.0597313792f, 0.890054226f},
-std::array<float,2>{0.808369458f, 0.820757747f},
-std::array<float,2>{0.221261397f, 0.265301019f},
-std::array<float,2>{0.679646313f, 0.0416719094f},
-std::array<float,2>{0.350412756f, 0.716066599f},
-std::array<float,2>{0.906561077f, 0.652488172f},
-std::array<float,2>{0.0948249847f, 0.0867316574f},
-std::array<float,2>{0.611220181f, 0.325878143f},
-std::array<float,2>{0.477781445f, 0.750057101f},
-std::array<float,2>{0.690391719f, 0.977566421f},
-std::array<float,2>{0.269766867f, 0.446873516f},
-std::array<float,2>{0.816097617f, 0.173854902f},
-std::array<float,2>{0.157198191f, 0.602247f},
-std::array<float,2>{0.633694947f, 0.738978863f},
-std::array<float,2>{0.317304432f, 0.0148896817f},
-std::array<float,2>{0.767328322f, 0.289017558f},
-std::array<float,2>{0.194373593f, 0.873011351f},
-std::array<float,2>{0.986701012f, 0.919124126f},
-std::array<float,2>{0.00737719517f, 0.432440937f},
-std::array<float,2>{0.525145113f, 0.212276027f},
-std::array<float,2>{0.392988473f, 0.544282138f},
-std::array<float,2>{0.865932703f, 0.564941347f},
-std::array<float,2>{0.151056558f, 0.151700884f},
-std::array<float,2>{0.742325842f, 0.499491096f},
-std::array<float,2>{0.30115205f, 0.967470169f},
-std::array<float,2>{0.584778905f, 0.795562565f},
-std::array<float,2>{0.463642508f, 0.3475793f},
-std::array<float,2>{0.894091666f, 0.121984802f},
-std::array<float,2>{0.0934504569f, 0.672597885f},
-std::array<float,2>{0.731547832f, 0.616290331f},
-std::array<float,2>{0.283480227f, 0.164861932f},
-std::array<float,2>{0.847368658f, 0.455794334f},
-std::array<float,2>{0.131125435f, 0.996815801f},
-std::array<float,2>{0.880869865f, 0.769641101f},
-std::array<float,2>{0.0634922385f, 0.329661161f},
-std::array<float,2>{0.567535579f, 0.0776493475f},
-std::array<float,2>{0.440648407f, 0.627435923f},
-std::array<float,2>{0.758096159f, 0.702210724f},
-std::array<float,2>{0.205260977f, 0.0498018935f},
-std::array<float,2>{0.642028332f, 0.281193525f},
-std::array<float,2>{0.335042655f, 0.843488038f},
-std::array<float,2>{0.500792325f, 0.901881278f},
-std::array<float,2>{0.390604198f, 0.385009408f},
-std::array<float,2>{0.983516157f, 0.233403698f},
-std::array<float,2>{0.0305169579f, 0.528959632f},
-std::array<float,2>{0.608318508f, 0.668305933f},
-std::array<float,2>{0.488684744f, 0.0938619748f},
-std::array<float,2>{0.927844167f, 0.373684853f},
-std::array<float,2>{0.124929391f, 0.797296822f},
-std::array<float,2>{0.83976531f, 0.948756158f},
-std::array<float,2>{0.17396453f, 0.469283074f},
-std::array<float,2>{0.703417182f, 0.131947502f},
-std::array<float,2>{0.261375934f, 0.586768925f},
-std::array<float,2>{0.962031782f, 0.555270076f},
-std::array<float,2>{0.0385963954f, 0.188950568f},
-std::array<float,2>{0.542333841f, 0.410259306f},
-std::array<float,2>{0.407018512f, 0.933787704f},
-std::array<float,2>{0.656782746f, 0.858727157f},
-std::array<float,2>{0.361778826f, 0.306632459f},
-std::array<float,2>{0.784806669f, 0.022042783f},
-std::array<float,2>{0.241097808f, 0.723882496f},
-std::array<float,2>{0.577603519f, 0.584311724f},
-std::array<float,2>{0.452309191f, 0.134159952f},
-std::array<float,2>{0.890575707f, 0.47849825f},
-std::array<float,2>{0.0743861198f, 0.940741956f},
-std::array<float,2>{0.85219413f, 0.809563458f},
-std::array<float,2>{0.140611202f, 0.359437168f},
-std::array<float,2>{0.720022678f, 0.108677626f},
-std::array<float,2>{0.293539077f, 0.660605252f},
-std::array<float,2>{0.97192049f, 0.726844966f},
-std::array<float,2>{0.0174184311f, 0.031188f},
-std::array<float,2>{0.512899578f, 0.299479961f},
-std::array<float,2>{0.381031275f, 0.850817382f},
-std::array<float,2>{0.653933108f, 0.929582f},
-std::array<float,2>{0.341525406f, 0.415967524f},
-std::array<float,2>{0.756818414f, 0.195583135f},
-std::array<float,2>{0.214735001f, 0.554049611f},
-std::array<float,2>{0.716651678f, 0.637858152f},
-std::array<float,2>{0.257507235f, 0.0675140843f},
-std::array<float,2>{0.829918683f, 0.341158986f},
-std::array<float,2>{0.183720946f, 0.774619937f},
-std::array<float,2>{0.936747193f, 0.991490006f},
-std::array<float,2>{0.116986662f, 0.461702526f},
-std::array<float,2>{0.59878695f, 0.157114789f},
-std::array<float,2>{0.497688025f, 0.620424509f},
-std::array<float,2>{0.795117199f, 0.518077195f},
-std::array<float,2>{0.242711961f, 0.222172767f},
-std::array<float,2>{0.667733967f, 0.379240751f},
-std::array<float,2>{0.371090412f, 0.894998789f},
-std::array<float,2>{0.535637617f, 0.82832551f},
-std::array<float,2>{0.417419285f, 0.265715569f},
-std::array<float,2>{0.959791124f, 0.0598201789f},
-std::array<float,2>{0.0464557558f, 0.690441608f},
-std::array<float,2>{0.681294978f, 0.53349942f},
-std::array<float,2>{0.357048094f, 0.208987504f},
-std::array<float,2>{0.802707255f, 0.422774434f},
-std::array<float,2>{0.23353672f, 0.913738549f},
-std::array<float,2>{0.944259226f, 0.860858798f},
-std::array<float,2>{0.0507448353f, 0.292172045f},
-std::array<float,2>{0.547280014f, 0.000876933278f},
-std::array<float,2>{0.436879903f, 0.743757606f},
-std::array<float,2>{0.821952581f, 0.680042088f},
-std::array<float,2>{0.170881674f, 0.116313063f},
-std::array<float,2>{0.696873844f, 0.355499774f},
-std::array<float,2>{0.27548486f, 0.785453677f},
-std::array<float,2>{0.621453583f, 0.960220397f},
-std::array<float,2>{0.473315269f, 0.488189727f},
-std::array<float,2>{0.914708734f, 0.141767055f},
-std::array<float,2>{0.104426749f, 0.577992618f},
-std::array<float,2>{0.519003153f, 0.707197189f},
-std::array<float,2>{0.402864903f, 0.0362966508f},
-std::array<float,2>{0.993482232f, 0.250297576f},
-std::array<float,2>{0.011681919f, 0.814049482f},
-std::array<float,2>{0.777367711f, 0.87576884f},
-std::array<float,2>{0.197232217f, 0.398279965f},
-std::array<float,2>{0.632681549f, 0.239647314f},
-std::array<float,2>{0.322472125f, 0.504109561f},
-std::array<float,2>{0.899307251f, 0.600497901f},
-std::array<float,2>{0.0848016217f, 0.186149895f},
-std::array<float,2>{0.586306632f, 0.443241805f},
-std::array<float,2>{0.459628046f, 0.975165784f},
-std::array<float,2>{0.741989255f, 0.764820635f},
-std::array<float,2>{0.306848764f, 0.315759987f},
-std::array<float,2>{0.869095564f, 0.0794894472f},
-std::array<float,2>{0.147523284f, 0.643791258f},
-std::array<float,2>{0.510507226f, 0.609333634f},
-std::array<float,2>{0.377248347f, 0.178146765f},
-std::array<float,2>{0.972661972f, 0.452617258f},
-std::array<float,2>{0.0204363409f, 0.980725527f},
-std::array<float,2>{0.752983034f, 0.757136106f},
-std::array<float,2>{0.215362623f, 0.323304564f},
-std::array<float,2>{0.648761451f, 0.0898711681f},
-std::array<float,2>{0.33968994f, 0.651983261f},
-std::array<float,2>{0.885529578f, 0.713828266f},
-std::array<float,2>{0.0703477412f, 0.0454484224f},
-std::array<float,2>{0.573725343f, 0.261340171f},
-std::array<float,2>{0.446863115f, 0.826145649f},
-std::array<float,2>{0.723502696f, 0.886491001f},
-std::array<float,2>{0.291478783f, 0.402891278f},
-std::array<float,2>{0.85730052f, 0.249171481f},
-std::array<float,2>{0.135404587f, 0.514086902f},
-std::array<float,2>{0.670279622f, 0.679008126f},
-std::array<float,2>{0.372199923f, 0.120002419f},
-std::array<float,2>{0.792577982f, 0.349531502f},
-std::array<float,2>{0.247402921f, 0.789492309f},
-std::array<float,2>{0.956307709f, 0.960985243f},
-std::array<float,2>{0.0394733138f, 0.494146138f},
-std::array<float,2>{0.53501904f, 0.156053022f},
-std::array<float,2>{0.419812948f, 0.568539917f},
-std::array<float,2>{0.83572644f, 0.542869866f},
-std::array<float,2>{0.181639284f, 0.217680573f},
-std::array<float,2>{0.71103996f, 0.435654908f},
-std::array<float,2>{0.251534641f, 0.91705662f},
-std::array<float,2>{0.5950737f, 0.870138466f},
-std::array<float,2>{0.494502544f, 0.28185451f},
-std::array<float,2>{0.930049419f, 0.0109211225f},
-std::array<float,2>{0.109439462f, 0.736845672f},
-std::array<float,2>{0.700771928f, 0.523693264f},
-std::array<float,2>{0.279500544f, 0.227241054f},
-std::array<float,2>{0.826831818f, 0.388062477f},
-std::array<float,2>{0.167155564f, 0.905449986f},
-std::array<float,2>{0.919480562f, 0.839111745f},
-std::array<float,2>{0.107179664f, 0.274623156f},
-std::array<float,2>{0.617237628f, 0.0511873066f},
-std::array<float,2>{0.471730113f, 0.695803702f},
-std::array<float,2>{0.797825873f, 0.631951213f},
-std::array<float,2>{0.228346452f, 0.0730206296f},
-std::array<float,2>{0.685603917f, 0.335832119f},
-std::array<float,2>{0.355273634f, 0.768768728f},
-std::array<float,2>{0.552695334f, 0.993056238f},
-std::array<float,2>{0.430251449f, 0.46001485f},
-std::array<float,2>{0.938136399f, 0.16822505f},
-std::array<float,2>{0.0541536026f, 0.610315502f},
-std::array<float,2>{0.590305328f, 0.722621024f},
-std::array<float,2>{0.454187423f, 0.01696698f},
-std::array<float,2>{0.9033041f, 0.311739504f},
-std::array<float,2>{0.0807578266f, 0.85308522f},
-std::array<float,2>{0.873104811f, 0.930417895f},
-std::array<float,2>{0.142568976f, 0.408275992f},
-std::array<float,2>{0.736597955f, 0.194728881f},
-std::array<float,2>{0.309530258f, 0.561398089f},
-std::array<float,2>{0.999065578f, 0.592680275f},
-std::array<float,2>{0.012026038f, 0.128525168f},
-std::array<float,2>{0.521854222f, 0.473703295f},
-std::array<float,2>{0.400386602f, 0.949957311f},
-std::array<float,2>{0.627170563f, 0.803973317f},
-std::array<float,2>{0.327202111f, 0.369700491f},
-std::array<float,2>{0.774006188f, 0.0980503187f},
-std::array<float,2>{0.200669765f, 0.667821229f},
-std::array<float,2>{0.615754426f, 0.550178587f},
-std::array<float,2>{0.482880384f, 0.202314794f},
-std::array<float,2>{0.913342178f, 0.421646953f},
-std::array<float,2>{0.100168377f, 0.924916744f},
-std::array<float,2>{0.816788077f, 0.846796334f},
-std::array<float,2>{0.16146417f, 0.302407414f},
-std::array<float,2>{0.694461763f, 0.0255905353f},
-std::array<float,2>{0.269434422f, 0.732118607f},
-std::array<float,2>{0.951913655f, 0.656763256f},
-std::array<float,2>{0.0562650003f, 0.103985161f},
-std::array<float,2>{0.561038256f, 0.365071952f},
-std::array<float,2>{0.428123862f, 0.8053267f},
-std::array<float,2>{0.674177945f, 0.941685021f},
-std::array<float,2>{0.346544683f, 0.481642127f},
-std::array<float,2>{0.809651792f, 0.138813615f},
-std::array<float,2>{0.22398448f, 0.580728471f},
-std::array<float,2>{0.748398185f, 0.694729984f},
-std::array<float,2>{0.297835141f, 0.0563426837f},
-std::array<float,2>{0.859932244f, 0.270463526f},
-std::array<float,2>{0.153974712f, 0.832611918f},
-std::array<float,2>{0.895193696f, 0.8915205f},
-std::array<float,2>{0.0888892859f, 0.377163976f},
-std::array<float,2>{0.580659628f, 0.222820044f},
-std::array<float,2>{0.467614233f, 0.520833254f},
-std::array<float,2>{0.769906461f, 0.623222411f},
-std::array<float,2>{0.190203995f, 0.160706818f},
-std::array<float,2>{0.637924552f, 0.468353719f},
-std::array<float,2>{0.312879652f, 0.985098302f},
-std::array<float,2>{0.528355002f, 0.778876603f},
-std::array<float,2>{0.394716382f, 0.336925477f},
-std::array<float,2>{0.990797341f, 0.0660815835f},
-std::array<float,2>{0.00210230239f, 0.633343697f},
-std::array<float,2>{0.647366047f, 0.572487652f},
-std::array<float,2>{0.329751194f, 0.146668762f},
-std::array<float,2>{0.761855841f, 0.491934359f},
-std::array<float,2>{0.207293496f, 0.954329371f},
-std::array<float,2>{0.977886736f, 0.782192469f},
-std::array<float,2>{0.0239378139f, 0.352953821f},
-std::array<float,2>{0.506116509f, 0.109791249f},
-std::array<float,2>{0.385225058f, 0.685465872f},
-std::array<float,2>{0.84951055f, 0.747664869f},
-std::array<float,2>{0.128482506f, 0.00617430825f},
-std::array<float,2>{0.72769326f, 0.296307445f},
-std::array<float,2>{0.286249369f, 0.865491033f},
-std::array<float,2>{0.5628438f, 0.909225404f},
-std::array<float,2>{0.44241786f, 0.427351803f},
-std::array<float,2>{0.877801061f, 0.204863921f},
-std::array<float,2>{0.068625249f, 0.538461387f},
-std::array<float,2>{0.545581222f, 0.648434877f},
-std::array<float,2>{0.412016571f, 0.0848500133f},
-std::array<float,2>{0.964979947f, 0.31841138f},
-std::array<float,2>{0.0320631154f, 0.761316001f},
-std::array<float,2>{0.785411417f, 0.972630799f},
-std::array<float,2>{0.234605551f, 0.439425826f},
-std::array<float,2>{0.6614784f, 0.183422282f},
-std::array<float,2>{0.366835505f, 0.596924603f},
-std::array<float,2>{0.924274087f, 0.502648532f},
-std::array<float,2>{0.117590658f, 0.237007782f},
-std::array<float,2>{0.601851821f, 0.392143965f},
-std::array<float,2>{0.48718968f, 0.882434785f},
-std::array<float,2>{0.707254887f, 0.816668391f},
-std::array<float,2>{0.265554577f, 0.256721526f},
-std::array<float,2>{0.842188358f, 0.0340606757f},
-std::array<float,2>{0.17731528f, 0.703252852f},
-std::array<float,2>{0.526228786f, 0.54682529f},
-std::array<float,2>{0.392134547f, 0.213056609f},
-std::array<float,2>{0.984643459f, 0.430772573f},
-std::array<float,2>{0.00496288948f, 0.92009902f},
-std::array<float,2>{0.767965078f, 0.87393713f},
-std::array<float,2>{0.191993847f, 0.285823435f},
-std::array<float,2>{0.635920525f, 0.0129130529f},
-std::array<float,2>{0.319682032f, 0.741387784f},
-std::array<float,2>{0.891070545f, 0.67490381f},
-std::array<float,2>{0.0898813531f, 0.124821901f},
-std::array<float,2>{0.583447993f, 0.344023734f},
-std::array<float,2>{0.461332172f, 0.793553412f},
-std::array<float,2>{0.744487941f, 0.965305507f},
-std::array<float,2>{0.303222269f, 0.496982127f},
-std::array<float,2>{0.864471316f, 0.149693161f},
-std::array<float,2>{0.150171772f, 0.56439513f},
-std::array<float,2>{0.676241636f, 0.717907548f},
-std::array<float,2>{0.348467827f, 0.0400819145f},
-std::array<float,2>{0.80497247f, 0.262108475f},
-std::array<float,2>{0.219138533f, 0.823407829f},
-std::array<float,2>{0.945580423f, 0.887339652f},
-std::array<float,2>{0.0617293678f, 0.401877314f},
-std::array<float,2>{0.55515188f, 0.243841648f},
-std::array<float,2>{0.423076093f, 0.511368632f},
-std::array<float,2>{0.813250422f, 0.604924321f},
-std::array<float,2>{0.158297881f, 0.172397882f},
-std::array<float,2>{0.687753975f, 0.448826492f},
-std::array<float,2>{0.272271395f, 0.97864449f},
-std::array<float,2>{0.611531973f, 0.752401173f},
-std::array<float,2>{0.479006231f, 0.32659319f},
-std::array<float,2>{0.909565687f, 0.088064298f},
-std::array<float,2>{0.0963364542f, 0.656156957f},
-std::array<float,2>{0.706998646f, 0.589486182f},
-std::array<float,2>{0.258871734f, 0.129871592f},
-std::array<float,2>{0.837769449f, 0.471699327f},
-std::array<float,2>{0.173547134f, 0.945962965f},
-std::array<float,2>{0.926745594f, 0.799182534f},
-std::array<float,2>{0.121368423f, 0.372530371f},
-std::array<float,2>{0.605660021f, 0.09761931f},
-std::array<float,2>{0.491093069f, 0.670888066f},
-std::array<float,2>{0.781777918f, 0.724758506f},
-std::array<float,2>{0.238638207f, 0.0195344985f},
-std::array<float,2>{0.658891559f, 0.306972116f},
-std::array<float,2>{0.360469043f, 0.856327295f},
-std::array<float,2>{0.5395298f, 0.935855567f},
-std::array<float,2>{0.408391327f, 0.412682682f},
-std::array<float,2>{0.963386476f, 0.190410748f},
-std::array<float,2>{0.0366878808f, 0.557149649f},
-std::array<float,2>{0.569303215f, 0.626663804f},
-std::array<float,2>{0.439064473f, 0.0742278099f},
-std::array<float,2>{0.880809605f, 0.331586748f},
-std::array<float,2>{0.0645433739f, 0.772757709f},
-std::array<float,2>{0.845118403f, 0.998548269f},
-std::array<float,2>{0.129758403f, 0.454931408f},
-std::array<float,2>{0.734261155f, 0.166840643f},
-std::array<float,2>{0.282985181f, 0.613684595f},
-std::array<float,2>{0.9816764f, 0.530201554f},
-std::array<float,2>{0.0277140718f, 0.231442496f},
-std::array<float,2>{0.502421796f, 0.38382268f},
-std::array<float,2>{0.387522221f, 0.900313497f},
-std::array<float,2>{0.643675029f, 0.841092944f},
-std::array<float,2>{0.332194537f, 0.277656645f},
-std::array<float,2>{0.76104939f, 0.0488197654f},
-std::array<float,2>{0.204452872f, 0.700683713f},
-std::array<float,2>{0.599788368f, 0.618663311f},
-std::array<float,2>{0.498831451f, 0.159888312f},
-std::array<float,2>{0.934361577f, 0.463405937f},
-std::array<float,2>{0.113714673f, 0.989664495f},
-std::array<float,2>{0.831462145f, 0.776623249f},
-std::array<float,2>{0.185718134f, 0.343468517f},
-std::array<float,2>{0.718238771f, 0.0694058686f},
-std::array<float,2>{0.25578326f, 0.640435696f},
-std::array<float,2>{0.957905412f, 0.688221753f},
-std::array<float,2>{0.0446240753f, 0.0614197962f},
-std::array<float,2>{0.537191749f, 0.268825948f},
-std::array<float,2>{0.415733397f, 0.830264509f},
-std::array<float,2>{0.665972888f, 0.89821279f},
-std::array<float,2>{0.367395163f, 0.381033182f},
-std::array<float,2>{0.793162763f, 0.220131323f},
-std::array<float,2>{0.244238511f, 0.51726681f},
-std::array<float,2>{0.721290708f, 0.662439287f},
-std::array<float,2>{0.296117634f, 0.106729425f},
-std::array<float,2>{0.853729188f, 0.363105685f},
-std::array<float,2>{0.136767477f, 0.811775088f},
-std::array<float,2>{0.88855511f, 0.938650787f},
-std::array<float,2>{0.0765979141f, 0.478673339f},
-std::array<float,2>{0.574754536f, 0.135437995f},
-std::array<float,2>{0.450954646f, 0.582729578f},
-std::array<float,2>{0.754002869f, 0.551909804f},
-std::array<float,2>{0.211005896f, 0.198472738f},
-std::array<float,2>{0.654489338f, 0.416689843f},
-std::array<float,2>{0.342460155f, 0.926546514f},
-std::array<float,2>{0.514203668f, 0.848990679f},
-std::array<float,2>{0.380465299f, 0.298301131f},
-std::array<float,2>{0.970095873f, 0.0282839481f},
-std::array<float,2>{0.0187351592f, 0.728901744f},
-std::array<float,2>{0.630261779f, 0.507778347f},
-std::array<float,2>{0.320860803f, 0.24187848f},
-std::array<float,2>{0.779855728f, 0.395337552f},
-std::array<float,2>{0.19901973f, 0.877096474f},
-std::array<float,2>{0.994267821f, 0.814717531f},
-std::array<float,2>{0.00946508348f, 0.251956195f},
-std::array<float,2>{0.51646781f, 0.0379437543f},
-std::array<float,2>{0.406210631f, 0.709547579f},
-std::array<float,2>{0.869670928f, 0.642006636f},
-std::array<float,2>{0.145957664f, 0.0807693824f},
-std::array<float,2>{0.739003658f, 0.314079136f},
-std::array<float,2>{0.30635345f, 0.762881637f},
-std::array<float,2>{0.588529706f, 0.972729504f},
-std::array<float,2>{0.45856595f, 0.444973171f},
-std::array<float,2>{0.900973558f, 0.184718415f},
-std::array<float,2>{0.0830106586f, 0.599553645f},
-std::array<float,2>{0.549323559f, 0.744615793f},
-std::array<float,2>{0.433905721f, 0.00304988772f},
-std::array<float,2>{0.941520393f, 0.289138824f},
-std::array<float,2>{0.0481746607f, 0.86297971f},
-std::array<float,2>{0.804341018f, 0.911889613f},
-std::array<float,2>{0.230613708f, 0.424051076f},
-std::array<float,2>{0.68239677f, 0.207610041f},
-std::array<float,2>{0.357736975f, 0.532094181f},
-std::array<float,2>{0.917905688f, 0.575593114f},
-std::array<float,2>{0.103310809f, 0.143119037f},
-std::array<float,2>{0.624775231f, 0.48581022f},
-std::array<float,2>{0.475005299f, 0.957481563f},
-std::array<float,2>{0.698965967f, 0.787430406f},
-std::array<float,2>{0.273486644f, 0.359041333f},
-std::array<float,2>{0.82272464f, 0.11435733f},
-std::array<float,2>{0.168909967f, 0.683422863f},
-std::array<float,2>{0.532126427f, 0.566513836f},
-std::array<float,2>{0.420597285f, 0.152734607f},
-std::array<float,2>{0.953344822f, 0.493415266f},
-std::array<float,2>{0.0417433828f, 0.964194655f},
-std::array<float,2>{0.789974451f, 0.791595817f},
-std::array<float,2>{0.249906942f, 0.350512087f},
-std::array<float,2>{0.669337988f, 0.118705615f},
-std::array<float,2>{0.374291629f, 0.676495373f},
-std::array<float,2>{0.931803167f, 0.736098111f},
-std::array<float,2>{0.11146374f, 0.00830196775f},
-std::array<float,2>{0.597573876f, 0.284971476f},
-std::array<float,2>{0.493792146f, 0.868473887f},
-std::array<float,2>{0.714483798f, 0.915405273f},
-std::array<float,2>{0.25263378f, 0.434888154f},
-std::array<float,2>{0.832490146f, 0.215726316f},
-std::array<float,2>{0.182269976f, 0.540580928f},
-std::array<float,2>{0.652061939f, 0.650163293f},
-std::array<float,2>{0.336598516f, 0.0923093855f},
-std::array<float,2>{0.750663102f, 0.320512444f},
-std::array<float,2>{0.217492729f, 0.754032969f},
-std::array<float,2>{0.976299345f, 0.984339058f},
-std::array<float,2>{0.0219236445f, 0.450235724f},
-std::array<float,2>{0.508893728f, 0.177105412f},
-std::array<float,2>{0.376203179f, 0.606122911f},
-std::array<float,2>{0.85851258f, 0.51238662f},
-std::array<float,2>{0.13344191f, 0.246583968f},
-std::array<float,2>{0.724771976f, 0.405324072f},
-std::array<float,2>{0.289504439f, 0.883076489f},
-std::array<float,2>{0.572197139f, 0.82731688f},
-std::array<float,2>{0.448539644f, 0.25804472f},
-std::array<float,2>{0.883142173f, 0.0438808836f},
-std::array<float,2>{0.0730686337f, 0.711353898f},
-std::array<float,2>{0.735360622f, 0.55989027f},
-std::array<float,2>{0.310684979f, 0.191984385f},
-std::array<float,2>{0.87286818f, 0.407463759f},
-std::array<float,2>{0.143852532f, 0.932954013f},
-std::array<float,2>{0.904706717f, 0.854682982f},
-std::array<float,2>{0.0795978829f, 0.308682531f},
-std::array<float,2>{0.592667878f, 0.0184807759f},
-std::array<float,2>{0.45696491f, 0.718971312f},
-std::array<float,2>{0.77554661f, 0.664220572f},
-std::array<float,2>{0.201254427f, 0.101164311f},
-std::array<float,2>{0.625047863f, 0.368722379f},
-std::array<float,2>{0.32538867f, 0.80183965f},
-std::array<float,2>{0.520258665f, 0.952441454f},
-std::array<float,2>{0.400899172f, 0.475530833f},
-std::array<float,2>{0.996692657f, 0.126847506f},
-std::array<float,2>{0.0148416404f, 0.591571152f},
-std::array<float,2>{0.620247483f, 0.697485089f},
-std::array<float,2>{0.469216913f, 0.0536675416f},
-std::array<float,2>{0.921177208f, 0.276536226f},
-std::array<float,2>{0.108527713f, 0.837384522f},
-std::array<float,2>{0.824540854f, 0.903774619f},
-std::array<float,2>{0.165491194f, 0.389225692f},
-std::array<float,2>{0.701543868f, 0.22932972f},
-std::array<float,2>{0.27786386f, 0.527195513f},
-std::array<float,2>{0.940733612f, 0.611833274f},
-std::array<float,2>{0.0511258058f, 0.170709163f},
-std::array<float,2>{0.55439651f, 0.458376944f},
-std::array<float,2>{0.431811839f, 0.996007979f},
-std::array<float,2>{0.684196949f, 0.76720196f},
-std::array<float,2>{0.352436274f, 0.332302541f},
-std::array<float,2>{0.799908698f, 0.0704891533f},
-std::array<float,2>{0.228946626f, 0.630082607f},
-std::array<float,2>{0.578719318f, 0.523059964f},
-std::array<float,2>{0.466089994f, 0.225825027f},
-std::array<float,2>{0.896854758f, 0.375015974f},
-std::array<float,2>{0.0872437879f, 0.894009531f},
-std::array<float,2>{0.863250852f, 0.835917771f},
-std::array<float,2>{0.154362544f, 0.271505386f},
-std::array<float,2>{0.746870518f, 0.0567310452f},
-std::array<float,2>{0.299345165f, 0.691797435f},
-std::array<float,2>{0.989791632f, 0.635905623f},
-std::array<float,2>{0.00175495842f, 0.0628005266f},
-std::array<float,2>{0.530234039f, 0.338614047f},
-std::array<float,2>{0.396874011f, 0.780558288f},
-std::array<float,2>{0.63972491f, 0.98793751f},
-std::array<float,2>{0.316234976f, 0.46645537f},
-std::array<float,2>{0.771995544f, 0.164012164f},
-std::array<float,2>{0.187969849f, 0.622756839f},
-std::array<float,2>{0.692540884f, 0.733654976f},
-std::array<float,2>{0.267405927f, 0.0240750704f},
-std::array<float,2>{0.819384277f, 0.303764671f},
-std::array<float,2>{0.163392216f, 0.845201671f},
-std::array<float,2>{0.911971986f, 0.923300683f},
-std::array<float,2>{0.0993480161f, 0.419431537f},
-std::array<float,2>{0.6150949f, 0.199885562f},
-std::array<float,2>{0.48236531f, 0.548700392f},
-std::array<float,2>{0.810665071f, 0.578615487f},
-std::array<float,2>{0.226351053f, 0.138333872f},
-std::array<float,2>{0.673787534f, 0.483029991f},
-std::array<float,2>{0.343851894f, 0.944611788f},
-std::array<float,2>{0.558930457f, 0.807207823f},
-std::array<float,2>{0.427686185f, 0.365563273f},
-std::array<float,2>{0.949665189f, 0.102530904f},
-std::array<float,2>{0.0570541359f, 0.658825576f},
-std::array<float,2>{0.663412213f, 0.595210135f},
-std::array<float,2>{0.365199417f, 0.181160867f},
-std::array<float,2>{0.787125528f, 0.440187126f},
-std::array<float,2>{0.236869067f, 0.970520258f},
-std::array<float,2>{0.967727721f, 0.759028435f},
-std::array<float,2>{0.0348757058f, 0.316899717f},
-std::array<float,2>{0.543059647f, 0.0821915865f},
-std::array<float,2>{0.413337141f, 0.646120071f},
-std::array<float,2>{0.840450883f, 0.706264496f},
-std::array<float,2>{0.179295018f, 0.0319208726f},
-std::array<float,2>{0.710057199f, 0.253993541f},
-std::array<float,2>{0.262751311f, 0.81972611f},
-std::array<float,2>{0.603748202f, 0.879831433f},
-std::array<float,2>{0.48526293f, 0.393576503f},
-std::array<float,2>{0.923185587f, 0.236184582f},
-std::array<float,2>{0.120946325f, 0.501105607f},
-std::array<float,2>{0.5047369f, 0.686834991f},
-std::array<float,2>{0.383874089f, 0.112465307f},
-std::array<float,2>{0.978879869f, 0.355089158f},
-std::array<float,2>{0.0256181564f, 0.78345865f},
-std::array<float,2>{0.765352607f, 0.956765831f},
-std::array<float,2>{0.210565194f, 0.489905715f},
-std::array<float,2>{0.64631319f, 0.144652516f},
-std::array<float,2>{0.332010984f, 0.570480406f},
-std::array<float,2>{0.875141323f, 0.53622216f},
-std::array<float,2>{0.0681062639f, 0.206302464f},
-std::array<float,2>{0.566038966f, 0.428797007f},
-std::array<float,2>{0.443508118f, 0.906866431f},
-std::array<float,2>{0.730184197f, 0.864296138f},
-std::array<float,2>{0.288361341f, 0.293199152f},
-std::array<float,2>{0.851152956f, 0.00509006856f},
-std::array<float,2>{0.126427412f, 0.748107672f},
-std::array<float,2>{0.50301981f, 0.528173506f},
-std::array<float,2>{0.388485044f, 0.233117074f},
-std::array<float,2>{0.980542183f, 0.38591513f},
-std::array<float,2>{0.0288303513f, 0.901155353f},
-std::array<float,2>{0.759816408f, 0.84180373f},
-std::array<float,2>{0.20321916f, 0.27929914f},
-std::array<float,2>{0.643446028f, 0.0498432815f},
-std::array<float,2>{0.333021104f, 0.702007294f},
-std::array<float,2>{0.879501164f, 0.628035188f},
-std::array<float,2>{0.0654785335f, 0.0767771974f},
-std::array<float,2>{0.570208967f, 0.328600675f},
-std::array<float,2>{0.437731504f, 0.771173239f},
-std::array<float,2>{0.733097911f, 0.997852504f},
-std::array<float,2>{0.28221935f, 0.456571758f},
-std::array<float,2>{0.844497919f, 0.165795043f},
-std::array<float,2>{0.130148843f, 0.615287662f},
-std::array<float,2>{0.660135448f, 0.723256171f},
-std::array<float,2>{0.359767824f, 0.0233963709f},
-std::array<float,2>{0.782755613f, 0.305281103f},
-std::array<float,2>{0.239934087f, 0.858305573f},
-std::array<float,2>{0.964364469f, 0.934675992f},
-std::array<float,2>{0.036068745f, 0.411967874f},
-std::array<float,2>{0.540338993f, 0.188255653f},
-std::array<float,2>{0.409357965f, 0.556502521f},
-std::array<float,2>{0.836149573f, 0.587331533f},
-std::array<float,2>{0.172016725f, 0.131104648f},
-std::array<float,2>{0.705793321f, 0.469752192f},
-std::array<float,2>{0.257997483f, 0.947719216f},
-std::array<float,2>{0.607308924f, 0.798657894f},
-std::array<float,2>{0.492048472f, 0.374383003f},
-std::array<float,2>{0.926995277f, 0.0949288607f},
-std::array<float,2>{0.122362718f, 0.669401467f},
-std::array<float,2>{0.688885927f, 0.60341996f},
-std::array<float,2>{0.272920012f, 0.175660133f},
-std::array<float,2>{0.813638151f, 0.44578585f},
-std::array<float,2>{0.159357414f, 0.976681113f},
-std::array<float,2>{0.908799469f, 0.751479626f},
-std::array<float,2>{0.096714437f, 0.325025171f},
-std::array<float,2>{0.612653494f, 0.0874363109f},
-std::array<float,2>{0.479957551f, 0.653391421f},
-std::array<float,2>{0.806409478f, 0.71501565f},
-std::array<float,2>{0.220370829f, 0.0422506854f},
-std::array<float,2>{0.676776767f, 0.264243573f},
-std::array<float,2>{0.349017352f, 0.822231948f},
-std::array<float,2>{0.556118429f, 0.88871038f},
-std::array<float,2>{0.422455341f, 0.39876914f},
-std::array<float,2>{0.94655782f, 0.245523244f},
-std::array<float,2>{0.0605556332f, 0.508632421f},
-std::array<float,2>{0.582051277f, 0.672852814f},
-std::array<float,2>{0.462294132f, 0.12261866f},
-std::array<float,2>{0.892329574f, 0.34580037f},
-std::array<float,2>{0.0909729898f, 0.79654938f},
-std::array<float,2>{0.863447428f, 0.968553483f},
-std::array<float,2>{0.148601815f, 0.498081863f},
-std::array<float,2>{0.74514097f, 0.151202306f},
-std::array<float,2>{0.304399729f, 0.565671086f},
-std::array<float,2>{0.986038923f, 0.54349494f},
-std::array<float,2>{0.00481331022f, 0.211451426f},
-std::array<float,2>{0.526616454f, 0.433014035f},
-std::array<float,2>{0.39155376f, 0.918792307f},
-std::array<float,2>{0.635583341f, 0.871933818f},
-std::array<float,2>{0.3189224f, 0.287847579f},
-std::array<float,2>{0.769089341f, 0.0141531341f},
-std::array<float,2>{0.193251178f, 0.740006745f},
-std::array<float,2>{0.62373364f, 0.576748431f},
-std::array<float,2>{0.475769907f, 0.141369641f},
-std::array<float,2>{0.916241944f, 0.486423731f},
-std::array<float,2>{0.101662479f, 0.959133565f},
-std::array<float,2>{0.823256373f, 0.786426485f},
-std::array<float,2>{0.169101268f, 0.356492281f},
-std::array<float,2>{0.697943807f, 0.116119184f},
-std::array<float,2>{0.274898469f, 0.681195498f},
-std::array<float,2>{0.943176091f, 0.743112326f},
-std::array<float,2>{0.0474582873f, 0.00121201144f},
-std::array<float,2>{0.55059135f, 0.291877866f},
-std::array<float,2>{0.435089111f, 0.859971106f},
-std::array<float,2>{0.683266521f, 0.912287354f},
-std::array<float,2>{0.358985066f, 0.423666388f},
-std::array<float,2>{0.803534985f, 0.21063076f},
-std::array<float,2>{0.231938258f, 0.535056472f},
-std::array<float,2>{0.739452422f, 0.643165767f},
-std::array<float,2>{0.305266082f, 0.0784770772f},
-std::array<float,2>{0.870870888f, 0.315404713f},
-std::array<float,2>{0.144943595f, 0.763700604f},
-std::array<float,2>{0.90181303f, 0.976373434f},
-std::array<float,2>{0.0822117627f, 0.442043185f},
-std::array<float,2>{0.589346826f, 0.1871856f},
-std::array<float,2>{0.45719713f, 0.600785613f},
-std::array<float,2>{0.780714333f, 0.505777955f},
-std::array<float,2>{0.1978136f, 0.238676205f},
-std::array<float,2>{0.629437208f, 0.397159338f},
-std::array<float,2>{0.322218388f, 0.87649405f},
-std::array<float,2>{0.516806662f, 0.81290406f},
-std::array<float,2>{0.40501231f, 0.251567423f},
-std::array<float,2>{0.995182276f, 0.0355818309f},
-std::array<float,2>{0.00845719315f, 0.708171904f},
-std::array<float,2>{0.655451715f, 0.552943945f},
-std::array<float,2>{0.343370497f, 0.197253615f},
-std::array<float,2>{0.755790353f, 0.415014267f},
-std::array<float,2>{0.212677434f, 0.928218484f},
-std::array<float,2>{0.969460964f, 0.849745274f},
-std::array<float,2>{0.0178868901f, 0.300445765f},
-std::array<float,2>{0.514960349f, 0.0296025928f},
-std::array<float,2>{0.379787445f, 0.728320062f},
-std::array<float,2>{0.855294228f, 0.66158694f},
-std::array<float,2>{0.138502687f, 0.108344488f},
-std::array<float,2>{0.722174704f, 0.360520244f},
-std::array<float,2>{0.295402586f, 0.810123265f},
-std::array<float,2>{0.575352192f, 0.940087795f},
-std::array<float,2>{0.449784398f, 0.476930797f},
-std::array<float,2>{0.887305915f, 0.13358736f},
-std::array<float,2>{0.0774459913f, 0.58593154f},
-std::array<float,2>{0.538933218f, 0.690278769f},
-std::array<float,2>{0.414398551f, 0.0587347895f},
-std::array<float,2>{0.958063483f, 0.267358661f},
-std::array<float,2>{0.0437167138f, 0.829954386f},
-std::array<float,2>{0.794336736f, 0.895879984f},
-std::array<float,2>{0.245887354f, 0.380705744f},
-std::array<float,2>{0.664973557f, 0.22107318f},
-std::array<float,2>{0.368649602f, 0.51916796f},
-std::array<float,2>{0.93480736f, 0.619711101f},
-std::array<float,2>{0.114376947f, 0.157836318f},
-std::array<float,2>{0.601053834f, 0.462123424f},
-std::array<float,2>{0.499604434f, 0.990292013f},
-std::array<float,2>{0.717678964f, 0.773622215f},
-std::array<float,2>{0.254798651f, 0.340084881f},
-std::array<float,2>{0.830344558f, 0.0666311011f},
-std::array<float,2>{0.186632693f, 0.637541533f},
-std::array<float,2>{0.553161442f, 0.611270368f},
-std::array<float,2>{0.432666421f, 0.169366553f},
-std::array<float,2>{0.939482391f, 0.459747076f},
-std::array<float,2>{0.0526865311f, 0.993910193f},
-std::array<float,2>{0.799114048f, 0.767636776f},
-std::array<float,2>{0.230300546f, 0.33446613f},
-std::array<float,2>{0.685295701f, 0.0736457705f},
-std::array<float,2>{0.352710247f, 0.631819904f},
-std::array<float,2>{0.920540154f, 0.696899176f},
-std::array<float,2>{0.108170897f, 0.0525569543f},
-std::array<float,2>{0.619366467f, 0.273753792f},
-std::array<float,2>{0.470561296f, 0.838338196f},
-std::array<float,2>{0.702252805f, 0.904377997f},
-std::array<float,2>{0.279181689f, 0.387573361f},
-std::array<float,2>{0.82541728f, 0.227765366f},
-std::array<float,2>{0.165013999f, 0.524664044f},
-std::array<float,2>{0.626557529f, 0.666960359f},
-std::array<float,2>{0.325092733f, 0.0991044566f},
-std::array<float,2>{0.777332604f, 0.370767653f},
-std::array<float,2>{0.202327818f, 0.803179204f},
-std::array<float,2>{0.997808754f, 0.950444698f},
-std::array<float,2>{0.0137675731f, 0.472682685f},
-std::array<float,2>{0.521431386f, 0.127071708f},
-std::array<float,2>{0.402146101f, 0.59344995f},
-std::array<float,2>{0.871333182f, 0.561790884f},
-std::array<float,2>{0.143419534f, 0.19369711f},
-std::array<float,2>{0.735154331f, 0.409456432f},
-std::array<float,2>{0.311816424f, 0.931337476f},
-std::array<float,2>{0.593507767f, 0.852000594f},
-std::array<float,2>{0.455374271f, 0.311193794f},
-std::array<float,2>{0.905939043f, 0.0165534001f},
-std::array<float,2>{0.0783034042f, 0.721679688f},
-std::array<float,2>{0.725805104f, 0.515020669f},
-std::array<float,2>{0.290782273f, 0.248609602f},
-std::array<float,2>{0.857738435f, 0.404294908f},
-std::array<float,2>{0.133791998f, 0.88499248f},
-std::array<float,2>{0.884447098f, 0.825160086f},
-std::array<float,2>{0.0733935237f, 0.259915859f},
-std::array<float,2>{0.570781529f, 0.046263054f},
-std::array<float,2>{0.447965413f, 0.714249134f},
-std::array<float,2>{0.751579404f, 0.651347101f},
-std::array<float,2>{0.217858657f, 0.0911452621f},
-std::array<float,2>{0.651325405f, 0.322874695f},
-std::array<float,2>{0.336922407f, 0.756614625f},
-std::array<float,2>{0.508609414f, 0.982040405f},
-std::array<float,2>{0.37568146f, 0.451737493f},
-std::array<float,2>{0.975403011f, 0.179104298f},
-std::array<float,2>{0.0232127458f, 0.607797861f},
-std::array<float,2>{0.596350849f, 0.738179505f},
-std::array<float,2>{0.492621839f, 0.0104212165f},
-std::array<float,2>{0.93334651f, 0.283201128f},
-std::array<float,2>{0.112855099f, 0.869761527f},
-std::array<float,2>{0.833820701f, 0.916086435f},
-std::array<float,2>{0.182995558f, 0.436670899f},
-std::array<float,2>{0.713699639f, 0.218440041f},
-std::array<float,2>{0.253006995f, 0.541258693f},
-std::array<float,2>{0.954713762f, 0.569590509f},
-std::array<float,2>{0.0425746813f, 0.155251861f},
-std::array<float,2>{0.532509387f, 0.495987207f},
-std::array<float,2>{0.421654522f, 0.962624729f},
-std::array<float,2>{0.668312848f, 0.790684342f},
-std::array<float,2>{0.373647422f, 0.348112345f},
-std::array<float,2>{0.790365934f, 0.120324455f},
-std::array<float,2>{0.248504072f, 0.677937984f},
-std::array<float,2>{0.564778447f, 0.537484646f},
-std::array<float,2>{0.444883525f, 0.203256831f},
-std::array<float,2>{0.876775682f, 0.425996512f},
-std::array<float,2>{0.0664608777f, 0.908328593f},
-std::array<float,2>{0.850078583f, 0.866962612f},
-std::array<float,2>{0.12558578f, 0.29576394f},
-std::array<float,2>{0.728779078f, 0.0070139477f},
-std::array<float,2>{0.287531286f, 0.746544302f},
-std::array<float,2>{0.979574859f, 0.683600008f},
-std::array<float,2>{0.0267275646f, 0.110687904f},
-std::array<float,2>{0.505845189f, 0.351857901f},
-std::array<float,2>{0.38331601f, 0.783095241f},
-std::array<float,2>{0.645130217f, 0.953165472f},
-std::array<float,2>{0.330977887f, 0.490453601f},
-std::array<float,2>{0.764086306f, 0.147918597f},
-std::array<float,2>{0.209880337f, 0.573413372f},
-std::array<float,2>{0.709921598f, 0.704490185f},
-std::array<float,2>{0.262325495f, 0.0348691642f},
-std::array<float,2>{0.84171778f, 0.257746398f},
-std::array<float,2>{0.177994043f, 0.817655206f},
-std::array<float,2>{0.92269522f, 0.881806791f},
-std::array<float,2>{0.119964004f, 0.390920937f},
-std::array<float,2>{0.604542017f, 0.238021791f},
-std::array<float,2>{0.486253291f, 0.503685892f},
-std::array<float,2>{0.788766325f, 0.596096337f},
-std::array<float,2>{0.237872586f, 0.182435915f},
-std::array<float,2>{0.663027406f, 0.438197464f},
-std::array<float,2>{0.364005268f, 0.971168816f},
-std::array<float,2>{0.54424113f, 0.760241807f},
-std::array<float,2>{0.412303805f, 0.31953609f},
-std::array<float,2>{0.968209743f, 0.0852233618f},
-std::array<float,2>{0.0341687314f, 0.64694947f},
-std::array<float,2>{0.672707379f, 0.581984997f},
-std::array<float,2>{0.345396668f, 0.140125886f},
-std::array<float,2>{0.811621428f, 0.480633229f},
-std::array<float,2>{0.225251526f, 0.942515612f},
-std::array<float,2>{0.950202823f, 0.805865288f},
-std::array<float,2>{0.0577168316f, 0.364227474f},
-std::array<float,2>{0.559981287f, 0.104537942f},
-std::array<float,2>{0.426341593f, 0.657282948f},
-std::array<float,2>{0.819130898f, 0.730735064f},
-std::array<float,2>{0.162967548f, 0.0272459108f},
-std::array<float,2>{0.691603661f, 0.301323265f},
-std::array<float,2>{0.265800744f, 0.845796287f},
-std::array<float,2>{0.613589704f, 0.92427808f},
-std::array<float,2>{0.480756044f, 0.420284152f},
-std::array<float,2>{0.911039054f, 0.202108994f},
-std::array<float,2>{0.0978323743f, 0.549467921f},
-std::array<float,2>{0.531153321f, 0.634176672f},
-std::array<float,2>{0.398219168f, 0.0647260919f},
-std::array<float,2>{0.988562882f, 0.336123943f},
-std::array<float,2>{0.00013063052f, 0.777395546f},
-std::array<float,2>{0.772819698f, 0.98609513f},
-std::array<float,2>{0.189300895f, 0.467462152f},
-std::array<float,2>{0.639035463f, 0.161204308f},
-std::array<float,2>{0.314927369f, 0.624692738f},
-std::array<float,2>{0.898088157f, 0.520091712f},
-std::array<float,2>{0.0864416361f, 0.22451742f},
-std::array<float,2>{0.579646945f, 0.378855169f},
-std::array<float,2>{0.465241194f, 0.891648829f},
-std::array<float,2>{0.747911215f, 0.83394599f},
-std::array<float,2>{0.30066976f, 0.271022201f},
-std::array<float,2>{0.861717105f, 0.0550922379f},
-std::array<float,2>{0.155604362f, 0.693723857f},
-std::array<float,2>{0.541869938f, 0.557921529f},
-std::array<float,2>{0.407804996f, 0.191281572f},
-std::array<float,2>{0.961001217f, 0.414014578f},
-std::array<float,2>{0.0377980955f, 0.937238157f},
-std::array<float,2>{0.783917129f, 0.856844544f},
-std::array<float,2>{0.241312906f, 0.308259279f},
-std::array<float,2>{0.658130765f, 0.0205600932f},
-std::array<float,2>{0.362803131f, 0.726448357f},
-std::array<float,2>{0.9294191f, 0.671552181f},
-std::array<float,2>{0.123521052f, 0.0966599286f},
-std::array<float,2>{0.608988106f, 0.371935725f},
-std::array<float,2>{0.489548832f, 0.800632298f},
-std::array<float,2>{0.704771161f, 0.94659102f},
-std::array<float,2>{0.26063934f, 0.470946074f},
-std::array<float,2>{0.838136315f, 0.130839795f},
-std::array<float,2>{0.17569004f, 0.588483036f},
-std::array<float,2>{0.640862167f, 0.699459076f},
-std::array<float,2>{0.334596306f, 0.0469904505f},
-std::array<float,2>{0.759225726f, 0.278690696f},
-std::array<float,2>{0.206890985f, 0.840035141f},
-std::array<float,2>{0.98262769f, 0.898784459f},
-std::array<float,2>{0.0300575588f, 0.383451223f},
-std::array<float,2>{0.501438498f, 0.231566459f},
-std::array<float,2>{0.389188498f, 0.530755043f},
-std::array<float,2>{0.845906913f, 0.614334285f},
-std::array<float,2>{0.132258579f, 0.167824894f},
-std::array<float,2>{0.730810523f, 0.453889638f},
-std::array<float,2>{0.285075516f, 0.999366939f},
-std::array<float,2>{0.566587567f, 0.77220279f},
-std::array<float,2>{0.439590633f, 0.330417901f},
-std::array<float,2>{0.882250547f, 0.0752857253f},
-std::array<float,2>{0.0626787767f, 0.625071228f},
-std::array<float,2>{0.743345559f, 0.562518656f},
-std::array<float,2>{0.302642226f, 0.149035856f},
-std::array<float,2>{0.867078304f, 0.497391701f},
-std::array<float,2>{0.152008533f, 0.966050029f},
-std::array<float,2>{0.893277943f, 0.79415828f},
-std::array<float,2>{0.0919769257f, 0.345213085f},
-std::array<float,2>{0.58568722f, 0.123760417f},
-std::array<float,2>{0.46445179f, 0.674774289f},
-std::array<float,2>{0.766067803f, 0.740835786f},
-std::array<float,2>{0.193596244f, 0.0119854324f},
-std::array<float,2>{0.633892357f, 0.286808461f},
-std::array<float,2>{0.318294227f, 0.874193013f},
-std::array<float,2>{0.524268568f, 0.920992851f},
-std::array<float,2>{0.394451857f, 0.430168062f},
-std::array<float,2>{0.987427533f, 0.214829072f},
-std::array<float,2>{0.00666306447f, 0.545057118f},
-std::array<float,2>{0.609861016f, 0.654824913f},
-std::array<float,2>{0.476985008f, 0.0897041559f},
-std::array<float,2>{0.907785118f, 0.327706039f},
-std::array<float,2>{0.0938512832f, 0.753851414f},
-std::array<float,2>{0.814503908f, 0.980465591f},
-std::array<float,2>{0.1578684f, 0.447787404f},
-std::array<float,2>{0.691253722f, 0.17292124f},
-std::array<float,2>{0.271263689f, 0.604314864f},
-std::array<float,2>{0.949195445f, 0.510364234f},
-std::array<float,2>{0.0587021299f, 0.242539465f},
-std::array<float,2>{0.556843817f, 0.400735945f},
-std::array<float,2>{0.425414801f, 0.888501167f},
-std::array<float,2>{0.678107202f, 0.822476804f},
-std::array<float,2>{0.350640655f, 0.262820303f},
-std::array<float,2>{0.807545304f, 0.0394016281f},
-std::array<float,2>{0.22225754f, 0.717693448f},
-std::array<float,2>{0.587365925f, 0.598086238f},
-std::array<float,2>{0.460486501f, 0.184414268f},
-std::array<float,2>{0.900040507f, 0.44423306f},
-std::array<float,2>{0.0853446797f, 0.974016905f},
-std::array<float,2>{0.867738247f, 0.761855304f},
-std::array<float,2>{0.146654516f, 0.313023329f},
-std::array<float,2>{0.740376472f, 0.0816558152f},
-std::array<float,2>{0.30799827f, 0.641286135f},
-std::array<float,2>{0.99228251f, 0.710545957f},
-std::array<float,2>{0.0107182181f, 0.0383989699f},
-std::array<float,2>{0.517993569f, 0.253431827f},
-std::array<float,2>{0.404173523f, 0.815811396f},
-std::array<float,2>{0.631627917f, 0.878189325f},
-std::array<float,2>{0.323524863f, 0.395627975f},
-std::array<float,2>{0.778918207f, 0.241196424f},
-std::array<float,2>{0.195755601f, 0.506808341f},
-std::array<float,2>{0.695914626f, 0.682265162f},
-std::array<float,2>{0.276414871f, 0.114253722f},
-std::array<float,2>{0.820608616f, 0.357961178f},
-std::array<float,2>{0.171308279f, 0.788553238f},
-std::array<float,2>{0.915867567f, 0.958248854f},
-std::array<float,2>{0.105271585f, 0.484912276f},
-std::array<float,2>{0.622166693f, 0.144441038f},
-std::array<float,2>{0.474296778f, 0.574692607f},
-std::array<float,2>{0.800932825f, 0.532550514f},
-std::array<float,2>{0.233142599f, 0.208775356f},
-std::array<float,2>{0.679715157f, 0.425667673f},
-std::array<float,2>{0.355800807f, 0.91022402f},
-std::array<float,2>{0.548584342f, 0.861753702f},
-std::array<float,2>{0.436219543f, 0.290617764f},
-std::array<float,2>{0.944805086f, 0.0020428549f},
-std::array<float,2>{0.049661722f, 0.746005118f},
-std::array<float,2>{0.666818082f, 0.515753865f},
-std::array<float,2>{0.369183451f, 0.219645858f},
-std::array<float,2>{0.795949757f, 0.382156104f},
-std::array<float,2>{0.243536755f, 0.896705925f},
-std::array<float,2>{0.960087478f, 0.831930041f},
-std::array<float,2>{0.0449509211f, 0.267706275f},
-std::array<float,2>{0.536603034f, 0.062320739f},
-std::array<float,2>{0.416045427f, 0.688617289f},
-std::array<float,2>{0.828180254f, 0.639166772f},
-std::array<float,2>{0.184865385f, 0.0685598478f},
-std::array<float,2>{0.715449035f, 0.342060238f},
-std::array<float,2>{0.2559295f, 0.775755823f},
-std::array<float,2>{0.597799063f, 0.988408387f},
-std::array<float,2>{0.496855825f, 0.464630574f},
-std::array<float,2>{0.936124325f, 0.158211336f},
-std::array<float,2>{0.116041899f, 0.617331624f},
-std::array<float,2>{0.511823595f, 0.73013103f},
-std::array<float,2>{0.382286459f, 0.0289710239f},
-std::array<float,2>{0.971543908f, 0.297820687f},
-std::array<float,2>{0.0161382183f, 0.847699463f},
-std::array<float,2>{0.757523894f, 0.927083969f},
-std::array<float,2>{0.213418275f, 0.417330652f},
-std::array<float,2>{0.652886152f, 0.197741836f},
-std::array<float,2>{0.340290308f, 0.551672757f},
-std::array<float,2>{0.888892055f, 0.583849132f},
-std::array<float,2>{0.0758635923f, 0.136412829f},
-std::array<float,2>{0.576914608f, 0.480320275f},
-std::array<float,2>{0.451966196f, 0.93763715f},
-std::array<float,2>{0.718829989f, 0.810824573f},
-std::array<float,2>{0.294264346f, 0.361338884f},
-std::array<float,2>{0.853246629f, 0.106382318f},
-std::array<float,2>{0.138933316f, 0.663376927f},
-std::array<float,2>{0.52289021f, 0.590676367f},
-std::array<float,2>{0.398534745f, 0.125828251f},
-std::array<float,2>{0.998335183f, 0.47606945f},
-std::array<float,2>{0.0136138471f, 0.951577187f},
-std::array<float,2>{0.774610758f, 0.8017115f},
-std::array<float,2>{0.199492112f, 0.367375195f},
-std::array<float,2>{0.628559768f, 0.100134455f},
-std::array<float,2>{0.326371104f, 0.665667295f},
-std::array<float,2>{0.904165328f, 0.720604181f},
-std::array<float,2>{0.0816640034f, 0.019325804f},
-std::array<float,2>{0.591534793f, 0.310066283f},
-std::array<float,2>{0.453352302f, 0.854054451f},
-std::array<float,2>{0.737595856f, 0.931721747f},
-std::array<float,2>{0.309699833f, 0.406513005f},
-std::array<float,2>{0.874254465f, 0.192505524f},
-std::array<float,2>{0.141569063f, 0.558621645f},
-std::array<float,2>{0.687066078f, 0.629774272f},
-std::array<float,2>{0.353928208f, 0.0716091469f},
-std::array<float,2>{0.79800421f, 0.333928704f},
-std::array<float,2>{0.226626948f, 0.765664041f},
-std::array<float,2>{0.939448535f, 0.995010138f},
-std::array<float,2>{0.0536114164f, 0.457913429f},
-std::array<float,2>{0.551337123f, 0.171779394f},
-std::array<float,2>{0.430818677f, 0.612965167f},
-std::array<float,2>{0.827250898f, 0.525760949f},
-std::array<float,2>{0.166156694f, 0.230294794f},
-std::array<float,2>{0.699829876f, 0.389989644f},
-std::array<float,2>{0.280938923f, 0.903125226f},
-std::array<float,2>{0.618446171f, 0.836335599f},
-std::array<float,2>{0.471530735f, 0.276117355f},
-std::array<float,2>{0.918074012f, 0.0541418269f},
-std::array<float,2>{0.106368184f, 0.698955894f},
-std::array<float,2>{0.712035358f, 0.539975166f},
-std::array<float,2>{0.250319004f, 0.216768041f},
-std::array<float,2>{0.834787846f, 0.433604479f},
-std::array<float,2>{0.180321246f, 0.914759457f},
-std::array<float,2>{0.93108952f, 0.867583632f},
-std::array<float,2>{0.110509604f, 0.283486485f},
-std::array<float,2>{0.59407264f, 0.00920436997f},
-std::array<float,2>{0.495403618f, 0.734566271f},
-std::array<float,2>{0.791634381f, 0.677652955f},
-std::array<float,2>{0.246388644f, 0.117323585f},
-std::array<float,2>{0.671590865f, 0.351134926f},
-std::array<float,2>{0.371458501f, 0.792648077f},
-std::array<float,2>{0.53347367f, 0.963786781f},
-std::array<float,2>{0.41877684f, 0.492794842f},
-std::array<float,2>{0.955966234f, 0.15361847f},
-std::array<float,2>{0.0402990319f, 0.568127513f},
-std::array<float,2>{0.573178172f, 0.712751746f},
-std::array<float,2>{0.445612341f, 0.0445062332f},
-std::array<float,2>{0.885818541f, 0.259087563f},
-std::array<float,2>{0.0717026368f, 0.826188445f},
-std::array<float,2>{0.855670989f, 0.884126842f},
-std::array<float,2>{0.136057407f, 0.405041575f},
-std::array<float,2>{0.72365582f, 0.24751468f},
-std::array<float,2>{0.292481005f, 0.512818873f},
-std::array<float,2>{0.973909914f, 0.606517076f},
-std::array<float,2>{0.0213261321f, 0.175783426f},
-std::array<float,2>{0.511124551f, 0.449522674f},
-std::array<float,2>{0.378546864f, 0.983205914f},
-std::array<float,2>{0.649623275f, 0.755675197f},
-std::array<float,2>{0.338826209f, 0.322072119f},
-std::array<float,2>{0.752521098f, 0.0937010124f},
-std::array<float,2>{0.216631427f, 0.648561716f},
-std::array<float,2>{0.603225172f, 0.500750184f},
-std::array<float,2>{0.48768121f, 0.235213771f},
-std::array<float,2>{0.925744951f, 0.392803222f},
-std::array<float,2>{0.118443102f, 0.879997313f},
-std::array<float,2>{0.843084276f, 0.819326222f},
-std::array<float,2>{0.176439181f, 0.255281717f},
-std::array<float,2>{0.708619714f, 0.0327378884f},
-std::array<float,2>{0.263803601f, 0.705482781f},
-std::array<float,2>{0.966391921f, 0.645381331f},
-std::array<float,2>{0.0327082165f, 0.0837317556f},
-std::array<float,2>{0.546087205f, 0.317521423f},
-std::array<float,2>{0.410485953f, 0.758070707f},
-std::array<float,2>{0.660575509f, 0.969249725f},
-std::array<float,2>{0.366082072f, 0.440675616f},
-std::array<float,2>{0.786435664f, 0.180545419f},
-std::array<float,2>{0.235677838f, 0.593813777f},
-std::array<float,2>{0.727401197f, 0.749828696f},
-std::array<float,2>{0.285354793f, 0.0048567187f},
-std::array<float,2>{0.848478973f, 0.294132859f},
-std::array<float,2>{0.127462491f, 0.864196301f},
-std::array<float,2>{0.878173113f, 0.908089221f},
-std::array<float,2>{0.0695483014f, 0.428380281f},
-std::array<float,2>{0.563497901f, 0.205705225f},
-std::array<float,2>{0.442043304f, 0.535272896f},
-std::array<float,2>{0.762821913f, 0.571594059f},
-std::array<float,2>{0.208732337f, 0.145925477f},
-std::array<float,2>{0.647977948f, 0.489117324f},
-std::array<float,2>{0.328189462f, 0.955587327f},
-std::array<float,2>{0.506980598f, 0.784787297f},
-std::array<float,2>{0.386290133f, 0.353658527f},
-std::array<float,2>{0.97729522f, 0.111671217f},
-std::array<float,2>{0.025341671f, 0.685549855f},
-std::array<float,2>{0.63685441f, 0.621934116f},
-std::array<float,2>{0.313838661f, 0.162321299f},
-std::array<float,2>{0.770631015f, 0.46577248f},
-std::array<float,2>{0.190639138f, 0.986345232f},
-std::array<float,2>{0.99137485f, 0.779635549f},
-std::array<float,2>{0.00364221237f, 0.339453936f},
-std::array<float,2>{0.528039932f, 0.0641421154f},
-std::array<float,2>{0.396290958f, 0.635112524f},
-std::array<float,2>{0.860375524f, 0.692853749f},
-std::array<float,2>{0.153074622f, 0.057634782f},
-std::array<float,2>{0.749076605f, 0.27259928f},
-std::array<float,2>{0.297870666f, 0.834092259f},
-std::array<float,2>{0.58137238f, 0.892839432f},
-std::array<float,2>{0.468549073f, 0.376083702f},
-std::array<float,2>{0.89631933f, 0.224925146f},
-std::array<float,2>{0.0879995674f, 0.521937549f},
-std::array<float,2>{0.561545551f, 0.660026729f},
-std::array<float,2>{0.429037571f, 0.102673702f},
-std::array<float,2>{0.952643692f, 0.367015481f},
-std::array<float,2>{0.054716818f, 0.808583498f},
-std::array<float,2>{0.809047878f, 0.943638206f},
-std::array<float,2>{0.223438695f, 0.483399361f},
-std::array<float,2>{0.675685406f, 0.136738434f},
-std::array<float,2>{0.34727779f, 0.579564452f},
-std::array<float,2>{0.912196577f, 0.547061384f},
-std::array<float,2>{0.101147257f, 0.200662047f},
-std::array<float,2>{0.616314054f, 0.418201596f},
-std::array<float,2>{0.483863831f, 0.922793686f},
-std::array<float,2>{0.693599164f, 0.844406486f},
-std::array<float,2>{0.267752349f, 0.303469926f},
-std::array<float,2>{0.817698658f, 0.024645485f},
-std::array<float,2>{0.160975605f, 0.733107328f},
-std::array<float,2>{0.536724985f, 0.518995881f},
-std::array<float,2>{0.416564345f, 0.221435368f},
-std::array<float,2>{0.960864723f, 0.380004287f},
-std::array<float,2>{0.0458588675f, 0.896202147f},
-std::array<float,2>{0.796642959f, 0.829308987f},
-std::array<float,2>{0.243903011f, 0.267042786f},
-std::array<float,2>{0.666139007f, 0.0592828579f},
-std::array<float,2>{0.370042026f, 0.689919531f},
-std::array<float,2>{0.935979247f, 0.636883914f},
-std::array<float,2>{0.11524009f, 0.0673271194f},
-std::array<float,2>{0.598404884f, 0.340487182f},
-std::array<float,2>{0.496417373f, 0.774047494f},
-std::array<float,2>{0.715061009f, 0.991120398f},
-std::array<float,2>{0.256777883f, 0.462611943f},
-std::array<float,2>{0.82906884f, 0.157679975f},
-std::array<float,2>{0.185334608f, 0.619486451f},
-std::array<float,2>{0.652412117f, 0.727810264f},
-std::array<float,2>{0.340493798f, 0.030092977f},
-std::array<float,2>{0.757169127f, 0.300083756f},
-std::array<float,2>{0.212986007f, 0.850165486f},
-std::array<float,2>{0.970885932f, 0.928506553f},
-std::array<float,2>{0.0159535557f, 0.414127856f},
-std::array<float,2>{0.51266402f, 0.196617931f},
-std::array<float,2>{0.382545441f, 0.553700328f},
-std::array<float,2>{0.852544308f, 0.585125268f},
-std::array<float,2>{0.139493227f, 0.133225188f},
-std::array<float,2>{0.719696105f, 0.477141559f},
-std::array<float,2>{0.294544011f, 0.93990469f},
-std::array<float,2>{0.576411486f, 0.809702694f},
-std::array<float,2>{0.451542228f, 0.36125654f},
-std::array<float,2>{0.889265895f, 0.107538901f},
-std::array<float,2>{0.0756580234f, 0.661742747f},
-std::array<float,2>{0.741102695f, 0.601439238f},
-std::array<float,2>{0.308366776f, 0.186859787f},
-std::array<float,2>{0.867394507f, 0.44150126f},
-std::array<float,2>{0.147083029f, 0.975985289f},
-std::array<float,2>{0.899638176f, 0.764593959f},
-std::array<float,2>{0.085934937f, 0.314548194f},
-std::array<float,2>{0.587840676f, 0.0787278041f},
-std::array<float,2>{0.460017204f, 0.64259541f},
-std::array<float,2>{0.778725624f, 0.70885843f},
-std::array<float,2>{0.195841983f, 0.0357035995f},
-std::array<float,2>{0.630949259f, 0.25143373f},
-std::array<float,2>{0.323916405f, 0.813278854f},
-std::array<float,2>{0.518109322f, 0.876186907f},
-std::array<float,2>{0.403729677f, 0.396484554f},
-std::array<float,2>{0.992942095f, 0.239048898f},
-std::array<float,2>{0.0101292683f, 0.505096734f},
-std::array<float,2>{0.622831106f, 0.680703938f},
-std::array<float,2>{0.474055529f, 0.115424834f},
-std::array<float,2>{0.915180922f, 0.35714367f},
-std::array<float,2>{0.104663752f, 0.787107527f},
-std::array<float,2>{0.821265757f, 0.959763765f},
-std::array<float,2>{0.171598554f, 0.487220496f},
-std::array<float,2>{0.695464373f, 0.140809998f},
-std::array<float,2>{0.277328551f, 0.576221228f},
-std::array<float,2>{0.9450894f, 0.53427875f},
-std::array<float,2>{0.049284976f, 0.210280553f},
-std::array<float,2>{0.548166811f, 0.423298329f},
-std::array<float,2>{0.435853481f, 0.913061798f},
-std::array<float,2>{0.680214047f, 0.859817147f},
-std::array<float,2>{0.356358171f, 0.291246504f},
-std::array<float,2>{0.801457942f, 0.00156351808f},
-std::array<float,2>{0.23284325f, 0.74261272f},
-std::array<float,2>{0.58526808f, 0.5663535f},
-std::array<float,2>{0.464109719f, 0.150611266f},
-std::array<float,2>{0.893050849f, 0.498892933f},
-std::array<float,2>{0.0924176648f, 0.967971444f},
-std::array<float,2>{0.866570771f, 0.795993447f},
-std::array<float,2>{0.151482761f, 0.346494585f},
-std::array<float,2>{0.744051278f, 0.122362725f},
-std::array<float,2>{0.302223474f, 0.673726439f},
-std::array<float,2>{0.988188684f, 0.739595234f},
-std::array<float,2>{0.00625428371f, 0.0141705908f},
-std::array<float,2>{0.52379173f, 0.287314504f},
-std::array<float,2>{0.393575698f, 0.871280015f},
-std::array<float,2>{0.634697437f, 0.918186605f},
-std::array<float,2>{0.317855597f, 0.433313876f},
-std::array<float,2>{0.766243815f, 0.211318523f},
-std::array<float,2>{0.194080889f, 0.542987645f},
-std::array<float,2>{0.690660417f, 0.654243529f},
-std::array<float,2>{0.270549864f, 0.0871768668f},
-std::array<float,2>{0.815043747f, 0.32442081f},
-std::array<float,2>{0.157281548f, 0.75134325f},
-std::array<float,2>{0.907655835f, 0.977060616f},
-std::array<float,2>{0.094577454f, 0.445898622f},
-std::array<float,2>{0.610341311f, 0.175155818f},
-std::array<float,2>{0.477274001f, 0.602833092f},
-std::array<float,2>{0.807036579f, 0.508004725f},
-std::array<float,2>{0.22198686f, 0.245917499f},
-std::array<float,2>{0.678695977f, 0.399144948f},
-std::array<float,2>{0.351314932f, 0.889420688f},
-std::array<float,2>{0.557544529f, 0.821770549f},
-std::array<float,2>{0.425145477f, 0.264074713f},
-std::array<float,2>{0.94857043f, 0.0428834036f},
-std::array<float,2>{0.0590996221f, 0.715544224f},
-std::array<float,2>{0.657304585f, 0.556060374f},
-std::array<float,2>{0.362322211f, 0.187691987f},
-std::array<float,2>{0.783268452f, 0.411591262f},
-std::array<float,2>{0.241853178f, 0.935345113f},
-std::array<float,2>{0.961791515f, 0.857461631f},
-std::array<float,2>{0.0372043997f, 0.305050761f},
-std::array<float,2>{0.541158497f, 0.0225640535f},
-std::array<float,2>{0.40739274f, 0.722748995f},
-std::array<float,2>{0.838743746f, 0.669780612f},
-std::array<float,2>{0.175160691f, 0.0955171809f},
-std::array<float,2>{0.704439402f, 0.37464577f},
-std::array<float,2>{0.26010552f, 0.798196316f},
-std::array<float,2>{0.608664036f, 0.948112249f},
-std::array<float,2>{0.490074068f, 0.470639378f},
-std::array<float,2>{0.928838253f, 0.131763086f},
-std::array<float,2>{0.123848125f, 0.587461889f},
-std::array<float,2>{0.501557708f, 0.701259911f},
-std::array<float,2>{0.389025718f, 0.0504764281f},
-std::array<float,2>{0.983190835f, 0.280178875f},
-std::array<float,2>{0.0293370523f, 0.842479944f},
-std::array<float,2>{0.759743035f, 0.900612891f},
-std::array<float,2>{0.206121325f, 0.386433005f},
-std::array<float,2>{0.641284406f, 0.232454121f},
-std::array<float,2>{0.334078312f, 0.527344108f},
-std::array<float,2>{0.882556736f, 0.615851402f},
-std::array<float,2>{0.0632863417f, 0.165487468f},
-std::array<float,2>{0.567377388f, 0.456392735f},
-std::array<float,2>{0.440169901f, 0.997112751f},
-std::array<float,2>{0.731305361f, 0.770773172f},
-std::array<float,2>{0.284420699f, 0.328978658f},
-std::array<float,2>{0.846544206f, 0.0765536502f},
-std::array<float,2>{0.132719606f, 0.628623247f},
-std::array<float,2>{0.527740777f, 0.624093056f},
-std::array<float,2>{0.395675689f, 0.161932394f},
-std::array<float,2>{0.991887152f, 0.467249095f},
-std::array<float,2>{0.00311002648f, 0.98574841f},
-std::array<float,2>{0.771159887f, 0.778127611f},
-std::array<float,2>{0.190996557f, 0.336824417f},
-std::array<float,2>{0.637598753f, 0.0652034506f},
-std::array<float,2>{0.314292163f, 0.634294927f},
-std::array<float,2>{0.895521641f, 0.693997204f},
-std::array<float,2>{0.0888615623f, 0.0555578247f},
-std::array<float,2>{0.581602871f, 0.270622581f},
-std::array<float,2>{0.467984021f, 0.833130956f},
-std::array<float,2>{0.749971569f, 0.89241606f},
-std::array<float,2>{0.298496068f, 0.378325403f},
-std::array<float,2>{0.860956967f, 0.223854184f},
-std::array<float,2>{0.152356759f, 0.519542634f},
-std::array<float,2>{0.674848378f, 0.657924235f},
-std::array<float,2>{0.3468256f, 0.105265468f},
-std::array<float,2>{0.809297323f, 0.363636762f},
-std::array<float,2>{0.222813353f, 0.806367159f},
-std::array<float,2>{0.952407241f, 0.943071604f},
-std::array<float,2>{0.0555286631f, 0.481333792f},
-std::array<float,2>{0.56219399f, 0.140207887f},
-std::array<float,2>{0.429460019f, 0.581514418f},
-std::array<float,2>{0.818294585f, 0.548898578f},
-std::array<float,2>{0.160406366f, 0.201543078f},
-std::array<float,2>{0.694335043f, 0.420487344f},
-std::array<float,2>{0.268402189f, 0.924505115f},
-std::array<float,2>{0.616948009f, 0.846373796f},
-std::array<float,2>{0.484181017f, 0.300844967f},
-std::array<float,2>{0.912988722f, 0.026736591f},
-std::array<float,2>{0.100711115f, 0.731002927f},
-std::array<float,2>{0.70812875f, 0.503382325f},
-std::array<float,2>{0.26433f, 0.237568289f},
-std::array<float,2>{0.843320727f, 0.391204655f},
-std::array<float,2>{0.176059857f, 0.881127775f},
-std::array<float,2>{0.925125241f, 0.818019569f},
-std::array<float,2>{0.118908599f, 0.256911397f},
-std::array<float,2>{0.602678835f, 0.0345860086f},
-std::array<float,2>{0.488279581f, 0.704867959f},
-std::array<float,2>{0.786817074f, 0.647054911f},
-std::array<float,2>{0.236291066f, 0.0858948678f},
-std::array<float,2>{0.661095977f, 0.319977224f},
-std::array<float,2>{0.365685523f, 0.760346115f},
-std::array<float,2>{0.546395063f, 0.971474051f},
-std::array<float,2>{0.410987228f, 0.43789345f},
-std::array<float,2>{0.966230154f, 0.181918532f},
-std::array<float,2>{0.0328163654f, 0.596586406f},
-std::array<float,2>{0.564376533f, 0.746950209f},
-std::array<float,2>{0.441597104f, 0.0077526425f},
-std::array<float,2>{0.878502965f, 0.295253038f},
-std::array<float,2>{0.0699122548f, 0.866545975f},
-std::array<float,2>{0.848008215f, 0.908720076f},
-std::array<float,2>{0.127104968f, 0.426413924f},
-std::array<float,2>{0.726820946f, 0.203906745f},
-std::array<float,2>{0.28579095f, 0.537701786f},
-std::array<float,2>{0.976903439f, 0.574110627f},
-std::array<float,2>{0.0248262417f, 0.148242503f},
-std::array<float,2>{0.507559717f, 0.491208524f},
-std::array<float,2>{0.386061758f, 0.953984439f},
-std::array<float,2>{0.647831559f, 0.782555342f},
-std::array<float,2>{0.328790218f, 0.352172077f},
-std::array<float,2>{0.763382018f, 0.111091204f},
-std::array<float,2>{0.208239242f, 0.684485853f},
-std::array<float,2>{0.594589591f, 0.541940272f},
-std::array<float,2>{0.49573046f, 0.217805564f},
-std::array<float,2>{0.931454241f, 0.43747896f},
-std::array<float,2>{0.111326233f, 0.916943491f},
-std::array<float,2>{0.834241271f, 0.86947751f},
-std::array<float,2>{0.180097356f, 0.282666832f},
-std::array<float,2>{0.712871373f, 0.0100346934f},
-std::array<float,2>{0.25088951f, 0.737721503f},
-std::array<float,2>{0.955523491f, 0.678459883f},
-std::array<float,2>{0.0405357406f, 0.120859317f},
-std::array<float,2>{0.533844352f, 0.348577529f},
-std::array<float,2>{0.418349326f, 0.790219069f},
-std::array<float,2>{0.671242774f, 0.961940587f},
-std::array<float,2>{0.371814013f, 0.495466024f},
-std::array<float,2>{0.791083097f, 0.154540256f},
-std::array<float,2>{0.246697679f, 0.569906473f},
-std::array<float,2>{0.724338174f, 0.714820325f},
-std::array<float,2>{0.292402953f, 0.046528317f},
-std::array<float,2>{0.856063843f, 0.260466635f},
-std::array<float,2>{0.136709392f, 0.824527144f},
-std::array<float,2>{0.886367738f, 0.885487378f},
-std::array<float,2>{0.0722495392f, 0.403564781f},
-std::array<float,2>{0.572432816f, 0.248280808f},
-std::array<float,2>{0.446109354f, 0.515617192f},
-std::array<float,2>{0.752307057f, 0.608171999f},
-std::array<float,2>{0.216029048f, 0.179457024f},
-std::array<float,2>{0.650100768f, 0.451545268f},
-std::array<float,2>{0.338363498f, 0.981588662f},
-std::array<float,2>{0.511446238f, 0.75598824f},
-std::array<float,2>{0.378142685f, 0.322730154f},
-std::array<float,2>{0.974207878f, 0.0916473344f},
-std::array<float,2>{0.0209003072f, 0.650589764f},
-std::array<float,2>{0.628283083f, 0.59294492f},
-std::array<float,2>{0.326937467f, 0.127671242f},
-std::array<float,2>{0.775181055f, 0.473372847f},
-std::array<float,2>{0.200151399f, 0.951099932f},
-std::array<float,2>{0.998769283f, 0.8035025f},
-std::array<float,2>{0.0130619649f, 0.370504737f},
-std::array<float,2>{0.523055077f, 0.0991697088f},
-std::array<float,2>{0.399146527f, 0.666302443f},
-std::array<float,2>{0.874799728f, 0.720794678f},
-std::array<float,2>{0.141057894f, 0.0158311967f},
-std::array<float,2>{0.737912536f, 0.310982257f},
-std::array<float,2>{0.310176015f, 0.852348328f},
-std::array<float,2>{0.590848565f, 0.931080699f},
-std::array<float,2>{0.454048216f, 0.409900308f},
-std::array<float,2>{0.90367347f, 0.194272369f},
-std::array<float,2>{0.0815004408f, 0.562192738f},
-std::array<float,2>{0.550848782f, 0.630902827f},
-std::array<float,2>{0.431186229f, 0.0740779936f},
-std::array<float,2>{0.938780069f, 0.334657848f},
-std::array<float,2>{0.0530164503f, 0.768166363f},
-std::array<float,2>{0.798522592f, 0.993171036f},
-std::array<float,2>{0.227133766f, 0.459414661f},
-std::array<float,2>{0.686877668f, 0.169728473f},
-std::array<float,2>{0.354007304f, 0.610391915f},
-std::array<float,2>{0.918724597f, 0.524968147f},
-std::array<float,2>{0.105665147f, 0.22848095f},
-std::array<float,2>{0.619087279f, 0.387052119f},
-std::array<float,2>{0.470938265f, 0.904923141f},
-std::array<float,2>{0.699680388f, 0.838856578f},
-std::array<float,2>{0.280622482f, 0.274053633f},
-std::array<float,2>{0.827863395f, 0.0520097166f},
-std::array<float,2>{0.166731253f, 0.696614981f},
-std::array<float,2>{0.515545309f, 0.55081141f},
-std::array<float,2>{0.379012853f, 0.198219404f},
-std::array<float,2>{0.968767941f, 0.417824805f},
-std::array<float,2>{0.018198343f, 0.927539408f},
-std::array<float,2>{0.755087852f, 0.848554075f},
-std::array<float,2>{0.212335557f, 0.297289133f},
-std::array<float,2>{0.65619117f, 0.0286781862f},
-std::array<float,2>{0.343012273f, 0.729705274f},
-std::array<float,2>{0.887096524f, 0.663872898f},
-std::array<float,2>{0.0776485577f, 0.105666675f},
-std::array<float,2>{0.575758994f, 0.362217844f},
-std::array<float,2>{0.44941017f, 0.811294556f},
-std::array<float,2>{0.721821725f, 0.938081145f},
-std::array<float,2>{0.295842171f, 0.479765266f},
-std::array<float,2>{0.854709923f, 0.136222139f},
-std::array<float,2>{0.137897074f, 0.583212674f},
-std::array<float,2>{0.664406896f, 0.689251244f},
-std::array<float,2>{0.368993819f, 0.0619658045f},
-std::array<float,2>{0.794605136f, 0.268514842f},
-std::array<float,2>{0.245135009f, 0.831184983f},
-std::array<float,2>{0.95883882f, 0.897402167f},
-std::array<float,2>{0.0431457646f, 0.382801622f},
-std::array<float,2>{0.538301408f, 0.219115883f},
-std::array<float,2>{0.415001988f, 0.516560972f},
-std::array<float,2>{0.830691278f, 0.618048787f},
-std::array<float,2>{0.187391251f, 0.158895358f},
-std::array<float,2>{0.717040956f, 0.464202791f},
-std::array<float,2>{0.254211426f, 0.988989711f},
-std::array<float,2>{0.601409256f, 0.776214302f},
-std::array<float,2>{0.49934271f, 0.342455775f},
-std::array<float,2>{0.93517518f, 0.0691571385f},
-std::array<float,2>{0.114803545f, 0.638913155f},
-std::array<float,2>{0.697603166f, 0.574742556f},
-std::array<float,2>{0.275128007f, 0.143666312f},
-std::array<float,2>{0.824131966f, 0.4847987f},
-std::array<float,2>{0.169837341f, 0.958607376f},
-std::array<float,2>{0.916624546f, 0.788614392f},
-std::array<float,2>{0.102052391f, 0.357803971f},
-std::array<float,2>{0.623368263f, 0.113634109f},
-std::array<float,2>{0.476456285f, 0.681656361f},
-std::array<float,2>{0.803082168f, 0.745560884f},
-std::array<float,2>{0.231629699f, 0.00260099303f},
-std::array<float,2>{0.682886004f, 0.290050358f},
-std::array<float,2>{0.358653963f, 0.862000406f},
-std::array<float,2>{0.549853802f, 0.910841823f},
-std::array<float,2>{0.434794575f, 0.424860805f},
-std::array<float,2>{0.942526639f, 0.208045974f},
-std::array<float,2>{0.0468757339f, 0.532951295f},
-std::array<float,2>{0.589459181f, 0.64070785f},
-std::array<float,2>{0.457797766f, 0.081080474f},
-std::array<float,2>{0.901872933f, 0.312925845f},
-std::array<float,2>{0.0828955695f, 0.762450576f},
-std::array<float,2>{0.870436549f, 0.974187315f},
-std::array<float,2>{0.145249754f, 0.443646908f},
-std::array<float,2>{0.739841163f, 0.183616072f},
-std::array<float,2>{0.304742873f, 0.598156571f},
-std::array<float,2>{0.995788634f, 0.506120861f},
-std::array<float,2>{0.00793086551f, 0.24055253f},
-std::array<float,2>{0.517153621f, 0.396149486f},
-std::array<float,2>{0.404579192f, 0.878724813f},
-std::array<float,2>{0.629314125f, 0.816291869f},
-std::array<float,2>{0.321384668f, 0.253201038f},
-std::array<float,2>{0.780944586f, 0.0387400798f},
-std::array<float,2>{0.197631061f, 0.710089207f},
-std::array<float,2>{0.613201082f, 0.603821099f},
-std::array<float,2>{0.480372161f, 0.173494011f},
-std::array<float,2>{0.908571303f, 0.447408766f},
-std::array<float,2>{0.0975569114f, 0.979600787f},
-std::array<float,2>{0.81440419f, 0.753262937f},
-std::array<float,2>{0.160071611f, 0.327261508f},
-std::array<float,2>{0.689284444f, 0.0890759975f},
-std::array<float,2>{0.272971809f, 0.654330313f},
-std::array<float,2>{0.947020233f, 0.717054069f},
-std::array<float,2>{0.0613588952f, 0.0399760827f},
-std::array<float,2>{0.556348622f, 0.263228476f},
-std::array<float,2>{0.42200923f, 0.822934091f},
-std::array<float,2>{0.677535772f, 0.888052821f},
-std::array<float,2>{0.349609315f, 0.401251584f},
-std::array<float,2>{0.805978894f, 0.243018627f},
-std::array<float,2>{0.220050246f, 0.510030508f},
-std::array<float,2>{0.745908678f, 0.67420578f},
-std::array<float,2>{0.303777128f, 0.12324509f},
-std::array<float,2>{0.864241898f, 0.345457256f},
-std::array<float,2>{0.149072438f, 0.794627726f},
-std::array<float,2>{0.891869783f, 0.966782153f},
-std::array<float,2>{0.0915694907f, 0.498030633f},
-std::array<float,2>{0.582734942f, 0.148487195f},
-std::array<float,2>{0.462759078f, 0.563094854f},
-std::array<float,2>{0.768953085f, 0.545582592f},
-std::array<float,2>{0.192659959f, 0.214222848f},
-std::array<float,2>{0.635155797f, 0.430538803f},
-std::array<float,2>{0.318564951f, 0.921633482f},
-std::array<float,2>{0.527139425f, 0.874888003f},
-std::array<float,2>{0.390777618f, 0.286524057f},
-std::array<float,2>{0.985579371f, 0.0125570698f},
-std::array<float,2>{0.00394419162f, 0.740316391f},
-std::array<float,2>{0.642920971f, 0.531032324f},
-std::array<float,2>{0.333717078f, 0.232381761f},
-std::array<float,2>{0.760741532f, 0.383195192f},
-std::array<float,2>{0.203975886f, 0.899152458f},
-std::array<float,2>{0.981310546f, 0.840661287f},
-std::array<float,2>{0.0288062003f, 0.279285312f},
-std::array<float,2>{0.503443658f, 0.0477400832f},
-std::array<float,2>{0.388101578f, 0.700071037f},
-std::array<float,2>{0.844115198f, 0.625888884f},
-std::array<float,2>{0.130843237f, 0.0758876652f},
-std::array<float,2>{0.732601523f, 0.330936223f},
-std::array<float,2>{0.281493545f, 0.771553576f},
-std::array<float,2>{0.569765568f, 0.99989289f},
-std::array<float,2>{0.438285261f, 0.453565419f},
-std::array<float,2>{0.879219413f, 0.16705519f},
-std::array<float,2>{0.0660127625f, 0.614929438f},
-std::array<float,2>{0.540779829f, 0.72565496f},
-std::array<float,2>{0.410042465f, 0.0210724585f},
-std::array<float,2>{0.96415925f, 0.30807355f},
-std::array<float,2>{0.0351895951f, 0.857388854f},
-std::array<float,2>{0.782552242f, 0.936771154f},
-std::array<float,2>{0.239464089f, 0.413218141f},
-std::array<float,2>{0.659564853f, 0.190708905f},
-std::array<float,2>{0.360064834f, 0.55857712f},
-std::array<float,2>{0.927621484f, 0.588056684f},
-std::array<float,2>{0.122677013f, 0.130309448f},
-std::array<float,2>{0.606853724f, 0.471288025f},
-std::array<float,2>{0.491551459f, 0.946810424f},
-std::array<float,2>{0.705402613f, 0.800057828f},
-std::array<float,2>{0.258469462f, 0.37130338f},
-std::array<float,2>{0.836612761f, 0.0961161703f},
-std::array<float,2>{0.172377229f, 0.671250522f},
-std::array<float,2>{0.560077906f, 0.579782248f},
-std::array<float,2>{0.426049024f, 0.137310654f},
-std::array<float,2>{0.950959563f, 0.483989805f},
-std::array<float,2>{0.0581877306f, 0.944331467f},
-std::array<float,2>{0.812338591f, 0.808003187f},
-std::array<float,2>{0.224749058f, 0.366529405f},
-std::array<float,2>{0.671950221f, 0.103227355f},
-std::array<float,2>{0.344831347f, 0.659371674f},
-std::array<float,2>{0.910255015f, 0.732801497f},
-std::array<float,2>{0.0984361842f, 0.0252038017f},
-std::array<float,2>{0.613925934f, 0.303136677f},
-std::array<float,2>{0.481199801f, 0.84376967f},
-std::array<float,2>{0.692377687f, 0.922350049f},
-std::array<float,2>{0.266483963f, 0.418685198f},
-std::array<float,2>{0.818510592f, 0.20092839f},
-std::array<float,2>{0.162130684f, 0.547675908f},
-std::array<float,2>{0.639439404f, 0.635698855f},
-std::array<float,2>{0.315348834f, 0.0636374429f},
-std::array<float,2>{0.77338469f, 0.338940084f},
-std::array<float,2>{0.188505337f, 0.780181646f},
-std::array<float,2>{0.989230931f, 0.987003982f},
-std::array<float,2>{0.000887210481f, 0.464964241f},
-std::array<float,2>{0.530600071f, 0.162686035f},
-std::array<float,2>{0.397467583f, 0.621381283f},
-std::array<float,2>{0.862141371f, 0.522385061f},
-std::array<float,2>{0.155907393f, 0.225459442f},
-std::array<float,2>{0.747401059f, 0.376801074f},
-std::array<float,2>{0.299923897f, 0.893220425f},
-std::array<float,2>{0.579257786f, 0.834734738f},
-std::array<float,2>{0.465514392f, 0.273357898f},
-std::array<float,2>{0.897590876f, 0.0583052151f},
-std::array<float,2>{0.0861493796f, 0.693246245f},
-std::array<float,2>{0.729263961f, 0.536082804f},
-std::array<float,2>{0.287614405f, 0.205356404f},
-std::array<float,2>{0.850377619f, 0.428047329f},
-std::array<float,2>{0.125135675f, 0.907474756f},
-std::array<float,2>{0.876352489f, 0.863613904f},
-std::array<float,2>{0.0669180751f, 0.294454634f},
-std::array<float,2>{0.56521523f, 0.00404466083f},
-std::array<float,2>{0.444692492f, 0.749317348f},
-std::array<float,2>{0.764368415f, 0.686355412f},
-std::array<float,2>{0.209069014f, 0.112198196f},
-std::array<float,2>{0.644992948f, 0.354180366f},
-std::array<float,2>{0.3302643f, 0.784597039f},
-std::array<float,2>{0.504976571f, 0.955382347f},
-std::array<float,2>{0.382999808f, 0.488414913f},
-std::array<float,2>{0.980066419f, 0.146173522f},
-std::array<float,2>{0.0269770715f, 0.572001696f},
-std::array<float,2>{0.60522145f, 0.705653548f},
-std::array<float,2>{0.48580423f, 0.0324401036f},
-std::array<float,2>{0.921904147f, 0.255652189f},
-std::array<float,2>{0.119275957f, 0.818616271f},
-std::array<float,2>{0.841083407f, 0.880702734f},
-std::array<float,2>{0.178519815f, 0.393391639f},
-std::array<float,2>{0.709403574f, 0.234565213f},
-std::array<float,2>{0.261770219f, 0.5003106f},
-std::array<float,2>{0.968276143f, 0.594565511f},
-std::array<float,2>{0.0335797258f, 0.179727018f},
-std::array<float,2>{0.544611394f, 0.441395879f},
-std::array<float,2>{0.412986368f, 0.969156325f},
-std::array<float,2>{0.662449419f, 0.758604884f},
-std::array<float,2>{0.363406897f, 0.318053454f},
-std::array<float,2>{0.788279235f, 0.0831392258f},
-std::array<float,2>{0.237792715f, 0.644645512f},
-std::array<float,2>{0.57088536f, 0.513376057f},
-std::array<float,2>{0.447749794f, 0.247711331f},
-std::array<float,2>{0.883985996f, 0.404499829f},
-std::array<float,2>{0.073926352f, 0.884624004f},
-std::array<float,2>{0.858021975f, 0.827041507f},
-std::array<float,2>{0.134656325f, 0.259310395f},
-std::array<float,2>{0.726159453f, 0.0443834588f},
-std::array<float,2>{0.290162385f, 0.712045431f},
-std::array<float,2>{0.974657834f, 0.64909488f},
-std::array<float,2>{0.0229471084f, 0.0931301862f},
-std::array<float,2>{0.508202255f, 0.321306586f},
-std::array<float,2>{0.375036299f, 0.755347908f},
-std::array<float,2>{0.650720894f, 0.982898474f},
-std::array<float,2>{0.337441772f, 0.449885219f},
-std::array<float,2>{0.751290679f, 0.176497445f},
-std::array<float,2>{0.218617409f, 0.606957972f},
-std::array<float,2>{0.713083744f, 0.73492682f},
-std::array<float,2>{0.253709942f, 0.00940292794f},
-std::array<float,2>{0.833376944f, 0.28376165f},
-std::array<float,2>{0.183558822f, 0.867930114f},
-std::array<float,2>{0.932813168f, 0.914333165f},
-std::array<float,2>{0.112699151f, 0.434505492f},
-std::array<float,2>{0.595813394f, 0.216132939f},
-std::array<float,2>{0.492746264f, 0.539484203f},
-std::array<float,2>{0.790560365f, 0.567608118f},
-std::array<float,2>{0.248587608f, 0.153997824f},
-std::array<float,2>{0.668922246f, 0.492319882f},
-std::array<float,2>{0.373182595f, 0.963365316f},
-std::array<float,2>{0.533155501f, 0.792355299f},
-std::array<float,2>{0.421308696f, 0.35082227f},
-std::array<float,2>{0.954121113f, 0.117844194f},
-std::array<float,2>{0.0421710238f, 0.677000403f},
-std::array<float,2>{0.68491739f, 0.612756133f},
-std::array<float,2>{0.353475839f, 0.171193525f},
-std::array<float,2>{0.799735844f, 0.457476676f},
-std::array<float,2>{0.229919046f, 0.994328439f},
-std::array<float,2>{0.94005686f, 0.76637125f},
-std::array<float,2>{0.0517708547f, 0.333318204f},
-std::array<float,2>{0.553668737f, 0.0721037239f},
-std::array<float,2>{0.433254719f, 0.629326761f},
-std::array<float,2>{0.825898886f, 0.698381662f},
-std::array<float,2>{0.164445445f, 0.0542216636f},
-std::array<float,2>{0.702906549f, 0.275585204f},
-std::array<float,2>{0.278582364f, 0.836801767f},
-std::array<float,2>{0.61982137f, 0.902347326f},
-std::array<float,2>{0.469966978f, 0.390160203f},
-std::array<float,2>{0.920067668f, 0.229725882f},
-std::array<float,2>{0.107743688f, 0.526223898f},
-std::array<float,2>{0.520783067f, 0.665451825f},
-std::array<float,2>{0.401715815f, 0.0996397883f},
-std::array<float,2>{0.997498274f, 0.368156582f},
-std::array<float,2>{0.0143642901f, 0.800905704f},
-std::array<float,2>{0.77677387f, 0.951824367f},
-std::array<float,2>{0.202856705f, 0.476419389f},
-std::array<float,2>{0.626291215f, 0.125359371f},
-std::array<float,2>{0.32458517f, 0.590292752f},
-std::array<float,2>{0.905344903f, 0.559539378f},
-std::array<float,2>{0.0788315907f, 0.19320716f},
-std::array<float,2>{0.593012929f, 0.407093942f},
-std::array<float,2>{0.455768615f, 0.932511508f},
-std::array<float,2>{0.734756112f, 0.853612185f},
-std::array<float,2>{0.31227836f, 0.309737593f},
-std::array<float,2>{0.871754169f, 0.0188223273f},
-std::array<float,2>{0.143021002f, 0.719847977f},
-std::array<float,2>{0.515719712f, 0.504562974f},
-std::array<float,2>{0.405411631f, 0.239912614f},
-std::array<float,2>{0.994818091f, 0.397607207f},
-std::array<float,2>{0.00905433111f, 0.875078678f},
-std::array<float,2>{0.779502451f, 0.813876867f},
-std::array<float,2>{0.198627025f, 0.250916511f},
-std::array<float,2>{0.630487621f, 0.0367794968f},
-std::array<float,2>{0.320364356f, 0.707984567f},
-std::array<float,2>{0.900789261f, 0.644434094f},
-std::array<float,2>{0.0838218555f, 0.0800542831f},
-std::array<float,2>{0.588070691f, 0.316072732f},
-std::array<float,2>{0.458286434f, 0.765513361f},
-std::array<float,2>{0.738548219f, 0.974622667f},
-std::array<float,2>{0.305759549f, 0.442736f},
-std::array<float,2>{0.869160116f, 0.186015025f},
-std::array<float,2>{0.146394804f, 0.600090504f},
-std::array<float,2>{0.682076097f, 0.743537843f},
-std::array<float,2>{0.357948005f, 0.000223872121f},
-std::array<float,2>{0.803804994f, 0.292582244f},
-std::array<float,2>{0.231176481f, 0.860596299f},
-std::array<float,2>{0.942001522f, 0.91350913f},
-std::array<float,2>{0.0483430438f, 0.421968579f},
-std::array<float,2>{0.549190938f, 0.209533542f},
-std::array<float,2>{0.434117705f, 0.533723831f},
-std::array<float,2>{0.823140264f, 0.577295125f},
-std::array<float,2>{0.168192938f, 0.14231047f},
-std::array<float,2>{0.698329031f, 0.487761259f},
-std::array<float,2>{0.274058819f, 0.960771322f},
-std::array<float,2>{0.624082148f, 0.785820067f},
-std::array<float,2>{0.475142986f, 0.356241345f},
-std::array<float,2>{0.917341709f, 0.11685358f},
-std::array<float,2>{0.102759227f, 0.680429041f},
-std::array<float,2>{0.718362629f, 0.620767593f},
-std::array<float,2>{0.255181879f, 0.156551704f},
-std::array<float,2>{0.831563473f, 0.461227655f},
-std::array<float,2>{0.186195061f, 0.991953015f},
-std::array<float,2>{0.933733761f, 0.775382221f},
-std::array<float,2>{0.11410366f, 0.341467142f},
-std::array<float,2>{0.600371182f, 0.0679788366f},
-std::array<float,2>{0.498236299f, 0.638483167f},
-std::array<float,2>{0.793542802f, 0.691082537f},
-std::array<float,2>{0.244740799f, 0.0604940169f},
-std::array<float,2>{0.665474772f, 0.266569197f},
-std::array<float,2>{0.36805889f, 0.828697324f},
-std::array<float,2>{0.537857771f, 0.895321131f},
-std::array<float,2>{0.415404081f, 0.379804879f},
-std::array<float,2>{0.957471311f, 0.221684024f},
-std::array<float,2>{0.044167567f, 0.517893016f},
-std::array<float,2>{0.574251175f, 0.660778224f},
-std::array<float,2>{0.450396985f, 0.109058015f},
-std::array<float,2>{0.887961268f, 0.360271215f},
-std::array<float,2>{0.0767679736f, 0.808777273f},
-std::array<float,2>{0.854104817f, 0.941179752f},
-std::array<float,2>{0.137324646f, 0.477568001f},
-std::array<float,2>{0.720879674f, 0.134322166f},
-std::array<float,2>{0.296810418f, 0.58473295f},
-std::array<float,2>{0.970586181f, 0.554202974f},
-std::array<float,2>{0.0194607601f, 0.196236268f},
-std::array<float,2>{0.514086545f, 0.415072531f},
-std::array<float,2>{0.380306423f, 0.929134667f},
-std::array<float,2>{0.655201972f, 0.851559937f},
-std::array<float,2>{0.342062861f, 0.298974842f},
-std::array<float,2>{0.75443083f, 0.0306781214f},
-std::array<float,2>{0.211568013f, 0.727346897f},
-std::array<float,2>{0.605975807f, 0.586052775f},
-std::array<float,2>{0.490487814f, 0.132538781f},
-std::array<float,2>{0.926071346f, 0.469007164f},
-std::array<float,2>{0.121793889f, 0.948572993f},
-std::array<float,2>{0.837125659f, 0.797379315f},
-std::array<float,2>{0.173267275f, 0.373529077f},
-std::array<float,2>{0.706450999f, 0.094468303f},
-std::array<float,2>{0.259572983f, 0.668604732f},
-std::array<float,2>{0.963176012f, 0.724438906f},
-std::array<float,2>{0.0366119593f, 0.0218262039f},
-std::array<float,2>{0.539633274f, 0.305824071f},
-std::array<float,2>{0.408931941f, 0.859301031f},
-std::array<float,2>{0.658555865f, 0.934559584f},
-std::array<float,2>{0.361001492f, 0.411011338f},
-std::array<float,2>{0.781385958f, 0.189086989f},
-std::array<float,2>{0.23882328f, 0.555049419f},
-std::array<float,2>{0.733763158f, 0.627471626f},
-std::array<float,2>{0.282701582f, 0.0773819461f},
-std::array<float,2>{0.845697045f, 0.329357386f},
-std::array<float,2>{0.1293239f, 0.770504832f},
-std::array<float,2>{0.87996769f, 0.996110559f},
-std::array<float,2>{0.0651405156f, 0.455395579f},
-std::array<float,2>{0.56874913f, 0.164149806f},
-std::array<float,2>{0.438823789f, 0.616996765f},
-std::array<float,2>{0.761577189f, 0.528406203f},
-std::array<float,2>{0.205028892f, 0.233976036f},
-std::array<float,2>{0.64426434f, 0.3856664f},
-std::array<float,2>{0.332995087f, 0.901550114f},
-std::array<float,2>{0.502735436f, 0.842829943f},
-std::array<float,2>{0.387158751f, 0.280710995f},
-std::array<float,2>{0.982250154f, 0.0488673858f},
-std::array<float,2>{0.0278434064f, 0.703007877f},
-std::array<float,2>{0.636482298f, 0.544838369f},
-std::array<float,2>{0.320029318f, 0.212527677f},
-std::array<float,2>{0.7683599f, 0.432017565f},
-std::array<float,2>{0.191546574f, 0.919654787f},
-std::array<float,2>{0.985197306f, 0.872096121f},
-std::array<float,2>{0.00549947657f, 0.288566351f},
-std::array<float,2>{0.525669396f, 0.0156019246f},
-std::array<float,2>{0.391811818f, 0.73842591f},
-std::array<float,2>{0.865046561f, 0.672332883f},
-std::array<float,2>{0.149797797f, 0.121558413f},
-std::array<float,2>{0.74479723f, 0.346788704f},
-std::array<float,2>{0.303259254f, 0.795240045f},
-std::array<float,2>{0.583953679f, 0.967226624f},
-std::array<float,2>{0.461523801f, 0.499924481f},
-std::array<float,2>{0.89126271f, 0.152026653f},
-std::array<float,2>{0.0906085297f, 0.565364718f},
-std::array<float,2>{0.555587769f, 0.716400027f},
-std::array<float,2>{0.423693836f, 0.041348882f},
-std::array<float,2>{0.946134806f, 0.265027136f},
-std::array<float,2>{0.0621922649f, 0.821287394f},
-std::array<float,2>{0.805478454f, 0.890616298f},
-std::array<float,2>{0.219417155f, 0.400188029f},
-std::array<float,2>{0.67672658f, 0.244357526f},
-std::array<float,2>{0.347803652f, 0.509422481f},
-std::array<float,2>{0.909849703f, 0.601932108f},
-std::array<float,2>{0.0957536325f, 0.174399212f},
-std::array<float,2>{0.6119017f, 0.446555585f},
-std::array<float,2>{0.47861439f, 0.978247762f},
-std::array<float,2>{0.688078225f, 0.750763655f},
-std::array<float,2>{0.271500617f, 0.32530421f},
-std::array<float,2>{0.812929928f, 0.0859382004f},
-std::array<float,2>{0.1590105f, 0.653181195f},
-std::array<float,2>{0.543760002f, 0.597389936f},
-std::array<float,2>{0.414005309f, 0.182831451f},
-std::array<float,2>{0.967283607f, 0.438700318f},
-std::array<float,2>{0.0342504829f, 0.971861362f},
-std::array<float,2>{0.78760761f, 0.760959923f},
-std::array<float,2>{0.236727476f, 0.319198519f},
-std::array<float,2>{0.663999438f, 0.084299624f},
-std::array<float,2>{0.364263982f, 0.647880554f},
-std::array<float,2>{0.923809111f, 0.703656435f},
-std::array<float,2>{0.120448284f, 0.0332883969f},
-std::array<float,2>{0.604115784f, 0.255985618f},
-std::array<float,2>{0.484392375f, 0.817192674f},
-std::array<float,2>{0.710691392f, 0.882187188f},
-std::array<float,2>{0.263589114f, 0.391872168f},
-std::array<float,2>{0.840036035f, 0.236606494f},
-std::array<float,2>{0.178831235f, 0.502104878f},
-std::array<float,2>{0.645782173f, 0.684895098f},
-std::array<float,2>{0.331228584f, 0.110340953f},
-std::array<float,2>{0.764746964f, 0.353425235f},
-std::array<float,2>{0.210408375f, 0.781697452f},
-std::array<float,2>{0.979159415f, 0.954639494f},
-std::array<float,2>{0.0262137968f, 0.49131152f},
-std::array<float,2>{0.504350245f, 0.147207186f},
-std::array<float,2>{0.38451606f, 0.572990716f},
-std::array<float,2>{0.850723624f, 0.538956285f},
-std::array<float,2>{0.12659435f, 0.204189926f},
-std::array<float,2>{0.729819953f, 0.427221566f},
-std::array<float,2>{0.288816661f, 0.910030484f},
-std::array<float,2>{0.565451443f, 0.866084576f},
-std::array<float,2>{0.444307983f, 0.296763659f},
-std::array<float,2>{0.875611484f, 0.00651126215f},
-std::array<float,2>{0.067686744f, 0.747253239f},
-std::array<float,2>{0.746095479f, 0.521335185f},
-std::array<float,2>{0.298834562f, 0.223558933f},
-std::array<float,2>{0.86259228f, 0.377890676f},
-std::array<float,2>{0.155105904f, 0.890772164f},
-std::array<float,2>{0.897232711f, 0.832037389f},
-std::array<float,2>{0.0877944455f, 0.269907057f},
-std::array<float,2>{0.57822293f, 0.0558866635f},
-std::array<float,2>{0.466462702f, 0.695190907f},
-std::array<float,2>{0.771898031f, 0.633265555f},
-std::array<float,2>{0.188065946f, 0.0656897798f},
-std::array<float,2>{0.640243709f, 0.337538689f},
-std::array<float,2>{0.315832108f, 0.778733194f},
-std::array<float,2>{0.529658377f, 0.984460294f},
-std::array<float,2>{0.397352993f, 0.468071043f},
-std::array<float,2>{0.989408433f, 0.160410553f},
-std::array<float,2>{0.00139801612f, 0.623911619f},
-std::array<float,2>{0.614329636f, 0.731679082f},
-std::array<float,2>{0.481562316f, 0.0260899775f},
-std::array<float,2>{0.911243439f, 0.301927149f},
-std::array<float,2>{0.0990797356f, 0.847398221f},
-std::array<float,2>{0.819845319f, 0.925550699f},
-std::array<float,2>{0.163804501f, 0.42125684f},
-std::array<float,2>{0.693036079f, 0.202645883f},
-std::array<float,2>{0.2668975f, 0.550343812f},
-std::array<float,2>{0.950136781f, 0.580232322f},
-std::array<float,2>{0.0574645251f, 0.139326975f},
-std::array<float,2>{0.559233904f, 0.482316643f},
-std::array<float,2>{0.426955312f, 0.942267776f},
-std::array<float,2>{0.673061848f, 0.805095792f},
-std::array<float,2>{0.344687492f, 0.364525586f},
-std::array<float,2>{0.811402023f, 0.104396291f},
-std::array<float,2>{0.225590363f, 0.656570971f},
-std::array<float,2>{0.59220314f, 0.560929894f},
-std::array<float,2>{0.456366062f, 0.194879562f},
-std::array<float,2>{0.904817343f, 0.40874511f},
-std::array<float,2>{0.0794692561f, 0.92975992f},
-std::array<float,2>{0.87218833f, 0.8526389f},
-std::array<float,2>{0.144114003f, 0.31202659f},
-std::array<float,2>{0.736182928f, 0.0174360387f},
-std::array<float,2>{0.311230987f, 0.721900105f},
-std::array<float,2>{0.996355653f, 0.667211175f},
-std::array<float,2>{0.0151523557f, 0.0982604623f},
-std::array<float,2>{0.519588411f, 0.369530737f},
-std::array<float,2>{0.400705487f, 0.804646313f},
-std::array<float,2>{0.625903904f, 0.94926703f},
-std::array<float,2>{0.326139629f, 0.47428298f},
-std::array<float,2>{0.776146412f, 0.128007367f},
-std::array<float,2>{0.201666012f, 0.591930032f},
-std::array<float,2>{0.701768816f, 0.695554197f},
-std::array<float,2>{0.27782023f, 0.0517092943f},
-std::array<float,2>{0.824789822f, 0.274975628f},
-std::array<float,2>{0.165939957f, 0.839408815f},
-std::array<float,2>{0.921766102f, 0.906237423f},
-std::array<float,2>{0.108976312f, 0.388346374f},
-std::array<float,2>{0.620909095f, 0.226942942f},
-std::array<float,2>{0.469304293f, 0.523981452f},
-std::array<float,2>{0.800742984f, 0.609382749f},
-std::array<float,2>{0.229087979f, 0.168861389f},
-std::array<float,2>{0.683793008f, 0.460616976f},
-std::array<float,2>{0.351732999f, 0.992466927f},
-std::array<float,2>{0.554046571f, 0.769228578f},
-std::array<float,2>{0.432465523f, 0.335273057f},
-std::array<float,2>{0.941155255f, 0.0726914182f},
-std::array<float,2>{0.0516475961f, 0.632661283f},
-std::array<float,2>{0.66964829f, 0.569251716f},
-std::array<float,2>{0.374911427f, 0.155594125f},
-std::array<float,2>{0.789276242f, 0.4947972f},
-std::array<float,2>{0.249079496f, 0.961734533f},
-std::array<float,2>{0.953747034f, 0.789880455f},
-std::array<float,2>{0.0414568409f, 0.348783731f},
-std::array<float,2>{0.531636477f, 0.119396828f},
-std::array<float,2>{0.420228034f, 0.679401219f},
-std::array<float,2>{0.832874954f, 0.736673534f},
-std::array<float,2>{0.182067499f, 0.0114535978f},
-std::array<float,2>{0.714166403f, 0.281531513f},
-std::array<float,2>{0.252407789f, 0.870645404f},
-std::array<float,2>{0.596760571f, 0.917523921f},
-std::array<float,2>{0.493294477f, 0.436126173f},
-std::array<float,2>{0.932565093f, 0.217203945f},
-std::array<float,2>{0.112124264f, 0.542355001f},
-std::array<float,2>{0.509621382f, 0.651417255f},
-std::array<float,2>{0.376692921f, 0.0907939747f},
-std::array<float,2>{0.975597203f, 0.32383731f},
-std::array<float,2>{0.0221923403f, 0.757480085f},
-std::array<float,2>{0.750286043f, 0.980992377f},
-std::array<float,2>{0.217255101f, 0.453100532f},
-std::array<float,2>{0.651560366f, 0.178468496f},
-std::array<float,2>{0.336200774f, 0.608645797f},
-std::array<float,2>{0.883551121f, 0.514381588f},
-std::array<float,2>{0.0723875985f, 0.249700859f},
-std::array<float,2>{0.571398854f, 0.402495205f},
-std::array<float,2>{0.448771983f, 0.886164069f},
-std::array<float,2>{0.725308955f, 0.825330496f},
-std::array<float,2>{0.289756566f, 0.260974795f},
-std::array<float,2>{0.859153271f, 0.0453502275f},
-std::array<float,2>{0.133154944f, 0.713334918f},
-std::array<float,2>{0.547566414f, 0.531586707f},
-std::array<float,2>{0.437058419f, 0.20721209f},
-std::array<float,2>{0.94356811f, 0.424756736f},
-std::array<float,2>{0.0502122119f, 0.911619723f},
-std::array<float,2>{0.802162707f, 0.862781525f},
-std::array<float,2>{0.234211296f, 0.289660186f},
-std::array<float,2>{0.680689692f, 0.003841019f},
-std::array<float,2>{0.356508702f, 0.744714439f},
-std::array<float,2>{0.914179504f, 0.682659507f},
-std::array<float,2>{0.103938147f, 0.115192398f},
-std::array<float,2>{0.621708274f, 0.358510405f},
-std::array<float,2>{0.473013818f, 0.787917852f},
-std::array<float,2>{0.696452141f, 0.957940757f},
-std::array<float,2>{0.27616331f, 0.486145943f},
-std::array<float,2>{0.821585298f, 0.142689943f},
-std::array<float,2>{0.170353562f, 0.575818062f},
-std::array<float,2>{0.63200587f, 0.709204316f},
-std::array<float,2>{0.323182613f, 0.037251886f},
-std::array<float,2>{0.778071642f, 0.252518952f},
-std::array<float,2>{0.196690589f, 0.815344512f},
-std::array<float,2>{0.993695855f, 0.877739012f},
-std::array<float,2>{0.0109421546f, 0.39478305f},
-std::array<float,2>{0.519387066f, 0.241230324f},
-std::array<float,2>{0.402806669f, 0.50699544f},
-std::array<float,2>{0.868435502f, 0.598875523f},
-std::array<float,2>{0.148422182f, 0.185121164f},
-std::array<float,2>{0.741235912f, 0.44474256f},
-std::array<float,2>{0.307494938f, 0.973305106f},
-std::array<float,2>{0.586507142f, 0.763653398f},
-std::array<float,2>{0.459368765f, 0.313756734f},
-std::array<float,2>{0.898493767f, 0.0805052146f},
-std::array<float,2>{0.084307842f, 0.6421749f},
-std::array<float,2>{0.720273912f, 0.582393229f},
-std::array<float,2>{0.293031156f, 0.134816214f},
-std::array<float,2>{0.851795912f, 0.47911188f},
-std::array<float,2>{0.139959335f, 0.939040899f},
-std::array<float,2>{0.889998913f, 0.812128365f},
-std::array<float,2>{0.0750935301f, 0.362709641f},
-std::array<float,2>{0.577911317f, 0.107157938f},
-std::array<float,2>{0.452940404f, 0.662611306f},
-std::array<float,2>{0.75629884f, 0.729423702f},
-std::array<float,2>{0.214348167f, 0.0274629574f},
-std::array<float,2>{0.653644383f, 0.298339903f},
-std::array<float,2>{0.341184735f, 0.849443913f},
-std::array<float,2>{0.513278961f, 0.925934851f},
-std::array<float,2>{0.381791741f, 0.416463554f},
-std::array<float,2>{0.972597599f, 0.199119255f},
-std::array<float,2>{0.0170503389f, 0.552330256f},
-std::array<float,2>{0.599178135f, 0.639954448f},
-std::array<float,2>{0.497448504f, 0.0699087456f},
-std::array<float,2>{0.937451899f, 0.343122572f},
-std::array<float,2>{0.116279706f, 0.776942194f},
-std::array<float,2>{0.829539895f, 0.989988029f},
-std::array<float,2>{0.184466392f, 0.46315214f},
-std::array<float,2>{0.715993047f, 0.159288913f},
-std::array<float,2>{0.257287711f, 0.618625343f},
-std::array<float,2>{0.959465742f, 0.516918004f},
-std::array<float,2>{0.0463732779f, 0.220567003f},
-std::array<float,2>{0.535910308f, 0.381463915f},
-std::array<float,2>{0.417874843f, 0.897886217f},
-std::array<float,2>{0.667033672f, 0.831035674f},
-std::array<float,2>{0.370387614f, 0.269429058f},
-std::array<float,2>{0.795600951f, 0.0605597794f},
-std::array<float,2>{0.242630631f, 0.687660515f},
-std::array<float,2>{0.568248689f, 0.614182353f},
-std::array<float,2>{0.441241473f, 0.166339517f},
-std::array<float,2>{0.881772876f, 0.454456985f},
-std::array<float,2>{0.0641014203f, 0.998253047f},
-std::array<float,2>{0.847002447f, 0.772998333f},
-std::array<float,2>{0.131779f, 0.331132203f},
-std::array<float,2>{0.73219794f, 0.074999772f},
-std::array<float,2>{0.283976108f, 0.626100898f},
-std::array<float,2>{0.984196723f, 0.700639009f},
-std::array<float,2>{0.0308406837f, 0.0483100601f},
-std::array<float,2>{0.500071526f, 0.277945697f},
-std::array<float,2>{0.389981717f, 0.841770649f},
-std::array<float,2>{0.642570138f, 0.899755239f},
-std::array<float,2>{0.335853368f, 0.384509176f},
-std::array<float,2>{0.758620799f, 0.23077257f},
-std::array<float,2>{0.205627769f, 0.529588223f},
-std::array<float,2>{0.703858912f, 0.6700809f},
-std::array<float,2>{0.26106143f, 0.0968279839f},
-std::array<float,2>{0.839256763f, 0.372931629f},
-std::array<float,2>{0.174776316f, 0.799623847f},
-std::array<float,2>{0.928480446f, 0.945407987f},
-std::array<float,2>{0.124036215f, 0.472506016f},
-std::array<float,2>{0.607784212f, 0.129333109f},
-std::array<float,2>{0.489244223f, 0.58912462f},
-std::array<float,2>{0.7844612f, 0.55668503f},
-std::array<float,2>{0.240651786f, 0.189605206f},
-std::array<float,2>{0.656606197f, 0.412410408f},
-std::array<float,2>{0.362092406f, 0.936186969f},
-std::array<float,2>{0.5427531f, 0.855698228f},
-std::array<float,2>{0.406642973f, 0.307372957f},
-std::array<float,2>{0.962643266f, 0.0201915968f},
-std::array<float,2>{0.0384807698f, 0.725343883f},
-std::array<float,2>{0.678930938f, 0.510801494f},
-std::array<float,2>{0.349998057f, 0.243497759f},
-std::array<float,2>{0.807884991f, 0.401819557f},
-std::array<float,2>{0.220905676f, 0.887058198f},
-std::array<float,2>{0.947569907f, 0.824089468f},
-std::array<float,2>{0.0602256991f, 0.262638152f},
-std::array<float,2>{0.55764091f, 0.0406249873f},
-std::array<float,2>{0.424048305f, 0.718372285f},
-std::array<float,2>{0.815864623f, 0.655371368f},
-std::array<float,2>{0.156470001f, 0.0885506198f},
-std::array<float,2>{0.6898278f, 0.326686829f},
-std::array<float,2>{0.270344645f, 0.75260669f},
-std::array<float,2>{0.610583663f, 0.979216039f},
-std::array<float,2>{0.478119403f, 0.448621511f},
-std::array<float,2>{0.906872809f, 0.171897665f},
-std::array<float,2>{0.09529607f, 0.605087519f},
-std::array<float,2>{0.52459693f, 0.742015541f},
-std::array<float,2>{0.393528312f, 0.013529527f},
-std::array<float,2>{0.987016559f, 0.285561889f},
-std::array<float,2>{0.00718581397f, 0.873533785f},
-std::array<float,2>{0.766808331f, 0.920824885f},
-std::array<float,2>{0.19521372f, 0.431194007f},
-std::array<float,2>{0.633192658f, 0.213526025f},
-std::array<float,2>{0.316719115f, 0.546035945f},
-std::array<float,2>{0.893852413f, 0.563822746f},
-std::array<float,2>{0.0931231007f, 0.150340632f},
-std::array<float,2>{0.584428489f, 0.496477872f},
-std::array<float,2>{0.462901741f, 0.965511024f},
-std::array<float,2>{0.743101299f, 0.793329298f},
-std::array<float,2>{0.301320225f, 0.344524831f},
-std::array<float,2>{0.865413368f, 0.124160655f},
-std::array<float,2>{0.150395885f, 0.675655961f},
-std::array<float,2>{0.506633759f, 0.570930779f},
-std::array<float,2>{0.385277778f, 0.145196974f},
-std::array<float,2>{0.978113413f, 0.489348501f},
-std::array<float,2>{0.0236544199f, 0.95650506f},
-std::array<float,2>{0.76245743f, 0.784007907f},
-std::array<float,2>{0.207665652f, 0.354800254f},
-std::array<float,2>{0.646698594f, 0.112954982f},
-std::array<float,2>{0.329481155f, 0.687471807f},
-std::array<float,2>{0.877435207f, 0.749018788f},
-std::array<float,2>{0.0688918084f, 0.00561899319f},
-std::array<float,2>{0.563006282f, 0.293716818f},
-std::array<float,2>{0.443172902f, 0.864905298f},
-std::array<float,2>{0.728062689f, 0.90631932f},
-std::array<float,2>{0.286993653f, 0.429648489f},
-std::array<float,2>{0.848700821f, 0.206944957f},
-std::array<float,2>{0.128012508f, 0.536800921f},
-std::array<float,2>{0.661793947f, 0.64592278f},
-std::array<float,2>{0.366682976f, 0.0828222036f},
-std::array<float,2>{0.785698831f, 0.316532522f},
-std::array<float,2>{0.235108539f, 0.759527981f},
-std::array<float,2>{0.965482473f, 0.969756484f},
-std::array<float,2>{0.0316800065f, 0.43959564f},
-std::array<float,2>{0.545143127f, 0.180709273f},
-std::array<float,2>{0.41156584f, 0.595358849f},
-std::array<float,2>{0.842480242f, 0.501489699f},
-std::array<float,2>{0.176810205f, 0.235677227f},
-std::array<float,2>{0.707979441f, 0.394203901f},
-std::array<float,2>{0.264782488f, 0.879323304f},
-std::array<float,2>{0.602434754f, 0.819896758f},
-std::array<float,2>{0.486711025f, 0.254586756f},
-std::array<float,2>{0.924420238f, 0.0312654115f},
-std::array<float,2>{0.11798913f, 0.706929564f},
-std::array<float,2>{0.695194423f, 0.548050404f},
-std::array<float,2>{0.268764138f, 0.199549288f},
-std::array<float,2>{0.817172229f, 0.419733256f},
-std::array<float,2>{0.162066549f, 0.923700929f},
-std::array<float,2>{0.913801968f, 0.845315516f},
-std::array<float,2>{0.0997165367f, 0.3042669f},
-std::array<float,2>{0.615531325f, 0.0234832074f},
-std::array<float,2>{0.483319163f, 0.733937204f},
-std::array<float,2>{0.810539126f, 0.658457041f},
-std::array<float,2>{0.224317268f, 0.101857528f},
-std::array<float,2>{0.674425781f, 0.365749061f},
-std::array<float,2>{0.345951766f, 0.806923211f},
-std::array<float,2>{0.560675859f, 0.944915235f},
-std::array<float,2>{0.428550065f, 0.482464403f},
-std::array<float,2>{0.951476216f, 0.138153762f},
-std::array<float,2>{0.0558487363f, 0.57837826f},
-std::array<float,2>{0.580216765f, 0.691924989f},
-std::array<float,2>{0.466823667f, 0.0572490022f},
-std::array<float,2>{0.894932151f, 0.27227968f},
-std::array<float,2>{0.0895266011f, 0.835238397f},
-std::array<float,2>{0.859777391f, 0.894521177f},
-std::array<float,2>{0.153653949f, 0.375590444f},
-std::array<float,2>{0.749010623f, 0.226529121f},
-std::array<float,2>{0.297287971f, 0.52275902f},
-std::array<float,2>{0.990352631f, 0.622183144f},
-std::array<float,2>{0.00264605554f, 0.163540572f},
-std::array<float,2>{0.529236019f, 0.466044515f},
-std::array<float,2>{0.395114392f, 0.987423837f},
-std::array<float,2>{0.638305664f, 0.781191766f},
-std::array<float,2>{0.313213259f, 0.33803454f},
-std::array<float,2>{0.770120263f, 0.0634533018f},
-std::array<float,2>{0.189915881f, 0.636564136f},
-std::array<float,2>{0.617888451f, 0.526730359f},
-std::array<float,2>{0.47241798f, 0.228547454f},
-std::array<float,2>{0.919095397f, 0.389040828f},
-std::array<float,2>{0.106550887f, 0.904187322f},
-std::array<float,2>{0.826644838f, 0.837446809f},
-std::array<float,2>{0.167604133f, 0.277292788f},
-std::array<float,2>{0.700427175f, 0.0531948321f},
-std::array<float,2>{0.280141056f, 0.69822228f},
-std::array<float,2>{0.937777638f, 0.630818605f},
-std::array<float,2>{0.0545895211f, 0.0709941313f},
-std::array<float,2>{0.552088797f, 0.332588017f},
-std::array<float,2>{0.429777265f, 0.766736448f},
-std::array<float,2>{0.686126351f, 0.995420873f},
-std::array<float,2>{0.354917139f, 0.458970994f},
-std::array<float,2>{0.797208488f, 0.170188904f},
-std::array<float,2>{0.227727517f, 0.611454666f},
-std::array<float,2>{0.737221539f, 0.719590068f},
-std::array<float,2>{0.308757037f, 0.017803859f},
-std::array<float,2>{0.873977959f, 0.309294313f},
-std::array<float,2>{0.141897634f, 0.855367601f},
-std::array<float,2>{0.902683794f, 0.933534801f},
-std::array<float,2>{0.0805475488f, 0.408109426f},
-std::array<float,2>{0.590610266f, 0.191715464f},
-std::array<float,2>{0.454969347f, 0.560069323f},
-std::array<float,2>{0.773763716f, 0.591297507f},
-std::array<float,2>{0.201091275f, 0.12603654f},
-std::array<float,2>{0.627862215f, 0.475080043f},
-std::array<float,2>{0.327730358f, 0.952751756f},
-std::array<float,2>{0.52230072f, 0.802534938f},
-std::array<float,2>{0.399800003f, 0.368587971f},
-std::array<float,2>{0.999679387f, 0.100760795f},
-std::array<float,2>{0.012658827f, 0.664642811f},
-std::array<float,2>{0.648925841f, 0.605473816f},
-std::array<float,2>{0.338950604f, 0.177320972f},
-std::array<float,2>{0.753796697f, 0.450911194f},
-std::array<float,2>{0.215209603f, 0.983651102f},
-std::array<float,2>{0.973324597f, 0.754796326f},
-std::array<float,2>{0.0198754966f, 0.32109797f},
-std::array<float,2>{0.509950101f, 0.0918699652f},
-std::array<float,2>{0.377665788f, 0.649495959f},
-std::array<float,2>{0.856576979f, 0.711784899f},
-std::array<float,2>{0.135245904f, 0.0433696844f},
-std::array<float,2>{0.722810209f, 0.258615583f},
-std::array<float,2>{0.291573018f, 0.828069687f},
-std::array<float,2>{0.574074984f, 0.883760035f},
-std::array<float,2>{0.446704805f, 0.406241f},
-std::array<float,2>{0.885215819f, 0.246222988f},
-std::array<float,2>{0.0708090514f, 0.512132823f},
-std::array<float,2>{0.534276724f, 0.675941288f},
-std::array<float,2>{0.419383019f, 0.118492961f},
-std::array<float,2>{0.95682025f, 0.350054175f},
-std::array<float,2>{0.0399963222f, 0.79137373f},
-std::array<float,2>{0.792480469f, 0.964532137f},
-std::array<float,2>{0.247566521f, 0.493885309f},
-std::array<float,2>{0.670440376f, 0.153055936f},
-std::array<float,2>{0.372612894f, 0.567074478f},
-std::array<float,2>{0.930621505f, 0.540387511f},
-std::array<float,2>{0.109984569f, 0.215138197f},
-std::array<float,2>{0.595452249f, 0.435489953f},
-std::array<float,2>{0.49491778f, 0.915940762f},
-std::array<float,2>{0.711822569f, 0.868750751f},
-std::array<float,2>{0.251394898f, 0.284642428f},
-std::array<float,2>{0.835354745f, 0.00808856171f},
-std::array<float,2>{0.180918351f, 0.735753655f}}
\ No newline at end of file
@@ -1,4096 +0,0 @@
-{std::array<float,2>{0.61928463f, 0.331509203f},
-std::array<float,2>{0.367776573f, 0.842487633f},
-std::array<float,2>{0.190867037f, 0.0650050938f},
-std::array<float,2>{0.85844332f, 0.504690409f},
-std::array<float,2>{0.949688673f, 0.243874475f},
-std::array<float,2>{0.014516416f, 0.701385975f},
-std::array<float,2>{0.477361679f, 0.463457763f},
-std::array<float,2>{0.703977644f, 0.909638286f},
-std::array<float,2>{0.785725892f, 0.422695458f},
-std::array<float,2>{0.15316695f, 0.977053285f},
-std::array<float,2>{0.265731007f, 0.152112335f},
-std::array<float,2>{0.52815187f, 0.627977848f},
-std::array<float,2>{0.664770126f, 0.00552963931f},
-std::array<float,2>{0.433403373f, 0.618160903f},
-std::array<float,2>{0.0639738739f, 0.286842167f},
-std::array<float,2>{0.895393252f, 0.809177458f},
-std::array<float,2>{0.744136155f, 0.492174894f},
-std::array<float,2>{0.44710815f, 0.891259551f},
-std::array<float,2>{0.0350773446f, 0.213116467f},
-std::array<float,2>{0.979592323f, 0.734300375f},
-std::array<float,2>{0.828263044f, 0.105650835f},
-std::array<float,2>{0.222981155f, 0.557538271f},
-std::array<float,2>{0.343106091f, 0.371132165f},
-std::array<float,2>{0.58389163f, 0.858803689f},
-std::array<float,2>{0.931192815f, 0.274856865f},
-std::array<float,2>{0.123988301f, 0.764056206f},
-std::array<float,2>{0.398490846f, 0.0490162f},
-std::array<float,2>{0.642205715f, 0.58688724f},
-std::array<float,2>{0.53190136f, 0.164157853f},
-std::array<float,2>{0.296816081f, 0.677326262f},
-std::array<float,2>{0.185677111f, 0.397384554f},
-std::array<float,2>{0.777191103f, 0.939198136f},
-std::array<float,2>{0.636495411f, 0.300473809f},
-std::array<float,2>{0.389901638f, 0.790927887f},
-std::array<float,2>{0.101050436f, 0.0249526668f},
-std::array<float,2>{0.914661705f, 0.599466205f},
-std::array<float,2>{0.763056576f, 0.132861197f},
-std::array<float,2>{0.161464468f, 0.643302917f},
-std::array<float,2>{0.30041936f, 0.413684279f},
-std::array<float,2>{0.551946521f, 0.998400092f},
-std::array<float,2>{0.996720195f, 0.449407846f},
-std::array<float,2>{0.049199231f, 0.92786932f},
-std::array<float,2>{0.453542918f, 0.224309549f},
-std::array<float,2>{0.730811715f, 0.710023642f},
-std::array<float,2>{0.564841568f, 0.0796676278f},
-std::array<float,2>{0.327138215f, 0.517563581f},
-std::array<float,2>{0.238654956f, 0.326768547f},
-std::array<float,2>{0.82030648f, 0.817772925f},
-std::array<float,2>{0.50295794f, 0.381492615f},
-std::array<float,2>{0.265098929f, 0.959474921f},
-std::array<float,2>{0.134139135f, 0.186292708f},
-std::array<float,2>{0.798310459f, 0.661221445f},
-std::array<float,2>{0.880051196f, 0.0372271389f},
-std::array<float,2>{0.0787208825f, 0.571059525f},
-std::array<float,2>{0.41114378f, 0.251558274f},
-std::array<float,2>{0.676454008f, 0.767329216f},
-std::array<float,2>{0.859659016f, 0.351163894f},
-std::array<float,2>{0.212910354f, 0.865841389f},
-std::array<float,2>{0.350244075f, 0.115705505f},
-std::array<float,2>{0.603836179f, 0.540926039f},
-std::array<float,2>{0.692021906f, 0.19697313f},
-std::array<float,2>{0.496777385f, 0.740937293f},
-std::array<float,2>{0.0178486891f, 0.476750731f},
-std::array<float,2>{0.967839003f, 0.889059782f},
-std::array<float,2>{0.555094063f, 0.263242394f},
-std::array<float,2>{0.308849663f, 0.77839303f},
-std::array<float,2>{0.166573092f, 0.039086964f},
-std::array<float,2>{0.750069261f, 0.565905094f},
-std::array<float,2>{0.914053202f, 0.17457056f},
-std::array<float,2>{0.106115244f, 0.665696323f},
-std::array<float,2>{0.382569522f, 0.385195792f},
-std::array<float,2>{0.626288831f, 0.962332606f},
-std::array<float,2>{0.821208775f, 0.473136455f},
-std::array<float,2>{0.247519836f, 0.87619257f},
-std::array<float,2>{0.314386219f, 0.193837941f},
-std::array<float,2>{0.57251364f, 0.745814621f},
-std::array<float,2>{0.719217777f, 0.121114239f},
-std::array<float,2>{0.462708116f, 0.531732976f},
-std::array<float,2>{0.0551440194f, 0.354666114f},
-std::array<float,2>{0.986105382f, 0.872488618f},
-std::array<float,2>{0.682414234f, 0.415155172f},
-std::array<float,2>{0.419383168f, 0.991871595f},
-std::array<float,2>{0.0918961912f, 0.131737173f},
-std::array<float,2>{0.889091492f, 0.655147612f},
-std::array<float,2>{0.808030427f, 0.0219106488f},
-std::array<float,2>{0.131404802f, 0.602167606f},
-std::array<float,2>{0.255676597f, 0.311058134f},
-std::array<float,2>{0.510672271f, 0.788809717f},
-std::array<float,2>{0.955411196f, 0.313053131f},
-std::array<float,2>{0.0299621616f, 0.824199796f},
-std::array<float,2>{0.489764214f, 0.0876402631f},
-std::array<float,2>{0.698531628f, 0.531055868f},
-std::array<float,2>{0.600001454f, 0.232193649f},
-std::array<float,2>{0.358288497f, 0.712674379f},
-std::array<float,2>{0.205023646f, 0.439640582f},
-std::array<float,2>{0.871357799f, 0.931484759f},
-std::array<float,2>{0.713408947f, 0.365875393f},
-std::array<float,2>{0.469096392f, 0.850141585f},
-std::array<float,2>{0.00120682607f, 0.096989736f},
-std::array<float,2>{0.944118321f, 0.553971648f},
-std::array<float,2>{0.851558447f, 0.208544821f},
-std::array<float,2>{0.195938393f, 0.724666178f},
-std::array<float,2>{0.363486111f, 0.492812932f},
-std::array<float,2>{0.614879787f, 0.904321671f},
-std::array<float,2>{0.900911331f, 0.402179599f},
-std::array<float,2>{0.0721700415f, 0.95001781f},
-std::array<float,2>{0.42350921f, 0.162271962f},
-std::array<float,2>{0.657412112f, 0.687130272f},
-std::array<float,2>{0.520992756f, 0.0558577217f},
-std::array<float,2>{0.27869609f, 0.583604038f},
-std::array<float,2>{0.142972544f, 0.272015184f},
-std::array<float,2>{0.796122134f, 0.750485063f},
-std::array<float,2>{0.593058825f, 0.45539403f},
-std::array<float,2>{0.33018595f, 0.91420573f},
-std::array<float,2>{0.231080279f, 0.240498111f},
-std::array<float,2>{0.842074752f, 0.692912281f},
-std::array<float,2>{0.973839164f, 0.0713546798f},
-std::array<float,2>{0.0404297896f, 0.515101016f},
-std::array<float,2>{0.443074226f, 0.338486254f},
-std::array<float,2>{0.741955578f, 0.835026383f},
-std::array<float,2>{0.770052195f, 0.292781144f},
-std::array<float,2>{0.17642647f, 0.798608303f},
-std::array<float,2>{0.281317174f, 0.0146395899f},
-std::array<float,2>{0.541294634f, 0.611485422f},
-std::array<float,2>{0.652970672f, 0.14437294f},
-std::array<float,2>{0.39689666f, 0.632871687f},
-std::array<float,2>{0.111410968f, 0.434638739f},
-std::array<float,2>{0.927384257f, 0.973249495f},
-std::array<float,2>{0.52647388f, 0.358389914f},
-std::array<float,2>{0.271759272f, 0.86965853f},
-std::array<float,2>{0.152035564f, 0.117308609f},
-std::array<float,2>{0.7819947f, 0.536077976f},
-std::array<float,2>{0.893626928f, 0.189419165f},
-std::array<float,2>{0.0691485628f, 0.747049868f},
-std::array<float,2>{0.436839014f, 0.469010472f},
-std::array<float,2>{0.668108523f, 0.878975391f},
-std::array<float,2>{0.85356462f, 0.38744548f},
-std::array<float,2>{0.194211289f, 0.968643725f},
-std::array<float,2>{0.373235017f, 0.179540828f},
-std::array<float,2>{0.622788072f, 0.668642163f},
-std::array<float,2>{0.710437834f, 0.0447712615f},
-std::array<float,2>{0.484042615f, 0.567635119f},
-std::array<float,2>{0.00982073508f, 0.260399401f},
-std::array<float,2>{0.948210895f, 0.77458185f},
-std::array<float,2>{0.645447373f, 0.444333971f},
-std::array<float,2>{0.405854493f, 0.936991632f},
-std::array<float,2>{0.118625186f, 0.226564854f},
-std::array<float,2>{0.934040308f, 0.717510462f},
-std::array<float,2>{0.780160964f, 0.092094712f},
-std::array<float,2>{0.18059437f, 0.526328444f},
-std::array<float,2>{0.289616168f, 0.316877186f},
-std::array<float,2>{0.536564887f, 0.824365616f},
-std::array<float,2>{0.981828451f, 0.305643082f},
-std::array<float,2>{0.03609192f, 0.783669293f},
-std::array<float,2>{0.451442987f, 0.0187278148f},
-std::array<float,2>{0.749591351f, 0.608736634f},
-std::array<float,2>{0.580211043f, 0.125393808f},
-std::array<float,2>{0.339269251f, 0.65140003f},
-std::array<float,2>{0.221852273f, 0.421750933f},
-std::array<float,2>{0.832874417f, 0.984612465f},
-std::array<float,2>{0.727840006f, 0.266133428f},
-std::array<float,2>{0.460456699f, 0.757284403f},
-std::array<float,2>{0.0521037988f, 0.0600504242f},
-std::array<float,2>{0.992211163f, 0.581545115f},
-std::array<float,2>{0.81414777f, 0.158875465f},
-std::array<float,2>{0.235200152f, 0.682210088f},
-std::array<float,2>{0.321504325f, 0.404567599f},
-std::array<float,2>{0.56791383f, 0.947836459f},
-std::array<float,2>{0.920897126f, 0.497533977f},
-std::array<float,2>{0.0943162367f, 0.901183128f},
-std::array<float,2>{0.386644512f, 0.204617739f},
-std::array<float,2>{0.637127161f, 0.720400572f},
-std::array<float,2>{0.54731369f, 0.101509191f},
-std::array<float,2>{0.302222013f, 0.547615409f},
-std::array<float,2>{0.158290118f, 0.362728655f},
-std::array<float,2>{0.758453488f, 0.844472945f},
-std::array<float,2>{0.606305838f, 0.429850996f},
-std::array<float,2>{0.345699102f, 0.970000565f},
-std::array<float,2>{0.215682939f, 0.148225039f},
-std::array<float,2>{0.864772856f, 0.636942089f},
-std::array<float,2>{0.961897314f, 0.0094502205f},
-std::array<float,2>{0.0200062357f, 0.615810096f},
-std::array<float,2>{0.492580622f, 0.295939296f},
-std::array<float,2>{0.690324247f, 0.804188371f},
-std::array<float,2>{0.801667631f, 0.342952579f},
-std::array<float,2>{0.137536719f, 0.831112921f},
-std::array<float,2>{0.260805249f, 0.0746005476f},
-std::array<float,2>{0.505595088f, 0.511130631f},
-std::array<float,2>{0.674041867f, 0.237504914f},
-std::array<float,2>{0.409595639f, 0.69065243f},
-std::array<float,2>{0.085734956f, 0.458471894f},
-std::array<float,2>{0.877902985f, 0.919130445f},
-std::array<float,2>{0.577464283f, 0.283674836f},
-std::array<float,2>{0.317173392f, 0.804802775f},
-std::array<float,2>{0.244484946f, 0.00368422363f},
-std::array<float,2>{0.826162994f, 0.62129575f},
-std::array<float,2>{0.989809334f, 0.154314071f},
-std::array<float,2>{0.0616161898f, 0.631898403f},
-std::array<float,2>{0.466952264f, 0.426463574f},
-std::array<float,2>{0.724513412f, 0.984125376f},
-std::array<float,2>{0.754966557f, 0.466526151f},
-std::array<float,2>{0.169026345f, 0.91021508f},
-std::array<float,2>{0.306021094f, 0.246878728f},
-std::array<float,2>{0.561941385f, 0.696598947f},
-std::array<float,2>{0.631103575f, 0.0684652552f},
-std::array<float,2>{0.376607478f, 0.501503646f},
-std::array<float,2>{0.104418516f, 0.333671868f},
-std::array<float,2>{0.907150149f, 0.839333475f},
-std::array<float,2>{0.701190352f, 0.391301811f},
-std::array<float,2>{0.48478207f, 0.943743348f},
-std::array<float,2>{0.0268671885f, 0.169114247f},
-std::array<float,2>{0.959270716f, 0.67359817f},
-std::array<float,2>{0.870527446f, 0.0526141301f},
-std::array<float,2>{0.210398838f, 0.590949953f},
-std::array<float,2>{0.35371089f, 0.281014919f},
-std::array<float,2>{0.593779445f, 0.759555817f},
-std::array<float,2>{0.886283994f, 0.368901432f},
-std::array<float,2>{0.0864702389f, 0.852762818f},
-std::array<float,2>{0.417379498f, 0.104703061f},
-std::array<float,2>{0.685172558f, 0.560647488f},
-std::array<float,2>{0.512221456f, 0.215566725f},
-std::array<float,2>{0.251074106f, 0.729118109f},
-std::array<float,2>{0.125950903f, 0.485901177f},
-std::array<float,2>{0.811771214f, 0.896220446f},
-std::array<float,2>{0.661843419f, 0.322816283f},
-std::array<float,2>{0.429675251f, 0.815747082f},
-std::array<float,2>{0.0776337758f, 0.083388932f},
-std::array<float,2>{0.903119206f, 0.521555901f},
-std::array<float,2>{0.789067984f, 0.22078529f},
-std::array<float,2>{0.14542152f, 0.7037521f},
-std::array<float,2>{0.274577439f, 0.447597831f},
-std::array<float,2>{0.518274963f, 0.922948778f},
-std::array<float,2>{0.938441694f, 0.409652501f},
-std::array<float,2>{0.00574099692f, 0.995945573f},
-std::array<float,2>{0.474390566f, 0.137127966f},
-std::array<float,2>{0.715004981f, 0.648181498f},
-std::array<float,2>{0.61014241f, 0.0311226808f},
-std::array<float,2>{0.362443209f, 0.594471157f},
-std::array<float,2>{0.202315673f, 0.30272451f},
-std::array<float,2>{0.846960723f, 0.796840429f},
-std::array<float,2>{0.546046495f, 0.482560009f},
-std::array<float,2>{0.286725104f, 0.8847574f},
-std::array<float,2>{0.173789129f, 0.200556383f},
-std::array<float,2>{0.76726979f, 0.735039473f},
-std::array<float,2>{0.925328732f, 0.111874178f},
-std::array<float,2>{0.11561577f, 0.544417918f},
-std::array<float,2>{0.39311552f, 0.345465064f},
-std::array<float,2>{0.651047051f, 0.859780729f},
-std::array<float,2>{0.837914407f, 0.256044626f},
-std::array<float,2>{0.228199586f, 0.771759391f},
-std::array<float,2>{0.334658653f, 0.032001704f},
-std::array<float,2>{0.588828146f, 0.577299714f},
-std::array<float,2>{0.735372484f, 0.18344076f},
-std::array<float,2>{0.43965441f, 0.657126784f},
-std::array<float,2>{0.04505983f, 0.375890315f},
-std::array<float,2>{0.972351372f, 0.954813063f},
-std::array<float,2>{0.585325956f, 0.374184072f},
-std::array<float,2>{0.341625273f, 0.857339144f},
-std::array<float,2>{0.225489587f, 0.107628681f},
-std::array<float,2>{0.831645668f, 0.555682778f},
-std::array<float,2>{0.976819515f, 0.212750211f},
-std::array<float,2>{0.0312637649f, 0.731175482f},
-std::array<float,2>{0.448156446f, 0.489921957f},
-std::array<float,2>{0.744263351f, 0.893552125f},
-std::array<float,2>{0.774886549f, 0.396426052f},
-std::array<float,2>{0.183679163f, 0.941353679f},
-std::array<float,2>{0.294743836f, 0.166043371f},
-std::array<float,2>{0.533640623f, 0.677959323f},
-std::array<float,2>{0.64402914f, 0.0474624336f},
-std::array<float,2>{0.400442481f, 0.589130938f},
-std::array<float,2>{0.122084953f, 0.275605232f},
-std::array<float,2>{0.932464004f, 0.761732399f},
-std::array<float,2>{0.706644714f, 0.461572737f},
-std::array<float,2>{0.480315596f, 0.906297326f},
-std::array<float,2>{0.0119374432f, 0.24464868f},
-std::array<float,2>{0.952038467f, 0.699471414f},
-std::array<float,2>{0.857303798f, 0.0630946383f},
-std::array<float,2>{0.18755509f, 0.507149339f},
-std::array<float,2>{0.369754016f, 0.328185737f},
-std::array<float,2>{0.618836641f, 0.840365887f},
-std::array<float,2>{0.897934973f, 0.288640857f},
-std::array<float,2>{0.0650439039f, 0.810597479f},
-std::array<float,2>{0.431051433f, 0.0074427668f},
-std::array<float,2>{0.667314529f, 0.620784104f},
-std::array<float,2>{0.530199885f, 0.149673104f},
-std::array<float,2>{0.268528372f, 0.626634181f},
-std::array<float,2>{0.154643074f, 0.4246023f},
-std::array<float,2>{0.787347317f, 0.979792953f},
-std::array<float,2>{0.678036034f, 0.25298956f},
-std::array<float,2>{0.413214266f, 0.767699122f},
-std::array<float,2>{0.0815786943f, 0.0362807885f},
-std::array<float,2>{0.882642031f, 0.573374271f},
-std::array<float,2>{0.800095141f, 0.184953615f},
-std::array<float,2>{0.135704637f, 0.663882017f},
-std::array<float,2>{0.262551755f, 0.379655302f},
-std::array<float,2>{0.501022696f, 0.957780659f},
-std::array<float,2>{0.96519345f, 0.478517592f},
-std::array<float,2>{0.0159725007f, 0.888360798f},
-std::array<float,2>{0.499761939f, 0.19845593f},
-std::array<float,2>{0.69429183f, 0.739587426f},
-std::array<float,2>{0.603383005f, 0.113461487f},
-std::array<float,2>{0.347882956f, 0.541270733f},
-std::array<float,2>{0.21280095f, 0.348811328f},
-std::array<float,2>{0.863002896f, 0.863453031f},
-std::array<float,2>{0.553415239f, 0.4119021f},
-std::array<float,2>{0.298249692f, 0.996577621f},
-std::array<float,2>{0.16259177f, 0.136660501f},
-std::array<float,2>{0.765179217f, 0.641194224f},
-std::array<float,2>{0.917152703f, 0.025609646f},
-std::array<float,2>{0.0983414426f, 0.60017997f},
-std::array<float,2>{0.38707751f, 0.297021478f},
-std::array<float,2>{0.634697795f, 0.792572379f},
-std::array<float,2>{0.817186236f, 0.32490173f},
-std::array<float,2>{0.241288751f, 0.819454789f},
-std::array<float,2>{0.324310601f, 0.0803756788f},
-std::array<float,2>{0.563641489f, 0.518194377f},
-std::array<float,2>{0.73265779f, 0.224871531f},
-std::array<float,2>{0.456676215f, 0.708741426f},
-std::array<float,2>{0.048000142f, 0.452886015f},
-std::array<float,2>{0.999334216f, 0.926764846f},
-std::array<float,2>{0.508122206f, 0.30976963f},
-std::array<float,2>{0.257343054f, 0.785444975f},
-std::array<float,2>{0.12920633f, 0.0199862588f},
-std::array<float,2>{0.806045771f, 0.604805887f},
-std::array<float,2>{0.888660133f, 0.13014406f},
-std::array<float,2>{0.0908529982f, 0.652474523f},
-std::array<float,2>{0.42019406f, 0.416330278f},
-std::array<float,2>{0.681625605f, 0.989142299f},
-std::array<float,2>{0.87451452f, 0.439312875f},
-std::array<float,2>{0.20688647f, 0.931874394f},
-std::array<float,2>{0.356385082f, 0.233707413f},
-std::array<float,2>{0.59956944f, 0.713789463f},
-std::array<float,2>{0.695560575f, 0.0889029279f},
-std::array<float,2>{0.491813183f, 0.527636886f},
-std::array<float,2>{0.0286059473f, 0.314939171f},
-std::array<float,2>{0.954157233f, 0.821838975f},
-std::array<float,2>{0.628613174f, 0.384563774f},
-std::array<float,2>{0.380261183f, 0.964416862f},
-std::array<float,2>{0.108442567f, 0.172025472f},
-std::array<float,2>{0.910556197f, 0.667195082f},
-std::array<float,2>{0.752175331f, 0.0427300148f},
-std::array<float,2>{0.164523721f, 0.564296663f},
-std::array<float,2>{0.31056416f, 0.263822407f},
-std::array<float,2>{0.556713939f, 0.780374825f},
-std::array<float,2>{0.987527966f, 0.352220535f},
-std::array<float,2>{0.0571066476f, 0.874545753f},
-std::array<float,2>{0.463735431f, 0.123523779f},
-std::array<float,2>{0.721203506f, 0.533239841f},
-std::array<float,2>{0.571854532f, 0.192361742f},
-std::array<float,2>{0.315463513f, 0.743771195f},
-std::array<float,2>{0.24944672f, 0.475629687f},
-std::array<float,2>{0.823981047f, 0.878256261f},
-std::array<float,2>{0.738401771f, 0.33698532f},
-std::array<float,2>{0.443927407f, 0.832807422f},
-std::array<float,2>{0.0425169878f, 0.0732542798f},
-std::array<float,2>{0.974978685f, 0.513635218f},
-std::array<float,2>{0.839977801f, 0.239163086f},
-std::array<float,2>{0.23371911f, 0.694832146f},
-std::array<float,2>{0.329485089f, 0.454306126f},
-std::array<float,2>{0.591322899f, 0.917880535f},
-std::array<float,2>{0.928523958f, 0.435737967f},
-std::array<float,2>{0.109638758f, 0.975495934f},
-std::array<float,2>{0.395350575f, 0.140830427f},
-std::array<float,2>{0.65586406f, 0.635700285f},
-std::array<float,2>{0.539739251f, 0.0136626139f},
-std::array<float,2>{0.284849644f, 0.609520376f},
-std::array<float,2>{0.179128543f, 0.289821744f},
-std::array<float,2>{0.772092998f, 0.800139785f},
-std::array<float,2>{0.616826296f, 0.494872451f},
-std::array<float,2>{0.366657585f, 0.903970242f},
-std::array<float,2>{0.197360948f, 0.20901826f},
-std::array<float,2>{0.848734915f, 0.723082066f},
-std::array<float,2>{0.942162156f, 0.0953850523f},
-std::array<float,2>{0.00249756849f, 0.552426457f},
-std::array<float,2>{0.471549332f, 0.364377558f},
-std::array<float,2>{0.7127949f, 0.847882509f},
-std::array<float,2>{0.793394685f, 0.270244539f},
-std::array<float,2>{0.140691057f, 0.753454983f},
-std::array<float,2>{0.280985385f, 0.057648629f},
-std::array<float,2>{0.522496104f, 0.585608304f},
-std::array<float,2>{0.658904135f, 0.161566183f},
-std::array<float,2>{0.425454259f, 0.684265375f},
-std::array<float,2>{0.0741914883f, 0.399418414f},
-std::array<float,2>{0.899756432f, 0.952261269f},
-std::array<float,2>{0.538939536f, 0.318730623f},
-std::array<float,2>{0.292135745f, 0.826800585f},
-std::array<float,2>{0.1832885f, 0.0905592516f},
-std::array<float,2>{0.778949142f, 0.524491549f},
-std::array<float,2>{0.936694324f, 0.230351403f},
-std::array<float,2>{0.120389082f, 0.715644658f},
-std::array<float,2>{0.402668566f, 0.442053765f},
-std::array<float,2>{0.648050368f, 0.934379816f},
-std::array<float,2>{0.834687948f, 0.418543458f},
-std::array<float,2>{0.219620347f, 0.987582624f},
-std::array<float,2>{0.337305099f, 0.127075627f},
-std::array<float,2>{0.578422368f, 0.648561537f},
-std::array<float,2>{0.747437298f, 0.0168048795f},
-std::array<float,2>{0.450364888f, 0.605482638f},
-std::array<float,2>{0.0383898281f, 0.307452857f},
-std::array<float,2>{0.983614445f, 0.782715619f},
-std::array<float,2>{0.671026349f, 0.47086364f},
-std::array<float,2>{0.435079038f, 0.88129288f},
-std::array<float,2>{0.0664109811f, 0.19091174f},
-std::array<float,2>{0.892384887f, 0.749892473f},
-std::array<float,2>{0.78477931f, 0.120363854f},
-std::array<float,2>{0.148597017f, 0.538478851f},
-std::array<float,2>{0.2705383f, 0.356262535f},
-std::array<float,2>{0.524022877f, 0.868763506f},
-std::array<float,2>{0.946696758f, 0.258517206f},
-std::array<float,2>{0.00935588777f, 0.775832891f},
-std::array<float,2>{0.48198694f, 0.0452057309f},
-std::array<float,2>{0.70895046f, 0.568839908f},
-std::array<float,2>{0.623607576f, 0.177426279f},
-std::array<float,2>{0.37218529f, 0.670841217f},
-std::array<float,2>{0.191588089f, 0.389908165f},
-std::array<float,2>{0.852844477f, 0.966520429f},
-std::array<float,2>{0.68906641f, 0.294891238f},
-std::array<float,2>{0.494165599f, 0.801570058f},
-std::array<float,2>{0.02289184f, 0.0112536252f},
-std::array<float,2>{0.964508235f, 0.614757776f},
-std::array<float,2>{0.866640747f, 0.145822838f},
-std::array<float,2>{0.217443094f, 0.639892936f},
-std::array<float,2>{0.346647978f, 0.431750864f},
-std::array<float,2>{0.608832955f, 0.972620964f},
-std::array<float,2>{0.87617296f, 0.459715247f},
-std::array<float,2>{0.0825288892f, 0.9201442f},
-std::array<float,2>{0.406578124f, 0.23584196f},
-std::array<float,2>{0.671927929f, 0.687936366f},
-std::array<float,2>{0.506251514f, 0.0762856603f},
-std::array<float,2>{0.258316994f, 0.508076012f},
-std::array<float,2>{0.139579788f, 0.34032622f},
-std::array<float,2>{0.803656518f, 0.828312814f},
-std::array<float,2>{0.569729447f, 0.40402928f},
-std::array<float,2>{0.322827429f, 0.946485639f},
-std::array<float,2>{0.237500831f, 0.157546073f},
-std::array<float,2>{0.815860093f, 0.68085587f},
-std::array<float,2>{0.995679557f, 0.0614268668f},
-std::array<float,2>{0.0527876653f, 0.579932868f},
-std::array<float,2>{0.457474738f, 0.269207746f},
-std::array<float,2>{0.730184555f, 0.754795492f},
-std::array<float,2>{0.759930015f, 0.36054498f},
-std::array<float,2>{0.157545283f, 0.847261667f},
-std::array<float,2>{0.302792698f, 0.0982451886f},
-std::array<float,2>{0.550359368f, 0.550281227f},
-std::array<float,2>{0.640233219f, 0.20631896f},
-std::array<float,2>{0.383973271f, 0.7211532f},
-std::array<float,2>{0.0967247561f, 0.499657273f},
-std::array<float,2>{0.918769598f, 0.900363982f},
-std::array<float,2>{0.596429288f, 0.278021038f},
-std::array<float,2>{0.351804256f, 0.759785533f},
-std::array<float,2>{0.208923236f, 0.0533583052f},
-std::array<float,2>{0.867322683f, 0.592949629f},
-std::array<float,2>{0.957280457f, 0.17009148f},
-std::array<float,2>{0.0243204087f, 0.674213469f},
-std::array<float,2>{0.488221198f, 0.392625213f},
-std::array<float,2>{0.701027989f, 0.942637682f},
-std::array<float,2>{0.808740318f, 0.487188429f},
-std::array<float,2>{0.128316283f, 0.898240268f},
-std::array<float,2>{0.253229231f, 0.218226552f},
-std::array<float,2>{0.514511287f, 0.726708949f},
-std::array<float,2>{0.685733974f, 0.101928227f},
-std::array<float,2>{0.414629608f, 0.559317887f},
-std::array<float,2>{0.0888615251f, 0.371035695f},
-std::array<float,2>{0.88328594f, 0.854790986f},
-std::array<float,2>{0.724887788f, 0.428674519f},
-std::array<float,2>{0.465410143f, 0.981687605f},
-std::array<float,2>{0.0592169613f, 0.152499035f},
-std::array<float,2>{0.990556002f, 0.62941426f},
-std::array<float,2>{0.826828659f, 0.00147933816f},
-std::array<float,2>{0.242648467f, 0.624814093f},
-std::array<float,2>{0.319266677f, 0.281472594f},
-std::array<float,2>{0.575853884f, 0.807560086f},
-std::array<float,2>{0.909564912f, 0.334873259f},
-std::array<float,2>{0.103383951f, 0.8373577f},
-std::array<float,2>{0.37732628f, 0.0677747652f},
-std::array<float,2>{0.629451394f, 0.503541827f},
-std::array<float,2>{0.558996201f, 0.249117821f},
-std::array<float,2>{0.308278471f, 0.697554052f},
-std::array<float,2>{0.170323789f, 0.466907233f},
-std::array<float,2>{0.757400036f, 0.912757754f},
-std::array<float,2>{0.65036571f, 0.347158313f},
-std::array<float,2>{0.391571522f, 0.8626194f},
-std::array<float,2>{0.114212506f, 0.110583335f},
-std::array<float,2>{0.92351824f, 0.545933723f},
-std::array<float,2>{0.769430816f, 0.202826992f},
-std::array<float,2>{0.174498364f, 0.737693727f},
-std::array<float,2>{0.287967205f, 0.481785953f},
-std::array<float,2>{0.543543279f, 0.885742724f},
-std::array<float,2>{0.969389021f, 0.378445029f},
-std::array<float,2>{0.0437834635f, 0.955619693f},
-std::array<float,2>{0.438164681f, 0.180679575f},
-std::array<float,2>{0.738226235f, 0.659989476f},
-std::array<float,2>{0.587173164f, 0.0340903811f},
-std::array<float,2>{0.333472401f, 0.575466216f},
-std::array<float,2>{0.229995936f, 0.253914744f},
-std::array<float,2>{0.837359428f, 0.770466805f},
-std::array<float,2>{0.517254293f, 0.445814699f},
-std::array<float,2>{0.27559191f, 0.925652742f},
-std::array<float,2>{0.147190824f, 0.218764618f},
-std::array<float,2>{0.791193187f, 0.706437647f},
-std::array<float,2>{0.904367626f, 0.0847634375f},
-std::array<float,2>{0.0747218952f, 0.519717276f},
-std::array<float,2>{0.426337063f, 0.32131508f},
-std::array<float,2>{0.662378013f, 0.813367903f},
-std::array<float,2>{0.845359027f, 0.304386109f},
-std::array<float,2>{0.200688973f, 0.793510735f},
-std::array<float,2>{0.359414011f, 0.0287023596f},
-std::array<float,2>{0.613123119f, 0.596876979f},
-std::array<float,2>{0.71857965f, 0.139790609f},
-std::array<float,2>{0.474739701f, 0.645845234f},
-std::array<float,2>{0.00595606258f, 0.407934666f},
-std::array<float,2>{0.939996898f, 0.993457139f},
-std::array<float,2>{0.562647879f, 0.327855021f},
-std::array<float,2>{0.326067001f, 0.817028463f},
-std::array<float,2>{0.240500331f, 0.0784154013f},
-std::array<float,2>{0.817739666f, 0.51597631f},
-std::array<float,2>{0.998239517f, 0.223105595f},
-std::array<float,2>{0.0470600985f, 0.709114671f},
-std::array<float,2>{0.455908149f, 0.450249702f},
-std::array<float,2>{0.734287679f, 0.929403722f},
-std::array<float,2>{0.763742924f, 0.412800848f},
-std::array<float,2>{0.163603559f, 0.999442279f},
-std::array<float,2>{0.297750831f, 0.133976474f},
-std::array<float,2>{0.553765416f, 0.644138992f},
-std::array<float,2>{0.633423448f, 0.0240659844f},
-std::array<float,2>{0.388335824f, 0.598505676f},
-std::array<float,2>{0.0991820469f, 0.299044549f},
-std::array<float,2>{0.916157424f, 0.789561391f},
-std::array<float,2>{0.694745183f, 0.477832735f},
-std::array<float,2>{0.498391837f, 0.890291512f},
-std::array<float,2>{0.0174811874f, 0.195468307f},
-std::array<float,2>{0.966359913f, 0.742001653f},
-std::array<float,2>{0.86133945f, 0.116964571f},
-std::array<float,2>{0.211193979f, 0.539658844f},
-std::array<float,2>{0.348673135f, 0.350194037f},
-std::array<float,2>{0.601640821f, 0.866423905f},
-std::array<float,2>{0.881218791f, 0.250042707f},
-std::array<float,2>{0.0802934319f, 0.765640557f},
-std::array<float,2>{0.412764758f, 0.0389004573f},
-std::array<float,2>{0.679227352f, 0.571567953f},
-std::array<float,2>{0.50022918f, 0.187319994f},
-std::array<float,2>{0.263052434f, 0.660519183f},
-std::array<float,2>{0.13663657f, 0.382508129f},
-std::array<float,2>{0.799158871f, 0.960575521f},
-std::array<float,2>{0.666139245f, 0.285357893f},
-std::array<float,2>{0.430508405f, 0.809803307f},
-std::array<float,2>{0.0657472163f, 0.00424437923f},
-std::array<float,2>{0.896775544f, 0.618437231f},
-std::array<float,2>{0.788370132f, 0.15093568f},
-std::array<float,2>{0.155355737f, 0.627649188f},
-std::array<float,2>{0.269317746f, 0.423124462f},
-std::array<float,2>{0.531092465f, 0.978128254f},
-std::array<float,2>{0.952793658f, 0.464265108f},
-std::array<float,2>{0.0128285866f, 0.9091537f},
-std::array<float,2>{0.479262918f, 0.243043259f},
-std::array<float,2>{0.70583576f, 0.702676773f},
-std::array<float,2>{0.617886782f, 0.06572254f},
-std::array<float,2>{0.370406806f, 0.50517875f},
-std::array<float,2>{0.189298376f, 0.33077243f},
-std::array<float,2>{0.855672121f, 0.843352258f},
-std::array<float,2>{0.535095394f, 0.398221523f},
-std::array<float,2>{0.293311536f, 0.93762815f},
-std::array<float,2>{0.185147911f, 0.165703475f},
-std::array<float,2>{0.773744762f, 0.675785661f},
-std::array<float,2>{0.932873607f, 0.0507745482f},
-std::array<float,2>{0.121736638f, 0.586951315f},
-std::array<float,2>{0.401422054f, 0.274172932f},
-std::array<float,2>{0.642775059f, 0.765280545f},
-std::array<float,2>{0.830092311f, 0.372611284f},
-std::array<float,2>{0.225612968f, 0.858097672f},
-std::array<float,2>{0.340322167f, 0.107147954f},
-std::array<float,2>{0.584275782f, 0.557986617f},
-std::array<float,2>{0.745278299f, 0.213948786f},
-std::array<float,2>{0.44863528f, 0.733021796f},
-std::array<float,2>{0.033108186f, 0.490570843f},
-std::array<float,2>{0.978257775f, 0.891664624f},
-std::array<float,2>{0.52213943f, 0.273204386f},
-std::array<float,2>{0.279472649f, 0.751681507f},
-std::array<float,2>{0.141790181f, 0.0551800914f},
-std::array<float,2>{0.794130743f, 0.582773566f},
-std::array<float,2>{0.898487091f, 0.163386673f},
-std::array<float,2>{0.0724436492f, 0.686350405f},
-std::array<float,2>{0.424665987f, 0.401226789f},
-std::array<float,2>{0.65928787f, 0.950991273f},
-std::array<float,2>{0.847809613f, 0.493753076f},
-std::array<float,2>{0.199196309f, 0.905771077f},
-std::array<float,2>{0.365774721f, 0.207834572f},
-std::array<float,2>{0.61549753f, 0.726340532f},
-std::array<float,2>{0.711797178f, 0.0958016664f},
-std::array<float,2>{0.47236225f, 0.553186834f},
-std::array<float,2>{0.00366088073f, 0.366381645f},
-std::array<float,2>{0.942750275f, 0.851344883f},
-std::array<float,2>{0.655206919f, 0.434096396f},
-std::array<float,2>{0.396053851f, 0.974609077f},
-std::array<float,2>{0.110543288f, 0.14320372f},
-std::array<float,2>{0.929297328f, 0.63471812f},
-std::array<float,2>{0.773368776f, 0.015316763f},
-std::array<float,2>{0.178103164f, 0.612586439f},
-std::array<float,2>{0.283976048f, 0.291679412f},
-std::array<float,2>{0.54087764f, 0.797461867f},
-std::array<float,2>{0.976039529f, 0.339313596f},
-std::array<float,2>{0.0410484932f, 0.834678233f},
-std::array<float,2>{0.445069462f, 0.0710300878f},
-std::array<float,2>{0.739843369f, 0.513730526f},
-std::array<float,2>{0.590224445f, 0.241680801f},
-std::array<float,2>{0.328361928f, 0.69170332f},
-std::array<float,2>{0.233286291f, 0.456681043f},
-std::array<float,2>{0.840925574f, 0.915215135f},
-std::array<float,2>{0.722373545f, 0.354433775f},
-std::array<float,2>{0.464228302f, 0.87141943f},
-std::array<float,2>{0.0581928976f, 0.122635722f},
-std::array<float,2>{0.986821353f, 0.53281951f},
-std::array<float,2>{0.822658896f, 0.194666937f},
-std::array<float,2>{0.248268917f, 0.744828403f},
-std::array<float,2>{0.315329283f, 0.474180967f},
-std::array<float,2>{0.570436358f, 0.875449479f},
-std::array<float,2>{0.911540747f, 0.3860026f},
-std::array<float,2>{0.107924491f, 0.961369634f},
-std::array<float,2>{0.379106224f, 0.174814418f},
-std::array<float,2>{0.627653599f, 0.664500594f},
-std::array<float,2>{0.558238864f, 0.0401061364f},
-std::array<float,2>{0.311639667f, 0.564868391f},
-std::array<float,2>{0.165683463f, 0.262177914f},
-std::array<float,2>{0.753127098f, 0.777416408f},
-std::array<float,2>{0.597746789f, 0.440627754f},
-std::array<float,2>{0.357145727f, 0.930060029f},
-std::array<float,2>{0.205282003f, 0.230988443f},
-std::array<float,2>{0.873675704f, 0.711105883f},
-std::array<float,2>{0.95374918f, 0.086804308f},
-std::array<float,2>{0.0282537844f, 0.529740632f},
-std::array<float,2>{0.490303159f, 0.314210683f},
-std::array<float,2>{0.696462333f, 0.822956741f},
-std::array<float,2>{0.805488169f, 0.311698377f},
-std::array<float,2>{0.130118415f, 0.78753525f},
-std::array<float,2>{0.255962461f, 0.0231512673f},
-std::array<float,2>{0.509236276f, 0.602734864f},
-std::array<float,2>{0.679828346f, 0.131922543f},
-std::array<float,2>{0.421306968f, 0.655439258f},
-std::array<float,2>{0.0904295892f, 0.414559007f},
-std::array<float,2>{0.886777401f, 0.990950704f},
-std::array<float,2>{0.549334288f, 0.361894846f},
-std::array<float,2>{0.304425865f, 0.845617354f},
-std::array<float,2>{0.156990096f, 0.100238681f},
-std::array<float,2>{0.761274993f, 0.548195839f},
-std::array<float,2>{0.919166505f, 0.203343466f},
-std::array<float,2>{0.0961156562f, 0.719196796f},
-std::array<float,2>{0.383513153f, 0.496528089f},
-std::array<float,2>{0.639601052f, 0.90216881f},
-std::array<float,2>{0.815219223f, 0.405748218f},
-std::array<float,2>{0.237103373f, 0.949065149f},
-std::array<float,2>{0.323715895f, 0.159656376f},
-std::array<float,2>{0.568513989f, 0.683057725f},
-std::array<float,2>{0.72880125f, 0.0586743988f},
-std::array<float,2>{0.458061308f, 0.580445468f},
-std::array<float,2>{0.0545231588f, 0.267555684f},
-std::array<float,2>{0.994527042f, 0.756181479f},
-std::array<float,2>{0.673455119f, 0.457689643f},
-std::array<float,2>{0.407686234f, 0.918803513f},
-std::array<float,2>{0.0833546519f, 0.236399978f},
-std::array<float,2>{0.875279605f, 0.690150082f},
-std::array<float,2>{0.804593801f, 0.0757528245f},
-std::array<float,2>{0.140461966f, 0.510153353f},
-std::array<float,2>{0.259123981f, 0.34206754f},
-std::array<float,2>{0.507674694f, 0.830347836f},
-std::array<float,2>{0.96328187f, 0.295431286f},
-std::array<float,2>{0.021499915f, 0.802877903f},
-std::array<float,2>{0.495404959f, 0.0082657598f},
-std::array<float,2>{0.687851071f, 0.61713624f},
-std::array<float,2>{0.608314693f, 0.146932408f},
-std::array<float,2>{0.347342789f, 0.63860631f},
-std::array<float,2>{0.218249321f, 0.431010544f},
-std::array<float,2>{0.865837276f, 0.969686568f},
-std::array<float,2>{0.707153797f, 0.2607494f},
-std::array<float,2>{0.480879068f, 0.774205327f},
-std::array<float,2>{0.00805719476f, 0.0433144681f},
-std::array<float,2>{0.945336044f, 0.566442728f},
-std::array<float,2>{0.852411091f, 0.178529829f},
-std::array<float,2>{0.193244219f, 0.669386387f},
-std::array<float,2>{0.371650845f, 0.388621926f},
-std::array<float,2>{0.624812126f, 0.967492223f},
-std::array<float,2>{0.89144671f, 0.470478803f},
-std::array<float,2>{0.0674000606f, 0.880366087f},
-std::array<float,2>{0.434498221f, 0.188097492f},
-std::array<float,2>{0.670863509f, 0.747472882f},
-std::array<float,2>{0.524941444f, 0.118276715f},
-std::array<float,2>{0.269708753f, 0.536287785f},
-std::array<float,2>{0.149736196f, 0.358687758f},
-std::array<float,2>{0.783620417f, 0.870194495f},
-std::array<float,2>{0.579222381f, 0.420823991f},
-std::array<float,2>{0.336908013f, 0.98539722f},
-std::array<float,2>{0.220102325f, 0.126000747f},
-std::array<float,2>{0.83582145f, 0.650924265f},
-std::array<float,2>{0.983388245f, 0.0182525273f},
-std::array<float,2>{0.0377946384f, 0.607750356f},
-std::array<float,2>{0.450059921f, 0.306231767f},
-std::array<float,2>{0.746853709f, 0.784365237f},
-std::array<float,2>{0.778220892f, 0.317992359f},
-std::array<float,2>{0.182258889f, 0.825346768f},
-std::array<float,2>{0.291202158f, 0.0930023417f},
-std::array<float,2>{0.537670374f, 0.527168572f},
-std::array<float,2>{0.646946132f, 0.227588356f},
-std::array<float,2>{0.403462589f, 0.717972636f},
-std::array<float,2>{0.119143873f, 0.445250899f},
-std::array<float,2>{0.935729265f, 0.936448634f},
-std::array<float,2>{0.612191916f, 0.301101029f},
-std::array<float,2>{0.360447615f, 0.795272887f},
-std::array<float,2>{0.199294925f, 0.0297659747f},
-std::array<float,2>{0.844182849f, 0.595392168f},
-std::array<float,2>{0.940464675f, 0.138046265f},
-std::array<float,2>{0.00735116564f, 0.647266388f},
-std::array<float,2>{0.475713342f, 0.408375084f},
-std::array<float,2>{0.717063129f, 0.994469345f},
-std::array<float,2>{0.792519569f, 0.449071705f},
-std::array<float,2>{0.148211151f, 0.922354698f},
-std::array<float,2>{0.276368022f, 0.222260341f},
-std::array<float,2>{0.516074836f, 0.704645574f},
-std::array<float,2>{0.663481951f, 0.0823816285f},
-std::array<float,2>{0.426793873f, 0.522749782f},
-std::array<float,2>{0.0759432241f, 0.323807478f},
-std::array<float,2>{0.90598917f, 0.815222621f},
-std::array<float,2>{0.736999154f, 0.376421779f},
-std::array<float,2>{0.439149171f, 0.953341663f},
-std::array<float,2>{0.0445846021f, 0.181961417f},
-std::array<float,2>{0.970413446f, 0.657707334f},
-std::array<float,2>{0.83612746f, 0.0331095941f},
-std::array<float,2>{0.228915006f, 0.576370716f},
-std::array<float,2>{0.332688004f, 0.256940663f},
-std::array<float,2>{0.586410224f, 0.772990048f},
-std::array<float,2>{0.922009349f, 0.343850523f},
-std::array<float,2>{0.114996418f, 0.860817254f},
-std::array<float,2>{0.392338812f, 0.113155827f},
-std::array<float,2>{0.648969829f, 0.543395758f},
-std::array<float,2>{0.543997586f, 0.199630558f},
-std::array<float,2>{0.288617849f, 0.736201108f},
-std::array<float,2>{0.175756693f, 0.483519882f},
-std::array<float,2>{0.768123925f, 0.883191645f},
-std::array<float,2>{0.630573392f, 0.33246538f},
-std::array<float,2>{0.378645331f, 0.838455021f},
-std::array<float,2>{0.102200396f, 0.069570832f},
-std::array<float,2>{0.909069479f, 0.500038505f},
-std::array<float,2>{0.756178617f, 0.247874185f},
-std::array<float,2>{0.17092143f, 0.695417404f},
-std::array<float,2>{0.307206362f, 0.465274572f},
-std::array<float,2>{0.560273111f, 0.911169827f},
-std::array<float,2>{0.991852045f, 0.427609682f},
-std::array<float,2>{0.060488414f, 0.983373404f},
-std::array<float,2>{0.466742098f, 0.155836195f},
-std::array<float,2>{0.725674629f, 0.630896688f},
-std::array<float,2>{0.574470997f, 0.00272141281f},
-std::array<float,2>{0.319736242f, 0.622622073f},
-std::array<float,2>{0.244027957f, 0.284190953f},
-std::array<float,2>{0.828095973f, 0.806206286f},
-std::array<float,2>{0.515390456f, 0.484523416f},
-std::array<float,2>{0.252063513f, 0.895002306f},
-std::array<float,2>{0.127353042f, 0.216312647f},
-std::array<float,2>{0.810106099f, 0.729893208f},
-std::array<float,2>{0.884338379f, 0.103830963f},
-std::array<float,2>{0.089093931f, 0.562245905f},
-std::array<float,2>{0.415276289f, 0.367954105f},
-std::array<float,2>{0.687278152f, 0.852209508f},
-std::array<float,2>{0.868533909f, 0.279311895f},
-std::array<float,2>{0.207870901f, 0.7581743f},
-std::array<float,2>{0.352625102f, 0.0510659218f},
-std::array<float,2>{0.597436607f, 0.590097666f},
-std::array<float,2>{0.699514627f, 0.168680772f},
-std::array<float,2>{0.487058759f, 0.672104299f},
-std::array<float,2>{0.0250808988f, 0.392048448f},
-std::array<float,2>{0.958684504f, 0.944681048f},
-std::array<float,2>{0.605161369f, 0.348445565f},
-std::array<float,2>{0.350837439f, 0.864315033f},
-std::array<float,2>{0.214523271f, 0.114887282f},
-std::array<float,2>{0.86094594f, 0.542089105f},
-std::array<float,2>{0.967531979f, 0.197747558f},
-std::array<float,2>{0.0189941637f, 0.738850653f},
-std::array<float,2>{0.497997701f, 0.479813159f},
-std::array<float,2>{0.692997575f, 0.886891603f},
-std::array<float,2>{0.797550499f, 0.380613685f},
-std::array<float,2>{0.13304089f, 0.958252728f},
-std::array<float,2>{0.263768137f, 0.183836877f},
-std::array<float,2>{0.502033114f, 0.662985504f},
-std::array<float,2>{0.677379549f, 0.0360015184f},
-std::array<float,2>{0.410635978f, 0.572961688f},
-std::array<float,2>{0.0796236172f, 0.25281629f},
-std::array<float,2>{0.879496157f, 0.76937294f},
-std::array<float,2>{0.732289612f, 0.451268196f},
-std::array<float,2>{0.45489195f, 0.926596999f},
-std::array<float,2>{0.0505288094f, 0.225787804f},
-std::array<float,2>{0.997378945f, 0.707941353f},
-std::array<float,2>{0.819131076f, 0.0819079652f},
-std::array<float,2>{0.240119353f, 0.518858135f},
-std::array<float,2>{0.327356279f, 0.325288147f},
-std::array<float,2>{0.5657233f, 0.818378627f},
-std::array<float,2>{0.915591896f, 0.298000962f},
-std::array<float,2>{0.100025162f, 0.791876435f},
-std::array<float,2>{0.389444649f, 0.0263721962f},
-std::array<float,2>{0.635116398f, 0.600713015f},
-std::array<float,2>{0.55100286f, 0.135364369f},
-std::array<float,2>{0.299324483f, 0.641614377f},
-std::array<float,2>{0.161000147f, 0.410455674f},
-std::array<float,2>{0.762040615f, 0.997486413f},
-std::array<float,2>{0.640793979f, 0.276938319f},
-std::array<float,2>{0.399605304f, 0.763563156f},
-std::array<float,2>{0.124380358f, 0.0480092466f},
-std::array<float,2>{0.930384874f, 0.588373184f},
-std::array<float,2>{0.776015639f, 0.167699769f},
-std::array<float,2>{0.187444478f, 0.67893672f},
-std::array<float,2>{0.295503825f, 0.394927502f},
-std::array<float,2>{0.532693505f, 0.94009459f},
-std::array<float,2>{0.979139507f, 0.488376677f},
-std::array<float,2>{0.0338528492f, 0.894313514f},
-std::array<float,2>{0.445770562f, 0.211122796f},
-std::array<float,2>{0.742264926f, 0.731720865f},
-std::array<float,2>{0.582864225f, 0.108446561f},
-std::array<float,2>{0.341892719f, 0.555109918f},
-std::array<float,2>{0.223794878f, 0.37385872f},
-std::array<float,2>{0.82970506f, 0.856304705f},
-std::array<float,2>{0.528388381f, 0.425138265f},
-std::array<float,2>{0.267273545f, 0.978519082f},
-std::array<float,2>{0.1533342f, 0.149200529f},
-std::array<float,2>{0.786208749f, 0.6253497f},
-std::array<float,2>{0.895896256f, 0.00623541977f},
-std::array<float,2>{0.0631476194f, 0.61923486f},
-std::array<float,2>{0.432161242f, 0.287426502f},
-std::array<float,2>{0.665469527f, 0.812454522f},
-std::array<float,2>{0.858164608f, 0.329878837f},
-std::array<float,2>{0.189979345f, 0.841337562f},
-std::array<float,2>{0.368908286f, 0.0635726452f},
-std::array<float,2>{0.620143175f, 0.506019771f},
-std::array<float,2>{0.704645932f, 0.245695248f},
-std::array<float,2>{0.477923483f, 0.700947523f},
-std::array<float,2>{0.0152844703f, 0.462740451f},
-std::array<float,2>{0.951138675f, 0.907914221f},
-std::array<float,2>{0.542339444f, 0.290111929f},
-std::array<float,2>{0.282955289f, 0.79892385f},
-std::array<float,2>{0.177576765f, 0.0125711169f},
-std::array<float,2>{0.771408558f, 0.611161172f},
-std::array<float,2>{0.926093698f, 0.142424509f},
-std::array<float,2>{0.113198616f, 0.635971248f},
-std::array<float,2>{0.397864252f, 0.436543912f},
-std::array<float,2>{0.653426647f, 0.975723207f},
-std::array<float,2>{0.842964053f, 0.453381389f},
-std::array<float,2>{0.231850997f, 0.91610527f},
-std::array<float,2>{0.331221253f, 0.239354104f},
-std::array<float,2>{0.592527747f, 0.693991303f},
-std::array<float,2>{0.740927637f, 0.072481066f},
-std::array<float,2>{0.442347854f, 0.512305319f},
-std::array<float,2>{0.0400290675f, 0.336230814f},
-std::array<float,2>{0.973249912f, 0.83337754f},
-std::array<float,2>{0.656966627f, 0.399400502f},
-std::array<float,2>{0.422245681f, 0.951808691f},
-std::array<float,2>{0.0711974353f, 0.160831884f},
-std::array<float,2>{0.901836991f, 0.684758782f},
-std::array<float,2>{0.795434177f, 0.0568102747f},
-std::array<float,2>{0.144477561f, 0.584876716f},
-std::array<float,2>{0.277812332f, 0.270706147f},
-std::array<float,2>{0.520052016f, 0.752420425f},
-std::array<float,2>{0.944665134f, 0.36398986f},
-std::array<float,2>{0.000386223866f, 0.848942041f},
-std::array<float,2>{0.470285833f, 0.0945911705f},
-std::array<float,2>{0.71443975f, 0.550920427f},
-std::array<float,2>{0.614085257f, 0.210546061f},
-std::array<float,2>{0.364494056f, 0.723668873f},
-std::array<float,2>{0.197069645f, 0.495536923f},
-std::array<float,2>{0.850168407f, 0.903199077f},
-std::array<float,2>{0.697512388f, 0.315697879f},
-std::array<float,2>{0.489187002f, 0.820420742f},
-std::array<float,2>{0.0306645371f, 0.0887534767f},
-std::array<float,2>{0.956077278f, 0.52871865f},
-std::array<float,2>{0.872848392f, 0.233248621f},
-std::array<float,2>{0.203453407f, 0.714424133f},
-std::array<float,2>{0.358737051f, 0.438334495f},
-std::array<float,2>{0.600810826f, 0.932890892f},
-std::array<float,2>{0.890200436f, 0.417634279f},
-std::array<float,2>{0.093441993f, 0.989902139f},
-std::array<float,2>{0.418281078f, 0.129485622f},
-std::array<float,2>{0.682748675f, 0.654247642f},
-std::array<float,2>{0.511149943f, 0.0210347511f},
-std::array<float,2>{0.254335463f, 0.604471147f},
-std::array<float,2>{0.132434368f, 0.308886141f},
-std::array<float,2>{0.807084382f, 0.787086487f},
-std::array<float,2>{0.573465407f, 0.474689752f},
-std::array<float,2>{0.313161135f, 0.877000332f},
-std::array<float,2>{0.246849164f, 0.192747563f},
-std::array<float,2>{0.822113633f, 0.743054271f},
-std::array<float,2>{0.984675825f, 0.124580242f},
-std::array<float,2>{0.0557859875f, 0.534964383f},
-std::array<float,2>{0.461085409f, 0.353272349f},
-std::array<float,2>{0.720264912f, 0.873129785f},
-std::array<float,2>{0.751709342f, 0.265301555f},
-std::array<float,2>{0.167481795f, 0.779473066f},
-std::array<float,2>{0.30959186f, 0.0411113501f},
-std::array<float,2>{0.556073427f, 0.563230455f},
-std::array<float,2>{0.625064731f, 0.173554569f},
-std::array<float,2>{0.380866975f, 0.666651309f},
-std::array<float,2>{0.10651686f, 0.383244336f},
-std::array<float,2>{0.912788033f, 0.96337837f},
-std::array<float,2>{0.504012764f, 0.341718256f},
-std::array<float,2>{0.260423601f, 0.829252124f},
-std::array<float,2>{0.138458043f, 0.0776526928f},
-std::array<float,2>{0.801797807f, 0.509044409f},
-std::array<float,2>{0.878447592f, 0.235327765f},
-std::array<float,2>{0.0840229467f, 0.688907087f},
-std::array<float,2>{0.408492178f, 0.460824043f},
-std::array<float,2>{0.675645947f, 0.921832502f},
-std::array<float,2>{0.864075303f, 0.433317512f},
-std::array<float,2>{0.216658607f, 0.971318543f},
-std::array<float,2>{0.343883783f, 0.144930124f},
-std::array<float,2>{0.606921852f, 0.63869369f},
-std::array<float,2>{0.690931618f, 0.00977837108f},
-std::array<float,2>{0.49399969f, 0.613785982f},
-std::array<float,2>{0.0209032167f, 0.293886125f},
-std::array<float,2>{0.962248981f, 0.802583456f},
-std::array<float,2>{0.638098598f, 0.498120904f},
-std::array<float,2>{0.385039806f, 0.898512125f},
-std::array<float,2>{0.0947827622f, 0.205923304f},
-std::array<float,2>{0.92126435f, 0.722039342f},
-std::array<float,2>{0.759568632f, 0.0989553407f},
-std::array<float,2>{0.159592554f, 0.549642861f},
-std::array<float,2>{0.301018834f, 0.36005047f},
-std::array<float,2>{0.548618376f, 0.846665263f},
-std::array<float,2>{0.994071484f, 0.268101096f},
-std::array<float,2>{0.0516327061f, 0.755832791f},
-std::array<float,2>{0.459065855f, 0.0620709807f},
-std::array<float,2>{0.727413535f, 0.578604221f},
-std::array<float,2>{0.566931903f, 0.156708792f},
-std::array<float,2>{0.320750386f, 0.680164337f},
-std::array<float,2>{0.236289591f, 0.402380049f},
-std::array<float,2>{0.813329041f, 0.945904434f},
-std::array<float,2>{0.748231828f, 0.307899326f},
-std::array<float,2>{0.452864826f, 0.781819224f},
-std::array<float,2>{0.0363931395f, 0.0163518507f},
-std::array<float,2>{0.980914235f, 0.607174933f},
-std::array<float,2>{0.83355844f, 0.128206491f},
-std::array<float,2>{0.221610591f, 0.649630785f},
-std::array<float,2>{0.338437825f, 0.419769645f},
-std::array<float,2>{0.581792653f, 0.987200856f},
-std::array<float,2>{0.934930801f, 0.442526877f},
-std::array<float,2>{0.117522083f, 0.934803009f},
-std::array<float,2>{0.404956609f, 0.228947178f},
-std::array<float,2>{0.645734787f, 0.716542363f},
-std::array<float,2>{0.535617411f, 0.0915510356f},
-std::array<float,2>{0.290572077f, 0.523830295f},
-std::array<float,2>{0.181622282f, 0.320268124f},
-std::array<float,2>{0.780373693f, 0.827375472f},
-std::array<float,2>{0.621438384f, 0.389403939f},
-std::array<float,2>{0.374472141f, 0.965807855f},
-std::array<float,2>{0.195017338f, 0.175988331f},
-std::array<float,2>{0.854852974f, 0.671377063f},
-std::array<float,2>{0.949164927f, 0.0466452204f},
-std::array<float,2>{0.0117154997f, 0.570248842f},
-std::array<float,2>{0.482509822f, 0.259198278f},
-std::array<float,2>{0.709586799f, 0.776757061f},
-std::array<float,2>{0.783094943f, 0.357344717f},
-std::array<float,2>{0.150548935f, 0.867607117f},
-std::array<float,2>{0.272916645f, 0.119460486f},
-std::array<float,2>{0.526115239f, 0.537710667f},
-std::array<float,2>{0.66904211f, 0.190093741f},
-std::array<float,2>{0.436149359f, 0.748712778f},
-std::array<float,2>{0.0696651042f, 0.47216782f},
-std::array<float,2>{0.892752349f, 0.882074118f},
-std::array<float,2>{0.589319468f, 0.255109876f},
-std::array<float,2>{0.33592391f, 0.771348238f},
-std::array<float,2>{0.227149457f, 0.0345706046f},
-std::array<float,2>{0.839669168f, 0.574510276f},
-std::array<float,2>{0.97143954f, 0.179885775f},
-std::array<float,2>{0.0462037921f, 0.658758104f},
-std::array<float,2>{0.44072032f, 0.377813667f},
-std::array<float,2>{0.734676123f, 0.956843913f},
-std::array<float,2>{0.766454339f, 0.481028914f},
-std::array<float,2>{0.172613978f, 0.885047078f},
-std::array<float,2>{0.285248518f, 0.201240018f},
-std::array<float,2>{0.545527637f, 0.73649472f},
-std::array<float,2>{0.651663959f, 0.10997083f},
-std::array<float,2>{0.394499749f, 0.545517325f},
-std::array<float,2>{0.116921186f, 0.345928371f},
-std::array<float,2>{0.924477637f, 0.861527085f},
-std::array<float,2>{0.716606617f, 0.407081246f},
-std::array<float,2>{0.473420501f, 0.99283582f},
-std::array<float,2>{0.00475153746f, 0.139608517f},
-std::array<float,2>{0.939144492f, 0.645454705f},
-std::array<float,2>{0.845868468f, 0.0276666824f},
-std::array<float,2>{0.201741844f, 0.596091032f},
-std::array<float,2>{0.361381739f, 0.303094566f},
-std::array<float,2>{0.610595345f, 0.794008553f},
-std::array<float,2>{0.903691351f, 0.321094573f},
-std::array<float,2>{0.0764534324f, 0.813793004f},
-std::array<float,2>{0.428685188f, 0.0850631744f},
-std::array<float,2>{0.661072373f, 0.520906329f},
-std::array<float,2>{0.519246161f, 0.220455199f},
-std::array<float,2>{0.273534715f, 0.705804408f},
-std::array<float,2>{0.145872474f, 0.446868807f},
-std::array<float,2>{0.790119588f, 0.924319863f},
-std::array<float,2>{0.684268534f, 0.369443327f},
-std::array<float,2>{0.416748524f, 0.853681207f},
-std::array<float,2>{0.0873851255f, 0.103039272f},
-std::array<float,2>{0.885541916f, 0.560290277f},
-std::array<float,2>{0.81137836f, 0.216989994f},
-std::array<float,2>{0.126690537f, 0.727683306f},
-std::array<float,2>{0.250358641f, 0.487448096f},
-std::array<float,2>{0.51342082f, 0.896494508f},
-std::array<float,2>{0.960869133f, 0.394364774f},
-std::array<float,2>{0.0263580289f, 0.942059875f},
-std::array<float,2>{0.485615462f, 0.170949847f},
-std::array<float,2>{0.702262104f, 0.675423324f},
-std::array<float,2>{0.595009327f, 0.0545754731f},
-std::array<float,2>{0.354725748f, 0.591878057f},
-std::array<float,2>{0.209356859f, 0.278985441f},
-std::array<float,2>{0.869306207f, 0.761423349f},
-std::array<float,2>{0.560853064f, 0.468024284f},
-std::array<float,2>{0.305645227f, 0.91337353f},
-std::array<float,2>{0.168201566f, 0.248564482f},
-std::array<float,2>{0.754706025f, 0.698323905f},
-std::array<float,2>{0.908024609f, 0.0664978921f},
-std::array<float,2>{0.10483738f, 0.502732038f},
-std::array<float,2>{0.375970304f, 0.335252792f},
-std::array<float,2>{0.63270849f, 0.836295426f},
-std::array<float,2>{0.824260235f, 0.282404363f},
-std::array<float,2>{0.245311275f, 0.808439314f},
-std::array<float,2>{0.317416459f, 0.0001459544f},
-std::array<float,2>{0.576922059f, 0.623383522f},
-std::array<float,2>{0.723555386f, 0.153486758f},
-std::array<float,2>{0.468741685f, 0.630662799f},
-std::array<float,2>{0.0613693148f, 0.429275125f},
-std::array<float,2>{0.988589406f, 0.981428802f},
-std::array<float,2>{0.601260364f, 0.313552678f},
-std::array<float,2>{0.359094799f, 0.822675407f},
-std::array<float,2>{0.204013109f, 0.0860284865f},
-std::array<float,2>{0.872105539f, 0.529848933f},
-std::array<float,2>{0.956955373f, 0.230524138f},
-std::array<float,2>{0.0308032501f, 0.711456478f},
-std::array<float,2>{0.488751382f, 0.441233367f},
-std::array<float,2>{0.698146224f, 0.930650353f},
-std::array<float,2>{0.807571292f, 0.414421171f},
-std::array<float,2>{0.132051378f, 0.990636468f},
-std::array<float,2>{0.254617065f, 0.132637575f},
-std::array<float,2>{0.511291444f, 0.65599525f},
-std::array<float,2>{0.683528662f, 0.0226266626f},
-std::array<float,2>{0.418518543f, 0.603489518f},
-std::array<float,2>{0.0932049304f, 0.312220603f},
-std::array<float,2>{0.889771998f, 0.787892103f},
-std::array<float,2>{0.719831705f, 0.473804742f},
-std::array<float,2>{0.461795777f, 0.875589728f},
-std::array<float,2>{0.0564679615f, 0.194864452f},
-std::array<float,2>{0.985197961f, 0.744456112f},
-std::array<float,2>{0.821583271f, 0.122178547f},
-std::array<float,2>{0.246463209f, 0.532232463f},
-std::array<float,2>{0.312910557f, 0.353867114f},
-std::array<float,2>{0.574073195f, 0.871931255f},
-std::array<float,2>{0.912548423f, 0.262651354f},
-std::array<float,2>{0.107035585f, 0.778273761f},
-std::array<float,2>{0.381559908f, 0.0408360735f},
-std::array<float,2>{0.625826776f, 0.565418601f},
-std::array<float,2>{0.556573331f, 0.175647512f},
-std::array<float,2>{0.310110152f, 0.664638996f},
-std::array<float,2>{0.167231247f, 0.386311144f},
-std::array<float,2>{0.751099408f, 0.961463213f},
-std::array<float,2>{0.653852165f, 0.291049451f},
-std::array<float,2>{0.398142606f, 0.79697758f},
-std::array<float,2>{0.112607412f, 0.014907768f},
-std::array<float,2>{0.926354051f, 0.613168836f},
-std::array<float,2>{0.770568013f, 0.142726436f},
-std::array<float,2>{0.177009553f, 0.633883715f},
-std::array<float,2>{0.282639414f, 0.43363601f},
-std::array<float,2>{0.542578161f, 0.974048853f},
-std::array<float,2>{0.972932041f, 0.456532896f},
-std::array<float,2>{0.0395084098f, 0.915890753f},
-std::array<float,2>{0.44155398f, 0.242037758f},
-std::array<float,2>{0.740571439f, 0.69201988f},
-std::array<float,2>{0.592081189f, 0.0707412213f},
-std::array<float,2>{0.331878632f, 0.514317214f},
-std::array<float,2>{0.23212792f, 0.339389503f},
-std::array<float,2>{0.84339422f, 0.833987951f},
-std::array<float,2>{0.520007849f, 0.400491327f},
-std::array<float,2>{0.277844965f, 0.950401425f},
-std::array<float,2>{0.143599957f, 0.163677812f},
-std::array<float,2>{0.795028031f, 0.685800552f},
-std::array<float,2>{0.902011931f, 0.0548881814f},
-std::array<float,2>{0.070359461f, 0.58242029f},
-std::array<float,2>{0.422835857f, 0.272638589f},
-std::array<float,2>{0.656616867f, 0.751062512f},
-std::array<float,2>{0.849721313f, 0.366944373f},
-std::array<float,2>{0.196565092f, 0.850696325f},
-std::array<float,2>{0.364882201f, 0.0962036848f},
-std::array<float,2>{0.613490939f, 0.553622663f},
-std::array<float,2>{0.714220762f, 0.207332537f},
-std::array<float,2>{0.469834179f, 0.72565043f},
-std::array<float,2>{0.000508649449f, 0.493575066f},
-std::array<float,2>{0.94489634f, 0.905366898f},
-std::array<float,2>{0.532789707f, 0.273804158f},
-std::array<float,2>{0.295079172f, 0.764784157f},
-std::array<float,2>{0.186972588f, 0.0499011241f},
-std::array<float,2>{0.775648892f, 0.587768257f},
-std::array<float,2>{0.930070102f, 0.165200964f},
-std::array<float,2>{0.124783121f, 0.676749587f},
-std::array<float,2>{0.400194943f, 0.397870362f},
-std::array<float,2>{0.641153574f, 0.93846482f},
-std::array<float,2>{0.82941103f, 0.491196066f},
-std::array<float,2>{0.224136382f, 0.892556071f},
-std::array<float,2>{0.342533708f, 0.214495137f},
-std::array<float,2>{0.582510054f, 0.732678771f},
-std::array<float,2>{0.74315393f, 0.106781222f},
-std::array<float,2>{0.446203619f, 0.558256328f},
-std::array<float,2>{0.0332589597f, 0.372556448f},
-std::array<float,2>{0.97869277f, 0.857640088f},
-std::array<float,2>{0.665552616f, 0.42368567f},
-std::array<float,2>{0.431647062f, 0.977796018f},
-std::array<float,2>{0.0628118962f, 0.15064992f},
-std::array<float,2>{0.89610678f, 0.626968324f},
-std::array<float,2>{0.786948621f, 0.00452336157f},
-std::array<float,2>{0.154276952f, 0.61886692f},
-std::array<float,2>{0.266897023f, 0.285676956f},
-std::array<float,2>{0.529121637f, 0.810354412f},
-std::array<float,2>{0.950333118f, 0.33035171f},
-std::array<float,2>{0.0148456562f, 0.843038261f},
-std::array<float,2>{0.478168905f, 0.0662783459f},
-std::array<float,2>{0.704220295f, 0.505708456f},
-std::array<float,2>{0.620631397f, 0.242675617f},
-std::array<float,2>{0.368466824f, 0.702231169f},
-std::array<float,2>{0.189790085f, 0.464819282f},
-std::array<float,2>{0.857814312f, 0.90863961f},
-std::array<float,2>{0.692537546f, 0.349694818f},
-std::array<float,2>{0.497268081f, 0.866807282f},
-std::array<float,2>{0.0194375925f, 0.116266392f},
-std::array<float,2>{0.967101455f, 0.539254069f},
-std::array<float,2>{0.86071384f, 0.196219027f},
-std::array<float,2>{0.214149415f, 0.741323948f},
-std::array<float,2>{0.351388365f, 0.478417814f},
-std::array<float,2>{0.604832709f, 0.889757812f},
-std::array<float,2>{0.878916204f, 0.382130891f},
-std::array<float,2>{0.0794732049f, 0.960233927f},
-std::array<float,2>{0.410740346f, 0.186725006f},
-std::array<float,2>{0.677068949f, 0.660820842f},
-std::array<float,2>{0.502477109f, 0.0382186882f},
-std::array<float,2>{0.264279693f, 0.572191119f},
-std::array<float,2>{0.133779913f, 0.250882506f},
-std::array<float,2>{0.797055781f, 0.766160607f},
-std::array<float,2>{0.566309512f, 0.450869709f},
-std::array<float,2>{0.327768594f, 0.928765893f},
-std::array<float,2>{0.239374429f, 0.223362193f},
-std::array<float,2>{0.818753541f, 0.709523141f},
-std::array<float,2>{0.997703493f, 0.0788672939f},
-std::array<float,2>{0.049824059f, 0.51631856f},
-std::array<float,2>{0.454260528f, 0.327399254f},
-std::array<float,2>{0.731762648f, 0.816752851f},
-std::array<float,2>{0.76235342f, 0.299783885f},
-std::array<float,2>{0.160347134f, 0.789453447f},
-std::array<float,2>{0.298975199f, 0.0236577466f},
-std::array<float,2>{0.551486731f, 0.597790241f},
-std::array<float,2>{0.63562566f, 0.134291813f},
-std::array<float,2>{0.388907015f, 0.643569827f},
-std::array<float,2>{0.100208677f, 0.412332147f},
-std::array<float,2>{0.915232122f, 0.99986428f},
-std::array<float,2>{0.512903571f, 0.367626935f},
-std::array<float,2>{0.250611037f, 0.851970971f},
-std::array<float,2>{0.126341254f, 0.104043216f},
-std::array<float,2>{0.810744464f, 0.561525345f},
-std::array<float,2>{0.884822309f, 0.216091529f},
-std::array<float,2>{0.08756724f, 0.730324864f},
-std::array<float,2>{0.4165034f, 0.484897166f},
-std::array<float,2>{0.683963478f, 0.895086229f},
-std::array<float,2>{0.869950891f, 0.392171949f},
-std::array<float,2>{0.209848657f, 0.944947004f},
-std::array<float,2>{0.355452925f, 0.168429121f},
-std::array<float,2>{0.59545356f, 0.672441661f},
-std::array<float,2>{0.702754855f, 0.0514659546f},
-std::array<float,2>{0.485955477f, 0.590344965f},
-std::array<float,2>{0.0255024154f, 0.280095518f},
-std::array<float,2>{0.960189342f, 0.7586959f},
-std::array<float,2>{0.631860733f, 0.465387046f},
-std::array<float,2>{0.375075638f, 0.911773622f},
-std::array<float,2>{0.105029181f, 0.247332767f},
-std::array<float,2>{0.907544613f, 0.695990622f},
-std::array<float,2>{0.754047871f, 0.0698477477f},
-std::array<float,2>{0.168862388f, 0.500854075f},
-std::array<float,2>{0.305049717f, 0.332864463f},
-std::array<float,2>{0.561285436f, 0.838160336f},
-std::array<float,2>{0.98883301f, 0.284873754f},
-std::array<float,2>{0.0605987459f, 0.805923879f},
-std::array<float,2>{0.468122929f, 0.0022175957f},
-std::array<float,2>{0.722832739f, 0.622135222f},
-std::array<float,2>{0.576512098f, 0.155726522f},
-std::array<float,2>{0.318315238f, 0.631679714f},
-std::array<float,2>{0.245838016f, 0.426786721f},
-std::array<float,2>{0.824737966f, 0.982569039f},
-std::array<float,2>{0.735016346f, 0.257331997f},
-std::array<float,2>{0.441072464f, 0.77255547f},
-std::array<float,2>{0.0468206704f, 0.032520093f},
-std::array<float,2>{0.970995188f, 0.576682448f},
-std::array<float,2>{0.838979721f, 0.182129487f},
-std::array<float,2>{0.226614833f, 0.658178031f},
-std::array<float,2>{0.335379779f, 0.376646906f},
-std::array<float,2>{0.589526057f, 0.954048693f},
-std::array<float,2>{0.924283803f, 0.48408708f},
-std::array<float,2>{0.116558209f, 0.883338749f},
-std::array<float,2>{0.393692434f, 0.200009421f},
-std::array<float,2>{0.652185321f, 0.735442579f},
-std::array<float,2>{0.544981182f, 0.112477332f},
-std::array<float,2>{0.286038846f, 0.543539643f},
-std::array<float,2>{0.172123268f, 0.344347775f},
-std::array<float,2>{0.765973687f, 0.86107558f},
-std::array<float,2>{0.611161172f, 0.408738852f},
-std::array<float,2>{0.361937702f, 0.994633138f},
-std::array<float,2>{0.201415643f, 0.138462111f},
-std::array<float,2>{0.846331656f, 0.646850765f},
-std::array<float,2>{0.938828886f, 0.0298118275f},
-std::array<float,2>{0.00433818437f, 0.595164061f},
-std::array<float,2>{0.472820103f, 0.301453531f},
-std::array<float,2>{0.715922236f, 0.795601845f},
-std::array<float,2>{0.790940583f, 0.323519349f},
-std::array<float,2>{0.14630416f, 0.814706087f},
-std::array<float,2>{0.274181873f, 0.0825518891f},
-std::array<float,2>{0.518866003f, 0.52322495f},
-std::array<float,2>{0.660417318f, 0.221933633f},
-std::array<float,2>{0.428117543f, 0.704339981f},
-std::array<float,2>{0.0766873956f, 0.448478997f},
-std::array<float,2>{0.90394479f, 0.922837079f},
-std::array<float,2>{0.581279635f, 0.306130528f},
-std::array<float,2>{0.338189095f, 0.785114229f},
-std::array<float,2>{0.22076489f, 0.017584607f},
-std::array<float,2>{0.833173215f, 0.608216286f},
-std::array<float,2>{0.981024504f, 0.126866534f},
-std::array<float,2>{0.036865823f, 0.650395989f},
-std::array<float,2>{0.452591479f, 0.4201051f},
-std::array<float,2>{0.748839796f, 0.98613447f},
-std::array<float,2>{0.781128049f, 0.444787025f},
-std::array<float,2>{0.180801392f, 0.93565613f},
-std::array<float,2>{0.290057629f, 0.228095576f},
-std::array<float,2>{0.536007464f, 0.718397737f},
-std::array<float,2>{0.646319926f, 0.0933845937f},
-std::array<float,2>{0.404672503f, 0.526666522f},
-std::array<float,2>{0.117720656f, 0.317808509f},
-std::array<float,2>{0.935086071f, 0.825684845f},
-std::array<float,2>{0.709081113f, 0.387719721f},
-std::array<float,2>{0.483079642f, 0.966822743f},
-std::array<float,2>{0.0108910874f, 0.178181514f},
-std::array<float,2>{0.948699653f, 0.669764161f},
-std::array<float,2>{0.855069637f, 0.0435124934f},
-std::array<float,2>{0.194447622f, 0.567218423f},
-std::array<float,2>{0.374515235f, 0.26130864f},
-std::array<float,2>{0.622068882f, 0.77378267f},
-std::array<float,2>{0.893550456f, 0.359311998f},
-std::array<float,2>{0.0699920729f, 0.870990455f},
-std::array<float,2>{0.436019599f, 0.119138151f},
-std::array<float,2>{0.669829071f, 0.536683321f},
-std::array<float,2>{0.52544409f, 0.187876254f},
-std::array<float,2>{0.273247361f, 0.74791646f},
-std::array<float,2>{0.151125163f, 0.470002353f},
-std::array<float,2>{0.782512784f, 0.88041836f},
-std::array<float,2>{0.674880505f, 0.342600077f},
-std::array<float,2>{0.408813447f, 0.830611885f},
-std::array<float,2>{0.0848449469f, 0.0755738914f},
-std::array<float,2>{0.878013432f, 0.510436416f},
-std::array<float,2>{0.802647948f, 0.23713775f},
-std::array<float,2>{0.138029814f, 0.689698935f},
-std::array<float,2>{0.259905547f, 0.457298845f},
-std::array<float,2>{0.504620492f, 0.918369949f},
-std::array<float,2>{0.962485909f, 0.431250304f},
-std::array<float,2>{0.0213273875f, 0.968993902f},
-std::array<float,2>{0.493393868f, 0.147051007f},
-std::array<float,2>{0.690623403f, 0.637988091f},
-std::array<float,2>{0.60740757f, 0.00830107275f},
-std::array<float,2>{0.344324678f, 0.61627692f},
-std::array<float,2>{0.216139451f, 0.295168281f},
-std::array<float,2>{0.863481641f, 0.803655744f},
-std::array<float,2>{0.548288643f, 0.496968657f},
-std::array<float,2>{0.301727057f, 0.901390553f},
-std::array<float,2>{0.159682363f, 0.203780383f},
-std::array<float,2>{0.759207368f, 0.719544291f},
-std::array<float,2>{0.921553612f, 0.0996208936f},
-std::array<float,2>{0.0955386162f, 0.548787117f},
-std::array<float,2>{0.385731846f, 0.361742109f},
-std::array<float,2>{0.638307035f, 0.84507376f},
-std::array<float,2>{0.812692821f, 0.266728401f},
-std::array<float,2>{0.235631809f, 0.756524563f},
-std::array<float,2>{0.320978105f, 0.059508305f},
-std::array<float,2>{0.566527188f, 0.581025064f},
-std::array<float,2>{0.727013111f, 0.159773454f},
-std::array<float,2>{0.459631294f, 0.683444679f},
-std::array<float,2>{0.0512244515f, 0.406247586f},
-std::array<float,2>{0.993200719f, 0.948643506f},
-std::array<float,2>{0.570967257f, 0.352720827f},
-std::array<float,2>{0.314658731f, 0.87378931f},
-std::array<float,2>{0.24876f, 0.124263309f},
-std::array<float,2>{0.82290256f, 0.53437835f},
-std::array<float,2>{0.986473143f, 0.192997724f},
-std::array<float,2>{0.0576173738f, 0.742343724f},
-std::array<float,2>{0.46463725f, 0.475251704f},
-std::array<float,2>{0.721932232f, 0.877689302f},
-std::array<float,2>{0.753731191f, 0.383407414f},
-std::array<float,2>{0.165508717f, 0.963677585f},
-std::array<float,2>{0.312111139f, 0.173245564f},
-std::array<float,2>{0.557863891f, 0.666369975f},
-std::array<float,2>{0.627316892f, 0.0419703461f},
-std::array<float,2>{0.379465818f, 0.562927723f},
-std::array<float,2>{0.107791424f, 0.265096962f},
-std::array<float,2>{0.911688924f, 0.780010223f},
-std::array<float,2>{0.697070897f, 0.437765777f},
-std::array<float,2>{0.490856647f, 0.933252931f},
-std::array<float,2>{0.0273476727f, 0.232888147f},
-std::array<float,2>{0.953438878f, 0.714088023f},
-std::array<float,2>{0.873052657f, 0.0883336365f},
-std::array<float,2>{0.205829114f, 0.529039979f},
-std::array<float,2>{0.356560051f, 0.316043913f},
-std::array<float,2>{0.59860307f, 0.820892334f},
-std::array<float,2>{0.887346506f, 0.309557199f},
-std::array<float,2>{0.0900538713f, 0.786518455f},
-std::array<float,2>{0.421453357f, 0.0207230374f},
-std::array<float,2>{0.680581987f, 0.603782713f},
-std::array<float,2>{0.50932461f, 0.129117534f},
-std::array<float,2>{0.256676644f, 0.653444827f},
-std::array<float,2>{0.130846351f, 0.417060137f},
-std::array<float,2>{0.805043459f, 0.989362597f},
-std::array<float,2>{0.660016954f, 0.271189213f},
-std::array<float,2>{0.42422682f, 0.752759993f},
-std::array<float,2>{0.0728636831f, 0.0571318269f},
-std::array<float,2>{0.899321735f, 0.584383309f},
-std::array<float,2>{0.794709206f, 0.160571024f},
-std::array<float,2>{0.142278343f, 0.685267806f},
-std::array<float,2>{0.280243993f, 0.398632497f},
-std::array<float,2>{0.521908462f, 0.951614439f},
-std::array<float,2>{0.943093061f, 0.496071249f},
-std::array<float,2>{0.00337975309f, 0.902432799f},
-std::array<float,2>{0.472156346f, 0.210252911f},
-std::array<float,2>{0.711390853f, 0.724495888f},
-std::array<float,2>{0.615984619f, 0.0940780565f},
-std::array<float,2>{0.365312189f, 0.551432252f},
-std::array<float,2>{0.198417529f, 0.363663137f},
-std::array<float,2>{0.848157525f, 0.849595428f},
-std::array<float,2>{0.540442884f, 0.437396765f},
-std::array<float,2>{0.283603668f, 0.976383805f},
-std::array<float,2>{0.178603455f, 0.142057255f},
-std::array<float,2>{0.772900701f, 0.636407077f},
-std::array<float,2>{0.929192245f, 0.0121764503f},
-std::array<float,2>{0.11120744f, 0.610655785f},
-std::array<float,2>{0.395599425f, 0.290848762f},
-std::array<float,2>{0.654579759f, 0.799356937f},
-std::array<float,2>{0.841434002f, 0.336757958f},
-std::array<float,2>{0.232685789f, 0.833591938f},
-std::array<float,2>{0.328864694f, 0.0731966123f},
-std::array<float,2>{0.590657175f, 0.512050092f},
-std::array<float,2>{0.739487052f, 0.240078107f},
-std::array<float,2>{0.444609404f, 0.69367528f},
-std::array<float,2>{0.041867096f, 0.453955323f},
-std::array<float,2>{0.97620213f, 0.916976511f},
-std::array<float,2>{0.530505657f, 0.287991881f},
-std::array<float,2>{0.269011736f, 0.811829805f},
-std::array<float,2>{0.156210855f, 0.00673961826f},
-std::array<float,2>{0.788696647f, 0.619793355f},
-std::array<float,2>{0.897012889f, 0.148669019f},
-std::array<float,2>{0.066141665f, 0.62551415f},
-std::array<float,2>{0.430114478f, 0.425576508f},
-std::array<float,2>{0.666701019f, 0.97931999f},
-std::array<float,2>{0.856262565f, 0.462147683f},
-std::array<float,2>{0.188910455f, 0.907279372f},
-std::array<float,2>{0.371025652f, 0.245394498f},
-std::array<float,2>{0.617600501f, 0.70034951f},
-std::array<float,2>{0.705384374f, 0.0642225146f},
-std::array<float,2>{0.478684753f, 0.506377161f},
-std::array<float,2>{0.01325469f, 0.329386592f},
-std::array<float,2>{0.95258373f, 0.841087937f},
-std::array<float,2>{0.64336437f, 0.395106018f},
-std::array<float,2>{0.402172983f, 0.93976903f},
-std::array<float,2>{0.121377341f, 0.167160675f},
-std::array<float,2>{0.933170676f, 0.679326057f},
-std::array<float,2>{0.774160981f, 0.0486051813f},
-std::array<float,2>{0.184949413f, 0.588719845f},
-std::array<float,2>{0.293531865f, 0.276445359f},
-std::array<float,2>{0.534189641f, 0.762806177f},
-std::array<float,2>{0.977871478f, 0.373183042f},
-std::array<float,2>{0.0323075652f, 0.855502546f},
-std::array<float,2>{0.449202627f, 0.109355494f},
-std::array<float,2>{0.746036708f, 0.555346429f},
-std::array<float,2>{0.584722698f, 0.211459085f},
-std::array<float,2>{0.340788692f, 0.732354641f},
-std::array<float,2>{0.226173401f, 0.48899591f},
-std::array<float,2>{0.8308779f, 0.893763721f},
-std::array<float,2>{0.733561933f, 0.325865507f},
-std::array<float,2>{0.455369174f, 0.81915617f},
-std::array<float,2>{0.0474620685f, 0.0813035965f},
-std::array<float,2>{0.998631895f, 0.519372046f},
-std::array<float,2>{0.818019032f, 0.226301983f},
-std::array<float,2>{0.240861312f, 0.707512617f},
-std::array<float,2>{0.325498313f, 0.45192802f},
-std::array<float,2>{0.563447416f, 0.925995231f},
-std::array<float,2>{0.916751087f, 0.411088556f},
-std::array<float,2>{0.0987574384f, 0.997995377f},
-std::array<float,2>{0.387798995f, 0.13483189f},
-std::array<float,2>{0.633132339f, 0.642378628f},
-std::array<float,2>{0.554201901f, 0.0268586185f},
-std::array<float,2>{0.29693529f, 0.601421714f},
-std::array<float,2>{0.163267627f, 0.29843992f},
-std::array<float,2>{0.764263153f, 0.791201174f},
-std::array<float,2>{0.60221684f, 0.480370164f},
-std::array<float,2>{0.34934777f, 0.887209475f},
-std::array<float,2>{0.211786941f, 0.197835132f},
-std::array<float,2>{0.862087607f, 0.738310456f},
-std::array<float,2>{0.966264367f, 0.114722826f},
-std::array<float,2>{0.0170037579f, 0.542801261f},
-std::array<float,2>{0.498915166f, 0.34803015f},
-std::array<float,2>{0.695174754f, 0.86496073f},
-std::array<float,2>{0.799547315f, 0.252275288f},
-std::array<float,2>{0.135833934f, 0.768612325f},
-std::array<float,2>{0.263401926f, 0.035195604f},
-std::array<float,2>{0.500763834f, 0.572361648f},
-std::array<float,2>{0.678755879f, 0.184259802f},
-std::array<float,2>{0.412217021f, 0.662241995f},
-std::array<float,2>{0.0807331875f, 0.38025102f},
-std::array<float,2>{0.881459296f, 0.958503246f},
-std::array<float,2>{0.559599519f, 0.335588545f},
-std::array<float,2>{0.307121456f, 0.836886227f},
-std::array<float,2>{0.171851993f, 0.0669066384f},
-std::array<float,2>{0.756587505f, 0.502344191f},
-std::array<float,2>{0.908583641f, 0.24822852f},
-std::array<float,2>{0.101705566f, 0.698979378f},
-std::array<float,2>{0.378231257f, 0.468645483f},
-std::array<float,2>{0.62996465f, 0.913589597f},
-std::array<float,2>{0.827445745f, 0.428928167f},
-std::array<float,2>{0.243170574f, 0.980791867f},
-std::array<float,2>{0.320126265f, 0.153809771f},
-std::array<float,2>{0.575124979f, 0.630330503f},
-std::array<float,2>{0.726252913f, 0.000606613641f},
-std::array<float,2>{0.46604982f, 0.623613894f},
-std::array<float,2>{0.0598216616f, 0.283138752f},
-std::array<float,2>{0.991305053f, 0.807957232f},
-std::array<float,2>{0.686767817f, 0.488156676f},
-std::array<float,2>{0.415976137f, 0.897369802f},
-std::array<float,2>{0.0896056145f, 0.217408597f},
-std::array<float,2>{0.884115756f, 0.728184283f},
-std::array<float,2>{0.80985719f, 0.102770731f},
-std::array<float,2>{0.127521694f, 0.559616804f},
-std::array<float,2>{0.252768368f, 0.36999318f},
-std::array<float,2>{0.515034974f, 0.8541677f},
-std::array<float,2>{0.95810926f, 0.278497815f},
-std::array<float,2>{0.0244179182f, 0.761186421f},
-std::array<float,2>{0.486720502f, 0.0539711751f},
-std::array<float,2>{0.699998021f, 0.592308223f},
-std::array<float,2>{0.597028971f, 0.171543255f},
-std::array<float,2>{0.353161454f, 0.674911082f},
-std::array<float,2>{0.207422942f, 0.393605769f},
-std::array<float,2>{0.86875093f, 0.941560745f},
-std::array<float,2>{0.717336476f, 0.303358704f},
-std::array<float,2>{0.476556182f, 0.794626832f},
-std::array<float,2>{0.00691394322f, 0.0281910878f},
-std::array<float,2>{0.941124618f, 0.596655548f},
-std::array<float,2>{0.844667792f, 0.138859689f},
-std::array<float,2>{0.200023398f, 0.644785941f},
-std::array<float,2>{0.361097693f, 0.40642643f},
-std::array<float,2>{0.611765563f, 0.99227345f},
-std::array<float,2>{0.905317545f, 0.446366906f},
-std::array<float,2>{0.075507991f, 0.924189985f},
-std::array<float,2>{0.427443981f, 0.22000131f},
-std::array<float,2>{0.66389668f, 0.705200374f},
-std::array<float,2>{0.516590655f, 0.0858613998f},
-std::array<float,2>{0.277281702f, 0.521338224f},
-std::array<float,2>{0.147636458f, 0.320687324f},
-std::array<float,2>{0.792366147f, 0.814012527f},
-std::array<float,2>{0.586683869f, 0.376959473f},
-std::array<float,2>{0.332093924f, 0.956277013f},
-std::array<float,2>{0.229309022f, 0.180487216f},
-std::array<float,2>{0.836586118f, 0.658600032f},
-std::array<float,2>{0.970118999f, 0.0348144993f},
-std::array<float,2>{0.0444313064f, 0.57496047f},
-std::array<float,2>{0.438571423f, 0.255446881f},
-std::array<float,2>{0.736431539f, 0.770728052f},
-std::array<float,2>{0.767845809f, 0.346297234f},
-std::array<float,2>{0.174926072f, 0.862036884f},
-std::array<float,2>{0.28833437f, 0.109421015f},
-std::array<float,2>{0.544779539f, 0.545197368f},
-std::array<float,2>{0.648714542f, 0.201952934f},
-std::array<float,2>{0.392083377f, 0.736932755f},
-std::array<float,2>{0.114699036f, 0.480866075f},
-std::array<float,2>{0.922528744f, 0.885452867f},
-std::array<float,2>{0.624329448f, 0.25952968f},
-std::array<float,2>{0.371510088f, 0.776860058f},
-std::array<float,2>{0.19257541f, 0.045912765f},
-std::array<float,2>{0.851579726f, 0.569499016f},
-std::array<float,2>{0.946040154f, 0.176528171f},
-std::array<float,2>{0.00835156813f, 0.671479702f},
-std::array<float,2>{0.481105208f, 0.38909027f},
-std::array<float,2>{0.707909286f, 0.965174019f},
-std::array<float,2>{0.783988237f, 0.472321898f},
-std::array<float,2>{0.150326341f, 0.882707655f},
-std::array<float,2>{0.270219773f, 0.18957907f},
-std::array<float,2>{0.524758756f, 0.748122931f},
-std::array<float,2>{0.670081019f, 0.119974032f},
-std::array<float,2>{0.433997303f, 0.537218273f},
-std::array<float,2>{0.0681648552f, 0.356720865f},
-std::array<float,2>{0.890889108f, 0.868153334f},
-std::array<float,2>{0.746552169f, 0.419197142f},
-std::array<float,2>{0.449369043f, 0.986586452f},
-std::array<float,2>{0.0373748951f, 0.128654018f},
-std::array<float,2>{0.982460678f, 0.650012076f},
-std::array<float,2>{0.835279763f, 0.0156491976f},
-std::array<float,2>{0.220390692f, 0.606930912f},
-std::array<float,2>{0.336184114f, 0.308243304f},
-std::array<float,2>{0.579772294f, 0.781548321f},
-std::array<float,2>{0.936215222f, 0.319460303f},
-std::array<float,2>{0.119719885f, 0.827798307f},
-std::array<float,2>{0.404036134f, 0.0910964385f},
-std::array<float,2>{0.647313237f, 0.524229169f},
-std::array<float,2>{0.537110031f, 0.229483455f},
-std::array<float,2>{0.29172498f, 0.715983868f},
-std::array<float,2>{0.181810826f, 0.443127096f},
-std::array<float,2>{0.777457297f, 0.935309649f},
-std::array<float,2>{0.638760269f, 0.35969013f},
-std::array<float,2>{0.38328737f, 0.846014738f},
-std::array<float,2>{0.0966267735f, 0.0992673337f},
-std::array<float,2>{0.919561744f, 0.549141705f},
-std::array<float,2>{0.761055112f, 0.205555558f},
-std::array<float,2>{0.156474352f, 0.722274065f},
-std::array<float,2>{0.303967685f, 0.498780519f},
-std::array<float,2>{0.548998952f, 0.899376333f},
-std::array<float,2>{0.995078981f, 0.402978987f},
-std::array<float,2>{0.0538662262f, 0.945472896f},
-std::array<float,2>{0.458571166f, 0.157165915f},
-std::array<float,2>{0.729068398f, 0.680362165f},
-std::array<float,2>{0.56903851f, 0.0620032363f},
-std::array<float,2>{0.324152827f, 0.579025745f},
-std::array<float,2>{0.236779943f, 0.267591268f},
-std::array<float,2>{0.814687371f, 0.755082786f},
-std::array<float,2>{0.506980181f, 0.460082591f},
-std::array<float,2>{0.259452671f, 0.921314478f},
-std::array<float,2>{0.140041113f, 0.234778568f},
-std::array<float,2>{0.803859472f, 0.688971102f},
-std::array<float,2>{0.875839591f, 0.0774330124f},
-std::array<float,2>{0.0837473646f, 0.509487987f},
-std::array<float,2>{0.40777427f, 0.341170937f},
-std::array<float,2>{0.673149586f, 0.829883337f},
-std::array<float,2>{0.865483046f, 0.293194592f},
-std::array<float,2>{0.218412027f, 0.802132607f},
-std::array<float,2>{0.346788973f, 0.010707967f},
-std::array<float,2>{0.6076864f, 0.613657176f},
-std::array<float,2>{0.688081145f, 0.14539142f},
-std::array<float,2>{0.496070027f, 0.639167726f},
-std::array<float,2>{0.0221257322f, 0.43289116f},
-std::array<float,2>{0.9637205f, 0.971174419f},
-std::array<float,2>{0.591132581f, 0.338107646f},
-std::array<float,2>{0.329868555f, 0.835922539f},
-std::array<float,2>{0.233985424f, 0.0720989034f},
-std::array<float,2>{0.840659916f, 0.515609741f},
-std::array<float,2>{0.975356698f, 0.240752637f},
-std::array<float,2>{0.0420916341f, 0.692437053f},
-std::array<float,2>{0.443615168f, 0.455819249f},
-std::array<float,2>{0.738848865f, 0.914788604f},
-std::array<float,2>{0.771872878f, 0.435252696f},
-std::array<float,2>{0.179310217f, 0.972800553f},
-std::array<float,2>{0.284599572f, 0.143881038f},
-std::array<float,2>{0.539084494f, 0.633662224f},
-std::array<float,2>{0.655341446f, 0.0141493939f},
-std::array<float,2>{0.39463231f, 0.612220764f},
-std::array<float,2>{0.110321485f, 0.292456508f},
-std::array<float,2>{0.928219318f, 0.797926366f},
-std::array<float,2>{0.712384284f, 0.492412329f},
-std::array<float,2>{0.471137345f, 0.905037463f},
-std::array<float,2>{0.00219648937f, 0.208183929f},
-std::array<float,2>{0.94142592f, 0.725322843f},
-std::array<float,2>{0.849361956f, 0.0971829668f},
-std::array<float,2>{0.19783549f, 0.554371595f},
-std::array<float,2>{0.366821766f, 0.365410537f},
-std::array<float,2>{0.616216958f, 0.84966898f},
-std::array<float,2>{0.900315046f, 0.271787226f},
-std::array<float,2>{0.073567614f, 0.750876963f},
-std::array<float,2>{0.425192386f, 0.0566018932f},
-std::array<float,2>{0.658340931f, 0.583310843f},
-std::array<float,2>{0.523331285f, 0.163048759f},
-std::array<float,2>{0.280306429f, 0.686869383f},
-std::array<float,2>{0.141465172f, 0.401751041f},
-std::array<float,2>{0.793495834f, 0.949596107f},
-std::array<float,2>{0.680927873f, 0.310694039f},
-std::array<float,2>{0.420427591f, 0.788225949f},
-std::array<float,2>{0.0917682275f, 0.0223844256f},
-std::array<float,2>{0.888121843f, 0.602009118f},
-std::array<float,2>{0.806518495f, 0.130944565f},
-std::array<float,2>{0.129859149f, 0.654582798f},
-std::array<float,2>{0.257260352f, 0.415871233f},
-std::array<float,2>{0.508623838f, 0.991409242f},
-std::array<float,2>{0.954994857f, 0.440119147f},
-std::array<float,2>{0.0292591322f, 0.930696368f},
-std::array<float,2>{0.491623819f, 0.231591076f},
-std::array<float,2>{0.696135104f, 0.712008297f},
-std::array<float,2>{0.598900855f, 0.0869979858f},
-std::array<float,2>{0.355766565f, 0.530477464f},
-std::array<float,2>{0.206134558f, 0.312765688f},
-std::array<float,2>{0.874059141f, 0.823492825f},
-std::array<float,2>{0.557605147f, 0.385437936f},
-std::array<float,2>{0.31109494f, 0.962778389f},
-std::array<float,2>{0.164625093f, 0.17391929f},
-std::array<float,2>{0.752711236f, 0.665439129f},
-std::array<float,2>{0.910913944f, 0.0397829637f},
-std::array<float,2>{0.109181575f, 0.565996408f},
-std::array<float,2>{0.38039133f, 0.262779355f},
-std::array<float,2>{0.627994001f, 0.778995395f},
-std::array<float,2>{0.823413491f, 0.355100513f},
-std::array<float,2>{0.249709815f, 0.872696638f},
-std::array<float,2>{0.316012502f, 0.121761695f},
-std::array<float,2>{0.571671546f, 0.532078564f},
-std::array<float,2>{0.720875978f, 0.194224358f},
-std::array<float,2>{0.463375658f, 0.745455205f},
-std::array<float,2>{0.0575948358f, 0.473285854f},
-std::array<float,2>{0.988214374f, 0.876786411f},
-std::array<float,2>{0.50186342f, 0.251382113f},
-std::array<float,2>{0.262082845f, 0.766617358f},
-std::array<float,2>{0.13505435f, 0.0376903415f},
-std::array<float,2>{0.800635815f, 0.570569158f},
-std::array<float,2>{0.882184446f, 0.185998067f},
-std::array<float,2>{0.0811408162f, 0.661628664f},
-std::array<float,2>{0.413624406f, 0.38115263f},
-std::array<float,2>{0.678437591f, 0.959312499f},
-std::array<float,2>{0.862708867f, 0.477245778f},
-std::array<float,2>{0.212379441f, 0.889353633f},
-std::array<float,2>{0.348546594f, 0.196549624f},
-std::array<float,2>{0.603016913f, 0.740405381f},
-std::array<float,2>{0.693811536f, 0.115865104f},
-std::array<float,2>{0.499032021f, 0.540382385f},
-std::array<float,2>{0.0163360424f, 0.350671887f},
-std::array<float,2>{0.965630531f, 0.865358829f},
-std::array<float,2>{0.633896649f, 0.413219392f},
-std::array<float,2>{0.387382805f, 0.998961329f},
-std::array<float,2>{0.0978272408f, 0.133721903f},
-std::array<float,2>{0.917814851f, 0.64259541f},
-std::array<float,2>{0.765075862f, 0.0247645229f},
-std::array<float,2>{0.162850961f, 0.598704994f},
-std::array<float,2>{0.2984519f, 0.299999624f},
-std::array<float,2>{0.553139806f, 0.790060341f},
-std::array<float,2>{0.999651611f, 0.32629478f},
-std::array<float,2>{0.048750937f, 0.817893207f},
-std::array<float,2>{0.456086189f, 0.0791504309f},
-std::array<float,2>{0.733186603f, 0.516737282f},
-std::array<float,2>{0.56407094f, 0.223958537f},
-std::array<float,2>{0.324926496f, 0.710729718f},
-std::array<float,2>{0.241778478f, 0.449749351f},
-std::array<float,2>{0.816712677f, 0.928379655f},
-std::array<float,2>{0.744804859f, 0.371930301f},
-std::array<float,2>{0.447696567f, 0.859253883f},
-std::array<float,2>{0.0319367982f, 0.106292218f},
-std::array<float,2>{0.977371335f, 0.557042003f},
-std::array<float,2>{0.83124423f, 0.213602617f},
-std::array<float,2>{0.224990919f, 0.733454466f},
-std::array<float,2>{0.341201514f, 0.49166128f},
-std::array<float,2>{0.585825861f, 0.890856385f},
-std::array<float,2>{0.931743979f, 0.396508127f},
-std::array<float,2>{0.123012438f, 0.938483894f},
-std::array<float,2>{0.400976121f, 0.164970323f},
-std::array<float,2>{0.644122243f, 0.676762462f},
-std::array<float,2>{0.534125388f, 0.0493380949f},
-std::array<float,2>{0.294100076f, 0.586254954f},
-std::array<float,2>{0.184308708f, 0.275163621f},
-std::array<float,2>{0.775062323f, 0.764533162f},
-std::array<float,2>{0.618611395f, 0.463196725f},
-std::array<float,2>{0.369310319f, 0.909787476f},
-std::array<float,2>{0.188117594f, 0.243511096f},
-std::array<float,2>{0.85680896f, 0.701674819f},
-std::array<float,2>{0.951357663f, 0.0647677854f},
-std::array<float,2>{0.0124091385f, 0.50393337f},
-std::array<float,2>{0.4796727f, 0.331719548f},
-std::array<float,2>{0.706188977f, 0.842105806f},
-std::array<float,2>{0.787827194f, 0.286616802f},
-std::array<float,2>{0.154958993f, 0.809022725f},
-std::array<float,2>{0.26766476f, 0.00513381837f},
-std::array<float,2>{0.529602706f, 0.617203832f},
-std::array<float,2>{0.667806625f, 0.151504442f},
-std::array<float,2>{0.431610703f, 0.628423691f},
-std::array<float,2>{0.0645986572f, 0.422065616f},
-std::array<float,2>{0.898422956f, 0.976737857f},
-std::array<float,2>{0.543037832f, 0.345159262f},
-std::array<float,2>{0.287445039f, 0.859908998f},
-std::array<float,2>{0.173997462f, 0.111706428f},
-std::array<float,2>{0.768918514f, 0.544740379f},
-std::array<float,2>{0.923116744f, 0.200793177f},
-std::array<float,2>{0.113375783f, 0.73452884f},
-std::array<float,2>{0.390990913f, 0.483317316f},
-std::array<float,2>{0.649598002f, 0.883974552f},
-std::array<float,2>{0.837645829f, 0.375193685f},
-std::array<float,2>{0.229834735f, 0.954288542f},
-std::array<float,2>{0.333797455f, 0.182720602f},
-std::array<float,2>{0.587880075f, 0.656554222f},
-std::array<float,2>{0.737554312f, 0.0313186646f},
-std::array<float,2>{0.437587708f, 0.577980518f},
-std::array<float,2>{0.0433338173f, 0.256405771f},
-std::array<float,2>{0.968942761f, 0.772347629f},
-std::array<float,2>{0.66270113f, 0.447939277f},
-std::array<float,2>{0.42604515f, 0.923743308f},
-std::array<float,2>{0.0743667632f, 0.221547157f},
-std::array<float,2>{0.904974043f, 0.703271508f},
-std::array<float,2>{0.791513741f, 0.0838445723f},
-std::array<float,2>{0.146597758f, 0.522440493f},
-std::array<float,2>{0.276315987f, 0.322561711f},
-std::array<float,2>{0.516894341f, 0.816302538f},
-std::array<float,2>{0.939643562f, 0.301827908f},
-std::array<float,2>{0.00682828669f, 0.7962659f},
-std::array<float,2>{0.475161463f, 0.0304909032f},
-std::array<float,2>{0.717937827f, 0.593785524f},
-std::array<float,2>{0.612551689f, 0.137623712f},
-std::array<float,2>{0.360146135f, 0.647597194f},
-std::array<float,2>{0.200553656f, 0.41001752f},
-std::array<float,2>{0.844884932f, 0.995258212f},
-std::array<float,2>{0.700683117f, 0.28072083f},
-std::array<float,2>{0.487366378f, 0.758799493f},
-std::array<float,2>{0.0238314327f, 0.0521488115f},
-std::array<float,2>{0.957857668f, 0.591372907f},
-std::array<float,2>{0.8678388f, 0.169437408f},
-std::array<float,2>{0.208480075f, 0.672953606f},
-std::array<float,2>{0.352312475f, 0.390802711f},
-std::array<float,2>{0.596000135f, 0.944292963f},
-std::array<float,2>{0.883670211f, 0.485612661f},
-std::array<float,2>{0.0879101455f, 0.895753801f},
-std::array<float,2>{0.414346069f, 0.214935794f},
-std::array<float,2>{0.686070502f, 0.728910506f},
-std::array<float,2>{0.513903677f, 0.105370492f},
-std::array<float,2>{0.253642857f, 0.561360717f},
-std::array<float,2>{0.12882261f, 0.368466288f},
-std::array<float,2>{0.809226394f, 0.853122115f},
-std::array<float,2>{0.575671911f, 0.42598322f},
-std::array<float,2>{0.318725556f, 0.983453751f},
-std::array<float,2>{0.24303478f, 0.155257434f},
-std::array<float,2>{0.826507032f, 0.632476926f},
-std::array<float,2>{0.991063237f, 0.00337084429f},
-std::array<float,2>{0.0587503761f, 0.62177968f},
-std::array<float,2>{0.465271741f, 0.283910215f},
-std::array<float,2>{0.725211442f, 0.805318415f},
-std::array<float,2>{0.757300019f, 0.333244503f},
-std::array<float,2>{0.170892149f, 0.839755774f},
-std::array<float,2>{0.307671547f, 0.0692728385f},
-std::array<float,2>{0.559553385f, 0.501097083f},
-std::array<float,2>{0.629037201f, 0.246527314f},
-std::array<float,2>{0.377534181f, 0.697235644f},
-std::array<float,2>{0.102820925f, 0.466102719f},
-std::array<float,2>{0.910022616f, 0.911043108f},
-std::array<float,2>{0.608917058f, 0.296429962f},
-std::array<float,2>{0.34588024f, 0.80426389f},
-std::array<float,2>{0.217030898f, 0.00905166753f},
-std::array<float,2>{0.866722822f, 0.615533829f},
-std::array<float,2>{0.96395421f, 0.147592023f},
-std::array<float,2>{0.0230957083f, 0.637522697f},
-std::array<float,2>{0.49482587f, 0.430182338f},
-std::array<float,2>{0.688528717f, 0.970437646f},
-std::array<float,2>{0.802769423f, 0.458907276f},
-std::array<float,2>{0.138852403f, 0.919614434f},
-std::array<float,2>{0.258160681f, 0.237827912f},
-std::array<float,2>{0.506465971f, 0.691249967f},
-std::array<float,2>{0.672842443f, 0.0747540295f},
-std::array<float,2>{0.406748503f, 0.511352241f},
-std::array<float,2>{0.0822818726f, 0.34341079f},
-std::array<float,2>{0.876753271f, 0.831621051f},
-std::array<float,2>{0.729544103f, 0.405171335f},
-std::array<float,2>{0.45771578f, 0.947430253f},
-std::array<float,2>{0.0535063185f, 0.158284009f},
-std::array<float,2>{0.995127499f, 0.681999505f},
-std::array<float,2>{0.815971076f, 0.0602787249f},
-std::array<float,2>{0.237905845f, 0.581104875f},
-std::array<float,2>{0.322365612f, 0.266075462f},
-std::array<float,2>{0.5699628f, 0.757543325f},
-std::array<float,2>{0.918016374f, 0.3629843f},
-std::array<float,2>{0.0974489078f, 0.84394294f},
-std::array<float,2>{0.384551853f, 0.100806467f},
-std::array<float,2>{0.640093267f, 0.546911001f},
-std::array<float,2>{0.550096929f, 0.204133883f},
-std::array<float,2>{0.303603172f, 0.719779968f},
-std::array<float,2>{0.158134714f, 0.497863531f},
-std::array<float,2>{0.760720611f, 0.900493443f},
-std::array<float,2>{0.647798121f, 0.316972166f},
-std::array<float,2>{0.402886212f, 0.824956238f},
-std::array<float,2>{0.120772086f, 0.0922976956f},
-std::array<float,2>{0.937049448f, 0.525532782f},
-std::array<float,2>{0.778432131f, 0.227290034f},
-std::array<float,2>{0.183017656f, 0.716918588f},
-std::array<float,2>{0.292907387f, 0.443409652f},
-std::array<float,2>{0.538513482f, 0.937460065f},
-std::array<float,2>{0.984166265f, 0.42093721f},
-std::array<float,2>{0.0387784615f, 0.984983027f},
-std::array<float,2>{0.450785965f, 0.125934854f},
-std::array<float,2>{0.74758172f, 0.65230608f},
-std::array<float,2>{0.57897675f, 0.0193957556f},
-std::array<float,2>{0.337635607f, 0.609000742f},
-std::array<float,2>{0.219190836f, 0.304712713f},
-std::array<float,2>{0.83447212f, 0.783701777f},
-std::array<float,2>{0.523908436f, 0.469272166f},
-std::array<float,2>{0.271252364f, 0.879722476f},
-std::array<float,2>{0.149413645f, 0.188889742f},
-std::array<float,2>{0.784565032f, 0.746402383f},
-std::array<float,2>{0.891745389f, 0.117884025f},
-std::array<float,2>{0.066897288f, 0.535591424f},
-std::array<float,2>{0.434691012f, 0.357622117f},
-std::array<float,2>{0.671461761f, 0.869458735f},
-std::array<float,2>{0.853448808f, 0.259897262f},
-std::array<float,2>{0.19197233f, 0.775060475f},
-std::array<float,2>{0.372848898f, 0.0442460999f},
-std::array<float,2>{0.623413563f, 0.56818974f},
-std::array<float,2>{0.708245397f, 0.178816393f},
-std::array<float,2>{0.481819302f, 0.668415308f},
-std::array<float,2>{0.00927265547f, 0.387093484f},
-std::array<float,2>{0.947141767f, 0.968209386f},
-std::array<float,2>{0.614667773f, 0.364952713f},
-std::array<float,2>{0.36384207f, 0.848596215f},
-std::array<float,2>{0.195627213f, 0.0950779989f},
-std::array<float,2>{0.850716591f, 0.552014828f},
-std::array<float,2>{0.94357264f, 0.209872186f},
-std::array<float,2>{0.00188902195f, 0.723452449f},
-std::array<float,2>{0.469652951f, 0.494440585f},
-std::array<float,2>{0.712936878f, 0.903794169f},
-std::array<float,2>{0.796478212f, 0.399914563f},
-std::array<float,2>{0.14311783f, 0.952685177f},
-std::array<float,2>{0.278831333f, 0.161903888f},
-std::array<float,2>{0.521062434f, 0.683695793f},
-std::array<float,2>{0.657943368f, 0.0583349913f},
-std::array<float,2>{0.422936887f, 0.585058451f},
-std::array<float,2>{0.071409151f, 0.26954776f},
-std::array<float,2>{0.900834024f, 0.753128886f},
-std::array<float,2>{0.741398871f, 0.45503062f},
-std::array<float,2>{0.442445099f, 0.917381883f},
-std::array<float,2>{0.0407337248f, 0.238486782f},
-std::array<float,2>{0.974316776f, 0.694752753f},
-std::array<float,2>{0.842617333f, 0.0738832131f},
-std::array<float,2>{0.230537623f, 0.513072431f},
-std::array<float,2>{0.330897719f, 0.337747633f},
-std::array<float,2>{0.593453407f, 0.832181871f},
-std::array<float,2>{0.927071989f, 0.289231956f},
-std::array<float,2>{0.111966252f, 0.800614774f},
-std::array<float,2>{0.396982074f, 0.0130315721f},
-std::array<float,2>{0.6527161f, 0.61018151f},
-std::array<float,2>{0.541672945f, 0.141592398f},
-std::array<float,2>{0.281817645f, 0.634868681f},
-std::array<float,2>{0.176015884f, 0.43607983f},
-std::array<float,2>{0.769967973f, 0.974755824f},
-std::array<float,2>{0.626676023f, 0.264246911f},
-std::array<float,2>{0.382072866f, 0.781156659f},
-std::array<float,2>{0.105733179f, 0.0423603095f},
-std::array<float,2>{0.913145006f, 0.563776553f},
-std::array<float,2>{0.750802457f, 0.172515556f},
-std::array<float,2>{0.166413158f, 0.667704701f},
-std::array<float,2>{0.309432328f, 0.384218633f},
-std::array<float,2>{0.555474162f, 0.964095652f},
-std::array<float,2>{0.985515118f, 0.476154298f},
-std::array<float,2>{0.05559301f, 0.878749728f},
-std::array<float,2>{0.462241203f, 0.191647112f},
-std::array<float,2>{0.719552755f, 0.743212581f},
-std::array<float,2>{0.573212326f, 0.123712212f},
-std::array<float,2>{0.313692987f, 0.534113169f},
-std::array<float,2>{0.247673064f, 0.352024496f},
-std::array<float,2>{0.820373654f, 0.87429291f},
-std::array<float,2>{0.509860337f, 0.416740447f},
-std::array<float,2>{0.255137235f, 0.988726377f},
-std::array<float,2>{0.131279603f, 0.130624563f},
-std::array<float,2>{0.808185041f, 0.652957797f},
-std::array<float,2>{0.88940531f, 0.0202184096f},
-std::array<float,2>{0.0924503952f, 0.605157971f},
-std::array<float,2>{0.419787943f, 0.31034407f},
-std::array<float,2>{0.681689084f, 0.785964251f},
-std::array<float,2>{0.871631384f, 0.315296918f},
-std::array<float,2>{0.204355419f, 0.821627021f},
-std::array<float,2>{0.357711196f, 0.0896527395f},
-std::array<float,2>{0.600442231f, 0.52788043f},
-std::array<float,2>{0.699101686f, 0.23436825f},
-std::array<float,2>{0.489282608f, 0.713009238f},
-std::array<float,2>{0.0294423867f, 0.438778102f},
-std::array<float,2>{0.955602348f, 0.932397842f},
-std::array<float,2>{0.552256525f, 0.297793657f},
-std::array<float,2>{0.299966127f, 0.792476058f},
-std::array<float,2>{0.161638364f, 0.0259866733f},
-std::array<float,2>{0.763481736f, 0.599643946f},
-std::array<float,2>{0.914125443f, 0.136011794f},
-std::array<float,2>{0.101485282f, 0.640628695f},
-std::array<float,2>{0.390453756f, 0.411175638f},
-std::array<float,2>{0.635978878f, 0.99691844f},
-std::array<float,2>{0.819662631f, 0.45243904f},
-std::array<float,2>{0.238781393f, 0.927374542f},
-std::array<float,2>{0.326366782f, 0.225500867f},
-std::array<float,2>{0.565421045f, 0.708468139f},
-std::array<float,2>{0.731122613f, 0.0805984288f},
-std::array<float,2>{0.453914344f, 0.51777488f},
-std::array<float,2>{0.0494525582f, 0.324598104f},
-std::array<float,2>{0.996548891f, 0.820114851f},
-std::array<float,2>{0.675863802f, 0.379376978f},
-std::array<float,2>{0.411646634f, 0.957516789f},
-std::array<float,2>{0.0784830675f, 0.185271293f},
-std::array<float,2>{0.880433619f, 0.663312852f},
-std::array<float,2>{0.798538208f, 0.0369038433f},
-std::array<float,2>{0.134591669f, 0.573776007f},
-std::array<float,2>{0.265439898f, 0.253623873f},
-std::array<float,2>{0.503744304f, 0.768467009f},
-std::array<float,2>{0.968430161f, 0.349212289f},
-std::array<float,2>{0.0183592532f, 0.864096403f},
-std::array<float,2>{0.496235967f, 0.113794327f},
-std::array<float,2>{0.69176662f, 0.541609049f},
-std::array<float,2>{0.604466915f, 0.199141726f},
-std::array<float,2>{0.349976957f, 0.739808917f},
-std::array<float,2>{0.213783309f, 0.479047745f},
-std::array<float,2>{0.860150516f, 0.887925446f},
-std::array<float,2>{0.703428745f, 0.328902483f},
-std::array<float,2>{0.476703346f, 0.84027344f},
-std::array<float,2>{0.0140801929f, 0.0626654252f},
-std::array<float,2>{0.949745715f, 0.507536054f},
-std::array<float,2>{0.859247208f, 0.244331136f},
-std::array<float,2>{0.190980896f, 0.700032294f},
-std::array<float,2>{0.367438972f, 0.461136788f},
-std::array<float,2>{0.619798839f, 0.907046974f},
-std::array<float,2>{0.894604981f, 0.423999846f},
-std::array<float,2>{0.0639153495f, 0.98001802f},
-std::array<float,2>{0.432620704f, 0.150307983f},
-std::array<float,2>{0.664475501f, 0.626099408f},
-std::array<float,2>{0.527519703f, 0.00723943952f},
-std::array<float,2>{0.266349941f, 0.620239854f},
-std::array<float,2>{0.152801141f, 0.288429379f},
-std::array<float,2>{0.785265326f, 0.81111896f},
-std::array<float,2>{0.583052158f, 0.489489734f},
-std::array<float,2>{0.343749315f, 0.892714858f},
-std::array<float,2>{0.223575696f, 0.212284058f},
-std::array<float,2>{0.828672469f, 0.730802596f},
-std::array<float,2>{0.980179727f, 0.108038999f},
-std::array<float,2>{0.0344100893f, 0.556630492f},
-std::array<float,2>{0.446452111f, 0.374978483f},
-std::array<float,2>{0.743409336f, 0.8568483f},
-std::array<float,2>{0.776537001f, 0.275932491f},
-std::array<float,2>{0.186512649f, 0.762417316f},
-std::array<float,2>{0.296182483f, 0.0473468415f},
-std::array<float,2>{0.531663716f, 0.589372396f},
-std::array<float,2>{0.641611874f, 0.166511089f},
-std::array<float,2>{0.399026632f, 0.678625703f},
-std::array<float,2>{0.123316482f, 0.395938456f},
-std::array<float,2>{0.930692792f, 0.940827072f},
-std::array<float,2>{0.517716229f, 0.322003961f},
-std::array<float,2>{0.275255442f, 0.812507689f},
-std::array<float,2>{0.144938335f, 0.0840907395f},
-std::array<float,2>{0.789775848f, 0.520187676f},
-std::array<float,2>{0.902772129f, 0.219549164f},
-std::array<float,2>{0.0778935999f, 0.706605971f},
-std::array<float,2>{0.429089397f, 0.445623696f},
-std::array<float,2>{0.661195278f, 0.924894154f},
-std::array<float,2>{0.847384572f, 0.407458961f},
-std::array<float,2>{0.202996746f, 0.994051158f},
-std::array<float,2>{0.362890095f, 0.140506133f},
-std::array<float,2>{0.609512329f, 0.646042883f},
-std::array<float,2>{0.715535283f, 0.0288105607f},
-std::array<float,2>{0.474066734f, 0.597273707f},
-std::array<float,2>{0.00499093207f, 0.303843528f},
-std::array<float,2>{0.937760353f, 0.793182433f},
-std::array<float,2>{0.650620282f, 0.482415587f},
-std::array<float,2>{0.393054038f, 0.886465549f},
-std::array<float,2>{0.115874678f, 0.202166155f},
-std::array<float,2>{0.924996197f, 0.738128424f},
-std::array<float,2>{0.766950786f, 0.110894375f},
-std::array<float,2>{0.173100695f, 0.546562791f},
-std::array<float,2>{0.286510408f, 0.347383887f},
-std::array<float,2>{0.546797276f, 0.863276005f},
-std::array<float,2>{0.971883535f, 0.254599482f},
-std::array<float,2>{0.0454208367f, 0.769958079f},
-std::array<float,2>{0.440352499f, 0.0332861207f},
-std::array<float,2>{0.735947847f, 0.576021731f},
-std::array<float,2>{0.587942958f, 0.18156676f},
-std::array<float,2>{0.334314048f, 0.659519136f},
-std::array<float,2>{0.227741912f, 0.378381848f},
-std::array<float,2>{0.838781953f, 0.955328584f},
-std::array<float,2>{0.723955154f, 0.281789452f},
-std::array<float,2>{0.467682511f, 0.806774318f},
-std::array<float,2>{0.0624786504f, 0.00143014593f},
-std::array<float,2>{0.989280462f, 0.624209464f},
-std::array<float,2>{0.825550377f, 0.152895719f},
-std::array<float,2>{0.244928658f, 0.629288435f},
-std::array<float,2>{0.316551447f, 0.428084493f},
-std::array<float,2>{0.577857792f, 0.982072771f},
-std::array<float,2>{0.906520844f, 0.46777302f},
-std::array<float,2>{0.103861988f, 0.912204564f},
-std::array<float,2>{0.37623328f, 0.249846891f},
-std::array<float,2>{0.631495535f, 0.697991192f},
-std::array<float,2>{0.562094867f, 0.0681266561f},
-std::array<float,2>{0.306339115f, 0.502971828f},
-std::array<float,2>{0.169603378f, 0.334147274f},
-std::array<float,2>{0.755725741f, 0.837863982f},
-std::array<float,2>{0.59442836f, 0.393277764f},
-std::array<float,2>{0.354399264f, 0.943191946f},
-std::array<float,2>{0.21049884f, 0.170464799f},
-std::array<float,2>{0.870832682f, 0.674442947f},
-std::array<float,2>{0.959510207f, 0.0530342758f},
-std::array<float,2>{0.0267825704f, 0.593562543f},
-std::array<float,2>{0.485249579f, 0.277381212f},
-std::array<float,2>{0.702133894f, 0.760480583f},
-std::array<float,2>{0.812107265f, 0.370575011f},
-std::array<float,2>{0.125212878f, 0.855002761f},
-std::array<float,2>{0.251721382f, 0.102147639f},
-std::array<float,2>{0.512131751f, 0.558885872f},
-std::array<float,2>{0.684800446f, 0.218397051f},
-std::array<float,2>{0.417795926f, 0.727153182f},
-std::array<float,2>{0.0859727934f, 0.486622512f},
-std::array<float,2>{0.88592875f, 0.897656441f},
-std::array<float,2>{0.567506552f, 0.268640429f},
-std::array<float,2>{0.322161555f, 0.754101157f},
-std::array<float,2>{0.234717295f, 0.0607565343f},
-std::array<float,2>{0.81350559f, 0.579110384f},
-std::array<float,2>{0.99291724f, 0.157778457f},
-std::array<float,2>{0.0525838546f, 0.681237698f},
-std::array<float,2>{0.460136145f, 0.403520346f},
-std::array<float,2>{0.728325188f, 0.947031438f},
-std::array<float,2>{0.75804925f, 0.499041915f},
-std::array<float,2>{0.15909043f, 0.899580181f},
-std::array<float,2>{0.302417904f, 0.206968442f},
-std::array<float,2>{0.547476888f, 0.721476018f},
-std::array<float,2>{0.637537301f, 0.0977034941f},
-std::array<float,2>{0.385785788f, 0.550402641f},
-std::array<float,2>{0.0937898681f, 0.360920995f},
-std::array<float,2>{0.919953644f, 0.846990764f},
-std::array<float,2>{0.689918637f, 0.432417512f},
-std::array<float,2>{0.492906392f, 0.971898675f},
-std::array<float,2>{0.0201861598f, 0.146435469f},
-std::array<float,2>{0.961027384f, 0.64019841f},
-std::array<float,2>{0.864597201f, 0.0108022103f},
-std::array<float,2>{0.21528624f, 0.6145432f},
-std::array<float,2>{0.344749182f, 0.294099927f},
-std::array<float,2>{0.60576427f, 0.801026881f},
-std::array<float,2>{0.877027631f, 0.340356439f},
-std::array<float,2>{0.0850279033f, 0.828883827f},
-std::array<float,2>{0.409680635f, 0.0769538656f},
-std::array<float,2>{0.674385965f, 0.50836122f},
-std::array<float,2>{0.504929662f, 0.235781923f},
-std::array<float,2>{0.261255264f, 0.688121915f},
-std::array<float,2>{0.137159094f, 0.459352732f},
-std::array<float,2>{0.800960124f, 0.920835435f},
-std::array<float,2>{0.668768227f, 0.35579294f},
-std::array<float,2>{0.437019467f, 0.868501127f},
-std::array<float,2>{0.0684163794f, 0.120780252f},
-std::array<float,2>{0.894527912f, 0.538942754f},
-std::array<float,2>{0.781714261f, 0.191352382f},
-std::array<float,2>{0.151380315f, 0.749168932f},
-std::array<float,2>{0.272096902f, 0.471638918f},
-std::array<float,2>{0.52721554f, 0.881527424f},
-std::array<float,2>{0.947672486f, 0.390198439f},
-std::array<float,2>{0.0106740762f, 0.966019511f},
-std::array<float,2>{0.483754575f, 0.176908776f},
-std::array<float,2>{0.710724711f, 0.670347571f},
-std::array<float,2>{0.622191191f, 0.0456005931f},
-std::array<float,2>{0.373680949f, 0.569094777f},
-std::array<float,2>{0.193829685f, 0.258077502f},
-std::array<float,2>{0.854370773f, 0.775952101f},
-std::array<float,2>{0.537076473f, 0.441763759f},
-std::array<float,2>{0.289392084f, 0.933715045f},
-std::array<float,2>{0.179886505f, 0.229597598f},
-std::array<float,2>{0.779335439f, 0.715282142f},
-std::array<float,2>{0.934462845f, 0.089891389f},
-std::array<float,2>{0.118851483f, 0.525318921f},
-std::array<float,2>{0.405486852f, 0.319078177f},
-std::array<float,2>{0.644835055f, 0.826266468f},
-std::array<float,2>{0.832426608f, 0.307119399f},
-std::array<float,2>{0.222386226f, 0.782669604f},
-std::array<float,2>{0.339653224f, 0.0171770547f},
-std::array<float,2>{0.580735445f, 0.606318116f},
-std::array<float,2>{0.749115884f, 0.127895266f},
-std::array<float,2>{0.451686352f, 0.649229169f},
-std::array<float,2>{0.035626594f, 0.418335408f},
-std::array<float,2>{0.982331455f, 0.987981141f},
-std::array<float,2>{0.606533706f, 0.343534738f},
-std::array<float,2>{0.344139487f, 0.831962049f},
-std::array<float,2>{0.216399506f, 0.0750373006f},
-std::array<float,2>{0.863923728f, 0.511497021f},
-std::array<float,2>{0.961965859f, 0.238056928f},
-std::array<float,2>{0.0207073763f, 0.691151381f},
-std::array<float,2>{0.493861616f, 0.458656669f},
-std::array<float,2>{0.691182554f, 0.919783354f},
-std::array<float,2>{0.802131891f, 0.430619001f},
-std::array<float,2>{0.138419703f, 0.970703125f},
-std::array<float,2>{0.260538012f, 0.147936463f},
-std::array<float,2>{0.504250646f, 0.637387872f},
-std::array<float,2>{0.675437391f, 0.00895429403f},
-std::array<float,2>{0.408427745f, 0.615392506f},
-std::array<float,2>{0.0843881667f, 0.296840042f},
-std::array<float,2>{0.878831446f, 0.804556072f},
-std::array<float,2>{0.727174282f, 0.497575015f},
-std::array<float,2>{0.459255189f, 0.900725901f},
-std::array<float,2>{0.0514619499f, 0.204405755f},
-std::array<float,2>{0.99369812f, 0.719997585f},
-std::array<float,2>{0.813172102f, 0.101050183f},
-std::array<float,2>{0.235913679f, 0.54733026f},
-std::array<float,2>{0.320523202f, 0.363227129f},
-std::array<float,2>{0.567147315f, 0.844110847f},
-std::array<float,2>{0.92112118f, 0.265666336f},
-std::array<float,2>{0.0952044502f, 0.757716954f},
-std::array<float,2>{0.384853065f, 0.0604731813f},
-std::array<float,2>{0.637898266f, 0.581479013f},
-std::array<float,2>{0.548463702f, 0.158557877f},
-std::array<float,2>{0.301107436f, 0.681804717f},
-std::array<float,2>{0.159244582f, 0.404803783f},
-std::array<float,2>{0.759447157f, 0.94764775f},
-std::array<float,2>{0.645850837f, 0.30505684f},
-std::array<float,2>{0.40520525f, 0.784150362f},
-std::array<float,2>{0.117350459f, 0.0191214811f},
-std::array<float,2>{0.934726834f, 0.609308958f},
-std::array<float,2>{0.780734181f, 0.125542f},
-std::array<float,2>{0.181294426f, 0.651871204f},
-std::array<float,2>{0.290988356f, 0.421336859f},
-std::array<float,2>{0.535232246f, 0.985348821f},
-std::array<float,2>{0.980561435f, 0.44378522f},
-std::array<float,2>{0.0362133868f, 0.937079251f},
-std::array<float,2>{0.453045219f, 0.227434039f},
-std::array<float,2>{0.748333633f, 0.717125177f},
-std::array<float,2>{0.581760883f, 0.092764847f},
-std::array<float,2>{0.338736832f, 0.525806725f},
-std::array<float,2>{0.221336931f, 0.317146778f},
-std::array<float,2>{0.833786607f, 0.824802339f},
-std::array<float,2>{0.526208639f, 0.38684696f},
-std::array<float,2>{0.272582561f, 0.967846453f},
-std::array<float,2>{0.150743216f, 0.179099113f},
-std::array<float,2>{0.782918692f, 0.66813463f},
-std::array<float,2>{0.892873406f, 0.0440225489f},
-std::array<float,2>{0.0693874508f, 0.567923009f},
-std::array<float,2>{0.436337024f, 0.260133445f},
-std::array<float,2>{0.669256151f, 0.775182486f},
-std::array<float,2>{0.854518652f, 0.357696563f},
-std::array<float,2>{0.195293725f, 0.869360507f},
-std::array<float,2>{0.374167413f, 0.117938168f},
-std::array<float,2>{0.62117821f, 0.535353422f},
-std::array<float,2>{0.70989871f, 0.188649431f},
-std::array<float,2>{0.482901961f, 0.746102214f},
-std::array<float,2>{0.0112568242f, 0.469517678f},
-std::array<float,2>{0.948963284f, 0.879575372f},
-std::array<float,2>{0.545743525f, 0.256728977f},
-std::array<float,2>{0.285467267f, 0.772003293f},
-std::array<float,2>{0.172520801f, 0.0316734686f},
-std::array<float,2>{0.766321421f, 0.577873409f},
-std::array<float,2>{0.924565792f, 0.182888478f},
-std::array<float,2>{0.117021888f, 0.656442285f},
-std::array<float,2>{0.394173771f, 0.375459492f},
-std::array<float,2>{0.651588142f, 0.954544842f},
-std::array<float,2>{0.839514673f, 0.482977182f},
-std::array<float,2>{0.227394298f, 0.884229064f},
-std::array<float,2>{0.335453957f, 0.200997278f},
-std::array<float,2>{0.58893019f, 0.734672129f},
-std::array<float,2>{0.734428644f, 0.111349113f},
-std::array<float,2>{0.440438777f, 0.544472277f},
-std::array<float,2>{0.0461365171f, 0.344891578f},
-std::array<float,2>{0.971405506f, 0.860317767f},
-std::array<float,2>{0.660700798f, 0.409711331f},
-std::array<float,2>{0.428386569f, 0.995531738f},
-std::array<float,2>{0.0763243213f, 0.137329474f},
-std::array<float,2>{0.903356671f, 0.647767484f},
-std::array<float,2>{0.790515602f, 0.0306905825f},
-std::array<float,2>{0.145596862f, 0.594094634f},
-std::array<float,2>{0.273865551f, 0.302125603f},
-std::array<float,2>{0.519314647f, 0.795915723f},
-std::array<float,2>{0.939449787f, 0.322370112f},
-std::array<float,2>{0.00444964599f, 0.816019237f},
-std::array<float,2>{0.473356426f, 0.0836634114f},
-std::array<float,2>{0.716440141f, 0.522210896f},
-std::array<float,2>{0.610837281f, 0.221386299f},
-std::array<float,2>{0.361652941f, 0.703382432f},
-std::array<float,2>{0.201962814f, 0.448080361f},
-std::array<float,2>{0.846054554f, 0.923492789f},
-std::array<float,2>{0.702452838f, 0.36825645f},
-std::array<float,2>{0.485411197f, 0.853342772f},
-std::array<float,2>{0.0260152705f, 0.105010971f},
-std::array<float,2>{0.960458815f, 0.56112802f},
-std::array<float,2>{0.869627893f, 0.215117007f},
-std::array<float,2>{0.209040821f, 0.728650272f},
-std::array<float,2>{0.354760557f, 0.485500216f},
-std::array<float,2>{0.59473449f, 0.895511866f},
-std::array<float,2>{0.885390818f, 0.391109169f},
-std::array<float,2>{0.0869998112f, 0.94390291f},
-std::array<float,2>{0.416620135f, 0.169731811f},
-std::array<float,2>{0.68435955f, 0.673203707f},
-std::array<float,2>{0.513579607f, 0.0518804379f},
-std::array<float,2>{0.250071645f, 0.59158814f},
-std::array<float,2>{0.126940519f, 0.280283093f},
-std::array<float,2>{0.81104964f, 0.759263217f},
-std::array<float,2>{0.576687813f, 0.466043919f},
-std::array<float,2>{0.317649126f, 0.910790563f},
-std::array<float,2>{0.245411903f, 0.246316358f},
-std::array<float,2>{0.824596167f, 0.696864843f},
-std::array<float,2>{0.988342106f, 0.0690084174f},
-std::array<float,2>{0.0611147806f, 0.501413763f},
-std::array<float,2>{0.468434423f, 0.333462089f},
-std::array<float,2>{0.723352194f, 0.839562297f},
-std::array<float,2>{0.754410326f, 0.283975303f},
-std::array<float,2>{0.168340892f, 0.805621803f},
-std::array<float,2>{0.305288881f, 0.00303030782f},
-std::array<float,2>{0.560710907f, 0.621978164f},
-std::array<float,2>{0.632489383f, 0.155017406f},
-std::array<float,2>{0.375656456f, 0.632576168f},
-std::array<float,2>{0.104574271f, 0.426164865f},
-std::array<float,2>{0.907942653f, 0.983885407f},
-std::array<float,2>{0.502380967f, 0.350938201f},
-std::array<float,2>{0.26395759f, 0.865641654f},
-std::array<float,2>{0.133096129f, 0.116194144f},
-std::array<float,2>{0.797707975f, 0.540198267f},
-std::array<float,2>{0.87976259f, 0.196420118f},
-std::array<float,2>{0.079964295f, 0.740500927f},
-std::array<float,2>{0.410220772f, 0.477295309f},
-std::array<float,2>{0.677699685f, 0.889546454f},
-std::array<float,2>{0.861200094f, 0.380998433f},
-std::array<float,2>{0.214677259f, 0.95919925f},
-std::array<float,2>{0.350780547f, 0.185656145f},
-std::array<float,2>{0.605356574f, 0.661872864f},
-std::array<float,2>{0.693353593f, 0.0378891826f},
-std::array<float,2>{0.497700751f, 0.570367157f},
-std::array<float,2>{0.0187462438f, 0.251000464f},
-std::array<float,2>{0.967371404f, 0.766893744f},
-std::array<float,2>{0.63491118f, 0.450131655f},
-std::array<float,2>{0.389338374f, 0.928611279f},
-std::array<float,2>{0.0997621343f, 0.223701641f},
-std::array<float,2>{0.915932059f, 0.710647166f},
-std::array<float,2>{0.76193589f, 0.079388842f},
-std::array<float,2>{0.160752147f, 0.517039657f},
-std::array<float,2>{0.299567461f, 0.326569557f},
-std::array<float,2>{0.551180422f, 0.818179607f},
-std::array<float,2>{0.997297645f, 0.300189376f},
-std::array<float,2>{0.0506087057f, 0.790293813f},
-std::array<float,2>{0.454690307f, 0.0244768243f},
-std::array<float,2>{0.732116282f, 0.598927498f},
-std::array<float,2>{0.565660357f, 0.133459419f},
-std::array<float,2>{0.327427328f, 0.643009424f},
-std::array<float,2>{0.239985734f, 0.413423955f},
-std::array<float,2>{0.818981469f, 0.998717427f},
-std::array<float,2>{0.742546558f, 0.275024235f},
-std::array<float,2>{0.44532755f, 0.7641626f},
-std::array<float,2>{0.0341034345f, 0.0496017821f},
-std::array<float,2>{0.979433358f, 0.586058497f},
-std::array<float,2>{0.829959691f, 0.164783254f},
-std::array<float,2>{0.223981977f, 0.677196383f},
-std::array<float,2>{0.342049599f, 0.396796346f},
-std::array<float,2>{0.5826087f, 0.938753009f},
-std::array<float,2>{0.930548072f, 0.4913688f},
-std::array<float,2>{0.124207087f, 0.89101249f},
-std::array<float,2>{0.399873674f, 0.21369946f},
-std::array<float,2>{0.640880823f, 0.733664215f},
-std::array<float,2>{0.532251954f, 0.106175981f},
-std::array<float,2>{0.295880586f, 0.556676686f},
-std::array<float,2>{0.187157631f, 0.371702194f},
-std::array<float,2>{0.776139975f, 0.858905077f},
-std::array<float,2>{0.620575368f, 0.422278047f},
-std::array<float,2>{0.368674368f, 0.977042913f},
-std::array<float,2>{0.190392748f, 0.151809245f},
-std::array<float,2>{0.857955992f, 0.628905118f},
-std::array<float,2>{0.950825751f, 0.00508715492f},
-std::array<float,2>{0.015414523f, 0.617492914f},
-std::array<float,2>{0.477641553f, 0.286362439f},
-std::array<float,2>{0.705056787f, 0.808755398f},
-std::array<float,2>{0.786388576f, 0.331994027f},
-std::array<float,2>{0.153573737f, 0.841862082f},
-std::array<float,2>{0.267388552f, 0.064532876f},
-std::array<float,2>{0.52872175f, 0.504255652f},
-std::array<float,2>{0.665061653f, 0.243384913f},
-std::array<float,2>{0.432392895f, 0.702012777f},
-std::array<float,2>{0.0632436499f, 0.462964028f},
-std::array<float,2>{0.89553535f, 0.910046577f},
-std::array<float,2>{0.592678905f, 0.292119533f},
-std::array<float,2>{0.331339449f, 0.798325241f},
-std::array<float,2>{0.2316394f, 0.013805869f},
-std::array<float,2>{0.843199611f, 0.611921191f},
-std::array<float,2>{0.973389387f, 0.14356938f},
-std::array<float,2>{0.0395857245f, 0.633468509f},
-std::array<float,2>{0.441962361f, 0.435435206f},
-std::array<float,2>{0.741166234f, 0.97305727f},
-std::array<float,2>{0.771100998f, 0.455661654f},
-std::array<float,2>{0.17731677f, 0.91496712f},
-std::array<float,2>{0.283187628f, 0.24110359f},
-std::array<float,2>{0.542067468f, 0.692696214f},
-std::array<float,2>{0.653619528f, 0.0719059855f},
-std::array<float,2>{0.397523761f, 0.515177608f},
-std::array<float,2>{0.112931035f, 0.338160515f},
-std::array<float,2>{0.925931275f, 0.835563421f},
-std::array<float,2>{0.71469295f, 0.401566327f},
-std::array<float,2>{0.470539898f, 0.949440241f},
-std::array<float,2>{0.000105068546f, 0.1626288f},
-std::array<float,2>{0.944461465f, 0.686754525f},
-std::array<float,2>{0.85042721f, 0.05617835f},
-std::array<float,2>{0.196950063f, 0.583196044f},
-std::array<float,2>{0.364590526f, 0.27170217f},
-std::array<float,2>{0.613922477f, 0.750686288f},
-std::array<float,2>{0.90149951f, 0.365659863f},
-std::array<float,2>{0.0709059685f, 0.849984169f},
-std::array<float,2>{0.422059178f, 0.0974322706f},
-std::array<float,2>{0.657082736f, 0.55459404f},
-std::array<float,2>{0.520272255f, 0.208478376f},
-std::array<float,2>{0.277482599f, 0.72547555f},
-std::array<float,2>{0.144124955f, 0.49259904f},
-std::array<float,2>{0.795773089f, 0.904885888f},
-std::array<float,2>{0.682916522f, 0.312535822f},
-std::array<float,2>{0.418035418f, 0.823345006f},
-std::array<float,2>{0.0935131535f, 0.0873229504f},
-std::array<float,2>{0.890577197f, 0.530760765f},
-std::array<float,2>{0.806737483f, 0.231829554f},
-std::array<float,2>{0.132798657f, 0.712336779f},
-std::array<float,2>{0.25410831f, 0.440207779f},
-std::array<float,2>{0.510793209f, 0.931129098f},
-std::array<float,2>{0.956335068f, 0.415607452f},
-std::array<float,2>{0.030432405f, 0.991602719f},
-std::array<float,2>{0.488826901f, 0.131174058f},
-std::array<float,2>{0.697392881f, 0.654308677f},
-std::array<float,2>{0.601001024f, 0.022060737f},
-std::array<float,2>{0.35847345f, 0.601582825f},
-std::array<float,2>{0.203360111f, 0.310852289f},
-std::array<float,2>{0.872581542f, 0.788409173f},
-std::array<float,2>{0.555793583f, 0.473594189f},
-std::array<float,2>{0.309845626f, 0.876652837f},
-std::array<float,2>{0.167725012f, 0.193944156f},
-std::array<float,2>{0.751611233f, 0.745339274f},
-std::array<float,2>{0.912992001f, 0.122002311f},
-std::array<float,2>{0.106913246f, 0.531788528f},
-std::array<float,2>{0.381327957f, 0.3553904f},
-std::array<float,2>{0.625450909f, 0.872853041f},
-std::array<float,2>{0.821992338f, 0.263085395f},
-std::array<float,2>{0.246745348f, 0.779190242f},
-std::array<float,2>{0.313381016f, 0.0400133952f},
-std::array<float,2>{0.573494017f, 0.566372275f},
-std::array<float,2>{0.720545173f, 0.174288765f},
-std::array<float,2>{0.461354762f, 0.665203631f},
-std::array<float,2>{0.0559891425f, 0.385547876f},
-std::array<float,2>{0.984514475f, 0.962552607f},
-std::array<float,2>{0.568689346f, 0.36112693f},
-std::array<float,2>{0.323365778f, 0.846749783f},
-std::array<float,2>{0.236883312f, 0.0979468599f},
-std::array<float,2>{0.815030932f, 0.550649881f},
-std::array<float,2>{0.994281828f, 0.206670731f},
-std::array<float,2>{0.0543255284f, 0.721317112f},
-std::array<float,2>{0.45845294f, 0.499330819f},
-std::array<float,2>{0.728687465f, 0.899765372f},
-std::array<float,2>{0.761619389f, 0.403583139f},
-std::array<float,2>{0.156971216f, 0.946887553f},
-std::array<float,2>{0.304601014f, 0.158180803f},
-std::array<float,2>{0.549657941f, 0.681522012f},
-std::array<float,2>{0.639360666f, 0.0610187352f},
-std::array<float,2>{0.383663118f, 0.579523385f},
-std::array<float,2>{0.0957815945f, 0.269029438f},
-std::array<float,2>{0.919286668f, 0.754357398f},
-std::array<float,2>{0.687706649f, 0.459006548f},
-std::array<float,2>{0.495209187f, 0.920596182f},
-std::array<float,2>{0.0218235441f, 0.235374644f},
-std::array<float,2>{0.962922871f, 0.688274562f},
-std::array<float,2>{0.866048694f, 0.0767452568f},
-std::array<float,2>{0.217875212f, 0.50862211f},
-std::array<float,2>{0.347509444f, 0.3405765f},
-std::array<float,2>{0.608116388f, 0.828686297f},
-std::array<float,2>{0.875197887f, 0.294197947f},
-std::array<float,2>{0.0832474977f, 0.800901353f},
-std::array<float,2>{0.40726018f, 0.0111499736f},
-std::array<float,2>{0.673585474f, 0.614431381f},
-std::array<float,2>{0.50749588f, 0.146189556f},
-std::array<float,2>{0.259002596f, 0.640609682f},
-std::array<float,2>{0.140273929f, 0.432271034f},
-std::array<float,2>{0.804340363f, 0.972151875f},
-std::array<float,2>{0.670425236f, 0.258053839f},
-std::array<float,2>{0.434244007f, 0.776259363f},
-std::array<float,2>{0.0676542595f, 0.0458365604f},
-std::array<float,2>{0.89127022f, 0.568866193f},
-std::array<float,2>{0.783407032f, 0.177108198f},
-std::array<float,2>{0.149529427f, 0.670165777f},
-std::array<float,2>{0.269793063f, 0.390465647f},
-std::array<float,2>{0.525266588f, 0.966219068f},
-std::array<float,2>{0.945743263f, 0.471334249f},
-std::array<float,2>{0.00796378311f, 0.881646216f},
-std::array<float,2>{0.480600238f, 0.190981224f},
-std::array<float,2>{0.707518637f, 0.749511063f},
-std::array<float,2>{0.624567151f, 0.120966308f},
-std::array<float,2>{0.371834934f, 0.538624883f},
-std::array<float,2>{0.192963347f, 0.355574161f},
-std::array<float,2>{0.852279246f, 0.868286729f},
-std::array<float,2>{0.53785044f, 0.418166876f},
-std::array<float,2>{0.291280359f, 0.988239765f},
-std::array<float,2>{0.182548091f, 0.127450436f},
-std::array<float,2>{0.778026104f, 0.649121761f},
-std::array<float,2>{0.935964227f, 0.0174589437f},
-std::array<float,2>{0.119504876f, 0.606106758f},
-std::array<float,2>{0.403740108f, 0.306713641f},
-std::array<float,2>{0.646545708f, 0.782416403f},
-std::array<float,2>{0.835515559f, 0.319208682f},
-std::array<float,2>{0.219758362f, 0.826519787f},
-std::array<float,2>{0.336528867f, 0.0901543126f},
-std::array<float,2>{0.579388916f, 0.524929821f},
-std::array<float,2>{0.74671936f, 0.229912713f},
-std::array<float,2>{0.449718446f, 0.714954674f},
-std::array<float,2>{0.0380024239f, 0.441466689f},
-std::array<float,2>{0.983030736f, 0.934039652f},
-std::array<float,2>{0.515821278f, 0.304132164f},
-std::array<float,2>{0.276663244f, 0.793254077f},
-std::array<float,2>{0.148132414f, 0.0290994067f},
-std::array<float,2>{0.792748272f, 0.597445071f},
-std::array<float,2>{0.906050861f, 0.140357986f},
-std::array<float,2>{0.0758111775f, 0.646426022f},
-std::array<float,2>{0.427143216f, 0.407524794f},
-std::array<float,2>{0.663128614f, 0.993881702f},
-std::array<float,2>{0.843784392f, 0.445366085f},
-std::array<float,2>{0.199665919f, 0.925133944f},
-std::array<float,2>{0.360783994f, 0.219381422f},
-std::array<float,2>{0.611843824f, 0.706797004f},
-std::array<float,2>{0.717006266f, 0.0844570249f},
-std::array<float,2>{0.475975484f, 0.520405591f},
-std::array<float,2>{0.00768697308f, 0.322258949f},
-std::array<float,2>{0.940723658f, 0.812794626f},
-std::array<float,2>{0.649253726f, 0.377986044f},
-std::array<float,2>{0.392175257f, 0.955109179f},
-std::array<float,2>{0.114975132f, 0.181259722f},
-std::array<float,2>{0.922189057f, 0.659359097f},
-std::array<float,2>{0.768382311f, 0.033660613f},
-std::array<float,2>{0.175306708f, 0.575735092f},
-std::array<float,2>{0.288851023f, 0.254851669f},
-std::array<float,2>{0.544384718f, 0.769685447f},
-std::array<float,2>{0.970569313f, 0.347593188f},
-std::array<float,2>{0.0447226577f, 0.862810969f},
-std::array<float,2>{0.43941772f, 0.111108787f},
-std::array<float,2>{0.737155259f, 0.546698749f},
-std::array<float,2>{0.586040199f, 0.202537537f},
-std::array<float,2>{0.332851201f, 0.737964272f},
-std::array<float,2>{0.228518218f, 0.482144296f},
-std::array<float,2>{0.836296916f, 0.886629701f},
-std::array<float,2>{0.726063669f, 0.334432214f},
-std::array<float,2>{0.466487318f, 0.837431431f},
-std::array<float,2>{0.0601910166f, 0.0679771006f},
-std::array<float,2>{0.992033899f, 0.503188848f},
-std::array<float,2>{0.82768023f, 0.249716476f},
-std::array<float,2>{0.243822485f, 0.698001146f},
-std::array<float,2>{0.319408536f, 0.467302114f},
-std::array<float,2>{0.574392915f, 0.91255182f},
-std::array<float,2>{0.908911288f, 0.427786887f},
-std::array<float,2>{0.102444962f, 0.982357562f},
-std::array<float,2>{0.378873169f, 0.15331994f},
-std::array<float,2>{0.630727291f, 0.628949881f},
-std::array<float,2>{0.56052506f, 0.0011031928f},
-std::array<float,2>{0.307459116f, 0.624405384f},
-std::array<float,2>{0.171185136f, 0.282092959f},
-std::array<float,2>{0.75590384f, 0.807065189f},
-std::array<float,2>{0.597295761f, 0.486528665f},
-std::array<float,2>{0.352933556f, 0.897827387f},
-std::array<float,2>{0.207620695f, 0.218544587f},
-std::array<float,2>{0.868169665f, 0.727531552f},
-std::array<float,2>{0.958753526f, 0.102325186f},
-std::array<float,2>{0.0251679681f, 0.558698237f},
-std::array<float,2>{0.487230897f, 0.370198697f},
-std::array<float,2>{0.699399412f, 0.855231345f},
-std::array<float,2>{0.810539782f, 0.277675271f},
-std::array<float,2>{0.126977056f, 0.760628283f},
-std::array<float,2>{0.252349168f, 0.052880004f},
-std::array<float,2>{0.515326321f, 0.593307018f},
-std::array<float,2>{0.687226117f, 0.170669496f},
-std::array<float,2>{0.415383369f, 0.674586713f},
-std::array<float,2>{0.0891688019f, 0.393342912f},
-std::array<float,2>{0.884560943f, 0.942903578f},
-std::array<float,2>{0.554139793f, 0.324264944f},
-std::array<float,2>{0.297579527f, 0.819911659f},
-std::array<float,2>{0.164036781f, 0.0810428038f},
-std::array<float,2>{0.764159918f, 0.518042028f},
-std::array<float,2>{0.916382372f, 0.225330845f},
-std::array<float,2>{0.0995138958f, 0.708216429f},
-std::array<float,2>{0.388526291f, 0.452155918f},
-std::array<float,2>{0.633657038f, 0.927680373f},
-std::array<float,2>{0.817413747f, 0.4114528f},
-std::array<float,2>{0.240260318f, 0.996789396f},
-std::array<float,2>{0.325729638f, 0.135830775f},
-std::array<float,2>{0.562874615f, 0.641071737f},
-std::array<float,2>{0.734021246f, 0.0263530463f},
-std::array<float,2>{0.455715537f, 0.5999313f},
-std::array<float,2>{0.0472904481f, 0.297476441f},
-std::array<float,2>{0.998520613f, 0.79223299f},
-std::array<float,2>{0.679467499f, 0.479380071f},
-std::array<float,2>{0.413025618f, 0.888071358f},
-std::array<float,2>{0.080325447f, 0.198730648f},
-std::array<float,2>{0.880934894f, 0.740085423f},
-std::array<float,2>{0.79893595f, 0.114107512f},
-std::array<float,2>{0.13640067f, 0.541762233f},
-std::array<float,2>{0.262937427f, 0.349588603f},
-std::array<float,2>{0.50042212f, 0.863915026f},
-std::array<float,2>{0.966717422f, 0.253821045f},
-std::array<float,2>{0.0171712916f, 0.768086851f},
-std::array<float,2>{0.498265147f, 0.0366832651f},
-std::array<float,2>{0.694459081f, 0.574165583f},
-std::array<float,2>{0.6018098f, 0.185511559f},
-std::array<float,2>{0.349094421f, 0.663516819f},
-std::array<float,2>{0.211078286f, 0.379061818f},
-std::array<float,2>{0.861644626f, 0.957256913f},
-std::array<float,2>{0.705769122f, 0.288117915f},
-std::array<float,2>{0.479011893f, 0.811353564f},
-std::array<float,2>{0.0131050879f, 0.00696311612f},
-std::array<float,2>{0.95300597f, 0.620438874f},
-std::array<float,2>{0.85582763f, 0.150009096f},
-std::array<float,2>{0.189171746f, 0.626396656f},
-std::array<float,2>{0.370349586f, 0.424262881f},
-std::array<float,2>{0.618147612f, 0.980243981f},
-std::array<float,2>{0.896645248f, 0.461188793f},
-std::array<float,2>{0.065631479f, 0.90692699f},
-std::array<float,2>{0.43034932f, 0.244602695f},
-std::array<float,2>{0.666450381f, 0.69972688f},
-std::array<float,2>{0.530793309f, 0.0628984496f},
-std::array<float,2>{0.269141495f, 0.507806599f},
-std::array<float,2>{0.155721009f, 0.328749955f},
-std::array<float,2>{0.788165331f, 0.839993358f},
-std::array<float,2>{0.5841465f, 0.395670325f},
-std::array<float,2>{0.339944243f, 0.940564156f},
-std::array<float,2>{0.22603488f, 0.166897431f},
-std::array<float,2>{0.830347478f, 0.678335309f},
-std::array<float,2>{0.978284657f, 0.0470140353f},
-std::array<float,2>{0.032809753f, 0.589693964f},
-std::array<float,2>{0.44826141f, 0.276179731f},
-std::array<float,2>{0.745454967f, 0.762658954f},
-std::array<float,2>{0.773455441f, 0.374732196f},
-std::array<float,2>{0.185456455f, 0.85660857f},
-std::array<float,2>{0.293001264f, 0.108183473f},
-std::array<float,2>{0.534812152f, 0.556394041f},
-std::array<float,2>{0.642903984f, 0.212095097f},
-std::array<float,2>{0.401703954f, 0.730633557f},
-std::array<float,2>{0.121982582f, 0.489742041f},
-std::array<float,2>{0.932641029f, 0.893041611f},
-std::array<float,2>{0.615262568f, 0.269996405f},
-std::array<float,2>{0.365987301f, 0.753384948f},
-std::array<float,2>{0.198742613f, 0.0585525222f},
-std::array<float,2>{0.848000586f, 0.585330427f},
-std::array<float,2>{0.942433953f, 0.161833107f},
-std::array<float,2>{0.00378792244f, 0.684043109f},
-std::array<float,2>{0.472491175f, 0.400272846f},
-std::array<float,2>{0.71147877f, 0.952976108f},
-std::array<float,2>{0.794360697f, 0.494267195f},
-std::array<float,2>{0.142051622f, 0.903388441f},
-std::array<float,2>{0.27970019f, 0.209667102f},
-std::array<float,2>{0.52241838f, 0.723285139f},
-std::array<float,2>{0.65953505f, 0.0947346911f},
-std::array<float,2>{0.424373329f, 0.55196625f},
-std::array<float,2>{0.0725403652f, 0.365091711f},
-std::array<float,2>{0.898715675f, 0.848210037f},
-std::array<float,2>{0.740225732f, 0.436454594f},
-std::array<float,2>{0.444969714f, 0.974909663f},
-std::array<float,2>{0.0413151756f, 0.141312867f},
-std::array<float,2>{0.975683928f, 0.635096252f},
-std::array<float,2>{0.841140211f, 0.0128342463f},
-std::array<float,2>{0.232949242f, 0.609911084f},
-std::array<float,2>{0.328543603f, 0.289455652f},
-std::array<float,2>{0.590002656f, 0.800369143f},
-std::array<float,2>{0.929494858f, 0.337443829f},
-std::array<float,2>{0.110689946f, 0.832484603f},
-std::array<float,2>{0.396457493f, 0.0741158351f},
-std::array<float,2>{0.655021369f, 0.512839437f},
-std::array<float,2>{0.540629327f, 0.238742232f},
-std::array<float,2>{0.283855259f, 0.694541335f},
-std::array<float,2>{0.17796053f, 0.454698235f},
-std::array<float,2>{0.773025811f, 0.917153478f},
-std::array<float,2>{0.627774179f, 0.351734102f},
-std::array<float,2>{0.379206389f, 0.874123156f},
-std::array<float,2>{0.108194008f, 0.123828791f},
-std::array<float,2>{0.911255181f, 0.533791065f},
-std::array<float,2>{0.753280878f, 0.191699162f},
-std::array<float,2>{0.165973708f, 0.743439555f},
-std::array<float,2>{0.311805159f, 0.476507127f},
-std::array<float,2>{0.558448732f, 0.878515899f},
-std::array<float,2>{0.987116098f, 0.383922547f},
-std::array<float,2>{0.0584838465f, 0.964349866f},
-std::array<float,2>{0.46394223f, 0.172664538f},
-std::array<float,2>{0.722572923f, 0.667848647f},
-std::array<float,2>{0.570698023f, 0.0421858914f},
-std::array<float,2>{0.315055847f, 0.563517988f},
-std::array<float,2>{0.248390511f, 0.264461309f},
-std::array<float,2>{0.822463334f, 0.780960917f},
-std::array<float,2>{0.508845329f, 0.4385584f},
-std::array<float,2>{0.256187946f, 0.93235445f},
-std::array<float,2>{0.130151883f, 0.234106094f},
-std::array<float,2>{0.805324972f, 0.713304579f},
-std::array<float,2>{0.887147427f, 0.0895705298f},
-std::array<float,2>{0.0906759873f, 0.528312266f},
-std::array<float,2>{0.421082973f, 0.315146267f},
-std::array<float,2>{0.680054128f, 0.821485698f},
-std::array<float,2>{0.873992622f, 0.310240835f},
-std::array<float,2>{0.205359474f, 0.78565985f},
-std::array<float,2>{0.357190728f, 0.0203709155f},
-std::array<float,2>{0.598127723f, 0.605343163f},
-std::array<float,2>{0.696541548f, 0.130411655f},
-std::array<float,2>{0.49049145f, 0.653218091f},
-std::array<float,2>{0.0278575178f, 0.416849256f},
-std::array<float,2>{0.953948915f, 0.988350511f},
-std::array<float,2>{0.578323245f, 0.317497492f},
-std::array<float,2>{0.337045729f, 0.826165438f},
-std::array<float,2>{0.219272122f, 0.0937014148f},
-std::array<float,2>{0.834930182f, 0.526450872f},
-std::array<float,2>{0.983869672f, 0.228293031f},
-std::array<float,2>{0.0381372385f, 0.718539119f},
-std::array<float,2>{0.450674534f, 0.444548994f},
-std::array<float,2>{0.747122824f, 0.935944676f},
-std::array<float,2>{0.779150307f, 0.420190036f},
-std::array<float,2>{0.183524057f, 0.985911667f},
-std::array<float,2>{0.292326182f, 0.126577258f},
-std::array<float,2>{0.53864181f, 0.650708139f},
-std::array<float,2>{0.648243845f, 0.0180027075f},
-std::array<float,2>{0.402446121f, 0.608057618f},
-std::array<float,2>{0.120286368f, 0.305905908f},
-std::array<float,2>{0.937007129f, 0.784827888f},
-std::array<float,2>{0.70856905f, 0.469845593f},
-std::array<float,2>{0.482305378f, 0.880782843f},
-std::array<float,2>{0.00958406739f, 0.187647879f},
-std::array<float,2>{0.946308553f, 0.747661769f},
-std::array<float,2>{0.852575719f, 0.118834674f},
-std::array<float,2>{0.191659853f, 0.536911368f},
-std::array<float,2>{0.372478157f, 0.359040946f},
-std::array<float,2>{0.623986125f, 0.870638072f},
-std::array<float,2>{0.892329752f, 0.261562258f},
-std::array<float,2>{0.0667727515f, 0.77359128f},
-std::array<float,2>{0.435475975f, 0.0439063199f},
-std::array<float,2>{0.671190917f, 0.566933215f},
-std::array<float,2>{0.52428472f, 0.177850857f},
-std::array<float,2>{0.270772398f, 0.669439435f},
-std::array<float,2>{0.148722932f, 0.388168544f},
-std::array<float,2>{0.784987032f, 0.96711421f},
-std::array<float,2>{0.672356963f, 0.295146555f},
-std::array<float,2>{0.406390697f, 0.803383052f},
-std::array<float,2>{0.0827758834f, 0.00867870264f},
-std::array<float,2>{0.876241744f, 0.616612911f},
-std::array<float,2>{0.803435087f, 0.147397161f},
-std::array<float,2>{0.139359489f, 0.637814999f},
-std::array<float,2>{0.258574218f, 0.431546777f},
-std::array<float,2>{0.505959094f, 0.969222069f},
-std::array<float,2>{0.964611292f, 0.457082033f},
-std::array<float,2>{0.0226720497f, 0.918133438f},
-std::array<float,2>{0.494499654f, 0.237001881f},
-std::array<float,2>{0.68925941f, 0.689548373f},
-std::array<float,2>{0.608641028f, 0.0754148886f},
-std::array<float,2>{0.346416146f, 0.510683835f},
-std::array<float,2>{0.217591017f, 0.342382371f},
-std::array<float,2>{0.866249621f, 0.830996513f},
-std::array<float,2>{0.550748706f, 0.405778021f},
-std::array<float,2>{0.303148031f, 0.948361278f},
-std::array<float,2>{0.15728949f, 0.160101891f},
-std::array<float,2>{0.760014296f, 0.683260798f},
-std::array<float,2>{0.918685138f, 0.0593029f},
-std::array<float,2>{0.0969309062f, 0.580728889f},
-std::array<float,2>{0.384216636f, 0.266869426f},
-std::array<float,2>{0.640530407f, 0.756729722f},
-std::array<float,2>{0.815589726f, 0.361446351f},
-std::array<float,2>{0.237618595f, 0.84484452f},
-std::array<float,2>{0.323057085f, 0.100063212f},
-std::array<float,2>{0.569517732f, 0.548546493f},
-std::array<float,2>{0.730377316f, 0.204016685f},
-std::array<float,2>{0.457049876f, 0.719424307f},
-std::array<float,2>{0.0532002822f, 0.496782631f},
-std::array<float,2>{0.99603653f, 0.901827335f},
-std::array<float,2>{0.514180303f, 0.279968619f},
-std::array<float,2>{0.253057539f, 0.758455634f},
-std::array<float,2>{0.128141552f, 0.0516799018f},
-std::array<float,2>{0.809038579f, 0.590727806f},
-std::array<float,2>{0.882892907f, 0.168182567f},
-std::array<float,2>{0.0884728655f, 0.672794938f},
-std::array<float,2>{0.414833337f, 0.392400354f},
-std::array<float,2>{0.685924649f, 0.945195973f},
-std::array<float,2>{0.867622554f, 0.485204488f},
-std::array<float,2>{0.208714694f, 0.895466208f},
-std::array<float,2>{0.35197556f, 0.216002747f},
-std::array<float,2>{0.596522689f, 0.730034113f},
-std::array<float,2>{0.700891256f, 0.104317293f},
-std::array<float,2>{0.487933457f, 0.561971545f},
-std::array<float,2>{0.0241681356f, 0.367356867f},
-std::array<float,2>{0.957167268f, 0.851605594f},
-std::array<float,2>{0.629873872f, 0.427076608f},
-std::array<float,2>{0.376995623f, 0.982839704f},
-std::array<float,2>{0.103262819f, 0.155443847f},
-std::array<float,2>{0.909256995f, 0.631471753f},
-std::array<float,2>{0.757741332f, 0.00198701187f},
-std::array<float,2>{0.170164526f, 0.622405589f},
-std::array<float,2>{0.308554292f, 0.284915894f},
-std::array<float,2>{0.558681726f, 0.805821121f},
-std::array<float,2>{0.990248084f, 0.332760364f},
-std::array<float,2>{0.0593512282f, 0.837900341f},
-std::array<float,2>{0.465692669f, 0.0703092366f},
-std::array<float,2>{0.724802852f, 0.50066191f},
-std::array<float,2>{0.576053143f, 0.247298405f},
-std::array<float,2>{0.318916559f, 0.696070194f},
-std::array<float,2>{0.242380381f, 0.465719134f},
-std::array<float,2>{0.826929688f, 0.912012339f},
-std::array<float,2>{0.737809002f, 0.344654799f},
-std::array<float,2>{0.438284248f, 0.861186564f},
-std::array<float,2>{0.0436426327f, 0.112600505f},
-std::array<float,2>{0.969656348f, 0.543825865f},
-std::array<float,2>{0.837115347f, 0.199936569f},
-std::array<float,2>{0.230376035f, 0.735641122f},
-std::array<float,2>{0.333147109f, 0.484273762f},
-std::array<float,2>{0.586977959f, 0.883689582f},
-std::array<float,2>{0.923590243f, 0.376937062f},
-std::array<float,2>{0.1139277f, 0.953731537f},
-std::array<float,2>{0.391214073f, 0.182453036f},
-std::array<float,2>{0.649917603f, 0.657907963f},
-std::array<float,2>{0.543940425f, 0.0323955677f},
-std::array<float,2>{0.287647545f, 0.577003241f},
-std::array<float,2>{0.174803451f, 0.257799596f},
-std::array<float,2>{0.769087613f, 0.772799194f},
-std::array<float,2>{0.612848818f, 0.448493451f},
-std::array<float,2>{0.359796643f, 0.922409415f},
-std::array<float,2>{0.201043829f, 0.221821696f},
-std::array<float,2>{0.845615149f, 0.704386294f},
-std::array<float,2>{0.940253019f, 0.0828812197f},
-std::array<float,2>{0.00619112328f, 0.523137927f},
-std::array<float,2>{0.474877596f, 0.323343098f},
-std::array<float,2>{0.718344271f, 0.814496517f},
-std::array<float,2>{0.791479111f, 0.30156377f},
-std::array<float,2>{0.147398204f, 0.795784652f},
-std::array<float,2>{0.275862336f, 0.0301862322f},
-std::array<float,2>{0.517362177f, 0.594836414f},
-std::array<float,2>{0.662154436f, 0.138261378f},
-std::array<float,2>{0.42658332f, 0.646605432f},
-std::array<float,2>{0.0751186311f, 0.40894258f},
-std::array<float,2>{0.904685378f, 0.994991064f},
-std::array<float,2>{0.533390045f, 0.372142643f},
-std::array<float,2>{0.294659078f, 0.857726038f},
-std::array<float,2>{0.183971345f, 0.106548004f},
-std::array<float,2>{0.774537981f, 0.558408916f},
-std::array<float,2>{0.932310402f, 0.214769021f},
-std::array<float,2>{0.122513577f, 0.732634485f},
-std::array<float,2>{0.4006612f, 0.490738034f},
-std::array<float,2>{0.643782854f, 0.8922683f},
-std::array<float,2>{0.831999063f, 0.397618651f},
-std::array<float,2>{0.225256875f, 0.938069642f},
-std::array<float,2>{0.341365695f, 0.165379331f},
-std::array<float,2>{0.58501035f, 0.676420927f},
-std::array<float,2>{0.744466782f, 0.0501399152f},
-std::array<float,2>{0.447862446f, 0.587559104f},
-std::array<float,2>{0.0316579863f, 0.273681551f},
-std::array<float,2>{0.976742506f, 0.764955103f},
-std::array<float,2>{0.667193949f, 0.464592099f},
-std::array<float,2>{0.430830449f, 0.908420682f},
-std::array<float,2>{0.0651953295f, 0.242401481f},
-std::array<float,2>{0.897553802f, 0.702600181f},
-std::array<float,2>{0.787586808f, 0.0659755692f},
-std::array<float,2>{0.154462263f, 0.505609572f},
-std::array<float,2>{0.268197626f, 0.330278248f},
-std::array<float,2>{0.530022979f, 0.84278053f},
-std::array<float,2>{0.951864183f, 0.286086529f},
-std::array<float,2>{0.0121171791f, 0.810298204f},
-std::array<float,2>{0.480135441f, 0.0048065735f},
-std::array<float,2>{0.706810892f, 0.618910491f},
-std::array<float,2>{0.619088352f, 0.150446892f},
-std::array<float,2>{0.370087892f, 0.627325952f},
-std::array<float,2>{0.187889129f, 0.423563451f},
-std::array<float,2>{0.857070804f, 0.977552891f},
-std::array<float,2>{0.693938613f, 0.250576794f},
-std::array<float,2>{0.499556988f, 0.76650697f},
-std::array<float,2>{0.0157538038f, 0.0385439545f},
-std::array<float,2>{0.964865267f, 0.571955144f},
-std::array<float,2>{0.863137186f, 0.186890155f},
-std::array<float,2>{0.212568402f, 0.661100268f},
-std::array<float,2>{0.34806639f, 0.381963491f},
-std::array<float,2>{0.603251457f, 0.96011889f},
-std::array<float,2>{0.882527709f, 0.478029847f},
-std::array<float,2>{0.0819756761f, 0.890102744f},
-std::array<float,2>{0.41342625f, 0.196043834f},
-std::array<float,2>{0.677930295f, 0.741546869f},
-std::array<float,2>{0.501459301f, 0.116543613f},
-std::array<float,2>{0.262367845f, 0.539539099f},
-std::array<float,2>{0.135396764f, 0.349927396f},
-std::array<float,2>{0.800024807f, 0.867019653f},
-std::array<float,2>{0.563867033f, 0.412370831f},
-std::array<float,2>{0.324472725f, 0.999726653f},
-std::array<float,2>{0.241600424f, 0.13474752f},
-std::array<float,2>{0.816895604f, 0.643843234f},
-std::array<float,2>{0.999230444f, 0.0238758661f},
-std::array<float,2>{0.048160933f, 0.598045647f},
-std::array<float,2>{0.45683682f, 0.299340665f},
-std::array<float,2>{0.732903659f, 0.789100111f},
-std::array<float,2>{0.765528262f, 0.327338129f},
-std::array<float,2>{0.162265316f, 0.81649518f},
-std::array<float,2>{0.298008502f, 0.078751348f},
-std::array<float,2>{0.55359298f, 0.516472578f},
-std::array<float,2>{0.634303689f, 0.223561943f},
-std::array<float,2>{0.386842132f, 0.709834456f},
-std::array<float,2>{0.0985596254f, 0.450941861f},
-std::array<float,2>{0.917257607f, 0.929127336f},
-std::array<float,2>{0.599278808f, 0.312284917f},
-std::array<float,2>{0.356002718f, 0.787811756f},
-std::array<float,2>{0.206665933f, 0.0228216015f},
-std::array<float,2>{0.874999166f, 0.603123128f},
-std::array<float,2>{0.954570353f, 0.132381991f},
-std::array<float,2>{0.0283361878f, 0.656055212f},
-std::array<float,2>{0.492060214f, 0.414205015f},
-std::array<float,2>{0.695447206f, 0.990360916f},
-std::array<float,2>{0.805878222f, 0.441096097f},
-std::array<float,2>{0.12914142f, 0.930298448f},
-std::array<float,2>{0.257685542f, 0.230903789f},
-std::array<float,2>{0.507891715f, 0.711883366f},
-std::array<float,2>{0.681156039f, 0.0861862749f},
-std::array<float,2>{0.420070678f, 0.530259669f},
-std::array<float,2>{0.0912167877f, 0.313727498f},
-std::array<float,2>{0.888215244f, 0.822375715f},
-std::array<float,2>{0.72161597f, 0.386663824f},
-std::array<float,2>{0.463420987f, 0.961857617f},
-std::array<float,2>{0.0566690564f, 0.175398156f},
-std::array<float,2>{0.987581432f, 0.665004849f},
-std::array<float,2>{0.823904037f, 0.0405924767f},
-std::array<float,2>{0.249221459f, 0.56498152f},
-std::array<float,2>{0.315716356f, 0.262358785f},
-std::array<float,2>{0.572044253f, 0.777989864f},
-std::array<float,2>{0.910313547f, 0.353617251f},
-std::array<float,2>{0.108706631f, 0.871709764f},
-std::array<float,2>{0.380012721f, 0.12232767f},
-std::array<float,2>{0.628849089f, 0.532624304f},
-std::array<float,2>{0.556885481f, 0.195246443f},
-std::array<float,2>{0.310854375f, 0.744235575f},
-std::array<float,2>{0.164088354f, 0.47401017f},
-std::array<float,2>{0.752254844f, 0.875760138f},
-std::array<float,2>{0.656058371f, 0.339665145f},
-std::array<float,2>{0.39506799f, 0.83442986f},
-std::array<float,2>{0.109502867f, 0.0705410019f},
-std::array<float,2>{0.928305268f, 0.514539778f},
-std::array<float,2>{0.772427976f, 0.241888493f},
-std::array<float,2>{0.178899765f, 0.692171574f},
-std::array<float,2>{0.285114527f, 0.45614481f},
-std::array<float,2>{0.539976835f, 0.915684521f},
-std::array<float,2>{0.974643588f, 0.434032947f},
-std::array<float,2>{0.0427761599f, 0.973678052f},
-std::array<float,2>{0.444325417f, 0.142961085f},
-std::array<float,2>{0.738609731f, 0.634054184f},
-std::array<float,2>{0.591592252f, 0.0147027113f},
-std::array<float,2>{0.329332381f, 0.613021731f},
-std::array<float,2>{0.233511329f, 0.29141441f},
-std::array<float,2>{0.840324044f, 0.797296286f},
-std::array<float,2>{0.522852421f, 0.493287086f},
-std::array<float,2>{0.281108886f, 0.905585945f},
-std::array<float,2>{0.140973866f, 0.207100302f},
-std::array<float,2>{0.79298985f, 0.726062059f},
-std::array<float,2>{0.899415851f, 0.0966166854f},
-std::array<float,2>{0.0737481639f, 0.553402245f},
-std::array<float,2>{0.425733656f, 0.366882771f},
-std::array<float,2>{0.659101367f, 0.850914598f},
-std::array<float,2>{0.848877966f, 0.27275604f},
-std::array<float,2>{0.197544903f, 0.751379728f},
-std::array<float,2>{0.366211593f, 0.0549394116f},
-std::array<float,2>{0.616964579f, 0.582173467f},
-std::array<float,2>{0.712565005f, 0.163949326f},
-std::array<float,2>{0.471226186f, 0.685662866f},
-std::array<float,2>{0.00292726629f, 0.400662959f},
-std::array<float,2>{0.942056596f, 0.950485468f},
-std::array<float,2>{0.622935534f, 0.356687516f},
-std::array<float,2>{0.373479337f, 0.867800474f},
-std::array<float,2>{0.194025248f, 0.11986874f},
-std::array<float,2>{0.853881359f, 0.537494898f},
-std::array<float,2>{0.94799161f, 0.189718187f},
-std::array<float,2>{0.0101376101f, 0.748427093f},
-std::array<float,2>{0.48426348f, 0.472650975f},
-std::array<float,2>{0.710136712f, 0.882462919f},
-std::array<float,2>{0.781832576f, 0.388814896f},
-std::array<float,2>{0.152254865f, 0.965063751f},
-std::array<float,2>{0.271539181f, 0.176327139f},
-std::array<float,2>{0.526771426f, 0.67184633f},
-std::array<float,2>{0.668355584f, 0.0462021083f},
-std::array<float,2>{0.436728448f, 0.569705486f},
-std::array<float,2>{0.0690624565f, 0.259368926f},
-std::array<float,2>{0.893870473f, 0.777155519f},
-std::array<float,2>{0.74980551f, 0.443038553f},
-std::array<float,2>{0.451176822f, 0.93519628f},
-std::array<float,2>{0.0357822813f, 0.229023099f},
-std::array<float,2>{0.981514513f, 0.716131926f},
-std::array<float,2>{0.8325212f, 0.0909359232f},
-std::array<float,2>{0.222118303f, 0.524061143f},
-std::array<float,2>{0.338874727f, 0.319731385f},
-std::array<float,2>{0.58045572f, 0.828072309f},
-std::array<float,2>{0.933674574f, 0.308428228f},
-std::array<float,2>{0.118165068f, 0.781286955f},
-std::array<float,2>{0.40602544f, 0.0159621425f},
-std::array<float,2>{0.645036101f, 0.606669664f},
-std::array<float,2>{0.536314011f, 0.128860638f},
-std::array<float,2>{0.289923131f, 0.650249958f},
-std::array<float,2>{0.180338249f, 0.419158101f},
-std::array<float,2>{0.779950976f, 0.986537516f},
-std::array<float,2>{0.636779308f, 0.267850041f},
-std::array<float,2>{0.386372864f, 0.755207121f},
-std::array<float,2>{0.0945694447f, 0.0617298447f},
-std::array<float,2>{0.920503795f, 0.578754544f},
-std::array<float,2>{0.758624136f, 0.156927839f},
-std::array<float,2>{0.158584237f, 0.680496156f},
-std::array<float,2>{0.302001029f, 0.403240442f},
-std::array<float,2>{0.546885729f, 0.945665479f},
-std::array<float,2>{0.992550373f, 0.498746812f},
-std::array<float,2>{0.0519096591f, 0.899145305f},
-std::array<float,2>{0.460721403f, 0.20507887f},
-std::array<float,2>{0.727697015f, 0.722602725f},
-std::array<float,2>{0.56831646f, 0.0995785818f},
-std::array<float,2>{0.321655601f, 0.54903084f},
-std::array<float,2>{0.234905437f, 0.359588355f},
-std::array<float,2>{0.814441204f, 0.845830321f},
-std::array<float,2>{0.505807221f, 0.432620555f},
-std::array<float,2>{0.261184454f, 0.970857203f},
-std::array<float,2>{0.13724339f, 0.145235956f},
-std::array<float,2>{0.80145359f, 0.639454365f},
-std::array<float,2>{0.877512634f, 0.0104649365f},
-std::array<float,2>{0.085477218f, 0.613454044f},
-std::array<float,2>{0.409226f, 0.293267936f},
-std::array<float,2>{0.67424345f, 0.801800489f},
-std::array<float,2>{0.865182281f, 0.34100461f},
-std::array<float,2>{0.215558648f, 0.829598606f},
-std::array<float,2>{0.345313728f, 0.0771610811f},
-std::array<float,2>{0.606043637f, 0.509637475f},
-std::array<float,2>{0.690177977f, 0.234396055f},
-std::array<float,2>{0.492311627f, 0.689397097f},
-std::array<float,2>{0.0196787678f, 0.460206598f},
-std::array<float,2>{0.961522698f, 0.920998693f},
-std::array<float,2>{0.561653972f, 0.282876253f},
-std::array<float,2>{0.3057096f, 0.807772756f},
-std::array<float,2>{0.169249088f, 0.000901433756f},
-std::array<float,2>{0.755331159f, 0.623823643f},
-std::array<float,2>{0.906849146f, 0.154263124f},
-std::array<float,2>{0.104006931f, 0.629898787f},
-std::array<float,2>{0.376892358f, 0.429133087f},
-std::array<float,2>{0.6309219f, 0.980712771f},
-std::array<float,2>{0.82592237f, 0.468438685f},
-std::array<float,2>{0.244175792f, 0.913832605f},
-std::array<float,2>{0.317041695f, 0.248441488f},
-std::array<float,2>{0.577382922f, 0.698861659f},
-std::array<float,2>{0.724327743f, 0.0673475862f},
-std::array<float,2>{0.467229038f, 0.502027214f},
-std::array<float,2>{0.0617925972f, 0.335842997f},
-std::array<float,2>{0.990148067f, 0.836570024f},
-std::array<float,2>{0.685358167f, 0.393920869f},
-std::array<float,2>{0.417042524f, 0.941777527f},
-std::array<float,2>{0.0866805911f, 0.171867818f},
-std::array<float,2>{0.886700332f, 0.675136685f},
-std::array<float,2>{0.811605632f, 0.0538895205f},
-std::array<float,2>{0.125502765f, 0.592767298f},
-std::array<float,2>{0.251228273f, 0.278701991f},
-std::array<float,2>{0.512468159f, 0.760873973f},
-std::array<float,2>{0.959133744f, 0.369735181f},
-std::array<float,2>{0.0272286665f, 0.854257882f},
-std::array<float,2>{0.484423041f, 0.103000708f},
-std::array<float,2>{0.701504052f, 0.559958279f},
-std::array<float,2>{0.594156563f, 0.217760384f},
-std::array<float,2>{0.353851616f, 0.728326499f},
-std::array<float,2>{0.210200176f, 0.487944245f},
-std::array<float,2>{0.870191753f, 0.897069097f},
-std::array<float,2>{0.715195477f, 0.320529014f},
-std::array<float,2>{0.47430563f, 0.814217746f},
-std::array<float,2>{0.00557474233f, 0.0856016874f},
-std::array<float,2>{0.938107669f, 0.521081269f},
-std::array<float,2>{0.84671098f, 0.219805568f},
-std::array<float,2>{0.202435523f, 0.705383956f},
-std::array<float,2>{0.362575918f, 0.446628094f},
-std::array<float,2>{0.609958351f, 0.923993647f},
-std::array<float,2>{0.902865708f, 0.406644374f},
-std::array<float,2>{0.0772951394f, 0.992458701f},
-std::array<float,2>{0.429218084f, 0.138936311f},
-std::array<float,2>{0.661939144f, 0.644715607f},
-std::array<float,2>{0.518527746f, 0.0278495122f},
-std::array<float,2>{0.274722636f, 0.596394241f},
-std::array<float,2>{0.145129606f, 0.303612441f},
-std::array<float,2>{0.789406955f, 0.794740975f},
-std::array<float,2>{0.588434696f, 0.480506182f},
-std::array<float,2>{0.334901065f, 0.885678589f},
-std::array<float,2>{0.228449881f, 0.201754853f},
-std::array<float,2>{0.838310897f, 0.737160623f},
-std::array<float,2>{0.972640514f, 0.109669782f},
-std::array<float,2>{0.045324333f, 0.545023024f},
-std::array<float,2>{0.439747244f, 0.346437663f},
-std::array<float,2>{0.735668361f, 0.862221301f},
-std::array<float,2>{0.767429948f, 0.255838633f},
-std::array<float,2>{0.173413455f, 0.770903528f},
-std::array<float,2>{0.286934257f, 0.0351027325f},
-std::array<float,2>{0.546151578f, 0.574756503f},
-std::array<float,2>{0.651295602f, 0.180406168f},
-std::array<float,2>{0.393357396f, 0.658404827f},
-std::array<float,2>{0.115271479f, 0.377291948f},
-std::array<float,2>{0.925635517f, 0.956457615f},
-std::array<float,2>{0.527961314f, 0.329332173f},
-std::array<float,2>{0.265965313f, 0.840867996f},
-std::array<float,2>{0.152832165f, 0.0641207099f},
-std::array<float,2>{0.786045313f, 0.506746888f},
-std::array<float,2>{0.895088553f, 0.245342895f},
-std::array<float,2>{0.0644294694f, 0.700476527f},
-std::array<float,2>{0.433174789f, 0.462400436f},
-std::array<float,2>{0.665021718f, 0.907561839f},
-std::array<float,2>{0.858821154f, 0.425440282f},
-std::array<float,2>{0.190462723f, 0.97911042f},
-std::array<float,2>{0.36793977f, 0.148807138f},
-std::array<float,2>{0.619598746f, 0.625926673f},
-std::array<float,2>{0.703825355f, 0.00635773642f},
-std::array<float,2>{0.477179259f, 0.619873524f},
-std::array<float,2>{0.0142677985f, 0.287668943f},
-std::array<float,2>{0.949259162f, 0.811717153f},
-std::array<float,2>{0.64239192f, 0.489054054f},
-std::array<float,2>{0.398792505f, 0.893994927f},
-std::array<float,2>{0.123686887f, 0.211749151f},
-std::array<float,2>{0.931491137f, 0.732015729f},
-std::array<float,2>{0.776951253f, 0.108949974f},
-std::array<float,2>{0.186020955f, 0.555447638f},
-std::array<float,2>{0.296420217f, 0.373470813f},
-std::array<float,2>{0.532211542f, 0.855928779f},
-std::array<float,2>{0.979906738f, 0.276733965f},
-std::array<float,2>{0.0347979404f, 0.763123214f},
-std::array<float,2>{0.446951836f, 0.0485147238f},
-std::array<float,2>{0.743758082f, 0.588530183f},
-std::array<float,2>{0.583695471f, 0.167393595f},
-std::array<float,2>{0.342776418f, 0.679604053f},
-std::array<float,2>{0.222800642f, 0.395412713f},
-std::array<float,2>{0.828453958f, 0.939671516f},
-std::array<float,2>{0.730471253f, 0.29861182f},
-std::array<float,2>{0.453165144f, 0.791291595f},
-std::array<float,2>{0.049047336f, 0.0273236781f},
-std::array<float,2>{0.997053087f, 0.601246178f},
-std::array<float,2>{0.819939196f, 0.13515605f},
-std::array<float,2>{0.23835288f, 0.64220798f},
-std::array<float,2>{0.326694757f, 0.410795987f},
-std::array<float,2>{0.56455344f, 0.997784913f},
-std::array<float,2>{0.914845586f, 0.451788425f},
-std::array<float,2>{0.100737996f, 0.926069558f},
-std::array<float,2>{0.389767885f, 0.226439029f},
-std::array<float,2>{0.636429667f, 0.707147837f},
-std::array<float,2>{0.552012563f, 0.0811549276f},
-std::array<float,2>{0.300698757f, 0.519143224f},
-std::array<float,2>{0.161258936f, 0.325930715f},
-std::array<float,2>{0.762759328f, 0.819054127f},
-std::array<float,2>{0.603590786f, 0.380001098f},
-std::array<float,2>{0.350446224f, 0.958825111f},
-std::array<float,2>{0.213169858f, 0.18442215f},
-std::array<float,2>{0.859555602f, 0.662356675f},
-std::array<float,2>{0.968173265f, 0.0356194638f},
-std::array<float,2>{0.0176000036f, 0.572647095f},
-std::array<float,2>{0.496903062f, 0.252071261f},
-std::array<float,2>{0.692352533f, 0.76884371f},
-std::array<float,2>{0.79804188f, 0.347866088f},
-std::array<float,2>{0.133960113f, 0.86517185f},
-std::array<float,2>{0.264786333f, 0.114492193f},
-std::array<float,2>{0.503373981f, 0.542579412f},
-std::array<float,2>{0.676596463f, 0.198098645f},
-std::array<float,2>{0.411543787f, 0.738661766f},
-std::array<float,2>{0.0790426582f, 0.480034262f},
-std::array<float,2>{0.880318761f, 0.887671053f},
-std::array<float,2>{0.572491705f, 0.26486814f},
-std::array<float,2>{0.314196467f, 0.780066013f},
-std::array<float,2>{0.247192875f, 0.0415334478f},
-std::array<float,2>{0.820884168f, 0.562564969f},
-std::array<float,2>{0.985883296f, 0.172889829f},
-std::array<float,2>{0.0548225231f, 0.666235864f},
-std::array<float,2>{0.46246168f, 0.383552074f},
-std::array<float,2>{0.718825042f, 0.963544726f},
-std::array<float,2>{0.750281811f, 0.475368172f},
-std::array<float,2>{0.166813269f, 0.877534449f},
-std::array<float,2>{0.308650672f, 0.193246946f},
-std::array<float,2>{0.554920495f, 0.742620647f},
-std::array<float,2>{0.626105547f, 0.12432798f},
-std::array<float,2>{0.382382005f, 0.534540653f},
-std::array<float,2>{0.106215626f, 0.353008628f},
-std::array<float,2>{0.913698435f, 0.873760939f},
-std::array<float,2>{0.698353887f, 0.417263687f},
-std::array<float,2>{0.490226746f, 0.989533663f},
-std::array<float,2>{0.0301158447f, 0.129312098f},
-std::array<float,2>{0.955096185f, 0.653626502f},
-std::array<float,2>{0.871113241f, 0.0209037475f},
-std::array<float,2>{0.20470804f, 0.603730738f},
-std::array<float,2>{0.357977122f, 0.309130937f},
-std::array<float,2>{0.599626601f, 0.78623414f},
-std::array<float,2>{0.888760924f, 0.316394478f},
-std::array<float,2>{0.0921970457f, 0.821267843f},
-std::array<float,2>{0.419131041f, 0.0879557729f},
-std::array<float,2>{0.682327986f, 0.529248834f},
-std::array<float,2>{0.510438204f, 0.232529864f},
-std::array<float,2>{0.255521595f, 0.714276552f},
-std::array<float,2>{0.131738514f, 0.437520504f},
-std::array<float,2>{0.807807744f, 0.933460891f},
-std::array<float,2>{0.657514811f, 0.36332795f},
-std::array<float,2>{0.42370078f, 0.849192798f},
-std::array<float,2>{0.0717797279f, 0.0939321294f},
-std::array<float,2>{0.901259005f, 0.551627994f},
-std::array<float,2>{0.796224952f, 0.21018061f},
-std::array<float,2>{0.142799363f, 0.724336565f},
-std::array<float,2>{0.278522164f, 0.495713383f},
-std::array<float,2>{0.520623803f, 0.90277034f},
-std::array<float,2>{0.943962038f, 0.39886266f},
-std::array<float,2>{0.00137313048f, 0.951235771f},
-std::array<float,2>{0.468804002f, 0.160333812f},
-std::array<float,2>{0.713768363f, 0.685443342f},
-std::array<float,2>{0.615136683f, 0.0573755689f},
-std::array<float,2>{0.363532364f, 0.584191561f},
-std::array<float,2>{0.19616057f, 0.271291733f},
-std::array<float,2>{0.851132274f, 0.752624035f},
-std::array<float,2>{0.54113996f, 0.453630477f},
-std::array<float,2>{0.281706184f, 0.916516006f},
-std::array<float,2>{0.176590919f, 0.239823312f},
-std::array<float,2>{0.770462632f, 0.693554878f},
-std::array<float,2>{0.927597404f, 0.0728836358f},
-std::array<float,2>{0.111798212f, 0.511771262f},
-std::array<float,2>{0.396537125f, 0.336617291f},
-std::array<float,2>{0.653187752f, 0.833961189f},
-std::array<float,2>{0.841956556f, 0.290680319f},
-std::array<float,2>{0.23123084f, 0.799776137f},
-std::array<float,2>{0.330457449f, 0.011914188f},
-std::array<float,2>{0.592776418f, 0.61048007f},
-std::array<float,2>{0.74192661f, 0.141778007f},
-std::array<float,2>{0.443344265f, 0.636562526f},
-std::array<float,2>{0.0402798131f, 0.437188148f},
-std::array<float,2>{0.974097133f, 0.976120234f},
-std::array<float,2>{0.609658659f, 0.324104637f},
-std::array<float,2>{0.363165885f, 0.815062046f},
-std::array<float,2>{0.202713042f, 0.0821214095f},
-std::array<float,2>{0.847558022f, 0.522502124f},
-std::array<float,2>{0.937696099f, 0.222575262f},
-std::array<float,2>{0.00519198179f, 0.704937458f},
-std::array<float,2>{0.47366029f, 0.448760808f},
-std::array<float,2>{0.715642452f, 0.921962678f},
-std::array<float,2>{0.789947391f, 0.408590764f},
-std::array<float,2>{0.144658238f, 0.994311273f},
-std::array<float,2>{0.275126874f, 0.137844011f},
-std::array<float,2>{0.517954469f, 0.646988869f},
-std::array<float,2>{0.661489785f, 0.0294483937f},
-std::array<float,2>{0.428838253f, 0.595462084f},
-std::array<float,2>{0.0778768808f, 0.300930828f},
-std::array<float,2>{0.902398884f, 0.7949332f},
-std::array<float,2>{0.736196101f, 0.48373878f},
-std::array<float,2>{0.440121442f, 0.882932365f},
-std::array<float,2>{0.0458548181f, 0.199259743f},
-std::array<float,2>{0.972121358f, 0.735961258f},
-std::array<float,2>{0.838552535f, 0.11302761f},
-std::array<float,2>{0.227845371f, 0.543038368f},
-std::array<float,2>{0.334186912f, 0.344180435f},
-std::array<float,2>{0.588276029f, 0.86035943f},
-std::array<float,2>{0.925208509f, 0.257288426f},
-std::array<float,2>{0.11610017f, 0.773308575f},
-std::array<float,2>{0.392658263f, 0.0327992402f},
-std::array<float,2>{0.650706053f, 0.576549947f},
-std::array<float,2>{0.546524465f, 0.181853041f},
-std::array<float,2>{0.28613919f, 0.6572752f},
-std::array<float,2>{0.172955945f, 0.376161754f},
-std::array<float,2>{0.766716957f, 0.953524172f},
-std::array<float,2>{0.631820321f, 0.284511268f},
-std::array<float,2>{0.376147926f, 0.806589484f},
-std::array<float,2>{0.103529163f, 0.00266574114f},
-std::array<float,2>{0.906481981f, 0.622817993f},
-std::array<float,2>{0.755478978f, 0.156131536f},
-std::array<float,2>{0.169694886f, 0.631120503f},
-std::array<float,2>{0.30655849f, 0.427323669f},
-std::array<float,2>{0.562379301f, 0.983067334f},
-std::array<float,2>{0.989658713f, 0.465080649f},
-std::array<float,2>{0.0621169396f, 0.911581397f},
-std::array<float,2>{0.467424124f, 0.247614875f},
-std::array<float,2>{0.723726511f, 0.695676267f},
-std::array<float,2>{0.577929497f, 0.0696741045f},
-std::array<float,2>{0.316748977f, 0.500346065f},
-std::array<float,2>{0.244761378f, 0.332091719f},
-std::array<float,2>{0.825260401f, 0.838778436f},
-std::array<float,2>{0.511848629f, 0.391757131f},
-std::array<float,2>{0.251616478f, 0.944520056f},
-std::array<float,2>{0.125269607f, 0.16889514f},
-std::array<float,2>{0.812452376f, 0.672334552f},
-std::array<float,2>{0.886192441f, 0.050972838f},
-std::array<float,2>{0.0862031132f, 0.59002465f},
-std::array<float,2>{0.417674065f, 0.279687911f},
-std::array<float,2>{0.685011148f, 0.757819116f},
-std::array<float,2>{0.87086457f, 0.367681473f},
-std::array<float,2>{0.210875198f, 0.852357388f},
-std::array<float,2>{0.354210049f, 0.103564128f},
-std::array<float,2>{0.594546199f, 0.562264562f},
-std::array<float,2>{0.701868474f, 0.216735333f},
-std::array<float,2>{0.484873772f, 0.729685128f},
-std::array<float,2>{0.0264023989f, 0.484833419f},
-std::array<float,2>{0.959824502f, 0.894645095f},
-std::array<float,2>{0.547679961f, 0.267297268f},
-std::array<float,2>{0.302719921f, 0.755965889f},
-std::array<float,2>{0.158728883f, 0.058957573f},
-std::array<float,2>{0.758159101f, 0.580271661f},
-std::array<float,2>{0.920329034f, 0.159274429f},
-std::array<float,2>{0.0942325443f, 0.68285507f},
-std::array<float,2>{0.385988504f, 0.405292034f},
-std::array<float,2>{0.637213945f, 0.948850751f},
-std::array<float,2>{0.813855827f, 0.496194571f},
-std::array<float,2>{0.234479025f, 0.902073324f},
-std::array<float,2>{0.321896285f, 0.203456253f},
-std::array<float,2>{0.567742467f, 0.718861639f},
-std::array<float,2>{0.728129983f, 0.100510262f},
-std::array<float,2>{0.460447222f, 0.548089623f},
-std::array<float,2>{0.0524218641f, 0.362097502f},
-std::array<float,2>{0.993106961f, 0.845224023f},
-std::array<float,2>{0.674710274f, 0.430664599f},
-std::array<float,2>{0.410110384f, 0.969477773f},
-std::array<float,2>{0.0852457881f, 0.146485239f},
-std::array<float,2>{0.877264082f, 0.638353288f},
-std::array<float,2>{0.801126838f, 0.00790199824f},
-std::array<float,2>{0.136848971f, 0.616873682f},
-std::array<float,2>{0.261658013f, 0.295856625f},
-std::array<float,2>{0.505144894f, 0.802981675f},
-std::array<float,2>{0.961376309f, 0.341821969f},
-std::array<float,2>{0.0202775896f, 0.830301583f},
-std::array<float,2>{0.492965072f, 0.0761188492f},
-std::array<float,2>{0.689616144f, 0.509899318f},
-std::array<float,2>{0.605539739f, 0.2367419f},
-std::array<float,2>{0.345154077f, 0.690203786f},
-std::array<float,2>{0.214890167f, 0.457864255f},
-std::array<float,2>{0.864302158f, 0.918466091f},
-std::array<float,2>{0.710598469f, 0.358548045f},
-std::array<float,2>{0.4834598f, 0.870485783f},
-std::array<float,2>{0.0102803595f, 0.118518084f},
-std::array<float,2>{0.947337806f, 0.536415875f},
-std::array<float,2>{0.854114473f, 0.188377246f},
-std::array<float,2>{0.193596825f, 0.747221828f},
-std::array<float,2>{0.373806775f, 0.470301956f},
-std::array<float,2>{0.622480035f, 0.879893959f},
-std::array<float,2>{0.894210637f, 0.388346702f},
-std::array<float,2>{0.0687778294f, 0.96774739f},
-std::array<float,2>{0.437296808f, 0.178318307f},
-std::array<float,2>{0.668552458f, 0.669109225f},
-std::array<float,2>{0.527071714f, 0.0430948064f},
-std::array<float,2>{0.272371799f, 0.566826105f},
-std::array<float,2>{0.151751697f, 0.261051625f},
-std::array<float,2>{0.781313777f, 0.774120867f},
-std::array<float,2>{0.581004977f, 0.444829375f},
-std::array<float,2>{0.339552134f, 0.936251163f},
-std::array<float,2>{0.22261472f, 0.227806717f},
-std::array<float,2>{0.832044721f, 0.718094528f},
-std::array<float,2>{0.981999218f, 0.0932299644f},
-std::array<float,2>{0.0351911373f, 0.526892722f},
-std::array<float,2>{0.452034175f, 0.318173528f},
-std::array<float,2>{0.749301195f, 0.825497925f},
-std::array<float,2>{0.779680133f, 0.306507736f},
-std::array<float,2>{0.180013999f, 0.784505546f},
-std::array<float,2>{0.289304882f, 0.0183540508f},
-std::array<float,2>{0.536710918f, 0.607598841f},
-std::array<float,2>{0.644647837f, 0.126243547f},
-std::array<float,2>{0.405712992f, 0.6513592f},
-std::array<float,2>{0.119117163f, 0.420526624f},
-std::array<float,2>{0.934291244f, 0.985629022f},
-std::array<float,2>{0.521450877f, 0.366504341f},
-std::array<float,2>{0.279185891f, 0.851200879f},
-std::array<float,2>{0.143523216f, 0.0961675569f},
-std::array<float,2>{0.796646893f, 0.552768588f},
-std::array<float,2>{0.90058285f, 0.207604706f},
-std::array<float,2>{0.0715742037f, 0.726102769f},
-std::array<float,2>{0.42319411f, 0.494100511f},
-std::array<float,2>{0.658198535f, 0.906201303f},
-std::array<float,2>{0.851007462f, 0.400927782f},
-std::array<float,2>{0.195534691f, 0.950887382f},
-std::array<float,2>{0.364060938f, 0.163157508f},
-std::array<float,2>{0.614273369f, 0.68610394f},
-std::array<float,2>{0.713221967f, 0.0554702319f},
-std::array<float,2>{0.469239324f, 0.582725048f},
-std::array<float,2>{0.00157473679f, 0.273109466f},
-std::array<float,2>{0.943680644f, 0.751809239f},
-std::array<float,2>{0.65249896f, 0.456811488f},
-std::array<float,2>{0.397253036f, 0.915411413f},
-std::array<float,2>{0.112158656f, 0.241388634f},
-std::array<float,2>{0.926817298f, 0.691588223f},
-std::array<float,2>{0.769703627f, 0.0712600574f},
-std::array<float,2>{0.176228434f, 0.514119685f},
-std::array<float,2>{0.282079458f, 0.338918418f},
-std::array<float,2>{0.541860402f, 0.834778666f},
-std::array<float,2>{0.974601448f, 0.291861057f},
-std::array<float,2>{0.0408637524f, 0.797682106f},
-std::array<float,2>{0.442786872f, 0.0155057926f},
-std::array<float,2>{0.741654158f, 0.612514794f},
-std::array<float,2>{0.593743324f, 0.143551916f},
-std::array<float,2>{0.330756992f, 0.634327054f},
-std::array<float,2>{0.230777979f, 0.43444261f},
-std::array<float,2>{0.842335105f, 0.974361658f},
-std::array<float,2>{0.719384253f, 0.26185894f},
-std::array<float,2>{0.462142527f, 0.777666926f},
-std::array<float,2>{0.0552871674f, 0.0405101739f},
-std::array<float,2>{0.985772252f, 0.564464748f},
-std::array<float,2>{0.82061094f, 0.175281182f},
-std::array<float,2>{0.248017609f, 0.664262593f},
-std::array<float,2>{0.31395641f, 0.38581422f},
-std::array<float,2>{0.572791457f, 0.960976779f},
-std::array<float,2>{0.91353339f, 0.474456161f},
-std::array<float,2>{0.105691031f, 0.875113368f},
-std::array<float,2>{0.382120937f, 0.194499239f},
-std::array<float,2>{0.626847982f, 0.744919777f},
-std::array<float,2>{0.555296004f, 0.122859456f},
-std::array<float,2>{0.309154838f, 0.532976866f},
-std::array<float,2>{0.166083395f, 0.354172558f},
-std::array<float,2>{0.750532091f, 0.871173739f},
-std::array<float,2>{0.600217521f, 0.414885938f},
-std::array<float,2>{0.35744679f, 0.991097987f},
-std::array<float,2>{0.204222083f, 0.132211849f},
-std::array<float,2>{0.8719607f, 0.655531943f},
-std::array<float,2>{0.955909431f, 0.023434693f},
-std::array<float,2>{0.02973249f, 0.602973759f},
-std::array<float,2>{0.489714533f, 0.311865777f},
-std::array<float,2>{0.698781192f, 0.787250459f},
-std::array<float,2>{0.808367968f, 0.314056724f},
-std::array<float,2>{0.130937845f, 0.823051035f},
-std::array<float,2>{0.254942328f, 0.0864315927f},
-std::array<float,2>{0.510054171f, 0.529337168f},
-std::array<float,2>{0.682018101f, 0.231368884f},
-std::array<float,2>{0.419457197f, 0.711287618f},
-std::array<float,2>{0.0927047133f, 0.440738499f},
-std::array<float,2>{0.889189065f, 0.929889381f},
-std::array<float,2>{0.564963698f, 0.299254417f},
-std::array<float,2>{0.32664147f, 0.789798677f},
-std::array<float,2>{0.239253506f, 0.0242712796f},
-std::array<float,2>{0.819522977f, 0.598291099f},
-std::array<float,2>{0.996301413f, 0.134152755f},
-std::array<float,2>{0.049691353f, 0.644337296f},
-std::array<float,2>{0.453707784f, 0.412897021f},
-std::array<float,2>{0.731272697f, 0.999165714f},
-std::array<float,2>{0.763246238f, 0.450526088f},
-std::array<float,2>{0.161924273f, 0.929463327f},
-std::array<float,2>{0.300151855f, 0.22276853f},
-std::array<float,2>{0.552554846f, 0.709372878f},
-std::array<float,2>{0.636215687f, 0.0781424344f},
-std::array<float,2>{0.390249491f, 0.515735865f},
-std::array<float,2>{0.101137415f, 0.328104526f},
-std::array<float,2>{0.914370894f, 0.817356765f},
-std::array<float,2>{0.691476405f, 0.382754594f},
-std::array<float,2>{0.496442109f, 0.960772216f},
-std::array<float,2>{0.0181375071f, 0.187190756f},
-std::array<float,2>{0.968721092f, 0.660228908f},
-std::array<float,2>{0.859995425f, 0.0386731662f},
-std::array<float,2>{0.213485077f, 0.571431398f},
-std::array<float,2>{0.349779636f, 0.250246346f},
-std::array<float,2>{0.60405463f, 0.765922964f},
-std::array<float,2>{0.880774677f, 0.350421786f},
-std::array<float,2>{0.0782128945f, 0.866665483f},
-std::array<float,2>{0.411906868f, 0.116826482f},
-std::array<float,2>{0.676101327f, 0.53990972f},
-std::array<float,2>{0.50359267f, 0.19571127f},
-std::array<float,2>{0.265270203f, 0.741868854f},
-std::array<float,2>{0.134290829f, 0.477695584f},
-std::array<float,2>{0.798619211f, 0.89038986f},
-std::array<float,2>{0.664120018f, 0.330898643f},
-std::array<float,2>{0.432861805f, 0.843697011f},
-std::array<float,2>{0.0635553524f, 0.0654404908f},
-std::array<float,2>{0.894836187f, 0.505014539f},
-std::array<float,2>{0.785455525f, 0.242720559f},
-std::array<float,2>{0.152380228f, 0.703014314f},
-std::array<float,2>{0.266439497f, 0.463948458f},
-std::array<float,2>{0.52764535f, 0.908691823f},
-std::array<float,2>{0.950162113f, 0.423049062f},
-std::array<float,2>{0.013825262f, 0.978298843f},
-std::array<float,2>{0.476901978f, 0.151275814f},
-std::array<float,2>{0.703341544f, 0.627704382f},
-std::array<float,2>{0.619928181f, 0.00410767971f},
-std::array<float,2>{0.367276579f, 0.618392169f},
-std::array<float,2>{0.191184983f, 0.285527468f},
-std::array<float,2>{0.859041333f, 0.810019612f},
-std::array<float,2>{0.531430185f, 0.49024573f},
-std::array<float,2>{0.296102226f, 0.892028391f},
-std::array<float,2>{0.186175734f, 0.214281604f},
-std::array<float,2>{0.776753008f, 0.733290374f},
-std::array<float,2>{0.930987895f, 0.107399911f},
-std::array<float,2>{0.123264611f, 0.557697535f},
-std::array<float,2>{0.399247974f, 0.372887522f},
-std::array<float,2>{0.641945601f, 0.85820806f},
-std::array<float,2>{0.828974128f, 0.274162471f},
-std::array<float,2>{0.22327958f, 0.765492022f},
-std::array<float,2>{0.343396693f, 0.0505060591f},
-std::array<float,2>{0.583422124f, 0.587361753f},
-std::array<float,2>{0.743271649f, 0.16582717f},
-std::array<float,2>{0.446754724f, 0.676125109f},
-std::array<float,2>{0.0345486365f, 0.398103088f},
-std::array<float,2>{0.980286539f, 0.937788486f},
-std::array<float,2>{0.587454736f, 0.346025586f},
-std::array<float,2>{0.333501905f, 0.861663043f},
-std::array<float,2>{0.229733378f, 0.11030446f},
-std::array<float,2>{0.837866545f, 0.545687675f},
-std::array<float,2>{0.969059765f, 0.201621845f},
-std::array<float,2>{0.0430343896f, 0.736680746f},
-std::array<float,2>{0.437975734f, 0.481307626f},
-std::array<float,2>{0.737532735f, 0.884845197f},
-std::array<float,2>{0.768746078f, 0.377682328f},
-std::array<float,2>{0.174105033f, 0.956716061f},
-std::array<float,2>{0.287332922f, 0.179939181f},
-std::array<float,2>{0.543323994f, 0.659115613f},
-std::array<float,2>{0.649834335f, 0.0342148244f},
-std::array<float,2>{0.390725553f, 0.574383199f},
-std::array<float,2>{0.113544486f, 0.255310059f},
-std::array<float,2>{0.923079848f, 0.771193743f},
-std::array<float,2>{0.718241572f, 0.447172433f},
-std::array<float,2>{0.47536239f, 0.92473495f},
-std::array<float,2>{0.00651724497f, 0.220466956f},
-std::array<float,2>{0.939833403f, 0.705922723f},
-std::array<float,2>{0.845030487f, 0.0853077173f},
-std::array<float,2>{0.200343043f, 0.520649433f},
-std::array<float,2>{0.359970063f, 0.32081154f},
-std::array<float,2>{0.612363636f, 0.813604057f},
-std::array<float,2>{0.90526402f, 0.30295682f},
-std::array<float,2>{0.0744805038f, 0.794303179f},
-std::array<float,2>{0.42598027f, 0.0273549128f},
-std::array<float,2>{0.66288501f, 0.595819712f},
-std::array<float,2>{0.516768157f, 0.139353976f},
-std::array<float,2>{0.27588594f, 0.645244479f},
-std::array<float,2>{0.146833584f, 0.406819701f},
-std::array<float,2>{0.791857421f, 0.993058622f},
-std::array<float,2>{0.686398685f, 0.27910468f},
-std::array<float,2>{0.414103031f, 0.761578918f},
-std::array<float,2>{0.0882408246f, 0.0544269569f},
-std::array<float,2>{0.883336067f, 0.592268765f},
-std::array<float,2>{0.809554577f, 0.171247169f},
-std::array<float,2>{0.128582165f, 0.67571187f},
-std::array<float,2>{0.25380981f, 0.394067675f},
-std::array<float,2>{0.513962507f, 0.942209244f},
-std::array<float,2>{0.957671225f, 0.487650305f},
-std::array<float,2>{0.023447223f, 0.896790922f},
-std::array<float,2>{0.487729281f, 0.217202693f},
-std::array<float,2>{0.700226068f, 0.728017569f},
-std::array<float,2>{0.595913768f, 0.1034628f},
-std::array<float,2>{0.352266699f, 0.560499072f},
-std::array<float,2>{0.208120629f, 0.369164079f},
-std::array<float,2>{0.868105769f, 0.853845477f},
-std::array<float,2>{0.559323192f, 0.429468602f},
-std::array<float,2>{0.307889789f, 0.981116891f},
-std::array<float,2>{0.170549244f, 0.153615132f},
-std::array<float,2>{0.757059216f, 0.630614758f},
-std::array<float,2>{0.909700453f, 0.000304388377f},
-std::array<float,2>{0.102595016f, 0.62327373f},
-std::array<float,2>{0.377854139f, 0.282529861f},
-std::array<float,2>{0.629155755f, 0.808320999f},
-std::array<float,2>{0.826262832f, 0.335187674f},
-std::array<float,2>{0.242873117f, 0.835999787f},
-std::array<float,2>{0.318366885f, 0.0668700263f},
-std::array<float,2>{0.575195491f, 0.50259304f},
-std::array<float,2>{0.725570738f, 0.248865113f},
-std::array<float,2>{0.465034306f, 0.698529422f},
-std::array<float,2>{0.0589615218f, 0.467890352f},
-std::array<float,2>{0.99087429f, 0.913311899f},
-std::array<float,2>{0.506632626f, 0.293538898f},
-std::array<float,2>{0.25798589f, 0.802388489f},
-std::array<float,2>{0.138923392f, 0.0101569351f},
-std::array<float,2>{0.803165495f, 0.614051759f},
-std::array<float,2>{0.876515031f, 0.144545391f},
-std::array<float,2>{0.0821615905f, 0.638969898f},
-std::array<float,2>{0.407010704f, 0.433548659f},
-std::array<float,2>{0.672594965f, 0.971571445f},
-std::array<float,2>{0.867089868f, 0.460553288f},
-std::array<float,2>{0.217188492f, 0.921446383f},
-std::array<float,2>{0.346089602f, 0.234865338f},
-std::array<float,2>{0.609333038f, 0.688584089f},
-std::array<float,2>{0.688889921f, 0.0780012608f},
-std::array<float,2>{0.495108247f, 0.508897603f},
-std::array<float,2>{0.0233057197f, 0.341540366f},
-std::array<float,2>{0.964316249f, 0.829514146f},
-std::array<float,2>{0.639749169f, 0.402801543f},
-std::array<float,2>{0.384513259f, 0.946279407f},
-std::array<float,2>{0.0972811207f, 0.156337857f},
-std::array<float,2>{0.918353856f, 0.679820955f},
-std::array<float,2>{0.760305166f, 0.0624192767f},
-std::array<float,2>{0.157953009f, 0.57826221f},
-std::array<float,2>{0.303458661f, 0.268543243f},
-std::array<float,2>{0.549807012f, 0.755553305f},
-std::array<float,2>{0.995586514f, 0.360139728f},
-std::array<float,2>{0.0533330292f, 0.846310437f},
-std::array<float,2>{0.457788348f, 0.0988581106f},
-std::array<float,2>{0.729808509f, 0.549377084f},
-std::array<float,2>{0.570125997f, 0.205586568f},
-std::array<float,2>{0.322691292f, 0.721718669f},
-std::array<float,2>{0.238212526f, 0.498404086f},
-std::array<float,2>{0.816214323f, 0.898917675f},
-std::array<float,2>{0.748035789f, 0.319963664f},
-std::array<float,2>{0.45108214f, 0.827554464f},
-std::array<float,2>{0.0388644375f, 0.0917167589f},
-std::array<float,2>{0.983911812f, 0.5236184f},
-std::array<float,2>{0.834144711f, 0.228594705f},
-std::array<float,2>{0.218787715f, 0.716619313f},
-std::array<float,2>{0.337737769f, 0.442864388f},
-std::array<float,2>{0.578845024f, 0.935033023f},
-std::array<float,2>{0.937294781f, 0.419576526f},
-std::array<float,2>{0.12090458f, 0.986903727f},
-std::array<float,2>{0.403286159f, 0.128169999f},
-std::array<float,2>{0.64757973f, 0.649748206f},
-std::array<float,2>{0.538120449f, 0.0164140947f},
-std::array<float,2>{0.292717189f, 0.607302129f},
-std::array<float,2>{0.182844743f, 0.307775766f},
-std::array<float,2>{0.778727174f, 0.781988978f},
-std::array<float,2>{0.623110652f, 0.471921653f},
-std::array<float,2>{0.372574091f, 0.882197797f},
-std::array<float,2>{0.192231178f, 0.190186128f},
-std::array<float,2>{0.853126466f, 0.748834729f},
-std::array<float,2>{0.946783662f, 0.119186975f},
-std::array<float,2>{0.00899279397f, 0.537943065f},
-std::array<float,2>{0.481653512f, 0.357133478f},
-std::array<float,2>{0.708476901f, 0.86724931f},
-std::array<float,2>{0.784206688f, 0.258977681f},
-std::array<float,2>{0.149151117f, 0.776569426f},
-std::array<float,2>{0.271215349f, 0.0465633236f},
-std::array<float,2>{0.523492396f, 0.569843113f},
-std::array<float,2>{0.671742558f, 0.17605716f},
-std::array<float,2>{0.434833735f, 0.670999706f},
-std::array<float,2>{0.0672820732f, 0.389598668f},
-std::array<float,2>{0.892026722f, 0.965383649f},
-std::array<float,2>{0.539427638f, 0.336153775f},
-std::array<float,2>{0.284307927f, 0.833048105f},
-std::array<float,2>{0.179521263f, 0.0726960525f},
-std::array<float,2>{0.771656632f, 0.512478888f},
-std::array<float,2>{0.927824557f, 0.239719644f},
-std::array<float,2>{0.109910272f, 0.694105983f},
-std::array<float,2>{0.394816399f, 0.453202814f},
-std::array<float,2>{0.655560374f, 0.916481256f},
-std::array<float,2>{0.840342641f, 0.436838537f},
-std::array<float,2>{0.234202445f, 0.975882947f},
-std::array<float,2>{0.329729587f, 0.14216432f},
-std::array<float,2>{0.590895772f, 0.636095703f},
-std::array<float,2>{0.739025295f, 0.0123290466f},
-std::array<float,2>{0.44347474f, 0.611039698f},
-std::array<float,2>{0.0423973128f, 0.29030779f},
-std::array<float,2>{0.975328505f, 0.799239993f},
-std::array<float,2>{0.658685863f, 0.495304853f},
-std::array<float,2>{0.425048321f, 0.90295285f},
-std::array<float,2>{0.0734427869f, 0.210696131f},
-std::array<float,2>{0.899932504f, 0.724050879f},
-std::array<float,2>{0.793822289f, 0.0944203883f},
-std::array<float,2>{0.14127396f, 0.551067829f},
-std::array<float,2>{0.280628413f, 0.364170581f},
-std::array<float,2>{0.523078859f, 0.848711789f},
-std::array<float,2>{0.94181031f, 0.270863503f},
-std::array<float,2>{0.00238444726f, 0.752129555f},
-std::array<float,2>{0.470857501f, 0.0570140556f},
-std::array<float,2>{0.71194607f, 0.584510684f},
-std::array<float,2>{0.616460323f, 0.160900623f},
-std::array<float,2>{0.367143124f, 0.684879065f},
-std::array<float,2>{0.198035643f, 0.399141043f},
-std::array<float,2>{0.849601924f, 0.951975346f},
-std::array<float,2>{0.696037889f, 0.308717012f},
-std::array<float,2>{0.491453677f, 0.786852241f},
-std::array<float,2>{0.0288280733f, 0.0213185195f},
-std::array<float,2>{0.95478797f, 0.604141593f},
-std::array<float,2>{0.874292016f, 0.12984854f},
-std::array<float,2>{0.206501275f, 0.653872609f},
-std::array<float,2>{0.355581164f, 0.417773336f},
-std::array<float,2>{0.598801672f, 0.99017626f},
-std::array<float,2>{0.887761176f, 0.438219607f},
-std::array<float,2>{0.0915525183f, 0.932637453f},
-std::array<float,2>{0.420740575f, 0.232944116f},
-std::array<float,2>{0.680903733f, 0.714667797f},
-std::array<float,2>{0.508388042f, 0.0883984491f},
-std::array<float,2>{0.256891042f, 0.528358996f},
-std::array<float,2>{0.129468441f, 0.31546855f},
-std::array<float,2>{0.806324065f, 0.820731282f},
-std::array<float,2>{0.571515918f, 0.382994264f},
-std::array<float,2>{0.316164672f, 0.963095427f},
-std::array<float,2>{0.249957085f, 0.173721194f},
-std::array<float,2>{0.823525369f, 0.666942298f},
-std::array<float,2>{0.98799634f, 0.0414296389f},
-std::array<float,2>{0.0571430102f, 0.563400567f},
-std::array<float,2>{0.462988496f, 0.265541852f},
-std::array<float,2>{0.721004784f, 0.779565156f},
-std::array<float,2>{0.752477109f, 0.35323143f},
-std::array<float,2>{0.164881364f, 0.87336278f},
-std::array<float,2>{0.311304837f, 0.124944218f},
-std::array<float,2>{0.557168782f, 0.534862399f},
-std::array<float,2>{0.628353536f, 0.192386895f},
-std::array<float,2>{0.380629718f, 0.742795408f},
-std::array<float,2>{0.109110519f, 0.474900514f},
-std::array<float,2>{0.910778463f, 0.877384722f},
-std::array<float,2>{0.602557957f, 0.252582312f},
-std::array<float,2>{0.348315895f, 0.769050837f},
-std::array<float,2>{0.212128535f, 0.0358320735f},
-std::array<float,2>{0.862526f, 0.573217571f},
-std::array<float,2>{0.965459526f, 0.183944777f},
-std::array<float,2>{0.016431421f, 0.662768185f},
-std::array<float,2>{0.499409348f, 0.380818903f},
-std::array<float,2>{0.693579853f, 0.95804286f},
-std::array<float,2>{0.80042851f, 0.479646981f},
-std::array<float,2>{0.135002285f, 0.887061715f},
-std::array<float,2>{0.261836112f, 0.197425783f},
-std::array<float,2>{0.501525402f, 0.73916328f},
-std::array<float,2>{0.678619266f, 0.115028903f},
-std::array<float,2>{0.413856238f, 0.54228574f},
-std::array<float,2>{0.0815317854f, 0.348209262f},
-std::array<float,2>{0.881908953f, 0.864645779f},
-std::array<float,2>{0.733080745f, 0.410251886f},
-std::array<float,2>{0.456332147f, 0.997115076f},
-std::array<float,2>{0.0484198257f, 0.135562047f},
-std::array<float,2>{0.999807656f, 0.641977489f},
-std::array<float,2>{0.816542029f, 0.0266245604f},
-std::array<float,2>{0.242101371f, 0.601031005f},
-std::array<float,2>{0.325126737f, 0.298302531f},
-std::array<float,2>{0.56421572f, 0.791599452f},
-std::array<float,2>{0.917558491f, 0.325605839f},
-std::array<float,2>{0.0980799273f, 0.818606973f},
-std::array<float,2>{0.38762179f, 0.0816401616f},
-std::array<float,2>{0.634240985f, 0.518591881f},
-std::array<float,2>{0.552885175f, 0.225885451f},
-std::array<float,2>{0.298723578f, 0.707612872f},
-std::array<float,2>{0.162654191f, 0.45158878f},
-std::array<float,2>{0.764804959f, 0.926298797f},
-std::array<float,2>{0.644456863f, 0.373720556f},
-std::array<float,2>{0.401211113f, 0.856042624f},
-std::array<float,2>{0.12278413f, 0.108775392f},
-std::array<float,2>{0.932006717f, 0.554721653f},
-std::array<float,2>{0.775249004f, 0.211210206f},
-std::array<float,2>{0.184549108f, 0.731481433f},
-std::array<float,2>{0.294269294f, 0.48876521f},
-std::array<float,2>{0.533768475f, 0.894212484f},
-std::array<float,2>{0.977102399f, 0.394756049f},
-std::array<float,2>{0.0321295001f, 0.940307558f},
-std::array<float,2>{0.447393149f, 0.167832956f},
-std::array<float,2>{0.74496001f, 0.679132223f},
-std::array<float,2>{0.585570872f, 0.048187051f},
-std::array<float,2>{0.340976626f, 0.587965667f},
-std::array<float,2>{0.224749565f, 0.277324736f},
-std::array<float,2>{0.831353605f, 0.763227344f},
-std::array<float,2>{0.529396296f, 0.46260497f},
-std::array<float,2>{0.267883658f, 0.908195734f},
-std::array<float,2>{0.155136392f, 0.245861039f},
-std::array<float,2>{0.788007319f, 0.700694501f},
-std::array<float,2>{0.898070216f, 0.0639470145f},
-std::array<float,2>{0.0647189096f, 0.506332695f},
-std::array<float,2>{0.431387901f, 0.329638809f},
-std::array<float,2>{0.667626739f, 0.841627181f},
-std::array<float,2>{0.856586814f, 0.287178099f},
-std::array<float,2>{0.188347712f, 0.81217289f},
-std::array<float,2>{0.369594902f, 0.00596883334f},
-std::array<float,2>{0.618243992f, 0.619490445f},
-std::array<float,2>{0.706332386f, 0.149130091f},
-std::array<float,2>{0.479820937f, 0.625159442f},
-std::array<float,2>{0.0124962423f, 0.425036669f},
-std::array<float,2>{0.951427877f, 0.978982627f},
-std::array<float,2>{0.574764013f, 0.333767116f},
-std::array<float,2>{0.319827408f, 0.83910352f},
-std::array<float,2>{0.243527368f, 0.0687968284f},
-std::array<float,2>{0.827326596f, 0.501748145f},
-std::array<float,2>{0.991534412f, 0.24658516f},
-std::array<float,2>{0.0596118011f, 0.696296036f},
-std::array<float,2>{0.466191322f, 0.466694653f},
-std::array<float,2>{0.726480901f, 0.910535812f},
-std::array<float,2>{0.756719768f, 0.426622927f},
-std::array<float,2>{0.171494812f, 0.984319508f},
-std::array<float,2>{0.306747019f, 0.154641181f},
-std::array<float,2>{0.559962094f, 0.632279873f},
-std::array<float,2>{0.630347908f, 0.00349873281f},
-std::array<float,2>{0.378035098f, 0.621525049f},
-std::array<float,2>{0.101830266f, 0.283425719f},
-std::array<float,2>{0.908426821f, 0.805028021f},
-std::array<float,2>{0.699816406f, 0.486166596f},
-std::array<float,2>{0.486487389f, 0.896381319f},
-std::array<float,2>{0.0248018336f, 0.215635583f},
-std::array<float,2>{0.958428979f, 0.729360104f},
-std::array<float,2>{0.869063675f, 0.104975231f},
-std::array<float,2>{0.207272574f, 0.560944378f},
-std::array<float,2>{0.353347152f, 0.3686755f},
-std::array<float,2>{0.596682847f, 0.852784753f},
-std::array<float,2>{0.883861244f, 0.280786783f},
-std::array<float,2>{0.08956898f, 0.759479225f},
-std::array<float,2>{0.415676087f, 0.0523736849f},
-std::array<float,2>{0.68653965f, 0.591188014f},
-std::array<float,2>{0.514714599f, 0.169345975f},
-std::array<float,2>{0.252566129f, 0.673396468f},
-std::array<float,2>{0.127806738f, 0.391485065f},
-std::array<float,2>{0.809700251f, 0.94352144f},
-std::array<float,2>{0.663673759f, 0.302403152f},
-std::array<float,2>{0.427663893f, 0.796556234f},
-std::array<float,2>{0.0754327849f, 0.0309821013f},
-std::array<float,2>{0.90561235f, 0.594572783f},
-std::array<float,2>{0.792019963f, 0.136891454f},
-std::array<float,2>{0.147840112f, 0.648312807f},
-std::array<float,2>{0.277053446f, 0.409404814f},
-std::array<float,2>{0.516207337f, 0.995663226f},
-std::array<float,2>{0.941252708f, 0.447332531f},
-std::array<float,2>{0.00720350584f, 0.923319697f},
-std::array<float,2>{0.476299971f, 0.221093103f},
-std::array<float,2>{0.717710674f, 0.703879535f},
-std::array<float,2>{0.611400604f, 0.0830459297f},
-std::array<float,2>{0.361051649f, 0.521838903f},
-std::array<float,2>{0.199948698f, 0.32310307f},
-std::array<float,2>{0.844401181f, 0.81560266f},
-std::array<float,2>{0.54455322f, 0.375702351f},
-std::array<float,2>{0.28813079f, 0.954894781f},
-std::array<float,2>{0.175196007f, 0.183106571f},
-std::array<float,2>{0.767806232f, 0.656946898f},
-std::array<float,2>{0.922658324f, 0.0318339393f},
-std::array<float,2>{0.114495352f, 0.577478468f},
-std::array<float,2>{0.391767591f, 0.25631246f},
-std::array<float,2>{0.648624063f, 0.771563351f},
-std::array<float,2>{0.836673498f, 0.345326751f},
-std::array<float,2>{0.229076654f, 0.859430313f},
-std::array<float,2>{0.332457364f, 0.112133749f},
-std::array<float,2>{0.586550772f, 0.544059217f},
-std::array<float,2>{0.736633599f, 0.200264618f},
-std::array<float,2>{0.438851058f, 0.735142469f},
-std::array<float,2>{0.0440707542f, 0.482703447f},
-std::array<float,2>{0.969824731f, 0.884492755f},
-std::array<float,2>{0.524600089f, 0.260653496f},
-std::array<float,2>{0.27036351f, 0.774854839f},
-std::array<float,2>{0.150084034f, 0.0445585102f},
-std::array<float,2>{0.783896327f, 0.567491591f},
-std::array<float,2>{0.890737176f, 0.179334566f},
-std::array<float,2>{0.0680657476f, 0.668704569f},
-std::array<float,2>{0.433800519f, 0.387640953f},
-std::array<float,2>{0.67026937f, 0.968417645f},
-std::array<float,2>{0.851836026f, 0.468977481f},
-std::array<float,2>{0.192775428f, 0.879285395f},
-std::array<float,2>{0.371262044f, 0.189112455f},
-std::array<float,2>{0.62409234f, 0.746707261f},
-std::array<float,2>{0.707588255f, 0.117582731f},
-std::array<float,2>{0.481288254f, 0.535645485f},
-std::array<float,2>{0.00863456447f, 0.358122706f},
-std::array<float,2>{0.946184754f, 0.870063066f},
-std::array<float,2>{0.647216201f, 0.421608984f},
-std::array<float,2>{0.404202104f, 0.98483789f},
-std::array<float,2>{0.120105393f, 0.125198767f},
-std::array<float,2>{0.936432123f, 0.651669025f},
-std::array<float,2>{0.777646899f, 0.018975798f},
-std::array<float,2>{0.181925505f, 0.608549476f},
-std::array<float,2>{0.291946679f, 0.305378824f},
-std::array<float,2>{0.537400842f, 0.78338474f},
-std::array<float,2>{0.982811213f, 0.316529483f},
-std::array<float,2>{0.0371837877f, 0.824623644f},
-std::array<float,2>{0.449697524f, 0.0919342265f},
-std::array<float,2>{0.74632144f, 0.525887966f},
-std::array<float,2>{0.579986155f, 0.226980343f},
-std::array<float,2>{0.33602342f, 0.717768371f},
-std::array<float,2>{0.220519885f, 0.443850756f},
-std::array<float,2>{0.835066915f, 0.936645508f},
-std::array<float,2>{0.729299903f, 0.362423152f},
-std::array<float,2>{0.458818138f, 0.844560206f},
-std::array<float,2>{0.0541044138f, 0.101293854f},
-std::array<float,2>{0.994694054f, 0.547554314f},
-std::array<float,2>{0.814868331f, 0.205000028f},
-std::array<float,2>{0.236551449f, 0.720463753f},
-std::array<float,2>{0.323963791f, 0.497178316f},
-std::array<float,2>{0.569142222f, 0.901115417f},
-std::array<float,2>{0.919797182f, 0.404517412f},
-std::array<float,2>{0.0961997136f, 0.948066592f},
-std::array<float,2>{0.382886499f, 0.158943921f},
-std::array<float,2>{0.639112055f, 0.682549f},
-std::array<float,2>{0.549099028f, 0.0596687235f},
-std::array<float,2>{0.30388093f, 0.58182317f},
-std::array<float,2>{0.156519383f, 0.266462952f},
-std::array<float,2>{0.760983586f, 0.756907046f},
-std::array<float,2>{0.607521892f, 0.45813477f},
-std::array<float,2>{0.347132772f, 0.919393897f},
-std::array<float,2>{0.218696088f, 0.237558648f},
-std::array<float,2>{0.865318f, 0.690683544f},
-std::array<float,2>{0.963556886f, 0.0742444396f},
-std::array<float,2>{0.022270862f, 0.510945976f},
-std::array<float,2>{0.495738804f, 0.343130589f},
-std::array<float,2>{0.688295782f, 0.831407011f},
-std::array<float,2>{0.804163754f, 0.296314687f},
-std::array<float,2>{0.139728472f, 0.803801f},
-std::array<float,2>{0.259625673f, 0.00969525054f},
-std::array<float,2>{0.507191062f, 0.616034448f},
-std::array<float,2>{0.67298764f, 0.147952005f},
-std::array<float,2>{0.408109069f, 0.637142062f},
-std::array<float,2>{0.0836325586f, 0.430169702f},
-std::array<float,2>{0.875522077f, 0.969902933f},
-std::array<float,2>{0.557693899f, 0.354918569f},
-std::array<float,2>{0.31232658f, 0.872309387f},
-std::array<float,2>{0.165098101f, 0.121360399f},
-std::array<float,2>{0.753446519f, 0.531294584f},
-std::array<float,2>{0.912050843f, 0.193409443f},
-std::array<float,2>{0.107437678f, 0.746065617f},
-std::array<float,2>{0.379756033f, 0.472790539f},
-std::array<float,2>{0.627150774f, 0.876396894f},
-std::array<float,2>{0.823172987f, 0.384964973f},
-std::array<float,2>{0.248952329f, 0.962068081f},
-std::array<float,2>{0.314877898f, 0.174399018f},
-std::array<float,2>{0.571188569f, 0.665982842f},
-std::array<float,2>{0.721687615f, 0.0393147245f},
-std::array<float,2>{0.46455133f, 0.56559962f},
-std::array<float,2>{0.0579199195f, 0.263447851f},
-std::array<float,2>{0.986598015f, 0.778663874f},
-std::array<float,2>{0.68024075f, 0.439878851f},
-std::array<float,2>{0.421859086f, 0.931244731f},
-std::array<float,2>{0.0902718082f, 0.232168987f},
-std::array<float,2>{0.887473941f, 0.712480664f},
-std::array<float,2>{0.804908514f, 0.0878575444f},
-std::array<float,2>{0.13053374f, 0.530933499f},
-std::array<float,2>{0.256504476f, 0.313461244f},
-std::array<float,2>{0.509634912f, 0.82380563f},
-std::array<float,2>{0.953179955f, 0.31136325f},
-std::array<float,2>{0.027691111f, 0.789003611f},
-std::array<float,2>{0.49102354f, 0.0216412134f},
-std::array<float,2>{0.696810901f, 0.602531075f},
-std::array<float,2>{0.598201811f, 0.131352022f},
-std::array<float,2>{0.356815636f, 0.655010879f},
-std::array<float,2>{0.205582753f, 0.415285885f},
-std::array<float,2>{0.873381495f, 0.992159367f},
-std::array<float,2>{0.711122811f, 0.272256613f},
-std::array<float,2>{0.471760422f, 0.750234485f},
-std::array<float,2>{0.00306310295f, 0.0560114346f},
-std::array<float,2>{0.943343759f, 0.58379072f},
-std::array<float,2>{0.848475158f, 0.162526354f},
-std::array<float,2>{0.198530659f, 0.687476277f},
-std::array<float,2>{0.365637213f, 0.401925892f},
-std::array<float,2>{0.615772724f, 0.949938715f},
-std::array<float,2>{0.899111867f, 0.493139744f},
-std::array<float,2>{0.0731329098f, 0.904638708f},
-std::array<float,2>{0.42403245f, 0.208867341f},
-std::array<float,2>{0.659853339f, 0.725061536f},
-std::array<float,2>{0.521576762f, 0.0967447609f},
-std::array<float,2>{0.279835105f, 0.553858757f},
-std::array<float,2>{0.142473787f, 0.366079658f},
-std::array<float,2>{0.794512331f, 0.850492597f},
-std::array<float,2>{0.590538621f, 0.434945196f},
-std::array<float,2>{0.328753978f, 0.973444104f},
-std::array<float,2>{0.232565358f, 0.14410615f},
-std::array<float,2>{0.84177947f, 0.633284986f},
-std::array<float,2>{0.976511538f, 0.0142009305f},
-std::array<float,2>{0.0415546484f, 0.611804545f},
-std::array<float,2>{0.44442609f, 0.292662174f},
-std::array<float,2>{0.739649653f, 0.79858315f},
-std::array<float,2>{0.772465169f, 0.338629544f},
-std::array<float,2>{0.178231075f, 0.835388184f},
-std::array<float,2>{0.283404738f, 0.0715862438f},
-std::array<float,2>{0.540243685f, 0.514808774f},
-std::array<float,2>{0.654531896f, 0.240262181f},
-std::array<float,2>{0.395892292f, 0.693141639f},
-std::array<float,2>{0.111058168f, 0.455185294f},
-std::array<float,2>{0.928900242f, 0.914491296f},
-std::array<float,2>{0.617341101f, 0.286971122f},
-std::array<float,2>{0.370767087f, 0.80947721f},
-std::array<float,2>{0.188652441f, 0.00578770973f},
-std::array<float,2>{0.856112719f, 0.617833138f},
-std::array<float,2>{0.952346921f, 0.151918039f},
-std::array<float,2>{0.0135006486f, 0.628232718f},
-std::array<float,2>{0.478811353f, 0.422527909f},
-std::array<float,2>{0.705084622f, 0.977407098f},
-std::array<float,2>{0.788849771f, 0.463832378f},
-std::array<float,2>{0.155887857f, 0.909231484f},
-std::array<float,2>{0.268588662f, 0.244042084f},
-std::array<float,2>{0.53070575f, 0.701482058f},
-std::array<float,2>{0.666913807f, 0.0653912351f},
-std::array<float,2>{0.429760247f, 0.504612386f},
-std::array<float,2>{0.0663030446f, 0.3311795f},
-std::array<float,2>{0.897454262f, 0.842601478f},
-std::array<float,2>{0.745607555f, 0.397181541f},
-std::array<float,2>{0.448835701f, 0.939406991f},
-std::array<float,2>{0.0326372832f, 0.164416105f},
-std::array<float,2>{0.977722406f, 0.677512765f},
-std::array<float,2>{0.83069551f, 0.0492892899f},
-std::array<float,2>{0.226513892f, 0.586617053f},
-std::array<float,2>{0.340418279f, 0.274466366f},
-std::array<float,2>{0.584557772f, 0.763899744f},
-std::array<float,2>{0.933363974f, 0.371523917f},
-std::array<float,2>{0.121167637f, 0.858603895f},
-std::array<float,2>{0.401899755f, 0.105743773f},
-std::array<float,2>{0.643236756f, 0.557138383f},
-std::array<float,2>{0.534505844f, 0.213371441f},
-std::array<float,2>{0.293788642f, 0.734011531f},
-std::array<float,2>{0.184799299f, 0.491933197f},
-std::array<float,2>{0.774370432f, 0.891546786f},
-std::array<float,2>{0.632893026f, 0.326956481f},
-std::array<float,2>{0.388079673f, 0.817547917f},
-std::array<float,2>{0.0991162136f, 0.0799235851f},
-std::array<float,2>{0.916590691f, 0.517296016f},
-std::array<float,2>{0.764499366f, 0.224548683f},
-std::array<float,2>{0.163459539f, 0.710341871f},
-std::array<float,2>{0.297160417f, 0.449559659f},
-std::array<float,2>{0.554576933f, 0.928213537f},
-std::array<float,2>{0.999001861f, 0.414035529f},
-std::array<float,2>{0.047828801f, 0.998193741f},
-std::array<float,2>{0.455100298f, 0.133077934f},
-std::array<float,2>{0.733691752f, 0.643345594f},
-std::array<float,2>{0.563048601f, 0.0252152178f},
-std::array<float,2>{0.325206697f, 0.599123955f},
-std::array<float,2>{0.241073504f, 0.300584167f},
-std::array<float,2>{0.818217576f, 0.790631175f},
-std::array<float,2>{0.50064075f, 0.476985484f},
-std::array<float,2>{0.263629943f, 0.888818383f},
-std::array<float,2>{0.136062428f, 0.197218597f},
-std::array<float,2>{0.799584687f, 0.741102099f},
-std::array<float,2>{0.881605983f, 0.115421392f},
-std::array<float,2>{0.0810341984f, 0.540587306f},
-std::array<float,2>{0.412532002f, 0.351445347f},
-std::array<float,2>{0.67913878f, 0.866051853f},
-std::array<float,2>{0.862058461f, 0.251797855f},
-std::array<float,2>{0.211521879f, 0.767439783f},
-std::array<float,2>{0.349598855f, 0.0374549776f},
-std::array<float,2>{0.602522075f, 0.570822358f},
-std::array<float,2>{0.694982052f, 0.186248183f},
-std::array<float,2>{0.498651326f, 0.66159153f},
-std::array<float,2>{0.0167708136f, 0.381760925f},
-std::array<float,2>{0.965910375f, 0.959813058f},
-std::array<float,2>{0.595463634f, 0.370612532f},
-std::array<float,2>{0.35506025f, 0.854519665f},
-std::array<float,2>{0.209500626f, 0.101732731f},
-std::array<float,2>{0.8698228f, 0.559506416f},
-std::array<float,2>{0.960334122f, 0.217801467f},
-std::array<float,2>{0.0257068034f, 0.727033734f},
-std::array<float,2>{0.486136347f, 0.486914277f},
-std::array<float,2>{0.70302242f, 0.89796567f},
-std::array<float,2>{0.811022162f, 0.392866552f},
-std::array<float,2>{0.126208901f, 0.942584395f},
-std::array<float,2>{0.250845343f, 0.170386717f},
-std::array<float,2>{0.513145208f, 0.674025238f},
-std::array<float,2>{0.68382591f, 0.0534885451f},
-std::array<float,2>{0.416255504f, 0.593187034f},
-std::array<float,2>{0.0877261236f, 0.278258085f},
-std::array<float,2>{0.885125995f, 0.76013881f},
-std::array<float,2>{0.722916245f, 0.46727854f},
-std::array<float,2>{0.467961431f, 0.912895262f},
-std::array<float,2>{0.0610042326f, 0.249504864f},
-std::array<float,2>{0.989017546f, 0.697447598f},
-std::array<float,2>{0.825012028f, 0.0674978495f},
-std::array<float,2>{0.245984152f, 0.503744245f},
-std::array<float,2>{0.317911714f, 0.334676117f},
-std::array<float,2>{0.576322258f, 0.837000966f},
-std::array<float,2>{0.907322466f, 0.281603366f},
-std::array<float,2>{0.105314039f, 0.807179451f},
-std::array<float,2>{0.375338852f, 0.00188493368f},
-std::array<float,2>{0.63228935f, 0.624698758f},
-std::array<float,2>{0.561223209f, 0.15261732f},
-std::array<float,2>{0.304882348f, 0.629862666f},
-std::array<float,2>{0.168633118f, 0.428271025f},
-std::array<float,2>{0.754228175f, 0.981894076f},
-std::array<float,2>{0.65206337f, 0.254214644f},
-std::array<float,2>{0.393848121f, 0.770146847f},
-std::array<float,2>{0.116243958f, 0.0337138772f},
-std::array<float,2>{0.923867524f, 0.575349927f},
-std::array<float,2>{0.765652001f, 0.181128174f},
-std::array<float,2>{0.172058627f, 0.65982008f},
-std::array<float,2>{0.28568992f, 0.378690273f},
-std::array<float,2>{0.54536283f, 0.956012964f},
-std::array<float,2>{0.97075212f, 0.481467426f},
-std::array<float,2>{0.046488788f, 0.886179507f},
-std::array<float,2>{0.441358477f, 0.202892125f},
-std::array<float,2>{0.735161602f, 0.737417698f},
-std::array<float,2>{0.589811265f, 0.110689461f},
-std::array<float,2>{0.33514607f, 0.546165228f},
-std::array<float,2>{0.226943269f, 0.346684903f},
-std::array<float,2>{0.839160204f, 0.862459064f},
-std::array<float,2>{0.51866436f, 0.408192962f},
-std::array<float,2>{0.274134457f, 0.99316752f},
-std::array<float,2>{0.146107376f, 0.140091375f},
-std::array<float,2>{0.790665925f, 0.645567298f},
-std::array<float,2>{0.904244602f, 0.0284479763f},
-std::array<float,2>{0.0770462602f, 0.597075164f},
-std::array<float,2>{0.427787095f, 0.304649413f},
-std::array<float,2>{0.660319209f, 0.793811142f},
-std::array<float,2>{0.846509516f, 0.321603596f},
-std::array<float,2>{0.201465622f, 0.813120008f},
-std::array<float,2>{0.362087816f, 0.0847075954f},
-std::array<float,2>{0.611023128f, 0.519976318f},
-std::array<float,2>{0.716075718f, 0.219229251f},
-std::array<float,2>{0.473083109f, 0.706265211f},
-std::array<float,2>{0.0039230804f, 0.446095437f},
-std::array<float,2>{0.938678324f, 0.925488472f},
-std::array<float,2>{0.535792768f, 0.307273328f},
-std::array<float,2>{0.29045558f, 0.783200502f},
-std::array<float,2>{0.180945426f, 0.0170830209f},
-std::array<float,2>{0.780970573f, 0.605874181f},
-std::array<float,2>{0.935487151f, 0.127383739f},
-std::array<float,2>{0.118133068f, 0.648729384f},
-std::array<float,2>{0.404389709f, 0.418769032f},
-std::array<float,2>{0.646027684f, 0.98733747f},
-std::array<float,2>{0.83344382f, 0.442329019f},
-std::array<float,2>{0.220956236f, 0.934115469f},
-std::array<float,2>{0.337900907f, 0.230158225f},
-std::array<float,2>{0.581534386f, 0.715526342f},
-std::array<float,2>{0.748746216f, 0.0906230733f},
-std::array<float,2>{0.452201307f, 0.524773896f},
-std::array<float,2>{0.0367832631f, 0.318537861f},
-std::array<float,2>{0.981275737f, 0.82711035f},
-std::array<float,2>{0.669469118f, 0.389726162f},
-std::array<float,2>{0.435724884f, 0.966784418f},
-std::array<float,2>{0.0702399164f, 0.177552953f},
-std::array<float,2>{0.893271804f, 0.670615971f},
-std::array<float,2>{0.782468438f, 0.0450456142f},
-std::array<float,2>{0.150996745f, 0.56843996f},
-std::array<float,2>{0.272987485f, 0.258656293f},
-std::array<float,2>{0.525799692f, 0.775567293f},
-std::array<float,2>{0.948482275f, 0.356061012f},
-std::array<float,2>{0.0109941196f, 0.868987739f},
-std::array<float,2>{0.483244658f, 0.120354511f},
-std::array<float,2>{0.709303081f, 0.538110733f},
-std::array<float,2>{0.621699989f, 0.190491512f},
-std::array<float,2>{0.374837697f, 0.74971503f},
-std::array<float,2>{0.19458808f, 0.471008629f},
-std::array<float,2>{0.85524106f, 0.88100028f},
-std::array<float,2>{0.690691888f, 0.340011507f},
-std::array<float,2>{0.493452847f, 0.828370631f},
-std::array<float,2>{0.0210114513f, 0.076521039f},
-std::array<float,2>{0.962743402f, 0.508016765f},
-std::array<float,2>{0.863547623f, 0.236104459f},
-std::array<float,2>{0.216023877f, 0.687602818f},
-std::array<float,2>{0.344625711f, 0.459871829f},
-std::array<float,2>{0.607085764f, 0.920369327f},
-std::array<float,2>{0.878390908f, 0.432096362f},
-std::array<float,2>{0.0846079439f, 0.972318053f},
-std::array<float,2>{0.409014434f, 0.145582229f},
-std::array<float,2>{0.67525506f, 0.639708161f},
-std::array<float,2>{0.504737675f, 0.0115458835f},
-std::array<float,2>{0.260153264f, 0.615080297f},
-std::array<float,2>{0.137721151f, 0.294545174f},
-std::array<float,2>{0.802304029f, 0.801358342f},
-std::array<float,2>{0.566733122f, 0.499828607f},
-std::array<float,2>{0.321173012f, 0.900055051f},
-std::array<float,2>{0.235358164f, 0.206099585f},
-std::array<float,2>{0.812767863f, 0.720859528f},
-std::array<float,2>{0.993429124f, 0.0985161662f},
-std::array<float,2>{0.0510099567f, 0.550002158f},
-std::array<float,2>{0.459805131f, 0.360616237f},
-std::array<float,2>{0.726745725f, 0.847561777f},
-std::array<float,2>{0.758790791f, 0.26934734f},
-std::array<float,2>{0.159938529f, 0.754567623f},
-std::array<float,2>{0.301386476f, 0.0612211041f},
-std::array<float,2>{0.548072875f, 0.579616368f},
-std::array<float,2>{0.63855803f, 0.157381341f},
-std::array<float,2>{0.385327518f, 0.68098104f},
-std::array<float,2>{0.0953040347f, 0.404109985f},
-std::array<float,2>{0.921640575f, 0.946563601f},
-std::array<float,2>{0.511651218f, 0.314675957f},
-std::array<float,2>{0.2547822f, 0.822121918f},
-std::array<float,2>{0.132143661f, 0.0893172026f},
-std::array<float,2>{0.80731988f, 0.527455509f},
-std::array<float,2>{0.88998425f, 0.233584315f},
-std::array<float,2>{0.0929138511f, 0.713478088f},
-std::array<float,2>{0.418732703f, 0.439143807f},
-std::array<float,2>{0.683173299f, 0.931923628f},
-std::array<float,2>{0.872483432f, 0.416181594f},
-std::array<float,2>{0.203632563f, 0.988832533f},
-std::array<float,2>{0.359280854f, 0.129901886f},
-std::array<float,2>{0.601529717f, 0.652810156f},
-std::array<float,2>{0.697803617f, 0.019549245f},
-std::array<float,2>{0.488305748f, 0.604503572f},
-std::array<float,2>{0.0310490783f, 0.309865862f},
-std::array<float,2>{0.956733167f, 0.785164893f},
-std::array<float,2>{0.625596821f, 0.476019233f},
-std::array<float,2>{0.381809324f, 0.877997816f},
-std::array<float,2>{0.10727869f, 0.192023188f},
-std::array<float,2>{0.912152946f, 0.744048119f},
-std::array<float,2>{0.75126946f, 0.123070367f},
-std::array<float,2>{0.167314082f, 0.533464789f},
-std::array<float,2>{0.310325056f, 0.352434397f},
-std::array<float,2>{0.556280255f, 0.874784112f},
-std::array<float,2>{0.985062897f, 0.264013976f},
-std::array<float,2>{0.0562578924f, 0.780675352f},
-std::array<float,2>{0.461500376f, 0.042654492f},
-std::array<float,2>{0.72011435f, 0.564078867f},
-std::array<float,2>{0.573797703f, 0.172217444f},
-std::array<float,2>{0.312641978f, 0.667362332f},
-std::array<float,2>{0.246178642f, 0.384285331f},
-std::array<float,2>{0.82146138f, 0.964717329f},
-std::array<float,2>{0.740250289f, 0.289579093f},
-std::array<float,2>{0.441810161f, 0.799958229f},
-std::array<float,2>{0.0390701592f, 0.0133422641f},
-std::array<float,2>{0.972838283f, 0.609732091f},
-std::array<float,2>{0.84366852f, 0.140993744f},
-std::array<float,2>{0.232276693f, 0.635312378f},
-std::array<float,2>{0.3315759f, 0.43586129f},
-std::array<float,2>{0.591938555f, 0.97526145f},
-std::array<float,2>{0.926646829f, 0.454387277f},
-std::array<float,2>{0.11240714f, 0.917527437f},
-std::array<float,2>{0.39842847f, 0.238802254f},
-std::array<float,2>{0.654195786f, 0.695302248f},
-std::array<float,2>{0.542844236f, 0.0737054199f},
-std::array<float,2>{0.282427877f, 0.513376772f},
-std::array<float,2>{0.176874325f, 0.337278008f},
-std::array<float,2>{0.770768225f, 0.83273387f},
-std::array<float,2>{0.613586724f, 0.399779916f},
-std::array<float,2>{0.365016699f, 0.952487886f},
-std::array<float,2>{0.196406573f, 0.161324382f},
-std::array<float,2>{0.849874854f, 0.68439126f},
-std::array<float,2>{0.94526881f, 0.0578804724f},
-std::array<float,2>{0.000927980349f, 0.58588928f},
-std::array<float,2>{0.469990462f, 0.270264477f},
-std::array<float,2>{0.713990271f, 0.753799677f},
-std::array<float,2>{0.795314193f, 0.364690512f},
-std::array<float,2>{0.144012854f, 0.847983718f},
-std::array<float,2>{0.278233558f, 0.0957024395f},
-std::array<float,2>{0.519539416f, 0.552731037f},
-std::array<float,2>{0.65635103f, 0.209302008f},
-std::array<float,2>{0.422458291f, 0.722892642f},
-std::array<float,2>{0.0706707239f, 0.494921744f},
-std::array<float,2>{0.902145505f, 0.904197812f},
-std::array<float,2>{0.582172215f, 0.275706917f},
-std::array<float,2>{0.342346758f, 0.762054324f},
-std::array<float,2>{0.224483356f, 0.0478299819f},
-std::array<float,2>{0.829187751f, 0.588897645f},
-std::array<float,2>{0.97895366f, 0.166414976f},
-std::array<float,2>{0.0336119123f, 0.678182483f},
-std::array<float,2>{0.445989043f, 0.396088719f},
-std::array<float,2>{0.742755711f, 0.941007078f},
-std::array<float,2>{0.775473475f, 0.490030169f},
-std::array<float,2>{0.186616138f, 0.89314425f},
-std::array<float,2>{0.295271188f, 0.212418497f},
-std::array<float,2>{0.533190072f, 0.731290758f},
-std::array<float,2>{0.641533196f, 0.107772343f},
-std::array<float,2>{0.399922639f, 0.555926383f},
-std::array<float,2>{0.124674559f, 0.374306023f},
-std::array<float,2>{0.929714561f, 0.85700798f},
-std::array<float,2>{0.704462349f, 0.424453676f},
-std::array<float,2>{0.4783158f, 0.979507446f},
-std::array<float,2>{0.0149086146f, 0.149543628f},
-std::array<float,2>{0.950583816f, 0.626747787f},
-std::array<float,2>{0.857542634f, 0.0077049192f},
-std::array<float,2>{0.189625099f, 0.621078789f},
-std::array<float,2>{0.368283868f, 0.288903117f},
-std::array<float,2>{0.621011734f, 0.810915232f},
-std::array<float,2>{0.896362305f, 0.328561723f},
-std::array<float,2>{0.0625921637f, 0.840783954f},
-std::array<float,2>{0.432088464f, 0.0633398071f},
-std::array<float,2>{0.665876508f, 0.507001281f},
-std::array<float,2>{0.5289433f, 0.244985268f},
-std::array<float,2>{0.266666621f, 0.699253321f},
-std::array<float,2>{0.154006541f, 0.46173051f},
-std::array<float,2>{0.78668803f, 0.906575918f},
-std::array<float,2>{0.676939666f, 0.349039018f},
-std::array<float,2>{0.411128461f, 0.86352855f},
-std::array<float,2>{0.0793042257f, 0.113703802f},
-std::array<float,2>{0.87923789f, 0.541062295f},
-std::array<float,2>{0.797189176f, 0.19864285f},
-std::array<float,2>{0.133374482f, 0.739406705f},
-std::array<float,2>{0.264629632f, 0.478833228f},
-std::array<float,2>{0.502898335f, 0.8886379f},
-std::array<float,2>{0.96684885f, 0.379426956f},
-std::array<float,2>{0.0191639736f, 0.957592607f},
-std::array<float,2>{0.497354776f, 0.18476975f},
-std::array<float,2>{0.692716718f, 0.663720489f},
-std::array<float,2>{0.604710042f, 0.0364663862f},
-std::array<float,2>{0.351176411f, 0.573606372f},
-std::array<float,2>{0.214085966f, 0.253346443f},
-std::array<float,2>{0.860443294f, 0.767952919f},
-std::array<float,2>{0.551550567f, 0.452773511f},
-std::array<float,2>{0.299140513f, 0.927206457f},
-std::array<float,2>{0.160596177f, 0.224793255f},
-std::array<float,2>{0.762632668f, 0.708507597f},
-std::array<float,2>{0.915434182f, 0.0801374465f},
-std::array<float,2>{0.100413777f, 0.518536747f},
-std::array<float,2>{0.388955772f, 0.325119406f},
-std::array<float,2>{0.635322869f, 0.819808722f},
-std::array<float,2>{0.818514168f, 0.297250986f},
-std::array<float,2>{0.239581883f, 0.792857051f},
-std::array<float,2>{0.328047901f, 0.0258253515f},
-std::array<float,2>{0.56611836f, 0.600527048f},
-std::array<float,2>{0.731681764f, 0.136391833f},
-std::array<float,2>{0.454401553f, 0.641453385f},
-std::array<float,2>{0.0501091555f, 0.411695063f},
-std::array<float,2>{0.998037398f, 0.996250331f}}
\ No newline at end of file
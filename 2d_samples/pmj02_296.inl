@@ -1,4096 +0,0 @@
-{std::array<float,2>{0.45271346f, 0.0847675949f},
-std::array<float,2>{0.72425127f, 0.656752288f},
-std::array<float,2>{0.0365940742f, 0.804383636f},
-std::array<float,2>{0.982792437f, 0.29897669f},
-std::array<float,2>{0.164069235f, 0.389066339f},
-std::array<float,2>{0.771632373f, 0.891196311f},
-std::array<float,2>{0.335545182f, 0.506777763f},
-std::array<float,2>{0.622552276f, 0.184196934f},
-std::array<float,2>{0.114600971f, 0.200307176f},
-std::array<float,2>{0.921107948f, 0.604501665f},
-std::array<float,2>{0.42579031f, 0.945263803f},
-std::array<float,2>{0.652192414f, 0.462229043f},
-std::array<float,2>{0.272448272f, 0.32354176f},
-std::array<float,2>{0.554565191f, 0.828929782f},
-std::array<float,2>{0.197532237f, 0.72170043f},
-std::array<float,2>{0.839881361f, 0.0495893918f},
-std::array<float,2>{0.374835551f, 0.151598498f},
-std::array<float,2>{0.564232171f, 0.53859067f},
-std::array<float,2>{0.152788743f, 0.921801448f},
-std::array<float,2>{0.802446187f, 0.414118171f},
-std::array<float,2>{0.00218182942f, 0.279917002f},
-std::array<float,2>{0.957719326f, 0.755845964f},
-std::array<float,2>{0.472218871f, 0.645703495f},
-std::array<float,2>{0.692261755f, 0.104263939f},
-std::array<float,2>{0.238884032f, 0.0121740066f},
-std::array<float,2>{0.846520901f, 0.709177196f},
-std::array<float,2>{0.31038025f, 0.863562882f},
-std::array<float,2>{0.520757079f, 0.346237987f},
-std::array<float,2>{0.379104018f, 0.482763082f},
-std::array<float,2>{0.676665843f, 0.991462886f},
-std::array<float,2>{0.0663091168f, 0.59265399f},
-std::array<float,2>{0.899008811f, 0.224837914f},
-std::array<float,2>{0.293457747f, 0.0438995138f},
-std::array<float,2>{0.51058805f, 0.740810752f},
-std::array<float,2>{0.222048238f, 0.815150082f},
-std::array<float,2>{0.862376451f, 0.328362793f},
-std::array<float,2>{0.0848580673f, 0.445208907f},
-std::array<float,2>{0.876541436f, 0.953400075f},
-std::array<float,2>{0.397058934f, 0.621609867f},
-std::array<float,2>{0.665115118f, 0.21221076f},
-std::array<float,2>{0.136772141f, 0.15867582f},
-std::array<float,2>{0.783571184f, 0.524001181f},
-std::array<float,2>{0.349402398f, 0.878466189f},
-std::array<float,2>{0.59106797f, 0.397640437f},
-std::array<float,2>{0.492557585f, 0.285295218f},
-std::array<float,2>{0.707191527f, 0.792001247f},
-std::array<float,2>{0.0241501797f, 0.676306844f},
-std::array<float,2>{0.937986434f, 0.0746779665f},
-std::array<float,2>{0.40649119f, 0.243000135f},
-std::array<float,2>{0.635769784f, 0.575961232f},
-std::array<float,2>{0.0939856023f, 0.984210193f},
-std::array<float,2>{0.930509865f, 0.486317664f},
-std::array<float,2>{0.211701125f, 0.372639656f},
-std::array<float,2>{0.818358481f, 0.849159956f},
-std::array<float,2>{0.257690191f, 0.690210938f},
-std::array<float,2>{0.541359901f, 0.0161532201f},
-std::array<float,2>{0.0500356555f, 0.120343521f},
-std::array<float,2>{0.986898839f, 0.629440844f},
-std::array<float,2>{0.45949924f, 0.767542362f},
-std::array<float,2>{0.737938106f, 0.263056248f},
-std::array<float,2>{0.325419784f, 0.421975702f},
-std::array<float,2>{0.593753517f, 0.935666859f},
-std::array<float,2>{0.17681475f, 0.550388753f},
-std::array<float,2>{0.759689689f, 0.126917228f},
-std::array<float,2>{0.399194032f, 0.0307806581f},
-std::array<float,2>{0.659611404f, 0.700202882f},
-std::array<float,2>{0.0918542594f, 0.853279531f},
-std::array<float,2>{0.884998024f, 0.364451349f},
-std::array<float,2>{0.227151513f, 0.494935721f},
-std::array<float,2>{0.873416185f, 0.975435674f},
-std::array<float,2>{0.28221783f, 0.567732096f},
-std::array<float,2>{0.504535079f, 0.236690581f},
-std::array<float,2>{0.016420329f, 0.135032654f},
-std::array<float,2>{0.951719701f, 0.557185769f},
-std::array<float,2>{0.486924917f, 0.928369284f},
-std::array<float,2>{0.710985303f, 0.435536921f},
-std::array<float,2>{0.352349311f, 0.25201717f},
-std::array<float,2>{0.5822649f, 0.776854753f},
-std::array<float,2>{0.125822976f, 0.63914156f},
-std::array<float,2>{0.795493901f, 0.116883501f},
-std::array<float,2>{0.258658707f, 0.210573241f},
-std::array<float,2>{0.53400749f, 0.613903701f},
-std::array<float,2>{0.204959437f, 0.964268625f},
-std::array<float,2>{0.821271122f, 0.449860394f},
-std::array<float,2>{0.105268441f, 0.341372609f},
-std::array<float,2>{0.925260425f, 0.820705235f},
-std::array<float,2>{0.416698694f, 0.748350024f},
-std::array<float,2>{0.630863786f, 0.0373389944f},
-std::array<float,2>{0.179899424f, 0.0671195537f},
-std::array<float,2>{0.754243314f, 0.686882496f},
-std::array<float,2>{0.314595491f, 0.785827518f},
-std::array<float,2>{0.602124214f, 0.295513093f},
-std::array<float,2>{0.467417359f, 0.400841117f},
-std::array<float,2>{0.743706644f, 0.888476849f},
-std::array<float,2>{0.0565879047f, 0.516821921f},
-std::array<float,2>{0.994746864f, 0.169414133f},
-std::array<float,2>{0.341096878f, 0.0997439772f},
-std::array<float,2>{0.616161585f, 0.653598487f},
-std::array<float,2>{0.157753751f, 0.762462378f},
-std::array<float,2>{0.776903987f, 0.266470641f},
-std::array<float,2>{0.0399158858f, 0.410435081f},
-std::array<float,2>{0.975313306f, 0.914035618f},
-std::array<float,2>{0.439929992f, 0.544746041f},
-std::array<float,2>{0.728556275f, 0.140713975f},
-std::array<float,2>{0.189718217f, 0.232540429f},
-std::array<float,2>{0.829550862f, 0.58226335f},
-std::array<float,2>{0.279925078f, 0.999389887f},
-std::array<float,2>{0.559988558f, 0.471253276f},
-std::array<float,2>{0.434378862f, 0.355483711f},
-std::array<float,2>{0.645439327f, 0.874616385f},
-std::array<float,2>{0.119614281f, 0.712632418f},
-std::array<float,2>{0.908709645f, 0.00703389198f},
-std::array<float,2>{0.479608715f, 0.176523879f},
-std::array<float,2>{0.695412576f, 0.51281029f},
-std::array<float,2>{0.01206329f, 0.90599227f},
-std::array<float,2>{0.961488307f, 0.382567644f},
-std::array<float,2>{0.147512078f, 0.309127986f},
-std::array<float,2>{0.810691833f, 0.807297885f},
-std::array<float,2>{0.366583765f, 0.6680547f},
-std::array<float,2>{0.57173574f, 0.0880029127f},
-std::array<float,2>{0.0708817914f, 0.061012134f},
-std::array<float,2>{0.892109871f, 0.726634562f},
-std::array<float,2>{0.388516188f, 0.836492896f},
-std::array<float,2>{0.683857322f, 0.313225746f},
-std::array<float,2>{0.304348469f, 0.455303282f},
-std::array<float,2>{0.524760485f, 0.952059329f},
-std::array<float,2>{0.247262061f, 0.598532617f},
-std::array<float,2>{0.8576442f, 0.187672555f},
-std::array<float,2>{0.491764992f, 0.0510472804f},
-std::array<float,2>{0.718139172f, 0.725096703f},
-std::array<float,2>{0.0213067159f, 0.835751116f},
-std::array<float,2>{0.94766885f, 0.324440032f},
-std::array<float,2>{0.129472375f, 0.465114385f},
-std::array<float,2>{0.789615393f, 0.940367639f},
-std::array<float,2>{0.358514279f, 0.608334422f},
-std::array<float,2>{0.580128074f, 0.199057609f},
-std::array<float,2>{0.089269571f, 0.183384418f},
-std::array<float,2>{0.887774348f, 0.500173628f},
-std::array<float,2>{0.404943377f, 0.895002365f},
-std::array<float,2>{0.661984921f, 0.385162026f},
-std::array<float,2>{0.285731733f, 0.301885903f},
-std::array<float,2>{0.50281626f, 0.799924314f},
-std::array<float,2>{0.231626555f, 0.660226047f},
-std::array<float,2>{0.869336665f, 0.0813367143f},
-std::array<float,2>{0.317394286f, 0.22120069f},
-std::array<float,2>{0.607703447f, 0.58836031f},
-std::array<float,2>{0.186226264f, 0.987902164f},
-std::array<float,2>{0.752562761f, 0.477064461f},
-std::array<float,2>{0.0599436797f, 0.351375818f},
-std::array<float,2>{0.997363091f, 0.860643506f},
-std::array<float,2>{0.461092949f, 0.704037011f},
-std::array<float,2>{0.748023331f, 0.0100616226f},
-std::array<float,2>{0.207310513f, 0.10795331f},
-std::array<float,2>{0.82648623f, 0.644285142f},
-std::array<float,2>{0.262816668f, 0.753821015f},
-std::array<float,2>{0.537376404f, 0.27380389f},
-std::array<float,2>{0.419415921f, 0.419520408f},
-std::array<float,2>{0.628643155f, 0.916949749f},
-std::array<float,2>{0.106628314f, 0.534644902f},
-std::array<float,2>{0.927426159f, 0.155584604f},
-std::array<float,2>{0.275064558f, 0.0712043718f},
-std::array<float,2>{0.555063426f, 0.673330307f},
-std::array<float,2>{0.191556424f, 0.794492841f},
-std::array<float,2>{0.835081458f, 0.284671187f},
-std::array<float,2>{0.124389283f, 0.391152948f},
-std::array<float,2>{0.912744462f, 0.87909919f},
-std::array<float,2>{0.432525694f, 0.528841972f},
-std::array<float,2>{0.642222226f, 0.161162734f},
-std::array<float,2>{0.16121532f, 0.218103066f},
-std::array<float,2>{0.777754903f, 0.617826045f},
-std::array<float,2>{0.337884188f, 0.960625708f},
-std::array<float,2>{0.611826003f, 0.44049105f},
-std::array<float,2>{0.442474037f, 0.332096875f},
-std::array<float,2>{0.733621359f, 0.820145726f},
-std::array<float,2>{0.0431096926f, 0.7345438f},
-std::array<float,2>{0.971188784f, 0.0404087715f},
-std::array<float,2>{0.38453117f, 0.131562606f},
-std::array<float,2>{0.681823254f, 0.553843856f},
-std::array<float,2>{0.0769419149f, 0.933204412f},
-std::array<float,2>{0.895599842f, 0.42687425f},
-std::array<float,2>{0.24321495f, 0.260731936f},
-std::array<float,2>{0.852322042f, 0.770564735f},
-std::array<float,2>{0.300424039f, 0.628787696f},
-std::array<float,2>{0.528364837f, 0.12253762f},
-std::array<float,2>{0.00915352628f, 0.0227330066f},
-std::array<float,2>{0.965508938f, 0.693650603f},
-std::array<float,2>{0.48159191f, 0.844055951f},
-std::array<float,2>{0.700269341f, 0.370513529f},
-std::array<float,2>{0.359487414f, 0.48893106f},
-std::array<float,2>{0.575424612f, 0.97944653f},
-std::array<float,2>{0.142422244f, 0.571546733f},
-std::array<float,2>{0.806063592f, 0.249120146f},
-std::array<float,2>{0.425473571f, 0.11168962f},
-std::array<float,2>{0.654511988f, 0.634460151f},
-std::array<float,2>{0.112093888f, 0.779666543f},
-std::array<float,2>{0.914648652f, 0.25410527f},
-std::array<float,2>{0.202675596f, 0.431199163f},
-std::array<float,2>{0.836116135f, 0.923960447f},
-std::array<float,2>{0.268136084f, 0.562080562f},
-std::array<float,2>{0.548550129f, 0.138016209f},
-std::array<float,2>{0.0320701003f, 0.239576861f},
-std::array<float,2>{0.977848411f, 0.563666761f},
-std::array<float,2>{0.448565453f, 0.969178617f},
-std::array<float,2>{0.721783638f, 0.499276221f},
-std::array<float,2>{0.331362277f, 0.361903638f},
-std::array<float,2>{0.620023668f, 0.856669605f},
-std::array<float,2>{0.169138446f, 0.69827646f},
-std::array<float,2>{0.766998112f, 0.0244468208f},
-std::array<float,2>{0.307742119f, 0.16644147f},
-std::array<float,2>{0.51936096f, 0.521517098f},
-std::array<float,2>{0.235204652f, 0.884877503f},
-std::array<float,2>{0.84782064f, 0.403955579f},
-std::array<float,2>{0.0685905814f, 0.289077342f},
-std::array<float,2>{0.904843509f, 0.784239173f},
-std::array<float,2>{0.376045406f, 0.680063903f},
-std::array<float,2>{0.674666464f, 0.0629537627f},
-std::array<float,2>{0.151142687f, 0.0327604935f},
-std::array<float,2>{0.80031395f, 0.743698716f},
-std::array<float,2>{0.368045807f, 0.824782491f},
-std::array<float,2>{0.567372084f, 0.339800745f},
-std::array<float,2>{0.473283321f, 0.445956767f},
-std::array<float,2>{0.690931022f, 0.967111886f},
-std::array<float,2>{0.00773921516f, 0.609423816f},
-std::array<float,2>{0.955118954f, 0.206159353f},
-std::array<float,2>{0.344599217f, 0.00227032253f},
-std::array<float,2>{0.587984324f, 0.718575358f},
-std::array<float,2>{0.133709922f, 0.869505465f},
-std::array<float,2>{0.78697449f, 0.352671146f},
-std::array<float,2>{0.0290744714f, 0.476445496f},
-std::array<float,2>{0.942535818f, 0.994970202f},
-std::array<float,2>{0.497411221f, 0.58076793f},
-std::array<float,2>{0.704893589f, 0.229865357f},
-std::array<float,2>{0.224331647f, 0.145345032f},
-std::array<float,2>{0.865970314f, 0.542147756f},
-std::array<float,2>{0.289598048f, 0.907471895f},
-std::array<float,2>{0.512735069f, 0.410073578f},
-std::array<float,2>{0.391206354f, 0.273373216f},
-std::array<float,2>{0.669157743f, 0.75821805f},
-std::array<float,2>{0.0817974284f, 0.649478137f},
-std::array<float,2>{0.879636824f, 0.0968722403f},
-std::array<float,2>{0.453476697f, 0.193129957f},
-std::array<float,2>{0.740650773f, 0.596326411f},
-std::array<float,2>{0.0531595387f, 0.945868731f},
-std::array<float,2>{0.991518021f, 0.457947046f},
-std::array<float,2>{0.173382804f, 0.318884104f},
-std::array<float,2>{0.763667762f, 0.840337396f},
-std::array<float,2>{0.322666198f, 0.732852399f},
-std::array<float,2>{0.600476086f, 0.0585342161f},
-std::array<float,2>{0.100021817f, 0.0918155015f},
-std::array<float,2>{0.934266925f, 0.66728878f},
-std::array<float,2>{0.411478788f, 0.810907722f},
-std::array<float,2>{0.638449669f, 0.305835694f},
-std::array<float,2>{0.251464576f, 0.378719687f},
-std::array<float,2>{0.545682609f, 0.900975764f},
-std::array<float,2>{0.216297299f, 0.508921325f},
-std::array<float,2>{0.814081252f, 0.173429176f},
-std::array<float,2>{0.470139176f, 0.103083231f},
-std::array<float,2>{0.69384712f, 0.647817492f},
-std::array<float,2>{0.000896738959f, 0.756856799f},
-std::array<float,2>{0.960632682f, 0.277983934f},
-std::array<float,2>{0.155289188f, 0.416445524f},
-std::array<float,2>{0.803476036f, 0.91885376f},
-std::array<float,2>{0.372745335f, 0.536694646f},
-std::array<float,2>{0.564918876f, 0.150310695f},
-std::array<float,2>{0.0630569533f, 0.223134577f},
-std::array<float,2>{0.900771379f, 0.589966178f},
-std::array<float,2>{0.38208285f, 0.988370478f},
-std::array<float,2>{0.678471625f, 0.481013536f},
-std::array<float,2>{0.312104106f, 0.345103502f},
-std::array<float,2>{0.522613943f, 0.867101789f},
-std::array<float,2>{0.242151275f, 0.708938658f},
-std::array<float,2>{0.84537673f, 0.015557928f},
-std::array<float,2>{0.333490461f, 0.186527193f},
-std::array<float,2>{0.624023497f, 0.505436957f},
-std::array<float,2>{0.166272283f, 0.893716335f},
-std::array<float,2>{0.770731628f, 0.386818588f},
-std::array<float,2>{0.037437629f, 0.29790169f},
-std::array<float,2>{0.980692387f, 0.802235365f},
-std::array<float,2>{0.450165391f, 0.659258783f},
-std::array<float,2>{0.724793196f, 0.0834964812f},
-std::array<float,2>{0.196662426f, 0.0487884879f},
-std::array<float,2>{0.842157841f, 0.719301522f},
-std::array<float,2>{0.270855784f, 0.831779659f},
-std::array<float,2>{0.552579343f, 0.320907056f},
-std::array<float,2>{0.428879857f, 0.46423313f},
-std::array<float,2>{0.649193645f, 0.942233741f},
-std::array<float,2>{0.117068067f, 0.60194844f},
-std::array<float,2>{0.918152869f, 0.201964974f},
-std::array<float,2>{0.255714774f, 0.0178640354f},
-std::array<float,2>{0.539130926f, 0.689314008f},
-std::array<float,2>{0.213693067f, 0.850335002f},
-std::array<float,2>{0.819188714f, 0.374095768f},
-std::array<float,2>{0.0961865708f, 0.487175703f},
-std::array<float,2>{0.932208598f, 0.980665624f},
-std::array<float,2>{0.409085304f, 0.577305734f},
-std::array<float,2>{0.633888423f, 0.24480851f},
-std::array<float,2>{0.178883418f, 0.127951011f},
-std::array<float,2>{0.760107696f, 0.548198342f},
-std::array<float,2>{0.326669991f, 0.934922278f},
-std::array<float,2>{0.597361326f, 0.424592972f},
-std::array<float,2>{0.458748788f, 0.263809294f},
-std::array<float,2>{0.736191452f, 0.768342733f},
-std::array<float,2>{0.047792118f, 0.63146174f},
-std::array<float,2>{0.98461473f, 0.11825908f},
-std::array<float,2>{0.394808054f, 0.214317501f},
-std::array<float,2>{0.667164207f, 0.623923421f},
-std::array<float,2>{0.083307907f, 0.956488729f},
-std::array<float,2>{0.878425241f, 0.442436814f},
-std::array<float,2>{0.220009118f, 0.33081165f},
-std::array<float,2>{0.859839797f, 0.813798785f},
-std::array<float,2>{0.29516229f, 0.738329411f},
-std::array<float,2>{0.50920552f, 0.0452788584f},
-std::array<float,2>{0.0266162567f, 0.0773510709f},
-std::array<float,2>{0.940987766f, 0.678267479f},
-std::array<float,2>{0.494327307f, 0.790983796f},
-std::array<float,2>{0.710663974f, 0.288059205f},
-std::array<float,2>{0.350307971f, 0.39582628f},
-std::array<float,2>{0.592662692f, 0.875035286f},
-std::array<float,2>{0.140458852f, 0.526508451f},
-std::array<float,2>{0.783127785f, 0.157378554f},
-std::array<float,2>{0.415812492f, 0.0353042558f},
-std::array<float,2>{0.63008523f, 0.747604668f},
-std::array<float,2>{0.101574712f, 0.823687136f},
-std::array<float,2>{0.922120094f, 0.342608422f},
-std::array<float,2>{0.206916749f, 0.452533394f},
-std::array<float,2>{0.82237047f, 0.962478757f},
-std::array<float,2>{0.261704624f, 0.615258276f},
-std::array<float,2>{0.532309055f, 0.20724155f},
-std::array<float,2>{0.0570209734f, 0.169980779f},
-std::array<float,2>{0.992469013f, 0.518287301f},
-std::array<float,2>{0.465869159f, 0.88909477f},
-std::array<float,2>{0.744810045f, 0.400269151f},
-std::array<float,2>{0.312507302f, 0.294663638f},
-std::array<float,2>{0.605436206f, 0.787204266f},
-std::array<float,2>{0.181709155f, 0.684006751f},
-std::array<float,2>{0.756495595f, 0.0686811879f},
-std::array<float,2>{0.284494311f, 0.235600501f},
-std::array<float,2>{0.507291973f, 0.569916844f},
-std::array<float,2>{0.229306027f, 0.973153532f},
-std::array<float,2>{0.872872651f, 0.492914736f},
-std::array<float,2>{0.0913495049f, 0.366414696f},
-std::array<float,2>{0.882849813f, 0.854233921f},
-std::array<float,2>{0.401655912f, 0.701379836f},
-std::array<float,2>{0.656511068f, 0.0287757739f},
-std::array<float,2>{0.127336457f, 0.114977665f},
-std::array<float,2>{0.794731617f, 0.637611747f},
-std::array<float,2>{0.354776502f, 0.773942173f},
-std::array<float,2>{0.584820449f, 0.250038594f},
-std::array<float,2>{0.486033052f, 0.436230808f},
-std::array<float,2>{0.713981152f, 0.926155329f},
-std::array<float,2>{0.0182387494f, 0.556396604f},
-std::array<float,2>{0.94958055f, 0.133998945f},
-std::array<float,2>{0.364991874f, 0.0866200626f},
-std::array<float,2>{0.572388172f, 0.671100318f},
-std::array<float,2>{0.14586167f, 0.806020677f},
-std::array<float,2>{0.808933616f, 0.311462671f},
-std::array<float,2>{0.0141524877f, 0.379881799f},
-std::array<float,2>{0.963476002f, 0.903301954f},
-std::array<float,2>{0.47771278f, 0.513702095f},
-std::array<float,2>{0.697999954f, 0.178878382f},
-std::array<float,2>{0.249834791f, 0.189914539f},
-std::array<float,2>{0.856863022f, 0.6007815f},
-std::array<float,2>{0.301784962f, 0.95035255f},
-std::array<float,2>{0.527299345f, 0.454008132f},
-std::array<float,2>{0.39060998f, 0.315909207f},
-std::array<float,2>{0.685743392f, 0.838236332f},
-std::array<float,2>{0.0728492737f, 0.728760481f},
-std::array<float,2>{0.893687606f, 0.0589448512f},
-std::array<float,2>{0.438163489f, 0.143409997f},
-std::array<float,2>{0.728229403f, 0.546257555f},
-std::array<float,2>{0.0419471376f, 0.911822975f},
-std::array<float,2>{0.974530041f, 0.413114429f},
-std::array<float,2>{0.159372047f, 0.268745035f},
-std::array<float,2>{0.774070442f, 0.763695836f},
-std::array<float,2>{0.343156189f, 0.656079769f},
-std::array<float,2>{0.614172041f, 0.0986207649f},
-std::array<float,2>{0.117808104f, 0.00507386774f},
-std::array<float,2>{0.907008708f, 0.714185536f},
-std::array<float,2>{0.4362638f, 0.872580588f},
-std::array<float,2>{0.648436844f, 0.359264106f},
-std::array<float,2>{0.278319955f, 0.47063452f},
-std::array<float,2>{0.560724139f, 0.996882498f},
-std::array<float,2>{0.188385472f, 0.584939063f},
-std::array<float,2>{0.830102444f, 0.231257126f},
-std::array<float,2>{0.463848829f, 0.00792089012f},
-std::array<float,2>{0.748301148f, 0.705793798f},
-std::array<float,2>{0.0611590408f, 0.861535013f},
-std::array<float,2>{0.998835623f, 0.34814164f},
-std::array<float,2>{0.184749201f, 0.480027765f},
-std::array<float,2>{0.751789451f, 0.985098541f},
-std::array<float,2>{0.319018662f, 0.587238371f},
-std::array<float,2>{0.606993318f, 0.219082519f},
-std::array<float,2>{0.107808538f, 0.153621331f},
-std::array<float,2>{0.929355621f, 0.532735109f},
-std::array<float,2>{0.420973271f, 0.915641427f},
-std::array<float,2>{0.626726806f, 0.421804398f},
-std::array<float,2>{0.264386952f, 0.277232319f},
-std::array<float,2>{0.536235094f, 0.751379192f},
-std::array<float,2>{0.210321903f, 0.640746713f},
-std::array<float,2>{0.824641526f, 0.106719211f},
-std::array<float,2>{0.356098384f, 0.195755437f},
-std::array<float,2>{0.579927266f, 0.606975257f},
-std::array<float,2>{0.131808668f, 0.938322783f},
-std::array<float,2>{0.791888356f, 0.468603253f},
-std::array<float,2>{0.0233104043f, 0.327809215f},
-std::array<float,2>{0.94724834f, 0.832502127f},
-std::array<float,2>{0.489571571f, 0.723304868f},
-std::array<float,2>{0.716113091f, 0.0534474552f},
-std::array<float,2>{0.233008102f, 0.0797478184f},
-std::array<float,2>{0.868865907f, 0.663334608f},
-std::array<float,2>{0.287798882f, 0.798402786f},
-std::array<float,2>{0.500858366f, 0.303441912f},
-std::array<float,2>{0.403276533f, 0.384415627f},
-std::array<float,2>{0.662743986f, 0.896677792f},
-std::array<float,2>{0.0865034387f, 0.502685726f},
-std::array<float,2>{0.889852643f, 0.180123359f},
-std::array<float,2>{0.298751444f, 0.12463399f},
-std::array<float,2>{0.529742241f, 0.626263797f},
-std::array<float,2>{0.245737463f, 0.772045374f},
-std::array<float,2>{0.854568243f, 0.258813977f},
-std::array<float,2>{0.0744618252f, 0.428209603f},
-std::array<float,2>{0.897101521f, 0.930566847f},
-std::array<float,2>{0.386175483f, 0.552677214f},
-std::array<float,2>{0.681435287f, 0.129002094f},
-std::array<float,2>{0.14438501f, 0.246722937f},
-std::array<float,2>{0.806980431f, 0.573189378f},
-std::array<float,2>{0.363165259f, 0.978193402f},
-std::array<float,2>{0.576477587f, 0.491856784f},
-std::array<float,2>{0.484358281f, 0.367571622f},
-std::array<float,2>{0.702959776f, 0.846185982f},
-std::array<float,2>{0.0104699619f, 0.691710293f},
-std::array<float,2>{0.967007697f, 0.0203551445f},
-std::array<float,2>{0.430911064f, 0.164052844f},
-std::array<float,2>{0.644207358f, 0.529506505f},
-std::array<float,2>{0.121546946f, 0.882778525f},
-std::array<float,2>{0.910157323f, 0.394097298f},
-std::array<float,2>{0.194595262f, 0.281688064f},
-std::array<float,2>{0.833043098f, 0.796470404f},
-std::array<float,2>{0.276639402f, 0.674109399f},
-std::array<float,2>{0.558240473f, 0.0725020096f},
-std::array<float,2>{0.0463394001f, 0.0414293483f},
-std::array<float,2>{0.970075428f, 0.737309813f},
-std::array<float,2>{0.444860131f, 0.817598999f},
-std::array<float,2>{0.731458187f, 0.33482796f},
-std::array<float,2>{0.338599175f, 0.437754065f},
-std::array<float,2>{0.610669494f, 0.958715379f},
-std::array<float,2>{0.162222609f, 0.620999813f},
-std::array<float,2>{0.779981256f, 0.215649366f},
-std::array<float,2>{0.378650993f, 0.0644975007f},
-std::array<float,2>{0.672260284f, 0.68294847f},
-std::array<float,2>{0.0669277012f, 0.783009529f},
-std::array<float,2>{0.903140664f, 0.291217268f},
-std::array<float,2>{0.237727031f, 0.40467304f},
-std::array<float,2>{0.850527406f, 0.884514153f},
-std::array<float,2>{0.306218892f, 0.520727694f},
-std::array<float,2>{0.516569972f, 0.165834308f},
-std::array<float,2>{0.00548428809f, 0.204059079f},
-std::array<float,2>{0.954068303f, 0.611873865f},
-std::array<float,2>{0.475231886f, 0.966140926f},
-std::array<float,2>{0.689321101f, 0.447981894f},
-std::array<float,2>{0.370644629f, 0.337014794f},
-std::array<float,2>{0.569995403f, 0.826399267f},
-std::array<float,2>{0.148653075f, 0.74464339f},
-std::array<float,2>{0.7968871f, 0.0348350629f},
-std::array<float,2>{0.265661359f, 0.138987631f},
-std::array<float,2>{0.54977268f, 0.560337603f},
-std::array<float,2>{0.200396881f, 0.922214508f},
-std::array<float,2>{0.838021636f, 0.43165946f},
-std::array<float,2>{0.109615967f, 0.257204354f},
-std::array<float,2>{0.917105019f, 0.77859211f},
-std::array<float,2>{0.422592044f, 0.636560082f},
-std::array<float,2>{0.652721822f, 0.109643139f},
-std::array<float,2>{0.171451405f, 0.0270327553f},
-std::array<float,2>{0.769126534f, 0.695676327f},
-std::array<float,2>{0.329856306f, 0.857563019f},
-std::array<float,2>{0.618136108f, 0.360702574f},
-std::array<float,2>{0.44631815f, 0.496684283f},
-std::array<float,2>{0.718900383f, 0.972332358f},
-std::array<float,2>{0.0340759382f, 0.565759063f},
-std::array<float,2>{0.978601515f, 0.240875036f},
-std::array<float,2>{0.321439654f, 0.0546887666f},
-std::array<float,2>{0.5990026f, 0.73152256f},
-std::array<float,2>{0.175396934f, 0.843125224f},
-std::array<float,2>{0.764862478f, 0.318331987f},
-std::array<float,2>{0.0516991951f, 0.459161639f},
-std::array<float,2>{0.989900351f, 0.948417604f},
-std::array<float,2>{0.4562608f, 0.595109582f},
-std::array<float,2>{0.738467634f, 0.19338493f},
-std::array<float,2>{0.2187154f, 0.17576395f},
-std::array<float,2>{0.815037549f, 0.510206938f},
-std::array<float,2>{0.253818065f, 0.899528027f},
-std::array<float,2>{0.54422164f, 0.375009298f},
-std::array<float,2>{0.413856924f, 0.306645721f},
-std::array<float,2>{0.640463948f, 0.809979022f},
-std::array<float,2>{0.0984327495f, 0.66546452f},
-std::array<float,2>{0.935902417f, 0.0903794393f},
-std::array<float,2>{0.499656677f, 0.226593494f},
-std::array<float,2>{0.706490636f, 0.579432607f},
-std::array<float,2>{0.0299608447f, 0.992995381f},
-std::array<float,2>{0.945293963f, 0.473234117f},
-std::array<float,2>{0.134926155f, 0.35512051f},
-std::array<float,2>{0.788324356f, 0.8690871f},
-std::array<float,2>{0.345868826f, 0.716629744f},
-std::array<float,2>{0.586659789f, 0.000719925622f},
-std::array<float,2>{0.0788101479f, 0.0947975218f},
-std::array<float,2>{0.881685197f, 0.651757479f},
-std::array<float,2>{0.392922759f, 0.759992421f},
-std::array<float,2>{0.671177864f, 0.270252675f},
-std::array<float,2>{0.291558802f, 0.407424331f},
-std::array<float,2>{0.515480638f, 0.90955925f},
-std::array<float,2>{0.22635968f, 0.539683104f},
-std::array<float,2>{0.864305496f, 0.1470723f},
-std::array<float,2>{0.49608919f, 0.0753656551f},
-std::array<float,2>{0.709062874f, 0.677180469f},
-std::array<float,2>{0.0263545644f, 0.791475892f},
-std::array<float,2>{0.940002739f, 0.28635329f},
-std::array<float,2>{0.139553115f, 0.396933287f},
-std::array<float,2>{0.782002211f, 0.877315879f},
-std::array<float,2>{0.351143211f, 0.524973214f},
-std::array<float,2>{0.593342781f, 0.159278318f},
-std::array<float,2>{0.082359165f, 0.210937694f},
-std::array<float,2>{0.877053618f, 0.623039603f},
-std::array<float,2>{0.395682752f, 0.954600751f},
-std::array<float,2>{0.666749597f, 0.443975002f},
-std::array<float,2>{0.296462536f, 0.329102784f},
-std::array<float,2>{0.508457184f, 0.815992296f},
-std::array<float,2>{0.219148085f, 0.741393447f},
-std::array<float,2>{0.861260116f, 0.0444353595f},
-std::array<float,2>{0.327944219f, 0.125678495f},
-std::array<float,2>{0.595858514f, 0.549347043f},
-std::array<float,2>{0.178117588f, 0.936713517f},
-std::array<float,2>{0.760829031f, 0.422977775f},
-std::array<float,2>{0.0488135926f, 0.262061566f},
-std::array<float,2>{0.986000478f, 0.766564429f},
-std::array<float,2>{0.457476705f, 0.629900336f},
-std::array<float,2>{0.73522526f, 0.119727239f},
-std::array<float,2>{0.214795977f, 0.0174242426f},
-std::array<float,2>{0.819664776f, 0.690802097f},
-std::array<float,2>{0.254279524f, 0.847992778f},
-std::array<float,2>{0.540630221f, 0.372037083f},
-std::array<float,2>{0.409808159f, 0.484957188f},
-std::array<float,2>{0.633241892f, 0.983222008f},
-std::array<float,2>{0.0972818136f, 0.575185597f},
-std::array<float,2>{0.932695329f, 0.243490294f},
-std::array<float,2>{0.27028653f, 0.0500574745f},
-std::array<float,2>{0.551756442f, 0.720737934f},
-std::array<float,2>{0.195639938f, 0.829892218f},
-std::array<float,2>{0.842836499f, 0.322665721f},
-std::array<float,2>{0.116205193f, 0.461622953f},
-std::array<float,2>{0.919537365f, 0.943752587f},
-std::array<float,2>{0.427947879f, 0.603930771f},
-std::array<float,2>{0.649585545f, 0.199873835f},
-std::array<float,2>{0.16756016f, 0.184645474f},
-std::array<float,2>{0.770152926f, 0.507521689f},
-std::array<float,2>{0.33234328f, 0.891748667f},
-std::array<float,2>{0.623452783f, 0.389957696f},
-std::array<float,2>{0.450900644f, 0.300320804f},
-std::array<float,2>{0.72606945f, 0.803207457f},
-std::array<float,2>{0.0387474895f, 0.658064008f},
-std::array<float,2>{0.982156634f, 0.0849778652f},
-std::array<float,2>{0.381149203f, 0.22564286f},
-std::array<float,2>{0.678916395f, 0.593430996f},
-std::array<float,2>{0.0640890002f, 0.990487874f},
-std::array<float,2>{0.90158385f, 0.484344423f},
-std::array<float,2>{0.241134882f, 0.346949071f},
-std::array<float,2>{0.844142437f, 0.86479938f},
-std::array<float,2>{0.311195284f, 0.710456729f},
-std::array<float,2>{0.521541595f, 0.0134009793f},
-std::array<float,2>{0.00122634007f, 0.105239093f},
-std::array<float,2>{0.959255755f, 0.64467448f},
-std::array<float,2>{0.468939662f, 0.754002571f},
-std::array<float,2>{0.694889784f, 0.280495793f},
-std::array<float,2>{0.372003734f, 0.415632486f},
-std::array<float,2>{0.566325545f, 0.920771897f},
-std::array<float,2>{0.154355988f, 0.537261963f},
-std::array<float,2>{0.804462314f, 0.150398478f},
-std::array<float,2>{0.437031537f, 0.006559256f},
-std::array<float,2>{0.646707118f, 0.711419582f},
-std::array<float,2>{0.118307337f, 0.873638868f},
-std::array<float,2>{0.907672644f, 0.356908441f},
-std::array<float,2>{0.188963905f, 0.471850097f},
-std::array<float,2>{0.831991553f, 0.998854399f},
-std::array<float,2>{0.278356284f, 0.583533883f},
-std::array<float,2>{0.561682105f, 0.233881146f},
-std::array<float,2>{0.0421503671f, 0.141789153f},
-std::array<float,2>{0.973540962f, 0.543756723f},
-std::array<float,2>{0.439044684f, 0.913043857f},
-std::array<float,2>{0.727224052f, 0.411617219f},
-std::array<float,2>{0.342415094f, 0.266624391f},
-std::array<float,2>{0.614905715f, 0.762922108f},
-std::array<float,2>{0.158407807f, 0.653155386f},
-std::array<float,2>{0.774702072f, 0.101016931f},
-std::array<float,2>{0.300867081f, 0.1886141f},
-std::array<float,2>{0.525454998f, 0.598814309f},
-std::array<float,2>{0.248870566f, 0.952162802f},
-std::array<float,2>{0.855995476f, 0.456746191f},
-std::array<float,2>{0.0741228461f, 0.313783497f},
-std::array<float,2>{0.892842829f, 0.837598503f},
-std::array<float,2>{0.38876152f, 0.728459418f},
-std::array<float,2>{0.686619639f, 0.0622491725f},
-std::array<float,2>{0.14460054f, 0.0891606882f},
-std::array<float,2>{0.810229003f, 0.669842541f},
-std::array<float,2>{0.363934517f, 0.808418512f},
-std::array<float,2>{0.573318064f, 0.309654772f},
-std::array<float,2>{0.476624697f, 0.381421983f},
-std::array<float,2>{0.698692381f, 0.904687345f},
-std::array<float,2>{0.0153079452f, 0.512130022f},
-std::array<float,2>{0.964754224f, 0.177714154f},
-std::array<float,2>{0.353854716f, 0.116117895f},
-std::array<float,2>{0.58501178f, 0.639854729f},
-std::array<float,2>{0.128343284f, 0.775970101f},
-std::array<float,2>{0.79336834f, 0.253233671f},
-std::array<float,2>{0.0190947428f, 0.434382528f},
-std::array<float,2>{0.950623631f, 0.929316103f},
-std::array<float,2>{0.485297382f, 0.558187246f},
-std::array<float,2>{0.713760436f, 0.136227429f},
-std::array<float,2>{0.229568049f, 0.237940341f},
-std::array<float,2>{0.871745825f, 0.566615283f},
-std::array<float,2>{0.283349007f, 0.97608608f},
-std::array<float,2>{0.506541729f, 0.496012211f},
-std::array<float,2>{0.40113765f, 0.363967478f},
-std::array<float,2>{0.657425821f, 0.852418423f},
-std::array<float,2>{0.0901165232f, 0.699966252f},
-std::array<float,2>{0.884692371f, 0.030152699f},
-std::array<float,2>{0.465135694f, 0.168462723f},
-std::array<float,2>{0.74557662f, 0.515967965f},
-std::array<float,2>{0.0582641922f, 0.887279689f},
-std::array<float,2>{0.993841767f, 0.402166367f},
-std::array<float,2>{0.182758495f, 0.29593116f},
-std::array<float,2>{0.757085919f, 0.786474645f},
-std::array<float,2>{0.314181f, 0.686312199f},
-std::array<float,2>{0.603868425f, 0.0680561587f},
-std::array<float,2>{0.103115194f, 0.0386832803f},
-std::array<float,2>{0.923141003f, 0.749510527f},
-std::array<float,2>{0.414837807f, 0.821699023f},
-std::array<float,2>{0.629019678f, 0.340477735f},
-std::array<float,2>{0.260136455f, 0.450719804f},
-std::array<float,2>{0.531287909f, 0.963469028f},
-std::array<float,2>{0.205167636f, 0.615211964f},
-std::array<float,2>{0.823680937f, 0.209931284f},
-std::array<float,2>{0.444146484f, 0.0392221361f},
-std::array<float,2>{0.730901659f, 0.736100256f},
-std::array<float,2>{0.0455594361f, 0.819027007f},
-std::array<float,2>{0.968824506f, 0.333804965f},
-std::array<float,2>{0.163912356f, 0.439795077f},
-std::array<float,2>{0.781190991f, 0.959698617f},
-std::array<float,2>{0.339477569f, 0.618658483f},
-std::array<float,2>{0.609787703f, 0.216867611f},
-std::array<float,2>{0.122338884f, 0.160281062f},
-std::array<float,2>{0.911285162f, 0.527624011f},
-std::array<float,2>{0.430518121f, 0.880000353f},
-std::array<float,2>{0.643093109f, 0.392536134f},
-std::array<float,2>{0.275477797f, 0.283529162f},
-std::array<float,2>{0.556883931f, 0.793694258f},
-std::array<float,2>{0.194098666f, 0.672701716f},
-std::array<float,2>{0.83203882f, 0.0716945753f},
-std::array<float,2>{0.362208813f, 0.24813585f},
-std::array<float,2>{0.577444077f, 0.570615828f},
-std::array<float,2>{0.142610937f, 0.979626238f},
-std::array<float,2>{0.807685614f, 0.489975959f},
-std::array<float,2>{0.0112987626f, 0.369547427f},
-std::array<float,2>{0.968419611f, 0.844916582f},
-std::array<float,2>{0.482840925f, 0.695199192f},
-std::array<float,2>{0.702001572f, 0.0215427689f},
-std::array<float,2>{0.24509652f, 0.121257812f},
-std::array<float,2>{0.854441524f, 0.627269089f},
-std::array<float,2>{0.297456741f, 0.770449758f},
-std::array<float,2>{0.530530095f, 0.261591047f},
-std::array<float,2>{0.385222226f, 0.426739603f},
-std::array<float,2>{0.679961979f, 0.932341993f},
-std::array<float,2>{0.0759787858f, 0.552924871f},
-std::array<float,2>{0.897610784f, 0.132323608f},
-std::array<float,2>{0.288316965f, 0.0807742104f},
-std::array<float,2>{0.501493096f, 0.662020981f},
-std::array<float,2>{0.233464167f, 0.799249291f},
-std::array<float,2>{0.867990732f, 0.30107215f},
-std::array<float,2>{0.0871970356f, 0.386065871f},
-std::array<float,2>{0.889368951f, 0.895654559f},
-std::array<float,2>{0.40343383f, 0.501939535f},
-std::array<float,2>{0.664061725f, 0.18183054f},
-std::array<float,2>{0.132505611f, 0.19767876f},
-std::array<float,2>{0.792487621f, 0.608583808f},
-std::array<float,2>{0.356853068f, 0.940705836f},
-std::array<float,2>{0.578156769f, 0.466294944f},
-std::array<float,2>{0.48917979f, 0.325951248f},
-std::array<float,2>{0.715012968f, 0.834834218f},
-std::array<float,2>{0.0222143233f, 0.725660264f},
-std::array<float,2>{0.945344448f, 0.0524637736f},
-std::array<float,2>{0.420150131f, 0.155230343f},
-std::array<float,2>{0.625355542f, 0.533780694f},
-std::array<float,2>{0.109126613f, 0.917151392f},
-std::array<float,2>{0.9282884f, 0.418221921f},
-std::array<float,2>{0.209671989f, 0.274869591f},
-std::array<float,2>{0.825226724f, 0.752502799f},
-std::array<float,2>{0.264976859f, 0.642602444f},
-std::array<float,2>{0.535843372f, 0.10905271f},
-std::array<float,2>{0.0619735233f, 0.011625343f},
-std::array<float,2>{0.999709547f, 0.704177856f},
-std::array<float,2>{0.464303315f, 0.860073328f},
-std::array<float,2>{0.749576271f, 0.350008219f},
-std::array<float,2>{0.319648981f, 0.477796704f},
-std::array<float,2>{0.605884314f, 0.986819386f},
-std::array<float,2>{0.184106022f, 0.589452147f},
-std::array<float,2>{0.750828922f, 0.222401664f},
-std::array<float,2>{0.393898368f, 0.0960090607f},
-std::array<float,2>{0.670884609f, 0.649101734f},
-std::array<float,2>{0.0796932429f, 0.759347558f},
-std::array<float,2>{0.882788241f, 0.27162376f},
-std::array<float,2>{0.225500137f, 0.40850696f},
-std::array<float,2>{0.864178777f, 0.906395733f},
-std::array<float,2>{0.292786658f, 0.541642368f},
-std::array<float,2>{0.514371574f, 0.145712793f},
-std::array<float,2>{0.0310121141f, 0.229123443f},
-std::array<float,2>{0.943632245f, 0.581673384f},
-std::array<float,2>{0.498241544f, 0.995413184f},
-std::array<float,2>{0.705100715f, 0.47518301f},
-std::array<float,2>{0.347352922f, 0.352074504f},
-std::array<float,2>{0.587812543f, 0.870899856f},
-std::array<float,2>{0.136279166f, 0.71752274f},
-std::array<float,2>{0.7877298f, 0.00382700586f},
-std::array<float,2>{0.252222389f, 0.172608852f},
-std::array<float,2>{0.54311806f, 0.507876992f},
-std::array<float,2>{0.217682809f, 0.901822031f},
-std::array<float,2>{0.815440238f, 0.377686739f},
-std::array<float,2>{0.0986406878f, 0.304919064f},
-std::array<float,2>{0.93727845f, 0.812017441f},
-std::array<float,2>{0.412454784f, 0.666434586f},
-std::array<float,2>{0.63876158f, 0.0936819315f},
-std::array<float,2>{0.174130857f, 0.0568775833f},
-std::array<float,2>{0.764034808f, 0.734365642f},
-std::array<float,2>{0.320670515f, 0.841522098f},
-std::array<float,2>{0.598317206f, 0.320012152f},
-std::array<float,2>{0.455434203f, 0.45809105f},
-std::array<float,2>{0.740170062f, 0.947092891f},
-std::array<float,2>{0.0518139862f, 0.597567439f},
-std::array<float,2>{0.988282204f, 0.191809654f},
-std::array<float,2>{0.328592628f, 0.0241375323f},
-std::array<float,2>{0.618909597f, 0.697596371f},
-std::array<float,2>{0.170556098f, 0.855774105f},
-std::array<float,2>{0.768405139f, 0.363148481f},
-std::array<float,2>{0.0348052643f, 0.498806268f},
-std::array<float,2>{0.979879975f, 0.970645666f},
-std::array<float,2>{0.446034908f, 0.563384116f},
-std::array<float,2>{0.71995914f, 0.238392726f},
-std::array<float,2>{0.199240983f, 0.136786431f},
-std::array<float,2>{0.83938688f, 0.560847461f},
-std::array<float,2>{0.267473727f, 0.924906015f},
-std::array<float,2>{0.55049336f, 0.430248708f},
-std::array<float,2>{0.423259109f, 0.255719721f},
-std::array<float,2>{0.653380573f, 0.780723035f},
-std::array<float,2>{0.1112011f, 0.633303702f},
-std::array<float,2>{0.916632354f, 0.112619087f},
-std::array<float,2>{0.476321816f, 0.205255643f},
-std::array<float,2>{0.687560916f, 0.611281812f},
-std::array<float,2>{0.0048271087f, 0.967880189f},
-std::array<float,2>{0.954140544f, 0.446623862f},
-std::array<float,2>{0.149539933f, 0.338137329f},
-std::array<float,2>{0.798512638f, 0.825376213f},
-std::array<float,2>{0.36951986f, 0.743034303f},
-std::array<float,2>{0.568711877f, 0.0321103521f},
-std::array<float,2>{0.0675436109f, 0.0642257333f},
-std::array<float,2>{0.903414905f, 0.681501806f},
-std::array<float,2>{0.377414078f, 0.784012973f},
-std::array<float,2>{0.673583448f, 0.290228724f},
-std::array<float,2>{0.305543631f, 0.402374655f},
-std::array<float,2>{0.517364144f, 0.886447847f},
-std::array<float,2>{0.237133607f, 0.522761881f},
-std::array<float,2>{0.851006389f, 0.167026043f},
-std::array<float,2>{0.460143745f, 0.11761681f},
-std::array<float,2>{0.737193584f, 0.632738769f},
-std::array<float,2>{0.0496229976f, 0.769294024f},
-std::array<float,2>{0.987747371f, 0.265453309f},
-std::array<float,2>{0.175885022f, 0.424935371f},
-std::array<float,2>{0.757914782f, 0.934193313f},
-std::array<float,2>{0.324374437f, 0.547600448f},
-std::array<float,2>{0.595626295f, 0.127792194f},
-std::array<float,2>{0.0949376002f, 0.245423719f},
-std::array<float,2>{0.931335747f, 0.576462328f},
-std::array<float,2>{0.408011913f, 0.981731951f},
-std::array<float,2>{0.635579169f, 0.487720042f},
-std::array<float,2>{0.256722152f, 0.37329784f},
-std::array<float,2>{0.542405784f, 0.851156056f},
-std::array<float,2>{0.21221219f, 0.687835813f},
-std::array<float,2>{0.817113936f, 0.0188124031f},
-std::array<float,2>{0.348551303f, 0.156356975f},
-std::array<float,2>{0.590685904f, 0.526088893f},
-std::array<float,2>{0.137902781f, 0.876005292f},
-std::array<float,2>{0.785010934f, 0.394566566f},
-std::array<float,2>{0.0253740717f, 0.28816098f},
-std::array<float,2>{0.938947499f, 0.789160132f},
-std::array<float,2>{0.493836761f, 0.679171443f},
-std::array<float,2>{0.708729923f, 0.0764859095f},
-std::array<float,2>{0.221092761f, 0.0459191799f},
-std::array<float,2>{0.861363173f, 0.739566505f},
-std::array<float,2>{0.294589162f, 0.813229561f},
-std::array<float,2>{0.510829329f, 0.331964821f},
-std::array<float,2>{0.398034096f, 0.442372173f},
-std::array<float,2>{0.664991319f, 0.955458045f},
-std::array<float,2>{0.0851400495f, 0.624367833f},
-std::array<float,2>{0.875356138f, 0.213665083f},
-std::array<float,2>{0.308997601f, 0.0142974127f},
-std::array<float,2>{0.520130277f, 0.70789516f},
-std::array<float,2>{0.239997953f, 0.865274072f},
-std::array<float,2>{0.847493827f, 0.344304323f},
-std::array<float,2>{0.0653451532f, 0.482084841f},
-std::array<float,2>{0.899547637f, 0.990116119f},
-std::array<float,2>{0.379952908f, 0.590922475f},
-std::array<float,2>{0.676797509f, 0.224155292f},
-std::array<float,2>{0.153597221f, 0.149082735f},
-std::array<float,2>{0.80110383f, 0.535889089f},
-std::array<float,2>{0.374007076f, 0.919204593f},
-std::array<float,2>{0.562610686f, 0.417071223f},
-std::array<float,2>{0.471666276f, 0.278963596f},
-std::array<float,2>{0.692646265f, 0.756523669f},
-std::array<float,2>{0.00333714811f, 0.647189438f},
-std::array<float,2>{0.958656073f, 0.102092154f},
-std::array<float,2>{0.42683503f, 0.202490002f},
-std::array<float,2>{0.650651515f, 0.603261948f},
-std::array<float,2>{0.113415502f, 0.943323553f},
-std::array<float,2>{0.920109451f, 0.463414431f},
-std::array<float,2>{0.198740318f, 0.321883142f},
-std::array<float,2>{0.841553152f, 0.831010401f},
-std::array<float,2>{0.273110598f, 0.720228016f},
-std::array<float,2>{0.553263366f, 0.0474594459f},
-std::array<float,2>{0.035172902f, 0.0823772997f},
-std::array<float,2>{0.984184563f, 0.658546865f},
-std::array<float,2>{0.451977104f, 0.800845683f},
-std::array<float,2>{0.723007381f, 0.296948254f},
-std::array<float,2>{0.334838867f, 0.388221145f},
-std::array<float,2>{0.621928215f, 0.893196821f},
-std::array<float,2>{0.165596291f, 0.504202783f},
-std::array<float,2>{0.773415744f, 0.185664371f},
-std::array<float,2>{0.387388796f, 0.0601414479f},
-std::array<float,2>{0.684876025f, 0.729856491f},
-std::array<float,2>{0.0722249076f, 0.838954568f},
-std::array<float,2>{0.891249299f, 0.315251619f},
-std::array<float,2>{0.246106908f, 0.454350471f},
-std::array<float,2>{0.859028161f, 0.9495067f},
-std::array<float,2>{0.303675622f, 0.600279868f},
-std::array<float,2>{0.523947895f, 0.191008478f},
-std::array<float,2>{0.0127107687f, 0.178044111f},
-std::array<float,2>{0.96233964f, 0.515534341f},
-std::array<float,2>{0.479441941f, 0.903360546f},
-std::array<float,2>{0.697054207f, 0.380201489f},
-std::array<float,2>{0.365967005f, 0.311699837f},
-std::array<float,2>{0.570648789f, 0.804980218f},
-std::array<float,2>{0.146516427f, 0.670442104f},
-std::array<float,2>{0.812348187f, 0.087065272f},
-std::array<float,2>{0.280915052f, 0.231594369f},
-std::array<float,2>{0.559320569f, 0.585309982f},
-std::array<float,2>{0.191118494f, 0.997482717f},
-std::array<float,2>{0.828493595f, 0.46923545f},
-std::array<float,2>{0.120973125f, 0.357581019f},
-std::array<float,2>{0.909566104f, 0.871763945f},
-std::array<float,2>{0.43548274f, 0.713490486f},
-std::array<float,2>{0.645609736f, 0.0044612349f},
-std::array<float,2>{0.156819806f, 0.0988503769f},
-std::array<float,2>{0.775440454f, 0.655005574f},
-std::array<float,2>{0.340052217f, 0.765473783f},
-std::array<float,2>{0.617176175f, 0.268197954f},
-std::array<float,2>{0.440754116f, 0.412710488f},
-std::array<float,2>{0.730236292f, 0.910936415f},
-std::array<float,2>{0.0403296985f, 0.545109808f},
-std::array<float,2>{0.975699365f, 0.143861309f},
-std::array<float,2>{0.315902323f, 0.0697051063f},
-std::array<float,2>{0.602866769f, 0.685510516f},
-std::array<float,2>{0.181314006f, 0.788885176f},
-std::array<float,2>{0.755396605f, 0.29387325f},
-std::array<float,2>{0.0548832305f, 0.398849726f},
-std::array<float,2>{0.995618284f, 0.890087366f},
-std::array<float,2>{0.468164027f, 0.519277155f},
-std::array<float,2>{0.74311775f, 0.171610862f},
-std::array<float,2>{0.203506291f, 0.208698913f},
-std::array<float,2>{0.822208762f, 0.617112398f},
-std::array<float,2>{0.259278089f, 0.961492419f},
-std::array<float,2>{0.534961283f, 0.451201797f},
-std::array<float,2>{0.417528421f, 0.343696266f},
-std::array<float,2>{0.632171869f, 0.822857141f},
-std::array<float,2>{0.1039619f, 0.746468544f},
-std::array<float,2>{0.924195826f, 0.0361862816f},
-std::array<float,2>{0.488149911f, 0.133743688f},
-std::array<float,2>{0.712337017f, 0.554887533f},
-std::array<float,2>{0.0171606373f, 0.927195549f},
-std::array<float,2>{0.952913463f, 0.437484831f},
-std::array<float,2>{0.126225233f, 0.251498401f},
-std::array<float,2>{0.79661876f, 0.774975896f},
-std::array<float,2>{0.353074402f, 0.638184845f},
-std::array<float,2>{0.583366513f, 0.114149414f},
-std::array<float,2>{0.092959024f, 0.0281674936f},
-std::array<float,2>{0.886406302f, 0.703116775f},
-std::array<float,2>{0.399723291f, 0.854746699f},
-std::array<float,2>{0.659140706f, 0.36589402f},
-std::array<float,2>{0.282995701f, 0.49321115f},
-std::array<float,2>{0.505203843f, 0.974072039f},
-std::array<float,2>{0.228467062f, 0.568834066f},
-std::array<float,2>{0.874953508f, 0.234805971f},
-std::array<float,2>{0.481174171f, 0.021353554f},
-std::array<float,2>{0.699253798f, 0.692867696f},
-std::array<float,2>{0.00851114746f, 0.847310305f},
-std::array<float,2>{0.96646142f, 0.368715256f},
-std::array<float,2>{0.140808269f, 0.490257889f},
-std::array<float,2>{0.805044055f, 0.977229595f},
-std::array<float,2>{0.360639602f, 0.573244691f},
-std::array<float,2>{0.574423492f, 0.247631475f},
-std::array<float,2>{0.0778395906f, 0.130646259f},
-std::array<float,2>{0.894670188f, 0.551134408f},
-std::array<float,2>{0.383522034f, 0.931322634f},
-std::array<float,2>{0.683360517f, 0.429440081f},
-std::array<float,2>{0.299174517f, 0.258753657f},
-std::array<float,2>{0.527746499f, 0.772586405f},
-std::array<float,2>{0.242940977f, 0.625287712f},
-std::array<float,2>{0.85287708f, 0.123052001f},
-std::array<float,2>{0.336224884f, 0.216087595f},
-std::array<float,2>{0.612829328f, 0.619500101f},
-std::array<float,2>{0.160898149f, 0.957744777f},
-std::array<float,2>{0.778716445f, 0.438881069f},
-std::array<float,2>{0.0447007604f, 0.335082203f},
-std::array<float,2>{0.972396135f, 0.817274392f},
-std::array<float,2>{0.441681862f, 0.73658675f},
-std::array<float,2>{0.733213246f, 0.042243816f},
-std::array<float,2>{0.192737892f, 0.0739390999f},
-std::array<float,2>{0.83419168f, 0.675620794f},
-std::array<float,2>{0.27412647f, 0.794950604f},
-std::array<float,2>{0.556494057f, 0.282438636f},
-std::array<float,2>{0.4326832f, 0.39355129f},
-std::array<float,2>{0.641434371f, 0.881062329f},
-std::array<float,2>{0.123297758f, 0.531236172f},
-std::array<float,2>{0.913353384f, 0.162387431f},
-std::array<float,2>{0.261764705f, 0.105763838f},
-std::array<float,2>{0.538117826f, 0.641941369f},
-std::array<float,2>{0.208929002f, 0.750588477f},
-std::array<float,2>{0.827215731f, 0.275862306f},
-std::array<float,2>{0.106080115f, 0.420769274f},
-std::array<float,2>{0.926353931f, 0.914992273f},
-std::array<float,2>{0.418581814f, 0.532014072f},
-std::array<float,2>{0.627697349f, 0.152438357f},
-std::array<float,2>{0.186647281f, 0.219949409f},
-std::array<float,2>{0.753723443f, 0.586895168f},
-std::array<float,2>{0.316484451f, 0.986285269f},
-std::array<float,2>{0.609066248f, 0.47941336f},
-std::array<float,2>{0.462800294f, 0.349383056f},
-std::array<float,2>{0.746926308f, 0.862825692f},
-std::array<float,2>{0.059501294f, 0.706640482f},
-std::array<float,2>{0.996560991f, 0.00914177485f},
-std::array<float,2>{0.40546006f, 0.181307048f},
-std::array<float,2>{0.660669923f, 0.503863335f},
-std::array<float,2>{0.0879051238f, 0.897799551f},
-std::array<float,2>{0.887240529f, 0.383503169f},
-std::array<float,2>{0.231001377f, 0.304056615f},
-std::array<float,2>{0.870347619f, 0.79701215f},
-std::array<float,2>{0.286831051f, 0.663054407f},
-std::array<float,2>{0.502998173f, 0.0784067884f},
-std::array<float,2>{0.0203128308f, 0.0545621887f},
-std::array<float,2>{0.948747277f, 0.724274099f},
-std::array<float,2>{0.49064827f, 0.833713114f},
-std::array<float,2>{0.717508018f, 0.326391697f},
-std::array<float,2>{0.357966363f, 0.466915846f},
-std::array<float,2>{0.581363797f, 0.93904525f},
-std::array<float,2>{0.130743131f, 0.605672002f},
-std::array<float,2>{0.790343225f, 0.196601897f},
-std::array<float,2>{0.410392761f, 0.0913179293f},
-std::array<float,2>{0.637254715f, 0.665030062f},
-std::array<float,2>{0.100897826f, 0.808814406f},
-std::array<float,2>{0.934779823f, 0.307706982f},
-std::array<float,2>{0.215616688f, 0.37627849f},
-std::array<float,2>{0.812550724f, 0.899353564f},
-std::array<float,2>{0.250064492f, 0.51090312f},
-std::array<float,2>{0.546139538f, 0.174605489f},
-std::array<float,2>{0.0544999614f, 0.194545001f},
-std::array<float,2>{0.990991712f, 0.594300449f},
-std::array<float,2>{0.454596817f, 0.947338879f},
-std::array<float,2>{0.742139101f, 0.460014492f},
-std::array<float,2>{0.324137628f, 0.317355245f},
-std::array<float,2>{0.601352751f, 0.842432201f},
-std::array<float,2>{0.171955526f, 0.730609596f},
-std::array<float,2>{0.761940598f, 0.0560077205f},
-std::array<float,2>{0.290505528f, 0.147712231f},
-std::array<float,2>{0.512414932f, 0.540878534f},
-std::array<float,2>{0.223563686f, 0.908360839f},
-std::array<float,2>{0.866848528f, 0.406646907f},
-std::array<float,2>{0.0807130188f, 0.270550132f},
-std::array<float,2>{0.879995406f, 0.760894418f},
-std::array<float,2>{0.392446131f, 0.651346385f},
-std::array<float,2>{0.668765068f, 0.0941618085f},
-std::array<float,2>{0.13466388f, 0.00191950111f},
-std::array<float,2>{0.785955369f, 0.715632021f},
-std::array<float,2>{0.345408469f, 0.868123651f},
-std::array<float,2>{0.589772046f, 0.354385346f},
-std::array<float,2>{0.496653348f, 0.474089265f},
-std::array<float,2>{0.704094112f, 0.993727148f},
-std::array<float,2>{0.0283116661f, 0.578918457f},
-std::array<float,2>{0.941966593f, 0.228064433f},
-std::array<float,2>{0.36821717f, 0.0334886797f},
-std::array<float,2>{0.568121791f, 0.745575547f},
-std::array<float,2>{0.151588053f, 0.827621937f},
-std::array<float,2>{0.799317718f, 0.336169869f},
-std::array<float,2>{0.00586153474f, 0.448486894f},
-std::array<float,2>{0.956414104f, 0.965160728f},
-std::array<float,2>{0.474008858f, 0.612853765f},
-std::array<float,2>{0.690145135f, 0.204391614f},
-std::array<float,2>{0.236082062f, 0.164887503f},
-std::array<float,2>{0.848712683f, 0.520206392f},
-std::array<float,2>{0.307279438f, 0.883138359f},
-std::array<float,2>{0.518091142f, 0.405453265f},
-std::array<float,2>{0.375777155f, 0.292325377f},
-std::array<float,2>{0.675460398f, 0.781785488f},
-std::array<float,2>{0.0696287602f, 0.681789756f},
-std::array<float,2>{0.905802667f, 0.0664010793f},
-std::array<float,2>{0.447534084f, 0.242165193f},
-std::array<float,2>{0.721169889f, 0.56501615f},
-std::array<float,2>{0.0329995491f, 0.971425354f},
-std::array<float,2>{0.977142572f, 0.497532248f},
-std::array<float,2>{0.168934867f, 0.359526277f},
-std::array<float,2>{0.76577878f, 0.859002292f},
-std::array<float,2>{0.330157936f, 0.697049201f},
-std::array<float,2>{0.620288432f, 0.0255671851f},
-std::array<float,2>{0.112795293f, 0.110586986f},
-std::array<float,2>{0.915136158f, 0.635686755f},
-std::array<float,2>{0.424695522f, 0.777966976f},
-std::array<float,2>{0.655757844f, 0.256268233f},
-std::array<float,2>{0.269485742f, 0.432729155f},
-std::array<float,2>{0.547415435f, 0.923598051f},
-std::array<float,2>{0.201471403f, 0.558895826f},
-std::array<float,2>{0.837037027f, 0.13967447f},
-std::array<float,2>{0.468674242f, 0.0676250383f},
-std::array<float,2>{0.74234581f, 0.685864151f},
-std::array<float,2>{0.0554044172f, 0.786651194f},
-std::array<float,2>{0.995234251f, 0.296679705f},
-std::array<float,2>{0.180759132f, 0.401685596f},
-std::array<float,2>{0.755238414f, 0.886793733f},
-std::array<float,2>{0.315997183f, 0.516555369f},
-std::array<float,2>{0.603361785f, 0.168103278f},
-std::array<float,2>{0.104277931f, 0.209100217f},
-std::array<float,2>{0.924567819f, 0.614464343f},
-std::array<float,2>{0.417309195f, 0.963358164f},
-std::array<float,2>{0.632506013f, 0.450616151f},
-std::array<float,2>{0.258985579f, 0.340259761f},
-std::array<float,2>{0.534504712f, 0.821858287f},
-std::array<float,2>{0.203739792f, 0.749753952f},
-std::array<float,2>{0.821498871f, 0.0384687856f},
-std::array<float,2>{0.352796584f, 0.136569738f},
-std::array<float,2>{0.583582163f, 0.557695448f},
-std::array<float,2>{0.126620099f, 0.928855538f},
-std::array<float,2>{0.796056628f, 0.434049308f},
-std::array<float,2>{0.0170034338f, 0.253616482f},
-std::array<float,2>{0.95228821f, 0.775878787f},
-std::array<float,2>{0.487746567f, 0.640330911f},
-std::array<float,2>{0.712808907f, 0.115560949f},
-std::array<float,2>{0.227843434f, 0.0296263807f},
-std::array<float,2>{0.874216676f, 0.699501812f},
-std::array<float,2>{0.282576144f, 0.851854861f},
-std::array<float,2>{0.505589485f, 0.36355719f},
-std::array<float,2>{0.400001526f, 0.495135158f},
-std::array<float,2>{0.658328712f, 0.975871921f},
-std::array<float,2>{0.093387112f, 0.567095876f},
-std::array<float,2>{0.885760427f, 0.237539321f},
-std::array<float,2>{0.302946419f, 0.0616955496f},
-std::array<float,2>{0.523559988f, 0.727741539f},
-std::array<float,2>{0.246805027f, 0.837249756f},
-std::array<float,2>{0.858663917f, 0.314338118f},
-std::array<float,2>{0.0715049505f, 0.45622173f},
-std::array<float,2>{0.890918672f, 0.952852249f},
-std::array<float,2>{0.386807859f, 0.599497795f},
-std::array<float,2>{0.685076594f, 0.189388543f},
-std::array<float,2>{0.147396892f, 0.177195787f},
-std::array<float,2>{0.81159395f, 0.512674093f},
-std::array<float,2>{0.365370363f, 0.904795885f},
-std::array<float,2>{0.570987642f, 0.381142527f},
-std::array<float,2>{0.478908181f, 0.31053701f},
-std::array<float,2>{0.696506739f, 0.807984352f},
-std::array<float,2>{0.0135646574f, 0.669276297f},
-std::array<float,2>{0.962450981f, 0.0898224562f},
-std::array<float,2>{0.434690565f, 0.234132692f},
-std::array<float,2>{0.646327078f, 0.583461761f},
-std::array<float,2>{0.120307453f, 0.998425961f},
-std::array<float,2>{0.909865201f, 0.472452134f},
-std::array<float,2>{0.190796152f, 0.357179433f},
-std::array<float,2>{0.828806043f, 0.873348355f},
-std::array<float,2>{0.280648232f, 0.711532831f},
-std::array<float,2>{0.559051812f, 0.00615985133f},
-std::array<float,2>{0.0406477116f, 0.101463646f},
-std::array<float,2>{0.976128995f, 0.652710557f},
-std::array<float,2>{0.441038072f, 0.76353538f},
-std::array<float,2>{0.729734063f, 0.267390043f},
-std::array<float,2>{0.340646952f, 0.411919296f},
-std::array<float,2>{0.616501272f, 0.912443399f},
-std::array<float,2>{0.156546265f, 0.543182731f},
-std::array<float,2>{0.775932193f, 0.142241254f},
-std::array<float,2>{0.380406469f, 0.0129841678f},
-std::array<float,2>{0.67773211f, 0.710100651f},
-std::array<float,2>{0.0645213127f, 0.864425838f},
-std::array<float,2>{0.90026933f, 0.347261101f},
-std::array<float,2>{0.239259019f, 0.48366341f},
-std::array<float,2>{0.84709245f, 0.991202831f},
-std::array<float,2>{0.309342891f, 0.592870474f},
-std::array<float,2>{0.51962781f, 0.226255015f},
-std::array<float,2>{0.00368787302f, 0.151075944f},
-std::array<float,2>{0.958018005f, 0.537724972f},
-std::array<float,2>{0.471127599f, 0.920381606f},
-std::array<float,2>{0.693358064f, 0.415391296f},
-std::array<float,2>{0.373110443f, 0.281056702f},
-std::array<float,2>{0.563085914f, 0.754692733f},
-std::array<float,2>{0.153878167f, 0.645452857f},
-std::array<float,2>{0.801720798f, 0.104820751f},
-std::array<float,2>{0.272669345f, 0.199462101f},
-std::array<float,2>{0.552874148f, 0.604005575f},
-std::array<float,2>{0.19866167f, 0.943988681f},
-std::array<float,2>{0.841052949f, 0.461403877f},
-std::array<float,2>{0.113952994f, 0.323019058f},
-std::array<float,2>{0.920555592f, 0.82927984f},
-std::array<float,2>{0.427441806f, 0.721227527f},
-std::array<float,2>{0.651231349f, 0.0504412763f},
-std::array<float,2>{0.165398344f, 0.085628584f},
-std::array<float,2>{0.772478521f, 0.657330632f},
-std::array<float,2>{0.334422499f, 0.803676844f},
-std::array<float,2>{0.621166229f, 0.300131232f},
-std::array<float,2>{0.451395541f, 0.390535921f},
-std::array<float,2>{0.723285675f, 0.892340064f},
-std::array<float,2>{0.035791941f, 0.506852925f},
-std::array<float,2>{0.983698845f, 0.185419008f},
-std::array<float,2>{0.325126201f, 0.119529948f},
-std::array<float,2>{0.595113099f, 0.630819261f},
-std::array<float,2>{0.176552027f, 0.765994072f},
-std::array<float,2>{0.758752167f, 0.262249559f},
-std::array<float,2>{0.0491106883f, 0.423536539f},
-std::array<float,2>{0.987871885f, 0.93714875f},
-std::array<float,2>{0.460752726f, 0.548930883f},
-std::array<float,2>{0.736563146f, 0.125132635f},
-std::array<float,2>{0.212856561f, 0.243949324f},
-std::array<float,2>{0.816729903f, 0.574485004f},
-std::array<float,2>{0.25628078f, 0.982898414f},
-std::array<float,2>{0.542634606f, 0.484570473f},
-std::array<float,2>{0.407311469f, 0.371169716f},
-std::array<float,2>{0.635118544f, 0.848610461f},
-std::array<float,2>{0.0955201238f, 0.69100225f},
-std::array<float,2>{0.930902779f, 0.0168832783f},
-std::array<float,2>{0.493221402f, 0.160047218f},
-std::array<float,2>{0.708298028f, 0.524427652f},
-std::array<float,2>{0.0245395619f, 0.877896786f},
-std::array<float,2>{0.939277709f, 0.397073984f},
-std::array<float,2>{0.13842696f, 0.286695749f},
-std::array<float,2>{0.784407437f, 0.791728079f},
-std::array<float,2>{0.347849846f, 0.677372754f},
-std::array<float,2>{0.590207458f, 0.0759617686f},
-std::array<float,2>{0.0857298225f, 0.0441977829f},
-std::array<float,2>{0.875818193f, 0.74200201f},
-std::array<float,2>{0.397865713f, 0.815581322f},
-std::array<float,2>{0.664076149f, 0.329605997f},
-std::array<float,2>{0.294191957f, 0.443536431f},
-std::array<float,2>{0.511314571f, 0.954130232f},
-std::array<float,2>{0.22149092f, 0.622136891f},
-std::array<float,2>{0.862004817f, 0.211659774f},
-std::array<float,2>{0.474378318f, 0.0317287296f},
-std::array<float,2>{0.689659178f, 0.742220819f},
-std::array<float,2>{0.00637224922f, 0.825722098f},
-std::array<float,2>{0.956978261f, 0.338806868f},
-std::array<float,2>{0.15228498f, 0.446826339f},
-std::array<float,2>{0.798923194f, 0.968630552f},
-std::array<float,2>{0.36898008f, 0.61078161f},
-std::array<float,2>{0.567519963f, 0.205601737f},
-std::array<float,2>{0.0701543763f, 0.167709172f},
-std::array<float,2>{0.90552175f, 0.523384035f},
-std::array<float,2>{0.375275493f, 0.886222601f},
-std::array<float,2>{0.675034225f, 0.403156698f},
-std::array<float,2>{0.307038486f, 0.290547103f},
-std::array<float,2>{0.517705321f, 0.783221245f},
-std::array<float,2>{0.235742047f, 0.680744946f},
-std::array<float,2>{0.849193335f, 0.0637237877f},
-std::array<float,2>{0.330770463f, 0.238936111f},
-std::array<float,2>{0.620784461f, 0.562932611f},
-std::array<float,2>{0.167975709f, 0.969987273f},
-std::array<float,2>{0.766119361f, 0.49810183f},
-std::array<float,2>{0.0324424319f, 0.362508416f},
-std::array<float,2>{0.976813972f, 0.856298029f},
-std::array<float,2>{0.448065519f, 0.69795996f},
-std::array<float,2>{0.721628428f, 0.0235795733f},
-std::array<float,2>{0.201845154f, 0.113103122f},
-std::array<float,2>{0.837790668f, 0.633039176f},
-std::array<float,2>{0.268863231f, 0.780781925f},
-std::array<float,2>{0.54694587f, 0.254986197f},
-std::array<float,2>{0.424313754f, 0.430138111f},
-std::array<float,2>{0.65591085f, 0.925533056f},
-std::array<float,2>{0.112513244f, 0.561359644f},
-std::array<float,2>{0.915862024f, 0.137625873f},
-std::array<float,2>{0.250900626f, 0.093169257f},
-std::array<float,2>{0.546608925f, 0.666844368f},
-std::array<float,2>{0.215033337f, 0.811979592f},
-std::array<float,2>{0.813328087f, 0.305279255f},
-std::array<float,2>{0.101138428f, 0.376993477f},
-std::array<float,2>{0.935329735f, 0.90232408f},
-std::array<float,2>{0.410878718f, 0.508743823f},
-std::array<float,2>{0.636942744f, 0.172010034f},
-std::array<float,2>{0.172618702f, 0.191951454f},
-std::array<float,2>{0.762373269f, 0.59675616f},
-std::array<float,2>{0.323278099f, 0.946753442f},
-std::array<float,2>{0.600863159f, 0.458835781f},
-std::array<float,2>{0.454278052f, 0.319705069f},
-std::array<float,2>{0.741540074f, 0.841191411f},
-std::array<float,2>{0.0539721921f, 0.733445466f},
-std::array<float,2>{0.990409553f, 0.0573491417f},
-std::array<float,2>{0.391980588f, 0.146167874f},
-std::array<float,2>{0.668193638f, 0.541022122f},
-std::array<float,2>{0.0802013651f, 0.906798124f},
-std::array<float,2>{0.88073951f, 0.409155875f},
-std::array<float,2>{0.222664043f, 0.272217065f},
-std::array<float,2>{0.866559923f, 0.759024858f},
-std::array<float,2>{0.290643066f, 0.648789525f},
-std::array<float,2>{0.511954546f, 0.0964362547f},
-std::array<float,2>{0.0275136326f, 0.00307410699f},
-std::array<float,2>{0.941865981f, 0.717060268f},
-std::array<float,2>{0.49645564f, 0.870318532f},
-std::array<float,2>{0.703287363f, 0.352001876f},
-std::array<float,2>{0.34498474f, 0.474799454f},
-std::array<float,2>{0.589276612f, 0.995897889f},
-std::array<float,2>{0.133868903f, 0.581494093f},
-std::array<float,2>{0.78528589f, 0.228961125f},
-std::array<float,2>{0.418047726f, 0.108543299f},
-std::array<float,2>{0.627068818f, 0.643102884f},
-std::array<float,2>{0.105883867f, 0.752382994f},
-std::array<float,2>{0.926243484f, 0.275294453f},
-std::array<float,2>{0.208249912f, 0.418481648f},
-std::array<float,2>{0.82806164f, 0.917930543f},
-std::array<float,2>{0.262518108f, 0.53329891f},
-std::array<float,2>{0.538957775f, 0.154672965f},
-std::array<float,2>{0.0587650277f, 0.221966699f},
-std::array<float,2>{0.997028291f, 0.589343131f},
-std::array<float,2>{0.462103546f, 0.986430764f},
-std::array<float,2>{0.746098876f, 0.478336036f},
-std::array<float,2>{0.317271054f, 0.350104839f},
-std::array<float,2>{0.60874939f, 0.859767079f},
-std::array<float,2>{0.18713811f, 0.704827905f},
-std::array<float,2>{0.753114641f, 0.010881572f},
-std::array<float,2>{0.28649807f, 0.182385921f},
-std::array<float,2>{0.503654718f, 0.501206934f},
-std::array<float,2>{0.230860427f, 0.896121383f},
-std::array<float,2>{0.870613873f, 0.386404604f},
-std::array<float,2>{0.0884395391f, 0.301377386f},
-std::array<float,2>{0.887002409f, 0.799435794f},
-std::array<float,2>{0.40622586f, 0.661486685f},
-std::array<float,2>{0.660310566f, 0.0805621892f},
-std::array<float,2>{0.129945561f, 0.0521641187f},
-std::array<float,2>{0.790624321f, 0.726085782f},
-std::array<float,2>{0.357715994f, 0.834117413f},
-std::array<float,2>{0.58188504f, 0.325654835f},
-std::array<float,2>{0.490904868f, 0.466404021f},
-std::array<float,2>{0.717033267f, 0.941221476f},
-std::array<float,2>{0.0195687078f, 0.608905196f},
-std::array<float,2>{0.948592603f, 0.197756246f},
-std::array<float,2>{0.361195713f, 0.0220329165f},
-std::array<float,2>{0.574836373f, 0.694715321f},
-std::array<float,2>{0.141519859f, 0.845225632f},
-std::array<float,2>{0.805360317f, 0.369639814f},
-std::array<float,2>{0.00803166162f, 0.489299029f},
-std::array<float,2>{0.966273427f, 0.98013556f},
-std::array<float,2>{0.48085013f, 0.571268559f},
-std::array<float,2>{0.700105369f, 0.248845115f},
-std::array<float,2>{0.24235256f, 0.132511407f},
-std::array<float,2>{0.853351712f, 0.55363667f},
-std::array<float,2>{0.299797446f, 0.932088852f},
-std::array<float,2>{0.528093219f, 0.426186025f},
-std::array<float,2>{0.383116275f, 0.26076299f},
-std::array<float,2>{0.682847023f, 0.769635797f},
-std::array<float,2>{0.0774945617f, 0.627522051f},
-std::array<float,2>{0.895174801f, 0.12190596f},
-std::array<float,2>{0.442075431f, 0.217551976f},
-std::array<float,2>{0.732439816f, 0.618407071f},
-std::array<float,2>{0.0440379158f, 0.959286511f},
-std::array<float,2>{0.972144485f, 0.440057725f},
-std::array<float,2>{0.160193205f, 0.333471566f},
-std::array<float,2>{0.779006064f, 0.818667471f},
-std::array<float,2>{0.336582243f, 0.735655785f},
-std::array<float,2>{0.612747371f, 0.0396103449f},
-std::array<float,2>{0.123794124f, 0.0720392838f},
-std::array<float,2>{0.913749516f, 0.672162294f},
-std::array<float,2>{0.433406711f, 0.793370247f},
-std::array<float,2>{0.640734017f, 0.283961147f},
-std::array<float,2>{0.273819089f, 0.391713768f},
-std::array<float,2>{0.556140006f, 0.880750775f},
-std::array<float,2>{0.192932531f, 0.52822119f},
-std::array<float,2>{0.834827185f, 0.160784334f},
-std::array<float,2>{0.484451383f, 0.113738902f},
-std::array<float,2>{0.71331346f, 0.638083875f},
-std::array<float,2>{0.0189817287f, 0.7744717f},
-std::array<float,2>{0.950957596f, 0.251031041f},
-std::array<float,2>{0.128620386f, 0.436746418f},
-std::array<float,2>{0.793903232f, 0.927659571f},
-std::array<float,2>{0.354423255f, 0.555368304f},
-std::array<float,2>{0.585923314f, 0.133029297f},
-std::array<float,2>{0.090638496f, 0.235287026f},
-std::array<float,2>{0.884260118f, 0.569247186f},
-std::array<float,2>{0.400523722f, 0.974490464f},
-std::array<float,2>{0.657875776f, 0.493920505f},
-std::array<float,2>{0.283955067f, 0.365286946f},
-std::array<float,2>{0.505973339f, 0.855376363f},
-std::array<float,2>{0.230377376f, 0.702174067f},
-std::array<float,2>{0.871276677f, 0.0275360234f},
-std::array<float,2>{0.313767821f, 0.171222985f},
-std::array<float,2>{0.604228854f, 0.518855333f},
-std::array<float,2>{0.183500707f, 0.890151858f},
-std::array<float,2>{0.757656872f, 0.399350524f},
-std::array<float,2>{0.0579278842f, 0.293393821f},
-std::array<float,2>{0.993403137f, 0.78844142f},
-std::array<float,2>{0.465639681f, 0.68495822f},
-std::array<float,2>{0.745827436f, 0.0701123923f},
-std::array<float,2>{0.20566158f, 0.0366956033f},
-std::array<float,2>{0.824210167f, 0.747001052f},
-std::array<float,2>{0.260593861f, 0.822624922f},
-std::array<float,2>{0.532098472f, 0.343071818f},
-std::array<float,2>{0.414106399f, 0.451889068f},
-std::array<float,2>{0.629749835f, 0.961282492f},
-std::array<float,2>{0.102618046f, 0.616641939f},
-std::array<float,2>{0.923562467f, 0.208115771f},
-std::array<float,2>{0.279111922f, 0.00401624246f},
-std::array<float,2>{0.562453747f, 0.713139176f},
-std::array<float,2>{0.189443588f, 0.871190846f},
-std::array<float,2>{0.8311584f, 0.358350247f},
-std::array<float,2>{0.118712619f, 0.469611049f},
-std::array<float,2>{0.907880485f, 0.997996211f},
-std::array<float,2>{0.43675372f, 0.585492134f},
-std::array<float,2>{0.647201955f, 0.23214148f},
-std::array<float,2>{0.159115627f, 0.144068033f},
-std::array<float,2>{0.775059879f, 0.545544446f},
-std::array<float,2>{0.341817439f, 0.910446405f},
-std::array<float,2>{0.614543736f, 0.412121564f},
-std::array<float,2>{0.438797265f, 0.267755747f},
-std::array<float,2>{0.726660728f, 0.764805138f},
-std::array<float,2>{0.0428788401f, 0.654528916f},
-std::array<float,2>{0.97301209f, 0.0991976857f},
-std::array<float,2>{0.389185071f, 0.190497741f},
-std::array<float,2>{0.687462807f, 0.599929214f},
-std::array<float,2>{0.0733791739f, 0.949877262f},
-std::array<float,2>{0.893464029f, 0.454865843f},
-std::array<float,2>{0.248366192f, 0.314623535f},
-std::array<float,2>{0.855536878f, 0.83956033f},
-std::array<float,2>{0.301536292f, 0.730095983f},
-std::array<float,2>{0.526181519f, 0.0598044582f},
-std::array<float,2>{0.0149746127f, 0.0877890587f},
-std::array<float,2>{0.963986337f, 0.670361936f},
-std::array<float,2>{0.477350295f, 0.805217147f},
-std::array<float,2>{0.698765039f, 0.312325209f},
-std::array<float,2>{0.363337964f, 0.380515814f},
-std::array<float,2>{0.573915362f, 0.904084682f},
-std::array<float,2>{0.145253792f, 0.514805973f},
-std::array<float,2>{0.809832215f, 0.178282484f},
-std::array<float,2>{0.428453773f, 0.0472565703f},
-std::array<float,2>{0.650336742f, 0.719739437f},
-std::array<float,2>{0.115519263f, 0.830414176f},
-std::array<float,2>{0.918995619f, 0.32134831f},
-std::array<float,2>{0.195884541f, 0.463217467f},
-std::array<float,2>{0.843648016f, 0.9427917f},
-std::array<float,2>{0.269539326f, 0.602993309f},
-std::array<float,2>{0.551029623f, 0.202650666f},
-std::array<float,2>{0.0381826237f, 0.186284319f},
-std::array<float,2>{0.981573761f, 0.50441736f},
-std::array<float,2>{0.450334221f, 0.892731309f},
-std::array<float,2>{0.72645545f, 0.38789317f},
-std::array<float,2>{0.332564294f, 0.297455251f},
-std::array<float,2>{0.623801529f, 0.801631629f},
-std::array<float,2>{0.167079553f, 0.65875113f},
-std::array<float,2>{0.769598663f, 0.0828356445f},
-std::array<float,2>{0.310899138f, 0.224107847f},
-std::array<float,2>{0.522252858f, 0.591473699f},
-std::array<float,2>{0.240250245f, 0.989486217f},
-std::array<float,2>{0.844674528f, 0.481741607f},
-std::array<float,2>{0.0639288947f, 0.343883127f},
-std::array<float,2>{0.901907146f, 0.865745068f},
-std::array<float,2>{0.381375641f, 0.707483113f},
-std::array<float,2>{0.679684997f, 0.0140981302f},
-std::array<float,2>{0.154903978f, 0.101608746f},
-std::array<float,2>{0.804190099f, 0.64654547f},
-std::array<float,2>{0.371421814f, 0.756324708f},
-std::array<float,2>{0.565698683f, 0.278399318f},
-std::array<float,2>{0.469403565f, 0.417787075f},
-std::array<float,2>{0.694521844f, 0.919700384f},
-std::array<float,2>{0.00162373402f, 0.535176396f},
-std::array<float,2>{0.959635079f, 0.14851357f},
-std::array<float,2>{0.35088563f, 0.0770359486f},
-std::array<float,2>{0.592857897f, 0.679395258f},
-std::array<float,2>{0.139027208f, 0.790011644f},
-std::array<float,2>{0.781735897f, 0.289008945f},
-std::array<float,2>{0.0257246122f, 0.395023197f},
-std::array<float,2>{0.939648151f, 0.876769304f},
-std::array<float,2>{0.495592028f, 0.525693417f},
-std::array<float,2>{0.709877849f, 0.15675734f},
-std::array<float,2>{0.219317898f, 0.213314071f},
-std::array<float,2>{0.860834718f, 0.624638557f},
-std::array<float,2>{0.295959055f, 0.955981851f},
-std::array<float,2>{0.508229434f, 0.44181025f},
-std::array<float,2>{0.396151304f, 0.331401944f},
-std::array<float,2>{0.666191876f, 0.812659919f},
-std::array<float,2>{0.0829347819f, 0.739910543f},
-std::array<float,2>{0.87745291f, 0.0465200767f},
-std::array<float,2>{0.45796454f, 0.126999691f},
-std::array<float,2>{0.734632313f, 0.547069728f},
-std::array<float,2>{0.0481181554f, 0.933724463f},
-std::array<float,2>{0.985462666f, 0.425447971f},
-std::array<float,2>{0.178687125f, 0.264882267f},
-std::array<float,2>{0.76165539f, 0.768872142f},
-std::array<float,2>{0.327197462f, 0.631934047f},
-std::array<float,2>{0.596448839f, 0.11779166f},
-std::array<float,2>{0.0971150845f, 0.0191279016f},
-std::array<float,2>{0.9332214f, 0.688151777f},
-std::array<float,2>{0.409661859f, 0.8509354f},
-std::array<float,2>{0.63354665f, 0.373723894f},
-std::array<float,2>{0.254480958f, 0.487964779f},
-std::array<float,2>{0.540482581f, 0.982274175f},
-std::array<float,2>{0.214143142f, 0.577077389f},
-std::array<float,2>{0.819869101f, 0.245728552f},
-std::array<float,2>{0.445470601f, 0.0263578426f},
-std::array<float,2>{0.720412016f, 0.696386635f},
-std::array<float,2>{0.0345910005f, 0.858524919f},
-std::array<float,2>{0.980243206f, 0.360224128f},
-std::array<float,2>{0.169943631f, 0.497675121f},
-std::array<float,2>{0.76773423f, 0.971014559f},
-std::array<float,2>{0.32892698f, 0.56476599f},
-std::array<float,2>{0.618404031f, 0.24160099f},
-std::array<float,2>{0.110490642f, 0.140545368f},
-std::array<float,2>{0.916075349f, 0.559105575f},
-std::array<float,2>{0.423452437f, 0.923179269f},
-std::array<float,2>{0.65398705f, 0.433410048f},
-std::array<float,2>{0.266724914f, 0.256504804f},
-std::array<float,2>{0.549878418f, 0.777684927f},
-std::array<float,2>{0.200071216f, 0.634884119f},
-std::array<float,2>{0.839321136f, 0.111327663f},
-std::array<float,2>{0.37006706f, 0.204989821f},
-std::array<float,2>{0.56908083f, 0.61246413f},
-std::array<float,2>{0.150051162f, 0.965494096f},
-std::array<float,2>{0.798267245f, 0.449213058f},
-std::array<float,2>{0.00398017094f, 0.336461246f},
-std::array<float,2>{0.954949498f, 0.827951968f},
-std::array<float,2>{0.475799888f, 0.745791435f},
-std::array<float,2>{0.68813622f, 0.033783406f},
-std::array<float,2>{0.236497238f, 0.0658427551f},
-std::array<float,2>{0.85144341f, 0.682605863f},
-std::array<float,2>{0.304957986f, 0.781574368f},
-std::array<float,2>{0.516856253f, 0.292704791f},
-std::array<float,2>{0.377712518f, 0.406048089f},
-std::array<float,2>{0.673075855f, 0.883620739f},
-std::array<float,2>{0.0682917237f, 0.519696295f},
-std::array<float,2>{0.90389365f, 0.164363131f},
-std::array<float,2>{0.292009711f, 0.0946728736f},
-std::array<float,2>{0.513805985f, 0.650406539f},
-std::array<float,2>{0.224995583f, 0.761579275f},
-std::array<float,2>{0.863688529f, 0.271074921f},
-std::array<float,2>{0.0793006793f, 0.407124311f},
-std::array<float,2>{0.881876528f, 0.909003019f},
-std::array<float,2>{0.394426823f, 0.540125549f},
-std::array<float,2>{0.670371592f, 0.148176625f},
-std::array<float,2>{0.135970131f, 0.22792308f},
-std::array<float,2>{0.7871508f, 0.57833451f},
-std::array<float,2>{0.346825689f, 0.993432522f},
-std::array<float,2>{0.587200284f, 0.474428475f},
-std::array<float,2>{0.498714119f, 0.353915811f},
-std::array<float,2>{0.705599189f, 0.867620289f},
-std::array<float,2>{0.0307439286f, 0.715316057f},
-std::array<float,2>{0.944200039f, 0.00120153197f},
-std::array<float,2>{0.412851214f, 0.17423366f},
-std::array<float,2>{0.639226854f, 0.511650026f},
-std::array<float,2>{0.0994113088f, 0.898819983f},
-std::array<float,2>{0.936596572f, 0.376684695f},
-std::array<float,2>{0.217064917f, 0.308488041f},
-std::array<float,2>{0.816062868f, 0.809228182f},
-std::array<float,2>{0.25256291f, 0.664444804f},
-std::array<float,2>{0.543793321f, 0.0910778567f},
-std::array<float,2>{0.0524267294f, 0.0566331036f},
-std::array<float,2>{0.988826215f, 0.731316209f},
-std::array<float,2>{0.455709189f, 0.841837049f},
-std::array<float,2>{0.739708126f, 0.316645771f},
-std::array<float,2>{0.321185172f, 0.460660219f},
-std::array<float,2>{0.59792459f, 0.948021293f},
-std::array<float,2>{0.174518123f, 0.594138324f},
-std::array<float,2>{0.76448828f, 0.194931954f},
-std::array<float,2>{0.403953344f, 0.0789903328f},
-std::array<float,2>{0.663316965f, 0.662159741f},
-std::array<float,2>{0.08760003f, 0.797510147f},
-std::array<float,2>{0.888819158f, 0.304308772f},
-std::array<float,2>{0.234155163f, 0.383063048f},
-std::array<float,2>{0.867529929f, 0.898189187f},
-std::array<float,2>{0.28882131f, 0.503027439f},
-std::array<float,2>{0.501272976f, 0.18090713f},
-std::array<float,2>{0.0217786152f, 0.196875766f},
-std::array<float,2>{0.94614166f, 0.606400847f},
-std::array<float,2>{0.488524437f, 0.938491046f},
-std::array<float,2>{0.715412319f, 0.467644542f},
-std::array<float,2>{0.357193351f, 0.326981395f},
-std::array<float,2>{0.578999221f, 0.833235741f},
-std::array<float,2>{0.132135406f, 0.723680198f},
-std::array<float,2>{0.792211652f, 0.053786505f},
-std::array<float,2>{0.265409052f, 0.15284501f},
-std::array<float,2>{0.535393417f, 0.531470954f},
-std::array<float,2>{0.209338024f, 0.914142311f},
-std::array<float,2>{0.825925052f, 0.420233279f},
-std::array<float,2>{0.108744174f, 0.276347041f},
-std::array<float,2>{0.927813232f, 0.750011206f},
-std::array<float,2>{0.420434892f, 0.642388284f},
-std::array<float,2>{0.625542879f, 0.10609445f},
-std::array<float,2>{0.184075892f, 0.00962316431f},
-std::array<float,2>{0.75019151f, 0.706314623f},
-std::array<float,2>{0.319892615f, 0.862734079f},
-std::array<float,2>{0.606219828f, 0.34902513f},
-std::array<float,2>{0.464763731f, 0.478645861f},
-std::array<float,2>{0.749051392f, 0.985587478f},
-std::array<float,2>{0.0624479912f, 0.586314678f},
-std::array<float,2>{0.999478638f, 0.220242679f},
-std::array<float,2>{0.33918038f, 0.0426577851f},
-std::array<float,2>{0.610240102f, 0.737272799f},
-std::array<float,2>{0.163561985f, 0.816599309f},
-std::array<float,2>{0.780418932f, 0.335797071f},
-std::array<float,2>{0.0453075953f, 0.439075857f},
-std::array<float,2>{0.969361901f, 0.957291663f},
-std::array<float,2>{0.443637818f, 0.619815767f},
-std::array<float,2>{0.731115758f, 0.216566578f},
-std::array<float,2>{0.193649113f, 0.163044825f},
-std::array<float,2>{0.832595527f, 0.530286551f},
-std::array<float,2>{0.275966913f, 0.881591499f},
-std::array<float,2>{0.557222009f, 0.392895401f},
-std::array<float,2>{0.430125743f, 0.282954514f},
-std::array<float,2>{0.642617583f, 0.795837939f},
-std::array<float,2>{0.12294247f, 0.674919784f},
-std::array<float,2>{0.911971271f, 0.0735249594f},
-std::array<float,2>{0.483370394f, 0.247486189f},
-std::array<float,2>{0.701245785f, 0.573823214f},
-std::array<float,2>{0.0110465931f, 0.976803124f},
-std::array<float,2>{0.968050539f, 0.490799785f},
-std::array<float,2>{0.143101335f, 0.368362397f},
-std::array<float,2>{0.808516026f, 0.84679538f},
-std::array<float,2>{0.361652166f, 0.69315207f},
-std::array<float,2>{0.577712655f, 0.0208719131f},
-std::array<float,2>{0.0756115243f, 0.123822987f},
-std::array<float,2>{0.898145199f, 0.625669837f},
-std::array<float,2>{0.385654688f, 0.773317456f},
-std::array<float,2>{0.680238426f, 0.258060724f},
-std::array<float,2>{0.29689768f, 0.428870499f},
-std::array<float,2>{0.531246006f, 0.93104893f},
-std::array<float,2>{0.244382918f, 0.55164665f},
-std::array<float,2>{0.853689611f, 0.130113542f},
-std::array<float,2>{0.478368133f, 0.0886292011f},
-std::array<float,2>{0.697331369f, 0.668532968f},
-std::array<float,2>{0.0143532781f, 0.806863427f},
-std::array<float,2>{0.963017642f, 0.308886588f},
-std::array<float,2>{0.146168649f, 0.382104307f},
-std::array<float,2>{0.809534967f, 0.905424893f},
-std::array<float,2>{0.364264041f, 0.513549268f},
-std::array<float,2>{0.572797954f, 0.175863132f},
-std::array<float,2>{0.0725682005f, 0.188195527f},
-std::array<float,2>{0.894463539f, 0.597979963f},
-std::array<float,2>{0.389777631f, 0.951318264f},
-std::array<float,2>{0.686186016f, 0.455996007f},
-std::array<float,2>{0.302250206f, 0.312526107f},
-std::array<float,2>{0.526490629f, 0.836345375f},
-std::array<float,2>{0.249443084f, 0.727261901f},
-std::array<float,2>{0.856950819f, 0.0611514747f},
-std::array<float,2>{0.343353093f, 0.141517177f},
-std::array<float,2>{0.613601983f, 0.544097841f},
-std::array<float,2>{0.159763053f, 0.913480043f},
-std::array<float,2>{0.773559868f, 0.411008805f},
-std::array<float,2>{0.0414333642f, 0.265720904f},
-std::array<float,2>{0.973929584f, 0.762167633f},
-std::array<float,2>{0.437893003f, 0.654243112f},
-std::array<float,2>{0.727973282f, 0.100186497f},
-std::array<float,2>{0.187925726f, 0.00766713265f},
-std::array<float,2>{0.830995142f, 0.712287724f},
-std::array<float,2>{0.277584791f, 0.874063253f},
-std::array<float,2>{0.561197519f, 0.356285214f},
-std::array<float,2>{0.435715675f, 0.471167922f},
-std::array<float,2>{0.647555113f, 0.999670327f},
-std::array<float,2>{0.117523722f, 0.582886755f},
-std::array<float,2>{0.906695247f, 0.233125493f},
-std::array<float,2>{0.261058182f, 0.0376505628f},
-std::array<float,2>{0.532939196f, 0.748788059f},
-std::array<float,2>{0.206095412f, 0.821035504f},
-std::array<float,2>{0.823196173f, 0.341214478f},
-std::array<float,2>{0.102207877f, 0.44947052f},
-std::array<float,2>{0.922459602f, 0.964592874f},
-std::array<float,2>{0.415048391f, 0.613617659f},
-std::array<float,2>{0.630625069f, 0.21033062f},
-std::array<float,2>{0.182271615f, 0.169462979f},
-std::array<float,2>{0.756129622f, 0.51744163f},
-std::array<float,2>{0.313240796f, 0.888135195f},
-std::array<float,2>{0.604830861f, 0.401281774f},
-std::array<float,2>{0.466624349f, 0.295319468f},
-std::array<float,2>{0.744537473f, 0.785418332f},
-std::array<float,2>{0.0575953685f, 0.687126875f},
-std::array<float,2>{0.992877245f, 0.0664369762f},
-std::array<float,2>{0.402187616f, 0.236970797f},
-std::array<float,2>{0.65713954f, 0.56808269f},
-std::array<float,2>{0.0909811035f, 0.974714816f},
-std::array<float,2>{0.883781433f, 0.494297892f},
-std::array<float,2>{0.22889559f, 0.364826798f},
-std::array<float,2>{0.872162402f, 0.852899194f},
-std::array<float,2>{0.284760743f, 0.701166928f},
-std::array<float,2>{0.507680237f, 0.0302987956f},
-std::array<float,2>{0.0177662428f, 0.116545595f},
-std::array<float,2>{0.949828088f, 0.639362216f},
-std::array<float,2>{0.485755801f, 0.777049124f},
-std::array<float,2>{0.714542568f, 0.25260976f},
-std::array<float,2>{0.355145961f, 0.434881419f},
-std::array<float,2>{0.584225655f, 0.928041935f},
-std::array<float,2>{0.127508566f, 0.556866825f},
-std::array<float,2>{0.79400152f, 0.135692582f},
-std::array<float,2>{0.408396184f, 0.0160651188f},
-std::array<float,2>{0.634321272f, 0.689767003f},
-std::array<float,2>{0.0964471251f, 0.849025905f},
-std::array<float,2>{0.931675494f, 0.372416407f},
-std::array<float,2>{0.213107318f, 0.485824347f},
-std::array<float,2>{0.818500817f, 0.983787835f},
-std::array<float,2>{0.255235255f, 0.575248063f},
-std::array<float,2>{0.539855778f, 0.242617995f},
-std::array<float,2>{0.0469043069f, 0.126353413f},
-std::array<float,2>{0.985289037f, 0.550101697f},
-std::array<float,2>{0.458465636f, 0.936271369f},
-std::array<float,2>{0.735624611f, 0.422483921f},
-std::array<float,2>{0.326314807f, 0.263305604f},
-std::array<float,2>{0.597146809f, 0.766725004f},
-std::array<float,2>{0.1793717f, 0.628967404f},
-std::array<float,2>{0.760719538f, 0.120681472f},
-std::array<float,2>{0.295736045f, 0.212827221f},
-std::array<float,2>{0.50935477f, 0.621366858f},
-std::array<float,2>{0.220475927f, 0.953907967f},
-std::array<float,2>{0.860041618f, 0.444463611f},
-std::array<float,2>{0.0836735219f, 0.32885766f},
-std::array<float,2>{0.877978921f, 0.814894021f},
-std::array<float,2>{0.395154506f, 0.740693152f},
-std::array<float,2>{0.667839944f, 0.0434260219f},
-std::array<float,2>{0.139758766f, 0.0751146153f},
-std::array<float,2>{0.782477021f, 0.675877392f},
-std::array<float,2>{0.34990406f, 0.792763352f},
-std::array<float,2>{0.592010498f, 0.286105722f},
-std::array<float,2>{0.494737267f, 0.398050874f},
-std::array<float,2>{0.710341394f, 0.878301024f},
-std::array<float,2>{0.027256785f, 0.523801744f},
-std::array<float,2>{0.940854251f, 0.158967167f},
-std::array<float,2>{0.372148454f, 0.103554159f},
-std::array<float,2>{0.564979911f, 0.646402121f},
-std::array<float,2>{0.15622215f, 0.755037308f},
-std::array<float,2>{0.803027391f, 0.279624164f},
-std::array<float,2>{9.6138856e-06f, 0.414644867f},
-std::array<float,2>{0.960101783f, 0.921289563f},
-std::array<float,2>{0.470537066f, 0.538509548f},
-std::array<float,2>{0.693913221f, 0.152120143f},
-std::array<float,2>{0.241678506f, 0.225369364f},
-std::array<float,2>{0.845014334f, 0.592092931f},
-std::array<float,2>{0.311983883f, 0.991912246f},
-std::array<float,2>{0.523293495f, 0.483262628f},
-std::array<float,2>{0.382565022f, 0.34595865f},
-std::array<float,2>{0.678035796f, 0.864207864f},
-std::array<float,2>{0.0629761368f, 0.709941566f},
-std::array<float,2>{0.901268125f, 0.012618253f},
-std::array<float,2>{0.449368864f, 0.184049994f},
-std::array<float,2>{0.725476444f, 0.505986452f},
-std::array<float,2>{0.0380412191f, 0.890674531f},
-std::array<float,2>{0.981073201f, 0.389235258f},
-std::array<float,2>{0.166898817f, 0.299772054f},
-std::array<float,2>{0.771273851f, 0.803784609f},
-std::array<float,2>{0.333620399f, 0.656452477f},
-std::array<float,2>{0.624887407f, 0.0840521455f},
-std::array<float,2>{0.116489843f, 0.0491012484f},
-std::array<float,2>{0.918759167f, 0.722275138f},
-std::array<float,2>{0.429569602f, 0.828239441f},
-std::array<float,2>{0.648886144f, 0.323920786f},
-std::array<float,2>{0.271005213f, 0.462451845f},
-std::array<float,2>{0.551785469f, 0.944573581f},
-std::array<float,2>{0.197115257f, 0.605392873f},
-std::array<float,2>{0.842565119f, 0.201013342f},
-std::array<float,2>{0.456551045f, 0.0576258972f},
-std::array<float,2>{0.738900602f, 0.733348787f},
-std::array<float,2>{0.050785549f, 0.839956462f},
-std::array<float,2>{0.989737213f, 0.318585455f},
-std::array<float,2>{0.17514132f, 0.457105935f},
-std::array<float,2>{0.765148759f, 0.945649803f},
-std::array<float,2>{0.322049141f, 0.596110702f},
-std::array<float,2>{0.599484563f, 0.192796633f},
-std::array<float,2>{0.0979617685f, 0.173086599f},
-std::array<float,2>{0.936448514f, 0.509702742f},
-std::array<float,2>{0.413439691f, 0.900445163f},
-std::array<float,2>{0.640035272f, 0.378349751f},
-std::array<float,2>{0.253078401f, 0.306520671f},
-std::array<float,2>{0.544523597f, 0.811519027f},
-std::array<float,2>{0.217847854f, 0.667558253f},
-std::array<float,2>{0.814539254f, 0.0926914141f},
-std::array<float,2>{0.346365839f, 0.230320439f},
-std::array<float,2>{0.586242616f, 0.58045876f},
-std::array<float,2>{0.135694757f, 0.994342387f},
-std::array<float,2>{0.788704216f, 0.475939184f},
-std::array<float,2>{0.0297591463f, 0.353252739f},
-std::array<float,2>{0.944392383f, 0.869935989f},
-std::array<float,2>{0.499304205f, 0.718123555f},
-std::array<float,2>{0.706668854f, 0.00280784955f},
-std::array<float,2>{0.225641549f, 0.0973877236f},
-std::array<float,2>{0.865060329f, 0.650308549f},
-std::array<float,2>{0.291412979f, 0.758474946f},
-std::array<float,2>{0.514680147f, 0.272468388f},
-std::array<float,2>{0.393435955f, 0.409485608f},
-std::array<float,2>{0.671641231f, 0.907882512f},
-std::array<float,2>{0.0782211348f, 0.542841196f},
-std::array<float,2>{0.881218195f, 0.144923732f},
-std::array<float,2>{0.305869818f, 0.0633101612f},
-std::array<float,2>{0.515809059f, 0.680339575f},
-std::array<float,2>{0.23809211f, 0.785140276f},
-std::array<float,2>{0.849835813f, 0.290010184f},
-std::array<float,2>{0.0664602146f, 0.403676957f},
-std::array<float,2>{0.902433097f, 0.885694623f},
-std::array<float,2>{0.378412068f, 0.522315979f},
-std::array<float,2>{0.672815979f, 0.166595891f},
-std::array<float,2>{0.149178579f, 0.20691222f},
-std::array<float,2>{0.797588944f, 0.609980524f},
-std::array<float,2>{0.370320588f, 0.967604995f},
-std::array<float,2>{0.569631219f, 0.445619136f},
-std::array<float,2>{0.474992186f, 0.339063257f},
-std::array<float,2>{0.688792706f, 0.824486375f},
-std::array<float,2>{0.00510434806f, 0.743189454f},
-std::array<float,2>{0.953456163f, 0.0322531238f},
-std::array<float,2>{0.422127187f, 0.138506979f},
-std::array<float,2>{0.653136849f, 0.561528146f},
-std::array<float,2>{0.110217333f, 0.924526989f},
-std::array<float,2>{0.917490959f, 0.430692494f},
-std::array<float,2>{0.200748712f, 0.25476709f},
-std::array<float,2>{0.838689327f, 0.779791474f},
-std::array<float,2>{0.266516238f, 0.633910656f},
-std::array<float,2>{0.548992038f, 0.112109296f},
-std::array<float,2>{0.0334683172f, 0.0250786729f},
-std::array<float,2>{0.979088843f, 0.698975205f},
-std::array<float,2>{0.447188556f, 0.857369244f},
-std::array<float,2>{0.719312549f, 0.361472577f},
-std::array<float,2>{0.329500347f, 0.499729186f},
-std::array<float,2>{0.617436886f, 0.969434857f},
-std::array<float,2>{0.171235666f, 0.564190924f},
-std::array<float,2>{0.768863201f, 0.240043953f},
-std::array<float,2>{0.386636406f, 0.122564048f},
-std::array<float,2>{0.680774391f, 0.628397942f},
-std::array<float,2>{0.0751607195f, 0.771164477f},
-std::array<float,2>{0.896939158f, 0.259812683f},
-std::array<float,2>{0.245236948f, 0.427568138f},
-std::array<float,2>{0.855249345f, 0.932950974f},
-std::array<float,2>{0.298184544f, 0.554561794f},
-std::array<float,2>{0.530143976f, 0.13107726f},
-std::array<float,2>{0.010128472f, 0.24953188f},
-std::array<float,2>{0.967361152f, 0.571888745f},
-std::array<float,2>{0.48345682f, 0.978909552f},
-std::array<float,2>{0.70225817f, 0.488384902f},
-std::array<float,2>{0.362556517f, 0.370781779f},
-std::array<float,2>{0.576964796f, 0.844374776f},
-std::array<float,2>{0.143801808f, 0.694234788f},
-std::array<float,2>{0.807397008f, 0.0234029703f},
-std::array<float,2>{0.27724582f, 0.162004501f},
-std::array<float,2>{0.557629347f, 0.528670013f},
-std::array<float,2>{0.195273116f, 0.87949425f},
-std::array<float,2>{0.83381635f, 0.390991122f},
-std::array<float,2>{0.121700101f, 0.284205258f},
-std::array<float,2>{0.910807908f, 0.794024706f},
-std::array<float,2>{0.431387812f, 0.673409343f},
-std::array<float,2>{0.643639326f, 0.0705915168f},
-std::array<float,2>{0.162751317f, 0.0406442061f},
-std::array<float,2>{0.779336393f, 0.735287309f},
-std::array<float,2>{0.33803311f, 0.819419324f},
-std::array<float,2>{0.610907853f, 0.332729578f},
-std::array<float,2>{0.44451797f, 0.440953851f},
-std::array<float,2>{0.732311249f, 0.960210562f},
-std::array<float,2>{0.0464411303f, 0.61723268f},
-std::array<float,2>{0.970657468f, 0.218346566f},
-std::array<float,2>{0.318656057f, 0.0102998819f},
-std::array<float,2>{0.606865704f, 0.703251362f},
-std::array<float,2>{0.185082734f, 0.860901892f},
-std::array<float,2>{0.751118124f, 0.350622028f},
-std::array<float,2>{0.0608966425f, 0.476947367f},
-std::array<float,2>{0.998266339f, 0.987526536f},
-std::array<float,2>{0.463075608f, 0.588590086f},
-std::array<float,2>{0.748558939f, 0.220967174f},
-std::array<float,2>{0.210775465f, 0.156123742f},
-std::array<float,2>{0.824956894f, 0.534844041f},
-std::array<float,2>{0.264143676f, 0.916397929f},
-std::array<float,2>{0.536700368f, 0.419019639f},
-std::array<float,2>{0.421447515f, 0.274198323f},
-std::array<float,2>{0.626313627f, 0.752939999f},
-std::array<float,2>{0.108063571f, 0.64378792f},
-std::array<float,2>{0.928724766f, 0.10762459f},
-std::array<float,2>{0.489887744f, 0.198637322f},
-std::array<float,2>{0.716556072f, 0.607809186f},
-std::array<float,2>{0.0224739872f, 0.939886987f},
-std::array<float,2>{0.946592629f, 0.465650886f},
-std::array<float,2>{0.131270975f, 0.325034589f},
-std::array<float,2>{0.791481137f, 0.835079134f},
-std::array<float,2>{0.355545312f, 0.725395679f},
-std::array<float,2>{0.579497099f, 0.0515784919f},
-std::array<float,2>{0.0863079876f, 0.0818099082f},
-std::array<float,2>{0.890242577f, 0.661070466f},
-std::array<float,2>{0.402637661f, 0.800495267f},
-std::array<float,2>{0.662339985f, 0.302412629f},
-std::array<float,2>{0.287285149f, 0.385459304f},
-std::array<float,2>{0.500249326f, 0.895257294f},
-std::array<float,2>{0.232481226f, 0.500741601f},
-std::array<float,2>{0.868619204f, 0.182697549f},
-std::array<float,2>{0.440372318f, 0.0977808759f},
-std::array<float,2>{0.729230464f, 0.655325532f},
-std::array<float,2>{0.039276585f, 0.764480054f},
-std::array<float,2>{0.974872172f, 0.26924786f},
-std::array<float,2>{0.157296494f, 0.41379568f},
-std::array<float,2>{0.776628792f, 0.911585391f},
-std::array<float,2>{0.341514736f, 0.546677053f},
-std::array<float,2>{0.615355611f, 0.143034562f},
-std::array<float,2>{0.120014079f, 0.23057352f},
-std::array<float,2>{0.908374667f, 0.584037542f},
-std::array<float,2>{0.433859825f, 0.996132374f},
-std::array<float,2>{0.644690335f, 0.469799936f},
-std::array<float,2>{0.279575884f, 0.358735561f},
-std::array<float,2>{0.560252607f, 0.87229538f},
-std::array<float,2>{0.190319642f, 0.714793026f},
-std::array<float,2>{0.829803824f, 0.00557960523f},
-std::array<float,2>{0.366786152f, 0.179646328f},
-std::array<float,2>{0.57181555f, 0.514187574f},
-std::array<float,2>{0.148275673f, 0.902712524f},
-std::array<float,2>{0.811367869f, 0.379199266f},
-std::array<float,2>{0.0126909846f, 0.310718983f},
-std::array<float,2>{0.960972667f, 0.806210339f},
-std::array<float,2>{0.479988396f, 0.671828389f},
-std::array<float,2>{0.695990205f, 0.0862636641f},
-std::array<float,2>{0.247874573f, 0.0593093373f},
-std::array<float,2>{0.858394563f, 0.729159594f},
-std::array<float,2>{0.304189116f, 0.838799715f},
-std::array<float,2>{0.525169015f, 0.316227674f},
-std::array<float,2>{0.388005525f, 0.453142911f},
-std::array<float,2>{0.684110045f, 0.950783551f},
-std::array<float,2>{0.0705166385f, 0.601257026f},
-std::array<float,2>{0.892046332f, 0.190072119f},
-std::array<float,2>{0.281350702f, 0.0291925855f},
-std::array<float,2>{0.504049778f, 0.701794147f},
-std::array<float,2>{0.226807535f, 0.853635967f},
-std::array<float,2>{0.873752773f, 0.366736382f},
-std::array<float,2>{0.0926133245f, 0.492210805f},
-std::array<float,2>{0.885515928f, 0.9728356f},
-std::array<float,2>{0.398717165f, 0.569673181f},
-std::array<float,2>{0.660044312f, 0.236243293f},
-std::array<float,2>{0.125283614f, 0.134716436f},
-std::array<float,2>{0.795284927f, 0.55612278f},
-std::array<float,2>{0.351733983f, 0.926507831f},
-std::array<float,2>{0.582539439f, 0.435738176f},
-std::array<float,2>{0.486663163f, 0.250647694f},
-std::array<float,2>{0.711719275f, 0.773716807f},
-std::array<float,2>{0.0158245042f, 0.636855662f},
-std::array<float,2>{0.951582968f, 0.114685848f},
-std::array<float,2>{0.416150749f, 0.208003074f},
-std::array<float,2>{0.631820142f, 0.616126359f},
-std::array<float,2>{0.104922071f, 0.962340534f},
-std::array<float,2>{0.925641775f, 0.452872425f},
-std::array<float,2>{0.204446912f, 0.342233032f},
-std::array<float,2>{0.820687711f, 0.823971927f},
-std::array<float,2>{0.257833749f, 0.747121334f},
-std::array<float,2>{0.533656716f, 0.0358156674f},
-std::array<float,2>{0.0558817945f, 0.0688934624f},
-std::array<float,2>{0.994443059f, 0.684499502f},
-std::array<float,2>{0.467144072f, 0.787963688f},
-std::array<float,2>{0.743479848f, 0.294002831f},
-std::array<float,2>{0.315362155f, 0.399877697f},
-std::array<float,2>{0.601976693f, 0.889380574f},
-std::array<float,2>{0.180436283f, 0.517583549f},
-std::array<float,2>{0.754466653f, 0.170479894f},
-std::array<float,2>{0.3966043f, 0.0455784388f},
-std::array<float,2>{0.66580534f, 0.738928318f},
-std::array<float,2>{0.0841345713f, 0.814381778f},
-std::array<float,2>{0.876135528f, 0.330490351f},
-std::array<float,2>{0.222415537f, 0.442997813f},
-std::array<float,2>{0.862898648f, 0.956800818f},
-std::array<float,2>{0.29330793f, 0.623329759f},
-std::array<float,2>{0.509909272f, 0.214631036f},
-std::array<float,2>{0.0239190143f, 0.158157393f},
-std::array<float,2>{0.938042104f, 0.527137518f},
-std::array<float,2>{0.493039668f, 0.875906944f},
-std::array<float,2>{0.707620919f, 0.396139592f},
-std::array<float,2>{0.348725826f, 0.287278503f},
-std::array<float,2>{0.591469049f, 0.790148377f},
-std::array<float,2>{0.13754347f, 0.677792072f},
-std::array<float,2>{0.783770204f, 0.0777819827f},
-std::array<float,2>{0.257246137f, 0.244624034f},
-std::array<float,2>{0.541705072f, 0.577638984f},
-std::array<float,2>{0.210951418f, 0.981134117f},
-std::array<float,2>{0.817671716f, 0.486769468f},
-std::array<float,2>{0.0943962336f, 0.374924958f},
-std::array<float,2>{0.929806411f, 0.849869609f},
-std::array<float,2>{0.406981766f, 0.688790202f},
-std::array<float,2>{0.636260092f, 0.0183968004f},
-std::array<float,2>{0.177273169f, 0.118685104f},
-std::array<float,2>{0.758858263f, 0.631255388f},
-std::array<float,2>{0.325947732f, 0.767606556f},
-std::array<float,2>{0.594639122f, 0.264199883f},
-std::array<float,2>{0.459247231f, 0.424290538f},
-std::array<float,2>{0.737680197f, 0.935331345f},
-std::array<float,2>{0.0505764484f, 0.548391759f},
-std::array<float,2>{0.986415863f, 0.12875855f},
-std::array<float,2>{0.335123658f, 0.0830845833f},
-std::array<float,2>{0.622956276f, 0.659904361f},
-std::array<float,2>{0.164557591f, 0.802646816f},
-std::array<float,2>{0.772329688f, 0.298504084f},
-std::array<float,2>{0.0368115343f, 0.387540638f},
-std::array<float,2>{0.982997298f, 0.894348204f},
-std::array<float,2>{0.452340007f, 0.50488764f},
-std::array<float,2>{0.724021435f, 0.187022284f},
-std::array<float,2>{0.197880313f, 0.201295763f},
-std::array<float,2>{0.840631962f, 0.602368414f},
-std::array<float,2>{0.271753013f, 0.941843808f},
-std::array<float,2>{0.554082155f, 0.464800388f},
-std::array<float,2>{0.426639915f, 0.320489258f},
-std::array<float,2>{0.651848197f, 0.831406593f},
-std::array<float,2>{0.114887759f, 0.719168544f},
-std::array<float,2>{0.921603918f, 0.0482520349f},
-std::array<float,2>{0.471804202f, 0.149670452f},
-std::array<float,2>{0.691750646f, 0.536339462f},
-std::array<float,2>{0.00246250676f, 0.917981267f},
-std::array<float,2>{0.957486629f, 0.416512698f},
-std::array<float,2>{0.152974814f, 0.27782166f},
-std::array<float,2>{0.801842272f, 0.757689297f},
-std::array<float,2>{0.374460787f, 0.648322225f},
-std::array<float,2>{0.563909769f, 0.103007197f},
-std::array<float,2>{0.0657070875f, 0.0146893477f},
-std::array<float,2>{0.898816764f, 0.708159447f},
-std::array<float,2>{0.379583806f, 0.866344333f},
-std::array<float,2>{0.676014721f, 0.345287055f},
-std::array<float,2>{0.309641391f, 0.480613738f},
-std::array<float,2>{0.521316707f, 0.988922775f},
-std::array<float,2>{0.238731518f, 0.590404868f},
-std::array<float,2>{0.846168458f, 0.223499805f},
-std::array<float,2>{0.497712493f, 0.000121130528f},
-std::array<float,2>{0.704370618f, 0.716036379f},
-std::array<float,2>{0.0287358817f, 0.868320405f},
-std::array<float,2>{0.943148494f, 0.354973406f},
-std::array<float,2>{0.13303642f, 0.47288847f},
-std::array<float,2>{0.786301672f, 0.992549479f},
-std::array<float,2>{0.344079286f, 0.579773843f},
-std::array<float,2>{0.588721693f, 0.227383718f},
-std::array<float,2>{0.0814520493f, 0.146636739f},
-std::array<float,2>{0.879294217f, 0.539413035f},
-std::array<float,2>{0.391063631f, 0.909823f},
-std::array<float,2>{0.66944474f, 0.407732189f},
-std::array<float,2>{0.28926307f, 0.269957781f},
-std::array<float,2>{0.513526022f, 0.760297716f},
-std::array<float,2>{0.223806188f, 0.652322233f},
-std::array<float,2>{0.865577519f, 0.0956208557f},
-std::array<float,2>{0.323022366f, 0.193941176f},
-std::array<float,2>{0.599820554f, 0.595611751f},
-std::array<float,2>{0.173257947f, 0.949195206f},
-std::array<float,2>{0.763076007f, 0.459747523f},
-std::array<float,2>{0.0536318421f, 0.317864746f},
-std::array<float,2>{0.991972148f, 0.843495667f},
-std::array<float,2>{0.453655422f, 0.731943011f},
-std::array<float,2>{0.74110347f, 0.0553061888f},
-std::array<float,2>{0.216767982f, 0.0902734026f},
-std::array<float,2>{0.813782156f, 0.66575712f},
-std::array<float,2>{0.251536816f, 0.810332835f},
-std::array<float,2>{0.54518801f, 0.307161987f},
-std::array<float,2>{0.411812812f, 0.375699818f},
-std::array<float,2>{0.638038814f, 0.90033704f},
-std::array<float,2>{0.100381315f, 0.510504007f},
-std::array<float,2>{0.93381089f, 0.174921125f},
-std::array<float,2>{0.267855287f, 0.109964848f},
-std::array<float,2>{0.547983944f, 0.635834813f},
-std::array<float,2>{0.202231273f, 0.778951228f},
-std::array<float,2>{0.836809337f, 0.257423043f},
-std::array<float,2>{0.111764662f, 0.432412416f},
-std::array<float,2>{0.914172769f, 0.922747731f},
-std::array<float,2>{0.424894005f, 0.559856534f},
-std::array<float,2>{0.655163884f, 0.139178708f},
-std::array<float,2>{0.169774383f, 0.240563422f},
-std::array<float,2>{0.767264426f, 0.565924764f},
-std::array<float,2>{0.331890285f, 0.97187674f},
-std::array<float,2>{0.619144559f, 0.496210784f},
-std::array<float,2>{0.44921425f, 0.361242473f},
-std::array<float,2>{0.722170174f, 0.85835892f},
-std::array<float,2>{0.0314395465f, 0.695879757f},
-std::array<float,2>{0.97819829f, 0.0266568158f},
-std::array<float,2>{0.376684219f, 0.165271834f},
-std::array<float,2>{0.673952103f, 0.52109921f},
-std::array<float,2>{0.069034107f, 0.884224772f},
-std::array<float,2>{0.904313207f, 0.405066699f},
-std::array<float,2>{0.234526172f, 0.291619301f},
-std::array<float,2>{0.848433018f, 0.782502234f},
-std::array<float,2>{0.308507591f, 0.683224082f},
-std::array<float,2>{0.518570304f, 0.0649998114f},
-std::array<float,2>{0.00715242513f, 0.0346183777f},
-std::array<float,2>{0.955652893f, 0.74433893f},
-std::array<float,2>{0.472779214f, 0.826896608f},
-std::array<float,2>{0.690695643f, 0.337615818f},
-std::array<float,2>{0.367236823f, 0.447595149f},
-std::array<float,2>{0.566548645f, 0.966358244f},
-std::array<float,2>{0.150616705f, 0.611361623f},
-std::array<float,2>{0.799842834f, 0.203409851f},
-std::array<float,2>{0.43199268f, 0.0730582029f},
-std::array<float,2>{0.641613007f, 0.674473226f},
-std::array<float,2>{0.124719813f, 0.79605341f},
-std::array<float,2>{0.9123649f, 0.281841099f},
-std::array<float,2>{0.191971719f, 0.393811524f},
-std::array<float,2>{0.835536659f, 0.882180214f},
-std::array<float,2>{0.274688452f, 0.530047297f},
-std::array<float,2>{0.55524832f, 0.163087219f},
-std::array<float,2>{0.0438981615f, 0.215189636f},
-std::array<float,2>{0.971211731f, 0.620467842f},
-std::array<float,2>{0.443310112f, 0.958493114f},
-std::array<float,2>{0.734014094f, 0.4382222f},
-std::array<float,2>{0.33722958f, 0.334157318f},
-std::array<float,2>{0.611464322f, 0.818350732f},
-std::array<float,2>{0.161684617f, 0.737982154f},
-std::array<float,2>{0.777949393f, 0.0419550724f},
-std::array<float,2>{0.300224066f, 0.129702166f},
-std::array<float,2>{0.529114783f, 0.552029312f},
-std::array<float,2>{0.243977651f, 0.929893374f},
-std::array<float,2>{0.851823509f, 0.428663492f},
-std::array<float,2>{0.0766240433f, 0.25945735f},
-std::array<float,2>{0.89610076f, 0.77196902f},
-std::array<float,2>{0.384223998f, 0.626551688f},
-std::array<float,2>{0.682249367f, 0.124035113f},
-std::array<float,2>{0.1416637f, 0.0197171811f},
-std::array<float,2>{0.806261897f, 0.691974044f},
-std::array<float,2>{0.360008955f, 0.846192718f},
-std::array<float,2>{0.575882435f, 0.367997348f},
-std::array<float,2>{0.482253641f, 0.491525054f},
-std::array<float,2>{0.701051533f, 0.977842808f},
-std::array<float,2>{0.00975666288f, 0.572600126f},
-std::array<float,2>{0.965179443f, 0.246299207f},
-std::array<float,2>{0.359195918f, 0.0529930852f},
-std::array<float,2>{0.580689609f, 0.722975016f},
-std::array<float,2>{0.129178777f, 0.832844973f},
-std::array<float,2>{0.789411068f, 0.327190071f},
-std::array<float,2>{0.020879291f, 0.468182117f},
-std::array<float,2>{0.948018909f, 0.93787545f},
-std::array<float,2>{0.49139291f, 0.606633723f},
-std::array<float,2>{0.71832633f, 0.195832044f},
-std::array<float,2>{0.232136637f, 0.180606544f},
-std::array<float,2>{0.869668424f, 0.502036691f},
-std::array<float,2>{0.285300732f, 0.897238851f},
-std::array<float,2>{0.502160966f, 0.384023875f},
-std::array<float,2>{0.404495895f, 0.303130537f},
-std::array<float,2>{0.66120851f, 0.798110425f},
-std::array<float,2>{0.0896687433f, 0.663884282f},
-std::array<float,2>{0.888186097f, 0.0795727521f},
-std::array<float,2>{0.461649507f, 0.219497338f},
-std::array<float,2>{0.747260332f, 0.587642908f},
-std::array<float,2>{0.0602942891f, 0.984766364f},
-std::array<float,2>{0.99796164f, 0.479561776f},
-std::array<float,2>{0.185565591f, 0.348184377f},
-std::array<float,2>{0.751975238f, 0.862172365f},
-std::array<float,2>{0.318245143f, 0.7054106f},
-std::array<float,2>{0.607943058f, 0.00841868576f},
-std::array<float,2>{0.107018426f, 0.107393213f},
-std::array<float,2>{0.927146375f, 0.641575396f},
-std::array<float,2>{0.41961062f, 0.751785994f},
-std::array<float,2>{0.62836498f, 0.276379496f},
-std::array<float,2>{0.263394952f, 0.42122525f},
-std::array<float,2>{0.537914872f, 0.915090919f},
-std::array<float,2>{0.207591102f, 0.532683194f},
-std::array<float,2>{0.827014863f, 0.153933018f},
-std::array<float,2>{0.443083316f, 0.0715024322f},
-std::array<float,2>{0.734211743f, 0.672374964f},
-std::array<float,2>{0.0435826778f, 0.793884575f},
-std::array<float,2>{0.971442461f, 0.28341344f},
-std::array<float,2>{0.161978677f, 0.392302066f},
-std::array<float,2>{0.77820605f, 0.880228817f},
-std::array<float,2>{0.337083638f, 0.527368665f},
-std::array<float,2>{0.611603439f, 0.160560474f},
-std::array<float,2>{0.124826379f, 0.217117846f},
-std::array<float,2>{0.912198424f, 0.619081378f},
-std::array<float,2>{0.431802988f, 0.95990169f},
-std::array<float,2>{0.642027557f, 0.439547598f},
-std::array<float,2>{0.274524093f, 0.333702654f},
-std::array<float,2>{0.555477262f, 0.819108307f},
-std::array<float,2>{0.192265332f, 0.735845387f},
-std::array<float,2>{0.835736871f, 0.0393556468f},
-std::array<float,2>{0.360144913f, 0.132065803f},
-std::array<float,2>{0.576072633f, 0.55313462f},
-std::array<float,2>{0.141888425f, 0.932385147f},
-std::array<float,2>{0.806402087f, 0.42632696f},
-std::array<float,2>{0.00937659387f, 0.261434406f},
-std::array<float,2>{0.964844346f, 0.770163417f},
-std::array<float,2>{0.482090235f, 0.626969099f},
-std::array<float,2>{0.700844049f, 0.121427335f},
-std::array<float,2>{0.243804365f, 0.0218464788f},
-std::array<float,2>{0.851709664f, 0.695066392f},
-std::array<float,2>{0.29990685f, 0.845176041f},
-std::array<float,2>{0.528949499f, 0.369191736f},
-std::array<float,2>{0.383794338f, 0.490085453f},
-std::array<float,2>{0.682561338f, 0.979780316f},
-std::array<float,2>{0.0762272477f, 0.570531011f},
-std::array<float,2>{0.89645195f, 0.248354122f},
-std::array<float,2>{0.285545021f, 0.052597899f},
-std::array<float,2>{0.502431095f, 0.725958645f},
-std::array<float,2>{0.232404694f, 0.834650636f},
-std::array<float,2>{0.870004356f, 0.325859249f},
-std::array<float,2>{0.0894552544f, 0.46582672f},
-std::array<float,2>{0.888440967f, 0.940486252f},
-std::array<float,2>{0.404684693f, 0.608849406f},
-std::array<float,2>{0.661551595f, 0.197503641f},
-std::array<float,2>{0.129108757f, 0.181956962f},
-std::array<float,2>{0.789232671f, 0.501465142f},
-std::array<float,2>{0.359121859f, 0.895925105f},
-std::array<float,2>{0.580855727f, 0.385786921f},
-std::array<float,2>{0.491605401f, 0.300998718f},
-std::array<float,2>{0.718670726f, 0.798914075f},
-std::array<float,2>{0.0205376856f, 0.661776602f},
-std::array<float,2>{0.947877109f, 0.0809364319f},
-std::array<float,2>{0.419912279f, 0.222483784f},
-std::array<float,2>{0.628040552f, 0.589770019f},
-std::array<float,2>{0.107239887f, 0.98711437f},
-std::array<float,2>{0.926841259f, 0.477682054f},
-std::array<float,2>{0.207839206f, 0.349767625f},
-std::array<float,2>{0.82666868f, 0.860108078f},
-std::array<float,2>{0.263640106f, 0.704499662f},
-std::array<float,2>{0.537714243f, 0.0114550749f},
-std::array<float,2>{0.0604351945f, 0.109133936f},
-std::array<float,2>{0.997764766f, 0.643049777f},
-std::array<float,2>{0.461714327f, 0.752890527f},
-std::array<float,2>{0.747428775f, 0.274460733f},
-std::array<float,2>{0.317914933f, 0.41820699f},
-std::array<float,2>{0.608200014f, 0.917280078f},
-std::array<float,2>{0.185960189f, 0.534062445f},
-std::array<float,2>{0.752288699f, 0.15494819f},
-std::array<float,2>{0.390692264f, 0.00349600101f},
-std::array<float,2>{0.669748008f, 0.717722237f},
-std::array<float,2>{0.0810564905f, 0.870615125f},
-std::array<float,2>{0.8789832f, 0.352442116f},
-std::array<float,2>{0.224003434f, 0.475531906f},
-std::array<float,2>{0.865465403f, 0.995174527f},
-std::array<float,2>{0.289550334f, 0.581959486f},
-std::array<float,2>{0.513321757f, 0.229476631f},
-std::array<float,2>{0.0284072421f, 0.145832092f},
-std::array<float,2>{0.942936182f, 0.541939735f},
-std::array<float,2>{0.497988015f, 0.906576216f},
-std::array<float,2>{0.7042979f, 0.408218086f},
-std::array<float,2>{0.343848795f, 0.271841496f},
-std::array<float,2>{0.588609159f, 0.759581089f},
-std::array<float,2>{0.133176446f, 0.649389803f},
-std::array<float,2>{0.786425412f, 0.0958671868f},
-std::array<float,2>{0.251722604f, 0.191479146f},
-std::array<float,2>{0.545054734f, 0.597397208f},
-std::array<float,2>{0.216401592f, 0.946822643f},
-std::array<float,2>{0.81358999f, 0.458335072f},
-std::array<float,2>{0.100117452f, 0.320104867f},
-std::array<float,2>{0.933909655f, 0.841576338f},
-std::array<float,2>{0.411950707f, 0.73406446f},
-std::array<float,2>{0.6378268f, 0.0569022074f},
-std::array<float,2>{0.172900215f, 0.0933616832f},
-std::array<float,2>{0.76283592f, 0.666243076f},
-std::array<float,2>{0.322881371f, 0.81231904f},
-std::array<float,2>{0.600083888f, 0.305093676f},
-std::array<float,2>{0.453859508f, 0.377664387f},
-std::array<float,2>{0.740905881f, 0.901553988f},
-std::array<float,2>{0.0532675385f, 0.508117676f},
-std::array<float,2>{0.991760612f, 0.172576234f},
-std::array<float,2>{0.331605822f, 0.112471759f},
-std::array<float,2>{0.619473755f, 0.633664012f},
-std::array<float,2>{0.169631913f, 0.780408204f},
-std::array<float,2>{0.767439544f, 0.255608052f},
-std::array<float,2>{0.0317317694f, 0.430543482f},
-std::array<float,2>{0.978462934f, 0.925090969f},
-std::array<float,2>{0.448858798f, 0.56060493f},
-std::array<float,2>{0.722522497f, 0.137013927f},
-std::array<float,2>{0.202492654f, 0.238624766f},
-std::array<float,2>{0.836654603f, 0.563096106f},
-std::array<float,2>{0.267625213f, 0.970323265f},
-std::array<float,2>{0.548193634f, 0.498658478f},
-std::array<float,2>{0.425127476f, 0.362962425f},
-std::array<float,2>{0.654843748f, 0.855656028f},
-std::array<float,2>{0.111402191f, 0.697374165f},
-std::array<float,2>{0.914491713f, 0.0244096536f},
-std::array<float,2>{0.47291398f, 0.167452782f},
-std::array<float,2>{0.690565705f, 0.522642076f},
-std::array<float,2>{0.00691873441f, 0.886623383f},
-std::array<float,2>{0.955983341f, 0.402782589f},
-std::array<float,2>{0.150745496f, 0.290409625f},
-std::array<float,2>{0.800145328f, 0.783748925f},
-std::array<float,2>{0.36757949f, 0.681321204f},
-std::array<float,2>{0.566777289f, 0.0641817898f},
-std::array<float,2>{0.0693271309f, 0.0318273343f},
-std::array<float,2>{0.904768586f, 0.742836773f},
-std::array<float,2>{0.376761615f, 0.825667143f},
-std::array<float,2>{0.674177647f, 0.338105142f},
-std::array<float,2>{0.308187515f, 0.446523875f},
-std::array<float,2>{0.518914104f, 0.968235075f},
-std::array<float,2>{0.234673321f, 0.610933065f},
-std::array<float,2>{0.848222494f, 0.205365121f},
-std::array<float,2>{0.492716044f, 0.0448933877f},
-std::array<float,2>{0.707934976f, 0.74152863f},
-std::array<float,2>{0.0234963167f, 0.816398561f},
-std::array<float,2>{0.938429892f, 0.329426229f},
-std::array<float,2>{0.1373142f, 0.444316238f},
-std::array<float,2>{0.784125984f, 0.954975128f},
-std::array<float,2>{0.349075824f, 0.622792244f},
-std::array<float,2>{0.591753006f, 0.211358055f},
-std::array<float,2>{0.0844109654f, 0.159501761f},
-std::array<float,2>{0.876312613f, 0.525390267f},
-std::array<float,2>{0.396822274f, 0.876976013f},
-std::array<float,2>{0.665666103f, 0.39658466f},
-std::array<float,2>{0.29299286f, 0.286387831f},
-std::array<float,2>{0.510117292f, 0.791147113f},
-std::array<float,2>{0.222355187f, 0.676983714f},
-std::array<float,2>{0.863233984f, 0.0756805241f},
-std::array<float,2>{0.325873733f, 0.243194386f},
-std::array<float,2>{0.594448388f, 0.574720979f},
-std::array<float,2>{0.177679226f, 0.983148515f},
-std::array<float,2>{0.759220839f, 0.485108197f},
-std::array<float,2>{0.0503229052f, 0.371662736f},
-std::array<float,2>{0.986815453f, 0.847852468f},
-std::array<float,2>{0.459110767f, 0.690480351f},
-std::array<float,2>{0.737406194f, 0.017176291f},
-std::array<float,2>{0.211289376f, 0.11996866f},
-std::array<float,2>{0.81739378f, 0.630257487f},
-std::array<float,2>{0.257045299f, 0.76616466f},
-std::array<float,2>{0.54197216f, 0.261900783f},
-std::array<float,2>{0.407120585f, 0.423198164f},
-std::array<float,2>{0.636659086f, 0.936865926f},
-std::array<float,2>{0.0946466923f, 0.549729824f},
-std::array<float,2>{0.930072308f, 0.125743791f},
-std::array<float,2>{0.271637648f, 0.0853329152f},
-std::array<float,2>{0.553939223f, 0.657948434f},
-std::array<float,2>{0.198232144f, 0.802969456f},
-std::array<float,2>{0.840374529f, 0.300561845f},
-std::array<float,2>{0.115067944f, 0.38967213f},
-std::array<float,2>{0.921856582f, 0.89187336f},
-std::array<float,2>{0.426445574f, 0.507571101f},
-std::array<float,2>{0.651398718f, 0.185005099f},
-std::array<float,2>{0.165016517f, 0.20013392f},
-std::array<float,2>{0.772160172f, 0.603619337f},
-std::array<float,2>{0.335267663f, 0.943391919f},
-std::array<float,2>{0.622672856f, 0.46173048f},
-std::array<float,2>{0.452462494f, 0.322488427f},
-std::array<float,2>{0.723678052f, 0.829612732f},
-std::array<float,2>{0.036926616f, 0.721098483f},
-std::array<float,2>{0.983264804f, 0.0498553663f},
-std::array<float,2>{0.379812896f, 0.150739446f},
-std::array<float,2>{0.676180542f, 0.53754729f},
-std::array<float,2>{0.0654318109f, 0.920516431f},
-std::array<float,2>{0.898471415f, 0.416002542f},
-std::array<float,2>{0.238429233f, 0.280710906f},
-std::array<float,2>{0.845820129f, 0.754336238f},
-std::array<float,2>{0.309825033f, 0.644959033f},
-std::array<float,2>{0.521116138f, 0.105102517f},
-std::array<float,2>{0.00283342483f, 0.013526462f},
-std::array<float,2>{0.957062006f, 0.710914552f},
-std::array<float,2>{0.472087234f, 0.865095019f},
-std::array<float,2>{0.691497922f, 0.346888453f},
-std::array<float,2>{0.374097645f, 0.483959824f},
-std::array<float,2>{0.563520074f, 0.990330458f},
-std::array<float,2>{0.153184533f, 0.593546093f},
-std::array<float,2>{0.802220523f, 0.226071581f},
-std::array<float,2>{0.433617741f, 0.100806087f},
-std::array<float,2>{0.644829273f, 0.652838945f},
-std::array<float,2>{0.119640276f, 0.763034403f},
-std::array<float,2>{0.90866822f, 0.266918689f},
-std::array<float,2>{0.189974517f, 0.411218882f},
-std::array<float,2>{0.829954267f, 0.912673414f},
-std::array<float,2>{0.27932775f, 0.543596089f},
-std::array<float,2>{0.560376525f, 0.141967088f},
-std::array<float,2>{0.039362777f, 0.233641669f},
-std::array<float,2>{0.974813998f, 0.583922625f},
-std::array<float,2>{0.440107405f, 0.998745382f},
-std::array<float,2>{0.729383886f, 0.471999258f},
-std::array<float,2>{0.341624856f, 0.356628984f},
-std::array<float,2>{0.615497351f, 0.873894274f},
-std::array<float,2>{0.157478869f, 0.711043596f},
-std::array<float,2>{0.776433766f, 0.00660078041f},
-std::array<float,2>{0.303723991f, 0.177434653f},
-std::array<float,2>{0.524995327f, 0.511751533f},
-std::array<float,2>{0.24772957f, 0.904466033f},
-std::array<float,2>{0.857936621f, 0.381802797f},
-std::array<float,2>{0.0706313029f, 0.310045868f},
-std::array<float,2>{0.891844034f, 0.808230162f},
-std::array<float,2>{0.387913227f, 0.66947633f},
-std::array<float,2>{0.684568763f, 0.0890826657f},
-std::array<float,2>{0.14816238f, 0.0624800213f},
-std::array<float,2>{0.811104596f, 0.728052795f},
-std::array<float,2>{0.366973162f, 0.837848485f},
-std::array<float,2>{0.57217294f, 0.313490778f},
-std::array<float,2>{0.480276674f, 0.456903756f},
-std::array<float,2>{0.696184337f, 0.952629507f},
-std::array<float,2>{0.0123222815f, 0.599097252f},
-std::array<float,2>{0.961215198f, 0.188855529f},
-std::array<float,2>{0.351992458f, 0.0300017186f},
-std::array<float,2>{0.58300209f, 0.699948311f},
-std::array<float,2>{0.125207901f, 0.852215409f},
-std::array<float,2>{0.795018315f, 0.364231288f},
-std::array<float,2>{0.0160547215f, 0.495775998f},
-std::array<float,2>{0.951281548f, 0.976493061f},
-std::array<float,2>{0.486542225f, 0.566720784f},
-std::array<float,2>{0.711453438f, 0.238117069f},
-std::array<float,2>{0.226763204f, 0.135769516f},
-std::array<float,2>{0.873945832f, 0.558544695f},
-std::array<float,2>{0.281529963f, 0.929660857f},
-std::array<float,2>{0.504221022f, 0.434230357f},
-std::array<float,2>{0.398471236f, 0.253064275f},
-std::array<float,2>{0.659742117f, 0.776322544f},
-std::array<float,2>{0.0923343971f, 0.639909029f},
-std::array<float,2>{0.885338485f, 0.11575368f},
-std::array<float,2>{0.466821671f, 0.20957844f},
-std::array<float,2>{0.743351936f, 0.614753664f},
-std::array<float,2>{0.0560554639f, 0.963632822f},
-std::array<float,2>{0.994308531f, 0.450986028f},
-std::array<float,2>{0.180399314f, 0.340786219f},
-std::array<float,2>{0.754771113f, 0.821407795f},
-std::array<float,2>{0.315068066f, 0.749185264f},
-std::array<float,2>{0.601713121f, 0.0389282852f},
-std::array<float,2>{0.104660317f, 0.0682768077f},
-std::array<float,2>{0.92553401f, 0.686253011f},
-std::array<float,2>{0.416373104f, 0.786172807f},
-std::array<float,2>{0.631459653f, 0.296240687f},
-std::array<float,2>{0.258100122f, 0.401890755f},
-std::array<float,2>{0.533382297f, 0.887676656f},
-std::array<float,2>{0.204305783f, 0.515734613f},
-std::array<float,2>{0.82055378f, 0.168721646f},
-std::array<float,2>{0.483706474f, 0.123380549f},
-std::array<float,2>{0.702612698f, 0.625016332f},
-std::array<float,2>{0.009776989f, 0.772898614f},
-std::array<float,2>{0.96762079f, 0.258429289f},
-std::array<float,2>{0.143579841f, 0.429476053f},
-std::array<float,2>{0.807341874f, 0.931475222f},
-std::array<float,2>{0.362317502f, 0.550968587f},
-std::array<float,2>{0.576797962f, 0.130507439f},
-std::array<float,2>{0.0748002231f, 0.247823596f},
-std::array<float,2>{0.896485865f, 0.573546469f},
-std::array<float,2>{0.386346519f, 0.97749424f},
-std::array<float,2>{0.680993021f, 0.490549147f},
-std::array<float,2>{0.298089653f, 0.369040072f},
-std::array<float,2>{0.52999872f, 0.847442746f},
-std::array<float,2>{0.245563269f, 0.692386031f},
-std::array<float,2>{0.854996979f, 0.0211108495f},
-std::array<float,2>{0.33816725f, 0.162270382f},
-std::array<float,2>{0.611189485f, 0.530786455f},
-std::array<float,2>{0.162915349f, 0.881206691f},
-std::array<float,2>{0.779767215f, 0.393177837f},
-std::array<float,2>{0.0468184203f, 0.28264603f},
-std::array<float,2>{0.970356405f, 0.795250297f},
-std::array<float,2>{0.444618642f, 0.67543447f},
-std::array<float,2>{0.731999636f, 0.0741338208f},
-std::array<float,2>{0.195003286f, 0.0420437492f},
-std::array<float,2>{0.83361131f, 0.736428797f},
-std::array<float,2>{0.276899874f, 0.816992164f},
-std::array<float,2>{0.557968616f, 0.335286975f},
-std::array<float,2>{0.431425512f, 0.438562423f},
-std::array<float,2>{0.643822014f, 0.957991064f},
-std::array<float,2>{0.121970624f, 0.619179487f},
-std::array<float,2>{0.911076367f, 0.215957254f},
-std::array<float,2>{0.263692349f, 0.00899495929f},
-std::array<float,2>{0.536909044f, 0.706908345f},
-std::array<float,2>{0.210691571f, 0.86308068f},
-std::array<float,2>{0.824867785f, 0.349271446f},
-std::array<float,2>{0.10820394f, 0.479222715f},
-std::array<float,2>{0.929126382f, 0.985844314f},
-std::array<float,2>{0.421648115f, 0.58651793f},
-std::array<float,2>{0.626147211f, 0.220120654f},
-std::array<float,2>{0.18531768f, 0.152634934f},
-std::array<float,2>{0.751430452f, 0.531760991f},
-std::array<float,2>{0.318590432f, 0.914619088f},
-std::array<float,2>{0.606521785f, 0.420455128f},
-std::array<float,2>{0.463329911f, 0.275591761f},
-std::array<float,2>{0.748877108f, 0.750946701f},
-std::array<float,2>{0.0606042184f, 0.641673505f},
-std::array<float,2>{0.998470783f, 0.105666548f},
-std::array<float,2>{0.402527153f, 0.196289614f},
-std::array<float,2>{0.662557125f, 0.60575217f},
-std::array<float,2>{0.086089544f, 0.939249337f},
-std::array<float,2>{0.890501797f, 0.467042476f},
-std::array<float,2>{0.232810035f, 0.326568007f},
-std::array<float,2>{0.868188858f, 0.833971024f},
-std::array<float,2>{0.287539721f, 0.724507451f},
-std::array<float,2>{0.500020683f, 0.0542256571f},
-std::array<float,2>{0.0229404438f, 0.0781913251f},
-std::array<float,2>{0.946506619f, 0.662709117f},
-std::array<float,2>{0.490184098f, 0.797149181f},
-std::array<float,2>{0.716348946f, 0.303784639f},
-std::array<float,2>{0.355715573f, 0.383551329f},
-std::array<float,2>{0.579282522f, 0.897465348f},
-std::array<float,2>{0.131037399f, 0.50347805f},
-std::array<float,2>{0.791058183f, 0.181445703f},
-std::array<float,2>{0.413240701f, 0.0557973981f},
-std::array<float,2>{0.639793992f, 0.730880678f},
-std::array<float,2>{0.0978854895f, 0.842611849f},
-std::array<float,2>{0.936075687f, 0.317134798f},
-std::array<float,2>{0.218225643f, 0.46043539f},
-std::array<float,2>{0.814796686f, 0.94770205f},
-std::array<float,2>{0.25324595f, 0.594492257f},
-std::array<float,2>{0.544799328f, 0.194810897f},
-std::array<float,2>{0.0511495061f, 0.174425408f},
-std::array<float,2>{0.989480138f, 0.511036992f},
-std::array<float,2>{0.456999749f, 0.899152517f},
-std::array<float,2>{0.739211738f, 0.376145512f},
-std::array<float,2>{0.321967363f, 0.307971328f},
-std::array<float,2>{0.599184513f, 0.809055984f},
-std::array<float,2>{0.174966514f, 0.664558172f},
-std::array<float,2>{0.765500128f, 0.0917618126f},
-std::array<float,2>{0.291195869f, 0.228506699f},
-std::array<float,2>{0.515009701f, 0.578629434f},
-std::array<float,2>{0.226030514f, 0.993936539f},
-std::array<float,2>{0.864786863f, 0.473849505f},
-std::array<float,2>{0.0786080062f, 0.354088515f},
-std::array<float,2>{0.881073892f, 0.8677513f},
-std::array<float,2>{0.393108457f, 0.715433598f},
-std::array<float,2>{0.671600938f, 0.00150873046f},
-std::array<float,2>{0.135416463f, 0.093890734f},
-std::array<float,2>{0.788951337f, 0.65093118f},
-std::array<float,2>{0.346516401f, 0.761167347f},
-std::array<float,2>{0.586142004f, 0.270822495f},
-std::array<float,2>{0.499097109f, 0.40647608f},
-std::array<float,2>{0.706797481f, 0.908632934f},
-std::array<float,2>{0.0294415355f, 0.540634334f},
-std::array<float,2>{0.944778025f, 0.147557244f},
-std::array<float,2>{0.370601505f, 0.0660629645f},
-std::array<float,2>{0.569399595f, 0.682095587f},
-std::array<float,2>{0.148947358f, 0.782181084f},
-std::array<float,2>{0.797813118f, 0.292219192f},
-std::array<float,2>{0.00525486842f, 0.405709118f},
-std::array<float,2>{0.953272283f, 0.882970273f},
-std::array<float,2>{0.474683821f, 0.520306468f},
-std::array<float,2>{0.688543797f, 0.164595693f},
-std::array<float,2>{0.237911135f, 0.204286247f},
-std::array<float,2>{0.849897206f, 0.613174796f},
-std::array<float,2>{0.306138664f, 0.964937627f},
-std::array<float,2>{0.516096115f, 0.448416561f},
-std::array<float,2>{0.37804544f, 0.336373985f},
-std::array<float,2>{0.672461629f, 0.827262282f},
-std::array<float,2>{0.0668694228f, 0.745118976f},
-std::array<float,2>{0.902747452f, 0.0332997441f},
-std::array<float,2>{0.446788251f, 0.140066102f},
-std::array<float,2>{0.719685197f, 0.558636785f},
-std::array<float,2>{0.0333387703f, 0.923419714f},
-std::array<float,2>{0.979257405f, 0.4330571f},
-std::array<float,2>{0.171132982f, 0.255929172f},
-std::array<float,2>{0.768731952f, 0.778096437f},
-std::array<float,2>{0.329155266f, 0.635474026f},
-std::array<float,2>{0.61740607f, 0.110657834f},
-std::array<float,2>{0.109889224f, 0.0257175937f},
-std::array<float,2>{0.917774796f, 0.696892381f},
-std::array<float,2>{0.421941042f, 0.859355867f},
-std::array<float,2>{0.652937353f, 0.359709263f},
-std::array<float,2>{0.266154379f, 0.497140586f},
-std::array<float,2>{0.549270034f, 0.971636117f},
-std::array<float,2>{0.200938955f, 0.565212667f},
-std::array<float,2>{0.838578165f, 0.241925552f},
-std::array<float,2>{0.45824033f, 0.0186872445f},
-std::array<float,2>{0.735352337f, 0.687728643f},
-std::array<float,2>{0.0471969359f, 0.851334453f},
-std::array<float,2>{0.984864235f, 0.373101205f},
-std::array<float,2>{0.179477632f, 0.487432957f},
-std::array<float,2>{0.760400116f, 0.981651545f},
-std::array<float,2>{0.326566041f, 0.576291859f},
-std::array<float,2>{0.596917152f, 0.24530676f},
-std::array<float,2>{0.0963067785f, 0.12748684f},
-std::array<float,2>{0.932074368f, 0.547792435f},
-std::array<float,2>{0.40847072f, 0.934501767f},
-std::array<float,2>{0.634628892f, 0.425227523f},
-std::array<float,2>{0.255045921f, 0.265292227f},
-std::array<float,2>{0.539765775f, 0.76906389f},
-std::array<float,2>{0.213376001f, 0.632367849f},
-std::array<float,2>{0.818782032f, 0.117324665f},
-std::array<float,2>{0.349705935f, 0.213468671f},
-std::array<float,2>{0.592139363f, 0.624043047f},
-std::array<float,2>{0.139921591f, 0.955291808f},
-std::array<float,2>{0.782429755f, 0.442097366f},
-std::array<float,2>{0.0270652324f, 0.331649482f},
-std::array<float,2>{0.940559328f, 0.813288867f},
-std::array<float,2>{0.495055288f, 0.739284992f},
-std::array<float,2>{0.710187554f, 0.0463820472f},
-std::array<float,2>{0.220334038f, 0.0761856064f},
-std::array<float,2>{0.860140085f, 0.678933382f},
-std::array<float,2>{0.295498401f, 0.78935653f},
-std::array<float,2>{0.509712875f, 0.288502634f},
-std::array<float,2>{0.395358652f, 0.394798696f},
-std::array<float,2>{0.667697728f, 0.876253724f},
-std::array<float,2>{0.0838655308f, 0.526126444f},
-std::array<float,2>{0.878258765f, 0.156688049f},
-std::array<float,2>{0.311606169f, 0.102532759f},
-std::array<float,2>{0.523094177f, 0.647322536f},
-std::array<float,2>{0.24128066f, 0.75677532f},
-std::array<float,2>{0.844733119f, 0.279082268f},
-std::array<float,2>{0.0627329051f, 0.417346686f},
-std::array<float,2>{0.900930107f, 0.918952525f},
-std::array<float,2>{0.382597119f, 0.535667598f},
-std::array<float,2>{0.677950025f, 0.14937456f},
-std::array<float,2>{0.155863866f, 0.22451058f},
-std::array<float,2>{0.80297035f, 0.591264367f},
-std::array<float,2>{0.372485429f, 0.989813507f},
-std::array<float,2>{0.565362811f, 0.48232308f},
-std::array<float,2>{0.470261693f, 0.34449774f},
-std::array<float,2>{0.694138646f, 0.865589321f},
-std::array<float,2>{0.000465730613f, 0.707649112f},
-std::array<float,2>{0.960230231f, 0.0145335617f},
-std::array<float,2>{0.429292113f, 0.185891896f},
-std::array<float,2>{0.648679256f, 0.50403738f},
-std::array<float,2>{0.116295129f, 0.893399715f},
-std::array<float,2>{0.918495238f, 0.388557643f},
-std::array<float,2>{0.196984679f, 0.297180384f},
-std::array<float,2>{0.84245348f, 0.801073074f},
-std::array<float,2>{0.271318376f, 0.658306003f},
-std::array<float,2>{0.552014172f, 0.0820705667f},
-std::array<float,2>{0.0376210101f, 0.0477009751f},
-std::array<float,2>{0.981259406f, 0.720544457f},
-std::array<float,2>{0.449695587f, 0.83061105f},
-std::array<float,2>{0.725329638f, 0.322208524f},
-std::array<float,2>{0.333777249f, 0.46370551f},
-std::array<float,2>{0.624679506f, 0.943080187f},
-std::array<float,2>{0.16661635f, 0.603302538f},
-std::array<float,2>{0.771054268f, 0.202289f},
-std::array<float,2>{0.390075833f, 0.0872300938f},
-std::array<float,2>{0.686422527f, 0.670739889f},
-std::array<float,2>{0.0724488422f, 0.804713249f},
-std::array<float,2>{0.894179463f, 0.311850995f},
-std::array<float,2>{0.249252409f, 0.380126208f},
-std::array<float,2>{0.85731405f, 0.903784156f},
-std::array<float,2>{0.302678108f, 0.515264928f},
-std::array<float,2>{0.526816249f, 0.177932277f},
-std::array<float,2>{0.0144425342f, 0.191334635f},
-std::array<float,2>{0.963193536f, 0.600517571f},
-std::array<float,2>{0.478127897f, 0.949462593f},
-std::array<float,2>{0.697731793f, 0.454288155f},
-std::array<float,2>{0.364529878f, 0.315165162f},
-std::array<float,2>{0.573136032f, 0.839257717f},
-std::array<float,2>{0.146475598f, 0.729507506f},
-std::array<float,2>{0.809120595f, 0.0605378263f},
-std::array<float,2>{0.277628362f, 0.143748581f},
-std::array<float,2>{0.561298668f, 0.545170248f},
-std::array<float,2>{0.187501088f, 0.910676658f},
-std::array<float,2>{0.830592394f, 0.412847787f},
-std::array<float,2>{0.117267936f, 0.268427342f},
-std::array<float,2>{0.906322956f, 0.765142739f},
-std::array<float,2>{0.435806394f, 0.65515238f},
-std::array<float,2>{0.647791564f, 0.0990415141f},
-std::array<float,2>{0.160098806f, 0.00465738121f},
-std::array<float,2>{0.773899853f, 0.713745356f},
-std::array<float,2>{0.34367466f, 0.871909022f},
-std::array<float,2>{0.613437712f, 0.357828945f},
-std::array<float,2>{0.437680751f, 0.468788892f},
-std::array<float,2>{0.727657676f, 0.997147083f},
-std::array<float,2>{0.0412292965f, 0.585059822f},
-std::array<float,2>{0.973646879f, 0.23176311f},
-std::array<float,2>{0.313206673f, 0.0364431925f},
-std::array<float,2>{0.604628205f, 0.746096611f},
-std::array<float,2>{0.182498321f, 0.82304287f},
-std::array<float,2>{0.755970061f, 0.343331724f},
-std::array<float,2>{0.0573348925f, 0.451490253f},
-std::array<float,2>{0.993142903f, 0.961827159f},
-std::array<float,2>{0.466331393f, 0.616764426f},
-std::array<float,2>{0.744262934f, 0.208951369f},
-std::array<float,2>{0.206346974f, 0.171687126f},
-std::array<float,2>{0.822855115f, 0.519370139f},
-std::array<float,2>{0.260834962f, 0.889764547f},
-std::array<float,2>{0.533078194f, 0.398601919f},
-std::array<float,2>{0.415330768f, 0.293537915f},
-std::array<float,2>{0.630509198f, 0.788688838f},
-std::array<float,2>{0.102419309f, 0.685146987f},
-std::array<float,2>{0.922843397f, 0.0694192871f},
-std::array<float,2>{0.485518426f, 0.234388813f},
-std::array<float,2>{0.714739859f, 0.568600476f},
-std::array<float,2>{0.0179426521f, 0.973694444f},
-std::array<float,2>{0.950149536f, 0.493408769f},
-std::array<float,2>{0.127766758f, 0.366145015f},
-std::array<float,2>{0.794251919f, 0.854688406f},
-std::array<float,2>{0.355256349f, 0.702785671f},
-std::array<float,2>{0.584290087f, 0.0280435458f},
-std::array<float,2>{0.0912288949f, 0.113842852f},
-std::array<float,2>{0.883333325f, 0.638559997f},
-std::array<float,2>{0.402071476f, 0.775166988f},
-std::array<float,2>{0.6567837f, 0.251793861f},
-std::array<float,2>{0.284927636f, 0.437220424f},
-std::array<float,2>{0.507367849f, 0.926919997f},
-std::array<float,2>{0.228586197f, 0.555091381f},
-std::array<float,2>{0.872370303f, 0.133390591f},
-std::array<float,2>{0.488747895f, 0.0811933205f},
-std::array<float,2>{0.715819836f, 0.66045624f},
-std::array<float,2>{0.0215970203f, 0.80026108f},
-std::array<float,2>{0.94598794f, 0.302085042f},
-std::array<float,2>{0.132033154f, 0.384864002f},
-std::array<float,2>{0.792299867f, 0.894729853f},
-std::array<float,2>{0.357012779f, 0.500487089f},
-std::array<float,2>{0.578769565f, 0.183289498f},
-std::array<float,2>{0.0877324417f, 0.198956519f},
-std::array<float,2>{0.888982654f, 0.608008981f},
-std::array<float,2>{0.404267788f, 0.94001019f},
-std::array<float,2>{0.663508415f, 0.464847118f},
-std::array<float,2>{0.288590252f, 0.324516952f},
-std::array<float,2>{0.501048803f, 0.835600674f},
-std::array<float,2>{0.233923376f, 0.724699378f},
-std::array<float,2>{0.867378235f, 0.0509937704f},
-std::array<float,2>{0.320234954f, 0.155430168f},
-std::array<float,2>{0.606081188f, 0.53427428f},
-std::array<float,2>{0.183662713f, 0.916528642f},
-std::array<float,2>{0.75042814f, 0.419693083f},
-std::array<float,2>{0.0620909296f, 0.273456991f},
-std::array<float,2>{0.999242127f, 0.753452957f},
-std::array<float,2>{0.464413583f, 0.64433533f},
-std::array<float,2>{0.749396503f, 0.108199112f},
-std::array<float,2>{0.209169358f, 0.00988152064f},
-std::array<float,2>{0.825966179f, 0.703710854f},
-std::array<float,2>{0.265243709f, 0.860425174f},
-std::array<float,2>{0.535631299f, 0.351271212f},
-std::array<float,2>{0.420708865f, 0.47730723f},
-std::array<float,2>{0.625760019f, 0.988066852f},
-std::array<float,2>{0.108576424f, 0.588092744f},
-std::array<float,2>{0.92816937f, 0.221495241f},
-std::array<float,2>{0.276328325f, 0.0400448553f},
-std::array<float,2>{0.557596207f, 0.734739184f},
-std::array<float,2>{0.193492174f, 0.820053816f},
-std::array<float,2>{0.832809389f, 0.332282752f},
-std::array<float,2>{0.122560441f, 0.440905988f},
-std::array<float,2>{0.911759853f, 0.960897326f},
-std::array<float,2>{0.429740727f, 0.617951751f},
-std::array<float,2>{0.642924309f, 0.217792973f},
-std::array<float,2>{0.163156062f, 0.161430597f},
-std::array<float,2>{0.7805264f, 0.529214978f},
-std::array<float,2>{0.33894822f, 0.879385114f},
-std::array<float,2>{0.609878182f, 0.391599119f},
-std::array<float,2>{0.443584621f, 0.284919173f},
-std::array<float,2>{0.731326699f, 0.794741571f},
-std::array<float,2>{0.0451222844f, 0.673029006f},
-std::array<float,2>{0.969620764f, 0.071043849f},
-std::array<float,2>{0.38538298f, 0.249447376f},
-std::array<float,2>{0.680457115f, 0.571311831f},
-std::array<float,2>{0.0753449351f, 0.979072511f},
-std::array<float,2>{0.898325801f, 0.489084691f},
-std::array<float,2>{0.244474649f, 0.370203763f},
-std::array<float,2>{0.85384196f, 0.84399116f},
-std::array<float,2>{0.297343642f, 0.693361104f},
-std::array<float,2>{0.530941844f, 0.0225912388f},
-std::array<float,2>{0.0107493941f, 0.12229909f},
-std::array<float,2>{0.967909634f, 0.628541768f},
-std::array<float,2>{0.483048499f, 0.770891666f},
-std::array<float,2>{0.701545179f, 0.260359824f},
-std::array<float,2>{0.361501127f, 0.427007943f},
-std::array<float,2>{0.578063488f, 0.933473468f},
-std::array<float,2>{0.143511608f, 0.553989172f},
-std::array<float,2>{0.808325112f, 0.131625399f},
-std::array<float,2>{0.423768133f, 0.0246769078f},
-std::array<float,2>{0.654197037f, 0.698548436f},
-std::array<float,2>{0.110810772f, 0.856810033f},
-std::array<float,2>{0.916368246f, 0.362131268f},
-std::array<float,2>{0.199795231f, 0.499188572f},
-std::array<float,2>{0.839079916f, 0.968885362f},
-std::array<float,2>{0.266937733f, 0.563938856f},
-std::array<float,2>{0.550220013f, 0.239496827f},
-std::array<float,2>{0.0342186652f, 0.137730569f},
-std::array<float,2>{0.980201483f, 0.562474608f},
-std::array<float,2>{0.445705563f, 0.924166203f},
-std::array<float,2>{0.720559776f, 0.43142879f},
-std::array<float,2>{0.328629464f, 0.254307687f},
-std::array<float,2>{0.618560135f, 0.77946949f},
-std::array<float,2>{0.170170993f, 0.634526789f},
-std::array<float,2>{0.768019795f, 0.111415163f},
-std::array<float,2>{0.304776937f, 0.206336185f},
-std::array<float,2>{0.516683459f, 0.60979265f},
-std::array<float,2>{0.236644715f, 0.966808975f},
-std::array<float,2>{0.851300478f, 0.44614163f},
-std::array<float,2>{0.0680609569f, 0.33936727f},
-std::array<float,2>{0.90409708f, 0.824956596f},
-std::array<float,2>{0.377476156f, 0.743971825f},
-std::array<float,2>{0.673128188f, 0.0330266468f},
-std::array<float,2>{0.150329292f, 0.062550053f},
-std::array<float,2>{0.797869205f, 0.67977941f},
-std::array<float,2>{0.369826138f, 0.78445369f},
-std::array<float,2>{0.569319606f, 0.289464533f},
-std::array<float,2>{0.475942403f, 0.40414235f},
-std::array<float,2>{0.688322127f, 0.88516438f},
-std::array<float,2>{0.00417081965f, 0.521746278f},
-std::array<float,2>{0.954629064f, 0.166093707f},
-std::array<float,2>{0.346991569f, 0.0970154256f},
-std::array<float,2>{0.586951256f, 0.649697185f},
-std::array<float,2>{0.136016503f, 0.757859409f},
-std::array<float,2>{0.787372649f, 0.273054212f},
-std::array<float,2>{0.0304224882f, 0.409728497f},
-std::array<float,2>{0.943936288f, 0.907363176f},
-std::array<float,2>{0.498807758f, 0.542440236f},
-std::array<float,2>{0.705830038f, 0.145114556f},
-std::array<float,2>{0.224712119f, 0.229669288f},
-std::array<float,2>{0.863334179f, 0.580856681f},
-std::array<float,2>{0.292429805f, 0.994825065f},
-std::array<float,2>{0.514117002f, 0.476299554f},
-std::array<float,2>{0.394233704f, 0.352947772f},
-std::array<float,2>{0.670020163f, 0.869246662f},
-std::array<float,2>{0.0795192048f, 0.718401849f},
-std::array<float,2>{0.882225871f, 0.00212237495f},
-std::array<float,2>{0.455882281f, 0.173807427f},
-std::array<float,2>{0.739396095f, 0.50914526f},
-std::array<float,2>{0.0526873656f, 0.90136236f},
-std::array<float,2>{0.989115f, 0.378575236f},
-std::array<float,2>{0.174643978f, 0.306134462f},
-std::array<float,2>{0.764315546f, 0.810686648f},
-std::array<float,2>{0.321000904f, 0.667078853f},
-std::array<float,2>{0.597825825f, 0.0921816379f},
-std::array<float,2>{0.0992934331f, 0.0581599623f},
-std::array<float,2>{0.936804295f, 0.732488096f},
-std::array<float,2>{0.412797064f, 0.840673149f},
-std::array<float,2>{0.639426887f, 0.319147915f},
-std::array<float,2>{0.25292024f, 0.457609594f},
-std::array<float,2>{0.543469727f, 0.946247578f},
-std::array<float,2>{0.216806829f, 0.596537769f},
-std::array<float,2>{0.816248417f, 0.192900106f},
-std::array<float,2>{0.450604558f, 0.0494859889f},
-std::array<float,2>{0.72614181f, 0.721933246f},
-std::array<float,2>{0.0385265984f, 0.82863158f},
-std::array<float,2>{0.981784582f, 0.323473722f},
-std::array<float,2>{0.167243987f, 0.461945683f},
-std::array<float,2>{0.769791961f, 0.945031285f},
-std::array<float,2>{0.332985044f, 0.604977608f},
-std::array<float,2>{0.623574317f, 0.200647771f},
-std::array<float,2>{0.115398824f, 0.184365511f},
-std::array<float,2>{0.91922313f, 0.506402135f},
-std::array<float,2>{0.428514957f, 0.8914482f},
-std::array<float,2>{0.650077105f, 0.388845325f},
-std::array<float,2>{0.269982785f, 0.299101889f},
-std::array<float,2>{0.550849378f, 0.804629266f},
-std::array<float,2>{0.196130037f, 0.657186985f},
-std::array<float,2>{0.843292415f, 0.0845553651f},
-std::array<float,2>{0.371121913f, 0.224965453f},
-std::array<float,2>{0.565494537f, 0.592385113f},
-std::array<float,2>{0.15504846f, 0.991423547f},
-std::array<float,2>{0.803741395f, 0.482535422f},
-std::array<float,2>{0.00176439283f, 0.346627176f},
-std::array<float,2>{0.95972836f, 0.863518178f},
-std::array<float,2>{0.469682246f, 0.709380209f},
-std::array<float,2>{0.694647789f, 0.0118674142f},
-std::array<float,2>{0.240664706f, 0.104158416f},
-std::array<float,2>{0.844335616f, 0.645836174f},
-std::array<float,2>{0.310600072f, 0.755546749f},
-std::array<float,2>{0.52211678f, 0.280120701f},
-std::array<float,2>{0.381781489f, 0.414355725f},
-std::array<float,2>{0.679429471f, 0.921538711f},
-std::array<float,2>{0.0634849891f, 0.538911283f},
-std::array<float,2>{0.902212024f, 0.151762858f},
-std::array<float,2>{0.296279669f, 0.0743287504f},
-std::array<float,2>{0.507991314f, 0.676633954f},
-std::array<float,2>{0.219694227f, 0.792276859f},
-std::array<float,2>{0.860364974f, 0.285443008f},
-std::array<float,2>{0.0825750306f, 0.397920966f},
-std::array<float,2>{0.877741814f, 0.878799379f},
-std::array<float,2>{0.396461725f, 0.524201095f},
-std::array<float,2>{0.666350901f, 0.158406362f},
-std::array<float,2>{0.138786957f, 0.211949453f},
-std::array<float,2>{0.781316519f, 0.621951103f},
-std::array<float,2>{0.350683182f, 0.953248203f},
-std::array<float,2>{0.593078434f, 0.444847107f},
-std::array<float,2>{0.495204061f, 0.328544229f},
-std::array<float,2>{0.709599078f, 0.815193772f},
-std::array<float,2>{0.025416106f, 0.74097085f},
-std::array<float,2>{0.939740717f, 0.0436841957f},
-std::array<float,2>{0.409314305f, 0.126486763f},
-std::array<float,2>{0.633359075f, 0.550740182f},
-std::array<float,2>{0.0968689173f, 0.935910702f},
-std::array<float,2>{0.933567703f, 0.422299832f},
-std::array<float,2>{0.21406737f, 0.262854934f},
-std::array<float,2>{0.82008028f, 0.767284155f},
-std::array<float,2>{0.254763246f, 0.629763782f},
-std::array<float,2>{0.54011929f, 0.120378293f},
-std::array<float,2>{0.0480569191f, 0.0164548121f},
-std::array<float,2>{0.985625327f, 0.690091014f},
-std::array<float,2>{0.457652926f, 0.849505901f},
-std::array<float,2>{0.734508097f, 0.37281397f},
-std::array<float,2>{0.327472836f, 0.485874712f},
-std::array<float,2>{0.596318424f, 0.984017015f},
-std::array<float,2>{0.178326443f, 0.575765193f},
-std::array<float,2>{0.761452019f, 0.242807686f},
-std::array<float,2>{0.400761545f, 0.117105447f},
-std::array<float,2>{0.658157468f, 0.638840914f},
-std::array<float,2>{0.0903692767f, 0.776510537f},
-std::array<float,2>{0.88389957f, 0.252203017f},
-std::array<float,2>{0.2301016f, 0.435263067f},
-std::array<float,2>{0.87139231f, 0.928498805f},
-std::array<float,2>{0.283705086f, 0.557551086f},
-std::array<float,2>{0.506157041f, 0.134825528f},
-std::array<float,2>{0.0185649376f, 0.23651953f},
-std::array<float,2>{0.950802088f, 0.567527473f},
-std::array<float,2>{0.484702259f, 0.975328088f},
-std::array<float,2>{0.71293211f, 0.494766355f},
-std::array<float,2>{0.354068637f, 0.364745945f},
-std::array<float,2>{0.585608244f, 0.853245676f},
-std::array<float,2>{0.12869145f, 0.700618804f},
-std::array<float,2>{0.793606997f, 0.0311992802f},
-std::array<float,2>{0.26042524f, 0.169086248f},
-std::array<float,2>{0.531905293f, 0.516985655f},
-std::array<float,2>{0.205933228f, 0.888291061f},
-std::array<float,2>{0.823837459f, 0.400531828f},
-std::array<float,2>{0.10301815f, 0.295805782f},
-std::array<float,2>{0.923622608f, 0.785923362f},
-std::array<float,2>{0.414480209f, 0.686582029f},
-std::array<float,2>{0.629557669f, 0.0673371479f},
-std::array<float,2>{0.183174208f, 0.0374686271f},
-std::array<float,2>{0.757324934f, 0.748167038f},
-std::array<float,2>{0.313640952f, 0.820495188f},
-std::array<float,2>{0.604323447f, 0.341595203f},
-std::array<float,2>{0.465479761f, 0.450065196f},
-std::array<float,2>{0.745965362f, 0.963981271f},
-std::array<float,2>{0.0576856174f, 0.614098608f},
-std::array<float,2>{0.993523896f, 0.210726336f},
-std::array<float,2>{0.342158914f, 0.00718032848f},
-std::array<float,2>{0.614475071f, 0.712699831f},
-std::array<float,2>{0.158704519f, 0.874809921f},
-std::array<float,2>{0.775250435f, 0.355746716f},
-std::array<float,2>{0.0426301025f, 0.471669406f},
-std::array<float,2>{0.972823858f, 0.999201417f},
-std::array<float,2>{0.438536912f, 0.582347095f},
-std::array<float,2>{0.726831019f, 0.232770011f},
-std::array<float,2>{0.189207435f, 0.140870705f},
-std::array<float,2>{0.831513524f, 0.544487536f},
-std::array<float,2>{0.278838634f, 0.913685322f},
-std::array<float,2>{0.562057853f, 0.410219908f},
-std::array<float,2>{0.436840266f, 0.266133517f},
-std::array<float,2>{0.647317231f, 0.762296081f},
-std::array<float,2>{0.118976645f, 0.653323889f},
-std::array<float,2>{0.90808022f, 0.100093573f},
-std::array<float,2>{0.477178574f, 0.187821433f},
-std::array<float,2>{0.69908917f, 0.59836179f},
-std::array<float,2>{0.0146759329f, 0.95167464f},
-std::array<float,2>{0.964346766f, 0.455379575f},
-std::array<float,2>{0.145337284f, 0.313359618f},
-std::array<float,2>{0.809624851f, 0.836889863f},
-std::array<float,2>{0.363678008f, 0.726899624f},
-std::array<float,2>{0.574196458f, 0.0606139414f},
-std::array<float,2>{0.0736140907f, 0.0882951394f},
-std::array<float,2>{0.893303633f, 0.668337107f},
-std::array<float,2>{0.389593065f, 0.807414949f},
-std::array<float,2>{0.687087178f, 0.309405267f},
-std::array<float,2>{0.301457018f, 0.382804394f},
-std::array<float,2>{0.526035428f, 0.906174362f},
-std::array<float,2>{0.248152316f, 0.513137937f},
-std::array<float,2>{0.85583514f, 0.17643927f},
-std::array<float,2>{0.462396502f, 0.106563695f},
-std::array<float,2>{0.746371269f, 0.640872419f},
-std::array<float,2>{0.0588943139f, 0.750976562f},
-std::array<float,2>{0.996825635f, 0.276861489f},
-std::array<float,2>{0.187312722f, 0.421491265f},
-std::array<float,2>{0.75335896f, 0.915825069f},
-std::array<float,2>{0.317091286f, 0.533120632f},
-std::array<float,2>{0.60851872f, 0.153333873f},
-std::array<float,2>{0.105555542f, 0.218927786f},
-std::array<float,2>{0.925809383f, 0.587107658f},
-std::array<float,2>{0.418256432f, 0.985198259f},
-std::array<float,2>{0.627266347f, 0.480453938f},
-std::array<float,2>{0.262390524f, 0.347864121f},
-std::array<float,2>{0.538731933f, 0.861718297f},
-std::array<float,2>{0.208433107f, 0.70585537f},
-std::array<float,2>{0.827778935f, 0.00815717503f},
-std::array<float,2>{0.357558668f, 0.179759622f},
-std::array<float,2>{0.581743002f, 0.502654791f},
-std::array<float,2>{0.130282f, 0.896935225f},
-std::array<float,2>{0.790792465f, 0.384722143f},
-std::array<float,2>{0.0198757667f, 0.303644031f},
-std::array<float,2>{0.948450863f, 0.798678398f},
-std::array<float,2>{0.49110654f, 0.663148999f},
-std::array<float,2>{0.717089891f, 0.0799104944f},
-std::array<float,2>{0.230621859f, 0.0535970032f},
-std::array<float,2>{0.870884597f, 0.723515213f},
-std::array<float,2>{0.286328912f, 0.832121909f},
-std::array<float,2>{0.503713131f, 0.327893972f},
-std::array<float,2>{0.405825496f, 0.46836701f},
-std::array<float,2>{0.660434842f, 0.93801409f},
-std::array<float,2>{0.0887446702f, 0.607332766f},
-std::array<float,2>{0.886796534f, 0.195393145f},
-std::array<float,2>{0.299534142f, 0.0202545822f},
-std::array<float,2>{0.527938604f, 0.691639364f},
-std::array<float,2>{0.242475346f, 0.845832646f},
-std::array<float,2>{0.853264749f, 0.367308766f},
-std::array<float,2>{0.0772742331f, 0.492009342f},
-std::array<float,2>{0.895437241f, 0.978307545f},
-std::array<float,2>{0.382883936f, 0.572815657f},
-std::array<float,2>{0.682915747f, 0.246936888f},
-std::array<float,2>{0.141203448f, 0.129287228f},
-std::array<float,2>{0.805616796f, 0.55239135f},
-std::array<float,2>{0.361008674f, 0.930244565f},
-std::array<float,2>{0.575086713f, 0.427798688f},
-std::array<float,2>{0.480638564f, 0.259161979f},
-std::array<float,2>{0.699917495f, 0.772238135f},
-std::array<float,2>{0.00829387549f, 0.626035094f},
-std::array<float,2>{0.966018438f, 0.124933772f},
-std::array<float,2>{0.433196753f, 0.21549277f},
-std::array<float,2>{0.64088273f, 0.620657563f},
-std::array<float,2>{0.123777628f, 0.958785653f},
-std::array<float,2>{0.913914025f, 0.43765077f},
-std::array<float,2>{0.193303153f, 0.334533542f},
-std::array<float,2>{0.834637344f, 0.817855656f},
-std::array<float,2>{0.273509383f, 0.73763299f},
-std::array<float,2>{0.555826187f, 0.0412244424f},
-std::array<float,2>{0.0442472883f, 0.0725661293f},
-std::array<float,2>{0.971881568f, 0.673942983f},
-std::array<float,2>{0.442149103f, 0.796719134f},
-std::array<float,2>{0.732905686f, 0.281381547f},
-std::array<float,2>{0.336687088f, 0.39440468f},
-std::array<float,2>{0.612532318f, 0.882373989f},
-std::array<float,2>{0.160508856f, 0.529708266f},
-std::array<float,2>{0.779059529f, 0.163734898f},
-std::array<float,2>{0.375044823f, 0.0350697264f},
-std::array<float,2>{0.675165176f, 0.745023608f},
-std::array<float,2>{0.0698775277f, 0.826610923f},
-std::array<float,2>{0.905450165f, 0.337208897f},
-std::array<float,2>{0.235380918f, 0.448185652f},
-std::array<float,2>{0.849422336f, 0.966016769f},
-std::array<float,2>{0.306766182f, 0.612109661f},
-std::array<float,2>{0.518017352f, 0.203782514f},
-std::array<float,2>{0.00677929027f, 0.16561009f},
-std::array<float,2>{0.956600964f, 0.520855129f},
-std::array<float,2>{0.474202573f, 0.884705544f},
-std::array<float,2>{0.689769983f, 0.404479206f},
-std::array<float,2>{0.36870721f, 0.291371435f},
-std::array<float,2>{0.567789912f, 0.782958031f},
-std::array<float,2>{0.15200901f, 0.682813704f},
-std::array<float,2>{0.799201667f, 0.0647483692f},
-std::array<float,2>{0.268572211f, 0.240981892f},
-std::array<float,2>{0.54729569f, 0.565593481f},
-std::array<float,2>{0.20207037f, 0.972611189f},
-std::array<float,2>{0.83757323f, 0.497011006f},
-std::array<float,2>{0.112697273f, 0.360435575f},
-std::array<float,2>{0.915585339f, 0.85786134f},
-std::array<float,2>{0.423962593f, 0.695470989f},
-std::array<float,2>{0.656207204f, 0.0272165723f},
-std::array<float,2>{0.168328926f, 0.109444775f},
-std::array<float,2>{0.766538322f, 0.636328638f},
-std::array<float,2>{0.330874801f, 0.778389275f},
-std::array<float,2>{0.621002913f, 0.256927013f},
-std::array<float,2>{0.447881341f, 0.431923896f},
-std::array<float,2>{0.72137624f, 0.921895862f},
-std::array<float,2>{0.0325666331f, 0.560110569f},
-std::array<float,2>{0.976739407f, 0.138797015f},
-std::array<float,2>{0.32360363f, 0.0907343552f},
-std::array<float,2>{0.600806236f, 0.665152669f},
-std::array<float,2>{0.172413498f, 0.80978179f},
-std::array<float,2>{0.762476563f, 0.30691871f},
-std::array<float,2>{0.0538856834f, 0.375374198f},
-std::array<float,2>{0.990556538f, 0.899869323f},
-std::array<float,2>{0.454396486f, 0.509905815f},
-std::array<float,2>{0.74126327f, 0.17543374f},
-std::array<float,2>{0.215302557f, 0.193830922f},
-std::array<float,2>{0.813065827f, 0.594795823f},
-std::array<float,2>{0.250567138f, 0.948552907f},
-std::array<float,2>{0.54683888f, 0.459422767f},
-std::array<float,2>{0.411029428f, 0.317892611f},
-std::array<float,2>{0.637003362f, 0.84281677f},
-std::array<float,2>{0.101548821f, 0.73185581f},
-std::array<float,2>{0.935215592f, 0.0550946742f},
-std::array<float,2>{0.496246934f, 0.147301897f},
-std::array<float,2>{0.703455448f, 0.539914489f},
-std::array<float,2>{0.0277188048f, 0.909388363f},
-std::array<float,2>{0.941451609f, 0.407515496f},
-std::array<float,2>{0.134068906f, 0.270383269f},
-std::array<float,2>{0.785589933f, 0.760128438f},
-std::array<float,2>{0.344959676f, 0.651397288f},
-std::array<float,2>{0.588886321f, 0.0950700715f},
-std::array<float,2>{0.0804714784f, 0.000742778939f},
-std::array<float,2>{0.880588233f, 0.716394246f},
-std::array<float,2>{0.391692758f, 0.868776381f},
-std::array<float,2>{0.668318987f, 0.355430633f},
-std::array<float,2>{0.290821135f, 0.473495632f},
-std::array<float,2>{0.512080848f, 0.992829978f},
-std::array<float,2>{0.222903162f, 0.579184771f},
-std::array<float,2>{0.866237164f, 0.226845354f},
-std::array<float,2>{0.470917761f, 0.0152691789f},
-std::array<float,2>{0.693008602f, 0.708729565f},
-std::array<float,2>{0.00354452035f, 0.86670208f},
-std::array<float,2>{0.958362103f, 0.344845057f},
-std::array<float,2>{0.15420872f, 0.481269717f},
-std::array<float,2>{0.80129993f, 0.988652289f},
-std::array<float,2>{0.373293549f, 0.590117991f},
-std::array<float,2>{0.563436747f, 0.222866803f},
-std::array<float,2>{0.0647099242f, 0.150006428f},
-std::array<float,2>{0.899959862f, 0.536887467f},
-std::array<float,2>{0.38081637f, 0.918574035f},
-std::array<float,2>{0.677276671f, 0.416189253f},
-std::array<float,2>{0.309112489f, 0.278102607f},
-std::array<float,2>{0.519782484f, 0.757121623f},
-std::array<float,2>{0.239638373f, 0.647682369f},
-std::array<float,2>{0.846767962f, 0.10337875f},
-std::array<float,2>{0.334114343f, 0.201728836f},
-std::array<float,2>{0.621340513f, 0.601791203f},
-std::array<float,2>{0.16509223f, 0.941915095f},
-std::array<float,2>{0.772886992f, 0.46402669f},
-std::array<float,2>{0.0361128449f, 0.321235895f},
-std::array<float,2>{0.983511031f, 0.831969917f},
-std::array<float,2>{0.451554686f, 0.719565451f},
-std::array<float,2>{0.723608613f, 0.0484582856f},
-std::array<float,2>{0.198380142f, 0.0838915929f},
-std::array<float,2>{0.841079652f, 0.659630358f},
-std::array<float,2>{0.272714078f, 0.80182147f},
-std::array<float,2>{0.553219497f, 0.298114002f},
-std::array<float,2>{0.427585185f, 0.387110978f},
-std::array<float,2>{0.651100755f, 0.894002676f},
-std::array<float,2>{0.114036404f, 0.505681694f},
-std::array<float,2>{0.920790315f, 0.187009871f},
-std::array<float,2>{0.256090939f, 0.118628122f},
-std::array<float,2>{0.542924285f, 0.631807923f},
-std::array<float,2>{0.212552041f, 0.768189073f},
-std::array<float,2>{0.816538334f, 0.26403147f},
-std::array<float,2>{0.0952469632f, 0.424495667f},
-std::array<float,2>{0.93091315f, 0.934602499f},
-std::array<float,2>{0.40756616f, 0.547940731f},
-std::array<float,2>{0.63482213f, 0.12840794f},
-std::array<float,2>{0.176368386f, 0.244978115f},
-std::array<float,2>{0.758535087f, 0.577615023f},
-std::array<float,2>{0.324864626f, 0.980853319f},
-std::array<float,2>{0.594735563f, 0.486990452f},
-std::array<float,2>{0.460594058f, 0.374459475f},
-std::array<float,2>{0.73661834f, 0.85034591f},
-std::array<float,2>{0.0488865003f, 0.689082623f},
-std::array<float,2>{0.9882043f, 0.0177944284f},
-std::array<float,2>{0.397627681f, 0.157560751f},
-std::array<float,2>{0.664370835f, 0.526701212f},
-std::array<float,2>{0.0854820758f, 0.875440061f},
-std::array<float,2>{0.875578105f, 0.395687521f},
-std::array<float,2>{0.221300259f, 0.287818313f},
-std::array<float,2>{0.862187684f, 0.790758014f},
-std::array<float,2>{0.29412353f, 0.678494513f},
-std::array<float,2>{0.511608064f, 0.0774812475f},
-std::array<float,2>{0.0246988479f, 0.0449250489f},
-std::array<float,2>{0.939053595f, 0.738759696f},
-std::array<float,2>{0.49354887f, 0.813623548f},
-std::array<float,2>{0.708134949f, 0.330658793f},
-std::array<float,2>{0.348035067f, 0.442789644f},
-std::array<float,2>{0.589956164f, 0.956062853f},
-std::array<float,2>{0.138476655f, 0.62365073f},
-std::array<float,2>{0.784463525f, 0.214017436f},
-std::array<float,2>{0.41723296f, 0.0683972612f},
-std::array<float,2>{0.632724464f, 0.683815598f},
-std::array<float,2>{0.104156718f, 0.787474096f},
-std::array<float,2>{0.924427569f, 0.294699788f},
-std::array<float,2>{0.204068407f, 0.399958849f},
-std::array<float,2>{0.821607888f, 0.888745785f},
-std::array<float,2>{0.259149432f, 0.518547833f},
-std::array<float,2>{0.534188151f, 0.170358494f},
-std::array<float,2>{0.0554671474f, 0.207506865f},
-std::array<float,2>{0.995535016f, 0.615609527f},
-std::array<float,2>{0.468334645f, 0.962783873f},
-std::array<float,2>{0.742579043f, 0.452157378f},
-std::array<float,2>{0.316385686f, 0.342508554f},
-std::array<float,2>{0.603156686f, 0.823405325f},
-std::array<float,2>{0.181016713f, 0.747944772f},
-std::array<float,2>{0.754942298f, 0.0355731957f},
-std::array<float,2>{0.282258987f, 0.13424401f},
-std::array<float,2>{0.505632043f, 0.556393445f},
-std::array<float,2>{0.227732927f, 0.925993443f},
-std::array<float,2>{0.8742854f, 0.436504006f},
-std::array<float,2>{0.093545191f, 0.25033164f},
-std::array<float,2>{0.886131108f, 0.774227977f},
-std::array<float,2>{0.400179029f, 0.637426853f},
-std::array<float,2>{0.658684909f, 0.115088962f},
-std::array<float,2>{0.126740426f, 0.0283709783f},
-std::array<float,2>{0.796347082f, 0.701480925f},
-std::array<float,2>{0.352776468f, 0.854249775f},
-std::array<float,2>{0.583871663f, 0.36663273f},
-std::array<float,2>{0.487354577f, 0.493097454f},
-std::array<float,2>{0.712636709f, 0.973577857f},
-std::array<float,2>{0.0166963581f, 0.5701105f},
-std::array<float,2>{0.952496171f, 0.235518321f},
-std::array<float,2>{0.365656048f, 0.058834631f},
-std::array<float,2>{0.571071446f, 0.72873801f},
-std::array<float,2>{0.147009596f, 0.838092268f},
-std::array<float,2>{0.811922908f, 0.315469801f},
-std::array<float,2>{0.013393987f, 0.45381397f},
-std::array<float,2>{0.962813795f, 0.950456858f},
-std::array<float,2>{0.478758574f, 0.600961328f},
-std::array<float,2>{0.696710706f, 0.189533964f},
-std::array<float,2>{0.246953562f, 0.179167211f},
-std::array<float,2>{0.858569145f, 0.514003813f},
-std::array<float,2>{0.303040892f, 0.902867138f},
-std::array<float,2>{0.52380687f, 0.379461646f},
-std::array<float,2>{0.386999339f, 0.31118536f},
-std::array<float,2>{0.685346365f, 0.805702806f},
-std::array<float,2>{0.0715614036f, 0.67124933f},
-std::array<float,2>{0.890732408f, 0.086732395f},
-std::array<float,2>{0.441170812f, 0.230984956f},
-std::array<float,2>{0.729765594f, 0.584583521f},
-std::array<float,2>{0.0407952145f, 0.996700406f},
-std::array<float,2>{0.976408482f, 0.47027117f},
-std::array<float,2>{0.156384945f, 0.359093368f},
-std::array<float,2>{0.776130378f, 0.873022139f},
-std::array<float,2>{0.340477854f, 0.714036107f},
-std::array<float,2>{0.61635232f, 0.00527804857f},
-std::array<float,2>{0.120471619f, 0.0982898399f},
-std::array<float,2>{0.909934163f, 0.655964971f},
-std::array<float,2>{0.434914947f, 0.763940036f},
-std::array<float,2>{0.646131337f, 0.268871605f},
-std::array<float,2>{0.280321807f, 0.413476855f},
-std::array<float,2>{0.558681667f, 0.911876678f},
-std::array<float,2>{0.190610692f, 0.54601419f},
-std::array<float,2>{0.828900218f, 0.143128052f},
-std::array<float,2>{0.455059737f, 0.0923075676f},
-std::array<float,2>{0.741865158f, 0.667905211f},
-std::array<float,2>{0.0543821417f, 0.811036766f},
-std::array<float,2>{0.990794659f, 0.306317329f},
-std::array<float,2>{0.172308043f, 0.377961546f},
-std::array<float,2>{0.76212281f, 0.900823653f},
-std::array<float,2>{0.323750108f, 0.509499431f},
-std::array<float,2>{0.60119766f, 0.17315805f},
-std::array<float,2>{0.100796379f, 0.19253844f},
-std::array<float,2>{0.934886754f, 0.595898449f},
-std::array<float,2>{0.410570115f, 0.945504427f},
-std::array<float,2>{0.637672961f, 0.457321495f},
-std::array<float,2>{0.250301659f, 0.318677515f},
-std::array<float,2>{0.546271563f, 0.84025085f},
-std::array<float,2>{0.215551391f, 0.733096957f},
-std::array<float,2>{0.812784076f, 0.0579806119f},
-std::array<float,2>{0.345564812f, 0.144682601f},
-std::array<float,2>{0.589591742f, 0.542687476f},
-std::array<float,2>{0.134489641f, 0.908061266f},
-std::array<float,2>{0.78588146f, 0.409309447f},
-std::array<float,2>{0.0279037133f, 0.272890747f},
-std::array<float,2>{0.942353666f, 0.758660734f},
-std::array<float,2>{0.497046113f, 0.649999321f},
-std::array<float,2>{0.703835607f, 0.097447291f},
-std::array<float,2>{0.223172754f, 0.00258648535f},
-std::array<float,2>{0.866963625f, 0.717836976f},
-std::array<float,2>{0.290254176f, 0.869773328f},
-std::array<float,2>{0.51263833f, 0.353486896f},
-std::array<float,2>{0.392167121f, 0.47571516f},
-std::array<float,2>{0.668489516f, 0.994543254f},
-std::array<float,2>{0.08090242f, 0.580151677f},
-std::array<float,2>{0.880218446f, 0.230139434f},
-std::array<float,2>{0.307588041f, 0.0325235836f},
-std::array<float,2>{0.518521249f, 0.743550658f},
-std::array<float,2>{0.23616235f, 0.824433029f},
-std::array<float,2>{0.849043787f, 0.339168876f},
-std::array<float,2>{0.0695660338f, 0.445395142f},
-std::array<float,2>{0.906054914f, 0.967394412f},
-std::array<float,2>{0.375725895f, 0.610263586f},
-std::array<float,2>{0.675772727f, 0.206661806f},
-std::array<float,2>{0.151642874f, 0.166766033f},
-std::array<float,2>{0.799707115f, 0.522093952f},
-std::array<float,2>{0.368601799f, 0.885400832f},
-std::array<float,2>{0.568024755f, 0.403464228f},
-std::array<float,2>{0.473696351f, 0.289700508f},
-std::array<float,2>{0.690288246f, 0.784789026f},
-std::array<float,2>{0.0063286107f, 0.680552125f},
-std::array<float,2>{0.956255794f, 0.0631545261f},
-std::array<float,2>{0.424535394f, 0.239965096f},
-std::array<float,2>{0.655393958f, 0.564339578f},
-std::array<float,2>{0.11311806f, 0.969614029f},
-std::array<float,2>{0.91539073f, 0.499762207f},
-std::array<float,2>{0.201367065f, 0.361664832f},
-std::array<float,2>{0.837318122f, 0.857103407f},
-std::array<float,2>{0.269281149f, 0.698785484f},
-std::array<float,2>{0.547710598f, 0.025379559f},
-std::array<float,2>{0.0328234099f, 0.112002969f},
-std::array<float,2>{0.977310598f, 0.634169042f},
-std::array<float,2>{0.447403938f, 0.780134737f},
-std::array<float,2>{0.720818102f, 0.254558831f},
-std::array<float,2>{0.33050698f, 0.431023568f},
-std::array<float,2>{0.620519221f, 0.924767375f},
-std::array<float,2>{0.168564498f, 0.561804354f},
-std::array<float,2>{0.765976548f, 0.138418227f},
-std::array<float,2>{0.383656204f, 0.0230723266f},
-std::array<float,2>{0.683203042f, 0.693911314f},
-std::array<float,2>{0.0780949816f, 0.844677031f},
-std::array<float,2>{0.89487946f, 0.370874941f},
-std::array<float,2>{0.242760271f, 0.48870483f},
-std::array<float,2>{0.852693081f, 0.978629351f},
-std::array<float,2>{0.299015701f, 0.572026432f},
-std::array<float,2>{0.527426004f, 0.249848828f},
-std::array<float,2>{0.0086608585f, 0.131272659f},
-std::array<float,2>{0.966768026f, 0.554276586f},
-std::array<float,2>{0.481363714f, 0.932643592f},
-std::array<float,2>{0.699657917f, 0.427294374f},
-std::array<float,2>{0.360590756f, 0.260192841f},
-std::array<float,2>{0.574636817f, 0.77144593f},
-std::array<float,2>{0.141085222f, 0.62799722f},
-std::array<float,2>{0.804870605f, 0.123005211f},
-std::array<float,2>{0.274370074f, 0.218617976f},
-std::array<float,2>{0.556393147f, 0.61744374f},
-std::array<float,2>{0.19241488f, 0.960108042f},
-std::array<float,2>{0.834326088f, 0.441387743f},
-std::array<float,2>{0.123173304f, 0.332870692f},
-std::array<float,2>{0.913205862f, 0.819792271f},
-std::array<float,2>{0.432881951f, 0.735064805f},
-std::array<float,2>{0.641286492f, 0.0409646817f},
-std::array<float,2>{0.160744339f, 0.0703314394f},
-std::array<float,2>{0.778530896f, 0.673626602f},
-std::array<float,2>{0.335996777f, 0.794347525f},
-std::array<float,2>{0.613277674f, 0.284599036f},
-std::array<float,2>{0.441549808f, 0.390821755f},
-std::array<float,2>{0.73305887f, 0.879746675f},
-std::array<float,2>{0.0444795676f, 0.528483868f},
-std::array<float,2>{0.972532332f, 0.161637455f},
-std::array<float,2>{0.316655189f, 0.107861809f},
-std::array<float,2>{0.609295428f, 0.64385885f},
-std::array<float,2>{0.186794043f, 0.753193378f},
-std::array<float,2>{0.753522396f, 0.274022907f},
-std::array<float,2>{0.0592948571f, 0.419274181f},
-std::array<float,2>{0.996265411f, 0.916231573f},
-std::array<float,2>{0.462468743f, 0.535100877f},
-std::array<float,2>{0.746703804f, 0.155891761f},
-std::array<float,2>{0.208728179f, 0.220789775f},
-std::array<float,2>{0.827584803f, 0.588630617f},
-std::array<float,2>{0.261987329f, 0.987746835f},
-std::array<float,2>{0.538357139f, 0.476617426f},
-std::array<float,2>{0.418893933f, 0.351034731f},
-std::array<float,2>{0.627541482f, 0.861262143f},
-std::array<float,2>{0.106374346f, 0.703376055f},
-std::array<float,2>{0.926537156f, 0.0105914138f},
-std::array<float,2>{0.490251899f, 0.182903126f},
-std::array<float,2>{0.717750072f, 0.500504076f},
-std::array<float,2>{0.0201041289f, 0.895329535f},
-std::array<float,2>{0.948980689f, 0.385688484f},
-std::array<float,2>{0.130502611f, 0.302652985f},
-std::array<float,2>{0.790237486f, 0.800645173f},
-std::array<float,2>{0.358242899f, 0.660669029f},
-std::array<float,2>{0.58120805f, 0.0815929472f},
-std::array<float,2>{0.0882701129f, 0.0514572971f},
-std::array<float,2>{0.887597382f, 0.725206077f},
-std::array<float,2>{0.405581504f, 0.835366607f},
-std::array<float,2>{0.660929918f, 0.324831575f},
-std::array<float,2>{0.286904961f, 0.465393245f},
-std::array<float,2>{0.503406882f, 0.939617693f},
-std::array<float,2>{0.231206134f, 0.607536912f},
-std::array<float,2>{0.870463252f, 0.198387727f},
-std::array<float,2>{0.479078233f, 0.0615074821f},
-std::array<float,2>{0.696951091f, 0.727498412f},
-std::array<float,2>{0.0130351009f, 0.836160123f},
-std::array<float,2>{0.961914241f, 0.312981099f},
-std::array<float,2>{0.146806598f, 0.45568943f},
-std::array<float,2>{0.812206209f, 0.9515481f},
-std::array<float,2>{0.365907431f, 0.597841263f},
-std::array<float,2>{0.570323229f, 0.188445553f},
-std::array<float,2>{0.0718224421f, 0.176082671f},
-std::array<float,2>{0.891448855f, 0.513220608f},
-std::array<float,2>{0.387479544f, 0.905664802f},
-std::array<float,2>{0.684712946f, 0.381884336f},
-std::array<float,2>{0.303427964f, 0.308611929f},
-std::array<float,2>{0.524284899f, 0.807002068f},
-std::array<float,2>{0.246358261f, 0.668919861f},
-std::array<float,2>{0.859139621f, 0.0884783491f},
-std::array<float,2>{0.340297222f, 0.233247831f},
-std::array<float,2>{0.616820514f, 0.582578182f},
-std::array<float,2>{0.157052785f, 0.999982536f},
-std::array<float,2>{0.775763512f, 0.470912069f},
-std::array<float,2>{0.0400654934f, 0.356016099f},
-std::array<float,2>{0.975882471f, 0.874359667f},
-std::array<float,2>{0.44065097f, 0.712127566f},
-std::array<float,2>{0.730105698f, 0.00742916437f},
-std::array<float,2>{0.191368058f, 0.100565396f},
-std::array<float,2>{0.828178942f, 0.653812468f},
-std::array<float,2>{0.281159222f, 0.761766613f},
-std::array<float,2>{0.55955255f, 0.266103804f},
-std::array<float,2>{0.435240418f, 0.410684556f},
-std::array<float,2>{0.645826638f, 0.913118243f},
-std::array<float,2>{0.120772101f, 0.544382095f},
-std::array<float,2>{0.909399927f, 0.141261578f},
-std::array<float,2>{0.259759307f, 0.0667256489f},
-std::array<float,2>{0.534674227f, 0.687413931f},
-std::array<float,2>{0.203255892f, 0.785167992f},
-std::array<float,2>{0.821837604f, 0.295030147f},
-std::array<float,2>{0.103680424f, 0.400903314f},
-std::array<float,2>{0.923851788f, 0.887792706f},
-std::array<float,2>{0.417946726f, 0.517103136f},
-std::array<float,2>{0.631946683f, 0.169800386f},
-std::array<float,2>{0.181598961f, 0.209966972f},
-std::array<float,2>{0.755856574f, 0.613319099f},
-std::array<float,2>{0.315573156f, 0.964647591f},
-std::array<float,2>{0.602704167f, 0.449370891f},
-std::array<float,2>{0.467919707f, 0.340908617f},
-std::array<float,2>{0.74289304f, 0.821087897f},
-std::array<float,2>{0.0551545359f, 0.748666525f},
-std::array<float,2>{0.995983541f, 0.0379280262f},
-std::array<float,2>{0.399441093f, 0.135337099f},
-std::array<float,2>{0.65891552f, 0.557123899f},
-std::array<float,2>{0.0931241289f, 0.927781165f},
-std::array<float,2>{0.886655927f, 0.434607327f},
-std::array<float,2>{0.228263244f, 0.252755374f},
-std::array<float,2>{0.874658942f, 0.777297795f},
-std::array<float,2>{0.282936722f, 0.639537334f},
-std::array<float,2>{0.505069315f, 0.116344124f},
-std::array<float,2>{0.0173832886f, 0.0305408631f},
-std::array<float,2>{0.952878058f, 0.70084399f},
-std::array<float,2>{0.487981379f, 0.852643907f},
-std::array<float,2>{0.712150574f, 0.365056485f},
-std::array<float,2>{0.35344553f, 0.494448066f},
-std::array<float,2>{0.583131313f, 0.97499913f},
-std::array<float,2>{0.12601544f, 0.568324029f},
-std::array<float,2>{0.796816468f, 0.237062797f},
-std::array<float,2>{0.407723784f, 0.121003695f},
-std::array<float,2>{0.635448575f, 0.629292369f},
-std::array<float,2>{0.0951040164f, 0.767011523f},
-std::array<float,2>{0.931436896f, 0.263610095f},
-std::array<float,2>{0.212142199f, 0.422618747f},
-std::array<float,2>{0.817335546f, 0.93636179f},
-std::array<float,2>{0.256582856f, 0.549907267f},
-std::array<float,2>{0.542096972f, 0.126139f},
-std::array<float,2>{0.0494388677f, 0.242425516f},
-std::array<float,2>{0.987381279f, 0.575578034f},
-std::array<float,2>{0.460408419f, 0.983428657f},
-std::array<float,2>{0.73682034f, 0.485431284f},
-std::array<float,2>{0.324561477f, 0.372077882f},
-std::array<float,2>{0.595377684f, 0.848711729f},
-std::array<float,2>{0.176087245f, 0.689625025f},
-std::array<float,2>{0.758181095f, 0.0156904906f},
-std::array<float,2>{0.294794023f, 0.158813268f},
-std::array<float,2>{0.511213243f, 0.523568511f},
-std::array<float,2>{0.220836788f, 0.878045619f},
-std::array<float,2>{0.86165899f, 0.398408264f},
-std::array<float,2>{0.0853439271f, 0.285884857f},
-std::array<float,2>{0.875092745f, 0.792487741f},
-std::array<float,2>{0.398297876f, 0.676041663f},
-std::array<float,2>{0.664573908f, 0.0747314245f},
-std::array<float,2>{0.138055474f, 0.0431022309f},
-std::array<float,2>{0.784728467f, 0.740381479f},
-std::array<float,2>{0.348370403f, 0.814653397f},
-std::array<float,2>{0.590457559f, 0.328779578f},
-std::array<float,2>{0.494099289f, 0.444619f},
-std::array<float,2>{0.708940685f, 0.953744411f},
-std::array<float,2>{0.024992032f, 0.621168673f},
-std::array<float,2>{0.938678861f, 0.212533921f},
-std::array<float,2>{0.373604923f, 0.0122596109f},
-std::array<float,2>{0.562763214f, 0.709703267f},
-std::array<float,2>{0.153373227f, 0.863895774f},
-std::array<float,2>{0.800876975f, 0.345782727f},
-std::array<float,2>{0.00295199477f, 0.483134508f},
-std::array<float,2>{0.95893085f, 0.992002189f},
-std::array<float,2>{0.471322328f, 0.591961026f},
-std::array<float,2>{0.692617357f, 0.225304693f},
-std::array<float,2>{0.239817709f, 0.151931778f},
-std::array<float,2>{0.847274303f, 0.538190305f},
-std::array<float,2>{0.308712095f, 0.921030223f},
-std::array<float,2>{0.520314455f, 0.41491425f},
-std::array<float,2>{0.380164206f, 0.279345632f},
-std::array<float,2>{0.677168429f, 0.755282164f},
-std::array<float,2>{0.0649695843f, 0.646188378f},
-std::array<float,2>{0.899762094f, 0.103810884f},
-std::array<float,2>{0.451735049f, 0.200846359f},
-std::array<float,2>{0.72283113f, 0.605209947f},
-std::array<float,2>{0.0354972072f, 0.944735587f},
-std::array<float,2>{0.984013021f, 0.462712348f},
-std::array<float,2>{0.165938616f, 0.32411024f},
-std::array<float,2>{0.773188412f, 0.828392327f},
-std::array<float,2>{0.334613204f, 0.722463727f},
-std::array<float,2>{0.621619105f, 0.0489862226f},
-std::array<float,2>{0.113686025f, 0.0842381939f},
-std::array<float,2>{0.920372307f, 0.656506658f},
-std::array<float,2>{0.427079707f, 0.803996325f},
-std::array<float,2>{0.65051198f, 0.299413115f},
-std::array<float,2>{0.273381799f, 0.389512062f},
-std::array<float,2>{0.553672194f, 0.891058445f},
-std::array<float,2>{0.198996931f, 0.506144822f},
-std::array<float,2>{0.841333926f, 0.183684304f},
-std::array<float,2>{0.498381913f, 0.0954104662f},
-std::array<float,2>{0.705554962f, 0.651959658f},
-std::array<float,2>{0.0309939589f, 0.760560095f},
-std::array<float,2>{0.943413675f, 0.269545108f},
-std::array<float,2>{0.136665046f, 0.408132195f},
-std::array<float,2>{0.788034976f, 0.910099983f},
-std::array<float,2>{0.347594559f, 0.539138973f},
-std::array<float,2>{0.587614715f, 0.146868706f},
-std::array<float,2>{0.0798878297f, 0.22717838f},
-std::array<float,2>{0.882473707f, 0.580075026f},
-std::array<float,2>{0.393728286f, 0.992316246f},
-std::array<float,2>{0.670615673f, 0.473131955f},
-std::array<float,2>{0.292672604f, 0.354625404f},
-std::array<float,2>{0.514457405f, 0.868552208f},
-std::array<float,2>{0.225107789f, 0.716255486f},
-std::array<float,2>{0.863900363f, 0.000482078787f},
-std::array<float,2>{0.320405871f, 0.17524007f},
-std::array<float,2>{0.598400414f, 0.510392427f},
-std::array<float,2>{0.174041852f, 0.899931908f},
-std::array<float,2>{0.763718486f, 0.375904322f},
-std::array<float,2>{0.0520071462f, 0.30747816f},
-std::array<float,2>{0.988591611f, 0.810204446f},
-std::array<float,2>{0.455188751f, 0.666003883f},
-std::array<float,2>{0.739780664f, 0.089868404f},
-std::array<float,2>{0.217523366f, 0.0554287545f},
-std::array<float,2>{0.815740287f, 0.73218596f},
-std::array<float,2>{0.252149224f, 0.843646288f},
-std::array<float,2>{0.543217242f, 0.317513108f},
-std::array<float,2>{0.412303776f, 0.459596604f},
-std::array<float,2>{0.638950586f, 0.948811591f},
-std::array<float,2>{0.0991004035f, 0.595380664f},
-std::array<float,2>{0.937095702f, 0.194269657f},
-std::array<float,2>{0.267258644f, 0.0263723135f},
-std::array<float,2>{0.550627351f, 0.696150362f},
-std::array<float,2>{0.19957684f, 0.857925355f},
-std::array<float,2>{0.83981657f, 0.360894918f},
-std::array<float,2>{0.111018129f, 0.496522009f},
-std::array<float,2>{0.916807175f, 0.971940339f},
-std::array<float,2>{0.423011452f, 0.56629616f},
-std::array<float,2>{0.653672218f, 0.240360886f},
-std::array<float,2>{0.170657769f, 0.139429063f},
-std::array<float,2>{0.768163681f, 0.55958885f},
-std::array<float,2>{0.328172237f, 0.922525227f},
-std::array<float,2>{0.618691623f, 0.432367682f},
-std::array<float,2>{0.446105897f, 0.257742852f},
-std::array<float,2>{0.720007896f, 0.779257417f},
-std::array<float,2>{0.0350723937f, 0.636209488f},
-std::array<float,2>{0.979500055f, 0.110296801f},
-std::array<float,2>{0.377064437f, 0.203226686f},
-std::array<float,2>{0.673592925f, 0.611681521f},
-std::array<float,2>{0.0676374286f, 0.966668725f},
-std::array<float,2>{0.903784633f, 0.447375298f},
-std::array<float,2>{0.237052783f, 0.337855101f},
-std::array<float,2>{0.850636184f, 0.827062905f},
-std::array<float,2>{0.305199385f, 0.744461298f},
-std::array<float,2>{0.517332017f, 0.0344189368f},
-std::array<float,2>{0.00446051033f, 0.065223664f},
-std::array<float,2>{0.954381764f, 0.683581769f},
-std::array<float,2>{0.47626251f, 0.78224659f},
-std::array<float,2>{0.687938094f, 0.291861355f},
-std::array<float,2>{0.369172871f, 0.405009836f},
-std::array<float,2>{0.568542838f, 0.883873999f},
-std::array<float,2>{0.149700567f, 0.521443307f},
-std::array<float,2>{0.798738301f, 0.165335298f},
-std::array<float,2>{0.430280566f, 0.0415597074f},
-std::array<float,2>{0.643385589f, 0.738085628f},
-std::array<float,2>{0.12229041f, 0.81793946f},
-std::array<float,2>{0.91140461f, 0.334361464f},
-std::array<float,2>{0.193952426f, 0.438241601f},
-std::array<float,2>{0.832439125f, 0.958050072f},
-std::array<float,2>{0.275764585f, 0.620322287f},
-std::array<float,2>{0.556988418f, 0.214848265f},
-std::array<float,2>{0.0457366258f, 0.16350764f},
-std::array<float,2>{0.969107211f, 0.529841661f},
-std::array<float,2>{0.443899989f, 0.881883562f},
-std::array<float,2>{0.730653226f, 0.393658847f},
-std::array<float,2>{0.339686424f, 0.282220215f},
-std::array<float,2>{0.609504938f, 0.796191216f},
-std::array<float,2>{0.163640723f, 0.674801528f},
-std::array<float,2>{0.781005621f, 0.0729785636f},
-std::array<float,2>{0.297774464f, 0.246519014f},
-std::array<float,2>{0.530314267f, 0.572449267f},
-std::array<float,2>{0.244754568f, 0.977755308f},
-std::array<float,2>{0.854245484f, 0.491256267f},
-std::array<float,2>{0.0758083016f, 0.367780775f},
-std::array<float,2>{0.897919476f, 0.846671641f},
-std::array<float,2>{0.384872496f, 0.692348957f},
-std::array<float,2>{0.679869056f, 0.019953195f},
-std::array<float,2>{0.142944857f, 0.124287926f},
-std::array<float,2>{0.807885468f, 0.626915932f},
-std::array<float,2>{0.361850291f, 0.771532595f},
-std::array<float,2>{0.577358127f, 0.259666204f},
-std::array<float,2>{0.482627481f, 0.428252369f},
-std::array<float,2>{0.701796055f, 0.930157244f},
-std::array<float,2>{0.0115560098f, 0.551871777f},
-std::array<float,2>{0.968622088f, 0.129506409f},
-std::array<float,2>{0.35665518f, 0.0792788416f},
-std::array<float,2>{0.57846123f, 0.663754821f},
-std::array<float,2>{0.132624134f, 0.798070669f},
-std::array<float,2>{0.792834461f, 0.302859366f},
-std::array<float,2>{0.0223649982f, 0.384209901f},
-std::array<float,2>{0.945755661f, 0.897133589f},
-std::array<float,2>{0.488931268f, 0.502351165f},
-std::array<float,2>{0.715112329f, 0.18018043f},
-std::array<float,2>{0.233868971f, 0.196283937f},
-std::array<float,2>{0.867717803f, 0.606718004f},
-std::array<float,2>{0.288569689f, 0.937737405f},
-std::array<float,2>{0.501770675f, 0.467828602f},
-std::array<float,2>{0.403706908f, 0.32762897f},
-std::array<float,2>{0.663607121f, 0.832745254f},
-std::array<float,2>{0.0871417969f, 0.722656488f},
-std::array<float,2>{0.889556646f, 0.0528919995f},
-std::array<float,2>{0.464051545f, 0.154239163f},
-std::array<float,2>{0.749767721f, 0.532409072f},
-std::array<float,2>{0.0616425648f, 0.915435672f},
-std::array<float,2>{0.999802113f, 0.420958698f},
-std::array<float,2>{0.18455264f, 0.276632249f},
-std::array<float,2>{0.750682771f, 0.751532376f},
-std::array<float,2>{0.319369495f, 0.641302526f},
-std::array<float,2>{0.605557501f, 0.107111186f},
-std::array<float,2>{0.109186225f, 0.00857962202f},
-std::array<float,2>{0.928569615f, 0.705320895f},
-std::array<float,2>{0.420323849f, 0.861967206f},
-std::array<float,2>{0.625081658f, 0.348601639f},
-std::array<float,2>{0.264783472f, 0.479841292f},
-std::array<float,2>{0.536098659f, 0.984567821f},
-std::array<float,2>{0.209901139f, 0.58767271f},
-std::array<float,2>{0.825483263f, 0.219305009f},
-std::array<float,2>{0.439261198f, 0.00562572898f},
-std::array<float,2>{0.727386594f, 0.714469135f},
-std::array<float,2>{0.0424242169f, 0.872521341f},
-std::array<float,2>{0.97329694f, 0.358513504f},
-std::array<float,2>{0.158473894f, 0.470029265f},
-std::array<float,2>{0.77450633f, 0.996574342f},
-std::array<float,2>{0.342727274f, 0.58435905f},
-std::array<float,2>{0.614990771f, 0.230877608f},
-std::array<float,2>{0.118573375f, 0.142775372f},
-std::array<float,2>{0.907447755f, 0.5464288f},
-std::array<float,2>{0.43732512f, 0.91127485f},
-std::array<float,2>{0.646850049f, 0.413988203f},
-std::array<float,2>{0.278744221f, 0.26941067f},
-std::array<float,2>{0.561892688f, 0.764276683f},
-std::array<float,2>{0.18870458f, 0.655689478f},
-std::array<float,2>{0.831632555f, 0.0979710445f},
-std::array<float,2>{0.364184737f, 0.190351278f},
-std::array<float,2>{0.573526621f, 0.601444244f},
-std::array<float,2>{0.144941837f, 0.951041222f},
-std::array<float,2>{0.81048435f, 0.453559756f},
-std::array<float,2>{0.0156022226f, 0.315952092f},
-std::array<float,2>{0.964475274f, 0.838446081f},
-std::array<float,2>{0.477005482f, 0.729285181f},
-std::array<float,2>{0.698412478f, 0.0595216826f},
-std::array<float,2>{0.248543635f, 0.0859385505f},
-std::array<float,2>{0.856441617f, 0.671581686f},
-std::array<float,2>{0.301236868f, 0.806514978f},
-std::array<float,2>{0.525683582f, 0.310849845f},
-std::array<float,2>{0.389134765f, 0.379028797f},
-std::array<float,2>{0.686886191f, 0.902387798f},
-std::array<float,2>{0.0737870857f, 0.514524341f},
-std::array<float,2>{0.892670691f, 0.179222882f},
-std::array<float,2>{0.283509523f, 0.114457436f},
-std::array<float,2>{0.50677824f, 0.637173772f},
-std::array<float,2>{0.22989361f, 0.773502827f},
-std::array<float,2>{0.871881008f, 0.250779569f},
-std::array<float,2>{0.0899489149f, 0.435873628f},
-std::array<float,2>{0.884471714f, 0.926580131f},
-std::array<float,2>{0.401002824f, 0.55575037f},
-std::array<float,2>{0.657711565f, 0.134434655f},
-std::array<float,2>{0.127942681f, 0.235864654f},
-std::array<float,2>{0.793164134f, 0.56944859f},
-std::array<float,2>{0.353577614f, 0.97313422f},
-std::array<float,2>{0.585284591f, 0.492516428f},
-std::array<float,2>{0.485097915f, 0.367123067f},
-std::array<float,2>{0.713616967f, 0.853945255f},
-std::array<float,2>{0.0192966182f, 0.701978147f},
-std::array<float,2>{0.950362086f, 0.0290190335f},
-std::array<float,2>{0.414687514f, 0.170747116f},
-std::array<float,2>{0.629285753f, 0.517978013f},
-std::array<float,2>{0.103426665f, 0.88951385f},
-std::array<float,2>{0.922927022f, 0.399491161f},
-std::array<float,2>{0.205399677f, 0.294300288f},
-std::array<float,2>{0.82344234f, 0.787696898f},
-std::array<float,2>{0.259848654f, 0.684085071f},
-std::array<float,2>{0.53169924f, 0.0692858323f},
-std::array<float,2>{0.0583747402f, 0.0360852741f},
-std::array<float,2>{0.99398762f, 0.747455776f},
-std::array<float,2>{0.464966625f, 0.82405591f},
-std::array<float,2>{0.745198131f, 0.341824919f},
-std::array<float,2>{0.314230442f, 0.452941269f},
-std::array<float,2>{0.603661418f, 0.961976111f},
-std::array<float,2>{0.183056146f, 0.615922034f},
-std::array<float,2>{0.757037103f, 0.207539409f},
-std::array<float,2>{0.39587447f, 0.0780261606f},
-std::array<float,2>{0.666642308f, 0.678024113f},
-std::array<float,2>{0.0820437223f, 0.790323794f},
-std::array<float,2>{0.877399623f, 0.287530988f},
-std::array<float,2>{0.218814582f, 0.396358609f},
-std::array<float,2>{0.860911489f, 0.875615597f},
-std::array<float,2>{0.296660393f, 0.527046442f},
-std::array<float,2>{0.508709192f, 0.157854781f},
-std::array<float,2>{0.0260111447f, 0.21439977f},
-std::array<float,2>{0.940395355f, 0.623180628f},
-std::array<float,2>{0.495758176f, 0.956600487f},
-std::array<float,2>{0.709317267f, 0.443117231f},
-std::array<float,2>{0.351410508f, 0.330318749f},
-std::array<float,2>{0.593698978f, 0.814001203f},
-std::array<float,2>{0.139240965f, 0.739094377f},
-std::array<float,2>{0.781957984f, 0.045829311f},
-std::array<float,2>{0.254040599f, 0.128648669f},
-std::array<float,2>{0.540929258f, 0.548594117f},
-std::array<float,2>{0.214510053f, 0.935151935f},
-std::array<float,2>{0.819545507f, 0.423968613f},
-std::array<float,2>{0.097567074f, 0.264617473f},
-std::array<float,2>{0.933081508f, 0.767952144f},
-std::array<float,2>{0.410069704f, 0.631031573f},
-std::array<float,2>{0.632871568f, 0.119106404f},
-std::array<float,2>{0.177899137f, 0.0181647968f},
-std::array<float,2>{0.761192799f, 0.688707829f},
-std::array<float,2>{0.327846974f, 0.849610031f},
-std::array<float,2>{0.596160352f, 0.374560148f},
-std::array<float,2>{0.457159907f, 0.486456156f},
-std::array<float,2>{0.734956503f, 0.981251478f},
-std::array<float,2>{0.0485348962f, 0.578122139f},
-std::array<float,2>{0.986224711f, 0.244384333f},
-std::array<float,2>{0.332171887f, 0.0480505154f},
-std::array<float,2>{0.623088002f, 0.718763351f},
-std::array<float,2>{0.167926267f, 0.831102729f},
-std::array<float,2>{0.770334661f, 0.320606858f},
-std::array<float,2>{0.0388891026f, 0.464508921f},
-std::array<float,2>{0.982243419f, 0.941458225f},
-std::array<float,2>{0.451146215f, 0.602105796f},
-std::array<float,2>{0.725739896f, 0.201489702f},
-std::array<float,2>{0.195454672f, 0.187475026f},
-std::array<float,2>{0.843095362f, 0.505351305f},
-std::array<float,2>{0.270146072f, 0.894181728f},
-std::array<float,2>{0.551349401f, 0.387331098f},
-std::array<float,2>{0.428049982f, 0.298602134f},
-std::array<float,2>{0.649829447f, 0.802413106f},
-std::array<float,2>{0.115884729f, 0.660043418f},
-std::array<float,2>{0.919888735f, 0.0833258405f},
-std::array<float,2>{0.46916008f, 0.223210812f},
-std::array<float,2>{0.695237041f, 0.590777159f},
-std::array<float,2>{0.00105942623f, 0.989245355f},
-std::array<float,2>{0.958986402f, 0.480748087f},
-std::array<float,2>{0.154592961f, 0.345540673f},
-std::array<float,2>{0.804230154f, 0.86648941f},
-std::array<float,2>{0.371724993f, 0.708254576f},
-std::array<float,2>{0.566004872f, 0.0151112918f},
-std::array<float,2>{0.0642606542f, 0.102636009f},
-std::array<float,2>{0.901819348f, 0.648112535f},
-std::array<float,2>{0.381097138f, 0.757564783f},
-std::array<float,2>{0.679098547f, 0.277466774f},
-std::array<float,2>{0.31130743f, 0.416937888f},
-std::array<float,2>{0.521961749f, 0.918409705f},
-std::array<float,2>{0.240961239f, 0.536476612f},
-std::array<float,2>{0.843865037f, 0.149437159f},
-std::array<float,2>{0.475411177f, 0.0635398552f},
-std::array<float,2>{0.689141333f, 0.680917203f},
-std::array<float,2>{0.00572777586f, 0.783670545f},
-std::array<float,2>{0.953832924f, 0.290797979f},
-std::array<float,2>{0.148685291f, 0.403023094f},
-std::array<float,2>{0.797165632f, 0.885832012f},
-std::array<float,2>{0.370988518f, 0.523153782f},
-std::array<float,2>{0.570157826f, 0.167956114f},
-std::array<float,2>{0.0673596933f, 0.206026092f},
-std::array<float,2>{0.902851641f, 0.610521674f},
-std::array<float,2>{0.378802598f, 0.968290687f},
-std::array<float,2>{0.671949267f, 0.447147191f},
-std::array<float,2>{0.306471884f, 0.338424861f},
-std::array<float,2>{0.516337812f, 0.826111376f},
-std::array<float,2>{0.237411633f, 0.74258697f},
-std::array<float,2>{0.850223303f, 0.0313361697f},
-std::array<float,2>{0.329768062f, 0.137447879f},
-std::array<float,2>{0.617812514f, 0.561103046f},
-std::array<float,2>{0.171792179f, 0.925667942f},
-std::array<float,2>{0.769484162f, 0.42990157f},
-std::array<float,2>{0.0338570252f, 0.25535813f},
-std::array<float,2>{0.978769004f, 0.78109777f},
-std::array<float,2>{0.446708202f, 0.633273304f},
-std::array<float,2>{0.719217479f, 0.112944528f},
-std::array<float,2>{0.20045355f, 0.0237957705f},
-std::array<float,2>{0.838143885f, 0.698133886f},
-std::array<float,2>{0.265938133f, 0.856147766f},
-std::array<float,2>{0.54933399f, 0.362614155f},
-std::array<float,2>{0.422631323f, 0.498448223f},
-std::array<float,2>{0.652460337f, 0.96993047f},
-std::array<float,2>{0.109774128f, 0.562687755f},
-std::array<float,2>{0.917262793f, 0.239169076f},
-std::array<float,2>{0.253623217f, 0.0576015189f},
-std::array<float,2>{0.544130206f, 0.733815491f},
-std::array<float,2>{0.218389809f, 0.840877712f},
-std::array<float,2>{0.815364838f, 0.319551647f},
-std::array<float,2>{0.098308593f, 0.458737701f},
-std::array<float,2>{0.935682595f, 0.946404219f},
-std::array<float,2>{0.413744837f, 0.597037137f},
-std::array<float,2>{0.640294909f, 0.192228451f},
-std::array<float,2>{0.175584912f, 0.172299445f},
-std::array<float,2>{0.765000343f, 0.508474767f},
-std::array<float,2>{0.321738869f, 0.901956022f},
-std::array<float,2>{0.598785996f, 0.377380967f},
-std::array<float,2>{0.456538469f, 0.305568427f},
-std::array<float,2>{0.738739789f, 0.811757147f},
-std::array<float,2>{0.0514855646f, 0.666531205f},
-std::array<float,2>{0.990189135f, 0.0927881971f},
-std::array<float,2>{0.392763525f, 0.228663579f},
-std::array<float,2>{0.670924664f, 0.581227005f},
-std::array<float,2>{0.0790765509f, 0.995652795f},
-std::array<float,2>{0.881453454f, 0.474974036f},
-std::array<float,2>{0.226121217f, 0.351592451f},
-std::array<float,2>{0.864694238f, 0.870517254f},
-std::array<float,2>{0.291885704f, 0.716842413f},
-std::array<float,2>{0.515308738f, 0.00324886199f},
-std::array<float,2>{0.0301490072f, 0.096294485f},
-std::array<float,2>{0.944969296f, 0.648569524f},
-std::array<float,2>{0.499998897f, 0.759131134f},
-std::array<float,2>{0.706228614f, 0.272173643f},
-std::array<float,2>{0.346182406f, 0.408876985f},
-std::array<float,2>{0.586777866f, 0.90699482f},
-std::array<float,2>{0.135043651f, 0.541315556f},
-std::array<float,2>{0.788482904f, 0.146263003f},
-std::array<float,2>{0.421359032f, 0.0110490546f},
-std::array<float,2>{0.626472175f, 0.705049813f},
-std::array<float,2>{0.107452169f, 0.859535694f},
-std::array<float,2>{0.929445505f, 0.350474238f},
-std::array<float,2>{0.210048348f, 0.478199482f},
-std::array<float,2>{0.824264705f, 0.986680865f},
-std::array<float,2>{0.264566332f, 0.589004755f},
-std::array<float,2>{0.536504209f, 0.221779004f},
-std::array<float,2>{0.0612978078f, 0.154481649f},
-std::array<float,2>{0.998700857f, 0.533555388f},
-std::array<float,2>{0.463596761f, 0.917576671f},
-std::array<float,2>{0.748055041f, 0.41882363f},
-std::array<float,2>{0.31931749f, 0.274938941f},
-std::array<float,2>{0.607365668f, 0.752131462f},
-std::array<float,2>{0.184931099f, 0.643327296f},
-std::array<float,2>{0.751511931f, 0.108768687f},
-std::array<float,2>{0.287905157f, 0.198013633f},
-std::array<float,2>{0.500721097f, 0.609135687f},
-std::array<float,2>{0.233363062f, 0.941044986f},
-std::array<float,2>{0.868943989f, 0.466750383f},
-std::array<float,2>{0.0867077932f, 0.325226128f},
-std::array<float,2>{0.890018463f, 0.834429741f},
-std::array<float,2>{0.40301165f, 0.726395547f},
-std::array<float,2>{0.662904859f, 0.0519405119f},
-std::array<float,2>{0.131579652f, 0.0801757872f},
-std::array<float,2>{0.791721165f, 0.661211252f},
-std::array<float,2>{0.35634765f, 0.799785256f},
-std::array<float,2>{0.579597056f, 0.30160746f},
-std::array<float,2>{0.489290476f, 0.38649115f},
-std::array<float,2>{0.715938449f, 0.896389484f},
-std::array<float,2>{0.0229993798f, 0.501462758f},
-std::array<float,2>{0.946954966f, 0.182352901f},
-std::array<float,2>{0.362796724f, 0.12180239f},
-std::array<float,2>{0.576304436f, 0.627849758f},
-std::array<float,2>{0.144083679f, 0.769933283f},
-std::array<float,2>{0.806666732f, 0.261094779f},
-std::array<float,2>{0.0105779925f, 0.425936729f},
-std::array<float,2>{0.967126906f, 0.931781054f},
-std::array<float,2>{0.484054506f, 0.553336322f},
-std::array<float,2>{0.702795863f, 0.132774606f},
-std::array<float,2>{0.245980099f, 0.248691335f},
-std::array<float,2>{0.854958713f, 0.571027875f},
-std::array<float,2>{0.298514217f, 0.9803918f},
-std::array<float,2>{0.529317081f, 0.489723772f},
-std::array<float,2>{0.385950685f, 0.370016128f},
-std::array<float,2>{0.68125385f, 0.845546663f},
-std::array<float,2>{0.0746006221f, 0.694546402f},
-std::array<float,2>{0.897398114f, 0.0224070903f},
-std::array<float,2>{0.445266068f, 0.160921276f},
-std::array<float,2>{0.731926918f, 0.527992427f},
-std::array<float,2>{0.045913022f, 0.880506456f},
-std::array<float,2>{0.969820023f, 0.391875535f},
-std::array<float,2>{0.162451446f, 0.283861458f},
-std::array<float,2>{0.780195713f, 0.79311955f},
-std::array<float,2>{0.338719875f, 0.671917021f},
-std::array<float,2>{0.61050719f, 0.0718846992f},
-std::array<float,2>{0.121168762f, 0.0400107093f},
-std::array<float,2>{0.910475314f, 0.735589921f},
-std::array<float,2>{0.43067348f, 0.818386853f},
-std::array<float,2>{0.644455492f, 0.333085299f},
-std::array<float,2>{0.276606828f, 0.440365165f},
-std::array<float,2>{0.558470488f, 0.95913583f},
-std::array<float,2>{0.194424421f, 0.618574262f},
-std::array<float,2>{0.83342731f, 0.217475414f},
-std::array<float,2>{0.466218889f, 0.0382475704f},
-std::array<float,2>{0.74511683f, 0.749927282f},
-std::array<float,2>{0.0568515733f, 0.822244465f},
-std::array<float,2>{0.99242723f, 0.339948118f},
-std::array<float,2>{0.182110295f, 0.450343937f},
-std::array<float,2>{0.756695092f, 0.962931633f},
-std::array<float,2>{0.312868327f, 0.614610255f},
-std::array<float,2>{0.60516268f, 0.20932968f},
-std::array<float,2>{0.101853549f, 0.168400452f},
-std::array<float,2>{0.922068655f, 0.516269445f},
-std::array<float,2>{0.415541649f, 0.887037277f},
-std::array<float,2>{0.630129218f, 0.401491821f},
-std::array<float,2>{0.261353403f, 0.296487808f},
-std::array<float,2>{0.532624245f, 0.787081063f},
-std::array<float,2>{0.206757367f, 0.685641825f},
-std::array<float,2>{0.822599053f, 0.0677538514f},
-std::array<float,2>{0.354515105f, 0.23770009f},
-std::array<float,2>{0.584585786f, 0.567365229f},
-std::array<float,2>{0.127101228f, 0.975590706f},
-std::array<float,2>{0.794485867f, 0.495407254f},
-std::array<float,2>{0.0185485762f, 0.363288373f},
-std::array<float,2>{0.949285686f, 0.851800621f},
-std::array<float,2>{0.486233234f, 0.699293196f},
-std::array<float,2>{0.714217007f, 0.029538136f},
-std::array<float,2>{0.229240686f, 0.115261078f},
-std::array<float,2>{0.872675478f, 0.640390813f},
-std::array<float,2>{0.284214824f, 0.775439203f},
-std::array<float,2>{0.506881058f, 0.25388974f},
-std::array<float,2>{0.401465267f, 0.433837503f},
-std::array<float,2>{0.656362832f, 0.929070354f},
-std::array<float,2>{0.091641821f, 0.557976484f},
-std::array<float,2>{0.883067369f, 0.136275202f},
-std::array<float,2>{0.302055836f, 0.089373745f},
-std::array<float,2>{0.526895463f, 0.669185162f},
-std::array<float,2>{0.249567732f, 0.807849884f},
-std::array<float,2>{0.856673181f, 0.310288817f},
-std::array<float,2>{0.073170498f, 0.380920172f},
-std::array<float,2>{0.893815637f, 0.90511018f},
-std::array<float,2>{0.390137881f, 0.512370408f},
-std::array<float,2>{0.685797453f, 0.176780984f},
-std::array<float,2>{0.145728245f, 0.189088464f},
-std::array<float,2>{0.808832347f, 0.599173009f},
-std::array<float,2>{0.364828587f, 0.952990055f},
-std::array<float,2>{0.572689652f, 0.456499487f},
-std::array<float,2>{0.477952778f, 0.314106077f},
-std::array<float,2>{0.697903037f, 0.83703351f},
-std::array<float,2>{0.0137948636f, 0.728018224f},
-std::array<float,2>{0.963674009f, 0.0618753247f},
-std::array<float,2>{0.436359018f, 0.142441288f},
-std::array<float,2>{0.648120046f, 0.543408751f},
-std::array<float,2>{0.118147239f, 0.912171125f},
-std::array<float,2>{0.906961262f, 0.411840349f},
-std::array<float,2>{0.188071221f, 0.267287612f},
-std::array<float,2>{0.830389082f, 0.763186038f},
-std::array<float,2>{0.278059214f, 0.652412593f},
-std::array<float,2>{0.560809135f, 0.101185061f},
-std::array<float,2>{0.0415525176f, 0.00592460204f},
-std::array<float,2>{0.974121332f, 0.711813569f},
-std::array<float,2>{0.438265294f, 0.873092175f},
-std::array<float,2>{0.72831744f, 0.356959224f},
-std::array<float,2>{0.342871845f, 0.472393781f},
-std::array<float,2>{0.613955021f, 0.998211622f},
-std::array<float,2>{0.159509838f, 0.583210945f},
-std::array<float,2>{0.774296343f, 0.234045058f},
-std::array<float,2>{0.381901801f, 0.104555279f},
-std::array<float,2>{0.678357244f, 0.645240545f},
-std::array<float,2>{0.0633353069f, 0.754456699f},
-std::array<float,2>{0.90048945f, 0.280992001f},
-std::array<float,2>{0.241782442f, 0.415074706f},
-std::array<float,2>{0.845469952f, 0.920120478f},
-std::array<float,2>{0.312268347f, 0.538059413f},
-std::array<float,2>{0.522846878f, 0.151267722f},
-std::array<float,2>{0.000646522793f, 0.226360619f},
-std::array<float,2>{0.960749805f, 0.593188167f},
-std::array<float,2>{0.46982646f, 0.990896225f},
-std::array<float,2>{0.69353956f, 0.483566225f},
-std::array<float,2>{0.372999698f, 0.347568572f},
-std::array<float,2>{0.564483047f, 0.864679635f},
-std::array<float,2>{0.155523673f, 0.710283339f},
-std::array<float,2>{0.803381205f, 0.0127633866f},
-std::array<float,2>{0.270586014f, 0.185072571f},
-std::array<float,2>{0.552328229f, 0.507102311f},
-std::array<float,2>{0.196495205f, 0.892163515f},
-std::array<float,2>{0.841976821f, 0.390270621f},
-std::array<float,2>{0.116882786f, 0.299960583f},
-std::array<float,2>{0.918345869f, 0.803350747f},
-std::array<float,2>{0.429009229f, 0.657622576f},
-std::array<float,2>{0.649055958f, 0.0859325603f},
-std::array<float,2>{0.166040599f, 0.0507596023f},
-std::array<float,2>{0.770842195f, 0.72154814f},
-std::array<float,2>{0.333172143f, 0.829485059f},
-std::array<float,2>{0.624391973f, 0.322848678f},
-std::array<float,2>{0.44983682f, 0.461149633f},
-std::array<float,2>{0.724899828f, 0.944169462f},
-std::array<float,2>{0.0371259898f, 0.604343295f},
-std::array<float,2>{0.980773449f, 0.199468181f},
-std::array<float,2>{0.327106804f, 0.0166089274f},
-std::array<float,2>{0.597444773f, 0.691319466f},
-std::array<float,2>{0.17897667f, 0.848150373f},
-std::array<float,2>{0.759807527f, 0.371496916f},
-std::array<float,2>{0.0474113151f, 0.484784424f},
-std::array<float,2>{0.984821916f, 0.982542753f},
-std::array<float,2>{0.458645254f, 0.574320436f},
-std::array<float,2>{0.735965133f, 0.243750975f},
-std::array<float,2>{0.21343407f, 0.125399008f},
-std::array<float,2>{0.818879247f, 0.549206972f},
-std::array<float,2>{0.255464941f, 0.937477887f},
-std::array<float,2>{0.539407432f, 0.423752367f},
-std::array<float,2>{0.408753812f, 0.262564212f},
-std::array<float,2>{0.634154975f, 0.765856743f},
-std::array<float,2>{0.0957777798f, 0.630612671f},
-std::array<float,2>{0.932605684f, 0.119244754f},
-std::array<float,2>{0.494472712f, 0.211784765f},
-std::array<float,2>{0.710716128f, 0.622438848f},
-std::array<float,2>{0.0264777336f, 0.954523325f},
-std::array<float,2>{0.941400766f, 0.443690032f},
-std::array<float,2>{0.140172586f, 0.329924077f},
-std::array<float,2>{0.782725215f, 0.81580615f},
-std::array<float,2>{0.350354224f, 0.741789281f},
-std::array<float,2>{0.592509389f, 0.0440174304f},
-std::array<float,2>{0.0831395537f, 0.0758765191f},
-std::array<float,2>{0.878803432f, 0.677565396f},
-std::array<float,2>{0.394549638f, 0.791827321f},
-std::array<float,2>{0.667268038f, 0.286880702f},
-std::array<float,2>{0.295177877f, 0.397350371f},
-std::array<float,2>{0.508962929f, 0.877572775f},
-std::array<float,2>{0.219760448f, 0.524679124f},
-std::array<float,2>{0.859547615f, 0.159756273f},
-std::array<float,2>{0.448306322f, 0.11096888f},
-std::array<float,2>{0.722123682f, 0.635198712f},
-std::array<float,2>{0.0319600552f, 0.777527452f},
-std::array<float,2>{0.977557778f, 0.256708354f},
-std::array<float,2>{0.169238344f, 0.433140516f},
-std::array<float,2>{0.766779482f, 0.923057199f},
-std::array<float,2>{0.331259757f, 0.559553742f},
-std::array<float,2>{0.619649231f, 0.140371844f},
-std::array<float,2>{0.111817554f, 0.241249993f},
-std::array<float,2>{0.914930344f, 0.564592361f},
-std::array<float,2>{0.425725698f, 0.970941365f},
-std::array<float,2>{0.654582322f, 0.497964114f},
-std::array<float,2>{0.268327713f, 0.360054135f},
-std::array<float,2>{0.548588455f, 0.858735561f},
-std::array<float,2>{0.202904373f, 0.696743965f},
-std::array<float,2>{0.836343765f, 0.026074335f},
-std::array<float,2>{0.367824852f, 0.164093331f},
-std::array<float,2>{0.566975653f, 0.519948542f},
-std::array<float,2>{0.150961071f, 0.883430302f},
-std::array<float,2>{0.800640643f, 0.40585342f},
-std::array<float,2>{0.0074944105f, 0.292736441f},
-std::array<float,2>{0.955474496f, 0.781474471f},
-std::array<float,2>{0.473568529f, 0.682278335f},
-std::array<float,2>{0.691226661f, 0.0654767007f},
-std::array<float,2>{0.23499164f, 0.0341727845f},
-std::array<float,2>{0.847960413f, 0.745933354f},
-std::array<float,2>{0.307930261f, 0.827746332f},
-std::array<float,2>{0.519182146f, 0.336846262f},
-std::array<float,2>{0.376239806f, 0.448852748f},
-std::array<float,2>{0.674368143f, 0.96573168f},
-std::array<float,2>{0.0687445626f, 0.612767756f},
-std::array<float,2>{0.90526557f, 0.20467411f},
-std::array<float,2>{0.289798588f, 0.00123104593f},
-std::array<float,2>{0.513055801f, 0.714873254f},
-std::array<float,2>{0.224434793f, 0.86725539f},
-std::array<float,2>{0.865860999f, 0.353751153f},
-std::array<float,2>{0.0815631971f, 0.474268794f},
-std::array<float,2>{0.879770756f, 0.993171632f},
-std::array<float,2>{0.391370177f, 0.578556418f},
-std::array<float,2>{0.669389427f, 0.227688745f},
-std::array<float,2>{0.133381367f, 0.148208216f},
-std::array<float,2>{0.786643982f, 0.540525675f},
-std::array<float,2>{0.344384313f, 0.908846021f},
-std::array<float,2>{0.588166237f, 0.406823903f},
-std::array<float,2>{0.497104585f, 0.271479458f},
-std::array<float,2>{0.704717755f, 0.761362016f},
-std::array<float,2>{0.0289251581f, 0.650638878f},
-std::array<float,2>{0.942780793f, 0.0943423808f},
-std::array<float,2>{0.411309719f, 0.19528845f},
-std::array<float,2>{0.638305366f, 0.593778729f},
-std::array<float,2>{0.099652715f, 0.947779f},
-std::array<float,2>{0.934382498f, 0.460809886f},
-std::array<float,2>{0.216061249f, 0.316855073f},
-std::array<float,2>{0.814221025f, 0.842143357f},
-std::array<float,2>{0.251071215f, 0.731039345f},
-std::array<float,2>{0.545561969f, 0.0561648794f},
-std::array<float,2>{0.052852802f, 0.0910552442f},
-std::array<float,2>{0.991346657f, 0.664298296f},
-std::array<float,2>{0.453175724f, 0.809502363f},
-std::array<float,2>{0.740279436f, 0.308340639f},
-std::array<float,2>{0.322479844f, 0.37691319f},
-std::array<float,2>{0.600193858f, 0.898602962f},
-std::array<float,2>{0.173683807f, 0.51125145f},
-std::array<float,2>{0.763209641f, 0.174016535f},
-std::array<float,2>{0.405165046f, 0.0540163964f},
-std::array<float,2>{0.661802173f, 0.723965466f},
-std::array<float,2>{0.0889710933f, 0.833358407f},
-std::array<float,2>{0.888035238f, 0.32677108f},
-std::array<float,2>{0.231918499f, 0.467348665f},
-std::array<float,2>{0.869505584f, 0.938896894f},
-std::array<float,2>{0.285918534f, 0.606022418f},
-std::array<float,2>{0.502657175f, 0.197044164f},
-std::array<float,2>{0.0210813005f, 0.181148693f},
-std::array<float,2>{0.9474141f, 0.503182352f},
-std::array<float,2>{0.492154121f, 0.89837867f},
-std::array<float,2>{0.717862725f, 0.383015066f},
-std::array<float,2>{0.358855993f, 0.304632902f},
-std::array<float,2>{0.580489755f, 0.797624469f},
-std::array<float,2>{0.129776374f, 0.662441134f},
-std::array<float,2>{0.790033162f, 0.0786743462f},
-std::array<float,2>{0.263123482f, 0.220484138f},
-std::array<float,2>{0.537286103f, 0.586119771f},
-std::array<float,2>{0.207242355f, 0.985624015f},
-std::array<float,2>{0.826286614f, 0.478905112f},
-std::array<float,2>{0.106921069f, 0.348771155f},
-std::array<float,2>{0.927724302f, 0.862379313f},
-std::array<float,2>{0.419094861f, 0.706140161f},
-std::array<float,2>{0.628841043f, 0.00933455583f},
-std::array<float,2>{0.186507955f, 0.106271781f},
-std::array<float,2>{0.752710581f, 0.642243862f},
-std::array<float,2>{0.317777336f, 0.75037384f},
-std::array<float,2>{0.607546747f, 0.275976837f},
-std::array<float,2>{0.461318165f, 0.420020908f},
-std::array<float,2>{0.747777581f, 0.914342403f},
-std::array<float,2>{0.059804976f, 0.531709313f},
-std::array<float,2>{0.997152388f, 0.153114796f},
-std::array<float,2>{0.337632179f, 0.0733284429f},
-std::array<float,2>{0.612254679f, 0.675256371f},
-std::array<float,2>{0.161523283f, 0.795542598f},
-std::array<float,2>{0.777355552f, 0.283048838f},
-std::array<float,2>{0.0433375984f, 0.392702341f},
-std::array<float,2>{0.970763683f, 0.881694973f},
-std::array<float,2>{0.442775846f, 0.53057909f},
-std::array<float,2>{0.733850896f, 0.162638173f},
-std::array<float,2>{0.191685557f, 0.216329321f},
-std::array<float,2>{0.835406423f, 0.619987905f},
-std::array<float,2>{0.275315851f, 0.957108438f},
-std::array<float,2>{0.554922938f, 0.439366311f},
-std::array<float,2>{0.432305187f, 0.335566938f},
-std::array<float,2>{0.642352939f, 0.816866159f},
-std::array<float,2>{0.124180503f, 0.73694396f},
-std::array<float,2>{0.913029552f, 0.0427596495f},
-std::array<float,2>{0.481742382f, 0.130360395f},
-std::array<float,2>{0.70048517f, 0.551430702f},
-std::array<float,2>{0.00882736407f, 0.930871665f},
-std::array<float,2>{0.965752006f, 0.429105133f},
-std::array<float,2>{0.142258123f, 0.257956684f},
-std::array<float,2>{0.805902541f, 0.773054123f},
-std::array<float,2>{0.359654963f, 0.625924706f},
-std::array<float,2>{0.575535834f, 0.123756103f},
-std::array<float,2>{0.0766974837f, 0.0206892397f},
-std::array<float,2>{0.895832241f, 0.693081856f},
-std::array<float,2>{0.384359092f, 0.846999943f},
-std::array<float,2>{0.682047427f, 0.36845094f},
-std::array<float,2>{0.300608754f, 0.490985602f},
-std::array<float,2>{0.528662384f, 0.976947546f},
-std::array<float,2>{0.243477121f, 0.574170649f},
-std::array<float,2>{0.852289319f, 0.247261047f},
-std::array<float,2>{0.487112612f, 0.0277382135f},
-std::array<float,2>{0.71119386f, 0.70250231f},
-std::array<float,2>{0.0162717439f, 0.855161905f},
-std::array<float,2>{0.952089369f, 0.365699917f},
-std::array<float,2>{0.125595018f, 0.493685514f},
-std::array<float,2>{0.795891762f, 0.974316716f},
-std::array<float,2>{0.352143705f, 0.568976939f},
-std::array<float,2>{0.582476556f, 0.235086799f},
-std::array<float,2>{0.0921448246f, 0.133243904f},
-std::array<float,2>{0.885032833f, 0.555646539f},
-std::array<float,2>{0.399115562f, 0.927444518f},
-std::array<float,2>{0.659234762f, 0.436988026f},
-std::array<float,2>{0.281834483f, 0.251238734f},
-std::array<float,2>{0.504736662f, 0.774880171f},
-std::array<float,2>{0.227350861f, 0.637800097f},
-std::array<float,2>{0.873072922f, 0.113447666f},
-std::array<float,2>{0.31486553f, 0.208450899f},
-std::array<float,2>{0.602347314f, 0.616254389f},
-std::array<float,2>{0.180170327f, 0.960965037f},
-std::array<float,2>{0.754001439f, 0.4519265f},
-std::array<float,2>{0.0563100912f, 0.34281081f},
-std::array<float,2>{0.995115161f, 0.822394788f},
-std::array<float,2>{0.467760265f, 0.746789217f},
-std::array<float,2>{0.744069397f, 0.0369088538f},
-std::array<float,2>{0.204626441f, 0.0699503496f},
-std::array<float,2>{0.820833743f, 0.68465668f},
-std::array<float,2>{0.25852412f, 0.788156033f},
-std::array<float,2>{0.533703327f, 0.293045163f},
-std::array<float,2>{0.416942835f, 0.399012893f},
-std::array<float,2>{0.631143391f, 0.890596986f},
-std::array<float,2>{0.105077066f, 0.518755496f},
-std::array<float,2>{0.924954772f, 0.171099052f},
-std::array<float,2>{0.28026098f, 0.0994684845f},
-std::array<float,2>{0.559795201f, 0.654671371f},
-std::array<float,2>{0.18954587f, 0.765087545f},
-std::array<float,2>{0.829265118f, 0.26787588f},
-std::array<float,2>{0.11935892f, 0.412444413f},
-std::array<float,2>{0.909109712f, 0.910344183f},
-std::array<float,2>{0.434316903f, 0.545857489f},
-std::array<float,2>{0.645043969f, 0.144463852f},
-std::array<float,2>{0.158129796f, 0.232237369f},
-std::array<float,2>{0.777112722f, 0.585874975f},
-std::array<float,2>{0.340920269f, 0.997755051f},
-std::array<float,2>{0.615760386f, 0.469339252f},
-std::array<float,2>{0.439514607f, 0.358048379f},
-std::array<float,2>{0.728918076f, 0.871385157f},
-std::array<float,2>{0.0396002382f, 0.713095784f},
-std::array<float,2>{0.975343585f, 0.00417105854f},
-std::array<float,2>{0.388373882f, 0.17864792f},
-std::array<float,2>{0.683797717f, 0.514934778f},
-std::array<float,2>{0.0711214989f, 0.903836787f},
-std::array<float,2>{0.892526925f, 0.380780369f},
-std::array<float,2>{0.247486174f, 0.312233925f},
-std::array<float,2>{0.857811332f, 0.805498064f},
-std::array<float,2>{0.304469228f, 0.670022905f},
-std::array<float,2>{0.52461499f, 0.0875471383f},
-std::array<float,2>{0.0117765339f, 0.059850771f},
-std::array<float,2>{0.961748481f, 0.730269849f},
-std::array<float,2>{0.479879737f, 0.839673817f},
-std::array<float,2>{0.695686877f, 0.314827383f},
-std::array<float,2>{0.366299748f, 0.454768121f},
-std::array<float,2>{0.571441829f, 0.950013876f},
-std::array<float,2>{0.147935361f, 0.599719644f},
-std::array<float,2>{0.810807884f, 0.190800264f},
-std::array<float,2>{0.426132947f, 0.0826051384f},
-std::array<float,2>{0.651971698f, 0.65902698f},
-std::array<float,2>{0.114423819f, 0.801449895f},
-std::array<float,2>{0.921264231f, 0.297843456f},
-std::array<float,2>{0.197347403f, 0.388030171f},
-std::array<float,2>{0.84017092f, 0.892844498f},
-std::array<float,2>{0.272071242f, 0.504695952f},
-std::array<float,2>{0.554321826f, 0.186204717f},
-std::array<float,2>{0.0363310203f, 0.203032315f},
-std::array<float,2>{0.982482314f, 0.602606535f},
-std::array<float,2>{0.452932507f, 0.942477643f},
-std::array<float,2>{0.724500716f, 0.463030875f},
-std::array<float,2>{0.335730016f, 0.321662366f},
-std::array<float,2>{0.622137845f, 0.830165625f},
-std::array<float,2>{0.164510325f, 0.720002592f},
-std::array<float,2>{0.771746337f, 0.0469475016f},
-std::array<float,2>{0.310082912f, 0.148844078f},
-std::array<float,2>{0.520521641f, 0.535555482f},
-std::array<float,2>{0.23911643f, 0.91966933f},
-std::array<float,2>{0.846224606f, 0.417571455f},
-std::array<float,2>{0.0660527349f, 0.278609604f},
-std::array<float,2>{0.899378836f, 0.755953789f},
-std::array<float,2>{0.379240185f, 0.646916807f},
-std::array<float,2>{0.676308215f, 0.102038771f},
-std::array<float,2>{0.152493119f, 0.013822074f},
-std::array<float,2>{0.802544773f, 0.707032263f},
-std::array<float,2>{0.374536455f, 0.866157055f},
-std::array<float,2>{0.564087093f, 0.34405002f},
-std::array<float,2>{0.472482681f, 0.48145476f},
-std::array<float,2>{0.692097127f, 0.989649475f},
-std::array<float,2>{0.00232983637f, 0.591772497f},
-std::array<float,2>{0.958001792f, 0.223679096f},
-std::array<float,2>{0.349205911f, 0.0467079431f},
-std::array<float,2>{0.590969503f, 0.740029156f},
-std::array<float,2>{0.137040496f, 0.812824249f},
-std::array<float,2>{0.78341794f, 0.331240237f},
-std::array<float,2>{0.0242787767f, 0.441538244f},
-std::array<float,2>{0.937735856f, 0.955683768f},
-std::array<float,2>{0.492264867f, 0.624884367f},
-std::array<float,2>{0.707383931f, 0.212991968f},
-std::array<float,2>{0.221805394f, 0.157023504f},
-std::array<float,2>{0.862690091f, 0.525633514f},
-std::array<float,2>{0.293742388f, 0.876596749f},
-std::array<float,2>{0.510364532f, 0.395408154f},
-std::array<float,2>{0.397222877f, 0.288707465f},
-std::array<float,2>{0.665509701f, 0.789660692f},
-std::array<float,2>{0.0846221969f, 0.679599583f},
-std::array<float,2>{0.876811385f, 0.0767076984f},
-std::array<float,2>{0.459952146f, 0.245987192f},
-std::array<float,2>{0.738162339f, 0.576734245f},
-std::array<float,2>{0.0502076261f, 0.982122183f},
-std::array<float,2>{0.987167716f, 0.488145769f},
-std::array<float,2>{0.17706944f, 0.374005526f},
-std::array<float,2>{0.759304225f, 0.850634575f},
-std::array<float,2>{0.325469136f, 0.688257694f},
-std::array<float,2>{0.594169497f, 0.0194309819f},
-std::array<float,2>{0.0940256566f, 0.117984653f},
-std::array<float,2>{0.930321872f, 0.632191658f},
-std::array<float,2>{0.406695664f, 0.768746495f},
-std::array<float,2>{0.636176527f, 0.265017271f},
-std::array<float,2>{0.257358968f, 0.425567746f},
-std::array<float,2>{0.541085541f, 0.934010804f},
-std::array<float,2>{0.211553052f, 0.547286987f},
-std::array<float,2>{0.817899585f, 0.127348512f}}
\ No newline at end of file
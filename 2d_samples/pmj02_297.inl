@@ -1,4096 +0,0 @@
-{std::array<float,2>{0.340716988f, 0.841950476f},
-std::array<float,2>{0.676059783f, 0.00282566505f},
-std::array<float,2>{0.834890962f, 0.561243594f},
-std::array<float,2>{0.202427194f, 0.493364185f},
-std::array<float,2>{0.0332005695f, 0.719054818f},
-std::array<float,2>{0.945140779f, 0.301851839f},
-std::array<float,2>{0.527607858f, 0.889668524f},
-std::array<float,2>{0.440138251f, 0.194371805f},
-std::array<float,2>{0.180198863f, 0.940718055f},
-std::array<float,2>{0.807286143f, 0.161408991f},
-std::array<float,2>{0.730953157f, 0.647843182f},
-std::array<float,2>{0.280238718f, 0.339909703f},
-std::array<float,2>{0.382179379f, 0.568853021f},
-std::array<float,2>{0.588146091f, 0.409626395f},
-std::array<float,2>{0.888002932f, 0.796839297f},
-std::array<float,2>{0.0659761429f, 0.0981761441f},
-std::array<float,2>{0.488351554f, 0.922147751f},
-std::array<float,2>{0.56037128f, 0.225308403f},
-std::array<float,2>{0.999399722f, 0.712999523f},
-std::array<float,2>{0.0159976743f, 0.261638045f},
-std::array<float,2>{0.238219231f, 0.505292118f},
-std::array<float,2>{0.850115597f, 0.438889712f},
-std::array<float,2>{0.628571928f, 0.852219045f},
-std::array<float,2>{0.34495905f, 0.0616523884f},
-std::array<float,2>{0.111995198f, 0.758594632f},
-std::array<float,2>{0.931911945f, 0.0773345307f},
-std::array<float,2>{0.599425673f, 0.604295731f},
-std::array<float,2>{0.424463332f, 0.384631932f},
-std::array<float,2>{0.297402442f, 0.681810975f},
-std::array<float,2>{0.701352835f, 0.363213748f},
-std::array<float,2>{0.76878792f, 0.975284636f},
-std::array<float,2>{0.13050136f, 0.154894084f},
-std::array<float,2>{0.257642448f, 0.989604831f},
-std::array<float,2>{0.746614635f, 0.131971866f},
-std::array<float,2>{0.784345806f, 0.669956982f},
-std::array<float,2>{0.158268899f, 0.353683442f},
-std::array<float,2>{0.0783354938f, 0.618196666f},
-std::array<float,2>{0.89196527f, 0.400785923f},
-std::array<float,2>{0.572403431f, 0.775054991f},
-std::array<float,2>{0.39528805f, 0.0936658978f},
-std::array<float,2>{0.214837715f, 0.86296761f},
-std::array<float,2>{0.817592144f, 0.0418655463f},
-std::array<float,2>{0.661347866f, 0.526036739f},
-std::array<float,2>{0.320285589f, 0.46115914f},
-std::array<float,2>{0.464441448f, 0.688649893f},
-std::array<float,2>{0.513381898f, 0.269540817f},
-std::array<float,2>{0.9656111f, 0.921456039f},
-std::array<float,2>{0.0520025194f, 0.239261314f},
-std::array<float,2>{0.4161475f, 0.80579412f},
-std::array<float,2>{0.619985104f, 0.122050628f},
-std::array<float,2>{0.917302966f, 0.589300811f},
-std::array<float,2>{0.0941718668f, 0.435148388f},
-std::array<float,2>{0.141989797f, 0.636612177f},
-std::array<float,2>{0.764389753f, 0.32301113f},
-std::array<float,2>{0.703336298f, 0.957761943f},
-std::array<float,2>{0.281271338f, 0.173817039f},
-std::array<float,2>{0.00999787636f, 0.905730784f},
-std::array<float,2>{0.974322915f, 0.217970714f},
-std::array<float,2>{0.539471447f, 0.738262236f},
-std::array<float,2>{0.48277539f, 0.28493014f},
-std::array<float,2>{0.359806776f, 0.540665746f},
-std::array<float,2>{0.652769506f, 0.475258261f},
-std::array<float,2>{0.863007545f, 0.81553179f},
-std::array<float,2>{0.227784634f, 0.0211372245f},
-std::array<float,2>{0.293646097f, 0.772118986f},
-std::array<float,2>{0.714851677f, 0.0830139741f},
-std::array<float,2>{0.755000889f, 0.615034878f},
-std::array<float,2>{0.150334418f, 0.393378913f},
-std::array<float,2>{0.106346592f, 0.656431019f},
-std::array<float,2>{0.909186959f, 0.346037865f},
-std::array<float,2>{0.615034819f, 0.999296308f},
-std::array<float,2>{0.406784087f, 0.139166728f},
-std::array<float,2>{0.221686512f, 0.911118209f},
-std::array<float,2>{0.872140586f, 0.243856519f},
-std::array<float,2>{0.645082176f, 0.699896395f},
-std::array<float,2>{0.370546609f, 0.275671899f},
-std::array<float,2>{0.471767008f, 0.52210331f},
-std::array<float,2>{0.535810709f, 0.460092247f},
-std::array<float,2>{0.982693315f, 0.867987752f},
-std::array<float,2>{0.00151494134f, 0.0330872573f},
-std::array<float,2>{0.402123392f, 0.967727602f},
-std::array<float,2>{0.564447641f, 0.185577706f},
-std::array<float,2>{0.905244052f, 0.628923476f},
-std::array<float,2>{0.0899623632f, 0.317158699f},
-std::array<float,2>{0.166441888f, 0.583905756f},
-std::array<float,2>{0.795273542f, 0.429160833f},
-std::array<float,2>{0.740623891f, 0.79848063f},
-std::array<float,2>{0.262879729f, 0.115918167f},
-std::array<float,2>{0.0609300807f, 0.827646375f},
-std::array<float,2>{0.958038807f, 0.0238636844f},
-std::array<float,2>{0.50043124f, 0.536470234f},
-std::array<float,2>{0.458845824f, 0.48000589f},
-std::array<float,2>{0.326381594f, 0.748367667f},
-std::array<float,2>{0.668583155f, 0.291088492f},
-std::array<float,2>{0.824407756f, 0.893599093f},
-std::array<float,2>{0.208303005f, 0.20594421f},
-std::array<float,2>{0.35436514f, 0.877636194f},
-std::array<float,2>{0.640124977f, 0.200902954f},
-std::array<float,2>{0.857733965f, 0.729658723f},
-std::array<float,2>{0.246363387f, 0.309422582f},
-std::array<float,2>{0.0284707583f, 0.551064253f},
-std::array<float,2>{0.987724006f, 0.488521308f},
-std::array<float,2>{0.550156176f, 0.835351348f},
-std::array<float,2>{0.49310559f, 0.0118468199f},
-std::array<float,2>{0.133742303f, 0.78162843f},
-std::array<float,2>{0.775214016f, 0.104020201f},
-std::array<float,2>{0.691952765f, 0.577428341f},
-std::array<float,2>{0.310736954f, 0.416262299f},
-std::array<float,2>{0.435019314f, 0.649566591f},
-std::array<float,2>{0.606257856f, 0.328464895f},
-std::array<float,2>{0.927227616f, 0.949418485f},
-std::array<float,2>{0.120104112f, 0.169870079f},
-std::array<float,2>{0.44642663f, 0.850189328f},
-std::array<float,2>{0.516672492f, 0.047898747f},
-std::array<float,2>{0.949525893f, 0.515256405f},
-std::array<float,2>{0.0440895073f, 0.446125925f},
-std::array<float,2>{0.193645939f, 0.703593373f},
-std::array<float,2>{0.838864982f, 0.250602633f},
-std::array<float,2>{0.687265873f, 0.933007181f},
-std::array<float,2>{0.33039099f, 0.227274939f},
-std::array<float,2>{0.0716733634f, 0.979389727f},
-std::array<float,2>{0.879690826f, 0.148265094f},
-std::array<float,2>{0.581407905f, 0.674187124f},
-std::array<float,2>{0.388491511f, 0.369931817f},
-std::array<float,2>{0.269778132f, 0.594232023f},
-std::array<float,2>{0.720430851f, 0.379902124f},
-std::array<float,2>{0.800879657f, 0.751846731f},
-std::array<float,2>{0.172024399f, 0.0646724775f},
-std::array<float,2>{0.371988058f, 0.79161942f},
-std::array<float,2>{0.642729938f, 0.0942538604f},
-std::array<float,2>{0.868011475f, 0.565670073f},
-std::array<float,2>{0.225073025f, 0.41369316f},
-std::array<float,2>{0.00539217563f, 0.643716156f},
-std::array<float,2>{0.976977646f, 0.338380367f},
-std::array<float,2>{0.533949971f, 0.941636682f},
-std::array<float,2>{0.476236373f, 0.158431277f},
-std::array<float,2>{0.153149158f, 0.883082569f},
-std::array<float,2>{0.75294888f, 0.190565407f},
-std::array<float,2>{0.714059114f, 0.723601818f},
-std::array<float,2>{0.290815532f, 0.298954815f},
-std::array<float,2>{0.412643433f, 0.557114124f},
-std::array<float,2>{0.613182127f, 0.496595353f},
-std::array<float,2>{0.913587749f, 0.839623034f},
-std::array<float,2>{0.103381068f, 0.00515091373f},
-std::array<float,2>{0.45578143f, 0.970649958f},
-std::array<float,2>{0.5040012f, 0.151689291f},
-std::array<float,2>{0.954425156f, 0.686913371f},
-std::array<float,2>{0.058111161f, 0.367109776f},
-std::array<float,2>{0.205665499f, 0.607966125f},
-std::array<float,2>{0.82168293f, 0.387922496f},
-std::array<float,2>{0.666873395f, 0.763870537f},
-std::array<float,2>{0.323438019f, 0.073099196f},
-std::array<float,2>{0.0864224434f, 0.856494784f},
-std::array<float,2>{0.900825143f, 0.0554844774f},
-std::array<float,2>{0.567792654f, 0.503754973f},
-std::array<float,2>{0.406152397f, 0.445166528f},
-std::array<float,2>{0.259107679f, 0.718527496f},
-std::array<float,2>{0.737139344f, 0.261980712f},
-std::array<float,2>{0.791838646f, 0.92704761f},
-std::array<float,2>{0.169662014f, 0.219521463f},
-std::array<float,2>{0.307646692f, 0.917021036f},
-std::array<float,2>{0.690224409f, 0.235986784f},
-std::array<float,2>{0.779594481f, 0.695023775f},
-std::array<float,2>{0.140533358f, 0.269131392f},
-std::array<float,2>{0.12175405f, 0.52786994f},
-std::array<float,2>{0.92411226f, 0.467986435f},
-std::array<float,2>{0.60197109f, 0.864943206f},
-std::array<float,2>{0.432526857f, 0.04382319f},
-std::array<float,2>{0.243078634f, 0.779939413f},
-std::array<float,2>{0.853722394f, 0.0891423523f},
-std::array<float,2>{0.633339345f, 0.623663008f},
-std::array<float,2>{0.355705559f, 0.404712558f},
-std::array<float,2>{0.497814149f, 0.667314649f},
-std::array<float,2>{0.552700341f, 0.358405769f},
-std::array<float,2>{0.990997195f, 0.986994743f},
-std::array<float,2>{0.0254197959f, 0.12718977f},
-std::array<float,2>{0.383364052f, 0.819193423f},
-std::array<float,2>{0.582571566f, 0.0168187693f},
-std::array<float,2>{0.878691673f, 0.54456681f},
-std::array<float,2>{0.0760028437f, 0.46982637f},
-std::array<float,2>{0.177527338f, 0.740572393f},
-std::array<float,2>{0.800204754f, 0.288542897f},
-std::array<float,2>{0.725803912f, 0.901830912f},
-std::array<float,2>{0.268255949f, 0.210999683f},
-std::array<float,2>{0.0408753604f, 0.956140995f},
-std::array<float,2>{0.949208379f, 0.177821174f},
-std::array<float,2>{0.522262633f, 0.638807893f},
-std::array<float,2>{0.449234813f, 0.32741487f},
-std::array<float,2>{0.333773345f, 0.593665659f},
-std::array<float,2>{0.681504726f, 0.432453662f},
-std::array<float,2>{0.841228187f, 0.810591161f},
-std::array<float,2>{0.188047484f, 0.12054833f},
-std::array<float,2>{0.275211066f, 0.873250723f},
-std::array<float,2>{0.728105247f, 0.0366658606f},
-std::array<float,2>{0.810886204f, 0.516948044f},
-std::array<float,2>{0.18707934f, 0.453867048f},
-std::array<float,2>{0.0685205758f, 0.698451757f},
-std::array<float,2>{0.883354783f, 0.280141205f},
-std::array<float,2>{0.591436207f, 0.907563686f},
-std::array<float,2>{0.377131373f, 0.249101251f},
-std::array<float,2>{0.197692662f, 0.993108034f},
-std::array<float,2>{0.829927504f, 0.136689514f},
-std::array<float,2>{0.67313683f, 0.660617173f},
-std::array<float,2>{0.338361651f, 0.351483971f},
-std::array<float,2>{0.442587763f, 0.611966491f},
-std::array<float,2>{0.525032759f, 0.39543736f},
-std::array<float,2>{0.940030038f, 0.766720533f},
-std::array<float,2>{0.0382360816f, 0.0804746971f},
-std::array<float,2>{0.427594513f, 0.896088243f},
-std::array<float,2>{0.594968796f, 0.208924264f},
-std::array<float,2>{0.937386096f, 0.743715227f},
-std::array<float,2>{0.115478687f, 0.29547289f},
-std::array<float,2>{0.127292737f, 0.531613469f},
-std::array<float,2>{0.771494031f, 0.482102215f},
-std::array<float,2>{0.696858525f, 0.822961986f},
-std::array<float,2>{0.304546773f, 0.0278629512f},
-std::array<float,2>{0.0213960689f, 0.803928196f},
-std::array<float,2>{0.993170977f, 0.109686516f},
-std::array<float,2>{0.557662249f, 0.579742253f},
-std::array<float,2>{0.487934113f, 0.423612922f},
-std::array<float,2>{0.348450482f, 0.626116812f},
-std::array<float,2>{0.629088283f, 0.313340932f},
-std::array<float,2>{0.847068191f, 0.963456631f},
-std::array<float,2>{0.239996329f, 0.181953892f},
-std::array<float,2>{0.313104749f, 0.948734999f},
-std::array<float,2>{0.656622171f, 0.167474553f},
-std::array<float,2>{0.813461304f, 0.653681278f},
-std::array<float,2>{0.217599168f, 0.333580196f},
-std::array<float,2>{0.0491026342f, 0.574065268f},
-std::array<float,2>{0.960974932f, 0.418140531f},
-std::array<float,2>{0.509988666f, 0.786877513f},
-std::array<float,2>{0.46873647f, 0.105490915f},
-std::array<float,2>{0.162359819f, 0.829221666f},
-std::array<float,2>{0.788505554f, 0.0107367691f},
-std::array<float,2>{0.744908154f, 0.549052656f},
-std::array<float,2>{0.250140756f, 0.487009615f},
-std::array<float,2>{0.391138732f, 0.731220186f},
-std::array<float,2>{0.577060699f, 0.304722786f},
-std::array<float,2>{0.896674454f, 0.88129127f},
-std::array<float,2>{0.0822320208f, 0.196726382f},
-std::array<float,2>{0.477795154f, 0.757338107f},
-std::array<float,2>{0.543094516f, 0.0681862906f},
-std::array<float,2>{0.96889925f, 0.600638986f},
-std::array<float,2>{0.0128155155f, 0.376515687f},
-std::array<float,2>{0.231440693f, 0.677608669f},
-std::array<float,2>{0.864232838f, 0.374658972f},
-std::array<float,2>{0.651722074f, 0.98256427f},
-std::array<float,2>{0.364934832f, 0.140723586f},
-std::array<float,2>{0.0988440812f, 0.93474108f},
-std::array<float,2>{0.920990169f, 0.231941149f},
-std::array<float,2>{0.623506308f, 0.71042341f},
-std::array<float,2>{0.420991391f, 0.257628024f},
-std::array<float,2>{0.285214365f, 0.510353088f},
-std::array<float,2>{0.710032225f, 0.452186316f},
-std::array<float,2>{0.75807941f, 0.844988644f},
-std::array<float,2>{0.148255527f, 0.0537303016f},
-std::array<float,2>{0.345989406f, 0.853858531f},
-std::array<float,2>{0.626493335f, 0.0595841557f},
-std::array<float,2>{0.84786135f, 0.50693506f},
-std::array<float,2>{0.234761298f, 0.440192342f},
-std::array<float,2>{0.0183167681f, 0.712521374f},
-std::array<float,2>{0.996576965f, 0.259662002f},
-std::array<float,2>{0.560844481f, 0.924545288f},
-std::array<float,2>{0.490323246f, 0.223320603f},
-std::array<float,2>{0.131494612f, 0.973003149f},
-std::array<float,2>{0.767474115f, 0.154113814f},
-std::array<float,2>{0.69961983f, 0.679908633f},
-std::array<float,2>{0.299268574f, 0.361293584f},
-std::array<float,2>{0.421905428f, 0.602506816f},
-std::array<float,2>{0.600953639f, 0.385048062f},
-std::array<float,2>{0.93117249f, 0.760219872f},
-std::array<float,2>{0.110659011f, 0.0757055208f},
-std::array<float,2>{0.438279361f, 0.88764441f},
-std::array<float,2>{0.531102657f, 0.19230333f},
-std::array<float,2>{0.941955328f, 0.721234977f},
-std::array<float,2>{0.034868706f, 0.303399295f},
-std::array<float,2>{0.201148048f, 0.559167981f},
-std::array<float,2>{0.833424091f, 0.49436453f},
-std::array<float,2>{0.679120958f, 0.841750622f},
-std::array<float,2>{0.341905177f, 0.0011233557f},
-std::array<float,2>{0.0634809211f, 0.794665575f},
-std::array<float,2>{0.889205873f, 0.100371368f},
-std::array<float,2>{0.587854683f, 0.567130983f},
-std::array<float,2>{0.379992455f, 0.40714696f},
-std::array<float,2>{0.278434336f, 0.644759119f},
-std::array<float,2>{0.734000325f, 0.343192786f},
-std::array<float,2>{0.806569755f, 0.938861191f},
-std::array<float,2>{0.182580918f, 0.163003609f},
-std::array<float,2>{0.2851215f, 0.959584773f},
-std::array<float,2>{0.705439985f, 0.173869565f},
-std::array<float,2>{0.76350075f, 0.632869542f},
-std::array<float,2>{0.143801972f, 0.321017325f},
-std::array<float,2>{0.0963638723f, 0.585973501f},
-std::array<float,2>{0.914791584f, 0.437186927f},
-std::array<float,2>{0.617267132f, 0.806663156f},
-std::array<float,2>{0.415430903f, 0.124849454f},
-std::array<float,2>{0.230440512f, 0.814357042f},
-std::array<float,2>{0.860949814f, 0.0231765788f},
-std::array<float,2>{0.65530163f, 0.542150557f},
-std::array<float,2>{0.362999231f, 0.472986102f},
-std::array<float,2>{0.481995612f, 0.735114276f},
-std::array<float,2>{0.54125607f, 0.282928973f},
-std::array<float,2>{0.974925101f, 0.90339607f},
-std::array<float,2>{0.00832588598f, 0.216733754f},
-std::array<float,2>{0.396668464f, 0.775663137f},
-std::array<float,2>{0.57064122f, 0.0902441889f},
-std::array<float,2>{0.894094348f, 0.620133519f},
-std::array<float,2>{0.0814927444f, 0.399708331f},
-std::array<float,2>{0.156866446f, 0.669342637f},
-std::array<float,2>{0.78256166f, 0.352525383f},
-std::array<float,2>{0.748993397f, 0.991616011f},
-std::array<float,2>{0.254739672f, 0.129139006f},
-std::array<float,2>{0.0546132661f, 0.91897136f},
-std::array<float,2>{0.967098594f, 0.241436109f},
-std::array<float,2>{0.515181005f, 0.690510035f},
-std::array<float,2>{0.462553799f, 0.272314459f},
-std::array<float,2>{0.318139791f, 0.524335802f},
-std::array<float,2>{0.663407207f, 0.46414122f},
-std::array<float,2>{0.82004118f, 0.860291839f},
-std::array<float,2>{0.212744579f, 0.039665442f},
-std::array<float,2>{0.265524626f, 0.799846411f},
-std::array<float,2>{0.738798559f, 0.113957129f},
-std::array<float,2>{0.793535888f, 0.585214496f},
-std::array<float,2>{0.164497778f, 0.426652074f},
-std::array<float,2>{0.0937463865f, 0.631432354f},
-std::array<float,2>{0.903809845f, 0.319511622f},
-std::array<float,2>{0.565295875f, 0.966273248f},
-std::array<float,2>{0.399530709f, 0.184352353f},
-std::array<float,2>{0.209905162f, 0.891784668f},
-std::array<float,2>{0.82673943f, 0.204847187f},
-std::array<float,2>{0.67062974f, 0.746640086f},
-std::array<float,2>{0.324777663f, 0.290157974f},
-std::array<float,2>{0.459560245f, 0.538483024f},
-std::array<float,2>{0.50272876f, 0.477509826f},
-std::array<float,2>{0.959532142f, 0.826108575f},
-std::array<float,2>{0.0589976385f, 0.0254737213f},
-std::array<float,2>{0.410098672f, 0.996727049f},
-std::array<float,2>{0.616520643f, 0.138007447f},
-std::array<float,2>{0.907424152f, 0.659666657f},
-std::array<float,2>{0.10936702f, 0.345297039f},
-std::array<float,2>{0.15104863f, 0.615698338f},
-std::array<float,2>{0.756686509f, 0.39077273f},
-std::array<float,2>{0.717213631f, 0.769616425f},
-std::array<float,2>{0.296109766f, 0.0844057724f},
-std::array<float,2>{0.00269181211f, 0.869947553f},
-std::array<float,2>{0.980955184f, 0.033302106f},
-std::array<float,2>{0.538078129f, 0.521444678f},
-std::array<float,2>{0.469945818f, 0.457155317f},
-std::array<float,2>{0.368021578f, 0.702984214f},
-std::array<float,2>{0.648144901f, 0.275083631f},
-std::array<float,2>{0.873285353f, 0.913454354f},
-std::array<float,2>{0.220410019f, 0.245986566f},
-std::array<float,2>{0.328877479f, 0.930047393f},
-std::array<float,2>{0.684072137f, 0.23036842f},
-std::array<float,2>{0.837783337f, 0.705543756f},
-std::array<float,2>{0.192718446f, 0.252807319f},
-std::array<float,2>{0.0467026867f, 0.512024879f},
-std::array<float,2>{0.951885641f, 0.447587281f},
-std::array<float,2>{0.51808244f, 0.848711073f},
-std::array<float,2>{0.448817074f, 0.0504778214f},
-std::array<float,2>{0.175692588f, 0.753549993f},
-std::array<float,2>{0.804388523f, 0.0639461055f},
-std::array<float,2>{0.721598327f, 0.595775545f},
-std::array<float,2>{0.272964269f, 0.381211519f},
-std::array<float,2>{0.389353126f, 0.673265576f},
-std::array<float,2>{0.579371572f, 0.3680318f},
-std::array<float,2>{0.881615579f, 0.97817868f},
-std::array<float,2>{0.0738640428f, 0.145337313f},
-std::array<float,2>{0.494764268f, 0.83352983f},
-std::array<float,2>{0.547864318f, 0.0145932017f},
-std::array<float,2>{0.985759258f, 0.553542793f},
-std::array<float,2>{0.0301326402f, 0.492029011f},
-std::array<float,2>{0.248967215f, 0.726956904f},
-std::array<float,2>{0.856537282f, 0.311381578f},
-std::array<float,2>{0.63729167f, 0.875276089f},
-std::array<float,2>{0.352858275f, 0.202467486f},
-std::array<float,2>{0.119138047f, 0.952548683f},
-std::array<float,2>{0.928100884f, 0.170642689f},
-std::array<float,2>{0.608246028f, 0.650461435f},
-std::array<float,2>{0.437087893f, 0.331781775f},
-std::array<float,2>{0.309465826f, 0.574978292f},
-std::array<float,2>{0.694990873f, 0.414678723f},
-std::array<float,2>{0.776617825f, 0.783460796f},
-std::array<float,2>{0.134773865f, 0.102883399f},
-std::array<float,2>{0.321447223f, 0.762670159f},
-std::array<float,2>{0.664603174f, 0.0712541044f},
-std::array<float,2>{0.823245347f, 0.606480062f},
-std::array<float,2>{0.203226611f, 0.389621645f},
-std::array<float,2>{0.0551735125f, 0.685172856f},
-std::array<float,2>{0.956029058f, 0.364964545f},
-std::array<float,2>{0.506655931f, 0.972199321f},
-std::array<float,2>{0.454457343f, 0.148583815f},
-std::array<float,2>{0.170289904f, 0.929622829f},
-std::array<float,2>{0.790291607f, 0.222315535f},
-std::array<float,2>{0.735166013f, 0.715209782f},
-std::array<float,2>{0.259953499f, 0.265197933f},
-std::array<float,2>{0.404289603f, 0.501747489f},
-std::array<float,2>{0.569001257f, 0.443170756f},
-std::array<float,2>{0.900059581f, 0.857699275f},
-std::array<float,2>{0.0882983953f, 0.0582065545f},
-std::array<float,2>{0.473229766f, 0.943956375f},
-std::array<float,2>{0.531644762f, 0.157039627f},
-std::array<float,2>{0.979577899f, 0.641868711f},
-std::array<float,2>{0.00702434406f, 0.337167621f},
-std::array<float,2>{0.223643988f, 0.563816607f},
-std::array<float,2>{0.870438457f, 0.411014855f},
-std::array<float,2>{0.641755164f, 0.790017068f},
-std::array<float,2>{0.373277843f, 0.0962181687f},
-std::array<float,2>{0.105380319f, 0.836010337f},
-std::array<float,2>{0.911950767f, 0.00654683774f},
-std::array<float,2>{0.610407412f, 0.555304289f},
-std::array<float,2>{0.411301672f, 0.498267114f},
-std::array<float,2>{0.292676657f, 0.726139486f},
-std::array<float,2>{0.712589979f, 0.297769159f},
-std::array<float,2>{0.750653505f, 0.886522293f},
-std::array<float,2>{0.155364498f, 0.18768011f},
-std::array<float,2>{0.266029686f, 0.900304615f},
-std::array<float,2>{0.724215627f, 0.213382617f},
-std::array<float,2>{0.797753453f, 0.738852441f},
-std::array<float,2>{0.178280607f, 0.285714924f},
-std::array<float,2>{0.0769725516f, 0.545464873f},
-std::array<float,2>{0.875425637f, 0.471984565f},
-std::array<float,2>{0.585770547f, 0.81724292f},
-std::array<float,2>{0.385903716f, 0.0184802115f},
-std::array<float,2>{0.190112293f, 0.808682501f},
-std::array<float,2>{0.842388511f, 0.117639616f},
-std::array<float,2>{0.683229566f, 0.590344846f},
-std::array<float,2>{0.334251851f, 0.43045342f},
-std::array<float,2>{0.452678174f, 0.637961447f},
-std::array<float,2>{0.520510018f, 0.32459569f},
-std::array<float,2>{0.945836961f, 0.954262793f},
-std::array<float,2>{0.0411096178f, 0.176796183f},
-std::array<float,2>{0.431381404f, 0.866784155f},
-std::array<float,2>{0.605372906f, 0.0464379601f},
-std::array<float,2>{0.922231495f, 0.531117737f},
-std::array<float,2>{0.123304375f, 0.465733767f},
-std::array<float,2>{0.137276113f, 0.691809893f},
-std::array<float,2>{0.777430296f, 0.265833527f},
-std::array<float,2>{0.687832713f, 0.914792776f},
-std::array<float,2>{0.305549651f, 0.237956986f},
-std::array<float,2>{0.0253415816f, 0.985962093f},
-std::array<float,2>{0.989283144f, 0.126456112f},
-std::array<float,2>{0.554554641f, 0.664140701f},
-std::array<float,2>{0.498052597f, 0.356907398f},
-std::array<float,2>{0.358739406f, 0.621276855f},
-std::array<float,2>{0.635959566f, 0.403279841f},
-std::array<float,2>{0.852027178f, 0.77790767f},
-std::array<float,2>{0.245524421f, 0.0864707679f},
-std::array<float,2>{0.302224725f, 0.821668446f},
-std::array<float,2>{0.698933661f, 0.030263897f},
-std::array<float,2>{0.771161139f, 0.534148335f},
-std::array<float,2>{0.125301048f, 0.483203322f},
-std::array<float,2>{0.1135111f, 0.744682074f},
-std::array<float,2>{0.934975922f, 0.293726295f},
-std::array<float,2>{0.597348809f, 0.897520244f},
-std::array<float,2>{0.428474605f, 0.209903777f},
-std::array<float,2>{0.241141811f, 0.961516142f},
-std::array<float,2>{0.845067859f, 0.181601927f},
-std::array<float,2>{0.632546782f, 0.627048135f},
-std::array<float,2>{0.349756926f, 0.315642685f},
-std::array<float,2>{0.485454917f, 0.580541492f},
-std::array<float,2>{0.55642885f, 0.425431848f},
-std::array<float,2>{0.995272934f, 0.802527428f},
-std::array<float,2>{0.022330245f, 0.112333767f},
-std::array<float,2>{0.376687437f, 0.908426881f},
-std::array<float,2>{0.593569636f, 0.247886032f},
-std::array<float,2>{0.886686683f, 0.697121859f},
-std::array<float,2>{0.0679114684f, 0.278983027f},
-std::array<float,2>{0.184668913f, 0.517905056f},
-std::array<float,2>{0.810258925f, 0.456522644f},
-std::array<float,2>{0.728635907f, 0.872418463f},
-std::array<float,2>{0.275823772f, 0.038007658f},
-std::array<float,2>{0.0361656174f, 0.767929196f},
-std::array<float,2>{0.937622845f, 0.0782378837f},
-std::array<float,2>{0.526205361f, 0.60939008f},
-std::array<float,2>{0.445224643f, 0.397271037f},
-std::array<float,2>{0.337056309f, 0.66374594f},
-std::array<float,2>{0.675603211f, 0.348086238f},
-std::array<float,2>{0.831909239f, 0.994148076f},
-std::array<float,2>{0.196092978f, 0.13375406f},
-std::array<float,2>{0.366951108f, 0.982298851f},
-std::array<float,2>{0.648935556f, 0.14296937f},
-std::array<float,2>{0.86569494f, 0.678182364f},
-std::array<float,2>{0.232851148f, 0.372511983f},
-std::array<float,2>{0.0136904316f, 0.597811162f},
-std::array<float,2>{0.972623944f, 0.377311498f},
-std::array<float,2>{0.545010507f, 0.754499078f},
-std::array<float,2>{0.479356349f, 0.0697932988f},
-std::array<float,2>{0.146147758f, 0.845766544f},
-std::array<float,2>{0.760236859f, 0.0526736826f},
-std::array<float,2>{0.707064748f, 0.509297252f},
-std::array<float,2>{0.287614763f, 0.449953735f},
-std::array<float,2>{0.418842942f, 0.708290279f},
-std::array<float,2>{0.622818053f, 0.254774451f},
-std::array<float,2>{0.91971302f, 0.936805725f},
-std::array<float,2>{0.100790508f, 0.233703002f},
-std::array<float,2>{0.465373784f, 0.7888363f},
-std::array<float,2>{0.509182692f, 0.107428215f},
-std::array<float,2>{0.964460671f, 0.571042717f},
-std::array<float,2>{0.0487179272f, 0.420223355f},
-std::array<float,2>{0.214919746f, 0.655879796f},
-std::array<float,2>{0.816404998f, 0.335204154f},
-std::array<float,2>{0.65939641f, 0.945697546f},
-std::array<float,2>{0.315298796f, 0.164713994f},
-std::array<float,2>{0.0844760761f, 0.880210817f},
-std::array<float,2>{0.896156669f, 0.197908506f},
-std::array<float,2>{0.575244367f, 0.733649611f},
-std::array<float,2>{0.394530058f, 0.307686925f},
-std::array<float,2>{0.252581745f, 0.547961831f},
-std::array<float,2>{0.743810058f, 0.485469609f},
-std::array<float,2>{0.786477625f, 0.830894113f},
-std::array<float,2>{0.160485804f, 0.00913411006f},
-std::array<float,2>{0.318590581f, 0.860758007f},
-std::array<float,2>{0.66044116f, 0.0402910002f},
-std::array<float,2>{0.817047238f, 0.524949133f},
-std::array<float,2>{0.213767454f, 0.463170499f},
-std::array<float,2>{0.0511160679f, 0.689910352f},
-std::array<float,2>{0.966454506f, 0.273025155f},
-std::array<float,2>{0.512695134f, 0.918335438f},
-std::array<float,2>{0.462915897f, 0.240524217f},
-std::array<float,2>{0.15983367f, 0.990421236f},
-std::array<float,2>{0.783698738f, 0.130535483f},
-std::array<float,2>{0.747439623f, 0.668824375f},
-std::array<float,2>{0.256229013f, 0.353157938f},
-std::array<float,2>{0.396166414f, 0.61916393f},
-std::array<float,2>{0.573260009f, 0.398806781f},
-std::array<float,2>{0.891306043f, 0.777098179f},
-std::array<float,2>{0.0792400911f, 0.0911554471f},
-std::array<float,2>{0.48358193f, 0.902564466f},
-std::array<float,2>{0.540259838f, 0.215069205f},
-std::array<float,2>{0.973060012f, 0.735923886f},
-std::array<float,2>{0.0113323601f, 0.281666636f},
-std::array<float,2>{0.227494106f, 0.541200399f},
-std::array<float,2>{0.861785114f, 0.474434704f},
-std::array<float,2>{0.653916538f, 0.813050807f},
-std::array<float,2>{0.360582054f, 0.0218979474f},
-std::array<float,2>{0.0955011025f, 0.8077389f},
-std::array<float,2>{0.916072547f, 0.123236306f},
-std::array<float,2>{0.620257676f, 0.58731699f},
-std::array<float,2>{0.417711467f, 0.435842335f},
-std::array<float,2>{0.282552958f, 0.634239256f},
-std::array<float,2>{0.704164147f, 0.322053224f},
-std::array<float,2>{0.765603125f, 0.960299075f},
-std::array<float,2>{0.14066352f, 0.175182521f},
-std::array<float,2>{0.280493945f, 0.937819481f},
-std::array<float,2>{0.732299626f, 0.163233638f},
-std::array<float,2>{0.808559239f, 0.645653188f},
-std::array<float,2>{0.18130672f, 0.342262208f},
-std::array<float,2>{0.0653133616f, 0.568297207f},
-std::array<float,2>{0.887066424f, 0.407358736f},
-std::array<float,2>{0.589743316f, 0.793026567f},
-std::array<float,2>{0.381461382f, 0.100935131f},
-std::array<float,2>{0.202005357f, 0.840405107f},
-std::array<float,2>{0.835181534f, 0.000155084708f},
-std::array<float,2>{0.67703259f, 0.560321152f},
-std::array<float,2>{0.341326505f, 0.495943755f},
-std::array<float,2>{0.440873265f, 0.722561479f},
-std::array<float,2>{0.529230773f, 0.304004908f},
-std::array<float,2>{0.944025815f, 0.888102412f},
-std::array<float,2>{0.0313203558f, 0.192700073f},
-std::array<float,2>{0.4254058f, 0.76093483f},
-std::array<float,2>{0.597999513f, 0.0742606968f},
-std::array<float,2>{0.933068693f, 0.602973998f},
-std::array<float,2>{0.112694107f, 0.386064023f},
-std::array<float,2>{0.12923713f, 0.681220949f},
-std::array<float,2>{0.76853776f, 0.360327661f},
-std::array<float,2>{0.702809036f, 0.974291265f},
-std::array<float,2>{0.297918588f, 0.152723595f},
-std::array<float,2>{0.0172702782f, 0.92560029f},
-std::array<float,2>{0.998306096f, 0.224600211f},
-std::array<float,2>{0.558652222f, 0.711001277f},
-std::array<float,2>{0.490050614f, 0.258491516f},
-std::array<float,2>{0.344660103f, 0.50644362f},
-std::array<float,2>{0.62730062f, 0.441187859f},
-std::array<float,2>{0.851107776f, 0.855212152f},
-std::array<float,2>{0.236615539f, 0.0591729879f},
-std::array<float,2>{0.311904967f, 0.784193575f},
-std::array<float,2>{0.692483842f, 0.101705439f},
-std::array<float,2>{0.77429074f, 0.576043546f},
-std::array<float,2>{0.134489149f, 0.415470541f},
-std::array<float,2>{0.120642789f, 0.651481986f},
-std::array<float,2>{0.92666167f, 0.330719709f},
-std::array<float,2>{0.607004285f, 0.951610148f},
-std::array<float,2>{0.433902919f, 0.171511203f},
-std::array<float,2>{0.247330338f, 0.876801252f},
-std::array<float,2>{0.859168172f, 0.201255441f},
-std::array<float,2>{0.639240205f, 0.728277087f},
-std::array<float,2>{0.354843676f, 0.31196335f},
-std::array<float,2>{0.493588954f, 0.553982496f},
-std::array<float,2>{0.549203038f, 0.490956187f},
-std::array<float,2>{0.986699879f, 0.832476437f},
-std::array<float,2>{0.0281522479f, 0.0147864027f},
-std::array<float,2>{0.386855811f, 0.977359831f},
-std::array<float,2>{0.580619872f, 0.145667017f},
-std::array<float,2>{0.880287826f, 0.672154188f},
-std::array<float,2>{0.0706539378f, 0.368776619f},
-std::array<float,2>{0.173339173f, 0.597610414f},
-std::array<float,2>{0.802103639f, 0.382561833f},
-std::array<float,2>{0.718930364f, 0.75277406f},
-std::array<float,2>{0.270963818f, 0.0632437021f},
-std::array<float,2>{0.0435547419f, 0.848525941f},
-std::array<float,2>{0.95066756f, 0.0490400642f},
-std::array<float,2>{0.516336501f, 0.512786865f},
-std::array<float,2>{0.446250767f, 0.448818833f},
-std::array<float,2>{0.331373602f, 0.706473172f},
-std::array<float,2>{0.686011672f, 0.253091604f},
-std::array<float,2>{0.839722395f, 0.930832922f},
-std::array<float,2>{0.194796443f, 0.228730038f},
-std::array<float,2>{0.370083988f, 0.912172019f},
-std::array<float,2>{0.646321416f, 0.244831279f},
-std::array<float,2>{0.871313572f, 0.701993644f},
-std::array<float,2>{0.221112117f, 0.274114251f},
-std::array<float,2>{0.000188259772f, 0.519773483f},
-std::array<float,2>{0.983478487f, 0.458471566f},
-std::array<float,2>{0.536347389f, 0.870956421f},
-std::array<float,2>{0.471495092f, 0.0342053808f},
-std::array<float,2>{0.149223462f, 0.770628095f},
-std::array<float,2>{0.754359424f, 0.0856490657f},
-std::array<float,2>{0.715881646f, 0.616300106f},
-std::array<float,2>{0.294402093f, 0.391990393f},
-std::array<float,2>{0.407431722f, 0.658667564f},
-std::array<float,2>{0.613636374f, 0.343859762f},
-std::array<float,2>{0.908203125f, 0.997992337f},
-std::array<float,2>{0.107063949f, 0.13718684f},
-std::array<float,2>{0.457767189f, 0.824865341f},
-std::array<float,2>{0.501335621f, 0.0268892795f},
-std::array<float,2>{0.957697451f, 0.537254393f},
-std::array<float,2>{0.0621038675f, 0.478250861f},
-std::array<float,2>{0.207199037f, 0.747417986f},
-std::array<float,2>{0.82533741f, 0.289321929f},
-std::array<float,2>{0.669146895f, 0.891206503f},
-std::array<float,2>{0.327760786f, 0.203766122f},
-std::array<float,2>{0.0909356624f, 0.965429723f},
-std::array<float,2>{0.905282676f, 0.185353696f},
-std::array<float,2>{0.562949479f, 0.632300317f},
-std::array<float,2>{0.400736481f, 0.31867981f},
-std::array<float,2>{0.261776626f, 0.584820092f},
-std::array<float,2>{0.741285682f, 0.427540421f},
-std::array<float,2>{0.796190083f, 0.799247146f},
-std::array<float,2>{0.167650267f, 0.115169346f},
-std::array<float,2>{0.356935412f, 0.778588176f},
-std::array<float,2>{0.634764671f, 0.0870409906f},
-std::array<float,2>{0.854771435f, 0.622998416f},
-std::array<float,2>{0.244050607f, 0.404074401f},
-std::array<float,2>{0.0264633875f, 0.665989041f},
-std::array<float,2>{0.991580904f, 0.356327564f},
-std::array<float,2>{0.551683903f, 0.984592438f},
-std::array<float,2>{0.496681541f, 0.125388637f},
-std::array<float,2>{0.138755709f, 0.915580392f},
-std::array<float,2>{0.780342579f, 0.236804798f},
-std::array<float,2>{0.691242754f, 0.69295305f},
-std::array<float,2>{0.307373881f, 0.267113686f},
-std::array<float,2>{0.43311727f, 0.529747844f},
-std::array<float,2>{0.602914453f, 0.466194063f},
-std::array<float,2>{0.924898803f, 0.865870178f},
-std::array<float,2>{0.123028621f, 0.0457894094f},
-std::array<float,2>{0.450894088f, 0.953129768f},
-std::array<float,2>{0.522492528f, 0.176579908f},
-std::array<float,2>{0.948037863f, 0.637665868f},
-std::array<float,2>{0.0398774445f, 0.325971723f},
-std::array<float,2>{0.188611299f, 0.591155887f},
-std::array<float,2>{0.840384185f, 0.431144208f},
-std::array<float,2>{0.680283785f, 0.810373545f},
-std::array<float,2>{0.332359433f, 0.11907836f},
-std::array<float,2>{0.0749241039f, 0.817950308f},
-std::array<float,2>{0.877263188f, 0.0194913521f},
-std::array<float,2>{0.583759308f, 0.545972049f},
-std::array<float,2>{0.38413012f, 0.471578449f},
-std::array<float,2>{0.268909782f, 0.739819527f},
-std::array<float,2>{0.725230336f, 0.286683857f},
-std::array<float,2>{0.799156725f, 0.899239302f},
-std::array<float,2>{0.17616491f, 0.214617252f},
-std::array<float,2>{0.2895962f, 0.885193169f},
-std::array<float,2>{0.71334666f, 0.188821033f},
-std::array<float,2>{0.752519965f, 0.72514081f},
-std::array<float,2>{0.154128939f, 0.298423558f},
-std::array<float,2>{0.102006756f, 0.556297779f},
-std::array<float,2>{0.912922859f, 0.499277949f},
-std::array<float,2>{0.612086654f, 0.837564051f},
-std::array<float,2>{0.413776845f, 0.00705852127f},
-std::array<float,2>{0.225683883f, 0.790559113f},
-std::array<float,2>{0.868191302f, 0.0968298465f},
-std::array<float,2>{0.643840849f, 0.56308949f},
-std::array<float,2>{0.372494996f, 0.411396116f},
-std::array<float,2>{0.475175589f, 0.641330063f},
-std::array<float,2>{0.534510791f, 0.336561173f},
-std::array<float,2>{0.977558374f, 0.944880009f},
-std::array<float,2>{0.00407255115f, 0.157944918f},
-std::array<float,2>{0.404786617f, 0.859115958f},
-std::array<float,2>{0.567144275f, 0.0570910312f},
-std::array<float,2>{0.901859581f, 0.50087887f},
-std::array<float,2>{0.0877971724f, 0.441688776f},
-std::array<float,2>{0.168656111f, 0.716769814f},
-std::array<float,2>{0.792597115f, 0.264129698f},
-std::array<float,2>{0.73766917f, 0.927815855f},
-std::array<float,2>{0.25858438f, 0.221096516f},
-std::array<float,2>{0.0575081967f, 0.971077442f},
-std::array<float,2>{0.953317046f, 0.149811387f},
-std::array<float,2>{0.505011559f, 0.684173882f},
-std::array<float,2>{0.457020998f, 0.364151537f},
-std::array<float,2>{0.322344512f, 0.605826497f},
-std::array<float,2>{0.667905569f, 0.389984339f},
-std::array<float,2>{0.821098149f, 0.762844026f},
-std::array<float,2>{0.206450313f, 0.0716928691f},
-std::array<float,2>{0.25110653f, 0.831725538f},
-std::array<float,2>{0.745950103f, 0.00807587802f},
-std::array<float,2>{0.787959635f, 0.547636926f},
-std::array<float,2>{0.163526893f, 0.484452128f},
-std::array<float,2>{0.083094798f, 0.732540309f},
-std::array<float,2>{0.897841096f, 0.307386935f},
-std::array<float,2>{0.57758075f, 0.879493892f},
-std::array<float,2>{0.391909838f, 0.198730633f},
-std::array<float,2>{0.218719631f, 0.946296215f},
-std::array<float,2>{0.814424396f, 0.165367231f},
-std::array<float,2>{0.657749176f, 0.655169308f},
-std::array<float,2>{0.313898146f, 0.334475636f},
-std::array<float,2>{0.467117012f, 0.571495712f},
-std::array<float,2>{0.510965586f, 0.421668202f},
-std::array<float,2>{0.962616444f, 0.787653625f},
-std::array<float,2>{0.0499230511f, 0.108968653f},
-std::array<float,2>{0.420412987f, 0.936079741f},
-std::array<float,2>{0.624983251f, 0.233041868f},
-std::array<float,2>{0.920039952f, 0.707576275f},
-std::array<float,2>{0.0985327289f, 0.255296975f},
-std::array<float,2>{0.147251531f, 0.508032382f},
-std::array<float,2>{0.759136319f, 0.450710803f},
-std::array<float,2>{0.70951426f, 0.847440183f},
-std::array<float,2>{0.28698948f, 0.0508893244f},
-std::array<float,2>{0.0126247462f, 0.755247116f},
-std::array<float,2>{0.969865561f, 0.0684769526f},
-std::array<float,2>{0.544913948f, 0.599038541f},
-std::array<float,2>{0.476726621f, 0.378847688f},
-std::array<float,2>{0.364100188f, 0.678934455f},
-std::array<float,2>{0.651350498f, 0.371177346f},
-std::array<float,2>{0.864635706f, 0.981315851f},
-std::array<float,2>{0.232410029f, 0.143919036f},
-std::array<float,2>{0.339443564f, 0.995459318f},
-std::array<float,2>{0.672198892f, 0.134095907f},
-std::array<float,2>{0.828322649f, 0.662519872f},
-std::array<float,2>{0.19896172f, 0.349089473f},
-std::array<float,2>{0.0372265428f, 0.61087966f},
-std::array<float,2>{0.940994859f, 0.398097605f},
-std::array<float,2>{0.524228394f, 0.769218802f},
-std::array<float,2>{0.441965371f, 0.079245016f},
-std::array<float,2>{0.185844228f, 0.87173003f},
-std::array<float,2>{0.811823905f, 0.0387621298f},
-std::array<float,2>{0.727368355f, 0.518580377f},
-std::array<float,2>{0.274166346f, 0.45575282f},
-std::array<float,2>{0.378490061f, 0.695692003f},
-std::array<float,2>{0.590440452f, 0.278059125f},
-std::array<float,2>{0.884092987f, 0.909662724f},
-std::array<float,2>{0.0698376521f, 0.246229231f},
-std::array<float,2>{0.4871234f, 0.801139832f},
-std::array<float,2>{0.557426989f, 0.112002403f},
-std::array<float,2>{0.99220109f, 0.581978321f},
-std::array<float,2>{0.0202350896f, 0.424504936f},
-std::array<float,2>{0.239217862f, 0.628107011f},
-std::array<float,2>{0.846274197f, 0.315233856f},
-std::array<float,2>{0.630349278f, 0.962332129f},
-std::array<float,2>{0.349467456f, 0.179732159f},
-std::array<float,2>{0.116643898f, 0.897368193f},
-std::array<float,2>{0.935865521f, 0.210830212f},
-std::array<float,2>{0.594146013f, 0.745904088f},
-std::array<float,2>{0.426366955f, 0.294848591f},
-std::array<float,2>{0.30312711f, 0.53460604f},
-std::array<float,2>{0.695705771f, 0.484174162f},
-std::array<float,2>{0.773423493f, 0.820332229f},
-std::array<float,2>{0.127949178f, 0.0308598112f},
-std::array<float,2>{0.361594468f, 0.814673007f},
-std::array<float,2>{0.654973388f, 0.0197384786f},
-std::array<float,2>{0.859943569f, 0.539071381f},
-std::array<float,2>{0.229198188f, 0.475919634f},
-std::array<float,2>{0.00926188286f, 0.73708427f},
-std::array<float,2>{0.975722134f, 0.283498645f},
-std::array<float,2>{0.54238224f, 0.905222774f},
-std::array<float,2>{0.480478704f, 0.217473313f},
-std::array<float,2>{0.142857f, 0.95824194f},
-std::array<float,2>{0.762310803f, 0.171909317f},
-std::array<float,2>{0.70682478f, 0.635463953f},
-std::array<float,2>{0.283913791f, 0.324062228f},
-std::array<float,2>{0.41427204f, 0.588795304f},
-std::array<float,2>{0.618320525f, 0.434003323f},
-std::array<float,2>{0.915938973f, 0.804710209f},
-std::array<float,2>{0.097209774f, 0.12283282f},
-std::array<float,2>{0.46157667f, 0.92089057f},
-std::array<float,2>{0.513745308f, 0.238760039f},
-std::array<float,2>{0.968701541f, 0.687814713f},
-std::array<float,2>{0.0529892184f, 0.270559877f},
-std::array<float,2>{0.211490303f, 0.526595294f},
-std::array<float,2>{0.818724692f, 0.46276924f},
-std::array<float,2>{0.662903666f, 0.861774385f},
-std::array<float,2>{0.316548437f, 0.0422431827f},
-std::array<float,2>{0.0809491724f, 0.774258077f},
-std::array<float,2>{0.892646849f, 0.0919678658f},
-std::array<float,2>{0.571354032f, 0.617439628f},
-std::array<float,2>{0.397782356f, 0.40158385f},
-std::array<float,2>{0.255409062f, 0.671762943f},
-std::array<float,2>{0.749396324f, 0.354523271f},
-std::array<float,2>{0.78212589f, 0.989016235f},
-std::array<float,2>{0.158083603f, 0.130911574f},
-std::array<float,2>{0.299823433f, 0.975620806f},
-std::array<float,2>{0.700700045f, 0.155871123f},
-std::array<float,2>{0.766367614f, 0.682824433f},
-std::array<float,2>{0.132472411f, 0.361619025f},
-std::array<float,2>{0.109702185f, 0.604540884f},
-std::array<float,2>{0.930079639f, 0.382824033f},
-std::array<float,2>{0.600052476f, 0.759642363f},
-std::array<float,2>{0.4234218f, 0.0769442245f},
-std::array<float,2>{0.235384136f, 0.853350699f},
-std::array<float,2>{0.84879303f, 0.0607378632f},
-std::array<float,2>{0.625745833f, 0.504692376f},
-std::array<float,2>{0.347559571f, 0.438275397f},
-std::array<float,2>{0.491237789f, 0.714251995f},
-std::array<float,2>{0.561893225f, 0.259872168f},
-std::array<float,2>{0.997081578f, 0.923030198f},
-std::array<float,2>{0.0192147736f, 0.226282611f},
-std::array<float,2>{0.379051387f, 0.795048952f},
-std::array<float,2>{0.586888969f, 0.0992719531f},
-std::array<float,2>{0.890096009f, 0.569708347f},
-std::array<float,2>{0.0627787784f, 0.40880844f},
-std::array<float,2>{0.182893738f, 0.646597087f},
-std::array<float,2>{0.805233061f, 0.341192722f},
-std::array<float,2>{0.73257792f, 0.940147817f},
-std::array<float,2>{0.277748764f, 0.160825893f},
-std::array<float,2>{0.0335401259f, 0.888917923f},
-std::array<float,2>{0.942472935f, 0.193671182f},
-std::array<float,2>{0.530212402f, 0.720633328f},
-std::array<float,2>{0.439350992f, 0.301100791f},
-std::array<float,2>{0.34373793f, 0.562307477f},
-std::array<float,2>{0.678060293f, 0.492619812f},
-std::array<float,2>{0.832707822f, 0.84319067f},
-std::array<float,2>{0.199849769f, 0.0034075093f},
-std::array<float,2>{0.272158086f, 0.750812232f},
-std::array<float,2>{0.72187686f, 0.0661347806f},
-std::array<float,2>{0.803331435f, 0.594782293f},
-std::array<float,2>{0.174019054f, 0.379079193f},
-std::array<float,2>{0.0726888627f, 0.675770521f},
-std::array<float,2>{0.882031798f, 0.370662957f},
-std::array<float,2>{0.578224421f, 0.979570508f},
-std::array<float,2>{0.38999474f, 0.146846175f},
-std::array<float,2>{0.192183599f, 0.932445109f},
-std::array<float,2>{0.836837292f, 0.227641359f},
-std::array<float,2>{0.684951425f, 0.705046833f},
-std::array<float,2>{0.329586059f, 0.251372218f},
-std::array<float,2>{0.447628051f, 0.514467895f},
-std::array<float,2>{0.519432366f, 0.447228223f},
-std::array<float,2>{0.952396631f, 0.850905359f},
-std::array<float,2>{0.0450679474f, 0.047697302f},
-std::array<float,2>{0.435861588f, 0.951117635f},
-std::array<float,2>{0.609068811f, 0.168535858f},
-std::array<float,2>{0.929057539f, 0.649200082f},
-std::array<float,2>{0.117504016f, 0.329527825f},
-std::array<float,2>{0.136598349f, 0.577131987f},
-std::array<float,2>{0.77569294f, 0.417043597f},
-std::array<float,2>{0.693930566f, 0.78257966f},
-std::array<float,2>{0.309859693f, 0.105228782f},
-std::array<float,2>{0.0312042516f, 0.834795177f},
-std::array<float,2>{0.985267937f, 0.0132686198f},
-std::array<float,2>{0.547298133f, 0.552689612f},
-std::array<float,2>{0.495494545f, 0.490196973f},
-std::array<float,2>{0.352446556f, 0.729220092f},
-std::array<float,2>{0.638248563f, 0.309630543f},
-std::array<float,2>{0.856289506f, 0.878227651f},
-std::array<float,2>{0.249405131f, 0.199391156f},
-std::array<float,2>{0.325902402f, 0.89322418f},
-std::array<float,2>{0.671213865f, 0.206494719f},
-std::array<float,2>{0.827151537f, 0.749441803f},
-std::array<float,2>{0.210732803f, 0.292020828f},
-std::array<float,2>{0.0599360839f, 0.53532052f},
-std::array<float,2>{0.960081995f, 0.479263484f},
-std::array<float,2>{0.502945483f, 0.827035606f},
-std::array<float,2>{0.460540503f, 0.0251046587f},
-std::array<float,2>{0.165795937f, 0.797023237f},
-std::array<float,2>{0.794022262f, 0.116836444f},
-std::array<float,2>{0.739801943f, 0.5825212f},
-std::array<float,2>{0.264082044f, 0.428149909f},
-std::array<float,2>{0.399363607f, 0.630289018f},
-std::array<float,2>{0.5658409f, 0.317435592f},
-std::array<float,2>{0.903133452f, 0.967908502f},
-std::array<float,2>{0.0926268622f, 0.186694548f},
-std::array<float,2>{0.469354063f, 0.868991494f},
-std::array<float,2>{0.53841579f, 0.0313025862f},
-std::array<float,2>{0.981567025f, 0.523237526f},
-std::array<float,2>{0.00320451381f, 0.459143072f},
-std::array<float,2>{0.219677627f, 0.70099628f},
-std::array<float,2>{0.87492305f, 0.276368797f},
-std::array<float,2>{0.64674896f, 0.91202873f},
-std::array<float,2>{0.369026542f, 0.242934272f},
-std::array<float,2>{0.108195119f, 0.998256564f},
-std::array<float,2>{0.906492531f, 0.139941365f},
-std::array<float,2>{0.615321934f, 0.657418251f},
-std::array<float,2>{0.408702433f, 0.34714824f},
-std::array<float,2>{0.295097381f, 0.613463283f},
-std::array<float,2>{0.718325555f, 0.394207537f},
-std::array<float,2>{0.757250249f, 0.772871971f},
-std::array<float,2>{0.151779413f, 0.0823944211f},
-std::array<float,2>{0.335298985f, 0.812473714f},
-std::array<float,2>{0.682150483f, 0.119573496f},
-std::array<float,2>{0.843636632f, 0.591946125f},
-std::array<float,2>{0.190632686f, 0.433145225f},
-std::array<float,2>{0.0423324518f, 0.640566468f},
-std::array<float,2>{0.94683677f, 0.32670182f},
-std::array<float,2>{0.520370483f, 0.955105662f},
-std::array<float,2>{0.451577514f, 0.179276049f},
-std::array<float,2>{0.179442406f, 0.900793195f},
-std::array<float,2>{0.798267722f, 0.212572232f},
-std::array<float,2>{0.723519266f, 0.74164629f},
-std::array<float,2>{0.267063767f, 0.287846208f},
-std::array<float,2>{0.385438859f, 0.543406665f},
-std::array<float,2>{0.584695637f, 0.469572186f},
-std::array<float,2>{0.876683772f, 0.820138276f},
-std::array<float,2>{0.0772249326f, 0.0159959476f},
-std::array<float,2>{0.499643832f, 0.988209724f},
-std::array<float,2>{0.553680241f, 0.128196582f},
-std::array<float,2>{0.98860836f, 0.666218162f},
-std::array<float,2>{0.0237735603f, 0.357528508f},
-std::array<float,2>{0.244974688f, 0.624503016f},
-std::array<float,2>{0.852934003f, 0.405445784f},
-std::array<float,2>{0.635216057f, 0.780761719f},
-std::array<float,2>{0.358011097f, 0.0879338235f},
-std::array<float,2>{0.124896422f, 0.864228129f},
-std::array<float,2>{0.923210323f, 0.0439991169f},
-std::array<float,2>{0.604473114f, 0.528679192f},
-std::array<float,2>{0.429795176f, 0.467653871f},
-std::array<float,2>{0.306604743f, 0.693532228f},
-std::array<float,2>{0.68943274f, 0.267936498f},
-std::array<float,2>{0.779168665f, 0.916655064f},
-std::array<float,2>{0.137965307f, 0.234442279f},
-std::array<float,2>{0.261441261f, 0.925801396f},
-std::array<float,2>{0.735562801f, 0.220162779f},
-std::array<float,2>{0.789536417f, 0.717327476f},
-std::array<float,2>{0.171518654f, 0.263541579f},
-std::array<float,2>{0.0891031176f, 0.502793074f},
-std::array<float,2>{0.899134874f, 0.443552047f},
-std::array<float,2>{0.570008397f, 0.855948687f},
-std::array<float,2>{0.403204173f, 0.0563055053f},
-std::array<float,2>{0.20413515f, 0.764828324f},
-std::array<float,2>{0.822592854f, 0.0738034174f},
-std::array<float,2>{0.665709198f, 0.608510256f},
-std::array<float,2>{0.320929915f, 0.387066156f},
-std::array<float,2>{0.453585297f, 0.686314821f},
-std::array<float,2>{0.507729471f, 0.365769625f},
-std::array<float,2>{0.956197798f, 0.969040334f},
-std::array<float,2>{0.056238953f, 0.150822088f},
-std::array<float,2>{0.410524338f, 0.83806181f},
-std::array<float,2>{0.609880865f, 0.00413746201f},
-std::array<float,2>{0.910428762f, 0.557829559f},
-std::array<float,2>{0.104248717f, 0.497606367f},
-std::array<float,2>{0.154486984f, 0.724330127f},
-std::array<float,2>{0.751834929f, 0.299861431f},
-std::array<float,2>{0.71095413f, 0.884214699f},
-std::array<float,2>{0.291179866f, 0.19010146f},
-std::array<float,2>{0.00655572908f, 0.942556381f},
-std::array<float,2>{0.978930831f, 0.159907177f},
-std::array<float,2>{0.532767773f, 0.642905951f},
-std::array<float,2>{0.474464446f, 0.339627743f},
-std::array<float,2>{0.374066085f, 0.565149307f},
-std::array<float,2>{0.640785635f, 0.412491739f},
-std::array<float,2>{0.870005071f, 0.792138577f},
-std::array<float,2>{0.22342363f, 0.0954720378f},
-std::array<float,2>{0.288200557f, 0.844301343f},
-std::array<float,2>{0.708958089f, 0.052804485f},
-std::array<float,2>{0.761500418f, 0.511085272f},
-std::array<float,2>{0.144886419f, 0.451276004f},
-std::array<float,2>{0.100345381f, 0.709783733f},
-std::array<float,2>{0.918146431f, 0.256351769f},
-std::array<float,2>{0.622022986f, 0.93412292f},
-std::array<float,2>{0.418971479f, 0.231109411f},
-std::array<float,2>{0.23432678f, 0.984314859f},
-std::array<float,2>{0.866813302f, 0.141748592f},
-std::array<float,2>{0.650264919f, 0.675878525f},
-std::array<float,2>{0.365413159f, 0.373617679f},
-std::array<float,2>{0.480459481f, 0.600179315f},
-std::array<float,2>{0.546230257f, 0.37591064f},
-std::array<float,2>{0.971040249f, 0.756024778f},
-std::array<float,2>{0.0154934004f, 0.0672926456f},
-std::array<float,2>{0.392658114f, 0.881868005f},
-std::array<float,2>{0.574540913f, 0.195456132f},
-std::array<float,2>{0.894907236f, 0.73160392f},
-std::array<float,2>{0.0852916539f, 0.306423604f},
-std::array<float,2>{0.161865115f, 0.549879014f},
-std::array<float,2>{0.78545624f, 0.488164842f},
-std::array<float,2>{0.7427302f, 0.828250766f},
-std::array<float,2>{0.253596514f, 0.010985313f},
-std::array<float,2>{0.0469517931f, 0.786062717f},
-std::array<float,2>{0.963014781f, 0.107206523f},
-std::array<float,2>{0.508542299f, 0.572614789f},
-std::array<float,2>{0.466180772f, 0.419872165f},
-std::array<float,2>{0.315584689f, 0.65283972f},
-std::array<float,2>{0.658641815f, 0.332604438f},
-std::array<float,2>{0.815389991f, 0.948147893f},
-std::array<float,2>{0.216272026f, 0.166900024f},
-std::array<float,2>{0.351246715f, 0.964035392f},
-std::array<float,2>{0.630991995f, 0.18286407f},
-std::array<float,2>{0.844018698f, 0.625415146f},
-std::array<float,2>{0.241243437f, 0.313955039f},
-std::array<float,2>{0.0228993688f, 0.578671396f},
-std::array<float,2>{0.994726121f, 0.422661602f},
-std::array<float,2>{0.55528748f, 0.802758396f},
-std::array<float,2>{0.485264063f, 0.111027978f},
-std::array<float,2>{0.126792356f, 0.823949873f},
-std::array<float,2>{0.769622326f, 0.0287271626f},
-std::array<float,2>{0.697267294f, 0.532862604f},
-std::array<float,2>{0.30137226f, 0.481349111f},
-std::array<float,2>{0.429116875f, 0.742999732f},
-std::array<float,2>{0.595887899f, 0.296843678f},
-std::array<float,2>{0.934460402f, 0.89530772f},
-std::array<float,2>{0.114912041f, 0.207793042f},
-std::array<float,2>{0.443468988f, 0.766599596f},
-std::array<float,2>{0.526748419f, 0.0815400407f},
-std::array<float,2>{0.939212143f, 0.612977207f},
-std::array<float,2>{0.0356881283f, 0.395822257f},
-std::array<float,2>{0.196628377f, 0.661411583f},
-std::array<float,2>{0.830959022f, 0.350223243f},
-std::array<float,2>{0.673985243f, 0.99369061f},
-std::array<float,2>{0.336425096f, 0.135314062f},
-std::array<float,2>{0.0668569952f, 0.906724215f},
-std::array<float,2>{0.88502264f, 0.24881056f},
-std::array<float,2>{0.591856897f, 0.697755456f},
-std::array<float,2>{0.375374794f, 0.280854136f},
-std::array<float,2>{0.276429623f, 0.515830159f},
-std::array<float,2>{0.730311215f, 0.45428887f},
-std::array<float,2>{0.809424222f, 0.874405324f},
-std::array<float,2>{0.184395209f, 0.0356026329f},
-std::array<float,2>{0.327215254f, 0.826518297f},
-std::array<float,2>{0.669802189f, 0.0244537555f},
-std::array<float,2>{0.826114476f, 0.535946131f},
-std::array<float,2>{0.207827285f, 0.478516519f},
-std::array<float,2>{0.0616407655f, 0.74951601f},
-std::array<float,2>{0.957342982f, 0.292761147f},
-std::array<float,2>{0.501465976f, 0.892937839f},
-std::array<float,2>{0.45724386f, 0.206619635f},
-std::array<float,2>{0.167296246f, 0.968396008f},
-std::array<float,2>{0.796794355f, 0.187084168f},
-std::array<float,2>{0.742120445f, 0.630851865f},
-std::array<float,2>{0.262346625f, 0.31828776f},
-std::array<float,2>{0.401044607f, 0.582246661f},
-std::array<float,2>{0.563149691f, 0.428427011f},
-std::array<float,2>{0.905780137f, 0.797508061f},
-std::array<float,2>{0.0913395286f, 0.116392113f},
-std::array<float,2>{0.470850736f, 0.911329031f},
-std::array<float,2>{0.536839366f, 0.242190108f},
-std::array<float,2>{0.983946085f, 0.700682521f},
-std::array<float,2>{0.000788650708f, 0.277231514f},
-std::array<float,2>{0.221348643f, 0.522609591f},
-std::array<float,2>{0.87187475f, 0.459559679f},
-std::array<float,2>{0.645976663f, 0.868361056f},
-std::array<float,2>{0.369557798f, 0.0317504928f},
-std::array<float,2>{0.106716417f, 0.773435295f},
-std::array<float,2>{0.908701599f, 0.0830025524f},
-std::array<float,2>{0.613830984f, 0.613784492f},
-std::array<float,2>{0.407827526f, 0.393802911f},
-std::array<float,2>{0.294597477f, 0.657731891f},
-std::array<float,2>{0.716650665f, 0.34751004f},
-std::array<float,2>{0.75471282f, 0.998889327f},
-std::array<float,2>{0.148634627f, 0.140421227f},
-std::array<float,2>{0.271048486f, 0.980382383f},
-std::array<float,2>{0.719683707f, 0.147194326f},
-std::array<float,2>{0.802358449f, 0.674961925f},
-std::array<float,2>{0.173471138f, 0.370537788f},
-std::array<float,2>{0.0708613098f, 0.595600188f},
-std::array<float,2>{0.880634665f, 0.379653782f},
-std::array<float,2>{0.580200076f, 0.750433862f},
-std::array<float,2>{0.387351692f, 0.0654701814f},
-std::array<float,2>{0.195173874f, 0.851424038f},
-std::array<float,2>{0.839323342f, 0.0470693186f},
-std::array<float,2>{0.686176956f, 0.514012992f},
-std::array<float,2>{0.331848323f, 0.446626782f},
-std::array<float,2>{0.445608705f, 0.70456177f},
-std::array<float,2>{0.515809774f, 0.251941413f},
-std::array<float,2>{0.951157868f, 0.931730926f},
-std::array<float,2>{0.0432418473f, 0.228336409f},
-std::array<float,2>{0.434370577f, 0.782830119f},
-std::array<float,2>{0.606580436f, 0.104668029f},
-std::array<float,2>{0.925802112f, 0.576362252f},
-std::array<float,2>{0.120440915f, 0.417901933f},
-std::array<float,2>{0.134073913f, 0.64844811f},
-std::array<float,2>{0.77351141f, 0.329637915f},
-std::array<float,2>{0.693220496f, 0.950630009f},
-std::array<float,2>{0.31233108f, 0.168001011f},
-std::array<float,2>{0.0277009234f, 0.87868607f},
-std::array<float,2>{0.987074077f, 0.199954659f},
-std::array<float,2>{0.549624562f, 0.728786528f},
-std::array<float,2>{0.493771106f, 0.31009376f},
-std::array<float,2>{0.355447114f, 0.5517717f},
-std::array<float,2>{0.638757169f, 0.489699364f},
-std::array<float,2>{0.858432949f, 0.834010303f},
-std::array<float,2>{0.247741744f, 0.0128112491f},
-std::array<float,2>{0.29861486f, 0.759091496f},
-std::array<float,2>{0.702533543f, 0.0764101073f},
-std::array<float,2>{0.767853022f, 0.605318367f},
-std::array<float,2>{0.129843846f, 0.383491665f},
-std::array<float,2>{0.113034263f, 0.683462679f},
-std::array<float,2>{0.93331641f, 0.361987829f},
-std::array<float,2>{0.598326266f, 0.976422191f},
-std::array<float,2>{0.425270766f, 0.155603975f},
-std::array<float,2>{0.236853004f, 0.923478365f},
-std::array<float,2>{0.850853741f, 0.226004645f},
-std::array<float,2>{0.627579749f, 0.714822948f},
-std::array<float,2>{0.344018489f, 0.260671556f},
-std::array<float,2>{0.489730448f, 0.503935635f},
-std::array<float,2>{0.559098244f, 0.437621266f},
-std::array<float,2>{0.998902977f, 0.852655053f},
-std::array<float,2>{0.0169031266f, 0.0615022629f},
-std::array<float,2>{0.381141603f, 0.939929247f},
-std::array<float,2>{0.589227974f, 0.160386831f},
-std::array<float,2>{0.88735795f, 0.647333384f},
-std::array<float,2>{0.0648332462f, 0.341607779f},
-std::array<float,2>{0.180865869f, 0.56991905f},
-std::array<float,2>{0.808052719f, 0.408367217f},
-std::array<float,2>{0.731584668f, 0.795597851f},
-std::array<float,2>{0.280820638f, 0.0991046354f},
-std::array<float,2>{0.032224346f, 0.843520522f},
-std::array<float,2>{0.943533599f, 0.00382592157f},
-std::array<float,2>{0.528736711f, 0.562007248f},
-std::array<float,2>{0.441390216f, 0.492726892f},
-std::array<float,2>{0.341221333f, 0.720200777f},
-std::array<float,2>{0.677560627f, 0.301646203f},
-std::array<float,2>{0.835595608f, 0.88916868f},
-std::array<float,2>{0.20159702f, 0.194261044f},
-std::array<float,2>{0.361079633f, 0.904319525f},
-std::array<float,2>{0.653785646f, 0.216865405f},
-std::array<float,2>{0.862015605f, 0.736598611f},
-std::array<float,2>{0.227011964f, 0.284013718f},
-std::array<float,2>{0.0109632127f, 0.53965652f},
-std::array<float,2>{0.973291934f, 0.476220608f},
-std::array<float,2>{0.540956199f, 0.814998031f},
-std::array<float,2>{0.484123528f, 0.0201557726f},
-std::array<float,2>{0.141292632f, 0.805588424f},
-std::array<float,2>{0.764652491f, 0.122555628f},
-std::array<float,2>{0.704793155f, 0.588036537f},
-std::array<float,2>{0.283165246f, 0.434135556f},
-std::array<float,2>{0.417422295f, 0.635038853f},
-std::array<float,2>{0.620720863f, 0.323258042f},
-std::array<float,2>{0.916778505f, 0.958835185f},
-std::array<float,2>{0.0948254243f, 0.172667816f},
-std::array<float,2>{0.463684022f, 0.862050176f},
-std::array<float,2>{0.51218617f, 0.0428336002f},
-std::array<float,2>{0.965981841f, 0.526949048f},
-std::array<float,2>{0.0513109975f, 0.462120533f},
-std::array<float,2>{0.21306029f, 0.688023925f},
-std::array<float,2>{0.816784203f, 0.271376044f},
-std::array<float,2>{0.661095679f, 0.919958055f},
-std::array<float,2>{0.319066852f, 0.239111662f},
-std::array<float,2>{0.0800316259f, 0.988723218f},
-std::array<float,2>{0.890886664f, 0.131598756f},
-std::array<float,2>{0.573943019f, 0.671106339f},
-std::array<float,2>{0.395833999f, 0.355388552f},
-std::array<float,2>{0.256716877f, 0.617846787f},
-std::array<float,2>{0.747851968f, 0.402180165f},
-std::array<float,2>{0.783385813f, 0.773839951f},
-std::array<float,2>{0.15926829f, 0.0926941261f},
-std::array<float,2>{0.34911406f, 0.803676903f},
-std::array<float,2>{0.630473614f, 0.110598184f},
-std::array<float,2>{0.845710337f, 0.578453839f},
-std::array<float,2>{0.238412812f, 0.422063947f},
-std::array<float,2>{0.019981144f, 0.625935555f},
-std::array<float,2>{0.993130624f, 0.314248532f},
-std::array<float,2>{0.556758285f, 0.964769363f},
-std::array<float,2>{0.486667335f, 0.18321237f},
-std::array<float,2>{0.128859714f, 0.894855857f},
-std::array<float,2>{0.77277267f, 0.207327366f},
-std::array<float,2>{0.696071327f, 0.742664516f},
-std::array<float,2>{0.303405523f, 0.296318829f},
-std::array<float,2>{0.425795078f, 0.532295942f},
-std::array<float,2>{0.594562709f, 0.480717212f},
-std::array<float,2>{0.93624115f, 0.82327038f},
-std::array<float,2>{0.117150083f, 0.0289790742f},
-std::array<float,2>{0.441569716f, 0.993213058f},
-std::array<float,2>{0.523442566f, 0.135189891f},
-std::array<float,2>{0.940862f, 0.662093818f},
-std::array<float,2>{0.0380462334f, 0.349806994f},
-std::array<float,2>{0.198662996f, 0.612506986f},
-std::array<float,2>{0.829046309f, 0.396024555f},
-std::array<float,2>{0.672841251f, 0.765657961f},
-std::array<float,2>{0.33906433f, 0.0819459781f},
-std::array<float,2>{0.069485262f, 0.874593437f},
-std::array<float,2>{0.88448745f, 0.0360982344f},
-std::array<float,2>{0.590256691f, 0.516335547f},
-std::array<float,2>{0.378162682f, 0.455022752f},
-std::array<float,2>{0.273896515f, 0.697574556f},
-std::array<float,2>{0.726710618f, 0.280691445f},
-std::array<float,2>{0.812052548f, 0.906854212f},
-std::array<float,2>{0.186389178f, 0.248065382f},
-std::array<float,2>{0.286470383f, 0.933889806f},
-std::array<float,2>{0.70913589f, 0.230896309f},
-std::array<float,2>{0.759701073f, 0.709050834f},
-std::array<float,2>{0.146556824f, 0.256257713f},
-std::array<float,2>{0.0976975113f, 0.511628985f},
-std::array<float,2>{0.920435011f, 0.452032328f},
-std::array<float,2>{0.62447381f, 0.844178438f},
-std::array<float,2>{0.41996628f, 0.0535321943f},
-std::array<float,2>{0.231529161f, 0.75673759f},
-std::array<float,2>{0.864963353f, 0.0668639317f},
-std::array<float,2>{0.650599837f, 0.599883854f},
-std::array<float,2>{0.363559633f, 0.375310689f},
-std::array<float,2>{0.477393985f, 0.676429749f},
-std::array<float,2>{0.544332087f, 0.373482704f},
-std::array<float,2>{0.970540524f, 0.983689964f},
-std::array<float,2>{0.0120019447f, 0.14239566f},
-std::array<float,2>{0.392335653f, 0.828630984f},
-std::array<float,2>{0.577874064f, 0.0112396432f},
-std::array<float,2>{0.898347199f, 0.550679564f},
-std::array<float,2>{0.0837912261f, 0.487336218f},
-std::array<float,2>{0.163885817f, 0.732228994f},
-std::array<float,2>{0.787168205f, 0.305900276f},
-std::array<float,2>{0.745343506f, 0.882519007f},
-std::array<float,2>{0.251794994f, 0.196040809f},
-std::array<float,2>{0.0502957068f, 0.947650552f},
-std::array<float,2>{0.962385416f, 0.166376457f},
-std::array<float,2>{0.511579156f, 0.652756751f},
-std::array<float,2>{0.46739766f, 0.33208397f},
-std::array<float,2>{0.31400767f, 0.573088229f},
-std::array<float,2>{0.657522559f, 0.419122249f},
-std::array<float,2>{0.813534558f, 0.785585761f},
-std::array<float,2>{0.217882365f, 0.10659942f},
-std::array<float,2>{0.257933408f, 0.856110871f},
-std::array<float,2>{0.737940192f, 0.0557281934f},
-std::array<float,2>{0.792246819f, 0.502126932f},
-std::array<float,2>{0.168392301f, 0.444238156f},
-std::array<float,2>{0.0873936936f, 0.717054307f},
-std::array<float,2>{0.901475549f, 0.262958795f},
-std::array<float,2>{0.566469789f, 0.926333249f},
-std::array<float,2>{0.404514521f, 0.220510542f},
-std::array<float,2>{0.206777364f, 0.969492614f},
-std::array<float,2>{0.8203848f, 0.151012242f},
-std::array<float,2>{0.667029738f, 0.685726821f},
-std::array<float,2>{0.323062688f, 0.365559965f},
-std::array<float,2>{0.456201822f, 0.609108388f},
-std::array<float,2>{0.505430281f, 0.387377232f},
-std::array<float,2>{0.953968942f, 0.765189588f},
-std::array<float,2>{0.0570308082f, 0.0734525621f},
-std::array<float,2>{0.413466662f, 0.884524584f},
-std::array<float,2>{0.611437738f, 0.189515352f},
-std::array<float,2>{0.912276924f, 0.723732233f},
-std::array<float,2>{0.102065682f, 0.300527722f},
-std::array<float,2>{0.153326556f, 0.558248758f},
-std::array<float,2>{0.75211519f, 0.497486204f},
-std::array<float,2>{0.713621557f, 0.838567019f},
-std::array<float,2>{0.289411813f, 0.0048330375f},
-std::array<float,2>{0.00487772236f, 0.792653441f},
-std::array<float,2>{0.978145182f, 0.0948794857f},
-std::array<float,2>{0.534919024f, 0.564805508f},
-std::array<float,2>{0.474846631f, 0.412846506f},
-std::array<float,2>{0.372732699f, 0.643163323f},
-std::array<float,2>{0.644411623f, 0.339216441f},
-std::array<float,2>{0.869060934f, 0.943166375f},
-std::array<float,2>{0.226354212f, 0.159251451f},
-std::array<float,2>{0.332852125f, 0.956042349f},
-std::array<float,2>{0.679775059f, 0.178912312f},
-std::array<float,2>{0.84000808f, 0.640082419f},
-std::array<float,2>{0.188982964f, 0.326252639f},
-std::array<float,2>{0.0392011032f, 0.592460036f},
-std::array<float,2>{0.947704911f, 0.432916552f},
-std::array<float,2>{0.523144305f, 0.811852157f},
-std::array<float,2>{0.450391114f, 0.119863786f},
-std::array<float,2>{0.176385894f, 0.819712102f},
-std::array<float,2>{0.799620807f, 0.0164970215f},
-std::array<float,2>{0.724702299f, 0.54375267f},
-std::array<float,2>{0.269084305f, 0.468892485f},
-std::array<float,2>{0.384501338f, 0.742170453f},
-std::array<float,2>{0.583260179f, 0.287184536f},
-std::array<float,2>{0.877490938f, 0.901054561f},
-std::array<float,2>{0.0745251626f, 0.212114885f},
-std::array<float,2>{0.496353179f, 0.780706048f},
-std::array<float,2>{0.551060259f, 0.0886041149f},
-std::array<float,2>{0.992065668f, 0.62496978f},
-std::array<float,2>{0.0269550513f, 0.406227291f},
-std::array<float,2>{0.24358581f, 0.666934013f},
-std::array<float,2>{0.855002761f, 0.35813573f},
-std::array<float,2>{0.633853614f, 0.987525165f},
-std::array<float,2>{0.35668245f, 0.128664851f},
-std::array<float,2>{0.122453518f, 0.916394055f},
-std::array<float,2>{0.925647974f, 0.235085741f},
-std::array<float,2>{0.603261709f, 0.693849862f},
-std::array<float,2>{0.432927728f, 0.268524379f},
-std::array<float,2>{0.307053804f, 0.528958321f},
-std::array<float,2>{0.690436363f, 0.467072904f},
-std::array<float,2>{0.781214893f, 0.863526523f},
-std::array<float,2>{0.139250085f, 0.0448887087f},
-std::array<float,2>{0.368546516f, 0.870456338f},
-std::array<float,2>{0.647310197f, 0.0348495357f},
-std::array<float,2>{0.874136865f, 0.520236731f},
-std::array<float,2>{0.218968481f, 0.458523989f},
-std::array<float,2>{0.00376727409f, 0.701392472f},
-std::array<float,2>{0.98220247f, 0.273567408f},
-std::array<float,2>{0.538599789f, 0.912719309f},
-std::array<float,2>{0.469217867f, 0.244414032f},
-std::array<float,2>{0.151979581f, 0.997199059f},
-std::array<float,2>{0.757783532f, 0.137260959f},
-std::array<float,2>{0.71794343f, 0.658926487f},
-std::array<float,2>{0.295688659f, 0.344463855f},
-std::array<float,2>{0.408443928f, 0.616963267f},
-std::array<float,2>{0.616032362f, 0.392148376f},
-std::array<float,2>{0.906966746f, 0.771274626f},
-std::array<float,2>{0.107598737f, 0.0851318091f},
-std::array<float,2>{0.460232884f, 0.890865803f},
-std::array<float,2>{0.503688514f, 0.20340164f},
-std::array<float,2>{0.960839331f, 0.748044491f},
-std::array<float,2>{0.0602178238f, 0.289566368f},
-std::array<float,2>{0.210086435f, 0.537831962f},
-std::array<float,2>{0.828034103f, 0.477981508f},
-std::array<float,2>{0.671867371f, 0.824331701f},
-std::array<float,2>{0.325678557f, 0.026605757f},
-std::array<float,2>{0.0920786932f, 0.799576163f},
-std::array<float,2>{0.902815223f, 0.114592247f},
-std::array<float,2>{0.565929413f, 0.584318697f},
-std::array<float,2>{0.398675531f, 0.427087903f},
-std::array<float,2>{0.264498413f, 0.632657111f},
-std::array<float,2>{0.739274204f, 0.318961978f},
-std::array<float,2>{0.794747412f, 0.965232372f},
-std::array<float,2>{0.165424734f, 0.184968099f},
-std::array<float,2>{0.310418457f, 0.951866508f},
-std::array<float,2>{0.693832457f, 0.171064571f},
-std::array<float,2>{0.77600199f, 0.65191412f},
-std::array<float,2>{0.136040464f, 0.330387831f},
-std::array<float,2>{0.117855102f, 0.575521767f},
-std::array<float,2>{0.929288983f, 0.415989161f},
-std::array<float,2>{0.60885632f, 0.78494823f},
-std::array<float,2>{0.436508209f, 0.102266818f},
-std::array<float,2>{0.249909803f, 0.832823634f},
-std::array<float,2>{0.855818152f, 0.0152923334f},
-std::array<float,2>{0.637738705f, 0.554202199f},
-std::array<float,2>{0.351795375f, 0.490526348f},
-std::array<float,2>{0.496086508f, 0.727902234f},
-std::array<float,2>{0.547573388f, 0.3122105f},
-std::array<float,2>{0.984798372f, 0.876104295f},
-std::array<float,2>{0.0304260459f, 0.202111647f},
-std::array<float,2>{0.390582561f, 0.751980841f},
-std::array<float,2>{0.578742743f, 0.0625368953f},
-std::array<float,2>{0.882671535f, 0.597027004f},
-std::array<float,2>{0.0731574371f, 0.382207632f},
-std::array<float,2>{0.174379528f, 0.672443986f},
-std::array<float,2>{0.803135455f, 0.36818248f},
-std::array<float,2>{0.722508371f, 0.976833999f},
-std::array<float,2>{0.271551728f, 0.146133497f},
-std::array<float,2>{0.0454883054f, 0.931560099f},
-std::array<float,2>{0.952866256f, 0.229387045f},
-std::array<float,2>{0.518898249f, 0.706586242f},
-std::array<float,2>{0.448097378f, 0.253557891f},
-std::array<float,2>{0.329715163f, 0.513453722f},
-std::array<float,2>{0.685457945f, 0.448365957f},
-std::array<float,2>{0.836171806f, 0.848049819f},
-std::array<float,2>{0.191764489f, 0.0497541353f},
-std::array<float,2>{0.278084338f, 0.793904722f},
-std::array<float,2>{0.73309058f, 0.101500958f},
-std::array<float,2>{0.80470866f, 0.567791104f},
-std::array<float,2>{0.18326363f, 0.407825768f},
-std::array<float,2>{0.0630019605f, 0.646125376f},
-std::array<float,2>{0.890317202f, 0.342384845f},
-std::array<float,2>{0.586129785f, 0.93822819f},
-std::array<float,2>{0.379630983f, 0.164020538f},
-std::array<float,2>{0.199491397f, 0.888321996f},
-std::array<float,2>{0.832300067f, 0.192905977f},
-std::array<float,2>{0.678462982f, 0.722075403f},
-std::array<float,2>{0.343091756f, 0.304249913f},
-std::array<float,2>{0.438879073f, 0.559699535f},
-std::array<float,2>{0.529710531f, 0.495423764f},
-std::array<float,2>{0.942923963f, 0.840028107f},
-std::array<float,2>{0.0337087624f, 0.000523353287f},
-std::array<float,2>{0.423079908f, 0.973816097f},
-std::array<float,2>{0.600402772f, 0.15324448f},
-std::array<float,2>{0.930581689f, 0.681110203f},
-std::array<float,2>{0.110220723f, 0.359640539f},
-std::array<float,2>{0.131991297f, 0.603510439f},
-std::array<float,2>{0.765792787f, 0.386491239f},
-std::array<float,2>{0.700577557f, 0.761499345f},
-std::array<float,2>{0.300400436f, 0.0751640871f},
-std::array<float,2>{0.0189740621f, 0.854756236f},
-std::array<float,2>{0.997972846f, 0.0589266866f},
-std::array<float,2>{0.562031507f, 0.506245077f},
-std::array<float,2>{0.492151737f, 0.440473169f},
-std::array<float,2>{0.347094655f, 0.711622775f},
-std::array<float,2>{0.625355005f, 0.257992595f},
-std::array<float,2>{0.849524677f, 0.924867749f},
-std::array<float,2>{0.236253023f, 0.22408323f},
-std::array<float,2>{0.317010015f, 0.918892205f},
-std::array<float,2>{0.66235131f, 0.241093725f},
-std::array<float,2>{0.819278777f, 0.690044522f},
-std::array<float,2>{0.211413518f, 0.272749543f},
-std::array<float,2>{0.0534224436f, 0.524510741f},
-std::array<float,2>{0.968147397f, 0.46370542f},
-std::array<float,2>{0.514296114f, 0.861257434f},
-std::array<float,2>{0.46131891f, 0.0408045277f},
-std::array<float,2>{0.157335892f, 0.776415467f},
-std::array<float,2>{0.78153801f, 0.0913956612f},
-std::array<float,2>{0.749756277f, 0.620023847f},
-std::array<float,2>{0.25509876f, 0.398980618f},
-std::array<float,2>{0.397995859f, 0.668111086f},
-std::array<float,2>{0.571787953f, 0.352802068f},
-std::array<float,2>{0.893310964f, 0.990758121f},
-std::array<float,2>{0.0801640525f, 0.130234033f},
-std::array<float,2>{0.481411397f, 0.812851787f},
-std::array<float,2>{0.542842209f, 0.0222812258f},
-std::array<float,2>{0.976402402f, 0.541746795f},
-std::array<float,2>{0.00968179759f, 0.474035531f},
-std::array<float,2>{0.228887469f, 0.735756695f},
-std::array<float,2>{0.859623253f, 0.281795263f},
-std::array<float,2>{0.654390097f, 0.902839839f},
-std::array<float,2>{0.361999899f, 0.215525627f},
-std::array<float,2>{0.0971152037f, 0.9609164f},
-std::array<float,2>{0.915211558f, 0.175456762f},
-std::array<float,2>{0.618773162f, 0.634660125f},
-std::array<float,2>{0.414788932f, 0.321574777f},
-std::array<float,2>{0.283386827f, 0.587754071f},
-std::array<float,2>{0.70628947f, 0.436169773f},
-std::array<float,2>{0.76180172f, 0.808539748f},
-std::array<float,2>{0.143161118f, 0.123859093f},
-std::array<float,2>{0.336550087f, 0.769021034f},
-std::array<float,2>{0.674387038f, 0.0799702406f},
-std::array<float,2>{0.830196619f, 0.610651374f},
-std::array<float,2>{0.197011933f, 0.397538304f},
-std::array<float,2>{0.0354983024f, 0.662878275f},
-std::array<float,2>{0.938511431f, 0.349420518f},
-std::array<float,2>{0.526937127f, 0.995612502f},
-std::array<float,2>{0.44389537f, 0.134446114f},
-std::array<float,2>{0.184028462f, 0.91006273f},
-std::array<float,2>{0.808739662f, 0.247050688f},
-std::array<float,2>{0.729910791f, 0.696241021f},
-std::array<float,2>{0.277185202f, 0.277743489f},
-std::array<float,2>{0.375507116f, 0.51905179f},
-std::array<float,2>{0.592345238f, 0.455169588f},
-std::array<float,2>{0.885511398f, 0.871413052f},
-std::array<float,2>{0.0673058927f, 0.0381871872f},
-std::array<float,2>{0.484705567f, 0.962492585f},
-std::array<float,2>{0.554967344f, 0.180492878f},
-std::array<float,2>{0.994511306f, 0.628438592f},
-std::array<float,2>{0.0230571739f, 0.31468007f},
-std::array<float,2>{0.241776109f, 0.581091642f},
-std::array<float,2>{0.844625413f, 0.424085706f},
-std::array<float,2>{0.631617785f, 0.801603377f},
-std::array<float,2>{0.350838065f, 0.111484595f},
-std::array<float,2>{0.114641257f, 0.821207345f},
-std::array<float,2>{0.933649242f, 0.0305849388f},
-std::array<float,2>{0.596494675f, 0.53488487f},
-std::array<float,2>{0.429662824f, 0.48376134f},
-std::array<float,2>{0.300867736f, 0.745282173f},
-std::array<float,2>{0.698093593f, 0.294345707f},
-std::array<float,2>{0.770477831f, 0.896953344f},
-std::array<float,2>{0.12631458f, 0.210270435f},
-std::array<float,2>{0.253111422f, 0.87909925f},
-std::array<float,2>{0.742418349f, 0.1985614f},
-std::array<float,2>{0.785680175f, 0.733031809f},
-std::array<float,2>{0.161338761f, 0.30709815f},
-std::array<float,2>{0.0857130215f, 0.547165513f},
-std::array<float,2>{0.89525944f, 0.485106707f},
-std::array<float,2>{0.575186789f, 0.831375182f},
-std::array<float,2>{0.393281162f, 0.00868601259f},
-std::array<float,2>{0.216661364f, 0.787509561f},
-std::array<float,2>{0.814596236f, 0.108787835f},
-std::array<float,2>{0.659080207f, 0.571969748f},
-std::array<float,2>{0.315942436f, 0.421191067f},
-std::array<float,2>{0.466485173f, 0.654689312f},
-std::array<float,2>{0.508176029f, 0.334382445f},
-std::array<float,2>{0.963660181f, 0.947114944f},
-std::array<float,2>{0.047728695f, 0.165544271f},
-std::array<float,2>{0.419569284f, 0.8468858f},
-std::array<float,2>{0.621234775f, 0.0516671687f},
-std::array<float,2>{0.91854775f, 0.508648396f},
-std::array<float,2>{0.0997134224f, 0.450573951f},
-std::array<float,2>{0.145141393f, 0.707367301f},
-std::array<float,2>{0.760744512f, 0.25579682f},
-std::array<float,2>{0.708309889f, 0.93596524f},
-std::array<float,2>{0.289035112f, 0.232582465f},
-std::array<float,2>{0.0146609275f, 0.980855823f},
-std::array<float,2>{0.971339166f, 0.144442827f},
-std::array<float,2>{0.546514511f, 0.679280698f},
-std::array<float,2>{0.479975462f, 0.371635139f},
-std::array<float,2>{0.365929961f, 0.599557042f},
-std::array<float,2>{0.649598718f, 0.378413677f},
-std::array<float,2>{0.866391361f, 0.755574644f},
-std::array<float,2>{0.233534843f, 0.069066003f},
-std::array<float,2>{0.291829705f, 0.837137759f},
-std::array<float,2>{0.711913884f, 0.0076434589f},
-std::array<float,2>{0.751046836f, 0.555889249f},
-std::array<float,2>{0.154794306f, 0.499806315f},
-std::array<float,2>{0.103755958f, 0.725007892f},
-std::array<float,2>{0.911068141f, 0.298218459f},
-std::array<float,2>{0.609652638f, 0.885727406f},
-std::array<float,2>{0.410955966f, 0.189137131f},
-std::array<float,2>{0.222924143f, 0.944649875f},
-std::array<float,2>{0.869196534f, 0.157699749f},
-std::array<float,2>{0.641302764f, 0.641093791f},
-std::array<float,2>{0.374877661f, 0.336105496f},
-std::array<float,2>{0.473653704f, 0.562738955f},
-std::array<float,2>{0.532233f, 0.411944479f},
-std::array<float,2>{0.979093015f, 0.790099323f},
-std::array<float,2>{0.006140057f, 0.097410664f},
-std::array<float,2>{0.402552724f, 0.928294837f},
-std::array<float,2>{0.569533348f, 0.221205518f},
-std::array<float,2>{0.898515582f, 0.716182828f},
-std::array<float,2>{0.0895971358f, 0.264221042f},
-std::array<float,2>{0.171084136f, 0.500121772f},
-std::array<float,2>{0.789909244f, 0.441950232f},
-std::array<float,2>{0.735993624f, 0.858697236f},
-std::array<float,2>{0.260959357f, 0.0574607551f},
-std::array<float,2>{0.0558375455f, 0.763503611f},
-std::array<float,2>{0.956605434f, 0.0718712881f},
-std::array<float,2>{0.506963372f, 0.606094658f},
-std::array<float,2>{0.453755736f, 0.390332878f},
-std::array<float,2>{0.320582867f, 0.684014082f},
-std::array<float,2>{0.665466487f, 0.363607794f},
-std::array<float,2>{0.822927415f, 0.971219778f},
-std::array<float,2>{0.205034152f, 0.150272325f},
-std::array<float,2>{0.357452273f, 0.985199809f},
-std::array<float,2>{0.635495961f, 0.125812441f},
-std::array<float,2>{0.853261113f, 0.665465176f},
-std::array<float,2>{0.244422376f, 0.35574472f},
-std::array<float,2>{0.0244109947f, 0.622097731f},
-std::array<float,2>{0.989001572f, 0.403405786f},
-std::array<float,2>{0.553093374f, 0.779221356f},
-std::array<float,2>{0.499141127f, 0.0874032825f},
-std::array<float,2>{0.138321653f, 0.865490854f},
-std::array<float,2>{0.778772414f, 0.0453207605f},
-std::array<float,2>{0.688497186f, 0.529963195f},
-std::array<float,2>{0.305739492f, 0.466625124f},
-std::array<float,2>{0.430607826f, 0.692830086f},
-std::array<float,2>{0.6039837f, 0.266853094f},
-std::array<float,2>{0.923547447f, 0.915138483f},
-std::array<float,2>{0.124235205f, 0.23719649f},
-std::array<float,2>{0.451948255f, 0.80965662f},
-std::array<float,2>{0.520016432f, 0.118261568f},
-std::array<float,2>{0.946397603f, 0.591335833f},
-std::array<float,2>{0.0425986201f, 0.43144235f},
-std::array<float,2>{0.191114545f, 0.637190282f},
-std::array<float,2>{0.842850804f, 0.325459838f},
-std::array<float,2>{0.681871653f, 0.953711152f},
-std::array<float,2>{0.335692227f, 0.175816819f},
-std::array<float,2>{0.0777598545f, 0.898804307f},
-std::array<float,2>{0.876303256f, 0.214208975f},
-std::array<float,2>{0.58425498f, 0.739684343f},
-std::array<float,2>{0.385236859f, 0.286525965f},
-std::array<float,2>{0.267276734f, 0.546759009f},
-std::array<float,2>{0.72287488f, 0.47094968f},
-std::array<float,2>{0.798528016f, 0.81779629f},
-std::array<float,2>{0.179001227f, 0.019021403f},
-std::array<float,2>{0.330741763f, 0.849390268f},
-std::array<float,2>{0.686867535f, 0.0502249189f},
-std::array<float,2>{0.837958694f, 0.512239814f},
-std::array<float,2>{0.194109648f, 0.448203295f},
-std::array<float,2>{0.0446598791f, 0.705790401f},
-std::array<float,2>{0.949892759f, 0.252441347f},
-std::array<float,2>{0.517153263f, 0.930250287f},
-std::array<float,2>{0.447174668f, 0.229787186f},
-std::array<float,2>{0.172540784f, 0.977990746f},
-std::array<float,2>{0.80150193f, 0.144873396f},
-std::array<float,2>{0.719864309f, 0.673655808f},
-std::array<float,2>{0.270086139f, 0.367636919f},
-std::array<float,2>{0.388144732f, 0.596378148f},
-std::array<float,2>{0.581972897f, 0.381709397f},
-std::array<float,2>{0.879175842f, 0.753083885f},
-std::array<float,2>{0.0721127018f, 0.0641515255f},
-std::array<float,2>{0.492660761f, 0.875798643f},
-std::array<float,2>{0.550502002f, 0.203062624f},
-std::array<float,2>{0.988051951f, 0.727505744f},
-std::array<float,2>{0.0291586742f, 0.310667366f},
-std::array<float,2>{0.246622965f, 0.553202391f},
-std::array<float,2>{0.857984722f, 0.491568923f},
-std::array<float,2>{0.640220404f, 0.833258331f},
-std::array<float,2>{0.353663415f, 0.0140878493f},
-std::array<float,2>{0.119299605f, 0.783943892f},
-std::array<float,2>{0.927728176f, 0.103437558f},
-std::array<float,2>{0.605930626f, 0.574412763f},
-std::array<float,2>{0.435091257f, 0.41417563f},
-std::array<float,2>{0.311391264f, 0.651130497f},
-std::array<float,2>{0.691569805f, 0.331536651f},
-std::array<float,2>{0.774837255f, 0.952767432f},
-std::array<float,2>{0.133027181f, 0.170387447f},
-std::array<float,2>{0.263590276f, 0.966432989f},
-std::array<float,2>{0.741097569f, 0.184049666f},
-std::array<float,2>{0.79564029f, 0.630958498f},
-std::array<float,2>{0.166818887f, 0.32029438f},
-std::array<float,2>{0.0905324221f, 0.585526705f},
-std::array<float,2>{0.90444535f, 0.425963849f},
-std::array<float,2>{0.563734353f, 0.800551534f},
-std::array<float,2>{0.401455432f, 0.113396056f},
-std::array<float,2>{0.20883362f, 0.825442851f},
-std::array<float,2>{0.825036108f, 0.0262560304f},
-std::array<float,2>{0.668079376f, 0.538897395f},
-std::array<float,2>{0.3267079f, 0.477041036f},
-std::array<float,2>{0.458392441f, 0.746301889f},
-std::array<float,2>{0.500737906f, 0.291013151f},
-std::array<float,2>{0.958764493f, 0.892427146f},
-std::array<float,2>{0.0615222007f, 0.204198286f},
-std::array<float,2>{0.40630874f, 0.770125866f},
-std::array<float,2>{0.614679933f, 0.0845732465f},
-std::array<float,2>{0.909679651f, 0.616200626f},
-std::array<float,2>{0.105555862f, 0.391578346f},
-std::array<float,2>{0.149659336f, 0.659883559f},
-std::array<float,2>{0.755766034f, 0.345006108f},
-std::array<float,2>{0.71566689f, 0.996234536f},
-std::array<float,2>{0.293179452f, 0.138384894f},
-std::array<float,2>{0.00119453832f, 0.913735032f},
-std::array<float,2>{0.982963383f, 0.245432347f},
-std::array<float,2>{0.53561157f, 0.702525258f},
-std::array<float,2>{0.472242594f, 0.274743527f},
-std::array<float,2>{0.370748103f, 0.52058959f},
-std::array<float,2>{0.64479214f, 0.457672805f},
-std::array<float,2>{0.872801423f, 0.869373381f},
-std::array<float,2>{0.222169504f, 0.0340731293f},
-std::array<float,2>{0.28214848f, 0.807560027f},
-std::array<float,2>{0.703759193f, 0.124210455f},
-std::array<float,2>{0.763786912f, 0.586830199f},
-std::array<float,2>{0.142566472f, 0.436588734f},
-std::array<float,2>{0.0946429148f, 0.63333112f},
-std::array<float,2>{0.917924047f, 0.320635527f},
-std::array<float,2>{0.619345963f, 0.95938915f},
-std::array<float,2>{0.416699946f, 0.174754173f},
-std::array<float,2>{0.228423014f, 0.903979897f},
-std::array<float,2>{0.862517416f, 0.215957165f},
-std::array<float,2>{0.65284878f, 0.73485297f},
-std::array<float,2>{0.35998404f, 0.282543421f},
-std::array<float,2>{0.483328193f, 0.54253763f},
-std::array<float,2>{0.539613605f, 0.473338485f},
-std::array<float,2>{0.973749816f, 0.813545406f},
-std::array<float,2>{0.0106097125f, 0.0224808678f},
-std::array<float,2>{0.39453429f, 0.991755784f},
-std::array<float,2>{0.573185205f, 0.129750639f},
-std::array<float,2>{0.89222312f, 0.669507861f},
-std::array<float,2>{0.0788010508f, 0.351625174f},
-std::array<float,2>{0.15914309f, 0.621049643f},
-std::array<float,2>{0.784696758f, 0.399904937f},
-std::array<float,2>{0.746581852f, 0.776182294f},
-std::array<float,2>{0.25710544f, 0.0907216296f},
-std::array<float,2>{0.0525480248f, 0.859688461f},
-std::array<float,2>{0.965331376f, 0.0390778258f},
-std::array<float,2>{0.512896299f, 0.523700774f},
-std::array<float,2>{0.464304835f, 0.464749575f},
-std::array<float,2>{0.319684118f, 0.691045046f},
-std::array<float,2>{0.661963403f, 0.271517068f},
-std::array<float,2>{0.817986608f, 0.919752777f},
-std::array<float,2>{0.214207679f, 0.24211207f},
-std::array<float,2>{0.345462561f, 0.924122155f},
-std::array<float,2>{0.628030419f, 0.223086178f},
-std::array<float,2>{0.849952102f, 0.712234437f},
-std::array<float,2>{0.23747541f, 0.25899446f},
-std::array<float,2>{0.0162300132f, 0.507619262f},
-std::array<float,2>{0.999859154f, 0.439456552f},
-std::array<float,2>{0.559575677f, 0.854408979f},
-std::array<float,2>{0.488859624f, 0.0604183413f},
-std::array<float,2>{0.129970491f, 0.760681033f},
-std::array<float,2>{0.769462109f, 0.0756549835f},
-std::array<float,2>{0.70190841f, 0.601649404f},
-std::array<float,2>{0.297172785f, 0.385654598f},
-std::array<float,2>{0.424128294f, 0.680480659f},
-std::array<float,2>{0.598856151f, 0.360825032f},
-std::array<float,2>{0.932131886f, 0.973613441f},
-std::array<float,2>{0.111465245f, 0.153322935f},
-std::array<float,2>{0.439512014f, 0.841073632f},
-std::array<float,2>{0.528010726f, 0.00175121473f},
-std::array<float,2>{0.944451034f, 0.559023619f},
-std::array<float,2>{0.0324012861f, 0.494768202f},
-std::array<float,2>{0.202990294f, 0.721115053f},
-std::array<float,2>{0.834363759f, 0.303156018f},
-std::array<float,2>{0.676726401f, 0.886856437f},
-std::array<float,2>{0.340073079f, 0.191591606f},
-std::array<float,2>{0.0655795559f, 0.939093053f},
-std::array<float,2>{0.888467491f, 0.162562057f},
-std::array<float,2>{0.588524461f, 0.645337164f},
-std::array<float,2>{0.382346153f, 0.343545496f},
-std::array<float,2>{0.279396474f, 0.566767037f},
-std::array<float,2>{0.731227398f, 0.406573385f},
-std::array<float,2>{0.806758821f, 0.794077396f},
-std::array<float,2>{0.179851145f, 0.0996169895f},
-std::array<float,2>{0.364332139f, 0.754056215f},
-std::array<float,2>{0.652032554f, 0.0699326992f},
-std::array<float,2>{0.86346966f, 0.598477781f},
-std::array<float,2>{0.230748668f, 0.377872378f},
-std::array<float,2>{0.0134931672f, 0.678501904f},
-std::array<float,2>{0.969297707f, 0.372819692f},
-std::array<float,2>{0.543900847f, 0.98192966f},
-std::array<float,2>{0.478210717f, 0.143107936f},
-std::array<float,2>{0.147785649f, 0.937195063f},
-std::array<float,2>{0.758759081f, 0.234155312f},
-std::array<float,2>{0.710903943f, 0.708614528f},
-std::array<float,2>{0.285813838f, 0.254137695f},
-std::array<float,2>{0.421486676f, 0.508940876f},
-std::array<float,2>{0.623886824f, 0.449397057f},
-std::array<float,2>{0.921647668f, 0.846336365f},
-std::array<float,2>{0.0992526785f, 0.0520553775f},
-std::array<float,2>{0.468042076f, 0.946117043f},
-std::array<float,2>{0.510354161f, 0.164343163f},
-std::array<float,2>{0.961693227f, 0.655736923f},
-std::array<float,2>{0.0494454801f, 0.335835069f},
-std::array<float,2>{0.216835424f, 0.570546031f},
-std::array<float,2>{0.812766254f, 0.42056486f},
-std::array<float,2>{0.656995058f, 0.788320005f},
-std::array<float,2>{0.31298539f, 0.108034737f},
-std::array<float,2>{0.0825988576f, 0.830489218f},
-std::array<float,2>{0.897291303f, 0.00970085617f},
-std::array<float,2>{0.576211572f, 0.548460841f},
-std::array<float,2>{0.391106874f, 0.486187369f},
-std::array<float,2>{0.250727743f, 0.734241128f},
-std::array<float,2>{0.744530082f, 0.308161706f},
-std::array<float,2>{0.788970292f, 0.880417049f},
-std::array<float,2>{0.162801936f, 0.197286382f},
-std::array<float,2>{0.303952247f, 0.898122489f},
-std::array<float,2>{0.696525455f, 0.209451392f},
-std::array<float,2>{0.772161305f, 0.744586945f},
-std::array<float,2>{0.127505109f, 0.292997092f},
-std::array<float,2>{0.115766577f, 0.533320427f},
-std::array<float,2>{0.936823428f, 0.482769758f},
-std::array<float,2>{0.595359385f, 0.821930528f},
-std::array<float,2>{0.426853538f, 0.0297034178f},
-std::array<float,2>{0.239405856f, 0.80194205f},
-std::array<float,2>{0.84747529f, 0.113125481f},
-std::array<float,2>{0.629835784f, 0.580658019f},
-std::array<float,2>{0.347739398f, 0.424876869f},
-std::array<float,2>{0.487487227f, 0.627661288f},
-std::array<float,2>{0.558306158f, 0.315999776f},
-std::array<float,2>{0.994120896f, 0.961168706f},
-std::array<float,2>{0.0207082164f, 0.180903301f},
-std::array<float,2>{0.377670944f, 0.872609496f},
-std::array<float,2>{0.591075122f, 0.0374226272f},
-std::array<float,2>{0.882907569f, 0.518322647f},
-std::array<float,2>{0.0691968352f, 0.456699163f},
-std::array<float,2>{0.186719373f, 0.696290076f},
-std::array<float,2>{0.811450839f, 0.27853635f},
-std::array<float,2>{0.727754712f, 0.908971548f},
-std::array<float,2>{0.27464956f, 0.247154459f},
-std::array<float,2>{0.038940616f, 0.994678855f},
-std::array<float,2>{0.939511955f, 0.133079559f},
-std::array<float,2>{0.524843514f, 0.663541019f},
-std::array<float,2>{0.443286985f, 0.34848544f},
-std::array<float,2>{0.33873105f, 0.610209882f},
-std::array<float,2>{0.673550069f, 0.396777719f},
-std::array<float,2>{0.829185307f, 0.76808846f},
-std::array<float,2>{0.198004708f, 0.0786958709f},
-std::array<float,2>{0.268022984f, 0.816759706f},
-std::array<float,2>{0.726390779f, 0.0176090375f},
-std::array<float,2>{0.80058223f, 0.545078516f},
-std::array<float,2>{0.177154943f, 0.472556204f},
-std::array<float,2>{0.0756445006f, 0.738667369f},
-std::array<float,2>{0.878381431f, 0.28531307f},
-std::array<float,2>{0.5821051f, 0.899705291f},
-std::array<float,2>{0.383254677f, 0.213215947f},
-std::array<float,2>{0.187535822f, 0.954959393f},
-std::array<float,2>{0.841574669f, 0.17755343f},
-std::array<float,2>{0.680917382f, 0.638405204f},
-std::array<float,2>{0.333021998f, 0.325154454f},
-std::array<float,2>{0.449782223f, 0.590074658f},
-std::array<float,2>{0.521589041f, 0.430162489f},
-std::array<float,2>{0.948476374f, 0.809235096f},
-std::array<float,2>{0.0403363183f, 0.117895581f},
-std::array<float,2>{0.43197155f, 0.914176762f},
-std::array<float,2>{0.60216397f, 0.237424359f},
-std::array<float,2>{0.924476206f, 0.692207158f},
-std::array<float,2>{0.121490255f, 0.266414821f},
-std::array<float,2>{0.139727667f, 0.530754805f},
-std::array<float,2>{0.779967487f, 0.465262145f},
-std::array<float,2>{0.689728796f, 0.866287351f},
-std::array<float,2>{0.308306307f, 0.046335008f},
-std::array<float,2>{0.0259023141f, 0.777781904f},
-std::array<float,2>{0.990598083f, 0.0863569602f},
-std::array<float,2>{0.551984131f, 0.62197578f},
-std::array<float,2>{0.497327864f, 0.402414232f},
-std::array<float,2>{0.356103808f, 0.664806902f},
-std::array<float,2>{0.632960498f, 0.357312679f},
-std::array<float,2>{0.854233325f, 0.985547304f},
-std::array<float,2>{0.242504328f, 0.126673147f},
-std::array<float,2>{0.323908418f, 0.971897304f},
-std::array<float,2>{0.666180015f, 0.149245173f},
-std::array<float,2>{0.822112381f, 0.684760869f},
-std::array<float,2>{0.205353424f, 0.364533812f},
-std::array<float,2>{0.0578955524f, 0.606954098f},
-std::array<float,2>{0.955018938f, 0.388919532f},
-std::array<float,2>{0.504529774f, 0.762102723f},
-std::array<float,2>{0.455093443f, 0.0707126334f},
-std::array<float,2>{0.169126555f, 0.858305335f},
-std::array<float,2>{0.791342795f, 0.0578040332f},
-std::array<float,2>{0.736439884f, 0.501191735f},
-std::array<float,2>{0.259449363f, 0.44265902f},
-std::array<float,2>{0.405352205f, 0.715503097f},
-std::array<float,2>{0.568198919f, 0.264973998f},
-std::array<float,2>{0.901041508f, 0.928984404f},
-std::array<float,2>{0.0868759006f, 0.221751913f},
-std::array<float,2>{0.475927889f, 0.789133132f},
-std::array<float,2>{0.53348738f, 0.096039921f},
-std::array<float,2>{0.977080643f, 0.56436193f},
-std::array<float,2>{0.00511600869f, 0.410339952f},
-std::array<float,2>{0.225234047f, 0.642534137f},
-std::array<float,2>{0.867344081f, 0.33770743f},
-std::array<float,2>{0.643129349f, 0.943400502f},
-std::array<float,2>{0.371478528f, 0.156450704f},
-std::array<float,2>{0.102723405f, 0.886128426f},
-std::array<float,2>{0.91357106f, 0.188142836f},
-std::array<float,2>{0.612699866f, 0.726037204f},
-std::array<float,2>{0.412169486f, 0.296956658f},
-std::array<float,2>{0.290397078f, 0.554970145f},
-std::array<float,2>{0.714679539f, 0.499002486f},
-std::array<float,2>{0.753431559f, 0.836500883f},
-std::array<float,2>{0.152798608f, 0.00617214339f},
-std::array<float,2>{0.353179038f, 0.835472941f},
-std::array<float,2>{0.63691169f, 0.0125234695f},
-std::array<float,2>{0.857261658f, 0.551391065f},
-std::array<float,2>{0.248356417f, 0.489101559f},
-std::array<float,2>{0.0294376221f, 0.730229974f},
-std::array<float,2>{0.986056745f, 0.309065044f},
-std::array<float,2>{0.548381686f, 0.877111495f},
-std::array<float,2>{0.494388074f, 0.200361341f},
-std::array<float,2>{0.135411531f, 0.949964702f},
-std::array<float,2>{0.777049839f, 0.169086397f},
-std::array<float,2>{0.694402277f, 0.650371075f},
-std::array<float,2>{0.308893085f, 0.328688949f},
-std::array<float,2>{0.43687287f, 0.57792145f},
-std::array<float,2>{0.607464492f, 0.416747332f},
-std::array<float,2>{0.928568184f, 0.781764328f},
-std::array<float,2>{0.118228771f, 0.10388384f},
-std::array<float,2>{0.44835487f, 0.933221996f},
-std::array<float,2>{0.517792523f, 0.226767659f},
-std::array<float,2>{0.95136714f, 0.704019845f},
-std::array<float,2>{0.0459748432f, 0.250214189f},
-std::array<float,2>{0.193033159f, 0.515012622f},
-std::array<float,2>{0.83717066f, 0.445658505f},
-std::array<float,2>{0.684095562f, 0.850015819f},
-std::array<float,2>{0.328140974f, 0.0484576821f},
-std::array<float,2>{0.0736800879f, 0.751120746f},
-std::array<float,2>{0.881230831f, 0.0649638548f},
-std::array<float,2>{0.579997838f, 0.594627321f},
-std::array<float,2>{0.388689548f, 0.380793303f},
-std::array<float,2>{0.272463739f, 0.674628973f},
-std::array<float,2>{0.721081197f, 0.369568497f},
-std::array<float,2>{0.803861499f, 0.97869432f},
-std::array<float,2>{0.175167844f, 0.147824019f},
-std::array<float,2>{0.296871871f, 0.999710262f},
-std::array<float,2>{0.71729511f, 0.138995469f},
-std::array<float,2>{0.755879641f, 0.657005727f},
-std::array<float,2>{0.150695816f, 0.346572042f},
-std::array<float,2>{0.10885448f, 0.614637196f},
-std::array<float,2>{0.908040404f, 0.39260596f},
-std::array<float,2>{0.616807699f, 0.771730602f},
-std::array<float,2>{0.409568697f, 0.08378575f},
-std::array<float,2>{0.220168546f, 0.867307127f},
-std::array<float,2>{0.873621106f, 0.0324941762f},
-std::array<float,2>{0.647676051f, 0.521743655f},
-std::array<float,2>{0.367600113f, 0.460608333f},
-std::array<float,2>{0.47048077f, 0.69930172f},
-std::array<float,2>{0.537110984f, 0.275971204f},
-std::array<float,2>{0.981228054f, 0.910549998f},
-std::array<float,2>{0.00233920198f, 0.243551776f},
-std::array<float,2>{0.400027871f, 0.797893465f},
-std::array<float,2>{0.564760208f, 0.115506068f},
-std::array<float,2>{0.903331637f, 0.583446085f},
-std::array<float,2>{0.0932589695f, 0.429203033f},
-std::array<float,2>{0.164559871f, 0.629872799f},
-std::array<float,2>{0.793237031f, 0.316569418f},
-std::array<float,2>{0.738364041f, 0.967218101f},
-std::array<float,2>{0.26508382f, 0.186352283f},
-std::array<float,2>{0.0593753122f, 0.894217193f},
-std::array<float,2>{0.959085524f, 0.205280095f},
-std::array<float,2>{0.50242573f, 0.748960376f},
-std::array<float,2>{0.459204376f, 0.291660368f},
-std::array<float,2>{0.324243546f, 0.537053883f},
-std::array<float,2>{0.670325875f, 0.479744047f},
-std::array<float,2>{0.82642442f, 0.827324152f},
-std::array<float,2>{0.209085926f, 0.0241508912f},
-std::array<float,2>{0.254151464f, 0.774517f},
-std::array<float,2>{0.748099506f, 0.0932382941f},
-std::array<float,2>{0.782933474f, 0.618777812f},
-std::array<float,2>{0.156717941f, 0.401260138f},
-std::array<float,2>{0.0816810802f, 0.670498312f},
-std::array<float,2>{0.893792152f, 0.354057819f},
-std::array<float,2>{0.570917487f, 0.989943743f},
-std::array<float,2>{0.39709869f, 0.132772729f},
-std::array<float,2>{0.211919889f, 0.921120405f},
-std::array<float,2>{0.819797337f, 0.240098923f},
-std::array<float,2>{0.663660944f, 0.689212024f},
-std::array<float,2>{0.317548394f, 0.270395488f},
-std::array<float,2>{0.462056428f, 0.525818288f},
-std::array<float,2>{0.515121341f, 0.461443514f},
-std::array<float,2>{0.967540801f, 0.862467408f},
-std::array<float,2>{0.0538212806f, 0.0414265953f},
-std::array<float,2>{0.415700674f, 0.957300007f},
-std::array<float,2>{0.617724359f, 0.172909215f},
-std::array<float,2>{0.914248586f, 0.63604939f},
-std::array<float,2>{0.0961241946f, 0.322477251f},
-std::array<float,2>{0.144098401f, 0.589451671f},
-std::array<float,2>{0.762764454f, 0.434782416f},
-std::array<float,2>{0.705685914f, 0.806460917f},
-std::array<float,2>{0.284664035f, 0.121212423f},
-std::array<float,2>{0.00807433948f, 0.816311359f},
-std::array<float,2>{0.975506604f, 0.020729484f},
-std::array<float,2>{0.541599989f, 0.540088296f},
-std::array<float,2>{0.481646359f, 0.474836618f},
-std::array<float,2>{0.36240226f, 0.737379968f},
-std::array<float,2>{0.655978858f, 0.284632355f},
-std::array<float,2>{0.860380411f, 0.906219602f},
-std::array<float,2>{0.229960695f, 0.218720272f},
-std::array<float,2>{0.342394769f, 0.890432656f},
-std::array<float,2>{0.679452837f, 0.195270881f},
-std::array<float,2>{0.833844543f, 0.719553769f},
-std::array<float,2>{0.200378433f, 0.302541435f},
-std::array<float,2>{0.0342000052f, 0.560719728f},
-std::array<float,2>{0.941586971f, 0.493983299f},
-std::array<float,2>{0.530735433f, 0.842325091f},
-std::array<float,2>{0.437732935f, 0.00223212712f},
-std::array<float,2>{0.181768209f, 0.796126902f},
-std::array<float,2>{0.805819154f, 0.0977724791f},
-std::array<float,2>{0.733649492f, 0.56883502f},
-std::array<float,2>{0.279253662f, 0.409970343f},
-std::array<float,2>{0.380481064f, 0.648125648f},
-std::array<float,2>{0.587012887f, 0.3406187f},
-std::array<float,2>{0.888920844f, 0.941065609f},
-std::array<float,2>{0.0641385242f, 0.162072465f},
-std::array<float,2>{0.491094083f, 0.851900935f},
-std::array<float,2>{0.561304927f, 0.06213402f},
-std::array<float,2>{0.997015119f, 0.505403519f},
-std::array<float,2>{0.0178503226f, 0.439449936f},
-std::array<float,2>{0.235299125f, 0.713457227f},
-std::array<float,2>{0.848489046f, 0.260980815f},
-std::array<float,2>{0.626432002f, 0.922650993f},
-std::array<float,2>{0.346575826f, 0.225039363f},
-std::array<float,2>{0.11092975f, 0.975010276f},
-std::array<float,2>{0.930733919f, 0.154702365f},
-std::array<float,2>{0.601193964f, 0.6822052f},
-std::array<float,2>{0.422756851f, 0.362459004f},
-std::array<float,2>{0.299412817f, 0.603861392f},
-std::array<float,2>{0.699945927f, 0.384117246f},
-std::array<float,2>{0.766693056f, 0.758224249f},
-std::array<float,2>{0.131220534f, 0.077771835f},
-std::array<float,2>{0.31468603f, 0.786501765f},
-std::array<float,2>{0.659678042f, 0.105979875f},
-std::array<float,2>{0.81559515f, 0.573711812f},
-std::array<float,2>{0.215453982f, 0.418519437f},
-std::array<float,2>{0.0478530936f, 0.653874695f},
-std::array<float,2>{0.964192092f, 0.333141714f},
-std::array<float,2>{0.509418309f, 0.948646963f},
-std::array<float,2>{0.464847147f, 0.167915732f},
-std::array<float,2>{0.161100239f, 0.881752014f},
-std::array<float,2>{0.78674674f, 0.19699873f},
-std::array<float,2>{0.743199587f, 0.73094207f},
-std::array<float,2>{0.252020836f, 0.305193871f},
-std::array<float,2>{0.393992215f, 0.549318671f},
-std::array<float,2>{0.576062858f, 0.486471385f},
-std::array<float,2>{0.895624399f, 0.830033481f},
-std::array<float,2>{0.0844071805f, 0.0100794258f},
-std::array<float,2>{0.478778541f, 0.983214438f},
-std::array<float,2>{0.545842946f, 0.141304076f},
-std::array<float,2>{0.972154558f, 0.676773846f},
-std::array<float,2>{0.0142215155f, 0.374227017f},
-std::array<float,2>{0.233047873f, 0.60155499f},
-std::array<float,2>{0.865945518f, 0.376129806f},
-std::array<float,2>{0.648819625f, 0.756924868f},
-std::array<float,2>{0.366669148f, 0.0675226152f},
-std::array<float,2>{0.101239435f, 0.845693409f},
-std::array<float,2>{0.919169962f, 0.0543347299f},
-std::array<float,2>{0.622461021f, 0.509907186f},
-std::array<float,2>{0.418023169f, 0.452650666f},
-std::array<float,2>{0.287542254f, 0.710914969f},
-std::array<float,2>{0.707755685f, 0.257146597f},
-std::array<float,2>{0.760515392f, 0.93529433f},
-std::array<float,2>{0.145960465f, 0.23179166f},
-std::array<float,2>{0.275890559f, 0.90796864f},
-std::array<float,2>{0.729054928f, 0.249893695f},
-std::array<float,2>{0.809868932f, 0.69916749f},
-std::array<float,2>{0.185413063f, 0.279719532f},
-std::array<float,2>{0.0677936748f, 0.517171681f},
-std::array<float,2>{0.885885358f, 0.453365862f},
-std::array<float,2>{0.593161941f, 0.873551905f},
-std::array<float,2>{0.376343817f, 0.0362401083f},
-std::array<float,2>{0.195791453f, 0.767467499f},
-std::array<float,2>{0.831169188f, 0.0806025565f},
-std::array<float,2>{0.674926341f, 0.611814082f},
-std::array<float,2>{0.337461531f, 0.39453131f},
-std::array<float,2>{0.444561481f, 0.660663068f},
-std::array<float,2>{0.525550008f, 0.350670129f},
-std::array<float,2>{0.938073635f, 0.992569327f},
-std::array<float,2>{0.0368704796f, 0.135883346f},
-std::array<float,2>{0.42775166f, 0.822493434f},
-std::array<float,2>{0.596968293f, 0.0277053714f},
-std::array<float,2>{0.935405314f, 0.531816959f},
-std::array<float,2>{0.113808542f, 0.481897086f},
-std::array<float,2>{0.125787377f, 0.743497193f},
-std::array<float,2>{0.770850241f, 0.294974744f},
-std::array<float,2>{0.698478103f, 0.895822763f},
-std::array<float,2>{0.302535981f, 0.208320498f},
-std::array<float,2>{0.0218565483f, 0.963360012f},
-std::array<float,2>{0.996060371f, 0.182385162f},
-std::array<float,2>{0.555927575f, 0.626533628f},
-std::array<float,2>{0.485859841f, 0.312775105f},
-std::array<float,2>{0.350141078f, 0.579372227f},
-std::array<float,2>{0.632203221f, 0.423125744f},
-std::array<float,2>{0.845234454f, 0.804532886f},
-std::array<float,2>{0.240394726f, 0.110250145f},
-std::array<float,2>{0.304812372f, 0.864728212f},
-std::array<float,2>{0.688295484f, 0.0434424579f},
-std::array<float,2>{0.778136849f, 0.527642787f},
-std::array<float,2>{0.136929631f, 0.468694419f},
-std::array<float,2>{0.123889513f, 0.694603026f},
-std::array<float,2>{0.922529638f, 0.268609196f},
-std::array<float,2>{0.604499459f, 0.917514801f},
-std::array<float,2>{0.430691391f, 0.235369921f},
-std::array<float,2>{0.245830446f, 0.986593485f},
-std::array<float,2>{0.852515101f, 0.127672032f},
-std::array<float,2>{0.636254728f, 0.667746246f},
-std::array<float,2>{0.35889703f, 0.358944118f},
-std::array<float,2>{0.498827398f, 0.62322408f},
-std::array<float,2>{0.553824723f, 0.405102581f},
-std::array<float,2>{0.990231752f, 0.779615521f},
-std::array<float,2>{0.0244220998f, 0.089637883f},
-std::array<float,2>{0.386261374f, 0.9022066f},
-std::array<float,2>{0.585182548f, 0.211490825f},
-std::array<float,2>{0.875635445f, 0.741117001f},
-std::array<float,2>{0.0766040832f, 0.28895694f},
-std::array<float,2>{0.177882746f, 0.543952167f},
-std::array<float,2>{0.797142386f, 0.470558375f},
-std::array<float,2>{0.724089801f, 0.818835199f},
-std::array<float,2>{0.266283154f, 0.0175259188f},
-std::array<float,2>{0.0416959375f, 0.811291099f},
-std::array<float,2>{0.945506155f, 0.120690852f},
-std::array<float,2>{0.520998716f, 0.59286654f},
-std::array<float,2>{0.452357829f, 0.43164432f},
-std::array<float,2>{0.334694475f, 0.639567256f},
-std::array<float,2>{0.682843566f, 0.327942669f},
-std::array<float,2>{0.8419348f, 0.956901312f},
-std::array<float,2>{0.18988438f, 0.178655803f},
-std::array<float,2>{0.373980314f, 0.9420892f},
-std::array<float,2>{0.642244399f, 0.158830285f},
-std::array<float,2>{0.870660901f, 0.644049883f},
-std::array<float,2>{0.224473879f, 0.338016272f},
-std::array<float,2>{0.00777976494f, 0.566098332f},
-std::array<float,2>{0.980362415f, 0.413384646f},
-std::array<float,2>{0.531767666f, 0.791072726f},
-std::array<float,2>{0.473077804f, 0.0938847139f},
-std::array<float,2>{0.156037718f, 0.839340508f},
-std::array<float,2>{0.750019073f, 0.00567665463f},
-std::array<float,2>{0.712373316f, 0.557594121f},
-std::array<float,2>{0.292009145f, 0.496256441f},
-std::array<float,2>{0.411876738f, 0.722764909f},
-std::array<float,2>{0.611304462f, 0.299573958f},
-std::array<float,2>{0.911482871f, 0.883782268f},
-std::array<float,2>{0.104556665f, 0.191248521f},
-std::array<float,2>{0.454775721f, 0.764373958f},
-std::array<float,2>{0.505895853f, 0.0723652765f},
-std::array<float,2>{0.955510914f, 0.607908428f},
-std::array<float,2>{0.055211775f, 0.388665676f},
-std::array<float,2>{0.203714237f, 0.687234223f},
-std::array<float,2>{0.824176669f, 0.36667043f},
-std::array<float,2>{0.664298058f, 0.970162928f},
-std::array<float,2>{0.321853459f, 0.15216592f},
-std::array<float,2>{0.08839304f, 0.927469552f},
-std::array<float,2>{0.899838269f, 0.21912688f},
-std::array<float,2>{0.568686604f, 0.718182981f},
-std::array<float,2>{0.403351128f, 0.262284517f},
-std::array<float,2>{0.260489315f, 0.502980113f},
-std::array<float,2>{0.734701574f, 0.444515705f},
-std::array<float,2>{0.790875673f, 0.857121229f},
-std::array<float,2>{0.170715079f, 0.0546989366f},
-std::array<float,2>{0.333397299f, 0.820024788f},
-std::array<float,2>{0.680821955f, 0.0156584717f},
-std::array<float,2>{0.841519237f, 0.543205261f},
-std::array<float,2>{0.187987491f, 0.469448f},
-std::array<float,2>{0.0400981829f, 0.741424799f},
-std::array<float,2>{0.948605776f, 0.287746549f},
-std::array<float,2>{0.521853507f, 0.900540054f},
-std::array<float,2>{0.449953347f, 0.212819874f},
-std::array<float,2>{0.176990137f, 0.955350518f},
-std::array<float,2>{0.800316453f, 0.179498181f},
-std::array<float,2>{0.726218641f, 0.640335858f},
-std::array<float,2>{0.267662823f, 0.326960444f},
-std::array<float,2>{0.382929027f, 0.592060924f},
-std::array<float,2>{0.582300782f, 0.433569551f},
-std::array<float,2>{0.878009319f, 0.812250316f},
-std::array<float,2>{0.0753377154f, 0.11917045f},
-std::array<float,2>{0.497209996f, 0.916970968f},
-std::array<float,2>{0.552194834f, 0.234730482f},
-std::array<float,2>{0.990457237f, 0.693635285f},
-std::array<float,2>{0.0261694714f, 0.267802805f},
-std::array<float,2>{0.242276877f, 0.528480768f},
-std::array<float,2>{0.854380548f, 0.46741569f},
-std::array<float,2>{0.633078098f, 0.863779128f},
-std::array<float,2>{0.356250912f, 0.044263918f},
-std::array<float,2>{0.121251792f, 0.781094432f},
-std::array<float,2>{0.924737334f, 0.0882203877f},
-std::array<float,2>{0.602345526f, 0.624112427f},
-std::array<float,2>{0.43175f, 0.405595422f},
-std::array<float,2>{0.30855602f, 0.666364431f},
-std::array<float,2>{0.689541101f, 0.357763201f},
-std::array<float,2>{0.78017807f, 0.98799938f},
-std::array<float,2>{0.139947861f, 0.1281261f},
-std::array<float,2>{0.259656668f, 0.968805373f},
-std::array<float,2>{0.736729383f, 0.15056695f},
-std::array<float,2>{0.791251779f, 0.686106324f},
-std::array<float,2>{0.169329658f, 0.366038144f},
-std::array<float,2>{0.086444132f, 0.608710885f},
-std::array<float,2>{0.901185393f, 0.386731178f},
-std::array<float,2>{0.56806159f, 0.765016973f},
-std::array<float,2>{0.405732393f, 0.0741447955f},
-std::array<float,2>{0.205277964f, 0.855585158f},
-std::array<float,2>{0.821810842f, 0.0565641075f},
-std::array<float,2>{0.666325092f, 0.502479732f},
-std::array<float,2>{0.324144751f, 0.443683356f},
-std::array<float,2>{0.455367863f, 0.717534661f},
-std::array<float,2>{0.504743099f, 0.263273388f},
-std::array<float,2>{0.954833865f, 0.926101089f},
-std::array<float,2>{0.0576235875f, 0.219938174f},
-std::array<float,2>{0.412493587f, 0.792325735f},
-std::array<float,2>{0.612381041f, 0.0952512026f},
-std::array<float,2>{0.913268089f, 0.565263271f},
-std::array<float,2>{0.102948494f, 0.412302673f},
-std::array<float,2>{0.152531162f, 0.642706096f},
-std::array<float,2>{0.753860354f, 0.33940208f},
-std::array<float,2>{0.714476407f, 0.942831874f},
-std::array<float,2>{0.290100873f, 0.160040081f},
-std::array<float,2>{0.0052194139f, 0.883927703f},
-std::array<float,2>{0.977309287f, 0.190333113f},
-std::array<float,2>{0.533279121f, 0.724568784f},
-std::array<float,2>{0.475818932f, 0.300070047f},
-std::array<float,2>{0.371239483f, 0.558048487f},
-std::array<float,2>{0.643321991f, 0.497815341f},
-std::array<float,2>{0.867644608f, 0.838339508f},
-std::array<float,2>{0.2255698f, 0.00430633407f},
-std::array<float,2>{0.285920411f, 0.756217182f},
-std::array<float,2>{0.710544288f, 0.0671151206f},
-std::array<float,2>{0.758453012f, 0.600450635f},
-std::array<float,2>{0.147540614f, 0.375494003f},
-std::array<float,2>{0.0994384512f, 0.676259339f},
-std::array<float,2>{0.921613634f, 0.373975068f},
-std::array<float,2>{0.623628676f, 0.983964443f},
-std::array<float,2>{0.421703547f, 0.14201498f},
-std::array<float,2>{0.23069793f, 0.93451041f},
-std::array<float,2>{0.863740742f, 0.231371075f},
-std::array<float,2>{0.652209103f, 0.709593832f},
-std::array<float,2>{0.364645481f, 0.256805062f},
-std::array<float,2>{0.478311658f, 0.510830939f},
-std::array<float,2>{0.543669283f, 0.451537311f},
-std::array<float,2>{0.969506145f, 0.844602525f},
-std::array<float,2>{0.0132458257f, 0.0532211363f},
-std::array<float,2>{0.39063403f, 0.947958171f},
-std::array<float,2>{0.57665813f, 0.166633308f},
-std::array<float,2>{0.897182286f, 0.653285861f},
-std::array<float,2>{0.0828862339f, 0.332857639f},
-std::array<float,2>{0.163068846f, 0.572488606f},
-std::array<float,2>{0.78879869f, 0.419542432f},
-std::array<float,2>{0.744374871f, 0.78579849f},
-std::array<float,2>{0.250828207f, 0.107033692f},
-std::array<float,2>{0.0496032424f, 0.828550518f},
-std::array<float,2>{0.961446762f, 0.0110742096f},
-std::array<float,2>{0.510659516f, 0.550138533f},
-std::array<float,2>{0.46794197f, 0.487994373f},
-std::array<float,2>{0.312606454f, 0.73188448f},
-std::array<float,2>{0.656880856f, 0.306272924f},
-std::array<float,2>{0.812582374f, 0.882183611f},
-std::array<float,2>{0.217147693f, 0.195733309f},
-std::array<float,2>{0.348100066f, 0.895172179f},
-std::array<float,2>{0.629502416f, 0.207575947f},
-std::array<float,2>{0.847219646f, 0.74289614f},
-std::array<float,2>{0.239558801f, 0.296554536f},
-std::array<float,2>{0.0209873281f, 0.533164263f},
-std::array<float,2>{0.993667662f, 0.48114261f},
-std::array<float,2>{0.558495343f, 0.824017107f},
-std::array<float,2>{0.487570137f, 0.0283382814f},
-std::array<float,2>{0.127746388f, 0.803019106f},
-std::array<float,2>{0.772363842f, 0.111325093f},
-std::array<float,2>{0.696662307f, 0.578859031f},
-std::array<float,2>{0.303999364f, 0.42250821f},
-std::array<float,2>{0.427235842f, 0.625169396f},
-std::array<float,2>{0.595674813f, 0.31356442f},
-std::array<float,2>{0.936680853f, 0.964128494f},
-std::array<float,2>{0.116141848f, 0.18279694f},
-std::array<float,2>{0.443081707f, 0.874250472f},
-std::array<float,2>{0.524596751f, 0.0352111571f},
-std::array<float,2>{0.939917207f, 0.516057909f},
-std::array<float,2>{0.0386846997f, 0.454448968f},
-std::array<float,2>{0.197769523f, 0.698015273f},
-std::array<float,2>{0.829565525f, 0.281065077f},
-std::array<float,2>{0.673802197f, 0.906442583f},
-std::array<float,2>{0.338403046f, 0.248778477f},
-std::array<float,2>{0.0688821822f, 0.994002521f},
-std::array<float,2>{0.883082926f, 0.135530055f},
-std::array<float,2>{0.591016173f, 0.661325872f},
-std::array<float,2>{0.377854466f, 0.350520253f},
-std::array<float,2>{0.274700463f, 0.613188267f},
-std::array<float,2>{0.727933943f, 0.395553559f},
-std::array<float,2>{0.811156929f, 0.766221404f},
-std::array<float,2>{0.186954618f, 0.0811438039f},
-std::array<float,2>{0.36013779f, 0.804950416f},
-std::array<float,2>{0.653194726f, 0.1226466f},
-std::array<float,2>{0.862563968f, 0.588479877f},
-std::array<float,2>{0.228198335f, 0.433638602f},
-std::array<float,2>{0.0102986479f, 0.635728121f},
-std::array<float,2>{0.974103868f, 0.323824674f},
-std::array<float,2>{0.540030897f, 0.95842272f},
-std::array<float,2>{0.482972741f, 0.172187641f},
-std::array<float,2>{0.14231734f, 0.904937983f},
-std::array<float,2>{0.763970077f, 0.217772767f},
-std::array<float,2>{0.704041123f, 0.736908019f},
-std::array<float,2>{0.281812966f, 0.283334434f},
-std::array<float,2>{0.416978031f, 0.539327621f},
-std::array<float,2>{0.619475842f, 0.475595087f},
-std::array<float,2>{0.917569399f, 0.814808965f},
-std::array<float,2>{0.0943010449f, 0.0198479258f},
-std::array<float,2>{0.46399045f, 0.988914907f},
-std::array<float,2>{0.513162553f, 0.131330907f},
-std::array<float,2>{0.964864016f, 0.671517193f},
-std::array<float,2>{0.052432403f, 0.354814082f},
-std::array<float,2>{0.213950992f, 0.617421031f},
-std::array<float,2>{0.818207979f, 0.401781142f},
-std::array<float,2>{0.661790013f, 0.774023235f},
-std::array<float,2>{0.319561273f, 0.0920478255f},
-std::array<float,2>{0.0790313929f, 0.861545205f},
-std::array<float,2>{0.892493844f, 0.0421411097f},
-std::array<float,2>{0.572904706f, 0.526750684f},
-std::array<float,2>{0.395011574f, 0.462603003f},
-std::array<float,2>{0.257034838f, 0.68765372f},
-std::array<float,2>{0.746332824f, 0.27098003f},
-std::array<float,2>{0.784922779f, 0.920438409f},
-std::array<float,2>{0.158895493f, 0.238331214f},
-std::array<float,2>{0.297058582f, 0.923225403f},
-std::array<float,2>{0.701763332f, 0.226489499f},
-std::array<float,2>{0.769189417f, 0.714050293f},
-std::array<float,2>{0.130284488f, 0.260083824f},
-std::array<float,2>{0.111710384f, 0.504492939f},
-std::array<float,2>{0.932422221f, 0.43814382f},
-std::array<float,2>{0.598995745f, 0.853036761f},
-std::array<float,2>{0.423838466f, 0.0609554611f},
-std::array<float,2>{0.237717837f, 0.759297192f},
-std::array<float,2>{0.849678516f, 0.0766669214f},
-std::array<float,2>{0.628293633f, 0.604754388f},
-std::array<float,2>{0.345262915f, 0.38308093f},
-std::array<float,2>{0.489206493f, 0.682952762f},
-std::array<float,2>{0.559959352f, 0.361383736f},
-std::array<float,2>{0.999582469f, 0.975893557f},
-std::array<float,2>{0.0164351724f, 0.156233847f},
-std::array<float,2>{0.382686675f, 0.842939258f},
-std::array<float,2>{0.588788927f, 0.00298428256f},
-std::array<float,2>{0.888400674f, 0.562140048f},
-std::array<float,2>{0.0658970475f, 0.492343187f},
-std::array<float,2>{0.17999047f, 0.720252395f},
-std::array<float,2>{0.806913018f, 0.300808609f},
-std::array<float,2>{0.73104769f, 0.888878882f},
-std::array<float,2>{0.279697478f, 0.193373337f},
-std::array<float,2>{0.032501284f, 0.940410674f},
-std::array<float,2>{0.944700718f, 0.160950422f},
-std::array<float,2>{0.528115988f, 0.646806657f},
-std::array<float,2>{0.43991065f, 0.340984762f},
-std::array<float,2>{0.340159684f, 0.569465876f},
-std::array<float,2>{0.676485181f, 0.40907979f},
-std::array<float,2>{0.83399415f, 0.795266449f},
-std::array<float,2>{0.202641651f, 0.0996066481f},
-std::array<float,2>{0.27035737f, 0.850596488f},
-std::array<float,2>{0.720030427f, 0.0474122502f},
-std::array<float,2>{0.801667333f, 0.514192402f},
-std::array<float,2>{0.172837108f, 0.446879745f},
-std::array<float,2>{0.0718215331f, 0.704692543f},
-std::array<float,2>{0.87911135f, 0.251045853f},
-std::array<float,2>{0.581768751f, 0.932237089f},
-std::array<float,2>{0.38770318f, 0.227996111f},
-std::array<float,2>{0.193956703f, 0.979961812f},
-std::array<float,2>{0.838236868f, 0.146511987f},
-std::array<float,2>{0.686715662f, 0.675367773f},
-std::array<float,2>{0.330944031f, 0.370947778f},
-std::array<float,2>{0.446858227f, 0.595099926f},
-std::array<float,2>{0.51750952f, 0.379278868f},
-std::array<float,2>{0.950094461f, 0.750698745f},
-std::array<float,2>{0.044806771f, 0.0662727803f},
-std::array<float,2>{0.435512245f, 0.878157437f},
-std::array<float,2>{0.605613828f, 0.199534759f},
-std::array<float,2>{0.927325904f, 0.72925806f},
-std::array<float,2>{0.1195077f, 0.309903115f},
-std::array<float,2>{0.133258134f, 0.552347064f},
-std::array<float,2>{0.77456075f, 0.489766181f},
-std::array<float,2>{0.691805124f, 0.834482014f},
-std::array<float,2>{0.311205626f, 0.0134835774f},
-std::array<float,2>{0.0288773067f, 0.782318115f},
-std::array<float,2>{0.987914205f, 0.105190523f},
-std::array<float,2>{0.550596893f, 0.576753974f},
-std::array<float,2>{0.492381483f, 0.417479903f},
-std::array<float,2>{0.353815764f, 0.649012804f},
-std::array<float,2>{0.640407026f, 0.329326421f},
-std::array<float,2>{0.858368516f, 0.950847268f},
-std::array<float,2>{0.247008041f, 0.168794915f},
-std::array<float,2>{0.327055782f, 0.968138695f},
-std::array<float,2>{0.668222308f, 0.186907992f},
-std::array<float,2>{0.824921906f, 0.630126715f},
-std::array<float,2>{0.208579764f, 0.317806095f},
-std::array<float,2>{0.061128892f, 0.582948446f},
-std::array<float,2>{0.958625555f, 0.427871972f},
-std::array<float,2>{0.50057745f, 0.797191501f},
-std::array<float,2>{0.458142489f, 0.116969347f},
-std::array<float,2>{0.166506156f, 0.826806843f},
-std::array<float,2>{0.795896411f, 0.0252017323f},
-std::array<float,2>{0.740795612f, 0.535601139f},
-std::array<float,2>{0.263281405f, 0.479111731f},
-std::array<float,2>{0.40168494f, 0.74916023f},
-std::array<float,2>{0.563711226f, 0.292423964f},
-std::array<float,2>{0.904782712f, 0.893394113f},
-std::array<float,2>{0.0908149332f, 0.206060827f},
-std::array<float,2>{0.472505897f, 0.77258575f},
-std::array<float,2>{0.535274446f, 0.0820821077f},
-std::array<float,2>{0.983378351f, 0.61359942f},
-std::array<float,2>{0.00135658961f, 0.39447102f},
-std::array<float,2>{0.222550333f, 0.657513499f},
-std::array<float,2>{0.87289238f, 0.346708298f},
-std::array<float,2>{0.644623399f, 0.998502851f},
-std::array<float,2>{0.370851934f, 0.139818296f},
-std::array<float,2>{0.105728962f, 0.911626518f},
-std::array<float,2>{0.910130858f, 0.24289915f},
-std::array<float,2>{0.614344418f, 0.700905681f},
-std::array<float,2>{0.406582087f, 0.276612341f},
-std::array<float,2>{0.293433696f, 0.52310586f},
-std::array<float,2>{0.71551913f, 0.459455162f},
-std::array<float,2>{0.755384386f, 0.86883688f},
-std::array<float,2>{0.149578929f, 0.0315935612f},
-std::array<float,2>{0.35923937f, 0.865968049f},
-std::array<float,2>{0.636679113f, 0.0455937944f},
-std::array<float,2>{0.852239013f, 0.529344797f},
-std::array<float,2>{0.245963573f, 0.465843052f},
-std::array<float,2>{0.0247666482f, 0.693197727f},
-std::array<float,2>{0.989963293f, 0.267508686f},
-std::array<float,2>{0.554160595f, 0.915920675f},
-std::array<float,2>{0.498598576f, 0.236413762f},
-std::array<float,2>{0.137000427f, 0.984630525f},
-std::array<float,2>{0.777925789f, 0.125106022f},
-std::array<float,2>{0.688023984f, 0.665695488f},
-std::array<float,2>{0.305137068f, 0.355958372f},
-std::array<float,2>{0.430991888f, 0.622623146f},
-std::array<float,2>{0.604813516f, 0.403961986f},
-std::array<float,2>{0.922807753f, 0.778527677f},
-std::array<float,2>{0.123662896f, 0.0873504803f},
-std::array<float,2>{0.452486217f, 0.899030447f},
-std::array<float,2>{0.521385431f, 0.21436891f},
-std::array<float,2>{0.945762098f, 0.740082681f},
-std::array<float,2>{0.0417765118f, 0.287090063f},
-std::array<float,2>{0.189665273f, 0.546210706f},
-std::array<float,2>{0.842175364f, 0.471409529f},
-std::array<float,2>{0.682876587f, 0.818224311f},
-std::array<float,2>{0.334864885f, 0.0191441216f},
-std::array<float,2>{0.0762189254f, 0.810175657f},
-std::array<float,2>{0.875893474f, 0.118718058f},
-std::array<float,2>{0.585320771f, 0.590886116f},
-std::array<float,2>{0.386535764f, 0.430847317f},
-std::array<float,2>{0.266530454f, 0.637275517f},
-std::array<float,2>{0.723650157f, 0.325724393f},
-std::array<float,2>{0.796891272f, 0.953602552f},
-std::array<float,2>{0.17799677f, 0.176362216f},
-std::array<float,2>{0.292477518f, 0.945138991f},
-std::array<float,2>{0.712044358f, 0.157998219f},
-std::array<float,2>{0.750482142f, 0.641524673f},
-std::array<float,2>{0.155912742f, 0.336699903f},
-std::array<float,2>{0.104738638f, 0.563440025f},
-std::array<float,2>{0.911182761f, 0.411259323f},
-std::array<float,2>{0.610926569f, 0.79088521f},
-std::array<float,2>{0.411819816f, 0.0969291925f},
-std::array<float,2>{0.224163681f, 0.837698877f},
-std::array<float,2>{0.870879829f, 0.00721538067f},
-std::array<float,2>{0.642553091f, 0.556419313f},
-std::array<float,2>{0.373637021f, 0.499063939f},
-std::array<float,2>{0.47278741f, 0.725382328f},
-std::array<float,2>{0.532096505f, 0.29881531f},
-std::array<float,2>{0.980130076f, 0.884959817f},
-std::array<float,2>{0.00736402301f, 0.188512906f},
-std::array<float,2>{0.403749555f, 0.763059795f},
-std::array<float,2>{0.568386257f, 0.0714270398f},
-std::array<float,2>{0.899580777f, 0.605527639f},
-std::array<float,2>{0.0888237581f, 0.389683276f},
-std::array<float,2>{0.17052196f, 0.684483469f},
-std::array<float,2>{0.790719867f, 0.363959312f},
-std::array<float,2>{0.734495878f, 0.970826447f},
-std::array<float,2>{0.260514408f, 0.149488077f},
-std::array<float,2>{0.0555956624f, 0.928038299f},
-std::array<float,2>{0.955211759f, 0.220870331f},
-std::array<float,2>{0.506164014f, 0.716519892f},
-std::array<float,2>{0.455011874f, 0.263884455f},
-std::array<float,2>{0.322053015f, 0.500687301f},
-std::array<float,2>{0.664493382f, 0.4414092f},
-std::array<float,2>{0.823737264f, 0.859273732f},
-std::array<float,2>{0.203920513f, 0.056829229f},
-std::array<float,2>{0.252285242f, 0.787889063f},
-std::array<float,2>{0.743598163f, 0.109215386f},
-std::array<float,2>{0.787082076f, 0.571568787f},
-std::array<float,2>{0.16064699f, 0.421605229f},
-std::array<float,2>{0.0841512382f, 0.654852092f},
-std::array<float,2>{0.895872831f, 0.334889919f},
-std::array<float,2>{0.575855494f, 0.946551502f},
-std::array<float,2>{0.393775851f, 0.165223405f},
-std::array<float,2>{0.215810075f, 0.879833102f},
-std::array<float,2>{0.815776706f, 0.199183837f},
-std::array<float,2>{0.66001451f, 0.732904851f},
-std::array<float,2>{0.314932972f, 0.307358354f},
-std::array<float,2>{0.465238839f, 0.547384858f},
-std::array<float,2>{0.50973475f, 0.484856009f},
-std::array<float,2>{0.963969767f, 0.831920385f},
-std::array<float,2>{0.0482583866f, 0.00790641923f},
-std::array<float,2>{0.418245494f, 0.981067061f},
-std::array<float,2>{0.622251928f, 0.14371936f},
-std::array<float,2>{0.919370353f, 0.679134667f},
-std::array<float,2>{0.101477265f, 0.371352762f},
-std::array<float,2>{0.145684719f, 0.598832786f},
-std::array<float,2>{0.760392189f, 0.37849769f},
-std::array<float,2>{0.707885683f, 0.75509119f},
-std::array<float,2>{0.287182808f, 0.0688460022f},
-std::array<float,2>{0.0144604165f, 0.84733963f},
-std::array<float,2>{0.971923649f, 0.0510977022f},
-std::array<float,2>{0.545565486f, 0.508274972f},
-std::array<float,2>{0.478531837f, 0.451140553f},
-std::array<float,2>{0.366405487f, 0.70796591f},
-std::array<float,2>{0.648566961f, 0.254888117f},
-std::array<float,2>{0.866034091f, 0.9363392f},
-std::array<float,2>{0.233266309f, 0.233215734f},
-std::array<float,2>{0.33781603f, 0.909219146f},
-std::array<float,2>{0.675250769f, 0.246506706f},
-std::array<float,2>{0.83130765f, 0.69535774f},
-std::array<float,2>{0.195477232f, 0.278164387f},
-std::array<float,2>{0.0368534178f, 0.518973887f},
-std::array<float,2>{0.938295901f, 0.455832869f},
-std::array<float,2>{0.525764167f, 0.871827841f},
-std::array<float,2>{0.444684327f, 0.0389516316f},
-std::array<float,2>{0.185082212f, 0.769444764f},
-std::array<float,2>{0.809785485f, 0.0794314519f},
-std::array<float,2>{0.729486346f, 0.611299574f},
-std::array<float,2>{0.276272237f, 0.398272961f},
-std::array<float,2>{0.376205236f, 0.662109673f},
-std::array<float,2>{0.592820525f, 0.348795444f},
-std::array<float,2>{0.885996759f, 0.995193064f},
-std::array<float,2>{0.0675403103f, 0.133858144f},
-std::array<float,2>{0.486087203f, 0.82066679f},
-std::array<float,2>{0.555832505f, 0.031050032f},
-std::array<float,2>{0.995829701f, 0.534229279f},
-std::array<float,2>{0.0216804277f, 0.483924031f},
-std::array<float,2>{0.240500316f, 0.745637774f},
-std::array<float,2>{0.845586181f, 0.294669539f},
-std::array<float,2>{0.631927848f, 0.897185445f},
-std::array<float,2>{0.350518376f, 0.210691616f},
-std::array<float,2>{0.114170201f, 0.962137163f},
-std::array<float,2>{0.93516928f, 0.180102631f},
-std::array<float,2>{0.596696615f, 0.628260016f},
-std::array<float,2>{0.42811501f, 0.315183848f},
-std::array<float,2>{0.302265912f, 0.581766188f},
-std::array<float,2>{0.698570132f, 0.424614608f},
-std::array<float,2>{0.770597041f, 0.800809085f},
-std::array<float,2>{0.125701502f, 0.112123922f},
-std::array<float,2>{0.317774355f, 0.777210832f},
-std::array<float,2>{0.663988292f, 0.090955928f},
-std::array<float,2>{0.819394708f, 0.619472861f},
-std::array<float,2>{0.212369263f, 0.398662806f},
-std::array<float,2>{0.054113932f, 0.66853416f},
-std::array<float,2>{0.96736306f, 0.353353739f},
-std::array<float,2>{0.514711738f, 0.990614533f},
-std::array<float,2>{0.462393403f, 0.130632401f},
-std::array<float,2>{0.156287313f, 0.918162227f},
-std::array<float,2>{0.782969475f, 0.240269229f},
-std::array<float,2>{0.748313546f, 0.689539075f},
-std::array<float,2>{0.254025787f, 0.273409039f},
-std::array<float,2>{0.397289574f, 0.525196254f},
-std::array<float,2>{0.571160495f, 0.463038921f},
-std::array<float,2>{0.894035757f, 0.860383332f},
-std::array<float,2>{0.0818241164f, 0.0402144305f},
-std::array<float,2>{0.481886089f, 0.959996521f},
-std::array<float,2>{0.541777492f, 0.174876332f},
-std::array<float,2>{0.975265324f, 0.633977532f},
-std::array<float,2>{0.00788159296f, 0.321891844f},
-std::array<float,2>{0.229689062f, 0.587110877f},
-std::array<float,2>{0.860838652f, 0.43575564f},
-std::array<float,2>{0.65603745f, 0.808097124f},
-std::array<float,2>{0.362790465f, 0.123342536f},
-std::array<float,2>{0.0958335549f, 0.813476145f},
-std::array<float,2>{0.914364517f, 0.0216416735f},
-std::array<float,2>{0.618132889f, 0.541380584f},
-std::array<float,2>{0.415821224f, 0.474333555f},
-std::array<float,2>{0.284270287f, 0.736282289f},
-std::array<float,2>{0.705910087f, 0.281350821f},
-std::array<float,2>{0.763088465f, 0.902602434f},
-std::array<float,2>{0.144456208f, 0.215272471f},
-std::array<float,2>{0.27893424f, 0.887848318f},
-std::array<float,2>{0.733595133f, 0.192553163f},
-std::array<float,2>{0.805997074f, 0.722375751f},
-std::array<float,2>{0.1818977f, 0.303785682f},
-std::array<float,2>{0.0643232912f, 0.560197413f},
-std::array<float,2>{0.888764441f, 0.495684683f},
-std::array<float,2>{0.587228477f, 0.84077704f},
-std::array<float,2>{0.380844384f, 0.000367243658f},
-std::array<float,2>{0.200504929f, 0.793405592f},
-std::array<float,2>{0.833543301f, 0.100708269f},
-std::array<float,2>{0.679304242f, 0.568016708f},
-std::array<float,2>{0.342665851f, 0.407512277f},
-std::array<float,2>{0.437881559f, 0.64579463f},
-std::array<float,2>{0.530454695f, 0.341925591f},
-std::array<float,2>{0.941700995f, 0.937698901f},
-std::array<float,2>{0.0346475765f, 0.163563743f},
-std::array<float,2>{0.42254889f, 0.855377853f},
-std::array<float,2>{0.601373553f, 0.0593419895f},
-std::array<float,2>{0.931109846f, 0.50662452f},
-std::array<float,2>{0.111309484f, 0.441025496f},
-std::array<float,2>{0.130901545f, 0.711286783f},
-std::array<float,2>{0.766936958f, 0.258580714f},
-std::array<float,2>{0.699998617f, 0.925482392f},
-std::array<float,2>{0.299601942f, 0.224251851f},
-std::array<float,2>{0.0176840201f, 0.974382758f},
-std::array<float,2>{0.996688902f, 0.152546316f},
-std::array<float,2>{0.561246634f, 0.681519508f},
-std::array<float,2>{0.490963042f, 0.359960765f},
-std::array<float,2>{0.34638238f, 0.602598131f},
-std::array<float,2>{0.626167595f, 0.385831922f},
-std::array<float,2>{0.848150492f, 0.761096179f},
-std::array<float,2>{0.234886453f, 0.0746875331f},
-std::array<float,2>{0.30870384f, 0.832215548f},
-std::array<float,2>{0.694581568f, 0.0151253883f},
-std::array<float,2>{0.777198195f, 0.553819418f},
-std::array<float,2>{0.135611668f, 0.491178244f},
-std::array<float,2>{0.118573427f, 0.728237689f},
-std::array<float,2>{0.92822659f, 0.311630219f},
-std::array<float,2>{0.607731462f, 0.87658f},
-std::array<float,2>{0.436609894f, 0.201475635f},
-std::array<float,2>{0.248231426f, 0.951216996f},
-std::array<float,2>{0.857173383f, 0.171831265f},
-std::array<float,2>{0.637165904f, 0.651618004f},
-std::array<float,2>{0.353369325f, 0.330897838f},
-std::array<float,2>{0.494221956f, 0.575708866f},
-std::array<float,2>{0.548763573f, 0.415181369f},
-std::array<float,2>{0.986189008f, 0.78448832f},
-std::array<float,2>{0.0295777284f, 0.102009401f},
-std::array<float,2>{0.388928592f, 0.931144774f},
-std::array<float,2>{0.57959938f, 0.2289574f},
-std::array<float,2>{0.880960226f, 0.706172943f},
-std::array<float,2>{0.0732638761f, 0.253182262f},
-std::array<float,2>{0.175006807f, 0.51301831f},
-std::array<float,2>{0.804144204f, 0.449071407f},
-std::array<float,2>{0.720883846f, 0.848210573f},
-std::array<float,2>{0.272742242f, 0.0490823612f},
-std::array<float,2>{0.0463582054f, 0.752681494f},
-std::array<float,2>{0.951537371f, 0.0631184727f},
-std::array<float,2>{0.517965257f, 0.597235739f},
-std::array<float,2>{0.448646337f, 0.382769734f},
-std::array<float,2>{0.328388482f, 0.672089517f},
-std::array<float,2>{0.684404671f, 0.369100958f},
-std::array<float,2>{0.83697629f, 0.977205575f},
-std::array<float,2>{0.193124875f, 0.145837367f},
-std::array<float,2>{0.367190897f, 0.997618198f},
-std::array<float,2>{0.647894204f, 0.136730582f},
-std::array<float,2>{0.873979986f, 0.658252776f},
-std::array<float,2>{0.219741508f, 0.344078481f},
-std::array<float,2>{0.00213191658f, 0.616480231f},
-std::array<float,2>{0.98116529f, 0.391740292f},
-std::array<float,2>{0.537597597f, 0.770945966f},
-std::array<float,2>{0.470311642f, 0.0859251544f},
-std::array<float,2>{0.150420651f, 0.870679677f},
-std::array<float,2>{0.756280959f, 0.0345938466f},
-std::array<float,2>{0.717538416f, 0.519823432f},
-std::array<float,2>{0.296584427f, 0.458159477f},
-std::array<float,2>{0.409416527f, 0.701664507f},
-std::array<float,2>{0.616957009f, 0.274190664f},
-std::array<float,2>{0.907854021f, 0.912484229f},
-std::array<float,2>{0.108545683f, 0.244879186f},
-std::array<float,2>{0.459452897f, 0.799026668f},
-std::array<float,2>{0.502143741f, 0.114748619f},
-std::array<float,2>{0.959298134f, 0.584620416f},
-std::array<float,2>{0.0591332726f, 0.427262634f},
-std::array<float,2>{0.209367409f, 0.63206619f},
-std::array<float,2>{0.826353133f, 0.318421483f},
-std::array<float,2>{0.670112371f, 0.965813279f},
-std::array<float,2>{0.324569285f, 0.185110837f},
-std::array<float,2>{0.0929013714f, 0.891590178f},
-std::array<float,2>{0.903663218f, 0.203997374f},
-std::array<float,2>{0.564667404f, 0.747283041f},
-std::array<float,2>{0.400362015f, 0.289105594f},
-std::array<float,2>{0.264824271f, 0.53748244f},
-std::array<float,2>{0.738585889f, 0.478513002f},
-std::array<float,2>{0.79315567f, 0.825110257f},
-std::array<float,2>{0.164959669f, 0.0272060893f},
-std::array<float,2>{0.322959751f, 0.857627094f},
-std::array<float,2>{0.667384207f, 0.0584040619f},
-std::array<float,2>{0.820583284f, 0.501702249f},
-std::array<float,2>{0.206829786f, 0.442927629f},
-std::array<float,2>{0.0568795092f, 0.714888692f},
-std::array<float,2>{0.953619421f, 0.265384674f},
-std::array<float,2>{0.505774617f, 0.929392397f},
-std::array<float,2>{0.456358045f, 0.22264041f},
-std::array<float,2>{0.168005288f, 0.972592056f},
-std::array<float,2>{0.79201895f, 0.148682103f},
-std::array<float,2>{0.738174617f, 0.685377777f},
-std::array<float,2>{0.258265883f, 0.36509791f},
-std::array<float,2>{0.404658437f, 0.606712401f},
-std::array<float,2>{0.566705942f, 0.389372975f},
-std::array<float,2>{0.901820421f, 0.762369275f},
-std::array<float,2>{0.0870632008f, 0.0708752051f},
-std::array<float,2>{0.474918038f, 0.886288524f},
-std::array<float,2>{0.534835517f, 0.18780762f},
-std::array<float,2>{0.978294671f, 0.726385713f},
-std::array<float,2>{0.00439888565f, 0.297375113f},
-std::array<float,2>{0.226220161f, 0.555487275f},
-std::array<float,2>{0.868825614f, 0.49838239f},
-std::array<float,2>{0.644177496f, 0.83624953f},
-std::array<float,2>{0.372898608f, 0.00677224435f},
-std::array<float,2>{0.102525264f, 0.789763927f},
-std::array<float,2>{0.912565768f, 0.0966288f},
-std::array<float,2>{0.611715019f, 0.563639641f},
-std::array<float,2>{0.413294315f, 0.410736501f},
-std::array<float,2>{0.289116919f, 0.641684234f},
-std::array<float,2>{0.71367991f, 0.337113678f},
-std::array<float,2>{0.752223551f, 0.944099545f},
-std::array<float,2>{0.153742656f, 0.156942606f},
-std::array<float,2>{0.269343495f, 0.954422355f},
-std::array<float,2>{0.725075305f, 0.177091688f},
-std::array<float,2>{0.799348652f, 0.637903512f},
-std::array<float,2>{0.176594779f, 0.324256837f},
-std::array<float,2>{0.0742909312f, 0.590656817f},
-std::array<float,2>{0.87776947f, 0.430314541f},
-std::array<float,2>{0.583080351f, 0.808879197f},
-std::array<float,2>{0.384562582f, 0.117209747f},
-std::array<float,2>{0.189260051f, 0.816954315f},
-std::array<float,2>{0.840286851f, 0.0181212965f},
-std::array<float,2>{0.679984927f, 0.545672059f},
-std::array<float,2>{0.332623363f, 0.47189495f},
-std::array<float,2>{0.450622737f, 0.739141881f},
-std::array<float,2>{0.523431361f, 0.286112875f},
-std::array<float,2>{0.947434366f, 0.899984837f},
-std::array<float,2>{0.0393378362f, 0.213814884f},
-std::array<float,2>{0.432689279f, 0.778077364f},
-std::array<float,2>{0.603477061f, 0.0867631808f},
-std::array<float,2>{0.925404012f, 0.621538699f},
-std::array<float,2>{0.122290447f, 0.403038621f},
-std::array<float,2>{0.13958846f, 0.664457858f},
-std::array<float,2>{0.780774415f, 0.356497437f},
-std::array<float,2>{0.690881848f, 0.986220002f},
-std::array<float,2>{0.306645542f, 0.126055986f},
-std::array<float,2>{0.027323978f, 0.914999902f},
-std::array<float,2>{0.991938591f, 0.238243461f},
-std::array<float,2>{0.550833762f, 0.691601992f},
-std::array<float,2>{0.49628529f, 0.266052574f},
-std::array<float,2>{0.3569282f, 0.530937016f},
-std::array<float,2>{0.634099305f, 0.465415269f},
-std::array<float,2>{0.855397046f, 0.867124975f},
-std::array<float,2>{0.243345037f, 0.0468286015f},
-std::array<float,2>{0.303594977f, 0.802408695f},
-std::array<float,2>{0.69582653f, 0.112631604f},
-std::array<float,2>{0.772672057f, 0.580109119f},
-std::array<float,2>{0.128648594f, 0.425645173f},
-std::array<float,2>{0.116746522f, 0.627402782f},
-std::array<float,2>{0.936283708f, 0.31585291f},
-std::array<float,2>{0.59428972f, 0.961830854f},
-std::array<float,2>{0.426154703f, 0.181335315f},
-std::array<float,2>{0.238690212f, 0.897707045f},
-std::array<float,2>{0.845968664f, 0.209539711f},
-std::array<float,2>{0.630701244f, 0.74505645f},
-std::array<float,2>{0.348765373f, 0.293678164f},
-std::array<float,2>{0.486570418f, 0.53378427f},
-std::array<float,2>{0.557003796f, 0.48291707f},
-std::array<float,2>{0.992806315f, 0.821293712f},
-std::array<float,2>{0.0196027644f, 0.0299151875f},
-std::array<float,2>{0.378192037f, 0.994413614f},
-std::array<float,2>{0.589926541f, 0.133328959f},
-std::array<float,2>{0.884595931f, 0.663983583f},
-std::array<float,2>{0.0697524548f, 0.347666234f},
-std::array<float,2>{0.186104134f, 0.609660566f},
-std::array<float,2>{0.812411129f, 0.397118419f},
-std::array<float,2>{0.726855993f, 0.767724633f},
-std::array<float,2>{0.273554564f, 0.0785084218f},
-std::array<float,2>{0.0377111211f, 0.872247219f},
-std::array<float,2>{0.940544665f, 0.0378133208f},
-std::array<float,2>{0.523860753f, 0.517655909f},
-std::array<float,2>{0.441825569f, 0.456279218f},
-std::array<float,2>{0.339116037f, 0.696894348f},
-std::array<float,2>{0.672583282f, 0.279269487f},
-std::array<float,2>{0.828813136f, 0.908450902f},
-std::array<float,2>{0.198298067f, 0.247665256f},
-std::array<float,2>{0.36345911f, 0.936590314f},
-std::array<float,2>{0.650693655f, 0.233630747f},
-std::array<float,2>{0.865192413f, 0.708210409f},
-std::array<float,2>{0.231791258f, 0.254443347f},
-std::array<float,2>{0.0117901759f, 0.509526849f},
-std::array<float,2>{0.970309973f, 0.449910432f},
-std::array<float,2>{0.544135749f, 0.845958948f},
-std::array<float,2>{0.477234125f, 0.0524484292f},
-std::array<float,2>{0.146753833f, 0.754786432f},
-std::array<float,2>{0.75947541f, 0.0694114789f},
-std::array<float,2>{0.709424913f, 0.598062277f},
-std::array<float,2>{0.286207229f, 0.376964033f},
-std::array<float,2>{0.420322955f, 0.67789191f},
-std::array<float,2>{0.624142289f, 0.37228626f},
-std::array<float,2>{0.92084384f, 0.982057571f},
-std::array<float,2>{0.098020196f, 0.142609611f},
-std::array<float,2>{0.467607528f, 0.830569029f},
-std::array<float,2>{0.511357129f, 0.00894012209f},
-std::array<float,2>{0.962045014f, 0.548160434f},
-std::array<float,2>{0.0507414937f, 0.485740721f},
-std::array<float,2>{0.218169868f, 0.733523488f},
-std::array<float,2>{0.813722014f, 0.308056444f},
-std::array<float,2>{0.657330632f, 0.880098462f},
-std::array<float,2>{0.314280152f, 0.198196441f},
-std::array<float,2>{0.0836804286f, 0.945480824f},
-std::array<float,2>{0.898047924f, 0.165029988f},
-std::array<float,2>{0.577908158f, 0.656110942f},
-std::array<float,2>{0.392098099f, 0.335291594f},
-std::array<float,2>{0.251618475f, 0.571172416f},
-std::array<float,2>{0.745390177f, 0.420042753f},
-std::array<float,2>{0.787425399f, 0.788708985f},
-std::array<float,2>{0.163638771f, 0.107848771f},
-std::array<float,2>{0.343837202f, 0.759971201f},
-std::array<float,2>{0.62792635f, 0.0759363323f},
-std::array<float,2>{0.850594997f, 0.60206306f},
-std::array<float,2>{0.23728475f, 0.384931743f},
-std::array<float,2>{0.0168187469f, 0.680123866f},
-std::array<float,2>{0.99867171f, 0.361076146f},
-std::array<float,2>{0.559499741f, 0.972865582f},
-std::array<float,2>{0.489481062f, 0.15399377f},
-std::array<float,2>{0.129592061f, 0.9246943f},
-std::array<float,2>{0.767721951f, 0.223501325f},
-std::array<float,2>{0.702391505f, 0.712823927f},
-std::array<float,2>{0.298352212f, 0.259428144f},
-std::array<float,2>{0.424949259f, 0.507278919f},
-std::array<float,2>{0.598419785f, 0.440048724f},
-std::array<float,2>{0.9334988f, 0.853558183f},
-std::array<float,2>{0.11308831f, 0.0599491037f},
-std::array<float,2>{0.441049039f, 0.938660622f},
-std::array<float,2>{0.528323472f, 0.162756383f},
-std::array<float,2>{0.943764091f, 0.644990146f},
-std::array<float,2>{0.031897679f, 0.342895478f},
-std::array<float,2>{0.201289102f, 0.567285419f},
-std::array<float,2>{0.835834146f, 0.406846076f},
-std::array<float,2>{0.677261114f, 0.794862092f},
-std::array<float,2>{0.340976268f, 0.10021539f},
-std::array<float,2>{0.0645590201f, 0.841334581f},
-std::array<float,2>{0.887525499f, 0.00126487692f},
-std::array<float,2>{0.589025438f, 0.559342146f},
-std::array<float,2>{0.380987108f, 0.494529366f},
-std::array<float,2>{0.281127185f, 0.721499681f},
-std::array<float,2>{0.731881082f, 0.303703368f},
-std::array<float,2>{0.807787299f, 0.887213051f},
-std::array<float,2>{0.181106478f, 0.192005411f},
-std::array<float,2>{0.282892227f, 0.903633118f},
-std::array<float,2>{0.705025375f, 0.216531545f},
-std::array<float,2>{0.764906883f, 0.734996676f},
-std::array<float,2>{0.141381055f, 0.283053696f},
-std::array<float,2>{0.0951229632f, 0.54240489f},
-std::array<float,2>{0.916649699f, 0.472840607f},
-std::array<float,2>{0.621053874f, 0.814028561f},
-std::array<float,2>{0.417053878f, 0.0233106669f},
-std::array<float,2>{0.226681322f, 0.807089329f},
-std::array<float,2>{0.862093389f, 0.124655128f},
-std::array<float,2>{0.653391242f, 0.58628875f},
-std::array<float,2>{0.361201316f, 0.437297106f},
-std::array<float,2>{0.484260827f, 0.633251548f},
-std::array<float,2>{0.540712118f, 0.321210772f},
-std::array<float,2>{0.97342211f, 0.959937096f},
-std::array<float,2>{0.0111769531f, 0.174139768f},
-std::array<float,2>{0.39551276f, 0.859992087f},
-std::array<float,2>{0.574137032f, 0.0400160439f},
-std::array<float,2>{0.890798926f, 0.524062216f},
-std::array<float,2>{0.0796651691f, 0.46403423f},
-std::array<float,2>{0.159645841f, 0.69085151f},
-std::array<float,2>{0.783489048f, 0.27208212f},
-std::array<float,2>{0.747634947f, 0.919279039f},
-std::array<float,2>{0.256587833f, 0.241620928f},
-std::array<float,2>{0.0517258495f, 0.991416812f},
-std::array<float,2>{0.966074169f, 0.129169449f},
-std::array<float,2>{0.511920393f, 0.668985903f},
-std::array<float,2>{0.463391781f, 0.352201849f},
-std::array<float,2>{0.319288313f, 0.620595574f},
-std::array<float,2>{0.66067183f, 0.399442852f},
-std::array<float,2>{0.816518366f, 0.775557578f},
-std::array<float,2>{0.213375881f, 0.0900182799f},
-std::array<float,2>{0.262533158f, 0.825790048f},
-std::array<float,2>{0.741880238f, 0.025660811f},
-std::array<float,2>{0.796576262f, 0.53830719f},
-std::array<float,2>{0.167206392f, 0.477195889f},
-std::array<float,2>{0.0916962847f, 0.746980429f},
-std::array<float,2>{0.906238735f, 0.290451229f},
-std::array<float,2>{0.563287854f, 0.891864359f},
-std::array<float,2>{0.401322991f, 0.204685599f},
-std::array<float,2>{0.207742631f, 0.965897977f},
-std::array<float,2>{0.825894058f, 0.184182003f},
-std::array<float,2>{0.669557929f, 0.631721973f},
-std::array<float,2>{0.327473849f, 0.319786936f},
-std::array<float,2>{0.457364202f, 0.584998846f},
-std::array<float,2>{0.501740336f, 0.42637676f},
-std::array<float,2>{0.957069039f, 0.800227821f},
-std::array<float,2>{0.0617805831f, 0.114097662f},
-std::array<float,2>{0.407983392f, 0.913200736f},
-std::array<float,2>{0.614058673f, 0.245619625f},
-std::array<float,2>{0.909172833f, 0.702698052f},
-std::array<float,2>{0.106638104f, 0.275271595f},
-std::array<float,2>{0.148757309f, 0.521020651f},
-std::array<float,2>{0.754561126f, 0.457287848f},
-std::array<float,2>{0.716378391f, 0.869833767f},
-std::array<float,2>{0.294893563f, 0.0336453915f},
-std::array<float,2>{0.000590404379f, 0.769779563f},
-std::array<float,2>{0.984250188f, 0.0840378404f},
-std::array<float,2>{0.536925018f, 0.615339696f},
-std::array<float,2>{0.471001148f, 0.391057611f},
-std::array<float,2>{0.369294643f, 0.659314394f},
-std::array<float,2>{0.645658016f, 0.345464468f},
-std::array<float,2>{0.871611834f, 0.996901512f},
-std::array<float,2>{0.221648768f, 0.137876853f},
-std::array<float,2>{0.331689149f, 0.978491366f},
-std::array<float,2>{0.686502695f, 0.145127192f},
-std::array<float,2>{0.83902818f, 0.673014343f},
-std::array<float,2>{0.194844708f, 0.367814571f},
-std::array<float,2>{0.0431724004f, 0.596051574f},
-std::array<float,2>{0.95078516f, 0.380880237f},
-std::array<float,2>{0.515942335f, 0.753825009f},
-std::array<float,2>{0.445446819f, 0.0636422411f},
-std::array<float,2>{0.173669681f, 0.849047661f},
-std::array<float,2>{0.802599907f, 0.0506178476f},
-std::array<float,2>{0.719400167f, 0.511723757f},
-std::array<float,2>{0.271468788f, 0.447507977f},
-std::array<float,2>{0.387573898f, 0.705165803f},
-std::array<float,2>{0.580322504f, 0.252499104f},
-std::array<float,2>{0.880520046f, 0.929778695f},
-std::array<float,2>{0.0711922199f, 0.230004624f},
-std::array<float,2>{0.493997514f, 0.783215702f},
-std::array<float,2>{0.549409091f, 0.1026939f},
-std::array<float,2>{0.987024844f, 0.574833751f},
-std::array<float,2>{0.0275644548f, 0.414994895f},
-std::array<float,2>{0.247902781f, 0.65063709f},
-std::array<float,2>{0.858748078f, 0.331939101f},
-std::array<float,2>{0.6389938f, 0.952318251f},
-std::array<float,2>{0.355095357f, 0.170847103f},
-std::array<float,2>{0.120296597f, 0.875002623f},
-std::array<float,2>{0.926262856f, 0.202340007f},
-std::array<float,2>{0.606796563f, 0.726791501f},
-std::array<float,2>{0.4343144f, 0.31120038f},
-std::array<float,2>{0.312181056f, 0.553275704f},
-std::array<float,2>{0.692883492f, 0.491806388f},
-std::array<float,2>{0.773893476f, 0.833977759f},
-std::array<float,2>{0.133953243f, 0.0142864194f},
-std::array<float,2>{0.374707967f, 0.839532256f},
-std::array<float,2>{0.641424119f, 0.00501082372f},
-std::array<float,2>{0.869386733f, 0.556761503f},
-std::array<float,2>{0.222845569f, 0.496909291f},
-std::array<float,2>{0.00595643558f, 0.723255515f},
-std::array<float,2>{0.979309201f, 0.299305081f},
-std::array<float,2>{0.532546401f, 0.882872105f},
-std::array<float,2>{0.474106699f, 0.190753698f},
-std::array<float,2>{0.155123919f, 0.941758394f},
-std::array<float,2>{0.751240551f, 0.158563316f},
-std::array<float,2>{0.711510241f, 0.643942118f},
-std::array<float,2>{0.291732669f, 0.338723093f},
-std::array<float,2>{0.410790205f, 0.565679491f},
-std::array<float,2>{0.609396279f, 0.413872749f},
-std::array<float,2>{0.910734951f, 0.791890979f},
-std::array<float,2>{0.103815451f, 0.0946685746f},
-std::array<float,2>{0.454052806f, 0.926907122f},
-std::array<float,2>{0.507138669f, 0.219298929f},
-std::array<float,2>{0.956861615f, 0.718269825f},
-std::array<float,2>{0.0559718274f, 0.261754453f},
-std::array<float,2>{0.204716355f, 0.503652394f},
-std::array<float,2>{0.82317853f, 0.4449687f},
-std::array<float,2>{0.665100455f, 0.856737852f},
-std::array<float,2>{0.320529014f, 0.0552381352f},
-std::array<float,2>{0.089700371f, 0.764015734f},
-std::array<float,2>{0.898843467f, 0.0729099587f},
-std::array<float,2>{0.569788158f, 0.608195305f},
-std::array<float,2>{0.402606636f, 0.388099879f},
-std::array<float,2>{0.261106908f, 0.686636806f},
-std::array<float,2>{0.736321509f, 0.366919458f},
-std::array<float,2>{0.789675653f, 0.970262766f},
-std::array<float,2>{0.171166405f, 0.151447371f},
-std::array<float,2>{0.306051463f, 0.987157345f},
-std::array<float,2>{0.688737929f, 0.127420321f},
-std::array<float,2>{0.778418243f, 0.667067647f},
-std::array<float,2>{0.138442561f, 0.358832091f},
-std::array<float,2>{0.124461241f, 0.623948276f},
-std::array<float,2>{0.923688233f, 0.404418081f},
-std::array<float,2>{0.603555262f, 0.780183971f},
-std::array<float,2>{0.430332422f, 0.0889613926f},
-std::array<float,2>{0.244274035f, 0.865190566f},
-std::array<float,2>{0.853340447f, 0.0435178243f},
-std::array<float,2>{0.635537267f, 0.528093696f},
-std::array<float,2>{0.357795119f, 0.46803087f},
-std::array<float,2>{0.499441952f, 0.695128918f},
-std::array<float,2>{0.552752435f, 0.269447684f},
-std::array<float,2>{0.989200413f, 0.917263031f},
-std::array<float,2>{0.0240617488f, 0.236106873f},
-std::array<float,2>{0.384941876f, 0.810865581f},
-std::array<float,2>{0.584218204f, 0.120225541f},
-std::array<float,2>{0.87612313f, 0.59326762f},
-std::array<float,2>{0.0780399814f, 0.43224743f},
-std::array<float,2>{0.178892687f, 0.639114201f},
-std::array<float,2>{0.798673451f, 0.32738629f},
-std::array<float,2>{0.723088324f, 0.956456542f},
-std::array<float,2>{0.267556101f, 0.178103536f},
-std::array<float,2>{0.042896159f, 0.901491642f},
-std::array<float,2>{0.946622074f, 0.211363539f},
-std::array<float,2>{0.519543767f, 0.740243435f},
-std::array<float,2>{0.451847315f, 0.288158298f},
-std::array<float,2>{0.335858107f, 0.544790924f},
-std::array<float,2>{0.682085812f, 0.470103294f},
-std::array<float,2>{0.843068898f, 0.819026053f},
-std::array<float,2>{0.191265106f, 0.0170621984f},
-std::array<float,2>{0.277062386f, 0.767024934f},
-std::array<float,2>{0.729585052f, 0.0802745f},
-std::array<float,2>{0.808925271f, 0.612174869f},
-std::array<float,2>{0.183689073f, 0.395114213f},
-std::array<float,2>{0.0670214444f, 0.660288274f},
-std::array<float,2>{0.885325432f, 0.351236582f},
-std::array<float,2>{0.592595696f, 0.992768109f},
-std::array<float,2>{0.375784218f, 0.136426717f},
-std::array<float,2>{0.19704926f, 0.907281101f},
-std::array<float,2>{0.830488622f, 0.249473169f},
-std::array<float,2>{0.674588382f, 0.698530376f},
-std::array<float,2>{0.336737394f, 0.279823989f},
-std::array<float,2>{0.444222242f, 0.516707063f},
-std::array<float,2>{0.527248502f, 0.4536798f},
-std::array<float,2>{0.938944578f, 0.8734442f},
-std::array<float,2>{0.0352922641f, 0.0369463675f},
-std::array<float,2>{0.429239392f, 0.963710487f},
-std::array<float,2>{0.596241355f, 0.181650102f},
-std::array<float,2>{0.93403089f, 0.626266003f},
-std::array<float,2>{0.114384674f, 0.313140363f},
-std::array<float,2>{0.126174375f, 0.579860866f},
-std::array<float,2>{0.770171344f, 0.42345956f},
-std::array<float,2>{0.697787821f, 0.803971231f},
-std::array<float,2>{0.301264554f, 0.109521717f},
-std::array<float,2>{0.0233321898f, 0.823089778f},
-std::array<float,2>{0.994383454f, 0.0281841196f},
-std::array<float,2>{0.554739118f, 0.531357527f},
-std::array<float,2>{0.484458327f, 0.48222971f},
-std::array<float,2>{0.350699365f, 0.744121015f},
-std::array<float,2>{0.631368101f, 0.295882195f},
-std::array<float,2>{0.844447553f, 0.896377861f},
-std::array<float,2>{0.24205026f, 0.208684474f},
-std::array<float,2>{0.316351503f, 0.881012619f},
-std::array<float,2>{0.658828795f, 0.196355909f},
-std::array<float,2>{0.814848661f, 0.731141031f},
-std::array<float,2>{0.216434583f, 0.304951906f},
-std::array<float,2>{0.0473750271f, 0.549313605f},
-std::array<float,2>{0.963491023f, 0.487183988f},
-std::array<float,2>{0.50796175f, 0.829559743f},
-std::array<float,2>{0.466616839f, 0.0102725178f},
-std::array<float,2>{0.161471769f, 0.786743283f},
-std::array<float,2>{0.786110699f, 0.10589657f},
-std::array<float,2>{0.742448807f, 0.573874474f},
-std::array<float,2>{0.253303468f, 0.418258548f},
-std::array<float,2>{0.393320411f, 0.653520703f},
-std::array<float,2>{0.574824691f, 0.333817273f},
-std::array<float,2>{0.8953408f, 0.949048162f},
-std::array<float,2>{0.0854645148f, 0.167056829f},
-std::array<float,2>{0.479651034f, 0.844868064f},
-std::array<float,2>{0.546845913f, 0.0540126152f},
-std::array<float,2>{0.97161752f, 0.510600626f},
-std::array<float,2>{0.0149151674f, 0.452404469f},
-std::array<float,2>{0.233662233f, 0.710001171f},
-std::array<float,2>{0.866543174f, 0.257558048f},
-std::array<float,2>{0.649892569f, 0.934943318f},
-std::array<float,2>{0.366010159f, 0.232413918f},
-std::array<float,2>{0.0999450311f, 0.982806444f},
-std::array<float,2>{0.918766201f, 0.140923738f},
-std::array<float,2>{0.62138474f, 0.677481472f},
-std::array<float,2>{0.419878066f, 0.374785572f},
-std::array<float,2>{0.288660973f, 0.600865781f},
-std::array<float,2>{0.708189666f, 0.376771986f},
-std::array<float,2>{0.761106789f, 0.757759094f},
-std::array<float,2>{0.145275369f, 0.0678804144f},
-std::array<float,2>{0.342795283f, 0.796577513f},
-std::array<float,2>{0.67863512f, 0.0984661356f},
-std::array<float,2>{0.832225621f, 0.569143116f},
-std::array<float,2>{0.199260741f, 0.409377307f},
-std::array<float,2>{0.0340580791f, 0.647550404f},
-std::array<float,2>{0.943352878f, 0.340099335f},
-std::array<float,2>{0.529463947f, 0.940463781f},
-std::array<float,2>{0.438494384f, 0.161213011f},
-std::array<float,2>{0.183436543f, 0.889990091f},
-std::array<float,2>{0.804962039f, 0.194733679f},
-std::array<float,2>{0.733380616f, 0.718869388f},
-std::array<float,2>{0.277914882f, 0.302216023f},
-std::array<float,2>{0.379757971f, 0.561401606f},
-std::array<float,2>{0.586289227f, 0.493449837f},
-std::array<float,2>{0.890485585f, 0.842206478f},
-std::array<float,2>{0.0634623319f, 0.00254974398f},
-std::array<float,2>{0.491740704f, 0.97554642f},
-std::array<float,2>{0.56249088f, 0.155224964f},
-std::array<float,2>{0.997573674f, 0.681980848f},
-std::array<float,2>{0.0187175591f, 0.36283493f},
-std::array<float,2>{0.235843733f, 0.604122996f},
-std::array<float,2>{0.849335253f, 0.384329736f},
-std::array<float,2>{0.625117004f, 0.75839895f},
-std::array<float,2>{0.346766293f, 0.0775014684f},
-std::array<float,2>{0.110007614f, 0.852479339f},
-std::array<float,2>{0.930232406f, 0.0617932379f},
-std::array<float,2>{0.600214124f, 0.504986346f},
-std::array<float,2>{0.423336565f, 0.438588619f},
-std::array<float,2>{0.300650477f, 0.71331656f},
-std::array<float,2>{0.700263143f, 0.261231482f},
-std::array<float,2>{0.765991211f, 0.922042668f},
-std::array<float,2>{0.132106781f, 0.225550413f},
-std::array<float,2>{0.25527364f, 0.921744525f},
-std::array<float,2>{0.749660194f, 0.239668712f},
-std::array<float,2>{0.781466067f, 0.688882768f},
-std::array<float,2>{0.157676175f, 0.26995331f},
-std::array<float,2>{0.0804203972f, 0.526366115f},
-std::array<float,2>{0.893104613f, 0.461291224f},
-std::array<float,2>{0.572032332f, 0.863040864f},
-std::array<float,2>{0.398302615f, 0.0416042693f},
-std::array<float,2>{0.210976049f, 0.775265992f},
-std::array<float,2>{0.818904161f, 0.0934135467f},
-std::array<float,2>{0.66239357f, 0.61850512f},
-std::array<float,2>{0.317180187f, 0.400470376f},
-std::array<float,2>{0.460975409f, 0.670320511f},
-std::array<float,2>{0.514437318f, 0.353936225f},
-std::array<float,2>{0.967966676f, 0.98936075f},
-std::array<float,2>{0.0536349192f, 0.132272348f},
-std::array<float,2>{0.414922774f, 0.81584698f},
-std::array<float,2>{0.618901193f, 0.0212932751f},
-std::array<float,2>{0.915328681f, 0.540841103f},
-std::array<float,2>{0.0968746096f, 0.475463152f},
-std::array<float,2>{0.143407926f, 0.737973928f},
-std::array<float,2>{0.762018681f, 0.28490603f},
-std::array<float,2>{0.70650208f, 0.905318379f},
-std::array<float,2>{0.28359291f, 0.218047589f},
-std::array<float,2>{0.00948513765f, 0.957937181f},
-std::array<float,2>{0.976127386f, 0.173494592f},
-std::array<float,2>{0.542691052f, 0.636337996f},
-std::array<float,2>{0.480972171f, 0.322893858f},
-std::array<float,2>{0.362089872f, 0.588905096f},
-std::array<float,2>{0.654546201f, 0.435545892f},
-std::array<float,2>{0.859471738f, 0.806076646f},
-std::array<float,2>{0.228710264f, 0.121787779f},
-std::array<float,2>{0.295413345f, 0.867717624f},
-std::array<float,2>{0.718220115f, 0.0327636972f},
-std::array<float,2>{0.757522702f, 0.522308171f},
-std::array<float,2>{0.152171865f, 0.460403353f},
-std::array<float,2>{0.107864663f, 0.699951231f},
-std::array<float,2>{0.907138228f, 0.275469482f},
-std::array<float,2>{0.615768731f, 0.910861075f},
-std::array<float,2>{0.40862447f, 0.244108796f},
-std::array<float,2>{0.219235718f, 0.999243259f},
-std::array<float,2>{0.874364257f, 0.139615402f},
-std::array<float,2>{0.647074461f, 0.656610131f},
-std::array<float,2>{0.368325263f, 0.345730066f},
-std::array<float,2>{0.468937904f, 0.61487025f},
-std::array<float,2>{0.538984835f, 0.393091142f},
-std::array<float,2>{0.9821648f, 0.772326708f},
-std::array<float,2>{0.00363799301f, 0.0832784623f},
-std::array<float,2>{0.398804545f, 0.893924594f},
-std::array<float,2>{0.566180766f, 0.205640748f},
-std::array<float,2>{0.902451098f, 0.748283029f},
-std::array<float,2>{0.0919047296f, 0.291333705f},
-std::array<float,2>{0.16520454f, 0.536172509f},
-std::array<float,2>{0.794629216f, 0.480452985f},
-std::array<float,2>{0.739707828f, 0.827918947f},
-std::array<float,2>{0.264277995f, 0.0236716196f},
-std::array<float,2>{0.0603041537f, 0.798710763f},
-std::array<float,2>{0.960534036f, 0.116140775f},
-std::array<float,2>{0.503534377f, 0.583572447f},
-std::array<float,2>{0.460131347f, 0.428853631f},
-std::array<float,2>{0.325421631f, 0.629220128f},
-std::array<float,2>{0.671444237f, 0.31707716f},
-std::array<float,2>{0.82771343f, 0.967358649f},
-std::array<float,2>{0.210224748f, 0.185929969f},
-std::array<float,2>{0.351877272f, 0.949692547f},
-std::array<float,2>{0.637998879f, 0.16965273f},
-std::array<float,2>{0.855610013f, 0.649694324f},
-std::array<float,2>{0.249710247f, 0.328240424f},
-std::array<float,2>{0.0305859353f, 0.577198267f},
-std::array<float,2>{0.984466076f, 0.416226655f},
-std::array<float,2>{0.54762274f, 0.781265914f},
-std::array<float,2>{0.495788038f, 0.104449056f},
-std::array<float,2>{0.13576363f, 0.835125268f},
-std::array<float,2>{0.776128173f, 0.0121560665f},
-std::array<float,2>{0.693457186f, 0.55079484f},
-std::array<float,2>{0.310136884f, 0.488584459f},
-std::array<float,2>{0.436055601f, 0.729826033f},
-std::array<float,2>{0.608448029f, 0.309218138f},
-std::array<float,2>{0.929573774f, 0.877786696f},
-std::array<float,2>{0.11806342f, 0.201096684f},
-std::array<float,2>{0.447840303f, 0.751577139f},
-std::array<float,2>{0.518601f, 0.064920865f},
-std::array<float,2>{0.95306921f, 0.593830287f},
-std::array<float,2>{0.0456587672f, 0.380280524f},
-std::array<float,2>{0.191631824f, 0.673995733f},
-std::array<float,2>{0.836411774f, 0.369712144f},
-std::array<float,2>{0.68522656f, 0.979075968f},
-std::array<float,2>{0.329986989f, 0.148081198f},
-std::array<float,2>{0.0728544369f, 0.932765245f},
-std::array<float,2>{0.88235718f, 0.227532834f},
-std::array<float,2>{0.57888335f, 0.703350008f},
-std::array<float,2>{0.390232176f, 0.250814945f},
-std::array<float,2>{0.271939427f, 0.515451133f},
-std::array<float,2>{0.722252488f, 0.446026653f},
-std::array<float,2>{0.802975893f, 0.850534379f},
-std::array<float,2>{0.174748063f, 0.0481418148f},
-std::array<float,2>{0.313556373f, 0.829782963f},
-std::array<float,2>{0.658065498f, 0.00998942275f},
-std::array<float,2>{0.814100564f, 0.549798191f},
-std::array<float,2>{0.218448326f, 0.486697823f},
-std::array<float,2>{0.0501863919f, 0.730659008f},
-std::array<float,2>{0.962890148f, 0.305590838f},
-std::array<float,2>{0.511019111f, 0.881417274f},
-std::array<float,2>{0.466938794f, 0.197153822f},
-std::array<float,2>{0.16323337f, 0.948327899f},
-std::array<float,2>{0.787762046f, 0.167657524f},
-std::array<float,2>{0.745635867f, 0.654133022f},
-std::array<float,2>{0.251343131f, 0.333376646f},
-std::array<float,2>{0.391634434f, 0.573357821f},
-std::array<float,2>{0.577312231f, 0.41880399f},
-std::array<float,2>{0.897701621f, 0.786264777f},
-std::array<float,2>{0.0834191144f, 0.10627038f},
-std::array<float,2>{0.476990074f, 0.935440838f},
-std::array<float,2>{0.544660926f, 0.231456816f},
-std::array<float,2>{0.97004956f, 0.710646331f},
-std::array<float,2>{0.0122571345f, 0.257024556f},
-std::array<float,2>{0.232112035f, 0.510238409f},
-std::array<float,2>{0.864395916f, 0.453123868f},
-std::array<float,2>{0.651012659f, 0.845385253f},
-std::array<float,2>{0.363982141f, 0.0546007864f},
-std::array<float,2>{0.0983319432f, 0.757296205f},
-std::array<float,2>{0.920341194f, 0.067644693f},
-std::array<float,2>{0.624541461f, 0.601177752f},
-std::array<float,2>{0.420683414f, 0.376327813f},
-std::array<float,2>{0.286714792f, 0.677218199f},
-std::array<float,2>{0.709763646f, 0.374325365f},
-std::array<float,2>{0.759030223f, 0.983044982f},
-std::array<float,2>{0.147172198f, 0.141444534f},
-std::array<float,2>{0.274192154f, 0.992255032f},
-std::array<float,2>{0.727062702f, 0.136226907f},
-std::array<float,2>{0.811720371f, 0.660921931f},
-std::array<float,2>{0.185788319f, 0.35084182f},
-std::array<float,2>{0.0700693801f, 0.611426413f},
-std::array<float,2>{0.883934975f, 0.394798756f},
-std::array<float,2>{0.590646446f, 0.767280996f},
-std::array<float,2>{0.378761649f, 0.080952324f},
-std::array<float,2>{0.19918777f, 0.874019802f},
-std::array<float,2>{0.828413963f, 0.0365196913f},
-std::array<float,2>{0.671940744f, 0.51738292f},
-std::array<float,2>{0.339810699f, 0.453550875f},
-std::array<float,2>{0.44214651f, 0.698879719f},
-std::array<float,2>{0.524085283f, 0.279427052f},
-std::array<float,2>{0.941167176f, 0.907748818f},
-std::array<float,2>{0.0373559482f, 0.249734759f},
-std::array<float,2>{0.426726788f, 0.80442369f},
-std::array<float,2>{0.593945384f, 0.109877467f},
-std::array<float,2>{0.935776174f, 0.579256654f},
-std::array<float,2>{0.116261266f, 0.42302084f},
-std::array<float,2>{0.128410786f, 0.626858175f},
-std::array<float,2>{0.773143768f, 0.312706262f},
-std::array<float,2>{0.695317924f, 0.962905228f},
-std::array<float,2>{0.302895695f, 0.182185844f},
-std::array<float,2>{0.020371493f, 0.895639479f},
-std::array<float,2>{0.992497027f, 0.208172649f},
-std::array<float,2>{0.557328761f, 0.743301928f},
-std::array<float,2>{0.486979485f, 0.29528293f},
-std::array<float,2>{0.349364936f, 0.532031536f},
-std::array<float,2>{0.629901648f, 0.481555581f},
-std::array<float,2>{0.846467197f, 0.822595358f},
-std::array<float,2>{0.23879014f, 0.0274439473f},
-std::array<float,2>{0.307285458f, 0.779304981f},
-std::array<float,2>{0.69115746f, 0.0895541385f},
-std::array<float,2>{0.780725002f, 0.623500586f},
-std::array<float,2>{0.139051586f, 0.40502575f},
-std::array<float,2>{0.122793198f, 0.667592704f},
-std::array<float,2>{0.925231278f, 0.359232277f},
-std::array<float,2>{0.602649093f, 0.986480355f},
-std::array<float,2>{0.433533102f, 0.127757758f},
-std::array<float,2>{0.243735045f, 0.917765796f},
-std::array<float,2>{0.854537129f, 0.235708997f},
-std::array<float,2>{0.634425223f, 0.694437087f},
-std::array<float,2>{0.357227564f, 0.269010693f},
-std::array<float,2>{0.496867061f, 0.527391732f},
-std::array<float,2>{0.551373184f, 0.468318164f},
-std::array<float,2>{0.991418123f, 0.864422441f},
-std::array<float,2>{0.0268394146f, 0.0430753455f},
-std::array<float,2>{0.383966893f, 0.956686378f},
-std::array<float,2>{0.583677232f, 0.178332344f},
-std::array<float,2>{0.87701124f, 0.639181674f},
-std::array<float,2>{0.075012207f, 0.327845365f},
-std::array<float,2>{0.175813273f, 0.593075991f},
-std::array<float,2>{0.798959017f, 0.431946039f},
-std::array<float,2>{0.72548002f, 0.811238408f},
-std::array<float,2>{0.268787801f, 0.121028155f},
-std::array<float,2>{0.0396789312f, 0.818382144f},
-std::array<float,2>{0.947756469f, 0.0172418077f},
-std::array<float,2>{0.522735655f, 0.544203997f},
-std::array<float,2>{0.450996459f, 0.470263153f},
-std::array<float,2>{0.332264125f, 0.740851939f},
-std::array<float,2>{0.68045038f, 0.288721114f},
-std::array<float,2>{0.840623498f, 0.90189302f},
-std::array<float,2>{0.18876119f, 0.211861297f},
-std::array<float,2>{0.372149229f, 0.883383453f},
-std::array<float,2>{0.643577695f, 0.19115667f},
-std::array<float,2>{0.868642151f, 0.723003089f},
-std::array<float,2>{0.225954533f, 0.299354523f},
-std::array<float,2>{0.00425852928f, 0.557273746f},
-std::array<float,2>{0.977904081f, 0.496482819f},
-std::array<float,2>{0.534321487f, 0.838938475f},
-std::array<float,2>{0.475573659f, 0.00557869952f},
-std::array<float,2>{0.153986081f, 0.791401803f},
-std::array<float,2>{0.752855182f, 0.0940976664f},
-std::array<float,2>{0.712962985f, 0.566269875f},
-std::array<float,2>{0.290023685f, 0.413101822f},
-std::array<float,2>{0.413986713f, 0.644339979f},
-std::array<float,2>{0.611906886f, 0.338360161f},
-std::array<float,2>{0.91277355f, 0.942321777f},
-std::array<float,2>{0.101734571f, 0.158945546f},
-std::array<float,2>{0.456580043f, 0.857313573f},
-std::array<float,2>{0.505155146f, 0.0549563766f},
-std::array<float,2>{0.953380406f, 0.503307402f},
-std::array<float,2>{0.0571712106f, 0.444666058f},
-std::array<float,2>{0.206214085f, 0.717888892f},
-std::array<float,2>{0.820922911f, 0.262635708f},
-std::array<float,2>{0.667530239f, 0.927617192f},
-std::array<float,2>{0.322580278f, 0.218947634f},
-std::array<float,2>{0.0876146704f, 0.969761491f},
-std::array<float,2>{0.90233928f, 0.151878744f},
-std::array<float,2>{0.566951275f, 0.68745327f},
-std::array<float,2>{0.40518266f, 0.366301239f},
-std::array<float,2>{0.258459061f, 0.607491791f},
-std::array<float,2>{0.737369537f, 0.388233632f},
-std::array<float,2>{0.792724669f, 0.764621615f},
-std::array<float,2>{0.168713093f, 0.0726208761f},
-std::array<float,2>{0.354687482f, 0.782067597f},
-std::array<float,2>{0.6395365f, 0.10365323f},
-std::array<float,2>{0.858909369f, 0.577854156f},
-std::array<float,2>{0.247159973f, 0.416755527f},
-std::array<float,2>{0.028011078f, 0.649921894f},
-std::array<float,2>{0.986509264f, 0.32887727f},
-std::array<float,2>{0.549070477f, 0.949746251f},
-std::array<float,2>{0.493212968f, 0.169234559f},
-std::array<float,2>{0.134721816f, 0.877389252f},
-std::array<float,2>{0.773955166f, 0.200484842f},
-std::array<float,2>{0.692746341f, 0.730078995f},
-std::array<float,2>{0.311739683f, 0.308760971f},
-std::array<float,2>{0.433617413f, 0.551720083f},
-std::array<float,2>{0.60732305f, 0.488949805f},
-std::array<float,2>{0.926437318f, 0.835901916f},
-std::array<float,2>{0.120850749f, 0.012364109f},
-std::array<float,2>{0.446041375f, 0.978761852f},
-std::array<float,2>{0.516498864f, 0.147514045f},
-std::array<float,2>{0.950259209f, 0.674417496f},
-std::array<float,2>{0.0438415222f, 0.369191527f},
-std::array<float,2>{0.194550559f, 0.594336689f},
-std::array<float,2>{0.83936286f, 0.380463749f},
-std::array<float,2>{0.685711443f, 0.75124073f},
-std::array<float,2>{0.331282198f, 0.0651966259f},
-std::array<float,2>{0.0705399737f, 0.849691629f},
-std::array<float,2>{0.879993081f, 0.0487735271f},
-std::array<float,2>{0.581047535f, 0.514685273f},
-std::array<float,2>{0.387062907f, 0.445533991f},
-std::array<float,2>{0.270598322f, 0.703745544f},
-std::array<float,2>{0.71913898f, 0.250342131f},
-std::array<float,2>{0.801998079f, 0.933581769f},
-std::array<float,2>{0.17306906f, 0.22692509f},
-std::array<float,2>{0.29410103f, 0.910165906f},
-std::array<float,2>{0.716075063f, 0.243293464f},
-std::array<float,2>{0.754042864f, 0.69965899f},
-std::array<float,2>{0.149061725f, 0.276126176f},
-std::array<float,2>{0.107287951f, 0.521526098f},
-std::array<float,2>{0.908475578f, 0.460886776f},
-std::array<float,2>{0.613372326f, 0.867469788f},
-std::array<float,2>{0.407558143f, 0.0322368741f},
-std::array<float,2>{0.220784307f, 0.7715891f},
-std::array<float,2>{0.871383429f, 0.0836011246f},
-std::array<float,2>{0.646235168f, 0.614470422f},
-std::array<float,2>{0.369828284f, 0.393054605f},
-std::array<float,2>{0.471372634f, 0.656882167f},
-std::array<float,2>{0.536466539f, 0.346416324f},
-std::array<float,2>{0.983789146f, 0.999957323f},
-std::array<float,2>{0.000370089867f, 0.138897032f},
-std::array<float,2>{0.400493115f, 0.827570617f},
-std::array<float,2>{0.562639058f, 0.024269687f},
-std::array<float,2>{0.905746281f, 0.536752284f},
-std::array<float,2>{0.0911767408f, 0.479561031f},
-std::array<float,2>{0.167873338f, 0.748554409f},
-std::array<float,2>{0.796116531f, 0.291933924f},
-std::array<float,2>{0.741666555f, 0.894391119f},
-std::array<float,2>{0.262028188f, 0.20545432f},
-std::array<float,2>{0.0623499155f, 0.966925085f},
-std::array<float,2>{0.95790112f, 0.18619898f},
-std::array<float,2>{0.501196504f, 0.629456341f},
-std::array<float,2>{0.457574248f, 0.316766679f},
-std::array<float,2>{0.32790485f, 0.583187521f},
-std::array<float,2>{0.669223666f, 0.429558307f},
-std::array<float,2>{0.825469315f, 0.798165679f},
-std::array<float,2>{0.207494423f, 0.115307711f},
-std::array<float,2>{0.256067723f, 0.862774432f},
-std::array<float,2>{0.747197092f, 0.0412195027f},
-std::array<float,2>{0.783994436f, 0.525400341f},
-std::array<float,2>{0.160141751f, 0.461740643f},
-std::array<float,2>{0.0794172809f, 0.689187825f},
-std::array<float,2>{0.891537964f, 0.270238221f},
-std::array<float,2>{0.573595345f, 0.92121917f},
-std::array<float,2>{0.396435201f, 0.239809752f},
-std::array<float,2>{0.213537708f, 0.990072668f},
-std::array<float,2>{0.817342877f, 0.132330224f},
-std::array<float,2>{0.660324335f, 0.670885026f},
-std::array<float,2>{0.318686038f, 0.354372054f},
-std::array<float,2>{0.46314913f, 0.619072258f},
-std::array<float,2>{0.512313187f, 0.401001573f},
-std::array<float,2>{0.966700137f, 0.774671674f},
-std::array<float,2>{0.0508037396f, 0.0929269567f},
-std::array<float,2>{0.417859882f, 0.905965805f},
-std::array<float,2>{0.620525658f, 0.218405917f},
-std::array<float,2>{0.916460812f, 0.737626314f},
-std::array<float,2>{0.0952659473f, 0.284341186f},
-std::array<float,2>{0.140952826f, 0.540365994f},
-std::array<float,2>{0.765165806f, 0.474892914f},
-std::array<float,2>{0.704541862f, 0.816150188f},
-std::array<float,2>{0.282357961f, 0.0208898913f},
-std::array<float,2>{0.0115546817f, 0.806281388f},
-std::array<float,2>{0.972886741f, 0.121460967f},
-std::array<float,2>{0.540514171f, 0.589642406f},
-std::array<float,2>{0.483785301f, 0.43483609f},
-std::array<float,2>{0.360636622f, 0.635833681f},
-std::array<float,2>{0.654152572f, 0.322635263f},
-std::array<float,2>{0.861519516f, 0.957179308f},
-std::array<float,2>{0.227137551f, 0.17314969f},
-std::array<float,2>{0.341750085f, 0.941184044f},
-std::array<float,2>{0.676803768f, 0.161738023f},
-std::array<float,2>{0.835258007f, 0.648222327f},
-std::array<float,2>{0.201679885f, 0.3404589f},
-std::array<float,2>{0.0317152888f, 0.568395078f},
-std::array<float,2>{0.944312274f, 0.40986529f},
-std::array<float,2>{0.529035211f, 0.796171486f},
-std::array<float,2>{0.440570146f, 0.0979303047f},
-std::array<float,2>{0.181626216f, 0.842709482f},
-std::array<float,2>{0.808229923f, 0.00214072387f},
-std::array<float,2>{0.732121408f, 0.560825348f},
-std::array<float,2>{0.280535817f, 0.493731648f},
-std::array<float,2>{0.381611317f, 0.719359338f},
-std::array<float,2>{0.589390099f, 0.302474171f},
-std::array<float,2>{0.886874974f, 0.89030987f},
-std::array<float,2>{0.0651699007f, 0.195015416f},
-std::array<float,2>{0.489899278f, 0.758030355f},
-std::array<float,2>{0.559034586f, 0.0781156272f},
-std::array<float,2>{0.998081505f, 0.603699505f},
-std::array<float,2>{0.0174730271f, 0.383850157f},
-std::array<float,2>{0.236442715f, 0.682435513f},
-std::array<float,2>{0.851550758f, 0.36255914f},
-std::array<float,2>{0.627003551f, 0.974724889f},
-std::array<float,2>{0.344430953f, 0.154308408f},
-std::array<float,2>{0.112460978f, 0.922398508f},
-std::array<float,2>{0.932831645f, 0.224798918f},
-std::array<float,2>{0.597694039f, 0.713678122f},
-std::array<float,2>{0.425607294f, 0.261202455f},
-std::array<float,2>{0.298289448f, 0.505856574f},
-std::array<float,2>{0.702904582f, 0.438981712f},
-std::array<float,2>{0.768259048f, 0.851616144f},
-std::array<float,2>{0.128979027f, 0.0622904114f},
-std::array<float,2>{0.365586311f, 0.846658707f},
-std::array<float,2>{0.650135279f, 0.051834289f},
-std::array<float,2>{0.8671152f, 0.509263813f},
-std::array<float,2>{0.233997494f, 0.449521691f},
-std::array<float,2>{0.0152454833f, 0.708926916f},
-std::array<float,2>{0.970853806f, 0.254193038f},
-std::array<float,2>{0.546013415f, 0.937292039f},
-std::array<float,2>{0.480187118f, 0.233951241f},
-std::array<float,2>{0.144744471f, 0.98163271f},
-std::array<float,2>{0.761412084f, 0.143501088f},
-std::array<float,2>{0.708727062f, 0.678457618f},
-std::array<float,2>{0.28852424f, 0.372630954f},
-std::array<float,2>{0.419325739f, 0.598262906f},
-std::array<float,2>{0.621761739f, 0.377679318f},
-std::array<float,2>{0.918352246f, 0.754311681f},
-std::array<float,2>{0.100314803f, 0.070173569f},
-std::array<float,2>{0.465852648f, 0.880682528f},
-std::array<float,2>{0.508579791f, 0.19753854f},
-std::array<float,2>{0.963163793f, 0.733956218f},
-std::array<float,2>{0.0472660474f, 0.308522791f},
-std::array<float,2>{0.215881377f, 0.548711538f},
-std::array<float,2>{0.815183401f, 0.485972345f},
-std::array<float,2>{0.658284664f, 0.830173969f},
-std::array<float,2>{0.315856725f, 0.00936416723f},
-std::array<float,2>{0.0850453004f, 0.788476586f},
-std::array<float,2>{0.894640565f, 0.108372584f},
-std::array<float,2>{0.574445307f, 0.570741594f},
-std::array<float,2>{0.392835051f, 0.420792431f},
-std::array<float,2>{0.253701717f, 0.655460536f},
-std::array<float,2>{0.743061364f, 0.335471332f},
-std::array<float,2>{0.785310686f, 0.94593811f},
-std::array<float,2>{0.162046239f, 0.164089024f},
-std::array<float,2>{0.30170244f, 0.961364508f},
-std::array<float,2>{0.69753921f, 0.181032598f},
-std::array<float,2>{0.769891143f, 0.627903581f},
-std::array<float,2>{0.126705527f, 0.31630221f},
-std::array<float,2>{0.115227923f, 0.581015408f},
-std::array<float,2>{0.934230566f, 0.425223589f},
-std::array<float,2>{0.596092999f, 0.802042723f},
-std::array<float,2>{0.428881556f, 0.112821594f},
-std::array<float,2>{0.241698995f, 0.822182298f},
-std::array<float,2>{0.843964219f, 0.0294342432f},
-std::array<float,2>{0.631166279f, 0.533449829f},
-std::array<float,2>{0.351364881f, 0.48265937f},
-std::array<float,2>{0.485032141f, 0.744192123f},
-std::array<float,2>{0.55544287f, 0.293294251f},
-std::array<float,2>{0.995052755f, 0.898281097f},
-std::array<float,2>{0.0224759467f, 0.208984941f},
-std::array<float,2>{0.375199795f, 0.768389583f},
-std::array<float,2>{0.592061162f, 0.0790724233f},
-std::array<float,2>{0.884885192f, 0.610083282f},
-std::array<float,2>{0.0666220486f, 0.396496087f},
-std::array<float,2>{0.184209883f, 0.663273573f},
-std::array<float,2>{0.809291959f, 0.348262489f},
-std::array<float,2>{0.730120897f, 0.994983375f},
-std::array<float,2>{0.276779056f, 0.133012876f},
-std::array<float,2>{0.0358956344f, 0.908725679f},
-std::array<float,2>{0.939068794f, 0.247474909f},
-std::array<float,2>{0.526566863f, 0.696602762f},
-std::array<float,2>{0.443772495f, 0.278624237f},
-std::array<float,2>{0.335966825f, 0.518158078f},
-std::array<float,2>{0.674253106f, 0.456993759f},
-std::array<float,2>{0.830608189f, 0.872823536f},
-std::array<float,2>{0.196463332f, 0.0372577086f},
-std::array<float,2>{0.266818672f, 0.809467077f},
-std::array<float,2>{0.723262906f, 0.117993422f},
-std::array<float,2>{0.798092425f, 0.590317488f},
-std::array<float,2>{0.179632515f, 0.429847836f},
-std::array<float,2>{0.0775453597f, 0.638457835f},
-std::array<float,2>{0.876741409f, 0.324780941f},
-std::array<float,2>{0.584819019f, 0.954648614f},
-std::array<float,2>{0.385681003f, 0.177256644f},
-std::array<float,2>{0.190869644f, 0.899485648f},
-std::array<float,2>{0.843312204f, 0.212993264f},
-std::array<float,2>{0.682475865f, 0.73846221f},
-std::array<float,2>{0.335005015f, 0.285421103f},
-std::array<float,2>{0.451172978f, 0.545276344f},
-std::array<float,2>{0.520023882f, 0.472324312f},
-std::array<float,2>{0.947158396f, 0.816464901f},
-std::array<float,2>{0.0422020629f, 0.0178809948f},
-std::array<float,2>{0.430130064f, 0.985829651f},
-std::array<float,2>{0.604245245f, 0.126779348f},
-std::array<float,2>{0.923004627f, 0.664654076f},
-std::array<float,2>{0.124610901f, 0.35707435f},
-std::array<float,2>{0.137848809f, 0.621816635f},
-std::array<float,2>{0.778814971f, 0.402775377f},
-std::array<float,2>{0.689202487f, 0.777367949f},
-std::array<float,2>{0.306261957f, 0.0860600621f},
-std::array<float,2>{0.0235618409f, 0.866647065f},
-std::array<float,2>{0.988384843f, 0.0460169613f},
-std::array<float,2>{0.553293109f, 0.530315697f},
-std::array<float,2>{0.499871224f, 0.464991063f},
-std::array<float,2>{0.358170569f, 0.692032278f},
-std::array<float,2>{0.63491869f, 0.266190708f},
-std::array<float,2>{0.85265702f, 0.914532363f},
-std::array<float,2>{0.244647115f, 0.237610862f},
-std::array<float,2>{0.321065813f, 0.92892921f},
-std::array<float,2>{0.665944636f, 0.222162843f},
-std::array<float,2>{0.82228142f, 0.715682387f},
-std::array<float,2>{0.204558536f, 0.26475212f},
-std::array<float,2>{0.0564399734f, 0.501434684f},
-std::array<float,2>{0.956317484f, 0.442394108f},
-std::array<float,2>{0.507527649f, 0.85801208f},
-std::array<float,2>{0.45336622f, 0.0579953305f},
-std::array<float,2>{0.171676084f, 0.761866748f},
-std::array<float,2>{0.789127707f, 0.0703589171f},
-std::array<float,2>{0.735775709f, 0.607387304f},
-std::array<float,2>{0.261604726f, 0.388810277f},
-std::array<float,2>{0.402869612f, 0.685008228f},
-std::array<float,2>{0.570241034f, 0.364320397f},
-std::array<float,2>{0.899378955f, 0.972105563f},
-std::array<float,2>{0.0891690478f, 0.149027228f},
-std::array<float,2>{0.474253327f, 0.836875021f},
-std::array<float,2>{0.533014596f, 0.00586660765f},
-std::array<float,2>{0.978624821f, 0.554876089f},
-std::array<float,2>{0.00661685038f, 0.498575598f},
-std::array<float,2>{0.223315597f, 0.725769222f},
-std::array<float,2>{0.869641125f, 0.297354907f},
-std::array<float,2>{0.640951335f, 0.885896087f},
-std::array<float,2>{0.374291092f, 0.188309386f},
-std::array<float,2>{0.104032226f, 0.943688929f},
-std::array<float,2>{0.91027534f, 0.156508565f},
-std::array<float,2>{0.610126376f, 0.642110765f},
-std::array<float,2>{0.41036731f, 0.337494165f},
-std::array<float,2>{0.291487247f, 0.564149797f},
-std::array<float,2>{0.711182654f, 0.410629809f},
-std::array<float,2>{0.751650095f, 0.789405167f},
-std::array<float,2>{0.154744983f, 0.0958353207f},
-std::array<float,2>{0.32932204f, 0.753251255f},
-std::array<float,2>{0.684758186f, 0.0642248541f},
-std::array<float,2>{0.836604953f, 0.596572757f},
-std::array<float,2>{0.19199264f, 0.381507277f},
-std::array<float,2>{0.0453618616f, 0.673347831f},
-std::array<float,2>{0.952167809f, 0.36733079f},
-std::array<float,2>{0.519175172f, 0.977563322f},
-std::array<float,2>{0.447271436f, 0.144693181f},
-std::array<float,2>{0.174181268f, 0.930490851f},
-std::array<float,2>{0.803468287f, 0.22972925f},
-std::array<float,2>{0.722091019f, 0.706008017f},
-std::array<float,2>{0.272321492f, 0.252161324f},
-std::array<float,2>{0.389859855f, 0.512614787f},
-std::array<float,2>{0.578420579f, 0.447970718f},
-std::array<float,2>{0.88216275f, 0.849122822f},
-std::array<float,2>{0.0723581985f, 0.0498174615f},
-std::array<float,2>{0.495227456f, 0.95306021f},
-std::array<float,2>{0.546905637f, 0.170124769f},
-std::array<float,2>{0.985018373f, 0.650981009f},
-std::array<float,2>{0.0308369659f, 0.331112504f},
-std::array<float,2>{0.249109954f, 0.574626863f},
-std::array<float,2>{0.856139064f, 0.414359093f},
-std::array<float,2>{0.638634562f, 0.783692181f},
-std::array<float,2>{0.352114826f, 0.103264913f},
-std::array<float,2>{0.117203608f, 0.83310008f},
-std::array<float,2>{0.928844512f, 0.0137236593f},
-std::array<float,2>{0.609283626f, 0.552937448f},
-std::array<float,2>{0.435780257f, 0.491335034f},
-std::array<float,2>{0.309621841f, 0.72726351f},
-std::array<float,2>{0.694326699f, 0.310845226f},
-std::array<float,2>{0.775577903f, 0.875503302f},
-std::array<float,2>{0.136303246f, 0.202810422f},
-std::array<float,2>{0.263729185f, 0.892199934f},
-std::array<float,2>{0.740022361f, 0.204517648f},
-std::array<float,2>{0.794248223f, 0.746439159f},
-std::array<float,2>{0.165656507f, 0.290581375f},
-std::array<float,2>{0.0924881846f, 0.538668215f},
-std::array<float,2>{0.903003156f, 0.476620406f},
-std::array<float,2>{0.565525055f, 0.825202167f},
-std::array<float,2>{0.399064302f, 0.0259083435f},
-std::array<float,2>{0.210542783f, 0.800298154f},
-std::array<float,2>{0.827636242f, 0.113636941f},
-std::array<float,2>{0.671019256f, 0.585844159f},
-std::array<float,2>{0.326139271f, 0.42617932f},
-std::array<float,2>{0.460750937f, 0.63123554f},
-std::array<float,2>{0.503396809f, 0.319979519f},
-std::array<float,2>{0.960437298f, 0.966571629f},
-std::array<float,2>{0.0596985146f, 0.183724582f},
-std::array<float,2>{0.409002841f, 0.869622171f},
-std::array<float,2>{0.615693748f, 0.0339296572f},
-std::array<float,2>{0.906675577f, 0.520943522f},
-std::array<float,2>{0.108090803f, 0.457859159f},
-std::array<float,2>{0.151569724f, 0.702277899f},
-std::array<float,2>{0.756887496f, 0.27445516f},
-std::array<float,2>{0.718724728f, 0.914012313f},
-std::array<float,2>{0.2951895f, 0.245266259f},
-std::array<float,2>{0.0029587138f, 0.996517718f},
-std::array<float,2>{0.981928349f, 0.138574183f},
-std::array<float,2>{0.538096964f, 0.660060167f},
-std::array<float,2>{0.469526142f, 0.344795525f},
-std::array<float,2>{0.368842572f, 0.615962088f},
-std::array<float,2>{0.646645606f, 0.391275615f},
-std::array<float,2>{0.874686241f, 0.770327151f},
-std::array<float,2>{0.219397485f, 0.0848210827f},
-std::array<float,2>{0.28409642f, 0.813827217f},
-std::array<float,2>{0.70673418f, 0.0229051802f},
-std::array<float,2>{0.762663543f, 0.542748451f},
-std::array<float,2>{0.14279379f, 0.473519176f},
-std::array<float,2>{0.0974571332f, 0.734507561f},
-std::array<float,2>{0.915635645f, 0.282435507f},
-std::array<float,2>{0.618648171f, 0.904214263f},
-std::array<float,2>{0.414378554f, 0.216159075f},
-std::array<float,2>{0.229369476f, 0.959190488f},
-std::array<float,2>{0.860324025f, 0.174505547f},
-std::array<float,2>{0.655084729f, 0.633742392f},
-std::array<float,2>{0.361364454f, 0.320420116f},
-std::array<float,2>{0.480923146f, 0.586594582f},
-std::array<float,2>{0.542088687f, 0.436838835f},
-std::array<float,2>{0.975980461f, 0.807277203f},
-std::array<float,2>{0.00896294508f, 0.12440493f},
-std::array<float,2>{0.397513181f, 0.919595897f},
-std::array<float,2>{0.571710527f, 0.241843686f},
-std::array<float,2>{0.892979324f, 0.691267073f},
-std::array<float,2>{0.0806527734f, 0.271949083f},
-std::array<float,2>{0.157866687f, 0.523518205f},
-std::array<float,2>{0.781804144f, 0.464459658f},
-std::array<float,2>{0.749108315f, 0.859462857f},
-std::array<float,2>{0.255765945f, 0.0394182131f},
-std::array<float,2>{0.0528500751f, 0.776043594f},
-std::array<float,2>{0.968313992f, 0.090526931f},
-std::array<float,2>{0.514009595f, 0.620691061f},
-std::array<float,2>{0.461854875f, 0.400233597f},
-std::array<float,2>{0.316891581f, 0.669735014f},
-std::array<float,2>{0.662791431f, 0.35189113f},
-std::array<float,2>{0.818476617f, 0.991987526f},
-std::array<float,2>{0.211703911f, 0.129545182f},
-std::array<float,2>{0.347385645f, 0.973378599f},
-std::array<float,2>{0.625501573f, 0.15375641f},
-std::array<float,2>{0.849103093f, 0.680401742f},
-std::array<float,2>{0.235647038f, 0.360560387f},
-std::array<float,2>{0.0192874372f, 0.601903915f},
-std::array<float,2>{0.997540832f, 0.385270089f},
-std::array<float,2>{0.561534584f, 0.760424018f},
-std::array<float,2>{0.491648465f, 0.0753016695f},
-std::array<float,2>{0.132750109f, 0.854081273f},
-std::array<float,2>{0.766247213f, 0.0601894408f},
-std::array<float,2>{0.700965762f, 0.507448494f},
-std::array<float,2>{0.30017525f, 0.439917743f},
-std::array<float,2>{0.42375952f, 0.712120354f},
-std::array<float,2>{0.599758685f, 0.259148747f},
-std::array<float,2>{0.9297598f, 0.924019873f},
-std::array<float,2>{0.109402336f, 0.2228726f},
-std::array<float,2>{0.438988507f, 0.79422605f},
-std::array<float,2>{0.529989958f, 0.100033179f},
-std::array<float,2>{0.942862332f, 0.566602707f},
-std::array<float,2>{0.0333981179f, 0.406440526f},
-std::array<float,2>{0.19998607f, 0.645130575f},
-std::array<float,2>{0.832942963f, 0.343313634f},
-std::array<float,2>{0.677928865f, 0.939378977f},
-std::array<float,2>{0.34348917f, 0.162131354f},
-std::array<float,2>{0.062568523f, 0.887024224f},
-std::array<float,2>{0.889760137f, 0.191809282f},
-std::array<float,2>{0.586482584f, 0.720811963f},
-std::array<float,2>{0.379247099f, 0.302961886f},
-std::array<float,2>{0.277526438f, 0.558828712f},
-std::array<float,2>{0.732878029f, 0.495030642f},
-std::array<float,2>{0.805604935f, 0.84096992f},
-std::array<float,2>{0.182810381f, 0.00169093453f},
-std::array<float,2>{0.337947071f, 0.871260643f},
-std::array<float,2>{0.67295301f, 0.0383496433f},
-std::array<float,2>{0.829771459f, 0.519389331f},
-std::array<float,2>{0.197364509f, 0.455357522f},
-std::array<float,2>{0.0383610129f, 0.695816219f},
-std::array<float,2>{0.940318048f, 0.277350008f},
-std::array<float,2>{0.525295973f, 0.909859657f},
-std::array<float,2>{0.442778647f, 0.246809199f},
-std::array<float,2>{0.187281564f, 0.995890141f},
-std::array<float,2>{0.810736775f, 0.134541184f},
-std::array<float,2>{0.728365719f, 0.662807465f},
-std::array<float,2>{0.275111467f, 0.349288642f},
-std::array<float,2>{0.377301961f, 0.610567689f},
-std::array<float,2>{0.591576278f, 0.397795469f},
-std::array<float,2>{0.883663774f, 0.76870811f},
-std::array<float,2>{0.0687616318f, 0.0797651187f},
-std::array<float,2>{0.488078117f, 0.896697938f},
-std::array<float,2>{0.558041573f, 0.209965855f},
-std::array<float,2>{0.993449211f, 0.745531976f},
-std::array<float,2>{0.0210999995f, 0.294000179f},
-std::array<float,2>{0.239872113f, 0.535013497f},
-std::array<float,2>{0.84669131f, 0.483453691f},
-std::array<float,2>{0.629249573f, 0.820848405f},
-std::array<float,2>{0.348236769f, 0.0305001922f},
-std::array<float,2>{0.115256339f, 0.801384389f},
-std::array<float,2>{0.937045574f, 0.111609414f},
-std::array<float,2>{0.595167994f, 0.581368446f},
-std::array<float,2>{0.427378178f, 0.423849553f},
-std::array<float,2>{0.304409206f, 0.628748536f},
-std::array<float,2>{0.697067201f, 0.314706355f},
-std::array<float,2>{0.771855175f, 0.962846518f},
-std::array<float,2>{0.127111182f, 0.180279136f},
-std::array<float,2>{0.25048545f, 0.946810603f},
-std::array<float,2>{0.744700134f, 0.165900543f},
-std::array<float,2>{0.788302839f, 0.654319346f},
-std::array<float,2>{0.162239f, 0.334014177f},
-std::array<float,2>{0.0824770033f, 0.572025418f},
-std::array<float,2>{0.896966279f, 0.420928389f},
-std::array<float,2>{0.576737583f, 0.78719151f},
-std::array<float,2>{0.391418487f, 0.108453915f},
-std::array<float,2>{0.217444673f, 0.831284583f},
-std::array<float,2>{0.813226163f, 0.00831465796f},
-std::array<float,2>{0.656463385f, 0.546999753f},
-std::array<float,2>{0.313375354f, 0.485183716f},
-std::array<float,2>{0.468448311f, 0.733164668f},
-std::array<float,2>{0.510120511f, 0.306856483f},
-std::array<float,2>{0.961363614f, 0.879356027f},
-std::array<float,2>{0.0488417782f, 0.198402748f},
-std::array<float,2>{0.421268284f, 0.755815387f},
-std::array<float,2>{0.623259664f, 0.069203794f},
-std::array<float,2>{0.921321094f, 0.599226534f},
-std::array<float,2>{0.0990322009f, 0.37796852f},
-std::array<float,2>{0.14811112f, 0.679640353f},
-std::array<float,2>{0.757864356f, 0.372049391f},
-std::array<float,2>{0.71025908f, 0.980549395f},
-std::array<float,2>{0.285597891f, 0.14424099f},
-std::array<float,2>{0.013123502f, 0.935655892f},
-std::array<float,2>{0.969060838f, 0.232813671f},
-std::array<float,2>{0.543321669f, 0.707242548f},
-std::array<float,2>{0.477682889f, 0.255386859f},
-std::array<float,2>{0.365155399f, 0.508343816f},
-std::array<float,2>{0.6514709f, 0.450275898f},
-std::array<float,2>{0.863849223f, 0.846930921f},
-std::array<float,2>{0.231193632f, 0.0512703024f},
-std::array<float,2>{0.290751845f, 0.790414631f},
-std::array<float,2>{0.714207232f, 0.0974860936f},
-std::array<float,2>{0.753199875f, 0.562790036f},
-std::array<float,2>{0.152920216f, 0.411735237f},
-std::array<float,2>{0.103236295f, 0.640743673f},
-std::array<float,2>{0.913857043f, 0.336190462f},
-std::array<float,2>{0.612969339f, 0.944556296f},
-std::array<float,2>{0.412902236f, 0.157402858f},
-std::array<float,2>{0.224751934f, 0.885293484f},
-std::array<float,2>{0.867739022f, 0.189341098f},
-std::array<float,2>{0.643037319f, 0.724851489f},
-std::array<float,2>{0.371719688f, 0.298073143f},
-std::array<float,2>{0.47644949f, 0.55602771f},
-std::array<float,2>{0.533786476f, 0.49974072f},
-std::array<float,2>{0.976690769f, 0.837375522f},
-std::array<float,2>{0.00584980473f, 0.00751033053f},
-std::array<float,2>{0.405968755f, 0.971640408f},
-std::array<float,2>{0.567383826f, 0.149998009f},
-std::array<float,2>{0.900590539f, 0.683718741f},
-std::array<float,2>{0.0861526355f, 0.363521248f},
-std::array<float,2>{0.169788182f, 0.606255949f},
-std::array<float,2>{0.791682124f, 0.390602499f},
-std::array<float,2>{0.736865997f, 0.763367653f},
-std::array<float,2>{0.258976966f, 0.0721012726f},
-std::array<float,2>{0.0585215464f, 0.858640254f},
-std::array<float,2>{0.954286397f, 0.0571958013f},
-std::array<float,2>{0.504210889f, 0.500432253f},
-std::array<float,2>{0.455874801f, 0.442237556f},
-std::array<float,2>{0.323507577f, 0.715907812f},
-std::array<float,2>{0.666538775f, 0.264494568f},
-std::array<float,2>{0.821524084f, 0.928672135f},
-std::array<float,2>{0.205964833f, 0.221469685f},
-std::array<float,2>{0.355802417f, 0.915526688f},
-std::array<float,2>{0.633732796f, 0.236996353f},
-std::array<float,2>{0.853778541f, 0.692574322f},
-std::array<float,2>{0.242849067f, 0.266719818f},
-std::array<float,2>{0.0258276388f, 0.530185997f},
-std::array<float,2>{0.990953743f, 0.46644035f},
-std::array<float,2>{0.552334309f, 0.86539495f},
-std::array<float,2>{0.497706681f, 0.0449829958f},
-std::array<float,2>{0.140378326f, 0.778978527f},
-std::array<float,2>{0.779518664f, 0.0878373981f},
-std::array<float,2>{0.690131009f, 0.622546077f},
-std::array<float,2>{0.307933688f, 0.403566569f},
-std::array<float,2>{0.432201385f, 0.665079534f},
-std::array<float,2>{0.601777077f, 0.355493128f},
-std::array<float,2>{0.9238289f, 0.984887719f},
-std::array<float,2>{0.122043706f, 0.125582382f},
-std::array<float,2>{0.449484855f, 0.817518294f},
-std::array<float,2>{0.522027969f, 0.0186921135f},
-std::array<float,2>{0.948925078f, 0.546590447f},
-std::array<float,2>{0.0407569259f, 0.470799983f},
-std::array<float,2>{0.188274443f, 0.739282012f},
-std::array<float,2>{0.840913713f, 0.286180854f},
-std::array<float,2>{0.681377292f, 0.89865315f},
-std::array<float,2>{0.33366394f, 0.213882715f},
-std::array<float,2>{0.0759254098f, 0.954068005f},
-std::array<float,2>{0.878446102f, 0.176100895f},
-std::array<float,2>{0.582913756f, 0.636758387f},
-std::array<float,2>{0.383725166f, 0.325217068f},
-std::array<float,2>{0.268444538f, 0.591715991f},
-std::array<float,2>{0.725868106f, 0.431382149f},
-std::array<float,2>{0.799903572f, 0.809890747f},
-std::array<float,2>{0.177424029f, 0.118601106f},
-std::array<float,2>{0.370260358f, 0.771015465f},
-std::array<float,2>{0.645397604f, 0.0852774233f},
-std::array<float,2>{0.872487307f, 0.616730094f},
-std::array<float,2>{0.222085506f, 0.392389655f},
-std::array<float,2>{0.00181891676f, 0.659046292f},
-std::array<float,2>{0.982538402f, 0.344495386f},
-std::array<float,2>{0.536023021f, 0.997556031f},
-std::array<float,2>{0.47204119f, 0.137570366f},
-std::array<float,2>{0.150066406f, 0.913024545f},
-std::array<float,2>{0.755161822f, 0.244254753f},
-std::array<float,2>{0.715144575f, 0.70160985f},
-std::array<float,2>{0.293776512f, 0.273859024f},
-std::array<float,2>{0.407132357f, 0.520400524f},
-std::array<float,2>{0.614802003f, 0.458811313f},
-std::array<float,2>{0.909570515f, 0.870255947f},
-std::array<float,2>{0.106094658f, 0.0350303315f},
-std::array<float,2>{0.458508998f, 0.964947701f},
-std::array<float,2>{0.500073075f, 0.184693441f},
-std::array<float,2>{0.958292544f, 0.632522941f},
-std::array<float,2>{0.0605937727f, 0.319193751f},
-std::array<float,2>{0.20818013f, 0.584052384f},
-std::array<float,2>{0.824572802f, 0.426874429f},
-std::array<float,2>{0.668842375f, 0.799472094f},
-std::array<float,2>{0.326635689f, 0.114500985f},
-std::array<float,2>{0.0901695564f, 0.824590743f},
-std::array<float,2>{0.90496695f, 0.0267021507f},
-std::array<float,2>{0.564154923f, 0.537956536f},
-std::array<float,2>{0.401945114f, 0.477767408f},
-std::array<float,2>{0.263011187f, 0.74770993f},
-std::array<float,2>{0.740241706f, 0.289892763f},
-std::array<float,2>{0.795127809f, 0.891028345f},
-std::array<float,2>{0.166179851f, 0.203353092f},
-std::array<float,2>{0.310819417f, 0.876361847f},
-std::array<float,2>{0.692155421f, 0.201704502f},
-std::array<float,2>{0.774980068f, 0.727654159f},
-std::array<float,2>{0.133447722f, 0.31238997f},
-std::array<float,2>{0.119818658f, 0.554456413f},
-std::array<float,2>{0.926914692f, 0.490389794f},
-std::array<float,2>{0.606033385f, 0.832663119f},
-std::array<float,2>{0.434686273f, 0.0154285654f},
-std::array<float,2>{0.246213257f, 0.784719706f},
-std::array<float,2>{0.857524931f, 0.102335788f},
-std::array<float,2>{0.639874041f, 0.57533592f},
-std::array<float,2>{0.354186565f, 0.415600806f},
-std::array<float,2>{0.492743433f, 0.652218461f},
-std::array<float,2>{0.54985714f, 0.330085158f},
-std::array<float,2>{0.987537444f, 0.952057719f},
-std::array<float,2>{0.0287412815f, 0.171166316f},
-std::array<float,2>{0.388347417f, 0.847820759f},
-std::array<float,2>{0.581268251f, 0.0493214801f},
-std::array<float,2>{0.879398167f, 0.513413668f},
-std::array<float,2>{0.0713423118f, 0.448705673f},
-std::array<float,2>{0.172259688f, 0.706884861f},
-std::array<float,2>{0.801180959f, 0.253853291f},
-std::array<float,2>{0.720500112f, 0.931158066f},
-std::array<float,2>{0.269726217f, 0.229100972f},
-std::array<float,2>{0.0443198718f, 0.976678312f},
-std::array<float,2>{0.949380457f, 0.146329433f},
-std::array<float,2>{0.516951025f, 0.672700882f},
-std::array<float,2>{0.446654081f, 0.36859405f},
-std::array<float,2>{0.330109835f, 0.596807063f},
-std::array<float,2>{0.687129617f, 0.381848514f},
-std::array<float,2>{0.83840543f, 0.752341926f},
-std::array<float,2>{0.193441942f, 0.0628913566f},
-std::array<float,2>{0.279969186f, 0.840089381f},
-std::array<float,2>{0.73058635f, 0.000802090857f},
-std::array<float,2>{0.80746299f, 0.559962213f},
-std::array<float,2>{0.18049407f, 0.495214492f},
-std::array<float,2>{0.0662585571f, 0.72181046f},
-std::array<float,2>{0.887844682f, 0.304588526f},
-std::array<float,2>{0.588121176f, 0.888503611f},
-std::array<float,2>{0.381846786f, 0.193256319f},
-std::array<float,2>{0.202347919f, 0.938458681f},
-std::array<float,2>{0.834642172f, 0.163738519f},
-std::array<float,2>{0.675966263f, 0.646400869f},
-std::array<float,2>{0.340450376f, 0.342773438f},
-std::array<float,2>{0.440395534f, 0.567465842f},
-std::array<float,2>{0.527505219f, 0.408012986f},
-std::array<float,2>{0.945044339f, 0.793472469f},
-std::array<float,2>{0.0327342115f, 0.10131111f},
-std::array<float,2>{0.424670428f, 0.925063133f},
-std::array<float,2>{0.599205077f, 0.223807216f},
-std::array<float,2>{0.931701601f, 0.711720824f},
-std::array<float,2>{0.112165913f, 0.258123875f},
-std::array<float,2>{0.130661264f, 0.505904198f},
-std::array<float,2>{0.768938303f, 0.440909594f},
-std::array<float,2>{0.701480091f, 0.854579151f},
-std::array<float,2>{0.297702283f, 0.0586070009f},
-std::array<float,2>{0.0157658439f, 0.761398196f},
-std::array<float,2>{0.999112248f, 0.0748798773f},
-std::array<float,2>{0.560255826f, 0.603199422f},
-std::array<float,2>{0.488665164f, 0.386424929f},
-std::array<float,2>{0.345213026f, 0.680866241f},
-std::array<float,2>{0.628848851f, 0.359398544f},
-std::array<float,2>{0.85035497f, 0.973914623f},
-std::array<float,2>{0.237827078f, 0.153007329f},
-std::array<float,2>{0.319939643f, 0.990982592f},
-std::array<float,2>{0.66150111f, 0.130008236f},
-std::array<float,2>{0.81765151f, 0.668326318f},
-std::array<float,2>{0.21446225f, 0.352580011f},
-std::array<float,2>{0.0518117659f, 0.619647563f},
-std::array<float,2>{0.965465009f, 0.399373978f},
-std::array<float,2>{0.513638139f, 0.776647687f},
-std::array<float,2>{0.464665771f, 0.0915678367f},
-std::array<float,2>{0.158648774f, 0.860868156f},
-std::array<float,2>{0.784515619f, 0.0407133214f},
-std::array<float,2>{0.74691093f, 0.524682641f},
-std::array<float,2>{0.257430673f, 0.463423789f},
-std::array<float,2>{0.395133615f, 0.690225184f},
-std::array<float,2>{0.572702885f, 0.272673696f},
-std::array<float,2>{0.891808391f, 0.91856575f},
-std::array<float,2>{0.0784944147f, 0.240908876f},
-std::array<float,2>{0.482647181f, 0.808202982f},
-std::array<float,2>{0.539290488f, 0.123775393f},
-std::array<float,2>{0.974420547f, 0.587524116f},
-std::array<float,2>{0.0101122269f, 0.43637228f},
-std::array<float,2>{0.227574259f, 0.634414434f},
-std::array<float,2>{0.863133848f, 0.321507365f},
-std::array<float,2>{0.65241009f, 0.960691869f},
-std::array<float,2>{0.359465927f, 0.175663188f},
-std::array<float,2>{0.0937956274f, 0.903259397f},
-std::array<float,2>{0.917130172f, 0.215671003f},
-std::array<float,2>{0.619668663f, 0.735546112f},
-std::array<float,2>{0.416419953f, 0.282156795f},
-std::array<float,2>{0.28158462f, 0.541810751f},
-std::array<float,2>{0.703524649f, 0.473775536f},
-std::array<float,2>{0.764435887f, 0.812589586f},
-std::array<float,2>{0.141839042f, 0.0221237857f},
-std::array<float,2>{0.349929154f, 0.823573172f},
-std::array<float,2>{0.632786632f, 0.0291053765f},
-std::array<float,2>{0.844889998f, 0.532709837f},
-std::array<float,2>{0.240890622f, 0.480496287f},
-std::array<float,2>{0.0221008584f, 0.742404521f},
-std::array<float,2>{0.995550394f, 0.296053797f},
-std::array<float,2>{0.556242168f, 0.894724548f},
-std::array<float,2>{0.485790849f, 0.207151636f},
-std::array<float,2>{0.125118703f, 0.964380205f},
-std::array<float,2>{0.771327078f, 0.183356345f},
-std::array<float,2>{0.699009776f, 0.625704587f},
-std::array<float,2>{0.301913112f, 0.314030111f},
-std::array<float,2>{0.42824471f, 0.578361213f},
-std::array<float,2>{0.597449422f, 0.422252715f},
-std::array<float,2>{0.934655607f, 0.803349674f},
-std::array<float,2>{0.113642156f, 0.110538445f},
-std::array<float,2>{0.444990933f, 0.906987131f},
-std::array<float,2>{0.526026189f, 0.248353586f},
-std::array<float,2>{0.93790859f, 0.697465003f},
-std::array<float,2>{0.0364313126f, 0.280507237f},
-std::array<float,2>{0.195941582f, 0.516451299f},
-std::array<float,2>{0.831688821f, 0.454732597f},
-std::array<float,2>{0.67552948f, 0.874802351f},
-std::array<float,2>{0.337261915f, 0.0357856341f},
-std::array<float,2>{0.0681733266f, 0.766078174f},
-std::array<float,2>{0.886456847f, 0.0815779716f},
-std::array<float,2>{0.593331695f, 0.612617552f},
-std::array<float,2>{0.376930684f, 0.396472752f},
-std::array<float,2>{0.275552213f, 0.661787093f},
-std::array<float,2>{0.728969038f, 0.350082129f},
-std::array<float,2>{0.810372651f, 0.993492126f},
-std::array<float,2>{0.184933007f, 0.134882107f},
-std::array<float,2>{0.287852973f, 0.98348105f},
-std::array<float,2>{0.707411647f, 0.142127812f},
-std::array<float,2>{0.759938538f, 0.676591098f},
-std::array<float,2>{0.146352991f, 0.373232424f},
-std::array<float,2>{0.100913092f, 0.599639177f},
-std::array<float,2>{0.919551671f, 0.375192344f},
-std::array<float,2>{0.622764647f, 0.756501079f},
-std::array<float,2>{0.418503344f, 0.0665936768f},
-std::array<float,2>{0.232628018f, 0.843898535f},
-std::array<float,2>{0.8652547f, 0.0533509888f},
-std::array<float,2>{0.649184942f, 0.51138258f},
-std::array<float,2>{0.366892993f, 0.45189327f},
-std::array<float,2>{0.479100198f, 0.709429801f},
-std::array<float,2>{0.545332968f, 0.255889446f},
-std::array<float,2>{0.972270846f, 0.933774948f},
-std::array<float,2>{0.0140420897f, 0.230688438f},
-std::array<float,2>{0.39405036f, 0.785274148f},
-std::array<float,2>{0.575505197f, 0.106823497f},
-std::array<float,2>{0.896385252f, 0.572827041f},
-std::array<float,2>{0.0847834423f, 0.419263214f},
-std::array<float,2>{0.160159573f, 0.652361095f},
-std::array<float,2>{0.786358774f, 0.332344174f},
-std::array<float,2>{0.743938506f, 0.947420418f},
-std::array<float,2>{0.252767324f, 0.166110337f},
-std::array<float,2>{0.0484978147f, 0.882687867f},
-std::array<float,2>{0.964638412f, 0.196160838f},
-std::array<float,2>{0.509005964f, 0.732010663f},
-std::array<float,2>{0.46567896f, 0.306091994f},
-std::array<float,2>{0.315177828f, 0.550498605f},
-std::array<float,2>{0.659613967f, 0.487576216f},
-std::array<float,2>{0.816045284f, 0.828912199f},
-std::array<float,2>{0.215299979f, 0.0116830477f},
-std::array<float,2>{0.260240555f, 0.765482843f},
-std::array<float,2>{0.735063553f, 0.0736882091f},
-std::array<float,2>{0.790166914f, 0.609266043f},
-std::array<float,2>{0.170031324f, 0.387632519f},
-std::array<float,2>{0.0879218131f, 0.685802996f},
-std::array<float,2>{0.900224447f, 0.36539194f},
-std::array<float,2>{0.56913358f, 0.969244957f},
-std::array<float,2>{0.403939247f, 0.15136674f},
-std::array<float,2>{0.203451201f, 0.926515639f},
-std::array<float,2>{0.823559284f, 0.220359743f},
-std::array<float,2>{0.664995193f, 0.716853797f},
-std::array<float,2>{0.321585864f, 0.262869865f},
-std::array<float,2>{0.45415327f, 0.502422273f},
-std::array<float,2>{0.506543458f, 0.443990588f},
-std::array<float,2>{0.95574826f, 0.85623771f},
-std::array<float,2>{0.0547586717f, 0.0561167784f},
-std::array<float,2>{0.411481559f, 0.942944586f},
-std::array<float,2>{0.61079824f, 0.159640059f},
-std::array<float,2>{0.911763728f, 0.643462002f},
-std::array<float,2>{0.104987569f, 0.338874876f},
-std::array<float,2>{0.15564771f, 0.564689398f},
-std::array<float,2>{0.75078094f, 0.412608266f},
-std::array<float,2>{0.712790668f, 0.792777717f},
-std::array<float,2>{0.292919904f, 0.0951546878f},
-std::array<float,2>{0.00723029952f, 0.838739693f},
-std::array<float,2>{0.979738414f, 0.00461996906f},
-std::array<float,2>{0.531337142f, 0.558568716f},
-std::array<float,2>{0.473465949f, 0.497273892f},
-std::array<float,2>{0.37348941f, 0.723998368f},
-std::array<float,2>{0.641961157f, 0.300584555f},
-std::array<float,2>{0.870210648f, 0.884327114f},
-std::array<float,2>{0.223932326f, 0.189845622f},
-std::array<float,2>{0.33414185f, 0.901147068f},
-std::array<float,2>{0.683582425f, 0.212160155f},
-std::array<float,2>{0.8427068f, 0.741745591f},
-std::array<float,2>{0.190302983f, 0.287548184f},
-std::array<float,2>{0.041489657f, 0.54353267f},
-std::array<float,2>{0.94619596f, 0.469081759f},
-std::array<float,2>{0.520851076f, 0.819435298f},
-std::array<float,2>{0.45299229f, 0.0161439814f},
-std::array<float,2>{0.178607211f, 0.811734259f},
-std::array<float,2>{0.797388852f, 0.119997635f},
-std::array<float,2>{0.724565327f, 0.592554212f},
-std::array<float,2>{0.265770078f, 0.432789892f},
-std::array<float,2>{0.386106104f, 0.639743805f},
-std::array<float,2>{0.585646927f, 0.32654345f},
-std::array<float,2>{0.875240743f, 0.955726147f},
-std::array<float,2>{0.0768940449f, 0.179125503f},
-std::array<float,2>{0.498503298f, 0.863396525f},
-std::array<float,2>{0.554424047f, 0.0445011221f},
-std::array<float,2>{0.989571512f, 0.529203117f},
-std::array<float,2>{0.0249876771f, 0.46700272f},
-std::array<float,2>{0.245291322f, 0.694296181f},
-std::array<float,2>{0.851648986f, 0.268161565f},
-std::array<float,2>{0.63599354f, 0.916195273f},
-std::array<float,2>{0.358507484f, 0.235227451f},
-std::array<float,2>{0.12309169f, 0.98765713f},
-std::array<float,2>{0.92195338f, 0.128527477f},
-std::array<float,2>{0.605205595f, 0.666642666f},
-std::array<float,2>{0.431565821f, 0.358315349f},
-std::array<float,2>{0.305182725f, 0.624720693f},
-std::array<float,2>{0.68773514f, 0.405957848f},
-std::array<float,2>{0.777695f, 0.780371904f},
-std::array<float,2>{0.137583196f, 0.0887664706f},
-std::array<float,2>{0.325166881f, 0.797756135f},
-std::array<float,2>{0.670678258f, 0.116657265f},
-std::array<float,2>{0.826992393f, 0.582515478f},
-std::array<float,2>{0.209610581f, 0.42865321f},
-std::array<float,2>{0.0587601699f, 0.630447686f},
-std::array<float,2>{0.959930718f, 0.318105012f},
-std::array<float,2>{0.502646625f, 0.968632281f},
-std::array<float,2>{0.459819973f, 0.187466666f},
-std::array<float,2>{0.164157078f, 0.89269352f},
-std::array<float,2>{0.793848872f, 0.206904471f},
-std::array<float,2>{0.739057541f, 0.749893725f},
-std::array<float,2>{0.265248328f, 0.292552352f},
-std::array<float,2>{0.399862349f, 0.535728931f},
-std::array<float,2>{0.565146923f, 0.47885716f},
-std::array<float,2>{0.90422368f, 0.826229632f},
-std::array<float,2>{0.0934523717f, 0.0246750396f},
-std::array<float,2>{0.470066875f, 0.998723507f},
-std::array<float,2>{0.537837625f, 0.1403642f},
-std::array<float,2>{0.980600536f, 0.658176601f},
-std::array<float,2>{0.00265454175f, 0.347250551f},
-std::array<float,2>{0.220483556f, 0.614148617f},
-std::array<float,2>{0.873327434f, 0.393767148f},
-std::array<float,2>{0.648225129f, 0.772955239f},
-std::array<float,2>{0.367867947f, 0.0827591866f},
-std::array<float,2>{0.108908653f, 0.868470192f},
-std::array<float,2>{0.907494009f, 0.0320672654f},
-std::array<float,2>{0.616342425f, 0.522825062f},
-std::array<float,2>{0.409721196f, 0.459727556f},
-std::array<float,2>{0.29630354f, 0.70039326f},
-std::array<float,2>{0.716951489f, 0.277035028f},
-std::array<float,2>{0.756509244f, 0.911580384f},
-std::array<float,2>{0.151248693f, 0.242627025f},
-std::array<float,2>{0.273289621f, 0.931918323f},
-std::array<float,2>{0.721396565f, 0.228112087f},
-std::array<float,2>{0.80466342f, 0.704170346f},
-std::array<float,2>{0.175446659f, 0.251551688f},
-std::array<float,2>{0.0740913302f, 0.513777256f},
-std::array<float,2>{0.881542146f, 0.446478724f},
-std::array<float,2>{0.579148591f, 0.851107657f},
-std::array<float,2>{0.389550805f, 0.047241658f},
-std::array<float,2>{0.192419037f, 0.750235617f},
-std::array<float,2>{0.837574184f, 0.065872483f},
-std::array<float,2>{0.683666348f, 0.595250726f},
-std::array<float,2>{0.328847378f, 0.379634678f},
-std::array<float,2>{0.449145585f, 0.675088346f},
-std::array<float,2>{0.518507361f, 0.370291352f},
-std::array<float,2>{0.952088714f, 0.980021238f},
-std::array<float,2>{0.0465435088f, 0.147384465f},
-std::array<float,2>{0.437288165f, 0.834250569f},
-std::array<float,2>{0.608121753f, 0.0131381257f},
-std::array<float,2>{0.927952647f, 0.552154839f},
-std::array<float,2>{0.118835978f, 0.489410549f},
-std::array<float,2>{0.135214821f, 0.728557229f},
-std::array<float,2>{0.776603997f, 0.310382158f},
-std::array<float,2>{0.69530642f, 0.878512025f},
-std::array<float,2>{0.309186399f, 0.199813873f},
-std::array<float,2>{0.0298307072f, 0.95026052f},
-std::array<float,2>{0.985368073f, 0.168361187f},
-std::array<float,2>{0.54819572f, 0.648921072f},
-std::array<float,2>{0.494876593f, 0.32997638f},
-std::array<float,2>{0.352549911f, 0.576646864f},
-std::array<float,2>{0.637533069f, 0.417535961f},
-std::array<float,2>{0.856812775f, 0.78308934f},
-std::array<float,2>{0.248703346f, 0.104979679f},
-std::array<float,2>{0.299014777f, 0.852995276f},
-std::array<float,2>{0.69941175f, 0.0611711293f},
-std::array<float,2>{0.767229855f, 0.504302919f},
-std::array<float,2>{0.131635293f, 0.43782717f},
-std::array<float,2>{0.110554695f, 0.714472115f},
-std::array<float,2>{0.931526244f, 0.260426998f},
-std::array<float,2>{0.600587606f, 0.923792601f},
-std::array<float,2>{0.422302753f, 0.225640416f},
-std::array<float,2>{0.234586f, 0.976225793f},
-std::array<float,2>{0.848130226f, 0.155375764f},
-std::array<float,2>{0.626816988f, 0.683232188f},
-std::array<float,2>{0.345800787f, 0.362178713f},
-std::array<float,2>{0.49055931f, 0.605156243f},
-std::array<float,2>{0.560673177f, 0.383642793f},
-std::array<float,2>{0.996190667f, 0.758872092f},
-std::array<float,2>{0.0182477478f, 0.0764760226f},
-std::array<float,2>{0.380324721f, 0.889530838f},
-std::array<float,2>{0.587468326f, 0.194074333f},
-std::array<float,2>{0.889627993f, 0.719845951f},
-std::array<float,2>{0.063962914f, 0.301379234f},
-std::array<float,2>{0.182202965f, 0.561542273f},
-std::array<float,2>{0.806322753f, 0.493054509f},
-std::array<float,2>{0.734342694f, 0.843396127f},
-std::array<float,2>{0.278658032f, 0.00364356092f},
-std::array<float,2>{0.0351052396f, 0.795675993f},
-std::array<float,2>{0.942346513f, 0.0987022966f},
-std::array<float,2>{0.530935049f, 0.570098042f},
-std::array<float,2>{0.437998563f, 0.408466548f},
-std::array<float,2>{0.342285037f, 0.647098899f},
-std::array<float,2>{0.678758383f, 0.341492444f},
-std::array<float,2>{0.833162367f, 0.939652145f},
-std::array<float,2>{0.20086138f, 0.160472527f},
-std::array<float,2>{0.363146991f, 0.958573222f},
-std::array<float,2>{0.655618131f, 0.172427446f},
-std::array<float,2>{0.861235678f, 0.634788871f},
-std::array<float,2>{0.229997844f, 0.323587149f},
-std::array<float,2>{0.00867806375f, 0.588184595f},
-std::array<float,2>{0.974676907f, 0.434472293f},
-std::array<float,2>{0.541501641f, 0.805348635f},
-std::array<float,2>{0.482189417f, 0.122223787f},
-std::array<float,2>{0.143671617f, 0.815351486f},
-std::array<float,2>{0.76327306f, 0.0204140693f},
-std::array<float,2>{0.705302536f, 0.539907813f},
-std::array<float,2>{0.284694254f, 0.476379931f},
-std::array<float,2>{0.415058494f, 0.736392915f},
-std::array<float,2>{0.617670357f, 0.28388682f},
-std::array<float,2>{0.914836943f, 0.904728591f},
-std::array<float,2>{0.0966756493f, 0.217202038f},
-std::array<float,2>{0.462743104f, 0.773498893f},
-std::array<float,2>{0.515527546f, 0.0924895331f},
-std::array<float,2>{0.966998398f, 0.618147969f},
-std::array<float,2>{0.0543695949f, 0.402043998f},
-std::array<float,2>{0.212444678f, 0.671274722f},
-std::array<float,2>{0.820234478f, 0.355098099f},
-std::array<float,2>{0.663162291f, 0.98849231f},
-std::array<float,2>{0.317921042f, 0.131582454f},
-std::array<float,2>{0.0811662897f, 0.92023468f},
-std::array<float,2>{0.894430816f, 0.23882626f},
-std::array<float,2>{0.570457637f, 0.688455582f},
-std::array<float,2>{0.39693141f, 0.271215647f},
-std::array<float,2>{0.254485577f, 0.527118564f},
-std::array<float,2>{0.74877429f, 0.462217301f},
-std::array<float,2>{0.78236407f, 0.862130702f},
-std::array<float,2>{0.157066554f, 0.042493891f}}
\ No newline at end of file
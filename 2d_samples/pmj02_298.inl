@@ -1,4096 +0,0 @@
-{std::array<float,2>{0.321668029f, 0.504152119f},
-std::array<float,2>{0.640640616f, 0.215034053f},
-std::array<float,2>{0.228494555f, 0.260286272f},
-std::array<float,2>{0.751188457f, 0.814619124f},
-std::array<float,2>{0.0419768691f, 0.986255288f},
-std::array<float,2>{0.947799861f, 0.492499471f},
-std::array<float,2>{0.466047257f, 0.0306800567f},
-std::array<float,2>{0.588109553f, 0.712641835f},
-std::array<float,2>{0.147876099f, 0.669862688f},
-std::array<float,2>{0.813927591f, 0.0898775011f},
-std::array<float,2>{0.2818501f, 0.388816059f},
-std::array<float,2>{0.70324558f, 0.883730054f},
-std::array<float,2>{0.387347192f, 0.75315696f},
-std::array<float,2>{0.507050335f, 0.349300712f},
-std::array<float,2>{0.105839029f, 0.137826249f},
-std::array<float,2>{0.879512906f, 0.612365484f},
-std::array<float,2>{0.490618497f, 0.748263717f},
-std::array<float,2>{0.609556675f, 0.053459052f},
-std::array<float,2>{0.0189868398f, 0.465865374f},
-std::array<float,2>{0.994725287f, 0.960042059f},
-std::array<float,2>{0.190579414f, 0.863972485f},
-std::array<float,2>{0.7888605f, 0.286157787f},
-std::array<float,2>{0.345147759f, 0.220877364f},
-std::array<float,2>{0.680688322f, 0.536464274f},
-std::array<float,2>{0.0793187916f, 0.582051277f},
-std::array<float,2>{0.910995901f, 0.182760045f},
-std::array<float,2>{0.408237547f, 0.338069201f},
-std::array<float,2>{0.536693454f, 0.788752377f},
-std::array<float,2>{0.269438028f, 0.933798373f},
-std::array<float,2>{0.725799918f, 0.41231063f},
-std::array<float,2>{0.181924462f, 0.100682862f},
-std::array<float,2>{0.861470938f, 0.652720869f},
-std::array<float,2>{0.297360659f, 0.635725737f},
-std::array<float,2>{0.692396879f, 0.113511458f},
-std::array<float,2>{0.126986295f, 0.425211042f},
-std::array<float,2>{0.838536382f, 0.917230427f},
-std::array<float,2>{0.116793014f, 0.812294006f},
-std::array<float,2>{0.891080379f, 0.313480973f},
-std::array<float,2>{0.392083108f, 0.164883971f},
-std::array<float,2>{0.527109504f, 0.570290029f},
-std::array<float,2>{0.245757997f, 0.547222793f},
-std::array<float,2>{0.777619421f, 0.244915888f},
-std::array<float,2>{0.32902953f, 0.310850561f},
-std::array<float,2>{0.632710338f, 0.844652772f},
-std::array<float,2>{0.444416493f, 0.946718454f},
-std::array<float,2>{0.565439761f, 0.438370556f},
-std::array<float,2>{0.0616984181f, 0.0321646854f},
-std::array<float,2>{0.953455567f, 0.721361101f},
-std::array<float,2>{0.428418308f, 0.605926633f},
-std::array<float,2>{0.559056818f, 0.153266937f},
-std::array<float,2>{0.0685463697f, 0.365515351f},
-std::array<float,2>{0.921941459f, 0.774619699f},
-std::array<float,2>{0.16225867f, 0.892732084f},
-std::array<float,2>{0.845888257f, 0.401330858f},
-std::array<float,2>{0.259110808f, 0.0695757717f},
-std::array<float,2>{0.743690729f, 0.682343304f},
-std::array<float,2>{0.00339250267f, 0.697220683f},
-std::array<float,2>{0.977254033f, 0.00131200021f},
-std::array<float,2>{0.471667647f, 0.480922639f},
-std::array<float,2>{0.60599786f, 0.970080376f},
-std::array<float,2>{0.361556023f, 0.835798442f},
-std::array<float,2>{0.666562915f, 0.277562559f},
-std::array<float,2>{0.208662957f, 0.192518696f},
-std::array<float,2>{0.802481592f, 0.525284171f},
-std::array<float,2>{0.257153153f, 0.575173557f},
-std::array<float,2>{0.735918105f, 0.157122672f},
-std::array<float,2>{0.165290639f, 0.324210256f},
-std::array<float,2>{0.855681479f, 0.797114432f},
-std::array<float,2>{0.0738003552f, 0.907698929f},
-std::array<float,2>{0.937225401f, 0.43633613f},
-std::array<float,2>{0.431385398f, 0.117486201f},
-std::array<float,2>{0.548882127f, 0.63266021f},
-std::array<float,2>{0.214733243f, 0.726787925f},
-std::array<float,2>{0.806393862f, 0.0457197167f},
-std::array<float,2>{0.374903649f, 0.451161146f},
-std::array<float,2>{0.65885967f, 0.938065886f},
-std::array<float,2>{0.479774684f, 0.85919416f},
-std::array<float,2>{0.600132167f, 0.299191862f},
-std::array<float,2>{0.00944788568f, 0.240750521f},
-std::array<float,2>{0.975093484f, 0.558080435f},
-std::array<float,2>{0.400797009f, 0.676561415f},
-std::array<float,2>{0.516966283f, 0.071051158f},
-std::array<float,2>{0.119831488f, 0.3921929f},
-std::array<float,2>{0.903148472f, 0.904611528f},
-std::array<float,2>{0.13311626f, 0.766376853f},
-std::array<float,2>{0.828434467f, 0.369328171f},
-std::array<float,2>{0.311836481f, 0.144454762f},
-std::array<float,2>{0.698883832f, 0.594250381f},
-std::array<float,2>{0.0533380173f, 0.516758442f},
-std::array<float,2>{0.966276944f, 0.195801541f},
-std::array<float,2>{0.452038884f, 0.270929217f},
-std::array<float,2>{0.571673214f, 0.84295851f},
-std::array<float,2>{0.337206006f, 0.977121711f},
-std::array<float,2>{0.63590914f, 0.471069038f},
-std::array<float,2>{0.235552281f, 0.0116746183f},
-std::array<float,2>{0.766671002f, 0.693007112f},
-std::array<float,2>{0.356931895f, 0.704205096f},
-std::array<float,2>{0.675248027f, 0.019896185f},
-std::array<float,2>{0.197502926f, 0.485361904f},
-std::array<float,2>{0.790476561f, 0.993894219f},
-std::array<float,2>{0.0252728499f, 0.823811471f},
-std::array<float,2>{0.990895569f, 0.250199825f},
-std::array<float,2>{0.496228933f, 0.208667323f},
-std::array<float,2>{0.622382581f, 0.510833442f},
-std::array<float,2>{0.178960711f, 0.620002687f},
-std::array<float,2>{0.872279108f, 0.12672025f},
-std::array<float,2>{0.274787217f, 0.352426142f},
-std::array<float,2>{0.733550787f, 0.762012541f},
-std::array<float,2>{0.414248914f, 0.876377881f},
-std::array<float,2>{0.541817725f, 0.380763859f},
-std::array<float,2>{0.093551524f, 0.080540061f},
-std::array<float,2>{0.914104164f, 0.663172007f},
-std::array<float,2>{0.460699677f, 0.54603368f},
-std::array<float,2>{0.584688246f, 0.233325064f},
-std::array<float,2>{0.0317316912f, 0.292405993f},
-std::array<float,2>{0.93953377f, 0.869477212f},
-std::array<float,2>{0.225038379f, 0.963061094f},
-std::array<float,2>{0.759805799f, 0.45744592f},
-std::array<float,2>{0.315831542f, 0.0582488813f},
-std::array<float,2>{0.652766109f, 0.739458323f},
-std::array<float,2>{0.0949964672f, 0.647599876f},
-std::array<float,2>{0.885804772f, 0.107099853f},
-std::array<float,2>{0.375100642f, 0.414274693f},
-std::array<float,2>{0.509446442f, 0.922684252f},
-std::array<float,2>{0.291838408f, 0.796589732f},
-std::array<float,2>{0.713859856f, 0.328950524f},
-std::array<float,2>{0.150899932f, 0.178730428f},
-std::array<float,2>{0.826987028f, 0.590984643f},
-std::array<float,2>{0.371055961f, 0.613945842f},
-std::array<float,2>{0.663078547f, 0.134005308f},
-std::array<float,2>{0.216523454f, 0.346453249f},
-std::array<float,2>{0.811307073f, 0.757398069f},
-std::array<float,2>{0.0121604754f, 0.888009965f},
-std::array<float,2>{0.972638071f, 0.383230805f},
-std::array<float,2>{0.481211126f, 0.0870980471f},
-std::array<float,2>{0.595457375f, 0.667381465f},
-std::array<float,2>{0.168167204f, 0.716707826f},
-std::array<float,2>{0.852428496f, 0.0269010253f},
-std::array<float,2>{0.252231598f, 0.496688426f},
-std::array<float,2>{0.741676927f, 0.992087185f},
-std::array<float,2>{0.43672201f, 0.819425523f},
-std::array<float,2>{0.552405477f, 0.264606833f},
-std::array<float,2>{0.0764347389f, 0.214110017f},
-std::array<float,2>{0.932751358f, 0.501911581f},
-std::array<float,2>{0.446941197f, 0.6499663f},
-std::array<float,2>{0.576094091f, 0.0946761668f},
-std::array<float,2>{0.0476460308f, 0.408874393f},
-std::array<float,2>{0.962985873f, 0.933312356f},
-std::array<float,2>{0.238502413f, 0.783898771f},
-std::array<float,2>{0.769610882f, 0.341423243f},
-std::array<float,2>{0.341130704f, 0.186510354f},
-std::array<float,2>{0.637012959f, 0.581915557f},
-std::array<float,2>{0.121627353f, 0.534515202f},
-std::array<float,2>{0.902070105f, 0.225751728f},
-std::array<float,2>{0.404472589f, 0.281391621f},
-std::array<float,2>{0.52231741f, 0.86242193f},
-std::array<float,2>{0.305066079f, 0.95365268f},
-std::array<float,2>{0.702607274f, 0.461422533f},
-std::array<float,2>{0.139739066f, 0.0473374724f},
-std::array<float,2>{0.835703194f, 0.743707418f},
-std::array<float,2>{0.280039012f, 0.723414302f},
-std::array<float,2>{0.729293168f, 0.0355555229f},
-std::array<float,2>{0.175117806f, 0.442818969f},
-std::array<float,2>{0.86901927f, 0.949261606f},
-std::array<float,2>{0.086168848f, 0.847846746f},
-std::array<float,2>{0.921224594f, 0.306067646f},
-std::array<float,2>{0.418465883f, 0.249967128f},
-std::array<float,2>{0.546181798f, 0.553111553f},
-std::array<float,2>{0.202300295f, 0.5649423f},
-std::array<float,2>{0.796557009f, 0.169983715f},
-std::array<float,2>{0.352903217f, 0.318365812f},
-std::array<float,2>{0.676816225f, 0.808160424f},
-std::array<float,2>{0.495397896f, 0.920440197f},
-std::array<float,2>{0.617698014f, 0.427540511f},
-std::array<float,2>{0.0278647188f, 0.112004921f},
-std::array<float,2>{0.988014638f, 0.636931956f},
-std::array<float,2>{0.380299181f, 0.530531228f},
-std::array<float,2>{0.513598979f, 0.19065091f},
-std::array<float,2>{0.101037055f, 0.27397871f},
-std::array<float,2>{0.889279664f, 0.828617275f},
-std::array<float,2>{0.154663071f, 0.97340107f},
-std::array<float,2>{0.823493659f, 0.480157703f},
-std::array<float,2>{0.294690788f, 0.00593028357f},
-std::array<float,2>{0.718679011f, 0.699533105f},
-std::array<float,2>{0.0387425795f, 0.685749471f},
-std::array<float,2>{0.941898167f, 0.0651496574f},
-std::array<float,2>{0.453663617f, 0.406093717f},
-std::array<float,2>{0.581588507f, 0.896646023f},
-std::array<float,2>{0.318949401f, 0.779800713f},
-std::array<float,2>{0.651867092f, 0.362739086f},
-std::array<float,2>{0.220622912f, 0.148891017f},
-std::array<float,2>{0.763035297f, 0.604859591f},
-std::array<float,2>{0.287312061f, 0.56063211f},
-std::array<float,2>{0.708885908f, 0.23499395f},
-std::array<float,2>{0.141880408f, 0.302884787f},
-std::array<float,2>{0.817617118f, 0.853578508f},
-std::array<float,2>{0.104685366f, 0.943660498f},
-std::array<float,2>{0.878016949f, 0.445748359f},
-std::array<float,2>{0.385613859f, 0.0429018289f},
-std::array<float,2>{0.503400087f, 0.73082602f},
-std::array<float,2>{0.23246026f, 0.628554702f},
-std::array<float,2>{0.754766405f, 0.121317409f},
-std::array<float,2>{0.325475276f, 0.431799829f},
-std::array<float,2>{0.646319091f, 0.912353396f},
-std::array<float,2>{0.464453608f, 0.801769316f},
-std::array<float,2>{0.589990079f, 0.32536599f},
-std::array<float,2>{0.0456841886f, 0.163025036f},
-std::array<float,2>{0.951122761f, 0.571151078f},
-std::array<float,2>{0.410295516f, 0.689454436f},
-std::array<float,2>{0.534827888f, 0.0122367237f},
-std::array<float,2>{0.0833774507f, 0.473197192f},
-std::array<float,2>{0.908435106f, 0.981832564f},
-std::array<float,2>{0.18372035f, 0.836234272f},
-std::array<float,2>{0.865451753f, 0.267229438f},
-std::array<float,2>{0.272120923f, 0.202618539f},
-std::array<float,2>{0.722459972f, 0.522719979f},
-std::array<float,2>{0.0227733776f, 0.600038171f},
-std::array<float,2>{0.997802436f, 0.145229787f},
-std::array<float,2>{0.485493958f, 0.374303937f},
-std::array<float,2>{0.614161313f, 0.771853566f},
-std::array<float,2>{0.351501018f, 0.901997089f},
-std::array<float,2>{0.687118173f, 0.396230459f},
-std::array<float,2>{0.193534806f, 0.0756254494f},
-std::array<float,2>{0.781565011f, 0.674643934f},
-std::array<float,2>{0.333403498f, 0.658490121f},
-std::array<float,2>{0.626624048f, 0.0847935379f},
-std::array<float,2>{0.249508381f, 0.376892209f},
-std::array<float,2>{0.777233422f, 0.882433534f},
-std::array<float,2>{0.0581747815f, 0.761077285f},
-std::array<float,2>{0.958608627f, 0.356538028f},
-std::array<float,2>{0.437524676f, 0.128953427f},
-std::array<float,2>{0.569218457f, 0.622702777f},
-std::array<float,2>{0.130625024f, 0.513569474f},
-std::array<float,2>{0.840809107f, 0.205517918f},
-std::array<float,2>{0.303711206f, 0.254463881f},
-std::array<float,2>{0.688891172f, 0.827874839f},
-std::array<float,2>{0.398210585f, 0.998237967f},
-std::array<float,2>{0.528273523f, 0.49059543f},
-std::array<float,2>{0.11085479f, 0.0158664808f},
-std::array<float,2>{0.897558212f, 0.709623098f},
-std::array<float,2>{0.472849876f, 0.586612761f},
-std::array<float,2>{0.60248208f, 0.175732791f},
-std::array<float,2>{0.00450482545f, 0.333411366f},
-std::array<float,2>{0.981957316f, 0.791438878f},
-std::array<float,2>{0.204007745f, 0.927759111f},
-std::array<float,2>{0.798376441f, 0.420383453f},
-std::array<float,2>{0.363310695f, 0.104310483f},
-std::array<float,2>{0.670552909f, 0.642504394f},
-std::array<float,2>{0.06498833f, 0.736265242f},
-std::array<float,2>{0.928082705f, 0.0609299317f},
-std::array<float,2>{0.422401518f, 0.455819279f},
-std::array<float,2>{0.555513442f, 0.965081334f},
-std::array<float,2>{0.265433073f, 0.87224263f},
-std::array<float,2>{0.749876976f, 0.293797672f},
-std::array<float,2>{0.15944922f, 0.228389665f},
-std::array<float,2>{0.848222315f, 0.539453804f},
-std::array<float,2>{0.347640932f, 0.537797809f},
-std::array<float,2>{0.68322289f, 0.219541177f},
-std::array<float,2>{0.187523529f, 0.28876099f},
-std::array<float,2>{0.785320342f, 0.866414905f},
-std::array<float,2>{0.0168067627f, 0.957675338f},
-std::array<float,2>{0.992359221f, 0.4671202f},
-std::array<float,2>{0.488574296f, 0.0526699461f},
-std::array<float,2>{0.612679183f, 0.747231126f},
-std::array<float,2>{0.180063546f, 0.655304432f},
-std::array<float,2>{0.860309958f, 0.0979841501f},
-std::array<float,2>{0.267222226f, 0.410608143f},
-std::array<float,2>{0.723424017f, 0.936739683f},
-std::array<float,2>{0.406355053f, 0.786902249f},
-std::array<float,2>{0.53819102f, 0.337864161f},
-std::array<float,2>{0.081071645f, 0.180509135f},
-std::array<float,2>{0.913809776f, 0.585727572f},
-std::array<float,2>{0.468620926f, 0.714388251f},
-std::array<float,2>{0.587156177f, 0.0277114678f},
-std::array<float,2>{0.0401885435f, 0.49592638f},
-std::array<float,2>{0.946791708f, 0.988095343f},
-std::array<float,2>{0.229922727f, 0.813357711f},
-std::array<float,2>{0.753619313f, 0.25800252f},
-std::array<float,2>{0.322397143f, 0.218404859f},
-std::array<float,2>{0.644130409f, 0.507424653f},
-std::array<float,2>{0.109330133f, 0.610681415f},
-std::array<float,2>{0.882716894f, 0.139962524f},
-std::array<float,2>{0.390620321f, 0.350209802f},
-std::array<float,2>{0.50403899f, 0.751850188f},
-std::array<float,2>{0.284701973f, 0.885847688f},
-std::array<float,2>{0.706515968f, 0.386906832f},
-std::array<float,2>{0.144657135f, 0.0937423855f},
-std::array<float,2>{0.815307975f, 0.670249939f},
-std::array<float,2>{0.260827184f, 0.679888129f},
-std::array<float,2>{0.744253159f, 0.0665997714f},
-std::array<float,2>{0.161262989f, 0.399487406f},
-std::array<float,2>{0.845078349f, 0.891853809f},
-std::array<float,2>{0.067095533f, 0.776468337f},
-std::array<float,2>{0.924246967f, 0.363590091f},
-std::array<float,2>{0.42634514f, 0.155084506f},
-std::array<float,2>{0.561745465f, 0.609047592f},
-std::array<float,2>{0.209058136f, 0.527068853f},
-std::array<float,2>{0.804242492f, 0.1947034f},
-std::array<float,2>{0.36013931f, 0.280879468f},
-std::array<float,2>{0.664365232f, 0.833943486f},
-std::array<float,2>{0.46966815f, 0.972168267f},
-std::array<float,2>{0.607800722f, 0.48258844f},
-std::array<float,2>{0.00175864797f, 0.00202899054f},
-std::array<float,2>{0.980282426f, 0.697542369f},
-std::array<float,2>{0.393185288f, 0.567707777f},
-std::array<float,2>{0.523598909f, 0.167583004f},
-std::array<float,2>{0.113455802f, 0.316064507f},
-std::array<float,2>{0.893039763f, 0.810495496f},
-std::array<float,2>{0.126841351f, 0.915829003f},
-std::array<float,2>{0.836369097f, 0.421937376f},
-std::array<float,2>{0.299114257f, 0.115479194f},
-std::array<float,2>{0.694015265f, 0.634353042f},
-std::array<float,2>{0.0595014021f, 0.719205141f},
-std::array<float,2>{0.955463529f, 0.0341622233f},
-std::array<float,2>{0.441941202f, 0.440042645f},
-std::array<float,2>{0.563158453f, 0.949017644f},
-std::array<float,2>{0.330637962f, 0.845994592f},
-std::array<float,2>{0.62915808f, 0.310539395f},
-std::array<float,2>{0.242543533f, 0.243838951f},
-std::array<float,2>{0.779800177f, 0.550706387f},
-std::array<float,2>{0.309218496f, 0.596099019f},
-std::array<float,2>{0.696414948f, 0.14197199f},
-std::array<float,2>{0.135835066f, 0.36770919f},
-std::array<float,2>{0.830107331f, 0.768414676f},
-std::array<float,2>{0.119001172f, 0.903091669f},
-std::array<float,2>{0.905926645f, 0.394139349f},
-std::array<float,2>{0.399564534f, 0.073931776f},
-std::array<float,2>{0.51772517f, 0.679158807f},
-std::array<float,2>{0.237104282f, 0.695237935f},
-std::array<float,2>{0.767952263f, 0.00796580594f},
-std::array<float,2>{0.337950528f, 0.468767375f},
-std::array<float,2>{0.634422541f, 0.980041504f},
-std::array<float,2>{0.451038688f, 0.840680838f},
-std::array<float,2>{0.573544919f, 0.27298975f},
-std::array<float,2>{0.0516575389f, 0.197297633f},
-std::array<float,2>{0.968580723f, 0.519053161f},
-std::array<float,2>{0.431817442f, 0.629841983f},
-std::array<float,2>{0.548683643f, 0.119910456f},
-std::array<float,2>{0.0718945116f, 0.433868527f},
-std::array<float,2>{0.935297668f, 0.908443332f},
-std::array<float,2>{0.166428685f, 0.800494075f},
-std::array<float,2>{0.859139085f, 0.321483761f},
-std::array<float,2>{0.255750567f, 0.159950361f},
-std::array<float,2>{0.738077819f, 0.577794373f},
-std::array<float,2>{0.011129505f, 0.556121886f},
-std::array<float,2>{0.972745359f, 0.239238709f},
-std::array<float,2>{0.47797066f, 0.297765523f},
-std::array<float,2>{0.598015249f, 0.855804741f},
-std::array<float,2>{0.372472048f, 0.941086709f},
-std::array<float,2>{0.657258332f, 0.452090085f},
-std::array<float,2>{0.211857244f, 0.0434742458f},
-std::array<float,2>{0.806936681f, 0.728626072f},
-std::array<float,2>{0.312927097f, 0.741410434f},
-std::array<float,2>{0.655708671f, 0.0558921583f},
-std::array<float,2>{0.224310622f, 0.460481972f},
-std::array<float,2>{0.758272469f, 0.962575257f},
-std::array<float,2>{0.0348484963f, 0.868513763f},
-std::array<float,2>{0.939414263f, 0.289411277f},
-std::array<float,2>{0.45773381f, 0.232309401f},
-std::array<float,2>{0.583793581f, 0.544192076f},
-std::array<float,2>{0.149627417f, 0.593315423f},
-std::array<float,2>{0.824933767f, 0.17656973f},
-std::array<float,2>{0.290597469f, 0.330518037f},
-std::array<float,2>{0.711599231f, 0.794438958f},
-std::array<float,2>{0.377935439f, 0.92542392f},
-std::array<float,2>{0.510547817f, 0.417112648f},
-std::array<float,2>{0.0963066593f, 0.108966805f},
-std::array<float,2>{0.884338081f, 0.645028472f},
-std::array<float,2>{0.499527961f, 0.509113073f},
-std::array<float,2>{0.624162257f, 0.210195646f},
-std::array<float,2>{0.0272527784f, 0.252271891f},
-std::array<float,2>{0.988450229f, 0.820851862f},
-std::array<float,2>{0.196590558f, 0.995819569f},
-std::array<float,2>{0.792083919f, 0.487783223f},
-std::array<float,2>{0.358711839f, 0.0228181947f},
-std::array<float,2>{0.672419786f, 0.706695318f},
-std::array<float,2>{0.091453366f, 0.661437154f},
-std::array<float,2>{0.917596281f, 0.0787119642f},
-std::array<float,2>{0.416695625f, 0.382156253f},
-std::array<float,2>{0.540883183f, 0.877758682f},
-std::array<float,2>{0.277036071f, 0.763880551f},
-std::array<float,2>{0.731553614f, 0.354698718f},
-std::array<float,2>{0.177386358f, 0.128198326f},
-std::array<float,2>{0.873308778f, 0.619075358f},
-std::array<float,2>{0.341928542f, 0.579208195f},
-std::array<float,2>{0.638758898f, 0.18505235f},
-std::array<float,2>{0.242044792f, 0.342142761f},
-std::array<float,2>{0.771704197f, 0.781882584f},
-std::array<float,2>{0.0498739704f, 0.930064142f},
-std::array<float,2>{0.962594509f, 0.406851172f},
-std::array<float,2>{0.447587907f, 0.0971763805f},
-std::array<float,2>{0.577144682f, 0.651641726f},
-std::array<float,2>{0.136737183f, 0.745412469f},
-std::array<float,2>{0.833516061f, 0.0500619076f},
-std::array<float,2>{0.307002246f, 0.463727415f},
-std::array<float,2>{0.70087266f, 0.956863463f},
-std::array<float,2>{0.402762294f, 0.860487998f},
-std::array<float,2>{0.520386398f, 0.283857971f},
-std::array<float,2>{0.124587595f, 0.223652646f},
-std::array<float,2>{0.899577737f, 0.531867504f},
-std::array<float,2>{0.482500702f, 0.665910065f},
-std::array<float,2>{0.596554935f, 0.0890215859f},
-std::array<float,2>{0.0137351863f, 0.385980874f},
-std::array<float,2>{0.96964711f, 0.890139282f},
-std::array<float,2>{0.217531487f, 0.754743636f},
-std::array<float,2>{0.809583008f, 0.345053881f},
-std::array<float,2>{0.367223561f, 0.135461777f},
-std::array<float,2>{0.660171986f, 0.615923047f},
-std::array<float,2>{0.0749291182f, 0.502712965f},
-std::array<float,2>{0.930123568f, 0.212252855f},
-std::array<float,2>{0.433743119f, 0.262208909f},
-std::array<float,2>{0.554076076f, 0.818233967f},
-std::array<float,2>{0.250253141f, 0.989824355f},
-std::array<float,2>{0.738812447f, 0.498130888f},
-std::array<float,2>{0.171425685f, 0.0235194582f},
-std::array<float,2>{0.854797661f, 0.718018174f},
-std::array<float,2>{0.295847744f, 0.703013897f},
-std::array<float,2>{0.715936601f, 0.00462128781f},
-std::array<float,2>{0.152371675f, 0.477018148f},
-std::array<float,2>{0.821596682f, 0.975235581f},
-std::array<float,2>{0.0994968861f, 0.830798924f},
-std::array<float,2>{0.888117969f, 0.277331889f},
-std::array<float,2>{0.382623196f, 0.189316422f},
-std::array<float,2>{0.513704777f, 0.527502239f},
-std::array<float,2>{0.220724896f, 0.601927757f},
-std::array<float,2>{0.76396364f, 0.151454225f},
-std::array<float,2>{0.316672713f, 0.360191703f},
-std::array<float,2>{0.648911357f, 0.777708292f},
-std::array<float,2>{0.455297858f, 0.895293236f},
-std::array<float,2>{0.579436839f, 0.402753055f},
-std::array<float,2>{0.0370688029f, 0.0625869557f},
-std::array<float,2>{0.943781555f, 0.683637261f},
-std::array<float,2>{0.420188993f, 0.551746488f},
-std::array<float,2>{0.54469651f, 0.247237116f},
-std::array<float,2>{0.08812242f, 0.30786404f},
-std::array<float,2>{0.918440223f, 0.85089469f},
-std::array<float,2>{0.173575684f, 0.951555014f},
-std::array<float,2>{0.871086717f, 0.445306093f},
-std::array<float,2>{0.278303117f, 0.0383763835f},
-std::array<float,2>{0.728453338f, 0.724729002f},
-std::array<float,2>{0.0307147112f, 0.639475226f},
-std::array<float,2>{0.985855281f, 0.110512294f},
-std::array<float,2>{0.492296129f, 0.428997487f},
-std::array<float,2>{0.620740235f, 0.918883264f},
-std::array<float,2>{0.354995281f, 0.804944515f},
-std::array<float,2>{0.678784728f, 0.317099571f},
-std::array<float,2>{0.199516341f, 0.168353796f},
-std::array<float,2>{0.794545591f, 0.564379096f},
-std::array<float,2>{0.271046728f, 0.520122647f},
-std::array<float,2>{0.720275402f, 0.201002032f},
-std::array<float,2>{0.185923189f, 0.268982261f},
-std::array<float,2>{0.865141809f, 0.839071095f},
-std::array<float,2>{0.0853781849f, 0.983210325f},
-std::array<float,2>{0.907558799f, 0.475045949f},
-std::array<float,2>{0.414060324f, 0.0148072066f},
-std::array<float,2>{0.532267928f, 0.688971281f},
-std::array<float,2>{0.19302626f, 0.673777223f},
-std::array<float,2>{0.783530831f, 0.0762187168f},
-std::array<float,2>{0.348784f, 0.398173511f},
-std::array<float,2>{0.683991492f, 0.900283694f},
-std::array<float,2>{0.487898797f, 0.769604743f},
-std::array<float,2>{0.616541147f, 0.372152984f},
-std::array<float,2>{0.0209146123f, 0.148096517f},
-std::array<float,2>{0.999671221f, 0.599424779f},
-std::array<float,2>{0.383974075f, 0.734092057f},
-std::array<float,2>{0.500353098f, 0.0402955078f},
-std::array<float,2>{0.10289894f, 0.447687358f},
-std::array<float,2>{0.875956595f, 0.942370057f},
-std::array<float,2>{0.14265874f, 0.853007376f},
-std::array<float,2>{0.819972456f, 0.302311659f},
-std::array<float,2>{0.285653114f, 0.237076938f},
-std::array<float,2>{0.710854828f, 0.559486985f},
-std::array<float,2>{0.0432654396f, 0.573917329f},
-std::array<float,2>{0.952342212f, 0.160191476f},
-std::array<float,2>{0.462471962f, 0.326950699f},
-std::array<float,2>{0.592660725f, 0.803800225f},
-std::array<float,2>{0.327421308f, 0.911884248f},
-std::array<float,2>{0.647442341f, 0.430834979f},
-std::array<float,2>{0.231718704f, 0.123112276f},
-std::array<float,2>{0.756892145f, 0.626568675f},
-std::array<float,2>{0.366083145f, 0.644165635f},
-std::array<float,2>{0.669457972f, 0.103139542f},
-std::array<float,2>{0.206465617f, 0.419023305f},
-std::array<float,2>{0.800220549f, 0.927279353f},
-std::array<float,2>{0.00707841897f, 0.790601373f},
-std::array<float,2>{0.983006239f, 0.335436106f},
-std::array<float,2>{0.474679083f, 0.17282626f},
-std::array<float,2>{0.605406344f, 0.588165104f},
-std::array<float,2>{0.156472251f, 0.541544616f},
-std::array<float,2>{0.850757837f, 0.229781032f},
-std::array<float,2>{0.263105631f, 0.296673805f},
-std::array<float,2>{0.747157037f, 0.874839365f},
-std::array<float,2>{0.424120963f, 0.968084574f},
-std::array<float,2>{0.557244658f, 0.454905093f},
-std::array<float,2>{0.0642063022f, 0.0588238947f},
-std::array<float,2>{0.927491963f, 0.73723644f},
-std::array<float,2>{0.440815419f, 0.624573648f},
-std::array<float,2>{0.566859841f, 0.131722674f},
-std::array<float,2>{0.0555482507f, 0.358171165f},
-std::array<float,2>{0.959032595f, 0.758760989f},
-std::array<float,2>{0.246726364f, 0.880537033f},
-std::array<float,2>{0.774441123f, 0.378464192f},
-std::array<float,2>{0.334127933f, 0.0836043656f},
-std::array<float,2>{0.627682805f, 0.657291055f},
-std::array<float,2>{0.11216975f, 0.708550155f},
-std::array<float,2>{0.89572984f, 0.0187999737f},
-std::array<float,2>{0.395266414f, 0.489975214f},
-std::array<float,2>{0.530213177f, 0.996334195f},
-std::array<float,2>{0.302244514f, 0.82504642f},
-std::array<float,2>{0.689967096f, 0.256303668f},
-std::array<float,2>{0.131207123f, 0.204281062f},
-std::array<float,2>{0.842815101f, 0.515375972f},
-std::array<float,2>{0.329748064f, 0.549371123f},
-std::array<float,2>{0.630916238f, 0.242612332f},
-std::array<float,2>{0.244774759f, 0.309313089f},
-std::array<float,2>{0.778338134f, 0.847506464f},
-std::array<float,2>{0.0614958741f, 0.948179066f},
-std::array<float,2>{0.954226375f, 0.440577298f},
-std::array<float,2>{0.444165319f, 0.0350794941f},
-std::array<float,2>{0.564759254f, 0.719741702f},
-std::array<float,2>{0.128875136f, 0.632998347f},
-std::array<float,2>{0.839362383f, 0.116248623f},
-std::array<float,2>{0.297992229f, 0.423048645f},
-std::array<float,2>{0.691563308f, 0.914187431f},
-std::array<float,2>{0.391001195f, 0.809271932f},
-std::array<float,2>{0.526052117f, 0.314949274f},
-std::array<float,2>{0.115237147f, 0.166341946f},
-std::array<float,2>{0.891871214f, 0.567016542f},
-std::array<float,2>{0.471722871f, 0.699035048f},
-std::array<float,2>{0.606931329f, 0.00347479526f},
-std::array<float,2>{0.00216102833f, 0.48408547f},
-std::array<float,2>{0.977726996f, 0.971332312f},
-std::array<float,2>{0.207331493f, 0.832106173f},
-std::array<float,2>{0.801183879f, 0.279843569f},
-std::array<float,2>{0.362998426f, 0.19405748f},
-std::array<float,2>{0.667008102f, 0.525881946f},
-std::array<float,2>{0.0695461482f, 0.607566118f},
-std::array<float,2>{0.923695862f, 0.156119809f},
-std::array<float,2>{0.42890656f, 0.365058511f},
-std::array<float,2>{0.560405195f, 0.776246548f},
-std::array<float,2>{0.257872015f, 0.890816569f},
-std::array<float,2>{0.742482066f, 0.399012476f},
-std::array<float,2>{0.164057866f, 0.0680774823f},
-std::array<float,2>{0.846708953f, 0.68100822f},
-std::array<float,2>{0.282860726f, 0.670953155f},
-std::array<float,2>{0.704281628f, 0.092329599f},
-std::array<float,2>{0.147082955f, 0.387841642f},
-std::array<float,2>{0.81298852f, 0.885539949f},
-std::array<float,2>{0.107006572f, 0.750370979f},
-std::array<float,2>{0.880329192f, 0.350876063f},
-std::array<float,2>{0.388277054f, 0.139308661f},
-std::array<float,2>{0.505958557f, 0.610303104f},
-std::array<float,2>{0.227323785f, 0.506753743f},
-std::array<float,2>{0.750969708f, 0.217025891f},
-std::array<float,2>{0.320651859f, 0.258947939f},
-std::array<float,2>{0.642541707f, 0.8139624f},
-std::array<float,2>{0.464881808f, 0.987179816f},
-std::array<float,2>{0.589646101f, 0.494918227f},
-std::array<float,2>{0.0426095165f, 0.0286339633f},
-std::array<float,2>{0.948953092f, 0.713118196f},
-std::array<float,2>{0.409819573f, 0.58411181f},
-std::array<float,2>{0.536052465f, 0.180989027f},
-std::array<float,2>{0.0783754885f, 0.336156905f},
-std::array<float,2>{0.911779642f, 0.785195708f},
-std::array<float,2>{0.183530554f, 0.935977042f},
-std::array<float,2>{0.86271143f, 0.411167443f},
-std::array<float,2>{0.268485844f, 0.0994461551f},
-std::array<float,2>{0.725539207f, 0.65453887f},
-std::array<float,2>{0.0179993454f, 0.746972263f},
-std::array<float,2>{0.995907247f, 0.0512665063f},
-std::array<float,2>{0.492175847f, 0.467946768f},
-std::array<float,2>{0.611107945f, 0.958258331f},
-std::array<float,2>{0.344648629f, 0.865865707f},
-std::array<float,2>{0.680020213f, 0.287196636f},
-std::array<float,2>{0.190363988f, 0.220205247f},
-std::array<float,2>{0.787618518f, 0.539006293f},
-std::array<float,2>{0.273921877f, 0.618071795f},
-std::array<float,2>{0.732958496f, 0.12790519f},
-std::array<float,2>{0.178376392f, 0.354374975f},
-std::array<float,2>{0.871567726f, 0.765017986f},
-std::array<float,2>{0.0925927237f, 0.878383815f},
-std::array<float,2>{0.915293932f, 0.381777585f},
-std::array<float,2>{0.41542998f, 0.0795611218f},
-std::array<float,2>{0.542340696f, 0.661000907f},
-std::array<float,2>{0.198949799f, 0.70524466f},
-std::array<float,2>{0.789465129f, 0.0220078081f},
-std::array<float,2>{0.356425166f, 0.486728102f},
-std::array<float,2>{0.674733162f, 0.995109141f},
-std::array<float,2>{0.497611761f, 0.8217237f},
-std::array<float,2>{0.621797085f, 0.252935261f},
-std::array<float,2>{0.0235408731f, 0.209406227f},
-std::array<float,2>{0.992040157f, 0.508666635f},
-std::array<float,2>{0.376748323f, 0.64617461f},
-std::array<float,2>{0.508495629f, 0.107976593f},
-std::array<float,2>{0.0945138633f, 0.416748077f},
-std::array<float,2>{0.884858072f, 0.924219489f},
-std::array<float,2>{0.151976049f, 0.79338181f},
-std::array<float,2>{0.827382207f, 0.33200261f},
-std::array<float,2>{0.292371333f, 0.177118614f},
-std::array<float,2>{0.714283526f, 0.592678487f},
-std::array<float,2>{0.0328308307f, 0.543653965f},
-std::array<float,2>{0.940600753f, 0.230606154f},
-std::array<float,2>{0.4592655f, 0.290248036f},
-std::array<float,2>{0.585703552f, 0.867888868f},
-std::array<float,2>{0.314700156f, 0.961822987f},
-std::array<float,2>{0.653358877f, 0.459391415f},
-std::array<float,2>{0.225608423f, 0.0552645735f},
-std::array<float,2>{0.760901392f, 0.740609229f},
-std::array<float,2>{0.373407573f, 0.730045557f},
-std::array<float,2>{0.659709096f, 0.0448771156f},
-std::array<float,2>{0.213053256f, 0.45226118f},
-std::array<float,2>{0.805068135f, 0.940378249f},
-std::array<float,2>{0.00825110357f, 0.857147276f},
-std::array<float,2>{0.976560295f, 0.298368573f},
-std::array<float,2>{0.478550553f, 0.239866048f},
-std::array<float,2>{0.600939512f, 0.554869592f},
-std::array<float,2>{0.164730906f, 0.576334536f},
-std::array<float,2>{0.8571859f, 0.158743396f},
-std::array<float,2>{0.256397396f, 0.320970893f},
-std::array<float,2>{0.734630525f, 0.799686253f},
-std::array<float,2>{0.430518061f, 0.909495413f},
-std::array<float,2>{0.550631404f, 0.43490836f},
-std::array<float,2>{0.0726260692f, 0.121059775f},
-std::array<float,2>{0.93620801f, 0.630309701f},
-std::array<float,2>{0.452986181f, 0.51798296f},
-std::array<float,2>{0.570975959f, 0.199191913f},
-std::array<float,2>{0.0540566482f, 0.271742463f},
-std::array<float,2>{0.965105474f, 0.841489315f},
-std::array<float,2>{0.234932348f, 0.979045331f},
-std::array<float,2>{0.766198933f, 0.469986439f},
-std::array<float,2>{0.336070955f, 0.00960806571f},
-std::array<float,2>{0.634858489f, 0.693708062f},
-std::array<float,2>{0.120713264f, 0.678050458f},
-std::array<float,2>{0.903573453f, 0.0723899379f},
-std::array<float,2>{0.40173614f, 0.393538386f},
-std::array<float,2>{0.516087055f, 0.904235661f},
-std::array<float,2>{0.311186045f, 0.768889189f},
-std::array<float,2>{0.697364211f, 0.368173361f},
-std::array<float,2>{0.134229541f, 0.14115794f},
-std::array<float,2>{0.829497218f, 0.597156465f},
-std::array<float,2>{0.352136999f, 0.56257236f},
-std::array<float,2>{0.676450908f, 0.169331223f},
-std::array<float,2>{0.202120706f, 0.318049341f},
-std::array<float,2>{0.795146406f, 0.806121945f},
-std::array<float,2>{0.0289708599f, 0.91984868f},
-std::array<float,2>{0.986888945f, 0.428492665f},
-std::array<float,2>{0.49441576f, 0.1094855f},
-std::array<float,2>{0.618515313f, 0.639756024f},
-std::array<float,2>{0.17389904f, 0.725812674f},
-std::array<float,2>{0.867465973f, 0.0378245488f},
-std::array<float,2>{0.28107658f, 0.443500072f},
-std::array<float,2>{0.729846418f, 0.952227771f},
-std::array<float,2>{0.419308245f, 0.849960387f},
-std::array<float,2>{0.544991195f, 0.306893706f},
-std::array<float,2>{0.0871820971f, 0.24661839f},
-std::array<float,2>{0.920152783f, 0.552417278f},
-std::array<float,2>{0.454849362f, 0.685303867f},
-std::array<float,2>{0.580894411f, 0.0643224418f},
-std::array<float,2>{0.0374613032f, 0.40366298f},
-std::array<float,2>{0.943065047f, 0.895810723f},
-std::array<float,2>{0.218924284f, 0.778558731f},
-std::array<float,2>{0.762257338f, 0.361155182f},
-std::array<float,2>{0.319676846f, 0.151260257f},
-std::array<float,2>{0.650551915f, 0.603113711f},
-std::array<float,2>{0.100219257f, 0.529184043f},
-std::array<float,2>{0.889928281f, 0.187785611f},
-std::array<float,2>{0.379249811f, 0.275816292f},
-std::array<float,2>{0.51221329f, 0.831661642f},
-std::array<float,2>{0.293594867f, 0.975899994f},
-std::array<float,2>{0.716995597f, 0.478211612f},
-std::array<float,2>{0.1562033f, 0.00533615379f},
-std::array<float,2>{0.823111534f, 0.701425433f},
-std::array<float,2>{0.253141314f, 0.717498302f},
-std::array<float,2>{0.74047178f, 0.0244559925f},
-std::array<float,2>{0.169689909f, 0.499464333f},
-std::array<float,2>{0.853354335f, 0.989182651f},
-std::array<float,2>{0.0774178728f, 0.816884577f},
-std::array<float,2>{0.931785345f, 0.263003647f},
-std::array<float,2>{0.435631007f, 0.211713985f},
-std::array<float,2>{0.550862849f, 0.503535807f},
-std::array<float,2>{0.214868605f, 0.616750538f},
-std::array<float,2>{0.811669648f, 0.135825217f},
-std::array<float,2>{0.36918509f, 0.344351083f},
-std::array<float,2>{0.663164556f, 0.754972696f},
-std::array<float,2>{0.48145777f, 0.888833463f},
-std::array<float,2>{0.594047844f, 0.38510105f},
-std::array<float,2>{0.0132128038f, 0.0885261223f},
-std::array<float,2>{0.970772445f, 0.664938867f},
-std::array<float,2>{0.405727834f, 0.533054113f},
-std::array<float,2>{0.523091137f, 0.222872809f},
-std::array<float,2>{0.122453183f, 0.284517676f},
-std::array<float,2>{0.900476635f, 0.859551072f},
-std::array<float,2>{0.138687268f, 0.955397904f},
-std::array<float,2>{0.834752679f, 0.464075655f},
-std::array<float,2>{0.306392908f, 0.0493384786f},
-std::array<float,2>{0.701883852f, 0.745028853f},
-std::array<float,2>{0.0481266752f, 0.650558114f},
-std::array<float,2>{0.964087725f, 0.0962150767f},
-std::array<float,2>{0.445859402f, 0.407801539f},
-std::array<float,2>{0.574323058f, 0.930880189f},
-std::array<float,2>{0.339927733f, 0.783079922f},
-std::array<float,2>{0.638215363f, 0.343338728f},
-std::array<float,2>{0.239295155f, 0.18415229f},
-std::array<float,2>{0.770788014f, 0.578278363f},
-std::array<float,2>{0.303387046f, 0.513796687f},
-std::array<float,2>{0.688308775f, 0.203746527f},
-std::array<float,2>{0.12952888f, 0.257450074f},
-std::array<float,2>{0.841465473f, 0.826051712f},
-std::array<float,2>{0.110056601f, 0.997133672f},
-std::array<float,2>{0.8974123f, 0.488567382f},
-std::array<float,2>{0.396859944f, 0.0178305618f},
-std::array<float,2>{0.529273093f, 0.707905233f},
-std::array<float,2>{0.248259634f, 0.656391442f},
-std::array<float,2>{0.775460303f, 0.0823053867f},
-std::array<float,2>{0.332139105f, 0.377490252f},
-std::array<float,2>{0.625183761f, 0.879843652f},
-std::array<float,2>{0.439292103f, 0.759385645f},
-std::array<float,2>{0.569676936f, 0.359320253f},
-std::array<float,2>{0.0575241297f, 0.132508218f},
-std::array<float,2>{0.957671583f, 0.623257697f},
-std::array<float,2>{0.42352125f, 0.738145232f},
-std::array<float,2>{0.556311011f, 0.0595710762f},
-std::array<float,2>{0.0661690682f, 0.453257293f},
-std::array<float,2>{0.929246426f, 0.967481673f},
-std::array<float,2>{0.158566415f, 0.873098433f},
-std::array<float,2>{0.848945618f, 0.295586735f},
-std::array<float,2>{0.263905346f, 0.228522763f},
-std::array<float,2>{0.748352408f, 0.542499483f},
-std::array<float,2>{0.00572860194f, 0.589765251f},
-std::array<float,2>{0.980533421f, 0.173775703f},
-std::array<float,2>{0.47433871f, 0.334251434f},
-std::array<float,2>{0.602873027f, 0.78926146f},
-std::array<float,2>{0.364586085f, 0.926370978f},
-std::array<float,2>{0.670903504f, 0.418753743f},
-std::array<float,2>{0.204740196f, 0.102404214f},
-std::array<float,2>{0.797031224f, 0.643030047f},
-std::array<float,2>{0.324422002f, 0.625372052f},
-std::array<float,2>{0.645485759f, 0.124881677f},
-std::array<float,2>{0.233935073f, 0.430577457f},
-std::array<float,2>{0.755539954f, 0.910752654f},
-std::array<float,2>{0.0463336334f, 0.803402603f},
-std::array<float,2>{0.949256957f, 0.327485859f},
-std::array<float,2>{0.463283271f, 0.161381811f},
-std::array<float,2>{0.591325343f, 0.572380543f},
-std::array<float,2>{0.141520724f, 0.560209215f},
-std::array<float,2>{0.816797733f, 0.237742335f},
-std::array<float,2>{0.288802743f, 0.301713228f},
-std::array<float,2>{0.707676709f, 0.851762295f},
-std::array<float,2>{0.386188149f, 0.94276619f},
-std::array<float,2>{0.502683401f, 0.44838953f},
-std::array<float,2>{0.104190819f, 0.0391287021f},
-std::array<float,2>{0.877450526f, 0.732465446f},
-std::array<float,2>{0.48495546f, 0.597948134f},
-std::array<float,2>{0.614481807f, 0.147383839f},
-std::array<float,2>{0.0219598636f, 0.371188164f},
-std::array<float,2>{0.99671042f, 0.770521343f},
-std::array<float,2>{0.194753945f, 0.899296939f},
-std::array<float,2>{0.782689631f, 0.397133321f},
-std::array<float,2>{0.349695981f, 0.0777179748f},
-std::array<float,2>{0.685681939f, 0.672218084f},
-std::array<float,2>{0.082246609f, 0.687535524f},
-std::array<float,2>{0.910082042f, 0.0143209333f},
-std::array<float,2>{0.411156058f, 0.475707412f},
-std::array<float,2>{0.534086943f, 0.983413041f},
-std::array<float,2>{0.272968203f, 0.837968886f},
-std::array<float,2>{0.720816195f, 0.268165082f},
-std::array<float,2>{0.184759781f, 0.199469894f},
-std::array<float,2>{0.866881132f, 0.520974159f},
-std::array<float,2>{0.360934228f, 0.524226248f},
-std::array<float,2>{0.665177763f, 0.192337498f},
-std::array<float,2>{0.210173815f, 0.279110581f},
-std::array<float,2>{0.80326736f, 0.834403694f},
-std::array<float,2>{0.000125603343f, 0.969621837f},
-std::array<float,2>{0.979178786f, 0.482238978f},
-std::array<float,2>{0.470427036f, 0.000505595177f},
-std::array<float,2>{0.608410954f, 0.695725799f},
-std::array<float,2>{0.160843745f, 0.682846129f},
-std::array<float,2>{0.844287515f, 0.0684323832f},
-std::array<float,2>{0.260179579f, 0.402033597f},
-std::array<float,2>{0.745598018f, 0.894343495f},
-std::array<float,2>{0.426790655f, 0.77346462f},
-std::array<float,2>{0.560748398f, 0.366220117f},
-std::array<float,2>{0.0677210093f, 0.153972968f},
-std::array<float,2>{0.925038397f, 0.607081473f},
-std::array<float,2>{0.443128884f, 0.722322464f},
-std::array<float,2>{0.56386137f, 0.0329585932f},
-std::array<float,2>{0.0595989004f, 0.438972414f},
-std::array<float,2>{0.956638396f, 0.945798099f},
-std::array<float,2>{0.243183807f, 0.845544338f},
-std::array<float,2>{0.780493498f, 0.311845273f},
-std::array<float,2>{0.331496686f, 0.245874822f},
-std::array<float,2>{0.630527198f, 0.548505366f},
-std::array<float,2>{0.114596635f, 0.569179296f},
-std::array<float,2>{0.893795311f, 0.165647328f},
-std::array<float,2>{0.394322842f, 0.313333362f},
-std::array<float,2>{0.524495482f, 0.810902894f},
-std::array<float,2>{0.300709873f, 0.916362345f},
-std::array<float,2>{0.69515717f, 0.423864722f},
-std::array<float,2>{0.125205725f, 0.114621803f},
-std::array<float,2>{0.837743878f, 0.636166215f},
-std::array<float,2>{0.26648131f, 0.65353781f},
-std::array<float,2>{0.723808706f, 0.0999555364f},
-std::array<float,2>{0.181620315f, 0.413865119f},
-std::array<float,2>{0.861105978f, 0.934580266f},
-std::array<float,2>{0.0806208104f, 0.787955523f},
-std::array<float,2>{0.912452281f, 0.339732051f},
-std::array<float,2>{0.407285959f, 0.182191491f},
-std::array<float,2>{0.537324905f, 0.583639205f},
-std::array<float,2>{0.189231679f, 0.535485923f},
-std::array<float,2>{0.78629446f, 0.222089067f},
-std::array<float,2>{0.346443266f, 0.285449594f},
-std::array<float,2>{0.681942165f, 0.864931285f},
-std::array<float,2>{0.489952445f, 0.959654808f},
-std::array<float,2>{0.611979902f, 0.46504572f},
-std::array<float,2>{0.016496364f, 0.0545044504f},
-std::array<float,2>{0.994018376f, 0.749258399f},
-std::array<float,2>{0.389470845f, 0.612105787f},
-std::array<float,2>{0.505539477f, 0.137591168f},
-std::array<float,2>{0.108185664f, 0.34837839f},
-std::array<float,2>{0.881576538f, 0.751959682f},
-std::array<float,2>{0.145804077f, 0.884316921f},
-std::array<float,2>{0.816169322f, 0.390462577f},
-std::array<float,2>{0.283236712f, 0.0911166221f},
-std::array<float,2>{0.705111384f, 0.668467343f},
-std::array<float,2>{0.0391818881f, 0.711057365f},
-std::array<float,2>{0.946244478f, 0.0300934929f},
-std::array<float,2>{0.467591941f, 0.493196309f},
-std::array<float,2>{0.586890578f, 0.985173225f},
-std::array<float,2>{0.323568285f, 0.816344261f},
-std::array<float,2>{0.642964661f, 0.261284053f},
-std::array<float,2>{0.228616595f, 0.216452256f},
-std::array<float,2>{0.752894938f, 0.505059659f},
-std::array<float,2>{0.289099276f, 0.590800822f},
-std::array<float,2>{0.711923301f, 0.178317338f},
-std::array<float,2>{0.148874789f, 0.329305381f},
-std::array<float,2>{0.825787187f, 0.795096934f},
-std::array<float,2>{0.0967902094f, 0.923373044f},
-std::array<float,2>{0.883718371f, 0.415442765f},
-std::array<float,2>{0.377645314f, 0.106439926f},
-std::array<float,2>{0.511202395f, 0.647444725f},
-std::array<float,2>{0.223366708f, 0.738782167f},
-std::array<float,2>{0.75904578f, 0.0569896847f},
-std::array<float,2>{0.313535601f, 0.458703756f},
-std::array<float,2>{0.654384673f, 0.964088082f},
-std::array<float,2>{0.458584934f, 0.870316446f},
-std::array<float,2>{0.582765043f, 0.291026533f},
-std::array<float,2>{0.0333272144f, 0.233911946f},
-std::array<float,2>{0.938471258f, 0.545681179f},
-std::array<float,2>{0.417062432f, 0.662603855f},
-std::array<float,2>{0.539250076f, 0.0817040652f},
-std::array<float,2>{0.0907042548f, 0.379287601f},
-std::array<float,2>{0.916647613f, 0.875398338f},
-std::array<float,2>{0.175810099f, 0.763391554f},
-std::array<float,2>{0.874469459f, 0.352904201f},
-std::array<float,2>{0.275617331f, 0.125620916f},
-std::array<float,2>{0.730580449f, 0.620776474f},
-std::array<float,2>{0.0254874006f, 0.509861529f},
-std::array<float,2>{0.99022156f, 0.207558542f},
-std::array<float,2>{0.498304784f, 0.251778692f},
-std::array<float,2>{0.623184264f, 0.822850764f},
-std::array<float,2>{0.358171582f, 0.992283821f},
-std::array<float,2>{0.67347157f, 0.484507143f},
-std::array<float,2>{0.195928052f, 0.0214371197f},
-std::array<float,2>{0.791640639f, 0.703581989f},
-std::array<float,2>{0.339201659f, 0.692143023f},
-std::array<float,2>{0.633472681f, 0.0101383813f},
-std::array<float,2>{0.238152489f, 0.472604036f},
-std::array<float,2>{0.768608809f, 0.977685332f},
-std::array<float,2>{0.052604489f, 0.842578888f},
-std::array<float,2>{0.966813684f, 0.270081788f},
-std::array<float,2>{0.449366599f, 0.197033897f},
-std::array<float,2>{0.572941244f, 0.516075015f},
-std::array<float,2>{0.134815991f, 0.595506787f},
-std::array<float,2>{0.831501365f, 0.143457741f},
-std::array<float,2>{0.310409188f, 0.370645195f},
-std::array<float,2>{0.695319653f, 0.767049491f},
-std::array<float,2>{0.398543537f, 0.905444026f},
-std::array<float,2>{0.519052804f, 0.391262412f},
-std::array<float,2>{0.117551669f, 0.0714134797f},
-std::array<float,2>{0.904419541f, 0.67738533f},
-std::array<float,2>{0.477234602f, 0.557057142f},
-std::array<float,2>{0.599265575f, 0.241732538f},
-std::array<float,2>{0.0104624545f, 0.300562054f},
-std::array<float,2>{0.974417627f, 0.857881904f},
-std::array<float,2>{0.212043524f, 0.93856442f},
-std::array<float,2>{0.8081671f, 0.450186908f},
-std::array<float,2>{0.371960014f, 0.0465255976f},
-std::array<float,2>{0.657074392f, 0.727561831f},
-std::array<float,2>{0.0712427348f, 0.631778598f},
-std::array<float,2>{0.933781147f, 0.118975461f},
-std::array<float,2>{0.433276623f, 0.437263846f},
-std::array<float,2>{0.547691405f, 0.906322479f},
-std::array<float,2>{0.254049122f, 0.798463762f},
-std::array<float,2>{0.736693263f, 0.32257697f},
-std::array<float,2>{0.167713389f, 0.157315865f},
-std::array<float,2>{0.857611597f, 0.575593293f},
-std::array<float,2>{0.317562371f, 0.603675246f},
-std::array<float,2>{0.649581015f, 0.149754167f},
-std::array<float,2>{0.222145617f, 0.361390352f},
-std::array<float,2>{0.76544255f, 0.780823112f},
-std::array<float,2>{0.0353000164f, 0.89797461f},
-std::array<float,2>{0.944915533f, 0.404406667f},
-std::array<float,2>{0.45681113f, 0.0654646382f},
-std::array<float,2>{0.578643501f, 0.687048793f},
-std::array<float,2>{0.15337646f, 0.701167345f},
-std::array<float,2>{0.820688725f, 0.00760528585f},
-std::array<float,2>{0.296609044f, 0.479295552f},
-std::array<float,2>{0.715768218f, 0.974164784f},
-std::array<float,2>{0.380936444f, 0.829839349f},
-std::array<float,2>{0.514835596f, 0.275217474f},
-std::array<float,2>{0.0983782411f, 0.190037668f},
-std::array<float,2>{0.887377858f, 0.52965039f},
-std::array<float,2>{0.493453264f, 0.638551533f},
-std::array<float,2>{0.620003045f, 0.113157861f},
-std::array<float,2>{0.029798802f, 0.426614374f},
-std::array<float,2>{0.984959424f, 0.921060324f},
-std::array<float,2>{0.200579554f, 0.806690335f},
-std::array<float,2>{0.793876648f, 0.319436193f},
-std::array<float,2>{0.353518963f, 0.171787038f},
-std::array<float,2>{0.678074181f, 0.565730989f},
-std::array<float,2>{0.0890171453f, 0.554396689f},
-std::array<float,2>{0.919828296f, 0.248177364f},
-std::array<float,2>{0.421535134f, 0.305254459f},
-std::array<float,2>{0.543626189f, 0.849265695f},
-std::array<float,2>{0.279169887f, 0.951100588f},
-std::array<float,2>{0.726964056f, 0.442137808f},
-std::array<float,2>{0.172799408f, 0.0370233245f},
-std::array<float,2>{0.869981527f, 0.723965704f},
-std::array<float,2>{0.307852954f, 0.742650211f},
-std::array<float,2>{0.699955583f, 0.0481145903f},
-std::array<float,2>{0.138668135f, 0.462850869f},
-std::array<float,2>{0.832587063f, 0.9547984f},
-std::array<float,2>{0.123699896f, 0.861436844f},
-std::array<float,2>{0.899102032f, 0.283106089f},
-std::array<float,2>{0.403948903f, 0.225426793f},
-std::array<float,2>{0.520626664f, 0.533658981f},
-std::array<float,2>{0.240617663f, 0.580085635f},
-std::array<float,2>{0.772759438f, 0.186734349f},
-std::array<float,2>{0.343300939f, 0.34046486f},
-std::array<float,2>{0.64058733f, 0.784356177f},
-std::array<float,2>{0.448658913f, 0.931731522f},
-std::array<float,2>{0.577643514f, 0.410012066f},
-std::array<float,2>{0.0496967323f, 0.0950354934f},
-std::array<float,2>{0.961506128f, 0.649234056f},
-std::array<float,2>{0.435287654f, 0.500127852f},
-std::array<float,2>{0.552951455f, 0.213751778f},
-std::array<float,2>{0.0760265514f, 0.265496045f},
-std::array<float,2>{0.931255162f, 0.819152534f},
-std::array<float,2>{0.170286238f, 0.991030395f},
-std::array<float,2>{0.853606343f, 0.498007506f},
-std::array<float,2>{0.251616716f, 0.0260552242f},
-std::array<float,2>{0.739891231f, 0.715744972f},
-std::array<float,2>{0.0149731562f, 0.666157424f},
-std::array<float,2>{0.969913721f, 0.0864587799f},
-std::array<float,2>{0.484126151f, 0.384682983f},
-std::array<float,2>{0.597616076f, 0.88707906f},
-std::array<float,2>{0.368222356f, 0.756100416f},
-std::array<float,2>{0.661434531f, 0.3474361f},
-std::array<float,2>{0.218679324f, 0.133059978f},
-std::array<float,2>{0.808836877f, 0.614704192f},
-std::array<float,2>{0.262112916f, 0.540291607f},
-std::array<float,2>{0.746789992f, 0.226816297f},
-std::array<float,2>{0.157919198f, 0.294458807f},
-std::array<float,2>{0.849746525f, 0.871427119f},
-std::array<float,2>{0.062661767f, 0.965952754f},
-std::array<float,2>{0.926625848f, 0.456847191f},
-std::array<float,2>{0.425207108f, 0.0615321547f},
-std::array<float,2>{0.558289289f, 0.734854221f},
-std::array<float,2>{0.205360666f, 0.640751958f},
-std::array<float,2>{0.799785554f, 0.105456255f},
-std::array<float,2>{0.366409898f, 0.421852231f},
-std::array<float,2>{0.668152809f, 0.928891301f},
-std::array<float,2>{0.475980908f, 0.792565823f},
-std::array<float,2>{0.604025543f, 0.332880825f},
-std::array<float,2>{0.00671585882f, 0.173993394f},
-std::array<float,2>{0.983984172f, 0.587809622f},
-std::array<float,2>{0.396200478f, 0.710854292f},
-std::array<float,2>{0.530488908f, 0.0172392577f},
-std::array<float,2>{0.112840526f, 0.491578877f},
-std::array<float,2>{0.894703805f, 0.999863863f},
-std::array<float,2>{0.132691815f, 0.826450944f},
-std::array<float,2>{0.841801405f, 0.25509578f},
-std::array<float,2>{0.301106036f, 0.206439331f},
-std::array<float,2>{0.691305518f, 0.512014091f},
-std::array<float,2>{0.0560808666f, 0.62203306f},
-std::array<float,2>{0.96047914f, 0.130786657f},
-std::array<float,2>{0.440093517f, 0.356239438f},
-std::array<float,2>{0.568089604f, 0.759968817f},
-std::array<float,2>{0.335616291f, 0.88179493f},
-std::array<float,2>{0.628585637f, 0.375198692f},
-std::array<float,2>{0.247626588f, 0.0855031759f},
-std::array<float,2>{0.773450077f, 0.659406424f},
-std::array<float,2>{0.34812218f, 0.674996614f},
-std::array<float,2>{0.684998333f, 0.0744284764f},
-std::array<float,2>{0.192320168f, 0.39498961f},
-std::array<float,2>{0.784324288f, 0.901156962f},
-std::array<float,2>{0.0200986359f, 0.773019791f},
-std::array<float,2>{0.998812258f, 0.373964816f},
-std::array<float,2>{0.487118214f, 0.14606522f},
-std::array<float,2>{0.615688264f, 0.601546168f},
-std::array<float,2>{0.186771259f, 0.522195518f},
-std::array<float,2>{0.863496125f, 0.201239228f},
-std::array<float,2>{0.269603759f, 0.265825123f},
-std::array<float,2>{0.719120562f, 0.836958289f},
-std::array<float,2>{0.412494421f, 0.980614424f},
-std::array<float,2>{0.532212436f, 0.473963052f},
-std::array<float,2>{0.0843239576f, 0.0130071975f},
-std::array<float,2>{0.906820059f, 0.69078958f},
-std::array<float,2>{0.461693764f, 0.572099864f},
-std::array<float,2>{0.592934787f, 0.16383487f},
-std::array<float,2>{0.044032421f, 0.324524492f},
-std::array<float,2>{0.951877832f, 0.801447511f},
-std::array<float,2>{0.230731562f, 0.913310766f},
-std::array<float,2>{0.75603199f, 0.432970136f},
-std::array<float,2>{0.327129513f, 0.122476026f},
-std::array<float,2>{0.647753596f, 0.626954257f},
-std::array<float,2>{0.101635247f, 0.731515706f},
-std::array<float,2>{0.876898706f, 0.04153708f},
-std::array<float,2>{0.38288492f, 0.447191626f},
-std::array<float,2>{0.501259506f, 0.944601774f},
-std::array<float,2>{0.286860853f, 0.854952395f},
-std::array<float,2>{0.709042728f, 0.304461211f},
-std::array<float,2>{0.144338608f, 0.235693187f},
-std::array<float,2>{0.818568468f, 0.561781347f},
-std::array<float,2>{0.336543739f, 0.516485274f},
-std::array<float,2>{0.635492444f, 0.196622193f},
-std::array<float,2>{0.234600469f, 0.269938171f},
-std::array<float,2>{0.765808344f, 0.842147946f},
-std::array<float,2>{0.0542348363f, 0.978398263f},
-std::array<float,2>{0.965394318f, 0.472034454f},
-std::array<float,2>{0.452437013f, 0.010482504f},
-std::array<float,2>{0.57043761f, 0.691670239f},
-std::array<float,2>{0.134708226f, 0.67689389f},
-std::array<float,2>{0.829773009f, 0.0720601231f},
-std::array<float,2>{0.310928196f, 0.390830278f},
-std::array<float,2>{0.697879553f, 0.90601927f},
-std::array<float,2>{0.40228945f, 0.767371297f},
-std::array<float,2>{0.516196549f, 0.370475441f},
-std::array<float,2>{0.120301522f, 0.142756209f},
-std::array<float,2>{0.904071391f, 0.594999135f},
-std::array<float,2>{0.479284316f, 0.728401065f},
-std::array<float,2>{0.601470232f, 0.046384424f},
-std::array<float,2>{0.008577439f, 0.449550241f},
-std::array<float,2>{0.975950897f, 0.939184248f},
-std::array<float,2>{0.213557482f, 0.857923687f},
-std::array<float,2>{0.805238545f, 0.300143182f},
-std::array<float,2>{0.373836607f, 0.241347492f},
-std::array<float,2>{0.659597814f, 0.557407439f},
-std::array<float,2>{0.0730982721f, 0.575796306f},
-std::array<float,2>{0.935785711f, 0.157967493f},
-std::array<float,2>{0.429878891f, 0.323182672f},
-std::array<float,2>{0.549943924f, 0.798239529f},
-std::array<float,2>{0.256315291f, 0.906848609f},
-std::array<float,2>{0.735309124f, 0.436811715f},
-std::array<float,2>{0.164116755f, 0.118366696f},
-std::array<float,2>{0.856535256f, 0.630872071f},
-std::array<float,2>{0.292797297f, 0.646583438f},
-std::array<float,2>{0.714471161f, 0.105674423f},
-std::array<float,2>{0.151845083f, 0.415955931f},
-std::array<float,2>{0.827897608f, 0.923266649f},
-std::array<float,2>{0.0940606222f, 0.795797765f},
-std::array<float,2>{0.88535589f, 0.329802275f},
-std::array<float,2>{0.37622866f, 0.17782855f},
-std::array<float,2>{0.508071005f, 0.589964271f},
-std::array<float,2>{0.226106927f, 0.545032859f},
-std::array<float,2>{0.761542082f, 0.233472571f},
-std::array<float,2>{0.315411627f, 0.291858226f},
-std::array<float,2>{0.654293954f, 0.870607197f},
-std::array<float,2>{0.459838957f, 0.964609921f},
-std::array<float,2>{0.585105777f, 0.458238363f},
-std::array<float,2>{0.0323147476f, 0.057566449f},
-std::array<float,2>{0.941375971f, 0.738528371f},
-std::array<float,2>{0.41581738f, 0.620397508f},
-std::array<float,2>{0.542519748f, 0.125055313f},
-std::array<float,2>{0.0920084417f, 0.353489488f},
-std::array<float,2>{0.915642321f, 0.762904048f},
-std::array<float,2>{0.177896529f, 0.875801444f},
-std::array<float,2>{0.872027576f, 0.379817396f},
-std::array<float,2>{0.274008363f, 0.0812403858f},
-std::array<float,2>{0.732846916f, 0.662178814f},
-std::array<float,2>{0.0239884797f, 0.703974903f},
-std::array<float,2>{0.991634548f, 0.0208087005f},
-std::array<float,2>{0.497293413f, 0.485037029f},
-std::array<float,2>{0.62152791f, 0.992955148f},
-std::array<float,2>{0.355864942f, 0.822508991f},
-std::array<float,2>{0.673868597f, 0.251407713f},
-std::array<float,2>{0.198392138f, 0.207201302f},
-std::array<float,2>{0.789678156f, 0.510662258f},
-std::array<float,2>{0.268007606f, 0.583456814f},
-std::array<float,2>{0.725025237f, 0.182035848f},
-std::array<float,2>{0.182683945f, 0.338977486f},
-std::array<float,2>{0.862914503f, 0.787589848f},
-std::array<float,2>{0.0790984184f, 0.935316086f},
-std::array<float,2>{0.911611438f, 0.413384765f},
-std::array<float,2>{0.409498543f, 0.100256234f},
-std::array<float,2>{0.535244823f, 0.654043019f},
-std::array<float,2>{0.189517006f, 0.749994636f},
-std::array<float,2>{0.787350774f, 0.0541622192f},
-std::array<float,2>{0.344205856f, 0.46538344f},
-std::array<float,2>{0.680335641f, 0.95930171f},
-std::array<float,2>{0.491314173f, 0.864734828f},
-std::array<float,2>{0.610622585f, 0.285792589f},
-std::array<float,2>{0.0180952679f, 0.22234273f},
-std::array<float,2>{0.995143354f, 0.535758197f},
-std::array<float,2>{0.38788563f, 0.668131649f},
-std::array<float,2>{0.506439507f, 0.0913223401f},
-std::array<float,2>{0.106696501f, 0.389684141f},
-std::array<float,2>{0.880604267f, 0.884064674f},
-std::array<float,2>{0.146788627f, 0.752909124f},
-std::array<float,2>{0.812967598f, 0.348010778f},
-std::array<float,2>{0.282697231f, 0.137081087f},
-std::array<float,2>{0.704959512f, 0.611383557f},
-std::array<float,2>{0.042437017f, 0.505455852f},
-std::array<float,2>{0.948479533f, 0.215936422f},
-std::array<float,2>{0.465743184f, 0.260920405f},
-std::array<float,2>{0.588900447f, 0.815516829f},
-std::array<float,2>{0.320986688f, 0.9845348f},
-std::array<float,2>{0.641863406f, 0.494017333f},
-std::array<float,2>{0.226942211f, 0.0293240361f},
-std::array<float,2>{0.750235438f, 0.711545646f},
-std::array<float,2>{0.362432212f, 0.695982635f},
-std::array<float,2>{0.667887628f, 0.00023568391f},
-std::array<float,2>{0.20757851f, 0.481825501f},
-std::array<float,2>{0.801504135f, 0.969002366f},
-std::array<float,2>{0.00258590537f, 0.834872007f},
-std::array<float,2>{0.978140593f, 0.278727621f},
-std::array<float,2>{0.472382158f, 0.191828266f},
-std::array<float,2>{0.607217073f, 0.523497224f},
-std::array<float,2>{0.163237467f, 0.606836319f},
-std::array<float,2>{0.847195148f, 0.153516114f},
-std::array<float,2>{0.258465171f, 0.366883099f},
-std::array<float,2>{0.743065f, 0.773990452f},
-std::array<float,2>{0.429230809f, 0.894012988f},
-std::array<float,2>{0.559931636f, 0.401599526f},
-std::array<float,2>{0.0702529997f, 0.0689054206f},
-std::array<float,2>{0.923289001f, 0.683445454f},
-std::array<float,2>{0.443628937f, 0.548227727f},
-std::array<float,2>{0.56512183f, 0.245206013f},
-std::array<float,2>{0.0609268732f, 0.312128842f},
-std::array<float,2>{0.954822481f, 0.844742f},
-std::array<float,2>{0.244540572f, 0.946023703f},
-std::array<float,2>{0.778924942f, 0.438540876f},
-std::array<float,2>{0.329286844f, 0.0327043571f},
-std::array<float,2>{0.631479919f, 0.721780479f},
-std::array<float,2>{0.116164006f, 0.636326432f},
-std::array<float,2>{0.892462432f, 0.11505568f},
-std::array<float,2>{0.391485363f, 0.424648464f},
-std::array<float,2>{0.525822997f, 0.916652262f},
-std::array<float,2>{0.298655927f, 0.811195374f},
-std::array<float,2>{0.69218415f, 0.312974304f},
-std::array<float,2>{0.128057316f, 0.165216386f},
-std::array<float,2>{0.838877618f, 0.5684461f},
-std::array<float,2>{0.350295395f, 0.600666285f},
-std::array<float,2>{0.68622452f, 0.145679966f},
-std::array<float,2>{0.195284069f, 0.373316467f},
-std::array<float,2>{0.783081532f, 0.772595048f},
-std::array<float,2>{0.0220374092f, 0.900804818f},
-std::array<float,2>{0.996343195f, 0.39512071f},
-std::array<float,2>{0.484677464f, 0.0749722347f},
-std::array<float,2>{0.615178406f, 0.675703049f},
-std::array<float,2>{0.185231417f, 0.691229641f},
-std::array<float,2>{0.866571248f, 0.0134093435f},
-std::array<float,2>{0.27255553f, 0.474245548f},
-std::array<float,2>{0.721660852f, 0.981128097f},
-std::array<float,2>{0.411637992f, 0.837838411f},
-std::array<float,2>{0.533244312f, 0.266423792f},
-std::array<float,2>{0.0828653052f, 0.201989084f},
-std::array<float,2>{0.9094823f, 0.521879375f},
-std::array<float,2>{0.463671386f, 0.62769258f},
-std::array<float,2>{0.591012061f, 0.122568786f},
-std::array<float,2>{0.0468097553f, 0.433236241f},
-std::array<float,2>{0.950086951f, 0.914054334f},
-std::array<float,2>{0.233886227f, 0.800953507f},
-std::array<float,2>{0.755088568f, 0.324988455f},
-std::array<float,2>{0.325165033f, 0.163403243f},
-std::array<float,2>{0.644618452f, 0.57169646f},
-std::array<float,2>{0.103886962f, 0.562351882f},
-std::array<float,2>{0.877217531f, 0.236010268f},
-std::array<float,2>{0.386567324f, 0.303938776f},
-std::array<float,2>{0.501980186f, 0.855420887f},
-std::array<float,2>{0.288268596f, 0.944904089f},
-std::array<float,2>{0.707102478f, 0.446455538f},
-std::array<float,2>{0.140750736f, 0.0411322638f},
-std::array<float,2>{0.817366123f, 0.732335329f},
-std::array<float,2>{0.264201462f, 0.735227227f},
-std::array<float,2>{0.749006033f, 0.0623664521f},
-std::array<float,2>{0.158871099f, 0.456109315f},
-std::array<float,2>{0.849356174f, 0.96639359f},
-std::array<float,2>{0.0656279624f, 0.871875346f},
-std::array<float,2>{0.928729475f, 0.294425339f},
-std::array<float,2>{0.423109323f, 0.22737588f},
-std::array<float,2>{0.556022167f, 0.540541768f},
-std::array<float,2>{0.204525575f, 0.587065578f},
-std::array<float,2>{0.797706902f, 0.174591139f},
-std::array<float,2>{0.365094423f, 0.332507432f},
-std::array<float,2>{0.671623945f, 0.792289376f},
-std::array<float,2>{0.473998934f, 0.929523408f},
-std::array<float,2>{0.603231072f, 0.421200484f},
-std::array<float,2>{0.00511434069f, 0.104655154f},
-std::array<float,2>{0.98106575f, 0.641519308f},
-std::array<float,2>{0.397164345f, 0.512423396f},
-std::array<float,2>{0.528634965f, 0.206714556f},
-std::array<float,2>{0.109809227f, 0.255775094f},
-std::array<float,2>{0.896801412f, 0.826923788f},
-std::array<float,2>{0.129124969f, 0.999388695f},
-std::array<float,2>{0.841039002f, 0.491855055f},
-std::array<float,2>{0.302998632f, 0.016939532f},
-std::array<float,2>{0.687596977f, 0.710387349f},
-std::array<float,2>{0.0569889806f, 0.660115719f},
-std::array<float,2>{0.957363963f, 0.0849786997f},
-std::array<float,2>{0.438657314f, 0.375933111f},
-std::array<float,2>{0.570255101f, 0.881136537f},
-std::array<float,2>{0.332906336f, 0.760342538f},
-std::array<float,2>{0.625505686f, 0.355554074f},
-std::array<float,2>{0.24887754f, 0.129893467f},
-std::array<float,2>{0.776333511f, 0.621236086f},
-std::array<float,2>{0.305882752f, 0.534099698f},
-std::array<float,2>{0.701525033f, 0.224748686f},
-std::array<float,2>{0.13961786f, 0.282536149f},
-std::array<float,2>{0.834454656f, 0.86228317f},
-std::array<float,2>{0.123033293f, 0.954456151f},
-std::array<float,2>{0.900977254f, 0.46220088f},
-std::array<float,2>{0.405822515f, 0.048649665f},
-std::array<float,2>{0.522893965f, 0.742897093f},
-std::array<float,2>{0.239998505f, 0.648873568f},
-std::array<float,2>{0.771056414f, 0.0953200236f},
-std::array<float,2>{0.340475351f, 0.409547508f},
-std::array<float,2>{0.637901068f, 0.93236053f},
-std::array<float,2>{0.445661157f, 0.785131097f},
-std::array<float,2>{0.575012922f, 0.340026826f},
-std::array<float,2>{0.0484475233f, 0.187156573f},
-std::array<float,2>{0.964490354f, 0.580979586f},
-std::array<float,2>{0.436294556f, 0.715135992f},
-std::array<float,2>{0.551594794f, 0.0254312474f},
-std::array<float,2>{0.0780571029f, 0.497142464f},
-std::array<float,2>{0.932427645f, 0.99045372f},
-std::array<float,2>{0.169384792f, 0.818698525f},
-std::array<float,2>{0.852974296f, 0.264731288f},
-std::array<float,2>{0.253585696f, 0.213267103f},
-std::array<float,2>{0.740790963f, 0.500613332f},
-std::array<float,2>{0.01303994f, 0.614768147f},
-std::array<float,2>{0.971489787f, 0.13375333f},
-std::array<float,2>{0.4820427f, 0.347074568f},
-std::array<float,2>{0.594444275f, 0.756550252f},
-std::array<float,2>{0.370064616f, 0.887639821f},
-std::array<float,2>{0.66393733f, 0.384027123f},
-std::array<float,2>{0.215394929f, 0.0863081962f},
-std::array<float,2>{0.812093914f, 0.666887224f},
-std::array<float,2>{0.319864929f, 0.686942339f},
-std::array<float,2>{0.650986075f, 0.0662850514f},
-std::array<float,2>{0.219294667f, 0.405256599f},
-std::array<float,2>{0.761953235f, 0.89784807f},
-std::array<float,2>{0.037721511f, 0.780708134f},
-std::array<float,2>{0.942818642f, 0.362037361f},
-std::array<float,2>{0.454304546f, 0.150354534f},
-std::array<float,2>{0.580152392f, 0.604135036f},
-std::array<float,2>{0.155578658f, 0.52988863f},
-std::array<float,2>{0.822389066f, 0.189603224f},
-std::array<float,2>{0.292990327f, 0.274463326f},
-std::array<float,2>{0.717615604f, 0.829531789f},
-std::array<float,2>{0.379667431f, 0.973849654f},
-std::array<float,2>{0.511731148f, 0.478974879f},
-std::array<float,2>{0.100022331f, 0.00710791256f},
-std::array<float,2>{0.890268207f, 0.700423241f},
-std::array<float,2>{0.494689703f, 0.566402972f},
-std::array<float,2>{0.618829787f, 0.17113544f},
-std::array<float,2>{0.0287299678f, 0.320019692f},
-std::array<float,2>{0.986503661f, 0.807348967f},
-std::array<float,2>{0.201648518f, 0.921628058f},
-std::array<float,2>{0.795706153f, 0.426110059f},
-std::array<float,2>{0.351872832f, 0.112601943f},
-std::array<float,2>{0.675995409f, 0.637819231f},
-std::array<float,2>{0.0877251253f, 0.72426331f},
-std::array<float,2>{0.9208619f, 0.0364395939f},
-std::array<float,2>{0.419876754f, 0.441610754f},
-std::array<float,2>{0.545754194f, 0.950594187f},
-std::array<float,2>{0.280304343f, 0.848861694f},
-std::array<float,2>{0.730160534f, 0.304825544f},
-std::array<float,2>{0.17449905f, 0.248873189f},
-std::array<float,2>{0.86792171f, 0.553907812f},
-std::array<float,2>{0.371166974f, 0.555325806f},
-std::array<float,2>{0.656338453f, 0.239389583f},
-std::array<float,2>{0.212681711f, 0.298069745f},
-std::array<float,2>{0.808016002f, 0.856789887f},
-std::array<float,2>{0.0100408746f, 0.939623296f},
-std::array<float,2>{0.974059999f, 0.452823877f},
-std::array<float,2>{0.476933181f, 0.0442820862f},
-std::array<float,2>{0.599056602f, 0.729793847f},
-std::array<float,2>{0.16747877f, 0.63085252f},
-std::array<float,2>{0.858197927f, 0.120191798f},
-std::array<float,2>{0.254752159f, 0.435146987f},
-std::array<float,2>{0.737170398f, 0.909899414f},
-std::array<float,2>{0.432623386f, 0.798853755f},
-std::array<float,2>{0.547102034f, 0.320588201f},
-std::array<float,2>{0.0703569576f, 0.158505917f},
-std::array<float,2>{0.934518158f, 0.576830924f},
-std::array<float,2>{0.449833333f, 0.694138587f},
-std::array<float,2>{0.57226944f, 0.00920942053f},
-std::array<float,2>{0.0519326888f, 0.470638931f},
-std::array<float,2>{0.967620254f, 0.978943825f},
-std::array<float,2>{0.237331212f, 0.840905368f},
-std::array<float,2>{0.769325256f, 0.272022665f},
-std::array<float,2>{0.339722931f, 0.198335797f},
-std::array<float,2>{0.633185208f, 0.518410921f},
-std::array<float,2>{0.118103608f, 0.597213507f},
-std::array<float,2>{0.904938221f, 0.140727058f},
-std::array<float,2>{0.399219811f, 0.369043827f},
-std::array<float,2>{0.518576801f, 0.769064248f},
-std::array<float,2>{0.309825748f, 0.903615832f},
-std::array<float,2>{0.696273863f, 0.392987549f},
-std::array<float,2>{0.13572593f, 0.0728626996f},
-std::array<float,2>{0.831985414f, 0.678398967f},
-std::array<float,2>{0.275987744f, 0.660156369f},
-std::array<float,2>{0.731419683f, 0.0799679011f},
-std::array<float,2>{0.176353917f, 0.381230295f},
-std::array<float,2>{0.874940157f, 0.878595233f},
-std::array<float,2>{0.0899025574f, 0.765480518f},
-std::array<float,2>{0.916475058f, 0.353633016f},
-std::array<float,2>{0.417524695f, 0.126967371f},
-std::array<float,2>{0.539832592f, 0.61753422f},
-std::array<float,2>{0.195634142f, 0.507961571f},
-std::array<float,2>{0.791428745f, 0.209808141f},
-std::array<float,2>{0.357655883f, 0.253473938f},
-std::array<float,2>{0.672873378f, 0.822061121f},
-std::array<float,2>{0.498673141f, 0.994314373f},
-std::array<float,2>{0.623877525f, 0.486927569f},
-std::array<float,2>{0.0258816611f, 0.0216101054f},
-std::array<float,2>{0.989519238f, 0.705651879f},
-std::array<float,2>{0.377195418f, 0.59180361f},
-std::array<float,2>{0.511509538f, 0.177618638f},
-std::array<float,2>{0.0974050239f, 0.331465006f},
-std::array<float,2>{0.883013129f, 0.793724477f},
-std::array<float,2>{0.149021491f, 0.924359381f},
-std::array<float,2>{0.825300574f, 0.416165173f},
-std::array<float,2>{0.289887637f, 0.107552551f},
-std::array<float,2>{0.712438405f, 0.645752192f},
-std::array<float,2>{0.0341660827f, 0.740995347f},
-std::array<float,2>{0.937956095f, 0.0547102205f},
-std::array<float,2>{0.458246261f, 0.459911406f},
-std::array<float,2>{0.582096696f, 0.961224198f},
-std::array<float,2>{0.31445244f, 0.867622375f},
-std::array<float,2>{0.655114651f, 0.290613145f},
-std::array<float,2>{0.223065883f, 0.231350094f},
-std::array<float,2>{0.75939858f, 0.543322802f},
-std::array<float,2>{0.283819318f, 0.609755516f},
-std::array<float,2>{0.70605433f, 0.139098525f},
-std::array<float,2>{0.146120414f, 0.35155338f},
-std::array<float,2>{0.815546215f, 0.750665367f},
-std::array<float,2>{0.107459351f, 0.885134459f},
-std::array<float,2>{0.881225705f, 0.388406962f},
-std::array<float,2>{0.389114708f, 0.0922023132f},
-std::array<float,2>{0.5048967f, 0.671645224f},
-std::array<float,2>{0.229472429f, 0.713557661f},
-std::array<float,2>{0.752171278f, 0.0290807579f},
-std::array<float,2>{0.323839277f, 0.494410962f},
-std::array<float,2>{0.643531799f, 0.986758471f},
-std::array<float,2>{0.466992497f, 0.814154983f},
-std::array<float,2>{0.586068273f, 0.259548128f},
-std::array<float,2>{0.0396560617f, 0.217755511f},
-std::array<float,2>{0.945329785f, 0.505866945f},
-std::array<float,2>{0.408021897f, 0.654922843f},
-std::array<float,2>{0.537640691f, 0.0989616141f},
-std::array<float,2>{0.0805210918f, 0.411660701f},
-std::array<float,2>{0.912793398f, 0.936187923f},
-std::array<float,2>{0.18093136f, 0.785921514f},
-std::array<float,2>{0.860607207f, 0.336737692f},
-std::array<float,2>{0.26583299f, 0.181278691f},
-std::array<float,2>{0.724323273f, 0.584550142f},
-std::array<float,2>{0.0159627218f, 0.538378179f},
-std::array<float,2>{0.993625045f, 0.220268279f},
-std::array<float,2>{0.489575565f, 0.287647396f},
-std::array<float,2>{0.611401618f, 0.865334928f},
-std::array<float,2>{0.345863849f, 0.95861727f},
-std::array<float,2>{0.682268023f, 0.468419403f},
-std::array<float,2>{0.188508824f, 0.0513657108f},
-std::array<float,2>{0.786744535f, 0.746179938f},
-std::array<float,2>{0.331991196f, 0.720507443f},
-std::array<float,2>{0.629982471f, 0.0343294032f},
-std::array<float,2>{0.243842557f, 0.441005468f},
-std::array<float,2>{0.780996382f, 0.947640479f},
-std::array<float,2>{0.0604148731f, 0.846951842f},
-std::array<float,2>{0.956169069f, 0.308874786f},
-std::array<float,2>{0.442645609f, 0.243035242f},
-std::array<float,2>{0.56425035f, 0.548854291f},
-std::array<float,2>{0.125525594f, 0.56674993f},
-std::array<float,2>{0.83713913f, 0.166795596f},
-std::array<float,2>{0.299982876f, 0.314670652f},
-std::array<float,2>{0.694694459f, 0.808829069f},
-std::array<float,2>{0.393578827f, 0.914997995f},
-std::array<float,2>{0.525042057f, 0.42364347f},
-std::array<float,2>{0.114823423f, 0.117042564f},
-std::array<float,2>{0.894068837f, 0.633499384f},
-std::array<float,2>{0.470113456f, 0.525553644f},
-std::array<float,2>{0.608977795f, 0.193443641f},
-std::array<float,2>{0.000739372103f, 0.279496461f},
-std::array<float,2>{0.978631079f, 0.832558692f},
-std::array<float,2>{0.210629076f, 0.971055388f},
-std::array<float,2>{0.802773237f, 0.483778685f},
-std::array<float,2>{0.360413253f, 0.00298539829f},
-std::array<float,2>{0.665885329f, 0.698510945f},
-std::array<float,2>{0.0679634288f, 0.681420207f},
-std::array<float,2>{0.925304115f, 0.0675262436f},
-std::array<float,2>{0.427269489f, 0.398877621f},
-std::array<float,2>{0.561456203f, 0.891168833f},
-std::array<float,2>{0.260673344f, 0.775833845f},
-std::array<float,2>{0.745672584f, 0.364350587f},
-std::array<float,2>{0.160306752f, 0.155665055f},
-std::array<float,2>{0.843964458f, 0.608007133f},
-std::array<float,2>{0.326591879f, 0.572966099f},
-std::array<float,2>{0.648032606f, 0.16168195f},
-std::array<float,2>{0.231149122f, 0.327855796f},
-std::array<float,2>{0.75656414f, 0.802850544f},
-std::array<float,2>{0.0444401316f, 0.91061157f},
-std::array<float,2>{0.951311946f, 0.429825574f},
-std::array<float,2>{0.460938483f, 0.124393769f},
-std::array<float,2>{0.5934214f, 0.625905037f},
-std::array<float,2>{0.143927619f, 0.73291111f},
-std::array<float,2>{0.818914473f, 0.0398260579f},
-std::array<float,2>{0.286316305f, 0.448866665f},
-std::array<float,2>{0.709629834f, 0.943306565f},
-std::array<float,2>{0.383776039f, 0.85214889f},
-std::array<float,2>{0.501522183f, 0.300975859f},
-std::array<float,2>{0.10228429f, 0.23825179f},
-std::array<float,2>{0.876421213f, 0.559686959f},
-std::array<float,2>{0.486758143f, 0.672451735f},
-std::array<float,2>{0.615791738f, 0.0773118287f},
-std::array<float,2>{0.0197270438f, 0.396909058f},
-std::array<float,2>{0.998494804f, 0.898651779f},
-std::array<float,2>{0.191575229f, 0.771092951f},
-std::array<float,2>{0.78468436f, 0.371718287f},
-std::array<float,2>{0.348603308f, 0.146895438f},
-std::array<float,2>{0.685499787f, 0.59841305f},
-std::array<float,2>{0.0847229958f, 0.521230757f},
-std::array<float,2>{0.906726897f, 0.199811503f},
-std::array<float,2>{0.413005531f, 0.267618567f},
-std::array<float,2>{0.53161186f, 0.838581026f},
-std::array<float,2>{0.27038458f, 0.983923256f},
-std::array<float,2>{0.719544411f, 0.47638455f},
-std::array<float,2>{0.187332913f, 0.0137258898f},
-std::array<float,2>{0.863809168f, 0.68829757f},
-std::array<float,2>{0.301587075f, 0.707277715f},
-std::array<float,2>{0.690768242f, 0.0184739251f},
-std::array<float,2>{0.131905183f, 0.488989919f},
-std::array<float,2>{0.842327058f, 0.997775733f},
-std::array<float,2>{0.112375662f, 0.825644672f},
-std::array<float,2>{0.895264268f, 0.256949216f},
-std::array<float,2>{0.395528138f, 0.203390315f},
-std::array<float,2>{0.530891299f, 0.514481664f},
-std::array<float,2>{0.247532263f, 0.623648286f},
-std::array<float,2>{0.774009585f, 0.131933376f},
-std::array<float,2>{0.335023552f, 0.358507842f},
-std::array<float,2>{0.6280213f, 0.758936644f},
-std::array<float,2>{0.439613909f, 0.879185379f},
-std::array<float,2>{0.56758523f, 0.376953453f},
-std::array<float,2>{0.0565787517f, 0.0825677738f},
-std::array<float,2>{0.960407257f, 0.656855583f},
-std::array<float,2>{0.425484359f, 0.542440593f},
-std::array<float,2>{0.557882547f, 0.229116768f},
-std::array<float,2>{0.0631156638f, 0.295362502f},
-std::array<float,2>{0.926057816f, 0.873666227f},
-std::array<float,2>{0.157318681f, 0.966971993f},
-std::array<float,2>{0.850440979f, 0.454042614f},
-std::array<float,2>{0.262303591f, 0.0601627305f},
-std::array<float,2>{0.746400416f, 0.737651408f},
-std::array<float,2>{0.00599536905f, 0.643221915f},
-std::array<float,2>{0.983688354f, 0.101742461f},
-std::array<float,2>{0.476393014f, 0.418213099f},
-std::array<float,2>{0.603690088f, 0.926103771f},
-std::array<float,2>{0.366838992f, 0.789982378f},
-std::array<float,2>{0.668599606f, 0.334714562f},
-std::array<float,2>{0.205644444f, 0.173262671f},
-std::array<float,2>{0.798874795f, 0.588988781f},
-std::array<float,2>{0.251208901f, 0.503165364f},
-std::array<float,2>{0.739507377f, 0.211237624f},
-std::array<float,2>{0.17064023f, 0.263223469f},
-std::array<float,2>{0.854430497f, 0.81720686f},
-std::array<float,2>{0.0756619796f, 0.988439023f},
-std::array<float,2>{0.930797994f, 0.499691725f},
-std::array<float,2>{0.434711844f, 0.0252874363f},
-std::array<float,2>{0.553271055f, 0.717243791f},
-std::array<float,2>{0.218220577f, 0.664310932f},
-std::array<float,2>{0.80913192f, 0.0881519169f},
-std::array<float,2>{0.369064897f, 0.385665536f},
-std::array<float,2>{0.661844552f, 0.889218628f},
-std::array<float,2>{0.483609825f, 0.755665243f},
-std::array<float,2>{0.597128153f, 0.344045281f},
-std::array<float,2>{0.0155743835f, 0.136369482f},
-std::array<float,2>{0.97037977f, 0.616229832f},
-std::array<float,2>{0.403330654f, 0.74423027f},
-std::array<float,2>{0.521357059f, 0.0493138805f},
-std::array<float,2>{0.123295456f, 0.464499086f},
-std::array<float,2>{0.898458958f, 0.955670416f},
-std::array<float,2>{0.137751251f, 0.860052705f},
-std::array<float,2>{0.832382321f, 0.285123378f},
-std::array<float,2>{0.30843094f, 0.223559156f},
-std::array<float,2>{0.699696362f, 0.532331944f},
-std::array<float,2>{0.0491846763f, 0.578928649f},
-std::array<float,2>{0.961000025f, 0.184006602f},
-std::array<float,2>{0.449074775f, 0.343153536f},
-std::array<float,2>{0.577383637f, 0.782306194f},
-std::array<float,2>{0.34322837f, 0.931464434f},
-std::array<float,2>{0.639885843f, 0.407603264f},
-std::array<float,2>{0.241080359f, 0.0961354375f},
-std::array<float,2>{0.773396373f, 0.650913835f},
-std::array<float,2>{0.35436973f, 0.640141785f},
-std::array<float,2>{0.67862606f, 0.110179551f},
-std::array<float,2>{0.201112702f, 0.428054452f},
-std::array<float,2>{0.793066323f, 0.919324875f},
-std::array<float,2>{0.0295480695f, 0.806190968f},
-std::array<float,2>{0.984618902f, 0.317494065f},
-std::array<float,2>{0.4937208f, 0.169513732f},
-std::array<float,2>{0.619345427f, 0.563401878f},
-std::array<float,2>{0.172022432f, 0.551789939f},
-std::array<float,2>{0.869473636f, 0.246269494f},
-std::array<float,2>{0.278769255f, 0.307397425f},
-std::array<float,2>{0.727130353f, 0.850348532f},
-std::array<float,2>{0.421120524f, 0.953007519f},
-std::array<float,2>{0.543388784f, 0.443949044f},
-std::array<float,2>{0.0898358747f, 0.0375074111f},
-std::array<float,2>{0.919202924f, 0.726522088f},
-std::array<float,2>{0.456432819f, 0.602741122f},
-std::array<float,2>{0.578556895f, 0.150400341f},
-std::array<float,2>{0.0359468944f, 0.360663682f},
-std::array<float,2>{0.944576263f, 0.778986692f},
-std::array<float,2>{0.222562492f, 0.896240473f},
-std::array<float,2>{0.765016913f, 0.403864473f},
-std::array<float,2>{0.318177998f, 0.0636788309f},
-std::array<float,2>{0.650142491f, 0.685040832f},
-std::array<float,2>{0.0979468003f, 0.701848686f},
-std::array<float,2>{0.886856019f, 0.00555045903f},
-std::array<float,2>{0.381623536f, 0.477679491f},
-std::array<float,2>{0.515511513f, 0.976124048f},
-std::array<float,2>{0.296005189f, 0.831475258f},
-std::array<float,2>{0.715000451f, 0.276210606f},
-std::array<float,2>{0.154265299f, 0.188162073f},
-std::array<float,2>{0.821062386f, 0.528528392f},
-std::array<float,2>{0.315987289f, 0.544446886f},
-std::array<float,2>{0.652906418f, 0.231807455f},
-std::array<float,2>{0.225450605f, 0.289929807f},
-std::array<float,2>{0.760440171f, 0.868759751f},
-std::array<float,2>{0.0319629274f, 0.962286174f},
-std::array<float,2>{0.940239429f, 0.460426122f},
-std::array<float,2>{0.460416168f, 0.0565199479f},
-std::array<float,2>{0.58410579f, 0.741973758f},
-std::array<float,2>{0.150704294f, 0.644562483f},
-std::array<float,2>{0.826366246f, 0.108835906f},
-std::array<float,2>{0.291123211f, 0.417953312f},
-std::array<float,2>{0.71309799f, 0.924971282f},
-std::array<float,2>{0.375823677f, 0.794082284f},
-std::array<float,2>{0.509043455f, 0.330796868f},
-std::array<float,2>{0.095674634f, 0.176095724f},
-std::array<float,2>{0.886547923f, 0.593033433f},
-std::array<float,2>{0.496801198f, 0.706147015f},
-std::array<float,2>{0.62261647f, 0.0230111126f},
-std::array<float,2>{0.0248019099f, 0.488140821f},
-std::array<float,2>{0.990251303f, 0.995369613f},
-std::array<float,2>{0.19795844f, 0.820641279f},
-std::array<float,2>{0.790793121f, 0.25292483f},
-std::array<float,2>{0.357045263f, 0.210913539f},
-std::array<float,2>{0.675499618f, 0.509356439f},
-std::array<float,2>{0.0928197876f, 0.618273914f},
-std::array<float,2>{0.914595246f, 0.128799021f},
-std::array<float,2>{0.414940596f, 0.355383515f},
-std::array<float,2>{0.541341901f, 0.764484525f},
-std::array<float,2>{0.27527976f, 0.876993895f},
-std::array<float,2>{0.73433733f, 0.382675737f},
-std::array<float,2>{0.179562494f, 0.0785817653f},
-std::array<float,2>{0.872580826f, 0.661931515f},
-std::array<float,2>{0.312475532f, 0.679602563f},
-std::array<float,2>{0.698375762f, 0.0733712316f},
-std::array<float,2>{0.133550629f, 0.393560141f},
-std::array<float,2>{0.828737378f, 0.9027915f},
-std::array<float,2>{0.11919722f, 0.768048704f},
-std::array<float,2>{0.902455509f, 0.367624789f},
-std::array<float,2>{0.400909156f, 0.142577931f},
-std::array<float,2>{0.517538488f, 0.596408367f},
-std::array<float,2>{0.235967308f, 0.518663943f},
-std::array<float,2>{0.767394543f, 0.197970957f},
-std::array<float,2>{0.337729752f, 0.272703439f},
-std::array<float,2>{0.636680126f, 0.839865744f},
-std::array<float,2>{0.451443911f, 0.979682326f},
-std::array<float,2>{0.572082281f, 0.469628513f},
-std::array<float,2>{0.0529407971f, 0.00853841379f},
-std::array<float,2>{0.966340542f, 0.694369733f},
-std::array<float,2>{0.431107074f, 0.577315986f},
-std::array<float,2>{0.549525619f, 0.159652367f},
-std::array<float,2>{0.0736645758f, 0.322208881f},
-std::array<float,2>{0.936649382f, 0.800059557f},
-std::array<float,2>{0.165884808f, 0.909032464f},
-std::array<float,2>{0.856036067f, 0.43456009f},
-std::array<float,2>{0.257779092f, 0.119323708f},
-std::array<float,2>{0.735518754f, 0.629062176f},
-std::array<float,2>{0.00898832548f, 0.729145527f},
-std::array<float,2>{0.97532022f, 0.0433087982f},
-std::array<float,2>{0.480433017f, 0.451237679f},
-std::array<float,2>{0.599838436f, 0.940648079f},
-std::array<float,2>{0.374459088f, 0.856391728f},
-std::array<float,2>{0.658487856f, 0.297313005f},
-std::array<float,2>{0.214055687f, 0.238367021f},
-std::array<float,2>{0.805966496f, 0.55648613f},
-std::array<float,2>{0.259699285f, 0.60850209f},
-std::array<float,2>{0.743541002f, 0.154540017f},
-std::array<float,2>{0.162865117f, 0.364179969f},
-std::array<float,2>{0.846589625f, 0.777041912f},
-std::array<float,2>{0.0692000911f, 0.892280281f},
-std::array<float,2>{0.922559619f, 0.400057018f},
-std::array<float,2>{0.428161591f, 0.0672966838f},
-std::array<float,2>{0.559557378f, 0.680629075f},
-std::array<float,2>{0.208243951f, 0.698066056f},
-std::array<float,2>{0.801996768f, 0.00269357581f},
-std::array<float,2>{0.361981928f, 0.483110011f},
-std::array<float,2>{0.66613096f, 0.971884429f},
-std::array<float,2>{0.470753491f, 0.833205223f},
-std::array<float,2>{0.605638027f, 0.280645162f},
-std::array<float,2>{0.00377908512f, 0.195080027f},
-std::array<float,2>{0.976883054f, 0.526658654f},
-std::array<float,2>{0.392416775f, 0.634189904f},
-std::array<float,2>{0.526623189f, 0.116055682f},
-std::array<float,2>{0.116447993f, 0.422417134f},
-std::array<float,2>{0.891115069f, 0.915191293f},
-std::array<float,2>{0.12745519f, 0.809811831f},
-std::array<float,2>{0.837929249f, 0.315581977f},
-std::array<float,2>{0.297850251f, 0.167327896f},
-std::array<float,2>{0.692944169f, 0.568122268f},
-std::array<float,2>{0.0624787956f, 0.550209641f},
-std::array<float,2>{0.953665435f, 0.243330598f},
-std::array<float,2>{0.445201278f, 0.30992952f},
-std::array<float,2>{0.566366851f, 0.846675813f},
-std::array<float,2>{0.328561455f, 0.948461592f},
-std::array<float,2>{0.632232785f, 0.439569592f},
-std::array<float,2>{0.245480016f, 0.0336862206f},
-std::array<float,2>{0.777917504f, 0.71958971f},
-std::array<float,2>{0.345646739f, 0.747975588f},
-std::array<float,2>{0.681555033f, 0.0519461893f},
-std::array<float,2>{0.191215813f, 0.46759516f},
-std::array<float,2>{0.788294554f, 0.957489729f},
-std::array<float,2>{0.0190707464f, 0.867098808f},
-std::array<float,2>{0.994357705f, 0.28844896f},
-std::array<float,2>{0.490991652f, 0.218958572f},
-std::array<float,2>{0.610038877f, 0.537596107f},
-std::array<float,2>{0.182444602f, 0.585044205f},
-std::array<float,2>{0.862087846f, 0.179748759f},
-std::array<float,2>{0.26883769f, 0.337184817f},
-std::array<float,2>{0.726358652f, 0.786485195f},
-std::array<float,2>{0.408980429f, 0.937279701f},
-std::array<float,2>{0.536584496f, 0.410778612f},
-std::array<float,2>{0.0798213109f, 0.0984291509f},
-std::array<float,2>{0.910572648f, 0.656151652f},
-std::array<float,2>{0.466417938f, 0.506946921f},
-std::array<float,2>{0.588475943f, 0.217890605f},
-std::array<float,2>{0.0411651321f, 0.258435458f},
-std::array<float,2>{0.947469473f, 0.812748909f},
-std::array<float,2>{0.227790311f, 0.987451971f},
-std::array<float,2>{0.751785696f, 0.495124787f},
-std::array<float,2>{0.322139591f, 0.0278505161f},
-std::array<float,2>{0.641358674f, 0.714279771f},
-std::array<float,2>{0.106114723f, 0.670470417f},
-std::array<float,2>{0.879294991f, 0.0928035825f},
-std::array<float,2>{0.387117803f, 0.387547523f},
-std::array<float,2>{0.50764221f, 0.886234343f},
-std::array<float,2>{0.281428337f, 0.751395285f},
-std::array<float,2>{0.703957081f, 0.349618286f},
-std::array<float,2>{0.148124143f, 0.140364632f},
-std::array<float,2>{0.814112306f, 0.611312747f},
-std::array<float,2>{0.363958299f, 0.588575006f},
-std::array<float,2>{0.670367479f, 0.171966225f},
-std::array<float,2>{0.203340963f, 0.335848004f},
-std::array<float,2>{0.79807508f, 0.790386498f},
-std::array<float,2>{0.00410838146f, 0.927245736f},
-std::array<float,2>{0.981537044f, 0.419737935f},
-std::array<float,2>{0.473352909f, 0.102761745f},
-std::array<float,2>{0.601999104f, 0.643663824f},
-std::array<float,2>{0.159716204f, 0.736447692f},
-std::array<float,2>{0.84770149f, 0.0595416091f},
-std::array<float,2>{0.264942348f, 0.454530746f},
-std::array<float,2>{0.74924475f, 0.968669713f},
-std::array<float,2>{0.421948016f, 0.874373674f},
-std::array<float,2>{0.554791987f, 0.296082348f},
-std::array<float,2>{0.0645893291f, 0.230160505f},
-std::array<float,2>{0.928668559f, 0.541499972f},
-std::array<float,2>{0.438202411f, 0.658194661f},
-std::array<float,2>{0.568643928f, 0.0830887556f},
-std::array<float,2>{0.0577586479f, 0.378232628f},
-std::array<float,2>{0.958108246f, 0.880139589f},
-std::array<float,2>{0.249882653f, 0.758069038f},
-std::array<float,2>{0.776726842f, 0.357753009f},
-std::array<float,2>{0.333510816f, 0.130880952f},
-std::array<float,2>{0.626320004f, 0.624096572f},
-std::array<float,2>{0.11076168f, 0.514956415f},
-std::array<float,2>{0.898052812f, 0.204682112f},
-std::array<float,2>{0.397571445f, 0.256751388f},
-std::array<float,2>{0.527561724f, 0.824488282f},
-std::array<float,2>{0.304395944f, 0.996661365f},
-std::array<float,2>{0.689129591f, 0.489731759f},
-std::array<float,2>{0.130152434f, 0.0192639157f},
-std::array<float,2>{0.840047002f, 0.708182395f},
-std::array<float,2>{0.27191034f, 0.688720167f},
-std::array<float,2>{0.721965849f, 0.0151556749f},
-std::array<float,2>{0.184386641f, 0.475301296f},
-std::array<float,2>{0.865805626f, 0.982448339f},
-std::array<float,2>{0.0835567564f, 0.839810252f},
-std::array<float,2>{0.908924043f, 0.269451916f},
-std::array<float,2>{0.411016375f, 0.200284585f},
-std::array<float,2>{0.534295142f, 0.519880652f},
-std::array<float,2>{0.194330469f, 0.598678946f},
-std::array<float,2>{0.781889915f, 0.147639289f},
-std::array<float,2>{0.350587904f, 0.372725189f},
-std::array<float,2>{0.686726689f, 0.770353913f},
-std::array<float,2>{0.485968947f, 0.899660766f},
-std::array<float,2>{0.613373578f, 0.397518754f},
-std::array<float,2>{0.0234100241f, 0.0767791718f},
-std::array<float,2>{0.997506261f, 0.67301935f},
-std::array<float,2>{0.385110855f, 0.55864495f},
-std::array<float,2>{0.503796995f, 0.236644372f},
-std::array<float,2>{0.105269492f, 0.302029371f},
-std::array<float,2>{0.878581822f, 0.853205264f},
-std::array<float,2>{0.142497137f, 0.941703737f},
-std::array<float,2>{0.818289399f, 0.44808653f},
-std::array<float,2>{0.287723631f, 0.0406621136f},
-std::array<float,2>{0.708475947f, 0.733803749f},
-std::array<float,2>{0.0453038402f, 0.626032054f},
-std::array<float,2>{0.950338423f, 0.123662166f},
-std::array<float,2>{0.464347005f, 0.431321502f},
-std::array<float,2>{0.590800405f, 0.911500752f},
-std::array<float,2>{0.325935662f, 0.804343283f},
-std::array<float,2>{0.645621836f, 0.326217771f},
-std::array<float,2>{0.232968837f, 0.160714969f},
-std::array<float,2>{0.754235506f, 0.573516488f},
-std::array<float,2>{0.294345021f, 0.528059602f},
-std::array<float,2>{0.717795789f, 0.188933507f},
-std::array<float,2>{0.15491052f, 0.276670784f},
-std::array<float,2>{0.823779941f, 0.83028847f},
-std::array<float,2>{0.101083033f, 0.974685133f},
-std::array<float,2>{0.88905561f, 0.477392137f},
-std::array<float,2>{0.380543381f, 0.00398966623f},
-std::array<float,2>{0.512785196f, 0.702498198f},
-std::array<float,2>{0.219759107f, 0.684383392f},
-std::array<float,2>{0.763635397f, 0.0630899295f},
-std::array<float,2>{0.318664283f, 0.403201193f},
-std::array<float,2>{0.651590526f, 0.894774377f},
-std::array<float,2>{0.453156233f, 0.777853489f},
-std::array<float,2>{0.581506371f, 0.359799773f},
-std::array<float,2>{0.0385244265f, 0.152031824f},
-std::array<float,2>{0.94182831f, 0.60220325f},
-std::array<float,2>{0.418327749f, 0.725202262f},
-std::array<float,2>{0.546575129f, 0.038578257f},
-std::array<float,2>{0.0868385062f, 0.444443375f},
-std::array<float,2>{0.921391606f, 0.951716423f},
-std::array<float,2>{0.175547808f, 0.851168513f},
-std::array<float,2>{0.86833024f, 0.30830285f},
-std::array<float,2>{0.27939263f, 0.247765228f},
-std::array<float,2>{0.728752851f, 0.550956964f},
-std::array<float,2>{0.0277335402f, 0.563622832f},
-std::array<float,2>{0.987642169f, 0.168595895f},
-std::array<float,2>{0.495743692f, 0.316562623f},
-std::array<float,2>{0.61760813f, 0.805508673f},
-std::array<float,2>{0.353223622f, 0.918006122f},
-std::array<float,2>{0.677598655f, 0.429243028f},
-std::array<float,2>{0.203006476f, 0.11102391f},
-std::array<float,2>{0.796178877f, 0.638975859f},
-std::array<float,2>{0.341346502f, 0.652240813f},
-std::array<float,2>{0.63733685f, 0.0970515311f},
-std::array<float,2>{0.238963187f, 0.406568885f},
-std::array<float,2>{0.770456433f, 0.930593014f},
-std::array<float,2>{0.0469456911f, 0.781323493f},
-std::array<float,2>{0.963567019f, 0.342330009f},
-std::array<float,2>{0.446730793f, 0.185293868f},
-std::array<float,2>{0.575556099f, 0.579784095f},
-std::array<float,2>{0.140160069f, 0.531344414f},
-std::array<float,2>{0.835158527f, 0.224400565f},
-std::array<float,2>{0.305264324f, 0.283625305f},
-std::array<float,2>{0.702695072f, 0.860864937f},
-std::array<float,2>{0.405181706f, 0.956465065f},
-std::array<float,2>{0.521537423f, 0.463009119f},
-std::array<float,2>{0.121250808f, 0.0503628515f},
-std::array<float,2>{0.901520491f, 0.74595046f},
-std::array<float,2>{0.480542004f, 0.615588605f},
-std::array<float,2>{0.594868898f, 0.135084093f},
-std::array<float,2>{0.0125854714f, 0.345429987f},
-std::array<float,2>{0.971975565f, 0.753959656f},
-std::array<float,2>{0.215846255f, 0.88975513f},
-std::array<float,2>{0.810628414f, 0.386521935f},
-std::array<float,2>{0.370435864f, 0.0896514356f},
-std::array<float,2>{0.662133932f, 0.665335059f},
-std::array<float,2>{0.0767296702f, 0.718359947f},
-std::array<float,2>{0.933508813f, 0.0243231505f},
-std::array<float,2>{0.437254339f, 0.49882105f},
-std::array<float,2>{0.552044809f, 0.989274263f},
-std::array<float,2>{0.252591372f, 0.817496598f},
-std::array<float,2>{0.741940558f, 0.261970431f},
-std::array<float,2>{0.168559119f, 0.21253176f},
-std::array<float,2>{0.851827621f, 0.502308905f},
-std::array<float,2>{0.359295577f, 0.511657953f},
-std::array<float,2>{0.671901107f, 0.20841293f},
-std::array<float,2>{0.196841717f, 0.250660151f},
-std::array<float,2>{0.792645335f, 0.823245585f},
-std::array<float,2>{0.0266350359f, 0.993381917f},
-std::array<float,2>{0.989082456f, 0.486288965f},
-std::array<float,2>{0.499087453f, 0.0200495236f},
-std::array<float,2>{0.624607086f, 0.704767227f},
-std::array<float,2>{0.177039564f, 0.663689733f},
-std::array<float,2>{0.873609066f, 0.0809480473f},
-std::array<float,2>{0.276817054f, 0.380210817f},
-std::array<float,2>{0.732219934f, 0.876864791f},
-std::array<float,2>{0.416133046f, 0.762407243f},
-std::array<float,2>{0.540469766f, 0.351644158f},
-std::array<float,2>{0.0909097567f, 0.126344681f},
-std::array<float,2>{0.917241395f, 0.619472146f},
-std::array<float,2>{0.457152128f, 0.740112126f},
-std::array<float,2>{0.583429635f, 0.0580986217f},
-std::array<float,2>{0.0346093811f, 0.457844853f},
-std::array<float,2>{0.938521266f, 0.963643551f},
-std::array<float,2>{0.223790124f, 0.869737566f},
-std::array<float,2>{0.758467793f, 0.292551726f},
-std::array<float,2>{0.313295484f, 0.232824236f},
-std::array<float,2>{0.656160891f, 0.546590984f},
-std::array<float,2>{0.0961697772f, 0.591750681f},
-std::array<float,2>{0.883946776f, 0.179502174f},
-std::array<float,2>{0.378606796f, 0.328499079f},
-std::array<float,2>{0.509977281f, 0.795919955f},
-std::array<float,2>{0.29045555f, 0.922131956f},
-std::array<float,2>{0.711014926f, 0.4146505f},
-std::array<float,2>{0.149938479f, 0.106593892f},
-std::array<float,2>{0.824606776f, 0.648263752f},
-std::array<float,2>{0.254964173f, 0.632114887f},
-std::array<float,2>{0.737745106f, 0.117932081f},
-std::array<float,2>{0.166874632f, 0.435574502f},
-std::array<float,2>{0.858429849f, 0.908108473f},
-std::array<float,2>{0.0715083927f, 0.797424018f},
-std::array<float,2>{0.93496269f, 0.323451728f},
-std::array<float,2>{0.432256192f, 0.15626052f},
-std::array<float,2>{0.548112035f, 0.574255943f},
-std::array<float,2>{0.211204752f, 0.558392167f},
-std::array<float,2>{0.807316184f, 0.240373582f},
-std::array<float,2>{0.372638881f, 0.299783468f},
-std::array<float,2>{0.657755971f, 0.858531535f},
-std::array<float,2>{0.478317171f, 0.937885463f},
-std::array<float,2>{0.598378062f, 0.450199276f},
-std::array<float,2>{0.0114477836f, 0.045228105f},
-std::array<float,2>{0.97344172f, 0.727404952f},
-std::array<float,2>{0.400298446f, 0.594182968f},
-std::array<float,2>{0.518291831f, 0.143890172f},
-std::array<float,2>{0.118207149f, 0.369869828f},
-std::array<float,2>{0.905469894f, 0.765750825f},
-std::array<float,2>{0.136701539f, 0.904854834f},
-std::array<float,2>{0.830696344f, 0.391862243f},
-std::array<float,2>{0.308644474f, 0.0704272389f},
-std::array<float,2>{0.697119713f, 0.676114023f},
-std::array<float,2>{0.0510892645f, 0.692857981f},
-std::array<float,2>{0.967846751f, 0.0109846778f},
-std::array<float,2>{0.450544834f, 0.471220165f},
-std::array<float,2>{0.574137926f, 0.976807952f},
-std::array<float,2>{0.338796288f, 0.843532622f},
-std::array<float,2>{0.633947611f, 0.271199942f},
-std::array<float,2>{0.236676961f, 0.195312828f},
-std::array<float,2>{0.768268704f, 0.517417252f},
-std::array<float,2>{0.299616665f, 0.569764495f},
-std::array<float,2>{0.69378686f, 0.164240018f},
-std::array<float,2>{0.126413971f, 0.314006567f},
-std::array<float,2>{0.836457014f, 0.811622679f},
-std::array<float,2>{0.113828227f, 0.917735279f},
-std::array<float,2>{0.8933447f, 0.425322086f},
-std::array<float,2>{0.392798215f, 0.114086121f},
-std::array<float,2>{0.524247825f, 0.635077775f},
-std::array<float,2>{0.242864281f, 0.720862508f},
-std::array<float,2>{0.779547453f, 0.0314998813f},
-std::array<float,2>{0.330205232f, 0.437798202f},
-std::array<float,2>{0.629547477f, 0.946798623f},
-std::array<float,2>{0.44165644f, 0.843756735f},
-std::array<float,2>{0.56290549f, 0.311096936f},
-std::array<float,2>{0.0588470884f, 0.244151175f},
-std::array<float,2>{0.955941319f, 0.547606587f},
-std::array<float,2>{0.42599234f, 0.681732893f},
-std::array<float,2>{0.562164247f, 0.0700141266f},
-std::array<float,2>{0.0667091087f, 0.400603235f},
-std::array<float,2>{0.924496353f, 0.893325746f},
-std::array<float,2>{0.162104502f, 0.774950683f},
-std::array<float,2>{0.845427632f, 0.365865588f},
-std::array<float,2>{0.26153788f, 0.152529672f},
-std::array<float,2>{0.74483043f, 0.606212795f},
-std::array<float,2>{0.00102499954f, 0.524590194f},
-std::array<float,2>{0.97988236f, 0.193327561f},
-std::array<float,2>{0.468982577f, 0.278177053f},
-std::array<float,2>{0.608304322f, 0.835151076f},
-std::array<float,2>{0.359430045f, 0.970560253f},
-std::array<float,2>{0.664750636f, 0.481418252f},
-std::array<float,2>{0.209477261f, 0.0015844513f},
-std::array<float,2>{0.803819656f, 0.696597695f},
-std::array<float,2>{0.322922051f, 0.712269127f},
-std::array<float,2>{0.643924654f, 0.0310785994f},
-std::array<float,2>{0.230396658f, 0.493082881f},
-std::array<float,2>{0.753386557f, 0.985597074f},
-std::array<float,2>{0.0409683324f, 0.815323889f},
-std::array<float,2>{0.946421683f, 0.260191172f},
-std::array<float,2>{0.467974097f, 0.215441167f},
-std::array<float,2>{0.587643266f, 0.504437149f},
-std::array<float,2>{0.145439714f, 0.613030612f},
-std::array<float,2>{0.814792037f, 0.138375074f},
-std::array<float,2>{0.284484297f, 0.348920792f},
-std::array<float,2>{0.706618428f, 0.753812075f},
-std::array<float,2>{0.389966935f, 0.88289851f},
-std::array<float,2>{0.504743576f, 0.389628261f},
-std::array<float,2>{0.108528189f, 0.0905342028f},
-std::array<float,2>{0.882093251f, 0.669173896f},
-std::array<float,2>{0.488852054f, 0.536671758f},
-std::array<float,2>{0.613061607f, 0.221424758f},
-std::array<float,2>{0.0174439307f, 0.286712795f},
-std::array<float,2>{0.992987156f, 0.863387108f},
-std::array<float,2>{0.188356206f, 0.960914969f},
-std::array<float,2>{0.78607589f, 0.466428041f},
-std::array<float,2>{0.347045541f, 0.0530660152f},
-std::array<float,2>{0.682763278f, 0.748945355f},
-std::array<float,2>{0.0817646608f, 0.653020442f},
-std::array<float,2>{0.913215458f, 0.101104073f},
-std::array<float,2>{0.407033205f, 0.412708819f},
-std::array<float,2>{0.538605511f, 0.934246123f},
-std::array<float,2>{0.266842991f, 0.788556099f},
-std::array<float,2>{0.722738743f, 0.3387734f},
-std::array<float,2>{0.180365115f, 0.183384418f},
-std::array<float,2>{0.859492898f, 0.582818508f},
-std::array<float,2>{0.334610641f, 0.622322321f},
-std::array<float,2>{0.627066255f, 0.129789487f},
-std::array<float,2>{0.246098638f, 0.357384533f},
-std::array<float,2>{0.77495575f, 0.761607647f},
-std::array<float,2>{0.0550162196f, 0.881907642f},
-std::array<float,2>{0.959622741f, 0.376429468f},
-std::array<float,2>{0.441158801f, 0.0841996893f},
-std::array<float,2>{0.567113042f, 0.659039438f},
-std::array<float,2>{0.131387711f, 0.709355891f},
-std::array<float,2>{0.843515754f, 0.0165075622f},
-std::array<float,2>{0.302649915f, 0.491169691f},
-std::array<float,2>{0.689933121f, 0.998611748f},
-std::array<float,2>{0.39457348f, 0.827548981f},
-std::array<float,2>{0.529678285f, 0.254006177f},
-std::array<float,2>{0.11172165f, 0.205688313f},
-std::array<float,2>{0.896324813f, 0.513173699f},
-std::array<float,2>{0.475575656f, 0.641742229f},
-std::array<float,2>{0.604821503f, 0.103882402f},
-std::array<float,2>{0.00742776226f, 0.420422316f},
-std::array<float,2>{0.982747197f, 0.928562284f},
-std::array<float,2>{0.206892684f, 0.791870654f},
-std::array<float,2>{0.800546467f, 0.333525509f},
-std::array<float,2>{0.365320057f, 0.175192803f},
-std::array<float,2>{0.6692065f, 0.586298823f},
-std::array<float,2>{0.0635724291f, 0.539934993f},
-std::array<float,2>{0.926939428f, 0.227564558f},
-std::array<float,2>{0.424586594f, 0.29320693f},
-std::array<float,2>{0.557016969f, 0.872816086f},
-std::array<float,2>{0.263371825f, 0.965554833f},
-std::array<float,2>{0.747562051f, 0.455095232f},
-std::array<float,2>{0.157107517f, 0.0611589439f},
-std::array<float,2>{0.851337552f, 0.735407233f},
-std::array<float,2>{0.285183549f, 0.731063187f},
-std::array<float,2>{0.710389495f, 0.042315498f},
-std::array<float,2>{0.143416643f, 0.446130842f},
-std::array<float,2>{0.819351077f, 0.943865716f},
-std::array<float,2>{0.103231512f, 0.854143858f},
-std::array<float,2>{0.875228763f, 0.303254813f},
-std::array<float,2>{0.384686589f, 0.23475197f},
-std::array<float,2>{0.500721633f, 0.561200202f},
-std::array<float,2>{0.23211056f, 0.570558608f},
-std::array<float,2>{0.757481158f, 0.162169382f},
-std::array<float,2>{0.327670693f, 0.325777441f},
-std::array<float,2>{0.646870494f, 0.802324593f},
-std::array<float,2>{0.462221473f, 0.912945211f},
-std::array<float,2>{0.592227757f, 0.432180077f},
-std::array<float,2>{0.0437312126f, 0.122038081f},
-std::array<float,2>{0.952853978f, 0.62817657f},
-std::array<float,2>{0.413215131f, 0.523406446f},
-std::array<float,2>{0.532734573f, 0.202988148f},
-std::array<float,2>{0.085760504f, 0.267011076f},
-std::array<float,2>{0.908094585f, 0.83658421f},
-std::array<float,2>{0.186422005f, 0.982285142f},
-std::array<float,2>{0.864277184f, 0.472694218f},
-std::array<float,2>{0.270861387f, 0.0120892348f},
-std::array<float,2>{0.720075905f, 0.690109372f},
-std::array<float,2>{0.0214698203f, 0.67410773f},
-std::array<float,2>{0.999417722f, 0.0760996938f},
-std::array<float,2>{0.487457544f, 0.395684868f},
-std::array<float,2>{0.617180705f, 0.901565969f},
-std::array<float,2>{0.349462241f, 0.77225709f},
-std::array<float,2>{0.684567094f, 0.374971688f},
-std::array<float,2>{0.192470625f, 0.144837409f},
-std::array<float,2>{0.783939004f, 0.600302815f},
-std::array<float,2>{0.277818412f, 0.553376317f},
-std::array<float,2>{0.727811754f, 0.249347672f},
-std::array<float,2>{0.172857642f, 0.306531787f},
-std::array<float,2>{0.870532274f, 0.848197699f},
-std::array<float,2>{0.0885157138f, 0.949965835f},
-std::array<float,2>{0.918869138f, 0.443136901f},
-std::array<float,2>{0.420769632f, 0.0359689519f},
-std::array<float,2>{0.544081628f, 0.723141789f},
-std::array<float,2>{0.200080633f, 0.637450099f},
-std::array<float,2>{0.794142365f, 0.111759596f},
-std::array<float,2>{0.354545772f, 0.427174747f},
-std::array<float,2>{0.679256201f, 0.920223951f},
-std::array<float,2>{0.492732644f, 0.808036506f},
-std::array<float,2>{0.620302022f, 0.319183409f},
-std::array<float,2>{0.0309811961f, 0.1704465f},
-std::array<float,2>{0.98541683f, 0.564684272f},
-std::array<float,2>{0.382151514f, 0.700182259f},
-std::array<float,2>{0.514509737f, 0.00666040881f},
-std::array<float,2>{0.0990339071f, 0.47995171f},
-std::array<float,2>{0.888332725f, 0.972854376f},
-std::array<float,2>{0.15287891f, 0.828509271f},
-std::array<float,2>{0.822239816f, 0.273744375f},
-std::array<float,2>{0.295027196f, 0.190969229f},
-std::array<float,2>{0.716537595f, 0.53089422f},
-std::array<float,2>{0.0362025686f, 0.605211318f},
-std::array<float,2>{0.944201648f, 0.149191231f},
-std::array<float,2>{0.455696285f, 0.363020778f},
-std::array<float,2>{0.579960704f, 0.779695451f},
-std::array<float,2>{0.316998065f, 0.897443831f},
-std::array<float,2>{0.649236321f, 0.405428439f},
-std::array<float,2>{0.221347764f, 0.0646207407f},
-std::array<float,2>{0.764402211f, 0.686430156f},
-std::array<float,2>{0.367782563f, 0.66791749f},
-std::array<float,2>{0.660808921f, 0.0878233761f},
-std::array<float,2>{0.216812104f, 0.383454502f},
-std::array<float,2>{0.810342252f, 0.888506055f},
-std::array<float,2>{0.0144794201f, 0.757096469f},
-std::array<float,2>{0.968795359f, 0.346113354f},
-std::array<float,2>{0.48292315f, 0.134299487f},
-std::array<float,2>{0.595812619f, 0.613381803f},
-std::array<float,2>{0.171272248f, 0.501178324f},
-std::array<float,2>{0.855365276f, 0.214391574f},
-std::array<float,2>{0.250914425f, 0.263972312f},
-std::array<float,2>{0.738639176f, 0.819997847f},
-std::array<float,2>{0.434421331f, 0.991543472f},
-std::array<float,2>{0.554334104f, 0.496232986f},
-std::array<float,2>{0.0745307952f, 0.0268483106f},
-std::array<float,2>{0.930189967f, 0.716217458f},
-std::array<float,2>{0.448098004f, 0.581400752f},
-std::array<float,2>{0.576450706f, 0.185795099f},
-std::array<float,2>{0.0504175797f, 0.340981126f},
-std::array<float,2>{0.962281704f, 0.783551931f},
-std::array<float,2>{0.241276979f, 0.933090448f},
-std::array<float,2>{0.772212207f, 0.408329964f},
-std::array<float,2>{0.342580378f, 0.0940027833f},
-std::array<float,2>{0.639488697f, 0.649634242f},
-std::array<float,2>{0.124395035f, 0.743554115f},
-std::array<float,2>{0.90007019f, 0.047748249f},
-std::array<float,2>{0.403214425f, 0.461599231f},
-std::array<float,2>{0.519619167f, 0.95331049f},
-std::array<float,2>{0.307379395f, 0.862843812f},
-std::array<float,2>{0.700510979f, 0.281910002f},
-std::array<float,2>{0.137321129f, 0.226199985f},
-std::array<float,2>{0.833262444f, 0.534925282f},
-std::array<float,2>{0.318470448f, 0.529462695f},
-std::array<float,2>{0.651778162f, 0.190190822f},
-std::array<float,2>{0.220111191f, 0.275085628f},
-std::array<float,2>{0.763346374f, 0.829625487f},
-std::array<float,2>{0.0381903648f, 0.97437185f},
-std::array<float,2>{0.941507041f, 0.479206562f},
-std::array<float,2>{0.453480124f, 0.00746296393f},
-std::array<float,2>{0.581152141f, 0.700862765f},
-std::array<float,2>{0.155205503f, 0.687432051f},
-std::array<float,2>{0.824194014f, 0.0657968223f},
-std::array<float,2>{0.294146568f, 0.404640973f},
-std::array<float,2>{0.718124211f, 0.898246586f},
-std::array<float,2>{0.380712181f, 0.781015873f},
-std::array<float,2>{0.512993693f, 0.361744225f},
-std::array<float,2>{0.101364397f, 0.149584293f},
-std::array<float,2>{0.888678789f, 0.603906929f},
-std::array<float,2>{0.496012896f, 0.723655522f},
-std::array<float,2>{0.617374122f, 0.0367396399f},
-std::array<float,2>{0.0274246298f, 0.442203492f},
-std::array<float,2>{0.987316191f, 0.950869381f},
-std::array<float,2>{0.202846602f, 0.849374175f},
-std::array<float,2>{0.795921922f, 0.30561474f},
-std::array<float,2>{0.35333702f, 0.248311907f},
-std::array<float,2>{0.677471817f, 0.554450631f},
-std::array<float,2>{0.0865408331f, 0.565606177f},
-std::array<float,2>{0.921689093f, 0.171561614f},
-std::array<float,2>{0.418031991f, 0.319700807f},
-std::array<float,2>{0.546806395f, 0.806937754f},
-std::array<float,2>{0.279752135f, 0.921307385f},
-std::array<float,2>{0.728806973f, 0.426430076f},
-std::array<float,2>{0.175535515f, 0.112879671f},
-std::array<float,2>{0.868564188f, 0.638273597f},
-std::array<float,2>{0.30551216f, 0.64901185f},
-std::array<float,2>{0.702953279f, 0.0948599428f},
-std::array<float,2>{0.140459567f, 0.40978694f},
-std::array<float,2>{0.83533895f, 0.93192941f},
-std::array<float,2>{0.121578716f, 0.784588099f},
-std::array<float,2>{0.901701272f, 0.340783119f},
-std::array<float,2>{0.404795885f, 0.186980739f},
-std::array<float,2>{0.521799386f, 0.580440879f},
-std::array<float,2>{0.23912853f, 0.53325361f},
-std::array<float,2>{0.770122349f, 0.225338757f},
-std::array<float,2>{0.34174481f, 0.282889992f},
-std::array<float,2>{0.637551844f, 0.861632049f},
-std::array<float,2>{0.446436673f, 0.955054045f},
-std::array<float,2>{0.575205028f, 0.46247068f},
-std::array<float,2>{0.047291059f, 0.0479431003f},
-std::array<float,2>{0.963843763f, 0.742243052f},
-std::array<float,2>{0.437485456f, 0.614259779f},
-std::array<float,2>{0.551942766f, 0.132924482f},
-std::array<float,2>{0.0771054178f, 0.347222745f},
-std::array<float,2>{0.933341384f, 0.75614208f},
-std::array<float,2>{0.168837488f, 0.886903524f},
-std::array<float,2>{0.851688385f, 0.384453565f},
-std::array<float,2>{0.252713561f, 0.0868410692f},
-std::array<float,2>{0.742064893f, 0.666333973f},
-std::array<float,2>{0.0123720616f, 0.715397835f},
-std::array<float,2>{0.971849084f, 0.0262930412f},
-std::array<float,2>{0.480877131f, 0.497796416f},
-std::array<float,2>{0.595113754f, 0.990855813f},
-std::array<float,2>{0.370129228f, 0.818956435f},
-std::array<float,2>{0.662428021f, 0.265282571f},
-std::array<float,2>{0.216299236f, 0.213554487f},
-std::array<float,2>{0.810831726f, 0.500452578f},
-std::array<float,2>{0.264662892f, 0.587454319f},
-std::array<float,2>{0.749279678f, 0.17408888f},
-std::array<float,2>{0.159951046f, 0.332680702f},
-std::array<float,2>{0.848028898f, 0.79283905f},
-std::array<float,2>{0.0648104325f, 0.929124951f},
-std::array<float,2>{0.928287745f, 0.42154476f},
-std::array<float,2>{0.42227459f, 0.105030552f},
-std::array<float,2>{0.555079639f, 0.640999556f},
-std::array<float,2>{0.203606099f, 0.734592199f},
-std::array<float,2>{0.798211634f, 0.0618723519f},
-std::array<float,2>{0.36403805f, 0.456710279f},
-std::array<float,2>{0.670092106f, 0.966142654f},
-std::array<float,2>{0.473404199f, 0.871304989f},
-std::array<float,2>{0.601740241f, 0.294782072f},
-std::array<float,2>{0.00431910576f, 0.226593792f},
-std::array<float,2>{0.981699586f, 0.54023838f},
-std::array<float,2>{0.397926807f, 0.659575164f},
-std::array<float,2>{0.527774394f, 0.0859356597f},
-std::array<float,2>{0.1103554f, 0.375472516f},
-std::array<float,2>{0.8983922f, 0.881520987f},
-std::array<float,2>{0.129897237f, 0.760055006f},
-std::array<float,2>{0.840207934f, 0.356054455f},
-std::array<float,2>{0.304541111f, 0.130578652f},
-std::array<float,2>{0.68924731f, 0.621770382f},
-std::array<float,2>{0.0579781197f, 0.511830509f},
-std::array<float,2>{0.958466291f, 0.206131548f},
-std::array<float,2>{0.438339621f, 0.255166143f},
-std::array<float,2>{0.568390489f, 0.826390862f},
-std::array<float,2>{0.333841503f, 0.999571085f},
-std::array<float,2>{0.626074851f, 0.491437554f},
-std::array<float,2>{0.249719039f, 0.0174966771f},
-std::array<float,2>{0.776411355f, 0.710627496f},
-std::array<float,2>{0.350956649f, 0.690437734f},
-std::array<float,2>{0.686965406f, 0.012771056f},
-std::array<float,2>{0.193885475f, 0.473834127f},
-std::array<float,2>{0.782203078f, 0.980888665f},
-std::array<float,2>{0.0229616538f, 0.837369561f},
-std::array<float,2>{0.997127831f, 0.266057044f},
-std::array<float,2>{0.486123741f, 0.201503783f},
-std::array<float,2>{0.613676786f, 0.522454023f},
-std::array<float,2>{0.184106752f, 0.601246178f},
-std::array<float,2>{0.866136909f, 0.146472827f},
-std::array<float,2>{0.271577477f, 0.373605281f},
-std::array<float,2>{0.72168231f, 0.773244798f},
-std::array<float,2>{0.41086778f, 0.900948703f},
-std::array<float,2>{0.534667611f, 0.394754976f},
-std::array<float,2>{0.0837697685f, 0.0746178553f},
-std::array<float,2>{0.909002662f, 0.675235927f},
-std::array<float,2>{0.463907778f, 0.561656296f},
-std::array<float,2>{0.590408504f, 0.235436872f},
-std::array<float,2>{0.0451248512f, 0.30432114f},
-std::array<float,2>{0.950673759f, 0.854500711f},
-std::array<float,2>{0.23332189f, 0.944356799f},
-std::array<float,2>{0.753914714f, 0.446820706f},
-std::array<float,2>{0.325782657f, 0.0418114252f},
-std::array<float,2>{0.645860732f, 0.731752753f},
-std::array<float,2>{0.105027497f, 0.627379537f},
-std::array<float,2>{0.878782332f, 0.122275665f},
-std::array<float,2>{0.384851873f, 0.432632178f},
-std::array<float,2>{0.503606141f, 0.913434923f},
-std::array<float,2>{0.287847519f, 0.801558495f},
-std::array<float,2>{0.708133698f, 0.32435903f},
-std::array<float,2>{0.142141208f, 0.163783491f},
-std::array<float,2>{0.818017006f, 0.571867526f},
-std::array<float,2>{0.362279445f, 0.607246041f},
-std::array<float,2>{0.66650182f, 0.154266953f},
-std::array<float,2>{0.208441362f, 0.366527557f},
-std::array<float,2>{0.802239895f, 0.773771346f},
-std::array<float,2>{0.00342107634f, 0.89417243f},
-std::array<float,2>{0.97658658f, 0.402232677f},
-std::array<float,2>{0.471005917f, 0.0686216652f},
-std::array<float,2>{0.605876088f, 0.683007121f},
-std::array<float,2>{0.162625045f, 0.695500076f},
-std::array<float,2>{0.846283615f, 0.000835998275f},
-std::array<float,2>{0.259368807f, 0.48195675f},
-std::array<float,2>{0.743288875f, 0.969259799f},
-std::array<float,2>{0.427970082f, 0.834148884f},
-std::array<float,2>{0.559208333f, 0.278924227f},
-std::array<float,2>{0.0690532029f, 0.191910952f},
-std::array<float,2>{0.922694802f, 0.523977339f},
-std::array<float,2>{0.445008367f, 0.635976672f},
-std::array<float,2>{0.566043854f, 0.114441611f},
-std::array<float,2>{0.0620442331f, 0.424145073f},
-std::array<float,2>{0.953961253f, 0.916185975f},
-std::array<float,2>{0.245124757f, 0.810699821f},
-std::array<float,2>{0.778195739f, 0.313184142f},
-std::array<float,2>{0.328183413f, 0.165890083f},
-std::array<float,2>{0.632074773f, 0.568995774f},
-std::array<float,2>{0.116538301f, 0.548671246f},
-std::array<float,2>{0.891582251f, 0.245813638f},
-std::array<float,2>{0.392319739f, 0.311749279f},
-std::array<float,2>{0.526530623f, 0.845243931f},
-std::array<float,2>{0.297459155f, 0.945437491f},
-std::array<float,2>{0.693121374f, 0.439287394f},
-std::array<float,2>{0.127836794f, 0.0330917761f},
-std::array<float,2>{0.838266134f, 0.722518802f},
-std::array<float,2>{0.268586189f, 0.749343753f},
-std::array<float,2>{0.726227522f, 0.0542488769f},
-std::array<float,2>{0.182302698f, 0.465102464f},
-std::array<float,2>{0.862015784f, 0.95984602f},
-std::array<float,2>{0.0798918307f, 0.865232646f},
-std::array<float,2>{0.910235286f, 0.285206258f},
-std::array<float,2>{0.40876621f, 0.221893623f},
-std::array<float,2>{0.536272585f, 0.535205841f},
-std::array<float,2>{0.190938875f, 0.58389467f},
-std::array<float,2>{0.788376153f, 0.182398409f},
-std::array<float,2>{0.345262855f, 0.339371592f},
-std::array<float,2>{0.681195021f, 0.78782934f},
-std::array<float,2>{0.490836114f, 0.934822798f},
-std::array<float,2>{0.610217035f, 0.413758278f},
-std::array<float,2>{0.0194422323f, 0.0998054594f},
-std::array<float,2>{0.99456495f, 0.65368849f},
-std::array<float,2>{0.38685599f, 0.505148351f},
-std::array<float,2>{0.507552981f, 0.216717944f},
-std::array<float,2>{0.106243581f, 0.261697173f},
-std::array<float,2>{0.879003823f, 0.815997481f},
-std::array<float,2>{0.14837274f, 0.98492527f},
-std::array<float,2>{0.814442217f, 0.493648171f},
-std::array<float,2>{0.281532764f, 0.0300093833f},
-std::array<float,2>{0.7036708f, 0.711198628f},
-std::array<float,2>{0.0412988812f, 0.668715894f},
-std::array<float,2>{0.947562456f, 0.0908340439f},
-std::array<float,2>{0.466774732f, 0.390139401f},
-std::array<float,2>{0.588754892f, 0.884642661f},
-std::array<float,2>{0.32178387f, 0.752215624f},
-std::array<float,2>{0.641169131f, 0.348454893f},
-std::array<float,2>{0.227601364f, 0.137302116f},
-std::array<float,2>{0.751658261f, 0.611888289f},
-std::array<float,2>{0.291347712f, 0.545584619f},
-std::array<float,2>{0.713326752f, 0.234232768f},
-std::array<float,2>{0.150537878f, 0.291294336f},
-std::array<float,2>{0.826587975f, 0.870429993f},
-std::array<float,2>{0.095223248f, 0.964352965f},
-std::array<float,2>{0.886460662f, 0.458768278f},
-std::array<float,2>{0.375555903f, 0.0567335784f},
-std::array<float,2>{0.508803248f, 0.739215493f},
-std::array<float,2>{0.225327775f, 0.647156179f},
-std::array<float,2>{0.760719478f, 0.106120721f},
-std::array<float,2>{0.316304147f, 0.415264517f},
-std::array<float,2>{0.653118372f, 0.923784852f},
-std::array<float,2>{0.460068077f, 0.79537493f},
-std::array<float,2>{0.584323645f, 0.329358071f},
-std::array<float,2>{0.0322190262f, 0.178595409f},
-std::array<float,2>{0.94008249f, 0.590560317f},
-std::array<float,2>{0.414750874f, 0.70335722f},
-std::array<float,2>{0.541221023f, 0.0210507214f},
-std::array<float,2>{0.0930280313f, 0.484674007f},
-std::array<float,2>{0.914937258f, 0.992443502f},
-std::array<float,2>{0.179341823f, 0.823137045f},
-std::array<float,2>{0.87303406f, 0.251639664f},
-std::array<float,2>{0.274931043f, 0.208002061f},
-std::array<float,2>{0.73396194f, 0.510111094f},
-std::array<float,2>{0.0246504154f, 0.621070206f},
-std::array<float,2>{0.99048686f, 0.125860557f},
-std::array<float,2>{0.496959776f, 0.352578133f},
-std::array<float,2>{0.623010933f, 0.763430297f},
-std::array<float,2>{0.357328027f, 0.875088573f},
-std::array<float,2>{0.675701797f, 0.379027158f},
-std::array<float,2>{0.198105618f, 0.0819015503f},
-std::array<float,2>{0.790531218f, 0.663041651f},
-std::array<float,2>{0.337545037f, 0.677536488f},
-std::array<float,2>{0.636268735f, 0.0717591792f},
-std::array<float,2>{0.236168846f, 0.391495943f},
-std::array<float,2>{0.767114937f, 0.905729651f},
-std::array<float,2>{0.0530292355f, 0.766703069f},
-std::array<float,2>{0.966570377f, 0.370945662f},
-std::array<float,2>{0.45123446f, 0.143214926f},
-std::array<float,2>{0.571914554f, 0.595402658f},
-std::array<float,2>{0.133536384f, 0.515790224f},
-std::array<float,2>{0.828911901f, 0.196867332f},
-std::array<float,2>{0.312118232f, 0.270318717f},
-std::array<float,2>{0.698704779f, 0.842300773f},
-std::array<float,2>{0.401334316f, 0.97792238f},
-std::array<float,2>{0.517325282f, 0.472369552f},
-std::array<float,2>{0.119512655f, 0.00981045701f},
-std::array<float,2>{0.902814567f, 0.691925585f},
-std::array<float,2>{0.480150521f, 0.575385571f},
-std::array<float,2>{0.600088835f, 0.157662168f},
-std::array<float,2>{0.0091544548f, 0.322303146f},
-std::array<float,2>{0.97537303f, 0.798615813f},
-std::array<float,2>{0.214238212f, 0.906611204f},
-std::array<float,2>{0.805664361f, 0.437106371f},
-std::array<float,2>{0.374025226f, 0.118686058f},
-std::array<float,2>{0.658371687f, 0.63150984f},
-std::array<float,2>{0.0733697191f, 0.727784872f},
-std::array<float,2>{0.936777055f, 0.0466678105f},
-std::array<float,2>{0.430801719f, 0.449937165f},
-std::array<float,2>{0.549709737f, 0.938842654f},
-std::array<float,2>{0.25747183f, 0.857624352f},
-std::array<float,2>{0.735645354f, 0.300501615f},
-std::array<float,2>{0.165571928f, 0.242082089f},
-std::array<float,2>{0.856339812f, 0.556868196f},
-std::array<float,2>{0.354934454f, 0.552660048f},
-std::array<float,2>{0.679475009f, 0.246895418f},
-std::array<float,2>{0.199847028f, 0.306797296f},
-std::array<float,2>{0.794402719f, 0.849684477f},
-std::array<float,2>{0.0310543031f, 0.952624917f},
-std::array<float,2>{0.985820234f, 0.443633586f},
-std::array<float,2>{0.49301964f, 0.0379756838f},
-std::array<float,2>{0.620448768f, 0.72595793f},
-std::array<float,2>{0.173251539f, 0.640069783f},
-std::array<float,2>{0.870212257f, 0.109775893f},
-std::array<float,2>{0.277493596f, 0.428270131f},
-std::array<float,2>{0.727701843f, 0.919526815f},
-std::array<float,2>{0.420437098f, 0.805880785f},
-std::array<float,2>{0.544362009f, 0.318313032f},
-std::array<float,2>{0.088696681f, 0.16904372f},
-std::array<float,2>{0.918524027f, 0.562830746f},
-std::array<float,2>{0.455848694f, 0.701272905f},
-std::array<float,2>{0.579666317f, 0.00504155783f},
-std::array<float,2>{0.0365096964f, 0.478399664f},
-std::array<float,2>{0.943879783f, 0.975698292f},
-std::array<float,2>{0.221663952f, 0.831840515f},
-std::array<float,2>{0.764589369f, 0.275501639f},
-std::array<float,2>{0.317277074f, 0.187568933f},
-std::array<float,2>{0.649097204f, 0.52881217f},
-std::array<float,2>{0.0987368152f, 0.603413343f},
-std::array<float,2>{0.888497889f, 0.150978953f},
-std::array<float,2>{0.381837666f, 0.360879302f},
-std::array<float,2>{0.514317751f, 0.778697848f},
-std::array<float,2>{0.295374274f, 0.89556241f},
-std::array<float,2>{0.716742158f, 0.403370559f},
-std::array<float,2>{0.15330334f, 0.063966617f},
-std::array<float,2>{0.821981072f, 0.685213864f},
-std::array<float,2>{0.250663698f, 0.66460681f},
-std::array<float,2>{0.738512456f, 0.0886289999f},
-std::array<float,2>{0.171065435f, 0.384884566f},
-std::array<float,2>{0.855080307f, 0.889149487f},
-std::array<float,2>{0.0744422451f, 0.755200028f},
-std::array<float,2>{0.93058604f, 0.344596058f},
-std::array<float,2>{0.434300691f, 0.136132717f},
-std::array<float,2>{0.554494202f, 0.61712867f},
-std::array<float,2>{0.217228457f, 0.503902078f},
-std::array<float,2>{0.81013608f, 0.211578339f},
-std::array<float,2>{0.368047357f, 0.262914628f},
-std::array<float,2>{0.660956025f, 0.816414356f},
-std::array<float,2>{0.483356804f, 0.988980711f},
-std::array<float,2>{0.596135616f, 0.499113709f},
-std::array<float,2>{0.014356859f, 0.0248972625f},
-std::array<float,2>{0.969192088f, 0.717731774f},
-std::array<float,2>{0.403054804f, 0.578585029f},
-std::array<float,2>{0.519804776f, 0.184543118f},
-std::array<float,2>{0.124032073f, 0.343723446f},
-std::array<float,2>{0.9001984f, 0.782747567f},
-std::array<float,2>{0.137636766f, 0.93094635f},
-std::array<float,2>{0.833032072f, 0.408048362f},
-std::array<float,2>{0.307146519f, 0.0966399983f},
-std::array<float,2>{0.700352669f, 0.650777638f},
-std::array<float,2>{0.0506861657f, 0.744858027f},
-std::array<float,2>{0.962048888f, 0.0497515239f},
-std::array<float,2>{0.447856069f, 0.464113623f},
-std::array<float,2>{0.576330841f, 0.955230296f},
-std::array<float,2>{0.342446864f, 0.859671295f},
-std::array<float,2>{0.639339626f, 0.284280062f},
-std::array<float,2>{0.241588458f, 0.222929463f},
-std::array<float,2>{0.772244036f, 0.532777429f},
-std::array<float,2>{0.302342713f, 0.623354793f},
-std::array<float,2>{0.689550996f, 0.132801235f},
-std::array<float,2>{0.131637082f, 0.358890802f},
-std::array<float,2>{0.843405247f, 0.759521842f},
-std::array<float,2>{0.11144805f, 0.879637003f},
-std::array<float,2>{0.896204293f, 0.377892762f},
-std::array<float,2>{0.394931465f, 0.0820626095f},
-std::array<float,2>{0.529507995f, 0.656570494f},
-std::array<float,2>{0.246346682f, 0.70775497f},
-std::array<float,2>{0.775151491f, 0.0176608972f},
-std::array<float,2>{0.334914833f, 0.488310456f},
-std::array<float,2>{0.627334058f, 0.997508168f},
-std::array<float,2>{0.441218257f, 0.825749159f},
-std::array<float,2>{0.567194879f, 0.257696748f},
-std::array<float,2>{0.0548753999f, 0.204078093f},
-std::array<float,2>{0.959840536f, 0.514153838f},
-std::array<float,2>{0.424471229f, 0.642788768f},
-std::array<float,2>{0.556718767f, 0.10223335f},
-std::array<float,2>{0.0639070123f, 0.418629736f},
-std::array<float,2>{0.927090228f, 0.926617742f},
-std::array<float,2>{0.15689823f, 0.789387941f},
-std::array<float,2>{0.851249218f, 0.333986908f},
-std::array<float,2>{0.26362443f, 0.173517406f},
-std::array<float,2>{0.747814f, 0.589544892f},
-std::array<float,2>{0.00774484454f, 0.542744756f},
-std::array<float,2>{0.982429564f, 0.228771478f},
-std::array<float,2>{0.475155771f, 0.295704991f},
-std::array<float,2>{0.604612172f, 0.873453081f},
-std::array<float,2>{0.365690768f, 0.967620194f},
-std::array<float,2>{0.669166327f, 0.453565955f},
-std::array<float,2>{0.206753269f, 0.0598743968f},
-std::array<float,2>{0.800431967f, 0.737822473f},
-std::array<float,2>{0.328043401f, 0.732814848f},
-std::array<float,2>{0.64667052f, 0.0395117998f},
-std::array<float,2>{0.232313991f, 0.448702812f},
-std::array<float,2>{0.757734358f, 0.942484677f},
-std::array<float,2>{0.0435238183f, 0.851949036f},
-std::array<float,2>{0.952964544f, 0.301425338f},
-std::array<float,2>{0.462108076f, 0.237487853f},
-std::array<float,2>{0.591806889f, 0.560379148f},
-std::array<float,2>{0.143220052f, 0.572707355f},
-std::array<float,2>{0.819682539f, 0.161143497f},
-std::array<float,2>{0.285514504f, 0.32731384f},
-std::array<float,2>{0.710153043f, 0.803556442f},
-std::array<float,2>{0.384415865f, 0.911043882f},
-std::array<float,2>{0.500801265f, 0.430317789f},
-std::array<float,2>{0.103456564f, 0.124723241f},
-std::array<float,2>{0.875480294f, 0.625075936f},
-std::array<float,2>{0.487734437f, 0.520739973f},
-std::array<float,2>{0.616907597f, 0.199324936f},
-std::array<float,2>{0.0211329646f, 0.268452704f},
-std::array<float,2>{0.999044418f, 0.838222146f},
-std::array<float,2>{0.192728758f, 0.983708918f},
-std::array<float,2>{0.783770204f, 0.4759354f},
-std::array<float,2>{0.34915489f, 0.0144381206f},
-std::array<float,2>{0.684190691f, 0.687975347f},
-std::array<float,2>{0.0856890082f, 0.671895266f},
-std::array<float,2>{0.907931089f, 0.0779861063f},
-std::array<float,2>{0.413567781f, 0.397241294f},
-std::array<float,2>{0.533043146f, 0.899105728f},
-std::array<float,2>{0.270572126f, 0.770759523f},
-std::array<float,2>{0.719904244f, 0.371419251f},
-std::array<float,2>{0.186146051f, 0.147139475f},
-std::array<float,2>{0.86454004f, 0.597676098f},
-std::array<float,2>{0.33036539f, 0.567361236f},
-std::array<float,2>{0.629738033f, 0.166109204f},
-std::array<float,2>{0.243047044f, 0.315266967f},
-std::array<float,2>{0.779405236f, 0.80956775f},
-std::array<float,2>{0.0586983748f, 0.91452378f},
-std::array<float,2>{0.955750823f, 0.423273176f},
-std::array<float,2>{0.441601038f, 0.116632707f},
-std::array<float,2>{0.562689602f, 0.633194327f},
-std::array<float,2>{0.126114979f, 0.720121086f},
-std::array<float,2>{0.836687684f, 0.0347002521f},
-std::array<float,2>{0.299509227f, 0.440674275f},
-std::array<float,2>{0.693503678f, 0.947846591f},
-std::array<float,2>{0.392907858f, 0.847411275f},
-std::array<float,2>{0.524051368f, 0.309386134f},
-std::array<float,2>{0.114078037f, 0.242397606f},
-std::array<float,2>{0.893199921f, 0.549611866f},
-std::array<float,2>{0.469074458f, 0.680903792f},
-std::array<float,2>{0.607910872f, 0.0683379471f},
-std::array<float,2>{0.0012605493f, 0.399249732f},
-std::array<float,2>{0.979507864f, 0.8909114f},
-std::array<float,2>{0.209946275f, 0.77589047f},
-std::array<float,2>{0.804135978f, 0.36478284f},
-std::array<float,2>{0.35982579f, 0.155846298f},
-std::array<float,2>{0.664825857f, 0.607683241f},
-std::array<float,2>{0.0665583611f, 0.526249051f},
-std::array<float,2>{0.924621284f, 0.194317386f},
-std::array<float,2>{0.426200181f, 0.280220181f},
-std::array<float,2>{0.562293291f, 0.832468092f},
-std::array<float,2>{0.261348188f, 0.971514046f},
-std::array<float,2>{0.745092332f, 0.484196842f},
-std::array<float,2>{0.161621451f, 0.00384474639f},
-std::array<float,2>{0.845563531f, 0.698800564f},
-std::array<float,2>{0.284211904f, 0.71322298f},
-std::array<float,2>{0.706937969f, 0.0283930339f},
-std::array<float,2>{0.145232201f, 0.494742066f},
-std::array<float,2>{0.814636469f, 0.98702085f},
-std::array<float,2>{0.108866282f, 0.813705742f},
-std::array<float,2>{0.882077336f, 0.259131014f},
-std::array<float,2>{0.389800042f, 0.217164591f},
-std::array<float,2>{0.504525423f, 0.506469309f},
-std::array<float,2>{0.23018837f, 0.610061288f},
-std::array<float,2>{0.753025651f, 0.139556676f},
-std::array<float,2>{0.323066205f, 0.350792378f},
-std::array<float,2>{0.643610716f, 0.75011605f},
-std::array<float,2>{0.468109101f, 0.88540566f},
-std::array<float,2>{0.587802529f, 0.388096511f},
-std::array<float,2>{0.0407351516f, 0.0927052423f},
-std::array<float,2>{0.946590304f, 0.671326637f},
-std::array<float,2>{0.406800032f, 0.53872174f},
-std::array<float,2>{0.539019585f, 0.219851434f},
-std::array<float,2>{0.0818074122f, 0.287586123f},
-std::array<float,2>{0.913524091f, 0.866015196f},
-std::array<float,2>{0.180592149f, 0.958086252f},
-std::array<float,2>{0.859653652f, 0.468131065f},
-std::array<float,2>{0.266894609f, 0.0509664081f},
-std::array<float,2>{0.722947598f, 0.746660113f},
-std::array<float,2>{0.0172207672f, 0.654653549f},
-std::array<float,2>{0.992819071f, 0.099149555f},
-std::array<float,2>{0.489129752f, 0.411555767f},
-std::array<float,2>{0.612999499f, 0.935558379f},
-std::array<float,2>{0.346916467f, 0.785566092f},
-std::array<float,2>{0.683057725f, 0.336305171f},
-std::array<float,2>{0.188200533f, 0.180841655f},
-std::array<float,2>{0.78581351f, 0.584466636f},
-std::array<float,2>{0.276538998f, 0.508522093f},
-std::array<float,2>{0.73216337f, 0.209090844f},
-std::array<float,2>{0.176799804f, 0.253371179f},
-std::array<float,2>{0.87383604f, 0.821291089f},
-std::array<float,2>{0.0911134556f, 0.994757533f},
-std::array<float,2>{0.917167425f, 0.486562848f},
-std::array<float,2>{0.416279495f, 0.0224127341f},
-std::array<float,2>{0.540211439f, 0.705434084f},
-std::array<float,2>{0.197205335f, 0.660651565f},
-std::array<float,2>{0.792752206f, 0.0792266056f},
-std::array<float,2>{0.359025329f, 0.381554037f},
-std::array<float,2>{0.672184527f, 0.878125191f},
-std::array<float,2>{0.49948433f, 0.764689267f},
-std::array<float,2>{0.624756515f, 0.354066372f},
-std::array<float,2>{0.0264249872f, 0.127594262f},
-std::array<float,2>{0.988971591f, 0.617894351f},
-std::array<float,2>{0.378866553f, 0.74026382f},
-std::array<float,2>{0.51012224f, 0.0554908961f},
-std::array<float,2>{0.0958183035f, 0.459223568f},
-std::array<float,2>{0.884271801f, 0.961539388f},
-std::array<float,2>{0.150330856f, 0.867943823f},
-std::array<float,2>{0.824389994f, 0.290355742f},
-std::array<float,2>{0.290203542f, 0.230752006f},
-std::array<float,2>{0.711407781f, 0.543939829f},
-std::array<float,2>{0.03419929f, 0.592434466f},
-std::array<float,2>{0.938794374f, 0.176837191f},
-std::array<float,2>{0.45746097f, 0.331681699f},
-std::array<float,2>{0.583132029f, 0.793114424f},
-std::array<float,2>{0.313222468f, 0.923855305f},
-std::array<float,2>{0.655845881f, 0.416588187f},
-std::array<float,2>{0.224102944f, 0.108358145f},
-std::array<float,2>{0.75865829f, 0.646467507f},
-std::array<float,2>{0.372875541f, 0.629993618f},
-std::array<float,2>{0.65818572f, 0.120792381f},
-std::array<float,2>{0.211088687f, 0.43462342f},
-std::array<float,2>{0.807482898f, 0.909206629f},
-std::array<float,2>{0.0116612921f, 0.799512386f},
-std::array<float,2>{0.973329186f, 0.321276307f},
-std::array<float,2>{0.478217751f, 0.158975273f},
-std::array<float,2>{0.598623455f, 0.576528072f},
-std::array<float,2>{0.166625425f, 0.555148959f},
-std::array<float,2>{0.858838499f, 0.240013704f},
-std::array<float,2>{0.25528565f, 0.298624873f},
-std::array<float,2>{0.737385988f, 0.857384503f},
-std::array<float,2>{0.432516724f, 0.940064311f},
-std::array<float,2>{0.548036158f, 0.452458858f},
-std::array<float,2>{0.0717185587f, 0.0445263349f},
-std::array<float,2>{0.934774578f, 0.730285704f},
-std::array<float,2>{0.450337946f, 0.596838117f},
-std::array<float,2>{0.573733985f, 0.141373038f},
-std::array<float,2>{0.0509634428f, 0.368543833f},
-std::array<float,2>{0.968161583f, 0.768600523f},
-std::array<float,2>{0.236457467f, 0.903809309f},
-std::array<float,2>{0.768525839f, 0.393279076f},
-std::array<float,2>{0.338458031f, 0.0727080777f},
-std::array<float,2>{0.634228945f, 0.677856743f},
-std::array<float,2>{0.118471757f, 0.69352603f},
-std::array<float,2>{0.90559715f, 0.00949868094f},
-std::array<float,2>{0.400106162f, 0.469782859f},
-std::array<float,2>{0.518430293f, 0.979292452f},
-std::array<float,2>{0.308977067f, 0.841794789f},
-std::array<float,2>{0.696980774f, 0.2714912f},
-std::array<float,2>{0.136386484f, 0.198882416f},
-std::array<float,2>{0.831043601f, 0.517698944f},
-std::array<float,2>{0.340769738f, 0.532123804f},
-std::array<float,2>{0.638175011f, 0.22401616f},
-std::array<float,2>{0.23979345f, 0.284111857f},
-std::array<float,2>{0.77145046f, 0.860794365f},
-std::array<float,2>{0.0487903208f, 0.956589222f},
-std::array<float,2>{0.964774013f, 0.463480473f},
-std::array<float,2>{0.445405602f, 0.0499912873f},
-std::array<float,2>{0.57486099f, 0.745243311f},
-std::array<float,2>{0.139369518f, 0.651589096f},
-std::array<float,2>{0.834219515f, 0.0976553485f},
-std::array<float,2>{0.30604732f, 0.407217771f},
-std::array<float,2>{0.701191723f, 0.929806888f},
-std::array<float,2>{0.406240106f, 0.782043517f},
-std::array<float,2>{0.522703171f, 0.341930211f},
-std::array<float,2>{0.122784346f, 0.18458204f},
-std::array<float,2>{0.901304841f, 0.579436481f},
-std::array<float,2>{0.482232243f, 0.71793586f},
-std::array<float,2>{0.594673812f, 0.0238352437f},
-std::array<float,2>{0.0127539663f, 0.49852863f},
-std::array<float,2>{0.971278548f, 0.990211427f},
-std::array<float,2>{0.215662584f, 0.817996919f},
-std::array<float,2>{0.812406659f, 0.26255396f},
-std::array<float,2>{0.369847119f, 0.212081075f},
-std::array<float,2>{0.663671255f, 0.502579033f},
-std::array<float,2>{0.0778612867f, 0.616199255f},
-std::array<float,2>{0.932222009f, 0.13570407f},
-std::array<float,2>{0.436091423f, 0.34488529f},
-std::array<float,2>{0.5513345f, 0.754446208f},
-std::array<float,2>{0.253846526f, 0.890456676f},
-std::array<float,2>{0.741030693f, 0.386024028f},
-std::array<float,2>{0.169182524f, 0.0893036276f},
-std::array<float,2>{0.852714956f, 0.665589988f},
-std::array<float,2>{0.293439358f, 0.68405354f},
-std::array<float,2>{0.717341542f, 0.0628084317f},
-std::array<float,2>{0.155359313f, 0.402436227f},
-std::array<float,2>{0.822654426f, 0.895238638f},
-std::array<float,2>{0.0997274891f, 0.777533889f},
-std::array<float,2>{0.890489697f, 0.360082537f},
-std::array<float,2>{0.379495919f, 0.151651293f},
-std::array<float,2>{0.512018263f, 0.601653099f},
-std::array<float,2>{0.219496846f, 0.52766484f},
-std::array<float,2>{0.762057662f, 0.189019203f},
-std::array<float,2>{0.320223749f, 0.276980519f},
-std::array<float,2>{0.651280224f, 0.830849528f},
-std::array<float,2>{0.454583287f, 0.975449681f},
-std::array<float,2>{0.580524802f, 0.476718336f},
-std::array<float,2>{0.0379072465f, 0.00467867684f},
-std::array<float,2>{0.942598581f, 0.702848792f},
-std::array<float,2>{0.419620931f, 0.564165115f},
-std::array<float,2>{0.545429528f, 0.1681097f},
-std::array<float,2>{0.0875704288f, 0.317222387f},
-std::array<float,2>{0.920504153f, 0.804764271f},
-std::array<float,2>{0.174692854f, 0.918586373f},
-std::array<float,2>{0.867712021f, 0.42887345f},
-std::array<float,2>{0.28060618f, 0.110730872f},
-std::array<float,2>{0.730282068f, 0.63928622f},
-std::array<float,2>{0.0284450911f, 0.724954963f},
-std::array<float,2>{0.986639023f, 0.0382511429f},
-std::array<float,2>{0.494980782f, 0.445056975f},
-std::array<float,2>{0.619109392f, 0.951249897f},
-std::array<float,2>{0.351772457f, 0.850752592f},
-std::array<float,2>{0.676234663f, 0.307792425f},
-std::array<float,2>{0.201179311f, 0.247483656f},
-std::array<float,2>{0.795640171f, 0.551437259f},
-std::array<float,2>{0.272940606f, 0.599200308f},
-std::array<float,2>{0.721357465f, 0.148286372f},
-std::array<float,2>{0.185499728f, 0.372416347f},
-std::array<float,2>{0.866414189f, 0.769795597f},
-std::array<float,2>{0.0827246904f, 0.89999491f},
-std::array<float,2>{0.909288168f, 0.398236662f},
-std::array<float,2>{0.412102401f, 0.0764913186f},
-std::array<float,2>{0.533484221f, 0.673428059f},
-std::array<float,2>{0.194943354f, 0.68934983f},
-std::array<float,2>{0.782926857f, 0.0151041336f},
-std::array<float,2>{0.350437075f, 0.474697024f},
-std::array<float,2>{0.68629235f, 0.983054459f},
-std::array<float,2>{0.484421849f, 0.83923161f},
-std::array<float,2>{0.614955246f, 0.268781543f},
-std::array<float,2>{0.0222464204f, 0.200702712f},
-std::array<float,2>{0.996284962f, 0.520412982f},
-std::array<float,2>{0.386262983f, 0.626859784f},
-std::array<float,2>{0.502375007f, 0.123293899f},
-std::array<float,2>{0.103556797f, 0.430964261f},
-std::array<float,2>{0.877061188f, 0.911833823f},
-std::array<float,2>{0.141082153f, 0.804059565f},
-std::array<float,2>{0.816900313f, 0.326803386f},
-std::array<float,2>{0.288335025f, 0.1604096f},
-std::array<float,2>{0.707470357f, 0.574030638f},
-std::array<float,2>{0.0464958549f, 0.559106588f},
-std::array<float,2>{0.949775159f, 0.237032041f},
-std::array<float,2>{0.463558793f, 0.302715302f},
-std::array<float,2>{0.591205597f, 0.852544129f},
-std::array<float,2>{0.324761122f, 0.942114472f},
-std::array<float,2>{0.645014107f, 0.447478384f},
-std::array<float,2>{0.233631536f, 0.0402718186f},
-std::array<float,2>{0.755143881f, 0.734366179f},
-std::array<float,2>{0.364837229f, 0.73692143f},
-std::array<float,2>{0.671777844f, 0.0589887872f},
-std::array<float,2>{0.204278961f, 0.454782188f},
-std::array<float,2>{0.79753381f, 0.967851043f},
-std::array<float,2>{0.00536757335f, 0.874600053f},
-std::array<float,2>{0.981305361f, 0.296574861f},
-std::array<float,2>{0.473833799f, 0.229701191f},
-std::array<float,2>{0.603356719f, 0.541847646f},
-std::array<float,2>{0.159051657f, 0.587973058f},
-std::array<float,2>{0.849598587f, 0.172447816f},
-std::array<float,2>{0.264562547f, 0.335075349f},
-std::array<float,2>{0.748576343f, 0.790869117f},
-std::array<float,2>{0.422859728f, 0.927702069f},
-std::array<float,2>{0.555895686f, 0.419378072f},
-std::array<float,2>{0.0658304691f, 0.103446364f},
-std::array<float,2>{0.929092288f, 0.644350886f},
-std::array<float,2>{0.438860804f, 0.515415311f},
-std::array<float,2>{0.57001555f, 0.204532847f},
-std::array<float,2>{0.0567051359f, 0.25599134f},
-std::array<float,2>{0.957269669f, 0.824936211f},
-std::array<float,2>{0.248638541f, 0.996508598f},
-std::array<float,2>{0.776044846f, 0.490044802f},
-std::array<float,2>{0.332657188f, 0.0186589863f},
-std::array<float,2>{0.625739574f, 0.708916306f},
-std::array<float,2>{0.109520026f, 0.657485962f},
-std::array<float,2>{0.896574616f, 0.08398287f},
-std::array<float,2>{0.397405714f, 0.378904581f},
-std::array<float,2>{0.528416097f, 0.880653143f},
-std::array<float,2>{0.302774817f, 0.758480549f},
-std::array<float,2>{0.687816679f, 0.358051419f},
-std::array<float,2>{0.129329771f, 0.131566808f},
-std::array<float,2>{0.841272116f, 0.624861121f},
-std::array<float,2>{0.343850046f, 0.585541666f},
-std::array<float,2>{0.680634975f, 0.180258051f},
-std::array<float,2>{0.189839199f, 0.337509274f},
-std::array<float,2>{0.787530899f, 0.786703587f},
-std::array<float,2>{0.0185260065f, 0.936869979f},
-std::array<float,2>{0.995511293f, 0.410217345f},
-std::array<float,2>{0.491677463f, 0.0978701711f},
-std::array<float,2>{0.610405564f, 0.65556854f},
-std::array<float,2>{0.182997435f, 0.747397959f},
-std::array<float,2>{0.863231957f, 0.0522835255f},
-std::array<float,2>{0.267760575f, 0.46694082f},
-std::array<float,2>{0.724760056f, 0.957980275f},
-std::array<float,2>{0.409329683f, 0.866621196f},
-std::array<float,2>{0.535591722f, 0.289037168f},
-std::array<float,2>{0.0787503421f, 0.219274893f},
-std::array<float,2>{0.911289394f, 0.538047612f},
-std::array<float,2>{0.465536743f, 0.670042515f},
-std::array<float,2>{0.589326262f, 0.0934499428f},
-std::array<float,2>{0.0420989506f, 0.38703227f},
-std::array<float,2>{0.948643744f, 0.886128247f},
-std::array<float,2>{0.226727054f, 0.751609862f},
-std::array<float,2>{0.750325918f, 0.35048452f},
-std::array<float,2>{0.321208715f, 0.139888957f},
-std::array<float,2>{0.641828299f, 0.610381424f},
-std::array<float,2>{0.106614739f, 0.507576764f},
-std::array<float,2>{0.88071686f, 0.218513161f},
-std::array<float,2>{0.388162076f, 0.258241296f},
-std::array<float,2>{0.506620824f, 0.813103437f},
-std::array<float,2>{0.282286078f, 0.987888753f},
-std::array<float,2>{0.704602897f, 0.495835274f},
-std::array<float,2>{0.146512643f, 0.0274912734f},
-std::array<float,2>{0.812504947f, 0.714813948f},
-std::array<float,2>{0.258650094f, 0.697296441f},
-std::array<float,2>{0.74279809f, 0.00224271929f},
-std::array<float,2>{0.163403004f, 0.482865214f},
-std::array<float,2>{0.847628117f, 0.972639084f},
-std::array<float,2>{0.0699745491f, 0.833639622f},
-std::array<float,2>{0.922965944f, 0.281199068f},
-std::array<float,2>{0.429633737f, 0.194519043f},
-std::array<float,2>{0.559782326f, 0.527164936f},
-std::array<float,2>{0.207869858f, 0.609279513f},
-std::array<float,2>{0.801742375f, 0.154919982f},
-std::array<float,2>{0.362581968f, 0.363403767f},
-std::array<float,2>{0.667537987f, 0.776853383f},
-std::array<float,2>{0.472555757f, 0.891641021f},
-std::array<float,2>{0.607156396f, 0.399775207f},
-std::array<float,2>{0.00268616457f, 0.0668162256f},
-std::array<float,2>{0.978378475f, 0.680015504f},
-std::array<float,2>{0.391342998f, 0.550457358f},
-std::array<float,2>{0.525579929f, 0.243923232f},
-std::array<float,2>{0.115908809f, 0.310157537f},
-std::array<float,2>{0.892229557f, 0.845793426f},
-std::array<float,2>{0.128383264f, 0.948900342f},
-std::array<float,2>{0.839120567f, 0.440273553f},
-std::array<float,2>{0.298547477f, 0.0338897258f},
-std::array<float,2>{0.691981494f, 0.718949437f},
-std::array<float,2>{0.0606503375f, 0.634649217f},
-std::array<float,2>{0.955073237f, 0.115353495f},
-std::array<float,2>{0.443583757f, 0.422271281f},
-std::array<float,2>{0.565360725f, 0.915574551f},
-std::array<float,2>{0.32938388f, 0.810094416f},
-std::array<float,2>{0.631620944f, 0.316162318f},
-std::array<float,2>{0.244197652f, 0.167865142f},
-std::array<float,2>{0.779221416f, 0.567469478f},
-std::array<float,2>{0.310726136f, 0.519354761f},
-std::array<float,2>{0.698145866f, 0.197603807f},
-std::array<float,2>{0.134375528f, 0.273427844f},
-std::array<float,2>{0.829900503f, 0.840473473f},
-std::array<float,2>{0.120434001f, 0.980430245f},
-std::array<float,2>{0.903961957f, 0.469007045f},
-std::array<float,2>{0.401889712f, 0.00814746879f},
-std::array<float,2>{0.516416073f, 0.694904923f},
-std::array<float,2>{0.23465246f, 0.678756893f},
-std::array<float,2>{0.766110241f, 0.0740350485f},
-std::array<float,2>{0.336704463f, 0.394373149f},
-std::array<float,2>{0.635681927f, 0.902872026f},
-std::array<float,2>{0.45227316f, 0.76817143f},
-std::array<float,2>{0.5706442f, 0.368163705f},
-std::array<float,2>{0.0545976907f, 0.141694948f},
-std::array<float,2>{0.965699196f, 0.595797241f},
-std::array<float,2>{0.430144817f, 0.728923857f},
-std::array<float,2>{0.550212324f, 0.0437321998f},
-std::array<float,2>{0.0727824867f, 0.451729327f},
-std::array<float,2>{0.935864508f, 0.941371977f},
-std::array<float,2>{0.164452136f, 0.855682969f},
-std::array<float,2>{0.856895268f, 0.297483504f},
-std::array<float,2>{0.255989552f, 0.239012301f},
-std::array<float,2>{0.734886527f, 0.555859149f},
-std::array<float,2>{0.00840790849f, 0.57790035f},
-std::array<float,2>{0.975652039f, 0.159778073f},
-std::array<float,2>{0.479204386f, 0.321664602f},
-std::array<float,2>{0.601168573f, 0.800620019f},
-std::array<float,2>{0.373560786f, 0.908673704f},
-std::array<float,2>{0.659399152f, 0.433664948f},
-std::array<float,2>{0.213775948f, 0.119691975f},
-std::array<float,2>{0.805465877f, 0.629507184f},
-std::array<float,2>{0.315085828f, 0.645374f},
-std::array<float,2>{0.653985858f, 0.109213173f},
-std::array<float,2>{0.226384938f, 0.417348683f},
-std::array<float,2>{0.761338055f, 0.92575711f},
-std::array<float,2>{0.032595396f, 0.79486984f},
-std::array<float,2>{0.941104233f, 0.330235183f},
-std::array<float,2>{0.459701061f, 0.176284775f},
-std::array<float,2>{0.585212946f, 0.593524277f},
-std::array<float,2>{0.151528448f, 0.544169664f},
-std::array<float,2>{0.827840269f, 0.232000887f},
-std::array<float,2>{0.292590439f, 0.289205253f},
-std::array<float,2>{0.714684665f, 0.868314028f},
-std::array<float,2>{0.376069665f, 0.962774694f},
-std::array<float,2>{0.507885337f, 0.460780919f},
-std::array<float,2>{0.0938265324f, 0.0560921617f},
-std::array<float,2>{0.885693312f, 0.741501629f},
-std::array<float,2>{0.497373283f, 0.618771851f},
-std::array<float,2>{0.621116996f, 0.127989829f},
-std::array<float,2>{0.0242412612f, 0.354882807f},
-std::array<float,2>{0.991365433f, 0.763943255f},
-std::array<float,2>{0.198582113f, 0.877586842f},
-std::array<float,2>{0.790002823f, 0.382032305f},
-std::array<float,2>{0.355536669f, 0.0790487379f},
-std::array<float,2>{0.674246907f, 0.661176562f},
-std::array<float,2>{0.0922679156f, 0.706921995f},
-std::array<float,2>{0.91593045f, 0.0226913579f},
-std::array<float,2>{0.415558875f, 0.48745954f},
-std::array<float,2>{0.542858779f, 0.995966613f},
-std::array<float,2>{0.274209172f, 0.821284592f},
-std::array<float,2>{0.73255229f, 0.252003223f},
-std::array<float,2>{0.178105384f, 0.210208073f},
-std::array<float,2>{0.871659696f, 0.508987665f},
-std::array<float,2>{0.368877083f, 0.501705647f},
-std::array<float,2>{0.661913216f, 0.214170143f},
-std::array<float,2>{0.217840597f, 0.264309824f},
-std::array<float,2>{0.809400976f, 0.819700718f},
-std::array<float,2>{0.0151731241f, 0.991874874f},
-std::array<float,2>{0.970672667f, 0.496855229f},
-std::array<float,2>{0.483876973f, 0.027203517f},
-std::array<float,2>{0.596832991f, 0.716377437f},
-std::array<float,2>{0.170713961f, 0.667025328f},
-std::array<float,2>{0.854202986f, 0.0871789232f},
-std::array<float,2>{0.251318336f, 0.383054644f},
-std::array<float,2>{0.739352286f, 0.887740195f},
-std::array<float,2>{0.435023516f, 0.757720172f},
-std::array<float,2>{0.55349648f, 0.34637022f},
-std::array<float,2>{0.0752714872f, 0.13423498f},
-std::array<float,2>{0.931021988f, 0.614050686f},
-std::array<float,2>{0.448846698f, 0.743970215f},
-std::array<float,2>{0.57758975f, 0.0469914675f},
-std::array<float,2>{0.0488767363f, 0.461018741f},
-std::array<float,2>{0.961226821f, 0.954045951f},
-std::array<float,2>{0.240763471f, 0.862718463f},
-std::array<float,2>{0.77312386f, 0.281651199f},
-std::array<float,2>{0.342826813f, 0.225955278f},
-std::array<float,2>{0.63990587f, 0.534328341f},
-std::array<float,2>{0.123159818f, 0.581566751f},
-std::array<float,2>{0.898908854f, 0.186206505f},
-std::array<float,2>{0.403669f, 0.341598868f},
-std::array<float,2>{0.521202266f, 0.783936679f},
-std::array<float,2>{0.30817467f, 0.933358431f},
-std::array<float,2>{0.699237943f, 0.408956975f},
-std::array<float,2>{0.137990236f, 0.0944422632f},
-std::array<float,2>{0.832208514f, 0.65020746f},
-std::array<float,2>{0.278544486f, 0.637198031f},
-std::array<float,2>{0.72747612f, 0.112268813f},
-std::array<float,2>{0.172361985f, 0.42734158f},
-std::array<float,2>{0.869298398f, 0.920687377f},
-std::array<float,2>{0.0895180851f, 0.808589756f},
-std::array<float,2>{0.919093728f, 0.318672746f},
-std::array<float,2>{0.421380103f, 0.170197412f},
-std::array<float,2>{0.543157458f, 0.565288484f},
-std::array<float,2>{0.200712994f, 0.55274868f},
-std::array<float,2>{0.793215096f, 0.249570593f},
-std::array<float,2>{0.354149908f, 0.305802941f},
-std::array<float,2>{0.678231895f, 0.847949564f},
-std::array<float,2>{0.493990809f, 0.949589133f},
-std::array<float,2>{0.619476318f, 0.442571104f},
-std::array<float,2>{0.0295290742f, 0.0353873149f},
-std::array<float,2>{0.984831691f, 0.723355412f},
-std::array<float,2>{0.381388754f, 0.604634166f},
-std::array<float,2>{0.515185535f, 0.148550287f},
-std::array<float,2>{0.0977850258f, 0.362421066f},
-std::array<float,2>{0.887051165f, 0.780204654f},
-std::array<float,2>{0.153970838f, 0.896729946f},
-std::array<float,2>{0.820864081f, 0.405821174f},
-std::array<float,2>{0.296210259f, 0.065197058f},
-std::array<float,2>{0.715190411f, 0.685967565f},
-std::array<float,2>{0.0357298478f, 0.699261308f},
-std::array<float,2>{0.944704294f, 0.00620172592f},
-std::array<float,2>{0.456151128f, 0.480454892f},
-std::array<float,2>{0.57826817f, 0.973155558f},
-std::array<float,2>{0.31805703f, 0.828904033f},
-std::array<float,2>{0.650315404f, 0.274375916f},
-std::array<float,2>{0.222401232f, 0.190743566f},
-std::array<float,2>{0.764746249f, 0.530385256f},
-std::array<float,2>{0.286407202f, 0.570849001f},
-std::array<float,2>{0.709733844f, 0.162754819f},
-std::array<float,2>{0.143769994f, 0.325600892f},
-std::array<float,2>{0.819222987f, 0.802237332f},
-std::array<float,2>{0.102400184f, 0.912532628f},
-std::array<float,2>{0.875996113f, 0.432111561f},
-std::array<float,2>{0.383538157f, 0.121540941f},
-std::array<float,2>{0.50174576f, 0.628693998f},
-std::array<float,2>{0.231372595f, 0.730512977f},
-std::array<float,2>{0.756729662f, 0.0425069481f},
-std::array<float,2>{0.326196074f, 0.44552207f},
-std::array<float,2>{0.648219705f, 0.943584442f},
-std::array<float,2>{0.461360872f, 0.853786886f},
-std::array<float,2>{0.593666017f, 0.302999139f},
-std::array<float,2>{0.0448984355f, 0.235275805f},
-std::array<float,2>{0.951426387f, 0.560815275f},
-std::array<float,2>{0.412782133f, 0.674420595f},
-std::array<float,2>{0.53128624f, 0.0752374455f},
-std::array<float,2>{0.0845533982f, 0.396351457f},
-std::array<float,2>{0.90641427f, 0.902144611f},
-std::array<float,2>{0.187108293f, 0.771557271f},
-std::array<float,2>{0.864237428f, 0.374233216f},
-std::array<float,2>{0.270090967f, 0.145288959f},
-std::array<float,2>{0.719394207f, 0.599743426f},
-std::array<float,2>{0.0200135298f, 0.522547185f},
-std::array<float,2>{0.998237133f, 0.202191547f},
-std::array<float,2>{0.486436039f, 0.267412752f},
-std::array<float,2>{0.616053164f, 0.836167157f},
-std::array<float,2>{0.348216861f, 0.981448412f},
-std::array<float,2>{0.685167193f, 0.473608017f},
-std::array<float,2>{0.191890046f, 0.0125662135f},
-std::array<float,2>{0.785064578f, 0.68982935f},
-std::array<float,2>{0.335400164f, 0.70978421f},
-std::array<float,2>{0.628388345f, 0.0159399323f},
-std::array<float,2>{0.247234866f, 0.490378469f},
-std::array<float,2>{0.77429074f, 0.998361647f},
-std::array<float,2>{0.0563282073f, 0.828004181f},
-std::array<float,2>{0.960013092f, 0.254779369f},
-std::array<float,2>{0.439729631f, 0.205158412f},
-std::array<float,2>{0.567672431f, 0.513200343f},
-std::array<float,2>{0.132231101f, 0.622821629f},
-std::array<float,2>{0.842683792f, 0.129286781f},
-std::array<float,2>{0.301348925f, 0.356812537f},
-std::array<float,2>{0.690612257f, 0.760780573f},
-std::array<float,2>{0.395786405f, 0.882598341f},
-std::array<float,2>{0.531235874f, 0.376588345f},
-std::array<float,2>{0.112744614f, 0.0846058577f},
-std::array<float,2>{0.895116806f, 0.658442378f},
-std::array<float,2>{0.47627762f, 0.539241731f},
-std::array<float,2>{0.603943169f, 0.2281259f},
-std::array<float,2>{0.00631160988f, 0.29358387f},
-std::array<float,2>{0.983516276f, 0.872384429f},
-std::array<float,2>{0.205981895f, 0.965144992f},
-std::array<float,2>{0.799231112f, 0.455771416f},
-std::array<float,2>{0.367179841f, 0.0606418736f},
-std::array<float,2>{0.668722868f, 0.735950708f},
-std::array<float,2>{0.063468121f, 0.642131031f},
-std::array<float,2>{0.925951242f, 0.104245409f},
-std::array<float,2>{0.425753593f, 0.420010179f},
-std::array<float,2>{0.557780862f, 0.928038716f},
-std::array<float,2>{0.262603641f, 0.79117763f},
-std::array<float,2>{0.746332109f, 0.333175451f},
-std::array<float,2>{0.157692716f, 0.175529972f},
-std::array<float,2>{0.850338519f, 0.586805046f},
-std::array<float,2>{0.324176848f, 0.612716913f},
-std::array<float,2>{0.643231392f, 0.138000414f},
-std::array<float,2>{0.229138538f, 0.34950918f},
-std::array<float,2>{0.752356112f, 0.75334084f},
-std::array<float,2>{0.0399801582f, 0.883542955f},
-std::array<float,2>{0.945669234f, 0.389007717f},
-std::array<float,2>{0.467140377f, 0.0902693942f},
-std::array<float,2>{0.586268365f, 0.669510245f},
-std::array<float,2>{0.146460369f, 0.712657869f},
-std::array<float,2>{0.815721452f, 0.0303933378f},
-std::array<float,2>{0.283992559f, 0.492329031f},
-std::array<float,2>{0.705606699f, 0.986073613f},
-std::array<float,2>{0.388698399f, 0.814866245f},
-std::array<float,2>{0.505225062f, 0.260549873f},
-std::array<float,2>{0.107816786f, 0.215251893f},
-std::array<float,2>{0.880862772f, 0.504052579f},
-std::array<float,2>{0.489432573f, 0.652436316f},
-std::array<float,2>{0.611715555f, 0.100913525f},
-std::array<float,2>{0.0156294201f, 0.412581027f},
-std::array<float,2>{0.993237853f, 0.933854938f},
-std::array<float,2>{0.188950449f, 0.788996756f},
-std::array<float,2>{0.787023902f, 0.338137418f},
-std::array<float,2>{0.346097499f, 0.183087572f},
-std::array<float,2>{0.682516158f, 0.58247745f},
-std::array<float,2>{0.0801650509f, 0.536333621f},
-std::array<float,2>{0.912876308f, 0.221091971f},
-std::array<float,2>{0.407740146f, 0.286519319f},
-std::array<float,2>{0.538072467f, 0.86422044f},
-std::array<float,2>{0.266017318f, 0.96034807f},
-std::array<float,2>{0.724596679f, 0.466178805f},
-std::array<float,2>{0.180689946f, 0.0535015203f},
-std::array<float,2>{0.860355914f, 0.748496175f},
-std::array<float,2>{0.300137311f, 0.721516609f},
-std::array<float,2>{0.694394648f, 0.0317817591f},
-std::array<float,2>{0.125856042f, 0.43818754f},
-std::array<float,2>{0.837172866f, 0.946418464f},
-std::array<float,2>{0.115202166f, 0.844445467f},
-std::array<float,2>{0.894483268f, 0.310728401f},
-std::array<float,2>{0.393949389f, 0.244702831f},
-std::array<float,2>{0.52533555f, 0.547081172f},
-std::array<float,2>{0.244109333f, 0.56994462f},
-std::array<float,2>{0.781221807f, 0.164788336f},
-std::array<float,2>{0.3315804f, 0.31375894f},
-std::array<float,2>{0.630149603f, 0.812032342f},
-std::array<float,2>{0.442454159f, 0.91733855f},
-std::array<float,2>{0.564133465f, 0.425036937f},
-std::array<float,2>{0.0601285473f, 0.113570102f},
-std::array<float,2>{0.956481457f, 0.635283887f},
-std::array<float,2>{0.427563846f, 0.525001466f},
-std::array<float,2>{0.56106168f, 0.192732945f},
-std::array<float,2>{0.0683116913f, 0.277771056f},
-std::array<float,2>{0.925704598f, 0.835527062f},
-std::array<float,2>{0.160414532f, 0.969872236f},
-std::array<float,2>{0.843995094f, 0.480641872f},
-std::array<float,2>{0.26049608f, 0.00102827291f},
-std::array<float,2>{0.745858848f, 0.696792662f},
-std::array<float,2>{0.000588109775f, 0.682520151f},
-std::array<float,2>{0.978844166f, 0.0697593018f},
-std::array<float,2>{0.469732791f, 0.400908649f},
-std::array<float,2>{0.609311521f, 0.892963469f},
-std::array<float,2>{0.360823959f, 0.774800777f},
-std::array<float,2>{0.665643573f, 0.36525467f},
-std::array<float,2>{0.210703224f, 0.152909353f},
-std::array<float,2>{0.803162634f, 0.605652213f},
-std::array<float,2>{0.254475713f, 0.557789505f},
-std::array<float,2>{0.736820698f, 0.241142169f},
-std::array<float,2>{0.167136416f, 0.29886508f},
-std::array<float,2>{0.858045399f, 0.859071314f},
-std::array<float,2>{0.070785284f, 0.938437998f},
-std::array<float,2>{0.934306264f, 0.45083636f},
-std::array<float,2>{0.433065623f, 0.0456347428f},
-std::array<float,2>{0.547306418f, 0.726969004f},
-std::array<float,2>{0.212482244f, 0.632364333f},
-std::array<float,2>{0.807859004f, 0.11736472f},
-std::array<float,2>{0.371415943f, 0.436221391f},
-std::array<float,2>{0.656531215f, 0.907434464f},
-std::array<float,2>{0.476699054f, 0.797324121f},
-std::array<float,2>{0.598680437f, 0.323730797f},
-std::array<float,2>{0.00991632417f, 0.156794146f},
-std::array<float,2>{0.973729551f, 0.57486105f},
-std::array<float,2>{0.399031401f, 0.693357706f},
-std::array<float,2>{0.518963158f, 0.0113814827f},
-std::array<float,2>{0.117847413f, 0.470762014f},
-std::array<float,2>{0.905052483f, 0.977443278f},
-std::array<float,2>{0.135470942f, 0.843049347f},
-std::array<float,2>{0.831775486f, 0.270572305f},
-std::array<float,2>{0.309659243f, 0.196115524f},
-std::array<float,2>{0.696008861f, 0.516942918f},
-std::array<float,2>{0.0521111302f, 0.594682813f},
-std::array<float,2>{0.967474759f, 0.144048303f},
-std::array<float,2>{0.450194508f, 0.369515061f},
-std::array<float,2>{0.572701514f, 0.766297936f},
-std::array<float,2>{0.339530021f, 0.904517889f},
-std::array<float,2>{0.63282603f, 0.39239648f},
-std::array<float,2>{0.237675026f, 0.0708203465f},
-std::array<float,2>{0.769240797f, 0.676288903f},
-std::array<float,2>{0.357781142f, 0.663513362f},
-std::array<float,2>{0.673118174f, 0.0802678987f},
-std::array<float,2>{0.195454732f, 0.380390167f},
-std::array<float,2>{0.791077137f, 0.876197636f},
-std::array<float,2>{0.0261857081f, 0.761748195f},
-std::array<float,2>{0.989473164f, 0.352285683f},
-std::array<float,2>{0.498804867f, 0.126688436f},
-std::array<float,2>{0.623584628f, 0.619649053f},
-std::array<float,2>{0.176582143f, 0.51107049f},
-std::array<float,2>{0.874622703f, 0.208841756f},
-std::array<float,2>{0.276172996f, 0.250323892f},
-std::array<float,2>{0.731181741f, 0.824190259f},
-std::array<float,2>{0.417865068f, 0.99408412f},
-std::array<float,2>{0.539619803f, 0.48573792f},
-std::array<float,2>{0.0902079865f, 0.019627668f},
-std::array<float,2>{0.916027725f, 0.704573035f},
-std::array<float,2>{0.458495647f, 0.59120208f},
-std::array<float,2>{0.582337797f, 0.179078773f},
-std::array<float,2>{0.0338930078f, 0.328798473f},
-std::array<float,2>{0.937661886f, 0.796831548f},
-std::array<float,2>{0.222817317f, 0.922593355f},
-std::array<float,2>{0.759634137f, 0.41446054f},
-std::array<float,2>{0.314069748f, 0.107316211f},
-std::array<float,2>{0.654814065f, 0.647788167f},
-std::array<float,2>{0.0974362418f, 0.739676595f},
-std::array<float,2>{0.883187532f, 0.0584874898f},
-std::array<float,2>{0.377410531f, 0.457087845f},
-std::array<float,2>{0.511433244f, 0.963270128f},
-std::array<float,2>{0.289622337f, 0.869333804f},
-std::array<float,2>{0.71277523f, 0.292053044f},
-std::array<float,2>{0.149364084f, 0.232920364f},
-std::array<float,2>{0.825443447f, 0.546283782f},
-std::array<float,2>{0.332485527f, 0.51282537f},
-std::array<float,2>{0.625341237f, 0.205883041f},
-std::array<float,2>{0.248461947f, 0.254222989f},
-std::array<float,2>{0.775815666f, 0.827177286f},
-std::array<float,2>{0.0572062135f, 0.998879552f},
-std::array<float,2>{0.957892418f, 0.490912199f},
-std::array<float,2>{0.439130932f, 0.0163126551f},
-std::array<float,2>{0.569373786f, 0.709140778f},
-std::array<float,2>{0.129810557f, 0.658856273f},
-std::array<float,2>{0.84156853f, 0.0842998102f},
-std::array<float,2>{0.303537071f, 0.376198143f},
-std::array<float,2>{0.688091576f, 0.882310271f},
-std::array<float,2>{0.396672934f, 0.761293888f},
-std::array<float,2>{0.528823972f, 0.357151598f},
-std::array<float,2>{0.110325225f, 0.129421949f},
-std::array<float,2>{0.897179127f, 0.6221174f},
-std::array<float,2>{0.474403948f, 0.735706687f},
-std::array<float,2>{0.602588713f, 0.0613891482f},
-std::array<float,2>{0.00546962349f, 0.455389291f},
-std::array<float,2>{0.980915546f, 0.965709507f},
-std::array<float,2>{0.204945669f, 0.872686684f},
-std::array<float,2>{0.797214866f, 0.293221444f},
-std::array<float,2>{0.364367098f, 0.227970585f},
-std::array<float,2>{0.671285331f, 0.539595187f},
-std::array<float,2>{0.0661131814f, 0.586025715f},
-std::array<float,2>{0.929677606f, 0.175017253f},
-std::array<float,2>{0.423676133f, 0.333780527f},
-std::array<float,2>{0.556517124f, 0.7916435f},
-std::array<float,2>{0.26395008f, 0.928444028f},
-std::array<float,2>{0.748170972f, 0.42081219f},
-std::array<float,2>{0.158332929f, 0.103575781f},
-std::array<float,2>{0.848707378f, 0.641979694f},
-std::array<float,2>{0.288862944f, 0.628051102f},
-std::array<float,2>{0.707877934f, 0.121601373f},
-std::array<float,2>{0.141182348f, 0.432540298f},
-std::array<float,2>{0.816467166f, 0.912750244f},
-std::array<float,2>{0.10432291f, 0.802676797f},
-std::array<float,2>{0.877893746f, 0.325957388f},
-std::array<float,2>{0.385824054f, 0.162503734f},
-std::array<float,2>{0.502845347f, 0.570410967f},
-std::array<float,2>{0.234169573f, 0.561493993f},
-std::array<float,2>{0.75562191f, 0.234382257f},
-std::array<float,2>{0.324587375f, 0.303492665f},
-std::array<float,2>{0.645129621f, 0.854369402f},
-std::array<float,2>{0.462905556f, 0.944176197f},
-std::array<float,2>{0.591631472f, 0.445828915f},
-std::array<float,2>{0.0460437946f, 0.0422334671f},
-std::array<float,2>{0.949657917f, 0.731318712f},
-std::array<float,2>{0.411535352f, 0.600503445f},
-std::array<float,2>{0.53378129f, 0.144730955f},
-std::array<float,2>{0.0824784935f, 0.374541163f},
-std::array<float,2>{0.909889102f, 0.772144198f},
-std::array<float,2>{0.184961602f, 0.90174222f},
-std::array<float,2>{0.86707747f, 0.395975441f},
-std::array<float,2>{0.273263693f, 0.0758197829f},
-std::array<float,2>{0.721134901f, 0.673909128f},
-std::array<float,2>{0.0215209927f, 0.69024533f},
-std::array<float,2>{0.9968701f, 0.0117320493f},
-std::array<float,2>{0.485171646f, 0.473120153f},
-std::array<float,2>{0.614594817f, 0.982013464f},
-std::array<float,2>{0.349880993f, 0.83668381f},
-std::array<float,2>{0.685999155f, 0.266642421f},
-std::array<float,2>{0.194518223f, 0.202657744f},
-std::array<float,2>{0.782283127f, 0.522962391f},
-std::array<float,2>{0.280954003f, 0.564831436f},
-std::array<float,2>{0.729590476f, 0.170888379f},
-std::array<float,2>{0.174260214f, 0.318990588f},
-std::array<float,2>{0.867241919f, 0.807786405f},
-std::array<float,2>{0.0871027485f, 0.920080066f},
-std::array<float,2>{0.920405388f, 0.42694214f},
-std::array<float,2>{0.419110894f, 0.111347437f},
-std::array<float,2>{0.54523629f, 0.637546539f},
-std::array<float,2>{0.201702923f, 0.722846329f},
-std::array<float,2>{0.795281708f, 0.0356571376f},
-std::array<float,2>{0.352488339f, 0.443059325f},
-std::array<float,2>{0.67659694f, 0.949765742f},
-std::array<float,2>{0.494367361f, 0.848537982f},
-std::array<float,2>{0.618395507f, 0.306318164f},
-std::array<float,2>{0.0290859565f, 0.249141976f},
-std::array<float,2>{0.987206817f, 0.553653598f},
-std::array<float,2>{0.379027367f, 0.686074495f},
-std::array<float,2>{0.512486577f, 0.0647269785f},
-std::array<float,2>{0.100578249f, 0.405718744f},
-std::array<float,2>{0.88965261f, 0.897182286f},
-std::array<float,2>{0.155793905f, 0.779328704f},
-std::array<float,2>{0.822846472f, 0.363139451f},
-std::array<float,2>{0.293817431f, 0.148978204f},
-std::array<float,2>{0.717096925f, 0.605323076f},
-std::array<float,2>{0.0371727496f, 0.531147361f},
-std::array<float,2>{0.943259954f, 0.191168159f},
-std::array<float,2>{0.454792023f, 0.273677588f},
-std::array<float,2>{0.580643833f, 0.828324199f},
-std::array<float,2>{0.319503456f, 0.972979248f},
-std::array<float,2>{0.650852978f, 0.479531825f},
-std::array<float,2>{0.219116837f, 0.00643195119f},
-std::array<float,2>{0.762688696f, 0.699734569f},
-std::array<float,2>{0.369609445f, 0.715860248f},
-std::array<float,2>{0.66346097f, 0.0264891759f},
-std::array<float,2>{0.215245545f, 0.496458918f},
-std::array<float,2>{0.811777771f, 0.991254926f},
-std::array<float,2>{0.0134980232f, 0.820135534f},
-std::array<float,2>{0.971190035f, 0.263887495f},
-std::array<float,2>{0.481899887f, 0.214694113f},
-std::array<float,2>{0.593752086f, 0.501407087f},
-std::array<float,2>{0.169607341f, 0.613729179f},
-std::array<float,2>{0.853253365f, 0.134594232f},
-std::array<float,2>{0.25340271f, 0.345930308f},
-std::array<float,2>{0.740521133f, 0.756989837f},
-std::array<float,2>{0.435916603f, 0.888259351f},
-std::array<float,2>{0.55111742f, 0.38357994f},
-std::array<float,2>{0.077248767f, 0.0874491706f},
-std::array<float,2>{0.93206954f, 0.667531073f},
-std::array<float,2>{0.44611609f, 0.534676552f},
-std::array<float,2>{0.57463181f, 0.226528004f},
-std::array<float,2>{0.0480542295f, 0.282189459f},
-std::array<float,2>{0.964190602f, 0.863141298f},
-std::array<float,2>{0.23973392f, 0.953396142f},
-std::array<float,2>{0.770596206f, 0.461696625f},
-std::array<float,2>{0.340131611f, 0.0474984981f},
-std::array<float,2>{0.6385445f, 0.743309677f},
-std::array<float,2>{0.122252278f, 0.649746835f},
-std::array<float,2>{0.900690258f, 0.0938073918f},
-std::array<float,2>{0.405456513f, 0.408458114f},
-std::array<float,2>{0.523409009f, 0.932630301f},
-std::array<float,2>{0.306465834f, 0.783319354f},
-std::array<float,2>{0.70204711f, 0.341284871f},
-std::array<float,2>{0.138938233f, 0.185626805f},
-std::array<float,2>{0.834627986f, 0.581165075f},
-std::array<float,2>{0.355970085f, 0.619228899f},
-std::array<float,2>{0.674523652f, 0.126176879f},
-std::array<float,2>{0.199158818f, 0.351915985f},
-std::array<float,2>{0.789106131f, 0.762649715f},
-std::array<float,2>{0.0237830263f, 0.876605153f},
-std::array<float,2>{0.991868436f, 0.379910558f},
-std::array<float,2>{0.497911423f, 0.080593951f},
-std::array<float,2>{0.621898592f, 0.663864911f},
-std::array<float,2>{0.1785319f, 0.705005705f},
-std::array<float,2>{0.87130332f, 0.0204228237f},
-std::array<float,2>{0.273547918f, 0.486034065f},
-std::array<float,2>{0.733289599f, 0.993563831f},
-std::array<float,2>{0.41517368f, 0.823629856f},
-std::array<float,2>{0.542089403f, 0.250764072f},
-std::array<float,2>{0.0924040899f, 0.208230197f},
-std::array<float,2>{0.915208817f, 0.51133424f},
-std::array<float,2>{0.459206671f, 0.64819026f},
-std::array<float,2>{0.585643113f, 0.106895633f},
-std::array<float,2>{0.03304784f, 0.415019423f},
-std::array<float,2>{0.940774262f, 0.921937704f},
-std::array<float,2>{0.225926548f, 0.79631412f},
-std::array<float,2>{0.761163235f, 0.328153402f},
-std::array<float,2>{0.314557165f, 0.179439187f},
-std::array<float,2>{0.653728485f, 0.591358423f},
-std::array<float,2>{0.0943281576f, 0.546874464f},
-std::array<float,2>{0.885150135f, 0.232448548f},
-std::array<float,2>{0.376695305f, 0.292956501f},
-std::array<float,2>{0.508730233f, 0.869974375f},
-std::array<float,2>{0.292054117f, 0.96359992f},
-std::array<float,2>{0.713894248f, 0.457652748f},
-std::array<float,2>{0.152183682f, 0.0578524433f},
-std::array<float,2>{0.82761085f, 0.739932656f},
-std::array<float,2>{0.256744087f, 0.727156162f},
-std::array<float,2>{0.734507203f, 0.045060046f},
-std::array<float,2>{0.16480726f, 0.450633913f},
-std::array<float,2>{0.857177615f, 0.93774122f},
-std::array<float,2>{0.0722997412f, 0.858802676f},
-std::array<float,2>{0.936405241f, 0.299351692f},
-std::array<float,2>{0.430390835f, 0.24059619f},
-std::array<float,2>{0.550523996f, 0.558271527f},
-std::array<float,2>{0.213229463f, 0.574504137f},
-std::array<float,2>{0.804800987f, 0.156593099f},
-std::array<float,2>{0.373181552f, 0.32364893f},
-std::array<float,2>{0.660114765f, 0.797718585f},
-std::array<float,2>{0.478815556f, 0.907808185f},
-std::array<float,2>{0.600785077f, 0.436030149f},
-std::array<float,2>{0.007815185f, 0.117859915f},
-std::array<float,2>{0.976130605f, 0.632059097f},
-std::array<float,2>{0.401487887f, 0.517224908f},
-std::array<float,2>{0.515735447f, 0.195695594f},
-std::array<float,2>{0.120916881f, 0.271423668f},
-std::array<float,2>{0.903514564f, 0.843464911f},
-std::array<float,2>{0.133846432f, 0.976584077f},
-std::array<float,2>{0.829238355f, 0.471514255f},
-std::array<float,2>{0.311284095f, 0.0110966982f},
-std::array<float,2>{0.697629452f, 0.69255197f},
-std::array<float,2>{0.0538244247f, 0.675810933f},
-std::array<float,2>{0.964966893f, 0.0705604181f},
-std::array<float,2>{0.452639312f, 0.391674131f},
-std::array<float,2>{0.571196377f, 0.905252755f},
-std::array<float,2>{0.336272895f, 0.765901983f},
-std::array<float,2>{0.635127187f, 0.370101184f},
-std::array<float,2>{0.235242262f, 0.143572763f},
-std::array<float,2>{0.766524255f, 0.593874156f},
-std::array<float,2>{0.298224717f, 0.547841549f},
-std::array<float,2>{0.691833377f, 0.244525239f},
-std::array<float,2>{0.128611535f, 0.311493576f},
-std::array<float,2>{0.839675248f, 0.844165623f},
-std::array<float,2>{0.115594737f, 0.947170496f},
-std::array<float,2>{0.891724348f, 0.437514186f},
-std::array<float,2>{0.390636533f, 0.031278301f},
-std::array<float,2>{0.52617979f, 0.721101344f},
-std::array<float,2>{0.245116487f, 0.634875178f},
-std::array<float,2>{0.778604746f, 0.113885261f},
-std::array<float,2>{0.329858601f, 0.425579369f},
-std::array<float,2>{0.631136119f, 0.917659104f},
-std::array<float,2>{0.44402647f, 0.81195879f},
-std::array<float,2>{0.564691782f, 0.314401507f},
-std::array<float,2>{0.061168462f, 0.164516613f},
-std::array<float,2>{0.954504251f, 0.569345057f},
-std::array<float,2>{0.429056972f, 0.69651705f},
-std::array<float,2>{0.560095966f, 0.00183070265f},
-std::array<float,2>{0.069630973f, 0.481066793f},
-std::array<float,2>{0.923574746f, 0.97038728f},
-std::array<float,2>{0.163686007f, 0.835393071f},
-std::array<float,2>{0.847010612f, 0.277849674f},
-std::array<float,2>{0.258241534f, 0.193073362f},
-std::array<float,2>{0.742384255f, 0.524800241f},
-std::array<float,2>{0.00225599599f, 0.60600841f},
-std::array<float,2>{0.977994382f, 0.152786896f},
-std::array<float,2>{0.472093999f, 0.366060823f},
-std::array<float,2>{0.60662818f, 0.775324225f},
-std::array<float,2>{0.363089591f, 0.89323163f},
-std::array<float,2>{0.667394817f, 0.400768846f},
-std::array<float,2>{0.207183078f, 0.0700723156f},
-std::array<float,2>{0.800851524f, 0.681922436f},
-std::array<float,2>{0.320512325f, 0.669416606f},
-std::array<float,2>{0.642143548f, 0.090705283f},
-std::array<float,2>{0.227192432f, 0.389246494f},
-std::array<float,2>{0.750700593f, 0.883124292f},
-std::array<float,2>{0.0428459942f, 0.753563344f},
-std::array<float,2>{0.949034035f, 0.348867714f},
-std::array<float,2>{0.465322226f, 0.138501614f},
-std::array<float,2>{0.589501917f, 0.613201797f},
-std::array<float,2>{0.14723295f, 0.504730284f},
-std::array<float,2>{0.813302159f, 0.215694323f},
-std::array<float,2>{0.283199877f, 0.259982973f},
-std::array<float,2>{0.704502344f, 0.815022051f},
-std::array<float,2>{0.388561994f, 0.985492945f},
-std::array<float,2>{0.506175756f, 0.492774963f},
-std::array<float,2>{0.107353836f, 0.0309909843f},
-std::array<float,2>{0.879916847f, 0.712149739f},
-std::array<float,2>{0.491906732f, 0.582663894f},
-std::array<float,2>{0.610931396f, 0.183142886f},
-std::array<float,2>{0.0177307371f, 0.338563263f},
-std::array<float,2>{0.995746374f, 0.788210154f},
-std::array<float,2>{0.190124646f, 0.934414506f},
-std::array<float,2>{0.787893653f, 0.412953645f},
-std::array<float,2>{0.3442716f, 0.101388462f},
-std::array<float,2>{0.679732144f, 0.653110802f},
-std::array<float,2>{0.0783429816f, 0.748614907f},
-std::array<float,2>{0.912057459f, 0.0528991967f},
-std::array<float,2>{0.410028189f, 0.466651618f},
-std::array<float,2>{0.535855293f, 0.960484087f},
-std::array<float,2>{0.268293738f, 0.863553584f},
-std::array<float,2>{0.725200534f, 0.286949456f},
-std::array<float,2>{0.183133185f, 0.221526876f},
-std::array<float,2>{0.862350225f, 0.536882997f},
-std::array<float,2>{0.366561919f, 0.54122752f},
-std::array<float,2>{0.668235302f, 0.230281517f},
-std::array<float,2>{0.205280632f, 0.296351582f},
-std::array<float,2>{0.799319267f, 0.874188542f},
-std::array<float,2>{0.00656911172f, 0.968299329f},
-std::array<float,2>{0.984133005f, 0.454228014f},
-std::array<float,2>{0.47563991f, 0.0591513924f},
-std::array<float,2>{0.604263008f, 0.736721456f},
-std::array<float,2>{0.158202171f, 0.643853486f},
-std::array<float,2>{0.849952281f, 0.102954037f},
-std::array<float,2>{0.261811405f, 0.419516116f},
-std::array<float,2>{0.746950805f, 0.926929235f},
-std::array<float,2>{0.424863845f, 0.790122032f},
-std::array<float,2>{0.558396578f, 0.335519403f},
-std::array<float,2>{0.0628966987f, 0.17229028f},
-std::array<float,2>{0.926337242f, 0.588655174f},
-std::array<float,2>{0.440370888f, 0.70830822f},
-std::array<float,2>{0.568169296f, 0.0195268616f},
-std::array<float,2>{0.0558568723f, 0.489284188f},
-std::array<float,2>{0.960867226f, 0.996973336f},
-std::array<float,2>{0.248001873f, 0.824373126f},
-std::array<float,2>{0.773695827f, 0.25642997f},
-std::array<float,2>{0.335745215f, 0.205002606f},
-std::array<float,2>{0.628695786f, 0.514795184f},
-std::array<float,2>{0.113069475f, 0.624401808f},
-std::array<float,2>{0.894991219f, 0.131225675f},
-std::array<float,2>{0.396422654f, 0.35745272f},
-std::array<float,2>{0.53060317f, 0.758008599f},
-std::array<float,2>{0.300841361f, 0.879927754f},
-std::array<float,2>{0.691048205f, 0.378053427f},
-std::array<float,2>{0.132477224f, 0.0833726823f},
-std::array<float,2>{0.842229128f, 0.657819629f},
-std::array<float,2>{0.269985318f, 0.67332375f},
-std::array<float,2>{0.718767226f, 0.0770742297f},
-std::array<float,2>{0.186545119f, 0.397712976f},
-std::array<float,2>{0.863699138f, 0.899542511f},
-std::array<float,2>{0.0841718093f, 0.770048261f},
-std::array<float,2>{0.906985998f, 0.372992784f},
-std::array<float,2>{0.412264645f, 0.147852883f},
-std::array<float,2>{0.531805217f, 0.599024236f},
-std::array<float,2>{0.192077756f, 0.519664168f},
-std::array<float,2>{0.784513474f, 0.20058769f},
-std::array<float,2>{0.34772566f, 0.269069731f},
-std::array<float,2>{0.684693456f, 0.839556873f},
-std::array<float,2>{0.486973435f, 0.982854545f},
-std::array<float,2>{0.615427613f, 0.475441664f},
-std::array<float,2>{0.0202908721f, 0.0155805461f},
-std::array<float,2>{0.998651803f, 0.688961565f},
-std::array<float,2>{0.383067638f, 0.573355734f},
-std::array<float,2>{0.501092911f, 0.160982266f},
-std::array<float,2>{0.102040015f, 0.326524109f},
-std::array<float,2>{0.876498282f, 0.804578602f},
-std::array<float,2>{0.144084692f, 0.911297739f},
-std::array<float,2>{0.818736076f, 0.43144536f},
-std::array<float,2>{0.28690052f, 0.123925477f},
-std::array<float,2>{0.709299803f, 0.626456678f},
-std::array<float,2>{0.0441916846f, 0.733540297f},
-std::array<float,2>{0.952003062f, 0.0409971513f},
-std::array<float,2>{0.461635739f, 0.447958589f},
-std::array<float,2>{0.593170643f, 0.941536844f},
-std::array<float,2>{0.32675451f, 0.853511989f},
-std::array<float,2>{0.647595823f, 0.301770359f},
-std::array<float,2>{0.230575755f, 0.236438096f},
-std::array<float,2>{0.756331861f, 0.558865309f},
-std::array<float,2>{0.29667756f, 0.602394402f},
-std::array<float,2>{0.715348303f, 0.152158067f},
-std::array<float,2>{0.15359956f, 0.359449744f},
-std::array<float,2>{0.82047987f, 0.778168976f},
-std::array<float,2>{0.098603718f, 0.894803882f},
-std::array<float,2>{0.887518406f, 0.402934343f},
-std::array<float,2>{0.381339818f, 0.0633063763f},
-std::array<float,2>{0.515048087f, 0.684317708f},
-std::array<float,2>{0.221773371f, 0.702242494f},
-std::array<float,2>{0.765243113f, 0.00417733984f},
-std::array<float,2>{0.317645133f, 0.477131784f},
-std::array<float,2>{0.649787486f, 0.97498107f},
-std::array<float,2>{0.456570625f, 0.830546498f},
-std::array<float,2>{0.578887582f, 0.276434869f},
-std::array<float,2>{0.0354560651f, 0.188636303f},
-std::array<float,2>{0.945128381f, 0.528301656f},
-std::array<float,2>{0.421710283f, 0.638825119f},
-std::array<float,2>{0.543733656f, 0.111320756f},
-std::array<float,2>{0.0892407149f, 0.429634631f},
-std::array<float,2>{0.919482052f, 0.918422103f},
-std::array<float,2>{0.172443017f, 0.805235445f},
-std::array<float,2>{0.869799554f, 0.316660225f},
-std::array<float,2>{0.27891311f, 0.168789193f},
-std::array<float,2>{0.726741016f, 0.563774884f},
-std::array<float,2>{0.0301988367f, 0.551089704f},
-std::array<float,2>{0.985272586f, 0.247924373f},
-std::array<float,2>{0.493208736f, 0.308408737f},
-std::array<float,2>{0.619634628f, 0.851351559f},
-std::array<float,2>{0.353962183f, 0.952026784f},
-std::array<float,2>{0.677758038f, 0.444596112f},
-std::array<float,2>{0.200423792f, 0.0390539132f},
-std::array<float,2>{0.793604732f, 0.725342512f},
-std::array<float,2>{0.343748987f, 0.745639145f},
-std::array<float,2>{0.640330851f, 0.0505593717f},
-std::array<float,2>{0.240432069f, 0.463222742f},
-std::array<float,2>{0.772572935f, 0.95610404f},
-std::array<float,2>{0.0493771397f, 0.861240149f},
-std::array<float,2>{0.961837292f, 0.283431381f},
-std::array<float,2>{0.448446035f, 0.2241382f},
-std::array<float,2>{0.577899098f, 0.531514227f},
-std::array<float,2>{0.138416067f, 0.579881668f},
-std::array<float,2>{0.832900524f, 0.185400456f},
-std::array<float,2>{0.308003783f, 0.342753977f},
-std::array<float,2>{0.699792743f, 0.781508625f},
-std::array<float,2>{0.404205859f, 0.930381358f},
-std::array<float,2>{0.52078265f, 0.406285793f},
-std::array<float,2>{0.123930313f, 0.0967228636f},
-std::array<float,2>{0.899337769f, 0.652091324f},
-std::array<float,2>{0.484218717f, 0.502156317f},
-std::array<float,2>{0.597169816f, 0.21278441f},
-std::array<float,2>{0.0147574749f, 0.26176095f},
-std::array<float,2>{0.970066428f, 0.817748189f},
-std::array<float,2>{0.218339041f, 0.989556372f},
-std::array<float,2>{0.808906496f, 0.498662293f},
-std::array<float,2>{0.368465692f, 0.0239460096f},
-std::array<float,2>{0.661171019f, 0.718524694f},
-std::array<float,2>{0.0758251995f, 0.665108085f},
-std::array<float,2>{0.931615472f, 0.0895877481f},
-std::array<float,2>{0.435532898f, 0.386370331f},
-std::array<float,2>{0.553077877f, 0.889935791f},
-std::array<float,2>{0.251893193f, 0.754353821f},
-std::array<float,2>{0.740227044f, 0.345463663f},
-std::array<float,2>{0.169991612f, 0.134944975f},
-std::array<float,2>{0.853843987f, 0.615471363f},
-std::array<float,2>{0.313857883f, 0.592827916f},
-std::array<float,2>{0.654563487f, 0.175980061f},
-std::array<float,2>{0.223441735f, 0.330830157f},
-std::array<float,2>{0.75900656f, 0.794377327f},
-std::array<float,2>{0.0335954167f, 0.925275981f},
-std::array<float,2>{0.938219547f, 0.41765359f},
-std::array<float,2>{0.458970755f, 0.108459979f},
-std::array<float,2>{0.582690895f, 0.644985735f},
-std::array<float,2>{0.148580864f, 0.741917253f},
-std::array<float,2>{0.826134443f, 0.0561942831f},
-std::array<float,2>{0.289502442f, 0.460191458f},
-std::array<float,2>{0.712364972f, 0.961984158f},
-std::array<float,2>{0.377736419f, 0.869130671f},
-std::array<float,2>{0.510857701f, 0.289773226f},
-std::array<float,2>{0.0969542414f, 0.231667072f},
-std::array<float,2>{0.883409977f, 0.544903696f},
-std::array<float,2>{0.498282999f, 0.661823988f},
-std::array<float,2>{0.623293459f, 0.078195326f},
-std::array<float,2>{0.0256357994f, 0.382480085f},
-std::array<float,2>{0.989940345f, 0.877244949f},
-std::array<float,2>{0.196273297f, 0.764257371f},
-std::array<float,2>{0.791933715f, 0.355008096f},
-std::array<float,2>{0.358080685f, 0.128518656f},
-std::array<float,2>{0.673814535f, 0.618636012f},
-std::array<float,2>{0.0905059651f, 0.509605348f},
-std::array<float,2>{0.916912138f, 0.210629478f},
-std::array<float,2>{0.417383373f, 0.252662688f},
-std::array<float,2>{0.539467573f, 0.820473015f},
-std::array<float,2>{0.275822341f, 0.995162189f},
-std::array<float,2>{0.730873823f, 0.487849742f},
-std::array<float,2>{0.176097736f, 0.0233105533f},
-std::array<float,2>{0.874061167f, 0.70635283f},
-std::array<float,2>{0.3101376f, 0.694592059f},
-std::array<float,2>{0.69565326f, 0.00871942472f},
-std::array<float,2>{0.135075226f, 0.469403893f},
-std::array<float,2>{0.831093967f, 0.979784131f},
-std::array<float,2>{0.117224768f, 0.84030509f},
-std::array<float,2>{0.904769778f, 0.272844791f},
-std::array<float,2>{0.398863584f, 0.198198974f},
-std::array<float,2>{0.519403756f, 0.518934965f},
-std::array<float,2>{0.238013923f, 0.596477926f},
-std::array<float,2>{0.768889248f, 0.142201707f},
-std::array<float,2>{0.339076668f, 0.367329299f},
-std::array<float,2>{0.633559644f, 0.767674446f},
-std::array<float,2>{0.449516565f, 0.902498484f},
-std::array<float,2>{0.573236763f, 0.394027293f},
-std::array<float,2>{0.0523981266f, 0.0735590458f},
-std::array<float,2>{0.967185438f, 0.679346144f},
-std::array<float,2>{0.433361977f, 0.556319833f},
-std::array<float,2>{0.547578037f, 0.238701478f},
-std::array<float,2>{0.0708295032f, 0.297029406f},
-std::array<float,2>{0.933934927f, 0.856108904f},
-std::array<float,2>{0.167901516f, 0.940773964f},
-std::array<float,2>{0.85777694f, 0.451577216f},
-std::array<float,2>{0.254157543f, 0.0430538468f},
-std::array<float,2>{0.736506045f, 0.729422688f},
-std::array<float,2>{0.0106494147f, 0.629194975f},
-std::array<float,2>{0.974319816f, 0.119477451f},
-std::array<float,2>{0.477498919f, 0.434123904f},
-std::array<float,2>{0.599514723f, 0.908846736f},
-std::array<float,2>{0.371740669f, 0.799818754f},
-std::array<float,2>{0.656801045f, 0.322012037f},
-std::array<float,2>{0.212180942f, 0.159290597f},
-std::array<float,2>{0.80857712f, 0.577396691f},
-std::array<float,2>{0.259850353f, 0.526382327f},
-std::array<float,2>{0.745167375f, 0.195057079f},
-std::array<float,2>{0.161080077f, 0.280452788f},
-std::array<float,2>{0.844555497f, 0.833373368f},
-std::array<float,2>{0.067500636f, 0.972009659f},
-std::array<float,2>{0.925066113f, 0.483203143f},
-std::array<float,2>{0.427021831f, 0.00256595621f},
-std::array<float,2>{0.560925841f, 0.697906554f},
-std::array<float,2>{0.210440665f, 0.680239201f},
-std::array<float,2>{0.803608596f, 0.067090109f},
-std::array<float,2>{0.361232996f, 0.400328159f},
-std::array<float,2>{0.665512562f, 0.892505765f},
-std::array<float,2>{0.470662445f, 0.777169704f},
-std::array<float,2>{0.608693063f, 0.363792121f},
-std::array<float,2>{0.000251190853f, 0.15475525f},
-std::array<float,2>{0.979332447f, 0.60874486f},
-std::array<float,2>{0.394078255f, 0.719398558f},
-std::array<float,2>{0.524753749f, 0.0332489088f},
-std::array<float,2>{0.114264697f, 0.439809024f},
-std::array<float,2>{0.893871784f, 0.948571801f},
-std::array<float,2>{0.125308767f, 0.846358299f},
-std::array<float,2>{0.837521195f, 0.309653252f},
-std::array<float,2>{0.30050528f, 0.243417531f},
-std::array<float,2>{0.694941998f, 0.550039768f},
-std::array<float,2>{0.0599056892f, 0.567895353f},
-std::array<float,2>{0.956845522f, 0.167223021f},
-std::array<float,2>{0.442978561f, 0.315786183f},
-std::array<float,2>{0.563513041f, 0.809832513f},
-std::array<float,2>{0.331235796f, 0.915455341f},
-std::array<float,2>{0.630810022f, 0.422669947f},
-std::array<float,2>{0.243411943f, 0.115858823f},
-std::array<float,2>{0.780612588f, 0.63388288f},
-std::array<float,2>{0.346365362f, 0.656004846f},
-std::array<float,2>{0.681780636f, 0.0982676372f},
-std::array<float,2>{0.189027935f, 0.411122203f},
-std::array<float,2>{0.786486804f, 0.937102497f},
-std::array<float,2>{0.0162409712f, 0.786366522f},
-std::array<float,2>{0.993782461f, 0.336994797f},
-std::array<float,2>{0.490011662f, 0.180135846f},
-std::array<float,2>{0.612104297f, 0.58533597f},
-std::array<float,2>{0.181285501f, 0.537201643f},
-std::array<float,2>{0.861067355f, 0.21908021f},
-std::array<float,2>{0.26634571f, 0.288159579f},
-std::array<float,2>{0.724053085f, 0.866773307f},
-std::array<float,2>{0.407613486f, 0.957071185f},
-std::array<float,2>{0.537397146f, 0.467395633f},
-std::array<float,2>{0.0809370801f, 0.0520041957f},
-std::array<float,2>{0.912158787f, 0.747754574f},
-std::array<float,2>{0.467428595f, 0.610951424f},
-std::array<float,2>{0.586560726f, 0.140440837f},
-std::array<float,2>{0.0393772349f, 0.350050896f},
-std::array<float,2>{0.945905566f, 0.751183629f},
-std::array<float,2>{0.228819937f, 0.886507869f},
-std::array<float,2>{0.752491236f, 0.387404859f},
-std::array<float,2>{0.323475003f, 0.0931381509f},
-std::array<float,2>{0.642582715f, 0.670772672f},
-std::array<float,2>{0.108069599f, 0.713935316f},
-std::array<float,2>{0.881691456f, 0.0281153433f},
-std::array<float,2>{0.389339894f, 0.495374411f},
-std::array<float,2>{0.50571698f, 0.987678885f},
-std::array<float,2>{0.283474296f, 0.812606275f},
-std::array<float,2>{0.705323219f, 0.258563995f},
-std::array<float,2>{0.145677805f, 0.218201265f},
-std::array<float,2>{0.81607306f, 0.507301629f},
-std::array<float,2>{0.325263858f, 0.559861481f},
-std::array<float,2>{0.646039367f, 0.237954631f},
-std::array<float,2>{0.232862279f, 0.301044673f},
-std::array<float,2>{0.75441879f, 0.852420926f},
-std::array<float,2>{0.0454479232f, 0.942914367f},
-std::array<float,2>{0.950901151f, 0.449215978f},
-std::array<float,2>{0.464829683f, 0.0397526696f},
-std::array<float,2>{0.590150476f, 0.733344257f},
-std::array<float,2>{0.141810805f, 0.625614405f},
-std::array<float,2>{0.817686796f, 0.124184974f},
-std::array<float,2>{0.287387103f, 0.430063099f},
-std::array<float,2>{0.708659112f, 0.910175264f},
-std::array<float,2>{0.385356486f, 0.803074777f},
-std::array<float,2>{0.502936363f, 0.328036994f},
-std::array<float,2>{0.104772255f, 0.161988497f},
-std::array<float,2>{0.878177285f, 0.573133469f},
-std::array<float,2>{0.485785186f, 0.688126683f},
-std::array<float,2>{0.613805056f, 0.0141561925f},
-std::array<float,2>{0.0226301011f, 0.476148129f},
-std::array<float,2>{0.997871757f, 0.98437041f},
-std::array<float,2>{0.193759933f, 0.838764846f},
-std::array<float,2>{0.781349719f, 0.267953753f},
-std::array<float,2>{0.351275027f, 0.200057417f},
-std::array<float,2>{0.687363863f, 0.52126056f},
-std::array<float,2>{0.0831023753f, 0.598232687f},
-std::array<float,2>{0.90845257f, 0.146725044f},
-std::array<float,2>{0.410513759f, 0.371938258f},
-std::array<float,2>{0.535102367f, 0.7713238f},
-std::array<float,2>{0.272413284f, 0.898792684f},
-std::array<float,2>{0.722379923f, 0.396623969f},
-std::array<float,2>{0.183886036f, 0.0775887221f},
-std::array<float,2>{0.865633011f, 0.672816098f},
-std::array<float,2>{0.304111689f, 0.65715009f},
-std::array<float,2>{0.688589096f, 0.0827994794f},
-std::array<float,2>{0.13057062f, 0.377306461f},
-std::array<float,2>{0.840514421f, 0.87892276f},
-std::array<float,2>{0.111234337f, 0.759190917f},
-std::array<float,2>{0.897750258f, 0.358803451f},
-std::array<float,2>{0.398068786f, 0.132211059f},
-std::array<float,2>{0.527857244f, 0.623969197f},
-std::array<float,2>{0.24904646f, 0.514288664f},
-std::array<float,2>{0.776921153f, 0.203206748f},
-std::array<float,2>{0.333166242f, 0.257289916f},
-std::array<float,2>{0.626926482f, 0.825350344f},
-std::array<float,2>{0.437780112f, 0.997809529f},
-std::array<float,2>{0.568916082f, 0.48914516f},
-std::array<float,2>{0.0585530028f, 0.0181155205f},
-std::array<float,2>{0.958839774f, 0.707087219f},
-std::array<float,2>{0.422774374f, 0.589171112f},
-std::array<float,2>{0.555346549f, 0.173085898f},
-std::array<float,2>{0.0653631464f, 0.334867984f},
-std::array<float,2>{0.927937865f, 0.789611399f},
-std::array<float,2>{0.15925768f, 0.925912082f},
-std::array<float,2>{0.84841758f, 0.41819635f},
-std::array<float,2>{0.265192777f, 0.101967417f},
-std::array<float,2>{0.749654055f, 0.643347979f},
-std::array<float,2>{0.004880575f, 0.737397909f},
-std::array<float,2>{0.982419729f, 0.0604373887f},
-std::array<float,2>{0.472951233f, 0.453751862f},
-std::array<float,2>{0.602059126f, 0.967053354f},
-std::array<float,2>{0.363635004f, 0.87399441f},
-std::array<float,2>{0.670717895f, 0.295147747f},
-std::array<float,2>{0.203642473f, 0.229434595f},
-std::array<float,2>{0.798811972f, 0.542015791f},
-std::array<float,2>{0.251994044f, 0.616685092f},
-std::array<float,2>{0.741277039f, 0.136483505f},
-std::array<float,2>{0.168298975f, 0.343964845f},
-std::array<float,2>{0.85210526f, 0.755590081f},
-std::array<float,2>{0.0762763396f, 0.889612317f},
-std::array<float,2>{0.932931185f, 0.38535583f},
-std::array<float,2>{0.436854899f, 0.0880571306f},
-std::array<float,2>{0.552593231f, 0.664066911f},
-std::array<float,2>{0.216616243f, 0.716893911f},
-std::array<float,2>{0.811066151f, 0.0249847826f},
-std::array<float,2>{0.370775044f, 0.499789804f},
-std::array<float,2>{0.662701011f, 0.988734484f},
-std::array<float,2>{0.481048614f, 0.817127347f},
-std::array<float,2>{0.595589161f, 0.263581485f},
-std::array<float,2>{0.0118902028f, 0.21102415f},
-std::array<float,2>{0.972337782f, 0.503276765f},
-std::array<float,2>{0.404755324f, 0.651240051f},
-std::array<float,2>{0.521973431f, 0.0959455073f},
-std::array<float,2>{0.122033201f, 0.407242298f},
-std::array<float,2>{0.902175009f, 0.931228518f},
-std::array<float,2>{0.139981985f, 0.78259784f},
-std::array<float,2>{0.835508168f, 0.342977762f},
-std::array<float,2>{0.304881305f, 0.183714479f},
-std::array<float,2>{0.702162027f, 0.578835845f},
-std::array<float,2>{0.0474037193f, 0.532706082f},
-std::array<float,2>{0.963225126f, 0.223181039f},
-std::array<float,2>{0.447055459f, 0.28471902f},
-std::array<float,2>{0.575689077f, 0.860327601f},
-std::array<float,2>{0.340845078f, 0.9559021f},
-std::array<float,2>{0.636729419f, 0.464618057f},
-std::array<float,2>{0.238615945f, 0.0490362346f},
-std::array<float,2>{0.769999146f, 0.744427383f},
-std::array<float,2>{0.35264501f, 0.726286054f},
-std::array<float,2>{0.67717272f, 0.0372402482f},
-std::array<float,2>{0.202401415f, 0.44428283f},
-std::array<float,2>{0.796631694f, 0.952770531f},
-std::array<float,2>{0.0280968901f, 0.850179613f},
-std::array<float,2>{0.98818928f, 0.307166457f},
-std::array<float,2>{0.49512881f, 0.24653843f},
-std::array<float,2>{0.618104219f, 0.552078724f},
-std::array<float,2>{0.174879745f, 0.563133299f},
-std::array<float,2>{0.868663013f, 0.16987811f},
-std::array<float,2>{0.279844493f, 0.317788839f},
-std::array<float,2>{0.729187191f, 0.806434751f},
-std::array<float,2>{0.418749005f, 0.919058084f},
-std::array<float,2>{0.546127081f, 0.427806258f},
-std::array<float,2>{0.0863043368f, 0.10990604f},
-std::array<float,2>{0.920914352f, 0.640462399f},
-std::array<float,2>{0.453880519f, 0.528607488f},
-std::array<float,2>{0.581855357f, 0.188363686f},
-std::array<float,2>{0.0389695205f, 0.276007533f},
-std::array<float,2>{0.942339957f, 0.831091642f},
-std::array<float,2>{0.220446751f, 0.976470292f},
-std::array<float,2>{0.762867868f, 0.47794202f},
-std::array<float,2>{0.319230735f, 0.00570769142f},
-std::array<float,2>{0.652133524f, 0.702026904f},
-std::array<float,2>{0.100777633f, 0.684795499f},
-std::array<float,2>{0.889569461f, 0.0638100803f},
-std::array<float,2>{0.379992187f, 0.404194623f},
-std::array<float,2>{0.513238609f, 0.896195471f},
-std::array<float,2>{0.294558495f, 0.779082298f},
-std::array<float,2>{0.718391597f, 0.36040467f},
-std::array<float,2>{0.154365465f, 0.150811061f},
-std::array<float,2>{0.823273063f, 0.602872431f},
-std::array<float,2>{0.374525636f, 0.576972842f},
-std::array<float,2>{0.658979952f, 0.15842621f},
-std::array<float,2>{0.214443222f, 0.320424139f},
-std::array<float,2>{0.806468129f, 0.799199462f},
-std::array<float,2>{0.00957672391f, 0.909955084f},
-std::array<float,2>{0.974740505f, 0.435312986f},
-std::array<float,2>{0.479566991f, 0.120507151f},
-std::array<float,2>{0.60038048f, 0.630591691f},
-std::array<float,2>{0.165099367f, 0.729686797f},
-std::array<float,2>{0.855770588f, 0.0440304987f},
-std::array<float,2>{0.25698638f, 0.452995241f},
-std::array<float,2>{0.736097872f, 0.939896703f},
-std::array<float,2>{0.43151018f, 0.856519699f},
-std::array<float,2>{0.549308002f, 0.29814136f},
-std::array<float,2>{0.0739791021f, 0.239635825f},
-std::array<float,2>{0.937426329f, 0.555598855f},
-std::array<float,2>{0.451776326f, 0.678532183f},
-std::array<float,2>{0.571290731f, 0.0731612965f},
-std::array<float,2>{0.0535926186f, 0.392759204f},
-std::array<float,2>{0.966050684f, 0.90356046f},
-std::array<float,2>{0.235799745f, 0.769450247f},
-std::array<float,2>{0.766862988f, 0.368735552f},
-std::array<float,2>{0.337137401f, 0.141094461f},
-std::array<float,2>{0.636200368f, 0.597496331f},
-std::array<float,2>{0.119985871f, 0.518133104f},
-std::array<float,2>{0.902876139f, 0.198702142f},
-std::array<float,2>{0.400533646f, 0.272397935f},
-std::array<float,2>{0.516701043f, 0.841130376f},
-std::array<float,2>{0.311584622f, 0.978753984f},
-std::array<float,2>{0.699074805f, 0.470242709f},
-std::array<float,2>{0.133014396f, 0.00882834103f},
-std::array<float,2>{0.828164399f, 0.693979561f},
-std::array<float,2>{0.274498731f, 0.705999017f},
-std::array<float,2>{0.733662665f, 0.0218191724f},
-std::array<float,2>{0.178845301f, 0.487155914f},
-std::array<float,2>{0.872350276f, 0.994412601f},
-std::array<float,2>{0.0934321731f, 0.821890533f},
-std::array<float,2>{0.91434598f, 0.253712505f},
-std::array<float,2>{0.414439559f, 0.209602833f},
-std::array<float,2>{0.541589558f, 0.508264601f},
-std::array<float,2>{0.197696954f, 0.617346227f},
-std::array<float,2>{0.790110707f, 0.127426594f},
-std::array<float,2>{0.356519818f, 0.353835195f},
-std::array<float,2>{0.674962461f, 0.765292645f},
-std::array<float,2>{0.49647367f, 0.878737986f},
-std::array<float,2>{0.622115731f, 0.380971193f},
-std::array<float,2>{0.025032036f, 0.0796551704f},
-std::array<float,2>{0.991052389f, 0.660562456f},
-std::array<float,2>{0.37532258f, 0.542981446f},
-std::array<float,2>{0.509656012f, 0.230993554f},
-std::array<float,2>{0.0947694033f, 0.290828347f},
-std::array<float,2>{0.886053741f, 0.86739105f},
-std::array<float,2>{0.151324779f, 0.960990191f},
-std::array<float,2>{0.826892793f, 0.459548175f},
-std::array<float,2>{0.291645229f, 0.0551451445f},
-std::array<float,2>{0.713393569f, 0.740914941f},
-std::array<float,2>{0.0314914919f, 0.645726144f},
-std::array<float,2>{0.939864695f, 0.107783847f},
-std::array<float,2>{0.460647166f, 0.416489422f},
-std::array<float,2>{0.584857106f, 0.924775839f},
-std::array<float,2>{0.315594852f, 0.793609142f},
-std::array<float,2>{0.65252459f, 0.331171304f},
-std::array<float,2>{0.224664286f, 0.177376866f},
-std::array<float,2>{0.760194242f, 0.59226203f},
-std::array<float,2>{0.282146543f, 0.506138623f},
-std::array<float,2>{0.703483999f, 0.217415422f},
-std::array<float,2>{0.147628188f, 0.259453982f},
-std::array<float,2>{0.813596368f, 0.814247906f},
-std::array<float,2>{0.105684616f, 0.986470163f},
-std::array<float,2>{0.879780769f, 0.494206011f},
-std::array<float,2>{0.387598753f, 0.0288326796f},
-std::array<float,2>{0.507275283f, 0.713770747f},
-std::array<float,2>{0.228159606f, 0.671427965f},
-std::array<float,2>{0.751308978f, 0.0920328721f},
-std::array<float,2>{0.321316779f, 0.388477862f},
-std::array<float,2>{0.641035378f, 0.884896874f},
-std::array<float,2>{0.466169238f, 0.750963271f},
-std::array<float,2>{0.588292956f, 0.351130754f},
-std::array<float,2>{0.0415039062f, 0.138743177f},
-std::array<float,2>{0.948057413f, 0.609429419f},
-std::array<float,2>{0.408691198f, 0.746436298f},
-std::array<float,2>{0.53695029f, 0.0517267659f},
-std::array<float,2>{0.079394266f, 0.468646824f},
-std::array<float,2>{0.910875022f, 0.958794653f},
-std::array<float,2>{0.181742117f, 0.865497828f},
-std::array<float,2>{0.861752689f, 0.288079679f},
-std::array<float,2>{0.269162476f, 0.220490202f},
-std::array<float,2>{0.725906312f, 0.538203299f},
-std::array<float,2>{0.0185685828f, 0.584739804f},
-std::array<float,2>{0.995021939f, 0.1815193f},
-std::array<float,2>{0.490260363f, 0.336633921f},
-std::array<float,2>{0.609668016f, 0.785768807f},
-std::array<float,2>{0.344873548f, 0.936350048f},
-std::array<float,2>{0.680985391f, 0.412020117f},
-std::array<float,2>{0.190798908f, 0.0988558009f},
-std::array<float,2>{0.788651526f, 0.655055285f},
-std::array<float,2>{0.328841835f, 0.633671522f},
-std::array<float,2>{0.632555366f, 0.11693199f},
-std::array<float,2>{0.246023178f, 0.423407197f},
-std::array<float,2>{0.777383089f, 0.914763212f},
-std::array<float,2>{0.0619665906f, 0.809049487f},
-std::array<float,2>{0.953294516f, 0.314854711f},
-std::array<float,2>{0.444723666f, 0.166681901f},
-std::array<float,2>{0.565812171f, 0.566483021f},
-std::array<float,2>{0.12736243f, 0.54910785f},
-std::array<float,2>{0.838730991f, 0.242814749f},
-std::array<float,2>{0.296918064f, 0.308706701f},
-std::array<float,2>{0.69273138f, 0.846911669f},
-std::array<float,2>{0.391642541f, 0.947391629f},
-std::array<float,2>{0.527071953f, 0.441212833f},
-std::array<float,2>{0.117125876f, 0.034601029f},
-std::array<float,2>{0.890804291f, 0.720389843f},
-std::array<float,2>{0.471353799f, 0.608301938f},
-std::array<float,2>{0.606411934f, 0.155497596f},
-std::array<float,2>{0.00308597786f, 0.364714354f},
-std::array<float,2>{0.977314472f, 0.775431454f},
-std::array<float,2>{0.208877936f, 0.891525328f},
-std::array<float,2>{0.80255127f, 0.398595184f},
-std::array<float,2>{0.361737132f, 0.0677991137f},
-std::array<float,2>{0.666834116f, 0.681285024f},
-std::array<float,2>{0.0686950982f, 0.69825387f},
-std::array<float,2>{0.922215462f, 0.00327358767f},
-std::array<float,2>{0.428661108f, 0.48353526f},
-std::array<float,2>{0.558766544f, 0.970754206f},
-std::array<float,2>{0.25885886f, 0.832926691f},
-std::array<float,2>{0.744096935f, 0.279607087f},
-std::array<float,2>{0.162478775f, 0.193680704f},
-std::array<float,2>{0.846021235f, 0.525732636f},
-std::array<float,2>{0.349015325f, 0.521488369f},
-std::array<float,2>{0.683791041f, 0.201737225f},
-std::array<float,2>{0.193335593f, 0.266200781f},
-std::array<float,2>{0.783339977f, 0.837458611f},
-std::array<float,2>{0.0207319129f, 0.981203079f},
-std::array<float,2>{0.999784589f, 0.474491209f},
-std::array<float,2>{0.488099575f, 0.0135966428f},
-std::array<float,2>{0.616256177f, 0.690962017f},
-std::array<float,2>{0.185760304f, 0.675297081f},
-std::array<float,2>{0.864876747f, 0.0749396905f},
-std::array<float,2>{0.271316379f, 0.395373285f},
-std::array<float,2>{0.720520794f, 0.900631309f},
-std::array<float,2>{0.413672179f, 0.772806048f},
-std::array<float,2>{0.532541811f, 0.373118609f},
-std::array<float,2>{0.0851572901f, 0.145881683f},
-std::array<float,2>{0.907386124f, 0.600917697f},
-std::array<float,2>{0.462661713f, 0.732043087f},
-std::array<float,2>{0.592464626f, 0.0413573012f},
-std::array<float,2>{0.0431043692f, 0.446603924f},
-std::array<float,2>{0.952536106f, 0.945238352f},
-std::array<float,2>{0.231451824f, 0.855107307f},
-std::array<float,2>{0.757121146f, 0.304034024f},
-std::array<float,2>{0.327254623f, 0.23608914f},
-std::array<float,2>{0.647143304f, 0.562109709f},
-std::array<float,2>{0.102673285f, 0.571349025f},
-std::array<float,2>{0.875582993f, 0.163302705f},
-std::array<float,2>{0.384138763f, 0.324923635f},
-std::array<float,2>{0.500079811f, 0.801064849f},
-std::array<float,2>{0.286112517f, 0.913747489f},
-std::array<float,2>{0.710615873f, 0.43340385f},
-std::array<float,2>{0.142914087f, 0.122813143f},
-std::array<float,2>{0.820117056f, 0.62755847f},
-std::array<float,2>{0.262907565f, 0.641335845f},
-std::array<float,2>{0.747325718f, 0.104780674f},
-std::array<float,2>{0.156643704f, 0.421132207f},
-std::array<float,2>{0.85094583f, 0.929338217f},
-std::array<float,2>{0.0644471124f, 0.7922346f},
-std::array<float,2>{0.927416503f, 0.332205683f},
-std::array<float,2>{0.423888326f, 0.174539611f},
-std::array<float,2>{0.557544827f, 0.587215543f},
-std::array<float,2>{0.206121191f, 0.540820599f},
-std::array<float,2>{0.800005913f, 0.227177829f},
-std::array<float,2>{0.365871489f, 0.294185042f},
-std::array<float,2>{0.669904709f, 0.871805847f},
-std::array<float,2>{0.475071996f, 0.966730297f},
-std::array<float,2>{0.605172873f, 0.456490725f},
-std::array<float,2>{0.00723136403f, 0.0620409399f},
-std::array<float,2>{0.983192205f, 0.734879434f},
-std::array<float,2>{0.395242363f, 0.621577263f},
-std::array<float,2>{0.529790938f, 0.130267784f},
-std::array<float,2>{0.11192394f, 0.355872542f},
-std::array<float,2>{0.895976841f, 0.76051563f},
-std::array<float,2>{0.130899176f, 0.880914509f},
-std::array<float,2>{0.843087256f, 0.375581443f},
-std::array<float,2>{0.301823318f, 0.0853160173f},
-std::array<float,2>{0.690241098f, 0.659678042f},
-std::array<float,2>{0.0553503819f, 0.710125864f},
-std::array<float,2>{0.959320784f, 0.0166707747f},
-std::array<float,2>{0.440600723f, 0.492027491f},
-std::array<float,2>{0.566637754f, 0.999222815f},
-std::array<float,2>{0.334305584f, 0.826872945f},
-std::array<float,2>{0.627739549f, 0.255484849f},
-std::array<float,2>{0.247056335f, 0.20692344f},
-std::array<float,2>{0.774807751f, 0.512633324f},
-std::array<float,2>{0.306711316f, 0.580616951f},
-std::array<float,2>{0.700986207f, 0.187256888f},
-std::array<float,2>{0.137070134f, 0.340245515f},
-std::array<float,2>{0.833831728f, 0.784677505f},
-std::array<float,2>{0.124920316f, 0.932525277f},
-std::array<float,2>{0.899669647f, 0.409232408f},
-std::array<float,2>{0.402505249f, 0.0956798419f},
-std::array<float,2>{0.520257711f, 0.648608923f},
-std::array<float,2>{0.241917059f, 0.74312216f},
-std::array<float,2>{0.771952391f, 0.0485238098f},
-std::array<float,2>{0.342084378f, 0.461916536f},
-std::array<float,2>{0.639069974f, 0.954247475f},
-std::array<float,2>{0.447451651f, 0.861930013f},
-std::array<float,2>{0.576790869f, 0.282353401f},
-std::array<float,2>{0.050198786f, 0.224967182f},
-std::array<float,2>{0.962707102f, 0.533834577f},
-std::array<float,2>{0.433887959f, 0.666620195f},
-std::array<float,2>{0.553817332f, 0.0859727263f},
-std::array<float,2>{0.0749603063f, 0.384246796f},
-std::array<float,2>{0.929772139f, 0.887259543f},
-std::array<float,2>{0.171666041f, 0.756743371f},
-std::array<float,2>{0.854515493f, 0.346906722f},
-std::array<float,2>{0.250004619f, 0.133511841f},
-std::array<float,2>{0.739180326f, 0.615019619f},
-std::array<float,2>{0.0140315937f, 0.500905812f},
-std::array<float,2>{0.969257891f, 0.21291329f},
-std::array<float,2>{0.482725143f, 0.265126407f},
-std::array<float,2>{0.596398473f, 0.818406343f},
-std::array<float,2>{0.367663234f, 0.990693331f},
-std::array<float,2>{0.660483479f, 0.497493923f},
-std::array<float,2>{0.217517585f, 0.0257100519f},
-std::array<float,2>{0.810056269f, 0.714918375f},
-std::array<float,2>{0.316423684f, 0.700514555f},
-std::array<float,2>{0.648453116f, 0.00699378783f},
-std::array<float,2>{0.221021891f, 0.478626698f},
-std::array<float,2>{0.76375258f, 0.974073827f},
-std::array<float,2>{0.036840003f, 0.829168618f},
-std::array<float,2>{0.943556428f, 0.274768293f},
-std::array<float,2>{0.455484331f, 0.189822227f},
-std::array<float,2>{0.579345584f, 0.530188918f},
-std::array<float,2>{0.152626216f, 0.604343891f},
-std::array<float,2>{0.821362257f, 0.150093928f},
-std::array<float,2>{0.295531929f, 0.362150282f},
-std::array<float,2>{0.716208041f, 0.780292988f},
-std::array<float,2>{0.382447422f, 0.89770174f},
-std::array<float,2>{0.514096498f, 0.405026615f},
-std::array<float,2>{0.0993228555f, 0.0660234764f},
-std::array<float,2>{0.887714744f, 0.686580002f},
-std::array<float,2>{0.492635339f, 0.554004967f},
-std::array<float,2>{0.620949388f, 0.248720288f},
-std::array<float,2>{0.0304273367f, 0.305152446f},
-std::array<float,2>{0.986094236f, 0.849117577f},
-std::array<float,2>{0.199363276f, 0.950437725f},
-std::array<float,2>{0.794818878f, 0.441690743f},
-std::array<float,2>{0.355317354f, 0.0361952297f},
-std::array<float,2>{0.679099679f, 0.724487245f},
-std::array<float,2>{0.0883607119f, 0.638052404f},
-std::array<float,2>{0.917983651f, 0.112377204f},
-std::array<float,2>{0.420148998f, 0.426012665f},
-std::array<float,2>{0.544481516f, 0.921794593f},
-std::array<float,2>{0.27800107f, 0.807577014f},
-std::array<float,2>{0.728123963f, 0.320205927f},
-std::array<float,2>{0.173685998f, 0.171240807f},
-std::array<float,2>{0.870732665f, 0.566079736f},
-std::array<float,2>{0.338156551f, 0.594805121f},
-std::array<float,2>{0.634689867f, 0.142865539f},
-std::array<float,2>{0.236906543f, 0.370312244f},
-std::array<float,2>{0.767719328f, 0.767205954f},
-std::array<float,2>{0.0513367914f, 0.905917287f},
-std::array<float,2>{0.968292594f, 0.390908509f},
-std::array<float,2>{0.450924873f, 0.0718720332f},
-std::array<float,2>{0.57339555f, 0.67707634f},
-std::array<float,2>{0.136100814f, 0.691546619f},
-std::array<float,2>{0.830471218f, 0.0105443168f},
-std::array<float,2>{0.309328943f, 0.471829385f},
-std::array<float,2>{0.696678758f, 0.978268206f},
-std::array<float,2>{0.399715751f, 0.841870844f},
-std::array<float,2>{0.517955661f, 0.269555598f},
-std::array<float,2>{0.11865674f, 0.196513027f},
-std::array<float,2>{0.906111419f, 0.516352534f},
-std::array<float,2>{0.477635264f, 0.631165922f},
-std::array<float,2>{0.597744584f, 0.118495867f},
-std::array<float,2>{0.0109097268f, 0.436665118f},
-std::array<float,2>{0.972905099f, 0.907183409f},
-std::array<float,2>{0.211555213f, 0.798093677f},
-std::array<float,2>{0.806680977f, 0.322764456f},
-std::array<float,2>{0.372114241f, 0.15775311f},
-std::array<float,2>{0.657500327f, 0.576149642f},
-std::array<float,2>{0.0721084774f, 0.557305098f},
-std::array<float,2>{0.935481846f, 0.241635233f},
-std::array<float,2>{0.432073176f, 0.299969703f},
-std::array<float,2>{0.548441529f, 0.858157456f},
-std::array<float,2>{0.255553186f, 0.939387441f},
-std::array<float,2>{0.737981856f, 0.449448556f},
-std::array<float,2>{0.166234344f, 0.0460259244f},
-std::array<float,2>{0.859102488f, 0.728048086f},
-std::array<float,2>{0.290802568f, 0.738380611f},
-std::array<float,2>{0.711693883f, 0.0571322367f},
-std::array<float,2>{0.1498169f, 0.458305418f},
-std::array<float,2>{0.824968517f, 0.964502752f},
-std::array<float,2>{0.0965668485f, 0.871081233f},
-std::array<float,2>{0.884523153f, 0.291659832f},
-std::array<float,2>{0.378368646f, 0.233826175f},
-std::array<float,2>{0.510469437f, 0.545289755f},
-std::array<float,2>{0.224606141f, 0.59013176f},
-std::array<float,2>{0.75799042f, 0.177997157f},
-std::array<float,2>{0.31250146f, 0.329857379f},
-std::array<float,2>{0.65542841f, 0.79552871f},
-std::array<float,2>{0.457876384f, 0.923033059f},
-std::array<float,2>{0.583737433f, 0.415659875f},
-std::array<float,2>{0.0349984504f, 0.105949521f},
-std::array<float,2>{0.939187407f, 0.646915495f},
-std::array<float,2>{0.416845292f, 0.510495842f},
-std::array<float,2>{0.540571213f, 0.207344413f},
-std::array<float,2>{0.0917078778f, 0.251114279f},
-std::array<float,2>{0.917807579f, 0.822699964f},
-std::array<float,2>{0.177602112f, 0.992794156f},
-std::array<float,2>{0.873230636f, 0.485299796f},
-std::array<float,2>{0.277242303f, 0.0205700453f},
-std::array<float,2>{0.731769562f, 0.703656793f},
-std::array<float,2>{0.0268796738f, 0.662572026f},
-std::array<float,2>{0.988677621f, 0.0815077201f},
-std::array<float,2>{0.499829769f, 0.379559338f},
-std::array<float,2>{0.624372721f, 0.875564158f},
-std::array<float,2>{0.358463198f, 0.762997448f},
-std::array<float,2>{0.672777593f, 0.35303548f},
-std::array<float,2>{0.196327776f, 0.125328287f},
-std::array<float,2>{0.792253494f, 0.620171726f},
-std::array<float,2>{0.26749f, 0.536033332f},
-std::array<float,2>{0.723384082f, 0.222605824f},
-std::array<float,2>{0.179859295f, 0.286117285f},
-std::array<float,2>{0.859920919f, 0.864353597f},
-std::array<float,2>{0.0813934356f, 0.959127724f},
-std::array<float,2>{0.913852036f, 0.465644479f},
-std::array<float,2>{0.406702876f, 0.0538394861f},
-std::array<float,2>{0.538479745f, 0.749634027f},
-std::array<float,2>{0.187789887f, 0.654114723f},
-std::array<float,2>{0.785509706f, 0.100348681f},
-std::array<float,2>{0.347222596f, 0.413186193f},
-std::array<float,2>{0.683416545f, 0.935268044f},
-std::array<float,2>{0.488318324f, 0.787351608f},
-std::array<float,2>{0.612545788f, 0.339326113f},
-std::array<float,2>{0.0169450548f, 0.181652471f},
-std::array<float,2>{0.992654264f, 0.583061934f},
-std::array<float,2>{0.390309542f, 0.711763263f},
-std::array<float,2>{0.504256248f, 0.0297324713f},
-std::array<float,2>{0.108911328f, 0.493733019f},
-std::array<float,2>{0.882472932f, 0.984769225f},
-std::array<float,2>{0.144998193f, 0.815704167f},
-std::array<float,2>{0.815016747f, 0.261161059f},
-std::array<float,2>{0.284937531f, 0.216215819f},
-std::array<float,2>{0.706086755f, 0.505819976f},
-std::array<float,2>{0.0404130444f, 0.611682773f},
-std::array<float,2>{0.947169304f, 0.136866704f},
-std::array<float,2>{0.468462646f, 0.347734004f},
-std::array<float,2>{0.587316751f, 0.752458632f},
-std::array<float,2>{0.322603673f, 0.883846402f},
-std::array<float,2>{0.644502819f, 0.390017658f},
-std::array<float,2>{0.229662448f, 0.0916689187f},
-std::array<float,2>{0.753781736f, 0.668249905f},
-std::array<float,2>{0.359882683f, 0.683264315f},
-std::array<float,2>{0.664156616f, 0.0693139508f},
-std::array<float,2>{0.209425867f, 0.401657313f},
-std::array<float,2>{0.804485321f, 0.893795192f},
-std::array<float,2>{0.00148511247f, 0.774394333f},
-std::array<float,2>{0.980039358f, 0.367093354f},
-std::array<float,2>{0.469405383f, 0.153743014f},
-std::array<float,2>{0.607565284f, 0.60654217f},
-std::array<float,2>{0.161401063f, 0.523731709f},
-std::array<float,2>{0.844831407f, 0.191647828f},
-std::array<float,2>{0.26108256f, 0.278348684f},
-std::array<float,2>{0.744418323f, 0.834498465f},
-std::array<float,2>{0.426681489f, 0.968897879f},
-std::array<float,2>{0.561931252f, 0.481671304f},
-std::array<float,2>{0.0673706755f, 0.000386756787f},
-std::array<float,2>{0.924005985f, 0.696115375f},
-std::array<float,2>{0.44217658f, 0.56868571f},
-std::array<float,2>{0.56324625f, 0.165483326f},
-std::array<float,2>{0.0593229942f, 0.312608838f},
-std::array<float,2>{0.955230296f, 0.811440706f},
-std::array<float,2>{0.242241889f, 0.916841328f},
-std::array<float,2>{0.780182004f, 0.42439267f},
-std::array<float,2>{0.33089149f, 0.114806749f},
-std::array<float,2>{0.628953576f, 0.636667073f},
-std::array<float,2>{0.113723606f, 0.721998274f},
-std::array<float,2>{0.892737508f, 0.0322546549f},
-std::array<float,2>{0.393531501f, 0.438811064f},
-std::array<float,2>{0.523748815f, 0.946261108f},
-std::array<float,2>{0.298964232f, 0.84519738f},
-std::array<float,2>{0.694162667f, 0.312385201f},
-std::array<float,2>{0.126589686f, 0.24553515f},
-std::array<float,2>{0.836117268f, 0.547960877f}}
\ No newline at end of file
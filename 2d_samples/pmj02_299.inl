@@ -1,4096 +0,0 @@
-{std::array<float,2>{0.736004233f, 0.338785499f},
-std::array<float,2>{0.430726647f, 0.905778825f},
-std::array<float,2>{0.937745392f, 0.681163192f},
-std::array<float,2>{0.0532496199f, 0.193705618f},
-std::array<float,2>{0.755784094f, 0.0948484167f},
-std::array<float,2>{0.127932787f, 0.548217773f},
-std::array<float,2>{0.526645064f, 0.841288507f},
-std::array<float,2>{0.264453202f, 0.393561214f},
-std::array<float,2>{0.897827387f, 0.458469629f},
-std::array<float,2>{0.0629637092f, 0.774958551f},
-std::array<float,2>{0.673986614f, 0.564593911f},
-std::array<float,2>{0.447996557f, 0.0115415277f},
-std::array<float,2>{0.578376591f, 0.134299248f},
-std::array<float,2>{0.326675594f, 0.712565064f},
-std::array<float,2>{0.843427658f, 0.975996852f},
-std::array<float,2>{0.222007528f, 0.264635891f},
-std::array<float,2>{0.558017612f, 0.433000982f},
-std::array<float,2>{0.308144212f, 0.85148865f},
-std::array<float,2>{0.808531642f, 0.523244798f},
-std::array<float,2>{0.186918855f, 0.0695512891f},
-std::array<float,2>{0.992584348f, 0.220436826f},
-std::array<float,2>{0.0185920354f, 0.653236151f},
-std::array<float,2>{0.717255235f, 0.91588366f},
-std::array<float,2>{0.394809008f, 0.370107383f},
-std::array<float,2>{0.868305087f, 0.283040136f},
-std::array<float,2>{0.191921949f, 0.953518212f},
-std::array<float,2>{0.621202052f, 0.730388522f},
-std::array<float,2>{0.356340706f, 0.169489428f},
-std::array<float,2>{0.647808373f, 0.0492285304f},
-std::array<float,2>{0.485028267f, 0.599503338f},
-std::array<float,2>{0.914541364f, 0.791984499f},
-std::array<float,2>{0.120009542f, 0.481821597f},
-std::array<float,2>{0.609006763f, 0.270570874f},
-std::array<float,2>{0.366425604f, 0.987452209f},
-std::array<float,2>{0.854110599f, 0.701363981f},
-std::array<float,2>{0.214995489f, 0.144771576f},
-std::array<float,2>{0.930982351f, 0.0305228308f},
-std::array<float,2>{0.0957336724f, 0.586914241f},
-std::array<float,2>{0.637648046f, 0.764793992f},
-std::array<float,2>{0.483808458f, 0.447253615f},
-std::array<float,2>{0.790632546f, 0.388749599f},
-std::array<float,2>{0.164803013f, 0.818740487f},
-std::array<float,2>{0.53167218f, 0.533798099f},
-std::array<float,2>{0.288723856f, 0.113441437f},
-std::array<float,2>{0.699729681f, 0.203627229f},
-std::array<float,2>{0.387617677f, 0.670653224f},
-std::array<float,2>{0.983727098f, 0.878403008f},
-std::array<float,2>{0.00174970098f, 0.314844131f},
-std::array<float,2>{0.656495035f, 0.490571916f},
-std::array<float,2>{0.457871318f, 0.811132908f},
-std::array<float,2>{0.879371345f, 0.618193626f},
-std::array<float,2>{0.0927201584f, 0.0404134579f},
-std::array<float,2>{0.813530922f, 0.185432836f},
-std::array<float,2>{0.244217843f, 0.748307705f},
-std::array<float,2>{0.576898992f, 0.943297625f},
-std::array<float,2>{0.341520935f, 0.297162175f},
-std::array<float,2>{0.953577101f, 0.344106764f},
-std::array<float,2>{0.0336920805f, 0.929453433f},
-std::array<float,2>{0.731889844f, 0.638982058f},
-std::array<float,2>{0.421688169f, 0.246724889f},
-std::array<float,2>{0.511833847f, 0.0819464326f},
-std::array<float,2>{0.266148418f, 0.512993574f},
-std::array<float,2>{0.768750131f, 0.859873354f},
-std::array<float,2>{0.149082348f, 0.416129678f},
-std::array<float,2>{0.630583704f, 0.305452615f},
-std::array<float,2>{0.469309151f, 0.949044764f},
-std::array<float,2>{0.925305963f, 0.738479495f},
-std::array<float,2>{0.101911932f, 0.177984923f},
-std::array<float,2>{0.846411347f, 0.0380800627f},
-std::array<float,2>{0.207606927f, 0.61331135f},
-std::array<float,2>{0.598900318f, 0.802674651f},
-std::array<float,2>{0.374052018f, 0.496986657f},
-std::array<float,2>{0.972276628f, 0.4090949f},
-std::array<float,2>{0.00967786182f, 0.87417233f},
-std::array<float,2>{0.687574685f, 0.50289011f},
-std::array<float,2>{0.382545054f, 0.0890086368f},
-std::array<float,2>{0.545851946f, 0.241701201f},
-std::array<float,2>{0.293317109f, 0.627862334f},
-std::array<float,2>{0.782597899f, 0.934722364f},
-std::array<float,2>{0.159520239f, 0.356202722f},
-std::array<float,2>{0.569599986f, 0.444355696f},
-std::array<float,2>{0.330268055f, 0.753180265f},
-std::array<float,2>{0.823104262f, 0.582128823f},
-std::array<float,2>{0.23642619f, 0.0165181048f},
-std::array<float,2>{0.883515596f, 0.15370585f},
-std::array<float,2>{0.0801945776f, 0.689844608f},
-std::array<float,2>{0.670201063f, 0.992716014f},
-std::array<float,2>{0.464407235f, 0.279642522f},
-std::array<float,2>{0.777678013f, 0.324179947f},
-std::array<float,2>{0.143220395f, 0.888810694f},
-std::array<float,2>{0.501413524f, 0.661472797f},
-std::array<float,2>{0.273697406f, 0.217185125f},
-std::array<float,2>{0.724842191f, 0.11756625f},
-std::array<float,2>{0.406471312f, 0.544999361f},
-std::array<float,2>{0.961617887f, 0.826167405f},
-std::array<float,2>{0.0467355251f, 0.376017958f},
-std::array<float,2>{0.518543661f, 0.359743416f},
-std::array<float,2>{0.253773451f, 0.913276732f},
-std::array<float,2>{0.758902669f, 0.642783761f},
-std::array<float,2>{0.133513287f, 0.228490546f},
-std::array<float,2>{0.951866329f, 0.0744817927f},
-std::array<float,2>{0.0578734688f, 0.530305743f},
-std::array<float,2>{0.746368885f, 0.857696772f},
-std::array<float,2>{0.428970963f, 0.423272491f},
-std::array<float,2>{0.834482074f, 0.475973547f},
-std::array<float,2>{0.229157656f, 0.787246764f},
-std::array<float,2>{0.591169655f, 0.602804244f},
-std::array<float,2>{0.313528359f, 0.0547538102f},
-std::array<float,2>{0.679751992f, 0.164030597f},
-std::array<float,2>{0.443413079f, 0.723109484f},
-std::array<float,2>{0.905184984f, 0.962165833f},
-std::array<float,2>{0.0777092278f, 0.289459288f},
-std::array<float,2>{0.709026814f, 0.398619622f},
-std::array<float,2>{0.406079441f, 0.828423262f},
-std::array<float,2>{0.991548896f, 0.561050475f},
-std::array<float,2>{0.027085593f, 0.102573358f},
-std::array<float,2>{0.802171886f, 0.200977877f},
-std::array<float,2>{0.174449608f, 0.673656821f},
-std::array<float,2>{0.550370932f, 0.896282554f},
-std::array<float,2>{0.301502883f, 0.332490444f},
-std::array<float,2>{0.912887335f, 0.256612599f},
-std::array<float,2>{0.112781487f, 0.984373987f},
-std::array<float,2>{0.655036569f, 0.704675794f},
-std::array<float,2>{0.494266808f, 0.12919201f},
-std::array<float,2>{0.614780247f, 0.00561538059f},
-std::array<float,2>{0.346134484f, 0.576017499f},
-std::array<float,2>{0.862376809f, 0.767068863f},
-std::array<float,2>{0.202337891f, 0.468443781f},
-std::array<float,2>{0.692870557f, 0.259577513f},
-std::array<float,2>{0.378667176f, 0.970794737f},
-std::array<float,2>{0.974448264f, 0.715091109f},
-std::array<float,2>{0.0121756792f, 0.138919905f},
-std::array<float,2>{0.788021266f, 0.0133606531f},
-std::array<float,2>{0.161423087f, 0.570212424f},
-std::array<float,2>{0.542501926f, 0.777456224f},
-std::array<float,2>{0.28945592f, 0.453918904f},
-std::array<float,2>{0.929020226f, 0.396270841f},
-std::array<float,2>{0.109043293f, 0.8372159f},
-std::array<float,2>{0.62534225f, 0.553859949f},
-std::array<float,2>{0.472770214f, 0.0985753611f},
-std::array<float,2>{0.596635222f, 0.189469397f},
-std::array<float,2>{0.369962454f, 0.68561852f},
-std::array<float,2>{0.850723863f, 0.899241686f},
-std::array<float,2>{0.204078242f, 0.342798918f},
-std::array<float,2>{0.505701661f, 0.477911085f},
-std::array<float,2>{0.279693365f, 0.796567082f},
-std::array<float,2>{0.773998618f, 0.594061077f},
-std::array<float,2>{0.147837609f, 0.0515162721f},
-std::array<float,2>{0.967591166f, 0.164391488f},
-std::array<float,2>{0.0421738736f, 0.733559668f},
-std::array<float,2>{0.719250202f, 0.96059525f},
-std::array<float,2>{0.410209119f, 0.286565632f},
-std::array<float,2>{0.824973822f, 0.371298432f},
-std::array<float,2>{0.238721952f, 0.921839476f},
-std::array<float,2>{0.56356281f, 0.651723266f},
-std::array<float,2>{0.335516393f, 0.225465193f},
-std::array<float,2>{0.666008949f, 0.0628130361f},
-std::array<float,2>{0.467197746f, 0.517742634f},
-std::array<float,2>{0.889432013f, 0.845221221f},
-std::array<float,2>{0.0833099708f, 0.437140554f},
-std::array<float,2>{0.58804673f, 0.319067895f},
-std::array<float,2>{0.319806993f, 0.880360663f},
-std::array<float,2>{0.829659402f, 0.667060018f},
-std::array<float,2>{0.231878236f, 0.207246199f},
-std::array<float,2>{0.901999772f, 0.113106705f},
-std::array<float,2>{0.0710147619f, 0.536178291f},
-std::array<float,2>{0.684295654f, 0.815194726f},
-std::array<float,2>{0.439675093f, 0.384834141f},
-std::array<float,2>{0.76424402f, 0.452369481f},
-std::array<float,2>{0.138871849f, 0.758790493f},
-std::array<float,2>{0.521279752f, 0.590350866f},
-std::array<float,2>{0.254654378f, 0.025557721f},
-std::array<float,2>{0.744399667f, 0.142832085f},
-std::array<float,2>{0.422937334f, 0.698180497f},
-std::array<float,2>{0.948768198f, 0.989643335f},
-std::array<float,2>{0.0617239587f, 0.267972201f},
-std::array<float,2>{0.649577856f, 0.418580264f},
-std::array<float,2>{0.497665763f, 0.863717377f},
-std::array<float,2>{0.908451676f, 0.508620918f},
-std::array<float,2>{0.115607768f, 0.083160378f},
-std::array<float,2>{0.863936841f, 0.246001706f},
-std::array<float,2>{0.198500291f, 0.632885516f},
-std::array<float,2>{0.612114787f, 0.923314989f},
-std::array<float,2>{0.350971818f, 0.350170821f},
-std::array<float,2>{0.984669387f, 0.302185088f},
-std::array<float,2>{0.0304450281f, 0.938391924f},
-std::array<float,2>{0.706149817f, 0.743251145f},
-std::array<float,2>{0.400974035f, 0.180550322f},
-std::array<float,2>{0.553552508f, 0.0446910821f},
-std::array<float,2>{0.299696743f, 0.622498691f},
-std::array<float,2>{0.800447226f, 0.805375457f},
-std::array<float,2>{0.176876158f, 0.484961331f},
-std::array<float,2>{0.679652512f, 0.351665705f},
-std::array<float,2>{0.44986403f, 0.931984842f},
-std::array<float,2>{0.892668307f, 0.630322754f},
-std::array<float,2>{0.0689163432f, 0.234691978f},
-std::array<float,2>{0.838988721f, 0.0925639719f},
-std::array<float,2>{0.226494461f, 0.506667793f},
-std::array<float,2>{0.582705617f, 0.868028939f},
-std::array<float,2>{0.320558369f, 0.410878599f},
-std::array<float,2>{0.943224967f, 0.495838612f},
-std::array<float,2>{0.0490955599f, 0.798763692f},
-std::array<float,2>{0.739906609f, 0.610776365f},
-std::array<float,2>{0.43511042f, 0.0330183059f},
-std::array<float,2>{0.528918684f, 0.175181925f},
-std::array<float,2>{0.258631766f, 0.734578788f},
-std::array<float,2>{0.753622174f, 0.949951649f},
-std::array<float,2>{0.130273774f, 0.311741322f},
-std::array<float,2>{0.61729157f, 0.382792711f},
-std::array<float,2>{0.352674752f, 0.823686659f},
-std::array<float,2>{0.874675393f, 0.540499449f},
-std::array<float,2>{0.188594028f, 0.124146111f},
-std::array<float,2>{0.919053018f, 0.21193558f},
-std::array<float,2>{0.12217588f, 0.659877479f},
-std::array<float,2>{0.643182993f, 0.88354516f},
-std::array<float,2>{0.491766363f, 0.325161308f},
-std::array<float,2>{0.810319304f, 0.274142802f},
-std::array<float,2>{0.183260843f, 0.997369647f},
-std::array<float,2>{0.561374903f, 0.69244045f},
-std::array<float,2>{0.308615863f, 0.148904175f},
-std::array<float,2>{0.712809503f, 0.0219345205f},
-std::array<float,2>{0.393976092f, 0.581773877f},
-std::array<float,2>{0.996712506f, 0.754971743f},
-std::array<float,2>{0.0206156913f, 0.438310504f},
-std::array<float,2>{0.535568953f, 0.29389599f},
-std::array<float,2>{0.283840388f, 0.966580927f},
-std::array<float,2>{0.793733895f, 0.720959485f},
-std::array<float,2>{0.168737739f, 0.158386156f},
-std::array<float,2>{0.977717638f, 0.0610723756f},
-std::array<float,2>{0.00585544202f, 0.609279454f},
-std::array<float,2>{0.696137071f, 0.781600296f},
-std::array<float,2>{0.38436842f, 0.468906254f},
-std::array<float,2>{0.857669413f, 0.42619285f},
-std::array<float,2>{0.212646201f, 0.852072656f},
-std::array<float,2>{0.604351461f, 0.525341451f},
-std::array<float,2>{0.361613959f, 0.0704021454f},
-std::array<float,2>{0.636013508f, 0.233828485f},
-std::array<float,2>{0.476749778f, 0.644822299f},
-std::array<float,2>{0.933805883f, 0.908302844f},
-std::array<float,2>{0.100860409f, 0.36516583f},
-std::array<float,2>{0.728576005f, 0.461260408f},
-std::array<float,2>{0.415310621f, 0.772727728f},
-std::array<float,2>{0.958778203f, 0.572041988f},
-std::array<float,2>{0.0358427055f, 0.000674545649f},
-std::array<float,2>{0.769546986f, 0.126855537f},
-std::array<float,2>{0.154418513f, 0.70870167f},
-std::array<float,2>{0.509016514f, 0.980053127f},
-std::array<float,2>{0.270766944f, 0.25126195f},
-std::array<float,2>{0.875259399f, 0.329126507f},
-std::array<float,2>{0.087888293f, 0.892916083f},
-std::array<float,2>{0.663304508f, 0.677989781f},
-std::array<float,2>{0.456341594f, 0.199006826f},
-std::array<float,2>{0.573705614f, 0.10786128f},
-std::array<float,2>{0.335967213f, 0.555026412f},
-std::array<float,2>{0.818272412f, 0.832502007f},
-std::array<float,2>{0.246649519f, 0.404926538f},
-std::array<float,2>{0.715027511f, 0.368521482f},
-std::array<float,2>{0.396637321f, 0.917584956f},
-std::array<float,2>{0.994296372f, 0.654847682f},
-std::array<float,2>{0.0157440566f, 0.221918404f},
-std::array<float,2>{0.80602771f, 0.0669984594f},
-std::array<float,2>{0.184167072f, 0.521345735f},
-std::array<float,2>{0.55621624f, 0.848008037f},
-std::array<float,2>{0.305063814f, 0.43096593f},
-std::array<float,2>{0.916571677f, 0.482929558f},
-std::array<float,2>{0.117561579f, 0.790558159f},
-std::array<float,2>{0.646470189f, 0.601499379f},
-std::array<float,2>{0.487736911f, 0.0478087552f},
-std::array<float,2>{0.623301089f, 0.171696559f},
-std::array<float,2>{0.357676566f, 0.727870762f},
-std::array<float,2>{0.86997807f, 0.956983745f},
-std::array<float,2>{0.194433257f, 0.285107613f},
-std::array<float,2>{0.525385857f, 0.391509354f},
-std::array<float,2>{0.262548089f, 0.843223572f},
-std::array<float,2>{0.756884038f, 0.550190389f},
-std::array<float,2>{0.126660258f, 0.0972500667f},
-std::array<float,2>{0.940711617f, 0.191801846f},
-std::array<float,2>{0.0510763489f, 0.682849109f},
-std::array<float,2>{0.737430632f, 0.90320611f},
-std::array<float,2>{0.432375073f, 0.335990667f},
-std::array<float,2>{0.839918435f, 0.263194293f},
-std::array<float,2>{0.220061436f, 0.974578202f},
-std::array<float,2>{0.580181122f, 0.714575589f},
-std::array<float,2>{0.325844705f, 0.135148719f},
-std::array<float,2>{0.672730327f, 0.00832661521f},
-std::array<float,2>{0.446931958f, 0.563060522f},
-std::array<float,2>{0.895586014f, 0.776104689f},
-std::array<float,2>{0.0652237609f, 0.459808946f},
-std::array<float,2>{0.57602483f, 0.299732f},
-std::array<float,2>{0.342024654f, 0.94527483f},
-std::array<float,2>{0.814686656f, 0.746855915f},
-std::array<float,2>{0.243024826f, 0.185988739f},
-std::array<float,2>{0.882211208f, 0.0411175489f},
-std::array<float,2>{0.0915770009f, 0.619657099f},
-std::array<float,2>{0.658388138f, 0.809094727f},
-std::array<float,2>{0.460548282f, 0.488331854f},
-std::array<float,2>{0.766443014f, 0.415599972f},
-std::array<float,2>{0.150642738f, 0.862890899f},
-std::array<float,2>{0.514774203f, 0.514581025f},
-std::array<float,2>{0.268604279f, 0.0793681815f},
-std::array<float,2>{0.733439803f, 0.248282731f},
-std::array<float,2>{0.419026434f, 0.637223899f},
-std::array<float,2>{0.955480158f, 0.926530778f},
-std::array<float,2>{0.0328855589f, 0.347280324f},
-std::array<float,2>{0.639815807f, 0.448741734f},
-std::array<float,2>{0.482204497f, 0.763486743f},
-std::array<float,2>{0.932603657f, 0.588191688f},
-std::array<float,2>{0.0945946574f, 0.0279797558f},
-std::array<float,2>{0.851920068f, 0.147645235f},
-std::array<float,2>{0.217119366f, 0.700380504f},
-std::array<float,2>{0.605673552f, 0.985190511f},
-std::array<float,2>{0.364114434f, 0.271530837f},
-std::array<float,2>{0.981583536f, 0.312652022f},
-std::array<float,2>{0.00307826907f, 0.875573456f},
-std::array<float,2>{0.702421665f, 0.668499887f},
-std::array<float,2>{0.389414668f, 0.205219045f},
-std::array<float,2>{0.534282207f, 0.11691533f},
-std::array<float,2>{0.286378145f, 0.533177972f},
-std::array<float,2>{0.792509079f, 0.816918492f},
-std::array<float,2>{0.166363984f, 0.386955589f},
-std::array<float,2>{0.668070793f, 0.277874708f},
-std::array<float,2>{0.461911649f, 0.994159937f},
-std::array<float,2>{0.885569751f, 0.689226508f},
-std::array<float,2>{0.0794191584f, 0.154822826f},
-std::array<float,2>{0.821252346f, 0.0182172246f},
-std::array<float,2>{0.234446198f, 0.585605979f},
-std::array<float,2>{0.566791594f, 0.750560522f},
-std::array<float,2>{0.328791708f, 0.44167611f},
-std::array<float,2>{0.964036286f, 0.37815097f},
-std::array<float,2>{0.0443601422f, 0.826263249f},
-std::array<float,2>{0.723727882f, 0.544525385f},
-std::array<float,2>{0.408576787f, 0.120636299f},
-std::array<float,2>{0.502944648f, 0.215470642f},
-std::array<float,2>{0.276135981f, 0.662206292f},
-std::array<float,2>{0.780023098f, 0.888591468f},
-std::array<float,2>{0.141211018f, 0.320556939f},
-std::array<float,2>{0.599760592f, 0.498861253f},
-std::array<float,2>{0.372494787f, 0.803062439f},
-std::array<float,2>{0.845576048f, 0.615248621f},
-std::array<float,2>{0.210643888f, 0.0359270647f},
-std::array<float,2>{0.922257781f, 0.177196085f},
-std::array<float,2>{0.104582086f, 0.741216898f},
-std::array<float,2>{0.632145643f, 0.945750237f},
-std::array<float,2>{0.470957696f, 0.30783993f},
-std::array<float,2>{0.783780396f, 0.357654929f},
-std::array<float,2>{0.156380579f, 0.936999202f},
-std::array<float,2>{0.54487884f, 0.626744032f},
-std::array<float,2>{0.295217574f, 0.238589451f},
-std::array<float,2>{0.690935075f, 0.0866064876f},
-std::array<float,2>{0.379100084f, 0.500134647f},
-std::array<float,2>{0.969182491f, 0.871841908f},
-std::array<float,2>{0.0103545068f, 0.407367617f},
-std::array<float,2>{0.548467934f, 0.335625589f},
-std::array<float,2>{0.30322057f, 0.89667964f},
-std::array<float,2>{0.803333759f, 0.674430311f},
-std::array<float,2>{0.173118398f, 0.202776358f},
-std::array<float,2>{0.988833904f, 0.103739426f},
-std::array<float,2>{0.0234680176f, 0.560087681f},
-std::array<float,2>{0.708852649f, 0.83190763f},
-std::array<float,2>{0.403444558f, 0.402293503f},
-std::array<float,2>{0.860758543f, 0.465958983f},
-std::array<float,2>{0.20099856f, 0.768310547f},
-std::array<float,2>{0.616918147f, 0.576498389f},
-std::array<float,2>{0.343910843f, 0.00780694839f},
-std::array<float,2>{0.65318048f, 0.132342473f},
-std::array<float,2>{0.493503213f, 0.705816031f},
-std::array<float,2>{0.910621941f, 0.980965734f},
-std::array<float,2>{0.110213481f, 0.255589485f},
-std::array<float,2>{0.748686254f, 0.425585121f},
-std::array<float,2>{0.426118404f, 0.85602802f},
-std::array<float,2>{0.949287415f, 0.528564036f},
-std::array<float,2>{0.0553257428f, 0.0779177919f},
-std::array<float,2>{0.760040402f, 0.229728892f},
-std::array<float,2>{0.136408076f, 0.641556263f},
-std::array<float,2>{0.516290069f, 0.911900342f},
-std::array<float,2>{0.25063017f, 0.362662554f},
-std::array<float,2>{0.904296279f, 0.291487128f},
-std::array<float,2>{0.0759797096f, 0.963801265f},
-std::array<float,2>{0.681842864f, 0.725394428f},
-std::array<float,2>{0.443054318f, 0.161933437f},
-std::array<float,2>{0.592642844f, 0.0581803285f},
-std::array<float,2>{0.314963073f, 0.603951514f},
-std::array<float,2>{0.833215177f, 0.785235405f},
-std::array<float,2>{0.226586923f, 0.474260867f},
-std::array<float,2>{0.721437454f, 0.287563294f},
-std::array<float,2>{0.41303435f, 0.958870053f},
-std::array<float,2>{0.966715157f, 0.732215166f},
-std::array<float,2>{0.0394653119f, 0.166111156f},
-std::array<float,2>{0.776268721f, 0.0531251952f},
-std::array<float,2>{0.145934984f, 0.596094966f},
-std::array<float,2>{0.505914092f, 0.793845594f},
-std::array<float,2>{0.278757334f, 0.479317278f},
-std::array<float,2>{0.887310028f, 0.434653401f},
-std::array<float,2>{0.0840179473f, 0.845795393f},
-std::array<float,2>{0.666722238f, 0.516539216f},
-std::array<float,2>{0.464875519f, 0.0659718961f},
-std::array<float,2>{0.565503955f, 0.223042712f},
-std::array<float,2>{0.333277166f, 0.649174273f},
-std::array<float,2>{0.826203048f, 0.919264197f},
-std::array<float,2>{0.242119566f, 0.374395162f},
-std::array<float,2>{0.54094696f, 0.455723971f},
-std::array<float,2>{0.292680204f, 0.780227542f},
-std::array<float,2>{0.786708474f, 0.566908777f},
-std::array<float,2>{0.162393227f, 0.0152928634f},
-std::array<float,2>{0.975709498f, 0.138410538f},
-std::array<float,2>{0.0153992875f, 0.717488408f},
-std::array<float,2>{0.695301056f, 0.969421089f},
-std::array<float,2>{0.376054049f, 0.260186791f},
-std::array<float,2>{0.848410189f, 0.340007931f},
-std::array<float,2>{0.206407234f, 0.901791692f},
-std::array<float,2>{0.594824433f, 0.685130358f},
-std::array<float,2>{0.367493153f, 0.188668236f},
-std::array<float,2>{0.628034413f, 0.0998952836f},
-std::array<float,2>{0.47549361f, 0.552408814f},
-std::array<float,2>{0.927522123f, 0.839685082f},
-std::array<float,2>{0.105817899f, 0.397802293f},
-std::array<float,2>{0.610247552f, 0.349339992f},
-std::array<float,2>{0.348618358f, 0.924636781f},
-std::array<float,2>{0.866781354f, 0.635145605f},
-std::array<float,2>{0.195718512f, 0.243416294f},
-std::array<float,2>{0.907942295f, 0.085270077f},
-std::array<float,2>{0.113755353f, 0.511703074f},
-std::array<float,2>{0.65190047f, 0.86634779f},
-std::array<float,2>{0.499103695f, 0.421370953f},
-std::array<float,2>{0.797694385f, 0.486420095f},
-std::array<float,2>{0.178178146f, 0.808283508f},
-std::array<float,2>{0.551324725f, 0.624032915f},
-std::array<float,2>{0.29723978f, 0.0454763062f},
-std::array<float,2>{0.703901589f, 0.183419272f},
-std::array<float,2>{0.39972949f, 0.745833397f},
-std::array<float,2>{0.986734211f, 0.941322327f},
-std::array<float,2>{0.0292521678f, 0.304361403f},
-std::array<float,2>{0.685899854f, 0.383188903f},
-std::array<float,2>{0.437507957f, 0.812931299f},
-std::array<float,2>{0.898520529f, 0.537145138f},
-std::array<float,2>{0.0741078407f, 0.109969631f},
-std::array<float,2>{0.831441045f, 0.20988214f},
-std::array<float,2>{0.233047813f, 0.66433537f},
-std::array<float,2>{0.586342514f, 0.882668316f},
-std::array<float,2>{0.316616416f, 0.316427469f},
-std::array<float,2>{0.946570575f, 0.266097695f},
-std::array<float,2>{0.0599763989f, 0.991304159f},
-std::array<float,2>{0.742753446f, 0.695355594f},
-std::array<float,2>{0.425505728f, 0.140776664f},
-std::array<float,2>{0.522923052f, 0.0246980507f},
-std::array<float,2>{0.256422728f, 0.593426585f},
-std::array<float,2>{0.762745202f, 0.760973215f},
-std::array<float,2>{0.138201997f, 0.450912744f},
-std::array<float,2>{0.640921593f, 0.326493263f},
-std::array<float,2>{0.489680409f, 0.886619508f},
-std::array<float,2>{0.920641184f, 0.657430768f},
-std::array<float,2>{0.1249891f, 0.213539332f},
-std::array<float,2>{0.872313559f, 0.122911975f},
-std::array<float,2>{0.190698415f, 0.541867375f},
-std::array<float,2>{0.619400203f, 0.820820093f},
-std::array<float,2>{0.353868753f, 0.380400181f},
-std::array<float,2>{0.999375165f, 0.441192031f},
-std::array<float,2>{0.0223894157f, 0.756995678f},
-std::array<float,2>{0.714048803f, 0.578830183f},
-std::array<float,2>{0.391103089f, 0.0206975155f},
-std::array<float,2>{0.559913993f, 0.150828168f},
-std::array<float,2>{0.312422663f, 0.693469942f},
-std::array<float,2>{0.812137306f, 0.999309301f},
-std::array<float,2>{0.181234583f, 0.276280254f},
-std::array<float,2>{0.584313631f, 0.412329376f},
-std::array<float,2>{0.323178768f, 0.869709134f},
-std::array<float,2>{0.837132633f, 0.504310906f},
-std::array<float,2>{0.223107532f, 0.0901357904f},
-std::array<float,2>{0.891847908f, 0.236766055f},
-std::array<float,2>{0.0670084581f, 0.631153226f},
-std::array<float,2>{0.67591244f, 0.930140615f},
-std::array<float,2>{0.452064544f, 0.355300963f},
-std::array<float,2>{0.751875699f, 0.310396343f},
-std::array<float,2>{0.132371634f, 0.952493668f},
-std::array<float,2>{0.52956444f, 0.737992585f},
-std::array<float,2>{0.260419577f, 0.17362754f},
-std::array<float,2>{0.741498053f, 0.0335635766f},
-std::array<float,2>{0.437351733f, 0.612933338f},
-std::array<float,2>{0.94376713f, 0.799055576f},
-std::array<float,2>{0.0475768596f, 0.493268251f},
-std::array<float,2>{0.51161921f, 0.253820866f},
-std::array<float,2>{0.272474766f, 0.977462053f},
-std::array<float,2>{0.77311343f, 0.710118592f},
-std::array<float,2>{0.153520137f, 0.126963913f},
-std::array<float,2>{0.960420966f, 0.00261898409f},
-std::array<float,2>{0.0384399109f, 0.573134899f},
-std::array<float,2>{0.727847517f, 0.769783556f},
-std::array<float,2>{0.416915268f, 0.463709295f},
-std::array<float,2>{0.81918776f, 0.403461248f},
-std::array<float,2>{0.249584541f, 0.8339867f},
-std::array<float,2>{0.571574688f, 0.556792915f},
-std::array<float,2>{0.339506209f, 0.105588302f},
-std::array<float,2>{0.660743535f, 0.195318565f},
-std::array<float,2>{0.453579217f, 0.675793052f},
-std::array<float,2>{0.877764285f, 0.891045034f},
-std::array<float,2>{0.0881401524f, 0.331315815f},
-std::array<float,2>{0.698297501f, 0.472635269f},
-std::array<float,2>{0.386633664f, 0.7847628f},
-std::array<float,2>{0.980228782f, 0.605884731f},
-std::array<float,2>{0.00623303512f, 0.0600671768f},
-std::array<float,2>{0.795372367f, 0.156616047f},
-std::array<float,2>{0.171515077f, 0.718978643f},
-std::array<float,2>{0.53784287f, 0.96832031f},
-std::array<float,2>{0.282193244f, 0.295629561f},
-std::array<float,2>{0.936596751f, 0.366439283f},
-std::array<float,2>{0.0993828475f, 0.907372594f},
-std::array<float,2>{0.634506285f, 0.647346854f},
-std::array<float,2>{0.478677064f, 0.231538281f},
-std::array<float,2>{0.603319764f, 0.0738162175f},
-std::array<float,2>{0.361255348f, 0.526078284f},
-std::array<float,2>{0.856284916f, 0.853634477f},
-std::array<float,2>{0.214602441f, 0.428150058f},
-std::array<float,2>{0.701833248f, 0.316300273f},
-std::array<float,2>{0.390413433f, 0.877924383f},
-std::array<float,2>{0.980698824f, 0.671446562f},
-std::array<float,2>{0.00222215033f, 0.204650015f},
-std::array<float,2>{0.791309237f, 0.114991903f},
-std::array<float,2>{0.167939931f, 0.534294367f},
-std::array<float,2>{0.533720851f, 0.8197788f},
-std::array<float,2>{0.285232425f, 0.390535235f},
-std::array<float,2>{0.933461249f, 0.446237385f},
-std::array<float,2>{0.0952883065f, 0.764235377f},
-std::array<float,2>{0.638842046f, 0.586786985f},
-std::array<float,2>{0.48098141f, 0.0294776373f},
-std::array<float,2>{0.606770515f, 0.146177009f},
-std::array<float,2>{0.36491555f, 0.702368319f},
-std::array<float,2>{0.852891266f, 0.986942708f},
-std::array<float,2>{0.218142048f, 0.270181686f},
-std::array<float,2>{0.514299333f, 0.417965531f},
-std::array<float,2>{0.267691463f, 0.860551596f},
-std::array<float,2>{0.767121315f, 0.512616217f},
-std::array<float,2>{0.15232493f, 0.0808309838f},
-std::array<float,2>{0.956268668f, 0.247124895f},
-std::array<float,2>{0.0321887285f, 0.639919817f},
-std::array<float,2>{0.732580245f, 0.928351045f},
-std::array<float,2>{0.418735653f, 0.34472844f},
-std::array<float,2>{0.815974891f, 0.297924161f},
-std::array<float,2>{0.243600383f, 0.941809297f},
-std::array<float,2>{0.575108051f, 0.749924839f},
-std::array<float,2>{0.342880011f, 0.184413254f},
-std::array<float,2>{0.659286022f, 0.0393129587f},
-std::array<float,2>{0.459954262f, 0.617973149f},
-std::array<float,2>{0.881560743f, 0.812174022f},
-std::array<float,2>{0.0901316479f, 0.491397262f},
-std::array<float,2>{0.581672311f, 0.264770776f},
-std::array<float,2>{0.324399769f, 0.975109279f},
-std::array<float,2>{0.84082514f, 0.711576045f},
-std::array<float,2>{0.219410673f, 0.133679286f},
-std::array<float,2>{0.894840181f, 0.00981539395f},
-std::array<float,2>{0.0663252398f, 0.565654039f},
-std::array<float,2>{0.673530698f, 0.773487389f},
-std::array<float,2>{0.44531703f, 0.457382262f},
-std::array<float,2>{0.756202757f, 0.392763108f},
-std::array<float,2>{0.125757977f, 0.840253472f},
-std::array<float,2>{0.523754537f, 0.54712677f},
-std::array<float,2>{0.263455957f, 0.0946331024f},
-std::array<float,2>{0.736845016f, 0.195232734f},
-std::array<float,2>{0.432986826f, 0.679910719f},
-std::array<float,2>{0.939759612f, 0.90435791f},
-std::array<float,2>{0.0518899225f, 0.339182734f},
-std::array<float,2>{0.644801319f, 0.481277734f},
-std::array<float,2>{0.486611366f, 0.792912483f},
-std::array<float,2>{0.917676151f, 0.597833335f},
-std::array<float,2>{0.118827634f, 0.0501166955f},
-std::array<float,2>{0.870348155f, 0.1684798f},
-std::array<float,2>{0.193401352f, 0.728545725f},
-std::array<float,2>{0.624640465f, 0.954880595f},
-std::array<float,2>{0.358461678f, 0.281577468f},
-std::array<float,2>{0.995497882f, 0.370616615f},
-std::array<float,2>{0.0175010227f, 0.914411068f},
-std::array<float,2>{0.716147363f, 0.653476894f},
-std::array<float,2>{0.397926837f, 0.21971038f},
-std::array<float,2>{0.555463195f, 0.0687325969f},
-std::array<float,2>{0.306074411f, 0.522186816f},
-std::array<float,2>{0.805456936f, 0.850205123f},
-std::array<float,2>{0.184950963f, 0.432295531f},
-std::array<float,2>{0.682717443f, 0.290226251f},
-std::array<float,2>{0.441438019f, 0.961537004f},
-std::array<float,2>{0.903117895f, 0.72375071f},
-std::array<float,2>{0.0744311959f, 0.162233695f},
-std::array<float,2>{0.832819104f, 0.056450773f},
-std::array<float,2>{0.228020832f, 0.60201329f},
-std::array<float,2>{0.592980146f, 0.788137615f},
-std::array<float,2>{0.315897137f, 0.474991143f},
-std::array<float,2>{0.95113492f, 0.421932966f},
-std::array<float,2>{0.0559103787f, 0.859205008f},
-std::array<float,2>{0.749420226f, 0.529943168f},
-std::array<float,2>{0.427712113f, 0.0757106319f},
-std::array<float,2>{0.517538071f, 0.227050379f},
-std::array<float,2>{0.25104183f, 0.644218802f},
-std::array<float,2>{0.761436939f, 0.912157178f},
-std::array<float,2>{0.135274872f, 0.361264586f},
-std::array<float,2>{0.615322232f, 0.467217684f},
-std::array<float,2>{0.345053375f, 0.766460896f},
-std::array<float,2>{0.860011458f, 0.574501812f},
-std::array<float,2>{0.200108126f, 0.00418514665f},
-std::array<float,2>{0.911948681f, 0.130033448f},
-std::array<float,2>{0.110975727f, 0.703929305f},
-std::array<float,2>{0.653462052f, 0.983299673f},
-std::array<float,2>{0.492880732f, 0.257226706f},
-std::array<float,2>{0.804164708f, 0.333825409f},
-std::array<float,2>{0.172599718f, 0.894570589f},
-std::array<float,2>{0.547475576f, 0.67265445f},
-std::array<float,2>{0.304268688f, 0.199826047f},
-std::array<float,2>{0.707081735f, 0.102105558f},
-std::array<float,2>{0.40276891f, 0.562382638f},
-std::array<float,2>{0.990073383f, 0.829627931f},
-std::array<float,2>{0.0253708474f, 0.400129884f},
-std::array<float,2>{0.543557942f, 0.356599569f},
-std::array<float,2>{0.296688557f, 0.933963895f},
-std::array<float,2>{0.784596384f, 0.628376126f},
-std::array<float,2>{0.158195108f, 0.241087154f},
-std::array<float,2>{0.970236897f, 0.0880846158f},
-std::array<float,2>{0.0112005221f, 0.502933979f},
-std::array<float,2>{0.689795434f, 0.873390913f},
-std::array<float,2>{0.380633414f, 0.409654766f},
-std::array<float,2>{0.844294727f, 0.497445375f},
-std::array<float,2>{0.209910452f, 0.801711679f},
-std::array<float,2>{0.601180196f, 0.614505053f},
-std::array<float,2>{0.371464521f, 0.038805373f},
-std::array<float,2>{0.630939901f, 0.179387689f},
-std::array<float,2>{0.472493261f, 0.740011871f},
-std::array<float,2>{0.923328161f, 0.94792068f},
-std::array<float,2>{0.103574507f, 0.305903047f},
-std::array<float,2>{0.722858965f, 0.375441492f},
-std::array<float,2>{0.410131752f, 0.824619234f},
-std::array<float,2>{0.963462949f, 0.546002209f},
-std::array<float,2>{0.043681927f, 0.118707269f},
-std::array<float,2>{0.781006217f, 0.218512744f},
-std::array<float,2>{0.142097831f, 0.66053617f},
-std::array<float,2>{0.502736628f, 0.89038682f},
-std::array<float,2>{0.276915371f, 0.322497368f},
-std::array<float,2>{0.886641145f, 0.280938715f},
-std::array<float,2>{0.078569226f, 0.99384135f},
-std::array<float,2>{0.669764578f, 0.690947175f},
-std::array<float,2>{0.4623743f, 0.152865872f},
-std::array<float,2>{0.567693114f, 0.017175369f},
-std::array<float,2>{0.329258502f, 0.583158791f},
-std::array<float,2>{0.82137841f, 0.7523669f},
-std::array<float,2>{0.235706866f, 0.443934023f},
-std::array<float,2>{0.74350673f, 0.269314229f},
-std::array<float,2>{0.424313664f, 0.988911927f},
-std::array<float,2>{0.945327699f, 0.698448479f},
-std::array<float,2>{0.0591844209f, 0.144227743f},
-std::array<float,2>{0.762222707f, 0.0265084654f},
-std::array<float,2>{0.137575284f, 0.591443658f},
-std::array<float,2>{0.5216676f, 0.758691192f},
-std::array<float,2>{0.257732153f, 0.451339245f},
-std::array<float,2>{0.899967313f, 0.385890514f},
-std::array<float,2>{0.0723890737f, 0.816227436f},
-std::array<float,2>{0.687205017f, 0.535490274f},
-std::array<float,2>{0.439364552f, 0.112159736f},
-std::array<float,2>{0.587788463f, 0.208180204f},
-std::array<float,2>{0.317930609f, 0.66620034f},
-std::array<float,2>{0.830232084f, 0.879219234f},
-std::array<float,2>{0.234024391f, 0.319668055f},
-std::array<float,2>{0.552296281f, 0.485571235f},
-std::array<float,2>{0.298468947f, 0.805795491f},
-std::array<float,2>{0.798262358f, 0.621812642f},
-std::array<float,2>{0.178964272f, 0.0429973044f},
-std::array<float,2>{0.988258362f, 0.181558892f},
-std::array<float,2>{0.027479155f, 0.743098319f},
-std::array<float,2>{0.704188406f, 0.93876183f},
-std::array<float,2>{0.399411827f, 0.301053703f},
-std::array<float,2>{0.865706682f, 0.351130843f},
-std::array<float,2>{0.196498588f, 0.922651291f},
-std::array<float,2>{0.611145973f, 0.634108841f},
-std::array<float,2>{0.349350214f, 0.245056108f},
-std::array<float,2>{0.650612533f, 0.0822197348f},
-std::array<float,2>{0.498908311f, 0.509477913f},
-std::array<float,2>{0.90654844f, 0.86521709f},
-std::array<float,2>{0.114920437f, 0.419009835f},
-std::array<float,2>{0.594534457f, 0.342548162f},
-std::array<float,2>{0.368560344f, 0.899811327f},
-std::array<float,2>{0.849142432f, 0.687315702f},
-std::array<float,2>{0.205509335f, 0.190671369f},
-std::array<float,2>{0.926622748f, 0.0995565057f},
-std::array<float,2>{0.106737673f, 0.553645432f},
-std::array<float,2>{0.626955271f, 0.836325467f},
-std::array<float,2>{0.476169854f, 0.394819528f},
-std::array<float,2>{0.785773098f, 0.454971403f},
-std::array<float,2>{0.163924679f, 0.778375685f},
-std::array<float,2>{0.539134443f, 0.569306374f},
-std::array<float,2>{0.291312516f, 0.0125286821f},
-std::array<float,2>{0.693470955f, 0.139782429f},
-std::array<float,2>{0.375932127f, 0.716511786f},
-std::array<float,2>{0.974850833f, 0.971832812f},
-std::array<float,2>{0.0143607175f, 0.258462191f},
-std::array<float,2>{0.667929113f, 0.436462849f},
-std::array<float,2>{0.46643436f, 0.84411931f},
-std::array<float,2>{0.888159215f, 0.518897533f},
-std::array<float,2>{0.0855196267f, 0.0635564253f},
-std::array<float,2>{0.827222168f, 0.225838125f},
-std::array<float,2>{0.240662903f, 0.650515258f},
-std::array<float,2>{0.564480364f, 0.920476258f},
-std::array<float,2>{0.332882285f, 0.372334957f},
-std::array<float,2>{0.965437114f, 0.285242617f},
-std::array<float,2>{0.0400584862f, 0.959478199f},
-std::array<float,2>{0.722373307f, 0.733227015f},
-std::array<float,2>{0.413760185f, 0.165990442f},
-std::array<float,2>{0.507484078f, 0.0519932322f},
-std::array<float,2>{0.278019816f, 0.595166922f},
-std::array<float,2>{0.776798725f, 0.795613885f},
-std::array<float,2>{0.144784465f, 0.477148503f},
-std::array<float,2>{0.632902026f, 0.363833368f},
-std::array<float,2>{0.48015067f, 0.909225047f},
-std::array<float,2>{0.935881555f, 0.646313131f},
-std::array<float,2>{0.0984613821f, 0.232702747f},
-std::array<float,2>{0.857413888f, 0.0720634162f},
-std::array<float,2>{0.213550463f, 0.524146736f},
-std::array<float,2>{0.601651669f, 0.853285074f},
-std::array<float,2>{0.359506667f, 0.427700102f},
-std::array<float,2>{0.979128301f, 0.469896406f},
-std::array<float,2>{0.00728927925f, 0.782547176f},
-std::array<float,2>{0.698131382f, 0.607914984f},
-std::array<float,2>{0.384858936f, 0.0624871813f},
-std::array<float,2>{0.53839016f, 0.159387141f},
-std::array<float,2>{0.282907248f, 0.722567737f},
-std::array<float,2>{0.796051264f, 0.965596914f},
-std::array<float,2>{0.170589685f, 0.294644862f},
-std::array<float,2>{0.570611596f, 0.406058997f},
-std::array<float,2>{0.338850111f, 0.833372533f},
-std::array<float,2>{0.819930136f, 0.555774927f},
-std::array<float,2>{0.248507783f, 0.108657658f},
-std::array<float,2>{0.878743112f, 0.197618067f},
-std::array<float,2>{0.088986963f, 0.679401278f},
-std::array<float,2>{0.661516726f, 0.893563092f},
-std::array<float,2>{0.454165667f, 0.328718126f},
-std::array<float,2>{0.7716645f, 0.250604331f},
-std::array<float,2>{0.152551323f, 0.97939074f},
-std::array<float,2>{0.510029256f, 0.707834065f},
-std::array<float,2>{0.272113413f, 0.125060663f},
-std::array<float,2>{0.727216482f, 0.00102831458f},
-std::array<float,2>{0.417363793f, 0.570375681f},
-std::array<float,2>{0.959768593f, 0.772319615f},
-std::array<float,2>{0.0375059806f, 0.462694615f},
-std::array<float,2>{0.531096876f, 0.310634345f},
-std::array<float,2>{0.261618257f, 0.950463355f},
-std::array<float,2>{0.750079155f, 0.735932767f},
-std::array<float,2>{0.131651908f, 0.174638703f},
-std::array<float,2>{0.944480598f, 0.032065019f},
-std::array<float,2>{0.0484200269f, 0.610252798f},
-std::array<float,2>{0.740730822f, 0.796877623f},
-std::array<float,2>{0.435609162f, 0.494465351f},
-std::array<float,2>{0.83665812f, 0.411872208f},
-std::array<float,2>{0.224358216f, 0.868542016f},
-std::array<float,2>{0.585912585f, 0.507102966f},
-std::array<float,2>{0.323479861f, 0.0929546356f},
-std::array<float,2>{0.676881552f, 0.235497832f},
-std::array<float,2>{0.452404529f, 0.629367411f},
-std::array<float,2>{0.89156425f, 0.9328596f},
-std::array<float,2>{0.0676288977f, 0.352958024f},
-std::array<float,2>{0.7137537f, 0.438626468f},
-std::array<float,2>{0.392488748f, 0.754176557f},
-std::array<float,2>{0.998597443f, 0.580965877f},
-std::array<float,2>{0.0226593316f, 0.0233158395f},
-std::array<float,2>{0.811208367f, 0.149784565f},
-std::array<float,2>{0.180627063f, 0.69155401f},
-std::array<float,2>{0.558694422f, 0.996151507f},
-std::array<float,2>{0.311122149f, 0.275042683f},
-std::array<float,2>{0.921453774f, 0.325398535f},
-std::array<float,2>{0.123099037f, 0.884542227f},
-std::array<float,2>{0.642428637f, 0.658933759f},
-std::array<float,2>{0.489026964f, 0.211653262f},
-std::array<float,2>{0.620364845f, 0.123767398f},
-std::array<float,2>{0.355066299f, 0.539237082f},
-std::array<float,2>{0.871458232f, 0.822387874f},
-std::array<float,2>{0.18996644f, 0.381695539f},
-std::array<float,2>{0.730880439f, 0.346591622f},
-std::array<float,2>{0.420855552f, 0.926791668f},
-std::array<float,2>{0.954793692f, 0.638524055f},
-std::array<float,2>{0.0350351892f, 0.249196872f},
-std::array<float,2>{0.767711461f, 0.0788143724f},
-std::array<float,2>{0.150130823f, 0.515476048f},
-std::array<float,2>{0.512980878f, 0.862067163f},
-std::array<float,2>{0.266922683f, 0.414800555f},
-std::array<float,2>{0.880387247f, 0.489588708f},
-std::array<float,2>{0.0932740867f, 0.810316741f},
-std::array<float,2>{0.6572631f, 0.620782852f},
-std::array<float,2>{0.458622068f, 0.0424666889f},
-std::array<float,2>{0.577753842f, 0.186601222f},
-std::array<float,2>{0.340518147f, 0.747655928f},
-std::array<float,2>{0.813252568f, 0.944030523f},
-std::array<float,2>{0.245409057f, 0.300186366f},
-std::array<float,2>{0.532539666f, 0.388467968f},
-std::array<float,2>{0.288075805f, 0.818131089f},
-std::array<float,2>{0.78951335f, 0.531420648f},
-std::array<float,2>{0.165351003f, 0.115629144f},
-std::array<float,2>{0.983257115f, 0.206990466f},
-std::array<float,2>{2.80570221e-05f, 0.669051766f},
-std::array<float,2>{0.700481772f, 0.876457572f},
-std::array<float,2>{0.388338625f, 0.314025313f},
-std::array<float,2>{0.854515493f, 0.272699833f},
-std::array<float,2>{0.216660634f, 0.985720158f},
-std::array<float,2>{0.607858658f, 0.699635744f},
-std::array<float,2>{0.365622908f, 0.147156134f},
-std::array<float,2>{0.638484836f, 0.029005019f},
-std::array<float,2>{0.482872307f, 0.589523017f},
-std::array<float,2>{0.92974025f, 0.762120187f},
-std::array<float,2>{0.0971536115f, 0.447514057f},
-std::array<float,2>{0.622803807f, 0.283251792f},
-std::array<float,2>{0.357194096f, 0.955888271f},
-std::array<float,2>{0.867949903f, 0.726801217f},
-std::array<float,2>{0.193141133f, 0.170769021f},
-std::array<float,2>{0.915670514f, 0.0483465455f},
-std::array<float,2>{0.120774299f, 0.600212753f},
-std::array<float,2>{0.647384882f, 0.789399683f},
-std::array<float,2>{0.486288041f, 0.4841986f},
-std::array<float,2>{0.807057559f, 0.429902911f},
-std::array<float,2>{0.186339408f, 0.848973155f},
-std::array<float,2>{0.557385623f, 0.519677103f},
-std::array<float,2>{0.307466179f, 0.0683541f},
-std::array<float,2>{0.718341887f, 0.221091166f},
-std::array<float,2>{0.395949423f, 0.655312777f},
-std::array<float,2>{0.99381882f, 0.91632998f},
-std::array<float,2>{0.0180391967f, 0.367528617f},
-std::array<float,2>{0.675656497f, 0.460829735f},
-std::array<float,2>{0.448971123f, 0.776670873f},
-std::array<float,2>{0.896715045f, 0.563583672f},
-std::array<float,2>{0.0638609678f, 0.00907353684f},
-std::array<float,2>{0.841856241f, 0.136289567f},
-std::array<float,2>{0.221036568f, 0.71340692f},
-std::array<float,2>{0.579607666f, 0.973472953f},
-std::array<float,2>{0.327838451f, 0.26224643f},
-std::array<float,2>{0.9386307f, 0.337325275f},
-std::array<float,2>{0.0542409196f, 0.903390586f},
-std::array<float,2>{0.734876454f, 0.682007134f},
-std::array<float,2>{0.430581212f, 0.192874506f},
-std::array<float,2>{0.525420785f, 0.0957493484f},
-std::array<float,2>{0.264986545f, 0.549486101f},
-std::array<float,2>{0.754616797f, 0.842564464f},
-std::array<float,2>{0.127515808f, 0.392080903f},
-std::array<float,2>{0.655801952f, 0.254602492f},
-std::array<float,2>{0.495657176f, 0.98166573f},
-std::array<float,2>{0.913918376f, 0.706999063f},
-std::array<float,2>{0.112229027f, 0.131811708f},
-std::array<float,2>{0.861374736f, 0.00638094498f},
-std::array<float,2>{0.201709837f, 0.577721179f},
-std::array<float,2>{0.614050865f, 0.768860459f},
-std::array<float,2>{0.346759647f, 0.465796232f},
-std::array<float,2>{0.990971684f, 0.400749087f},
-std::array<float,2>{0.0259263497f, 0.830330431f},
-std::array<float,2>{0.710178196f, 0.559527338f},
-std::array<float,2>{0.404626191f, 0.1052358f},
-std::array<float,2>{0.549420774f, 0.201840714f},
-std::array<float,2>{0.301962316f, 0.675577581f},
-std::array<float,2>{0.801414907f, 0.897607863f},
-std::array<float,2>{0.175403357f, 0.334378272f},
-std::array<float,2>{0.59032315f, 0.473293364f},
-std::array<float,2>{0.313262284f, 0.786949575f},
-std::array<float,2>{0.834994733f, 0.604822278f},
-std::array<float,2>{0.230144307f, 0.0567219257f},
-std::array<float,2>{0.906087935f, 0.160782605f},
-std::array<float,2>{0.0763126537f, 0.726319015f},
-std::array<float,2>{0.680922806f, 0.963990569f},
-std::array<float,2>{0.444351852f, 0.292693079f},
-std::array<float,2>{0.758583724f, 0.36171326f},
-std::array<float,2>{0.134601668f, 0.910642624f},
-std::array<float,2>{0.519419432f, 0.641800821f},
-std::array<float,2>{0.252845794f, 0.228826329f},
-std::array<float,2>{0.747512758f, 0.0763605535f},
-std::array<float,2>{0.42835772f, 0.527422249f},
-std::array<float,2>{0.952793121f, 0.857254922f},
-std::array<float,2>{0.05681381f, 0.42438519f},
-std::array<float,2>{0.50071162f, 0.321663499f},
-std::array<float,2>{0.27537322f, 0.887466192f},
-std::array<float,2>{0.778538048f, 0.663571954f},
-std::array<float,2>{0.144329831f, 0.215978608f},
-std::array<float,2>{0.962261438f, 0.119917139f},
-std::array<float,2>{0.0451513901f, 0.543839812f},
-std::array<float,2>{0.72607547f, 0.827864647f},
-std::array<float,2>{0.407614648f, 0.377565473f},
-std::array<float,2>{0.823901534f, 0.442662627f},
-std::array<float,2>{0.237411752f, 0.751245618f},
-std::array<float,2>{0.568484128f, 0.584481597f},
-std::array<float,2>{0.331796199f, 0.0187722687f},
-std::array<float,2>{0.67099762f, 0.156066f},
-std::array<float,2>{0.463493228f, 0.687853098f},
-std::array<float,2>{0.884114861f, 0.995556474f},
-std::array<float,2>{0.0818607733f, 0.278976321f},
-std::array<float,2>{0.68932426f, 0.407061309f},
-std::array<float,2>{0.38138178f, 0.872624278f},
-std::array<float,2>{0.970712006f, 0.501804352f},
-std::array<float,2>{0.00858178642f, 0.0878624544f},
-std::array<float,2>{0.781946898f, 0.240094095f},
-std::array<float,2>{0.158322647f, 0.625615597f},
-std::array<float,2>{0.546003699f, 0.935644925f},
-std::array<float,2>{0.294733018f, 0.358494639f},
-std::array<float,2>{0.924083054f, 0.307600588f},
-std::array<float,2>{0.103149652f, 0.946303606f},
-std::array<float,2>{0.629048049f, 0.741051197f},
-std::array<float,2>{0.469781905f, 0.176104188f},
-std::array<float,2>{0.597954512f, 0.0363933221f},
-std::array<float,2>{0.373261422f, 0.61673528f},
-std::array<float,2>{0.847001851f, 0.803922236f},
-std::array<float,2>{0.20832108f, 0.499073416f},
-std::array<float,2>{0.706014395f, 0.303454101f},
-std::array<float,2>{0.401785344f, 0.940402687f},
-std::array<float,2>{0.986211777f, 0.744715154f},
-std::array<float,2>{0.029831931f, 0.18255353f},
-std::array<float,2>{0.798874378f, 0.0462166443f},
-std::array<float,2>{0.176531881f, 0.623197436f},
-std::array<float,2>{0.554561913f, 0.806723475f},
-std::array<float,2>{0.300773382f, 0.487427354f},
-std::array<float,2>{0.90918982f, 0.419956863f},
-std::array<float,2>{0.116346702f, 0.86604929f},
-std::array<float,2>{0.648778141f, 0.51006788f},
-std::array<float,2>{0.496878743f, 0.0840946063f},
-std::array<float,2>{0.612305164f, 0.242399871f},
-std::array<float,2>{0.350453198f, 0.636002302f},
-std::array<float,2>{0.864877939f, 0.925051928f},
-std::array<float,2>{0.197590739f, 0.348537296f},
-std::array<float,2>{0.519594193f, 0.449362665f},
-std::array<float,2>{0.255193949f, 0.760666072f},
-std::array<float,2>{0.765518069f, 0.592681766f},
-std::array<float,2>{0.139777735f, 0.023498144f},
-std::array<float,2>{0.947963178f, 0.142134413f},
-std::array<float,2>{0.0612389892f, 0.697232425f},
-std::array<float,2>{0.745419323f, 0.99084723f},
-std::array<float,2>{0.421894521f, 0.267042607f},
-std::array<float,2>{0.828401983f, 0.318169534f},
-std::array<float,2>{0.230877146f, 0.881756544f},
-std::array<float,2>{0.589739084f, 0.665565252f},
-std::array<float,2>{0.318422616f, 0.210170567f},
-std::array<float,2>{0.684822381f, 0.111185431f},
-std::array<float,2>{0.441367716f, 0.538099289f},
-std::array<float,2>{0.900574863f, 0.81381315f},
-std::array<float,2>{0.0713248104f, 0.384490997f},
-std::array<float,2>{0.563117266f, 0.373266071f},
-std::array<float,2>{0.334712476f, 0.918149173f},
-std::array<float,2>{0.825368822f, 0.649563015f},
-std::array<float,2>{0.239884332f, 0.224405959f},
-std::array<float,2>{0.8905949f, 0.0649229065f},
-std::array<float,2>{0.0825243816f, 0.517084062f},
-std::array<float,2>{0.664461374f, 0.847068787f},
-std::array<float,2>{0.468618929f, 0.433785319f},
-std::array<float,2>{0.774545193f, 0.480217278f},
-std::array<float,2>{0.147320837f, 0.794375598f},
-std::array<float,2>{0.50406462f, 0.597569704f},
-std::array<float,2>{0.280735552f, 0.054090593f},
-std::array<float,2>{0.720333576f, 0.16725944f},
-std::array<float,2>{0.411230415f, 0.731436491f},
-std::array<float,2>{0.967931688f, 0.957667112f},
-std::array<float,2>{0.0419724695f, 0.289040059f},
-std::array<float,2>{0.626437902f, 0.396976024f},
-std::array<float,2>{0.474375367f, 0.83808887f},
-std::array<float,2>{0.928200603f, 0.550921917f},
-std::array<float,2>{0.108204812f, 0.100733601f},
-std::array<float,2>{0.850449502f, 0.187623158f},
-std::array<float,2>{0.204738066f, 0.684440494f},
-std::array<float,2>{0.596718311f, 0.900526404f},
-std::array<float,2>{0.371078342f, 0.341588438f},
-std::array<float,2>{0.973521888f, 0.260924846f},
-std::array<float,2>{0.0136253526f, 0.969747961f},
-std::array<float,2>{0.692321479f, 0.718508899f},
-std::array<float,2>{0.377878755f, 0.137021706f},
-std::array<float,2>{0.541754961f, 0.0137142679f},
-std::array<float,2>{0.290904909f, 0.56820029f},
-std::array<float,2>{0.788350761f, 0.780920208f},
-std::array<float,2>{0.160214394f, 0.456359237f},
-std::array<float,2>{0.662878513f, 0.330782771f},
-std::array<float,2>{0.455963165f, 0.892405093f},
-std::array<float,2>{0.876827836f, 0.677463651f},
-std::array<float,2>{0.0860949308f, 0.196472779f},
-std::array<float,2>{0.816408753f, 0.106569245f},
-std::array<float,2>{0.247803032f, 0.558221877f},
-std::array<float,2>{0.572870433f, 0.835861564f},
-std::array<float,2>{0.337273121f, 0.402671188f},
-std::array<float,2>{0.957753897f, 0.464423448f},
-std::array<float,2>{0.0366180576f, 0.770649493f},
-std::array<float,2>{0.730179489f, 0.573627353f},
-std::array<float,2>{0.414467841f, 0.0030263511f},
-std::array<float,2>{0.508701801f, 0.127945527f},
-std::array<float,2>{0.269966394f, 0.709408104f},
-std::array<float,2>{0.770600498f, 0.978358924f},
-std::array<float,2>{0.155686647f, 0.252316654f},
-std::array<float,2>{0.604931772f, 0.429501325f},
-std::array<float,2>{0.362622887f, 0.854526997f},
-std::array<float,2>{0.858436346f, 0.527125955f},
-std::array<float,2>{0.211343125f, 0.0728151649f},
-std::array<float,2>{0.935432374f, 0.230797902f},
-std::array<float,2>{0.10045667f, 0.648310661f},
-std::array<float,2>{0.635009527f, 0.906739831f},
-std::array<float,2>{0.477945119f, 0.365904301f},
-std::array<float,2>{0.794263542f, 0.296181977f},
-std::array<float,2>{0.169310376f, 0.967546642f},
-std::array<float,2>{0.536897182f, 0.720043242f},
-std::array<float,2>{0.284883112f, 0.157759264f},
-std::array<float,2>{0.696517646f, 0.0593099333f},
-std::array<float,2>{0.3833507f, 0.607413709f},
-std::array<float,2>{0.97678566f, 0.783738911f},
-std::array<float,2>{0.0040938817f, 0.471470982f},
-std::array<float,2>{0.562237859f, 0.276578575f},
-std::array<float,2>{0.310490757f, 0.998898804f},
-std::array<float,2>{0.808678627f, 0.694680333f},
-std::array<float,2>{0.182300508f, 0.151978016f},
-std::array<float,2>{0.99739778f, 0.0203880966f},
-std::array<float,2>{0.0204684846f, 0.579119086f},
-std::array<float,2>{0.711837053f, 0.756657481f},
-std::array<float,2>{0.393219262f, 0.439855903f},
-std::array<float,2>{0.873302996f, 0.379020929f},
-std::array<float,2>{0.187602371f, 0.822049201f},
-std::array<float,2>{0.618552744f, 0.542457759f},
-std::array<float,2>{0.352301568f, 0.121201314f},
-std::array<float,2>{0.644006968f, 0.214151576f},
-std::array<float,2>{0.49111852f, 0.657003701f},
-std::array<float,2>{0.91855371f, 0.885360777f},
-std::array<float,2>{0.121286504f, 0.327429533f},
-std::array<float,2>{0.738731563f, 0.493114948f},
-std::array<float,2>{0.434161991f, 0.80035466f},
-std::array<float,2>{0.941496134f, 0.611568689f},
-std::array<float,2>{0.0507193543f, 0.0346784666f},
-std::array<float,2>{0.75195682f, 0.172843903f},
-std::array<float,2>{0.129615039f, 0.736393034f},
-std::array<float,2>{0.527963579f, 0.951925993f},
-std::array<float,2>{0.259090394f, 0.308853507f},
-std::array<float,2>{0.893844843f, 0.354417503f},
-std::array<float,2>{0.0699111521f, 0.930727005f},
-std::array<float,2>{0.678016067f, 0.632289588f},
-std::array<float,2>{0.450239509f, 0.23797138f},
-std::array<float,2>{0.583851993f, 0.0910205096f},
-std::array<float,2>{0.321367413f, 0.505473614f},
-std::array<float,2>{0.838851631f, 0.870520055f},
-std::array<float,2>{0.225045666f, 0.413087964f},
-std::array<float,2>{0.725753546f, 0.323005885f},
-std::array<float,2>{0.407866627f, 0.889851868f},
-std::array<float,2>{0.962485254f, 0.660897315f},
-std::array<float,2>{0.045772817f, 0.218194455f},
-std::array<float,2>{0.779289484f, 0.118494548f},
-std::array<float,2>{0.144011751f, 0.546588659f},
-std::array<float,2>{0.50006783f, 0.824950039f},
-std::array<float,2>{0.2744174f, 0.37578693f},
-std::array<float,2>{0.884571195f, 0.443800509f},
-std::array<float,2>{0.0812888816f, 0.752687633f},
-std::array<float,2>{0.671553731f, 0.583752453f},
-std::array<float,2>{0.463044167f, 0.0167927388f},
-std::array<float,2>{0.56931299f, 0.152465552f},
-std::array<float,2>{0.331337899f, 0.690793872f},
-std::array<float,2>{0.823612213f, 0.993543446f},
-std::array<float,2>{0.238039643f, 0.280436128f},
-std::array<float,2>{0.546479881f, 0.410106629f},
-std::array<float,2>{0.294248223f, 0.873928785f},
-std::array<float,2>{0.781342149f, 0.503423452f},
-std::array<float,2>{0.158868521f, 0.0886895657f},
-std::array<float,2>{0.971432209f, 0.240432605f},
-std::array<float,2>{0.00784858037f, 0.628701806f},
-std::array<float,2>{0.688891828f, 0.934205115f},
-std::array<float,2>{0.381320506f, 0.357034653f},
-std::array<float,2>{0.847421706f, 0.306297541f},
-std::array<float,2>{0.208915994f, 0.947279036f},
-std::array<float,2>{0.598326266f, 0.739298463f},
-std::array<float,2>{0.373982221f, 0.178955778f},
-std::array<float,2>{0.629587948f, 0.0381120592f},
-std::array<float,2>{0.470664233f, 0.614767134f},
-std::array<float,2>{0.924458086f, 0.800901473f},
-std::array<float,2>{0.103023469f, 0.497727633f},
-std::array<float,2>{0.613700271f, 0.257344961f},
-std::array<float,2>{0.347415328f, 0.982876301f},
-std::array<float,2>{0.862000644f, 0.703228235f},
-std::array<float,2>{0.201272562f, 0.130758226f},
-std::array<float,2>{0.913257539f, 0.00482828682f},
-std::array<float,2>{0.111378528f, 0.57481277f},
-std::array<float,2>{0.655496657f, 0.766041815f},
-std::array<float,2>{0.495250762f, 0.46733588f},
-std::array<float,2>{0.801193595f, 0.399811983f},
-std::array<float,2>{0.175172523f, 0.82952255f},
-std::array<float,2>{0.54929769f, 0.561982036f},
-std::array<float,2>{0.302328229f, 0.101698682f},
-std::array<float,2>{0.710656464f, 0.199285477f},
-std::array<float,2>{0.405204684f, 0.672180176f},
-std::array<float,2>{0.990693986f, 0.895309329f},
-std::array<float,2>{0.0258145295f, 0.333159149f},
-std::array<float,2>{0.681439638f, 0.475262642f},
-std::array<float,2>{0.445020437f, 0.788796663f},
-std::array<float,2>{0.905459166f, 0.602061927f},
-std::array<float,2>{0.0771212131f, 0.0560147949f},
-std::array<float,2>{0.835770249f, 0.162629589f},
-std::array<float,2>{0.229741246f, 0.724407196f},
-std::array<float,2>{0.590408683f, 0.961359799f},
-std::array<float,2>{0.312611818f, 0.290833563f},
-std::array<float,2>{0.952541649f, 0.360794902f},
-std::array<float,2>{0.0572969578f, 0.912917495f},
-std::array<float,2>{0.747651041f, 0.643601298f},
-std::array<float,2>{0.427858114f, 0.227171555f},
-std::array<float,2>{0.519022346f, 0.0752701536f},
-std::array<float,2>{0.252147555f, 0.529769242f},
-std::array<float,2>{0.757831514f, 0.858881712f},
-std::array<float,2>{0.133929804f, 0.42259416f},
-std::array<float,2>{0.646717846f, 0.282110959f},
-std::array<float,2>{0.485628068f, 0.954265893f},
-std::array<float,2>{0.915480077f, 0.729450226f},
-std::array<float,2>{0.120451152f, 0.168299466f},
-std::array<float,2>{0.867639542f, 0.0503762104f},
-std::array<float,2>{0.192524388f, 0.598529935f},
-std::array<float,2>{0.622553587f, 0.792378902f},
-std::array<float,2>{0.356738061f, 0.480564535f},
-std::array<float,2>{0.993458629f, 0.431872189f},
-std::array<float,2>{0.018489778f, 0.850040317f},
-std::array<float,2>{0.718131423f, 0.521725655f},
-std::array<float,2>{0.396272868f, 0.0690158084f},
-std::array<float,2>{0.556743026f, 0.218880415f},
-std::array<float,2>{0.306767464f, 0.654016256f},
-std::array<float,2>{0.807596147f, 0.914833784f},
-std::array<float,2>{0.185725942f, 0.370378882f},
-std::array<float,2>{0.579180241f, 0.457747102f},
-std::array<float,2>{0.327532172f, 0.773977101f},
-std::array<float,2>{0.842623055f, 0.566266358f},
-std::array<float,2>{0.221396774f, 0.0104614692f},
-std::array<float,2>{0.897113621f, 0.132820874f},
-std::array<float,2>{0.0643661469f, 0.71136874f},
-std::array<float,2>{0.674923003f, 0.974633515f},
-std::array<float,2>{0.448396474f, 0.265241623f},
-std::array<float,2>{0.754194558f, 0.339445978f},
-std::array<float,2>{0.127310634f, 0.905044615f},
-std::array<float,2>{0.526073039f, 0.680414498f},
-std::array<float,2>{0.265279859f, 0.194698483f},
-std::array<float,2>{0.734810948f, 0.0938553363f},
-std::array<float,2>{0.430079907f, 0.547500074f},
-std::array<float,2>{0.938976943f, 0.840390861f},
-std::array<float,2>{0.0539654456f, 0.393277049f},
-std::array<float,2>{0.513659418f, 0.345220983f},
-std::array<float,2>{0.267189294f, 0.927831709f},
-std::array<float,2>{0.768400848f, 0.640570343f},
-std::array<float,2>{0.149836659f, 0.247862622f},
-std::array<float,2>{0.954356849f, 0.0801552758f},
-std::array<float,2>{0.0342506245f, 0.511730969f},
-std::array<float,2>{0.731408775f, 0.861184299f},
-std::array<float,2>{0.420321435f, 0.417189509f},
-std::array<float,2>{0.812547326f, 0.491917074f},
-std::array<float,2>{0.245640397f, 0.811914325f},
-std::array<float,2>{0.577485979f, 0.617313385f},
-std::array<float,2>{0.340063035f, 0.0396376476f},
-std::array<float,2>{0.65796268f, 0.183862388f},
-std::array<float,2>{0.458372116f, 0.749078155f},
-std::array<float,2>{0.880204618f, 0.94204551f},
-std::array<float,2>{0.0931237862f, 0.298453033f},
-std::array<float,2>{0.700939238f, 0.390132695f},
-std::array<float,2>{0.387841463f, 0.820223272f},
-std::array<float,2>{0.982571125f, 0.534852087f},
-std::array<float,2>{0.000946837186f, 0.114712931f},
-std::array<float,2>{0.789588928f, 0.20436427f},
-std::array<float,2>{0.165770844f, 0.671139181f},
-std::array<float,2>{0.532747447f, 0.877336204f},
-std::array<float,2>{0.287306577f, 0.315566361f},
-std::array<float,2>{0.930622101f, 0.269570053f},
-std::array<float,2>{0.0974335149f, 0.986724555f},
-std::array<float,2>{0.638117492f, 0.702769876f},
-std::array<float,2>{0.483029455f, 0.145926028f},
-std::array<float,2>{0.608017743f, 0.0302125271f},
-std::array<float,2>{0.365909845f, 0.586060822f},
-std::array<float,2>{0.855259776f, 0.763870835f},
-std::array<float,2>{0.216303989f, 0.445433468f},
-std::array<float,2>{0.711345673f, 0.274588495f},
-std::array<float,2>{0.392696112f, 0.996799171f},
-std::array<float,2>{0.997605026f, 0.692016304f},
-std::array<float,2>{0.0199330132f, 0.150307029f},
-std::array<float,2>{0.809478998f, 0.0229427163f},
-std::array<float,2>{0.181705654f, 0.580558181f},
-std::array<float,2>{0.56181711f, 0.754618704f},
-std::array<float,2>{0.309885114f, 0.439419895f},
-std::array<float,2>{0.918394387f, 0.381260544f},
-std::array<float,2>{0.121672109f, 0.822936654f},
-std::array<float,2>{0.644240677f, 0.539812028f},
-std::array<float,2>{0.490329415f, 0.123054422f},
-std::array<float,2>{0.618818462f, 0.21134983f},
-std::array<float,2>{0.351825088f, 0.658295453f},
-std::array<float,2>{0.873572171f, 0.883969247f},
-std::array<float,2>{0.188151851f, 0.326027155f},
-std::array<float,2>{0.527588964f, 0.495092422f},
-std::array<float,2>{0.259364039f, 0.797406852f},
-std::array<float,2>{0.752598703f, 0.609525323f},
-std::array<float,2>{0.128935799f, 0.0317344032f},
-std::array<float,2>{0.94229579f, 0.17385295f},
-std::array<float,2>{0.0498554781f, 0.735513628f},
-std::array<float,2>{0.738841057f, 0.950788438f},
-std::array<float,2>{0.434021741f, 0.311222404f},
-std::array<float,2>{0.837979317f, 0.353442937f},
-std::array<float,2>{0.225192472f, 0.933157623f},
-std::array<float,2>{0.583420932f, 0.629410326f},
-std::array<float,2>{0.321974725f, 0.235998675f},
-std::array<float,2>{0.678427398f, 0.0935330912f},
-std::array<float,2>{0.450916708f, 0.507326245f},
-std::array<float,2>{0.894193351f, 0.868846238f},
-std::array<float,2>{0.0694923997f, 0.411239147f},
-std::array<float,2>{0.572693527f, 0.328496069f},
-std::array<float,2>{0.337583512f, 0.894223094f},
-std::array<float,2>{0.817308307f, 0.679052472f},
-std::array<float,2>{0.247437119f, 0.198167413f},
-std::array<float,2>{0.876362979f, 0.109305143f},
-std::array<float,2>{0.0865228623f, 0.556516349f},
-std::array<float,2>{0.662367404f, 0.833693027f},
-std::array<float,2>{0.455094248f, 0.405294955f},
-std::array<float,2>{0.771323502f, 0.462227374f},
-std::array<float,2>{0.15595524f, 0.771503568f},
-std::array<float,2>{0.507887125f, 0.570921183f},
-std::array<float,2>{0.270397365f, 0.00151836383f},
-std::array<float,2>{0.729884207f, 0.125844121f},
-std::array<float,2>{0.414557666f, 0.707184196f},
-std::array<float,2>{0.957404077f, 0.978741586f},
-std::array<float,2>{0.0368232839f, 0.250240386f},
-std::array<float,2>{0.635262668f, 0.4269633f},
-std::array<float,2>{0.478333205f, 0.852546513f},
-std::array<float,2>{0.934898674f, 0.523670733f},
-std::array<float,2>{0.099654451f, 0.071654208f},
-std::array<float,2>{0.859341681f, 0.233106852f},
-std::array<float,2>{0.211755827f, 0.645764709f},
-std::array<float,2>{0.605094135f, 0.909829676f},
-std::array<float,2>{0.363029718f, 0.363473892f},
-std::array<float,2>{0.977494657f, 0.294344693f},
-std::array<float,2>{0.00441949209f, 0.965242207f},
-std::array<float,2>{0.696836293f, 0.722037554f},
-std::array<float,2>{0.38302651f, 0.15993844f},
-std::array<float,2>{0.536421895f, 0.0617847592f},
-std::array<float,2>{0.28431049f, 0.607520461f},
-std::array<float,2>{0.794643879f, 0.783200741f},
-std::array<float,2>{0.169681028f, 0.470618665f},
-std::array<float,2>{0.665012419f, 0.372625262f},
-std::array<float,2>{0.468143255f, 0.920327544f},
-std::array<float,2>{0.889937341f, 0.651259422f},
-std::array<float,2>{0.0822869912f, 0.226368085f},
-std::array<float,2>{0.826016366f, 0.0640995577f},
-std::array<float,2>{0.239368752f, 0.519236147f},
-std::array<float,2>{0.5626477f, 0.844608903f},
-std::array<float,2>{0.334471524f, 0.435663372f},
-std::array<float,2>{0.968328595f, 0.47682181f},
-std::array<float,2>{0.0412716568f, 0.794965088f},
-std::array<float,2>{0.720017612f, 0.59544009f},
-std::array<float,2>{0.412037969f, 0.0524452627f},
-std::array<float,2>{0.504480362f, 0.165161267f},
-std::array<float,2>{0.280905306f, 0.732825875f},
-std::array<float,2>{0.775246918f, 0.959449708f},
-std::array<float,2>{0.146506816f, 0.285699189f},
-std::array<float,2>{0.597358167f, 0.395085841f},
-std::array<float,2>{0.370211691f, 0.836681724f},
-std::array<float,2>{0.849903226f, 0.552927673f},
-std::array<float,2>{0.204138309f, 0.0986370742f},
-std::array<float,2>{0.928300738f, 0.191047117f},
-std::array<float,2>{0.107622959f, 0.686756134f},
-std::array<float,2>{0.626678288f, 0.900199056f},
-std::array<float,2>{0.473864406f, 0.341919929f},
-std::array<float,2>{0.78895092f, 0.25821045f},
-std::array<float,2>{0.161051929f, 0.972346127f},
-std::array<float,2>{0.541151702f, 0.715889037f},
-std::array<float,2>{0.290130585f, 0.140525118f},
-std::array<float,2>{0.691795647f, 0.0119728213f},
-std::array<float,2>{0.377342165f, 0.568493783f},
-std::array<float,2>{0.972755313f, 0.779116988f},
-std::array<float,2>{0.012919833f, 0.454102635f},
-std::array<float,2>{0.553792775f, 0.30140999f},
-std::array<float,2>{0.300231636f, 0.939379752f},
-std::array<float,2>{0.79972291f, 0.742336273f},
-std::array<float,2>{0.176162675f, 0.180869266f},
-std::array<float,2>{0.98539567f, 0.0436133407f},
-std::array<float,2>{0.029481627f, 0.621572793f},
-std::array<float,2>{0.705489695f, 0.806425154f},
-std::array<float,2>{0.402038038f, 0.486142218f},
-std::array<float,2>{0.864580929f, 0.419805795f},
-std::array<float,2>{0.197913244f, 0.864432096f},
-std::array<float,2>{0.613038361f, 0.508836448f},
-std::array<float,2>{0.349802822f, 0.0827638358f},
-std::array<float,2>{0.649331629f, 0.244540155f},
-std::array<float,2>{0.496131063f, 0.634316504f},
-std::array<float,2>{0.909949124f, 0.921986163f},
-std::array<float,2>{0.116856784f, 0.350740522f},
-std::array<float,2>{0.745903313f, 0.452126265f},
-std::array<float,2>{0.422810078f, 0.758248329f},
-std::array<float,2>{0.947668195f, 0.590902865f},
-std::array<float,2>{0.0610321388f, 0.0270892885f},
-std::array<float,2>{0.764720857f, 0.143921122f},
-std::array<float,2>{0.140466541f, 0.698869169f},
-std::array<float,2>{0.520210266f, 0.988486707f},
-std::array<float,2>{0.255757242f, 0.268892765f},
-std::array<float,2>{0.901119113f, 0.319892555f},
-std::array<float,2>{0.071969226f, 0.879729271f},
-std::array<float,2>{0.68530488f, 0.66682905f},
-std::array<float,2>{0.440547526f, 0.208595976f},
-std::array<float,2>{0.589165747f, 0.111343004f},
-std::array<float,2>{0.318940222f, 0.535803914f},
-std::array<float,2>{0.828969955f, 0.815571904f},
-std::array<float,2>{0.231423199f, 0.386464477f},
-std::array<float,2>{0.690329671f, 0.359007359f},
-std::array<float,2>{0.380361438f, 0.936491609f},
-std::array<float,2>{0.97010839f, 0.62512666f},
-std::array<float,2>{0.0112614743f, 0.239615291f},
-std::array<float,2>{0.785150409f, 0.0871271715f},
-std::array<float,2>{0.157365307f, 0.501332343f},
-std::array<float,2>{0.543283939f, 0.872170746f},
-std::array<float,2>{0.295935929f, 0.406488717f},
-std::array<float,2>{0.923549294f, 0.499634981f},
-std::array<float,2>{0.104082577f, 0.804402411f},
-std::array<float,2>{0.631748021f, 0.616636574f},
-std::array<float,2>{0.472079992f, 0.0370255113f},
-std::array<float,2>{0.600671589f, 0.176440969f},
-std::array<float,2>{0.371765316f, 0.740630984f},
-std::array<float,2>{0.84412396f, 0.947176099f},
-std::array<float,2>{0.209179297f, 0.306914002f},
-std::array<float,2>{0.50241375f, 0.377036065f},
-std::array<float,2>{0.276569963f, 0.827522635f},
-std::array<float,2>{0.780684173f, 0.54321593f},
-std::array<float,2>{0.142064631f, 0.119594857f},
-std::array<float,2>{0.963035703f, 0.216668993f},
-std::array<float,2>{0.0432293005f, 0.663759291f},
-std::array<float,2>{0.723261297f, 0.887106717f},
-std::array<float,2>{0.409211844f, 0.322070599f},
-std::array<float,2>{0.822050214f, 0.278395742f},
-std::array<float,2>{0.236054853f, 0.995850623f},
-std::array<float,2>{0.568096817f, 0.688229501f},
-std::array<float,2>{0.329799622f, 0.155534044f},
-std::array<float,2>{0.669245064f, 0.0193685926f},
-std::array<float,2>{0.462844044f, 0.584251761f},
-std::array<float,2>{0.885870337f, 0.751651943f},
-std::array<float,2>{0.078922376f, 0.44332397f},
-std::array<float,2>{0.593317151f, 0.292015761f},
-std::array<float,2>{0.315930039f, 0.96464932f},
-std::array<float,2>{0.83217907f, 0.725726187f},
-std::array<float,2>{0.228513017f, 0.160279214f},
-std::array<float,2>{0.902373075f, 0.0575776175f},
-std::array<float,2>{0.0749721751f, 0.605365157f},
-std::array<float,2>{0.683141708f, 0.786285162f},
-std::array<float,2>{0.44224894f, 0.472818017f},
-std::array<float,2>{0.761206388f, 0.424213827f},
-std::array<float,2>{0.134870023f, 0.856452048f},
-std::array<float,2>{0.517034709f, 0.528018773f},
-std::array<float,2>{0.251737595f, 0.0767363831f},
-std::array<float,2>{0.749965787f, 0.229279578f},
-std::array<float,2>{0.426882774f, 0.642315328f},
-std::array<float,2>{0.950331211f, 0.910833657f},
-std::array<float,2>{0.0561782606f, 0.362282842f},
-std::array<float,2>{0.654067636f, 0.465225756f},
-std::array<float,2>{0.492192179f, 0.769308865f},
-std::array<float,2>{0.911214709f, 0.577444971f},
-std::array<float,2>{0.110750087f, 0.00590150291f},
-std::array<float,2>{0.859638333f, 0.13122572f},
-std::array<float,2>{0.199615881f, 0.706085324f},
-std::array<float,2>{0.616131306f, 0.982042849f},
-std::array<float,2>{0.345564157f, 0.254052281f},
-std::array<float,2>{0.989502609f, 0.334872276f},
-std::array<float,2>{0.0245824121f, 0.898218095f},
-std::array<float,2>{0.707982183f, 0.674897194f},
-std::array<float,2>{0.403190732f, 0.201406658f},
-std::array<float,2>{0.547256231f, 0.104652978f},
-std::array<float,2>{0.304150343f, 0.558705449f},
-std::array<float,2>{0.804550707f, 0.830966711f},
-std::array<float,2>{0.172178671f, 0.401163697f},
-std::array<float,2>{0.673094511f, 0.262120456f},
-std::array<float,2>{0.446063042f, 0.972744167f},
-std::array<float,2>{0.895020306f, 0.712929606f},
-std::array<float,2>{0.0656083003f, 0.136145368f},
-std::array<float,2>{0.841669679f, 0.00969763659f},
-std::array<float,2>{0.219022274f, 0.564425409f},
-std::array<float,2>{0.581158876f, 0.77691251f},
-std::array<float,2>{0.324984789f, 0.45998019f},
-std::array<float,2>{0.940223992f, 0.392382771f},
-std::array<float,2>{0.0523628183f, 0.841874719f},
-std::array<float,2>{0.736618757f, 0.549206078f},
-std::array<float,2>{0.433156878f, 0.0962588415f},
-std::array<float,2>{0.523998797f, 0.192506626f},
-std::array<float,2>{0.26288256f, 0.68221277f},
-std::array<float,2>{0.756441355f, 0.903951228f},
-std::array<float,2>{0.125293404f, 0.337742716f},
-std::array<float,2>{0.624301553f, 0.483622849f},
-std::array<float,2>{0.358919263f, 0.789979279f},
-std::array<float,2>{0.87060982f, 0.599918067f},
-std::array<float,2>{0.19409959f, 0.0483136661f},
-std::array<float,2>{0.917283297f, 0.170396894f},
-std::array<float,2>{0.118164547f, 0.727179527f},
-std::array<float,2>{0.645189583f, 0.955180526f},
-std::array<float,2>{0.487116873f, 0.283770889f},
-std::array<float,2>{0.805098355f, 0.367750943f},
-std::array<float,2>{0.185530275f, 0.916569412f},
-std::array<float,2>{0.555069685f, 0.655893803f},
-std::array<float,2>{0.306177348f, 0.221499965f},
-std::array<float,2>{0.716751873f, 0.0677523538f},
-std::array<float,2>{0.398032784f, 0.520409584f},
-std::array<float,2>{0.995916784f, 0.849180579f},
-std::array<float,2>{0.0169958863f, 0.430398762f},
-std::array<float,2>{0.53351903f, 0.313606739f},
-std::array<float,2>{0.285823733f, 0.876650155f},
-std::array<float,2>{0.791925311f, 0.669681132f},
-std::array<float,2>{0.167117536f, 0.206286043f},
-std::array<float,2>{0.981100261f, 0.116102979f},
-std::array<float,2>{0.00251623685f, 0.531910002f},
-std::array<float,2>{0.701415479f, 0.817489684f},
-std::array<float,2>{0.390091598f, 0.388175666f},
-std::array<float,2>{0.853064239f, 0.448070258f},
-std::array<float,2>{0.218369156f, 0.762236834f},
-std::array<float,2>{0.607089639f, 0.589277983f},
-std::array<float,2>{0.364301562f, 0.0284669213f},
-std::array<float,2>{0.639487565f, 0.146517456f},
-std::array<float,2>{0.480742514f, 0.699717224f},
-std::array<float,2>{0.93309015f, 0.986103117f},
-std::array<float,2>{0.0951759964f, 0.27323395f},
-std::array<float,2>{0.732920945f, 0.414246619f},
-std::array<float,2>{0.41816926f, 0.86139071f},
-std::array<float,2>{0.956721783f, 0.515036166f},
-std::array<float,2>{0.0316175707f, 0.0783893913f},
-std::array<float,2>{0.766692102f, 0.249718621f},
-std::array<float,2>{0.151426628f, 0.637758255f},
-std::array<float,2>{0.513726473f, 0.927459419f},
-std::array<float,2>{0.268431574f, 0.345916778f},
-std::array<float,2>{0.880969703f, 0.300499678f},
-std::array<float,2>{0.0904364586f, 0.94369632f},
-std::array<float,2>{0.659760475f, 0.747487426f},
-std::array<float,2>{0.459267855f, 0.18741712f},
-std::array<float,2>{0.57444942f, 0.0429445133f},
-std::array<float,2>{0.343344212f, 0.620444596f},
-std::array<float,2>{0.815522969f, 0.809826314f},
-std::array<float,2>{0.244085163f, 0.490178943f},
-std::array<float,2>{0.740280807f, 0.309532404f},
-std::array<float,2>{0.436213315f, 0.951294541f},
-std::array<float,2>{0.945141673f, 0.737040818f},
-std::array<float,2>{0.0482384153f, 0.171910882f},
-std::array<float,2>{0.750790119f, 0.034661904f},
-std::array<float,2>{0.131336108f, 0.612233162f},
-std::array<float,2>{0.530568063f, 0.799952567f},
-std::array<float,2>{0.260928512f, 0.492338032f},
-std::array<float,2>{0.891104817f, 0.4136208f},
-std::array<float,2>{0.0680847391f, 0.870756507f},
-std::array<float,2>{0.67765826f, 0.50516957f},
-std::array<float,2>{0.453043878f, 0.0916413069f},
-std::array<float,2>{0.585006535f, 0.2377823f},
-std::array<float,2>{0.323756546f, 0.632707238f},
-std::array<float,2>{0.836052418f, 0.931252956f},
-std::array<float,2>{0.224101231f, 0.353735626f},
-std::array<float,2>{0.559295535f, 0.440013379f},
-std::array<float,2>{0.310819507f, 0.755985439f},
-std::array<float,2>{0.81093359f, 0.579793513f},
-std::array<float,2>{0.180171162f, 0.0198421106f},
-std::array<float,2>{0.998227358f, 0.151399434f},
-std::array<float,2>{0.023374293f, 0.695174396f},
-std::array<float,2>{0.713196158f, 0.998319447f},
-std::array<float,2>{0.391921788f, 0.277018905f},
-std::array<float,2>{0.87181294f, 0.327895343f},
-std::array<float,2>{0.189565316f, 0.884986639f},
-std::array<float,2>{0.620655894f, 0.656647861f},
-std::array<float,2>{0.354878336f, 0.214536324f},
-std::array<float,2>{0.641609192f, 0.121973902f},
-std::array<float,2>{0.488420874f, 0.542532861f},
-std::array<float,2>{0.921160817f, 0.821757555f},
-std::array<float,2>{0.124008626f, 0.379494607f},
-std::array<float,2>{0.602419376f, 0.365287572f},
-std::array<float,2>{0.36017701f, 0.906536758f},
-std::array<float,2>{0.856812656f, 0.647746384f},
-std::array<float,2>{0.213353008f, 0.231234863f},
-std::array<float,2>{0.936517179f, 0.0723277926f},
-std::array<float,2>{0.0979983062f, 0.526590526f},
-std::array<float,2>{0.633687675f, 0.855139136f},
-std::array<float,2>{0.479593009f, 0.429075241f},
-std::array<float,2>{0.796451747f, 0.471024752f},
-std::array<float,2>{0.170326248f, 0.783405602f},
-std::array<float,2>{0.538746536f, 0.606528878f},
-std::array<float,2>{0.282381147f, 0.0588876307f},
-std::array<float,2>{0.697319865f, 0.157305732f},
-std::array<float,2>{0.385630548f, 0.720698416f},
-std::array<float,2>{0.978920579f, 0.967106938f},
-std::array<float,2>{0.00744926836f, 0.296451181f},
-std::array<float,2>{0.661680996f, 0.403000623f},
-std::array<float,2>{0.454950333f, 0.835195541f},
-std::array<float,2>{0.878123641f, 0.557925463f},
-std::array<float,2>{0.0895487517f, 0.107170373f},
-std::array<float,2>{0.819593966f, 0.197255045f},
-std::array<float,2>{0.248800501f, 0.677145064f},
-std::array<float,2>{0.571162045f, 0.891865969f},
-std::array<float,2>{0.338095158f, 0.330451399f},
-std::array<float,2>{0.959088862f, 0.25266391f},
-std::array<float,2>{0.037598487f, 0.977755249f},
-std::array<float,2>{0.726861477f, 0.709888875f},
-std::array<float,2>{0.417480677f, 0.128689766f},
-std::array<float,2>{0.510621846f, 0.00390454824f},
-std::array<float,2>{0.271737397f, 0.574109674f},
-std::array<float,2>{0.772360981f, 0.771108687f},
-std::array<float,2>{0.153238326f, 0.464020163f},
-std::array<float,2>{0.627487659f, 0.341017574f},
-std::array<float,2>{0.475713134f, 0.901208282f},
-std::array<float,2>{0.926221669f, 0.683607459f},
-std::array<float,2>{0.107403316f, 0.188201413f},
-std::array<float,2>{0.849091828f, 0.101454705f},
-std::array<float,2>{0.206011683f, 0.551489592f},
-std::array<float,2>{0.593841493f, 0.838775456f},
-std::array<float,2>{0.369043291f, 0.396517545f},
-std::array<float,2>{0.975138426f, 0.456569403f},
-std::array<float,2>{0.0141392937f, 0.78074795f},
-std::array<float,2>{0.69399637f, 0.567733288f},
-std::array<float,2>{0.375186741f, 0.0145278666f},
-std::array<float,2>{0.539815247f, 0.13731584f},
-std::array<float,2>{0.291882157f, 0.717855632f},
-std::array<float,2>{0.785357177f, 0.970222652f},
-std::array<float,2>{0.163174346f, 0.261250526f},
-std::array<float,2>{0.565212667f, 0.434327155f},
-std::array<float,2>{0.332137704f, 0.847585142f},
-std::array<float,2>{0.82780093f, 0.517303884f},
-std::array<float,2>{0.241073117f, 0.0651028007f},
-std::array<float,2>{0.888291717f, 0.223671615f},
-std::array<float,2>{0.0853596702f, 0.650053144f},
-std::array<float,2>{0.667042494f, 0.918790102f},
-std::array<float,2>{0.466266572f, 0.373894572f},
-std::array<float,2>{0.777173221f, 0.288348198f},
-std::array<float,2>{0.145305574f, 0.957221985f},
-std::array<float,2>{0.507297456f, 0.730545521f},
-std::array<float,2>{0.277346313f, 0.167558804f},
-std::array<float,2>{0.721800864f, 0.0545152575f},
-std::array<float,2>{0.413540959f, 0.597100198f},
-std::array<float,2>{0.965134382f, 0.79476428f},
-std::array<float,2>{0.0410004817f, 0.479889631f},
-std::array<float,2>{0.522188723f, 0.267510563f},
-std::array<float,2>{0.257219851f, 0.990237832f},
-std::array<float,2>{0.762022197f, 0.696353316f},
-std::array<float,2>{0.136964381f, 0.141782939f},
-std::array<float,2>{0.946238399f, 0.0242409073f},
-std::array<float,2>{0.0588307194f, 0.592250645f},
-std::array<float,2>{0.743656337f, 0.760071278f},
-std::array<float,2>{0.424780458f, 0.450074464f},
-std::array<float,2>{0.830906749f, 0.384009391f},
-std::array<float,2>{0.233740285f, 0.814016163f},
-std::array<float,2>{0.587263584f, 0.538899422f},
-std::array<float,2>{0.317433536f, 0.110425174f},
-std::array<float,2>{0.686668158f, 0.210687801f},
-std::array<float,2>{0.438912302f, 0.665420532f},
-std::array<float,2>{0.899468899f, 0.881032884f},
-std::array<float,2>{0.0732025877f, 0.317660391f},
-std::array<float,2>{0.704686105f, 0.487903267f},
-std::array<float,2>{0.39865765f, 0.807375014f},
-std::array<float,2>{0.987784266f, 0.623633683f},
-std::array<float,2>{0.0281539224f, 0.0465248302f},
-std::array<float,2>{0.798616529f, 0.181790665f},
-std::array<float,2>{0.179404423f, 0.74424684f},
-std::array<float,2>{0.551760197f, 0.939463079f},
-std::array<float,2>{0.298221499f, 0.303149968f},
-std::array<float,2>{0.90696162f, 0.347983211f},
-std::array<float,2>{0.114270449f, 0.925742328f},
-std::array<float,2>{0.651083052f, 0.636692345f},
-std::array<float,2>{0.498072892f, 0.242875233f},
-std::array<float,2>{0.610801816f, 0.0849493444f},
-std::array<float,2>{0.348940015f, 0.510338545f},
-std::array<float,2>{0.865837157f, 0.865614355f},
-std::array<float,2>{0.19684127f, 0.420597553f},
-std::array<float,2>{0.708163559f, 0.332978338f},
-std::array<float,2>{0.403998464f, 0.895962536f},
-std::array<float,2>{0.988381922f, 0.673008025f},
-std::array<float,2>{0.0242029186f, 0.200198054f},
-std::array<float,2>{0.803169131f, 0.103425831f},
-std::array<float,2>{0.173346594f, 0.560861051f},
-std::array<float,2>{0.548149824f, 0.828632295f},
-std::array<float,2>{0.303278893f, 0.399218023f},
-std::array<float,2>{0.910898983f, 0.468260884f},
-std::array<float,2>{0.109383009f, 0.76743263f},
-std::array<float,2>{0.652356088f, 0.575550199f},
-std::array<float,2>{0.493950605f, 0.00535598304f},
-std::array<float,2>{0.616253078f, 0.129710346f},
-std::array<float,2>{0.34431693f, 0.704353273f},
-std::array<float,2>{0.86095494f, 0.983572483f},
-std::array<float,2>{0.200334683f, 0.256012678f},
-std::array<float,2>{0.515798807f, 0.423430324f},
-std::array<float,2>{0.250277102f, 0.858349979f},
-std::array<float,2>{0.760705173f, 0.530990899f},
-std::array<float,2>{0.136198729f, 0.075028263f},
-std::array<float,2>{0.950064659f, 0.227615267f},
-std::array<float,2>{0.0547056608f, 0.64348799f},
-std::array<float,2>{0.748265564f, 0.913974524f},
-std::array<float,2>{0.426631838f, 0.36028862f},
-std::array<float,2>{0.83386749f, 0.28973341f},
-std::array<float,2>{0.227288947f, 0.962438166f},
-std::array<float,2>{0.592231333f, 0.723175406f},
-std::array<float,2>{0.314822137f, 0.163130492f},
-std::array<float,2>{0.682454586f, 0.0554767847f},
-std::array<float,2>{0.442397654f, 0.603180289f},
-std::array<float,2>{0.903537989f, 0.787905931f},
-std::array<float,2>{0.0755270272f, 0.476317585f},
-std::array<float,2>{0.56730777f, 0.280216426f},
-std::array<float,2>{0.328179449f, 0.99222821f},
-std::array<float,2>{0.820379794f, 0.690077245f},
-std::array<float,2>{0.235292941f, 0.154263437f},
-std::array<float,2>{0.885149598f, 0.0156450458f},
-std::array<float,2>{0.0797442868f, 0.582911611f},
-std::array<float,2>{0.668651164f, 0.753830016f},
-std::array<float,2>{0.461215228f, 0.445020527f},
-std::array<float,2>{0.779703856f, 0.376506567f},
-std::array<float,2>{0.140822217f, 0.825460434f},
-std::array<float,2>{0.503544688f, 0.545467496f},
-std::array<float,2>{0.275765479f, 0.117679305f},
-std::array<float,2>{0.724405169f, 0.217565015f},
-std::array<float,2>{0.408995658f, 0.661972523f},
-std::array<float,2>{0.964837551f, 0.88928026f},
-std::array<float,2>{0.0444372706f, 0.323720962f},
-std::array<float,2>{0.632743418f, 0.496249616f},
-std::array<float,2>{0.471219003f, 0.801960766f},
-std::array<float,2>{0.922746778f, 0.613813639f},
-std::array<float,2>{0.105262987f, 0.0371582694f},
-std::array<float,2>{0.844824851f, 0.178376809f},
-std::array<float,2>{0.210118845f, 0.739067972f},
-std::array<float,2>{0.600324512f, 0.948476732f},
-std::array<float,2>{0.372641444f, 0.30494678f},
-std::array<float,2>{0.969590485f, 0.355631024f},
-std::array<float,2>{0.0102162976f, 0.935456336f},
-std::array<float,2>{0.690878332f, 0.627202213f},
-std::array<float,2>{0.37957114f, 0.241352469f},
-std::array<float,2>{0.54427278f, 0.0895592943f},
-std::array<float,2>{0.295494139f, 0.502005935f},
-std::array<float,2>{0.783347726f, 0.8745929f},
-std::array<float,2>{0.156762421f, 0.408262908f},
-std::array<float,2>{0.6590873f, 0.297850937f},
-std::array<float,2>{0.460432082f, 0.942812204f},
-std::array<float,2>{0.882380247f, 0.748713851f},
-std::array<float,2>{0.09121117f, 0.184864193f},
-std::array<float,2>{0.815223098f, 0.0408361666f},
-std::array<float,2>{0.242253408f, 0.618849039f},
-std::array<float,2>{0.575300217f, 0.811031163f},
-std::array<float,2>{0.342707396f, 0.490890294f},
-std::array<float,2>{0.955637813f, 0.416571438f},
-std::array<float,2>{0.0326357409f, 0.859842181f},
-std::array<float,2>{0.73420918f, 0.513522208f},
-std::array<float,2>{0.419508874f, 0.0813356042f},
-std::array<float,2>{0.515529573f, 0.246147364f},
-std::array<float,2>{0.269303203f, 0.639398277f},
-std::array<float,2>{0.766050637f, 0.928801477f},
-std::array<float,2>{0.15135406f, 0.344358355f},
-std::array<float,2>{0.606204331f, 0.446718067f},
-std::array<float,2>{0.363629699f, 0.765373647f},
-std::array<float,2>{0.852402627f, 0.587638021f},
-std::array<float,2>{0.217573225f, 0.0311983805f},
-std::array<float,2>{0.931973815f, 0.145134702f},
-std::array<float,2>{0.0940930173f, 0.701967955f},
-std::array<float,2>{0.640539944f, 0.987849712f},
-std::array<float,2>{0.481465936f, 0.271095932f},
-std::array<float,2>{0.79226464f, 0.315183491f},
-std::array<float,2>{0.166660503f, 0.87880981f},
-std::array<float,2>{0.534845531f, 0.670329511f},
-std::array<float,2>{0.287103415f, 0.203558803f},
-std::array<float,2>{0.702935636f, 0.114115618f},
-std::array<float,2>{0.388971597f, 0.533626735f},
-std::array<float,2>{0.982414305f, 0.819014668f},
-std::array<float,2>{0.00342439837f, 0.389449149f},
-std::array<float,2>{0.555676579f, 0.369580716f},
-std::array<float,2>{0.305329829f, 0.915222943f},
-std::array<float,2>{0.806542635f, 0.652496338f},
-std::array<float,2>{0.184042424f, 0.220064968f},
-std::array<float,2>{0.995061934f, 0.0701190978f},
-std::array<float,2>{0.0164900869f, 0.522850871f},
-std::array<float,2>{0.715796232f, 0.850962579f},
-std::array<float,2>{0.39734152f, 0.433459669f},
-std::array<float,2>{0.869273722f, 0.482268572f},
-std::array<float,2>{0.195037618f, 0.791189015f},
-std::array<float,2>{0.623752236f, 0.598841429f},
-std::array<float,2>{0.35815084f, 0.0497673899f},
-std::array<float,2>{0.645533741f, 0.169413984f},
-std::array<float,2>{0.487827867f, 0.729833663f},
-std::array<float,2>{0.916439831f, 0.953641117f},
-std::array<float,2>{0.118061133f, 0.2822918f},
-std::array<float,2>{0.738269567f, 0.394284338f},
-std::array<float,2>{0.432125896f, 0.841552436f},
-std::array<float,2>{0.941075087f, 0.5484339f},
-std::array<float,2>{0.0515803099f, 0.095425047f},
-std::array<float,2>{0.757699847f, 0.194012791f},
-std::array<float,2>{0.12606594f, 0.680927217f},
-std::array<float,2>{0.524898708f, 0.905720592f},
-std::array<float,2>{0.261873752f, 0.337971061f},
-std::array<float,2>{0.896319926f, 0.26373589f},
-std::array<float,2>{0.0645795241f, 0.976236105f},
-std::array<float,2>{0.672008932f, 0.712051928f},
-std::array<float,2>{0.446769834f, 0.134236619f},
-std::array<float,2>{0.580903828f, 0.0109679447f},
-std::array<float,2>{0.325566471f, 0.565398991f},
-std::array<float,2>{0.840651214f, 0.774708509f},
-std::array<float,2>{0.220469609f, 0.458889723f},
-std::array<float,2>{0.728236735f, 0.251779079f},
-std::array<float,2>{0.416213542f, 0.979816139f},
-std::array<float,2>{0.960766673f, 0.708343208f},
-std::array<float,2>{0.0388718098f, 0.126445785f},
-std::array<float,2>{0.772683561f, 0.000297990802f},
-std::array<float,2>{0.154293165f, 0.571442187f},
-std::array<float,2>{0.511087656f, 0.773250222f},
-std::array<float,2>{0.273172706f, 0.461887836f},
-std::array<float,2>{0.877257884f, 0.404506773f},
-std::array<float,2>{0.0888474211f, 0.832609177f},
-std::array<float,2>{0.660372019f, 0.555642009f},
-std::array<float,2>{0.4540295f, 0.108057261f},
-std::array<float,2>{0.571883976f, 0.198328555f},
-std::array<float,2>{0.338991493f, 0.678591847f},
-std::array<float,2>{0.818408847f, 0.893328011f},
-std::array<float,2>{0.249381319f, 0.329787731f},
-std::array<float,2>{0.537588775f, 0.469446331f},
-std::array<float,2>{0.281420797f, 0.782059014f},
-std::array<float,2>{0.795535624f, 0.608660579f},
-std::array<float,2>{0.170950219f, 0.0607267022f},
-std::array<float,2>{0.979641378f, 0.159158617f},
-std::array<float,2>{0.00654723588f, 0.721631885f},
-std::array<float,2>{0.698925793f, 0.966213048f},
-std::array<float,2>{0.385914057f, 0.293123275f},
-std::array<float,2>{0.855613589f, 0.364288002f},
-std::array<float,2>{0.214353889f, 0.90897733f},
-std::array<float,2>{0.602721632f, 0.645421684f},
-std::array<float,2>{0.360409439f, 0.234065875f},
-std::array<float,2>{0.633915782f, 0.071100235f},
-std::array<float,2>{0.479421377f, 0.52480638f},
-std::array<float,2>{0.937484622f, 0.851674795f},
-std::array<float,2>{0.0991121083f, 0.426517069f},
-std::array<float,2>{0.620099247f, 0.324431956f},
-std::array<float,2>{0.354204118f, 0.882907152f},
-std::array<float,2>{0.873039603f, 0.659263372f},
-std::array<float,2>{0.191174358f, 0.212794319f},
-std::array<float,2>{0.919987619f, 0.124724403f},
-std::array<float,2>{0.124406345f, 0.540823996f},
-std::array<float,2>{0.64111346f, 0.823850155f},
-std::array<float,2>{0.489928126f, 0.381903946f},
-std::array<float,2>{0.811950207f, 0.4377819f},
-std::array<float,2>{0.180741221f, 0.755403101f},
-std::array<float,2>{0.560257792f, 0.581438124f},
-std::array<float,2>{0.312003344f, 0.0220778175f},
-std::array<float,2>{0.714528024f, 0.149410054f},
-std::array<float,2>{0.391228378f, 0.693030536f},
-std::array<float,2>{0.999917984f, 0.997786462f},
-std::array<float,2>{0.0218582284f, 0.273479015f},
-std::array<float,2>{0.676436841f, 0.410504401f},
-std::array<float,2>{0.451429367f, 0.867234826f},
-std::array<float,2>{0.892245412f, 0.505888581f},
-std::array<float,2>{0.0667114481f, 0.0919000432f},
-std::array<float,2>{0.837716937f, 0.234865934f},
-std::array<float,2>{0.223608658f, 0.630831122f},
-std::array<float,2>{0.584506214f, 0.932487309f},
-std::array<float,2>{0.322481632f, 0.352506012f},
-std::array<float,2>{0.944060743f, 0.312161326f},
-std::array<float,2>{0.0471987166f, 0.949653804f},
-std::array<float,2>{0.742008984f, 0.735238314f},
-std::array<float,2>{0.436861634f, 0.175560251f},
-std::array<float,2>{0.530072093f, 0.0322992466f},
-std::array<float,2>{0.260229558f, 0.611264765f},
-std::array<float,2>{0.751440108f, 0.798321545f},
-std::array<float,2>{0.13229692f, 0.495346636f},
-std::array<float,2>{0.651698828f, 0.350060582f},
-std::array<float,2>{0.499544561f, 0.923509896f},
-std::array<float,2>{0.907697618f, 0.633507073f},
-std::array<float,2>{0.114145033f, 0.245254397f},
-std::array<float,2>{0.866473258f, 0.0838314146f},
-std::array<float,2>{0.196170807f, 0.508102238f},
-std::array<float,2>{0.609823287f, 0.863925755f},
-std::array<float,2>{0.34802255f, 0.41812852f},
-std::array<float,2>{0.986823618f, 0.484734446f},
-std::array<float,2>{0.0284396f, 0.805034757f},
-std::array<float,2>{0.703226089f, 0.622862697f},
-std::array<float,2>{0.400210351f, 0.0440322272f},
-std::array<float,2>{0.550963879f, 0.179831222f},
-std::array<float,2>{0.297420561f, 0.744040668f},
-std::array<float,2>{0.79693073f, 0.937632978f},
-std::array<float,2>{0.17836231f, 0.302328676f},
-std::array<float,2>{0.586809099f, 0.385644019f},
-std::array<float,2>{0.3172777f, 0.814705312f},
-std::array<float,2>{0.831803977f, 0.536925316f},
-std::array<float,2>{0.232781172f, 0.112633906f},
-std::array<float,2>{0.898964107f, 0.207685351f},
-std::array<float,2>{0.0736027658f, 0.66770184f},
-std::array<float,2>{0.686408997f, 0.880770445f},
-std::array<float,2>{0.438411295f, 0.318653941f},
-std::array<float,2>{0.76363951f, 0.268337548f},
-std::array<float,2>{0.138047323f, 0.989997506f},
-std::array<float,2>{0.52330935f, 0.697456419f},
-std::array<float,2>{0.255921602f, 0.14354521f},
-std::array<float,2>{0.742662907f, 0.0262404643f},
-std::array<float,2>{0.425210923f, 0.589849174f},
-std::array<float,2>{0.947232485f, 0.759331107f},
-std::array<float,2>{0.060125906f, 0.453039706f},
-std::array<float,2>{0.506749988f, 0.286960572f},
-std::array<float,2>{0.279277772f, 0.960379362f},
-std::array<float,2>{0.775859892f, 0.734166026f},
-std::array<float,2>{0.146099836f, 0.164766759f},
-std::array<float,2>{0.965943635f, 0.0511061139f},
-std::array<float,2>{0.0396474637f, 0.594360054f},
-std::array<float,2>{0.720827162f, 0.796161473f},
-std::array<float,2>{0.412377894f, 0.478184611f},
-std::array<float,2>{0.826853216f, 0.436987698f},
-std::array<float,2>{0.241481066f, 0.845073879f},
-std::array<float,2>{0.565962613f, 0.51838398f},
-std::array<float,2>{0.333631516f, 0.0633143708f},
-std::array<float,2>{0.66612488f, 0.224869013f},
-std::array<float,2>{0.465334743f, 0.652155995f},
-std::array<float,2>{0.886902809f, 0.92097491f},
-std::array<float,2>{0.084701851f, 0.372039109f},
-std::array<float,2>{0.694786191f, 0.453174323f},
-std::array<float,2>{0.376870096f, 0.777861834f},
-std::array<float,2>{0.976297319f, 0.569757819f},
-std::array<float,2>{0.0150736766f, 0.0126982005f},
-std::array<float,2>{0.786468089f, 0.13944535f},
-std::array<float,2>{0.162753016f, 0.715772629f},
-std::array<float,2>{0.540165246f, 0.971453846f},
-std::array<float,2>{0.292297602f, 0.259002119f},
-std::array<float,2>{0.92682153f, 0.34362784f},
-std::array<float,2>{0.1063627f, 0.898630619f},
-std::array<float,2>{0.628554344f, 0.686491907f},
-std::array<float,2>{0.474964261f, 0.190194368f},
-std::array<float,2>{0.595378578f, 0.0978391021f},
-std::array<float,2>{0.367752969f, 0.554336488f},
-std::array<float,2>{0.848000944f, 0.837730885f},
-std::array<float,2>{0.206866324f, 0.395733207f},
-std::array<float,2>{0.746820271f, 0.363018185f},
-std::array<float,2>{0.429412305f, 0.91155982f},
-std::array<float,2>{0.951609075f, 0.640837848f},
-std::array<float,2>{0.0582949854f, 0.230071545f},
-std::array<float,2>{0.759549499f, 0.0772325099f},
-std::array<float,2>{0.133212775f, 0.528900504f},
-std::array<float,2>{0.517683923f, 0.855589509f},
-std::array<float,2>{0.253096372f, 0.425073057f},
-std::array<float,2>{0.904720724f, 0.473912865f},
-std::array<float,2>{0.0774903744f, 0.785978079f},
-std::array<float,2>{0.680371463f, 0.604036808f},
-std::array<float,2>{0.444219172f, 0.0579780862f},
-std::array<float,2>{0.591504574f, 0.161188915f},
-std::array<float,2>{0.31399262f, 0.725055575f},
-std::array<float,2>{0.834207356f, 0.963217437f},
-std::array<float,2>{0.228798285f, 0.291718274f},
-std::array<float,2>{0.549952626f, 0.40153724f},
-std::array<float,2>{0.300901681f, 0.831469297f},
-std::array<float,2>{0.802631199f, 0.559839606f},
-std::array<float,2>{0.174209371f, 0.104309388f},
-std::array<float,2>{0.992052436f, 0.202241942f},
-std::array<float,2>{0.0267982017f, 0.674197555f},
-std::array<float,2>{0.709636509f, 0.897126555f},
-std::array<float,2>{0.405710518f, 0.335440338f},
-std::array<float,2>{0.863023221f, 0.255277604f},
-std::array<float,2>{0.20304209f, 0.980918407f},
-std::array<float,2>{0.614341199f, 0.705467343f},
-std::array<float,2>{0.346301645f, 0.132277682f},
-std::array<float,2>{0.654675186f, 0.00728867855f},
-std::array<float,2>{0.494645417f, 0.576711416f},
-std::array<float,2>{0.912386179f, 0.767845809f},
-std::array<float,2>{0.112903237f, 0.466576457f},
-std::array<float,2>{0.599607527f, 0.308225244f},
-std::array<float,2>{0.374783695f, 0.946098149f},
-std::array<float,2>{0.845892251f, 0.741797745f},
-std::array<float,2>{0.207497194f, 0.177610815f},
-std::array<float,2>{0.925029278f, 0.0355526805f},
-std::array<float,2>{0.102295384f, 0.615980029f},
-std::array<float,2>{0.630235553f, 0.803608179f},
-std::array<float,2>{0.469207197f, 0.498534888f},
-std::array<float,2>{0.782945752f, 0.407720447f},
-std::array<float,2>{0.160086751f, 0.871528268f},
-std::array<float,2>{0.544983268f, 0.500598907f},
-std::array<float,2>{0.293880045f, 0.0861499086f},
-std::array<float,2>{0.68822962f, 0.238988683f},
-std::array<float,2>{0.382082045f, 0.626282394f},
-std::array<float,2>{0.972097039f, 0.937227011f},
-std::array<float,2>{0.00901463255f, 0.358282268f},
-std::array<float,2>{0.670527577f, 0.442285776f},
-std::array<float,2>{0.463942051f, 0.750023901f},
-std::array<float,2>{0.883282125f, 0.584989667f},
-std::array<float,2>{0.0809772164f, 0.0176803246f},
-std::array<float,2>{0.822524548f, 0.154476821f},
-std::array<float,2>{0.237162217f, 0.688940942f},
-std::array<float,2>{0.570188761f, 0.994798005f},
-std::array<float,2>{0.330569744f, 0.277419299f},
-std::array<float,2>{0.9613446f, 0.321184099f},
-std::array<float,2>{0.0460795984f, 0.888130605f},
-std::array<float,2>{0.725380599f, 0.662729025f},
-std::array<float,2>{0.406938463f, 0.214865208f},
-std::array<float,2>{0.501696825f, 0.12026231f},
-std::array<float,2>{0.274216235f, 0.544302106f},
-std::array<float,2>{0.778123617f, 0.826850712f},
-std::array<float,2>{0.142652661f, 0.378437519f},
-std::array<float,2>{0.636762798f, 0.27243939f},
-std::array<float,2>{0.484340012f, 0.984456897f},
-std::array<float,2>{0.931332529f, 0.701069474f},
-std::array<float,2>{0.0963048786f, 0.148179114f},
-std::array<float,2>{0.853820801f, 0.027714178f},
-std::array<float,2>{0.215593487f, 0.588442087f},
-std::array<float,2>{0.608811617f, 0.762935519f},
-std::array<float,2>{0.367040545f, 0.448716521f},
-std::array<float,2>{0.984237015f, 0.387537688f},
-std::array<float,2>{0.00145045982f, 0.816738963f},
-std::array<float,2>{0.69929713f, 0.53270638f},
-std::array<float,2>{0.387104422f, 0.116630994f},
-std::array<float,2>{0.532043397f, 0.205675721f},
-std::array<float,2>{0.288452119f, 0.668039799f},
-std::array<float,2>{0.790347159f, 0.875235021f},
-std::array<float,2>{0.164333612f, 0.31334734f},
-std::array<float,2>{0.57657373f, 0.489242852f},
-std::array<float,2>{0.34108454f, 0.80861032f},
-std::array<float,2>{0.813991606f, 0.619487941f},
-std::array<float,2>{0.244657129f, 0.0418629907f},
-std::array<float,2>{0.879796207f, 0.186448663f},
-std::array<float,2>{0.0922623873f, 0.746515691f},
-std::array<float,2>{0.656923831f, 0.94449389f},
-std::array<float,2>{0.457039237f, 0.298908234f},
-std::array<float,2>{0.769131064f, 0.346903265f},
-std::array<float,2>{0.14887093f, 0.925880492f},
-std::array<float,2>{0.512414694f, 0.63678062f},
-std::array<float,2>{0.265656918f, 0.248860568f},
-std::array<float,2>{0.732177675f, 0.0799181238f},
-std::array<float,2>{0.420914233f, 0.514142156f},
-std::array<float,2>{0.954029441f, 0.862425268f},
-std::array<float,2>{0.0335549638f, 0.415150613f},
-std::array<float,2>{0.527027488f, 0.336765587f},
-std::array<float,2>{0.263919473f, 0.902754784f},
-std::array<float,2>{0.75522536f, 0.683357596f},
-std::array<float,2>{0.128566608f, 0.192169383f},
-std::array<float,2>{0.938040316f, 0.0970490202f},
-std::array<float,2>{0.0531702563f, 0.550400198f},
-std::array<float,2>{0.735581636f, 0.84374094f},
-std::array<float,2>{0.431607932f, 0.391099036f},
-std::array<float,2>{0.842960179f, 0.459089339f},
-std::array<float,2>{0.222417802f, 0.775544107f},
-std::array<float,2>{0.578819096f, 0.562819839f},
-std::array<float,2>{0.326247096f, 0.00821752939f},
-std::array<float,2>{0.674375594f, 0.13564983f},
-std::array<float,2>{0.447533697f, 0.714116514f},
-std::array<float,2>{0.898388803f, 0.974088728f},
-std::array<float,2>{0.0632204264f, 0.262846649f},
-std::array<float,2>{0.717511654f, 0.431273669f},
-std::array<float,2>{0.395238668f, 0.848196387f},
-std::array<float,2>{0.993076324f, 0.520891428f},
-std::array<float,2>{0.0191936996f, 0.0668027103f},
-std::array<float,2>{0.807932496f, 0.222336456f},
-std::array<float,2>{0.187213048f, 0.654482543f},
-std::array<float,2>{0.558132648f, 0.917146802f},
-std::array<float,2>{0.307783812f, 0.368791848f},
-std::array<float,2>{0.914855003f, 0.284402817f},
-std::array<float,2>{0.119611122f, 0.956280708f},
-std::array<float,2>{0.648393631f, 0.728477299f},
-std::array<float,2>{0.48453036f, 0.170953304f},
-std::array<float,2>{0.621838689f, 0.0470787063f},
-std::array<float,2>{0.355561793f, 0.600939989f},
-std::array<float,2>{0.868686974f, 0.790117502f},
-std::array<float,2>{0.191677377f, 0.482450783f},
-std::array<float,2>{0.69557339f, 0.295075536f},
-std::array<float,2>{0.384030014f, 0.968068659f},
-std::array<float,2>{0.978409648f, 0.719494283f},
-std::array<float,2>{0.00519823795f, 0.156839177f},
-std::array<float,2>{0.793224454f, 0.0600301698f},
-std::array<float,2>{0.168009043f, 0.606139183f},
-std::array<float,2>{0.535763562f, 0.784324586f},
-std::array<float,2>{0.283240467f, 0.471732765f},
-std::array<float,2>{0.934541166f, 0.428598553f},
-std::array<float,2>{0.101116404f, 0.854108512f},
-std::array<float,2>{0.636323512f, 0.525398791f},
-std::array<float,2>{0.47739327f, 0.0734141991f},
-std::array<float,2>{0.603519917f, 0.23215808f},
-std::array<float,2>{0.362080246f, 0.646677494f},
-std::array<float,2>{0.858348191f, 0.907746851f},
-std::array<float,2>{0.211931154f, 0.366723061f},
-std::array<float,2>{0.509709835f, 0.46323362f},
-std::array<float,2>{0.271073252f, 0.770196676f},
-std::array<float,2>{0.770395219f, 0.572687268f},
-std::array<float,2>{0.155046046f, 0.00241991039f},
-std::array<float,2>{0.958328009f, 0.127683192f},
-std::array<float,2>{0.0351708941f, 0.710868895f},
-std::array<float,2>{0.729242861f, 0.976828575f},
-std::array<float,2>{0.415993363f, 0.253008962f},
-std::array<float,2>{0.817475379f, 0.331792921f},
-std::array<float,2>{0.246240854f, 0.891218662f},
-std::array<float,2>{0.57390511f, 0.676652491f},
-std::array<float,2>{0.336562604f, 0.195813894f},
-std::array<float,2>{0.663689494f, 0.106343694f},
-std::array<float,2>{0.456908286f, 0.557138026f},
-std::array<float,2>{0.875787973f, 0.834788799f},
-std::array<float,2>{0.0869595483f, 0.404191077f},
-std::array<float,2>{0.58246541f, 0.354800075f},
-std::array<float,2>{0.32105425f, 0.930186212f},
-std::array<float,2>{0.839451015f, 0.631796062f},
-std::array<float,2>{0.225981206f, 0.237266123f},
-std::array<float,2>{0.893448293f, 0.0904264227f},
-std::array<float,2>{0.0685197338f, 0.50456959f},
-std::array<float,2>{0.678963661f, 0.869398654f},
-std::array<float,2>{0.449561268f, 0.413005948f},
-std::array<float,2>{0.753230572f, 0.493690819f},
-std::array<float,2>{0.130406827f, 0.799656808f},
-std::array<float,2>{0.528377891f, 0.612399876f},
-std::array<float,2>{0.257883847f, 0.034007553f},
-std::array<float,2>{0.739654005f, 0.173292637f},
-std::array<float,2>{0.434653401f, 0.737604618f},
-std::array<float,2>{0.942479074f, 0.952942312f},
-std::array<float,2>{0.0495708883f, 0.310010701f},
-std::array<float,2>{0.643048823f, 0.380055249f},
-std::array<float,2>{0.491472691f, 0.820535839f},
-std::array<float,2>{0.919716537f, 0.541357398f},
-std::array<float,2>{0.122978389f, 0.122127153f},
-std::array<float,2>{0.874421477f, 0.213378862f},
-std::array<float,2>{0.189329714f, 0.658051014f},
-std::array<float,2>{0.617818534f, 0.886195004f},
-std::array<float,2>{0.353450626f, 0.326715082f},
-std::array<float,2>{0.996247113f, 0.275594413f},
-std::array<float,2>{0.0210528672f, 0.999688625f},
-std::array<float,2>{0.711933255f, 0.693872809f},
-std::array<float,2>{0.394167364f, 0.151127487f},
-std::array<float,2>{0.560590625f, 0.0213247761f},
-std::array<float,2>{0.309561074f, 0.578297555f},
-std::array<float,2>{0.809888721f, 0.757410049f},
-std::array<float,2>{0.182948679f, 0.440489411f},
-std::array<float,2>{0.683832109f, 0.317181021f},
-std::array<float,2>{0.440289646f, 0.881916106f},
-std::array<float,2>{0.901428223f, 0.664560616f},
-std::array<float,2>{0.0705516115f, 0.209014475f},
-std::array<float,2>{0.829439461f, 0.109662428f},
-std::array<float,2>{0.232408673f, 0.537625015f},
-std::array<float,2>{0.588539302f, 0.813271523f},
-std::array<float,2>{0.319921166f, 0.383377314f},
-std::array<float,2>{0.948402822f, 0.450413227f},
-std::array<float,2>{0.0620767735f, 0.761277258f},
-std::array<float,2>{0.744872272f, 0.593069971f},
-std::array<float,2>{0.423737466f, 0.0249377787f},
-std::array<float,2>{0.520897448f, 0.141379863f},
-std::array<float,2>{0.254203975f, 0.695841789f},
-std::array<float,2>{0.76381588f, 0.992113471f},
-std::array<float,2>{0.139203459f, 0.266348988f},
-std::array<float,2>{0.611770809f, 0.421829045f},
-std::array<float,2>{0.35118556f, 0.866729498f},
-std::array<float,2>{0.863767505f, 0.511187494f},
-std::array<float,2>{0.19883208f, 0.0858100951f},
-std::array<float,2>{0.9089064f, 0.243767783f},
-std::array<float,2>{0.116047613f, 0.635540724f},
-std::array<float,2>{0.649950266f, 0.924159408f},
-std::array<float,2>{0.497423619f, 0.348916978f},
-std::array<float,2>{0.800127208f, 0.304054558f},
-std::array<float,2>{0.177295059f, 0.940622449f},
-std::array<float,2>{0.552823842f, 0.745596766f},
-std::array<float,2>{0.299091727f, 0.182957917f},
-std::array<float,2>{0.706980228f, 0.0450175777f},
-std::array<float,2>{0.400662988f, 0.624745548f},
-std::array<float,2>{0.985280335f, 0.808048904f},
-std::array<float,2>{0.0310622305f, 0.487089843f},
-std::array<float,2>{0.542096674f, 0.260296553f},
-std::array<float,2>{0.289939344f, 0.968914926f},
-std::array<float,2>{0.787532747f, 0.716896355f},
-std::array<float,2>{0.161832795f, 0.137908459f},
-std::array<float,2>{0.973816633f, 0.0146997878f},
-std::array<float,2>{0.0126840835f, 0.566408217f},
-std::array<float,2>{0.693179071f, 0.779695511f},
-std::array<float,2>{0.378257006f, 0.455495983f},
-std::array<float,2>{0.851377964f, 0.398142993f},
-std::array<float,2>{0.203147143f, 0.838990152f},
-std::array<float,2>{0.596064866f, 0.551759005f},
-std::array<float,2>{0.369146407f, 0.10055954f},
-std::array<float,2>{0.6254915f, 0.18937543f},
-std::array<float,2>{0.473173231f, 0.684709787f},
-std::array<float,2>{0.929483294f, 0.902211189f},
-std::array<float,2>{0.10842666f, 0.340559036f},
-std::array<float,2>{0.718868494f, 0.478592247f},
-std::array<float,2>{0.41072771f, 0.79299432f},
-std::array<float,2>{0.967276871f, 0.59663111f},
-std::array<float,2>{0.0427372605f, 0.0536666811f},
-std::array<float,2>{0.773481846f, 0.166919798f},
-std::array<float,2>{0.148312405f, 0.731683791f},
-std::array<float,2>{0.505279601f, 0.95835942f},
-std::array<float,2>{0.279953122f, 0.28798452f},
-std::array<float,2>{0.888793409f, 0.374825031f},
-std::array<float,2>{0.0837005377f, 0.919687986f},
-std::array<float,2>{0.665185988f, 0.648765802f},
-std::array<float,2>{0.467578441f, 0.223481551f},
-std::array<float,2>{0.564365029f, 0.0656934232f},
-std::array<float,2>{0.335299015f, 0.515697837f},
-std::array<float,2>{0.824267328f, 0.846256495f},
-std::array<float,2>{0.239051297f, 0.435332298f},
-std::array<float,2>{0.744988978f, 0.319441587f},
-std::array<float,2>{0.423475653f, 0.879122078f},
-std::array<float,2>{0.948587298f, 0.666274488f},
-std::array<float,2>{0.062332768f, 0.208466738f},
-std::array<float,2>{0.764125943f, 0.111985035f},
-std::array<float,2>{0.139591351f, 0.535215616f},
-std::array<float,2>{0.520567119f, 0.816141486f},
-std::array<float,2>{0.253967553f, 0.385995984f},
-std::array<float,2>{0.901722014f, 0.451516092f},
-std::array<float,2>{0.0707219988f, 0.758338749f},
-std::array<float,2>{0.683954537f, 0.591742873f},
-std::array<float,2>{0.440128475f, 0.0268479194f},
-std::array<float,2>{0.588684261f, 0.144365758f},
-std::array<float,2>{0.320174128f, 0.698487043f},
-std::array<float,2>{0.829122782f, 0.989151955f},
-std::array<float,2>{0.232045084f, 0.269270152f},
-std::array<float,2>{0.553119957f, 0.419336557f},
-std::array<float,2>{0.298935622f, 0.864889801f},
-std::array<float,2>{0.800024331f, 0.509610832f},
-std::array<float,2>{0.177536353f, 0.0823896602f},
-std::array<float,2>{0.984949112f, 0.244720042f},
-std::array<float,2>{0.0309515391f, 0.633790851f},
-std::array<float,2>{0.706715465f, 0.922568142f},
-std::array<float,2>{0.400600493f, 0.35153836f},
-std::array<float,2>{0.863477468f, 0.300848097f},
-std::array<float,2>{0.199058056f, 0.938574493f},
-std::array<float,2>{0.611407459f, 0.742886662f},
-std::array<float,2>{0.35135603f, 0.181362391f},
-std::array<float,2>{0.650388181f, 0.0434232354f},
-std::array<float,2>{0.497240961f, 0.621907771f},
-std::array<float,2>{0.909098744f, 0.805984378f},
-std::array<float,2>{0.115885496f, 0.485743105f},
-std::array<float,2>{0.595750213f, 0.258555889f},
-std::array<float,2>{0.369552702f, 0.972000122f},
-std::array<float,2>{0.851208746f, 0.716660857f},
-std::array<float,2>{0.20339103f, 0.139976263f},
-std::array<float,2>{0.929297328f, 0.0123654967f},
-std::array<float,2>{0.108855873f, 0.568918407f},
-std::array<float,2>{0.625862777f, 0.778684258f},
-std::array<float,2>{0.473564953f, 0.454686642f},
-std::array<float,2>{0.787293851f, 0.394582093f},
-std::array<float,2>{0.162044451f, 0.836091459f},
-std::array<float,2>{0.54233706f, 0.553306699f},
-std::array<float,2>{0.2896173f, 0.0991831645f},
-std::array<float,2>{0.693060279f, 0.190710768f},
-std::array<float,2>{0.378001511f, 0.68723166f},
-std::array<float,2>{0.97403872f, 0.899641871f},
-std::array<float,2>{0.0123261372f, 0.342411727f},
-std::array<float,2>{0.66550523f, 0.477355212f},
-std::array<float,2>{0.467381477f, 0.795670211f},
-std::array<float,2>{0.889079452f, 0.594878256f},
-std::array<float,2>{0.083902739f, 0.0520559102f},
-std::array<float,2>{0.824554205f, 0.165542677f},
-std::array<float,2>{0.238906592f, 0.732977808f},
-std::array<float,2>{0.564145029f, 0.95991081f},
-std::array<float,2>{0.335103869f, 0.285628349f},
-std::array<float,2>{0.966977537f, 0.372199923f},
-std::array<float,2>{0.0427239165f, 0.920755446f},
-std::array<float,2>{0.719111204f, 0.650642812f},
-std::array<float,2>{0.411009967f, 0.225711733f},
-std::array<float,2>{0.504994512f, 0.0638574362f},
-std::array<float,2>{0.280103266f, 0.518686235f},
-std::array<float,2>{0.773716509f, 0.843855083f},
-std::array<float,2>{0.148180023f, 0.436264068f},
-std::array<float,2>{0.636674702f, 0.294882506f},
-std::array<float,2>{0.477094233f, 0.965484798f},
-std::array<float,2>{0.934162617f, 0.722229958f},
-std::array<float,2>{0.101448581f, 0.159638003f},
-std::array<float,2>{0.858150423f, 0.0621312559f},
-std::array<float,2>{0.212249756f, 0.608284652f},
-std::array<float,2>{0.603799284f, 0.782283664f},
-std::array<float,2>{0.361895472f, 0.470115334f},
-std::array<float,2>{0.978191495f, 0.427435845f},
-std::array<float,2>{0.00501325494f, 0.853184581f},
-std::array<float,2>{0.695543051f, 0.524214149f},
-std::array<float,2>{0.384138286f, 0.0718228221f},
-std::array<float,2>{0.53598702f, 0.232514605f},
-std::array<float,2>{0.283603668f, 0.64600724f},
-std::array<float,2>{0.792986393f, 0.909512997f},
-std::array<float,2>{0.168254241f, 0.36401996f},
-std::array<float,2>{0.574033976f, 0.462522715f},
-std::array<float,2>{0.33673808f, 0.772000551f},
-std::array<float,2>{0.817842543f, 0.570674002f},
-std::array<float,2>{0.246376455f, 0.00131730642f},
-std::array<float,2>{0.875597f, 0.125366703f},
-std::array<float,2>{0.0871954188f, 0.707529306f},
-std::array<float,2>{0.663993001f, 0.979046762f},
-std::array<float,2>{0.456745565f, 0.250903755f},
-std::array<float,2>{0.770242631f, 0.328983784f},
-std::array<float,2>{0.154800788f, 0.893896818f},
-std::array<float,2>{0.509430051f, 0.679601967f},
-std::array<float,2>{0.271408916f, 0.197379038f},
-std::array<float,2>{0.729336083f, 0.108547188f},
-std::array<float,2>{0.41567716f, 0.555952966f},
-std::array<float,2>{0.958124459f, 0.833240509f},
-std::array<float,2>{0.03545269f, 0.405986726f},
-std::array<float,2>{0.528567016f, 0.352581054f},
-std::array<float,2>{0.258180469f, 0.933074951f},
-std::array<float,2>{0.753073573f, 0.629010975f},
-std::array<float,2>{0.130737558f, 0.235811576f},
-std::array<float,2>{0.942701101f, 0.0931398571f},
-std::array<float,2>{0.0494773053f, 0.507031918f},
-std::array<float,2>{0.739353895f, 0.868341088f},
-std::array<float,2>{0.434822321f, 0.411782175f},
-std::array<float,2>{0.839607537f, 0.49432838f},
-std::array<float,2>{0.225619882f, 0.797186375f},
-std::array<float,2>{0.582058072f, 0.609865308f},
-std::array<float,2>{0.320899785f, 0.0319065787f},
-std::array<float,2>{0.678909838f, 0.174427986f},
-std::array<float,2>{0.449255019f, 0.736195624f},
-std::array<float,2>{0.89324826f, 0.950264871f},
-std::array<float,2>{0.0688277781f, 0.31096369f},
-std::array<float,2>{0.712287784f, 0.381522685f},
-std::array<float,2>{0.394304842f, 0.822687447f},
-std::array<float,2>{0.996476114f, 0.53943187f},
-std::array<float,2>{0.0213467553f, 0.123852462f},
-std::array<float,2>{0.809582531f, 0.211785242f},
-std::array<float,2>{0.182727024f, 0.659055591f},
-std::array<float,2>{0.5609442f, 0.884307444f},
-std::array<float,2>{0.309158474f, 0.325585395f},
-std::array<float,2>{0.919470847f, 0.275216252f},
-std::array<float,2>{0.122732863f, 0.996405721f},
-std::array<float,2>{0.642707646f, 0.691763401f},
-std::array<float,2>{0.491313607f, 0.149640262f},
-std::array<float,2>{0.618161082f, 0.0231034197f},
-std::array<float,2>{0.353085041f, 0.580708027f},
-std::array<float,2>{0.874101996f, 0.754071236f},
-std::array<float,2>{0.189203799f, 0.438788652f},
-std::array<float,2>{0.699514925f, 0.270397961f},
-std::array<float,2>{0.386892468f, 0.987085879f},
-std::array<float,2>{0.984056115f, 0.702577293f},
-std::array<float,2>{0.00113419292f, 0.146264002f},
-std::array<float,2>{0.790175259f, 0.0297314152f},
-std::array<float,2>{0.164077178f, 0.586638868f},
-std::array<float,2>{0.531802416f, 0.764572263f},
-std::array<float,2>{0.288142055f, 0.445905596f},
-std::array<float,2>{0.931545615f, 0.390266657f},
-std::array<float,2>{0.0965661705f, 0.819463551f},
-std::array<float,2>{0.637150824f, 0.534646988f},
-std::array<float,2>{0.483967245f, 0.114989191f},
-std::array<float,2>{0.608518243f, 0.204978317f},
-std::array<float,2>{0.366703451f, 0.671808958f},
-std::array<float,2>{0.85361439f, 0.877664626f},
-std::array<float,2>{0.215492785f, 0.315965056f},
-std::array<float,2>{0.512674153f, 0.491591811f},
-std::array<float,2>{0.266055644f, 0.812434852f},
-std::array<float,2>{0.769493341f, 0.617803097f},
-std::array<float,2>{0.148612499f, 0.0392397195f},
-std::array<float,2>{0.953784287f, 0.184108168f},
-std::array<float,2>{0.0332859457f, 0.749577999f},
-std::array<float,2>{0.732183099f, 0.941614747f},
-std::array<float,2>{0.42133382f, 0.298112005f},
-std::array<float,2>{0.814423442f, 0.344971269f},
-std::array<float,2>{0.245012164f, 0.928679109f},
-std::array<float,2>{0.576247036f, 0.63975662f},
-std::array<float,2>{0.341063708f, 0.247433633f},
-std::array<float,2>{0.656983376f, 0.080805108f},
-std::array<float,2>{0.457377046f, 0.512275934f},
-std::array<float,2>{0.879518926f, 0.860735893f},
-std::array<float,2>{0.0918790102f, 0.417529494f},
-std::array<float,2>{0.578926027f, 0.338959783f},
-std::array<float,2>{0.326652825f, 0.904709876f},
-std::array<float,2>{0.843074381f, 0.680095732f},
-std::array<float,2>{0.222183317f, 0.194953576f},
-std::array<float,2>{0.898164928f, 0.0943274349f},
-std::array<float,2>{0.0633528829f, 0.546999693f},
-std::array<float,2>{0.674700558f, 0.839990139f},
-std::array<float,2>{0.447363883f, 0.392828345f},
-std::array<float,2>{0.755028665f, 0.457099319f},
-std::array<float,2>{0.128786236f, 0.773797572f},
-std::array<float,2>{0.527259231f, 0.565765023f},
-std::array<float,2>{0.263791949f, 0.0100274701f},
-std::array<float,2>{0.73567313f, 0.133306757f},
-std::array<float,2>{0.431306452f, 0.711726844f},
-std::array<float,2>{0.938444555f, 0.975376487f},
-std::array<float,2>{0.0527797826f, 0.265069574f},
-std::array<float,2>{0.64795953f, 0.43251583f},
-std::array<float,2>{0.484644413f, 0.85041976f},
-std::array<float,2>{0.914713025f, 0.522372365f},
-std::array<float,2>{0.119144961f, 0.0684052482f},
-std::array<float,2>{0.869005799f, 0.219393253f},
-std::array<float,2>{0.191480324f, 0.65379554f},
-std::array<float,2>{0.621755123f, 0.914196908f},
-std::array<float,2>{0.355855644f, 0.370954216f},
-std::array<float,2>{0.992690027f, 0.281429172f},
-std::array<float,2>{0.0195094254f, 0.954773188f},
-std::array<float,2>{0.717606068f, 0.728808224f},
-std::array<float,2>{0.3954072f, 0.168762922f},
-std::array<float,2>{0.558566809f, 0.049953863f},
-std::array<float,2>{0.307993442f, 0.598128796f},
-std::array<float,2>{0.807618499f, 0.792635202f},
-std::array<float,2>{0.187410131f, 0.481076002f},
-std::array<float,2>{0.680576444f, 0.36100322f},
-std::array<float,2>{0.444070876f, 0.912377179f},
-std::array<float,2>{0.904445767f, 0.644489765f},
-std::array<float,2>{0.077362664f, 0.226652503f},
-std::array<float,2>{0.834314883f, 0.0761470422f},
-std::array<float,2>{0.22854282f, 0.530037642f},
-std::array<float,2>{0.59176904f, 0.85903275f},
-std::array<float,2>{0.314257175f, 0.42218262f},
-std::array<float,2>{0.951282799f, 0.474731117f},
-std::array<float,2>{0.0585259162f, 0.788483679f},
-std::array<float,2>{0.746948719f, 0.601704538f},
-std::array<float,2>{0.429453671f, 0.0563963801f},
-std::array<float,2>{0.517835021f, 0.162383631f},
-std::array<float,2>{0.253254145f, 0.724008203f},
-std::array<float,2>{0.759323955f, 0.961736619f},
-std::array<float,2>{0.132971406f, 0.290465444f},
-std::array<float,2>{0.6146155f, 0.400289804f},
-std::array<float,2>{0.346580178f, 0.829901338f},
-std::array<float,2>{0.863087833f, 0.562115669f},
-std::array<float,2>{0.202871278f, 0.102319479f},
-std::array<float,2>{0.912348449f, 0.200127155f},
-std::array<float,2>{0.113041051f, 0.672408819f},
-std::array<float,2>{0.654317915f, 0.894949853f},
-std::array<float,2>{0.495099634f, 0.333697498f},
-std::array<float,2>{0.802441895f, 0.256923109f},
-std::array<float,2>{0.174014598f, 0.982948065f},
-std::array<float,2>{0.55023849f, 0.703800499f},
-std::array<float,2>{0.301208675f, 0.130138516f},
-std::array<float,2>{0.709945261f, 0.00404427759f},
-std::array<float,2>{0.405378282f, 0.574270308f},
-std::array<float,2>{0.991735816f, 0.766239703f},
-std::array<float,2>{0.0264046732f, 0.466919154f},
-std::array<float,2>{0.545287549f, 0.306057602f},
-std::array<float,2>{0.293554127f, 0.948179185f},
-std::array<float,2>{0.783097029f, 0.739824057f},
-std::array<float,2>{0.159779578f, 0.179593384f},
-std::array<float,2>{0.971858919f, 0.0388536379f},
-std::array<float,2>{0.00905734487f, 0.614481449f},
-std::array<float,2>{0.688474238f, 0.80133146f},
-std::array<float,2>{0.38184312f, 0.497276127f},
-std::array<float,2>{0.846048474f, 0.409217179f},
-std::array<float,2>{0.207246765f, 0.873251498f},
-std::array<float,2>{0.599273384f, 0.503382266f},
-std::array<float,2>{0.374608129f, 0.0882100835f},
-std::array<float,2>{0.629942298f, 0.240842074f},
-std::array<float,2>{0.468800604f, 0.628127933f},
-std::array<float,2>{0.925109625f, 0.933614492f},
-std::array<float,2>{0.102202684f, 0.356905878f},
-std::array<float,2>{0.725141883f, 0.444231272f},
-std::array<float,2>{0.407059431f, 0.752150357f},
-std::array<float,2>{0.961163998f, 0.583493054f},
-std::array<float,2>{0.0462315157f, 0.0175404791f},
-std::array<float,2>{0.777930319f, 0.153182834f},
-std::array<float,2>{0.142949864f, 0.691316962f},
-std::array<float,2>{0.501816988f, 0.99400568f},
-std::array<float,2>{0.273955941f, 0.281122744f},
-std::array<float,2>{0.882943809f, 0.3225407f},
-std::array<float,2>{0.0806232989f, 0.890147626f},
-std::array<float,2>{0.670752108f, 0.660273015f},
-std::array<float,2>{0.464205325f, 0.218380615f},
-std::array<float,2>{0.56993866f, 0.118938044f},
-std::array<float,2>{0.330815583f, 0.546179354f},
-std::array<float,2>{0.822277486f, 0.824434042f},
-std::array<float,2>{0.237020716f, 0.375189126f},
-std::array<float,2>{0.703594148f, 0.348240107f},
-std::array<float,2>{0.4000175f, 0.925002933f},
-std::array<float,2>{0.987218797f, 0.635762393f},
-std::array<float,2>{0.0285672117f, 0.242616758f},
-std::array<float,2>{0.797280729f, 0.0844709575f},
-std::array<float,2>{0.178606883f, 0.509907305f},
-std::array<float,2>{0.551146209f, 0.865746379f},
-std::array<float,2>{0.297766238f, 0.420378923f},
-std::array<float,2>{0.907379389f, 0.487728983f},
-std::array<float,2>{0.113856345f, 0.807079971f},
-std::array<float,2>{0.651419938f, 0.623385966f},
-std::array<float,2>{0.499910176f, 0.0459063277f},
-std::array<float,2>{0.609611094f, 0.182181194f},
-std::array<float,2>{0.347827792f, 0.744932592f},
-std::array<float,2>{0.866282701f, 0.940089941f},
-std::array<float,2>{0.195978269f, 0.303565532f},
-std::array<float,2>{0.52312398f, 0.384608626f},
-std::array<float,2>{0.256265432f, 0.813635886f},
-std::array<float,2>{0.763393104f, 0.538368642f},
-std::array<float,2>{0.137855649f, 0.110924825f},
-std::array<float,2>{0.946846187f, 0.210353017f},
-std::array<float,2>{0.0605416484f, 0.665870428f},
-std::array<float,2>{0.74220711f, 0.881513894f},
-std::array<float,2>{0.424915463f, 0.317924142f},
-std::array<float,2>{0.831643224f, 0.266750157f},
-std::array<float,2>{0.232436299f, 0.99101615f},
-std::array<float,2>{0.586469293f, 0.696817517f},
-std::array<float,2>{0.317123473f, 0.142574817f},
-std::array<float,2>{0.686101794f, 0.0237498078f},
-std::array<float,2>{0.438192934f, 0.592389643f},
-std::array<float,2>{0.899328828f, 0.760415733f},
-std::array<float,2>{0.0732677951f, 0.449596375f},
-std::array<float,2>{0.566349447f, 0.288619459f},
-std::array<float,2>{0.333982438f, 0.95797056f},
-std::array<float,2>{0.827018797f, 0.730973244f},
-std::array<float,2>{0.241347179f, 0.1671381f},
-std::array<float,2>{0.887180805f, 0.0538695678f},
-std::array<float,2>{0.0847328305f, 0.597234011f},
-std::array<float,2>{0.66636759f, 0.793985248f},
-std::array<float,2>{0.465586782f, 0.480449587f},
-std::array<float,2>{0.775523603f, 0.433930874f},
-std::array<float,2>{0.146311849f, 0.846910477f},
-std::array<float,2>{0.506385565f, 0.516665995f},
-std::array<float,2>{0.279007405f, 0.0645211712f},
-std::array<float,2>{0.721051753f, 0.224198431f},
-std::array<float,2>{0.412177831f, 0.649836183f},
-std::array<float,2>{0.966094136f, 0.918267429f},
-std::array<float,2>{0.0398915708f, 0.373317033f},
-std::array<float,2>{0.628886402f, 0.456281036f},
-std::array<float,2>{0.474785566f, 0.781102777f},
-std::array<float,2>{0.927053988f, 0.567945957f},
-std::array<float,2>{0.106193945f, 0.0139230397f},
-std::array<float,2>{0.847812951f, 0.136857957f},
-std::array<float,2>{0.206651106f, 0.718481481f},
-std::array<float,2>{0.595579505f, 0.970074475f},
-std::array<float,2>{0.368100733f, 0.261059582f},
-std::array<float,2>{0.976387858f, 0.341407567f},
-std::array<float,2>{0.0148275411f, 0.900652945f},
-std::array<float,2>{0.694353819f, 0.684307158f},
-std::array<float,2>{0.376634687f, 0.187863201f},
-std::array<float,2>{0.540394247f, 0.101036996f},
-std::array<float,2>{0.292185575f, 0.551182389f},
-std::array<float,2>{0.786224484f, 0.838302791f},
-std::array<float,2>{0.162933648f, 0.397318661f},
-std::array<float,2>{0.660480142f, 0.252067626f},
-std::array<float,2>{0.453714073f, 0.978077412f},
-std::array<float,2>{0.877028406f, 0.70905751f},
-std::array<float,2>{0.0884980708f, 0.128362477f},
-std::array<float,2>{0.818627715f, 0.00324862683f},
-std::array<float,2>{0.249055102f, 0.573282182f},
-std::array<float,2>{0.572245717f, 0.77078706f},
-std::array<float,2>{0.339327931f, 0.46465525f},
-std::array<float,2>{0.960600138f, 0.40237233f},
-std::array<float,2>{0.0385925323f, 0.835450709f},
-std::array<float,2>{0.728433609f, 0.558402061f},
-std::array<float,2>{0.416486681f, 0.106747583f},
-std::array<float,2>{0.510917485f, 0.196675226f},
-std::array<float,2>{0.273297548f, 0.677643359f},
-std::array<float,2>{0.772810698f, 0.892196655f},
-std::array<float,2>{0.153839871f, 0.331032634f},
-std::array<float,2>{0.6028409f, 0.471315414f},
-std::array<float,2>{0.360719562f, 0.784036219f},
-std::array<float,2>{0.855719924f, 0.607047796f},
-std::array<float,2>{0.214082047f, 0.0594216548f},
-std::array<float,2>{0.937065899f, 0.157966718f},
-std::array<float,2>{0.0987702459f, 0.719764888f},
-std::array<float,2>{0.634083271f, 0.967430055f},
-std::array<float,2>{0.479244113f, 0.295916945f},
-std::array<float,2>{0.795729339f, 0.366086543f},
-std::array<float,2>{0.171190798f, 0.907017291f},
-std::array<float,2>{0.537204921f, 0.648001432f},
-std::array<float,2>{0.281687468f, 0.230576679f},
-std::array<float,2>{0.699074566f, 0.0731454939f},
-std::array<float,2>{0.386139005f, 0.527087748f},
-std::array<float,2>{0.979909003f, 0.854777813f},
-std::array<float,2>{0.0067800479f, 0.429346979f},
-std::array<float,2>{0.560378611f, 0.32736513f},
-std::array<float,2>{0.311765641f, 0.885650039f},
-std::array<float,2>{0.81154865f, 0.656749964f},
-std::array<float,2>{0.181110308f, 0.214022189f},
-std::array<float,2>{0.999523818f, 0.121575706f},
-std::array<float,2>{0.0216862503f, 0.542221069f},
-std::array<float,2>{0.714785337f, 0.821812272f},
-std::array<float,2>{0.391413003f, 0.379346788f},
-std::array<float,2>{0.872634232f, 0.439683944f},
-std::array<float,2>{0.19110322f, 0.756546736f},
-std::array<float,2>{0.619856477f, 0.579521358f},
-std::array<float,2>{0.354368359f, 0.0202129371f},
-std::array<float,2>{0.641495407f, 0.152255297f},
-std::array<float,2>{0.490049541f, 0.694413424f},
-std::array<float,2>{0.920403957f, 0.998718143f},
-std::array<float,2>{0.124187909f, 0.276710838f},
-std::array<float,2>{0.74182725f, 0.413332194f},
-std::array<float,2>{0.436722606f, 0.870191216f},
-std::array<float,2>{0.944326282f, 0.505679905f},
-std::array<float,2>{0.0470666997f, 0.0912016779f},
-std::array<float,2>{0.751000345f, 0.238088787f},
-std::array<float,2>{0.131915316f, 0.631988883f},
-std::array<float,2>{0.529803336f, 0.930970907f},
-std::array<float,2>{0.259940773f, 0.354196131f},
-std::array<float,2>{0.892407596f, 0.308710724f},
-std::array<float,2>{0.0666103661f, 0.951805055f},
-std::array<float,2>{0.67657274f, 0.736775041f},
-std::array<float,2>{0.451187342f, 0.172490731f},
-std::array<float,2>{0.584744275f, 0.0349394903f},
-std::array<float,2>{0.322719038f, 0.611784041f},
-std::array<float,2>{0.837557852f, 0.800687611f},
-std::array<float,2>{0.22317858f, 0.492792189f},
-std::array<float,2>{0.734017253f, 0.300011724f},
-std::array<float,2>{0.419793099f, 0.944273412f},
-std::array<float,2>{0.95592165f, 0.748028457f},
-std::array<float,2>{0.0323004201f, 0.186952308f},
-std::array<float,2>{0.76574558f, 0.0421425216f},
-std::array<float,2>{0.150987312f, 0.621012807f},
-std::array<float,2>{0.515283406f, 0.810161114f},
-std::array<float,2>{0.269280165f, 0.489496678f},
-std::array<float,2>{0.882809281f, 0.414579391f},
-std::array<float,2>{0.0909043476f, 0.862003028f},
-std::array<float,2>{0.658804357f, 0.515334249f},
-std::array<float,2>{0.460140318f, 0.0789979175f},
-std::array<float,2>{0.575581312f, 0.249269888f},
-std::array<float,2>{0.342483133f, 0.638300896f},
-std::array<float,2>{0.815002322f, 0.92719382f},
-std::array<float,2>{0.242464006f, 0.346364439f},
-std::array<float,2>{0.535146534f, 0.447286099f},
-std::array<float,2>{0.286706269f, 0.7618469f},
-std::array<float,2>{0.792080402f, 0.589735389f},
-std::array<float,2>{0.166862011f, 0.0291528255f},
-std::array<float,2>{0.982018709f, 0.147320017f},
-std::array<float,2>{0.00371054374f, 0.699444592f},
-std::array<float,2>{0.702791989f, 0.985455871f},
-std::array<float,2>{0.388810396f, 0.27274555f},
-std::array<float,2>{0.852283597f, 0.314281523f},
-std::array<float,2>{0.217310742f, 0.876213312f},
-std::array<float,2>{0.606062293f, 0.669318914f},
-std::array<float,2>{0.363437921f, 0.206658065f},
-std::array<float,2>{0.640288651f, 0.115454175f},
-std::array<float,2>{0.481725425f, 0.531702399f},
-std::array<float,2>{0.931859732f, 0.817972183f},
-std::array<float,2>{0.0939228535f, 0.388219953f},
-std::array<float,2>{0.623913765f, 0.367388666f},
-std::array<float,2>{0.35833928f, 0.916027844f},
-std::array<float,2>{0.869412422f, 0.655538797f},
-std::array<float,2>{0.195275739f, 0.220836237f},
-std::array<float,2>{0.916191161f, 0.0679935738f},
-std::array<float,2>{0.117747985f, 0.519843578f},
-std::array<float,2>{0.645868838f, 0.848667502f},
-std::array<float,2>{0.488184899f, 0.430010349f},
-std::array<float,2>{0.806253374f, 0.484086722f},
-std::array<float,2>{0.18359682f, 0.789215744f},
-std::array<float,2>{0.555988252f, 0.600353122f},
-std::array<float,2>{0.305662602f, 0.0488101617f},
-std::array<float,2>{0.715357423f, 0.170547813f},
-std::array<float,2>{0.396989316f, 0.726875722f},
-std::array<float,2>{0.994643688f, 0.955691516f},
-std::array<float,2>{0.0161965694f, 0.283636272f},
-std::array<float,2>{0.672238529f, 0.39173159f},
-std::array<float,2>{0.446306676f, 0.842452347f},
-std::array<float,2>{0.896141469f, 0.549594104f},
-std::array<float,2>{0.0649177283f, 0.0960058868f},
-std::array<float,2>{0.840464234f, 0.193215773f},
-std::array<float,2>{0.220434293f, 0.681695938f},
-std::array<float,2>{0.580686271f, 0.90377003f},
-std::array<float,2>{0.325247586f, 0.337148666f},
-std::array<float,2>{0.941378117f, 0.262638897f},
-std::array<float,2>{0.0514343604f, 0.97318399f},
-std::array<float,2>{0.73803097f, 0.713857234f},
-std::array<float,2>{0.431754142f, 0.136687219f},
-std::array<float,2>{0.524423897f, 0.0089559732f},
-std::array<float,2>{0.26220566f, 0.563805997f},
-std::array<float,2>{0.757513046f, 0.776439369f},
-std::array<float,2>{0.126281708f, 0.460679024f},
-std::array<float,2>{0.652768552f, 0.334212333f},
-std::array<float,2>{0.493884534f, 0.897873044f},
-std::array<float,2>{0.910798252f, 0.675294578f},
-std::array<float,2>{0.109690122f, 0.202122182f},
-std::array<float,2>{0.86123687f, 0.10513293f},
-std::array<float,2>{0.200522289f, 0.559259236f},
-std::array<float,2>{0.616636813f, 0.830166519f},
-std::array<float,2>{0.344626486f, 0.400575161f},
-std::array<float,2>{0.988753557f, 0.465366691f},
-std::array<float,2>{0.0240912624f, 0.768779099f},
-std::array<float,2>{0.708262444f, 0.577929556f},
-std::array<float,2>{0.40406692f, 0.00682236161f},
-std::array<float,2>{0.54798317f, 0.131485671f},
-std::array<float,2>{0.303599149f, 0.706599414f},
-std::array<float,2>{0.802975833f, 0.981703877f},
-std::array<float,2>{0.173682645f, 0.25475502f},
-std::array<float,2>{0.59190774f, 0.424703538f},
-std::array<float,2>{0.314466268f, 0.856987655f},
-std::array<float,2>{0.833667934f, 0.527828097f},
-std::array<float,2>{0.227478296f, 0.0765729249f},
-std::array<float,2>{0.903770864f, 0.228729516f},
-std::array<float,2>{0.0753110424f, 0.641898632f},
-std::array<float,2>{0.682295799f, 0.910181165f},
-std::array<float,2>{0.442859292f, 0.361368418f},
-std::array<float,2>{0.76027f, 0.292805165f},
-std::array<float,2>{0.13590914f, 0.964345336f},
-std::array<float,2>{0.516061068f, 0.726313531f},
-std::array<float,2>{0.250040472f, 0.161066294f},
-std::array<float,2>{0.748367429f, 0.0569879562f},
-std::array<float,2>{0.426489681f, 0.604566336f},
-std::array<float,2>{0.949879944f, 0.786650538f},
-std::array<float,2>{0.0551063269f, 0.4734433f},
-std::array<float,2>{0.503665805f, 0.279076159f},
-std::array<float,2>{0.275530517f, 0.995256066f},
-std::array<float,2>{0.779368877f, 0.687725365f},
-std::array<float,2>{0.140906289f, 0.15583849f},
-std::array<float,2>{0.964502275f, 0.0189462099f},
-std::array<float,2>{0.044774659f, 0.584751606f},
-std::array<float,2>{0.724362135f, 0.75113529f},
-std::array<float,2>{0.408795029f, 0.442521513f},
-std::array<float,2>{0.820690215f, 0.377889246f},
-std::array<float,2>{0.234966278f, 0.828099668f},
-std::array<float,2>{0.566936433f, 0.543563128f},
-std::array<float,2>{0.328537881f, 0.119695596f},
-std::array<float,2>{0.668819845f, 0.216145635f},
-std::array<float,2>{0.46113199f, 0.663136423f},
-std::array<float,2>{0.884985805f, 0.887428641f},
-std::array<float,2>{0.0799549147f, 0.321426868f},
-std::array<float,2>{0.690456688f, 0.4994241f},
-std::array<float,2>{0.379848212f, 0.804031074f},
-std::array<float,2>{0.969311893f, 0.61698395f},
-std::array<float,2>{0.00996148773f, 0.0362015963f},
-std::array<float,2>{0.783591509f, 0.175871894f},
-std::array<float,2>{0.157225549f, 0.740880668f},
-std::array<float,2>{0.544010401f, 0.946683586f},
-std::array<float,2>{0.295883834f, 0.307346433f},
-std::array<float,2>{0.922428429f, 0.358826607f},
-std::array<float,2>{0.105106525f, 0.935865521f},
-std::array<float,2>{0.632422864f, 0.625824153f},
-std::array<float,2>{0.471541345f, 0.239937857f},
-std::array<float,2>{0.600347042f, 0.0875905976f},
-std::array<float,2>{0.373009115f, 0.501472533f},
-std::array<float,2>{0.845077395f, 0.87283504f},
-std::array<float,2>{0.210345104f, 0.406940758f},
-std::array<float,2>{0.694244802f, 0.343136221f},
-std::array<float,2>{0.375454396f, 0.898937166f},
-std::array<float,2>{0.975443244f, 0.685821593f},
-std::array<float,2>{0.0137259737f, 0.189788759f},
-std::array<float,2>{0.785570502f, 0.0983357951f},
-std::array<float,2>{0.16351679f, 0.553989887f},
-std::array<float,2>{0.539754868f, 0.837079108f},
-std::array<float,2>{0.291592628f, 0.396238029f},
-std::array<float,2>{0.925982177f, 0.453701794f},
-std::array<float,2>{0.107024685f, 0.777809501f},
-std::array<float,2>{0.627748311f, 0.570065618f},
-std::array<float,2>{0.47584492f, 0.0134548591f},
-std::array<float,2>{0.594225705f, 0.138771191f},
-std::array<float,2>{0.368876278f, 0.714861393f},
-std::array<float,2>{0.848861873f, 0.97106421f},
-std::array<float,2>{0.205792844f, 0.259412408f},
-std::array<float,2>{0.506931543f, 0.437284589f},
-std::array<float,2>{0.2776106f, 0.845576942f},
-std::array<float,2>{0.777059019f, 0.518049657f},
-std::array<float,2>{0.145159751f, 0.0625277013f},
-std::array<float,2>{0.964983106f, 0.225139454f},
-std::array<float,2>{0.0405964181f, 0.651380241f},
-std::array<float,2>{0.72206521f, 0.921487689f},
-std::array<float,2>{0.413151205f, 0.371489286f},
-std::array<float,2>{0.828123391f, 0.286161482f},
-std::array<float,2>{0.240936428f, 0.960854888f},
-std::array<float,2>{0.564980805f, 0.73385191f},
-std::array<float,2>{0.332342178f, 0.164276391f},
-std::array<float,2>{0.667283773f, 0.0513093658f},
-std::array<float,2>{0.466036975f, 0.593826175f},
-std::array<float,2>{0.888671219f, 0.796712101f},
-std::array<float,2>{0.0851915851f, 0.477758437f},
-std::array<float,2>{0.58714664f, 0.267798066f},
-std::array<float,2>{0.317643046f, 0.989360988f},
-std::array<float,2>{0.830605686f, 0.697763741f},
-std::array<float,2>{0.233517781f, 0.14262931f},
-std::array<float,2>{0.899748564f, 0.0257321335f},
-std::array<float,2>{0.0729257464f, 0.590695977f},
-std::array<float,2>{0.687008619f, 0.759106934f},
-std::array<float,2>{0.438695997f, 0.452594727f},
-std::array<float,2>{0.761958182f, 0.385178983f},
-std::array<float,2>{0.136897221f, 0.814973712f},
-std::array<float,2>{0.522430599f, 0.536578f},
-std::array<float,2>{0.257036448f, 0.11284066f},
-std::array<float,2>{0.74390316f, 0.207392424f},
-std::array<float,2>{0.424371213f, 0.667354107f},
-std::array<float,2>{0.945844352f, 0.879979849f},
-std::array<float,2>{0.058839418f, 0.319213986f},
-std::array<float,2>{0.651220918f, 0.485314429f},
-std::array<float,2>{0.498515278f, 0.805651426f},
-std::array<float,2>{0.907064438f, 0.62210989f},
-std::array<float,2>{0.114592463f, 0.0446507037f},
-std::array<float,2>{0.865991592f, 0.180327952f},
-std::array<float,2>{0.197164461f, 0.743525505f},
-std::array<float,2>{0.610424995f, 0.938008785f},
-std::array<float,2>{0.348786801f, 0.301893026f},
-std::array<float,2>{0.98753041f, 0.350565881f},
-std::array<float,2>{0.0279938728f, 0.922857106f},
-std::array<float,2>{0.704996049f, 0.633103549f},
-std::array<float,2>{0.398788273f, 0.245831802f},
-std::array<float,2>{0.552002132f, 0.0833146498f},
-std::array<float,2>{0.297963142f, 0.508315444f},
-std::array<float,2>{0.798486173f, 0.863314986f},
-std::array<float,2>{0.179529652f, 0.418929517f},
-std::array<float,2>{0.677413046f, 0.311842978f},
-std::array<float,2>{0.452813447f, 0.949901104f},
-std::array<float,2>{0.890868306f, 0.734859526f},
-std::array<float,2>{0.0681535825f, 0.174882054f},
-std::array<float,2>{0.836401701f, 0.0329368897f},
-std::array<float,2>{0.22367309f, 0.610538483f},
-std::array<float,2>{0.585374892f, 0.798434019f},
-std::array<float,2>{0.323984712f, 0.496067226f},
-std::array<float,2>{0.944937706f, 0.411017746f},
-std::array<float,2>{0.0479103327f, 0.867756188f},
-std::array<float,2>{0.740646362f, 0.506488562f},
-std::array<float,2>{0.436307788f, 0.0922886655f},
-std::array<float,2>{0.530299008f, 0.234398231f},
-std::array<float,2>{0.261185884f, 0.630106211f},
-std::array<float,2>{0.750665545f, 0.931858182f},
-std::array<float,2>{0.130981162f, 0.351845115f},
-std::array<float,2>{0.62094301f, 0.437998563f},
-std::array<float,2>{0.354503751f, 0.755200505f},
-std::array<float,2>{0.871847093f, 0.581791043f},
-std::array<float,2>{0.189864144f, 0.0215688311f},
-std::array<float,2>{0.92109555f, 0.148606777f},
-std::array<float,2>{0.123545632f, 0.692848921f},
-std::array<float,2>{0.641958952f, 0.997179329f},
-std::array<float,2>{0.488548577f, 0.274311125f},
-std::array<float,2>{0.810764134f, 0.324810326f},
-std::array<float,2>{0.179817617f, 0.883507133f},
-std::array<float,2>{0.559365809f, 0.660150707f},
-std::array<float,2>{0.310671002f, 0.212346047f},
-std::array<float,2>{0.713086367f, 0.124478169f},
-std::array<float,2>{0.391807705f, 0.540079832f},
-std::array<float,2>{0.998305082f, 0.823472023f},
-std::array<float,2>{0.022964878f, 0.382329136f},
-std::array<float,2>{0.538952947f, 0.364941001f},
-std::array<float,2>{0.282588065f, 0.908502698f},
-std::array<float,2>{0.79679054f, 0.644540668f},
-std::array<float,2>{0.170063302f, 0.233432218f},
-std::array<float,2>{0.978655815f, 0.0706624091f},
-std::array<float,2>{0.00774617959f, 0.525030613f},
-std::array<float,2>{0.697589576f, 0.852421105f},
-std::array<float,2>{0.385307401f, 0.425810009f},
-std::array<float,2>{0.85665983f, 0.469120622f},
-std::array<float,2>{0.212952539f, 0.78126359f},
-std::array<float,2>{0.602210879f, 0.609005094f},
-std::array<float,2>{0.360025764f, 0.0614589788f},
-std::array<float,2>{0.6334759f, 0.15864712f},
-std::array<float,2>{0.479916573f, 0.720795989f},
-std::array<float,2>{0.936073482f, 0.966513991f},
-std::array<float,2>{0.0978530571f, 0.293642431f},
-std::array<float,2>{0.726774395f, 0.40509963f},
-std::array<float,2>{0.417868525f, 0.832238078f},
-std::array<float,2>{0.959324121f, 0.554789901f},
-std::array<float,2>{0.0380169749f, 0.107576445f},
-std::array<float,2>{0.771998584f, 0.198852479f},
-std::array<float,2>{0.152914912f, 0.677977562f},
-std::array<float,2>{0.510326684f, 0.892624319f},
-std::array<float,2>{0.271682411f, 0.329395682f},
-std::array<float,2>{0.878251493f, 0.251089394f},
-std::array<float,2>{0.0897771344f, 0.980350792f},
-std::array<float,2>{0.661928773f, 0.708928764f},
-std::array<float,2>{0.454833776f, 0.126559302f},
-std::array<float,2>{0.570946336f, 0.000828495773f},
-std::array<float,2>{0.338216215f, 0.571918905f},
-std::array<float,2>{0.819420695f, 0.772607625f},
-std::array<float,2>{0.248705819f, 0.460959554f},
-std::array<float,2>{0.73653084f, 0.264240772f},
-std::array<float,2>{0.433377981f, 0.975613594f},
-std::array<float,2>{0.94004339f, 0.712744355f},
-std::array<float,2>{0.052626729f, 0.134765357f},
-std::array<float,2>{0.756724536f, 0.0112410728f},
-std::array<float,2>{0.125201494f, 0.564765096f},
-std::array<float,2>{0.524179578f, 0.775376797f},
-std::array<float,2>{0.263149291f, 0.458125919f},
-std::array<float,2>{0.895492256f, 0.393921107f},
-std::array<float,2>{0.0658340827f, 0.840942681f},
-std::array<float,2>{0.673150659f, 0.548068404f},
-std::array<float,2>{0.445907056f, 0.0950946957f},
-std::array<float,2>{0.581493676f, 0.193442568f},
-std::array<float,2>{0.324734628f, 0.681626439f},
-std::array<float,2>{0.841453552f, 0.906103075f},
-std::array<float,2>{0.218972743f, 0.338502437f},
-std::array<float,2>{0.554806769f, 0.481610268f},
-std::array<float,2>{0.306553245f, 0.791625738f},
-std::array<float,2>{0.804854214f, 0.599307299f},
-std::array<float,2>{0.185222745f, 0.0488721207f},
-std::array<float,2>{0.9956128f, 0.169898719f},
-std::array<float,2>{0.0167733077f, 0.730033219f},
-std::array<float,2>{0.716310382f, 0.953127742f},
-std::array<float,2>{0.398374885f, 0.282778144f},
-std::array<float,2>{0.870984614f, 0.369662493f},
-std::array<float,2>{0.194034711f, 0.915617704f},
-std::array<float,2>{0.624171913f, 0.65298456f},
-std::array<float,2>{0.359280735f, 0.220645249f},
-std::array<float,2>{0.645491958f, 0.0697663873f},
-std::array<float,2>{0.486973077f, 0.522981822f},
-std::array<float,2>{0.917086244f, 0.851254642f},
-std::array<float,2>{0.118549258f, 0.432745636f},
-std::array<float,2>{0.607324541f, 0.314489275f},
-std::array<float,2>{0.364643931f, 0.878076196f},
-std::array<float,2>{0.853491724f, 0.670877635f},
-std::array<float,2>{0.218747526f, 0.204018012f},
-std::array<float,2>{0.932653785f, 0.113590628f},
-std::array<float,2>{0.0947636813f, 0.534123123f},
-std::array<float,2>{0.639295995f, 0.818367422f},
-std::array<float,2>{0.480479032f, 0.388986349f},
-std::array<float,2>{0.791711926f, 0.446796656f},
-std::array<float,2>{0.167454302f, 0.7649858f},
-std::array<float,2>{0.533275008f, 0.587324917f},
-std::array<float,2>{0.285995722f, 0.0303684343f},
-std::array<float,2>{0.701481938f, 0.144949168f},
-std::array<float,2>{0.389870107f, 0.701633751f},
-std::array<float,2>{0.981416464f, 0.987736702f},
-std::array<float,2>{0.00286276662f, 0.270769954f},
-std::array<float,2>{0.659930766f, 0.41631487f},
-std::array<float,2>{0.459001273f, 0.860260248f},
-std::array<float,2>{0.881244242f, 0.512902558f},
-std::array<float,2>{0.0906504318f, 0.0815619081f},
-std::array<float,2>{0.815766275f, 0.246968418f},
-std::array<float,2>{0.243759632f, 0.63874954f},
-std::array<float,2>{0.574479163f, 0.9292081f},
-std::array<float,2>{0.343688905f, 0.343785107f},
-std::array<float,2>{0.956791222f, 0.29711026f},
-std::array<float,2>{0.0312889367f, 0.942976832f},
-std::array<float,2>{0.733367324f, 0.748277545f},
-std::array<float,2>{0.418305069f, 0.185275421f},
-std::array<float,2>{0.51394242f, 0.0401280895f},
-std::array<float,2>{0.268222183f, 0.618501842f},
-std::array<float,2>{0.767085314f, 0.811485112f},
-std::array<float,2>{0.151719943f, 0.490441918f},
-std::array<float,2>{0.631577671f, 0.356182247f},
-std::array<float,2>{0.471863359f, 0.93498373f},
-std::array<float,2>{0.92361933f, 0.627628505f},
-std::array<float,2>{0.104285799f, 0.241948366f},
-std::array<float,2>{0.843805254f, 0.0892842039f},
-std::array<float,2>{0.209281936f, 0.502543271f},
-std::array<float,2>{0.601042688f, 0.874477684f},
-std::array<float,2>{0.37201634f, 0.408833742f},
-std::array<float,2>{0.969888091f, 0.496797562f},
-std::array<float,2>{0.0115637574f, 0.802443564f},
-std::array<float,2>{0.69017452f, 0.613648236f},
-std::array<float,2>{0.380122095f, 0.0378015935f},
-std::array<float,2>{0.542970955f, 0.177866459f},
-std::array<float,2>{0.296368569f, 0.738737583f},
-std::array<float,2>{0.78475517f, 0.948772788f},
-std::array<float,2>{0.157496005f, 0.305384547f},
-std::array<float,2>{0.568165123f, 0.376401395f},
-std::array<float,2>{0.329993188f, 0.825703979f},
-std::array<float,2>{0.821790159f, 0.545251787f},
-std::array<float,2>{0.236142531f, 0.117278725f},
-std::array<float,2>{0.88609916f, 0.216914788f},
-std::array<float,2>{0.0786214247f, 0.661206901f},
-std::array<float,2>{0.669071317f, 0.889149666f},
-std::array<float,2>{0.462550998f, 0.323756516f},
-std::array<float,2>{0.780484498f, 0.279353857f},
-std::array<float,2>{0.141645581f, 0.992949009f},
-std::array<float,2>{0.50209564f, 0.689665556f},
-std::array<float,2>{0.276645303f, 0.153348625f},
-std::array<float,2>{0.723487318f, 0.0162921101f},
-std::array<float,2>{0.409552038f, 0.582339644f},
-std::array<float,2>{0.963310719f, 0.753104448f},
-std::array<float,2>{0.0431477912f, 0.444624394f},
-std::array<float,2>{0.51665014f, 0.289206445f},
-std::array<float,2>{0.25148347f, 0.961948216f},
-std::array<float,2>{0.760940671f, 0.722783566f},
-std::array<float,2>{0.135065153f, 0.163672999f},
-std::array<float,2>{0.950676024f, 0.0550198294f},
-std::array<float,2>{0.0565660968f, 0.60255444f},
-std::array<float,2>{0.749539256f, 0.787527919f},
-std::array<float,2>{0.427044064f, 0.475780159f},
-std::array<float,2>{0.832437694f, 0.422889352f},
-std::array<float,2>{0.228061199f, 0.85758847f},
-std::array<float,2>{0.593506813f, 0.530625403f},
-std::array<float,2>{0.316179276f, 0.0742587149f},
-std::array<float,2>{0.683374584f, 0.228070647f},
-std::array<float,2>{0.441909343f, 0.642843783f},
-std::array<float,2>{0.902697027f, 0.913548291f},
-std::array<float,2>{0.0747975856f, 0.359475046f},
-std::array<float,2>{0.707689464f, 0.46850723f},
-std::array<float,2>{0.402844846f, 0.766730905f},
-std::array<float,2>{0.989449203f, 0.575730145f},
-std::array<float,2>{0.0247637536f, 0.00550906919f},
-std::array<float,2>{0.804258406f, 0.12899892f},
-std::array<float,2>{0.17210646f, 0.704970479f},
-std::array<float,2>{0.547033131f, 0.983969092f},
-std::array<float,2>{0.303928584f, 0.256517231f},
-std::array<float,2>{0.911548674f, 0.332161307f},
-std::array<float,2>{0.110449314f, 0.896139324f},
-std::array<float,2>{0.65384537f, 0.673505247f},
-std::array<float,2>{0.492572129f, 0.200903594f},
-std::array<float,2>{0.615918577f, 0.103023224f},
-std::array<float,2>{0.345259905f, 0.561348438f},
-std::array<float,2>{0.859448075f, 0.828178406f},
-std::array<float,2>{0.19936572f, 0.39882347f},
-std::array<float,2>{0.719955385f, 0.374203682f},
-std::array<float,2>{0.411729395f, 0.919168174f},
-std::array<float,2>{0.968697846f, 0.649080396f},
-std::array<float,2>{0.0411419533f, 0.222877026f},
-std::array<float,2>{0.77507031f, 0.0662378669f},
-std::array<float,2>{0.146968126f, 0.516174018f},
-std::array<float,2>{0.504842997f, 0.845955253f},
-std::array<float,2>{0.281117529f, 0.43503356f},
-std::array<float,2>{0.889889836f, 0.479156464f},
-std::array<float,2>{0.0821731687f, 0.793529034f},
-std::array<float,2>{0.664775908f, 0.595752478f},
-std::array<float,2>{0.468005806f, 0.0528558046f},
-std::array<float,2>{0.562851548f, 0.166372627f},
-std::array<float,2>{0.333993167f, 0.731945872f},
-std::array<float,2>{0.825865209f, 0.958656669f},
-std::array<float,2>{0.239594936f, 0.287314475f},
-std::array<float,2>{0.541353822f, 0.39769733f},
-std::array<float,2>{0.290474564f, 0.8395257f},
-std::array<float,2>{0.788699687f, 0.552533507f},
-std::array<float,2>{0.160810471f, 0.0998023525f},
-std::array<float,2>{0.97304827f, 0.188749209f},
-std::array<float,2>{0.0131471846f, 0.685363412f},
-std::array<float,2>{0.691533208f, 0.901402235f},
-std::array<float,2>{0.377097249f, 0.340092272f},
-std::array<float,2>{0.849709928f, 0.259851247f},
-std::array<float,2>{0.204463527f, 0.969601274f},
-std::array<float,2>{0.597540498f, 0.717613459f},
-std::array<float,2>{0.370565116f, 0.138515562f},
-std::array<float,2>{0.626759112f, 0.0154668596f},
-std::array<float,2>{0.474048644f, 0.56716305f},
-std::array<float,2>{0.928626299f, 0.779975295f},
-std::array<float,2>{0.107706122f, 0.455887496f},
-std::array<float,2>{0.612820089f, 0.304626763f},
-std::array<float,2>{0.349958122f, 0.940929115f},
-std::array<float,2>{0.864493549f, 0.74608916f},
-std::array<float,2>{0.198158517f, 0.183201283f},
-std::array<float,2>{0.909881592f, 0.0458881557f},
-std::array<float,2>{0.1171415f, 0.624378622f},
-std::array<float,2>{0.648927629f, 0.808363318f},
-std::array<float,2>{0.496466309f, 0.486776769f},
-std::array<float,2>{0.799487233f, 0.420987487f},
-std::array<float,2>{0.175918996f, 0.866461277f},
-std::array<float,2>{0.55401051f, 0.51132673f},
-std::array<float,2>{0.299859911f, 0.0850828886f},
-std::array<float,2>{0.705263376f, 0.243201613f},
-std::array<float,2>{0.402157068f, 0.634841144f},
-std::array<float,2>{0.985804141f, 0.924353778f},
-std::array<float,2>{0.0296441615f, 0.349598497f},
-std::array<float,2>{0.68518877f, 0.450979471f},
-std::array<float,2>{0.440834701f, 0.761028469f},
-std::array<float,2>{0.901286781f, 0.593649566f},
-std::array<float,2>{0.072064884f, 0.0245171711f},
-std::array<float,2>{0.828671575f, 0.140910864f},
-std::array<float,2>{0.231188148f, 0.695750773f},
-std::array<float,2>{0.588956714f, 0.991648495f},
-std::array<float,2>{0.319134593f, 0.265814036f},
-std::array<float,2>{0.947441936f, 0.316769898f},
-std::array<float,2>{0.0607844107f, 0.882503569f},
-std::array<float,2>{0.745764136f, 0.6642856f},
-std::array<float,2>{0.422428489f, 0.209552854f},
-std::array<float,2>{0.520337045f, 0.110155836f},
-std::array<float,2>{0.255522698f, 0.537498474f},
-std::array<float,2>{0.765040159f, 0.8126688f},
-std::array<float,2>{0.140260682f, 0.382931262f},
-std::array<float,2>{0.644355953f, 0.276021153f},
-std::array<float,2>{0.490676641f, 0.99907738f},
-std::array<float,2>{0.918142021f, 0.693786561f},
-std::array<float,2>{0.122034885f, 0.150493205f},
-std::array<float,2>{0.873828292f, 0.0209021661f},
-std::array<float,2>{0.188381299f, 0.579025507f},
-std::array<float,2>{0.619012356f, 0.757224321f},
-std::array<float,2>{0.351696014f, 0.441156656f},
-std::array<float,2>{0.997921348f, 0.380751759f},
-std::array<float,2>{0.0196356811f, 0.821246505f},
-std::array<float,2>{0.711057425f, 0.541520834f},
-std::array<float,2>{0.393028975f, 0.122581668f},
-std::array<float,2>{0.561715305f, 0.213795796f},
-std::array<float,2>{0.309657902f, 0.657617867f},
-std::array<float,2>{0.809300601f, 0.886289716f},
-std::array<float,2>{0.182116225f, 0.32627362f},
-std::array<float,2>{0.583124578f, 0.493469805f},
-std::array<float,2>{0.322097093f, 0.799159527f},
-std::array<float,2>{0.838235974f, 0.61319381f},
-std::array<float,2>{0.225552663f, 0.0332717411f},
-std::array<float,2>{0.894485414f, 0.173342079f},
-std::array<float,2>{0.0697376579f, 0.73807168f},
-std::array<float,2>{0.678645134f, 0.952245891f},
-std::array<float,2>{0.45093587f, 0.310241908f},
-std::array<float,2>{0.752846837f, 0.355042458f},
-std::array<float,2>{0.129245684f, 0.929842114f},
-std::array<float,2>{0.527490497f, 0.631100893f},
-std::array<float,2>{0.259666234f, 0.236532092f},
-std::array<float,2>{0.739081204f, 0.0899460912f},
-std::array<float,2>{0.433597445f, 0.504101157f},
-std::array<float,2>{0.941936374f, 0.870098829f},
-std::array<float,2>{0.050174322f, 0.412478387f},
-std::array<float,2>{0.508130312f, 0.331265152f},
-std::array<float,2>{0.270040095f, 0.890718341f},
-std::array<float,2>{0.771136761f, 0.676167965f},
-std::array<float,2>{0.156194359f, 0.195570409f},
-std::array<float,2>{0.957139373f, 0.10589689f},
-std::array<float,2>{0.0371038802f, 0.556921422f},
-std::array<float,2>{0.729602516f, 0.834374785f},
-std::array<float,2>{0.41491881f, 0.403615355f},
-std::array<float,2>{0.817095578f, 0.463578403f},
-std::array<float,2>{0.247085363f, 0.769770443f},
-std::array<float,2>{0.572336733f, 0.572922587f},
-std::array<float,2>{0.337866068f, 0.0028089101f},
-std::array<float,2>{0.662118793f, 0.127427056f},
-std::array<float,2>{0.455383778f, 0.71042043f},
-std::array<float,2>{0.876140416f, 0.977205157f},
-std::array<float,2>{0.0866987556f, 0.253461212f},
-std::array<float,2>{0.697093904f, 0.42786786f},
-std::array<float,2>{0.383296818f, 0.853864551f},
-std::array<float,2>{0.97727555f, 0.526271403f},
-std::array<float,2>{0.00478733191f, 0.0740604326f},
-std::array<float,2>{0.794683814f, 0.231741443f},
-std::array<float,2>{0.169624642f, 0.647069216f},
-std::array<float,2>{0.536215842f, 0.90752542f},
-std::array<float,2>{0.284619153f, 0.366652608f},
-std::array<float,2>{0.934621871f, 0.29588908f},
-std::array<float,2>{0.0998603329f, 0.968506098f},
-std::array<float,2>{0.635642529f, 0.719067872f},
-std::array<float,2>{0.478241503f, 0.156383634f},
-std::array<float,2>{0.605342567f, 0.0603580698f},
-std::array<float,2>{0.363277704f, 0.605606854f},
-std::array<float,2>{0.859040976f, 0.785014927f},
-std::array<float,2>{0.211582437f, 0.472233266f},
-std::array<float,2>{0.717841804f, 0.284850806f},
-std::array<float,2>{0.396030068f, 0.956784546f},
-std::array<float,2>{0.993193984f, 0.727782845f},
-std::array<float,2>{0.018159207f, 0.171548441f},
-std::array<float,2>{0.807325423f, 0.0474263094f},
-std::array<float,2>{0.185818583f, 0.601277709f},
-std::array<float,2>{0.556895375f, 0.790878832f},
-std::array<float,2>{0.306994557f, 0.483332336f},
-std::array<float,2>{0.91505146f, 0.430726886f},
-std::array<float,2>{0.120261297f, 0.84783715f},
-std::array<float,2>{0.646842241f, 0.521172762f},
-std::array<float,2>{0.485413283f, 0.0673218146f},
-std::array<float,2>{0.622301579f, 0.222070798f},
-std::array<float,2>{0.356595576f, 0.655154467f},
-std::array<float,2>{0.867327094f, 0.917800188f},
-std::array<float,2>{0.192715749f, 0.368178993f},
-std::array<float,2>{0.526241958f, 0.45956865f},
-std::array<float,2>{0.265513599f, 0.776233554f},
-std::array<float,2>{0.754064262f, 0.563454688f},
-std::array<float,2>{0.126957014f, 0.00860156678f},
-std::array<float,2>{0.939226091f, 0.13493152f},
-std::array<float,2>{0.0537799895f, 0.714668989f},
-std::array<float,2>{0.734606743f, 0.974255145f},
-std::array<float,2>{0.429709077f, 0.26359874f},
-std::array<float,2>{0.842356741f, 0.336198807f},
-std::array<float,2>{0.221502081f, 0.902840257f},
-std::array<float,2>{0.579358101f, 0.683063567f},
-std::array<float,2>{0.327183127f, 0.191409186f},
-std::array<float,2>{0.675099552f, 0.0976335183f},
-std::array<float,2>{0.448547035f, 0.550047219f},
-std::array<float,2>{0.897344708f, 0.84283632f},
-std::array<float,2>{0.0639906824f, 0.391283542f},
-std::array<float,2>{0.577356577f, 0.347582281f},
-std::array<float,2>{0.340241671f, 0.926322818f},
-std::array<float,2>{0.812970042f, 0.637648523f},
-std::array<float,2>{0.246056944f, 0.248502016f},
-std::array<float,2>{0.879967511f, 0.0791153982f},
-std::array<float,2>{0.0927946121f, 0.514212132f},
-std::array<float,2>{0.657846272f, 0.863118529f},
-std::array<float,2>{0.458027601f, 0.415825009f},
-std::array<float,2>{0.768092453f, 0.488536328f},
-std::array<float,2>{0.149580032f, 0.809357822f},
-std::array<float,2>{0.513292789f, 0.6200459f},
-std::array<float,2>{0.267405748f, 0.04137614f},
-std::array<float,2>{0.731013238f, 0.185761794f},
-std::array<float,2>{0.419936061f, 0.746737659f},
-std::array<float,2>{0.954222798f, 0.944931328f},
-std::array<float,2>{0.0345949456f, 0.29948926f},
-std::array<float,2>{0.63778609f, 0.387185037f},
-std::array<float,2>{0.483397424f, 0.817307353f},
-std::array<float,2>{0.930373371f, 0.532847404f},
-std::array<float,2>{0.0973229483f, 0.117124356f},
-std::array<float,2>{0.855122447f, 0.205403134f},
-std::array<float,2>{0.215938017f, 0.668813348f},
-std::array<float,2>{0.608316243f, 0.875745475f},
-std::array<float,2>{0.36602065f, 0.312978894f},
-std::array<float,2>{0.982831061f, 0.271747798f},
-std::array<float,2>{0.000584094552f, 0.985044539f},
-std::array<float,2>{0.70078212f, 0.700662971f},
-std::array<float,2>{0.388023585f, 0.147781223f},
-std::array<float,2>{0.533033788f, 0.0282421727f},
-std::array<float,2>{0.287569225f, 0.588108718f},
-std::array<float,2>{0.789971471f, 0.763257444f},
-std::array<float,2>{0.165909857f, 0.448982f},
-std::array<float,2>{0.671818793f, 0.320552319f},
-std::array<float,2>{0.463217646f, 0.888197541f},
-std::array<float,2>{0.884360969f, 0.662377715f},
-std::array<float,2>{0.0814562887f, 0.215583533f},
-std::array<float,2>{0.823411226f, 0.121057078f},
-std::array<float,2>{0.238035202f, 0.544781089f},
-std::array<float,2>{0.569084942f, 0.826440394f},
-std::array<float,2>{0.331212997f, 0.378286064f},
-std::array<float,2>{0.962707758f, 0.441577405f},
-std::array<float,2>{0.0455208644f, 0.750924051f},
-std::array<float,2>{0.72585237f, 0.585740328f},
-std::array<float,2>{0.408200294f, 0.0183336716f},
-std::array<float,2>{0.500356317f, 0.15506354f},
-std::array<float,2>{0.274754614f, 0.689156353f},
-std::array<float,2>{0.778924584f, 0.994474769f},
-std::array<float,2>{0.143629745f, 0.278226316f},
-std::array<float,2>{0.598552585f, 0.40756914f},
-std::array<float,2>{0.373626709f, 0.871701837f},
-std::array<float,2>{0.847205162f, 0.500476062f},
-std::array<float,2>{0.208652571f, 0.0866826549f},
-std::array<float,2>{0.924660146f, 0.238454595f},
-std::array<float,2>{0.102686092f, 0.626646519f},
-std::array<float,2>{0.629804075f, 0.936539292f},
-std::array<float,2>{0.470431685f, 0.357774615f},
-std::array<float,2>{0.781604528f, 0.308061391f},
-std::array<float,2>{0.158974022f, 0.945441842f},
-std::array<float,2>{0.546868503f, 0.741466761f},
-std::array<float,2>{0.294128686f, 0.176833838f},
-std::array<float,2>{0.688669324f, 0.0356475189f},
-std::array<float,2>{0.381035477f, 0.615494967f},
-std::array<float,2>{0.971673012f, 0.802853882f},
-std::array<float,2>{0.00820062868f, 0.498737127f},
-std::array<float,2>{0.548996687f, 0.255749494f},
-std::array<float,2>{0.302501708f, 0.981279314f},
-std::array<float,2>{0.800785959f, 0.705798209f},
-std::array<float,2>{0.175039232f, 0.132697523f},
-std::array<float,2>{0.990274072f, 0.00746197067f},
-std::array<float,2>{0.0256051291f, 0.576410353f},
-std::array<float,2>{0.710854948f, 0.768201768f},
-std::array<float,2>{0.404961467f, 0.466250658f},
-std::array<float,2>{0.862156212f, 0.401884586f},
-std::array<float,2>{0.201471329f, 0.831779599f},
-std::array<float,2>{0.613289773f, 0.56047672f},
-std::array<float,2>{0.34735465f, 0.103877097f},
-std::array<float,2>{0.655606329f, 0.203058645f},
-std::array<float,2>{0.495522171f, 0.674589992f},
-std::array<float,2>{0.913335085f, 0.896894455f},
-std::array<float,2>{0.111734971f, 0.335780531f},
-std::array<float,2>{0.747985363f, 0.474456936f},
-std::array<float,2>{0.427985102f, 0.78552103f},
-std::array<float,2>{0.952203512f, 0.603711128f},
-std::array<float,2>{0.0575414933f, 0.0584049672f},
-std::array<float,2>{0.758141696f, 0.161863312f},
-std::array<float,2>{0.134080335f, 0.725102365f},
-std::array<float,2>{0.518616021f, 0.963608682f},
-std::array<float,2>{0.252352893f, 0.291231096f},
-std::array<float,2>{0.905690432f, 0.362323582f},
-std::array<float,2>{0.0767023936f, 0.911658704f},
-std::array<float,2>{0.681287169f, 0.641316414f},
-std::array<float,2>{0.445263237f, 0.229970708f},
-std::array<float,2>{0.590633035f, 0.0778643265f},
-std::array<float,2>{0.312949806f, 0.528624415f},
-std::array<float,2>{0.835467517f, 0.85632515f},
-std::array<float,2>{0.229604512f, 0.425472647f},
-std::array<float,2>{0.730430305f, 0.329892337f},
-std::array<float,2>{0.414152801f, 0.893226326f},
-std::array<float,2>{0.957801223f, 0.678381205f},
-std::array<float,2>{0.0363142751f, 0.198639899f},
-std::array<float,2>{0.770848095f, 0.108218931f},
-std::array<float,2>{0.155370787f, 0.555206656f},
-std::array<float,2>{0.508382916f, 0.832998872f},
-std::array<float,2>{0.269641668f, 0.404781938f},
-std::array<float,2>{0.876681447f, 0.461624146f},
-std::array<float,2>{0.0862921774f, 0.773087502f},
-std::array<float,2>{0.662708759f, 0.571624696f},
-std::array<float,2>{0.455765307f, 0.000196372464f},
-std::array<float,2>{0.573094964f, 0.126041546f},
-std::array<float,2>{0.336994112f, 0.708076596f},
-std::array<float,2>{0.816757441f, 0.979650915f},
-std::array<float,2>{0.247621432f, 0.251695275f},
-std::array<float,2>{0.536807656f, 0.426501691f},
-std::array<float,2>{0.285041064f, 0.85198611f},
-std::array<float,2>{0.794044316f, 0.524575591f},
-std::array<float,2>{0.169118926f, 0.0710343346f},
-std::array<float,2>{0.976812005f, 0.23432754f},
-std::array<float,2>{0.00418030424f, 0.645054221f},
-std::array<float,2>{0.696743965f, 0.908789277f},
-std::array<float,2>{0.38375023f, 0.364655823f},
-std::array<float,2>{0.858801365f, 0.293334126f},
-std::array<float,2>{0.211175278f, 0.965958059f},
-std::array<float,2>{0.604664207f, 0.721407175f},
-std::array<float,2>{0.362395436f, 0.158703879f},
-std::array<float,2>{0.635029376f, 0.0608330071f},
-std::array<float,2>{0.477674603f, 0.608409166f},
-std::array<float,2>{0.935129285f, 0.781853735f},
-std::array<float,2>{0.100173235f, 0.469516814f},
-std::array<float,2>{0.618350506f, 0.27374962f},
-std::array<float,2>{0.352154672f, 0.99804163f},
-std::array<float,2>{0.873214185f, 0.693221331f},
-std::array<float,2>{0.187747121f, 0.149072513f},
-std::array<float,2>{0.918753684f, 0.0222869441f},
-std::array<float,2>{0.121366039f, 0.581294656f},
-std::array<float,2>{0.643740535f, 0.755653679f},
-std::array<float,2>{0.490775675f, 0.43771407f},
-std::array<float,2>{0.808857858f, 0.382143795f},
-std::array<float,2>{0.182522044f, 0.824066639f},
-std::array<float,2>{0.562310219f, 0.540723622f},
-std::array<float,2>{0.310217321f, 0.124760754f},
-std::array<float,2>{0.711657345f, 0.21261166f},
-std::array<float,2>{0.393356293f, 0.659450948f},
-std::array<float,2>{0.997187674f, 0.88312304f},
-std::array<float,2>{0.0201333798f, 0.324541867f},
-std::array<float,2>{0.677745759f, 0.495485514f},
-std::array<float,2>{0.450648367f, 0.797897696f},
-std::array<float,2>{0.893722236f, 0.61089009f},
-std::array<float,2>{0.070126079f, 0.0325038768f},
-std::array<float,2>{0.838471174f, 0.175511286f},
-std::array<float,2>{0.224694088f, 0.735059321f},
-std::array<float,2>{0.583635807f, 0.949413598f},
-std::array<float,2>{0.321739078f, 0.312492192f},
-std::array<float,2>{0.941891968f, 0.352104962f},
-std::array<float,2>{0.0504939482f, 0.932234943f},
-std::array<float,2>{0.738394916f, 0.630382061f},
-std::array<float,2>{0.434523165f, 0.235342145f},
-std::array<float,2>{0.528143704f, 0.092064403f},
-std::array<float,2>{0.258921385f, 0.50624752f},
-std::array<float,2>{0.752285063f, 0.867664576f},
-std::array<float,2>{0.12986742f, 0.410367489f},
-std::array<float,2>{0.648467064f, 0.302682847f},
-std::array<float,2>{0.496765941f, 0.937766612f},
-std::array<float,2>{0.909579992f, 0.743847013f},
-std::array<float,2>{0.116620578f, 0.179950669f},
-std::array<float,2>{0.865124643f, 0.0442008898f},
-std::array<float,2>{0.197459891f, 0.622767389f},
-std::array<float,2>{0.612668395f, 0.804716825f},
-std::array<float,2>{0.350187749f, 0.484529674f},
-std::array<float,2>{0.985932231f, 0.418413371f},
-std::array<float,2>{0.0302293524f, 0.864198625f},
-std::array<float,2>{0.70576638f, 0.508032382f},
-std::array<float,2>{0.401397765f, 0.0836358443f},
-std::array<float,2>{0.554380357f, 0.245561808f},
-std::array<float,2>{0.300509572f, 0.633657336f},
-std::array<float,2>{0.799177408f, 0.923599064f},
-std::array<float,2>{0.176499724f, 0.349810153f},
-std::array<float,2>{0.589434683f, 0.452655524f},
-std::array<float,2>{0.318663657f, 0.759693205f},
-std::array<float,2>{0.828178585f, 0.590236485f},
-std::array<float,2>{0.230652288f, 0.0259231776f},
-std::array<float,2>{0.90068543f, 0.143257886f},
-std::array<float,2>{0.0716688856f, 0.697621584f},
-std::array<float,2>{0.684679329f, 0.989960492f},
-std::array<float,2>{0.440923721f, 0.268161386f},
-std::array<float,2>{0.765329182f, 0.318393558f},
-std::array<float,2>{0.140056267f, 0.880518079f},
-std::array<float,2>{0.519945741f, 0.667967379f},
-std::array<float,2>{0.254905403f, 0.207838476f},
-std::array<float,2>{0.745226622f, 0.112473622f},
-std::array<float,2>{0.422358572f, 0.536632836f},
-std::array<float,2>{0.948007166f, 0.814519048f},
-std::array<float,2>{0.0614071377f, 0.385489106f},
-std::array<float,2>{0.50425607f, 0.371790379f},
-std::array<float,2>{0.280313134f, 0.921164393f},
-std::array<float,2>{0.774688363f, 0.651946068f},
-std::array<float,2>{0.147178382f, 0.224841714f},
-std::array<float,2>{0.968164504f, 0.0631781965f},
-std::array<float,2>{0.0416147821f, 0.518142402f},
-std::array<float,2>{0.720701993f, 0.844775259f},
-std::array<float,2>{0.41140002f, 0.436746418f},
-std::array<float,2>{0.825640559f, 0.478453994f},
-std::array<float,2>{0.240102738f, 0.795973003f},
-std::array<float,2>{0.563364267f, 0.594610929f},
-std::array<float,2>{0.334748149f, 0.051008977f},
-std::array<float,2>{0.664284766f, 0.164945051f},
-std::array<float,2>{0.468285143f, 0.734058738f},
-std::array<float,2>{0.890167177f, 0.960132718f},
-std::array<float,2>{0.0829539225f, 0.286820889f},
-std::array<float,2>{0.692100108f, 0.395865321f},
-std::array<float,2>{0.377453089f, 0.837600708f},
-std::array<float,2>{0.973151028f, 0.55465585f},
-std::array<float,2>{0.0133063067f, 0.097940892f},
-std::array<float,2>{0.788276613f, 0.189990118f},
-std::array<float,2>{0.160403654f, 0.686127603f},
-std::array<float,2>{0.541674614f, 0.898833573f},
-std::array<float,2>{0.290755808f, 0.343358457f},
-std::array<float,2>{0.927882254f, 0.259097934f},
-std::array<float,2>{0.108099073f, 0.971249878f},
-std::array<float,2>{0.625977278f, 0.715430439f},
-std::array<float,2>{0.47429654f, 0.139266714f},
-std::array<float,2>{0.59713918f, 0.0129717113f},
-std::array<float,2>{0.370769829f, 0.569554031f},
-std::array<float,2>{0.850213766f, 0.778282464f},
-std::array<float,2>{0.204920739f, 0.453459293f},
-std::array<float,2>{0.710315764f, 0.256161004f},
-std::array<float,2>{0.404427022f, 0.983655691f},
-std::array<float,2>{0.990768135f, 0.704196811f},
-std::array<float,2>{0.0262021925f, 0.129486829f},
-std::array<float,2>{0.801638901f, 0.00509684207f},
-std::array<float,2>{0.17575556f, 0.57523185f},
-std::array<float,2>{0.549624622f, 0.767094433f},
-std::array<float,2>{0.302066028f, 0.467896104f},
-std::array<float,2>{0.913616598f, 0.399163157f},
-std::array<float,2>{0.111859098f, 0.829036891f},
-std::array<float,2>{0.656012595f, 0.560582399f},
-std::array<float,2>{0.496070087f, 0.103066675f},
-std::array<float,2>{0.613851249f, 0.200552359f},
-std::array<float,2>{0.346984059f, 0.673111498f},
-std::array<float,2>{0.861742914f, 0.895657539f},
-std::array<float,2>{0.202093273f, 0.332589865f},
-std::array<float,2>{0.51920414f, 0.476436585f},
-std::array<float,2>{0.252679467f, 0.787660539f},
-std::array<float,2>{0.758335173f, 0.603362739f},
-std::array<float,2>{0.134382978f, 0.0553189144f},
-std::array<float,2>{0.9528988f, 0.163554639f},
-std::array<float,2>{0.0570123866f, 0.723474085f},
-std::array<float,2>{0.747113943f, 0.962875009f},
-std::array<float,2>{0.428477019f, 0.289954364f},
-std::array<float,2>{0.83533144f, 0.360103011f},
-std::array<float,2>{0.230283797f, 0.9137429f},
-std::array<float,2>{0.589921832f, 0.643118739f},
-std::array<float,2>{0.313101262f, 0.227831841f},
-std::array<float,2>{0.680726647f, 0.0749397874f},
-std::array<float,2>{0.444601029f, 0.531088054f},
-std::array<float,2>{0.905927539f, 0.858111024f},
-std::array<float,2>{0.0766478479f, 0.423740566f},
-std::array<float,2>{0.568709373f, 0.323405296f},
-std::array<float,2>{0.331625491f, 0.889619529f},
-std::array<float,2>{0.824013352f, 0.661674261f},
-std::array<float,2>{0.237743646f, 0.217460886f},
-std::array<float,2>{0.883980572f, 0.118116826f},
-std::array<float,2>{0.0815580413f, 0.545879126f},
-std::array<float,2>{0.671143055f, 0.825317442f},
-std::array<float,2>{0.463779688f, 0.376904547f},
-std::array<float,2>{0.778679013f, 0.445219517f},
-std::array<float,2>{0.14419353f, 0.753508985f},
-std::array<float,2>{0.500942528f, 0.582525134f},
-std::array<float,2>{0.274949819f, 0.0160332937f},
-std::array<float,2>{0.726551235f, 0.153921902f},
-std::array<float,2>{0.407230318f, 0.690232158f},
-std::array<float,2>{0.962048352f, 0.992536545f},
-std::array<float,2>{0.0453935638f, 0.279842466f},
-std::array<float,2>{0.629348099f, 0.408607602f},
-std::array<float,2>{0.47014612f, 0.87497586f},
-std::array<float,2>{0.924053848f, 0.502339542f},
-std::array<float,2>{0.103485659f, 0.0897778422f},
-std::array<float,2>{0.846728981f, 0.241583258f},
-std::array<float,2>{0.208084404f, 0.627061903f},
-std::array<float,2>{0.597836792f, 0.935226679f},
-std::array<float,2>{0.373340636f, 0.355900496f},
-std::array<float,2>{0.971107721f, 0.30492267f},
-std::array<float,2>{0.00846617669f, 0.948621631f},
-std::array<float,2>{0.688977003f, 0.738957465f},
-std::array<float,2>{0.381678939f, 0.178564787f},
-std::array<float,2>{0.546276033f, 0.037525747f},
-std::array<float,2>{0.294645667f, 0.614147127f},
-std::array<float,2>{0.781986594f, 0.802218497f},
-std::array<float,2>{0.158611417f, 0.496364772f},
-std::array<float,2>{0.657701135f, 0.344659865f},
-std::array<float,2>{0.458833218f, 0.928964078f},
-std::array<float,2>{0.880844176f, 0.639531314f},
-std::array<float,2>{0.0937210545f, 0.246392801f},
-std::array<float,2>{0.813011646f, 0.0812481195f},
-std::array<float,2>{0.245148048f, 0.513318837f},
-std::array<float,2>{0.578000307f, 0.859599411f},
-std::array<float,2>{0.340620577f, 0.416759014f},
-std::array<float,2>{0.955019176f, 0.491040856f},
-std::array<float,2>{0.0346840508f, 0.810744524f},
-std::array<float,2>{0.730540097f, 0.619054735f},
-std::array<float,2>{0.420426935f, 0.0407301858f},
-std::array<float,2>{0.512829125f, 0.184760362f},
-std::array<float,2>{0.266708046f, 0.748883843f},
-std::array<float,2>{0.767883003f, 0.942544103f},
-std::array<float,2>{0.150220782f, 0.29744029f},
-std::array<float,2>{0.607455552f, 0.389296919f},
-std::array<float,2>{0.365284175f, 0.819328487f},
-std::array<float,2>{0.854823112f, 0.533218145f},
-std::array<float,2>{0.216357172f, 0.113980301f},
-std::array<float,2>{0.93007201f, 0.203313082f},
-std::array<float,2>{0.0967176333f, 0.670130789f},
-std::array<float,2>{0.638385355f, 0.878427565f},
-std::array<float,2>{0.482445806f, 0.315348864f},
-std::array<float,2>{0.7890836f, 0.271470487f},
-std::array<float,2>{0.165126711f, 0.988128066f},
-std::array<float,2>{0.532422781f, 0.70182997f},
-std::array<float,2>{0.287644118f, 0.145427525f},
-std::array<float,2>{0.700229764f, 0.0307770316f},
-std::array<float,2>{0.38862887f, 0.587749779f},
-std::array<float,2>{0.983089924f, 0.765422702f},
-std::array<float,2>{0.000262463815f, 0.446334958f},
-std::array<float,2>{0.557337284f, 0.282617092f},
-std::array<float,2>{0.307299316f, 0.954016507f},
-std::array<float,2>{0.806764901f, 0.729732394f},
-std::array<float,2>{0.186189786f, 0.169062078f},
-std::array<float,2>{0.994121075f, 0.049354177f},
-std::array<float,2>{0.01767933f, 0.599110663f},
-std::array<float,2>{0.718732834f, 0.791354001f},
-std::array<float,2>{0.395700902f, 0.481969595f},
-std::array<float,2>{0.86771208f, 0.433333516f},
-std::array<float,2>{0.193083927f, 0.850711286f},
-std::array<float,2>{0.622578025f, 0.522629678f},
-std::array<float,2>{0.357175887f, 0.0698817223f},
-std::array<float,2>{0.647024035f, 0.219846413f},
-std::array<float,2>{0.485972464f, 0.65262562f},
-std::array<float,2>{0.915774107f, 0.915304542f},
-std::array<float,2>{0.120888628f, 0.369369388f},
-std::array<float,2>{0.735174537f, 0.458596319f},
-std::array<float,2>{0.430291921f, 0.774552524f},
-std::array<float,2>{0.938844264f, 0.565141559f},
-std::array<float,2>{0.0546757653f, 0.0111556593f},
-std::array<float,2>{0.754812181f, 0.13390328f},
-std::array<float,2>{0.127686769f, 0.712286711f},
-std::array<float,2>{0.525673032f, 0.976357281f},
-std::array<float,2>{0.264843494f, 0.263980418f},
-std::array<float,2>{0.896804214f, 0.338290185f},
-std::array<float,2>{0.0636630431f, 0.905308008f},
-std::array<float,2>{0.675422132f, 0.680858374f},
-std::array<float,2>{0.44904092f, 0.194330081f},
-std::array<float,2>{0.579962552f, 0.0955223143f},
-std::array<float,2>{0.327909648f, 0.548597813f},
-std::array<float,2>{0.842232883f, 0.84164536f},
-std::array<float,2>{0.220818564f, 0.394476593f},
-std::array<float,2>{0.697896719f, 0.367156804f},
-std::array<float,2>{0.385088205f, 0.908059716f},
-std::array<float,2>{0.979433656f, 0.646943867f},
-std::array<float,2>{0.00690190727f, 0.232245818f},
-std::array<float,2>{0.796331584f, 0.073493503f},
-std::array<float,2>{0.170799747f, 0.525866807f},
-std::array<float,2>{0.538230419f, 0.854258358f},
-std::array<float,2>{0.282996923f, 0.428453088f},
-std::array<float,2>{0.935778201f, 0.472129822f},
-std::array<float,2>{0.0982840508f, 0.784456372f},
-std::array<float,2>{0.63312149f, 0.60638541f},
-std::array<float,2>{0.480359882f, 0.0596713386f},
-std::array<float,2>{0.601978898f, 0.157044008f},
-std::array<float,2>{0.359847933f, 0.719438136f},
-std::array<float,2>{0.857169032f, 0.967899263f},
-std::array<float,2>{0.213840976f, 0.295368701f},
-std::array<float,2>{0.509901881f, 0.404029667f},
-std::array<float,2>{0.272344202f, 0.834668517f},
-std::array<float,2>{0.771758378f, 0.557377875f},
-std::array<float,2>{0.152814448f, 0.106194034f},
-std::array<float,2>{0.959645867f, 0.196125448f},
-std::array<float,2>{0.0373434834f, 0.676439881f},
-std::array<float,2>{0.727525949f, 0.891556799f},
-std::array<float,2>{0.417125076f, 0.331736535f},
-std::array<float,2>{0.820155859f, 0.253387123f},
-std::array<float,2>{0.248205841f, 0.976646006f},
-std::array<float,2>{0.570329726f, 0.710488617f},
-std::array<float,2>{0.338494927f, 0.127870291f},
-std::array<float,2>{0.661339223f, 0.00197305204f},
-std::array<float,2>{0.454397917f, 0.572508931f},
-std::array<float,2>{0.87850678f, 0.770293772f},
-std::array<float,2>{0.0892434567f, 0.462951273f},
-std::array<float,2>{0.585481346f, 0.309635133f},
-std::array<float,2>{0.32351023f, 0.95283705f},
-std::array<float,2>{0.836671591f, 0.737396777f},
-std::array<float,2>{0.224424377f, 0.173042893f},
-std::array<float,2>{0.891152918f, 0.0339258425f},
-std::array<float,2>{0.0674512014f, 0.612552822f},
-std::array<float,2>{0.677161992f, 0.799478769f},
-std::array<float,2>{0.452379316f, 0.493948072f},
-std::array<float,2>{0.750372469f, 0.412635833f},
-std::array<float,2>{0.131449029f, 0.869327903f},
-std::array<float,2>{0.530955374f, 0.504721403f},
-std::array<float,2>{0.261241853f, 0.0906146988f},
-std::array<float,2>{0.741167247f, 0.236930594f},
-std::array<float,2>{0.435878098f, 0.631505072f},
-std::array<float,2>{0.944780231f, 0.930613935f},
-std::array<float,2>{0.0486606397f, 0.354572713f},
-std::array<float,2>{0.642139196f, 0.440754622f},
-std::array<float,2>{0.488844186f, 0.757776737f},
-std::array<float,2>{0.921863019f, 0.57856977f},
-std::array<float,2>{0.123442613f, 0.0210121628f},
-std::array<float,2>{0.871122837f, 0.150896832f},
-std::array<float,2>{0.190229401f, 0.694324553f},
-std::array<float,2>{0.620190144f, 0.999898314f},
-std::array<float,2>{0.355318725f, 0.27586019f},
-std::array<float,2>{0.998959601f, 0.327059031f},
-std::array<float,2>{0.022943465f, 0.88592869f},
-std::array<float,2>{0.713391006f, 0.657904446f},
-std::array<float,2>{0.392183512f, 0.213014856f},
-std::array<float,2>{0.559076965f, 0.122541085f},
-std::array<float,2>{0.311314642f, 0.54107672f},
-std::array<float,2>{0.811484635f, 0.82059139f},
-std::array<float,2>{0.1803222f, 0.380282879f},
-std::array<float,2>{0.687369943f, 0.266401619f},
-std::array<float,2>{0.439199895f, 0.991936028f},
-std::array<float,2>{0.900323808f, 0.696217179f},
-std::array<float,2>{0.0726912841f, 0.141230255f},
-std::array<float,2>{0.830332816f, 0.0251594465f},
-std::array<float,2>{0.234186962f, 0.592896163f},
-std::array<float,2>{0.587560117f, 0.76150614f},
-std::array<float,2>{0.318145603f, 0.450560153f},
-std::array<float,2>{0.945569634f, 0.383547872f},
-std::array<float,2>{0.059504658f, 0.813158274f},
-std::array<float,2>{0.743384361f, 0.53796953f},
-std::array<float,2>{0.424027473f, 0.109492816f},
-std::array<float,2>{0.521903813f, 0.209441021f},
-std::array<float,2>{0.257481843f, 0.664955676f},
-std::array<float,2>{0.762640715f, 0.882144272f},
-std::array<float,2>{0.137443572f, 0.31694001f},
-std::array<float,2>{0.610984862f, 0.486941665f},
-std::array<float,2>{0.349506319f, 0.807663739f},
-std::array<float,2>{0.865285218f, 0.624800384f},
-std::array<float,2>{0.19669047f, 0.0452850759f},
-std::array<float,2>{0.906308353f, 0.182751402f},
-std::array<float,2>{0.115009032f, 0.745225489f},
-std::array<float,2>{0.650784254f, 0.940766752f},
-std::array<float,2>{0.4985376f, 0.303861231f},
-std::array<float,2>{0.797916114f, 0.348755449f},
-std::array<float,2>{0.178779155f, 0.92392087f},
-std::array<float,2>{0.552542329f, 0.635268271f},
-std::array<float,2>{0.298818976f, 0.243905827f},
-std::array<float,2>{0.704372585f, 0.0856386423f},
-std::array<float,2>{0.399000823f, 0.510821819f},
-std::array<float,2>{0.987938941f, 0.867024302f},
-std::array<float,2>{0.0276183914f, 0.421583325f},
-std::array<float,2>{0.53945905f, 0.34058553f},
-std::array<float,2>{0.291090161f, 0.901877701f},
-std::array<float,2>{0.785918534f, 0.685052097f},
-std::array<float,2>{0.163652807f, 0.189181343f},
-std::array<float,2>{0.974923551f, 0.100211658f},
-std::array<float,2>{0.0146320397f, 0.552040994f},
-std::array<float,2>{0.693604469f, 0.839130819f},
-std::array<float,2>{0.375689775f, 0.39834553f},
-std::array<float,2>{0.849534035f, 0.45526886f},
-std::array<float,2>{0.205193579f, 0.779362142f},
-std::array<float,2>{0.594362915f, 0.566714704f},
-std::array<float,2>{0.368261546f, 0.0151042221f},
-std::array<float,2>{0.627364874f, 0.137954295f},
-std::array<float,2>{0.476546228f, 0.717220604f},
-std::array<float,2>{0.926470816f, 0.969156921f},
-std::array<float,2>{0.106457919f, 0.260560304f},
-std::array<float,2>{0.722464919f, 0.435292929f},
-std::array<float,2>{0.414039761f, 0.846491635f},
-std::array<float,2>{0.965809882f, 0.516074121f},
-std::array<float,2>{0.0402997434f, 0.0655846968f},
-std::array<float,2>{0.776417255f, 0.223155141f},
-std::array<float,2>{0.144772708f, 0.648521364f},
-std::array<float,2>{0.507754087f, 0.91948086f},
-std::array<float,2>{0.278086931f, 0.374596864f},
-std::array<float,2>{0.887850642f, 0.287804425f},
-std::array<float,2>{0.0859270319f, 0.958222568f},
-std::array<float,2>{0.667515814f, 0.731756687f},
-std::array<float,2>{0.466714114f, 0.166687667f},
-std::array<float,2>{0.56482321f, 0.0533087626f},
-std::array<float,2>{0.332708091f, 0.596193671f},
-std::array<float,2>{0.827567756f, 0.793394506f},
-std::array<float,2>{0.240296081f, 0.478857636f},
-std::array<float,2>{0.749099135f, 0.291872352f},
-std::array<float,2>{0.427479923f, 0.962917328f},
-std::array<float,2>{0.950920343f, 0.724764705f},
-std::array<float,2>{0.055673223f, 0.161607832f},
-std::array<float,2>{0.761477232f, 0.0576702841f},
-std::array<float,2>{0.13570632f, 0.604416192f},
-std::array<float,2>{0.517275751f, 0.785686731f},
-std::array<float,2>{0.251244396f, 0.473827541f},
-std::array<float,2>{0.902850628f, 0.424996793f},
-std::array<float,2>{0.0745211989f, 0.855761349f},
-std::array<float,2>{0.683022082f, 0.529233396f},
-std::array<float,2>{0.441737086f, 0.0773965269f},
-std::array<float,2>{0.593228936f, 0.23024787f},
-std::array<float,2>{0.315671474f, 0.640904367f},
-std::array<float,2>{0.832593262f, 0.911339462f},
-std::array<float,2>{0.227781743f, 0.363215476f},
-std::array<float,2>{0.547797024f, 0.466326833f},
-std::array<float,2>{0.304458469f, 0.767763793f},
-std::array<float,2>{0.803750813f, 0.577021837f},
-std::array<float,2>{0.172725827f, 0.00689541362f},
-std::array<float,2>{0.989987612f, 0.131866932f},
-std::array<float,2>{0.0249250382f, 0.705091536f},
-std::array<float,2>{0.707413614f, 0.980489373f},
-std::array<float,2>{0.402351707f, 0.255059421f},
-std::array<float,2>{0.86027956f, 0.335145772f},
-std::array<float,2>{0.199772447f, 0.897289515f},
-std::array<float,2>{0.615602851f, 0.673885584f},
-std::array<float,2>{0.344731331f, 0.202621162f},
-std::array<float,2>{0.653738737f, 0.104049593f},
-std::array<float,2>{0.492993653f, 0.559620678f},
-std::array<float,2>{0.911752343f, 0.831282854f},
-std::array<float,2>{0.111283019f, 0.401676208f},
-std::array<float,2>{0.601480246f, 0.358072162f},
-std::array<float,2>{0.371263206f, 0.937276065f},
-std::array<float,2>{0.844563663f, 0.626167178f},
-std::array<float,2>{0.209536612f, 0.239126056f},
-std::array<float,2>{0.922964692f, 0.0863654539f},
-std::array<float,2>{0.10390266f, 0.500941932f},
-std::array<float,2>{0.63115555f, 0.871180892f},
-std::array<float,2>{0.472241819f, 0.408129364f},
-std::array<float,2>{0.784183383f, 0.498088449f},
-std::array<float,2>{0.157815173f, 0.803298175f},
-std::array<float,2>{0.543807864f, 0.615756571f},
-std::array<float,2>{0.296609551f, 0.0351885185f},
-std::array<float,2>{0.689483643f, 0.177470982f},
-std::array<float,2>{0.380493581f, 0.742179871f},
-std::array<float,2>{0.970493674f, 0.945888162f},
-std::array<float,2>{0.010873599f, 0.308434427f},
-std::array<float,2>{0.669669807f, 0.378717512f},
-std::array<float,2>{0.462026745f, 0.827122808f},
-std::array<float,2>{0.886451304f, 0.544033647f},
-std::array<float,2>{0.0781473666f, 0.12047679f},
-std::array<float,2>{0.821599662f, 0.215268031f},
-std::array<float,2>{0.235358581f, 0.662934661f},
-std::array<float,2>{0.567605853f, 0.887843192f},
-std::array<float,2>{0.329566181f, 0.320954859f},
-std::array<float,2>{0.963747263f, 0.277730793f},
-std::array<float,2>{0.0439397804f, 0.994991183f},
-std::array<float,2>{0.723059058f, 0.688506544f},
-std::array<float,2>{0.409870356f, 0.154785052f},
-std::array<float,2>{0.502508163f, 0.0178282354f},
-std::array<float,2>{0.277192593f, 0.585305333f},
-std::array<float,2>{0.780797839f, 0.750460088f},
-std::array<float,2>{0.142452568f, 0.441993326f},
-std::array<float,2>{0.639057457f, 0.313042194f},
-std::array<float,2>{0.481386244f, 0.875322521f},
-std::array<float,2>{0.933176041f, 0.668220997f},
-std::array<float,2>{0.0954927728f, 0.205907643f},
-std::array<float,2>{0.852778673f, 0.116251901f},
-std::array<float,2>{0.218008488f, 0.532243311f},
-std::array<float,2>{0.606664777f, 0.816548049f},
-std::array<float,2>{0.365159094f, 0.387419701f},
-std::array<float,2>{0.980843306f, 0.448354304f},
-std::array<float,2>{0.00211215345f, 0.762957454f},
-std::array<float,2>{0.702076197f, 0.588644743f},
-std::array<float,2>{0.390222818f, 0.0273604523f},
-std::array<float,2>{0.534114897f, 0.148418888f},
-std::array<float,2>{0.285635203f, 0.70084852f},
-std::array<float,2>{0.791254103f, 0.984752238f},
-std::array<float,2>{0.167698145f, 0.272175878f},
-std::array<float,2>{0.574752688f, 0.415436268f},
-std::array<float,2>{0.343194008f, 0.862630606f},
-std::array<float,2>{0.816349983f, 0.513751149f},
-std::array<float,2>{0.243337616f, 0.0796156749f},
-std::array<float,2>{0.881733179f, 0.248553619f},
-std::array<float,2>{0.0899823979f, 0.637172759f},
-std::array<float,2>{0.659509003f, 0.926128328f},
-std::array<float,2>{0.459494174f, 0.346979886f},
-std::array<float,2>{0.767486453f, 0.29915908f},
-std::array<float,2>{0.151964888f, 0.944628596f},
-std::array<float,2>{0.514468968f, 0.746300399f},
-std::array<float,2>{0.267951906f, 0.186161414f},
-std::array<float,2>{0.732857108f, 0.041511558f},
-std::array<float,2>{0.418647528f, 0.619245648f},
-std::array<float,2>{0.956488848f, 0.808872461f},
-std::array<float,2>{0.0317457542f, 0.488960862f},
-std::array<float,2>{0.523464322f, 0.263152689f},
-std::array<float,2>{0.263214499f, 0.973837852f},
-std::array<float,2>{0.755882323f, 0.71401459f},
-std::array<float,2>{0.125576094f, 0.135365948f},
-std::array<float,2>{0.939656436f, 0.00787730329f},
-std::array<float,2>{0.0520589054f, 0.562669277f},
-std::array<float,2>{0.737107933f, 0.775653601f},
-std::array<float,2>{0.432658195f, 0.45943287f},
-std::array<float,2>{0.841109931f, 0.390720874f},
-std::array<float,2>{0.219626486f, 0.84343785f},
-std::array<float,2>{0.581859648f, 0.550714254f},
-std::array<float,2>{0.324513495f, 0.096831128f},
-std::array<float,2>{0.673677444f, 0.191959724f},
-std::array<float,2>{0.445729792f, 0.683251381f},
-std::array<float,2>{0.894549191f, 0.902542949f},
-std::array<float,2>{0.0661509112f, 0.336586893f},
-std::array<float,2>{0.715877295f, 0.482808858f},
-std::array<float,2>{0.397632271f, 0.790311694f},
-std::array<float,2>{0.995130479f, 0.600801647f},
-std::array<float,2>{0.0172278229f, 0.047220394f},
-std::array<float,2>{0.805229902f, 0.171212733f},
-std::array<float,2>{0.184726015f, 0.728192925f},
-std::array<float,2>{0.5553298f, 0.956510782f},
-std::array<float,2>{0.305782139f, 0.284490019f},
-std::array<float,2>{0.917884111f, 0.369065136f},
-std::array<float,2>{0.119104907f, 0.917298794f},
-std::array<float,2>{0.644741774f, 0.654695272f},
-std::array<float,2>{0.486487865f, 0.222479329f},
-std::array<float,2>{0.624840558f, 0.0665534884f},
-std::array<float,2>{0.358814508f, 0.520568669f},
-std::array<float,2>{0.870412469f, 0.848515511f},
-std::array<float,2>{0.193606138f, 0.431551129f},
-std::array<float,2>{0.714284837f, 0.325844526f},
-std::array<float,2>{0.390737563f, 0.884155035f},
-std::array<float,2>{0.999165118f, 0.658516109f},
-std::array<float,2>{0.022013085f, 0.211117506f},
-std::array<float,2>{0.812260807f, 0.12337251f},
-std::array<float,2>{0.181580409f, 0.539660394f},
-std::array<float,2>{0.559579074f, 0.823210239f},
-std::array<float,2>{0.312199861f, 0.380892038f},
-std::array<float,2>{0.920867801f, 0.438987821f},
-std::array<float,2>{0.124513216f, 0.754698217f},
-std::array<float,2>{0.640655756f, 0.58016485f},
-std::array<float,2>{0.489398718f, 0.0226816982f},
-std::array<float,2>{0.619296134f, 0.14994888f},
-std::array<float,2>{0.353592277f, 0.692238986f},
-std::array<float,2>{0.872455597f, 0.997001171f},
-std::array<float,2>{0.190489128f, 0.274795026f},
-std::array<float,2>{0.529414833f, 0.411395073f},
-std::array<float,2>{0.260526627f, 0.868903399f},
-std::array<float,2>{0.751489818f, 0.507721305f},
-std::array<float,2>{0.132688791f, 0.0934859291f},
-std::array<float,2>{0.943370521f, 0.236265272f},
-std::array<float,2>{0.0476433076f, 0.629748881f},
-std::array<float,2>{0.74139303f, 0.933446884f},
-std::array<float,2>{0.437113553f, 0.353114158f},
-std::array<float,2>{0.837395012f, 0.311406016f},
-std::array<float,2>{0.222883493f, 0.950989127f},
-std::array<float,2>{0.584006846f, 0.735737026f},
-std::array<float,2>{0.322935194f, 0.174258828f},
-std::array<float,2>{0.676202059f, 0.0312946364f},
-std::array<float,2>{0.451700062f, 0.609744787f},
-std::array<float,2>{0.89168936f, 0.797662258f},
-std::array<float,2>{0.067359589f, 0.494694054f},
-std::array<float,2>{0.571358323f, 0.250304699f},
-std::array<float,2>{0.339749038f, 0.978842556f},
-std::array<float,2>{0.818852246f, 0.707385361f},
-std::array<float,2>{0.249927476f, 0.125686005f},
-std::array<float,2>{0.87759769f, 0.00172429951f},
-std::array<float,2>{0.0879325792f, 0.57127285f},
-std::array<float,2>{0.660952508f, 0.771739542f},
-std::array<float,2>{0.453199714f, 0.462068558f},
-std::array<float,2>{0.773292899f, 0.40562433f},
-std::array<float,2>{0.153590903f, 0.833876431f},
-std::array<float,2>{0.511291623f, 0.556334794f},
-std::array<float,2>{0.272730201f, 0.108982578f},
-std::array<float,2>{0.727736592f, 0.197862133f},
-std::array<float,2>{0.416691512f, 0.678938389f},
-std::array<float,2>{0.960020065f, 0.894401252f},
-std::array<float,2>{0.0380920172f, 0.328141689f},
-std::array<float,2>{0.634628832f, 0.470284879f},
-std::array<float,2>{0.478952348f, 0.782937527f},
-std::array<float,2>{0.936888874f, 0.607734561f},
-std::array<float,2>{0.099129878f, 0.0616695657f},
-std::array<float,2>{0.85617137f, 0.15976344f},
-std::array<float,2>{0.214549348f, 0.721797764f},
-std::array<float,2>{0.603199422f, 0.964998424f},
-std::array<float,2>{0.361042321f, 0.294179618f},
-std::array<float,2>{0.980016708f, 0.363585204f},
-std::array<float,2>{0.00597772328f, 0.910011232f},
-std::array<float,2>{0.698698461f, 0.645577013f},
-std::array<float,2>{0.386273026f, 0.233164683f},
-std::array<float,2>{0.537649989f, 0.0713945031f},
-std::array<float,2>{0.281979948f, 0.523735344f},
-std::array<float,2>{0.794924915f, 0.852783918f},
-std::array<float,2>{0.171689138f, 0.427002996f},
-std::array<float,2>{0.666759133f, 0.286050171f},
-std::array<float,2>{0.465275913f, 0.959056139f},
-std::array<float,2>{0.887554049f, 0.732559741f},
-std::array<float,2>{0.0843156502f, 0.165480509f},
-std::array<float,2>{0.826638818f, 0.0526987687f},
-std::array<float,2>{0.241843805f, 0.59552443f},
-std::array<float,2>{0.565687597f, 0.795167446f},
-std::array<float,2>{0.333177298f, 0.47679615f},
-std::array<float,2>{0.966323555f, 0.436005324f},
-std::array<float,2>{0.0392002501f, 0.844460547f},
-std::array<float,2>{0.721408248f, 0.519400716f},
-std::array<float,2>{0.412712723f, 0.0642333999f},
-std::array<float,2>{0.506151319f, 0.226122737f},
-std::array<float,2>{0.27850759f, 0.651048422f},
-std::array<float,2>{0.775898337f, 0.920017064f},
-std::array<float,2>{0.145671889f, 0.372996509f},
-std::array<float,2>{0.59512651f, 0.454582602f},
-std::array<float,2>{0.367419451f, 0.778935969f},
-std::array<float,2>{0.848376811f, 0.568762183f},
-std::array<float,2>{0.206075996f, 0.0118396655f},
-std::array<float,2>{0.927416146f, 0.14033033f},
-std::array<float,2>{0.10565383f, 0.716151774f},
-std::array<float,2>{0.628351986f, 0.972459435f},
-std::array<float,2>{0.475175381f, 0.257855624f},
-std::array<float,2>{0.786978126f, 0.34213987f},
-std::array<float,2>{0.16211471f, 0.900075793f},
-std::array<float,2>{0.540682316f, 0.686928034f},
-std::array<float,2>{0.29272899f, 0.191250369f},
-std::array<float,2>{0.694989204f, 0.0990924835f},
-std::array<float,2>{0.376231015f, 0.553063631f},
-std::array<float,2>{0.97604996f, 0.836608171f},
-std::array<float,2>{0.0152930021f, 0.395392656f},
-std::array<float,2>{0.551544607f, 0.35092634f},
-std::array<float,2>{0.29693833f, 0.922140658f},
-std::array<float,2>{0.797561586f, 0.634694755f},
-std::array<float,2>{0.177771151f, 0.244288474f},
-std::array<float,2>{0.986435354f, 0.0826060846f},
-std::array<float,2>{0.0288731437f, 0.509169698f},
-std::array<float,2>{0.703845382f, 0.864587843f},
-std::array<float,2>{0.399434805f, 0.419456571f},
-std::array<float,2>{0.867082775f, 0.485930085f},
-std::array<float,2>{0.195502922f, 0.806328714f},
-std::array<float,2>{0.610057652f, 0.621125698f},
-std::array<float,2>{0.348317593f, 0.0437721871f},
-std::array<float,2>{0.652243614f, 0.181018606f},
-std::array<float,2>{0.499453485f, 0.742470682f},
-std::array<float,2>{0.908172846f, 0.939070523f},
-std::array<float,2>{0.113301806f, 0.301691443f},
-std::array<float,2>{0.743077874f, 0.386623919f},
-std::array<float,2>{0.425652385f, 0.815858722f},
-std::array<float,2>{0.946408808f, 0.536068261f},
-std::array<float,2>{0.0596947707f, 0.111700982f},
-std::array<float,2>{0.763061821f, 0.208791569f},
-std::array<float,2>{0.138429791f, 0.666682363f},
-std::array<float,2>{0.522653639f, 0.879534185f},
-std::array<float,2>{0.256787509f, 0.320178002f},
-std::array<float,2>{0.898812175f, 0.268582642f},
-std::array<float,2>{0.0739092901f, 0.988767743f},
-std::array<float,2>{0.685738862f, 0.699169576f},
-std::array<float,2>{0.43786332f, 0.143706977f},
-std::array<float,2>{0.586140752f, 0.0273260046f},
-std::array<float,2>{0.316750556f, 0.59112525f},
-std::array<float,2>{0.831136286f, 0.757854939f},
-std::array<float,2>{0.23335126f, 0.45178932f},
-std::array<float,2>{0.723995626f, 0.280697227f},
-std::array<float,2>{0.408398211f, 0.993252516f},
-std::array<float,2>{0.964213192f, 0.690631449f},
-std::array<float,2>{0.0441517346f, 0.152624384f},
-std::array<float,2>{0.780093551f, 0.0170328617f},
-std::array<float,2>{0.141409546f, 0.583670914f},
-std::array<float,2>{0.503216922f, 0.752570629f},
-std::array<float,2>{0.275937229f, 0.443536609f},
-std::array<float,2>{0.885411441f, 0.375713497f},
-std::array<float,2>{0.079304412f, 0.82503742f},
-std::array<float,2>{0.66834563f, 0.546783388f},
-std::array<float,2>{0.461660594f, 0.118262991f},
-std::array<float,2>{0.566415012f, 0.217963368f},
-std::array<float,2>{0.329022855f, 0.660855293f},
-std::array<float,2>{0.821013093f, 0.890082359f},
-std::array<float,2>{0.234703526f, 0.322764099f},
-std::array<float,2>{0.54467082f, 0.497816533f},
-std::array<float,2>{0.295055181f, 0.801262259f},
-std::array<float,2>{0.78395015f, 0.615044832f},
-std::array<float,2>{0.156647205f, 0.0383879431f},
-std::array<float,2>{0.968968868f, 0.178894222f},
-std::array<float,2>{0.0105977776f, 0.739650786f},
-std::array<float,2>{0.691167951f, 0.947707474f},
-std::array<float,2>{0.379300535f, 0.306470931f},
-std::array<float,2>{0.845419466f, 0.357363105f},
-std::array<float,2>{0.210891679f, 0.934516132f},
-std::array<float,2>{0.600086331f, 0.628601432f},
-std::array<float,2>{0.372261494f, 0.24052307f},
-std::array<float,2>{0.631971776f, 0.0885508731f},
-std::array<float,2>{0.470804632f, 0.503666222f},
-std::array<float,2>{0.921955228f, 0.873695552f},
-std::array<float,2>{0.104886726f, 0.409683794f},
-std::array<float,2>{0.617172658f, 0.333358526f},
-std::array<float,2>{0.344150096f, 0.895231068f},
-std::array<float,2>{0.860476077f, 0.671878934f},
-std::array<float,2>{0.200698271f, 0.199579403f},
-std::array<float,2>{0.910298645f, 0.101995803f},
-std::array<float,2>{0.110018693f, 0.561561704f},
-std::array<float,2>{0.652955174f, 0.829164505f},
-std::array<float,2>{0.493236631f, 0.399505496f},
-std::array<float,2>{0.80353266f, 0.467732936f},
-std::array<float,2>{0.172854856f, 0.765743911f},
-std::array<float,2>{0.54872781f, 0.575044453f},
-std::array<float,2>{0.302966565f, 0.00449169893f},
-std::array<float,2>{0.708551049f, 0.130522683f},
-std::array<float,2>{0.403772831f, 0.703404963f},
-std::array<float,2>{0.989040196f, 0.98260355f},
-std::array<float,2>{0.0237330142f, 0.257571399f},
-std::array<float,2>{0.68200773f, 0.422621667f},
-std::array<float,2>{0.44331643f, 0.858474314f},
-std::array<float,2>{0.903900862f, 0.529309809f},
-std::array<float,2>{0.0757931992f, 0.075535126f},
-std::array<float,2>{0.833375037f, 0.227532446f},
-std::array<float,2>{0.226886511f, 0.644007504f},
-std::array<float,2>{0.592467666f, 0.912827551f},
-std::array<float,2>{0.315322429f, 0.360540718f},
-std::array<float,2>{0.949701965f, 0.290690303f},
-std::array<float,2>{0.0555445105f, 0.961092949f},
-std::array<float,2>{0.748904228f, 0.724256158f},
-std::array<float,2>{0.425880283f, 0.163039461f},
-std::array<float,2>{0.516434669f, 0.0557671562f},
-std::array<float,2>{0.250935167f, 0.602483571f},
-std::array<float,2>{0.759962916f, 0.788845718f},
-std::array<float,2>{0.136514753f, 0.475566924f},
-std::array<float,2>{0.646230996f, 0.370140463f},
-std::array<float,2>{0.487421066f, 0.914581418f},
-std::array<float,2>{0.916827142f, 0.654241502f},
-std::array<float,2>{0.117198817f, 0.21901539f},
-std::array<float,2>{0.869743466f, 0.0692461878f},
-std::array<float,2>{0.19464156f, 0.52180475f},
-std::array<float,2>{0.623240769f, 0.849631786f},
-std::array<float,2>{0.357485712f, 0.431930244f},
-std::array<float,2>{0.994499505f, 0.480835527f},
-std::array<float,2>{0.0160370003f, 0.792146206f},
-std::array<float,2>{0.715101242f, 0.598284006f},
-std::array<float,2>{0.396909207f, 0.0506394096f},
-std::array<float,2>{0.556416929f, 0.168053836f},
-std::array<float,2>{0.304810047f, 0.729130149f},
-std::array<float,2>{0.805818796f, 0.954397142f},
-std::array<float,2>{0.184403554f, 0.281843692f},
-std::array<float,2>{0.580322623f, 0.393547028f},
-std::array<float,2>{0.325995147f, 0.840647876f},
-std::array<float,2>{0.840209842f, 0.547719121f},
-std::array<float,2>{0.219884425f, 0.0940429345f},
-std::array<float,2>{0.89581871f, 0.194370955f},
-std::array<float,2>{0.064966321f, 0.680544019f},
-std::array<float,2>{0.672401249f, 0.905002177f},
-std::array<float,2>{0.447219461f, 0.339599878f},
-std::array<float,2>{0.757217169f, 0.265553683f},
-std::array<float,2>{0.126786143f, 0.974893987f},
-std::array<float,2>{0.5249722f, 0.711120903f},
-std::array<float,2>{0.262320369f, 0.133217096f},
-std::array<float,2>{0.737625718f, 0.0105132656f},
-std::array<float,2>{0.432358325f, 0.565934181f},
-std::array<float,2>{0.940557957f, 0.774238408f},
-std::array<float,2>{0.050847441f, 0.457912415f},
-std::array<float,2>{0.515063286f, 0.298725337f},
-std::array<float,2>{0.268930316f, 0.942208588f},
-std::array<float,2>{0.766171038f, 0.74930203f},
-std::array<float,2>{0.150466725f, 0.183836788f},
-std::array<float,2>{0.955313146f, 0.0399063416f},
-std::array<float,2>{0.0330063254f, 0.617531657f},
-std::array<float,2>{0.733704805f, 0.81174159f},
-std::array<float,2>{0.419216245f, 0.492183834f},
-std::array<float,2>{0.81479311f, 0.417399108f},
-std::array<float,2>{0.242765278f, 0.860840678f},
-std::array<float,2>{0.575716496f, 0.512190223f},
-std::array<float,2>{0.342187136f, 0.0803367943f},
-std::array<float,2>{0.658468604f, 0.247604504f},
-std::array<float,2>{0.460897148f, 0.640312374f},
-std::array<float,2>{0.88204664f, 0.928015649f},
-std::array<float,2>{0.0914147943f, 0.345482707f},
-std::array<float,2>{0.702219665f, 0.445557624f},
-std::array<float,2>{0.389168918f, 0.764159203f},
-std::array<float,2>{0.981790364f, 0.586377561f},
-std::array<float,2>{0.00334040332f, 0.0298922714f},
-std::array<float,2>{0.792818069f, 0.145531446f},
-std::array<float,2>{0.166146621f, 0.703101814f},
-std::array<float,2>{0.534519196f, 0.986407518f},
-std::array<float,2>{0.286265969f, 0.269800365f},
-std::array<float,2>{0.932299912f, 0.315679133f},
-std::array<float,2>{0.0944425985f, 0.877057791f},
-std::array<float,2>{0.640102506f, 0.671315551f},
-std::array<float,2>{0.482023656f, 0.204312086f},
-std::array<float,2>{0.605794132f, 0.114267208f},
-std::array<float,2>{0.363920212f, 0.535142064f},
-std::array<float,2>{0.851683557f, 0.820001304f},
-std::array<float,2>{0.217021525f, 0.38981846f},
-std::array<float,2>{0.740141451f, 0.353851438f},
-std::array<float,2>{0.435327709f, 0.931439042f},
-std::array<float,2>{0.943034887f, 0.632373989f},
-std::array<float,2>{0.0488807149f, 0.237366006f},
-std::array<float,2>{0.75389272f, 0.0913316905f},
-std::array<float,2>{0.130007029f, 0.504990041f},
-std::array<float,2>{0.529221296f, 0.870884776f},
-std::array<float,2>{0.258464992f, 0.413985401f},
-std::array<float,2>{0.893049359f, 0.492447078f},
-std::array<float,2>{0.0692697912f, 0.800156593f},
-std::array<float,2>{0.679420471f, 0.611894548f},
-std::array<float,2>{0.450153232f, 0.0342019796f},
-std::array<float,2>{0.582981467f, 0.172149077f},
-std::array<float,2>{0.320409954f, 0.737227917f},
-std::array<float,2>{0.839114428f, 0.951604605f},
-std::array<float,2>{0.226257354f, 0.309214711f},
-std::array<float,2>{0.561054468f, 0.379865974f},
-std::array<float,2>{0.309008479f, 0.821380317f},
-std::array<float,2>{0.810059786f, 0.542848647f},
-std::array<float,2>{0.183571726f, 0.121645331f},
-std::array<float,2>{0.996843159f, 0.214780584f},
-std::array<float,2>{0.0207671486f, 0.656311572f},
-std::array<float,2>{0.712515712f, 0.885105908f},
-std::array<float,2>{0.393697888f, 0.327835351f},
-std::array<float,2>{0.874798596f, 0.277147114f},
-std::array<float,2>{0.188869268f, 0.9980703f},
-std::array<float,2>{0.617491066f, 0.694984138f},
-std::array<float,2>{0.352894276f, 0.151752189f},
-std::array<float,2>{0.643477499f, 0.0197223146f},
-std::array<float,2>{0.492177188f, 0.579848647f},
-std::array<float,2>{0.919303477f, 0.756285429f},
-std::array<float,2>{0.122354813f, 0.440204859f},
-std::array<float,2>{0.604018807f, 0.29685685f},
-std::array<float,2>{0.361336529f, 0.967029154f},
-std::array<float,2>{0.857546329f, 0.720385373f},
-std::array<float,2>{0.212777689f, 0.157499209f},
-std::array<float,2>{0.934073508f, 0.0588237718f},
-std::array<float,2>{0.10069187f, 0.606931746f},
-std::array<float,2>{0.635858715f, 0.783570409f},
-std::array<float,2>{0.476982445f, 0.470729232f},
-std::array<float,2>{0.793587863f, 0.428785622f},
-std::array<float,2>{0.168697342f, 0.85531354f},
-std::array<float,2>{0.535366595f, 0.526763201f},
-std::array<float,2>{0.283960819f, 0.0727115721f},
-std::array<float,2>{0.695899308f, 0.231069714f},
-std::array<float,2>{0.384613156f, 0.647504807f},
-std::array<float,2>{0.978025794f, 0.906305194f},
-std::array<float,2>{0.00548929209f, 0.365629435f},
-std::array<float,2>{0.663567662f, 0.464223057f},
-std::array<float,2>{0.456183642f, 0.771419585f},
-std::array<float,2>{0.875226974f, 0.573790371f},
-std::array<float,2>{0.0875639543f, 0.00350167509f},
-std::array<float,2>{0.817934573f, 0.128525585f},
-std::array<float,2>{0.24687767f, 0.709596932f},
-std::array<float,2>{0.573260009f, 0.977881074f},
-std::array<float,2>{0.33635667f, 0.252750397f},
-std::array<float,2>{0.958698392f, 0.330177844f},
-std::array<float,2>{0.0358987302f, 0.891696393f},
-std::array<float,2>{0.72887212f, 0.676933587f},
-std::array<float,2>{0.415106446f, 0.196846932f},
-std::array<float,2>{0.509235322f, 0.107292168f},
-std::array<float,2>{0.270609796f, 0.557700515f},
-std::array<float,2>{0.769963741f, 0.835296094f},
-std::array<float,2>{0.154646814f, 0.40311107f},
-std::array<float,2>{0.62523222f, 0.261593193f},
-std::array<float,2>{0.473132253f, 0.970556021f},
-std::array<float,2>{0.928909123f, 0.718186021f},
-std::array<float,2>{0.109330505f, 0.137566537f},
-std::array<float,2>{0.850892425f, 0.0142291645f},
-std::array<float,2>{0.203690037f, 0.567566335f},
-std::array<float,2>{0.596283615f, 0.780332565f},
-std::array<float,2>{0.369819373f, 0.456841588f},
-std::array<float,2>{0.97420007f, 0.39674449f},
-std::array<float,2>{0.0117763113f, 0.838598311f},
-std::array<float,2>{0.692578912f, 0.551670492f},
-std::array<float,2>{0.378432065f, 0.101161756f},
-std::array<float,2>{0.542942405f, 0.188260034f},
-std::array<float,2>{0.289233536f, 0.683860004f},
-std::array<float,2>{0.787670076f, 0.901098907f},
-std::array<float,2>{0.161237955f, 0.341077596f},
-std::array<float,2>{0.563790321f, 0.47958833f},
-std::array<float,2>{0.335936278f, 0.794461191f},
-std::array<float,2>{0.824907005f, 0.596862257f},
-std::array<float,2>{0.238460988f, 0.0543060862f},
-std::array<float,2>{0.889352679f, 0.167928264f},
-std::array<float,2>{0.0831129998f, 0.730836213f},
-std::array<float,2>{0.665552378f, 0.95746547f},
-std::array<float,2>{0.466849715f, 0.288213968f},
-std::array<float,2>{0.774400175f, 0.37374866f},
-std::array<float,2>{0.147633448f, 0.918484926f},
-std::array<float,2>{0.505574942f, 0.650280356f},
-std::array<float,2>{0.279382855f, 0.223988771f},
-std::array<float,2>{0.719494045f, 0.0654261634f},
-std::array<float,2>{0.410633177f, 0.517451763f},
-std::array<float,2>{0.967508137f, 0.847210348f},
-std::array<float,2>{0.0424176939f, 0.434289336f},
-std::array<float,2>{0.521176219f, 0.317492485f},
-std::array<float,2>{0.254487813f, 0.881345749f},
-std::array<float,2>{0.764534593f, 0.665236294f},
-std::array<float,2>{0.139008671f, 0.210930586f},
-std::array<float,2>{0.949185848f, 0.110739566f},
-std::array<float,2>{0.0619923882f, 0.538736284f},
-std::array<float,2>{0.744213283f, 0.814212084f},
-std::array<float,2>{0.423117906f, 0.384216458f},
-std::array<float,2>{0.830042899f, 0.449854016f},
-std::array<float,2>{0.231515214f, 0.759836853f},
-std::array<float,2>{0.588148355f, 0.591870368f},
-std::array<float,2>{0.31934005f, 0.0239741486f},
-std::array<float,2>{0.684490561f, 0.142020136f},
-std::array<float,2>{0.439724743f, 0.696769178f},
-std::array<float,2>{0.902105629f, 0.990641594f},
-std::array<float,2>{0.0712477192f, 0.267299652f},
-std::array<float,2>{0.706363201f, 0.420755923f},
-std::array<float,2>{0.401133597f, 0.865236461f},
-std::array<float,2>{0.984611511f, 0.510569572f},
-std::array<float,2>{0.0305932872f, 0.0845266357f},
-std::array<float,2>{0.800576746f, 0.243100658f},
-std::array<float,2>{0.177023828f, 0.636284709f},
-std::array<float,2>{0.553273499f, 0.925329506f},
-std::array<float,2>{0.299513042f, 0.347739965f},
-std::array<float,2>{0.908227742f, 0.302792251f},
-std::array<float,2>{0.115405276f, 0.939832628f},
-std::array<float,2>{0.649807274f, 0.744435966f},
-std::array<float,2>{0.497823298f, 0.181959212f},
-std::array<float,2>{0.611889601f, 0.0466427393f},
-std::array<float,2>{0.350725532f, 0.62396872f},
-std::array<float,2>{0.864251912f, 0.807308137f},
-std::array<float,2>{0.198341161f, 0.488041341f},
-std::array<float,2>{0.687973201f, 0.306778133f},
-std::array<float,2>{0.382658094f, 0.946982265f},
-std::array<float,2>{0.972652018f, 0.740353227f},
-std::array<float,2>{0.0093116574f, 0.176589891f},
-std::array<float,2>{0.782468379f, 0.0368630365f},
-std::array<float,2>{0.159337074f, 0.616450787f},
-std::array<float,2>{0.545626521f, 0.804672122f},
-std::array<float,2>{0.293071747f, 0.499805838f},
-std::array<float,2>{0.925587475f, 0.406693578f},
-std::array<float,2>{0.101584934f, 0.872383118f},
-std::array<float,2>{0.630789816f, 0.501008034f},
-std::array<float,2>{0.469642222f, 0.0871850699f},
-std::array<float,2>{0.598691463f, 0.239267588f},
-std::array<float,2>{0.37437737f, 0.62533462f},
-std::array<float,2>{0.846613348f, 0.93612963f},
-std::array<float,2>{0.207810298f, 0.359304458f},
-std::array<float,2>{0.501175523f, 0.443056494f},
-std::array<float,2>{0.273592234f, 0.751898766f},
-std::array<float,2>{0.777436674f, 0.584081352f},
-std::array<float,2>{0.143481806f, 0.0191475973f},
-std::array<float,2>{0.961899638f, 0.155484304f},
-std::array<float,2>{0.046528101f, 0.688322961f},
-std::array<float,2>{0.724878967f, 0.995829523f},
-std::array<float,2>{0.406570494f, 0.278747469f},
-std::array<float,2>{0.822956622f, 0.322006673f},
-std::array<float,2>{0.236779734f, 0.886890709f},
-std::array<float,2>{0.569339871f, 0.663962305f},
-std::array<float,2>{0.330509394f, 0.216486767f},
-std::array<float,2>{0.670074165f, 0.119273402f},
-std::array<float,2>{0.464773268f, 0.543017805f},
-std::array<float,2>{0.883615255f, 0.827164233f},
-std::array<float,2>{0.080391176f, 0.377429396f},
-std::array<float,2>{0.590978563f, 0.362016141f},
-std::array<float,2>{0.313862681f, 0.910896063f},
-std::array<float,2>{0.834901571f, 0.642456651f},
-std::array<float,2>{0.229299456f, 0.229112953f},
-std::array<float,2>{0.905020714f, 0.076971896f},
-std::array<float,2>{0.0779374838f, 0.528191745f},
-std::array<float,2>{0.680003762f, 0.856861115f},
-std::array<float,2>{0.443614662f, 0.423956007f},
-std::array<float,2>{0.759236693f, 0.473068416f},
-std::array<float,2>{0.133678377f, 0.786584139f},
-std::array<float,2>{0.518257678f, 0.60511446f},
-std::array<float,2>{0.253464133f, 0.0573172942f},
-std::array<float,2>{0.746130288f, 0.160540804f},
-std::array<float,2>{0.428828329f, 0.725836873f},
-std::array<float,2>{0.951955557f, 0.964364707f},
-std::array<float,2>{0.0576422028f, 0.292276472f},
-std::array<float,2>{0.654997826f, 0.401116401f},
-std::array<float,2>{0.494518757f, 0.83062309f},
-std::array<float,2>{0.912675381f, 0.55896312f},
-std::array<float,2>{0.112541899f, 0.10481897f},
-std::array<float,2>{0.862596631f, 0.201658264f},
-std::array<float,2>{0.202443153f, 0.675103545f},
-std::array<float,2>{0.615092933f, 0.89795804f},
-std::array<float,2>{0.345849752f, 0.334508449f},
-std::array<float,2>{0.99127692f, 0.254182935f},
-std::array<float,2>{0.0271305032f, 0.982292354f},
-std::array<float,2>{0.709330916f, 0.706528485f},
-std::array<float,2>{0.405837983f, 0.131017566f},
-std::array<float,2>{0.550690472f, 0.00622210046f},
-std::array<float,2>{0.301688105f, 0.577319384f},
-std::array<float,2>{0.801877737f, 0.76928705f},
-std::array<float,2>{0.174678445f, 0.465070367f},
-std::array<float,2>{0.674208164f, 0.337507308f},
-std::array<float,2>{0.448161781f, 0.904280603f},
-std::array<float,2>{0.897634268f, 0.6824826f},
-std::array<float,2>{0.0627092198f, 0.192628056f},
-std::array<float,2>{0.84354037f, 0.0965229422f},
-std::array<float,2>{0.221855849f, 0.548936546f},
-std::array<float,2>{0.578326225f, 0.842216909f},
-std::array<float,2>{0.326904774f, 0.3923271f},
-std::array<float,2>{0.937682152f, 0.460287601f},
-std::array<float,2>{0.0536259115f, 0.77732414f},
-std::array<float,2>{0.736301899f, 0.563987255f},
-std::array<float,2>{0.431099504f, 0.00934435055f},
-std::array<float,2>{0.526493847f, 0.13585481f},
-std::array<float,2>{0.264384687f, 0.71317184f},
-std::array<float,2>{0.755374789f, 0.973133981f},
-std::array<float,2>{0.128348216f, 0.261929989f},
-std::array<float,2>{0.621363282f, 0.430566341f},
-std::array<float,2>{0.356020987f, 0.849390745f},
-std::array<float,2>{0.868474364f, 0.520105898f},
-std::array<float,2>{0.192236051f, 0.0676118881f},
-std::array<float,2>{0.91408658f, 0.221204177f},
-std::array<float,2>{0.119776502f, 0.656006873f},
-std::array<float,2>{0.647612572f, 0.916793585f},
-std::array<float,2>{0.485221416f, 0.368099213f},
-std::array<float,2>{0.808147132f, 0.284027755f},
-std::array<float,2>{0.186600834f, 0.95534867f},
-std::array<float,2>{0.557732224f, 0.727425158f},
-std::array<float,2>{0.308472097f, 0.170074895f},
-std::array<float,2>{0.716951609f, 0.0480141416f},
-std::array<float,2>{0.394615173f, 0.599732697f},
-std::array<float,2>{0.992368221f, 0.789621949f},
-std::array<float,2>{0.0188096538f, 0.483801752f},
-std::array<float,2>{0.53129369f, 0.273010492f},
-std::array<float,2>{0.289010495f, 0.985906959f},
-std::array<float,2>{0.79095614f, 0.699978292f},
-std::array<float,2>{0.164574444f, 0.146895647f},
-std::array<float,2>{0.983440995f, 0.0286050383f},
-std::array<float,2>{0.00163384352f, 0.589004934f},
-std::array<float,2>{0.699998498f, 0.76263535f},
-std::array<float,2>{0.387345433f, 0.447799593f},
-std::array<float,2>{0.85430795f, 0.387913495f},
-std::array<float,2>{0.215327442f, 0.817840695f},
-std::array<float,2>{0.609227896f, 0.53215456f},
-std::array<float,2>{0.366474628f, 0.11596141f},
-std::array<float,2>{0.63742733f, 0.206361607f},
-std::array<float,2>{0.483570993f, 0.669596136f},
-std::array<float,2>{0.930873394f, 0.876862764f},
-std::array<float,2>{0.0960231721f, 0.313822627f},
-std::array<float,2>{0.731646121f, 0.489774138f},
-std::array<float,2>{0.42151317f, 0.809701145f},
-std::array<float,2>{0.953338623f, 0.620219231f},
-std::array<float,2>{0.0340464376f, 0.0425338f},
-std::array<float,2>{0.769041538f, 0.187176913f},
-std::array<float,2>{0.149220988f, 0.747244f},
-std::array<float,2>{0.512168229f, 0.94347471f},
-std::array<float,2>{0.266376436f, 0.300709695f},
-std::array<float,2>{0.878978252f, 0.346171677f},
-std::array<float,2>{0.0924807191f, 0.927614689f},
-std::array<float,2>{0.656432867f, 0.638020635f},
-std::array<float,2>{0.457741767f, 0.249888673f},
-std::array<float,2>{0.576941967f, 0.0783063099f},
-std::array<float,2>{0.341789752f, 0.514652014f},
-std::array<float,2>{0.813774049f, 0.861590803f},
-std::array<float,2>{0.244462341f, 0.414540857f}}
\ No newline at end of file
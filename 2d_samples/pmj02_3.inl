@@ -1,4096 +0,0 @@
-{std::array<float,2>{0.135752141f, 0.273490518f},
-std::array<float,2>{0.651628494f, 0.953806341f},
-std::array<float,2>{0.874106109f, 0.236207053f},
-std::array<float,2>{0.2780343f, 0.54407382f},
-std::array<float,2>{0.450979739f, 0.0697980151f},
-std::array<float,2>{0.969817936f, 0.707962632f},
-std::array<float,2>{0.539317071f, 0.420571953f},
-std::array<float,2>{0.0864253044f, 0.839422047f},
-std::array<float,2>{0.334955394f, 0.47491926f},
-std::array<float,2>{0.792918324f, 0.770337224f},
-std::array<float,2>{0.738591611f, 0.0395116061f},
-std::array<float,2>{0.210130662f, 0.644738317f},
-std::array<float,2>{0.0101113403f, 0.183945626f},
-std::array<float,2>{0.604753256f, 0.606969535f},
-std::array<float,2>{0.876513183f, 0.367147744f},
-std::array<float,2>{0.378969252f, 0.918002784f},
-std::array<float,2>{0.102011614f, 0.393726617f},
-std::array<float,2>{0.512862086f, 0.874206722f},
-std::array<float,2>{0.952134252f, 0.112714306f},
-std::array<float,2>{0.494550735f, 0.736186147f},
-std::array<float,2>{0.281301826f, 0.197865307f},
-std::array<float,2>{0.821947873f, 0.518361151f},
-std::array<float,2>{0.66493845f, 0.288391054f},
-std::array<float,2>{0.163639262f, 0.996841431f},
-std::array<float,2>{0.414195836f, 0.339156866f},
-std::array<float,2>{0.925772965f, 0.900003195f},
-std::array<float,2>{0.576025367f, 0.134922355f},
-std::array<float,2>{0.0472752191f, 0.566251755f},
-std::array<float,2>{0.226495519f, 0.0160325952f},
-std::array<float,2>{0.716717839f, 0.673684895f},
-std::array<float,2>{0.75010258f, 0.464861453f},
-std::array<float,2>{0.354660124f, 0.810282528f},
-std::array<float,2>{0.190346107f, 0.447344273f},
-std::array<float,2>{0.720736742f, 0.783861578f},
-std::array<float,2>{0.810064793f, 0.00961394981f},
-std::array<float,2>{0.312836975f, 0.656917751f},
-std::array<float,2>{0.392673612f, 0.153372958f},
-std::array<float,2>{0.898527801f, 0.585472405f},
-std::array<float,2>{0.615860879f, 0.320215255f},
-std::array<float,2>{0.0168550182f, 0.883787394f},
-std::array<float,2>{0.264147878f, 0.302012771f},
-std::array<float,2>{0.85764879f, 0.970197618f},
-std::array<float,2>{0.632592082f, 0.205546036f},
-std::array<float,2>{0.152767479f, 0.510752618f},
-std::array<float,2>{0.0679049343f, 0.0997556672f},
-std::array<float,2>{0.556322455f, 0.719701767f},
-std::array<float,2>{0.993348539f, 0.38645646f},
-std::array<float,2>{0.467636943f, 0.848412871f},
-std::array<float,2>{0.0417510644f, 0.351579815f},
-std::array<float,2>{0.592071593f, 0.930973589f},
-std::array<float,2>{0.916351378f, 0.157476991f},
-std::array<float,2>{0.43068555f, 0.619718313f},
-std::array<float,2>{0.371173561f, 0.0511954203f},
-std::array<float,2>{0.772071004f, 0.630022526f},
-std::array<float,2>{0.689912498f, 0.497464687f},
-std::array<float,2>{0.241606966f, 0.753574908f},
-std::array<float,2>{0.476808637f, 0.436859131f},
-std::array<float,2>{0.956517518f, 0.817998707f},
-std::array<float,2>{0.516173124f, 0.0849657431f},
-std::array<float,2>{0.114694819f, 0.701696992f},
-std::array<float,2>{0.186659873f, 0.218849823f},
-std::array<float,2>{0.676132858f, 0.55527854f},
-std::array<float,2>{0.834162354f, 0.264861912f},
-std::array<float,2>{0.301469654f, 0.939318776f},
-std::array<float,2>{0.242630765f, 0.328001142f},
-std::array<float,2>{0.701101065f, 0.87827152f},
-std::array<float,2>{0.779784679f, 0.144899562f},
-std::array<float,2>{0.366995901f, 0.5863837f},
-std::array<float,2>{0.428073615f, 0.00463553052f},
-std::array<float,2>{0.909785628f, 0.66578716f},
-std::array<float,2>{0.582708061f, 0.44255951f},
-std::array<float,2>{0.0349806137f, 0.795907736f},
-std::array<float,2>{0.310051769f, 0.376149744f},
-std::array<float,2>{0.837180614f, 0.853275657f},
-std::array<float,2>{0.685145319f, 0.10490074f},
-std::array<float,2>{0.179028213f, 0.730818748f},
-std::array<float,2>{0.124245189f, 0.211170852f},
-std::array<float,2>{0.52758348f, 0.501013041f},
-std::array<float,2>{0.961369753f, 0.305993944f},
-std::array<float,2>{0.474175185f, 0.982563078f},
-std::array<float,2>{0.0291783065f, 0.488429695f},
-std::array<float,2>{0.618138909f, 0.760246575f},
-std::array<float,2>{0.894670129f, 0.060019549f},
-std::array<float,2>{0.404521137f, 0.636864185f},
-std::array<float,2>{0.323664993f, 0.167994216f},
-std::array<float,2>{0.804448247f, 0.609766722f},
-std::array<float,2>{0.72833997f, 0.343871862f},
-std::array<float,2>{0.196176827f, 0.924417615f},
-std::array<float,2>{0.457556933f, 0.250006139f},
-std::array<float,2>{0.987994432f, 0.95007211f},
-std::array<float,2>{0.54808253f, 0.233389139f},
-std::array<float,2>{0.0762702152f, 0.548339307f},
-std::array<float,2>{0.144652113f, 0.093117021f},
-std::array<float,2>{0.639404297f, 0.691781402f},
-std::array<float,2>{0.848657072f, 0.428343385f},
-std::array<float,2>{0.250952452f, 0.825105488f},
-std::array<float,2>{0.171614379f, 0.408441663f},
-std::array<float,2>{0.663621068f, 0.833908737f},
-std::array<float,2>{0.813548684f, 0.0724469274f},
-std::array<float,2>{0.293397844f, 0.71689111f},
-std::array<float,2>{0.492155254f, 0.242400691f},
-std::array<float,2>{0.943394184f, 0.533804953f},
-std::array<float,2>{0.50490886f, 0.273171216f},
-std::array<float,2>{0.0966258273f, 0.963390291f},
-std::array<float,2>{0.344324231f, 0.367801458f},
-std::array<float,2>{0.759494722f, 0.912788093f},
-std::array<float,2>{0.707392752f, 0.176518664f},
-std::array<float,2>{0.231164008f, 0.600579262f},
-std::array<float,2>{0.0570985936f, 0.0372306854f},
-std::array<float,2>{0.569551647f, 0.654377282f},
-std::array<float,2>{0.935936332f, 0.47707057f},
-std::array<float,2>{0.407697141f, 0.778938413f},
-std::array<float,2>{0.0838643312f, 0.294641525f},
-std::array<float,2>{0.533787727f, 0.987296581f},
-std::array<float,2>{0.9795596f, 0.190216675f},
-std::array<float,2>{0.439829528f, 0.523886859f},
-std::array<float,2>{0.269046068f, 0.120032966f},
-std::array<float,2>{0.866219521f, 0.749610484f},
-std::array<float,2>{0.641674519f, 0.399834037f},
-std::array<float,2>{0.127080128f, 0.863103271f},
-std::array<float,2>{0.388123572f, 0.458049238f},
-std::array<float,2>{0.884847879f, 0.79735136f},
-std::array<float,2>{0.595075965f, 0.0265120678f},
-std::array<float,2>{0.00630151154f, 0.68640697f},
-std::array<float,2>{0.212172896f, 0.129823163f},
-std::array<float,2>{0.747065306f, 0.575847208f},
-std::array<float,2>{0.784379184f, 0.330155551f},
-std::array<float,2>{0.343728542f, 0.89604497f},
-std::array<float,2>{0.20502004f, 0.310817122f},
-std::array<float,2>{0.73816663f, 0.978802323f},
-std::array<float,2>{0.795871437f, 0.217951238f},
-std::array<float,2>{0.328378916f, 0.506609142f},
-std::array<float,2>{0.37616092f, 0.106387608f},
-std::array<float,2>{0.881576777f, 0.728974879f},
-std::array<float,2>{0.608946979f, 0.38004443f},
-std::array<float,2>{0.0119351372f, 0.857072711f},
-std::array<float,2>{0.276187897f, 0.439846337f},
-std::array<float,2>{0.868760943f, 0.79292649f},
-std::array<float,2>{0.656042337f, 0.000398614269f},
-std::array<float,2>{0.140572935f, 0.671426892f},
-std::array<float,2>{0.0905120224f, 0.142967403f},
-std::array<float,2>{0.544514716f, 0.591490626f},
-std::array<float,2>{0.975365877f, 0.321310639f},
-std::array<float,2>{0.446410805f, 0.881519675f},
-std::array<float,2>{0.0529333577f, 0.423440069f},
-std::array<float,2>{0.570953846f, 0.823794544f},
-std::array<float,2>{0.926439166f, 0.0891321078f},
-std::array<float,2>{0.420763284f, 0.687839627f},
-std::array<float,2>{0.358786613f, 0.228063777f},
-std::array<float,2>{0.754519284f, 0.55351311f},
-std::array<float,2>{0.713512003f, 0.256614834f},
-std::array<float,2>{0.219099149f, 0.947395861f},
-std::array<float,2>{0.499389678f, 0.347896755f},
-std::array<float,2>{0.946866751f, 0.927803218f},
-std::array<float,2>{0.511038363f, 0.164645299f},
-std::array<float,2>{0.106433071f, 0.616793633f},
-std::array<float,2>{0.158218816f, 0.056483306f},
-std::array<float,2>{0.668580294f, 0.634294391f},
-std::array<float,2>{0.826620996f, 0.485013783f},
-std::array<float,2>{0.286531448f, 0.764645994f},
-std::array<float,2>{0.151221991f, 0.481971323f},
-std::array<float,2>{0.627211869f, 0.777331829f},
-std::array<float,2>{0.854160309f, 0.0324015208f},
-std::array<float,2>{0.260647595f, 0.650498986f},
-std::array<float,2>{0.463848799f, 0.173245251f},
-std::array<float,2>{0.998719215f, 0.595308185f},
-std::array<float,2>{0.561773419f, 0.374377459f},
-std::array<float,2>{0.0632348806f, 0.909215093f},
-std::array<float,2>{0.31772095f, 0.268073261f},
-std::array<float,2>{0.80668658f, 0.968038201f},
-std::array<float,2>{0.722808063f, 0.248028308f},
-std::array<float,2>{0.194001541f, 0.538578987f},
-std::array<float,2>{0.0207933541f, 0.076997973f},
-std::array<float,2>{0.609544277f, 0.712110579f},
-std::array<float,2>{0.905958891f, 0.411541134f},
-std::array<float,2>{0.394669384f, 0.830723763f},
-std::array<float,2>{0.110716797f, 0.33284083f},
-std::array<float,2>{0.522658229f, 0.89259243f},
-std::array<float,2>{0.958645105f, 0.128746957f},
-std::array<float,2>{0.480530828f, 0.571673572f},
-std::array<float,2>{0.30076611f, 0.0292654131f},
-std::array<float,2>{0.830019057f, 0.681626141f},
-std::array<float,2>{0.675474584f, 0.453636587f},
-std::array<float,2>{0.182492122f, 0.801178336f},
-std::array<float,2>{0.4366678f, 0.405142128f},
-std::array<float,2>{0.919991076f, 0.865887046f},
-std::array<float,2>{0.589571655f, 0.124403872f},
-std::array<float,2>{0.0450336002f, 0.743650436f},
-std::array<float,2>{0.237813607f, 0.194994345f},
-std::array<float,2>{0.692396641f, 0.528886795f},
-std::array<float,2>{0.767240047f, 0.289345503f},
-std::array<float,2>{0.368864566f, 0.989704728f},
-std::array<float,2>{0.172412768f, 0.363206923f},
-std::array<float,2>{0.683535516f, 0.914773226f},
-std::array<float,2>{0.842819452f, 0.181692094f},
-std::array<float,2>{0.30562228f, 0.601994693f},
-std::array<float,2>{0.471455067f, 0.0463620201f},
-std::array<float,2>{0.965589881f, 0.641235232f},
-std::array<float,2>{0.526560605f, 0.47206983f},
-std::array<float,2>{0.11882861f, 0.767866254f},
-std::array<float,2>{0.360834181f, 0.416853458f},
-std::array<float,2>{0.777253032f, 0.842841089f},
-std::array<float,2>{0.69701606f, 0.0652462617f},
-std::array<float,2>{0.248241529f, 0.704822779f},
-std::array<float,2>{0.03593532f, 0.241770923f},
-std::array<float,2>{0.578963041f, 0.542635083f},
-std::array<float,2>{0.911935568f, 0.280836374f},
-std::array<float,2>{0.423593521f, 0.960295796f},
-std::array<float,2>{0.0734406561f, 0.462798029f},
-std::array<float,2>{0.550805807f, 0.806616604f},
-std::array<float,2>{0.988726974f, 0.0206996184f},
-std::array<float,2>{0.453147501f, 0.678576469f},
-std::array<float,2>{0.255647719f, 0.137204036f},
-std::array<float,2>{0.845325828f, 0.567027152f},
-std::array<float,2>{0.633815467f, 0.341108322f},
-std::array<float,2>{0.141878307f, 0.903537035f},
-std::array<float,2>{0.399016112f, 0.284807593f},
-std::array<float,2>{0.892461181f, 0.992217302f},
-std::array<float,2>{0.624475181f, 0.201028064f},
-std::array<float,2>{0.0273001809f, 0.52183789f},
-std::array<float,2>{0.201617137f, 0.11392574f},
-std::array<float,2>{0.732114136f, 0.738590717f},
-std::array<float,2>{0.799401104f, 0.395238489f},
-std::array<float,2>{0.327677935f, 0.867349386f},
-std::array<float,2>{0.227314368f, 0.387370646f},
-std::array<float,2>{0.703332365f, 0.845560074f},
-std::array<float,2>{0.761895776f, 0.0937568992f},
-std::array<float,2>{0.350252897f, 0.724038959f},
-std::array<float,2>{0.413724482f, 0.207688138f},
-std::array<float,2>{0.933193862f, 0.513150632f},
-std::array<float,2>{0.566197932f, 0.298057795f},
-std::array<float,2>{0.0587830469f, 0.973622441f},
-std::array<float,2>{0.292196572f, 0.315063119f},
-std::array<float,2>{0.81843555f, 0.890250266f},
-std::array<float,2>{0.659902573f, 0.152141094f},
-std::array<float,2>{0.166646749f, 0.581517577f},
-std::array<float,2>{0.0990248695f, 0.0142387114f},
-std::array<float,2>{0.500029087f, 0.663873792f},
-std::array<float,2>{0.940013707f, 0.451039642f},
-std::array<float,2>{0.487650424f, 0.787116468f},
-std::array<float,2>{0.000982777914f, 0.257961214f},
-std::array<float,2>{0.599581778f, 0.942536175f},
-std::array<float,2>{0.890253127f, 0.223168537f},
-std::array<float,2>{0.385427237f, 0.560426354f},
-std::array<float,2>{0.338120878f, 0.0801499188f},
-std::array<float,2>{0.786103368f, 0.696057916f},
-std::array<float,2>{0.744289398f, 0.430009425f},
-std::array<float,2>{0.215700269f, 0.813290298f},
-std::array<float,2>{0.443341225f, 0.496035129f},
-std::array<float,2>{0.982697248f, 0.755799532f},
-std::array<float,2>{0.538404286f, 0.0495707989f},
-std::array<float,2>{0.0798005611f, 0.628778815f},
-std::array<float,2>{0.132236585f, 0.16354087f},
-std::array<float,2>{0.645045936f, 0.624536097f},
-std::array<float,2>{0.862161875f, 0.357317269f},
-std::array<float,2>{0.269918084f, 0.934334099f},
-std::array<float,2>{0.160939604f, 0.285506815f},
-std::array<float,2>{0.667387128f, 0.998458564f},
-std::array<float,2>{0.823660135f, 0.195796147f},
-std::array<float,2>{0.28513521f, 0.517404318f},
-std::array<float,2>{0.492501229f, 0.111054339f},
-std::array<float,2>{0.950122952f, 0.738092184f},
-std::array<float,2>{0.515267193f, 0.392525285f},
-std::array<float,2>{0.105176702f, 0.871491194f},
-std::array<float,2>{0.352916598f, 0.467324108f},
-std::array<float,2>{0.753441691f, 0.811085403f},
-std::array<float,2>{0.717445076f, 0.0177758969f},
-std::array<float,2>{0.223559022f, 0.67465663f},
-std::array<float,2>{0.050092712f, 0.132936478f},
-std::array<float,2>{0.578108191f, 0.563545465f},
-std::array<float,2>{0.921889246f, 0.336535722f},
-std::array<float,2>{0.416148931f, 0.902205169f},
-std::array<float,2>{0.0891240761f, 0.41853863f},
-std::array<float,2>{0.542255163f, 0.837232947f},
-std::array<float,2>{0.971968293f, 0.0675462335f},
-std::array<float,2>{0.451877832f, 0.710152209f},
-std::array<float,2>{0.279898494f, 0.23632884f},
-std::array<float,2>{0.872404277f, 0.545054555f},
-std::array<float,2>{0.649466217f, 0.276532888f},
-std::array<float,2>{0.133195341f, 0.95615685f},
-std::array<float,2>{0.382232279f, 0.364917427f},
-std::array<float,2>{0.876960993f, 0.921604991f},
-std::array<float,2>{0.601583004f, 0.18590118f},
-std::array<float,2>{0.00788676366f, 0.608380854f},
-std::array<float,2>{0.207828537f, 0.042144075f},
-std::array<float,2>{0.742118597f, 0.648249745f},
-std::array<float,2>{0.790103376f, 0.473808944f},
-std::array<float,2>{0.332287312f, 0.773119688f},
-std::array<float,2>{0.23947157f, 0.498963058f},
-std::array<float,2>{0.688664377f, 0.751826525f},
-std::array<float,2>{0.77000463f, 0.0541416593f},
-std::array<float,2>{0.37355873f, 0.631937385f},
-std::array<float,2>{0.431936383f, 0.159195825f},
-std::array<float,2>{0.915448487f, 0.617360413f},
-std::array<float,2>{0.590256214f, 0.354506493f},
-std::array<float,2>{0.0392033979f, 0.93325907f},
-std::array<float,2>{0.302776515f, 0.262708217f},
-std::array<float,2>{0.83243829f, 0.940434039f},
-std::array<float,2>{0.678379893f, 0.222457275f},
-std::array<float,2>{0.184786737f, 0.558384657f},
-std::array<float,2>{0.116198093f, 0.0821174607f},
-std::array<float,2>{0.518896341f, 0.700712919f},
-std::array<float,2>{0.953535616f, 0.434456915f},
-std::array<float,2>{0.478585064f, 0.819848478f},
-std::array<float,2>{0.0181641225f, 0.316894591f},
-std::array<float,2>{0.61513257f, 0.886143088f},
-std::array<float,2>{0.900812864f, 0.15501225f},
-std::array<float,2>{0.39212051f, 0.58319968f},
-std::array<float,2>{0.31490472f, 0.0109643955f},
-std::array<float,2>{0.810683012f, 0.658879399f},
-std::array<float,2>{0.719988823f, 0.445885003f},
-std::array<float,2>{0.189425364f, 0.783137381f},
-std::array<float,2>{0.466605276f, 0.384579808f},
-std::array<float,2>{0.995792866f, 0.849852681f},
-std::array<float,2>{0.556820512f, 0.0977583379f},
-std::array<float,2>{0.0685196891f, 0.721306741f},
-std::array<float,2>{0.155764416f, 0.204054356f},
-std::array<float,2>{0.629297853f, 0.508476794f},
-std::array<float,2>{0.856638789f, 0.304585785f},
-std::array<float,2>{0.261862427f, 0.971150756f},
-std::array<float,2>{0.198889777f, 0.347081006f},
-std::array<float,2>{0.729487419f, 0.922600567f},
-std::array<float,2>{0.801241279f, 0.171719149f},
-std::array<float,2>{0.321927696f, 0.612044871f},
-std::array<float,2>{0.402366132f, 0.0606328771f},
-std::array<float,2>{0.897460818f, 0.639339805f},
-std::array<float,2>{0.620146453f, 0.490430802f},
-std::array<float,2>{0.0296515804f, 0.759696662f},
-std::array<float,2>{0.253637731f, 0.425849169f},
-std::array<float,2>{0.849937022f, 0.826334238f},
-std::array<float,2>{0.637758195f, 0.091263026f},
-std::array<float,2>{0.147042677f, 0.69515264f},
-std::array<float,2>{0.0756445751f, 0.231803611f},
-std::array<float,2>{0.5500772f, 0.548870027f},
-std::array<float,2>{0.985078812f, 0.251995057f},
-std::array<float,2>{0.460543483f, 0.951300502f},
-std::array<float,2>{0.0326896459f, 0.444130093f},
-std::array<float,2>{0.58458972f, 0.793037295f},
-std::array<float,2>{0.907309055f, 0.00617637997f},
-std::array<float,2>{0.427607089f, 0.66766578f},
-std::array<float,2>{0.364529014f, 0.14817816f},
-std::array<float,2>{0.777352273f, 0.589301288f},
-std::array<float,2>{0.702071428f, 0.325838983f},
-std::array<float,2>{0.244441435f, 0.876171231f},
-std::array<float,2>{0.475414544f, 0.307790726f},
-std::array<float,2>{0.964138269f, 0.981207073f},
-std::array<float,2>{0.530271232f, 0.214806408f},
-std::array<float,2>{0.122769237f, 0.502178371f},
-std::array<float,2>{0.176924244f, 0.101941317f},
-std::array<float,2>{0.685605109f, 0.734345555f},
-std::array<float,2>{0.83926475f, 0.377385378f},
-std::array<float,2>{0.311893851f, 0.853546619f},
-std::array<float,2>{0.125930056f, 0.40166831f},
-std::array<float,2>{0.643150389f, 0.860063016f},
-std::array<float,2>{0.863618731f, 0.117931627f},
-std::array<float,2>{0.266981751f, 0.747969627f},
-std::array<float,2>{0.438065082f, 0.189283252f},
-std::array<float,2>{0.977257252f, 0.526396334f},
-std::array<float,2>{0.532791197f, 0.295925945f},
-std::array<float,2>{0.0855442286f, 0.985139906f},
-std::array<float,2>{0.340018272f, 0.329867035f},
-std::array<float,2>{0.782434642f, 0.897261381f},
-std::array<float,2>{0.749535382f, 0.131635547f},
-std::array<float,2>{0.214236245f, 0.577776611f},
-std::array<float,2>{0.00491010258f, 0.0249462947f},
-std::array<float,2>{0.59663707f, 0.684498549f},
-std::array<float,2>{0.882856369f, 0.459048569f},
-std::array<float,2>{0.389752686f, 0.800509274f},
-std::array<float,2>{0.0939350724f, 0.270762086f},
-std::array<float,2>{0.506740749f, 0.96260947f},
-std::array<float,2>{0.94333595f, 0.245736301f},
-std::array<float,2>{0.489892721f, 0.533080041f},
-std::array<float,2>{0.296570569f, 0.0705723688f},
-std::array<float,2>{0.815884173f, 0.715916872f},
-std::array<float,2>{0.660995185f, 0.406333745f},
-std::array<float,2>{0.168109119f, 0.834715664f},
-std::array<float,2>{0.408321887f, 0.480143338f},
-std::array<float,2>{0.93515563f, 0.78073442f},
-std::array<float,2>{0.567186356f, 0.0369395129f},
-std::array<float,2>{0.0551137291f, 0.652846277f},
-std::array<float,2>{0.233712062f, 0.179447278f},
-std::array<float,2>{0.710588157f, 0.599341273f},
-std::array<float,2>{0.760688245f, 0.369993895f},
-std::array<float,2>{0.347059071f, 0.911107302f},
-std::array<float,2>{0.221402824f, 0.255270839f},
-std::array<float,2>{0.711925328f, 0.946506441f},
-std::array<float,2>{0.756173372f, 0.228631362f},
-std::array<float,2>{0.357353717f, 0.552543044f},
-std::array<float,2>{0.419223964f, 0.087441884f},
-std::array<float,2>{0.928457618f, 0.689656734f},
-std::array<float,2>{0.573352098f, 0.425561339f},
-std::array<float,2>{0.0514220558f, 0.820842266f},
-std::array<float,2>{0.287934601f, 0.48741883f},
-std::array<float,2>{0.824860334f, 0.762221336f},
-std::array<float,2>{0.671340108f, 0.0579909906f},
-std::array<float,2>{0.157113552f, 0.6350106f},
-std::array<float,2>{0.108125485f, 0.166143924f},
-std::array<float,2>{0.507816434f, 0.613376677f},
-std::array<float,2>{0.94748199f, 0.350793481f},
-std::array<float,2>{0.498014122f, 0.92703861f},
-std::array<float,2>{0.0144214211f, 0.3815054f},
-std::array<float,2>{0.605967462f, 0.859042704f},
-std::array<float,2>{0.880107164f, 0.109331392f},
-std::array<float,2>{0.378589571f, 0.727164805f},
-std::array<float,2>{0.330756485f, 0.215090126f},
-std::array<float,2>{0.794073582f, 0.50536418f},
-std::array<float,2>{0.736029804f, 0.309657514f},
-std::array<float,2>{0.205731362f, 0.977550209f},
-std::array<float,2>{0.447644681f, 0.323478729f},
-std::array<float,2>{0.973790824f, 0.879855812f},
-std::array<float,2>{0.54587388f, 0.141152129f},
-std::array<float,2>{0.0922460631f, 0.592686296f},
-std::array<float,2>{0.137854666f, 0.00257410342f},
-std::array<float,2>{0.653997958f, 0.668984532f},
-std::array<float,2>{0.870566487f, 0.439423114f},
-std::array<float,2>{0.27373755f, 0.789936721f},
-std::array<float,2>{0.179999575f, 0.455157876f},
-std::array<float,2>{0.673281789f, 0.803325474f},
-std::array<float,2>{0.83183372f, 0.0308085997f},
-std::array<float,2>{0.297922879f, 0.681889951f},
-std::array<float,2>{0.482485473f, 0.126930043f},
-std::array<float,2>{0.959179938f, 0.57280755f},
-std::array<float,2>{0.519558311f, 0.335301936f},
-std::array<float,2>{0.111576252f, 0.891266704f},
-std::array<float,2>{0.371035218f, 0.292067677f},
-std::array<float,2>{0.76831466f, 0.990642369f},
-std::array<float,2>{0.694497108f, 0.192050993f},
-std::array<float,2>{0.234768882f, 0.530466199f},
-std::array<float,2>{0.0431175157f, 0.122401655f},
-std::array<float,2>{0.587046146f, 0.745056987f},
-std::array<float,2>{0.919660628f, 0.404259026f},
-std::array<float,2>{0.433973759f, 0.864960968f},
-std::array<float,2>{0.0649138838f, 0.372458309f},
-std::array<float,2>{0.558605611f, 0.906573594f},
-std::array<float,2>{0.997699499f, 0.174469456f},
-std::array<float,2>{0.461321324f, 0.596772671f},
-std::array<float,2>{0.257985145f, 0.0347748026f},
-std::array<float,2>{0.853195369f, 0.649911642f},
-std::array<float,2>{0.626733661f, 0.483609736f},
-std::array<float,2>{0.15023002f, 0.773887813f},
-std::array<float,2>{0.396616787f, 0.413313538f},
-std::array<float,2>{0.904224098f, 0.829606354f},
-std::array<float,2>{0.612118959f, 0.0756409913f},
-std::array<float,2>{0.0224826261f, 0.713089108f},
-std::array<float,2>{0.191804588f, 0.249134675f},
-std::array<float,2>{0.725535512f, 0.535437346f},
-std::array<float,2>{0.806083381f, 0.267225564f},
-std::array<float,2>{0.320013851f, 0.965411305f},
-std::array<float,2>{0.143764764f, 0.343615562f},
-std::array<float,2>{0.635209143f, 0.906161606f},
-std::array<float,2>{0.845873833f, 0.14019002f},
-std::array<float,2>{0.256751746f, 0.569467306f},
-std::array<float,2>{0.456718832f, 0.0222351477f},
-std::array<float,2>{0.990411341f, 0.676401019f},
-std::array<float,2>{0.553642511f, 0.463669717f},
-std::array<float,2>{0.071003437f, 0.807799459f},
-std::array<float,2>{0.326120168f, 0.397102058f},
-std::array<float,2>{0.797200322f, 0.869491875f},
-std::array<float,2>{0.733266056f, 0.115598321f},
-std::array<float,2>{0.199953899f, 0.74171716f},
-std::array<float,2>{0.0251295082f, 0.201973721f},
-std::array<float,2>{0.622463048f, 0.520399153f},
-std::array<float,2>{0.892724454f, 0.283056617f},
-std::array<float,2>{0.401107371f, 0.99478811f},
-std::array<float,2>{0.120766521f, 0.469062895f},
-std::array<float,2>{0.523854434f, 0.767506957f},
-std::array<float,2>{0.968577087f, 0.0433116294f},
-std::array<float,2>{0.469669729f, 0.64415288f},
-std::array<float,2>{0.308367729f, 0.180252686f},
-std::array<float,2>{0.841288447f, 0.605137825f},
-std::array<float,2>{0.679753721f, 0.361206919f},
-std::array<float,2>{0.174569592f, 0.916286945f},
-std::array<float,2>{0.423923284f, 0.277646273f},
-std::array<float,2>{0.912772f, 0.957572699f},
-std::array<float,2>{0.58102423f, 0.240201429f},
-std::array<float,2>{0.037627697f, 0.539302886f},
-std::array<float,2>{0.247172788f, 0.0641242713f},
-std::array<float,2>{0.698351502f, 0.705261171f},
-std::array<float,2>{0.774688184f, 0.415016383f},
-std::array<float,2>{0.363197774f, 0.840691209f},
-std::array<float,2>{0.218727514f, 0.432627141f},
-std::array<float,2>{0.744115591f, 0.81614691f},
-std::array<float,2>{0.788392484f, 0.0792952925f},
-std::array<float,2>{0.336192161f, 0.698839426f},
-std::array<float,2>{0.384014904f, 0.225039408f},
-std::array<float,2>{0.888513684f, 0.560795367f},
-std::array<float,2>{0.600719512f, 0.26085031f},
-std::array<float,2>{0.00324599165f, 0.945089936f},
-std::array<float,2>{0.272410482f, 0.358937025f},
-std::array<float,2>{0.860695541f, 0.937124074f},
-std::array<float,2>{0.647081196f, 0.160743773f},
-std::array<float,2>{0.130141512f, 0.622331202f},
-std::array<float,2>{0.0813167691f, 0.0471877009f},
-std::array<float,2>{0.53535223f, 0.625030816f},
-std::array<float,2>{0.981252491f, 0.492901176f},
-std::array<float,2>{0.443627715f, 0.756150603f},
-std::array<float,2>{0.0610132702f, 0.30054149f},
-std::array<float,2>{0.564379215f, 0.975638926f},
-std::array<float,2>{0.931635737f, 0.20917815f},
-std::array<float,2>{0.411782444f, 0.51367867f},
-std::array<float,2>{0.348238617f, 0.0964020938f},
-std::array<float,2>{0.765022337f, 0.725848377f},
-std::array<float,2>{0.706507444f, 0.390209049f},
-std::array<float,2>{0.229223147f, 0.845983684f},
-std::array<float,2>{0.485307693f, 0.451278567f},
-std::array<float,2>{0.93767482f, 0.786589801f},
-std::array<float,2>{0.502905607f, 0.0117292441f},
-std::array<float,2>{0.10025204f, 0.661686957f},
-std::array<float,2>{0.164070964f, 0.149818748f},
-std::array<float,2>{0.65675801f, 0.578677654f},
-std::array<float,2>{0.817678928f, 0.313771248f},
-std::array<float,2>{0.290380865f, 0.88854903f},
-std::array<float,2>{0.184026316f, 0.264593184f},
-std::array<float,2>{0.678728938f, 0.93842572f},
-std::array<float,2>{0.833766758f, 0.220190778f},
-std::array<float,2>{0.303764373f, 0.555830359f},
-std::array<float,2>{0.480093658f, 0.0847468674f},
-std::array<float,2>{0.954752326f, 0.702826977f},
-std::array<float,2>{0.517838418f, 0.435767561f},
-std::array<float,2>{0.116692841f, 0.816685915f},
-std::array<float,2>{0.374170601f, 0.49630031f},
-std::array<float,2>{0.771427274f, 0.752882957f},
-std::array<float,2>{0.687505782f, 0.0521743037f},
-std::array<float,2>{0.23833105f, 0.629573882f},
-std::array<float,2>{0.0407424122f, 0.156641304f},
-std::array<float,2>{0.591617048f, 0.621060312f},
-std::array<float,2>{0.914958894f, 0.353350431f},
-std::array<float,2>{0.432976454f, 0.930062234f},
-std::array<float,2>{0.0702482611f, 0.384927511f},
-std::array<float,2>{0.558579266f, 0.849154174f},
-std::array<float,2>{0.994342983f, 0.101389289f},
-std::array<float,2>{0.46580416f, 0.720202863f},
-std::array<float,2>{0.263334125f, 0.206160024f},
-std::array<float,2>{0.856045246f, 0.510435641f},
-std::array<float,2>{0.630152762f, 0.301016629f},
-std::array<float,2>{0.15523845f, 0.968807161f},
-std::array<float,2>{0.391585201f, 0.318829685f},
-std::array<float,2>{0.902156055f, 0.884762228f},
-std::array<float,2>{0.613457859f, 0.153150722f},
-std::array<float,2>{0.0194088407f, 0.584211588f},
-std::array<float,2>{0.188249931f, 0.00785237458f},
-std::array<float,2>{0.719549f, 0.657592535f},
-std::array<float,2>{0.812397182f, 0.448893696f},
-std::array<float,2>{0.31631124f, 0.784650207f},
-std::array<float,2>{0.224242285f, 0.466590106f},
-std::array<float,2>{0.717949629f, 0.809113503f},
-std::array<float,2>{0.752145767f, 0.0173568036f},
-std::array<float,2>{0.352473259f, 0.672388554f},
-std::array<float,2>{0.417298406f, 0.135971859f},
-std::array<float,2>{0.923196077f, 0.565287709f},
-std::array<float,2>{0.577026069f, 0.338003963f},
-std::array<float,2>{0.0496847481f, 0.898751557f},
-std::array<float,2>{0.283660769f, 0.287441581f},
-std::array<float,2>{0.823175907f, 0.997825205f},
-std::array<float,2>{0.666633844f, 0.19887653f},
-std::array<float,2>{0.161683127f, 0.519271791f},
-std::array<float,2>{0.104342282f, 0.111927539f},
-std::array<float,2>{0.513783395f, 0.735048711f},
-std::array<float,2>{0.950310826f, 0.393407077f},
-std::array<float,2>{0.49376756f, 0.873556197f},
-std::array<float,2>{0.00964352302f, 0.366019875f},
-std::array<float,2>{0.603411615f, 0.919342279f},
-std::array<float,2>{0.878412545f, 0.185159072f},
-std::array<float,2>{0.381594867f, 0.605485439f},
-std::array<float,2>{0.333024025f, 0.0404604487f},
-std::array<float,2>{0.789988339f, 0.645732522f},
-std::array<float,2>{0.740814209f, 0.476244688f},
-std::array<float,2>{0.208449677f, 0.770524859f},
-std::array<float,2>{0.452813417f, 0.420986265f},
-std::array<float,2>{0.970912099f, 0.838481486f},
-std::array<float,2>{0.541923523f, 0.0691050962f},
-std::array<float,2>{0.0885782316f, 0.708195329f},
-std::array<float,2>{0.133991316f, 0.234575331f},
-std::array<float,2>{0.648916364f, 0.543028057f},
-std::array<float,2>{0.871473551f, 0.275078505f},
-std::array<float,2>{0.280391484f, 0.954699755f},
-std::array<float,2>{0.213289484f, 0.331351519f},
-std::array<float,2>{0.748993039f, 0.894987047f},
-std::array<float,2>{0.782183945f, 0.130637854f},
-std::array<float,2>{0.341108024f, 0.575191677f},
-std::array<float,2>{0.389150977f, 0.0263580009f},
-std::array<float,2>{0.884055138f, 0.687411845f},
-std::array<float,2>{0.597445667f, 0.457252711f},
-std::array<float,2>{0.00448407186f, 0.797915101f},
-std::array<float,2>{0.266588748f, 0.398603976f},
-std::array<float,2>{0.864769757f, 0.861650586f},
-std::array<float,2>{0.644002736f, 0.121084563f},
-std::array<float,2>{0.126314595f, 0.748878956f},
-std::array<float,2>{0.0845115781f, 0.190893382f},
-std::array<float,2>{0.531708121f, 0.525188804f},
-std::array<float,2>{0.97764498f, 0.293686479f},
-std::array<float,2>{0.43907097f, 0.987621307f},
-std::array<float,2>{0.0559437312f, 0.478018612f},
-std::array<float,2>{0.567458212f, 0.777605653f},
-std::array<float,2>{0.93422693f, 0.0385491066f},
-std::array<float,2>{0.409602642f, 0.656208873f},
-std::array<float,2>{0.346293509f, 0.177729622f},
-std::array<float,2>{0.76076138f, 0.600961089f},
-std::array<float,2>{0.709905267f, 0.368389279f},
-std::array<float,2>{0.233093485f, 0.914045393f},
-std::array<float,2>{0.488640696f, 0.27234453f},
-std::array<float,2>{0.941536129f, 0.964174509f},
-std::array<float,2>{0.507288277f, 0.243606403f},
-std::array<float,2>{0.0951923504f, 0.534686744f},
-std::array<float,2>{0.169911847f, 0.0734206885f},
-std::array<float,2>{0.661780596f, 0.718182683f},
-std::array<float,2>{0.81537956f, 0.409618348f},
-std::array<float,2>{0.294978887f, 0.832657635f},
-std::array<float,2>{0.147957936f, 0.429031283f},
-std::array<float,2>{0.637396216f, 0.825993896f},
-std::array<float,2>{0.851504862f, 0.092010133f},
-std::array<float,2>{0.252520919f, 0.693164468f},
-std::array<float,2>{0.459035039f, 0.233408019f},
-std::array<float,2>{0.986086249f, 0.547029197f},
-std::array<float,2>{0.549118817f, 0.251922935f},
-std::array<float,2>{0.0745050162f, 0.951057971f},
-std::array<float,2>{0.320819825f, 0.345422626f},
-std::array<float,2>{0.802363098f, 0.925117016f},
-std::array<float,2>{0.72967428f, 0.169900939f},
-std::array<float,2>{0.197556868f, 0.610589802f},
-std::array<float,2>{0.0311131459f, 0.0589284673f},
-std::array<float,2>{0.61978358f, 0.638594985f},
-std::array<float,2>{0.897828817f, 0.489809364f},
-std::array<float,2>{0.403813988f, 0.760937691f},
-std::array<float,2>{0.12147031f, 0.304792672f},
-std::array<float,2>{0.530312777f, 0.98348248f},
-std::array<float,2>{0.963183522f, 0.21251218f},
-std::array<float,2>{0.476398617f, 0.500025094f},
-std::array<float,2>{0.310964674f, 0.103702351f},
-std::array<float,2>{0.838840783f, 0.732384145f},
-std::array<float,2>{0.686703801f, 0.375360548f},
-std::array<float,2>{0.176057518f, 0.852379084f},
-std::array<float,2>{0.426644176f, 0.442282796f},
-std::array<float,2>{0.907144487f, 0.795133114f},
-std::array<float,2>{0.585004151f, 0.00583998347f},
-std::array<float,2>{0.0321652293f, 0.664711595f},
-std::array<float,2>{0.245536923f, 0.146085963f},
-std::array<float,2>{0.70222187f, 0.587494254f},
-std::array<float,2>{0.77927047f, 0.326460153f},
-std::array<float,2>{0.363423288f, 0.877440453f},
-std::array<float,2>{0.235731468f, 0.290700227f},
-std::array<float,2>{0.694322824f, 0.988822579f},
-std::array<float,2>{0.769054472f, 0.194105238f},
-std::array<float,2>{0.36929515f, 0.527532637f},
-std::array<float,2>{0.435012698f, 0.123755731f},
-std::array<float,2>{0.918036461f, 0.742287219f},
-std::array<float,2>{0.586197793f, 0.405745834f},
-std::array<float,2>{0.0446489677f, 0.866668999f},
-std::array<float,2>{0.297677964f, 0.454169273f},
-std::array<float,2>{0.830766082f, 0.802365303f},
-std::array<float,2>{0.672645867f, 0.0276701208f},
-std::array<float,2>{0.180766284f, 0.67988199f},
-std::array<float,2>{0.112862647f, 0.127080485f},
-std::array<float,2>{0.52147907f, 0.570364237f},
-std::array<float,2>{0.960644007f, 0.333015352f},
-std::array<float,2>{0.483975232f, 0.894407153f},
-std::array<float,2>{0.0221415386f, 0.410253704f},
-std::array<float,2>{0.612411678f, 0.831363976f},
-std::array<float,2>{0.902359903f, 0.0775205642f},
-std::array<float,2>{0.397744268f, 0.711500883f},
-std::array<float,2>{0.318986326f, 0.246185884f},
-std::array<float,2>{0.805247486f, 0.537958562f},
-std::array<float,2>{0.725791812f, 0.269440055f},
-std::array<float,2>{0.19313167f, 0.96748358f},
-std::array<float,2>{0.462870866f, 0.373576254f},
-std::array<float,2>{0.996900201f, 0.908972502f},
-std::array<float,2>{0.560049653f, 0.172564983f},
-std::array<float,2>{0.0658431426f, 0.594588578f},
-std::array<float,2>{0.14876695f, 0.031713549f},
-std::array<float,2>{0.625303328f, 0.651850164f},
-std::array<float,2>{0.851666808f, 0.480686724f},
-std::array<float,2>{0.259696096f, 0.775820911f},
-std::array<float,2>{0.157760203f, 0.485429823f},
-std::array<float,2>{0.670511007f, 0.764852941f},
-std::array<float,2>{0.825230241f, 0.05529866f},
-std::array<float,2>{0.288549185f, 0.632921159f},
-std::array<float,2>{0.496553808f, 0.165222526f},
-std::array<float,2>{0.94852531f, 0.615594625f},
-std::array<float,2>{0.509074211f, 0.34928605f},
-std::array<float,2>{0.109099336f, 0.929495752f},
-std::array<float,2>{0.356313318f, 0.25729987f},
-std::array<float,2>{0.757141352f, 0.948303819f},
-std::array<float,2>{0.71169138f, 0.227332696f},
-std::array<float,2>{0.222575843f, 0.554566562f},
-std::array<float,2>{0.0520755425f, 0.0884765312f},
-std::array<float,2>{0.572298586f, 0.688670754f},
-std::array<float,2>{0.929546177f, 0.42282781f},
-std::array<float,2>{0.418271601f, 0.822616458f},
-std::array<float,2>{0.0937012509f, 0.320842415f},
-std::array<float,2>{0.546007872f, 0.881853402f},
-std::array<float,2>{0.973631918f, 0.14360024f},
-std::array<float,2>{0.448836684f, 0.589968622f},
-std::array<float,2>{0.274739563f, 0.00101473462f},
-std::array<float,2>{0.869379103f, 0.670470536f},
-std::array<float,2>{0.652736545f, 0.440527231f},
-std::array<float,2>{0.136778459f, 0.791974843f},
-std::array<float,2>{0.377418876f, 0.379760057f},
-std::array<float,2>{0.879651487f, 0.855990946f},
-std::array<float,2>{0.606964231f, 0.107260831f},
-std::array<float,2>{0.0146970991f, 0.730044603f},
-std::array<float,2>{0.206116617f, 0.216953442f},
-std::array<float,2>{0.734731555f, 0.507093906f},
-std::array<float,2>{0.793333769f, 0.311540723f},
-std::array<float,2>{0.331591994f, 0.980126441f},
-std::array<float,2>{0.129856676f, 0.355828464f},
-std::array<float,2>{0.647629738f, 0.935220122f},
-std::array<float,2>{0.859898329f, 0.162537426f},
-std::array<float,2>{0.272974253f, 0.62308687f},
-std::array<float,2>{0.444758326f, 0.0502370484f},
-std::array<float,2>{0.981535316f, 0.627542257f},
-std::array<float,2>{0.536978483f, 0.494499981f},
-std::array<float,2>{0.0809339657f, 0.754659891f},
-std::array<float,2>{0.337461323f, 0.431303889f},
-std::array<float,2>{0.788061857f, 0.81372261f},
-std::array<float,2>{0.743151903f, 0.0814978033f},
-std::array<float,2>{0.2172748f, 0.69682467f},
-std::array<float,2>{0.00276724435f, 0.223906457f},
-std::array<float,2>{0.600043476f, 0.558606625f},
-std::array<float,2>{0.887461126f, 0.25888148f},
-std::array<float,2>{0.383747727f, 0.942054272f},
-std::array<float,2>{0.100631148f, 0.449848175f},
-std::array<float,2>{0.503353357f, 0.78818661f},
-std::array<float,2>{0.938965261f, 0.0153535744f},
-std::array<float,2>{0.485815614f, 0.662512422f},
-std::array<float,2>{0.289669663f, 0.150732592f},
-std::array<float,2>{0.817362905f, 0.580703974f},
-std::array<float,2>{0.657827497f, 0.315843672f},
-std::array<float,2>{0.16546537f, 0.889594615f},
-std::array<float,2>{0.411123961f, 0.297560543f},
-std::array<float,2>{0.929915071f, 0.974381626f},
-std::array<float,2>{0.562659442f, 0.208219752f},
-std::array<float,2>{0.0620158464f, 0.512009561f},
-std::array<float,2>{0.229672566f, 0.0954690129f},
-std::array<float,2>{0.706006229f, 0.723523915f},
-std::array<float,2>{0.764595389f, 0.388220251f},
-std::array<float,2>{0.348805696f, 0.844590724f},
-std::array<float,2>{0.200755358f, 0.395709485f},
-std::array<float,2>{0.7342996f, 0.869027197f},
-std::array<float,2>{0.798074901f, 0.114655972f},
-std::array<float,2>{0.324896157f, 0.739832044f},
-std::array<float,2>{0.401636899f, 0.199503481f},
-std::array<float,2>{0.893899143f, 0.522639394f},
-std::array<float,2>{0.62200439f, 0.283838868f},
-std::array<float,2>{0.0239613447f, 0.993414283f},
-std::array<float,2>{0.257505119f, 0.340292275f},
-std::array<float,2>{0.847552478f, 0.902535021f},
-std::array<float,2>{0.635749161f, 0.137713537f},
-std::array<float,2>{0.142741352f, 0.567656696f},
-std::array<float,2>{0.071478501f, 0.0198683701f},
-std::array<float,2>{0.554469347f, 0.679496109f},
-std::array<float,2>{0.991565287f, 0.460939497f},
-std::array<float,2>{0.455380857f, 0.805048645f},
-std::array<float,2>{0.0385865048f, 0.279528528f},
-std::array<float,2>{0.581831098f, 0.959641695f},
-std::array<float,2>{0.913885117f, 0.240279749f},
-std::array<float,2>{0.425123185f, 0.541512072f},
-std::array<float,2>{0.361362427f, 0.0662299618f},
-std::array<float,2>{0.77431637f, 0.70338285f},
-std::array<float,2>{0.69797653f, 0.417244822f},
-std::array<float,2>{0.246364638f, 0.841823459f},
-std::array<float,2>{0.469877601f, 0.471390814f},
-std::array<float,2>{0.967283726f, 0.76933974f},
-std::array<float,2>{0.525035143f, 0.0451833792f},
-std::array<float,2>{0.119340703f, 0.642012477f},
-std::array<float,2>{0.174880743f, 0.18353501f},
-std::array<float,2>{0.681569099f, 0.603331149f},
-std::array<float,2>{0.840549469f, 0.361336589f},
-std::array<float,2>{0.306725979f, 0.915177822f},
-std::array<float,2>{0.154145882f, 0.303121328f},
-std::array<float,2>{0.631287098f, 0.97181195f},
-std::array<float,2>{0.858872414f, 0.205074728f},
-std::array<float,2>{0.265452802f, 0.50975436f},
-std::array<float,2>{0.467882454f, 0.0992081389f},
-std::array<float,2>{0.99308157f, 0.721885264f},
-std::array<float,2>{0.55476433f, 0.383566409f},
-std::array<float,2>{0.067378886f, 0.850612998f},
-std::array<float,2>{0.314188063f, 0.44660309f},
-std::array<float,2>{0.808884919f, 0.781435072f},
-std::array<float,2>{0.72255367f, 0.00994136278f},
-std::array<float,2>{0.190953106f, 0.65975076f},
-std::array<float,2>{0.0159111805f, 0.155676141f},
-std::array<float,2>{0.616801023f, 0.582424104f},
-std::array<float,2>{0.900147557f, 0.317575186f},
-std::array<float,2>{0.394317597f, 0.885292828f},
-std::array<float,2>{0.114181563f, 0.434708595f},
-std::array<float,2>{0.517440319f, 0.818881154f},
-std::array<float,2>{0.955089033f, 0.0837898999f},
-std::array<float,2>{0.478439093f, 0.699946105f},
-std::array<float,2>{0.302266955f, 0.221353203f},
-std::array<float,2>{0.83551991f, 0.556931138f},
-std::array<float,2>{0.676877856f, 0.262520194f},
-std::array<float,2>{0.186154157f, 0.939689755f},
-std::array<float,2>{0.43047756f, 0.354428917f},
-std::array<float,2>{0.917605639f, 0.932233214f},
-std::array<float,2>{0.59374243f, 0.158262253f},
-std::array<float,2>{0.0424515344f, 0.618293703f},
-std::array<float,2>{0.240962803f, 0.0534423254f},
-std::array<float,2>{0.691116452f, 0.631106794f},
-std::array<float,2>{0.772700429f, 0.499958098f},
-std::array<float,2>{0.372466534f, 0.750707805f},
-std::array<float,2>{0.209676594f, 0.472837597f},
-std::array<float,2>{0.740043104f, 0.77163893f},
-std::array<float,2>{0.791629791f, 0.0414957143f},
-std::array<float,2>{0.335273266f, 0.647072732f},
-std::array<float,2>{0.380261719f, 0.187115341f},
-std::array<float,2>{0.875773013f, 0.608464003f},
-std::array<float,2>{0.60352385f, 0.363768071f},
-std::array<float,2>{0.0111285998f, 0.920719624f},
-std::array<float,2>{0.27834031f, 0.275927871f},
-std::array<float,2>{0.873386264f, 0.95553869f},
-std::array<float,2>{0.650590777f, 0.237830758f},
-std::array<float,2>{0.135618135f, 0.546103776f},
-std::array<float,2>{0.0870763361f, 0.0667619556f},
-std::array<float,2>{0.541012764f, 0.708993614f},
-std::array<float,2>{0.969515562f, 0.41978237f},
-std::array<float,2>{0.449946254f, 0.83658731f},
-std::array<float,2>{0.0479776785f, 0.337222874f},
-std::array<float,2>{0.574224353f, 0.901129663f},
-std::array<float,2>{0.924628198f, 0.134528458f},
-std::array<float,2>{0.415606111f, 0.563357413f},
-std::array<float,2>{0.353800237f, 0.0194422491f},
-std::array<float,2>{0.751295865f, 0.674811482f},
-std::array<float,2>{0.715526402f, 0.468467861f},
-std::array<float,2>{0.224983305f, 0.811564684f},
-std::array<float,2>{0.495985717f, 0.390914053f},
-std::array<float,2>{0.952543199f, 0.872810841f},
-std::array<float,2>{0.51233232f, 0.109450363f},
-std::array<float,2>{0.103364646f, 0.736984193f},
-std::array<float,2>{0.163085535f, 0.196353078f},
-std::array<float,2>{0.665355623f, 0.516364217f},
-std::array<float,2>{0.82089299f, 0.28673315f},
-std::array<float,2>{0.282532871f, 0.999331832f},
-std::array<float,2>{0.232243046f, 0.371067971f},
-std::array<float,2>{0.70892936f, 0.911392987f},
-std::array<float,2>{0.758235693f, 0.178509355f},
-std::array<float,2>{0.345570832f, 0.598364353f},
-std::array<float,2>{0.406736463f, 0.035943877f},
-std::array<float,2>{0.937231421f, 0.653712809f},
-std::array<float,2>{0.569142282f, 0.479231089f},
-std::array<float,2>{0.0581428781f, 0.779644012f},
-std::array<float,2>{0.294495791f, 0.407909662f},
-std::array<float,2>{0.81286782f, 0.835272312f},
-std::array<float,2>{0.662411094f, 0.0718036518f},
-std::array<float,2>{0.170677736f, 0.715251505f},
-std::array<float,2>{0.097588174f, 0.24458921f},
-std::array<float,2>{0.504581392f, 0.531906545f},
-std::array<float,2>{0.944350302f, 0.270284355f},
-std::array<float,2>{0.490850627f, 0.961693347f},
-std::array<float,2>{0.0075387028f, 0.46026665f},
-std::array<float,2>{0.593958259f, 0.799150288f},
-std::array<float,2>{0.886134684f, 0.0236729681f},
-std::array<float,2>{0.386891007f, 0.685489595f},
-std::array<float,2>{0.342704982f, 0.132466361f},
-std::array<float,2>{0.783622384f, 0.57681787f},
-std::array<float,2>{0.747226417f, 0.32837683f},
-std::array<float,2>{0.211898342f, 0.898142099f},
-std::array<float,2>{0.44129163f, 0.294999033f},
-std::array<float,2>{0.978521228f, 0.985834241f},
-std::array<float,2>{0.534629941f, 0.188130081f},
-std::array<float,2>{0.0823316127f, 0.525476158f},
-std::array<float,2>{0.128034964f, 0.118189201f},
-std::array<float,2>{0.64075309f, 0.747049332f},
-std::array<float,2>{0.866157949f, 0.401301324f},
-std::array<float,2>{0.268474787f, 0.86109221f},
-std::array<float,2>{0.177776128f, 0.378414392f},
-std::array<float,2>{0.684351385f, 0.855104923f},
-std::array<float,2>{0.836078644f, 0.103486143f},
-std::array<float,2>{0.308815271f, 0.733300626f},
-std::array<float,2>{0.472955883f, 0.21338971f},
-std::array<float,2>{0.961952507f, 0.50325048f},
-std::array<float,2>{0.528856218f, 0.306916207f},
-std::array<float,2>{0.12350519f, 0.981822252f},
-std::array<float,2>{0.365696967f, 0.325167358f},
-std::array<float,2>{0.780309975f, 0.875715494f},
-std::array<float,2>{0.699301362f, 0.147275582f},
-std::array<float,2>{0.243893802f, 0.588290989f},
-std::array<float,2>{0.0336995944f, 0.00703709992f},
-std::array<float,2>{0.583007991f, 0.666375279f},
-std::array<float,2>{0.908895195f, 0.444627315f},
-std::array<float,2>{0.429210097f, 0.794107199f},
-std::array<float,2>{0.0774706602f, 0.253822088f},
-std::array<float,2>{0.54725337f, 0.95285207f},
-std::array<float,2>{0.98692292f, 0.231081545f},
-std::array<float,2>{0.458938211f, 0.550369859f},
-std::array<float,2>{0.251096278f, 0.0906941146f},
-std::array<float,2>{0.84847039f, 0.693540692f},
-std::array<float,2>{0.639679968f, 0.426801503f},
-std::array<float,2>{0.145731091f, 0.827627242f},
-std::array<float,2>{0.406142622f, 0.491720319f},
-std::array<float,2>{0.895922363f, 0.758708179f},
-std::array<float,2>{0.619049609f, 0.0624683686f},
-std::array<float,2>{0.0279634818f, 0.640310884f},
-std::array<float,2>{0.197147399f, 0.170515925f},
-std::array<float,2>{0.727120161f, 0.613102317f},
-std::array<float,2>{0.802789748f, 0.345749408f},
-std::array<float,2>{0.322646767f, 0.923453271f},
-std::array<float,2>{0.19506979f, 0.266464978f},
-std::array<float,2>{0.723929524f, 0.966683745f},
-std::array<float,2>{0.807913423f, 0.248763636f},
-std::array<float,2>{0.316943198f, 0.536461174f},
-std::array<float,2>{0.396432877f, 0.0748336986f},
-std::array<float,2>{0.905012131f, 0.71467793f},
-std::array<float,2>{0.611008525f, 0.41231066f},
-std::array<float,2>{0.0197820347f, 0.828518331f},
-std::array<float,2>{0.260784775f, 0.482792497f},
-std::array<float,2>{0.8553195f, 0.775167167f},
-std::array<float,2>{0.627960861f, 0.0337711424f},
-std::array<float,2>{0.151402861f, 0.648724556f},
-std::array<float,2>{0.0636887923f, 0.175533906f},
-std::array<float,2>{0.560745716f, 0.596552432f},
-std::array<float,2>{0.99950552f, 0.371940464f},
-std::array<float,2>{0.463871986f, 0.908112228f},
-std::array<float,2>{0.0460115969f, 0.402999759f},
-std::array<float,2>{0.588272452f, 0.863325298f},
-std::array<float,2>{0.921069503f, 0.121356539f},
-std::array<float,2>{0.436301947f, 0.745695353f},
-std::array<float,2>{0.367529631f, 0.193337664f},
-std::array<float,2>{0.766264141f, 0.529715121f},
-std::array<float,2>{0.691694736f, 0.291281253f},
-std::array<float,2>{0.237004742f, 0.991588175f},
-std::array<float,2>{0.481888235f, 0.334733039f},
-std::array<float,2>{0.957705677f, 0.891617537f},
-std::array<float,2>{0.521513283f, 0.12515451f},
-std::array<float,2>{0.110244744f, 0.573371232f},
-std::array<float,2>{0.183410525f, 0.0299021397f},
-std::array<float,2>{0.67440623f, 0.683209836f},
-std::array<float,2>{0.828187764f, 0.45611465f},
-std::array<float,2>{0.299533844f, 0.803838551f},
-std::array<float,2>{0.138959944f, 0.437669277f},
-std::array<float,2>{0.654640079f, 0.790782034f},
-std::array<float,2>{0.867404163f, 0.00344269187f},
-std::array<float,2>{0.277163744f, 0.668794274f},
-std::array<float,2>{0.445783138f, 0.142028138f},
-std::array<float,2>{0.975825846f, 0.593277037f},
-std::array<float,2>{0.543839872f, 0.322677374f},
-std::array<float,2>{0.0917965919f, 0.880372167f},
-std::array<float,2>{0.329942733f, 0.308934808f},
-std::array<float,2>{0.796433389f, 0.977342308f},
-std::array<float,2>{0.737176538f, 0.216347873f},
-std::array<float,2>{0.203421295f, 0.504579782f},
-std::array<float,2>{0.0134462193f, 0.107687876f},
-std::array<float,2>{0.607531428f, 0.727714181f},
-std::array<float,2>{0.882096291f, 0.381919891f},
-std::array<float,2>{0.375292331f, 0.858060181f},
-std::array<float,2>{0.107057862f, 0.350508332f},
-std::array<float,2>{0.509827971f, 0.926250994f},
-std::array<float,2>{0.94572556f, 0.167449757f},
-std::array<float,2>{0.498356611f, 0.614875853f},
-std::array<float,2>{0.285636604f, 0.0571229532f},
-std::array<float,2>{0.82735312f, 0.636457324f},
-std::array<float,2>{0.669821382f, 0.486680329f},
-std::array<float,2>{0.159453437f, 0.763017774f},
-std::array<float,2>{0.42131874f, 0.423988581f},
-std::array<float,2>{0.927475452f, 0.821654499f},
-std::array<float,2>{0.571335375f, 0.0868754536f},
-std::array<float,2>{0.0542797856f, 0.691068411f},
-std::array<float,2>{0.219822153f, 0.230062217f},
-std::array<float,2>{0.714510202f, 0.55174607f},
-std::array<float,2>{0.755754173f, 0.254832596f},
-std::array<float,2>{0.357830644f, 0.946126044f},
-std::array<float,2>{0.167154551f, 0.312756062f},
-std::array<float,2>{0.658622742f, 0.887477875f},
-std::array<float,2>{0.819557846f, 0.14875868f},
-std::array<float,2>{0.291298062f, 0.57976836f},
-std::array<float,2>{0.486481696f, 0.0127533106f},
-std::array<float,2>{0.941265106f, 0.660666764f},
-std::array<float,2>{0.5013327f, 0.453003079f},
-std::array<float,2>{0.0977139249f, 0.785531759f},
-std::array<float,2>{0.3509022f, 0.388780713f},
-std::array<float,2>{0.76294589f, 0.847140074f},
-std::array<float,2>{0.704416096f, 0.0967343375f},
-std::array<float,2>{0.228073061f, 0.724755287f},
-std::array<float,2>{0.0603729449f, 0.210394859f},
-std::array<float,2>{0.565070927f, 0.514883518f},
-std::array<float,2>{0.932200909f, 0.298920453f},
-std::array<float,2>{0.412608981f, 0.974731982f},
-std::array<float,2>{0.0784412846f, 0.493501395f},
-std::array<float,2>{0.537431419f, 0.757255495f},
-std::array<float,2>{0.983755291f, 0.0484777018f},
-std::array<float,2>{0.44183743f, 0.626222849f},
-std::array<float,2>{0.271477371f, 0.161987424f},
-std::array<float,2>{0.863184452f, 0.621938944f},
-std::array<float,2>{0.645920753f, 0.358018011f},
-std::array<float,2>{0.130869403f, 0.935953081f},
-std::array<float,2>{0.386065692f, 0.259915769f},
-std::array<float,2>{0.889133275f, 0.943955839f},
-std::array<float,2>{0.598380506f, 0.226252109f},
-std::array<float,2>{0.000147341008f, 0.562288463f},
-std::array<float,2>{0.216186777f, 0.0788626224f},
-std::array<float,2>{0.745931983f, 0.697798848f},
-std::array<float,2>{0.786929309f, 0.432547301f},
-std::array<float,2>{0.339043796f, 0.814975917f},
-std::array<float,2>{0.249705479f, 0.415216148f},
-std::array<float,2>{0.695786417f, 0.84113425f},
-std::array<float,2>{0.776206136f, 0.0626658574f},
-std::array<float,2>{0.359906167f, 0.706982434f},
-std::array<float,2>{0.422482014f, 0.238864228f},
-std::array<float,2>{0.910702705f, 0.540412366f},
-std::array<float,2>{0.580077767f, 0.278688401f},
-std::array<float,2>{0.0364123732f, 0.958422303f},
-std::array<float,2>{0.305812389f, 0.360250622f},
-std::array<float,2>{0.842263341f, 0.917247593f},
-std::array<float,2>{0.68208164f, 0.181142911f},
-std::array<float,2>{0.173308149f, 0.603531718f},
-std::array<float,2>{0.117517024f, 0.0441227481f},
-std::array<float,2>{0.525967956f, 0.643552542f},
-std::array<float,2>{0.966627657f, 0.470332056f},
-std::array<float,2>{0.471951634f, 0.765853763f},
-std::array<float,2>{0.0259105377f, 0.281939864f},
-std::array<float,2>{0.623944461f, 0.995485783f},
-std::array<float,2>{0.890854657f, 0.202247858f},
-std::array<float,2>{0.399605423f, 0.520651817f},
-std::array<float,2>{0.326803118f, 0.116781689f},
-std::array<float,2>{0.800606668f, 0.741068661f},
-std::array<float,2>{0.731212556f, 0.397960037f},
-std::array<float,2>{0.20298259f, 0.870772004f},
-std::array<float,2>{0.454469174f, 0.464104116f},
-std::array<float,2>{0.989823222f, 0.807054222f},
-std::array<float,2>{0.551853657f, 0.0226707403f},
-std::array<float,2>{0.0723246932f, 0.677216947f},
-std::array<float,2>{0.141383946f, 0.138951123f},
-std::array<float,2>{0.633183241f, 0.56926024f},
-std::array<float,2>{0.843846202f, 0.342339694f},
-std::array<float,2>{0.254470676f, 0.904707849f},
-std::array<float,2>{0.14634946f, 0.251181662f},
-std::array<float,2>{0.640296459f, 0.950254679f},
-std::array<float,2>{0.847808361f, 0.234325513f},
-std::array<float,2>{0.251754016f, 0.547703326f},
-std::array<float,2>{0.458172321f, 0.092668131f},
-std::array<float,2>{0.986580551f, 0.692640841f},
-std::array<float,2>{0.547819138f, 0.429610968f},
-std::array<float,2>{0.0777830929f, 0.825680971f},
-std::array<float,2>{0.323190331f, 0.489580244f},
-std::array<float,2>{0.803623378f, 0.761435568f},
-std::array<float,2>{0.726930141f, 0.059530396f},
-std::array<float,2>{0.196438313f, 0.637896657f},
-std::array<float,2>{0.0274168961f, 0.169217393f},
-std::array<float,2>{0.618549705f, 0.611239374f},
-std::array<float,2>{0.896365762f, 0.345158637f},
-std::array<float,2>{0.405357569f, 0.925329149f},
-std::array<float,2>{0.123547576f, 0.37552309f},
-std::array<float,2>{0.528697968f, 0.851856351f},
-std::array<float,2>{0.962469637f, 0.104027726f},
-std::array<float,2>{0.473352879f, 0.73163718f},
-std::array<float,2>{0.309298307f, 0.212205663f},
-std::array<float,2>{0.836460292f, 0.500908554f},
-std::array<float,2>{0.68377316f, 0.305337876f},
-std::array<float,2>{0.178601921f, 0.984105527f},
-std::array<float,2>{0.428985655f, 0.326681674f},
-std::array<float,2>{0.908669412f, 0.877900958f},
-std::array<float,2>{0.58378619f, 0.145704016f},
-std::array<float,2>{0.0335276946f, 0.587393701f},
-std::array<float,2>{0.243389964f, 0.00500621879f},
-std::array<float,2>{0.699863911f, 0.664136589f},
-std::array<float,2>{0.780762732f, 0.441691816f},
-std::array<float,2>{0.366076827f, 0.795645654f},
-std::array<float,2>{0.210940599f, 0.45767796f},
-std::array<float,2>{0.747696221f, 0.798357785f},
-std::array<float,2>{0.783932567f, 0.0254703034f},
-std::array<float,2>{0.341936946f, 0.686898291f},
-std::array<float,2>{0.387384325f, 0.130181044f},
-std::array<float,2>{0.886516452f, 0.574695647f},
-std::array<float,2>{0.594326854f, 0.332013875f},
-std::array<float,2>{0.00708461786f, 0.895278573f},
-std::array<float,2>{0.268040776f, 0.29323718f},
-std::array<float,2>{0.865632772f, 0.988253355f},
-std::array<float,2>{0.64158994f, 0.191278204f},
-std::array<float,2>{0.128686488f, 0.524870455f},
-std::array<float,2>{0.0828827322f, 0.1204255f},
-std::array<float,2>{0.534786463f, 0.748516262f},
-std::array<float,2>{0.97942853f, 0.399078071f},
-std::array<float,2>{0.440542907f, 0.862209141f},
-std::array<float,2>{0.0580595024f, 0.368959278f},
-std::array<float,2>{0.568582237f, 0.91324687f},
-std::array<float,2>{0.936911047f, 0.176919565f},
-std::array<float,2>{0.407176465f, 0.601155519f},
-std::array<float,2>{0.344736814f, 0.0388875343f},
-std::array<float,2>{0.758671343f, 0.655292451f},
-std::array<float,2>{0.708140075f, 0.478161514f},
-std::array<float,2>{0.231691495f, 0.777908206f},
-std::array<float,2>{0.490259141f, 0.409973502f},
-std::array<float,2>{0.945045292f, 0.832185149f},
-std::array<float,2>{0.504007101f, 0.073878549f},
-std::array<float,2>{0.0971210077f, 0.718402207f},
-std::array<float,2>{0.170223534f, 0.244013354f},
-std::array<float,2>{0.662678242f, 0.53462863f},
-std::array<float,2>{0.813315928f, 0.271806926f},
-std::array<float,2>{0.294197738f, 0.964375496f},
-std::array<float,2>{0.225354642f, 0.338620484f},
-std::array<float,2>{0.714866161f, 0.899357498f},
-std::array<float,2>{0.751711786f, 0.136686504f},
-std::array<float,2>{0.354429215f, 0.564845741f},
-std::array<float,2>{0.415410429f, 0.01671708f},
-std::array<float,2>{0.923841119f, 0.672362506f},
-std::array<float,2>{0.574888051f, 0.466258466f},
-std::array<float,2>{0.0486719124f, 0.808861911f},
-std::array<float,2>{0.282751203f, 0.392976373f},
-std::array<float,2>{0.820654571f, 0.873244703f},
-std::array<float,2>{0.665592372f, 0.11143256f},
-std::array<float,2>{0.162532285f, 0.734542608f},
-std::array<float,2>{0.102719657f, 0.198709533f},
-std::array<float,2>{0.512141943f, 0.518745005f},
-std::array<float,2>{0.952821612f, 0.28770861f},
-std::array<float,2>{0.495470256f, 0.997234106f},
-std::array<float,2>{0.0116842743f, 0.475942522f},
-std::array<float,2>{0.60419786f, 0.771095693f},
-std::array<float,2>{0.875112593f, 0.0409682058f},
-std::array<float,2>{0.380642444f, 0.646215558f},
-std::array<float,2>{0.335474879f, 0.184929013f},
-std::array<float,2>{0.791471124f, 0.606062114f},
-std::array<float,2>{0.739475131f, 0.365486532f},
-std::array<float,2>{0.209096f, 0.919511676f},
-std::array<float,2>{0.44925642f, 0.274544507f},
-std::array<float,2>{0.968842447f, 0.954522192f},
-std::array<float,2>{0.540471256f, 0.2352456f},
-std::array<float,2>{0.087423481f, 0.543875992f},
-std::array<float,2>{0.135060489f, 0.0686138123f},
-std::array<float,2>{0.650996983f, 0.708839178f},
-std::array<float,2>{0.873729229f, 0.421431214f},
-std::array<float,2>{0.279090047f, 0.838151932f},
-std::array<float,2>{0.185612023f, 0.436178416f},
-std::array<float,2>{0.677734077f, 0.816966891f},
-std::array<float,2>{0.835083783f, 0.0840074718f},
-std::array<float,2>{0.301969498f, 0.702584505f},
-std::array<float,2>{0.478018254f, 0.220634744f},
-std::array<float,2>{0.955729425f, 0.556543887f},
-std::array<float,2>{0.516863108f, 0.264108896f},
-std::array<float,2>{0.113510467f, 0.937847316f},
-std::array<float,2>{0.372875392f, 0.35273543f},
-std::array<float,2>{0.773395896f, 0.930650413f},
-std::array<float,2>{0.690875113f, 0.156748816f},
-std::array<float,2>{0.240290135f, 0.620538831f},
-std::array<float,2>{0.0427934229f, 0.0525963381f},
-std::array<float,2>{0.593034506f, 0.629184663f},
-std::array<float,2>{0.917335093f, 0.496922374f},
-std::array<float,2>{0.430075407f, 0.751958728f},
-std::array<float,2>{0.0666542277f, 0.301662683f},
-std::array<float,2>{0.555319071f, 0.969366491f},
-std::array<float,2>{0.992333114f, 0.206724405f},
-std::array<float,2>{0.46872896f, 0.509839714f},
-std::array<float,2>{0.264959514f, 0.10104841f},
-std::array<float,2>{0.859265745f, 0.720358133f},
-std::array<float,2>{0.631820798f, 0.385495007f},
-std::array<float,2>{0.153403386f, 0.848715007f},
-std::array<float,2>{0.393615246f, 0.448284954f},
-std::array<float,2>{0.899482429f, 0.784906805f},
-std::array<float,2>{0.61663419f, 0.00873002224f},
-std::array<float,2>{0.0163837224f, 0.657895148f},
-std::array<float,2>{0.190723687f, 0.15242295f},
-std::array<float,2>{0.72196728f, 0.584523857f},
-std::array<float,2>{0.809469461f, 0.319034457f},
-std::array<float,2>{0.313530356f, 0.884135962f},
-std::array<float,2>{0.202344269f, 0.283685267f},
-std::array<float,2>{0.730812252f, 0.993900061f},
-std::array<float,2>{0.800174057f, 0.199909151f},
-std::array<float,2>{0.32618922f, 0.523131609f},
-std::array<float,2>{0.400192589f, 0.115152806f},
-std::array<float,2>{0.8915869f, 0.739680946f},
-std::array<float,2>{0.623093545f, 0.396456301f},
-std::array<float,2>{0.0257270932f, 0.868183434f},
-std::array<float,2>{0.254021794f, 0.461806774f},
-std::array<float,2>{0.844243109f, 0.805636346f},
-std::array<float,2>{0.63332665f, 0.0202815309f},
-std::array<float,2>{0.140819177f, 0.678896904f},
-std::array<float,2>{0.0727555826f, 0.138656452f},
-std::array<float,2>{0.552654028f, 0.567919254f},
-std::array<float,2>{0.989640534f, 0.34072876f},
-std::array<float,2>{0.454980671f, 0.903003991f},
-std::array<float,2>{0.0370356776f, 0.417962551f},
-std::array<float,2>{0.579305828f, 0.842376769f},
-std::array<float,2>{0.910429657f, 0.0656061247f},
-std::array<float,2>{0.422276467f, 0.703727365f},
-std::array<float,2>{0.359538496f, 0.241167665f},
-std::array<float,2>{0.775763154f, 0.541021883f},
-std::array<float,2>{0.695939302f, 0.280272543f},
-std::array<float,2>{0.249304682f, 0.959109604f},
-std::array<float,2>{0.472241253f, 0.361984223f},
-std::array<float,2>{0.965889573f, 0.915666282f},
-std::array<float,2>{0.525513172f, 0.18299228f},
-std::array<float,2>{0.118067324f, 0.602994621f},
-std::array<float,2>{0.173355699f, 0.0457777455f},
-std::array<float,2>{0.682479203f, 0.642282963f},
-std::array<float,2>{0.84275794f, 0.471141726f},
-std::array<float,2>{0.306502879f, 0.768602788f},
-std::array<float,2>{0.131388679f, 0.495065242f},
-std::array<float,2>{0.646140337f, 0.753985465f},
-std::array<float,2>{0.862468541f, 0.0506334752f},
-std::array<float,2>{0.270876229f, 0.627107382f},
-std::array<float,2>{0.442139387f, 0.162726834f},
-std::array<float,2>{0.984019995f, 0.623542488f},
-std::array<float,2>{0.53805089f, 0.356213778f},
-std::array<float,2>{0.0789956525f, 0.934686303f},
-std::array<float,2>{0.339610159f, 0.259631127f},
-std::array<float,2>{0.786508799f, 0.941865146f},
-std::array<float,2>{0.745582223f, 0.224501058f},
-std::array<float,2>{0.216514081f, 0.559094787f},
-std::array<float,2>{0.000743886572f, 0.0820098594f},
-std::array<float,2>{0.597733736f, 0.696529746f},
-std::array<float,2>{0.889455914f, 0.430853665f},
-std::array<float,2>{0.386443317f, 0.814095855f},
-std::array<float,2>{0.0985897183f, 0.315935194f},
-std::array<float,2>{0.501496911f, 0.888999462f},
-std::array<float,2>{0.94051218f, 0.15131256f},
-std::array<float,2>{0.486939579f, 0.580366373f},
-std::array<float,2>{0.291526258f, 0.0151081886f},
-std::array<float,2>{0.820069849f, 0.662962615f},
-std::array<float,2>{0.658961356f, 0.449416965f},
-std::array<float,2>{0.167880937f, 0.788708687f},
-std::array<float,2>{0.412171274f, 0.387977391f},
-std::array<float,2>{0.931681812f, 0.843935966f},
-std::array<float,2>{0.564532042f, 0.0948704034f},
-std::array<float,2>{0.0597495884f, 0.72308284f},
-std::array<float,2>{0.227972507f, 0.208930343f},
-std::array<float,2>{0.705000162f, 0.512582004f},
-std::array<float,2>{0.763547182f, 0.296983361f},
-std::array<float,2>{0.351482838f, 0.973864555f},
-std::array<float,2>{0.159701794f, 0.349006087f},
-std::array<float,2>{0.669080257f, 0.929103434f},
-std::array<float,2>{0.828070641f, 0.165768221f},
-std::array<float,2>{0.285844445f, 0.616165817f},
-std::array<float,2>{0.498595566f, 0.0547030605f},
-std::array<float,2>{0.945993185f, 0.633580565f},
-std::array<float,2>{0.510437846f, 0.48592183f},
-std::array<float,2>{0.106673859f, 0.765302062f},
-std::array<float,2>{0.35823074f, 0.422014266f},
-std::array<float,2>{0.755079806f, 0.822971344f},
-std::array<float,2>{0.713997364f, 0.0880627632f},
-std::array<float,2>{0.22028783f, 0.689411521f},
-std::array<float,2>{0.0540531985f, 0.226667345f},
-std::array<float,2>{0.571801126f, 0.553728044f},
-std::array<float,2>{0.926764667f, 0.257564843f},
-std::array<float,2>{0.421644747f, 0.949085712f},
-std::array<float,2>{0.090981625f, 0.441246182f},
-std::array<float,2>{0.543414652f, 0.791400731f},
-std::array<float,2>{0.976166725f, 0.0019014508f},
-std::array<float,2>{0.445954382f, 0.6703251f},
-std::array<float,2>{0.276668459f, 0.14436245f},
-std::array<float,2>{0.867697299f, 0.59069562f},
-std::array<float,2>{0.654920161f, 0.320770204f},
-std::array<float,2>{0.139280245f, 0.882388115f},
-std::array<float,2>{0.375735939f, 0.312117696f},
-std::array<float,2>{0.882744193f, 0.979847193f},
-std::array<float,2>{0.608144581f, 0.217664197f},
-std::array<float,2>{0.0127852019f, 0.50775665f},
-std::array<float,2>{0.203785568f, 0.106524676f},
-std::array<float,2>{0.736511827f, 0.729909897f},
-std::array<float,2>{0.796028495f, 0.378915876f},
-std::array<float,2>{0.329417467f, 0.855774641f},
-std::array<float,2>{0.236697361f, 0.405967653f},
-std::array<float,2>{0.692372501f, 0.866806865f},
-std::array<float,2>{0.765758216f, 0.123098567f},
-std::array<float,2>{0.368047088f, 0.742974579f},
-std::array<float,2>{0.435733795f, 0.193796143f},
-std::array<float,2>{0.921759784f, 0.52830869f},
-std::array<float,2>{0.588426173f, 0.290160537f},
-std::array<float,2>{0.046600949f, 0.988338411f},
-std::array<float,2>{0.298893869f, 0.333685577f},
-std::array<float,2>{0.828989983f, 0.893879294f},
-std::array<float,2>{0.674128473f, 0.127641574f},
-std::array<float,2>{0.182878822f, 0.570970953f},
-std::array<float,2>{0.109509379f, 0.0280663092f},
-std::array<float,2>{0.522075057f, 0.680195808f},
-std::array<float,2>{0.957254171f, 0.454623908f},
-std::array<float,2>{0.48220557f, 0.80194068f},
-std::array<float,2>{0.0203620624f, 0.26865828f},
-std::array<float,2>{0.6105299f, 0.966874599f},
-std::array<float,2>{0.904405773f, 0.247029781f},
-std::array<float,2>{0.395768911f, 0.537587821f},
-std::array<float,2>{0.316778451f, 0.0778644904f},
-std::array<float,2>{0.808550417f, 0.711377084f},
-std::array<float,2>{0.724545658f, 0.410726428f},
-std::array<float,2>{0.194359228f, 0.83175981f},
-std::array<float,2>{0.464824766f, 0.481066406f},
-std::array<float,2>{0.999517858f, 0.776214063f},
-std::array<float,2>{0.561164379f, 0.031984508f},
-std::array<float,2>{0.0641690344f, 0.651964962f},
-std::array<float,2>{0.152092248f, 0.172068879f},
-std::array<float,2>{0.628884375f, 0.593903363f},
-std::array<float,2>{0.854514778f, 0.373439193f},
-std::array<float,2>{0.261274993f, 0.908445716f},
-std::array<float,2>{0.176277071f, 0.307228059f},
-std::array<float,2>{0.687017918f, 0.98239553f},
-std::array<float,2>{0.837916493f, 0.213166386f},
-std::array<float,2>{0.311136097f, 0.503475666f},
-std::array<float,2>{0.475675792f, 0.102812409f},
-std::array<float,2>{0.963555872f, 0.73267287f},
-std::array<float,2>{0.531199753f, 0.378797501f},
-std::array<float,2>{0.12182378f, 0.854739249f},
-std::array<float,2>{0.363935858f, 0.445014954f},
-std::array<float,2>{0.778781533f, 0.794730842f},
-std::array<float,2>{0.702757895f, 0.00757232262f},
-std::array<float,2>{0.246054158f, 0.666990221f},
-std::array<float,2>{0.0314851329f, 0.146912277f},
-std::array<float,2>{0.58569032f, 0.588541448f},
-std::array<float,2>{0.906273723f, 0.324630708f},
-std::array<float,2>{0.425864249f, 0.875394702f},
-std::array<float,2>{0.0750612542f, 0.427713692f},
-std::array<float,2>{0.549561441f, 0.827819645f},
-std::array<float,2>{0.985504985f, 0.0901822671f},
-std::array<float,2>{0.45960176f, 0.694072723f},
-std::array<float,2>{0.252373904f, 0.230689347f},
-std::array<float,2>{0.850759029f, 0.550207376f},
-std::array<float,2>{0.637034059f, 0.253349155f},
-std::array<float,2>{0.147803843f, 0.952530026f},
-std::array<float,2>{0.403559655f, 0.346670449f},
-std::array<float,2>{0.898274124f, 0.923273027f},
-std::array<float,2>{0.619383216f, 0.169971809f},
-std::array<float,2>{0.0302941743f, 0.612360239f},
-std::array<float,2>{0.197809458f, 0.0615826845f},
-std::array<float,2>{0.730029523f, 0.64003557f},
-std::array<float,2>{0.802042544f, 0.491409808f},
-std::array<float,2>{0.320581019f, 0.758289814f},
-std::array<float,2>{0.232451797f, 0.47875759f},
-std::array<float,2>{0.709397495f, 0.780178964f},
-std::array<float,2>{0.76147455f, 0.0353052989f},
-std::array<float,2>{0.345999569f, 0.654162943f},
-std::array<float,2>{0.410049587f, 0.178178489f},
-std::array<float,2>{0.934029222f, 0.597821832f},
-std::array<float,2>{0.56798774f, 0.370377153f},
-std::array<float,2>{0.0565621853f, 0.911915421f},
-std::array<float,2>{0.29587096f, 0.269913077f},
-std::array<float,2>{0.814733744f, 0.960989356f},
-std::array<float,2>{0.661577284f, 0.244942382f},
-std::array<float,2>{0.169003785f, 0.531718314f},
-std::array<float,2>{0.0954520181f, 0.0713264346f},
-std::array<float,2>{0.507602513f, 0.71567893f},
-std::array<float,2>{0.942007959f, 0.407590508f},
-std::array<float,2>{0.488812774f, 0.835524023f},
-std::array<float,2>{0.00403185142f, 0.329039276f},
-std::array<float,2>{0.597156405f, 0.897659957f},
-std::array<float,2>{0.884458899f, 0.132262453f},
-std::array<float,2>{0.389465719f, 0.576452255f},
-std::array<float,2>{0.3415851f, 0.0242700893f},
-std::array<float,2>{0.781598091f, 0.684984624f},
-std::array<float,2>{0.748118043f, 0.460933059f},
-std::array<float,2>{0.213653505f, 0.799402535f},
-std::array<float,2>{0.43868193f, 0.400426358f},
-std::array<float,2>{0.978217602f, 0.860503137f},
-std::array<float,2>{0.532144427f, 0.118884169f},
-std::array<float,2>{0.0840145573f, 0.746362567f},
-std::array<float,2>{0.126732439f, 0.187722594f},
-std::array<float,2>{0.644418955f, 0.526356757f},
-std::array<float,2>{0.864323616f, 0.295820773f},
-std::array<float,2>{0.265723884f, 0.986172557f},
-std::array<float,2>{0.208759323f, 0.363798827f},
-std::array<float,2>{0.740403473f, 0.920338035f},
-std::array<float,2>{0.789369464f, 0.186987773f},
-std::array<float,2>{0.333752632f, 0.609319687f},
-std::array<float,2>{0.381316692f, 0.0417824946f},
-std::array<float,2>{0.878512025f, 0.646612048f},
-std::array<float,2>{0.602781475f, 0.473533005f},
-std::array<float,2>{0.0092662992f, 0.772431493f},
-std::array<float,2>{0.280765533f, 0.419208318f},
-std::array<float,2>{0.871687651f, 0.836357355f},
-std::array<float,2>{0.649294376f, 0.0669091791f},
-std::array<float,2>{0.134634092f, 0.70954299f},
-std::array<float,2>{0.0883649215f, 0.237369522f},
-std::array<float,2>{0.541042209f, 0.546720445f},
-std::array<float,2>{0.971276045f, 0.275542349f},
-std::array<float,2>{0.452196538f, 0.956020355f},
-std::array<float,2>{0.0488988943f, 0.467838436f},
-std::array<float,2>{0.576321721f, 0.8124578f},
-std::array<float,2>{0.923826814f, 0.0187165551f},
-std::array<float,2>{0.41755417f, 0.675341606f},
-std::array<float,2>{0.35204947f, 0.13398841f},
-std::array<float,2>{0.752598226f, 0.562812686f},
-std::array<float,2>{0.718347967f, 0.337882698f},
-std::array<float,2>{0.223964512f, 0.90071249f},
-std::array<float,2>{0.493584901f, 0.286173224f},
-std::array<float,2>{0.951168954f, 0.999853849f},
-std::array<float,2>{0.51452446f, 0.196848944f},
-std::array<float,2>{0.103520632f, 0.515830815f},
-std::array<float,2>{0.161204025f, 0.109940536f},
-std::array<float,2>{0.666287303f, 0.736565948f},
-std::array<float,2>{0.822296798f, 0.391128749f},
-std::array<float,2>{0.284170806f, 0.87222755f},
-std::array<float,2>{0.154581398f, 0.383061558f},
-std::array<float,2>{0.630716503f, 0.851168752f},
-std::array<float,2>{0.855907619f, 0.0991048664f},
-std::array<float,2>{0.262879401f, 0.722557366f},
-std::array<float,2>{0.465257406f, 0.204144001f},
-std::array<float,2>{0.994763017f, 0.509212613f},
-std::array<float,2>{0.557979107f, 0.303462952f},
-std::array<float,2>{0.0697503909f, 0.972615004f},
-std::array<float,2>{0.315894216f, 0.317947239f},
-std::array<float,2>{0.811818838f, 0.885247171f},
-std::array<float,2>{0.718952656f, 0.156066254f},
-std::array<float,2>{0.187672704f, 0.582524419f},
-std::array<float,2>{0.0190423634f, 0.0103697097f},
-std::array<float,2>{0.613916814f, 0.659546494f},
-std::array<float,2>{0.901390254f, 0.447002918f},
-std::array<float,2>{0.390699983f, 0.782211781f},
-std::array<float,2>{0.11677321f, 0.261799753f},
-std::array<float,2>{0.518147409f, 0.940159142f},
-std::array<float,2>{0.954556882f, 0.221143201f},
-std::array<float,2>{0.479636341f, 0.557244539f},
-std::array<float,2>{0.304365695f, 0.0832670704f},
-std::array<float,2>{0.833056748f, 0.699311674f},
-std::array<float,2>{0.679616094f, 0.435500383f},
-std::array<float,2>{0.184365675f, 0.818568945f},
-std::array<float,2>{0.433392078f, 0.499200732f},
-std::array<float,2>{0.914085388f, 0.75007695f},
-std::array<float,2>{0.590866446f, 0.053088937f},
-std::array<float,2>{0.0404351577f, 0.631786823f},
-std::array<float,2>{0.239113465f, 0.158851519f},
-std::array<float,2>{0.688456297f, 0.618889034f},
-std::array<float,2>{0.770865858f, 0.353678584f},
-std::array<float,2>{0.374516457f, 0.931647778f},
-std::array<float,2>{0.247045949f, 0.278893948f},
-std::array<float,2>{0.697465122f, 0.958534122f},
-std::array<float,2>{0.773710072f, 0.238495141f},
-std::array<float,2>{0.361856014f, 0.540587246f},
-std::array<float,2>{0.425336629f, 0.063373588f},
-std::array<float,2>{0.913106978f, 0.706073165f},
-std::array<float,2>{0.581262469f, 0.415589184f},
-std::array<float,2>{0.0382945649f, 0.841560185f},
-std::array<float,2>{0.307283849f, 0.470193803f},
-std::array<float,2>{0.840078592f, 0.766447484f},
-std::array<float,2>{0.68081063f, 0.0449159555f},
-std::array<float,2>{0.175675794f, 0.642734706f},
-std::array<float,2>{0.119675465f, 0.181506097f},
-std::array<float,2>{0.524763227f, 0.604460597f},
-std::array<float,2>{0.967686534f, 0.359395385f},
-std::array<float,2>{0.470262647f, 0.917501271f},
-std::array<float,2>{0.0235368498f, 0.397510707f},
-std::array<float,2>{0.621315956f, 0.870417595f},
-std::array<float,2>{0.89439702f, 0.116525173f},
-std::array<float,2>{0.402128518f, 0.740672112f},
-std::array<float,2>{0.324525386f, 0.203031257f},
-std::array<float,2>{0.798772931f, 0.521087348f},
-std::array<float,2>{0.733461738f, 0.281307042f},
-std::array<float,2>{0.200594723f, 0.995778143f},
-std::array<float,2>{0.455597669f, 0.341803044f},
-std::array<float,2>{0.99170965f, 0.905153513f},
-std::array<float,2>{0.553885281f, 0.139568955f},
-std::array<float,2>{0.0721731633f, 0.568811059f},
-std::array<float,2>{0.143096104f, 0.0232125465f},
-std::array<float,2>{0.636695147f, 0.677356303f},
-std::array<float,2>{0.846823752f, 0.464366406f},
-std::array<float,2>{0.257283121f, 0.807590365f},
-std::array<float,2>{0.165633217f, 0.452180475f},
-std::array<float,2>{0.657466531f, 0.786060512f},
-std::array<float,2>{0.816574872f, 0.0134025849f},
-std::array<float,2>{0.289235771f, 0.660579085f},
-std::array<float,2>{0.485841066f, 0.14927581f},
-std::array<float,2>{0.938886642f, 0.579364657f},
-std::array<float,2>{0.503441513f, 0.312996686f},
-std::array<float,2>{0.10110002f, 0.887198567f},
-std::array<float,2>{0.34945628f, 0.299334377f},
-std::array<float,2>{0.764024258f, 0.975292385f},
-std::array<float,2>{0.705342054f, 0.210758939f},
-std::array<float,2>{0.230288431f, 0.51557374f},
-std::array<float,2>{0.061865747f, 0.0974170044f},
-std::array<float,2>{0.563106239f, 0.725372255f},
-std::array<float,2>{0.930651009f, 0.389527321f},
-std::array<float,2>{0.410329551f, 0.84758532f},
-std::array<float,2>{0.0804927275f, 0.357552201f},
-std::array<float,2>{0.536371768f, 0.936432421f},
-std::array<float,2>{0.982239068f, 0.161481589f},
-std::array<float,2>{0.445019007f, 0.621276736f},
-std::array<float,2>{0.272515684f, 0.0482999645f},
-std::array<float,2>{0.859784603f, 0.626654327f},
-std::array<float,2>{0.64818269f, 0.494015902f},
-std::array<float,2>{0.129281536f, 0.757444739f},
-std::array<float,2>{0.383171886f, 0.4321253f},
-std::array<float,2>{0.886904657f, 0.814911485f},
-std::array<float,2>{0.60029912f, 0.0785565525f},
-std::array<float,2>{0.00226472667f, 0.69772917f},
-std::array<float,2>{0.217623234f, 0.22569263f},
-std::array<float,2>{0.742226243f, 0.56167835f},
-std::array<float,2>{0.787538409f, 0.260270864f},
-std::array<float,2>{0.33700189f, 0.943830669f},
-std::array<float,2>{0.137611255f, 0.323025733f},
-std::array<float,2>{0.653202832f, 0.880255997f},
-std::array<float,2>{0.869834244f, 0.14249301f},
-std::array<float,2>{0.27513811f, 0.593240261f},
-std::array<float,2>{0.448364675f, 0.00333411386f},
-std::array<float,2>{0.972769976f, 0.668002248f},
-std::array<float,2>{0.546579897f, 0.438440353f},
-std::array<float,2>{0.0932349861f, 0.790222108f},
-std::array<float,2>{0.331422776f, 0.382409036f},
-std::array<float,2>{0.793510795f, 0.857863069f},
-std::array<float,2>{0.735075951f, 0.108153746f},
-std::array<float,2>{0.207020059f, 0.728364825f},
-std::array<float,2>{0.0155273126f, 0.216101885f},
-std::array<float,2>{0.606820703f, 0.50405091f},
-std::array<float,2>{0.87911135f, 0.30941391f},
-std::array<float,2>{0.377502054f, 0.976939738f},
-std::array<float,2>{0.10863705f, 0.487228721f},
-std::array<float,2>{0.50953263f, 0.763581216f},
-std::array<float,2>{0.949116051f, 0.0572026558f},
-std::array<float,2>{0.49686107f, 0.635964155f},
-std::array<float,2>{0.288587809f, 0.167743549f},
-std::array<float,2>{0.825913787f, 0.614637852f},
-std::array<float,2>{0.670292795f, 0.349817902f},
-std::array<float,2>{0.157660946f, 0.926653862f},
-std::array<float,2>{0.418779522f, 0.254215032f},
-std::array<float,2>{0.928771138f, 0.945548058f},
-std::array<float,2>{0.573215306f, 0.229750618f},
-std::array<float,2>{0.0524557419f, 0.550927222f},
-std::array<float,2>{0.221732304f, 0.0864055827f},
-std::array<float,2>{0.711364865f, 0.690503061f},
-std::array<float,2>{0.757724404f, 0.42443651f},
-std::array<float,2>{0.355706751f, 0.821919382f},
-std::array<float,2>{0.19239068f, 0.413051248f},
-std::array<float,2>{0.726117253f, 0.828841269f},
-std::array<float,2>{0.80496484f, 0.0743308738f},
-std::array<float,2>{0.318807393f, 0.714329898f},
-std::array<float,2>{0.398118228f, 0.248496994f},
-std::array<float,2>{0.902959049f, 0.536671519f},
-std::array<float,2>{0.613273323f, 0.26578185f},
-std::array<float,2>{0.0218354277f, 0.966083169f},
-std::array<float,2>{0.258897096f, 0.3711918f},
-std::array<float,2>{0.852199733f, 0.907366216f},
-std::array<float,2>{0.62577194f, 0.175225556f},
-std::array<float,2>{0.149180993f, 0.596022666f},
-std::array<float,2>{0.0661239997f, 0.0332264416f},
-std::array<float,2>{0.560364068f, 0.649189472f},
-std::array<float,2>{0.996116936f, 0.483140379f},
-std::array<float,2>{0.462216467f, 0.774797857f},
-std::array<float,2>{0.0443346351f, 0.291989416f},
-std::array<float,2>{0.586492479f, 0.992030025f},
-std::array<float,2>{0.918682814f, 0.192632288f},
-std::array<float,2>{0.435076624f, 0.530174077f},
-std::array<float,2>{0.36978054f, 0.121667139f},
-std::array<float,2>{0.769039452f, 0.745322764f},
-std::array<float,2>{0.693672538f, 0.402755082f},
-std::array<float,2>{0.236027479f, 0.863942325f},
-std::array<float,2>{0.48374486f, 0.456586778f},
-std::array<float,2>{0.960163236f, 0.804398596f},
-std::array<float,2>{0.520796835f, 0.029705869f},
-std::array<float,2>{0.112647988f, 0.683083177f},
-std::array<float,2>{0.181230292f, 0.125729874f},
-std::array<float,2>{0.671981096f, 0.574081779f},
-std::array<float,2>{0.83015275f, 0.334463269f},
-std::array<float,2>{0.296964943f, 0.89209199f},
-std::array<float,2>{0.168785602f, 0.272762239f},
-std::array<float,2>{0.660509467f, 0.962905765f},
-std::array<float,2>{0.815977991f, 0.242793262f},
-std::array<float,2>{0.295908064f, 0.533391893f},
-std::array<float,2>{0.489473969f, 0.0728144646f},
-std::array<float,2>{0.942836285f, 0.717285752f},
-std::array<float,2>{0.50613153f, 0.409132987f},
-std::array<float,2>{0.0942767486f, 0.833102047f},
-std::array<float,2>{0.347279012f, 0.476894289f},
-std::array<float,2>{0.759919584f, 0.778363168f},
-std::array<float,2>{0.71013242f, 0.0377667733f},
-std::array<float,2>{0.23401545f, 0.655080616f},
-std::array<float,2>{0.0552575514f, 0.175813898f},
-std::array<float,2>{0.566429853f, 0.599667549f},
-std::array<float,2>{0.934737861f, 0.367256343f},
-std::array<float,2>{0.408931434f, 0.912112892f},
-std::array<float,2>{0.0852278993f, 0.400160789f},
-std::array<float,2>{0.53264004f, 0.862632096f},
-std::array<float,2>{0.97683233f, 0.11957188f},
-std::array<float,2>{0.437949121f, 0.749434233f},
-std::array<float,2>{0.267518431f, 0.189743549f},
-std::array<float,2>{0.863906682f, 0.524327755f},
-std::array<float,2>{0.642783284f, 0.29419443f},
-std::array<float,2>{0.12518996f, 0.986545503f},
-std::array<float,2>{0.390594274f, 0.330602109f},
-std::array<float,2>{0.883623183f, 0.895792723f},
-std::array<float,2>{0.596040487f, 0.129272148f},
-std::array<float,2>{0.0055255238f, 0.575459182f},
-std::array<float,2>{0.214733839f, 0.0271991584f},
-std::array<float,2>{0.749087811f, 0.685630739f},
-std::array<float,2>{0.783086777f, 0.458620161f},
-std::array<float,2>{0.340567589f, 0.797495723f},
-std::array<float,2>{0.244890735f, 0.443307966f},
-std::array<float,2>{0.701322019f, 0.796389103f},
-std::array<float,2>{0.778309047f, 0.00428596558f},
-std::array<float,2>{0.365160793f, 0.665398896f},
-std::array<float,2>{0.426830411f, 0.145304307f},
-std::array<float,2>{0.90805459f, 0.586700201f},
-std::array<float,2>{0.584037244f, 0.327555716f},
-std::array<float,2>{0.0332018435f, 0.878503203f},
-std::array<float,2>{0.312404007f, 0.306390136f},
-std::array<float,2>{0.839705229f, 0.983254254f},
-std::array<float,2>{0.686444402f, 0.211524919f},
-std::array<float,2>{0.177423835f, 0.501536548f},
-std::array<float,2>{0.122175492f, 0.105084397f},
-std::array<float,2>{0.529761672f, 0.731027365f},
-std::array<float,2>{0.964713931f, 0.376477122f},
-std::array<float,2>{0.475004733f, 0.853011668f},
-std::array<float,2>{0.0301816836f, 0.344641268f},
-std::array<float,2>{0.621048868f, 0.924167991f},
-std::array<float,2>{0.896884382f, 0.168551922f},
-std::array<float,2>{0.403113633f, 0.609890044f},
-std::array<float,2>{0.3214508f, 0.0604445376f},
-std::array<float,2>{0.801620781f, 0.637543857f},
-std::array<float,2>{0.728869319f, 0.48881954f},
-std::array<float,2>{0.198330835f, 0.760727584f},
-std::array<float,2>{0.460087091f, 0.428149164f},
-std::array<float,2>{0.984455585f, 0.824239254f},
-std::array<float,2>{0.550479054f, 0.0936800838f},
-std::array<float,2>{0.0758434758f, 0.692112088f},
-std::array<float,2>{0.146654978f, 0.232909977f},
-std::array<float,2>{0.638432384f, 0.548522592f},
-std::array<float,2>{0.850343764f, 0.250796378f},
-std::array<float,2>{0.253023952f, 0.949302554f},
-std::array<float,2>{0.188605919f, 0.319549948f},
-std::array<float,2>{0.720342159f, 0.883211553f},
-std::array<float,2>{0.811117768f, 0.154194981f},
-std::array<float,2>{0.315150946f, 0.585060835f},
-std::array<float,2>{0.391762435f, 0.0089901872f},
-std::array<float,2>{0.900915146f, 0.656453848f},
-std::array<float,2>{0.614535749f, 0.448114038f},
-std::array<float,2>{0.0179389827f, 0.783309519f},
-std::array<float,2>{0.262364626f, 0.386053234f},
-std::array<float,2>{0.857170939f, 0.847889304f},
-std::array<float,2>{0.629538f, 0.100330606f},
-std::array<float,2>{0.155456901f, 0.719090462f},
-std::array<float,2>{0.0690349638f, 0.205744028f},
-std::array<float,2>{0.557299554f, 0.511607647f},
-std::array<float,2>{0.995423019f, 0.302693158f},
-std::array<float,2>{0.465872377f, 0.970488667f},
-std::array<float,2>{0.0396269448f, 0.497865468f},
-std::array<float,2>{0.590771675f, 0.753389895f},
-std::array<float,2>{0.915575624f, 0.0514034294f},
-std::array<float,2>{0.432402015f, 0.63073647f},
-std::array<float,2>{0.373503268f, 0.158026233f},
-std::array<float,2>{0.770219028f, 0.619264305f},
-std::array<float,2>{0.689035118f, 0.352346778f},
-std::array<float,2>{0.239987403f, 0.931444168f},
-std::array<float,2>{0.479046822f, 0.265465498f},
-std::array<float,2>{0.953621507f, 0.938506722f},
-std::array<float,2>{0.519506216f, 0.219341695f},
-std::array<float,2>{0.115520731f, 0.554978967f},
-std::array<float,2>{0.185256332f, 0.0858216211f},
-std::array<float,2>{0.67778331f, 0.701412737f},
-std::array<float,2>{0.832783699f, 0.437254429f},
-std::array<float,2>{0.303280234f, 0.817791641f},
-std::array<float,2>{0.133780867f, 0.420053005f},
-std::array<float,2>{0.650363088f, 0.839077652f},
-std::array<float,2>{0.872647822f, 0.0698981062f},
-std::array<float,2>{0.279740393f, 0.707374871f},
-std::array<float,2>{0.451295257f, 0.23544383f},
-std::array<float,2>{0.972379565f, 0.544788599f},
-std::array<float,2>{0.542549908f, 0.274133593f},
-std::array<float,2>{0.0893930271f, 0.953365982f},
-std::array<float,2>{0.332816809f, 0.366255909f},
-std::array<float,2>{0.790815115f, 0.918833494f},
-std::array<float,2>{0.741465271f, 0.18455641f},
-std::array<float,2>{0.207076758f, 0.606541932f},
-std::array<float,2>{0.00875088573f, 0.039764747f},
-std::array<float,2>{0.602472067f, 0.645274162f},
-std::array<float,2>{0.877763033f, 0.475379825f},
-std::array<float,2>{0.382438272f, 0.769946575f},
-std::array<float,2>{0.104699053f, 0.288696349f},
-std::array<float,2>{0.515135288f, 0.996559501f},
-std::array<float,2>{0.949297845f, 0.197514817f},
-std::array<float,2>{0.492755681f, 0.517688036f},
-std::array<float,2>{0.284609914f, 0.113187954f},
-std::array<float,2>{0.823732376f, 0.735540032f},
-std::array<float,2>{0.667615652f, 0.394528508f},
-std::array<float,2>{0.160578713f, 0.87462616f},
-std::array<float,2>{0.41674155f, 0.465387315f},
-std::array<float,2>{0.92284286f, 0.809971511f},
-std::array<float,2>{0.577232122f, 0.0163924396f},
-std::array<float,2>{0.0507219359f, 0.67296505f},
-std::array<float,2>{0.222811952f, 0.135574877f},
-std::array<float,2>{0.717015445f, 0.565550208f},
-std::array<float,2>{0.753391743f, 0.339545935f},
-std::array<float,2>{0.353195518f, 0.899834335f},
-std::array<float,2>{0.22873944f, 0.298738897f},
-std::array<float,2>{0.707009196f, 0.972759783f},
-std::array<float,2>{0.765423715f, 0.207412392f},
-std::array<float,2>{0.347996026f, 0.513545215f},
-std::array<float,2>{0.411167294f, 0.0947046652f},
-std::array<float,2>{0.930840373f, 0.724175155f},
-std::array<float,2>{0.563584805f, 0.386784732f},
-std::array<float,2>{0.0611118078f, 0.845198572f},
-std::array<float,2>{0.290911824f, 0.450516224f},
-std::array<float,2>{0.818131387f, 0.787645876f},
-std::array<float,2>{0.656507552f, 0.014029f},
-std::array<float,2>{0.164609089f, 0.663392723f},
-std::array<float,2>{0.0998879597f, 0.151625395f},
-std::array<float,2>{0.50210166f, 0.581697464f},
-std::array<float,2>{0.938042879f, 0.31471011f},
-std::array<float,2>{0.484576285f, 0.889997959f},
-std::array<float,2>{0.00349531393f, 0.430297256f},
-std::array<float,2>{0.601457238f, 0.812588692f},
-std::array<float,2>{0.888146877f, 0.0809276029f},
-std::array<float,2>{0.384576768f, 0.695771515f},
-std::array<float,2>{0.336697042f, 0.223114938f},
-std::array<float,2>{0.788829446f, 0.559743404f},
-std::array<float,2>{0.743272245f, 0.258434951f},
-std::array<float,2>{0.217910334f, 0.943142414f},
-std::array<float,2>{0.444030315f, 0.35644871f},
-std::array<float,2>{0.980884492f, 0.933703899f},
-std::array<float,2>{0.535882354f, 0.163763613f},
-std::array<float,2>{0.081561178f, 0.624455929f},
-std::array<float,2>{0.130720422f, 0.0492800102f},
-std::array<float,2>{0.646777272f, 0.62830925f},
-std::array<float,2>{0.861125946f, 0.495276272f},
-std::array<float,2>{0.271793932f, 0.75503087f},
-std::array<float,2>{0.173940584f, 0.472289979f},
-std::array<float,2>{0.680281818f, 0.768166065f},
-std::array<float,2>{0.841776609f, 0.0464005619f},
-std::array<float,2>{0.308036983f, 0.64102608f},
-std::array<float,2>{0.46876803f, 0.182584435f},
-std::array<float,2>{0.967979848f, 0.602296352f},
-std::array<float,2>{0.524025917f, 0.362487525f},
-std::array<float,2>{0.120341182f, 0.914513886f},
-std::array<float,2>{0.362413585f, 0.280647844f},
-std::array<float,2>{0.775239229f, 0.960898161f},
-std::array<float,2>{0.698937774f, 0.241248399f},
-std::array<float,2>{0.247651517f, 0.542094707f},
-std::array<float,2>{0.0374362879f, 0.0646517351f},
-std::array<float,2>{0.58009243f, 0.704166293f},
-std::array<float,2>{0.912255228f, 0.416419804f},
-std::array<float,2>{0.424604177f, 0.843483865f},
-std::array<float,2>{0.0703600198f, 0.341687232f},
-std::array<float,2>{0.552837193f, 0.903855443f},
-std::array<float,2>{0.99093163f, 0.137328163f},
-std::array<float,2>{0.45645979f, 0.566630185f},
-std::array<float,2>{0.256044716f, 0.0211013611f},
-std::array<float,2>{0.846558571f, 0.677969396f},
-std::array<float,2>{0.63539958f, 0.462195575f},
-std::array<float,2>{0.144215345f, 0.805929422f},
-std::array<float,2>{0.400430113f, 0.394684136f},
-std::array<float,2>{0.893510759f, 0.868078887f},
-std::array<float,2>{0.622765839f, 0.113531187f},
-std::array<float,2>{0.0247279461f, 0.738796651f},
-std::array<float,2>{0.199227825f, 0.200361788f},
-std::array<float,2>{0.732661366f, 0.522053957f},
-std::array<float,2>{0.797793031f, 0.284282833f},
-std::array<float,2>{0.325345397f, 0.992783487f},
-std::array<float,2>{0.149838477f, 0.374710441f},
-std::array<float,2>{0.626329601f, 0.909788609f},
-std::array<float,2>{0.852937818f, 0.173527673f},
-std::array<float,2>{0.258704931f, 0.594935179f},
-std::array<float,2>{0.461679429f, 0.0329011455f},
-std::array<float,2>{0.997421026f, 0.651180506f},
-std::array<float,2>{0.559256077f, 0.48159495f},
-std::array<float,2>{0.0650255755f, 0.776807845f},
-std::array<float,2>{0.319610208f, 0.41199854f},
-std::array<float,2>{0.806592345f, 0.830144346f},
-std::array<float,2>{0.724974334f, 0.0764173269f},
-std::array<float,2>{0.192343682f, 0.712696433f},
-std::array<float,2>{0.0233576279f, 0.247174591f},
-std::array<float,2>{0.6114043f, 0.538346708f},
-std::array<float,2>{0.903526485f, 0.26777485f},
-std::array<float,2>{0.396976382f, 0.968370259f},
-std::array<float,2>{0.112046227f, 0.453380525f},
-std::array<float,2>{0.520045161f, 0.801625133f},
-std::array<float,2>{0.959861279f, 0.0284242537f},
-std::array<float,2>{0.483061403f, 0.681080997f},
-std::array<float,2>{0.298791736f, 0.127978772f},
-std::array<float,2>{0.831403375f, 0.571947753f},
-std::array<float,2>{0.673428833f, 0.332166463f},
-std::array<float,2>{0.180553555f, 0.893292367f},
-std::array<float,2>{0.434302449f, 0.290009409f},
-std::array<float,2>{0.919081032f, 0.990087509f},
-std::array<float,2>{0.587600946f, 0.194409057f},
-std::array<float,2>{0.043830391f, 0.528327525f},
-std::array<float,2>{0.235049635f, 0.12482094f},
-std::array<float,2>{0.695172071f, 0.7439394f},
-std::array<float,2>{0.768053174f, 0.404396981f},
-std::array<float,2>{0.370567054f, 0.86563921f},
-std::array<float,2>{0.205170751f, 0.380427361f},
-std::array<float,2>{0.735394597f, 0.856837034f},
-std::array<float,2>{0.794687986f, 0.105769195f},
-std::array<float,2>{0.330362916f, 0.729137421f},
-std::array<float,2>{0.37795943f, 0.218372032f},
-std::array<float,2>{0.880520284f, 0.506234527f},
-std::array<float,2>{0.605855286f, 0.311339885f},
-std::array<float,2>{0.0140479049f, 0.979455829f},
-std::array<float,2>{0.274099767f, 0.32216996f},
-std::array<float,2>{0.870878994f, 0.881050885f},
-std::array<float,2>{0.653642654f, 0.14346014f},
-std::array<float,2>{0.13856329f, 0.591047347f},
-std::array<float,2>{0.0925388858f, 0.000974496885f},
-std::array<float,2>{0.545202494f, 0.671229899f},
-std::array<float,2>{0.974439681f, 0.440302789f},
-std::array<float,2>{0.447916061f, 0.792263865f},
-std::array<float,2>{0.0511213914f, 0.255949646f},
-std::array<float,2>{0.573867619f, 0.947848439f},
-std::array<float,2>{0.928038657f, 0.22770685f},
-std::array<float,2>{0.419468194f, 0.55276978f},
-std::array<float,2>{0.356764644f, 0.0894052014f},
-std::array<float,2>{0.756762683f, 0.688335836f},
-std::array<float,2>{0.712722778f, 0.423095673f},
-std::array<float,2>{0.22076723f, 0.823282301f},
-std::array<float,2>{0.497446418f, 0.484538257f},
-std::array<float,2>{0.948189318f, 0.763806224f},
-std::array<float,2>{0.508428991f, 0.0560166053f},
-std::array<float,2>{0.107765421f, 0.634080231f},
-std::array<float,2>{0.156560659f, 0.16452764f},
-std::array<float,2>{0.671422541f, 0.616518676f},
-std::array<float,2>{0.824332416f, 0.348348379f},
-std::array<float,2>{0.287434816f, 0.928507328f},
-std::array<float,2>{0.127491072f, 0.296417713f},
-std::array<float,2>{0.642398953f, 0.984624922f},
-std::array<float,2>{0.866897523f, 0.188725591f},
-std::array<float,2>{0.26894331f, 0.527299404f},
-std::array<float,2>{0.440268815f, 0.117396928f},
-std::array<float,2>{0.980122149f, 0.747297287f},
-std::array<float,2>{0.533590853f, 0.402204096f},
-std::array<float,2>{0.0832335874f, 0.859735191f},
-std::array<float,2>{0.342824608f, 0.459490985f},
-std::array<float,2>{0.784719825f, 0.800002813f},
-std::array<float,2>{0.74613589f, 0.0247372054f},
-std::array<float,2>{0.212434769f, 0.68386519f},
-std::array<float,2>{0.00677095773f, 0.131149977f},
-std::array<float,2>{0.595274925f, 0.577452242f},
-std::array<float,2>{0.88552171f, 0.329230487f},
-std::array<float,2>{0.388436109f, 0.896536231f},
-std::array<float,2>{0.0961534381f, 0.406784862f},
-std::array<float,2>{0.505578697f, 0.834006011f},
-std::array<float,2>{0.944155633f, 0.0710779428f},
-std::array<float,2>{0.49157691f, 0.716781974f},
-std::array<float,2>{0.293751627f, 0.24527967f},
-std::array<float,2>{0.8143875f, 0.53253597f},
-std::array<float,2>{0.66322273f, 0.271223485f},
-std::array<float,2>{0.171227455f, 0.962349772f},
-std::array<float,2>{0.407783926f, 0.36942032f},
-std::array<float,2>{0.936085343f, 0.910445452f},
-std::array<float,2>{0.569950104f, 0.179158494f},
-std::array<float,2>{0.0574327409f, 0.598827779f},
-std::array<float,2>{0.230704889f, 0.0362251811f},
-std::array<float,2>{0.707796574f, 0.652578592f},
-std::array<float,2>{0.758876145f, 0.479579598f},
-std::array<float,2>{0.34382394f, 0.781002343f},
-std::array<float,2>{0.195565358f, 0.491155535f},
-std::array<float,2>{0.727688491f, 0.758940279f},
-std::array<float,2>{0.80374378f, 0.0610910393f},
-std::array<float,2>{0.323896974f, 0.638736367f},
-std::array<float,2>{0.405038863f, 0.171329752f},
-std::array<float,2>{0.895081639f, 0.611425042f},
-std::array<float,2>{0.617322624f, 0.34755227f},
-std::array<float,2>{0.0287550911f, 0.922093093f},
-std::array<float,2>{0.250469357f, 0.252490014f},
-std::array<float,2>{0.849429488f, 0.951968551f},
-std::array<float,2>{0.639057279f, 0.232013986f},
-std::array<float,2>{0.145322263f, 0.549412608f},
-std::array<float,2>{0.0769121572f, 0.0915482044f},
-std::array<float,2>{0.548576891f, 0.694787204f},
-std::array<float,2>{0.987326443f, 0.426669031f},
-std::array<float,2>{0.457038134f, 0.82712692f},
-std::array<float,2>{0.034468744f, 0.325556308f},
-std::array<float,2>{0.582494676f, 0.876596093f},
-std::array<float,2>{0.909325302f, 0.147470832f},
-std::array<float,2>{0.42832002f, 0.589615524f},
-std::array<float,2>{0.366465122f, 0.00655328669f},
-std::array<float,2>{0.780133963f, 0.667228103f},
-std::array<float,2>{0.700413883f, 0.443524271f},
-std::array<float,2>{0.243155062f, 0.793724716f},
-std::array<float,2>{0.473971486f, 0.377645254f},
-std::array<float,2>{0.961702228f, 0.854114532f},
-std::array<float,2>{0.527932703f, 0.102313474f},
-std::array<float,2>{0.12487255f, 0.73385644f},
-std::array<float,2>{0.179341286f, 0.214274257f},
-std::array<float,2>{0.684924245f, 0.502512515f},
-std::array<float,2>{0.837627411f, 0.308432043f},
-std::array<float,2>{0.31036967f, 0.980890632f},
-std::array<float,2>{0.242111161f, 0.35529536f},
-std::array<float,2>{0.689970434f, 0.932938576f},
-std::array<float,2>{0.771826208f, 0.160017326f},
-std::array<float,2>{0.37180832f, 0.618060887f},
-std::array<float,2>{0.43122074f, 0.0545688979f},
-std::array<float,2>{0.916921198f, 0.632497966f},
-std::array<float,2>{0.592422307f, 0.498187691f},
-std::array<float,2>{0.0412653573f, 0.751332223f},
-std::array<float,2>{0.30109942f, 0.433735698f},
-std::array<float,2>{0.83470881f, 0.819633126f},
-std::array<float,2>{0.67645669f, 0.0825546831f},
-std::array<float,2>{0.18748711f, 0.700505555f},
-std::array<float,2>{0.114805259f, 0.221919164f},
-std::array<float,2>{0.51571691f, 0.557728052f},
-std::array<float,2>{0.956970274f, 0.263664216f},
-std::array<float,2>{0.477260679f, 0.941152036f},
-std::array<float,2>{0.0171017274f, 0.445395559f},
-std::array<float,2>{0.615514636f, 0.782588184f},
-std::array<float,2>{0.899364233f, 0.0113041606f},
-std::array<float,2>{0.393398792f, 0.658471882f},
-std::array<float,2>{0.313064516f, 0.15452233f},
-std::array<float,2>{0.809800386f, 0.583752096f},
-std::array<float,2>{0.721465409f, 0.316417456f},
-std::array<float,2>{0.189725205f, 0.886688054f},
-std::array<float,2>{0.467128545f, 0.303795159f},
-std::array<float,2>{0.994025171f, 0.971638143f},
-std::array<float,2>{0.556063175f, 0.203189164f},
-std::array<float,2>{0.0674161911f, 0.508267224f},
-std::array<float,2>{0.15287672f, 0.0983911827f},
-std::array<float,2>{0.632001698f, 0.720739424f},
-std::array<float,2>{0.858180285f, 0.383938313f},
-std::array<float,2>{0.264338374f, 0.850165546f},
-std::array<float,2>{0.163372293f, 0.392071068f},
-std::array<float,2>{0.664230466f, 0.872033119f},
-std::array<float,2>{0.821730614f, 0.110379323f},
-std::array<float,2>{0.28195852f, 0.737578928f},
-std::array<float,2>{0.495013058f, 0.196192607f},
-std::array<float,2>{0.951416254f, 0.516852021f},
-std::array<float,2>{0.51358664f, 0.285662591f},
-std::array<float,2>{0.102528967f, 0.99880743f},
-std::array<float,2>{0.35542956f, 0.336075842f},
-std::array<float,2>{0.750512302f, 0.901853502f},
-std::array<float,2>{0.716115117f, 0.133375138f},
-std::array<float,2>{0.225837529f, 0.563964963f},
-std::array<float,2>{0.0474747494f, 0.018188592f},
-std::array<float,2>{0.57553786f, 0.674223006f},
-std::array<float,2>{0.925128162f, 0.46685788f},
-std::array<float,2>{0.414904267f, 0.810847461f},
-std::array<float,2>{0.0864659846f, 0.276870489f},
-std::array<float,2>{0.53989017f, 0.956617773f},
-std::array<float,2>{0.970683217f, 0.237076059f},
-std::array<float,2>{0.450635344f, 0.545526385f},
-std::array<float,2>{0.277424693f, 0.0683258921f},
-std::array<float,2>{0.874816477f, 0.710551918f},
-std::array<float,2>{0.652104199f, 0.41837585f},
-std::array<float,2>{0.136331931f, 0.837643266f},
-std::array<float,2>{0.379571438f, 0.474485308f},
-std::array<float,2>{0.876186967f, 0.772526205f},
-std::array<float,2>{0.605126798f, 0.042962715f},
-std::array<float,2>{0.0102725737f, 0.647700012f},
-std::array<float,2>{0.210620314f, 0.18634589f},
-std::array<float,2>{0.739032567f, 0.607438862f},
-std::array<float,2>{0.792072296f, 0.3645055f},
-std::array<float,2>{0.334082901f, 0.921332419f},
-std::array<float,2>{0.215091601f, 0.261567205f},
-std::array<float,2>{0.745094478f, 0.944679976f},
-std::array<float,2>{0.785607874f, 0.225223973f},
-std::array<float,2>{0.338537961f, 0.561490715f},
-std::array<float,2>{0.385109425f, 0.0798174292f},
-std::array<float,2>{0.88998878f, 0.698481917f},
-std::array<float,2>{0.598747849f, 0.433419794f},
-std::array<float,2>{0.00158992771f, 0.815613985f},
-std::array<float,2>{0.270074129f, 0.492363125f},
-std::array<float,2>{0.861775696f, 0.756758153f},
-std::array<float,2>{0.64471072f, 0.0476008318f},
-std::array<float,2>{0.132567033f, 0.625800788f},
-std::array<float,2>{0.0794083923f, 0.16051814f},
-std::array<float,2>{0.538674235f, 0.622793734f},
-std::array<float,2>{0.983105242f, 0.358863324f},
-std::array<float,2>{0.442858249f, 0.936851323f},
-std::array<float,2>{0.0593025386f, 0.390101135f},
-std::array<float,2>{0.565866768f, 0.846414566f},
-std::array<float,2>{0.932867765f, 0.0959842205f},
-std::array<float,2>{0.413536817f, 0.726309896f},
-std::array<float,2>{0.34983319f, 0.209564373f},
-std::array<float,2>{0.762525141f, 0.514164269f},
-std::array<float,2>{0.703977048f, 0.2998586f},
-std::array<float,2>{0.226650178f, 0.976551712f},
-std::array<float,2>{0.487964749f, 0.313965231f},
-std::array<float,2>{0.939859986f, 0.887772143f},
-std::array<float,2>{0.500545084f, 0.150097117f},
-std::array<float,2>{0.0995469913f, 0.578443944f},
-std::array<float,2>{0.166145548f, 0.0125875073f},
-std::array<float,2>{0.659554124f, 0.661318123f},
-std::array<float,2>{0.819144428f, 0.452147514f},
-std::array<float,2>{0.292688578f, 0.786836982f},
-std::array<float,2>{0.14255096f, 0.463296413f},
-std::array<float,2>{0.634698749f, 0.80836755f},
-std::array<float,2>{0.844982982f, 0.0218171068f},
-std::array<float,2>{0.255006641f, 0.675845504f},
-std::array<float,2>{0.45399493f, 0.14007473f},
-std::array<float,2>{0.989224374f, 0.569926858f},
-std::array<float,2>{0.551393211f, 0.342907518f},
-std::array<float,2>{0.0737882331f, 0.905284643f},
-std::array<float,2>{0.32727322f, 0.282582521f},
-std::array<float,2>{0.799028277f, 0.994291604f},
-std::array<float,2>{0.731719792f, 0.201287806f},
-std::array<float,2>{0.20186542f, 0.519923031f},
-std::array<float,2>{0.0267815944f, 0.115994841f},
-std::array<float,2>{0.624834001f, 0.741514087f},
-std::array<float,2>{0.891672194f, 0.396881312f},
-std::array<float,2>{0.398591638f, 0.86964041f},
-std::array<float,2>{0.118427135f, 0.360748887f},
-std::array<float,2>{0.526872277f, 0.916969895f},
-std::array<float,2>{0.965188265f, 0.18004936f},
-std::array<float,2>{0.470854491f, 0.604821444f},
-std::array<float,2>{0.304942608f, 0.0437913612f},
-std::array<float,2>{0.843562186f, 0.643776238f},
-std::array<float,2>{0.682976365f, 0.469546139f},
-std::array<float,2>{0.172196507f, 0.766760111f},
-std::array<float,2>{0.423277736f, 0.414396167f},
-std::array<float,2>{0.911375165f, 0.84024483f},
-std::array<float,2>{0.578370333f, 0.0639167055f},
-std::array<float,2>{0.0352951735f, 0.705629349f},
-std::array<float,2>{0.248614237f, 0.239410847f},
-std::array<float,2>{0.696673334f, 0.539604902f},
-std::array<float,2>{0.776652515f, 0.278169632f},
-std::array<float,2>{0.361204207f, 0.95729053f},
-std::array<float,2>{0.182008073f, 0.335882872f},
-std::array<float,2>{0.67500937f, 0.891009092f},
-std::array<float,2>{0.82915628f, 0.126058429f},
-std::array<float,2>{0.299947739f, 0.572713554f},
-std::array<float,2>{0.481205344f, 0.0303314384f},
-std::array<float,2>{0.958495557f, 0.682312191f},
-std::array<float,2>{0.523061752f, 0.455949128f},
-std::array<float,2>{0.111187205f, 0.803004861f},
-std::array<float,2>{0.368419349f, 0.403606653f},
-std::array<float,2>{0.766747117f, 0.864448428f},
-std::array<float,2>{0.692910314f, 0.122668765f},
-std::array<float,2>{0.237491563f, 0.744554996f},
-std::array<float,2>{0.0458937883f, 0.191782579f},
-std::array<float,2>{0.588871479f, 0.530883729f},
-std::array<float,2>{0.920457542f, 0.292518586f},
-std::array<float,2>{0.437271029f, 0.990901768f},
-std::array<float,2>{0.0628762171f, 0.484315395f},
-std::array<float,2>{0.562128365f, 0.774112046f},
-std::array<float,2>{0.998274207f, 0.0344867297f},
-std::array<float,2>{0.462913275f, 0.649866164f},
-std::array<float,2>{0.260028005f, 0.174097016f},
-std::array<float,2>{0.853689075f, 0.59728086f},
-std::array<float,2>{0.627544761f, 0.372631937f},
-std::array<float,2>{0.150669649f, 0.906817853f},
-std::array<float,2>{0.395465195f, 0.266887784f},
-std::array<float,2>{0.905454874f, 0.964850008f},
-std::array<float,2>{0.609989882f, 0.249533162f},
-std::array<float,2>{0.0212090965f, 0.535709321f},
-std::array<float,2>{0.193718106f, 0.0760567635f},
-std::array<float,2>{0.723589838f, 0.713859081f},
-std::array<float,2>{0.807323575f, 0.414056033f},
-std::array<float,2>{0.318172812f, 0.829522073f},
-std::array<float,2>{0.219377279f, 0.42492485f},
-std::array<float,2>{0.713138342f, 0.82034117f},
-std::array<float,2>{0.753906667f, 0.087348707f},
-std::array<float,2>{0.359293938f, 0.689994574f},
-std::array<float,2>{0.420336604f, 0.229227632f},
-std::array<float,2>{0.926006675f, 0.552146912f},
-std::array<float,2>{0.570697904f, 0.255663514f},
-std::array<float,2>{0.0536129363f, 0.947187901f},
-std::array<float,2>{0.286784053f, 0.351135045f},
-std::array<float,2>{0.826909184f, 0.92762804f},
-std::array<float,2>{0.668327928f, 0.166710123f},
-std::array<float,2>{0.159012124f, 0.614224136f},
-std::array<float,2>{0.105888806f, 0.0584263168f},
-std::array<float,2>{0.511390805f, 0.635699451f},
-std::array<float,2>{0.9467749f, 0.487950414f},
-std::array<float,2>{0.499768794f, 0.761833906f},
-std::array<float,2>{0.0122238277f, 0.310542077f},
-std::array<float,2>{0.608594298f, 0.978508115f},
-std::array<float,2>{0.881298721f, 0.215774313f},
-std::array<float,2>{0.376862913f, 0.505540848f},
-std::array<float,2>{0.328942478f, 0.108447336f},
-std::array<float,2>{0.795400739f, 0.726745307f},
-std::array<float,2>{0.737670958f, 0.381313741f},
-std::array<float,2>{0.204148605f, 0.858858883f},
-std::array<float,2>{0.447063208f, 0.438568711f},
-std::array<float,2>{0.974680483f, 0.789338648f},
-std::array<float,2>{0.544092417f, 0.00201032683f},
-std::array<float,2>{0.0902716294f, 0.669719577f},
-std::array<float,2>{0.139886066f, 0.140957013f},
-std::array<float,2>{0.655554056f, 0.592208683f},
-std::array<float,2>{0.868261337f, 0.324175566f},
-std::array<float,2>{0.27554673f, 0.879247427f},
-std::array<float,2>{0.151625261f, 0.267932683f},
-std::array<float,2>{0.628382027f, 0.968509138f},
-std::array<float,2>{0.855086267f, 0.247477323f},
-std::array<float,2>{0.261055499f, 0.538298309f},
-std::array<float,2>{0.464193523f, 0.0763155222f},
-std::array<float,2>{0.999245942f, 0.712477624f},
-std::array<float,2>{0.560814381f, 0.411760837f},
-std::array<float,2>{0.0639598742f, 0.830363572f},
-std::array<float,2>{0.317146063f, 0.481898308f},
-std::array<float,2>{0.807631791f, 0.776397288f},
-std::array<float,2>{0.723865926f, 0.0330385193f},
-std::array<float,2>{0.195053533f, 0.651105046f},
-std::array<float,2>{0.0195967108f, 0.173620299f},
-std::array<float,2>{0.611220717f, 0.595098674f},
-std::array<float,2>{0.905210614f, 0.374933481f},
-std::array<float,2>{0.396003991f, 0.91008234f},
-std::array<float,2>{0.109982207f, 0.404688507f},
-std::array<float,2>{0.521856725f, 0.865450561f},
-std::array<float,2>{0.957861781f, 0.12461254f},
-std::array<float,2>{0.481657535f, 0.743694901f},
-std::array<float,2>{0.299588293f, 0.194671452f},
-std::array<float,2>{0.82853961f, 0.528678715f},
-std::array<float,2>{0.674568474f, 0.289727241f},
-std::array<float,2>{0.183136553f, 0.989973903f},
-std::array<float,2>{0.436250359f, 0.332375318f},
-std::array<float,2>{0.92136544f, 0.893428624f},
-std::array<float,2>{0.588086784f, 0.128182992f},
-std::array<float,2>{0.0463323928f, 0.572232842f},
-std::array<float,2>{0.237103596f, 0.0286947954f},
-std::array<float,2>{0.691425443f, 0.680906415f},
-std::array<float,2>{0.766390204f, 0.453350902f},
-std::array<float,2>{0.367388219f, 0.801323354f},
-std::array<float,2>{0.203180686f, 0.439976186f},
-std::array<float,2>{0.736929715f, 0.792177796f},
-std::array<float,2>{0.796808839f, 0.000667305314f},
-std::array<float,2>{0.329768211f, 0.670984745f},
-std::array<float,2>{0.375180721f, 0.143207267f},
-std::array<float,2>{0.882023215f, 0.591253936f},
-std::array<float,2>{0.607863426f, 0.321838766f},
-std::array<float,2>{0.0132735567f, 0.881239414f},
-std::array<float,2>{0.276895195f, 0.311115235f},
-std::array<float,2>{0.867646217f, 0.979120255f},
-std::array<float,2>{0.654391348f, 0.218590185f},
-std::array<float,2>{0.138841912f, 0.50589031f},
-std::array<float,2>{0.0913398787f, 0.105612695f},
-std::array<float,2>{0.543554783f, 0.729382575f},
-std::array<float,2>{0.975917518f, 0.380737066f},
-std::array<float,2>{0.445318699f, 0.856662214f},
-std::array<float,2>{0.0544953905f, 0.348436177f},
-std::array<float,2>{0.571578205f, 0.928342342f},
-std::array<float,2>{0.927646101f, 0.164072737f},
-std::array<float,2>{0.421050727f, 0.616325438f},
-std::array<float,2>{0.357523054f, 0.0558361784f},
-std::array<float,2>{0.75557369f, 0.633852661f},
-std::array<float,2>{0.714721799f, 0.484854668f},
-std::array<float,2>{0.220120206f, 0.764111578f},
-std::array<float,2>{0.49822396f, 0.423165321f},
-std::array<float,2>{0.945452273f, 0.823726475f},
-std::array<float,2>{0.510015309f, 0.0896540284f},
-std::array<float,2>{0.107409067f, 0.688027978f},
-std::array<float,2>{0.159336016f, 0.227792934f},
-std::array<float,2>{0.669608116f, 0.553125381f},
-std::array<float,2>{0.827414572f, 0.256338149f},
-std::array<float,2>{0.285305142f, 0.948095918f},
-std::array<float,2>{0.228446066f, 0.314467341f},
-std::array<float,2>{0.704210043f, 0.889743805f},
-std::array<float,2>{0.762810171f, 0.151383579f},
-std::array<float,2>{0.350651026f, 0.581795633f},
-std::array<float,2>{0.413037002f, 0.0136802029f},
-std::array<float,2>{0.932572842f, 0.663104296f},
-std::array<float,2>{0.565420866f, 0.450263828f},
-std::array<float,2>{0.0602519028f, 0.787962556f},
-std::array<float,2>{0.291172147f, 0.387006998f},
-std::array<float,2>{0.819648862f, 0.844893932f},
-std::array<float,2>{0.658267796f, 0.0944127291f},
-std::array<float,2>{0.167432845f, 0.72437942f},
-std::array<float,2>{0.0980990008f, 0.207043305f},
-std::array<float,2>{0.501156032f, 0.513416946f},
-std::array<float,2>{0.940980256f, 0.298344105f},
-std::array<float,2>{0.486623257f, 0.973020852f},
-std::array<float,2>{0.000424655504f, 0.495594442f},
-std::array<float,2>{0.598631799f, 0.755350888f},
-std::array<float,2>{0.888690233f, 0.0489496142f},
-std::array<float,2>{0.38576895f, 0.628006697f},
-std::array<float,2>{0.339291543f, 0.16401881f},
-std::array<float,2>{0.786789179f, 0.624199033f},
-std::array<float,2>{0.745703876f, 0.356691867f},
-std::array<float,2>{0.215952009f, 0.933989167f},
-std::array<float,2>{0.441583902f, 0.258547992f},
-std::array<float,2>{0.983468533f, 0.942964852f},
-std::array<float,2>{0.537196755f, 0.222810209f},
-std::array<float,2>{0.0782373101f, 0.559981704f},
-std::array<float,2>{0.131120533f, 0.0806266442f},
-std::array<float,2>{0.645703077f, 0.695463538f},
-std::array<float,2>{0.862898827f, 0.43055743f},
-std::array<float,2>{0.271056682f, 0.812951982f},
-std::array<float,2>{0.173062608f, 0.416021675f},
-std::array<float,2>{0.681725025f, 0.843740463f},
-std::array<float,2>{0.841929495f, 0.0649209991f},
-std::array<float,2>{0.305913776f, 0.704360545f},
-std::array<float,2>{0.471869439f, 0.241476268f},
-std::array<float,2>{0.966399312f, 0.542424917f},
-std::array<float,2>{0.526230812f, 0.280401498f},
-std::array<float,2>{0.117209204f, 0.96054107f},
-std::array<float,2>{0.360286325f, 0.362566233f},
-std::array<float,2>{0.776109815f, 0.914218068f},
-std::array<float,2>{0.695351958f, 0.182365105f},
-std::array<float,2>{0.249901488f, 0.602110207f},
-std::array<float,2>{0.0362371765f, 0.0467684232f},
-std::array<float,2>{0.57973516f, 0.640788794f},
-std::array<float,2>{0.911121905f, 0.472560912f},
-std::array<float,2>{0.422809899f, 0.768394291f},
-std::array<float,2>{0.0727033094f, 0.284466833f},
-std::array<float,2>{0.552158475f, 0.992924154f},
-std::array<float,2>{0.990181625f, 0.200501338f},
-std::array<float,2>{0.454315007f, 0.522242129f},
-std::array<float,2>{0.25482133f, 0.11336977f},
-std::array<float,2>{0.844027519f, 0.739163697f},
-std::array<float,2>{0.632971287f, 0.394944578f},
-std::array<float,2>{0.141179502f, 0.867753506f},
-std::array<float,2>{0.399884939f, 0.46210596f},
-std::array<float,2>{0.890884221f, 0.805738032f},
-std::array<float,2>{0.62371099f, 0.0213877261f},
-std::array<float,2>{0.0261303075f, 0.67821312f},
-std::array<float,2>{0.202718154f, 0.137693703f},
-std::array<float,2>{0.730964601f, 0.566812038f},
-std::array<float,2>{0.800472677f, 0.341400862f},
-std::array<float,2>{0.32691291f, 0.904182076f},
-std::array<float,2>{0.191354126f, 0.302406013f},
-std::array<float,2>{0.722341299f, 0.97030741f},
-std::array<float,2>{0.808819652f, 0.206016883f},
-std::array<float,2>{0.314446568f, 0.511289716f},
-std::array<float,2>{0.39423275f, 0.100388914f},
-std::array<float,2>{0.900129259f, 0.7189008f},
-std::array<float,2>{0.616970837f, 0.385798335f},
-std::array<float,2>{0.0157165062f, 0.847943962f},
-std::array<float,2>{0.26524207f, 0.447887778f},
-std::array<float,2>{0.858525157f, 0.783686042f},
-std::array<float,2>{0.631051004f, 0.00927520264f},
-std::array<float,2>{0.153922394f, 0.656628907f},
-std::array<float,2>{0.0669065788f, 0.153991848f},
-std::array<float,2>{0.555123746f, 0.585383773f},
-std::array<float,2>{0.992768347f, 0.319645941f},
-std::array<float,2>{0.468044877f, 0.882850945f},
-std::array<float,2>{0.042144604f, 0.437269896f},
-std::array<float,2>{0.593402028f, 0.817594647f},
-std::array<float,2>{0.917941093f, 0.0856115147f},
-std::array<float,2>{0.430335164f, 0.701500237f},
-std::array<float,2>{0.3720783f, 0.219673306f},
-std::array<float,2>{0.772771478f, 0.554915905f},
-std::array<float,2>{0.69126761f, 0.265161276f},
-std::array<float,2>{0.241137043f, 0.938900292f},
-std::array<float,2>{0.47826615f, 0.352100849f},
-std::array<float,2>{0.955360949f, 0.931363165f},
-std::array<float,2>{0.517315149f, 0.157907531f},
-std::array<float,2>{0.113854833f, 0.619439662f},
-std::array<float,2>{0.186509281f, 0.0516863801f},
-std::array<float,2>{0.677177489f, 0.630539834f},
-std::array<float,2>{0.835903585f, 0.497692019f},
-std::array<float,2>{0.302599669f, 0.75304395f},
-std::array<float,2>{0.135413766f, 0.475236028f},
-std::array<float,2>{0.650653124f, 0.769653618f},
-std::array<float,2>{0.873170078f, 0.0399311483f},
-std::array<float,2>{0.278574228f, 0.645024598f},
-std::array<float,2>{0.450175047f, 0.184312329f},
-std::array<float,2>{0.969417453f, 0.606700897f},
-std::array<float,2>{0.540602922f, 0.366481662f},
-std::array<float,2>{0.0873571783f, 0.91848743f},
-std::array<float,2>{0.335028827f, 0.274240673f},
-std::array<float,2>{0.791881144f, 0.953573525f},
-std::array<float,2>{0.739807606f, 0.235624611f},
-std::array<float,2>{0.209933385f, 0.544466794f},
-std::array<float,2>{0.0108455988f, 0.0701824501f},
-std::array<float,2>{0.603807211f, 0.707248986f},
-std::array<float,2>{0.875706255f, 0.420240313f},
-std::array<float,2>{0.379967719f, 0.839321613f},
-std::array<float,2>{0.103092924f, 0.339827299f},
-std::array<float,2>{0.512560606f, 0.8994326f},
-std::array<float,2>{0.952280581f, 0.135457292f},
-std::array<float,2>{0.49578765f, 0.565885663f},
-std::array<float,2>{0.282394737f, 0.0161932744f},
-std::array<float,2>{0.821244001f, 0.673159182f},
-std::array<float,2>{0.665079653f, 0.465628117f},
-std::array<float,2>{0.162779823f, 0.809808612f},
-std::array<float,2>{0.415814698f, 0.394179344f},
-std::array<float,2>{0.924432874f, 0.874846101f},
-std::array<float,2>{0.574475884f, 0.112926193f},
-std::array<float,2>{0.0482020937f, 0.735792339f},
-std::array<float,2>{0.224788472f, 0.197397918f},
-std::array<float,2>{0.715590954f, 0.517872155f},
-std::array<float,2>{0.751094401f, 0.288986057f},
-std::array<float,2>{0.353545129f, 0.996220887f},
-std::array<float,2>{0.170582846f, 0.367582321f},
-std::array<float,2>{0.662246943f, 0.912366927f},
-std::array<float,2>{0.812732399f, 0.17604281f},
-std::array<float,2>{0.294874132f, 0.599984586f},
-std::array<float,2>{0.491100609f, 0.0379974432f},
-std::array<float,2>{0.944671273f, 0.654804826f},
-std::array<float,2>{0.504788339f, 0.476728082f},
-std::array<float,2>{0.097394675f, 0.778574586f},
-std::array<float,2>{0.345256865f, 0.408887476f},
-std::array<float,2>{0.75798136f, 0.833281159f},
-std::array<float,2>{0.708692133f, 0.0731180459f},
-std::array<float,2>{0.232133821f, 0.717557132f},
-std::array<float,2>{0.0585443974f, 0.243062094f},
-std::array<float,2>{0.56908679f, 0.533524156f},
-std::array<float,2>{0.937462091f, 0.272612959f},
-std::array<float,2>{0.406432271f, 0.963312566f},
-std::array<float,2>{0.0821684077f, 0.458958745f},
-std::array<float,2>{0.534294486f, 0.797639132f},
-std::array<float,2>{0.978851974f, 0.026877027f},
-std::array<float,2>{0.44113487f, 0.685807168f},
-std::array<float,2>{0.268270016f, 0.129016623f},
-std::array<float,2>{0.865771532f, 0.57540518f},
-std::array<float,2>{0.640976131f, 0.33094582f},
-std::array<float,2>{0.128183961f, 0.895557344f},
-std::array<float,2>{0.386977971f, 0.294040382f},
-std::array<float,2>{0.885965645f, 0.986721158f},
-std::array<float,2>{0.594042122f, 0.189563334f},
-std::array<float,2>{0.00761379628f, 0.524142563f},
-std::array<float,2>{0.211625367f, 0.11916969f},
-std::array<float,2>{0.747487128f, 0.749259055f},
-std::array<float,2>{0.783221722f, 0.400113195f},
-std::array<float,2>{0.342343062f, 0.862312317f},
-std::array<float,2>{0.244015798f, 0.376891941f},
-std::array<float,2>{0.699492991f, 0.852763653f},
-std::array<float,2>{0.78059262f, 0.105259202f},
-std::array<float,2>{0.365471274f, 0.731419742f},
-std::array<float,2>{0.429497808f, 0.211908355f},
-std::array<float,2>{0.90916276f, 0.501721323f},
-std::array<float,2>{0.583431244f, 0.306625783f},
-std::array<float,2>{0.0341439247f, 0.983122706f},
-std::array<float,2>{0.308879942f, 0.327163577f},
-std::array<float,2>{0.836360991f, 0.878726363f},
-std::array<float,2>{0.684082389f, 0.145224124f},
-std::array<float,2>{0.17805928f, 0.586597264f},
-std::array<float,2>{0.123096898f, 0.00409836369f},
-std::array<float,2>{0.529135644f, 0.665272534f},
-std::array<float,2>{0.96216166f, 0.443053484f},
-std::array<float,2>{0.472693801f, 0.796814382f},
-std::array<float,2>{0.0281230081f, 0.250647008f},
-std::array<float,2>{0.618679702f, 0.949482262f},
-std::array<float,2>{0.895707786f, 0.232542589f},
-std::array<float,2>{0.405885786f, 0.548629045f},
-std::array<float,2>{0.3223553f, 0.0933660865f},
-std::array<float,2>{0.803102136f, 0.692361712f},
-std::array<float,2>{0.727369905f, 0.427847594f},
-std::array<float,2>{0.196958333f, 0.824671149f},
-std::array<float,2>{0.458620101f, 0.489062876f},
-std::array<float,2>{0.987190723f, 0.760364532f},
-std::array<float,2>{0.547082901f, 0.0601669811f},
-std::array<float,2>{0.0773083568f, 0.63728857f},
-std::array<float,2>{0.145974353f, 0.168874353f},
-std::array<float,2>{0.640013754f, 0.610204756f},
-std::array<float,2>{0.848255694f, 0.344315708f},
-std::array<float,2>{0.251375079f, 0.923913896f},
-std::array<float,2>{0.18092899f, 0.292948425f},
-std::array<float,2>{0.672527313f, 0.991107583f},
-std::array<float,2>{0.830901921f, 0.191574618f},
-std::array<float,2>{0.297429949f, 0.531043231f},
-std::array<float,2>{0.484184116f, 0.122957945f},
-std::array<float,2>{0.960907757f, 0.744259536f},
-std::array<float,2>{0.52119422f, 0.403507739f},
-std::array<float,2>{0.113233179f, 0.864551425f},
-std::array<float,2>{0.369525164f, 0.45562008f},
-std::array<float,2>{0.769504905f, 0.802830637f},
-std::array<float,2>{0.693878293f, 0.0307460055f},
-std::array<float,2>{0.235362828f, 0.682607472f},
-std::array<float,2>{0.0448739976f, 0.126444384f},
-std::array<float,2>{0.58598125f, 0.572487295f},
-std::array<float,2>{0.918249607f, 0.335560322f},
-std::array<float,2>{0.434675515f, 0.890635908f},
-std::array<float,2>{0.0655472949f, 0.413645208f},
-std::array<float,2>{0.559596717f, 0.829305828f},
-std::array<float,2>{0.996825874f, 0.0758031681f},
-std::array<float,2>{0.462505817f, 0.713597655f},
-std::array<float,2>{0.259311706f, 0.249811307f},
-std::array<float,2>{0.851863563f, 0.535939455f},
-std::array<float,2>{0.625205278f, 0.26679638f},
-std::array<float,2>{0.148466766f, 0.965170443f},
-std::array<float,2>{0.397698492f, 0.372820526f},
-std::array<float,2>{0.902781904f, 0.90713203f},
-std::array<float,2>{0.612610698f, 0.173917979f},
-std::array<float,2>{0.0224215444f, 0.597558558f},
-std::array<float,2>{0.192912355f, 0.0342079028f},
-std::array<float,2>{0.725968659f, 0.649427712f},
-std::array<float,2>{0.805543005f, 0.483929217f},
-std::array<float,2>{0.319161147f, 0.774342954f},
-std::array<float,2>{0.222218722f, 0.488181829f},
-std::array<float,2>{0.711470604f, 0.762082219f},
-std::array<float,2>{0.75700736f, 0.0581922568f},
-std::array<float,2>{0.356188178f, 0.635373473f},
-std::array<float,2>{0.418041795f, 0.166811705f},
-std::array<float,2>{0.929238439f, 0.6139431f},
-std::array<float,2>{0.572748065f, 0.351511538f},
-std::array<float,2>{0.0519079305f, 0.927278578f},
-std::array<float,2>{0.288247108f, 0.255585819f},
-std::array<float,2>{0.825509965f, 0.946928918f},
-std::array<float,2>{0.670880437f, 0.229490966f},
-std::array<float,2>{0.157978535f, 0.551800013f},
-std::array<float,2>{0.109145924f, 0.0871362463f},
-std::array<float,2>{0.508931756f, 0.690400302f},
-std::array<float,2>{0.948329806f, 0.425103098f},
-std::array<float,2>{0.496264309f, 0.820638835f},
-std::array<float,2>{0.0149269076f, 0.323897779f},
-std::array<float,2>{0.607242703f, 0.878923178f},
-std::array<float,2>{0.879535377f, 0.140630737f},
-std::array<float,2>{0.377160847f, 0.591913998f},
-std::array<float,2>{0.331887275f, 0.00243910355f},
-std::array<float,2>{0.79300344f, 0.669489026f},
-std::array<float,2>{0.734559536f, 0.438784748f},
-std::array<float,2>{0.206345871f, 0.789254129f},
-std::array<float,2>{0.449089855f, 0.381069392f},
-std::array<float,2>{0.9733513f, 0.858470201f},
-std::array<float,2>{0.546299994f, 0.108655848f},
-std::array<float,2>{0.093301639f, 0.726980925f},
-std::array<float,2>{0.137109756f, 0.215557843f},
-std::array<float,2>{0.65234834f, 0.505729496f},
-std::array<float,2>{0.869543314f, 0.310265034f},
-std::array<float,2>{0.274518579f, 0.978105009f},
-std::array<float,2>{0.216972113f, 0.358414531f},
-std::array<float,2>{0.74286896f, 0.936637163f},
-std::array<float,2>{0.787650943f, 0.160340503f},
-std::array<float,2>{0.337762624f, 0.623022735f},
-std::array<float,2>{0.383448124f, 0.04774528f},
-std::array<float,2>{0.887342393f, 0.625713646f},
-std::array<float,2>{0.599705577f, 0.492566377f},
-std::array<float,2>{0.00255971472f, 0.756483734f},
-std::array<float,2>{0.27323541f, 0.433122814f},
-std::array<float,2>{0.860196948f, 0.815806568f},
-std::array<float,2>{0.647761881f, 0.0799833685f},
-std::array<float,2>{0.129595965f, 0.69860667f},
-std::array<float,2>{0.0805796608f, 0.225494966f},
-std::array<float,2>{0.536701739f, 0.561154306f},
-std::array<float,2>{0.981716216f, 0.261453748f},
-std::array<float,2>{0.44445473f, 0.944495976f},
-std::array<float,2>{0.0623283461f, 0.4516792f},
-std::array<float,2>{0.56277436f, 0.787071586f},
-std::array<float,2>{0.930014074f, 0.0122771095f},
-std::array<float,2>{0.410686165f, 0.661440849f},
-std::array<float,2>{0.348912209f, 0.150310442f},
-std::array<float,2>{0.76434648f, 0.578260899f},
-std::array<float,2>{0.705611885f, 0.314430982f},
-std::array<float,2>{0.229824722f, 0.888054073f},
-std::array<float,2>{0.485484987f, 0.30012697f},
-std::array<float,2>{0.939383805f, 0.976166368f},
-std::array<float,2>{0.502935171f, 0.209840342f},
-std::array<float,2>{0.101034105f, 0.514447987f},
-std::array<float,2>{0.165078133f, 0.0957585052f},
-std::array<float,2>{0.658007741f, 0.726449251f},
-std::array<float,2>{0.816920221f, 0.3898727f},
-std::array<float,2>{0.28998816f, 0.84651804f},
-std::array<float,2>{0.142888442f, 0.396611452f},
-std::array<float,2>{0.636166036f, 0.870098233f},
-std::array<float,2>{0.847293675f, 0.115843095f},
-std::array<float,2>{0.257708102f, 0.741364658f},
-std::array<float,2>{0.455120832f, 0.201614365f},
-std::array<float,2>{0.991248608f, 0.519564033f},
-std::array<float,2>{0.554278791f, 0.282439321f},
-std::array<float,2>{0.0715856478f, 0.99450767f},
-std::array<float,2>{0.325003564f, 0.343111664f},
-std::array<float,2>{0.798187196f, 0.905745625f},
-std::array<float,2>{0.734072447f, 0.139844328f},
-std::array<float,2>{0.201157272f, 0.570205092f},
-std::array<float,2>{0.0241849087f, 0.0215334035f},
-std::array<float,2>{0.621635258f, 0.676067352f},
-std::array<float,2>{0.893712461f, 0.463074535f},
-std::array<float,2>{0.401457697f, 0.808300495f},
-std::array<float,2>{0.119569883f, 0.278048068f},
-std::array<float,2>{0.525223672f, 0.957182288f},
-std::array<float,2>{0.966998756f, 0.239684671f},
-std::array<float,2>{0.470199257f, 0.539845288f},
-std::array<float,2>{0.306924939f, 0.0636219978f},
-std::array<float,2>{0.840618789f, 0.705972016f},
-std::array<float,2>{0.68127811f, 0.414150596f},
-std::array<float,2>{0.175263196f, 0.839953244f},
-std::array<float,2>{0.424990505f, 0.46941033f},
-std::array<float,2>{0.913665235f, 0.766852736f},
-std::array<float,2>{0.581577539f, 0.0435182452f},
-std::array<float,2>{0.0388497971f, 0.643936157f},
-std::array<float,2>{0.246148318f, 0.179880843f},
-std::array<float,2>{0.698035717f, 0.604697049f},
-std::array<float,2>{0.774033606f, 0.360514522f},
-std::array<float,2>{0.361596942f, 0.916552544f},
-std::array<float,2>{0.238661706f, 0.263379008f},
-std::array<float,2>{0.687984228f, 0.941375852f},
-std::array<float,2>{0.771098793f, 0.222110912f},
-std::array<float,2>{0.374394327f, 0.558079183f},
-std::array<float,2>{0.432700098f, 0.0828900859f},
-std::array<float,2>{0.914559245f, 0.700321376f},
-std::array<float,2>{0.591402173f, 0.43401435f},
-std::array<float,2>{0.0408837982f, 0.819391191f},
-std::array<float,2>{0.304120839f, 0.498362899f},
-std::array<float,2>{0.833535075f, 0.751081407f},
-std::array<float,2>{0.679128945f, 0.0542050414f},
-std::array<float,2>{0.183818087f, 0.632808864f},
-std::array<float,2>{0.116280325f, 0.159909323f},
-std::array<float,2>{0.517747462f, 0.617841601f},
-std::array<float,2>{0.955049813f, 0.355203956f},
-std::array<float,2>{0.48022899f, 0.932634473f},
-std::array<float,2>{0.0192467459f, 0.38425377f},
-std::array<float,2>{0.613735437f, 0.85034436f},
-std::array<float,2>{0.901944578f, 0.0983482972f},
-std::array<float,2>{0.391269147f, 0.721034169f},
-std::array<float,2>{0.316072136f, 0.203551501f},
-std::array<float,2>{0.812078595f, 0.508034885f},
-std::array<float,2>{0.719409227f, 0.304033875f},
-std::array<float,2>{0.188215777f, 0.971381664f},
-std::array<float,2>{0.465546697f, 0.316832721f},
-std::array<float,2>{0.994519889f, 0.886287153f},
-std::array<float,2>{0.558331192f, 0.154554531f},
-std::array<float,2>{0.0699653476f, 0.583589017f},
-std::array<float,2>{0.154814944f, 0.0115851471f},
-std::array<float,2>{0.630125821f, 0.658294976f},
-std::array<float,2>{0.85638243f, 0.445712388f},
-std::array<float,2>{0.263624996f, 0.782470405f},
-std::array<float,2>{0.162066966f, 0.467178971f},
-std::array<float,2>{0.666968405f, 0.810657918f},
-std::array<float,2>{0.822884262f, 0.018329272f},
-std::array<float,2>{0.283341438f, 0.673986435f},
-std::array<float,2>{0.493926138f, 0.133581713f},
-std::array<float,2>{0.950561881f, 0.564382672f},
-std::array<float,2>{0.514040411f, 0.336370677f},
-std::array<float,2>{0.104075387f, 0.901450157f},
-std::array<float,2>{0.352118611f, 0.286098093f},
-std::array<float,2>{0.752322495f, 0.998649478f},
-std::array<float,2>{0.718053818f, 0.195808947f},
-std::array<float,2>{0.224511653f, 0.516641855f},
-std::array<float,2>{0.0493528694f, 0.110818408f},
-std::array<float,2>{0.576858699f, 0.73745352f},
-std::array<float,2>{0.922956109f, 0.391691655f},
-std::array<float,2>{0.41708079f, 0.871739507f},
-std::array<float,2>{0.0887924358f, 0.364367932f},
-std::array<float,2>{0.541657865f, 0.92097652f},
-std::array<float,2>{0.970978737f, 0.186259568f},
-std::array<float,2>{0.452896595f, 0.60768038f},
-std::array<float,2>{0.280679673f, 0.042624224f},
-std::array<float,2>{0.871267617f, 0.647721708f},
-std::array<float,2>{0.648593366f, 0.474143773f},
-std::array<float,2>{0.134205282f, 0.772924483f},
-std::array<float,2>{0.381381005f, 0.418123245f},
-std::array<float,2>{0.878041148f, 0.837705493f},
-std::array<float,2>{0.603110969f, 0.0680975169f},
-std::array<float,2>{0.0094483085f, 0.71089226f},
-std::array<float,2>{0.208235458f, 0.237011462f},
-std::array<float,2>{0.741107821f, 0.54579407f},
-std::array<float,2>{0.789627314f, 0.277189732f},
-std::array<float,2>{0.333445668f, 0.956929088f},
-std::array<float,2>{0.126097888f, 0.329463989f},
-std::array<float,2>{0.643778145f, 0.896793187f},
-std::array<float,2>{0.865019023f, 0.131060123f},
-std::array<float,2>{0.266311973f, 0.577169359f},
-std::array<float,2>{0.439414471f, 0.0246132426f},
-std::array<float,2>{0.977959216f, 0.683726132f},
-std::array<float,2>{0.531438172f, 0.45989576f},
-std::array<float,2>{0.0847194046f, 0.800233006f},
-std::array<float,2>{0.340893745f, 0.401900977f},
-std::array<float,2>{0.781749129f, 0.859464705f},
-std::array<float,2>{0.748653233f, 0.117582649f},
-std::array<float,2>{0.212973073f, 0.747399986f},
-std::array<float,2>{0.00470122788f, 0.188524276f},
-std::array<float,2>{0.597313583f, 0.527097344f},
-std::array<float,2>{0.88392812f, 0.296739966f},
-std::array<float,2>{0.388834357f, 0.9844594f},
-std::array<float,2>{0.0949130729f, 0.479814351f},
-std::array<float,2>{0.507047296f, 0.781238794f},
-std::array<float,2>{0.941847861f, 0.0365547389f},
-std::array<float,2>{0.488426775f, 0.652725577f},
-std::array<float,2>{0.295176446f, 0.178924173f},
-std::array<float,2>{0.814967573f, 0.598905921f},
-std::array<float,2>{0.661954224f, 0.369264752f},
-std::array<float,2>{0.169559225f, 0.910168529f},
-std::array<float,2>{0.409355789f, 0.2714836f},
-std::array<float,2>{0.934357524f, 0.961992204f},
-std::array<float,2>{0.567780256f, 0.245484754f},
-std::array<float,2>{0.0558999516f, 0.532446742f},
-std::array<float,2>{0.233244076f, 0.0708313361f},
-std::array<float,2>{0.709493458f, 0.716519535f},
-std::array<float,2>{0.76104629f, 0.407048941f},
-std::array<float,2>{0.346573591f, 0.834425509f},
-std::array<float,2>{0.197407797f, 0.426364332f},
-std::array<float,2>{0.729833424f, 0.82683748f},
-std::array<float,2>{0.802635252f, 0.091760315f},
-std::array<float,2>{0.321053326f, 0.694419384f},
-std::array<float,2>{0.404134601f, 0.232369259f},
-std::array<float,2>{0.897642195f, 0.549680591f},
-std::array<float,2>{0.619874358f, 0.252815962f},
-std::array<float,2>{0.030957533f, 0.951764703f},
-std::array<float,2>{0.252742708f, 0.347210288f},
-std::array<float,2>{0.8511374f, 0.922201097f},
-std::array<float,2>{0.63747263f, 0.171065986f},
-std::array<float,2>{0.148415938f, 0.611708164f},
-std::array<float,2>{0.074382104f, 0.0613347031f},
-std::array<float,2>{0.548828959f, 0.639110804f},
-std::array<float,2>{0.985909164f, 0.490948409f},
-std::array<float,2>{0.459231466f, 0.759152591f},
-std::array<float,2>{0.0319643952f, 0.308241069f},
-std::array<float,2>{0.585289538f, 0.980697632f},
-std::array<float,2>{0.906781971f, 0.214094862f},
-std::array<float,2>{0.426300734f, 0.502765536f},
-std::array<float,2>{0.363550603f, 0.102140315f},
-std::array<float,2>{0.778817832f, 0.733586848f},
-std::array<float,2>{0.70242691f, 0.377714157f},
-std::array<float,2>{0.245346993f, 0.854297996f},
-std::array<float,2>{0.476076216f, 0.443782032f},
-std::array<float,2>{0.963058531f, 0.793462336f},
-std::array<float,2>{0.530687511f, 0.00677749701f},
-std::array<float,2>{0.121152371f, 0.667406321f},
-std::array<float,2>{0.175862208f, 0.147922456f},
-std::array<float,2>{0.686911643f, 0.589376509f},
-std::array<float,2>{0.838561416f, 0.325292081f},
-std::array<float,2>{0.310769767f, 0.876947045f},
-std::array<float,2>{0.156754032f, 0.257662147f},
-std::array<float,2>{0.671056986f, 0.94891715f},
-std::array<float,2>{0.825149953f, 0.226965949f},
-std::array<float,2>{0.287810385f, 0.554039419f},
-std::array<float,2>{0.497716844f, 0.0881384909f},
-std::array<float,2>{0.947562993f, 0.689100981f},
-std::array<float,2>{0.508074224f, 0.422156364f},
-std::array<float,2>{0.108241767f, 0.823231816f},
-std::array<float,2>{0.35711804f, 0.486247689f},
-std::array<float,2>{0.75607115f, 0.76540184f},
-std::array<float,2>{0.712356269f, 0.0550893173f},
-std::array<float,2>{0.221648589f, 0.633360624f},
-std::array<float,2>{0.0517140143f, 0.165872335f},
-std::array<float,2>{0.573666751f, 0.615931749f},
-std::array<float,2>{0.928579271f, 0.348707855f},
-std::array<float,2>{0.419095755f, 0.928895891f},
-std::array<float,2>{0.0920180082f, 0.379282326f},
-std::array<float,2>{0.545431674f, 0.855507314f},
-std::array<float,2>{0.974094093f, 0.106799826f},
-std::array<float,2>{0.447404951f, 0.729639471f},
-std::array<float,2>{0.273559451f, 0.217356101f},
-std::array<float,2>{0.870343268f, 0.507353306f},
-std::array<float,2>{0.654204905f, 0.312490851f},
-std::array<float,2>{0.138103157f, 0.979577959f},
-std::array<float,2>{0.378704101f, 0.320512861f},
-std::array<float,2>{0.880363405f, 0.882752657f},
-std::array<float,2>{0.606277943f, 0.144197822f},
-std::array<float,2>{0.0142273419f, 0.590399742f},
-std::array<float,2>{0.205887124f, 0.00156944187f},
-std::array<float,2>{0.73631525f, 0.670113802f},
-std::array<float,2>{0.794403493f, 0.441043317f},
-std::array<float,2>{0.331047952f, 0.791119039f},
-std::array<float,2>{0.234456629f, 0.455008239f},
-std::array<float,2>{0.694586873f, 0.802010775f},
-std::array<float,2>{0.768236458f, 0.0282690655f},
-std::array<float,2>{0.370800704f, 0.680593014f},
-std::array<float,2>{0.43363589f, 0.127828717f},
-std::array<float,2>{0.91970408f, 0.571285307f},
-std::array<float,2>{0.587159276f, 0.333942145f},
-std::array<float,2>{0.0433364846f, 0.893692553f},
-std::array<float,2>{0.298282921f, 0.290350974f},
-std::array<float,2>{0.831685126f, 0.98870939f},
-std::array<float,2>{0.672968328f, 0.193597451f},
-std::array<float,2>{0.179753795f, 0.527904332f},
-std::array<float,2>{0.111343525f, 0.123314209f},
-std::array<float,2>{0.519836605f, 0.74276185f},
-std::array<float,2>{0.959446132f, 0.406084657f},
-std::array<float,2>{0.482679248f, 0.86698252f},
-std::array<float,2>{0.0227587372f, 0.373139501f},
-std::array<float,2>{0.611899197f, 0.908470273f},
-std::array<float,2>{0.9040007f, 0.172137469f},
-std::array<float,2>{0.396758318f, 0.594021559f},
-std::array<float,2>{0.32029292f, 0.0318373702f},
-std::array<float,2>{0.805681765f, 0.652131498f},
-std::array<float,2>{0.72519654f, 0.481303513f},
-std::array<float,2>{0.191529974f, 0.775961876f},
-std::array<float,2>{0.461005539f, 0.410945445f},
-std::array<float,2>{0.997977674f, 0.831976056f},
-std::array<float,2>{0.559046328f, 0.0779702067f},
-std::array<float,2>{0.0645047352f, 0.711147964f},
-std::array<float,2>{0.150012061f, 0.246591404f},
-std::array<float,2>{0.626481354f, 0.53712517f},
-std::array<float,2>{0.853296697f, 0.268843561f},
-std::array<float,2>{0.258292496f, 0.967284501f},
-std::array<float,2>{0.199720129f, 0.340376228f},
-std::array<float,2>{0.733115554f, 0.903279364f},
-std::array<float,2>{0.796878397f, 0.138241634f},
-std::array<float,2>{0.325893134f, 0.568277538f},
-std::array<float,2>{0.40133357f, 0.0201487951f},
-std::array<float,2>{0.892975628f, 0.679025352f},
-std::array<float,2>{0.622186005f, 0.461544514f},
-std::array<float,2>{0.02520198f, 0.805199802f},
-std::array<float,2>{0.256524742f, 0.396133542f},
-std::array<float,2>{0.845973849f, 0.868525445f},
-std::array<float,2>{0.634820938f, 0.114981942f},
-std::array<float,2>{0.144010112f, 0.739394844f},
-std::array<float,2>{0.0710487142f, 0.200137436f},
-std::array<float,2>{0.553355277f, 0.523380637f},
-std::array<float,2>{0.990672767f, 0.283326268f},
-std::array<float,2>{0.456875533f, 0.993699551f},
-std::array<float,2>{0.0379714556f, 0.470736146f},
-std::array<float,2>{0.580663979f, 0.76904279f},
-std::array<float,2>{0.912962079f, 0.0455691703f},
-std::array<float,2>{0.42416051f, 0.642348588f},
-std::array<float,2>{0.363028646f, 0.182626739f},
-std::array<float,2>{0.774419069f, 0.602723598f},
-std::array<float,2>{0.698575377f, 0.362112045f},
-std::array<float,2>{0.247395024f, 0.915815711f},
-std::array<float,2>{0.469325513f, 0.279978842f},
-std::array<float,2>{0.968427241f, 0.959441304f},
-std::array<float,2>{0.523514926f, 0.240803808f},
-std::array<float,2>{0.120874427f, 0.54140836f},
-std::array<float,2>{0.174525738f, 0.0657975227f},
-std::array<float,2>{0.679953337f, 0.704093874f},
-std::array<float,2>{0.840865552f, 0.417546183f},
-std::array<float,2>{0.308134556f, 0.84261775f},
-std::array<float,2>{0.129994094f, 0.430959761f},
-std::array<float,2>{0.647364497f, 0.814234674f},
-std::array<float,2>{0.860477269f, 0.0816272795f},
-std::array<float,2>{0.272025973f, 0.696596861f},
-std::array<float,2>{0.443420231f, 0.224146456f},
-std::array<float,2>{0.981042564f, 0.559463203f},
-std::array<float,2>{0.535407722f, 0.259341985f},
-std::array<float,2>{0.081085816f, 0.941519976f},
-std::array<float,2>{0.336006433f, 0.356161803f},
-std::array<float,2>{0.78820926f, 0.935041904f},
-std::array<float,2>{0.743798673f, 0.162887782f},
-std::array<float,2>{0.218445107f, 0.623850048f},
-std::array<float,2>{0.00315520726f, 0.0503644757f},
-std::array<float,2>{0.600939691f, 0.62735343f},
-std::array<float,2>{0.888286114f, 0.494758129f},
-std::array<float,2>{0.384213179f, 0.754355192f},
-std::array<float,2>{0.100549035f, 0.297199667f},
-std::array<float,2>{0.502625704f, 0.973883986f},
-std::array<float,2>{0.937899709f, 0.208550721f},
-std::array<float,2>{0.485107303f, 0.512212574f},
-std::array<float,2>{0.290139645f, 0.0950355008f},
-std::array<float,2>{0.817408085f, 0.722764134f},
-std::array<float,2>{0.657198727f, 0.387779057f},
-std::array<float,2>{0.164484829f, 0.844087839f},
-std::array<float,2>{0.411875576f, 0.449509799f},
-std::array<float,2>{0.931161761f, 0.788974285f},
-std::array<float,2>{0.564192057f, 0.0148534328f},
-std::array<float,2>{0.060776893f, 0.662811399f},
-std::array<float,2>{0.229292184f, 0.151113123f},
-std::array<float,2>{0.706213295f, 0.580183327f},
-std::array<float,2>{0.764729977f, 0.316297442f},
-std::array<float,2>{0.348622948f, 0.888678133f},
-std::array<float,2>{0.223219097f, 0.287845671f},
-std::array<float,2>{0.717771769f, 0.997460663f},
-std::array<float,2>{0.753791273f, 0.198295549f},
-std::array<float,2>{0.352739424f, 0.519038618f},
-std::array<float,2>{0.416396022f, 0.111676574f},
-std::array<float,2>{0.922224104f, 0.734851539f},
-std::array<float,2>{0.577722192f, 0.39258799f},
-std::array<float,2>{0.0499012768f, 0.873340428f},
-std::array<float,2>{0.284698308f, 0.466017812f},
-std::array<float,2>{0.823368013f, 0.808698833f},
-std::array<float,2>{0.667178094f, 0.0169880819f},
-std::array<float,2>{0.160838827f, 0.671987653f},
-std::array<float,2>{0.105298005f, 0.136240467f},
-std::array<float,2>{0.515614271f, 0.564564466f},
-std::array<float,2>{0.94986546f, 0.338792801f},
-std::array<float,2>{0.492329627f, 0.899072349f},
-std::array<float,2>{0.00812993757f, 0.421749413f},
-std::array<float,2>{0.60187453f, 0.838094056f},
-std::array<float,2>{0.87736237f, 0.0685888603f},
-std::array<float,2>{0.38193956f, 0.708726585f},
-std::array<float,2>{0.33211866f, 0.235047981f},
-std::array<float,2>{0.790449083f, 0.543632746f},
-std::array<float,2>{0.741912901f, 0.274818718f},
-std::array<float,2>{0.207736537f, 0.954265058f},
-std::array<float,2>{0.452043176f, 0.365275949f},
-std::array<float,2>{0.971794724f, 0.919812381f},
-std::array<float,2>{0.542054474f, 0.184707999f},
-std::array<float,2>{0.0890839249f, 0.606319845f},
-std::array<float,2>{0.133013874f, 0.0406935848f},
-std::array<float,2>{0.649889708f, 0.646269977f},
-std::array<float,2>{0.872187555f, 0.47566849f},
-std::array<float,2>{0.280077159f, 0.771315992f},
-std::array<float,2>{0.185054988f, 0.496675372f},
-std::array<float,2>{0.67868948f, 0.752317846f},
-std::array<float,2>{0.832200944f, 0.0524107069f},
-std::array<float,2>{0.303003967f, 0.628959477f},
-std::array<float,2>{0.478787273f, 0.157134429f},
-std::array<float,2>{0.953232467f, 0.620299041f},
-std::array<float,2>{0.518764377f, 0.35288316f},
-std::array<float,2>{0.115932293f, 0.930404782f},
-std::array<float,2>{0.373982579f, 0.263676226f},
-std::array<float,2>{0.769725978f, 0.937569022f},
-std::array<float,2>{0.688790321f, 0.220349282f},
-std::array<float,2>{0.239639327f, 0.556264281f},
-std::array<float,2>{0.0394488387f, 0.0843203813f},
-std::array<float,2>{0.590045273f, 0.702204406f},
-std::array<float,2>{0.915264904f, 0.436430991f},
-std::array<float,2>{0.431786746f, 0.817346394f},
-std::array<float,2>{0.0688448399f, 0.319092244f},
-std::array<float,2>{0.557038605f, 0.883868575f},
-std::array<float,2>{0.996059239f, 0.15262416f},
-std::array<float,2>{0.46632874f, 0.58476764f},
-std::array<float,2>{0.262003958f, 0.00831764843f},
-std::array<float,2>{0.856875241f, 0.657980084f},
-std::array<float,2>{0.628908873f, 0.448486626f},
-std::array<float,2>{0.156023115f, 0.784928799f},
-std::array<float,2>{0.392553031f, 0.385507524f},
-std::array<float,2>{0.900437534f, 0.849048972f},
-std::array<float,2>{0.614917696f, 0.100642905f},
-std::array<float,2>{0.0183666162f, 0.720579088f},
-std::array<float,2>{0.189127102f, 0.206874758f},
-std::array<float,2>{0.719888031f, 0.510219276f},
-std::array<float,2>{0.810912311f, 0.301305056f},
-std::array<float,2>{0.314561456f, 0.969715118f},
-std::array<float,2>{0.147445038f, 0.344748348f},
-std::array<float,2>{0.638011873f, 0.925703585f},
-std::array<float,2>{0.849683166f, 0.16917938f},
-std::array<float,2>{0.253705472f, 0.610856593f},
-std::array<float,2>{0.460859776f, 0.0592410602f},
-std::array<float,2>{0.985322118f, 0.638078451f},
-std::array<float,2>{0.550037503f, 0.48942256f},
-std::array<float,2>{0.0754008815f, 0.761615336f},
-std::array<float,2>{0.322189629f, 0.429294765f},
-std::array<float,2>{0.801009834f, 0.825258434f},
-std::array<float,2>{0.729006112f, 0.0923418477f},
-std::array<float,2>{0.199179247f, 0.692596495f},
-std::array<float,2>{0.0293308403f, 0.23397857f},
-std::array<float,2>{0.620503962f, 0.547413528f},
-std::array<float,2>{0.897139549f, 0.251262486f},
-std::array<float,2>{0.402805656f, 0.95060277f},
-std::array<float,2>{0.123005673f, 0.441454232f},
-std::array<float,2>{0.529873133f, 0.795690238f},
-std::array<float,2>{0.964067161f, 0.00528411195f},
-std::array<float,2>{0.475326777f, 0.664505124f},
-std::array<float,2>{0.311653256f, 0.145805866f},
-std::array<float,2>{0.838918984f, 0.587086976f},
-std::array<float,2>{0.685857832f, 0.326905757f},
-std::array<float,2>{0.177002519f, 0.877538204f},
-std::array<float,2>{0.427431792f, 0.305650413f},
-std::array<float,2>{0.907695293f, 0.984260976f},
-std::array<float,2>{0.584872127f, 0.211986497f},
-std::array<float,2>{0.0323173776f, 0.500521243f},
-std::array<float,2>{0.244349539f, 0.10438437f},
-std::array<float,2>{0.701833069f, 0.731755793f},
-std::array<float,2>{0.777712047f, 0.375799119f},
-std::array<float,2>{0.364426881f, 0.851790249f},
-std::array<float,2>{0.213952079f, 0.399411887f},
-std::array<float,2>{0.749858379f, 0.861986458f},
-std::array<float,2>{0.782550275f, 0.120306887f},
-std::array<float,2>{0.340180576f, 0.748197198f},
-std::array<float,2>{0.389927834f, 0.190922797f},
-std::array<float,2>{0.883081019f, 0.52464056f},
-std::array<float,2>{0.59635514f, 0.293080837f},
-std::array<float,2>{0.00530326832f, 0.988018036f},
-std::array<float,2>{0.26665023f, 0.331773728f},
-std::array<float,2>{0.863333106f, 0.895040035f},
-std::array<float,2>{0.643413961f, 0.13009572f},
-std::array<float,2>{0.125630066f, 0.57442838f},
-std::array<float,2>{0.0857192129f, 0.0256679114f},
-std::array<float,2>{0.533018053f, 0.686746895f},
-std::array<float,2>{0.977455556f, 0.457965612f},
-std::array<float,2>{0.438441873f, 0.798717082f},
-std::array<float,2>{0.0546948053f, 0.271713018f},
-std::array<float,2>{0.567080319f, 0.964747965f},
-std::array<float,2>{0.935492575f, 0.243884087f},
-std::array<float,2>{0.408476174f, 0.53424567f},
-std::array<float,2>{0.346804291f, 0.0740306005f},
-std::array<float,2>{0.760288298f, 0.71873337f},
-std::array<float,2>{0.710767806f, 0.409813106f},
-std::array<float,2>{0.233578816f, 0.832285702f},
-std::array<float,2>{0.490099043f, 0.478468388f},
-std::array<float,2>{0.943105578f, 0.778093934f},
-std::array<float,2>{0.506559074f, 0.03863452f},
-std::array<float,2>{0.0941586643f, 0.655534744f},
-std::array<float,2>{0.168374792f, 0.177092448f},
-std::array<float,2>{0.660710394f, 0.60134083f},
-std::array<float,2>{0.815655231f, 0.368869066f},
-std::array<float,2>{0.296755672f, 0.913475931f},
-std::array<float,2>{0.140155166f, 0.30913952f},
-std::array<float,2>{0.655889571f, 0.976753712f},
-std::array<float,2>{0.869010091f, 0.21595338f},
-std::array<float,2>{0.276112884f, 0.504269242f},
-std::array<float,2>{0.446554393f, 0.108282305f},
-std::array<float,2>{0.975154281f, 0.728086829f},
-std::array<float,2>{0.544683278f, 0.382621437f},
-std::array<float,2>{0.090734452f, 0.857518852f},
-std::array<float,2>{0.328347176f, 0.438183248f},
-std::array<float,2>{0.795629501f, 0.790515065f},
-std::array<float,2>{0.73784405f, 0.0029855913f},
-std::array<float,2>{0.204767764f, 0.668286741f},
-std::array<float,2>{0.0121754361f, 0.142189324f},
-std::array<float,2>{0.609240532f, 0.592829823f},
-std::array<float,2>{0.881628335f, 0.322963327f},
-std::array<float,2>{0.376363575f, 0.87990135f},
-std::array<float,2>{0.106011152f, 0.424751729f},
-std::array<float,2>{0.510786891f, 0.822140336f},
-std::array<float,2>{0.947121263f, 0.0860507116f},
-std::array<float,2>{0.499037862f, 0.690822899f},
-std::array<float,2>{0.286244482f, 0.229508385f},
-std::array<float,2>{0.826264679f, 0.551163077f},
-std::array<float,2>{0.66892004f, 0.254006594f},
-std::array<float,2>{0.158527523f, 0.945771873f},
-std::array<float,2>{0.420517683f, 0.350093186f},
-std::array<float,2>{0.926697671f, 0.926367581f},
-std::array<float,2>{0.571280003f, 0.167661533f},
-std::array<float,2>{0.0530658029f, 0.614473939f},
-std::array<float,2>{0.218882531f, 0.0575702451f},
-std::array<float,2>{0.713663936f, 0.63613838f},
-std::array<float,2>{0.754694283f, 0.486849457f},
-std::array<float,2>{0.358455479f, 0.763381183f},
-std::array<float,2>{0.194130927f, 0.483272374f},
-std::array<float,2>{0.722915292f, 0.774462223f},
-std::array<float,2>{0.806989849f, 0.0335943103f},
-std::array<float,2>{0.317582905f, 0.649169624f},
-std::array<float,2>{0.394941896f, 0.17491658f},
-std::array<float,2>{0.906025171f, 0.595823646f},
-std::array<float,2>{0.609821796f, 0.371514738f},
-std::array<float,2>{0.0207371432f, 0.907620668f},
-std::array<float,2>{0.260390937f, 0.265978992f},
-std::array<float,2>{0.854273856f, 0.966005445f},
-std::array<float,2>{0.627112865f, 0.248255625f},
-std::array<float,2>{0.150922358f, 0.536996126f},
-std::array<float,2>{0.0630249679f, 0.0746427327f},
-std::array<float,2>{0.561583817f, 0.713968933f},
-std::array<float,2>{0.999000907f, 0.41267097f},
-std::array<float,2>{0.46354723f, 0.829062998f},
-std::array<float,2>{0.0453620479f, 0.334098577f},
-std::array<float,2>{0.589651406f, 0.892482042f},
-std::array<float,2>{0.920222282f, 0.125784874f},
-std::array<float,2>{0.436920941f, 0.573935747f},
-std::array<float,2>{0.36891675f, 0.0294349045f},
-std::array<float,2>{0.767563462f, 0.682814121f},
-std::array<float,2>{0.692784548f, 0.456951082f},
-std::array<float,2>{0.238050327f, 0.804679811f},
-std::array<float,2>{0.480769068f, 0.402558088f},
-std::array<float,2>{0.958791614f, 0.864159703f},
-std::array<float,2>{0.522730887f, 0.121934541f},
-std::array<float,2>{0.11049746f, 0.745558918f},
-std::array<float,2>{0.1821924f, 0.192461371f},
-std::array<float,2>{0.675649285f, 0.52998513f},
-std::array<float,2>{0.82960242f, 0.291550249f},
-std::array<float,2>{0.300450295f, 0.991924167f},
-std::array<float,2>{0.248468414f, 0.359780163f},
-std::array<float,2>{0.697145581f, 0.917833507f},
-std::array<float,2>{0.776920617f, 0.181350663f},
-std::array<float,2>{0.360577345f, 0.604148567f},
-std::array<float,2>{0.42338711f, 0.0446428768f},
-std::array<float,2>{0.911694825f, 0.642912507f},
-std::array<float,2>{0.578671277f, 0.469889432f},
-std::array<float,2>{0.0357833877f, 0.76627183f},
-std::array<float,2>{0.305189729f, 0.415825695f},
-std::array<float,2>{0.843196869f, 0.841511726f},
-std::array<float,2>{0.683282912f, 0.0630936921f},
-std::array<float,2>{0.172706321f, 0.70636785f},
-std::array<float,2>{0.119103625f, 0.238597229f},
-std::array<float,2>{0.526612699f, 0.540862799f},
-std::array<float,2>{0.965425313f, 0.279199004f},
-std::array<float,2>{0.47123152f, 0.958870471f},
-std::array<float,2>{0.0269169994f, 0.464614987f},
-std::array<float,2>{0.624109745f, 0.807221591f},
-std::array<float,2>{0.892139971f, 0.0229631215f},
-std::array<float,2>{0.399294525f, 0.677630007f},
-std::array<float,2>{0.328050345f, 0.139286995f},
-std::array<float,2>{0.79964304f, 0.568405271f},
-std::array<float,2>{0.732322335f, 0.342079222f},
-std::array<float,2>{0.201379925f, 0.904790223f},
-std::array<float,2>{0.453498393f, 0.281533509f},
-std::array<float,2>{0.988421142f, 0.996055543f},
-std::array<float,2>{0.551118135f, 0.202806115f},
-std::array<float,2>{0.0734904259f, 0.521438301f},
-std::array<float,2>{0.141798347f, 0.116271727f},
-std::array<float,2>{0.634034038f, 0.740410566f},
-std::array<float,2>{0.845573962f, 0.397848934f},
-std::array<float,2>{0.255381703f, 0.87031585f},
-std::array<float,2>{0.16681996f, 0.389230192f},
-std::array<float,2>{0.660100639f, 0.847274363f},
-std::array<float,2>{0.818705857f, 0.0971918553f},
-std::array<float,2>{0.292366266f, 0.725304544f},
-std::array<float,2>{0.487363666f, 0.21048291f},
-std::array<float,2>{0.940402746f, 0.51528728f},
-std::array<float,2>{0.500356853f, 0.299579352f},
-std::array<float,2>{0.0988472626f, 0.975495338f},
-std::array<float,2>{0.3504695f, 0.313444555f},
-std::array<float,2>{0.762074053f, 0.886737883f},
-std::array<float,2>{0.70345968f, 0.148983672f},
-std::array<float,2>{0.227167428f, 0.579273105f},
-std::array<float,2>{0.0588544384f, 0.0134558501f},
-std::array<float,2>{0.566081226f, 0.660282373f},
-std::array<float,2>{0.933374703f, 0.452564418f},
-std::array<float,2>{0.413973242f, 0.785765588f},
-std::array<float,2>{0.0800364763f, 0.260699421f},
-std::array<float,2>{0.53828758f, 0.943600059f},
-std::array<float,2>{0.982611299f, 0.225854844f},
-std::array<float,2>{0.442886204f, 0.56185025f},
-std::array<float,2>{0.269687742f, 0.0781448781f},
-std::array<float,2>{0.862046003f, 0.697287202f},
-std::array<float,2>{0.645384431f, 0.431872666f},
-std::array<float,2>{0.131995589f, 0.814591289f},
-std::array<float,2>{0.385532945f, 0.493778288f},
-std::array<float,2>{0.890580595f, 0.757799208f},
-std::array<float,2>{0.59934938f, 0.0479841232f},
-std::array<float,2>{0.00123281556f, 0.626906872f},
-std::array<float,2>{0.21547471f, 0.161213741f},
-std::array<float,2>{0.744556904f, 0.621492863f},
-std::array<float,2>{0.785836577f, 0.357702821f},
-std::array<float,2>{0.338212192f, 0.936042428f},
-std::array<float,2>{0.21040307f, 0.275645614f},
-std::array<float,2>{0.738485217f, 0.955571234f},
-std::array<float,2>{0.792520225f, 0.237584487f},
-std::array<float,2>{0.334579766f, 0.546573877f},
-std::array<float,2>{0.379180163f, 0.0673340484f},
-std::array<float,2>{0.876843691f, 0.709868848f},
-std::array<float,2>{0.604608774f, 0.41907382f},
-std::array<float,2>{0.00982279796f, 0.836141765f},
-std::array<float,2>{0.278295815f, 0.473383069f},
-std::array<float,2>{0.874304891f, 0.772082925f},
-std::array<float,2>{0.651525855f, 0.0416618958f},
-std::array<float,2>{0.136168882f, 0.646863401f},
-std::array<float,2>{0.0860946998f, 0.186732218f},
-std::array<float,2>{0.539260089f, 0.609062135f},
-std::array<float,2>{0.97016114f, 0.364122003f},
-std::array<float,2>{0.450690866f, 0.920155287f},
-std::array<float,2>{0.046940513f, 0.391512543f},
-std::array<float,2>{0.575925112f, 0.872357666f},
-std::array<float,2>{0.925375104f, 0.110167921f},
-std::array<float,2>{0.41452229f, 0.736716568f},
-std::array<float,2>{0.354778439f, 0.197093993f},
-std::array<float,2>{0.750259936f, 0.515999436f},
-std::array<float,2>{0.716364741f, 0.286578447f},
-std::array<float,2>{0.226183951f, 0.99953115f},
-std::array<float,2>{0.494245142f, 0.337589413f},
-std::array<float,2>{0.951904178f, 0.900566638f},
-std::array<float,2>{0.513182163f, 0.134040803f},
-std::array<float,2>{0.101645313f, 0.562635243f},
-std::array<float,2>{0.16392976f, 0.0189491585f},
-std::array<float,2>{0.664752305f, 0.675692439f},
-std::array<float,2>{0.822169006f, 0.468190551f},
-std::array<float,2>{0.281570494f, 0.812117815f},
-std::array<float,2>{0.152391657f, 0.447254777f},
-std::array<float,2>{0.632382512f, 0.781900585f},
-std::array<float,2>{0.857908368f, 0.0106366565f},
-std::array<float,2>{0.263704866f, 0.65941292f},
-std::array<float,2>{0.467309952f, 0.155776069f},
-std::array<float,2>{0.99352634f, 0.582800329f},
-std::array<float,2>{0.556563735f, 0.318219036f},
-std::array<float,2>{0.0681412145f, 0.884815574f},
-std::array<float,2>{0.312572658f, 0.303630978f},
-std::array<float,2>{0.810350657f, 0.97233659f},
-std::array<float,2>{0.721036077f, 0.204589471f},
-std::array<float,2>{0.190123439f, 0.508968115f},
-std::array<float,2>{0.0166067965f, 0.0988408849f},
-std::array<float,2>{0.616103649f, 0.722221375f},
-std::array<float,2>{0.898908079f, 0.382828176f},
-std::array<float,2>{0.39289242f, 0.851323128f},
-std::array<float,2>{0.114294618f, 0.353905678f},
-std::array<float,2>{0.516536474f, 0.932104826f},
-std::array<float,2>{0.95625031f, 0.158993244f},
-std::array<float,2>{0.476686329f, 0.61893481f},
-std::array<float,2>{0.301640898f, 0.0527406223f},
-std::array<float,2>{0.834286809f, 0.631448627f},
-std::array<float,2>{0.676023066f, 0.499290049f},
-std::array<float,2>{0.186833188f, 0.750421524f},
-std::array<float,2>{0.431138128f, 0.435300022f},
-std::array<float,2>{0.916036665f, 0.818700016f},
-std::array<float,2>{0.591917336f, 0.0830977857f},
-std::array<float,2>{0.0416369289f, 0.69967258f},
-std::array<float,2>{0.241398677f, 0.22092782f},
-std::array<float,2>{0.689605236f, 0.557485461f},
-std::array<float,2>{0.772347212f, 0.262025744f},
-std::array<float,2>{0.371415943f, 0.940299749f},
-std::array<float,2>{0.1788591f, 0.324328363f},
-std::array<float,2>{0.685546458f, 0.875185609f},
-std::array<float,2>{0.837089956f, 0.146570787f},
-std::array<float,2>{0.309632242f, 0.588701069f},
-std::array<float,2>{0.474595934f, 0.00754309678f},
-std::array<float,2>{0.960957944f, 0.666618943f},
-std::array<float,2>{0.527707517f, 0.445204735f},
-std::array<float,2>{0.12440981f, 0.794506848f},
-std::array<float,2>{0.366772175f, 0.378438383f},
-std::array<float,2>{0.779465854f, 0.854585409f},
-std::array<float,2>{0.700893104f, 0.102701865f},
-std::array<float,2>{0.242377818f, 0.732662022f},
-std::array<float,2>{0.0347503796f, 0.213015273f},
-std::array<float,2>{0.582780361f, 0.503775775f},
-std::array<float,2>{0.910033643f, 0.307402819f},
-std::array<float,2>{0.427922964f, 0.981979728f},
-std::array<float,2>{0.0766522288f, 0.491615057f},
-std::array<float,2>{0.548219919f, 0.757814765f},
-std::array<float,2>{0.988272369f, 0.0619694367f},
-std::array<float,2>{0.457849413f, 0.639778554f},
-std::array<float,2>{0.250723422f, 0.170298636f},
-std::array<float,2>{0.848973334f, 0.612709761f},
-std::array<float,2>{0.639205456f, 0.346192569f},
-std::array<float,2>{0.144782394f, 0.922957957f},
-std::array<float,2>{0.404566258f, 0.253160506f},
-std::array<float,2>{0.894878745f, 0.952370405f},
-std::array<float,2>{0.61767894f, 0.230877563f},
-std::array<float,2>{0.0289767049f, 0.549844623f},
-std::array<float,2>{0.196042642f, 0.0898962319f},
-std::array<float,2>{0.728168666f, 0.694313586f},
-std::array<float,2>{0.804372609f, 0.427313983f},
-std::array<float,2>{0.323366433f, 0.828073323f},
-std::array<float,2>{0.231399477f, 0.407470167f},
-std::array<float,2>{0.707269728f, 0.835803866f},
-std::array<float,2>{0.759527981f, 0.0715426952f},
-std::array<float,2>{0.344508052f, 0.715515196f},
-std::array<float,2>{0.407240331f, 0.244833872f},
-std::array<float,2>{0.935666442f, 0.53145957f},
-std::array<float,2>{0.569748461f, 0.26977092f},
-std::array<float,2>{0.0567486621f, 0.961198032f},
-std::array<float,2>{0.293100357f, 0.370292544f},
-std::array<float,2>{0.813862979f, 0.911702693f},
-std::array<float,2>{0.663842618f, 0.17773591f},
-std::array<float,2>{0.171797484f, 0.598122418f},
-std::array<float,2>{0.0963953808f, 0.0355976783f},
-std::array<float,2>{0.505207598f, 0.653969526f},
-std::array<float,2>{0.943677902f, 0.478905737f},
-std::array<float,2>{0.491824031f, 0.779846549f},
-std::array<float,2>{0.0059875031f, 0.295425296f},
-std::array<float,2>{0.5948053f, 0.985992312f},
-std::array<float,2>{0.885234773f, 0.187879235f},
-std::array<float,2>{0.387899339f, 0.526091874f},
-std::array<float,2>{0.343296885f, 0.119103745f},
-std::array<float,2>{0.784573674f, 0.746200979f},
-std::array<float,2>{0.746768892f, 0.400761634f},
-std::array<float,2>{0.212061748f, 0.860732555f},
-std::array<float,2>{0.43949613f, 0.460626543f},
-std::array<float,2>{0.979829311f, 0.799687147f},
-std::array<float,2>{0.533959627f, 0.0241071898f},
-std::array<float,2>{0.0836630315f, 0.684658289f},
-std::array<float,2>{0.127363682f, 0.131933212f},
-std::array<float,2>{0.642025173f, 0.576242983f},
-std::array<float,2>{0.866638184f, 0.328708678f},
-std::array<float,2>{0.269405156f, 0.897920072f},
-std::array<float,2>{0.13262625f, 0.259205759f},
-std::array<float,2>{0.644827425f, 0.942235649f},
-std::array<float,2>{0.861513376f, 0.22380504f},
-std::array<float,2>{0.270325482f, 0.559027255f},
-std::array<float,2>{0.442545742f, 0.0811047778f},
-std::array<float,2>{0.983202934f, 0.697214901f},
-std::array<float,2>{0.538974226f, 0.431472033f},
-std::array<float,2>{0.0793066472f, 0.81351012f},
-std::array<float,2>{0.338751912f, 0.494198442f},
-std::array<float,2>{0.785354912f, 0.754509568f},
-std::array<float,2>{0.74468869f, 0.0498804115f},
-std::array<float,2>{0.214895487f, 0.627698958f},
-std::array<float,2>{0.00194356416f, 0.162296399f},
-std::array<float,2>{0.598935187f, 0.62340492f},
-std::array<float,2>{0.889687657f, 0.355635822f},
-std::array<float,2>{0.384777635f, 0.935410976f},
-std::array<float,2>{0.0993048549f, 0.38844341f},
-std::array<float,2>{0.500840306f, 0.844344318f},
-std::array<float,2>{0.939688265f, 0.0952877253f},
-std::array<float,2>{0.48817715f, 0.723262012f},
-std::array<float,2>{0.292757779f, 0.208484679f},
-std::array<float,2>{0.818958521f, 0.511723459f},
-std::array<float,2>{0.659294486f, 0.297705501f},
-std::array<float,2>{0.166383073f, 0.974360704f},
-std::array<float,2>{0.413228124f, 0.315449864f},
-std::array<float,2>{0.932704151f, 0.889209092f},
-std::array<float,2>{0.565651774f, 0.150528148f},
-std::array<float,2>{0.0595121011f, 0.581000447f},
-std::array<float,2>{0.226932317f, 0.0155461095f},
-std::array<float,2>{0.703778028f, 0.662324667f},
-std::array<float,2>{0.762443602f, 0.449955732f},
-std::array<float,2>{0.349918365f, 0.788550258f},
-std::array<float,2>{0.20195815f, 0.461420447f},
-std::array<float,2>{0.731615424f, 0.80472976f},
-std::array<float,2>{0.799098015f, 0.0196802206f},
-std::array<float,2>{0.327432334f, 0.679223537f},
-std::array<float,2>{0.398771793f, 0.138015613f},
-std::array<float,2>{0.891903758f, 0.567490578f},
-std::array<float,2>{0.624635339f, 0.339996099f},
-std::array<float,2>{0.0265047923f, 0.902620614f},
-std::array<float,2>{0.255366981f, 0.284049988f},
-std::array<float,2>{0.844811738f, 0.993250072f},
-std::array<float,2>{0.63434571f, 0.199402794f},
-std::array<float,2>{0.142253861f, 0.522814333f},
-std::array<float,2>{0.073993586f, 0.114458829f},
-std::array<float,2>{0.551643848f, 0.740209579f},
-std::array<float,2>{0.988917768f, 0.395863503f},
-std::array<float,2>{0.453701586f, 0.868763268f},
-std::array<float,2>{0.0355384275f, 0.361751676f},
-std::array<float,2>{0.578200579f, 0.915338576f},
-std::array<float,2>{0.911465645f, 0.183328494f},
-std::array<float,2>{0.42304194f, 0.603147388f},
-std::array<float,2>{0.361068428f, 0.0451009683f},
-std::array<float,2>{0.776465535f, 0.641815126f},
-std::array<float,2>{0.696419239f, 0.471498311f},
-std::array<float,2>{0.248797581f, 0.769113064f},
-std::array<float,2>{0.471155941f, 0.417144537f},
-std::array<float,2>{0.964972913f, 0.842056572f},
-std::array<float,2>{0.52733165f, 0.0659774616f},
-std::array<float,2>{0.118338607f, 0.703164101f},
-std::array<float,2>{0.172019795f, 0.240584239f},
-std::array<float,2>{0.682846785f, 0.541913569f},
-std::array<float,2>{0.843322515f, 0.279735863f},
-std::array<float,2>{0.30492726f, 0.959785044f},
-std::array<float,2>{0.237641752f, 0.333464533f},
-std::array<float,2>{0.693216681f, 0.894254863f},
-std::array<float,2>{0.766936958f, 0.12733379f},
-std::array<float,2>{0.368361175f, 0.57075727f},
-std::array<float,2>{0.437190264f, 0.0274314303f},
-std::array<float,2>{0.920850396f, 0.680079579f},
-std::array<float,2>{0.589199662f, 0.454408616f},
-std::array<float,2>{0.0454273485f, 0.802562296f},
-std::array<float,2>{0.300260663f, 0.405385494f},
-std::array<float,2>{0.829427302f, 0.86623323f},
-std::array<float,2>{0.675106406f, 0.123950429f},
-std::array<float,2>{0.18186833f, 0.742604434f},
-std::array<float,2>{0.110852979f, 0.194080129f},
-std::array<float,2>{0.523273289f, 0.52760756f},
-std::array<float,2>{0.958052039f, 0.290992081f},
-std::array<float,2>{0.481053233f, 0.989147544f},
-std::array<float,2>{0.0214149039f, 0.480787575f},
-std::array<float,2>{0.610146105f, 0.775520563f},
-std::array<float,2>{0.905569017f, 0.0313334726f},
-std::array<float,2>{0.395091474f, 0.651417911f},
-std::array<float,2>{0.317971408f, 0.172686726f},
-std::array<float,2>{0.807579219f, 0.594350219f},
-std::array<float,2>{0.72318238f, 0.373864114f},
-std::array<float,2>{0.193539515f, 0.908861578f},
-std::array<float,2>{0.46314621f, 0.269125372f},
-std::array<float,2>{0.998475134f, 0.96767503f},
-std::array<float,2>{0.562466621f, 0.246486947f},
-std::array<float,2>{0.0627038181f, 0.537665963f},
-std::array<float,2>{0.15044494f, 0.0771503672f},
-std::array<float,2>{0.627869546f, 0.711699367f},
-std::array<float,2>{0.853921235f, 0.410542071f},
-std::array<float,2>{0.259966671f, 0.831062913f},
-std::array<float,2>{0.158872873f, 0.422563791f},
-std::array<float,2>{0.668075383f, 0.822329938f},
-std::array<float,2>{0.826669395f, 0.0887390301f},
-std::array<float,2>{0.287004948f, 0.688743889f},
-std::array<float,2>{0.499614298f, 0.227125645f},
-std::array<float,2>{0.946446836f, 0.554295361f},
-std::array<float,2>{0.511521876f, 0.256843418f},
-std::array<float,2>{0.10552267f, 0.948586106f},
-std::array<float,2>{0.35899359f, 0.349377632f},
-std::array<float,2>{0.754230022f, 0.929359436f},
-std::array<float,2>{0.712940574f, 0.165389284f},
-std::array<float,2>{0.219699442f, 0.615304828f},
-std::array<float,2>{0.0532713793f, 0.0556183644f},
-std::array<float,2>{0.570407689f, 0.633204103f},
-std::array<float,2>{0.92618382f, 0.485754311f},
-std::array<float,2>{0.419977337f, 0.765035331f},
-std::array<float,2>{0.0899167359f, 0.311866254f},
-std::array<float,2>{0.54428947f, 0.980227888f},
-std::array<float,2>{0.975064039f, 0.217268065f},
-std::array<float,2>{0.446780175f, 0.506981373f},
-std::array<float,2>{0.275875211f, 0.106939137f},
-std::array<float,2>{0.868542135f, 0.730329335f},
-std::array<float,2>{0.655382752f, 0.37945801f},
-std::array<float,2>{0.140097007f, 0.856211245f},
-std::array<float,2>{0.376539558f, 0.440697134f},
-std::array<float,2>{0.880958259f, 0.791508913f},
-std::array<float,2>{0.608870983f, 0.00125015108f},
-std::array<float,2>{0.0124693383f, 0.670880675f},
-std::array<float,2>{0.204577371f, 0.143966198f},
-std::array<float,2>{0.737543821f, 0.590215981f},
-std::array<float,2>{0.795077264f, 0.321282148f},
-std::array<float,2>{0.328846633f, 0.882194042f},
-std::array<float,2>{0.212647542f, 0.293844849f},
-std::array<float,2>{0.746353447f, 0.987429678f},
-std::array<float,2>{0.785039067f, 0.190596357f},
-std::array<float,2>{0.343113303f, 0.525046885f},
-std::array<float,2>{0.388332635f, 0.12080998f},
-std::array<float,2>{0.885304153f, 0.74877876f},
-std::array<float,2>{0.595656157f, 0.398822963f},
-std::array<float,2>{0.00656288164f, 0.861555696f},
-std::array<float,2>{0.268755287f, 0.457332492f},
-std::array<float,2>{0.866989315f, 0.798167586f},
-std::array<float,2>{0.642233729f, 0.0260454994f},
-std::array<float,2>{0.127729237f, 0.6871804f},
-std::array<float,2>{0.0833037719f, 0.130409807f},
-std::array<float,2>{0.533284247f, 0.574867308f},
-std::array<float,2>{0.980385602f, 0.331058472f},
-std::array<float,2>{0.440045327f, 0.894603968f},
-std::array<float,2>{0.057223849f, 0.409310132f},
-std::array<float,2>{0.570209622f, 0.832872689f},
-std::array<float,2>{0.936302781f, 0.0736726224f},
-std::array<float,2>{0.408069909f, 0.717892706f},
-std::array<float,2>{0.344171911f, 0.243327841f},
-std::array<float,2>{0.759199977f, 0.535013199f},
-std::array<float,2>{0.707588673f, 0.272020936f},
-std::array<float,2>{0.230890736f, 0.96400547f},
-std::array<float,2>{0.491223842f, 0.368630558f},
-std::array<float,2>{0.944016516f, 0.913750112f},
-std::array<float,2>{0.505816758f, 0.17731221f},
-std::array<float,2>{0.0959192216f, 0.600689173f},
-std::array<float,2>{0.171083838f, 0.0381371342f},
-std::array<float,2>{0.663416088f, 0.655829191f},
-std::array<float,2>{0.81420666f, 0.477657795f},
-std::array<float,2>{0.29351303f, 0.777493596f},
-std::array<float,2>{0.145255968f, 0.490125448f},
-std::array<float,2>{0.638852835f, 0.761200428f},
-std::array<float,2>{0.849133074f, 0.0586831495f},
-std::array<float,2>{0.25003767f, 0.638243616f},
-std::array<float,2>{0.457434982f, 0.169565499f},
-std::array<float,2>{0.987694144f, 0.610719383f},
-std::array<float,2>{0.548651516f, 0.345531136f},
-std::array<float,2>{0.076836504f, 0.924879313f},
-std::array<float,2>{0.324120492f, 0.25149852f},
-std::array<float,2>{0.804090798f, 0.950926185f},
-std::array<float,2>{0.727846503f, 0.23372896f},
-std::array<float,2>{0.195414826f, 0.54723531f},
-std::array<float,2>{0.0283236168f, 0.0922222883f},
-std::array<float,2>{0.617546558f, 0.693074465f},
-std::array<float,2>{0.895337999f, 0.4288854f},
-std::array<float,2>{0.404878914f, 0.825815022f},
-std::array<float,2>{0.124696001f, 0.326402456f},
-std::array<float,2>{0.528080165f, 0.876959801f},
-std::array<float,2>{0.961482108f, 0.146423295f},
-std::array<float,2>{0.473755389f, 0.587747812f},
-std::array<float,2>{0.310220033f, 0.00551903527f},
-std::array<float,2>{0.837804675f, 0.664851308f},
-std::array<float,2>{0.684654117f, 0.442130238f},
-std::array<float,2>{0.179447263f, 0.795338273f},
-std::array<float,2>{0.42855832f, 0.375004143f},
-std::array<float,2>{0.909460783f, 0.852163911f},
-std::array<float,2>{0.58209002f, 0.103841387f},
-std::array<float,2>{0.0343624204f, 0.73198384f},
-std::array<float,2>{0.242848277f, 0.212806538f},
-std::array<float,2>{0.700627506f, 0.500385821f},
-std::array<float,2>{0.779856086f, 0.304992437f},
-std::array<float,2>{0.366268814f, 0.983687699f},
-std::array<float,2>{0.187048554f, 0.353048295f},
-std::array<float,2>{0.676662207f, 0.929738104f},
-std::array<float,2>{0.834765732f, 0.156316638f},
-std::array<float,2>{0.300827354f, 0.620839357f},
-std::array<float,2>{0.477300942f, 0.051773712f},
-std::array<float,2>{0.956742108f, 0.629874706f},
-std::array<float,2>{0.515968561f, 0.496346682f},
-std::array<float,2>{0.115217231f, 0.752628207f},
-std::array<float,2>{0.371885449f, 0.435803384f},
-std::array<float,2>{0.771611512f, 0.816567123f},
-std::array<float,2>{0.690401196f, 0.0845821276f},
-std::array<float,2>{0.241813913f, 0.703019738f},
-std::array<float,2>{0.0411306657f, 0.219942987f},
-std::array<float,2>{0.592746675f, 0.556011796f},
-std::array<float,2>{0.916718543f, 0.264286965f},
-std::array<float,2>{0.431420147f, 0.938119233f},
-std::array<float,2>{0.0678282455f, 0.449103206f},
-std::array<float,2>{0.555717409f, 0.784350455f},
-std::array<float,2>{0.993682563f, 0.00825840235f},
-std::array<float,2>{0.467028737f, 0.657271743f},
-std::array<float,2>{0.264468014f, 0.153056696f},
-std::array<float,2>{0.857920408f, 0.584288597f},
-std::array<float,2>{0.632323682f, 0.318495452f},
-std::array<float,2>{0.153146833f, 0.884412944f},
-std::array<float,2>{0.393300653f, 0.301140547f},
-std::array<float,2>{0.898964345f, 0.969222546f},
-std::array<float,2>{0.615282834f, 0.206304476f},
-std::array<float,2>{0.0175185446f, 0.510666728f},
-std::array<float,2>{0.189623594f, 0.101261899f},
-std::array<float,2>{0.721229076f, 0.719934165f},
-std::array<float,2>{0.810025275f, 0.385223389f},
-std::array<float,2>{0.313248873f, 0.849416018f},
-std::array<float,2>{0.225733206f, 0.393236488f},
-std::array<float,2>{0.715830564f, 0.87386018f},
-std::array<float,2>{0.750748992f, 0.112156518f},
-std::array<float,2>{0.355075836f, 0.735238969f},
-std::array<float,2>{0.414704621f, 0.199037597f},
-std::array<float,2>{0.924905479f, 0.519337893f},
-std::array<float,2>{0.575427115f, 0.287177831f},
-std::array<float,2>{0.0477545485f, 0.997723103f},
-std::array<float,2>{0.282081813f, 0.338139266f},
-std::array<float,2>{0.821367741f, 0.898594975f},
-std::array<float,2>{0.664383411f, 0.136219949f},
-std::array<float,2>{0.163303837f, 0.565140784f},
-std::array<float,2>{0.102197476f, 0.0172914267f},
-std::array<float,2>{0.513371289f, 0.672737658f},
-std::array<float,2>{0.9513219f, 0.466495275f},
-std::array<float,2>{0.494820118f, 0.809501112f},
-std::array<float,2>{0.0105438028f, 0.275309861f},
-std::array<float,2>{0.605340958f, 0.955069304f},
-std::array<float,2>{0.876305461f, 0.234778613f},
-std::array<float,2>{0.379771292f, 0.543418229f},
-std::array<float,2>{0.334423989f, 0.068964988f},
-std::array<float,2>{0.792352557f, 0.708369493f},
-std::array<float,2>{0.738853335f, 0.421339542f},
-std::array<float,2>{0.210889637f, 0.838684082f},
-std::array<float,2>{0.450244576f, 0.476533115f},
-std::array<float,2>{0.970303774f, 0.770971596f},
-std::array<float,2>{0.539751112f, 0.0400731191f},
-std::array<float,2>{0.086830847f, 0.64585346f},
-std::array<float,2>{0.136524633f, 0.185520172f},
-std::array<float,2>{0.651975095f, 0.605796456f},
-std::array<float,2>{0.874649882f, 0.365782231f},
-std::array<float,2>{0.27765736f, 0.919120193f},
-std::array<float,2>{0.164952695f, 0.299093843f},
-std::array<float,2>{0.656464577f, 0.974885702f},
-std::array<float,2>{0.818060398f, 0.210188136f},
-std::array<float,2>{0.290660232f, 0.515039265f},
-std::array<float,2>{0.484775841f, 0.0971056893f},
-std::array<float,2>{0.938301742f, 0.724862576f},
-std::array<float,2>{0.50219965f, 0.389017552f},
-std::array<float,2>{0.0998082682f, 0.84674257f},
-std::array<float,2>{0.347665787f, 0.452828437f},
-std::array<float,2>{0.76524508f, 0.785166562f},
-std::array<float,2>{0.706752658f, 0.0131648174f},
-std::array<float,2>{0.228763685f, 0.660999417f},
-std::array<float,2>{0.06133366f, 0.148471043f},
-std::array<float,2>{0.563787997f, 0.579852998f},
-std::array<float,2>{0.931141138f, 0.312577397f},
-std::array<float,2>{0.411582738f, 0.887323081f},
-std::array<float,2>{0.0819647014f, 0.432195991f},
-std::array<float,2>{0.536082625f, 0.815258622f},
-std::array<float,2>{0.980586767f, 0.0786966011f},
-std::array<float,2>{0.444195926f, 0.69822526f},
-std::array<float,2>{0.271529675f, 0.226458177f},
-std::array<float,2>{0.861026227f, 0.562082112f},
-std::array<float,2>{0.646711349f, 0.260209382f},
-std::array<float,2>{0.130563319f, 0.944257855f},
-std::array<float,2>{0.384393245f, 0.358201116f},
-std::array<float,2>{0.887779653f, 0.935590923f},
-std::array<float,2>{0.601149857f, 0.161660805f},
-std::array<float,2>{0.00373852998f, 0.621606767f},
-std::array<float,2>{0.218174279f, 0.0487859212f},
-std::array<float,2>{0.743618965f, 0.626027763f},
-std::array<float,2>{0.788613379f, 0.493211716f},
-std::array<float,2>{0.336497158f, 0.756983697f},
-std::array<float,2>{0.247867927f, 0.470481306f},
-std::array<float,2>{0.699216664f, 0.766023338f},
-std::array<float,2>{0.775042832f, 0.0443798825f},
-std::array<float,2>{0.362696379f, 0.643285394f},
-std::array<float,2>{0.424422026f, 0.18088524f},
-std::array<float,2>{0.912498057f, 0.603845596f},
-std::array<float,2>{0.58056581f, 0.360100299f},
-std::array<float,2>{0.0372899063f, 0.91700846f},
-std::array<float,2>{0.307748944f, 0.278464228f},
-std::array<float,2>{0.841427207f, 0.95814991f},
-std::array<float,2>{0.680430591f, 0.239241868f},
-std::array<float,2>{0.174250677f, 0.540170431f},
-std::array<float,2>{0.120392121f, 0.0629614592f},
-std::array<float,2>{0.52417028f, 0.706740916f},
-std::array<float,2>{0.968120396f, 0.415293872f},
-std::array<float,2>{0.469125271f, 0.840874135f},
-std::array<float,2>{0.0245571565f, 0.342623591f},
-std::array<float,2>{0.623038232f, 0.904430151f},
-std::array<float,2>{0.893205047f, 0.138897702f},
-std::array<float,2>{0.400864869f, 0.569020391f},
-std::array<float,2>{0.325606704f, 0.022767365f},
-std::array<float,2>{0.797384918f, 0.676894426f},
-std::array<float,2>{0.732722342f, 0.464287758f},
-std::array<float,2>{0.19961834f, 0.806653202f},
-std::array<float,2>{0.456219494f, 0.398328722f},
-std::array<float,2>{0.991009891f, 0.870911837f},
-std::array<float,2>{0.55314827f, 0.116957314f},
-std::array<float,2>{0.0707266256f, 0.740826011f},
-std::array<float,2>{0.144322529f, 0.20251666f},
-std::array<float,2>{0.635578334f, 0.520876288f},
-std::array<float,2>{0.846356571f, 0.282020539f},
-std::array<float,2>{0.256261766f, 0.99531287f},
-std::array<float,2>{0.192034617f, 0.371793836f},
-std::array<float,2>{0.724688649f, 0.907914102f},
-std::array<float,2>{0.806264162f, 0.175735831f},
-std::array<float,2>{0.319497257f, 0.596339226f},
-std::array<float,2>{0.397274554f, 0.034113422f},
-std::array<float,2>{0.9037534f, 0.648586094f},
-std::array<float,2>{0.611690164f, 0.482539415f},
-std::array<float,2>{0.0230424553f, 0.775027454f},
-std::array<float,2>{0.258401811f, 0.412530005f},
-std::array<float,2>{0.85266161f, 0.828190029f},
-std::array<float,2>{0.626085758f, 0.0751558468f},
-std::array<float,2>{0.149596095f, 0.714381158f},
-std::array<float,2>{0.0651976094f, 0.248986453f},
-std::array<float,2>{0.559472263f, 0.536296964f},
-std::array<float,2>{0.997232556f, 0.266337335f},
-std::array<float,2>{0.461460531f, 0.966349721f},
-std::array<float,2>{0.0435194746f, 0.456402957f},
-std::array<float,2>{0.587884426f, 0.804090977f},
-std::array<float,2>{0.919392884f, 0.0302094128f},
-std::array<float,2>{0.434499472f, 0.683571756f},
-std::array<float,2>{0.370273769f, 0.125418261f},
-std::array<float,2>{0.767635047f, 0.573595524f},
-std::array<float,2>{0.694839716f, 0.334710717f},
-std::array<float,2>{0.235135749f, 0.891990781f},
-std::array<float,2>{0.483178049f, 0.2912229f},
-std::array<float,2>{0.959531724f, 0.991446137f},
-std::array<float,2>{0.520401716f, 0.1929629f},
-std::array<float,2>{0.112153061f, 0.529519439f},
-std::array<float,2>{0.180200711f, 0.121169776f},
-std::array<float,2>{0.673598826f, 0.745934904f},
-std::array<float,2>{0.831080139f, 0.403176814f},
-std::array<float,2>{0.298387915f, 0.863682866f},
-std::array<float,2>{0.138353854f, 0.382223457f},
-std::array<float,2>{0.653448939f, 0.858164966f},
-std::array<float,2>{0.870615423f, 0.107614152f},
-std::array<float,2>{0.274238795f, 0.727812946f},
-std::array<float,2>{0.448048919f, 0.216627985f},
-std::array<float,2>{0.974240482f, 0.504791975f},
-std::array<float,2>{0.54507798f, 0.308729976f},
-std::array<float,2>{0.0925231278f, 0.977262974f},
-std::array<float,2>{0.330165982f, 0.322331399f},
-std::array<float,2>{0.794656038f, 0.880718231f},
-std::array<float,2>{0.735759616f, 0.141645655f},
-std::array<float,2>{0.205440998f, 0.593590379f},
-std::array<float,2>{0.0138818156f, 0.00376553321f},
-std::array<float,2>{0.605577171f, 0.668529034f},
-std::array<float,2>{0.880754888f, 0.437952012f},
-std::array<float,2>{0.378232062f, 0.790714324f},
-std::array<float,2>{0.107575536f, 0.254481792f},
-std::array<float,2>{0.508735001f, 0.945831358f},
-std::array<float,2>{0.947878003f, 0.230262041f},
-std::array<float,2>{0.497243822f, 0.551435351f},
-std::array<float,2>{0.287206173f, 0.0866221488f},
-std::array<float,2>{0.824560702f, 0.691364348f},
-std::array<float,2>{0.671726882f, 0.424191415f},
-std::array<float,2>{0.156251177f, 0.821480036f},
-std::array<float,2>{0.419893533f, 0.486430764f},
-std::array<float,2>{0.927921891f, 0.762848079f},
-std::array<float,2>{0.574013591f, 0.0567881465f},
-std::array<float,2>{0.0509581193f, 0.636714637f},
-std::array<float,2>{0.220969439f, 0.167109087f},
-std::array<float,2>{0.712569356f, 0.615091205f},
-std::array<float,2>{0.756570041f, 0.350283265f},
-std::array<float,2>{0.356506646f, 0.926015258f},
-std::array<float,2>{0.234351993f, 0.270068705f},
-std::array<float,2>{0.710225582f, 0.961656749f},
-std::array<float,2>{0.760161042f, 0.244154975f},
-std::array<float,2>{0.347609133f, 0.532056987f},
-std::array<float,2>{0.409084588f, 0.0721908435f},
-std::array<float,2>{0.934818685f, 0.715065479f},
-std::array<float,2>{0.566750765f, 0.408039659f},
-std::array<float,2>{0.0555917025f, 0.835118175f},
-std::array<float,2>{0.296292394f, 0.479443908f},
-std::array<float,2>{0.816310108f, 0.779367208f},
-std::array<float,2>{0.660170913f, 0.0357715972f},
-std::array<float,2>{0.16867809f, 0.653347552f},
-std::array<float,2>{0.0946330428f, 0.178343698f},
-std::array<float,2>{0.506023705f, 0.598513782f},
-std::array<float,2>{0.942391455f, 0.370706856f},
-std::array<float,2>{0.489715725f, 0.911133647f},
-std::array<float,2>{0.00575293554f, 0.400951713f},
-std::array<float,2>{0.595793962f, 0.86100173f},
-std::array<float,2>{0.883329272f, 0.118582509f},
-std::array<float,2>{0.390161633f, 0.746590793f},
-std::array<float,2>{0.340613097f, 0.188299119f},
-std::array<float,2>{0.782743037f, 0.525799692f},
-std::array<float,2>{0.749392629f, 0.295201063f},
-std::array<float,2>{0.214435861f, 0.985388339f},
-std::array<float,2>{0.437708318f, 0.328280091f},
-std::array<float,2>{0.976625025f, 0.898317516f},
-std::array<float,2>{0.532279253f, 0.132739156f},
-std::array<float,2>{0.0851605982f, 0.577006578f},
-std::array<float,2>{0.125374496f, 0.023831794f},
-std::array<float,2>{0.642920613f, 0.685198367f},
-std::array<float,2>{0.864074051f, 0.46000129f},
-std::array<float,2>{0.267194837f, 0.798899889f},
-std::array<float,2>{0.177604273f, 0.444351256f},
-std::array<float,2>{0.686070621f, 0.794355571f},
-std::array<float,2>{0.839522362f, 0.00721923588f},
-std::array<float,2>{0.312237799f, 0.666106761f},
-std::array<float,2>{0.474805564f, 0.147200733f},
-std::array<float,2>{0.964571118f, 0.587902606f},
-std::array<float,2>{0.529512763f, 0.324899733f},
-std::array<float,2>{0.12240421f, 0.87590003f},
-std::array<float,2>{0.364757806f, 0.306767792f},
-std::array<float,2>{0.778032124f, 0.981563389f},
-std::array<float,2>{0.701484621f, 0.213767126f},
-std::array<float,2>{0.244689077f, 0.503083646f},
-std::array<float,2>{0.0329244472f, 0.103243388f},
-std::array<float,2>{0.584427714f, 0.733109295f},
-std::array<float,2>{0.907849908f, 0.378153384f},
-std::array<float,2>{0.427131683f, 0.855334878f},
-std::array<float,2>{0.0761009157f, 0.34606573f},
-std::array<float,2>{0.550628781f, 0.923586547f},
-std::array<float,2>{0.984639168f, 0.17079474f},
-std::array<float,2>{0.460312068f, 0.612884104f},
-std::array<float,2>{0.253301382f, 0.0622117445f},
-std::array<float,2>{0.85027498f, 0.640460074f},
-std::array<float,2>{0.638320148f, 0.492129236f},
-std::array<float,2>{0.146872953f, 0.75850904f},
-std::array<float,2>{0.402885795f, 0.427064151f},
-std::array<float,2>{0.896716297f, 0.827297151f},
-std::array<float,2>{0.620817661f, 0.0904601812f},
-std::array<float,2>{0.0299266335f, 0.693719149f},
-std::array<float,2>{0.198601186f, 0.231317878f},
-std::array<float,2>{0.728546143f, 0.550590456f},
-std::array<float,2>{0.801273704f, 0.253496796f},
-std::array<float,2>{0.321758538f, 0.95300597f},
-std::array<float,2>{0.155557081f, 0.317742825f},
-std::array<float,2>{0.62964958f, 0.885541201f},
-std::array<float,2>{0.857192218f, 0.155457184f},
-std::array<float,2>{0.262509674f, 0.582082808f},
-std::array<float,2>{0.466301084f, 0.0101027405f},
-std::array<float,2>{0.99517858f, 0.660100698f},
-std::array<float,2>{0.557504356f, 0.446409076f},
-std::array<float,2>{0.0691403076f, 0.781727195f},
-std::array<float,2>{0.315297812f, 0.383415043f},
-std::array<float,2>{0.81141901f, 0.850903749f},
-std::array<float,2>{0.720546722f, 0.099400349f},
-std::array<float,2>{0.188742071f, 0.722080946f},
-std::array<float,2>{0.0178209115f, 0.20472759f},
-std::array<float,2>{0.614340723f, 0.509297669f},
-std::array<float,2>{0.901199579f, 0.302950442f},
-std::array<float,2>{0.392079324f, 0.971930563f},
-std::array<float,2>{0.115393713f, 0.499736398f},
-std::array<float,2>{0.519242167f, 0.750946105f},
-std::array<float,2>{0.954013944f, 0.0536009409f},
-std::array<float,2>{0.479333818f, 0.630867422f},
-std::array<float,2>{0.30364877f, 0.158584177f},
-std::array<float,2>{0.832600474f, 0.618583918f},
-std::array<float,2>{0.678029895f, 0.354155421f},
-std::array<float,2>{0.185381979f, 0.932529092f},
-std::array<float,2>{0.432282388f, 0.262278646f},
-std::array<float,2>{0.91596806f, 0.939791739f},
-std::array<float,2>{0.590513825f, 0.221630901f},
-std::array<float,2>{0.0398792289f, 0.55677551f},
-std::array<float,2>{0.240046889f, 0.0837107599f},
-std::array<float,2>{0.68940264f, 0.699956715f},
-std::array<float,2>{0.770349145f, 0.434965193f},
-std::array<float,2>{0.373202801f, 0.819250941f},
-std::array<float,2>{0.207511306f, 0.419494033f},
-std::array<float,2>{0.741406202f, 0.836698234f},
-std::array<float,2>{0.790749371f, 0.0665981323f},
-std::array<float,2>{0.332636207f, 0.709308624f},
-std::array<float,2>{0.382755131f, 0.23817715f},
-std::array<float,2>{0.877445698f, 0.546356618f},
-std::array<float,2>{0.602241397f, 0.27623862f},
-std::array<float,2>{0.0084514413f, 0.955169559f},
-std::array<float,2>{0.279405385f, 0.363512754f},
-std::array<float,2>{0.872943401f, 0.920597672f},
-std::array<float,2>{0.64994067f, 0.1874367f},
-std::array<float,2>{0.13331522f, 0.608660877f},
-std::array<float,2>{0.0897270143f, 0.0411813073f},
-std::array<float,2>{0.542762637f, 0.647313714f},
-std::array<float,2>{0.972564876f, 0.472955942f},
-std::array<float,2>{0.451642215f, 0.771776915f},
-std::array<float,2>{0.0503475629f, 0.286867708f},
-std::array<float,2>{0.577449679f, 0.999071002f},
-std::array<float,2>{0.922595799f, 0.196645796f},
-std::array<float,2>{0.416825682f, 0.516231537f},
-std::array<float,2>{0.353420526f, 0.109803304f},
-std::array<float,2>{0.753051162f, 0.737258673f},
-std::array<float,2>{0.717244327f, 0.390750051f},
-std::array<float,2>{0.223083943f, 0.872675419f},
-std::array<float,2>{0.492959946f, 0.468625486f},
-std::array<float,2>{0.94970578f, 0.811896026f},
-std::array<float,2>{0.514781833f, 0.0191311277f},
-std::array<float,2>{0.104865618f, 0.675193012f},
-std::array<float,2>{0.160271317f, 0.13428016f},
-std::array<float,2>{0.667924464f, 0.563189685f},
-std::array<float,2>{0.823982835f, 0.337030649f},
-std::array<float,2>{0.284296989f, 0.901103556f},
-std::array<float,2>{0.175319538f, 0.281181306f},
-std::array<float,2>{0.681145549f, 0.959984839f},
-std::array<float,2>{0.840135276f, 0.24206309f},
-std::array<float,2>{0.307448685f, 0.542946935f},
-std::array<float,2>{0.470608979f, 0.0650925338f},
-std::array<float,2>{0.967288077f, 0.704949498f},
-std::array<float,2>{0.524608254f, 0.416614294f},
-std::array<float,2>{0.120025292f, 0.843186975f},
-std::array<float,2>{0.362220883f, 0.471689492f},
-std::array<float,2>{0.773521602f, 0.767581999f},
-std::array<float,2>{0.697697699f, 0.0460850857f},
-std::array<float,2>{0.246749982f, 0.641596437f},
-std::array<float,2>{0.0384377241f, 0.182037115f},
-std::array<float,2>{0.581405699f, 0.601688981f},
-std::array<float,2>{0.91339165f, 0.363032818f},
-std::array<float,2>{0.425678015f, 0.91481775f},
-std::array<float,2>{0.071907267f, 0.395305485f},
-std::array<float,2>{0.55403167f, 0.867568552f},
-std::array<float,2>{0.992009938f, 0.114097901f},
-std::array<float,2>{0.455837488f, 0.738358498f},
-std::array<float,2>{0.256922156f, 0.200717419f},
-std::array<float,2>{0.847151399f, 0.521637142f},
-std::array<float,2>{0.636378288f, 0.284914017f},
-std::array<float,2>{0.143345058f, 0.992591739f},
-std::array<float,2>{0.402040392f, 0.340916902f},
-std::array<float,2>{0.894050062f, 0.903580904f},
-std::array<float,2>{0.621565819f, 0.136890903f},
-std::array<float,2>{0.0239055958f, 0.567276597f},
-std::array<float,2>{0.200435489f, 0.0208830647f},
-std::array<float,2>{0.733699381f, 0.678355396f},
-std::array<float,2>{0.798397899f, 0.462515801f},
-std::array<float,2>{0.324230373f, 0.80635184f},
-std::array<float,2>{0.230138227f, 0.450782269f},
-std::array<float,2>{0.70520246f, 0.787413001f},
-std::array<float,2>{0.763712466f, 0.0145782912f},
-std::array<float,2>{0.349212319f, 0.663805246f},
-std::array<float,2>{0.410521954f, 0.151874527f},
-std::array<float,2>{0.930335224f, 0.581071019f},
-std::array<float,2>{0.563355684f, 0.315339267f},
-std::array<float,2>{0.0616858825f, 0.890611231f},
-std::array<float,2>{0.289366871f, 0.298251867f},
-std::array<float,2>{0.816762745f, 0.973284483f},
-std::array<float,2>{0.65747875f, 0.207857177f},
-std::array<float,2>{0.165844768f, 0.51292944f},
-std::array<float,2>{0.101382047f, 0.0940014943f},
-std::array<float,2>{0.503839135f, 0.723857224f},
-std::array<float,2>{0.938543737f, 0.387692422f},
-std::array<float,2>{0.486179084f, 0.845226049f},
-std::array<float,2>{0.00201240089f, 0.356954187f},
-std::array<float,2>{0.600438356f, 0.934231341f},
-std::array<float,2>{0.887045264f, 0.163113087f},
-std::array<float,2>{0.383041143f, 0.624776185f},
-std::array<float,2>{0.337314457f, 0.0495491363f},
-std::array<float,2>{0.787145734f, 0.628551066f},
-std::array<float,2>{0.742499173f, 0.495812625f},
-std::array<float,2>{0.217294008f, 0.755585611f},
-std::array<float,2>{0.445175529f, 0.429720789f},
-std::array<float,2>{0.98207432f, 0.813173532f},
-std::array<float,2>{0.536518097f, 0.0805629343f},
-std::array<float,2>{0.080273442f, 0.69595474f},
-std::array<float,2>{0.128980964f, 0.223405108f},
-std::array<float,2>{0.648346364f, 0.560244441f},
-std::array<float,2>{0.859487832f, 0.258251786f},
-std::array<float,2>{0.272841513f, 0.942848384f},
-std::array<float,2>{0.206722692f, 0.321614712f},
-std::array<float,2>{0.735336304f, 0.881758749f},
-std::array<float,2>{0.793750525f, 0.14271535f},
-std::array<float,2>{0.331202507f, 0.591748655f},
-std::array<float,2>{0.377701908f, 0.000133583875f},
-std::array<float,2>{0.879370511f, 0.671787858f},
-std::array<float,2>{0.606639683f, 0.439528227f},
-std::array<float,2>{0.0151862679f, 0.792661071f},
-std::array<float,2>{0.275230646f, 0.380197644f},
-std::array<float,2>{0.870069802f, 0.857371986f},
-std::array<float,2>{0.653065324f, 0.106187575f},
-std::array<float,2>{0.137341127f, 0.728538275f},
-std::array<float,2>{0.092811659f, 0.218230665f},
-std::array<float,2>{0.546744883f, 0.506370723f},
-std::array<float,2>{0.973061919f, 0.310748905f},
-std::array<float,2>{0.448674351f, 0.978539169f},
-std::array<float,2>{0.0525688604f, 0.485242307f},
-std::array<float,2>{0.572820663f, 0.764337301f},
-std::array<float,2>{0.928957403f, 0.0562817343f},
-std::array<float,2>{0.418606102f, 0.634660661f},
-std::array<float,2>{0.355851233f, 0.164895043f},
-std::array<float,2>{0.757362247f, 0.617013156f},
-std::array<float,2>{0.711106062f, 0.348109692f},
-std::array<float,2>{0.222072572f, 0.928045034f},
-std::array<float,2>{0.496801198f, 0.256478965f},
-std::array<float,2>{0.94881779f, 0.947751343f},
-std::array<float,2>{0.509302616f, 0.228497207f},
-std::array<float,2>{0.10886284f, 0.55330795f},
-std::array<float,2>{0.157315314f, 0.0888742805f},
-std::array<float,2>{0.669951141f, 0.6875121f},
-std::array<float,2>{0.826003313f, 0.423790634f},
-std::array<float,2>{0.288826644f, 0.823997438f},
-std::array<float,2>{0.149039626f, 0.411313027f},
-std::array<float,2>{0.625525892f, 0.830832422f},
-std::array<float,2>{0.852438509f, 0.0767758861f},
-std::array<float,2>{0.259141326f, 0.712366879f},
-std::array<float,2>{0.462149084f, 0.24779579f},
-std::array<float,2>{0.996566951f, 0.53901577f},
-std::array<float,2>{0.560081124f, 0.26851213f},
-std::array<float,2>{0.0664055273f, 0.967872858f},
-std::array<float,2>{0.318413764f, 0.374076962f},
-std::array<float,2>{0.804776907f, 0.909644246f},
-std::array<float,2>{0.726507485f, 0.172925085f},
-std::array<float,2>{0.192761719f, 0.595680416f},
-std::array<float,2>{0.021563312f, 0.0326219425f},
-std::array<float,2>{0.612943292f, 0.650847673f},
-std::array<float,2>{0.903314114f, 0.482225925f},
-std::array<float,2>{0.398416847f, 0.776976764f},
-std::array<float,2>{0.112426236f, 0.289282918f},
-std::array<float,2>{0.520602763f, 0.989295244f},
-std::array<float,2>{0.960258365f, 0.195139438f},
-std::array<float,2>{0.483604431f, 0.529090106f},
-std::array<float,2>{0.297148615f, 0.124140732f},
-std::array<float,2>{0.830348969f, 0.743284583f},
-std::array<float,2>{0.672360957f, 0.404807121f},
-std::array<float,2>{0.181604713f, 0.866164148f},
-std::array<float,2>{0.435526967f, 0.453880072f},
-std::array<float,2>{0.918814123f, 0.800846517f},
-std::array<float,2>{0.586887538f, 0.028837977f},
-std::array<float,2>{0.0440753549f, 0.681260347f},
-std::array<float,2>{0.236112192f, 0.128539592f},
-std::array<float,2>{0.693566859f, 0.571498692f},
-std::array<float,2>{0.768663466f, 0.332520694f},
-std::array<float,2>{0.369973868f, 0.892959118f},
-std::array<float,2>{0.245778382f, 0.305758238f},
-std::array<float,2>{0.703019857f, 0.982788026f},
-std::array<float,2>{0.778339207f, 0.211196586f},
-std::array<float,2>{0.364065379f, 0.501423419f},
-std::array<float,2>{0.426210403f, 0.104547173f},
-std::array<float,2>{0.906632483f, 0.730531096f},
-std::array<float,2>{0.585915864f, 0.376352221f},
-std::array<float,2>{0.0315271579f, 0.853088677f},
-std::array<float,2>{0.311485648f, 0.442816317f},
-std::array<float,2>{0.838349819f, 0.796339929f},
-std::array<float,2>{0.687394261f, 0.00486000255f},
-std::array<float,2>{0.176718473f, 0.665609956f},
-std::array<float,2>{0.121968508f, 0.144666746f},
-std::array<float,2>{0.530965149f, 0.58601141f},
-std::array<float,2>{0.963635325f, 0.327700913f},
-std::array<float,2>{0.475852251f, 0.87793833f},
-std::array<float,2>{0.0305597f, 0.428615838f},
-std::array<float,2>{0.619599223f, 0.824943841f},
-std::array<float,2>{0.898103118f, 0.0930044129f},
-std::array<float,2>{0.403674543f, 0.691545188f},
-std::array<float,2>{0.320520848f, 0.233026296f},
-std::array<float,2>{0.801797509f, 0.547950923f},
-std::array<float,2>{0.730383158f, 0.250412494f},
-std::array<float,2>{0.198126495f, 0.9498294f},
-std::array<float,2>{0.45971936f, 0.344065547f},
-std::array<float,2>{0.985741913f, 0.924796581f},
-std::array<float,2>{0.549394608f, 0.168237552f},
-std::array<float,2>{0.0747312978f, 0.609558344f},
-std::array<float,2>{0.147466168f, 0.059589155f},
-std::array<float,2>{0.636879385f, 0.637080073f},
-std::array<float,2>{0.850840271f, 0.488706827f},
-std::array<float,2>{0.252077132f, 0.75979048f},
-std::array<float,2>{0.169429943f, 0.477315128f},
-std::array<float,2>{0.661216199f, 0.779153645f},
-std::array<float,2>{0.814606547f, 0.0375287086f},
-std::array<float,2>{0.295535624f, 0.654722154f},
-std::array<float,2>{0.489145368f, 0.176296845f},
-std::array<float,2>{0.942348838f, 0.60032171f},
-std::array<float,2>{0.50733155f, 0.36810413f},
-std::array<float,2>{0.0956943408f, 0.912975967f},
-std::array<float,2>{0.345833421f, 0.273215413f},
-std::array<float,2>{0.761666834f, 0.963863492f},
-std::array<float,2>{0.709143519f, 0.24261044f},
-std::array<float,2>{0.232756197f, 0.534086883f},
-std::array<float,2>{0.0563522354f, 0.0726487339f},
-std::array<float,2>{0.568220079f, 0.717044532f},
-std::array<float,2>{0.933601975f, 0.408618689f},
-std::array<float,2>{0.409806848f, 0.833735228f},
-std::array<float,2>{0.0843247324f, 0.330336928f},
-std::array<float,2>{0.531962991f, 0.89630717f},
-std::array<float,2>{0.978512347f, 0.129455954f},
-std::array<float,2>{0.438741416f, 0.576042533f},
-std::array<float,2>{0.265950471f, 0.0267044492f},
-std::array<float,2>{0.864553392f, 0.686065316f},
-std::array<float,2>{0.644096553f, 0.458366007f},
-std::array<float,2>{0.126475945f, 0.79698205f},
-std::array<float,2>{0.389312923f, 0.399527818f},
-std::array<float,2>{0.884658754f, 0.862878263f},
-std::array<float,2>{0.59668076f, 0.119638756f},
-std::array<float,2>{0.00426979782f, 0.749832273f},
-std::array<float,2>{0.213413551f, 0.189987585f},
-std::array<float,2>{0.748501003f, 0.523490846f},
-std::array<float,2>{0.781473815f, 0.294842482f},
-std::array<float,2>{0.341348559f, 0.986848414f},
-std::array<float,2>{0.134289742f, 0.366795361f},
-std::array<float,2>{0.649001658f, 0.918338418f},
-std::array<float,2>{0.871958017f, 0.183654606f},
-std::array<float,2>{0.281039596f, 0.607180297f},
-std::array<float,2>{0.45263648f, 0.0391511954f},
-std::array<float,2>{0.971493006f, 0.644865155f},
-std::array<float,2>{0.54138279f, 0.474747002f},
-std::array<float,2>{0.0881053284f, 0.770075917f},
-std::array<float,2>{0.333614022f, 0.420896441f},
-std::array<float,2>{0.789130211f, 0.839735568f},
-std::array<float,2>{0.740537047f, 0.0693972409f},
-std::array<float,2>{0.208706453f, 0.707584798f},
-std::array<float,2>{0.00897725299f, 0.236034617f},
-std::array<float,2>{0.602961957f, 0.544307113f},
-std::array<float,2>{0.878668606f, 0.273862392f},
-std::array<float,2>{0.38099131f, 0.954045653f},
-std::array<float,2>{0.104000293f, 0.465109855f},
-std::array<float,2>{0.514283597f, 0.810524225f},
-std::array<float,2>{0.950914085f, 0.0157363713f},
-std::array<float,2>{0.493383408f, 0.673380792f},
-std::array<float,2>{0.283888757f, 0.135144815f},
-std::array<float,2>{0.822520733f, 0.566058338f},
-std::array<float,2>{0.666095555f, 0.3388758f},
-std::array<float,2>{0.161408767f, 0.900291979f},
-std::array<float,2>{0.417747289f, 0.288211524f},
-std::array<float,2>{0.923344493f, 0.996761739f},
-std::array<float,2>{0.576418996f, 0.198023096f},
-std::array<float,2>{0.0491341688f, 0.518238068f},
-std::array<float,2>{0.223652929f, 0.112525605f},
-std::array<float,2>{0.718511283f, 0.736015916f},
-std::array<float,2>{0.752907157f, 0.393820733f},
-std::array<float,2>{0.351707369f, 0.874494016f},
-std::array<float,2>{0.187905714f, 0.386497885f},
-std::array<float,2>{0.719008207f, 0.848314106f},
-std::array<float,2>{0.811539412f, 0.0998752564f},
-std::array<float,2>{0.315449327f, 0.719464839f},
-std::array<float,2>{0.390907615f, 0.20520705f},
-std::array<float,2>{0.901783109f, 0.51118958f},
-std::array<float,2>{0.614195943f, 0.30180788f},
-std::array<float,2>{0.0186237562f, 0.969937801f},
-std::array<float,2>{0.263141006f, 0.319916487f},
-std::array<float,2>{0.855559766f, 0.883530021f},
-std::array<float,2>{0.630604863f, 0.153600231f},
-std::array<float,2>{0.154335693f, 0.585857391f},
-std::array<float,2>{0.0695490688f, 0.00951877329f},
-std::array<float,2>{0.557833552f, 0.657074988f},
-std::array<float,2>{0.994880378f, 0.447565436f},
-std::array<float,2>{0.465023279f, 0.783988178f},
-std::array<float,2>{0.0402658992f, 0.265010267f},
-std::array<float,2>{0.591138721f, 0.939106703f},
-std::array<float,2>{0.914404571f, 0.219188347f},
-std::array<float,2>{0.433120668f, 0.555429041f},
-std::array<float,2>{0.374870896f, 0.0854388401f},
-std::array<float,2>{0.770637751f, 0.701968968f},
-std::array<float,2>{0.687992334f, 0.43666774f},
-std::array<float,2>{0.238955081f, 0.818272173f},
-std::array<float,2>{0.479800612f, 0.497123867f},
-std::array<float,2>{0.954129696f, 0.753855169f},
-std::array<float,2>{0.518329918f, 0.0508388765f},
-std::array<float,2>{0.116945565f, 0.630294383f},
-std::array<float,2>{0.18426922f, 0.157362297f},
-std::array<float,2>{0.679328382f, 0.619896352f},
-std::array<float,2>{0.833293855f, 0.352022588f},
-std::array<float,2>{0.304670513f, 0.930902481f},
-std::array<float,2>{0.140890986f, 0.282780498f},
-std::array<float,2>{0.633736312f, 0.995022714f},
-std::array<float,2>{0.844666183f, 0.201787621f},
-std::array<float,2>{0.254310459f, 0.520104587f},
-std::array<float,2>{0.454747409f, 0.115439802f},
-std::array<float,2>{0.989410818f, 0.742108285f},
-std::array<float,2>{0.552479267f, 0.397334963f},
-std::array<float,2>{0.0730028301f, 0.869205952f},
-std::array<float,2>{0.326607257f, 0.46359086f},
-std::array<float,2>{0.79981178f, 0.808007956f},
-std::array<float,2>{0.730595469f, 0.0221547671f},
-std::array<float,2>{0.20255816f, 0.676582873f},
-std::array<float,2>{0.0255498439f, 0.140545785f},
-std::array<float,2>{0.62336266f, 0.569619417f},
-std::array<float,2>{0.891242206f, 0.343487501f},
-std::array<float,2>{0.400117785f, 0.905837417f},
-std::array<float,2>{0.117884777f, 0.414740115f},
-std::array<float,2>{0.525825977f, 0.840376735f},
-std::array<float,2>{0.966089725f, 0.0642212629f},
-std::array<float,2>{0.472435296f, 0.705477417f},
-std::array<float,2>{0.306375444f, 0.239749387f},
-std::array<float,2>{0.842512608f, 0.539392173f},
-std::array<float,2>{0.682183385f, 0.277452409f},
-std::array<float,2>{0.173756674f, 0.957896709f},
-std::array<float,2>{0.422068596f, 0.360888898f},
-std::array<float,2>{0.910397947f, 0.916189492f},
-std::array<float,2>{0.579465151f, 0.180499151f},
-std::array<float,2>{0.0367870182f, 0.605348408f},
-std::array<float,2>{0.249226391f, 0.0431666486f},
-std::array<float,2>{0.696125746f, 0.644483447f},
-std::array<float,2>{0.775587976f, 0.468965739f},
-std::array<float,2>{0.359652191f, 0.767282486f},
-std::array<float,2>{0.216554567f, 0.493093848f},
-std::array<float,2>{0.745128632f, 0.755927742f},
-std::array<float,2>{0.786164641f, 0.0470963195f},
-std::array<float,2>{0.339404315f, 0.62531352f},
-std::array<float,2>{0.386581659f, 0.161028191f},
-std::array<float,2>{0.88939178f, 0.622178793f},
-std::array<float,2>{0.597902f, 0.359155416f},
-std::array<float,2>{0.000596046681f, 0.937277317f},
-std::array<float,2>{0.270645678f, 0.261202723f},
-std::array<float,2>{0.862619698f, 0.945058525f},
-std::array<float,2>{0.646382093f, 0.224773973f},
-std::array<float,2>{0.131681919f, 0.560694456f},
-std::array<float,2>{0.0787317678f, 0.0794070438f},
-std::array<float,2>{0.537643909f, 0.699086249f},
-std::array<float,2>{0.984176338f, 0.433012873f},
-std::array<float,2>{0.442081183f, 0.816360891f},
-std::array<float,2>{0.0598988235f, 0.31353718f},
-std::array<float,2>{0.564929187f, 0.888386369f},
-std::array<float,2>{0.932030857f, 0.149457484f},
-std::array<float,2>{0.412436634f, 0.578965425f},
-std::array<float,2>{0.351075113f, 0.0121421134f},
-std::array<float,2>{0.763337553f, 0.661871672f},
-std::array<float,2>{0.70460999f, 0.451613635f},
-std::array<float,2>{0.227682516f, 0.786318839f},
-std::array<float,2>{0.487068951f, 0.390473664f},
-std::array<float,2>{0.940846324f, 0.845790803f},
-std::array<float,2>{0.501800299f, 0.0964726433f},
-std::array<float,2>{0.0983426645f, 0.725825369f},
-std::array<float,2>{0.167658478f, 0.209377438f},
-std::array<float,2>{0.658857644f, 0.514037728f},
-std::array<float,2>{0.819859684f, 0.300381094f},
-std::array<float,2>{0.291802317f, 0.975919187f},
-std::array<float,2>{0.220559984f, 0.350939631f},
-std::array<float,2>{0.714241087f, 0.926989496f},
-std::array<float,2>{0.755250931f, 0.166439027f},
-std::array<float,2>{0.357939035f, 0.613708675f},
-std::array<float,2>{0.421554565f, 0.0577423312f},
-std::array<float,2>{0.927128732f, 0.634974658f},
-std::array<float,2>{0.572091699f, 0.487747103f},
-std::array<float,2>{0.0537498035f, 0.762459636f},
-std::array<float,2>{0.285929739f, 0.425519019f},
-std::array<float,2>{0.827874482f, 0.821166337f},
-std::array<float,2>{0.669313073f, 0.0876874626f},
-std::array<float,2>{0.160132155f, 0.689727604f},
-std::array<float,2>{0.106738843f, 0.22888118f},
-std::array<float,2>{0.510603368f, 0.552355826f},
-std::array<float,2>{0.946162581f, 0.254904509f},
-std::array<float,2>{0.498953879f, 0.946600258f},
-std::array<float,2>{0.013058383f, 0.439040422f},
-std::array<float,2>{0.608165681f, 0.78974545f},
-std::array<float,2>{0.882403672f, 0.00279079541f},
-std::array<float,2>{0.375541955f, 0.669244707f},
-std::array<float,2>{0.329271168f, 0.14139694f},
-std::array<float,2>{0.796376944f, 0.592398167f},
-std::array<float,2>{0.736761212f, 0.323680073f},
-std::array<float,2>{0.204049051f, 0.87958765f},
-std::array<float,2>{0.446273714f, 0.310045719f},
-std::array<float,2>{0.976498127f, 0.97801286f},
-std::array<float,2>{0.543078542f, 0.214871138f},
-std::array<float,2>{0.0911598951f, 0.505000114f},
-std::array<float,2>{0.139415622f, 0.108961038f},
-std::array<float,2>{0.655080318f, 0.727403224f},
-std::array<float,2>{0.867989421f, 0.381648213f},
-std::array<float,2>{0.276373357f, 0.859331846f},
-std::array<float,2>{0.182764038f, 0.403924853f},
-std::array<float,2>{0.673942327f, 0.865066528f},
-std::array<float,2>{0.828834355f, 0.122154944f},
-std::array<float,2>{0.29928726f, 0.744704425f},
-std::array<float,2>{0.482091933f, 0.192380056f},
-std::array<float,2>{0.957487583f, 0.530532718f},
-std::array<float,2>{0.522230923f, 0.29234603f},
-std::array<float,2>{0.109731607f, 0.990464509f},
-std::array<float,2>{0.367803425f, 0.335067064f},
-std::array<float,2>{0.765912831f, 0.891479373f},
-std::array<float,2>{0.692039311f, 0.126665562f},
-std::array<float,2>{0.236366436f, 0.573173583f},
-std::array<float,2>{0.0467371307f, 0.0310948454f},
-std::array<float,2>{0.588771999f, 0.681667089f},
-std::array<float,2>{0.921618164f, 0.455390602f},
-std::array<float,2>{0.436024398f, 0.80348599f},
-std::array<float,2>{0.0643574148f, 0.267392039f},
-std::array<float,2>{0.56148833f, 0.965644062f},
-std::array<float,2>{0.999847114f, 0.249369472f},
-std::array<float,2>{0.464386463f, 0.535176873f},
-std::array<float,2>{0.261591703f, 0.0753948092f},
-std::array<float,2>{0.85480541f, 0.713288903f},
-std::array<float,2>{0.628529608f, 0.413553119f},
-std::array<float,2>{0.152211487f, 0.829991162f},
-std::array<float,2>{0.395547658f, 0.483813524f},
-std::array<float,2>{0.90462935f, 0.773531437f},
-std::array<float,2>{0.610835493f, 0.0350603461f},
-std::array<float,2>{0.0202599112f, 0.65018338f},
-std::array<float,2>{0.194725871f, 0.174605682f},
-std::array<float,2>{0.724324107f, 0.597033679f},
-std::array<float,2>{0.808226764f, 0.372278333f},
-std::array<float,2>{0.316604495f, 0.906324148f},
-std::array<float,2>{0.196555838f, 0.252408713f},
-std::array<float,2>{0.726661682f, 0.951427579f},
-std::array<float,2>{0.803322077f, 0.231605545f},
-std::array<float,2>{0.322851181f, 0.549194813f},
-std::array<float,2>{0.405712456f, 0.0908473358f},
-std::array<float,2>{0.896225989f, 0.694853723f},
-std::array<float,2>{0.618312657f, 0.426244289f},
-std::array<float,2>{0.0275926851f, 0.826510549f},
-std::array<float,2>{0.251577288f, 0.490607411f},
-std::array<float,2>{0.848043621f, 0.759442449f},
-std::array<float,2>{0.640405834f, 0.0609660596f},
-std::array<float,2>{0.146035716f, 0.639560759f},
-std::array<float,2>{0.0780990496f, 0.171529427f},
-std::array<float,2>{0.54749316f, 0.612188816f},
-std::array<float,2>{0.986564219f, 0.346732289f},
-std::array<float,2>{0.458362341f, 0.922789931f},
-std::array<float,2>{0.0333417691f, 0.377096176f},
-std::array<float,2>{0.583542407f, 0.853904426f},
-std::array<float,2>{0.908275962f, 0.101591893f},
-std::array<float,2>{0.428761333f, 0.734047472f},
-std::array<float,2>{0.365807354f, 0.214365304f},
-std::array<float,2>{0.781191945f, 0.502262652f},
-std::array<float,2>{0.700038314f, 0.30786249f},
-std::array<float,2>{0.243576646f, 0.98114115f},
-std::array<float,2>{0.473466218f, 0.326081038f},
-std::array<float,2>{0.962705672f, 0.87628603f},
-std::array<float,2>{0.528546035f, 0.148346364f},
-std::array<float,2>{0.12388403f, 0.589076877f},
-std::array<float,2>{0.178399757f, 0.00603341777f},
-std::array<float,2>{0.684057891f, 0.667951465f},
-std::array<float,2>{0.836852312f, 0.443986028f},
-std::array<float,2>{0.309398413f, 0.793310225f},
-std::array<float,2>{0.128552914f, 0.459438056f},
-std::array<float,2>{0.641147435f, 0.800731599f},
-std::array<float,2>{0.865281045f, 0.0252812281f},
-std::array<float,2>{0.267705977f, 0.684312463f},
-std::array<float,2>{0.4407686f, 0.131451353f},
-std::array<float,2>{0.979010224f, 0.577937126f},
-std::array<float,2>{0.535008967f, 0.329726458f},
-std::array<float,2>{0.0827344134f, 0.897105217f},
-std::array<float,2>{0.342223316f, 0.296186745f},
-std::array<float,2>{0.784144521f, 0.984935641f},
-std::array<float,2>{0.748021901f, 0.189060375f},
-std::array<float,2>{0.211330056f, 0.526651561f},
-std::array<float,2>{0.00692336448f, 0.117688894f},
-std::array<float,2>{0.59454298f, 0.747704983f},
-std::array<float,2>{0.886383832f, 0.401401788f},
-std::array<float,2>{0.387644231f, 0.860345662f},
-std::array<float,2>{0.0969156772f, 0.36970821f},
-std::array<float,2>{0.504369199f, 0.910769641f},
-std::array<float,2>{0.945146084f, 0.179269969f},
-std::array<float,2>{0.490627617f, 0.599516928f},
-std::array<float,2>{0.29409495f, 0.0367754847f},
-std::array<float,2>{0.813163757f, 0.65310055f},
-std::array<float,2>{0.662981272f, 0.480419427f},
-std::array<float,2>{0.170134723f, 0.780277669f},
-std::array<float,2>{0.406794488f, 0.406536728f},
-std::array<float,2>{0.936649024f, 0.834861398f},
-std::array<float,2>{0.568716526f, 0.0705326647f},
-std::array<float,2>{0.0576345958f, 0.716112912f},
-std::array<float,2>{0.231452286f, 0.245866627f},
-std::array<float,2>{0.708487511f, 0.532892346f},
-std::array<float,2>{0.758510351f, 0.270536363f},
-std::array<float,2>{0.345188349f, 0.962685466f},
-std::array<float,2>{0.162345394f, 0.336782038f},
-std::array<float,2>{0.665774405f, 0.902099192f},
-std::array<float,2>{0.820382595f, 0.133136719f},
-std::array<float,2>{0.283091307f, 0.563828647f},
-std::array<float,2>{0.495219648f, 0.0178612527f},
-std::array<float,2>{0.953113437f, 0.674357116f},
-std::array<float,2>{0.511912167f, 0.467564166f},
-std::array<float,2>{0.102975398f, 0.811411321f},
-std::array<float,2>{0.354091763f, 0.392314225f},
-std::array<float,2>{0.751683235f, 0.87111932f},
-std::array<float,2>{0.715331972f, 0.11115592f},
-std::array<float,2>{0.225247711f, 0.737992585f},
-std::array<float,2>{0.0485545583f, 0.195387483f},
-std::array<float,2>{0.575186968f, 0.517267585f},
-std::array<float,2>{0.92419976f, 0.285240412f},
-std::array<float,2>{0.415273964f, 0.998166144f},
-std::array<float,2>{0.0877562165f, 0.473960906f},
-std::array<float,2>{0.540154994f, 0.773262501f},
-std::array<float,2>{0.969082952f, 0.0423669554f},
-std::array<float,2>{0.449501425f, 0.648017704f},
-std::array<float,2>{0.278862327f, 0.185615972f},
-std::array<float,2>{0.873876333f, 0.608003736f},
-std::array<float,2>{0.651349008f, 0.365208805f},
-std::array<float,2>{0.134990692f, 0.921829879f},
-std::array<float,2>{0.380594879f, 0.276624292f},
-std::array<float,2>{0.875350058f, 0.956419706f},
-std::array<float,2>{0.604400992f, 0.236694694f},
-std::array<float,2>{0.0113261454f, 0.54520607f},
-std::array<float,2>{0.209272474f, 0.0677452236f},
-std::array<float,2>{0.73953712f, 0.710297644f},
-std::array<float,2>{0.791168094f, 0.418934584f},
-std::array<float,2>{0.335855633f, 0.837121069f},
-std::array<float,2>{0.240539655f, 0.434257209f},
-std::array<float,2>{0.690450549f, 0.820165038f},
-std::array<float,2>{0.772958577f, 0.0823451504f},
-std::array<float,2>{0.372743547f, 0.700966775f},
-std::array<float,2>{0.429695815f, 0.22217764f},
-std::array<float,2>{0.91700083f, 0.558347106f},
-std::array<float,2>{0.592878401f, 0.262985885f},
-std::array<float,2>{0.0425007455f, 0.940704763f},
-std::array<float,2>{0.302035302f, 0.354739666f},
-std::array<float,2>{0.835370123f, 0.933362484f},
-std::array<float,2>{0.677403927f, 0.159498259f},
-std::array<float,2>{0.185966656f, 0.617614806f},
-std::array<float,2>{0.113766775f, 0.0539277382f},
-std::array<float,2>{0.516666532f, 0.632112861f},
-std::array<float,2>{0.955981135f, 0.498687148f},
-std::array<float,2>{0.477746725f, 0.751644373f},
-std::array<float,2>{0.0163199734f, 0.30431515f},
-std::array<float,2>{0.616379857f, 0.970879555f},
-std::array<float,2>{0.89976567f, 0.203743055f},
-std::array<float,2>{0.393849105f, 0.508636415f},
-std::array<float,2>{0.313846201f, 0.0981079862f},
-std::array<float,2>{0.809130847f, 0.72166425f},
-std::array<float,2>{0.721817553f, 0.38443777f},
-std::array<float,2>{0.190617919f, 0.850060999f},
-std::array<float,2>{0.468427211f, 0.446236044f},
-std::array<float,2>{0.992456675f, 0.782856226f},
-std::array<float,2>{0.555467486f, 0.0111223524f},
-std::array<float,2>{0.0664823353f, 0.659081638f},
-std::array<float,2>{0.153795645f, 0.155241907f},
-std::array<float,2>{0.631431401f, 0.583378851f},
-std::array<float,2>{0.85897392f, 0.317319781f},
-std::array<float,2>{0.264876753f, 0.885892153f}}
\ No newline at end of file
@@ -1,4096 +0,0 @@
-{std::array<float,2>{0.421011776f, 0.237219229f},
-std::array<float,2>{0.843062937f, 0.592552125f},
-std::array<float,2>{0.240680933f, 0.786548793f},
-std::array<float,2>{0.749869168f, 0.419585466f},
-std::array<float,2>{0.0113668675f, 0.342696369f},
-std::array<float,2>{0.584656894f, 0.964839816f},
-std::array<float,2>{0.287631035f, 0.693657219f},
-std::array<float,2>{0.972520292f, 0.0962705538f},
-std::array<float,2>{0.161670193f, 0.0272934679f},
-std::array<float,2>{0.687402368f, 0.671927571f},
-std::array<float,2>{0.43778646f, 0.881138623f},
-std::array<float,2>{0.800301373f, 0.276444882f},
-std::array<float,2>{0.367795408f, 0.450655103f},
-std::array<float,2>{0.930654168f, 0.812542498f},
-std::array<float,2>{0.109205894f, 0.513552129f},
-std::array<float,2>{0.518876195f, 0.186642423f},
-std::array<float,2>{0.261802375f, 0.0818202496f},
-std::array<float,2>{0.939852536f, 0.719393849f},
-std::array<float,2>{0.0479456112f, 0.974701583f},
-std::array<float,2>{0.59905386f, 0.368017197f},
-std::array<float,2>{0.195937634f, 0.40253073f},
-std::array<float,2>{0.691764116f, 0.760148823f},
-std::array<float,2>{0.396156281f, 0.614282072f},
-std::array<float,2>{0.869220912f, 0.204516277f},
-std::array<float,2>{0.0738475099f, 0.136918217f},
-std::array<float,2>{0.558797121f, 0.538349032f},
-std::array<float,2>{0.33275637f, 0.853921533f},
-std::array<float,2>{0.895192742f, 0.494966209f},
-std::array<float,2>{0.490403503f, 0.296075344f},
-std::array<float,2>{0.770860255f, 0.930522025f},
-std::array<float,2>{0.14601098f, 0.638065159f},
-std::array<float,2>{0.649101198f, 0.0453225598f},
-std::array<float,2>{0.323673636f, 0.163204044f},
-std::array<float,2>{0.883517444f, 0.523757756f},
-std::array<float,2>{0.0834856555f, 0.834659934f},
-std::array<float,2>{0.538016438f, 0.453424692f},
-std::array<float,2>{0.134864464f, 0.255603462f},
-std::array<float,2>{0.631675541f, 0.892513216f},
-std::array<float,2>{0.473632187f, 0.668349564f},
-std::array<float,2>{0.762075782f, 0.00944657065f},
-std::array<float,2>{0.036922738f, 0.123628736f},
-std::array<float,2>{0.622292042f, 0.703595042f},
-std::array<float,2>{0.269056737f, 0.94988513f},
-std::array<float,2>{0.965793371f, 0.326273799f},
-std::array<float,2>{0.378834218f, 0.423833877f},
-std::array<float,2>{0.846705139f, 0.800746143f},
-std::array<float,2>{0.212870002f, 0.56572783f},
-std::array<float,2>{0.716667414f, 0.22403419f},
-std::array<float,2>{0.465337723f, 0.0596143194f},
-std::array<float,2>{0.792534649f, 0.642542422f},
-std::array<float,2>{0.187390745f, 0.91305387f},
-std::array<float,2>{0.670639575f, 0.311251223f},
-std::array<float,2>{0.112326562f, 0.475136071f},
-std::array<float,2>{0.50309813f, 0.860228121f},
-std::array<float,2>{0.345173091f, 0.547531426f},
-std::array<float,2>{0.920525014f, 0.145749792f},
-std::array<float,2>{0.225371867f, 0.193139642f},
-std::array<float,2>{0.722926617f, 0.602165818f},
-std::array<float,2>{0.427313864f, 0.769232273f},
-std::array<float,2>{0.818702161f, 0.375330448f},
-std::array<float,2>{0.300043106f, 0.349929363f},
-std::array<float,2>{0.995137155f, 0.992986679f},
-std::array<float,2>{0.0236057956f, 0.738712966f},
-std::array<float,2>{0.569738269f, 0.075419113f},
-std::array<float,2>{0.477766037f, 0.149203017f},
-std::array<float,2>{0.756360769f, 0.559678435f},
-std::array<float,2>{0.129973456f, 0.869578838f},
-std::array<float,2>{0.636329174f, 0.477541f},
-std::array<float,2>{0.0923075601f, 0.303148001f},
-std::array<float,2>{0.542821825f, 0.916613042f},
-std::array<float,2>{0.319767177f, 0.654967725f},
-std::array<float,2>{0.876377225f, 0.0514217243f},
-std::array<float,2>{0.204940394f, 0.0635736138f},
-std::array<float,2>{0.708592117f, 0.746714175f},
-std::array<float,2>{0.386825025f, 0.984783471f},
-std::array<float,2>{0.853851676f, 0.355403662f},
-std::array<float,2>{0.27630198f, 0.384034246f},
-std::array<float,2>{0.960830688f, 0.778633237f},
-std::array<float,2>{0.0439602844f, 0.596995413f},
-std::array<float,2>{0.609648883f, 0.197730035f},
-std::array<float,2>{0.356039912f, 0.00746769924f},
-std::array<float,2>{0.912235498f, 0.657954037f},
-std::array<float,2>{0.124828145f, 0.900188863f},
-std::array<float,2>{0.509569228f, 0.262251973f},
-std::array<float,2>{0.179200917f, 0.465474874f},
-std::array<float,2>{0.662617326f, 0.840042412f},
-std::array<float,2>{0.45908767f, 0.515666842f},
-std::array<float,2>{0.784323871f, 0.169127896f},
-std::array<float,2>{0.0188128687f, 0.233093724f},
-std::array<float,2>{0.577454209f, 0.571083367f},
-std::array<float,2>{0.307015985f, 0.807418108f},
-std::array<float,2>{0.98652637f, 0.432257265f},
-std::array<float,2>{0.430231303f, 0.317321539f},
-std::array<float,2>{0.820437372f, 0.940496862f},
-std::array<float,2>{0.229659006f, 0.713843167f},
-std::array<float,2>{0.734154284f, 0.112745263f},
-std::array<float,2>{0.295114249f, 0.214700431f},
-std::array<float,2>{0.978493094f, 0.62287724f},
-std::array<float,2>{0.00359131186f, 0.750737071f},
-std::array<float,2>{0.588249505f, 0.394378483f},
-std::array<float,2>{0.246109813f, 0.362913847f},
-std::array<float,2>{0.736865282f, 0.980348945f},
-std::array<float,2>{0.408764243f, 0.728622794f},
-std::array<float,2>{0.834191322f, 0.0925715715f},
-std::array<float,2>{0.0978711843f, 0.031404376f},
-std::array<float,2>{0.528210998f, 0.626144886f},
-std::array<float,2>{0.367048413f, 0.925639153f},
-std::array<float,2>{0.925792634f, 0.28774482f},
-std::array<float,2>{0.449630469f, 0.492062926f},
-std::array<float,2>{0.809832215f, 0.844272733f},
-std::array<float,2>{0.166561827f, 0.543097794f},
-std::array<float,2>{0.67380017f, 0.132682964f},
-std::array<float,2>{0.404910237f, 0.105412096f},
-std::array<float,2>{0.866987348f, 0.701185584f},
-std::array<float,2>{0.194009125f, 0.958813488f},
-std::array<float,2>{0.701767325f, 0.333401322f},
-std::array<float,2>{0.0569958761f, 0.40698722f},
-std::array<float,2>{0.604040861f, 0.791337609f},
-std::array<float,2>{0.252385288f, 0.578567564f},
-std::array<float,2>{0.946418405f, 0.242393166f},
-std::array<float,2>{0.155052617f, 0.175929293f},
-std::array<float,2>{0.646179914f, 0.507435918f},
-std::array<float,2>{0.499041051f, 0.820774734f},
-std::array<float,2>{0.777708948f, 0.445035845f},
-std::array<float,2>{0.337281078f, 0.273349941f},
-std::array<float,2>{0.905683339f, 0.889294446f},
-std::array<float,2>{0.0651333109f, 0.679700792f},
-std::array<float,2>{0.549983025f, 0.0200776272f},
-std::array<float,2>{0.441633403f, 0.200961903f},
-std::array<float,2>{0.802522838f, 0.600932121f},
-std::array<float,2>{0.157772318f, 0.774445593f},
-std::array<float,2>{0.680499673f, 0.388503551f},
-std::array<float,2>{0.103804469f, 0.356739014f},
-std::array<float,2>{0.522634029f, 0.990008175f},
-std::array<float,2>{0.371752024f, 0.744229734f},
-std::array<float,2>{0.935912907f, 0.0683171526f},
-std::array<float,2>{0.236407176f, 0.0473822542f},
-std::array<float,2>{0.742788315f, 0.650639951f},
-std::array<float,2>{0.416188627f, 0.920903802f},
-std::array<float,2>{0.835963786f, 0.298893899f},
-std::array<float,2>{0.282625496f, 0.482638747f},
-std::array<float,2>{0.975682557f, 0.871348083f},
-std::array<float,2>{0.0129994974f, 0.558376491f},
-std::array<float,2>{0.578569949f, 0.154849932f},
-std::array<float,2>{0.329100937f, 0.114206411f},
-std::array<float,2>{0.893391073f, 0.715284705f},
-std::array<float,2>{0.0753223673f, 0.941854775f},
-std::array<float,2>{0.55801487f, 0.314402938f},
-std::array<float,2>{0.140726671f, 0.435863465f},
-std::array<float,2>{0.655148804f, 0.810432255f},
-std::array<float,2>{0.488067538f, 0.576327682f},
-std::array<float,2>{0.765837908f, 0.228932649f},
-std::array<float,2>{0.0518948175f, 0.165408447f},
-std::array<float,2>{0.59574008f, 0.522980034f},
-std::array<float,2>{0.260467947f, 0.839478254f},
-std::array<float,2>{0.943465948f, 0.46227479f},
-std::array<float,2>{0.392067045f, 0.257930845f},
-std::array<float,2>{0.871944785f, 0.902779877f},
-std::array<float,2>{0.201709166f, 0.662699699f},
-std::array<float,2>{0.6908319f, 0.00126394734f},
-std::array<float,2>{0.271382004f, 0.125478655f},
-std::array<float,2>{0.961789131f, 0.541437566f},
-std::array<float,2>{0.0330001451f, 0.848558605f},
-std::array<float,2>{0.61999929f, 0.484410018f},
-std::array<float,2>{0.217740625f, 0.281352729f},
-std::array<float,2>{0.712624371f, 0.928677559f},
-std::array<float,2>{0.381140411f, 0.632060468f},
-std::array<float,2>{0.851060033f, 0.0366827734f},
-std::array<float,2>{0.0782907754f, 0.0892719328f},
-std::array<float,2>{0.53329587f, 0.733048081f},
-std::array<float,2>{0.326891959f, 0.981660128f},
-std::array<float,2>{0.88754338f, 0.363832265f},
-std::array<float,2>{0.471501708f, 0.397168785f},
-std::array<float,2>{0.758378923f, 0.755671561f},
-std::array<float,2>{0.137532786f, 0.620027542f},
-std::array<float,2>{0.625948548f, 0.216873631f},
-std::array<float,2>{0.422246605f, 0.0188451353f},
-std::array<float,2>{0.812959015f, 0.685391068f},
-std::array<float,2>{0.220879152f, 0.886206746f},
-std::array<float,2>{0.720889688f, 0.268151313f},
-std::array<float,2>{0.0304609947f, 0.440132529f},
-std::array<float,2>{0.56620872f, 0.826738358f},
-std::array<float,2>{0.302966148f, 0.501491129f},
-std::array<float,2>{0.998583794f, 0.174494937f},
-std::array<float,2>{0.180613384f, 0.248255923f},
-std::array<float,2>{0.664699793f, 0.582837999f},
-std::array<float,2>{0.461430848f, 0.794363856f},
-std::array<float,2>{0.794681132f, 0.413238674f},
-std::array<float,2>{0.349467188f, 0.331670344f},
-std::array<float,2>{0.915671289f, 0.953855455f},
-std::array<float,2>{0.113547832f, 0.695986748f},
-std::array<float,2>{0.504380107f, 0.106524073f},
-std::array<float,2>{0.385952085f, 0.181996286f},
-std::array<float,2>{0.859253705f, 0.50931257f},
-std::array<float,2>{0.208674595f, 0.816555679f},
-std::array<float,2>{0.70544374f, 0.445881456f},
-std::array<float,2>{0.0420112684f, 0.278391302f},
-std::array<float,2>{0.615400434f, 0.877863526f},
-std::array<float,2>{0.279504091f, 0.678019524f},
-std::array<float,2>{0.955600381f, 0.0295376219f},
-std::array<float,2>{0.126114488f, 0.10037487f},
-std::array<float,2>{0.637024283f, 0.687572598f},
-std::array<float,2>{0.482061207f, 0.968377173f},
-std::array<float,2>{0.752041221f, 0.337846458f},
-std::array<float,2>{0.312609732f, 0.416217655f},
-std::array<float,2>{0.88168174f, 0.783497691f},
-std::array<float,2>{0.0893405303f, 0.588429987f},
-std::array<float,2>{0.545899808f, 0.241661876f},
-std::array<float,2>{0.311746985f, 0.040042486f},
-std::array<float,2>{0.989773571f, 0.633883953f},
-std::array<float,2>{0.019990718f, 0.934604466f},
-std::array<float,2>{0.574090779f, 0.291112244f},
-std::array<float,2>{0.232960358f, 0.497286439f},
-std::array<float,2>{0.727986157f, 0.85889709f},
-std::array<float,2>{0.433881342f, 0.533715606f},
-std::array<float,2>{0.825098515f, 0.135553628f},
-std::array<float,2>{0.11987339f, 0.209160835f},
-std::array<float,2>{0.513427734f, 0.610896528f},
-std::array<float,2>{0.355311036f, 0.764910877f},
-std::array<float,2>{0.909483612f, 0.39924103f},
-std::array<float,2>{0.456763536f, 0.374839187f},
-std::array<float,2>{0.787496388f, 0.97244066f},
-std::array<float,2>{0.173444286f, 0.725664794f},
-std::array<float,2>{0.656288266f, 0.0841179192f},
-std::array<float,2>{0.360071212f, 0.219781816f},
-std::array<float,2>{0.922431886f, 0.569632649f},
-std::array<float,2>{0.0967905745f, 0.801722527f},
-std::array<float,2>{0.527144551f, 0.427584559f},
-std::array<float,2>{0.169302046f, 0.323735744f},
-std::array<float,2>{0.676055491f, 0.947139263f},
-std::array<float,2>{0.44647032f, 0.70906812f},
-std::array<float,2>{0.806975842f, 0.120962553f},
-std::array<float,2>{0.00451817131f, 0.0137813389f},
-std::array<float,2>{0.593684375f, 0.664424956f},
-std::array<float,2>{0.289754003f, 0.895908833f},
-std::array<float,2>{0.982780039f, 0.253018469f},
-std::array<float,2>{0.410341918f, 0.460149199f},
-std::array<float,2>{0.83200568f, 0.829642177f},
-std::array<float,2>{0.245087564f, 0.528901577f},
-std::array<float,2>{0.74184221f, 0.158951357f},
-std::array<float,2>{0.492585123f, 0.0716891661f},
-std::array<float,2>{0.777161717f, 0.734628558f},
-std::array<float,2>{0.149976045f, 0.998229325f},
-std::array<float,2>{0.641435146f, 0.347364426f},
-std::array<float,2>{0.0685622171f, 0.380268365f},
-std::array<float,2>{0.554020405f, 0.770896435f},
-std::array<float,2>{0.34028998f, 0.609110832f},
-std::array<float,2>{0.901223004f, 0.188920885f},
-std::array<float,2>{0.189138666f, 0.141920909f},
-std::array<float,2>{0.696956336f, 0.550983548f},
-std::array<float,2>{0.399797857f, 0.863434255f},
-std::array<float,2>{0.861139953f, 0.471486628f},
-std::array<float,2>{0.255660355f, 0.30655393f},
-std::array<float,2>{0.951381326f, 0.906880736f},
-std::array<float,2>{0.0592521355f, 0.646948934f},
-std::array<float,2>{0.608388007f, 0.0566507317f},
-std::array<float,2>{0.397308022f, 0.205125332f},
-std::array<float,2>{0.867608905f, 0.616413534f},
-std::array<float,2>{0.198029459f, 0.757876813f},
-std::array<float,2>{0.695061147f, 0.405331194f},
-std::array<float,2>{0.0502348952f, 0.370404065f},
-std::array<float,2>{0.600657701f, 0.972812533f},
-std::array<float,2>{0.26506272f, 0.721667111f},
-std::array<float,2>{0.938000083f, 0.0793248862f},
-std::array<float,2>{0.147528827f, 0.0442118421f},
-std::array<float,2>{0.652269661f, 0.639447868f},
-std::array<float,2>{0.488556236f, 0.933506966f},
-std::array<float,2>{0.771743536f, 0.294822365f},
-std::array<float,2>{0.33417064f, 0.492717117f},
-std::array<float,2>{0.896755636f, 0.853491008f},
-std::array<float,2>{0.0708316192f, 0.536579907f},
-std::array<float,2>{0.561911404f, 0.140337467f},
-std::array<float,2>{0.286533505f, 0.0952625945f},
-std::array<float,2>{0.968910694f, 0.692058086f},
-std::array<float,2>{0.00966020487f, 0.960955441f},
-std::array<float,2>{0.583951712f, 0.341667473f},
-std::array<float,2>{0.239881516f, 0.420078546f},
-std::array<float,2>{0.746275604f, 0.788884997f},
-std::array<float,2>{0.418765187f, 0.59160316f},
-std::array<float,2>{0.841109037f, 0.236300826f},
-std::array<float,2>{0.10726241f, 0.185464457f},
-std::array<float,2>{0.516112864f, 0.515603602f},
-std::array<float,2>{0.370567441f, 0.815849006f},
-std::array<float,2>{0.933134317f, 0.452201366f},
-std::array<float,2>{0.440358639f, 0.274728417f},
-std::array<float,2>{0.797363758f, 0.880370319f},
-std::array<float,2>{0.162260503f, 0.673971772f},
-std::array<float,2>{0.684532881f, 0.0241454598f},
-std::array<float,2>{0.346975625f, 0.146594658f},
-std::array<float,2>{0.919208527f, 0.549048305f},
-std::array<float,2>{0.109910846f, 0.861827374f},
-std::array<float,2>{0.50081867f, 0.473694891f},
-std::array<float,2>{0.185455233f, 0.309794068f},
-std::array<float,2>{0.669387758f, 0.911261499f},
-std::array<float,2>{0.468740404f, 0.643887579f},
-std::array<float,2>{0.790146232f, 0.0608775876f},
-std::array<float,2>{0.0261067376f, 0.0774385333f},
-std::array<float,2>{0.568076253f, 0.741293311f},
-std::array<float,2>{0.297277272f, 0.994816422f},
-std::array<float,2>{0.993658125f, 0.34820357f},
-std::array<float,2>{0.429533482f, 0.377183348f},
-std::array<float,2>{0.817409694f, 0.766624987f},
-std::array<float,2>{0.224286333f, 0.604725182f},
-std::array<float,2>{0.72539556f, 0.194587946f},
-std::array<float,2>{0.475318074f, 0.0106380498f},
-std::array<float,2>{0.763721168f, 0.671796203f},
-std::array<float,2>{0.134292841f, 0.892773449f},
-std::array<float,2>{0.629612327f, 0.257384449f},
-std::array<float,2>{0.0839941874f, 0.455122441f},
-std::array<float,2>{0.535392642f, 0.832060993f},
-std::array<float,2>{0.322061092f, 0.52609992f},
-std::array<float,2>{0.886521339f, 0.160476699f},
-std::array<float,2>{0.213399857f, 0.225960642f},
-std::array<float,2>{0.717956066f, 0.562796474f},
-std::array<float,2>{0.376112729f, 0.797128916f},
-std::array<float,2>{0.845426142f, 0.422257274f},
-std::array<float,2>{0.266436219f, 0.325959444f},
-std::array<float,2>{0.967516065f, 0.951686919f},
-std::array<float,2>{0.0379737094f, 0.705194712f},
-std::array<float,2>{0.623461187f, 0.122551568f},
-std::array<float,2>{0.457438529f, 0.171570584f},
-std::array<float,2>{0.78148669f, 0.51767683f},
-std::array<float,2>{0.17595461f, 0.842436314f},
-std::array<float,2>{0.66187036f, 0.467615336f},
-std::array<float,2>{0.122614004f, 0.265404671f},
-std::array<float,2>{0.510351062f, 0.901382864f},
-std::array<float,2>{0.357719481f, 0.659844577f},
-std::array<float,2>{0.9113729f, 0.0042275954f},
-std::array<float,2>{0.22707358f, 0.110320948f},
-std::array<float,2>{0.731630325f, 0.712753594f},
-std::array<float,2>{0.433493555f, 0.937638938f},
-std::array<float,2>{0.823856413f, 0.318633139f},
-std::array<float,2>{0.305654526f, 0.430826426f},
-std::array<float,2>{0.985597312f, 0.805215776f},
-std::array<float,2>{0.0170743261f, 0.573516488f},
-std::array<float,2>{0.575093031f, 0.231377408f},
-std::array<float,2>{0.317635119f, 0.0540809371f},
-std::array<float,2>{0.878668785f, 0.652843416f},
-std::array<float,2>{0.0907832757f, 0.914727867f},
-std::array<float,2>{0.540976167f, 0.301185846f},
-std::array<float,2>{0.131411865f, 0.478998601f},
-std::array<float,2>{0.633426845f, 0.868255734f},
-std::array<float,2>{0.479393601f, 0.562180459f},
-std::array<float,2>{0.755748332f, 0.150899246f},
-std::array<float,2>{0.045327086f, 0.195872605f},
-std::array<float,2>{0.611740887f, 0.594711065f},
-std::array<float,2>{0.274693191f, 0.779751718f},
-std::array<float,2>{0.958791018f, 0.385466397f},
-std::array<float,2>{0.390344948f, 0.352026254f},
-std::array<float,2>{0.853372097f, 0.987578273f},
-std::array<float,2>{0.205428407f, 0.748620391f},
-std::array<float,2>{0.709413171f, 0.065442048f},
-std::array<float,2>{0.250858337f, 0.245878115f},
-std::array<float,2>{0.947837055f, 0.580654204f},
-std::array<float,2>{0.0555696785f, 0.790761411f},
-std::array<float,2>{0.602300584f, 0.409745008f},
-std::array<float,2>{0.192055538f, 0.334827095f},
-std::array<float,2>{0.699921787f, 0.959870517f},
-std::array<float,2>{0.404196292f, 0.70087117f},
-std::array<float,2>{0.864904284f, 0.102713101f},
-std::array<float,2>{0.0632436424f, 0.0227480289f},
-std::array<float,2>{0.547223449f, 0.683325768f},
-std::array<float,2>{0.338804632f, 0.88844502f},
-std::array<float,2>{0.903547883f, 0.270023376f},
-std::array<float,2>{0.497894913f, 0.442312241f},
-std::array<float,2>{0.780796528f, 0.823758483f},
-std::array<float,2>{0.154047668f, 0.505087852f},
-std::array<float,2>{0.648235679f, 0.178743854f},
-std::array<float,2>{0.407937795f, 0.0912259817f},
-std::array<float,2>{0.832633615f, 0.726766884f},
-std::array<float,2>{0.249016806f, 0.976755023f},
-std::array<float,2>{0.734606624f, 0.360966712f},
-std::array<float,2>{0.000945285894f, 0.390706241f},
-std::array<float,2>{0.586123943f, 0.753266513f},
-std::array<float,2>{0.294532865f, 0.624773085f},
-std::array<float,2>{0.980156183f, 0.212109432f},
-std::array<float,2>{0.165982157f, 0.130755141f},
-std::array<float,2>{0.674489677f, 0.546697438f},
-std::array<float,2>{0.451214254f, 0.846474171f},
-std::array<float,2>{0.81075269f, 0.488635778f},
-std::array<float,2>{0.364409804f, 0.286576688f},
-std::array<float,2>{0.928033412f, 0.923104346f},
-std::array<float,2>{0.101424679f, 0.628083348f},
-std::array<float,2>{0.529926419f, 0.0343911201f},
-std::array<float,2>{0.485204279f, 0.226590589f},
-std::array<float,2>{0.768773437f, 0.576003373f},
-std::array<float,2>{0.144334018f, 0.811760426f},
-std::array<float,2>{0.653907061f, 0.434801757f},
-std::array<float,2>{0.0767885521f, 0.314749986f},
-std::array<float,2>{0.55519104f, 0.944808185f},
-std::array<float,2>{0.330236375f, 0.717546463f},
-std::array<float,2>{0.892546475f, 0.116827391f},
-std::array<float,2>{0.199982643f, 0.00226477743f},
-std::array<float,2>{0.688495517f, 0.661350369f},
-std::array<float,2>{0.394227117f, 0.905393302f},
-std::array<float,2>{0.874295056f, 0.260388792f},
-std::array<float,2>{0.25886789f, 0.463428408f},
-std::array<float,2>{0.94143939f, 0.836644709f},
-std::array<float,2>{0.0531039722f, 0.520606458f},
-std::array<float,2>{0.594064832f, 0.16650857f},
-std::array<float,2>{0.374270082f, 0.0687034801f},
-std::array<float,2>{0.934747875f, 0.743636966f},
-std::array<float,2>{0.101591058f, 0.991375029f},
-std::array<float,2>{0.520007074f, 0.35770613f},
-std::array<float,2>{0.159892097f, 0.39037019f},
-std::array<float,2>{0.68198508f, 0.775420725f},
-std::array<float,2>{0.444996834f, 0.598774433f},
-std::array<float,2>{0.803273916f, 0.201625004f},
-std::array<float,2>{0.015506967f, 0.153224856f},
-std::array<float,2>{0.580522299f, 0.554986358f},
-std::array<float,2>{0.284869999f, 0.873221636f},
-std::array<float,2>{0.974576473f, 0.481702715f},
-std::array<float,2>{0.414390355f, 0.297452927f},
-std::array<float,2>{0.839594007f, 0.919631124f},
-std::array<float,2>{0.234572932f, 0.64964962f},
-std::array<float,2>{0.74593395f, 0.0500163697f},
-std::array<float,2>{0.301099181f, 0.172544464f},
-std::array<float,2>{0.997237682f, 0.502070785f},
-std::array<float,2>{0.0281522237f, 0.825374424f},
-std::array<float,2>{0.56380266f, 0.438612938f},
-std::array<float,2>{0.220420748f, 0.266811103f},
-std::array<float,2>{0.719659448f, 0.883236945f},
-std::array<float,2>{0.424470812f, 0.685771704f},
-std::array<float,2>{0.81587857f, 0.0175228771f},
-std::array<float,2>{0.115799077f, 0.108486339f},
-std::array<float,2>{0.506744921f, 0.697719276f},
-std::array<float,2>{0.349708527f, 0.956737399f},
-std::array<float,2>{0.916288674f, 0.329831719f},
-std::array<float,2>{0.464061677f, 0.410604745f},
-std::array<float,2>{0.796569169f, 0.795155287f},
-std::array<float,2>{0.183393255f, 0.585176349f},
-std::array<float,2>{0.666247547f, 0.247514725f},
-std::array<float,2>{0.379065603f, 0.0379013941f},
-std::array<float,2>{0.849525154f, 0.629549205f},
-std::array<float,2>{0.215884f, 0.927532077f},
-std::array<float,2>{0.71371758f, 0.284269243f},
-std::array<float,2>{0.0332459733f, 0.487253815f},
-std::array<float,2>{0.61867702f, 0.85072279f},
-std::array<float,2>{0.272285938f, 0.539460301f},
-std::array<float,2>{0.964761615f, 0.128452867f},
-std::array<float,2>{0.139883891f, 0.21597369f},
-std::array<float,2>{0.627232015f, 0.617333233f},
-std::array<float,2>{0.470521152f, 0.757450223f},
-std::array<float,2>{0.76145035f, 0.395181388f},
-std::array<float,2>{0.324969858f, 0.367079735f},
-std::array<float,2>{0.890459061f, 0.984330475f},
-std::array<float,2>{0.0802339315f, 0.731783032f},
-std::array<float,2>{0.531614363f, 0.0872791186f},
-std::array<float,2>{0.43581903f, 0.13453491f},
-std::array<float,2>{0.827679098f, 0.53149569f},
-std::array<float,2>{0.230742231f, 0.856623948f},
-std::array<float,2>{0.729106069f, 0.499938875f},
-std::array<float,2>{0.0234201979f, 0.289067328f},
-std::array<float,2>{0.570343435f, 0.937458694f},
-std::array<float,2>{0.30867216f, 0.636713564f},
-std::array<float,2>{0.991743207f, 0.0425909273f},
-std::array<float,2>{0.175054669f, 0.082373701f},
-std::array<float,2>{0.660112619f, 0.722842932f},
-std::array<float,2>{0.453173548f, 0.970161855f},
-std::array<float,2>{0.785162926f, 0.372200578f},
-std::array<float,2>{0.35256359f, 0.400676072f},
-std::array<float,2>{0.907286227f, 0.762851655f},
-std::array<float,2>{0.117495559f, 0.611771822f},
-std::array<float,2>{0.514335513f, 0.208669081f},
-std::array<float,2>{0.278159916f, 0.0289439186f},
-std::array<float,2>{0.953538775f, 0.676278532f},
-std::array<float,2>{0.0391575322f, 0.875316381f},
-std::array<float,2>{0.614573121f, 0.280813664f},
-std::array<float,2>{0.209924787f, 0.449178725f},
-std::array<float,2>{0.704502225f, 0.819956183f},
-std::array<float,2>{0.384342223f, 0.510340631f},
-std::array<float,2>{0.856999099f, 0.180848524f},
-std::array<float,2>{0.0860884786f, 0.239177153f},
-std::array<float,2>{0.544187605f, 0.58680445f},
-std::array<float,2>{0.314694911f, 0.781321228f},
-std::array<float,2>{0.880732358f, 0.415019602f},
-std::array<float,2>{0.482882559f, 0.339219421f},
-std::array<float,2>{0.75017494f, 0.966532946f},
-std::array<float,2>{0.128547817f, 0.690807223f},
-std::array<float,2>{0.640347481f, 0.0980359912f},
-std::array<float,2>{0.343310565f, 0.190395281f},
-std::array<float,2>{0.900290966f, 0.605706215f},
-std::array<float,2>{0.0678806528f, 0.771980107f},
-std::array<float,2>{0.552207708f, 0.382335037f},
-std::array<float,2>{0.151683301f, 0.345425576f},
-std::array<float,2>{0.644332826f, 0.997466266f},
-std::array<float,2>{0.49464643f, 0.736957967f},
-std::array<float,2>{0.77420181f, 0.0738102645f},
-std::array<float,2>{0.0616480038f, 0.0565383807f},
-std::array<float,2>{0.606600106f, 0.646333039f},
-std::array<float,2>{0.257199556f, 0.909244835f},
-std::array<float,2>{0.949817538f, 0.308318615f},
-std::array<float,2>{0.401158392f, 0.469453782f},
-std::array<float,2>{0.86282444f, 0.86690861f},
-std::array<float,2>{0.190566823f, 0.552802444f},
-std::array<float,2>{0.698292792f, 0.143612877f},
-std::array<float,2>{0.448383987f, 0.118203014f},
-std::array<float,2>{0.805820763f, 0.708456516f},
-std::array<float,2>{0.170390502f, 0.948698044f},
-std::array<float,2>{0.679277062f, 0.321424037f},
-std::array<float,2>{0.0951851532f, 0.428665459f},
-std::array<float,2>{0.5244326f, 0.804294288f},
-std::array<float,2>{0.361865312f, 0.567799866f},
-std::array<float,2>{0.925368905f, 0.220997125f},
-std::array<float,2>{0.242834494f, 0.157986283f},
-std::array<float,2>{0.739103436f, 0.530510128f},
-std::array<float,2>{0.412110001f, 0.830809116f},
-std::array<float,2>{0.829002023f, 0.457563877f},
-std::array<float,2>{0.291272163f, 0.251771271f},
-std::array<float,2>{0.9807868f, 0.898223042f},
-std::array<float,2>{0.00703207869f, 0.667710483f},
-std::array<float,2>{0.590869427f, 0.0124000506f},
-std::array<float,2>{0.426448315f, 0.194041252f},
-std::array<float,2>{0.819831192f, 0.603543997f},
-std::array<float,2>{0.225853413f, 0.766391039f},
-std::array<float,2>{0.72440356f, 0.378665984f},
-std::array<float,2>{0.0251366571f, 0.349352777f},
-std::array<float,2>{0.568769932f, 0.995380342f},
-std::array<float,2>{0.299455076f, 0.741208971f},
-std::array<float,2>{0.995105445f, 0.0768896788f},
-std::array<float,2>{0.1864665f, 0.0624155253f},
-std::array<float,2>{0.67111814f, 0.643449724f},
-std::array<float,2>{0.466428787f, 0.911055326f},
-std::array<float,2>{0.791442513f, 0.308906049f},
-std::array<float,2>{0.343767792f, 0.473324597f},
-std::array<float,2>{0.921332121f, 0.862915814f},
-std::array<float,2>{0.111510538f, 0.550299227f},
-std::array<float,2>{0.502052009f, 0.147866696f},
-std::array<float,2>{0.267894506f, 0.121724173f},
-std::array<float,2>{0.966609478f, 0.706101418f},
-std::array<float,2>{0.0359852128f, 0.952451527f},
-std::array<float,2>{0.621361077f, 0.325062275f},
-std::array<float,2>{0.211901918f, 0.423201799f},
-std::array<float,2>{0.715619922f, 0.797996044f},
-std::array<float,2>{0.377422005f, 0.56402421f},
-std::array<float,2>{0.846624851f, 0.224717185f},
-std::array<float,2>{0.0823527202f, 0.161793113f},
-std::array<float,2>{0.538861632f, 0.526541889f},
-std::array<float,2>{0.323211372f, 0.833441973f},
-std::array<float,2>{0.88424176f, 0.456478268f},
-std::array<float,2>{0.473745853f, 0.256049037f},
-std::array<float,2>{0.76347357f, 0.894281924f},
-std::array<float,2>{0.136291206f, 0.670334458f},
-std::array<float,2>{0.632111192f, 0.011373206f},
-std::array<float,2>{0.333436579f, 0.138810828f},
-std::array<float,2>{0.896260202f, 0.535283506f},
-std::array<float,2>{0.0726994723f, 0.852302969f},
-std::array<float,2>{0.560402095f, 0.494010478f},
-std::array<float,2>{0.14539811f, 0.293401957f},
-std::array<float,2>{0.650279641f, 0.931931794f},
-std::array<float,2>{0.491634548f, 0.63975507f},
-std::array<float,2>{0.769839108f, 0.0435389653f},
-std::array<float,2>{0.0476473197f, 0.0789798722f},
-std::array<float,2>{0.598128915f, 0.722332418f},
-std::array<float,2>{0.263392746f, 0.973967731f},
-std::array<float,2>{0.941184163f, 0.369909823f},
-std::array<float,2>{0.395088315f, 0.404953778f},
-std::array<float,2>{0.870890379f, 0.759415627f},
-std::array<float,2>{0.197101265f, 0.615555286f},
-std::array<float,2>{0.692601502f, 0.207024142f},
-std::array<float,2>{0.439132154f, 0.0245521758f},
-std::array<float,2>{0.79891789f, 0.674813867f},
-std::array<float,2>{0.160644323f, 0.87942487f},
-std::array<float,2>{0.685830832f, 0.273561597f},
-std::array<float,2>{0.107830025f, 0.4519054f},
-std::array<float,2>{0.518278837f, 0.814875126f},
-std::array<float,2>{0.368701458f, 0.513954043f},
-std::array<float,2>{0.931190968f, 0.183763221f},
-std::array<float,2>{0.241351277f, 0.235205606f},
-std::array<float,2>{0.748728156f, 0.590081513f},
-std::array<float,2>{0.420657545f, 0.787843227f},
-std::array<float,2>{0.842760742f, 0.421627223f},
-std::array<float,2>{0.288619667f, 0.34016791f},
-std::array<float,2>{0.971049607f, 0.962237835f},
-std::array<float,2>{0.0106878271f, 0.692623079f},
-std::array<float,2>{0.585504591f, 0.0941411257f},
-std::array<float,2>{0.498581886f, 0.178264454f},
-std::array<float,2>{0.778393686f, 0.504709303f},
-std::array<float,2>{0.15535292f, 0.823063195f},
-std::array<float,2>{0.645150542f, 0.442943633f},
-std::array<float,2>{0.0655376837f, 0.271293253f},
-std::array<float,2>{0.549747705f, 0.886995137f},
-std::array<float,2>{0.335993528f, 0.682327688f},
-std::array<float,2>{0.904413998f, 0.021877937f},
-std::array<float,2>{0.194489211f, 0.101952665f},
-std::array<float,2>{0.702729821f, 0.699741721f},
-std::array<float,2>{0.405508459f, 0.960876644f},
-std::array<float,2>{0.865967453f, 0.33498469f},
-std::array<float,2>{0.25343138f, 0.40863353f},
-std::array<float,2>{0.945719838f, 0.789297938f},
-std::array<float,2>{0.0578119457f, 0.581373155f},
-std::array<float,2>{0.604531348f, 0.244472116f},
-std::array<float,2>{0.365809917f, 0.0340056941f},
-std::array<float,2>{0.927410066f, 0.627902865f},
-std::array<float,2>{0.0989991054f, 0.922434807f},
-std::array<float,2>{0.528876364f, 0.285646737f},
-std::array<float,2>{0.167934552f, 0.489908487f},
-std::array<float,2>{0.672687769f, 0.847164571f},
-std::array<float,2>{0.450594723f, 0.544993103f},
-std::array<float,2>{0.80898571f, 0.129425466f},
-std::array<float,2>{0.00254975283f, 0.211807549f},
-std::array<float,2>{0.589765251f, 0.623164654f},
-std::array<float,2>{0.296845943f, 0.752549887f},
-std::array<float,2>{0.977081597f, 0.39164573f},
-std::array<float,2>{0.409640431f, 0.359856218f},
-std::array<float,2>{0.835199714f, 0.978505909f},
-std::array<float,2>{0.24722141f, 0.728118718f},
-std::array<float,2>{0.738225102f, 0.0906257182f},
-std::array<float,2>{0.307715774f, 0.231677994f},
-std::array<float,2>{0.987898886f, 0.573081076f},
-std::array<float,2>{0.0185081828f, 0.806222796f},
-std::array<float,2>{0.576299012f, 0.429742813f},
-std::array<float,2>{0.228911549f, 0.319859505f},
-std::array<float,2>{0.732923567f, 0.938530624f},
-std::array<float,2>{0.430982739f, 0.711829901f},
-std::array<float,2>{0.821594357f, 0.11088746f},
-std::array<float,2>{0.123525657f, 0.00570929935f},
-std::array<float,2>{0.508190513f, 0.659081399f},
-std::array<float,2>{0.356903791f, 0.90069586f},
-std::array<float,2>{0.913591444f, 0.264416873f},
-std::array<float,2>{0.460920036f, 0.468216032f},
-std::array<float,2>{0.783293724f, 0.843744159f},
-std::array<float,2>{0.177839354f, 0.519112766f},
-std::array<float,2>{0.663863182f, 0.170322984f},
-std::array<float,2>{0.387824118f, 0.0651991069f},
-std::array<float,2>{0.855269372f, 0.749167979f},
-std::array<float,2>{0.2033813f, 0.986467123f},
-std::array<float,2>{0.707637846f, 0.353092223f},
-std::array<float,2>{0.0432688035f, 0.385944009f},
-std::array<float,2>{0.610501885f, 0.78060168f},
-std::array<float,2>{0.276689976f, 0.595542908f},
-std::array<float,2>{0.95962286f, 0.197239026f},
-std::array<float,2>{0.129751742f, 0.151379332f},
-std::array<float,2>{0.635273993f, 0.561504543f},
-std::array<float,2>{0.476719439f, 0.867620349f},
-std::array<float,2>{0.757108688f, 0.479581267f},
-std::array<float,2>{0.318659246f, 0.301836163f},
-std::array<float,2>{0.875894725f, 0.915050447f},
-std::array<float,2>{0.0929430276f, 0.653990865f},
-std::array<float,2>{0.541753829f, 0.0531853102f},
-std::array<float,2>{0.462760121f, 0.246685758f},
-std::array<float,2>{0.793899953f, 0.584140837f},
-std::array<float,2>{0.181340426f, 0.796545327f},
-std::array<float,2>{0.665987134f, 0.411497235f},
-std::array<float,2>{0.114635207f, 0.328891307f},
-std::array<float,2>{0.505658567f, 0.95557785f},
-std::array<float,2>{0.348451138f, 0.698611319f},
-std::array<float,2>{0.914765298f, 0.107648492f},
-std::array<float,2>{0.222497329f, 0.0165467821f},
-std::array<float,2>{0.72213304f, 0.687045276f},
-std::array<float,2>{0.42348069f, 0.884461701f},
-std::array<float,2>{0.813900173f, 0.266292155f},
-std::array<float,2>{0.304146498f, 0.437605917f},
-std::array<float,2>{0.999849796f, 0.824504673f},
-std::array<float,2>{0.0295282733f, 0.5034554f},
-std::array<float,2>{0.564571381f, 0.173389658f},
-std::array<float,2>{0.328123629f, 0.0866500586f},
-std::array<float,2>{0.88771522f, 0.730521023f},
-std::array<float,2>{0.0794797689f, 0.982759058f},
-std::array<float,2>{0.534727156f, 0.365510911f},
-std::array<float,2>{0.137713134f, 0.395828009f},
-std::array<float,2>{0.626316488f, 0.756268144f},
-std::array<float,2>{0.471714407f, 0.618865132f},
-std::array<float,2>{0.759256899f, 0.215449646f},
-std::array<float,2>{0.0321126059f, 0.127523184f},
-std::array<float,2>{0.620314896f, 0.540696323f},
-std::array<float,2>{0.270185024f, 0.84995842f},
-std::array<float,2>{0.962342083f, 0.48794049f},
-std::array<float,2>{0.381897986f, 0.284112543f},
-std::array<float,2>{0.849683166f, 0.926733375f},
-std::array<float,2>{0.218237638f, 0.630324543f},
-std::array<float,2>{0.711353719f, 0.0386055931f},
-std::array<float,2>{0.261551946f, 0.16767545f},
-std::array<float,2>{0.944833696f, 0.520384371f},
-std::array<float,2>{0.051017452f, 0.83739841f},
-std::array<float,2>{0.596891224f, 0.463994831f},
-std::array<float,2>{0.202605262f, 0.261221975f},
-std::array<float,2>{0.689698637f, 0.90484786f},
-std::array<float,2>{0.391092241f, 0.661118567f},
-std::array<float,2>{0.872588277f, 0.00309416465f},
-std::array<float,2>{0.0749406219f, 0.11598257f},
-std::array<float,2>{0.556798935f, 0.7185058f},
-std::array<float,2>{0.329806119f, 0.943822443f},
-std::array<float,2>{0.894509733f, 0.315865666f},
-std::array<float,2>{0.486890376f, 0.434037685f},
-std::array<float,2>{0.766673088f, 0.811415792f},
-std::array<float,2>{0.14254193f, 0.574687362f},
-std::array<float,2>{0.655376911f, 0.228177294f},
-std::array<float,2>{0.417953193f, 0.0495955609f},
-std::array<float,2>{0.837262571f, 0.648816168f},
-std::array<float,2>{0.237987712f, 0.918449342f},
-std::array<float,2>{0.743512452f, 0.298086405f},
-std::array<float,2>{0.0125119714f, 0.480770648f},
-std::array<float,2>{0.579286814f, 0.874346673f},
-std::array<float,2>{0.282005578f, 0.556167841f},
-std::array<float,2>{0.975475132f, 0.153755262f},
-std::array<float,2>{0.157144248f, 0.203046471f},
-std::array<float,2>{0.681025267f, 0.598457813f},
-std::array<float,2>{0.442994893f, 0.777000129f},
-std::array<float,2>{0.801268578f, 0.388889223f},
-std::array<float,2>{0.372654051f, 0.359113783f},
-std::array<float,2>{0.936766267f, 0.990779042f},
-std::array<float,2>{0.104832284f, 0.742801249f},
-std::array<float,2>{0.521754563f, 0.0700534433f},
-std::array<float,2>{0.398908377f, 0.143111795f},
-std::array<float,2>{0.86016655f, 0.554581881f},
-std::array<float,2>{0.187974393f, 0.865897954f},
-std::array<float,2>{0.6953637f, 0.470413238f},
-std::array<float,2>{0.0595723689f, 0.307095021f},
-std::array<float,2>{0.609331608f, 0.908694029f},
-std::array<float,2>{0.254524976f, 0.644897461f},
-std::array<float,2>{0.952539504f, 0.054914549f},
-std::array<float,2>{0.148952872f, 0.0728663057f},
-std::array<float,2>{0.642001927f, 0.73799324f},
-std::array<float,2>{0.493254155f, 0.996544361f},
-std::array<float,2>{0.775847673f, 0.34383893f},
-std::array<float,2>{0.34170717f, 0.381662041f},
-std::array<float,2>{0.901559651f, 0.772578239f},
-std::array<float,2>{0.0700751841f, 0.607213676f},
-std::array<float,2>{0.553456545f, 0.1911695f},
-std::array<float,2>{0.290622205f, 0.0133491764f},
-std::array<float,2>{0.984051168f, 0.666856647f},
-std::array<float,2>{0.00544221792f, 0.896486998f},
-std::array<float,2>{0.592237771f, 0.250646651f},
-std::array<float,2>{0.245579287f, 0.458303064f},
-std::array<float,2>{0.741033852f, 0.831747234f},
-std::array<float,2>{0.41187939f, 0.530265331f},
-std::array<float,2>{0.830571771f, 0.156470433f},
-std::array<float,2>{0.0964462459f, 0.222190335f},
-std::array<float,2>{0.52591753f, 0.566510022f},
-std::array<float,2>{0.360994726f, 0.802819729f},
-std::array<float,2>{0.923105538f, 0.428998381f},
-std::array<float,2>{0.445746064f, 0.320335418f},
-std::array<float,2>{0.808197737f, 0.947758496f},
-std::array<float,2>{0.168283194f, 0.707343161f},
-std::array<float,2>{0.677435577f, 0.11776153f},
-std::array<float,2>{0.354173154f, 0.207259402f},
-std::array<float,2>{0.908225298f, 0.612934351f},
-std::array<float,2>{0.120498799f, 0.761777461f},
-std::array<float,2>{0.512054801f, 0.40192011f},
-std::array<float,2>{0.172052518f, 0.371234119f},
-std::array<float,2>{0.657761812f, 0.969667375f},
-std::array<float,2>{0.45508942f, 0.723679483f},
-std::array<float,2>{0.788925529f, 0.0834876671f},
-std::array<float,2>{0.0214496031f, 0.0411356874f},
-std::array<float,2>{0.572656929f, 0.635254741f},
-std::array<float,2>{0.311360836f, 0.936037958f},
-std::array<float,2>{0.988774121f, 0.290996283f},
-std::array<float,2>{0.435262024f, 0.498167694f},
-std::array<float,2>{0.825664341f, 0.856336236f},
-std::array<float,2>{0.233735561f, 0.532426238f},
-std::array<float,2>{0.727006435f, 0.132965595f},
-std::array<float,2>{0.481104195f, 0.0991790146f},
-std::array<float,2>{0.75343138f, 0.690243363f},
-std::array<float,2>{0.125544071f, 0.965600491f},
-std::array<float,2>{0.638071239f, 0.33840549f},
-std::array<float,2>{0.0884628072f, 0.415406793f},
-std::array<float,2>{0.545611382f, 0.782745183f},
-std::array<float,2>{0.313597143f, 0.58773458f},
-std::array<float,2>{0.882393837f, 0.239530116f},
-std::array<float,2>{0.207772091f, 0.179948315f},
-std::array<float,2>{0.706166506f, 0.511604011f},
-std::array<float,2>{0.384898126f, 0.819070101f},
-std::array<float,2>{0.858027458f, 0.447419226f},
-std::array<float,2>{0.281153917f, 0.279735714f},
-std::array<float,2>{0.956156671f, 0.876546621f},
-std::array<float,2>{0.0410244092f, 0.677709818f},
-std::array<float,2>{0.616614163f, 0.0274347533f},
-std::array<float,2>{0.375092894f, 0.222765937f},
-std::array<float,2>{0.844232619f, 0.565077484f},
-std::array<float,2>{0.214197725f, 0.799185336f},
-std::array<float,2>{0.717679381f, 0.425022811f},
-std::array<float,2>{0.0382948034f, 0.327673078f},
-std::array<float,2>{0.624134362f, 0.95083791f},
-std::array<float,2>{0.267204881f, 0.704790533f},
-std::array<float,2>{0.967953563f, 0.12483371f},
-std::array<float,2>{0.133230105f, 0.00867102481f},
-std::array<float,2>{0.630352855f, 0.669428289f},
-std::array<float,2>{0.475951463f, 0.891169429f},
-std::array<float,2>{0.76517427f, 0.254275233f},
-std::array<float,2>{0.320423186f, 0.454472452f},
-std::array<float,2>{0.885571003f, 0.835697055f},
-std::array<float,2>{0.0849875286f, 0.524678528f},
-std::array<float,2>{0.536939323f, 0.162280366f},
-std::array<float,2>{0.298786521f, 0.0745959729f},
-std::array<float,2>{0.992289007f, 0.740098715f},
-std::array<float,2>{0.0273073297f, 0.993307352f},
-std::array<float,2>{0.566788971f, 0.35153991f},
-std::array<float,2>{0.222806752f, 0.376776457f},
-std::array<float,2>{0.72598964f, 0.767731071f},
-std::array<float,2>{0.428488553f, 0.603237808f},
-std::array<float,2>{0.817156553f, 0.191962004f},
-std::array<float,2>{0.111070454f, 0.145395815f},
-std::array<float,2>{0.501930773f, 0.548267722f},
-std::array<float,2>{0.346575946f, 0.860885441f},
-std::array<float,2>{0.918087125f, 0.475711226f},
-std::array<float,2>{0.466826946f, 0.31204477f},
-std::array<float,2>{0.789943576f, 0.914031506f},
-std::array<float,2>{0.184181765f, 0.640850067f},
-std::array<float,2>{0.668170869f, 0.0591903552f},
-std::array<float,2>{0.369636118f, 0.185999006f},
-std::array<float,2>{0.932427466f, 0.511903703f},
-std::array<float,2>{0.10634964f, 0.813741565f},
-std::array<float,2>{0.51726228f, 0.449963808f},
-std::array<float,2>{0.1638055f, 0.275917351f},
-std::array<float,2>{0.685388088f, 0.882712543f},
-std::array<float,2>{0.440459073f, 0.673006415f},
-std::array<float,2>{0.798408687f, 0.0257734526f},
-std::array<float,2>{0.00878670812f, 0.096933946f},
-std::array<float,2>{0.582761109f, 0.694750309f},
-std::array<float,2>{0.285607219f, 0.963294685f},
-std::array<float,2>{0.970247209f, 0.343144f},
-std::array<float,2>{0.418967217f, 0.418825239f},
-std::array<float,2>{0.840703726f, 0.78611207f},
-std::array<float,2>{0.238963798f, 0.592889905f},
-std::array<float,2>{0.747204542f, 0.237907603f},
-std::array<float,2>{0.489703029f, 0.0467162915f},
-std::array<float,2>{0.773423493f, 0.637342513f},
-std::array<float,2>{0.146822482f, 0.931298018f},
-std::array<float,2>{0.651169777f, 0.295084476f},
-std::array<float,2>{0.0719244406f, 0.495508492f},
-std::array<float,2>{0.56100893f, 0.854664385f},
-std::array<float,2>{0.33499971f, 0.537246346f},
-std::array<float,2>{0.898363054f, 0.138116196f},
-std::array<float,2>{0.198856235f, 0.20398739f},
-std::array<float,2>{0.693626702f, 0.614078403f},
-std::array<float,2>{0.398167908f, 0.76094234f},
-std::array<float,2>{0.868378818f, 0.4034352f},
-std::array<float,2>{0.263696939f, 0.368184268f},
-std::array<float,2>{0.938594222f, 0.976024926f},
-std::array<float,2>{0.0488521308f, 0.720155656f},
-std::array<float,2>{0.600400269f, 0.0802588537f},
-std::array<float,2>{0.452356279f, 0.1315635f},
-std::array<float,2>{0.811603189f, 0.544388056f},
-std::array<float,2>{0.164192185f, 0.845347285f},
-std::array<float,2>{0.67545855f, 0.490768194f},
-std::array<float,2>{0.0997245312f, 0.288587928f},
-std::array<float,2>{0.530982614f, 0.923890173f},
-std::array<float,2>{0.36343962f, 0.625528812f},
-std::array<float,2>{0.929177344f, 0.0324356928f},
-std::array<float,2>{0.249387696f, 0.0937268436f},
-std::array<float,2>{0.735861897f, 0.730208755f},
-std::array<float,2>{0.406718224f, 0.97881633f},
-std::array<float,2>{0.833722651f, 0.362029433f},
-std::array<float,2>{0.293742955f, 0.393252462f},
-std::array<float,2>{0.978865862f, 0.751767755f},
-std::array<float,2>{0.00110750122f, 0.62126255f},
-std::array<float,2>{0.587836087f, 0.213678584f},
-std::array<float,2>{0.339309543f, 0.0212335177f},
-std::array<float,2>{0.902965724f, 0.68130517f},
-std::array<float,2>{0.0644194335f, 0.890533566f},
-std::array<float,2>{0.548633754f, 0.271838099f},
-std::array<float,2>{0.152716681f, 0.443363011f},
-std::array<float,2>{0.646720886f, 0.821461856f},
-std::array<float,2>{0.496698976f, 0.506776869f},
-std::array<float,2>{0.779372394f, 0.177628323f},
-std::array<float,2>{0.0561203435f, 0.243569687f},
-std::array<float,2>{0.603206933f, 0.57915324f},
-std::array<float,2>{0.251140356f, 0.792451859f},
-std::array<float,2>{0.949209094f, 0.407286912f},
-std::array<float,2>{0.402704298f, 0.332196653f},
-std::array<float,2>{0.863889694f, 0.957439423f},
-std::array<float,2>{0.192951798f, 0.703069508f},
-std::array<float,2>{0.700707257f, 0.103783011f},
-std::array<float,2>{0.27386272f, 0.198382139f},
-std::array<float,2>{0.957883418f, 0.596676469f},
-std::array<float,2>{0.0461750217f, 0.777952433f},
-std::array<float,2>{0.613236666f, 0.383332372f},
-std::array<float,2>{0.206781924f, 0.353731215f},
-std::array<float,2>{0.710532188f, 0.985999167f},
-std::array<float,2>{0.389377683f, 0.747395635f},
-std::array<float,2>{0.851869762f, 0.0629585534f},
-std::array<float,2>{0.0908949003f, 0.0520037971f},
-std::array<float,2>{0.539527297f, 0.655529559f},
-std::array<float,2>{0.317097604f, 0.917762637f},
-std::array<float,2>{0.877420306f, 0.304261625f},
-std::array<float,2>{0.479874223f, 0.477518678f},
-std::array<float,2>{0.754624605f, 0.870397806f},
-std::array<float,2>{0.13268283f, 0.559040606f},
-std::array<float,2>{0.63469851f, 0.149488479f},
-std::array<float,2>{0.431671888f, 0.111825205f},
-std::array<float,2>{0.822843671f, 0.714308977f},
-std::array<float,2>{0.227827564f, 0.940278172f},
-std::array<float,2>{0.730979919f, 0.317455888f},
-std::array<float,2>{0.0156532321f, 0.433001846f},
-std::array<float,2>{0.575649977f, 0.807922721f},
-std::array<float,2>{0.30619511f, 0.571510971f},
-std::array<float,2>{0.985169888f, 0.234199077f},
-std::array<float,2>{0.177572072f, 0.168365881f},
-std::array<float,2>{0.66034925f, 0.517164707f},
-std::array<float,2>{0.458272159f, 0.841678679f},
-std::array<float,2>{0.782579362f, 0.466672063f},
-std::array<float,2>{0.359371066f, 0.263532549f},
-std::array<float,2>{0.910475791f, 0.899003804f},
-std::array<float,2>{0.122067466f, 0.656737983f},
-std::array<float,2>{0.511593461f, 0.00586842978f},
-std::array<float,2>{0.469158053f, 0.218455493f},
-std::array<float,2>{0.7603212f, 0.620202601f},
-std::array<float,2>{0.138854012f, 0.753933132f},
-std::array<float,2>{0.62865591f, 0.398348033f},
-std::array<float,2>{0.0818062276f, 0.36475876f},
-std::array<float,2>{0.532538533f, 0.980534792f},
-std::array<float,2>{0.325266838f, 0.734062791f},
-std::array<float,2>{0.889213979f, 0.0880010501f},
-std::array<float,2>{0.215648666f, 0.0358579382f},
-std::array<float,2>{0.714130104f, 0.631124437f},
-std::array<float,2>{0.380833477f, 0.92949146f},
-std::array<float,2>{0.848036885f, 0.283163369f},
-std::array<float,2>{0.273247898f, 0.485447437f},
-std::array<float,2>{0.963212311f, 0.849356174f},
-std::array<float,2>{0.0350232199f, 0.542043209f},
-std::array<float,2>{0.618011951f, 0.126928434f},
-std::array<float,2>{0.35143888f, 0.106164567f},
-std::array<float,2>{0.917757213f, 0.696655691f},
-std::array<float,2>{0.116930798f, 0.955026329f},
-std::array<float,2>{0.507001638f, 0.330534875f},
-std::array<float,2>{0.181848422f, 0.412577599f},
-std::array<float,2>{0.667902708f, 0.793685734f},
-std::array<float,2>{0.463774383f, 0.583745539f},
-std::array<float,2>{0.795326471f, 0.249255344f},
-std::array<float,2>{0.0288845859f, 0.174867705f},
-std::array<float,2>{0.563336313f, 0.500255883f},
-std::array<float,2>{0.302533299f, 0.827668011f},
-std::array<float,2>{0.996390522f, 0.441129506f},
-std::array<float,2>{0.425524145f, 0.269489795f},
-std::array<float,2>{0.8150298f, 0.884810865f},
-std::array<float,2>{0.219297618f, 0.684350669f},
-std::array<float,2>{0.720614433f, 0.0179362893f},
-std::array<float,2>{0.283690065f, 0.155610591f},
-std::array<float,2>{0.97339499f, 0.557446361f},
-std::array<float,2>{0.0141273923f, 0.872092605f},
-std::array<float,2>{0.581179678f, 0.483840883f},
-std::array<float,2>{0.236200109f, 0.299948096f},
-std::array<float,2>{0.744497895f, 0.920473278f},
-std::array<float,2>{0.415498644f, 0.652284861f},
-std::array<float,2>{0.838676155f, 0.0482608005f},
-std::array<float,2>{0.103455074f, 0.0664128885f},
-std::array<float,2>{0.521254003f, 0.745385766f},
-std::array<float,2>{0.373960137f, 0.988617063f},
-std::array<float,2>{0.933785379f, 0.356159866f},
-std::array<float,2>{0.443889886f, 0.387540191f},
-std::array<float,2>{0.803774476f, 0.773934245f},
-std::array<float,2>{0.15882811f, 0.600509048f},
-std::array<float,2>{0.682843149f, 0.199956104f},
-std::array<float,2>{0.393095344f, 0.00048176304f},
-std::array<float,2>{0.873214602f, 0.663402081f},
-std::array<float,2>{0.200546756f, 0.903923869f},
-std::array<float,2>{0.68806529f, 0.258921206f},
-std::array<float,2>{0.0544966683f, 0.461198956f},
-std::array<float,2>{0.595273197f, 0.838326216f},
-std::array<float,2>{0.257991254f, 0.52244997f},
-std::array<float,2>{0.942991734f, 0.164232984f},
-std::array<float,2>{0.142635643f, 0.230008602f},
-std::array<float,2>{0.652912617f, 0.577499151f},
-std::array<float,2>{0.486227304f, 0.809177279f},
-std::array<float,2>{0.768354774f, 0.436563551f},
-std::array<float,2>{0.331638157f, 0.313018799f},
-std::array<float,2>{0.891154528f, 0.942411184f},
-std::array<float,2>{0.0775237307f, 0.715926588f},
-std::array<float,2>{0.555671096f, 0.114377528f},
-std::array<float,2>{0.413284361f, 0.159248576f},
-std::array<float,2>{0.829153061f, 0.527378678f},
-std::array<float,2>{0.244013891f, 0.82856077f},
-std::array<float,2>{0.739723146f, 0.45933646f},
-std::array<float,2>{0.00646688836f, 0.25284034f},
-std::array<float,2>{0.590319991f, 0.895130634f},
-std::array<float,2>{0.292758286f, 0.66569525f},
-std::array<float,2>{0.981672585f, 0.0152585516f},
-std::array<float,2>{0.171648994f, 0.120017655f},
-std::array<float,2>{0.67832166f, 0.710024238f},
-std::array<float,2>{0.447292477f, 0.945874393f},
-std::array<float,2>{0.805517256f, 0.322583467f},
-std::array<float,2>{0.362739474f, 0.426245421f},
-std::array<float,2>{0.924371004f, 0.802042365f},
-std::array<float,2>{0.0943132564f, 0.569330275f},
-std::array<float,2>{0.523946166f, 0.219031006f},
-std::array<float,2>{0.256419957f, 0.0582231991f},
-std::array<float,2>{0.950944304f, 0.647691905f},
-std::array<float,2>{0.0611770079f, 0.908063471f},
-std::array<float,2>{0.606263697f, 0.304943621f},
-std::array<float,2>{0.190151289f, 0.472435862f},
-std::array<float,2>{0.697291315f, 0.864930987f},
-std::array<float,2>{0.401371568f, 0.552037895f},
-std::array<float,2>{0.862243474f, 0.141543165f},
-std::array<float,2>{0.0672541112f, 0.188207299f},
-std::array<float,2>{0.551163912f, 0.60762763f},
-std::array<float,2>{0.342220753f, 0.770208061f},
-std::array<float,2>{0.89937979f, 0.379318297f},
-std::array<float,2>{0.495119631f, 0.346653998f},
-std::array<float,2>{0.775158346f, 0.999287367f},
-std::array<float,2>{0.150482893f, 0.735525012f},
-std::array<float,2>{0.643398106f, 0.0710806921f},
-std::array<float,2>{0.315544754f, 0.241064012f},
-std::array<float,2>{0.879582286f, 0.589238942f},
-std::array<float,2>{0.0870203972f, 0.784227312f},
-std::array<float,2>{0.543163061f, 0.417060167f},
-std::array<float,2>{0.1270888f, 0.336884707f},
-std::array<float,2>{0.638932049f, 0.966848969f},
-std::array<float,2>{0.484015673f, 0.688800156f},
-std::array<float,2>{0.751118004f, 0.100693919f},
-std::array<float,2>{0.040051505f, 0.0303314738f},
-std::array<float,2>{0.614144802f, 0.679686546f},
-std::array<float,2>{0.278367549f, 0.878318012f},
-std::array<float,2>{0.954716265f, 0.277509689f},
-std::array<float,2>{0.383233309f, 0.446489364f},
-std::array<float,2>{0.856104732f, 0.818158746f},
-std::array<float,2>{0.210626572f, 0.508149385f},
-std::array<float,2>{0.703761876f, 0.183262318f},
-std::array<float,2>{0.454799026f, 0.085928224f},
-std::array<float,2>{0.786297321f, 0.725322008f},
-std::array<float,2>{0.174042776f, 0.971081972f},
-std::array<float,2>{0.659151137f, 0.373552203f},
-std::array<float,2>{0.118931979f, 0.399670482f},
-std::array<float,2>{0.514722884f, 0.764583945f},
-std::array<float,2>{0.352407902f, 0.609455943f},
-std::array<float,2>{0.906360805f, 0.210013077f},
-std::array<float,2>{0.231679395f, 0.136236608f},
-std::array<float,2>{0.729611337f, 0.53451401f},
-std::array<float,2>{0.437481642f, 0.857774079f},
-std::array<float,2>{0.826969087f, 0.496747792f},
-std::array<float,2>{0.31054157f, 0.292832911f},
-std::array<float,2>{0.991086602f, 0.933605909f},
-std::array<float,2>{0.0224434659f, 0.633403718f},
-std::array<float,2>{0.57159096f, 0.0397239551f},
-std::array<float,2>{0.431536585f, 0.233565643f},
-std::array<float,2>{0.822196424f, 0.572087407f},
-std::array<float,2>{0.229263738f, 0.808339894f},
-std::array<float,2>{0.732695401f, 0.433267266f},
-std::array<float,2>{0.0178509634f, 0.318128437f},
-std::array<float,2>{0.576764226f, 0.93971169f},
-std::array<float,2>{0.308299243f, 0.714566112f},
-std::array<float,2>{0.987349153f, 0.111481488f},
-std::array<float,2>{0.178558797f, 0.006572315f},
-std::array<float,2>{0.663487613f, 0.656979442f},
-std::array<float,2>{0.460389346f, 0.898495734f},
-std::array<float,2>{0.783902407f, 0.262826592f},
-std::array<float,2>{0.357015401f, 0.465976655f},
-std::array<float,2>{0.913526475f, 0.840997875f},
-std::array<float,2>{0.123560809f, 0.516703486f},
-std::array<float,2>{0.508539438f, 0.168760195f},
-std::array<float,2>{0.277214408f, 0.0632211491f},
-std::array<float,2>{0.9593153f, 0.747882426f},
-std::array<float,2>{0.04387955f, 0.985595405f},
-std::array<float,2>{0.611283541f, 0.354134738f},
-std::array<float,2>{0.2039437f, 0.383148521f},
-std::array<float,2>{0.70719254f, 0.777374327f},
-std::array<float,2>{0.388589531f, 0.595798075f},
-std::array<float,2>{0.854594409f, 0.198800221f},
-std::array<float,2>{0.093580626f, 0.150024921f},
-std::array<float,2>{0.541243792f, 0.559219062f},
-std::array<float,2>{0.319060624f, 0.870882392f},
-std::array<float,2>{0.875413895f, 0.47702691f},
-std::array<float,2>{0.477283508f, 0.303762794f},
-std::array<float,2>{0.757391632f, 0.917048037f},
-std::array<float,2>{0.129037067f, 0.6562168f},
-std::array<float,2>{0.634845793f, 0.0522954166f},
-std::array<float,2>{0.336887807f, 0.17698437f},
-std::array<float,2>{0.904910684f, 0.50611186f},
-std::array<float,2>{0.0662877113f, 0.821890414f},
-std::array<float,2>{0.549056947f, 0.443872213f},
-std::array<float,2>{0.156010777f, 0.272383183f},
-std::array<float,2>{0.644906998f, 0.890046477f},
-std::array<float,2>{0.498067021f, 0.68066895f},
-std::array<float,2>{0.779071152f, 0.0208086018f},
-std::array<float,2>{0.0581820533f, 0.104047902f},
-std::array<float,2>{0.605174124f, 0.702171087f},
-std::array<float,2>{0.253009319f, 0.957746387f},
-std::array<float,2>{0.946220696f, 0.332731545f},
-std::array<float,2>{0.406184733f, 0.407974005f},
-std::array<float,2>{0.865722597f, 0.792645335f},
-std::array<float,2>{0.19482781f, 0.5797562f},
-std::array<float,2>{0.702424228f, 0.243652806f},
-std::array<float,2>{0.450758576f, 0.0328897126f},
-std::array<float,2>{0.809560597f, 0.625255585f},
-std::array<float,2>{0.167204201f, 0.924727619f},
-std::array<float,2>{0.672276676f, 0.288371444f},
-std::array<float,2>{0.0995365679f, 0.490447074f},
-std::array<float,2>{0.528649211f, 0.844834924f},
-std::array<float,2>{0.365717053f, 0.544575989f},
-std::array<float,2>{0.927037179f, 0.130914137f},
-std::array<float,2>{0.247666493f, 0.213147134f},
-std::array<float,2>{0.737357736f, 0.622032583f},
-std::array<float,2>{0.410100907f, 0.751381516f},
-std::array<float,2>{0.835852087f, 0.392881811f},
-std::array<float,2>{0.296198815f, 0.361582875f},
-std::array<float,2>{0.976676762f, 0.979093015f},
-std::array<float,2>{0.0022503871f, 0.729512513f},
-std::array<float,2>{0.589223087f, 0.0932282582f},
-std::array<float,2>{0.491949677f, 0.138454601f},
-std::array<float,2>{0.770318747f, 0.537861168f},
-std::array<float,2>{0.144681439f, 0.855268121f},
-std::array<float,2>{0.649623215f, 0.495613396f},
-std::array<float,2>{0.073090069f, 0.295619667f},
-std::array<float,2>{0.559619009f, 0.930804968f},
-std::array<float,2>{0.333747268f, 0.636962414f},
-std::array<float,2>{0.895625353f, 0.0463393256f},
-std::array<float,2>{0.196669191f, 0.0807723701f},
-std::array<float,2>{0.693181574f, 0.720617235f},
-std::array<float,2>{0.394811392f, 0.97639823f},
-std::array<float,2>{0.870254874f, 0.369036138f},
-std::array<float,2>{0.262922972f, 0.404085815f},
-std::array<float,2>{0.94081223f, 0.761633754f},
-std::array<float,2>{0.0473604761f, 0.613307774f},
-std::array<float,2>{0.598354995f, 0.203163669f},
-std::array<float,2>{0.36852783f, 0.0262198895f},
-std::array<float,2>{0.931087255f, 0.673728764f},
-std::array<float,2>{0.108267382f, 0.882052958f},
-std::array<float,2>{0.517659009f, 0.275818139f},
-std::array<float,2>{0.16111432f, 0.449364156f},
-std::array<float,2>{0.686376214f, 0.814317524f},
-std::array<float,2>{0.438677669f, 0.512225151f},
-std::array<float,2>{0.799627781f, 0.186370507f},
-std::array<float,2>{0.0101196514f, 0.237739488f},
-std::array<float,2>{0.585233331f, 0.593665779f},
-std::array<float,2>{0.288134247f, 0.785487533f},
-std::array<float,2>{0.971293926f, 0.418401301f},
-std::array<float,2>{0.419960946f, 0.343419313f},
-std::array<float,2>{0.842114627f, 0.963519037f},
-std::array<float,2>{0.241872758f, 0.695107698f},
-std::array<float,2>{0.748498142f, 0.0976083726f},
-std::array<float,2>{0.298980057f, 0.191608876f},
-std::array<float,2>{0.994175971f, 0.60297668f},
-std::array<float,2>{0.0247951504f, 0.768254697f},
-std::array<float,2>{0.5690099f, 0.376119316f},
-std::array<float,2>{0.226105705f, 0.350648493f},
-std::array<float,2>{0.723902047f, 0.993873537f},
-std::array<float,2>{0.425878286f, 0.739584208f},
-std::array<float,2>{0.819482684f, 0.0750732869f},
-std::array<float,2>{0.111913092f, 0.0589397848f},
-std::array<float,2>{0.502812386f, 0.641518533f},
-std::array<float,2>{0.344632924f, 0.913558304f},
-std::array<float,2>{0.921854556f, 0.31173268f},
-std::array<float,2>{0.466263413f, 0.476158112f},
-std::array<float,2>{0.791871965f, 0.860363603f},
-std::array<float,2>{0.185562775f, 0.548776209f},
-std::array<float,2>{0.671776354f, 0.144616917f},
-std::array<float,2>{0.377794683f, 0.124039419f},
-std::array<float,2>{0.845880091f, 0.704523265f},
-std::array<float,2>{0.210942507f, 0.950335145f},
-std::array<float,2>{0.714942336f, 0.327403873f},
-std::array<float,2>{0.0355003327f, 0.42550233f},
-std::array<float,2>{0.621671021f, 0.79949075f},
-std::array<float,2>{0.268317878f, 0.56478709f},
-std::array<float,2>{0.966178477f, 0.223205388f},
-std::array<float,2>{0.135834396f, 0.162940472f},
-std::array<float,2>{0.63249284f, 0.525362849f},
-std::array<float,2>{0.474261165f, 0.835400462f},
-std::array<float,2>{0.762846529f, 0.454912126f},
-std::array<float,2>{0.322396964f, 0.254623979f},
-std::array<float,2>{0.884459317f, 0.890996873f},
-std::array<float,2>{0.0826464966f, 0.669808805f},
-std::array<float,2>{0.538292348f, 0.00798258837f},
-std::array<float,2>{0.455773026f, 0.2105598f},
-std::array<float,2>{0.788563728f, 0.610198855f},
-std::array<float,2>{0.172827318f, 0.763884723f},
-std::array<float,2>{0.657267392f, 0.399972141f},
-std::array<float,2>{0.121001206f, 0.373418868f},
-std::array<float,2>{0.512249589f, 0.971459091f},
-std::array<float,2>{0.353878707f, 0.724896193f},
-std::array<float,2>{0.908699393f, 0.0854154155f},
-std::array<float,2>{0.23399955f, 0.0390823632f},
-std::array<float,2>{0.727193177f, 0.633013546f},
-std::array<float,2>{0.434884936f, 0.934506118f},
-std::array<float,2>{0.826152921f, 0.292262733f},
-std::array<float,2>{0.310618609f, 0.496258855f},
-std::array<float,2>{0.988473892f, 0.85796386f},
-std::array<float,2>{0.0205452126f, 0.53492862f},
-std::array<float,2>{0.57276392f, 0.136190817f},
-std::array<float,2>{0.314185888f, 0.101463832f},
-std::array<float,2>{0.881948829f, 0.689270437f},
-std::array<float,2>{0.0882193446f, 0.967386246f},
-std::array<float,2>{0.545265436f, 0.336355299f},
-std::array<float,2>{0.125340417f, 0.417724639f},
-std::array<float,2>{0.638637602f, 0.784986258f},
-std::array<float,2>{0.480609536f, 0.589755177f},
-std::array<float,2>{0.753006339f, 0.240349367f},
-std::array<float,2>{0.0415665321f, 0.182914957f},
-std::array<float,2>{0.616708398f, 0.508336961f},
-std::array<float,2>{0.280483007f, 0.817579448f},
-std::array<float,2>{0.956843019f, 0.447171301f},
-std::array<float,2>{0.385601968f, 0.278270185f},
-std::array<float,2>{0.857848048f, 0.878586113f},
-std::array<float,2>{0.20721142f, 0.679107308f},
-std::array<float,2>{0.706889927f, 0.0309395604f},
-std::array<float,2>{0.254009396f, 0.140919179f},
-std::array<float,2>{0.953071475f, 0.552691758f},
-std::array<float,2>{0.060346961f, 0.864469409f},
-std::array<float,2>{0.608536541f, 0.471816838f},
-std::array<float,2>{0.188439786f, 0.305406034f},
-std::array<float,2>{0.696161985f, 0.907255471f},
-std::array<float,2>{0.399180532f, 0.648352802f},
-std::array<float,2>{0.859692633f, 0.0576710664f},
-std::array<float,2>{0.0695799813f, 0.0703948662f},
-std::array<float,2>{0.552756369f, 0.736251712f},
-std::array<float,2>{0.340860397f, 0.999855995f},
-std::array<float,2>{0.902014494f, 0.346188992f},
-std::array<float,2>{0.494106263f, 0.379464746f},
-std::array<float,2>{0.77633816f, 0.769925058f},
-std::array<float,2>{0.148443505f, 0.607920647f},
-std::array<float,2>{0.642436624f, 0.187609404f},
-std::array<float,2>{0.411592275f, 0.0149117522f},
-std::array<float,2>{0.830516756f, 0.665354609f},
-std::array<float,2>{0.245911792f, 0.894546211f},
-std::array<float,2>{0.740261674f, 0.252130449f},
-std::array<float,2>{0.00499958405f, 0.459920824f},
-std::array<float,2>{0.592700958f, 0.828766167f},
-std::array<float,2>{0.29037261f, 0.528317392f},
-std::array<float,2>{0.983574688f, 0.15996699f},
-std::array<float,2>{0.168902427f, 0.219436005f},
-std::array<float,2>{0.677233458f, 0.56880486f},
-std::array<float,2>{0.445866406f, 0.802415073f},
-std::array<float,2>{0.807645321f, 0.426563323f},
-std::array<float,2>{0.360481858f, 0.323121339f},
-std::array<float,2>{0.92346257f, 0.945587039f},
-std::array<float,2>{0.0960822627f, 0.710821867f},
-std::array<float,2>{0.525617659f, 0.119579956f},
-std::array<float,2>{0.391351879f, 0.164648935f},
-std::array<float,2>{0.872546792f, 0.521664739f},
-std::array<float,2>{0.20308587f, 0.838502586f},
-std::array<float,2>{0.690127015f, 0.461440921f},
-std::array<float,2>{0.0515997633f, 0.259294152f},
-std::array<float,2>{0.597501218f, 0.903686941f},
-std::array<float,2>{0.261214286f, 0.664005578f},
-std::array<float,2>{0.944415033f, 0.000776667206f},
-std::array<float,2>{0.141813189f, 0.115047216f},
-std::array<float,2>{0.656151235f, 0.716704428f},
-std::array<float,2>{0.486536682f, 0.943182528f},
-std::array<float,2>{0.767522573f, 0.312950641f},
-std::array<float,2>{0.329418808f, 0.437398911f},
-std::array<float,2>{0.893820643f, 0.808971167f},
-std::array<float,2>{0.0746604055f, 0.577818096f},
-std::array<float,2>{0.557329893f, 0.229708895f},
-std::array<float,2>{0.281313956f, 0.0485169925f},
-std::array<float,2>{0.974815786f, 0.651659966f},
-std::array<float,2>{0.0120317452f, 0.920322239f},
-std::array<float,2>{0.579678774f, 0.300748914f},
-std::array<float,2>{0.237655297f, 0.484163821f},
-std::array<float,2>{0.743821263f, 0.872994184f},
-std::array<float,2>{0.41744408f, 0.556854844f},
-std::array<float,2>{0.837778568f, 0.155985117f},
-std::array<float,2>{0.105373815f, 0.199358672f},
-std::array<float,2>{0.522337675f, 0.599939585f},
-std::array<float,2>{0.372166067f, 0.773864746f},
-std::array<float,2>{0.937357783f, 0.387194544f},
-std::array<float,2>{0.442560554f, 0.355942309f},
-std::array<float,2>{0.801541984f, 0.988965034f},
-std::array<float,2>{0.156467408f, 0.745845556f},
-std::array<float,2>{0.681558669f, 0.0669979081f},
-std::array<float,2>{0.347961307f, 0.249982566f},
-std::array<float,2>{0.914499879f, 0.583258688f},
-std::array<float,2>{0.114884131f, 0.793036997f},
-std::array<float,2>{0.505290627f, 0.412836701f},
-std::array<float,2>{0.180739939f, 0.330853134f},
-std::array<float,2>{0.665334344f, 0.95417732f},
-std::array<float,2>{0.462247342f, 0.697262466f},
-std::array<float,2>{0.793339908f, 0.105886325f},
-std::array<float,2>{0.0300623402f, 0.0182584394f},
-std::array<float,2>{0.565354705f, 0.683949888f},
-std::array<float,2>{0.304549724f, 0.885500252f},
-std::array<float,2>{0.999154687f, 0.268688798f},
-std::array<float,2>{0.423149049f, 0.440621853f},
-std::array<float,2>{0.814439654f, 0.827551842f},
-std::array<float,2>{0.22196655f, 0.500597119f},
-std::array<float,2>{0.722412705f, 0.175568119f},
-std::array<float,2>{0.472228527f, 0.0884549841f},
-std::array<float,2>{0.759410799f, 0.733512819f},
-std::array<float,2>{0.138639793f, 0.981247306f},
-std::array<float,2>{0.626833558f, 0.364524335f},
-std::array<float,2>{0.0796158761f, 0.397584349f},
-std::array<float,2>{0.534613431f, 0.754402757f},
-std::array<float,2>{0.327540249f, 0.620851994f},
-std::array<float,2>{0.888183594f, 0.217828661f},
-std::array<float,2>{0.218609497f, 0.126155168f},
-std::array<float,2>{0.711802423f, 0.542958677f},
-std::array<float,2>{0.382748991f, 0.848645866f},
-std::array<float,2>{0.850275695f, 0.48608005f},
-std::array<float,2>{0.269809127f, 0.282526881f},
-std::array<float,2>{0.962446451f, 0.929188371f},
-std::array<float,2>{0.0317024924f, 0.631724954f},
-std::array<float,2>{0.620940387f, 0.0355287492f},
-std::array<float,2>{0.388980091f, 0.196393132f},
-std::array<float,2>{0.852384031f, 0.595032215f},
-std::array<float,2>{0.206140518f, 0.781241953f},
-std::array<float,2>{0.710057199f, 0.386271834f},
-std::array<float,2>{0.0468233787f, 0.352689266f},
-std::array<float,2>{0.612391472f, 0.987037897f},
-std::array<float,2>{0.274049163f, 0.749586344f},
-std::array<float,2>{0.957387149f, 0.0645906031f},
-std::array<float,2>{0.13218917f, 0.0536408983f},
-std::array<float,2>{0.634038925f, 0.653771639f},
-std::array<float,2>{0.480228603f, 0.915879726f},
-std::array<float,2>{0.754155815f, 0.302282482f},
-std::array<float,2>{0.31656298f, 0.480296314f},
-std::array<float,2>{0.877471566f, 0.867677569f},
-std::array<float,2>{0.0914250165f, 0.561034977f},
-std::array<float,2>{0.539560258f, 0.151903227f},
-std::array<float,2>{0.305943012f, 0.110523909f},
-std::array<float,2>{0.984395325f, 0.710980773f},
-std::array<float,2>{0.0162922796f, 0.939382553f},
-std::array<float,2>{0.575735688f, 0.319602698f},
-std::array<float,2>{0.228150055f, 0.430337459f},
-std::array<float,2>{0.730563581f, 0.805836737f},
-std::array<float,2>{0.432160825f, 0.57254988f},
-std::array<float,2>{0.82229048f, 0.232023537f},
-std::array<float,2>{0.121392794f, 0.170535326f},
-std::array<float,2>{0.511002123f, 0.518804491f},
-std::array<float,2>{0.358653337f, 0.842990756f},
-std::array<float,2>{0.910863698f, 0.468688637f},
-std::array<float,2>{0.458536893f, 0.263846248f},
-std::array<float,2>{0.78308332f, 0.901089132f},
-std::array<float,2>{0.176798254f, 0.658246279f},
-std::array<float,2>{0.660684466f, 0.00504667964f},
-std::array<float,2>{0.363818496f, 0.129380599f},
-std::array<float,2>{0.929304063f, 0.545431256f},
-std::array<float,2>{0.100340165f, 0.847638011f},
-std::array<float,2>{0.530422986f, 0.489484876f},
-std::array<float,2>{0.164804667f, 0.285298795f},
-std::array<float,2>{0.675154209f, 0.921970308f},
-std::array<float,2>{0.453101188f, 0.627171159f},
-std::array<float,2>{0.812115371f, 0.0334060602f},
-std::array<float,2>{0.0015333466f, 0.0902304575f},
-std::array<float,2>{0.586920202f, 0.727719486f},
-std::array<float,2>{0.293054342f, 0.977919698f},
-std::array<float,2>{0.979237974f, 0.359993786f},
-std::array<float,2>{0.406784356f, 0.392536372f},
-std::array<float,2>{0.833341479f, 0.752010643f},
-std::array<float,2>{0.249988228f, 0.623655081f},
-std::array<float,2>{0.735500872f, 0.211128727f},
-std::array<float,2>{0.496275902f, 0.0220563337f},
-std::array<float,2>{0.780178428f, 0.681674957f},
-std::array<float,2>{0.153111622f, 0.88756305f},
-std::array<float,2>{0.647366762f, 0.270598769f},
-std::array<float,2>{0.0636443868f, 0.442756206f},
-std::array<float,2>{0.548165202f, 0.822296023f},
-std::array<float,2>{0.339762121f, 0.504047215f},
-std::array<float,2>{0.9026618f, 0.177777559f},
-std::array<float,2>{0.192751214f, 0.244728208f},
-std::array<float,2>{0.700382948f, 0.581730247f},
-std::array<float,2>{0.40313521f, 0.790014386f},
-std::array<float,2>{0.863474488f, 0.408909798f},
-std::array<float,2>{0.251481354f, 0.335731208f},
-std::array<float,2>{0.948695302f, 0.9602108f},
-std::array<float,2>{0.0565918088f, 0.699310482f},
-std::array<float,2>{0.602652431f, 0.102339387f},
-std::array<float,2>{0.441284925f, 0.184110299f},
-std::array<float,2>{0.798059404f, 0.514607131f},
-std::array<float,2>{0.163178787f, 0.815136194f},
-std::array<float,2>{0.685056627f, 0.451545656f},
-std::array<float,2>{0.105699122f, 0.274282932f},
-std::array<float,2>{0.516928256f, 0.879204333f},
-std::array<float,2>{0.369278342f, 0.675310731f},
-std::array<float,2>{0.932062507f, 0.0251322798f},
-std::array<float,2>{0.238285288f, 0.0945996121f},
-std::array<float,2>{0.747695386f, 0.693174958f},
-std::array<float,2>{0.419624537f, 0.962854922f},
-std::array<float,2>{0.840063751f, 0.340422422f},
-std::array<float,2>{0.285761088f, 0.421090692f},
-std::array<float,2>{0.969773054f, 0.787281513f},
-std::array<float,2>{0.00814341754f, 0.590747714f},
-std::array<float,2>{0.582159162f, 0.234466389f},
-std::array<float,2>{0.335851729f, 0.0432789773f},
-std::array<float,2>{0.897717834f, 0.640565276f},
-std::array<float,2>{0.0716988444f, 0.932430983f},
-std::array<float,2>{0.56128633f, 0.293684244f},
-std::array<float,2>{0.147250414f, 0.4932307f},
-std::array<float,2>{0.650576472f, 0.851853192f},
-std::array<float,2>{0.490122288f, 0.536044896f},
-std::array<float,2>{0.772729039f, 0.139288321f},
-std::array<float,2>{0.0493216813f, 0.206185818f},
-std::array<float,2>{0.599652767f, 0.615803599f},
-std::array<float,2>{0.264208853f, 0.759102345f},
-std::array<float,2>{0.939244509f, 0.404637337f},
-std::array<float,2>{0.397833169f, 0.369564891f},
-std::array<float,2>{0.868956327f, 0.974327028f},
-std::array<float,2>{0.19860059f, 0.721989214f},
-std::array<float,2>{0.694185734f, 0.0783017799f},
-std::array<float,2>{0.266729921f, 0.225553885f},
-std::array<float,2>{0.968700349f, 0.563862026f},
-std::array<float,2>{0.038974382f, 0.79882437f},
-std::array<float,2>{0.62484026f, 0.423764199f},
-std::array<float,2>{0.214653894f, 0.324649662f},
-std::array<float,2>{0.717204452f, 0.952727556f},
-std::array<float,2>{0.375692517f, 0.706765473f},
-std::array<float,2>{0.844542265f, 0.121392243f},
-std::array<float,2>{0.085907191f, 0.0112001412f},
-std::array<float,2>{0.536395311f, 0.670638144f},
-std::array<float,2>{0.320863128f, 0.893605888f},
-std::array<float,2>{0.885201454f, 0.256387591f},
-std::array<float,2>{0.47652626f, 0.456565142f},
-std::array<float,2>{0.764894068f, 0.833798289f},
-std::array<float,2>{0.133533627f, 0.526918888f},
-std::array<float,2>{0.63075912f, 0.161392659f},
-std::array<float,2>{0.428057641f, 0.0765242949f},
-std::array<float,2>{0.816794693f, 0.740459859f},
-std::array<float,2>{0.223422378f, 0.995981514f},
-std::array<float,2>{0.726128101f, 0.348761052f},
-std::array<float,2>{0.026634464f, 0.378227502f},
-std::array<float,2>{0.566947997f, 0.765752196f},
-std::array<float,2>{0.298166603f, 0.60419327f},
-std::array<float,2>{0.993001342f, 0.193723306f},
-std::array<float,2>{0.183823913f, 0.148128763f},
-std::array<float,2>{0.66889292f, 0.550243556f},
-std::array<float,2>{0.467321724f, 0.862669528f},
-std::array<float,2>{0.789464653f, 0.472782046f},
-std::array<float,2>{0.346087515f, 0.309437454f},
-std::array<float,2>{0.918851852f, 0.910402119f},
-std::array<float,2>{0.110431537f, 0.642621279f},
-std::array<float,2>{0.50100565f, 0.061718557f},
-std::array<float,2>{0.483876526f, 0.240093976f},
-std::array<float,2>{0.751506209f, 0.587227583f},
-std::array<float,2>{0.127475724f, 0.782670796f},
-std::array<float,2>{0.63919729f, 0.415706664f},
-std::array<float,2>{0.0877785757f, 0.338314354f},
-std::array<float,2>{0.543613136f, 0.964939654f},
-std::array<float,2>{0.315935254f, 0.689573348f},
-std::array<float,2>{0.879189849f, 0.098688215f},
-std::array<float,2>{0.210212782f, 0.0282713752f},
-std::array<float,2>{0.703612268f, 0.676983416f},
-std::array<float,2>{0.383686006f, 0.875988722f},
-std::array<float,2>{0.855725825f, 0.279938757f},
-std::array<float,2>{0.278930694f, 0.447892606f},
-std::array<float,2>{0.954419196f, 0.818797648f},
-std::array<float,2>{0.0407345183f, 0.510777473f},
-std::array<float,2>{0.613473356f, 0.180459514f},
-std::array<float,2>{0.351944387f, 0.0838517472f},
-std::array<float,2>{0.906996131f, 0.724568844f},
-std::array<float,2>{0.118493281f, 0.969018161f},
-std::array<float,2>{0.515293181f, 0.372069865f},
-std::array<float,2>{0.174726874f, 0.40177834f},
-std::array<float,2>{0.65835458f, 0.762453079f},
-std::array<float,2>{0.454283416f, 0.612324059f},
-std::array<float,2>{0.786717415f, 0.207530543f},
-std::array<float,2>{0.0217743535f, 0.133719072f},
-std::array<float,2>{0.572043717f, 0.53288722f},
-std::array<float,2>{0.309659451f, 0.855852485f},
-std::array<float,2>{0.990709305f, 0.498793393f},
-std::array<float,2>{0.436999768f, 0.290439188f},
-std::array<float,2>{0.826393247f, 0.935884416f},
-std::array<float,2>{0.232162133f, 0.635034382f},
-std::array<float,2>{0.729997635f, 0.0417427979f},
-std::array<float,2>{0.29228431f, 0.15699178f},
-std::array<float,2>{0.982126176f, 0.529782295f},
-std::array<float,2>{0.005872685f, 0.831491768f},
-std::array<float,2>{0.590739667f, 0.458537966f},
-std::array<float,2>{0.24338229f, 0.25015083f},
-std::array<float,2>{0.739913106f, 0.897086442f},
-std::array<float,2>{0.413654208f, 0.666254103f},
-std::array<float,2>{0.829965234f, 0.0130469557f},
-std::array<float,2>{0.0940087736f, 0.11753232f},
-std::array<float,2>{0.523457527f, 0.707710028f},
-std::array<float,2>{0.362888932f, 0.94739449f},
-std::array<float,2>{0.92422235f, 0.321095765f},
-std::array<float,2>{0.448027283f, 0.429407567f},
-std::array<float,2>{0.804884136f, 0.803509891f},
-std::array<float,2>{0.17121619f, 0.567263484f},
-std::array<float,2>{0.677842021f, 0.222004607f},
-std::array<float,2>{0.402024269f, 0.055270277f},
-std::array<float,2>{0.861333847f, 0.645236671f},
-std::array<float,2>{0.189547241f, 0.908566773f},
-std::array<float,2>{0.697879851f, 0.307479948f},
-std::array<float,2>{0.0606451109f, 0.469791263f},
-std::array<float,2>{0.605602324f, 0.865708172f},
-std::array<float,2>{0.256097466f, 0.553741813f},
-std::array<float,2>{0.950365663f, 0.142879054f},
-std::array<float,2>{0.151117876f, 0.190864965f},
-std::array<float,2>{0.642999411f, 0.60665375f},
-std::array<float,2>{0.495749384f, 0.773258805f},
-std::array<float,2>{0.774821997f, 0.381154805f},
-std::array<float,2>{0.342466921f, 0.344407856f},
-std::array<float,2>{0.898660004f, 0.996642649f},
-std::array<float,2>{0.0664082021f, 0.737785041f},
-std::array<float,2>{0.551421165f, 0.0725256354f},
-std::array<float,2>{0.415702671f, 0.154164717f},
-std::array<float,2>{0.838130057f, 0.556055129f},
-std::array<float,2>{0.235731021f, 0.874972343f},
-std::array<float,2>{0.745032489f, 0.481050879f},
-std::array<float,2>{0.0143054025f, 0.298607796f},
-std::array<float,2>{0.581672192f, 0.91859144f},
-std::array<float,2>{0.283799171f, 0.649106085f},
-std::array<float,2>{0.973002017f, 0.0491416045f},
-std::array<float,2>{0.158625707f, 0.0695227087f},
-std::array<float,2>{0.683400273f, 0.742663145f},
-std::array<float,2>{0.443547726f, 0.990548611f},
-std::array<float,2>{0.804635108f, 0.358516425f},
-std::array<float,2>{0.373160005f, 0.389310002f},
-std::array<float,2>{0.934248626f, 0.776821136f},
-std::array<float,2>{0.102622256f, 0.598026991f},
-std::array<float,2>{0.520539641f, 0.202610806f},
-std::array<float,2>{0.258614063f, 0.00357115897f},
-std::array<float,2>{0.942662716f, 0.660537183f},
-std::array<float,2>{0.0538400598f, 0.904323041f},
-std::array<float,2>{0.594845772f, 0.261400908f},
-std::array<float,2>{0.200935662f, 0.464481622f},
-std::array<float,2>{0.687590241f, 0.83758527f},
-std::array<float,2>{0.392954916f, 0.519949436f},
-std::array<float,2>{0.873725176f, 0.167379767f},
-std::array<float,2>{0.0777964666f, 0.227942899f},
-std::array<float,2>{0.556322515f, 0.574731112f},
-std::array<float,2>{0.331479281f, 0.810717583f},
-std::array<float,2>{0.890719295f, 0.434342653f},
-std::array<float,2>{0.485375106f, 0.315977842f},
-std::array<float,2>{0.767832816f, 0.944089055f},
-std::array<float,2>{0.143100441f, 0.717803895f},
-std::array<float,2>{0.652655959f, 0.115428075f},
-std::array<float,2>{0.326050669f, 0.214849025f},
-std::array<float,2>{0.888693392f, 0.618321359f},
-std::array<float,2>{0.0811344683f, 0.756729484f},
-std::array<float,2>{0.532731473f, 0.396438301f},
-std::array<float,2>{0.13936007f, 0.366082698f},
-std::array<float,2>{0.628166258f, 0.982915401f},
-std::array<float,2>{0.469328284f, 0.731381595f},
-std::array<float,2>{0.76012814f, 0.0863277242f},
-std::array<float,2>{0.0345927477f, 0.0381921642f},
-std::array<float,2>{0.617437541f, 0.630744576f},
-std::array<float,2>{0.272487313f, 0.925990403f},
-std::array<float,2>{0.963480055f, 0.283676982f},
-std::array<float,2>{0.380064815f, 0.487768531f},
-std::array<float,2>{0.848355591f, 0.850582957f},
-std::array<float,2>{0.215041026f, 0.540501416f},
-std::array<float,2>{0.714810669f, 0.127156615f},
-std::array<float,2>{0.463127226f, 0.108246244f},
-std::array<float,2>{0.795813859f, 0.699093342f},
-std::array<float,2>{0.182360321f, 0.955534458f},
-std::array<float,2>{0.667438626f, 0.328186423f},
-std::array<float,2>{0.116230786f, 0.41201216f},
-std::array<float,2>{0.507535458f, 0.796044946f},
-std::array<float,2>{0.350827843f, 0.584478617f},
-std::array<float,2>{0.917022347f, 0.246503606f},
-std::array<float,2>{0.218801677f, 0.173048198f},
-std::array<float,2>{0.720201731f, 0.50340116f},
-std::array<float,2>{0.425240815f, 0.824906051f},
-std::array<float,2>{0.814847291f, 0.438224912f},
-std::array<float,2>{0.302158594f, 0.266076684f},
-std::array<float,2>{0.996941984f, 0.884232879f},
-std::array<float,2>{0.0287015382f, 0.686692655f},
-std::array<float,2>{0.562575579f, 0.0159816742f},
-std::array<float,2>{0.408262402f, 0.212619007f},
-std::array<float,2>{0.834862292f, 0.624164581f},
-std::array<float,2>{0.246704623f, 0.753718853f},
-std::array<float,2>{0.736687362f, 0.391446233f},
-std::array<float,2>{0.00333191291f, 0.360652089f},
-std::array<float,2>{0.588625968f, 0.977440119f},
-std::array<float,2>{0.29587543f, 0.727219462f},
-std::array<float,2>{0.977768004f, 0.0917213857f},
-std::array<float,2>{0.166407242f, 0.0347498916f},
-std::array<float,2>{0.673054159f, 0.628797591f},
-std::array<float,2>{0.449966431f, 0.923625708f},
-std::array<float,2>{0.810467422f, 0.286698997f},
-std::array<float,2>{0.366552889f, 0.489052802f},
-std::array<float,2>{0.926374972f, 0.845864892f},
-std::array<float,2>{0.098281987f, 0.546247363f},
-std::array<float,2>{0.527375519f, 0.129921347f},
-std::array<float,2>{0.252893925f, 0.103233017f},
-std::array<float,2>{0.94720906f, 0.700609684f},
-std::array<float,2>{0.0575357638f, 0.959068418f},
-std::array<float,2>{0.603680968f, 0.334092557f},
-std::array<float,2>{0.193482846f, 0.409440696f},
-std::array<float,2>{0.701534331f, 0.790488243f},
-std::array<float,2>{0.404513836f, 0.580177605f},
-std::array<float,2>{0.86669898f, 0.245273843f},
-std::array<float,2>{0.0646610036f, 0.179226115f},
-std::array<float,2>{0.550652742f, 0.505758166f},
-std::array<float,2>{0.337800056f, 0.823701203f},
-std::array<float,2>{0.905889511f, 0.441587001f},
-std::array<float,2>{0.499940127f, 0.269645572f},
-std::array<float,2>{0.77810961f, 0.887701035f},
-std::array<float,2>{0.154719815f, 0.683048546f},
-std::array<float,2>{0.645929635f, 0.0233439635f},
-std::array<float,2>{0.320008129f, 0.150467828f},
-std::array<float,2>{0.87659955f, 0.561904669f},
-std::array<float,2>{0.0920240358f, 0.868999779f},
-std::array<float,2>{0.5421471f, 0.479368687f},
-std::array<float,2>{0.130557194f, 0.301707953f},
-std::array<float,2>{0.636200547f, 0.914237261f},
-std::array<float,2>{0.478239894f, 0.652701378f},
-std::array<float,2>{0.755935133f, 0.0542761199f},
-std::array<float,2>{0.0444405228f, 0.0661949068f},
-std::array<float,2>{0.609943509f, 0.748128653f},
-std::array<float,2>{0.275444031f, 0.987849116f},
-std::array<float,2>{0.960125208f, 0.352413833f},
-std::array<float,2>{0.387377769f, 0.385203689f},
-std::array<float,2>{0.854057431f, 0.779913902f},
-std::array<float,2>{0.204400674f, 0.593866587f},
-std::array<float,2>{0.708033681f, 0.195649505f},
-std::array<float,2>{0.459938616f, 0.00462205801f},
-std::array<float,2>{0.784859598f, 0.659277618f},
-std::array<float,2>{0.17891781f, 0.902268231f},
-std::array<float,2>{0.662499845f, 0.264822304f},
-std::array<float,2>{0.124038428f, 0.466928869f},
-std::array<float,2>{0.509082198f, 0.842032433f},
-std::array<float,2>{0.355534524f, 0.518505931f},
-std::array<float,2>{0.913070202f, 0.171039224f},
-std::array<float,2>{0.230393589f, 0.230653346f},
-std::array<float,2>{0.733729243f, 0.573993742f},
-std::array<float,2>{0.429773211f, 0.804732919f},
-std::array<float,2>{0.820862412f, 0.431394637f},
-std::array<float,2>{0.307609528f, 0.319062442f},
-std::array<float,2>{0.986990809f, 0.938199341f},
-std::array<float,2>{0.0192371104f, 0.712016404f},
-std::array<float,2>{0.57792598f, 0.109512508f},
-std::array<float,2>{0.473037273f, 0.160850286f},
-std::array<float,2>{0.762540996f, 0.525448918f},
-std::array<float,2>{0.135720879f, 0.832630515f},
-std::array<float,2>{0.631183743f, 0.455998927f},
-std::array<float,2>{0.0838722587f, 0.256938308f},
-std::array<float,2>{0.537537277f, 0.893512189f},
-std::array<float,2>{0.323907882f, 0.671116829f},
-std::array<float,2>{0.883214951f, 0.0099062277f},
-std::array<float,2>{0.211920604f, 0.122578427f},
-std::array<float,2>{0.715865433f, 0.705655098f},
-std::array<float,2>{0.377981603f, 0.951452196f},
-std::array<float,2>{0.847224891f, 0.325520635f},
-std::array<float,2>{0.268905729f, 0.422816426f},
-std::array<float,2>{0.965240657f, 0.797792673f},
-std::array<float,2>{0.0365339704f, 0.563430011f},
-std::array<float,2>{0.622658372f, 0.226529449f},
-std::array<float,2>{0.345293969f, 0.0611799881f},
-std::array<float,2>{0.920367002f, 0.644519687f},
-std::array<float,2>{0.113264188f, 0.912091672f},
-std::array<float,2>{0.503564298f, 0.310406119f},
-std::array<float,2>{0.186889514f, 0.474576265f},
-std::array<float,2>{0.670055032f, 0.861360908f},
-std::array<float,2>{0.465033412f, 0.549460113f},
-std::array<float,2>{0.792395473f, 0.147257984f},
-std::array<float,2>{0.0240008645f, 0.195270225f},
-std::array<float,2>{0.570061266f, 0.60525012f},
-std::array<float,2>{0.300470978f, 0.767562449f},
-std::array<float,2>{0.9956671f, 0.377675116f},
-std::array<float,2>{0.427133232f, 0.348027766f},
-std::array<float,2>{0.818974674f, 0.994545758f},
-std::array<float,2>{0.225080729f, 0.742107689f},
-std::array<float,2>{0.723573029f, 0.0779598355f},
-std::array<float,2>{0.287166864f, 0.235632807f},
-std::array<float,2>{0.972053885f, 0.590925694f},
-std::array<float,2>{0.01078247f, 0.788108349f},
-std::array<float,2>{0.5841766f, 0.420545906f},
-std::array<float,2>{0.2407628f, 0.34086445f},
-std::array<float,2>{0.749220431f, 0.961616695f},
-std::array<float,2>{0.421648175f, 0.691767514f},
-std::array<float,2>{0.843497932f, 0.0950919092f},
-std::array<float,2>{0.108639665f, 0.0237379223f},
-std::array<float,2>{0.519517839f, 0.674739897f},
-std::array<float,2>{0.367527813f, 0.880719423f},
-std::array<float,2>{0.929788947f, 0.275344759f},
-std::array<float,2>{0.43824932f, 0.452851653f},
-std::array<float,2>{0.799967945f, 0.815939367f},
-std::array<float,2>{0.161227003f, 0.51472944f},
-std::array<float,2>{0.68678391f, 0.184895471f},
-std::array<float,2>{0.395737052f, 0.0797918364f},
-std::array<float,2>{0.869926155f, 0.721055329f},
-std::array<float,2>{0.19543843f, 0.973526061f},
-std::array<float,2>{0.692014933f, 0.370919496f},
-std::array<float,2>{0.0484688729f, 0.405777335f},
-std::array<float,2>{0.599221706f, 0.758318245f},
-std::array<float,2>{0.262305468f, 0.616797328f},
-std::array<float,2>{0.940321386f, 0.205884799f},
-std::array<float,2>{0.145944744f, 0.139875129f},
-std::array<float,2>{0.648698866f, 0.536654294f},
-std::array<float,2>{0.490825593f, 0.852928758f},
-std::array<float,2>{0.771355629f, 0.49247992f},
-std::array<float,2>{0.332039058f, 0.294095576f},
-std::array<float,2>{0.894966722f, 0.932792842f},
-std::array<float,2>{0.073656559f, 0.639019012f},
-std::array<float,2>{0.559234977f, 0.0448023938f},
-std::array<float,2>{0.447168231f, 0.221563831f},
-std::array<float,2>{0.807586074f, 0.567992449f},
-std::array<float,2>{0.169782937f, 0.803785443f},
-std::array<float,2>{0.676270962f, 0.427778453f},
-std::array<float,2>{0.0974034518f, 0.322235554f},
-std::array<float,2>{0.526452601f, 0.949138939f},
-std::array<float,2>{0.359377176f, 0.708744168f},
-std::array<float,2>{0.922112167f, 0.118985787f},
-std::array<float,2>{0.244360909f, 0.01210423f},
-std::array<float,2>{0.741241574f, 0.667209685f},
-std::array<float,2>{0.410964042f, 0.897814572f},
-std::array<float,2>{0.831475914f, 0.251301497f},
-std::array<float,2>{0.289353371f, 0.457309961f},
-std::array<float,2>{0.983275056f, 0.830488503f},
-std::array<float,2>{0.00425784104f, 0.53083086f},
-std::array<float,2>{0.59287101f, 0.157456487f},
-std::array<float,2>{0.340678751f, 0.0732858628f},
-std::array<float,2>{0.900780678f, 0.736476898f},
-std::array<float,2>{0.0691768304f, 0.997647345f},
-std::array<float,2>{0.554403663f, 0.344950974f},
-std::array<float,2>{0.149427429f, 0.382239938f},
-std::array<float,2>{0.640847385f, 0.771778464f},
-std::array<float,2>{0.492952555f, 0.606392622f},
-std::array<float,2>{0.776397228f, 0.189730629f},
-std::array<float,2>{0.0590092838f, 0.14450869f},
-std::array<float,2>{0.607833743f, 0.553459048f},
-std::array<float,2>{0.255177289f, 0.86626327f},
-std::array<float,2>{0.951738f, 0.468840182f},
-std::array<float,2>{0.400087357f, 0.307892859f},
-std::array<float,2>{0.860635281f, 0.909675539f},
-std::array<float,2>{0.188676789f, 0.645617485f},
-std::array<float,2>{0.696400344f, 0.0557768233f},
-std::array<float,2>{0.279974103f, 0.181623727f},
-std::array<float,2>{0.955483377f, 0.510152161f},
-std::array<float,2>{0.0427650735f, 0.819467008f},
-std::array<float,2>{0.615905046f, 0.448593944f},
-std::array<float,2>{0.208366379f, 0.280469984f},
-std::array<float,2>{0.70595181f, 0.875717461f},
-std::array<float,2>{0.386290759f, 0.676077843f},
-std::array<float,2>{0.858794808f, 0.0287958235f},
-std::array<float,2>{0.0894382372f, 0.0984945595f},
-std::array<float,2>{0.546615422f, 0.691187441f},
-std::array<float,2>{0.3131634f, 0.965876937f},
-std::array<float,2>{0.880990267f, 0.339364618f},
-std::array<float,2>{0.481661856f, 0.414534956f},
-std::array<float,2>{0.752453148f, 0.781806886f},
-std::array<float,2>{0.126923606f, 0.586403668f},
-std::array<float,2>{0.637533307f, 0.238608301f},
-std::array<float,2>{0.434506625f, 0.042315755f},
-std::array<float,2>{0.824510217f, 0.635803163f},
-std::array<float,2>{0.232890233f, 0.936561048f},
-std::array<float,2>{0.72840929f, 0.289893597f},
-std::array<float,2>{0.0204315744f, 0.499180198f},
-std::array<float,2>{0.573289931f, 0.857415855f},
-std::array<float,2>{0.312134475f, 0.531744719f},
-std::array<float,2>{0.989444256f, 0.134215713f},
-std::array<float,2>{0.172904283f, 0.208043829f},
-std::array<float,2>{0.656970203f, 0.611945212f},
-std::array<float,2>{0.456533074f, 0.763332546f},
-std::array<float,2>{0.787826359f, 0.4009749f},
-std::array<float,2>{0.354644448f, 0.372819275f},
-std::array<float,2>{0.90986681f, 0.970617771f},
-std::array<float,2>{0.119229361f, 0.723631144f},
-std::array<float,2>{0.512818158f, 0.0828390718f},
-std::array<float,2>{0.381484449f, 0.128233358f},
-std::array<float,2>{0.851506054f, 0.539566636f},
-std::array<float,2>{0.217135832f, 0.851221323f},
-std::array<float,2>{0.712141275f, 0.486637563f},
-std::array<float,2>{0.0323648043f, 0.284719974f},
-std::array<float,2>{0.619255304f, 0.927020729f},
-std::array<float,2>{0.270547271f, 0.629311025f},
-std::array<float,2>{0.961341143f, 0.0374951847f},
-std::array<float,2>{0.137130082f, 0.0876935646f},
-std::array<float,2>{0.625322342f, 0.732207716f},
-std::array<float,2>{0.471189409f, 0.983451843f},
-std::array<float,2>{0.758190691f, 0.36668241f},
-std::array<float,2>{0.326535136f, 0.394821852f},
-std::array<float,2>{0.886747062f, 0.757016599f},
-std::array<float,2>{0.0790769681f, 0.617815077f},
-std::array<float,2>{0.533774674f, 0.216418579f},
-std::array<float,2>{0.30332756f, 0.0166116599f},
-std::array<float,2>{0.998283684f, 0.686312973f},
-std::array<float,2>{0.0309944544f, 0.883654654f},
-std::array<float,2>{0.565710127f, 0.267104268f},
-std::array<float,2>{0.221208125f, 0.439372957f},
-std::array<float,2>{0.72139895f, 0.826155543f},
-std::array<float,2>{0.422607005f, 0.502493322f},
-std::array<float,2>{0.813452005f, 0.172248706f},
-std::array<float,2>{0.113859788f, 0.24757354f},
-std::array<float,2>{0.504655719f, 0.585543752f},
-std::array<float,2>{0.349059552f, 0.795535445f},
-std::array<float,2>{0.915318429f, 0.410925984f},
-std::array<float,2>{0.461193025f, 0.329305232f},
-std::array<float,2>{0.794332445f, 0.956430376f},
-std::array<float,2>{0.179798231f, 0.698165953f},
-std::array<float,2>{0.664515018f, 0.108971298f},
-std::array<float,2>{0.371493489f, 0.202024281f},
-std::array<float,2>{0.936350465f, 0.599422872f},
-std::array<float,2>{0.10432145f, 0.776296198f},
-std::array<float,2>{0.523171067f, 0.389877141f},
-std::array<float,2>{0.157347053f, 0.358226806f},
-std::array<float,2>{0.680078983f, 0.992169261f},
-std::array<float,2>{0.442157358f, 0.743825257f},
-std::array<float,2>{0.80219388f, 0.0691886395f},
-std::array<float,2>{0.0136442725f, 0.0507666767f},
-std::array<float,2>{0.579039991f, 0.650377572f},
-std::array<float,2>{0.282799006f, 0.919025779f},
-std::array<float,2>{0.976273775f, 0.297058314f},
-std::array<float,2>{0.416636974f, 0.481999397f},
-std::array<float,2>{0.836503685f, 0.873697877f},
-std::array<float,2>{0.237228602f, 0.555385172f},
-std::array<float,2>{0.742366374f, 0.152539f},
-std::array<float,2>{0.487590522f, 0.116571486f},
-std::array<float,2>{0.766430974f, 0.716884136f},
-std::array<float,2>{0.141177356f, 0.945064425f},
-std::array<float,2>{0.65465486f, 0.315023839f},
-std::array<float,2>{0.0757071897f, 0.435245544f},
-std::array<float,2>{0.558265507f, 0.812479913f},
-std::array<float,2>{0.328377098f, 0.575503588f},
-std::array<float,2>{0.893009484f, 0.227232441f},
-std::array<float,2>{0.201290309f, 0.166337281f},
-std::array<float,2>{0.691192031f, 0.521094203f},
-std::array<float,2>{0.392472535f, 0.836049259f},
-std::array<float,2>{0.871569872f, 0.463360459f},
-std::array<float,2>{0.260024309f, 0.260030538f},
-std::array<float,2>{0.943886757f, 0.905992746f},
-std::array<float,2>{0.0522645339f, 0.661728859f},
-std::array<float,2>{0.596677363f, 0.00248786388f},
-std::array<float,2>{0.403658241f, 0.24301149f},
-std::array<float,2>{0.864484251f, 0.578780413f},
-std::array<float,2>{0.191720843f, 0.791664064f},
-std::array<float,2>{0.699412286f, 0.406571746f},
-std::array<float,2>{0.0550294183f, 0.333803028f},
-std::array<float,2>{0.602020562f, 0.958111405f},
-std::array<float,2>{0.250347197f, 0.702078283f},
-std::array<float,2>{0.94766444f, 0.104545273f},
-std::array<float,2>{0.153508455f, 0.0198212471f},
-std::array<float,2>{0.64756465f, 0.680370271f},
-std::array<float,2>{0.497190893f, 0.888795614f},
-std::array<float,2>{0.780632436f, 0.272932976f},
-std::array<float,2>{0.337980419f, 0.444408059f},
-std::array<float,2>{0.904000521f, 0.821222365f},
-std::array<float,2>{0.062637493f, 0.506977439f},
-std::array<float,2>{0.547726214f, 0.176663458f},
-std::array<float,2>{0.29438135f, 0.0918180943f},
-std::array<float,2>{0.979864478f, 0.729025304f},
-std::array<float,2>{0.000224252755f, 0.979897082f},
-std::array<float,2>{0.586815536f, 0.362686038f},
-std::array<float,2>{0.248062626f, 0.393883973f},
-std::array<float,2>{0.735028446f, 0.750346482f},
-std::array<float,2>{0.407473445f, 0.622408688f},
-std::array<float,2>{0.832330048f, 0.213904217f},
-std::array<float,2>{0.100841463f, 0.132314563f},
-std::array<float,2>{0.529300988f, 0.543935955f},
-std::array<float,2>{0.36478135f, 0.843816459f},
-std::array<float,2>{0.928421974f, 0.4916538f},
-std::array<float,2>{0.452138305f, 0.287472695f},
-std::array<float,2>{0.811361074f, 0.924924791f},
-std::array<float,2>{0.1652392f, 0.626927376f},
-std::array<float,2>{0.674197793f, 0.0318735577f},
-std::array<float,2>{0.358047456f, 0.169527665f},
-std::array<float,2>{0.911723256f, 0.516502678f},
-std::array<float,2>{0.122358888f, 0.840595543f},
-std::array<float,2>{0.510206461f, 0.465260595f},
-std::array<float,2>{0.17646338f, 0.262130946f},
-std::array<float,2>{0.661414325f, 0.899876356f},
-std::array<float,2>{0.457804024f, 0.65734005f},
-std::array<float,2>{0.782170057f, 0.00708345417f},
-std::array<float,2>{0.0175583102f, 0.113177553f},
-std::array<float,2>{0.57449609f, 0.713044107f},
-std::array<float,2>{0.304739684f, 0.941347718f},
-std::array<float,2>{0.986317933f, 0.31673944f},
-std::array<float,2>{0.432729602f, 0.431714684f},
-std::array<float,2>{0.823642373f, 0.807119548f},
-std::array<float,2>{0.226749375f, 0.570705116f},
-std::array<float,2>{0.732306778f, 0.232797161f},
-std::array<float,2>{0.478921801f, 0.0510038175f},
-std::array<float,2>{0.7553128f, 0.654474735f},
-std::array<float,2>{0.130930975f, 0.916403592f},
-std::array<float,2>{0.63281405f, 0.303568602f},
-std::array<float,2>{0.0899375752f, 0.478082031f},
-std::array<float,2>{0.540232301f, 0.870114744f},
-std::array<float,2>{0.317944318f, 0.560501397f},
-std::array<float,2>{0.878263235f, 0.14867197f},
-std::array<float,2>{0.205895886f, 0.197773725f},
-std::array<float,2>{0.709567487f, 0.597365975f},
-std::array<float,2>{0.389999866f, 0.778916359f},
-std::array<float,2>{0.852545977f, 0.384322912f},
-std::array<float,2>{0.275311261f, 0.354832351f},
-std::array<float,2>{0.958071709f, 0.985066891f},
-std::array<float,2>{0.0457841344f, 0.746338189f},
-std::array<float,2>{0.612269163f, 0.0641304478f},
-std::array<float,2>{0.468226194f, 0.146342337f},
-std::array<float,2>{0.790969372f, 0.547039628f},
-std::array<float,2>{0.184925586f, 0.859641492f},
-std::array<float,2>{0.669580162f, 0.475077659f},
-std::array<float,2>{0.109766975f, 0.310555547f},
-std::array<float,2>{0.500163138f, 0.912588179f},
-std::array<float,2>{0.347196311f, 0.64181447f},
-std::array<float,2>{0.919707775f, 0.0604789853f},
-std::array<float,2>{0.223690808f, 0.0761666894f},
-std::array<float,2>{0.724847615f, 0.739103854f},
-std::array<float,2>{0.428775221f, 0.992623091f},
-std::array<float,2>{0.817965031f, 0.350122035f},
-std::array<float,2>{0.297751993f, 0.375638932f},
-std::array<float,2>{0.993259072f, 0.76867795f},
-std::array<float,2>{0.0258687697f, 0.601623356f},
-std::array<float,2>{0.567682445f, 0.192786589f},
-std::array<float,2>{0.321641088f, 0.00905624498f},
-std::array<float,2>{0.886042774f, 0.668631911f},
-std::array<float,2>{0.0847509876f, 0.891755164f},
-std::array<float,2>{0.535690606f, 0.255352765f},
-std::array<float,2>{0.134215027f, 0.453786969f},
-std::array<float,2>{0.629098535f, 0.834022045f},
-std::array<float,2>{0.474612772f, 0.52437067f},
-std::array<float,2>{0.764549732f, 0.163617954f},
-std::array<float,2>{0.0371782593f, 0.224149674f},
-std::array<float,2>{0.623897076f, 0.566101432f},
-std::array<float,2>{0.265869111f, 0.799894512f},
-std::array<float,2>{0.966899753f, 0.424405605f},
-std::array<float,2>{0.376672506f, 0.326923817f},
-std::array<float,2>{0.844881535f, 0.949514925f},
-std::array<float,2>{0.212973192f, 0.704033732f},
-std::array<float,2>{0.718631506f, 0.123238236f},
-std::array<float,2>{0.265142947f, 0.204808906f},
-std::array<float,2>{0.937738657f, 0.61511308f},
-std::array<float,2>{0.0505927987f, 0.760552406f},
-std::array<float,2>{0.601425469f, 0.403233856f},
-std::array<float,2>{0.197698861f, 0.367193609f},
-std::array<float,2>{0.694397986f, 0.975161552f},
-std::array<float,2>{0.396905124f, 0.718908489f},
-std::array<float,2>{0.867902577f, 0.0814398751f},
-std::array<float,2>{0.0705112591f, 0.0454588048f},
-std::array<float,2>{0.562098801f, 0.638269961f},
-std::array<float,2>{0.334840447f, 0.929746747f},
-std::array<float,2>{0.897422254f, 0.296425343f},
-std::array<float,2>{0.489105165f, 0.494153142f},
-std::array<float,2>{0.772287726f, 0.854077518f},
-std::array<float,2>{0.147971347f, 0.538579941f},
-std::array<float,2>{0.651768446f, 0.13760674f},
-std::array<float,2>{0.418091953f, 0.0959787518f},
-std::array<float,2>{0.841784239f, 0.694031775f},
-std::array<float,2>{0.239488408f, 0.963959217f},
-std::array<float,2>{0.746985376f, 0.341900408f},
-std::array<float,2>{0.00886555295f, 0.419152141f},
-std::array<float,2>{0.583308876f, 0.787034154f},
-std::array<float,2>{0.286798269f, 0.591888785f},
-std::array<float,2>{0.969262123f, 0.236391857f},
-std::array<float,2>{0.162619278f, 0.187427208f},
-std::array<float,2>{0.683923841f, 0.513130665f},
-std::array<float,2>{0.439718038f, 0.813239694f},
-std::array<float,2>{0.797106385f, 0.4507339f},
-std::array<float,2>{0.371004075f, 0.277261466f},
-std::array<float,2>{0.932779491f, 0.881376147f},
-std::array<float,2>{0.106839225f, 0.672566354f},
-std::array<float,2>{0.516392231f, 0.026456885f},
-std::array<float,2>{0.494615018f, 0.189231798f},
-std::array<float,2>{0.773899436f, 0.608539701f},
-std::array<float,2>{0.152019888f, 0.771480381f},
-std::array<float,2>{0.643899918f, 0.380638778f},
-std::array<float,2>{0.0674330667f, 0.347075701f},
-std::array<float,2>{0.552731574f, 0.998827577f},
-std::array<float,2>{0.342949241f, 0.73521024f},
-std::array<float,2>{0.89957267f, 0.0721974745f},
-std::array<float,2>{0.191316634f, 0.0575411879f},
-std::array<float,2>{0.699048102f, 0.647147536f},
-std::array<float,2>{0.400761217f, 0.906374931f},
-std::array<float,2>{0.862529159f, 0.306101799f},
-std::array<float,2>{0.257372677f, 0.471033186f},
-std::array<float,2>{0.949329317f, 0.863771021f},
-std::array<float,2>{0.0622945279f, 0.551301777f},
-std::array<float,2>{0.60717535f, 0.14221479f},
-std::array<float,2>{0.361777872f, 0.120220408f},
-std::array<float,2>{0.925215602f, 0.709844768f},
-std::array<float,2>{0.0953239053f, 0.946509361f},
-std::array<float,2>{0.52495122f, 0.323368728f},
-std::array<float,2>{0.170877233f, 0.426772118f},
-std::array<float,2>{0.678795397f, 0.801006317f},
-std::array<float,2>{0.448885232f, 0.569879472f},
-std::array<float,2>{0.80639708f, 0.220604658f},
-std::array<float,2>{0.00766165182f, 0.158659354f},
-std::array<float,2>{0.591320276f, 0.528373182f},
-std::array<float,2>{0.291570246f, 0.829528689f},
-std::array<float,2>{0.981406808f, 0.460477263f},
-std::array<float,2>{0.412977666f, 0.253800064f},
-std::array<float,2>{0.828163087f, 0.896159768f},
-std::array<float,2>{0.242548153f, 0.664918184f},
-std::array<float,2>{0.738344073f, 0.0142772011f},
-std::array<float,2>{0.309326023f, 0.134877905f},
-std::array<float,2>{0.991398692f, 0.533329964f},
-std::array<float,2>{0.0228452571f, 0.858515918f},
-std::array<float,2>{0.5710935f, 0.497913152f},
-std::array<float,2>{0.231357843f, 0.29194665f},
-std::array<float,2>{0.728649735f, 0.935493648f},
-std::array<float,2>{0.436383903f, 0.634671092f},
-std::array<float,2>{0.827294469f, 0.0406662226f},
-std::array<float,2>{0.118143201f, 0.0848152936f},
-std::array<float,2>{0.514127016f, 0.726409495f},
-std::array<float,2>{0.353043318f, 0.971812189f},
-std::array<float,2>{0.907853663f, 0.374302417f},
-std::array<float,2>{0.453999668f, 0.398778647f},
-std::array<float,2>{0.785663784f, 0.765576899f},
-std::array<float,2>{0.175377235f, 0.610378385f},
-std::array<float,2>{0.65944165f, 0.209635347f},
-std::array<float,2>{0.384234965f, 0.0298400968f},
-std::array<float,2>{0.856801152f, 0.678482056f},
-std::array<float,2>{0.209432572f, 0.877358556f},
-std::array<float,2>{0.704958618f, 0.278980613f},
-std::array<float,2>{0.0397405252f, 0.445392221f},
-std::array<float,2>{0.615060031f, 0.817256749f},
-std::array<float,2>{0.277544886f, 0.509133875f},
-std::array<float,2>{0.953755617f, 0.18251434f},
-std::array<float,2>{0.128163189f, 0.24195537f},
-std::array<float,2>{0.639885545f, 0.587955415f},
-std::array<float,2>{0.483141541f, 0.783986151f},
-std::array<float,2>{0.75094837f, 0.416619718f},
-std::array<float,2>{0.315188318f, 0.337291956f},
-std::array<float,2>{0.880023241f, 0.968058169f},
-std::array<float,2>{0.0866589174f, 0.688136935f},
-std::array<float,2>{0.544647574f, 0.100033887f},
-std::array<float,2>{0.424147427f, 0.17427285f},
-std::array<float,2>{0.816305935f, 0.501218915f},
-std::array<float,2>{0.219824106f, 0.826241493f},
-std::array<float,2>{0.719223201f, 0.439617515f},
-std::array<float,2>{0.0277778152f, 0.267584354f},
-std::array<float,2>{0.564011753f, 0.88666749f},
-std::array<float,2>{0.30172953f, 0.684952259f},
-std::array<float,2>{0.997605085f, 0.0193240047f},
-std::array<float,2>{0.183033809f, 0.106954604f},
-std::array<float,2>{0.666758597f, 0.695671856f},
-std::array<float,2>{0.464576304f, 0.953342736f},
-std::array<float,2>{0.796206355f, 0.331241816f},
-std::array<float,2>{0.350400269f, 0.413684309f},
-std::array<float,2>{0.91681093f, 0.79445821f},
-std::array<float,2>{0.115562975f, 0.582275212f},
-std::array<float,2>{0.506093562f, 0.248943344f},
-std::array<float,2>{0.271491557f, 0.0362059399f},
-std::array<float,2>{0.963898778f, 0.632513404f},
-std::array<float,2>{0.0340529419f, 0.927880466f},
-std::array<float,2>{0.618367195f, 0.282131225f},
-std::array<float,2>{0.216761708f, 0.485019326f},
-std::array<float,2>{0.713042557f, 0.847886741f},
-std::array<float,2>{0.379654437f, 0.541668594f},
-std::array<float,2>{0.849120438f, 0.125895232f},
-std::array<float,2>{0.0808628127f, 0.217371017f},
-std::array<float,2>{0.531959057f, 0.619554818f},
-std::array<float,2>{0.324301511f, 0.755034566f},
-std::array<float,2>{0.889864266f, 0.396514624f},
-std::array<float,2>{0.469931394f, 0.363381773f},
-std::array<float,2>{0.761206269f, 0.982327223f},
-std::array<float,2>{0.14030908f, 0.732633471f},
-std::array<float,2>{0.627805352f, 0.0897950381f},
-std::array<float,2>{0.330609947f, 0.229154006f},
-std::array<float,2>{0.892077267f, 0.57678175f},
-std::array<float,2>{0.0765356198f, 0.809961677f},
-std::array<float,2>{0.555114985f, 0.436081499f},
-std::array<float,2>{0.1437549f, 0.313505322f},
-std::array<float,2>{0.653407156f, 0.941968441f},
-std::array<float,2>{0.48445794f, 0.71539706f},
-std::array<float,2>{0.769449949f, 0.113373183f},
-std::array<float,2>{0.0533208624f, 0.00168605743f},
-std::array<float,2>{0.59426403f, 0.662381828f},
-std::array<float,2>{0.259719789f, 0.903255105f},
-std::array<float,2>{0.942189276f, 0.25830999f},
-std::array<float,2>{0.39401257f, 0.462709874f},
-std::array<float,2>{0.87482816f, 0.838874936f},
-std::array<float,2>{0.199394077f, 0.522831738f},
-std::array<float,2>{0.689088047f, 0.166001678f},
-std::array<float,2>{0.444439858f, 0.0678703487f},
-std::array<float,2>{0.802842617f, 0.74507916f},
-std::array<float,2>{0.159580857f, 0.989481151f},
-std::array<float,2>{0.682186127f, 0.357354552f},
-std::array<float,2>{0.102218315f, 0.387922972f},
-std::array<float,2>{0.52024591f, 0.775081038f},
-std::array<float,2>{0.374841094f, 0.601498485f},
-std::array<float,2>{0.935453653f, 0.200548917f},
-std::array<float,2>{0.235349029f, 0.154453039f},
-std::array<float,2>{0.745306373f, 0.557878017f},
-std::array<float,2>{0.414810032f, 0.871613979f},
-std::array<float,2>{0.839291215f, 0.483271509f},
-std::array<float,2>{0.284208983f, 0.299665421f},
-std::array<float,2>{0.973672688f, 0.921664059f},
-std::array<float,2>{0.0151346503f, 0.650951385f},
-std::array<float,2>{0.580749631f, 0.0470372885f},
-std::array<float,2>{0.423609465f, 0.248755246f},
-std::array<float,2>{0.813487768f, 0.582499266f},
-std::array<float,2>{0.22224237f, 0.794768155f},
-std::array<float,2>{0.721682489f, 0.413826168f},
-std::array<float,2>{0.0295726918f, 0.331334352f},
-std::array<float,2>{0.564748287f, 0.953526437f},
-std::array<float,2>{0.303731203f, 0.695394635f},
-std::array<float,2>{0.999726355f, 0.107316084f},
-std::array<float,2>{0.181485623f, 0.0191175137f},
-std::array<float,2>{0.665660322f, 0.684683681f},
-std::array<float,2>{0.462566227f, 0.886360407f},
-std::array<float,2>{0.793556273f, 0.267930478f},
-std::array<float,2>{0.348153055f, 0.43986845f},
-std::array<float,2>{0.914819241f, 0.826571107f},
-std::array<float,2>{0.114359915f, 0.501256943f},
-std::array<float,2>{0.505420089f, 0.173856869f},
-std::array<float,2>{0.270340472f, 0.0894820765f},
-std::array<float,2>{0.961960673f, 0.732771277f},
-std::array<float,2>{0.0319747776f, 0.982051134f},
-std::array<float,2>{0.620409131f, 0.363588065f},
-std::array<float,2>{0.217873096f, 0.396948934f},
-std::array<float,2>{0.711110234f, 0.755206943f},
-std::array<float,2>{0.382165372f, 0.619303524f},
-std::array<float,2>{0.849905968f, 0.217683226f},
-std::array<float,2>{0.0792690068f, 0.125544801f},
-std::array<float,2>{0.535040736f, 0.54193753f},
-std::array<float,2>{0.327834815f, 0.847946227f},
-std::array<float,2>{0.888156176f, 0.48520717f},
-std::array<float,2>{0.471977055f, 0.281871676f},
-std::array<float,2>{0.758794963f, 0.928211391f},
-std::array<float,2>{0.1379648f, 0.632638514f},
-std::array<float,2>{0.626132309f, 0.0365605801f},
-std::array<float,2>{0.32993558f, 0.165770814f},
-std::array<float,2>{0.89424032f, 0.522631288f},
-std::array<float,2>{0.0749813169f, 0.839271367f},
-std::array<float,2>{0.557059228f, 0.462623924f},
-std::array<float,2>{0.142222971f, 0.258587867f},
-std::array<float,2>{0.65565002f, 0.902986884f},
-std::array<float,2>{0.487109125f, 0.662329555f},
-std::array<float,2>{0.767044485f, 0.00175841269f},
-std::array<float,2>{0.0511884242f, 0.11367701f},
-std::array<float,2>{0.597068012f, 0.715654254f},
-std::array<float,2>{0.261353612f, 0.942257464f},
-std::array<float,2>{0.945156693f, 0.313832581f},
-std::array<float,2>{0.39070037f, 0.436518729f},
-std::array<float,2>{0.873045206f, 0.809811771f},
-std::array<float,2>{0.202159673f, 0.577143848f},
-std::array<float,2>{0.689497113f, 0.229346201f},
-std::array<float,2>{0.443219781f, 0.0472356007f},
-std::array<float,2>{0.800944984f, 0.651330948f},
-std::array<float,2>{0.156950861f, 0.921562612f},
-std::array<float,2>{0.680888534f, 0.299384505f},
-std::array<float,2>{0.104568787f, 0.482989073f},
-std::array<float,2>{0.521516323f, 0.871829629f},
-std::array<float,2>{0.372811735f, 0.557757616f},
-std::array<float,2>{0.936866403f, 0.15458934f},
-std::array<float,2>{0.238217205f, 0.200434223f},
-std::array<float,2>{0.74329102f, 0.601117849f},
-std::array<float,2>{0.417523324f, 0.775277734f},
-std::array<float,2>{0.837043166f, 0.387947589f},
-std::array<float,2>{0.281965882f, 0.357056618f},
-std::array<float,2>{0.975102365f, 0.989588022f},
-std::array<float,2>{0.0123970052f, 0.744639874f},
-std::array<float,2>{0.579357445f, 0.0675623491f},
-std::array<float,2>{0.493562549f, 0.142552614f},
-std::array<float,2>{0.775598288f, 0.551586628f},
-std::array<float,2>{0.149366856f, 0.864223659f},
-std::array<float,2>{0.641650975f, 0.470925927f},
-std::array<float,2>{0.0698988885f, 0.305718601f},
-std::array<float,2>{0.553633451f, 0.906702638f},
-std::array<float,2>{0.341405988f, 0.647457719f},
-std::array<float,2>{0.901628971f, 0.0571361929f},
-std::array<float,2>{0.187723905f, 0.0718760863f},
-std::array<float,2>{0.695618749f, 0.735013008f},
-std::array<float,2>{0.398664713f, 0.998735785f},
-std::array<float,2>{0.859993339f, 0.346766293f},
-std::array<float,2>{0.2547912f, 0.380437434f},
-std::array<float,2>{0.952233493f, 0.771114588f},
-std::array<float,2>{0.0599641874f, 0.608845055f},
-std::array<float,2>{0.608933866f, 0.189189568f},
-std::array<float,2>{0.361136436f, 0.0146053843f},
-std::array<float,2>{0.923084497f, 0.664622307f},
-std::array<float,2>{0.0962541997f, 0.896271884f},
-std::array<float,2>{0.526301682f, 0.253638506f},
-std::array<float,2>{0.168077692f, 0.460928082f},
-std::array<float,2>{0.67757839f, 0.829229593f},
-std::array<float,2>{0.445341051f, 0.528707206f},
-std::array<float,2>{0.808368921f, 0.158307642f},
-std::array<float,2>{0.00582666835f, 0.220281571f},
-std::array<float,2>{0.591891885f, 0.570075691f},
-std::array<float,2>{0.290927768f, 0.8010903f},
-std::array<float,2>{0.984280825f, 0.427031428f},
-std::array<float,2>{0.411636621f, 0.3236866f},
-std::array<float,2>{0.830821157f, 0.946668804f},
-std::array<float,2>{0.245334759f, 0.709670186f},
-std::array<float,2>{0.740739226f, 0.120503314f},
-std::array<float,2>{0.311228544f, 0.209887475f},
-std::array<float,2>{0.989238977f, 0.61062479f},
-std::array<float,2>{0.0211915467f, 0.765297592f},
-std::array<float,2>{0.572466135f, 0.398670852f},
-std::array<float,2>{0.233402342f, 0.374226809f},
-std::array<float,2>{0.726777732f, 0.97212249f},
-std::array<float,2>{0.435397387f, 0.726091087f},
-std::array<float,2>{0.825400651f, 0.0845644698f},
-std::array<float,2>{0.120351449f, 0.0409635678f},
-std::array<float,2>{0.511778831f, 0.634326696f},
-std::array<float,2>{0.354430825f, 0.935097039f},
-std::array<float,2>{0.908511281f, 0.291655272f},
-std::array<float,2>{0.45543915f, 0.497588724f},
-std::array<float,2>{0.788744509f, 0.858731985f},
-std::array<float,2>{0.172120452f, 0.533675611f},
-std::array<float,2>{0.658058167f, 0.135061562f},
-std::array<float,2>{0.385047019f, 0.0996788666f},
-std::array<float,2>{0.858396053f, 0.688387871f},
-std::array<float,2>{0.207719401f, 0.967980504f},
-std::array<float,2>{0.706535935f, 0.33711943f},
-std::array<float,2>{0.0414664038f, 0.416876316f},
-std::array<float,2>{0.616348922f, 0.783839822f},
-std::array<float,2>{0.280770481f, 0.588150859f},
-std::array<float,2>{0.956403553f, 0.241927966f},
-std::array<float,2>{0.125749052f, 0.182294115f},
-std::array<float,2>{0.637913287f, 0.508848548f},
-std::array<float,2>{0.481390446f, 0.817050338f},
-std::array<float,2>{0.753669918f, 0.44577077f},
-std::array<float,2>{0.313745528f, 0.279152393f},
-std::array<float,2>{0.882692635f, 0.877186179f},
-std::array<float,2>{0.0887993649f, 0.678338885f},
-std::array<float,2>{0.545695901f, 0.0302007142f},
-std::array<float,2>{0.466677904f, 0.192428246f},
-std::array<float,2>{0.79116416f, 0.602048874f},
-std::array<float,2>{0.186035216f, 0.768814325f},
-std::array<float,2>{0.671238959f, 0.375767261f},
-std::array<float,2>{0.111814126f, 0.3504242f},
-std::array<float,2>{0.502256036f, 0.99220705f},
-std::array<float,2>{0.344088674f, 0.738848567f},
-std::array<float,2>{0.920975506f, 0.0756968036f},
-std::array<float,2>{0.225633651f, 0.0602027327f},
-std::array<float,2>{0.724269032f, 0.641977727f},
-std::array<float,2>{0.426595658f, 0.912122846f},
-std::array<float,2>{0.820199013f, 0.310846478f},
-std::array<float,2>{0.299744487f, 0.474782765f},
-std::array<float,2>{0.994840026f, 0.85942626f},
-std::array<float,2>{0.0252080746f, 0.547331929f},
-std::array<float,2>{0.568408608f, 0.146031067f},
-std::array<float,2>{0.322984219f, 0.123403117f},
-std::array<float,2>{0.883798778f, 0.703620017f},
-std::array<float,2>{0.0821604207f, 0.949362934f},
-std::array<float,2>{0.538704038f, 0.326708049f},
-std::array<float,2>{0.136681274f, 0.424618691f},
-std::array<float,2>{0.631964922f, 0.800286412f},
-std::array<float,2>{0.474052787f, 0.56627053f},
-std::array<float,2>{0.763197899f, 0.224588394f},
-std::array<float,2>{0.0357334688f, 0.163934916f},
-std::array<float,2>{0.621153533f, 0.524012804f},
-std::array<float,2>{0.26780051f, 0.834312618f},
-std::array<float,2>{0.96652633f, 0.453995675f},
-std::array<float,2>{0.377155006f, 0.255001217f},
-std::array<float,2>{0.846280694f, 0.892080784f},
-std::array<float,2>{0.211445615f, 0.668940842f},
-std::array<float,2>{0.715408444f, 0.00897109229f},
-std::array<float,2>{0.263537467f, 0.137311533f},
-std::array<float,2>{0.941083252f, 0.53888917f},
-std::array<float,2>{0.0473745093f, 0.854465485f},
-std::array<float,2>{0.597801387f, 0.494607329f},
-std::array<float,2>{0.19699046f, 0.296657175f},
-std::array<float,2>{0.692638576f, 0.929945529f},
-std::array<float,2>{0.395339161f, 0.638432324f},
-std::array<float,2>{0.870607615f, 0.0458674133f},
-std::array<float,2>{0.0724557564f, 0.0811812431f},
-std::array<float,2>{0.560203135f, 0.718996465f},
-std::array<float,2>{0.33312729f, 0.975409865f},
-std::array<float,2>{0.896129131f, 0.367486417f},
-std::array<float,2>{0.491287231f, 0.402991712f},
-std::array<float,2>{0.769548059f, 0.760336637f},
-std::array<float,2>{0.145097226f, 0.614947259f},
-std::array<float,2>{0.650006413f, 0.204917014f},
-std::array<float,2>{0.420559168f, 0.0266756043f},
-std::array<float,2>{0.842302203f, 0.672635496f},
-std::array<float,2>{0.241621599f, 0.881739318f},
-std::array<float,2>{0.748858988f, 0.27689296f},
-std::array<float,2>{0.0103200926f, 0.451063305f},
-std::array<float,2>{0.585828662f, 0.813049078f},
-std::array<float,2>{0.288858235f, 0.512865245f},
-std::array<float,2>{0.970726252f, 0.187154174f},
-std::array<float,2>{0.160353824f, 0.236800715f},
-std::array<float,2>{0.685739219f, 0.59207195f},
-std::array<float,2>{0.439449519f, 0.78664434f},
-std::array<float,2>{0.799281716f, 0.419265777f},
-std::array<float,2>{0.369129181f, 0.342276275f},
-std::array<float,2>{0.931574523f, 0.964197099f},
-std::array<float,2>{0.107477762f, 0.694125652f},
-std::array<float,2>{0.518329024f, 0.0958402455f},
-std::array<float,2>{0.405527055f, 0.176454678f},
-std::array<float,2>{0.865922928f, 0.507241011f},
-std::array<float,2>{0.194768488f, 0.820862293f},
-std::array<float,2>{0.702921331f, 0.444736779f},
-std::array<float,2>{0.0580763407f, 0.272675931f},
-std::array<float,2>{0.604919732f, 0.889025748f},
-std::array<float,2>{0.25367403f, 0.680577159f},
-std::array<float,2>{0.945339143f, 0.019542655f},
-std::array<float,2>{0.155578867f, 0.104769856f},
-std::array<float,2>{0.645440042f, 0.701776624f},
-std::array<float,2>{0.498940557f, 0.958417654f},
-std::array<float,2>{0.778677046f, 0.333665669f},
-std::array<float,2>{0.3362903f, 0.406291962f},
-std::array<float,2>{0.904564738f, 0.791965544f},
-std::array<float,2>{0.065777868f, 0.57890594f},
-std::array<float,2>{0.549365044f, 0.242682263f},
-std::array<float,2>{0.296474367f, 0.0321061015f},
-std::array<float,2>{0.977438509f, 0.626669705f},
-std::array<float,2>{0.00281016063f, 0.925090849f},
-std::array<float,2>{0.589443147f, 0.287167042f},
-std::array<float,2>{0.247548923f, 0.491213471f},
-std::array<float,2>{0.737863064f, 0.844009995f},
-std::array<float,2>{0.409230977f, 0.543511093f},
-std::array<float,2>{0.835246623f, 0.131887019f},
-std::array<float,2>{0.0987563953f, 0.214127213f},
-std::array<float,2>{0.529276013f, 0.622304559f},
-std::array<float,2>{0.36612156f, 0.750098109f},
-std::array<float,2>{0.927660704f, 0.393708795f},
-std::array<float,2>{0.450204194f, 0.362379432f},
-std::array<float,2>{0.808679044f, 0.979682148f},
-std::array<float,2>{0.167702034f, 0.729308784f},
-std::array<float,2>{0.6725384f, 0.0921996534f},
-std::array<float,2>{0.356617093f, 0.232614517f},
-std::array<float,2>{0.914018691f, 0.570321977f},
-std::array<float,2>{0.123189919f, 0.80685091f},
-std::array<float,2>{0.507955849f, 0.431942761f},
-std::array<float,2>{0.178193614f, 0.316529721f},
-std::array<float,2>{0.663694501f, 0.940974474f},
-std::array<float,2>{0.460581243f, 0.713378012f},
-std::array<float,2>{0.783640862f, 0.11281471f},
-std::array<float,2>{0.0181915127f, 0.00695726695f},
-std::array<float,2>{0.576496959f, 0.657654107f},
-std::array<float,2>{0.307868809f, 0.899564981f},
-std::array<float,2>{0.988251865f, 0.261871785f},
-std::array<float,2>{0.430824369f, 0.46502775f},
-std::array<float,2>{0.821298659f, 0.840477347f},
-std::array<float,2>{0.228607595f, 0.516206443f},
-std::array<float,2>{0.733391464f, 0.169844761f},
-std::array<float,2>{0.476917863f, 0.0643039644f},
-std::array<float,2>{0.757077456f, 0.746219814f},
-std::array<float,2>{0.129589573f, 0.985187829f},
-std::array<float,2>{0.63568747f, 0.354616582f},
-std::array<float,2>{0.093186833f, 0.384549767f},
-std::array<float,2>{0.541671216f, 0.779169679f},
-std::array<float,2>{0.318411201f, 0.597592831f},
-std::array<float,2>{0.875690937f, 0.198173493f},
-std::array<float,2>{0.203202739f, 0.148826674f},
-std::array<float,2>{0.707935691f, 0.560076296f},
-std::array<float,2>{0.387966901f, 0.869632006f},
-std::array<float,2>{0.85520649f, 0.478334516f},
-std::array<float,2>{0.276397586f, 0.303328186f},
-std::array<float,2>{0.95976299f, 0.916088283f},
-std::array<float,2>{0.0431180932f, 0.654687941f},
-std::array<float,2>{0.610671461f, 0.0510789938f},
-std::array<float,2>{0.380378366f, 0.216559008f},
-std::array<float,2>{0.847723365f, 0.618058562f},
-std::array<float,2>{0.215465337f, 0.757098973f},
-std::array<float,2>{0.714007318f, 0.394650459f},
-std::array<float,2>{0.0346875638f, 0.366357446f},
-std::array<float,2>{0.617915213f, 0.983861387f},
-std::array<float,2>{0.273074389f, 0.731963098f},
-std::array<float,2>{0.962946892f, 0.0876034722f},
-std::array<float,2>{0.139096797f, 0.0371229388f},
-std::array<float,2>{0.628793597f, 0.628906369f},
-std::array<float,2>{0.468767762f, 0.926955044f},
-std::array<float,2>{0.760691464f, 0.285032958f},
-std::array<float,2>{0.325528502f, 0.486535639f},
-std::array<float,2>{0.88951546f, 0.8515082f},
-std::array<float,2>{0.0816499591f, 0.539911747f},
-std::array<float,2>{0.532427609f, 0.128015682f},
-std::array<float,2>{0.30229798f, 0.109284118f},
-std::array<float,2>{0.996245384f, 0.697824538f},
-std::array<float,2>{0.029110847f, 0.956245542f},
-std::array<float,2>{0.56308639f, 0.329456925f},
-std::array<float,2>{0.219590381f, 0.410855621f},
-std::array<float,2>{0.72022754f, 0.795732915f},
-std::array<float,2>{0.42576766f, 0.585816264f},
-std::array<float,2>{0.815207958f, 0.247842625f},
-std::array<float,2>{0.11697749f, 0.172047287f},
-std::array<float,2>{0.507129908f, 0.502787709f},
-std::array<float,2>{0.35114941f, 0.825865746f},
-std::array<float,2>{0.917552888f, 0.439026982f},
-std::array<float,2>{0.463587612f, 0.267529786f},
-std::array<float,2>{0.795071959f, 0.883303463f},
-std::array<float,2>{0.181957468f, 0.686230659f},
-std::array<float,2>{0.667521179f, 0.0170203485f},
-std::array<float,2>{0.373606771f, 0.152755499f},
-std::array<float,2>{0.934058964f, 0.55546993f},
-std::array<float,2>{0.103053637f, 0.873840868f},
-std::array<float,2>{0.521138132f, 0.482317626f},
-std::array<float,2>{0.158947885f, 0.297181189f},
-std::array<float,2>{0.683025181f, 0.919412732f},
-std::array<float,2>{0.444143832f, 0.649935901f},
-std::array<float,2>{0.804147005f, 0.0505105071f},
-std::array<float,2>{0.0138007766f, 0.068895936f},
-std::array<float,2>{0.581454039f, 0.743902206f},
-std::array<float,2>{0.28335166f, 0.991836488f},
-std::array<float,2>{0.973192036f, 0.357969612f},
-std::array<float,2>{0.415095836f, 0.389981091f},
-std::array<float,2>{0.838622093f, 0.77592361f},
-std::array<float,2>{0.236065775f, 0.599313259f},
-std::array<float,2>{0.744298041f, 0.201681316f},
-std::array<float,2>{0.48594895f, 0.00269868481f},
-std::array<float,2>{0.768104613f, 0.662092626f},
-std::array<float,2>{0.142905802f, 0.906179309f},
-std::array<float,2>{0.653314948f, 0.25989297f},
-std::array<float,2>{0.0773594379f, 0.463010669f},
-std::array<float,2>{0.556061387f, 0.83618319f},
-std::array<float,2>{0.331854552f, 0.52128315f},
-std::array<float,2>{0.891548932f, 0.166128263f},
-std::array<float,2>{0.20035021f, 0.22739321f},
-std::array<float,2>{0.688367844f, 0.575212896f},
-std::array<float,2>{0.393541902f, 0.812013328f},
-std::array<float,2>{0.873445511f, 0.435539961f},
-std::array<float,2>{0.258279204f, 0.315374255f},
-std::array<float,2>{0.943259954f, 0.945087254f},
-std::array<float,2>{0.0543235764f, 0.717096627f},
-std::array<float,2>{0.595646322f, 0.116391011f},
-std::array<float,2>{0.447687626f, 0.157588407f},
-std::array<float,2>{0.805326521f, 0.531064391f},
-std::array<float,2>{0.171446756f, 0.830141246f},
-std::array<float,2>{0.67865628f, 0.457210511f},
-std::array<float,2>{0.0945282504f, 0.251054496f},
-std::array<float,2>{0.524284542f, 0.897612333f},
-std::array<float,2>{0.362522244f, 0.667292953f},
-std::array<float,2>{0.924675763f, 0.0118441693f},
-std::array<float,2>{0.243755668f, 0.118845344f},
-std::array<float,2>{0.739303231f, 0.708568633f},
-std::array<float,2>{0.413360238f, 0.948883533f},
-std::array<float,2>{0.829501152f, 0.321912915f},
-std::array<float,2>{0.292606711f, 0.428152919f},
-std::array<float,2>{0.981897712f, 0.804115415f},
-std::array<float,2>{0.00678165816f, 0.568341255f},
-std::array<float,2>{0.589867413f, 0.221418783f},
-std::array<float,2>{0.342023104f, 0.056030672f},
-std::array<float,2>{0.898954749f, 0.645787835f},
-std::array<float,2>{0.0671136305f, 0.910155416f},
-std::array<float,2>{0.550964892f, 0.307808995f},
-std::array<float,2>{0.150757402f, 0.469212413f},
-std::array<float,2>{0.643089294f, 0.866671443f},
-std::array<float,2>{0.495505631f, 0.553503096f},
-std::array<float,2>{0.774932921f, 0.144271225f},
-std::array<float,2>{0.0613021888f, 0.189512134f},
-std::array<float,2>{0.605960011f, 0.606109679f},
-std::array<float,2>{0.256687343f, 0.771614015f},
-std::array<float,2>{0.950817108f, 0.38204053f},
-std::array<float,2>{0.401653439f, 0.34517324f},
-std::array<float,2>{0.861907363f, 0.997987688f},
-std::array<float,2>{0.190262243f, 0.736654341f},
-std::array<float,2>{0.697676539f, 0.0736693591f},
-std::array<float,2>{0.278598398f, 0.23843956f},
-std::array<float,2>{0.954939902f, 0.58596462f},
-std::array<float,2>{0.0403982438f, 0.782004178f},
-std::array<float,2>{0.613963723f, 0.414120823f},
-std::array<float,2>{0.210746452f, 0.339633942f},
-std::array<float,2>{0.703869581f, 0.966138601f},
-std::array<float,2>{0.382957846f, 0.690927565f},
-std::array<float,2>{0.856221318f, 0.0981683657f},
-std::array<float,2>{0.0872624964f, 0.0284243748f},
-std::array<float,2>{0.543358386f, 0.675856769f},
-std::array<float,2>{0.315873504f, 0.875915289f},
-std::array<float,2>{0.879878163f, 0.280595601f},
-std::array<float,2>{0.484333515f, 0.448480725f},
-std::array<float,2>{0.751418531f, 0.819741726f},
-std::array<float,2>{0.127385706f, 0.509999156f},
-std::array<float,2>{0.638746023f, 0.181298748f},
-std::array<float,2>{0.437094361f, 0.0826592967f},
-std::array<float,2>{0.826684058f, 0.72314477f},
-std::array<float,2>{0.231761903f, 0.970416486f},
-std::array<float,2>{0.729801297f, 0.372701675f},
-std::array<float,2>{0.0221288688f, 0.401256889f},
-std::array<float,2>{0.571415842f, 0.763657331f},
-std::array<float,2>{0.310079217f, 0.612169504f},
-std::array<float,2>{0.990900636f, 0.208427176f},
-std::array<float,2>{0.174170434f, 0.133920029f},
-std::array<float,2>{0.658774078f, 0.532224238f},
-std::array<float,2>{0.45487839f, 0.857088566f},
-std::array<float,2>{0.786436617f, 0.499363661f},
-std::array<float,2>{0.352240741f, 0.289609253f},
-std::array<float,2>{0.906715691f, 0.936867595f},
-std::array<float,2>{0.118716225f, 0.636207402f},
-std::array<float,2>{0.515115738f, 0.0420620814f},
-std::array<float,2>{0.475636035f, 0.226270452f},
-std::array<float,2>{0.765421808f, 0.563192785f},
-std::array<float,2>{0.133028924f, 0.797422588f},
-std::array<float,2>{0.629910171f, 0.422516316f},
-std::array<float,2>{0.0853699744f, 0.325295627f},
-std::array<float,2>{0.536680818f, 0.95132333f},
-std::array<float,2>{0.320618182f, 0.705963016f},
-std::array<float,2>{0.885303259f, 0.122910313f},
-std::array<float,2>{0.213888153f, 0.0101224892f},
-std::array<float,2>{0.717331231f, 0.671150804f},
-std::array<float,2>{0.375248432f, 0.893232942f},
-std::array<float,2>{0.843833923f, 0.25728333f},
-std::array<float,2>{0.267537355f, 0.455581635f},
-std::array<float,2>{0.968096733f, 0.832807064f},
-std::array<float,2>{0.0385413095f, 0.525656521f},
-std::array<float,2>{0.624317586f, 0.160913885f},
-std::array<float,2>{0.346341223f, 0.0777498186f},
-std::array<float,2>{0.918298602f, 0.741910458f},
-std::array<float,2>{0.111230657f, 0.994368196f},
-std::array<float,2>{0.501592815f, 0.347671896f},
-std::array<float,2>{0.184449062f, 0.377767444f},
-std::array<float,2>{0.66831255f, 0.767111599f},
-std::array<float,2>{0.467233956f, 0.605103731f},
-std::array<float,2>{0.789692104f, 0.194925129f},
-std::array<float,2>{0.0269227549f, 0.146991938f},
-std::array<float,2>{0.566625297f, 0.549757123f},
-std::array<float,2>{0.298423827f, 0.861804605f},
-std::array<float,2>{0.99255836f, 0.474137396f},
-std::array<float,2>{0.42833969f, 0.310059696f},
-std::array<float,2>{0.816938639f, 0.911864698f},
-std::array<float,2>{0.223102331f, 0.644048154f},
-std::array<float,2>{0.725766242f, 0.0614540577f},
-std::array<float,2>{0.285262942f, 0.184782296f},
-std::array<float,2>{0.970490754f, 0.514955044f},
-std::array<float,2>{0.00837056059f, 0.816228807f},
-std::array<float,2>{0.582886577f, 0.452889502f},
-std::array<float,2>{0.239137575f, 0.275009155f},
-std::array<float,2>{0.747427106f, 0.88040477f},
-std::array<float,2>{0.419385582f, 0.674459159f},
-std::array<float,2>{0.840476871f, 0.0235182475f},
-std::array<float,2>{0.106198743f, 0.0947839469f},
-std::array<float,2>{0.517370939f, 0.691551089f},
-std::array<float,2>{0.369952798f, 0.961770713f},
-std::array<float,2>{0.932314396f, 0.341192096f},
-std::array<float,2>{0.440866202f, 0.420654953f},
-std::array<float,2>{0.798752069f, 0.788550138f},
-std::array<float,2>{0.163889989f, 0.591103315f},
-std::array<float,2>{0.685299039f, 0.235468596f},
-std::array<float,2>{0.398409426f, 0.0445376374f},
-std::array<float,2>{0.868454278f, 0.638860822f},
-std::array<float,2>{0.199003905f, 0.932989895f},
-std::array<float,2>{0.69353044f, 0.294214636f},
-std::array<float,2>{0.0491598994f, 0.492313832f},
-std::array<float,2>{0.600296915f, 0.85258913f},
-std::array<float,2>{0.263920367f, 0.536888659f},
-std::array<float,2>{0.938851357f, 0.140029222f},
-std::array<float,2>{0.146487519f, 0.205654502f},
-std::array<float,2>{0.651081681f, 0.61704886f},
-std::array<float,2>{0.489479691f, 0.758686364f},
-std::array<float,2>{0.77302134f, 0.406207234f},
-std::array<float,2>{0.335420698f, 0.370672762f},
-std::array<float,2>{0.89796865f, 0.973280668f},
-std::array<float,2>{0.0720550492f, 0.720924199f},
-std::array<float,2>{0.560592115f, 0.0799890608f},
-std::array<float,2>{0.406324714f, 0.130274773f},
-std::array<float,2>{0.833777905f, 0.545986831f},
-std::array<float,2>{0.249204755f, 0.846156955f},
-std::array<float,2>{0.736161411f, 0.489000797f},
-std::array<float,2>{0.00135895004f, 0.286886275f},
-std::array<float,2>{0.587537527f, 0.923348486f},
-std::array<float,2>{0.293601722f, 0.628447771f},
-std::array<float,2>{0.978675842f, 0.0351175889f},
-std::array<float,2>{0.164406821f, 0.0915134922f},
-std::array<float,2>{0.675696611f, 0.727518082f},
-std::array<float,2>{0.452451259f, 0.977282763f},
-std::array<float,2>{0.81184423f, 0.360422611f},
-std::array<float,2>{0.363743186f, 0.391322017f},
-std::array<float,2>{0.92892009f, 0.75345391f},
-std::array<float,2>{0.100006714f, 0.624315679f},
-std::array<float,2>{0.531150222f, 0.212877631f},
-std::array<float,2>{0.251227468f, 0.0231359713f},
-std::array<float,2>{0.948766232f, 0.682821035f},
-std::array<float,2>{0.0558590814f, 0.888065815f},
-std::array<float,2>{0.603511453f, 0.270005494f},
-std::array<float,2>{0.193318784f, 0.441852629f},
-std::array<float,2>{0.701157272f, 0.823415458f},
-std::array<float,2>{0.402416408f, 0.50560528f},
-std::array<float,2>{0.864126444f, 0.179541722f},
-std::array<float,2>{0.064150162f, 0.245433748f},
-std::array<float,2>{0.548450768f, 0.580334008f},
-std::array<float,2>{0.338912964f, 0.790176332f},
-std::array<float,2>{0.903270423f, 0.409264892f},
-std::array<float,2>{0.496976376f, 0.33429715f},
-std::array<float,2>{0.779704988f, 0.959347963f},
-std::array<float,2>{0.152489349f, 0.700289905f},
-std::array<float,2>{0.646812201f, 0.103339933f},
-std::array<float,2>{0.317194968f, 0.195490286f},
-std::array<float,2>{0.877078295f, 0.593997061f},
-std::array<float,2>{0.0911067948f, 0.780266345f},
-std::array<float,2>{0.539189816f, 0.384862036f},
-std::array<float,2>{0.132404149f, 0.35225147f},
-std::array<float,2>{0.634328306f, 0.988233387f},
-std::array<float,2>{0.479524493f, 0.748325944f},
-std::array<float,2>{0.754825234f, 0.0659330338f},
-std::array<float,2>{0.0459899306f, 0.0545969605f},
-std::array<float,2>{0.612955689f, 0.65246433f},
-std::array<float,2>{0.273488492f, 0.91445148f},
-std::array<float,2>{0.957596242f, 0.301287532f},
-std::array<float,2>{0.389590114f, 0.47909525f},
-std::array<float,2>{0.851655006f, 0.868863344f},
-std::array<float,2>{0.20696494f, 0.561594546f},
-std::array<float,2>{0.710753083f, 0.150721803f},
-std::array<float,2>{0.458092481f, 0.109666765f},
-std::array<float,2>{0.78240025f, 0.712282479f},
-std::array<float,2>{0.177256078f, 0.938452363f},
-std::array<float,2>{0.660535753f, 0.319313347f},
-std::array<float,2>{0.121754929f, 0.431518853f},
-std::array<float,2>{0.511330724f, 0.805076599f},
-std::array<float,2>{0.358920068f, 0.573852718f},
-std::array<float,2>{0.910354972f, 0.230932742f},
-std::array<float,2>{0.227626786f, 0.171260193f},
-std::array<float,2>{0.731367409f, 0.518131614f},
-std::array<float,2>{0.43209219f, 0.842075527f},
-std::array<float,2>{0.823134303f, 0.467159033f},
-std::array<float,2>{0.30660817f, 0.265018672f},
-std::array<float,2>{0.984993458f, 0.901933491f},
-std::array<float,2>{0.0160125159f, 0.659426749f},
-std::array<float,2>{0.575211287f, 0.00487350347f},
-std::array<float,2>{0.416439682f, 0.202269241f},
-std::array<float,2>{0.836345971f, 0.597836256f},
-std::array<float,2>{0.236806855f, 0.77660358f},
-std::array<float,2>{0.743076384f, 0.389432669f},
-std::array<float,2>{0.0127428528f, 0.358707428f},
-std::array<float,2>{0.578360081f, 0.99025774f},
-std::array<float,2>{0.282321841f, 0.742415905f},
-std::array<float,2>{0.976065934f, 0.0697225705f},
-std::array<float,2>{0.157978147f, 0.048939798f},
-std::array<float,2>{0.680344701f, 0.649320006f},
-std::array<float,2>{0.441743106f, 0.918870211f},
-std::array<float,2>{0.802358389f, 0.298466861f},
-std::array<float,2>{0.371917188f, 0.481358171f},
-std::array<float,2>{0.935630262f, 0.874717474f},
-std::array<float,2>{0.103620455f, 0.555679917f},
-std::array<float,2>{0.522778094f, 0.153815553f},
-std::array<float,2>{0.260741174f, 0.115479738f},
-std::array<float,2>{0.943801999f, 0.71803987f},
-std::array<float,2>{0.0520122461f, 0.94411701f},
-std::array<float,2>{0.596122503f, 0.316344827f},
-std::array<float,2>{0.201961577f, 0.434245467f},
-std::array<float,2>{0.690631688f, 0.811019301f},
-std::array<float,2>{0.391615123f, 0.575193167f},
-std::array<float,2>{0.871718347f, 0.227611348f},
-std::array<float,2>{0.075580366f, 0.167165235f},
-std::array<float,2>{0.55769825f, 0.519707203f},
-std::array<float,2>{0.328640342f, 0.837761402f},
-std::array<float,2>{0.893121123f, 0.464792728f},
-std::array<float,2>{0.488020092f, 0.261580467f},
-std::array<float,2>{0.765974164f, 0.904749274f},
-std::array<float,2>{0.140920088f, 0.660292327f},
-std::array<float,2>{0.654860735f, 0.0038137699f},
-std::array<float,2>{0.327058733f, 0.127227575f},
-std::array<float,2>{0.887366176f, 0.540041864f},
-std::array<float,2>{0.0785550624f, 0.85028255f},
-std::array<float,2>{0.533468246f, 0.487404436f},
-std::array<float,2>{0.137299553f, 0.28335768f},
-std::array<float,2>{0.625726223f, 0.926039875f},
-std::array<float,2>{0.471237659f, 0.630501986f},
-std::array<float,2>{0.758687317f, 0.0385035798f},
-std::array<float,2>{0.0329309292f, 0.0861070454f},
-std::array<float,2>{0.619872153f, 0.730977476f},
-std::array<float,2>{0.271141142f, 0.983201146f},
-std::array<float,2>{0.961560488f, 0.365787178f},
-std::array<float,2>{0.381059647f, 0.396103859f},
-std::array<float,2>{0.850821733f, 0.756350577f},
-std::array<float,2>{0.217368498f, 0.618576467f},
-std::array<float,2>{0.712668061f, 0.215111703f},
-std::array<float,2>{0.461730272f, 0.0158237237f},
-std::array<float,2>{0.794437408f, 0.68684572f},
-std::array<float,2>{0.180337384f, 0.883921385f},
-std::array<float,2>{0.664974391f, 0.265821606f},
-std::array<float,2>{0.113302805f, 0.438431799f},
-std::array<float,2>{0.503918827f, 0.825171828f},
-std::array<float,2>{0.349262089f, 0.50305748f},
-std::array<float,2>{0.915812314f, 0.173325241f},
-std::array<float,2>{0.220997781f, 0.246329412f},
-std::array<float,2>{0.721061945f, 0.584796548f},
-std::array<float,2>{0.422002912f, 0.79629159f},
-std::array<float,2>{0.812693775f, 0.411799461f},
-std::array<float,2>{0.303081304f, 0.328394622f},
-std::array<float,2>{0.99878341f, 0.95513624f},
-std::array<float,2>{0.0305943545f, 0.698853612f},
-std::array<float,2>{0.566100776f, 0.108089134f},
-std::array<float,2>{0.482260108f, 0.180239618f},
-std::array<float,2>{0.752356827f, 0.511164665f},
-std::array<float,2>{0.126296431f, 0.818430603f},
-std::array<float,2>{0.63685596f, 0.44817248f},
-std::array<float,2>{0.0890221372f, 0.280236781f},
-std::array<float,2>{0.546383321f, 0.876329184f},
-std::array<float,2>{0.312782675f, 0.67700994f},
-std::array<float,2>{0.881475747f, 0.0279442165f},
-std::array<float,2>{0.208854973f, 0.0989561155f},
-std::array<float,2>{0.705183208f, 0.689907491f},
-std::array<float,2>{0.385998964f, 0.965212762f},
-std::array<float,2>{0.85912168f, 0.337987363f},
-std::array<float,2>{0.279765725f, 0.415867597f},
-std::array<float,2>{0.956025362f, 0.782449901f},
-std::array<float,2>{0.0424006581f, 0.587067127f},
-std::array<float,2>{0.615670979f, 0.239761129f},
-std::array<float,2>{0.355063498f, 0.0419498608f},
-std::array<float,2>{0.909194827f, 0.634817243f},
-std::array<float,2>{0.119694039f, 0.935588479f},
-std::array<float,2>{0.513366401f, 0.290045768f},
-std::array<float,2>{0.17376475f, 0.498703808f},
-std::array<float,2>{0.656652272f, 0.855679631f},
-std::array<float,2>{0.456885308f, 0.533106267f},
-std::array<float,2>{0.78732866f, 0.133464247f},
-std::array<float,2>{0.0197208058f, 0.20795472f},
-std::array<float,2>{0.573805451f, 0.612583518f},
-std::array<float,2>{0.311906517f, 0.762261629f},
-std::array<float,2>{0.990014911f, 0.401530951f},
-std::array<float,2>{0.433773994f, 0.371825278f},
-std::array<float,2>{0.82476753f, 0.96875602f},
-std::array<float,2>{0.23321633f, 0.724150896f},
-std::array<float,2>{0.727667153f, 0.0835940391f},
-std::array<float,2>{0.28985849f, 0.221772313f},
-std::array<float,2>{0.982650936f, 0.567000866f},
-std::array<float,2>{0.00471539702f, 0.803330004f},
-std::array<float,2>{0.593503952f, 0.429666132f},
-std::array<float,2>{0.244814202f, 0.320930213f},
-std::array<float,2>{0.74197948f, 0.947665811f},
-std::array<float,2>{0.410509944f, 0.707825065f},
-std::array<float,2>{0.831777573f, 0.117325515f},
-std::array<float,2>{0.0969324857f, 0.0129087539f},
-std::array<float,2>{0.527072191f, 0.666340768f},
-std::array<float,2>{0.36019212f, 0.897275627f},
-std::array<float,2>{0.922648489f, 0.250471711f},
-std::array<float,2>{0.446625829f, 0.458802998f},
-std::array<float,2>{0.806703508f, 0.831082523f},
-std::array<float,2>{0.169147164f, 0.529486537f},
-std::array<float,2>{0.676018f, 0.156802565f},
-std::array<float,2>{0.399538904f, 0.0723980218f},
-std::array<float,2>{0.860981941f, 0.737315655f},
-std::array<float,2>{0.189339578f, 0.996836901f},
-std::array<float,2>{0.697101831f, 0.344525099f},
-std::array<float,2>{0.0594440214f, 0.380954683f},
-std::array<float,2>{0.607968807f, 0.773030162f},
-std::array<float,2>{0.255513191f, 0.606929719f},
-std::array<float,2>{0.951553047f, 0.19047305f},
-std::array<float,2>{0.15025197f, 0.142649084f},
-std::array<float,2>{0.6412763f, 0.554039776f},
-std::array<float,2>{0.492333621f, 0.865411699f},
-std::array<float,2>{0.777023077f, 0.470080525f},
-std::array<float,2>{0.340086788f, 0.307279021f},
-std::array<float,2>{0.900900424f, 0.908387601f},
-std::array<float,2>{0.0686266199f, 0.645462096f},
-std::array<float,2>{0.553886771f, 0.0555666275f},
-std::array<float,2>{0.437702417f, 0.234727979f},
-std::array<float,2>{0.800581992f, 0.590562046f},
-std::array<float,2>{0.16209358f, 0.78751421f},
-std::array<float,2>{0.687058508f, 0.421337247f},
-std::array<float,2>{0.108898118f, 0.340702027f},
-std::array<float,2>{0.518733621f, 0.962557554f},
-std::array<float,2>{0.367928445f, 0.693096161f},
-std::array<float,2>{0.930222094f, 0.0943623632f},
-std::array<float,2>{0.240326717f, 0.0253145657f},
-std::array<float,2>{0.749539673f, 0.675740123f},
-std::array<float,2>{0.421338677f, 0.878955424f},
-std::array<float,2>{0.842777073f, 0.274162799f},
-std::array<float,2>{0.28793785f, 0.451189309f},
-std::array<float,2>{0.972230852f, 0.815358043f},
-std::array<float,2>{0.0116911922f, 0.514290452f},
-std::array<float,2>{0.584792912f, 0.184447542f},
-std::array<float,2>{0.332912475f, 0.0784464777f},
-std::array<float,2>{0.895269275f, 0.721900344f},
-std::array<float,2>{0.0741171837f, 0.974520445f},
-std::array<float,2>{0.558841109f, 0.36927399f},
-std::array<float,2>{0.146372899f, 0.404384345f},
-std::array<float,2>{0.649252951f, 0.758864105f},
-std::array<float,2>{0.490695089f, 0.616118014f},
-std::array<float,2>{0.770518422f, 0.206365898f},
-std::array<float,2>{0.0481159873f, 0.139581278f},
-std::array<float,2>{0.598709941f, 0.535734594f},
-std::array<float,2>{0.262083828f, 0.851629376f},
-std::array<float,2>{0.939575911f, 0.493487805f},
-std::array<float,2>{0.396347612f, 0.293720573f},
-std::array<float,2>{0.869477153f, 0.932167828f},
-std::array<float,2>{0.196251243f, 0.64023149f},
-std::array<float,2>{0.691585779f, 0.0431250334f},
-std::array<float,2>{0.269308507f, 0.16122818f},
-std::array<float,2>{0.965475142f, 0.527134717f},
-std::array<float,2>{0.0367835462f, 0.833599329f},
-std::array<float,2>{0.622395217f, 0.457003981f},
-std::array<float,2>{0.212539122f, 0.256701916f},
-std::array<float,2>{0.716464162f, 0.894001484f},
-std::array<float,2>{0.37852326f, 0.670760214f},
-std::array<float,2>{0.847033322f, 0.0109321261f},
-std::array<float,2>{0.0830528736f, 0.121191002f},
-std::array<float,2>{0.537793338f, 0.706912041f},
-std::array<float,2>{0.323268682f, 0.953075051f},
-std::array<float,2>{0.883632243f, 0.32443136f},
-std::array<float,2>{0.473148733f, 0.423344731f},
-std::array<float,2>{0.761721611f, 0.798423707f},
-std::array<float,2>{0.135103434f, 0.563564718f},
-std::array<float,2>{0.63148737f, 0.225322142f},
-std::array<float,2>{0.427719831f, 0.061834842f},
-std::array<float,2>{0.818364859f, 0.642831445f},
-std::array<float,2>{0.225284174f, 0.910199821f},
-std::array<float,2>{0.722712457f, 0.309144318f},
-std::array<float,2>{0.0237215757f, 0.472986102f},
-std::array<float,2>{0.569375455f, 0.862499952f},
-std::array<float,2>{0.300103515f, 0.549886942f},
-std::array<float,2>{0.995456219f, 0.148397431f},
-std::array<float,2>{0.187207401f, 0.1933759f},
-std::array<float,2>{0.670657933f, 0.604355216f},
-std::array<float,2>{0.465695053f, 0.765954137f},
-std::array<float,2>{0.792740583f, 0.378078789f},
-std::array<float,2>{0.34488821f, 0.348927677f},
-std::array<float,2>{0.920682073f, 0.995728791f},
-std::array<float,2>{0.112792082f, 0.740644038f},
-std::array<float,2>{0.503382385f, 0.0763826594f},
-std::array<float,2>{0.387179345f, 0.152176037f},
-std::array<float,2>{0.85367918f, 0.560701847f},
-std::array<float,2>{0.204678565f, 0.868108809f},
-std::array<float,2>{0.708935976f, 0.480190992f},
-std::array<float,2>{0.044297684f, 0.302618116f},
-std::array<float,2>{0.609471917f, 0.915554881f},
-std::array<float,2>{0.276024342f, 0.653477728f},
-std::array<float,2>{0.960679173f, 0.0532401167f},
-std::array<float,2>{0.130275667f, 0.0647179112f},
-std::array<float,2>{0.636622727f, 0.749780595f},
-std::array<float,2>{0.477914542f, 0.98722589f},
-std::array<float,2>{0.756728292f, 0.352812409f},
-std::array<float,2>{0.319481432f, 0.386550933f},
-std::array<float,2>{0.876038074f, 0.780988395f},
-std::array<float,2>{0.092747584f, 0.59484303f},
-std::array<float,2>{0.542611897f, 0.196749598f},
-std::array<float,2>{0.306738079f, 0.00525432033f},
-std::array<float,2>{0.986669958f, 0.658663809f},
-std::array<float,2>{0.0186607707f, 0.901254833f},
-std::array<float,2>{0.577257097f, 0.264146626f},
-std::array<float,2>{0.229926184f, 0.468431592f},
-std::array<float,2>{0.734012663f, 0.84304744f},
-std::array<float,2>{0.430586904f, 0.518657267f},
-std::array<float,2>{0.82056278f, 0.170828879f},
-std::array<float,2>{0.124541461f, 0.23231481f},
-std::array<float,2>{0.509507298f, 0.572382033f},
-std::array<float,2>{0.356207758f, 0.805974782f},
-std::array<float,2>{0.912463903f, 0.430628091f},
-std::array<float,2>{0.459288955f, 0.319517314f},
-std::array<float,2>{0.784553945f, 0.938999534f},
-std::array<float,2>{0.179513112f, 0.711405933f},
-std::array<float,2>{0.663066268f, 0.110817857f},
-std::array<float,2>{0.366931945f, 0.211230263f},
-std::array<float,2>{0.926081836f, 0.623852968f},
-std::array<float,2>{0.0979845673f, 0.752249777f},
-std::array<float,2>{0.527846754f, 0.392181426f},
-std::array<float,2>{0.166901514f, 0.360254526f},
-std::array<float,2>{0.673361063f, 0.977565467f},
-std::array<float,2>{0.449246794f, 0.727965295f},
-std::array<float,2>{0.809813917f, 0.0899467915f},
-std::array<float,2>{0.00379374484f, 0.0336681232f},
-std::array<float,2>{0.587972403f, 0.627419949f},
-std::array<float,2>{0.295313776f, 0.92233026f},
-std::array<float,2>{0.978230953f, 0.285480171f},
-std::array<float,2>{0.408950388f, 0.489735454f},
-std::array<float,2>{0.834250927f, 0.847286522f},
-std::array<float,2>{0.246349677f, 0.545666516f},
-std::array<float,2>{0.737151384f, 0.128945068f},
-std::array<float,2>{0.499272227f, 0.102263324f},
-std::array<float,2>{0.777553439f, 0.69969368f},
-std::array<float,2>{0.155008122f, 0.960057139f},
-std::array<float,2>{0.646271348f, 0.335567623f},
-std::array<float,2>{0.0653427541f, 0.408947647f},
-std::array<float,2>{0.550144374f, 0.78965652f},
-std::array<float,2>{0.337149531f, 0.581990302f},
-std::array<float,2>{0.905321896f, 0.244981468f},
-std::array<float,2>{0.194145679f, 0.177980259f},
-std::array<float,2>{0.701916158f, 0.504306972f},
-std::array<float,2>{0.405229479f, 0.822732627f},
-std::array<float,2>{0.86676681f, 0.442524165f},
-std::array<float,2>{0.252035797f, 0.270900011f},
-std::array<float,2>{0.946639597f, 0.887286186f},
-std::array<float,2>{0.0566924624f, 0.682125151f},
-std::array<float,2>{0.604431689f, 0.0223538354f},
-std::array<float,2>{0.394477606f, 0.22980237f},
-std::array<float,2>{0.874099076f, 0.577944279f},
-std::array<float,2>{0.199796319f, 0.808668852f},
-std::array<float,2>{0.688809276f, 0.437178433f},
-std::array<float,2>{0.0528405346f, 0.312609285f},
-std::array<float,2>{0.59382093f, 0.943088114f},
-std::array<float,2>{0.259176761f, 0.716486752f},
-std::array<float,2>{0.941654384f, 0.114951089f},
-std::array<float,2>{0.144214407f, 0.000712773879f},
-std::array<float,2>{0.654166758f, 0.663611472f},
-std::array<float,2>{0.485051215f, 0.903381467f},
-std::array<float,2>{0.768949747f, 0.259597331f},
-std::array<float,2>{0.330441594f, 0.461885899f},
-std::array<float,2>{0.892265558f, 0.838695049f},
-std::array<float,2>{0.0770757943f, 0.52179867f},
-std::array<float,2>{0.555469215f, 0.164878443f},
-std::array<float,2>{0.284986436f, 0.0672012046f},
-std::array<float,2>{0.974288404f, 0.74585104f},
-std::array<float,2>{0.0151841724f, 0.989123583f},
-std::array<float,2>{0.580304861f, 0.35560593f},
-std::array<float,2>{0.234731019f, 0.386929244f},
-std::array<float,2>{0.745681882f, 0.773489773f},
-std::array<float,2>{0.414090812f, 0.599623084f},
-std::array<float,2>{0.839720309f, 0.199606717f},
-std::array<float,2>{0.102021344f, 0.156019315f},
-std::array<float,2>{0.519592166f, 0.557055414f},
-std::array<float,2>{0.374137223f, 0.872778833f},
-std::array<float,2>{0.935031593f, 0.484103262f},
-std::array<float,2>{0.445247203f, 0.300429195f},
-std::array<float,2>{0.803496718f, 0.920024931f},
-std::array<float,2>{0.160030693f, 0.651392102f},
-std::array<float,2>{0.681649864f, 0.0486927666f},
-std::array<float,2>{0.349986941f, 0.175449044f},
-std::array<float,2>{0.916197658f, 0.500845075f},
-std::array<float,2>{0.116007611f, 0.82722944f},
-std::array<float,2>{0.506500959f, 0.440769881f},
-std::array<float,2>{0.183111757f, 0.268848091f},
-std::array<float,2>{0.66636759f, 0.885283053f},
-std::array<float,2>{0.464277536f, 0.683633208f},
-std::array<float,2>{0.796656013f, 0.0185020585f},
-std::array<float,2>{0.0278409924f, 0.105657458f},
-std::array<float,2>{0.563669562f, 0.696868062f},
-std::array<float,2>{0.300804496f, 0.954350591f},
-std::array<float,2>{0.997458577f, 0.330788314f},
-std::array<float,2>{0.424718052f, 0.412971526f},
-std::array<float,2>{0.8156147f, 0.793223262f},
-std::array<float,2>{0.220624045f, 0.58306849f},
-std::array<float,2>{0.719295442f, 0.249534339f},
-std::array<float,2>{0.470321715f, 0.0353683792f},
-std::array<float,2>{0.761484385f, 0.631401896f},
-std::array<float,2>{0.139933854f, 0.928784966f},
-std::array<float,2>{0.626969099f, 0.282326221f},
-std::array<float,2>{0.0805253983f, 0.486124635f},
-std::array<float,2>{0.531290054f, 0.84904027f},
-std::array<float,2>{0.324789315f, 0.542700171f},
-std::array<float,2>{0.890230834f, 0.126283422f},
-std::array<float,2>{0.216294274f, 0.218206197f},
-std::array<float,2>{0.713487089f, 0.62071836f},
-std::array<float,2>{0.379271865f, 0.754706204f},
-std::array<float,2>{0.849160731f, 0.397923768f},
-std::array<float,2>{0.272123128f, 0.364355773f},
-std::array<float,2>{0.964498401f, 0.981169641f},
-std::array<float,2>{0.0334478617f, 0.733789206f},
-std::array<float,2>{0.619122803f, 0.0887836441f},
-std::array<float,2>{0.453400165f, 0.135983065f},
-std::array<float,2>{0.785421669f, 0.534900427f},
-std::array<float,2>{0.174994498f, 0.858389676f},
-std::array<float,2>{0.659708023f, 0.496525735f},
-std::array<float,2>{0.117284365f, 0.292147756f},
-std::array<float,2>{0.51441139f, 0.934244394f},
-std::array<float,2>{0.35285145f, 0.633156776f},
-std::array<float,2>{0.907474458f, 0.0395007543f},
-std::array<float,2>{0.230622008f, 0.0851475969f},
-std::array<float,2>{0.729260981f, 0.724720418f},
-std::array<float,2>{0.435682207f, 0.971416771f},
-std::array<float,2>{0.828030705f, 0.373144299f},
-std::array<float,2>{0.308904737f, 0.400248736f},
-std::array<float,2>{0.992068946f, 0.764105916f},
-std::array<float,2>{0.0231714156f, 0.60989809f},
-std::array<float,2>{0.570619822f, 0.210765675f},
-std::array<float,2>{0.314926744f, 0.0312435422f},
-std::array<float,2>{0.880385101f, 0.678815663f},
-std::array<float,2>{0.0863913521f, 0.878709614f},
-std::array<float,2>{0.544309437f, 0.277952313f},
-std::array<float,2>{0.128678367f, 0.446809113f},
-std::array<float,2>{0.640554667f, 0.817798197f},
-std::array<float,2>{0.482624412f, 0.508723319f},
-std::array<float,2>{0.750473201f, 0.18270123f},
-std::array<float,2>{0.0393360071f, 0.240608677f},
-std::array<float,2>{0.614266694f, 0.589464843f},
-std::array<float,2>{0.278025359f, 0.784725547f},
-std::array<float,2>{0.953186154f, 0.417670161f},
-std::array<float,2>{0.384674489f, 0.3360416f},
-std::array<float,2>{0.857203186f, 0.967748642f},
-std::array<float,2>{0.209475696f, 0.689085662f},
-std::array<float,2>{0.704189181f, 0.101312988f},
-std::array<float,2>{0.256959826f, 0.187951833f},
-std::array<float,2>{0.950041413f, 0.608315825f},
-std::array<float,2>{0.0619566999f, 0.769687772f},
-std::array<float,2>{0.606723249f, 0.379767925f},
-std::array<float,2>{0.190835744f, 0.345784068f},
-std::array<float,2>{0.698547423f, 0.999642432f},
-std::array<float,2>{0.401040524f, 0.735952437f},
-std::array<float,2>{0.863235593f, 0.0707280934f},
-std::array<float,2>{0.0681371391f, 0.0579113141f},
-std::array<float,2>{0.551758349f, 0.648085535f},
-std::array<float,2>{0.343562156f, 0.907505214f},
-std::array<float,2>{0.899952412f, 0.305521935f},
-std::array<float,2>{0.495070219f, 0.471926212f},
-std::array<float,2>{0.774037778f, 0.864631832f},
-std::array<float,2>{0.151400357f, 0.552471757f},
-std::array<float,2>{0.644136846f, 0.140655726f},
-std::array<float,2>{0.412437975f, 0.119293906f},
-std::array<float,2>{0.828682601f, 0.710521042f},
-std::array<float,2>{0.243046537f, 0.945389628f},
-std::array<float,2>{0.738975763f, 0.322767973f},
-std::array<float,2>{0.00711789075f, 0.42633754f},
-std::array<float,2>{0.591120422f, 0.802566946f},
-std::array<float,2>{0.291174114f, 0.568498492f},
-std::array<float,2>{0.980604827f, 0.219526082f},
-std::array<float,2>{0.170004934f, 0.159738049f},
-std::array<float,2>{0.67958647f, 0.527990699f},
-std::array<float,2>{0.448512733f, 0.828891754f},
-std::array<float,2>{0.806069434f, 0.459700674f},
-std::array<float,2>{0.3622711f, 0.252225101f},
-std::array<float,2>{0.925684571f, 0.895011544f},
-std::array<float,2>{0.0948475972f, 0.665075958f},
-std::array<float,2>{0.524891734f, 0.0147479428f},
-std::array<float,2>{0.488412082f, 0.203376606f},
-std::array<float,2>{0.771582246f, 0.613564014f},
-std::array<float,2>{0.147740379f, 0.761457264f},
-std::array<float,2>{0.652000427f, 0.403982282f},
-std::array<float,2>{0.0711285844f, 0.368858814f},
-std::array<float,2>{0.561683297f, 0.976087987f},
-std::array<float,2>{0.334272444f, 0.720326364f},
-std::array<float,2>{0.896650076f, 0.0808178335f},
-std::array<float,2>{0.197920024f, 0.0459032804f},
-std::array<float,2>{0.695213258f, 0.637203097f},
-std::array<float,2>{0.397155136f, 0.931071818f},
-std::array<float,2>{0.867268562f, 0.295707285f},
-std::array<float,2>{0.264861584f, 0.495855957f},
-std::array<float,2>{0.938466191f, 0.855009198f},
-std::array<float,2>{0.0498490818f, 0.537621617f},
-std::array<float,2>{0.600967705f, 0.138205275f},
-std::array<float,2>{0.370352417f, 0.0972961187f},
-std::array<float,2>{0.933459103f, 0.694983363f},
-std::array<float,2>{0.10714335f, 0.96367836f},
-std::array<float,2>{0.515675485f, 0.343745649f},
-std::array<float,2>{0.162463546f, 0.418142706f},
-std::array<float,2>{0.684140444f, 0.785252273f},
-std::array<float,2>{0.440074503f, 0.593489826f},
-std::array<float,2>{0.797760367f, 0.237446159f},
-std::array<float,2>{0.00945669133f, 0.186066389f},
-std::array<float,2>{0.583538055f, 0.512646198f},
-std::array<float,2>{0.286174864f, 0.814074814f},
-std::array<float,2>{0.969082177f, 0.449568957f},
-std::array<float,2>{0.418509185f, 0.275487781f},
-std::array<float,2>{0.840971589f, 0.88229382f},
-std::array<float,2>{0.240140721f, 0.673417985f},
-std::array<float,2>{0.746505141f, 0.0258896258f},
-std::array<float,2>{0.297090352f, 0.145000279f},
-std::array<float,2>{0.994047046f, 0.548535466f},
-std::array<float,2>{0.026279036f, 0.860716224f},
-std::array<float,2>{0.568345845f, 0.47651127f},
-std::array<float,2>{0.224445075f, 0.311836749f},
-std::array<float,2>{0.725224912f, 0.913280547f},
-std::array<float,2>{0.429239631f, 0.641353786f},
-std::array<float,2>{0.817713439f, 0.0586411618f},
-std::array<float,2>{0.11024335f, 0.0747770965f},
-std::array<float,2>{0.50057292f, 0.73946023f},
-std::array<float,2>{0.346917391f, 0.993908167f},
-std::array<float,2>{0.919053435f, 0.351043403f},
-std::array<float,2>{0.468417317f, 0.376250207f},
-std::array<float,2>{0.790482223f, 0.768352628f},
-std::array<float,2>{0.18521139f, 0.602613389f},
-std::array<float,2>{0.668952942f, 0.191663459f},
-std::array<float,2>{0.376351655f, 0.00810586475f},
-std::array<float,2>{0.845662832f, 0.669623554f},
-std::array<float,2>{0.213661566f, 0.890803039f},
-std::array<float,2>{0.718072414f, 0.254842728f},
-std::array<float,2>{0.0376922116f, 0.454812884f},
-std::array<float,2>{0.623215795f, 0.835000873f},
-std::array<float,2>{0.266201109f, 0.524931967f},
-std::array<float,2>{0.967573822f, 0.16266422f},
-std::array<float,2>{0.134679526f, 0.223390147f},
-std::array<float,2>{0.629694104f, 0.564575315f},
-std::array<float,2>{0.475438386f, 0.799742997f},
-std::array<float,2>{0.764003277f, 0.425573319f},
-std::array<float,2>{0.321971506f, 0.327304691f},
-std::array<float,2>{0.886446059f, 0.950654507f},
-std::array<float,2>{0.084321931f, 0.704334795f},
-std::array<float,2>{0.535485744f, 0.124299504f},
-std::array<float,2>{0.433255464f, 0.1685756f},
-std::array<float,2>{0.824167907f, 0.516927838f},
-std::array<float,2>{0.227511585f, 0.84120971f},
-std::array<float,2>{0.731868088f, 0.466082335f},
-std::array<float,2>{0.016658932f, 0.263103426f},
-std::array<float,2>{0.574735463f, 0.898733318f},
-std::array<float,2>{0.305370599f, 0.657217562f},
-std::array<float,2>{0.985449672f, 0.00664013065f},
-std::array<float,2>{0.176244706f, 0.111791953f},
-std::array<float,2>{0.661775172f, 0.714800179f},
-std::array<float,2>{0.457163751f, 0.939453363f},
-std::array<float,2>{0.781695127f, 0.317995638f},
-std::array<float,2>{0.357579142f, 0.433367431f},
-std::array<float,2>{0.911462784f, 0.808520913f},
-std::array<float,2>{0.123004645f, 0.571797729f},
-std::array<float,2>{0.510610819f, 0.233663559f},
-std::array<float,2>{0.274562478f, 0.0526684858f},
-std::array<float,2>{0.958595634f, 0.65588069f},
-std::array<float,2>{0.0450464152f, 0.917393029f},
-std::array<float,2>{0.611558199f, 0.304095536f},
-std::array<float,2>{0.20521535f, 0.476777941f},
-std::array<float,2>{0.70920676f, 0.870750189f},
-std::array<float,2>{0.390491068f, 0.559452593f},
-std::array<float,2>{0.853072047f, 0.15034306f},
-std::array<float,2>{0.0903526992f, 0.199020013f},
-std::array<float,2>{0.540710866f, 0.596024513f},
-std::array<float,2>{0.317625284f, 0.777716875f},
-std::array<float,2>{0.878425956f, 0.382860124f},
-std::array<float,2>{0.479006022f, 0.354403466f},
-std::array<float,2>{0.755553663f, 0.985755444f},
-std::array<float,2>{0.131815568f, 0.747672558f},
-std::array<float,2>{0.633590877f, 0.0633789524f},
-std::array<float,2>{0.338525444f, 0.244074792f},
-std::array<float,2>{0.90360254f, 0.580006778f},
-std::array<float,2>{0.0631039292f, 0.792804599f},
-std::array<float,2>{0.546936572f, 0.407751679f},
-std::array<float,2>{0.154070884f, 0.332839936f},
-std::array<float,2>{0.648048043f, 0.957963765f},
-std::array<float,2>{0.49774152f, 0.702466667f},
-std::array<float,2>{0.781211197f, 0.104378991f},
-std::array<float,2>{0.0553523935f, 0.0205156934f},
-std::array<float,2>{0.602054179f, 0.681146145f},
-std::array<float,2>{0.250716627f, 0.889809668f},
-std::array<float,2>{0.948116183f, 0.271980435f},
-std::array<float,2>{0.40401721f, 0.444141656f},
-std::array<float,2>{0.865181327f, 0.822238207f},
-std::array<float,2>{0.19225429f, 0.50586307f},
-std::array<float,2>{0.700008869f, 0.177061304f},
-std::array<float,2>{0.451435864f, 0.0929023772f},
-std::array<float,2>{0.811006427f, 0.729921222f},
-std::array<float,2>{0.165768296f, 0.979310334f},
-std::array<float,2>{0.674704671f, 0.361441642f},
-std::array<float,2>{0.101213276f, 0.392726392f},
-std::array<float,2>{0.530030906f, 0.751140654f},
-std::array<float,2>{0.364744425f, 0.621662736f},
-std::array<float,2>{0.927940667f, 0.2130353f},
-std::array<float,2>{0.248672396f, 0.131231487f},
-std::array<float,2>{0.734687686f, 0.544712424f},
-std::array<float,2>{0.407991141f, 0.845015407f},
-std::array<float,2>{0.832804203f, 0.490701884f},
-std::array<float,2>{0.294683218f, 0.288132697f},
-std::array<float,2>{0.980365336f, 0.924547613f},
-std::array<float,2>{0.000533674378f, 0.625042975f},
-std::array<float,2>{0.586403191f, 0.0329854488f},
-std::array<float,2>{0.410831332f, 0.218756333f},
-std::array<float,2>{0.831186712f, 0.5689345f},
-std::array<float,2>{0.244455069f, 0.801858127f},
-std::array<float,2>{0.741500437f, 0.425962597f},
-std::array<float,2>{0.00399815338f, 0.322374642f},
-std::array<float,2>{0.593158543f, 0.946083605f},
-std::array<float,2>{0.289162189f, 0.710436046f},
-std::array<float,2>{0.983070254f, 0.119788975f},
-std::array<float,2>{0.169584423f, 0.0155437635f},
-std::array<float,2>{0.676625073f, 0.665992975f},
-std::array<float,2>{0.446976781f, 0.895484626f},
-std::array<float,2>{0.807248235f, 0.252506495f},
-std::array<float,2>{0.359677583f, 0.4592143f},
-std::array<float,2>{0.922237873f, 0.828236043f},
-std::array<float,2>{0.0974607021f, 0.527795732f},
-std::array<float,2>{0.526673198f, 0.159542054f},
-std::array<float,2>{0.255047917f, 0.0710014403f},
-std::array<float,2>{0.951906264f, 0.735668361f},
-std::array<float,2>{0.05883196f, 0.999133229f},
-std::array<float,2>{0.60750252f, 0.346432954f},
-std::array<float,2>{0.188780576f, 0.37897104f},
-std::array<float,2>{0.696634293f, 0.770351231f},
-std::array<float,2>{0.400355071f, 0.607853413f},
-std::array<float,2>{0.860536098f, 0.188282371f},
-std::array<float,2>{0.0689123571f, 0.141207606f},
-std::array<float,2>{0.554469883f, 0.551876545f},
-std::array<float,2>{0.34040001f, 0.86507225f},
-std::array<float,2>{0.900562286f, 0.472390264f},
-std::array<float,2>{0.492910326f, 0.304927826f},
-std::array<float,2>{0.776665211f, 0.907715201f},
-std::array<float,2>{0.149662554f, 0.647859693f},
-std::array<float,2>{0.641041398f, 0.0585828349f},
-std::array<float,2>{0.313252598f, 0.183476657f},
-std::array<float,2>{0.881314099f, 0.507988811f},
-std::array<float,2>{0.0897528231f, 0.818050385f},
-std::array<float,2>{0.546717882f, 0.446769983f},
-std::array<float,2>{0.126705348f, 0.277649403f},
-std::array<float,2>{0.637445271f, 0.877955198f},
-std::array<float,2>{0.481745452f, 0.679282486f},
-std::array<float,2>{0.752702594f, 0.0307325982f},
-std::array<float,2>{0.0426989906f, 0.101062067f},
-std::array<float,2>{0.61604619f, 0.688706279f},
-std::array<float,2>{0.280030161f, 0.967258215f},
-std::array<float,2>{0.955314398f, 0.336657882f},
-std::array<float,2>{0.386641711f, 0.4174501f},
-std::array<float,2>{0.85844481f, 0.78443867f},
-std::array<float,2>{0.208114475f, 0.588980377f},
-std::array<float,2>{0.705586553f, 0.24077262f},
-std::array<float,2>{0.456282228f, 0.0399422124f},
-std::array<float,2>{0.787970483f, 0.633611202f},
-std::array<float,2>{0.173184916f, 0.933921099f},
-std::array<float,2>{0.657046616f, 0.292664886f},
-std::array<float,2>{0.119513147f, 0.497027159f},
-std::array<float,2>{0.513175428f, 0.857639134f},
-std::array<float,2>{0.354861736f, 0.534408987f},
-std::array<float,2>{0.910038888f, 0.136516064f},
-std::array<float,2>{0.232466012f, 0.210360542f},
-std::array<float,2>{0.728050172f, 0.609826148f},
-std::array<float,2>{0.434194654f, 0.764330387f},
-std::array<float,2>{0.824258029f, 0.399430841f},
-std::array<float,2>{0.312345862f, 0.374021202f},
-std::array<float,2>{0.989620924f, 0.970930517f},
-std::array<float,2>{0.0202124361f, 0.725402951f},
-std::array<float,2>{0.573663116f, 0.0855879709f},
-std::array<float,2>{0.470803082f, 0.126654059f},
-std::array<float,2>{0.75794822f, 0.542384446f},
-std::array<float,2>{0.13685739f, 0.849444807f},
-std::array<float,2>{0.625027061f, 0.485752195f},
-std::array<float,2>{0.0788046569f, 0.282818288f},
-std::array<float,2>{0.534083486f, 0.929307818f},
-std::array<float,2>{0.326360554f, 0.631088853f},
-std::array<float,2>{0.886979818f, 0.0360879973f},
-std::array<float,2>{0.216981128f, 0.088135913f},
-std::array<float,2>{0.71217066f, 0.734373152f},
-std::array<float,2>{0.381667584f, 0.980856419f},
-std::array<float,2>{0.851269484f, 0.365058631f},
-std::array<float,2>{0.270800889f, 0.398016095f},
-std::array<float,2>{0.961156964f, 0.754341245f},
-std::array<float,2>{0.0326568224f, 0.620467544f},
-std::array<float,2>{0.619627535f, 0.218714178f},
-std::array<float,2>{0.348644435f, 0.0176910181f},
-std::array<float,2>{0.915280104f, 0.684205472f},
-std::array<float,2>{0.114151902f, 0.885063589f},
-std::array<float,2>{0.504551351f, 0.269259542f},
-std::array<float,2>{0.180081293f, 0.441325784f},
-std::array<float,2>{0.664073765f, 0.82794553f},
-std::array<float,2>{0.460989952f, 0.500001669f},
-std::array<float,2>{0.794106424f, 0.17517513f},
-std::array<float,2>{0.0311367773f, 0.249368787f},
-std::array<float,2>{0.565520644f, 0.583639622f},
-std::array<float,2>{0.303513408f, 0.793773711f},
-std::array<float,2>{0.998474598f, 0.412190199f},
-std::array<float,2>{0.422806323f, 0.330223024f},
-std::array<float,2>{0.813097239f, 0.95466584f},
-std::array<float,2>{0.221504018f, 0.696301103f},
-std::array<float,2>{0.721581221f, 0.106226332f},
-std::array<float,2>{0.282986879f, 0.19991754f},
-std::array<float,2>{0.976318717f, 0.600117147f},
-std::array<float,2>{0.0133061651f, 0.774305403f},
-std::array<float,2>{0.578745782f, 0.38725245f},
-std::array<float,2>{0.237029761f, 0.356377721f},
-std::array<float,2>{0.742508888f, 0.988342106f},
-std::array<float,2>{0.416941583f, 0.745244801f},
-std::array<float,2>{0.836857796f, 0.0666539669f},
-std::array<float,2>{0.104094602f, 0.047924947f},
-std::array<float,2>{0.523196936f, 0.652062297f},
-std::array<float,2>{0.371114939f, 0.920868099f},
-std::array<float,2>{0.936039031f, 0.300198048f},
-std::array<float,2>{0.441990823f, 0.483439863f},
-std::array<float,2>{0.801998913f, 0.872548282f},
-std::array<float,2>{0.157630131f, 0.557364047f},
-std::array<float,2>{0.679842949f, 0.155473247f},
-std::array<float,2>{0.392261624f, 0.114740089f},
-std::array<float,2>{0.871095896f, 0.716178536f},
-std::array<float,2>{0.20163855f, 0.94278872f},
-std::array<float,2>{0.691150546f, 0.313249677f},
-std::array<float,2>{0.0525622815f, 0.436913729f},
-std::array<float,2>{0.596406519f, 0.809467137f},
-std::array<float,2>{0.259858906f, 0.577220857f},
-std::array<float,2>{0.944175065f, 0.230241492f},
-std::array<float,2>{0.141392484f, 0.164530277f},
-std::array<float,2>{0.654341102f, 0.522134542f},
-std::array<float,2>{0.487331301f, 0.838089466f},
-std::array<float,2>{0.766149402f, 0.461004198f},
-std::array<float,2>{0.32828787f, 0.259126157f},
-std::array<float,2>{0.892669618f, 0.904073954f},
-std::array<float,2>{0.0759522617f, 0.663120329f},
-std::array<float,2>{0.558440804f, 1.4955217e-05f},
-std::array<float,2>{0.449944705f, 0.213530824f},
-std::array<float,2>{0.810279369f, 0.621546686f},
-std::array<float,2>{0.16617386f, 0.751467764f},
-std::array<float,2>{0.673099935f, 0.393320888f},
-std::array<float,2>{0.0986138806f, 0.362085283f},
-std::array<float,2>{0.527652025f, 0.978748441f},
-std::array<float,2>{0.366262496f, 0.730246544f},
-std::array<float,2>{0.926728249f, 0.0932791829f},
-std::array<float,2>{0.24701117f, 0.0326236561f},
-std::array<float,2>{0.736376345f, 0.625924766f},
-std::array<float,2>{0.408468008f, 0.924090862f},
-std::array<float,2>{0.834507823f, 0.28889218f},
-std::array<float,2>{0.295604914f, 0.491197735f},
-std::array<float,2>{0.97790283f, 0.845542312f},
-std::array<float,2>{0.00312698632f, 0.544013977f},
-std::array<float,2>{0.588404953f, 0.131604224f},
-std::array<float,2>{0.337576985f, 0.103664592f},
-std::array<float,2>{0.906235039f, 0.702675581f},
-std::array<float,2>{0.0647036955f, 0.95722568f},
-std::array<float,2>{0.550309896f, 0.332491159f},
-std::array<float,2>{0.154442564f, 0.407498986f},
-std::array<float,2>{0.645621955f, 0.792054534f},
-std::array<float,2>{0.499708533f, 0.579369426f},
-std::array<float,2>{0.777929664f, 0.24339734f},
-std::array<float,2>{0.0571362972f, 0.177461982f},
-std::array<float,2>{0.603903174f, 0.506354749f},
-std::array<float,2>{0.252556205f, 0.821542561f},
-std::array<float,2>{0.946869493f, 0.443644017f},
-std::array<float,2>{0.404580057f, 0.271508902f},
-std::array<float,2>{0.866258681f, 0.890322685f},
-std::array<float,2>{0.193702385f, 0.681625783f},
-std::array<float,2>{0.701359928f, 0.0213329624f},
-std::array<float,2>{0.275658399f, 0.149839953f},
-std::array<float,2>{0.960323811f, 0.558650732f},
-std::array<float,2>{0.0449182391f, 0.870223939f},
-std::array<float,2>{0.610314012f, 0.477087498f},
-std::array<float,2>{0.204259947f, 0.304507673f},
-std::array<float,2>{0.70836246f, 0.917552829f},
-std::array<float,2>{0.387508899f, 0.655424714f},
-std::array<float,2>{0.854417562f, 0.0519376472f},
-std::array<float,2>{0.0921534821f, 0.062558189f},
-std::array<float,2>{0.542389572f, 0.747126222f},
-std::array<float,2>{0.320070058f, 0.986160874f},
-std::array<float,2>{0.876805484f, 0.353937984f},
-std::array<float,2>{0.478460908f, 0.383762449f},
-std::array<float,2>{0.756208181f, 0.77829808f},
-std::array<float,2>{0.130680665f, 0.596225917f},
-std::array<float,2>{0.635874331f, 0.19872798f},
-std::array<float,2>{0.430058777f, 0.00613498874f},
-std::array<float,2>{0.821279407f, 0.65640533f},
-std::array<float,2>{0.23003909f, 0.899220467f},
-std::array<float,2>{0.733429134f, 0.263249576f},
-std::array<float,2>{0.01928805f, 0.466550142f},
-std::array<float,2>{0.577655375f, 0.841461599f},
-std::array<float,2>{0.307279348f, 0.517378747f},
-std::array<float,2>{0.987190485f, 0.168033153f},
-std::array<float,2>{0.179137468f, 0.233943626f},
-std::array<float,2>{0.662350416f, 0.571563184f},
-std::array<float,2>{0.459545106f, 0.807627261f},
-std::array<float,2>{0.78494215f, 0.432681829f},
-std::array<float,2>{0.355817705f, 0.317698866f},
-std::array<float,2>{0.912753284f, 0.939962268f},
-std::array<float,2>{0.124500208f, 0.71400857f},
-std::array<float,2>{0.508973956f, 0.112076163f},
-std::array<float,2>{0.378405958f, 0.162398502f},
-std::array<float,2>{0.847504258f, 0.524651647f},
-std::array<float,2>{0.212320134f, 0.835656047f},
-std::array<float,2>{0.716083765f, 0.454295754f},
-std::array<float,2>{0.0362329893f, 0.254047662f},
-std::array<float,2>{0.622932196f, 0.891520381f},
-std::array<float,2>{0.268565506f, 0.669125617f},
-std::array<float,2>{0.964949071f, 0.00841876585f},
-std::array<float,2>{0.135477632f, 0.124624416f},
-std::array<float,2>{0.631078482f, 0.70487082f},
-std::array<float,2>{0.472657621f, 0.951114058f},
-std::array<float,2>{0.762291968f, 0.32795772f},
-std::array<float,2>{0.324183136f, 0.42528519f},
-std::array<float,2>{0.882941067f, 0.799021006f},
-std::array<float,2>{0.0836125612f, 0.565326333f},
-std::array<float,2>{0.537125707f, 0.222966403f},
-std::array<float,2>{0.300676852f, 0.0595158227f},
-std::array<float,2>{0.995987296f, 0.640971005f},
-std::array<float,2>{0.0243409947f, 0.913680196f},
-std::array<float,2>{0.570214748f, 0.312295794f},
-std::array<float,2>{0.224845484f, 0.475955993f},
-std::array<float,2>{0.72333622f, 0.861183167f},
-std::array<float,2>{0.426991582f, 0.547879696f},
-std::array<float,2>{0.819264948f, 0.145224407f},
-std::array<float,2>{0.112859167f, 0.192275345f},
-std::array<float,2>{0.503739119f, 0.603490949f},
-std::array<float,2>{0.345582247f, 0.76785481f},
-std::array<float,2>{0.920000553f, 0.376578093f},
-std::array<float,2>{0.465159476f, 0.351146013f},
-std::array<float,2>{0.792223155f, 0.993597507f},
-std::array<float,2>{0.186638087f, 0.739870548f},
-std::array<float,2>{0.670364022f, 0.0743762255f},
-std::array<float,2>{0.367428273f, 0.238061026f},
-std::array<float,2>{0.930075347f, 0.593156636f},
-std::array<float,2>{0.108879901f, 0.78578186f},
-std::array<float,2>{0.519071639f, 0.418670058f},
-std::array<float,2>{0.16148524f, 0.342882663f},
-std::array<float,2>{0.686710238f, 0.963065386f},
-std::array<float,2>{0.43805337f, 0.694421411f},
-std::array<float,2>{0.800267756f, 0.0968024731f},
-std::array<float,2>{0.0110345734f, 0.0255242214f},
-std::array<float,2>{0.584409833f, 0.673123956f},
-std::array<float,2>{0.287503421f, 0.88246417f},
-std::array<float,2>{0.971684039f, 0.276281506f},
-std::array<float,2>{0.421516567f, 0.449820489f},
-std::array<float,2>{0.843606353f, 0.813636005f},
-std::array<float,2>{0.241198376f, 0.512138009f},
-std::array<float,2>{0.74950248f, 0.185574844f},
-std::array<float,2>{0.491102695f, 0.0804803222f},
-std::array<float,2>{0.771072567f, 0.719924212f},
-std::array<float,2>{0.145698875f, 0.975729108f},
-std::array<float,2>{0.648630798f, 0.368557185f},
-std::array<float,2>{0.0733740032f, 0.403686851f},
-std::array<float,2>{0.55940026f, 0.761186838f},
-std::array<float,2>{0.332313389f, 0.613996625f},
-std::array<float,2>{0.894660294f, 0.20384185f},
-std::array<float,2>{0.195588395f, 0.137847364f},
-std::array<float,2>{0.692332685f, 0.537506938f},
-std::array<float,2>{0.395888716f, 0.854958236f},
-std::array<float,2>{0.8697173f, 0.495179117f},
-std::array<float,2>{0.262454897f, 0.295353532f},
-std::array<float,2>{0.940008104f, 0.931402564f},
-std::array<float,2>{0.0486511588f, 0.63748318f},
-std::array<float,2>{0.599509358f, 0.0464727096f},
-std::array<float,2>{0.400502175f, 0.191001326f},
-std::array<float,2>{0.862670839f, 0.607059002f},
-std::array<float,2>{0.191029981f, 0.772838056f},
-std::array<float,2>{0.69886601f, 0.381564587f},
-std::array<float,2>{0.0621945634f, 0.344138354f},
-std::array<float,2>{0.607242405f, 0.99612093f},
-std::array<float,2>{0.257576168f, 0.738079727f},
-std::array<float,2>{0.949540496f, 0.0731266439f},
-std::array<float,2>{0.152335644f, 0.0550672337f},
-std::array<float,2>{0.643728495f, 0.644681275f},
-std::array<float,2>{0.494370788f, 0.908982158f},
-std::array<float,2>{0.773531497f, 0.306694925f},
-std::array<float,2>{0.343236774f, 0.470510781f},
-std::array<float,2>{0.899773836f, 0.866055608f},
-std::array<float,2>{0.0676530749f, 0.554206192f},
-std::array<float,2>{0.552481413f, 0.143436298f},
-std::array<float,2>{0.291948497f, 0.117923573f},
-std::array<float,2>{0.981014371f, 0.707235634f},
-std::array<float,2>{0.0074303099f, 0.948037863f},
-std::array<float,2>{0.591781676f, 0.320560485f},
-std::array<float,2>{0.242372245f, 0.428893358f},
-std::array<float,2>{0.738746047f, 0.803030252f},
-std::array<float,2>{0.412682384f, 0.566718042f},
-std::array<float,2>{0.828490853f, 0.222502157f},
-std::array<float,2>{0.095480077f, 0.156613082f},
-std::array<float,2>{0.525365114f, 0.529957414f},
-std::array<float,2>{0.361406326f, 0.831977606f},
-std::array<float,2>{0.924903274f, 0.458076417f},
-std::array<float,2>{0.449118346f, 0.25093019f},
-std::array<float,2>{0.806257069f, 0.896729589f},
-std::array<float,2>{0.170418397f, 0.666619003f},
-std::array<float,2>{0.679083228f, 0.0136020295f},
-std::array<float,2>{0.353477716f, 0.133062348f},
-std::array<float,2>{0.908153176f, 0.532643437f},
-std::array<float,2>{0.117894791f, 0.856127977f},
-std::array<float,2>{0.513708055f, 0.498482496f},
-std::array<float,2>{0.175643399f, 0.290711731f},
-std::array<float,2>{0.659291565f, 0.936331451f},
-std::array<float,2>{0.453846753f, 0.635555983f},
-std::array<float,2>{0.786020339f, 0.0414491519f},
-std::array<float,2>{0.0225876551f, 0.0830266923f},
-std::array<float,2>{0.570815384f, 0.72390902f},
-std::array<float,2>{0.30956623f, 0.969434857f},
-std::array<float,2>{0.991678536f, 0.371463001f},
-std::array<float,2>{0.436136842f, 0.402278334f},
-std::array<float,2>{0.827522695f, 0.762001932f},
-std::array<float,2>{0.23110415f, 0.613066316f},
-std::array<float,2>{0.728920996f, 0.207452103f},
-std::array<float,2>{0.483387738f, 0.0276639797f},
-std::array<float,2>{0.750602961f, 0.67745024f},
-std::array<float,2>{0.128290027f, 0.876749694f},
-std::array<float,2>{0.639921546f, 0.279487878f},
-std::array<float,2>{0.0869113877f, 0.447586268f},
-std::array<float,2>{0.544837713f, 0.81921196f},
-std::array<float,2>{0.315088779f, 0.511285305f},
-std::array<float,2>{0.880206406f, 0.179817945f},
-std::array<float,2>{0.209161699f, 0.239310801f},
-std::array<float,2>{0.704663217f, 0.587481141f},
-std::array<float,2>{0.383904576f, 0.783103645f},
-std::array<float,2>{0.856628895f, 0.415075928f},
-std::array<float,2>{0.277717203f, 0.338773757f},
-std::array<float,2>{0.954052567f, 0.965332687f},
-std::array<float,2>{0.0398782305f, 0.690117836f},
-std::array<float,2>{0.614921927f, 0.0994380414f},
-std::array<float,2>{0.464701086f, 0.173820645f},
-std::array<float,2>{0.795979738f, 0.503753662f},
-std::array<float,2>{0.182852477f, 0.824280977f},
-std::array<float,2>{0.666709721f, 0.437949777f},
-std::array<float,2>{0.115341611f, 0.266528815f},
-std::array<float,2>{0.506250143f, 0.884539247f},
-std::array<float,2>{0.350147307f, 0.687332809f},
-std::array<float,2>{0.916724861f, 0.0162543356f},
-std::array<float,2>{0.220048904f, 0.107868977f},
-std::array<float,2>{0.718829691f, 0.69844234f},
-std::array<float,2>{0.424056709f, 0.955912292f},
-std::array<float,2>{0.816097736f, 0.328630179f},
-std::array<float,2>{0.301302046f, 0.411147803f},
-std::array<float,2>{0.99802047f, 0.796794176f},
-std::array<float,2>{0.0273562148f, 0.584239185f},
-std::array<float,2>{0.564245462f, 0.246828288f},
-std::array<float,2>{0.324502259f, 0.0389039144f},
-std::array<float,2>{0.890010238f, 0.629983366f},
-std::array<float,2>{0.0807026029f, 0.926490486f},
-std::array<float,2>{0.532062292f, 0.28373757f},
-std::array<float,2>{0.140448421f, 0.488234282f},
-std::array<float,2>{0.627571046f, 0.849634588f},
-std::array<float,2>{0.470005453f, 0.540898979f},
-std::array<float,2>{0.760864198f, 0.127687395f},
-std::array<float,2>{0.033703927f, 0.215800792f},
-std::array<float,2>{0.618427217f, 0.618901432f},
-std::array<float,2>{0.271839947f, 0.756009638f},
-std::array<float,2>{0.964271963f, 0.395640403f},
-std::array<float,2>{0.379492313f, 0.365246475f},
-std::array<float,2>{0.848808825f, 0.982571304f},
-std::array<float,2>{0.216409177f, 0.73092258f},
-std::array<float,2>{0.713301897f, 0.0868294686f},
-std::array<float,2>{0.259493083f, 0.228358254f},
-std::array<float,2>{0.942059577f, 0.574397743f},
-std::array<float,2>{0.0535841472f, 0.8111552f},
-std::array<float,2>{0.594670773f, 0.433740079f},
-std::array<float,2>{0.19967781f, 0.3156479f},
-std::array<float,2>{0.689281523f, 0.943365932f},
-std::array<float,2>{0.393611491f, 0.718641639f},
-std::array<float,2>{0.874532223f, 0.115741603f},
-std::array<float,2>{0.0762702003f, 0.0033903874f},
-std::array<float,2>{0.554811239f, 0.660741508f},
-std::array<float,2>{0.330909222f, 0.905113459f},
-std::array<float,2>{0.891786873f, 0.260861933f},
-std::array<float,2>{0.484737605f, 0.46425125f},
-std::array<float,2>{0.769271016f, 0.837048888f},
-std::array<float,2>{0.144020781f, 0.520137429f},
-std::array<float,2>{0.65365082f, 0.167752415f},
-std::array<float,2>{0.414556086f, 0.0700917542f},
-std::array<float,2>{0.839081883f, 0.74298352f},
-std::array<float,2>{0.234896049f, 0.991101742f},
-std::array<float,2>{0.745494783f, 0.359374911f},
-std::array<float,2>{0.014777245f, 0.389083952f},
-std::array<float,2>{0.580820203f, 0.777145088f},
-std::array<float,2>{0.284581095f, 0.598171592f},
-std::array<float,2>{0.974058747f, 0.202771574f},
-std::array<float,2>{0.159261972f, 0.153485417f},
-std::array<float,2>{0.682374775f, 0.55640173f},
-std::array<float,2>{0.444676191f, 0.874219f},
-std::array<float,2>{0.803143024f, 0.48051095f},
-std::array<float,2>{0.374596059f, 0.298325628f},
-std::array<float,2>{0.935167193f, 0.917987406f},
-std::array<float,2>{0.102348834f, 0.648634911f},
-std::array<float,2>{0.520387709f, 0.049425941f},
-std::array<float,2>{0.497389644f, 0.244337782f},
-std::array<float,2>{0.780293286f, 0.581203401f},
-std::array<float,2>{0.153784618f, 0.789472938f},
-std::array<float,2>{0.647861123f, 0.408376873f},
-std::array<float,2>{0.0627930015f, 0.335347533f},
-std::array<float,2>{0.547519207f, 0.96056813f},
-std::array<float,2>{0.338149935f, 0.700156868f},
-std::array<float,2>{0.904086888f, 0.101708084f},
-std::array<float,2>{0.19148089f, 0.021602761f},
-std::array<float,2>{0.699688792f, 0.682588816f},
-std::array<float,2>{0.403351724f, 0.886882603f},
-std::array<float,2>{0.864651024f, 0.271083593f},
-std::array<float,2>{0.250098556f, 0.4431943f},
-std::array<float,2>{0.947338402f, 0.822809994f},
-std::array<float,2>{0.0547291152f, 0.504462242f},
-std::array<float,2>{0.601708055f, 0.178536743f},
-std::array<float,2>{0.365157992f, 0.0904020667f},
-std::array<float,2>{0.928486586f, 0.728339672f},
-std::array<float,2>{0.100661367f, 0.978059411f},
-std::array<float,2>{0.529644728f, 0.359400332f},
-std::array<float,2>{0.165298015f, 0.391863853f},
-std::array<float,2>{0.673948824f, 0.752790332f},
-std::array<float,2>{0.451846451f, 0.623302877f},
-std::array<float,2>{0.811080694f, 0.211436316f},
-std::array<float,2>{0.000333801552f, 0.129695207f},
-std::array<float,2>{0.586436152f, 0.545363605f},
-std::array<float,2>{0.29414165f, 0.846814573f},
-std::array<float,2>{0.979556561f, 0.490086615f},
-std::array<float,2>{0.407414079f, 0.285934389f},
-std::array<float,2>{0.832063496f, 0.922692597f},
-std::array<float,2>{0.248491347f, 0.627586782f},
-std::array<float,2>{0.735191107f, 0.0338905826f},
-std::array<float,2>{0.304973304f, 0.170100361f},
-std::array<float,2>{0.986055255f, 0.519308209f},
-std::array<float,2>{0.0171978585f, 0.843370795f},
-std::array<float,2>{0.57431227f, 0.467781812f},
-std::array<float,2>{0.2268859f, 0.264177978f},
-std::array<float,2>{0.73207593f, 0.90056926f},
-std::array<float,2>{0.433047682f, 0.658838391f},
-std::array<float,2>{0.823394716f, 0.00538155111f},
-std::array<float,2>{0.122155592f, 0.111105263f},
-std::array<float,2>{0.509873211f, 0.711442053f},
-std::array<float,2>{0.358391255f, 0.93892926f},
-std::array<float,2>{0.91192323f, 0.32008189f},
-std::array<float,2>{0.457551986f, 0.430170625f},
-std::array<float,2>{0.78177774f, 0.806439996f},
-std::array<float,2>{0.176693425f, 0.572892427f},
-std::array<float,2>{0.661268771f, 0.231784031f},
-std::array<float,2>{0.389835894f, 0.0528636575f},
-std::array<float,2>{0.852964163f, 0.654218018f},
-std::array<float,2>{0.205802187f, 0.915426135f},
-std::array<float,2>{0.709930837f, 0.302207828f},
-std::array<float,2>{0.0454909913f, 0.479867578f},
-std::array<float,2>{0.611913741f, 0.867209077f},
-std::array<float,2>{0.274908841f, 0.561119318f},
-std::array<float,2>{0.958309293f, 0.151822925f},
-std::array<float,2>{0.131128848f, 0.196815521f},
-std::array<float,2>{0.633136392f, 0.595363975f},
-std::array<float,2>{0.478592157f, 0.780438304f},
-std::array<float,2>{0.754893184f, 0.386173457f},
-std::array<float,2>{0.318265259f, 0.35329625f},
-std::array<float,2>{0.878009737f, 0.986718953f},
-std::array<float,2>{0.0901966766f, 0.749442101f},
-std::array<float,2>{0.540429413f, 0.0649871081f},
-std::array<float,2>{0.428958327f, 0.147475645f},
-std::array<float,2>{0.818323016f, 0.550611854f},
-std::array<float,2>{0.223925978f, 0.863051891f},
-std::array<float,2>{0.724906266f, 0.473398596f},
-std::array<float,2>{0.0254143104f, 0.308643669f},
-std::array<float,2>{0.56759727f, 0.910808563f},
-std::array<float,2>{0.297479331f, 0.643292546f},
-std::array<float,2>{0.993451118f, 0.0622368492f},
-std::array<float,2>{0.184654877f, 0.076943092f},
-std::array<float,2>{0.669747949f, 0.740962148f},
-std::array<float,2>{0.467805773f, 0.995280743f},
-std::array<float,2>{0.790549338f, 0.34941116f},
-std::array<float,2>{0.347453952f, 0.378565639f},
-std::array<float,2>{0.919674337f, 0.766355515f},
-std::array<float,2>{0.109449379f, 0.603964865f},
-std::array<float,2>{0.500485122f, 0.194262221f},
-std::array<float,2>{0.265931666f, 0.0116143208f},
-std::array<float,2>{0.967112541f, 0.669992328f},
-std::array<float,2>{0.0375177041f, 0.894528091f},
-std::array<float,2>{0.623683631f, 0.256242126f},
-std::array<float,2>{0.213316351f, 0.456164181f},
-std::array<float,2>{0.718448699f, 0.833171844f},
-std::array<float,2>{0.376929194f, 0.526682019f},
-std::array<float,2>{0.845085323f, 0.161958054f},
-std::array<float,2>{0.0846013203f, 0.22508961f},
-std::array<float,2>{0.536035717f, 0.564300537f},
-std::array<float,2>{0.321333081f, 0.798175275f},
-std::array<float,2>{0.885862291f, 0.422935456f},
-std::array<float,2>{0.474897444f, 0.324714899f},
-std::array<float,2>{0.764387071f, 0.952202976f},
-std::array<float,2>{0.134024128f, 0.706536472f},
-std::array<float,2>{0.62921536f, 0.121831566f},
-std::array<float,2>{0.334581494f, 0.206727386f},
-std::array<float,2>{0.897050858f, 0.615477145f},
-std::array<float,2>{0.0707524344f, 0.759578288f},
-std::array<float,2>{0.562383711f, 0.405137956f},
-std::array<float,2>{0.148254395f, 0.369789958f},
-std::array<float,2>{0.651432395f, 0.973655403f},
-std::array<float,2>{0.488898844f, 0.722594559f},
-std::array<float,2>{0.772208035f, 0.0787558109f},
-std::array<float,2>{0.0503401607f, 0.0438643657f},
-std::array<float,2>{0.601276696f, 0.639960885f},
-std::array<float,2>{0.265457749f, 0.931836247f},
-std::array<float,2>{0.937831461f, 0.293019265f},
-std::array<float,2>{0.39667514f, 0.493870616f},
-std::array<float,2>{0.868121922f, 0.852213025f},
-std::array<float,2>{0.197340786f, 0.535479128f},
-std::array<float,2>{0.694794536f, 0.139102072f},
-std::array<float,2>{0.43953234f, 0.0939491764f},
-std::array<float,2>{0.797186673f, 0.692631364f},
-std::array<float,2>{0.163034543f, 0.962069869f},
-std::array<float,2>{0.683620632f, 0.339858353f},
-std::array<float,2>{0.106618136f, 0.421748251f},
-std::array<float,2>{0.516268909f, 0.787603319f},
-std::array<float,2>{0.370715201f, 0.59010154f},
-std::array<float,2>{0.93295306f, 0.234878808f},
-std::array<float,2>{0.239505693f, 0.183998913f},
-std::array<float,2>{0.746752083f, 0.513721585f},
-std::array<float,2>{0.418274045f, 0.814695179f},
-std::array<float,2>{0.841342628f, 0.45186308f},
-std::array<float,2>{0.287100583f, 0.273907751f},
-std::array<float,2>{0.969582736f, 0.879746377f},
-std::array<float,2>{0.00923739374f, 0.675254464f},
-std::array<float,2>{0.583231628f, 0.0246599f},
-std::array<float,2>{0.434748799f, 0.208828583f},
-std::array<float,2>{0.825912297f, 0.611552954f},
-std::array<float,2>{0.23421225f, 0.762975574f},
-std::array<float,2>{0.727313697f, 0.400623143f},
-std::array<float,2>{0.0209196359f, 0.372556567f},
-std::array<float,2>{0.573225617f, 0.969765961f},
-std::array<float,2>{0.310873538f, 0.722979367f},
-std::array<float,2>{0.988675892f, 0.0822566226f},
-std::array<float,2>{0.172403067f, 0.0428274833f},
-std::array<float,2>{0.657594383f, 0.63640964f},
-std::array<float,2>{0.455929041f, 0.937221229f},
-std::array<float,2>{0.788221657f, 0.289316475f},
-std::array<float,2>{0.353659183f, 0.499593675f},
-std::array<float,2>{0.909089029f, 0.856763601f},
-std::array<float,2>{0.120772682f, 0.531432986f},
-std::array<float,2>{0.512663662f, 0.134316772f},
-std::array<float,2>{0.280533969f, 0.0976641104f},
-std::array<float,2>{0.956595421f, 0.69051671f},
-std::array<float,2>{0.0418981165f, 0.966585815f},
-std::array<float,2>{0.617155373f, 0.338894159f},
-std::array<float,2>{0.207377285f, 0.414724082f},
-std::array<float,2>{0.706710517f, 0.781658411f},
-std::array<float,2>{0.385326624f, 0.586535215f},
-std::array<float,2>{0.857575357f, 0.238825366f},
-std::array<float,2>{0.0880132765f, 0.181115553f},
-std::array<float,2>{0.544947624f, 0.510537982f},
-std::array<float,2>{0.314287782f, 0.820158243f},
-std::array<float,2>{0.882206976f, 0.44883281f},
-std::array<float,2>{0.480764955f, 0.281226605f},
-std::array<float,2>{0.753336251f, 0.875159025f},
-std::array<float,2>{0.125067428f, 0.676734269f},
-std::array<float,2>{0.638312757f, 0.0291254129f},
-std::array<float,2>{0.341074526f, 0.143981576f},
-std::array<float,2>{0.90214467f, 0.553182125f},
-std::array<float,2>{0.0697003379f, 0.867036104f},
-std::array<float,2>{0.553049624f, 0.469578415f},
-std::array<float,2>{0.148738742f, 0.308525145f},
-std::array<float,2>{0.64228195f, 0.9094612f},
-std::array<float,2>{0.493842155f, 0.646027565f},
-std::array<float,2>{0.775929928f, 0.0562790632f},
-std::array<float,2>{0.0600598268f, 0.0740696713f},
-std::array<float,2>{0.608873785f, 0.737069905f},
-std::array<float,2>{0.254246771f, 0.997300506f},
-std::array<float,2>{0.952796876f, 0.345571339f},
-std::array<float,2>{0.398945332f, 0.382670581f},
-std::array<float,2>{0.859419703f, 0.77244246f},
-std::array<float,2>{0.188016117f, 0.605888963f},
-std::array<float,2>{0.696023285f, 0.189993218f},
-std::array<float,2>{0.446099728f, 0.0124559291f},
-std::array<float,2>{0.807949603f, 0.667936325f},
-std::array<float,2>{0.168487608f, 0.898011506f},
-std::array<float,2>{0.676977336f, 0.251640767f},
-std::array<float,2>{0.0958140567f, 0.457829207f},
-std::array<float,2>{0.525728345f, 0.830985069f},
-std::array<float,2>{0.360672176f, 0.530620456f},
-std::array<float,2>{0.923720181f, 0.157729059f},
-std::array<float,2>{0.24566406f, 0.220917717f},
-std::array<float,2>{0.740654171f, 0.567554593f},
-std::array<float,2>{0.41125524f, 0.804447055f},
-std::array<float,2>{0.830244541f, 0.428463101f},
-std::array<float,2>{0.290211916f, 0.321703941f},
-std::array<float,2>{0.983815551f, 0.948250532f},
-std::array<float,2>{0.00521553122f, 0.708031893f},
-std::array<float,2>{0.592495143f, 0.118508585f},
-std::array<float,2>{0.486799121f, 0.166760966f},
-std::array<float,2>{0.767169714f, 0.520946264f},
-std::array<float,2>{0.142044723f, 0.836694062f},
-std::array<float,2>{0.655830503f, 0.463716865f},
-std::array<float,2>{0.0743643716f, 0.260528982f},
-std::array<float,2>{0.557393253f, 0.905654609f},
-std::array<float,2>{0.329176366f, 0.661509156f},
-std::array<float,2>{0.893679142f, 0.00215045712f},
-std::array<float,2>{0.202736929f, 0.117170528f},
-std::array<float,2>{0.690359116f, 0.717307508f},
-std::array<float,2>{0.391453326f, 0.944357753f},
-std::array<float,2>{0.87230587f, 0.314649791f},
-std::array<float,2>{0.260909766f, 0.434957236f},
-std::array<float,2>{0.944691062f, 0.811886966f},
-std::array<float,2>{0.0513411462f, 0.575793207f},
-std::array<float,2>{0.597285628f, 0.226851776f},
-std::array<float,2>{0.372347951f, 0.0500599593f},
-std::array<float,2>{0.937012851f, 0.649777293f},
-std::array<float,2>{0.105158925f, 0.919782817f},
-std::array<float,2>{0.522113502f, 0.297744274f},
-std::array<float,2>{0.156532526f, 0.481627762f},
-std::array<float,2>{0.68116492f, 0.873508036f},
-std::array<float,2>{0.442858905f, 0.554767609f},
-std::array<float,2>{0.801434159f, 0.152926341f},
-std::array<float,2>{0.0118476637f, 0.201368168f},
-std::array<float,2>{0.579957008f, 0.598918676f},
-std::array<float,2>{0.281532675f, 0.775654554f},
-std::array<float,2>{0.975037515f, 0.390445113f},
-std::array<float,2>{0.417020857f, 0.357623756f},
-std::array<float,2>{0.837568164f, 0.991535544f},
-std::array<float,2>{0.23735337f, 0.743192852f},
-std::array<float,2>{0.744009137f, 0.0685705245f},
-std::array<float,2>{0.304227412f, 0.247206256f},
-std::array<float,2>{0.999440253f, 0.585431635f},
-std::array<float,2>{0.0298671406f, 0.795314968f},
-std::array<float,2>{0.565064013f, 0.410183609f},
-std::array<float,2>{0.221883222f, 0.329969466f},
-std::array<float,2>{0.722376883f, 0.956946731f},
-std::array<float,2>{0.423070431f, 0.697420657f},
-std::array<float,2>{0.814047217f, 0.108812265f},
-std::array<float,2>{0.115224585f, 0.0171006694f},
-std::array<float,2>{0.505095243f, 0.685870826f},
-std::array<float,2>{0.347678274f, 0.882929027f},
-std::array<float,2>{0.914180517f, 0.267016351f},
-std::array<float,2>{0.461931139f, 0.438803971f},
-std::array<float,2>{0.793029249f, 0.825577676f},
-std::array<float,2>{0.181032926f, 0.502296984f},
-std::array<float,2>{0.665182948f, 0.17268762f},
-std::array<float,2>{0.382477224f, 0.0870782286f},
-std::array<float,2>{0.850581944f, 0.731665969f},
-std::array<float,2>{0.218306005f, 0.984003663f},
-std::array<float,2>{0.711564004f, 0.366729707f},
-std::array<float,2>{0.0314576216f, 0.395433158f},
-std::array<float,2>{0.62062192f, 0.757710814f},
-std::array<float,2>{0.269704342f, 0.617496967f},
-std::array<float,2>{0.962875724f, 0.216132432f},
-std::array<float,2>{0.138215572f, 0.128903985f},
-std::array<float,2>{0.62654078f, 0.539215863f},
-std::array<float,2>{0.472506225f, 0.850889623f},
-std::array<float,2>{0.759736121f, 0.486861467f},
-std::array<float,2>{0.327275187f, 0.284616321f},
-std::array<float,2>{0.888547122f, 0.927307904f},
-std::array<float,2>{0.0799558386f, 0.62979418f},
-std::array<float,2>{0.534216404f, 0.0376939401f},
-std::array<float,2>{0.4599832f, 0.231103569f},
-std::array<float,2>{0.784012496f, 0.573310077f},
-std::array<float,2>{0.178249598f, 0.805524111f},
-std::array<float,2>{0.663142204f, 0.43103981f},
-std::array<float,2>{0.123867646f, 0.318409473f},
-std::array<float,2>{0.508749664f, 0.937919557f},
-std::array<float,2>{0.357229292f, 0.71257931f},
-std::array<float,2>{0.91327554f, 0.109996751f},
-std::array<float,2>{0.229053214f, 0.00396678876f},
-std::array<float,2>{0.732526839f, 0.660045385f},
-std::array<float,2>{0.431228191f, 0.901762486f},
-std::array<float,2>{0.821820199f, 0.265163809f},
-std::array<float,2>{0.308544934f, 0.467296124f},
-std::array<float,2>{0.987720788f, 0.842667878f},
-std::array<float,2>{0.0177115612f, 0.517901897f},
-std::array<float,2>{0.57711035f, 0.171674281f},
-std::array<float,2>{0.319172084f, 0.0658767f},
-std::array<float,2>{0.875211537f, 0.748860359f},
-std::array<float,2>{0.0933792219f, 0.987407446f},
-std::array<float,2>{0.541350961f, 0.351603538f},
-std::array<float,2>{0.12917684f, 0.385624975f},
-std::array<float,2>{0.635150254f, 0.779375494f},
-std::array<float,2>{0.477295578f, 0.594304502f},
-std::array<float,2>{0.757658899f, 0.196219653f},
-std::array<float,2>{0.0434758216f, 0.151204333f},
-std::array<float,2>{0.610910535f, 0.562266052f},
-std::array<float,2>{0.276913673f, 0.868577242f},
-std::array<float,2>{0.95905292f, 0.478716314f},
-std::array<float,2>{0.388232052f, 0.300852299f},
-std::array<float,2>{0.854750097f, 0.914848745f},
-std::array<float,2>{0.203789726f, 0.653194964f},
-std::array<float,2>{0.707511723f, 0.0538583919f},
-std::array<float,2>{0.253352612f, 0.179004326f},
-std::array<float,2>{0.945824325f, 0.505245924f},
-std::array<float,2>{0.0585655831f, 0.824005783f},
-std::array<float,2>{0.605333686f, 0.442065388f},
-std::array<float,2>{0.195109367f, 0.270306766f},
-std::array<float,2>{0.702295065f, 0.888293386f},
-std::array<float,2>{0.405846983f, 0.683418214f},
-std::array<float,2>{0.865430117f, 0.0225354806f},
-std::array<float,2>{0.0661004782f, 0.102946281f},
-std::array<float,2>{0.549315453f, 0.701067626f},
-std::array<float,2>{0.336444587f, 0.959688902f},
-std::array<float,2>{0.905246496f, 0.334697008f},
-std::array<float,2>{0.498320818f, 0.409927577f},
-std::array<float,2>{0.77903527f, 0.790777445f},
-std::array<float,2>{0.155786604f, 0.580824077f},
-std::array<float,2>{0.644586623f, 0.245649382f},
-std::array<float,2>{0.409902215f, 0.034620285f},
-std::array<float,2>{0.835510314f, 0.628259361f},
-std::array<float,2>{0.247849688f, 0.922893703f},
-std::array<float,2>{0.737636924f, 0.28626588f},
-std::array<float,2>{0.00217561144f, 0.488407493f},
-std::array<float,2>{0.588986754f, 0.846256018f},
-std::array<float,2>{0.295911938f, 0.546453357f},
-std::array<float,2>{0.977034748f, 0.130420491f},
-std::array<float,2>{0.167245701f, 0.212370217f},
-std::array<float,2>{0.672046125f, 0.62451607f},
-std::array<float,2>{0.450992882f, 0.75306356f},
-std::array<float,2>{0.809229732f, 0.391040713f},
-std::array<float,2>{0.365251005f, 0.361291975f},
-std::array<float,2>{0.926884234f, 0.976863861f},
-std::array<float,2>{0.0992414057f, 0.726839423f},
-std::array<float,2>{0.528509319f, 0.0908432901f},
-std::array<float,2>{0.394559115f, 0.140528768f},
-std::array<float,2>{0.870500028f, 0.536302805f},
-std::array<float,2>{0.19648093f, 0.853073657f},
-std::array<float,2>{0.692999125f, 0.492992729f},
-std::array<float,2>{0.0468932316f, 0.294646442f},
-std::array<float,2>{0.598406315f, 0.933174849f},
-std::array<float,2>{0.263049304f, 0.63918674f},
-std::array<float,2>{0.94050312f, 0.0441204533f},
-std::array<float,2>{0.14497833f, 0.079413861f},
-std::array<float,2>{0.649824321f, 0.721378028f},
-std::array<float,2>{0.491743892f, 0.973016798f},
-std::array<float,2>{0.770035684f, 0.370232821f},
-std::array<float,2>{0.333593011f, 0.405615985f},
-std::array<float,2>{0.895878971f, 0.758237779f},
-std::array<float,2>{0.0727807209f, 0.616685987f},
-std::array<float,2>{0.559856117f, 0.205547825f},
-std::array<float,2>{0.288341969f, 0.0243506972f},
-std::array<float,2>{0.971639514f, 0.674200654f},
-std::array<float,2>{0.00988003425f, 0.879971445f},
-std::array<float,2>{0.585102201f, 0.27450195f},
-std::array<float,2>{0.24208492f, 0.452487409f},
-std::array<float,2>{0.748255432f, 0.815655589f},
-std::array<float,2>{0.420401067f, 0.515217304f},
-std::array<float,2>{0.841999352f, 0.18516691f},
-std::array<float,2>{0.108109675f, 0.236040071f},
-std::array<float,2>{0.517927766f, 0.591369152f},
-std::array<float,2>{0.36819151f, 0.788623869f},
-std::array<float,2>{0.930685163f, 0.420377791f},
-std::array<float,2>{0.438829392f, 0.341371685f},
-std::array<float,2>{0.799344778f, 0.961293638f},
-std::array<float,2>{0.160837904f, 0.69220686f},
-std::array<float,2>{0.686212778f, 0.0954983085f},
-std::array<float,2>{0.34429276f, 0.194410712f},
-std::array<float,2>{0.921416521f, 0.604753792f},
-std::array<float,2>{0.112205796f, 0.767005622f},
-std::array<float,2>{0.502505004f, 0.377284378f},
-std::array<float,2>{0.186017215f, 0.348398894f},
-std::array<float,2>{0.671505034f, 0.995043814f},
-std::array<float,2>{0.465831697f, 0.741613805f},
-std::array<float,2>{0.791522801f, 0.0771901309f},
-std::array<float,2>{0.0245658997f, 0.060585741f},
-std::array<float,2>{0.569271386f, 0.643784702f},
-std::array<float,2>{0.299260318f, 0.911508501f},
-std::array<float,2>{0.994435489f, 0.309945166f},
-std::array<float,2>{0.42608577f, 0.474059016f},
-std::array<float,2>{0.819761097f, 0.862116754f},
-std::array<float,2>{0.226476073f, 0.549217284f},
-std::array<float,2>{0.723686397f, 0.146864355f},
-std::array<float,2>{0.474383444f, 0.122226052f},
-std::array<float,2>{0.763122022f, 0.705378234f},
-std::array<float,2>{0.13611415f, 0.951969028f},
-std::array<float,2>{0.63269639f, 0.325736731f},
-std::array<float,2>{0.0829236209f, 0.422102988f},
-std::array<float,2>{0.538422406f, 0.797048867f},
-std::array<float,2>{0.322617143f, 0.562714458f},
-std::array<float,2>{0.884542763f, 0.225824386f},
-std::array<float,2>{0.211232692f, 0.160157606f},
-std::array<float,2>{0.715202391f, 0.526184022f},
-std::array<float,2>{0.377612293f, 0.832439601f},
-std::array<float,2>{0.84618926f, 0.455536425f},
-std::array<float,2>{0.268291205f, 0.257658899f},
-std::array<float,2>{0.965911865f, 0.892930627f},
-std::array<float,2>{0.0351712294f, 0.671447217f},
-std::array<float,2>{0.621909201f, 0.0103119919f},
-std::array<float,2>{0.383385628f, 0.241430938f},
-std::array<float,2>{0.855641246f, 0.588781834f},
-std::array<float,2>{0.210042715f, 0.783433318f},
-std::array<float,2>{0.703366399f, 0.41632539f},
-std::array<float,2>{0.0409288034f, 0.337578595f},
-std::array<float,2>{0.613542616f, 0.968599796f},
-std::array<float,2>{0.279163331f, 0.687801421f},
-std::array<float,2>{0.954205573f, 0.10016793f},
-std::array<float,2>{0.127875671f, 0.0296772961f},
-std::array<float,2>{0.639572024f, 0.677754521f},
-std::array<float,2>{0.483414263f, 0.877475679f},
-std::array<float,2>{0.751792133f, 0.278741449f},
-std::array<float,2>{0.316231608f, 0.446070701f},
-std::array<float,2>{0.878939569f, 0.816710234f},
-std::array<float,2>{0.087585777f, 0.509653151f},
-std::array<float,2>{0.543903351f, 0.181704462f},
-std::array<float,2>{0.309975564f, 0.0843086839f},
-std::array<float,2>{0.990396202f, 0.725968599f},
-std::array<float,2>{0.0216022301f, 0.972401619f},
-std::array<float,2>{0.571966648f, 0.374542624f},
-std::array<float,2>{0.232335776f, 0.399078995f},
-std::array<float,2>{0.730398893f, 0.76477015f},
-std::array<float,2>{0.436728716f, 0.611100793f},
-std::array<float,2>{0.826626718f, 0.209324121f},
-std::array<float,2>{0.118288025f, 0.135424703f},
-std::array<float,2>{0.51539284f, 0.533987582f},
-std::array<float,2>{0.351769865f, 0.859158874f},
-std::array<float,2>{0.906830907f, 0.497351825f},
-std::array<float,2>{0.454450369f, 0.291290402f},
-std::array<float,2>{0.7869066f, 0.935017109f},
-std::array<float,2>{0.174432561f, 0.634136677f},
-std::array<float,2>{0.658447564f, 0.0404798351f},
-std::array<float,2>{0.363046288f, 0.158786356f},
-std::array<float,2>{0.923934162f, 0.529129863f},
-std::array<float,2>{0.0938026682f, 0.829959095f},
-std::array<float,2>{0.523701787f, 0.460362464f},
-std::array<float,2>{0.171027631f, 0.253221512f},
-std::array<float,2>{0.678088844f, 0.895601332f},
-std::array<float,2>{0.447880328f, 0.664254606f},
-std::array<float,2>{0.805116653f, 0.0141453724f},
-std::array<float,2>{0.00623954041f, 0.120625935f},
-std::array<float,2>{0.590408802f, 0.709354401f},
-std::array<float,2>{0.292022079f, 0.94700098f},
-std::array<float,2>{0.982219279f, 0.324197173f},
-std::array<float,2>{0.413984925f, 0.427340746f},
-std::array<float,2>{0.829660177f, 0.801477015f},
-std::array<float,2>{0.243613303f, 0.569514751f},
-std::array<float,2>{0.740110695f, 0.220006183f},
-std::array<float,2>{0.495899022f, 0.0569970049f},
-std::array<float,2>{0.774657965f, 0.646673858f},
-std::array<float,2>{0.151285976f, 0.907098353f},
-std::array<float,2>{0.642682135f, 0.306153893f},
-std::array<float,2>{0.0668121725f, 0.471207261f},
-std::array<float,2>{0.551573396f, 0.863636553f},
-std::array<float,2>{0.342672288f, 0.551147223f},
-std::array<float,2>{0.89879173f, 0.141829774f},
-std::array<float,2>{0.189720005f, 0.188564137f},
-std::array<float,2>{0.6980322f, 0.609332025f},
-std::array<float,2>{0.402295291f, 0.770745873f},
-std::array<float,2>{0.86178422f, 0.380116343f},
-std::array<float,2>{0.256227523f, 0.347413629f},
-std::array<float,2>{0.950627506f, 0.998528004f},
-std::array<float,2>{0.0608538538f, 0.734512985f},
-std::array<float,2>{0.605733335f, 0.0714980289f},
-std::array<float,2>{0.443791419f, 0.155126378f},
-std::array<float,2>{0.804277241f, 0.558125615f},
-std::array<float,2>{0.1583592f, 0.871318221f},
-std::array<float,2>{0.683260202f, 0.48269698f},
-std::array<float,2>{0.102900453f, 0.299094051f},
-std::array<float,2>{0.52085793f, 0.921191633f},
-std::array<float,2>{0.37329942f, 0.650562286f},
-std::array<float,2>{0.934403241f, 0.0477147028f},
-std::array<float,2>{0.235536471f, 0.0680814311f},
-std::array<float,2>{0.744669139f, 0.744491756f},
-std::array<float,2>{0.415798157f, 0.989905238f},
-std::array<float,2>{0.838204563f, 0.356607229f},
-std::array<float,2>{0.283938468f, 0.388301253f},
-std::array<float,2>{0.972834766f, 0.774800658f},
-std::array<float,2>{0.0144831901f, 0.600812733f},
-std::array<float,2>{0.581978261f, 0.200710833f},
-std::array<float,2>{0.331288666f, 0.00104329211f},
-std::array<float,2>{0.890934229f, 0.662938654f},
-std::array<float,2>{0.0780477524f, 0.902465105f},
-std::array<float,2>{0.556591392f, 0.258133262f},
-std::array<float,2>{0.143464625f, 0.46207884f},
-std::array<float,2>{0.652549267f, 0.839620769f},
-std::array<float,2>{0.485816538f, 0.52320838f},
-std::array<float,2>{0.767644107f, 0.165090263f},
-std::array<float,2>{0.0540716313f, 0.228531063f},
-std::array<float,2>{0.595103681f, 0.576619565f},
-std::array<float,2>{0.258543164f, 0.810234249f},
-std::array<float,2>{0.942552507f, 0.435595185f},
-std::array<float,2>{0.392638475f, 0.314056575f},
-std::array<float,2>{0.873824716f, 0.94156146f},
-std::array<float,2>{0.200846925f, 0.714864075f},
-std::array<float,2>{0.687888265f, 0.113857441f},
-std::array<float,2>{0.272768438f, 0.217247069f},
-std::array<float,2>{0.963679135f, 0.619764209f},
-std::array<float,2>{0.0344079062f, 0.755424261f},
-std::array<float,2>{0.617255807f, 0.397400439f},
-std::array<float,2>{0.215287969f, 0.364200354f},
-std::array<float,2>{0.714375019f, 0.981797814f},
-std::array<float,2>{0.380299777f, 0.733161271f},
-std::array<float,2>{0.848427474f, 0.0890442207f},
-std::array<float,2>{0.0813762248f, 0.0370354019f},
-std::array<float,2>{0.533045173f, 0.632308841f},
-std::array<float,2>{0.325748444f, 0.928419292f},
-std::array<float,2>{0.88907212f, 0.281634033f},
-std::array<float,2>{0.469697177f, 0.484624982f},
-std::array<float,2>{0.759838343f, 0.848253071f},
-std::array<float,2>{0.139522672f, 0.541035831f},
-std::array<float,2>{0.628194213f, 0.125221699f},
-std::array<float,2>{0.42498982f, 0.106771626f},
-std::array<float,2>{0.81469655f, 0.696104944f},
-std::array<float,2>{0.219185486f, 0.953944683f},
-std::array<float,2>{0.71973145f, 0.332000613f},
-std::array<float,2>{0.0283581037f, 0.413562536f},
-std::array<float,2>{0.562809885f, 0.794015229f},
-std::array<float,2>{0.301915407f, 0.582562327f},
-std::array<float,2>{0.996644914f, 0.248313397f},
-std::array<float,2>{0.182380557f, 0.174682841f},
-std::array<float,2>{0.667108715f, 0.501841009f},
-std::array<float,2>{0.463177174f, 0.826987684f},
-std::array<float,2>{0.795596898f, 0.440351546f},
-std::array<float,2>{0.351057619f, 0.268355489f},
-std::array<float,2>{0.917416453f, 0.885846913f},
-std::array<float,2>{0.116656594f, 0.68513447f},
-std::array<float,2>{0.507707596f, 0.0186786875f},
-std::array<float,2>{0.479999304f, 0.197385579f},
-std::array<float,2>{0.754137456f, 0.596792936f},
-std::array<float,2>{0.131888419f, 0.778479159f},
-std::array<float,2>{0.633921444f, 0.383797407f},
-std::array<float,2>{0.0916764587f, 0.355149776f},
-std::array<float,2>{0.539797723f, 0.984449208f},
-std::array<float,2>{0.316868037f, 0.746910691f},
-std::array<float,2>{0.877765357f, 0.0638661981f},
-std::array<float,2>{0.206466421f, 0.0516029671f},
-std::array<float,2>{0.710264325f, 0.65509671f},
-std::array<float,2>{0.388720632f, 0.916891515f},
-std::array<float,2>{0.85208565f, 0.302928776f},
-std::array<float,2>{0.274354786f, 0.477881014f},
-std::array<float,2>{0.95713371f, 0.869268477f},
-std::array<float,2>{0.046596773f, 0.55984056f},
-std::array<float,2>{0.612784147f, 0.149117768f},
-std::array<float,2>{0.358613729f, 0.112449668f},
-std::array<float,2>{0.910997093f, 0.713563561f},
-std::array<float,2>{0.121125899f, 0.940725625f},
-std::array<float,2>{0.51091373f, 0.316900074f},
-std::array<float,2>{0.177091539f, 0.432432055f},
-std::array<float,2>{0.660958707f, 0.807151616f},
-std::array<float,2>{0.458769411f, 0.571008742f},
-std::array<float,2>{0.782806695f, 0.233227193f},
-std::array<float,2>{0.0164882168f, 0.169422954f},
-std::array<float,2>{0.575948954f, 0.516106665f},
-std::array<float,2>{0.305784166f, 0.840239882f},
-std::array<float,2>{0.984703958f, 0.465783715f},
-std::array<float,2>{0.432380468f, 0.262623906f},
-std::array<float,2>{0.822517574f, 0.900054693f},
-std::array<float,2>{0.228344932f, 0.658120334f},
-std::array<float,2>{0.730788589f, 0.00774889905f},
-std::array<float,2>{0.293281108f, 0.132412761f},
-std::array<float,2>{0.979351938f, 0.543401241f},
-std::array<float,2>{0.00189970119f, 0.844651043f},
-std::array<float,2>{0.587261617f, 0.491828263f},
-std::array<float,2>{0.249615163f, 0.287949592f},
-std::array<float,2>{0.735682726f, 0.925507188f},
-std::array<float,2>{0.407060206f, 0.626444161f},
-std::array<float,2>{0.833129346f, 0.0315479413f},
-std::array<float,2>{0.100446858f, 0.0924587026f},
-std::array<float,2>{0.530579925f, 0.728875875f},
-std::array<float,2>{0.364198774f, 0.980069637f},
-std::array<float,2>{0.92949599f, 0.363267213f},
-std::array<float,2>{0.452822387f, 0.394055545f},
-std::array<float,2>{0.812261701f, 0.750713944f},
-std::array<float,2>{0.164584637f, 0.622562587f},
-std::array<float,2>{0.675046682f, 0.21443361f},
-std::array<float,2>{0.402937442f, 0.0203688461f},
-std::array<float,2>{0.863643169f, 0.680074275f},
-std::array<float,2>{0.19259721f, 0.889561534f},
-std::array<float,2>{0.700466454f, 0.273036063f},
-std::array<float,2>{0.0563844256f, 0.445201993f},
-std::array<float,2>{0.602793396f, 0.820414603f},
-std::array<float,2>{0.251861393f, 0.507649779f},
-std::array<float,2>{0.948295951f, 0.176214129f},
-std::array<float,2>{0.153062344f, 0.242565379f},
-std::array<float,2>{0.647214234f, 0.578336656f},
-std::array<float,2>{0.496479154f, 0.79104948f},
-std::array<float,2>{0.780011058f, 0.406862497f},
-std::array<float,2>{0.339473188f, 0.333188802f},
-std::array<float,2>{0.902520239f, 0.958511531f},
-std::array<float,2>{0.0638734698f, 0.701548338f},
-std::array<float,2>{0.548015237f, 0.105027124f},
-std::array<float,2>{0.419883817f, 0.186871529f},
-std::array<float,2>{0.840092838f, 0.513409436f},
-std::array<float,2>{0.238608882f, 0.812877774f},
-std::array<float,2>{0.747861922f, 0.450393081f},
-std::array<float,2>{0.00795042515f, 0.276823044f},
-std::array<float,2>{0.582509696f, 0.880886853f},
-std::array<float,2>{0.285912007f, 0.672242761f},
-std::array<float,2>{0.970038891f, 0.0268562231f},
-std::array<float,2>{0.163505614f, 0.0964505225f},
-std::array<float,2>{0.684624672f, 0.693425536f},
-std::array<float,2>{0.441041201f, 0.964457214f},
-std::array<float,2>{0.798264384f, 0.342410088f},
-std::array<float,2>{0.369386554f, 0.419678271f},
-std::array<float,2>{0.931687236f, 0.786222458f},
-std::array<float,2>{0.105921812f, 0.592298865f},
-std::array<float,2>{0.51673913f, 0.237026721f},
-std::array<float,2>{0.264531344f, 0.0450796448f},
-std::array<float,2>{0.939043581f, 0.637785196f},
-std::array<float,2>{0.0497486107f, 0.930357516f},
-std::array<float,2>{0.600026786f, 0.29615131f},
-std::array<float,2>{0.198246762f, 0.494812816f},
-std::array<float,2>{0.69402349f, 0.853543878f},
-std::array<float,2>{0.397511631f, 0.53815794f},
-std::array<float,2>{0.868704379f, 0.13701731f},
-std::array<float,2>{0.0713778585f, 0.204197437f},
-std::array<float,2>{0.561223686f, 0.614548802f},
-std::array<float,2>{0.335597605f, 0.759976745f},
-std::array<float,2>{0.897518694f, 0.402779162f},
-std::array<float,2>{0.48992762f, 0.367735356f},
-std::array<float,2>{0.772700787f, 0.974929571f},
-std::array<float,2>{0.146973595f, 0.719708502f},
-std::array<float,2>{0.650800288f, 0.0816992521f},
-std::array<float,2>{0.321256548f, 0.223648787f},
-std::array<float,2>{0.884966195f, 0.565475106f},
-std::array<float,2>{0.0855619386f, 0.800453067f},
-std::array<float,2>{0.536192954f, 0.42412591f},
-std::array<float,2>{0.133781523f, 0.326498389f},
-std::array<float,2>{0.630419374f, 0.949998379f},
-std::array<float,2>{0.476116538f, 0.703231514f},
-std::array<float,2>{0.764807701f, 0.123850882f},
-std::array<float,2>{0.0386050195f, 0.00958866533f},
-std::array<float,2>{0.624521315f, 0.668125212f},
-std::array<float,2>{0.267040402f, 0.892326295f},
-std::array<float,2>{0.968391716f, 0.255667269f},
-std::array<float,2>{0.375816643f, 0.453196228f},
-std::array<float,2>{0.844253838f, 0.83488977f},
-std::array<float,2>{0.214428082f, 0.523579776f},
-std::array<float,2>{0.716825545f, 0.163562492f},
-std::array<float,2>{0.467723787f, 0.0754637346f},
-std::array<float,2>{0.789168954f, 0.738444209f},
-std::array<float,2>{0.183880731f, 0.992812514f},
-std::array<float,2>{0.668467462f, 0.349788725f},
-std::array<float,2>{0.110799447f, 0.37517038f},
-std::array<float,2>{0.501333952f, 0.769472957f},
-std::array<float,2>{0.345871449f, 0.602510333f},
-std::array<float,2>{0.918692529f, 0.193079844f},
-std::array<float,2>{0.22321105f, 0.145889997f},
-std::array<float,2>{0.726526201f, 0.547708631f},
-std::array<float,2>{0.427867413f, 0.86010474f},
-std::array<float,2>{0.816617131f, 0.475390822f},
-std::array<float,2>{0.297964692f, 0.311307341f},
-std::array<float,2>{0.992892563f, 0.912722409f},
-std::array<float,2>{0.0264354944f, 0.642215073f},
-std::array<float,2>{0.567246795f, 0.0598905198f}}
\ No newline at end of file
@@ -1,4096 +0,0 @@
-{std::array<float,2>{0.0427277014f, 0.825088441f},
-std::array<float,2>{0.690177858f, 0.3112728f},
-std::array<float,2>{0.36485213f, 0.192115471f},
-std::array<float,2>{0.931998909f, 0.716356277f},
-std::array<float,2>{0.483533472f, 0.509072065f},
-std::array<float,2>{0.811368108f, 0.0234906208f},
-std::array<float,2>{0.212880373f, 0.411580086f},
-std::array<float,2>{0.622267663f, 0.915472925f},
-std::array<float,2>{0.169708848f, 0.649511218f},
-std::array<float,2>{0.56226325f, 0.144014284f},
-std::array<float,2>{0.419091612f, 0.340943009f},
-std::array<float,2>{0.856045544f, 0.792089164f},
-std::array<float,2>{0.263061464f, 0.999795794f},
-std::array<float,2>{0.970798135f, 0.452047735f},
-std::array<float,2>{0.0816905946f, 0.0858731568f},
-std::array<float,2>{0.662564158f, 0.572395146f},
-std::array<float,2>{0.235198319f, 0.898820937f},
-std::array<float,2>{0.568774879f, 0.393642485f},
-std::array<float,2>{0.443896592f, 0.0601742752f},
-std::array<float,2>{0.77600044f, 0.538253725f},
-std::array<float,2>{0.334493876f, 0.72986728f},
-std::array<float,2>{0.885030985f, 0.238330334f},
-std::array<float,2>{0.0153747471f, 0.262216449f},
-std::array<float,2>{0.749814749f, 0.85994333f},
-std::array<float,2>{0.115952924f, 0.59581548f},
-std::array<float,2>{0.654144228f, 0.121843532f},
-std::array<float,2>{0.293742269f, 0.470579714f},
-std::array<float,2>{0.953431487f, 0.945021927f},
-std::array<float,2>{0.382646114f, 0.771873772f},
-std::array<float,2>{0.826315045f, 0.367823362f},
-std::array<float,2>{0.136034921f, 0.161364496f},
-std::array<float,2>{0.521165609f, 0.670717716f},
-std::array<float,2>{0.155262604f, 0.804130912f},
-std::array<float,2>{0.507730484f, 0.325674534f},
-std::array<float,2>{0.394739389f, 0.140385136f},
-std::array<float,2>{0.842266679f, 0.630626202f},
-std::array<float,2>{0.301683933f, 0.588683248f},
-std::array<float,2>{0.953029692f, 0.0654210001f},
-std::array<float,2>{0.10638316f, 0.460596114f},
-std::array<float,2>{0.631396055f, 0.971303284f},
-std::array<float,2>{0.015779132f, 0.688587844f},
-std::array<float,2>{0.725484848f, 0.208121136f},
-std::array<float,2>{0.32515204f, 0.292174995f},
-std::array<float,2>{0.905496359f, 0.842254519f},
-std::array<float,2>{0.462762773f, 0.925653458f},
-std::array<float,2>{0.760588706f, 0.424692422f},
-std::array<float,2>{0.225821212f, 0.00726705976f},
-std::array<float,2>{0.589997172f, 0.526581407f},
-std::array<float,2>{0.0645155609f, 0.964808106f},
-std::array<float,2>{0.686083317f, 0.485684901f},
-std::array<float,2>{0.275578201f, 0.0949616656f},
-std::array<float,2>{0.992062807f, 0.610379338f},
-std::array<float,2>{0.425920546f, 0.684975863f},
-std::array<float,2>{0.864601851f, 0.179750189f},
-std::array<float,2>{0.175578579f, 0.350913316f},
-std::array<float,2>{0.54490304f, 0.752790332f},
-std::array<float,2>{0.20133096f, 0.55172348f},
-std::array<float,2>{0.595942557f, 0.0454196669f},
-std::array<float,2>{0.48938787f, 0.387821496f},
-std::array<float,2>{0.784733057f, 0.889203429f},
-std::array<float,2>{0.34423402f, 0.856673956f},
-std::array<float,2>{0.91659534f, 0.279945612f},
-std::array<float,2>{0.0594539717f, 0.227629438f},
-std::array<float,2>{0.713581443f, 0.740839839f},
-std::array<float,2>{0.0939445049f, 0.764658332f},
-std::array<float,2>{0.635397255f, 0.357163727f},
-std::array<float,2>{0.309297502f, 0.172779754f},
-std::array<float,2>{0.939376414f, 0.672392786f},
-std::array<float,2>{0.404747874f, 0.617941737f},
-std::array<float,2>{0.828383982f, 0.108630553f},
-std::array<float,2>{0.141288504f, 0.494615942f},
-std::array<float,2>{0.515363574f, 0.96021086f},
-std::array<float,2>{0.233462453f, 0.749394f},
-std::array<float,2>{0.580526412f, 0.223933682f},
-std::array<float,2>{0.458266318f, 0.268063813f},
-std::array<float,2>{0.757566452f, 0.84431541f},
-std::array<float,2>{0.318689376f, 0.882250488f},
-std::array<float,2>{0.897071719f, 0.378656745f},
-std::array<float,2>{0.0289545935f, 0.0367488749f},
-std::array<float,2>{0.726651847f, 0.558936417f},
-std::array<float,2>{0.186190367f, 0.982859612f},
-std::array<float,2>{0.538786173f, 0.468046665f},
-std::array<float,2>{0.433264643f, 0.072800532f},
-std::array<float,2>{0.872562408f, 0.58017534f},
-std::array<float,2>{0.27167818f, 0.636440635f},
-std::array<float,2>{0.999943078f, 0.125877872f},
-std::array<float,2>{0.0761833116f, 0.316671759f},
-std::array<float,2>{0.674874485f, 0.807985187f},
-std::array<float,2>{0.0510091595f, 0.515708387f},
-std::array<float,2>{0.709357858f, 0.00935947336f},
-std::array<float,2>{0.354380518f, 0.433843315f},
-std::array<float,2>{0.912397981f, 0.931262076f},
-std::array<float,2>{0.498160869f, 0.835340142f},
-std::array<float,2>{0.792936265f, 0.282532811f},
-std::array<float,2>{0.194601312f, 0.211053357f},
-std::array<float,2>{0.608687222f, 0.701605976f},
-std::array<float,2>{0.206019983f, 0.868373871f},
-std::array<float,2>{0.61661166f, 0.25049898f},
-std::array<float,2>{0.471761972f, 0.24596639f},
-std::array<float,2>{0.802421331f, 0.724828422f},
-std::array<float,2>{0.374341577f, 0.54015559f},
-std::array<float,2>{0.929354489f, 0.0510061048f},
-std::array<float,2>{0.0334562175f, 0.399595559f},
-std::array<float,2>{0.698230982f, 0.897042274f},
-std::array<float,2>{0.0933844075f, 0.662296414f},
-std::array<float,2>{0.669785559f, 0.17069295f},
-std::array<float,2>{0.254570901f, 0.36544922f},
-std::array<float,2>{0.98289454f, 0.774952888f},
-std::array<float,2>{0.411312938f, 0.945997179f},
-std::array<float,2>{0.847513616f, 0.480381519f},
-std::array<float,2>{0.162625417f, 0.110551782f},
-std::array<float,2>{0.548250675f, 0.607273281f},
-std::array<float,2>{0.0073039881f, 0.909117877f},
-std::array<float,2>{0.736241221f, 0.417475551f},
-std::array<float,2>{0.338374019f, 0.0190463401f},
-std::array<float,2>{0.87939173f, 0.501055419f},
-std::array<float,2>{0.446294516f, 0.703571916f},
-std::array<float,2>{0.768436551f, 0.196537584f},
-std::array<float,2>{0.246568263f, 0.303723216f},
-std::array<float,2>{0.572312593f, 0.812567174f},
-std::array<float,2>{0.127664998f, 0.565329313f},
-std::array<float,2>{0.52395314f, 0.0897250473f},
-std::array<float,2>{0.384458721f, 0.438796908f},
-std::array<float,2>{0.817380607f, 0.985770464f},
-std::array<float,2>{0.281927735f, 0.786436439f},
-std::array<float,2>{0.961062849f, 0.328368753f},
-std::array<float,2>{0.117630139f, 0.151110157f},
-std::array<float,2>{0.646758378f, 0.645207822f},
-std::array<float,2>{0.0246318039f, 0.796461165f},
-std::array<float,2>{0.73400569f, 0.337529331f},
-std::array<float,2>{0.31437394f, 0.145629272f},
-std::array<float,2>{0.891173482f, 0.65418148f},
-std::array<float,2>{0.455050051f, 0.576093674f},
-std::array<float,2>{0.751218259f, 0.0794381574f},
-std::array<float,2>{0.226696938f, 0.447589874f},
-std::array<float,2>{0.582442284f, 0.992721021f},
-std::array<float,2>{0.14526549f, 0.712795794f},
-std::array<float,2>{0.509887099f, 0.191237643f},
-std::array<float,2>{0.400747925f, 0.304843664f},
-std::array<float,2>{0.832233727f, 0.821065128f},
-std::array<float,2>{0.30675137f, 0.920636237f},
-std::array<float,2>{0.943704724f, 0.408380002f},
-std::array<float,2>{0.100348972f, 0.028500149f},
-std::array<float,2>{0.637512982f, 0.514981627f},
-std::array<float,2>{0.188278347f, 0.93787384f},
-std::array<float,2>{0.604866266f, 0.475052088f},
-std::array<float,2>{0.492608219f, 0.119821802f},
-std::array<float,2>{0.796750307f, 0.59805119f},
-std::array<float,2>{0.355560839f, 0.666681588f},
-std::array<float,2>{0.907771766f, 0.157344043f},
-std::array<float,2>{0.048643183f, 0.373662531f},
-std::array<float,2>{0.706778228f, 0.767912149f},
-std::array<float,2>{0.0734863505f, 0.533755004f},
-std::array<float,2>{0.679653168f, 0.0585843921f},
-std::array<float,2>{0.268788368f, 0.39561072f},
-std::array<float,2>{0.992382407f, 0.903436482f},
-std::array<float,2>{0.433821827f, 0.865640819f},
-std::array<float,2>{0.87075597f, 0.258392602f},
-std::array<float,2>{0.181090876f, 0.238183498f},
-std::array<float,2>{0.532556951f, 0.733364582f},
-std::array<float,2>{0.158418223f, 0.836824477f},
-std::array<float,2>{0.553704321f, 0.2942577f},
-std::array<float,2>{0.406865686f, 0.20316793f},
-std::array<float,2>{0.848661184f, 0.692231596f},
-std::array<float,2>{0.253296345f, 0.527360678f},
-std::array<float,2>{0.977129221f, 0.003430004f},
-std::array<float,2>{0.0890979692f, 0.427519321f},
-std::array<float,2>{0.66629523f, 0.928978384f},
-std::array<float,2>{0.037968263f, 0.626410663f},
-std::array<float,2>{0.70041436f, 0.134391397f},
-std::array<float,2>{0.36814931f, 0.321947575f},
-std::array<float,2>{0.922301173f, 0.799336195f},
-std::array<float,2>{0.476462752f, 0.973124027f},
-std::array<float,2>{0.79962647f, 0.455652386f},
-std::array<float,2>{0.20767194f, 0.0664308816f},
-std::array<float,2>{0.612026811f, 0.592068195f},
-std::array<float,2>{0.121585608f, 0.886676371f},
-std::array<float,2>{0.643508732f, 0.385964811f},
-std::array<float,2>{0.285500735f, 0.0391243957f},
-std::array<float,2>{0.96519655f, 0.548953295f},
-std::array<float,2>{0.390398294f, 0.737596869f},
-std::array<float,2>{0.815108359f, 0.231953382f},
-std::array<float,2>{0.12928994f, 0.277059466f},
-std::array<float,2>{0.529311121f, 0.852046072f},
-std::array<float,2>{0.245042369f, 0.615372121f},
-std::array<float,2>{0.577990234f, 0.101330876f},
-std::array<float,2>{0.44953686f, 0.489963442f},
-std::array<float,2>{0.772943199f, 0.968706667f},
-std::array<float,2>{0.342639297f, 0.75518769f},
-std::array<float,2>{0.877972424f, 0.347079694f},
-std::array<float,2>{0.00366245676f, 0.183761686f},
-std::array<float,2>{0.738388002f, 0.681575119f},
-std::array<float,2>{0.0820411295f, 0.85131222f},
-std::array<float,2>{0.656332612f, 0.270600438f},
-std::array<float,2>{0.25951001f, 0.221127257f},
-std::array<float,2>{0.97414273f, 0.746000051f},
-std::array<float,2>{0.41471085f, 0.554955781f},
-std::array<float,2>{0.854117155f, 0.0314450897f},
-std::array<float,2>{0.165445372f, 0.382673055f},
-std::array<float,2>{0.554951489f, 0.878562987f},
-std::array<float,2>{0.215724707f, 0.677961171f},
-std::array<float,2>{0.620758891f, 0.178912506f},
-std::array<float,2>{0.478003085f, 0.352649212f},
-std::array<float,2>{0.807753205f, 0.760744631f},
-std::array<float,2>{0.361371338f, 0.955202937f},
-std::array<float,2>{0.935594678f, 0.498210281f},
-std::array<float,2>{0.0466435663f, 0.105328783f},
-std::array<float,2>{0.694330215f, 0.621440768f},
-std::array<float,2>{0.13787359f, 0.934471786f},
-std::array<float,2>{0.518320143f, 0.431316316f},
-std::array<float,2>{0.376109034f, 0.0132655371f},
-std::array<float,2>{0.82286793f, 0.521198571f},
-std::array<float,2>{0.289194196f, 0.697215319f},
-std::array<float,2>{0.957542002f, 0.216759607f},
-std::array<float,2>{0.112075418f, 0.286058992f},
-std::array<float,2>{0.649513185f, 0.829486251f},
-std::array<float,2>{0.0113579249f, 0.58253926f},
-std::array<float,2>{0.744705081f, 0.0764158666f},
-std::array<float,2>{0.331201255f, 0.46104762f},
-std::array<float,2>{0.887153685f, 0.978788316f},
-std::array<float,2>{0.43960762f, 0.81019944f},
-std::array<float,2>{0.78059268f, 0.31600982f},
-std::array<float,2>{0.241531551f, 0.132382765f},
-std::array<float,2>{0.563354671f, 0.639784932f},
-std::array<float,2>{0.218875945f, 0.780520082f},
-std::array<float,2>{0.588323891f, 0.359883726f},
-std::array<float,2>{0.466430575f, 0.165781975f},
-std::array<float,2>{0.763426006f, 0.657202601f},
-std::array<float,2>{0.321406305f, 0.602039337f},
-std::array<float,2>{0.901813567f, 0.116153963f},
-std::array<float,2>{0.0228463169f, 0.481355816f},
-std::array<float,2>{0.721990168f, 0.952421248f},
-std::array<float,2>{0.103449881f, 0.721360981f},
-std::array<float,2>{0.626129687f, 0.249980778f},
-std::array<float,2>{0.299873084f, 0.256675243f},
-std::array<float,2>{0.94547981f, 0.873324215f},
-std::array<float,2>{0.392267883f, 0.891677439f},
-std::array<float,2>{0.838877141f, 0.405274153f},
-std::array<float,2>{0.152041078f, 0.0498477779f},
-std::array<float,2>{0.501987457f, 0.543898523f},
-std::array<float,2>{0.057295382f, 0.991089463f},
-std::array<float,2>{0.717392862f, 0.44369331f},
-std::array<float,2>{0.348774016f, 0.0908831432f},
-std::array<float,2>{0.920881808f, 0.56863749f},
-std::array<float,2>{0.485875309f, 0.64282012f},
-std::array<float,2>{0.785436332f, 0.154980943f},
-std::array<float,2>{0.195954859f, 0.334096432f},
-std::array<float,2>{0.599282861f, 0.783303201f},
-std::array<float,2>{0.17701748f, 0.504767835f},
-std::array<float,2>{0.542766392f, 0.0227917228f},
-std::array<float,2>{0.4238469f, 0.420544684f},
-std::array<float,2>{0.860526562f, 0.911049247f},
-std::array<float,2>{0.279835373f, 0.816991866f},
-std::array<float,2>{0.984411001f, 0.298909873f},
-std::array<float,2>{0.0677822307f, 0.200830951f},
-std::array<float,2>{0.681070566f, 0.710592449f},
-std::array<float,2>{0.0123526948f, 0.862941027f},
-std::array<float,2>{0.747397304f, 0.263735682f},
-std::array<float,2>{0.333173931f, 0.240633667f},
-std::array<float,2>{0.882936478f, 0.727779925f},
-std::array<float,2>{0.44152084f, 0.537102759f},
-std::array<float,2>{0.774868309f, 0.060779769f},
-std::array<float,2>{0.23777765f, 0.391695857f},
-std::array<float,2>{0.566513419f, 0.900867879f},
-std::array<float,2>{0.13444832f, 0.669230878f},
-std::array<float,2>{0.522468746f, 0.162358597f},
-std::array<float,2>{0.379325539f, 0.369636744f},
-std::array<float,2>{0.824850976f, 0.769988239f},
-std::array<float,2>{0.295191854f, 0.94236356f},
-std::array<float,2>{0.956617653f, 0.472584367f},
-std::array<float,2>{0.114640191f, 0.123284839f},
-std::array<float,2>{0.655758798f, 0.594991982f},
-std::array<float,2>{0.213453025f, 0.916041315f},
-std::array<float,2>{0.624995887f, 0.41326499f},
-std::array<float,2>{0.482314199f, 0.0261799172f},
-std::array<float,2>{0.809667051f, 0.511568129f},
-std::array<float,2>{0.365403563f, 0.71749866f},
-std::array<float,2>{0.930679739f, 0.193370253f},
-std::array<float,2>{0.0402650796f, 0.310452402f},
-std::array<float,2>{0.687700927f, 0.82715112f},
-std::array<float,2>{0.0799971968f, 0.571515739f},
-std::array<float,2>{0.661723495f, 0.082941629f},
-std::array<float,2>{0.265139967f, 0.450154394f},
-std::array<float,2>{0.969474375f, 0.996607482f},
-std::array<float,2>{0.421357006f, 0.790610492f},
-std::array<float,2>{0.85824579f, 0.34274447f},
-std::array<float,2>{0.170421958f, 0.140672386f},
-std::array<float,2>{0.559592128f, 0.650953293f},
-std::array<float,2>{0.172056541f, 0.751464605f},
-std::array<float,2>{0.54585284f, 0.348420411f},
-std::array<float,2>{0.4286066f, 0.182937518f},
-std::array<float,2>{0.867101908f, 0.687348604f},
-std::array<float,2>{0.273965865f, 0.612218857f},
-std::array<float,2>{0.988325477f, 0.096924901f},
-std::array<float,2>{0.062951833f, 0.486620903f},
-std::array<float,2>{0.685197115f, 0.962572992f},
-std::array<float,2>{0.0608474016f, 0.738989353f},
-std::array<float,2>{0.711844146f, 0.228710145f},
-std::array<float,2>{0.345750362f, 0.27875343f},
-std::array<float,2>{0.914881766f, 0.858619094f},
-std::array<float,2>{0.491541475f, 0.887838542f},
-std::array<float,2>{0.782428741f, 0.389892012f},
-std::array<float,2>{0.199681506f, 0.0432723016f},
-std::array<float,2>{0.595000148f, 0.554655313f},
-std::array<float,2>{0.108582087f, 0.970573306f},
-std::array<float,2>{0.630787015f, 0.457541168f},
-std::array<float,2>{0.304282814f, 0.0640159175f},
-std::array<float,2>{0.950152755f, 0.5865224f},
-std::array<float,2>{0.398412406f, 0.631305397f},
-std::array<float,2>{0.841209292f, 0.136906147f},
-std::array<float,2>{0.15283826f, 0.327693969f},
-std::array<float,2>{0.504027307f, 0.801878929f},
-std::array<float,2>{0.224234089f, 0.525251091f},
-std::array<float,2>{0.592974544f, 0.0056366669f},
-std::array<float,2>{0.463652968f, 0.423483133f},
-std::array<float,2>{0.759023905f, 0.922872841f},
-std::array<float,2>{0.326250106f, 0.841365516f},
-std::array<float,2>{0.902509868f, 0.290804684f},
-std::array<float,2>{0.0194311682f, 0.210689127f},
-std::array<float,2>{0.724524975f, 0.689999282f},
-std::array<float,2>{0.0752743036f, 0.806194961f},
-std::array<float,2>{0.672905862f, 0.319962204f},
-std::array<float,2>{0.269608706f, 0.128161147f},
-std::array<float,2>{0.997131288f, 0.633828461f},
-std::array<float,2>{0.431161165f, 0.579096496f},
-std::array<float,2>{0.873655796f, 0.0708638504f},
-std::array<float,2>{0.184100285f, 0.465883672f},
-std::array<float,2>{0.537089407f, 0.980549574f},
-std::array<float,2>{0.191873223f, 0.699708879f},
-std::array<float,2>{0.607337832f, 0.214178711f},
-std::array<float,2>{0.49796465f, 0.283837676f},
-std::array<float,2>{0.790961862f, 0.832066059f},
-std::array<float,2>{0.353214383f, 0.932581842f},
-std::array<float,2>{0.910636067f, 0.436217666f},
-std::array<float,2>{0.0535695031f, 0.0105083594f},
-std::array<float,2>{0.707426369f, 0.518330216f},
-std::array<float,2>{0.14388071f, 0.957396388f},
-std::array<float,2>{0.512415588f, 0.493150771f},
-std::array<float,2>{0.403583646f, 0.106118128f},
-std::array<float,2>{0.830599248f, 0.620075703f},
-std::array<float,2>{0.312412918f, 0.674058795f},
-std::array<float,2>{0.940410495f, 0.174346104f},
-std::array<float,2>{0.0966145471f, 0.358936191f},
-std::array<float,2>{0.633796096f, 0.762810707f},
-std::array<float,2>{0.0304128807f, 0.560727596f},
-std::array<float,2>{0.729871094f, 0.0381293371f},
-std::array<float,2>{0.316414893f, 0.3755638f},
-std::array<float,2>{0.895202637f, 0.880411386f},
-std::array<float,2>{0.459705472f, 0.846131623f},
-std::array<float,2>{0.754841328f, 0.267158002f},
-std::array<float,2>{0.230885863f, 0.226300776f},
-std::array<float,2>{0.579035759f, 0.747403741f},
-std::array<float,2>{0.249388054f, 0.816158235f},
-std::array<float,2>{0.571438909f, 0.301979691f},
-std::array<float,2>{0.447535902f, 0.199161127f},
-std::array<float,2>{0.767090023f, 0.705106437f},
-std::array<float,2>{0.336778015f, 0.502133071f},
-std::array<float,2>{0.88161546f, 0.0164830852f},
-std::array<float,2>{0.00512547279f, 0.414770633f},
-std::array<float,2>{0.737255514f, 0.906847954f},
-std::array<float,2>{0.120503105f, 0.646619618f},
-std::array<float,2>{0.646107674f, 0.148868561f},
-std::array<float,2>{0.284387797f, 0.330637783f},
-std::array<float,2>{0.964272797f, 0.788981855f},
-std::array<float,2>{0.385354519f, 0.987492025f},
-std::array<float,2>{0.819555759f, 0.440853179f},
-std::array<float,2>{0.126754314f, 0.0860524625f},
-std::array<float,2>{0.527321756f, 0.562683582f},
-std::array<float,2>{0.0313307643f, 0.896219969f},
-std::array<float,2>{0.696216881f, 0.401186585f},
-std::array<float,2>{0.373026937f, 0.0536627397f},
-std::array<float,2>{0.926124454f, 0.541294396f},
-std::array<float,2>{0.469704777f, 0.724191248f},
-std::array<float,2>{0.804361582f, 0.243600979f},
-std::array<float,2>{0.204680681f, 0.252476454f},
-std::array<float,2>{0.613941312f, 0.869869351f},
-std::array<float,2>{0.161068887f, 0.609018624f},
-std::array<float,2>{0.549642265f, 0.112989239f},
-std::array<float,2>{0.41388759f, 0.478260607f},
-std::array<float,2>{0.844479859f, 0.948180914f},
-std::array<float,2>{0.256893933f, 0.776892364f},
-std::array<float,2>{0.981109679f, 0.365002543f},
-std::array<float,2>{0.0900123641f, 0.169347584f},
-std::array<float,2>{0.670208931f, 0.66160363f},
-std::array<float,2>{0.0502312705f, 0.766919792f},
-std::array<float,2>{0.704075634f, 0.371098608f},
-std::array<float,2>{0.357436448f, 0.159431159f},
-std::array<float,2>{0.909276903f, 0.665282726f},
-std::array<float,2>{0.495720416f, 0.6004439f},
-std::array<float,2>{0.793757796f, 0.117731169f},
-std::array<float,2>{0.189576194f, 0.472761422f},
-std::array<float,2>{0.60278511f, 0.940669775f},
-std::array<float,2>{0.183264151f, 0.731142759f},
-std::array<float,2>{0.533472478f, 0.234723538f},
-std::array<float,2>{0.435954154f, 0.261256635f},
-std::array<float,2>{0.86866039f, 0.864973783f},
-std::array<float,2>{0.267539173f, 0.906168282f},
-std::array<float,2>{0.9953475f, 0.396626562f},
-std::array<float,2>{0.0709452331f, 0.0559546128f},
-std::array<float,2>{0.676073372f, 0.533022463f},
-std::array<float,2>{0.230365172f, 0.995301187f},
-std::array<float,2>{0.585320115f, 0.447148204f},
-std::array<float,2>{0.455262572f, 0.0801319554f},
-std::array<float,2>{0.753491759f, 0.577978134f},
-std::array<float,2>{0.315583378f, 0.655695617f},
-std::array<float,2>{0.893304288f, 0.148217827f},
-std::array<float,2>{0.0259870812f, 0.339191705f},
-std::array<float,2>{0.73127526f, 0.79467839f},
-std::array<float,2>{0.0988320857f, 0.513525724f},
-std::array<float,2>{0.640560925f, 0.0302450042f},
-std::array<float,2>{0.305567563f, 0.407753825f},
-std::array<float,2>{0.941808164f, 0.919392049f},
-std::array<float,2>{0.399452627f, 0.822785378f},
-std::array<float,2>{0.835301936f, 0.307076156f},
-std::array<float,2>{0.148309216f, 0.187683925f},
-std::array<float,2>{0.508267403f, 0.714784265f},
-std::array<float,2>{0.132024765f, 0.853910267f},
-std::array<float,2>{0.528275907f, 0.274873972f},
-std::array<float,2>{0.387987912f, 0.233938739f},
-std::array<float,2>{0.813265681f, 0.735422373f},
-std::array<float,2>{0.287250072f, 0.548063934f},
-std::array<float,2>{0.967989028f, 0.0411986485f},
-std::array<float,2>{0.12419039f, 0.384762675f},
-std::array<float,2>{0.641250253f, 0.882867396f},
-std::array<float,2>{0.000158853727f, 0.682953537f},
-std::array<float,2>{0.741009414f, 0.186947092f},
-std::array<float,2>{0.34112373f, 0.344818741f},
-std::array<float,2>{0.876842499f, 0.756131649f},
-std::array<float,2>{0.451337516f, 0.966522634f},
-std::array<float,2>{0.770588577f, 0.492116153f},
-std::array<float,2>{0.243150532f, 0.0976606756f},
-std::array<float,2>{0.574959636f, 0.613292873f},
-std::array<float,2>{0.0864362344f, 0.927028179f},
-std::array<float,2>{0.665938139f, 0.428804785f},
-std::array<float,2>{0.251582146f, 0.000377762422f},
-std::array<float,2>{0.978737414f, 0.530834794f},
-std::array<float,2>{0.408965319f, 0.695289433f},
-std::array<float,2>{0.851510465f, 0.206441492f},
-std::array<float,2>{0.157813489f, 0.295747578f},
-std::array<float,2>{0.552557409f, 0.838203549f},
-std::array<float,2>{0.209786549f, 0.590996921f},
-std::array<float,2>{0.609679937f, 0.0697625577f},
-std::array<float,2>{0.472942859f, 0.454637259f},
-std::array<float,2>{0.798573732f, 0.976234555f},
-std::array<float,2>{0.370040417f, 0.798118651f},
-std::array<float,2>{0.924931347f, 0.322317481f},
-std::array<float,2>{0.0360949598f, 0.13622795f},
-std::array<float,2>{0.701847434f, 0.62731415f},
-std::array<float,2>{0.110891968f, 0.830230296f},
-std::array<float,2>{0.650722742f, 0.288976133f},
-std::array<float,2>{0.291988164f, 0.218083888f},
-std::array<float,2>{0.959535956f, 0.698074579f},
-std::array<float,2>{0.377053767f, 0.522494137f},
-std::array<float,2>{0.82118392f, 0.0154601028f},
-std::array<float,2>{0.1398191f, 0.432263643f},
-std::array<float,2>{0.515681624f, 0.936690807f},
-std::array<float,2>{0.239721417f, 0.63747865f},
-std::array<float,2>{0.564965785f, 0.12939851f},
-std::array<float,2>{0.438258201f, 0.3129749f},
-std::array<float,2>{0.777859211f, 0.811010361f},
-std::array<float,2>{0.329187304f, 0.977345586f},
-std::array<float,2>{0.8903023f, 0.463411063f},
-std::array<float,2>{0.00853746291f, 0.0743459314f},
-std::array<float,2>{0.743730187f, 0.585879803f},
-std::array<float,2>{0.167426825f, 0.875697851f},
-std::array<float,2>{0.557933748f, 0.38017568f},
-std::array<float,2>{0.416934073f, 0.034269724f},
-std::array<float,2>{0.853416264f, 0.558114529f},
-std::array<float,2>{0.260831594f, 0.742226243f},
-std::array<float,2>{0.975957036f, 0.219725206f},
-std::array<float,2>{0.0853614658f, 0.272807866f},
-std::array<float,2>{0.659043431f, 0.849384367f},
-std::array<float,2>{0.0433439836f, 0.624841154f},
-std::array<float,2>{0.692609966f, 0.102390483f},
-std::array<float,2>{0.360386878f, 0.497581959f},
-std::array<float,2>{0.935530007f, 0.954515517f},
-std::array<float,2>{0.48016572f, 0.758370757f},
-std::array<float,2>{0.806304336f, 0.355146915f},
-std::array<float,2>{0.217952594f, 0.176778004f},
-std::array<float,2>{0.618009329f, 0.677595139f},
-std::array<float,2>{0.197469652f, 0.781863689f},
-std::array<float,2>{0.601438344f, 0.3338328f},
-std::array<float,2>{0.486936212f, 0.153936028f},
-std::array<float,2>{0.787647784f, 0.640753031f},
-std::array<float,2>{0.350585908f, 0.566690028f},
-std::array<float,2>{0.918592215f, 0.0935479626f},
-std::array<float,2>{0.0548102967f, 0.442872912f},
-std::array<float,2>{0.715756178f, 0.988673985f},
-std::array<float,2>{0.0701734796f, 0.70850271f},
-std::array<float,2>{0.682136714f, 0.202191398f},
-std::array<float,2>{0.27926296f, 0.298095852f},
-std::array<float,2>{0.98814106f, 0.818583131f},
-std::array<float,2>{0.421900183f, 0.913646162f},
-std::array<float,2>{0.862178504f, 0.419686347f},
-std::array<float,2>{0.179081038f, 0.0209413245f},
-std::array<float,2>{0.540340364f, 0.505872488f},
-std::array<float,2>{0.0209971704f, 0.95082891f},
-std::array<float,2>{0.720475733f, 0.482756793f},
-std::array<float,2>{0.32361716f, 0.114855975f},
-std::array<float,2>{0.900061786f, 0.605343103f},
-std::array<float,2>{0.467639834f, 0.659763575f},
-std::array<float,2>{0.763682008f, 0.166936576f},
-std::array<float,2>{0.22143124f, 0.363154799f},
-std::array<float,2>{0.586554825f, 0.777945697f},
-std::array<float,2>{0.150024712f, 0.545281708f},
-std::array<float,2>{0.500048757f, 0.0474766977f},
-std::array<float,2>{0.394121647f, 0.403778374f},
-std::array<float,2>{0.837273896f, 0.894152164f},
-std::array<float,2>{0.297791362f, 0.872161388f},
-std::array<float,2>{0.947712719f, 0.25560987f},
-std::array<float,2>{0.10392186f, 0.247566074f},
-std::array<float,2>{0.628005624f, 0.719483316f},
-std::array<float,2>{0.0178333297f, 0.843147576f},
-std::array<float,2>{0.72357738f, 0.291665792f},
-std::array<float,2>{0.32739377f, 0.207486317f},
-std::array<float,2>{0.903657138f, 0.688383281f},
-std::array<float,2>{0.464282483f, 0.525703728f},
-std::array<float,2>{0.758074105f, 0.00587313948f},
-std::array<float,2>{0.223537251f, 0.42496568f},
-std::array<float,2>{0.59225744f, 0.924379468f},
-std::array<float,2>{0.153373048f, 0.629669011f},
-std::array<float,2>{0.505593479f, 0.139561042f},
-std::array<float,2>{0.397204459f, 0.324900836f},
-std::array<float,2>{0.840065897f, 0.802920997f},
-std::array<float,2>{0.302743196f, 0.972213209f},
-std::array<float,2>{0.950466573f, 0.459252357f},
-std::array<float,2>{0.107779421f, 0.0660945475f},
-std::array<float,2>{0.629818916f, 0.588904977f},
-std::array<float,2>{0.2008055f, 0.889966488f},
-std::array<float,2>{0.594416916f, 0.386787236f},
-std::array<float,2>{0.490980327f, 0.045971144f},
-std::array<float,2>{0.782158017f, 0.552184522f},
-std::array<float,2>{0.346817255f, 0.741426289f},
-std::array<float,2>{0.915214956f, 0.22676684f},
-std::array<float,2>{0.0618991032f, 0.280991405f},
-std::array<float,2>{0.712018132f, 0.856301785f},
-std::array<float,2>{0.0642879903f, 0.61032486f},
-std::array<float,2>{0.683854759f, 0.0941840187f},
-std::array<float,2>{0.275319457f, 0.485271275f},
-std::array<float,2>{0.989519656f, 0.963540614f},
-std::array<float,2>{0.429104269f, 0.753238261f},
-std::array<float,2>{0.866141379f, 0.34986648f},
-std::array<float,2>{0.172949553f, 0.181443959f},
-std::array<float,2>{0.546630919f, 0.683734894f},
-std::array<float,2>{0.171354964f, 0.791269779f},
-std::array<float,2>{0.559152067f, 0.340169907f},
-std::array<float,2>{0.42033729f, 0.143381998f},
-std::array<float,2>{0.85891813f, 0.648807049f},
-std::array<float,2>{0.26431033f, 0.573393881f},
-std::array<float,2>{0.97039175f, 0.0843360201f},
-std::array<float,2>{0.0782380626f, 0.452712983f},
-std::array<float,2>{0.660449862f, 0.998231173f},
-std::array<float,2>{0.0390642658f, 0.715222061f},
-std::array<float,2>{0.688889146f, 0.192883283f},
-std::array<float,2>{0.366679698f, 0.311795563f},
-std::array<float,2>{0.929931104f, 0.826081455f},
-std::array<float,2>{0.481256783f, 0.914157271f},
-std::array<float,2>{0.809037685f, 0.410291314f},
-std::array<float,2>{0.213947445f, 0.0248090159f},
-std::array<float,2>{0.623689413f, 0.507959366f},
-std::array<float,2>{0.113410644f, 0.943649232f},
-std::array<float,2>{0.654528856f, 0.469643295f},
-std::array<float,2>{0.296358436f, 0.122449808f},
-std::array<float,2>{0.955559492f, 0.597618341f},
-std::array<float,2>{0.380434543f, 0.670919418f},
-std::array<float,2>{0.825605392f, 0.160161987f},
-std::array<float,2>{0.133251309f, 0.36875698f},
-std::array<float,2>{0.521850824f, 0.772695541f},
-std::array<float,2>{0.236794427f, 0.538059652f},
-std::array<float,2>{0.568031728f, 0.0591603965f},
-std::array<float,2>{0.442862719f, 0.392861247f},
-std::array<float,2>{0.774391174f, 0.900074065f},
-std::array<float,2>{0.332757384f, 0.860676289f},
-std::array<float,2>{0.884062707f, 0.2629852f},
-std::array<float,2>{0.0128938602f, 0.23969768f},
-std::array<float,2>{0.747056186f, 0.729324102f},
-std::array<float,2>{0.0914731473f, 0.773709416f},
-std::array<float,2>{0.671668231f, 0.367110878f},
-std::array<float,2>{0.256139457f, 0.171424165f},
-std::array<float,2>{0.981920898f, 0.663235426f},
-std::array<float,2>{0.412796438f, 0.606222153f},
-std::array<float,2>{0.845437825f, 0.109529078f},
-std::array<float,2>{0.161143616f, 0.478908807f},
-std::array<float,2>{0.550258279f, 0.9463799f},
-std::array<float,2>{0.20366095f, 0.726259351f},
-std::array<float,2>{0.614373028f, 0.244973153f},
-std::array<float,2>{0.470422387f, 0.251827478f},
-std::array<float,2>{0.803490102f, 0.867441177f},
-std::array<float,2>{0.37177375f, 0.898144066f},
-std::array<float,2>{0.926932156f, 0.398559839f},
-std::array<float,2>{0.0329734534f, 0.0517966151f},
-std::array<float,2>{0.696753025f, 0.539552927f},
-std::array<float,2>{0.125081092f, 0.984918475f},
-std::array<float,2>{0.525549412f, 0.43805325f},
-std::array<float,2>{0.386055231f, 0.0886307135f},
-std::array<float,2>{0.818600774f, 0.566223979f},
-std::array<float,2>{0.283553451f, 0.646477878f},
-std::array<float,2>{0.963315248f, 0.151391223f},
-std::array<float,2>{0.119248845f, 0.329510897f},
-std::array<float,2>{0.645401716f, 0.785553932f},
-std::array<float,2>{0.0039974153f, 0.500645339f},
-std::array<float,2>{0.737677753f, 0.0180725958f},
-std::array<float,2>{0.337361455f, 0.416520149f},
-std::array<float,2>{0.882068276f, 0.909737468f},
-std::array<float,2>{0.448506445f, 0.813913882f},
-std::array<float,2>{0.766063035f, 0.303041786f},
-std::array<float,2>{0.24891381f, 0.196017802f},
-std::array<float,2>{0.570722103f, 0.704891205f},
-std::array<float,2>{0.23155354f, 0.845369458f},
-std::array<float,2>{0.579397559f, 0.269485861f},
-std::array<float,2>{0.460128367f, 0.223152861f},
-std::array<float,2>{0.755700231f, 0.748626828f},
-std::array<float,2>{0.31791842f, 0.560403526f},
-std::array<float,2>{0.896409452f, 0.0360846147f},
-std::array<float,2>{0.0301452186f, 0.377193958f},
-std::array<float,2>{0.728719532f, 0.881401658f},
-std::array<float,2>{0.0968345627f, 0.673453987f},
-std::array<float,2>{0.633268058f, 0.173565879f},
-std::array<float,2>{0.310723275f, 0.355936795f},
-std::array<float,2>{0.941080034f, 0.763773143f},
-std::array<float,2>{0.403048098f, 0.959620535f},
-std::array<float,2>{0.831623077f, 0.495833308f},
-std::array<float,2>{0.142685905f, 0.108180888f},
-std::array<float,2>{0.513375759f, 0.618675828f},
-std::array<float,2>{0.0545189716f, 0.929959655f},
-std::array<float,2>{0.708198309f, 0.43541187f},
-std::array<float,2>{0.35242334f, 0.00826738123f},
-std::array<float,2>{0.911616802f, 0.517446339f},
-std::array<float,2>{0.496398538f, 0.702190399f},
-std::array<float,2>{0.789865077f, 0.211922869f},
-std::array<float,2>{0.192424804f, 0.282123446f},
-std::array<float,2>{0.605502844f, 0.834675908f},
-std::array<float,2>{0.184771627f, 0.581071258f},
-std::array<float,2>{0.535232544f, 0.0733662695f},
-std::array<float,2>{0.429719269f, 0.467529833f},
-std::array<float,2>{0.874688148f, 0.984362304f},
-std::array<float,2>{0.270991564f, 0.806945205f},
-std::array<float,2>{0.996370971f, 0.318250358f},
-std::array<float,2>{0.0745402798f, 0.126288727f},
-std::array<float,2>{0.672251523f, 0.635663033f},
-std::array<float,2>{0.0366404168f, 0.800641894f},
-std::array<float,2>{0.703063488f, 0.320753276f},
-std::array<float,2>{0.370965779f, 0.133780807f},
-std::array<float,2>{0.924660325f, 0.625309408f},
-std::array<float,2>{0.473998576f, 0.593163967f},
-std::array<float,2>{0.797474563f, 0.0680788979f},
-std::array<float,2>{0.210773945f, 0.456947953f},
-std::array<float,2>{0.610618234f, 0.974472225f},
-std::array<float,2>{0.156796753f, 0.692614913f},
-std::array<float,2>{0.551543713f, 0.204919577f},
-std::array<float,2>{0.409808457f, 0.293342888f},
-std::array<float,2>{0.850279748f, 0.837784946f},
-std::array<float,2>{0.250240505f, 0.928129435f},
-std::array<float,2>{0.980414867f, 0.426540196f},
-std::array<float,2>{0.0873841718f, 0.00252402318f},
-std::array<float,2>{0.664375901f, 0.528581977f},
-std::array<float,2>{0.24345006f, 0.967107713f},
-std::array<float,2>{0.575309515f, 0.488898695f},
-std::array<float,2>{0.452509046f, 0.0999320596f},
-std::array<float,2>{0.770211101f, 0.61692369f},
-std::array<float,2>{0.339961886f, 0.680000365f},
-std::array<float,2>{0.875669122f, 0.185483515f},
-std::array<float,2>{0.00143410987f, 0.346294999f},
-std::array<float,2>{0.741320252f, 0.754775822f},
-std::array<float,2>{0.123540372f, 0.549981773f},
-std::array<float,2>{0.64223963f, 0.040726006f},
-std::array<float,2>{0.288808107f, 0.385301471f},
-std::array<float,2>{0.967532873f, 0.88506788f},
-std::array<float,2>{0.387498826f, 0.853095591f},
-std::array<float,2>{0.813656271f, 0.275430828f},
-std::array<float,2>{0.131623968f, 0.23075439f},
-std::array<float,2>{0.528795302f, 0.737166941f},
-std::array<float,2>{0.146905214f, 0.822069407f},
-std::array<float,2>{0.509093881f, 0.305910021f},
-std::array<float,2>{0.398872137f, 0.190074369f},
-std::array<float,2>{0.834404469f, 0.711192071f},
-std::array<float,2>{0.306462467f, 0.513979912f},
-std::array<float,2>{0.942920506f, 0.0277699158f},
-std::array<float,2>{0.0980089977f, 0.409834951f},
-std::array<float,2>{0.639105737f, 0.921265602f},
-std::array<float,2>{0.0273234677f, 0.652930856f},
-std::array<float,2>{0.732008517f, 0.145318538f},
-std::array<float,2>{0.314879864f, 0.336574882f},
-std::array<float,2>{0.894488096f, 0.794972599f},
-std::array<float,2>{0.456857324f, 0.993392944f},
-std::array<float,2>{0.75287354f, 0.448673695f},
-std::array<float,2>{0.228974625f, 0.0781684443f},
-std::array<float,2>{0.584339559f, 0.575049102f},
-std::array<float,2>{0.0714172497f, 0.902408004f},
-std::array<float,2>{0.677132666f, 0.395065993f},
-std::array<float,2>{0.266213417f, 0.0569752157f},
-std::array<float,2>{0.994711518f, 0.534979403f},
-std::array<float,2>{0.436848521f, 0.733986199f},
-std::array<float,2>{0.86739862f, 0.236572072f},
-std::array<float,2>{0.182202443f, 0.259529024f},
-std::array<float,2>{0.535024643f, 0.867150187f},
-std::array<float,2>{0.190634117f, 0.599429846f},
-std::array<float,2>{0.601834953f, 0.120750658f},
-std::array<float,2>{0.494650543f, 0.476441503f},
-std::array<float,2>{0.79459101f, 0.93901664f},
-std::array<float,2>{0.358601809f, 0.768661737f},
-std::array<float,2>{0.908750176f, 0.374841571f},
-std::array<float,2>{0.0488815233f, 0.156974569f},
-std::array<float,2>{0.704153657f, 0.667409837f},
-std::array<float,2>{0.104739755f, 0.874604225f},
-std::array<float,2>{0.627442658f, 0.257293314f},
-std::array<float,2>{0.298683852f, 0.248705521f},
-std::array<float,2>{0.948689938f, 0.721949399f},
-std::array<float,2>{0.393204153f, 0.54448843f},
-std::array<float,2>{0.836711228f, 0.049554009f},
-std::array<float,2>{0.149004802f, 0.404561341f},
-std::array<float,2>{0.501764357f, 0.890653193f},
-std::array<float,2>{0.221915483f, 0.657342792f},
-std::array<float,2>{0.587683022f, 0.164973706f},
-std::array<float,2>{0.468653321f, 0.360395044f},
-std::array<float,2>{0.764784336f, 0.780266702f},
-std::array<float,2>{0.322813779f, 0.951807261f},
-std::array<float,2>{0.899092019f, 0.48175168f},
-std::array<float,2>{0.0195815656f, 0.116629601f},
-std::array<float,2>{0.7188133f, 0.60333246f},
-std::array<float,2>{0.178126916f, 0.911385179f},
-std::array<float,2>{0.539741814f, 0.421358466f},
-std::array<float,2>{0.423335314f, 0.0221771337f},
-std::array<float,2>{0.862786651f, 0.505190969f},
-std::array<float,2>{0.277967811f, 0.709272087f},
-std::array<float,2>{0.986477017f, 0.199847117f},
-std::array<float,2>{0.0690432414f, 0.300130099f},
-std::array<float,2>{0.683500111f, 0.817833722f},
-std::array<float,2>{0.0564647354f, 0.570294857f},
-std::array<float,2>{0.716380537f, 0.0903761312f},
-std::array<float,2>{0.350966454f, 0.445042193f},
-std::array<float,2>{0.918979287f, 0.991842866f},
-std::array<float,2>{0.487961471f, 0.784893274f},
-std::array<float,2>{0.788527966f, 0.334989578f},
-std::array<float,2>{0.198404104f, 0.156023487f},
-std::array<float,2>{0.600494564f, 0.644463956f},
-std::array<float,2>{0.21711877f, 0.760118544f},
-std::array<float,2>{0.618954003f, 0.35165146f},
-std::array<float,2>{0.478654414f, 0.178429693f},
-std::array<float,2>{0.805000067f, 0.678893268f},
-std::array<float,2>{0.359571189f, 0.62285918f},
-std::array<float,2>{0.934331f, 0.104473107f},
-std::array<float,2>{0.0440860353f, 0.499294728f},
-std::array<float,2>{0.692267001f, 0.956194937f},
-std::array<float,2>{0.0845105648f, 0.744625092f},
-std::array<float,2>{0.659190118f, 0.222601086f},
-std::array<float,2>{0.259858072f, 0.27016142f},
-std::array<float,2>{0.975000381f, 0.849908173f},
-std::array<float,2>{0.417585403f, 0.87744844f},
-std::array<float,2>{0.85222733f, 0.381046772f},
-std::array<float,2>{0.166657984f, 0.0323765092f},
-std::array<float,2>{0.55690521f, 0.555746555f},
-std::array<float,2>{0.00936150178f, 0.979783952f},
-std::array<float,2>{0.742202938f, 0.462213874f},
-std::array<float,2>{0.328784257f, 0.0777471811f},
-std::array<float,2>{0.88954407f, 0.583964765f},
-std::array<float,2>{0.439098805f, 0.639091849f},
-std::array<float,2>{0.778780341f, 0.131740704f},
-std::array<float,2>{0.238972649f, 0.315028489f},
-std::array<float,2>{0.566026151f, 0.809473515f},
-std::array<float,2>{0.139112025f, 0.520111382f},
-std::array<float,2>{0.516622007f, 0.0120569766f},
-std::array<float,2>{0.37845245f, 0.429720312f},
-std::array<float,2>{0.821879387f, 0.935298324f},
-std::array<float,2>{0.292642891f, 0.828743696f},
-std::array<float,2>{0.960577667f, 0.286540896f},
-std::array<float,2>{0.109593779f, 0.215798184f},
-std::array<float,2>{0.652063727f, 0.695790529f},
-std::array<float,2>{0.060198687f, 0.858380497f},
-std::array<float,2>{0.71423012f, 0.277704924f},
-std::array<float,2>{0.345151782f, 0.229865849f},
-std::array<float,2>{0.917037606f, 0.739515185f},
-std::array<float,2>{0.488723278f, 0.553180993f},
-std::array<float,2>{0.783982813f, 0.0443572775f},
-std::array<float,2>{0.202471703f, 0.388986886f},
-std::array<float,2>{0.597509861f, 0.887546003f},
-std::array<float,2>{0.174208254f, 0.686025202f},
-std::array<float,2>{0.542991042f, 0.182242736f},
-std::array<float,2>{0.427326292f, 0.348836452f},
-std::array<float,2>{0.86411798f, 0.750037372f},
-std::array<float,2>{0.277264476f, 0.961304367f},
-std::array<float,2>{0.990444779f, 0.487622917f},
-std::array<float,2>{0.0664009005f, 0.095809713f},
-std::array<float,2>{0.686747313f, 0.613175809f},
-std::array<float,2>{0.225184351f, 0.921900213f},
-std::array<float,2>{0.590979338f, 0.42260024f},
-std::array<float,2>{0.461457849f, 0.00455107121f},
-std::array<float,2>{0.76159519f, 0.524022579f},
-std::array<float,2>{0.325423956f, 0.690933526f},
-std::array<float,2>{0.904771209f, 0.209175989f},
-std::array<float,2>{0.017204307f, 0.289696991f},
-std::array<float,2>{0.725634754f, 0.840152502f},
-std::array<float,2>{0.107289843f, 0.587360442f},
-std::array<float,2>{0.63248986f, 0.0634691045f},
-std::array<float,2>{0.302499264f, 0.458917111f},
-std::array<float,2>{0.951894224f, 0.969118655f},
-std::array<float,2>{0.396268964f, 0.801020324f},
-std::array<float,2>{0.843701065f, 0.327111691f},
-std::array<float,2>{0.156080365f, 0.137752622f},
-std::array<float,2>{0.506532073f, 0.632631421f},
-std::array<float,2>{0.135042831f, 0.771198511f},
-std::array<float,2>{0.520119905f, 0.370387852f},
-std::array<float,2>{0.381461829f, 0.163597792f},
-std::array<float,2>{0.827171981f, 0.668200552f},
-std::array<float,2>{0.294750869f, 0.5938164f},
-std::array<float,2>{0.95428282f, 0.124869801f},
-std::array<float,2>{0.117040277f, 0.4707793f},
-std::array<float,2>{0.653264463f, 0.943087876f},
-std::array<float,2>{0.0143561587f, 0.726748466f},
-std::array<float,2>{0.748459458f, 0.241443291f},
-std::array<float,2>{0.335054129f, 0.265026093f},
-std::array<float,2>{0.886101961f, 0.862102747f},
-std::array<float,2>{0.445023894f, 0.902163863f},
-std::array<float,2>{0.777112007f, 0.391354471f},
-std::array<float,2>{0.235542506f, 0.0619425103f},
-std::array<float,2>{0.569464922f, 0.535616577f},
-std::array<float,2>{0.0808890387f, 0.997961819f},
-std::array<float,2>{0.663251638f, 0.451013446f},
-std::array<float,2>{0.262589395f, 0.0838592872f},
-std::array<float,2>{0.972101212f, 0.570692301f},
-std::array<float,2>{0.418792754f, 0.6515432f},
-std::array<float,2>{0.857042909f, 0.142417148f},
-std::array<float,2>{0.168343455f, 0.342974752f},
-std::array<float,2>{0.561068952f, 0.78914851f},
-std::array<float,2>{0.211810067f, 0.510106921f},
-std::array<float,2>{0.621673822f, 0.0270469729f},
-std::array<float,2>{0.482978553f, 0.412811756f},
-std::array<float,2>{0.812040567f, 0.917812228f},
-std::array<float,2>{0.36417219f, 0.826767027f},
-std::array<float,2>{0.933171928f, 0.308611184f},
-std::array<float,2>{0.0412669145f, 0.194389299f},
-std::array<float,2>{0.69067806f, 0.718147278f},
-std::array<float,2>{0.118655711f, 0.787418962f},
-std::array<float,2>{0.648418903f, 0.331215262f},
-std::array<float,2>{0.28278929f, 0.149552912f},
-std::array<float,2>{0.962629735f, 0.648100615f},
-std::array<float,2>{0.383272827f, 0.564361334f},
-std::array<float,2>{0.817836404f, 0.0876903236f},
-std::array<float,2>{0.127965719f, 0.439767361f},
-std::array<float,2>{0.525257826f, 0.987199128f},
-std::array<float,2>{0.247088879f, 0.7068097f},
-std::array<float,2>{0.57391715f, 0.197656214f},
-std::array<float,2>{0.445872992f, 0.300861448f},
-std::array<float,2>{0.769252539f, 0.814754725f},
-std::array<float,2>{0.339344591f, 0.907970011f},
-std::array<float,2>{0.879895985f, 0.415986955f},
-std::array<float,2>{0.00596891856f, 0.0167385619f},
-std::array<float,2>{0.734934509f, 0.503431201f},
-std::array<float,2>{0.163687557f, 0.948444486f},
-std::array<float,2>{0.547695398f, 0.47730872f},
-std::array<float,2>{0.410746753f, 0.112226248f},
-std::array<float,2>{0.845875561f, 0.607728183f},
-std::array<float,2>{0.255070597f, 0.661069334f},
-std::array<float,2>{0.984227419f, 0.16888164f},
-std::array<float,2>{0.0923611596f, 0.363555253f},
-std::array<float,2>{0.668308854f, 0.776358724f},
-std::array<float,2>{0.0350903049f, 0.542835355f},
-std::array<float,2>{0.698542416f, 0.0544519015f},
-std::array<float,2>{0.373968095f, 0.401963562f},
-std::array<float,2>{0.928474247f, 0.894800186f},
-std::array<float,2>{0.471050918f, 0.870278537f},
-std::array<float,2>{0.801063657f, 0.253857851f},
-std::array<float,2>{0.206828371f, 0.243083626f},
-std::array<float,2>{0.615288615f, 0.723605514f},
-std::array<float,2>{0.194161847f, 0.833305657f},
-std::array<float,2>{0.608000636f, 0.284903586f},
-std::array<float,2>{0.499522954f, 0.213675678f},
-std::array<float,2>{0.791499078f, 0.700436413f},
-std::array<float,2>{0.355398059f, 0.519499779f},
-std::array<float,2>{0.913560748f, 0.0114913508f},
-std::array<float,2>{0.0522895008f, 0.437096536f},
-std::array<float,2>{0.710530818f, 0.9326455f},
-std::array<float,2>{0.0777148306f, 0.6334185f},
-std::array<float,2>{0.6740188f, 0.127020344f},
-std::array<float,2>{0.273365974f, 0.318789065f},
-std::array<float,2>{0.998755932f, 0.804915607f},
-std::array<float,2>{0.432306588f, 0.982039571f},
-std::array<float,2>{0.871995926f, 0.465384901f},
-std::array<float,2>{0.186687186f, 0.0714005604f},
-std::array<float,2>{0.537754238f, 0.57939899f},
-std::array<float,2>{0.0280871522f, 0.879112244f},
-std::array<float,2>{0.727660239f, 0.37604484f},
-std::array<float,2>{0.319645286f, 0.037354771f},
-std::array<float,2>{0.898048043f, 0.562273085f},
-std::array<float,2>{0.457341433f, 0.746548295f},
-std::array<float,2>{0.756303668f, 0.225141764f},
-std::array<float,2>{0.233364016f, 0.266063839f},
-std::array<float,2>{0.581850588f, 0.84736073f},
-std::array<float,2>{0.14206019f, 0.620171547f},
-std::array<float,2>{0.514210463f, 0.107052714f},
-std::array<float,2>{0.4061988f, 0.493985713f},
-std::array<float,2>{0.829382777f, 0.958245516f},
-std::array<float,2>{0.309624135f, 0.762516618f},
-std::array<float,2>{0.937731206f, 0.357518852f},
-std::array<float,2>{0.0951220766f, 0.175507411f},
-std::array<float,2>{0.636497855f, 0.67522186f},
-std::array<float,2>{0.00205919496f, 0.757142842f},
-std::array<float,2>{0.739467919f, 0.344665706f},
-std::array<float,2>{0.34332639f, 0.186155483f},
-std::array<float,2>{0.877182364f, 0.681833565f},
-std::array<float,2>{0.450819373f, 0.614670813f},
-std::array<float,2>{0.77212441f, 0.0991876051f},
-std::array<float,2>{0.245816812f, 0.49089995f},
-std::array<float,2>{0.576475024f, 0.965651512f},
-std::array<float,2>{0.130132541f, 0.734493792f},
-std::array<float,2>{0.531210959f, 0.233043581f},
-std::array<float,2>{0.389292806f, 0.273890048f},
-std::array<float,2>{0.81567806f, 0.854555309f},
-std::array<float,2>{0.287056714f, 0.884548306f},
-std::array<float,2>{0.966469944f, 0.383491218f},
-std::array<float,2>{0.122414015f, 0.0425939411f},
-std::array<float,2>{0.643558025f, 0.547726333f},
-std::array<float,2>{0.208854064f, 0.975456536f},
-std::array<float,2>{0.61257869f, 0.453202546f},
-std::array<float,2>{0.475385636f, 0.0683691204f},
-std::array<float,2>{0.79986608f, 0.590745687f},
-std::array<float,2>{0.369018167f, 0.628782392f},
-std::array<float,2>{0.923823714f, 0.135507286f},
-std::array<float,2>{0.038769424f, 0.32373786f},
-std::array<float,2>{0.700151384f, 0.797336161f},
-std::array<float,2>{0.0887789875f, 0.52965802f},
-std::array<float,2>{0.667177081f, 0.000984453596f},
-std::array<float,2>{0.252035499f, 0.42800349f},
-std::array<float,2>{0.978108048f, 0.926676154f},
-std::array<float,2>{0.407951862f, 0.839731991f},
-std::array<float,2>{0.84830755f, 0.296107769f},
-std::array<float,2>{0.160124108f, 0.20597297f},
-std::array<float,2>{0.554667354f, 0.69369638f},
-std::array<float,2>{0.180065006f, 0.863340139f},
-std::array<float,2>{0.531933367f, 0.260603875f},
-std::array<float,2>{0.434912831f, 0.235616058f},
-std::array<float,2>{0.869795144f, 0.73153162f},
-std::array<float,2>{0.268092334f, 0.532007575f},
-std::array<float,2>{0.993198097f, 0.0555454046f},
-std::array<float,2>{0.0726910383f, 0.397510141f},
-std::array<float,2>{0.677763879f, 0.904541671f},
-std::array<float,2>{0.0473299995f, 0.664849818f},
-std::array<float,2>{0.705620289f, 0.159004644f},
-std::array<float,2>{0.357309461f, 0.37240845f},
-std::array<float,2>{0.906971157f, 0.765946865f},
-std::array<float,2>{0.493415147f, 0.939655721f},
-std::array<float,2>{0.795854688f, 0.474412858f},
-std::array<float,2>{0.188835725f, 0.119116969f},
-std::array<float,2>{0.604310215f, 0.600597978f},
-std::array<float,2>{0.100731619f, 0.918812454f},
-std::array<float,2>{0.638127923f, 0.40681228f},
-std::array<float,2>{0.307752907f, 0.0308302473f},
-std::array<float,2>{0.944858789f, 0.512164772f},
-std::array<float,2>{0.401565433f, 0.713286161f},
-std::array<float,2>{0.83344692f, 0.189329654f},
-std::array<float,2>{0.145534903f, 0.308414161f},
-std::array<float,2>{0.511067927f, 0.823634624f},
-std::array<float,2>{0.227842003f, 0.576722622f},
-std::array<float,2>{0.583182037f, 0.0819878355f},
-std::array<float,2>{0.453768343f, 0.445958555f},
-std::array<float,2>{0.750270545f, 0.99424684f},
-std::array<float,2>{0.312987715f, 0.793650389f},
-std::array<float,2>{0.892162323f, 0.338574171f},
-std::array<float,2>{0.0236022696f, 0.147264585f},
-std::array<float,2>{0.732561409f, 0.654522479f},
-std::array<float,2>{0.0664093345f, 0.819686353f},
-std::array<float,2>{0.680392683f, 0.297123969f},
-std::array<float,2>{0.280966759f, 0.201820403f},
-std::array<float,2>{0.985936999f, 0.707116544f},
-std::array<float,2>{0.425036699f, 0.507126987f},
-std::array<float,2>{0.860158801f, 0.019791998f},
-std::array<float,2>{0.176124811f, 0.418724149f},
-std::array<float,2>{0.541577697f, 0.912894607f},
-std::array<float,2>{0.19659543f, 0.642506063f},
-std::array<float,2>{0.598285079f, 0.15281716f},
-std::array<float,2>{0.484876812f, 0.332583189f},
-std::array<float,2>{0.786409378f, 0.783147037f},
-std::array<float,2>{0.347670436f, 0.989349842f},
-std::array<float,2>{0.921481073f, 0.441715389f},
-std::array<float,2>{0.0579966158f, 0.092063345f},
-std::array<float,2>{0.71825093f, 0.568282425f},
-std::array<float,2>{0.150594994f, 0.892935216f},
-std::array<float,2>{0.503622234f, 0.402820915f},
-std::array<float,2>{0.3915658f, 0.0483065061f},
-std::array<float,2>{0.83810997f, 0.546041787f},
-std::array<float,2>{0.299284905f, 0.720611691f},
-std::array<float,2>{0.946674287f, 0.24618718f},
-std::array<float,2>{0.101850696f, 0.253939748f},
-std::array<float,2>{0.625817001f, 0.871556401f},
-std::array<float,2>{0.0221961457f, 0.60384208f},
-std::array<float,2>{0.720806062f, 0.114126451f},
-std::array<float,2>{0.320936412f, 0.483683765f},
-std::array<float,2>{0.901285946f, 0.95009023f},
-std::array<float,2>{0.465751857f, 0.778995037f},
-std::array<float,2>{0.762049735f, 0.362049699f},
-std::array<float,2>{0.220526561f, 0.167964533f},
-std::array<float,2>{0.588966608f, 0.658737957f},
-std::array<float,2>{0.240904018f, 0.811591029f},
-std::array<float,2>{0.563750863f, 0.313628286f},
-std::array<float,2>{0.441178948f, 0.12989071f},
-std::array<float,2>{0.78007102f, 0.637741506f},
-std::array<float,2>{0.330423355f, 0.584329009f},
-std::array<float,2>{0.888547957f, 0.0755238682f},
-std::array<float,2>{0.0102888197f, 0.464678884f},
-std::array<float,2>{0.745384157f, 0.977591574f},
-std::array<float,2>{0.113011584f, 0.698763847f},
-std::array<float,2>{0.648696482f, 0.217222571f},
-std::array<float,2>{0.290886194f, 0.288033813f},
-std::array<float,2>{0.958408833f, 0.831987023f},
-std::array<float,2>{0.375071049f, 0.936387181f},
-std::array<float,2>{0.823386252f, 0.433354855f},
-std::array<float,2>{0.136949942f, 0.0144448886f},
-std::array<float,2>{0.519127548f, 0.521677792f},
-std::array<float,2>{0.0455422439f, 0.953209519f},
-std::array<float,2>{0.694620848f, 0.496284813f},
-std::array<float,2>{0.363189578f, 0.103069767f},
-std::array<float,2>{0.937283576f, 0.623959959f},
-std::array<float,2>{0.477074206f, 0.676600695f},
-std::array<float,2>{0.807053506f, 0.176610768f},
-std::array<float,2>{0.216146141f, 0.353878766f},
-std::array<float,2>{0.619185925f, 0.759737849f},
-std::array<float,2>{0.164417371f, 0.55713886f},
-std::array<float,2>{0.555692017f, 0.0336257257f},
-std::array<float,2>{0.415335715f, 0.378977954f},
-std::array<float,2>{0.855404496f, 0.876647055f},
-std::array<float,2>{0.258189201f, 0.847701371f},
-std::array<float,2>{0.973392248f, 0.271786749f},
-std::array<float,2>{0.0838610008f, 0.220061675f},
-std::array<float,2>{0.657785892f, 0.743970931f},
-std::array<float,2>{0.0517951213f, 0.834122002f},
-std::array<float,2>{0.710345924f, 0.281623572f},
-std::array<float,2>{0.354662955f, 0.212722957f},
-std::array<float,2>{0.91376406f, 0.702968419f},
-std::array<float,2>{0.499133557f, 0.51673013f},
-std::array<float,2>{0.791673601f, 0.00836078171f},
-std::array<float,2>{0.193813235f, 0.4347004f},
-std::array<float,2>{0.607700825f, 0.930475712f},
-std::array<float,2>{0.187152714f, 0.635123849f},
-std::array<float,2>{0.537227333f, 0.126683161f},
-std::array<float,2>{0.431954592f, 0.31746459f},
-std::array<float,2>{0.871190071f, 0.807229698f},
-std::array<float,2>{0.272469968f, 0.98352021f},
-std::array<float,2>{0.998124719f, 0.467167497f},
-std::array<float,2>{0.0775071979f, 0.0738743097f},
-std::array<float,2>{0.67455852f, 0.581958771f},
-std::array<float,2>{0.232571974f, 0.881206036f},
-std::array<float,2>{0.581211865f, 0.377689719f},
-std::array<float,2>{0.457542479f, 0.0354956761f},
-std::array<float,2>{0.756528795f, 0.559696674f},
-std::array<float,2>{0.320151508f, 0.7481336f},
-std::array<float,2>{0.897609949f, 0.22297363f},
-std::array<float,2>{0.0276662633f, 0.268803835f},
-std::array<float,2>{0.728048563f, 0.845148504f},
-std::array<float,2>{0.0952667966f, 0.618269503f},
-std::array<float,2>{0.6362077f, 0.107631817f},
-std::array<float,2>{0.310361028f, 0.495541722f},
-std::array<float,2>{0.938127637f, 0.959202945f},
-std::array<float,2>{0.40558067f, 0.764560163f},
-std::array<float,2>{0.83007133f, 0.356255084f},
-std::array<float,2>{0.142270818f, 0.173139736f},
-std::array<float,2>{0.514062583f, 0.672872663f},
-std::array<float,2>{0.12844725f, 0.785867989f},
-std::array<float,2>{0.524480879f, 0.329988927f},
-std::array<float,2>{0.383372158f, 0.152053505f},
-std::array<float,2>{0.817893207f, 0.645714462f},
-std::array<float,2>{0.282687843f, 0.565863132f},
-std::array<float,2>{0.962336659f, 0.0883200765f},
-std::array<float,2>{0.118411615f, 0.437857062f},
-std::array<float,2>{0.647607088f, 0.984760284f},
-std::array<float,2>{0.00683537032f, 0.704564154f},
-std::array<float,2>{0.734780848f, 0.195700362f},
-std::array<float,2>{0.339379996f, 0.303353906f},
-std::array<float,2>{0.880671442f, 0.813967884f},
-std::array<float,2>{0.445684701f, 0.909311771f},
-std::array<float,2>{0.768964589f, 0.416131467f},
-std::array<float,2>{0.247655287f, 0.0179432165f},
-std::array<float,2>{0.573616266f, 0.500222206f},
-std::array<float,2>{0.0921820998f, 0.946881175f},
-std::array<float,2>{0.668774247f, 0.479380995f},
-std::array<float,2>{0.255455464f, 0.110290028f},
-std::array<float,2>{0.983564138f, 0.605582297f},
-std::array<float,2>{0.410237163f, 0.663897038f},
-std::array<float,2>{0.846324921f, 0.171120718f},
-std::array<float,2>{0.163104415f, 0.366349906f},
-std::array<float,2>{0.547211647f, 0.77408731f},
-std::array<float,2>{0.206170753f, 0.539143264f},
-std::array<float,2>{0.616151452f, 0.0524314046f},
-std::array<float,2>{0.471308589f, 0.399060696f},
-std::array<float,2>{0.801458657f, 0.897530854f},
-std::array<float,2>{0.37314567f, 0.868129253f},
-std::array<float,2>{0.928059459f, 0.251104295f},
-std::array<float,2>{0.0345295481f, 0.244316548f},
-std::array<float,2>{0.699120939f, 0.725654125f},
-std::array<float,2>{0.116318986f, 0.772956908f},
-std::array<float,2>{0.65272826f, 0.368583322f},
-std::array<float,2>{0.294281483f, 0.16084446f},
-std::array<float,2>{0.954878926f, 0.671569824f},
-std::array<float,2>{0.381157011f, 0.596781075f},
-std::array<float,2>{0.828007221f, 0.122694291f},
-std::array<float,2>{0.135559082f, 0.469096065f},
-std::array<float,2>{0.519983649f, 0.943966746f},
-std::array<float,2>{0.236305192f, 0.728965044f},
-std::array<float,2>{0.570136905f, 0.24007757f},
-std::array<float,2>{0.444341779f, 0.263626039f},
-std::array<float,2>{0.776621044f, 0.860943615f},
-std::array<float,2>{0.335617781f, 0.899900615f},
-std::array<float,2>{0.886647522f, 0.393264711f},
-std::array<float,2>{0.0138176735f, 0.0587703921f},
-std::array<float,2>{0.748932719f, 0.537244022f},
-std::array<float,2>{0.168778867f, 0.998985708f},
-std::array<float,2>{0.560790241f, 0.452527672f},
-std::array<float,2>{0.418215692f, 0.0849562734f},
-std::array<float,2>{0.856621802f, 0.574153185f},
-std::array<float,2>{0.261940539f, 0.649105549f},
-std::array<float,2>{0.972545266f, 0.142728686f},
-std::array<float,2>{0.0804469287f, 0.340364873f},
-std::array<float,2>{0.663574755f, 0.791558087f},
-std::array<float,2>{0.0415595584f, 0.508360565f},
-std::array<float,2>{0.691053629f, 0.0252523143f},
-std::array<float,2>{0.363395602f, 0.410701692f},
-std::array<float,2>{0.932852685f, 0.9150244f},
-std::array<float,2>{0.482593775f, 0.825284243f},
-std::array<float,2>{0.811786294f, 0.312406987f},
-std::array<float,2>{0.211279333f, 0.192834303f},
-std::array<float,2>{0.621529758f, 0.715542793f},
-std::array<float,2>{0.202783227f, 0.855773747f},
-std::array<float,2>{0.596830249f, 0.280448824f},
-std::array<float,2>{0.489024907f, 0.227424845f},
-std::array<float,2>{0.783515871f, 0.742002726f},
-std::array<float,2>{0.345288724f, 0.552591681f},
-std::array<float,2>{0.917643845f, 0.0468747541f},
-std::array<float,2>{0.0599931441f, 0.387394994f},
-std::array<float,2>{0.714666784f, 0.890288293f},
-std::array<float,2>{0.0656672418f, 0.684363544f},
-std::array<float,2>{0.687199533f, 0.181029812f},
-std::array<float,2>{0.276684314f, 0.350258738f},
-std::array<float,2>{0.99081111f, 0.753786206f},
-std::array<float,2>{0.427039117f, 0.962936461f},
-std::array<float,2>{0.863703489f, 0.484828502f},
-std::array<float,2>{0.174440816f, 0.0945121422f},
-std::array<float,2>{0.54352349f, 0.609742582f},
-std::array<float,2>{0.0169803668f, 0.924196124f},
-std::array<float,2>{0.726109982f, 0.425334573f},
-std::array<float,2>{0.326096177f, 0.00636263192f},
-std::array<float,2>{0.905161381f, 0.526285291f},
-std::array<float,2>{0.461001366f, 0.687913716f},
-std::array<float,2>{0.760840774f, 0.207958296f},
-std::array<float,2>{0.224639311f, 0.291118473f},
-std::array<float,2>{0.591439903f, 0.843505561f},
-std::array<float,2>{0.155369014f, 0.589370549f},
-std::array<float,2>{0.50628829f, 0.0658092648f},
-std::array<float,2>{0.395654589f, 0.459912151f},
-std::array<float,2>{0.843185902f, 0.971776366f},
-std::array<float,2>{0.301848859f, 0.803364635f},
-std::array<float,2>{0.951624095f, 0.324433595f},
-std::array<float,2>{0.106676497f, 0.138906091f},
-std::array<float,2>{0.632187068f, 0.628984094f},
-std::array<float,2>{0.00988777354f, 0.808698714f},
-std::array<float,2>{0.746006191f, 0.314524353f},
-std::array<float,2>{0.330856174f, 0.130972534f},
-std::array<float,2>{0.887834013f, 0.639510155f},
-std::array<float,2>{0.440523297f, 0.583443046f},
-std::array<float,2>{0.779680133f, 0.0773908272f},
-std::array<float,2>{0.240383044f, 0.462742835f},
-std::array<float,2>{0.564324915f, 0.98021549f},
-std::array<float,2>{0.137312099f, 0.69623673f},
-std::array<float,2>{0.518998146f, 0.215087831f},
-std::array<float,2>{0.375825256f, 0.286769867f},
-std::array<float,2>{0.824190795f, 0.828583181f},
-std::array<float,2>{0.290410668f, 0.934890568f},
-std::array<float,2>{0.958703578f, 0.430203527f},
-std::array<float,2>{0.112382427f, 0.0125131095f},
-std::array<float,2>{0.649398744f, 0.519662976f},
-std::array<float,2>{0.216453746f, 0.956639886f},
-std::array<float,2>{0.619977772f, 0.49965167f},
-std::array<float,2>{0.476599544f, 0.103855476f},
-std::array<float,2>{0.807159126f, 0.622521698f},
-std::array<float,2>{0.362780362f, 0.679601431f},
-std::array<float,2>{0.936721087f, 0.177851364f},
-std::array<float,2>{0.0451613888f, 0.352528602f},
-std::array<float,2>{0.695058286f, 0.760641634f},
-std::array<float,2>{0.0834666863f, 0.556156874f},
-std::array<float,2>{0.657366037f, 0.0329943374f},
-std::array<float,2>{0.258562177f, 0.381389856f},
-std::array<float,2>{0.972671211f, 0.876977384f},
-std::array<float,2>{0.415759295f, 0.850349784f},
-std::array<float,2>{0.854649484f, 0.269620419f},
-std::array<float,2>{0.164572462f, 0.222112671f},
-std::array<float,2>{0.556639373f, 0.744690537f},
-std::array<float,2>{0.176474854f, 0.818070054f},
-std::array<float,2>{0.541425526f, 0.300677776f},
-std::array<float,2>{0.42542389f, 0.199272841f},
-std::array<float,2>{0.859830678f, 0.709532976f},
-std::array<float,2>{0.280652344f, 0.505842209f},
-std::array<float,2>{0.985649586f, 0.0215862654f},
-std::array<float,2>{0.0673223138f, 0.421827614f},
-std::array<float,2>{0.680147231f, 0.911654711f},
-std::array<float,2>{0.0584121607f, 0.64374423f},
-std::array<float,2>{0.718644857f, 0.155485556f},
-std::array<float,2>{0.348174065f, 0.335791767f},
-std::array<float,2>{0.921230972f, 0.78464359f},
-std::array<float,2>{0.484817207f, 0.991394758f},
-std::array<float,2>{0.786969304f, 0.444661289f},
-std::array<float,2>{0.197162703f, 0.0900384486f},
-std::array<float,2>{0.597794652f, 0.569417715f},
-std::array<float,2>{0.102198146f, 0.891355455f},
-std::array<float,2>{0.625087619f, 0.405133754f},
-std::array<float,2>{0.299544871f, 0.0492976531f},
-std::array<float,2>{0.947034895f, 0.543991506f},
-std::array<float,2>{0.390891761f, 0.722499728f},
-std::array<float,2>{0.838533282f, 0.248078555f},
-std::array<float,2>{0.150927007f, 0.257687271f},
-std::array<float,2>{0.503379643f, 0.874321997f},
-std::array<float,2>{0.21978946f, 0.602995574f},
-std::array<float,2>{0.589659214f, 0.117095061f},
-std::array<float,2>{0.465027839f, 0.482147306f},
-std::array<float,2>{0.762292922f, 0.951401353f},
-std::array<float,2>{0.320590109f, 0.77960217f},
-std::array<float,2>{0.90079695f, 0.360873044f},
-std::array<float,2>{0.0217168164f, 0.164333358f},
-std::array<float,2>{0.721208632f, 0.658141077f},
-std::array<float,2>{0.0729436502f, 0.866285682f},
-std::array<float,2>{0.678500712f, 0.258981943f},
-std::array<float,2>{0.267606944f, 0.237229526f},
-std::array<float,2>{0.993769944f, 0.733743012f},
-std::array<float,2>{0.435250461f, 0.534231246f},
-std::array<float,2>{0.869389713f, 0.0573091283f},
-std::array<float,2>{0.18019706f, 0.394971788f},
-std::array<float,2>{0.531599581f, 0.903298676f},
-std::array<float,2>{0.189056203f, 0.667562246f},
-std::array<float,2>{0.603662372f, 0.156328842f},
-std::array<float,2>{0.493895054f, 0.37412867f},
-std::array<float,2>{0.795006752f, 0.769313991f},
-std::array<float,2>{0.356770098f, 0.938516438f},
-std::array<float,2>{0.906595528f, 0.475921065f},
-std::array<float,2>{0.0476160869f, 0.120245025f},
-std::array<float,2>{0.705265999f, 0.598753095f},
-std::array<float,2>{0.146003738f, 0.921665967f},
-std::array<float,2>{0.511651814f, 0.409341812f},
-std::array<float,2>{0.402069122f, 0.0281313527f},
-std::array<float,2>{0.833816051f, 0.514511943f},
-std::array<float,2>{0.308504939f, 0.71185708f},
-std::array<float,2>{0.944630563f, 0.189808711f},
-std::array<float,2>{0.101082429f, 0.306336075f},
-std::array<float,2>{0.63830024f, 0.821739137f},
-std::array<float,2>{0.0240565278f, 0.574666858f},
-std::array<float,2>{0.733256102f, 0.0788992569f},
-std::array<float,2>{0.313154608f, 0.449218333f},
-std::array<float,2>{0.891818464f, 0.994039118f},
-std::array<float,2>{0.453202188f, 0.79586947f},
-std::array<float,2>{0.750834703f, 0.336037695f},
-std::array<float,2>{0.228434056f, 0.144816041f},
-std::array<float,2>{0.58355099f, 0.652595639f},
-std::array<float,2>{0.245164946f, 0.753984392f},
-std::array<float,2>{0.576803207f, 0.345769197f},
-std::array<float,2>{0.450508118f, 0.184681922f},
-std::array<float,2>{0.771530747f, 0.680357218f},
-std::array<float,2>{0.342869997f, 0.616676331f},
-std::array<float,2>{0.877696633f, 0.100102566f},
-std::array<float,2>{0.00268983608f, 0.488376737f},
-std::array<float,2>{0.740095735f, 0.967482746f},
-std::array<float,2>{0.12297713f, 0.736519277f},
-std::array<float,2>{0.644098997f, 0.231426001f},
-std::array<float,2>{0.286435574f, 0.276273251f},
-std::array<float,2>{0.966282666f, 0.85294497f},
-std::array<float,2>{0.389048994f, 0.885687411f},
-std::array<float,2>{0.816388786f, 0.385182083f},
-std::array<float,2>{0.130819157f, 0.040389441f},
-std::array<float,2>{0.530541599f, 0.550778866f},
-std::array<float,2>{0.0384181067f, 0.973634839f},
-std::array<float,2>{0.699356616f, 0.456458837f},
-std::array<float,2>{0.368202478f, 0.0674360245f},
-std::array<float,2>{0.923089683f, 0.593394578f},
-std::array<float,2>{0.474955082f, 0.625537634f},
-std::array<float,2>{0.800491154f, 0.133242816f},
-std::array<float,2>{0.208018199f, 0.321158916f},
-std::array<float,2>{0.613131881f, 0.799883544f},
-std::array<float,2>{0.159583122f, 0.529257774f},
-std::array<float,2>{0.554028094f, 0.00198154338f},
-std::array<float,2>{0.407298177f, 0.425813705f},
-std::array<float,2>{0.847846866f, 0.928229809f},
-std::array<float,2>{0.252883226f, 0.837236881f},
-std::array<float,2>{0.977933586f, 0.293651849f},
-std::array<float,2>{0.0879520476f, 0.204539999f},
-std::array<float,2>{0.667576075f, 0.69329524f},
-std::array<float,2>{0.0294381566f, 0.84692955f},
-std::array<float,2>{0.729465425f, 0.266462505f},
-std::array<float,2>{0.317430586f, 0.225049585f},
-std::array<float,2>{0.89570117f, 0.746921182f},
-std::array<float,2>{0.460674286f, 0.561851501f},
-std::array<float,2>{0.755225122f, 0.0379707925f},
-std::array<float,2>{0.232176185f, 0.376614928f},
-std::array<float,2>{0.579870522f, 0.879509151f},
-std::array<float,2>{0.143242538f, 0.675689757f},
-std::array<float,2>{0.51296407f, 0.174855828f},
-std::array<float,2>{0.402412921f, 0.35818252f},
-std::array<float,2>{0.831175089f, 0.761888623f},
-std::array<float,2>{0.311106771f, 0.958576024f},
-std::array<float,2>{0.940590262f, 0.493469268f},
-std::array<float,2>{0.0976233706f, 0.106792249f},
-std::array<float,2>{0.633467853f, 0.62075913f},
-std::array<float,2>{0.19331789f, 0.933355451f},
-std::array<float,2>{0.605974972f, 0.436757445f},
-std::array<float,2>{0.496610105f, 0.0108399605f},
-std::array<float,2>{0.789359868f, 0.518840611f},
-std::array<float,2>{0.351625562f, 0.700944781f},
-std::array<float,2>{0.91173166f, 0.213044107f},
-std::array<float,2>{0.0539600402f, 0.28436023f},
-std::array<float,2>{0.708814502f, 0.833595812f},
-std::array<float,2>{0.0751023591f, 0.579645693f},
-std::array<float,2>{0.672751546f, 0.0719308928f},
-std::array<float,2>{0.271199733f, 0.465172529f},
-std::array<float,2>{0.996624053f, 0.98186022f},
-std::array<float,2>{0.430349916f, 0.805283666f},
-std::array<float,2>{0.874169946f, 0.319228709f},
-std::array<float,2>{0.185126752f, 0.127506003f},
-std::array<float,2>{0.53578788f, 0.633104622f},
-std::array<float,2>{0.161754683f, 0.77576977f},
-std::array<float,2>{0.550500929f, 0.363798827f},
-std::array<float,2>{0.412546366f, 0.168142751f},
-std::array<float,2>{0.844904602f, 0.660333157f},
-std::array<float,2>{0.256456852f, 0.608389139f},
-std::array<float,2>{0.982076168f, 0.111677036f},
-std::array<float,2>{0.0910622254f, 0.476923108f},
-std::array<float,2>{0.671096087f, 0.948885679f},
-std::array<float,2>{0.0324163325f, 0.72302109f},
-std::array<float,2>{0.696803868f, 0.242389947f},
-std::array<float,2>{0.37110427f, 0.253284782f},
-std::array<float,2>{0.927585304f, 0.870871961f},
-std::array<float,2>{0.470006794f, 0.895397127f},
-std::array<float,2>{0.802956402f, 0.401719242f},
-std::array<float,2>{0.203236625f, 0.0538742207f},
-std::array<float,2>{0.615058661f, 0.542265058f},
-std::array<float,2>{0.119905919f, 0.986409903f},
-std::array<float,2>{0.644922078f, 0.440231144f},
-std::array<float,2>{0.283970058f, 0.087067768f},
-std::array<float,2>{0.96373558f, 0.56387347f},
-std::array<float,2>{0.386264354f, 0.647726953f},
-std::array<float,2>{0.819106996f, 0.150365204f},
-std::array<float,2>{0.125870809f, 0.331700087f},
-std::array<float,2>{0.525888562f, 0.787601948f},
-std::array<float,2>{0.248393551f, 0.502994299f},
-std::array<float,2>{0.571199536f, 0.0171130691f},
-std::array<float,2>{0.448857933f, 0.415239096f},
-std::array<float,2>{0.766187191f, 0.907625437f},
-std::array<float,2>{0.337557137f, 0.815398693f},
-std::array<float,2>{0.882777393f, 0.301683038f},
-std::array<float,2>{0.00444112998f, 0.197982505f},
-std::array<float,2>{0.738257706f, 0.706463873f},
-std::array<float,2>{0.078650102f, 0.78996706f},
-std::array<float,2>{0.660856664f, 0.343638211f},
-std::array<float,2>{0.263768941f, 0.141687781f},
-std::array<float,2>{0.970133245f, 0.652107477f},
-std::array<float,2>{0.420546591f, 0.571097076f},
-std::array<float,2>{0.858647585f, 0.083122395f},
-std::array<float,2>{0.171420723f, 0.450455189f},
-std::array<float,2>{0.558633864f, 0.997205615f},
-std::array<float,2>{0.214403465f, 0.718610287f},
-std::array<float,2>{0.623348355f, 0.195031688f},
-std::array<float,2>{0.480772823f, 0.309248716f},
-std::array<float,2>{0.809433639f, 0.826637745f},
-std::array<float,2>{0.367091715f, 0.917249143f},
-std::array<float,2>{0.930527091f, 0.412290961f},
-std::array<float,2>{0.0399186946f, 0.0267243218f},
-std::array<float,2>{0.689379632f, 0.510322511f},
-std::array<float,2>{0.133478075f, 0.942389071f},
-std::array<float,2>{0.522358298f, 0.471542001f},
-std::array<float,2>{0.380173922f, 0.124259382f},
-std::array<float,2>{0.825740516f, 0.594258249f},
-std::array<float,2>{0.296707332f, 0.668780684f},
-std::array<float,2>{0.955850124f, 0.16333884f},
-std::array<float,2>{0.114008263f, 0.370636493f},
-std::array<float,2>{0.655105591f, 0.770708144f},
-std::array<float,2>{0.0135429297f, 0.535862803f},
-std::array<float,2>{0.746165514f, 0.0624297969f},
-std::array<float,2>{0.332132578f, 0.390636861f},
-std::array<float,2>{0.884625137f, 0.901384592f},
-std::array<float,2>{0.443076849f, 0.861430645f},
-std::array<float,2>{0.773634195f, 0.265333652f},
-std::array<float,2>{0.236864418f, 0.241758183f},
-std::array<float,2>{0.567465246f, 0.727099121f},
-std::array<float,2>{0.222983181f, 0.840758741f},
-std::array<float,2>{0.592587888f, 0.289251387f},
-std::array<float,2>{0.464634061f, 0.209524229f},
-std::array<float,2>{0.758684158f, 0.690451801f},
-std::array<float,2>{0.328057885f, 0.52391535f},
-std::array<float,2>{0.903958797f, 0.00419897027f},
-std::array<float,2>{0.0184621178f, 0.422210097f},
-std::array<float,2>{0.723089218f, 0.922482491f},
-std::array<float,2>{0.108066738f, 0.632282495f},
-std::array<float,2>{0.629261255f, 0.138405368f},
-std::array<float,2>{0.303443581f, 0.326491892f},
-std::array<float,2>{0.950792909f, 0.801404059f},
-std::array<float,2>{0.396594107f, 0.969712675f},
-std::array<float,2>{0.84043175f, 0.458436877f},
-std::array<float,2>{0.154199779f, 0.0629006922f},
-std::array<float,2>{0.505242944f, 0.587837517f},
-std::array<float,2>{0.0622515939f, 0.887043834f},
-std::array<float,2>{0.712429464f, 0.389389575f},
-std::array<float,2>{0.347619027f, 0.0446173474f},
-std::array<float,2>{0.915694475f, 0.553449988f},
-std::array<float,2>{0.490246534f, 0.739913821f},
-std::array<float,2>{0.781476319f, 0.230448663f},
-std::array<float,2>{0.200425178f, 0.278054178f},
-std::array<float,2>{0.593856871f, 0.857472837f},
-std::array<float,2>{0.173703551f, 0.612360775f},
-std::array<float,2>{0.545901477f, 0.0963444039f},
-std::array<float,2>{0.429472566f, 0.488194436f},
-std::array<float,2>{0.865633726f, 0.961656868f},
-std::array<float,2>{0.274453193f, 0.750775456f},
-std::array<float,2>{0.989960194f, 0.349605262f},
-std::array<float,2>{0.0638954192f, 0.181688651f},
-std::array<float,2>{0.684346676f, 0.686074495f},
-std::array<float,2>{0.0446843356f, 0.75905025f},
-std::array<float,2>{0.69160217f, 0.354459047f},
-std::array<float,2>{0.359922856f, 0.176080093f},
-std::array<float,2>{0.933641613f, 0.676127076f},
-std::array<float,2>{0.479296565f, 0.623272777f},
-std::array<float,2>{0.80522269f, 0.10278406f},
-std::array<float,2>{0.217416286f, 0.496972412f},
-std::array<float,2>{0.618294716f, 0.953915715f},
-std::array<float,2>{0.166098416f, 0.743448973f},
-std::array<float,2>{0.557196319f, 0.220482796f},
-std::array<float,2>{0.417094409f, 0.272117347f},
-std::array<float,2>{0.851598144f, 0.848496675f},
-std::array<float,2>{0.260429561f, 0.876037121f},
-std::array<float,2>{0.975314498f, 0.37982741f},
-std::array<float,2>{0.084462747f, 0.0336968265f},
-std::array<float,2>{0.660061181f, 0.556799769f},
-std::array<float,2>{0.238690138f, 0.978218198f},
-std::array<float,2>{0.565772116f, 0.463954747f},
-std::array<float,2>{0.438819408f, 0.0759601444f},
-std::array<float,2>{0.77890259f, 0.584936917f},
-std::array<float,2>{0.328231364f, 0.638282895f},
-std::array<float,2>{0.889112473f, 0.130664825f},
-std::array<float,2>{0.00915301312f, 0.314320922f},
-std::array<float,2>{0.7426759f, 0.812383354f},
-std::array<float,2>{0.110224046f, 0.522349417f},
-std::array<float,2>{0.651409149f, 0.0140866218f},
-std::array<float,2>{0.29231444f, 0.432707995f},
-std::array<float,2>{0.959997654f, 0.935633838f},
-std::array<float,2>{0.378177494f, 0.831428647f},
-std::array<float,2>{0.821424484f, 0.287433565f},
-std::array<float,2>{0.139209896f, 0.217608318f},
-std::array<float,2>{0.517316818f, 0.698538482f},
-std::array<float,2>{0.14881292f, 0.87198168f},
-std::array<float,2>{0.500977755f, 0.254737675f},
-std::array<float,2>{0.392580807f, 0.246777102f},
-std::array<float,2>{0.836223364f, 0.719875991f},
-std::array<float,2>{0.298005164f, 0.546868801f},
-std::array<float,2>{0.948740602f, 0.048546344f},
-std::array<float,2>{0.105243057f, 0.403122872f},
-std::array<float,2>{0.627386093f, 0.893358707f},
-std::array<float,2>{0.020101903f, 0.658292174f},
-std::array<float,2>{0.719605446f, 0.167025834f},
-std::array<float,2>{0.322415501f, 0.361715078f},
-std::array<float,2>{0.898743868f, 0.778582573f},
-std::array<float,2>{0.467797846f, 0.949295044f},
-std::array<float,2>{0.765478551f, 0.48409465f},
-std::array<float,2>{0.222399011f, 0.113758609f},
-std::array<float,2>{0.587228656f, 0.604014397f},
-std::array<float,2>{0.0687559769f, 0.912305772f},
-std::array<float,2>{0.682852507f, 0.418276638f},
-std::array<float,2>{0.277381927f, 0.020304678f},
-std::array<float,2>{0.986833215f, 0.507528841f},
-std::array<float,2>{0.423459947f, 0.707895398f},
-std::array<float,2>{0.862858713f, 0.201230928f},
-std::array<float,2>{0.178229302f, 0.297786146f},
-std::array<float,2>{0.539123356f, 0.820021093f},
-std::array<float,2>{0.198881432f, 0.567704558f},
-std::array<float,2>{0.599737585f, 0.0925208852f},
-std::array<float,2>{0.487638652f, 0.442134321f},
-std::array<float,2>{0.788764417f, 0.990037143f},
-std::array<float,2>{0.351471901f, 0.782232344f},
-std::array<float,2>{0.919780314f, 0.332072169f},
-std::array<float,2>{0.0556735769f, 0.153024152f},
-std::array<float,2>{0.716036499f, 0.641837358f},
-std::array<float,2>{0.0981963649f, 0.824120045f},
-std::array<float,2>{0.639431775f, 0.308036f},
-std::array<float,2>{0.305996597f, 0.188691244f},
-std::array<float,2>{0.942678273f, 0.713847399f},
-std::array<float,2>{0.399304092f, 0.512434423f},
-std::array<float,2>{0.834583461f, 0.0304576047f},
-std::array<float,2>{0.147300646f, 0.406678021f},
-std::array<float,2>{0.50944376f, 0.918414354f},
-std::array<float,2>{0.229082763f, 0.655257642f},
-std::array<float,2>{0.584479868f, 0.146751612f},
-std::array<float,2>{0.456455499f, 0.338094443f},
-std::array<float,2>{0.75234586f, 0.793087304f},
-std::array<float,2>{0.315412104f, 0.994760513f},
-std::array<float,2>{0.893915951f, 0.445589095f},
-std::array<float,2>{0.0268236101f, 0.0813802704f},
-std::array<float,2>{0.73165524f, 0.57623148f},
-std::array<float,2>{0.181706429f, 0.904795527f},
-std::array<float,2>{0.534521043f, 0.3979716f},
-std::array<float,2>{0.437046498f, 0.0549523756f},
-std::array<float,2>{0.867753625f, 0.531540811f},
-std::array<float,2>{0.265962273f, 0.732004642f},
-std::array<float,2>{0.994162321f, 0.236003697f},
-std::array<float,2>{0.0721354783f, 0.26021558f},
-std::array<float,2>{0.677633941f, 0.864088833f},
-std::array<float,2>{0.0497966111f, 0.601300359f},
-std::array<float,2>{0.704737067f, 0.118441984f},
-std::array<float,2>{0.35894829f, 0.474040359f},
-std::array<float,2>{0.908203542f, 0.940351546f},
-std::array<float,2>{0.494620502f, 0.766287625f},
-std::array<float,2>{0.794122875f, 0.37277478f},
-std::array<float,2>{0.191170812f, 0.158541247f},
-std::array<float,2>{0.60253787f, 0.664465368f},
-std::array<float,2>{0.210388526f, 0.797609031f},
-std::array<float,2>{0.611002326f, 0.323485643f},
-std::array<float,2>{0.4742845f, 0.13499938f},
-std::array<float,2>{0.797300339f, 0.627993643f},
-std::array<float,2>{0.370555103f, 0.590116918f},
-std::array<float,2>{0.923858881f, 0.0690376684f},
-std::array<float,2>{0.0363939479f, 0.453961611f},
-std::array<float,2>{0.702546597f, 0.97468555f},
-std::array<float,2>{0.0876809806f, 0.694281459f},
-std::array<float,2>{0.664966941f, 0.205144256f},
-std::array<float,2>{0.250632674f, 0.296691746f},
-std::array<float,2>{0.97949785f, 0.839312315f},
-std::array<float,2>{0.409252256f, 0.92617476f},
-std::array<float,2>{0.849810839f, 0.428710073f},
-std::array<float,2>{0.156275243f, 0.00185272098f},
-std::array<float,2>{0.551076233f, 0.530183971f},
-std::array<float,2>{0.00165806734f, 0.964986801f},
-std::array<float,2>{0.742063224f, 0.490426034f},
-std::array<float,2>{0.340782762f, 0.0991098806f},
-std::array<float,2>{0.875192404f, 0.614778161f},
-std::array<float,2>{0.452986956f, 0.682486296f},
-std::array<float,2>{0.769845843f, 0.185565993f},
-std::array<float,2>{0.243848741f, 0.34422645f},
-std::array<float,2>{0.576164126f, 0.75763458f},
-std::array<float,2>{0.131201997f, 0.547159314f},
-std::array<float,2>{0.52887547f, 0.0423619337f},
-std::array<float,2>{0.386831284f, 0.383061051f},
-std::array<float,2>{0.813982308f, 0.884221315f},
-std::array<float,2>{0.288194597f, 0.855276346f},
-std::array<float,2>{0.966811597f, 0.274126291f},
-std::array<float,2>{0.123262249f, 0.232706353f},
-std::array<float,2>{0.64207834f, 0.734951437f},
-std::array<float,2>{0.00556893833f, 0.81313324f},
-std::array<float,2>{0.73644644f, 0.304671764f},
-std::array<float,2>{0.33618328f, 0.196892157f},
-std::array<float,2>{0.881302774f, 0.704045951f},
-std::array<float,2>{0.447842717f, 0.501585364f},
-std::array<float,2>{0.76661545f, 0.0185875576f},
-std::array<float,2>{0.249538764f, 0.417893469f},
-std::array<float,2>{0.571952939f, 0.908456206f},
-std::array<float,2>{0.126221359f, 0.644933164f},
-std::array<float,2>{0.526500642f, 0.150534019f},
-std::array<float,2>{0.385006249f, 0.328752816f},
-std::array<float,2>{0.820094705f, 0.786710799f},
-std::array<float,2>{0.28469187f, 0.986222804f},
-std::array<float,2>{0.964654446f, 0.439398676f},
-std::array<float,2>{0.120758407f, 0.0890853107f},
-std::array<float,2>{0.645524561f, 0.564520478f},
-std::array<float,2>{0.204175502f, 0.896740317f},
-std::array<float,2>{0.613334417f, 0.400365889f},
-std::array<float,2>{0.46901834f, 0.0512865745f},
-std::array<float,2>{0.803816736f, 0.540680826f},
-std::array<float,2>{0.372172475f, 0.725422919f},
-std::array<float,2>{0.9265697f, 0.245416403f},
-std::array<float,2>{0.0320650302f, 0.250159442f},
-std::array<float,2>{0.695575476f, 0.868767858f},
-std::array<float,2>{0.0905825272f, 0.606823206f},
-std::array<float,2>{0.670425773f, 0.111110397f},
-std::array<float,2>{0.257618487f, 0.479587018f},
-std::array<float,2>{0.980647922f, 0.945413888f},
-std::array<float,2>{0.413414031f, 0.774753749f},
-std::array<float,2>{0.843970835f, 0.365788698f},
-std::array<float,2>{0.160282955f, 0.170151934f},
-std::array<float,2>{0.549184442f, 0.662604272f},
-std::array<float,2>{0.183627009f, 0.808304608f},
-std::array<float,2>{0.536608756f, 0.3169972f},
-std::array<float,2>{0.43106845f, 0.125207022f},
-std::array<float,2>{0.873211801f, 0.63577646f},
-std::array<float,2>{0.270056009f, 0.580979347f},
-std::array<float,2>{0.997586787f, 0.0723090395f},
-std::array<float,2>{0.0757567286f, 0.468584001f},
-std::array<float,2>{0.673497379f, 0.983252048f},
-std::array<float,2>{0.0529230386f, 0.702092588f},
-std::array<float,2>{0.707725883f, 0.211906806f},
-std::array<float,2>{0.352696091f, 0.282848507f},
-std::array<float,2>{0.910702169f, 0.835482299f},
-std::array<float,2>{0.497462392f, 0.930712938f},
-std::array<float,2>{0.790048838f, 0.434167981f},
-std::array<float,2>{0.192232102f, 0.00898312684f},
-std::array<float,2>{0.606871128f, 0.516546965f},
-std::array<float,2>{0.0957571417f, 0.960701823f},
-std::array<float,2>{0.634747207f, 0.495056093f},
-std::array<float,2>{0.311867267f, 0.109266564f},
-std::array<float,2>{0.9394719f, 0.617444098f},
-std::array<float,2>{0.404089481f, 0.672276258f},
-std::array<float,2>{0.8301512f, 0.171977416f},
-std::array<float,2>{0.144285783f, 0.35679397f},
-std::array<float,2>{0.511959314f, 0.765318811f},
-std::array<float,2>{0.231137827f, 0.559344232f},
-std::array<float,2>{0.578563094f, 0.0364019945f},
-std::array<float,2>{0.459382594f, 0.378336936f},
-std::array<float,2>{0.753982484f, 0.882516026f},
-std::array<float,2>{0.317311049f, 0.843828499f},
-std::array<float,2>{0.894831777f, 0.268240333f},
-std::array<float,2>{0.0309187341f, 0.224360079f},
-std::array<float,2>{0.730114639f, 0.74986577f},
-std::array<float,2>{0.063398771f, 0.751977682f},
-std::array<float,2>{0.684851646f, 0.351526231f},
-std::array<float,2>{0.273705512f, 0.180422813f},
-std::array<float,2>{0.98889327f, 0.685488164f},
-std::array<float,2>{0.428138196f, 0.611171305f},
-std::array<float,2>{0.866344452f, 0.0955518484f},
-std::array<float,2>{0.172512516f, 0.486243963f},
-std::array<float,2>{0.544978917f, 0.964185059f},
-std::array<float,2>{0.200100347f, 0.740457535f},
-std::array<float,2>{0.595575809f, 0.228237376f},
-std::array<float,2>{0.491816163f, 0.279777795f},
-std::array<float,2>{0.782974243f, 0.857339859f},
-std::array<float,2>{0.346550047f, 0.888949633f},
-std::array<float,2>{0.914319932f, 0.388300419f},
-std::array<float,2>{0.0615079179f, 0.045063857f},
-std::array<float,2>{0.711283207f, 0.550784171f},
-std::array<float,2>{0.152553365f, 0.97114557f},
-std::array<float,2>{0.50443238f, 0.460197926f},
-std::array<float,2>{0.397607654f, 0.0646809712f},
-std::array<float,2>{0.841547668f, 0.588366091f},
-std::array<float,2>{0.304101408f, 0.630289674f},
-std::array<float,2>{0.949276209f, 0.140034452f},
-std::array<float,2>{0.109259583f, 0.325869948f},
-std::array<float,2>{0.630170226f, 0.804413378f},
-std::array<float,2>{0.0186945107f, 0.527112544f},
-std::array<float,2>{0.723930478f, 0.00739650475f},
-std::array<float,2>{0.326897681f, 0.42426309f},
-std::array<float,2>{0.903256059f, 0.925021172f},
-std::array<float,2>{0.463163078f, 0.842358112f},
-std::array<float,2>{0.759674549f, 0.292568892f},
-std::array<float,2>{0.224081501f, 0.208760455f},
-std::array<float,2>{0.593711913f, 0.689391911f},
-std::array<float,2>{0.237894028f, 0.859801054f},
-std::array<float,2>{0.567045867f, 0.262164444f},
-std::array<float,2>{0.442023396f, 0.238812134f},
-std::array<float,2>{0.77514261f, 0.730243683f},
-std::array<float,2>{0.333640456f, 0.538639188f},
-std::array<float,2>{0.883325517f, 0.0598496087f},
-std::array<float,2>{0.0122003648f, 0.394330025f},
-std::array<float,2>{0.748015881f, 0.899005353f},
-std::array<float,2>{0.114807211f, 0.670217395f},
-std::array<float,2>{0.655845225f, 0.162098736f},
-std::array<float,2>{0.29578498f, 0.367281854f},
-std::array<float,2>{0.956350923f, 0.77228415f},
-std::array<float,2>{0.379490733f, 0.944680631f},
-std::array<float,2>{0.824460626f, 0.470166802f},
-std::array<float,2>{0.133943439f, 0.12137761f},
-std::array<float,2>{0.523337722f, 0.59654212f},
-std::array<float,2>{0.0409092158f, 0.915732861f},
-std::array<float,2>{0.688156307f, 0.411964297f},
-std::array<float,2>{0.366191179f, 0.0239958931f},
-std::array<float,2>{0.93143785f, 0.509356201f},
-std::array<float,2>{0.481535971f, 0.716041744f},
-std::array<float,2>{0.810074985f, 0.191833153f},
-std::array<float,2>{0.213274628f, 0.310810208f},
-std::array<float,2>{0.624245048f, 0.824621499f},
-std::array<float,2>{0.170034871f, 0.572916031f},
-std::array<float,2>{0.560367167f, 0.0852530301f},
-std::array<float,2>{0.421418607f, 0.451430589f},
-std::array<float,2>{0.857582986f, 0.999136388f},
-std::array<float,2>{0.264728695f, 0.792602479f},
-std::array<float,2>{0.968985438f, 0.341490269f},
-std::array<float,2>{0.0795795918f, 0.144454449f},
-std::array<float,2>{0.66137296f, 0.649946094f},
-std::array<float,2>{0.0554271415f, 0.783837616f},
-std::array<float,2>{0.714878023f, 0.334551096f},
-std::array<float,2>{0.349978596f, 0.154639915f},
-std::array<float,2>{0.918367803f, 0.643504381f},
-std::array<float,2>{0.48634702f, 0.569104075f},
-std::array<float,2>{0.787502229f, 0.0916919187f},
-std::array<float,2>{0.198204413f, 0.444311261f},
-std::array<float,2>{0.600634634f, 0.990553319f},
-std::array<float,2>{0.179558367f, 0.710075617f},
-std::array<float,2>{0.540837407f, 0.200681224f},
-std::array<float,2>{0.422647238f, 0.299452394f},
-std::array<float,2>{0.861430824f, 0.816561043f},
-std::array<float,2>{0.278699934f, 0.910472751f},
-std::array<float,2>{0.987360835f, 0.42015034f},
-std::array<float,2>{0.0697848052f, 0.0234070662f},
-std::array<float,2>{0.681995273f, 0.503955185f},
-std::array<float,2>{0.221012756f, 0.952668846f},
-std::array<float,2>{0.585965872f, 0.480628252f},
-std::array<float,2>{0.466860175f, 0.115359448f},
-std::array<float,2>{0.764288485f, 0.60221678f},
-std::array<float,2>{0.323996753f, 0.656695485f},
-std::array<float,2>{0.89989084f, 0.165042073f},
-std::array<float,2>{0.0206352212f, 0.359470248f},
-std::array<float,2>{0.720190883f, 0.781044483f},
-std::array<float,2>{0.104033872f, 0.543283284f},
-std::array<float,2>{0.628500998f, 0.0505081192f},
-std::array<float,2>{0.297189146f, 0.405953884f},
-std::array<float,2>{0.947853506f, 0.892343581f},
-std::array<float,2>{0.393975198f, 0.873739183f},
-std::array<float,2>{0.837868154f, 0.256292969f},
-std::array<float,2>{0.149529248f, 0.249496907f},
-std::array<float,2>{0.500684202f, 0.720738947f},
-std::array<float,2>{0.140237793f, 0.830067813f},
-std::array<float,2>{0.516375482f, 0.285289526f},
-std::array<float,2>{0.377694458f, 0.216231272f},
-std::array<float,2>{0.820607781f, 0.696612597f},
-std::array<float,2>{0.291126817f, 0.520914853f},
-std::array<float,2>{0.95941931f, 0.0128654046f},
-std::array<float,2>{0.110734746f, 0.43084991f},
-std::array<float,2>{0.651330471f, 0.933818042f},
-std::array<float,2>{0.00821679831f, 0.640508235f},
-std::array<float,2>{0.74331063f, 0.132017866f},
-std::array<float,2>{0.329605937f, 0.315762579f},
-std::array<float,2>{0.889709532f, 0.809685946f},
-std::array<float,2>{0.437521517f, 0.979187429f},
-std::array<float,2>{0.777765214f, 0.461510509f},
-std::array<float,2>{0.239779055f, 0.0767344981f},
-std::array<float,2>{0.564844131f, 0.582190156f},
-std::array<float,2>{0.0859257206f, 0.877954423f},
-std::array<float,2>{0.658311248f, 0.38208589f},
-std::array<float,2>{0.261662185f, 0.0321009085f},
-std::array<float,2>{0.976365983f, 0.555404007f},
-std::array<float,2>{0.416253418f, 0.745466769f},
-std::array<float,2>{0.852738202f, 0.221422568f},
-std::array<float,2>{0.167808622f, 0.27131778f},
-std::array<float,2>{0.558457494f, 0.850626886f},
-std::array<float,2>{0.218434393f, 0.62201637f},
-std::array<float,2>{0.617357016f, 0.104846403f},
-std::array<float,2>{0.47990343f, 0.498957813f},
-std::array<float,2>{0.805857956f, 0.955886781f},
-std::array<float,2>{0.360988021f, 0.761690736f},
-std::array<float,2>{0.935001194f, 0.353062689f},
-std::array<float,2>{0.043754153f, 0.179293603f},
-std::array<float,2>{0.693170786f, 0.678411424f},
-std::array<float,2>{0.124926955f, 0.852404833f},
-std::array<float,2>{0.64096576f, 0.276596218f},
-std::array<float,2>{0.287723124f, 0.231452197f},
-std::array<float,2>{0.968667984f, 0.738189042f},
-std::array<float,2>{0.388202131f, 0.549657464f},
-std::array<float,2>{0.812960029f, 0.0395576283f},
-std::array<float,2>{0.132730484f, 0.386232436f},
-std::array<float,2>{0.527542651f, 0.885949433f},
-std::array<float,2>{0.242228791f, 0.681148767f},
-std::array<float,2>{0.574600995f, 0.184321538f},
-std::array<float,2>{0.451946288f, 0.347523659f},
-std::array<float,2>{0.771360457f, 0.755599558f},
-std::array<float,2>{0.341677368f, 0.968039453f},
-std::array<float,2>{0.876137853f, 0.489500731f},
-std::array<float,2>{0.00091294531f, 0.10081324f},
-std::array<float,2>{0.740535676f, 0.61575532f},
-std::array<float,2>{0.157538652f, 0.929374039f},
-std::array<float,2>{0.552108705f, 0.427055031f},
-std::array<float,2>{0.408372372f, 0.00301439245f},
-std::array<float,2>{0.850815773f, 0.527836561f},
-std::array<float,2>{0.251303732f, 0.691409767f},
-std::array<float,2>{0.979270697f, 0.203942701f},
-std::array<float,2>{0.0862730742f, 0.294650018f},
-std::array<float,2>{0.665317178f, 0.836066723f},
-std::array<float,2>{0.0356444791f, 0.592551053f},
-std::array<float,2>{0.701633871f, 0.0670372024f},
-std::array<float,2>{0.369293332f, 0.455169588f},
-std::array<float,2>{0.925630093f, 0.9732638f},
-std::array<float,2>{0.473299891f, 0.799241662f},
-std::array<float,2>{0.798160255f, 0.321514308f},
-std::array<float,2>{0.209273517f, 0.133863375f},
-std::array<float,2>{0.609935701f, 0.626756549f},
-std::array<float,2>{0.190014765f, 0.768271506f},
-std::array<float,2>{0.603336871f, 0.373099834f},
-std::array<float,2>{0.495126069f, 0.158182204f},
-std::array<float,2>{0.792998433f, 0.6663692f},
-std::array<float,2>{0.358126312f, 0.598586142f},
-std::array<float,2>{0.91012311f, 0.119164385f},
-std::array<float,2>{0.0505708829f, 0.47532922f},
-std::array<float,2>{0.703519285f, 0.938426375f},
-std::array<float,2>{0.0707072765f, 0.732844412f},
-std::array<float,2>{0.676613271f, 0.237370551f},
-std::array<float,2>{0.266768306f, 0.258059472f},
-std::array<float,2>{0.995833218f, 0.866150796f},
-std::array<float,2>{0.436351269f, 0.903871536f},
-std::array<float,2>{0.868488491f, 0.396098465f},
-std::array<float,2>{0.18268466f, 0.0576290339f},
-std::array<float,2>{0.534093738f, 0.533405721f},
-std::array<float,2>{0.0254763886f, 0.992518425f},
-std::array<float,2>{0.730813324f, 0.447756439f},
-std::array<float,2>{0.316270888f, 0.079965651f},
-std::array<float,2>{0.892654359f, 0.575501621f},
-std::array<float,2>{0.456035972f, 0.653354287f},
-std::array<float,2>{0.753292561f, 0.14634043f},
-std::array<float,2>{0.229866207f, 0.337035537f},
-std::array<float,2>{0.585795462f, 0.796332181f},
-std::array<float,2>{0.147701085f, 0.515564561f},
-std::array<float,2>{0.508592486f, 0.0289242323f},
-std::array<float,2>{0.400176585f, 0.409000546f},
-std::array<float,2>{0.835564137f, 0.920250654f},
-std::array<float,2>{0.305106729f, 0.820326269f},
-std::array<float,2>{0.942165256f, 0.30536142f},
-std::array<float,2>{0.0995724201f, 0.190620512f},
-std::array<float,2>{0.6399827f, 0.711990476f},
-std::array<float,2>{0.0338495336f, 0.869203687f},
-std::array<float,2>{0.69764024f, 0.252273709f},
-std::array<float,2>{0.374653459f, 0.243832335f},
-std::array<float,2>{0.929139972f, 0.724055588f},
-std::array<float,2>{0.472247511f, 0.541953385f},
-std::array<float,2>{0.80220598f, 0.0531460531f},
-std::array<float,2>{0.205343753f, 0.400737375f},
-std::array<float,2>{0.616855323f, 0.895536959f},
-std::array<float,2>{0.162349075f, 0.662065744f},
-std::array<float,2>{0.548490047f, 0.169920772f},
-std::array<float,2>{0.412087113f, 0.364452928f},
-std::array<float,2>{0.847103834f, 0.776541948f},
-std::array<float,2>{0.254202485f, 0.947521865f},
-std::array<float,2>{0.983179033f, 0.477984101f},
-std::array<float,2>{0.0929119736f, 0.112485223f},
-std::array<float,2>{0.669173479f, 0.608709753f},
-std::array<float,2>{0.246919587f, 0.906449437f},
-std::array<float,2>{0.572899699f, 0.414409578f},
-std::array<float,2>{0.446885854f, 0.0158367343f},
-std::array<float,2>{0.767580748f, 0.50247246f},
-std::array<float,2>{0.338487297f, 0.705658972f},
-std::array<float,2>{0.879622161f, 0.198452994f},
-std::array<float,2>{0.0074712229f, 0.30233866f},
-std::array<float,2>{0.735381126f, 0.815492511f},
-std::array<float,2>{0.118015915f, 0.563469589f},
-std::array<float,2>{0.64702189f, 0.0865894333f},
-std::array<float,2>{0.281551301f, 0.441282302f},
-std::array<float,2>{0.961910129f, 0.988238752f},
-std::array<float,2>{0.383993924f, 0.788427949f},
-std::array<float,2>{0.816471636f, 0.33053562f},
-std::array<float,2>{0.127218321f, 0.149235919f},
-std::array<float,2>{0.523464859f, 0.647084057f},
-std::array<float,2>{0.140829504f, 0.763655484f},
-std::array<float,2>{0.51475358f, 0.358624101f},
-std::array<float,2>{0.404968411f, 0.173923492f},
-std::array<float,2>{0.828641295f, 0.674379528f},
-std::array<float,2>{0.308607697f, 0.619482934f},
-std::array<float,2>{0.938674867f, 0.105470419f},
-std::array<float,2>{0.0945245102f, 0.492674977f},
-std::array<float,2>{0.635191619f, 0.957960606f},
-std::array<float,2>{0.0283499025f, 0.747919321f},
-std::array<float,2>{0.727523565f, 0.225923866f},
-std::array<float,2>{0.318890572f, 0.266761601f},
-std::array<float,2>{0.896686196f, 0.846312761f},
-std::array<float,2>{0.458725005f, 0.880267143f},
-std::array<float,2>{0.756849766f, 0.375035912f},
-std::array<float,2>{0.234249264f, 0.0387180634f},
-std::array<float,2>{0.580570221f, 0.561489105f},
-std::array<float,2>{0.0766873881f, 0.981259942f},
-std::array<float,2>{0.675373971f, 0.466423899f},
-std::array<float,2>{0.272256643f, 0.0707537681f},
-std::array<float,2>{0.999386847f, 0.578326046f},
-std::array<float,2>{0.432800144f, 0.634371698f},
-std::array<float,2>{0.872527063f, 0.128447264f},
-std::array<float,2>{0.18593581f, 0.319494367f},
-std::array<float,2>{0.538520575f, 0.805799127f},
-std::array<float,2>{0.194955409f, 0.517848074f},
-std::array<float,2>{0.609106362f, 0.010057834f},
-std::array<float,2>{0.498963177f, 0.435848057f},
-std::array<float,2>{0.792322934f, 0.932065964f},
-std::array<float,2>{0.353781462f, 0.832942843f},
-std::array<float,2>{0.912796974f, 0.283218205f},
-std::array<float,2>{0.0513377786f, 0.214457318f},
-std::array<float,2>{0.709681988f, 0.699255049f},
-std::array<float,2>{0.105498962f, 0.802564263f},
-std::array<float,2>{0.631102681f, 0.327182502f},
-std::array<float,2>{0.300828815f, 0.137243241f},
-std::array<float,2>{0.952624083f, 0.631551623f},
-std::array<float,2>{0.395408571f, 0.585963666f},
-std::array<float,2>{0.842746496f, 0.0639269799f},
-std::array<float,2>{0.154478043f, 0.457106143f},
-std::array<float,2>{0.507254899f, 0.969792545f},
-std::array<float,2>{0.226522103f, 0.689724386f},
-std::array<float,2>{0.590735853f, 0.210414931f},
-std::array<float,2>{0.461975336f, 0.290397316f},
-std::array<float,2>{0.760108113f, 0.841026843f},
-std::array<float,2>{0.324426591f, 0.923386157f},
-std::array<float,2>{0.906161308f, 0.422875255f},
-std::array<float,2>{0.0163162779f, 0.00515460968f},
-std::array<float,2>{0.724993527f, 0.524742186f},
-std::array<float,2>{0.174974784f, 0.961916924f},
-std::array<float,2>{0.543956339f, 0.487151444f},
-std::array<float,2>{0.42643401f, 0.0972454548f},
-std::array<float,2>{0.865154982f, 0.611629188f},
-std::array<float,2>{0.275884211f, 0.686802685f},
-std::array<float,2>{0.991516948f, 0.18313916f},
-std::array<float,2>{0.0649858639f, 0.347688466f},
-std::array<float,2>{0.685997128f, 0.751754284f},
-std::array<float,2>{0.0590616651f, 0.553951979f},
-std::array<float,2>{0.71329242f, 0.0438187867f},
-std::array<float,2>{0.344696611f, 0.390460789f},
-std::array<float,2>{0.916209698f, 0.888608396f},
-std::array<float,2>{0.489895254f, 0.859253943f},
-std::array<float,2>{0.784665704f, 0.279223412f},
-std::array<float,2>{0.201769173f, 0.229205608f},
-std::array<float,2>{0.59642458f, 0.738568306f},
-std::array<float,2>{0.212129802f, 0.827690661f},
-std::array<float,2>{0.622795463f, 0.309871823f},
-std::array<float,2>{0.484074563f, 0.193855807f},
-std::array<float,2>{0.810556889f, 0.716819227f},
-std::array<float,2>{0.364702404f, 0.511145949f},
-std::array<float,2>{0.932328641f, 0.0254995022f},
-std::array<float,2>{0.0422135219f, 0.413766354f},
-std::array<float,2>{0.689526379f, 0.916515768f},
-std::array<float,2>{0.0811719224f, 0.650690317f},
-std::array<float,2>{0.66297543f, 0.141598478f},
-std::array<float,2>{0.263338685f, 0.341913819f},
-std::array<float,2>{0.971195638f, 0.790301502f},
-std::array<float,2>{0.419699103f, 0.996366203f},
-std::array<float,2>{0.855632901f, 0.449294418f},
-std::array<float,2>{0.169375777f, 0.0821204036f},
-std::array<float,2>{0.561813474f, 0.571792781f},
-std::array<float,2>{0.0150479302f, 0.901177287f},
-std::array<float,2>{0.749055862f, 0.392517388f},
-std::array<float,2>{0.334241539f, 0.0611606576f},
-std::array<float,2>{0.88537091f, 0.536396086f},
-std::array<float,2>{0.443695158f, 0.728083193f},
-std::array<float,2>{0.775565505f, 0.24095808f},
-std::array<float,2>{0.234654665f, 0.264488816f},
-std::array<float,2>{0.568912327f, 0.862416029f},
-std::array<float,2>{0.136691973f, 0.59547627f},
-std::array<float,2>{0.520558476f, 0.123877928f},
-std::array<float,2>{0.381918103f, 0.471802831f},
-std::array<float,2>{0.826995671f, 0.941427529f},
-std::array<float,2>{0.293345809f, 0.770122588f},
-std::array<float,2>{0.953768492f, 0.369192988f},
-std::array<float,2>{0.115706041f, 0.162756205f},
-std::array<float,2>{0.653460324f, 0.669634044f},
-std::array<float,2>{0.02313306f, 0.777601063f},
-std::array<float,2>{0.722534478f, 0.362549186f},
-std::array<float,2>{0.321805716f, 0.166128054f},
-std::array<float,2>{0.901878178f, 0.659389257f},
-std::array<float,2>{0.465852678f, 0.604883075f},
-std::array<float,2>{0.762940705f, 0.114378884f},
-std::array<float,2>{0.21965304f, 0.483331382f},
-std::array<float,2>{0.588507056f, 0.950374365f},
-std::array<float,2>{0.151565164f, 0.719198048f},
-std::array<float,2>{0.502877116f, 0.247314706f},
-std::array<float,2>{0.39205569f, 0.255010933f},
-std::array<float,2>{0.839577675f, 0.872566819f},
-std::array<float,2>{0.300768167f, 0.893956423f},
-std::array<float,2>{0.946007669f, 0.40397647f},
-std::array<float,2>{0.103016227f, 0.047335811f},
-std::array<float,2>{0.626510799f, 0.545619905f},
-std::array<float,2>{0.195415676f, 0.989075959f},
-std::array<float,2>{0.598676443f, 0.442398876f},
-std::array<float,2>{0.485379457f, 0.0929966718f},
-std::array<float,2>{0.786024094f, 0.566907704f},
-std::array<float,2>{0.349378198f, 0.641562283f},
-std::array<float,2>{0.920101821f, 0.153773323f},
-std::array<float,2>{0.0570927896f, 0.333222032f},
-std::array<float,2>{0.717051208f, 0.781691313f},
-std::array<float,2>{0.0682108253f, 0.506485343f},
-std::array<float,2>{0.681602597f, 0.0214204844f},
-std::array<float,2>{0.27944991f, 0.419123739f},
-std::array<float,2>{0.985051453f, 0.913284957f},
-std::array<float,2>{0.424762726f, 0.818898141f},
-std::array<float,2>{0.861171961f, 0.298578948f},
-std::array<float,2>{0.177278593f, 0.202859655f},
-std::array<float,2>{0.542044818f, 0.708290875f},
-std::array<float,2>{0.165846124f, 0.848665833f},
-std::array<float,2>{0.555396616f, 0.273362905f},
-std::array<float,2>{0.414364457f, 0.218878821f},
-std::array<float,2>{0.853892744f, 0.742713273f},
-std::array<float,2>{0.259191424f, 0.558048368f},
-std::array<float,2>{0.974039674f, 0.0347186178f},
-std::array<float,2>{0.0828584358f, 0.380843163f},
-std::array<float,2>{0.656876802f, 0.87501359f},
-std::array<float,2>{0.0462741628f, 0.677095115f},
-std::array<float,2>{0.693711758f, 0.177691072f},
-std::array<float,2>{0.362049192f, 0.354890883f},
-std::array<float,2>{0.936221421f, 0.758229136f},
-std::array<float,2>{0.478139043f, 0.954768658f},
-std::array<float,2>{0.808593035f, 0.497412294f},
-std::array<float,2>{0.21531862f, 0.10177549f},
-std::array<float,2>{0.62018615f, 0.624269485f},
-std::array<float,2>{0.111366451f, 0.937053084f},
-std::array<float,2>{0.65029943f, 0.431860477f},
-std::array<float,2>{0.289871037f, 0.0149590932f},
-std::array<float,2>{0.957143366f, 0.523294866f},
-std::array<float,2>{0.376618624f, 0.697743833f},
-std::array<float,2>{0.8223508f, 0.218511194f},
-std::array<float,2>{0.138583779f, 0.288136631f},
-std::array<float,2>{0.517769933f, 0.831044436f},
-std::array<float,2>{0.242101058f, 0.585144937f},
-std::array<float,2>{0.5625453f, 0.0749831125f},
-std::array<float,2>{0.440104187f, 0.463295937f},
-std::array<float,2>{0.781004786f, 0.976629317f},
-std::array<float,2>{0.331783623f, 0.811323106f},
-std::array<float,2>{0.887680054f, 0.313059777f},
-std::array<float,2>{0.0111083342f, 0.129224181f},
-std::array<float,2>{0.744234443f, 0.636974812f},
-std::array<float,2>{0.089370206f, 0.83858943f},
-std::array<float,2>{0.666941702f, 0.295214593f},
-std::array<float,2>{0.25367558f, 0.206960782f},
-std::array<float,2>{0.976893008f, 0.694339097f},
-std::array<float,2>{0.406513751f, 0.53044039f},
-std::array<float,2>{0.849458277f, 0.000855091785f},
-std::array<float,2>{0.159074068f, 0.42941463f},
-std::array<float,2>{0.553221226f, 0.927576005f},
-std::array<float,2>{0.207508564f, 0.627875447f},
-std::array<float,2>{0.611602306f, 0.136377946f},
-std::array<float,2>{0.475884438f, 0.323208302f},
-std::array<float,2>{0.799059331f, 0.798817098f},
-std::array<float,2>{0.367345423f, 0.975848794f},
-std::array<float,2>{0.922398627f, 0.45429343f},
-std::array<float,2>{0.037516214f, 0.0702303499f},
-std::array<float,2>{0.70107007f, 0.591514468f},
-std::array<float,2>{0.129500717f, 0.883712769f},
-std::array<float,2>{0.530200958f, 0.384076774f},
-std::array<float,2>{0.390036911f, 0.0415594243f},
-std::array<float,2>{0.8147645f, 0.548716664f},
-std::array<float,2>{0.28600505f, 0.736028016f},
-std::array<float,2>{0.965522408f, 0.233485386f},
-std::array<float,2>{0.121457472f, 0.275374383f},
-std::array<float,2>{0.642638326f, 0.85443759f},
-std::array<float,2>{0.00307924789f, 0.613883674f},
-std::array<float,2>{0.738885462f, 0.098146379f},
-std::array<float,2>{0.341959357f, 0.491452605f},
-std::array<float,2>{0.878618777f, 0.96585238f},
-std::array<float,2>{0.450163335f, 0.756403685f},
-std::array<float,2>{0.773025334f, 0.345257074f},
-std::array<float,2>{0.244170547f, 0.187117621f},
-std::array<float,2>{0.57739377f, 0.683374524f},
-std::array<float,2>{0.227342814f, 0.794146001f},
-std::array<float,2>{0.582624018f, 0.339509279f},
-std::array<float,2>{0.454504162f, 0.147760496f},
-std::array<float,2>{0.751752913f, 0.655761838f},
-std::array<float,2>{0.313634485f, 0.577301383f},
-std::array<float,2>{0.890950441f, 0.0809611455f},
-std::array<float,2>{0.0253288522f, 0.446385682f},
-std::array<float,2>{0.73359406f, 0.995994627f},
-std::array<float,2>{0.0997342914f, 0.714268744f},
-std::array<float,2>{0.636722207f, 0.18803139f},
-std::array<float,2>{0.307594448f, 0.307363361f},
-std::array<float,2>{0.943978727f, 0.822422206f},
-std::array<float,2>{0.401078194f, 0.919770718f},
-std::array<float,2>{0.832634687f, 0.407256246f},
-std::array<float,2>{0.144733578f, 0.0293309316f},
-std::array<float,2>{0.510734677f, 0.512958765f},
-std::array<float,2>{0.0481649525f, 0.941184521f},
-std::array<float,2>{0.706118345f, 0.473597288f},
-std::array<float,2>{0.356083423f, 0.11730697f},
-std::array<float,2>{0.907232881f, 0.600023448f},
-std::array<float,2>{0.492688596f, 0.665718913f},
-std::array<float,2>{0.796033919f, 0.159919932f},
-std::array<float,2>{0.187895343f, 0.371647775f},
-std::array<float,2>{0.605296373f, 0.767334938f},
-std::array<float,2>{0.181275189f, 0.532560229f},
-std::array<float,2>{0.532855451f, 0.0564812012f},
-std::array<float,2>{0.434521943f, 0.39707163f},
-std::array<float,2>{0.870424032f, 0.905542314f},
-std::array<float,2>{0.26950565f, 0.864659667f},
-std::array<float,2>{0.993072212f, 0.260941595f},
-std::array<float,2>{0.0737374723f, 0.234878868f},
-std::array<float,2>{0.67876482f, 0.730690658f},
-std::array<float,2>{0.0371820629f, 0.837439239f},
-std::array<float,2>{0.700828373f, 0.293001622f},
-std::array<float,2>{0.367560863f, 0.20461154f},
-std::array<float,2>{0.922781706f, 0.692724347f},
-std::array<float,2>{0.475599408f, 0.528394699f},
-std::array<float,2>{0.799105823f, 0.00278583774f},
-std::array<float,2>{0.207064033f, 0.426399559f},
-std::array<float,2>{0.611554801f, 0.927822828f},
-std::array<float,2>{0.158727974f, 0.625206947f},
-std::array<float,2>{0.552908778f, 0.133524284f},
-std::array<float,2>{0.406475842f, 0.32049787f},
-std::array<float,2>{0.849300206f, 0.80051595f},
-std::array<float,2>{0.253532112f, 0.974294543f},
-std::array<float,2>{0.976579785f, 0.45665288f},
-std::array<float,2>{0.0896111801f, 0.0681865662f},
-std::array<float,2>{0.666603863f, 0.592880964f},
-std::array<float,2>{0.244572982f, 0.884779572f},
-std::array<float,2>{0.577156007f, 0.385573447f},
-std::array<float,2>{0.449900359f, 0.0409608446f},
-std::array<float,2>{0.773243845f, 0.550139189f},
-std::array<float,2>{0.342280209f, 0.737055004f},
-std::array<float,2>{0.878894687f, 0.230627254f},
-std::array<float,2>{0.00323766819f, 0.275796056f},
-std::array<float,2>{0.739251316f, 0.853309035f},
-std::array<float,2>{0.121189475f, 0.61703825f},
-std::array<float,2>{0.643006206f, 0.0996558517f},
-std::array<float,2>{0.285832286f, 0.489050031f},
-std::array<float,2>{0.965656996f, 0.966816902f},
-std::array<float,2>{0.389718652f, 0.754432082f},
-std::array<float,2>{0.814545155f, 0.346639603f},
-std::array<float,2>{0.129794121f, 0.1852943f},
-std::array<float,2>{0.529858351f, 0.679780662f},
-std::array<float,2>{0.14496012f, 0.795290709f},
-std::array<float,2>{0.510445476f, 0.336854845f},
-std::array<float,2>{0.401198387f, 0.14519155f},
-std::array<float,2>{0.832918346f, 0.653198779f},
-std::array<float,2>{0.307211518f, 0.574806452f},
-std::array<float,2>{0.944142282f, 0.0785326734f},
-std::array<float,2>{0.100021027f, 0.448462248f},
-std::array<float,2>{0.636994421f, 0.993620038f},
-std::array<float,2>{0.0251230802f, 0.711003184f},
-std::array<float,2>{0.73385483f, 0.19029437f},
-std::array<float,2>{0.313847125f, 0.305782199f},
-std::array<float,2>{0.890847683f, 0.821888685f},
-std::array<float,2>{0.454259127f, 0.920984983f},
-std::array<float,2>{0.751611054f, 0.410081536f},
-std::array<float,2>{0.227168784f, 0.0274095926f},
-std::array<float,2>{0.582851827f, 0.513776362f},
-std::array<float,2>{0.0741172805f, 0.939230919f},
-std::array<float,2>{0.678976715f, 0.476245403f},
-std::array<float,2>{0.26912564f, 0.121092364f},
-std::array<float,2>{0.992815495f, 0.599185109f},
-std::array<float,2>{0.434179932f, 0.667159677f},
-std::array<float,2>{0.870119274f, 0.157024145f},
-std::array<float,2>{0.181586683f, 0.374631554f},
-std::array<float,2>{0.533020318f, 0.768827021f},
-std::array<float,2>{0.187535957f, 0.534833252f},
-std::array<float,2>{0.605121017f, 0.0567702539f},
-std::array<float,2>{0.493050247f, 0.39537698f},
-std::array<float,2>{0.796297908f, 0.902654231f},
-std::array<float,2>{0.356402695f, 0.866883457f},
-std::array<float,2>{0.907698393f, 0.259429157f},
-std::array<float,2>{0.0479892194f, 0.236644983f},
-std::array<float,2>{0.706426084f, 0.734244764f},
-std::array<float,2>{0.102775656f, 0.779940009f},
-std::array<float,2>{0.626924992f, 0.360692978f},
-std::array<float,2>{0.300310403f, 0.164690122f},
-std::array<float,2>{0.946124434f, 0.657609046f},
-std::array<float,2>{0.391734272f, 0.603055179f},
-std::array<float,2>{0.839604974f, 0.116254859f},
-std::array<float,2>{0.151815221f, 0.481609225f},
-std::array<float,2>{0.502629876f, 0.952055812f},
-std::array<float,2>{0.219327122f, 0.721722126f},
-std::array<float,2>{0.588724434f, 0.249000266f},
-std::array<float,2>{0.466092229f, 0.257062227f},
-std::array<float,2>{0.762902558f, 0.874921262f},
-std::array<float,2>{0.322051346f, 0.891090333f},
-std::array<float,2>{0.902170479f, 0.404424042f},
-std::array<float,2>{0.0232165605f, 0.0496946201f},
-std::array<float,2>{0.722373605f, 0.544846535f},
-std::array<float,2>{0.177729532f, 0.99195981f},
-std::array<float,2>{0.542466879f, 0.445172459f},
-std::array<float,2>{0.42433691f, 0.0906355083f},
-std::array<float,2>{0.861032009f, 0.56989634f},
-std::array<float,2>{0.279760629f, 0.644277573f},
-std::array<float,2>{0.985118151f, 0.155914158f},
-std::array<float,2>{0.0680678114f, 0.335287094f},
-std::array<float,2>{0.681387842f, 0.784948468f},
-std::array<float,2>{0.0568162724f, 0.504988432f},
-std::array<float,2>{0.716868997f, 0.0223331414f},
-std::array<float,2>{0.3492136f, 0.421124488f},
-std::array<float,2>{0.920336485f, 0.91120249f},
-std::array<float,2>{0.485820711f, 0.81762284f},
-std::array<float,2>{0.785880804f, 0.299941927f},
-std::array<float,2>{0.19569774f, 0.200115442f},
-std::array<float,2>{0.599068224f, 0.709223568f},
-std::array<float,2>{0.214938447f, 0.849763989f},
-std::array<float,2>{0.620434582f, 0.270283878f},
-std::array<float,2>{0.478275329f, 0.222225666f},
-std::array<float,2>{0.808271646f, 0.744143426f},
-std::array<float,2>{0.362172961f, 0.555914223f},
-std::array<float,2>{0.936294436f, 0.0325087756f},
-std::array<float,2>{0.0459977835f, 0.381236345f},
-std::array<float,2>{0.693422556f, 0.877825558f},
-std::array<float,2>{0.0827347338f, 0.679195702f},
-std::array<float,2>{0.657017112f, 0.178529873f},
-std::array<float,2>{0.258896351f, 0.351964116f},
-std::array<float,2>{0.973694146f, 0.759859324f},
-std::array<float,2>{0.414287031f, 0.956516922f},
-std::array<float,2>{0.853563786f, 0.499028027f},
-std::array<float,2>{0.165618971f, 0.104232788f},
-std::array<float,2>{0.555600047f, 0.622711599f},
-std::array<float,2>{0.0108745145f, 0.935539424f},
-std::array<float,2>{0.744468927f, 0.430053771f},
-std::array<float,2>{0.3318654f, 0.0119384909f},
-std::array<float,2>{0.887251794f, 0.520320833f},
-std::array<float,2>{0.44022879f, 0.695367217f},
-std::array<float,2>{0.78103292f, 0.215334445f},
-std::array<float,2>{0.241846412f, 0.28624168f},
-std::array<float,2>{0.562888205f, 0.828896344f},
-std::array<float,2>{0.138414532f, 0.583618045f},
-std::array<float,2>{0.51782769f, 0.0779237077f},
-std::array<float,2>{0.376871437f, 0.462082744f},
-std::array<float,2>{0.822571456f, 0.979685962f},
-std::array<float,2>{0.289728403f, 0.809307277f},
-std::array<float,2>{0.95740366f, 0.31526202f},
-std::array<float,2>{0.11162927f, 0.131454512f},
-std::array<float,2>{0.649915278f, 0.638696074f},
-std::array<float,2>{0.016476877f, 0.802991033f},
-std::array<float,2>{0.724707425f, 0.325065166f},
-std::array<float,2>{0.324512452f, 0.139401302f},
-std::array<float,2>{0.905975997f, 0.629514754f},
-std::array<float,2>{0.462379605f, 0.589279711f},
-std::array<float,2>{0.759862602f, 0.0662639514f},
-std::array<float,2>{0.226317897f, 0.459086686f},
-std::array<float,2>{0.590402067f, 0.972511411f},
-std::array<float,2>{0.154781848f, 0.68817997f},
-std::array<float,2>{0.506906092f, 0.207097605f},
-std::array<float,2>{0.395041913f, 0.291979074f},
-std::array<float,2>{0.842518449f, 0.842944145f},
-std::array<float,2>{0.301209569f, 0.924757242f},
-std::array<float,2>{0.952180266f, 0.425210267f},
-std::array<float,2>{0.105866611f, 0.00621569203f},
-std::array<float,2>{0.631188154f, 0.525422037f},
-std::array<float,2>{0.202014565f, 0.963820457f},
-std::array<float,2>{0.596605122f, 0.485096842f},
-std::array<float,2>{0.490217179f, 0.0939364359f},
-std::array<float,2>{0.78440094f, 0.609983563f},
-std::array<float,2>{0.344377458f, 0.684076667f},
-std::array<float,2>{0.916461825f, 0.181377813f},
-std::array<float,2>{0.0587774441f, 0.349852264f},
-std::array<float,2>{0.712995708f, 0.752929866f},
-std::array<float,2>{0.0653241426f, 0.551862121f},
-std::array<float,2>{0.685564876f, 0.0462159663f},
-std::array<float,2>{0.276293665f, 0.387118459f},
-std::array<float,2>{0.991256773f, 0.889874399f},
-std::array<float,2>{0.426588625f, 0.856027722f},
-std::array<float,2>{0.864925146f, 0.281123161f},
-std::array<float,2>{0.175053656f, 0.226840347f},
-std::array<float,2>{0.544288933f, 0.741611779f},
-std::array<float,2>{0.168998227f, 0.825715542f},
-std::array<float,2>{0.561606586f, 0.311758786f},
-std::array<float,2>{0.419501275f, 0.193255976f},
-std::array<float,2>{0.855818987f, 0.714871049f},
-std::array<float,2>{0.263542235f, 0.50824219f},
-std::array<float,2>{0.971520603f, 0.0244715512f},
-std::array<float,2>{0.0813182443f, 0.410413593f},
-std::array<float,2>{0.662694573f, 0.914371967f},
-std::array<float,2>{0.0422736369f, 0.64854604f},
-std::array<float,2>{0.689891219f, 0.143182725f},
-std::array<float,2>{0.364325553f, 0.340031415f},
-std::array<float,2>{0.932477951f, 0.791252851f},
-std::array<float,2>{0.484293908f, 0.998489618f},
-std::array<float,2>{0.810994148f, 0.453070164f},
-std::array<float,2>{0.212340713f, 0.0841864198f},
-std::array<float,2>{0.622916162f, 0.573597431f},
-std::array<float,2>{0.115415499f, 0.900234759f},
-std::array<float,2>{0.653719902f, 0.392604858f},
-std::array<float,2>{0.293167472f, 0.0594373681f},
-std::array<float,2>{0.954036057f, 0.537778139f},
-std::array<float,2>{0.382293344f, 0.729195416f},
-std::array<float,2>{0.826670706f, 0.239405677f},
-std::array<float,2>{0.136350244f, 0.262836546f},
-std::array<float,2>{0.520990551f, 0.860418677f},
-std::array<float,2>{0.234519139f, 0.597353339f},
-std::array<float,2>{0.569318593f, 0.122223422f},
-std::array<float,2>{0.443362445f, 0.469324678f},
-std::array<float,2>{0.775651157f, 0.943529189f},
-std::array<float,2>{0.334121138f, 0.772853017f},
-std::array<float,2>{0.88552618f, 0.368927538f},
-std::array<float,2>{0.0147566209f, 0.160451651f},
-std::array<float,2>{0.749289334f, 0.671344697f},
-std::array<float,2>{0.0930240676f, 0.867372572f},
-std::array<float,2>{0.66941154f, 0.251642078f},
-std::array<float,2>{0.253982335f, 0.244654909f},
-std::array<float,2>{0.982973397f, 0.726539075f},
-std::array<float,2>{0.411851078f, 0.539915264f},
-std::array<float,2>{0.846802115f, 0.0521954075f},
-std::array<float,2>{0.162566543f, 0.39873752f},
-std::array<float,2>{0.548815787f, 0.898404598f},
-std::array<float,2>{0.205274269f, 0.663466513f},
-std::array<float,2>{0.617013752f, 0.171655744f},
-std::array<float,2>{0.472459912f, 0.366838306f},
-std::array<float,2>{0.801956058f, 0.77355808f},
-std::array<float,2>{0.374906868f, 0.946602106f},
-std::array<float,2>{0.92885983f, 0.478729218f},
-std::array<float,2>{0.0341769978f, 0.109836228f},
-std::array<float,2>{0.697300851f, 0.606157839f},
-std::array<float,2>{0.126959607f, 0.910102129f},
-std::array<float,2>{0.523718059f, 0.41692856f},
-std::array<float,2>{0.384236425f, 0.0184815452f},
-std::array<float,2>{0.816811204f, 0.500953257f},
-std::array<float,2>{0.281395167f, 0.704717159f},
-std::array<float,2>{0.961447179f, 0.196160465f},
-std::array<float,2>{0.117862649f, 0.302836061f},
-std::array<float,2>{0.647236526f, 0.813482225f},
-std::array<float,2>{0.00760353217f, 0.566034377f},
-std::array<float,2>{0.735806406f, 0.088511996f},
-std::array<float,2>{0.338852733f, 0.438257098f},
-std::array<float,2>{0.879692972f, 0.985165536f},
-std::array<float,2>{0.447232366f, 0.785396874f},
-std::array<float,2>{0.76787895f, 0.329233795f},
-std::array<float,2>{0.246751323f, 0.151699707f},
-std::array<float,2>{0.573234916f, 0.646177411f},
-std::array<float,2>{0.233932346f, 0.76402843f},
-std::array<float,2>{0.58093363f, 0.355598986f},
-std::array<float,2>{0.458918512f, 0.173613325f},
-std::array<float,2>{0.75709337f, 0.67368561f},
-std::array<float,2>{0.319323331f, 0.618969142f},
-std::array<float,2>{0.896823227f, 0.108068056f},
-std::array<float,2>{0.0286691375f, 0.496090114f},
-std::array<float,2>{0.727154434f, 0.959718645f},
-std::array<float,2>{0.0943638757f, 0.748958528f},
-std::array<float,2>{0.634782255f, 0.22362797f},
-std::array<float,2>{0.30889672f, 0.269260734f},
-std::array<float,2>{0.938962758f, 0.845558465f},
-std::array<float,2>{0.405221343f, 0.881790459f},
-std::array<float,2>{0.829070807f, 0.377367139f},
-std::array<float,2>{0.14102985f, 0.0358122997f},
-std::array<float,2>{0.514894545f, 0.560110986f},
-std::array<float,2>{0.0517328382f, 0.984092116f},
-std::array<float,2>{0.709796667f, 0.467288554f},
-std::array<float,2>{0.353628546f, 0.0735956281f},
-std::array<float,2>{0.913020372f, 0.581302643f},
-std::array<float,2>{0.498552114f, 0.635496497f},
-std::array<float,2>{0.7921983f, 0.126177743f},
-std::array<float,2>{0.195219398f, 0.318068117f},
-std::array<float,2>{0.609364331f, 0.806840658f},
-std::array<float,2>{0.185614064f, 0.517327845f},
-std::array<float,2>{0.538163722f, 0.00787499454f},
-std::array<float,2>{0.432980895f, 0.435076386f},
-std::array<float,2>{0.872098207f, 0.929853976f},
-std::array<float,2>{0.272127092f, 0.834748149f},
-std::array<float,2>{0.999179065f, 0.281768501f},
-std::array<float,2>{0.0769134685f, 0.212393478f},
-std::array<float,2>{0.675696731f, 0.702462971f},
-std::array<float,2>{0.000699666329f, 0.854869664f},
-std::array<float,2>{0.740463734f, 0.273601443f},
-std::array<float,2>{0.341465563f, 0.233191594f},
-std::array<float,2>{0.876259804f, 0.734624863f},
-std::array<float,2>{0.451725543f, 0.547391534f},
-std::array<float,2>{0.771064401f, 0.0427941196f},
-std::array<float,2>{0.242436856f, 0.383752823f},
-std::array<float,2>{0.574310303f, 0.88448143f},
-std::array<float,2>{0.132415161f, 0.682047546f},
-std::array<float,2>{0.527804375f, 0.186459184f},
-std::array<float,2>{0.388550401f, 0.344409615f},
-std::array<float,2>{0.812703907f, 0.757023931f},
-std::array<float,2>{0.287991911f, 0.965523005f},
-std::array<float,2>{0.968330443f, 0.491147876f},
-std::array<float,2>{0.124575496f, 0.0995916724f},
-std::array<float,2>{0.640705526f, 0.614361286f},
-std::array<float,2>{0.209113494f, 0.926392376f},
-std::array<float,2>{0.610167861f, 0.427943617f},
-std::array<float,2>{0.473484278f, 0.00123729079f},
-std::array<float,2>{0.797926664f, 0.529363811f},
-std::array<float,2>{0.369493693f, 0.693575799f},
-std::array<float,2>{0.925519407f, 0.205667317f},
-std::array<float,2>{0.0351958871f, 0.296238214f},
-std::array<float,2>{0.701346934f, 0.839359045f},
-std::array<float,2>{0.0861685425f, 0.59052068f},
-std::array<float,2>{0.66519326f, 0.0687467083f},
-std::array<float,2>{0.251075178f, 0.453498125f},
-std::array<float,2>{0.979038894f, 0.975203037f},
-std::array<float,2>{0.40849033f, 0.796934724f},
-std::array<float,2>{0.850994706f, 0.324088007f},
-std::array<float,2>{0.157453328f, 0.135440916f},
-std::array<float,2>{0.551964045f, 0.628493369f},
-std::array<float,2>{0.182862014f, 0.76576966f},
-std::array<float,2>{0.533733666f, 0.372086346f},
-std::array<float,2>{0.436089814f, 0.158781394f},
-std::array<float,2>{0.868381739f, 0.664591193f},
-std::array<float,2>{0.267068803f, 0.600915372f},
-std::array<float,2>{0.995883882f, 0.118754774f},
-std::array<float,2>{0.0704237074f, 0.474233329f},
-std::array<float,2>{0.676410615f, 0.939907193f},
-std::array<float,2>{0.0503969416f, 0.731823385f},
-std::array<float,2>{0.703340948f, 0.235379785f},
-std::array<float,2>{0.358322412f, 0.260447174f},
-std::array<float,2>{0.909785807f, 0.863543212f},
-std::array<float,2>{0.495371103f, 0.90454036f},
-std::array<float,2>{0.793329358f, 0.397806317f},
-std::array<float,2>{0.190201059f, 0.0552738719f},
-std::array<float,2>{0.603226066f, 0.531763852f},
-std::array<float,2>{0.0992719904f, 0.994510591f},
-std::array<float,2>{0.639820099f, 0.446190089f},
-std::array<float,2>{0.30483371f, 0.0816967934f},
-std::array<float,2>{0.942003369f, 0.577027142f},
-std::array<float,2>{0.400100291f, 0.654756129f},
-std::array<float,2>{0.835755408f, 0.147087395f},
-std::array<float,2>{0.147897065f, 0.338866919f},
-std::array<float,2>{0.508387685f, 0.793736339f},
-std::array<float,2>{0.22949338f, 0.511938155f},
-std::array<float,2>{0.585611582f, 0.0310446452f},
-std::array<float,2>{0.455705464f, 0.407168269f},
-std::array<float,2>{0.752950013f, 0.918571472f},
-std::array<float,2>{0.315945476f, 0.823411047f},
-std::array<float,2>{0.892938733f, 0.308178246f},
-std::array<float,2>{0.0258523356f, 0.18920742f},
-std::array<float,2>{0.730607331f, 0.713038325f},
-std::array<float,2>{0.0693424121f, 0.782831192f},
-std::array<float,2>{0.681715965f, 0.332906723f},
-std::array<float,2>{0.278449565f, 0.152356207f},
-std::array<float,2>{0.987554133f, 0.642166197f},
-std::array<float,2>{0.422417492f, 0.567909658f},
-std::array<float,2>{0.861806333f, 0.0919157118f},
-std::array<float,2>{0.179209828f, 0.441406399f},
-std::array<float,2>{0.540756106f, 0.989710867f},
-std::array<float,2>{0.197819501f, 0.707499564f},
-std::array<float,2>{0.60102731f, 0.20210126f},
-std::array<float,2>{0.486816198f, 0.297042012f},
-std::array<float,2>{0.787256062f, 0.819366157f},
-std::array<float,2>{0.349830598f, 0.912599325f},
-std::array<float,2>{0.91808188f, 0.418535858f},
-std::array<float,2>{0.0552454889f, 0.0195775069f},
-std::array<float,2>{0.715303302f, 0.507033885f},
-std::array<float,2>{0.149725854f, 0.949874818f},
-std::array<float,2>{0.500934482f, 0.483547091f},
-std::array<float,2>{0.393672884f, 0.113906473f},
-std::array<float,2>{0.837555528f, 0.603665173f},
-std::array<float,2>{0.296875775f, 0.658958316f},
-std::array<float,2>{0.948167026f, 0.167647451f},
-std::array<float,2>{0.104398221f, 0.362232029f},
-std::array<float,2>{0.628685653f, 0.779076397f},
-std::array<float,2>{0.0209836066f, 0.546185374f},
-std::array<float,2>{0.719726741f, 0.047940053f},
-std::array<float,2>{0.323931783f, 0.402565271f},
-std::array<float,2>{0.899553299f, 0.892709672f},
-std::array<float,2>{0.467099756f, 0.871133387f},
-std::array<float,2>{0.764471412f, 0.254378468f},
-std::array<float,2>{0.220854163f, 0.246514842f},
-std::array<float,2>{0.586323082f, 0.720418215f},
-std::array<float,2>{0.240034342f, 0.831550717f},
-std::array<float,2>{0.564561069f, 0.287699819f},
-std::array<float,2>{0.437843233f, 0.216902435f},
-std::array<float,2>{0.777478933f, 0.699144483f},
-std::array<float,2>{0.330062538f, 0.521777034f},
-std::array<float,2>{0.889966965f, 0.0143647883f},
-std::array<float,2>{0.00781753473f, 0.433214754f},
-std::array<float,2>{0.7434147f, 0.936245978f},
-std::array<float,2>{0.110389195f, 0.638128757f},
-std::array<float,2>{0.651064575f, 0.13021563f},
-std::array<float,2>{0.291463971f, 0.313941091f},
-std::array<float,2>{0.959021091f, 0.811844349f},
-std::array<float,2>{0.377467841f, 0.977845669f},
-std::array<float,2>{0.820401788f, 0.464428395f},
-std::array<float,2>{0.140409783f, 0.0752510503f},
-std::array<float,2>{0.51633054f, 0.584047258f},
-std::array<float,2>{0.0436997451f, 0.876776159f},
-std::array<float,2>{0.693077862f, 0.379378974f},
-std::array<float,2>{0.361153185f, 0.0332564972f},
-std::array<float,2>{0.934739113f, 0.557433844f},
-std::array<float,2>{0.479674548f, 0.743798018f},
-std::array<float,2>{0.805972815f, 0.219844952f},
-std::array<float,2>{0.218627095f, 0.271629274f},
-std::array<float,2>{0.617644131f, 0.848066866f},
-std::array<float,2>{0.167611867f, 0.623713613f},
-std::array<float,2>{0.558219314f, 0.103319928f},
-std::array<float,2>{0.416387737f, 0.496427327f},
-std::array<float,2>{0.852906942f, 0.953605175f},
-std::array<float,2>{0.261418372f, 0.75939697f},
-std::array<float,2>{0.976079345f, 0.3536686f},
-std::array<float,2>{0.0855166912f, 0.176493555f},
-std::array<float,2>{0.658490777f, 0.6764642f},
-std::array<float,2>{0.0612485297f, 0.750418007f},
-std::array<float,2>{0.711017191f, 0.348916739f},
-std::array<float,2>{0.346238792f, 0.182522565f},
-std::array<float,2>{0.914112449f, 0.685763955f},
-std::array<float,2>{0.492144287f, 0.612838089f},
-std::array<float,2>{0.78293252f, 0.096112214f},
-std::array<float,2>{0.199785084f, 0.487343788f},
-std::array<float,2>{0.595445037f, 0.960959256f},
-std::array<float,2>{0.17279847f, 0.7394768f},
-std::array<float,2>{0.545285344f, 0.229615837f},
-std::array<float,2>{0.427736431f, 0.277513057f},
-std::array<float,2>{0.866644323f, 0.857959628f},
-std::array<float,2>{0.273530394f, 0.887375236f},
-std::array<float,2>{0.989124775f, 0.388773948f},
-std::array<float,2>{0.0632120892f, 0.0440449566f},
-std::array<float,2>{0.684788764f, 0.552900434f},
-std::array<float,2>{0.223850191f, 0.968794465f},
-std::array<float,2>{0.593469918f, 0.458676934f},
-std::array<float,2>{0.462929577f, 0.0630404651f},
-std::array<float,2>{0.759360075f, 0.58703059f},
-std::array<float,2>{0.326942742f, 0.632541597f},
-std::array<float,2>{0.902976573f, 0.138154879f},
-std::array<float,2>{0.0188989751f, 0.326873481f},
-std::array<float,2>{0.723687589f, 0.801238656f},
-std::array<float,2>{0.108998492f, 0.524350107f},
-std::array<float,2>{0.630050957f, 0.00475905929f},
-std::array<float,2>{0.303759784f, 0.42277059f},
-std::array<float,2>{0.949599385f, 0.922308683f},
-std::array<float,2>{0.397799313f, 0.839906156f},
-std::array<float,2>{0.841607332f, 0.289893568f},
-std::array<float,2>{0.152821392f, 0.20945932f},
-std::array<float,2>{0.504843354f, 0.691266119f},
-std::array<float,2>{0.134233892f, 0.862011492f},
-std::array<float,2>{0.52313441f, 0.264734834f},
-std::array<float,2>{0.379818588f, 0.241551295f},
-std::array<float,2>{0.824591041f, 0.726906657f},
-std::array<float,2>{0.295643151f, 0.535285652f},
-std::array<float,2>{0.956234992f, 0.0615943223f},
-std::array<float,2>{0.115190268f, 0.39144212f},
-std::array<float,2>{0.656079173f, 0.901982009f},
-std::array<float,2>{0.0118311504f, 0.668337107f},
-std::array<float,2>{0.747758567f, 0.163896844f},
-std::array<float,2>{0.333915353f, 0.370218724f},
-std::array<float,2>{0.883561134f, 0.771406591f},
-std::array<float,2>{0.442284375f, 0.943211973f},
-std::array<float,2>{0.775367498f, 0.470989823f},
-std::array<float,2>{0.23818478f, 0.124695152f},
-std::array<float,2>{0.567197204f, 0.594091952f},
-std::array<float,2>{0.0792825446f, 0.917618096f},
-std::array<float,2>{0.661554992f, 0.413031906f},
-std::array<float,2>{0.265117824f, 0.0273171999f},
-std::array<float,2>{0.969160914f, 0.509987056f},
-std::array<float,2>{0.421641111f, 0.717789531f},
-std::array<float,2>{0.857738793f, 0.194609568f},
-std::array<float,2>{0.170167923f, 0.30888018f},
-std::array<float,2>{0.560127258f, 0.827043653f},
-std::array<float,2>{0.212932378f, 0.570489228f},
-std::array<float,2>{0.624271154f, 0.0836806223f},
-std::array<float,2>{0.481708437f, 0.450832248f},
-std::array<float,2>{0.810471237f, 0.997776926f},
-std::array<float,2>{0.365728468f, 0.789438903f},
-std::array<float,2>{0.931165576f, 0.343133986f},
-std::array<float,2>{0.0405521803f, 0.142198563f},
-std::array<float,2>{0.688438594f, 0.6517874f},
-std::array<float,2>{0.12085887f, 0.814645052f},
-std::array<float,2>{0.645968437f, 0.301153183f},
-std::array<float,2>{0.284978688f, 0.197380885f},
-std::array<float,2>{0.964531839f, 0.706666768f},
-std::array<float,2>{0.385120511f, 0.503714144f},
-std::array<float,2>{0.819896817f, 0.0168660544f},
-std::array<float,2>{0.126004785f, 0.415757954f},
-std::array<float,2>{0.526685119f, 0.907901347f},
-std::array<float,2>{0.249904528f, 0.648269951f},
-std::array<float,2>{0.572080016f, 0.149883106f},
-std::array<float,2>{0.448105752f, 0.331374884f},
-std::array<float,2>{0.766991913f, 0.787309468f},
-std::array<float,2>{0.336046547f, 0.986995876f},
-std::array<float,2>{0.881080747f, 0.439474195f},
-std::array<float,2>{0.00567712123f, 0.087520197f},
-std::array<float,2>{0.73678124f, 0.564031839f},
-std::array<float,2>{0.160595074f, 0.894623756f},
-std::array<float,2>{0.549061f, 0.402323574f},
-std::array<float,2>{0.413116336f, 0.0544249117f},
-std::array<float,2>{0.844210446f, 0.542594314f},
-std::array<float,2>{0.257529736f, 0.723380387f},
-std::array<float,2>{0.980819881f, 0.242694169f},
-std::array<float,2>{0.090364784f, 0.25345096f},
-std::array<float,2>{0.670822203f, 0.870500803f},
-std::array<float,2>{0.0318455659f, 0.607553482f},
-std::array<float,2>{0.695476592f, 0.111852609f},
-std::array<float,2>{0.372329921f, 0.477128655f},
-std::array<float,2>{0.926376045f, 0.948577881f},
-std::array<float,2>{0.468896121f, 0.776104093f},
-std::array<float,2>{0.803960621f, 0.363315642f},
-std::array<float,2>{0.204548553f, 0.168572977f},
-std::array<float,2>{0.613588333f, 0.660813689f},
-std::array<float,2>{0.192136839f, 0.804948092f},
-std::array<float,2>{0.606458247f, 0.318593532f},
-std::array<float,2>{0.497294068f, 0.127391264f},
-std::array<float,2>{0.790288329f, 0.633771896f},
-std::array<float,2>{0.352880865f, 0.579161704f},
-std::array<float,2>{0.910944402f, 0.071584858f},
-std::array<float,2>{0.0531612001f, 0.465742379f},
-std::array<float,2>{0.70781064f, 0.982356489f},
-std::array<float,2>{0.0760710239f, 0.700627983f},
-std::array<float,2>{0.673647583f, 0.213463277f},
-std::array<float,2>{0.270314693f, 0.285020143f},
-std::array<float,2>{0.99803561f, 0.833231688f},
-std::array<float,2>{0.430868655f, 0.933047593f},
-std::array<float,2>{0.873440444f, 0.437379748f},
-std::array<float,2>{0.184002578f, 0.0113672502f},
-std::array<float,2>{0.536364853f, 0.519233286f},
-std::array<float,2>{0.0311022922f, 0.958428144f},
-std::array<float,2>{0.730342448f, 0.493773878f},
-std::array<float,2>{0.317039937f, 0.107377805f},
-std::array<float,2>{0.894767404f, 0.62059629f},
-std::array<float,2>{0.458999515f, 0.674990118f},
-std::array<float,2>{0.754153609f, 0.175556079f},
-std::array<float,2>{0.231317326f, 0.357687294f},
-std::array<float,2>{0.578335524f, 0.762250841f},
-std::array<float,2>{0.144429967f, 0.56203109f},
-std::array<float,2>{0.512153029f, 0.0372950323f},
-std::array<float,2>{0.403959572f, 0.376413137f},
-std::array<float,2>{0.830426455f, 0.879297256f},
-std::array<float,2>{0.311530918f, 0.847478926f},
-std::array<float,2>{0.939788461f, 0.2657381f},
-std::array<float,2>{0.0960938632f, 0.225410834f},
-std::array<float,2>{0.634486735f, 0.746126771f},
-std::array<float,2>{0.0264801923f, 0.820895255f},
-std::array<float,2>{0.731736958f, 0.305119962f},
-std::array<float,2>{0.315033823f, 0.190961704f},
-std::array<float,2>{0.893743038f, 0.712522328f},
-std::array<float,2>{0.456232131f, 0.514855683f},
-std::array<float,2>{0.751963615f, 0.0286218319f},
-std::array<float,2>{0.229377225f, 0.40865922f},
-std::array<float,2>{0.584951878f, 0.920762122f},
-std::array<float,2>{0.147205681f, 0.654034674f},
-std::array<float,2>{0.509555995f, 0.145992935f},
-std::array<float,2>{0.399143755f, 0.337804675f},
-std::array<float,2>{0.834793866f, 0.796852827f},
-std::array<float,2>{0.305892617f, 0.993066311f},
-std::array<float,2>{0.942392766f, 0.447452307f},
-std::array<float,2>{0.0984029472f, 0.0792123973f},
-std::array<float,2>{0.63935554f, 0.575764298f},
-std::array<float,2>{0.191017017f, 0.903638065f},
-std::array<float,2>{0.602292776f, 0.395863712f},
-std::array<float,2>{0.494372696f, 0.0582564026f},
-std::array<float,2>{0.794349909f, 0.534060061f},
-std::array<float,2>{0.359254509f, 0.733149171f},
-std::array<float,2>{0.908595204f, 0.237824559f},
-std::array<float,2>{0.0493555628f, 0.258601576f},
-std::array<float,2>{0.70491612f, 0.865407586f},
-std::array<float,2>{0.0718921572f, 0.597771466f},
-std::array<float,2>{0.677314103f, 0.119899213f},
-std::array<float,2>{0.265773326f, 0.474722445f},
-std::array<float,2>{0.994512022f, 0.937623084f},
-std::array<float,2>{0.437491596f, 0.767689645f},
-std::array<float,2>{0.868134677f, 0.373796344f},
-std::array<float,2>{0.181920484f, 0.157574043f},
-std::array<float,2>{0.53441447f, 0.666959643f},
-std::array<float,2>{0.156669587f, 0.79978919f},
-std::array<float,2>{0.550943375f, 0.322085917f},
-std::array<float,2>{0.409647673f, 0.134738803f},
-std::array<float,2>{0.849911273f, 0.626175106f},
-std::array<float,2>{0.250945002f, 0.591850936f},
-std::array<float,2>{0.979809821f, 0.066740267f},
-std::array<float,2>{0.0874154568f, 0.455988199f},
-std::array<float,2>{0.664738178f, 0.972703099f},
-std::array<float,2>{0.0362623185f, 0.691986918f},
-std::array<float,2>{0.702382386f, 0.203520805f},
-std::array<float,2>{0.370262146f, 0.294111311f},
-std::array<float,2>{0.92422992f, 0.836583495f},
-std::array<float,2>{0.474517077f, 0.928762794f},
-std::array<float,2>{0.796987712f, 0.427301019f},
-std::array<float,2>{0.210162893f, 0.0038147592f},
-std::array<float,2>{0.61116606f, 0.527808785f},
-std::array<float,2>{0.123304889f, 0.968415737f},
-std::array<float,2>{0.64169395f, 0.490115345f},
-std::array<float,2>{0.288474292f, 0.101204485f},
-std::array<float,2>{0.967275262f, 0.615675628f},
-std::array<float,2>{0.386969566f, 0.681201994f},
-std::array<float,2>{0.814423382f, 0.184036314f},
-std::array<float,2>{0.130968004f, 0.346696347f},
-std::array<float,2>{0.529126763f, 0.755118906f},
-std::array<float,2>{0.243935511f, 0.549304724f},
-std::array<float,2>{0.575925469f, 0.0393545292f},
-std::array<float,2>{0.452717721f, 0.386023164f},
-std::array<float,2>{0.769714117f, 0.886271775f},
-std::array<float,2>{0.340508044f, 0.851668775f},
-std::array<float,2>{0.875392854f, 0.277120799f},
-std::array<float,2>{0.00172956032f, 0.232388005f},
-std::array<float,2>{0.741862535f, 0.73734796f},
-std::array<float,2>{0.0840989426f, 0.761153698f},
-std::array<float,2>{0.659858227f, 0.352816939f},
-std::array<float,2>{0.260558307f, 0.179000452f},
-std::array<float,2>{0.97546941f, 0.678147078f},
-std::array<float,2>{0.41743511f, 0.621173382f},
-std::array<float,2>{0.851914108f, 0.105071731f},
-std::array<float,2>{0.166497171f, 0.498413265f},
-std::array<float,2>{0.557542562f, 0.955411792f},
-std::array<float,2>{0.21758157f, 0.745813668f},
-std::array<float,2>{0.618454456f, 0.220882937f},
-std::array<float,2>{0.479202151f, 0.270827264f},
-std::array<float,2>{0.805539131f, 0.851519406f},
-std::array<float,2>{0.360149354f, 0.878764629f},
-std::array<float,2>{0.934012711f, 0.382523865f},
-std::array<float,2>{0.0445645787f, 0.0317055434f},
-std::array<float,2>{0.691764593f, 0.554887176f},
-std::array<float,2>{0.139538735f, 0.978611648f},
-std::array<float,2>{0.517342508f, 0.461329311f},
-std::array<float,2>{0.377932608f, 0.0764631778f},
-std::array<float,2>{0.821551859f, 0.582934976f},
-std::array<float,2>{0.292031199f, 0.639931858f},
-std::array<float,2>{0.960382819f, 0.132670701f},
-std::array<float,2>{0.109963894f, 0.316241086f},
-std::array<float,2>{0.651750207f, 0.810326815f},
-std::array<float,2>{0.00888825022f, 0.521468341f},
-std::array<float,2>{0.74300468f, 0.0134630371f},
-std::array<float,2>{0.328485638f, 0.43152988f},
-std::array<float,2>{0.888675392f, 0.934132993f},
-std::array<float,2>{0.438576877f, 0.829325914f},
-std::array<float,2>{0.779118061f, 0.285799891f},
-std::array<float,2>{0.238283634f, 0.216461152f},
-std::array<float,2>{0.565650642f, 0.696801543f},
-std::array<float,2>{0.222569898f, 0.873151302f},
-std::array<float,2>{0.587088883f, 0.256374031f},
-std::array<float,2>{0.46803543f, 0.249573112f},
-std::array<float,2>{0.765199304f, 0.721446514f},
-std::array<float,2>{0.322668523f, 0.54355675f},
-std::array<float,2>{0.898581088f, 0.0502553321f},
-std::array<float,2>{0.0203549378f, 0.405741185f},
-std::array<float,2>{0.719248056f, 0.89200294f},
-std::array<float,2>{0.105072998f, 0.656869233f},
-std::array<float,2>{0.626954556f, 0.165729538f},
-std::array<float,2>{0.298263222f, 0.360303491f},
-std::array<float,2>{0.949115634f, 0.780363381f},
-std::array<float,2>{0.392846406f, 0.952302396f},
-std::array<float,2>{0.836048007f, 0.481144816f},
-std::array<float,2>{0.148444757f, 0.115866691f},
-std::array<float,2>{0.501325548f, 0.601693869f},
-std::array<float,2>{0.0560157485f, 0.910645068f},
-std::array<float,2>{0.716091931f, 0.420744389f},
-std::array<float,2>{0.351134509f, 0.0226316173f},
-std::array<float,2>{0.919579268f, 0.504423022f},
-std::array<float,2>{0.487470657f, 0.710787773f},
-std::array<float,2>{0.788968861f, 0.201152578f},
-std::array<float,2>{0.198993623f, 0.299313545f},
-std::array<float,2>{0.600073338f, 0.817331195f},
-std::array<float,2>{0.178475395f, 0.568459213f},
-std::array<float,2>{0.539482594f, 0.0912033021f},
-std::array<float,2>{0.423659444f, 0.443477422f},
-std::array<float,2>{0.863232434f, 0.990750134f},
-std::array<float,2>{0.277781516f, 0.783486366f},
-std::array<float,2>{0.987231612f, 0.334458083f},
-std::array<float,2>{0.0684138611f, 0.15522255f},
-std::array<float,2>{0.682977259f, 0.642935812f},
-std::array<float,2>{0.0397826433f, 0.792258382f},
-std::array<float,2>{0.689016044f, 0.341071576f},
-std::array<float,2>{0.366929054f, 0.143749833f},
-std::array<float,2>{0.930383444f, 0.64986372f},
-std::array<float,2>{0.480604053f, 0.572721303f},
-std::array<float,2>{0.809116364f, 0.0856929272f},
-std::array<float,2>{0.214676037f, 0.45173642f},
-std::array<float,2>{0.623171151f, 0.999673903f},
-std::array<float,2>{0.171856657f, 0.716773927f},
-std::array<float,2>{0.559076309f, 0.192337751f},
-std::array<float,2>{0.420897245f, 0.31133306f},
-std::array<float,2>{0.858454049f, 0.824892879f},
-std::array<float,2>{0.263938874f, 0.915221095f},
-std::array<float,2>{0.969865143f, 0.411278129f},
-std::array<float,2>{0.078938581f, 0.0238029361f},
-std::array<float,2>{0.661068797f, 0.508940935f},
-std::array<float,2>{0.23711139f, 0.945276856f},
-std::array<float,2>{0.567794681f, 0.470393419f},
-std::array<float,2>{0.443188161f, 0.121625148f},
-std::array<float,2>{0.773834705f, 0.596056581f},
-std::array<float,2>{0.332395107f, 0.670497477f},
-std::array<float,2>{0.884393811f, 0.161505982f},
-std::array<float,2>{0.0133494688f, 0.36806047f},
-std::array<float,2>{0.746472239f, 0.771717012f},
-std::array<float,2>{0.114256755f, 0.538338006f},
-std::array<float,2>{0.654983044f, 0.0604137443f},
-std::array<float,2>{0.296479404f, 0.393954158f},
-std::array<float,2>{0.955754757f, 0.898647249f},
-std::array<float,2>{0.379957676f, 0.860133171f},
-std::array<float,2>{0.82599324f, 0.262606502f},
-std::array<float,2>{0.13366285f, 0.238768891f},
-std::array<float,2>{0.521983266f, 0.729623199f},
-std::array<float,2>{0.153855011f, 0.84198451f},
-std::array<float,2>{0.504923701f, 0.292328566f},
-std::array<float,2>{0.396855801f, 0.208359092f},
-std::array<float,2>{0.840715468f, 0.688873947f},
-std::array<float,2>{0.303683341f, 0.526620328f},
-std::array<float,2>{0.951061845f, 0.00685657235f},
-std::array<float,2>{0.108311594f, 0.424414992f},
-std::array<float,2>{0.628962696f, 0.925359011f},
-std::array<float,2>{0.0181999579f, 0.630428851f},
-std::array<float,2>{0.72273159f, 0.140373483f},
-std::array<float,2>{0.327671826f, 0.325255662f},
-std::array<float,2>{0.904149354f, 0.803785086f},
-std::array<float,2>{0.464582443f, 0.971520722f},
-std::array<float,2>{0.758408725f, 0.460803092f},
-std::array<float,2>{0.222791016f, 0.0650494546f},
-std::array<float,2>{0.592321455f, 0.588413239f},
-std::array<float,2>{0.0636228099f, 0.889423013f},
-std::array<float,2>{0.684312105f, 0.388111264f},
-std::array<float,2>{0.274818271f, 0.0458264314f},
-std::array<float,2>{0.990078807f, 0.551373184f},
-std::array<float,2>{0.429424047f, 0.741019964f},
-std::array<float,2>{0.865393519f, 0.227785349f},
-std::array<float,2>{0.173435971f, 0.280030876f},
-std::array<float,2>{0.546378016f, 0.856759012f},
-std::array<float,2>{0.200496018f, 0.610785007f},
-std::array<float,2>{0.594128311f, 0.0951038375f},
-std::array<float,2>{0.49062416f, 0.485380799f},
-std::array<float,2>{0.781660557f, 0.964492023f},
-std::array<float,2>{0.34728238f, 0.752665102f},
-std::array<float,2>{0.915781856f, 0.350702971f},
-std::array<float,2>{0.062304385f, 0.180165276f},
-std::array<float,2>{0.712759197f, 0.684733629f},
-std::array<float,2>{0.0973842815f, 0.844671428f},
-std::array<float,2>{0.633556604f, 0.267654717f},
-std::array<float,2>{0.311343521f, 0.223876908f},
-std::array<float,2>{0.940710187f, 0.74912852f},
-std::array<float,2>{0.40261355f, 0.55859679f},
-std::array<float,2>{0.831417263f, 0.0368988961f},
-std::array<float,2>{0.143424734f, 0.378663033f},
-std::array<float,2>{0.512913227f, 0.881894588f},
-std::array<float,2>{0.232265159f, 0.672664464f},
-std::array<float,2>{0.579628527f, 0.172529593f},
-std::array<float,2>{0.460905761f, 0.357189417f},
-std::array<float,2>{0.75501436f, 0.765057921f},
-std::array<float,2>{0.317738056f, 0.960061371f},
-std::array<float,2>{0.895818651f, 0.494265497f},
-std::array<float,2>{0.02954177f, 0.108675241f},
-std::array<float,2>{0.729202628f, 0.617764354f},
-std::array<float,2>{0.185468167f, 0.931537211f},
-std::array<float,2>{0.536061883f, 0.433670998f},
-std::array<float,2>{0.430431217f, 0.0097164996f},
-std::array<float,2>{0.874406219f, 0.515900016f},
-std::array<float,2>{0.271382451f, 0.701362133f},
-std::array<float,2>{0.996922851f, 0.211246029f},
-std::array<float,2>{0.0747248381f, 0.282334268f},
-std::array<float,2>{0.672477722f, 0.83512336f},
-std::array<float,2>{0.0538650528f, 0.580514491f},
-std::array<float,2>{0.708608687f, 0.0730652213f},
-std::array<float,2>{0.351960272f, 0.467915267f},
-std::array<float,2>{0.911938906f, 0.982527971f},
-std::array<float,2>{0.496937603f, 0.807666302f},
-std::array<float,2>{0.789191604f, 0.316573769f},
-std::array<float,2>{0.193063945f, 0.125691399f},
-std::array<float,2>{0.606256247f, 0.636590421f},
-std::array<float,2>{0.203571066f, 0.775179207f},
-std::array<float,2>{0.61482054f, 0.365571022f},
-std::array<float,2>{0.469772846f, 0.170424297f},
-std::array<float,2>{0.803194165f, 0.662427187f},
-std::array<float,2>{0.371568441f, 0.60698396f},
-std::array<float,2>{0.927407265f, 0.11078722f},
-std::array<float,2>{0.0326114818f, 0.480144948f},
-std::array<float,2>{0.697057247f, 0.946090579f},
-std::array<float,2>{0.0912047327f, 0.724957585f},
-std::array<float,2>{0.671252608f, 0.245656028f},
-std::array<float,2>{0.256763816f, 0.250756562f},
-std::array<float,2>{0.982257187f, 0.868570507f},
-std::array<float,2>{0.412312031f, 0.897387564f},
-std::array<float,2>{0.845207512f, 0.399735034f},
-std::array<float,2>{0.161889508f, 0.0512090325f},
-std::array<float,2>{0.550721169f, 0.540507853f},
-std::array<float,2>{0.00468722545f, 0.985457122f},
-std::array<float,2>{0.737979412f, 0.438655972f},
-std::array<float,2>{0.337815225f, 0.0895830095f},
-std::array<float,2>{0.882443726f, 0.564943254f},
-std::array<float,2>{0.449154198f, 0.64544487f},
-std::array<float,2>{0.766598225f, 0.151365608f},
-std::array<float,2>{0.248108685f, 0.328536749f},
-std::array<float,2>{0.570937097f, 0.786311448f},
-std::array<float,2>{0.12569578f, 0.501287341f},
-std::array<float,2>{0.52615267f, 0.0194005072f},
-std::array<float,2>{0.38666448f, 0.417174548f},
-std::array<float,2>{0.819088101f, 0.908755839f},
-std::array<float,2>{0.283883184f, 0.812987149f},
-std::array<float,2>{0.963406622f, 0.304082096f},
-std::array<float,2>{0.119837053f, 0.196514249f},
-std::array<float,2>{0.644766927f, 0.703275442f},
-std::array<float,2>{0.047407221f, 0.865011573f},
-std::array<float,2>{0.705376208f, 0.261502296f},
-std::array<float,2>{0.356589049f, 0.234604478f},
-std::array<float,2>{0.906265855f, 0.731330395f},
-std::array<float,2>{0.494032711f, 0.532846034f},
-std::array<float,2>{0.795375347f, 0.0558591336f},
-std::array<float,2>{0.189280435f, 0.396818578f},
-std::array<float,2>{0.60397464f, 0.905920684f},
-std::array<float,2>{0.180596605f, 0.665503502f},
-std::array<float,2>{0.531400383f, 0.159329802f},
-std::array<float,2>{0.435305923f, 0.371501863f},
-std::array<float,2>{0.869147003f, 0.76679498f},
-std::array<float,2>{0.267991006f, 0.940782428f},
-std::array<float,2>{0.994090796f, 0.472987026f},
-std::array<float,2>{0.073105365f, 0.11798317f},
-std::array<float,2>{0.678459704f, 0.600300312f},
-std::array<float,2>{0.228202909f, 0.919174373f},
-std::array<float,2>{0.583929837f, 0.408018917f},
-std::array<float,2>{0.453522086f, 0.029996518f},
-std::array<float,2>{0.750541031f, 0.513424397f},
-std::array<float,2>{0.313321739f, 0.71449995f},
-std::array<float,2>{0.891897678f, 0.187867507f},
-std::array<float,2>{0.0242354479f, 0.306720406f},
-std::array<float,2>{0.732934535f, 0.823182225f},
-std::array<float,2>{0.101325504f, 0.577729404f},
-std::array<float,2>{0.638663828f, 0.0803612173f},
-std::array<float,2>{0.308187664f, 0.446884245f},
-std::array<float,2>{0.94446075f, 0.995469511f},
-std::array<float,2>{0.402142286f, 0.794647574f},
-std::array<float,2>{0.833546162f, 0.33907038f},
-std::array<float,2>{0.14627859f, 0.148095593f},
-std::array<float,2>{0.511365175f, 0.655438125f},
-std::array<float,2>{0.130429074f, 0.755961001f},
-std::array<float,2>{0.530345082f, 0.345166236f},
-std::array<float,2>{0.388776749f, 0.186719224f},
-std::array<float,2>{0.816150904f, 0.682831168f},
-std::array<float,2>{0.286246419f, 0.613738537f},
-std::array<float,2>{0.96590817f, 0.0980073959f},
-std::array<float,2>{0.122666985f, 0.491843581f},
-std::array<float,2>{0.644440532f, 0.966697454f},
-std::array<float,2>{0.0025565119f, 0.735777676f},
-std::array<float,2>{0.739914954f, 0.234215677f},
-std::array<float,2>{0.343125015f, 0.274465799f},
-std::array<float,2>{0.87754029f, 0.853633463f},
-std::array<float,2>{0.450379819f, 0.883212209f},
-std::array<float,2>{0.771846294f, 0.38436687f},
-std::array<float,2>{0.245454237f, 0.0414652601f},
-std::array<float,2>{0.577011347f, 0.548167586f},
-std::array<float,2>{0.0881505236f, 0.976479292f},
-std::array<float,2>{0.667940557f, 0.455070198f},
-std::array<float,2>{0.252477944f, 0.069527097f},
-std::array<float,2>{0.977765381f, 0.591215014f},
-std::array<float,2>{0.407626808f, 0.627138138f},
-std::array<float,2>{0.84795332f, 0.135846376f},
-std::array<float,2>{0.159351945f, 0.322523654f},
-std::array<float,2>{0.553910434f, 0.798092842f},
-std::array<float,2>{0.20834744f, 0.531084716f},
-std::array<float,2>{0.61282593f, 0.000139349577f},
-std::array<float,2>{0.474660426f, 0.428994119f},
-std::array<float,2>{0.800717711f, 0.926974654f},
-std::array<float,2>{0.368476182f, 0.837919593f},
-std::array<float,2>{0.923215926f, 0.295448124f},
-std::array<float,2>{0.0381483585f, 0.206285521f},
-std::array<float,2>{0.69964987f, 0.694864869f},
-std::array<float,2>{0.112580352f, 0.810749471f},
-std::array<float,2>{0.649083912f, 0.312508166f},
-std::array<float,2>{0.290247977f, 0.129697666f},
-std::array<float,2>{0.958875239f, 0.637445211f},
-std::array<float,2>{0.375490725f, 0.585661292f},
-std::array<float,2>{0.823799014f, 0.0745525584f},
-std::array<float,2>{0.137650266f, 0.463772655f},
-std::array<float,2>{0.51861912f, 0.977107823f},
-std::array<float,2>{0.240618199f, 0.697989106f},
-std::array<float,2>{0.564151585f, 0.217991069f},
-std::array<float,2>{0.440823734f, 0.288660407f},
-std::array<float,2>{0.779469669f, 0.830542147f},
-std::array<float,2>{0.330644816f, 0.936910629f},
-std::array<float,2>{0.888044894f, 0.43250826f},
-std::array<float,2>{0.0100193666f, 0.0151972072f},
-std::array<float,2>{0.745699286f, 0.522774518f},
-std::array<float,2>{0.164896682f, 0.954309821f},
-std::array<float,2>{0.556351423f, 0.497835785f},
-std::array<float,2>{0.415949017f, 0.10208983f},
-std::array<float,2>{0.854961336f, 0.624710202f},
-std::array<float,2>{0.258438021f, 0.677268326f},
-std::array<float,2>{0.973101795f, 0.177035928f},
-std::array<float,2>{0.0830141455f, 0.355264664f},
-std::array<float,2>{0.657615006f, 0.758579612f},
-std::array<float,2>{0.0452814922f, 0.558518946f},
-std::array<float,2>{0.695216f, 0.0346543416f},
-std::array<float,2>{0.362354368f, 0.380094767f},
-std::array<float,2>{0.936786652f, 0.875929236f},
-std::array<float,2>{0.476858735f, 0.849266887f},
-std::array<float,2>{0.807380974f, 0.272586077f},
-std::array<float,2>{0.216721848f, 0.219472736f},
-std::array<float,2>{0.619656444f, 0.742544353f},
-std::array<float,2>{0.196870252f, 0.81866461f},
-std::array<float,2>{0.597972393f, 0.297919214f},
-std::array<float,2>{0.484611422f, 0.202508643f},
-std::array<float,2>{0.786694527f, 0.708797574f},
-std::array<float,2>{0.348430663f, 0.50625509f},
-std::array<float,2>{0.920904696f, 0.0206134692f},
-std::array<float,2>{0.0581767671f, 0.419531405f},
-std::array<float,2>{0.718262434f, 0.913989186f},
-std::array<float,2>{0.0671140179f, 0.641051531f},
-std::array<float,2>{0.679693341f, 0.154146165f},
-std::array<float,2>{0.280413389f, 0.333595335f},
-std::array<float,2>{0.985371351f, 0.782089293f},
-std::array<float,2>{0.42575565f, 0.988426626f},
-std::array<float,2>{0.859450638f, 0.443256825f},
-std::array<float,2>{0.176702842f, 0.0934121087f},
-std::array<float,2>{0.541142941f, 0.566648185f},
-std::array<float,2>{0.0218497477f, 0.894413412f},
-std::array<float,2>{0.721633434f, 0.403531492f},
-std::array<float,2>{0.320515633f, 0.0477793589f},
-std::array<float,2>{0.900622904f, 0.545123398f},
-std::array<float,2>{0.465186626f, 0.719459414f},
-std::array<float,2>{0.762571692f, 0.248042986f},
-std::array<float,2>{0.220003471f, 0.255773634f},
-std::array<float,2>{0.589428484f, 0.872404754f},
-std::array<float,2>{0.151310712f, 0.605164409f},
-std::array<float,2>{0.503084242f, 0.115197927f},
-std::array<float,2>{0.390840203f, 0.482584387f},
-std::array<float,2>{0.838803172f, 0.95103091f},
-std::array<float,2>{0.299721152f, 0.778278947f},
-std::array<float,2>{0.946955025f, 0.362933427f},
-std::array<float,2>{0.102481112f, 0.166512877f},
-std::array<float,2>{0.625411034f, 0.660139799f},
-std::array<float,2>{0.0140515864f, 0.76971513f},
-std::array<float,2>{0.748626351f, 0.370048881f},
-std::array<float,2>{0.335873753f, 0.162113696f},
-std::array<float,2>{0.886458635f, 0.669037282f},
-std::array<float,2>{0.444609791f, 0.594946265f},
-std::array<float,2>{0.776433408f, 0.123518005f},
-std::array<float,2>{0.23607178f, 0.472411186f},
-std::array<float,2>{0.569902956f, 0.941961229f},
-std::array<float,2>{0.135492951f, 0.727855146f},
-std::array<float,2>{0.519553006f, 0.24038054f},
-std::array<float,2>{0.380977929f, 0.264006883f},
-std::array<float,2>{0.827668011f, 0.863257349f},
-std::array<float,2>{0.294020057f, 0.900535226f},
-std::array<float,2>{0.954616666f, 0.391924024f},
-std::array<float,2>{0.116514869f, 0.0608578399f},
-std::array<float,2>{0.652420282f, 0.53680855f},
-std::array<float,2>{0.21095778f, 0.996853471f},
-std::array<float,2>{0.621290088f, 0.449786276f},
-std::array<float,2>{0.482679218f, 0.0825705081f},
-std::array<float,2>{0.811735153f, 0.571652114f},
-std::array<float,2>{0.363618135f, 0.651233137f},
-std::array<float,2>{0.932921171f, 0.140897349f},
-std::array<float,2>{0.0418160409f, 0.342377663f},
-std::array<float,2>{0.691242516f, 0.790795386f},
-std::array<float,2>{0.0801780969f, 0.511422038f},
-std::array<float,2>{0.663823545f, 0.0260100402f},
-std::array<float,2>{0.262089938f, 0.413352281f},
-std::array<float,2>{0.972367525f, 0.916314721f},
-std::array<float,2>{0.418098927f, 0.827559114f},
-std::array<float,2>{0.856853068f, 0.310251296f},
-std::array<float,2>{0.168672204f, 0.193793759f},
-std::array<float,2>{0.560989082f, 0.717705846f},
-std::array<float,2>{0.174582973f, 0.858777761f},
-std::array<float,2>{0.543715417f, 0.278563797f},
-std::array<float,2>{0.426981807f, 0.228938118f},
-std::array<float,2>{0.863503575f, 0.739213526f},
-std::array<float,2>{0.276593626f, 0.554255843f},
-std::array<float,2>{0.99119252f, 0.0431737341f},
-std::array<float,2>{0.0656852573f, 0.390094906f},
-std::array<float,2>{0.687421679f, 0.887963891f},
-std::array<float,2>{0.0596308559f, 0.687012017f},
-std::array<float,2>{0.714476824f, 0.182815224f},
-std::array<float,2>{0.345484614f, 0.348172218f},
-std::array<float,2>{0.917755485f, 0.751109064f},
-std::array<float,2>{0.488832116f, 0.962666214f},
-std::array<float,2>{0.783275783f, 0.486481279f},
-std::array<float,2>{0.202891693f, 0.0968551114f},
-std::array<float,2>{0.597082615f, 0.611899316f},
-std::array<float,2>{0.106693983f, 0.923191607f},
-std::array<float,2>{0.631898165f, 0.423747897f},
-std::array<float,2>{0.302022636f, 0.00539132534f},
-std::array<float,2>{0.951375842f, 0.524984837f},
-std::array<float,2>{0.395783603f, 0.690377831f},
-std::array<float,2>{0.842851281f, 0.210877061f},
-std::array<float,2>{0.155586675f, 0.290769488f},
-std::array<float,2>{0.505919993f, 0.84163624f},
-std::array<float,2>{0.224892482f, 0.586873949f},
-std::array<float,2>{0.591663063f, 0.0642880797f},
-std::array<float,2>{0.461211562f, 0.457875788f},
-std::array<float,2>{0.761159837f, 0.970243275f},
-std::array<float,2>{0.325785905f, 0.802180111f},
-std::array<float,2>{0.904955029f, 0.327914089f},
-std::array<float,2>{0.016616933f, 0.137187749f},
-std::array<float,2>{0.726379812f, 0.63090378f},
-std::array<float,2>{0.0772051439f, 0.832421124f},
-std::array<float,2>{0.674609601f, 0.283997923f},
-std::array<float,2>{0.272858083f, 0.214060128f},
-std::array<float,2>{0.998500407f, 0.700116396f},
-std::array<float,2>{0.431704462f, 0.518227816f},
-std::array<float,2>{0.871549845f, 0.0104394518f},
-std::array<float,2>{0.18738474f, 0.436503887f},
-std::array<float,2>{0.537594914f, 0.932317972f},
-std::array<float,2>{0.193474114f, 0.634226859f},
-std::array<float,2>{0.607595086f, 0.128300905f},
-std::array<float,2>{0.499368817f, 0.320266873f},
-std::array<float,2>{0.791781723f, 0.806482613f},
-std::array<float,2>{0.354826868f, 0.980785549f},
-std::array<float,2>{0.913858652f, 0.466163933f},
-std::array<float,2>{0.0521706268f, 0.0710548088f},
-std::array<float,2>{0.710038185f, 0.578650892f},
-std::array<float,2>{0.142396629f, 0.880618453f},
-std::array<float,2>{0.513864934f, 0.375882953f},
-std::array<float,2>{0.40531984f, 0.0384067371f},
-std::array<float,2>{0.829669476f, 0.560986638f},
-std::array<float,2>{0.31021592f, 0.747180104f},
-std::array<float,2>{0.938461661f, 0.226539239f},
-std::array<float,2>{0.0954773575f, 0.267526358f},
-std::array<float,2>{0.635895848f, 0.845929146f},
-std::array<float,2>{0.0274626222f, 0.619650006f},
-std::array<float,2>{0.72834748f, 0.106246479f},
-std::array<float,2>{0.319906622f, 0.492839068f},
-std::array<float,2>{0.897836924f, 0.957147598f},
-std::array<float,2>{0.457875401f, 0.76298964f},
-std::array<float,2>{0.756813824f, 0.359238207f},
-std::array<float,2>{0.232849211f, 0.174798325f},
-std::array<float,2>{0.581503332f, 0.67415899f},
-std::array<float,2>{0.247887164f, 0.788698375f},
-std::array<float,2>{0.573254764f, 0.330978245f},
-std::array<float,2>{0.445461303f, 0.148564547f},
-std::array<float,2>{0.768737316f, 0.646828294f},
-std::array<float,2>{0.33981964f, 0.562888086f},
-std::array<float,2>{0.880480468f, 0.086395815f},
-std::array<float,2>{0.0064981943f, 0.440618277f},
-std::array<float,2>{0.734524786f, 0.987767458f},
-std::array<float,2>{0.118286543f, 0.705451965f},
-std::array<float,2>{0.64779979f, 0.198776871f},
-std::array<float,2>{0.282436311f, 0.302080929f},
-std::array<float,2>{0.962138712f, 0.816256642f},
-std::array<float,2>{0.383696049f, 0.907066226f},
-std::array<float,2>{0.818268776f, 0.414964259f},
-std::array<float,2>{0.128820166f, 0.0162301958f},
-std::array<float,2>{0.524666309f, 0.502295494f},
-std::array<float,2>{0.034280207f, 0.947932184f},
-std::array<float,2>{0.698814392f, 0.478384674f},
-std::array<float,2>{0.373291224f, 0.113063656f},
-std::array<float,2>{0.927748799f, 0.609199584f},
-std::array<float,2>{0.471602917f, 0.661371648f},
-std::array<float,2>{0.801643372f, 0.169046775f},
-std::array<float,2>{0.206486061f, 0.364931732f},
-std::array<float,2>{0.615734398f, 0.777204037f},
-std::array<float,2>{0.163551241f, 0.541212916f},
-std::array<float,2>{0.54707855f, 0.0534102321f},
-std::array<float,2>{0.410406232f, 0.401105314f},
-std::array<float,2>{0.846580744f, 0.896327555f},
-std::array<float,2>{0.255731374f, 0.86998868f},
-std::array<float,2>{0.983677506f, 0.252801865f},
-std::array<float,2>{0.0919703841f, 0.243331119f},
-std::array<float,2>{0.668457925f, 0.724401832f},
-std::array<float,2>{0.057629738f, 0.816741884f},
-std::array<float,2>{0.717914045f, 0.29957667f},
-std::array<float,2>{0.347980648f, 0.200326115f},
-std::array<float,2>{0.921722114f, 0.710371912f},
-std::array<float,2>{0.485230863f, 0.504283309f},
-std::array<float,2>{0.786291361f, 0.0230480693f},
-std::array<float,2>{0.196412116f, 0.420193613f},
-std::array<float,2>{0.598534226f, 0.910219908f},
-std::array<float,2>{0.175942317f, 0.643070698f},
-std::array<float,2>{0.541926742f, 0.154354304f},
-std::array<float,2>{0.425259829f, 0.334846556f},
-std::array<float,2>{0.859903038f, 0.784068584f},
-std::array<float,2>{0.281205237f, 0.990451038f},
-std::array<float,2>{0.986277401f, 0.444011301f},
-std::array<float,2>{0.0667125732f, 0.0914928243f},
-std::array<float,2>{0.680427253f, 0.569037378f},
-std::array<float,2>{0.220296055f, 0.892160952f},
-std::array<float,2>{0.589194894f, 0.406041116f},
-std::array<float,2>{0.465556473f, 0.0505440906f},
-std::array<float,2>{0.761850953f, 0.543097079f},
-std::array<float,2>{0.321167201f, 0.721117556f},
-std::array<float,2>{0.90101558f, 0.249116674f},
-std::array<float,2>{0.0222307183f, 0.256013662f},
-std::array<float,2>{0.721120656f, 0.873925269f},
-std::array<float,2>{0.101602659f, 0.602470875f},
-std::array<float,2>{0.625604689f, 0.115495831f},
-std::array<float,2>{0.298921317f, 0.480873525f},
-std::array<float,2>{0.946335137f, 0.953078628f},
-std::array<float,2>{0.391272604f, 0.780826151f},
-std::array<float,2>{0.838322878f, 0.359645039f},
-std::array<float,2>{0.150716379f, 0.165520415f},
-std::array<float,2>{0.503826499f, 0.656377614f},
-std::array<float,2>{0.137148768f, 0.809937f},
-std::array<float,2>{0.519475579f, 0.315661818f},
-std::array<float,2>{0.375479698f, 0.132117718f},
-std::array<float,2>{0.823503911f, 0.640313387f},
-std::array<float,2>{0.290770918f, 0.582286954f},
-std::array<float,2>{0.958123505f, 0.0770890713f},
-std::array<float,2>{0.113256671f, 0.461724192f},
-std::array<float,2>{0.64859134f, 0.979293227f},
-std::array<float,2>{0.0106299212f, 0.696310818f},
-std::array<float,2>{0.74521935f, 0.21583499f},
-std::array<float,2>{0.330300957f, 0.285426229f},
-std::array<float,2>{0.888264298f, 0.829701841f},
-std::array<float,2>{0.441084951f, 0.93394649f},
-std::array<float,2>{0.779973149f, 0.431077868f},
-std::array<float,2>{0.241068706f, 0.0131601747f},
-std::array<float,2>{0.563577473f, 0.52059257f},
-std::array<float,2>{0.0836367309f, 0.955804884f},
-std::array<float,2>{0.657985866f, 0.498555034f},
-std::array<float,2>{0.257928878f, 0.104556933f},
-std::array<float,2>{0.973376393f, 0.621745527f},
-std::array<float,2>{0.41521135f, 0.678684175f},
-std::array<float,2>{0.855050504f, 0.179664433f},
-std::array<float,2>{0.164170191f, 0.353380531f},
-std::array<float,2>{0.555933177f, 0.761471868f},
-std::array<float,2>{0.215901718f, 0.555650294f},
-std::array<float,2>{0.619525373f, 0.0317511074f},
-std::array<float,2>{0.477312535f, 0.381889731f},
-std::array<float,2>{0.806713283f, 0.878383994f},
-std::array<float,2>{0.362881839f, 0.850903511f},
-std::array<float,2>{0.937060475f, 0.271164477f},
-std::array<float,2>{0.0457169339f, 0.22158964f},
-std::array<float,2>{0.694352567f, 0.745336294f},
-std::array<float,2>{0.122230619f, 0.755675435f},
-std::array<float,2>{0.643912017f, 0.347200811f},
-std::array<float,2>{0.286809236f, 0.18437615f},
-std::array<float,2>{0.966621876f, 0.680730045f},
-std::array<float,2>{0.389497131f, 0.616017878f},
-std::array<float,2>{0.815472722f, 0.10096588f},
-std::array<float,2>{0.130119935f, 0.489579618f},
-std::array<float,2>{0.530979931f, 0.967862666f},
-std::array<float,2>{0.245896518f, 0.738012552f},
-std::array<float,2>{0.576222181f, 0.231763363f},
-std::array<float,2>{0.45112431f, 0.276815921f},
-std::array<float,2>{0.772301257f, 0.852095068f},
-std::array<float,2>{0.343636811f, 0.886201859f},
-std::array<float,2>{0.877315462f, 0.386547118f},
-std::array<float,2>{0.00222617714f, 0.0398812518f},
-std::array<float,2>{0.739696264f, 0.549437582f},
-std::array<float,2>{0.159808904f, 0.973446608f},
-std::array<float,2>{0.554254711f, 0.455367118f},
-std::array<float,2>{0.408185661f, 0.0671802163f},
-std::array<float,2>{0.848620117f, 0.59230274f},
-std::array<float,2>{0.252199084f, 0.626509249f},
-std::array<float,2>{0.978297353f, 0.134048834f},
-std::array<float,2>{0.0884381756f, 0.321745485f},
-std::array<float,2>{0.667311966f, 0.79903692f},
-std::array<float,2>{0.038932696f, 0.528244317f},
-std::array<float,2>{0.699824154f, 0.00333167939f},
-std::array<float,2>{0.368727863f, 0.426833421f},
-std::array<float,2>{0.92347008f, 0.929676712f},
-std::array<float,2>{0.475318521f, 0.836249352f},
-std::array<float,2>{0.800232708f, 0.294857651f},
-std::array<float,2>{0.20868817f, 0.203627214f},
-std::array<float,2>{0.612372041f, 0.691887081f},
-std::array<float,2>{0.188515052f, 0.865880966f},
-std::array<float,2>{0.604010999f, 0.257928312f},
-std::array<float,2>{0.493392169f, 0.237560317f},
-std::array<float,2>{0.795595229f, 0.732491434f},
-std::array<float,2>{0.357023507f, 0.5335899f},
-std::array<float,2>{0.907150686f, 0.0580438226f},
-std::array<float,2>{0.0470078401f, 0.396457404f},
-std::array<float,2>{0.705863476f, 0.904138803f},
-std::array<float,2>{0.0723193139f, 0.666027606f},
-std::array<float,2>{0.678102732f, 0.157758549f},
-std::array<float,2>{0.268510461f, 0.373533696f},
-std::array<float,2>{0.993496001f, 0.768489063f},
-std::array<float,2>{0.434797168f, 0.938147545f},
-std::array<float,2>{0.870058239f, 0.475576788f},
-std::array<float,2>{0.179927006f, 0.119568214f},
-std::array<float,2>{0.5320068f, 0.598325133f},
-std::array<float,2>{0.0237131678f, 0.920092106f},
-std::array<float,2>{0.732765138f, 0.408808112f},
-std::array<float,2>{0.312573552f, 0.0290620811f},
-std::array<float,2>{0.892446816f, 0.515340567f},
-std::array<float,2>{0.454011977f, 0.712347269f},
-std::array<float,2>{0.750044703f, 0.190871999f},
-std::array<float,2>{0.22757706f, 0.305570573f},
-std::array<float,2>{0.583331883f, 0.8206864f},
-std::array<float,2>{0.145819157f, 0.575318515f},
-std::array<float,2>{0.510775268f, 0.079817161f},
-std::array<float,2>{0.401838422f, 0.448075205f},
-std::array<float,2>{0.83322531f, 0.992252469f},
-std::array<float,2>{0.30799216f, 0.796067595f},
-std::array<float,2>{0.94511497f, 0.337312281f},
-std::array<float,2>{0.100957893f, 0.146018505f},
-std::array<float,2>{0.637900114f, 0.653770268f},
-std::array<float,2>{0.00615685759f, 0.787025511f},
-std::array<float,2>{0.735164404f, 0.329006553f},
-std::array<float,2>{0.338949472f, 0.150865451f},
-std::array<float,2>{0.880266666f, 0.644637764f},
-std::array<float,2>{0.446243614f, 0.564830422f},
-std::array<float,2>{0.769510686f, 0.0893172249f},
-std::array<float,2>{0.247520357f, 0.43912968f},
-std::array<float,2>{0.574070692f, 0.985939622f},
-std::array<float,2>{0.128359035f, 0.703622699f},
-std::array<float,2>{0.524997294f, 0.197195888f},
-std::array<float,2>{0.383045912f, 0.304380536f},
-std::array<float,2>{0.817519069f, 0.813463271f},
-std::array<float,2>{0.283127874f, 0.908361375f},
-std::array<float,2>{0.962667584f, 0.41764313f},
-std::array<float,2>{0.118900664f, 0.018911304f},
-std::array<float,2>{0.648189366f, 0.501876831f},
-std::array<float,2>{0.206773788f, 0.945669293f},
-std::array<float,2>{0.615589857f, 0.479970574f},
-std::array<float,2>{0.470880508f, 0.110923186f},
-std::array<float,2>{0.800860703f, 0.606640875f},
-std::array<float,2>{0.373622149f, 0.66302377f},
-std::array<float,2>{0.928440392f, 0.17033492f},
-std::array<float,2>{0.0348759517f, 0.366160244f},
-std::array<float,2>{0.698246837f, 0.774469018f},
-std::array<float,2>{0.0925383717f, 0.540969849f},
-std::array<float,2>{0.668130338f, 0.0517324768f},
-std::array<float,2>{0.25534448f, 0.400061846f},
-std::array<float,2>{0.983894944f, 0.896664202f},
-std::array<float,2>{0.410955101f, 0.869132578f},
-std::array<float,2>{0.846050858f, 0.250441045f},
-std::array<float,2>{0.163965151f, 0.245187894f},
-std::array<float,2>{0.547508776f, 0.725288212f},
-std::array<float,2>{0.186922863f, 0.835723758f},
-std::array<float,2>{0.538058937f, 0.283120424f},
-std::array<float,2>{0.432602257f, 0.211496606f},
-std::array<float,2>{0.871641874f, 0.701811016f},
-std::array<float,2>{0.273036361f, 0.516194344f},
-std::array<float,2>{0.998795033f, 0.00908542424f},
-std::array<float,2>{0.0780015662f, 0.43447724f},
-std::array<float,2>{0.674208403f, 0.930969357f},
-std::array<float,2>{0.0526043437f, 0.636140525f},
-std::array<float,2>{0.710765421f, 0.125423923f},
-std::array<float,2>{0.354997456f, 0.317179114f},
-std::array<float,2>{0.913289368f, 0.808431327f},
-std::array<float,2>{0.499770552f, 0.983001173f},
-std::array<float,2>{0.791175008f, 0.468326271f},
-std::array<float,2>{0.193929508f, 0.0727535486f},
-std::array<float,2>{0.608261645f, 0.580732107f},
-std::array<float,2>{0.0947908536f, 0.882744908f},
-std::array<float,2>{0.636293173f, 0.377947241f},
-std::array<float,2>{0.310003012f, 0.0361951515f},
-std::array<float,2>{0.937985599f, 0.559128523f},
-std::array<float,2>{0.405823499f, 0.74972564f},
-std::array<float,2>{0.829275787f, 0.224395797f},
-std::array<float,2>{0.141813591f, 0.268543839f},
-std::array<float,2>{0.514576614f, 0.844176829f},
-std::array<float,2>{0.233132556f, 0.61738044f},
-std::array<float,2>{0.581553817f, 0.109007068f},
-std::array<float,2>{0.457212389f, 0.494773f},
-std::array<float,2>{0.756043553f, 0.960624695f},
-std::array<float,2>{0.319537342f, 0.76560837f},
-std::array<float,2>{0.898434997f, 0.356547892f},
-std::array<float,2>{0.0279909763f, 0.172262788f},
-std::array<float,2>{0.727807522f, 0.672049105f},
-std::array<float,2>{0.066020906f, 0.85700947f},
-std::array<float,2>{0.686923802f, 0.27934745f},
-std::array<float,2>{0.276894808f, 0.228430748f},
-std::array<float,2>{0.99069804f, 0.740664184f},
-std::array<float,2>{0.427643746f, 0.551203549f},
-std::array<float,2>{0.863889813f, 0.0452316478f},
-std::array<float,2>{0.173925921f, 0.388477504f},
-std::array<float,2>{0.543284059f, 0.888762653f},
-std::array<float,2>{0.202150151f, 0.68528372f},
-std::array<float,2>{0.597188354f, 0.180314392f},
-std::array<float,2>{0.488355517f, 0.351255447f},
-std::array<float,2>{0.783806145f, 0.752317429f},
-std::array<float,2>{0.344837695f, 0.963991046f},
-std::array<float,2>{0.917391121f, 0.485919505f},
-std::array<float,2>{0.0603286177f, 0.095403254f},
-std::array<float,2>{0.713983238f, 0.610890031f},
-std::array<float,2>{0.155792952f, 0.925165951f},
-std::array<float,2>{0.506675243f, 0.423879832f},
-std::array<float,2>{0.396066636f, 0.00769986305f},
-std::array<float,2>{0.843312025f, 0.526972115f},
-std::array<float,2>{0.302485555f, 0.689004183f},
-std::array<float,2>{0.9519701f, 0.20861572f},
-std::array<float,2>{0.107127421f, 0.292843044f},
-std::array<float,2>{0.632765353f, 0.842741728f},
-std::array<float,2>{0.0175627172f, 0.587974548f},
-std::array<float,2>{0.726025224f, 0.0649223551f},
-std::array<float,2>{0.325638592f, 0.460363179f},
-std::array<float,2>{0.904354692f, 0.970851481f},
-std::array<float,2>{0.461874187f, 0.804615915f},
-std::array<float,2>{0.761263728f, 0.326114237f},
-std::array<float,2>{0.225364402f, 0.139793858f},
-std::array<float,2>{0.591219962f, 0.629907846f},
-std::array<float,2>{0.235802993f, 0.772018969f},
-std::array<float,2>{0.569679379f, 0.367460966f},
-std::array<float,2>{0.445284247f, 0.161747769f},
-std::array<float,2>{0.777050972f, 0.670148432f},
-std::array<float,2>{0.335338384f, 0.596408844f},
-std::array<float,2>{0.885846972f, 0.121243149f},
-std::array<float,2>{0.0145290792f, 0.469888687f},
-std::array<float,2>{0.748069584f, 0.944346011f},
-std::array<float,2>{0.11689847f, 0.730177283f},
-std::array<float,2>{0.652949452f, 0.239062101f},
-std::array<float,2>{0.294628143f, 0.261793166f},
-std::array<float,2>{0.954523146f, 0.859537423f},
-std::array<float,2>{0.381776124f, 0.899281561f},
-std::array<float,2>{0.827493072f, 0.394250721f},
-std::array<float,2>{0.13500756f, 0.0596582517f},
-std::array<float,2>{0.520340562f, 0.538839638f},
-std::array<float,2>{0.0411892422f, 0.999461651f},
-std::array<float,2>{0.690448284f, 0.451183915f},
-std::array<float,2>{0.363774389f, 0.085017018f},
-std::array<float,2>{0.933464408f, 0.573069274f},
-std::array<float,2>{0.483336478f, 0.650332928f},
-std::array<float,2>{0.812385142f, 0.144223556f},
-std::array<float,2>{0.211531878f, 0.341656655f},
-std::array<float,2>{0.622012436f, 0.792808115f},
-std::array<float,2>{0.16802977f, 0.509720147f},
-std::array<float,2>{0.561420202f, 0.0243050419f},
-std::array<float,2>{0.418557763f, 0.411673456f},
-std::array<float,2>{0.857228756f, 0.915819049f},
-std::array<float,2>{0.262345433f, 0.824320495f},
-std::array<float,2>{0.971864223f, 0.310707718f},
-std::array<float,2>{0.0806365162f, 0.19141008f},
-std::array<float,2>{0.663557589f, 0.716257989f},
-std::array<float,2>{0.0198321193f, 0.872829974f},
-std::array<float,2>{0.719213068f, 0.255315542f},
-std::array<float,2>{0.323022127f, 0.247260049f},
-std::array<float,2>{0.899215937f, 0.718967557f},
-std::array<float,2>{0.468288004f, 0.54569149f},
-std::array<float,2>{0.765026569f, 0.046982836f},
-std::array<float,2>{0.2221421f, 0.404262334f},
-std::array<float,2>{0.58743906f, 0.893797815f},
-std::array<float,2>{0.149357021f, 0.659662247f},
-std::array<float,2>{0.501502752f, 0.166323394f},
-std::array<float,2>{0.393545419f, 0.36249882f},
-std::array<float,2>{0.836455464f, 0.777418256f},
-std::array<float,2>{0.298428416f, 0.950499952f},
-std::array<float,2>{0.948370039f, 0.483082026f},
-std::array<float,2>{0.104701445f, 0.114734516f},
-std::array<float,2>{0.627843201f, 0.604613364f},
-std::array<float,2>{0.198688045f, 0.913554668f},
-std::array<float,2>{0.600142241f, 0.419395477f},
-std::array<float,2>{0.488263309f, 0.0211890191f},
-std::array<float,2>{0.788305879f, 0.506727576f},
-std::array<float,2>{0.350594491f, 0.708191454f},
-std::array<float,2>{0.919397175f, 0.202966675f},
-std::array<float,2>{0.0561791956f, 0.298645556f},
-std::array<float,2>{0.716597199f, 0.819266379f},
-std::array<float,2>{0.0693239495f, 0.567238092f},
-std::array<float,2>{0.68332541f, 0.0930934772f},
-std::array<float,2>{0.278093964f, 0.44271782f},
-std::array<float,2>{0.98672384f, 0.988886952f},
-std::array<float,2>{0.4230178f, 0.781444013f},
-std::array<float,2>{0.862324953f, 0.333476454f},
-std::array<float,2>{0.177753493f, 0.153346702f},
-std::array<float,2>{0.539835095f, 0.641236007f},
-std::array<float,2>{0.166813955f, 0.757858396f},
-std::array<float,2>{0.556859612f, 0.354706198f},
-std::array<float,2>{0.417951167f, 0.177405149f},
-std::array<float,2>{0.852426529f, 0.676977932f},
-std::array<float,2>{0.260221124f, 0.624179542f},
-std::array<float,2>{0.974814355f, 0.101935998f},
-std::array<float,2>{0.0847451314f, 0.497248471f},
-std::array<float,2>{0.659451187f, 0.95496285f},
-std::array<float,2>{0.0441968739f, 0.743155003f},
-std::array<float,2>{0.691896021f, 0.219090551f},
-std::array<float,2>{0.359733671f, 0.27315703f},
-std::array<float,2>{0.934269309f, 0.848996639f},
-std::array<float,2>{0.478921592f, 0.875329792f},
-std::array<float,2>{0.804923952f, 0.380421996f},
-std::array<float,2>{0.217000425f, 0.0349640846f},
-std::array<float,2>{0.618676901f, 0.55773443f},
-std::array<float,2>{0.109854572f, 0.976914465f},
-std::array<float,2>{0.652154982f, 0.463050604f},
-std::array<float,2>{0.292968005f, 0.0749127045f},
-std::array<float,2>{0.960910976f, 0.585221708f},
-std::array<float,2>{0.378844172f, 0.636942923f},
-std::array<float,2>{0.82204777f, 0.128917024f},
-std::array<float,2>{0.138861984f, 0.313387722f},
-std::array<float,2>{0.517002523f, 0.81108892f},
-std::array<float,2>{0.239104107f, 0.523161829f},
-std::array<float,2>{0.566203892f, 0.0147996983f},
-std::array<float,2>{0.439431727f, 0.432015896f},
-std::array<float,2>{0.77842468f, 0.937471807f},
-std::array<float,2>{0.328866124f, 0.830615342f},
-std::array<float,2>{0.889342308f, 0.288534582f},
-std::array<float,2>{0.00969400816f, 0.218365282f},
-std::array<float,2>{0.742650747f, 0.697333932f},
-std::array<float,2>{0.0869543478f, 0.798371255f},
-std::array<float,2>{0.664281726f, 0.322782516f},
-std::array<float,2>{0.250395685f, 0.136492252f},
-std::array<float,2>{0.980072916f, 0.627682567f},
-std::array<float,2>{0.409947246f, 0.591722667f},
-std::array<float,2>{0.850499928f, 0.069878839f},
-std::array<float,2>{0.157067984f, 0.454417467f},
-std::array<float,2>{0.551356435f, 0.975700617f},
-std::array<float,2>{0.210526422f, 0.694594443f},
-std::array<float,2>{0.610435903f, 0.206719592f},
-std::array<float,2>{0.473807007f, 0.295105577f},
-std::array<float,2>{0.797742546f, 0.838636398f},
-std::array<float,2>{0.370720029f, 0.927413583f},
-std::array<float,2>{0.924365878f, 0.429666698f},
-std::array<float,2>{0.0368694365f, 0.000618516118f},
-std::array<float,2>{0.702702701f, 0.53064543f},
-std::array<float,2>{0.131393045f, 0.966090262f},
-std::array<float,2>{0.528340101f, 0.491573632f},
-std::array<float,2>{0.38726306f, 0.0985822752f},
-std::array<float,2>{0.813921213f, 0.614148319f},
-std::array<float,2>{0.289010912f, 0.683227658f},
-std::array<float,2>{0.967521548f, 0.187488616f},
-std::array<float,2>{0.123929955f, 0.345592648f},
-std::array<float,2>{0.642548442f, 0.756681859f},
-std::array<float,2>{0.00119584345f, 0.548388779f},
-std::array<float,2>{0.741669953f, 0.041864384f},
-std::array<float,2>{0.340149701f, 0.384016246f},
-std::array<float,2>{0.875745356f, 0.883345366f},
-std::array<float,2>{0.452245146f, 0.854173481f},
-std::array<float,2>{0.770503104f, 0.275030792f},
-std::array<float,2>{0.243212879f, 0.233717427f},
-std::array<float,2>{0.575439632f, 0.736156583f},
-std::array<float,2>{0.228755981f, 0.822753251f},
-std::array<float,2>{0.584098518f, 0.307555735f},
-std::array<float,2>{0.456648737f, 0.188433304f},
-std::array<float,2>{0.75264895f, 0.714017332f},
-std::array<float,2>{0.314683408f, 0.512934744f},
-std::array<float,2>{0.894203186f, 0.0296667423f},
-std::array<float,2>{0.0270128157f, 0.407637089f},
-std::array<float,2>{0.732316911f, 0.919453621f},
-std::array<float,2>{0.0977864563f, 0.656033754f},
-std::array<float,2>{0.638888538f, 0.14765574f},
-std::array<float,2>{0.306302458f, 0.339748979f},
-std::array<float,2>{0.943284988f, 0.79427743f},
-std::array<float,2>{0.398518115f, 0.995725155f},
-std::array<float,2>{0.834157705f, 0.446676433f},
-std::array<float,2>{0.146593407f, 0.0806239545f},
-std::array<float,2>{0.508850813f, 0.577447474f},
-std::array<float,2>{0.0492942333f, 0.905303538f},
-std::array<float,2>{0.704575896f, 0.397411048f},
-std::array<float,2>{0.358649313f, 0.056262143f},
-std::array<float,2>{0.908965886f, 0.532260597f},
-std::array<float,2>{0.495070398f, 0.730915666f},
-std::array<float,2>{0.794799268f, 0.235130996f},
-std::array<float,2>{0.19075039f, 0.261146456f},
-std::array<float,2>{0.601680279f, 0.864281952f},
-std::array<float,2>{0.182403371f, 0.599757671f},
-std::array<float,2>{0.534691274f, 0.117453977f},
-std::array<float,2>{0.436653525f, 0.473266482f},
-std::array<float,2>{0.867533565f, 0.941145957f},
-std::array<float,2>{0.266451836f, 0.767101705f},
-std::array<float,2>{0.99503547f, 0.371977419f},
-std::array<float,2>{0.0717379898f, 0.159731284f},
-std::array<float,2>{0.676826954f, 0.665869176f},
-std::array<float,2>{0.0328791104f, 0.776661038f},
-std::array<float,2>{0.696458936f, 0.364637047f},
-std::array<float,2>{0.371920913f, 0.16963394f},
-std::array<float,2>{0.927156985f, 0.661854744f},
-std::array<float,2>{0.470528603f, 0.608514965f},
-std::array<float,2>{0.80345881f, 0.112656675f},
-std::array<float,2>{0.203922048f, 0.477585673f},
-std::array<float,2>{0.614621639f, 0.947312534f},
-std::array<float,2>{0.161472499f, 0.723747551f},
-std::array<float,2>{0.550028443f, 0.244019151f},
-std::array<float,2>{0.412910193f, 0.251956612f},
-std::array<float,2>{0.845574558f, 0.869457245f},
-std::array<float,2>{0.255951911f, 0.895870388f},
-std::array<float,2>{0.981635511f, 0.400532573f},
-std::array<float,2>{0.0917086378f, 0.052770745f},
-std::array<float,2>{0.671410739f, 0.541517019f},
-std::array<float,2>{0.248616114f, 0.987905383f},
-std::array<float,2>{0.57046634f, 0.440943509f},
-std::array<float,2>{0.448403955f, 0.0867037699f},
-std::array<float,2>{0.76570636f, 0.563122451f},
-std::array<float,2>{0.337081432f, 0.647295713f},
-std::array<float,2>{0.88215065f, 0.149055943f},
-std::array<float,2>{0.00437935395f, 0.330096722f},
-std::array<float,2>{0.737463653f, 0.788147807f},
-std::array<float,2>{0.119562618f, 0.5029006f},
-std::array<float,2>{0.645164609f, 0.0160442889f},
-std::array<float,2>{0.283265591f, 0.414135695f},
-std::array<float,2>{0.962893188f, 0.906613946f},
-std::array<float,2>{0.385774106f, 0.815879643f},
-std::array<float,2>{0.818773568f, 0.302717805f},
-std::array<float,2>{0.125314072f, 0.198599115f},
-std::array<float,2>{0.525682867f, 0.705964267f},
-std::array<float,2>{0.142895326f, 0.846522272f},
-std::array<float,2>{0.513624668f, 0.266901731f},
-std::array<float,2>{0.40331161f, 0.225723997f},
-std::array<float,2>{0.831923664f, 0.747760773f},
-std::array<float,2>{0.310817182f, 0.561092973f},
-std::array<float,2>{0.941194654f, 0.039035067f},
-std::array<float,2>{0.0971021876f, 0.375430554f},
-std::array<float,2>{0.632875621f, 0.879935622f},
-std::array<float,2>{0.0299088899f, 0.674606919f},
-std::array<float,2>{0.728986204f, 0.174105257f},
-std::array<float,2>{0.318323821f, 0.358663738f},
-std::array<float,2>{0.896215737f, 0.763399482f},
-std::array<float,2>{0.460230201f, 0.957524002f},
-std::array<float,2>{0.755600095f, 0.492193103f},
-std::array<float,2>{0.231807858f, 0.105808243f},
-std::array<float,2>{0.579199195f, 0.619142532f},
-std::array<float,2>{0.0743451044f, 0.93171072f},
-std::array<float,2>{0.672016323f, 0.435758203f},
-std::array<float,2>{0.27066496f, 0.00991818309f},
-std::array<float,2>{0.996116996f, 0.517611861f},
-std::array<float,2>{0.430126816f, 0.69964695f},
-std::array<float,2>{0.874957502f, 0.214622706f},
-std::array<float,2>{0.184938282f, 0.283684134f},
-std::array<float,2>{0.535571933f, 0.83252418f},
-std::array<float,2>{0.192856744f, 0.578496337f},
-std::array<float,2>{0.605780721f, 0.0704646036f},
-std::array<float,2>{0.496308446f, 0.466609538f},
-std::array<float,2>{0.789586186f, 0.981115341f},
-std::array<float,2>{0.352078408f, 0.805945873f},
-std::array<float,2>{0.911362886f, 0.319791794f},
-std::array<float,2>{0.0542785823f, 0.1288964f},
-std::array<float,2>{0.708351791f, 0.634652853f},
-std::array<float,2>{0.107495993f, 0.841157436f},
-std::array<float,2>{0.62958777f, 0.290074468f},
-std::array<float,2>{0.303011596f, 0.210045084f},
-std::array<float,2>{0.950207591f, 0.689480901f},
-std::array<float,2>{0.397324413f, 0.524550736f},
-std::array<float,2>{0.840141356f, 0.0051161414f},
-std::array<float,2>{0.153767243f, 0.423210084f},
-std::array<float,2>{0.505644619f, 0.923780501f},
-std::array<float,2>{0.223184526f, 0.631675124f},
-std::array<float,2>{0.591915488f, 0.137512788f},
-std::array<float,2>{0.464055866f, 0.327520818f},
-std::array<float,2>{0.757894576f, 0.802277863f},
-std::array<float,2>{0.327252805f, 0.970000505f},
-std::array<float,2>{0.903438926f, 0.457511932f},
-std::array<float,2>{0.0178154148f, 0.0635914281f},
-std::array<float,2>{0.723281562f, 0.586245f},
-std::array<float,2>{0.173202798f, 0.888210952f},
-std::array<float,2>{0.546584249f, 0.390315294f},
-std::array<float,2>{0.428715289f, 0.0435995199f},
-std::array<float,2>{0.865737677f, 0.554193497f},
-std::array<float,2>{0.274984628f, 0.738469601f},
-std::array<float,2>{0.989451706f, 0.229429156f},
-std::array<float,2>{0.0641020909f, 0.278904855f},
-std::array<float,2>{0.683709204f, 0.859108567f},
-std::array<float,2>{0.0615865476f, 0.611462593f},
-std::array<float,2>{0.712217629f, 0.0975866243f},
-std::array<float,2>{0.347004622f, 0.487010121f},
-std::array<float,2>{0.915321529f, 0.962332249f},
-std::array<float,2>{0.490819365f, 0.751474679f},
-std::array<float,2>{0.781826198f, 0.34811452f},
-std::array<float,2>{0.201109737f, 0.183584571f},
-std::array<float,2>{0.594535768f, 0.686724007f},
-std::array<float,2>{0.214268595f, 0.790261328f},
-std::array<float,2>{0.623963177f, 0.342126071f},
-std::array<float,2>{0.481188774f, 0.141234741f},
-std::array<float,2>{0.808637321f, 0.650448203f},
-std::array<float,2>{0.366453856f, 0.572035849f},
-std::array<float,2>{0.930037022f, 0.082410045f},
-std::array<float,2>{0.03949425f, 0.449561417f},
-std::array<float,2>{0.688662469f, 0.996207237f},
-std::array<float,2>{0.0785747096f, 0.717149019f},
-std::array<float,2>{0.660267293f, 0.194233432f},
-std::array<float,2>{0.264605045f, 0.309709519f},
-std::array<float,2>{0.970533788f, 0.82798928f},
-std::array<float,2>{0.419924736f, 0.916910052f},
-std::array<float,2>{0.859215677f, 0.413996845f},
-std::array<float,2>{0.170993418f, 0.025850594f},
-std::array<float,2>{0.559387624f, 0.510833919f},
-std::array<float,2>{0.013069191f, 0.941892982f},
-std::array<float,2>{0.746794462f, 0.472037524f},
-std::array<float,2>{0.332787693f, 0.12374755f},
-std::array<float,2>{0.883842826f, 0.595216334f},
-std::array<float,2>{0.442384481f, 0.669814706f},
-std::array<float,2>{0.77399385f, 0.162955254f},
-std::array<float,2>{0.236424997f, 0.369560272f},
-std::array<float,2>{0.568205655f, 0.770434797f},
-std::array<float,2>{0.132883251f, 0.536276698f},
-std::array<float,2>{0.521567881f, 0.0615175962f},
-std::array<float,2>{0.380724669f, 0.392254055f},
-std::array<float,2>{0.825251639f, 0.900937498f},
-std::array<float,2>{0.29591763f, 0.862562895f},
-std::array<float,2>{0.955183744f, 0.264367133f},
-std::array<float,2>{0.113602556f, 0.241198644f},
-std::array<float,2>{0.654602647f, 0.728279829f},
-std::array<float,2>{0.00871996023f, 0.828189611f},
-std::array<float,2>{0.744025528f, 0.287004977f},
-std::array<float,2>{0.329482734f, 0.215233952f},
-std::array<float,2>{0.890498579f, 0.695836544f},
-std::array<float,2>{0.438081861f, 0.519811034f},
-std::array<float,2>{0.778204381f, 0.0122593837f},
-std::array<float,2>{0.239499301f, 0.430602342f},
-std::array<float,2>{0.565376341f, 0.934726298f},
-std::array<float,2>{0.140114933f, 0.639161646f},
-std::array<float,2>{0.516063333f, 0.131321296f},
-std::array<float,2>{0.377435058f, 0.314893603f},
-std::array<float,2>{0.821006775f, 0.809033334f},
-std::array<float,2>{0.291653723f, 0.98031193f},
-std::array<float,2>{0.959892333f, 0.462644011f},
-std::array<float,2>{0.11119771f, 0.077414915f},
-std::array<float,2>{0.650573492f, 0.583224773f},
-std::array<float,2>{0.218063146f, 0.877311289f},
-std::array<float,2>{0.617808521f, 0.381766379f},
-std::array<float,2>{0.480276406f, 0.0329438485f},
-std::array<float,2>{0.806591094f, 0.556567967f},
-std::array<float,2>{0.360739559f, 0.745048344f},
-std::array<float,2>{0.935132205f, 0.221822053f},
-std::array<float,2>{0.0431622714f, 0.270018339f},
-std::array<float,2>{0.692765296f, 0.850300014f},
-std::array<float,2>{0.0851721913f, 0.622285724f},
-std::array<float,2>{0.658804834f, 0.103664227f},
-std::array<float,2>{0.261101067f, 0.499821603f},
-std::array<float,2>{0.975752234f, 0.956993282f},
-std::array<float,2>{0.416681647f, 0.760417402f},
-std::array<float,2>{0.853078723f, 0.352291048f},
-std::array<float,2>{0.167177945f, 0.178168446f},
-std::array<float,2>{0.557836056f, 0.679255486f},
-std::array<float,2>{0.178744122f, 0.784269512f},
-std::array<float,2>{0.540131032f, 0.335683703f},
-std::array<float,2>{0.422258973f, 0.155746892f},
-std::array<float,2>{0.861978769f, 0.644034207f},
-std::array<float,2>{0.278892666f, 0.569711208f},
-std::array<float,2>{0.987950683f, 0.0902850255f},
-std::array<float,2>{0.0699683204f, 0.444339901f},
-std::array<float,2>{0.682575464f, 0.991503119f},
-std::array<float,2>{0.0550506338f, 0.709843278f},
-std::array<float,2>{0.715539753f, 0.199551523f},
-std::array<float,2>{0.350183636f, 0.30033651f},
-std::array<float,2>{0.918844938f, 0.81824553f},
-std::array<float,2>{0.48710978f, 0.911998451f},
-std::array<float,2>{0.787875712f, 0.421595693f},
-std::array<float,2>{0.197719067f, 0.0219226498f},
-std::array<float,2>{0.601172864f, 0.505410969f},
-std::array<float,2>{0.103540704f, 0.951598823f},
-std::array<float,2>{0.628351629f, 0.482292414f},
-std::array<float,2>{0.297410548f, 0.116860442f},
-std::array<float,2>{0.947445333f, 0.602755427f},
-std::array<float,2>{0.394496828f, 0.657948792f},
-std::array<float,2>{0.837153435f, 0.164180398f},
-std::array<float,2>{0.150363743f, 0.361115694f},
-std::array<float,2>{0.500467479f, 0.779300034f},
-std::array<float,2>{0.22150743f, 0.544433355f},
-std::array<float,2>{0.586886883f, 0.0489096157f},
-std::array<float,2>{0.467384756f, 0.404843748f},
-std::array<float,2>{0.764081776f, 0.891560555f},
-std::array<float,2>{0.323275536f, 0.874228716f},
-std::array<float,2>{0.900281906f, 0.25749138f},
-std::array<float,2>{0.0213920623f, 0.248454913f},
-std::array<float,2>{0.720434725f, 0.722217262f},
-std::array<float,2>{0.0711915866f, 0.769085228f},
-std::array<float,2>{0.67579931f, 0.374434412f},
-std::array<float,2>{0.267203748f, 0.156590462f},
-std::array<float,2>{0.995441377f, 0.667763054f},
-std::array<float,2>{0.435609281f, 0.598917603f},
-std::array<float,2>{0.869065642f, 0.120491505f},
-std::array<float,2>{0.183488578f, 0.475620449f},
-std::array<float,2>{0.53326273f, 0.938852191f},
-std::array<float,2>{0.189732075f, 0.733543873f},
-std::array<float,2>{0.602752805f, 0.236859694f},
-std::array<float,2>{0.49599117f, 0.259092748f},
-std::array<float,2>{0.793474376f, 0.86654073f},
-std::array<float,2>{0.357775062f, 0.90287298f},
-std::array<float,2>{0.90950048f, 0.394581825f},
-std::array<float,2>{0.0500473529f, 0.0575089119f},
-std::array<float,2>{0.703826785f, 0.534628689f},
-std::array<float,2>{0.148037821f, 0.993851483f},
-std::array<float,2>{0.507960558f, 0.448901922f},
-std::array<float,2>{0.399861664f, 0.0788088292f},
-std::array<float,2>{0.835186422f, 0.5742535f},
-std::array<float,2>{0.305286646f, 0.652379632f},
-std::array<float,2>{0.94155556f, 0.144654766f},
-std::array<float,2>{0.098917298f, 0.336309195f},
-std::array<float,2>{0.640201151f, 0.79550916f},
-std::array<float,2>{0.0261770766f, 0.514352262f},
-std::array<float,2>{0.731191516f, 0.0278732143f},
-std::array<float,2>{0.315884978f, 0.409475833f},
-std::array<float,2>{0.893544734f, 0.921490192f},
-std::array<float,2>{0.455536127f, 0.821409166f},
-std::array<float,2>{0.753728569f, 0.306458563f},
-std::array<float,2>{0.230100721f, 0.189621791f},
-std::array<float,2>{0.58496356f, 0.711501122f},
-std::array<float,2>{0.242799222f, 0.852659523f},
-std::array<float,2>{0.574902713f, 0.276035011f},
-std::array<float,2>{0.451549143f, 0.231028199f},
-std::array<float,2>{0.77089411f, 0.736617506f},
-std::array<float,2>{0.341030866f, 0.550374448f},
-std::array<float,2>{0.876534104f, 0.0400726907f},
-std::array<float,2>{0.000423487247f, 0.384994775f},
-std::array<float,2>{0.740866542f, 0.885466516f},
-std::array<float,2>{0.124382287f, 0.680444121f},
-std::array<float,2>{0.641496658f, 0.185057044f},
-std::array<float,2>{0.287390828f, 0.346138328f},
-std::array<float,2>{0.968039215f, 0.754361451f},
-std::array<float,2>{0.387892962f, 0.967722654f},
-std::array<float,2>{0.812991798f, 0.48861894f},
-std::array<float,2>{0.132303849f, 0.100582011f},
-std::array<float,2>{0.527998805f, 0.616271019f},
-std::array<float,2>{0.0357999019f, 0.928537548f},
-std::array<float,2>{0.701979995f, 0.426253468f},
-std::array<float,2>{0.369768202f, 0.00223586871f},
-std::array<float,2>{0.925152004f, 0.529023528f},
-std::array<float,2>{0.472735524f, 0.692980707f},
-std::array<float,2>{0.798665047f, 0.204299822f},
-std::array<float,2>{0.209695578f, 0.293901861f},
-std::array<float,2>{0.609385133f, 0.837116182f},
-std::array<float,2>{0.158194676f, 0.593727112f},
-std::array<float,2>{0.552378118f, 0.0676424727f},
-std::array<float,2>{0.408854961f, 0.456154197f},
-std::array<float,2>{0.851095736f, 0.974090278f},
-std::array<float,2>{0.251848847f, 0.800122321f},
-std::array<float,2>{0.978811085f, 0.320925653f},
-std::array<float,2>{0.086783424f, 0.13296245f},
-std::array<float,2>{0.665623903f, 0.625954986f},
-std::array<float,2>{0.0533185937f, 0.807570875f},
-std::array<float,2>{0.707246423f, 0.317868948f},
-std::array<float,2>{0.353336126f, 0.126879975f},
-std::array<float,2>{0.910321176f, 0.634866357f},
-std::array<float,2>{0.497675687f, 0.581696332f},
-std::array<float,2>{0.790551126f, 0.0741252378f},
-std::array<float,2>{0.19164142f, 0.466930479f},
-std::array<float,2>{0.607031822f, 0.983870447f},
-std::array<float,2>{0.184334233f, 0.702687263f},
-std::array<float,2>{0.536767483f, 0.212512642f},
-std::array<float,2>{0.431452513f, 0.281274199f},
-std::array<float,2>{0.873995483f, 0.834252119f},
-std::array<float,2>{0.269842833f, 0.930266023f},
-std::array<float,2>{0.997505903f, 0.434966475f},
-std::array<float,2>{0.0756788477f, 0.00855929218f},
-std::array<float,2>{0.673191607f, 0.516885519f},
-std::array<float,2>{0.230470017f, 0.959442139f},
-std::array<float,2>{0.578772664f, 0.495129496f},
-std::array<float,2>{0.459784299f, 0.107873112f},
-std::array<float,2>{0.754408598f, 0.618473828f},
-std::array<float,2>{0.31680271f, 0.673097014f},
-std::array<float,2>{0.895276248f, 0.172998101f},
-std::array<float,2>{0.0306778066f, 0.356084883f},
-std::array<float,2>{0.729722083f, 0.76434958f},
-std::array<float,2>{0.0962875485f, 0.559945822f},
-std::array<float,2>{0.634239316f, 0.0352196507f},
-std::array<float,2>{0.312052846f, 0.377550036f},
-std::array<float,2>{0.940062821f, 0.880888939f},
-std::array<float,2>{0.403460175f, 0.844751775f},
-std::array<float,2>{0.830992401f, 0.26878649f},
-std::array<float,2>{0.143694684f, 0.222871184f},
-std::array<float,2>{0.512459397f, 0.748510718f},
-std::array<float,2>{0.126504347f, 0.814442039f},
-std::array<float,2>{0.527088165f, 0.303673118f},
-std::array<float,2>{0.385642111f, 0.195509508f},
-std::array<float,2>{0.819594681f, 0.704313219f},
-std::array<float,2>{0.284443706f, 0.500332534f},
-std::array<float,2>{0.964099467f, 0.0177672543f},
-std::array<float,2>{0.120190822f, 0.416308612f},
-std::array<float,2>{0.646458328f, 0.909454048f},
-std::array<float,2>{0.00531461695f, 0.645795584f},
-std::array<float,2>{0.736962557f, 0.15222609f},
-std::array<float,2>{0.336636066f, 0.329682499f},
-std::array<float,2>{0.881464124f, 0.785903871f},
-std::array<float,2>{0.447389692f, 0.984437048f},
-std::array<float,2>{0.767404854f, 0.437559128f},
-std::array<float,2>{0.249042302f, 0.0879584327f},
-std::array<float,2>{0.571659923f, 0.565619469f},
-std::array<float,2>{0.0902094766f, 0.897801578f},
-std::array<float,2>{0.670047343f, 0.399316341f},
-std::array<float,2>{0.257094055f, 0.0527280271f},
-std::array<float,2>{0.981440783f, 0.539497554f},
-std::array<float,2>{0.413778543f, 0.725995183f},
-std::array<float,2>{0.844634056f, 0.244409949f},
-std::array<float,2>{0.16085355f, 0.251310766f},
-std::array<float,2>{0.549523711f, 0.867713749f},
-std::array<float,2>{0.205016539f, 0.605817318f},
-std::array<float,2>{0.614144444f, 0.109933436f},
-std::array<float,2>{0.46933639f, 0.479127556f},
-std::array<float,2>{0.804525971f, 0.947181344f},
-std::array<float,2>{0.37259379f, 0.774292529f},
-std::array<float,2>{0.926019132f, 0.366654783f},
-std::array<float,2>{0.0317307971f, 0.171324432f},
-std::array<float,2>{0.696034431f, 0.663674831f},
-std::array<float,2>{0.114342436f, 0.861172438f},
-std::array<float,2>{0.655506849f, 0.263218969f},
-std::array<float,2>{0.294965953f, 0.239987999f},
-std::array<float,2>{0.95690918f, 0.728520751f},
-std::array<float,2>{0.379126698f, 0.537536263f},
-std::array<float,2>{0.825130582f, 0.0588949844f},
-std::array<float,2>{0.134682462f, 0.39342922f},
-std::array<float,2>{0.522851586f, 0.899481952f},
-std::array<float,2>{0.237390444f, 0.671762645f},
-std::array<float,2>{0.566667378f, 0.161114469f},
-std::array<float,2>{0.441663712f, 0.368319839f},
-std::array<float,2>{0.774418294f, 0.773349047f},
-std::array<float,2>{0.333348334f, 0.944312572f},
-std::array<float,2>{0.88315618f, 0.468951702f},
-std::array<float,2>{0.0126315113f, 0.12287987f},
-std::array<float,2>{0.747106075f, 0.597103894f},
-std::array<float,2>{0.170816883f, 0.91459465f},
-std::array<float,2>{0.560010493f, 0.411070436f},
-std::array<float,2>{0.420939088f, 0.0250714198f},
-std::array<float,2>{0.857999086f, 0.508700967f},
-std::array<float,2>{0.265545696f, 0.715789497f},
-std::array<float,2>{0.969643533f, 0.192534596f},
-std::array<float,2>{0.0797801018f, 0.312250435f},
-std::array<float,2>{0.662102342f, 0.825572491f},
-std::array<float,2>{0.0403222814f, 0.573745966f},
-std::array<float,2>{0.687888682f, 0.0845027789f},
-std::array<float,2>{0.365519196f, 0.452248216f},
-std::array<float,2>{0.931078017f, 0.998684704f},
-std::array<float,2>{0.482107639f, 0.791982889f},
-std::array<float,2>{0.810052991f, 0.340679973f},
-std::array<float,2>{0.213721678f, 0.142933547f},
-std::array<float,2>{0.624723136f, 0.649336755f},
-std::array<float,2>{0.199330598f, 0.753418326f},
-std::array<float,2>{0.594869614f, 0.35046193f},
-std::array<float,2>{0.491271555f, 0.180759177f},
-std::array<float,2>{0.782680571f, 0.684259236f},
-std::array<float,2>{0.346079022f, 0.609462976f},
-std::array<float,2>{0.914564252f, 0.0942535624f},
-std::array<float,2>{0.0606697723f, 0.484392881f},
-std::array<float,2>{0.711432695f, 0.96330595f},
-std::array<float,2>{0.0626560003f, 0.741890132f},
-std::array<float,2>{0.685462952f, 0.227060854f},
-std::array<float,2>{0.274223894f, 0.280556977f},
-std::array<float,2>{0.988604665f, 0.855631411f},
-std::array<float,2>{0.42844981f, 0.890476823f},
-std::array<float,2>{0.866773486f, 0.387559742f},
-std::array<float,2>{0.172288626f, 0.046591647f},
-std::array<float,2>{0.545645118f, 0.552430809f},
-std::array<float,2>{0.0192520469f, 0.972142577f},
-std::array<float,2>{0.724360764f, 0.459517419f},
-std::array<float,2>{0.326418579f, 0.0656660348f},
-std::array<float,2>{0.902780831f, 0.589802027f},
-std::array<float,2>{0.463421851f, 0.629190147f},
-std::array<float,2>{0.759163737f, 0.13912192f},
-std::array<float,2>{0.224508837f, 0.324535161f},
-std::array<float,2>{0.593161941f, 0.803550601f},
-std::array<float,2>{0.153262988f, 0.526037037f},
-std::array<float,2>{0.504303575f, 0.00670257304f},
-std::array<float,2>{0.398192823f, 0.425672233f},
-std::array<float,2>{0.840826929f, 0.923883498f},
-std::array<float,2>{0.304483294f, 0.843577623f},
-std::array<float,2>{0.949828923f, 0.291301847f},
-std::array<float,2>{0.10887441f, 0.207532421f},
-std::array<float,2>{0.630496204f, 0.687607944f},
-std::array<float,2>{0.0464525744f, 0.848311007f},
-std::array<float,2>{0.693947613f, 0.272455543f},
-std::array<float,2>{0.361626804f, 0.220221534f},
-std::array<float,2>{0.935959697f, 0.743407488f},
-std::array<float,2>{0.477714032f, 0.557094216f},
-std::array<float,2>{0.808064282f, 0.033948455f},
-std::array<float,2>{0.215509623f, 0.379605055f},
-std::array<float,2>{0.62085098f, 0.876391947f},
-std::array<float,2>{0.165237814f, 0.675823033f},
-std::array<float,2>{0.554930866f, 0.1758506f},
-std::array<float,2>{0.414824158f, 0.354208678f},
-std::array<float,2>{0.854443192f, 0.758876324f},
-std::array<float,2>{0.259753764f, 0.95378685f},
-std::array<float,2>{0.974569499f, 0.496801585f},
-std::array<float,2>{0.0824363306f, 0.102760836f},
-std::array<float,2>{0.656550944f, 0.623389125f},
-std::array<float,2>{0.241300955f, 0.935850561f},
-std::array<float,2>{0.563087702f, 0.433043748f},
-std::array<float,2>{0.43971172f, 0.0138587952f},
-std::array<float,2>{0.780454636f, 0.522037327f},
-std::array<float,2>{0.331508338f, 0.698463082f},
-std::array<float,2>{0.886834085f, 0.21740827f},
-std::array<float,2>{0.0116818864f, 0.287268251f},
-std::array<float,2>{0.74489069f, 0.831240296f},
-std::array<float,2>{0.112037577f, 0.584547877f},
-std::array<float,2>{0.649796665f, 0.075897336f},
-std::array<float,2>{0.289339364f, 0.464249372f},
-std::array<float,2>{0.957846582f, 0.978292704f},
-std::array<float,2>{0.376443028f, 0.812116265f},
-std::array<float,2>{0.8231498f, 0.313964903f},
-std::array<float,2>{0.137992814f, 0.130372822f},
-std::array<float,2>{0.51819104f, 0.638483107f},
-std::array<float,2>{0.152275547f, 0.778424561f},
-std::array<float,2>{0.502343237f, 0.361393601f},
-std::array<float,2>{0.392539352f, 0.167309672f},
-std::array<float,2>{0.839175165f, 0.658640206f},
-std::array<float,2>{0.300267518f, 0.604488015f},
-std::array<float,2>{0.945790648f, 0.113483205f},
-std::array<float,2>{0.103201486f, 0.484304845f},
-std::array<float,2>{0.626416326f, 0.949615896f},
-std::array<float,2>{0.0225110054f, 0.720173299f},
-std::array<float,2>{0.721693993f, 0.246911451f},
-std::array<float,2>{0.321770281f, 0.254512846f},
-std::array<float,2>{0.901493311f, 0.871769547f},
-std::array<float,2>{0.466786414f, 0.893224955f},
-std::array<float,2>{0.763558805f, 0.403007299f},
-std::array<float,2>{0.219033927f, 0.0486438088f},
-std::array<float,2>{0.58792603f, 0.546428382f},
-std::array<float,2>{0.06757202f, 0.989884257f},
-std::array<float,2>{0.680751383f, 0.44218421f},
-std::array<float,2>{0.280203491f, 0.0927009583f},
-std::array<float,2>{0.984854102f, 0.567522764f},
-std::array<float,2>{0.424129397f, 0.642038465f},
-std::array<float,2>{0.860763848f, 0.153182328f},
-std::array<float,2>{0.176854312f, 0.33232674f},
-std::array<float,2>{0.542599142f, 0.782705069f},
-std::array<float,2>{0.196188271f, 0.507704377f},
-std::array<float,2>{0.599551022f, 0.0202393811f},
-std::array<float,2>{0.486106396f, 0.417986661f},
-std::array<float,2>{0.785226107f, 0.91240257f},
-std::array<float,2>{0.349110872f, 0.820169747f},
-std::array<float,2>{0.920621753f, 0.297601104f},
-std::array<float,2>{0.0573766418f, 0.20146966f},
-std::array<float,2>{0.717651069f, 0.707693279f},
-std::array<float,2>{0.100149646f, 0.793323874f},
-std::array<float,2>{0.637304544f, 0.338176519f},
-std::array<float,2>{0.307118177f, 0.146499962f},
-std::array<float,2>{0.94349134f, 0.654898107f},
-std::array<float,2>{0.400413007f, 0.576644957f},
-std::array<float,2>{0.832457662f, 0.0811023563f},
-std::array<float,2>{0.145091236f, 0.445405155f},
-std::array<float,2>{0.510103464f, 0.995044887f},
-std::array<float,2>{0.226843745f, 0.713476181f},
-std::array<float,2>{0.582274616f, 0.188893765f},
-std::array<float,2>{0.454739541f, 0.307845056f},
-std::array<float,2>{0.751340032f, 0.823788524f},
-std::array<float,2>{0.314062238f, 0.918208838f},
-std::array<float,2>{0.891521871f, 0.406480342f},
-std::array<float,2>{0.0248673111f, 0.0306211691f},
-std::array<float,2>{0.73426646f, 0.512546778f},
-std::array<float,2>{0.180835351f, 0.940071106f},
-std::array<float,2>{0.532308936f, 0.473636836f},
-std::array<float,2>{0.433936805f, 0.11817538f},
-std::array<float,2>{0.870858908f, 0.60133028f},
-std::array<float,2>{0.268922299f, 0.664262652f},
-std::array<float,2>{0.99266386f, 0.158428252f},
-std::array<float,2>{0.073321335f, 0.372885942f},
-std::array<float,2>{0.679315686f, 0.766413927f},
-std::array<float,2>{0.0484852158f, 0.53136158f},
-std::array<float,2>{0.706895411f, 0.0548909977f},
-std::array<float,2>{0.355856448f, 0.398200363f},
-std::array<float,2>{0.908071935f, 0.905149817f},
-std::array<float,2>{0.492340893f, 0.86377418f},
-std::array<float,2>{0.796552658f, 0.259798944f},
-std::array<float,2>{0.188109308f, 0.236106336f},
-std::array<float,2>{0.604639828f, 0.732332051f},
-std::array<float,2>{0.207823545f, 0.83888495f},
-std::array<float,2>{0.612241387f, 0.296577603f},
-std::array<float,2>{0.476133645f, 0.205402285f},
-std::array<float,2>{0.799358666f, 0.693954349f},
-std::array<float,2>{0.36775437f, 0.529947639f},
-std::array<float,2>{0.922104716f, 0.00168714137f},
-std::array<float,2>{0.0376968011f, 0.428449929f},
-std::array<float,2>{0.70066756f, 0.925868034f},
-std::array<float,2>{0.0892941952f, 0.628236771f},
-std::array<float,2>{0.6662063f, 0.135044202f},
-std::array<float,2>{0.25314942f, 0.323632151f},
-std::array<float,2>{0.977485597f, 0.797571063f},
-std::array<float,2>{0.407218426f, 0.974891484f},
-std::array<float,2>{0.848880827f, 0.453668296f},
-std::array<float,2>{0.158611551f, 0.0691842213f},
-std::array<float,2>{0.553328991f, 0.589850008f},
-std::array<float,2>{0.00353811891f, 0.8838346f},
-std::array<float,2>{0.738691032f, 0.382847577f},
-std::array<float,2>{0.342387468f, 0.0420180336f},
-std::array<float,2>{0.878212571f, 0.547097743f},
-std::array<float,2>{0.449260414f, 0.735294998f},
-std::array<float,2>{0.77247107f, 0.232551187f},
-std::array<float,2>{0.244693339f, 0.274239123f},
-std::array<float,2>{0.57776159f, 0.855089843f},
-std::array<float,2>{0.128999442f, 0.615075827f},
-std::array<float,2>{0.529683053f, 0.0987980664f},
-std::array<float,2>{0.390234202f, 0.490502179f},
-std::array<float,2>{0.815387547f, 0.965186536f},
-std::array<float,2>{0.285207808f, 0.757560313f},
-std::array<float,2>{0.965016067f, 0.343845308f},
-std::array<float,2>{0.121869907f, 0.185983777f},
-std::array<float,2>{0.643217564f, 0.682243526f},
-std::array<float,2>{0.0291577913f, 0.762031674f},
-std::array<float,2>{0.726877809f, 0.358062029f},
-std::array<float,2>{0.318470001f, 0.175256357f},
-std::array<float,2>{0.897324681f, 0.675498188f},
-std::array<float,2>{0.458155811f, 0.62098372f},
-std::array<float,2>{0.757692933f, 0.106503293f},
-std::array<float,2>{0.23377195f, 0.493311256f},
-std::array<float,2>{0.580082715f, 0.95880729f},
-std::array<float,2>{0.141490191f, 0.746680796f},
-std::array<float,2>{0.51550889f, 0.22464098f},
-std::array<float,2>{0.404504627f, 0.266335815f},
-std::array<float,2>{0.828284681f, 0.846897066f},
-std::array<float,2>{0.309545666f, 0.879858255f},
-std::array<float,2>{0.939056873f, 0.376875252f},
-std::array<float,2>{0.0941770598f, 0.0377359018f},
-std::array<float,2>{0.635674715f, 0.561545253f},
-std::array<float,2>{0.194379658f, 0.981639445f},
-std::array<float,2>{0.608636618f, 0.464956462f},
-std::array<float,2>{0.498321056f, 0.0720750317f},
-std::array<float,2>{0.792577267f, 0.579936385f},
-std::array<float,2>{0.354115248f, 0.63286227f},
-std::array<float,2>{0.912237585f, 0.127807721f},
-std::array<float,2>{0.0511649773f, 0.318913579f},
-std::array<float,2>{0.709079027f, 0.80543375f},
-std::array<float,2>{0.0766557455f, 0.518757761f},
-std::array<float,2>{0.675127804f, 0.0111170486f},
-std::array<float,2>{0.271820992f, 0.436928183f},
-std::array<float,2>{0.999544263f, 0.93328321f},
-std::array<float,2>{0.433528632f, 0.833941758f},
-std::array<float,2>{0.872867644f, 0.284633875f},
-std::array<float,2>{0.186519414f, 0.213159889f},
-std::array<float,2>{0.539009809f, 0.700746238f},
-std::array<float,2>{0.162868902f, 0.870723546f},
-std::array<float,2>{0.547885001f, 0.253105044f},
-std::array<float,2>{0.411564976f, 0.242578357f},
-std::array<float,2>{0.847196281f, 0.722789347f},
-std::array<float,2>{0.254650414f, 0.542078912f},
-std::array<float,2>{0.982572198f, 0.0539863668f},
-std::array<float,2>{0.0937095881f, 0.401451141f},
-std::array<float,2>{0.669660389f, 0.895118058f},
-std::array<float,2>{0.0332504213f, 0.660559714f},
-std::array<float,2>{0.697889268f, 0.168426275f},
-std::array<float,2>{0.374164701f, 0.364162117f},
-std::array<float,2>{0.929520249f, 0.77560842f},
-std::array<float,2>{0.472001493f, 0.949119091f},
-std::array<float,2>{0.802671373f, 0.476725042f},
-std::array<float,2>{0.205723062f, 0.111348748f},
-std::array<float,2>{0.616273701f, 0.608091414f},
-std::array<float,2>{0.117214531f, 0.907241702f},
-std::array<float,2>{0.64669019f, 0.415400773f},
-std::array<float,2>{0.282019168f, 0.0174758825f},
-std::array<float,2>{0.961418927f, 0.503255427f},
-std::array<float,2>{0.384622484f, 0.706259251f},
-std::array<float,2>{0.816985846f, 0.198237583f},
-std::array<float,2>{0.127925307f, 0.301504314f},
-std::array<float,2>{0.524369895f, 0.815088332f},
-std::array<float,2>{0.246251911f, 0.563611984f},
-std::array<float,2>{0.572611213f, 0.0872529671f},
-std::array<float,2>{0.446630657f, 0.440047324f},
-std::array<float,2>{0.768072188f, 0.986634851f},
-std::array<float,2>{0.338043481f, 0.788079381f},
-std::array<float,2>{0.879064918f, 0.331809372f},
-std::array<float,2>{0.00705532916f, 0.149935409f},
-std::array<float,2>{0.735956311f, 0.647479057f},
-std::array<float,2>{0.0817992836f, 0.826238573f},
-std::array<float,2>{0.662170827f, 0.309375256f},
-std::array<float,2>{0.26281783f, 0.195159554f},
-std::array<float,2>{0.971182942f, 0.718492866f},
-std::array<float,2>{0.419423252f, 0.510558724f},
-std::array<float,2>{0.856348515f, 0.0266093146f},
-std::array<float,2>{0.169580266f, 0.412460148f},
-std::array<float,2>{0.562084079f, 0.917182803f},
-std::array<float,2>{0.212499991f, 0.651863396f},
-std::array<float,2>{0.622381687f, 0.141894117f},
-std::array<float,2>{0.483680516f, 0.343356818f},
-std::array<float,2>{0.811064899f, 0.789562106f},
-std::array<float,2>{0.365079284f, 0.997356236f},
-std::array<float,2>{0.931736708f, 0.450439304f},
-std::array<float,2>{0.0425186902f, 0.0833137408f},
-std::array<float,2>{0.69023478f, 0.570870876f},
-std::array<float,2>{0.135763556f, 0.901673257f},
-std::array<float,2>{0.521424532f, 0.391054928f},
-std::array<float,2>{0.38242799f, 0.0620812289f},
-std::array<float,2>{0.826498568f, 0.53597039f},
-std::array<float,2>{0.293496668f, 0.727465808f},
-std::array<float,2>{0.953134298f, 0.242114559f},
-std::array<float,2>{0.116061836f, 0.265418291f},
-std::array<float,2>{0.653927624f, 0.861772478f},
-std::array<float,2>{0.0155874593f, 0.594620109f},
-std::array<float,2>{0.74957788f, 0.124357574f},
-std::array<float,2>{0.334735125f, 0.471202135f},
-std::array<float,2>{0.884867787f, 0.942633927f},
-std::array<float,2>{0.444229394f, 0.770764649f},
-std::array<float,2>{0.776232362f, 0.370993942f},
-std::array<float,2>{0.235078052f, 0.16310741f},
-std::array<float,2>{0.568379998f, 0.668457091f},
-std::array<float,2>{0.226036489f, 0.801619709f},
-std::array<float,2>{0.590282261f, 0.326361954f},
-std::array<float,2>{0.46260649f, 0.1385438f},
-std::array<float,2>{0.760406077f, 0.632051647f},
-std::array<float,2>{0.324784696f, 0.587510347f},
-std::array<float,2>{0.905621648f, 0.0626266897f},
-std::array<float,2>{0.0160800014f, 0.458047122f},
-std::array<float,2>{0.725305796f, 0.969462216f},
-std::array<float,2>{0.106021896f, 0.690905988f},
-std::array<float,2>{0.6317662f, 0.209879696f},
-std::array<float,2>{0.301450193f, 0.289478093f},
-std::array<float,2>{0.952827811f, 0.840575099f},
-std::array<float,2>{0.395004809f, 0.922634959f},
-std::array<float,2>{0.841989279f, 0.42207855f},
-std::array<float,2>{0.15495342f, 0.00400472945f},
-std::array<float,2>{0.507521868f, 0.523567915f},
-std::array<float,2>{0.0592710637f, 0.961735606f},
-std::array<float,2>{0.713858426f, 0.488023609f},
-std::array<float,2>{0.343973011f, 0.0964415893f},
-std::array<float,2>{0.916780353f, 0.612561882f},
-std::array<float,2>{0.489580184f, 0.686377466f},
-std::array<float,2>{0.785062969f, 0.182078183f},
-std::array<float,2>{0.201651886f, 0.349122047f},
-std::array<float,2>{0.596088409f, 0.750490546f},
-std::array<float,2>{0.17545481f, 0.55348593f},
-std::array<float,2>{0.54455936f, 0.0447933897f},
-std::array<float,2>{0.426105857f, 0.389558077f},
-std::array<float,2>{0.864288867f, 0.88672477f},
-std::array<float,2>{0.27583608f, 0.857691646f},
-std::array<float,2>{0.99186492f, 0.278259993f},
-std::array<float,2>{0.0647346452f, 0.230122671f},
-std::array<float,2>{0.686389267f, 0.740030408f}}
\ No newline at end of file
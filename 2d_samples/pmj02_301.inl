@@ -1,4096 +0,0 @@
-{std::array<float,2>{0.932396054f, 0.953161538f},
-std::array<float,2>{0.465997189f, 0.164349765f},
-std::array<float,2>{0.0878364295f, 0.51638186f},
-std::array<float,2>{0.696688056f, 0.472960413f},
-std::array<float,2>{0.565727055f, 0.733582556f},
-std::array<float,2>{0.148594335f, 0.25250268f},
-std::array<float,2>{0.308809131f, 0.809466243f},
-std::array<float,2>{0.817710459f, 0.0259105247f},
-std::array<float,2>{0.672989964f, 0.872968614f},
-std::array<float,2>{0.035125047f, 0.0724516138f},
-std::array<float,2>{0.383105367f, 0.669176877f},
-std::array<float,2>{0.984318912f, 0.336384952f},
-std::array<float,2>{0.757384121f, 0.611645639f},
-std::array<float,2>{0.336700916f, 0.405344546f},
-std::array<float,2>{0.22256802f, 0.933227897f},
-std::array<float,2>{0.519656599f, 0.195005521f},
-std::array<float,2>{0.871777356f, 0.758929908f},
-std::array<float,2>{0.266127974f, 0.0541891269f},
-std::array<float,2>{0.158088982f, 0.688137054f},
-std::array<float,2>{0.599988699f, 0.290067971f},
-std::array<float,2>{0.730033398f, 0.55259943f},
-std::array<float,2>{0.0966113657f, 0.457695872f},
-std::array<float,2>{0.469899952f, 0.987976015f},
-std::array<float,2>{0.884567022f, 0.133954272f},
-std::array<float,2>{0.53393656f, 0.885667324f},
-std::array<float,2>{0.21833767f, 0.221108899f},
-std::array<float,2>{0.345166624f, 0.563981891f},
-std::array<float,2>{0.795077026f, 0.415276408f},
-std::array<float,2>{0.951668203f, 0.625341296f},
-std::array<float,2>{0.436672449f, 0.345333546f},
-std::array<float,2>{0.0071560517f, 0.841522932f},
-std::array<float,2>{0.6297611f, 0.0968263298f},
-std::array<float,2>{0.993780196f, 0.819769144f},
-std::array<float,2>{0.398100942f, 0.124962859f},
-std::array<float,2>{0.0577100739f, 0.649429202f},
-std::array<float,2>{0.669432342f, 0.366855145f},
-std::array<float,2>{0.510331929f, 0.587115645f},
-std::array<float,2>{0.235957921f, 0.426885664f},
-std::array<float,2>{0.312701166f, 0.89596194f},
-std::array<float,2>{0.776386917f, 0.235444278f},
-std::array<float,2>{0.715810061f, 0.98342514f},
-std::array<float,2>{0.0667539164f, 0.154493406f},
-std::array<float,2>{0.452800274f, 0.54250586f},
-std::array<float,2>{0.918886125f, 0.44574514f},
-std::array<float,2>{0.838325918f, 0.709135771f},
-std::array<float,2>{0.293569416f, 0.297709644f},
-std::array<float,2>{0.129607528f, 0.774563253f},
-std::array<float,2>{0.578848362f, 0.0416199602f},
-std::array<float,2>{0.806900084f, 0.906843007f},
-std::array<float,2>{0.361829162f, 0.215776294f},
-std::array<float,2>{0.195614323f, 0.600516438f},
-std::array<float,2>{0.55915767f, 0.376368672f},
-std::array<float,2>{0.645876944f, 0.680872023f},
-std::array<float,2>{0.0166935418f, 0.32270965f},
-std::array<float,2>{0.418842763f, 0.847176492f},
-std::array<float,2>{0.958205342f, 0.086349301f},
-std::array<float,2>{0.613326132f, 0.791509449f},
-std::array<float,2>{0.175223604f, 0.0153012043f},
-std::array<float,2>{0.251786292f, 0.734503627f},
-std::array<float,2>{0.854242504f, 0.275920987f},
-std::array<float,2>{0.898152649f, 0.502298534f},
-std::array<float,2>{0.490079403f, 0.495082438f},
-std::array<float,2>{0.124126472f, 0.946641505f},
-std::array<float,2>{0.749943376f, 0.180893093f},
-std::array<float,2>{0.968311667f, 0.904806674f},
-std::array<float,2>{0.412412226f, 0.249130115f},
-std::array<float,2>{0.0263947919f, 0.578179538f},
-std::array<float,2>{0.652281642f, 0.430388272f},
-std::array<float,2>{0.551245272f, 0.644378424f},
-std::array<float,2>{0.190976858f, 0.372961968f},
-std::array<float,2>{0.369548887f, 0.82768786f},
-std::array<float,2>{0.804683864f, 0.113602765f},
-std::array<float,2>{0.742051065f, 0.767851591f},
-std::array<float,2>{0.114728287f, 0.0314279906f},
-std::array<float,2>{0.497481883f, 0.712059319f},
-std::array<float,2>{0.904036164f, 0.310925573f},
-std::array<float,2>{0.849286795f, 0.532908022f},
-std::array<float,2>{0.263657987f, 0.438805342f},
-std::array<float,2>{0.181437716f, 0.973325789f},
-std::array<float,2>{0.619365573f, 0.142532378f},
-std::array<float,2>{0.76650846f, 0.858294547f},
-std::array<float,2>{0.321743727f, 0.0832972825f},
-std::array<float,2>{0.242556274f, 0.673997402f},
-std::array<float,2>{0.505866468f, 0.315246373f},
-std::array<float,2>{0.659923792f, 0.605329812f},
-std::array<float,2>{0.0538583696f, 0.386262178f},
-std::array<float,2>{0.402885109f, 0.917065978f},
-std::array<float,2>{0.98714757f, 0.203402683f},
-std::array<float,2>{0.587677956f, 0.942897737f},
-std::array<float,2>{0.138524503f, 0.177644819f},
-std::array<float,2>{0.286476672f, 0.509358227f},
-std::array<float,2>{0.835797071f, 0.491632879f},
-std::array<float,2>{0.908539593f, 0.746169031f},
-std::array<float,2>{0.443805963f, 0.265944004f},
-std::array<float,2>{0.0776785463f, 0.786611974f},
-std::array<float,2>{0.70471555f, 0.00315452344f},
-std::array<float,2>{0.8784132f, 0.804678619f},
-std::array<float,2>{0.481795251f, 0.0202267449f},
-std::array<float,2>{0.107615829f, 0.720374048f},
-std::array<float,2>{0.721435487f, 0.262585908f},
-std::array<float,2>{0.607016385f, 0.52461803f},
-std::array<float,2>{0.169982091f, 0.480255097f},
-std::array<float,2>{0.28019765f, 0.962227285f},
-std::array<float,2>{0.864299893f, 0.161037862f},
-std::array<float,2>{0.639813423f, 0.926209807f},
-std::array<float,2>{0.0139435045f, 0.202791169f},
-std::array<float,2>{0.422393948f, 0.620209932f},
-std::array<float,2>{0.937703192f, 0.398345262f},
-std::array<float,2>{0.781359255f, 0.658739626f},
-std::array<float,2>{0.356696546f, 0.335702807f},
-std::array<float,2>{0.205770895f, 0.867168128f},
-std::array<float,2>{0.541935921f, 0.0656618923f},
-std::array<float,2>{0.823736668f, 0.992692411f},
-std::array<float,2>{0.30391863f, 0.126204073f},
-std::array<float,2>{0.140899986f, 0.560469329f},
-std::array<float,2>{0.572385192f, 0.4681485f},
-std::array<float,2>{0.68875134f, 0.701889575f},
-std::array<float,2>{0.0839027837f, 0.286504507f},
-std::array<float,2>{0.460027337f, 0.752312303f},
-std::array<float,2>{0.92853719f, 0.0556884483f},
-std::array<float,2>{0.529879808f, 0.830861926f},
-std::array<float,2>{0.231434882f, 0.105250649f},
-std::array<float,2>{0.333202899f, 0.636153579f},
-std::array<float,2>{0.75889653f, 0.354888648f},
-std::array<float,2>{0.971420527f, 0.570381522f},
-std::array<float,2>{0.380749911f, 0.410933107f},
-std::array<float,2>{0.0427295081f, 0.88028568f},
-std::array<float,2>{0.684970558f, 0.233702227f},
-std::array<float,2>{0.899577618f, 0.937200129f},
-std::array<float,2>{0.495299041f, 0.188379616f},
-std::array<float,2>{0.113172598f, 0.615173221f},
-std::array<float,2>{0.737228334f, 0.400833786f},
-std::array<float,2>{0.624102652f, 0.666476607f},
-std::array<float,2>{0.185370222f, 0.340040743f},
-std::array<float,2>{0.2583161f, 0.869448245f},
-std::array<float,2>{0.844068348f, 0.0758136213f},
-std::array<float,2>{0.655503452f, 0.808419287f},
-std::array<float,2>{0.0297159906f, 0.0285999067f},
-std::array<float,2>{0.409378797f, 0.726790428f},
-std::array<float,2>{0.963734746f, 0.257148832f},
-std::array<float,2>{0.79824841f, 0.51998049f},
-std::array<float,2>{0.372743815f, 0.470915109f},
-std::array<float,2>{0.191936746f, 0.958373547f},
-std::array<float,2>{0.547846258f, 0.170865208f},
-std::array<float,2>{0.829198062f, 0.837668121f},
-std::array<float,2>{0.282304317f, 0.0997300819f},
-std::array<float,2>{0.133864895f, 0.631070256f},
-std::array<float,2>{0.592901647f, 0.348989159f},
-std::array<float,2>{0.709102631f, 0.570291221f},
-std::array<float,2>{0.0741677657f, 0.418269783f},
-std::array<float,2>{0.438440055f, 0.888184845f},
-std::array<float,2>{0.913091958f, 0.225287721f},
-std::array<float,2>{0.503635108f, 0.991468728f},
-std::array<float,2>{0.247452289f, 0.137442112f},
-std::array<float,2>{0.326514333f, 0.5501436f},
-std::array<float,2>{0.771754026f, 0.453732878f},
-std::array<float,2>{0.988568008f, 0.692097247f},
-std::array<float,2>{0.401432574f, 0.294281602f},
-std::array<float,2>{0.0482480861f, 0.762627482f},
-std::array<float,2>{0.660177827f, 0.0490260534f},
-std::array<float,2>{0.944518507f, 0.779919803f},
-std::array<float,2>{0.427286029f, 0.0456181541f},
-std::array<float,2>{0.0078311814f, 0.704754531f},
-std::array<float,2>{0.635435522f, 0.300894797f},
-std::array<float,2>{0.546761692f, 0.544080853f},
-std::array<float,2>{0.207379237f, 0.451895058f},
-std::array<float,2>{0.352688253f, 0.97676146f},
-std::array<float,2>{0.788165808f, 0.151709899f},
-std::array<float,2>{0.725385129f, 0.892071307f},
-std::array<float,2>{0.10370364f, 0.239936084f},
-std::array<float,2>{0.478516251f, 0.591624141f},
-std::array<float,2>{0.881070852f, 0.422185063f},
-std::array<float,2>{0.85996002f, 0.654834509f},
-std::array<float,2>{0.276217103f, 0.359624445f},
-std::array<float,2>{0.166108906f, 0.81605643f},
-std::array<float,2>{0.604224443f, 0.118948363f},
-std::array<float,2>{0.763549864f, 0.950351298f},
-std::array<float,2>{0.331194639f, 0.185606003f},
-std::array<float,2>{0.227641478f, 0.507515788f},
-std::array<float,2>{0.526250243f, 0.497212708f},
-std::array<float,2>{0.681361139f, 0.742123604f},
-std::array<float,2>{0.045187775f, 0.279669344f},
-std::array<float,2>{0.375252873f, 0.794963956f},
-std::array<float,2>{0.974642575f, 0.00962961931f},
-std::array<float,2>{0.574663937f, 0.849826336f},
-std::array<float,2>{0.147827536f, 0.092133075f},
-std::array<float,2>{0.299144953f, 0.683978558f},
-std::array<float,2>{0.825626254f, 0.325858802f},
-std::array<float,2>{0.924076498f, 0.594356179f},
-std::array<float,2>{0.456491411f, 0.379930168f},
-std::array<float,2>{0.0807442367f, 0.911620855f},
-std::array<float,2>{0.692575693f, 0.212096006f},
-std::array<float,2>{0.977896094f, 0.971098185f},
-std::array<float,2>{0.390256196f, 0.146293819f},
-std::array<float,2>{0.03775784f, 0.538069785f},
-std::array<float,2>{0.677927256f, 0.441681802f},
-std::array<float,2>{0.519082963f, 0.718451142f},
-std::array<float,2>{0.225978553f, 0.306281f},
-std::array<float,2>{0.341274351f, 0.772961199f},
-std::array<float,2>{0.752834976f, 0.0375516266f},
-std::array<float,2>{0.701391578f, 0.822331071f},
-std::array<float,2>{0.0924990326f, 0.111326039f},
-std::array<float,2>{0.462495148f, 0.64682585f},
-std::array<float,2>{0.936957061f, 0.368199468f},
-std::array<float,2>{0.814552426f, 0.58415395f},
-std::array<float,2>{0.306011885f, 0.436279982f},
-std::array<float,2>{0.154211983f, 0.899035156f},
-std::array<float,2>{0.567816377f, 0.242528051f},
-std::array<float,2>{0.789723337f, 0.782939315f},
-std::array<float,2>{0.348331094f, 0.00744284829f},
-std::array<float,2>{0.212850958f, 0.745428264f},
-std::array<float,2>{0.536892116f, 0.271626323f},
-std::array<float,2>{0.625822484f, 0.515417278f},
-std::array<float,2>{0.00100774702f, 0.487962097f},
-std::array<float,2>{0.431160569f, 0.938521326f},
-std::array<float,2>{0.948546052f, 0.174703121f},
-std::array<float,2>{0.597001553f, 0.92022562f},
-std::array<float,2>{0.163689435f, 0.208644792f},
-std::array<float,2>{0.269932151f, 0.607820332f},
-std::array<float,2>{0.87102592f, 0.388180941f},
-std::array<float,2>{0.890234947f, 0.67825526f},
-std::array<float,2>{0.475844651f, 0.319459051f},
-std::array<float,2>{0.100790977f, 0.854201138f},
-std::array<float,2>{0.733414948f, 0.0799737498f},
-std::array<float,2>{0.916172802f, 0.861427784f},
-std::array<float,2>{0.446277201f, 0.0675251931f},
-std::array<float,2>{0.0645196587f, 0.663055658f},
-std::array<float,2>{0.71324718f, 0.329493701f},
-std::array<float,2>{0.582115173f, 0.623343468f},
-std::array<float,2>{0.125252798f, 0.390635133f},
-std::array<float,2>{0.290689856f, 0.922519267f},
-std::array<float,2>{0.843740165f, 0.197294533f},
-std::array<float,2>{0.665255964f, 0.968318999f},
-std::array<float,2>{0.0623742789f, 0.157946005f},
-std::array<float,2>{0.393140197f, 0.52878952f},
-std::array<float,2>{0.997362018f, 0.481181771f},
-std::array<float,2>{0.778538287f, 0.723098397f},
-std::array<float,2>{0.316556454f, 0.258272558f},
-std::array<float,2>{0.241143182f, 0.798881352f},
-std::array<float,2>{0.513484001f, 0.0165027007f},
-std::array<float,2>{0.858952582f, 0.877399385f},
-std::array<float,2>{0.257324368f, 0.228040576f},
-std::array<float,2>{0.179043561f, 0.576413691f},
-std::array<float,2>{0.611202538f, 0.407925278f},
-std::array<float,2>{0.742872536f, 0.638967037f},
-std::array<float,2>{0.12023671f, 0.358022243f},
-std::array<float,2>{0.487502128f, 0.835158765f},
-std::array<float,2>{0.894476175f, 0.107688881f},
-std::array<float,2>{0.555550039f, 0.756548822f},
-std::array<float,2>{0.201688558f, 0.0603249148f},
-std::array<float,2>{0.365474373f, 0.69631052f},
-std::array<float,2>{0.810349345f, 0.281859696f},
-std::array<float,2>{0.956150055f, 0.557596803f},
-std::array<float,2>{0.417889535f, 0.463696867f},
-std::array<float,2>{0.0221734475f, 0.999257922f},
-std::array<float,2>{0.644323766f, 0.130117804f},
-std::array<float,2>{0.885172904f, 0.984398305f},
-std::array<float,2>{0.472003967f, 0.135841608f},
-std::array<float,2>{0.0940817595f, 0.554071724f},
-std::array<float,2>{0.727588236f, 0.460517049f},
-std::array<float,2>{0.599107265f, 0.690354466f},
-std::array<float,2>{0.159481332f, 0.291032463f},
-std::array<float,2>{0.268952906f, 0.760045588f},
-std::array<float,2>{0.874671876f, 0.0521459877f},
-std::array<float,2>{0.632468939f, 0.843297303f},
-std::array<float,2>{0.00395141216f, 0.094200775f},
-std::array<float,2>{0.434115469f, 0.627826631f},
-std::array<float,2>{0.95018965f, 0.347596169f},
-std::array<float,2>{0.794438779f, 0.565550923f},
-std::array<float,2>{0.347436249f, 0.416086614f},
-std::array<float,2>{0.216244772f, 0.882991612f},
-std::array<float,2>{0.531255484f, 0.219928384f},
-std::array<float,2>{0.81994313f, 0.811365604f},
-std::array<float,2>{0.312478304f, 0.0251413509f},
-std::array<float,2>{0.150914684f, 0.732035577f},
-std::array<float,2>{0.563894391f, 0.251928061f},
-std::array<float,2>{0.698122144f, 0.518110573f},
-std::array<float,2>{0.0879862756f, 0.47537747f},
-std::array<float,2>{0.468427181f, 0.956972182f},
-std::array<float,2>{0.929706991f, 0.167664573f},
-std::array<float,2>{0.522402585f, 0.931281686f},
-std::array<float,2>{0.220625311f, 0.193012968f},
-std::array<float,2>{0.339397222f, 0.609922767f},
-std::array<float,2>{0.755395889f, 0.402493894f},
-std::array<float,2>{0.980510235f, 0.67140156f},
-std::array<float,2>{0.385579079f, 0.338129282f},
-std::array<float,2>{0.0318721943f, 0.874375284f},
-std::array<float,2>{0.674957037f, 0.0719205141f},
-std::array<float,2>{0.959282935f, 0.844466627f},
-std::array<float,2>{0.421096653f, 0.0880059302f},
-std::array<float,2>{0.017701542f, 0.681688368f},
-std::array<float,2>{0.648414671f, 0.322029412f},
-std::array<float,2>{0.56159395f, 0.597943664f},
-std::array<float,2>{0.197501287f, 0.378790081f},
-std::array<float,2>{0.360413522f, 0.909227312f},
-std::array<float,2>{0.805653334f, 0.218330786f},
-std::array<float,2>{0.747910082f, 0.947905958f},
-std::array<float,2>{0.122531213f, 0.182129011f},
-std::array<float,2>{0.490766943f, 0.500096798f},
-std::array<float,2>{0.896452069f, 0.49289152f},
-std::array<float,2>{0.853425145f, 0.736966491f},
-std::array<float,2>{0.252200752f, 0.274573356f},
-std::array<float,2>{0.172553018f, 0.790225208f},
-std::array<float,2>{0.616505384f, 0.0127653023f},
-std::array<float,2>{0.774003446f, 0.897039175f},
-std::array<float,2>{0.316244572f, 0.236740068f},
-std::array<float,2>{0.23781538f, 0.588343799f},
-std::array<float,2>{0.507879317f, 0.427954733f},
-std::array<float,2>{0.67135185f, 0.651701331f},
-std::array<float,2>{0.054999765f, 0.363282323f},
-std::array<float,2>{0.395408034f, 0.818231761f},
-std::array<float,2>{0.994708359f, 0.122883052f},
-std::array<float,2>{0.581790328f, 0.777144969f},
-std::array<float,2>{0.131317288f, 0.0404608622f},
-std::array<float,2>{0.296181858f, 0.707826972f},
-std::array<float,2>{0.836647451f, 0.298882812f},
-std::array<float,2>{0.92081672f, 0.539551735f},
-std::array<float,2>{0.450596303f, 0.448896974f},
-std::array<float,2>{0.070061259f, 0.981340051f},
-std::array<float,2>{0.718567193f, 0.152752593f},
-std::array<float,2>{0.985284626f, 0.915933907f},
-std::array<float,2>{0.40483886f, 0.20635815f},
-std::array<float,2>{0.0515540466f, 0.60224843f},
-std::array<float,2>{0.657753944f, 0.384175152f},
-std::array<float,2>{0.505439878f, 0.673154235f},
-std::array<float,2>{0.245185569f, 0.31341961f},
-std::array<float,2>{0.323678434f, 0.85709846f},
-std::array<float,2>{0.768623173f, 0.0851473361f},
-std::array<float,2>{0.705213964f, 0.788440824f},
-std::array<float,2>{0.0758813918f, 0.00160380674f},
-std::array<float,2>{0.441644847f, 0.749352872f},
-std::array<float,2>{0.90672034f, 0.268573701f},
-std::array<float,2>{0.833664894f, 0.511096835f},
-std::array<float,2>{0.287484884f, 0.489422053f},
-std::array<float,2>{0.139194742f, 0.944552302f},
-std::array<float,2>{0.588855505f, 0.179201052f},
-std::array<float,2>{0.80107522f, 0.825995684f},
-std::array<float,2>{0.367650717f, 0.116265632f},
-std::array<float,2>{0.188488632f, 0.640824914f},
-std::array<float,2>{0.554160476f, 0.374749601f},
-std::array<float,2>{0.649317861f, 0.580409229f},
-std::array<float,2>{0.0252161846f, 0.432543874f},
-std::array<float,2>{0.410911769f, 0.903964162f},
-std::array<float,2>{0.965540171f, 0.246791527f},
-std::array<float,2>{0.618121564f, 0.975938082f},
-std::array<float,2>{0.183421016f, 0.143619582f},
-std::array<float,2>{0.263929635f, 0.534694016f},
-std::array<float,2>{0.850337386f, 0.440178692f},
-std::array<float,2>{0.905257881f, 0.714442849f},
-std::array<float,2>{0.499753147f, 0.31002593f},
-std::array<float,2>{0.11706157f, 0.766459584f},
-std::array<float,2>{0.739283562f, 0.0336412601f},
-std::array<float,2>{0.925924718f, 0.751061916f},
-std::array<float,2>{0.458060294f, 0.0581797622f},
-std::array<float,2>{0.0845532343f, 0.699931383f},
-std::array<float,2>{0.690901637f, 0.2886011f},
-std::array<float,2>{0.571007133f, 0.56094569f},
-std::array<float,2>{0.144314572f, 0.465909719f},
-std::array<float,2>{0.301915407f, 0.994726121f},
-std::array<float,2>{0.821781874f, 0.127642363f},
-std::array<float,2>{0.686439395f, 0.882074237f},
-std::array<float,2>{0.0393960513f, 0.230658427f},
-std::array<float,2>{0.380900294f, 0.572861433f},
-std::array<float,2>{0.968764722f, 0.412576258f},
-std::array<float,2>{0.760751128f, 0.633884728f},
-std::array<float,2>{0.334075242f, 0.353080571f},
-std::array<float,2>{0.233518958f, 0.829977214f},
-std::array<float,2>{0.527451158f, 0.101919092f},
-std::array<float,2>{0.866782963f, 0.964606941f},
-std::array<float,2>{0.27820006f, 0.163507462f},
-std::array<float,2>{0.168555364f, 0.527143896f},
-std::array<float,2>{0.607724786f, 0.476882726f},
-std::array<float,2>{0.719681501f, 0.721784413f},
-std::array<float,2>{0.107183672f, 0.26525405f},
-std::array<float,2>{0.483053744f, 0.802564621f},
-std::array<float,2>{0.87544167f, 0.0217405073f},
-std::array<float,2>{0.540296614f, 0.864358306f},
-std::array<float,2>{0.203771129f, 0.0630657449f},
-std::array<float,2>{0.358036458f, 0.657553375f},
-std::array<float,2>{0.783254445f, 0.333154112f},
-std::array<float,2>{0.939480066f, 0.617892563f},
-std::array<float,2>{0.424929947f, 0.394732893f},
-std::array<float,2>{0.0132017601f, 0.928931713f},
-std::array<float,2>{0.638658583f, 0.200134441f},
-std::array<float,2>{0.910901845f, 0.889031231f},
-std::array<float,2>{0.440224439f, 0.222900242f},
-std::array<float,2>{0.0711991414f, 0.566971838f},
-std::array<float,2>{0.708418906f, 0.420712143f},
-std::array<float,2>{0.589926004f, 0.629891932f},
-std::array<float,2>{0.135807872f, 0.351407558f},
-std::array<float,2>{0.28327775f, 0.839754939f},
-std::array<float,2>{0.830923378f, 0.0989309996f},
-std::array<float,2>{0.6640082f, 0.764731944f},
-std::array<float,2>{0.0496839508f, 0.0471414626f},
-std::array<float,2>{0.400162131f, 0.694635451f},
-std::array<float,2>{0.992103815f, 0.296139032f},
-std::array<float,2>{0.770800889f, 0.548702598f},
-std::array<float,2>{0.32525453f, 0.456732988f},
-std::array<float,2>{0.24897413f, 0.989598393f},
-std::array<float,2>{0.500336111f, 0.140491843f},
-std::array<float,2>{0.846031725f, 0.867486537f},
-std::array<float,2>{0.261319757f, 0.0781248882f},
-std::array<float,2>{0.186502486f, 0.665425599f},
-std::array<float,2>{0.622881949f, 0.343509704f},
-std::array<float,2>{0.735870779f, 0.616732001f},
-std::array<float,2>{0.109937444f, 0.399153948f},
-std::array<float,2>{0.494096696f, 0.933876216f},
-std::array<float,2>{0.902065396f, 0.190092862f},
-std::array<float,2>{0.550597608f, 0.959486783f},
-std::array<float,2>{0.193569198f, 0.169573739f},
-std::array<float,2>{0.374130338f, 0.522248626f},
-std::array<float,2>{0.800366342f, 0.470381916f},
-std::array<float,2>{0.96094197f, 0.728793919f},
-std::array<float,2>{0.406462997f, 0.253961951f},
-std::array<float,2>{0.0274119098f, 0.806084394f},
-std::array<float,2>{0.653711438f, 0.029735487f},
-std::array<float,2>{0.973484755f, 0.794315696f},
-std::array<float,2>{0.377074629f, 0.0108594783f},
-std::array<float,2>{0.043271523f, 0.739262462f},
-std::array<float,2>{0.681753039f, 0.277545154f},
-std::array<float,2>{0.524773479f, 0.505453646f},
-std::array<float,2>{0.228663236f, 0.499473602f},
-std::array<float,2>{0.330005586f, 0.952338755f},
-std::array<float,2>{0.764105558f, 0.184444472f},
-std::array<float,2>{0.694189191f, 0.913721621f},
-std::array<float,2>{0.0781327486f, 0.214582056f},
-std::array<float,2>{0.454218119f, 0.596791565f},
-std::array<float,2>{0.923439741f, 0.382209241f},
-std::array<float,2>{0.827144623f, 0.686316669f},
-std::array<float,2>{0.297816843f, 0.327189922f},
-std::array<float,2>{0.144908577f, 0.848569691f},
-std::array<float,2>{0.577394307f, 0.0914096758f},
-std::array<float,2>{0.785837173f, 0.979267895f},
-std::array<float,2>{0.354280144f, 0.149135217f},
-std::array<float,2>{0.209797412f, 0.545723975f},
-std::array<float,2>{0.5431391f, 0.449750304f},
-std::array<float,2>{0.634260297f, 0.705730736f},
-std::array<float,2>{0.0116813555f, 0.304167926f},
-std::array<float,2>{0.429117143f, 0.778783858f},
-std::array<float,2>{0.942456722f, 0.0441821255f},
-std::array<float,2>{0.602315903f, 0.813862324f},
-std::array<float,2>{0.165787965f, 0.119941249f},
-std::array<float,2>{0.274774104f, 0.653163552f},
-std::array<float,2>{0.863082051f, 0.361750245f},
-std::array<float,2>{0.880096078f, 0.591896355f},
-std::array<float,2>{0.477777302f, 0.42437911f},
-std::array<float,2>{0.103208318f, 0.892679751f},
-std::array<float,2>{0.724197686f, 0.242047176f},
-std::array<float,2>{0.946806908f, 0.940958321f},
-std::array<float,2>{0.432893604f, 0.172574386f},
-std::array<float,2>{0.00294628763f, 0.511729717f},
-std::array<float,2>{0.626996517f, 0.486291826f},
-std::array<float,2>{0.537685812f, 0.742899299f},
-std::array<float,2>{0.21475254f, 0.27066201f},
-std::array<float,2>{0.350454032f, 0.784865797f},
-std::array<float,2>{0.792497993f, 0.00455301581f},
-std::array<float,2>{0.732411265f, 0.852596402f},
-std::array<float,2>{0.09901914f, 0.0802347288f},
-std::array<float,2>{0.472967148f, 0.676085651f},
-std::array<float,2>{0.886763096f, 0.317346334f},
-std::array<float,2>{0.868596375f, 0.607042134f},
-std::array<float,2>{0.272066027f, 0.389555961f},
-std::array<float,2>{0.161716968f, 0.919883966f},
-std::array<float,2>{0.59454757f, 0.21055302f},
-std::array<float,2>{0.750527084f, 0.770917296f},
-std::array<float,2>{0.343308061f, 0.036450427f},
-std::array<float,2>{0.224131554f, 0.715505123f},
-std::array<float,2>{0.517053545f, 0.306817353f},
-std::array<float,2>{0.676952183f, 0.535457075f},
-std::array<float,2>{0.0352848694f, 0.444794089f},
-std::array<float,2>{0.386744231f, 0.970114529f},
-std::array<float,2>{0.978587568f, 0.14670974f},
-std::array<float,2>{0.569865465f, 0.901633203f},
-std::array<float,2>{0.155429929f, 0.245499358f},
-std::array<float,2>{0.30685395f, 0.582444251f},
-std::array<float,2>{0.812647939f, 0.433894575f},
-std::array<float,2>{0.935250401f, 0.645125449f},
-std::array<float,2>{0.464790225f, 0.370503873f},
-std::array<float,2>{0.0903366283f, 0.820853531f},
-std::array<float,2>{0.69996506f, 0.113159239f},
-std::array<float,2>{0.891744971f, 0.832539678f},
-std::array<float,2>{0.485160828f, 0.106528401f},
-std::array<float,2>{0.118710347f, 0.638143301f},
-std::array<float,2>{0.74507606f, 0.357073992f},
-std::array<float,2>{0.612194359f, 0.57496351f},
-std::array<float,2>{0.177121297f, 0.410011142f},
-std::array<float,2>{0.254098088f, 0.875605047f},
-std::array<float,2>{0.855730772f, 0.229258552f},
-std::array<float,2>{0.641955256f, 0.996709287f},
-std::array<float,2>{0.0196675267f, 0.132310674f},
-std::array<float,2>{0.414798081f, 0.555954158f},
-std::array<float,2>{0.95477277f, 0.46109128f},
-std::array<float,2>{0.811795354f, 0.697660387f},
-std::array<float,2>{0.363775522f, 0.284234732f},
-std::array<float,2>{0.199516132f, 0.754699528f},
-std::array<float,2>{0.558117867f, 0.0616668202f},
-std::array<float,2>{0.841291964f, 0.925096214f},
-std::array<float,2>{0.291942686f, 0.195818573f},
-std::array<float,2>{0.127077803f, 0.622280896f},
-std::array<float,2>{0.584982038f, 0.393004209f},
-std::array<float,2>{0.711396635f, 0.661591589f},
-std::array<float,2>{0.0626541078f, 0.330756962f},
-std::array<float,2>{0.448686957f, 0.859645486f},
-std::array<float,2>{0.915817738f, 0.0700386763f},
-std::array<float,2>{0.515615106f, 0.797915101f},
-std::array<float,2>{0.239736363f, 0.0179789253f},
-std::array<float,2>{0.319868565f, 0.726282477f},
-std::array<float,2>{0.779416621f, 0.260759473f},
-std::array<float,2>{0.999537587f, 0.529923081f},
-std::array<float,2>{0.390670925f, 0.484185159f},
-std::array<float,2>{0.0597013608f, 0.964905679f},
-std::array<float,2>{0.66641283f, 0.159131631f},
-std::array<float,2>{0.919452429f, 0.981837332f},
-std::array<float,2>{0.451904088f, 0.153404728f},
-std::array<float,2>{0.0681158677f, 0.540534139f},
-std::array<float,2>{0.715984821f, 0.44773826f},
-std::array<float,2>{0.580006421f, 0.708657622f},
-std::array<float,2>{0.129972875f, 0.299911797f},
-std::array<float,2>{0.294574142f, 0.775544524f},
-std::array<float,2>{0.83916682f, 0.0392563678f},
-std::array<float,2>{0.668271542f, 0.817002535f},
-std::array<float,2>{0.0569249615f, 0.122005805f},
-std::array<float,2>{0.397302628f, 0.65078938f},
-std::array<float,2>{0.992262125f, 0.364654928f},
-std::array<float,2>{0.775638402f, 0.589532018f},
-std::array<float,2>{0.314195484f, 0.428889036f},
-std::array<float,2>{0.23439151f, 0.89770478f},
-std::array<float,2>{0.511053562f, 0.237452149f},
-std::array<float,2>{0.854733288f, 0.789587915f},
-std::array<float,2>{0.25095427f, 0.0119159995f},
-std::array<float,2>{0.174206406f, 0.737344623f},
-std::array<float,2>{0.614916384f, 0.273944646f},
-std::array<float,2>{0.748450637f, 0.501713514f},
-std::array<float,2>{0.123051278f, 0.493857861f},
-std::array<float,2>{0.489127368f, 0.948297322f},
-std::array<float,2>{0.897077084f, 0.183045074f},
-std::array<float,2>{0.559802115f, 0.908797741f},
-std::array<float,2>{0.196712106f, 0.21748662f},
-std::array<float,2>{0.362858653f, 0.599076748f},
-std::array<float,2>{0.80836153f, 0.377397388f},
-std::array<float,2>{0.957517207f, 0.682765305f},
-std::array<float,2>{0.419733554f, 0.321139097f},
-std::array<float,2>{0.0160850659f, 0.845544994f},
-std::array<float,2>{0.644785464f, 0.0898218676f},
-std::array<float,2>{0.982979655f, 0.873230457f},
-std::array<float,2>{0.384159654f, 0.0709886551f},
-std::array<float,2>{0.0332689546f, 0.670110703f},
-std::array<float,2>{0.672703207f, 0.338953525f},
-std::array<float,2>{0.521368563f, 0.611060619f},
-std::array<float,2>{0.220782325f, 0.404014528f},
-std::array<float,2>{0.337483376f, 0.930296302f},
-std::array<float,2>{0.756050467f, 0.192365974f},
-std::array<float,2>{0.695731521f, 0.955313325f},
-std::array<float,2>{0.0861041844f, 0.166476965f},
-std::array<float,2>{0.46581012f, 0.518921137f},
-std::array<float,2>{0.933315158f, 0.476302773f},
-std::array<float,2>{0.817112684f, 0.730538964f},
-std::array<float,2>{0.309865743f, 0.250031084f},
-std::array<float,2>{0.150134712f, 0.811543584f},
-std::array<float,2>{0.565047264f, 0.0235707536f},
-std::array<float,2>{0.79680562f, 0.884372592f},
-std::array<float,2>{0.343754381f, 0.219184473f},
-std::array<float,2>{0.217596427f, 0.565370023f},
-std::array<float,2>{0.534263551f, 0.417370856f},
-std::array<float,2>{0.630595267f, 0.62868607f},
-std::array<float,2>{0.00680129323f, 0.345995218f},
-std::array<float,2>{0.435594589f, 0.84204483f},
-std::array<float,2>{0.952421248f, 0.0949524119f},
-std::array<float,2>{0.601166129f, 0.761639237f},
-std::array<float,2>{0.15717569f, 0.0510155261f},
-std::array<float,2>{0.267200828f, 0.691053152f},
-std::array<float,2>{0.872657716f, 0.292931199f},
-std::array<float,2>{0.883704245f, 0.552759528f},
-std::array<float,2>{0.468823493f, 0.459624887f},
-std::array<float,2>{0.0968048275f, 0.986147344f},
-std::array<float,2>{0.728657722f, 0.135680467f},
-std::array<float,2>{0.939326584f, 0.928083897f},
-std::array<float,2>{0.42343539f, 0.200635463f},
-std::array<float,2>{0.014846283f, 0.618520617f},
-std::array<float,2>{0.639567792f, 0.395793796f},
-std::array<float,2>{0.542532027f, 0.657052159f},
-std::array<float,2>{0.206573918f, 0.332561582f},
-std::array<float,2>{0.356257379f, 0.863392711f},
-std::array<float,2>{0.782666802f, 0.0643400997f},
-std::array<float,2>{0.722211778f, 0.801451385f},
-std::array<float,2>{0.109117284f, 0.0226003788f},
-std::array<float,2>{0.481407732f, 0.721539855f},
-std::array<float,2>{0.877226174f, 0.264547974f},
-std::array<float,2>{0.863999009f, 0.52572161f},
-std::array<float,2>{0.281198531f, 0.477624536f},
-std::array<float,2>{0.171684921f, 0.963281155f},
-std::array<float,2>{0.605865777f, 0.16261372f},
-std::array<float,2>{0.758784652f, 0.828637481f},
-std::array<float,2>{0.332324445f, 0.103341877f},
-std::array<float,2>{0.231843948f, 0.633063495f},
-std::array<float,2>{0.530566275f, 0.352453202f},
-std::array<float,2>{0.684382379f, 0.573821485f},
-std::array<float,2>{0.0419077575f, 0.413825095f},
-std::array<float,2>{0.379396439f, 0.881650805f},
-std::array<float,2>{0.971939027f, 0.232285276f},
-std::array<float,2>{0.573397636f, 0.995756686f},
-std::array<float,2>{0.142472595f, 0.128518611f},
-std::array<float,2>{0.302901417f, 0.562105656f},
-std::array<float,2>{0.82253772f, 0.464867443f},
-std::array<float,2>{0.929228485f, 0.700918496f},
-std::array<float,2>{0.459190726f, 0.287687629f},
-std::array<float,2>{0.0824676827f, 0.750279903f},
-std::array<float,2>{0.688454866f, 0.056716986f},
-std::array<float,2>{0.902381837f, 0.767445803f},
-std::array<float,2>{0.496983498f, 0.0344630219f},
-std::array<float,2>{0.113498926f, 0.713555753f},
-std::array<float,2>{0.741173983f, 0.309556276f},
-std::array<float,2>{0.620810151f, 0.533641458f},
-std::array<float,2>{0.180046231f, 0.441154867f},
-std::array<float,2>{0.262359738f, 0.974631011f},
-std::array<float,2>{0.848598659f, 0.142775252f},
-std::array<float,2>{0.650912583f, 0.902558506f},
-std::array<float,2>{0.0262402892f, 0.247200862f},
-std::array<float,2>{0.413144022f, 0.581845343f},
-std::array<float,2>{0.967742801f, 0.432905793f},
-std::array<float,2>{0.803219318f, 0.641773462f},
-std::array<float,2>{0.370520234f, 0.373922646f},
-std::array<float,2>{0.189561039f, 0.824619949f},
-std::array<float,2>{0.552311897f, 0.115757689f},
-std::array<float,2>{0.834524274f, 0.943653524f},
-std::array<float,2>{0.285224617f, 0.178644583f},
-std::array<float,2>{0.136795327f, 0.510423124f},
-std::array<float,2>{0.586013556f, 0.488483489f},
-std::array<float,2>{0.703836739f, 0.748930693f},
-std::array<float,2>{0.0770455748f, 0.26809606f},
-std::array<float,2>{0.444918066f, 0.787525117f},
-std::array<float,2>{0.909433246f, 0.000670159527f},
-std::array<float,2>{0.507060528f, 0.85569346f},
-std::array<float,2>{0.243722603f, 0.0848672092f},
-std::array<float,2>{0.320479125f, 0.672091007f},
-std::array<float,2>{0.766864657f, 0.313939661f},
-std::array<float,2>{0.987732887f, 0.602572024f},
-std::array<float,2>{0.403766215f, 0.383587956f},
-std::array<float,2>{0.053525798f, 0.914848328f},
-std::array<float,2>{0.658430398f, 0.205765754f},
-std::array<float,2>{0.882810533f, 0.894400895f},
-std::array<float,2>{0.47954762f, 0.241024509f},
-std::array<float,2>{0.104846373f, 0.593661606f},
-std::array<float,2>{0.726399004f, 0.425197512f},
-std::array<float,2>{0.604606092f, 0.654242575f},
-std::array<float,2>{0.167311192f, 0.362650752f},
-std::array<float,2>{0.276998907f, 0.813112557f},
-std::array<float,2>{0.860901177f, 0.12040513f},
-std::array<float,2>{0.636702657f, 0.777644634f},
-std::array<float,2>{0.00926176552f, 0.0434283577f},
-std::array<float,2>{0.426329732f, 0.706868827f},
-std::array<float,2>{0.943533719f, 0.303567052f},
-std::array<float,2>{0.787219644f, 0.546726704f},
-std::array<float,2>{0.351920635f, 0.45110032f},
-std::array<float,2>{0.208244652f, 0.979722261f},
-std::array<float,2>{0.545466304f, 0.149578959f},
-std::array<float,2>{0.825085998f, 0.848941684f},
-std::array<float,2>{0.30017212f, 0.0903744698f},
-std::array<float,2>{0.14661333f, 0.687291563f},
-std::array<float,2>{0.575692117f, 0.326359332f},
-std::array<float,2>{0.691857636f, 0.596086204f},
-std::array<float,2>{0.0812470615f, 0.381335706f},
-std::array<float,2>{0.455531776f, 0.912554979f},
-std::array<float,2>{0.925422132f, 0.213095695f},
-std::array<float,2>{0.527206004f, 0.951484144f},
-std::array<float,2>{0.227139682f, 0.185269386f},
-std::array<float,2>{0.330934435f, 0.504483342f},
-std::array<float,2>{0.762130141f, 0.498586625f},
-std::array<float,2>{0.976149321f, 0.738890529f},
-std::array<float,2>{0.376317322f, 0.279119194f},
-std::array<float,2>{0.0461842977f, 0.793287873f},
-std::array<float,2>{0.680005312f, 0.0100102359f},
-std::array<float,2>{0.964000702f, 0.80536443f},
-std::array<float,2>{0.408377856f, 0.0303121693f},
-std::array<float,2>{0.0310722943f, 0.729521692f},
-std::array<float,2>{0.654646099f, 0.255019397f},
-std::array<float,2>{0.548287153f, 0.52312237f},
-std::array<float,2>{0.192546114f, 0.469028741f},
-std::array<float,2>{0.371665448f, 0.960520625f},
-std::array<float,2>{0.796962976f, 0.16829364f},
-std::array<float,2>{0.738220274f, 0.935076535f},
-std::array<float,2>{0.112079337f, 0.190555766f},
-std::array<float,2>{0.494218051f, 0.616093934f},
-std::array<float,2>{0.898838818f, 0.399441779f},
-std::array<float,2>{0.845483065f, 0.66494149f},
-std::array<float,2>{0.259714603f, 0.341916889f},
-std::array<float,2>{0.183989182f, 0.868660331f},
-std::array<float,2>{0.623910367f, 0.0767294914f},
-std::array<float,2>{0.772699058f, 0.988316f},
-std::array<float,2>{0.327984244f, 0.138879165f},
-std::array<float,2>{0.246406794f, 0.547465265f},
-std::array<float,2>{0.502761006f, 0.455413342f},
-std::array<float,2>{0.661588132f, 0.693505764f},
-std::array<float,2>{0.0472919121f, 0.295610547f},
-std::array<float,2>{0.401346415f, 0.764022648f},
-std::array<float,2>{0.989807248f, 0.0480345935f},
-std::array<float,2>{0.592181623f, 0.838265955f},
-std::array<float,2>{0.133738965f, 0.0979091376f},
-std::array<float,2>{0.28214857f, 0.628956318f},
-std::array<float,2>{0.829093337f, 0.349691719f},
-std::array<float,2>{0.912411928f, 0.5681265f},
-std::array<float,2>{0.438772976f, 0.421821058f},
-std::array<float,2>{0.0728623345f, 0.889690697f},
-std::array<float,2>{0.710868359f, 0.224500239f},
-std::array<float,2>{0.996231973f, 0.966505766f},
-std::array<float,2>{0.393807054f, 0.159291118f},
-std::array<float,2>{0.0605948679f, 0.531189978f},
-std::array<float,2>{0.664959669f, 0.482915878f},
-std::array<float,2>{0.512146056f, 0.724739909f},
-std::array<float,2>{0.242001057f, 0.260499358f},
-std::array<float,2>{0.317994982f, 0.796893597f},
-std::array<float,2>{0.777939737f, 0.0190227609f},
-std::array<float,2>{0.714247763f, 0.860484302f},
-std::array<float,2>{0.0658901259f, 0.0687201768f},
-std::array<float,2>{0.447011709f, 0.660235107f},
-std::array<float,2>{0.917220771f, 0.331206799f},
-std::array<float,2>{0.84217459f, 0.621276915f},
-std::array<float,2>{0.290034622f, 0.39370364f},
-std::array<float,2>{0.126362473f, 0.924576521f},
-std::array<float,2>{0.583653212f, 0.196641624f},
-std::array<float,2>{0.808918297f, 0.755193591f},
-std::array<float,2>{0.366632402f, 0.0606293418f},
-std::array<float,2>{0.202291638f, 0.69900924f},
-std::array<float,2>{0.555751085f, 0.284036428f},
-std::array<float,2>{0.642940283f, 0.555477977f},
-std::array<float,2>{0.0224691816f, 0.4623169f},
-std::array<float,2>{0.416401297f, 0.997596383f},
-std::array<float,2>{0.955083847f, 0.131062821f},
-std::array<float,2>{0.609988272f, 0.876755059f},
-std::array<float,2>{0.177934512f, 0.230017737f},
-std::array<float,2>{0.25652653f, 0.575291038f},
-std::array<float,2>{0.857577324f, 0.408323228f},
-std::array<float,2>{0.89342016f, 0.63679862f},
-std::array<float,2>{0.486774236f, 0.35581699f},
-std::array<float,2>{0.119867198f, 0.833466649f},
-std::array<float,2>{0.744091272f, 0.106391467f},
-std::array<float,2>{0.935849905f, 0.821764529f},
-std::array<float,2>{0.461121827f, 0.111784734f},
-std::array<float,2>{0.0931892097f, 0.64590174f},
-std::array<float,2>{0.702383935f, 0.369279861f},
-std::array<float,2>{0.566597581f, 0.583214998f},
-std::array<float,2>{0.152810097f, 0.434856027f},
-std::array<float,2>{0.304780334f, 0.900690675f},
-std::array<float,2>{0.815719306f, 0.245062843f},
-std::array<float,2>{0.678942561f, 0.969009578f},
-std::array<float,2>{0.0382995158f, 0.147494346f},
-std::array<float,2>{0.389056474f, 0.536154926f},
-std::array<float,2>{0.977369487f, 0.44397527f},
-std::array<float,2>{0.753260016f, 0.716538548f},
-std::array<float,2>{0.340282679f, 0.308441848f},
-std::array<float,2>{0.225561827f, 0.77010113f},
-std::array<float,2>{0.518498242f, 0.0357940905f},
-std::array<float,2>{0.869951069f, 0.918040097f},
-std::array<float,2>{0.271009773f, 0.209103584f},
-std::array<float,2>{0.162291124f, 0.606054544f},
-std::array<float,2>{0.596305549f, 0.390017092f},
-std::array<float,2>{0.733119905f, 0.677615583f},
-std::array<float,2>{0.0996526331f, 0.317428797f},
-std::array<float,2>{0.475335658f, 0.852368295f},
-std::array<float,2>{0.889416039f, 0.0811436698f},
-std::array<float,2>{0.535176992f, 0.783639669f},
-std::array<float,2>{0.211239979f, 0.00511539355f},
-std::array<float,2>{0.349211365f, 0.74405098f},
-std::array<float,2>{0.790923297f, 0.269657165f},
-std::array<float,2>{0.947441757f, 0.513008535f},
-std::array<float,2>{0.43058601f, 0.484464049f},
-std::array<float,2>{0.00037276675f, 0.940100908f},
-std::array<float,2>{0.626715302f, 0.17317687f},
-std::array<float,2>{0.89550668f, 0.94608289f},
-std::array<float,2>{0.491415381f, 0.18003045f},
-std::array<float,2>{0.121698715f, 0.503468335f},
-std::array<float,2>{0.746706307f, 0.495243579f},
-std::array<float,2>{0.615814984f, 0.736121416f},
-std::array<float,2>{0.173823416f, 0.277305752f},
-std::array<float,2>{0.253712475f, 0.792389691f},
-std::array<float,2>{0.851908445f, 0.0143776648f},
-std::array<float,2>{0.647321641f, 0.845822871f},
-std::array<float,2>{0.0188247431f, 0.0871105418f},
-std::array<float,2>{0.420801014f, 0.680028677f},
-std::array<float,2>{0.960750282f, 0.32417351f},
-std::array<float,2>{0.80594486f, 0.601111889f},
-std::array<float,2>{0.360243946f, 0.375331193f},
-std::array<float,2>{0.198376104f, 0.908060789f},
-std::array<float,2>{0.560793877f, 0.215940475f},
-std::array<float,2>{0.83763957f, 0.773959339f},
-std::array<float,2>{0.294967383f, 0.0420860015f},
-std::array<float,2>{0.131875336f, 0.71078378f},
-std::array<float,2>{0.58082211f, 0.298446715f},
-std::array<float,2>{0.717314065f, 0.541737378f},
-std::array<float,2>{0.0684477016f, 0.44643724f},
-std::array<float,2>{0.450032473f, 0.983030617f},
-std::array<float,2>{0.921416044f, 0.155874029f},
-std::array<float,2>{0.508970976f, 0.894809425f},
-std::array<float,2>{0.237103105f, 0.234398946f},
-std::array<float,2>{0.314474463f, 0.586179078f},
-std::array<float,2>{0.775088131f, 0.426478356f},
-std::array<float,2>{0.995575666f, 0.64850086f},
-std::array<float,2>{0.396353751f, 0.365463465f},
-std::array<float,2>{0.0563828573f, 0.819247186f},
-std::array<float,2>{0.670780897f, 0.123587847f},
-std::array<float,2>{0.950819314f, 0.840391338f},
-std::array<float,2>{0.434675694f, 0.0959946737f},
-std::array<float,2>{0.00550601771f, 0.626070499f},
-std::array<float,2>{0.6314978f, 0.344171464f},
-std::array<float,2>{0.532919943f, 0.562853456f},
-std::array<float,2>{0.215240747f, 0.414258927f},
-std::array<float,2>{0.345801771f, 0.885978758f},
-std::array<float,2>{0.79392308f, 0.221861735f},
-std::array<float,2>{0.726787925f, 0.987238348f},
-std::array<float,2>{0.0953336731f, 0.133299932f},
-std::array<float,2>{0.471111506f, 0.551492393f},
-std::array<float,2>{0.886409938f, 0.458891541f},
-std::array<float,2>{0.873643219f, 0.68850559f},
-std::array<float,2>{0.267885715f, 0.289505333f},
-std::array<float,2>{0.158886477f, 0.758240819f},
-std::array<float,2>{0.598049164f, 0.053510014f},
-std::array<float,2>{0.75471729f, 0.931725681f},
-std::array<float,2>{0.338584632f, 0.194332004f},
-std::array<float,2>{0.218905836f, 0.612948358f},
-std::array<float,2>{0.522527218f, 0.405021131f},
-std::array<float,2>{0.674422741f, 0.668539464f},
-std::array<float,2>{0.0331731774f, 0.337068021f},
-std::array<float,2>{0.385743737f, 0.871770799f},
-std::array<float,2>{0.982014298f, 0.0734581873f},
-std::array<float,2>{0.563028634f, 0.810353637f},
-std::array<float,2>{0.152181447f, 0.0267651789f},
-std::array<float,2>{0.311084628f, 0.732473135f},
-std::array<float,2>{0.818388104f, 0.25384298f},
-std::array<float,2>{0.931009412f, 0.517555952f},
-std::array<float,2>{0.467215359f, 0.474462807f},
-std::array<float,2>{0.0896283314f, 0.954807043f},
-std::array<float,2>{0.698527932f, 0.165201262f},
-std::array<float,2>{0.970269859f, 0.879537761f},
-std::array<float,2>{0.382127523f, 0.232776955f},
-std::array<float,2>{0.0402245969f, 0.571902454f},
-std::array<float,2>{0.686965704f, 0.411277086f},
-std::array<float,2>{0.528880835f, 0.635698855f},
-std::array<float,2>{0.232797638f, 0.35405302f},
-std::array<float,2>{0.335166276f, 0.831837595f},
-std::array<float,2>{0.759845078f, 0.103783086f},
-std::array<float,2>{0.689854741f, 0.753803432f},
-std::array<float,2>{0.0850080177f, 0.0554245077f},
-std::array<float,2>{0.457985014f, 0.702583373f},
-std::array<float,2>{0.926761329f, 0.285913169f},
-std::array<float,2>{0.820733428f, 0.558894336f},
-std::array<float,2>{0.301025778f, 0.46692732f},
-std::array<float,2>{0.143128827f, 0.994000673f},
-std::array<float,2>{0.571472168f, 0.125295073f},
-std::array<float,2>{0.784229875f, 0.86594373f},
-std::array<float,2>{0.358668357f, 0.0647615343f},
-std::array<float,2>{0.204799294f, 0.660109162f},
-std::array<float,2>{0.539733648f, 0.334294051f},
-std::array<float,2>{0.637508154f, 0.619377255f},
-std::array<float,2>{0.012290475f, 0.396555185f},
-std::array<float,2>{0.423900664f, 0.927532673f},
-std::array<float,2>{0.940435052f, 0.201919153f},
-std::array<float,2>{0.608976007f, 0.961561561f},
-std::array<float,2>{0.169760913f, 0.161361918f},
-std::array<float,2>{0.278609455f, 0.523589253f},
-std::array<float,2>{0.865287781f, 0.478926748f},
-std::array<float,2>{0.87604183f, 0.718926907f},
-std::array<float,2>{0.483790725f, 0.263145924f},
-std::array<float,2>{0.105573125f, 0.803021789f},
-std::array<float,2>{0.720602453f, 0.0206552874f},
-std::array<float,2>{0.908159792f, 0.785347164f},
-std::array<float,2>{0.442813784f, 0.00263868342f},
-std::array<float,2>{0.0749822333f, 0.747206271f},
-std::array<float,2>{0.706370831f, 0.267077476f},
-std::array<float,2>{0.589255273f, 0.507917225f},
-std::array<float,2>{0.140244156f, 0.490921348f},
-std::array<float,2>{0.288960606f, 0.942144573f},
-std::array<float,2>{0.832251012f, 0.176674753f},
-std::array<float,2>{0.656341076f, 0.916223168f},
-std::array<float,2>{0.0521007739f, 0.204162419f},
-std::array<float,2>{0.405707866f, 0.603658617f},
-std::array<float,2>{0.986068785f, 0.385274768f},
-std::array<float,2>{0.768080652f, 0.675094187f},
-std::array<float,2>{0.322834939f, 0.315874606f},
-std::array<float,2>{0.244991273f, 0.858608663f},
-std::array<float,2>{0.504717231f, 0.0828208402f},
-std::array<float,2>{0.85071218f, 0.974082887f},
-std::array<float,2>{0.264989316f, 0.141358554f},
-std::array<float,2>{0.181702912f, 0.531379759f},
-std::array<float,2>{0.618308425f, 0.437552392f},
-std::array<float,2>{0.738522708f, 0.711546183f},
-std::array<float,2>{0.115385316f, 0.312335908f},
-std::array<float,2>{0.498396218f, 0.768880248f},
-std::array<float,2>{0.905962825f, 0.0324999765f},
-std::array<float,2>{0.553704619f, 0.827101052f},
-std::array<float,2>{0.187536448f, 0.115233108f},
-std::array<float,2>{0.368448228f, 0.643238485f},
-std::array<float,2>{0.802612126f, 0.371453136f},
-std::array<float,2>{0.966675341f, 0.580005169f},
-std::array<float,2>{0.411245018f, 0.430968374f},
-std::array<float,2>{0.0243142843f, 0.905436158f},
-std::array<float,2>{0.649663627f, 0.248987511f},
-std::array<float,2>{0.922463059f, 0.910484195f},
-std::array<float,2>{0.453784913f, 0.21105729f},
-std::array<float,2>{0.079971306f, 0.595203698f},
-std::array<float,2>{0.695042431f, 0.379089147f},
-std::array<float,2>{0.576282501f, 0.685203016f},
-std::array<float,2>{0.14559567f, 0.324404359f},
-std::array<float,2>{0.298046052f, 0.851378202f},
-std::array<float,2>{0.827763677f, 0.0930087045f},
-std::array<float,2>{0.683072448f, 0.796039045f},
-std::array<float,2>{0.0446289442f, 0.00834766775f},
-std::array<float,2>{0.378254682f, 0.741077125f},
-std::array<float,2>{0.97363323f, 0.280673712f},
-std::array<float,2>{0.765314579f, 0.506754875f},
-std::array<float,2>{0.328756154f, 0.496845216f},
-std::array<float,2>{0.230433911f, 0.949596763f},
-std::array<float,2>{0.523680568f, 0.187071398f},
-std::array<float,2>{0.86190778f, 0.814770103f},
-std::array<float,2>{0.274219841f, 0.117543377f},
-std::array<float,2>{0.164183512f, 0.656046629f},
-std::array<float,2>{0.603063643f, 0.360465556f},
-std::array<float,2>{0.723064661f, 0.590286732f},
-std::array<float,2>{0.102525868f, 0.423789322f},
-std::array<float,2>{0.47698456f, 0.890739024f},
-std::array<float,2>{0.879207134f, 0.239242986f},
-std::array<float,2>{0.544142306f, 0.978424251f},
-std::array<float,2>{0.210133404f, 0.151138559f},
-std::array<float,2>{0.354781598f, 0.543299317f},
-std::array<float,2>{0.786695421f, 0.453018904f},
-std::array<float,2>{0.941805899f, 0.703888655f},
-std::array<float,2>{0.428427964f, 0.301881939f},
-std::array<float,2>{0.0104179522f, 0.780859411f},
-std::array<float,2>{0.633491039f, 0.046743691f},
-std::array<float,2>{0.990673602f, 0.763123631f},
-std::array<float,2>{0.399025172f, 0.0505069494f},
-std::array<float,2>{0.050038822f, 0.693255782f},
-std::array<float,2>{0.662232757f, 0.293242455f},
-std::array<float,2>{0.501776099f, 0.549395025f},
-std::array<float,2>{0.249502406f, 0.454242736f},
-std::array<float,2>{0.324774474f, 0.990774989f},
-std::array<float,2>{0.77020812f, 0.138133973f},
-std::array<float,2>{0.707583964f, 0.887184858f},
-std::array<float,2>{0.0721282661f, 0.225819245f},
-std::array<float,2>{0.441247255f, 0.568825603f},
-std::array<float,2>{0.911590397f, 0.419692248f},
-std::array<float,2>{0.831534982f, 0.632153034f},
-std::array<float,2>{0.28474164f, 0.347696334f},
-std::array<float,2>{0.135054857f, 0.836657405f},
-std::array<float,2>{0.59152782f, 0.100772917f},
-std::array<float,2>{0.7989012f, 0.957349539f},
-std::array<float,2>{0.373311013f, 0.171241328f},
-std::array<float,2>{0.194408223f, 0.521313846f},
-std::array<float,2>{0.549393296f, 0.471926808f},
-std::array<float,2>{0.653268754f, 0.728318691f},
-std::array<float,2>{0.0285701286f, 0.256749928f},
-std::array<float,2>{0.407331407f, 0.806852758f},
-std::array<float,2>{0.962602973f, 0.0275861621f},
-std::array<float,2>{0.621145487f, 0.87033993f},
-std::array<float,2>{0.186847866f, 0.0747269839f},
-std::array<float,2>{0.260640085f, 0.667666137f},
-std::array<float,2>{0.847260892f, 0.341705948f},
-std::array<float,2>{0.90041554f, 0.613570452f},
-std::array<float,2>{0.492977887f, 0.402252883f},
-std::array<float,2>{0.111169524f, 0.93573004f},
-std::array<float,2>{0.734984875f, 0.189145386f},
-std::array<float,2>{0.953590095f, 0.99888289f},
-std::array<float,2>{0.415404081f, 0.1296359f},
-std::array<float,2>{0.0205863267f, 0.558423758f},
-std::array<float,2>{0.641046345f, 0.464374185f},
-std::array<float,2>{0.556717753f, 0.696210384f},
-std::array<float,2>{0.200886235f, 0.282869846f},
-std::array<float,2>{0.365027308f, 0.757699728f},
-std::array<float,2>{0.810817063f, 0.0594435222f},
-std::array<float,2>{0.745172262f, 0.834726155f},
-std::array<float,2>{0.11780674f, 0.108438917f},
-std::array<float,2>{0.486049175f, 0.640615225f},
-std::array<float,2>{0.891107857f, 0.359123319f},
-std::array<float,2>{0.85669893f, 0.577973843f},
-std::array<float,2>{0.255474299f, 0.407162964f},
-std::array<float,2>{0.175966859f, 0.878827989f},
-std::array<float,2>{0.612382054f, 0.227158114f},
-std::array<float,2>{0.780835509f, 0.800305009f},
-std::array<float,2>{0.319000661f, 0.0175644476f},
-std::array<float,2>{0.239194453f, 0.724275351f},
-std::array<float,2>{0.513897002f, 0.259506077f},
-std::array<float,2>{0.667634606f, 0.527805865f},
-std::array<float,2>{0.0588015132f, 0.481758833f},
-std::array<float,2>{0.391887635f, 0.967523813f},
-std::array<float,2>{0.998093724f, 0.157177255f},
-std::array<float,2>{0.584396183f, 0.923356175f},
-std::array<float,2>{0.128154412f, 0.198533073f},
-std::array<float,2>{0.292280853f, 0.62469703f},
-std::array<float,2>{0.840275347f, 0.392415941f},
-std::array<float,2>{0.915032983f, 0.663101971f},
-std::array<float,2>{0.447284281f, 0.328149199f},
-std::array<float,2>{0.0641883388f, 0.863111615f},
-std::array<float,2>{0.712426484f, 0.0664793178f},
-std::array<float,2>{0.888109386f, 0.854526579f},
-std::array<float,2>{0.473779351f, 0.0783677548f},
-std::array<float,2>{0.0982305333f, 0.678934097f},
-std::array<float,2>{0.731294811f, 0.318634152f},
-std::array<float,2>{0.595327795f, 0.608498573f},
-std::array<float,2>{0.160316393f, 0.387131423f},
-std::array<float,2>{0.27300632f, 0.921555996f},
-std::array<float,2>{0.86810106f, 0.207845986f},
-std::array<float,2>{0.628418446f, 0.938231468f},
-std::array<float,2>{0.00287097879f, 0.17482309f},
-std::array<float,2>{0.432266414f, 0.514293492f},
-std::array<float,2>{0.945553362f, 0.487196118f},
-std::array<float,2>{0.791439712f, 0.745074868f},
-std::array<float,2>{0.351135135f, 0.272753537f},
-std::array<float,2>{0.212924197f, 0.781325698f},
-std::array<float,2>{0.538247049f, 0.00642946782f},
-std::array<float,2>{0.813635349f, 0.899873137f},
-std::array<float,2>{0.307879001f, 0.243563384f},
-std::array<float,2>{0.155037045f, 0.585492194f},
-std::array<float,2>{0.568679094f, 0.437230676f},
-std::array<float,2>{0.700398684f, 0.647943556f},
-std::array<float,2>{0.0915673375f, 0.368069917f},
-std::array<float,2>{0.463284105f, 0.823964179f},
-std::array<float,2>{0.93369174f, 0.109642774f},
-std::array<float,2>{0.516497135f, 0.771907747f},
-std::array<float,2>{0.222856119f, 0.0381184146f},
-std::array<float,2>{0.342216849f, 0.717250168f},
-std::array<float,2>{0.751342654f, 0.305509239f},
-std::array<float,2>{0.980440378f, 0.538738072f},
-std::array<float,2>{0.388613373f, 0.442902327f},
-std::array<float,2>{0.0370631441f, 0.972013831f},
-std::array<float,2>{0.675801694f, 0.145471662f},
-std::array<float,2>{0.909776092f, 0.941748917f},
-std::array<float,2>{0.444419861f, 0.175791934f},
-std::array<float,2>{0.0764943957f, 0.508640051f},
-std::array<float,2>{0.703573108f, 0.490616232f},
-std::array<float,2>{0.586790025f, 0.747751892f},
-std::array<float,2>{0.137465954f, 0.267344743f},
-std::array<float,2>{0.286003917f, 0.786123037f},
-std::array<float,2>{0.834378779f, 0.00229424099f},
-std::array<float,2>{0.659091175f, 0.858889163f},
-std::array<float,2>{0.0529287606f, 0.0824424624f},
-std::array<float,2>{0.404131532f, 0.675742805f},
-std::array<float,2>{0.987958848f, 0.316077709f},
-std::array<float,2>{0.767387688f, 0.604377329f},
-std::array<float,2>{0.321089894f, 0.38501963f},
-std::array<float,2>{0.243607894f, 0.916877031f},
-std::array<float,2>{0.507594526f, 0.204943866f},
-std::array<float,2>{0.847876072f, 0.76916945f},
-std::array<float,2>{0.261906356f, 0.033119496f},
-std::array<float,2>{0.180402428f, 0.711332858f},
-std::array<float,2>{0.620380998f, 0.311986148f},
-std::array<float,2>{0.740453243f, 0.531823695f},
-std::array<float,2>{0.114189513f, 0.438189f},
-std::array<float,2>{0.496441931f, 0.974145234f},
-std::array<float,2>{0.90297693f, 0.140974045f},
-std::array<float,2>{0.552218378f, 0.905952036f},
-std::array<float,2>{0.1902522f, 0.248065755f},
-std::array<float,2>{0.371091604f, 0.579243898f},
-std::array<float,2>{0.803271472f, 0.431247026f},
-std::array<float,2>{0.967100799f, 0.642710209f},
-std::array<float,2>{0.414014339f, 0.372023672f},
-std::array<float,2>{0.0256244224f, 0.826619864f},
-std::array<float,2>{0.650490403f, 0.114360578f},
-std::array<float,2>{0.972573757f, 0.831386209f},
-std::array<float,2>{0.378984392f, 0.104132973f},
-std::array<float,2>{0.0413716324f, 0.634836137f},
-std::array<float,2>{0.68402338f, 0.353668869f},
-std::array<float,2>{0.530945718f, 0.571646452f},
-std::array<float,2>{0.231951669f, 0.412066281f},
-std::array<float,2>{0.332985312f, 0.879246712f},
-std::array<float,2>{0.757881403f, 0.233365059f},
-std::array<float,2>{0.687812686f, 0.993503273f},
-std::array<float,2>{0.0826665387f, 0.125928f},
-std::array<float,2>{0.459773958f, 0.559461772f},
-std::array<float,2>{0.928802073f, 0.467678279f},
-std::array<float,2>{0.822939336f, 0.702680945f},
-std::array<float,2>{0.303395033f, 0.285167307f},
-std::array<float,2>{0.141682088f, 0.753203988f},
-std::array<float,2>{0.573735297f, 0.0550310165f},
-std::array<float,2>{0.782728791f, 0.927226007f},
-std::array<float,2>{0.355846673f, 0.201430947f},
-std::array<float,2>{0.206155375f, 0.619672239f},
-std::array<float,2>{0.542455971f, 0.397287875f},
-std::array<float,2>{0.638870418f, 0.659538388f},
-std::array<float,2>{0.015149598f, 0.334946334f},
-std::array<float,2>{0.423332065f, 0.865328848f},
-std::array<float,2>{0.938644946f, 0.065261513f},
-std::array<float,2>{0.606196702f, 0.803523958f},
-std::array<float,2>{0.171032622f, 0.0213403907f},
-std::array<float,2>{0.280494034f, 0.719408095f},
-std::array<float,2>{0.863530159f, 0.263353527f},
-std::array<float,2>{0.877491355f, 0.524167717f},
-std::array<float,2>{0.480908245f, 0.479102701f},
-std::array<float,2>{0.108570777f, 0.961372972f},
-std::array<float,2>{0.721918046f, 0.161976531f},
-std::array<float,2>{0.952798426f, 0.886385083f},
-std::array<float,2>{0.436203063f, 0.222318634f},
-std::array<float,2>{0.00630812487f, 0.563467801f},
-std::array<float,2>{0.630044341f, 0.414961249f},
-std::array<float,2>{0.535144031f, 0.626485646f},
-std::array<float,2>{0.217253804f, 0.344562203f},
-std::array<float,2>{0.3446289f, 0.840234458f},
-std::array<float,2>{0.79627794f, 0.0963146016f},
-std::array<float,2>{0.729349494f, 0.758376956f},
-std::array<float,2>{0.0975100473f, 0.0530904867f},
-std::array<float,2>{0.469586194f, 0.689168334f},
-std::array<float,2>{0.883153796f, 0.28956005f},
-std::array<float,2>{0.872097611f, 0.551076233f},
-std::array<float,2>{0.267057717f, 0.458250374f},
-std::array<float,2>{0.156693578f, 0.986578166f},
-std::array<float,2>{0.601032913f, 0.133509412f},
-std::array<float,2>{0.756761849f, 0.87124908f},
-std::array<float,2>{0.337310076f, 0.0740071982f},
-std::array<float,2>{0.22127296f, 0.668375015f},
-std::array<float,2>{0.520925045f, 0.337684512f},
-std::array<float,2>{0.672323227f, 0.612538517f},
-std::array<float,2>{0.034027908f, 0.404497027f},
-std::array<float,2>{0.384485662f, 0.932462037f},
-std::array<float,2>{0.982622445f, 0.193549395f},
-std::array<float,2>{0.564825833f, 0.954108357f},
-std::array<float,2>{0.1498373f, 0.165615439f},
-std::array<float,2>{0.310074568f, 0.516944468f},
-std::array<float,2>{0.816674352f, 0.473634839f},
-std::array<float,2>{0.932862043f, 0.733229399f},
-std::array<float,2>{0.465134472f, 0.253023893f},
-std::array<float,2>{0.0868670195f, 0.80967325f},
-std::array<float,2>{0.696279347f, 0.0269035082f},
-std::array<float,2>{0.896519721f, 0.792482555f},
-std::array<float,2>{0.488554388f, 0.013933517f},
-std::array<float,2>{0.123623669f, 0.735684454f},
-std::array<float,2>{0.748816788f, 0.27646029f},
-std::array<float,2>{0.61439687f, 0.503110647f},
-std::array<float,2>{0.174475163f, 0.495964617f},
-std::array<float,2>{0.25033322f, 0.94545871f},
-std::array<float,2>{0.855163217f, 0.180589288f},
-std::array<float,2>{0.645296931f, 0.907232225f},
-std::array<float,2>{0.0165594015f, 0.216375306f},
-std::array<float,2>{0.419243574f, 0.600605607f},
-std::array<float,2>{0.957941771f, 0.37553826f},
-std::array<float,2>{0.808005393f, 0.68065232f},
-std::array<float,2>{0.362538606f, 0.323676825f},
-std::array<float,2>{0.197074175f, 0.846430779f},
-std::array<float,2>{0.560133815f, 0.0878782943f},
-std::array<float,2>{0.839636207f, 0.982680202f},
-std::array<float,2>{0.294075429f, 0.155485958f},
-std::array<float,2>{0.130522758f, 0.541384399f},
-std::array<float,2>{0.579588294f, 0.447101027f},
-std::array<float,2>{0.716598213f, 0.710025489f},
-std::array<float,2>{0.067556791f, 0.298315972f},
-std::array<float,2>{0.451385707f, 0.773675501f},
-std::array<float,2>{0.919094205f, 0.0426341742f},
-std::array<float,2>{0.511367023f, 0.818703353f},
-std::array<float,2>{0.23486352f, 0.123440519f},
-std::array<float,2>{0.313926727f, 0.648978233f},
-std::array<float,2>{0.775976419f, 0.36613372f},
-std::array<float,2>{0.992999256f, 0.586703777f},
-std::array<float,2>{0.396739632f, 0.425939143f},
-std::array<float,2>{0.0572820641f, 0.895229399f},
-std::array<float,2>{0.668597341f, 0.234954998f},
-std::array<float,2>{0.888958097f, 0.921374321f},
-std::array<float,2>{0.474852681f, 0.207493141f},
-std::array<float,2>{0.1005615f, 0.609150946f},
-std::array<float,2>{0.732663035f, 0.387583405f},
-std::array<float,2>{0.595777035f, 0.679638922f},
-std::array<float,2>{0.163048893f, 0.319071472f},
-std::array<float,2>{0.270747483f, 0.855121374f},
-std::array<float,2>{0.869235635f, 0.0786870196f},
-std::array<float,2>{0.626459599f, 0.78214395f},
-std::array<float,2>{0.000854521641f, 0.00591980247f},
-std::array<float,2>{0.429979384f, 0.744467199f},
-std::array<float,2>{0.94779253f, 0.273266017f},
-std::array<float,2>{0.790370405f, 0.51376307f},
-std::array<float,2>{0.349074394f, 0.486791432f},
-std::array<float,2>{0.211747587f, 0.937734365f},
-std::array<float,2>{0.535965204f, 0.175406083f},
-std::array<float,2>{0.81639725f, 0.823681176f},
-std::array<float,2>{0.305357128f, 0.110249393f},
-std::array<float,2>{0.153279737f, 0.648180604f},
-std::array<float,2>{0.567107618f, 0.367235243f},
-std::array<float,2>{0.702927351f, 0.584994495f},
-std::array<float,2>{0.0936671942f, 0.436869115f},
-std::array<float,2>{0.461896271f, 0.900188804f},
-std::array<float,2>{0.936482549f, 0.243761867f},
-std::array<float,2>{0.517654598f, 0.972394109f},
-std::array<float,2>{0.224898681f, 0.144946516f},
-std::array<float,2>{0.34075591f, 0.538452029f},
-std::array<float,2>{0.753549337f, 0.442406118f},
-std::array<float,2>{0.976715147f, 0.717335641f},
-std::array<float,2>{0.389432937f, 0.304880708f},
-std::array<float,2>{0.0390036441f, 0.772152841f},
-std::array<float,2>{0.679438949f, 0.0388315618f},
-std::array<float,2>{0.955948293f, 0.756971538f},
-std::array<float,2>{0.416814715f, 0.0588389486f},
-std::array<float,2>{0.0234321468f, 0.695313811f},
-std::array<float,2>{0.643411636f, 0.282470316f},
-std::array<float,2>{0.556275487f, 0.557995141f},
-std::array<float,2>{0.203111425f, 0.464236408f},
-std::array<float,2>{0.366941571f, 0.998312294f},
-std::array<float,2>{0.80924809f, 0.129108131f},
-std::array<float,2>{0.743551016f, 0.87828356f},
-std::array<float,2>{0.119224243f, 0.226998419f},
-std::array<float,2>{0.486825645f, 0.577516973f},
-std::array<float,2>{0.892773509f, 0.406349897f},
-std::array<float,2>{0.857989788f, 0.639670193f},
-std::array<float,2>{0.255949587f, 0.358559757f},
-std::array<float,2>{0.178607285f, 0.834336221f},
-std::array<float,2>{0.609767854f, 0.109103315f},
-std::array<float,2>{0.777830064f, 0.967248559f},
-std::array<float,2>{0.317407429f, 0.156484321f},
-std::array<float,2>{0.241491765f, 0.527855933f},
-std::array<float,2>{0.512369156f, 0.482375026f},
-std::array<float,2>{0.664168894f, 0.723797917f},
-std::array<float,2>{0.0611149818f, 0.259230733f},
-std::array<float,2>{0.39406237f, 0.800045729f},
-std::array<float,2>{0.996964991f, 0.0170485824f},
-std::array<float,2>{0.583237886f, 0.862551987f},
-std::array<float,2>{0.126491547f, 0.0671715215f},
-std::array<float,2>{0.289082497f, 0.663802862f},
-std::array<float,2>{0.842324972f, 0.328662664f},
-std::array<float,2>{0.917529941f, 0.624044597f},
-std::array<float,2>{0.446599156f, 0.391891241f},
-std::array<float,2>{0.0659625307f, 0.922965348f},
-std::array<float,2>{0.714723289f, 0.19893831f},
-std::array<float,2>{0.989522994f, 0.990576446f},
-std::array<float,2>{0.400791764f, 0.138292208f},
-std::array<float,2>{0.0475413688f, 0.549100637f},
-std::array<float,2>{0.661752582f, 0.454971284f},
-std::array<float,2>{0.502149165f, 0.692759693f},
-std::array<float,2>{0.246954978f, 0.293762118f},
-std::array<float,2>{0.327214777f, 0.763511717f},
-std::array<float,2>{0.77337867f, 0.0501112416f},
-std::array<float,2>{0.710421562f, 0.836314738f},
-std::array<float,2>{0.0725317001f, 0.101142839f},
-std::array<float,2>{0.439005882f, 0.63269347f},
-std::array<float,2>{0.91277492f, 0.348214507f},
-std::array<float,2>{0.828195572f, 0.569048584f},
-std::array<float,2>{0.281472296f, 0.419272602f},
-std::array<float,2>{0.132988453f, 0.887670934f},
-std::array<float,2>{0.592716336f, 0.22656019f},
-std::array<float,2>{0.797659457f, 0.80739522f},
-std::array<float,2>{0.371331185f, 0.0278682113f},
-std::array<float,2>{0.19303517f, 0.727784395f},
-std::array<float,2>{0.548454642f, 0.256033719f},
-std::array<float,2>{0.655068159f, 0.520517707f},
-std::array<float,2>{0.030458482f, 0.472310126f},
-std::array<float,2>{0.40879643f, 0.957651675f},
-std::array<float,2>{0.964410186f, 0.171599299f},
-std::array<float,2>{0.623278499f, 0.936219931f},
-std::array<float,2>{0.184307992f, 0.188738599f},
-std::array<float,2>{0.258904845f, 0.614035904f},
-std::array<float,2>{0.844919622f, 0.401812255f},
-std::array<float,2>{0.899197042f, 0.667202532f},
-std::array<float,2>{0.494974613f, 0.340896636f},
-std::array<float,2>{0.111483499f, 0.870733202f},
-std::array<float,2>{0.737351894f, 0.0744092315f},
-std::array<float,2>{0.924952865f, 0.850952625f},
-std::array<float,2>{0.455610961f, 0.0932752639f},
-std::array<float,2>{0.081584096f, 0.684907019f},
-std::array<float,2>{0.692285001f, 0.325010061f},
-std::array<float,2>{0.57558167f, 0.595450819f},
-std::array<float,2>{0.147423059f, 0.379845768f},
-std::array<float,2>{0.300620675f, 0.910992384f},
-std::array<float,2>{0.824347794f, 0.211857945f},
-std::array<float,2>{0.680663049f, 0.949873626f},
-std::array<float,2>{0.0467935726f, 0.18691653f},
-std::array<float,2>{0.376643986f, 0.50604558f},
-std::array<float,2>{0.975794852f, 0.49620533f},
-std::array<float,2>{0.762271702f, 0.740376115f},
-std::array<float,2>{0.330419689f, 0.280893207f},
-std::array<float,2>{0.226892203f, 0.796824932f},
-std::array<float,2>{0.526719391f, 0.00806950312f},
-std::array<float,2>{0.860640883f, 0.891297162f},
-std::array<float,2>{0.276631504f, 0.238417432f},
-std::array<float,2>{0.167622313f, 0.590502799f},
-std::array<float,2>{0.605342805f, 0.423271716f},
-std::array<float,2>{0.725652516f, 0.655682445f},
-std::array<float,2>{0.105320811f, 0.361237556f},
-std::array<float,2>{0.480363071f, 0.81524682f},
-std::array<float,2>{0.882058978f, 0.11774084f},
-std::array<float,2>{0.545401573f, 0.780759394f},
-std::array<float,2>{0.20869112f, 0.0462987274f},
-std::array<float,2>{0.352352232f, 0.703434825f},
-std::array<float,2>{0.787846982f, 0.302663058f},
-std::array<float,2>{0.944093287f, 0.543626368f},
-std::array<float,2>{0.425788462f, 0.452173114f},
-std::array<float,2>{0.0096158348f, 0.977635741f},
-std::array<float,2>{0.63620913f, 0.150551021f},
-std::array<float,2>{0.905526161f, 0.975373387f},
-std::array<float,2>{0.498602301f, 0.143322319f},
-std::array<float,2>{0.115927301f, 0.533869147f},
-std::array<float,2>{0.738777399f, 0.440758318f},
-std::array<float,2>{0.619049847f, 0.713240921f},
-std::array<float,2>{0.182202891f, 0.309001744f},
-std::array<float,2>{0.265147775f, 0.766890705f},
-std::array<float,2>{0.851549566f, 0.0351357423f},
-std::array<float,2>{0.650080264f, 0.824717283f},
-std::array<float,2>{0.0238103233f, 0.115373679f},
-std::array<float,2>{0.411996812f, 0.642457962f},
-std::array<float,2>{0.966094017f, 0.373224378f},
-std::array<float,2>{0.801851034f, 0.581437707f},
-std::array<float,2>{0.368801028f, 0.433417588f},
-std::array<float,2>{0.188067511f, 0.903244138f},
-std::array<float,2>{0.552806139f, 0.247755095f},
-std::array<float,2>{0.832642555f, 0.787944019f},
-std::array<float,2>{0.288268507f, 0.000403622835f},
-std::array<float,2>{0.139791325f, 0.748112082f},
-std::array<float,2>{0.58943063f, 0.267694443f},
-std::array<float,2>{0.706871808f, 0.50979352f},
-std::array<float,2>{0.0743608922f, 0.489161253f},
-std::array<float,2>{0.443076402f, 0.943980753f},
-std::array<float,2>{0.907691777f, 0.177919745f},
-std::array<float,2>{0.504091263f, 0.914428115f},
-std::array<float,2>{0.244306847f, 0.20536834f},
-std::array<float,2>{0.322476268f, 0.603490412f},
-std::array<float,2>{0.768048584f, 0.383000314f},
-std::array<float,2>{0.985585272f, 0.672598362f},
-std::array<float,2>{0.405893624f, 0.314308852f},
-std::array<float,2>{0.0525728986f, 0.856206238f},
-std::array<float,2>{0.657163382f, 0.0841354877f},
-std::array<float,2>{0.941070259f, 0.86391902f},
-std::array<float,2>{0.42445603f, 0.0635886714f},
-std::array<float,2>{0.0120331049f, 0.656409323f},
-std::array<float,2>{0.636749744f, 0.332492441f},
-std::array<float,2>{0.539310575f, 0.619007826f},
-std::array<float,2>{0.204273716f, 0.396330535f},
-std::array<float,2>{0.35932222f, 0.928484261f},
-std::array<float,2>{0.784766257f, 0.20071879f},
-std::array<float,2>{0.719821632f, 0.963725686f},
-std::array<float,2>{0.106311694f, 0.16245614f},
-std::array<float,2>{0.484262258f, 0.525955617f},
-std::array<float,2>{0.876732707f, 0.47848168f},
-std::array<float,2>{0.865891397f, 0.720864892f},
-std::array<float,2>{0.279226542f, 0.264028609f},
-std::array<float,2>{0.169068649f, 0.801067948f},
-std::array<float,2>{0.608658791f, 0.0230200794f},
-std::array<float,2>{0.760470033f, 0.880871296f},
-std::array<float,2>{0.335488707f, 0.231694192f},
-std::array<float,2>{0.232925221f, 0.573367357f},
-std::array<float,2>{0.528395712f, 0.413545221f},
-std::array<float,2>{0.687375367f, 0.633740187f},
-std::array<float,2>{0.0409938321f, 0.351935834f},
-std::array<float,2>{0.382739186f, 0.828375757f},
-std::array<float,2>{0.969778657f, 0.102576628f},
-std::array<float,2>{0.571937859f, 0.750567496f},
-std::array<float,2>{0.142860562f, 0.0575094707f},
-std::array<float,2>{0.301531285f, 0.700409293f},
-std::array<float,2>{0.821242571f, 0.287378252f},
-std::array<float,2>{0.92772603f, 0.5618909f},
-std::array<float,2>{0.457168728f, 0.465586483f},
-std::array<float,2>{0.0857974142f, 0.995137811f},
-std::array<float,2>{0.690419316f, 0.128391072f},
-std::array<float,2>{0.981639683f, 0.929803371f},
-std::array<float,2>{0.386685014f, 0.191889286f},
-std::array<float,2>{0.0324431695f, 0.610563159f},
-std::array<float,2>{0.674304366f, 0.403690159f},
-std::array<float,2>{0.52303648f, 0.670516372f},
-std::array<float,2>{0.219582245f, 0.339721262f},
-std::array<float,2>{0.338239342f, 0.873817146f},
-std::array<float,2>{0.754151702f, 0.0703478977f},
-std::array<float,2>{0.699141085f, 0.812390327f},
-std::array<float,2>{0.0890189409f, 0.0239895247f},
-std::array<float,2>{0.46738261f, 0.731039464f},
-std::array<float,2>{0.931372225f, 0.250908464f},
-std::array<float,2>{0.819197237f, 0.519372284f},
-std::array<float,2>{0.310693234f, 0.475939095f},
-std::array<float,2>{0.15159969f, 0.955924571f},
-std::array<float,2>{0.562808871f, 0.166595295f},
-std::array<float,2>{0.793393254f, 0.842328012f},
-std::array<float,2>{0.346353948f, 0.0956892595f},
-std::array<float,2>{0.21578823f, 0.628156662f},
-std::array<float,2>{0.532411635f, 0.346403182f},
-std::array<float,2>{0.631126881f, 0.564804375f},
-std::array<float,2>{0.00510041788f, 0.417767316f},
-std::array<float,2>{0.435361713f, 0.884007156f},
-std::array<float,2>{0.950246513f, 0.219401538f},
-std::array<float,2>{0.598157644f, 0.985430062f},
-std::array<float,2>{0.158418536f, 0.135237336f},
-std::array<float,2>{0.26836744f, 0.553409338f},
-std::array<float,2>{0.87310034f, 0.459015727f},
-std::array<float,2>{0.885948837f, 0.69057256f},
-std::array<float,2>{0.471447498f, 0.292329907f},
-std::array<float,2>{0.094892025f, 0.76110965f},
-std::array<float,2>{0.727214634f, 0.0516230315f},
-std::array<float,2>{0.92099452f, 0.776319742f},
-std::array<float,2>{0.449568987f, 0.0400236771f},
-std::array<float,2>{0.0693344101f, 0.708084881f},
-std::array<float,2>{0.716896594f, 0.300612658f},
-std::array<float,2>{0.580303788f, 0.540238202f},
-std::array<float,2>{0.132565603f, 0.448213398f},
-std::array<float,2>{0.295637518f, 0.982279837f},
-std::array<float,2>{0.837374032f, 0.153959349f},
-std::array<float,2>{0.670284271f, 0.898053467f},
-std::array<float,2>{0.0560796969f, 0.238039613f},
-std::array<float,2>{0.39561227f, 0.589214683f},
-std::array<float,2>{0.995953023f, 0.42922014f},
-std::array<float,2>{0.774828255f, 0.650971234f},
-std::array<float,2>{0.314994812f, 0.364906192f},
-std::array<float,2>{0.236481875f, 0.816848099f},
-std::array<float,2>{0.509297371f, 0.121278569f},
-std::array<float,2>{0.852106035f, 0.948786438f},
-std::array<float,2>{0.25315854f, 0.183188632f},
-std::array<float,2>{0.173287332f, 0.501392484f},
-std::array<float,2>{0.615570307f, 0.493538678f},
-std::array<float,2>{0.746223092f, 0.738089025f},
-std::array<float,2>{0.121239804f, 0.273574501f},
-std::array<float,2>{0.492053539f, 0.789478064f},
-std::array<float,2>{0.894943058f, 0.012587389f},
-std::array<float,2>{0.561223388f, 0.845167756f},
-std::array<float,2>{0.199187428f, 0.0889717489f},
-std::array<float,2>{0.359472871f, 0.683477819f},
-std::array<float,2>{0.80647856f, 0.320707113f},
-std::array<float,2>{0.960255802f, 0.599579811f},
-std::array<float,2>{0.420237958f, 0.377730012f},
-std::array<float,2>{0.0192731917f, 0.90859127f},
-std::array<float,2>{0.646613836f, 0.216934711f},
-std::array<float,2>{0.934203625f, 0.900888503f},
-std::array<float,2>{0.463825166f, 0.244198665f},
-std::array<float,2>{0.0909168571f, 0.583826125f},
-std::array<float,2>{0.700952232f, 0.435368329f},
-std::array<float,2>{0.56885922f, 0.646012008f},
-std::array<float,2>{0.154716864f, 0.370074064f},
-std::array<float,2>{0.308308691f, 0.822039068f},
-std::array<float,2>{0.814419627f, 0.112143174f},
-std::array<float,2>{0.676375329f, 0.769869387f},
-std::array<float,2>{0.0361691751f, 0.0354216024f},
-std::array<float,2>{0.388071954f, 0.715874732f},
-std::array<float,2>{0.979888499f, 0.307911843f},
-std::array<float,2>{0.751792431f, 0.536861122f},
-std::array<float,2>{0.342393607f, 0.443433136f},
-std::array<float,2>{0.223377958f, 0.969285309f},
-std::array<float,2>{0.515952945f, 0.148282677f},
-std::array<float,2>{0.867274404f, 0.851682067f},
-std::array<float,2>{0.272605211f, 0.0815833509f},
-std::array<float,2>{0.161064133f, 0.676878631f},
-std::array<float,2>{0.595000684f, 0.31797868f},
-std::array<float,2>{0.730606914f, 0.605872154f},
-std::array<float,2>{0.0980196595f, 0.390615016f},
-std::array<float,2>{0.474122733f, 0.918900728f},
-std::array<float,2>{0.888658464f, 0.209869862f},
-std::array<float,2>{0.538863063f, 0.939484119f},
-std::array<float,2>{0.213558942f, 0.173790723f},
-std::array<float,2>{0.350916266f, 0.513273537f},
-std::array<float,2>{0.791881919f, 0.485020071f},
-std::array<float,2>{0.94604671f, 0.743213654f},
-std::array<float,2>{0.431879997f, 0.270050794f},
-std::array<float,2>{0.00198056409f, 0.783947349f},
-std::array<float,2>{0.628319025f, 0.00579907419f},
-std::array<float,2>{0.998891413f, 0.797421277f},
-std::array<float,2>{0.392383993f, 0.019338429f},
-std::array<float,2>{0.0591916256f, 0.725400329f},
-std::array<float,2>{0.667237699f, 0.260184288f},
-std::array<float,2>{0.514174223f, 0.530408978f},
-std::array<float,2>{0.238718808f, 0.482891917f},
-std::array<float,2>{0.318665713f, 0.965949893f},
-std::array<float,2>{0.780646563f, 0.159849584f},
-std::array<float,2>{0.712222397f, 0.9238711f},
-std::array<float,2>{0.0637849718f, 0.196930259f},
-std::array<float,2>{0.447847784f, 0.62204349f},
-std::array<float,2>{0.914437473f, 0.39410153f},
-std::array<float,2>{0.840335906f, 0.660968363f},
-std::array<float,2>{0.292877883f, 0.331935465f},
-std::array<float,2>{0.128883809f, 0.861090958f},
-std::array<float,2>{0.584797263f, 0.0691054389f},
-std::array<float,2>{0.811213911f, 0.997429669f},
-std::array<float,2>{0.364649743f, 0.13140811f},
-std::array<float,2>{0.200204492f, 0.554915726f},
-std::array<float,2>{0.557133913f, 0.462434381f},
-std::array<float,2>{0.64141953f, 0.698676407f},
-std::array<float,2>{0.0210440736f, 0.283458829f},
-std::array<float,2>{0.415905416f, 0.75553757f},
-std::array<float,2>{0.954090118f, 0.0614295378f},
-std::array<float,2>{0.612908125f, 0.833613992f},
-std::array<float,2>{0.176656544f, 0.10552194f},
-std::array<float,2>{0.255064279f, 0.637388587f},
-std::array<float,2>{0.85726732f, 0.356114239f},
-std::array<float,2>{0.891197681f, 0.575897157f},
-std::array<float,2>{0.485459119f, 0.408747703f},
-std::array<float,2>{0.117595442f, 0.876084983f},
-std::array<float,2>{0.745659888f, 0.229742527f},
-std::array<float,2>{0.962174594f, 0.960084498f},
-std::array<float,2>{0.407984704f, 0.16872339f},
-std::array<float,2>{0.0288282f, 0.522907019f},
-std::array<float,2>{0.652822435f, 0.469553232f},
-std::array<float,2>{0.549040616f, 0.730461955f},
-std::array<float,2>{0.19496192f, 0.255735517f},
-std::array<float,2>{0.373546511f, 0.80485785f},
-std::array<float,2>{0.799344778f, 0.0312442426f},
-std::array<float,2>{0.734513938f, 0.868495405f},
-std::array<float,2>{0.110494561f, 0.0766200125f},
-std::array<float,2>{0.492629439f, 0.664134145f},
-std::array<float,2>{0.901129901f, 0.342430025f},
-std::array<float,2>{0.847021878f, 0.615657628f},
-std::array<float,2>{0.260186255f, 0.400060952f},
-std::array<float,2>{0.187311456f, 0.934789836f},
-std::array<float,2>{0.62182188f, 0.19121398f},
-std::array<float,2>{0.769775987f, 0.764408231f},
-std::array<float,2>{0.324500442f, 0.0486241505f},
-std::array<float,2>{0.249551147f, 0.694130421f},
-std::array<float,2>{0.501454949f, 0.294959247f},
-std::array<float,2>{0.662624776f, 0.546914637f},
-std::array<float,2>{0.0505027659f, 0.455736101f},
-std::array<float,2>{0.398559362f, 0.989160478f},
-std::array<float,2>{0.991102576f, 0.139324397f},
-std::array<float,2>{0.591099918f, 0.89052248f},
-std::array<float,2>{0.135398716f, 0.223719418f},
-std::array<float,2>{0.284320146f, 0.567552447f},
-std::array<float,2>{0.831653833f, 0.421118468f},
-std::array<float,2>{0.911721408f, 0.629419744f},
-std::array<float,2>{0.440698653f, 0.350338966f},
-std::array<float,2>{0.0713915601f, 0.838655651f},
-std::array<float,2>{0.707503438f, 0.0982036367f},
-std::array<float,2>{0.879648447f, 0.812951684f},
-std::array<float,2>{0.477313221f, 0.120819934f},
-std::array<float,2>{0.101864301f, 0.653545082f},
-std::array<float,2>{0.723274887f, 0.363100886f},
-std::array<float,2>{0.602818668f, 0.593060136f},
-std::array<float,2>{0.164842919f, 0.425428957f},
-std::array<float,2>{0.273660839f, 0.893753052f},
-std::array<float,2>{0.86162585f, 0.240643859f},
-std::array<float,2>{0.632938206f, 0.980375648f},
-std::array<float,2>{0.0101449462f, 0.15027526f},
-std::array<float,2>{0.428183615f, 0.546294689f},
-std::array<float,2>{0.941917062f, 0.450199842f},
-std::array<float,2>{0.786390066f, 0.706318438f},
-std::array<float,2>{0.355241179f, 0.303075939f},
-std::array<float,2>{0.210794106f, 0.777881384f},
-std::array<float,2>{0.544713676f, 0.043814525f},
-std::array<float,2>{0.827362001f, 0.912922144f},
-std::array<float,2>{0.298654169f, 0.213770539f},
-std::array<float,2>{0.146124899f, 0.596416116f},
-std::array<float,2>{0.576761603f, 0.381444037f},
-std::array<float,2>{0.69457984f, 0.686992466f},
-std::array<float,2>{0.0795720592f, 0.326745927f},
-std::array<float,2>{0.453536272f, 0.849571764f},
-std::array<float,2>{0.92216897f, 0.0899203196f},
-std::array<float,2>{0.524355471f, 0.793628693f},
-std::array<float,2>{0.229885533f, 0.0105280438f},
-std::array<float,2>{0.328170329f, 0.738645256f},
-std::array<float,2>{0.765025735f, 0.278792948f},
-std::array<float,2>{0.974154055f, 0.504356861f},
-std::array<float,2>{0.378426373f, 0.498138428f},
-std::array<float,2>{0.0443890244f, 0.952011406f},
-std::array<float,2>{0.683138013f, 0.184833243f},
-std::array<float,2>{0.928158224f, 0.994533837f},
-std::array<float,2>{0.46081534f, 0.127033353f},
-std::array<float,2>{0.0831309631f, 0.561156034f},
-std::array<float,2>{0.689076304f, 0.466398031f},
-std::array<float,2>{0.573016644f, 0.699365377f},
-std::array<float,2>{0.141284823f, 0.288238317f},
-std::array<float,2>{0.304488003f, 0.751944005f},
-std::array<float,2>{0.823504746f, 0.0579365231f},
-std::array<float,2>{0.685372472f, 0.829172969f},
-std::array<float,2>{0.0421947762f, 0.102332272f},
-std::array<float,2>{0.380014926f, 0.634707451f},
-std::array<float,2>{0.971146762f, 0.35256207f},
-std::array<float,2>{0.759494841f, 0.57255125f},
-std::array<float,2>{0.333851844f, 0.412708193f},
-std::array<float,2>{0.230634347f, 0.882695735f},
-std::array<float,2>{0.529481232f, 0.23096709f},
-std::array<float,2>{0.864817917f, 0.802116096f},
-std::array<float,2>{0.279363453f, 0.0223391969f},
-std::array<float,2>{0.170640111f, 0.722399175f},
-std::array<float,2>{0.606776237f, 0.264784455f},
-std::array<float,2>{0.720728874f, 0.526794255f},
-std::array<float,2>{0.108101472f, 0.477422744f},
-std::array<float,2>{0.482336789f, 0.964018941f},
-std::array<float,2>{0.878544211f, 0.16368489f},
-std::array<float,2>{0.541096866f, 0.929599404f},
-std::array<float,2>{0.205356807f, 0.199497774f},
-std::array<float,2>{0.357407242f, 0.617291152f},
-std::array<float,2>{0.782010913f, 0.395220369f},
-std::array<float,2>{0.938095987f, 0.657828033f},
-std::array<float,2>{0.422109514f, 0.333609015f},
-std::array<float,2>{0.0142138107f, 0.864903808f},
-std::array<float,2>{0.640205503f, 0.0626648813f},
-std::array<float,2>{0.986737192f, 0.856504619f},
-std::array<float,2>{0.402442664f, 0.0855711699f},
-std::array<float,2>{0.0546858013f, 0.673735499f},
-std::array<float,2>{0.65964824f, 0.312836647f},
-std::array<float,2>{0.506659091f, 0.601655841f},
-std::array<float,2>{0.242892832f, 0.384763509f},
-std::array<float,2>{0.32208848f, 0.91539818f},
-std::array<float,2>{0.765954912f, 0.206999391f},
-std::array<float,2>{0.704546988f, 0.94487536f},
-std::array<float,2>{0.0772466511f, 0.17903994f},
-std::array<float,2>{0.444078654f, 0.511245251f},
-std::array<float,2>{0.908979416f, 0.489889711f},
-std::array<float,2>{0.835169196f, 0.749884725f},
-std::array<float,2>{0.286822528f, 0.269403309f},
-std::array<float,2>{0.137952939f, 0.789015889f},
-std::array<float,2>{0.587279201f, 0.00135567423f},
-std::array<float,2>{0.803732753f, 0.903373897f},
-std::array<float,2>{0.369707197f, 0.246226713f},
-std::array<float,2>{0.190474838f, 0.580975771f},
-std::array<float,2>{0.551623464f, 0.431979835f},
-std::array<float,2>{0.651578486f, 0.641425312f},
-std::array<float,2>{0.0270778425f, 0.37447691f},
-std::array<float,2>{0.412915021f, 0.825545788f},
-std::array<float,2>{0.968060255f, 0.116751283f},
-std::array<float,2>{0.619853795f, 0.765756547f},
-std::array<float,2>{0.180925533f, 0.0337275192f},
-std::array<float,2>{0.263183534f, 0.714200616f},
-std::array<float,2>{0.848722339f, 0.310430795f},
-std::array<float,2>{0.903383374f, 0.534263015f},
-std::array<float,2>{0.498030245f, 0.439822167f},
-std::array<float,2>{0.115142308f, 0.976199329f},
-std::array<float,2>{0.741262376f, 0.144050136f},
-std::array<float,2>{0.958592057f, 0.909886658f},
-std::array<float,2>{0.41799584f, 0.218102276f},
-std::array<float,2>{0.0174216479f, 0.598319888f},
-std::array<float,2>{0.646175146f, 0.378266335f},
-std::array<float,2>{0.558823705f, 0.682162941f},
-std::array<float,2>{0.196014225f, 0.321770549f},
-std::array<float,2>{0.36152187f, 0.843923807f},
-std::array<float,2>{0.807563782f, 0.088383764f},
-std::array<float,2>{0.749153078f, 0.790911734f},
-std::array<float,2>{0.124772102f, 0.0131920548f},
-std::array<float,2>{0.489306033f, 0.736686528f},
-std::array<float,2>{0.897638917f, 0.274967074f},
-std::array<float,2>{0.853880823f, 0.50069499f},
-std::array<float,2>{0.251047492f, 0.492523581f},
-std::array<float,2>{0.175638065f, 0.947603106f},
-std::array<float,2>{0.614175677f, 0.181836933f},
-std::array<float,2>{0.776928604f, 0.81768012f},
-std::array<float,2>{0.313336283f, 0.122174934f},
-std::array<float,2>{0.235515788f, 0.651893437f},
-std::array<float,2>{0.509775221f, 0.363822103f},
-std::array<float,2>{0.669447422f, 0.588781536f},
-std::array<float,2>{0.0581495017f, 0.428303599f},
-std::array<float,2>{0.397756338f, 0.896557331f},
-std::array<float,2>{0.993407428f, 0.237107158f},
-std::array<float,2>{0.578178525f, 0.980735958f},
-std::array<float,2>{0.129060775f, 0.153007045f},
-std::array<float,2>{0.29339245f, 0.539443135f},
-std::array<float,2>{0.838694692f, 0.448413253f},
-std::array<float,2>{0.918031037f, 0.707173586f},
-std::array<float,2>{0.452618152f, 0.299462497f},
-std::array<float,2>{0.067096144f, 0.776432097f},
-std::array<float,2>{0.715250611f, 0.040936172f},
-std::array<float,2>{0.883833349f, 0.76034528f},
-std::array<float,2>{0.470677614f, 0.0522875786f},
-std::array<float,2>{0.0960293114f, 0.689570844f},
-std::array<float,2>{0.729822397f, 0.291916907f},
-std::array<float,2>{0.600351036f, 0.554624021f},
-std::array<float,2>{0.157511145f, 0.459978551f},
-std::array<float,2>{0.265813053f, 0.985028267f},
-std::array<float,2>{0.871125758f, 0.136316463f},
-std::array<float,2>{0.629299164f, 0.883714378f},
-std::array<float,2>{0.00775594404f, 0.220451564f},
-std::array<float,2>{0.437437832f, 0.56620717f},
-std::array<float,2>{0.951605499f, 0.416656166f},
-std::array<float,2>{0.79548043f, 0.627416849f},
-std::array<float,2>{0.34527263f, 0.346791536f},
-std::array<float,2>{0.217801496f, 0.842875004f},
-std::array<float,2>{0.533412933f, 0.0944923908f},
-std::array<float,2>{0.818348944f, 0.956409931f},
-std::array<float,2>{0.309556246f, 0.167225942f},
-std::array<float,2>{0.149021193f, 0.51800257f},
-std::array<float,2>{0.56597501f, 0.475043625f},
-std::array<float,2>{0.696992874f, 0.731742382f},
-std::array<float,2>{0.0871679559f, 0.251201332f},
-std::array<float,2>{0.466550142f, 0.810597181f},
-std::array<float,2>{0.93199259f, 0.0246875361f},
-std::array<float,2>{0.520154655f, 0.874659657f},
-std::array<float,2>{0.222086728f, 0.071367085f},
-std::array<float,2>{0.336247295f, 0.671196461f},
-std::array<float,2>{0.757288158f, 0.338812351f},
-std::array<float,2>{0.983880997f, 0.609834731f},
-std::array<float,2>{0.383522332f, 0.402951509f},
-std::array<float,2>{0.0343963988f, 0.931128383f},
-std::array<float,2>{0.673799932f, 0.192859352f},
-std::array<float,2>{0.893801451f, 0.875298083f},
-std::array<float,2>{0.487866342f, 0.22868295f},
-std::array<float,2>{0.121008031f, 0.574603319f},
-std::array<float,2>{0.742206097f, 0.409644961f},
-std::array<float,2>{0.610392153f, 0.638263226f},
-std::array<float,2>{0.179560751f, 0.356777579f},
-std::array<float,2>{0.25701946f, 0.832060635f},
-std::array<float,2>{0.858615756f, 0.107300162f},
-std::array<float,2>{0.644033372f, 0.754258156f},
-std::array<float,2>{0.021594651f, 0.0621593893f},
-std::array<float,2>{0.417210579f, 0.698163748f},
-std::array<float,2>{0.956597507f, 0.284918159f},
-std::array<float,2>{0.809613824f, 0.556194425f},
-std::array<float,2>{0.366014332f, 0.461586356f},
-std::array<float,2>{0.201571137f, 0.996210456f},
-std::array<float,2>{0.554946542f, 0.132484257f},
-std::array<float,2>{0.843092144f, 0.8602193f},
-std::array<float,2>{0.290496647f, 0.0698160455f},
-std::array<float,2>{0.125819743f, 0.661946118f},
-std::array<float,2>{0.582899034f, 0.330417454f},
-std::array<float,2>{0.713655829f, 0.622679532f},
-std::array<float,2>{0.0652593002f, 0.393510491f},
-std::array<float,2>{0.445657909f, 0.925456822f},
-std::array<float,2>{0.916707158f, 0.195409119f},
-std::array<float,2>{0.51274842f, 0.965386152f},
-std::array<float,2>{0.240258783f, 0.158619538f},
-std::array<float,2>{0.317371756f, 0.529727995f},
-std::array<float,2>{0.779224575f, 0.483791858f},
-std::array<float,2>{0.997899592f, 0.725810349f},
-std::array<float,2>{0.392896533f, 0.261423975f},
-std::array<float,2>{0.0615287647f, 0.79834187f},
-std::array<float,2>{0.665922284f, 0.0185470842f},
-std::array<float,2>{0.949205101f, 0.784531772f},
-std::array<float,2>{0.431052953f, 0.00417103991f},
-std::array<float,2>{0.00187342649f, 0.742607892f},
-std::array<float,2>{0.625020266f, 0.271356493f},
-std::array<float,2>{0.53640455f, 0.512428641f},
-std::array<float,2>{0.212374583f, 0.48551783f},
-std::array<float,2>{0.348005414f, 0.940897405f},
-std::array<float,2>{0.789080441f, 0.172122821f},
-std::array<float,2>{0.734217286f, 0.919278681f},
-std::array<float,2>{0.101081237f, 0.210215837f},
-std::array<float,2>{0.4761042f, 0.606929481f},
-std::array<float,2>{0.89009577f, 0.389131844f},
-std::array<float,2>{0.87019223f, 0.676726997f},
-std::array<float,2>{0.270129293f, 0.316560775f},
-std::array<float,2>{0.163260788f, 0.853108823f},
-std::array<float,2>{0.597292662f, 0.0807965919f},
-std::array<float,2>{0.752085388f, 0.970620692f},
-std::array<float,2>{0.341582179f, 0.147141621f},
-std::array<float,2>{0.226541728f, 0.535973191f},
-std::array<float,2>{0.518597603f, 0.445256054f},
-std::array<float,2>{0.678447843f, 0.715322137f},
-std::array<float,2>{0.0373396501f, 0.307200611f},
-std::array<float,2>{0.389743745f, 0.771168292f},
-std::array<float,2>{0.978339612f, 0.036993023f},
-std::array<float,2>{0.568051696f, 0.820634961f},
-std::array<float,2>{0.153636128f, 0.112499595f},
-std::array<float,2>{0.306494504f, 0.644711435f},
-std::array<float,2>{0.81520468f, 0.370859653f},
-std::array<float,2>{0.937198162f, 0.582910299f},
-std::array<float,2>{0.462095559f, 0.434429914f},
-std::array<float,2>{0.0918988064f, 0.902268469f},
-std::array<float,2>{0.701821268f, 0.245700985f},
-std::array<float,2>{0.975279331f, 0.953104079f},
-std::array<float,2>{0.375793695f, 0.183800265f},
-std::array<float,2>{0.0457293876f, 0.50522536f},
-std::array<float,2>{0.680796921f, 0.4998281f},
-std::array<float,2>{0.525650144f, 0.73991102f},
-std::array<float,2>{0.228492707f, 0.27824837f},
-std::array<float,2>{0.331730545f, 0.794918537f},
-std::array<float,2>{0.763014674f, 0.0115396446f},
-std::array<float,2>{0.693139195f, 0.848035276f},
-std::array<float,2>{0.0802807584f, 0.090950042f},
-std::array<float,2>{0.456648767f, 0.685857713f},
-std::array<float,2>{0.924541593f, 0.327901006f},
-std::array<float,2>{0.826068044f, 0.597374141f},
-std::array<float,2>{0.299460918f, 0.382340699f},
-std::array<float,2>{0.148343429f, 0.913418591f},
-std::array<float,2>{0.574981928f, 0.214224532f},
-std::array<float,2>{0.788872063f, 0.778853178f},
-std::array<float,2>{0.353494763f, 0.0448830947f},
-std::array<float,2>{0.20753175f, 0.705483973f},
-std::array<float,2>{0.545925796f, 0.304605842f},
-std::array<float,2>{0.63478899f, 0.545105755f},
-std::array<float,2>{0.00852905493f, 0.449289352f},
-std::array<float,2>{0.4269723f, 0.978741825f},
-std::array<float,2>{0.945286572f, 0.148690134f},
-std::array<float,2>{0.603888929f, 0.893364251f},
-std::array<float,2>{0.166555107f, 0.241526917f},
-std::array<float,2>{0.275413692f, 0.592605174f},
-std::array<float,2>{0.859432578f, 0.42391628f},
-std::array<float,2>{0.881549478f, 0.652372241f},
-std::array<float,2>{0.479225665f, 0.362246394f},
-std::array<float,2>{0.104358651f, 0.813983023f},
-std::array<float,2>{0.725064635f, 0.119196445f},
-std::array<float,2>{0.913834751f, 0.839263201f},
-std::array<float,2>{0.437524855f, 0.0993871689f},
-std::array<float,2>{0.0737273768f, 0.630711436f},
-std::array<float,2>{0.709949255f, 0.350646377f},
-std::array<float,2>{0.593559504f, 0.566775203f},
-std::array<float,2>{0.134502888f, 0.420244902f},
-std::array<float,2>{0.282742739f, 0.889345944f},
-std::array<float,2>{0.829733551f, 0.223356158f},
-std::array<float,2>{0.66066891f, 0.990012348f},
-std::array<float,2>{0.0483916327f, 0.14000079f},
-std::array<float,2>{0.402067691f, 0.547948658f},
-std::array<float,2>{0.989192903f, 0.456449866f},
-std::array<float,2>{0.772364855f, 0.694896758f},
-std::array<float,2>{0.326696038f, 0.296595544f},
-std::array<float,2>{0.247671455f, 0.765407026f},
-std::array<float,2>{0.50295949f, 0.0474824682f},
-std::array<float,2>{0.844295144f, 0.934481382f},
-std::array<float,2>{0.258154958f, 0.189552709f},
-std::array<float,2>{0.184962824f, 0.616647542f},
-std::array<float,2>{0.624739766f, 0.398733974f},
-std::array<float,2>{0.736755729f, 0.665944815f},
-std::array<float,2>{0.11262653f, 0.343134582f},
-std::array<float,2>{0.495609671f, 0.867947161f},
-std::array<float,2>{0.900027931f, 0.0775326043f},
-std::array<float,2>{0.547164261f, 0.80658704f},
-std::array<float,2>{0.191579506f, 0.0299697444f},
-std::array<float,2>{0.3725501f, 0.729168415f},
-std::array<float,2>{0.798359513f, 0.254602402f},
-std::array<float,2>{0.963045835f, 0.52172792f},
-std::array<float,2>{0.409818321f, 0.469848752f},
-std::array<float,2>{0.029786218f, 0.959305048f},
-std::array<float,2>{0.655891955f, 0.169141367f},
-std::array<float,2>{0.875808954f, 0.96260792f},
-std::array<float,2>{0.482772648f, 0.160638973f},
-std::array<float,2>{0.10693191f, 0.525204778f},
-std::array<float,2>{0.718892694f, 0.479582906f},
-std::array<float,2>{0.60818404f, 0.719961524f},
-std::array<float,2>{0.168332145f, 0.261755019f},
-std::array<float,2>{0.277658612f, 0.804107428f},
-std::array<float,2>{0.866609097f, 0.0198634677f},
-std::array<float,2>{0.637957871f, 0.866438448f},
-std::array<float,2>{0.0128692873f, 0.0660766289f},
-std::array<float,2>{0.425654531f, 0.658286929f},
-std::array<float,2>{0.940294981f, 0.335140824f},
-std::array<float,2>{0.783721507f, 0.62107724f},
-std::array<float,2>{0.357477635f, 0.397833943f},
-std::array<float,2>{0.203299358f, 0.926452696f},
-std::array<float,2>{0.540619433f, 0.202626705f},
-std::array<float,2>{0.821564376f, 0.752455473f},
-std::array<float,2>{0.302306205f, 0.0562926345f},
-std::array<float,2>{0.143809021f, 0.701641858f},
-std::array<float,2>{0.570651591f, 0.28690511f},
-std::array<float,2>{0.691139698f, 0.559946656f},
-std::array<float,2>{0.0844634846f, 0.468572527f},
-std::array<float,2>{0.458913028f, 0.992195427f},
-std::array<float,2>{0.926700473f, 0.126579657f},
-std::array<float,2>{0.528029978f, 0.880372822f},
-std::array<float,2>{0.233933449f, 0.234357908f},
-std::array<float,2>{0.334473073f, 0.571015835f},
-std::array<float,2>{0.761609375f, 0.410254627f},
-std::array<float,2>{0.969295561f, 0.636469245f},
-std::array<float,2>{0.381641001f, 0.355009466f},
-std::array<float,2>{0.0395529829f, 0.830132902f},
-std::array<float,2>{0.685783446f, 0.104743674f},
-std::array<float,2>{0.965200901f, 0.827334285f},
-std::array<float,2>{0.410536915f, 0.113807321f},
-std::array<float,2>{0.0246917456f, 0.643902063f},
-std::array<float,2>{0.648530364f, 0.372353464f},
-std::array<float,2>{0.554278731f, 0.578746974f},
-std::array<float,2>{0.189065099f, 0.430164188f},
-std::array<float,2>{0.36785987f, 0.904755235f},
-std::array<float,2>{0.801290154f, 0.249668047f},
-std::array<float,2>{0.740212321f, 0.972848952f},
-std::array<float,2>{0.116681203f, 0.141869232f},
-std::array<float,2>{0.499032944f, 0.532495856f},
-std::array<float,2>{0.904424965f, 0.439277261f},
-std::array<float,2>{0.849714875f, 0.712821126f},
-std::array<float,2>{0.26445663f, 0.31151545f},
-std::array<float,2>{0.182924777f, 0.76829505f},
-std::array<float,2>{0.617532372f, 0.0322024636f},
-std::array<float,2>{0.769080281f, 0.91793555f},
-std::array<float,2>{0.324002087f, 0.203704834f},
-std::array<float,2>{0.245885104f, 0.604657888f},
-std::array<float,2>{0.505102158f, 0.38577041f},
-std::array<float,2>{0.657365203f, 0.674470663f},
-std::array<float,2>{0.0512185805f, 0.31471917f},
-std::array<float,2>{0.404305995f, 0.857556939f},
-std::array<float,2>{0.984608948f, 0.0836382881f},
-std::array<float,2>{0.58806318f, 0.78686744f},
-std::array<float,2>{0.139020637f, 0.00360455248f},
-std::array<float,2>{0.28802979f, 0.746850491f},
-std::array<float,2>{0.83317399f, 0.266131133f},
-std::array<float,2>{0.906763792f, 0.508797526f},
-std::array<float,2>{0.441933692f, 0.49213928f},
-std::array<float,2>{0.0752238259f, 0.942669034f},
-std::array<float,2>{0.705956638f, 0.176823214f},
-std::array<float,2>{0.994469941f, 0.896483064f},
-std::array<float,2>{0.394986778f, 0.235907778f},
-std::array<float,2>{0.0554006472f, 0.587577343f},
-std::array<float,2>{0.671681821f, 0.427725464f},
-std::array<float,2>{0.508359194f, 0.650161624f},
-std::array<float,2>{0.237379089f, 0.366532385f},
-std::array<float,2>{0.31565845f, 0.820250452f},
-std::array<float,2>{0.773606241f, 0.124144621f},
-std::array<float,2>{0.718170524f, 0.775007606f},
-std::array<float,2>{0.0693856999f, 0.0414009206f},
-std::array<float,2>{0.451054722f, 0.709480107f},
-std::array<float,2>{0.919980466f, 0.296997309f},
-std::array<float,2>{0.836293459f, 0.542152286f},
-std::array<float,2>{0.296401709f, 0.446089238f},
-std::array<float,2>{0.131496355f, 0.984031677f},
-std::array<float,2>{0.581135035f, 0.155233622f},
-std::array<float,2>{0.805141151f, 0.847022235f},
-std::array<float,2>{0.36132434f, 0.086528495f},
-std::array<float,2>{0.198019534f, 0.681284487f},
-std::array<float,2>{0.56209141f, 0.323140085f},
-std::array<float,2>{0.647833347f, 0.599724293f},
-std::array<float,2>{0.0185095239f, 0.376576602f},
-std::array<float,2>{0.421392173f, 0.906386435f},
-std::array<float,2>{0.959567666f, 0.215090439f},
-std::array<float,2>{0.616929412f, 0.947045267f},
-std::array<float,2>{0.172347203f, 0.181194931f},
-std::array<float,2>{0.252926499f, 0.502499104f},
-std::array<float,2>{0.852652967f, 0.494508117f},
-std::array<float,2>{0.895539701f, 0.735264242f},
-std::array<float,2>{0.490363359f, 0.275524259f},
-std::array<float,2>{0.122600742f, 0.791070163f},
-std::array<float,2>{0.747129023f, 0.0150067713f},
-std::array<float,2>{0.930247545f, 0.808945537f},
-std::array<float,2>{0.467895418f, 0.0257395823f},
-std::array<float,2>{0.0886985138f, 0.733958006f},
-std::array<float,2>{0.697621644f, 0.252132714f},
-std::array<float,2>{0.564224303f, 0.516075194f},
-std::array<float,2>{0.150725439f, 0.473581284f},
-std::array<float,2>{0.311731905f, 0.953655779f},
-std::array<float,2>{0.819809556f, 0.164958864f},
-std::array<float,2>{0.675640643f, 0.932880163f},
-std::array<float,2>{0.0316790827f, 0.19465062f},
-std::array<float,2>{0.3848764f, 0.611988246f},
-std::array<float,2>{0.98127377f, 0.40585649f},
-std::array<float,2>{0.755212545f, 0.669579446f},
-std::array<float,2>{0.339351118f, 0.336905092f},
-std::array<float,2>{0.219890282f, 0.872439742f},
-std::array<float,2>{0.521791756f, 0.0731951073f},
-std::array<float,2>{0.874197483f, 0.987539828f},
-std::array<float,2>{0.269356996f, 0.134634569f},
-std::array<float,2>{0.159842044f, 0.552144408f},
-std::array<float,2>{0.599149525f, 0.457071066f},
-std::array<float,2>{0.728367329f, 0.687955201f},
-std::array<float,2>{0.0944144875f, 0.290697962f},
-std::array<float,2>{0.472603798f, 0.759448826f},
-std::array<float,2>{0.885414422f, 0.0545396358f},
-std::array<float,2>{0.531898558f, 0.841203272f},
-std::array<float,2>{0.216408953f, 0.0972694829f},
-std::array<float,2>{0.347058058f, 0.625708759f},
-std::array<float,2>{0.794305146f, 0.344990283f},
-std::array<float,2>{0.949511826f, 0.563652992f},
-std::array<float,2>{0.43361643f, 0.4159154f},
-std::array<float,2>{0.00476741884f, 0.885161221f},
-std::array<float,2>{0.631922722f, 0.221455216f},
-std::array<float,2>{0.915505111f, 0.921900809f},
-std::array<float,2>{0.449048877f, 0.198074147f},
-std::array<float,2>{0.0631588474f, 0.623784781f},
-std::array<float,2>{0.711479604f, 0.39141959f},
-std::array<float,2>{0.585899591f, 0.662412941f},
-std::array<float,2>{0.127799422f, 0.329964161f},
-std::array<float,2>{0.291391283f, 0.862240314f},
-std::array<float,2>{0.841564596f, 0.0681909248f},
-std::array<float,2>{0.666804492f, 0.79938066f},
-std::array<float,2>{0.0604844503f, 0.015797291f},
-std::array<float,2>{0.391386032f, 0.723254919f},
-std::array<float,2>{0.99949801f, 0.258519411f},
-std::array<float,2>{0.780223191f, 0.528870165f},
-std::array<float,2>{0.319367975f, 0.480607629f},
-std::array<float,2>{0.239996836f, 0.968113601f},
-std::array<float,2>{0.515000761f, 0.15751116f},
-std::array<float,2>{0.856264532f, 0.835901737f},
-std::array<float,2>{0.254727721f, 0.108126298f},
-std::array<float,2>{0.177286044f, 0.639183342f},
-std::array<float,2>{0.611591101f, 0.357496351f},
-std::array<float,2>{0.744527042f, 0.577050209f},
-std::array<float,2>{0.118429795f, 0.407577962f},
-std::array<float,2>{0.48482728f, 0.877549052f},
-std::array<float,2>{0.892131448f, 0.228013515f},
-std::array<float,2>{0.557906628f, 0.999659002f},
-std::array<float,2>{0.199729919f, 0.130418703f},
-std::array<float,2>{0.363581419f, 0.556972742f},
-std::array<float,2>{0.812315106f, 0.4630391f},
-std::array<float,2>{0.954197407f, 0.697002888f},
-std::array<float,2>{0.41421476f, 0.281718969f},
-std::array<float,2>{0.0201632306f, 0.756203413f},
-std::array<float,2>{0.642472863f, 0.0596944652f},
-std::array<float,2>{0.979025185f, 0.772752464f},
-std::array<float,2>{0.387674183f, 0.0380184539f},
-std::array<float,2>{0.0358030796f, 0.718259573f},
-std::array<float,2>{0.677471042f, 0.305838913f},
-std::array<float,2>{0.517327011f, 0.537499547f},
-std::array<float,2>{0.223995477f, 0.442038298f},
-std::array<float,2>{0.343184024f, 0.971544147f},
-std::array<float,2>{0.750266314f, 0.145520061f},
-std::array<float,2>{0.699627995f, 0.898467302f},
-std::array<float,2>{0.0901259854f, 0.242753059f},
-std::array<float,2>{0.464290887f, 0.584773302f},
-std::array<float,2>{0.934632182f, 0.435930103f},
-std::array<float,2>{0.813294411f, 0.647051632f},
-std::array<float,2>{0.307434648f, 0.368723601f},
-std::array<float,2>{0.156237245f, 0.823069096f},
-std::array<float,2>{0.569814146f, 0.110647105f},
-std::array<float,2>{0.792430282f, 0.939029753f},
-std::array<float,2>{0.34989351f, 0.174147353f},
-std::array<float,2>{0.214077681f, 0.514773071f},
-std::array<float,2>{0.537477612f, 0.487562865f},
-std::array<float,2>{0.627804458f, 0.745938718f},
-std::array<float,2>{0.00378009141f, 0.272367835f},
-std::array<float,2>{0.433247954f, 0.782241285f},
-std::array<float,2>{0.946681499f, 0.00718253991f},
-std::array<float,2>{0.59422648f, 0.85395509f},
-std::array<float,2>{0.161512256f, 0.0792732313f},
-std::array<float,2>{0.271622002f, 0.677994013f},
-std::array<float,2>{0.868916452f, 0.320086092f},
-std::array<float,2>{0.887310684f, 0.607991755f},
-std::array<float,2>{0.473453909f, 0.388418078f},
-std::array<float,2>{0.0995777175f, 0.920564175f},
-std::array<float,2>{0.731675148f, 0.208050877f},
-std::array<float,2>{0.943041325f, 0.977434576f},
-std::array<float,2>{0.429474562f, 0.151865289f},
-std::array<float,2>{0.0112143755f, 0.544640243f},
-std::array<float,2>{0.634442806f, 0.451563656f},
-std::array<float,2>{0.543926835f, 0.704177737f},
-std::array<float,2>{0.209236443f, 0.301544487f},
-std::array<float,2>{0.353896856f, 0.779348135f},
-std::array<float,2>{0.785587072f, 0.0450260714f},
-std::array<float,2>{0.72381413f, 0.815634608f},
-std::array<float,2>{0.102652863f, 0.118530989f},
-std::array<float,2>{0.47818768f, 0.65447408f},
-std::array<float,2>{0.880653322f, 0.360065401f},
-std::array<float,2>{0.862483501f, 0.591224372f},
-std::array<float,2>{0.275135547f, 0.422826052f},
-std::array<float,2>{0.165460035f, 0.892341971f},
-std::array<float,2>{0.601563275f, 0.239582345f},
-std::array<float,2>{0.764490366f, 0.795747757f},
-std::array<float,2>{0.329183936f, 0.00920079555f},
-std::array<float,2>{0.229233533f, 0.74164921f},
-std::array<float,2>{0.525191545f, 0.280164957f},
-std::array<float,2>{0.682602108f, 0.507197022f},
-std::array<float,2>{0.0438059978f, 0.498040795f},
-std::array<float,2>{0.377873808f, 0.951051712f},
-std::array<float,2>{0.972736359f, 0.186519027f},
-std::array<float,2>{0.577949882f, 0.91187942f},
-std::array<float,2>{0.145089582f, 0.212533697f},
-std::array<float,2>{0.297030509f, 0.593927681f},
-std::array<float,2>{0.826402009f, 0.380570978f},
-std::array<float,2>{0.922861099f, 0.684525192f},
-std::array<float,2>{0.454954207f, 0.325537741f},
-std::array<float,2>{0.0788647383f, 0.850442946f},
-std::array<float,2>{0.693433166f, 0.0925947577f},
-std::array<float,2>{0.901394486f, 0.870002329f},
-std::array<float,2>{0.493309408f, 0.0756065622f},
-std::array<float,2>{0.109834425f, 0.666555464f},
-std::array<float,2>{0.735565245f, 0.340415418f},
-std::array<float,2>{0.622140944f, 0.614510715f},
-std::array<float,2>{0.186007142f, 0.40103963f},
-std::array<float,2>{0.26090169f, 0.936670244f},
-std::array<float,2>{0.846264541f, 0.187706038f},
-std::array<float,2>{0.654094517f, 0.958927989f},
-std::array<float,2>{0.0279264785f, 0.170034364f},
-std::array<float,2>{0.406805068f, 0.520066559f},
-std::array<float,2>{0.961675644f, 0.471579403f},
-std::array<float,2>{0.799832582f, 0.727459192f},
-std::array<float,2>{0.374812961f, 0.25769344f},
-std::array<float,2>{0.194133222f, 0.807728589f},
-std::array<float,2>{0.550086915f, 0.0288278311f},
-std::array<float,2>{0.83028537f, 0.887872696f},
-std::array<float,2>{0.283817112f, 0.224836618f},
-std::array<float,2>{0.136455387f, 0.56968379f},
-std::array<float,2>{0.590757251f, 0.418741196f},
-std::array<float,2>{0.708984137f, 0.631580472f},
-std::array<float,2>{0.0707715228f, 0.349143565f},
-std::array<float,2>{0.43982321f, 0.837393761f},
-std::array<float,2>{0.91055131f, 0.100225814f},
-std::array<float,2>{0.500513315f, 0.762195766f},
-std::array<float,2>{0.24853313f, 0.0495477132f},
-std::array<float,2>{0.325715661f, 0.691407323f},
-std::array<float,2>{0.771069288f, 0.294911504f},
-std::array<float,2>{0.991511822f, 0.550759196f},
-std::array<float,2>{0.399640262f, 0.45340082f},
-std::array<float,2>{0.0491029248f, 0.991786659f},
-std::array<float,2>{0.663090527f, 0.136879116f},
-std::array<float,2>{0.917355001f, 0.967891455f},
-std::array<float,2>{0.447261065f, 0.157424718f},
-std::array<float,2>{0.065604791f, 0.529094815f},
-std::array<float,2>{0.71391654f, 0.480910271f},
-std::array<float,2>{0.583745778f, 0.723404825f},
-std::array<float,2>{0.126072466f, 0.2587277f},
-std::array<float,2>{0.289589345f, 0.799705267f},
-std::array<float,2>{0.841951251f, 0.0159573704f},
-std::array<float,2>{0.66471529f, 0.861939132f},
-std::array<float,2>{0.060883373f, 0.0678886101f},
-std::array<float,2>{0.3937819f, 0.662224352f},
-std::array<float,2>{0.996413231f, 0.329682291f},
-std::array<float,2>{0.77820307f, 0.623548806f},
-std::array<float,2>{0.318197519f, 0.391158491f},
-std::array<float,2>{0.24172993f, 0.922345638f},
-std::array<float,2>{0.511962235f, 0.197964326f},
-std::array<float,2>{0.857673228f, 0.756002963f},
-std::array<float,2>{0.256612301f, 0.0600043982f},
-std::array<float,2>{0.178139821f, 0.697261691f},
-std::array<float,2>{0.610298932f, 0.281478971f},
-std::array<float,2>{0.743771434f, 0.556738555f},
-std::array<float,2>{0.120049529f, 0.463202745f},
-std::array<float,2>{0.486388862f, 0.999919593f},
-std::array<float,2>{0.893067181f, 0.130802646f},
-std::array<float,2>{0.555929124f, 0.877689898f},
-std::array<float,2>{0.20240806f, 0.227643505f},
-std::array<float,2>{0.366223872f, 0.576846242f},
-std::array<float,2>{0.808801889f, 0.407405525f},
-std::array<float,2>{0.95532757f, 0.639553428f},
-std::array<float,2>{0.416027009f, 0.357807279f},
-std::array<float,2>{0.0228296127f, 0.8355093f},
-std::array<float,2>{0.642734706f, 0.108224161f},
-std::array<float,2>{0.977252424f, 0.82296294f},
-std::array<float,2>{0.388850123f, 0.110495284f},
-std::array<float,2>{0.0383984633f, 0.647385955f},
-std::array<float,2>{0.678981304f, 0.369063288f},
-std::array<float,2>{0.51824832f, 0.584583879f},
-std::array<float,2>{0.225257605f, 0.435674012f},
-std::array<float,2>{0.34007141f, 0.898873985f},
-std::array<float,2>{0.753062367f, 0.242966548f},
-std::array<float,2>{0.702400684f, 0.971421838f},
-std::array<float,2>{0.0930044875f, 0.145962417f},
-std::array<float,2>{0.461315125f, 0.537127852f},
-std::array<float,2>{0.935675323f, 0.442272663f},
-std::array<float,2>{0.815510571f, 0.717937708f},
-std::array<float,2>{0.3049649f, 0.30607748f},
-std::array<float,2>{0.152359232f, 0.772652984f},
-std::array<float,2>{0.566661358f, 0.037605796f},
-std::array<float,2>{0.790656328f, 0.920868039f},
-std::array<float,2>{0.349551618f, 0.208384722f},
-std::array<float,2>{0.21110341f, 0.608185112f},
-std::array<float,2>{0.535405576f, 0.38845253f},
-std::array<float,2>{0.626609266f, 0.677964687f},
-std::array<float,2>{0.000177246999f, 0.319974035f},
-std::array<float,2>{0.430187047f, 0.853670895f},
-std::array<float,2>{0.947606564f, 0.0794486403f},
-std::array<float,2>{0.596605301f, 0.78266567f},
-std::array<float,2>{0.162366778f, 0.00706129381f},
-std::array<float,2>{0.271388441f, 0.745847285f},
-std::array<float,2>{0.869698882f, 0.272045016f},
-std::array<float,2>{0.889374733f, 0.515058219f},
-std::array<float,2>{0.475380749f, 0.487378597f},
-std::array<float,2>{0.0999638438f, 0.939375043f},
-std::array<float,2>{0.733388364f, 0.17389001f},
-std::array<float,2>{0.94380939f, 0.8921808f},
-std::array<float,2>{0.426550597f, 0.239469975f},
-std::array<float,2>{0.00900151301f, 0.591042638f},
-std::array<float,2>{0.636347473f, 0.422395259f},
-std::array<float,2>{0.545725048f, 0.654574633f},
-std::array<float,2>{0.208479002f, 0.360349685f},
-std::array<float,2>{0.351757973f, 0.815774143f},
-std::array<float,2>{0.787361622f, 0.118362404f},
-std::array<float,2>{0.726140976f, 0.779760778f},
-std::array<float,2>{0.104513727f, 0.0453970581f},
-std::array<float,2>{0.479745001f, 0.704486012f},
-std::array<float,2>{0.882385671f, 0.301407605f},
-std::array<float,2>{0.861185014f, 0.544897556f},
-std::array<float,2>{0.2773f, 0.451176912f},
-std::array<float,2>{0.167071879f, 0.977274299f},
-std::array<float,2>{0.604802251f, 0.152245402f},
-std::array<float,2>{0.761936188f, 0.850150764f},
-std::array<float,2>{0.330628246f, 0.0924087912f},
-std::array<float,2>{0.227377862f, 0.684133887f},
-std::array<float,2>{0.52696681f, 0.325311363f},
-std::array<float,2>{0.679801583f, 0.594206095f},
-std::array<float,2>{0.0461285375f, 0.380731314f},
-std::array<float,2>{0.375988632f, 0.911741018f},
-std::array<float,2>{0.976549506f, 0.212842539f},
-std::array<float,2>{0.576098263f, 0.950741351f},
-std::array<float,2>{0.1469547f, 0.186220229f},
-std::array<float,2>{0.299862891f, 0.507008433f},
-std::array<float,2>{0.824934006f, 0.497665018f},
-std::array<float,2>{0.925619602f, 0.741257608f},
-std::array<float,2>{0.455306202f, 0.280005366f},
-std::array<float,2>{0.0814559609f, 0.79550004f},
-std::array<float,2>{0.69145596f, 0.00900506694f},
-std::array<float,2>{0.898549914f, 0.80807215f},
-std::array<float,2>{0.494397104f, 0.0292201769f},
-std::array<float,2>{0.112054773f, 0.727238894f},
-std::array<float,2>{0.737886846f, 0.257409692f},
-std::array<float,2>{0.62364012f, 0.520288169f},
-std::array<float,2>{0.183809936f, 0.471241564f},
-std::array<float,2>{0.259324342f, 0.958710492f},
-std::array<float,2>{0.845228255f, 0.170178413f},
-std::array<float,2>{0.654511034f, 0.936807811f},
-std::array<float,2>{0.0309311841f, 0.187763423f},
-std::array<float,2>{0.408608526f, 0.614371181f},
-std::array<float,2>{0.96416223f, 0.401294589f},
-std::array<float,2>{0.797266603f, 0.666913271f},
-std::array<float,2>{0.371969908f, 0.340722769f},
-std::array<float,2>{0.192679405f, 0.869780719f},
-std::array<float,2>{0.548090637f, 0.0752038881f},
-std::array<float,2>{0.828647196f, 0.992139518f},
-std::array<float,2>{0.281875908f, 0.137054846f},
-std::array<float,2>{0.13345699f, 0.550494492f},
-std::array<float,2>{0.591859937f, 0.453312039f},
-std::array<float,2>{0.710476756f, 0.691757619f},
-std::array<float,2>{0.0731709376f, 0.294594169f},
-std::array<float,2>{0.438480914f, 0.761904776f},
-std::array<float,2>{0.912159264f, 0.0495972931f},
-std::array<float,2>{0.502599359f, 0.836920142f},
-std::array<float,2>{0.246224269f, 0.100449838f},
-std::array<float,2>{0.327730626f, 0.631657541f},
-std::array<float,2>{0.772861362f, 0.34960866f},
-std::array<float,2>{0.990048349f, 0.569354236f},
-std::array<float,2>{0.401055992f, 0.41861999f},
-std::array<float,2>{0.0469072871f, 0.887987375f},
-std::array<float,2>{0.661141634f, 0.224868551f},
-std::array<float,2>{0.877073348f, 0.926665246f},
-std::array<float,2>{0.481033236f, 0.202381909f},
-std::array<float,2>{0.109343052f, 0.620824754f},
-std::array<float,2>{0.722639203f, 0.397540301f},
-std::array<float,2>{0.605661988f, 0.658521473f},
-std::array<float,2>{0.171480224f, 0.335388333f},
-std::array<float,2>{0.280836821f, 0.866458654f},
-std::array<float,2>{0.864203453f, 0.0663525611f},
-std::array<float,2>{0.639380515f, 0.803926528f},
-std::array<float,2>{0.0149665074f, 0.0196435042f},
-std::array<float,2>{0.423777878f, 0.720059812f},
-std::array<float,2>{0.939198792f, 0.262064517f},
-std::array<float,2>{0.782271683f, 0.524961531f},
-std::array<float,2>{0.356106997f, 0.479775906f},
-std::array<float,2>{0.206969157f, 0.962836087f},
-std::array<float,2>{0.542740762f, 0.160212263f},
-std::array<float,2>{0.822289109f, 0.830550909f},
-std::array<float,2>{0.30302766f, 0.104692191f},
-std::array<float,2>{0.142231271f, 0.636593819f},
-std::array<float,2>{0.57369405f, 0.355299324f},
-std::array<float,2>{0.688033938f, 0.571132243f},
-std::array<float,2>{0.0821651593f, 0.410579175f},
-std::array<float,2>{0.459365815f, 0.880702674f},
-std::array<float,2>{0.929589033f, 0.234043166f},
-std::array<float,2>{0.530318379f, 0.992548645f},
-std::array<float,2>{0.231531322f, 0.126874521f},
-std::array<float,2>{0.332218587f, 0.559746504f},
-std::array<float,2>{0.758403778f, 0.468491495f},
-std::array<float,2>{0.971702635f, 0.701314926f},
-std::array<float,2>{0.379736245f, 0.286769032f},
-std::array<float,2>{0.0415211394f, 0.752872407f},
-std::array<float,2>{0.684183776f, 0.0564849153f},
-std::array<float,2>{0.967325032f, 0.768548965f},
-std::array<float,2>{0.413486838f, 0.03185625f},
-std::array<float,2>{0.0259169638f, 0.712521672f},
-std::array<float,2>{0.651285768f, 0.311181992f},
-std::array<float,2>{0.552631259f, 0.532445908f},
-std::array<float,2>{0.189861774f, 0.439037323f},
-std::array<float,2>{0.370247185f, 0.97293818f},
-std::array<float,2>{0.802846968f, 0.141682386f},
-std::array<float,2>{0.740759313f, 0.904361129f},
-std::array<float,2>{0.113640375f, 0.24981685f},
-std::array<float,2>{0.49674654f, 0.579086363f},
-std::array<float,2>{0.902810097f, 0.429762125f},
-std::array<float,2>{0.848343194f, 0.64357847f},
-std::array<float,2>{0.262466133f, 0.372239858f},
-std::array<float,2>{0.179898158f, 0.82746613f},
-std::array<float,2>{0.621033788f, 0.114035092f},
-std::array<float,2>{0.766803861f, 0.942555666f},
-std::array<float,2>{0.320778936f, 0.177201882f},
-std::array<float,2>{0.243934721f, 0.509073973f},
-std::array<float,2>{0.507137716f, 0.491724163f},
-std::array<float,2>{0.658673167f, 0.746603787f},
-std::array<float,2>{0.0532336272f, 0.266546458f},
-std::array<float,2>{0.403511941f, 0.786829412f},
-std::array<float,2>{0.987446606f, 0.00386102498f},
-std::array<float,2>{0.586197913f, 0.857708395f},
-std::array<float,2>{0.137133718f, 0.0839133933f},
-std::array<float,2>{0.285555243f, 0.674643159f},
-std::array<float,2>{0.834829986f, 0.314678371f},
-std::array<float,2>{0.909226954f, 0.604869127f},
-std::array<float,2>{0.445186526f, 0.386036128f},
-std::array<float,2>{0.0767542198f, 0.917652011f},
-std::array<float,2>{0.704060853f, 0.203983113f},
-std::array<float,2>{0.992664337f, 0.984352529f},
-std::array<float,2>{0.397087008f, 0.154805124f},
-std::array<float,2>{0.0566597842f, 0.542445302f},
-std::array<float,2>{0.668151438f, 0.445918173f},
-std::array<float,2>{0.510967672f, 0.709820807f},
-std::array<float,2>{0.234859869f, 0.297255486f},
-std::array<float,2>{0.314227849f, 0.775153577f},
-std::array<float,2>{0.775456011f, 0.0410868526f},
-std::array<float,2>{0.71624893f, 0.81993258f},
-std::array<float,2>{0.0679748505f, 0.124499582f},
-std::array<float,2>{0.452053338f, 0.649905264f},
-std::array<float,2>{0.919821262f, 0.366303504f},
-std::array<float,2>{0.838869095f, 0.587886035f},
-std::array<float,2>{0.294905871f, 0.427422196f},
-std::array<float,2>{0.13014248f, 0.896219254f},
-std::array<float,2>{0.579625726f, 0.236167774f},
-std::array<float,2>{0.808189809f, 0.791472673f},
-std::array<float,2>{0.363140911f, 0.0147003187f},
-std::array<float,2>{0.196382567f, 0.735040724f},
-std::array<float,2>{0.559878886f, 0.275795102f},
-std::array<float,2>{0.644626558f, 0.502800286f},
-std::array<float,2>{0.0157073438f, 0.494383037f},
-std::array<float,2>{0.419519603f, 0.946889162f},
-std::array<float,2>{0.957119286f, 0.181622088f},
-std::array<float,2>{0.615220726f, 0.906578302f},
-std::array<float,2>{0.173848093f, 0.214845821f},
-std::array<float,2>{0.250568748f, 0.599936783f},
-std::array<float,2>{0.854920506f, 0.376884133f},
-std::array<float,2>{0.89727819f, 0.681607842f},
-std::array<float,2>{0.488895714f, 0.322962046f},
-std::array<float,2>{0.123416133f, 0.846718848f},
-std::array<float,2>{0.748154163f, 0.0868180767f},
-std::array<float,2>{0.933426738f, 0.872231424f},
-std::array<float,2>{0.465358257f, 0.0727968141f},
-std::array<float,2>{0.0863293707f, 0.669918954f},
-std::array<float,2>{0.695468009f, 0.336596727f},
-std::array<float,2>{0.56540966f, 0.612260997f},
-std::array<float,2>{0.15033038f, 0.406199336f},
-std::array<float,2>{0.309789449f, 0.932835519f},
-std::array<float,2>{0.817371964f, 0.194486961f},
-std::array<float,2>{0.672518134f, 0.953882635f},
-std::array<float,2>{0.0336326733f, 0.16470781f},
-std::array<float,2>{0.383850902f, 0.515678108f},
-std::array<float,2>{0.983261228f, 0.473351806f},
-std::array<float,2>{0.756238997f, 0.734217823f},
-std::array<float,2>{0.337775648f, 0.25221473f},
-std::array<float,2>{0.221154898f, 0.808732152f},
-std::array<float,2>{0.521020114f, 0.0254016239f},
-std::array<float,2>{0.872956395f, 0.884980321f},
-std::array<float,2>{0.267428517f, 0.221201032f},
-std::array<float,2>{0.156839132f, 0.563872099f},
-std::array<float,2>{0.601451337f, 0.4157525f},
-std::array<float,2>{0.728883386f, 0.62593317f},
-std::array<float,2>{0.0969804153f, 0.344907194f},
-std::array<float,2>{0.469033837f, 0.84097296f},
-std::array<float,2>{0.883508861f, 0.097617954f},
-std::array<float,2>{0.534560323f, 0.759628594f},
-std::array<float,2>{0.217416272f, 0.0543959998f},
-std::array<float,2>{0.344002336f, 0.687676847f},
-std::array<float,2>{0.796416521f, 0.290894389f},
-std::array<float,2>{0.952295125f, 0.551825047f},
-std::array<float,2>{0.435817569f, 0.457279176f},
-std::array<float,2>{0.00657633599f, 0.987612903f},
-std::array<float,2>{0.630746365f, 0.13433744f},
-std::array<float,2>{0.890839338f, 0.996504784f},
-std::array<float,2>{0.48620066f, 0.132575631f},
-std::array<float,2>{0.118139811f, 0.556511998f},
-std::array<float,2>{0.745588362f, 0.461794347f},
-std::array<float,2>{0.612768352f, 0.697970271f},
-std::array<float,2>{0.176217288f, 0.284676969f},
-std::array<float,2>{0.255736649f, 0.75390929f},
-std::array<float,2>{0.856674492f, 0.0622972324f},
-std::array<float,2>{0.640640736f, 0.83228761f},
-std::array<float,2>{0.0208910313f, 0.107071891f},
-std::array<float,2>{0.41519478f, 0.638552666f},
-std::array<float,2>{0.953172088f, 0.356471002f},
-std::array<float,2>{0.81063199f, 0.574284375f},
-std::array<float,2>{0.364970446f, 0.409409672f},
-std::array<float,2>{0.201040059f, 0.875056148f},
-std::array<float,2>{0.556966305f, 0.228991687f},
-std::array<float,2>{0.839961052f, 0.798623562f},
-std::array<float,2>{0.292194992f, 0.0182869863f},
-std::array<float,2>{0.128299832f, 0.725905657f},
-std::array<float,2>{0.58404386f, 0.261631489f},
-std::array<float,2>{0.712871671f, 0.529489338f},
-std::array<float,2>{0.0642120838f, 0.483554304f},
-std::array<float,2>{0.447639078f, 0.965710282f},
-std::array<float,2>{0.91478014f, 0.158322155f},
-std::array<float,2>{0.513981104f, 0.925728679f},
-std::array<float,2>{0.238935471f, 0.19579497f},
-std::array<float,2>{0.319270462f, 0.623009264f},
-std::array<float,2>{0.781210184f, 0.393276274f},
-std::array<float,2>{0.998305321f, 0.661760211f},
-std::array<float,2>{0.391728342f, 0.330168426f},
-std::array<float,2>{0.0590497516f, 0.859923542f},
-std::array<float,2>{0.667746067f, 0.0695594549f},
-std::array<float,2>{0.945765078f, 0.853414476f},
-std::array<float,2>{0.432400137f, 0.0810252875f},
-std::array<float,2>{0.00255795848f, 0.676437378f},
-std::array<float,2>{0.628672481f, 0.3167077f},
-std::array<float,2>{0.538471878f, 0.606653035f},
-std::array<float,2>{0.213174239f, 0.388798177f},
-std::array<float,2>{0.351361513f, 0.919071138f},
-std::array<float,2>{0.791098475f, 0.210153043f},
-std::array<float,2>{0.730959356f, 0.940647185f},
-std::array<float,2>{0.0985350683f, 0.172014102f},
-std::array<float,2>{0.473920643f, 0.512580872f},
-std::array<float,2>{0.887706935f, 0.485626787f},
-std::array<float,2>{0.867708921f, 0.742344141f},
-std::array<float,2>{0.273326278f, 0.271021932f},
-std::array<float,2>{0.160522029f, 0.784258425f},
-std::array<float,2>{0.595481336f, 0.00413086265f},
-std::array<float,2>{0.751149118f, 0.901872098f},
-std::array<float,2>{0.341871172f, 0.24587974f},
-std::array<float,2>{0.222903192f, 0.582627833f},
-std::array<float,2>{0.516254604f, 0.434102654f},
-std::array<float,2>{0.676048338f, 0.644776165f},
-std::array<float,2>{0.0368141569f, 0.370624214f},
-std::array<float,2>{0.388186902f, 0.82055372f},
-std::array<float,2>{0.980100274f, 0.112628311f},
-std::array<float,2>{0.568405747f, 0.771324396f},
-std::array<float,2>{0.154874459f, 0.0368136875f},
-std::array<float,2>{0.307801962f, 0.715017736f},
-std::array<float,2>{0.813908398f, 0.3073982f},
-std::array<float,2>{0.934069633f, 0.535749972f},
-std::array<float,2>{0.462973088f, 0.444966435f},
-std::array<float,2>{0.0915447101f, 0.970365822f},
-std::array<float,2>{0.700639725f, 0.147362247f},
-std::array<float,2>{0.974037945f, 0.913224995f},
-std::array<float,2>{0.378041655f, 0.214086056f},
-std::array<float,2>{0.0448723212f, 0.59747076f},
-std::array<float,2>{0.682629466f, 0.382569462f},
-std::array<float,2>{0.523705363f, 0.685680032f},
-std::array<float,2>{0.230157688f, 0.327718794f},
-std::array<float,2>{0.32896781f, 0.847872138f},
-std::array<float,2>{0.765568495f, 0.0911877453f},
-std::array<float,2>{0.695255101f, 0.794574201f},
-std::array<float,2>{0.0797558278f, 0.0113258101f},
-std::array<float,2>{0.454064578f, 0.74015069f},
-std::array<float,2>{0.922817349f, 0.278066278f},
-std::array<float,2>{0.828078985f, 0.505079031f},
-std::array<float,2>{0.298135787f, 0.499540389f},
-std::array<float,2>{0.145993456f, 0.952812493f},
-std::array<float,2>{0.576548219f, 0.183930859f},
-std::array<float,2>{0.786992073f, 0.81434375f},
-std::array<float,2>{0.354524583f, 0.119455747f},
-std::array<float,2>{0.210434198f, 0.652631283f},
-std::array<float,2>{0.544238865f, 0.361968875f},
-std::array<float,2>{0.633642673f, 0.592526376f},
-std::array<float,2>{0.0106350826f, 0.424188763f},
-std::array<float,2>{0.428531885f, 0.893191814f},
-std::array<float,2>{0.941456318f, 0.241376981f},
-std::array<float,2>{0.603469968f, 0.978882611f},
-std::array<float,2>{0.164356634f, 0.148645625f},
-std::array<float,2>{0.274137497f, 0.545329869f},
-std::array<float,2>{0.862073064f, 0.449542284f},
-std::array<float,2>{0.879051983f, 0.705291212f},
-std::array<float,2>{0.476736814f, 0.304441392f},
-std::array<float,2>{0.102147996f, 0.77914536f},
-std::array<float,2>{0.722899139f, 0.0446345583f},
-std::array<float,2>{0.911359727f, 0.76531136f},
-std::array<float,2>{0.441152155f, 0.0476717837f},
-std::array<float,2>{0.071902521f, 0.695069313f},
-std::array<float,2>{0.707878828f, 0.296691179f},
-std::array<float,2>{0.591677368f, 0.54831934f},
-std::array<float,2>{0.134916499f, 0.456121176f},
-std::array<float,2>{0.284991175f, 0.989829123f},
-std::array<float,2>{0.831275105f, 0.139709756f},
-std::array<float,2>{0.662589788f, 0.889489412f},
-std::array<float,2>{0.050126262f, 0.223408058f},
-std::array<float,2>{0.399235874f, 0.566499829f},
-std::array<float,2>{0.990466654f, 0.41992709f},
-std::array<float,2>{0.770418644f, 0.630483389f},
-std::array<float,2>{0.325082988f, 0.351007193f},
-std::array<float,2>{0.249202892f, 0.83900243f},
-std::array<float,2>{0.501517057f, 0.0993051752f},
-std::array<float,2>{0.847620249f, 0.959161639f},
-std::array<float,2>{0.260431051f, 0.169427365f},
-std::array<float,2>{0.186672732f, 0.521959186f},
-std::array<float,2>{0.621358275f, 0.470130473f},
-std::array<float,2>{0.735315382f, 0.729365408f},
-std::array<float,2>{0.11095468f, 0.254733652f},
-std::array<float,2>{0.492796898f, 0.806369841f},
-std::array<float,2>{0.900676012f, 0.0300930608f},
-std::array<float,2>{0.549780786f, 0.867841125f},
-std::array<float,2>{0.194748506f, 0.0772269294f},
-std::array<float,2>{0.373143315f, 0.66559279f},
-std::array<float,2>{0.799108505f, 0.342909873f},
-std::array<float,2>{0.962744117f, 0.616299868f},
-std::array<float,2>{0.407693654f, 0.398587793f},
-std::array<float,2>{0.0285025612f, 0.934148312f},
-std::array<float,2>{0.652871966f, 0.189710915f},
-std::array<float,2>{0.927153647f, 0.882327199f},
-std::array<float,2>{0.457716852f, 0.231241465f},
-std::array<float,2>{0.0854277909f, 0.572383046f},
-std::array<float,2>{0.689672232f, 0.412869722f},
-std::array<float,2>{0.571617246f, 0.63451755f},
-std::array<float,2>{0.14355281f, 0.352916837f},
-std::array<float,2>{0.300904006f, 0.829523802f},
-std::array<float,2>{0.820401073f, 0.10225749f},
-std::array<float,2>{0.686611354f, 0.751559019f},
-std::array<float,2>{0.0405038074f, 0.0577859581f},
-std::array<float,2>{0.381866813f, 0.699683487f},
-std::array<float,2>{0.97064054f, 0.288490862f},
-std::array<float,2>{0.760139287f, 0.561366737f},
-std::array<float,2>{0.335376263f, 0.466567665f},
-std::array<float,2>{0.232579768f, 0.99438411f},
-std::array<float,2>{0.529111624f, 0.127392963f},
-std::array<float,2>{0.865671217f, 0.865209818f},
-std::array<float,2>{0.278359085f, 0.0628046766f},
-std::array<float,2>{0.169672534f, 0.657978535f},
-std::array<float,2>{0.609205782f, 0.333930463f},
-std::array<float,2>{0.720441937f, 0.617644072f},
-std::array<float,2>{0.105789922f, 0.395366251f},
-std::array<float,2>{0.483418494f, 0.92940098f},
-std::array<float,2>{0.8763659f, 0.199221373f},
-std::array<float,2>{0.539871037f, 0.964239657f},
-std::array<float,2>{0.204949021f, 0.163980857f},
-std::array<float,2>{0.358403474f, 0.526436627f},
-std::array<float,2>{0.784521818f, 0.477271557f},
-std::array<float,2>{0.94086653f, 0.722455263f},
-std::array<float,2>{0.424233347f, 0.265086472f},
-std::array<float,2>{0.0124751879f, 0.801772296f},
-std::array<float,2>{0.637371838f, 0.0220998842f},
-std::array<float,2>{0.986094177f, 0.788784385f},
-std::array<float,2>{0.405459255f, 0.00107045856f},
-std::array<float,2>{0.0519081056f, 0.749652028f},
-std::array<float,2>{0.656697512f, 0.269278884f},
-std::array<float,2>{0.504431903f, 0.511625409f},
-std::array<float,2>{0.244760126f, 0.490016133f},
-std::array<float,2>{0.323031783f, 0.945121944f},
-std::array<float,2>{0.768453836f, 0.178929985f},
-std::array<float,2>{0.706242681f, 0.915174901f},
-std::array<float,2>{0.0747746527f, 0.206660956f},
-std::array<float,2>{0.442593753f, 0.601826489f},
-std::array<float,2>{0.907796144f, 0.384507716f},
-std::array<float,2>{0.832465231f, 0.673453927f},
-std::array<float,2>{0.288755327f, 0.312726974f},
-std::array<float,2>{0.140471399f, 0.85670805f},
-std::array<float,2>{0.589098394f, 0.0857578367f},
-std::array<float,2>{0.802449107f, 0.976529002f},
-std::array<float,2>{0.368299514f, 0.144519165f},
-std::array<float,2>{0.187749594f, 0.534523308f},
-std::array<float,2>{0.55345428f, 0.439629436f},
-std::array<float,2>{0.649550974f, 0.713902295f},
-std::array<float,2>{0.023943264f, 0.310283124f},
-std::array<float,2>{0.411495954f, 0.765900552f},
-std::array<float,2>{0.966515005f, 0.0341717005f},
-std::array<float,2>{0.618439019f, 0.825228512f},
-std::array<float,2>{0.181892172f, 0.117066689f},
-std::array<float,2>{0.264681607f, 0.641116083f},
-std::array<float,2>{0.851023316f, 0.374115527f},
-std::array<float,2>{0.906159639f, 0.580780864f},
-std::array<float,2>{0.498181254f, 0.431780785f},
-std::array<float,2>{0.115574844f, 0.903644025f},
-std::array<float,2>{0.738668501f, 0.246535569f},
-std::array<float,2>{0.960592091f, 0.947348356f},
-std::array<float,2>{0.42052272f, 0.182051748f},
-std::array<float,2>{0.0187055059f, 0.500869989f},
-std::array<float,2>{0.647108614f, 0.492366254f},
-std::array<float,2>{0.560657859f, 0.736475408f},
-std::array<float,2>{0.198724464f, 0.275159091f},
-std::array<float,2>{0.359865606f, 0.790543675f},
-std::array<float,2>{0.8056826f, 0.0135777695f},
-std::array<float,2>{0.746893525f, 0.844163418f},
-std::array<float,2>{0.121959731f, 0.0888551399f},
-std::array<float,2>{0.491487235f, 0.682545245f},
-std::array<float,2>{0.895103335f, 0.321427107f},
-std::array<float,2>{0.851755679f, 0.598424315f},
-std::array<float,2>{0.253532827f, 0.378024459f},
-std::array<float,2>{0.173508167f, 0.909916401f},
-std::array<float,2>{0.616006911f, 0.217815816f},
-std::array<float,2>{0.775315166f, 0.776687622f},
-std::array<float,2>{0.314914227f, 0.040551722f},
-std::array<float,2>{0.236962706f, 0.707351029f},
-std::array<float,2>{0.509228408f, 0.299728245f},
-std::array<float,2>{0.670441926f, 0.539230049f},
-std::array<float,2>{0.0564232059f, 0.448607683f},
-std::array<float,2>{0.3960751f, 0.980588555f},
-std::array<float,2>{0.995128691f, 0.153174907f},
-std::array<float,2>{0.580776453f, 0.896943033f},
-std::array<float,2>{0.13213183f, 0.236993894f},
-std::array<float,2>{0.295331717f, 0.588566601f},
-std::array<float,2>{0.8378039f, 0.428653091f},
-std::array<float,2>{0.921778262f, 0.652237773f},
-std::array<float,2>{0.449727714f, 0.364127338f},
-std::array<float,2>{0.0687431693f, 0.817561388f},
-std::array<float,2>{0.717741489f, 0.122481965f},
-std::array<float,2>{0.886716783f, 0.843160868f},
-std::array<float,2>{0.470840216f, 0.0942578614f},
-std::array<float,2>{0.0955731124f, 0.627152681f},
-std::array<float,2>{0.726825655f, 0.347152084f},
-std::array<float,2>{0.597668707f, 0.566090822f},
-std::array<float,2>{0.159046903f, 0.416791648f},
-std::array<float,2>{0.267647088f, 0.883537769f},
-std::array<float,2>{0.873807847f, 0.220653012f},
-std::array<float,2>{0.63180548f, 0.985196292f},
-std::array<float,2>{0.00580053357f, 0.136582524f},
-std::array<float,2>{0.434840322f, 0.554281592f},
-std::array<float,2>{0.951126933f, 0.460306615f},
-std::array<float,2>{0.793654561f, 0.689792037f},
-std::array<float,2>{0.346147776f, 0.291587859f},
-std::array<float,2>{0.214845598f, 0.760668218f},
-std::array<float,2>{0.53312254f, 0.0525972843f},
-std::array<float,2>{0.818748891f, 0.930898786f},
-std::array<float,2>{0.311425447f, 0.192603409f},
-std::array<float,2>{0.152049243f, 0.609574139f},
-std::array<float,2>{0.56347394f, 0.403202683f},
-std::array<float,2>{0.698422551f, 0.671101332f},
-std::array<float,2>{0.0895385817f, 0.338572234f},
-std::array<float,2>{0.466932327f, 0.874970496f},
-std::array<float,2>{0.930755794f, 0.0715562254f},
-std::array<float,2>{0.522811055f, 0.810829282f},
-std::array<float,2>{0.219081908f, 0.024603568f},
-std::array<float,2>{0.33868894f, 0.731471598f},
-std::array<float,2>{0.754604578f, 0.251257151f},
-std::array<float,2>{0.98236686f, 0.517762721f},
-std::array<float,2>{0.386164248f, 0.474744946f},
-std::array<float,2>{0.0327883288f, 0.956296325f},
-std::array<float,2>{0.674730182f, 0.167452991f},
-std::array<float,2>{0.936556518f, 0.969724298f},
-std::array<float,2>{0.462798148f, 0.148167223f},
-std::array<float,2>{0.0927085504f, 0.536974847f},
-std::array<float,2>{0.701508224f, 0.443605155f},
-std::array<float,2>{0.567412078f, 0.716157615f},
-std::array<float,2>{0.15401198f, 0.307780236f},
-std::array<float,2>{0.305891573f, 0.769572556f},
-std::array<float,2>{0.814812243f, 0.0352601111f},
-std::array<float,2>{0.677995622f, 0.821985126f},
-std::array<float,2>{0.0379756093f, 0.111847088f},
-std::array<float,2>{0.390433937f, 0.646245837f},
-std::array<float,2>{0.977688372f, 0.369722009f},
-std::array<float,2>{0.752523124f, 0.583691359f},
-std::array<float,2>{0.341063142f, 0.435273021f},
-std::array<float,2>{0.225815043f, 0.901158452f},
-std::array<float,2>{0.519360781f, 0.244540498f},
-std::array<float,2>{0.870643198f, 0.78370893f},
-std::array<float,2>{0.269750357f, 0.00540774455f},
-std::array<float,2>{0.163985178f, 0.743595064f},
-std::array<float,2>{0.596752048f, 0.270392746f},
-std::array<float,2>{0.733855784f, 0.513490796f},
-std::array<float,2>{0.101072885f, 0.485207647f},
-std::array<float,2>{0.475751311f, 0.939879596f},
-std::array<float,2>{0.890583158f, 0.173485756f},
-std::array<float,2>{0.536636651f, 0.9186759f},
-std::array<float,2>{0.212508351f, 0.209682018f},
-std::array<float,2>{0.348392189f, 0.605660796f},
-std::array<float,2>{0.789979517f, 0.390291303f},
-std::array<float,2>{0.948407829f, 0.677230477f},
-std::array<float,2>{0.431559831f, 0.318277866f},
-std::array<float,2>{0.00128440908f, 0.851985097f},
-std::array<float,2>{0.625591874f, 0.0818420276f},
-std::array<float,2>{0.997178435f, 0.860846877f},
-std::array<float,2>{0.393430084f, 0.0689518675f},
-std::array<float,2>{0.0621432662f, 0.660714686f},
-std::array<float,2>{0.665330529f, 0.331624031f},
-std::array<float,2>{0.513300836f, 0.621772528f},
-std::array<float,2>{0.240793169f, 0.394310236f},
-std::array<float,2>{0.31668961f, 0.924107909f},
-std::array<float,2>{0.778623939f, 0.197264925f},
-std::array<float,2>{0.712972164f, 0.966142535f},
-std::array<float,2>{0.0648253709f, 0.159972414f},
-std::array<float,2>{0.446022004f, 0.530669749f},
-std::array<float,2>{0.91635102f, 0.482532561f},
-std::array<float,2>{0.843453944f, 0.725154936f},
-std::array<float,2>{0.290824443f, 0.259978324f},
-std::array<float,2>{0.125138223f, 0.79775548f},
-std::array<float,2>{0.582313538f, 0.0192849003f},
-std::array<float,2>{0.810124576f, 0.876414895f},
-std::array<float,2>{0.365562379f, 0.229636505f},
-std::array<float,2>{0.202096894f, 0.576100767f},
-std::array<float,2>{0.555297673f, 0.409006119f},
-std::array<float,2>{0.644201875f, 0.637577415f},
-std::array<float,2>{0.0222379975f, 0.356401801f},
-std::array<float,2>{0.417636126f, 0.833890855f},
-std::array<float,2>{0.956361234f, 0.10582836f},
-std::array<float,2>{0.610896707f, 0.755735993f},
-std::array<float,2>{0.178736806f, 0.0611876175f},
-std::array<float,2>{0.257769018f, 0.69838196f},
-std::array<float,2>{0.859232843f, 0.283383816f},
-std::array<float,2>{0.894086957f, 0.555168808f},
-std::array<float,2>{0.487746805f, 0.462715596f},
-std::array<float,2>{0.120523766f, 0.997073472f},
-std::array<float,2>{0.74301821f, 0.131655604f},
-std::array<float,2>{0.963516295f, 0.934926093f},
-std::array<float,2>{0.409501344f, 0.191072613f},
-std::array<float,2>{0.0293451846f, 0.615384936f},
-std::array<float,2>{0.655751169f, 0.400326073f},
-std::array<float,2>{0.547379315f, 0.664375186f},
-std::array<float,2>{0.192167699f, 0.342612237f},
-std::array<float,2>{0.372830302f, 0.868273079f},
-std::array<float,2>{0.798013985f, 0.0762573928f},
-std::array<float,2>{0.736848652f, 0.805116415f},
-std::array<float,2>{0.113034531f, 0.0309505463f},
-std::array<float,2>{0.495437562f, 0.730186641f},
-std::array<float,2>{0.899890423f, 0.255424082f},
-std::array<float,2>{0.843947113f, 0.522681057f},
-std::array<float,2>{0.258772045f, 0.469410866f},
-std::array<float,2>{0.185249805f, 0.960367799f},
-std::array<float,2>{0.624322653f, 0.168497384f},
-std::array<float,2>{0.771498144f, 0.838604093f},
-std::array<float,2>{0.326376021f, 0.0984434262f},
-std::array<float,2>{0.247145683f, 0.629697502f},
-std::array<float,2>{0.503869057f, 0.350458533f},
-std::array<float,2>{0.660553277f, 0.567848921f},
-std::array<float,2>{0.0479590856f, 0.42129308f},
-std::array<float,2>{0.40185532f, 0.890142262f},
-std::array<float,2>{0.988417208f, 0.223959804f},
-std::array<float,2>{0.593140602f, 0.988896132f},
-std::array<float,2>{0.134261385f, 0.139419034f},
-std::array<float,2>{0.28270781f, 0.547137856f},
-std::array<float,2>{0.829382241f, 0.455815166f},
-std::array<float,2>{0.913348794f, 0.694016576f},
-std::array<float,2>{0.438025713f, 0.295169473f},
-std::array<float,2>{0.0738655627f, 0.76433593f},
-std::array<float,2>{0.709338486f, 0.0484830402f},
-std::array<float,2>{0.881154478f, 0.778253853f},
-std::array<float,2>{0.478960335f, 0.0434851237f},
-std::array<float,2>{0.103971712f, 0.706259727f},
-std::array<float,2>{0.725156784f, 0.302858084f},
-std::array<float,2>{0.604326725f, 0.546013236f},
-std::array<float,2>{0.166464731f, 0.450536698f},
-std::array<float,2>{0.276036561f, 0.980213404f},
-std::array<float,2>{0.860280693f, 0.149959639f},
-std::array<float,2>{0.635532498f, 0.89392072f},
-std::array<float,2>{0.00807386078f, 0.240467131f},
-std::array<float,2>{0.427669406f, 0.592934966f},
-std::array<float,2>{0.944713116f, 0.425696164f},
-std::array<float,2>{0.788378894f, 0.65365988f},
-std::array<float,2>{0.353003711f, 0.362837613f},
-std::array<float,2>{0.207190007f, 0.812679529f},
-std::array<float,2>{0.546388268f, 0.121031106f},
-std::array<float,2>{0.825195432f, 0.951864123f},
-std::array<float,2>{0.298851848f, 0.184631854f},
-std::array<float,2>{0.147563487f, 0.504070044f},
-std::array<float,2>{0.574264765f, 0.498447597f},
-std::array<float,2>{0.692819595f, 0.738430023f},
-std::array<float,2>{0.0809073746f, 0.278501689f},
-std::array<float,2>{0.456097633f, 0.793919384f},
-std::array<float,2>{0.923846364f, 0.0104546789f},
-std::array<float,2>{0.525886774f, 0.849126101f},
-std::array<float,2>{0.227811053f, 0.0901094899f},
-std::array<float,2>{0.331437081f, 0.68658942f},
-std::array<float,2>{0.763256848f, 0.327071011f},
-std::array<float,2>{0.974934816f, 0.596597731f},
-std::array<float,2>{0.375094026f, 0.381700188f},
-std::array<float,2>{0.0451126546f, 0.912604153f},
-std::array<float,2>{0.681434929f, 0.213576719f},
-std::array<float,2>{0.904107749f, 0.902967691f},
-std::array<float,2>{0.497200519f, 0.247824922f},
-std::array<float,2>{0.11438103f, 0.581175745f},
-std::array<float,2>{0.74192065f, 0.433267325f},
-std::array<float,2>{0.619504035f, 0.642212272f},
-std::array<float,2>{0.18121472f, 0.373413682f},
-std::array<float,2>{0.263265997f, 0.825061738f},
-std::array<float,2>{0.849516928f, 0.115502596f},
-std::array<float,2>{0.651935697f, 0.766667247f},
-std::array<float,2>{0.0268467292f, 0.0348847732f},
-std::array<float,2>{0.412206262f, 0.712915123f},
-std::array<float,2>{0.9687199f, 0.308730274f},
-std::array<float,2>{0.80433619f, 0.534177065f},
-std::array<float,2>{0.369334072f, 0.440665305f},
-std::array<float,2>{0.191350847f, 0.975197434f},
-std::array<float,2>{0.550863206f, 0.14317143f},
-std::array<float,2>{0.83557862f, 0.856003046f},
-std::array<float,2>{0.286251009f, 0.0842395276f},
-std::array<float,2>{0.138383999f, 0.672733009f},
-std::array<float,2>{0.587604105f, 0.314201921f},
-std::array<float,2>{0.705072701f, 0.603236139f},
-std::array<float,2>{0.0779540613f, 0.383156508f},
-std::array<float,2>{0.443399489f, 0.914245009f},
-std::array<float,2>{0.908220947f, 0.205306098f},
-std::array<float,2>{0.506305397f, 0.94428122f},
-std::array<float,2>{0.242244557f, 0.178119302f},
-std::array<float,2>{0.32134074f, 0.510207415f},
-std::array<float,2>{0.76620847f, 0.488783121f},
-std::array<float,2>{0.986927152f, 0.748525441f},
-std::array<float,2>{0.403173715f, 0.267920166f},
-std::array<float,2>{0.0541885979f, 0.787829161f},
-std::array<float,2>{0.659805477f, 0.000128147323f},
-std::array<float,2>{0.937969387f, 0.800839007f},
-std::array<float,2>{0.422629952f, 0.0234357454f},
-std::array<float,2>{0.0137621304f, 0.721030712f},
-std::array<float,2>{0.640069127f, 0.263775378f},
-std::array<float,2>{0.541719675f, 0.526168168f},
-std::array<float,2>{0.205955073f, 0.478188336f},
-std::array<float,2>{0.356597245f, 0.963502944f},
-std::array<float,2>{0.781653047f, 0.162331179f},
-std::array<float,2>{0.721442282f, 0.928248048f},
-std::array<float,2>{0.107835107f, 0.200936139f},
-std::array<float,2>{0.481610686f, 0.618889689f},
-std::array<float,2>{0.87805897f, 0.396164119f},
-std::array<float,2>{0.864720404f, 0.656552792f},
-std::array<float,2>{0.279962063f, 0.332232833f},
-std::array<float,2>{0.170313045f, 0.864175856f},
-std::array<float,2>{0.607232153f, 0.0639382675f},
-std::array<float,2>{0.759173155f, 0.995430112f},
-std::array<float,2>{0.333489418f, 0.128142104f},
-std::array<float,2>{0.231076077f, 0.561617076f},
-std::array<float,2>{0.530241251f, 0.46552515f},
-std::array<float,2>{0.684787452f, 0.700479031f},
-std::array<float,2>{0.042536024f, 0.287151784f},
-std::array<float,2>{0.380487472f, 0.750753224f},
-std::array<float,2>{0.971540868f, 0.0571360402f},
-std::array<float,2>{0.572581887f, 0.82824105f},
-std::array<float,2>{0.140804395f, 0.102947585f},
-std::array<float,2>{0.304082096f, 0.633389413f},
-std::array<float,2>{0.824161112f, 0.351606369f},
-std::array<float,2>{0.928366125f, 0.573563933f},
-std::array<float,2>{0.460353047f, 0.413290411f},
-std::array<float,2>{0.0836006999f, 0.881230116f},
-std::array<float,2>{0.688534915f, 0.231469139f},
-std::array<float,2>{0.984104872f, 0.955725491f},
-std::array<float,2>{0.382898211f, 0.166926682f},
-std::array<float,2>{0.0348845199f, 0.519246161f},
-std::array<float,2>{0.673130095f, 0.47570911f},
-std::array<float,2>{0.519981623f, 0.731324792f},
-std::array<float,2>{0.222386479f, 0.250684381f},
-std::array<float,2>{0.336439252f, 0.812110484f},
-std::array<float,2>{0.757697105f, 0.0243871994f},
-std::array<float,2>{0.696354926f, 0.873594224f},
-std::array<float,2>{0.0875575915f, 0.0705718845f},
-std::array<float,2>{0.466260821f, 0.670762241f},
-std::array<float,2>{0.932360947f, 0.339390546f},
-std::array<float,2>{0.817509472f, 0.610758126f},
-std::array<float,2>{0.309005082f, 0.403374642f},
-std::array<float,2>{0.148818851f, 0.930073678f},
-std::array<float,2>{0.565599799f, 0.191441715f},
-std::array<float,2>{0.795385778f, 0.76091361f},
-std::array<float,2>{0.344897181f, 0.0513117947f},
-std::array<float,2>{0.218728527f, 0.690864801f},
-std::array<float,2>{0.533905804f, 0.29220438f},
-std::array<float,2>{0.629558206f, 0.553519547f},
-std::array<float,2>{0.00687005743f, 0.459373832f},
-std::array<float,2>{0.436951607f, 0.985758424f},
-std::array<float,2>{0.95211643f, 0.134954005f},
-std::array<float,2>{0.599610627f, 0.884046197f},
-std::array<float,2>{0.157942384f, 0.219715223f},
-std::array<float,2>{0.266452521f, 0.564557374f},
-std::array<float,2>{0.871854067f, 0.417663425f},
-std::array<float,2>{0.884411514f, 0.628176928f},
-std::array<float,2>{0.470078766f, 0.346477479f},
-std::array<float,2>{0.0963932574f, 0.842642188f},
-std::array<float,2>{0.730360389f, 0.0954271778f},
-std::array<float,2>{0.918607056f, 0.816409707f},
-std::array<float,2>{0.453052938f, 0.121422365f},
-std::array<float,2>{0.0664383024f, 0.651216567f},
-std::array<float,2>{0.715444446f, 0.365038633f},
-std::array<float,2>{0.578977585f, 0.589039207f},
-std::array<float,2>{0.129762858f, 0.429618865f},
-std::array<float,2>{0.293893486f, 0.898347855f},
-std::array<float,2>{0.837963939f, 0.237890601f},
-std::array<float,2>{0.66907227f, 0.982008576f},
-std::array<float,2>{0.0580926426f, 0.154078498f},
-std::array<float,2>{0.398401886f, 0.540461183f},
-std::array<float,2>{0.99395138f, 0.447780788f},
-std::array<float,2>{0.776767612f, 0.708420753f},
-std::array<float,2>{0.312967539f, 0.300502896f},
-std::array<float,2>{0.236119181f, 0.776102364f},
-std::array<float,2>{0.510554314f, 0.0396698043f},
-std::array<float,2>{0.85427016f, 0.908392966f},
-std::array<float,2>{0.25156644f, 0.217159644f},
-std::array<float,2>{0.174850047f, 0.599162281f},
-std::array<float,2>{0.613727272f, 0.377620161f},
-std::array<float,2>{0.749618053f, 0.683306515f},
-std::array<float,2>{0.124312051f, 0.320521683f},
-std::array<float,2>{0.48985827f, 0.844833076f},
-std::array<float,2>{0.898389578f, 0.0891813189f},
-std::array<float,2>{0.559326947f, 0.789119065f},
-std::array<float,2>{0.195381328f, 0.0123956501f},
-std::array<float,2>{0.362294525f, 0.737830997f},
-std::array<float,2>{0.80684185f, 0.273863465f},
-std::array<float,2>{0.95848906f, 0.501077592f},
-std::array<float,2>{0.41869536f, 0.493273795f},
-std::array<float,2>{0.0169588793f, 0.949167252f},
-std::array<float,2>{0.645616353f, 0.183435291f},
-std::array<float,2>{0.887023449f, 0.937858105f},
-std::array<float,2>{0.472831279f, 0.175582424f},
-std::array<float,2>{0.0988671854f, 0.514077127f},
-std::array<float,2>{0.732125223f, 0.486380696f},
-std::array<float,2>{0.594361663f, 0.744346559f},
-std::array<float,2>{0.161932632f, 0.272969574f},
-std::array<float,2>{0.272440135f, 0.781751156f},
-std::array<float,2>{0.868263423f, 0.00625454169f},
-std::array<float,2>{0.627414644f, 0.85529393f},
-std::array<float,2>{0.00322473026f, 0.0790001228f},
-std::array<float,2>{0.432820082f, 0.679337919f},
-std::array<float,2>{0.947246313f, 0.319102377f},
-std::array<float,2>{0.792954922f, 0.609071672f},
-std::array<float,2>{0.350322753f, 0.387343884f},
-std::array<float,2>{0.214535236f, 0.9209252f},
-std::array<float,2>{0.538008392f, 0.20709829f},
-std::array<float,2>{0.812899947f, 0.772268474f},
-std::array<float,2>{0.307097107f, 0.0386768058f},
-std::array<float,2>{0.155560166f, 0.717579067f},
-std::array<float,2>{0.570117176f, 0.305150509f},
-std::array<float,2>{0.699729085f, 0.538138926f},
-std::array<float,2>{0.0906770825f, 0.442649454f},
-std::array<float,2>{0.464392751f, 0.972508729f},
-std::array<float,2>{0.93539542f, 0.144602045f},
-std::array<float,2>{0.516619861f, 0.900114417f},
-std::array<float,2>{0.224555656f, 0.243950337f},
-std::array<float,2>{0.343718708f, 0.585281014f},
-std::array<float,2>{0.750838578f, 0.436566234f},
-std::array<float,2>{0.978849113f, 0.648244739f},
-std::array<float,2>{0.387063414f, 0.367438167f},
-std::array<float,2>{0.0356004126f, 0.823310614f},
-std::array<float,2>{0.677005351f, 0.109880209f},
-std::array<float,2>{0.955043674f, 0.834018171f},
-std::array<float,2>{0.414774656f, 0.109235212f},
-std::array<float,2>{0.0199447386f, 0.639989913f},
-std::array<float,2>{0.641766608f, 0.358842045f},
-std::array<float,2>{0.558404326f, 0.577329814f},
-std::array<float,2>{0.199252322f, 0.406583577f},
-std::array<float,2>{0.364085853f, 0.87801671f},
-std::array<float,2>{0.811630309f, 0.226599619f},
-std::array<float,2>{0.744660914f, 0.998122692f},
-std::array<float,2>{0.119003475f, 0.129245639f},
-std::array<float,2>{0.484964728f, 0.557739377f},
-std::array<float,2>{0.892034173f, 0.463901609f},
-std::array<float,2>{0.855471313f, 0.695660293f},
-std::array<float,2>{0.254339427f, 0.282493532f},
-std::array<float,2>{0.176778138f, 0.75714612f},
-std::array<float,2>{0.611970007f, 0.0587987863f},
-std::array<float,2>{0.779598236f, 0.923297286f},
-std::array<float,2>{0.320244223f, 0.19910197f},
-std::array<float,2>{0.239373133f, 0.6244995f},
-std::array<float,2>{0.515320897f, 0.391652882f},
-std::array<float,2>{0.666151464f, 0.66392839f},
-std::array<float,2>{0.0598504134f, 0.328933626f},
-std::array<float,2>{0.391109496f, 0.862430573f},
-std::array<float,2>{0.999970615f, 0.0671086088f},
-std::array<float,2>{0.585361362f, 0.800068915f},
-std::array<float,2>{0.127276033f, 0.0167234614f},
-std::array<float,2>{0.291549683f, 0.723882496f},
-std::array<float,2>{0.840967178f, 0.258905381f},
-std::array<float,2>{0.915613651f, 0.528251112f},
-std::array<float,2>{0.448294014f, 0.482065499f},
-std::array<float,2>{0.0629500449f, 0.967037916f},
-std::array<float,2>{0.711012602f, 0.156716049f},
-std::array<float,2>{0.991800368f, 0.887340844f},
-std::array<float,2>{0.399921089f, 0.226169363f},
-std::array<float,2>{0.0494174659f, 0.569220006f},
-std::array<float,2>{0.663735986f, 0.419115126f},
-std::array<float,2>{0.500206053f, 0.632511139f},
-std::array<float,2>{0.248646617f, 0.348416835f},
-std::array<float,2>{0.325490981f, 0.836090267f},
-std::array<float,2>{0.770514131f, 0.101525269f},
-std::array<float,2>{0.708219588f, 0.763419807f},
-std::array<float,2>{0.0708843097f, 0.049899403f},
-std::array<float,2>{0.440105736f, 0.692419291f},
-std::array<float,2>{0.910688758f, 0.293659598f},
-std::array<float,2>{0.830675304f, 0.549023092f},
-std::array<float,2>{0.283584982f, 0.454764217f},
-std::array<float,2>{0.136141345f, 0.990235865f},
-std::array<float,2>{0.590314627f, 0.13860175f},
-std::array<float,2>{0.800729454f, 0.870981634f},
-std::array<float,2>{0.374396712f, 0.0745984092f},
-std::array<float,2>{0.193816245f, 0.66724062f},
-std::array<float,2>{0.5504511f, 0.341237038f},
-std::array<float,2>{0.653447568f, 0.613847494f},
-std::array<float,2>{0.0276230853f, 0.401410848f},
-std::array<float,2>{0.40662083f, 0.936317444f},
-std::array<float,2>{0.961324155f, 0.18868722f},
-std::array<float,2>{0.622652531f, 0.957912505f},
-std::array<float,2>{0.186119616f, 0.171770945f},
-std::array<float,2>{0.261557996f, 0.520788729f},
-std::array<float,2>{0.845751822f, 0.472549289f},
-std::array<float,2>{0.902173817f, 0.727541625f},
-std::array<float,2>{0.493846804f, 0.256319463f},
-std::array<float,2>{0.110117592f, 0.807272434f},
-std::array<float,2>{0.736196518f, 0.028120758f},
-std::array<float,2>{0.923685491f, 0.796571195f},
-std::array<float,2>{0.454437643f, 0.00793899223f},
-std::array<float,2>{0.0785185993f, 0.740523219f},
-std::array<float,2>{0.693921447f, 0.281044632f},
-std::array<float,2>{0.577226281f, 0.506310403f},
-std::array<float,2>{0.144606546f, 0.49655211f},
-std::array<float,2>{0.297367841f, 0.949954212f},
-std::array<float,2>{0.826863647f, 0.186625317f},
-std::array<float,2>{0.682043374f, 0.910771251f},
-std::array<float,2>{0.042973429f, 0.211549848f},
-std::array<float,2>{0.377347052f, 0.595592618f},
-std::array<float,2>{0.973210633f, 0.379494995f},
-std::array<float,2>{0.763915896f, 0.684740067f},
-std::array<float,2>{0.329786092f, 0.324769437f},
-std::array<float,2>{0.22887449f, 0.850654602f},
-std::array<float,2>{0.524583519f, 0.0937029421f},
-std::array<float,2>{0.862881303f, 0.977966011f},
-std::array<float,2>{0.274623722f, 0.150679559f},
-std::array<float,2>{0.16571188f, 0.543813705f},
-std::array<float,2>{0.602152407f, 0.452440262f},
-std::array<float,2>{0.724422514f, 0.703203797f},
-std::array<float,2>{0.103370063f, 0.302351475f},
-std::array<float,2>{0.477928907f, 0.780330598f},
-std::array<float,2>{0.880253494f, 0.0459495075f},
-std::array<float,2>{0.543362379f, 0.815024197f},
-std::array<float,2>{0.209675342f, 0.118155994f},
-std::array<float,2>{0.354080647f, 0.655342281f},
-std::array<float,2>{0.786028683f, 0.360937178f},
-std::array<float,2>{0.942702532f, 0.590649188f},
-std::array<float,2>{0.428849041f, 0.423068553f},
-std::array<float,2>{0.0112571362f, 0.891589284f},
-std::array<float,2>{0.633967578f, 0.238700345f},
-std::array<float,2>{0.906440735f, 0.916588128f},
-std::array<float,2>{0.44179678f, 0.204829693f},
-std::array<float,2>{0.0760403574f, 0.604026318f},
-std::array<float,2>{0.705369174f, 0.385009736f},
-std::array<float,2>{0.588459969f, 0.675414324f},
-std::array<float,2>{0.13957563f, 0.316347003f},
-std::array<float,2>{0.287345976f, 0.859265029f},
-std::array<float,2>{0.833776712f, 0.0822140574f},
-std::array<float,2>{0.658051193f, 0.785865486f},
-std::array<float,2>{0.0514742658f, 0.00205695955f},
-std::array<float,2>{0.405238509f, 0.747811258f},
-std::array<float,2>{0.984955847f, 0.267320544f},
-std::array<float,2>{0.768849194f, 0.508328378f},
-std::array<float,2>{0.323481739f, 0.490433425f},
-std::array<float,2>{0.245468169f, 0.941531539f},
-std::array<float,2>{0.505710244f, 0.176251203f},
-std::array<float,2>{0.850561082f, 0.826264977f},
-std::array<float,2>{0.263786584f, 0.114722647f},
-std::array<float,2>{0.183233738f, 0.643050909f},
-std::array<float,2>{0.617912233f, 0.371673644f},
-std::array<float,2>{0.739654422f, 0.579490781f},
-std::array<float,2>{0.116885409f, 0.431629062f},
-std::array<float,2>{0.499792725f, 0.90608561f},
-std::array<float,2>{0.904821634f, 0.248415589f},
-std::array<float,2>{0.553717732f, 0.974379361f},
-std::array<float,2>{0.188745126f, 0.140812412f},
-std::array<float,2>{0.367243379f, 0.532068849f},
-std::array<float,2>{0.800970256f, 0.438317686f},
-std::array<float,2>{0.965686917f, 0.710982263f},
-std::array<float,2>{0.410795718f, 0.311740249f},
-std::array<float,2>{0.0251214989f, 0.76929003f},
-std::array<float,2>{0.649041295f, 0.0329417735f},
-std::array<float,2>{0.969098806f, 0.752938271f},
-std::array<float,2>{0.38113746f, 0.0547227524f},
-std::array<float,2>{0.0391854532f, 0.702968955f},
-std::array<float,2>{0.686140537f, 0.285560876f},
-std::array<float,2>{0.527624309f, 0.559126496f},
-std::array<float,2>{0.233645856f, 0.467296571f},
-std::array<float,2>{0.334408134f, 0.993218005f},
-std::array<float,2>{0.761173427f, 0.125618681f},
-std::array<float,2>{0.69058907f, 0.879032433f},
-std::array<float,2>{0.0849586129f, 0.233136907f},
-std::array<float,2>{0.458328396f, 0.571330011f},
-std::array<float,2>{0.926233709f, 0.41174385f},
-std::array<float,2>{0.822040081f, 0.635203838f},
-std::array<float,2>{0.302189738f, 0.353784144f},
-std::array<float,2>{0.144046336f, 0.831229568f},
-std::array<float,2>{0.571225226f, 0.104272053f},
-std::array<float,2>{0.78351748f, 0.961146891f},
-std::array<float,2>{0.358291715f, 0.161855668f},
-std::array<float,2>{0.204100639f, 0.524274826f},
-std::array<float,2>{0.540068984f, 0.479297727f},
-std::array<float,2>{0.63822788f, 0.719586611f},
-std::array<float,2>{0.0135158673f, 0.263500184f},
-std::array<float,2>{0.425158501f, 0.803316951f},
-std::array<float,2>{0.939889431f, 0.0211887639f},
-std::array<float,2>{0.607640803f, 0.865679443f},
-std::array<float,2>{0.168941855f, 0.0650305748f},
-std::array<float,2>{0.27794233f, 0.659358859f},
-std::array<float,2>{0.867154598f, 0.334609568f},
-std::array<float,2>{0.875093937f, 0.619946122f},
-std::array<float,2>{0.483368695f, 0.397122175f},
-std::array<float,2>{0.10697864f, 0.926811755f},
-std::array<float,2>{0.719386339f, 0.201279536f},
-std::array<float,2>{0.949815691f, 0.986554146f},
-std::array<float,2>{0.434425533f, 0.13360709f},
-std::array<float,2>{0.00423319312f, 0.550978065f},
-std::array<float,2>{0.632647038f, 0.458298624f},
-std::array<float,2>{0.531655014f, 0.689367414f},
-std::array<float,2>{0.21588473f, 0.289865375f},
-std::array<float,2>{0.347322732f, 0.758552909f},
-std::array<float,2>{0.794771969f, 0.0528642237f},
-std::array<float,2>{0.727849185f, 0.840076268f},
-std::array<float,2>{0.093914412f, 0.0965959802f},
-std::array<float,2>{0.471836835f, 0.626787961f},
-std::array<float,2>{0.885004222f, 0.344453752f},
-std::array<float,2>{0.87482506f, 0.563005269f},
-std::array<float,2>{0.268758357f, 0.414788097f},
-std::array<float,2>{0.159324199f, 0.886523008f},
-std::array<float,2>{0.598783493f, 0.222456217f},
-std::array<float,2>{0.755708814f, 0.810017288f},
-std::array<float,2>{0.339798748f, 0.0272391587f},
-std::array<float,2>{0.220287129f, 0.733119905f},
-std::array<float,2>{0.522021651f, 0.253413141f},
-std::array<float,2>{0.675096869f, 0.516839445f},
-std::array<float,2>{0.032147631f, 0.473958552f},
-std::array<float,2>{0.385451376f, 0.954473138f},
-std::array<float,2>{0.980788529f, 0.1658227f},
-std::array<float,2>{0.563493669f, 0.932216942f},
-std::array<float,2>{0.151235446f, 0.193841204f},
-std::array<float,2>{0.312144667f, 0.612790465f},
-std::array<float,2>{0.820110321f, 0.404689938f},
-std::array<float,2>{0.929969251f, 0.668097913f},
-std::array<float,2>{0.468523026f, 0.337579846f},
-std::array<float,2>{0.0883177444f, 0.871462405f},
-std::array<float,2>{0.697820723f, 0.0738474503f},
-std::array<float,2>{0.896095753f, 0.846532762f},
-std::array<float,2>{0.4909769f, 0.0875849947f},
-std::array<float,2>{0.122129381f, 0.680197537f},
-std::array<float,2>{0.74778235f, 0.323377252f},
-std::array<float,2>{0.616285145f, 0.600883126f},
-std::array<float,2>{0.172664329f, 0.375861406f},
-std::array<float,2>{0.252128154f, 0.907548964f},
-std::array<float,2>{0.853149116f, 0.216777951f},
-std::array<float,2>{0.64807719f, 0.945703387f},
-std::array<float,2>{0.0178672746f, 0.180297256f},
-std::array<float,2>{0.421253562f, 0.503269017f},
-std::array<float,2>{0.959177136f, 0.495661974f},
-std::array<float,2>{0.805391848f, 0.735413969f},
-std::array<float,2>{0.360823423f, 0.276853532f},
-std::array<float,2>{0.197732583f, 0.792963088f},
-std::array<float,2>{0.562009275f, 0.0137444632f},
-std::array<float,2>{0.836734056f, 0.895428538f},
-std::array<float,2>{0.296112537f, 0.235332519f},
-std::array<float,2>{0.130981281f, 0.586566985f},
-std::array<float,2>{0.581762969f, 0.426213264f},
-std::array<float,2>{0.718277097f, 0.649308383f},
-std::array<float,2>{0.0701401159f, 0.365943611f},
-std::array<float,2>{0.450243622f, 0.818507314f},
-std::array<float,2>{0.920552611f, 0.123147003f},
-std::array<float,2>{0.508170068f, 0.773734629f},
-std::array<float,2>{0.238190994f, 0.0428836457f},
-std::array<float,2>{0.315927356f, 0.710217774f},
-std::array<float,2>{0.774252176f, 0.298081398f},
-std::array<float,2>{0.995003462f, 0.541147888f},
-std::array<float,2>{0.395139366f, 0.446938306f},
-std::array<float,2>{0.0549007803f, 0.982519746f},
-std::array<float,2>{0.671074271f, 0.155535132f},
-std::array<float,2>{0.924616456f, 0.949345052f},
-std::array<float,2>{0.456957757f, 0.187360823f},
-std::array<float,2>{0.0805260763f, 0.506445169f},
-std::array<float,2>{0.693021894f, 0.496604741f},
-std::array<float,2>{0.574883163f, 0.740885615f},
-std::array<float,2>{0.148035079f, 0.280458808f},
-std::array<float,2>{0.299658686f, 0.7963534f},
-std::array<float,2>{0.825756431f, 0.0087866243f},
-std::array<float,2>{0.681084991f, 0.851208985f},
-std::array<float,2>{0.0456104353f, 0.0932133794f},
-std::array<float,2>{0.37553966f, 0.685507238f},
-std::array<float,2>{0.97541225f, 0.324685723f},
-std::array<float,2>{0.762840807f, 0.594966054f},
-std::array<float,2>{0.33187905f, 0.37917909f},
-std::array<float,2>{0.228048727f, 0.910313725f},
-std::array<float,2>{0.525427163f, 0.211261317f},
-std::array<float,2>{0.859721482f, 0.781200469f},
-std::array<float,2>{0.275694042f, 0.0465676412f},
-std::array<float,2>{0.166896552f, 0.703728974f},
-std::array<float,2>{0.603722632f, 0.30208689f},
-std::array<float,2>{0.724659741f, 0.543070316f},
-std::array<float,2>{0.104103565f, 0.452663302f},
-std::array<float,2>{0.479312181f, 0.978106737f},
-std::array<float,2>{0.881745934f, 0.151007622f},
-std::array<float,2>{0.546325207f, 0.890873134f},
-std::array<float,2>{0.207932353f, 0.239001274f},
-std::array<float,2>{0.353178769f, 0.590073168f},
-std::array<float,2>{0.788629949f, 0.42336306f},
-std::array<float,2>{0.944903433f, 0.655804694f},
-std::array<float,2>{0.427017301f, 0.360833466f},
-std::array<float,2>{0.00857271161f, 0.81453532f},
-std::array<float,2>{0.635219872f, 0.117290594f},
-std::array<float,2>{0.98879534f, 0.836776376f},
-std::array<float,2>{0.40225482f, 0.100987367f},
-std::array<float,2>{0.0487716794f, 0.632039309f},
-std::array<float,2>{0.660921931f, 0.348128647f},
-std::array<float,2>{0.503179491f, 0.568420649f},
-std::array<float,2>{0.247924209f, 0.419496745f},
-std::array<float,2>{0.326950401f, 0.886773825f},
-std::array<float,2>{0.772187471f, 0.225990295f},
-std::array<float,2>{0.709594309f, 0.991050065f},
-std::array<float,2>{0.0733570382f, 0.13789551f},
-std::array<float,2>{0.437936366f, 0.54957819f},
-std::array<float,2>{0.913607001f, 0.454502583f},
-std::array<float,2>{0.830013514f, 0.693046629f},
-std::array<float,2>{0.283115894f, 0.293087363f},
-std::array<float,2>{0.134616271f, 0.762764156f},
-std::array<float,2>{0.593352437f, 0.0506657436f},
-std::array<float,2>{0.798812687f, 0.935857236f},
-std::array<float,2>{0.372206271f, 0.189301997f},
-std::array<float,2>{0.191713065f, 0.61340785f},
-std::array<float,2>{0.547093272f, 0.402020425f},
-std::array<float,2>{0.656185389f, 0.667858481f},
-std::array<float,2>{0.0302506126f, 0.34144482f},
-std::array<float,2>{0.410078079f, 0.870428324f},
-std::array<float,2>{0.963174999f, 0.0751248002f},
-std::array<float,2>{0.624816954f, 0.806931496f},
-std::array<float,2>{0.184747189f, 0.0275961347f},
-std::array<float,2>{0.257964104f, 0.728202879f},
-std::array<float,2>{0.844718874f, 0.25657779f},
-std::array<float,2>{0.900264144f, 0.521090627f},
-std::array<float,2>{0.496064305f, 0.471773028f},
-std::array<float,2>{0.112374149f, 0.957118511f},
-std::array<float,2>{0.736350179f, 0.171061486f},
-std::array<float,2>{0.956792712f, 0.878645599f},
-std::array<float,2>{0.417296797f, 0.227395877f},
-std::array<float,2>{0.0217529628f, 0.577880323f},
-std::array<float,2>{0.6437397f, 0.406838119f},
-std::array<float,2>{0.554792821f, 0.640192389f},
-std::array<float,2>{0.201366395f, 0.359309375f},
-std::array<float,2>{0.365877837f, 0.834673047f},
-std::array<float,2>{0.809872031f, 0.108800679f},
-std::array<float,2>{0.742661774f, 0.757393181f},
-std::array<float,2>{0.120733947f, 0.0592014715f},
-std::array<float,2>{0.488177419f, 0.695900977f},
-std::array<float,2>{0.893658817f, 0.28298986f},
-std::array<float,2>{0.858756006f, 0.558114529f},
-std::array<float,2>{0.257235408f, 0.464709938f},
-std::array<float,2>{0.179397166f, 0.998683929f},
-std::array<float,2>{0.610733151f, 0.129715115f},
-std::array<float,2>{0.778956354f, 0.863034308f},
-std::array<float,2>{0.316970676f, 0.0667624846f},
-std::array<float,2>{0.240543142f, 0.663449883f},
-std::array<float,2>{0.513097227f, 0.328532696f},
-std::array<float,2>{0.665540755f, 0.624985218f},
-std::array<float,2>{0.0618427508f, 0.39218089f},
-std::array<float,2>{0.392735928f, 0.923652768f},
-std::array<float,2>{0.997684956f, 0.198329732f},
-std::array<float,2>{0.582631528f, 0.967735112f},
-std::array<float,2>{0.125713289f, 0.156810716f},
-std::array<float,2>{0.29026103f, 0.527444184f},
-std::array<float,2>{0.842931092f, 0.481651545f},
-std::array<float,2>{0.916770697f, 0.724606991f},
-std::array<float,2>{0.445472449f, 0.259546459f},
-std::array<float,2>{0.0650711656f, 0.800662756f},
-std::array<float,2>{0.713528931f, 0.0171861611f},
-std::array<float,2>{0.889732122f, 0.781613588f},
-std::array<float,2>{0.476389199f, 0.00661417656f},
-std::array<float,2>{0.101419128f, 0.744722784f},
-std::array<float,2>{0.733992696f, 0.272617549f},
-std::array<float,2>{0.597616017f, 0.514431179f},
-std::array<float,2>{0.163553491f, 0.486840993f},
-std::array<float,2>{0.270405114f, 0.93825227f},
-std::array<float,2>{0.870426893f, 0.175086394f},
-std::array<float,2>{0.62534982f, 0.9217664f},
-std::array<float,2>{0.00162040372f, 0.207740322f},
-std::array<float,2>{0.430882603f, 0.60868305f},
-std::array<float,2>{0.948944926f, 0.38687858f},
-std::array<float,2>{0.789310992f, 0.679013252f},
-std::array<float,2>{0.347831577f, 0.318472177f},
-std::array<float,2>{0.212052986f, 0.854966521f},
-std::array<float,2>{0.536228061f, 0.0784965008f},
-std::array<float,2>{0.815172493f, 0.971817553f},
-std::array<float,2>{0.306212783f, 0.145196557f},
-std::array<float,2>{0.153509676f, 0.53893441f},
-std::array<float,2>{0.568256795f, 0.443177432f},
-std::array<float,2>{0.702076197f, 0.716818631f},
-std::array<float,2>{0.092057243f, 0.305362374f},
-std::array<float,2>{0.462327272f, 0.771618962f},
-std::array<float,2>{0.937337577f, 0.0383883007f},
-std::array<float,2>{0.518894613f, 0.824075401f},
-std::array<float,2>{0.226099163f, 0.109381832f},
-std::array<float,2>{0.341367871f, 0.647615671f},
-std::array<float,2>{0.75234288f, 0.367801905f},
-std::array<float,2>{0.978141427f, 0.585800409f},
-std::array<float,2>{0.390044272f, 0.437357545f},
-std::array<float,2>{0.0374838114f, 0.8994326f},
-std::array<float,2>{0.678575754f, 0.243396252f},
-std::array<float,2>{0.897810757f, 0.907748342f},
-std::array<float,2>{0.489711374f, 0.216275498f},
-std::array<float,2>{0.124594979f, 0.601491511f},
-std::array<float,2>{0.749463558f, 0.375219345f},
-std::array<float,2>{0.613818049f, 0.679762781f},
-std::array<float,2>{0.175319612f, 0.323833406f},
-std::array<float,2>{0.25140658f, 0.846029699f},
-std::array<float,2>{0.853712559f, 0.0872673169f},
-std::array<float,2>{0.646270096f, 0.792158365f},
-std::array<float,2>{0.0173304603f, 0.0145509718f},
-std::array<float,2>{0.418346554f, 0.735971749f},
-std::array<float,2>{0.958857954f, 0.277059972f},
-std::array<float,2>{0.807284892f, 0.503856719f},
-std::array<float,2>{0.361723274f, 0.495464504f},
-std::array<float,2>{0.19607459f, 0.945808828f},
-std::array<float,2>{0.558883488f, 0.17980288f},
-std::array<float,2>{0.838492334f, 0.819028854f},
-std::array<float,2>{0.293158829f, 0.124022573f},
-std::array<float,2>{0.129382879f, 0.648860216f},
-std::array<float,2>{0.578414083f, 0.365595311f},
-std::array<float,2>{0.714950085f, 0.586410761f},
-std::array<float,2>{0.0672659948f, 0.426677644f},
-std::array<float,2>{0.452370018f, 0.894750774f},
-std::array<float,2>{0.918366909f, 0.234836236f},
-std::array<float,2>{0.510071337f, 0.983202636f},
-std::array<float,2>{0.235774845f, 0.156189203f},
-std::array<float,2>{0.313127398f, 0.54177773f},
-std::array<float,2>{0.777311981f, 0.44660899f},
-std::array<float,2>{0.993440032f, 0.710559905f},
-std::array<float,2>{0.397580951f, 0.298659205f},
-std::array<float,2>{0.0583665818f, 0.774243176f},
-std::array<float,2>{0.66973716f, 0.0423440151f},
-std::array<float,2>{0.95122242f, 0.757826567f},
-std::array<float,2>{0.437065363f, 0.0534133874f},
-std::array<float,2>{0.00756536145f, 0.688728273f},
-std::array<float,2>{0.629057288f, 0.289132744f},
-std::array<float,2>{0.533612251f, 0.551751971f},
-std::array<float,2>{0.21825093f, 0.458501965f},
-std::array<float,2>{0.345543951f, 0.986955285f},
-std::array<float,2>{0.79586488f, 0.13286905f},
-std::array<float,2>{0.729587495f, 0.886211276f},
-std::array<float,2>{0.0958494842f, 0.222028852f},
-std::array<float,2>{0.470269173f, 0.562536478f},
-std::array<float,2>{0.88427031f, 0.414397687f},
-std::array<float,2>{0.871373296f, 0.626389146f},
-std::array<float,2>{0.266012818f, 0.343797565f},
-std::array<float,2>{0.157338098f, 0.840786397f},
-std::array<float,2>{0.600145161f, 0.0959305987f},
-std::array<float,2>{0.757011652f, 0.954957366f},
-std::array<float,2>{0.335937649f, 0.165405884f},
-std::array<float,2>{0.221852049f, 0.517208815f},
-std::array<float,2>{0.520458102f, 0.474128664f},
-std::array<float,2>{0.673392057f, 0.732774973f},
-std::array<float,2>{0.0344364531f, 0.253601372f},
-std::array<float,2>{0.38354817f, 0.810234964f},
-std::array<float,2>{0.983593583f, 0.0265308078f},
-std::array<float,2>{0.566395164f, 0.87195915f},
-std::array<float,2>{0.149360448f, 0.0735079348f},
-std::array<float,2>{0.309256673f, 0.668795884f},
-std::array<float,2>{0.817914546f, 0.337227792f},
-std::array<float,2>{0.93179518f, 0.613258719f},
-std::array<float,2>{0.466728657f, 0.405179769f},
-std::array<float,2>{0.08703769f, 0.931928754f},
-std::array<float,2>{0.697051287f, 0.194001898f},
-std::array<float,2>{0.970938146f, 0.993889093f},
-std::array<float,2>{0.380244911f, 0.12501654f},
-std::array<float,2>{0.0424229726f, 0.558815479f},
-std::array<float,2>{0.685212374f, 0.467272073f},
-std::array<float,2>{0.529683173f, 0.702343106f},
-std::array<float,2>{0.230912611f, 0.285847187f},
-std::array<float,2>{0.333548993f, 0.753478229f},
-std::array<float,2>{0.759646654f, 0.0553014576f},
-std::array<float,2>{0.689280272f, 0.831662536f},
-std::array<float,2>{0.083370626f, 0.103560045f},
-std::array<float,2>{0.460683644f, 0.635401666f},
-std::array<float,2>{0.927848637f, 0.354298234f},
-std::array<float,2>{0.823301435f, 0.572061598f},
-std::array<float,2>{0.304264694f, 0.411398798f},
-std::array<float,2>{0.141368583f, 0.879669964f},
-std::array<float,2>{0.572906613f, 0.232569486f},
-std::array<float,2>{0.781816065f, 0.802919805f},
-std::array<float,2>{0.356973827f, 0.0207581613f},
-std::array<float,2>{0.205146596f, 0.71911341f},
-std::array<float,2>{0.541354299f, 0.262896001f},
-std::array<float,2>{0.640389264f, 0.523898005f},
-std::array<float,2>{0.0146344351f, 0.478554934f},
-std::array<float,2>{0.422166914f, 0.961796284f},
-std::array<float,2>{0.938422441f, 0.161496177f},
-std::array<float,2>{0.606658459f, 0.927362502f},
-std::array<float,2>{0.170814276f, 0.201793969f},
-std::array<float,2>{0.279697239f, 0.619420409f},
-std::array<float,2>{0.865197301f, 0.396968931f},
-std::array<float,2>{0.878771842f, 0.659826934f},
-std::array<float,2>{0.48208794f, 0.334167182f},
-std::array<float,2>{0.108355276f, 0.866092384f},
-std::array<float,2>{0.721097708f, 0.0645429716f},
-std::array<float,2>{0.908850908f, 0.858804464f},
-std::array<float,2>{0.444122136f, 0.0827061087f},
-std::array<float,2>{0.0775018483f, 0.67488265f},
-std::array<float,2>{0.70433569f, 0.315456659f},
-std::array<float,2>{0.587133467f, 0.603921831f},
-std::array<float,2>{0.137856111f, 0.385703474f},
-std::array<float,2>{0.287087291f, 0.916344047f},
-std::array<float,2>{0.835352302f, 0.204570144f},
-std::array<float,2>{0.659219563f, 0.941956639f},
-std::array<float,2>{0.0543042943f, 0.176504493f},
-std::array<float,2>{0.402816415f, 0.508191884f},
-std::array<float,2>{0.986506343f, 0.490977585f},
-std::array<float,2>{0.765805364f, 0.747531116f},
-std::array<float,2>{0.321829557f, 0.266627192f},
-std::array<float,2>{0.243162394f, 0.785543084f},
-std::array<float,2>{0.506553829f, 0.00284524192f},
-std::array<float,2>{0.849022686f, 0.905595243f},
-std::array<float,2>{0.262727231f, 0.248556957f},
-std::array<float,2>{0.180723995f, 0.579672396f},
-std::array<float,2>{0.620051682f, 0.430800408f},
-std::array<float,2>{0.741576016f, 0.64349252f},
-std::array<float,2>{0.114906296f, 0.371282578f},
-std::array<float,2>{0.497668207f, 0.826856017f},
-std::array<float,2>{0.903792679f, 0.11493282f},
-std::array<float,2>{0.551423073f, 0.768771589f},
-std::array<float,2>{0.190699786f, 0.0322883576f},
-std::array<float,2>{0.370099455f, 0.711726904f},
-std::array<float,2>{0.804153085f, 0.312245727f},
-std::array<float,2>{0.967972934f, 0.531541765f},
-std::array<float,2>{0.412773937f, 0.437918812f},
-std::array<float,2>{0.0272740014f, 0.97369343f},
-std::array<float,2>{0.651841342f, 0.141239062f},
-std::array<float,2>{0.880528688f, 0.979788661f},
-std::array<float,2>{0.478397191f, 0.149884701f},
-std::array<float,2>{0.10283231f, 0.546616495f},
-std::array<float,2>{0.72406894f, 0.450838327f},
-std::array<float,2>{0.601968646f, 0.706691146f},
-std::array<float,2>{0.165211618f, 0.303247094f},
-std::array<float,2>{0.275170475f, 0.777399898f},
-std::array<float,2>{0.862681389f, 0.043113146f},
-std::array<float,2>{0.634733856f, 0.813418806f},
-std::array<float,2>{0.0107445978f, 0.120206624f},
-std::array<float,2>{0.429400116f, 0.653813124f},
-std::array<float,2>{0.943319499f, 0.362334847f},
-std::array<float,2>{0.785333395f, 0.593465388f},
-std::array<float,2>{0.353615224f, 0.424859494f},
-std::array<float,2>{0.208993599f, 0.89427793f},
-std::array<float,2>{0.543563843f, 0.240833923f},
-std::array<float,2>{0.82643193f, 0.793055654f},
-std::array<float,2>{0.297180533f, 0.00992976874f},
-std::array<float,2>{0.145500779f, 0.739216685f},
-std::array<float,2>{0.577719092f, 0.278853834f},
-std::array<float,2>{0.693755925f, 0.504734278f},
-std::array<float,2>{0.0786892474f, 0.49890998f},
-std::array<float,2>{0.454604119f, 0.951351762f},
-std::array<float,2>{0.92319715f, 0.18530336f},
-std::array<float,2>{0.52505511f, 0.912298441f},
-std::array<float,2>{0.229389518f, 0.213179976f},
-std::array<float,2>{0.329584688f, 0.595937431f},
-std::array<float,2>{0.764334261f, 0.380924195f},
-std::array<float,2>{0.973100543f, 0.687208951f},
-std::array<float,2>{0.377559096f, 0.326429367f},
-std::array<float,2>{0.0436805449f, 0.848662972f},
-std::array<float,2>{0.682344556f, 0.0907980949f},
-std::array<float,2>{0.961571634f, 0.869128644f},
-std::array<float,2>{0.407064438f, 0.0770161748f},
-std::array<float,2>{0.028224621f, 0.66468972f},
-std::array<float,2>{0.654046357f, 0.342281193f},
-std::array<float,2>{0.549861848f, 0.61576432f},
-std::array<float,2>{0.193878114f, 0.399691164f},
-std::array<float,2>{0.374614984f, 0.935481548f},
-std::array<float,2>{0.80020535f, 0.190735385f},
-std::array<float,2>{0.735612631f, 0.960777104f},
-std::array<float,2>{0.109552704f, 0.16809389f},
-std::array<float,2>{0.493486494f, 0.523315012f},
-std::array<float,2>{0.90165472f, 0.468981862f},
-std::array<float,2>{0.846525013f, 0.729906678f},
-std::array<float,2>{0.261076868f, 0.255215973f},
-std::array<float,2>{0.185634553f, 0.805516064f},
-std::array<float,2>{0.622487605f, 0.0305477101f},
-std::array<float,2>{0.771352649f, 0.889937401f},
-std::array<float,2>{0.326099038f, 0.224121854f},
-std::array<float,2>{0.248167887f, 0.568099678f},
-std::array<float,2>{0.50092566f, 0.421450913f},
-std::array<float,2>{0.663362503f, 0.629373908f},
-std::array<float,2>{0.0489874519f, 0.349960834f},
-std::array<float,2>{0.399670988f, 0.837993979f},
-std::array<float,2>{0.991279066f, 0.0978967845f},
-std::array<float,2>{0.590341747f, 0.763702631f},
-std::array<float,2>{0.136711627f, 0.0481223091f},
-std::array<float,2>{0.284128219f, 0.693831861f},
-std::array<float,2>{0.830376923f, 0.295870364f},
-std::array<float,2>{0.910189211f, 0.547788858f},
-std::array<float,2>{0.439582169f, 0.455109209f},
-std::array<float,2>{0.0703458712f, 0.988751888f},
-std::array<float,2>{0.708599687f, 0.139053583f},
-std::array<float,2>{0.999131382f, 0.924503863f},
-std::array<float,2>{0.391206622f, 0.196368769f},
-std::array<float,2>{0.0602451563f, 0.621417046f},
-std::array<float,2>{0.66667968f, 0.393996507f},
-std::array<float,2>{0.514809251f, 0.660425544f},
-std::array<float,2>{0.239840314f, 0.33152467f},
-std::array<float,2>{0.31977281f, 0.860784531f},
-std::array<float,2>{0.77992636f, 0.068392545f},
-std::array<float,2>{0.71185112f, 0.797244072f},
-std::array<float,2>{0.0633049831f, 0.0186283458f},
-std::array<float,2>{0.448952198f, 0.724908352f},
-std::array<float,2>{0.91513288f, 0.260268062f},
-std::array<float,2>{0.841472328f, 0.530973315f},
-std::array<float,2>{0.291051298f, 0.483164132f},
-std::array<float,2>{0.127639264f, 0.966555834f},
-std::array<float,2>{0.585533321f, 0.159659252f},
-std::array<float,2>{0.812073171f, 0.833216608f},
-std::array<float,2>{0.363410115f, 0.106053501f},
-std::array<float,2>{0.200081095f, 0.63719815f},
-std::array<float,2>{0.557847261f, 0.355650634f},
-std::array<float,2>{0.642146528f, 0.575539529f},
-std::array<float,2>{0.0203343425f, 0.408457875f},
-std::array<float,2>{0.414507061f, 0.876699328f},
-std::array<float,2>{0.954487979f, 0.230402142f},
-std::array<float,2>{0.611476958f, 0.997955382f},
-std::array<float,2>{0.177675396f, 0.131115898f},
-std::array<float,2>{0.25455606f, 0.555197775f},
-std::array<float,2>{0.856105566f, 0.462000549f},
-std::array<float,2>{0.892357469f, 0.698925912f},
-std::array<float,2>{0.484607697f, 0.283842444f},
-std::array<float,2>{0.118358307f, 0.755077124f},
-std::array<float,2>{0.744203389f, 0.0608918332f},
-std::array<float,2>{0.934850752f, 0.770501912f},
-std::array<float,2>{0.463938922f, 0.0358955935f},
-std::array<float,2>{0.0899956301f, 0.716639519f},
-std::array<float,2>{0.699361205f, 0.308112442f},
-std::array<float,2>{0.569384933f, 0.536438823f},
-std::array<float,2>{0.155862555f, 0.444133967f},
-std::array<float,2>{0.307177067f, 0.968885124f},
-std::array<float,2>{0.813226402f, 0.147801742f},
-std::array<float,2>{0.677644014f, 0.900592387f},
-std::array<float,2>{0.0360901505f, 0.244846612f},
-std::array<float,2>{0.38732776f, 0.583368063f},
-std::array<float,2>{0.979443789f, 0.434576452f},
-std::array<float,2>{0.750088751f, 0.645539999f},
-std::array<float,2>{0.342871398f, 0.369588614f},
-std::array<float,2>{0.223646432f, 0.821432769f},
-std::array<float,2>{0.517432272f, 0.111476488f},
-std::array<float,2>{0.868837237f, 0.940191865f},
-std::array<float,2>{0.271842003f, 0.17288284f},
-std::array<float,2>{0.161220521f, 0.512803495f},
-std::array<float,2>{0.59388572f, 0.484724373f},
-std::array<float,2>{0.731696904f, 0.743696928f},
-std::array<float,2>{0.0993240252f, 0.26990357f},
-std::array<float,2>{0.473340243f, 0.783393204f},
-std::array<float,2>{0.887625158f, 0.00520466734f},
-std::array<float,2>{0.537260413f, 0.85216397f},
-std::array<float,2>{0.214336619f, 0.0813198164f},
-std::array<float,2>{0.349790365f, 0.677471638f},
-std::array<float,2>{0.792228758f, 0.31765911f},
-std::array<float,2>{0.946409404f, 0.606352806f},
-std::array<float,2>{0.433508873f, 0.389777601f},
-std::array<float,2>{0.00361533207f, 0.918273926f},
-std::array<float,2>{0.62759763f, 0.209364608f},
-std::array<float,2>{0.920258939f, 0.897743106f},
-std::array<float,2>{0.450836688f, 0.237666652f},
-std::array<float,2>{0.0696049482f, 0.589787245f},
-std::array<float,2>{0.717924178f, 0.428967535f},
-std::array<float,2>{0.581510305f, 0.650481999f},
-std::array<float,2>{0.131680101f, 0.364454508f},
-std::array<float,2>{0.296762437f, 0.817225933f},
-std::array<float,2>{0.836048961f, 0.121785611f},
-std::array<float,2>{0.671459258f, 0.775740445f},
-std::array<float,2>{0.0556509532f, 0.0395491458f},
-std::array<float,2>{0.394708425f, 0.708786368f},
-std::array<float,2>{0.994339824f, 0.300271541f},
-std::array<float,2>{0.773874819f, 0.540964484f},
-std::array<float,2>{0.315757781f, 0.447395504f},
-std::array<float,2>{0.237695605f, 0.981462002f},
-std::array<float,2>{0.50862962f, 0.153631166f},
-std::array<float,2>{0.852875054f, 0.845364571f},
-std::array<float,2>{0.252649516f, 0.0894567892f},
-std::array<float,2>{0.171880722f, 0.683037102f},
-std::array<float,2>{0.616961122f, 0.320848554f},
-std::array<float,2>{0.747512102f, 0.598721743f},
-std::array<float,2>{0.122920722f, 0.377014458f},
-std::array<float,2>{0.490511715f, 0.909131765f},
-std::array<float,2>{0.895930946f, 0.217651337f},
-std::array<float,2>{0.56239742f, 0.948683023f},
-std::array<float,2>{0.197973117f, 0.182650343f},
-std::array<float,2>{0.360949486f, 0.501621127f},
-std::array<float,2>{0.80474931f, 0.493940264f},
-std::array<float,2>{0.959828734f, 0.737751424f},
-std::array<float,2>{0.42164582f, 0.274200082f},
-std::array<float,2>{0.0182262752f, 0.789903998f},
-std::array<float,2>{0.647634387f, 0.0119718546f},
-std::array<float,2>{0.980960071f, 0.811937213f},
-std::array<float,2>{0.385210246f, 0.0237471759f},
-std::array<float,2>{0.0313319191f, 0.730850399f},
-std::array<float,2>{0.675508201f, 0.250386238f},
-std::array<float,2>{0.52168417f, 0.518733859f},
-std::array<float,2>{0.220090538f, 0.476477891f},
-std::array<float,2>{0.339108467f, 0.955408335f},
-std::array<float,2>{0.755053639f, 0.166077718f},
-std::array<float,2>{0.697350442f, 0.930620968f},
-std::array<float,2>{0.088438645f, 0.192038536f},
-std::array<float,2>{0.468215674f, 0.611291826f},
-std::array<float,2>{0.930581331f, 0.40428111f},
-std::array<float,2>{0.819415927f, 0.670375168f},
-std::array<float,2>{0.311916202f, 0.33931309f},
-std::array<float,2>{0.150485203f, 0.873411059f},
-std::array<float,2>{0.563983679f, 0.0711532384f},
-std::array<float,2>{0.793945372f, 0.985862374f},
-std::array<float,2>{0.346774757f, 0.1353181f},
-std::array<float,2>{0.216730043f, 0.553058207f},
-std::array<float,2>{0.532023489f, 0.459906757f},
-std::array<float,2>{0.632116377f, 0.69120717f},
-std::array<float,2>{0.00461633457f, 0.292563289f},
-std::array<float,2>{0.434051156f, 0.761339784f},
-std::array<float,2>{0.949306071f, 0.0511174388f},
-std::array<float,2>{0.599434555f, 0.841870129f},
-std::array<float,2>{0.160044089f, 0.0952097699f},
-std::array<float,2>{0.269131303f, 0.628482401f},
-std::array<float,2>{0.874418139f, 0.345800668f},
-std::array<float,2>{0.885636568f, 0.565097153f},
-std::array<float,2>{0.472308159f, 0.417191476f},
-std::array<float,2>{0.094620578f, 0.884657025f},
-std::array<float,2>{0.728031516f, 0.218887463f},
-std::array<float,2>{0.939989984f, 0.962901413f},
-std::array<float,2>{0.425512761f, 0.162883237f},
-std::array<float,2>{0.0130038243f, 0.525493622f},
-std::array<float,2>{0.63790375f, 0.477852464f},
-std::array<float,2>{0.540918112f, 0.721270859f},
-std::array<float,2>{0.203588411f, 0.264386117f},
-std::array<float,2>{0.357742816f, 0.8016783f},
-std::array<float,2>{0.783982933f, 0.0229278821f},
-std::array<float,2>{0.719015658f, 0.863740206f},
-std::array<float,2>{0.106547557f, 0.0640934035f},
-std::array<float,2>{0.482648045f, 0.656813383f},
-std::array<float,2>{0.875635386f, 0.333001733f},
-std::array<float,2>{0.866408944f, 0.618305206f},
-std::array<float,2>{0.277558684f, 0.395679176f},
-std::array<float,2>{0.168196619f, 0.927860498f},
-std::array<float,2>{0.608005941f, 0.200371325f},
-std::array<float,2>{0.761346579f, 0.750114381f},
-std::array<float,2>{0.334782988f, 0.0569377504f},
-std::array<float,2>{0.234180376f, 0.701082647f},
-std::array<float,2>{0.528239429f, 0.288080156f},
-std::array<float,2>{0.685845017f, 0.562262356f},
-std::array<float,2>{0.039901942f, 0.465122968f},
-std::array<float,2>{0.381526977f, 0.995872736f},
-std::array<float,2>{0.969720542f, 0.128799558f},
-std::array<float,2>{0.570344269f, 0.881390154f},
-std::array<float,2>{0.143797144f, 0.231969655f},
-std::array<float,2>{0.302568346f, 0.574042618f},
-std::array<float,2>{0.821401656f, 0.413609147f},
-std::array<float,2>{0.926392138f, 0.632929385f},
-std::array<float,2>{0.458660245f, 0.352203071f},
-std::array<float,2>{0.0842145607f, 0.828943193f},
-std::array<float,2>{0.691258848f, 0.103231236f},
-std::array<float,2>{0.904564619f, 0.824316204f},
-std::array<float,2>{0.49946478f, 0.116117798f},
-std::array<float,2>{0.116370827f, 0.642028928f},
-std::array<float,2>{0.739812195f, 0.373769313f},
-std::array<float,2>{0.617384553f, 0.581714213f},
-std::array<float,2>{0.182791412f, 0.432682902f},
-std::array<float,2>{0.264178336f, 0.902732372f},
-std::array<float,2>{0.849982619f, 0.24733533f},
-std::array<float,2>{0.648704529f, 0.975078762f},
-std::array<float,2>{0.0245195888f, 0.142873317f},
-std::array<float,2>{0.410166144f, 0.533421099f},
-std::array<float,2>{0.964902163f, 0.441220254f},
-std::array<float,2>{0.801756978f, 0.713739991f},
-std::array<float,2>{0.368010521f, 0.309308052f},
-std::array<float,2>{0.189403951f, 0.767182946f},
-std::array<float,2>{0.554562271f, 0.0342990607f},
-std::array<float,2>{0.833477974f, 0.914711356f},
-std::array<float,2>{0.287825942f, 0.205912426f},
-std::array<float,2>{0.138709053f, 0.603006899f},
-std::array<float,2>{0.588280916f, 0.383330226f},
-std::array<float,2>{0.705580294f, 0.672198474f},
-std::array<float,2>{0.0755077526f, 0.313662052f},
-std::array<float,2>{0.442369103f, 0.855847239f},
-std::array<float,2>{0.907079577f, 0.0844965056f},
-std::array<float,2>{0.505147576f, 0.787225127f},
-std::array<float,2>{0.245754048f, 0.000889035931f},
-std::array<float,2>{0.323800683f, 0.748652995f},
-std::array<float,2>{0.769503117f, 0.268501371f},
-std::array<float,2>{0.984622777f, 0.510678113f},
-std::array<float,2>{0.404737592f, 0.488703996f},
-std::array<float,2>{0.0508037768f, 0.943377078f},
-std::array<float,2>{0.65747726f, 0.178394064f},
-std::array<float,2>{0.912864804f, 0.989361107f},
-std::array<float,2>{0.439444512f, 0.14029409f},
-std::array<float,2>{0.0723647624f, 0.54845494f},
-std::array<float,2>{0.71013546f, 0.456876993f},
-std::array<float,2>{0.592415273f, 0.694576442f},
-std::array<float,2>{0.133262992f, 0.296167105f},
-std::array<float,2>{0.28152591f, 0.764958262f},
-std::array<float,2>{0.82859081f, 0.0469436347f},
-std::array<float,2>{0.661903262f, 0.839580774f},
-std::array<float,2>{0.0477460697f, 0.0987304673f},
-std::array<float,2>{0.400453389f, 0.630333841f},
-std::array<float,2>{0.989389539f, 0.351076156f},
-std::array<float,2>{0.773192525f, 0.567342758f},
-std::array<float,2>{0.327519596f, 0.420563996f},
-std::array<float,2>{0.246694416f, 0.888677359f},
-std::array<float,2>{0.502359331f, 0.223091885f},
-std::array<float,2>{0.845168412f, 0.80584389f},
-std::array<float,2>{0.259189487f, 0.0293675251f},
-std::array<float,2>{0.184438363f, 0.728520989f},
-std::array<float,2>{0.623497665f, 0.254184097f},
-std::array<float,2>{0.737729907f, 0.522114336f},
-std::array<float,2>{0.111664146f, 0.47064203f},
-std::array<float,2>{0.494779557f, 0.959834814f},
-std::array<float,2>{0.89911598f, 0.169863433f},
-std::array<float,2>{0.548642635f, 0.933605969f},
-std::array<float,2>{0.193179414f, 0.190287769f},
-std::array<float,2>{0.371428043f, 0.617102265f},
-std::array<float,2>{0.797384679f, 0.399289936f},
-std::array<float,2>{0.964807928f, 0.665170848f},
-std::array<float,2>{0.409116745f, 0.343301028f},
-std::array<float,2>{0.0307149813f, 0.867260158f},
-std::array<float,2>{0.654941261f, 0.0777755901f},
-std::array<float,2>{0.975948453f, 0.84834218f},
-std::array<float,2>{0.376820654f, 0.0917289928f},
-std::array<float,2>{0.0466260165f, 0.686166406f},
-std::array<float,2>{0.680329502f, 0.327406943f},
-std::array<float,2>{0.526542068f, 0.597034514f},
-std::array<float,2>{0.226686954f, 0.382045269f},
-std::array<float,2>{0.330133259f, 0.914031804f},
-std::array<float,2>{0.762666166f, 0.214784369f},
-std::array<float,2>{0.691954792f, 0.952531338f},
-std::array<float,2>{0.0819310695f, 0.184248894f},
-std::array<float,2>{0.455878258f, 0.505642653f},
-std::array<float,2>{0.925054371f, 0.49908188f},
-std::array<float,2>{0.824520707f, 0.73950547f},
-std::array<float,2>{0.300529599f, 0.277634591f},
-std::array<float,2>{0.146996185f, 0.794037819f},
-std::array<float,2>{0.575322092f, 0.0111838318f},
-std::array<float,2>{0.787747622f, 0.892986f},
-std::array<float,2>{0.352130532f, 0.241802871f},
-std::array<float,2>{0.208865434f, 0.592058778f},
-std::array<float,2>{0.545020282f, 0.424694598f},
-std::array<float,2>{0.635851264f, 0.652940691f},
-std::array<float,2>{0.00928273425f, 0.361463577f},
-std::array<float,2>{0.42610231f, 0.81354481f},
-std::array<float,2>{0.944053292f, 0.119722649f},
-std::array<float,2>{0.604999542f, 0.778424799f},
-std::array<float,2>{0.167924732f, 0.0443235897f},
-std::array<float,2>{0.276426107f, 0.705858767f},
-std::array<float,2>{0.860360801f, 0.303817004f},
-std::array<float,2>{0.882155657f, 0.54542762f},
-std::array<float,2>{0.480080366f, 0.449999988f},
-std::array<float,2>{0.10515596f, 0.979028761f},
-std::array<float,2>{0.725960374f, 0.149247795f},
-std::array<float,2>{0.948156536f, 0.919648945f},
-std::array<float,2>{0.429842472f, 0.21070379f},
-std::array<float,2>{0.000670822861f, 0.607327044f},
-std::array<float,2>{0.626008689f, 0.389282852f},
-std::array<float,2>{0.535808444f, 0.675882638f},
-std::array<float,2>{0.211478606f, 0.317048609f},
-std::array<float,2>{0.348664641f, 0.852911711f},
-std::array<float,2>{0.790274203f, 0.0805136561f},
-std::array<float,2>{0.732895494f, 0.785080969f},
-std::array<float,2>{0.100211158f, 0.00479336502f},
-std::array<float,2>{0.475018054f, 0.7431373f},
-std::array<float,2>{0.888912678f, 0.270956814f},
-std::array<float,2>{0.869503081f, 0.512049735f},
-std::array<float,2>{0.270764768f, 0.486020327f},
-std::array<float,2>{0.162804663f, 0.941196501f},
-std::array<float,2>{0.5959512f, 0.172697216f},
-std::array<float,2>{0.753851891f, 0.821207047f},
-std::array<float,2>{0.340538144f, 0.112803303f},
-std::array<float,2>{0.224679694f, 0.645334303f},
-std::array<float,2>{0.51794827f, 0.370353937f},
-std::array<float,2>{0.679450035f, 0.582104385f},
-std::array<float,2>{0.0387798697f, 0.433733225f},
-std::array<float,2>{0.389299601f, 0.901442289f},
-std::array<float,2>{0.976994753f, 0.24512893f},
-std::array<float,2>{0.567281008f, 0.969945431f},
-std::array<float,2>{0.153028339f, 0.146880448f},
-std::array<float,2>{0.305610597f, 0.53538847f},
-std::array<float,2>{0.816048145f, 0.444535017f},
-std::array<float,2>{0.936249316f, 0.715819001f},
-std::array<float,2>{0.461549908f, 0.306995839f},
-std::array<float,2>{0.0934318081f, 0.77070123f},
-std::array<float,2>{0.702830315f, 0.0362777412f},
-std::array<float,2>{0.892907858f, 0.75458616f},
-std::array<float,2>{0.487252891f, 0.0619862415f},
-std::array<float,2>{0.119609095f, 0.697463512f},
-std::array<float,2>{0.743287385f, 0.284593135f},
-std::array<float,2>{0.609444618f, 0.55573529f},
-std::array<float,2>{0.178246289f, 0.46127829f},
-std::array<float,2>{0.256309897f, 0.996891737f},
-std::array<float,2>{0.858180463f, 0.132025495f},
-std::array<float,2>{0.643078625f, 0.875927925f},
-std::array<float,2>{0.0230828449f, 0.229176462f},
-std::array<float,2>{0.416704834f, 0.574869514f},
-std::array<float,2>{0.955765009f, 0.409672499f},
-std::array<float,2>{0.809339941f, 0.637706459f},
-std::array<float,2>{0.3670834f, 0.357400447f},
-std::array<float,2>{0.202709839f, 0.832939863f},
-std::array<float,2>{0.556580067f, 0.106774762f},
-std::array<float,2>{0.842772365f, 0.965313077f},
-std::array<float,2>{0.289456993f, 0.158785716f},
-std::array<float,2>{0.126832828f, 0.530114889f},
-std::array<float,2>{0.583407164f, 0.484049946f},
-std::array<float,2>{0.714592576f, 0.726547778f},
-std::array<float,2>{0.0661937669f, 0.261023641f},
-std::array<float,2>{0.446398348f, 0.798102021f},
-std::array<float,2>{0.917747557f, 0.0177726131f},
-std::array<float,2>{0.512522757f, 0.859456599f},
-std::array<float,2>{0.241248921f, 0.0701419562f},
-std::array<float,2>{0.317863792f, 0.661319315f},
-std::array<float,2>{0.777388692f, 0.33091712f},
-std::array<float,2>{0.996631503f, 0.622507989f},
-std::array<float,2>{0.394302011f, 0.392724335f},
-std::array<float,2>{0.0614373125f, 0.924906671f},
-std::array<float,2>{0.664375901f, 0.1960724f},
-std::array<float,2>{0.882997036f, 0.883191228f},
-std::array<float,2>{0.469386011f, 0.220159188f},
-std::array<float,2>{0.0973099172f, 0.565846503f},
-std::array<float,2>{0.729075313f, 0.416380823f},
-std::array<float,2>{0.600641549f, 0.627640009f},
-std::array<float,2>{0.156411201f, 0.347299069f},
-std::array<float,2>{0.266624272f, 0.843536198f},
-std::array<float,2>{0.872509181f, 0.0938391536f},
-std::array<float,2>{0.630180001f, 0.759877026f},
-std::array<float,2>{0.00599294482f, 0.0519151017f},
-std::array<float,2>{0.436339945f, 0.689993382f},
-std::array<float,2>{0.953076601f, 0.291263044f},
-std::array<float,2>{0.795971096f, 0.55384016f},
-std::array<float,2>{0.34435761f, 0.460812956f},
-std::array<float,2>{0.216892868f, 0.984828472f},
-std::array<float,2>{0.534879863f, 0.136003703f},
-std::array<float,2>{0.816427767f, 0.874065638f},
-std::array<float,2>{0.310424626f, 0.0720460713f},
-std::array<float,2>{0.149569675f, 0.671647608f},
-std::array<float,2>{0.564495504f, 0.338283211f},
-std::array<float,2>{0.695974529f, 0.610349238f},
-std::array<float,2>{0.0864923522f, 0.402635694f},
-std::array<float,2>{0.465028077f, 0.931509137f},
-std::array<float,2>{0.932758152f, 0.193147033f},
-std::array<float,2>{0.520634711f, 0.95674324f},
-std::array<float,2>{0.221665323f, 0.167815387f},
-std::array<float,2>{0.337109178f, 0.518547356f},
-std::array<float,2>{0.756489635f, 0.475117296f},
-std::array<float,2>{0.982769251f, 0.732327759f},
-std::array<float,2>{0.384537667f, 0.251639307f},
-std::array<float,2>{0.033767648f, 0.811209679f},
-std::array<float,2>{0.671889544f, 0.0253578946f},
-std::array<float,2>{0.957751036f, 0.790462255f},
-std::array<float,2>{0.419185042f, 0.0130810319f},
-std::array<float,2>{0.0162723027f, 0.737256289f},
-std::array<float,2>{0.645020545f, 0.274836451f},
-std::array<float,2>{0.56038636f, 0.500420034f},
-std::array<float,2>{0.196879402f, 0.493001074f},
-std::array<float,2>{0.362592727f, 0.948130786f},
-std::array<float,2>{0.807647705f, 0.182398379f},
-std::array<float,2>{0.748600781f, 0.909495056f},
-std::array<float,2>{0.123926699f, 0.218651503f},
-std::array<float,2>{0.488442868f, 0.597864687f},
-std::array<float,2>{0.896877348f, 0.378570676f},
-std::array<float,2>{0.855275333f, 0.682060182f},
-std::array<float,2>{0.250111192f, 0.321845114f},
-std::array<float,2>{0.174583286f, 0.844718933f},
-std::array<float,2>{0.61469388f, 0.088238515f},
-std::array<float,2>{0.776170373f, 0.981047392f},
-std::array<float,2>{0.313685477f, 0.152364314f},
-std::array<float,2>{0.235198393f, 0.539941132f},
-std::array<float,2>{0.511645734f, 0.449032634f},
-std::array<float,2>{0.668908536f, 0.707710862f},
-std::array<float,2>{0.0575887673f, 0.299245387f},
-std::array<float,2>{0.39658311f, 0.776901722f},
-std::array<float,2>{0.992800355f, 0.0400772803f},
-std::array<float,2>{0.579161704f, 0.818002164f},
-std::array<float,2>{0.130833969f, 0.122666404f},
-std::array<float,2>{0.294265121f, 0.651607752f},
-std::array<float,2>{0.839480102f, 0.363612711f},
-std::array<float,2>{0.919312239f, 0.588015616f},
-std::array<float,2>{0.451507002f, 0.428151906f},
-std::array<float,2>{0.0678297654f, 0.897298634f},
-std::array<float,2>{0.716386437f, 0.236537576f},
-std::array<float,2>{0.988120735f, 0.944678128f},
-std::array<float,2>{0.403824985f, 0.179651186f},
-std::array<float,2>{0.0530128144f, 0.510783255f},
-std::array<float,2>{0.658861339f, 0.489688575f},
-std::array<float,2>{0.507436216f, 0.749173701f},
-std::array<float,2>{0.243198067f, 0.268949389f},
-std::array<float,2>{0.320857108f, 0.788306296f},
-std::array<float,2>{0.767181456f, 0.00181272917f},
-std::array<float,2>{0.70326364f, 0.857396126f},
-std::array<float,2>{0.0762535408f, 0.0854104683f},
-std::array<float,2>{0.444809645f, 0.672873795f},
-std::array<float,2>{0.910092413f, 0.313020498f},
-std::array<float,2>{0.834195971f, 0.602397144f},
-std::array<float,2>{0.285755008f, 0.383996606f},
-std::array<float,2>{0.137280107f, 0.91576004f},
-std::array<float,2>{0.586641788f, 0.206070006f},
-std::array<float,2>{0.803500891f, 0.766253769f},
-std::array<float,2>{0.37081176f, 0.0332299247f},
-std::array<float,2>{0.190015554f, 0.714758694f},
-std::array<float,2>{0.551771164f, 0.309583217f},
-std::array<float,2>{0.650676012f, 0.535037518f},
-std::array<float,2>{0.0258321892f, 0.440357476f},
-std::array<float,2>{0.413683176f, 0.975602806f},
-std::array<float,2>{0.967008412f, 0.143907383f},
-std::array<float,2>{0.620354772f, 0.904100716f},
-std::array<float,2>{0.180525094f, 0.246981487f},
-std::array<float,2>{0.262166023f, 0.580132782f},
-std::array<float,2>{0.848074317f, 0.432299882f},
-std::array<float,2>{0.903300345f, 0.640961349f},
-std::array<float,2>{0.496148527f, 0.374836057f},
-std::array<float,2>{0.113801822f, 0.825702786f},
-std::array<float,2>{0.740623474f, 0.116555087f},
-std::array<float,2>{0.929145515f, 0.829721093f},
-std::array<float,2>{0.459592313f, 0.101584926f},
-std::array<float,2>{0.0829349607f, 0.634036183f},
-std::array<float,2>{0.687630117f, 0.35341537f},
-std::array<float,2>{0.574007571f, 0.573171258f},
-std::array<float,2>{0.142048255f, 0.412286758f},
-std::array<float,2>{0.303659737f, 0.882229388f},
-std::array<float,2>{0.823002338f, 0.230752379f},
-std::array<float,2>{0.683695078f, 0.994874775f},
-std::array<float,2>{0.0412313826f, 0.127769843f},
-std::array<float,2>{0.379263163f, 0.560557127f},
-std::array<float,2>{0.972211778f, 0.466161877f},
-std::array<float,2>{0.758155823f, 0.700059414f},
-std::array<float,2>{0.332576305f, 0.288912714f},
-std::array<float,2>{0.232255191f, 0.751342952f},
-std::array<float,2>{0.531190753f, 0.0585250594f},
-std::array<float,2>{0.86330682f, 0.929071367f},
-std::array<float,2>{0.280723542f, 0.199860215f},
-std::array<float,2>{0.171263695f, 0.618123353f},
-std::array<float,2>{0.606311798f, 0.394808769f},
-std::array<float,2>{0.721952438f, 0.657358587f},
-std::array<float,2>{0.108705871f, 0.333356291f},
-std::array<float,2>{0.48057124f, 0.864713192f},
-std::array<float,2>{0.877793849f, 0.0633790046f},
-std::array<float,2>{0.541994274f, 0.802463591f},
-std::array<float,2>{0.206329674f, 0.0215325262f},
-std::array<float,2>{0.355478615f, 0.721946657f},
-std::array<float,2>{0.783081949f, 0.265572876f},
-std::array<float,2>{0.938887715f, 0.526946247f},
-std::array<float,2>{0.422875047f, 0.476786733f},
-std::array<float,2>{0.0154258041f, 0.964536071f},
-std::array<float,2>{0.639124691f, 0.163157165f},
-std::array<float,2>{0.901060939f, 0.958210349f},
-std::array<float,2>{0.492195755f, 0.170565292f},
-std::array<float,2>{0.11079599f, 0.519730747f},
-std::array<float,2>{0.734719455f, 0.471041113f},
-std::array<float,2>{0.622019291f, 0.727016985f},
-std::array<float,2>{0.187093079f, 0.256990403f},
-std::array<float,2>{0.259813309f, 0.808118343f},
-std::array<float,2>{0.846840799f, 0.0284686033f},
-std::array<float,2>{0.652392685f, 0.869302869f},
-std::array<float,2>{0.0292586721f, 0.0761563107f},
-std::array<float,2>{0.407723993f, 0.666042507f},
-std::array<float,2>{0.962063074f, 0.340094894f},
-std::array<float,2>{0.799589694f, 0.614769816f},
-std::array<float,2>{0.374006152f, 0.400531411f},
-std::array<float,2>{0.195117474f, 0.937331676f},
-std::array<float,2>{0.549213648f, 0.188174993f},
-std::array<float,2>{0.831939459f, 0.762324631f},
-std::array<float,2>{0.284458667f, 0.0492866896f},
-std::array<float,2>{0.135677025f, 0.692320287f},
-std::array<float,2>{0.59102875f, 0.294101089f},
-std::array<float,2>{0.707096756f, 0.549943566f},
-std::array<float,2>{0.0716402382f, 0.454028338f},
-std::array<float,2>{0.440569043f, 0.991317749f},
-std::array<float,2>{0.911887944f, 0.137634009f},
-std::array<float,2>{0.501079917f, 0.888436675f},
-std::array<float,2>{0.249927804f, 0.225396767f},
-std::array<float,2>{0.324429095f, 0.569934905f},
-std::array<float,2>{0.769756734f, 0.418036044f},
-std::array<float,2>{0.9909603f, 0.631230295f},
-std::array<float,2>{0.398887366f, 0.348856658f},
-std::array<float,2>{0.0507058054f, 0.837434411f},
-std::array<float,2>{0.663083673f, 0.0999108478f},
-std::array<float,2>{0.942181349f, 0.816262782f},
-std::array<float,2>{0.427973151f, 0.118798681f},
-std::array<float,2>{0.00990110729f, 0.655176163f},
-std::array<float,2>{0.633244395f, 0.359447479f},
-std::array<float,2>{0.54448694f, 0.591338456f},
-std::array<float,2>{0.210616797f, 0.422033608f},
-std::array<float,2>{0.355213761f, 0.891747475f},
-std::array<float,2>{0.786338747f, 0.239993781f},
-std::array<float,2>{0.723414958f, 0.97694993f},
-std::array<float,2>{0.101692908f, 0.151419804f},
-std::array<float,2>{0.47724393f, 0.544416547f},
-std::array<float,2>{0.879536569f, 0.452051401f},
-std::array<float,2>{0.861468375f, 0.704904258f},
-std::array<float,2>{0.273917586f, 0.301115662f},
-std::array<float,2>{0.164662406f, 0.780200362f},
-std::array<float,2>{0.602759421f, 0.0457523242f},
-std::array<float,2>{0.764651f, 0.911372125f},
-std::array<float,2>{0.328507274f, 0.212255388f},
-std::array<float,2>{0.229637265f, 0.59455359f},
-std::array<float,2>{0.524129868f, 0.380247116f},
-std::array<float,2>{0.683559537f, 0.683617055f},
-std::array<float,2>{0.0440352447f, 0.326007724f},
-std::array<float,2>{0.378855795f, 0.850040197f},
-std::array<float,2>{0.974549115f, 0.0918348059f},
-std::array<float,2>{0.577076972f, 0.795238972f},
-std::array<float,2>{0.146242753f, 0.00933711883f},
-std::array<float,2>{0.298361331f, 0.741808057f},
-std::array<float,2>{0.827469349f, 0.279457033f},
-std::array<float,2>{0.921996474f, 0.507680416f},
-std::array<float,2>{0.453337818f, 0.497340411f},
-std::array<float,2>{0.0792046562f, 0.950654328f},
-std::array<float,2>{0.694618285f, 0.185933694f},
-std::array<float,2>{0.979673266f, 0.8991763f},
-std::array<float,2>{0.387888998f, 0.242359519f},
-std::array<float,2>{0.0365469046f, 0.584235489f},
-std::array<float,2>{0.676527321f, 0.436148614f},
-std::array<float,2>{0.515798271f, 0.646543801f},
-std::array<float,2>{0.223610729f, 0.368539423f},
-std::array<float,2>{0.34266758f, 0.822639048f},
-std::array<float,2>{0.751530409f, 0.111062147f},
-std::array<float,2>{0.700775027f, 0.773391604f},
-std::array<float,2>{0.091099225f, 0.037112277f},
-std::array<float,2>{0.463571757f, 0.718625128f},
-std::array<float,2>{0.934460104f, 0.306446046f},
-std::array<float,2>{0.814106166f, 0.537679017f},
-std::array<float,2>{0.308563888f, 0.441501111f},
-std::array<float,2>{0.154448196f, 0.97087127f},
-std::array<float,2>{0.569176972f, 0.146125853f},
-std::array<float,2>{0.791574001f, 0.854254723f},
-std::array<float,2>{0.350817561f, 0.0797082484f},
-std::array<float,2>{0.213700697f, 0.678475142f},
-std::array<float,2>{0.538642347f, 0.319730699f},
-std::array<float,2>{0.628118277f, 0.60743773f},
-std::array<float,2>{0.00239530043f, 0.387919962f},
-std::array<float,2>{0.431933463f, 0.919927955f},
-std::array<float,2>{0.945811987f, 0.208927602f},
-std::array<float,2>{0.594797075f, 0.938804924f},
-std::array<float,2>{0.160705522f, 0.174493626f},
-std::array<float,2>{0.272857159f, 0.51537019f},
-std::array<float,2>{0.867541432f, 0.48812145f},
-std::array<float,2>{0.888270855f, 0.745253563f},
-std::array<float,2>{0.474456906f, 0.27175808f},
-std::array<float,2>{0.0978346169f, 0.78317827f},
-std::array<float,2>{0.730905354f, 0.00763591193f},
-std::array<float,2>{0.914164305f, 0.79913044f},
-std::array<float,2>{0.448079586f, 0.0163288116f},
-std::array<float,2>{0.0637185425f, 0.722819686f},
-std::array<float,2>{0.712143838f, 0.257839471f},
-std::array<float,2>{0.584588051f, 0.528548956f},
-std::array<float,2>{0.128460065f, 0.481395602f},
-std::array<float,2>{0.292625695f, 0.968679547f},
-std::array<float,2>{0.840663731f, 0.158197597f},
-std::array<float,2>{0.66718477f, 0.922774017f},
-std::array<float,2>{0.0593346506f, 0.197641686f},
-std::array<float,2>{0.392300665f, 0.623246372f},
-std::array<float,2>{0.998623013f, 0.391001582f},
-std::array<float,2>{0.780449748f, 0.662658155f},
-std::array<float,2>{0.318378806f, 0.329279095f},
-std::array<float,2>{0.238391176f, 0.861620963f},
-std::array<float,2>{0.514621973f, 0.067799978f},
-std::array<float,2>{0.856988549f, 0.999418795f},
-std::array<float,2>{0.255265057f, 0.1302488f},
-std::array<float,2>{0.176509917f, 0.5572474f},
-std::array<float,2>{0.613143325f, 0.46347025f},
-std::array<float,2>{0.746007621f, 0.696712196f},
-std::array<float,2>{0.117390163f, 0.282043248f},
-std::array<float,2>{0.485822469f, 0.756643236f},
-std::array<float,2>{0.891569495f, 0.0601127669f},
-std::array<float,2>{0.557395875f, 0.835305274f},
-std::array<float,2>{0.20066157f, 0.107596599f},
-std::array<float,2>{0.364389122f, 0.638886988f},
-std::array<float,2>{0.811504543f, 0.358315766f},
-std::array<float,2>{0.953805923f, 0.576427042f},
-std::array<float,2>{0.415649861f, 0.408004284f},
-std::array<float,2>{0.0213135052f, 0.877075553f},
-std::array<float,2>{0.641217291f, 0.228417322f},
-std::array<float,2>{0.931428671f, 0.933400631f},
-std::array<float,2>{0.467697114f, 0.195076406f},
-std::array<float,2>{0.0892432928f, 0.611328483f},
-std::array<float,2>{0.698743105f, 0.405615956f},
-std::array<float,2>{0.562578082f, 0.669190347f},
-std::array<float,2>{0.151693389f, 0.336134434f},
-std::array<float,2>{0.310890615f, 0.87263447f},
-std::array<float,2>{0.819072187f, 0.0725169703f},
-std::array<float,2>{0.673977971f, 0.809102535f},
-std::array<float,2>{0.0326536261f, 0.0262245238f},
-std::array<float,2>{0.386340618f, 0.733798146f},
-std::array<float,2>{0.981915474f, 0.252722293f},
-std::array<float,2>{0.754030466f, 0.516270936f},
-std::array<float,2>{0.337913066f, 0.472832769f},
-std::array<float,2>{0.219471917f, 0.95354408f},
-std::array<float,2>{0.523359954f, 0.164256349f},
-std::array<float,2>{0.873377562f, 0.841773868f},
-std::array<float,2>{0.268068552f, 0.0970003903f},
-std::array<float,2>{0.158534914f, 0.625074923f},
-std::array<float,2>{0.598392487f, 0.34562555f},
-std::array<float,2>{0.727402627f, 0.564330339f},
-std::array<float,2>{0.0951035395f, 0.415439099f},
-std::array<float,2>{0.471253574f, 0.885361969f},
-std::array<float,2>{0.886128664f, 0.220823079f},
-std::array<float,2>{0.532689691f, 0.988051295f},
-std::array<float,2>{0.215367168f, 0.134259656f},
-std::array<float,2>{0.34651643f, 0.552283943f},
-std::array<float,2>{0.793064952f, 0.457964569f},
-std::array<float,2>{0.950528443f, 0.688287616f},
-std::array<float,2>{0.435108274f, 0.290304303f},
-std::array<float,2>{0.00517613767f, 0.759172738f},
-std::array<float,2>{0.631033242f, 0.0539165661f},
-std::array<float,2>{0.995670795f, 0.774839938f},
-std::array<float,2>{0.395841271f, 0.0419570282f},
-std::array<float,2>{0.0557166338f, 0.709406078f},
-std::array<float,2>{0.670154095f, 0.297516108f},
-std::array<float,2>{0.509761035f, 0.542824626f},
-std::array<float,2>{0.236696422f, 0.445511639f},
-std::array<float,2>{0.315342277f, 0.983735919f},
-std::array<float,2>{0.774515927f, 0.154605269f},
-std::array<float,2>{0.717095792f, 0.895673752f},
-std::array<float,2>{0.0689971298f, 0.235775948f},
-std::array<float,2>{0.44928357f, 0.587234914f},
-std::array<float,2>{0.921373844f, 0.427209079f},
-std::array<float,2>{0.837052047f, 0.649823248f},
-std::array<float,2>{0.295894563f, 0.366985202f},
-std::array<float,2>{0.132779881f, 0.819556832f},
-std::array<float,2>{0.580486536f, 0.124557346f},
-std::array<float,2>{0.806245089f, 0.946521699f},
-std::array<float,2>{0.359815419f, 0.18096751f},
-std::array<float,2>{0.198968813f, 0.50205797f},
-std::array<float,2>{0.56143415f, 0.494780481f},
-std::array<float,2>{0.646829426f, 0.734844565f},
-std::array<float,2>{0.0194309708f, 0.276305705f},
-std::array<float,2>{0.420096576f, 0.791896403f},
-std::array<float,2>{0.959980071f, 0.0153989587f},
-std::array<float,2>{0.615245998f, 0.847579002f},
-std::array<float,2>{0.172906101f, 0.0859573334f},
-std::array<float,2>{0.253306895f, 0.681042552f},
-std::array<float,2>{0.852459192f, 0.322407693f},
-std::array<float,2>{0.894728482f, 0.600320339f},
-std::array<float,2>{0.491768181f, 0.376140237f},
-std::array<float,2>{0.121499233f, 0.907065034f},
-std::array<float,2>{0.746573091f, 0.215500697f},
-std::array<float,2>{0.966047287f, 0.973624706f},
-std::array<float,2>{0.411804348f, 0.142112836f},
-std::array<float,2>{0.0235398114f, 0.533132017f},
-std::array<float,2>{0.650283635f, 0.438602686f},
-std::array<float,2>{0.553077757f, 0.712352514f},
-std::array<float,2>{0.188383013f, 0.310692698f},
-std::array<float,2>{0.369111031f, 0.767803729f},
-std::array<float,2>{0.80205965f, 0.0315273628f},
-std::array<float,2>{0.739161789f, 0.828111172f},
-std::array<float,2>{0.116202436f, 0.113281719f},
-std::array<float,2>{0.498824894f, 0.644143343f},
-std::array<float,2>{0.905378044f, 0.372629642f},
-std::array<float,2>{0.851281404f, 0.57857877f},
-std::array<float,2>{0.265392184f, 0.430574715f},
-std::array<float,2>{0.182440579f, 0.905219972f},
-std::array<float,2>{0.618879378f, 0.249448091f},
-std::array<float,2>{0.767787755f, 0.786238611f},
-std::array<float,2>{0.322556794f, 0.00324733811f},
-std::array<float,2>{0.244446337f, 0.746354282f},
-std::array<float,2>{0.50415045f, 0.265765667f},
-std::array<float,2>{0.656890094f, 0.50954634f},
-std::array<float,2>{0.0522853136f, 0.491250515f},
-std::array<float,2>{0.406233847f, 0.943270206f},
-std::array<float,2>{0.985618055f, 0.177420303f},
-std::array<float,2>{0.589803398f, 0.91734159f},
-std::array<float,2>{0.139902622f, 0.203133404f},
-std::array<float,2>{0.288403243f, 0.605043113f},
-std::array<float,2>{0.832808912f, 0.386586398f},
-std::array<float,2>{0.907375216f, 0.674099863f},
-std::array<float,2>{0.443142444f, 0.314966351f},
-std::array<float,2>{0.0745988414f, 0.858091772f},
-std::array<float,2>{0.706589341f, 0.0831559077f},
-std::array<float,2>{0.876504958f, 0.866823554f},
-std::array<float,2>{0.484072983f, 0.0658610016f},
-std::array<float,2>{0.10610953f, 0.659112751f},
-std::array<float,2>{0.720187843f, 0.335497409f},
-std::array<float,2>{0.608532429f, 0.620495856f},
-std::array<float,2>{0.169219464f, 0.398044765f},
-std::array<float,2>{0.278871298f, 0.925963283f},
-std::array<float,2>{0.866172731f, 0.203025222f},
-std::array<float,2>{0.637057126f, 0.961945653f},
-std::array<float,2>{0.011774567f, 0.16084756f},
-std::array<float,2>{0.424581379f, 0.524732292f},
-std::array<float,2>{0.941184044f, 0.480071872f},
-std::array<float,2>{0.785080433f, 0.720641315f},
-std::array<float,2>{0.358970225f, 0.262357742f},
-std::array<float,2>{0.204422712f, 0.804213107f},
-std::array<float,2>{0.539210618f, 0.0204748549f},
-std::array<float,2>{0.820806265f, 0.879895568f},
-std::array<float,2>{0.301327407f, 0.233450204f},
-std::array<float,2>{0.142773569f, 0.570637584f},
-std::array<float,2>{0.572084308f, 0.410703421f},
-std::array<float,2>{0.689957023f, 0.635787904f},
-std::array<float,2>{0.0856864974f, 0.354705065f},
-std::array<float,2>{0.457378238f, 0.830743909f},
-std::array<float,2>{0.927471638f, 0.105203144f},
-std::array<float,2>{0.528734505f, 0.751963615f},
-std::array<float,2>{0.233236343f, 0.0560127199f},
-std::array<float,2>{0.335744023f, 0.701992571f},
-std::array<float,2>{0.760659754f, 0.28616938f},
-std::array<float,2>{0.969976485f, 0.560184181f},
-std::array<float,2>{0.382389605f, 0.46792385f},
-std::array<float,2>{0.0407607965f, 0.992925465f},
-std::array<float,2>{0.68710953f, 0.126313403f}}
\ No newline at end of file
@@ -1,4096 +0,0 @@
-{std::array<float,2>{0.347951114f, 0.453733832f},
-std::array<float,2>{0.53040427f, 0.908792317f},
-std::array<float,2>{0.0223909821f, 0.638741016f},
-std::array<float,2>{0.915421009f, 0.160505086f},
-std::array<float,2>{0.153759807f, 0.0812500939f},
-std::array<float,2>{0.828294456f, 0.564702213f},
-std::array<float,2>{0.474954844f, 0.792647302f},
-std::array<float,2>{0.706772149f, 0.285754353f},
-std::array<float,2>{0.382727206f, 0.229818359f},
-std::array<float,2>{0.655521631f, 0.699551463f},
-std::array<float,2>{0.230998784f, 0.987082481f},
-std::array<float,2>{0.75380373f, 0.400542736f},
-std::array<float,2>{0.0843831822f, 0.315675318f},
-std::array<float,2>{0.981140971f, 0.84275353f},
-std::array<float,2>{0.29929018f, 0.558219373f},
-std::array<float,2>{0.590289712f, 0.0484034382f},
-std::array<float,2>{0.444138527f, 0.271137089f},
-std::array<float,2>{0.728380382f, 0.752404213f},
-std::array<float,2>{0.181722388f, 0.617059827f},
-std::array<float,2>{0.848249435f, 0.118675061f},
-std::array<float,2>{0.0481534787f, 0.139636323f},
-std::array<float,2>{0.904597282f, 0.664984047f},
-std::array<float,2>{0.326458991f, 0.902178407f},
-std::array<float,2>{0.55287075f, 0.499152869f},
-std::array<float,2>{0.265585005f, 0.019794479f},
-std::array<float,2>{0.621189415f, 0.501997173f},
-std::array<float,2>{0.113068886f, 0.858773172f},
-std::array<float,2>{0.94163096f, 0.363599986f},
-std::array<float,2>{0.199420035f, 0.432567358f},
-std::array<float,2>{0.783463418f, 0.946910799f},
-std::array<float,2>{0.421964347f, 0.720870495f},
-std::array<float,2>{0.673492372f, 0.213773534f},
-std::array<float,2>{0.295940518f, 0.356572837f},
-std::array<float,2>{0.573233366f, 0.868944228f},
-std::array<float,2>{0.0737235695f, 0.522240758f},
-std::array<float,2>{0.993247807f, 0.0105628427f},
-std::array<float,2>{0.241870269f, 0.200525805f},
-std::array<float,2>{0.766521752f, 0.736402035f},
-std::array<float,2>{0.392591566f, 0.960835636f},
-std::array<float,2>{0.634345174f, 0.412045151f},
-std::array<float,2>{0.490980178f, 0.0952003747f},
-std::array<float,2>{0.698710024f, 0.597081661f},
-std::array<float,2>{0.131659791f, 0.777823091f},
-std::array<float,2>{0.814307034f, 0.254352272f},
-std::array<float,2>{0.00163531583f, 0.46879077f},
-std::array<float,2>{0.927193046f, 0.888018727f},
-std::array<float,2>{0.359739214f, 0.682215273f},
-std::array<float,2>{0.504601479f, 0.148222834f},
-std::array<float,2>{0.421747237f, 0.390221536f},
-std::array<float,2>{0.671276093f, 0.973483682f},
-std::array<float,2>{0.217110023f, 0.707948804f},
-std::array<float,2>{0.80341047f, 0.248070598f},
-std::array<float,2>{0.0951779932f, 0.0415130332f},
-std::array<float,2>{0.964689076f, 0.541473269f},
-std::array<float,2>{0.280274838f, 0.815224111f},
-std::array<float,2>{0.597183228f, 0.334585905f},
-std::array<float,2>{0.33229202f, 0.180378839f},
-std::array<float,2>{0.542993724f, 0.649849474f},
-std::array<float,2>{0.0334890522f, 0.923859954f},
-std::array<float,2>{0.88331306f, 0.445149809f},
-std::array<float,2>{0.162973434f, 0.3085742f},
-std::array<float,2>{0.873912215f, 0.810952306f},
-std::array<float,2>{0.466537267f, 0.585730255f},
-std::array<float,2>{0.744590759f, 0.0729699284f},
-std::array<float,2>{0.269155443f, 0.419142514f},
-std::array<float,2>{0.609191537f, 0.963671923f},
-std::array<float,2>{0.108789951f, 0.745252311f},
-std::array<float,2>{0.954297423f, 0.193631932f},
-std::array<float,2>{0.203296885f, 0.000404151389f},
-std::array<float,2>{0.811897099f, 0.528474092f},
-std::array<float,2>{0.407746017f, 0.865280747f},
-std::array<float,2>{0.656412065f, 0.344865173f},
-std::array<float,2>{0.453221977f, 0.154916584f},
-std::array<float,2>{0.739454091f, 0.676285207f},
-std::array<float,2>{0.168507695f, 0.876292169f},
-std::array<float,2>{0.866576612f, 0.479048699f},
-std::array<float,2>{0.0410947204f, 0.263886511f},
-std::array<float,2>{0.877014399f, 0.771100581f},
-std::array<float,2>{0.339091867f, 0.608594835f},
-std::array<float,2>{0.533891976f, 0.10652604f},
-std::array<float,2>{0.404097468f, 0.338229597f},
-std::array<float,2>{0.630775034f, 0.824164629f},
-std::array<float,2>{0.24833928f, 0.536410153f},
-std::array<float,2>{0.779892445f, 0.0385448113f},
-std::array<float,2>{0.0663447157f, 0.239503011f},
-std::array<float,2>{0.988385439f, 0.714572668f},
-std::array<float,2>{0.285913944f, 0.97890681f},
-std::array<float,2>{0.569750607f, 0.378783911f},
-std::array<float,2>{0.368731558f, 0.0650826097f},
-std::array<float,2>{0.51379621f, 0.591938853f},
-std::array<float,2>{0.0124807339f, 0.799145341f},
-std::array<float,2>{0.937342048f, 0.299498171f},
-std::array<float,2>{0.135718033f, 0.448865235f},
-std::array<float,2>{0.825164497f, 0.933371127f},
-std::array<float,2>{0.499381602f, 0.642528951f},
-std::array<float,2>{0.694941878f, 0.175844714f},
-std::array<float,2>{0.318250358f, 0.295531213f},
-std::array<float,2>{0.559137225f, 0.787025213f},
-std::array<float,2>{0.0567266047f, 0.572667837f},
-std::array<float,2>{0.895287395f, 0.0869452953f},
-std::array<float,2>{0.175018564f, 0.166530728f},
-std::array<float,2>{0.857469022f, 0.631121337f},
-std::array<float,2>{0.448162466f, 0.914886057f},
-std::array<float,2>{0.723687947f, 0.466676742f},
-std::array<float,2>{0.434864432f, 0.0586342253f},
-std::array<float,2>{0.686576724f, 0.551665604f},
-std::array<float,2>{0.193282098f, 0.830325544f},
-std::array<float,2>{0.790244877f, 0.322887897f},
-std::array<float,2>{0.1196163f, 0.392430931f},
-std::array<float,2>{0.947926521f, 0.996602058f},
-std::array<float,2>{0.251373887f, 0.688416302f},
-std::array<float,2>{0.614153445f, 0.226162985f},
-std::array<float,2>{0.484019935f, 0.486823052f},
-std::array<float,2>{0.712521493f, 0.892923594f},
-std::array<float,2>{0.144226402f, 0.663888633f},
-std::array<float,2>{0.841706991f, 0.129380882f},
-std::array<float,2>{0.0291343853f, 0.115237877f},
-std::array<float,2>{0.907137275f, 0.618389785f},
-std::array<float,2>{0.355488062f, 0.760277569f},
-std::array<float,2>{0.519648373f, 0.278518111f},
-std::array<float,2>{0.306131065f, 0.204343989f},
-std::array<float,2>{0.580571294f, 0.726714313f},
-std::array<float,2>{0.0921060294f, 0.938807964f},
-std::array<float,2>{0.973787248f, 0.424240977f},
-std::array<float,2>{0.221299514f, 0.371945828f},
-std::array<float,2>{0.765476942f, 0.850363672f},
-std::array<float,2>{0.387059122f, 0.515073299f},
-std::array<float,2>{0.642913878f, 0.025169393f},
-std::array<float,2>{0.342310101f, 0.406012326f},
-std::array<float,2>{0.538646162f, 0.988689721f},
-std::array<float,2>{0.0433882475f, 0.698619783f},
-std::array<float,2>{0.881625354f, 0.23202762f},
-std::array<float,2>{0.166399777f, 0.051169917f},
-std::array<float,2>{0.863063037f, 0.558967531f},
-std::array<float,2>{0.460188121f, 0.83790499f},
-std::array<float,2>{0.73743695f, 0.319559157f},
-std::array<float,2>{0.410634905f, 0.160010889f},
-std::array<float,2>{0.66117835f, 0.634764731f},
-std::array<float,2>{0.209673405f, 0.911192954f},
-std::array<float,2>{0.807080626f, 0.458227605f},
-std::array<float,2>{0.10357932f, 0.281942517f},
-std::array<float,2>{0.95903784f, 0.794853747f},
-std::array<float,2>{0.273292094f, 0.568123639f},
-std::array<float,2>{0.605302334f, 0.0828035772f},
-std::array<float,2>{0.492987484f, 0.359407544f},
-std::array<float,2>{0.690400958f, 0.854450464f},
-std::array<float,2>{0.13868466f, 0.506532729f},
-std::array<float,2>{0.822312415f, 0.0180536583f},
-std::array<float,2>{0.00933696236f, 0.217332602f},
-std::array<float,2>{0.930565834f, 0.72375375f},
-std::array<float,2>{0.373097688f, 0.950133979f},
-std::array<float,2>{0.508280933f, 0.434594333f},
-std::array<float,2>{0.284887463f, 0.121712312f},
-std::array<float,2>{0.565627813f, 0.609573722f},
-std::array<float,2>{0.0696273223f, 0.757121325f},
-std::array<float,2>{0.984780431f, 0.26759401f},
-std::array<float,2>{0.243728086f, 0.493620694f},
-std::array<float,2>{0.7771492f, 0.903729975f},
-std::array<float,2>{0.399375468f, 0.670534551f},
-std::array<float,2>{0.628747344f, 0.135606751f},
-std::array<float,2>{0.257037163f, 0.250741154f},
-std::array<float,2>{0.611707151f, 0.774862707f},
-std::array<float,2>{0.122649223f, 0.598105788f},
-std::array<float,2>{0.949377298f, 0.10010121f},
-std::array<float,2>{0.188985258f, 0.143652245f},
-std::array<float,2>{0.793335855f, 0.686903894f},
-std::array<float,2>{0.430132329f, 0.884630382f},
-std::array<float,2>{0.680334926f, 0.475129634f},
-std::array<float,2>{0.450947732f, 0.0134446602f},
-std::array<float,2>{0.722574413f, 0.518596351f},
-std::array<float,2>{0.177435488f, 0.872759461f},
-std::array<float,2>{0.852600336f, 0.352779031f},
-std::array<float,2>{0.0600160509f, 0.409630716f},
-std::array<float,2>{0.893748522f, 0.95546186f},
-std::array<float,2>{0.314425588f, 0.74179548f},
-std::array<float,2>{0.556083322f, 0.198233485f},
-std::array<float,2>{0.38607192f, 0.438927472f},
-std::array<float,2>{0.645381033f, 0.925945699f},
-std::array<float,2>{0.222674757f, 0.655631304f},
-std::array<float,2>{0.759041846f, 0.186322555f},
-std::array<float,2>{0.0894505754f, 0.0750484839f},
-std::array<float,2>{0.97206074f, 0.580526888f},
-std::array<float,2>{0.310962856f, 0.805059493f},
-std::array<float,2>{0.584114075f, 0.311230004f},
-std::array<float,2>{0.354589224f, 0.245853737f},
-std::array<float,2>{0.519042552f, 0.704640508f},
-std::array<float,2>{0.0246606879f, 0.970852137f},
-std::array<float,2>{0.910187721f, 0.384029835f},
-std::array<float,2>{0.146971241f, 0.328373313f},
-std::array<float,2>{0.837773025f, 0.819880784f},
-std::array<float,2>{0.477042943f, 0.546667337f},
-std::array<float,2>{0.716151774f, 0.0439061634f},
-std::array<float,2>{0.301132739f, 0.480657816f},
-std::array<float,2>{0.587827742f, 0.88229084f},
-std::array<float,2>{0.0789806917f, 0.674160182f},
-std::array<float,2>{0.97734499f, 0.148941711f},
-std::array<float,2>{0.227406964f, 0.105414525f},
-std::array<float,2>{0.757676482f, 0.604821682f},
-std::array<float,2>{0.375959605f, 0.768516123f},
-std::array<float,2>{0.648687243f, 0.260151148f},
-std::array<float,2>{0.46980837f, 0.188979656f},
-std::array<float,2>{0.710294306f, 0.747860193f},
-std::array<float,2>{0.151486918f, 0.964946568f},
-std::array<float,2>{0.833773375f, 0.415237695f},
-std::array<float,2>{0.0193214715f, 0.349680096f},
-std::array<float,2>{0.921243906f, 0.861653686f},
-std::array<float,2>{0.346271455f, 0.526671946f},
-std::array<float,2>{0.523783863f, 0.00652778754f},
-std::array<float,2>{0.42961657f, 0.301548153f},
-std::array<float,2>{0.676754117f, 0.804216743f},
-std::array<float,2>{0.19612731f, 0.589751959f},
-std::array<float,2>{0.788174391f, 0.0687253475f},
-std::array<float,2>{0.116800338f, 0.172307193f},
-std::array<float,2>{0.938161433f, 0.647940695f},
-std::array<float,2>{0.261339456f, 0.934643388f},
-std::array<float,2>{0.61778307f, 0.451365888f},
-std::array<float,2>{0.323074162f, 0.0328589566f},
-std::array<float,2>{0.549574196f, 0.532660604f},
-std::array<float,2>{0.0537719913f, 0.824328482f},
-std::array<float,2>{0.900956273f, 0.343720853f},
-std::array<float,2>{0.185158014f, 0.38138783f},
-std::array<float,2>{0.845440984f, 0.984290242f},
-std::array<float,2>{0.440364838f, 0.715845108f},
-std::array<float,2>{0.732835412f, 0.238093972f},
-std::array<float,2>{0.366311193f, 0.32776013f},
-std::array<float,2>{0.503506601f, 0.832753062f},
-std::array<float,2>{0.00751882978f, 0.550378144f},
-std::array<float,2>{0.922565877f, 0.0568598472f},
-std::array<float,2>{0.128386557f, 0.221578285f},
-std::array<float,2>{0.81983453f, 0.693363011f},
-std::array<float,2>{0.487028778f, 0.993973792f},
-std::array<float,2>{0.700566947f, 0.397801787f},
-std::array<float,2>{0.395573407f, 0.0910667628f},
-std::array<float,2>{0.639825284f, 0.57489109f},
-std::array<float,2>{0.234499469f, 0.783087671f},
-std::array<float,2>{0.770183921f, 0.290995717f},
-std::array<float,2>{0.0760149881f, 0.461986601f},
-std::array<float,2>{0.999604285f, 0.919845462f},
-std::array<float,2>{0.292491525f, 0.628296316f},
-std::array<float,2>{0.575163424f, 0.169044182f},
-std::array<float,2>{0.46354875f, 0.426739842f},
-std::array<float,2>{0.746549308f, 0.941454947f},
-std::array<float,2>{0.156721234f, 0.731633484f},
-std::array<float,2>{0.86781913f, 0.207490921f},
-std::array<float,2>{0.037431445f, 0.0294292122f},
-std::array<float,2>{0.888308108f, 0.50878644f},
-std::array<float,2>{0.331619471f, 0.844066501f},
-std::array<float,2>{0.541009247f, 0.370351523f},
-std::array<float,2>{0.275506973f, 0.127469897f},
-std::array<float,2>{0.59906739f, 0.658251286f},
-std::array<float,2>{0.101436749f, 0.898017466f},
-std::array<float,2>{0.967352331f, 0.48837468f},
-std::array<float,2>{0.214459255f, 0.274586558f},
-std::array<float,2>{0.798012257f, 0.762557209f},
-std::array<float,2>{0.417564422f, 0.624287724f},
-std::array<float,2>{0.665330887f, 0.112308338f},
-std::array<float,2>{0.325984478f, 0.496499985f},
-std::array<float,2>{0.551953316f, 0.898803771f},
-std::array<float,2>{0.0489381701f, 0.667629242f},
-std::array<float,2>{0.904167056f, 0.13754259f},
-std::array<float,2>{0.180853367f, 0.120198645f},
-std::array<float,2>{0.850396752f, 0.613647878f},
-std::array<float,2>{0.44141379f, 0.750372887f},
-std::array<float,2>{0.730336189f, 0.273078233f},
-std::array<float,2>{0.425125629f, 0.21134682f},
-std::array<float,2>{0.67407167f, 0.719154477f},
-std::array<float,2>{0.202831447f, 0.947597623f},
-std::array<float,2>{0.783017576f, 0.430622846f},
-std::array<float,2>{0.109774545f, 0.36586982f},
-std::array<float,2>{0.943572462f, 0.856519103f},
-std::array<float,2>{0.262097061f, 0.500365555f},
-std::array<float,2>{0.624088466f, 0.023352446f},
-std::array<float,2>{0.473296344f, 0.287214756f},
-std::array<float,2>{0.704147696f, 0.789227724f},
-std::array<float,2>{0.155340433f, 0.564238727f},
-std::array<float,2>{0.831343055f, 0.0795876682f},
-std::array<float,2>{0.0210905857f, 0.16359432f},
-std::array<float,2>{0.916574597f, 0.638216019f},
-std::array<float,2>{0.349728972f, 0.906702638f},
-std::array<float,2>{0.527993262f, 0.456899405f},
-std::array<float,2>{0.297162682f, 0.0503929406f},
-std::array<float,2>{0.592761993f, 0.55661428f},
-std::array<float,2>{0.0838561505f, 0.840693176f},
-std::array<float,2>{0.984264076f, 0.312759876f},
-std::array<float,2>{0.233171508f, 0.399820089f},
-std::array<float,2>{0.750440598f, 0.984850883f},
-std::array<float,2>{0.379695237f, 0.701872528f},
-std::array<float,2>{0.652744174f, 0.226625741f},
-std::array<float,2>{0.279053152f, 0.333151311f},
-std::array<float,2>{0.595598698f, 0.812648356f},
-std::array<float,2>{0.0974713117f, 0.53974092f},
-std::array<float,2>{0.962743461f, 0.0401878133f},
-std::array<float,2>{0.216540053f, 0.246145561f},
-std::array<float,2>{0.801615655f, 0.710893095f},
-std::array<float,2>{0.419106424f, 0.975692451f},
-std::array<float,2>{0.669920027f, 0.388439894f},
-std::array<float,2>{0.468637168f, 0.0705954209f},
-std::array<float,2>{0.742871821f, 0.583880544f},
-std::array<float,2>{0.161545634f, 0.809550941f},
-std::array<float,2>{0.871972561f, 0.306106985f},
-std::array<float,2>{0.0329986736f, 0.442707479f},
-std::array<float,2>{0.886211872f, 0.923667967f},
-std::array<float,2>{0.335391551f, 0.651518404f},
-std::array<float,2>{0.546044648f, 0.182281986f},
-std::array<float,2>{0.391660273f, 0.412444532f},
-std::array<float,2>{0.635868132f, 0.958233058f},
-std::array<float,2>{0.239296928f, 0.73490566f},
-std::array<float,2>{0.767769217f, 0.202261329f},
-std::array<float,2>{0.071432367f, 0.00899670366f},
-std::array<float,2>{0.995873332f, 0.519814014f},
-std::array<float,2>{0.293791384f, 0.87000072f},
-std::array<float,2>{0.570315659f, 0.358848721f},
-std::array<float,2>{0.361925334f, 0.146120608f},
-std::array<float,2>{0.506920278f, 0.681047022f},
-std::array<float,2>{0.00341417664f, 0.889463961f},
-std::array<float,2>{0.928552687f, 0.471455961f},
-std::array<float,2>{0.12969017f, 0.2565642f},
-std::array<float,2>{0.816195309f, 0.780515552f},
-std::array<float,2>{0.490125179f, 0.594020247f},
-std::array<float,2>{0.696297407f, 0.0976402238f},
-std::array<float,2>{0.2875866f, 0.376755297f},
-std::array<float,2>{0.567731023f, 0.977004886f},
-std::array<float,2>{0.0638738349f, 0.71239084f},
-std::array<float,2>{0.992142141f, 0.24121958f},
-std::array<float,2>{0.246142104f, 0.0353396647f},
-std::array<float,2>{0.778840363f, 0.538655758f},
-std::array<float,2>{0.405197829f, 0.821308315f},
-std::array<float,2>{0.631983161f, 0.33763513f},
-std::array<float,2>{0.497271121f, 0.178942069f},
-std::array<float,2>{0.693061292f, 0.643357873f},
-std::array<float,2>{0.13387084f, 0.931390524f},
-std::array<float,2>{0.827377379f, 0.446357429f},
-std::array<float,2>{0.0141659407f, 0.297606707f},
-std::array<float,2>{0.934997737f, 0.79710716f},
-std::array<float,2>{0.3708781f, 0.590791225f},
-std::array<float,2>{0.512622952f, 0.0627559125f},
-std::array<float,2>{0.409846514f, 0.346717328f},
-std::array<float,2>{0.658440351f, 0.863586247f},
-std::array<float,2>{0.206736267f, 0.530276477f},
-std::array<float,2>{0.809322953f, 0.0026842826f},
-std::array<float,2>{0.105713882f, 0.191857323f},
-std::array<float,2>{0.955544949f, 0.743139565f},
-std::array<float,2>{0.267115384f, 0.961280107f},
-std::array<float,2>{0.605479956f, 0.419990659f},
-std::array<float,2>{0.3372446f, 0.107519045f},
-std::array<float,2>{0.531263828f, 0.605605006f},
-std::array<float,2>{0.0408551916f, 0.771700978f},
-std::array<float,2>{0.875375926f, 0.262471825f},
-std::array<float,2>{0.170886725f, 0.478034824f},
-std::array<float,2>{0.863708258f, 0.878006577f},
-std::array<float,2>{0.45574674f, 0.677801371f},
-std::array<float,2>{0.741710365f, 0.152976453f},
-std::array<float,2>{0.357557774f, 0.280417055f},
-std::array<float,2>{0.522735536f, 0.758886158f},
-std::array<float,2>{0.031065356f, 0.619493067f},
-std::array<float,2>{0.908688724f, 0.114602387f},
-std::array<float,2>{0.141783267f, 0.131687537f},
-std::array<float,2>{0.842854977f, 0.66027689f},
-std::array<float,2>{0.481994808f, 0.890880108f},
-std::array<float,2>{0.713086903f, 0.485145986f},
-std::array<float,2>{0.389796495f, 0.0259942524f},
-std::array<float,2>{0.640751123f, 0.512211919f},
-std::array<float,2>{0.219444558f, 0.84826684f},
-std::array<float,2>{0.763488472f, 0.374673665f},
-std::array<float,2>{0.0909574181f, 0.422439963f},
-std::array<float,2>{0.975421131f, 0.940590322f},
-std::array<float,2>{0.307808638f, 0.730347276f},
-std::array<float,2>{0.579428196f, 0.206969991f},
-std::array<float,2>{0.446475178f, 0.467923582f},
-std::array<float,2>{0.726471543f, 0.916742086f},
-std::array<float,2>{0.172813579f, 0.630797684f},
-std::array<float,2>{0.856894672f, 0.165944174f},
-std::array<float,2>{0.0555684716f, 0.0880700946f},
-std::array<float,2>{0.897732675f, 0.571148753f},
-std::array<float,2>{0.31840843f, 0.788124979f},
-std::array<float,2>{0.56084311f, 0.293511063f},
-std::array<float,2>{0.252238572f, 0.224325255f},
-std::array<float,2>{0.616906643f, 0.691390157f},
-std::array<float,2>{0.118569016f, 0.999842405f},
-std::array<float,2>{0.945904195f, 0.393640488f},
-std::array<float,2>{0.195004925f, 0.320499569f},
-std::array<float,2>{0.791818321f, 0.828823805f},
-std::array<float,2>{0.436133653f, 0.553222418f},
-std::array<float,2>{0.685515583f, 0.0616600513f},
-std::array<float,2>{0.371982902f, 0.436856866f},
-std::array<float,2>{0.510358155f, 0.95230639f},
-std::array<float,2>{0.0100631258f, 0.726338387f},
-std::array<float,2>{0.933316529f, 0.215563834f},
-std::array<float,2>{0.137241513f, 0.0168279819f},
-std::array<float,2>{0.820475638f, 0.504980385f},
-std::array<float,2>{0.494872868f, 0.85228008f},
-std::array<float,2>{0.688310504f, 0.361840039f},
-std::array<float,2>{0.401660383f, 0.133928671f},
-std::array<float,2>{0.625983536f, 0.669606984f},
-std::array<float,2>{0.24459523f, 0.905724168f},
-std::array<float,2>{0.774418056f, 0.49471733f},
-std::array<float,2>{0.0671490729f, 0.265852928f},
-std::array<float,2>{0.987057507f, 0.754863739f},
-std::array<float,2>{0.282598019f, 0.611540258f},
-std::array<float,2>{0.564020336f, 0.124913156f},
-std::array<float,2>{0.457567573f, 0.317113459f},
-std::array<float,2>{0.736025691f, 0.836395621f},
-std::array<float,2>{0.165048704f, 0.56137675f},
-std::array<float,2>{0.861270368f, 0.0531290807f},
-std::array<float,2>{0.045259878f, 0.233951733f},
-std::array<float,2>{0.880775154f, 0.696679592f},
-std::array<float,2>{0.339947671f, 0.990732729f},
-std::array<float,2>{0.536679089f, 0.403253257f},
-std::array<float,2>{0.269885868f, 0.0858422965f},
-std::array<float,2>{0.601799548f, 0.570231259f},
-std::array<float,2>{0.102431826f, 0.796671093f},
-std::array<float,2>{0.958781838f, 0.283556163f},
-std::array<float,2>{0.208567247f, 0.459003031f},
-std::array<float,2>{0.806267262f, 0.913785219f},
-std::array<float,2>{0.412382752f, 0.63604486f},
-std::array<float,2>{0.662979007f, 0.156502068f},
-std::array<float,2>{0.309385866f, 0.308628798f},
-std::array<float,2>{0.582247913f, 0.806669056f},
-std::array<float,2>{0.0871905386f, 0.578233123f},
-std::array<float,2>{0.969485641f, 0.0765979066f},
-std::array<float,2>{0.224742845f, 0.185311481f},
-std::array<float,2>{0.761626005f, 0.652550042f},
-std::array<float,2>{0.384237736f, 0.929297507f},
-std::array<float,2>{0.648113072f, 0.440552771f},
-std::array<float,2>{0.479915589f, 0.0450002141f},
-std::array<float,2>{0.71810323f, 0.544067025f},
-std::array<float,2>{0.146277577f, 0.817296684f},
-std::array<float,2>{0.83818084f, 0.331217557f},
-std::array<float,2>{0.0257342719f, 0.386148036f},
-std::array<float,2>{0.913299501f, 0.96931982f},
-std::array<float,2>{0.352526337f, 0.705438316f},
-std::array<float,2>{0.516394079f, 0.243602619f},
-std::array<float,2>{0.432831198f, 0.474158168f},
-std::array<float,2>{0.683506668f, 0.885712743f},
-std::array<float,2>{0.190733477f, 0.683768988f},
-std::array<float,2>{0.795935154f, 0.141758025f},
-std::array<float,2>{0.123910882f, 0.0992045254f},
-std::array<float,2>{0.951989293f, 0.601501405f},
-std::array<float,2>{0.254242659f, 0.776555538f},
-std::array<float,2>{0.610587716f, 0.252003431f},
-std::array<float,2>{0.316280633f, 0.196113527f},
-std::array<float,2>{0.557111681f, 0.738401949f},
-std::array<float,2>{0.0623808354f, 0.95487231f},
-std::array<float,2>{0.891816556f, 0.407980114f},
-std::array<float,2>{0.178004742f, 0.354761809f},
-std::array<float,2>{0.854500294f, 0.87340045f},
-std::array<float,2>{0.452029079f, 0.51584959f},
-std::array<float,2>{0.718752503f, 0.0154889412f},
-std::array<float,2>{0.257874429f, 0.449923456f},
-std::array<float,2>{0.619431019f, 0.936956167f},
-std::array<float,2>{0.11449258f, 0.646444082f},
-std::array<float,2>{0.94067806f, 0.173864707f},
-std::array<float,2>{0.197985217f, 0.0673803464f},
-std::array<float,2>{0.786114335f, 0.587413192f},
-std::array<float,2>{0.427442074f, 0.801181793f},
-std::array<float,2>{0.678582489f, 0.303572565f},
-std::array<float,2>{0.438356966f, 0.235355824f},
-std::array<float,2>{0.730590165f, 0.717483878f},
-std::array<float,2>{0.18731761f, 0.981693625f},
-std::array<float,2>{0.846303403f, 0.38032347f},
-std::array<float,2>{0.0520169809f, 0.341365159f},
-std::array<float,2>{0.89848125f, 0.826548398f},
-std::array<float,2>{0.322170675f, 0.534289718f},
-std::array<float,2>{0.546981692f, 0.0346704721f},
-std::array<float,2>{0.377302706f, 0.259123355f},
-std::array<float,2>{0.652265728f, 0.765763879f},
-std::array<float,2>{0.230004475f, 0.602475524f},
-std::array<float,2>{0.755455434f, 0.102406889f},
-std::array<float,2>{0.0819455385f, 0.150593609f},
-std::array<float,2>{0.980110109f, 0.672745466f},
-std::array<float,2>{0.304384947f, 0.880279303f},
-std::array<float,2>{0.588681161f, 0.483822674f},
-std::array<float,2>{0.344826579f, 0.00509297708f},
-std::array<float,2>{0.526600063f, 0.525104225f},
-std::array<float,2>{0.0169073399f, 0.860871553f},
-std::array<float,2>{0.918527484f, 0.349542141f},
-std::array<float,2>{0.149802625f, 0.416439027f},
-std::array<float,2>{0.834055722f, 0.967588246f},
-std::array<float,2>{0.471053272f, 0.749737442f},
-std::array<float,2>{0.708546996f, 0.189886034f},
-std::array<float,2>{0.328314066f, 0.36736235f},
-std::array<float,2>{0.541216433f, 0.845938921f},
-std::array<float,2>{0.0361606851f, 0.510658205f},
-std::array<float,2>{0.890372515f, 0.0278444402f},
-std::array<float,2>{0.158453524f, 0.210735813f},
-std::array<float,2>{0.870178103f, 0.732945025f},
-std::array<float,2>{0.462035626f, 0.943461061f},
-std::array<float,2>{0.748450279f, 0.4281753f},
-std::array<float,2>{0.414891958f, 0.110480793f},
-std::array<float,2>{0.666721344f, 0.622309685f},
-std::array<float,2>{0.211126164f, 0.764432907f},
-std::array<float,2>{0.800692976f, 0.277074188f},
-std::array<float,2>{0.0976880193f, 0.491018891f},
-std::array<float,2>{0.965558827f, 0.894918561f},
-std::array<float,2>{0.27529189f, 0.657023668f},
-std::array<float,2>{0.600374341f, 0.125027165f},
-std::array<float,2>{0.486095607f, 0.395030022f},
-std::array<float,2>{0.701511621f, 0.99576354f},
-std::array<float,2>{0.125305995f, 0.692795157f},
-std::array<float,2>{0.817450881f, 0.219053611f},
-std::array<float,2>{0.00494792406f, 0.0550000593f},
-std::array<float,2>{0.925092995f, 0.547238708f},
-std::array<float,2>{0.364704162f, 0.834698856f},
-std::array<float,2>{0.501496673f, 0.324610591f},
-std::array<float,2>{0.289907455f, 0.171546027f},
-std::array<float,2>{0.576362193f, 0.625276744f},
-std::array<float,2>{0.0778521374f, 0.92153132f},
-std::array<float,2>{0.997841299f, 0.464514554f},
-std::array<float,2>{0.237739459f, 0.291066289f},
-std::array<float,2>{0.772212744f, 0.783440948f},
-std::array<float,2>{0.398347914f, 0.576738656f},
-std::array<float,2>{0.637940288f, 0.0922587439f},
-std::array<float,2>{0.360745311f, 0.471906751f},
-std::array<float,2>{0.505667031f, 0.890180111f},
-std::array<float,2>{0.000115726791f, 0.679692388f},
-std::array<float,2>{0.926698327f, 0.144935429f},
-std::array<float,2>{0.132189646f, 0.0962487906f},
-std::array<float,2>{0.813303947f, 0.595480859f},
-std::array<float,2>{0.492150724f, 0.779901505f},
-std::array<float,2>{0.697651565f, 0.25763768f},
-std::array<float,2>{0.39400664f, 0.201189011f},
-std::array<float,2>{0.633725405f, 0.735767663f},
-std::array<float,2>{0.240427539f, 0.957058728f},
-std::array<float,2>{0.767427802f, 0.413334668f},
-std::array<float,2>{0.072482571f, 0.357837886f},
-std::array<float,2>{0.9929443f, 0.870254874f},
-std::array<float,2>{0.295033991f, 0.520915091f},
-std::array<float,2>{0.573750496f, 0.00874439254f},
-std::array<float,2>{0.465691626f, 0.305080801f},
-std::array<float,2>{0.74593842f, 0.810505271f},
-std::array<float,2>{0.163252026f, 0.582925797f},
-std::array<float,2>{0.874262214f, 0.0719677359f},
-std::array<float,2>{0.0345041566f, 0.182843149f},
-std::array<float,2>{0.884703636f, 0.650488436f},
-std::array<float,2>{0.333722234f, 0.921964169f},
-std::array<float,2>{0.544725299f, 0.441751957f},
-std::array<float,2>{0.27987805f, 0.0394305326f},
-std::array<float,2>{0.596371412f, 0.540214896f},
-std::array<float,2>{0.0939319655f, 0.814151466f},
-std::array<float,2>{0.963166893f, 0.333007276f},
-std::array<float,2>{0.218485475f, 0.387294769f},
-std::array<float,2>{0.804456234f, 0.975331903f},
-std::array<float,2>{0.42065528f, 0.709866583f},
-std::array<float,2>{0.670897782f, 0.24751772f},
-std::array<float,2>{0.300399423f, 0.313754767f},
-std::array<float,2>{0.590935171f, 0.841087639f},
-std::array<float,2>{0.0856751651f, 0.55501467f},
-std::array<float,2>{0.982057929f, 0.0490702875f},
-std::array<float,2>{0.232054308f, 0.227994308f},
-std::array<float,2>{0.752854586f, 0.702412605f},
-std::array<float,2>{0.381340623f, 0.986259282f},
-std::array<float,2>{0.655058205f, 0.398663372f},
-std::array<float,2>{0.475609511f, 0.078253977f},
-std::array<float,2>{0.705241203f, 0.562682748f},
-std::array<float,2>{0.153047308f, 0.790282905f},
-std::array<float,2>{0.82968837f, 0.288836569f},
-std::array<float,2>{0.0225474276f, 0.455429286f},
-std::array<float,2>{0.914954841f, 0.907609224f},
-std::array<float,2>{0.349514008f, 0.637186468f},
-std::array<float,2>{0.529761434f, 0.163084745f},
-std::array<float,2>{0.423002601f, 0.430865735f},
-std::array<float,2>{0.671999991f, 0.949194372f},
-std::array<float,2>{0.200459421f, 0.719980121f},
-std::array<float,2>{0.78424722f, 0.212195173f},
-std::array<float,2>{0.112016633f, 0.0218554959f},
-std::array<float,2>{0.94268626f, 0.50177294f},
-std::array<float,2>{0.263673127f, 0.8555035f},
-std::array<float,2>{0.622713804f, 0.366956681f},
-std::array<float,2>{0.328033805f, 0.137762129f},
-std::array<float,2>{0.554548025f, 0.666888118f},
-std::array<float,2>{0.0474422686f, 0.900164068f},
-std::array<float,2>{0.905764461f, 0.498031735f},
-std::array<float,2>{0.183548421f, 0.271993071f},
-std::array<float,2>{0.848919988f, 0.751792967f},
-std::array<float,2>{0.445211887f, 0.615146875f},
-std::array<float,2>{0.726641059f, 0.119579598f},
-std::array<float,2>{0.250128418f, 0.392821461f},
-std::array<float,2>{0.61473763f, 0.998340607f},
-std::array<float,2>{0.120346941f, 0.689960599f},
-std::array<float,2>{0.949177861f, 0.2231704f},
-std::array<float,2>{0.191862881f, 0.0605621412f},
-std::array<float,2>{0.789215147f, 0.554115295f},
-std::array<float,2>{0.433770955f, 0.829597414f},
-std::array<float,2>{0.685961187f, 0.321904242f},
-std::array<float,2>{0.448329628f, 0.164349839f},
-std::array<float,2>{0.723061323f, 0.629740596f},
-std::array<float,2>{0.174401209f, 0.917621732f},
-std::array<float,2>{0.859013736f, 0.46764183f},
-std::array<float,2>{0.058356639f, 0.294559926f},
-std::array<float,2>{0.896269262f, 0.788085282f},
-std::array<float,2>{0.316859215f, 0.571315467f},
-std::array<float,2>{0.559674978f, 0.089139834f},
-std::array<float,2>{0.388423413f, 0.37343803f},
-std::array<float,2>{0.644505203f, 0.849348187f},
-std::array<float,2>{0.221922219f, 0.513265908f},
-std::array<float,2>{0.764262378f, 0.027152583f},
-std::array<float,2>{0.0932382122f, 0.205628976f},
-std::array<float,2>{0.972735822f, 0.729226589f},
-std::array<float,2>{0.305235505f, 0.940368235f},
-std::array<float,2>{0.581580877f, 0.422961235f},
-std::array<float,2>{0.356678158f, 0.114005812f},
-std::array<float,2>{0.520546019f, 0.620504498f},
-std::array<float,2>{0.0279662348f, 0.758639038f},
-std::array<float,2>{0.907384753f, 0.279807597f},
-std::array<float,2>{0.142703995f, 0.486236751f},
-std::array<float,2>{0.840142965f, 0.891776323f},
-std::array<float,2>{0.482851624f, 0.662072659f},
-std::array<float,2>{0.711792529f, 0.132123515f},
-std::array<float,2>{0.338518769f, 0.263100088f},
-std::array<float,2>{0.534857929f, 0.773048222f},
-std::array<float,2>{0.0427766889f, 0.607219875f},
-std::array<float,2>{0.878429055f, 0.108990856f},
-std::array<float,2>{0.168961525f, 0.154028386f},
-std::array<float,2>{0.865521133f, 0.67927289f},
-std::array<float,2>{0.454486102f, 0.877465963f},
-std::array<float,2>{0.738980174f, 0.476772219f},
-std::array<float,2>{0.407218188f, 0.00318356929f},
-std::array<float,2>{0.657425523f, 0.529655516f},
-std::array<float,2>{0.20494996f, 0.864561558f},
-std::array<float,2>{0.811050475f, 0.346506238f},
-std::array<float,2>{0.107665822f, 0.420993358f},
-std::array<float,2>{0.953343034f, 0.96246171f},
-std::array<float,2>{0.268136382f, 0.743695319f},
-std::array<float,2>{0.607762456f, 0.192662463f},
-std::array<float,2>{0.498436809f, 0.445834816f},
-std::array<float,2>{0.693764031f, 0.930015743f},
-std::array<float,2>{0.136639029f, 0.644451737f},
-std::array<float,2>{0.825880349f, 0.178101882f},
-std::array<float,2>{0.0128329834f, 0.0638751686f},
-std::array<float,2>{0.935830355f, 0.591538608f},
-std::array<float,2>{0.367213279f, 0.797991931f},
-std::array<float,2>{0.515418768f, 0.298473239f},
-std::array<float,2>{0.286964625f, 0.240461797f},
-std::array<float,2>{0.568565607f, 0.711232245f},
-std::array<float,2>{0.0645326078f, 0.978357315f},
-std::array<float,2>{0.98940599f, 0.375283509f},
-std::array<float,2>{0.249024689f, 0.336591214f},
-std::array<float,2>{0.780312777f, 0.820702434f},
-std::array<float,2>{0.403164417f, 0.537908852f},
-std::array<float,2>{0.629140258f, 0.0364930443f},
-std::array<float,2>{0.31276235f, 0.407056779f},
-std::array<float,2>{0.555303514f, 0.953812122f},
-std::array<float,2>{0.059125632f, 0.739900947f},
-std::array<float,2>{0.89339292f, 0.196344942f},
-std::array<float,2>{0.176273882f, 0.0145648904f},
-std::array<float,2>{0.852275789f, 0.517548561f},
-std::array<float,2>{0.449475199f, 0.874995887f},
-std::array<float,2>{0.721571684f, 0.353685528f},
-std::array<float,2>{0.431329399f, 0.141101614f},
-std::array<float,2>{0.681414664f, 0.68464607f},
-std::array<float,2>{0.188042775f, 0.886312842f},
-std::array<float,2>{0.794647455f, 0.473056793f},
-std::array<float,2>{0.121425405f, 0.253566593f},
-std::array<float,2>{0.950617015f, 0.776065767f},
-std::array<float,2>{0.256102711f, 0.59983021f},
-std::array<float,2>{0.612324536f, 0.097843498f},
-std::array<float,2>{0.478135616f, 0.331052929f},
-std::array<float,2>{0.715237021f, 0.817403972f},
-std::array<float,2>{0.147483453f, 0.543594301f},
-std::array<float,2>{0.836269677f, 0.0460431091f},
-std::array<float,2>{0.024311455f, 0.242225975f},
-std::array<float,2>{0.911250889f, 0.706519544f},
-std::array<float,2>{0.353869259f, 0.970260322f},
-std::array<float,2>{0.517887056f, 0.385703951f},
-std::array<float,2>{0.311679631f, 0.0779044703f},
-std::array<float,2>{0.585660398f, 0.579849124f},
-std::array<float,2>{0.0884723887f, 0.807681501f},
-std::array<float,2>{0.970928311f, 0.310497969f},
-std::array<float,2>{0.223787487f, 0.439987421f},
-std::array<float,2>{0.758738637f, 0.928128481f},
-std::array<float,2>{0.384793818f, 0.654027462f},
-std::array<float,2>{0.645891368f, 0.183753088f},
-std::array<float,2>{0.271945506f, 0.284266919f},
-std::array<float,2>{0.604368031f, 0.795240819f},
-std::array<float,2>{0.105240174f, 0.568658948f},
-std::array<float,2>{0.96086657f, 0.0841580033f},
-std::array<float,2>{0.210528433f, 0.15727818f},
-std::array<float,2>{0.807682872f, 0.635005832f},
-std::array<float,2>{0.411787152f, 0.912770867f},
-std::array<float,2>{0.660429895f, 0.460820675f},
-std::array<float,2>{0.459412068f, 0.0546312816f},
-std::array<float,2>{0.737176955f, 0.562294006f},
-std::array<float,2>{0.167913571f, 0.837557197f},
-std::array<float,2>{0.861599028f, 0.318357736f},
-std::array<float,2>{0.0441318601f, 0.404245913f},
-std::array<float,2>{0.881995618f, 0.991356134f},
-std::array<float,2>{0.343734145f, 0.695910573f},
-std::array<float,2>{0.537230849f, 0.232934088f},
-std::array<float,2>{0.400210261f, 0.495295584f},
-std::array<float,2>{0.627116024f, 0.905030608f},
-std::array<float,2>{0.242478028f, 0.668216109f},
-std::array<float,2>{0.775723338f, 0.133194536f},
-std::array<float,2>{0.0689167008f, 0.12349347f},
-std::array<float,2>{0.986101627f, 0.613042474f},
-std::array<float,2>{0.28372246f, 0.75584656f},
-std::array<float,2>{0.565212905f, 0.267258495f},
-std::array<float,2>{0.37480402f, 0.216077283f},
-std::array<float,2>{0.508971691f, 0.725456178f},
-std::array<float,2>{0.008499166f, 0.951635599f},
-std::array<float,2>{0.931585371f, 0.43578738f},
-std::array<float,2>{0.14039661f, 0.362656325f},
-std::array<float,2>{0.824186146f, 0.852928758f},
-std::array<float,2>{0.49377805f, 0.503907859f},
-std::array<float,2>{0.690785348f, 0.0160646718f},
-std::array<float,2>{0.291080385f, 0.462943852f},
-std::array<float,2>{0.576107383f, 0.920342445f},
-std::array<float,2>{0.0744648054f, 0.626714349f},
-std::array<float,2>{0.998625398f, 0.170004547f},
-std::array<float,2>{0.235380083f, 0.0931763798f},
-std::array<float,2>{0.771466911f, 0.577733755f},
-std::array<float,2>{0.395026773f, 0.78490907f},
-std::array<float,2>{0.639406502f, 0.292051911f},
-std::array<float,2>{0.487307191f, 0.220574304f},
-std::array<float,2>{0.699724734f, 0.69151032f},
-std::array<float,2>{0.127284139f, 0.995101929f},
-std::array<float,2>{0.818873346f, 0.395933002f},
-std::array<float,2>{0.00653320272f, 0.325565577f},
-std::array<float,2>{0.923596799f, 0.83509016f},
-std::array<float,2>{0.365699917f, 0.548615992f},
-std::array<float,2>{0.502129555f, 0.0556940101f},
-std::array<float,2>{0.416506797f, 0.276034981f},
-std::array<float,2>{0.664410889f, 0.765429497f},
-std::array<float,2>{0.213375434f, 0.621629596f},
-std::array<float,2>{0.797783196f, 0.109470904f},
-std::array<float,2>{0.100302868f, 0.12621668f},
-std::array<float,2>{0.968372166f, 0.657494485f},
-std::array<float,2>{0.277288556f, 0.896069527f},
-std::array<float,2>{0.598487496f, 0.491588622f},
-std::array<float,2>{0.330865413f, 0.0287204981f},
-std::array<float,2>{0.539967477f, 0.511217952f},
-std::array<float,2>{0.0383121856f, 0.847066641f},
-std::array<float,2>{0.88732183f, 0.368648767f},
-std::array<float,2>{0.157932997f, 0.429626316f},
-std::array<float,2>{0.868333876f, 0.944935977f},
-std::array<float,2>{0.464343816f, 0.734180689f},
-std::array<float,2>{0.74772507f, 0.2097307f},
-std::array<float,2>{0.347071856f, 0.348380476f},
-std::array<float,2>{0.525228918f, 0.859727681f},
-std::array<float,2>{0.018062938f, 0.524372995f},
-std::array<float,2>{0.920793593f, 0.0039797849f},
-std::array<float,2>{0.151010707f, 0.191178888f},
-std::array<float,2>{0.832166195f, 0.748576581f},
-std::array<float,2>{0.469582647f, 0.968209803f},
-std::array<float,2>{0.709129393f, 0.41718474f},
-std::array<float,2>{0.376674294f, 0.102888659f},
-std::array<float,2>{0.64993906f, 0.60289979f},
-std::array<float,2>{0.228463382f, 0.767326474f},
-std::array<float,2>{0.756424785f, 0.258325189f},
-std::array<float,2>{0.0793382525f, 0.483076543f},
-std::array<float,2>{0.978366017f, 0.879541755f},
-std::array<float,2>{0.302231818f, 0.673276782f},
-std::array<float,2>{0.586894333f, 0.151757732f},
-std::array<float,2>{0.441023469f, 0.379568428f},
-std::array<float,2>{0.734155774f, 0.980479121f},
-std::array<float,2>{0.183709279f, 0.718485177f},
-std::array<float,2>{0.844453335f, 0.234640047f},
-std::array<float,2>{0.0533231907f, 0.0334153436f},
-std::array<float,2>{0.901527464f, 0.533313036f},
-std::array<float,2>{0.324006587f, 0.827277124f},
-std::array<float,2>{0.55064261f, 0.340429366f},
-std::array<float,2>{0.260294199f, 0.17549032f},
-std::array<float,2>{0.618786752f, 0.645422518f},
-std::array<float,2>{0.115861766f, 0.936369061f},
-std::array<float,2>{0.939112246f, 0.451014668f},
-std::array<float,2>{0.197071657f, 0.304027736f},
-std::array<float,2>{0.78744787f, 0.802023947f},
-std::array<float,2>{0.427829742f, 0.585961759f},
-std::array<float,2>{0.677528441f, 0.0674612522f},
-std::array<float,2>{0.334043443f, 0.444293618f},
-std::array<float,2>{0.545079768f, 0.925544858f},
-std::array<float,2>{0.0318344422f, 0.649281502f},
-std::array<float,2>{0.885159552f, 0.180867523f},
-std::array<float,2>{0.160235465f, 0.0737007186f},
-std::array<float,2>{0.872382283f, 0.584285498f},
-std::array<float,2>{0.467065096f, 0.811812699f},
-std::array<float,2>{0.743297517f, 0.307235897f},
-std::array<float,2>{0.418251723f, 0.249944478f},
-std::array<float,2>{0.668618202f, 0.708066225f},
-std::array<float,2>{0.215200663f, 0.974282146f},
-std::array<float,2>{0.802248955f, 0.388825059f},
-std::array<float,2>{0.0964902863f, 0.335228473f},
-std::array<float,2>{0.96139735f, 0.816015005f},
-std::array<float,2>{0.277884066f, 0.542867959f},
-std::array<float,2>{0.593906581f, 0.0421416312f},
-std::array<float,2>{0.488575161f, 0.255451828f},
-std::array<float,2>{0.69577527f, 0.779113948f},
-std::array<float,2>{0.130676061f, 0.596040845f},
-std::array<float,2>{0.815068901f, 0.0942299739f},
-std::array<float,2>{0.00288441591f, 0.146772265f},
-std::array<float,2>{0.929069996f, 0.683283746f},
-std::array<float,2>{0.363256663f, 0.887266994f},
-std::array<float,2>{0.505962431f, 0.470602781f},
-std::array<float,2>{0.294876069f, 0.0108775105f},
-std::array<float,2>{0.571914554f, 0.523091912f},
-std::array<float,2>{0.0712779462f, 0.867194772f},
-std::array<float,2>{0.994575322f, 0.355679542f},
-std::array<float,2>{0.238902122f, 0.410242587f},
-std::array<float,2>{0.769207776f, 0.959184825f},
-std::array<float,2>{0.391386479f, 0.738241196f},
-std::array<float,2>{0.635396481f, 0.199273705f},
-std::array<float,2>{0.263422698f, 0.36469987f},
-std::array<float,2>{0.623344302f, 0.857842565f},
-std::array<float,2>{0.11088267f, 0.503602922f},
-std::array<float,2>{0.944469571f, 0.0210252255f},
-std::array<float,2>{0.201179326f, 0.21422191f},
-std::array<float,2>{0.781633198f, 0.722193837f},
-std::array<float,2>{0.424550623f, 0.945779204f},
-std::array<float,2>{0.675641775f, 0.433021873f},
-std::array<float,2>{0.443079025f, 0.117698021f},
-std::array<float,2>{0.728938818f, 0.615417659f},
-std::array<float,2>{0.179903775f, 0.753694355f},
-std::array<float,2>{0.851375163f, 0.270221174f},
-std::array<float,2>{0.0501076244f, 0.499021232f},
-std::array<float,2>{0.902933419f, 0.900720477f},
-std::array<float,2>{0.324501038f, 0.666012466f},
-std::array<float,2>{0.551153064f, 0.14009279f},
-std::array<float,2>{0.379933596f, 0.402095944f},
-std::array<float,2>{0.654143572f, 0.988280237f},
-std::array<float,2>{0.233745083f, 0.700384259f},
-std::array<float,2>{0.751478493f, 0.229177117f},
-std::array<float,2>{0.0822328627f, 0.0478339009f},
-std::array<float,2>{0.98262459f, 0.556713641f},
-std::array<float,2>{0.298105597f, 0.84357655f},
-std::array<float,2>{0.592902243f, 0.315261394f},
-std::array<float,2>{0.351541847f, 0.161986485f},
-std::array<float,2>{0.529205441f, 0.640457988f},
-std::array<float,2>{0.0197891723f, 0.909717917f},
-std::array<float,2>{0.917608917f, 0.455032259f},
-std::array<float,2>{0.155196711f, 0.286355644f},
-std::array<float,2>{0.83085674f, 0.791070879f},
-std::array<float,2>{0.474378169f, 0.566404641f},
-std::array<float,2>{0.703482807f, 0.0807179138f},
-std::array<float,2>{0.306916147f, 0.425341487f},
-std::array<float,2>{0.578490198f, 0.938230157f},
-std::array<float,2>{0.090520978f, 0.728264749f},
-std::array<float,2>{0.976240575f, 0.203696474f},
-std::array<float,2>{0.220395774f, 0.0237880573f},
-std::array<float,2>{0.761995494f, 0.513795376f},
-std::array<float,2>{0.388825685f, 0.851365209f},
-std::array<float,2>{0.641907811f, 0.372321665f},
-std::array<float,2>{0.480773211f, 0.130504802f},
-std::array<float,2>{0.714733541f, 0.662175179f},
-std::array<float,2>{0.141144797f, 0.894268632f},
-std::array<float,2>{0.842272937f, 0.487337738f},
-std::array<float,2>{0.0293325353f, 0.278291881f},
-std::array<float,2>{0.909257233f, 0.761338055f},
-std::array<float,2>{0.358879328f, 0.617461145f},
-std::array<float,2>{0.521839857f, 0.116712168f},
-std::array<float,2>{0.436692715f, 0.323611856f},
-std::array<float,2>{0.684151173f, 0.831659019f},
-std::array<float,2>{0.1938802f, 0.552233636f},
-std::array<float,2>{0.792138398f, 0.0596279241f},
-std::array<float,2>{0.117746919f, 0.225007713f},
-std::array<float,2>{0.946669161f, 0.6891644f},
-std::array<float,2>{0.253728062f, 0.997652471f},
-std::array<float,2>{0.615265727f, 0.391371965f},
-std::array<float,2>{0.319480598f, 0.0866958499f},
-std::array<float,2>{0.561818421f, 0.573991835f},
-std::array<float,2>{0.0559680648f, 0.78537339f},
-std::array<float,2>{0.896784306f, 0.296763152f},
-std::array<float,2>{0.172898352f, 0.464975983f},
-std::array<float,2>{0.856167197f, 0.915370226f},
-std::array<float,2>{0.44572255f, 0.632390499f},
-std::array<float,2>{0.725025415f, 0.167908862f},
-std::array<float,2>{0.36929208f, 0.300080657f},
-std::array<float,2>{0.512698948f, 0.800706923f},
-std::array<float,2>{0.0153645799f, 0.593423605f},
-std::array<float,2>{0.93409729f, 0.0657122433f},
-std::array<float,2>{0.133224383f, 0.176915765f},
-std::array<float,2>{0.82657069f, 0.641524673f},
-std::array<float,2>{0.496380985f, 0.932534158f},
-std::array<float,2>{0.691723228f, 0.447732717f},
-std::array<float,2>{0.406160444f, 0.0376951918f},
-std::array<float,2>{0.631634533f, 0.535624743f},
-std::array<float,2>{0.247105464f, 0.822534382f},
-std::array<float,2>{0.778165221f, 0.339764565f},
-std::array<float,2>{0.0629835501f, 0.377460063f},
-std::array<float,2>{0.990825951f, 0.9795416f},
-std::array<float,2>{0.288689524f, 0.713068843f},
-std::array<float,2>{0.566525519f, 0.238954335f},
-std::array<float,2>{0.456549585f, 0.479757547f},
-std::array<float,2>{0.740832388f, 0.875685275f},
-std::array<float,2>{0.171747312f, 0.677084744f},
-std::array<float,2>{0.864396513f, 0.155906126f},
-std::array<float,2>{0.0396777242f, 0.10613323f},
-std::array<float,2>{0.876081347f, 0.607591629f},
-std::array<float,2>{0.336010337f, 0.77010572f},
-std::array<float,2>{0.532448411f, 0.265560746f},
-std::array<float,2>{0.266595095f, 0.195042521f},
-std::array<float,2>{0.606474519f, 0.744251251f},
-std::array<float,2>{0.107180625f, 0.964598417f},
-std::array<float,2>{0.956503808f, 0.418293774f},
-std::array<float,2>{0.205726236f, 0.344492108f},
-std::array<float,2>{0.80992204f, 0.866467655f},
-std::array<float,2>{0.408413708f, 0.527985215f},
-std::array<float,2>{0.660046458f, 0.00146006164f},
-std::array<float,2>{0.353440911f, 0.383095771f},
-std::array<float,2>{0.517291248f, 0.971785605f},
-std::array<float,2>{0.0265623555f, 0.704042614f},
-std::array<float,2>{0.912240803f, 0.244832546f},
-std::array<float,2>{0.14478077f, 0.0446741506f},
-std::array<float,2>{0.839025855f, 0.545413315f},
-std::array<float,2>{0.479385793f, 0.818757415f},
-std::array<float,2>{0.716891944f, 0.329454958f},
-std::array<float,2>{0.383176267f, 0.187375993f},
-std::array<float,2>{0.646941721f, 0.654768527f},
-std::array<float,2>{0.225624666f, 0.927722633f},
-std::array<float,2>{0.760396123f, 0.438384622f},
-std::array<float,2>{0.0867593586f, 0.312019974f},
-std::array<float,2>{0.970629454f, 0.805814564f},
-std::array<float,2>{0.310295045f, 0.581944585f},
-std::array<float,2>{0.58346957f, 0.0752866492f},
-std::array<float,2>{0.452884883f, 0.352387488f},
-std::array<float,2>{0.719751835f, 0.87172693f},
-std::array<float,2>{0.179670453f, 0.51817888f},
-std::array<float,2>{0.853717923f, 0.0122075425f},
-std::array<float,2>{0.0610289909f, 0.198567539f},
-std::array<float,2>{0.891184449f, 0.740512371f},
-std::array<float,2>{0.314797491f, 0.956817269f},
-std::array<float,2>{0.558108985f, 0.408751518f},
-std::array<float,2>{0.255365133f, 0.10146983f},
-std::array<float,2>{0.609837592f, 0.598927975f},
-std::array<float,2>{0.124415226f, 0.773610055f},
-std::array<float,2>{0.95288837f, 0.251235157f},
-std::array<float,2>{0.19025813f, 0.476512402f},
-std::array<float,2>{0.795227945f, 0.883364558f},
-std::array<float,2>{0.432601929f, 0.685852587f},
-std::array<float,2>{0.681873679f, 0.14277795f},
-std::array<float,2>{0.282004356f, 0.269372523f},
-std::array<float,2>{0.563470662f, 0.755891323f},
-std::array<float,2>{0.0677360818f, 0.610744238f},
-std::array<float,2>{0.987333834f, 0.122370474f},
-std::array<float,2>{0.245297506f, 0.135772735f},
-std::array<float,2>{0.773607135f, 0.670984268f},
-std::array<float,2>{0.401349157f, 0.902951002f},
-std::array<float,2>{0.625905871f, 0.492647648f},
-std::array<float,2>{0.495859087f, 0.0187410694f},
-std::array<float,2>{0.688825071f, 0.507325411f},
-std::array<float,2>{0.138286725f, 0.855175376f},
-std::array<float,2>{0.8218624f, 0.360649377f},
-std::array<float,2>{0.0112804165f, 0.434481025f},
-std::array<float,2>{0.932187796f, 0.95110172f},
-std::array<float,2>{0.372506469f, 0.723037779f},
-std::array<float,2>{0.510888398f, 0.218468592f},
-std::array<float,2>{0.413093418f, 0.457828879f},
-std::array<float,2>{0.663141549f, 0.910219491f},
-std::array<float,2>{0.207674831f, 0.633613944f},
-std::array<float,2>{0.805488825f, 0.158976927f},
-std::array<float,2>{0.102553241f, 0.0834337845f},
-std::array<float,2>{0.957361877f, 0.566951752f},
-std::array<float,2>{0.270546615f, 0.793247104f},
-std::array<float,2>{0.603118062f, 0.28262648f},
-std::array<float,2>{0.341261387f, 0.230702117f},
-std::array<float,2>{0.535890579f, 0.697979152f},
-std::array<float,2>{0.046100013f, 0.989637494f},
-std::array<float,2>{0.87922132f, 0.404309094f},
-std::array<float,2>{0.164837912f, 0.318699956f},
-std::array<float,2>{0.859915733f, 0.839059651f},
-std::array<float,2>{0.458765835f, 0.559724391f},
-std::array<float,2>{0.735026777f, 0.052507475f},
-std::array<float,2>{0.273842245f, 0.489400744f},
-std::array<float,2>{0.600831985f, 0.896499395f},
-std::array<float,2>{0.0993958116f, 0.660061061f},
-std::array<float,2>{0.966586828f, 0.127999738f},
-std::array<float,2>{0.212778926f, 0.111806802f},
-std::array<float,2>{0.799554169f, 0.623361766f},
-std::array<float,2>{0.41581741f, 0.763635099f},
-std::array<float,2>{0.667571068f, 0.273447722f},
-std::array<float,2>{0.461654276f, 0.208428875f},
-std::array<float,2>{0.749839485f, 0.731027424f},
-std::array<float,2>{0.159236252f, 0.94303894f},
-std::array<float,2>{0.870079815f, 0.427012891f},
-std::array<float,2>{0.0352823585f, 0.369509071f},
-std::array<float,2>{0.888845563f, 0.844804645f},
-std::array<float,2>{0.329414606f, 0.509407997f},
-std::array<float,2>{0.542248785f, 0.0310415775f},
-std::array<float,2>{0.396873534f, 0.289624095f},
-std::array<float,2>{0.636823118f, 0.78132844f},
-std::array<float,2>{0.236613303f, 0.575472355f},
-std::array<float,2>{0.772961617f, 0.0907035246f},
-std::array<float,2>{0.0764500201f, 0.168839246f},
-std::array<float,2>{0.996802449f, 0.627195179f},
-std::array<float,2>{0.29026255f, 0.918736756f},
-std::array<float,2>{0.577406704f, 0.461623281f},
-std::array<float,2>{0.363756567f, 0.0583300516f},
-std::array<float,2>{0.500390351f, 0.549543321f},
-std::array<float,2>{0.00402625976f, 0.833558857f},
-std::array<float,2>{0.924072623f, 0.326855898f},
-std::array<float,2>{0.126172438f, 0.39665395f},
-std::array<float,2>{0.817281961f, 0.992340803f},
-std::array<float,2>{0.485131443f, 0.695104301f},
-std::array<float,2>{0.702352524f, 0.221687987f},
-std::array<float,2>{0.3206819f, 0.341897011f},
-std::array<float,2>{0.548571348f, 0.825970769f},
-std::array<float,2>{0.0514233336f, 0.531772614f},
-std::array<float,2>{0.900133908f, 0.0315904245f},
-std::array<float,2>{0.185709327f, 0.236865506f},
-std::array<float,2>{0.846869528f, 0.715496361f},
-std::array<float,2>{0.438867241f, 0.982883811f},
-std::array<float,2>{0.731549799f, 0.381917477f},
-std::array<float,2>{0.426232427f, 0.0696492866f},
-std::array<float,2>{0.679643691f, 0.58853668f},
-std::array<float,2>{0.198602617f, 0.803222597f},
-std::array<float,2>{0.786493719f, 0.301968157f},
-std::array<float,2>{0.113832854f, 0.452624947f},
-std::array<float,2>{0.939707875f, 0.934304655f},
-std::array<float,2>{0.259751707f, 0.646904528f},
-std::array<float,2>{0.620492578f, 0.173792765f},
-std::array<float,2>{0.472444415f, 0.414282233f},
-std::array<float,2>{0.707510233f, 0.966281235f},
-std::array<float,2>{0.149204105f, 0.746213138f},
-std::array<float,2>{0.83544457f, 0.187615961f},
-std::array<float,2>{0.0161735993f, 0.00736708939f},
-std::array<float,2>{0.919589698f, 0.526241302f},
-std::array<float,2>{0.344709426f, 0.862593889f},
-std::array<float,2>{0.526183665f, 0.351293087f},
-std::array<float,2>{0.303489089f, 0.149846211f},
-std::array<float,2>{0.589708924f, 0.675147653f},
-std::array<float,2>{0.0802157521f, 0.881651938f},
-std::array<float,2>{0.979270399f, 0.481481373f},
-std::array<float,2>{0.228557602f, 0.261250079f},
-std::array<float,2>{0.754526436f, 0.768780768f},
-std::array<float,2>{0.378510594f, 0.604097545f},
-std::array<float,2>{0.650839448f, 0.104268454f},
-std::array<float,2>{0.367711782f, 0.447989702f},
-std::array<float,2>{0.515078068f, 0.931971371f},
-std::array<float,2>{0.0133589776f, 0.640911996f},
-std::array<float,2>{0.936213732f, 0.177614272f},
-std::array<float,2>{0.136133716f, 0.0662944391f},
-std::array<float,2>{0.825499952f, 0.593023241f},
-std::array<float,2>{0.498948544f, 0.799829483f},
-std::array<float,2>{0.694247901f, 0.300769389f},
-std::array<float,2>{0.40255478f, 0.238734215f},
-std::array<float,2>{0.629447758f, 0.71345377f},
-std::array<float,2>{0.249869853f, 0.980124652f},
-std::array<float,2>{0.781176805f, 0.37737143f},
-std::array<float,2>{0.0652661398f, 0.338948011f},
-std::array<float,2>{0.989843845f, 0.823108673f},
-std::array<float,2>{0.286471725f, 0.536051631f},
-std::array<float,2>{0.568936825f, 0.0375779271f},
-std::array<float,2>{0.455044776f, 0.264713705f},
-std::array<float,2>{0.738479078f, 0.769958079f},
-std::array<float,2>{0.169804081f, 0.60822618f},
-std::array<float,2>{0.865887821f, 0.105689108f},
-std::array<float,2>{0.0421646312f, 0.155481547f},
-std::array<float,2>{0.877977192f, 0.677449584f},
-std::array<float,2>{0.338141441f, 0.875161588f},
-std::array<float,2>{0.534484148f, 0.480378807f},
-std::array<float,2>{0.268060297f, 0.00188928156f},
-std::array<float,2>{0.608092248f, 0.527599812f},
-std::array<float,2>{0.10833174f, 0.866886139f},
-std::array<float,2>{0.953809023f, 0.344058365f},
-std::array<float,2>{0.204290584f, 0.418720156f},
-std::array<float,2>{0.810869753f, 0.963976204f},
-std::array<float,2>{0.40629068f, 0.744895279f},
-std::array<float,2>{0.658179998f, 0.194645062f},
-std::array<float,2>{0.305142939f, 0.37304014f},
-std::array<float,2>{0.581220746f, 0.85106504f},
-std::array<float,2>{0.0933919922f, 0.514296174f},
-std::array<float,2>{0.973284006f, 0.0240082052f},
-std::array<float,2>{0.222279713f, 0.203233749f},
-std::array<float,2>{0.764069855f, 0.727579772f},
-std::array<float,2>{0.388160586f, 0.937832773f},
-std::array<float,2>{0.643799543f, 0.425037533f},
-std::array<float,2>{0.48302418f, 0.116588093f},
-std::array<float,2>{0.711406946f, 0.617837965f},
-std::array<float,2>{0.143184438f, 0.760876894f},
-std::array<float,2>{0.840475678f, 0.277445436f},
-std::array<float,2>{0.0278043132f, 0.487888843f},
-std::array<float,2>{0.907944083f, 0.89386797f},
-std::array<float,2>{0.357264429f, 0.662872434f},
-std::array<float,2>{0.521098852f, 0.130004391f},
-std::array<float,2>{0.434416145f, 0.390853912f},
-std::array<float,2>{0.686170459f, 0.997277141f},
-std::array<float,2>{0.192024365f, 0.688823283f},
-std::array<float,2>{0.790038109f, 0.225438491f},
-std::array<float,2>{0.120848715f, 0.0603682585f},
-std::array<float,2>{0.948279083f, 0.552598119f},
-std::array<float,2>{0.250671059f, 0.831479013f},
-std::array<float,2>{0.615110993f, 0.323987693f},
-std::array<float,2>{0.317093998f, 0.166998506f},
-std::array<float,2>{0.560484409f, 0.632228434f},
-std::array<float,2>{0.0577186123f, 0.915891707f},
-std::array<float,2>{0.895802319f, 0.465367794f},
-std::array<float,2>{0.174268231f, 0.295964569f},
-std::array<float,2>{0.858735681f, 0.785723507f},
-std::array<float,2>{0.449048191f, 0.573715568f},
-std::array<float,2>{0.723540902f, 0.0862869024f},
-std::array<float,2>{0.264557838f, 0.433234245f},
-std::array<float,2>{0.622508585f, 0.945828378f},
-std::array<float,2>{0.111693203f, 0.72214663f},
-std::array<float,2>{0.943232f, 0.214447245f},
-std::array<float,2>{0.200865045f, 0.020555336f},
-std::array<float,2>{0.785140872f, 0.503335297f},
-std::array<float,2>{0.423617244f, 0.858122885f},
-std::array<float,2>{0.672465146f, 0.365138084f},
-std::array<float,2>{0.444412827f, 0.140334666f},
-std::array<float,2>{0.727133393f, 0.665130973f},
-std::array<float,2>{0.182638556f, 0.90095067f},
-std::array<float,2>{0.84937495f, 0.498277873f},
-std::array<float,2>{0.0471209623f, 0.269625843f},
-std::array<float,2>{0.905339003f, 0.753116012f},
-std::array<float,2>{0.327505261f, 0.616126001f},
-std::array<float,2>{0.553736985f, 0.117383592f},
-std::array<float,2>{0.381348193f, 0.314511746f},
-std::array<float,2>{0.654439688f, 0.842776239f},
-std::array<float,2>{0.23157382f, 0.557353139f},
-std::array<float,2>{0.752201974f, 0.0471913069f},
-std::array<float,2>{0.0854311511f, 0.228799507f},
-std::array<float,2>{0.981933236f, 0.701122165f},
-std::array<float,2>{0.300088227f, 0.987681329f},
-std::array<float,2>{0.591527164f, 0.401751876f},
-std::array<float,2>{0.34866944f, 0.0802764669f},
-std::array<float,2>{0.530034184f, 0.56550312f},
-std::array<float,2>{0.0234261584f, 0.791806936f},
-std::array<float,2>{0.914186776f, 0.286990762f},
-std::array<float,2>{0.152556986f, 0.454328597f},
-std::array<float,2>{0.829133511f, 0.90936172f},
-std::array<float,2>{0.476547509f, 0.639984012f},
-std::array<float,2>{0.705860555f, 0.16131103f},
-std::array<float,2>{0.333492488f, 0.306827784f},
-std::array<float,2>{0.544163048f, 0.812342405f},
-std::array<float,2>{0.0347128473f, 0.584778547f},
-std::array<float,2>{0.884034872f, 0.0740842596f},
-std::array<float,2>{0.163834289f, 0.18149215f},
-std::array<float,2>{0.87492913f, 0.648564935f},
-std::array<float,2>{0.46492812f, 0.924832225f},
-std::array<float,2>{0.745186329f, 0.443676174f},
-std::array<float,2>{0.420156211f, 0.0425181761f},
-std::array<float,2>{0.670120478f, 0.542309284f},
-std::array<float,2>{0.217792869f, 0.815552831f},
-std::array<float,2>{0.804135144f, 0.335813642f},
-std::array<float,2>{0.0945801139f, 0.389548898f},
-std::array<float,2>{0.963709116f, 0.974028826f},
-std::array<float,2>{0.279456109f, 0.708812952f},
-std::array<float,2>{0.595961511f, 0.249233857f},
-std::array<float,2>{0.491538882f, 0.470097035f},
-std::array<float,2>{0.697775126f, 0.886882126f},
-std::array<float,2>{0.132738993f, 0.683086336f},
-std::array<float,2>{0.812617838f, 0.147168085f},
-std::array<float,2>{0.000925097847f, 0.0943478495f},
-std::array<float,2>{0.926032484f, 0.596354485f},
-std::array<float,2>{0.361008674f, 0.778675854f},
-std::array<float,2>{0.505082607f, 0.255232841f},
-std::array<float,2>{0.295424104f, 0.199759811f},
-std::array<float,2>{0.573701084f, 0.737368584f},
-std::array<float,2>{0.0728548542f, 0.959688544f},
-std::array<float,2>{0.992562234f, 0.410884827f},
-std::array<float,2>{0.241038725f, 0.355973452f},
-std::array<float,2>{0.766756535f, 0.867709637f},
-std::array<float,2>{0.394160777f, 0.522567153f},
-std::array<float,2>{0.633287728f, 0.011591671f},
-std::array<float,2>{0.323305696f, 0.382625908f},
-std::array<float,2>{0.550115645f, 0.983374357f},
-std::array<float,2>{0.0530778579f, 0.715112448f},
-std::array<float,2>{0.902179778f, 0.236469895f},
-std::array<float,2>{0.184268177f, 0.0320502371f},
-std::array<float,2>{0.843761683f, 0.531500578f},
-std::array<float,2>{0.440721482f, 0.825439751f},
-std::array<float,2>{0.733504057f, 0.342645228f},
-std::array<float,2>{0.428334832f, 0.173082739f},
-std::array<float,2>{0.677026391f, 0.647210479f},
-std::array<float,2>{0.19665274f, 0.933737457f},
-std::array<float,2>{0.787868619f, 0.452917248f},
-std::array<float,2>{0.115451969f, 0.302695781f},
-std::array<float,2>{0.938887298f, 0.803287089f},
-std::array<float,2>{0.260252893f, 0.587949932f},
-std::array<float,2>{0.618398309f, 0.0700705722f},
-std::array<float,2>{0.468945175f, 0.350897193f},
-std::array<float,2>{0.709946394f, 0.862866879f},
-std::array<float,2>{0.150637567f, 0.525411308f},
-std::array<float,2>{0.832755268f, 0.00718685333f},
-std::array<float,2>{0.0183777846f, 0.188258559f},
-std::array<float,2>{0.920159757f, 0.74668318f},
-std::array<float,2>{0.347277135f, 0.966739118f},
-std::array<float,2>{0.524512768f, 0.414655298f},
-std::array<float,2>{0.302543104f, 0.103629366f},
-std::array<float,2>{0.586003542f, 0.603624225f},
-std::array<float,2>{0.079942964f, 0.769105554f},
-std::array<float,2>{0.977622628f, 0.261148304f},
-std::array<float,2>{0.227829814f, 0.482097179f},
-std::array<float,2>{0.755867124f, 0.88089323f},
-std::array<float,2>{0.376269251f, 0.675653875f},
-std::array<float,2>{0.649449468f, 0.150268331f},
-std::array<float,2>{0.276842713f, 0.274033159f},
-std::array<float,2>{0.597811282f, 0.763080418f},
-std::array<float,2>{0.0997977257f, 0.623964965f},
-std::array<float,2>{0.968005121f, 0.111960568f},
-std::array<float,2>{0.213547423f, 0.128539234f},
-std::array<float,2>{0.7972157f, 0.659649611f},
-std::array<float,2>{0.4161762f, 0.89735949f},
-std::array<float,2>{0.665005267f, 0.490112662f},
-std::array<float,2>{0.464569032f, 0.0303305779f},
-std::array<float,2>{0.747188151f, 0.508871377f},
-std::array<float,2>{0.157454312f, 0.845273077f},
-std::array<float,2>{0.869045854f, 0.370072007f},
-std::array<float,2>{0.0390395559f, 0.427252799f},
-std::array<float,2>{0.886819303f, 0.942484617f},
-std::array<float,2>{0.330229193f, 0.730835795f},
-std::array<float,2>{0.539466977f, 0.208515987f},
-std::array<float,2>{0.394747525f, 0.461334884f},
-std::array<float,2>{0.638877928f, 0.918018997f},
-std::array<float,2>{0.236225188f, 0.627449751f},
-std::array<float,2>{0.770510733f, 0.168157578f},
-std::array<float,2>{0.0747608691f, 0.0902208984f},
-std::array<float,2>{0.998079836f, 0.5756917f},
-std::array<float,2>{0.291799456f, 0.782097816f},
-std::array<float,2>{0.575199902f, 0.289134473f},
-std::array<float,2>{0.366171032f, 0.222398326f},
-std::array<float,2>{0.502689779f, 0.694348872f},
-std::array<float,2>{0.00623270217f, 0.992698014f},
-std::array<float,2>{0.923248827f, 0.397002876f},
-std::array<float,2>{0.127761841f, 0.326338798f},
-std::array<float,2>{0.81884712f, 0.833433867f},
-std::array<float,2>{0.487970173f, 0.549060464f},
-std::array<float,2>{0.699675977f, 0.058086887f},
-std::array<float,2>{0.283450961f, 0.492945611f},
-std::array<float,2>{0.564581692f, 0.902613282f},
-std::array<float,2>{0.0685187057f, 0.671590209f},
-std::array<float,2>{0.98579669f, 0.136278927f},
-std::array<float,2>{0.242992818f, 0.122634016f},
-std::array<float,2>{0.77625978f, 0.611005843f},
-std::array<float,2>{0.39946273f, 0.756495655f},
-std::array<float,2>{0.627538502f, 0.268585682f},
-std::array<float,2>{0.493390858f, 0.218050212f},
-std::array<float,2>{0.691018522f, 0.723515511f},
-std::array<float,2>{0.140048921f, 0.950409174f},
-std::array<float,2>{0.823336065f, 0.433664799f},
-std::array<float,2>{0.00790151674f, 0.360958546f},
-std::array<float,2>{0.931120276f, 0.854786754f},
-std::array<float,2>{0.374438375f, 0.507057548f},
-std::array<float,2>{0.509678125f, 0.0194690619f},
-std::array<float,2>{0.411424726f, 0.283033192f},
-std::array<float,2>{0.661103189f, 0.793694437f},
-std::array<float,2>{0.210398108f, 0.566415548f},
-std::array<float,2>{0.808383584f, 0.0835846439f},
-std::array<float,2>{0.104946561f, 0.158340275f},
-std::array<float,2>{0.960224748f, 0.63284564f},
-std::array<float,2>{0.272100806f, 0.910794556f},
-std::array<float,2>{0.603587031f, 0.457256764f},
-std::array<float,2>{0.342976898f, 0.0519611798f},
-std::array<float,2>{0.537875056f, 0.560409844f},
-std::array<float,2>{0.0444512293f, 0.839651465f},
-std::array<float,2>{0.882415891f, 0.319190472f},
-std::array<float,2>{0.167204723f, 0.405248284f},
-std::array<float,2>{0.862276435f, 0.989937961f},
-std::array<float,2>{0.459484249f, 0.697562754f},
-std::array<float,2>{0.736361027f, 0.231227085f},
-std::array<float,2>{0.354463935f, 0.329894781f},
-std::array<float,2>{0.518127978f, 0.819203913f},
-std::array<float,2>{0.0235339999f, 0.545409918f},
-std::array<float,2>{0.911828101f, 0.0442383736f},
-std::array<float,2>{0.148341149f, 0.244515896f},
-std::array<float,2>{0.836739123f, 0.703264654f},
-std::array<float,2>{0.477746904f, 0.97264874f},
-std::array<float,2>{0.715554833f, 0.383733898f},
-std::array<float,2>{0.385419756f, 0.0759825259f},
-std::array<float,2>{0.646025062f, 0.581376433f},
-std::array<float,2>{0.224232793f, 0.806515276f},
-std::array<float,2>{0.757973552f, 0.311616957f},
-std::array<float,2>{0.0879846215f, 0.437976003f},
-std::array<float,2>{0.971400857f, 0.927077353f},
-std::array<float,2>{0.312252432f, 0.655063748f},
-std::array<float,2>{0.585401535f, 0.186739147f},
-std::array<float,2>{0.450065911f, 0.408622861f},
-std::array<float,2>{0.721057892f, 0.956164002f},
-std::array<float,2>{0.175883278f, 0.740787685f},
-std::array<float,2>{0.85167098f, 0.199044049f},
-std::array<float,2>{0.0590725802f, 0.0119951777f},
-std::array<float,2>{0.892681181f, 0.517761648f},
-std::array<float,2>{0.313426226f, 0.871366799f},
-std::array<float,2>{0.554926932f, 0.352013439f},
-std::array<float,2>{0.256454438f, 0.143252939f},
-std::array<float,2>{0.61280328f, 0.686187983f},
-std::array<float,2>{0.1218253f, 0.883037269f},
-std::array<float,2>{0.950841665f, 0.476033956f},
-std::array<float,2>{0.187571362f, 0.251737237f},
-std::array<float,2>{0.793965578f, 0.774108231f},
-std::array<float,2>{0.430733263f, 0.599479377f},
-std::array<float,2>{0.68082118f, 0.100951955f},
-std::array<float,2>{0.336710542f, 0.477293551f},
-std::array<float,2>{0.532890558f, 0.876988709f},
-std::array<float,2>{0.0392183699f, 0.678734004f},
-std::array<float,2>{0.876596332f, 0.153628796f},
-std::array<float,2>{0.170976937f, 0.108592913f},
-std::array<float,2>{0.864928961f, 0.606682837f},
-std::array<float,2>{0.456066787f, 0.77286917f},
-std::array<float,2>{0.740398705f, 0.263390034f},
-std::array<float,2>{0.409049571f, 0.193269417f},
-std::array<float,2>{0.659282744f, 0.743500471f},
-std::array<float,2>{0.205407843f, 0.961935997f},
-std::array<float,2>{0.810452402f, 0.421523631f},
-std::array<float,2>{0.106772691f, 0.345808089f},
-std::array<float,2>{0.956632316f, 0.864887655f},
-std::array<float,2>{0.265760958f, 0.530246675f},
-std::array<float,2>{0.607327521f, 0.00379919936f},
-std::array<float,2>{0.496981949f, 0.298177838f},
-std::array<float,2>{0.6921978f, 0.798371673f},
-std::array<float,2>{0.133313626f, 0.59125793f},
-std::array<float,2>{0.826725066f, 0.0642056242f},
-std::array<float,2>{0.0148732653f, 0.17860423f},
-std::array<float,2>{0.934081972f, 0.643832684f},
-std::array<float,2>{0.369703859f, 0.93060118f},
-std::array<float,2>{0.513517201f, 0.445751369f},
-std::array<float,2>{0.288404942f, 0.0367580317f},
-std::array<float,2>{0.567030132f, 0.537355542f},
-std::array<float,2>{0.0632162392f, 0.821024537f},
-std::array<float,2>{0.990714312f, 0.33622998f},
-std::array<float,2>{0.24802649f, 0.375537246f},
-std::array<float,2>{0.777386487f, 0.977986515f},
-std::array<float,2>{0.405275047f, 0.711476445f},
-std::array<float,2>{0.631067812f, 0.241197541f},
-std::array<float,2>{0.253095895f, 0.321771145f},
-std::array<float,2>{0.616098523f, 0.82952106f},
-std::array<float,2>{0.117524631f, 0.55466783f},
-std::array<float,2>{0.947126389f, 0.0613518059f},
-std::array<float,2>{0.193508103f, 0.222825706f},
-std::array<float,2>{0.79254216f, 0.689659417f},
-std::array<float,2>{0.437182248f, 0.99889797f},
-std::array<float,2>{0.68383944f, 0.393378556f},
-std::array<float,2>{0.44618091f, 0.0897806808f},
-std::array<float,2>{0.725154459f, 0.572164714f},
-std::array<float,2>{0.173638999f, 0.787503719f},
-std::array<float,2>{0.855864406f, 0.294149995f},
-std::array<float,2>{0.0565506332f, 0.467044383f},
-std::array<float,2>{0.897382557f, 0.91701442f},
-std::array<float,2>{0.319986284f, 0.629360259f},
-std::array<float,2>{0.562428296f, 0.164631978f},
-std::array<float,2>{0.389492869f, 0.423563153f},
-std::array<float,2>{0.64223069f, 0.939757943f},
-std::array<float,2>{0.219960213f, 0.728745818f},
-std::array<float,2>{0.762537479f, 0.205323994f},
-std::array<float,2>{0.0902429447f, 0.0264198501f},
-std::array<float,2>{0.975740254f, 0.512810409f},
-std::array<float,2>{0.30752784f, 0.848693728f},
-std::array<float,2>{0.578712761f, 0.373794049f},
-std::array<float,2>{0.359048218f, 0.132766992f},
-std::array<float,2>{0.522035539f, 0.66142869f},
-std::array<float,2>{0.0300258268f, 0.89232856f},
-std::array<float,2>{0.910085917f, 0.485796869f},
-std::array<float,2>{0.140915945f, 0.27948752f},
-std::array<float,2>{0.842431366f, 0.758001149f},
-std::array<float,2>{0.480964214f, 0.620645225f},
-std::array<float,2>{0.714192867f, 0.113581151f},
-std::array<float,2>{0.298588395f, 0.398995996f},
-std::array<float,2>{0.593421161f, 0.98568356f},
-std::array<float,2>{0.0828862637f, 0.703118086f},
-std::array<float,2>{0.982930601f, 0.228083909f},
-std::array<float,2>{0.234144494f, 0.0495588593f},
-std::array<float,2>{0.751147747f, 0.555388153f},
-std::array<float,2>{0.380444527f, 0.841770232f},
-std::array<float,2>{0.653334677f, 0.314365596f},
-std::array<float,2>{0.473810017f, 0.162134513f},
-std::array<float,2>{0.703640342f, 0.637213349f},
-std::array<float,2>{0.154624268f, 0.908013284f},
-std::array<float,2>{0.83051461f, 0.455773562f},
-std::array<float,2>{0.0202656295f, 0.288153142f},
-std::array<float,2>{0.917347968f, 0.790559828f},
-std::array<float,2>{0.35089916f, 0.563449204f},
-std::array<float,2>{0.528516233f, 0.0787510276f},
-std::array<float,2>{0.424082816f, 0.366348952f},
-std::array<float,2>{0.674843132f, 0.856291175f},
-std::array<float,2>{0.201723963f, 0.501419306f},
-std::array<float,2>{0.782139599f, 0.0222392101f},
-std::array<float,2>{0.110485643f, 0.21259214f},
-std::array<float,2>{0.944964528f, 0.720615983f},
-std::array<float,2>{0.263047248f, 0.94830507f},
-std::array<float,2>{0.623874187f, 0.431320757f},
-std::array<float,2>{0.324926287f, 0.120074309f},
-std::array<float,2>{0.551580012f, 0.614682734f},
-std::array<float,2>{0.0503056273f, 0.751206875f},
-std::array<float,2>{0.90257585f, 0.271599114f},
-std::array<float,2>{0.180259392f, 0.497305602f},
-std::array<float,2>{0.850802064f, 0.89948529f},
-std::array<float,2>{0.44276017f, 0.666232705f},
-std::array<float,2>{0.729468524f, 0.13837865f},
-std::array<float,2>{0.362740487f, 0.257160217f},
-std::array<float,2>{0.506455719f, 0.779677093f},
-std::array<float,2>{0.00211796118f, 0.595189214f},
-std::array<float,2>{0.92953831f, 0.0958803818f},
-std::array<float,2>{0.130018353f, 0.14526774f},
-std::array<float,2>{0.814927638f, 0.680438936f},
-std::array<float,2>{0.488801003f, 0.889787197f},
-std::array<float,2>{0.6961748f, 0.472325474f},
-std::array<float,2>{0.390724331f, 0.00793005247f},
-std::array<float,2>{0.634959638f, 0.52120924f},
-std::array<float,2>{0.238721713f, 0.870851159f},
-std::array<float,2>{0.768786669f, 0.357926369f},
-std::array<float,2>{0.0705071464f, 0.41383031f},
-std::array<float,2>{0.99496448f, 0.957808733f},
-std::array<float,2>{0.294405401f, 0.736221015f},
-std::array<float,2>{0.571537435f, 0.201942384f},
-std::array<float,2>{0.467333645f, 0.442038119f},
-std::array<float,2>{0.743836164f, 0.922732711f},
-std::array<float,2>{0.160679474f, 0.650884271f},
-std::array<float,2>{0.872846127f, 0.183454856f},
-std::array<float,2>{0.0317314528f, 0.0715614855f},
-std::array<float,2>{0.885642111f, 0.582322717f},
-std::array<float,2>{0.334690303f, 0.80965662f},
-std::array<float,2>{0.545567632f, 0.305509239f},
-std::array<float,2>{0.277644426f, 0.247685134f},
-std::array<float,2>{0.594713926f, 0.709307969f},
-std::array<float,2>{0.0958866403f, 0.974718213f},
-std::array<float,2>{0.961735189f, 0.386775583f},
-std::array<float,2>{0.215625241f, 0.332386136f},
-std::array<float,2>{0.801908374f, 0.813886464f},
-std::array<float,2>{0.418609619f, 0.54063642f},
-std::array<float,2>{0.668131232f, 0.0400205888f},
-std::array<float,2>{0.344207019f, 0.417846054f},
-std::array<float,2>{0.525706351f, 0.968723178f},
-std::array<float,2>{0.0157864355f, 0.748336852f},
-std::array<float,2>{0.919221759f, 0.190545902f},
-std::array<float,2>{0.14868845f, 0.00446756557f},
-std::array<float,2>{0.83545512f, 0.523506224f},
-std::array<float,2>{0.47182551f, 0.860062361f},
-std::array<float,2>{0.707735598f, 0.347910911f},
-std::array<float,2>{0.378248692f, 0.152237162f},
-std::array<float,2>{0.651136458f, 0.673560023f},
-std::array<float,2>{0.229046568f, 0.879378736f},
-std::array<float,2>{0.75418824f, 0.482720107f},
-std::array<float,2>{0.081021063f, 0.258075863f},
-std::array<float,2>{0.978744924f, 0.766860187f},
-std::array<float,2>{0.303184807f, 0.603216827f},
-std::array<float,2>{0.589163899f, 0.103053875f},
-std::array<float,2>{0.439033449f, 0.339883f},
-std::array<float,2>{0.732362866f, 0.827962875f},
-std::array<float,2>{0.186369836f, 0.533788383f},
-std::array<float,2>{0.847232401f, 0.0337182507f},
-std::array<float,2>{0.0511247776f, 0.235079005f},
-std::array<float,2>{0.899867773f, 0.718055606f},
-std::array<float,2>{0.321280241f, 0.981043994f},
-std::array<float,2>{0.547975361f, 0.378943354f},
-std::array<float,2>{0.258965939f, 0.068219021f},
-std::array<float,2>{0.620803893f, 0.586721718f},
-std::array<float,2>{0.113577425f, 0.802381635f},
-std::array<float,2>{0.940068662f, 0.304354429f},
-std::array<float,2>{0.199072421f, 0.450473428f},
-std::array<float,2>{0.786970139f, 0.935836315f},
-std::array<float,2>{0.426275849f, 0.644824028f},
-std::array<float,2>{0.678842127f, 0.175229296f},
-std::array<float,2>{0.29053241f, 0.292610824f},
-std::array<float,2>{0.57787478f, 0.78451848f},
-std::array<float,2>{0.0768025666f, 0.577371716f},
-std::array<float,2>{0.996271908f, 0.0935433283f},
-std::array<float,2>{0.237079412f, 0.170752183f},
-std::array<float,2>{0.772917032f, 0.626404703f},
-std::array<float,2>{0.3972435f, 0.920466006f},
-std::array<float,2>{0.637684703f, 0.463780969f},
-std::array<float,2>{0.484506309f, 0.0565403216f},
-std::array<float,2>{0.70269078f, 0.548199713f},
-std::array<float,2>{0.126806334f, 0.83562094f},
-std::array<float,2>{0.816879034f, 0.326113433f},
-std::array<float,2>{0.00446121674f, 0.396420687f},
-std::array<float,2>{0.924403846f, 0.994453013f},
-std::array<float,2>{0.363966942f, 0.691944122f},
-std::array<float,2>{0.500669539f, 0.220175639f},
-std::array<float,2>{0.415358126f, 0.492148519f},
-std::array<float,2>{0.667210817f, 0.895575583f},
-std::array<float,2>{0.211989418f, 0.657865405f},
-std::array<float,2>{0.798932791f, 0.12660639f},
-std::array<float,2>{0.0990915298f, 0.109962545f},
-std::array<float,2>{0.966064811f, 0.621565282f},
-std::array<float,2>{0.27418229f, 0.764988661f},
-std::array<float,2>{0.60117799f, 0.275661618f},
-std::array<float,2>{0.329890937f, 0.20899795f},
-std::array<float,2>{0.542767465f, 0.73372376f},
-std::array<float,2>{0.0359716341f, 0.944688261f},
-std::array<float,2>{0.88957274f, 0.429170281f},
-std::array<float,2>{0.159786388f, 0.368804514f},
-std::array<float,2>{0.869366765f, 0.847570419f},
-std::array<float,2>{0.461265445f, 0.511653066f},
-std::array<float,2>{0.749172926f, 0.0291236825f},
-std::array<float,2>{0.271087915f, 0.460194796f},
-std::array<float,2>{0.602980316f, 0.912197411f},
-std::array<float,2>{0.103071339f, 0.635574877f},
-std::array<float,2>{0.957879603f, 0.15786694f},
-std::array<float,2>{0.207185715f, 0.0846270248f},
-std::array<float,2>{0.805132627f, 0.569262743f},
-std::array<float,2>{0.413918942f, 0.79553175f},
-std::array<float,2>{0.664041936f, 0.285006553f},
-std::array<float,2>{0.458191842f, 0.232704923f},
-std::array<float,2>{0.734470308f, 0.695372522f},
-std::array<float,2>{0.164394364f, 0.991859734f},
-std::array<float,2>{0.859506845f, 0.403482765f},
-std::array<float,2>{0.0466932803f, 0.317723095f},
-std::array<float,2>{0.87981379f, 0.837212443f},
-std::array<float,2>{0.341457129f, 0.561647356f},
-std::array<float,2>{0.535610259f, 0.0539065897f},
-std::array<float,2>{0.400842339f, 0.266731203f},
-std::array<float,2>{0.625419736f, 0.755297363f},
-std::array<float,2>{0.245628849f, 0.61236006f},
-std::array<float,2>{0.774284422f, 0.123672239f},
-std::array<float,2>{0.0681295246f, 0.133634776f},
-std::array<float,2>{0.987808585f, 0.668476701f},
-std::array<float,2>{0.281385511f, 0.904638588f},
-std::array<float,2>{0.562539041f, 0.495784044f},
-std::array<float,2>{0.372723699f, 0.0163234621f},
-std::array<float,2>{0.511337221f, 0.504844248f},
-std::array<float,2>{0.0111071886f, 0.853138685f},
-std::array<float,2>{0.931940794f, 0.362841189f},
-std::array<float,2>{0.137934253f, 0.436421752f},
-std::array<float,2>{0.821457624f, 0.951921225f},
-std::array<float,2>{0.495357364f, 0.725035906f},
-std::array<float,2>{0.689365387f, 0.21649605f},
-std::array<float,2>{0.31536898f, 0.35448879f},
-std::array<float,2>{0.557691038f, 0.874096751f},
-std::array<float,2>{0.0612629801f, 0.51688385f},
-std::array<float,2>{0.891056776f, 0.0140101453f},
-std::array<float,2>{0.179193825f, 0.197005689f},
-std::array<float,2>{0.854144096f, 0.739359319f},
-std::array<float,2>{0.452447832f, 0.953529418f},
-std::array<float,2>{0.720579684f, 0.406366736f},
-std::array<float,2>{0.432103455f, 0.0985498577f},
-std::array<float,2>{0.682323933f, 0.600443006f},
-std::array<float,2>{0.189727515f, 0.775681317f},
-std::array<float,2>{0.795882046f, 0.253121108f},
-std::array<float,2>{0.124637395f, 0.473489344f},
-std::array<float,2>{0.952562034f, 0.886214852f},
-std::array<float,2>{0.255411267f, 0.685461938f},
-std::array<float,2>{0.609893322f, 0.141292855f},
-std::array<float,2>{0.478662133f, 0.384870887f},
-std::array<float,2>{0.717490554f, 0.969802439f},
-std::array<float,2>{0.14550142f, 0.706557512f},
-std::array<float,2>{0.839555085f, 0.242843151f},
-std::array<float,2>{0.0271212365f, 0.0467491113f},
-std::array<float,2>{0.91306442f, 0.542991519f},
-std::array<float,2>{0.352555811f, 0.818293095f},
-std::array<float,2>{0.516995668f, 0.330105126f},
-std::array<float,2>{0.309906781f, 0.184127256f},
-std::array<float,2>{0.583757341f, 0.653648138f},
-std::array<float,2>{0.0860113055f, 0.928600967f},
-std::array<float,2>{0.969939351f, 0.439834177f},
-std::array<float,2>{0.226257861f, 0.309829384f},
-std::array<float,2>{0.759872675f, 0.808525085f},
-std::array<float,2>{0.383627385f, 0.579113603f},
-std::array<float,2>{0.647351801f, 0.0774902776f},
-std::array<float,2>{0.356131613f, 0.484711915f},
-std::array<float,2>{0.520096898f, 0.891576827f},
-std::array<float,2>{0.0285304692f, 0.661128044f},
-std::array<float,2>{0.906534135f, 0.13131237f},
-std::array<float,2>{0.143632248f, 0.115146779f},
-std::array<float,2>{0.84101963f, 0.61969018f},
-std::array<float,2>{0.48350668f, 0.759559453f},
-std::array<float,2>{0.712029576f, 0.281148046f},
-std::array<float,2>{0.387314618f, 0.206426948f},
-std::array<float,2>{0.643131852f, 0.729673684f},
-std::array<float,2>{0.220980868f, 0.941338122f},
-std::array<float,2>{0.76507616f, 0.421891809f},
-std::array<float,2>{0.0926085413f, 0.374106228f},
-std::array<float,2>{0.974378347f, 0.848053157f},
-std::array<float,2>{0.306165725f, 0.51171881f},
-std::array<float,2>{0.580293f, 0.0255640484f},
-std::array<float,2>{0.447311938f, 0.293035567f},
-std::array<float,2>{0.724267542f, 0.788910866f},
-std::array<float,2>{0.175466418f, 0.570402861f},
-std::array<float,2>{0.857975602f, 0.0884944499f},
-std::array<float,2>{0.057511393f, 0.16509594f},
-std::array<float,2>{0.894726038f, 0.630028009f},
-std::array<float,2>{0.317431659f, 0.916216373f},
-std::array<float,2>{0.558985591f, 0.468529075f},
-std::array<float,2>{0.251903892f, 0.0623404533f},
-std::array<float,2>{0.613731563f, 0.553397059f},
-std::array<float,2>{0.119722895f, 0.828320742f},
-std::array<float,2>{0.94738102f, 0.320941418f},
-std::array<float,2>{0.192543894f, 0.394311249f},
-std::array<float,2>{0.79094851f, 0.999088824f},
-std::array<float,2>{0.435423046f, 0.690465868f},
-std::array<float,2>{0.687264502f, 0.223848164f},
-std::array<float,2>{0.285538942f, 0.33738333f},
-std::array<float,2>{0.569884777f, 0.821826458f},
-std::array<float,2>{0.0655758083f, 0.538091838f},
-std::array<float,2>{0.989136279f, 0.0358077064f},
-std::array<float,2>{0.248954549f, 0.24195233f},
-std::array<float,2>{0.779397845f, 0.712679446f},
-std::array<float,2>{0.403550237f, 0.977316737f},
-std::array<float,2>{0.629967868f, 0.376054406f},
-std::array<float,2>{0.499558836f, 0.0633820742f},
-std::array<float,2>{0.694698334f, 0.59008956f},
-std::array<float,2>{0.134884089f, 0.797831714f},
-std::array<float,2>{0.824399531f, 0.297009706f},
-std::array<float,2>{0.0118274558f, 0.446958959f},
-std::array<float,2>{0.936648726f, 0.930944204f},
-std::array<float,2>{0.368366301f, 0.642878354f},
-std::array<float,2>{0.514638424f, 0.179547727f},
-std::array<float,2>{0.407382727f, 0.420741379f},
-std::array<float,2>{0.6569224f, 0.961610973f},
-std::array<float,2>{0.203887239f, 0.742262006f},
-std::array<float,2>{0.812482476f, 0.192151964f},
-std::array<float,2>{0.10932228f, 0.00242963992f},
-std::array<float,2>{0.954696059f, 0.531122863f},
-std::array<float,2>{0.268993884f, 0.864161491f},
-std::array<float,2>{0.608699262f, 0.347179145f},
-std::array<float,2>{0.339762688f, 0.152687386f},
-std::array<float,2>{0.533616066f, 0.67863512f},
-std::array<float,2>{0.041776184f, 0.878445089f},
-std::array<float,2>{0.877712369f, 0.477763772f},
-std::array<float,2>{0.168044567f, 0.26214543f},
-std::array<float,2>{0.866919696f, 0.772303522f},
-std::array<float,2>{0.454097271f, 0.606139779f},
-std::array<float,2>{0.74023217f, 0.108374245f},
-std::array<float,2>{0.28122285f, 0.387740284f},
-std::array<float,2>{0.596920609f, 0.976279795f},
-std::array<float,2>{0.0954113901f, 0.710169315f},
-std::array<float,2>{0.964215636f, 0.246736124f},
-std::array<float,2>{0.21740894f, 0.0405406021f},
-std::array<float,2>{0.803203583f, 0.539230108f},
-std::array<float,2>{0.42098543f, 0.813452601f},
-std::array<float,2>{0.671497822f, 0.333850235f},
-std::array<float,2>{0.466291875f, 0.181882471f},
-std::array<float,2>{0.745076656f, 0.651953816f},
-std::array<float,2>{0.162253767f, 0.923054576f},
-std::array<float,2>{0.873236537f, 0.443009973f},
-std::array<float,2>{0.0340632051f, 0.30636698f},
-std::array<float,2>{0.88312006f, 0.808784604f},
-std::array<float,2>{0.332864851f, 0.583190918f},
-std::array<float,2>{0.543613791f, 0.0709339827f},
-std::array<float,2>{0.393546849f, 0.359212667f},
-std::array<float,2>{0.634007275f, 0.869520664f},
-std::array<float,2>{0.241621941f, 0.520255268f},
-std::array<float,2>{0.76574266f, 0.00942449365f},
-std::array<float,2>{0.0737747699f, 0.203124836f},
-std::array<float,2>{0.99375391f, 0.734728396f},
-std::array<float,2>{0.296864986f, 0.958687067f},
-std::array<float,2>{0.572485924f, 0.412618369f},
-std::array<float,2>{0.359964311f, 0.0970329568f},
-std::array<float,2>{0.504325151f, 0.594242334f},
-std::array<float,2>{0.0010845589f, 0.780938148f},
-std::array<float,2>{0.927269161f, 0.255984098f},
-std::array<float,2>{0.131089106f, 0.471045792f},
-std::array<float,2>{0.81395036f, 0.88899821f},
-std::array<float,2>{0.490617573f, 0.681430936f},
-std::array<float,2>{0.69881928f, 0.145635024f},
-std::array<float,2>{0.326749921f, 0.272811651f},
-std::array<float,2>{0.553573966f, 0.750509501f},
-std::array<float,2>{0.0485696495f, 0.614253461f},
-std::array<float,2>{0.904946625f, 0.120989822f},
-std::array<float,2>{0.18212992f, 0.136854649f},
-std::array<float,2>{0.847725213f, 0.667102337f},
-std::array<float,2>{0.443744183f, 0.899085104f},
-std::array<float,2>{0.727745056f, 0.496781528f},
-std::array<float,2>{0.422762334f, 0.0228153747f},
-std::array<float,2>{0.673201144f, 0.500697672f},
-std::array<float,2>{0.199761957f, 0.857000887f},
-std::array<float,2>{0.783880293f, 0.365451366f},
-std::array<float,2>{0.112333506f, 0.42974326f},
-std::array<float,2>{0.941935182f, 0.947862685f},
-std::array<float,2>{0.264661252f, 0.719670296f},
-std::array<float,2>{0.621634185f, 0.211704344f},
-std::array<float,2>{0.475138783f, 0.456076145f},
-std::array<float,2>{0.706357956f, 0.906806588f},
-std::array<float,2>{0.154082492f, 0.638023317f},
-std::array<float,2>{0.828857243f, 0.163237795f},
-std::array<float,2>{0.0219009053f, 0.0800613239f},
-std::array<float,2>{0.915790915f, 0.563877523f},
-std::array<float,2>{0.348354429f, 0.789947212f},
-std::array<float,2>{0.531151891f, 0.287626833f},
-std::array<float,2>{0.299752563f, 0.22734262f},
-std::array<float,2>{0.590361416f, 0.701443553f},
-std::array<float,2>{0.0848264843f, 0.984882116f},
-std::array<float,2>{0.980674922f, 0.400358707f},
-std::array<float,2>{0.230732232f, 0.313013285f},
-std::array<float,2>{0.753055453f, 0.839949548f},
-std::array<float,2>{0.381878048f, 0.555873513f},
-std::array<float,2>{0.656057715f, 0.0500422381f},
-std::array<float,2>{0.331348121f, 0.428515047f},
-std::array<float,2>{0.540093124f, 0.943984449f},
-std::array<float,2>{0.0376349688f, 0.732477129f},
-std::array<float,2>{0.888130188f, 0.210346118f},
-std::array<float,2>{0.156987265f, 0.0274624247f},
-std::array<float,2>{0.867553174f, 0.50986743f},
-std::array<float,2>{0.463295102f, 0.846531451f},
-std::array<float,2>{0.74684602f, 0.367910028f},
-std::array<float,2>{0.41703245f, 0.125633344f},
-std::array<float,2>{0.665858209f, 0.656466126f},
-std::array<float,2>{0.214280084f, 0.89540261f},
-std::array<float,2>{0.798433661f, 0.490530044f},
-std::array<float,2>{0.100614369f, 0.276694894f},
-std::array<float,2>{0.967131078f, 0.763833046f},
-std::array<float,2>{0.275950074f, 0.622672439f},
-std::array<float,2>{0.599124551f, 0.110966332f},
-std::array<float,2>{0.486694992f, 0.324828982f},
-std::array<float,2>{0.7007249f, 0.834439397f},
-std::array<float,2>{0.128858253f, 0.547824264f},
-std::array<float,2>{0.819581985f, 0.0555263795f},
-std::array<float,2>{0.00694804173f, 0.219364151f},
-std::array<float,2>{0.922165811f, 0.692934692f},
-std::array<float,2>{0.366733402f, 0.995174289f},
-std::array<float,2>{0.503093839f, 0.394867033f},
-std::array<float,2>{0.292456836f, 0.09234716f},
-std::array<float,2>{0.574594498f, 0.576430023f},
-std::array<float,2>{0.07541053f, 0.783731997f},
-std::array<float,2>{0.999156952f, 0.291759312f},
-std::array<float,2>{0.23512736f, 0.464087754f},
-std::array<float,2>{0.769914567f, 0.921364784f},
-std::array<float,2>{0.396040976f, 0.625832975f},
-std::array<float,2>{0.640309632f, 0.170932144f},
-std::array<float,2>{0.260806084f, 0.302829057f},
-std::array<float,2>{0.617316723f, 0.80142808f},
-std::array<float,2>{0.116254508f, 0.587309659f},
-std::array<float,2>{0.937689602f, 0.0664842948f},
-std::array<float,2>{0.195446298f, 0.174493194f},
-std::array<float,2>{0.788902342f, 0.645932198f},
-std::array<float,2>{0.428748101f, 0.937337995f},
-std::array<float,2>{0.676068544f, 0.449289411f},
-std::array<float,2>{0.439740062f, 0.0345102362f},
-std::array<float,2>{0.733197927f, 0.535041034f},
-std::array<float,2>{0.184817821f, 0.82710433f},
-std::array<float,2>{0.844847798f, 0.340865672f},
-std::array<float,2>{0.0543887876f, 0.380682886f},
-std::array<float,2>{0.900868535f, 0.982052565f},
-std::array<float,2>{0.32274887f, 0.717212319f},
-std::array<float,2>{0.549292326f, 0.235951468f},
-std::array<float,2>{0.375473082f, 0.484268636f},
-std::array<float,2>{0.649278879f, 0.880684853f},
-std::array<float,2>{0.227026433f, 0.672158599f},
-std::array<float,2>{0.757011771f, 0.151266888f},
-std::array<float,2>{0.0781780556f, 0.101837426f},
-std::array<float,2>{0.976613939f, 0.60173142f},
-std::array<float,2>{0.301698148f, 0.76631701f},
-std::array<float,2>{0.587110877f, 0.259482682f},
-std::array<float,2>{0.34580043f, 0.190110609f},
-std::array<float,2>{0.524092197f, 0.749174297f},
-std::array<float,2>{0.0188107938f, 0.967263639f},
-std::array<float,2>{0.921430886f, 0.416876704f},
-std::array<float,2>{0.15226008f, 0.34903717f},
-std::array<float,2>{0.83323282f, 0.860746503f},
-std::array<float,2>{0.470689476f, 0.524824858f},
-std::array<float,2>{0.710603297f, 0.00545333186f},
-std::array<float,2>{0.311158031f, 0.441016465f},
-std::array<float,2>{0.584885478f, 0.92908287f},
-std::array<float,2>{0.0889656767f, 0.653126001f},
-std::array<float,2>{0.972369909f, 0.184960887f},
-std::array<float,2>{0.223248914f, 0.0771040693f},
-std::array<float,2>{0.759542108f, 0.578814268f},
-std::array<float,2>{0.386534512f, 0.807580233f},
-std::array<float,2>{0.644592762f, 0.309282869f},
-std::array<float,2>{0.4771052f, 0.243849471f},
-std::array<float,2>{0.716689587f, 0.705688894f},
-std::array<float,2>{0.147364289f, 0.968918979f},
-std::array<float,2>{0.83713913f, 0.386238426f},
-std::array<float,2>{0.025332462f, 0.331571192f},
-std::array<float,2>{0.91078186f, 0.816764891f},
-std::array<float,2>{0.355264306f, 0.544584334f},
-std::array<float,2>{0.519515276f, 0.0458919033f},
-std::array<float,2>{0.430358708f, 0.252799064f},
-std::array<float,2>{0.679808557f, 0.776981413f},
-std::array<float,2>{0.188575879f, 0.600849211f},
-std::array<float,2>{0.79351598f, 0.0987268835f},
-std::array<float,2>{0.122090474f, 0.142401189f},
-std::array<float,2>{0.949727714f, 0.684349597f},
-std::array<float,2>{0.257649988f, 0.885143518f},
-std::array<float,2>{0.612124026f, 0.474006653f},
-std::array<float,2>{0.313737661f, 0.0147672147f},
-std::array<float,2>{0.556566417f, 0.516576588f},
-std::array<float,2>{0.0602286346f, 0.873608112f},
-std::array<float,2>{0.894158602f, 0.355361938f},
-std::array<float,2>{0.176788941f, 0.407316148f},
-std::array<float,2>{0.853265882f, 0.954120576f},
-std::array<float,2>{0.450564593f, 0.73901242f},
-std::array<float,2>{0.721743643f, 0.195556641f},
-std::array<float,2>{0.373809725f, 0.361533195f},
-std::array<float,2>{0.508317173f, 0.851977289f},
-std::array<float,2>{0.00882860832f, 0.505557656f},
-std::array<float,2>{0.929913402f, 0.0173357259f},
-std::array<float,2>{0.13940607f, 0.215231746f},
-std::array<float,2>{0.822813213f, 0.725618958f},
-std::array<float,2>{0.492648125f, 0.953104198f},
-std::array<float,2>{0.689455688f, 0.437178344f},
-std::array<float,2>{0.398444325f, 0.124273628f},
-std::array<float,2>{0.627932131f, 0.611951768f},
-std::array<float,2>{0.243571624f, 0.75421387f},
-std::array<float,2>{0.77642566f, 0.26629442f},
-std::array<float,2>{0.0701473951f, 0.494454533f},
-std::array<float,2>{0.985202014f, 0.906190455f},
-std::array<float,2>{0.284335732f, 0.66923821f},
-std::array<float,2>{0.566093326f, 0.134653702f},
-std::array<float,2>{0.460707694f, 0.40239501f},
-std::array<float,2>{0.738173187f, 0.99068898f},
-std::array<float,2>{0.166610301f, 0.696826637f},
-std::array<float,2>{0.862616539f, 0.233505964f},
-std::array<float,2>{0.0437778607f, 0.0535459965f},
-std::array<float,2>{0.880945504f, 0.560575902f},
-std::array<float,2>{0.342056304f, 0.836880684f},
-std::array<float,2>{0.538301528f, 0.316755831f},
-std::array<float,2>{0.272512376f, 0.157057956f},
-std::array<float,2>{0.604774475f, 0.636460364f},
-std::array<float,2>{0.104310624f, 0.913426459f},
-std::array<float,2>{0.959855914f, 0.459700525f},
-std::array<float,2>{0.209245026f, 0.283780336f},
-std::array<float,2>{0.807472885f, 0.796228051f},
-std::array<float,2>{0.410687387f, 0.569445968f},
-std::array<float,2>{0.661741197f, 0.0849759281f},
-std::array<float,2>{0.319313556f, 0.466003031f},
-std::array<float,2>{0.561510205f, 0.914161503f},
-std::array<float,2>{0.0551344007f, 0.631786466f},
-std::array<float,2>{0.898156285f, 0.166405737f},
-std::array<float,2>{0.172199994f, 0.0878844634f},
-std::array<float,2>{0.857259095f, 0.573073506f},
-std::array<float,2>{0.446936518f, 0.786300361f},
-std::array<float,2>{0.725733519f, 0.295107186f},
-std::array<float,2>{0.435871094f, 0.225908563f},
-std::array<float,2>{0.685014665f, 0.687722921f},
-std::array<float,2>{0.194474682f, 0.996152699f},
-std::array<float,2>{0.791125774f, 0.391732454f},
-std::array<float,2>{0.119107746f, 0.32242924f},
-std::array<float,2>{0.945542097f, 0.830709875f},
-std::array<float,2>{0.252673239f, 0.551139951f},
-std::array<float,2>{0.616626143f, 0.0592942499f},
-std::array<float,2>{0.481915206f, 0.279170364f},
-std::array<float,2>{0.713462412f, 0.760122597f},
-std::array<float,2>{0.142383412f, 0.618790686f},
-std::array<float,2>{0.843378305f, 0.115744732f},
-std::array<float,2>{0.0302823372f, 0.129656762f},
-std::array<float,2>{0.909170032f, 0.663206875f},
-std::array<float,2>{0.358033061f, 0.89327234f},
-std::array<float,2>{0.523210049f, 0.486393601f},
-std::array<float,2>{0.308237076f, 0.0247691106f},
-std::array<float,2>{0.579745471f, 0.51521945f},
-std::array<float,2>{0.0914011151f, 0.849951982f},
-std::array<float,2>{0.974875391f, 0.371191293f},
-std::array<float,2>{0.219110936f, 0.424558967f},
-std::array<float,2>{0.762904704f, 0.939208448f},
-std::array<float,2>{0.39022097f, 0.727256477f},
-std::array<float,2>{0.64127934f, 0.204754502f},
-std::array<float,2>{0.266899109f, 0.345268488f},
-std::array<float,2>{0.606417358f, 0.866075337f},
-std::array<float,2>{0.106051907f, 0.528883517f},
-std::array<float,2>{0.956004798f, 0.000947470602f},
-std::array<float,2>{0.206475675f, 0.194138378f},
-std::array<float,2>{0.80881834f, 0.745952427f},
-std::array<float,2>{0.409282893f, 0.962945282f},
-std::array<float,2>{0.659102738f, 0.419662625f},
-std::array<float,2>{0.45552513f, 0.107170485f},
-std::array<float,2>{0.741626382f, 0.609125912f},
-std::array<float,2>{0.170196876f, 0.770862162f},
-std::array<float,2>{0.863783658f, 0.264540762f},
-std::array<float,2>{0.0400870629f, 0.478822172f},
-std::array<float,2>{0.875507593f, 0.87649703f},
-std::array<float,2>{0.337474018f, 0.676152706f},
-std::array<float,2>{0.531839848f, 0.154367268f},
-std::array<float,2>{0.404429704f, 0.377998829f},
-std::array<float,2>{0.632431924f, 0.979376197f},
-std::array<float,2>{0.246944696f, 0.714210033f},
-std::array<float,2>{0.778380871f, 0.239988431f},
-std::array<float,2>{0.0640664101f, 0.038994208f},
-std::array<float,2>{0.991531193f, 0.537045479f},
-std::array<float,2>{0.288009644f, 0.823268175f},
-std::array<float,2>{0.568266749f, 0.338569194f},
-std::array<float,2>{0.370365202f, 0.176502272f},
-std::array<float,2>{0.511999369f, 0.641929448f},
-std::array<float,2>{0.0141405389f, 0.932654142f},
-std::array<float,2>{0.935245037f, 0.448242873f},
-std::array<float,2>{0.134667858f, 0.299077243f},
-std::array<float,2>{0.827803314f, 0.799617708f},
-std::array<float,2>{0.497644842f, 0.592291653f},
-std::array<float,2>{0.692697108f, 0.0645306259f},
-std::array<float,2>{0.293028295f, 0.411322206f},
-std::array<float,2>{0.571020663f, 0.960435629f},
-std::array<float,2>{0.0720267519f, 0.73708868f},
-std::array<float,2>{0.995556772f, 0.200684935f},
-std::array<float,2>{0.239759609f, 0.00981553551f},
-std::array<float,2>{0.768481374f, 0.52171272f},
-std::array<float,2>{0.392413795f, 0.868393958f},
-std::array<float,2>{0.636701405f, 0.356958419f},
-std::array<float,2>{0.48932904f, 0.147837684f},
-std::array<float,2>{0.697225869f, 0.682051897f},
-std::array<float,2>{0.129374668f, 0.888238728f},
-std::array<float,2>{0.815708339f, 0.469312072f},
-std::array<float,2>{0.00387790147f, 0.254633725f},
-std::array<float,2>{0.928199649f, 0.777896106f},
-std::array<float,2>{0.361607879f, 0.597266316f},
-std::array<float,2>{0.507783115f, 0.0956965089f},
-std::array<float,2>{0.419479012f, 0.334115446f},
-std::array<float,2>{0.669202983f, 0.814669132f},
-std::array<float,2>{0.215929076f, 0.541877866f},
-std::array<float,2>{0.801029325f, 0.0412013568f},
-std::array<float,2>{0.0969864503f, 0.248759583f},
-std::array<float,2>{0.962040901f, 0.707482874f},
-std::array<float,2>{0.278769225f, 0.973029435f},
-std::array<float,2>{0.5949983f, 0.390063584f},
-std::array<float,2>{0.335568517f, 0.0725034475f},
-std::array<float,2>{0.546720207f, 0.58523947f},
-std::array<float,2>{0.0325965211f, 0.811269701f},
-std::array<float,2>{0.886597574f, 0.307944924f},
-std::array<float,2>{0.16164045f, 0.444459438f},
-std::array<float,2>{0.871416926f, 0.924708128f},
-std::array<float,2>{0.468130082f, 0.650214314f},
-std::array<float,2>{0.742488682f, 0.180164576f},
-std::array<float,2>{0.350403398f, 0.285249352f},
-std::array<float,2>{0.527691066f, 0.792068958f},
-std::array<float,2>{0.0205361173f, 0.565034449f},
-std::array<float,2>{0.916447818f, 0.0819820762f},
-std::array<float,2>{0.155877843f, 0.160853505f},
-std::array<float,2>{0.831748962f, 0.639168382f},
-std::array<float,2>{0.473064601f, 0.908631682f},
-std::array<float,2>{0.704800546f, 0.453291118f},
-std::array<float,2>{0.378976017f, 0.0481883101f},
-std::array<float,2>{0.653011382f, 0.557891846f},
-std::array<float,2>{0.232474074f, 0.841805577f},
-std::array<float,2>{0.750563562f, 0.316139281f},
-std::array<float,2>{0.0833530575f, 0.401340336f},
-std::array<float,2>{0.983529329f, 0.986369967f},
-std::array<float,2>{0.297554106f, 0.699937761f},
-std::array<float,2>{0.591945708f, 0.230406344f},
-std::array<float,2>{0.441992223f, 0.499941409f},
-std::array<float,2>{0.729769349f, 0.901709497f},
-std::array<float,2>{0.181309074f, 0.664469898f},
-std::array<float,2>{0.849686742f, 0.139019907f},
-std::array<float,2>{0.049758736f, 0.118243776f},
-std::array<float,2>{0.903530777f, 0.616544247f},
-std::array<float,2>{0.325239748f, 0.752897143f},
-std::array<float,2>{0.552427649f, 0.2708565f},
-std::array<float,2>{0.262479663f, 0.213054374f},
-std::array<float,2>{0.624786019f, 0.721219659f},
-std::array<float,2>{0.110075407f, 0.946305335f},
-std::array<float,2>{0.943878591f, 0.431799591f},
-std::array<float,2>{0.20245634f, 0.364064455f},
-std::array<float,2>{0.782566547f, 0.859024048f},
-std::array<float,2>{0.425593048f, 0.502610207f},
-std::array<float,2>{0.674470723f, 0.0200266801f},
-std::array<float,2>{0.364974171f, 0.398358822f},
-std::array<float,2>{0.501086414f, 0.993387461f},
-std::array<float,2>{0.00562844006f, 0.694109976f},
-std::array<float,2>{0.925475478f, 0.221013591f},
-std::array<float,2>{0.125722408f, 0.0575119369f},
-std::array<float,2>{0.818012655f, 0.549963295f},
-std::array<float,2>{0.485545129f, 0.83209151f},
-std::array<float,2>{0.701902449f, 0.327384472f},
-std::array<float,2>{0.397508651f, 0.169805288f},
-std::array<float,2>{0.638583004f, 0.628456831f},
-std::array<float,2>{0.237797871f, 0.919227242f},
-std::array<float,2>{0.771531105f, 0.462458014f},
-std::array<float,2>{0.0774921104f, 0.290310502f},
-std::array<float,2>{0.997074425f, 0.782286346f},
-std::array<float,2>{0.289150178f, 0.574473679f},
-std::array<float,2>{0.576977789f, 0.0913349986f},
-std::array<float,2>{0.462617755f, 0.3707169f},
-std::array<float,2>{0.748886228f, 0.844634175f},
-std::array<float,2>{0.159089789f, 0.507893443f},
-std::array<float,2>{0.870825708f, 0.0298657604f},
-std::array<float,2>{0.0366859138f, 0.207537815f},
-std::array<float,2>{0.88965112f, 0.732143819f},
-std::array<float,2>{0.328931719f, 0.942347586f},
-std::array<float,2>{0.54168725f, 0.426142573f},
-std::array<float,2>{0.274605483f, 0.112802185f},
-std::array<float,2>{0.599811554f, 0.624804318f},
-std::array<float,2>{0.098546125f, 0.762069941f},
-std::array<float,2>{0.965123951f, 0.275192708f},
-std::array<float,2>{0.2114833f, 0.489113986f},
-std::array<float,2>{0.800029159f, 0.897947192f},
-std::array<float,2>{0.414077491f, 0.658830762f},
-std::array<float,2>{0.666376472f, 0.127044559f},
-std::array<float,2>{0.303969413f, 0.260373682f},
-std::array<float,2>{0.588094771f, 0.767823279f},
-std::array<float,2>{0.0810953379f, 0.605339646f},
-std::array<float,2>{0.979622543f, 0.104814887f},
-std::array<float,2>{0.229614764f, 0.148749962f},
-std::array<float,2>{0.754906237f, 0.674705803f},
-std::array<float,2>{0.377845049f, 0.8824265f},
-std::array<float,2>{0.651705801f, 0.481094062f},
-std::array<float,2>{0.471341729f, 0.00595468283f},
-std::array<float,2>{0.708483994f, 0.527243555f},
-std::array<float,2>{0.150295287f, 0.862243652f},
-std::array<float,2>{0.83483696f, 0.350518554f},
-std::array<float,2>{0.0172519442f, 0.415746987f},
-std::array<float,2>{0.918178439f, 0.965458453f},
-std::array<float,2>{0.345604032f, 0.747445345f},
-std::array<float,2>{0.527325511f, 0.18860893f},
-std::array<float,2>{0.426960945f, 0.451993972f},
-std::array<float,2>{0.678052068f, 0.935471177f},
-std::array<float,2>{0.197277904f, 0.648145735f},
-std::array<float,2>{0.785416663f, 0.172455102f},
-std::array<float,2>{0.11505504f, 0.0690240487f},
-std::array<float,2>{0.941264689f, 0.589046538f},
-std::array<float,2>{0.258602232f, 0.803894639f},
-std::array<float,2>{0.61985755f, 0.301002711f},
-std::array<float,2>{0.321401179f, 0.237622157f},
-std::array<float,2>{0.547513783f, 0.7163468f},
-std::array<float,2>{0.0527199097f, 0.983646512f},
-std::array<float,2>{0.899034917f, 0.381109029f},
-std::array<float,2>{0.186753049f, 0.342931837f},
-std::array<float,2>{0.845995367f, 0.825061381f},
-std::array<float,2>{0.437813491f, 0.532859981f},
-std::array<float,2>{0.730997145f, 0.0324773379f},
-std::array<float,2>{0.25452435f, 0.47470355f},
-std::array<float,2>{0.611225307f, 0.883963048f},
-std::array<float,2>{0.123293042f, 0.68723011f},
-std::array<float,2>{0.951439738f, 0.144497916f},
-std::array<float,2>{0.191338807f, 0.0996927619f},
-std::array<float,2>{0.796565652f, 0.598438382f},
-std::array<float,2>{0.433155537f, 0.775326967f},
-std::array<float,2>{0.682651937f, 0.2503075f},
-std::array<float,2>{0.451340854f, 0.197321251f},
-std::array<float,2>{0.719478607f, 0.741440952f},
-std::array<float,2>{0.178566754f, 0.95569402f},
-std::array<float,2>{0.855119824f, 0.41014716f},
-std::array<float,2>{0.0619297139f, 0.353274673f},
-std::array<float,2>{0.892303646f, 0.872186899f},
-std::array<float,2>{0.315614969f, 0.519440055f},
-std::array<float,2>{0.557185352f, 0.0130532514f},
-std::array<float,2>{0.38467899f, 0.310984105f},
-std::array<float,2>{0.647461832f, 0.80547601f},
-std::array<float,2>{0.225137323f, 0.580814898f},
-std::array<float,2>{0.761202693f, 0.0745019764f},
-std::array<float,2>{0.0878643766f, 0.185767233f},
-std::array<float,2>{0.968832314f, 0.655780196f},
-std::array<float,2>{0.308989137f, 0.926619947f},
-std::array<float,2>{0.58287251f, 0.439084679f},
-std::array<float,2>{0.351820707f, 0.043328587f},
-std::array<float,2>{0.515968561f, 0.545980811f},
-std::array<float,2>{0.026242204f, 0.81969887f},
-std::array<float,2>{0.913995087f, 0.328756094f},
-std::array<float,2>{0.145684794f, 0.384396881f},
-std::array<float,2>{0.838732123f, 0.971220911f},
-std::array<float,2>{0.48045963f, 0.704396009f},
-std::array<float,2>{0.71850127f, 0.245397016f},
-std::array<float,2>{0.340493202f, 0.320001721f},
-std::array<float,2>{0.536479592f, 0.838643432f},
-std::array<float,2>{0.045507025f, 0.559130907f},
-std::array<float,2>{0.880354404f, 0.0517148003f},
-std::array<float,2>{0.165729374f, 0.231910095f},
-std::array<float,2>{0.860740304f, 0.698813856f},
-std::array<float,2>{0.457271039f, 0.988921404f},
-std::array<float,2>{0.735775292f, 0.40552488f},
-std::array<float,2>{0.412916422f, 0.0822622404f},
-std::array<float,2>{0.662129879f, 0.567745864f},
-std::array<float,2>{0.208404705f, 0.794229209f},
-std::array<float,2>{0.80569911f, 0.281375647f},
-std::array<float,2>{0.101582825f, 0.458963871f},
-std::array<float,2>{0.958426535f, 0.911621273f},
-std::array<float,2>{0.270178139f, 0.634219587f},
-std::array<float,2>{0.602257013f, 0.159253314f},
-std::array<float,2>{0.494582117f, 0.435182214f},
-std::array<float,2>{0.687705934f, 0.949492335f},
-std::array<float,2>{0.136741206f, 0.724412858f},
-std::array<float,2>{0.821167648f, 0.217153922f},
-std::array<float,2>{0.0104381517f, 0.0182115231f},
-std::array<float,2>{0.93301928f, 0.506335199f},
-std::array<float,2>{0.371158183f, 0.853754938f},
-std::array<float,2>{0.509940982f, 0.360038757f},
-std::array<float,2>{0.282728374f, 0.134966731f},
-std::array<float,2>{0.563627124f, 0.670102417f},
-std::array<float,2>{0.0667771995f, 0.904041231f},
-std::array<float,2>{0.986691952f, 0.493797183f},
-std::array<float,2>{0.244658008f, 0.268539488f},
-std::array<float,2>{0.775158823f, 0.75776881f},
-std::array<float,2>{0.401998371f, 0.609909952f},
-std::array<float,2>{0.626554549f, 0.121243559f},
-std::array<float,2>{0.36528945f, 0.462663502f},
-std::array<float,2>{0.502375782f, 0.918959498f},
-std::array<float,2>{0.00679139746f, 0.628747582f},
-std::array<float,2>{0.923387945f, 0.16944696f},
-std::array<float,2>{0.12711443f, 0.091627799f},
-std::array<float,2>{0.819183767f, 0.574271202f},
-std::array<float,2>{0.487639159f, 0.782634735f},
-std::array<float,2>{0.700164914f, 0.2901631f},
-std::array<float,2>{0.395296186f, 0.220933303f},
-std::array<float,2>{0.639286935f, 0.693960011f},
-std::array<float,2>{0.235624626f, 0.993570685f},
-std::array<float,2>{0.771128535f, 0.398169816f},
-std::array<float,2>{0.07422591f, 0.327414036f},
-std::array<float,2>{0.998858273f, 0.832284272f},
-std::array<float,2>{0.291406751f, 0.550257802f},
-std::array<float,2>{0.575805306f, 0.0573269129f},
-std::array<float,2>{0.463879555f, 0.274923593f},
-std::array<float,2>{0.747806847f, 0.761789799f},
-std::array<float,2>{0.158158183f, 0.624625862f},
-std::array<float,2>{0.868564367f, 0.1131505f},
-std::array<float,2>{0.0384730399f, 0.127359137f},
-std::array<float,2>{0.88758707f, 0.659154594f},
-std::array<float,2>{0.330612987f, 0.897461236f},
-std::array<float,2>{0.539618373f, 0.488860279f},
-std::array<float,2>{0.276863664f, 0.030082833f},
-std::array<float,2>{0.598190129f, 0.508159935f},
-std::array<float,2>{0.100574344f, 0.844424665f},
-std::array<float,2>{0.968599617f, 0.371027559f},
-std::array<float,2>{0.213004425f, 0.425997525f},
-std::array<float,2>{0.797495842f, 0.942057133f},
-std::array<float,2>{0.416912347f, 0.732250094f},
-std::array<float,2>{0.664304852f, 0.207877934f},
-std::array<float,2>{0.301962376f, 0.350291997f},
-std::array<float,2>{0.586616457f, 0.861870885f},
-std::array<float,2>{0.0793639645f, 0.52692461f},
-std::array<float,2>{0.978152454f, 0.00610869145f},
-std::array<float,2>{0.22815083f, 0.188752472f},
-std::array<float,2>{0.756771505f, 0.747204959f},
-std::array<float,2>{0.376934528f, 0.96581459f},
-std::array<float,2>{0.650383949f, 0.415974617f},
-std::array<float,2>{0.469414055f, 0.104648031f},
-std::array<float,2>{0.709461153f, 0.60517472f},
-std::array<float,2>{0.151160389f, 0.767724931f},
-std::array<float,2>{0.832288563f, 0.260591894f},
-std::array<float,2>{0.0177951045f, 0.481324673f},
-std::array<float,2>{0.920559704f, 0.882780373f},
-std::array<float,2>{0.346791446f, 0.674417853f},
-std::array<float,2>{0.525010049f, 0.148522332f},
-std::array<float,2>{0.428095549f, 0.381030947f},
-std::array<float,2>{0.677408755f, 0.983572841f},
-std::array<float,2>{0.19697167f, 0.716654181f},
-std::array<float,2>{0.787176907f, 0.237429276f},
-std::array<float,2>{0.11605753f, 0.0323060229f},
-std::array<float,2>{0.93944186f, 0.533094347f},
-std::array<float,2>{0.260628581f, 0.824796617f},
-std::array<float,2>{0.619047999f, 0.343188882f},
-std::array<float,2>{0.323908687f, 0.172688067f},
-std::array<float,2>{0.550397158f, 0.648354888f},
-std::array<float,2>{0.0536904447f, 0.935199738f},
-std::array<float,2>{0.90170145f, 0.451854169f},
-std::array<float,2>{0.183978334f, 0.301224798f},
-std::array<float,2>{0.844622374f, 0.804038584f},
-std::array<float,2>{0.441297323f, 0.589218199f},
-std::array<float,2>{0.733965218f, 0.0691382214f},
-std::array<float,2>{0.256334692f, 0.409764767f},
-std::array<float,2>{0.612563431f, 0.955957294f},
-std::array<float,2>{0.121126704f, 0.741676986f},
-std::array<float,2>{0.950401008f, 0.19759503f},
-std::array<float,2>{0.188433707f, 0.0127286343f},
-std::array<float,2>{0.794688702f, 0.519157112f},
-std::array<float,2>{0.431584209f, 0.872430503f},
-std::array<float,2>{0.681395352f, 0.353202611f},
-std::array<float,2>{0.449396193f, 0.144232094f},
-std::array<float,2>{0.721316695f, 0.68748343f},
-std::array<float,2>{0.176645353f, 0.884166002f},
-std::array<float,2>{0.852321386f, 0.474980175f},
-std::array<float,2>{0.0595159978f, 0.250193745f},
-std::array<float,2>{0.893211722f, 0.77513051f},
-std::array<float,2>{0.312717766f, 0.598214984f},
-std::array<float,2>{0.555520952f, 0.10001754f},
-std::array<float,2>{0.385101855f, 0.32896173f},
-std::array<float,2>{0.645687759f, 0.819447994f},
-std::array<float,2>{0.223901615f, 0.546185911f},
-std::array<float,2>{0.758443952f, 0.0431992412f},
-std::array<float,2>{0.0888481066f, 0.245197549f},
-std::array<float,2>{0.971020281f, 0.704290569f},
-std::array<float,2>{0.311934382f, 0.971443713f},
-std::array<float,2>{0.585754156f, 0.384744197f},
-std::array<float,2>{0.353698164f, 0.0744628906f},
-std::array<float,2>{0.517796457f, 0.580636978f},
-std::array<float,2>{0.0240185708f, 0.805264592f},
-std::array<float,2>{0.911397815f, 0.31060341f},
-std::array<float,2>{0.147808999f, 0.439341545f},
-std::array<float,2>{0.83598882f, 0.926408648f},
-std::array<float,2>{0.478481412f, 0.656026483f},
-std::array<float,2>{0.714895248f, 0.185827225f},
-std::array<float,2>{0.343503654f, 0.281541884f},
-std::array<float,2>{0.53749913f, 0.793995917f},
-std::array<float,2>{0.0442808904f, 0.567403913f},
-std::array<float,2>{0.882161379f, 0.0822905675f},
-std::array<float,2>{0.16753222f, 0.159550235f},
-std::array<float,2>{0.861519098f, 0.634011626f},
-std::array<float,2>{0.459049016f, 0.912016451f},
-std::array<float,2>{0.736977637f, 0.458521515f},
-std::array<float,2>{0.412102729f, 0.0512888134f},
-std::array<float,2>{0.660274863f, 0.559519291f},
-std::array<float,2>{0.210779697f, 0.838531077f},
-std::array<float,2>{0.807892382f, 0.320078671f},
-std::array<float,2>{0.10516122f, 0.405435234f},
-std::array<float,2>{0.960634589f, 0.989193857f},
-std::array<float,2>{0.271652251f, 0.699052572f},
-std::array<float,2>{0.604023337f, 0.231682688f},
-std::array<float,2>{0.494116604f, 0.494129837f},
-std::array<float,2>{0.690652609f, 0.904260635f},
-std::array<float,2>{0.140172526f, 0.670329988f},
-std::array<float,2>{0.823772967f, 0.135118127f},
-std::array<float,2>{0.00862096064f, 0.121437356f},
-std::array<float,2>{0.931395769f, 0.610328794f},
-std::array<float,2>{0.374751598f, 0.757377326f},
-std::array<float,2>{0.509155214f, 0.268159419f},
-std::array<float,2>{0.283998162f, 0.216995075f},
-std::array<float,2>{0.565015912f, 0.72429359f},
-std::array<float,2>{0.0691898987f, 0.949409902f},
-std::array<float,2>{0.986066103f, 0.435349345f},
-std::array<float,2>{0.242302269f, 0.360174656f},
-std::array<float,2>{0.775527954f, 0.853799641f},
-std::array<float,2>{0.399974763f, 0.506016433f},
-std::array<float,2>{0.627284646f, 0.0183185581f},
-std::array<float,2>{0.316537201f, 0.391848981f},
-std::array<float,2>{0.56001395f, 0.996512294f},
-std::array<float,2>{0.0581297018f, 0.687892616f},
-std::array<float,2>{0.896069467f, 0.225809738f},
-std::array<float,2>{0.174791247f, 0.0594923273f},
-std::array<float,2>{0.859236717f, 0.550988972f},
-std::array<float,2>{0.448724836f, 0.83103174f},
-std::array<float,2>{0.722719669f, 0.322593182f},
-std::array<float,2>{0.433923304f, 0.166029721f},
-std::array<float,2>{0.685743153f, 0.631370664f},
-std::array<float,2>{0.19142139f, 0.914497852f},
-std::array<float,2>{0.789489329f, 0.466091901f},
-std::array<float,2>{0.12036556f, 0.295274019f},
-std::array<float,2>{0.948793292f, 0.786505699f},
-std::array<float,2>{0.2503438f, 0.572886944f},
-std::array<float,2>{0.614496112f, 0.0874542519f},
-std::array<float,2>{0.482572615f, 0.371510595f},
-std::array<float,2>{0.71146661f, 0.849846065f},
-std::array<float,2>{0.1428231f, 0.515499532f},
-std::array<float,2>{0.840047061f, 0.0246360935f},
-std::array<float,2>{0.0281065516f, 0.204934582f},
-std::array<float,2>{0.907713294f, 0.727464259f},
-std::array<float,2>{0.356708795f, 0.939321101f},
-std::array<float,2>{0.520978689f, 0.424600989f},
-std::array<float,2>{0.305663615f, 0.116195999f},
-std::array<float,2>{0.581854761f, 0.618949354f},
-std::array<float,2>{0.092971608f, 0.759892464f},
-std::array<float,2>{0.973119259f, 0.279022604f},
-std::array<float,2>{0.22203505f, 0.486584574f},
-std::array<float,2>{0.764596462f, 0.89345479f},
-std::array<float,2>{0.388635248f, 0.663474977f},
-std::array<float,2>{0.644274712f, 0.129629523f},
-std::array<float,2>{0.26831618f, 0.264397591f},
-std::array<float,2>{0.607548773f, 0.770642817f},
-std::array<float,2>{0.107689179f, 0.609370768f},
-std::array<float,2>{0.953599989f, 0.107405581f},
-std::array<float,2>{0.204782888f, 0.154590517f},
-std::array<float,2>{0.811427534f, 0.675788939f},
-std::array<float,2>{0.406740248f, 0.876727343f},
-std::array<float,2>{0.657521009f, 0.47860685f},
-std::array<float,2>{0.454127997f, 0.000674559386f},
-std::array<float,2>{0.739166021f, 0.529075086f},
-std::array<float,2>{0.169258252f, 0.865893304f},
-std::array<float,2>{0.865399301f, 0.345505744f},
-std::array<float,2>{0.0426767394f, 0.419765174f},
-std::array<float,2>{0.878794014f, 0.963272512f},
-std::array<float,2>{0.338683724f, 0.745712638f},
-std::array<float,2>{0.534941554f, 0.193968207f},
-std::array<float,2>{0.403013796f, 0.448592007f},
-std::array<float,2>{0.629375935f, 0.932900071f},
-std::array<float,2>{0.249492168f, 0.641680241f},
-std::array<float,2>{0.780623674f, 0.17654562f},
-std::array<float,2>{0.0647301897f, 0.0648699477f},
-std::array<float,2>{0.989598691f, 0.592593193f},
-std::array<float,2>{0.286704272f, 0.799469411f},
-std::array<float,2>{0.568698585f, 0.298874497f},
-std::array<float,2>{0.367586255f, 0.240106076f},
-std::array<float,2>{0.515174568f, 0.714021683f},
-std::array<float,2>{0.0131476372f, 0.979067922f},
-std::array<float,2>{0.935670912f, 0.378376305f},
-std::array<float,2>{0.136360258f, 0.338708013f},
-std::array<float,2>{0.826132178f, 0.823689044f},
-std::array<float,2>{0.498206794f, 0.53668505f},
-std::array<float,2>{0.693450689f, 0.0386731885f},
-std::array<float,2>{0.29540804f, 0.469533563f},
-std::array<float,2>{0.573978722f, 0.888588369f},
-std::array<float,2>{0.0726535916f, 0.681848347f},
-std::array<float,2>{0.992885828f, 0.147650898f},
-std::array<float,2>{0.240558669f, 0.095319204f},
-std::array<float,2>{0.76729399f, 0.597600281f},
-std::array<float,2>{0.393708676f, 0.778292358f},
-std::array<float,2>{0.633533716f, 0.25485608f},
-std::array<float,2>{0.491794944f, 0.201008856f},
-std::array<float,2>{0.697421312f, 0.736822069f},
-std::array<float,2>{0.131953254f, 0.960063457f},
-std::array<float,2>{0.813177764f, 0.41147393f},
-std::array<float,2>{0.000315124955f, 0.357349187f},
-std::array<float,2>{0.92636174f, 0.868449211f},
-std::array<float,2>{0.360493332f, 0.521855354f},
-std::array<float,2>{0.50538516f, 0.0101632774f},
-std::array<float,2>{0.420481116f, 0.307618916f},
-std::array<float,2>{0.670559645f, 0.811507583f},
-std::array<float,2>{0.218644336f, 0.585120916f},
-std::array<float,2>{0.804408014f, 0.0725538954f},
-std::array<float,2>{0.0941233784f, 0.179819778f},
-std::array<float,2>{0.962940991f, 0.649993062f},
-std::array<float,2>{0.28012538f, 0.924437284f},
-std::array<float,2>{0.596672595f, 0.444752216f},
-std::array<float,2>{0.333810717f, 0.0413159207f},
-std::array<float,2>{0.544567704f, 0.541707456f},
-std::array<float,2>{0.034361314f, 0.814779222f},
-std::array<float,2>{0.884448707f, 0.334305763f},
-std::array<float,2>{0.163384274f, 0.389783591f},
-std::array<float,2>{0.874320149f, 0.972773612f},
-std::array<float,2>{0.465355992f, 0.707156181f},
-std::array<float,2>{0.745809555f, 0.248844132f},
-std::array<float,2>{0.349130452f, 0.31627205f},
-std::array<float,2>{0.529447556f, 0.842134774f},
-std::array<float,2>{0.022783f, 0.557856619f},
-std::array<float,2>{0.914573491f, 0.0478636026f},
-std::array<float,2>{0.153271586f, 0.23022227f},
-std::array<float,2>{0.830023289f, 0.700016975f},
-std::array<float,2>{0.475991994f, 0.986644089f},
-std::array<float,2>{0.705395043f, 0.400880873f},
-std::array<float,2>{0.38094449f, 0.081617333f},
-std::array<float,2>{0.654790103f, 0.565293908f},
-std::array<float,2>{0.232386619f, 0.792284548f},
-std::array<float,2>{0.752464175f, 0.285468966f},
-std::array<float,2>{0.0858418196f, 0.453489035f},
-std::array<float,2>{0.982355416f, 0.908220053f},
-std::array<float,2>{0.300661474f, 0.639544368f},
-std::array<float,2>{0.591095924f, 0.161020979f},
-std::array<float,2>{0.445031196f, 0.431896806f},
-std::array<float,2>{0.727009356f, 0.946757793f},
-std::array<float,2>{0.183282629f, 0.72165215f},
-std::array<float,2>{0.848717153f, 0.213144079f},
-std::array<float,2>{0.0477900766f, 0.020419037f},
-std::array<float,2>{0.906225502f, 0.502752185f},
-std::array<float,2>{0.327675045f, 0.859244943f},
-std::array<float,2>{0.55438453f, 0.363989562f},
-std::array<float,2>{0.264107317f, 0.138754115f},
-std::array<float,2>{0.622906089f, 0.664215684f},
-std::array<float,2>{0.112295382f, 0.901606679f},
-std::array<float,2>{0.942485154f, 0.499720961f},
-std::array<float,2>{0.20019643f, 0.270596117f},
-std::array<float,2>{0.784518659f, 0.752587378f},
-std::array<float,2>{0.4231565f, 0.616212368f},
-std::array<float,2>{0.672304332f, 0.118522443f},
-std::array<float,2>{0.329231858f, 0.49035114f},
-std::array<float,2>{0.542099416f, 0.89505899f},
-std::array<float,2>{0.0354478247f, 0.65651089f},
-std::array<float,2>{0.888948083f, 0.125958741f},
-std::array<float,2>{0.159611285f, 0.111229524f},
-std::array<float,2>{0.869799137f, 0.622931302f},
-std::array<float,2>{0.461875886f, 0.763932705f},
-std::array<float,2>{0.74972403f, 0.276539564f},
-std::array<float,2>{0.415617347f, 0.209992513f},
-std::array<float,2>{0.667903662f, 0.732813358f},
-std::array<float,2>{0.212508664f, 0.944231272f},
-std::array<float,2>{0.799626946f, 0.428463429f},
-std::array<float,2>{0.0993516594f, 0.368141711f},
-std::array<float,2>{0.966519058f, 0.846218884f},
-std::array<float,2>{0.273505956f, 0.510092914f},
-std::array<float,2>{0.60078758f, 0.0277469568f},
-std::array<float,2>{0.485084832f, 0.291609883f},
-std::array<float,2>{0.702524185f, 0.784127235f},
-std::array<float,2>{0.126293033f, 0.576242447f},
-std::array<float,2>{0.817119956f, 0.092667982f},
-std::array<float,2>{0.00416656863f, 0.171211377f},
-std::array<float,2>{0.924050212f, 0.625539362f},
-std::array<float,2>{0.363394618f, 0.921069205f},
-std::array<float,2>{0.500226498f, 0.464223862f},
-std::array<float,2>{0.290497005f, 0.055199936f},
-std::array<float,2>{0.577338696f, 0.547435582f},
-std::array<float,2>{0.0762083903f, 0.834124744f},
-std::array<float,2>{0.997052073f, 0.325005621f},
-std::array<float,2>{0.23648116f, 0.394709855f},
-std::array<float,2>{0.77320528f, 0.99548775f},
-std::array<float,2>{0.396532744f, 0.69323194f},
-std::array<float,2>{0.636977315f, 0.219505668f},
-std::array<float,2>{0.259341687f, 0.341308504f},
-std::array<float,2>{0.620300055f, 0.826768696f},
-std::array<float,2>{0.114141732f, 0.534759343f},
-std::array<float,2>{0.939650595f, 0.03435174f},
-std::array<float,2>{0.198291048f, 0.236164719f},
-std::array<float,2>{0.786145985f, 0.716978312f},
-std::array<float,2>{0.425999463f, 0.982350707f},
-std::array<float,2>{0.679338157f, 0.380418003f},
-std::array<float,2>{0.438526869f, 0.0668700784f},
-std::array<float,2>{0.731883407f, 0.58696866f},
-std::array<float,2>{0.186017215f, 0.801654041f},
-std::array<float,2>{0.847099125f, 0.302980363f},
-std::array<float,2>{0.0517514274f, 0.449697793f},
-std::array<float,2>{0.900282621f, 0.93721199f},
-std::array<float,2>{0.320540607f, 0.645580709f},
-std::array<float,2>{0.548633039f, 0.174581006f},
-std::array<float,2>{0.378767461f, 0.416564852f},
-std::array<float,2>{0.650537372f, 0.966917574f},
-std::array<float,2>{0.228880256f, 0.749440491f},
-std::array<float,2>{0.754825652f, 0.190385059f},
-std::array<float,2>{0.0805649981f, 0.00562614202f},
-std::array<float,2>{0.979019225f, 0.524434507f},
-std::array<float,2>{0.303406417f, 0.860526025f},
-std::array<float,2>{0.589466929f, 0.348715365f},
-std::array<float,2>{0.344463795f, 0.150960103f},
-std::array<float,2>{0.526005208f, 0.672110319f},
-std::array<float,2>{0.0165381134f, 0.880606592f},
-std::array<float,2>{0.91974014f, 0.484030575f},
-std::array<float,2>{0.149072096f, 0.259710193f},
-std::array<float,2>{0.835027575f, 0.76652503f},
-std::array<float,2>{0.472169518f, 0.602017283f},
-std::array<float,2>{0.707201004f, 0.1015727f},
-std::array<float,2>{0.310322553f, 0.386576295f},
-std::array<float,2>{0.583009779f, 0.969112754f},
-std::array<float,2>{0.0866338983f, 0.705879688f},
-std::array<float,2>{0.970397294f, 0.244095311f},
-std::array<float,2>{0.225974321f, 0.0455236211f},
-std::array<float,2>{0.760623336f, 0.544714868f},
-std::array<float,2>{0.382917643f, 0.816431344f},
-std::array<float,2>{0.646541119f, 0.331904322f},
-std::array<float,2>{0.479073256f, 0.184734732f},
-std::array<float,2>{0.717215598f, 0.652927995f},
-std::array<float,2>{0.144746542f, 0.928876936f},
-std::array<float,2>{0.839245796f, 0.441204011f},
-std::array<float,2>{0.0268397368f, 0.309490383f},
-std::array<float,2>{0.91259551f, 0.807306945f},
-std::array<float,2>{0.353112847f, 0.578884959f},
-std::array<float,2>{0.517511189f, 0.0768043622f},
-std::array<float,2>{0.4321585f, 0.355058134f},
-std::array<float,2>{0.682035685f, 0.874007404f},
-std::array<float,2>{0.190181091f, 0.516311824f},
-std::array<float,2>{0.795149088f, 0.0151202409f},
-std::array<float,2>{0.124177419f, 0.195396855f},
-std::array<float,2>{0.952824354f, 0.739102185f},
-std::array<float,2>{0.255060464f, 0.954472363f},
-std::array<float,2>{0.609597325f, 0.407473624f},
-std::array<float,2>{0.314664483f, 0.0990185514f},
-std::array<float,2>{0.558502078f, 0.600676119f},
-std::array<float,2>{0.06062546f, 0.777138829f},
-std::array<float,2>{0.89136529f, 0.252582729f},
-std::array<float,2>{0.179202393f, 0.473839164f},
-std::array<float,2>{0.853878677f, 0.884965539f},
-std::array<float,2>{0.452758819f, 0.684299231f},
-std::array<float,2>{0.720052838f, 0.142287478f},
-std::array<float,2>{0.372255594f, 0.266427398f},
-std::array<float,2>{0.510986745f, 0.75395298f},
-std::array<float,2>{0.0115440059f, 0.612156391f},
-std::array<float,2>{0.932508647f, 0.124108292f},
-std::array<float,2>{0.138594449f, 0.13432321f},
-std::array<float,2>{0.822166443f, 0.669080138f},
-std::array<float,2>{0.495685637f, 0.90578711f},
-std::array<float,2>{0.688515842f, 0.494204491f},
-std::array<float,2>{0.400990218f, 0.0171245262f},
-std::array<float,2>{0.625497997f, 0.505708337f},
-std::array<float,2>{0.245568365f, 0.85179317f},
-std::array<float,2>{0.773925066f, 0.361656398f},
-std::array<float,2>{0.0674767047f, 0.437380373f},
-std::array<float,2>{0.987689734f, 0.952779531f},
-std::array<float,2>{0.28189835f, 0.725862145f},
-std::array<float,2>{0.563062191f, 0.215074182f},
-std::array<float,2>{0.458691984f, 0.459897846f},
-std::array<float,2>{0.7352193f, 0.913203895f},
-std::array<float,2>{0.164699748f, 0.636498988f},
-std::array<float,2>{0.860242724f, 0.156771541f},
-std::array<float,2>{0.0463538095f, 0.085425958f},
-std::array<float,2>{0.878970861f, 0.569730043f},
-std::array<float,2>{0.340921491f, 0.796102524f},
-std::array<float,2>{0.535828412f, 0.284104049f},
-std::array<float,2>{0.270806581f, 0.233798683f},
-std::array<float,2>{0.603495181f, 0.697243214f},
-std::array<float,2>{0.102867544f, 0.990342081f},
-std::array<float,2>{0.957037032f, 0.402628094f},
-std::array<float,2>{0.207806736f, 0.31649974f},
-std::array<float,2>{0.805206954f, 0.836654782f},
-std::array<float,2>{0.413519442f, 0.560993791f},
-std::array<float,2>{0.663572311f, 0.0533519052f},
-std::array<float,2>{0.358432919f, 0.422204018f},
-std::array<float,2>{0.521544695f, 0.941028893f},
-std::array<float,2>{0.0297390018f, 0.729744077f},
-std::array<float,2>{0.909541667f, 0.206179842f},
-std::array<float,2>{0.141369998f, 0.0256816894f},
-std::array<float,2>{0.841993332f, 0.511966169f},
-std::array<float,2>{0.480570078f, 0.847766936f},
-std::array<float,2>{0.714481413f, 0.374397457f},
-std::array<float,2>{0.388961136f, 0.130991504f},
-std::array<float,2>{0.641796947f, 0.660770833f},
-std::array<float,2>{0.220693305f, 0.891181588f},
-std::array<float,2>{0.761749208f, 0.484597206f},
-std::array<float,2>{0.0907654017f, 0.280795664f},
-std::array<float,2>{0.97639668f, 0.759463072f},
-std::array<float,2>{0.306722015f, 0.62008673f},
-std::array<float,2>{0.578267455f, 0.114905246f},
-std::array<float,2>{0.445545197f, 0.321224988f},
-std::array<float,2>{0.72470969f, 0.828553855f},
-std::array<float,2>{0.173211753f, 0.553539693f},
-std::array<float,2>{0.856422067f, 0.0621436015f},
-std::array<float,2>{0.0557355285f, 0.224034399f},
-std::array<float,2>{0.896711707f, 0.690872729f},
-std::array<float,2>{0.319723129f, 0.999394894f},
-std::array<float,2>{0.561625838f, 0.394239455f},
-std::array<float,2>{0.253571242f, 0.0887966454f},
-std::array<float,2>{0.615559459f, 0.570748866f},
-std::array<float,2>{0.118076839f, 0.788755834f},
-std::array<float,2>{0.94640708f, 0.293291509f},
-std::array<float,2>{0.194317281f, 0.468381256f},
-std::array<float,2>{0.792396903f, 0.91644901f},
-std::array<float,2>{0.436967671f, 0.630352616f},
-std::array<float,2>{0.684360147f, 0.165337861f},
-std::array<float,2>{0.28901571f, 0.29736039f},
-std::array<float,2>{0.566886961f, 0.797424376f},
-std::array<float,2>{0.0625102073f, 0.589881122f},
-std::array<float,2>{0.990986109f, 0.0630812645f},
-std::array<float,2>{0.247315317f, 0.179385439f},
-std::array<float,2>{0.777947962f, 0.642780364f},
-std::array<float,2>{0.4059214f, 0.930688739f},
-std::array<float,2>{0.631445348f, 0.447067052f},
-std::array<float,2>{0.496247679f, 0.0360659286f},
-std::array<float,2>{0.691432238f, 0.53845185f},
-std::array<float,2>{0.132855669f, 0.822154939f},
-std::array<float,2>{0.82634306f, 0.337137401f},
-std::array<float,2>{0.0156107368f, 0.376306981f},
-std::array<float,2>{0.934538662f, 0.977175117f},
-std::array<float,2>{0.369551122f, 0.71249783f},
-std::array<float,2>{0.513087332f, 0.241700396f},
-std::array<float,2>{0.408592165f, 0.477970243f},
-std::array<float,2>{0.659874141f, 0.878782988f},
-std::array<float,2>{0.20594421f, 0.678340673f},
-std::array<float,2>{0.809761822f, 0.152372345f},
-std::array<float,2>{0.10705857f, 0.10799209f},
-std::array<float,2>{0.956233561f, 0.60628444f},
-std::array<float,2>{0.266169399f, 0.77199173f},
-std::array<float,2>{0.606725693f, 0.261821091f},
-std::array<float,2>{0.336252362f, 0.192067057f},
-std::array<float,2>{0.532618999f, 0.742540836f},
-std::array<float,2>{0.0399010517f, 0.961839855f},
-std::array<float,2>{0.876446426f, 0.420587897f},
-std::array<float,2>{0.171542868f, 0.34760046f},
-std::array<float,2>{0.864688635f, 0.863868296f},
-std::array<float,2>{0.457005441f, 0.530959249f},
-std::array<float,2>{0.741061568f, 0.00209414517f},
-std::array<float,2>{0.278215021f, 0.443271726f},
-std::array<float,2>{0.594135702f, 0.923330188f},
-std::array<float,2>{0.0963519588f, 0.652129412f},
-std::array<float,2>{0.96102488f, 0.182099909f},
-std::array<float,2>{0.214971408f, 0.0711361691f},
-std::array<float,2>{0.802594125f, 0.5833413f},
-std::array<float,2>{0.418012291f, 0.809048593f},
-std::array<float,2>{0.668932617f, 0.306403726f},
-std::array<float,2>{0.466825604f, 0.246999413f},
-std::array<float,2>{0.743510306f, 0.710320711f},
-std::array<float,2>{0.160487831f, 0.976318836f},
-std::array<float,2>{0.872257233f, 0.388102829f},
-std::array<float,2>{0.0319858119f, 0.33369109f},
-std::array<float,2>{0.884803653f, 0.813147128f},
-std::array<float,2>{0.334377885f, 0.539421856f},
-std::array<float,2>{0.545406997f, 0.0409539267f},
-std::array<float,2>{0.391309321f, 0.256288707f},
-std::array<float,2>{0.635704756f, 0.781169474f},
-std::array<float,2>{0.239234447f, 0.594695508f},
-std::array<float,2>{0.769489348f, 0.0968256444f},
-std::array<float,2>{0.0708647221f, 0.145866096f},
-std::array<float,2>{0.994224906f, 0.68134433f},
-std::array<float,2>{0.294584364f, 0.888672948f},
-std::array<float,2>{0.572129071f, 0.47078687f},
-std::array<float,2>{0.363009065f, 0.00958499406f},
-std::array<float,2>{0.506307423f, 0.52047658f},
-std::array<float,2>{0.00266016042f, 0.869314015f},
-std::array<float,2>{0.928905308f, 0.359105825f},
-std::array<float,2>{0.130393028f, 0.412957281f},
-std::array<float,2>{0.815360665f, 0.958874047f},
-std::array<float,2>{0.488498479f, 0.734602749f},
-std::array<float,2>{0.695497572f, 0.202818796f},
-std::array<float,2>{0.324410856f, 0.365659922f},
-std::array<float,2>{0.551018834f, 0.857223034f},
-std::array<float,2>{0.0499089658f, 0.500911295f},
-std::array<float,2>{0.903139412f, 0.0224777143f},
-std::array<float,2>{0.180145711f, 0.211517587f},
-std::array<float,2>{0.851286292f, 0.719380379f},
-std::array<float,2>{0.443234265f, 0.948223889f},
-std::array<float,2>{0.728613973f, 0.430156946f},
-std::array<float,2>{0.424583077f, 0.120794505f},
-std::array<float,2>{0.67547673f, 0.613919377f},
-std::array<float,2>{0.201598853f, 0.750848711f},
-std::array<float,2>{0.781465352f, 0.272642672f},
-std::array<float,2>{0.111285977f, 0.497032821f},
-std::array<float,2>{0.944583237f, 0.899400949f},
-std::array<float,2>{0.263427854f, 0.667434275f},
-std::array<float,2>{0.623198569f, 0.137186408f},
-std::array<float,2>{0.474226952f, 0.4000673f},
-std::array<float,2>{0.703272283f, 0.985110283f},
-std::array<float,2>{0.154888958f, 0.701197326f},
-std::array<float,2>{0.830685854f, 0.227108777f},
-std::array<float,2>{0.0197257176f, 0.0502468571f},
-std::array<float,2>{0.91773361f, 0.556022704f},
-std::array<float,2>{0.351215541f, 0.840205312f},
-std::array<float,2>{0.528843701f, 0.313245326f},
-std::array<float,2>{0.298065364f, 0.163435251f},
-std::array<float,2>{0.593225837f, 0.637832999f},
-std::array<float,2>{0.0824121833f, 0.907079935f},
-std::array<float,2>{0.982710242f, 0.456457108f},
-std::array<float,2>{0.233416066f, 0.287968099f},
-std::array<float,2>{0.751731098f, 0.789600313f},
-std::array<float,2>{0.3801395f, 0.563611805f},
-std::array<float,2>{0.653916478f, 0.0798327923f},
-std::array<float,2>{0.346596003f, 0.482505023f},
-std::array<float,2>{0.523510695f, 0.879106939f},
-std::array<float,2>{0.0192111749f, 0.673626602f},
-std::array<float,2>{0.921096206f, 0.151916564f},
-std::array<float,2>{0.151833117f, 0.103379622f},
-std::array<float,2>{0.833612621f, 0.60332787f},
-std::array<float,2>{0.470008671f, 0.766822577f},
-std::array<float,2>{0.710115612f, 0.257940471f},
-std::array<float,2>{0.375577062f, 0.190831676f},
-std::array<float,2>{0.648552775f, 0.748079121f},
-std::array<float,2>{0.227203682f, 0.968271792f},
-std::array<float,2>{0.757370353f, 0.417503595f},
-std::array<float,2>{0.0788017064f, 0.34779954f},
-std::array<float,2>{0.977086186f, 0.860331714f},
-std::array<float,2>{0.300920397f, 0.523692966f},
-std::array<float,2>{0.587451935f, 0.00476928661f},
-std::array<float,2>{0.440042078f, 0.304481f},
-std::array<float,2>{0.732548058f, 0.802731752f},
-std::array<float,2>{0.185328424f, 0.586552858f},
-std::array<float,2>{0.845665514f, 0.0678909644f},
-std::array<float,2>{0.0541732013f, 0.174902141f},
-std::array<float,2>{0.901200473f, 0.644574583f},
-std::array<float,2>{0.322792113f, 0.935570598f},
-std::array<float,2>{0.549469113f, 0.450306267f},
-std::array<float,2>{0.261708647f, 0.0340479091f},
-std::array<float,2>{0.618035495f, 0.533935726f},
-std::array<float,2>{0.116956487f, 0.827661276f},
-std::array<float,2>{0.938290238f, 0.340149999f},
-std::array<float,2>{0.195969224f, 0.379374564f},
-std::array<float,2>{0.788391531f, 0.981388688f},
-std::array<float,2>{0.42936635f, 0.717872918f},
-std::array<float,2>{0.67644906f, 0.235279977f},
-std::array<float,2>{0.292772949f, 0.325781703f},
-std::array<float,2>{0.574801505f, 0.835718751f},
-std::array<float,2>{0.0757430196f, 0.547987521f},
-std::array<float,2>{0.9998613f, 0.0562129319f},
-std::array<float,2>{0.234744415f, 0.219961122f},
-std::array<float,2>{0.770276725f, 0.692293108f},
-std::array<float,2>{0.395910561f, 0.994381487f},
-std::array<float,2>{0.640123308f, 0.396199793f},
-std::array<float,2>{0.48730126f, 0.0933121443f},
-std::array<float,2>{0.700418413f, 0.577464402f},
-std::array<float,2>{0.127957463f, 0.78428793f},
-std::array<float,2>{0.820236027f, 0.292967945f},
-std::array<float,2>{0.0077957348f, 0.463610381f},
-std::array<float,2>{0.922807634f, 0.920742452f},
-std::array<float,2>{0.366697997f, 0.626213431f},
-std::array<float,2>{0.503675401f, 0.170453578f},
-std::array<float,2>{0.417733163f, 0.428756535f},
-std::array<float,2>{0.66507864f, 0.944578886f},
-std::array<float,2>{0.214667678f, 0.733488142f},
-std::array<float,2>{0.798288226f, 0.209401324f},
-std::array<float,2>{0.101090394f, 0.0289401952f},
-std::array<float,2>{0.9676916f, 0.511402607f},
-std::array<float,2>{0.275766313f, 0.847360194f},
-std::array<float,2>{0.598794639f, 0.368996859f},
-std::array<float,2>{0.331891239f, 0.12694785f},
-std::array<float,2>{0.540562868f, 0.658172786f},
-std::array<float,2>{0.0373217314f, 0.895961225f},
-std::array<float,2>{0.888611376f, 0.491717964f},
-std::array<float,2>{0.156456634f, 0.275616258f},
-std::array<float,2>{0.867986679f, 0.764728487f},
-std::array<float,2>{0.463727981f, 0.621294796f},
-std::array<float,2>{0.746103704f, 0.11013186f},
-std::array<float,2>{0.273097336f, 0.403650582f},
-std::array<float,2>{0.604991913f, 0.991954923f},
-std::array<float,2>{0.103804164f, 0.695613384f},
-std::array<float,2>{0.959357679f, 0.232456669f},
-std::array<float,2>{0.209829494f, 0.0541820005f},
-std::array<float,2>{0.806769729f, 0.561974287f},
-std::array<float,2>{0.410224885f, 0.837058246f},
-std::array<float,2>{0.661602914f, 0.31741187f},
-std::array<float,2>{0.460365534f, 0.158056259f},
-std::array<float,2>{0.737657011f, 0.635336459f},
-std::array<float,2>{0.166110724f, 0.912491739f},
-std::array<float,2>{0.863033831f, 0.460271001f},
-std::array<float,2>{0.0431432426f, 0.284809828f},
-std::array<float,2>{0.881494999f, 0.795796037f},
-std::array<float,2>{0.342689991f, 0.568943381f},
-std::array<float,2>{0.538859367f, 0.0847914815f},
-std::array<float,2>{0.399039418f, 0.363049835f},
-std::array<float,2>{0.628650665f, 0.853277087f},
-std::array<float,2>{0.244011924f, 0.504561067f},
-std::array<float,2>{0.777016044f, 0.0164854079f},
-std::array<float,2>{0.0694990084f, 0.216738194f},
-std::array<float,2>{0.984552503f, 0.724612117f},
-std::array<float,2>{0.285059035f, 0.951881945f},
-std::array<float,2>{0.565886378f, 0.436241835f},
-std::array<float,2>{0.373525947f, 0.124021053f},
-std::array<float,2>{0.507965088f, 0.612612426f},
-std::array<float,2>{0.00967570208f, 0.755043328f},
-std::array<float,2>{0.930290282f, 0.266888112f},
-std::array<float,2>{0.139041185f, 0.495929748f},
-std::array<float,2>{0.822585642f, 0.904507518f},
-std::array<float,2>{0.492764145f, 0.668731511f},
-std::array<float,2>{0.689988792f, 0.133441165f},
-std::array<float,2>{0.314125389f, 0.253353089f},
-std::array<float,2>{0.555815935f, 0.77556175f},
-std::array<float,2>{0.0596438795f, 0.600204527f},
-std::array<float,2>{0.893890083f, 0.0982628092f},
-std::array<float,2>{0.177492276f, 0.141361848f},
-std::array<float,2>{0.852832139f, 0.68508333f},
-std::array<float,2>{0.450811148f, 0.885857761f},
-std::array<float,2>{0.722191453f, 0.473330736f},
-std::array<float,2>{0.429888695f, 0.0138941444f},
-std::array<float,2>{0.680604577f, 0.516743064f},
-std::array<float,2>{0.18929103f, 0.874457598f},
-std::array<float,2>{0.793043911f, 0.354198426f},
-std::array<float,2>{0.122880861f, 0.406633765f},
-std::array<float,2>{0.949687839f, 0.953361809f},
-std::array<float,2>{0.257248193f, 0.739550591f},
-std::array<float,2>{0.611385942f, 0.197214529f},
-std::array<float,2>{0.476653993f, 0.439685643f},
-std::array<float,2>{0.715946853f, 0.928302348f},
-std::array<float,2>{0.146698698f, 0.65351814f},
-std::array<float,2>{0.837601721f, 0.184567958f},
-std::array<float,2>{0.024416076f, 0.0773364529f},
-std::array<float,2>{0.910433233f, 0.57937324f},
-std::array<float,2>{0.354892999f, 0.808314383f},
-std::array<float,2>{0.518589795f, 0.309753001f},
-std::array<float,2>{0.310606688f, 0.243040279f},
-std::array<float,2>{0.584370852f, 0.706809819f},
-std::array<float,2>{0.0898028463f, 0.970149696f},
-std::array<float,2>{0.97184962f, 0.385133326f},
-std::array<float,2>{0.222982645f, 0.330524087f},
-std::array<float,2>{0.758870065f, 0.817926645f},
-std::array<float,2>{0.385798931f, 0.543371201f},
-std::array<float,2>{0.645237029f, 0.0465998612f},
-std::array<float,2>{0.339144468f, 0.421860427f},
-std::array<float,2>{0.53402251f, 0.962268651f},
-std::array<float,2>{0.0412598811f, 0.743282914f},
-std::array<float,2>{0.877251685f, 0.193023175f},
-std::array<float,2>{0.168891296f, 0.00363858417f},
-std::array<float,2>{0.866401255f, 0.529879451f},
-std::array<float,2>{0.453526139f, 0.865179121f},
-std::array<float,2>{0.739533007f, 0.345995039f},
-std::array<float,2>{0.40812394f, 0.15341109f},
-std::array<float,2>{0.656495452f, 0.679007947f},
-std::array<float,2>{0.203418255f, 0.877279401f},
-std::array<float,2>{0.811562955f, 0.477499723f},
-std::array<float,2>{0.108534329f, 0.263630837f},
-std::array<float,2>{0.954502225f, 0.772491395f},
-std::array<float,2>{0.269450217f, 0.606884181f},
-std::array<float,2>{0.609030128f, 0.10887742f},
-std::array<float,2>{0.499029577f, 0.336142808f},
-std::array<float,2>{0.695109725f, 0.821261704f},
-std::array<float,2>{0.135351196f, 0.537187874f},
-std::array<float,2>{0.824835479f, 0.0369161405f},
-std::array<float,2>{0.0122909704f, 0.240822047f},
-std::array<float,2>{0.937044919f, 0.711707175f},
-std::array<float,2>{0.369130939f, 0.977721572f},
-std::array<float,2>{0.514098644f, 0.375742882f},
-std::array<float,2>{0.285829842f, 0.0643377304f},
-std::array<float,2>{0.569366217f, 0.590894699f},
-std::array<float,2>{0.0659240857f, 0.798647463f},
-std::array<float,2>{0.988767922f, 0.298080534f},
-std::array<float,2>{0.248070717f, 0.445426136f},
-std::array<float,2>{0.780264676f, 0.930296957f},
-std::array<float,2>{0.403899342f, 0.643788278f},
-std::array<float,2>{0.630593479f, 0.178455949f},
-std::array<float,2>{0.251052082f, 0.29442066f},
-std::array<float,2>{0.61386013f, 0.787302315f},
-std::array<float,2>{0.119276062f, 0.571964741f},
-std::array<float,2>{0.94809258f, 0.0894108489f},
-std::array<float,2>{0.193019152f, 0.164887339f},
-std::array<float,2>{0.790400147f, 0.629102409f},
-std::array<float,2>{0.434802324f, 0.917452514f},
-std::array<float,2>{0.686990321f, 0.466825068f},
-std::array<float,2>{0.447810322f, 0.0611495338f},
-std::array<float,2>{0.72389394f, 0.554205358f},
-std::array<float,2>{0.17508854f, 0.829199195f},
-std::array<float,2>{0.85785991f, 0.321387827f},
-std::array<float,2>{0.0570676699f, 0.393257082f},
-std::array<float,2>{0.895034254f, 0.998548925f},
-std::array<float,2>{0.317929178f, 0.689798057f},
-std::array<float,2>{0.559338331f, 0.223058537f},
-std::array<float,2>{0.386884332f, 0.485455632f},
-std::array<float,2>{0.642668068f, 0.892387927f},
-std::array<float,2>{0.221645772f, 0.661145806f},
-std::array<float,2>{0.765170455f, 0.132452309f},
-std::array<float,2>{0.0920297951f, 0.113415532f},
-std::array<float,2>{0.974072456f, 0.620907545f},
-std::array<float,2>{0.305888861f, 0.758256197f},
-std::array<float,2>{0.580885649f, 0.279661864f},
-std::array<float,2>{0.355890095f, 0.205081597f},
-std::array<float,2>{0.519937217f, 0.7289083f},
-std::array<float,2>{0.0289723631f, 0.939468861f},
-std::array<float,2>{0.906891942f, 0.423592448f},
-std::array<float,2>{0.144487664f, 0.373754591f},
-std::array<float,2>{0.841546655f, 0.848991096f},
-std::array<float,2>{0.484239131f, 0.513024092f},
-std::array<float,2>{0.712854087f, 0.0266241431f},
-std::array<float,2>{0.298833877f, 0.455815047f},
-std::array<float,2>{0.589991987f, 0.90785706f},
-std::array<float,2>{0.0841960013f, 0.637672722f},
-std::array<float,2>{0.981376946f, 0.162464485f},
-std::array<float,2>{0.231387109f, 0.0788738653f},
-std::array<float,2>{0.753491819f, 0.563061953f},
-std::array<float,2>{0.382352203f, 0.790962219f},
-std::array<float,2>{0.655373573f, 0.28844288f},
-std::array<float,2>{0.474834085f, 0.228489771f},
-std::array<float,2>{0.70694989f, 0.702763498f},
-std::array<float,2>{0.153392017f, 0.985380292f},
-std::array<float,2>{0.828390539f, 0.399241f},
-std::array<float,2>{0.0220259819f, 0.314159691f},
-std::array<float,2>{0.915195286f, 0.841365337f},
-std::array<float,2>{0.347876579f, 0.555577576f},
-std::array<float,2>{0.530680656f, 0.0497824736f},
-std::array<float,2>{0.422160715f, 0.271867931f},
-std::array<float,2>{0.673595488f, 0.751436293f},
-std::array<float,2>{0.199605241f, 0.614304841f},
-std::array<float,2>{0.783361614f, 0.119839117f},
-std::array<float,2>{0.112993672f, 0.138628066f},
-std::array<float,2>{0.941891074f, 0.666268647f},
-std::array<float,2>{0.265169293f, 0.899668694f},
-std::array<float,2>{0.621401906f, 0.497422785f},
-std::array<float,2>{0.326287627f, 0.0221943837f},
-std::array<float,2>{0.553214371f, 0.501071155f},
-std::array<float,2>{0.0480941236f, 0.856167734f},
-std::array<float,2>{0.904477417f, 0.366458356f},
-std::array<float,2>{0.181907117f, 0.431433558f},
-std::array<float,2>{0.848527133f, 0.948530316f},
-std::array<float,2>{0.443865687f, 0.72038871f},
-std::array<float,2>{0.728063524f, 0.212787166f},
-std::array<float,2>{0.359392762f, 0.358223647f},
-std::array<float,2>{0.504642308f, 0.870612741f},
-std::array<float,2>{0.00192083581f, 0.521460414f},
-std::array<float,2>{0.926793277f, 0.00809528399f},
-std::array<float,2>{0.131360561f, 0.201787665f},
-std::array<float,2>{0.814187348f, 0.735934436f},
-std::array<float,2>{0.490891278f, 0.957576513f},
-std::array<float,2>{0.698244929f, 0.413813084f},
-std::array<float,2>{0.392891645f, 0.096169062f},
-std::array<float,2>{0.634616375f, 0.594774008f},
-std::array<float,2>{0.241971403f, 0.779476583f},
-std::array<float,2>{0.766256154f, 0.256868005f},
-std::array<float,2>{0.0734534711f, 0.472511202f},
-std::array<float,2>{0.993565083f, 0.890102446f},
-std::array<float,2>{0.296239167f, 0.680288076f},
-std::array<float,2>{0.572978437f, 0.145232037f},
-std::array<float,2>{0.466752738f, 0.387009114f},
-std::array<float,2>{0.744151473f, 0.974971294f},
-std::array<float,2>{0.162614584f, 0.708991468f},
-std::array<float,2>{0.873737872f, 0.247827411f},
-std::array<float,2>{0.033374656f, 0.0396130085f},
-std::array<float,2>{0.883693933f, 0.54090929f},
-std::array<float,2>{0.332177073f, 0.813564003f},
-std::array<float,2>{0.543324172f, 0.332243294f},
-std::array<float,2>{0.280644268f, 0.18324931f},
-std::array<float,2>{0.597640157f, 0.651273072f},
-std::array<float,2>{0.0948228836f, 0.922503293f},
-std::array<float,2>{0.964505911f, 0.442373544f},
-std::array<float,2>{0.216964945f, 0.305207342f},
-std::array<float,2>{0.803613186f, 0.809910715f},
-std::array<float,2>{0.421424001f, 0.582250297f},
-std::array<float,2>{0.671061933f, 0.0714849755f},
-std::array<float,2>{0.322003186f, 0.452648699f},
-std::array<float,2>{0.547344387f, 0.933882177f},
-std::array<float,2>{0.0518963858f, 0.647323847f},
-std::array<float,2>{0.898921013f, 0.173161387f},
-std::array<float,2>{0.187087789f, 0.0698269308f},
-std::array<float,2>{0.84661305f, 0.588165045f},
-std::array<float,2>{0.438089639f, 0.803695977f},
-std::array<float,2>{0.730726123f, 0.302356184f},
-std::array<float,2>{0.427700877f, 0.23676458f},
-std::array<float,2>{0.678371608f, 0.714966655f},
-std::array<float,2>{0.198173702f, 0.98309809f},
-std::array<float,2>{0.78575176f, 0.382464588f},
-std::array<float,2>{0.114552826f, 0.342463195f},
-std::array<float,2>{0.940647423f, 0.825220227f},
-std::array<float,2>{0.258271933f, 0.531451881f},
-std::array<float,2>{0.619226992f, 0.0318587869f},
-std::array<float,2>{0.470749885f, 0.260838866f},
-std::array<float,2>{0.708788991f, 0.769526184f},
-std::array<float,2>{0.149543181f, 0.603763938f},
-std::array<float,2>{0.834266126f, 0.103799246f},
-std::array<float,2>{0.0167460814f, 0.150144622f},
-std::array<float,2>{0.918742239f, 0.67537111f},
-std::array<float,2>{0.345188111f, 0.881125331f},
-std::array<float,2>{0.52681917f, 0.482230932f},
-std::array<float,2>{0.304510325f, 0.00683883019f},
-std::array<float,2>{0.588465929f, 0.525684059f},
-std::array<float,2>{0.0817320794f, 0.863108397f},
-std::array<float,2>{0.980309308f, 0.350653082f},
-std::array<float,2>{0.23024483f, 0.414904952f},
-std::array<float,2>{0.755630612f, 0.966452897f},
-std::array<float,2>{0.377019584f, 0.746967196f},
-std::array<float,2>{0.652030885f, 0.18811819f},
-std::array<float,2>{0.27499795f, 0.369839996f},
-std::array<float,2>{0.600326002f, 0.845553696f},
-std::array<float,2>{0.0980605111f, 0.509131491f},
-std::array<float,2>{0.965806901f, 0.0305709857f},
-std::array<float,2>{0.21133256f, 0.208937198f},
-std::array<float,2>{0.800523937f, 0.730703175f},
-std::array<float,2>{0.414640218f, 0.94273603f},
-std::array<float,2>{0.666810036f, 0.427589685f},
-std::array<float,2>{0.462184131f, 0.112132609f},
-std::array<float,2>{0.748107493f, 0.62355566f},
-std::array<float,2>{0.158432916f, 0.762938917f},
-std::array<float,2>{0.870453477f, 0.27422297f},
-std::array<float,2>{0.036399398f, 0.489923537f},
-std::array<float,2>{0.890396833f, 0.89716047f},
-std::array<float,2>{0.328429878f, 0.659315884f},
-std::array<float,2>{0.541428745f, 0.128673092f},
-std::array<float,2>{0.39818716f, 0.397428483f},
-std::array<float,2>{0.63785696f, 0.993109524f},
-std::array<float,2>{0.23737739f, 0.694823503f},
-std::array<float,2>{0.772254646f, 0.222475708f},
-std::array<float,2>{0.0781198218f, 0.0577564314f},
-std::array<float,2>{0.997597933f, 0.549137414f},
-std::array<float,2>{0.289755762f, 0.833202362f},
-std::array<float,2>{0.576450825f, 0.326485813f},
-std::array<float,2>{0.364311129f, 0.1684127f},
-std::array<float,2>{0.50192368f, 0.627745569f},
-std::array<float,2>{0.00523027312f, 0.918271422f},
-std::array<float,2>{0.924821198f, 0.461159557f},
-std::array<float,2>{0.125200912f, 0.289453059f},
-std::array<float,2>{0.817781627f, 0.781875968f},
-std::array<float,2>{0.485956043f, 0.576020598f},
-std::array<float,2>{0.701362431f, 0.0898483619f},
-std::array<float,2>{0.282266289f, 0.434018165f},
-std::array<float,2>{0.564345777f, 0.950556517f},
-std::array<float,2>{0.0671089888f, 0.723284721f},
-std::array<float,2>{0.987224817f, 0.217819259f},
-std::array<float,2>{0.244316265f, 0.019192297f},
-std::array<float,2>{0.77480185f, 0.50709331f},
-std::array<float,2>{0.401537597f, 0.854574144f},
-std::array<float,2>{0.626358807f, 0.361311913f},
-std::array<float,2>{0.494934529f, 0.136678204f},
-std::array<float,2>{0.688213468f, 0.671868742f},
-std::array<float,2>{0.137688413f, 0.902375996f},
-std::array<float,2>{0.82068938f, 0.492697269f},
-std::array<float,2>{0.00986974034f, 0.268813521f},
-std::array<float,2>{0.933426499f, 0.756641448f},
-std::array<float,2>{0.371711701f, 0.611198783f},
-std::array<float,2>{0.510617435f, 0.122837573f},
-std::array<float,2>{0.4122127f, 0.319037974f},
-std::array<float,2>{0.662626088f, 0.839556277f},
-std::array<float,2>{0.208982155f, 0.560064554f},
-std::array<float,2>{0.806586921f, 0.0520380847f},
-std::array<float,2>{0.102101319f, 0.231136858f},
-std::array<float,2>{0.958503544f, 0.697350681f},
-std::array<float,2>{0.269550711f, 0.990005195f},
-std::array<float,2>{0.601958752f, 0.404932469f},
-std::array<float,2>{0.340228587f, 0.0839323401f},
-std::array<float,2>{0.53697896f, 0.56673342f},
-std::array<float,2>{0.044953119f, 0.793893456f},
-std::array<float,2>{0.880516768f, 0.282829523f},
-std::array<float,2>{0.16551277f, 0.457491577f},
-std::array<float,2>{0.860962152f, 0.911049724f},
-std::array<float,2>{0.457826942f, 0.633264422f},
-std::array<float,2>{0.736172378f, 0.158670127f},
-std::array<float,2>{0.352163911f, 0.311888576f},
-std::array<float,2>{0.516323447f, 0.806357503f},
-std::array<float,2>{0.0255971886f, 0.581186295f},
-std::array<float,2>{0.913471401f, 0.0757184774f},
-std::array<float,2>{0.146085173f, 0.186988264f},
-std::array<float,2>{0.838060856f, 0.654795527f},
-std::array<float,2>{0.479681104f, 0.926965356f},
-std::array<float,2>{0.717837334f, 0.437508672f},
-std::array<float,2>{0.383949339f, 0.0441489331f},
-std::array<float,2>{0.648245096f, 0.544934511f},
-std::array<float,2>{0.224934861f, 0.818994701f},
-std::array<float,2>{0.76125443f, 0.329787642f},
-std::array<float,2>{0.0869441926f, 0.383342534f},
-std::array<float,2>{0.969325662f, 0.972324729f},
-std::array<float,2>{0.30931893f, 0.703487039f},
-std::array<float,2>{0.582372785f, 0.244210362f},
-std::array<float,2>{0.451759964f, 0.475757599f},
-std::array<float,2>{0.719066203f, 0.883204341f},
-std::array<float,2>{0.177838832f, 0.686417878f},
-std::array<float,2>{0.854925573f, 0.143442124f},
-std::array<float,2>{0.0622180253f, 0.10069374f},
-std::array<float,2>{0.891907752f, 0.599150777f},
-std::array<float,2>{0.316148221f, 0.774349034f},
-std::array<float,2>{0.556668758f, 0.251638293f},
-std::array<float,2>{0.254119009f, 0.198898017f},
-std::array<float,2>{0.610644519f, 0.741037011f},
-std::array<float,2>{0.12368907f, 0.956480026f},
-std::array<float,2>{0.951782525f, 0.408384889f},
-std::array<float,2>{0.190520003f, 0.35160321f},
-std::array<float,2>{0.796349525f, 0.871120095f},
-std::array<float,2>{0.433024853f, 0.517958283f},
-std::array<float,2>{0.683226645f, 0.0118018603f},
-std::array<float,2>{0.37064597f, 0.376977116f},
-std::array<float,2>{0.512429953f, 0.980266094f},
-std::array<float,2>{0.0145976599f, 0.713846684f},
-std::array<float,2>{0.934609234f, 0.23849602f},
-std::array<float,2>{0.13423726f, 0.0372251198f},
-std::array<float,2>{0.827575505f, 0.535870314f},
-std::array<float,2>{0.497422427f, 0.822785735f},
-std::array<float,2>{0.693325639f, 0.339150399f},
-std::array<float,2>{0.404921085f, 0.177377939f},
-std::array<float,2>{0.632321417f, 0.640820205f},
-std::array<float,2>{0.246363401f, 0.931855023f},
-std::array<float,2>{0.779126525f, 0.448101431f},
-std::array<float,2>{0.063686341f, 0.300372928f},
-std::array<float,2>{0.991735339f, 0.80014503f},
-std::array<float,2>{0.287341058f, 0.592888296f},
-std::array<float,2>{0.567579567f, 0.0659335405f},
-std::array<float,2>{0.455834389f, 0.343892246f},
-std::array<float,2>{0.741991937f, 0.867062807f},
-std::array<float,2>{0.170569092f, 0.52751714f},
-std::array<float,2>{0.863426089f, 0.00147668424f},
-std::array<float,2>{0.0407641232f, 0.194347635f},
-std::array<float,2>{0.875012398f, 0.744637251f},
-std::array<float,2>{0.3369326f, 0.964266002f},
-std::array<float,2>{0.531578839f, 0.41846025f},
-std::array<float,2>{0.267506659f, 0.105871469f},
-std::array<float,2>{0.605858266f, 0.607982993f},
-std::array<float,2>{0.105621047f, 0.769731283f},
-std::array<float,2>{0.955138266f, 0.264985979f},
-std::array<float,2>{0.206999898f, 0.480077863f},
-std::array<float,2>{0.809515595f, 0.875446022f},
-std::array<float,2>{0.410065591f, 0.677621186f},
-std::array<float,2>{0.658675075f, 0.155650601f},
-std::array<float,2>{0.307997525f, 0.27781263f},
-std::array<float,2>{0.579331458f, 0.761062086f},
-std::array<float,2>{0.0912403613f, 0.61810708f},
-std::array<float,2>{0.975279093f, 0.116377391f},
-std::array<float,2>{0.219553486f, 0.130252123f},
-std::array<float,2>{0.763398349f, 0.662629247f},
-std::array<float,2>{0.389953822f, 0.893757701f},
-std::array<float,2>{0.641069651f, 0.488137156f},
-std::array<float,2>{0.48223424f, 0.0243068635f},
-std::array<float,2>{0.713193059f, 0.514539838f},
-std::array<float,2>{0.141944945f, 0.85078156f},
-std::array<float,2>{0.843104601f, 0.372760862f},
-std::array<float,2>{0.0309018325f, 0.425052553f},
-std::array<float,2>{0.908267796f, 0.937621176f},
-std::array<float,2>{0.357699096f, 0.72792381f},
-std::array<float,2>{0.522522926f, 0.20358865f},
-std::array<float,2>{0.436519325f, 0.46573025f},
-std::array<float,2>{0.68523711f, 0.915698767f},
-std::array<float,2>{0.195099473f, 0.631899059f},
-std::array<float,2>{0.791524231f, 0.167380035f},
-std::array<float,2>{0.118175119f, 0.085973911f},
-std::array<float,2>{0.946266711f, 0.57348609f},
-std::array<float,2>{0.252042502f, 0.785968721f},
-std::array<float,2>{0.617152989f, 0.296214312f},
-std::array<float,2>{0.318768799f, 0.225163817f},
-std::array<float,2>{0.560750544f, 0.688531816f},
-std::array<float,2>{0.0552943721f, 0.997553766f},
-std::array<float,2>{0.897484064f, 0.390977144f},
-std::array<float,2>{0.172413185f, 0.323904961f},
-std::array<float,2>{0.856652796f, 0.831059515f},
-std::array<float,2>{0.446670532f, 0.552423358f},
-std::array<float,2>{0.726303577f, 0.0601536296f},
-std::array<float,2>{0.261935353f, 0.498533607f},
-std::array<float,2>{0.624322116f, 0.901343763f},
-std::array<float,2>{0.109595999f, 0.665352643f},
-std::array<float,2>{0.943748176f, 0.14038533f},
-std::array<float,2>{0.203103185f, 0.117661744f},
-std::array<float,2>{0.782782614f, 0.615954936f},
-std::array<float,2>{0.424917251f, 0.753252625f},
-std::array<float,2>{0.67414391f, 0.269895524f},
-std::array<float,2>{0.441856414f, 0.214655757f},
-std::array<float,2>{0.730008602f, 0.721794248f},
-std::array<float,2>{0.180952385f, 0.946221352f},
-std::array<float,2>{0.850168049f, 0.433592796f},
-std::array<float,2>{0.0491690338f, 0.3648929f},
-std::array<float,2>{0.903924167f, 0.858397126f},
-std::array<float,2>{0.325745016f, 0.502999127f},
-std::array<float,2>{0.552126229f, 0.0209740307f},
-std::array<float,2>{0.379533738f, 0.286744118f},
-std::array<float,2>{0.65245533f, 0.791514456f},
-std::array<float,2>{0.233101964f, 0.565880239f},
-std::array<float,2>{0.750205517f, 0.0805203244f},
-std::array<float,2>{0.0836240947f, 0.161603391f},
-std::array<float,2>{0.983960629f, 0.639750123f},
-std::array<float,2>{0.297078371f, 0.909449637f},
-std::array<float,2>{0.592384934f, 0.454403043f},
-std::array<float,2>{0.350082248f, 0.0469761789f},
-std::array<float,2>{0.528262377f, 0.557412088f},
-std::array<float,2>{0.0214472413f, 0.843083322f},
-std::array<float,2>{0.916879058f, 0.314902127f},
-std::array<float,2>{0.155571222f, 0.401391834f},
-std::array<float,2>{0.831117034f, 0.98736614f},
-std::array<float,2>{0.473609328f, 0.700857759f},
-std::array<float,2>{0.704496801f, 0.228602856f},
-std::array<float,2>{0.335016876f, 0.335546166f},
-std::array<float,2>{0.546377003f, 0.815907419f},
-std::array<float,2>{0.0328688435f, 0.542040348f},
-std::array<float,2>{0.885857344f, 0.0428131782f},
-std::array<float,2>{0.16126287f, 0.249492273f},
-std::array<float,2>{0.871790826f, 0.708646357f},
-std::array<float,2>{0.468454182f, 0.973738134f},
-std::array<float,2>{0.743112743f, 0.389229536f},
-std::array<float,2>{0.419250429f, 0.0738778487f},
-std::array<float,2>{0.669513404f, 0.584554374f},
-std::array<float,2>{0.216694459f, 0.812243879f},
-std::array<float,2>{0.801271856f, 0.307124138f},
-std::array<float,2>{0.0972270072f, 0.443526924f},
-std::array<float,2>{0.96253413f, 0.925136864f},
-std::array<float,2>{0.278958768f, 0.648799479f},
-std::array<float,2>{0.595271409f, 0.181222349f},
-std::array<float,2>{0.489765644f, 0.411044985f},
-std::array<float,2>{0.696721554f, 0.9597736f},
-std::array<float,2>{0.129620716f, 0.737660527f},
-std::array<float,2>{0.815949738f, 0.200047836f},
-std::array<float,2>{0.0029706154f, 0.0114108855f},
-std::array<float,2>{0.928325891f, 0.522849381f},
-std::array<float,2>{0.362242401f, 0.868009925f},
-std::array<float,2>{0.507084668f, 0.356275946f},
-std::array<float,2>{0.293670833f, 0.147411525f},
-std::array<float,2>{0.570721328f, 0.682854474f},
-std::array<float,2>{0.0717564672f, 0.886980414f},
-std::array<float,2>{0.995835006f, 0.469885707f},
-std::array<float,2>{0.239607453f, 0.254953176f},
-std::array<float,2>{0.768041909f, 0.778490245f},
-std::array<float,2>{0.392026752f, 0.596539021f},
-std::array<float,2>{0.636199892f, 0.094685778f},
-std::array<float,2>{0.355137974f, 0.438205272f},
-std::array<float,2>{0.519104242f, 0.92725116f},
-std::array<float,2>{0.0249676593f, 0.65444541f},
-std::array<float,2>{0.91092056f, 0.187154993f},
-std::array<float,2>{0.147146642f, 0.0754922554f},
-std::array<float,2>{0.837247074f, 0.581612349f},
-std::array<float,2>{0.477456927f, 0.805995226f},
-std::array<float,2>{0.716354966f, 0.312287241f},
-std::array<float,2>{0.386426568f, 0.244876891f},
-std::array<float,2>{0.644941807f, 0.703720748f},
-std::array<float,2>{0.223438948f, 0.972098768f},
-std::array<float,2>{0.75930649f, 0.382929027f},
-std::array<float,2>{0.0891979262f, 0.329238325f},
-std::array<float,2>{0.972433686f, 0.818534732f},
-std::array<float,2>{0.311310947f, 0.545712769f},
-std::array<float,2>{0.58467263f, 0.0447574593f},
-std::array<float,2>{0.450267017f, 0.251045763f},
-std::array<float,2>{0.721926212f, 0.77391547f},
-std::array<float,2>{0.177189469f, 0.598774195f},
-std::array<float,2>{0.853351712f, 0.101151079f},
-std::array<float,2>{0.0604107082f, 0.142993554f},
-std::array<float,2>{0.894511819f, 0.685626388f},
-std::array<float,2>{0.313489974f, 0.883693159f},
-std::array<float,2>{0.556337357f, 0.476270258f},
-std::array<float,2>{0.25744462f, 0.0126415631f},
-std::array<float,2>{0.611873925f, 0.518535435f},
-std::array<float,2>{0.122392885f, 0.871843994f},
-std::array<float,2>{0.950051725f, 0.352147549f},
-std::array<float,2>{0.188737988f, 0.408976287f},
-std::array<float,2>{0.793772161f, 0.956673026f},
-std::array<float,2>{0.43049705f, 0.740255117f},
-std::array<float,2>{0.679947317f, 0.198398709f},
-std::array<float,2>{0.284608394f, 0.360440522f},
-std::array<float,2>{0.566187501f, 0.855330467f},
-std::array<float,2>{0.0700016245f, 0.507695556f},
-std::array<float,2>{0.98498106f, 0.0189225469f},
-std::array<float,2>{0.243189439f, 0.218607515f},
-std::array<float,2>{0.776851356f, 0.722785354f},
-std::array<float,2>{0.39892152f, 0.950848162f},
-std::array<float,2>{0.628344595f, 0.434268355f},
-std::array<float,2>{0.492309809f, 0.12229912f},
-std::array<float,2>{0.689699054f, 0.610538185f},
-std::array<float,2>{0.139382973f, 0.756178439f},
-std::array<float,2>{0.823237062f, 0.269284517f},
-std::array<float,2>{0.00910617411f, 0.492221922f},
-std::array<float,2>{0.929986f, 0.903287768f},
-std::array<float,2>{0.373538345f, 0.671156228f},
-std::array<float,2>{0.508694768f, 0.136037961f},
-std::array<float,2>{0.410973758f, 0.404670954f},
-std::array<float,2>{0.661987901f, 0.989286304f},
-std::array<float,2>{0.209185645f, 0.698004246f},
-std::array<float,2>{0.807178259f, 0.23081474f},
-std::array<float,2>{0.104069024f, 0.0523494631f},
-std::array<float,2>{0.959708929f, 0.559833705f},
-std::array<float,2>{0.272786289f, 0.839296877f},
-std::array<float,2>{0.604565382f, 0.318493426f},
-std::array<float,2>{0.341834933f, 0.158738762f},
-std::array<float,2>{0.538461983f, 0.633395612f},
-std::array<float,2>{0.0434822589f, 0.910580218f},
-std::array<float,2>{0.881267726f, 0.457731664f},
-std::array<float,2>{0.16698201f, 0.282289296f},
-std::array<float,2>{0.862450719f, 0.792977333f},
-std::array<float,2>{0.460645556f, 0.567147434f},
-std::array<float,2>{0.737848461f, 0.0831588581f},
-std::array<float,2>{0.276209652f, 0.426795125f},
-std::array<float,2>{0.599544704f, 0.943272352f},
-std::array<float,2>{0.100941241f, 0.731228769f},
-std::array<float,2>{0.966857016f, 0.208200768f},
-std::array<float,2>{0.213888854f, 0.0309086125f},
-std::array<float,2>{0.798798501f, 0.509573817f},
-std::array<float,2>{0.417340159f, 0.84503454f},
-std::array<float,2>{0.665756464f, 0.369203538f},
-std::array<float,2>{0.462991893f, 0.12836656f},
-std::array<float,2>{0.746668577f, 0.659739614f},
-std::array<float,2>{0.156908154f, 0.896870971f},
-std::array<float,2>{0.867371559f, 0.489702284f},
-std::array<float,2>{0.0380340107f, 0.273846984f},
-std::array<float,2>{0.887878418f, 0.763206303f},
-std::array<float,2>{0.331114471f, 0.623228252f},
-std::array<float,2>{0.540521502f, 0.111455977f},
-std::array<float,2>{0.396406293f, 0.326941788f},
-std::array<float,2>{0.640489161f, 0.833938658f},
-std::array<float,2>{0.235091299f, 0.549696028f},
-std::array<float,2>{0.769606233f, 0.0585512854f},
-std::array<float,2>{0.0755589306f, 0.222032264f},
-std::array<float,2>{0.999491334f, 0.694995403f},
-std::array<float,2>{0.292095751f, 0.992440522f},
-std::array<float,2>{0.574390113f, 0.396744877f},
-std::array<float,2>{0.367100656f, 0.0904152095f},
-std::array<float,2>{0.503410518f, 0.575414836f},
-std::array<float,2>{0.00715189101f, 0.781618059f},
-std::array<float,2>{0.921918511f, 0.289872885f},
-std::array<float,2>{0.128599152f, 0.461707413f},
-std::array<float,2>{0.819471776f, 0.918481171f},
-std::array<float,2>{0.486487776f, 0.627408147f},
-std::array<float,2>{0.701123118f, 0.168662906f},
-std::array<float,2>{0.322306097f, 0.302013189f},
-std::array<float,2>{0.549057901f, 0.802735865f},
-std::array<float,2>{0.0544810146f, 0.58879745f},
-std::array<float,2>{0.900510669f, 0.069577828f},
-std::array<float,2>{0.184586972f, 0.173415139f},
-std::array<float,2>{0.845077097f, 0.646710873f},
-std::array<float,2>{0.439658314f, 0.934520125f},
-std::array<float,2>{0.733117104f, 0.452150285f},
-std::array<float,2>{0.429077148f, 0.0314827785f},
-std::array<float,2>{0.67593056f, 0.532219172f},
-std::array<float,2>{0.195684701f, 0.825874865f},
-std::array<float,2>{0.788739979f, 0.34212938f},
-std::array<float,2>{0.116530761f, 0.382318884f},
-std::array<float,2>{0.937812686f, 0.982465386f},
-std::array<float,2>{0.261064649f, 0.715671241f},
-std::array<float,2>{0.617488086f, 0.237267807f},
-std::array<float,2>{0.470234871f, 0.481704861f},
-std::array<float,2>{0.710870802f, 0.881472349f},
-std::array<float,2>{0.15208444f, 0.674857438f},
-std::array<float,2>{0.833271205f, 0.149520561f},
-std::array<float,2>{0.0187276974f, 0.104087308f},
-std::array<float,2>{0.921715975f, 0.604429066f},
-std::array<float,2>{0.34610936f, 0.76901561f},
-std::array<float,2>{0.524185002f, 0.26163885f},
-std::array<float,2>{0.30134216f, 0.187860042f},
-std::array<float,2>{0.58737427f, 0.746436656f},
-std::array<float,2>{0.0785404444f, 0.965986013f},
-std::array<float,2>{0.976978719f, 0.414390922f},
-std::array<float,2>{0.226580411f, 0.3514193f},
-std::array<float,2>{0.757219911f, 0.862512708f},
-std::array<float,2>{0.375097483f, 0.526109099f},
-std::array<float,2>{0.649097264f, 0.00771059887f},
-std::array<float,2>{0.33275342f, 0.388976395f},
-std::array<float,2>{0.543715179f, 0.974474072f},
-std::array<float,2>{0.0338793173f, 0.708355069f},
-std::array<float,2>{0.88304764f, 0.249608845f},
-std::array<float,2>{0.162481129f, 0.0423918702f},
-std::array<float,2>{0.873309255f, 0.542535722f},
-std::array<float,2>{0.46592018f, 0.816172481f},
-std::array<float,2>{0.744768858f, 0.335188597f},
-std::array<float,2>{0.421236277f, 0.181103975f},
-std::array<float,2>{0.671866059f, 0.649008512f},
-std::array<float,2>{0.217598185f, 0.925380111f},
-std::array<float,2>{0.802891493f, 0.444078207f},
-std::array<float,2>{0.0954883099f, 0.307521194f},
-std::array<float,2>{0.964062214f, 0.811687529f},
-std::array<float,2>{0.280913085f, 0.583988428f},
-std::array<float,2>{0.597146869f, 0.0734836906f},
-std::array<float,2>{0.490274459f, 0.355791748f},
-std::array<float,2>{0.699136376f, 0.867442131f},
-std::array<float,2>{0.131340027f, 0.523410857f},
-std::array<float,2>{0.813677728f, 0.0112072742f},
-std::array<float,2>{0.0012591288f, 0.199632049f},
-std::array<float,2>{0.92763412f, 0.738017499f},
-std::array<float,2>{0.360252351f, 0.959352791f},
-std::array<float,2>{0.503992617f, 0.410407126f},
-std::array<float,2>{0.296542257f, 0.0939539447f},
-std::array<float,2>{0.572738588f, 0.595731258f},
-std::array<float,2>{0.0741423145f, 0.778979361f},
-std::array<float,2>{0.993978679f, 0.255665421f},
-std::array<float,2>{0.24133426f, 0.470340341f},
-std::array<float,2>{0.765888631f, 0.887588203f},
-std::array<float,2>{0.393119067f, 0.683438957f},
-std::array<float,2>{0.634213328f, 0.146531343f},
-std::array<float,2>{0.265111357f, 0.270507067f},
-std::array<float,2>{0.621826231f, 0.75357759f},
-std::array<float,2>{0.112566099f, 0.615534902f},
-std::array<float,2>{0.942237079f, 0.11793758f},
-std::array<float,2>{0.200013399f, 0.139750168f},
-std::array<float,2>{0.784103513f, 0.665588439f},
-std::array<float,2>{0.422451288f, 0.90062809f},
-std::array<float,2>{0.672852874f, 0.498569638f},
-std::array<float,2>{0.443449885f, 0.0213163346f},
-std::array<float,2>{0.728027105f, 0.503823519f},
-std::array<float,2>{0.182485431f, 0.8575899f},
-std::array<float,2>{0.84809345f, 0.36438033f},
-std::array<float,2>{0.0486185774f, 0.432684541f},
-std::array<float,2>{0.905101836f, 0.945362449f},
-std::array<float,2>{0.327144235f, 0.722545326f},
-std::array<float,2>{0.553378284f, 0.21391359f},
-std::array<float,2>{0.382115006f, 0.45471248f},
-std::array<float,2>{0.655780613f, 0.910096407f},
-std::array<float,2>{0.230689839f, 0.640239f},
-std::array<float,2>{0.753339291f, 0.161843747f},
-std::array<float,2>{0.0846839845f, 0.0809995383f},
-std::array<float,2>{0.980825543f, 0.565923929f},
-std::array<float,2>{0.299352556f, 0.791403353f},
-std::array<float,2>{0.590711117f, 0.286489576f},
-std::array<float,2>{0.348600745f, 0.229342043f},
-std::array<float,2>{0.53076303f, 0.700576067f},
-std::array<float,2>{0.0214868262f, 0.987976134f},
-std::array<float,2>{0.915656686f, 0.402230144f},
-std::array<float,2>{0.153814882f, 0.315182656f},
-std::array<float,2>{0.829035997f, 0.843471229f},
-std::array<float,2>{0.475433022f, 0.556976974f},
-std::array<float,2>{0.706099033f, 0.0474995039f},
-std::array<float,2>{0.306562871f, 0.487677187f},
-std::array<float,2>{0.580340385f, 0.894313812f},
-std::array<float,2>{0.092306979f, 0.662420452f},
-std::array<float,2>{0.974176764f, 0.130725697f},
-std::array<float,2>{0.22091879f, 0.117148377f},
-std::array<float,2>{0.764775574f, 0.617362738f},
-std::array<float,2>{0.387638539f, 0.761539638f},
-std::array<float,2>{0.643460751f, 0.277978659f},
-std::array<float,2>{0.483847111f, 0.203903332f},
-std::array<float,2>{0.712216198f, 0.728418469f},
-std::array<float,2>{0.143973425f, 0.938457549f},
-std::array<float,2>{0.841303706f, 0.425582677f},
-std::array<float,2>{0.0287246816f, 0.372142017f},
-std::array<float,2>{0.906445563f, 0.851179838f},
-std::array<float,2>{0.356229484f, 0.513990879f},
-std::array<float,2>{0.520498753f, 0.0235683806f},
-std::array<float,2>{0.435068607f, 0.296608984f},
-std::array<float,2>{0.687034786f, 0.785549641f},
-std::array<float,2>{0.192639023f, 0.573742926f},
-std::array<float,2>{0.790627658f, 0.0864665806f},
-std::array<float,2>{0.119918957f, 0.167642891f},
-std::array<float,2>{0.947704315f, 0.632593393f},
-std::array<float,2>{0.251597792f, 0.91522181f},
-std::array<float,2>{0.613330901f, 0.465283453f},
-std::array<float,2>{0.317652404f, 0.0599493869f},
-std::array<float,2>{0.558759153f, 0.551865041f},
-std::array<float,2>{0.0572496951f, 0.831991494f},
-std::array<float,2>{0.894914985f, 0.323466957f},
-std::array<float,2>{0.175564364f, 0.391123354f},
-std::array<float,2>{0.858338654f, 0.997945786f},
-std::array<float,2>{0.447666496f, 0.689279437f},
-std::array<float,2>{0.724594533f, 0.224751189f},
-std::array<float,2>{0.368497282f, 0.339407742f},
-std::array<float,2>{0.514175713f, 0.822383344f},
-std::array<float,2>{0.0120329224f, 0.53529501f},
-std::array<float,2>{0.936836958f, 0.0379435644f},
-std::array<float,2>{0.135251895f, 0.23901467f},
-std::array<float,2>{0.824495375f, 0.713275254f},
-std::array<float,2>{0.4999744f, 0.979951262f},
-std::array<float,2>{0.694519103f, 0.377751976f},
-std::array<float,2>{0.40370667f, 0.0655521452f},
-std::array<float,2>{0.630290508f, 0.59363091f},
-std::array<float,2>{0.248558044f, 0.800303519f},
-std::array<float,2>{0.779774427f, 0.299879819f},
-std::array<float,2>{0.0658770651f, 0.447443157f},
-std::array<float,2>{0.98891151f, 0.932256579f},
-std::array<float,2>{0.285157412f, 0.641295552f},
-std::array<float,2>{0.570207953f, 0.17706871f},
-std::array<float,2>{0.453713953f, 0.418001503f},
-std::array<float,2>{0.739826798f, 0.964715064f},
-std::array<float,2>{0.168236092f, 0.744574964f},
-std::array<float,2>{0.866943538f, 0.195210278f},
-std::array<float,2>{0.0416709594f, 0.00107116729f},
-std::array<float,2>{0.877644122f, 0.528318822f},
-std::array<float,2>{0.339451015f, 0.866226077f},
-std::array<float,2>{0.533424437f, 0.344262987f},
-std::array<float,2>{0.268647134f, 0.15609628f},
-std::array<float,2>{0.60846591f, 0.676849246f},
-std::array<float,2>{0.109125286f, 0.875828564f},
-std::array<float,2>{0.955002367f, 0.479637474f},
-std::array<float,2>{0.203637764f, 0.2653355f},
-std::array<float,2>{0.812255621f, 0.770403624f},
-std::array<float,2>{0.40755251f, 0.607703686f},
-std::array<float,2>{0.657193661f, 0.106248438f},
-std::array<float,2>{0.315729529f, 0.472856283f},
-std::array<float,2>{0.557476401f, 0.886611044f},
-std::array<float,2>{0.0617622286f, 0.685040236f},
-std::array<float,2>{0.892553091f, 0.140655607f},
-std::array<float,2>{0.1784302f, 0.0979480073f},
-std::array<float,2>{0.855380356f, 0.599891663f},
-std::array<float,2>{0.451620489f, 0.776171863f},
-std::array<float,2>{0.719639182f, 0.253691465f},
-std::array<float,2>{0.433468491f, 0.196637869f},
-std::array<float,2>{0.682998121f, 0.740040958f},
-std::array<float,2>{0.191024989f, 0.954010785f},
-std::array<float,2>{0.796797216f, 0.406829208f},
-std::array<float,2>{0.123118341f, 0.353924811f},
-std::array<float,2>{0.951189637f, 0.874562919f},
-std::array<float,2>{0.254647374f, 0.517104268f},
-std::array<float,2>{0.610860348f, 0.0142553858f},
-std::array<float,2>{0.480177313f, 0.310210139f},
-std::array<float,2>{0.718551278f, 0.808048189f},
-std::array<float,2>{0.145782366f, 0.579732358f},
-std::array<float,2>{0.838532627f, 0.0777797326f},
-std::array<float,2>{0.0261215381f, 0.183973432f},
-std::array<float,2>{0.913616419f, 0.654168546f},
-std::array<float,2>{0.351691723f, 0.927766919f},
-std::array<float,2>{0.515843749f, 0.440211415f},
-std::array<float,2>{0.308728188f, 0.0462851189f},
-std::array<float,2>{0.582537055f, 0.543830693f},
-std::array<float,2>{0.0874309242f, 0.817825198f},
-std::array<float,2>{0.969099045f, 0.330807358f},
-std::array<float,2>{0.225384995f, 0.38542074f},
-std::array<float,2>{0.760786116f, 0.970624804f},
-std::array<float,2>{0.384437263f, 0.706059992f},
-std::array<float,2>{0.647805393f, 0.242657796f},
-std::array<float,2>{0.270398021f, 0.317947507f},
-std::array<float,2>{0.602466404f, 0.837792993f},
-std::array<float,2>{0.10195335f, 0.562124193f},
-std::array<float,2>{0.958212495f, 0.0543742403f},
-std::array<float,2>{0.208107322f, 0.2333868f},
-std::array<float,2>{0.806056023f, 0.696188867f},
-std::array<float,2>{0.412757993f, 0.99151969f},
-std::array<float,2>{0.662559271f, 0.403823972f},
-std::array<float,2>{0.457351744f, 0.0843959525f},
-std::array<float,2>{0.735555887f, 0.568473637f},
-std::array<float,2>{0.166011006f, 0.795086086f},
-std::array<float,2>{0.860587835f, 0.284561455f},
-std::array<float,2>{0.0458656624f, 0.46052748f},
-std::array<float,2>{0.880104363f, 0.912899971f},
-std::array<float,2>{0.340616047f, 0.635076046f},
-std::array<float,2>{0.536171019f, 0.157570273f},
-std::array<float,2>{0.402101994f, 0.435863763f},
-std::array<float,2>{0.626740634f, 0.951380253f},
-std::array<float,2>{0.244883001f, 0.725145161f},
-std::array<float,2>{0.775017679f, 0.215995729f},
-std::array<float,2>{0.0666074902f, 0.0157917868f},
-std::array<float,2>{0.986442447f, 0.504305184f},
-std::array<float,2>{0.283085823f, 0.852563202f},
-std::array<float,2>{0.563801825f, 0.362519652f},
-std::array<float,2>{0.371447235f, 0.13283594f},
-std::array<float,2>{0.510122716f, 0.668075025f},
-std::array<float,2>{0.0107175764f, 0.904810965f},
-std::array<float,2>{0.932710409f, 0.495417982f},
-std::array<float,2>{0.137089446f, 0.267499328f},
-std::array<float,2>{0.820802093f, 0.75555104f},
-std::array<float,2>{0.494300455f, 0.612912238f},
-std::array<float,2>{0.687985122f, 0.123191401f},
-std::array<float,2>{0.289419234f, 0.395561278f},
-std::array<float,2>{0.576684415f, 0.994798958f},
-std::array<float,2>{0.0772225931f, 0.691719115f},
-std::array<float,2>{0.997550428f, 0.22035116f},
-std::array<float,2>{0.238062859f, 0.0559918322f},
-std::array<float,2>{0.771956325f, 0.54848969f},
-std::array<float,2>{0.397773832f, 0.835335732f},
-std::array<float,2>{0.638423681f, 0.325203151f},
-std::array<float,2>{0.48565945f, 0.170312196f},
-std::array<float,2>{0.70198983f, 0.626623154f},
-std::array<float,2>{0.12592414f, 0.920055568f},
-std::array<float,2>{0.818177402f, 0.463319361f},
-std::array<float,2>{0.00554851815f, 0.29239285f},
-std::array<float,2>{0.925617158f, 0.784912765f},
-std::array<float,2>{0.365183234f, 0.578076363f},
-std::array<float,2>{0.501455605f, 0.0930025801f},
-std::array<float,2>{0.414534926f, 0.368321031f},
-std::array<float,2>{0.666045547f, 0.846803606f},
-std::array<float,2>{0.211906835f, 0.510839403f},
-std::array<float,2>{0.800237715f, 0.02844299f},
-std::array<float,2>{0.0983779877f, 0.209716782f},
-std::array<float,2>{0.96487087f, 0.733921051f},
-std::array<float,2>{0.27475667f, 0.945303559f},
-std::array<float,2>{0.599971771f, 0.429383218f},
-std::array<float,2>{0.32866317f, 0.109625414f},
-std::array<float,2>{0.541757882f, 0.622040749f},
-std::array<float,2>{0.036988873f, 0.765288234f},
-std::array<float,2>{0.88993603f, 0.276362121f},
-std::array<float,2>{0.158741102f, 0.491374493f},
-std::array<float,2>{0.871009946f, 0.89640677f},
-std::array<float,2>{0.462834865f, 0.65741992f},
-std::array<float,2>{0.748635888f, 0.126251459f},
-std::array<float,2>{0.34544912f, 0.258602113f},
-std::array<float,2>{0.526977777f, 0.767395318f},
-std::array<float,2>{0.0174474139f, 0.602712452f},
-std::array<float,2>{0.918351054f, 0.102710024f},
-std::array<float,2>{0.149983913f, 0.151529834f},
-std::array<float,2>{0.834575176f, 0.672993183f},
-std::array<float,2>{0.471613854f, 0.879776359f},
-std::array<float,2>{0.708227873f, 0.483225405f},
-std::array<float,2>{0.377461284f, 0.00426491583f},
-std::array<float,2>{0.651478589f, 0.52415812f},
-std::array<float,2>{0.229793131f, 0.859414577f},
-std::array<float,2>{0.755234599f, 0.348563373f},
-std::array<float,2>{0.0813111663f, 0.417386353f},
-std::array<float,2>{0.979808211f, 0.967862368f},
-std::array<float,2>{0.303715229f, 0.748927534f},
-std::array<float,2>{0.588188231f, 0.190928906f},
-std::array<float,2>{0.437676728f, 0.450884849f},
-std::array<float,2>{0.731233537f, 0.93611002f},
-std::array<float,2>{0.18678537f, 0.645049989f},
-std::array<float,2>{0.845869958f, 0.175695464f},
-std::array<float,2>{0.0523419529f, 0.0678413212f},
-std::array<float,2>{0.899229169f, 0.586192012f},
-std::array<float,2>{0.321539402f, 0.80199343f},
-std::array<float,2>{0.547775209f, 0.303854018f},
-std::array<float,2>{0.258503884f, 0.234503657f},
-std::array<float,2>{0.620026469f, 0.718589306f},
-std::array<float,2>{0.114764012f, 0.980953336f},
-std::array<float,2>{0.940975368f, 0.37984544f},
-std::array<float,2>{0.197659701f, 0.340741009f},
-std::array<float,2>{0.785288393f, 0.827507734f},
-std::array<float,2>{0.427026451f, 0.533579469f},
-std::array<float,2>{0.67794174f, 0.0336155109f},
-std::array<float,2>{0.36140123f, 0.413093865f},
-std::array<float,2>{0.50745213f, 0.95728004f},
-std::array<float,2>{0.00362616731f, 0.735571206f},
-std::array<float,2>{0.927827418f, 0.201600805f},
-std::array<float,2>{0.12891461f, 0.00830459595f},
-std::array<float,2>{0.815547109f, 0.52050972f},
-std::array<float,2>{0.489705712f, 0.870398521f},
-std::array<float,2>{0.696779847f, 0.357624888f},
-std::array<float,2>{0.392259598f, 0.144570619f},
-std::array<float,2>{0.636400521f, 0.679988921f},
-std::array<float,2>{0.240102068f, 0.890614688f},
-std::array<float,2>{0.768102705f, 0.472123146f},
-std::array<float,2>{0.0719359592f, 0.257469326f},
-std::array<float,2>{0.995324612f, 0.780159414f},
-std::array<float,2>{0.293402463f, 0.595391929f},
-std::array<float,2>{0.571134508f, 0.0965711102f},
-std::array<float,2>{0.467980921f, 0.332597226f},
-std::array<float,2>{0.742268145f, 0.814398766f},
-std::array<float,2>{0.162050843f, 0.540292621f},
-std::array<float,2>{0.871273577f, 0.039087534f},
-std::array<float,2>{0.0324447304f, 0.247179344f},
-std::array<float,2>{0.886258364f, 0.709473252f},
-std::array<float,2>{0.335743278f, 0.975565135f},
-std::array<float,2>{0.546595335f, 0.387495965f},
-std::array<float,2>{0.27848947f, 0.0721590444f},
-std::array<float,2>{0.594848275f, 0.582618415f},
-std::array<float,2>{0.0968953744f, 0.810120225f},
-std::array<float,2>{0.962189794f, 0.30472371f},
-std::array<float,2>{0.216109335f, 0.441450834f},
-std::array<float,2>{0.801022112f, 0.922324717f},
-std::array<float,2>{0.419751555f, 0.650795937f},
-std::array<float,2>{0.669106722f, 0.182889149f},
-std::array<float,2>{0.297789037f, 0.288637847f},
-std::array<float,2>{0.592263579f, 0.790492535f},
-std::array<float,2>{0.0830782428f, 0.562755585f},
-std::array<float,2>{0.983805418f, 0.0784389451f},
-std::array<float,2>{0.232903004f, 0.162738606f},
-std::array<float,2>{0.750847876f, 0.636773527f},
-std::array<float,2>{0.379339427f, 0.907277703f},
-std::array<float,2>{0.653249323f, 0.455103576f},
-std::array<float,2>{0.472798586f, 0.0492793135f},
-std::array<float,2>{0.705021679f, 0.55488354f},
-std::array<float,2>{0.15609394f, 0.841051579f},
-std::array<float,2>{0.831936777f, 0.313708693f},
-std::array<float,2>{0.0209550411f, 0.398762167f},
-std::array<float,2>{0.91605556f, 0.985995412f},
-std::array<float,2>{0.350198656f, 0.702352881f},
-std::array<float,2>{0.527444661f, 0.227735311f},
-std::array<float,2>{0.425362915f, 0.497798562f},
-std::array<float,2>{0.674697995f, 0.90013051f},
-std::array<float,2>{0.202316046f, 0.666681707f},
-std::array<float,2>{0.782458842f, 0.137950331f},
-std::array<float,2>{0.11018157f, 0.119156756f},
-std::array<float,2>{0.944162607f, 0.614757478f},
-std::array<float,2>{0.26234594f, 0.751672387f},
-std::array<float,2>{0.624724865f, 0.272430182f},
-std::array<float,2>{0.32544297f, 0.212076262f},
-std::array<float,2>{0.552611172f, 0.719752133f},
-std::array<float,2>{0.0494780056f, 0.948906004f},
-std::array<float,2>{0.903645217f, 0.431097627f},
-std::array<float,2>{0.181515425f, 0.366910458f},
-std::array<float,2>{0.850016236f, 0.855781078f},
-std::array<float,2>{0.442182839f, 0.501696646f},
-std::array<float,2>{0.729516804f, 0.0215847157f},
-std::array<float,2>{0.252894789f, 0.467463464f},
-std::array<float,2>{0.616443157f, 0.917771816f},
-std::array<float,2>{0.118894711f, 0.629511356f},
-std::array<float,2>{0.945765316f, 0.164223462f},
-std::array<float,2>{0.194603652f, 0.0888761804f},
-std::array<float,2>{0.791416287f, 0.571737707f},
-std::array<float,2>{0.435585886f, 0.787679017f},
-std::array<float,2>{0.684791625f, 0.294715911f},
-std::array<float,2>{0.447062343f, 0.223405048f},
-std::array<float,2>{0.725863338f, 0.690386653f},
-std::array<float,2>{0.171878144f, 0.998073101f},
-std::array<float,2>{0.857126892f, 0.392956018f},
-std::array<float,2>{0.0548265204f, 0.322208017f},
-std::array<float,2>{0.898364663f, 0.829967022f},
-std::array<float,2>{0.319026053f, 0.553942084f},
-std::array<float,2>{0.561273932f, 0.0608539246f},
-std::array<float,2>{0.390566438f, 0.280205011f},
-std::array<float,2>{0.641562283f, 0.758305311f},
-std::array<float,2>{0.218774438f, 0.620142162f},
-std::array<float,2>{0.763160169f, 0.11423897f},
-std::array<float,2>{0.0917390436f, 0.131950065f},
-std::array<float,2>{0.974788427f, 0.661625803f},
-std::array<float,2>{0.30842647f, 0.892045379f},
-std::array<float,2>{0.580041409f, 0.485899657f},
-std::array<float,2>{0.358194947f, 0.0270707328f},
-std::array<float,2>{0.523147047f, 0.513660192f},
-std::array<float,2>{0.0307327062f, 0.84956938f},
-std::array<float,2>{0.908903718f, 0.373201966f},
-std::array<float,2>{0.14232333f, 0.423122436f},
-std::array<float,2>{0.843652487f, 0.940150857f},
-std::array<float,2>{0.481668711f, 0.729339063f},
-std::array<float,2>{0.713862181f, 0.205888405f},
-std::array<float,2>{0.33771053f, 0.346407324f},
-std::array<float,2>{0.532190382f, 0.864382446f},
-std::array<float,2>{0.0403646342f, 0.529351592f},
-std::array<float,2>{0.875816405f, 0.00306906574f},
-std::array<float,2>{0.170067027f, 0.192568839f},
-std::array<float,2>{0.864025056f, 0.743978798f},
-std::array<float,2>{0.455093056f, 0.962745488f},
-std::array<float,2>{0.741307914f, 0.421335101f},
-std::array<float,2>{0.409588099f, 0.109353296f},
-std::array<float,2>{0.658716917f, 0.607013404f},
-std::array<float,2>{0.206056461f, 0.773402095f},
-std::array<float,2>{0.809041142f, 0.262753993f},
-std::array<float,2>{0.106205232f, 0.476813108f},
-std::array<float,2>{0.955639958f, 0.877921045f},
-std::array<float,2>{0.26676479f, 0.679503679f},
-std::array<float,2>{0.606055796f, 0.15421392f},
-std::array<float,2>{0.497862488f, 0.375135928f},
-std::array<float,2>{0.692611635f, 0.97821188f},
-std::array<float,2>{0.134384468f, 0.711147189f},
-std::array<float,2>{0.82797873f, 0.240554437f},
-std::array<float,2>{0.0137557583f, 0.0363581777f},
-std::array<float,2>{0.935321987f, 0.537836909f},
-std::array<float,2>{0.370346755f, 0.820360065f},
-std::array<float,2>{0.511908829f, 0.336828977f},
-std::array<float,2>{0.287640989f, 0.177967057f},
-std::array<float,2>{0.56793952f, 0.644076526f},
-std::array<float,2>{0.0642313808f, 0.929911196f},
-std::array<float,2>{0.991284072f, 0.446207434f},
-std::array<float,2>{0.246608391f, 0.298796207f},
-std::array<float,2>{0.778638721f, 0.798330843f},
-std::array<float,2>{0.404562682f, 0.591655612f},
-std::array<float,2>{0.632749796f, 0.0637029633f},
-std::array<float,2>{0.374102533f, 0.49510169f},
-std::array<float,2>{0.509288609f, 0.905503154f},
-std::array<float,2>{0.00811505038f, 0.669832349f},
-std::array<float,2>{0.930796802f, 0.134156898f},
-std::array<float,2>{0.139873028f, 0.124671221f},
-std::array<float,2>{0.823500693f, 0.611785531f},
-std::array<float,2>{0.493535131f, 0.754579604f},
-std::array<float,2>{0.691315234f, 0.265894443f},
-std::array<float,2>{0.399705231f, 0.215728641f},
-std::array<float,2>{0.627744317f, 0.726199865f},
-std::array<float,2>{0.242716223f, 0.952436984f},
-std::array<float,2>{0.776050925f, 0.436632216f},
-std::array<float,2>{0.0686746836f, 0.362070739f},
-std::array<float,2>{0.985495865f, 0.8524369f},
-std::array<float,2>{0.283216983f, 0.505248249f},
-std::array<float,2>{0.564701378f, 0.0169160347f},
-std::array<float,2>{0.459914356f, 0.283396959f},
-std::array<float,2>{0.736803949f, 0.796508372f},
-std::array<float,2>{0.167323947f, 0.569880843f},
-std::array<float,2>{0.861820877f, 0.0855522007f},
-std::array<float,2>{0.0447524711f, 0.15631023f},
-std::array<float,2>{0.882665098f, 0.635898709f},
-std::array<float,2>{0.34314543f, 0.914034784f},
-std::array<float,2>{0.537708044f, 0.459367037f},
-std::array<float,2>{0.272401989f, 0.052775573f},
-std::array<float,2>{0.603847682f, 0.561111152f},
-std::array<float,2>{0.104634024f, 0.835983813f},
-std::array<float,2>{0.96004349f, 0.317217529f},
-std::array<float,2>{0.210080266f, 0.402963489f},
-std::array<float,2>{0.808339119f, 0.991173685f},
-std::array<float,2>{0.411358088f, 0.696506739f},
-std::array<float,2>{0.660771608f, 0.234200791f},
-std::array<float,2>{0.312308431f, 0.33151871f},
-std::array<float,2>{0.585020661f, 0.817031145f},
-std::array<float,2>{0.0882779658f, 0.544237256f},
-std::array<float,2>{0.971547186f, 0.0452753603f},
-std::array<float,2>{0.224408478f, 0.24324052f},
-std::array<float,2>{0.758274794f, 0.705227911f},
-std::array<float,2>{0.385664195f, 0.969707429f},
-std::array<float,2>{0.646467805f, 0.385893106f},
-std::array<float,2>{0.477954328f, 0.0761888176f},
-std::array<float,2>{0.71572572f, 0.578579962f},
-std::array<float,2>{0.148125693f, 0.807045162f},
-std::array<float,2>{0.836455822f, 0.309020966f},
-std::array<float,2>{0.0239230804f, 0.44082123f},
-std::array<float,2>{0.911987424f, 0.929492414f},
-std::array<float,2>{0.354061902f, 0.652687192f},
-std::array<float,2>{0.518455863f, 0.185081005f},
-std::array<float,2>{0.431007534f, 0.407957554f},
-std::array<float,2>{0.681127608f, 0.954598188f},
-std::array<float,2>{0.187854469f, 0.738693118f},
-std::array<float,2>{0.794270933f, 0.19589664f},
-std::array<float,2>{0.121855244f, 0.0152917448f},
-std::array<float,2>{0.951075554f, 0.515892386f},
-std::array<float,2>{0.256748229f, 0.873102248f},
-std::array<float,2>{0.613246143f, 0.354619145f},
-std::array<float,2>{0.31313324f, 0.141889736f},
-std::array<float,2>{0.555002809f, 0.684059024f},
-std::array<float,2>{0.0586655475f, 0.885368764f},
-std::array<float,2>{0.892931223f, 0.474458545f},
-std::array<float,2>{0.176060304f, 0.252321392f},
-std::array<float,2>{0.852028787f, 0.776651204f},
-std::array<float,2>{0.449865103f, 0.601311088f},
-std::array<float,2>{0.720836163f, 0.0993833244f},
-std::array<float,2>{0.259956062f, 0.380068541f},
-std::array<float,2>{0.61849004f, 0.981612384f},
-std::array<float,2>{0.115536518f, 0.717693746f},
-std::array<float,2>{0.938538015f, 0.235685721f},
-std::array<float,2>{0.196350932f, 0.0351048857f},
-std::array<float,2>{0.787733018f, 0.534664154f},
-std::array<float,2>{0.428696454f, 0.826359749f},
-std::array<float,2>{0.676853299f, 0.34175694f},
-std::array<float,2>{0.440440804f, 0.174219951f},
-std::array<float,2>{0.733852863f, 0.646222711f},
-std::array<float,2>{0.184407815f, 0.93666482f},
-std::array<float,2>{0.84409219f, 0.450177312f},
-std::array<float,2>{0.052861128f, 0.303228557f},
-std::array<float,2>{0.901943564f, 0.800899148f},
-std::array<float,2>{0.323699921f, 0.587697387f},
-std::array<float,2>{0.549884796f, 0.0670265108f},
-std::array<float,2>{0.376125336f, 0.349171579f},
-std::array<float,2>{0.649688303f, 0.861167371f},
-std::array<float,2>{0.227681354f, 0.525161207f},
-std::array<float,2>{0.756293237f, 0.00529766548f},
-std::array<float,2>{0.0797935128f, 0.189465046f},
-std::array<float,2>{0.977984369f, 0.749897659f},
-std::array<float,2>{0.302466869f, 0.967373013f},
-std::array<float,2>{0.586188495f, 0.416085809f},
-std::array<float,2>{0.347432256f, 0.102111347f},
-std::array<float,2>{0.524803102f, 0.602231741f},
-std::array<float,2>{0.0180810709f, 0.766073108f},
-std::array<float,2>{0.920340717f, 0.258919209f},
-std::array<float,2>{0.150397688f, 0.483629227f},
-std::array<float,2>{0.832768679f, 0.879954636f},
-std::array<float,2>{0.469137967f, 0.67257005f},
-std::array<float,2>{0.709676623f, 0.150840625f},
-std::array<float,2>{0.330504835f, 0.277148426f},
-std::array<float,2>{0.539190531f, 0.764296412f},
-std::array<float,2>{0.0385998972f, 0.62250942f},
-std::array<float,2>{0.887073576f, 0.110747546f},
-std::array<float,2>{0.157479048f, 0.12526454f},
-std::array<float,2>{0.868846297f, 0.656962931f},
-std::array<float,2>{0.464637458f, 0.894560993f},
-std::array<float,2>{0.747380316f, 0.490823567f},
-std::array<float,2>{0.416442305f, 0.0282015745f},
-std::array<float,2>{0.664681733f, 0.51039201f},
-std::array<float,2>{0.213724732f, 0.846154392f},
-std::array<float,2>{0.796889126f, 0.367512017f},
-std::array<float,2>{0.0998887196f, 0.427857131f},
-std::array<float,2>{0.968057632f, 0.943830609f},
-std::array<float,2>{0.276605546f, 0.73339504f},
-std::array<float,2>{0.597922802f, 0.210532159f},
-std::array<float,2>{0.488201588f, 0.464810282f},
-std::array<float,2>{0.699452341f, 0.921713948f},
-std::array<float,2>{0.127529353f, 0.625088453f},
-std::array<float,2>{0.818407059f, 0.171701878f},
-std::array<float,2>{0.00598962838f, 0.0918061957f},
-std::array<float,2>{0.923068821f, 0.57707727f},
-std::array<float,2>{0.365895897f, 0.783508837f},
-std::array<float,2>{0.502619922f, 0.291277528f},
-std::array<float,2>{0.291643739f, 0.218983993f},
-std::array<float,2>{0.575526714f, 0.692543924f},
-std::array<float,2>{0.0751092359f, 0.996091247f},
-std::array<float,2>{0.998336017f, 0.395295441f},
-std::array<float,2>{0.236036226f, 0.324449986f},
-std::array<float,2>{0.770961702f, 0.834832847f},
-std::array<float,2>{0.394998014f, 0.547058284f},
-std::array<float,2>{0.638948321f, 0.0548727959f},
-std::array<float,2>{0.327346414f, 0.430407703f},
-std::array<float,2>{0.55398953f, 0.947382033f},
-std::array<float,2>{0.046885062f, 0.718753159f},
-std::array<float,2>{0.905634284f, 0.211140767f},
-std::array<float,2>{0.18300648f, 0.0230823234f},
-std::array<float,2>{0.849203706f, 0.50018239f},
-std::array<float,2>{0.444741338f, 0.856788754f},
-std::array<float,2>{0.727534533f, 0.365983546f},
-std::array<float,2>{0.423563838f, 0.137389883f},
-std::array<float,2>{0.672701836f, 0.667884231f},
-std::array<float,2>{0.201164126f, 0.898441672f},
-std::array<float,2>{0.784680426f, 0.496212035f},
-std::array<float,2>{0.111501977f, 0.273254544f},
-std::array<float,2>{0.942909837f, 0.750228167f},
-std::array<float,2>{0.264264852f, 0.613473177f},
-std::array<float,2>{0.622162342f, 0.120369844f},
-std::array<float,2>{0.476209164f, 0.312666386f},
-std::array<float,2>{0.705770314f, 0.840479195f},
-std::array<float,2>{0.152639523f, 0.556242585f},
-std::array<float,2>{0.829363763f, 0.0506022684f},
-std::array<float,2>{0.0231279973f, 0.22686775f},
-std::array<float,2>{0.914456069f, 0.702014744f},
-std::array<float,2>{0.349073738f, 0.984518886f},
-std::array<float,2>{0.529995859f, 0.399554282f},
-std::array<float,2>{0.300000876f, 0.0791207924f},
-std::array<float,2>{0.591757476f, 0.564045846f},
-std::array<float,2>{0.0851439089f, 0.789433002f},
-std::array<float,2>{0.981560767f, 0.287362784f},
-std::array<float,2>{0.231717512f, 0.456747353f},
-std::array<float,2>{0.752126873f, 0.906294644f},
-std::array<float,2>{0.381834388f, 0.638650239f},
-std::array<float,2>{0.65473783f, 0.163866341f},
-std::array<float,2>{0.279763758f, 0.30578357f},
-std::array<float,2>{0.59588939f, 0.809103429f},
-std::array<float,2>{0.0944336578f, 0.583579421f},
-std::array<float,2>{0.963579893f, 0.0705376118f},
-std::array<float,2>{0.21808444f, 0.182381958f},
-std::array<float,2>{0.80388701f, 0.65183121f},
-std::array<float,2>{0.42019853f, 0.923388124f},
-std::array<float,2>{0.670190692f, 0.442610502f},
-std::array<float,2>{0.465142459f, 0.0404732078f},
-std::array<float,2>{0.745425642f, 0.539847732f},
-std::array<float,2>{0.163804084f, 0.812966287f},
-std::array<float,2>{0.874726117f, 0.333416641f},
-std::array<float,2>{0.0350231044f, 0.388203025f},
-std::array<float,2>{0.883843899f, 0.975911856f},
-std::array<float,2>{0.333195239f, 0.710582256f},
-std::array<float,2>{0.544200003f, 0.246519893f},
-std::array<float,2>{0.394314498f, 0.471373439f},
-std::array<float,2>{0.632857561f, 0.889217436f},
-std::array<float,2>{0.240887135f, 0.680758595f},
-std::array<float,2>{0.766952991f, 0.146278545f},
-std::array<float,2>{0.0730512366f, 0.0972135663f},
-std::array<float,2>{0.992223084f, 0.593880713f},
-std::array<float,2>{0.295702219f, 0.78059119f},
-std::array<float,2>{0.573273718f, 0.256720036f},
-std::array<float,2>{0.361191362f, 0.202396199f},
-std::array<float,2>{0.505157351f, 0.7352373f},
-std::array<float,2>{0.000496246095f, 0.958294392f},
-std::array<float,2>{0.926023662f, 0.412192971f},
-std::array<float,2>{0.132381961f, 0.358442247f},
-std::array<float,2>{0.812757075f, 0.869836271f},
-std::array<float,2>{0.491419524f, 0.519680619f},
-std::array<float,2>{0.698045194f, 0.00907934643f},
-std::array<float,2>{0.286159754f, 0.446737766f},
-std::array<float,2>{0.569115698f, 0.931622267f},
-std::array<float,2>{0.0650411099f, 0.64326942f},
-std::array<float,2>{0.990042865f, 0.178970233f},
-std::array<float,2>{0.249621764f, 0.0626569316f},
-std::array<float,2>{0.780972302f, 0.590376318f},
-std::array<float,2>{0.402765721f, 0.797250688f},
-std::array<float,2>{0.629686475f, 0.297608912f},
-std::array<float,2>{0.4986839f, 0.241542131f},
-std::array<float,2>{0.694048405f, 0.712056875f},
-std::array<float,2>{0.135887444f, 0.976739228f},
-std::array<float,2>{0.825352848f, 0.376478523f},
-std::array<float,2>{0.0134542817f, 0.337793529f},
-std::array<float,2>{0.936305583f, 0.821592212f},
-std::array<float,2>{0.368019164f, 0.539018214f},
-std::array<float,2>{0.514736414f, 0.0354295f},
-std::array<float,2>{0.406685978f, 0.262315452f},
-std::array<float,2>{0.65791589f, 0.771839023f},
-std::array<float,2>{0.204507932f, 0.605909705f},
-std::array<float,2>{0.810570359f, 0.107712068f},
-std::array<float,2>{0.108098701f, 0.153293103f},
-std::array<float,2>{0.953989685f, 0.678171635f},
-std::array<float,2>{0.267727226f, 0.878306329f},
-std::array<float,2>{0.608369589f, 0.478295773f},
-std::array<float,2>{0.337918878f, 0.00282022892f},
-std::array<float,2>{0.534311831f, 0.530745566f},
-std::array<float,2>{0.0423201472f, 0.863519847f},
-std::array<float,2>{0.878368139f, 0.347141057f},
-std::array<float,2>{0.169662714f, 0.42017895f},
-std::array<float,2>{0.866076887f, 0.961036265f},
-std::array<float,2>{0.4548271f, 0.742697716f},
-std::array<float,2>{0.738600135f, 0.191520929f},
-std::array<float,2>{0.35707736f, 0.37487638f},
-std::array<float,2>{0.521366298f, 0.848501086f},
-std::array<float,2>{0.0275441892f, 0.512591362f},
-std::array<float,2>{0.908023059f, 0.0262713898f},
-std::array<float,2>{0.143354371f, 0.206786886f},
-std::array<float,2>{0.840769053f, 0.730060637f},
-std::array<float,2>{0.483200669f, 0.940754414f},
-std::array<float,2>{0.711162925f, 0.422664374f},
-std::array<float,2>{0.387913495f, 0.11447908f},
-std::array<float,2>{0.643722296f, 0.6192891f},
-std::array<float,2>{0.222643465f, 0.759193718f},
-std::array<float,2>{0.763731062f, 0.280605555f},
-std::array<float,2>{0.0937479585f, 0.485039264f},
-std::array<float,2>{0.973602057f, 0.890749097f},
-std::array<float,2>{0.30486545f, 0.660417736f},
-std::array<float,2>{0.581431687f, 0.131520972f},
-std::array<float,2>{0.448749483f, 0.39381814f},
-std::array<float,2>{0.723289013f, 0.99964118f},
-std::array<float,2>{0.173995718f, 0.691121399f},
-std::array<float,2>{0.858556807f, 0.224547863f},
-std::array<float,2>{0.0578792281f, 0.0619395338f},
-std::array<float,2>{0.895576656f, 0.552902579f},
-std::array<float,2>{0.317251414f, 0.828951657f},
-std::array<float,2>{0.560106397f, 0.320636958f},
-std::array<float,2>{0.250839621f, 0.165540904f},
-std::array<float,2>{0.614839196f, 0.630440176f},
-std::array<float,2>{0.121049419f, 0.916792631f},
-std::array<float,2>{0.948518097f, 0.468115091f},
-std::array<float,2>{0.192161918f, 0.293916374f},
-std::array<float,2>{0.789748847f, 0.788440228f},
-std::array<float,2>{0.434135735f, 0.570919573f},
-std::array<float,2>{0.686450005f, 0.0881550759f},
-std::array<float,2>{0.341555387f, 0.458257854f},
-std::array<float,2>{0.535372317f, 0.911531806f},
-std::array<float,2>{0.04656763f, 0.634399414f},
-std::array<float,2>{0.879477203f, 0.159757152f},
-std::array<float,2>{0.164156228f, 0.0826165825f},
-std::array<float,2>{0.859662235f, 0.56798631f},
-std::array<float,2>{0.458333403f, 0.794518232f},
-std::array<float,2>{0.734639943f, 0.28201437f},
-std::array<float,2>{0.413770884f, 0.232299834f},
-std::array<float,2>{0.663609624f, 0.698458195f},
-std::array<float,2>{0.207325652f, 0.988491237f},
-std::array<float,2>{0.804864645f, 0.405765027f},
-std::array<float,2>{0.103494391f, 0.319598675f},
-std::array<float,2>{0.957747877f, 0.838283598f},
-std::array<float,2>{0.271348327f, 0.558634758f},
-std::array<float,2>{0.602627397f, 0.0510125756f},
-std::array<float,2>{0.495533228f, 0.26803118f},
-std::array<float,2>{0.68905139f, 0.757016778f},
-std::array<float,2>{0.138015568f, 0.609792471f},
-std::array<float,2>{0.821753085f, 0.121955775f},
-std::array<float,2>{0.0107450178f, 0.135298833f},
-std::array<float,2>{0.931760728f, 0.670818925f},
-std::array<float,2>{0.37296766f, 0.903471351f},
-std::array<float,2>{0.51165086f, 0.493303955f},
-std::array<float,2>{0.281514138f, 0.0177437067f},
-std::array<float,2>{0.562888682f, 0.506773829f},
-std::array<float,2>{0.0680179f, 0.85412848f},
-std::array<float,2>{0.988229275f, 0.359696716f},
-std::array<float,2>{0.245851636f, 0.434885144f},
-std::array<float,2>{0.774129331f, 0.949742615f},
-std::array<float,2>{0.400402278f, 0.724053741f},
-std::array<float,2>{0.625143468f, 0.217689157f},
-std::array<float,2>{0.255776703f, 0.352867544f},
-std::array<float,2>{0.610325933f, 0.872874022f},
-std::array<float,2>{0.124967918f, 0.518976092f},
-std::array<float,2>{0.952160776f, 0.0134055829f},
-std::array<float,2>{0.189503074f, 0.197893992f},
-std::array<float,2>{0.795522809f, 0.742111325f},
-std::array<float,2>{0.431725681f, 0.955264568f},
-std::array<float,2>{0.68253243f, 0.409271657f},
-std::array<float,2>{0.452244818f, 0.10052909f},
-std::array<float,2>{0.720321298f, 0.597896636f},
-std::array<float,2>{0.178770289f, 0.774416208f},
-std::array<float,2>{0.85427326f, 0.250673592f},
-std::array<float,2>{0.0613979846f, 0.475510627f},
-std::array<float,2>{0.8908391f, 0.884294033f},
-std::array<float,2>{0.315171003f, 0.686542928f},
-std::array<float,2>{0.558056891f, 0.143966168f},
-std::array<float,2>{0.383434266f, 0.384222329f},
-std::array<float,2>{0.647192836f, 0.971009791f},
-std::array<float,2>{0.226389319f, 0.705002666f},
-std::array<float,2>{0.76023221f, 0.245795771f},
-std::array<float,2>{0.0862401426f, 0.0436845832f},
-std::array<float,2>{0.970084608f, 0.546506584f},
-std::array<float,2>{0.309582502f, 0.82028985f},
-std::array<float,2>{0.583501279f, 0.328258902f},
-std::array<float,2>{0.352982193f, 0.186223403f},
-std::array<float,2>{0.516799212f, 0.655333579f},
-std::array<float,2>{0.0269859117f, 0.926197469f},
-std::array<float,2>{0.912760496f, 0.438680828f},
-std::array<float,2>{0.145053178f, 0.311493009f},
-std::array<float,2>{0.839746177f, 0.804852009f},
-std::array<float,2>{0.478773892f, 0.580099463f},
-std::array<float,2>{0.717678607f, 0.0748747736f},
-std::array<float,2>{0.302905798f, 0.415358901f},
-std::array<float,2>{0.588930011f, 0.965123355f},
-std::array<float,2>{0.0805962607f, 0.747667968f},
-std::array<float,2>{0.978918195f, 0.189261466f},
-std::array<float,2>{0.229369402f, 0.00677521387f},
-std::array<float,2>{0.75391686f, 0.526457906f},
-std::array<float,2>{0.378010243f, 0.861523747f},
-std::array<float,2>{0.651112676f, 0.350045621f},
-std::array<float,2>{0.47208488f, 0.149356231f},
-std::array<float,2>{0.707889616f, 0.673904538f},
-std::array<float,2>{0.148575962f, 0.881853044f},
-std::array<float,2>{0.835913301f, 0.480937451f},
-std::array<float,2>{0.0159067381f, 0.259820104f},
-std::array<float,2>{0.919110358f, 0.768208623f},
-std::array<float,2>{0.343881398f, 0.604676068f},
-std::array<float,2>{0.525524557f, 0.105170555f},
-std::array<float,2>{0.426528007f, 0.343374401f},
-std::array<float,2>{0.679070175f, 0.824610531f},
-std::array<float,2>{0.198772222f, 0.532467604f},
-std::array<float,2>{0.786721945f, 0.0330300108f},
-std::array<float,2>{0.113479525f, 0.237953305f},
-std::array<float,2>{0.940420389f, 0.716234207f},
-std::array<float,2>{0.259239733f, 0.983989716f},
-std::array<float,2>{0.621074378f, 0.381675988f},
-std::array<float,2>{0.321009219f, 0.0684389398f},
-std::array<float,2>{0.548228383f, 0.58946234f},
-std::array<float,2>{0.0509923249f, 0.804634273f},
-std::array<float,2>{0.899466217f, 0.301287502f},
-std::array<float,2>{0.186103061f, 0.451648504f},
-std::array<float,2>{0.847581089f, 0.934975088f},
-std::array<float,2>{0.439357877f, 0.647606194f},
-std::array<float,2>{0.732011378f, 0.171886951f},
-std::array<float,2>{0.364137501f, 0.290701151f},
-std::array<float,2>{0.500824749f, 0.782725573f},
-std::array<float,2>{0.00465762848f, 0.575023353f},
-std::array<float,2>{0.924726129f, 0.091029942f},
-std::array<float,2>{0.126526102f, 0.169193104f},
-std::array<float,2>{0.816583395f, 0.62795186f},
-std::array<float,2>{0.484647125f, 0.919638216f},
-std::array<float,2>{0.70306319f, 0.462183863f},
-std::array<float,2>{0.397123158f, 0.0569331273f},
-std::array<float,2>{0.637361288f, 0.550579667f},
-std::array<float,2>{0.236889347f, 0.832772017f},
-std::array<float,2>{0.772562921f, 0.328047514f},
-std::array<float,2>{0.0769951791f, 0.397561759f},
-std::array<float,2>{0.996558666f, 0.993734419f},
-std::array<float,2>{0.29082042f, 0.693831265f},
-std::array<float,2>{0.578058124f, 0.22119607f},
-std::array<float,2>{0.461157322f, 0.488662213f},
-std::array<float,2>{0.749451876f, 0.898237109f},
-std::array<float,2>{0.160127684f, 0.658673644f},
-std::array<float,2>{0.86962831f, 0.127744451f},
-std::array<float,2>{0.0357913636f, 0.112629697f},
-std::array<float,2>{0.889383018f, 0.624250412f},
-std::array<float,2>{0.329779267f, 0.76240164f},
-std::array<float,2>{0.542587817f, 0.274833292f},
-std::array<float,2>{0.27404952f, 0.207247227f},
-std::array<float,2>{0.601372361f, 0.73185569f},
-std::array<float,2>{0.0986988917f, 0.941694558f},
-std::array<float,2>{0.965838432f, 0.426419079f},
-std::array<float,2>{0.212312356f, 0.370472521f},
-std::array<float,2>{0.799232543f, 0.843908846f},
-std::array<float,2>{0.415167898f, 0.508326054f},
-std::array<float,2>{0.667463958f, 0.0296020452f},
-std::array<float,2>{0.35063383f, 0.400784791f},
-std::array<float,2>{0.528622448f, 0.986993253f},
-std::array<float,2>{0.0202115048f, 0.699266553f},
-std::array<float,2>{0.917046249f, 0.22967501f},
-std::array<float,2>{0.154394522f, 0.0486389175f},
-std::array<float,2>{0.83011502f, 0.558584332f},
-std::array<float,2>{0.474077761f, 0.842447698f},
-std::array<float,2>{0.703932106f, 0.315508842f},
-std::array<float,2>{0.380725592f, 0.160292387f},
-std::array<float,2>{0.653698325f, 0.638959587f},
-std::array<float,2>{0.233898729f, 0.909078419f},
-std::array<float,2>{0.751275897f, 0.453857452f},
-std::array<float,2>{0.0826396942f, 0.285945475f},
-std::array<float,2>{0.983370066f, 0.792839468f},
-std::array<float,2>{0.298553377f, 0.564502835f},
-std::array<float,2>{0.593745172f, 0.0814751312f},
-std::array<float,2>{0.442452163f, 0.36331287f},
-std::array<float,2>{0.729142249f, 0.858586907f},
-std::array<float,2>{0.180601716f, 0.502256513f},
-std::array<float,2>{0.851025164f, 0.0196254458f},
-std::array<float,2>{0.0506291054f, 0.213457853f},
-std::array<float,2>{0.90266639f, 0.721014023f},
-std::array<float,2>{0.325194955f, 0.947049201f},
-std::array<float,2>{0.551279187f, 0.432308733f},
-std::array<float,2>{0.26273939f, 0.119127244f},
-std::array<float,2>{0.623585701f, 0.616906047f},
-std::array<float,2>{0.110598013f, 0.752019227f},
-std::array<float,2>{0.945105791f, 0.271448284f},
-std::array<float,2>{0.202008486f, 0.499280632f},
-std::array<float,2>{0.781779766f, 0.902043581f},
-std::array<float,2>{0.424060881f, 0.664696634f},
-std::array<float,2>{0.675156593f, 0.139275372f},
-std::array<float,2>{0.294086814f, 0.25411132f},
-std::array<float,2>{0.5714432f, 0.777518511f},
-std::array<float,2>{0.0706770718f, 0.596824467f},
-std::array<float,2>{0.994795322f, 0.0949567109f},
-std::array<float,2>{0.238327086f, 0.148100719f},
-std::array<float,2>{0.768942237f, 0.682586789f},
-std::array<float,2>{0.390968561f, 0.887919009f},
-std::array<float,2>{0.635123014f, 0.46914947f},
-std::array<float,2>{0.489096314f, 0.0103912195f},
-std::array<float,2>{0.695867002f, 0.522005737f},
-std::array<float,2>{0.130293354f, 0.86872977f},
-std::array<float,2>{0.814477265f, 0.356837571f},
-std::array<float,2>{0.00222176476f, 0.411642551f},
-std::array<float,2>{0.929393888f, 0.960528553f},
-std::array<float,2>{0.362474144f, 0.736598074f},
-std::array<float,2>{0.506680369f, 0.200308666f},
-std::array<float,2>{0.418809295f, 0.445053518f},
-std::array<float,2>{0.668266058f, 0.924188316f},
-std::array<float,2>{0.215364024f, 0.649418116f},
-std::array<float,2>{0.802022278f, 0.180653572f},
-std::array<float,2>{0.0959700271f, 0.0730587989f},
-std::array<float,2>{0.961663127f, 0.585544407f},
-std::array<float,2>{0.277558029f, 0.810590625f},
-std::array<float,2>{0.594305158f, 0.308145434f},
-std::array<float,2>{0.334759504f, 0.248339891f},
-std::array<float,2>{0.545864046f, 0.707751691f},
-std::array<float,2>{0.0312858783f, 0.973260224f},
-std::array<float,2>{0.885495901f, 0.390464425f},
-std::array<float,2>{0.161060408f, 0.334781706f},
-std::array<float,2>{0.872752011f, 0.815023065f},
-std::array<float,2>{0.467636138f, 0.541074455f},
-std::array<float,2>{0.744124949f, 0.0417944789f},
-std::array<float,2>{0.265965343f, 0.479442954f},
-std::array<float,2>{0.60705477f, 0.876085997f},
-std::array<float,2>{0.106539458f, 0.67666018f},
-std::array<float,2>{0.956889689f, 0.155144706f},
-std::array<float,2>{0.205268696f, 0.106771059f},
-std::array<float,2>{0.810137093f, 0.608654559f},
-std::array<float,2>{0.40870297f, 0.771375775f},
-std::array<float,2>{0.659654319f, 0.264122903f},
-std::array<float,2>{0.456317544f, 0.193565384f},
-std::array<float,2>{0.740497768f, 0.745586157f},
-std::array<float,2>{0.171341211f, 0.963531435f},
-std::array<float,2>{0.865075052f, 0.419216871f},
-std::array<float,2>{0.0394681878f, 0.345017642f},
-std::array<float,2>{0.876725137f, 0.865626395f},
-std::array<float,2>{0.336451411f, 0.528669357f},
-std::array<float,2>{0.533049285f, 0.000139571101f},
-std::array<float,2>{0.405733913f, 0.299787343f},
-std::array<float,2>{0.631282508f, 0.798928797f},
-std::array<float,2>{0.247674882f, 0.592167854f},
-std::array<float,2>{0.7776829f, 0.0652546287f},
-std::array<float,2>{0.0633668527f, 0.176268011f},
-std::array<float,2>{0.99032253f, 0.642147183f},
-std::array<float,2>{0.288219094f, 0.933340609f},
-std::array<float,2>{0.567302227f, 0.449123532f},
-std::array<float,2>{0.369945556f, 0.038217552f},
-std::array<float,2>{0.513276279f, 0.536226451f},
-std::array<float,2>{0.0150866527f, 0.823867142f},
-std::array<float,2>{0.93359375f, 0.338023365f},
-std::array<float,2>{0.133731812f, 0.378518134f},
-std::array<float,2>{0.827049911f, 0.978701353f},
-std::array<float,2>{0.496716827f, 0.714819729f},
-std::array<float,2>{0.692116678f, 0.23932083f},
-std::array<float,2>{0.320115298f, 0.323199302f},
-std::array<float,2>{0.562041223f, 0.830132663f},
-std::array<float,2>{0.0563217402f, 0.551436722f},
-std::array<float,2>{0.897012174f, 0.0589088239f},
-std::array<float,2>{0.173477381f, 0.226426542f},
-std::array<float,2>{0.855511785f, 0.688162565f},
-std::array<float,2>{0.445962608f, 0.996876121f},
-std::array<float,2>{0.725367308f, 0.392282188f},
-std::array<float,2>{0.4373523f, 0.0872889906f},
-std::array<float,2>{0.683693707f, 0.572365284f},
-std::array<float,2>{0.193820357f, 0.786736906f},
-std::array<float,2>{0.792832792f, 0.295670807f},
-std::array<float,2>{0.117351793f, 0.466372341f},
-std::array<float,2>{0.946949959f, 0.914567769f},
-std::array<float,2>{0.253353864f, 0.631037772f},
-std::array<float,2>{0.615778625f, 0.166953653f},
-std::array<float,2>{0.481364042f, 0.423849523f},
-std::array<float,2>{0.714104533f, 0.93856746f},
-std::array<float,2>{0.140764102f, 0.726850688f},
-std::array<float,2>{0.842617631f, 0.204513505f},
-std::array<float,2>{0.0301377866f, 0.0251450203f},
-std::array<float,2>{0.909829617f, 0.51468271f},
-std::array<float,2>{0.359338135f, 0.850213587f},
-std::array<float,2>{0.52222687f, 0.371741652f},
-std::array<float,2>{0.307165742f, 0.129025757f},
-std::array<float,2>{0.579057157f, 0.663579524f},
-std::array<float,2>{0.0898801535f, 0.8927055f},
-std::array<float,2>{0.975995779f, 0.487137347f},
-std::array<float,2>{0.22013782f, 0.278802633f},
-std::array<float,2>{0.762423933f, 0.760708809f},
-std::array<float,2>{0.38926214f, 0.618439436f},
-std::array<float,2>{0.64256835f, 0.115587674f}}
\ No newline at end of file
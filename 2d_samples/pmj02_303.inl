@@ -1,4096 +0,0 @@
-{std::array<float,2>{0.741210341f, 0.412484646f},
-std::array<float,2>{0.274310976f, 0.951634943f},
-std::array<float,2>{0.867610633f, 0.638563454f},
-std::array<float,2>{0.0769848377f, 0.208355203f},
-std::array<float,2>{0.905685842f, 0.0616715923f},
-std::array<float,2>{0.218450338f, 0.51423794f},
-std::array<float,2>{0.583007872f, 0.842342913f},
-std::array<float,2>{0.418215245f, 0.328240633f},
-std::array<float,2>{0.773275614f, 0.30489409f},
-std::array<float,2>{0.0512496457f, 0.750157177f},
-std::array<float,2>{0.647211432f, 0.589494348f},
-std::array<float,2>{0.325781375f, 0.0901202261f},
-std::array<float,2>{0.530095279f, 0.171426788f},
-std::array<float,2>{0.454855293f, 0.745350182f},
-std::array<float,2>{0.974533916f, 0.926898122f},
-std::array<float,2>{0.125760436f, 0.48955369f},
-std::array<float,2>{0.624453247f, 0.349806994f},
-std::array<float,2>{0.386767715f, 0.863578498f},
-std::array<float,2>{0.916736007f, 0.556541383f},
-std::array<float,2>{0.232756555f, 0.0167061314f},
-std::array<float,2>{0.834056497f, 0.247470349f},
-std::array<float,2>{0.118558481f, 0.675404966f},
-std::array<float,2>{0.703911126f, 0.970474601f},
-std::array<float,2>{0.283076227f, 0.378855169f},
-std::array<float,2>{0.946047306f, 0.449384838f},
-std::array<float,2>{0.162895098f, 0.894317031f},
-std::array<float,2>{0.549897969f, 0.709695578f},
-std::array<float,2>{0.49824068f, 0.154070571f},
-std::array<float,2>{0.661608279f, 0.100851081f},
-std::array<float,2>{0.347549468f, 0.620561242f},
-std::array<float,2>{0.783532858f, 0.812231421f},
-std::array<float,2>{0.020271033f, 0.251165897f},
-std::array<float,2>{0.544249535f, 0.473508f},
-std::array<float,2>{0.480245411f, 0.913560033f},
-std::array<float,2>{0.958265603f, 0.72835362f},
-std::array<float,2>{0.17662859f, 0.178823486f},
-std::array<float,2>{0.798428714f, 0.0658119097f},
-std::array<float,2>{0.00116801716f, 0.569205344f},
-std::array<float,2>{0.672797263f, 0.779946983f},
-std::array<float,2>{0.363593847f, 0.289294362f},
-std::array<float,2>{0.93726337f, 0.315230995f},
-std::array<float,2>{0.24735789f, 0.823179424f},
-std::array<float,2>{0.604484856f, 0.523100495f},
-std::array<float,2>{0.405010998f, 0.0366950966f},
-std::array<float,2>{0.702604771f, 0.203028098f},
-std::array<float,2>{0.300860286f, 0.642325759f},
-std::array<float,2>{0.815628886f, 0.95646596f},
-std::array<float,2>{0.103731833f, 0.430984557f},
-std::array<float,2>{0.630650163f, 0.276581854f},
-std::array<float,2>{0.341069609f, 0.792094707f},
-std::array<float,2>{0.764755726f, 0.602142036f},
-std::array<float,2>{0.0402264819f, 0.118136175f},
-std::array<float,2>{0.99149704f, 0.139700428f},
-std::array<float,2>{0.15217106f, 0.689234674f},
-std::array<float,2>{0.510776877f, 0.877518237f},
-std::array<float,2>{0.44053629f, 0.459382176f},
-std::array<float,2>{0.846475303f, 0.401825309f},
-std::array<float,2>{0.0854890272f, 0.986729026f},
-std::array<float,2>{0.733464599f, 0.664946914f},
-std::array<float,2>{0.256071061f, 0.222514212f},
-std::array<float,2>{0.566542625f, 0.00122446532f},
-std::array<float,2>{0.424450696f, 0.534557879f},
-std::array<float,2>{0.88969177f, 0.855413437f},
-std::array<float,2>{0.188720703f, 0.371980876f},
-std::array<float,2>{0.686623752f, 0.464611977f},
-std::array<float,2>{0.372546226f, 0.883740246f},
-std::array<float,2>{0.807201505f, 0.696799755f},
-std::array<float,2>{0.0116376812f, 0.126215652f},
-std::array<float,2>{0.961369097f, 0.115541749f},
-std::array<float,2>{0.183171749f, 0.59884119f},
-std::array<float,2>{0.535748065f, 0.788021564f},
-std::array<float,2>{0.469185263f, 0.269310862f},
-std::array<float,2>{0.827027023f, 0.360536605f},
-std::array<float,2>{0.100503162f, 0.850813448f},
-std::array<float,2>{0.688689113f, 0.542668998f},
-std::array<float,2>{0.308398217f, 0.0153864613f},
-std::array<float,2>{0.598357379f, 0.232868627f},
-std::array<float,2>{0.396524578f, 0.658161402f},
-std::array<float,2>{0.923644423f, 0.998232961f},
-std::array<float,2>{0.240558311f, 0.392177671f},
-std::array<float,2>{0.507625163f, 0.281880528f},
-std::array<float,2>{0.445563614f, 0.770256877f},
-std::array<float,2>{0.993332803f, 0.572032392f},
-std::array<float,2>{0.142756298f, 0.0709683448f},
-std::array<float,2>{0.756813943f, 0.186511621f},
-std::array<float,2>{0.0336495116f, 0.725659311f},
-std::array<float,2>{0.63803345f, 0.921179235f},
-std::array<float,2>{0.333603531f, 0.483254611f},
-std::array<float,2>{0.876174152f, 0.427442253f},
-std::array<float,2>{0.201341853f, 0.968262613f},
-std::array<float,2>{0.571509182f, 0.655401707f},
-std::array<float,2>{0.434721172f, 0.188915521f},
-std::array<float,2>{0.72142607f, 0.0400470831f},
-std::array<float,2>{0.259801447f, 0.528985798f},
-std::array<float,2>{0.852437377f, 0.814160585f},
-std::array<float,2>{0.0883424655f, 0.323349059f},
-std::array<float,2>{0.586188257f, 0.385354638f},
-std::array<float,2>{0.413137406f, 0.98157239f},
-std::array<float,2>{0.893223763f, 0.680701852f},
-std::array<float,2>{0.207876146f, 0.240440622f},
-std::array<float,2>{0.864858508f, 0.0257039294f},
-std::array<float,2>{0.0626718476f, 0.553382874f},
-std::array<float,2>{0.746812701f, 0.868911564f},
-std::array<float,2>{0.267651588f, 0.35297519f},
-std::array<float,2>{0.981611073f, 0.258902162f},
-std::array<float,2>{0.139314145f, 0.798036397f},
-std::array<float,2>{0.522109687f, 0.615681708f},
-std::array<float,2>{0.467679977f, 0.102037713f},
-std::array<float,2>{0.653450787f, 0.148030981f},
-std::array<float,2>{0.314869791f, 0.713319123f},
-std::array<float,2>{0.775571704f, 0.901795745f},
-std::array<float,2>{0.0573809855f, 0.439966887f},
-std::array<float,2>{0.71136111f, 0.340164363f},
-std::array<float,2>{0.294628114f, 0.832524478f},
-std::array<float,2>{0.839095175f, 0.50517869f},
-std::array<float,2>{0.112708054f, 0.0538789555f},
-std::array<float,2>{0.906579852f, 0.210977107f},
-std::array<float,2>{0.222355545f, 0.630900562f},
-std::array<float,2>{0.611722827f, 0.943290949f},
-std::array<float,2>{0.377425998f, 0.418766171f},
-std::array<float,2>{0.790575325f, 0.499637902f},
-std::array<float,2>{0.0288925208f, 0.930742979f},
-std::array<float,2>{0.667381525f, 0.734912574f},
-std::array<float,2>{0.357655585f, 0.157410473f},
-std::array<float,2>{0.56071043f, 0.0848249495f},
-std::array<float,2>{0.490229964f, 0.585380077f},
-std::array<float,2>{0.938607216f, 0.765365839f},
-std::array<float,2>{0.168415546f, 0.300554395f},
-std::array<float,2>{0.693989038f, 0.487816691f},
-std::array<float,2>{0.311594933f, 0.92559433f},
-std::array<float,2>{0.821453333f, 0.746976733f},
-std::array<float,2>{0.0967593715f, 0.164091155f},
-std::array<float,2>{0.926736951f, 0.0872206315f},
-std::array<float,2>{0.234444663f, 0.592201233f},
-std::array<float,2>{0.593874991f, 0.755371571f},
-std::array<float,2>{0.390664071f, 0.31052807f},
-std::array<float,2>{0.808716595f, 0.332735479f},
-std::array<float,2>{0.0152605865f, 0.837545574f},
-std::array<float,2>{0.679829776f, 0.509657562f},
-std::array<float,2>{0.370710224f, 0.0547753088f},
-std::array<float,2>{0.532925963f, 0.20359759f},
-std::array<float,2>{0.475597799f, 0.634250462f},
-std::array<float,2>{0.965697885f, 0.946272671f},
-std::array<float,2>{0.185474426f, 0.408007622f},
-std::array<float,2>{0.57657057f, 0.25718087f},
-std::array<float,2>{0.43086189f, 0.807338417f},
-std::array<float,2>{0.880389988f, 0.623332441f},
-std::array<float,2>{0.197615191f, 0.0967259705f},
-std::array<float,2>{0.856566608f, 0.148953736f},
-std::array<float,2>{0.0925525874f, 0.706699789f},
-std::array<float,2>{0.725092053f, 0.89498812f},
-std::array<float,2>{0.263988405f, 0.447983682f},
-std::array<float,2>{0.998852789f, 0.379828781f},
-std::array<float,2>{0.144832268f, 0.976177454f},
-std::array<float,2>{0.501266181f, 0.679191172f},
-std::array<float,2>{0.450441331f, 0.245188773f},
-std::array<float,2>{0.633134663f, 0.0203040298f},
-std::array<float,2>{0.330661982f, 0.561656177f},
-std::array<float,2>{0.750258446f, 0.862822771f},
-std::array<float,2>{0.0359746031f, 0.347453177f},
-std::array<float,2>{0.519431114f, 0.436053306f},
-std::array<float,2>{0.464000046f, 0.959327936f},
-std::array<float,2>{0.979276717f, 0.647000551f},
-std::array<float,2>{0.136058003f, 0.197737068f},
-std::array<float,2>{0.780192792f, 0.0344341062f},
-std::array<float,2>{0.0600312725f, 0.5182302f},
-std::array<float,2>{0.648469687f, 0.826536f},
-std::array<float,2>{0.318442881f, 0.318732321f},
-std::array<float,2>{0.897720933f, 0.295775354f},
-std::array<float,2>{0.205171809f, 0.775503755f},
-std::array<float,2>{0.591647208f, 0.565556347f},
-std::array<float,2>{0.409894556f, 0.0676802993f},
-std::array<float,2>{0.743072689f, 0.17426075f},
-std::array<float,2>{0.270767152f, 0.73309207f},
-std::array<float,2>{0.859695196f, 0.90670222f},
-std::array<float,2>{0.0694626719f, 0.471288592f},
-std::array<float,2>{0.671067894f, 0.36929813f},
-std::array<float,2>{0.352783561f, 0.85633111f},
-std::array<float,2>{0.796172202f, 0.535692751f},
-std::array<float,2>{0.0250545777f, 0.00604922185f},
-std::array<float,2>{0.943166733f, 0.22410208f},
-std::array<float,2>{0.166657388f, 0.669480383f},
-std::array<float,2>{0.558069944f, 0.992166936f},
-std::array<float,2>{0.486617565f, 0.406034738f},
-std::array<float,2>{0.841300309f, 0.453859121f},
-std::array<float,2>{0.11614605f, 0.882652223f},
-std::array<float,2>{0.717880309f, 0.693982244f},
-std::array<float,2>{0.289078265f, 0.136288077f},
-std::array<float,2>{0.613694251f, 0.121964432f},
-std::array<float,2>{0.379924804f, 0.607245862f},
-std::array<float,2>{0.91235292f, 0.794650018f},
-std::array<float,2>{0.225243822f, 0.277347654f},
-std::array<float,2>{0.6406914f, 0.396673352f},
-std::array<float,2>{0.322527379f, 0.993100941f},
-std::array<float,2>{0.766648412f, 0.662923872f},
-std::array<float,2>{0.0491664819f, 0.230344325f},
-std::array<float,2>{0.970423996f, 0.00848481618f},
-std::array<float,2>{0.130680338f, 0.544987023f},
-std::array<float,2>{0.523452401f, 0.846628249f},
-std::array<float,2>{0.458556741f, 0.364133984f},
-std::array<float,2>{0.871232688f, 0.271188647f},
-std::array<float,2>{0.0739489719f, 0.781596899f},
-std::array<float,2>{0.734480858f, 0.597253382f},
-std::array<float,2>{0.278663605f, 0.113146394f},
-std::array<float,2>{0.578964293f, 0.13094382f},
-std::array<float,2>{0.415864855f, 0.700334132f},
-std::array<float,2>{0.89884454f, 0.888502181f},
-std::array<float,2>{0.210970476f, 0.46557337f},
-std::array<float,2>{0.551717401f, 0.325420886f},
-std::array<float,2>{0.492203236f, 0.817121744f},
-std::array<float,2>{0.950447559f, 0.527160943f},
-std::array<float,2>{0.158454224f, 0.0465499423f},
-std::array<float,2>{0.786114335f, 0.192189097f},
-std::array<float,2>{0.0159733929f, 0.651122928f},
-std::array<float,2>{0.656660616f, 0.963329017f},
-std::array<float,2>{0.349430323f, 0.424072653f},
-std::array<float,2>{0.921056569f, 0.479975402f},
-std::array<float,2>{0.229529083f, 0.915619493f},
-std::array<float,2>{0.618687153f, 0.718807459f},
-std::array<float,2>{0.383808672f, 0.181401223f},
-std::array<float,2>{0.710797489f, 0.0769550726f},
-std::array<float,2>{0.28834182f, 0.576680183f},
-std::array<float,2>{0.830323994f, 0.765744269f},
-std::array<float,2>{0.123652957f, 0.285555065f},
-std::array<float,2>{0.606339455f, 0.442153454f},
-std::array<float,2>{0.401441932f, 0.904060841f},
-std::array<float,2>{0.930361569f, 0.718543231f},
-std::array<float,2>{0.242823556f, 0.142794847f},
-std::array<float,2>{0.817095816f, 0.107014209f},
-std::array<float,2>{0.107105844f, 0.611286044f},
-std::array<float,2>{0.697158813f, 0.801734984f},
-std::array<float,2>{0.29923141f, 0.263640493f},
-std::array<float,2>{0.953309715f, 0.357298285f},
-std::array<float,2>{0.175694421f, 0.874684811f},
-std::array<float,2>{0.542927742f, 0.546990573f},
-std::array<float,2>{0.482674479f, 0.0285857432f},
-std::array<float,2>{0.677692711f, 0.237025619f},
-std::array<float,2>{0.363137841f, 0.686594486f},
-std::array<float,2>{0.802516103f, 0.979615629f},
-std::array<float,2>{0.00726396963f, 0.388236016f},
-std::array<float,2>{0.728504241f, 0.304400176f},
-std::array<float,2>{0.252491444f, 0.76126647f},
-std::array<float,2>{0.848985195f, 0.578231812f},
-std::array<float,2>{0.0808136836f, 0.080502443f},
-std::array<float,2>{0.885826886f, 0.161514372f},
-std::array<float,2>{0.195009455f, 0.741178095f},
-std::array<float,2>{0.564741135f, 0.936680138f},
-std::array<float,2>{0.426089317f, 0.495152026f},
-std::array<float,2>{0.761581838f, 0.417201251f},
-std::array<float,2>{0.0437698178f, 0.941332698f},
-std::array<float,2>{0.627206922f, 0.62581569f},
-std::array<float,2>{0.339503646f, 0.218302995f},
-std::array<float,2>{0.513281941f, 0.0472884029f},
-std::array<float,2>{0.444207042f, 0.503669024f},
-std::array<float,2>{0.985326886f, 0.828753531f},
-std::array<float,2>{0.152874902f, 0.337734133f},
-std::array<float,2>{0.706280351f, 0.37676844f},
-std::array<float,2>{0.283466637f, 0.97181356f},
-std::array<float,2>{0.833434343f, 0.67279011f},
-std::array<float,2>{0.11978066f, 0.248451024f},
-std::array<float,2>{0.914768755f, 0.0175807402f},
-std::array<float,2>{0.231617957f, 0.556643009f},
-std::array<float,2>{0.621727884f, 0.866545856f},
-std::array<float,2>{0.388741523f, 0.348275214f},
-std::array<float,2>{0.782374203f, 0.253126621f},
-std::array<float,2>{0.0227377936f, 0.81038785f},
-std::array<float,2>{0.66374445f, 0.617936552f},
-std::array<float,2>{0.34498772f, 0.0990910232f},
-std::array<float,2>{0.548151135f, 0.155362129f},
-std::array<float,2>{0.497735232f, 0.707037866f},
-std::array<float,2>{0.947480023f, 0.8917135f},
-std::array<float,2>{0.161047369f, 0.451488674f},
-std::array<float,2>{0.584909379f, 0.330372274f},
-std::array<float,2>{0.421840757f, 0.8401649f},
-std::array<float,2>{0.902839482f, 0.51219517f},
-std::array<float,2>{0.216212377f, 0.0589510389f},
-std::array<float,2>{0.870454311f, 0.209661812f},
-std::array<float,2>{0.0745755062f, 0.638936281f},
-std::array<float,2>{0.738638461f, 0.951119244f},
-std::array<float,2>{0.27664566f, 0.411362797f},
-std::array<float,2>{0.97483182f, 0.491904587f},
-std::array<float,2>{0.128217354f, 0.928604126f},
-std::array<float,2>{0.52874583f, 0.74237895f},
-std::array<float,2>{0.455662936f, 0.168269411f},
-std::array<float,2>{0.645314097f, 0.0929560512f},
-std::array<float,2>{0.326959789f, 0.587480962f},
-std::array<float,2>{0.770928979f, 0.752239883f},
-std::array<float,2>{0.0536619872f, 0.307179064f},
-std::array<float,2>{0.508073866f, 0.458004206f},
-std::array<float,2>{0.438952893f, 0.876116455f},
-std::array<float,2>{0.989333093f, 0.690337896f},
-std::array<float,2>{0.149893105f, 0.138569742f},
-std::array<float,2>{0.762467742f, 0.120974921f},
-std::array<float,2>{0.0415163599f, 0.604588628f},
-std::array<float,2>{0.631271183f, 0.790501654f},
-std::array<float,2>{0.3429676f, 0.274158061f},
-std::array<float,2>{0.887435973f, 0.374235362f},
-std::array<float,2>{0.189881608f, 0.851833701f},
-std::array<float,2>{0.56855762f, 0.532448649f},
-std::array<float,2>{0.4237625f, 0.00248852628f},
-std::array<float,2>{0.73070091f, 0.220517591f},
-std::array<float,2>{0.255083948f, 0.666691422f},
-std::array<float,2>{0.845492423f, 0.984848857f},
-std::array<float,2>{0.0833171457f, 0.400192887f},
-std::array<float,2>{0.674626529f, 0.292149395f},
-std::array<float,2>{0.366531461f, 0.779123664f},
-std::array<float,2>{0.799722791f, 0.567952931f},
-std::array<float,2>{0.00386656192f, 0.0638055205f},
-std::array<float,2>{0.959692121f, 0.176683798f},
-std::array<float,2>{0.178276524f, 0.72919184f},
-std::array<float,2>{0.546271443f, 0.911544502f},
-std::array<float,2>{0.478244454f, 0.476544201f},
-std::array<float,2>{0.814307392f, 0.433439463f},
-std::array<float,2>{0.103046291f, 0.954745173f},
-std::array<float,2>{0.700177133f, 0.643441677f},
-std::array<float,2>{0.303288549f, 0.199484482f},
-std::array<float,2>{0.602470398f, 0.0385218896f},
-std::array<float,2>{0.403485775f, 0.521024406f},
-std::array<float,2>{0.935474992f, 0.822172344f},
-std::array<float,2>{0.24936451f, 0.313094348f},
-std::array<float,2>{0.639751971f, 0.480922252f},
-std::array<float,2>{0.334875673f, 0.91832763f},
-std::array<float,2>{0.754449308f, 0.724441171f},
-std::array<float,2>{0.032891389f, 0.183695167f},
-std::array<float,2>{0.995671272f, 0.0730733201f},
-std::array<float,2>{0.142094448f, 0.574111462f},
-std::array<float,2>{0.504314661f, 0.773322821f},
-std::array<float,2>{0.447969943f, 0.284061521f},
-std::array<float,2>{0.853931487f, 0.320673227f},
-std::array<float,2>{0.0861361027f, 0.816236496f},
-std::array<float,2>{0.720693469f, 0.530014038f},
-std::array<float,2>{0.25893873f, 0.0425788313f},
-std::array<float,2>{0.573067248f, 0.190183982f},
-std::array<float,2>{0.436119974f, 0.654176354f},
-std::array<float,2>{0.877659917f, 0.966446877f},
-std::array<float,2>{0.199502125f, 0.428051323f},
-std::array<float,2>{0.53860265f, 0.2666381f},
-std::array<float,2>{0.471681833f, 0.786626458f},
-std::array<float,2>{0.964519382f, 0.600802898f},
-std::array<float,2>{0.181542888f, 0.11440073f},
-std::array<float,2>{0.806188047f, 0.128728226f},
-std::array<float,2>{0.00952594727f, 0.698377967f},
-std::array<float,2>{0.685498118f, 0.886317551f},
-std::array<float,2>{0.374565959f, 0.461407602f},
-std::array<float,2>{0.925385833f, 0.393305123f},
-std::array<float,2>{0.239825591f, 0.996195734f},
-std::array<float,2>{0.600443661f, 0.659959435f},
-std::array<float,2>{0.39564395f, 0.231063023f},
-std::array<float,2>{0.689526677f, 0.0124820247f},
-std::array<float,2>{0.305779666f, 0.539955735f},
-std::array<float,2>{0.825819969f, 0.848715782f},
-std::array<float,2>{0.0987117663f, 0.361473024f},
-std::array<float,2>{0.609733701f, 0.42029646f},
-std::array<float,2>{0.376844496f, 0.943567693f},
-std::array<float,2>{0.908421695f, 0.629715204f},
-std::array<float,2>{0.218879938f, 0.214146703f},
-std::array<float,2>{0.836171865f, 0.0518955514f},
-std::array<float,2>{0.109721683f, 0.50675565f},
-std::array<float,2>{0.713855147f, 0.835781693f},
-std::array<float,2>{0.295136839f, 0.343162984f},
-std::array<float,2>{0.940865636f, 0.297008008f},
-std::array<float,2>{0.171306625f, 0.762367904f},
-std::array<float,2>{0.560218394f, 0.583649158f},
-std::array<float,2>{0.491235495f, 0.0821236521f},
-std::array<float,2>{0.66432178f, 0.159178466f},
-std::array<float,2>{0.356152624f, 0.737141669f},
-std::array<float,2>{0.792391062f, 0.933236361f},
-std::array<float,2>{0.0299008861f, 0.496442914f},
-std::array<float,2>{0.749452949f, 0.354505807f},
-std::array<float,2>{0.267049551f, 0.870120585f},
-std::array<float,2>{0.86618799f, 0.552069187f},
-std::array<float,2>{0.0645471066f, 0.0234863143f},
-std::array<float,2>{0.891599417f, 0.238326147f},
-std::array<float,2>{0.209239945f, 0.683255672f},
-std::array<float,2>{0.588428259f, 0.984253705f},
-std::array<float,2>{0.411793023f, 0.383623958f},
-std::array<float,2>{0.774948418f, 0.438840389f},
-std::array<float,2>{0.0553697199f, 0.898717046f},
-std::array<float,2>{0.655529737f, 0.711229622f},
-std::array<float,2>{0.313312471f, 0.146058589f},
-std::array<float,2>{0.520597398f, 0.105001405f},
-std::array<float,2>{0.465875626f, 0.613619387f},
-std::array<float,2>{0.982675195f, 0.799012959f},
-std::array<float,2>{0.137906417f, 0.260469526f},
-std::array<float,2>{0.724339664f, 0.447004378f},
-std::array<float,2>{0.263181031f, 0.89764744f},
-std::array<float,2>{0.857643843f, 0.704258204f},
-std::array<float,2>{0.0905272588f, 0.151396319f},
-std::array<float,2>{0.881995022f, 0.0943366736f},
-std::array<float,2>{0.196665794f, 0.622650683f},
-std::array<float,2>{0.574311435f, 0.806488693f},
-std::array<float,2>{0.433094084f, 0.255595952f},
-std::array<float,2>{0.752433538f, 0.345014066f},
-std::array<float,2>{0.0378178731f, 0.859536886f},
-std::array<float,2>{0.63495189f, 0.560269117f},
-std::array<float,2>{0.32815364f, 0.0223835707f},
-std::array<float,2>{0.502468705f, 0.24334237f},
-std::array<float,2>{0.451721758f, 0.677626908f},
-std::array<float,2>{0.99684912f, 0.973305345f},
-std::array<float,2>{0.147231549f, 0.381946027f},
-std::array<float,2>{0.596929431f, 0.311706126f},
-std::array<float,2>{0.393058807f, 0.756803274f},
-std::array<float,2>{0.929510057f, 0.591746867f},
-std::array<float,2>{0.237983957f, 0.0883575454f},
-std::array<float,2>{0.824148118f, 0.166089043f},
-std::array<float,2>{0.0954412818f, 0.74929142f},
-std::array<float,2>{0.691779196f, 0.923502147f},
-std::array<float,2>{0.308637947f, 0.485919267f},
-std::array<float,2>{0.967070043f, 0.408480138f},
-std::array<float,2>{0.185868189f, 0.948803067f},
-std::array<float,2>{0.533265233f, 0.635307372f},
-std::array<float,2>{0.473826647f, 0.205687672f},
-std::array<float,2>{0.683033466f, 0.057221625f},
-std::array<float,2>{0.367345124f, 0.510017097f},
-std::array<float,2>{0.811003447f, 0.838825822f},
-std::array<float,2>{0.0130777126f, 0.334493995f},
-std::array<float,2>{0.555994153f, 0.402697682f},
-std::array<float,2>{0.48552081f, 0.990117669f},
-std::array<float,2>{0.94370091f, 0.670389712f},
-std::array<float,2>{0.165735841f, 0.225061432f},
-std::array<float,2>{0.794004679f, 0.00579683762f},
-std::array<float,2>{0.0272467788f, 0.538571119f},
-std::array<float,2>{0.66959089f, 0.858217657f},
-std::array<float,2>{0.354481071f, 0.367575824f},
-std::array<float,2>{0.911569178f, 0.280019104f},
-std::array<float,2>{0.223282874f, 0.795774758f},
-std::array<float,2>{0.616243303f, 0.607966244f},
-std::array<float,2>{0.381904602f, 0.123097606f},
-std::array<float,2>{0.716640949f, 0.13386704f},
-std::array<float,2>{0.292226553f, 0.692902744f},
-std::array<float,2>{0.842193365f, 0.878971279f},
-std::array<float,2>{0.114534996f, 0.45626992f},
-std::array<float,2>{0.651313365f, 0.316967875f},
-std::array<float,2>{0.316801906f, 0.825981319f},
-std::array<float,2>{0.778865814f, 0.516338229f},
-std::array<float,2>{0.0620647296f, 0.0313008875f},
-std::array<float,2>{0.977330744f, 0.195880577f},
-std::array<float,2>{0.133591786f, 0.645962894f},
-std::array<float,2>{0.516163588f, 0.957110047f},
-std::array<float,2>{0.462171316f, 0.43459028f},
-std::array<float,2>{0.861854792f, 0.470358878f},
-std::array<float,2>{0.0678546131f, 0.90953815f},
-std::array<float,2>{0.745374858f, 0.731503248f},
-std::array<float,2>{0.271549255f, 0.172752231f},
-std::array<float,2>{0.593114555f, 0.068634443f},
-std::array<float,2>{0.408190787f, 0.564148545f},
-std::array<float,2>{0.895803273f, 0.773501337f},
-std::array<float,2>{0.20351252f, 0.293804348f},
-std::array<float,2>{0.658911467f, 0.422638267f},
-std::array<float,2>{0.350378692f, 0.961963177f},
-std::array<float,2>{0.788387358f, 0.648942709f},
-std::array<float,2>{0.0187050235f, 0.194765225f},
-std::array<float,2>{0.951525152f, 0.0440951884f},
-std::array<float,2>{0.156382367f, 0.523603141f},
-std::array<float,2>{0.553145587f, 0.818743587f},
-std::array<float,2>{0.494405508f, 0.326386541f},
-std::array<float,2>{0.829826653f, 0.287200779f},
-std::array<float,2>{0.12122979f, 0.76822871f},
-std::array<float,2>{0.707967222f, 0.575194478f},
-std::array<float,2>{0.286237299f, 0.0749122873f},
-std::array<float,2>{0.619787097f, 0.182423472f},
-std::array<float,2>{0.386562735f, 0.721335888f},
-std::array<float,2>{0.918580294f, 0.91733712f},
-std::array<float,2>{0.227919057f, 0.477440447f},
-std::array<float,2>{0.525849342f, 0.365692288f},
-std::array<float,2>{0.459433645f, 0.843780518f},
-std::array<float,2>{0.97130096f, 0.544884086f},
-std::array<float,2>{0.130954221f, 0.0108296592f},
-std::array<float,2>{0.769051611f, 0.227797627f},
-std::array<float,2>{0.047864493f, 0.660406828f},
-std::array<float,2>{0.643165469f, 0.995675564f},
-std::array<float,2>{0.321267217f, 0.395440102f},
-std::array<float,2>{0.902207851f, 0.467680484f},
-std::array<float,2>{0.213207886f, 0.889174283f},
-std::array<float,2>{0.581073165f, 0.701356828f},
-std::array<float,2>{0.417687088f, 0.130711243f},
-std::array<float,2>{0.737628877f, 0.110507652f},
-std::array<float,2>{0.281046182f, 0.594065607f},
-std::array<float,2>{0.874905348f, 0.784035623f},
-std::array<float,2>{0.0718441382f, 0.273278952f},
-std::array<float,2>{0.562951088f, 0.493496388f},
-std::array<float,2>{0.428801149f, 0.934970677f},
-std::array<float,2>{0.884102285f, 0.738508463f},
-std::array<float,2>{0.19179149f, 0.162949398f},
-std::array<float,2>{0.849618554f, 0.0782102868f},
-std::array<float,2>{0.079835169f, 0.580545485f},
-std::array<float,2>{0.729117334f, 0.758037031f},
-std::array<float,2>{0.250157058f, 0.301139593f},
-std::array<float,2>{0.988254905f, 0.33855316f},
-std::array<float,2>{0.155816808f, 0.831802547f},
-std::array<float,2>{0.515412033f, 0.501154065f},
-std::array<float,2>{0.442664891f, 0.0504089184f},
-std::array<float,2>{0.62613976f, 0.216353595f},
-std::array<float,2>{0.336964965f, 0.628132701f},
-std::array<float,2>{0.758322775f, 0.93867141f},
-std::array<float,2>{0.0461679026f, 0.414919406f},
-std::array<float,2>{0.698588967f, 0.264101475f},
-std::array<float,2>{0.297831863f, 0.803565681f},
-std::array<float,2>{0.819686532f, 0.612896204f},
-std::array<float,2>{0.108148471f, 0.108311445f},
-std::array<float,2>{0.933552086f, 0.141723722f},
-std::array<float,2>{0.245751619f, 0.715248644f},
-std::array<float,2>{0.609263897f, 0.906065881f},
-std::array<float,2>{0.399664074f, 0.444875926f},
-std::array<float,2>{0.804301381f, 0.388986558f},
-std::array<float,2>{0.00470845355f, 0.977908432f},
-std::array<float,2>{0.679495871f, 0.685439527f},
-std::array<float,2>{0.35957858f, 0.235470936f},
-std::array<float,2>{0.539881408f, 0.0307202637f},
-std::array<float,2>{0.481904984f, 0.550756097f},
-std::array<float,2>{0.956697166f, 0.871912956f},
-std::array<float,2>{0.173280224f, 0.357799709f},
-std::array<float,2>{0.701131165f, 0.430304438f},
-std::array<float,2>{0.304216892f, 0.955296278f},
-std::array<float,2>{0.812642753f, 0.641197026f},
-std::array<float,2>{0.102431543f, 0.202083707f},
-std::array<float,2>{0.93420583f, 0.035494525f},
-std::array<float,2>{0.248625472f, 0.52197063f},
-std::array<float,2>{0.603256941f, 0.82386291f},
-std::array<float,2>{0.402920455f, 0.316292077f},
-std::array<float,2>{0.800503194f, 0.290119946f},
-std::array<float,2>{0.00201359019f, 0.781096876f},
-std::array<float,2>{0.675577998f, 0.569748044f},
-std::array<float,2>{0.365912408f, 0.0644839406f},
-std::array<float,2>{0.545202374f, 0.178056628f},
-std::array<float,2>{0.476646066f, 0.72731775f},
-std::array<float,2>{0.960068822f, 0.912213922f},
-std::array<float,2>{0.179574192f, 0.474429369f},
-std::array<float,2>{0.569566429f, 0.372217357f},
-std::array<float,2>{0.422722518f, 0.854202092f},
-std::array<float,2>{0.888629854f, 0.534024417f},
-std::array<float,2>{0.190569073f, 0.000231591475f},
-std::array<float,2>{0.844105482f, 0.221618831f},
-std::array<float,2>{0.0821275339f, 0.665647209f},
-std::array<float,2>{0.731532574f, 0.98737812f},
-std::array<float,2>{0.254086673f, 0.400594831f},
-std::array<float,2>{0.98864615f, 0.46057716f},
-std::array<float,2>{0.148459107f, 0.878891885f},
-std::array<float,2>{0.509195983f, 0.687840462f},
-std::array<float,2>{0.438281983f, 0.1391837f},
-std::array<float,2>{0.632594287f, 0.118693337f},
-std::array<float,2>{0.34223181f, 0.602747321f},
-std::array<float,2>{0.762923419f, 0.791031003f},
-std::array<float,2>{0.0420715436f, 0.275421023f},
-std::array<float,2>{0.527491152f, 0.4889732f},
-std::array<float,2>{0.456467122f, 0.926441193f},
-std::array<float,2>{0.975658357f, 0.744994402f},
-std::array<float,2>{0.127161846f, 0.170090213f},
-std::array<float,2>{0.770148575f, 0.0914291516f},
-std::array<float,2>{0.054210525f, 0.587907434f},
-std::array<float,2>{0.645729899f, 0.751630723f},
-std::array<float,2>{0.327935815f, 0.306394279f},
-std::array<float,2>{0.903721154f, 0.32922852f},
-std::array<float,2>{0.215370074f, 0.842846155f},
-std::array<float,2>{0.585739315f, 0.515494823f},
-std::array<float,2>{0.420308262f, 0.0609814189f},
-std::array<float,2>{0.73933208f, 0.207687259f},
-std::array<float,2>{0.275679439f, 0.637260079f},
-std::array<float,2>{0.869622707f, 0.952746153f},
-std::array<float,2>{0.0756429061f, 0.413601428f},
-std::array<float,2>{0.662952483f, 0.25071916f},
-std::array<float,2>{0.344413787f, 0.810957074f},
-std::array<float,2>{0.781858265f, 0.61915642f},
-std::array<float,2>{0.0221205782f, 0.10014271f},
-std::array<float,2>{0.948641658f, 0.152801767f},
-std::array<float,2>{0.161840573f, 0.710781217f},
-std::array<float,2>{0.547021866f, 0.893065929f},
-std::array<float,2>{0.496722221f, 0.450419694f},
-std::array<float,2>{0.832699597f, 0.377773404f},
-std::array<float,2>{0.120169789f, 0.969093323f},
-std::array<float,2>{0.705939651f, 0.674201369f},
-std::array<float,2>{0.284743607f, 0.246907651f},
-std::array<float,2>{0.622290075f, 0.015680138f},
-std::array<float,2>{0.390502423f, 0.555399001f},
-std::array<float,2>{0.915353358f, 0.864419699f},
-std::array<float,2>{0.23118335f, 0.350824565f},
-std::array<float,2>{0.654764295f, 0.440688848f},
-std::array<float,2>{0.314421713f, 0.900615335f},
-std::array<float,2>{0.773736477f, 0.714681506f},
-std::array<float,2>{0.0561149977f, 0.146705315f},
-std::array<float,2>{0.983914971f, 0.103506036f},
-std::array<float,2>{0.136884734f, 0.616784334f},
-std::array<float,2>{0.52028054f, 0.797096848f},
-std::array<float,2>{0.465489537f, 0.258524895f},
-std::array<float,2>{0.866643071f, 0.351704568f},
-std::array<float,2>{0.0657191724f, 0.867326617f},
-std::array<float,2>{0.748251081f, 0.554416239f},
-std::array<float,2>{0.266471267f, 0.0270037688f},
-std::array<float,2>{0.5893839f, 0.241986901f},
-std::array<float,2>{0.411005467f, 0.680402696f},
-std::array<float,2>{0.892294347f, 0.98065865f},
-std::array<float,2>{0.210259065f, 0.385836095f},
-std::array<float,2>{0.559168637f, 0.299779892f},
-std::array<float,2>{0.490257889f, 0.763867676f},
-std::array<float,2>{0.939604402f, 0.584934175f},
-std::array<float,2>{0.170599803f, 0.0857668146f},
-std::array<float,2>{0.791493654f, 0.156816795f},
-std::array<float,2>{0.0307791643f, 0.735748053f},
-std::array<float,2>{0.665457189f, 0.929943383f},
-std::array<float,2>{0.356456965f, 0.498773336f},
-std::array<float,2>{0.910148621f, 0.419827104f},
-std::array<float,2>{0.220121294f, 0.941749752f},
-std::array<float,2>{0.61047858f, 0.632715106f},
-std::array<float,2>{0.375301868f, 0.212882653f},
-std::array<float,2>{0.71450603f, 0.0528645106f},
-std::array<float,2>{0.295899332f, 0.50409621f},
-std::array<float,2>{0.837527514f, 0.833436191f},
-std::array<float,2>{0.110676229f, 0.34103632f},
-std::array<float,2>{0.601338863f, 0.390936792f},
-std::array<float,2>{0.394782245f, 0.999434531f},
-std::array<float,2>{0.924525142f, 0.656332612f},
-std::array<float,2>{0.239070714f, 0.233514145f},
-std::array<float,2>{0.824952304f, 0.0141385989f},
-std::array<float,2>{0.0982273221f, 0.541024208f},
-std::array<float,2>{0.690945864f, 0.85004586f},
-std::array<float,2>{0.30484131f, 0.36002636f},
-std::array<float,2>{0.963839591f, 0.268201202f},
-std::array<float,2>{0.180177644f, 0.788129687f},
-std::array<float,2>{0.537216663f, 0.598379731f},
-std::array<float,2>{0.470823079f, 0.116761588f},
-std::array<float,2>{0.684031427f, 0.125404462f},
-std::array<float,2>{0.373905987f, 0.695816636f},
-std::array<float,2>{0.805624783f, 0.884185553f},
-std::array<float,2>{0.00835522823f, 0.463216007f},
-std::array<float,2>{0.719204962f, 0.322972208f},
-std::array<float,2>{0.258089334f, 0.812722862f},
-std::array<float,2>{0.855131388f, 0.528195381f},
-std::array<float,2>{0.0875262469f, 0.0399491563f},
-std::array<float,2>{0.878390908f, 0.188401133f},
-std::array<float,2>{0.200211197f, 0.654662132f},
-std::array<float,2>{0.573773682f, 0.967174709f},
-std::array<float,2>{0.437226236f, 0.425986022f},
-std::array<float,2>{0.755271614f, 0.483413875f},
-std::array<float,2>{0.0321784094f, 0.920044363f},
-std::array<float,2>{0.639153361f, 0.72487247f},
-std::array<float,2>{0.335766137f, 0.187257752f},
-std::array<float,2>{0.505320728f, 0.072115615f},
-std::array<float,2>{0.448518157f, 0.570361614f},
-std::array<float,2>{0.994156718f, 0.770556271f},
-std::array<float,2>{0.14091818f, 0.282504201f},
-std::array<float,2>{0.744579136f, 0.472062826f},
-std::array<float,2>{0.273323715f, 0.90755856f},
-std::array<float,2>{0.862411499f, 0.734131753f},
-std::array<float,2>{0.0668721199f, 0.175613403f},
-std::array<float,2>{0.894835293f, 0.0670043007f},
-std::array<float,2>{0.204132184f, 0.564892232f},
-std::array<float,2>{0.592391491f, 0.776659191f},
-std::array<float,2>{0.406430483f, 0.296085596f},
-std::array<float,2>{0.777601779f, 0.319422871f},
-std::array<float,2>{0.0612444505f, 0.82763803f},
-std::array<float,2>{0.651907504f, 0.518562138f},
-std::array<float,2>{0.317450345f, 0.0339596644f},
-std::array<float,2>{0.516955972f, 0.198322356f},
-std::array<float,2>{0.461447775f, 0.647983193f},
-std::array<float,2>{0.977994919f, 0.960490882f},
-std::array<float,2>{0.134696811f, 0.437284648f},
-std::array<float,2>{0.615532756f, 0.278665423f},
-std::array<float,2>{0.381746501f, 0.793462396f},
-std::array<float,2>{0.911105633f, 0.605868399f},
-std::array<float,2>{0.224550858f, 0.122221135f},
-std::array<float,2>{0.843590617f, 0.134874374f},
-std::array<float,2>{0.114166364f, 0.695171535f},
-std::array<float,2>{0.714845181f, 0.881488502f},
-std::array<float,2>{0.291717291f, 0.454459965f},
-std::array<float,2>{0.944868088f, 0.404994607f},
-std::array<float,2>{0.164745569f, 0.990275204f},
-std::array<float,2>{0.5547508f, 0.668872714f},
-std::array<float,2>{0.484757513f, 0.223226324f},
-std::array<float,2>{0.668859303f, 0.00690606935f},
-std::array<float,2>{0.354746163f, 0.536363006f},
-std::array<float,2>{0.793266058f, 0.856815755f},
-std::array<float,2>{0.0255020782f, 0.370479077f},
-std::array<float,2>{0.534511447f, 0.407203048f},
-std::array<float,2>{0.473303676f, 0.947159052f},
-std::array<float,2>{0.968457401f, 0.633143842f},
-std::array<float,2>{0.186769858f, 0.205073148f},
-std::array<float,2>{0.812117875f, 0.0558904968f},
-std::array<float,2>{0.0119243115f, 0.507863641f},
-std::array<float,2>{0.681674778f, 0.83678478f},
-std::array<float,2>{0.369055182f, 0.333182096f},
-std::array<float,2>{0.928370774f, 0.309196025f},
-std::array<float,2>{0.236709371f, 0.754042208f},
-std::array<float,2>{0.596559048f, 0.593372941f},
-std::array<float,2>{0.39425683f, 0.086154528f},
-std::array<float,2>{0.693346858f, 0.165292591f},
-std::array<float,2>{0.309763342f, 0.747889578f},
-std::array<float,2>{0.822931409f, 0.924444079f},
-std::array<float,2>{0.0946416855f, 0.487235099f},
-std::array<float,2>{0.635931671f, 0.345968813f},
-std::array<float,2>{0.329162866f, 0.861779153f},
-std::array<float,2>{0.753808558f, 0.560709476f},
-std::array<float,2>{0.0382845476f, 0.020864699f},
-std::array<float,2>{0.998006999f, 0.244532779f},
-std::array<float,2>{0.148003384f, 0.678463459f},
-std::array<float,2>{0.503062189f, 0.974689305f},
-std::array<float,2>{0.452785969f, 0.380085379f},
-std::array<float,2>{0.858715534f, 0.448462218f},
-std::array<float,2>{0.0908353627f, 0.895916462f},
-std::array<float,2>{0.723118365f, 0.705521703f},
-std::array<float,2>{0.262264669f, 0.150367334f},
-std::array<float,2>{0.575580835f, 0.0958485305f},
-std::array<float,2>{0.432427645f, 0.624106586f},
-std::array<float,2>{0.881103158f, 0.808209181f},
-std::array<float,2>{0.195813969f, 0.256142139f},
-std::array<float,2>{0.678545773f, 0.386823654f},
-std::array<float,2>{0.360381186f, 0.978680909f},
-std::array<float,2>{0.803321123f, 0.685617626f},
-std::array<float,2>{0.0051633832f, 0.237616047f},
-std::array<float,2>{0.955648661f, 0.0275171027f},
-std::array<float,2>{0.172470883f, 0.548247755f},
-std::array<float,2>{0.540573657f, 0.873669565f},
-std::array<float,2>{0.480875075f, 0.356282085f},
-std::array<float,2>{0.818868518f, 0.262635946f},
-std::array<float,2>{0.108549334f, 0.801802576f},
-std::array<float,2>{0.697706401f, 0.610049903f},
-std::array<float,2>{0.298093051f, 0.10625378f},
-std::array<float,2>{0.607791483f, 0.144247577f},
-std::array<float,2>{0.399240196f, 0.717468917f},
-std::array<float,2>{0.931799293f, 0.903110266f},
-std::array<float,2>{0.245090187f, 0.443060011f},
-std::array<float,2>{0.514043629f, 0.336791933f},
-std::array<float,2>{0.441509753f, 0.829564512f},
-std::array<float,2>{0.987088621f, 0.502007246f},
-std::array<float,2>{0.154761449f, 0.0482010655f},
-std::array<float,2>{0.759367108f, 0.21720311f},
-std::array<float,2>{0.0450640507f, 0.626426816f},
-std::array<float,2>{0.62574482f, 0.939611435f},
-std::array<float,2>{0.336633921f, 0.416850746f},
-std::array<float,2>{0.883158088f, 0.495041728f},
-std::array<float,2>{0.192702949f, 0.936370671f},
-std::array<float,2>{0.564010799f, 0.741332233f},
-std::array<float,2>{0.42788738f, 0.161016881f},
-std::array<float,2>{0.729816914f, 0.0811208114f},
-std::array<float,2>{0.25109157f, 0.579282105f},
-std::array<float,2>{0.851172924f, 0.760225713f},
-std::array<float,2>{0.0782159269f, 0.303573877f},
-std::array<float,2>{0.580695033f, 0.466581702f},
-std::array<float,2>{0.416779965f, 0.887052715f},
-std::array<float,2>{0.901179731f, 0.700011194f},
-std::array<float,2>{0.214515284f, 0.132114008f},
-std::array<float,2>{0.873706579f, 0.112151995f},
-std::array<float,2>{0.070411481f, 0.596102417f},
-std::array<float,2>{0.737096071f, 0.783091664f},
-std::array<float,2>{0.279985934f, 0.270136863f},
-std::array<float,2>{0.972012937f, 0.364768565f},
-std::array<float,2>{0.131915942f, 0.847236395f},
-std::array<float,2>{0.527135313f, 0.546725392f},
-std::array<float,2>{0.460446298f, 0.00946727768f},
-std::array<float,2>{0.644528985f, 0.229008809f},
-std::array<float,2>{0.321340919f, 0.663440943f},
-std::array<float,2>{0.767732203f, 0.993974805f},
-std::array<float,2>{0.047462862f, 0.397556961f},
-std::array<float,2>{0.708696544f, 0.286732674f},
-std::array<float,2>{0.285617888f, 0.766845584f},
-std::array<float,2>{0.828223586f, 0.577845991f},
-std::array<float,2>{0.122443147f, 0.0778340399f},
-std::array<float,2>{0.919591248f, 0.180113673f},
-std::array<float,2>{0.226890162f, 0.720530033f},
-std::array<float,2>{0.620439649f, 0.914995551f},
-std::array<float,2>{0.385118097f, 0.478846848f},
-std::array<float,2>{0.787836194f, 0.42503047f},
-std::array<float,2>{0.0181514658f, 0.96391803f},
-std::array<float,2>{0.660140693f, 0.65206188f},
-std::array<float,2>{0.351384908f, 0.193244904f},
-std::array<float,2>{0.554570913f, 0.0457328036f},
-std::array<float,2>{0.495341778f, 0.525792241f},
-std::array<float,2>{0.952728033f, 0.817824841f},
-std::array<float,2>{0.158018023f, 0.324537188f},
-std::array<float,2>{0.73307097f, 0.398864836f},
-std::array<float,2>{0.257008523f, 0.985618651f},
-std::array<float,2>{0.847424328f, 0.667652249f},
-std::array<float,2>{0.0848300532f, 0.219487891f},
-std::array<float,2>{0.889256537f, 0.0030614417f},
-std::array<float,2>{0.188288763f, 0.531588256f},
-std::array<float,2>{0.568121552f, 0.853451848f},
-std::array<float,2>{0.425445646f, 0.373651087f},
-std::array<float,2>{0.764280558f, 0.274653256f},
-std::array<float,2>{0.039517913f, 0.789136887f},
-std::array<float,2>{0.629236579f, 0.604112387f},
-std::array<float,2>{0.340702057f, 0.119662933f},
-std::array<float,2>{0.510473311f, 0.137293965f},
-std::array<float,2>{0.439989537f, 0.691080987f},
-std::array<float,2>{0.990661621f, 0.875810146f},
-std::array<float,2>{0.151360482f, 0.45814994f},
-std::array<float,2>{0.604751527f, 0.313792437f},
-std::array<float,2>{0.405822247f, 0.820769489f},
-std::array<float,2>{0.935608685f, 0.519946039f},
-std::array<float,2>{0.246814117f, 0.0378568172f},
-std::array<float,2>{0.814762175f, 0.200988308f},
-std::array<float,2>{0.105102316f, 0.644177318f},
-std::array<float,2>{0.701543808f, 0.953678608f},
-std::array<float,2>{0.302137852f, 0.432131588f},
-std::array<float,2>{0.95775944f, 0.475003123f},
-std::array<float,2>{0.177688941f, 0.910798311f},
-std::array<float,2>{0.543636501f, 0.729613423f},
-std::array<float,2>{0.479056746f, 0.17723158f},
-std::array<float,2>{0.673625648f, 0.0625303611f},
-std::array<float,2>{0.364664584f, 0.566634655f},
-std::array<float,2>{0.797243953f, 0.777921259f},
-std::array<float,2>{0.00033444463f, 0.2915456f},
-std::array<float,2>{0.549406767f, 0.452816218f},
-std::array<float,2>{0.499555111f, 0.891194105f},
-std::array<float,2>{0.947096884f, 0.708839476f},
-std::array<float,2>{0.163686931f, 0.154957786f},
-std::array<float,2>{0.78467375f, 0.0980953872f},
-std::array<float,2>{0.021294646f, 0.618360341f},
-std::array<float,2>{0.660447359f, 0.809055984f},
-std::array<float,2>{0.34600848f, 0.252925336f},
-std::array<float,2>{0.917293549f, 0.348927319f},
-std::array<float,2>{0.233748332f, 0.866073787f},
-std::array<float,2>{0.623784184f, 0.55796963f},
-std::array<float,2>{0.388183624f, 0.019381294f},
-std::array<float,2>{0.704541147f, 0.249339297f},
-std::array<float,2>{0.281834155f, 0.673720956f},
-std::array<float,2>{0.835006952f, 0.97104758f},
-std::array<float,2>{0.117905043f, 0.37528941f},
-std::array<float,2>{0.648023963f, 0.308298647f},
-std::array<float,2>{0.32444334f, 0.753149331f},
-std::array<float,2>{0.77197051f, 0.586273432f},
-std::array<float,2>{0.0520506203f, 0.0921861827f},
-std::array<float,2>{0.973239541f, 0.169372782f},
-std::array<float,2>{0.126215577f, 0.743526578f},
-std::array<float,2>{0.530282676f, 0.929183125f},
-std::array<float,2>{0.453180611f, 0.490469009f},
-std::array<float,2>{0.868876338f, 0.410888493f},
-std::array<float,2>{0.0780078098f, 0.949836135f},
-std::array<float,2>{0.741706312f, 0.640256643f},
-std::array<float,2>{0.274767756f, 0.210718811f},
-std::array<float,2>{0.582262337f, 0.0602673478f},
-std::array<float,2>{0.419651926f, 0.513177991f},
-std::array<float,2>{0.904737651f, 0.840982676f},
-std::array<float,2>{0.217280865f, 0.331530064f},
-std::array<float,2>{0.666972518f, 0.49799934f},
-std::array<float,2>{0.358833075f, 0.931869328f},
-std::array<float,2>{0.789463878f, 0.737459958f},
-std::array<float,2>{0.0273756832f, 0.159711152f},
-std::array<float,2>{0.938027203f, 0.0835863128f},
-std::array<float,2>{0.169547155f, 0.582948387f},
-std::array<float,2>{0.562450945f, 0.762800932f},
-std::array<float,2>{0.488799989f, 0.298676938f},
-std::array<float,2>{0.838698983f, 0.342305273f},
-std::array<float,2>{0.112159975f, 0.834225416f},
-std::array<float,2>{0.712160408f, 0.507184446f},
-std::array<float,2>{0.293019801f, 0.051005017f},
-std::array<float,2>{0.612524867f, 0.213321239f},
-std::array<float,2>{0.378408074f, 0.630423486f},
-std::array<float,2>{0.907533526f, 0.945185542f},
-std::array<float,2>{0.221198827f, 0.421580881f},
-std::array<float,2>{0.522877932f, 0.260833979f},
-std::array<float,2>{0.468536556f, 0.80049932f},
-std::array<float,2>{0.980957747f, 0.615046084f},
-std::array<float,2>{0.140440449f, 0.104427561f},
-std::array<float,2>{0.777311325f, 0.145472646f},
-std::array<float,2>{0.0579399616f, 0.712224364f},
-std::array<float,2>{0.653259635f, 0.900384307f},
-std::array<float,2>{0.315615535f, 0.43778491f},
-std::array<float,2>{0.893961132f, 0.384585172f},
-std::array<float,2>{0.208156288f, 0.983383119f},
-std::array<float,2>{0.587722719f, 0.681669235f},
-std::array<float,2>{0.412791044f, 0.239935979f},
-std::array<float,2>{0.747313857f, 0.0251632221f},
-std::array<float,2>{0.269311875f, 0.5508641f},
-std::array<float,2>{0.864021301f, 0.869152844f},
-std::array<float,2>{0.0637284443f, 0.353998601f},
-std::array<float,2>{0.570797145f, 0.428876787f},
-std::array<float,2>{0.433811069f, 0.96520406f},
-std::array<float,2>{0.87500304f, 0.652752638f},
-std::array<float,2>{0.203111097f, 0.190720156f},
-std::array<float,2>{0.853388071f, 0.0411897525f},
-std::array<float,2>{0.0890973061f, 0.530511916f},
-std::array<float,2>{0.72191304f, 0.814918697f},
-std::array<float,2>{0.261367798f, 0.321348518f},
-std::array<float,2>{0.99276787f, 0.284342259f},
-std::array<float,2>{0.144334152f, 0.771592557f},
-std::array<float,2>{0.506012917f, 0.5724985f},
-std::array<float,2>{0.447212756f, 0.074134998f},
-std::array<float,2>{0.637331605f, 0.185008615f},
-std::array<float,2>{0.332348824f, 0.723166347f},
-std::array<float,2>{0.757333994f, 0.919234812f},
-std::array<float,2>{0.0343984477f, 0.481719136f},
-std::array<float,2>{0.688179314f, 0.362878799f},
-std::array<float,2>{0.306691051f, 0.847753704f},
-std::array<float,2>{0.827800274f, 0.540643334f},
-std::array<float,2>{0.10152176f, 0.0131957587f},
-std::array<float,2>{0.922614515f, 0.231880546f},
-std::array<float,2>{0.241799206f, 0.659154117f},
-std::array<float,2>{0.598907173f, 0.997105241f},
-std::array<float,2>{0.398146868f, 0.394064724f},
-std::array<float,2>{0.808153093f, 0.462292761f},
-std::array<float,2>{0.0103247268f, 0.884966016f},
-std::array<float,2>{0.685821056f, 0.698175788f},
-std::array<float,2>{0.371129215f, 0.126964405f},
-std::array<float,2>{0.53706044f, 0.113469087f},
-std::array<float,2>{0.47038278f, 0.600484133f},
-std::array<float,2>{0.962007344f, 0.785484314f},
-std::array<float,2>{0.18189998f, 0.265710324f},
-std::array<float,2>{0.716898501f, 0.456011117f},
-std::array<float,2>{0.29042691f, 0.880153298f},
-std::array<float,2>{0.840327084f, 0.691969991f},
-std::array<float,2>{0.116430409f, 0.132907659f},
-std::array<float,2>{0.913744628f, 0.124144897f},
-std::array<float,2>{0.226363659f, 0.608814836f},
-std::array<float,2>{0.614691436f, 0.796573758f},
-std::array<float,2>{0.379737407f, 0.281090051f},
-std::array<float,2>{0.795541942f, 0.368537366f},
-std::array<float,2>{0.0237767044f, 0.858587682f},
-std::array<float,2>{0.670130908f, 0.537962139f},
-std::array<float,2>{0.351598203f, 0.00420779595f},
-std::array<float,2>{0.557130218f, 0.225987479f},
-std::array<float,2>{0.487980425f, 0.67124486f},
-std::array<float,2>{0.941656947f, 0.988716483f},
-std::array<float,2>{0.167250007f, 0.403621733f},
-std::array<float,2>{0.590322495f, 0.294761062f},
-std::array<float,2>{0.408560336f, 0.774852812f},
-std::array<float,2>{0.896943629f, 0.562567174f},
-std::array<float,2>{0.206715971f, 0.0699167028f},
-std::array<float,2>{0.861086428f, 0.173215881f},
-std::array<float,2>{0.0689839125f, 0.730756402f},
-std::array<float,2>{0.743576467f, 0.908259988f},
-std::array<float,2>{0.269918025f, 0.469538629f},
-std::array<float,2>{0.979803264f, 0.43456769f},
-std::array<float,2>{0.135318547f, 0.958870649f},
-std::array<float,2>{0.518241644f, 0.645213783f},
-std::array<float,2>{0.463829517f, 0.197041839f},
-std::array<float,2>{0.650112033f, 0.0326850824f},
-std::array<float,2>{0.31986329f, 0.517519295f},
-std::array<float,2>{0.780704856f, 0.825028241f},
-std::array<float,2>{0.0595645234f, 0.317718655f},
-std::array<float,2>{0.500823975f, 0.381761491f},
-std::array<float,2>{0.449302912f, 0.97376138f},
-std::array<float,2>{0.999855995f, 0.676725686f},
-std::array<float,2>{0.145720765f, 0.242545947f},
-std::array<float,2>{0.751574397f, 0.0227613747f},
-std::array<float,2>{0.0368305482f, 0.55915761f},
-std::array<float,2>{0.63397938f, 0.86086005f},
-std::array<float,2>{0.331427783f, 0.344675243f},
-std::array<float,2>{0.879559219f, 0.254768699f},
-std::array<float,2>{0.198860765f, 0.805014789f},
-std::array<float,2>{0.577704489f, 0.621388614f},
-std::array<float,2>{0.43010053f, 0.0948535651f},
-std::array<float,2>{0.725818753f, 0.150884032f},
-std::array<float,2>{0.264712125f, 0.704005718f},
-std::array<float,2>{0.856145144f, 0.896888375f},
-std::array<float,2>{0.0933686346f, 0.445333064f},
-std::array<float,2>{0.681057394f, 0.335811168f},
-std::array<float,2>{0.369533598f, 0.839048028f},
-std::array<float,2>{0.810258925f, 0.511660993f},
-std::array<float,2>{0.0146231884f, 0.0579878353f},
-std::array<float,2>{0.965840042f, 0.206158668f},
-std::array<float,2>{0.183789656f, 0.636317968f},
-std::array<float,2>{0.531603694f, 0.94793582f},
-std::array<float,2>{0.475237072f, 0.409786969f},
-std::array<float,2>{0.820796967f, 0.484398127f},
-std::array<float,2>{0.0965820178f, 0.921923935f},
-std::array<float,2>{0.694804668f, 0.748768866f},
-std::array<float,2>{0.311341137f, 0.167017415f},
-std::array<float,2>{0.594906807f, 0.0895263404f},
-std::array<float,2>{0.392236561f, 0.590182006f},
-std::array<float,2>{0.926900744f, 0.756996751f},
-std::array<float,2>{0.235449031f, 0.311053902f},
-std::array<float,2>{0.628311992f, 0.415583193f},
-std::array<float,2>{0.338163793f, 0.93783623f},
-std::array<float,2>{0.760327876f, 0.627747416f},
-std::array<float,2>{0.044650197f, 0.215459108f},
-std::array<float,2>{0.985970676f, 0.0493684821f},
-std::array<float,2>{0.154230371f, 0.500003755f},
-std::array<float,2>{0.512607753f, 0.830643952f},
-std::array<float,2>{0.445191711f, 0.339723974f},
-std::array<float,2>{0.848226726f, 0.301841766f},
-std::array<float,2>{0.0812972635f, 0.759297073f},
-std::array<float,2>{0.72724098f, 0.581494927f},
-std::array<float,2>{0.253508955f, 0.0791685656f},
-std::array<float,2>{0.565487385f, 0.163700297f},
-std::array<float,2>{0.42685622f, 0.740228951f},
-std::array<float,2>{0.885375679f, 0.933601499f},
-std::array<float,2>{0.193959564f, 0.4930453f},
-std::array<float,2>{0.541775644f, 0.358789235f},
-std::array<float,2>{0.483861387f, 0.872878075f},
-std::array<float,2>{0.95414412f, 0.549217582f},
-std::array<float,2>{0.174122736f, 0.029480014f},
-std::array<float,2>{0.801197469f, 0.234395042f},
-std::array<float,2>{0.00680080149f, 0.684002519f},
-std::array<float,2>{0.676686943f, 0.976994991f},
-std::array<float,2>{0.362122566f, 0.390578836f},
-std::array<float,2>{0.931627452f, 0.443806201f},
-std::array<float,2>{0.24339284f, 0.904501319f},
-std::array<float,2>{0.607235849f, 0.716313839f},
-std::array<float,2>{0.400661379f, 0.14144662f},
-std::array<float,2>{0.695464671f, 0.108888872f},
-std::array<float,2>{0.300279945f, 0.611504316f},
-std::array<float,2>{0.817520618f, 0.804409087f},
-std::array<float,2>{0.105798185f, 0.265114456f},
-std::array<float,2>{0.617200017f, 0.478099853f},
-std::array<float,2>{0.383207083f, 0.916092038f},
-std::array<float,2>{0.920624435f, 0.722631335f},
-std::array<float,2>{0.229137048f, 0.183226645f},
-std::array<float,2>{0.83140099f, 0.0752336457f},
-std::array<float,2>{0.124896929f, 0.575314045f},
-std::array<float,2>{0.709073603f, 0.768977225f},
-std::array<float,2>{0.287367582f, 0.288697749f},
-std::array<float,2>{0.949412048f, 0.327964306f},
-std::array<float,2>{0.159779102f, 0.819364727f},
-std::array<float,2>{0.552020967f, 0.525292575f},
-std::array<float,2>{0.493816853f, 0.043680869f},
-std::array<float,2>{0.657812893f, 0.19428508f},
-std::array<float,2>{0.348083973f, 0.64979732f},
-std::array<float,2>{0.786922634f, 0.961299896f},
-std::array<float,2>{0.017119525f, 0.42380619f},
-std::array<float,2>{0.735709906f, 0.272234946f},
-std::array<float,2>{0.278277606f, 0.784912169f},
-std::array<float,2>{0.872969508f, 0.595601857f},
-std::array<float,2>{0.07286302f, 0.109745443f},
-std::array<float,2>{0.899744272f, 0.129841015f},
-std::array<float,2>{0.212647781f, 0.70308888f},
-std::array<float,2>{0.579152644f, 0.890511572f},
-std::array<float,2>{0.414325982f, 0.468508095f},
-std::array<float,2>{0.766023457f, 0.395809501f},
-std::array<float,2>{0.0499102436f, 0.994947791f},
-std::array<float,2>{0.641601861f, 0.662027597f},
-std::array<float,2>{0.32369107f, 0.227364153f},
-std::array<float,2>{0.524788558f, 0.00989531633f},
-std::array<float,2>{0.457470655f, 0.543647528f},
-std::array<float,2>{0.969515741f, 0.845597506f},
-std::array<float,2>{0.129654557f, 0.366273493f},
-std::array<float,2>{0.722425342f, 0.426473945f},
-std::array<float,2>{0.260934263f, 0.967709184f},
-std::array<float,2>{0.852723777f, 0.65522331f},
-std::array<float,2>{0.0897846073f, 0.187836379f},
-std::array<float,2>{0.875894606f, 0.0394842625f},
-std::array<float,2>{0.202332094f, 0.527489245f},
-std::array<float,2>{0.570840359f, 0.813442588f},
-std::array<float,2>{0.43419075f, 0.322376996f},
-std::array<float,2>{0.756936014f, 0.282763273f},
-std::array<float,2>{0.0349189155f, 0.771364808f},
-std::array<float,2>{0.636905193f, 0.57121712f},
-std::array<float,2>{0.333005697f, 0.0716456622f},
-std::array<float,2>{0.50668782f, 0.186558187f},
-std::array<float,2>{0.446329951f, 0.725199878f},
-std::array<float,2>{0.992662907f, 0.920611799f},
-std::array<float,2>{0.143636018f, 0.484265f},
-std::array<float,2>{0.599285185f, 0.35949856f},
-std::array<float,2>{0.397781909f, 0.850168049f},
-std::array<float,2>{0.922037899f, 0.541718066f},
-std::array<float,2>{0.24149169f, 0.0143001862f},
-std::array<float,2>{0.827420592f, 0.234045148f},
-std::array<float,2>{0.100984335f, 0.656805992f},
-std::array<float,2>{0.687702f, 0.999557316f},
-std::array<float,2>{0.307518333f, 0.391318232f},
-std::array<float,2>{0.962863386f, 0.463544667f},
-std::array<float,2>{0.182500407f, 0.884749532f},
-std::array<float,2>{0.536484897f, 0.695394218f},
-std::array<float,2>{0.469823748f, 0.125769809f},
-std::array<float,2>{0.686285138f, 0.116330266f},
-std::array<float,2>{0.371980608f, 0.597848594f},
-std::array<float,2>{0.807968318f, 0.788688958f},
-std::array<float,2>{0.00980275217f, 0.267883062f},
-std::array<float,2>{0.561932862f, 0.498250157f},
-std::array<float,2>{0.48861894f, 0.930216312f},
-std::array<float,2>{0.937829554f, 0.736027241f},
-std::array<float,2>{0.169403121f, 0.156315312f},
-std::array<float,2>{0.789658725f, 0.0852209479f},
-std::array<float,2>{0.0281867199f, 0.584381819f},
-std::array<float,2>{0.666234493f, 0.764452755f},
-std::array<float,2>{0.359095931f, 0.29897818f},
-std::array<float,2>{0.907838225f, 0.341402382f},
-std::array<float,2>{0.221075103f, 0.833816051f},
-std::array<float,2>{0.613261402f, 0.504652381f},
-std::array<float,2>{0.378652573f, 0.0532315858f},
-std::array<float,2>{0.712888241f, 0.212125182f},
-std::array<float,2>{0.293772638f, 0.632095277f},
-std::array<float,2>{0.838143587f, 0.942134142f},
-std::array<float,2>{0.111446962f, 0.419036031f},
-std::array<float,2>{0.652799368f, 0.257893294f},
-std::array<float,2>{0.315935075f, 0.797838628f},
-std::array<float,2>{0.776676238f, 0.616525531f},
-std::array<float,2>{0.0581785329f, 0.102776982f},
-std::array<float,2>{0.980825067f, 0.147218123f},
-std::array<float,2>{0.14013499f, 0.713900626f},
-std::array<float,2>{0.523005903f, 0.901213765f},
-std::array<float,2>{0.46806857f, 0.441256881f},
-std::array<float,2>{0.86337316f, 0.386372089f},
-std::array<float,2>{0.0643070787f, 0.981203675f},
-std::array<float,2>{0.747980058f, 0.679817319f},
-std::array<float,2>{0.26901406f, 0.241408527f},
-std::array<float,2>{0.587298274f, 0.0268016253f},
-std::array<float,2>{0.412163287f, 0.554119229f},
-std::array<float,2>{0.894462287f, 0.867767274f},
-std::array<float,2>{0.208550334f, 0.352536738f},
-std::array<float,2>{0.660996318f, 0.450835139f},
-std::array<float,2>{0.346413791f, 0.893343031f},
-std::array<float,2>{0.784626663f, 0.710421741f},
-std::array<float,2>{0.0205826201f, 0.153247952f},
-std::array<float,2>{0.946699321f, 0.100041494f},
-std::array<float,2>{0.163176894f, 0.619692743f},
-std::array<float,2>{0.549132943f, 0.811478496f},
-std::array<float,2>{0.499066055f, 0.250006199f},
-std::array<float,2>{0.835820198f, 0.351159722f},
-std::array<float,2>{0.117508978f, 0.864943743f},
-std::array<float,2>{0.705050826f, 0.554989278f},
-std::array<float,2>{0.28164494f, 0.0165189095f},
-std::array<float,2>{0.623075426f, 0.246234372f},
-std::array<float,2>{0.387904584f, 0.674802899f},
-std::array<float,2>{0.917510808f, 0.969400823f},
-std::array<float,2>{0.2342861f, 0.377324551f},
-std::array<float,2>{0.531113744f, 0.306122094f},
-std::array<float,2>{0.45369339f, 0.751143575f},
-std::array<float,2>{0.972930551f, 0.588698447f},
-std::array<float,2>{0.126845673f, 0.0908318609f},
-std::array<float,2>{0.772313416f, 0.170597181f},
-std::array<float,2>{0.0523410179f, 0.744577169f},
-std::array<float,2>{0.647807419f, 0.926203907f},
-std::array<float,2>{0.324722439f, 0.488567442f},
-std::array<float,2>{0.904961169f, 0.413298815f},
-std::array<float,2>{0.217607155f, 0.952173352f},
-std::array<float,2>{0.582727075f, 0.636910141f},
-std::array<float,2>{0.419163615f, 0.207142115f},
-std::array<float,2>{0.741456687f, 0.0612258427f},
-std::array<float,2>{0.275351286f, 0.515051901f},
-std::array<float,2>{0.868264318f, 0.843424261f},
-std::array<float,2>{0.0774999186f, 0.329896152f},
-std::array<float,2>{0.567837477f, 0.401103497f},
-std::array<float,2>{0.425029516f, 0.987936556f},
-std::array<float,2>{0.88913554f, 0.665316761f},
-std::array<float,2>{0.187928975f, 0.220739454f},
-std::array<float,2>{0.846914887f, 0.00095402298f},
-std::array<float,2>{0.0844294354f, 0.533251166f},
-std::array<float,2>{0.73285675f, 0.853720844f},
-std::array<float,2>{0.257429481f, 0.37282598f},
-std::array<float,2>{0.991035461f, 0.27613768f},
-std::array<float,2>{0.150731176f, 0.791693449f},
-std::array<float,2>{0.509941518f, 0.603028536f},
-std::array<float,2>{0.439457446f, 0.118376449f},
-std::array<float,2>{0.629625916f, 0.138750449f},
-std::array<float,2>{0.340075731f, 0.688274741f},
-std::array<float,2>{0.763860643f, 0.877971172f},
-std::array<float,2>{0.0397894494f, 0.460026056f},
-std::array<float,2>{0.701820254f, 0.315492392f},
-std::array<float,2>{0.302453041f, 0.823512077f},
-std::array<float,2>{0.81517446f, 0.522350132f},
-std::array<float,2>{0.104960464f, 0.0359628946f},
-std::array<float,2>{0.9363693f, 0.201175049f},
-std::array<float,2>{0.246118799f, 0.640941739f},
-std::array<float,2>{0.60500598f, 0.955827475f},
-std::array<float,2>{0.405322105f, 0.43011421f},
-std::array<float,2>{0.797837138f, 0.473721564f},
-std::array<float,2>{0.000974351598f, 0.912896335f},
-std::array<float,2>{0.673117161f, 0.726909041f},
-std::array<float,2>{0.365205228f, 0.178560853f},
-std::array<float,2>{0.543314815f, 0.0649484992f},
-std::array<float,2>{0.478797883f, 0.569878519f},
-std::array<float,2>{0.95713073f, 0.780547857f},
-std::array<float,2>{0.177156478f, 0.290808469f},
-std::array<float,2>{0.709720731f, 0.479424983f},
-std::array<float,2>{0.288026124f, 0.914195776f},
-std::array<float,2>{0.831750572f, 0.71977067f},
-std::array<float,2>{0.124057338f, 0.180448517f},
-std::array<float,2>{0.920394778f, 0.0772331804f},
-std::array<float,2>{0.228534013f, 0.577171922f},
-std::array<float,2>{0.617687345f, 0.767223477f},
-std::array<float,2>{0.38351807f, 0.286437541f},
-std::array<float,2>{0.786246002f, 0.325084209f},
-std::array<float,2>{0.0170217827f, 0.818078816f},
-std::array<float,2>{0.657247007f, 0.526329696f},
-std::array<float,2>{0.348447978f, 0.045046635f},
-std::array<float,2>{0.552722812f, 0.192816749f},
-std::array<float,2>{0.49363032f, 0.651500225f},
-std::array<float,2>{0.949727356f, 0.96475637f},
-std::array<float,2>{0.159450948f, 0.425566167f},
-std::array<float,2>{0.579641402f, 0.269866735f},
-std::array<float,2>{0.414780349f, 0.782295465f},
-std::array<float,2>{0.900262833f, 0.596357286f},
-std::array<float,2>{0.212129027f, 0.11158932f},
-std::array<float,2>{0.87248832f, 0.132596597f},
-std::array<float,2>{0.0724890381f, 0.699262202f},
-std::array<float,2>{0.736220896f, 0.887478113f},
-std::array<float,2>{0.277733833f, 0.4662413f},
-std::array<float,2>{0.968750119f, 0.398249805f},
-std::array<float,2>{0.129292741f, 0.99320823f},
-std::array<float,2>{0.525338411f, 0.663682759f},
-std::array<float,2>{0.457755327f, 0.228591725f},
-std::array<float,2>{0.642315567f, 0.00923231896f},
-std::array<float,2>{0.324155957f, 0.546184599f},
-std::array<float,2>{0.766254902f, 0.846727014f},
-std::array<float,2>{0.0506662056f, 0.364699215f},
-std::array<float,2>{0.512084901f, 0.416057318f},
-std::array<float,2>{0.444532305f, 0.940256953f},
-std::array<float,2>{0.985622585f, 0.626628458f},
-std::array<float,2>{0.153775603f, 0.217701569f},
-std::array<float,2>{0.75982374f, 0.0483754724f},
-std::array<float,2>{0.0444200188f, 0.502585173f},
-std::array<float,2>{0.628840625f, 0.829713583f},
-std::array<float,2>{0.33849898f, 0.336011618f},
-std::array<float,2>{0.884878695f, 0.303148836f},
-std::array<float,2>{0.193485811f, 0.760386884f},
-std::array<float,2>{0.566364348f, 0.579613209f},
-std::array<float,2>{0.427631825f, 0.0816753581f},
-std::array<float,2>{0.726837218f, 0.160544902f},
-std::array<float,2>{0.253174543f, 0.741761029f},
-std::array<float,2>{0.847669542f, 0.935644686f},
-std::array<float,2>{0.0817942396f, 0.494526982f},
-std::array<float,2>{0.676159799f, 0.355853707f},
-std::array<float,2>{0.361762792f, 0.873415351f},
-std::array<float,2>{0.801471472f, 0.548360765f},
-std::array<float,2>{0.00610383879f, 0.0282440744f},
-std::array<float,2>{0.954796553f, 0.238240644f},
-std::array<float,2>{0.174708202f, 0.686155081f},
-std::array<float,2>{0.541082799f, 0.979014874f},
-std::array<float,2>{0.484111339f, 0.387371421f},
-std::array<float,2>{0.818155766f, 0.442599386f},
-std::array<float,2>{0.106369488f, 0.9025563f},
-std::array<float,2>{0.695909381f, 0.717033565f},
-std::array<float,2>{0.300395727f, 0.143585309f},
-std::array<float,2>{0.60686177f, 0.10565833f},
-std::array<float,2>{0.401333213f, 0.609832108f},
-std::array<float,2>{0.930706382f, 0.802567601f},
-std::array<float,2>{0.244038925f, 0.261737794f},
-std::array<float,2>{0.634626508f, 0.380803674f},
-std::array<float,2>{0.33167091f, 0.975548863f},
-std::array<float,2>{0.75110507f, 0.677968621f},
-std::array<float,2>{0.0366040543f, 0.244953439f},
-std::array<float,2>{0.999274492f, 0.0211213306f},
-std::array<float,2>{0.146128416f, 0.561331928f},
-std::array<float,2>{0.500428975f, 0.861887515f},
-std::array<float,2>{0.450016946f, 0.346339822f},
-std::array<float,2>{0.855932951f, 0.256817043f},
-std::array<float,2>{0.0929322168f, 0.807900071f},
-std::array<float,2>{0.72652626f, 0.624727666f},
-std::array<float,2>{0.265508145f, 0.0962955579f},
-std::array<float,2>{0.577484548f, 0.149842441f},
-std::array<float,2>{0.430194169f, 0.705823779f},
-std::array<float,2>{0.878915727f, 0.896451116f},
-std::array<float,2>{0.198331043f, 0.44896099f},
-std::array<float,2>{0.531871021f, 0.333511382f},
-std::array<float,2>{0.474701405f, 0.836091101f},
-std::array<float,2>{0.966648936f, 0.508584797f},
-std::array<float,2>{0.184102401f, 0.0565757081f},
-std::array<float,2>{0.80971384f, 0.204429567f},
-std::array<float,2>{0.013838416f, 0.633549094f},
-std::array<float,2>{0.681544065f, 0.946529508f},
-std::array<float,2>{0.370108366f, 0.406636715f},
-std::array<float,2>{0.927250087f, 0.486684382f},
-std::array<float,2>{0.235996529f, 0.924253583f},
-std::array<float,2>{0.595571935f, 0.747496665f},
-std::array<float,2>{0.391814947f, 0.165734172f},
-std::array<float,2>{0.695065558f, 0.0864523947f},
-std::array<float,2>{0.310827374f, 0.592823625f},
-std::array<float,2>{0.820912421f, 0.754496813f},
-std::array<float,2>{0.0957433507f, 0.308751583f},
-std::array<float,2>{0.614924788f, 0.454964846f},
-std::array<float,2>{0.379333019f, 0.88095206f},
-std::array<float,2>{0.913571894f, 0.694451451f},
-std::array<float,2>{0.225681543f, 0.135373086f},
-std::array<float,2>{0.840815127f, 0.122961104f},
-std::array<float,2>{0.116716996f, 0.606409371f},
-std::array<float,2>{0.717624187f, 0.793374598f},
-std::array<float,2>{0.290648192f, 0.278858066f},
-std::array<float,2>{0.942170084f, 0.370720595f},
-std::array<float,2>{0.167610258f, 0.856973767f},
-std::array<float,2>{0.556838334f, 0.536706865f},
-std::array<float,2>{0.487609774f, 0.00777362054f},
-std::array<float,2>{0.670545936f, 0.223053485f},
-std::array<float,2>{0.352148145f, 0.668215036f},
-std::array<float,2>{0.79503262f, 0.991173208f},
-std::array<float,2>{0.0243590977f, 0.404554099f},
-std::array<float,2>{0.743860543f, 0.296689391f},
-std::array<float,2>{0.27041921f, 0.777045906f},
-std::array<float,2>{0.860510349f, 0.565390706f},
-std::array<float,2>{0.0684097409f, 0.0668066964f},
-std::array<float,2>{0.897347629f, 0.175290719f},
-std::array<float,2>{0.206506938f, 0.733810544f},
-std::array<float,2>{0.590655088f, 0.907723665f},
-std::array<float,2>{0.409076959f, 0.472400159f},
-std::array<float,2>{0.780762196f, 0.43656376f},
-std::array<float,2>{0.0588973463f, 0.960042596f},
-std::array<float,2>{0.64982748f, 0.64783591f},
-std::array<float,2>{0.319504738f, 0.198991209f},
-std::array<float,2>{0.517995059f, 0.0335696973f},
-std::array<float,2>{0.462939113f, 0.519114077f},
-std::array<float,2>{0.980004013f, 0.827340424f},
-std::array<float,2>{0.134998098f, 0.319862723f},
-std::array<float,2>{0.690555632f, 0.393689692f},
-std::array<float,2>{0.305286914f, 0.997775912f},
-std::array<float,2>{0.82452637f, 0.658683538f},
-std::array<float,2>{0.0978786647f, 0.232335031f},
-std::array<float,2>{0.923970103f, 0.0128699662f},
-std::array<float,2>{0.238760665f, 0.540464282f},
-std::array<float,2>{0.600959837f, 0.848149955f},
-std::array<float,2>{0.395107001f, 0.362717628f},
-std::array<float,2>{0.804706454f, 0.266351312f},
-std::array<float,2>{0.00790391304f, 0.785875082f},
-std::array<float,2>{0.684315562f, 0.599896371f},
-std::array<float,2>{0.373151541f, 0.114120364f},
-std::array<float,2>{0.538060009f, 0.127738774f},
-std::array<float,2>{0.471465945f, 0.697434604f},
-std::array<float,2>{0.963270068f, 0.885633051f},
-std::array<float,2>{0.179728597f, 0.462810278f},
-std::array<float,2>{0.573617637f, 0.321989834f},
-std::array<float,2>{0.436569393f, 0.815248668f},
-std::array<float,2>{0.878602803f, 0.530962825f},
-std::array<float,2>{0.200706214f, 0.0415211841f},
-std::array<float,2>{0.854819119f, 0.190934673f},
-std::array<float,2>{0.0870091766f, 0.652960539f},
-std::array<float,2>{0.719363511f, 0.965471983f},
-std::array<float,2>{0.258613795f, 0.429314762f},
-std::array<float,2>{0.994844317f, 0.482131213f},
-std::array<float,2>{0.141264543f, 0.919584394f},
-std::array<float,2>{0.50578016f, 0.723008156f},
-std::array<float,2>{0.448988199f, 0.185194969f},
-std::array<float,2>{0.639342368f, 0.0734102502f},
-std::array<float,2>{0.335062891f, 0.572760224f},
-std::array<float,2>{0.755462527f, 0.772407889f},
-std::array<float,2>{0.0315033495f, 0.284925222f},
-std::array<float,2>{0.519842446f, 0.437991828f},
-std::array<float,2>{0.465098113f, 0.899537742f},
-std::array<float,2>{0.983406305f, 0.712691724f},
-std::array<float,2>{0.137612522f, 0.14483884f},
-std::array<float,2>{0.774061024f, 0.103616364f},
-std::array<float,2>{0.0562629923f, 0.614637494f},
-std::array<float,2>{0.655248344f, 0.799883723f},
-std::array<float,2>{0.313656867f, 0.261360735f},
-std::array<float,2>{0.891918898f, 0.354306042f},
-std::array<float,2>{0.210924551f, 0.869639874f},
-std::array<float,2>{0.589171171f, 0.551453948f},
-std::array<float,2>{0.410169929f, 0.0245816931f},
-std::array<float,2>{0.74865526f, 0.239598006f},
-std::array<float,2>{0.265669197f, 0.682216525f},
-std::array<float,2>{0.86710304f, 0.982491732f},
-std::array<float,2>{0.0659710839f, 0.383968562f},
-std::array<float,2>{0.665903151f, 0.298045874f},
-std::array<float,2>{0.35740599f, 0.763284683f},
-std::array<float,2>{0.791522145f, 0.582079828f},
-std::array<float,2>{0.0307546649f, 0.0833040178f},
-std::array<float,2>{0.940251708f, 0.159557998f},
-std::array<float,2>{0.17019482f, 0.738032937f},
-std::array<float,2>{0.558653116f, 0.932129502f},
-std::array<float,2>{0.490828574f, 0.497523665f},
-std::array<float,2>{0.836978555f, 0.42098847f},
-std::array<float,2>{0.110919766f, 0.944608152f},
-std::array<float,2>{0.713922799f, 0.63022995f},
-std::array<float,2>{0.296735555f, 0.213467672f},
-std::array<float,2>{0.611160219f, 0.0517343916f},
-std::array<float,2>{0.375848234f, 0.507767379f},
-std::array<float,2>{0.909607828f, 0.83480525f},
-std::array<float,2>{0.220682696f, 0.341931343f},
-std::array<float,2>{0.646032035f, 0.491203368f},
-std::array<float,2>{0.327222526f, 0.929569066f},
-std::array<float,2>{0.769575059f, 0.743953168f},
-std::array<float,2>{0.0538278669f, 0.169542715f},
-std::array<float,2>{0.97633642f, 0.0924134254f},
-std::array<float,2>{0.127819896f, 0.586471796f},
-std::array<float,2>{0.528308332f, 0.753754914f},
-std::array<float,2>{0.45658505f, 0.307998627f},
-std::array<float,2>{0.870015383f, 0.33171615f},
-std::array<float,2>{0.076105915f, 0.841780365f},
-std::array<float,2>{0.739969969f, 0.513273895f},
-std::array<float,2>{0.27604121f, 0.059652295f},
-std::array<float,2>{0.585180759f, 0.210160658f},
-std::array<float,2>{0.420562744f, 0.639651835f},
-std::array<float,2>{0.904193282f, 0.949577987f},
-std::array<float,2>{0.21498394f, 0.41043207f},
-std::array<float,2>{0.547406495f, 0.252149701f},
-std::array<float,2>{0.496426076f, 0.80953306f},
-std::array<float,2>{0.948876739f, 0.618902206f},
-std::array<float,2>{0.161421254f, 0.0984407887f},
-std::array<float,2>{0.781357288f, 0.154664204f},
-std::array<float,2>{0.02160367f, 0.708011448f},
-std::array<float,2>{0.662483394f, 0.890897155f},
-std::array<float,2>{0.344057471f, 0.452477932f},
-std::array<float,2>{0.915624678f, 0.375526369f},
-std::array<float,2>{0.230854079f, 0.971538663f},
-std::array<float,2>{0.622596979f, 0.673074484f},
-std::array<float,2>{0.389706612f, 0.249654204f},
-std::array<float,2>{0.705484271f, 0.0189329088f},
-std::array<float,2>{0.284240991f, 0.558451414f},
-std::array<float,2>{0.832224965f, 0.865259528f},
-std::array<float,2>{0.121026926f, 0.349128842f},
-std::array<float,2>{0.602548301f, 0.432088792f},
-std::array<float,2>{0.40264219f, 0.953412831f},
-std::array<float,2>{0.93388015f, 0.643863797f},
-std::array<float,2>{0.248442516f, 0.200670213f},
-std::array<float,2>{0.813083887f, 0.0373576581f},
-std::array<float,2>{0.1017932f, 0.520057499f},
-std::array<float,2>{0.700641394f, 0.821165383f},
-std::array<float,2>{0.303874999f, 0.314035058f},
-std::array<float,2>{0.960496962f, 0.291077286f},
-std::array<float,2>{0.179106519f, 0.77770412f},
-std::array<float,2>{0.545568645f, 0.567379594f},
-std::array<float,2>{0.477324337f, 0.0633198097f},
-std::array<float,2>{0.675203145f, 0.177508771f},
-std::array<float,2>{0.365539551f, 0.73040241f},
-std::array<float,2>{0.799897075f, 0.910293341f},
-std::array<float,2>{0.00286105066f, 0.475227088f},
-std::array<float,2>{0.732037723f, 0.373357296f},
-std::array<float,2>{0.254830509f, 0.852751434f},
-std::array<float,2>{0.844557941f, 0.531941295f},
-std::array<float,2>{0.0828552172f, 0.00382049312f},
-std::array<float,2>{0.888154149f, 0.218942165f},
-std::array<float,2>{0.191146448f, 0.667294502f},
-std::array<float,2>{0.569863439f, 0.98608464f},
-std::array<float,2>{0.422136009f, 0.399312019f},
-std::array<float,2>{0.763462722f, 0.458960593f},
-std::array<float,2>{0.0427630618f, 0.875274956f},
-std::array<float,2>{0.632105172f, 0.690682352f},
-std::array<float,2>{0.342615992f, 0.137033135f},
-std::array<float,2>{0.509639025f, 0.119529597f},
-std::array<float,2>{0.437765956f, 0.60383451f},
-std::array<float,2>{0.988962114f, 0.790013313f},
-std::array<float,2>{0.149328962f, 0.275117487f},
-std::array<float,2>{0.736620784f, 0.467893332f},
-std::array<float,2>{0.279696971f, 0.889734089f},
-std::array<float,2>{0.873048723f, 0.702301323f},
-std::array<float,2>{0.0711873844f, 0.129248723f},
-std::array<float,2>{0.900400639f, 0.110155225f},
-std::array<float,2>{0.214352831f, 0.595079064f},
-std::array<float,2>{0.58008498f, 0.784330547f},
-std::array<float,2>{0.416401923f, 0.271622092f},
-std::array<float,2>{0.768271029f, 0.366927445f},
-std::array<float,2>{0.047097981f, 0.844771802f},
-std::array<float,2>{0.643974662f, 0.543179035f},
-std::array<float,2>{0.322091609f, 0.010684656f},
-std::array<float,2>{0.52672863f, 0.226937249f},
-std::array<float,2>{0.46075812f, 0.661562145f},
-std::array<float,2>{0.972294033f, 0.994320154f},
-std::array<float,2>{0.132517502f, 0.396178961f},
-std::array<float,2>{0.620955527f, 0.288158715f},
-std::array<float,2>{0.385582745f, 0.769365788f},
-std::array<float,2>{0.919202983f, 0.576129794f},
-std::array<float,2>{0.227348343f, 0.0761120841f},
-std::array<float,2>{0.828750312f, 0.182719544f},
-std::array<float,2>{0.122947857f, 0.722153664f},
-std::array<float,2>{0.708050907f, 0.916847825f},
-std::array<float,2>{0.286098719f, 0.477682352f},
-std::array<float,2>{0.952379644f, 0.423151344f},
-std::array<float,2>{0.157666326f, 0.96153152f},
-std::array<float,2>{0.554091215f, 0.650244474f},
-std::array<float,2>{0.495982945f, 0.193383649f},
-std::array<float,2>{0.659502268f, 0.043428313f},
-std::array<float,2>{0.350880742f, 0.524750412f},
-std::array<float,2>{0.787295401f, 0.820285439f},
-std::array<float,2>{0.0179066658f, 0.32749626f},
-std::array<float,2>{0.54040879f, 0.389762163f},
-std::array<float,2>{0.480971277f, 0.977141142f},
-std::array<float,2>{0.955420911f, 0.684192836f},
-std::array<float,2>{0.17231518f, 0.235201076f},
-std::array<float,2>{0.803213298f, 0.0301697385f},
-std::array<float,2>{0.00571650779f, 0.549438596f},
-std::array<float,2>{0.678021371f, 0.872307241f},
-std::array<float,2>{0.361169398f, 0.359336674f},
-std::array<float,2>{0.932353735f, 0.26526472f},
-std::array<float,2>{0.244201422f, 0.803759038f},
-std::array<float,2>{0.608372331f, 0.612105966f},
-std::array<float,2>{0.398884475f, 0.108511835f},
-std::array<float,2>{0.697907448f, 0.141001314f},
-std::array<float,2>{0.298597783f, 0.716284454f},
-std::array<float,2>{0.818590999f, 0.905085146f},
-std::array<float,2>{0.108925328f, 0.444306821f},
-std::array<float,2>{0.62513572f, 0.33887431f},
-std::array<float,2>{0.336404979f, 0.830085814f},
-std::array<float,2>{0.758979321f, 0.500741243f},
-std::array<float,2>{0.0455953255f, 0.0491836891f},
-std::array<float,2>{0.986769259f, 0.215281054f},
-std::array<float,2>{0.155123547f, 0.627191901f},
-std::array<float,2>{0.514269829f, 0.938385665f},
-std::array<float,2>{0.442344666f, 0.415085077f},
-std::array<float,2>{0.850661516f, 0.492634177f},
-std::array<float,2>{0.078843452f, 0.934531569f},
-std::array<float,2>{0.730104923f, 0.739500165f},
-std::array<float,2>{0.251489192f, 0.163136885f},
-std::array<float,2>{0.563896656f, 0.0797177181f},
-std::array<float,2>{0.428313762f, 0.581668675f},
-std::array<float,2>{0.883573532f, 0.758919656f},
-std::array<float,2>{0.19310011f, 0.302619249f},
-std::array<float,2>{0.682270408f, 0.409205317f},
-std::array<float,2>{0.368493199f, 0.947629571f},
-std::array<float,2>{0.811856866f, 0.636012256f},
-std::array<float,2>{0.0123232454f, 0.206574619f},
-std::array<float,2>{0.968014181f, 0.0583710372f},
-std::array<float,2>{0.18735908f, 0.511206806f},
-std::array<float,2>{0.534864306f, 0.839557767f},
-std::array<float,2>{0.473087966f, 0.33519426f},
-std::array<float,2>{0.822723687f, 0.310995549f},
-std::array<float,2>{0.0940317959f, 0.757763326f},
-std::array<float,2>{0.692823231f, 0.590542912f},
-std::array<float,2>{0.310544848f, 0.0892642736f},
-std::array<float,2>{0.595745981f, 0.167782187f},
-std::array<float,2>{0.393592596f, 0.748069882f},
-std::array<float,2>{0.92818594f, 0.922395229f},
-std::array<float,2>{0.23702921f, 0.485161006f},
-std::array<float,2>{0.503485203f, 0.343894124f},
-std::array<float,2>{0.452362388f, 0.860545993f},
-std::array<float,2>{0.997540534f, 0.558624327f},
-std::array<float,2>{0.147880986f, 0.0230187364f},
-std::array<float,2>{0.752995491f, 0.243019089f},
-std::array<float,2>{0.0388650745f, 0.676166654f},
-std::array<float,2>{0.636569619f, 0.97420305f},
-std::array<float,2>{0.32979393f, 0.381336272f},
-std::array<float,2>{0.881401658f, 0.446261019f},
-std::array<float,2>{0.195537493f, 0.897132754f},
-std::array<float,2>{0.575910091f, 0.703230262f},
-std::array<float,2>{0.431781411f, 0.150735661f},
-std::array<float,2>{0.723415911f, 0.0953792185f},
-std::array<float,2>{0.262087345f, 0.621986866f},
-std::array<float,2>{0.85927546f, 0.805326819f},
-std::array<float,2>{0.0914620608f, 0.253937483f},
-std::array<float,2>{0.592272699f, 0.468786418f},
-std::array<float,2>{0.407223284f, 0.90870434f},
-std::array<float,2>{0.895072699f, 0.731084466f},
-std::array<float,2>{0.204798877f, 0.173625261f},
-std::array<float,2>{0.863177776f, 0.0693652406f},
-std::array<float,2>{0.0670641661f, 0.563322783f},
-std::array<float,2>{0.745023966f, 0.775225997f},
-std::array<float,2>{0.272651792f, 0.294372797f},
-std::array<float,2>{0.978280544f, 0.318143904f},
-std::array<float,2>{0.133969232f, 0.824407279f},
-std::array<float,2>{0.517212629f, 0.516959906f},
-std::array<float,2>{0.461306632f, 0.0328057222f},
-std::array<float,2>{0.651554763f, 0.196320564f},
-std::array<float,2>{0.318187833f, 0.644576252f},
-std::array<float,2>{0.77793628f, 0.958163023f},
-std::array<float,2>{0.0608058125f, 0.433842033f},
-std::array<float,2>{0.715422094f, 0.280350804f},
-std::array<float,2>{0.291435659f, 0.7959795f},
-std::array<float,2>{0.843153059f, 0.609090805f},
-std::array<float,2>{0.113438591f, 0.124643877f},
-std::array<float,2>{0.910542667f, 0.133634001f},
-std::array<float,2>{0.224003434f, 0.691529155f},
-std::array<float,2>{0.616051078f, 0.880488813f},
-std::array<float,2>{0.381068081f, 0.455303758f},
-std::array<float,2>{0.793713748f, 0.404291302f},
-std::array<float,2>{0.0261512063f, 0.988874018f},
-std::array<float,2>{0.668171167f, 0.671476007f},
-std::array<float,2>{0.355222017f, 0.22636953f},
-std::array<float,2>{0.555200338f, 0.0047619883f},
-std::array<float,2>{0.485186994f, 0.5371539f},
-std::array<float,2>{0.944462895f, 0.859092832f},
-std::array<float,2>{0.164195538f, 0.368688911f},
-std::array<float,2>{0.713358045f, 0.418089271f},
-std::array<float,2>{0.295458615f, 0.942604899f},
-std::array<float,2>{0.836793423f, 0.631364048f},
-std::array<float,2>{0.110051259f, 0.211809531f},
-std::array<float,2>{0.908748865f, 0.0542043261f},
-std::array<float,2>{0.219239697f, 0.505413234f},
-std::array<float,2>{0.610284448f, 0.832214892f},
-std::array<float,2>{0.376321703f, 0.34046948f},
-std::array<float,2>{0.792917669f, 0.299959064f},
-std::array<float,2>{0.0294181611f, 0.765101314f},
-std::array<float,2>{0.665002286f, 0.585804462f},
-std::array<float,2>{0.355832666f, 0.0840093568f},
-std::array<float,2>{0.559727669f, 0.158172294f},
-std::array<float,2>{0.492149949f, 0.734800994f},
-std::array<float,2>{0.941146433f, 0.931291342f},
-std::array<float,2>{0.171810538f, 0.499227315f},
-std::array<float,2>{0.588043809f, 0.353078723f},
-std::array<float,2>{0.41115579f, 0.868617654f},
-std::array<float,2>{0.89066124f, 0.553192198f},
-std::array<float,2>{0.209694192f, 0.0260096416f},
-std::array<float,2>{0.865237713f, 0.240927756f},
-std::array<float,2>{0.0653823763f, 0.681239545f},
-std::array<float,2>{0.749887824f, 0.982360542f},
-std::array<float,2>{0.267493278f, 0.385054827f},
-std::array<float,2>{0.983270168f, 0.439619273f},
-std::array<float,2>{0.138580531f, 0.902274489f},
-std::array<float,2>{0.521009028f, 0.713490784f},
-std::array<float,2>{0.46673277f, 0.147678643f},
-std::array<float,2>{0.655844033f, 0.102383189f},
-std::array<float,2>{0.31283316f, 0.615863919f},
-std::array<float,2>{0.77487272f, 0.798602045f},
-std::array<float,2>{0.0547319651f, 0.25973168f},
-std::array<float,2>{0.504725754f, 0.482899934f},
-std::array<float,2>{0.447684765f, 0.921499789f},
-std::array<float,2>{0.995363057f, 0.726299584f},
-std::array<float,2>{0.141837269f, 0.185571238f},
-std::array<float,2>{0.754001677f, 0.0707222745f},
-std::array<float,2>{0.0325289443f, 0.571653724f},
-std::array<float,2>{0.64021951f, 0.770016193f},
-std::array<float,2>{0.333990753f, 0.281581342f},
-std::array<float,2>{0.87729311f, 0.323944122f},
-std::array<float,2>{0.200116307f, 0.813680351f},
-std::array<float,2>{0.57233876f, 0.528771698f},
-std::array<float,2>{0.435955256f, 0.0407381207f},
-std::array<float,2>{0.720200598f, 0.189441398f},
-std::array<float,2>{0.259314269f, 0.656100154f},
-std::array<float,2>{0.854039252f, 0.968218625f},
-std::array<float,2>{0.086433813f, 0.427188843f},
-std::array<float,2>{0.685019016f, 0.268557101f},
-std::array<float,2>{0.374195039f, 0.787322462f},
-std::array<float,2>{0.805973411f, 0.599179924f},
-std::array<float,2>{0.0088641597f, 0.116128966f},
-std::array<float,2>{0.964122772f, 0.126896232f},
-std::array<float,2>{0.180730715f, 0.696623445f},
-std::array<float,2>{0.538344324f, 0.882902443f},
-std::array<float,2>{0.472509325f, 0.464204311f},
-std::array<float,2>{0.825260997f, 0.392005295f},
-std::array<float,2>{0.099384591f, 0.998713136f},
-std::array<float,2>{0.690298855f, 0.657642365f},
-std::array<float,2>{0.306608379f, 0.233068645f},
-std::array<float,2>{0.599817395f, 0.0146672046f},
-std::array<float,2>{0.39648363f, 0.542069793f},
-std::array<float,2>{0.924992681f, 0.851398706f},
-std::array<float,2>{0.239579827f, 0.361145347f},
-std::array<float,2>{0.631610811f, 0.45952785f},
-std::array<float,2>{0.343262345f, 0.877053499f},
-std::array<float,2>{0.76174587f, 0.688492537f},
-std::array<float,2>{0.0414212011f, 0.140265882f},
-std::array<float,2>{0.989913166f, 0.117579542f},
-std::array<float,2>{0.15006642f, 0.601823747f},
-std::array<float,2>{0.508543313f, 0.792686045f},
-std::array<float,2>{0.439089984f, 0.276901454f},
-std::array<float,2>{0.845196962f, 0.371115595f},
-std::array<float,2>{0.0838305652f, 0.854520261f},
-std::array<float,2>{0.731312871f, 0.534789443f},
-std::array<float,2>{0.255583614f, 0.00148632575f},
-std::array<float,2>{0.569130719f, 0.221886799f},
-std::array<float,2>{0.423167259f, 0.664168954f},
-std::array<float,2>{0.887118936f, 0.986952722f},
-std::array<float,2>{0.190016851f, 0.402141005f},
-std::array<float,2>{0.546404779f, 0.289678603f},
-std::array<float,2>{0.477741867f, 0.779399276f},
-std::array<float,2>{0.959096491f, 0.568609059f},
-std::array<float,2>{0.177958235f, 0.0661995709f},
-std::array<float,2>{0.799125195f, 0.179454178f},
-std::array<float,2>{0.00322551373f, 0.72764045f},
-std::array<float,2>{0.673916817f, 0.913964152f},
-std::array<float,2>{0.366910905f, 0.472887635f},
-std::array<float,2>{0.934991062f, 0.431356549f},
-std::array<float,2>{0.249546006f, 0.956974745f},
-std::array<float,2>{0.602018595f, 0.641902506f},
-std::array<float,2>{0.403825551f, 0.202614263f},
-std::array<float,2>{0.699498951f, 0.0364389531f},
-std::array<float,2>{0.303052783f, 0.522586107f},
-std::array<float,2>{0.813576341f, 0.822362006f},
-std::array<float,2>{0.103013471f, 0.314588517f},
-std::array<float,2>{0.621236444f, 0.378138006f},
-std::array<float,2>{0.389317304f, 0.970034838f},
-std::array<float,2>{0.914238691f, 0.675156653f},
-std::array<float,2>{0.23237212f, 0.2477189f},
-std::array<float,2>{0.83377105f, 0.0173673276f},
-std::array<float,2>{0.119395643f, 0.555924177f},
-std::array<float,2>{0.706795692f, 0.864234924f},
-std::array<float,2>{0.283902884f, 0.350144565f},
-std::array<float,2>{0.948197067f, 0.251482666f},
-std::array<float,2>{0.160349473f, 0.811921418f},
-std::array<float,2>{0.548456788f, 0.621008396f},
-std::array<float,2>{0.497285813f, 0.10135451f},
-std::array<float,2>{0.663538456f, 0.153485939f},
-std::array<float,2>{0.345559448f, 0.709140122f},
-std::array<float,2>{0.782882273f, 0.89366287f},
-std::array<float,2>{0.0231100451f, 0.449828744f},
-std::array<float,2>{0.739079237f, 0.329079658f},
-std::array<float,2>{0.276887745f, 0.842027783f},
-std::array<float,2>{0.870983899f, 0.513810515f},
-std::array<float,2>{0.0749279037f, 0.062176954f},
-std::array<float,2>{0.902456582f, 0.20878911f},
-std::array<float,2>{0.216578573f, 0.638052821f},
-std::array<float,2>{0.584397495f, 0.952087104f},
-std::array<float,2>{0.421235442f, 0.412802547f},
-std::array<float,2>{0.771193981f, 0.490015209f},
-std::array<float,2>{0.0530914925f, 0.927374423f},
-std::array<float,2>{0.644805491f, 0.746038973f},
-std::array<float,2>{0.326557934f, 0.171092257f},
-std::array<float,2>{0.52915448f, 0.0906809941f},
-std::array<float,2>{0.455565512f, 0.589327514f},
-std::array<float,2>{0.975397825f, 0.750588f},
-std::array<float,2>{0.12875469f, 0.305442363f},
-std::array<float,2>{0.72857058f, 0.495740443f},
-std::array<float,2>{0.250872672f, 0.937147558f},
-std::array<float,2>{0.850403845f, 0.740679979f},
-std::array<float,2>{0.0792071447f, 0.162066311f},
-std::array<float,2>{0.88458246f, 0.0809503123f},
-std::array<float,2>{0.191909716f, 0.578647852f},
-std::array<float,2>{0.563381016f, 0.761052132f},
-std::array<float,2>{0.429451913f, 0.303995788f},
-std::array<float,2>{0.757978737f, 0.337395728f},
-std::array<float,2>{0.046727892f, 0.828592777f},
-std::array<float,2>{0.626719713f, 0.503140688f},
-std::array<float,2>{0.337702841f, 0.0475271046f},
-std::array<float,2>{0.515028179f, 0.218204185f},
-std::array<float,2>{0.443047166f, 0.625009835f},
-std::array<float,2>{0.987307072f, 0.940504193f},
-std::array<float,2>{0.155505374f, 0.417951912f},
-std::array<float,2>{0.608803332f, 0.263134956f},
-std::array<float,2>{0.400067687f, 0.80100441f},
-std::array<float,2>{0.933009267f, 0.610600412f},
-std::array<float,2>{0.245601386f, 0.106618702f},
-std::array<float,2>{0.820041597f, 0.143191546f},
-std::array<float,2>{0.107748874f, 0.717804015f},
-std::array<float,2>{0.698760509f, 0.903375447f},
-std::array<float,2>{0.2969203f, 0.441717714f},
-std::array<float,2>{0.956406593f, 0.387912601f},
-std::array<float,2>{0.173563093f, 0.9801476f},
-std::array<float,2>{0.539494336f, 0.687128484f},
-std::array<float,2>{0.482085615f, 0.236815408f},
-std::array<float,2>{0.678753376f, 0.0291424561f},
-std::array<float,2>{0.360177338f, 0.54780221f},
-std::array<float,2>{0.804064929f, 0.874510288f},
-std::array<float,2>{0.00395829976f, 0.35666135f},
-std::array<float,2>{0.553456903f, 0.424594313f},
-std::array<float,2>{0.494872779f, 0.963429213f},
-std::array<float,2>{0.952080071f, 0.650824249f},
-std::array<float,2>{0.157061994f, 0.191439897f},
-std::array<float,2>{0.788706243f, 0.0459774397f},
-std::array<float,2>{0.0193128996f, 0.526783943f},
-std::array<float,2>{0.658345103f, 0.816622078f},
-std::array<float,2>{0.349697202f, 0.325755864f},
-std::array<float,2>{0.918455064f, 0.285899848f},
-std::array<float,2>{0.228457779f, 0.766519368f},
-std::array<float,2>{0.619146883f, 0.576517344f},
-std::array<float,2>{0.386100769f, 0.0762116238f},
-std::array<float,2>{0.707455397f, 0.181051806f},
-std::array<float,2>{0.287027031f, 0.719688296f},
-std::array<float,2>{0.829315603f, 0.915470123f},
-std::array<float,2>{0.121813729f, 0.480163842f},
-std::array<float,2>{0.642603159f, 0.363464981f},
-std::array<float,2>{0.320374668f, 0.846176922f},
-std::array<float,2>{0.768667042f, 0.545462549f},
-std::array<float,2>{0.0485886f, 0.00828859489f},
-std::array<float,2>{0.9709602f, 0.229692504f},
-std::array<float,2>{0.131473675f, 0.662343979f},
-std::array<float,2>{0.525989473f, 0.992219567f},
-std::array<float,2>{0.459781975f, 0.397352844f},
-std::array<float,2>{0.874177158f, 0.465163618f},
-std::array<float,2>{0.0717343614f, 0.88773936f},
-std::array<float,2>{0.738152385f, 0.700718164f},
-std::array<float,2>{0.280442029f, 0.131427914f},
-std::array<float,2>{0.58166039f, 0.11231222f},
-std::array<float,2>{0.416994631f, 0.596873939f},
-std::array<float,2>{0.901436746f, 0.782092392f},
-std::array<float,2>{0.213809177f, 0.27056849f},
-std::array<float,2>{0.669009864f, 0.405380189f},
-std::array<float,2>{0.353543222f, 0.991601527f},
-std::array<float,2>{0.794882476f, 0.669000149f},
-std::array<float,2>{0.0268506296f, 0.224197388f},
-std::array<float,2>{0.944184065f, 0.00674706185f},
-std::array<float,2>{0.165204883f, 0.535228789f},
-std::array<float,2>{0.556324244f, 0.855591774f},
-std::array<float,2>{0.486164033f, 0.370024681f},
-std::array<float,2>{0.842444897f, 0.277893126f},
-std::array<float,2>{0.115090884f, 0.794070065f},
-std::array<float,2>{0.715918362f, 0.606851935f},
-std::array<float,2>{0.292627692f, 0.121269926f},
-std::array<float,2>{0.616732061f, 0.135846823f},
-std::array<float,2>{0.382336855f, 0.693416655f},
-std::array<float,2>{0.91187799f, 0.881983757f},
-std::array<float,2>{0.223014683f, 0.453243256f},
-std::array<float,2>{0.515897214f, 0.318963856f},
-std::array<float,2>{0.462768048f, 0.826870978f},
-std::array<float,2>{0.976859212f, 0.517928541f},
-std::array<float,2>{0.133064896f, 0.0350066125f},
-std::array<float,2>{0.778701305f, 0.198238954f},
-std::array<float,2>{0.0617849678f, 0.646650791f},
-std::array<float,2>{0.650627375f, 0.959539652f},
-std::array<float,2>{0.317077219f, 0.435573757f},
-std::array<float,2>{0.896220326f, 0.471022069f},
-std::array<float,2>{0.204097494f, 0.906805098f},
-std::array<float,2>{0.593365073f, 0.732726872f},
-std::array<float,2>{0.407680482f, 0.174733877f},
-std::array<float,2>{0.745861113f, 0.0679707602f},
-std::array<float,2>{0.272342563f, 0.566048384f},
-std::array<float,2>{0.861458123f, 0.776235223f},
-std::array<float,2>{0.0683098957f, 0.295324326f},
-std::array<float,2>{0.57501024f, 0.447531134f},
-std::array<float,2>{0.433242977f, 0.895073235f},
-std::array<float,2>{0.882644892f, 0.706194997f},
-std::array<float,2>{0.197192535f, 0.14879261f},
-std::array<float,2>{0.85824728f, 0.0974522978f},
-std::array<float,2>{0.0898673534f, 0.62357688f},
-std::array<float,2>{0.724113226f, 0.806849241f},
-std::array<float,2>{0.263374537f, 0.257802486f},
-std::array<float,2>{0.996379733f, 0.3470276f},
-std::array<float,2>{0.14679113f, 0.862505019f},
-std::array<float,2>{0.502256095f, 0.562216222f},
-std::array<float,2>{0.451440781f, 0.019779779f},
-std::array<float,2>{0.63526684f, 0.245669514f},
-std::array<float,2>{0.328877896f, 0.679329276f},
-std::array<float,2>{0.752699971f, 0.975780129f},
-std::array<float,2>{0.0371807367f, 0.379189849f},
-std::array<float,2>{0.692069173f, 0.309746742f},
-std::array<float,2>{0.30926019f, 0.755168498f},
-std::array<float,2>{0.823585629f, 0.592729092f},
-std::array<float,2>{0.095074892f, 0.0877871588f},
-std::array<float,2>{0.928720415f, 0.164783955f},
-std::array<float,2>{0.237331182f, 0.746382594f},
-std::array<float,2>{0.597340226f, 0.925131738f},
-std::array<float,2>{0.393520355f, 0.487380087f},
-std::array<float,2>{0.811182082f, 0.407324463f},
-std::array<float,2>{0.0133458888f, 0.945753872f},
-std::array<float,2>{0.683199286f, 0.634453654f},
-std::array<float,2>{0.367819726f, 0.203908846f},
-std::array<float,2>{0.533833265f, 0.0551945381f},
-std::array<float,2>{0.474181563f, 0.509086668f},
-std::array<float,2>{0.96742028f, 0.837250054f},
-std::array<float,2>{0.186383232f, 0.3320795f},
-std::array<float,2>{0.74640435f, 0.382916957f},
-std::array<float,2>{0.268360436f, 0.983869255f},
-std::array<float,2>{0.864260137f, 0.682848811f},
-std::array<float,2>{0.0633944348f, 0.238939822f},
-std::array<float,2>{0.892662466f, 0.0239820164f},
-std::array<float,2>{0.20725885f, 0.552701473f},
-std::array<float,2>{0.58671397f, 0.871073663f},
-std::array<float,2>{0.414055467f, 0.355302364f},
-std::array<float,2>{0.775896013f, 0.259926915f},
-std::array<float,2>{0.0566955209f, 0.799779296f},
-std::array<float,2>{0.654069841f, 0.61377722f},
-std::array<float,2>{0.315339655f, 0.104897156f},
-std::array<float,2>{0.521907508f, 0.145787373f},
-std::array<float,2>{0.467225015f, 0.711868644f},
-std::array<float,2>{0.982361138f, 0.899036527f},
-std::array<float,2>{0.13875331f, 0.439451158f},
-std::array<float,2>{0.61223346f, 0.343458712f},
-std::array<float,2>{0.377551943f, 0.834962249f},
-std::array<float,2>{0.906863809f, 0.506311297f},
-std::array<float,2>{0.222009495f, 0.0522734709f},
-std::array<float,2>{0.839589953f, 0.214585096f},
-std::array<float,2>{0.112896994f, 0.629172862f},
-std::array<float,2>{0.711608171f, 0.94396019f},
-std::array<float,2>{0.294005185f, 0.420735717f},
-std::array<float,2>{0.939045668f, 0.496606499f},
-std::array<float,2>{0.168674648f, 0.932715297f},
-std::array<float,2>{0.561300099f, 0.736492217f},
-std::array<float,2>{0.489275128f, 0.158479318f},
-std::array<float,2>{0.667677522f, 0.0826570243f},
-std::array<float,2>{0.357984513f, 0.583029985f},
-std::array<float,2>{0.79026103f, 0.761973202f},
-std::array<float,2>{0.0287264436f, 0.297719449f},
-std::array<float,2>{0.535487533f, 0.461538225f},
-std::array<float,2>{0.469634891f, 0.886075497f},
-std::array<float,2>{0.961541295f, 0.698892415f},
-std::array<float,2>{0.182922989f, 0.128359705f},
-std::array<float,2>{0.806890965f, 0.115086161f},
-std::array<float,2>{0.0109579712f, 0.601169288f},
-std::array<float,2>{0.687362492f, 0.786615193f},
-std::array<float,2>{0.37278685f, 0.267434478f},
-std::array<float,2>{0.92320925f, 0.362167746f},
-std::array<float,2>{0.240842f, 0.849421859f},
-std::array<float,2>{0.597846329f, 0.539269745f},
-std::array<float,2>{0.397341341f, 0.0118724313f},
-std::array<float,2>{0.689240038f, 0.230548397f},
-std::array<float,2>{0.307765514f, 0.659459472f},
-std::array<float,2>{0.826495588f, 0.996738851f},
-std::array<float,2>{0.0996673703f, 0.392671198f},
-std::array<float,2>{0.638652384f, 0.283582836f},
-std::array<float,2>{0.33346954f, 0.77254802f},
-std::array<float,2>{0.756016135f, 0.573467612f},
-std::array<float,2>{0.0339205228f, 0.0726577714f},
-std::array<float,2>{0.994119763f, 0.184454128f},
-std::array<float,2>{0.14345476f, 0.724037647f},
-std::array<float,2>{0.507058978f, 0.918753266f},
-std::array<float,2>{0.445925802f, 0.481430143f},
-std::array<float,2>{0.851986051f, 0.428547502f},
-std::array<float,2>{0.0886881799f, 0.966004372f},
-std::array<float,2>{0.720942199f, 0.653513193f},
-std::array<float,2>{0.260540068f, 0.189650431f},
-std::array<float,2>{0.572067559f, 0.0423825383f},
-std::array<float,2>{0.43535462f, 0.529559433f},
-std::array<float,2>{0.876879811f, 0.815433323f},
-std::array<float,2>{0.202016532f, 0.321255088f},
-std::array<float,2>{0.67214781f, 0.4758614f},
-std::array<float,2>{0.363914669f, 0.911718488f},
-std::array<float,2>{0.798256636f, 0.728751481f},
-std::array<float,2>{0.00191694987f, 0.176141873f},
-std::array<float,2>{0.958712578f, 0.0643708557f},
-std::array<float,2>{0.176222041f, 0.567666769f},
-std::array<float,2>{0.544646859f, 0.778411448f},
-std::array<float,2>{0.47990939f, 0.29248184f},
-std::array<float,2>{0.815972626f, 0.312665015f},
-std::array<float,2>{0.104030952f, 0.821648657f},
-std::array<float,2>{0.70275414f, 0.520979583f},
-std::array<float,2>{0.301729858f, 0.0390490592f},
-std::array<float,2>{0.603630483f, 0.200053051f},
-std::array<float,2>{0.404367059f, 0.642842174f},
-std::array<float,2>{0.936992943f, 0.954288065f},
-std::array<float,2>{0.247662187f, 0.432677954f},
-std::array<float,2>{0.511382639f, 0.273437917f},
-std::array<float,2>{0.441009074f, 0.790802181f},
-std::array<float,2>{0.992110431f, 0.60537225f},
-std::array<float,2>{0.151618168f, 0.120560907f},
-std::array<float,2>{0.765579939f, 0.137919828f},
-std::array<float,2>{0.0408580936f, 0.689791203f},
-std::array<float,2>{0.630016327f, 0.876671195f},
-std::array<float,2>{0.341405779f, 0.457099527f},
-std::array<float,2>{0.890405953f, 0.399422944f},
-std::array<float,2>{0.189385131f, 0.984998167f},
-std::array<float,2>{0.567322493f, 0.666117489f},
-std::array<float,2>{0.423981547f, 0.220198065f},
-std::array<float,2>{0.73409313f, 0.00228984817f},
-std::array<float,2>{0.256589234f, 0.532873392f},
-std::array<float,2>{0.845912278f, 0.852508307f},
-std::array<float,2>{0.0850387588f, 0.37467742f},
-std::array<float,2>{0.5838027f, 0.412073702f},
-std::array<float,2>{0.41859445f, 0.950453579f},
-std::array<float,2>{0.905845821f, 0.639166951f},
-std::array<float,2>{0.218117222f, 0.209431842f},
-std::array<float,2>{0.868143678f, 0.059242066f},
-std::array<float,2>{0.0766352192f, 0.512255371f},
-std::array<float,2>{0.740489542f, 0.840449929f},
-std::array<float,2>{0.273791492f, 0.33057946f},
-std::array<float,2>{0.974045992f, 0.306930602f},
-std::array<float,2>{0.125054732f, 0.752461851f},
-std::array<float,2>{0.529468477f, 0.587269485f},
-std::array<float,2>{0.454512298f, 0.0934535712f},
-std::array<float,2>{0.646517932f, 0.168687209f},
-std::array<float,2>{0.32535255f, 0.742724538f},
-std::array<float,2>{0.772496104f, 0.927993059f},
-std::array<float,2>{0.051313594f, 0.491311491f},
-std::array<float,2>{0.703585267f, 0.348132014f},
-std::array<float,2>{0.282402158f, 0.867170095f},
-std::array<float,2>{0.8344993f, 0.557376564f},
-std::array<float,2>{0.118728295f, 0.0181465019f},
-std::array<float,2>{0.916057646f, 0.248910993f},
-std::array<float,2>{0.232971922f, 0.67212373f},
-std::array<float,2>{0.624960721f, 0.972356558f},
-std::array<float,2>{0.38720718f, 0.376065433f},
-std::array<float,2>{0.783997297f, 0.451663524f},
-std::array<float,2>{0.020007221f, 0.892325819f},
-std::array<float,2>{0.661881447f, 0.707574606f},
-std::array<float,2>{0.347146779f, 0.15600495f},
-std::array<float,2>{0.550522327f, 0.0994467512f},
-std::array<float,2>{0.498587012f, 0.617433369f},
-std::array<float,2>{0.945645332f, 0.809862733f},
-std::array<float,2>{0.162266299f, 0.253477931f},
-std::array<float,2>{0.69630146f, 0.444773942f},
-std::array<float,2>{0.299369782f, 0.905588746f},
-std::array<float,2>{0.816575944f, 0.71538949f},
-std::array<float,2>{0.10668008f, 0.142486259f},
-std::array<float,2>{0.929831684f, 0.107611947f},
-std::array<float,2>{0.242395237f, 0.612339735f},
-std::array<float,2>{0.605791092f, 0.80276674f},
-std::array<float,2>{0.402282238f, 0.264630377f},
-std::array<float,2>{0.801982582f, 0.358291566f},
-std::array<float,2>{0.00741211558f, 0.871453345f},
-std::array<float,2>{0.676956236f, 0.549865782f},
-std::array<float,2>{0.362666756f, 0.030910125f},
-std::array<float,2>{0.542116463f, 0.236104667f},
-std::array<float,2>{0.483309597f, 0.685021043f},
-std::array<float,2>{0.953816593f, 0.97813791f},
-std::array<float,2>{0.174805701f, 0.3895064f},
-std::array<float,2>{0.565010548f, 0.3015773f},
-std::array<float,2>{0.426432729f, 0.758711696f},
-std::array<float,2>{0.886274278f, 0.580933511f},
-std::array<float,2>{0.194737598f, 0.0789250731f},
-std::array<float,2>{0.84921366f, 0.162475511f},
-std::array<float,2>{0.0802129582f, 0.738921404f},
-std::array<float,2>{0.727763355f, 0.935279846f},
-std::array<float,2>{0.252039522f, 0.493707836f},
-std::array<float,2>{0.984643519f, 0.414309472f},
-std::array<float,2>{0.152455732f, 0.939182401f},
-std::array<float,2>{0.513052464f, 0.628727376f},
-std::array<float,2>{0.443642795f, 0.216222987f},
-std::array<float,2>{0.6278162f, 0.0502571277f},
-std::array<float,2>{0.339176238f, 0.501803279f},
-std::array<float,2>{0.761185467f, 0.831154525f},
-std::array<float,2>{0.0434262045f, 0.338120937f},
-std::array<float,2>{0.524200141f, 0.394727618f},
-std::array<float,2>{0.458309948f, 0.995577216f},
-std::array<float,2>{0.970211506f, 0.660966814f},
-std::array<float,2>{0.130192965f, 0.228501216f},
-std::array<float,2>{0.767462075f, 0.0114312405f},
-std::array<float,2>{0.0494234599f, 0.544068754f},
-std::array<float,2>{0.641248286f, 0.844451189f},
-std::array<float,2>{0.322775602f, 0.36582461f},
-std::array<float,2>{0.898935616f, 0.272493392f},
-std::array<float,2>{0.211563289f, 0.783669174f},
-std::array<float,2>{0.578411937f, 0.594352961f},
-std::array<float,2>{0.415122598f, 0.111270167f},
-std::array<float,2>{0.735081255f, 0.129994825f},
-std::array<float,2>{0.27894032f, 0.701903582f},
-std::array<float,2>{0.871583641f, 0.889099061f},
-std::array<float,2>{0.0737113431f, 0.466972649f},
-std::array<float,2>{0.657200992f, 0.327123284f},
-std::array<float,2>{0.348660946f, 0.819010913f},
-std::array<float,2>{0.785568058f, 0.524063766f},
-std::array<float,2>{0.0165705569f, 0.0445736535f},
-std::array<float,2>{0.950777888f, 0.195190355f},
-std::array<float,2>{0.158748642f, 0.648892939f},
-std::array<float,2>{0.550840497f, 0.962433815f},
-std::array<float,2>{0.493098557f, 0.421992242f},
-std::array<float,2>{0.830750883f, 0.476774365f},
-std::array<float,2>{0.123158202f, 0.917840362f},
-std::array<float,2>{0.710372686f, 0.720947444f},
-std::array<float,2>{0.288639665f, 0.181680724f},
-std::array<float,2>{0.618240058f, 0.0742823109f},
-std::array<float,2>{0.384688228f, 0.574481249f},
-std::array<float,2>{0.921588123f, 0.767749786f},
-std::array<float,2>{0.230107322f, 0.28786087f},
-std::array<float,2>{0.649366796f, 0.435230881f},
-std::array<float,2>{0.319251269f, 0.957652152f},
-std::array<float,2>{0.779515564f, 0.646003187f},
-std::array<float,2>{0.0604879409f, 0.195503235f},
-std::array<float,2>{0.978773534f, 0.0317719243f},
-std::array<float,2>{0.136577234f, 0.515726566f},
-std::array<float,2>{0.518806219f, 0.825649321f},
-std::array<float,2>{0.464504212f, 0.316744328f},
-std::array<float,2>{0.859963655f, 0.293356776f},
-std::array<float,2>{0.0701399222f, 0.774021029f},
-std::array<float,2>{0.742325723f, 0.563749373f},
-std::array<float,2>{0.27121532f, 0.0692423806f},
-std::array<float,2>{0.590844333f, 0.172240227f},
-std::array<float,2>{0.409648955f, 0.732406557f},
-std::array<float,2>{0.898372293f, 0.909769237f},
-std::array<float,2>{0.205931395f, 0.470091671f},
-std::array<float,2>{0.558286726f, 0.36785084f},
-std::array<float,2>{0.487235308f, 0.857595861f},
-std::array<float,2>{0.942420721f, 0.538860619f},
-std::array<float,2>{0.166030526f, 0.00505254883f},
-std::array<float,2>{0.796550035f, 0.225168124f},
-std::array<float,2>{0.024430085f, 0.670437455f},
-std::array<float,2>{0.671576083f, 0.989361644f},
-std::array<float,2>{0.353254676f, 0.403000325f},
-std::array<float,2>{0.912908852f, 0.456765115f},
-std::array<float,2>{0.224786118f, 0.879680216f},
-std::array<float,2>{0.613780439f, 0.692735136f},
-std::array<float,2>{0.380468339f, 0.134644598f},
-std::array<float,2>{0.718606353f, 0.12395367f},
-std::array<float,2>{0.289595336f, 0.607637286f},
-std::array<float,2>{0.841692209f, 0.795067132f},
-std::array<float,2>{0.115362704f, 0.279783666f},
-std::array<float,2>{0.594238698f, 0.485608727f},
-std::array<float,2>{0.391490549f, 0.923217893f},
-std::array<float,2>{0.926113248f, 0.749993682f},
-std::array<float,2>{0.235149503f, 0.166547254f},
-std::array<float,2>{0.821936369f, 0.0886270106f},
-std::array<float,2>{0.0974469632f, 0.591095269f},
-std::array<float,2>{0.693723261f, 0.756203413f},
-std::array<float,2>{0.312228799f, 0.312085152f},
-std::array<float,2>{0.965100169f, 0.333994359f},
-std::array<float,2>{0.185031772f, 0.838032544f},
-std::array<float,2>{0.532594681f, 0.510482252f},
-std::array<float,2>{0.476460338f, 0.056797266f},
-std::array<float,2>{0.680339932f, 0.205434889f},
-std::array<float,2>{0.370453f, 0.634853959f},
-std::array<float,2>{0.809306383f, 0.948384464f},
-std::array<float,2>{0.0149142537f, 0.408835888f},
-std::array<float,2>{0.725311518f, 0.255105346f},
-std::array<float,2>{0.264162391f, 0.805747688f},
-std::array<float,2>{0.85704273f, 0.622196853f},
-std::array<float,2>{0.0920295119f, 0.0939140394f},
-std::array<float,2>{0.879930437f, 0.152178496f},
-std::array<float,2>{0.198083252f, 0.704685628f},
-std::array<float,2>{0.57710892f, 0.898025334f},
-std::array<float,2>{0.431156129f, 0.446714222f},
-std::array<float,2>{0.750885904f, 0.382601917f},
-std::array<float,2>{0.0353262797f, 0.973060131f},
-std::array<float,2>{0.633674145f, 0.676842451f},
-std::array<float,2>{0.330277681f, 0.243871599f},
-std::array<float,2>{0.501589656f, 0.0219617207f},
-std::array<float,2>{0.450763404f, 0.559620321f},
-std::array<float,2>{0.998231113f, 0.8601771f},
-std::array<float,2>{0.145023614f, 0.345506877f},
-std::array<float,2>{0.742675126f, 0.437016129f},
-std::array<float,2>{0.27140218f, 0.960823536f},
-std::array<float,2>{0.860319495f, 0.648274243f},
-std::array<float,2>{0.069945015f, 0.198617458f},
-std::array<float,2>{0.897963524f, 0.0337145999f},
-std::array<float,2>{0.205680907f, 0.51886183f},
-std::array<float,2>{0.591107726f, 0.828108907f},
-std::array<float,2>{0.409196287f, 0.319723457f},
-std::array<float,2>{0.779611766f, 0.296367526f},
-std::array<float,2>{0.0601214096f, 0.776453316f},
-std::array<float,2>{0.649043977f, 0.5644961f},
-std::array<float,2>{0.318888485f, 0.0673215166f},
-std::array<float,2>{0.518745482f, 0.175407842f},
-std::array<float,2>{0.46478352f, 0.734002531f},
-std::array<float,2>{0.978556812f, 0.907356501f},
-std::array<float,2>{0.136470735f, 0.471837521f},
-std::array<float,2>{0.614034176f, 0.37014398f},
-std::array<float,2>{0.380753666f, 0.856484056f},
-std::array<float,2>{0.912839711f, 0.536402285f},
-std::array<float,2>{0.22489062f, 0.00708102621f},
-std::array<float,2>{0.841402352f, 0.22362487f},
-std::array<float,2>{0.115658291f, 0.668541193f},
-std::array<float,2>{0.718444228f, 0.990632653f},
-std::array<float,2>{0.289797187f, 0.405199111f},
-std::array<float,2>{0.942831099f, 0.454150796f},
-std::array<float,2>{0.166477382f, 0.881735563f},
-std::array<float,2>{0.558401406f, 0.694824636f},
-std::array<float,2>{0.48686862f, 0.135248706f},
-std::array<float,2>{0.671799302f, 0.122454703f},
-std::array<float,2>{0.353471994f, 0.605498254f},
-std::array<float,2>{0.796860874f, 0.79379189f},
-std::array<float,2>{0.0248172674f, 0.278528363f},
-std::array<float,2>{0.532292604f, 0.487018526f},
-std::array<float,2>{0.476112336f, 0.924773693f},
-std::array<float,2>{0.964932859f, 0.747719407f},
-std::array<float,2>{0.184780985f, 0.165057495f},
-std::array<float,2>{0.809377789f, 0.0861891657f},
-std::array<float,2>{0.0146827577f, 0.593529999f},
-std::array<float,2>{0.680517435f, 0.754345298f},
-std::array<float,2>{0.370216727f, 0.309447914f},
-std::array<float,2>{0.925913155f, 0.333323717f},
-std::array<float,2>{0.235051379f, 0.836464047f},
-std::array<float,2>{0.594647229f, 0.508290291f},
-std::array<float,2>{0.391157806f, 0.0560050867f},
-std::array<float,2>{0.6935395f, 0.204631314f},
-std::array<float,2>{0.312494248f, 0.63282162f},
-std::array<float,2>{0.822092891f, 0.946954012f},
-std::array<float,2>{0.0972068906f, 0.406775951f},
-std::array<float,2>{0.633404076f, 0.255994231f},
-std::array<float,2>{0.330489844f, 0.808563292f},
-std::array<float,2>{0.750523925f, 0.624492645f},
-std::array<float,2>{0.0355707556f, 0.0960002691f},
-std::array<float,2>{0.998396158f, 0.149931327f},
-std::array<float,2>{0.145394206f, 0.705177248f},
-std::array<float,2>{0.501870632f, 0.895610332f},
-std::array<float,2>{0.451065242f, 0.448670149f},
-std::array<float,2>{0.857208967f, 0.380296171f},
-std::array<float,2>{0.0921731517f, 0.975060821f},
-std::array<float,2>{0.725436449f, 0.678611994f},
-std::array<float,2>{0.264555603f, 0.244213656f},
-std::array<float,2>{0.576866508f, 0.0206439421f},
-std::array<float,2>{0.431503981f, 0.560882628f},
-std::array<float,2>{0.88027966f, 0.861561358f},
-std::array<float,2>{0.197925135f, 0.34585616f},
-std::array<float,2>{0.67715925f, 0.443252593f},
-std::array<float,2>{0.362453878f, 0.90300411f},
-std::array<float,2>{0.802152634f, 0.717552781f},
-std::array<float,2>{0.00780064659f, 0.144287974f},
-std::array<float,2>{0.953888834f, 0.10617432f},
-std::array<float,2>{0.175223857f, 0.610185564f},
-std::array<float,2>{0.542334318f, 0.802033722f},
-std::array<float,2>{0.482991278f, 0.262264073f},
-std::array<float,2>{0.816735327f, 0.356055468f},
-std::array<float,2>{0.106838278f, 0.873798847f},
-std::array<float,2>{0.696636677f, 0.547897816f},
-std::array<float,2>{0.299740642f, 0.0277512539f},
-std::array<float,2>{0.605692387f, 0.237382114f},
-std::array<float,2>{0.402096093f, 0.685886741f},
-std::array<float,2>{0.930037975f, 0.978862941f},
-std::array<float,2>{0.242674962f, 0.387026966f},
-std::array<float,2>{0.512848556f, 0.303281844f},
-std::array<float,2>{0.443492562f, 0.759815693f},
-std::array<float,2>{0.98439008f, 0.579365551f},
-std::array<float,2>{0.152785763f, 0.0815250725f},
-std::array<float,2>{0.760933638f, 0.16068162f},
-std::array<float,2>{0.0430180654f, 0.741543829f},
-std::array<float,2>{0.627446413f, 0.936139882f},
-std::array<float,2>{0.338911206f, 0.494839728f},
-std::array<float,2>{0.88651371f, 0.416609287f},
-std::array<float,2>{0.194379166f, 0.93987745f},
-std::array<float,2>{0.565298378f, 0.626066208f},
-std::array<float,2>{0.426624f, 0.216955706f},
-std::array<float,2>{0.728012025f, 0.0479803123f},
-std::array<float,2>{0.252348781f, 0.502287865f},
-std::array<float,2>{0.849464417f, 0.82921195f},
-std::array<float,2>{0.0805623308f, 0.336640149f},
-std::array<float,2>{0.578219473f, 0.397946358f},
-std::array<float,2>{0.415353268f, 0.993682563f},
-std::array<float,2>{0.8993541f, 0.663172007f},
-std::array<float,2>{0.211686924f, 0.229480565f},
-std::array<float,2>{0.87193042f, 0.00971232168f},
-std::array<float,2>{0.0733528361f, 0.546542108f},
-std::array<float,2>{0.735328019f, 0.847482324f},
-std::array<float,2>{0.279210955f, 0.365071207f},
-std::array<float,2>{0.969770253f, 0.270294458f},
-std::array<float,2>{0.12998496f, 0.782814562f},
-std::array<float,2>{0.52408129f, 0.595777035f},
-std::array<float,2>{0.458130181f, 0.111961052f},
-std::array<float,2>{0.64141649f, 0.131853968f},
-std::array<float,2>{0.323127717f, 0.699796617f},
-std::array<float,2>{0.767131746f, 0.886845946f},
-std::array<float,2>{0.049780108f, 0.466359913f},
-std::array<float,2>{0.710188985f, 0.324219793f},
-std::array<float,2>{0.288978487f, 0.817542195f},
-std::array<float,2>{0.830910385f, 0.525559843f},
-std::array<float,2>{0.123389319f, 0.0454512537f},
-std::array<float,2>{0.92169261f, 0.193020314f},
-std::array<float,2>{0.230367854f, 0.652215958f},
-std::array<float,2>{0.61841923f, 0.964306414f},
-std::array<float,2>{0.384386361f, 0.425195545f},
-std::array<float,2>{0.785298884f, 0.478682756f},
-std::array<float,2>{0.0163028371f, 0.914737403f},
-std::array<float,2>{0.656882107f, 0.720287621f},
-std::array<float,2>{0.348917902f, 0.179829374f},
-std::array<float,2>{0.551179111f, 0.0779254884f},
-std::array<float,2>{0.4928931f, 0.578060329f},
-std::array<float,2>{0.950987577f, 0.767072916f},
-std::array<float,2>{0.158971801f, 0.287055045f},
-std::array<float,2>{0.7029109f, 0.474177092f},
-std::array<float,2>{0.301434755f, 0.912519991f},
-std::array<float,2>{0.816239536f, 0.727232397f},
-std::array<float,2>{0.104470581f, 0.177914903f},
-std::array<float,2>{0.93664062f, 0.064931497f},
-std::array<float,2>{0.24791339f, 0.569455028f},
-std::array<float,2>{0.603863716f, 0.780853927f},
-std::array<float,2>{0.40460819f, 0.29048568f},
-std::array<float,2>{0.79791528f, 0.316090912f},
-std::array<float,2>{0.00147843361f, 0.824092567f},
-std::array<float,2>{0.672029853f, 0.521722317f},
-std::array<float,2>{0.364100993f, 0.0352497585f},
-std::array<float,2>{0.544836283f, 0.201780811f},
-std::array<float,2>{0.479507416f, 0.64141953f},
-std::array<float,2>{0.958920717f, 0.955558479f},
-std::array<float,2>{0.175942719f, 0.430536419f},
-std::array<float,2>{0.567012668f, 0.27569586f},
-std::array<float,2>{0.424230456f, 0.791322231f},
-std::array<float,2>{0.890198052f, 0.602858603f},
-std::array<float,2>{0.188980311f, 0.119107209f},
-std::array<float,2>{0.846119165f, 0.139420077f},
-std::array<float,2>{0.0854018256f, 0.687661052f},
-std::array<float,2>{0.734216273f, 0.878542483f},
-std::array<float,2>{0.256614596f, 0.460699022f},
-std::array<float,2>{0.991726696f, 0.400769264f},
-std::array<float,2>{0.151474699f, 0.987775326f},
-std::array<float,2>{0.511504889f, 0.665847301f},
-std::array<float,2>{0.441391855f, 0.221383393f},
-std::array<float,2>{0.630303025f, 0.000250347861f},
-std::array<float,2>{0.34179458f, 0.533826768f},
-std::array<float,2>{0.765214562f, 0.854479849f},
-std::array<float,2>{0.040538989f, 0.372514099f},
-std::array<float,2>{0.529766679f, 0.413844436f},
-std::array<float,2>{0.454316199f, 0.953006566f},
-std::array<float,2>{0.973843992f, 0.63765341f},
-std::array<float,2>{0.125367209f, 0.207771659f},
-std::array<float,2>{0.772712708f, 0.0606355146f},
-std::array<float,2>{0.0517265238f, 0.515211344f},
-std::array<float,2>{0.646828413f, 0.843173802f},
-std::array<float,2>{0.325592935f, 0.329527974f},
-std::array<float,2>{0.906190395f, 0.306452483f},
-std::array<float,2>{0.217945814f, 0.75183481f},
-std::array<float,2>{0.583724558f, 0.58822453f},
-std::array<float,2>{0.418729991f, 0.0917785838f},
-std::array<float,2>{0.740353465f, 0.17021434f},
-std::array<float,2>{0.273465008f, 0.744656384f},
-std::array<float,2>{0.867810011f, 0.926555932f},
-std::array<float,2>{0.0762719661f, 0.489105225f},
-std::array<float,2>{0.661630213f, 0.350878447f},
-std::array<float,2>{0.346892625f, 0.864545345f},
-std::array<float,2>{0.783823609f, 0.555613816f},
-std::array<float,2>{0.0196345169f, 0.0159815457f},
-std::array<float,2>{0.945546567f, 0.246689409f},
-std::array<float,2>{0.162472039f, 0.673848629f},
-std::array<float,2>{0.550638676f, 0.968936801f},
-std::array<float,2>{0.498954773f, 0.377600282f},
-std::array<float,2>{0.834727168f, 0.450635791f},
-std::array<float,2>{0.119067229f, 0.892703712f},
-std::array<float,2>{0.703292429f, 0.710523009f},
-std::array<float,2>{0.282491356f, 0.152528211f},
-std::array<float,2>{0.624520957f, 0.100359686f},
-std::array<float,2>{0.387627184f, 0.619622052f},
-std::array<float,2>{0.916389704f, 0.810609818f},
-std::array<float,2>{0.233274251f, 0.25073725f},
-std::array<float,2>{0.653811872f, 0.386168629f},
-std::array<float,2>{0.315175325f, 0.980802536f},
-std::array<float,2>{0.776357353f, 0.680495858f},
-std::array<float,2>{0.0569304116f, 0.241923049f},
-std::array<float,2>{0.982102215f, 0.0273399111f},
-std::array<float,2>{0.139085397f, 0.554459035f},
-std::array<float,2>{0.52166754f, 0.867657006f},
-std::array<float,2>{0.466977209f, 0.351927012f},
-std::array<float,2>{0.864625037f, 0.258649558f},
-std::array<float,2>{0.0630264133f, 0.797171533f},
-std::array<float,2>{0.746290803f, 0.617168427f},
-std::array<float,2>{0.268131316f, 0.103243135f},
-std::array<float,2>{0.58664f, 0.146951765f},
-std::array<float,2>{0.413670361f, 0.714598775f},
-std::array<float,2>{0.892844081f, 0.900731206f},
-std::array<float,2>{0.207393318f, 0.440651327f},
-std::array<float,2>{0.561124504f, 0.341144264f},
-std::array<float,2>{0.489740402f, 0.833193779f},
-std::array<float,2>{0.939353108f, 0.504232109f},
-std::array<float,2>{0.168717146f, 0.0530333817f},
-std::array<float,2>{0.790430129f, 0.212524697f},
-std::array<float,2>{0.0284918174f, 0.632424712f},
-std::array<float,2>{0.667948723f, 0.9415555f},
-std::array<float,2>{0.358312696f, 0.419528961f},
-std::array<float,2>{0.907077849f, 0.498866439f},
-std::array<float,2>{0.221828297f, 0.929867625f},
-std::array<float,2>{0.611873686f, 0.735493243f},
-std::array<float,2>{0.377753437f, 0.157225534f},
-std::array<float,2>{0.711850941f, 0.0856010765f},
-std::array<float,2>{0.29439187f, 0.584653974f},
-std::array<float,2>{0.839811206f, 0.764017999f},
-std::array<float,2>{0.113130242f, 0.29954806f},
-std::array<float,2>{0.597932339f, 0.462994546f},
-std::array<float,2>{0.397164375f, 0.883972108f},
-std::array<float,2>{0.92300117f, 0.696071923f},
-std::array<float,2>{0.240986153f, 0.125172719f},
-std::array<float,2>{0.826406062f, 0.116958275f},
-std::array<float,2>{0.0998599753f, 0.598481238f},
-std::array<float,2>{0.689018488f, 0.788462698f},
-std::array<float,2>{0.307868868f, 0.268400401f},
-std::array<float,2>{0.961825311f, 0.360295653f},
-std::array<float,2>{0.18262887f, 0.849702299f},
-std::array<float,2>{0.535303354f, 0.541490734f},
-std::array<float,2>{0.469301999f, 0.0138313603f},
-std::array<float,2>{0.687148869f, 0.233741924f},
-std::array<float,2>{0.373035192f, 0.656536102f},
-std::array<float,2>{0.806874394f, 0.999112666f},
-std::array<float,2>{0.0110823112f, 0.390636355f},
-std::array<float,2>{0.721078634f, 0.282433212f},
-std::array<float,2>{0.260309666f, 0.770972669f},
-std::array<float,2>{0.85157454f, 0.570584357f},
-std::array<float,2>{0.0885784402f, 0.071961686f},
-std::array<float,2>{0.876613677f, 0.187227651f},
-std::array<float,2>{0.201766565f, 0.724731863f},
-std::array<float,2>{0.571846664f, 0.920256734f},
-std::array<float,2>{0.435107499f, 0.483697206f},
-std::array<float,2>{0.756141901f, 0.426028013f},
-std::array<float,2>{0.0341368727f, 0.966874659f},
-std::array<float,2>{0.638205469f, 0.654486954f},
-std::array<float,2>{0.333041281f, 0.188186631f},
-std::array<float,2>{0.507260263f, 0.0396490619f},
-std::array<float,2>{0.446213901f, 0.528059781f},
-std::array<float,2>{0.993870437f, 0.812944949f},
-std::array<float,2>{0.143258676f, 0.323129445f},
-std::array<float,2>{0.716205835f, 0.403374612f},
-std::array<float,2>{0.292834431f, 0.988448322f},
-std::array<float,2>{0.842638075f, 0.671087384f},
-std::array<float,2>{0.114825293f, 0.225613803f},
-std::array<float,2>{0.911812544f, 0.00409438834f},
-std::array<float,2>{0.22287555f, 0.537766457f},
-std::array<float,2>{0.617139995f, 0.858853877f},
-std::array<float,2>{0.382649213f, 0.368257999f},
-std::array<float,2>{0.794672728f, 0.280849934f},
-std::array<float,2>{0.0263816286f, 0.796667755f},
-std::array<float,2>{0.669197083f, 0.608438313f},
-std::array<float,2>{0.353919894f, 0.124416769f},
-std::array<float,2>{0.556549132f, 0.133109167f},
-std::array<float,2>{0.486019522f, 0.692207754f},
-std::array<float,2>{0.943964183f, 0.880064547f},
-std::array<float,2>{0.165510118f, 0.455645591f},
-std::array<float,2>{0.593698621f, 0.317603439f},
-std::array<float,2>{0.40731886f, 0.824929237f},
-std::array<float,2>{0.896413922f, 0.517201245f},
-std::array<float,2>{0.203796744f, 0.0322782509f},
-std::array<float,2>{0.861631393f, 0.196878284f},
-std::array<float,2>{0.0680170432f, 0.645303607f},
-std::array<float,2>{0.745721221f, 0.958537102f},
-std::array<float,2>{0.272156715f, 0.434219331f},
-std::array<float,2>{0.976584196f, 0.469407558f},
-std::array<float,2>{0.132855117f, 0.908576369f},
-std::array<float,2>{0.515800357f, 0.730468929f},
-std::array<float,2>{0.462583125f, 0.173080802f},
-std::array<float,2>{0.650785327f, 0.0702923462f},
-std::array<float,2>{0.317217439f, 0.562851489f},
-std::array<float,2>{0.778455615f, 0.774550319f},
-std::array<float,2>{0.0616245158f, 0.294446647f},
-std::array<float,2>{0.501968861f, 0.445604414f},
-std::array<float,2>{0.451217324f, 0.89667052f},
-std::array<float,2>{0.99619478f, 0.703659117f},
-std::array<float,2>{0.146532416f, 0.151234552f},
-std::array<float,2>{0.752488971f, 0.0951568559f},
-std::array<float,2>{0.0375541672f, 0.621229887f},
-std::array<float,2>{0.635649979f, 0.804825723f},
-std::array<float,2>{0.328806162f, 0.254564285f},
-std::array<float,2>{0.882391691f, 0.344397426f},
-std::array<float,2>{0.196810246f, 0.861183882f},
-std::array<float,2>{0.574903548f, 0.559449613f},
-std::array<float,2>{0.433484554f, 0.022698639f},
-std::array<float,2>{0.723731518f, 0.242385224f},
-std::array<float,2>{0.263620377f, 0.676453292f},
-std::array<float,2>{0.857991517f, 0.974091411f},
-std::array<float,2>{0.0901996791f, 0.381420195f},
-std::array<float,2>{0.683552504f, 0.31146121f},
-std::array<float,2>{0.368000835f, 0.757171452f},
-std::array<float,2>{0.811453223f, 0.589858055f},
-std::array<float,2>{0.0136573771f, 0.0896654204f},
-std::array<float,2>{0.967620969f, 0.167274058f},
-std::array<float,2>{0.186119452f, 0.748886287f},
-std::array<float,2>{0.533990145f, 0.922218502f},
-std::array<float,2>{0.474607885f, 0.484642804f},
-std::array<float,2>{0.823299885f, 0.410073787f},
-std::array<float,2>{0.0947412401f, 0.948150754f},
-std::array<float,2>{0.692186892f, 0.636582613f},
-std::array<float,2>{0.309393108f, 0.206411496f},
-std::array<float,2>{0.59752506f, 0.0576499067f},
-std::array<float,2>{0.39322269f, 0.511381805f},
-std::array<float,2>{0.929009795f, 0.839172781f},
-std::array<float,2>{0.237780288f, 0.335653067f},
-std::array<float,2>{0.626647234f, 0.49280414f},
-std::array<float,2>{0.337618947f, 0.934002101f},
-std::array<float,2>{0.758184314f, 0.739980876f},
-std::array<float,2>{0.046410054f, 0.163946226f},
-std::array<float,2>{0.987750292f, 0.0794144124f},
-std::array<float,2>{0.155649334f, 0.581189334f},
-std::array<float,2>{0.514786124f, 0.759686351f},
-std::array<float,2>{0.443165451f, 0.302114725f},
-std::array<float,2>{0.850197554f, 0.339527905f},
-std::array<float,2>{0.0795627236f, 0.830891788f},
-std::array<float,2>{0.728953958f, 0.500302017f},
-std::array<float,2>{0.250633508f, 0.0496354438f},
-std::array<float,2>{0.563114822f, 0.215753794f},
-std::array<float,2>{0.429354608f, 0.627626002f},
-std::array<float,2>{0.884437919f, 0.937641382f},
-std::array<float,2>{0.192217991f, 0.41585505f},
-std::array<float,2>{0.539289296f, 0.264658839f},
-std::array<float,2>{0.482255697f, 0.804476261f},
-std::array<float,2>{0.956134975f, 0.611724317f},
-std::array<float,2>{0.173825189f, 0.10931059f},
-std::array<float,2>{0.803952873f, 0.141244784f},
-std::array<float,2>{0.00427619414f, 0.716671765f},
-std::array<float,2>{0.679195166f, 0.90472281f},
-std::array<float,2>{0.359889001f, 0.443578005f},
-std::array<float,2>{0.932852685f, 0.390314072f},
-std::array<float,2>{0.245322168f, 0.976792336f},
-std::array<float,2>{0.608605206f, 0.683681071f},
-std::array<float,2>{0.400364697f, 0.234705016f},
-std::array<float,2>{0.699064255f, 0.02974803f},
-std::array<float,2>{0.297183961f, 0.549070477f},
-std::array<float,2>{0.820215702f, 0.872655392f},
-std::array<float,2>{0.107544579f, 0.358555347f},
-std::array<float,2>{0.619595528f, 0.423400193f},
-std::array<float,2>{0.385937423f, 0.96112895f},
-std::array<float,2>{0.918118894f, 0.649633646f},
-std::array<float,2>{0.228244975f, 0.193973422f},
-std::array<float,2>{0.829501688f, 0.043736998f},
-std::array<float,2>{0.121940345f, 0.525095046f},
-std::array<float,2>{0.707118571f, 0.819744527f},
-std::array<float,2>{0.286847353f, 0.327687979f},
-std::array<float,2>{0.95184505f, 0.28896451f},
-std::array<float,2>{0.156922147f, 0.768785f},
-std::array<float,2>{0.553621173f, 0.575670302f},
-std::array<float,2>{0.494942337f, 0.0755938068f},
-std::array<float,2>{0.658591866f, 0.183370426f},
-std::array<float,2>{0.34990257f, 0.722190559f},
-std::array<float,2>{0.789030671f, 0.916427851f},
-std::array<float,2>{0.0191341266f, 0.478316218f},
-std::array<float,2>{0.737821996f, 0.366681129f},
-std::array<float,2>{0.280666351f, 0.845349729f},
-std::array<float,2>{0.874482691f, 0.543778479f},
-std::array<float,2>{0.0715296566f, 0.0102447392f},
-std::array<float,2>{0.901836038f, 0.227171317f},
-std::array<float,2>{0.213515714f, 0.661690652f},
-std::array<float,2>{0.581917584f, 0.994662821f},
-std::array<float,2>{0.417333245f, 0.395706236f},
-std::array<float,2>{0.768838286f, 0.468340248f},
-std::array<float,2>{0.048374027f, 0.890360653f},
-std::array<float,2>{0.64283663f, 0.70265311f},
-std::array<float,2>{0.320559949f, 0.129616886f},
-std::array<float,2>{0.526345313f, 0.109604388f},
-std::array<float,2>{0.459599912f, 0.595362067f},
-std::array<float,2>{0.970768273f, 0.784787178f},
-std::array<float,2>{0.131694421f, 0.272012413f},
-std::array<float,2>{0.731140018f, 0.458487928f},
-std::array<float,2>{0.255837232f, 0.875662088f},
-std::array<float,2>{0.844841897f, 0.691275954f},
-std::array<float,2>{0.0837299377f, 0.137505367f},
-std::array<float,2>{0.886948586f, 0.120009191f},
-std::array<float,2>{0.190331012f, 0.604460776f},
-std::array<float,2>{0.568903923f, 0.789533973f},
-std::array<float,2>{0.422993302f, 0.27473256f},
-std::array<float,2>{0.762102127f, 0.37386319f},
-std::array<float,2>{0.041032169f, 0.853196383f},
-std::array<float,2>{0.631450951f, 0.53136611f},
-std::array<float,2>{0.343712538f, 0.00340178423f},
-std::array<float,2>{0.508713484f, 0.219295382f},
-std::array<float,2>{0.439269751f, 0.667780638f},
-std::array<float,2>{0.99016881f, 0.985460222f},
-std::array<float,2>{0.150213763f, 0.398611724f},
-std::array<float,2>{0.601743639f, 0.291939229f},
-std::array<float,2>{0.404120535f, 0.778252125f},
-std::array<float,2>{0.934618354f, 0.566729605f},
-std::array<float,2>{0.249819756f, 0.0628736243f},
-std::array<float,2>{0.81374824f, 0.176833302f},
-std::array<float,2>{0.102710381f, 0.729972541f},
-std::array<float,2>{0.699350715f, 0.91092217f},
-std::array<float,2>{0.302835613f, 0.474630177f},
-std::array<float,2>{0.959348142f, 0.432511151f},
-std::array<float,2>{0.178034902f, 0.954020798f},
-std::array<float,2>{0.54676944f, 0.644317329f},
-std::array<float,2>{0.477858096f, 0.200796515f},
-std::array<float,2>{0.674169004f, 0.0378296636f},
-std::array<float,2>{0.367177695f, 0.519719064f},
-std::array<float,2>{0.799010038f, 0.820554316f},
-std::array<float,2>{0.00317286467f, 0.313552111f},
-std::array<float,2>{0.548762441f, 0.37502557f},
-std::array<float,2>{0.497495294f, 0.970721126f},
-std::array<float,2>{0.947900593f, 0.673375666f},
-std::array<float,2>{0.160611674f, 0.249181256f},
-std::array<float,2>{0.783131719f, 0.0192530509f},
-std::array<float,2>{0.0233107209f, 0.557755768f},
-std::array<float,2>{0.663282454f, 0.865885675f},
-std::array<float,2>{0.345295727f, 0.348753452f},
-std::array<float,2>{0.914437234f, 0.252600014f},
-std::array<float,2>{0.231965482f, 0.808595717f},
-std::array<float,2>{0.621471524f, 0.618606389f},
-std::array<float,2>{0.389642149f, 0.0978154093f},
-std::array<float,2>{0.706670523f, 0.155212805f},
-std::array<float,2>{0.284065306f, 0.70864135f},
-std::array<float,2>{0.833646417f, 0.891364396f},
-std::array<float,2>{0.119297743f, 0.452931464f},
-std::array<float,2>{0.644553483f, 0.331237853f},
-std::array<float,2>{0.326322645f, 0.841178f},
-std::array<float,2>{0.771275818f, 0.512864172f},
-std::array<float,2>{0.0529552177f, 0.0603354834f},
-std::array<float,2>{0.975246429f, 0.210644513f},
-std::array<float,2>{0.128492028f, 0.640603006f},
-std::array<float,2>{0.529033244f, 0.950010717f},
-std::array<float,2>{0.455140352f, 0.411053061f},
-std::array<float,2>{0.870767355f, 0.490630269f},
-std::array<float,2>{0.0751185194f, 0.928808391f},
-std::array<float,2>{0.738966465f, 0.74328047f},
-std::array<float,2>{0.277183086f, 0.169184074f},
-std::array<float,2>{0.584013462f, 0.0919265449f},
-std::array<float,2>{0.421117097f, 0.585980237f},
-std::array<float,2>{0.902601004f, 0.753315449f},
-std::array<float,2>{0.216537535f, 0.308414042f},
-std::array<float,2>{0.664743006f, 0.421787739f},
-std::array<float,2>{0.355696321f, 0.944983423f},
-std::array<float,2>{0.792551219f, 0.630762637f},
-std::array<float,2>{0.0297162607f, 0.212943673f},
-std::array<float,2>{0.941363871f, 0.051118549f},
-std::array<float,2>{0.171505824f, 0.50684464f},
-std::array<float,2>{0.559847593f, 0.834261537f},
-std::array<float,2>{0.491898149f, 0.342612505f},
-std::array<float,2>{0.836474895f, 0.298401982f},
-std::array<float,2>{0.110194825f, 0.762989223f},
-std::array<float,2>{0.713005722f, 0.582588851f},
-std::array<float,2>{0.295855224f, 0.0839301124f},
-std::array<float,2>{0.609970033f, 0.160140753f},
-std::array<float,2>{0.376033485f, 0.737648606f},
-std::array<float,2>{0.909018397f, 0.932075679f},
-std::array<float,2>{0.219716147f, 0.497671932f},
-std::array<float,2>{0.521445036f, 0.353580594f},
-std::array<float,2>{0.466500461f, 0.869617283f},
-std::array<float,2>{0.983060598f, 0.551151693f},
-std::array<float,2>{0.138295367f, 0.0249756761f},
-std::array<float,2>{0.774414241f, 0.240209103f},
-std::array<float,2>{0.0549513139f, 0.681907177f},
-std::array<float,2>{0.656135917f, 0.982914984f},
-std::array<float,2>{0.312696248f, 0.384493619f},
-std::array<float,2>{0.890877366f, 0.437656462f},
-std::array<float,2>{0.209834144f, 0.900063455f},
-std::array<float,2>{0.588274419f, 0.712105274f},
-std::array<float,2>{0.411505878f, 0.145248979f},
-std::array<float,2>{0.749536276f, 0.104102351f},
-std::array<float,2>{0.267281413f, 0.614944577f},
-std::array<float,2>{0.865606785f, 0.80070281f},
-std::array<float,2>{0.0649663955f, 0.261052221f},
-std::array<float,2>{0.572603464f, 0.481663585f},
-std::array<float,2>{0.435771555f, 0.919118464f},
-std::array<float,2>{0.877015173f, 0.723500371f},
-std::array<float,2>{0.199903294f, 0.184730649f},
-std::array<float,2>{0.854296327f, 0.0739133134f},
-std::array<float,2>{0.0868720785f, 0.572540522f},
-std::array<float,2>{0.719889402f, 0.771954477f},
-std::array<float,2>{0.259705245f, 0.284545958f},
-std::array<float,2>{0.995307863f, 0.321637452f},
-std::array<float,2>{0.141978517f, 0.814471722f},
-std::array<float,2>{0.504590213f, 0.530715108f},
-std::array<float,2>{0.447280437f, 0.0414481722f},
-std::array<float,2>{0.640465021f, 0.190452889f},
-std::array<float,2>{0.334322006f, 0.652553201f},
-std::array<float,2>{0.754355252f, 0.965073347f},
-std::array<float,2>{0.0324618481f, 0.428996205f},
-std::array<float,2>{0.690118968f, 0.265924066f},
-std::array<float,2>{0.306349218f, 0.785376966f},
-std::array<float,2>{0.825449169f, 0.600209951f},
-std::array<float,2>{0.0991646349f, 0.113701239f},
-std::array<float,2>{0.925203383f, 0.127228394f},
-std::array<float,2>{0.239309162f, 0.69791168f},
-std::array<float,2>{0.599921048f, 0.885070622f},
-std::array<float,2>{0.396214843f, 0.462033361f},
-std::array<float,2>{0.805833101f, 0.394372553f},
-std::array<float,2>{0.00925873779f, 0.997339249f},
-std::array<float,2>{0.684812725f, 0.658854187f},
-std::array<float,2>{0.374510825f, 0.231544614f},
-std::array<float,2>{0.538176417f, 0.0135169243f},
-std::array<float,2>{0.472201854f, 0.54092592f},
-std::array<float,2>{0.964054048f, 0.848076463f},
-std::array<float,2>{0.180940017f, 0.363073915f},
-std::array<float,2>{0.692505002f, 0.407926023f},
-std::array<float,2>{0.31007424f, 0.945905924f},
-std::array<float,2>{0.822318196f, 0.63385123f},
-std::array<float,2>{0.093883276f, 0.203214645f},
-std::array<float,2>{0.927887082f, 0.0549940243f},
-std::array<float,2>{0.237302393f, 0.509491205f},
-std::array<float,2>{0.595958471f, 0.837802827f},
-std::array<float,2>{0.393826306f, 0.332764864f},
-std::array<float,2>{0.811760008f, 0.310203612f},
-std::array<float,2>{0.0125663672f, 0.755838513f},
-std::array<float,2>{0.682404339f, 0.591883123f},
-std::array<float,2>{0.368365079f, 0.0871508643f},
-std::array<float,2>{0.535063863f, 0.164319143f},
-std::array<float,2>{0.472706825f, 0.746610582f},
-std::array<float,2>{0.968119562f, 0.925361514f},
-std::array<float,2>{0.187023669f, 0.488177419f},
-std::array<float,2>{0.576161563f, 0.347177804f},
-std::array<float,2>{0.4319565f, 0.86307627f},
-std::array<float,2>{0.881698251f, 0.561894298f},
-std::array<float,2>{0.195610911f, 0.0202580355f},
-std::array<float,2>{0.859019935f, 0.245426878f},
-std::array<float,2>{0.0917868242f, 0.678840697f},
-std::array<float,2>{0.723357856f, 0.976493657f},
-std::array<float,2>{0.261846662f, 0.379486859f},
-std::array<float,2>{0.997270226f, 0.448038399f},
-std::array<float,2>{0.147638306f, 0.894561231f},
-std::array<float,2>{0.503736019f, 0.70698595f},
-std::array<float,2>{0.452533275f, 0.149184972f},
-std::array<float,2>{0.636333823f, 0.0970662609f},
-std::array<float,2>{0.329838485f, 0.623119295f},
-std::array<float,2>{0.753358781f, 0.807431996f},
-std::array<float,2>{0.0386926942f, 0.256849647f},
-std::array<float,2>{0.517478943f, 0.471452147f},
-std::array<float,2>{0.461131752f, 0.906347871f},
-std::array<float,2>{0.978218973f, 0.73319304f},
-std::array<float,2>{0.134274542f, 0.173836261f},
-std::array<float,2>{0.778156042f, 0.067511104f},
-std::array<float,2>{0.0607645027f, 0.565916121f},
-std::array<float,2>{0.651806831f, 0.775742233f},
-std::array<float,2>{0.317875892f, 0.295525789f},
-std::array<float,2>{0.895289302f, 0.318408549f},
-std::array<float,2>{0.204967663f, 0.826258361f},
-std::array<float,2>{0.591904163f, 0.518365741f},
-std::array<float,2>{0.406894207f, 0.0343560204f},
-std::array<float,2>{0.744654715f, 0.19749099f},
-std::array<float,2>{0.272859603f, 0.647252858f},
-std::array<float,2>{0.862923145f, 0.959174156f},
-std::array<float,2>{0.0673299208f, 0.436371952f},
-std::array<float,2>{0.66829139f, 0.277689457f},
-std::array<float,2>{0.355416328f, 0.794884086f},
-std::array<float,2>{0.793533266f, 0.607173741f},
-std::array<float,2>{0.0260766149f, 0.121806771f},
-std::array<float,2>{0.944823802f, 0.13652958f},
-std::array<float,2>{0.164506942f, 0.694315612f},
-std::array<float,2>{0.555447638f, 0.882547915f},
-std::array<float,2>{0.484917909f, 0.453703493f},
-std::array<float,2>{0.843004107f, 0.405888706f},
-std::array<float,2>{0.113685571f, 0.991891623f},
-std::array<float,2>{0.715633512f, 0.669894695f},
-std::array<float,2>{0.291211545f, 0.223789066f},
-std::array<float,2>{0.615875781f, 0.00633935677f},
-std::array<float,2>{0.381302387f, 0.536079466f},
-std::array<float,2>{0.910159767f, 0.856157601f},
-std::array<float,2>{0.223840773f, 0.369609207f},
-std::array<float,2>{0.643743157f, 0.465761751f},
-std::array<float,2>{0.321798384f, 0.8882128f},
-std::array<float,2>{0.768393934f, 0.700543463f},
-std::array<float,2>{0.0473544151f, 0.131269112f},
-std::array<float,2>{0.972460687f, 0.112941191f},
-std::array<float,2>{0.132609516f, 0.597417235f},
-std::array<float,2>{0.52646184f, 0.781489313f},
-std::array<float,2>{0.460534543f, 0.271374285f},
-std::array<float,2>{0.873364508f, 0.363812834f},
-std::array<float,2>{0.0708177462f, 0.846299291f},
-std::array<float,2>{0.736557901f, 0.545370936f},
-std::array<float,2>{0.279343665f, 0.00869745109f},
-std::array<float,2>{0.580439627f, 0.230212957f},
-std::array<float,2>{0.416086823f, 0.662672937f},
-std::array<float,2>{0.900700629f, 0.992680728f},
-std::array<float,2>{0.213983119f, 0.396798909f},
-std::array<float,2>{0.553875923f, 0.285247684f},
-std::array<float,2>{0.495834291f, 0.765897691f},
-std::array<float,2>{0.952515423f, 0.577030659f},
-std::array<float,2>{0.157249808f, 0.0767286569f},
-std::array<float,2>{0.787547112f, 0.181250319f},
-std::array<float,2>{0.0177263003f, 0.718999445f},
-std::array<float,2>{0.659294903f, 0.915796101f},
-std::array<float,2>{0.350663304f, 0.479655147f},
-std::array<float,2>{0.919150949f, 0.424031883f},
-std::array<float,2>{0.227112144f, 0.963020444f},
-std::array<float,2>{0.620703578f, 0.651260018f},
-std::array<float,2>{0.385371983f, 0.192100108f},
-std::array<float,2>{0.708435357f, 0.0467966199f},
-std::array<float,2>{0.285804778f, 0.526939511f},
-std::array<float,2>{0.828949094f, 0.817375004f},
-std::array<float,2>{0.122578554f, 0.325525075f},
-std::array<float,2>{0.608109415f, 0.388612568f},
-std::array<float,2>{0.398454785f, 0.979889452f},
-std::array<float,2>{0.932553589f, 0.686843753f},
-std::array<float,2>{0.244403154f, 0.237111002f},
-std::array<float,2>{0.818705678f, 0.0285426769f},
-std::array<float,2>{0.109324984f, 0.547248602f},
-std::array<float,2>{0.698111236f, 0.874869227f},
-std::array<float,2>{0.298555315f, 0.357138008f},
-std::array<float,2>{0.955226958f, 0.263255268f},
-std::array<float,2>{0.171995983f, 0.801370561f},
-std::array<float,2>{0.540080309f, 0.611004412f},
-std::array<float,2>{0.481206536f, 0.107328497f},
-std::array<float,2>{0.677736342f, 0.142829329f},
-std::array<float,2>{0.360971153f, 0.718398929f},
-std::array<float,2>{0.802950323f, 0.903865457f},
-std::array<float,2>{0.00538259465f, 0.442008883f},
-std::array<float,2>{0.730463207f, 0.337410539f},
-std::array<float,2>{0.251781315f, 0.829093277f},
-std::array<float,2>{0.850903451f, 0.503581643f},
-std::array<float,2>{0.0790304467f, 0.0469549112f},
-std::array<float,2>{0.883370519f, 0.218640879f},
-std::array<float,2>{0.193257585f, 0.625726938f},
-std::array<float,2>{0.563649654f, 0.940933704f},
-std::array<float,2>{0.428478181f, 0.417367667f},
-std::array<float,2>{0.75923872f, 0.495596796f},
-std::array<float,2>{0.0458556488f, 0.93687582f},
-std::array<float,2>{0.625349522f, 0.740941525f},
-std::array<float,2>{0.335937828f, 0.161180258f},
-std::array<float,2>{0.514418066f, 0.0802598819f},
-std::array<float,2>{0.441992909f, 0.578373253f},
-std::array<float,2>{0.986451328f, 0.761662841f},
-std::array<float,2>{0.154967234f, 0.304613113f},
-std::array<float,2>{0.740122199f, 0.489330322f},
-std::array<float,2>{0.27621606f, 0.927163005f},
-std::array<float,2>{0.869648993f, 0.745504916f},
-std::array<float,2>{0.0758004934f, 0.171805099f},
-std::array<float,2>{0.903815866f, 0.0898529962f},
-std::array<float,2>{0.21526365f, 0.589730859f},
-std::array<float,2>{0.585263848f, 0.750321984f},
-std::array<float,2>{0.420890152f, 0.304957479f},
-std::array<float,2>{0.769864678f, 0.328607023f},
-std::array<float,2>{0.0541264825f, 0.842659116f},
-std::array<float,2>{0.64638108f, 0.514602184f},
-std::array<float,2>{0.327545285f, 0.0619719066f},
-std::array<float,2>{0.528071582f, 0.208046377f},
-std::array<float,2>{0.456849396f, 0.638249934f},
-std::array<float,2>{0.976160645f, 0.951262712f},
-std::array<float,2>{0.127465755f, 0.412225366f},
-std::array<float,2>{0.622973263f, 0.251269042f},
-std::array<float,2>{0.389920503f, 0.812465906f},
-std::array<float,2>{0.915871561f, 0.62026608f},
-std::array<float,2>{0.230559349f, 0.100662194f},
-std::array<float,2>{0.832485139f, 0.154039413f},
-std::array<float,2>{0.12063726f, 0.709758043f},
-std::array<float,2>{0.705211043f, 0.894212186f},
-std::array<float,2>{0.284434557f, 0.449475944f},
-std::array<float,2>{0.949120522f, 0.378535479f},
-std::array<float,2>{0.161357582f, 0.970238745f},
-std::array<float,2>{0.547827959f, 0.67563951f},
-std::array<float,2>{0.496144027f, 0.247296408f},
-std::array<float,2>{0.662245572f, 0.0169243533f},
-std::array<float,2>{0.343833894f, 0.556339204f},
-std::array<float,2>{0.781692982f, 0.863434553f},
-std::array<float,2>{0.0218294822f, 0.349961221f},
-std::array<float,2>{0.545845032f, 0.430706114f},
-std::array<float,2>{0.477270901f, 0.956157088f},
-std::array<float,2>{0.960856616f, 0.642403066f},
-std::array<float,2>{0.178917229f, 0.202871904f},
-std::array<float,2>{0.800095916f, 0.0370481797f},
-std::array<float,2>{0.00265582558f, 0.52319932f},
-std::array<float,2>{0.674949765f, 0.82283628f},
-std::array<float,2>{0.365279973f, 0.315131456f},
-std::array<float,2>{0.933693588f, 0.289388001f},
-std::array<float,2>{0.248169586f, 0.780151904f},
-std::array<float,2>{0.603009939f, 0.568889141f},
-std::array<float,2>{0.402359158f, 0.0655369759f},
-std::array<float,2>{0.700216591f, 0.178983241f},
-std::array<float,2>{0.304118961f, 0.728193641f},
-std::array<float,2>{0.813267767f, 0.913245082f},
-std::array<float,2>{0.101835877f, 0.473339736f},
-std::array<float,2>{0.63187784f, 0.371668994f},
-std::array<float,2>{0.342487276f, 0.855154276f},
-std::array<float,2>{0.763200819f, 0.53438133f},
-std::array<float,2>{0.0425928831f, 0.0011057615f},
-std::array<float,2>{0.989031255f, 0.222205088f},
-std::array<float,2>{0.148977593f, 0.664612949f},
-std::array<float,2>{0.509457231f, 0.986543119f},
-std::array<float,2>{0.437683254f, 0.401392788f},
-std::array<float,2>{0.844263971f, 0.459005624f},
-std::array<float,2>{0.0826318935f, 0.877778113f},
-std::array<float,2>{0.73237288f, 0.689128816f},
-std::array<float,2>{0.254515946f, 0.139924988f},
-std::array<float,2>{0.570201695f, 0.117770016f},
-std::array<float,2>{0.422080666f, 0.602397621f},
-std::array<float,2>{0.887924254f, 0.792426288f},
-std::array<float,2>{0.191183195f, 0.27667132f},
-std::array<float,2>{0.684373975f, 0.392493665f},
-std::array<float,2>{0.37350741f, 0.998312414f},
-std::array<float,2>{0.805086255f, 0.657858014f},
-std::array<float,2>{0.00823695119f, 0.23266235f},
-std::array<float,2>{0.96308589f, 0.0153697031f},
-std::array<float,2>{0.180108845f, 0.542907774f},
-std::array<float,2>{0.537711561f, 0.850928247f},
-std::array<float,2>{0.471377164f, 0.360660762f},
-std::array<float,2>{0.824321032f, 0.269232243f},
-std::array<float,2>{0.0979589447f, 0.787724853f},
-std::array<float,2>{0.690709531f, 0.599021971f},
-std::array<float,2>{0.305530012f, 0.115310803f},
-std::array<float,2>{0.600754261f, 0.126365408f},
-std::array<float,2>{0.395504743f, 0.697259605f},
-std::array<float,2>{0.924086332f, 0.883303523f},
-std::array<float,2>{0.238480374f, 0.464358509f},
-std::array<float,2>{0.505484998f, 0.32364741f},
-std::array<float,2>{0.448819965f, 0.814226866f},
-std::array<float,2>{0.995104432f, 0.52926743f},
-std::array<float,2>{0.141584039f, 0.0403958075f},
-std::array<float,2>{0.755858421f, 0.188677877f},
-std::array<float,2>{0.0314768814f, 0.655709624f},
-std::array<float,2>{0.63953054f, 0.968530416f},
-std::array<float,2>{0.335442126f, 0.427606404f},
-std::array<float,2>{0.878868341f, 0.483100384f},
-std::array<float,2>{0.20110552f, 0.921091497f},
-std::array<float,2>{0.573250711f, 0.726061344f},
-std::array<float,2>{0.436888248f, 0.186249912f},
-std::array<float,2>{0.719712079f, 0.0712322816f},
-std::array<float,2>{0.258523881f, 0.572012246f},
-std::array<float,2>{0.854640603f, 0.770304859f},
-std::array<float,2>{0.0872107446f, 0.281984806f},
-std::array<float,2>{0.589094639f, 0.440211117f},
-std::array<float,2>{0.410420954f, 0.901583016f},
-std::array<float,2>{0.891785026f, 0.713040709f},
-std::array<float,2>{0.210506752f, 0.148282975f},
-std::array<float,2>{0.866768599f, 0.101744354f},
-std::array<float,2>{0.0662968308f, 0.615441084f},
-std::array<float,2>{0.748990476f, 0.798331022f},
-std::array<float,2>{0.266018271f, 0.259068757f},
-std::array<float,2>{0.983872414f, 0.352581292f},
-std::array<float,2>{0.137291715f, 0.868776917f},
-std::array<float,2>{0.519580245f, 0.553569078f},
-std::array<float,2>{0.464905143f, 0.0256015435f},
-std::array<float,2>{0.65491432f, 0.240530252f},
-std::array<float,2>{0.313744664f, 0.681050479f},
-std::array<float,2>{0.774371505f, 0.981750965f},
-std::array<float,2>{0.0564760044f, 0.3856197f},
-std::array<float,2>{0.714158714f, 0.300382227f},
-std::array<float,2>{0.296612293f, 0.765474439f},
-std::array<float,2>{0.837344229f, 0.585152745f},
-std::array<float,2>{0.111248903f, 0.0845177099f},
-std::array<float,2>{0.909292877f, 0.157574818f},
-std::array<float,2>{0.220318258f, 0.735208869f},
-std::array<float,2>{0.610971689f, 0.930970013f},
-std::array<float,2>{0.375715196f, 0.499852359f},
-std::array<float,2>{0.791778028f, 0.418559819f},
-std::array<float,2>{0.0304370504f, 0.94287771f},
-std::array<float,2>{0.665577233f, 0.631108522f},
-std::array<float,2>{0.356948942f, 0.211271539f},
-std::array<float,2>{0.559058249f, 0.0540809892f},
-std::array<float,2>{0.491098225f, 0.504985631f},
-std::array<float,2>{0.93998307f, 0.832959652f},
-std::array<float,2>{0.170153275f, 0.339987636f},
-std::array<float,2>{0.726084888f, 0.382307053f},
-std::array<float,2>{0.265150815f, 0.973540366f},
-std::array<float,2>{0.855692327f, 0.677464902f},
-std::array<float,2>{0.0932123885f, 0.243444756f},
-std::array<float,2>{0.879354715f, 0.0219990071f},
-std::array<float,2>{0.198721096f, 0.56031549f},
-std::array<float,2>{0.577363312f, 0.859804451f},
-std::array<float,2>{0.430542618f, 0.344739407f},
-std::array<float,2>{0.75133425f, 0.255616277f},
-std::array<float,2>{0.036261078f, 0.806331575f},
-std::array<float,2>{0.634462774f, 0.622976065f},
-std::array<float,2>{0.331986725f, 0.0946073607f},
-std::array<float,2>{0.500043452f, 0.151832074f},
-std::array<float,2>{0.449857384f, 0.70444268f},
-std::array<float,2>{0.999213755f, 0.897707939f},
-std::array<float,2>{0.146441534f, 0.44704771f},
-std::array<float,2>{0.595319629f, 0.334926069f},
-std::array<float,2>{0.391988248f, 0.838573337f},
-std::array<float,2>{0.927553058f, 0.509994507f},
-std::array<float,2>{0.236282304f, 0.0575166643f},
-std::array<float,2>{0.821050465f, 0.206010774f},
-std::array<float,2>{0.0961179063f, 0.635563672f},
-std::array<float,2>{0.695144594f, 0.94907707f},
-std::array<float,2>{0.310616553f, 0.408332139f},
-std::array<float,2>{0.966327071f, 0.48617959f},
-std::array<float,2>{0.184479669f, 0.923748076f},
-std::array<float,2>{0.532207489f, 0.749076724f},
-std::array<float,2>{0.47485745f, 0.166294843f},
-std::array<float,2>{0.681374371f, 0.0879382342f},
-std::array<float,2>{0.369695604f, 0.59136039f},
-std::array<float,2>{0.809933126f, 0.75645411f},
-std::array<float,2>{0.014148213f, 0.311846256f},
-std::array<float,2>{0.557105899f, 0.456359446f},
-std::array<float,2>{0.487392664f, 0.879192829f},
-std::array<float,2>{0.941954076f, 0.693282247f},
-std::array<float,2>{0.16790235f, 0.13413772f},
-std::array<float,2>{0.795227289f, 0.123417914f},
-std::array<float,2>{0.0240010414f, 0.608289242f},
-std::array<float,2>{0.670711935f, 0.795625031f},
-std::array<float,2>{0.35229966f, 0.280091673f},
-std::array<float,2>{0.913222194f, 0.367369533f},
-std::array<float,2>{0.225860223f, 0.857964098f},
-std::array<float,2>{0.615104735f, 0.538289845f},
-std::array<float,2>{0.379134804f, 0.00549516547f},
-std::array<float,2>{0.717518747f, 0.224786252f},
-std::array<float,2>{0.290855467f, 0.670154333f},
-std::array<float,2>{0.840365291f, 0.989920259f},
-std::array<float,2>{0.116984919f, 0.402566969f},
-std::array<float,2>{0.649541318f, 0.293477148f},
-std::array<float,2>{0.319600075f, 0.773704529f},
-std::array<float,2>{0.781057358f, 0.564378321f},
-std::array<float,2>{0.0587077923f, 0.0684015676f},
-std::array<float,2>{0.980433404f, 0.172604471f},
-std::array<float,2>{0.135231808f, 0.731809258f},
-std::array<float,2>{0.517716646f, 0.909243524f},
-std::array<float,2>{0.463156551f, 0.470680326f},
-std::array<float,2>{0.860680699f, 0.434860587f},
-std::array<float,2>{0.068835035f, 0.957460344f},
-std::array<float,2>{0.743995368f, 0.645582259f},
-std::array<float,2>{0.270219862f, 0.196046859f},
-std::array<float,2>{0.590404987f, 0.0316178352f},
-std::array<float,2>{0.408702075f, 0.516494155f},
-std::array<float,2>{0.897193313f, 0.825819254f},
-std::array<float,2>{0.206126079f, 0.317206442f},
-std::array<float,2>{0.657690763f, 0.47728914f},
-std::array<float,2>{0.348245114f, 0.917087913f},
-std::array<float,2>{0.786619306f, 0.721614957f},
-std::array<float,2>{0.0166503079f, 0.182239398f},
-std::array<float,2>{0.950060964f, 0.0750420243f},
-std::array<float,2>{0.159202933f, 0.574838221f},
-std::array<float,2>{0.552284122f, 0.768456697f},
-std::array<float,2>{0.493314981f, 0.287361354f},
-std::array<float,2>{0.831902087f, 0.326565713f},
-std::array<float,2>{0.124364331f, 0.818452299f},
-std::array<float,2>{0.70952642f, 0.523831904f},
-std::array<float,2>{0.287786037f, 0.0443153158f},
-std::array<float,2>{0.617987752f, 0.194576934f},
-std::array<float,2>{0.383759677f, 0.649290144f},
-std::array<float,2>{0.919954002f, 0.962198675f},
-std::array<float,2>{0.228883296f, 0.422373235f},
-std::array<float,2>{0.5250265f, 0.273167759f},
-std::array<float,2>{0.457811922f, 0.783745289f},
-std::array<float,2>{0.969029367f, 0.593762457f},
-std::array<float,2>{0.129085585f, 0.110693336f},
-std::array<float,2>{0.766577721f, 0.130526304f},
-std::array<float,2>{0.0505101532f, 0.701432705f},
-std::array<float,2>{0.642502129f, 0.889507115f},
-std::array<float,2>{0.323949248f, 0.467320055f},
-std::array<float,2>{0.899932623f, 0.395173311f},
-std::array<float,2>{0.212230548f, 0.996058226f},
-std::array<float,2>{0.579942465f, 0.660359204f},
-std::array<float,2>{0.414964288f, 0.22766301f},
-std::array<float,2>{0.736013472f, 0.0110824835f},
-std::array<float,2>{0.277481645f, 0.544548571f},
-std::array<float,2>{0.872219205f, 0.84400773f},
-std::array<float,2>{0.0725832209f, 0.365349472f},
-std::array<float,2>{0.565985858f, 0.414585888f},
-std::array<float,2>{0.427437276f, 0.938921869f},
-std::array<float,2>{0.885046542f, 0.628348649f},
-std::array<float,2>{0.193610966f, 0.216662824f},
-std::array<float,2>{0.848059535f, 0.0507241189f},
-std::array<float,2>{0.0816788822f, 0.501373351f},
-std::array<float,2>{0.726701736f, 0.831550479f},
-std::array<float,2>{0.253125161f, 0.338797897f},
-std::array<float,2>{0.985353649f, 0.301003367f},
-std::array<float,2>{0.153360918f, 0.758094072f},
-std::array<float,2>{0.511914074f, 0.580190122f},
-std::array<float,2>{0.444749057f, 0.0784513801f},
-std::array<float,2>{0.628487229f, 0.162759125f},
-std::array<float,2>{0.338676989f, 0.738678515f},
-std::array<float,2>{0.760172606f, 0.934802949f},
-std::array<float,2>{0.0440953039f, 0.49316895f},
-std::array<float,2>{0.696046948f, 0.357592344f},
-std::array<float,2>{0.300670236f, 0.871595383f},
-std::array<float,2>{0.818005681f, 0.550406218f},
-std::array<float,2>{0.106190227f, 0.0303234253f},
-std::array<float,2>{0.931016207f, 0.235715434f},
-std::array<float,2>{0.243868724f, 0.685127258f},
-std::array<float,2>{0.60656321f, 0.977616131f},
-std::array<float,2>{0.401028782f, 0.388673723f},
-std::array<float,2>{0.801705778f, 0.44517076f},
-std::array<float,2>{0.00595666142f, 0.905872822f},
-std::array<float,2>{0.676018357f, 0.714978218f},
-std::array<float,2>{0.361355305f, 0.142012447f},
-std::array<float,2>{0.541301847f, 0.108004987f},
-std::array<float,2>{0.484147727f, 0.613082409f},
-std::array<float,2>{0.95493418f, 0.803377688f},
-std::array<float,2>{0.174517065f, 0.263773173f},
-std::array<float,2>{0.704810083f, 0.451242983f},
-std::array<float,2>{0.281438082f, 0.89207989f},
-std::array<float,2>{0.835676789f, 0.707374752f},
-std::array<float,2>{0.117281348f, 0.155655414f},
-std::array<float,2>{0.917909443f, 0.098871991f},
-std::array<float,2>{0.233989745f, 0.617778838f},
-std::array<float,2>{0.623469293f, 0.810183227f},
-std::array<float,2>{0.388131738f, 0.253218383f},
-std::array<float,2>{0.7842623f, 0.348583668f},
-std::array<float,2>{0.0207836702f, 0.866309941f},
-std::array<float,2>{0.660721421f, 0.556940973f},
-std::array<float,2>{0.346568853f, 0.0179499201f},
-std::array<float,2>{0.548833251f, 0.248090342f},
-std::array<float,2>{0.499497443f, 0.672550142f},
-std::array<float,2>{0.94640255f, 0.972016513f},
-std::array<float,2>{0.163378537f, 0.376565546f},
-std::array<float,2>{0.582983971f, 0.307478338f},
-std::array<float,2>{0.41940254f, 0.751963794f},
-std::array<float,2>{0.905035913f, 0.587878704f},
-std::array<float,2>{0.217405245f, 0.0931390077f},
-std::array<float,2>{0.868510544f, 0.168078482f},
-std::array<float,2>{0.0773622468f, 0.742614627f},
-std::array<float,2>{0.741369247f, 0.928281307f},
-std::array<float,2>{0.274906367f, 0.49205783f},
-std::array<float,2>{0.972792149f, 0.411460221f},
-std::array<float,2>{0.12651591f, 0.950854182f},
-std::array<float,2>{0.530777693f, 0.638683081f},
-std::array<float,2>{0.453961879f, 0.209958956f},
-std::array<float,2>{0.647571683f, 0.0586673915f},
-std::array<float,2>{0.325103968f, 0.511852205f},
-std::array<float,2>{0.77197808f, 0.840024173f},
-std::array<float,2>{0.0526419282f, 0.330162823f},
-std::array<float,2>{0.510085702f, 0.399936467f},
-std::array<float,2>{0.439906985f, 0.98461169f},
-std::array<float,2>{0.990801573f, 0.666793883f},
-std::array<float,2>{0.150394425f, 0.220339328f},
-std::array<float,2>{0.764143586f, 0.00275261467f},
-std::array<float,2>{0.0398857184f, 0.532701194f},
-std::array<float,2>{0.629764199f, 0.851571977f},
-std::array<float,2>{0.340139091f, 0.374399841f},
-std::array<float,2>{0.88884747f, 0.274192035f},
-std::array<float,2>{0.187555358f, 0.790155947f},
-std::array<float,2>{0.567569017f, 0.604933262f},
-std::array<float,2>{0.425086707f, 0.120791875f},
-std::array<float,2>{0.732566237f, 0.138412595f},
-std::array<float,2>{0.257640272f, 0.690141618f},
-std::array<float,2>{0.847046673f, 0.876327217f},
-std::array<float,2>{0.084051244f, 0.457753003f},
-std::array<float,2>{0.672976851f, 0.313318074f},
-std::array<float,2>{0.364825249f, 0.821972549f},
-std::array<float,2>{0.797598839f, 0.521269202f},
-std::array<float,2>{0.000536072941f, 0.0381902419f},
-std::array<float,2>{0.957388103f, 0.199340478f},
-std::array<float,2>{0.176967457f, 0.643076479f},
-std::array<float,2>{0.543080747f, 0.955069065f},
-std::array<float,2>{0.478556395f, 0.433302492f},
-std::array<float,2>{0.815341294f, 0.476296663f},
-std::array<float,2>{0.104498319f, 0.911222279f},
-std::array<float,2>{0.701950669f, 0.729448259f},
-std::array<float,2>{0.30264765f, 0.176501408f},
-std::array<float,2>{0.605240583f, 0.0635313839f},
-std::array<float,2>{0.405616045f, 0.568126023f},
-std::array<float,2>{0.936059117f, 0.778910935f},
-std::array<float,2>{0.246350273f, 0.29241851f},
-std::array<float,2>{0.637007654f, 0.427814841f},
-std::array<float,2>{0.332643211f, 0.96675241f},
-std::array<float,2>{0.757222056f, 0.653986275f},
-std::array<float,2>{0.0347775482f, 0.190253228f},
-std::array<float,2>{0.992298782f, 0.0429528095f},
-std::array<float,2>{0.143871635f, 0.530092299f},
-std::array<float,2>{0.506368637f, 0.815927088f},
-std::array<float,2>{0.446596503f, 0.320327163f},
-std::array<float,2>{0.852794707f, 0.283784628f},
-std::array<float,2>{0.0895894244f, 0.773062885f},
-std::array<float,2>{0.722395062f, 0.573946714f},
-std::array<float,2>{0.261174858f, 0.0728847682f},
-std::array<float,2>{0.571251094f, 0.183966696f},
-std::array<float,2>{0.434509724f, 0.724199355f},
-std::array<float,2>{0.875609994f, 0.918089509f},
-std::array<float,2>{0.202589765f, 0.480699152f},
-std::array<float,2>{0.536152482f, 0.361695886f},
-std::array<float,2>{0.47012803f, 0.848957539f},
-std::array<float,2>{0.962643623f, 0.539554417f},
-std::array<float,2>{0.182256952f, 0.0124352546f},
-std::array<float,2>{0.807833433f, 0.23122564f},
-std::array<float,2>{0.010067232f, 0.659853935f},
-std::array<float,2>{0.686100245f, 0.996552706f},
-std::array<float,2>{0.37182498f, 0.393522203f},
-std::array<float,2>{0.922249734f, 0.460999906f},
-std::array<float,2>{0.241247118f, 0.886680841f},
-std::array<float,2>{0.599522114f, 0.698563039f},
-std::array<float,2>{0.397602588f, 0.128584325f},
-std::array<float,2>{0.687770486f, 0.114713088f},
-std::array<float,2>{0.30715397f, 0.601036966f},
-std::array<float,2>{0.827339411f, 0.786897898f},
-std::array<float,2>{0.100659981f, 0.266928375f},
-std::array<float,2>{0.612839818f, 0.496259242f},
-std::array<float,2>{0.378779382f, 0.93347007f},
-std::array<float,2>{0.908155024f, 0.736974955f},
-std::array<float,2>{0.220772177f, 0.158916727f},
-std::array<float,2>{0.838117421f, 0.0823555589f},
-std::array<float,2>{0.111778282f, 0.583901227f},
-std::array<float,2>{0.712545395f, 0.76250422f},
-std::array<float,2>{0.293516219f, 0.297148824f},
-std::array<float,2>{0.937704027f, 0.342982888f},
-std::array<float,2>{0.16903384f, 0.835534513f},
-std::array<float,2>{0.561628342f, 0.506590366f},
-std::array<float,2>{0.488291383f, 0.0520156249f},
-std::array<float,2>{0.66637671f, 0.214062572f},
-std::array<float,2>{0.35916546f, 0.629592597f},
-std::array<float,2>{0.78993994f, 0.943739116f},
-std::array<float,2>{0.0279129539f, 0.420149863f},
-std::array<float,2>{0.747581244f, 0.260607272f},
-std::array<float,2>{0.268606573f, 0.799212754f},
-std::array<float,2>{0.86369139f, 0.613428593f},
-std::array<float,2>{0.0640399158f, 0.105432175f},
-std::array<float,2>{0.894225001f, 0.146475077f},
-std::array<float,2>{0.208880663f, 0.711013734f},
-std::array<float,2>{0.587009609f, 0.898593187f},
-std::array<float,2>{0.412451059f, 0.438515872f},
-std::array<float,2>{0.776429057f, 0.383488238f},
-std::array<float,2>{0.0585532486f, 0.983941555f},
-std::array<float,2>{0.652529776f, 0.683467269f},
-std::array<float,2>{0.316198975f, 0.238584265f},
-std::array<float,2>{0.523245811f, 0.0238429345f},
-std::array<float,2>{0.467969924f, 0.551940918f},
-std::array<float,2>{0.980698645f, 0.870396733f},
-std::array<float,2>{0.139744356f, 0.354907006f},
-std::array<float,2>{0.727446198f, 0.417663813f},
-std::array<float,2>{0.253827125f, 0.940852284f},
-std::array<float,2>{0.848431289f, 0.625379443f},
-std::array<float,2>{0.0813711286f, 0.217920452f},
-std::array<float,2>{0.885570288f, 0.0478016138f},
-std::array<float,2>{0.194232598f, 0.503394186f},
-std::array<float,2>{0.565892279f, 0.828216374f},
-std::array<float,2>{0.42713806f, 0.337156683f},
-std::array<float,2>{0.760511696f, 0.303838879f},
-std::array<float,2>{0.0447893701f, 0.760816336f},
-std::array<float,2>{0.628122628f, 0.57904464f},
-std::array<float,2>{0.338108569f, 0.0806573927f},
-std::array<float,2>{0.512362182f, 0.16180861f},
-std::array<float,2>{0.4448874f, 0.740265012f},
-std::array<float,2>{0.986141264f, 0.937383711f},
-std::array<float,2>{0.153822318f, 0.496018469f},
-std::array<float,2>{0.607095599f, 0.356878459f},
-std::array<float,2>{0.400562823f, 0.874029815f},
-std::array<float,2>{0.931368828f, 0.547386646f},
-std::array<float,2>{0.243440762f, 0.0290272273f},
-std::array<float,2>{0.817646503f, 0.236512363f},
-std::array<float,2>{0.105575182f, 0.687326312f},
-std::array<float,2>{0.695563436f, 0.980285823f},
-std::array<float,2>{0.299820334f, 0.387968987f},
-std::array<float,2>{0.954408944f, 0.441567421f},
-std::array<float,2>{0.173955634f, 0.903763473f},
-std::array<float,2>{0.541587889f, 0.718055665f},
-std::array<float,2>{0.483473271f, 0.143348768f},
-std::array<float,2>{0.676472008f, 0.10674116f},
-std::array<float,2>{0.361988842f, 0.610445023f},
-std::array<float,2>{0.800821841f, 0.801154196f},
-std::array<float,2>{0.00649958476f, 0.262931854f},
-std::array<float,2>{0.551794112f, 0.480335861f},
-std::array<float,2>{0.494102925f, 0.915096343f},
-std::array<float,2>{0.949674606f, 0.719277203f},
-std::array<float,2>{0.16002959f, 0.180798382f},
-std::array<float,2>{0.786837339f, 0.0764531493f},
-std::array<float,2>{0.0173792168f, 0.576365292f},
-std::array<float,2>{0.658152878f, 0.76625061f},
-std::array<float,2>{0.347749949f, 0.285717338f},
-std::array<float,2>{0.920786202f, 0.326017737f},
-std::array<float,2>{0.229417056f, 0.816863358f},
-std::array<float,2>{0.617440104f, 0.52643925f},
-std::array<float,2>{0.382936716f, 0.0461694822f},
-std::array<float,2>{0.709376335f, 0.19167906f},
-std::array<float,2>{0.287312776f, 0.650555074f},
-std::array<float,2>{0.831209004f, 0.963764071f},
-std::array<float,2>{0.124722071f, 0.424437344f},
-std::array<float,2>{0.641932368f, 0.270966381f},
-std::array<float,2>{0.323251516f, 0.781880975f},
-std::array<float,2>{0.765861869f, 0.596988201f},
-std::array<float,2>{0.0501717441f, 0.112785436f},
-std::array<float,2>{0.96932894f, 0.131694511f},
-std::array<float,2>{0.129475251f, 0.701025665f},
-std::array<float,2>{0.524597704f, 0.88801682f},
-std::array<float,2>{0.457264304f, 0.464960217f},
-std::array<float,2>{0.872586608f, 0.397046119f},
-std::array<float,2>{0.0731916502f, 0.992577791f},
-std::array<float,2>{0.735417604f, 0.662398219f},
-std::array<float,2>{0.278011709f, 0.229795098f},
-std::array<float,2>{0.579347134f, 0.00795309152f},
-std::array<float,2>{0.414217561f, 0.545797825f},
-std::array<float,2>{0.899441957f, 0.845851541f},
-std::array<float,2>{0.212608099f, 0.363619179f},
-std::array<float,2>{0.670206904f, 0.453561962f},
-std::array<float,2>{0.351945639f, 0.882252514f},
-std::array<float,2>{0.795735717f, 0.693769693f},
-std::array<float,2>{0.0235357434f, 0.136162817f},
-std::array<float,2>{0.941454411f, 0.121482223f},
-std::array<float,2>{0.167033777f, 0.606610239f},
-std::array<float,2>{0.557428956f, 0.794309139f},
-std::array<float,2>{0.488224447f, 0.278224975f},
-std::array<float,2>{0.839989185f, 0.369833201f},
-std::array<float,2>{0.116665326f, 0.855807304f},
-std::array<float,2>{0.717049003f, 0.535455525f},
-std::array<float,2>{0.290104657f, 0.00643480942f},
-std::array<float,2>{0.614341497f, 0.224570855f},
-std::array<float,2>{0.37948063f, 0.669194162f},
-std::array<float,2>{0.913912654f, 0.991258383f},
-std::array<float,2>{0.226077229f, 0.405587524f},
-std::array<float,2>{0.518460035f, 0.295049965f},
-std::array<float,2>{0.463412255f, 0.776089668f},
-std::array<float,2>{0.979627252f, 0.566197991f},
-std::array<float,2>{0.135539681f, 0.068171449f},
-std::array<float,2>{0.780478418f, 0.174539283f},
-std::array<float,2>{0.0592192002f, 0.732471645f},
-std::array<float,2>{0.650308609f, 0.907018185f},
-std::array<float,2>{0.320087463f, 0.470719635f},
-std::array<float,2>{0.896543145f, 0.435887456f},
-std::array<float,2>{0.206816018f, 0.959776044f},
-std::array<float,2>{0.590060294f, 0.646942079f},
-std::array<float,2>{0.408328921f, 0.197934061f},
-std::array<float,2>{0.743207693f, 0.0347806625f},
-std::array<float,2>{0.269598126f, 0.517815769f},
-std::array<float,2>{0.860998273f, 0.827095747f},
-std::array<float,2>{0.0692518353f, 0.319121927f},
-std::array<float,2>{0.578018844f, 0.37896511f},
-std::array<float,2>{0.429747432f, 0.975835383f},
-std::array<float,2>{0.879754663f, 0.679589391f},
-std::array<float,2>{0.199117348f, 0.24602437f},
-std::array<float,2>{0.856253386f, 0.0196379516f},
-std::array<float,2>{0.0935782492f, 0.56242013f},
-std::array<float,2>{0.725893557f, 0.862745285f},
-std::array<float,2>{0.265135616f, 0.346838713f},
-std::array<float,2>{0.999688089f, 0.25754407f},
-std::array<float,2>{0.145874456f, 0.806906819f},
-std::array<float,2>{0.500617743f, 0.623887241f},
-std::array<float,2>{0.449704707f, 0.0971751437f},
-std::array<float,2>{0.634051204f, 0.148600936f},
-std::array<float,2>{0.331097096f, 0.70638603f},
-std::array<float,2>{0.7518996f, 0.895372093f},
-std::array<float,2>{0.0368740857f, 0.447502851f},
-std::array<float,2>{0.6944381f, 0.33236891f},
-std::array<float,2>{0.311177641f, 0.836920917f},
-std::array<float,2>{0.820513129f, 0.508977532f},
-std::array<float,2>{0.0962705389f, 0.0555029362f},
-std::array<float,2>{0.927180588f, 0.203690022f},
-std::array<float,2>{0.235597f, 0.634743512f},
-std::array<float,2>{0.59503305f, 0.9453758f},
-std::array<float,2>{0.392477483f, 0.407478839f},
-std::array<float,2>{0.81054002f, 0.487588167f},
-std::array<float,2>{0.014256252f, 0.92483747f},
-std::array<float,2>{0.680850029f, 0.746331215f},
-std::array<float,2>{0.369187981f, 0.164839849f},
-std::array<float,2>{0.531262577f, 0.087558113f},
-std::array<float,2>{0.475579709f, 0.592431903f},
-std::array<float,2>{0.966079831f, 0.755025327f},
-std::array<float,2>{0.183995485f, 0.309932679f},
-std::array<float,2>{0.711994112f, 0.499371231f},
-std::array<float,2>{0.293338805f, 0.931463122f},
-std::array<float,2>{0.838441432f, 0.734617591f},
-std::array<float,2>{0.111888416f, 0.157953411f},
-std::array<float,2>{0.907345295f, 0.0842318088f},
-std::array<float,2>{0.221449852f, 0.585640967f},
-std::array<float,2>{0.61276114f, 0.764651299f},
-std::array<float,2>{0.377962083f, 0.300218701f},
-std::array<float,2>{0.789300025f, 0.340641886f},
-std::array<float,2>{0.0277865175f, 0.832430661f},
-std::array<float,2>{0.66666168f, 0.505742669f},
-std::array<float,2>{0.358424276f, 0.0544573553f},
-std::array<float,2>{0.562207341f, 0.211492524f},
-std::array<float,2>{0.489204317f, 0.631611764f},
-std::array<float,2>{0.938410401f, 0.942805648f},
-std::array<float,2>{0.169840872f, 0.41840744f},
-std::array<float,2>{0.58744359f, 0.259472787f},
-std::array<float,2>{0.412939459f, 0.798437655f},
-std::array<float,2>{0.893657207f, 0.616051614f},
-std::array<float,2>{0.208370641f, 0.102172352f},
-std::array<float,2>{0.863932073f, 0.147796899f},
-std::array<float,2>{0.0637062863f, 0.713827193f},
-std::array<float,2>{0.747468114f, 0.901891232f},
-std::array<float,2>{0.269093484f, 0.439863265f},
-std::array<float,2>{0.981203914f, 0.384821922f},
-std::array<float,2>{0.14015092f, 0.981945753f},
-std::array<float,2>{0.522485495f, 0.681493402f},
-std::array<float,2>{0.46844244f, 0.24099867f},
-std::array<float,2>{0.65288204f, 0.0263403505f},
-std::array<float,2>{0.31569761f, 0.552745044f},
-std::array<float,2>{0.776978254f, 0.868204713f},
-std::array<float,2>{0.0577510893f, 0.353339434f},
-std::array<float,2>{0.506146252f, 0.426982939f},
-std::array<float,2>{0.446994811f, 0.967854738f},
-std::array<float,2>{0.99306041f, 0.655916035f},
-std::array<float,2>{0.144187838f, 0.189007089f},
-std::array<float,2>{0.757768154f, 0.0408209898f},
-std::array<float,2>{0.0345311686f, 0.528494537f},
-std::array<float,2>{0.637604415f, 0.813907921f},
-std::array<float,2>{0.332267135f, 0.324018478f},
-std::array<float,2>{0.875442326f, 0.281323761f},
-std::array<float,2>{0.202752471f, 0.769710302f},
-std::array<float,2>{0.570523739f, 0.571493626f},
-std::array<float,2>{0.433949858f, 0.0703953579f},
-std::array<float,2>{0.722113132f, 0.185888737f},
-std::array<float,2>{0.261491954f, 0.726436734f},
-std::array<float,2>{0.853190303f, 0.921642482f},
-std::array<float,2>{0.0891472101f, 0.482596219f},
-std::array<float,2>{0.685715377f, 0.361033499f},
-std::array<float,2>{0.371577293f, 0.851250589f},
-std::array<float,2>{0.808402956f, 0.542344749f},
-std::array<float,2>{0.0106689883f, 0.0149872713f},
-std::array<float,2>{0.962399304f, 0.233351365f},
-std::array<float,2>{0.181718573f, 0.657362044f},
-std::array<float,2>{0.536857605f, 0.998933971f},
-std::array<float,2>{0.470511258f, 0.391691625f},
-std::array<float,2>{0.827924013f, 0.464049041f},
-std::array<float,2>{0.101114944f, 0.883138239f},
-std::array<float,2>{0.688248277f, 0.696453512f},
-std::array<float,2>{0.307073355f, 0.126584426f},
-std::array<float,2>{0.598832071f, 0.1158228f},
-std::array<float,2>{0.398311466f, 0.599550784f},
-std::array<float,2>{0.922492445f, 0.787534177f},
-std::array<float,2>{0.241986766f, 0.269028872f},
-std::array<float,2>{0.628991246f, 0.401867479f},
-std::array<float,2>{0.340537637f, 0.987263083f},
-std::array<float,2>{0.764538884f, 0.664546013f},
-std::array<float,2>{0.0391218029f, 0.221942753f},
-std::array<float,2>{0.990414739f, 0.00190025207f},
-std::array<float,2>{0.150919124f, 0.535005748f},
-std::array<float,2>{0.510706425f, 0.854910254f},
-std::array<float,2>{0.440367281f, 0.371450305f},
-std::array<float,2>{0.847354233f, 0.277253687f},
-std::array<float,2>{0.0846881419f, 0.792854965f},
-std::array<float,2>{0.733195543f, 0.601641953f},
-std::array<float,2>{0.257193476f, 0.11737562f},
-std::array<float,2>{0.567899406f, 0.140601635f},
-std::array<float,2>{0.425724477f, 0.688754737f},
-std::array<float,2>{0.889458835f, 0.877232134f},
-std::array<float,2>{0.188041911f, 0.459726185f},
-std::array<float,2>{0.543817997f, 0.314818978f},
-std::array<float,2>{0.47937721f, 0.822738171f},
-std::array<float,2>{0.957891285f, 0.522943854f},
-std::array<float,2>{0.177436724f, 0.0362940282f},
-std::array<float,2>{0.797056675f, 0.202320412f},
-std::array<float,2>{0.000143404526f, 0.641795814f},
-std::array<float,2>{0.67345196f, 0.956733227f},
-std::array<float,2>{0.364422262f, 0.431584656f},
-std::array<float,2>{0.935813487f, 0.472999096f},
-std::array<float,2>{0.246950656f, 0.913591802f},
-std::array<float,2>{0.604509115f, 0.727969766f},
-std::array<float,2>{0.406044275f, 0.179378778f},
-std::array<float,2>{0.70137167f, 0.0659651607f},
-std::array<float,2>{0.301961422f, 0.56843853f},
-std::array<float,2>{0.814555645f, 0.779744327f},
-std::array<float,2>{0.105275638f, 0.289836615f},
-std::array<float,2>{0.623603642f, 0.450026035f},
-std::array<float,2>{0.38844806f, 0.894004226f},
-std::array<float,2>{0.91713202f, 0.709391177f},
-std::array<float,2>{0.233426347f, 0.153671101f},
-std::array<float,2>{0.835363328f, 0.101217434f},
-std::array<float,2>{0.118124038f, 0.620668292f},
-std::array<float,2>{0.704249382f, 0.811613679f},
-std::array<float,2>{0.28220588f, 0.251770616f},
-std::array<float,2>{0.94689846f, 0.350505799f},
-std::array<float,2>{0.163914353f, 0.863961101f},
-std::array<float,2>{0.549638987f, 0.555864751f},
-std::array<float,2>{0.499958217f, 0.0173330437f},
-std::array<float,2>{0.660396576f, 0.248027056f},
-std::array<float,2>{0.345915079f, 0.674885154f},
-std::array<float,2>{0.785031259f, 0.969895661f},
-std::array<float,2>{0.0210298076f, 0.378231943f},
-std::array<float,2>{0.741957605f, 0.305204362f},
-std::array<float,2>{0.274576515f, 0.750838399f},
-std::array<float,2>{0.868995428f, 0.589071214f},
-std::array<float,2>{0.077653788f, 0.0904656649f},
-std::array<float,2>{0.904304683f, 0.171264291f},
-std::array<float,2>{0.216822341f, 0.745735109f},
-std::array<float,2>{0.582275689f, 0.927728176f},
-std::array<float,2>{0.419921279f, 0.4897618f},
-std::array<float,2>{0.771634221f, 0.413066268f},
-std::array<float,2>{0.0519244559f, 0.951755345f},
-std::array<float,2>{0.648428857f, 0.63792783f},
-std::array<float,2>{0.324528486f, 0.208566457f},
-std::array<float,2>{0.530648172f, 0.0623105131f},
-std::array<float,2>{0.453523397f, 0.514086366f},
-std::array<float,2>{0.973524392f, 0.84223336f},
-std::array<float,2>{0.126265675f, 0.328735858f},
-std::array<float,2>{0.697421432f, 0.389178067f},
-std::array<float,2>{0.298334092f, 0.978361011f},
-std::array<float,2>{0.819105506f, 0.684656501f},
-std::array<float,2>{0.108668044f, 0.235990003f},
-std::array<float,2>{0.931905329f, 0.0312287342f},
-std::array<float,2>{0.244777724f, 0.550078094f},
-std::array<float,2>{0.607537806f, 0.871329844f},
-std::array<float,2>{0.399079978f, 0.357913971f},
-std::array<float,2>{0.803571701f, 0.264214784f},
-std::array<float,2>{0.00501857558f, 0.803112924f},
-std::array<float,2>{0.678280532f, 0.612740338f},
-std::array<float,2>{0.360695839f, 0.107798852f},
-std::array<float,2>{0.540875256f, 0.142161518f},
-std::array<float,2>{0.480573416f, 0.71570152f},
-std::array<float,2>{0.955927193f, 0.905389667f},
-std::array<float,2>{0.1726107f, 0.444504708f},
-std::array<float,2>{0.564415872f, 0.338264167f},
-std::array<float,2>{0.428046882f, 0.831460416f},
-std::array<float,2>{0.88298595f, 0.501577675f},
-std::array<float,2>{0.192617297f, 0.050003767f},
-std::array<float,2>{0.851409853f, 0.21603848f},
-std::array<float,2>{0.0783862695f, 0.628505588f},
-std::array<float,2>{0.729626954f, 0.939385056f},
-std::array<float,2>{0.251382858f, 0.414088041f},
-std::array<float,2>{0.98702389f, 0.494027585f},
-std::array<float,2>{0.154522806f, 0.935358763f},
-std::array<float,2>{0.513880908f, 0.739026785f},
-std::array<float,2>{0.441894352f, 0.162122563f},
-std::array<float,2>{0.625683486f, 0.0787037238f},
-std::array<float,2>{0.336890697f, 0.580616176f},
-std::array<float,2>{0.759742677f, 0.758480906f},
-std::array<float,2>{0.0453839861f, 0.301403701f},
-std::array<float,2>{0.527049601f, 0.467257828f},
-std::array<float,2>{0.46016556f, 0.88872838f},
-std::array<float,2>{0.971834838f, 0.702022314f},
-std::array<float,2>{0.132195026f, 0.130169228f},
-std::array<float,2>{0.768059134f, 0.111016966f},
-std::array<float,2>{0.0476703718f, 0.594712615f},
-std::array<float,2>{0.644209206f, 0.783420324f},
-std::array<float,2>{0.32164678f, 0.27274245f},
-std::array<float,2>{0.901080966f, 0.365989327f},
-std::array<float,2>{0.214605674f, 0.84469378f},
-std::array<float,2>{0.580975473f, 0.54438889f},
-std::array<float,2>{0.41660127f, 0.0116023691f},
-std::array<float,2>{0.737026036f, 0.228170365f},
-std::array<float,2>{0.280231357f, 0.660687029f},
-std::array<float,2>{0.873783767f, 0.995301664f},
-std::array<float,2>{0.0706874505f, 0.394780219f},
-std::array<float,2>{0.659866095f, 0.287800103f},
-std::array<float,2>{0.351199478f, 0.768013656f},
-std::array<float,2>{0.787898719f, 0.574295402f},
-std::array<float,2>{0.0184626523f, 0.0744886473f},
-std::array<float,2>{0.953058004f, 0.18208307f},
-std::array<float,2>{0.157861128f, 0.720916569f},
-std::array<float,2>{0.554320335f, 0.917637885f},
-std::array<float,2>{0.495515972f, 0.476970792f},
-std::array<float,2>{0.828474402f, 0.422320724f},
-std::array<float,2>{0.122232005f, 0.962745309f},
-std::array<float,2>{0.708871901f, 0.648566842f},
-std::array<float,2>{0.285185516f, 0.194877386f},
-std::array<float,2>{0.620212913f, 0.0448254347f},
-std::array<float,2>{0.384832025f, 0.52433306f},
-std::array<float,2>{0.919717431f, 0.819313109f},
-std::array<float,2>{0.226711884f, 0.3268736f},
-std::array<float,2>{0.65227437f, 0.469925642f},
-std::array<float,2>{0.317649841f, 0.909988642f},
-std::array<float,2>{0.777464867f, 0.732039034f},
-std::array<float,2>{0.0613735244f, 0.17208685f},
-std::array<float,2>{0.977644205f, 0.0690910667f},
-std::array<float,2>{0.134465918f, 0.563552976f},
-std::array<float,2>{0.516723156f, 0.774267375f},
-std::array<float,2>{0.461799264f, 0.293049961f},
-std::array<float,2>{0.862746298f, 0.316617191f},
-std::array<float,2>{0.0664113089f, 0.82521683f},
-std::array<float,2>{0.744218886f, 0.515878737f},
-std::array<float,2>{0.273019731f, 0.0320847631f},
-std::array<float,2>{0.592555106f, 0.195776075f},
-std::array<float,2>{0.406710058f, 0.646319389f},
-std::array<float,2>{0.894648194f, 0.957923472f},
-std::array<float,2>{0.20455119f, 0.435427666f},
-std::array<float,2>{0.555145085f, 0.279408783f},
-std::array<float,2>{0.484546423f, 0.795353353f},
-std::array<float,2>{0.945300519f, 0.607750952f},
-std::array<float,2>{0.164812967f, 0.123745628f},
-std::array<float,2>{0.793129444f, 0.134387314f},
-std::array<float,2>{0.0256354939f, 0.692469776f},
-std::array<float,2>{0.668591917f, 0.879412889f},
-std::array<float,2>{0.354614079f, 0.456901699f},
-std::array<float,2>{0.910658062f, 0.403185427f},
-std::array<float,2>{0.224242508f, 0.989622533f},
-std::array<float,2>{0.615336061f, 0.670696914f},
-std::array<float,2>{0.381498128f, 0.225543976f},
-std::array<float,2>{0.715281785f, 0.00512817781f},
-std::array<float,2>{0.291926652f, 0.538817048f},
-std::array<float,2>{0.843480408f, 0.857835472f},
-std::array<float,2>{0.113928601f, 0.367942214f},
-std::array<float,2>{0.596362233f, 0.409160346f},
-std::array<float,2>{0.39444837f, 0.948683977f},
-std::array<float,2>{0.928668141f, 0.63515383f},
-std::array<float,2>{0.236360639f, 0.205248177f},
-std::array<float,2>{0.823147774f, 0.0570572205f},
-std::array<float,2>{0.0944077969f, 0.510560334f},
-std::array<float,2>{0.69288522f, 0.838136375f},
-std::array<float,2>{0.309927881f, 0.334286124f},
-std::array<float,2>{0.968524396f, 0.312467247f},
-std::array<float,2>{0.186670855f, 0.755896807f},
-std::array<float,2>{0.534421861f, 0.590859294f},
-std::array<float,2>{0.473438114f, 0.0885043591f},
-std::array<float,2>{0.681950092f, 0.166940853f},
-std::array<float,2>{0.368715376f, 0.749578238f},
-std::array<float,2>{0.81229043f, 0.92295891f},
-std::array<float,2>{0.0120430412f, 0.48541984f},
-std::array<float,2>{0.722750247f, 0.345328778f},
-std::array<float,2>{0.262633026f, 0.8599599f},
-std::array<float,2>{0.858606815f, 0.559861243f},
-std::array<float,2>{0.0911022127f, 0.021625746f},
-std::array<float,2>{0.881136358f, 0.244031414f},
-std::array<float,2>{0.19620648f, 0.677091539f},
-std::array<float,2>{0.575343609f, 0.972807884f},
-std::array<float,2>{0.432276577f, 0.382520348f},
-std::array<float,2>{0.753551304f, 0.446507096f},
-std::array<float,2>{0.0384655073f, 0.898314595f},
-std::array<float,2>{0.635996163f, 0.704917908f},
-std::array<float,2>{0.329432398f, 0.151876688f},
-std::array<float,2>{0.503211617f, 0.0940716118f},
-std::array<float,2>{0.453027576f, 0.622496605f},
-std::array<float,2>{0.997683764f, 0.806107521f},
-std::array<float,2>{0.148414001f, 0.255272001f},
-std::array<float,2>{0.748332739f, 0.43911922f},
-std::array<float,2>{0.26635322f, 0.899312496f},
-std::array<float,2>{0.866273344f, 0.711485863f},
-std::array<float,2>{0.06555482f, 0.14563328f},
-std::array<float,2>{0.892521203f, 0.104566835f},
-std::array<float,2>{0.210053325f, 0.614150286f},
-std::array<float,2>{0.589691877f, 0.799410462f},
-std::array<float,2>{0.410837859f, 0.260048896f},
-std::array<float,2>{0.773548782f, 0.355158985f},
-std::array<float,2>{0.0556663759f, 0.870724976f},
-std::array<float,2>{0.654365599f, 0.552268028f},
-std::array<float,2>{0.314038724f, 0.0243633706f},
-std::array<float,2>{0.520249784f, 0.239078f},
-std::array<float,2>{0.46581772f, 0.683010817f},
-std::array<float,2>{0.984197855f, 0.983551204f},
-std::array<float,2>{0.137027666f, 0.383060873f},
-std::array<float,2>{0.610755861f, 0.297589898f},
-std::array<float,2>{0.375062764f, 0.761917293f},
-std::array<float,2>{0.909906507f, 0.583341002f},
-std::array<float,2>{0.219949916f, 0.0828423128f},
-std::array<float,2>{0.837684035f, 0.158370823f},
-std::array<float,2>{0.110452525f, 0.736714303f},
-std::array<float,2>{0.71462816f, 0.933079243f},
-std::array<float,2>{0.296215475f, 0.496970892f},
-std::array<float,2>{0.939859629f, 0.420518249f},
-std::array<float,2>{0.170818985f, 0.944219768f},
-std::array<float,2>{0.559462547f, 0.629000664f},
-std::array<float,2>{0.490545303f, 0.214831889f},
-std::array<float,2>{0.665239692f, 0.0525185317f},
-std::array<float,2>{0.356762946f, 0.506003439f},
-std::array<float,2>{0.791071355f, 0.835282922f},
-std::array<float,2>{0.0312183425f, 0.343629032f},
-std::array<float,2>{0.537552297f, 0.392969757f},
-std::array<float,2>{0.471063226f, 0.996935725f},
-std::array<float,2>{0.963573515f, 0.659388125f},
-std::array<float,2>{0.180512026f, 0.230777949f},
-std::array<float,2>{0.805209994f, 0.0120725688f},
-std::array<float,2>{0.00861942582f, 0.539423227f},
-std::array<float,2>{0.683704019f, 0.849193096f},
-std::array<float,2>{0.373676986f, 0.362024069f},
-std::array<float,2>{0.924689353f, 0.267113179f},
-std::array<float,2>{0.238878474f, 0.78628999f},
-std::array<float,2>{0.601201713f, 0.601355791f},
-std::array<float,2>{0.39456448f, 0.114803798f},
-std::array<float,2>{0.691349089f, 0.128106982f},
-std::array<float,2>{0.305155069f, 0.699091077f},
-std::array<float,2>{0.824884117f, 0.885760605f},
-std::array<float,2>{0.0985417217f, 0.461757481f},
-std::array<float,2>{0.638814449f, 0.320817977f},
-std::array<float,2>{0.335494131f, 0.815880239f},
-std::array<float,2>{0.755069256f, 0.529355705f},
-std::array<float,2>{0.0318926051f, 0.0420478359f},
-std::array<float,2>{0.994492173f, 0.189859122f},
-std::array<float,2>{0.14082098f, 0.653785706f},
-std::array<float,2>{0.505005836f, 0.966065466f},
-std::array<float,2>{0.448389888f, 0.428461701f},
-std::array<float,2>{0.855224729f, 0.481153429f},
-std::array<float,2>{0.0877787173f, 0.918491185f},
-std::array<float,2>{0.718813658f, 0.723806024f},
-std::array<float,2>{0.257956237f, 0.184105933f},
-std::array<float,2>{0.574019611f, 0.0724627972f},
-std::array<float,2>{0.437422931f, 0.573538721f},
-std::array<float,2>{0.878126502f, 0.77284199f},
-std::array<float,2>{0.200519323f, 0.283254325f},
-std::array<float,2>{0.675386786f, 0.433026969f},
-std::array<float,2>{0.366194367f, 0.954541504f},
-std::array<float,2>{0.80065918f, 0.642665207f},
-std::array<float,2>{0.00235147099f, 0.199871078f},
-std::array<float,2>{0.960318923f, 0.0387673117f},
-std::array<float,2>{0.179207489f, 0.520700932f},
-std::array<float,2>{0.545078754f, 0.821383834f},
-std::array<float,2>{0.47689268f, 0.312958747f},
-std::array<float,2>{0.812781155f, 0.292751461f},
-std::array<float,2>{0.102188982f, 0.77862817f},
-std::array<float,2>{0.70090884f, 0.567494392f},
-std::array<float,2>{0.304455608f, 0.0641762391f},
-std::array<float,2>{0.60351038f, 0.175879061f},
-std::array<float,2>{0.403089553f, 0.728760481f},
-std::array<float,2>{0.934557676f, 0.911948204f},
-std::array<float,2>{0.248851284f, 0.475776374f},
-std::array<float,2>{0.508996427f, 0.374902487f},
-std::array<float,2>{0.43800047f, 0.852068305f},
-std::array<float,2>{0.988393009f, 0.533167362f},
-std::array<float,2>{0.148818716f, 0.00218529347f},
-std::array<float,2>{0.763100505f, 0.219834343f},
-std::array<float,2>{0.0423429124f, 0.666476846f},
-std::array<float,2>{0.632487476f, 0.98522377f},
-std::array<float,2>{0.341959983f, 0.399888635f},
-std::array<float,2>{0.888382077f, 0.457359791f},
-std::array<float,2>{0.190817386f, 0.876889467f},
-std::array<float,2>{0.569591165f, 0.68946141f},
-std::array<float,2>{0.422397882f, 0.13810505f},
-std::array<float,2>{0.731859267f, 0.120281585f},
-std::array<float,2>{0.25428465f, 0.605032504f},
-std::array<float,2>{0.843842208f, 0.790752113f},
-std::array<float,2>{0.0824313089f, 0.273699194f},
-std::array<float,2>{0.585601568f, 0.491651565f},
-std::array<float,2>{0.420032263f, 0.927938819f},
-std::array<float,2>{0.903344691f, 0.743124068f},
-std::array<float,2>{0.215651691f, 0.168813318f},
-std::array<float,2>{0.869278014f, 0.0937008187f},
-std::array<float,2>{0.0753516778f, 0.587116301f},
-std::array<float,2>{0.739631474f, 0.752716064f},
-std::array<float,2>{0.275402188f, 0.306649387f},
-std::array<float,2>{0.975980282f, 0.331049651f},
-std::array<float,2>{0.12734957f, 0.840706587f},
-std::array<float,2>{0.527610362f, 0.512694001f},
-std::array<float,2>{0.456080586f, 0.0595424585f},
-std::array<float,2>{0.645814061f, 0.209165782f},
-std::array<float,2>{0.327787071f, 0.639439166f},
-std::array<float,2>{0.770404518f, 0.950416625f},
-std::array<float,2>{0.0545658395f, 0.411838591f},
-std::array<float,2>{0.705673277f, 0.253767312f},
-std::array<float,2>{0.285015225f, 0.809768558f},
-std::array<float,2>{0.83294791f, 0.617207468f},
-std::array<float,2>{0.120375566f, 0.0991276801f},
-std::array<float,2>{0.915275812f, 0.156234056f},
-std::array<float,2>{0.231406346f, 0.707785666f},
-std::array<float,2>{0.622481406f, 0.892344773f},
-std::array<float,2>{0.390310556f, 0.452022761f},
-std::array<float,2>{0.78217572f, 0.376290113f},
-std::array<float,2>{0.0223972369f, 0.972438395f},
-std::array<float,2>{0.662744045f, 0.671972215f},
-std::array<float,2>{0.344721466f, 0.248626769f},
-std::array<float,2>{0.547276795f, 0.0183197167f},
-std::array<float,2>{0.496916413f, 0.557225645f},
-std::array<float,2>{0.948482096f, 0.866749763f},
-std::array<float,2>{0.161910176f, 0.347697228f},
-std::array<float,2>{0.707595527f, 0.425416976f},
-std::array<float,2>{0.286467075f, 0.964553475f},
-std::array<float,2>{0.829890192f, 0.651699483f},
-std::array<float,2>{0.121454671f, 0.192519173f},
-std::array<float,2>{0.918909729f, 0.0453940853f},
-std::array<float,2>{0.227562666f, 0.525886834f},
-std::array<float,2>{0.619980395f, 0.81826359f},
-std::array<float,2>{0.386363924f, 0.324733734f},
-std::array<float,2>{0.788264275f, 0.286185324f},
-std::array<float,2>{0.0189980082f, 0.767372966f},
-std::array<float,2>{0.658996105f, 0.577537f},
-std::array<float,2>{0.350204498f, 0.0776190013f},
-std::array<float,2>{0.552900732f, 0.18024613f},
-std::array<float,2>{0.494147658f, 0.720172763f},
-std::array<float,2>{0.951240897f, 0.914367795f},
-std::array<float,2>{0.15657036f, 0.479245633f},
-std::array<float,2>{0.581506252f, 0.364498973f},
-std::array<float,2>{0.417766958f, 0.846949816f},
-std::array<float,2>{0.902057409f, 0.5461061f},
-std::array<float,2>{0.213021249f, 0.00895700138f},
-std::array<float,2>{0.874710739f, 0.228886977f},
-std::array<float,2>{0.0720629543f, 0.663899958f},
-std::array<float,2>{0.737536311f, 0.993636072f},
-std::array<float,2>{0.28077054f, 0.39805311f},
-std::array<float,2>{0.971678436f, 0.465866297f},
-std::array<float,2>{0.131194219f, 0.88743341f},
-std::array<float,2>{0.525576413f, 0.699690104f},
-std::array<float,2>{0.459161639f, 0.132527083f},
-std::array<float,2>{0.643323779f, 0.111378133f},
-std::array<float,2>{0.320811838f, 0.596587956f},
-std::array<float,2>{0.769421101f, 0.782500744f},
-std::array<float,2>{0.0482907444f, 0.269546092f},
-std::array<float,2>{0.515302181f, 0.494216055f},
-std::array<float,2>{0.442503244f, 0.935949206f},
-std::array<float,2>{0.988020718f, 0.742008567f},
-std::array<float,2>{0.156148463f, 0.160379857f},
-std::array<float,2>{0.758749604f, 0.0818930492f},
-std::array<float,2>{0.0460928902f, 0.579836369f},
-std::array<float,2>{0.626425147f, 0.760732532f},
-std::array<float,2>{0.337354183f, 0.30277887f},
-std::array<float,2>{0.883909464f, 0.336261243f},
-std::array<float,2>{0.191494033f, 0.830076814f},
-std::array<float,2>{0.562626183f, 0.502821386f},
-std::array<float,2>{0.429095417f, 0.0487309098f},
-std::array<float,2>{0.729390442f, 0.217496023f},
-std::array<float,2>{0.250382096f, 0.626856923f},
-std::array<float,2>{0.849943638f, 0.940170109f},
-std::array<float,2>{0.0796425566f, 0.416466236f},
-std::array<float,2>{0.679401159f, 0.262158036f},
-std::array<float,2>{0.359635353f, 0.802351594f},
-std::array<float,2>{0.804542661f, 0.609377265f},
-std::array<float,2>{0.00447887043f, 0.105755992f},
-std::array<float,2>{0.957030952f, 0.144024327f},
-std::array<float,2>{0.17302011f, 0.717163384f},
-std::array<float,2>{0.539722443f, 0.902631223f},
-std::array<float,2>{0.481629252f, 0.442868799f},
-std::array<float,2>{0.819548428f, 0.387481004f},
-std::array<float,2>{0.108396001f, 0.979336739f},
-std::array<float,2>{0.698314786f, 0.686320841f},
-std::array<float,2>{0.297452122f, 0.237902194f},
-std::array<float,2>{0.609125912f, 0.0278581101f},
-std::array<float,2>{0.399417967f, 0.548756957f},
-std::array<float,2>{0.933220088f, 0.873143315f},
-std::array<float,2>{0.245974556f, 0.355565399f},
-std::array<float,2>{0.635197163f, 0.449049324f},
-std::array<float,2>{0.328444719f, 0.89621973f},
-std::array<float,2>{0.752062023f, 0.705635846f},
-std::array<float,2>{0.0380441509f, 0.149505511f},
-std::array<float,2>{0.996791601f, 0.0966792181f},
-std::array<float,2>{0.147181123f, 0.624796331f},
-std::array<float,2>{0.502906024f, 0.807830989f},
-std::array<float,2>{0.451980531f, 0.256400645f},
-std::array<float,2>{0.857812643f, 0.346544594f},
-std::array<float,2>{0.0906298161f, 0.862230301f},
-std::array<float,2>{0.724434078f, 0.561098337f},
-std::array<float,2>{0.262811333f, 0.0214003641f},
-std::array<float,2>{0.574671805f, 0.244786397f},
-std::array<float,2>{0.432759285f, 0.678193331f},
-std::array<float,2>{0.882270694f, 0.97514981f},
-std::array<float,2>{0.196510807f, 0.380542606f},
-std::array<float,2>{0.533493638f, 0.309020191f},
-std::array<float,2>{0.47391817f, 0.754855275f},
-std::array<float,2>{0.966921687f, 0.593115926f},
-std::array<float,2>{0.185768455f, 0.0867280215f},
-std::array<float,2>{0.810558796f, 0.165971234f},
-std::array<float,2>{0.0127518084f, 0.747074008f},
-std::array<float,2>{0.682722747f, 0.923829854f},
-std::array<float,2>{0.367647767f, 0.486477137f},
-std::array<float,2>{0.929354548f, 0.406267494f},
-std::array<float,2>{0.238093376f, 0.946674466f},
-std::array<float,2>{0.59669435f, 0.633389771f},
-std::array<float,2>{0.392628342f, 0.204246864f},
-std::array<float,2>{0.691472769f, 0.0562732071f},
-std::array<float,2>{0.309037596f, 0.508514643f},
-std::array<float,2>{0.823852777f, 0.836200178f},
-std::array<float,2>{0.095656462f, 0.333799154f},
-std::array<float,2>{0.61648953f, 0.404524922f},
-std::array<float,2>{0.382221788f, 0.990735829f},
-std::array<float,2>{0.911256611f, 0.668156564f},
-std::array<float,2>{0.223393217f, 0.222780645f},
-std::array<float,2>{0.841987431f, 0.00746675394f},
-std::array<float,2>{0.114392422f, 0.536893547f},
-std::array<float,2>{0.716343582f, 0.857216895f},
-std::array<float,2>{0.292439938f, 0.371088058f},
-std::array<float,2>{0.943498135f, 0.279072315f},
-std::array<float,2>{0.165918648f, 0.793108463f},
-std::array<float,2>{0.555897176f, 0.605987608f},
-std::array<float,2>{0.485689372f, 0.122698486f},
-std::array<float,2>{0.669848621f, 0.135720849f},
-std::array<float,2>{0.354234785f, 0.694617748f},
-std::array<float,2>{0.79431951f, 0.88133049f},
-std::array<float,2>{0.02695732f, 0.454735219f},
-std::array<float,2>{0.745119095f, 0.320291489f},
-std::array<float,2>{0.271857619f, 0.827477157f},
-std::array<float,2>{0.862099588f, 0.519447565f},
-std::array<float,2>{0.0674143732f, 0.0334221311f},
-std::array<float,2>{0.895682275f, 0.198850721f},
-std::array<float,2>{0.203344718f, 0.647543192f},
-std::array<float,2>{0.59293288f, 0.960237265f},
-std::array<float,2>{0.407810956f, 0.436877489f},
-std::array<float,2>{0.779197991f, 0.472450286f},
-std::array<float,2>{0.0623374656f, 0.908170342f},
-std::array<float,2>{0.651061058f, 0.733432889f},
-std::array<float,2>{0.316590637f, 0.175036922f},
-std::array<float,2>{0.516381145f, 0.0665117055f},
-std::array<float,2>{0.461919427f, 0.565046191f},
-std::array<float,2>{0.977193534f, 0.77724427f},
-std::array<float,2>{0.133390352f, 0.296574324f},
-std::array<float,2>{0.720399857f, 0.483958304f},
-std::array<float,2>{0.259110481f, 0.920874953f},
-std::array<float,2>{0.853697419f, 0.725467324f},
-std::array<float,2>{0.0863947347f, 0.186986357f},
-std::array<float,2>{0.877897203f, 0.0713925511f},
-std::array<float,2>{0.199224904f, 0.571014166f},
-std::array<float,2>{0.572872102f, 0.771105766f},
-std::array<float,2>{0.436422288f, 0.283019483f},
-std::array<float,2>{0.754801035f, 0.322622687f},
-std::array<float,2>{0.033021763f, 0.81303978f},
-std::array<float,2>{0.640100598f, 0.527700961f},
-std::array<float,2>{0.334484637f, 0.0392006226f},
-std::array<float,2>{0.503973961f, 0.187679455f},
-std::array<float,2>{0.448224902f, 0.654791951f},
-std::array<float,2>{0.996075571f, 0.967404664f},
-std::array<float,2>{0.142405376f, 0.426571965f},
-std::array<float,2>{0.600143015f, 0.267609358f},
-std::array<float,2>{0.395959586f, 0.788821518f},
-std::array<float,2>{0.925651073f, 0.597922206f},
-std::array<float,2>{0.240205511f, 0.116455592f},
-std::array<float,2>{0.826021492f, 0.125697494f},
-std::array<float,2>{0.0988821983f, 0.695694506f},
-std::array<float,2>{0.689732552f, 0.884330332f},
-std::array<float,2>{0.30611074f, 0.463756382f},
-std::array<float,2>{0.964645445f, 0.391384274f},
-std::array<float,2>{0.181322321f, 0.999892712f},
-std::array<float,2>{0.538826466f, 0.657039046f},
-std::array<float,2>{0.47212851f, 0.234199286f},
-std::array<float,2>{0.68522799f, 0.0144549934f},
-std::array<float,2>{0.374850512f, 0.541948974f},
-std::array<float,2>{0.806566775f, 0.850425422f},
-std::array<float,2>{0.00943034049f, 0.359707713f},
-std::array<float,2>{0.560339451f, 0.41921562f},
-std::array<float,2>{0.491621077f, 0.942155957f},
-std::array<float,2>{0.940574825f, 0.631897867f},
-std::array<float,2>{0.171032459f, 0.212348282f},
-std::array<float,2>{0.792026103f, 0.0536185056f},
-std::array<float,2>{0.0301250257f, 0.504498065f},
-std::array<float,2>{0.664304376f, 0.83363378f},
-std::array<float,2>{0.35638085f, 0.341761559f},
-std::array<float,2>{0.908658862f, 0.299126923f},
-std::array<float,2>{0.219144255f, 0.764270484f},
-std::array<float,2>{0.609508812f, 0.584198177f},
-std::array<float,2>{0.376601577f, 0.0850986615f},
-std::array<float,2>{0.713525355f, 0.156621337f},
-std::array<float,2>{0.295336694f, 0.736217022f},
-std::array<float,2>{0.836345673f, 0.930641294f},
-std::array<float,2>{0.109617472f, 0.49831602f},
-std::array<float,2>{0.655285478f, 0.352081001f},
-std::array<float,2>{0.313078821f, 0.867980361f},
-std::array<float,2>{0.775259674f, 0.55376029f},
-std::array<float,2>{0.055659838f, 0.0265124887f},
-std::array<float,2>{0.982656121f, 0.241461977f},
-std::array<float,2>{0.137956306f, 0.679944217f},
-std::array<float,2>{0.520924032f, 0.981199741f},
-std::array<float,2>{0.466148049f, 0.38660717f},
-std::array<float,2>{0.865896404f, 0.441101611f},
-std::array<float,2>{0.0648473278f, 0.901094437f},
-std::array<float,2>{0.749121785f, 0.714217544f},
-std::array<float,2>{0.266679496f, 0.147186488f},
-std::array<float,2>{0.588791728f, 0.102991194f},
-std::array<float,2>{0.412085444f, 0.616226137f},
-std::array<float,2>{0.891279995f, 0.797600269f},
-std::array<float,2>{0.209081173f, 0.258206636f},
-std::array<float,2>{0.663964272f, 0.377028823f},
-std::array<float,2>{0.344965011f, 0.969635129f},
-std::array<float,2>{0.782487392f, 0.674320877f},
-std::array<float,2>{0.0226063319f, 0.246506691f},
-std::array<float,2>{0.947652221f, 0.0161391869f},
-std::array<float,2>{0.160672873f, 0.554861128f},
-std::array<float,2>{0.547896087f, 0.865062416f},
-std::array<float,2>{0.49798432f, 0.351354122f},
-std::array<float,2>{0.833169162f, 0.250363857f},
-std::array<float,2>{0.119979277f, 0.811084032f},
-std::array<float,2>{0.706529319f, 0.620078206f},
-std::array<float,2>{0.283307791f, 0.099697344f},
-std::array<float,2>{0.621949017f, 0.153062567f},
-std::array<float,2>{0.389029026f, 0.710007727f},
-std::array<float,2>{0.914938986f, 0.893110394f},
-std::array<float,2>{0.231728271f, 0.451079518f},
-std::array<float,2>{0.528447151f, 0.329816788f},
-std::array<float,2>{0.455890626f, 0.843728006f},
-std::array<float,2>{0.974996865f, 0.514887035f},
-std::array<float,2>{0.128103971f, 0.0615146235f},
-std::array<float,2>{0.770658016f, 0.207398653f},
-std::array<float,2>{0.0533145033f, 0.637108028f},
-std::array<float,2>{0.645121038f, 0.952490866f},
-std::array<float,2>{0.326730251f, 0.41356349f},
-std::array<float,2>{0.903244674f, 0.488496989f},
-std::array<float,2>{0.215864971f, 0.925809622f},
-std::array<float,2>{0.584604383f, 0.744158506f},
-std::array<float,2>{0.421596587f, 0.170813233f},
-std::array<float,2>{0.738310456f, 0.0910806805f},
-std::array<float,2>{0.276385456f, 0.588406861f},
-std::array<float,2>{0.8702178f, 0.751430333f},
-std::array<float,2>{0.0743676201f, 0.305878967f},
-std::array<float,2>{0.568724334f, 0.460344315f},
-std::array<float,2>{0.423433274f, 0.878355443f},
-std::array<float,2>{0.887494743f, 0.688131273f},
-std::array<float,2>{0.189661309f, 0.139097124f},
-std::array<float,2>{0.845411062f, 0.118522048f},
-std::array<float,2>{0.0831339732f, 0.603369057f},
-std::array<float,2>{0.73078984f, 0.791917443f},
-std::array<float,2>{0.255364269f, 0.275909841f},
-std::array<float,2>{0.989595234f, 0.372731715f},
-std::array<float,2>{0.149555475f, 0.853841484f},
-std::array<float,2>{0.507960677f, 0.533514082f},
-std::array<float,2>{0.438499838f, 0.00071392837f},
-std::array<float,2>{0.631070495f, 0.220989496f},
-std::array<float,2>{0.343103677f, 0.665272355f},
-std::array<float,2>{0.762379289f, 0.988226533f},
-std::array<float,2>{0.0418557152f, 0.40113613f},
-std::array<float,2>{0.699821353f, 0.290694863f},
-std::array<float,2>{0.303477049f, 0.780418694f},
-std::array<float,2>{0.814007819f, 0.570286751f},
-std::array<float,2>{0.103425518f, 0.0652759448f},
-std::array<float,2>{0.935190558f, 0.178461105f},
-std::array<float,2>{0.249260694f, 0.726648271f},
-std::array<float,2>{0.602276266f, 0.912665963f},
-std::array<float,2>{0.403666288f, 0.47403416f},
-std::array<float,2>{0.799440861f, 0.42970261f},
-std::array<float,2>{0.00353416568f, 0.955703914f},
-std::array<float,2>{0.674391031f, 0.640706301f},
-std::array<float,2>{0.36627534f, 0.201445192f},
-std::array<float,2>{0.545981228f, 0.0356793925f},
-std::array<float,2>{0.478353918f, 0.5220052f},
-std::array<float,2>{0.959935546f, 0.823425591f},
-std::array<float,2>{0.178551197f, 0.31591019f},
-std::array<float,2>{0.73463577f, 0.396387219f},
-std::array<float,2>{0.278338909f, 0.994602859f},
-std::array<float,2>{0.871537685f, 0.66120398f},
-std::array<float,2>{0.0741568357f, 0.226782426f},
-std::array<float,2>{0.898597658f, 0.0104073752f},
-std::array<float,2>{0.211314976f, 0.543279707f},
-std::array<float,2>{0.57877326f, 0.845029056f},
-std::array<float,2>{0.41559425f, 0.367046207f},
-std::array<float,2>{0.76704067f, 0.271835744f},
-std::array<float,2>{0.0489519686f, 0.784474432f},
-std::array<float,2>{0.640894592f, 0.594947636f},
-std::array<float,2>{0.322461367f, 0.109914228f},
-std::array<float,2>{0.523822248f, 0.128967434f},
-std::array<float,2>{0.458846837f, 0.702393472f},
-std::array<float,2>{0.970573783f, 0.889900684f},
-std::array<float,2>{0.13060531f, 0.468063831f},
-std::array<float,2>{0.619040847f, 0.327183962f},
-std::array<float,2>{0.384117126f, 0.819945157f},
-std::array<float,2>{0.921319366f, 0.524455905f},
-std::array<float,2>{0.229895994f, 0.0430879407f},
-std::array<float,2>{0.83017993f, 0.193679884f},
-std::array<float,2>{0.123980455f, 0.650018871f},
-std::array<float,2>{0.710689247f, 0.96189177f},
-std::array<float,2>{0.288278252f, 0.422864527f},
-std::array<float,2>{0.950398028f, 0.477916062f},
-std::array<float,2>{0.158326402f, 0.916742504f},
-std::array<float,2>{0.551472187f, 0.72183466f},
-std::array<float,2>{0.492637604f, 0.182885855f},
-std::array<float,2>{0.656482995f, 0.0758274496f},
-std::array<float,2>{0.349199057f, 0.575718582f},
-std::array<float,2>{0.785690844f, 0.76928246f},
-std::array<float,2>{0.0156979542f, 0.288375556f},
-std::array<float,2>{0.542681575f, 0.443999201f},
-std::array<float,2>{0.482623756f, 0.904989958f},
-std::array<float,2>{0.953506172f, 0.715947092f},
-std::array<float,2>{0.175298899f, 0.140865773f},
-std::array<float,2>{0.802378297f, 0.108835213f},
-std::array<float,2>{0.00686413888f, 0.611874044f},
-std::array<float,2>{0.677325308f, 0.804079831f},
-std::array<float,2>{0.362841934f, 0.26541549f},
-std::array<float,2>{0.930463314f, 0.359087825f},
-std::array<float,2>{0.243074179f, 0.872417986f},
-std::array<float,2>{0.606008708f, 0.549638391f},
-std::array<float,2>{0.40179795f, 0.0299427118f},
-std::array<float,2>{0.696929634f, 0.235036567f},
-std::array<float,2>{0.29905054f, 0.684528053f},
-std::array<float,2>{0.817207634f, 0.977408946f},
-std::array<float,2>{0.107389085f, 0.390022665f},
-std::array<float,2>{0.627107978f, 0.302354902f},
-std::array<float,2>{0.339780271f, 0.759254873f},
-std::array<float,2>{0.761410713f, 0.582005203f},
-std::array<float,2>{0.0436906964f, 0.079870984f},
-std::array<float,2>{0.985103905f, 0.163569048f},
-std::array<float,2>{0.153227419f, 0.739583313f},
-std::array<float,2>{0.513463616f, 0.934086025f},
-std::array<float,2>{0.443876147f, 0.492243528f},
-std::array<float,2>{0.848772883f, 0.415514618f},
-std::array<float,2>{0.0807911828f, 0.938007236f},
-std::array<float,2>{0.728185177f, 0.627407074f},
-std::array<float,2>{0.252748758f, 0.214903191f},
-std::array<float,2>{0.564490557f, 0.0489447713f},
-std::array<float,2>{0.425906032f, 0.500598669f},
-std::array<float,2>{0.886111259f, 0.830481172f},
-std::array<float,2>{0.195206314f, 0.339330107f},
-std::array<float,2>{0.680115163f, 0.484874636f},
-std::array<float,2>{0.371038795f, 0.922768235f},
-std::array<float,2>{0.80898577f, 0.748337626f},
-std::array<float,2>{0.0154630104f, 0.167543039f},
-std::array<float,2>{0.96553421f, 0.0890997946f},
-std::array<float,2>{0.18509829f, 0.59066081f},
-std::array<float,2>{0.533004701f, 0.757370651f},
-std::array<float,2>{0.476016223f, 0.310789675f},
-std::array<float,2>{0.821657002f, 0.33527109f},
-std::array<float,2>{0.0969560966f, 0.839777112f},
-std::array<float,2>{0.694237769f, 0.510929704f},
-std::array<float,2>{0.311970145f, 0.0581904277f},
-std::array<float,2>{0.593997359f, 0.206901193f},
-std::array<float,2>{0.391111374f, 0.635768235f},
-std::array<float,2>{0.926341951f, 0.947497487f},
-std::array<float,2>{0.234778091f, 0.409549028f},
-std::array<float,2>{0.501058459f, 0.254185855f},
-std::array<float,2>{0.450320214f, 0.805577159f},
-std::array<float,2>{0.998737454f, 0.621775806f},
-std::array<float,2>{0.14461714f, 0.0955964029f},
-std::array<float,2>{0.750033259f, 0.150478214f},
-std::array<float,2>{0.0356855281f, 0.703487515f},
-std::array<float,2>{0.632952511f, 0.897458553f},
-std::array<float,2>{0.330967337f, 0.445968121f},
-std::array<float,2>{0.88079679f, 0.38102144f},
-std::array<float,2>{0.197271436f, 0.974607825f},
-std::array<float,2>{0.576257765f, 0.67599237f},
-std::array<float,2>{0.430921912f, 0.242895648f},
-std::array<float,2>{0.724610567f, 0.0233951807f},
-std::array<float,2>{0.263794512f, 0.559048772f},
-std::array<float,2>{0.856878996f, 0.860818088f},
-std::array<float,2>{0.0924248472f, 0.344186336f},
-std::array<float,2>{0.591473758f, 0.433730066f},
-std::array<float,2>{0.410130978f, 0.958456576f},
-std::array<float,2>{0.897624552f, 0.644995451f},
-std::array<float,2>{0.205374509f, 0.196757957f},
-std::array<float,2>{0.859513819f, 0.0330127031f},
-std::array<float,2>{0.0697490647f, 0.516778648f},
-std::array<float,2>{0.742863476f, 0.8245821f},
-std::array<float,2>{0.270626128f, 0.318104118f},
-std::array<float,2>{0.979160488f, 0.293958426f},
-std::array<float,2>{0.135855317f, 0.775015831f},
-std::array<float,2>{0.519128263f, 0.562994003f},
-std::array<float,2>{0.464201242f, 0.0696026981f},
-std::array<float,2>{0.648745358f, 0.173387095f},
-std::array<float,2>{0.318643004f, 0.731297672f},
-std::array<float,2>{0.779846489f, 0.908949912f},
-std::array<float,2>{0.0596737228f, 0.469226331f},
-std::array<float,2>{0.718046546f, 0.36896801f},
-std::array<float,2>{0.289349347f, 0.859191537f},
-std::array<float,2>{0.840870857f, 0.537554443f},
-std::array<float,2>{0.115933754f, 0.00446208101f},
-std::array<float,2>{0.912552655f, 0.22617045f},
-std::array<float,2>{0.225477263f, 0.671648324f},
-std::array<float,2>{0.613397539f, 0.989063799f},
-std::array<float,2>{0.380304903f, 0.403873354f},
-std::array<float,2>{0.795934558f, 0.455493331f},
-std::array<float,2>{0.0251808036f, 0.880712986f},
-std::array<float,2>{0.671264529f, 0.691774249f},
-std::array<float,2>{0.352660537f, 0.133323789f},
-std::array<float,2>{0.557745934f, 0.124895647f},
-std::array<float,2>{0.486451626f, 0.609288096f},
-std::array<float,2>{0.942881763f, 0.79626447f},
-std::array<float,2>{0.166939616f, 0.280695707f},
-std::array<float,2>{0.688794374f, 0.462464213f},
-std::array<float,2>{0.308294356f, 0.885392606f},
-std::array<float,2>{0.826842844f, 0.697691083f},
-std::array<float,2>{0.100173891f, 0.127480149f},
-std::array<float,2>{0.923519194f, 0.113777496f},
-std::array<float,2>{0.240413159f, 0.599692047f},
-std::array<float,2>{0.598501086f, 0.786076605f},
-std::array<float,2>{0.396780163f, 0.266583532f},
-std::array<float,2>{0.807540536f, 0.362340689f},
-std::array<float,2>{0.0114539657f, 0.848551631f},
-std::array<float,2>{0.686905444f, 0.540116131f},
-std::array<float,2>{0.372195899f, 0.0129667763f},
-std::array<float,2>{0.536034703f, 0.232125372f},
-std::array<float,2>{0.468822509f, 0.65820545f},
-std::array<float,2>{0.961105108f, 0.9978984f},
-std::array<float,2>{0.183488771f, 0.393926769f},
-std::array<float,2>{0.571727872f, 0.284871906f},
-std::array<float,2>{0.434820622f, 0.771972835f},
-std::array<float,2>{0.87622273f, 0.573226333f},
-std::array<float,2>{0.201420054f, 0.0735732466f},
-std::array<float,2>{0.852228999f, 0.18539536f},
-std::array<float,2>{0.0880724043f, 0.722879112f},
-std::array<float,2>{0.721474171f, 0.919847906f},
-std::array<float,2>{0.260186106f, 0.482280314f},
-std::array<float,2>{0.993513107f, 0.4294855f},
-std::array<float,2>{0.142957628f, 0.965700507f},
-std::array<float,2>{0.50733614f, 0.653210163f},
-std::array<float,2>{0.445330888f, 0.191368371f},
-std::array<float,2>{0.637779534f, 0.041795142f},
-std::array<float,2>{0.33375001f, 0.531161308f},
-std::array<float,2>{0.75639689f, 0.814968526f},
-std::array<float,2>{0.0333029963f, 0.322243214f},
-std::array<float,2>{0.522288859f, 0.384234875f},
-std::array<float,2>{0.467428774f, 0.982812166f},
-std::array<float,2>{0.981928408f, 0.682606637f},
-std::array<float,2>{0.139417484f, 0.239465863f},
-std::array<float,2>{0.775777757f, 0.024842402f},
-std::array<float,2>{0.0573499426f, 0.551721513f},
-std::array<float,2>{0.653750598f, 0.869874656f},
-std::array<float,2>{0.314475834f, 0.35414663f},
-std::array<float,2>{0.893499851f, 0.261523634f},
-std::array<float,2>{0.207593858f, 0.800160587f},
-std::array<float,2>{0.586102962f, 0.61445564f},
-std::array<float,2>{0.413510501f, 0.10397099f},
-std::array<float,2>{0.746850908f, 0.14475891f},
-std::array<float,2>{0.267930806f, 0.712471366f},
-std::array<float,2>{0.86502254f, 0.899723709f},
-std::array<float,2>{0.0627626181f, 0.438368857f},
-std::array<float,2>{0.667178571f, 0.342120916f},
-std::array<float,2>{0.357791424f, 0.834572613f},
-std::array<float,2>{0.79099673f, 0.50737977f},
-std::array<float,2>{0.0291071348f, 0.0513473004f},
-std::array<float,2>{0.938946068f, 0.213773876f},
-std::array<float,2>{0.168184072f, 0.629903078f},
-std::array<float,2>{0.560866952f, 0.944448471f},
-std::array<float,2>{0.489955723f, 0.42117855f},
-std::array<float,2>{0.83922267f, 0.497192949f},
-std::array<float,2>{0.11240638f, 0.932430506f},
-std::array<float,2>{0.711085916f, 0.738068044f},
-std::array<float,2>{0.294875681f, 0.159189805f},
-std::array<float,2>{0.611527205f, 0.083137013f},
-std::array<float,2>{0.377074689f, 0.582503676f},
-std::array<float,2>{0.906479836f, 0.763461113f},
-std::array<float,2>{0.222432226f, 0.298253149f},
-std::array<float,2>{0.64722985f, 0.41031161f},
-std::array<float,2>{0.326082647f, 0.949305534f},
-std::array<float,2>{0.77302146f, 0.639988005f},
-std::array<float,2>{0.0509642996f, 0.210319817f},
-std::array<float,2>{0.974296033f, 0.0599835888f},
-std::array<float,2>{0.125598446f, 0.51348424f},
-std::array<float,2>{0.529789627f, 0.841486573f},
-std::array<float,2>{0.454746097f, 0.331795812f},
-std::array<float,2>{0.867272913f, 0.307640105f},
-std::array<float,2>{0.0767993778f, 0.753511131f},
-std::array<float,2>{0.740866363f, 0.586903334f},
-std::array<float,2>{0.274072379f, 0.0925584808f},
-std::array<float,2>{0.58342272f, 0.169772997f},
-std::array<float,2>{0.418046445f, 0.743668079f},
-std::array<float,2>{0.905415893f, 0.929360569f},
-std::array<float,2>{0.218630448f, 0.49078241f},
-std::array<float,2>{0.550110638f, 0.349547237f},
-std::array<float,2>{0.498456091f, 0.865502834f},
-std::array<float,2>{0.945911169f, 0.55822134f},
-std::array<float,2>{0.162686691f, 0.018632574f},
-std::array<float,2>{0.783435106f, 0.249891281f},
-std::array<float,2>{0.0200533196f, 0.673290491f},
-std::array<float,2>{0.661281049f, 0.971281826f},
-std::array<float,2>{0.347296774f, 0.37586084f},
-std::array<float,2>{0.916950524f, 0.452246577f},
-std::array<float,2>{0.232514054f, 0.890810192f},
-std::array<float,2>{0.624136567f, 0.708372831f},
-std::array<float,2>{0.387089014f, 0.154435188f},
-std::array<float,2>{0.703836977f, 0.0983448178f},
-std::array<float,2>{0.282924533f, 0.618882835f},
-std::array<float,2>{0.834466338f, 0.809237123f},
-std::array<float,2>{0.118183166f, 0.252405405f},
-std::array<float,2>{0.604147136f, 0.475562155f},
-std::array<float,2>{0.405123323f, 0.910481572f},
-std::array<float,2>{0.937102079f, 0.73003906f},
-std::array<float,2>{0.247263432f, 0.17731221f},
-std::array<float,2>{0.815707386f, 0.0631637424f},
-std::array<float,2>{0.103941776f, 0.566956222f},
-std::array<float,2>{0.702359796f, 0.777577937f},
-std::array<float,2>{0.301115006f, 0.291299671f},
-std::array<float,2>{0.958110332f, 0.31437698f},
-std::array<float,2>{0.176500276f, 0.820938647f},
-std::array<float,2>{0.544084489f, 0.520415843f},
-std::array<float,2>{0.480177671f, 0.0373406895f},
-std::array<float,2>{0.672455668f, 0.200394034f},
-std::array<float,2>{0.363521963f, 0.643737495f},
-std::array<float,2>{0.798808694f, 0.953152597f},
-std::array<float,2>{0.00144382147f, 0.431842148f},
-std::array<float,2>{0.73370111f, 0.275184691f},
-std::array<float,2>{0.256210029f, 0.789640546f},
-std::array<float,2>{0.846425354f, 0.603518546f},
-std::array<float,2>{0.085853979f, 0.119333148f},
-std::array<float,2>{0.89005965f, 0.136885837f},
-std::array<float,2>{0.188495427f, 0.690580785f},
-std::array<float,2>{0.566654742f, 0.875100076f},
-std::array<float,2>{0.424714774f, 0.458572686f},
-std::array<float,2>{0.765119255f, 0.399086922f},
-std::array<float,2>{0.0404123813f, 0.98592037f},
-std::array<float,2>{0.630596638f, 0.667073011f},
-std::array<float,2>{0.341008872f, 0.219012514f},
-std::array<float,2>{0.511135638f, 0.00363629474f},
-std::array<float,2>{0.440866977f, 0.532151759f},
-std::array<float,2>{0.991327167f, 0.85301888f},
-std::array<float,2>{0.151980013f, 0.37328127f}}
\ No newline at end of file
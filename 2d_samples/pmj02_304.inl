@@ -1,4096 +0,0 @@
-{std::array<float,2>{0.14994441f, 0.0991990045f},
-std::array<float,2>{0.501734912f, 0.719213784f},
-std::array<float,2>{0.252643108f, 0.938758552f},
-std::array<float,2>{0.759164631f, 0.253928572f},
-std::array<float,2>{0.389040977f, 0.439218372f},
-std::array<float,2>{0.891939521f, 0.82988143f},
-std::array<float,2>{0.0644432008f, 0.533818066f},
-std::array<float,2>{0.654505014f, 0.170035943f},
-std::array<float,2>{0.334533989f, 0.228615344f},
-std::array<float,2>{0.834519744f, 0.572276294f},
-std::array<float,2>{0.23709166f, 0.750043392f},
-std::array<float,2>{0.60213846f, 0.404554874f},
-std::array<float,2>{0.0378314629f, 0.329459518f},
-std::array<float,2>{0.732778847f, 0.93405062f},
-std::array<float,2>{0.464283198f, 0.632972538f},
-std::array<float,2>{0.977075934f, 0.0554432422f},
-std::array<float,2>{0.123101048f, 0.144228682f},
-std::array<float,2>{0.668024659f, 0.516407549f},
-std::array<float,2>{0.435604215f, 0.849483192f},
-std::array<float,2>{0.910563052f, 0.472690672f},
-std::array<float,2>{0.281903952f, 0.296308547f},
-std::array<float,2>{0.805599093f, 0.988979638f},
-std::array<float,2>{0.178263038f, 0.68773818f},
-std::array<float,2>{0.562053442f, 0.0910249874f},
-std::array<float,2>{0.471483022f, 0.000988955959f},
-std::array<float,2>{0.950813711f, 0.656503201f},
-std::array<float,2>{0.0124828806f, 0.890458286f},
-std::array<float,2>{0.702164412f, 0.36993885f},
-std::array<float,2>{0.205683589f, 0.409511089f},
-std::array<float,2>{0.569269896f, 0.797907591f},
-std::array<float,2>{0.364067435f, 0.623645067f},
-std::array<float,2>{0.868375778f, 0.192200452f},
-std::array<float,2>{0.0157325584f, 0.0427394882f},
-std::array<float,2>{0.709255695f, 0.64200896f},
-std::array<float,2>{0.499701887f, 0.919336081f},
-std::array<float,2>{0.965640783f, 0.326510698f},
-std::array<float,2>{0.345739335f, 0.381590664f},
-std::array<float,2>{0.847310781f, 0.773694515f},
-std::array<float,2>{0.190869927f, 0.581665576f},
-std::array<float,2>{0.582014024f, 0.24860768f},
-std::array<float,2>{0.417707086f, 0.180974036f},
-std::array<float,2>{0.933799744f, 0.559497714f},
-std::array<float,2>{0.105706573f, 0.82156378f},
-std::array<float,2>{0.687446892f, 0.466774434f},
-std::array<float,2>{0.159918278f, 0.279344618f},
-std::array<float,2>{0.54476589f, 0.95570612f},
-std::array<float,2>{0.310088217f, 0.747575343f},
-std::array<float,2>{0.789687574f, 0.117328033f},
-std::array<float,2>{0.22076042f, 0.208929181f},
-std::array<float,2>{0.611726165f, 0.594218314f},
-std::array<float,2>{0.316743821f, 0.787393034f},
-std::array<float,2>{0.816791832f, 0.423096091f},
-std::array<float,2>{0.438122481f, 0.353015602f},
-std::array<float,2>{0.985096216f, 0.892566442f},
-std::array<float,2>{0.0579271019f, 0.680909812f},
-std::array<float,2>{0.748657107f, 0.0277773868f},
-std::array<float,2>{0.280469507f, 0.0646859482f},
-std::array<float,2>{0.770302892f, 0.718352199f},
-std::array<float,2>{0.132665515f, 0.974518478f},
-std::array<float,2>{0.521772206f, 0.304225773f},
-std::array<float,2>{0.0860580802f, 0.490846217f},
-std::array<float,2>{0.638906002f, 0.864884377f},
-std::array<float,2>{0.401668549f, 0.501688957f},
-std::array<float,2>{0.879998684f, 0.137623444f},
-std::array<float,2>{0.195726097f, 0.0204119086f},
-std::array<float,2>{0.586586118f, 0.674244642f},
-std::array<float,2>{0.353941619f, 0.903067291f},
-std::array<float,2>{0.85280627f, 0.350361615f},
-std::array<float,2>{0.488404691f, 0.434020698f},
-std::array<float,2>{0.956965744f, 0.792508543f},
-std::array<float,2>{0.0273515638f, 0.609122753f},
-std::array<float,2>{0.717225909f, 0.217856914f},
-std::array<float,2>{0.300254941f, 0.125983641f},
-std::array<float,2>{0.788466871f, 0.510749519f},
-std::array<float,2>{0.164738178f, 0.873297632f},
-std::array<float,2>{0.534829617f, 0.49730283f},
-std::array<float,2>{0.0961533412f, 0.312095344f},
-std::array<float,2>{0.678775311f, 0.982596219f},
-std::array<float,2>{0.407283574f, 0.703154743f},
-std::array<float,2>{0.926537216f, 0.0705852807f},
-std::array<float,2>{0.0495182574f, 0.237115636f},
-std::array<float,2>{0.739110649f, 0.591732264f},
-std::array<float,2>{0.451181561f, 0.771932125f},
-std::array<float,2>{0.992811441f, 0.38969183f},
-std::array<float,2>{0.327011973f, 0.317374557f},
-std::array<float,2>{0.821847141f, 0.909642875f},
-std::array<float,2>{0.230393693f, 0.648709297f},
-std::array<float,2>{0.62310791f, 0.0357944146f},
-std::array<float,2>{0.391054153f, 0.116434343f},
-std::array<float,2>{0.889796317f, 0.740768611f},
-std::array<float,2>{0.0855738819f, 0.964964092f},
-std::array<float,2>{0.631668806f, 0.272190034f},
-std::array<float,2>{0.136913642f, 0.45603931f},
-std::array<float,2>{0.52879256f, 0.813108206f},
-std::array<float,2>{0.272716194f, 0.547481179f},
-std::array<float,2>{0.780687988f, 0.173630893f},
-std::array<float,2>{0.0740990862f, 0.0853831843f},
-std::array<float,2>{0.641088784f, 0.700959563f},
-std::array<float,2>{0.378562123f, 0.998161197f},
-std::array<float,2>{0.903556824f, 0.284321129f},
-std::array<float,2>{0.258730561f, 0.480887622f},
-std::array<float,2>{0.751209915f, 0.85698235f},
-std::array<float,2>{0.144739911f, 0.52349472f},
-std::array<float,2>{0.510848403f, 0.149188876f},
-std::array<float,2>{0.456631184f, 0.201213703f},
-std::array<float,2>{0.971824288f, 0.614243984f},
-std::array<float,2>{0.0402158201f, 0.810623288f},
-std::array<float,2>{0.719008923f, 0.418239683f},
-std::array<float,2>{0.248286739f, 0.365726024f},
-std::array<float,2>{0.600566328f, 0.880114734f},
-std::array<float,2>{0.336996973f, 0.665023088f},
-std::array<float,2>{0.839823961f, 0.0139386924f},
-std::array<float,2>{0.18104735f, 0.156753331f},
-std::array<float,2>{0.549013793f, 0.539899766f},
-std::array<float,2>{0.289280683f, 0.841166198f},
-std::array<float,2>{0.79820329f, 0.452251554f},
-std::array<float,2>{0.424348593f, 0.263644874f},
-std::array<float,2>{0.916509628f, 0.952549219f},
-std::array<float,2>{0.112297848f, 0.727109551f},
-std::array<float,2>{0.662641227f, 0.102272339f},
-std::array<float,2>{0.373974651f, 0.0500544496f},
-std::array<float,2>{0.861470401f, 0.626505077f},
-std::array<float,2>{0.214772329f, 0.923146904f},
-std::array<float,2>{0.576693237f, 0.337697029f},
-std::array<float,2>{0.00632049376f, 0.391396463f},
-std::array<float,2>{0.690170467f, 0.759036005f},
-std::array<float,2>{0.482187748f, 0.567883193f},
-std::array<float,2>{0.938555598f, 0.22570309f},
-std::array<float,2>{0.238883451f, 0.0759516954f},
-std::array<float,2>{0.606000662f, 0.710012376f},
-std::array<float,2>{0.328983009f, 0.977600038f},
-std::array<float,2>{0.829606533f, 0.306655914f},
-std::array<float,2>{0.466221929f, 0.49255684f},
-std::array<float,2>{0.98267442f, 0.868613362f},
-std::array<float,2>{0.0325205773f, 0.513439655f},
-std::array<float,2>{0.728994191f, 0.131029293f},
-std::array<float,2>{0.254503459f, 0.21170339f},
-std::array<float,2>{0.765046239f, 0.602789223f},
-std::array<float,2>{0.153829917f, 0.795984685f},
-std::array<float,2>{0.505902112f, 0.43306458f},
-std::array<float,2>{0.0677671731f, 0.345263809f},
-std::array<float,2>{0.651072443f, 0.899849296f},
-std::array<float,2>{0.386459172f, 0.676893651f},
-std::array<float,2>{0.895080328f, 0.0192937367f},
-std::array<float,2>{0.00883279834f, 0.177795157f},
-std::array<float,2>{0.697134793f, 0.554336488f},
-std::array<float,2>{0.475400716f, 0.816931665f},
-std::array<float,2>{0.945565403f, 0.457772762f},
-std::array<float,2>{0.362996876f, 0.267934561f},
-std::array<float,2>{0.872556865f, 0.961307764f},
-std::array<float,2>{0.209578529f, 0.736064732f},
-std::array<float,2>{0.56607008f, 0.112916075f},
-std::array<float,2>{0.432937205f, 0.0333824269f},
-std::array<float,2>{0.907829821f, 0.652951181f},
-std::array<float,2>{0.118603148f, 0.913959801f},
-std::array<float,2>{0.667184889f, 0.312877119f},
-std::array<float,2>{0.172924146f, 0.383096427f},
-std::array<float,2>{0.556147337f, 0.769340932f},
-std::array<float,2>{0.28690958f, 0.58921957f},
-std::array<float,2>{0.808599949f, 0.241193533f},
-std::array<float,2>{0.104950346f, 0.00952237099f},
-std::array<float,2>{0.681548774f, 0.671103358f},
-std::array<float,2>{0.419554293f, 0.876889765f},
-std::array<float,2>{0.930173218f, 0.360777348f},
-std::array<float,2>{0.307350546f, 0.417911381f},
-std::array<float,2>{0.79673326f, 0.806182981f},
-std::array<float,2>{0.16123116f, 0.612199545f},
-std::array<float,2>{0.541088402f, 0.195738956f},
-std::array<float,2>{0.49393636f, 0.152710304f},
-std::array<float,2>{0.96099925f, 0.527943313f},
-std::array<float,2>{0.0213881992f, 0.854983985f},
-std::array<float,2>{0.705011964f, 0.476802498f},
-std::array<float,2>{0.192325845f, 0.286971718f},
-std::array<float,2>{0.58462137f, 0.995284081f},
-std::array<float,2>{0.347980529f, 0.696362674f},
-std::array<float,2>{0.851122558f, 0.0816763118f},
-std::array<float,2>{0.12566857f, 0.220595062f},
-std::array<float,2>{0.51742965f, 0.566313505f},
-std::array<float,2>{0.275260597f, 0.761893034f},
-std::array<float,2>{0.768512309f, 0.394991338f},
-std::array<float,2>{0.403097391f, 0.342184097f},
-std::array<float,2>{0.878245771f, 0.92881918f},
-std::array<float,2>{0.0906268954f, 0.629341185f},
-std::array<float,2>{0.636189342f, 0.0530383177f},
-std::array<float,2>{0.312753707f, 0.109009847f},
-std::array<float,2>{0.81444186f, 0.732763052f},
-std::array<float,2>{0.223617226f, 0.948619008f},
-std::array<float,2>{0.614782691f, 0.25800854f},
-std::array<float,2>{0.0614329726f, 0.445835829f},
-std::array<float,2>{0.745212317f, 0.838686824f},
-std::array<float,2>{0.444359332f, 0.545390487f},
-std::array<float,2>{0.989361882f, 0.162738681f},
-std::array<float,2>{0.169918358f, 0.0613424107f},
-std::array<float,2>{0.538307309f, 0.637197912f},
-std::array<float,2>{0.304502726f, 0.931506455f},
-std::array<float,2>{0.782852888f, 0.334003806f},
-std::array<float,2>{0.410399497f, 0.399243265f},
-std::array<float,2>{0.922509134f, 0.753976583f},
-std::array<float,2>{0.101031147f, 0.578118443f},
-std::array<float,2>{0.673128784f, 0.234009981f},
-std::array<float,2>{0.3567743f, 0.16773206f},
-std::array<float,2>{0.859297276f, 0.535917819f},
-std::array<float,2>{0.202924818f, 0.83560729f},
-std::array<float,2>{0.590811253f, 0.442949891f},
-std::array<float,2>{0.0269083381f, 0.250745445f},
-std::array<float,2>{0.714378476f, 0.941655517f},
-std::array<float,2>{0.485129625f, 0.724732041f},
-std::array<float,2>{0.960379601f, 0.0959082469f},
-std::array<float,2>{0.078617394f, 0.189181894f},
-std::array<float,2>{0.625197709f, 0.619457304f},
-std::array<float,2>{0.397738218f, 0.800994754f},
-std::array<float,2>{0.8836869f, 0.413176358f},
-std::array<float,2>{0.26648736f, 0.374632329f},
-std::array<float,2>{0.774080157f, 0.884704649f},
-std::array<float,2>{0.135725141f, 0.661438465f},
-std::array<float,2>{0.526260316f, 0.0067682825f},
-std::array<float,2>{0.4483805f, 0.0889355615f},
-std::array<float,2>{0.999193192f, 0.693679869f},
-std::array<float,2>{0.0508480929f, 0.985141098f},
-std::array<float,2>{0.736898601f, 0.290600598f},
-std::array<float,2>{0.231101468f, 0.47180137f},
-std::array<float,2>{0.617683828f, 0.8437953f},
-std::array<float,2>{0.323821366f, 0.520939767f},
-std::array<float,2>{0.827595949f, 0.145861894f},
-std::array<float,2>{0.0437373146f, 0.123794593f},
-std::array<float,2>{0.723085105f, 0.74487102f},
-std::array<float,2>{0.459852725f, 0.958624363f},
-std::array<float,2>{0.975538671f, 0.276255578f},
-std::array<float,2>{0.340320647f, 0.464518547f},
-std::array<float,2>{0.842864752f, 0.827449143f},
-std::array<float,2>{0.243140772f, 0.556687415f},
-std::array<float,2>{0.595195293f, 0.18519333f},
-std::array<float,2>{0.382562459f, 0.244476095f},
-std::array<float,2>{0.90213573f, 0.58230412f},
-std::array<float,2>{0.0773783848f, 0.780455232f},
-std::array<float,2>{0.64731288f, 0.377532542f},
-std::array<float,2>{0.142098695f, 0.322514176f},
-std::array<float,2>{0.513936102f, 0.914448142f},
-std::array<float,2>{0.263345242f, 0.647131562f},
-std::array<float,2>{0.756933689f, 0.0464118123f},
-std::array<float,2>{0.217326462f, 0.13502188f},
-std::array<float,2>{0.571369767f, 0.504213989f},
-std::array<float,2>{0.369544536f, 0.861053705f},
-std::array<float,2>{0.864615798f, 0.486893892f},
-std::array<float,2>{0.477473021f, 0.297446102f},
-std::array<float,2>{0.94420588f, 0.971257985f},
-std::array<float,2>{0.00203247136f, 0.711850882f},
-std::array<float,2>{0.694402397f, 0.0681044534f},
-std::array<float,2>{0.296345323f, 0.0260963906f},
-std::array<float,2>{0.804269016f, 0.684744716f},
-std::array<float,2>{0.187490523f, 0.895695567f},
-std::array<float,2>{0.552327633f, 0.355863333f},
-std::array<float,2>{0.114479415f, 0.426207006f},
-std::array<float,2>{0.658960938f, 0.782644033f},
-std::array<float,2>{0.427703857f, 0.599481702f},
-std::array<float,2>{0.919076324f, 0.203733727f},
-std::array<float,2>{0.17660448f, 0.092614837f},
-std::array<float,2>{0.559746444f, 0.689804435f},
-std::array<float,2>{0.284503609f, 0.991297722f},
-std::array<float,2>{0.808080852f, 0.293536246f},
-std::array<float,2>{0.435205698f, 0.475290447f},
-std::array<float,2>{0.912648737f, 0.850412548f},
-std::array<float,2>{0.122821517f, 0.519302547f},
-std::array<float,2>{0.670696497f, 0.141771033f},
-std::array<float,2>{0.366810381f, 0.195043832f},
-std::array<float,2>{0.869428515f, 0.62260282f},
-std::array<float,2>{0.203809246f, 0.798951209f},
-std::array<float,2>{0.567082763f, 0.407276988f},
-std::array<float,2>{0.014126542f, 0.36732921f},
-std::array<float,2>{0.700590014f, 0.887792408f},
-std::array<float,2>{0.469575465f, 0.65833503f},
-std::array<float,2>{0.952528238f, 0.0029897776f},
-std::array<float,2>{0.0659387335f, 0.168294713f},
-std::array<float,2>{0.654189825f, 0.53182137f},
-std::array<float,2>{0.387549162f, 0.8304919f},
-std::array<float,2>{0.892869115f, 0.440076917f},
-std::array<float,2>{0.251123756f, 0.257618219f},
-std::array<float,2>{0.761667192f, 0.94130522f},
-std::array<float,2>{0.151579112f, 0.721092641f},
-std::array<float,2>{0.502119422f, 0.101011097f},
-std::array<float,2>{0.461252779f, 0.0568728633f},
-std::array<float,2>{0.979774177f, 0.635165393f},
-std::array<float,2>{0.0357126407f, 0.937426209f},
-std::array<float,2>{0.732417166f, 0.331658185f},
-std::array<float,2>{0.234582976f, 0.403052896f},
-std::array<float,2>{0.60495019f, 0.752882659f},
-std::array<float,2>{0.333978802f, 0.571602046f},
-std::array<float,2>{0.833505929f, 0.226970613f},
-std::array<float,2>{0.0565413684f, 0.0309264436f},
-std::array<float,2>{0.747255921f, 0.683244467f},
-std::array<float,2>{0.441196233f, 0.894511163f},
-std::array<float,2>{0.988246143f, 0.354700297f},
-std::array<float,2>{0.319945276f, 0.425194651f},
-std::array<float,2>{0.818990469f, 0.787048459f},
-std::array<float,2>{0.219604522f, 0.597106814f},
-std::array<float,2>{0.610486269f, 0.20954071f},
-std::array<float,2>{0.400097609f, 0.139041021f},
-std::array<float,2>{0.880874217f, 0.50204736f},
-std::array<float,2>{0.088786222f, 0.866057277f},
-std::array<float,2>{0.636938214f, 0.489884704f},
-std::array<float,2>{0.130734429f, 0.302258998f},
-std::array<float,2>{0.521476686f, 0.976437807f},
-std::array<float,2>{0.278336018f, 0.716145158f},
-std::array<float,2>{0.771654785f, 0.063083671f},
-std::array<float,2>{0.188770637f, 0.24635835f},
-std::array<float,2>{0.57893908f, 0.579519808f},
-std::array<float,2>{0.345549583f, 0.776052117f},
-std::array<float,2>{0.845085263f, 0.380193502f},
-std::array<float,2>{0.496136576f, 0.326006532f},
-std::array<float,2>{0.968499899f, 0.92045337f},
-std::array<float,2>{0.018347092f, 0.643247485f},
-std::array<float,2>{0.70747292f, 0.0407250971f},
-std::array<float,2>{0.312450469f, 0.120395802f},
-std::array<float,2>{0.792919397f, 0.748750865f},
-std::array<float,2>{0.157564297f, 0.954070985f},
-std::array<float,2>{0.546240985f, 0.278242052f},
-std::array<float,2>{0.108975954f, 0.467843711f},
-std::array<float,2>{0.684097052f, 0.823925614f},
-std::array<float,2>{0.414390832f, 0.562444568f},
-std::array<float,2>{0.937470734f, 0.181829065f},
-std::array<float,2>{0.228143752f, 0.0373378582f},
-std::array<float,2>{0.622245967f, 0.651785135f},
-std::array<float,2>{0.325252414f, 0.90703541f},
-std::array<float,2>{0.822607458f, 0.318782687f},
-std::array<float,2>{0.4510324f, 0.388585061f},
-std::array<float,2>{0.995481908f, 0.771023273f},
-std::array<float,2>{0.0469347835f, 0.592603326f},
-std::array<float,2>{0.741385162f, 0.235380337f},
-std::array<float,2>{0.27103585f, 0.175624922f},
-std::array<float,2>{0.779168606f, 0.549075186f},
-std::array<float,2>{0.138673708f, 0.814590871f},
-std::array<float,2>{0.530855477f, 0.45424509f},
-std::array<float,2>{0.0826072693f, 0.270078868f},
-std::array<float,2>{0.628961384f, 0.968058765f},
-std::array<float,2>{0.393558383f, 0.738385856f},
-std::array<float,2>{0.888580382f, 0.114359848f},
-std::array<float,2>{0.0293113552f, 0.216650784f},
-std::array<float,2>{0.715383112f, 0.606743038f},
-std::array<float,2>{0.490256727f, 0.790201068f},
-std::array<float,2>{0.954728782f, 0.437274516f},
-std::array<float,2>{0.352576315f, 0.347786069f},
-std::array<float,2>{0.853798032f, 0.905895174f},
-std::array<float,2>{0.198776007f, 0.673203349f},
-std::array<float,2>{0.589147925f, 0.0222192612f},
-std::array<float,2>{0.40853554f, 0.0732859448f},
-std::array<float,2>{0.928376377f, 0.706730366f},
-std::array<float,2>{0.0955315605f, 0.982092321f},
-std::array<float,2>{0.676499367f, 0.310212553f},
-std::array<float,2>{0.16652675f, 0.499807149f},
-std::array<float,2>{0.531411827f, 0.871749401f},
-std::array<float,2>{0.298538864f, 0.507958949f},
-std::array<float,2>{0.785517216f, 0.127400815f},
-std::array<float,2>{0.110279895f, 0.103706934f},
-std::array<float,2>{0.661651075f, 0.728533387f},
-std::array<float,2>{0.422323227f, 0.949942291f},
-std::array<float,2>{0.91572082f, 0.265118241f},
-std::array<float,2>{0.292041451f, 0.450210452f},
-std::array<float,2>{0.799189329f, 0.842863381f},
-std::array<float,2>{0.183210999f, 0.542811096f},
-std::array<float,2>{0.548021674f, 0.158641905f},
-std::array<float,2>{0.483401597f, 0.223144293f},
-std::array<float,2>{0.939699292f, 0.570022166f},
-std::array<float,2>{0.00513589662f, 0.760728598f},
-std::array<float,2>{0.689188242f, 0.394010842f},
-std::array<float,2>{0.212747768f, 0.338198513f},
-std::array<float,2>{0.576122761f, 0.92517519f},
-std::array<float,2>{0.372833043f, 0.627727687f},
-std::array<float,2>{0.860467672f, 0.0469053946f},
-std::array<float,2>{0.14831996f, 0.151960298f},
-std::array<float,2>{0.508457184f, 0.526708663f},
-std::array<float,2>{0.260777354f, 0.857514799f},
-std::array<float,2>{0.753580391f, 0.484188616f},
-std::array<float,2>{0.376063913f, 0.282395482f},
-std::array<float,2>{0.906220317f, 0.997461915f},
-std::array<float,2>{0.0716834441f, 0.702981234f},
-std::array<float,2>{0.643335283f, 0.0822715312f},
-std::array<float,2>{0.338697672f, 0.0124113476f},
-std::array<float,2>{0.836573243f, 0.667934f},
-std::array<float,2>{0.246737361f, 0.881385386f},
-std::array<float,2>{0.598433793f, 0.364136517f},
-std::array<float,2>{0.0414667055f, 0.420930803f},
-std::array<float,2>{0.722025037f, 0.809701383f},
-std::array<float,2>{0.455027312f, 0.615401149f},
-std::array<float,2>{0.970126331f, 0.200187609f},
-std::array<float,2>{0.207388207f, 0.110076681f},
-std::array<float,2>{0.563098133f, 0.736851752f},
-std::array<float,2>{0.360446423f, 0.963965356f},
-std::array<float,2>{0.874085069f, 0.267090291f},
-std::array<float,2>{0.47440654f, 0.460179806f},
-std::array<float,2>{0.949172258f, 0.819610834f},
-std::array<float,2>{0.0110717006f, 0.551857293f},
-std::array<float,2>{0.698590755f, 0.176325008f},
-std::array<float,2>{0.289056927f, 0.23865433f},
-std::array<float,2>{0.810942352f, 0.586561441f},
-std::array<float,2>{0.174986795f, 0.767099917f},
-std::array<float,2>{0.557145953f, 0.384785205f},
-std::array<float,2>{0.120458305f, 0.314684838f},
-std::array<float,2>{0.66580838f, 0.911557198f},
-std::array<float,2>{0.431035966f, 0.655954659f},
-std::array<float,2>{0.9086501f, 0.0330976769f},
-std::array<float,2>{0.0347290896f, 0.130095497f},
-std::array<float,2>{0.727119267f, 0.514774919f},
-std::array<float,2>{0.467115015f, 0.869457245f},
-std::array<float,2>{0.982217073f, 0.495808721f},
-std::array<float,2>{0.330903977f, 0.304734737f},
-std::array<float,2>{0.832001925f, 0.979011416f},
-std::array<float,2>{0.241772249f, 0.707632005f},
-std::array<float,2>{0.609067917f, 0.0771654844f},
-std::array<float,2>{0.383514255f, 0.0165536609f},
-std::array<float,2>{0.898364842f, 0.678622305f},
-std::array<float,2>{0.0699237287f, 0.90116483f},
-std::array<float,2>{0.649859905f, 0.34695974f},
-std::array<float,2>{0.154870033f, 0.430878222f},
-std::array<float,2>{0.504129469f, 0.7933079f},
-std::array<float,2>{0.256794661f, 0.605442226f},
-std::array<float,2>{0.762525678f, 0.213812411f},
-std::array<float,2>{0.0922116786f, 0.0524010621f},
-std::array<float,2>{0.633708715f, 0.630949974f},
-std::array<float,2>{0.404622316f, 0.927061915f},
-std::array<float,2>{0.876416802f, 0.341616333f},
-std::array<float,2>{0.276531905f, 0.396808237f},
-std::array<float,2>{0.766749144f, 0.763997614f},
-std::array<float,2>{0.1270224f, 0.563722849f},
-std::array<float,2>{0.51763463f, 0.220985487f},
-std::array<float,2>{0.44271028f, 0.1608731f},
-std::array<float,2>{0.991827011f, 0.544376194f},
-std::array<float,2>{0.0593825765f, 0.836838484f},
-std::array<float,2>{0.743851721f, 0.448262244f},
-std::array<float,2>{0.224995509f, 0.260508746f},
-std::array<float,2>{0.615691483f, 0.945916355f},
-std::array<float,2>{0.3155123f, 0.731698394f},
-std::array<float,2>{0.815867186f, 0.106554717f},
-std::array<float,2>{0.16311501f, 0.197534248f},
-std::array<float,2>{0.539193928f, 0.609722257f},
-std::array<float,2>{0.306037277f, 0.806823969f},
-std::array<float,2>{0.793233275f, 0.415317208f},
-std::array<float,2>{0.421526939f, 0.361400396f},
-std::array<float,2>{0.932581365f, 0.87786454f},
-std::array<float,2>{0.102074772f, 0.669415832f},
-std::array<float,2>{0.682179809f, 0.0106488438f},
-std::array<float,2>{0.350551665f, 0.0800354555f},
-std::array<float,2>{0.848648906f, 0.697411418f},
-std::array<float,2>{0.193714663f, 0.993060112f},
-std::array<float,2>{0.582336664f, 0.287165999f},
-std::array<float,2>{0.0228669569f, 0.480130851f},
-std::array<float,2>{0.705524087f, 0.853051662f},
-std::array<float,2>{0.495859653f, 0.531026721f},
-std::array<float,2>{0.963803172f, 0.154305279f},
-std::array<float,2>{0.134493768f, 0.00578601146f},
-std::array<float,2>{0.525005341f, 0.662811399f},
-std::array<float,2>{0.269326448f, 0.885375679f},
-std::array<float,2>{0.776428223f, 0.372157097f},
-std::array<float,2>{0.396099836f, 0.410796821f},
-std::array<float,2>{0.884913623f, 0.802902579f},
-std::array<float,2>{0.080786787f, 0.618522882f},
-std::array<float,2>{0.627545357f, 0.189770505f},
-std::array<float,2>{0.32109946f, 0.147617728f},
-std::array<float,2>{0.824386835f, 0.522524476f},
-std::array<float,2>{0.233201385f, 0.846950769f},
-std::array<float,2>{0.620079458f, 0.470153302f},
-std::array<float,2>{0.0542794019f, 0.292608857f},
-std::array<float,2>{0.735434473f, 0.987824917f},
-std::array<float,2>{0.446043879f, 0.69146204f},
-std::array<float,2>{0.997221291f, 0.0866639093f},
-std::array<float,2>{0.0980420932f, 0.231855437f},
-std::array<float,2>{0.675397635f, 0.574352384f},
-std::array<float,2>{0.413216233f, 0.756890833f},
-std::array<float,2>{0.9253757f, 0.401689768f},
-std::array<float,2>{0.301865339f, 0.332205355f},
-std::array<float,2>{0.784305394f, 0.932337999f},
-std::array<float,2>{0.17158553f, 0.640390873f},
-std::array<float,2>{0.536203742f, 0.0589846186f},
-std::array<float,2>{0.487878948f, 0.0949450806f},
-std::array<float,2>{0.958537936f, 0.724261582f},
-std::array<float,2>{0.0240870956f, 0.943949044f},
-std::array<float,2>{0.711087346f, 0.253021836f},
-std::array<float,2>{0.201076686f, 0.443847656f},
-std::array<float,2>{0.5936535f, 0.833281934f},
-std::array<float,2>{0.358323902f, 0.537364602f},
-std::array<float,2>{0.856633186f, 0.164946839f},
-std::array<float,2>{0.00132029236f, 0.0688822418f},
-std::array<float,2>{0.691631973f, 0.713198483f},
-std::array<float,2>{0.480122536f, 0.970532954f},
-std::array<float,2>{0.943181813f, 0.300500602f},
-std::array<float,2>{0.367238551f, 0.484804779f},
-std::array<float,2>{0.866150677f, 0.861441731f},
-std::array<float,2>{0.215457633f, 0.507590294f},
-std::array<float,2>{0.572798193f, 0.13302651f},
-std::array<float,2>{0.428854197f, 0.20561105f},
-std::array<float,2>{0.92067343f, 0.601337314f},
-std::array<float,2>{0.117066331f, 0.783446431f},
-std::array<float,2>{0.657530904f, 0.428895921f},
-std::array<float,2>{0.18445617f, 0.358622402f},
-std::array<float,2>{0.553716838f, 0.896849096f},
-std::array<float,2>{0.293751299f, 0.686233342f},
-std::array<float,2>{0.802154064f, 0.0253822654f},
-std::array<float,2>{0.244837195f, 0.187117726f},
-std::array<float,2>{0.597461462f, 0.556572199f},
-std::array<float,2>{0.3429676f, 0.824528158f},
-std::array<float,2>{0.840795517f, 0.462299615f},
-std::array<float,2>{0.457243532f, 0.2750929f},
-std::array<float,2>{0.974255502f, 0.959786713f},
-std::array<float,2>{0.0457942672f, 0.743152201f},
-std::array<float,2>{0.724945247f, 0.122709729f},
-std::array<float,2>{0.26496163f, 0.0442892723f},
-std::array<float,2>{0.754569888f, 0.645584822f},
-std::array<float,2>{0.143296689f, 0.916671753f},
-std::array<float,2>{0.512830436f, 0.321269929f},
-std::array<float,2>{0.0757153854f, 0.375570863f},
-std::array<float,2>{0.644886732f, 0.778404295f},
-std::array<float,2>{0.380148888f, 0.585766196f},
-std::array<float,2>{0.900158286f, 0.24368155f},
-std::array<float,2>{0.156434089f, 0.118589595f},
-std::array<float,2>{0.545886636f, 0.746946692f},
-std::array<float,2>{0.310841769f, 0.956231892f},
-std::array<float,2>{0.791565955f, 0.280292749f},
-std::array<float,2>{0.415242374f, 0.465488881f},
-std::array<float,2>{0.935852528f, 0.820832908f},
-std::array<float,2>{0.10818278f, 0.560258031f},
-std::array<float,2>{0.6847049f, 0.180371121f},
-std::array<float,2>{0.344676435f, 0.249935955f},
-std::array<float,2>{0.843833029f, 0.580239236f},
-std::array<float,2>{0.188078105f, 0.77511704f},
-std::array<float,2>{0.579558551f, 0.381937385f},
-std::array<float,2>{0.0191880912f, 0.327299953f},
-std::array<float,2>{0.708979189f, 0.918611109f},
-std::array<float,2>{0.497645289f, 0.641324759f},
-std::array<float,2>{0.967338622f, 0.0411635861f},
-std::array<float,2>{0.0897372067f, 0.138350457f},
-std::array<float,2>{0.637740254f, 0.500335395f},
-std::array<float,2>{0.399042666f, 0.863935411f},
-std::array<float,2>{0.882803977f, 0.491232216f},
-std::array<float,2>{0.277725965f, 0.303606004f},
-std::array<float,2>{0.773040771f, 0.973444641f},
-std::array<float,2>{0.12956287f, 0.717086732f},
-std::array<float,2>{0.519880056f, 0.0657819435f},
-std::array<float,2>{0.440005779f, 0.0285711084f},
-std::array<float,2>{0.986765504f, 0.680633426f},
-std::array<float,2>{0.0556469858f, 0.891003251f},
-std::array<float,2>{0.746990323f, 0.352466911f},
-std::array<float,2>{0.219783947f, 0.422793478f},
-std::array<float,2>{0.609891653f, 0.788188338f},
-std::array<float,2>{0.318374723f, 0.595155299f},
-std::array<float,2>{0.820058584f, 0.207995802f},
-std::array<float,2>{0.0368374735f, 0.0557845198f},
-std::array<float,2>{0.731054544f, 0.633978963f},
-std::array<float,2>{0.462149829f, 0.93537569f},
-std::array<float,2>{0.979239106f, 0.329068273f},
-std::array<float,2>{0.332219094f, 0.405431122f},
-std::array<float,2>{0.83297807f, 0.751773059f},
-std::array<float,2>{0.235988498f, 0.574002087f},
-std::array<float,2>{0.60396111f, 0.23023802f},
-std::array<float,2>{0.38857168f, 0.171318755f},
-std::array<float,2>{0.894472361f, 0.535047174f},
-std::array<float,2>{0.0646717772f, 0.828335524f},
-std::array<float,2>{0.652916551f, 0.437533706f},
-std::array<float,2>{0.151015222f, 0.255822331f},
-std::array<float,2>{0.50388062f, 0.937537551f},
-std::array<float,2>{0.250340253f, 0.720697403f},
-std::array<float,2>{0.760089219f, 0.0986113772f},
-std::array<float,2>{0.204911679f, 0.192593798f},
-std::array<float,2>{0.567740262f, 0.624522388f},
-std::array<float,2>{0.3660779f, 0.797611058f},
-std::array<float,2>{0.870389879f, 0.408310264f},
-std::array<float,2>{0.469832897f, 0.370995522f},
-std::array<float,2>{0.951694727f, 0.889430523f},
-std::array<float,2>{0.0148545131f, 0.657295167f},
-std::array<float,2>{0.70014441f, 0.000344795611f},
-std::array<float,2>{0.283809572f, 0.0903421268f},
-std::array<float,2>{0.806878984f, 0.689112306f},
-std::array<float,2>{0.177424461f, 0.989644468f},
-std::array<float,2>{0.558658302f, 0.294925928f},
-std::array<float,2>{0.121406026f, 0.473815322f},
-std::array<float,2>{0.671180129f, 0.84826827f},
-std::array<float,2>{0.434307963f, 0.517464221f},
-std::array<float,2>{0.913261831f, 0.142745152f},
-std::array<float,2>{0.247190922f, 0.0146748964f},
-std::array<float,2>{0.599332035f, 0.665190637f},
-std::array<float,2>{0.339187264f, 0.879104674f},
-std::array<float,2>{0.836916208f, 0.366931319f},
-std::array<float,2>{0.453937769f, 0.418986678f},
-std::array<float,2>{0.969110966f, 0.812287867f},
-std::array<float,2>{0.0428176485f, 0.614453197f},
-std::array<float,2>{0.72159791f, 0.2030458f},
-std::array<float,2>{0.260084659f, 0.149731889f},
-std::array<float,2>{0.752727926f, 0.525134087f},
-std::array<float,2>{0.146942347f, 0.85605675f},
-std::array<float,2>{0.509408534f, 0.481767416f},
-std::array<float,2>{0.0703765228f, 0.283251435f},
-std::array<float,2>{0.644190371f, 0.999537289f},
-std::array<float,2>{0.375397027f, 0.700132072f},
-std::array<float,2>{0.904555321f, 0.0846246108f},
-std::array<float,2>{0.00401325384f, 0.225315899f},
-std::array<float,2>{0.687555373f, 0.566939056f},
-std::array<float,2>{0.482846975f, 0.758123219f},
-std::array<float,2>{0.941181958f, 0.392064899f},
-std::array<float,2>{0.371160775f, 0.33617878f},
-std::array<float,2>{0.859426796f, 0.922839582f},
-std::array<float,2>{0.211758301f, 0.625850558f},
-std::array<float,2>{0.57501936f, 0.0497825034f},
-std::array<float,2>{0.423601866f, 0.103125051f},
-std::array<float,2>{0.914420426f, 0.72829175f},
-std::array<float,2>{0.110864379f, 0.951340437f},
-std::array<float,2>{0.660924733f, 0.261796325f},
-std::array<float,2>{0.181668133f, 0.451988369f},
-std::array<float,2>{0.547521353f, 0.840741932f},
-std::array<float,2>{0.291356176f, 0.540750504f},
-std::array<float,2>{0.799931884f, 0.157685861f},
-std::array<float,2>{0.0945042223f, 0.072085157f},
-std::array<float,2>{0.677540243f, 0.704785466f},
-std::array<float,2>{0.410051405f, 0.983672738f},
-std::array<float,2>{0.929197252f, 0.310883701f},
-std::array<float,2>{0.297207594f, 0.496784687f},
-std::array<float,2>{0.786867082f, 0.874764383f},
-std::array<float,2>{0.167574957f, 0.510680079f},
-std::array<float,2>{0.532633305f, 0.125670403f},
-std::array<float,2>{0.492038816f, 0.217328966f},
-std::array<float,2>{0.953982055f, 0.60756892f},
-std::array<float,2>{0.0311355554f, 0.791868091f},
-std::array<float,2>{0.715972602f, 0.435426116f},
-std::array<float,2>{0.197266787f, 0.350721329f},
-std::array<float,2>{0.588026226f, 0.903325975f},
-std::array<float,2>{0.351813614f, 0.675588846f},
-std::array<float,2>{0.854583025f, 0.0207743123f},
-std::array<float,2>{0.139977753f, 0.171989188f},
-std::array<float,2>{0.529978335f, 0.548400521f},
-std::array<float,2>{0.27026549f, 0.813964725f},
-std::array<float,2>{0.777531922f, 0.456753463f},
-std::array<float,2>{0.393346846f, 0.272639096f},
-std::array<float,2>{0.887125432f, 0.9663378f},
-std::array<float,2>{0.0835781619f, 0.742097139f},
-std::array<float,2>{0.630678117f, 0.115790658f},
-std::array<float,2>{0.325161815f, 0.0364561975f},
-std::array<float,2>{0.823913336f, 0.650067866f},
-std::array<float,2>{0.226844966f, 0.908693671f},
-std::array<float,2>{0.621497929f, 0.31759122f},
-std::array<float,2>{0.0484234653f, 0.389344841f},
-std::array<float,2>{0.740886986f, 0.772487819f},
-std::array<float,2>{0.449659377f, 0.590069652f},
-std::array<float,2>{0.994679093f, 0.237807214f},
-std::array<float,2>{0.194745973f, 0.0808197334f},
-std::array<float,2>{0.583848f, 0.695932984f},
-std::array<float,2>{0.35126999f, 0.994602144f},
-std::array<float,2>{0.8482728f, 0.286043406f},
-std::array<float,2>{0.494711637f, 0.478001773f},
-std::array<float,2>{0.964536905f, 0.853746593f},
-std::array<float,2>{0.022441186f, 0.529257834f},
-std::array<float,2>{0.706581354f, 0.153570816f},
-std::array<float,2>{0.305161417f, 0.196987703f},
-std::array<float,2>{0.794412315f, 0.612824142f},
-std::array<float,2>{0.162984505f, 0.804904759f},
-std::array<float,2>{0.540853441f, 0.416630805f},
-std::array<float,2>{0.103463031f, 0.359491974f},
-std::array<float,2>{0.683144271f, 0.875803351f},
-std::array<float,2>{0.419968396f, 0.670091033f},
-std::array<float,2>{0.933548391f, 0.00795147847f},
-std::array<float,2>{0.059876848f, 0.163691163f},
-std::array<float,2>{0.74230665f, 0.546831608f},
-std::array<float,2>{0.441500604f, 0.83909595f},
-std::array<float,2>{0.991185665f, 0.446679473f},
-std::array<float,2>{0.31513679f, 0.259360999f},
-std::array<float,2>{0.81512326f, 0.947298348f},
-std::array<float,2>{0.226537272f, 0.733784258f},
-std::array<float,2>{0.617132246f, 0.107959896f},
-std::array<float,2>{0.405751795f, 0.0542025752f},
-std::array<float,2>{0.875727296f, 0.630671084f},
-std::array<float,2>{0.0936707556f, 0.927879453f},
-std::array<float,2>{0.633898497f, 0.342904538f},
-std::array<float,2>{0.12804161f, 0.395619065f},
-std::array<float,2>{0.519126952f, 0.763666749f},
-std::array<float,2>{0.276269734f, 0.565019429f},
-std::array<float,2>{0.765915334f, 0.219043136f},
-std::array<float,2>{0.069284223f, 0.0179029107f},
-std::array<float,2>{0.648657441f, 0.676666617f},
-std::array<float,2>{0.384115458f, 0.898693442f},
-std::array<float,2>{0.896853149f, 0.344616294f},
-std::array<float,2>{0.257272273f, 0.432081282f},
-std::array<float,2>{0.763405502f, 0.795347571f},
-std::array<float,2>{0.155354336f, 0.602385879f},
-std::array<float,2>{0.505532861f, 0.212570876f},
-std::array<float,2>{0.468682915f, 0.131841958f},
-std::array<float,2>{0.980764389f, 0.512381434f},
-std::array<float,2>{0.0334455408f, 0.867760658f},
-std::array<float,2>{0.727941871f, 0.493296087f},
-std::array<float,2>{0.241083115f, 0.308080316f},
-std::array<float,2>{0.607594728f, 0.977193773f},
-std::array<float,2>{0.331888348f, 0.708984613f},
-std::array<float,2>{0.830919504f, 0.074328661f},
-std::array<float,2>{0.17405358f, 0.241854265f},
-std::array<float,2>{0.558215439f, 0.587990463f},
-std::array<float,2>{0.287206173f, 0.767824829f},
-std::array<float,2>{0.811637461f, 0.384603381f},
-std::array<float,2>{0.430560768f, 0.313510567f},
-std::array<float,2>{0.909499407f, 0.91289562f},
-std::array<float,2>{0.119668074f, 0.653891623f},
-std::array<float,2>{0.664083183f, 0.0342728719f},
-std::array<float,2>{0.36001271f, 0.111716606f},
-std::array<float,2>{0.873237133f, 0.735296488f},
-std::array<float,2>{0.20860365f, 0.9623456f},
-std::array<float,2>{0.563963652f, 0.26910603f},
-std::array<float,2>{0.0103247976f, 0.458743304f},
-std::array<float,2>{0.698212862f, 0.817981184f},
-std::array<float,2>{0.473438382f, 0.553100467f},
-std::array<float,2>{0.948030293f, 0.179234013f},
-std::array<float,2>{0.144030362f, 0.0453999713f},
-std::array<float,2>{0.511982322f, 0.648370802f},
-std::array<float,2>{0.264516324f, 0.915171921f},
-std::array<float,2>{0.755734563f, 0.323354453f},
-std::array<float,2>{0.379872411f, 0.378309786f},
-std::array<float,2>{0.899097621f, 0.7797997f},
-std::array<float,2>{0.0746748f, 0.583698511f},
-std::array<float,2>{0.646309197f, 0.245364442f},
-std::array<float,2>{0.342465222f, 0.184269175f},
-std::array<float,2>{0.841313958f, 0.557866395f},
-std::array<float,2>{0.245902628f, 0.826684654f},
-std::array<float,2>{0.596328497f, 0.462929904f},
-std::array<float,2>{0.0460376255f, 0.277337223f},
-std::array<float,2>{0.725591481f, 0.95724225f},
-std::array<float,2>{0.458355129f, 0.745631337f},
-std::array<float,2>{0.973189652f, 0.124798283f},
-std::array<float,2>{0.116079748f, 0.204865038f},
-std::array<float,2>{0.656818092f, 0.597734988f},
-std::array<float,2>{0.427748054f, 0.781638861f},
-std::array<float,2>{0.921089053f, 0.427013367f},
-std::array<float,2>{0.29456985f, 0.357125729f},
-std::array<float,2>{0.801634014f, 0.894805729f},
-std::array<float,2>{0.185106039f, 0.684255421f},
-std::array<float,2>{0.553524613f, 0.0269649085f},
-std::array<float,2>{0.479317427f, 0.0673391894f},
-std::array<float,2>{0.942087948f, 0.712326229f},
-std::array<float,2>{0.000501908129f, 0.972126663f},
-std::array<float,2>{0.693047881f, 0.298801899f},
-std::array<float,2>{0.216690898f, 0.488051444f},
-std::array<float,2>{0.573449731f, 0.859990478f},
-std::array<float,2>{0.368419558f, 0.505397618f},
-std::array<float,2>{0.866628408f, 0.135774419f},
-std::array<float,2>{0.0252985004f, 0.0972182378f},
-std::array<float,2>{0.712842286f, 0.726397574f},
-std::array<float,2>{0.48712948f, 0.942686558f},
-std::array<float,2>{0.957839608f, 0.251179516f},
-std::array<float,2>{0.358599663f, 0.442037851f},
-std::array<float,2>{0.856426418f, 0.834516466f},
-std::array<float,2>{0.199654937f, 0.536306977f},
-std::array<float,2>{0.592059135f, 0.166350454f},
-std::array<float,2>{0.412605822f, 0.233108297f},
-std::array<float,2>{0.92469722f, 0.576472819f},
-std::array<float,2>{0.0992656052f, 0.755077124f},
-std::array<float,2>{0.67416662f, 0.400070965f},
-std::array<float,2>{0.170340121f, 0.335665464f},
-std::array<float,2>{0.535627723f, 0.930495858f},
-std::array<float,2>{0.300870448f, 0.638119519f},
-std::array<float,2>{0.783419371f, 0.0622940846f},
-std::array<float,2>{0.234282285f, 0.144670933f},
-std::array<float,2>{0.620328188f, 0.520497143f},
-std::array<float,2>{0.321639746f, 0.84516418f},
-std::array<float,2>{0.826102734f, 0.470924377f},
-std::array<float,2>{0.446508259f, 0.289608389f},
-std::array<float,2>{0.996227622f, 0.98588866f},
-std::array<float,2>{0.0530276336f, 0.695217013f},
-std::array<float,2>{0.735239387f, 0.0883301646f},
-std::array<float,2>{0.267986327f, 0.00747800246f},
-std::array<float,2>{0.776201367f, 0.660788834f},
-std::array<float,2>{0.132935956f, 0.883112311f},
-std::array<float,2>{0.523490429f, 0.373292685f},
-std::array<float,2>{0.0812481344f, 0.412273824f},
-std::array<float,2>{0.628864706f, 0.802286208f},
-std::array<float,2>{0.394674033f, 0.620417714f},
-std::array<float,2>{0.885893464f, 0.188457131f},
-std::array<float,2>{0.131658778f, 0.0640730858f},
-std::array<float,2>{0.523249447f, 0.715072453f},
-std::array<float,2>{0.2801705f, 0.97544086f},
-std::array<float,2>{0.771364987f, 0.300955445f},
-std::array<float,2>{0.4013502f, 0.48879844f},
-std::array<float,2>{0.879417896f, 0.866941035f},
-std::array<float,2>{0.0870639831f, 0.503206849f},
-std::array<float,2>{0.63993746f, 0.139705911f},
-std::array<float,2>{0.317892313f, 0.210000485f},
-std::array<float,2>{0.81775701f, 0.596084654f},
-std::array<float,2>{0.222275615f, 0.785678685f},
-std::array<float,2>{0.612802148f, 0.423999161f},
-std::array<float,2>{0.0575978346f, 0.353863358f},
-std::array<float,2>{0.74950093f, 0.893009543f},
-std::array<float,2>{0.438482553f, 0.68168807f},
-std::array<float,2>{0.985877931f, 0.0296002328f},
-std::array<float,2>{0.107210733f, 0.183042482f},
-std::array<float,2>{0.685927451f, 0.561008453f},
-std::array<float,2>{0.416108489f, 0.823004186f},
-std::array<float,2>{0.935389519f, 0.467534482f},
-std::array<float,2>{0.308968633f, 0.278333545f},
-std::array<float,2>{0.790072083f, 0.95420444f},
-std::array<float,2>{0.158520386f, 0.749550104f},
-std::array<float,2>{0.543813646f, 0.119815484f},
-std::array<float,2>{0.498682767f, 0.0394552946f},
-std::array<float,2>{0.966185749f, 0.644306242f},
-std::array<float,2>{0.0174455028f, 0.921818376f},
-std::array<float,2>{0.709989727f, 0.324401826f},
-std::array<float,2>{0.190369219f, 0.379749745f},
-std::array<float,2>{0.58043474f, 0.776755512f},
-std::array<float,2>{0.34747079f, 0.578279197f},
-std::array<float,2>{0.846180379f, 0.247644275f},
-std::array<float,2>{0.0134152202f, 0.00263468781f},
-std::array<float,2>{0.701406121f, 0.65955019f},
-std::array<float,2>{0.472036093f, 0.886794746f},
-std::array<float,2>{0.949687779f, 0.368368775f},
-std::array<float,2>{0.364650875f, 0.406733185f},
-std::array<float,2>{0.867424965f, 0.800030589f},
-std::array<float,2>{0.206644908f, 0.621169567f},
-std::array<float,2>{0.569426239f, 0.193978623f},
-std::array<float,2>{0.437378794f, 0.141258672f},
-std::array<float,2>{0.911785305f, 0.51844871f},
-std::array<float,2>{0.12490917f, 0.851321459f},
-std::array<float,2>{0.669443369f, 0.476548046f},
-std::array<float,2>{0.179100201f, 0.294167936f},
-std::array<float,2>{0.561166644f, 0.990912855f},
-std::array<float,2>{0.282683581f, 0.690997422f},
-std::array<float,2>{0.806559026f, 0.0933453515f},
-std::array<float,2>{0.237632781f, 0.227988988f},
-std::array<float,2>{0.60342294f, 0.570582271f},
-std::array<float,2>{0.335115969f, 0.75309211f},
-std::array<float,2>{0.835763872f, 0.403988183f},
-std::array<float,2>{0.463795334f, 0.330417454f},
-std::array<float,2>{0.977734327f, 0.935894132f},
-std::array<float,2>{0.0385344103f, 0.636614621f},
-std::array<float,2>{0.733569503f, 0.0579578094f},
-std::array<float,2>{0.253061682f, 0.100045018f},
-std::array<float,2>{0.758642793f, 0.721940398f},
-std::array<float,2>{0.149253726f, 0.939984918f},
-std::array<float,2>{0.50047195f, 0.25608173f},
-std::array<float,2>{0.0626591146f, 0.440907747f},
-std::array<float,2>{0.655549824f, 0.831182599f},
-std::array<float,2>{0.39020896f, 0.532480419f},
-std::array<float,2>{0.891182363f, 0.169370562f},
-std::array<float,2>{0.213702634f, 0.0488206744f},
-std::array<float,2>{0.577463567f, 0.628533185f},
-std::array<float,2>{0.374673814f, 0.924187839f},
-std::array<float,2>{0.862620473f, 0.339817673f},
-std::array<float,2>{0.48098579f, 0.393411785f},
-std::array<float,2>{0.937819839f, 0.761399686f},
-std::array<float,2>{0.00708088465f, 0.56908989f},
-std::array<float,2>{0.690681934f, 0.223811656f},
-std::array<float,2>{0.290380925f, 0.15979898f},
-std::array<float,2>{0.797286808f, 0.541471183f},
-std::array<float,2>{0.180440098f, 0.841895998f},
-std::array<float,2>{0.550730526f, 0.449318349f},
-std::array<float,2>{0.112724707f, 0.264210194f},
-std::array<float,2>{0.664051771f, 0.951068521f},
-std::array<float,2>{0.425250232f, 0.730138719f},
-std::array<float,2>{0.917779326f, 0.105092444f},
-std::array<float,2>{0.0394844972f, 0.20114632f},
-std::array<float,2>{0.720244229f, 0.616794646f},
-std::array<float,2>{0.455592006f, 0.80899471f},
-std::array<float,2>{0.970976233f, 0.420632929f},
-std::array<float,2>{0.336565584f, 0.364766657f},
-std::array<float,2>{0.838523924f, 0.882411003f},
-std::array<float,2>{0.249312982f, 0.666363657f},
-std::array<float,2>{0.600589395f, 0.0135199018f},
-std::array<float,2>{0.377035886f, 0.0836151019f},
-std::array<float,2>{0.902617455f, 0.701722741f},
-std::array<float,2>{0.0726067051f, 0.997032106f},
-std::array<float,2>{0.642436981f, 0.281720668f},
-std::array<float,2>{0.145856485f, 0.483195454f},
-std::array<float,2>{0.510439217f, 0.858707786f},
-std::array<float,2>{0.259519577f, 0.525599658f},
-std::array<float,2>{0.750488281f, 0.151296616f},
-std::array<float,2>{0.0841890797f, 0.114068292f},
-std::array<float,2>{0.632587969f, 0.739586949f},
-std::array<float,2>{0.391643524f, 0.966930568f},
-std::array<float,2>{0.889316797f, 0.271192431f},
-std::array<float,2>{0.272182494f, 0.45322001f},
-std::array<float,2>{0.779917359f, 0.816181421f},
-std::array<float,2>{0.138073996f, 0.550777733f},
-std::array<float,2>{0.527627528f, 0.174216345f},
-std::array<float,2>{0.452390999f, 0.235123292f},
-std::array<float,2>{0.994137645f, 0.593140006f},
-std::array<float,2>{0.0500983521f, 0.770326078f},
-std::array<float,2>{0.739720643f, 0.387344122f},
-std::array<float,2>{0.229406193f, 0.319779158f},
-std::array<float,2>{0.62403661f, 0.907649219f},
-std::array<float,2>{0.327680796f, 0.651090562f},
-std::array<float,2>{0.82127732f, 0.0385084376f},
-std::array<float,2>{0.1651503f, 0.128744259f},
-std::array<float,2>{0.534151673f, 0.509607613f},
-std::array<float,2>{0.299269974f, 0.872960567f},
-std::array<float,2>{0.787970245f, 0.498165488f},
-std::array<float,2>{0.40710485f, 0.308696896f},
-std::array<float,2>{0.927307367f, 0.98121655f},
-std::array<float,2>{0.0972687453f, 0.705299556f},
-std::array<float,2>{0.678504229f, 0.0730663091f},
-std::array<float,2>{0.355276614f, 0.0227358062f},
-std::array<float,2>{0.851707101f, 0.672604859f},
-std::array<float,2>{0.197083682f, 0.904965341f},
-std::array<float,2>{0.587012053f, 0.349151403f},
-std::array<float,2>{0.0289187115f, 0.436502635f},
-std::array<float,2>{0.717963636f, 0.789411485f},
-std::array<float,2>{0.489858955f, 0.606208861f},
-std::array<float,2>{0.955724716f, 0.215809077f},
-std::array<float,2>{0.224564731f, 0.105513975f},
-std::array<float,2>{0.613757968f, 0.730487525f},
-std::array<float,2>{0.313735753f, 0.946639597f},
-std::array<float,2>{0.812759578f, 0.260908544f},
-std::array<float,2>{0.443903357f, 0.447601467f},
-std::array<float,2>{0.988768339f, 0.837615609f},
-std::array<float,2>{0.0622391887f, 0.543620825f},
-std::array<float,2>{0.744214416f, 0.161630794f},
-std::array<float,2>{0.273885638f, 0.22168684f},
-std::array<float,2>{0.76909411f, 0.562960684f},
-std::array<float,2>{0.126539186f, 0.764798343f},
-std::array<float,2>{0.515711784f, 0.397745341f},
-std::array<float,2>{0.0916776955f, 0.340300262f},
-std::array<float,2>{0.635242581f, 0.926375091f},
-std::array<float,2>{0.404135674f, 0.632417321f},
-std::array<float,2>{0.877368689f, 0.0513806008f},
-std::array<float,2>{0.0204318091f, 0.155967861f},
-std::array<float,2>{0.703133881f, 0.529733896f},
-std::array<float,2>{0.492801815f, 0.852522314f},
-std::array<float,2>{0.962274313f, 0.479174912f},
-std::array<float,2>{0.349298298f, 0.288347363f},
-std::array<float,2>{0.849894226f, 0.993283033f},
-std::array<float,2>{0.193197936f, 0.698349833f},
-std::array<float,2>{0.585362852f, 0.0782576799f},
-std::array<float,2>{0.418385535f, 0.0111690871f},
-std::array<float,2>{0.931618631f, 0.668032527f},
-std::array<float,2>{0.104356788f, 0.877952576f},
-std::array<float,2>{0.679896474f, 0.362909466f},
-std::array<float,2>{0.160532206f, 0.414446503f},
-std::array<float,2>{0.542594135f, 0.808196664f},
-std::array<float,2>{0.308355421f, 0.610627592f},
-std::array<float,2>{0.795223534f, 0.198242575f},
-std::array<float,2>{0.117646977f, 0.0315530635f},
-std::array<float,2>{0.666930616f, 0.654361427f},
-std::array<float,2>{0.432534039f, 0.910428941f},
-std::array<float,2>{0.906701028f, 0.316336125f},
-std::array<float,2>{0.285551786f, 0.386068434f},
-std::array<float,2>{0.809858799f, 0.765892506f},
-std::array<float,2>{0.17239809f, 0.587844789f},
-std::array<float,2>{0.555144012f, 0.239519417f},
-std::array<float,2>{0.475835592f, 0.177396312f},
-std::array<float,2>{0.94704926f, 0.551393509f},
-std::array<float,2>{0.00849281251f, 0.818472266f},
-std::array<float,2>{0.695757091f, 0.459151566f},
-std::array<float,2>{0.210199535f, 0.265963763f},
-std::array<float,2>{0.565132439f, 0.963723958f},
-std::array<float,2>{0.362053126f, 0.738153756f},
-std::array<float,2>{0.871298492f, 0.110698663f},
-std::array<float,2>{0.152616829f, 0.21441932f},
-std::array<float,2>{0.5068537f, 0.60392487f},
-std::array<float,2>{0.255386233f, 0.794508457f},
-std::array<float,2>{0.764390588f, 0.430425823f},
-std::array<float,2>{0.38493067f, 0.345863819f},
-std::array<float,2>{0.896053791f, 0.901794374f},
-std::array<float,2>{0.06686984f, 0.678954542f},
-std::array<float,2>{0.651818573f, 0.0175273046f},
-std::array<float,2>{0.329838991f, 0.0762968957f},
-std::array<float,2>{0.828332126f, 0.70837009f},
-std::array<float,2>{0.239478931f, 0.98042655f},
-std::array<float,2>{0.606874764f, 0.30596748f},
-std::array<float,2>{0.0318352357f, 0.494732112f},
-std::array<float,2>{0.729609847f, 0.870590448f},
-std::array<float,2>{0.465809047f, 0.514241219f},
-std::array<float,2>{0.98416394f, 0.129017591f},
-std::array<float,2>{0.186120972f, 0.0234457627f},
-std::array<float,2>{0.551407695f, 0.687289238f},
-std::array<float,2>{0.29541105f, 0.897733331f},
-std::array<float,2>{0.803211987f, 0.358113199f},
-std::array<float,2>{0.426613182f, 0.428440392f},
-std::array<float,2>{0.918875933f, 0.784350216f},
-std::array<float,2>{0.113764033f, 0.599976301f},
-std::array<float,2>{0.659568787f, 0.206766412f},
-std::array<float,2>{0.370364964f, 0.133962587f},
-std::array<float,2>{0.863694668f, 0.506773412f},
-std::array<float,2>{0.218652382f, 0.862611353f},
-std::array<float,2>{0.570852578f, 0.485495716f},
-std::array<float,2>{0.00312604662f, 0.299492091f},
-std::array<float,2>{0.693442702f, 0.969439328f},
-std::array<float,2>{0.478368461f, 0.714766145f},
-std::array<float,2>{0.945007324f, 0.0698943883f},
-std::array<float,2>{0.0761747509f, 0.242943674f},
-std::array<float,2>{0.648142219f, 0.584633768f},
-std::array<float,2>{0.381700575f, 0.777907193f},
-std::array<float,2>{0.900966823f, 0.376847118f},
-std::array<float,2>{0.262271464f, 0.321857065f},
-std::array<float,2>{0.75631237f, 0.917739451f},
-std::array<float,2>{0.141171947f, 0.645171404f},
-std::array<float,2>{0.515256226f, 0.0435596704f},
-std::array<float,2>{0.460936576f, 0.121588573f},
-std::array<float,2>{0.975891769f, 0.743880272f},
-std::array<float,2>{0.0443629175f, 0.960218012f},
-std::array<float,2>{0.723842025f, 0.274290502f},
-std::array<float,2>{0.24328649f, 0.461704016f},
-std::array<float,2>{0.594294548f, 0.825688124f},
-std::array<float,2>{0.341328204f, 0.554873407f},
-std::array<float,2>{0.84261775f, 0.18592079f},
-std::array<float,2>{0.0522208177f, 0.0875128955f},
-std::array<float,2>{0.737685978f, 0.692877769f},
-std::array<float,2>{0.447973847f, 0.986829698f},
-std::array<float,2>{0.998294473f, 0.291963637f},
-std::array<float,2>{0.323073715f, 0.469364822f},
-std::array<float,2>{0.826624453f, 0.845833063f},
-std::array<float,2>{0.232097521f, 0.521676421f},
-std::array<float,2>{0.618934572f, 0.147225812f},
-std::array<float,2>{0.396680951f, 0.190661594f},
-std::array<float,2>{0.884066463f, 0.617785454f},
-std::array<float,2>{0.0793436617f, 0.804261446f},
-std::array<float,2>{0.626473963f, 0.411223918f},
-std::array<float,2>{0.136688545f, 0.371991754f},
-std::array<float,2>{0.526564777f, 0.885888696f},
-std::array<float,2>{0.267176419f, 0.663963675f},
-std::array<float,2>{0.775102139f, 0.00471477862f},
-std::array<float,2>{0.201818094f, 0.166015297f},
-std::array<float,2>{0.59163022f, 0.538833261f},
-std::array<float,2>{0.355475664f, 0.833003938f},
-std::array<float,2>{0.857680798f, 0.445183009f},
-std::array<float,2>{0.486242473f, 0.252445191f},
-std::array<float,2>{0.959834099f, 0.944893777f},
-std::array<float,2>{0.0259400755f, 0.723404825f},
-std::array<float,2>{0.713338017f, 0.0938715339f},
-std::array<float,2>{0.303639024f, 0.0598303899f},
-std::array<float,2>{0.781279981f, 0.6395365f},
-std::array<float,2>{0.167997748f, 0.933463573f},
-std::array<float,2>{0.538064957f, 0.333253503f},
-std::array<float,2>{0.100060456f, 0.401127011f},
-std::array<float,2>{0.672809541f, 0.756231904f},
-std::array<float,2>{0.411655873f, 0.575609386f},
-std::array<float,2>{0.923302472f, 0.230547875f},
-std::array<float,2>{0.138654828f, 0.115432389f},
-std::array<float,2>{0.527935207f, 0.74155277f},
-std::array<float,2>{0.27151069f, 0.966176093f},
-std::array<float,2>{0.779530227f, 0.273389369f},
-std::array<float,2>{0.39255926f, 0.456451178f},
-std::array<float,2>{0.888867676f, 0.814040601f},
-std::array<float,2>{0.0844798088f, 0.54807502f},
-std::array<float,2>{0.632021904f, 0.172656924f},
-std::array<float,2>{0.327542156f, 0.237395614f},
-std::array<float,2>{0.820670784f, 0.590711474f},
-std::array<float,2>{0.228519186f, 0.773064375f},
-std::array<float,2>{0.624857783f, 0.388926089f},
-std::array<float,2>{0.0504472479f, 0.318034708f},
-std::array<float,2>{0.739943683f, 0.908358216f},
-std::array<float,2>{0.45264563f, 0.649698317f},
-std::array<float,2>{0.993213415f, 0.0370390639f},
-std::array<float,2>{0.0969553217f, 0.125364751f},
-std::array<float,2>{0.678215742f, 0.509976566f},
-std::array<float,2>{0.406423301f, 0.874484181f},
-std::array<float,2>{0.926984608f, 0.496473372f},
-std::array<float,2>{0.299493819f, 0.311342955f},
-std::array<float,2>{0.787292898f, 0.984057903f},
-std::array<float,2>{0.165707856f, 0.704515636f},
-std::array<float,2>{0.533275545f, 0.07157965f},
-std::array<float,2>{0.489642233f, 0.0210653078f},
-std::array<float,2>{0.955512404f, 0.675038338f},
-std::array<float,2>{0.0285200961f, 0.903984785f},
-std::array<float,2>{0.718749344f, 0.351235121f},
-std::array<float,2>{0.196572304f, 0.434754044f},
-std::array<float,2>{0.587473452f, 0.791356862f},
-std::array<float,2>{0.354731828f, 0.608289003f},
-std::array<float,2>{0.852088392f, 0.216881245f},
-std::array<float,2>{0.00750354072f, 0.0492701232f},
-std::array<float,2>{0.690964818f, 0.625292361f},
-std::array<float,2>{0.48084709f, 0.922071755f},
-std::array<float,2>{0.938102782f, 0.336673051f},
-std::array<float,2>{0.374492109f, 0.392129421f},
-std::array<float,2>{0.863103926f, 0.758531094f},
-std::array<float,2>{0.213304952f, 0.566521704f},
-std::array<float,2>{0.578064263f, 0.224938929f},
-std::array<float,2>{0.425613135f, 0.157935724f},
-std::array<float,2>{0.91711843f, 0.540386915f},
-std::array<float,2>{0.113255322f, 0.840139031f},
-std::array<float,2>{0.663496673f, 0.451299757f},
-std::array<float,2>{0.180012226f, 0.262212038f},
-std::array<float,2>{0.550002158f, 0.952101588f},
-std::array<float,2>{0.290531158f, 0.727912724f},
-std::array<float,2>{0.79741174f, 0.102764271f},
-std::array<float,2>{0.249961227f, 0.202399343f},
-std::array<float,2>{0.601185322f, 0.615096927f},
-std::array<float,2>{0.33614859f, 0.811750531f},
-std::array<float,2>{0.838020682f, 0.419735134f},
-std::array<float,2>{0.455333143f, 0.366344452f},
-std::array<float,2>{0.971618831f, 0.879685223f},
-std::array<float,2>{0.039874658f, 0.666011691f},
-std::array<float,2>{0.719885409f, 0.0155540835f},
-std::array<float,2>{0.259128213f, 0.0840692446f},
-std::array<float,2>{0.750391126f, 0.699569046f},
-std::array<float,2>{0.146024734f, 0.999173045f},
-std::array<float,2>{0.510177314f, 0.284118801f},
-std::array<float,2>{0.0730900839f, 0.482215703f},
-std::array<float,2>{0.642051518f, 0.855769098f},
-std::array<float,2>{0.377727181f, 0.52447933f},
-std::array<float,2>{0.902997315f, 0.150171235f},
-std::array<float,2>{0.206361562f, 0.000709049869f},
-std::array<float,2>{0.569974482f, 0.658072948f},
-std::array<float,2>{0.365060389f, 0.889033318f},
-std::array<float,2>{0.867692232f, 0.370198876f},
-std::array<float,2>{0.472567856f, 0.40916726f},
-std::array<float,2>{0.950060844f, 0.797016799f},
-std::array<float,2>{0.0127198128f, 0.624205649f},
-std::array<float,2>{0.701773763f, 0.193097651f},
-std::array<float,2>{0.283088923f, 0.143374011f},
-std::array<float,2>{0.806152284f, 0.516908646f},
-std::array<float,2>{0.17940715f, 0.847782373f},
-std::array<float,2>{0.56076169f, 0.474201262f},
-std::array<float,2>{0.124034107f, 0.295593202f},
-std::array<float,2>{0.669149041f, 0.989864945f},
-std::array<float,2>{0.436615378f, 0.688767433f},
-std::array<float,2>{0.911168337f, 0.090151608f},
-std::array<float,2>{0.0387066193f, 0.229707181f},
-std::array<float,2>{0.733946681f, 0.573242247f},
-std::array<float,2>{0.463180393f, 0.751182973f},
-std::array<float,2>{0.978141367f, 0.406149983f},
-std::array<float,2>{0.335868627f, 0.328188479f},
-std::array<float,2>{0.835145593f, 0.934672773f},
-std::array<float,2>{0.237891868f, 0.634349883f},
-std::array<float,2>{0.602677763f, 0.056384746f},
-std::array<float,2>{0.389912546f, 0.097952947f},
-std::array<float,2>{0.890824974f, 0.720123231f},
-std::array<float,2>{0.0631612688f, 0.938407302f},
-std::array<float,2>{0.656080008f, 0.254916281f},
-std::array<float,2>{0.148721948f, 0.438122958f},
-std::array<float,2>{0.500847161f, 0.828620136f},
-std::array<float,2>{0.253698438f, 0.534640133f},
-std::array<float,2>{0.757934034f, 0.1717861f},
-std::array<float,2>{0.087654233f, 0.0659453347f},
-std::array<float,2>{0.640550494f, 0.717541397f},
-std::array<float,2>{0.400835335f, 0.972947121f},
-std::array<float,2>{0.879379153f, 0.303188235f},
-std::array<float,2>{0.279486686f, 0.491911858f},
-std::array<float,2>{0.770778716f, 0.863464236f},
-std::array<float,2>{0.130859613f, 0.500630558f},
-std::array<float,2>{0.522825181f, 0.137912452f},
-std::array<float,2>{0.4390755f, 0.207225293f},
-std::array<float,2>{0.985759497f, 0.595383406f},
-std::array<float,2>{0.0566827469f, 0.788864434f},
-std::array<float,2>{0.749872923f, 0.422208935f},
-std::array<float,2>{0.222072273f, 0.352034837f},
-std::array<float,2>{0.612369657f, 0.891508996f},
-std::array<float,2>{0.317821532f, 0.67988044f},
-std::array<float,2>{0.81787771f, 0.0288829729f},
-std::array<float,2>{0.158819422f, 0.180100128f},
-std::array<float,2>{0.543361962f, 0.559726357f},
-std::array<float,2>{0.309142232f, 0.820462763f},
-std::array<float,2>{0.790578365f, 0.464979559f},
-std::array<float,2>{0.416800022f, 0.280943096f},
-std::array<float,2>{0.934715688f, 0.956859708f},
-std::array<float,2>{0.106885567f, 0.746153116f},
-std::array<float,2>{0.686419487f, 0.118893199f},
-std::array<float,2>{0.346954525f, 0.0415497869f},
-std::array<float,2>{0.846604705f, 0.64076519f},
-std::array<float,2>{0.189829484f, 0.918244898f},
-std::array<float,2>{0.580996275f, 0.327985555f},
-std::array<float,2>{0.0170187522f, 0.382764995f},
-std::array<float,2>{0.710515678f, 0.774695277f},
-std::array<float,2>{0.498354316f, 0.580786586f},
-std::array<float,2>{0.966537178f, 0.249132872f},
-std::array<float,2>{0.231794223f, 0.0885106549f},
-std::array<float,2>{0.618582487f, 0.694350898f},
-std::array<float,2>{0.322479457f, 0.985414028f},
-std::array<float,2>{0.826958954f, 0.289268464f},
-std::array<float,2>{0.447605163f, 0.471450061f},
-std::array<float,2>{0.998707235f, 0.845650911f},
-std::array<float,2>{0.0525832288f, 0.519949913f},
-std::array<float,2>{0.738019705f, 0.145116493f},
-std::array<float,2>{0.266844392f, 0.187725291f},
-std::array<float,2>{0.774564981f, 0.620738387f},
-std::array<float,2>{0.13616322f, 0.801870942f},
-std::array<float,2>{0.527243614f, 0.412852824f},
-std::array<float,2>{0.0797486827f, 0.374011576f},
-std::array<float,2>{0.626414597f, 0.883728087f},
-std::array<float,2>{0.397313595f, 0.660157144f},
-std::array<float,2>{0.884650469f, 0.00706362445f},
-std::array<float,2>{0.0258335005f, 0.166719437f},
-std::array<float,2>{0.713704467f, 0.536879301f},
-std::array<float,2>{0.485683382f, 0.834306538f},
-std::array<float,2>{0.959231496f, 0.441583842f},
-std::array<float,2>{0.35626635f, 0.251513809f},
-std::array<float,2>{0.858216703f, 0.943178117f},
-std::array<float,2>{0.201302364f, 0.726002693f},
-std::array<float,2>{0.591233194f, 0.0969725028f},
-std::array<float,2>{0.411382556f, 0.061851535f},
-std::array<float,2>{0.923655212f, 0.638666987f},
-std::array<float,2>{0.100310698f, 0.930098593f},
-std::array<float,2>{0.671939194f, 0.334992349f},
-std::array<float,2>{0.168768927f, 0.399735808f},
-std::array<float,2>{0.53734076f, 0.755504072f},
-std::array<float,2>{0.302793056f, 0.577111006f},
-std::array<float,2>{0.781840682f, 0.232809708f},
-std::array<float,2>{0.113990918f, 0.0266227797f},
-std::array<float,2>{0.660127342f, 0.683885098f},
-std::array<float,2>{0.425966948f, 0.895127296f},
-std::array<float,2>{0.918435335f, 0.356932312f},
-std::array<float,2>{0.29521963f, 0.427590013f},
-std::array<float,2>{0.803412676f, 0.782075524f},
-std::array<float,2>{0.185663551f, 0.598213017f},
-std::array<float,2>{0.550847709f, 0.204464108f},
-std::array<float,2>{0.47781527f, 0.136617139f},
-std::array<float,2>{0.944445252f, 0.505291224f},
-std::array<float,2>{0.00352243753f, 0.859628797f},
-std::array<float,2>{0.69423902f, 0.487758666f},
-std::array<float,2>{0.217897356f, 0.298039705f},
-std::array<float,2>{0.570663929f, 0.97264576f},
-std::array<float,2>{0.370874971f, 0.712628901f},
-std::array<float,2>{0.863808811f, 0.0666168556f},
-std::array<float,2>{0.140835509f, 0.246070221f},
-std::array<float,2>{0.514900446f, 0.583372474f},
-std::array<float,2>{0.262094051f, 0.779724419f},
-std::array<float,2>{0.756489277f, 0.378686398f},
-std::array<float,2>{0.380947977f, 0.323836744f},
-std::array<float,2>{0.900393724f, 0.9157359f},
-std::array<float,2>{0.0769912079f, 0.647609234f},
-std::array<float,2>{0.647766948f, 0.0457886308f},
-std::array<float,2>{0.341287494f, 0.12414626f},
-std::array<float,2>{0.842175543f, 0.74527818f},
-std::array<float,2>{0.243666381f, 0.957882941f},
-std::array<float,2>{0.594138026f, 0.276756406f},
-std::array<float,2>{0.0448337793f, 0.463793159f},
-std::array<float,2>{0.724280298f, 0.826605618f},
-std::array<float,2>{0.460370988f, 0.558258176f},
-std::array<float,2>{0.976239026f, 0.184073001f},
-std::array<float,2>{0.172103465f, 0.0349859893f},
-std::array<float,2>{0.555331767f, 0.653586984f},
-std::array<float,2>{0.28584373f, 0.91224736f},
-std::array<float,2>{0.810357928f, 0.314257681f},
-std::array<float,2>{0.431887567f, 0.384251058f},
-std::array<float,2>{0.907090485f, 0.768137872f},
-std::array<float,2>{0.11795295f, 0.588452339f},
-std::array<float,2>{0.666319013f, 0.241521701f},
-std::array<float,2>{0.361789286f, 0.17900537f},
-std::array<float,2>{0.871765614f, 0.553413689f},
-std::array<float,2>{0.210536748f, 0.817558527f},
-std::array<float,2>{0.56474936f, 0.458366185f},
-std::array<float,2>{0.00818358641f, 0.268955767f},
-std::array<float,2>{0.696270108f, 0.962554872f},
-std::array<float,2>{0.476227999f, 0.734515071f},
-std::array<float,2>{0.946586609f, 0.112273403f},
-std::array<float,2>{0.0672480166f, 0.212258056f},
-std::array<float,2>{0.652219713f, 0.601838887f},
-std::array<float,2>{0.385596931f, 0.795570731f},
-std::array<float,2>{0.895862103f, 0.432327747f},
-std::array<float,2>{0.255347848f, 0.344047278f},
-std::array<float,2>{0.763950706f, 0.899031818f},
-std::array<float,2>{0.15311785f, 0.67593509f},
-std::array<float,2>{0.507809997f, 0.0182092264f},
-std::array<float,2>{0.465031952f, 0.0749783143f},
-std::array<float,2>{0.983421981f, 0.709777892f},
-std::array<float,2>{0.0316487327f, 0.976726949f},
-std::array<float,2>{0.730238557f, 0.308263153f},
-std::array<float,2>{0.240166172f, 0.493939191f},
-std::array<float,2>{0.607282281f, 0.867393076f},
-std::array<float,2>{0.329233199f, 0.512164652f},
-std::array<float,2>{0.828850031f, 0.132551044f},
-std::array<float,2>{0.0617212355f, 0.107902348f},
-std::array<float,2>{0.744937181f, 0.734167576f},
-std::array<float,2>{0.443550259f, 0.948016167f},
-std::array<float,2>{0.988792956f, 0.259216607f},
-std::array<float,2>{0.314357519f, 0.446956277f},
-std::array<float,2>{0.813380063f, 0.839645326f},
-std::array<float,2>{0.223965481f, 0.545993626f},
-std::array<float,2>{0.613840759f, 0.163393602f},
-std::array<float,2>{0.403585285f, 0.219579473f},
-std::array<float,2>{0.877490759f, 0.564786136f},
-std::array<float,2>{0.0910578296f, 0.762731314f},
-std::array<float,2>{0.635491192f, 0.396033823f},
-std::array<float,2>{0.126208022f, 0.343459159f},
-std::array<float,2>{0.516548038f, 0.928553522f},
-std::array<float,2>{0.274345845f, 0.63002497f},
-std::array<float,2>{0.7689358f, 0.0539999306f},
-std::array<float,2>{0.192805454f, 0.153815359f},
-std::array<float,2>{0.585677862f, 0.528347433f},
-std::array<float,2>{0.348801523f, 0.854174674f},
-std::array<float,2>{0.850266159f, 0.478270054f},
-std::array<float,2>{0.49246794f, 0.285426527f},
-std::array<float,2>{0.962727606f, 0.994795561f},
-std::array<float,2>{0.0199357513f, 0.69569087f},
-std::array<float,2>{0.703855693f, 0.0802542716f},
-std::array<float,2>{0.307770103f, 0.008631601f},
-std::array<float,2>{0.795562506f, 0.670875728f},
-std::array<float,2>{0.160721451f, 0.875356793f},
-std::array<float,2>{0.542046189f, 0.359896958f},
-std::array<float,2>{0.103742361f, 0.416121334f},
-std::array<float,2>{0.680405617f, 0.805239975f},
-std::array<float,2>{0.418479234f, 0.612313092f},
-std::array<float,2>{0.931127667f, 0.196660906f},
-std::array<float,2>{0.167151809f, 0.072413601f},
-std::array<float,2>{0.532941818f, 0.705840528f},
-std::array<float,2>{0.297797829f, 0.9805758f},
-std::array<float,2>{0.78615737f, 0.3091968f},
-std::array<float,2>{0.409618646f, 0.498996407f},
-std::array<float,2>{0.929532647f, 0.872523904f},
-std::array<float,2>{0.0940878689f, 0.509101093f},
-std::array<float,2>{0.677134633f, 0.127955899f},
-std::array<float,2>{0.352162421f, 0.215035617f},
-std::array<float,2>{0.855171919f, 0.605652809f},
-std::array<float,2>{0.197930455f, 0.789901257f},
-std::array<float,2>{0.588664472f, 0.435918063f},
-std::array<float,2>{0.03051438f, 0.349103898f},
-std::array<float,2>{0.716526151f, 0.904685855f},
-std::array<float,2>{0.491579503f, 0.672215641f},
-std::array<float,2>{0.953466952f, 0.0231583789f},
-std::array<float,2>{0.0831626356f, 0.174401015f},
-std::array<float,2>{0.630017817f, 0.549920022f},
-std::array<float,2>{0.392795622f, 0.815577805f},
-std::array<float,2>{0.887546659f, 0.454084575f},
-std::array<float,2>{0.269623667f, 0.270804048f},
-std::array<float,2>{0.778154433f, 0.967606783f},
-std::array<float,2>{0.140584558f, 0.739774883f},
-std::array<float,2>{0.52933079f, 0.11376451f},
-std::array<float,2>{0.449969441f, 0.038727764f},
-std::array<float,2>{0.994359374f, 0.650415421f},
-std::array<float,2>{0.0482185781f, 0.908112764f},
-std::array<float,2>{0.740646541f, 0.320000142f},
-std::array<float,2>{0.227114826f, 0.386839449f},
-std::array<float,2>{0.621670246f, 0.769896567f},
-std::array<float,2>{0.324518859f, 0.593562067f},
-std::array<float,2>{0.823425591f, 0.234441236f},
-std::array<float,2>{0.0421326794f, 0.0131520769f},
-std::array<float,2>{0.720721602f, 0.66696918f},
-std::array<float,2>{0.453515977f, 0.882179022f},
-std::array<float,2>{0.969461381f, 0.364300936f},
-std::array<float,2>{0.33946234f, 0.420224935f},
-std::array<float,2>{0.837772846f, 0.809507728f},
-std::array<float,2>{0.247859493f, 0.616584659f},
-std::array<float,2>{0.598834813f, 0.200401634f},
-std::array<float,2>{0.375800878f, 0.150660008f},
-std::array<float,2>{0.905141473f, 0.526088476f},
-std::array<float,2>{0.0710203722f, 0.859356403f},
-std::array<float,2>{0.643859982f, 0.482872397f},
-std::array<float,2>{0.147240937f, 0.282003671f},
-std::array<float,2>{0.509040773f, 0.996283054f},
-std::array<float,2>{0.260285974f, 0.701650798f},
-std::array<float,2>{0.751967072f, 0.0832193717f},
-std::array<float,2>{0.210941866f, 0.224328458f},
-std::array<float,2>{0.574362695f, 0.568634212f},
-std::array<float,2>{0.371594846f, 0.761070073f},
-std::array<float,2>{0.859878421f, 0.392879277f},
-std::array<float,2>{0.483008265f, 0.338962466f},
-std::array<float,2>{0.940811038f, 0.924411356f},
-std::array<float,2>{0.00481435936f, 0.628139734f},
-std::array<float,2>{0.688132107f, 0.047903996f},
-std::array<float,2>{0.291978538f, 0.10453023f},
-std::array<float,2>{0.800610602f, 0.729853749f},
-std::array<float,2>{0.182435229f, 0.950582027f},
-std::array<float,2>{0.547030568f, 0.26400882f},
-std::array<float,2>{0.11074923f, 0.450037271f},
-std::array<float,2>{0.660168767f, 0.842507601f},
-std::array<float,2>{0.423325032f, 0.541675508f},
-std::array<float,2>{0.914721847f, 0.159556687f},
-std::array<float,2>{0.235578731f, 0.0585843064f},
-std::array<float,2>{0.604404926f, 0.635773063f},
-std::array<float,2>{0.332821578f, 0.936371207f},
-std::array<float,2>{0.832372069f, 0.330667347f},
-std::array<float,2>{0.462419838f, 0.403517067f},
-std::array<float,2>{0.97888118f, 0.753648937f},
-std::array<float,2>{0.0364739373f, 0.571235418f},
-std::array<float,2>{0.73066926f, 0.228427932f},
-std::array<float,2>{0.25080955f, 0.169501454f},
-std::array<float,2>{0.760671616f, 0.532794595f},
-std::array<float,2>{0.150718585f, 0.832022548f},
-std::array<float,2>{0.50316149f, 0.441020399f},
-std::array<float,2>{0.0652713925f, 0.256444514f},
-std::array<float,2>{0.652356029f, 0.939561248f},
-std::array<float,2>{0.387981743f, 0.722369492f},
-std::array<float,2>{0.893741012f, 0.100117892f},
-std::array<float,2>{0.0154336989f, 0.193551362f},
-std::array<float,2>{0.699307263f, 0.621602833f},
-std::array<float,2>{0.470254481f, 0.800502598f},
-std::array<float,2>{0.951294303f, 0.406800121f},
-std::array<float,2>{0.365587234f, 0.368786424f},
-std::array<float,2>{0.870643616f, 0.887641788f},
-std::array<float,2>{0.204411998f, 0.659832358f},
-std::array<float,2>{0.567967355f, 0.00234036869f},
-std::array<float,2>{0.433952838f, 0.0932351351f},
-std::array<float,2>{0.913617969f, 0.690545201f},
-std::array<float,2>{0.12194059f, 0.990636289f},
-std::array<float,2>{0.671706259f, 0.294768304f},
-std::array<float,2>{0.176859885f, 0.475907654f},
-std::array<float,2>{0.559151351f, 0.850974381f},
-std::array<float,2>{0.2834512f, 0.517887235f},
-std::array<float,2>{0.80760926f, 0.140756145f},
-std::array<float,2>{0.107478887f, 0.119529545f},
-std::array<float,2>{0.685357213f, 0.749466836f},
-std::array<float,2>{0.415669113f, 0.954961479f},
-std::array<float,2>{0.936444402f, 0.278952777f},
-std::array<float,2>{0.311426252f, 0.467120588f},
-std::array<float,2>{0.791351855f, 0.822642088f},
-std::array<float,2>{0.157035336f, 0.56145817f},
-std::array<float,2>{0.545118272f, 0.183303103f},
-std::array<float,2>{0.497427732f, 0.247307494f},
-std::array<float,2>{0.967273593f, 0.578621209f},
-std::array<float,2>{0.0185736548f, 0.776928723f},
-std::array<float,2>{0.708368838f, 0.379231244f},
-std::array<float,2>{0.187963128f, 0.325066805f},
-std::array<float,2>{0.580004156f, 0.921216846f},
-std::array<float,2>{0.343905598f, 0.643645048f},
-std::array<float,2>{0.844590127f, 0.0398950279f},
-std::array<float,2>{0.128907546f, 0.140440628f},
-std::array<float,2>{0.520471513f, 0.503490508f},
-std::array<float,2>{0.277899057f, 0.866222024f},
-std::array<float,2>{0.772827208f, 0.488448173f},
-std::array<float,2>{0.398738086f, 0.301358759f},
-std::array<float,2>{0.882071316f, 0.975018919f},
-std::array<float,2>{0.0891643763f, 0.715348601f},
-std::array<float,2>{0.63836664f, 0.0636353642f},
-std::array<float,2>{0.31894058f, 0.0300660059f},
-std::array<float,2>{0.819381595f, 0.682219863f},
-std::array<float,2>{0.220562294f, 0.89338249f},
-std::array<float,2>{0.609493732f, 0.354083717f},
-std::array<float,2>{0.0547907725f, 0.42469576f},
-std::array<float,2>{0.746209979f, 0.785631061f},
-std::array<float,2>{0.439611673f, 0.596574903f},
-std::array<float,2>{0.98723346f, 0.210779831f},
-std::array<float,2>{0.199886724f, 0.0943775624f},
-std::array<float,2>{0.592588186f, 0.723118186f},
-std::array<float,2>{0.358929992f, 0.944779932f},
-std::array<float,2>{0.855664849f, 0.25212115f},
-std::array<float,2>{0.486816078f, 0.444740504f},
-std::array<float,2>{0.957320213f, 0.832219422f},
-std::array<float,2>{0.024568839f, 0.538562536f},
-std::array<float,2>{0.712325275f, 0.165043727f},
-std::array<float,2>{0.301510215f, 0.231165022f},
-std::array<float,2>{0.784123659f, 0.575838506f},
-std::array<float,2>{0.170782313f, 0.756605208f},
-std::array<float,2>{0.535807788f, 0.400602698f},
-std::array<float,2>{0.0989064723f, 0.333613038f},
-std::array<float,2>{0.674485981f, 0.932667077f},
-std::array<float,2>{0.412252307f, 0.638893366f},
-std::array<float,2>{0.923900783f, 0.0605331995f},
-std::array<float,2>{0.0536575615f, 0.146657825f},
-std::array<float,2>{0.734803617f, 0.522434115f},
-std::array<float,2>{0.447075427f, 0.84628576f},
-std::array<float,2>{0.996772051f, 0.468845159f},
-std::array<float,2>{0.321857989f, 0.291094303f},
-std::array<float,2>{0.825548649f, 0.986489534f},
-std::array<float,2>{0.23363176f, 0.692482173f},
-std::array<float,2>{0.620971262f, 0.0870730728f},
-std::array<float,2>{0.395227104f, 0.00416913163f},
-std::array<float,2>{0.886541665f, 0.663338661f},
-std::array<float,2>{0.0816472843f, 0.886284828f},
-std::array<float,2>{0.628313363f, 0.371232659f},
-std::array<float,2>{0.13358824f, 0.411680043f},
-std::array<float,2>{0.524148583f, 0.803955078f},
-std::array<float,2>{0.268176705f, 0.617456555f},
-std::array<float,2>{0.775832832f, 0.190979719f},
-std::array<float,2>{0.0747342259f, 0.0430701189f},
-std::array<float,2>{0.645887434f, 0.644794166f},
-std::array<float,2>{0.379222482f, 0.917437732f},
-std::array<float,2>{0.898915529f, 0.321545154f},
-std::array<float,2>{0.263786197f, 0.376304358f},
-std::array<float,2>{0.754988015f, 0.777562261f},
-std::array<float,2>{0.144406125f, 0.584116518f},
-std::array<float,2>{0.512261927f, 0.242544681f},
-std::array<float,2>{0.45879665f, 0.186472058f},
-std::array<float,2>{0.973028123f, 0.555294454f},
-std::array<float,2>{0.0464439951f, 0.825392902f},
-std::array<float,2>{0.726483941f, 0.461190701f},
-std::array<float,2>{0.245257407f, 0.273733735f},
-std::array<float,2>{0.595830142f, 0.96073842f},
-std::array<float,2>{0.342151731f, 0.743386924f},
-std::array<float,2>{0.841082573f, 0.121192753f},
-std::array<float,2>{0.184637174f, 0.206131414f},
-std::array<float,2>{0.552935004f, 0.600475311f},
-std::array<float,2>{0.294071674f, 0.785155773f},
-std::array<float,2>{0.800977767f, 0.427957833f},
-std::array<float,2>{0.428566903f, 0.357557833f},
-std::array<float,2>{0.921500206f, 0.898403883f},
-std::array<float,2>{0.115612648f, 0.686671138f},
-std::array<float,2>{0.656724453f, 0.0242661908f},
-std::array<float,2>{0.368929118f, 0.0697134361f},
-std::array<float,2>{0.866910756f, 0.714197397f},
-std::array<float,2>{0.215992063f, 0.969182968f},
-std::array<float,2>{0.573769867f, 0.299008012f},
-std::array<float,2>{0.000431474677f, 0.485918939f},
-std::array<float,2>{0.692829251f, 0.863139033f},
-std::array<float,2>{0.478649914f, 0.506072044f},
-std::array<float,2>{0.941447556f, 0.134606913f},
-std::array<float,2>{0.155874178f, 0.0168083552f},
-std::array<float,2>{0.505198896f, 0.679566741f},
-std::array<float,2>{0.257353663f, 0.90195471f},
-std::array<float,2>{0.762885153f, 0.346621513f},
-std::array<float,2>{0.384499878f, 0.429857105f},
-std::array<float,2>{0.897363722f, 0.794214666f},
-std::array<float,2>{0.0687075704f, 0.604411602f},
-std::array<float,2>{0.648955882f, 0.21399878f},
-std::array<float,2>{0.331312686f, 0.129874736f},
-std::array<float,2>{0.830143034f, 0.513960958f},
-std::array<float,2>{0.240705192f, 0.871093333f},
-std::array<float,2>{0.608201504f, 0.49438408f},
-std::array<float,2>{0.033866182f, 0.306603909f},
-std::array<float,2>{0.728405833f, 0.97969228f},
-std::array<float,2>{0.467965961f, 0.708698034f},
-std::array<float,2>{0.981245995f, 0.0768503249f},
-std::array<float,2>{0.11950542f, 0.239884555f},
-std::array<float,2>{0.664812028f, 0.587358236f},
-std::array<float,2>{0.429691046f, 0.766435027f},
-std::array<float,2>{0.910009265f, 0.386589646f},
-std::array<float,2>{0.287713587f, 0.315431058f},
-std::array<float,2>{0.812369585f, 0.91090703f},
-std::array<float,2>{0.174763098f, 0.655106544f},
-std::array<float,2>{0.557645917f, 0.0321803242f},
-std::array<float,2>{0.472742945f, 0.110905871f},
-std::array<float,2>{0.947439253f, 0.737756968f},
-std::array<float,2>{0.00984722842f, 0.963146269f},
-std::array<float,2>{0.697291732f, 0.266477346f},
-std::array<float,2>{0.208483323f, 0.459785432f},
-std::array<float,2>{0.564129412f, 0.818928897f},
-std::array<float,2>{0.359567404f, 0.550981045f},
-std::array<float,2>{0.873725474f, 0.176947281f},
-std::array<float,2>{0.0218492765f, 0.0790686682f},
-std::array<float,2>{0.706460536f, 0.699059308f},
-std::array<float,2>{0.494186789f, 0.993676245f},
-std::array<float,2>{0.964089632f, 0.288609892f},
-std::array<float,2>{0.351044983f, 0.478620559f},
-std::array<float,2>{0.847813189f, 0.85187006f},
-std::array<float,2>{0.195055306f, 0.530246437f},
-std::array<float,2>{0.583031178f, 0.155650109f},
-std::array<float,2>{0.420765668f, 0.198735654f},
-std::array<float,2>{0.932965875f, 0.610953093f},
-std::array<float,2>{0.102558509f, 0.807911932f},
-std::array<float,2>{0.682768285f, 0.414835572f},
-std::array<float,2>{0.162142187f, 0.362636507f},
-std::array<float,2>{0.5400877f, 0.878803253f},
-std::array<float,2>{0.305352747f, 0.668486059f},
-std::array<float,2>{0.794568241f, 0.0116863977f},
-std::array<float,2>{0.225635052f, 0.161348596f},
-std::array<float,2>{0.616364777f, 0.54297936f},
-std::array<float,2>{0.314676195f, 0.837065518f},
-std::array<float,2>{0.814468741f, 0.44787541f},
-std::array<float,2>{0.442254633f, 0.261700809f},
-std::array<float,2>{0.990583658f, 0.947225153f},
-std::array<float,2>{0.0601871312f, 0.731377125f},
-std::array<float,2>{0.742899299f, 0.106371261f},
-std::array<float,2>{0.275673509f, 0.0511841103f},
-std::array<float,2>{0.766557932f, 0.632045507f},
-std::array<float,2>{0.128807962f, 0.925800025f},
-std::array<float,2>{0.518640816f, 0.340651035f},
-std::array<float,2>{0.0928606987f, 0.398228407f},
-std::array<float,2>{0.634390056f, 0.76550889f},
-std::array<float,2>{0.406060904f, 0.56301558f},
-std::array<float,2>{0.875088036f, 0.222224563f},
-std::array<float,2>{0.182810858f, 0.101646565f},
-std::array<float,2>{0.548810422f, 0.726713717f},
-std::array<float,2>{0.292763174f, 0.953089595f},
-std::array<float,2>{0.799551785f, 0.262872249f},
-std::array<float,2>{0.422532171f, 0.453092456f},
-std::array<float,2>{0.915352702f, 0.841602683f},
-std::array<float,2>{0.109840013f, 0.539182365f},
-std::array<float,2>{0.661502004f, 0.156471819f},
-std::array<float,2>{0.372295082f, 0.226138487f},
-std::array<float,2>{0.861200571f, 0.567402959f},
-std::array<float,2>{0.212249473f, 0.75931263f},
-std::array<float,2>{0.57538873f, 0.390761882f},
-std::array<float,2>{0.00556979002f, 0.337145448f},
-std::array<float,2>{0.688560784f, 0.923532784f},
-std::array<float,2>{0.484159589f, 0.626370251f},
-std::array<float,2>{0.939976871f, 0.05066761f},
-std::array<float,2>{0.0720592514f, 0.148735642f},
-std::array<float,2>{0.642965853f, 0.523944616f},
-std::array<float,2>{0.376601487f, 0.856483102f},
-std::array<float,2>{0.905311584f, 0.481110007f},
-std::array<float,2>{0.261691064f, 0.284775138f},
-std::array<float,2>{0.75320375f, 0.998616636f},
-std::array<float,2>{0.147932723f, 0.700510442f},
-std::array<float,2>{0.507935405f, 0.0856491253f},
-std::array<float,2>{0.454497844f, 0.0142601691f},
-std::array<float,2>{0.970278323f, 0.66448462f},
-std::array<float,2>{0.0415194333f, 0.880396664f},
-std::array<float,2>{0.722391486f, 0.365603358f},
-std::array<float,2>{0.246541679f, 0.418507576f},
-std::array<float,2>{0.597938478f, 0.811255991f},
-std::array<float,2>{0.338377863f, 0.613623381f},
-std::array<float,2>{0.83633852f, 0.201759845f},
-std::array<float,2>{0.0477648191f, 0.0352861993f},
-std::array<float,2>{0.742175579f, 0.64916265f},
-std::array<float,2>{0.450678766f, 0.909861565f},
-std::array<float,2>{0.995633543f, 0.316733211f},
-std::array<float,2>{0.326119632f, 0.390487075f},
-std::array<float,2>{0.823178291f, 0.772133946f},
-std::array<float,2>{0.227998227f, 0.591080189f},
-std::array<float,2>{0.622716546f, 0.236520022f},
-std::array<float,2>{0.394368857f, 0.173137262f},
-std::array<float,2>{0.88815552f, 0.547035873f},
-std::array<float,2>{0.0823542103f, 0.812737703f},
-std::array<float,2>{0.629666567f, 0.45543927f},
-std::array<float,2>{0.139535651f, 0.27174294f},
-std::array<float,2>{0.53064543f, 0.965538979f},
-std::array<float,2>{0.270627469f, 0.740292311f},
-std::array<float,2>{0.778676629f, 0.116806276f},
-std::array<float,2>{0.198718414f, 0.218398824f},
-std::array<float,2>{0.589774728f, 0.608833134f},
-std::array<float,2>{0.353031963f, 0.792153299f},
-std::array<float,2>{0.854095519f, 0.43413201f},
-std::array<float,2>{0.490743637f, 0.349960387f},
-std::array<float,2>{0.954290748f, 0.902684629f},
-std::array<float,2>{0.0301197879f, 0.674774587f},
-std::array<float,2>{0.715230882f, 0.0199242551f},
-std::array<float,2>{0.298084527f, 0.0708735585f},
-std::array<float,2>{0.785729825f, 0.703643084f},
-std::array<float,2>{0.166191876f, 0.983124554f},
-std::array<float,2>{0.532076955f, 0.311642885f},
-std::array<float,2>{0.0950964913f, 0.498003602f},
-std::array<float,2>{0.676015198f, 0.873878539f},
-std::array<float,2>{0.409094065f, 0.51151222f},
-std::array<float,2>{0.928080618f, 0.126591668f},
-std::array<float,2>{0.219175711f, 0.028197173f},
-std::array<float,2>{0.610955596f, 0.681401551f},
-std::array<float,2>{0.319798291f, 0.8916049f},
-std::array<float,2>{0.818816006f, 0.353094161f},
-std::array<float,2>{0.440839171f, 0.423616469f},
-std::array<float,2>{0.987650692f, 0.787957728f},
-std::array<float,2>{0.055690866f, 0.594435155f},
-std::array<float,2>{0.747808814f, 0.208294228f},
-std::array<float,2>{0.279026002f, 0.137059242f},
-std::array<float,2>{0.772342265f, 0.501284778f},
-std::array<float,2>{0.13033928f, 0.864615738f},
-std::array<float,2>{0.520547807f, 0.490363061f},
-std::array<float,2>{0.0880432278f, 0.303933859f},
-std::array<float,2>{0.637460947f, 0.973954558f},
-std::array<float,2>{0.399629295f, 0.718043923f},
-std::array<float,2>{0.881366432f, 0.065137364f},
-std::array<float,2>{0.0180365257f, 0.248506323f},
-std::array<float,2>{0.707685232f, 0.581429541f},
-std::array<float,2>{0.496622741f, 0.774240673f},
-std::array<float,2>{0.968183517f, 0.381321907f},
-std::array<float,2>{0.345099479f, 0.326980203f},
-std::array<float,2>{0.845218837f, 0.919710159f},
-std::array<float,2>{0.189349681f, 0.642203033f},
-std::array<float,2>{0.578213632f, 0.0420646258f},
-std::array<float,2>{0.414860666f, 0.118011579f},
-std::array<float,2>{0.936639786f, 0.747266531f},
-std::array<float,2>{0.108756997f, 0.955304205f},
-std::array<float,2>{0.6836887f, 0.280077845f},
-std::array<float,2>{0.157791212f, 0.465822309f},
-std::array<float,2>{0.546663344f, 0.822177351f},
-std::array<float,2>{0.311727345f, 0.558837175f},
-std::array<float,2>{0.792450368f, 0.181607664f},
-std::array<float,2>{0.122445367f, 0.091566965f},
-std::array<float,2>{0.669976473f, 0.688413322f},
-std::array<float,2>{0.43475607f, 0.988584578f},
-std::array<float,2>{0.912137508f, 0.296631932f},
-std::array<float,2>{0.285115749f, 0.473554254f},
-std::array<float,2>{0.80827415f, 0.848888695f},
-std::array<float,2>{0.176082551f, 0.515630841f},
-std::array<float,2>{0.560318947f, 0.144039765f},
-std::array<float,2>{0.468953133f, 0.191627607f},
-std::array<float,2>{0.952836156f, 0.623525381f},
-std::array<float,2>{0.0142106032f, 0.798808455f},
-std::array<float,2>{0.70072329f, 0.410021961f},
-std::array<float,2>{0.203604192f, 0.369585991f},
-std::array<float,2>{0.566815794f, 0.890015304f},
-std::array<float,2>{0.36667642f, 0.657138824f},
-std::array<float,2>{0.869945168f, 0.00153404789f},
-std::array<float,2>{0.152122334f, 0.170731872f},
-std::array<float,2>{0.502573669f, 0.53365308f},
-std::array<float,2>{0.25170815f, 0.829449117f},
-std::array<float,2>{0.760798156f, 0.43889764f},
-std::array<float,2>{0.386894137f, 0.254491866f},
-std::array<float,2>{0.893490016f, 0.939451039f},
-std::array<float,2>{0.065555267f, 0.719366372f},
-std::array<float,2>{0.65363425f, 0.0990524441f},
-std::array<float,2>{0.333143085f, 0.054822877f},
-std::array<float,2>{0.833272815f, 0.633610308f},
-std::array<float,2>{0.235111207f, 0.93420577f},
-std::array<float,2>{0.605039716f, 0.329899669f},
-std::array<float,2>{0.0354306363f, 0.405196309f},
-std::array<float,2>{0.731735826f, 0.750509679f},
-std::array<float,2>{0.461654484f, 0.572793722f},
-std::array<float,2>{0.980457544f, 0.229167089f},
-std::array<float,2>{0.214894682f, 0.0675144121f},
-std::array<float,2>{0.572437942f, 0.711272717f},
-std::array<float,2>{0.367901444f, 0.97101754f},
-std::array<float,2>{0.865531623f, 0.297325611f},
-std::array<float,2>{0.479554266f, 0.486712873f},
-std::array<float,2>{0.942514122f, 0.860797942f},
-std::array<float,2>{0.00152698217f, 0.504479587f},
-std::array<float,2>{0.692289948f, 0.135572493f},
-std::array<float,2>{0.293326676f, 0.203510195f},
-std::array<float,2>{0.802562714f, 0.598816574f},
-std::array<float,2>{0.183744803f, 0.783130109f},
-std::array<float,2>{0.554548323f, 0.4265683f},
-std::array<float,2>{0.116381288f, 0.356363922f},
-std::array<float,2>{0.657854497f, 0.896031201f},
-std::array<float,2>{0.42950505f, 0.685281098f},
-std::array<float,2>{0.920055866f, 0.0256553497f},
-std::array<float,2>{0.0451143496f, 0.184742749f},
-std::array<float,2>{0.72540164f, 0.55718261f},
-std::array<float,2>{0.457780182f, 0.828041792f},
-std::array<float,2>{0.974118352f, 0.464101613f},
-std::array<float,2>{0.343724549f, 0.275791943f},
-std::array<float,2>{0.840261698f, 0.95843482f},
-std::array<float,2>{0.244592577f, 0.744354367f},
-std::array<float,2>{0.596961081f, 0.123417228f},
-std::array<float,2>{0.380427182f, 0.0461987816f},
-std::array<float,2>{0.899579346f, 0.646550179f},
-std::array<float,2>{0.0753352791f, 0.914846897f},
-std::array<float,2>{0.645339429f, 0.322805494f},
-std::array<float,2>{0.143032342f, 0.377246529f},
-std::array<float,2>{0.513513267f, 0.780944645f},
-std::array<float,2>{0.265157014f, 0.582866669f},
-std::array<float,2>{0.754159808f, 0.244815513f},
-std::array<float,2>{0.0803749859f, 0.00621230993f},
-std::array<float,2>{0.627272308f, 0.662044346f},
-std::array<float,2>{0.395578802f, 0.884055972f},
-std::array<float,2>{0.885264933f, 0.374077201f},
-std::array<float,2>{0.268955737f, 0.413613141f},
-std::array<float,2>{0.776933253f, 0.801580429f},
-std::array<float,2>{0.13423337f, 0.619930029f},
-std::array<float,2>{0.524560034f, 0.188758373f},
-std::array<float,2>{0.445401877f, 0.146111086f},
-std::array<float,2>{0.997918367f, 0.521282852f},
-std::array<float,2>{0.0541583449f, 0.84436965f},
-std::array<float,2>{0.735940814f, 0.472181469f},
-std::array<float,2>{0.232894793f, 0.290153563f},
-std::array<float,2>{0.619511902f, 0.984718502f},
-std::array<float,2>{0.320669472f, 0.694317758f},
-std::array<float,2>{0.82502073f, 0.0898037478f},
-std::array<float,2>{0.171215355f, 0.233796015f},
-std::array<float,2>{0.536816359f, 0.577513397f},
-std::array<float,2>{0.302526712f, 0.754495859f},
-std::array<float,2>{0.78497839f, 0.39888078f},
-std::array<float,2>{0.413974315f, 0.334581196f},
-std::array<float,2>{0.925156593f, 0.930667281f},
-std::array<float,2>{0.0983304456f, 0.637293279f},
-std::array<float,2>{0.67487973f, 0.0607563406f},
-std::array<float,2>{0.357560098f, 0.096410349f},
-std::array<float,2>{0.857281446f, 0.725465f},
-std::array<float,2>{0.200472668f, 0.942090392f},
-std::array<float,2>{0.59279412f, 0.25016126f},
-std::array<float,2>{0.0236128476f, 0.442493409f},
-std::array<float,2>{0.711783648f, 0.835136354f},
-std::array<float,2>{0.487423539f, 0.535309494f},
-std::array<float,2>{0.958063662f, 0.167400107f},
-std::array<float,2>{0.127892956f, 0.0533132441f},
-std::array<float,2>{0.518487513f, 0.629841805f},
-std::array<float,2>{0.2772156f, 0.92957139f},
-std::array<float,2>{0.767550707f, 0.34257254f},
-std::array<float,2>{0.404846758f, 0.395029396f},
-std::array<float,2>{0.876804352f, 0.76242584f},
-std::array<float,2>{0.0925787091f, 0.565854251f},
-std::array<float,2>{0.633018792f, 0.219774604f},
-std::array<float,2>{0.316375405f, 0.162453383f},
-std::array<float,2>{0.816371679f, 0.545540035f},
-std::array<float,2>{0.225281477f, 0.837891161f},
-std::array<float,2>{0.615939081f, 0.445567131f},
-std::array<float,2>{0.0590061396f, 0.258583754f},
-std::array<float,2>{0.743201137f, 0.948906183f},
-std::array<float,2>{0.443231553f, 0.733162284f},
-std::array<float,2>{0.991271257f, 0.108570717f},
-std::array<float,2>{0.101900816f, 0.196282476f},
-std::array<float,2>{0.682047188f, 0.611345947f},
-std::array<float,2>{0.421143949f, 0.805689752f},
-std::array<float,2>{0.93195188f, 0.41728431f},
-std::array<float,2>{0.306429505f, 0.361017525f},
-std::array<float,2>{0.793756604f, 0.876207173f},
-std::array<float,2>{0.163985252f, 0.671833754f},
-std::array<float,2>{0.539643645f, 0.00898918137f},
-std::array<float,2>{0.495332062f, 0.081120491f},
-std::array<float,2>{0.962895334f, 0.697136939f},
-std::array<float,2>{0.0232992936f, 0.995919466f},
-std::array<float,2>{0.706044793f, 0.28649044f},
-std::array<float,2>{0.193851694f, 0.477379471f},
-std::array<float,2>{0.582856297f, 0.854719341f},
-std::array<float,2>{0.349652976f, 0.527592242f},
-std::array<float,2>{0.849304914f, 0.152852178f},
-std::array<float,2>{0.0114976605f, 0.112693541f},
-std::array<float,2>{0.698852062f, 0.735731721f},
-std::array<float,2>{0.473703146f, 0.961800158f},
-std::array<float,2>{0.948609412f, 0.268404216f},
-std::array<float,2>{0.360851765f, 0.457134634f},
-std::array<float,2>{0.8746261f, 0.816611707f},
-std::array<float,2>{0.207540259f, 0.554146647f},
-std::array<float,2>{0.562571585f, 0.178314894f},
-std::array<float,2>{0.431362718f, 0.240629986f},
-std::array<float,2>{0.908905745f, 0.589820921f},
-std::array<float,2>{0.120869249f, 0.769011259f},
-std::array<float,2>{0.665320039f, 0.383697987f},
-std::array<float,2>{0.175414935f, 0.313434988f},
-std::array<float,2>{0.556921542f, 0.913235486f},
-std::array<float,2>{0.288173914f, 0.652639329f},
-std::array<float,2>{0.811426044f, 0.0338688269f},
-std::array<float,2>{0.241436034f, 0.13151142f},
-std::array<float,2>{0.608815014f, 0.513142109f},
-std::array<float,2>{0.330304444f, 0.869074166f},
-std::array<float,2>{0.831096053f, 0.492860228f},
-std::array<float,2>{0.467632234f, 0.307294905f},
-std::array<float,2>{0.98164767f, 0.978395641f},
-std::array<float,2>{0.034522742f, 0.710659683f},
-std::array<float,2>{0.726871431f, 0.0753546953f},
-std::array<float,2>{0.25622806f, 0.0187625047f},
-std::array<float,2>{0.76194942f, 0.677629292f},
-std::array<float,2>{0.154475436f, 0.899937689f},
-std::array<float,2>{0.504741967f, 0.344747722f},
-std::array<float,2>{0.0697135106f, 0.433294654f},
-std::array<float,2>{0.650028884f, 0.796418786f},
-std::array<float,2>{0.382957757f, 0.603143036f},
-std::array<float,2>{0.897881746f, 0.211076468f},
-std::array<float,2>{0.14524734f, 0.0828373879f},
-std::array<float,2>{0.511617124f, 0.702157855f},
-std::array<float,2>{0.258144051f, 0.997950137f},
-std::array<float,2>{0.751817644f, 0.28311339f},
-std::array<float,2>{0.378060997f, 0.483694196f},
-std::array<float,2>{0.903877318f, 0.858308792f},
-std::array<float,2>{0.0735071003f, 0.526856959f},
-std::array<float,2>{0.641367316f, 0.151480243f},
-std::array<float,2>{0.337827682f, 0.199399784f},
-std::array<float,2>{0.839033186f, 0.615882277f},
-std::array<float,2>{0.248912767f, 0.810135186f},
-std::array<float,2>{0.600002587f, 0.421783388f},
-std::array<float,2>{0.040766824f, 0.363584131f},
-std::array<float,2>{0.719500005f, 0.881057084f},
-std::array<float,2>{0.456361979f, 0.667388737f},
-std::array<float,2>{0.972216904f, 0.0121325143f},
-std::array<float,2>{0.111760959f, 0.158984348f},
-std::array<float,2>{0.662518799f, 0.542193353f},
-std::array<float,2>{0.424218029f, 0.843403637f},
-std::array<float,2>{0.916120052f, 0.450708628f},
-std::array<float,2>{0.289876908f, 0.265179366f},
-std::array<float,2>{0.798445463f, 0.949614227f},
-std::array<float,2>{0.181346118f, 0.729177475f},
-std::array<float,2>{0.549329638f, 0.104378723f},
-std::array<float,2>{0.481704205f, 0.0476511717f},
-std::array<float,2>{0.939244866f, 0.627185464f},
-std::array<float,2>{0.00638619578f, 0.925319374f},
-std::array<float,2>{0.689607561f, 0.338487267f},
-std::array<float,2>{0.214130342f, 0.39431724f},
-std::array<float,2>{0.576518893f, 0.759888768f},
-std::array<float,2>{0.373131901f, 0.569752455f},
-std::array<float,2>{0.862156928f, 0.223237023f},
-std::array<float,2>{0.0279071648f, 0.0216078367f},
-std::array<float,2>{0.717763245f, 0.673826933f},
-std::array<float,2>{0.489090681f, 0.905380785f},
-std::array<float,2>{0.95650512f, 0.348310649f},
-std::array<float,2>{0.354038388f, 0.436850846f},
-std::array<float,2>{0.853306949f, 0.790660441f},
-std::array<float,2>{0.195929706f, 0.607067049f},
-std::array<float,2>{0.585983694f, 0.21609889f},
-std::array<float,2>{0.407726645f, 0.127647236f},
-std::array<float,2>{0.926081717f, 0.508305967f},
-std::array<float,2>{0.096487999f, 0.871544898f},
-std::array<float,2>{0.679619312f, 0.499157459f},
-std::array<float,2>{0.164411873f, 0.309669167f},
-std::array<float,2>{0.534409702f, 0.981753528f},
-std::array<float,2>{0.300501466f, 0.706190169f},
-std::array<float,2>{0.789023042f, 0.0737581849f},
-std::array<float,2>{0.229564175f, 0.235933036f},
-std::array<float,2>{0.623990178f, 0.591986895f},
-std::array<float,2>{0.326279968f, 0.770820141f},
-std::array<float,2>{0.821408987f, 0.387978375f},
-std::array<float,2>{0.452021539f, 0.319303334f},
-std::array<float,2>{0.992565811f, 0.906441867f},
-std::array<float,2>{0.0491196066f, 0.651860476f},
-std::array<float,2>{0.738489568f, 0.03767756f},
-std::array<float,2>{0.273339927f, 0.115138575f},
-std::array<float,2>{0.781226575f, 0.739141583f},
-std::array<float,2>{0.137464449f, 0.968472064f},
-std::array<float,2>{0.528966367f, 0.26982379f},
-std::array<float,2>{0.0853122026f, 0.454835743f},
-std::array<float,2>{0.631233037f, 0.815238655f},
-std::array<float,2>{0.391195029f, 0.549527049f},
-std::array<float,2>{0.890513301f, 0.174939901f},
-std::array<float,2>{0.190974966f, 0.0403434262f},
-std::array<float,2>{0.581313312f, 0.64275521f},
-std::array<float,2>{0.346469879f, 0.919994533f},
-std::array<float,2>{0.847052336f, 0.325234234f},
-std::array<float,2>{0.499243975f, 0.380430549f},
-std::array<float,2>{0.964859545f, 0.775867462f},
-std::array<float,2>{0.0162503775f, 0.579721928f},
-std::array<float,2>{0.709543884f, 0.246883407f},
-std::array<float,2>{0.309611231f, 0.182155505f},
-std::array<float,2>{0.789160311f, 0.561821103f},
-std::array<float,2>{0.159318164f, 0.823383152f},
-std::array<float,2>{0.544333816f, 0.468681544f},
-std::array<float,2>{0.106049389f, 0.277796954f},
-std::array<float,2>{0.686817825f, 0.953353226f},
-std::array<float,2>{0.417148083f, 0.748175621f},
-std::array<float,2>{0.934434474f, 0.12086837f},
-std::array<float,2>{0.0585911572f, 0.209330246f},
-std::array<float,2>{0.748356581f, 0.597263515f},
-std::array<float,2>{0.437594086f, 0.786286891f},
-std::array<float,2>{0.984847546f, 0.425779015f},
-std::array<float,2>{0.317199409f, 0.355260581f},
-std::array<float,2>{0.81705308f, 0.893790185f},
-std::array<float,2>{0.221204162f, 0.68297869f},
-std::array<float,2>{0.612247348f, 0.0305881593f},
-std::array<float,2>{0.402299792f, 0.062972784f},
-std::array<float,2>{0.880678415f, 0.71657598f},
-std::array<float,2>{0.0865766332f, 0.975662291f},
-std::array<float,2>{0.6395787f, 0.302191496f},
-std::array<float,2>{0.131977841f, 0.48935768f},
-std::array<float,2>{0.522266388f, 0.865273833f},
-std::array<float,2>{0.280961692f, 0.502820015f},
-std::array<float,2>{0.769753456f, 0.13956438f},
-std::array<float,2>{0.0638910905f, 0.101447545f},
-std::array<float,2>{0.654953241f, 0.72144419f},
-std::array<float,2>{0.389621198f, 0.94044131f},
-std::array<float,2>{0.892463326f, 0.256915361f},
-std::array<float,2>{0.252321362f, 0.439609557f},
-std::array<float,2>{0.759497523f, 0.830816448f},
-std::array<float,2>{0.149565384f, 0.53169769f},
-std::array<float,2>{0.501444519f, 0.168663472f},
-std::array<float,2>{0.464525789f, 0.227480069f},
-std::array<float,2>{0.976903379f, 0.571930826f},
-std::array<float,2>{0.0373975225f, 0.752067149f},
-std::array<float,2>{0.733120859f, 0.402591437f},
-std::array<float,2>{0.236489519f, 0.331535518f},
-std::array<float,2>{0.60167855f, 0.936533093f},
-std::array<float,2>{0.333998024f, 0.635563195f},
-std::array<float,2>{0.833987951f, 0.0573390312f},
-std::array<float,2>{0.177981779f, 0.142206445f},
-std::array<float,2>{0.561782658f, 0.518947721f},
-std::array<float,2>{0.281467497f, 0.849860668f},
-std::array<float,2>{0.804988205f, 0.474755585f},
-std::array<float,2>{0.436406881f, 0.293044657f},
-std::array<float,2>{0.910659611f, 0.992079735f},
-std::array<float,2>{0.123566076f, 0.690278769f},
-std::array<float,2>{0.668520212f, 0.0918734446f},
-std::array<float,2>{0.363655895f, 0.00370172737f},
-std::array<float,2>{0.869068563f, 0.659018934f},
-std::array<float,2>{0.205195472f, 0.888302088f},
-std::array<float,2>{0.568616509f, 0.368111998f},
-std::array<float,2>{0.0119217699f, 0.407995284f},
-std::array<float,2>{0.702994943f, 0.799606204f},
-std::array<float,2>{0.471108139f, 0.622228801f},
-std::array<float,2>{0.950601816f, 0.194563404f},
-std::array<float,2>{0.242503494f, 0.122524761f},
-std::array<float,2>{0.59542346f, 0.742653131f},
-std::array<float,2>{0.340790927f, 0.959394336f},
-std::array<float,2>{0.843394756f, 0.274609268f},
-std::array<float,2>{0.459397227f, 0.462710112f},
-std::array<float,2>{0.974613905f, 0.825035036f},
-std::array<float,2>{0.04304168f, 0.555757582f},
-std::array<float,2>{0.723380506f, 0.186812729f},
-std::array<float,2>{0.263102293f, 0.243600205f},
-std::array<float,2>{0.757554293f, 0.585161448f},
-std::array<float,2>{0.142022312f, 0.779165626f},
-std::array<float,2>{0.514567912f, 0.37526989f},
-std::array<float,2>{0.0777714252f, 0.320668161f},
-std::array<float,2>{0.646589756f, 0.9163028f},
-std::array<float,2>{0.381950468f, 0.646447361f},
-std::array<float,2>{0.901766896f, 0.0446823202f},
-std::array<float,2>{0.00279540196f, 0.133603737f},
-std::array<float,2>{0.694929719f, 0.506969988f},
-std::array<float,2>{0.476785332f, 0.862044334f},
-std::array<float,2>{0.943830073f, 0.485170722f},
-std::array<float,2>{0.370115817f, 0.300032318f},
-std::array<float,2>{0.865200758f, 0.969963491f},
-std::array<float,2>{0.216994151f, 0.713666081f},
-std::array<float,2>{0.571816981f, 0.0685986802f},
-std::array<float,2>{0.4271276f, 0.024794234f},
-std::array<float,2>{0.91962868f, 0.685977817f},
-std::array<float,2>{0.114943132f, 0.897204697f},
-std::array<float,2>{0.658402205f, 0.358902752f},
-std::array<float,2>{0.186589643f, 0.429335833f},
-std::array<float,2>{0.551897168f, 0.784112573f},
-std::array<float,2>{0.296591759f, 0.600887656f},
-std::array<float,2>{0.804184079f, 0.205201611f},
-std::array<float,2>{0.101312786f, 0.0592805818f},
-std::array<float,2>{0.67336005f, 0.639713585f},
-std::array<float,2>{0.410731673f, 0.93176496f},
-std::array<float,2>{0.922305048f, 0.332936108f},
-std::array<float,2>{0.303842127f, 0.402069986f},
-std::array<float,2>{0.782408059f, 0.757657588f},
-std::array<float,2>{0.169090465f, 0.575188518f},
-std::array<float,2>{0.53874445f, 0.232010096f},
-std::array<float,2>{0.484829187f, 0.164168552f},
-std::array<float,2>{0.960644841f, 0.538020253f},
-std::array<float,2>{0.026813183f, 0.833500266f},
-std::array<float,2>{0.713992774f, 0.443738431f},
-std::array<float,2>{0.202603921f, 0.253545225f},
-std::array<float,2>{0.590191185f, 0.943819165f},
-std::array<float,2>{0.357356876f, 0.723736048f},
-std::array<float,2>{0.858584702f, 0.0956536755f},
-std::array<float,2>{0.134863377f, 0.190080777f},
-std::array<float,2>{0.525764465f, 0.618672788f},
-std::array<float,2>{0.265809238f, 0.803576291f},
-std::array<float,2>{0.773694277f, 0.410191238f},
-std::array<float,2>{0.398113489f, 0.372845054f},
-std::array<float,2>{0.882858694f, 0.885060728f},
-std::array<float,2>{0.0784392953f, 0.66232127f},
-std::array<float,2>{0.625697196f, 0.0051926258f},
-std::array<float,2>{0.323594958f, 0.0859589279f},
-std::array<float,2>{0.827698112f, 0.69197911f},
-std::array<float,2>{0.230720103f, 0.987327516f},
-std::array<float,2>{0.617598832f, 0.292365611f},
-std::array<float,2>{0.0515462346f, 0.470645607f},
-std::array<float,2>{0.736539543f, 0.847301841f},
-std::array<float,2>{0.448802143f, 0.523131788f},
-std::array<float,2>{0.999648094f, 0.148302048f},
-std::array<float,2>{0.161986485f, 0.00993979536f},
-std::array<float,2>{0.54181838f, 0.669869721f},
-std::array<float,2>{0.306716084f, 0.877163172f},
-std::array<float,2>{0.796313405f, 0.362178355f},
-std::array<float,2>{0.419347018f, 0.415673792f},
-std::array<float,2>{0.930544078f, 0.807207048f},
-std::array<float,2>{0.10525579f, 0.610092163f},
-std::array<float,2>{0.680673778f, 0.197754204f},
-std::array<float,2>{0.348370194f, 0.155122802f},
-std::array<float,2>{0.850949526f, 0.530597448f},
-std::array<float,2>{0.191423133f, 0.852913618f},
-std::array<float,2>{0.584187269f, 0.479947954f},
-std::array<float,2>{0.0205608774f, 0.287634462f},
-std::array<float,2>{0.704124033f, 0.992257535f},
-std::array<float,2>{0.493541926f, 0.69789201f},
-std::array<float,2>{0.961879373f, 0.0793795288f},
-std::array<float,2>{0.0900467113f, 0.22140646f},
-std::array<float,2>{0.636289358f, 0.564097881f},
-std::array<float,2>{0.402424306f, 0.764319539f},
-std::array<float,2>{0.878877103f, 0.397343755f},
-std::array<float,2>{0.274889439f, 0.340842187f},
-std::array<float,2>{0.767838478f, 0.927312195f},
-std::array<float,2>{0.125442833f, 0.631804585f},
-std::array<float,2>{0.517033637f, 0.052181188f},
-std::array<float,2>{0.444838345f, 0.107409887f},
-std::array<float,2>{0.990020692f, 0.732290983f},
-std::array<float,2>{0.0608117096f, 0.945789576f},
-std::array<float,2>{0.745910347f, 0.259872586f},
-std::array<float,2>{0.223119095f, 0.448807776f},
-std::array<float,2>{0.614586532f, 0.836057484f},
-std::array<float,2>{0.313111156f, 0.544731975f},
-std::array<float,2>{0.813503385f, 0.160263792f},
-std::array<float,2>{0.0331368372f, 0.0778684691f},
-std::array<float,2>{0.729405284f, 0.707115412f},
-std::array<float,2>{0.466635108f, 0.97887671f},
-std::array<float,2>{0.982955575f, 0.305356532f},
-std::array<float,2>{0.328403711f, 0.495231211f},
-std::array<float,2>{0.82939297f, 0.869785905f},
-std::array<float,2>{0.238371894f, 0.5155074f},
-std::array<float,2>{0.6057657f, 0.130461872f},
-std::array<float,2>{0.385864556f, 0.213159189f},
-std::array<float,2>{0.894647062f, 0.604946554f},
-std::array<float,2>{0.0679600313f, 0.793716133f},
-std::array<float,2>{0.650753021f, 0.431230724f},
-std::array<float,2>{0.1533622f, 0.347363114f},
-std::array<float,2>{0.506763935f, 0.90068543f},
-std::array<float,2>{0.254316151f, 0.677900672f},
-std::array<float,2>{0.765136778f, 0.0156886503f},
-std::array<float,2>{0.209441587f, 0.175971389f},
-std::array<float,2>{0.565657079f, 0.552408755f},
-std::array<float,2>{0.362321556f, 0.819988906f},
-std::array<float,2>{0.872664869f, 0.460777521f},
-std::array<float,2>{0.474665582f, 0.266994148f},
-std::array<float,2>{0.946218431f, 0.964609325f},
-std::array<float,2>{0.00971234683f, 0.736810148f},
-std::array<float,2>{0.696361423f, 0.109444425f},
-std::array<float,2>{0.286429524f, 0.0323348939f},
-std::array<float,2>{0.809496284f, 0.655315936f},
-std::array<float,2>{0.173574314f, 0.911745071f},
-std::array<float,2>{0.556469917f, 0.315318823f},
-std::array<float,2>{0.118798018f, 0.385721654f},
-std::array<float,2>{0.667753756f, 0.766738474f},
-std::array<float,2>{0.433269352f, 0.58598417f},
-std::array<float,2>{0.907452464f, 0.238856733f},
-std::array<float,2>{0.141707942f, 0.124718778f},
-std::array<float,2>{0.514211297f, 0.745922148f},
-std::array<float,2>{0.2627047f, 0.95736599f},
-std::array<float,2>{0.757673919f, 0.277001083f},
-std::array<float,2>{0.382138312f, 0.463333726f},
-std::array<float,2>{0.901441395f, 0.827137887f},
-std::array<float,2>{0.0781249255f, 0.557753384f},
-std::array<float,2>{0.646740258f, 0.184462935f},
-std::array<float,2>{0.340520769f, 0.245231658f},
-std::array<float,2>{0.843745828f, 0.583879173f},
-std::array<float,2>{0.242412984f, 0.78013736f},
-std::array<float,2>{0.595601559f, 0.37810877f},
-std::array<float,2>{0.0432743393f, 0.323519379f},
-std::array<float,2>{0.723588705f, 0.915432453f},
-std::array<float,2>{0.45906058f, 0.648151338f},
-std::array<float,2>{0.975015998f, 0.0449728966f},
-std::array<float,2>{0.115048118f, 0.136115864f},
-std::array<float,2>{0.658451855f, 0.505841613f},
-std::array<float,2>{0.426819384f, 0.860125005f},
-std::array<float,2>{0.919835627f, 0.487974733f},
-std::array<float,2>{0.296771735f, 0.29850325f},
-std::array<float,2>{0.803732157f, 0.971697509f},
-std::array<float,2>{0.186839938f, 0.712051272f},
-std::array<float,2>{0.552030623f, 0.0670490786f},
-std::array<float,2>{0.476923048f, 0.0273393616f},
-std::array<float,2>{0.943553984f, 0.684478879f},
-std::array<float,2>{0.00244678766f, 0.894595563f},
-std::array<float,2>{0.69529146f, 0.357183278f},
-std::array<float,2>{0.217211977f, 0.426817864f},
-std::array<float,2>{0.572253585f, 0.781398356f},
-std::array<float,2>{0.36981979f, 0.598086596f},
-std::array<float,2>{0.864874542f, 0.204718009f},
-std::array<float,2>{0.0265826024f, 0.062241748f},
-std::array<float,2>{0.714266837f, 0.637868822f},
-std::array<float,2>{0.484447151f, 0.930389643f},
-std::array<float,2>{0.960890174f, 0.335864276f},
-std::array<float,2>{0.356962979f, 0.400202066f},
-std::array<float,2>{0.85881561f, 0.755277812f},
-std::array<float,2>{0.202164382f, 0.576312602f},
-std::array<float,2>{0.589929342f, 0.233343661f},
-std::array<float,2>{0.410942823f, 0.166061133f},
-std::array<float,2>{0.92193538f, 0.536495149f},
-std::array<float,2>{0.101326138f, 0.83495754f},
-std::array<float,2>{0.673753917f, 0.442293346f},
-std::array<float,2>{0.169236258f, 0.251408517f},
-std::array<float,2>{0.538993657f, 0.942580462f},
-std::array<float,2>{0.304137409f, 0.726212263f},
-std::array<float,2>{0.782536149f, 0.0974521041f},
-std::array<float,2>{0.230577976f, 0.188020572f},
-std::array<float,2>{0.617249608f, 0.620315909f},
-std::array<float,2>{0.323388964f, 0.802615762f},
-std::array<float,2>{0.828056455f, 0.412365019f},
-std::array<float,2>{0.448994279f, 0.373188436f},
-std::array<float,2>{0.999898255f, 0.883026779f},
-std::array<float,2>{0.0513453633f, 0.660954356f},
-std::array<float,2>{0.73676163f, 0.00770375226f},
-std::array<float,2>{0.265899926f, 0.0878919512f},
-std::array<float,2>{0.773659408f, 0.694940448f},
-std::array<float,2>{0.135019585f, 0.986311197f},
-std::array<float,2>{0.525429785f, 0.289886087f},
-std::array<float,2>{0.0782343745f, 0.47114864f},
-std::array<float,2>{0.625772595f, 0.844839573f},
-std::array<float,2>{0.398309231f, 0.520077229f},
-std::array<float,2>{0.883139133f, 0.144929796f},
-std::array<float,2>{0.191657722f, 0.0082487436f},
-std::array<float,2>{0.584387839f, 0.670230031f},
-std::array<float,2>{0.348437756f, 0.875676095f},
-std::array<float,2>{0.85066241f, 0.359679639f},
-std::array<float,2>{0.493229687f, 0.416928649f},
-std::array<float,2>{0.961616218f, 0.8049317f},
-std::array<float,2>{0.0209396984f, 0.61312598f},
-std::array<float,2>{0.704449654f, 0.197031289f},
-std::array<float,2>{0.307125419f, 0.153543442f},
-std::array<float,2>{0.795924306f, 0.528852224f},
-std::array<float,2>{0.161623314f, 0.853841066f},
-std::array<float,2>{0.541686654f, 0.477764517f},
-std::array<float,2>{0.105038315f, 0.285840005f},
-std::array<float,2>{0.681122005f, 0.994344115f},
-std::array<float,2>{0.419080824f, 0.696253657f},
-std::array<float,2>{0.930208564f, 0.0805788338f},
-std::array<float,2>{0.060749393f, 0.218989551f},
-std::array<float,2>{0.745716572f, 0.565262675f},
-std::array<float,2>{0.445169747f, 0.763366044f},
-std::array<float,2>{0.98996532f, 0.395898283f},
-std::array<float,2>{0.313343674f, 0.343086571f},
-std::array<float,2>{0.813755155f, 0.928141117f},
-std::array<float,2>{0.222679436f, 0.630587101f},
-std::array<float,2>{0.614465952f, 0.0545175336f},
-std::array<float,2>{0.402736425f, 0.108176164f},
-std::array<float,2>{0.878649354f, 0.733612299f},
-std::array<float,2>{0.0901493058f, 0.947639048f},
-std::array<float,2>{0.636669278f, 0.259560436f},
-std::array<float,2>{0.125017509f, 0.446391106f},
-std::array<float,2>{0.516616523f, 0.839327872f},
-std::array<float,2>{0.274460971f, 0.546499372f},
-std::array<float,2>{0.767741024f, 0.163914859f},
-std::array<float,2>{0.0681717545f, 0.0745227933f},
-std::array<float,2>{0.650480092f, 0.709334612f},
-std::array<float,2>{0.386146247f, 0.97733438f},
-std::array<float,2>{0.894819856f, 0.307773411f},
-std::array<float,2>{0.254036874f, 0.493613929f},
-std::array<float,2>{0.765471816f, 0.867970407f},
-std::array<float,2>{0.153739169f, 0.512647152f},
-std::array<float,2>{0.506562829f, 0.132144749f},
-std::array<float,2>{0.466464788f, 0.212804496f},
-std::array<float,2>{0.983350217f, 0.602182508f},
-std::array<float,2>{0.0328382701f, 0.795016348f},
-std::array<float,2>{0.729019344f, 0.431828529f},
-std::array<float,2>{0.23862043f, 0.344420403f},
-std::array<float,2>{0.60563916f, 0.898439765f},
-std::array<float,2>{0.328285873f, 0.676374853f},
-std::array<float,2>{0.829155326f, 0.017765915f},
-std::array<float,2>{0.173803911f, 0.179459557f},
-std::array<float,2>{0.556392252f, 0.552868843f},
-std::array<float,2>{0.286196828f, 0.818135321f},
-std::array<float,2>{0.809135735f, 0.458529651f},
-std::array<float,2>{0.433414251f, 0.269330263f},
-std::array<float,2>{0.90757066f, 0.962025642f},
-std::array<float,2>{0.119112357f, 0.734978318f},
-std::array<float,2>{0.667616904f, 0.111340396f},
-std::array<float,2>{0.362756193f, 0.0346174091f},
-std::array<float,2>{0.872976959f, 0.654189646f},
-std::array<float,2>{0.209117785f, 0.912815511f},
-std::array<float,2>{0.565822184f, 0.313760906f},
-std::array<float,2>{0.00946790166f, 0.384298623f},
-std::array<float,2>{0.696556032f, 0.767650723f},
-std::array<float,2>{0.47499308f, 0.588222325f},
-std::array<float,2>{0.945917547f, 0.242002085f},
-std::array<float,2>{0.248774394f, 0.0848663226f},
-std::array<float,2>{0.599617064f, 0.699931741f},
-std::array<float,2>{0.337543219f, 0.999816716f},
-std::array<float,2>{0.83919245f, 0.283589005f},
-std::array<float,2>{0.45622164f, 0.481459796f},
-std::array<float,2>{0.972566009f, 0.856312811f},
-std::array<float,2>{0.0409433246f, 0.525318444f},
-std::array<float,2>{0.719380677f, 0.149650261f},
-std::array<float,2>{0.25793767f, 0.202833384f},
-std::array<float,2>{0.751675963f, 0.614647806f},
-std::array<float,2>{0.145445645f, 0.812084913f},
-std::array<float,2>{0.511264026f, 0.419329077f},
-std::array<float,2>{0.073448725f, 0.367158562f},
-std::array<float,2>{0.641196966f, 0.879276931f},
-std::array<float,2>{0.378204614f, 0.665389419f},
-std::array<float,2>{0.904072344f, 0.0151339136f},
-std::array<float,2>{0.00678186165f, 0.157415986f},
-std::array<float,2>{0.689715266f, 0.540831745f},
-std::array<float,2>{0.481471986f, 0.84035939f},
-std::array<float,2>{0.939061463f, 0.451816708f},
-std::array<float,2>{0.373344392f, 0.262055308f},
-std::array<float,2>{0.862037122f, 0.951639533f},
-std::array<float,2>{0.213948861f, 0.728258133f},
-std::array<float,2>{0.576233864f, 0.103476726f},
-std::array<float,2>{0.423838407f, 0.0494247675f},
-std::array<float,2>{0.916468501f, 0.625625134f},
-std::array<float,2>{0.111331135f, 0.922553778f},
-std::array<float,2>{0.662235677f, 0.336414248f},
-std::array<float,2>{0.181630045f, 0.391795397f},
-std::array<float,2>{0.54960084f, 0.757900178f},
-std::array<float,2>{0.289641052f, 0.567334652f},
-std::array<float,2>{0.798717618f, 0.225547135f},
-std::array<float,2>{0.09642905f, 0.0205954295f},
-std::array<float,2>{0.679429114f, 0.675334632f},
-std::array<float,2>{0.408138037f, 0.903785825f},
-std::array<float,2>{0.926015556f, 0.350990534f},
-std::array<float,2>{0.300607651f, 0.435099036f},
-std::array<float,2>{0.788579881f, 0.791651666f},
-std::array<float,2>{0.164198458f, 0.607680023f},
-std::array<float,2>{0.534635544f, 0.217633739f},
-std::array<float,2>{0.488786161f, 0.125791296f},
-std::array<float,2>{0.956099629f, 0.510456264f},
-std::array<float,2>{0.0281167552f, 0.874744058f},
-std::array<float,2>{0.717322052f, 0.496871352f},
-std::array<float,2>{0.19608207f, 0.310788751f},
-std::array<float,2>{0.586188197f, 0.983611643f},
-std::array<float,2>{0.354477823f, 0.705068529f},
-std::array<float,2>{0.853232265f, 0.071841903f},
-std::array<float,2>{0.137382805f, 0.238178819f},
-std::array<float,2>{0.529235303f, 0.590194762f},
-std::array<float,2>{0.273033351f, 0.772853017f},
-std::array<float,2>{0.780905962f, 0.389630526f},
-std::array<float,2>{0.391479701f, 0.317819864f},
-std::array<float,2>{0.890259683f, 0.909101069f},
-std::array<float,2>{0.0852001533f, 0.650180042f},
-std::array<float,2>{0.630958021f, 0.0363104902f},
-std::array<float,2>{0.326519817f, 0.116137132f},
-std::array<float,2>{0.821660101f, 0.741727769f},
-std::array<float,2>{0.229879916f, 0.966555417f},
-std::array<float,2>{0.623649359f, 0.272810847f},
-std::array<float,2>{0.0490007177f, 0.456885934f},
-std::array<float,2>{0.73855406f, 0.813663363f},
-std::array<float,2>{0.451876372f, 0.548772752f},
-std::array<float,2>{0.992266476f, 0.172339156f},
-std::array<float,2>{0.159464002f, 0.0413227342f},
-std::array<float,2>{0.543987155f, 0.6413697f},
-std::array<float,2>{0.309912682f, 0.918750942f},
-std::array<float,2>{0.789418638f, 0.327572107f},
-std::array<float,2>{0.417348593f, 0.382271945f},
-std::array<float,2>{0.934092104f, 0.775207758f},
-std::array<float,2>{0.106277376f, 0.580464661f},
-std::array<float,2>{0.686706007f, 0.249751344f},
-std::array<float,2>{0.346416146f, 0.180605829f},
-std::array<float,2>{0.846780241f, 0.560310662f},
-std::array<float,2>{0.191273987f, 0.821223855f},
-std::array<float,2>{0.581296384f, 0.465722442f},
-std::array<float,2>{0.0163869541f, 0.28060919f},
-std::array<float,2>{0.709864795f, 0.956459999f},
-std::array<float,2>{0.499302059f, 0.746585429f},
-std::array<float,2>{0.965198636f, 0.118266001f},
-std::array<float,2>{0.0868917331f, 0.20772697f},
-std::array<float,2>{0.639397323f, 0.594892204f},
-std::array<float,2>{0.40191403f, 0.788511097f},
-std::array<float,2>{0.880430877f, 0.422561377f},
-std::array<float,2>{0.281007856f, 0.352198333f},
-std::array<float,2>{0.769857287f, 0.890684605f},
-std::array<float,2>{0.132230058f, 0.680229187f},
-std::array<float,2>{0.522159398f, 0.0285386611f},
-std::array<float,2>{0.437765568f, 0.0654885173f},
-std::array<float,2>{0.984526038f, 0.716831744f},
-std::array<float,2>{0.0581145771f, 0.973260641f},
-std::array<float,2>{0.748251975f, 0.303451717f},
-std::array<float,2>{0.22165069f, 0.491467237f},
-std::array<float,2>{0.611884952f, 0.864175022f},
-std::array<float,2>{0.317124099f, 0.50008285f},
-std::array<float,2>{0.817355514f, 0.138451114f},
-std::array<float,2>{0.0373450257f, 0.0981833339f},
-std::array<float,2>{0.733391285f, 0.720400393f},
-std::array<float,2>{0.464653879f, 0.937744319f},
-std::array<float,2>{0.976760209f, 0.255458832f},
-std::array<float,2>{0.334430724f, 0.437931329f},
-std::array<float,2>{0.834239542f, 0.828604043f},
-std::array<float,2>{0.236767203f, 0.534748614f},
-std::array<float,2>{0.602040052f, 0.171021894f},
-std::array<float,2>{0.389335066f, 0.230097398f},
-std::array<float,2>{0.892226517f, 0.573773026f},
-std::array<float,2>{0.0636816397f, 0.75170356f},
-std::array<float,2>{0.655173898f, 0.405551851f},
-std::array<float,2>{0.149884939f, 0.328788787f},
-std::array<float,2>{0.500978589f, 0.935220003f},
-std::array<float,2>{0.252111882f, 0.634217262f},
-std::array<float,2>{0.75957036f, 0.0559091158f},
-std::array<float,2>{0.20543237f, 0.142844662f},
-std::array<float,2>{0.56844008f, 0.517115474f},
-std::array<float,2>{0.363325119f, 0.848526597f},
-std::array<float,2>{0.868891954f, 0.474056482f},
-std::array<float,2>{0.470707715f, 0.29524374f},
-std::array<float,2>{0.950346708f, 0.989258528f},
-std::array<float,2>{0.0121318987f, 0.689396262f},
-std::array<float,2>{0.702866316f, 0.0907416791f},
-std::array<float,2>{0.281623691f, 0.00011891521f},
-std::array<float,2>{0.804902077f, 0.657652557f},
-std::array<float,2>{0.177736714f, 0.889163911f},
-std::array<float,2>{0.561655402f, 0.370616317f},
-std::array<float,2>{0.123872742f, 0.408467859f},
-std::array<float,2>{0.668920279f, 0.797386169f},
-std::array<float,2>{0.436093032f, 0.624999702f},
-std::array<float,2>{0.910958111f, 0.192849621f},
-std::array<float,2>{0.183937773f, 0.0702007711f},
-std::array<float,2>{0.55420208f, 0.714485705f},
-std::array<float,2>{0.293120772f, 0.96966064f},
-std::array<float,2>{0.802443504f, 0.299737453f},
-std::array<float,2>{0.429221392f, 0.485706776f},
-std::array<float,2>{0.920287967f, 0.862478316f},
-std::array<float,2>{0.116595559f, 0.506400764f},
-std::array<float,2>{0.658049703f, 0.13427642f},
-std::array<float,2>{0.368015796f, 0.206814289f},
-std::array<float,2>{0.865392089f, 0.599790633f},
-std::array<float,2>{0.215224758f, 0.78463167f},
-std::array<float,2>{0.572741926f, 0.42865026f},
-std::array<float,2>{0.00172981829f, 0.358207941f},
-std::array<float,2>{0.691895187f, 0.897633493f},
-std::array<float,2>{0.479889065f, 0.687218666f},
-std::array<float,2>{0.942809284f, 0.0239073671f},
-std::array<float,2>{0.0756073296f, 0.185748696f},
-std::array<float,2>{0.645029008f, 0.555060923f},
-std::array<float,2>{0.380796343f, 0.826140761f},
-std::array<float,2>{0.899674118f, 0.461620331f},
-std::array<float,2>{0.265539914f, 0.273997486f},
-std::array<float,2>{0.75394088f, 0.960022092f},
-std::array<float,2>{0.142634466f, 0.744140208f},
-std::array<float,2>{0.513189018f, 0.121958971f},
-std::array<float,2>{0.457693607f, 0.0439220853f},
-std::array<float,2>{0.973784924f, 0.645293236f},
-std::array<float,2>{0.0454040691f, 0.917511344f},
-std::array<float,2>{0.725136757f, 0.322224557f},
-std::array<float,2>{0.244153738f, 0.376501888f},
-std::array<float,2>{0.596732616f, 0.778081f},
-std::array<float,2>{0.34350583f, 0.584770799f},
-std::array<float,2>{0.840050697f, 0.242914617f},
-std::array<float,2>{0.053932149f, 0.0045456728f},
-std::array<float,2>{0.736158371f, 0.663628757f},
-std::array<float,2>{0.44568488f, 0.886106491f},
-std::array<float,2>{0.997710705f, 0.371597826f},
-std::array<float,2>{0.320468485f, 0.411432266f},
-std::array<float,2>{0.824802041f, 0.804486752f},
-std::array<float,2>{0.232639819f, 0.617947459f},
-std::array<float,2>{0.619359374f, 0.190824687f},
-std::array<float,2>{0.395824462f, 0.147132292f},
-std::array<float,2>{0.885697186f, 0.521788955f},
-std::array<float,2>{0.0802026391f, 0.846128047f},
-std::array<float,2>{0.627162993f, 0.469634891f},
-std::array<float,2>{0.133831844f, 0.291545898f},
-std::array<float,2>{0.52485019f, 0.987294197f},
-std::array<float,2>{0.268600851f, 0.693254292f},
-std::array<float,2>{0.777125001f, 0.0877132416f},
-std::array<float,2>{0.200299233f, 0.230898514f},
-std::array<float,2>{0.593135476f, 0.575236022f},
-std::array<float,2>{0.357830256f, 0.756036878f},
-std::array<float,2>{0.857166111f, 0.400981724f},
-std::array<float,2>{0.487661421f, 0.333148569f},
-std::array<float,2>{0.958407462f, 0.933342278f},
-std::array<float,2>{0.0238224398f, 0.639198303f},
-std::array<float,2>{0.711461246f, 0.0597281791f},
-std::array<float,2>{0.302437007f, 0.0942341089f},
-std::array<float,2>{0.784795761f, 0.723198414f},
-std::array<float,2>{0.171092674f, 0.945073783f},
-std::array<float,2>{0.537039101f, 0.252837539f},
-std::array<float,2>{0.0984859914f, 0.444874197f},
-std::array<float,2>{0.675059855f, 0.832635999f},
-std::array<float,2>{0.413635731f, 0.538806736f},
-std::array<float,2>{0.924896061f, 0.165666863f},
-std::array<float,2>{0.225448802f, 0.0515631475f},
-std::array<float,2>{0.6160748f, 0.63268429f},
-std::array<float,2>{0.315996081f, 0.926558733f},
-std::array<float,2>{0.815960109f, 0.340018451f},
-std::array<float,2>{0.442973107f, 0.397624046f},
-std::array<float,2>{0.991630495f, 0.76497227f},
-std::array<float,2>{0.058688432f, 0.562730074f},
-std::array<float,2>{0.743599713f, 0.222165585f},
-std::array<float,2>{0.276963413f, 0.16186972f},
-std::array<float,2>{0.767317951f, 0.543796718f},
-std::array<float,2>{0.127663985f, 0.837821186f},
-std::array<float,2>{0.518210649f, 0.447424024f},
-std::array<float,2>{0.0924517363f, 0.261161804f},
-std::array<float,2>{0.633229911f, 0.946388245f},
-std::array<float,2>{0.405070543f, 0.730944037f},
-std::array<float,2>{0.876494944f, 0.105829328f},
-std::array<float,2>{0.0231714379f, 0.198679656f},
-std::array<float,2>{0.705777109f, 0.610473037f},
-std::array<float,2>{0.495405138f, 0.808411837f},
-std::array<float,2>{0.963310599f, 0.414223969f},
-std::array<float,2>{0.350075305f, 0.363181591f},
-std::array<float,2>{0.849521101f, 0.878261387f},
-std::array<float,2>{0.194281995f, 0.668399632f},
-std::array<float,2>{0.582742453f, 0.0107689183f},
-std::array<float,2>{0.420957386f, 0.0785708427f},
-std::array<float,2>{0.931648612f, 0.698570073f},
-std::array<float,2>{0.101750091f, 0.993472636f},
-std::array<float,2>{0.681757629f, 0.288110107f},
-std::array<float,2>{0.163619965f, 0.479420871f},
-std::array<float,2>{0.539929926f, 0.852267981f},
-std::array<float,2>{0.306235254f, 0.529343188f},
-std::array<float,2>{0.793698728f, 0.156228751f},
-std::array<float,2>{0.12060672f, 0.110588267f},
-std::array<float,2>{0.665100098f, 0.737953722f},
-std::array<float,2>{0.431503415f, 0.963427782f},
-std::array<float,2>{0.909111738f, 0.265643865f},
-std::array<float,2>{0.288381308f, 0.459256321f},
-std::array<float,2>{0.811242461f, 0.818614006f},
-std::array<float,2>{0.175680354f, 0.55154717f},
-std::array<float,2>{0.556859195f, 0.177678287f},
-std::array<float,2>{0.474084824f, 0.239375323f},
-std::array<float,2>{0.94847852f, 0.587415278f},
-std::array<float,2>{0.0114653064f, 0.765859365f},
-std::array<float,2>{0.699205518f, 0.385848671f},
-std::array<float,2>{0.207957849f, 0.3159208f},
-std::array<float,2>{0.562883735f, 0.910174727f},
-std::array<float,2>{0.361295819f, 0.654585898f},
-std::array<float,2>{0.874976873f, 0.031261418f},
-std::array<float,2>{0.154648811f, 0.1292689f},
-std::array<float,2>{0.504396498f, 0.514615119f},
-std::array<float,2>{0.255873203f, 0.870142698f},
-std::array<float,2>{0.762017787f, 0.495105386f},
-std::array<float,2>{0.383148164f, 0.305837512f},
-std::array<float,2>{0.897648871f, 0.980076373f},
-std::array<float,2>{0.0693551525f, 0.708049953f},
-std::array<float,2>{0.650266051f, 0.0764374807f},
-std::array<float,2>{0.330364734f, 0.0173056591f},
-std::array<float,2>{0.831344366f, 0.67916131f},
-std::array<float,2>{0.241469771f, 0.901538849f},
-std::array<float,2>{0.608470142f, 0.346145153f},
-std::array<float,2>{0.0342337675f, 0.430294961f},
-std::array<float,2>{0.726775289f, 0.794860482f},
-std::array<float,2>{0.467434317f, 0.60363543f},
-std::array<float,2>{0.981737614f, 0.214811683f},
-std::array<float,2>{0.211947858f, 0.105331048f},
-std::array<float,2>{0.575578332f, 0.730406702f},
-std::array<float,2>{0.372467041f, 0.950881362f},
-std::array<float,2>{0.860980749f, 0.264584094f},
-std::array<float,2>{0.483951151f, 0.449560195f},
-std::array<float,2>{0.940327585f, 0.842192292f},
-std::array<float,2>{0.00574233662f, 0.54112947f},
-std::array<float,2>{0.688848257f, 0.159921557f},
-std::array<float,2>{0.292593509f, 0.224087939f},
-std::array<float,2>{0.799689651f, 0.56925267f},
-std::array<float,2>{0.183098853f, 0.761595011f},
-std::array<float,2>{0.54843086f, 0.393257201f},
-std::array<float,2>{0.109465778f, 0.339452416f},
-std::array<float,2>{0.661312878f, 0.923918009f},
-std::array<float,2>{0.422665745f, 0.628756046f},
-std::array<float,2>{0.915201724f, 0.0483750068f},
-std::array<float,2>{0.0417959131f, 0.151117474f},
-std::array<float,2>{0.722566664f, 0.525770128f},
-std::array<float,2>{0.454321206f, 0.858596623f},
-std::array<float,2>{0.97050786f, 0.48295033f},
-std::array<float,2>{0.338043183f, 0.281294525f},
-std::array<float,2>{0.836081028f, 0.996592641f},
-std::array<float,2>{0.246119916f, 0.701989651f},
-std::array<float,2>{0.597864807f, 0.0838862434f},
-std::array<float,2>{0.376733214f, 0.0133042373f},
-std::array<float,2>{0.905727744f, 0.666059673f},
-std::array<float,2>{0.0717797056f, 0.882627547f},
-std::array<float,2>{0.64267087f, 0.365013123f},
-std::array<float,2>{0.147654295f, 0.420825928f},
-std::array<float,2>{0.508280396f, 0.808762252f},
-std::array<float,2>{0.261469871f, 0.617078304f},
-std::array<float,2>{0.753139019f, 0.200714231f},
-std::array<float,2>{0.0822413117f, 0.0383192226f},
-std::array<float,2>{0.629407287f, 0.651258349f},
-std::array<float,2>{0.394244999f, 0.90735358f},
-std::array<float,2>{0.887782693f, 0.319433123f},
-std::array<float,2>{0.270772368f, 0.387595415f},
-std::array<float,2>{0.778325558f, 0.770110607f},
-std::array<float,2>{0.139246434f, 0.592815518f},
-std::array<float,2>{0.530348003f, 0.234873638f},
-std::array<float,2>{0.450286508f, 0.173912108f},
-std::array<float,2>{0.996005118f, 0.550370812f},
-std::array<float,2>{0.04742622f, 0.816085696f},
-std::array<float,2>{0.74176085f, 0.453608066f},
-std::array<float,2>{0.227569848f, 0.271308988f},
-std::array<float,2>{0.622887611f, 0.967154682f},
-std::array<float,2>{0.325827301f, 0.739290476f},
-std::array<float,2>{0.822793365f, 0.113950208f},
-std::array<float,2>{0.166301519f, 0.215554491f},
-std::array<float,2>{0.531915963f, 0.606046975f},
-std::array<float,2>{0.298220485f, 0.789070427f},
-std::array<float,2>{0.786044478f, 0.436266482f},
-std::array<float,2>{0.408719242f, 0.349531204f},
-std::array<float,2>{0.927790403f, 0.905091822f},
-std::array<float,2>{0.0947758257f, 0.672691762f},
-std::array<float,2>{0.676063657f, 0.0226415191f},
-std::array<float,2>{0.353513628f, 0.0727581605f},
-std::array<float,2>{0.854275405f, 0.705549657f},
-std::array<float,2>{0.19837071f, 0.980976939f},
-std::array<float,2>{0.589598894f, 0.308841825f},
-std::array<float,2>{0.0299282148f, 0.498448461f},
-std::array<float,2>{0.714846551f, 0.872688711f},
-std::array<float,2>{0.491094947f, 0.50928998f},
-std::array<float,2>{0.954571128f, 0.128489673f},
-std::array<float,2>{0.130124584f, 0.0294709764f},
-std::array<float,2>{0.520965338f, 0.681896925f},
-std::array<float,2>{0.279182643f, 0.89281261f},
-std::array<float,2>{0.772061288f, 0.353663534f},
-std::array<float,2>{0.399713218f, 0.424099714f},
-std::array<float,2>{0.881657302f, 0.786076486f},
-std::array<float,2>{0.088186048f, 0.595717013f},
-std::array<float,2>{0.637248397f, 0.210389361f},
-std::array<float,2>{0.319477379f, 0.140094683f},
-std::array<float,2>{0.818427324f, 0.502973676f},
-std::array<float,2>{0.21897468f, 0.866982937f},
-std::array<float,2>{0.61116302f, 0.489138395f},
-std::array<float,2>{0.056055598f, 0.301046312f},
-std::array<float,2>{0.7477597f, 0.975141287f},
-std::array<float,2>{0.440555245f, 0.715138495f},
-std::array<float,2>{0.987450421f, 0.0644272864f},
-std::array<float,2>{0.108484052f, 0.247992277f},
-std::array<float,2>{0.683925569f, 0.578502059f},
-std::array<float,2>{0.414714098f, 0.776494801f},
-std::array<float,2>{0.936869204f, 0.379401743f},
-std::array<float,2>{0.311832041f, 0.324617118f},
-std::array<float,2>{0.79216814f, 0.921457946f},
-std::array<float,2>{0.158176735f, 0.644265771f},
-std::array<float,2>{0.546606004f, 0.039124947f},
-std::array<float,2>{0.497068077f, 0.119949639f},
-std::array<float,2>{0.968001187f, 0.749897361f},
-std::array<float,2>{0.0177074075f, 0.954501271f},
-std::array<float,2>{0.707794547f, 0.278775215f},
-std::array<float,2>{0.189038053f, 0.467455238f},
-std::array<float,2>{0.578584015f, 0.822966456f},
-std::array<float,2>{0.344772279f, 0.560563803f},
-std::array<float,2>{0.845660269f, 0.182695612f},
-std::array<float,2>{0.014593224f, 0.0936098248f},
-std::array<float,2>{0.701004624f, 0.691287875f},
-std::array<float,2>{0.46905756f, 0.991075456f},
-std::array<float,2>{0.953081429f, 0.294394791f},
-std::array<float,2>{0.366272092f, 0.47610867f},
-std::array<float,2>{0.869831443f, 0.851287246f},
-std::array<float,2>{0.203160927f, 0.518127918f},
-std::array<float,2>{0.566407859f, 0.141575098f},
-std::array<float,2>{0.434831321f, 0.194255769f},
-std::array<float,2>{0.912443161f, 0.621512473f},
-std::array<float,2>{0.122100845f, 0.800073683f},
-std::array<float,2>{0.670278609f, 0.406449735f},
-std::array<float,2>{0.175889239f, 0.368474782f},
-std::array<float,2>{0.560084641f, 0.887183607f},
-std::array<float,2>{0.284721822f, 0.659356892f},
-std::array<float,2>{0.808553457f, 0.00276543386f},
-std::array<float,2>{0.235040024f, 0.169053018f},
-std::array<float,2>{0.605282545f, 0.532266736f},
-std::array<float,2>{0.333429426f, 0.831376553f},
-std::array<float,2>{0.833044648f, 0.440656573f},
-std::array<float,2>{0.461784214f, 0.256165415f},
-std::array<float,2>{0.980066597f, 0.94040513f},
-std::array<float,2>{0.0353626497f, 0.721751034f},
-std::array<float,2>{0.731620908f, 0.0996126086f},
-std::array<float,2>{0.251725912f, 0.0576201379f},
-std::array<float,2>{0.761140764f, 0.636432171f},
-std::array<float,2>{0.151919812f, 0.935626805f},
-std::array<float,2>{0.502862036f, 0.330079138f},
-std::array<float,2>{0.0659096763f, 0.404098213f},
-std::array<float,2>{0.653432488f, 0.753400445f},
-std::array<float,2>{0.387162566f, 0.57034266f},
-std::array<float,2>{0.893231452f, 0.227612853f},
-std::array<float,2>{0.17048645f, 0.0959736779f},
-std::array<float,2>{0.53596884f, 0.72494185f},
-std::array<float,2>{0.301600784f, 0.94142592f},
-std::array<float,2>{0.783868909f, 0.250650942f},
-std::array<float,2>{0.412482232f, 0.44311735f},
-std::array<float,2>{0.924304307f, 0.835910201f},
-std::array<float,2>{0.0988087431f, 0.535725594f},
-std::array<float,2>{0.674638093f, 0.167588428f},
-std::array<float,2>{0.359235615f, 0.234275177f},
-std::array<float,2>{0.855770469f, 0.5778355f},
-std::array<float,2>{0.200145185f, 0.754301727f},
-std::array<float,2>{0.592432261f, 0.399048269f},
-std::array<float,2>{0.0248496793f, 0.334249526f},
-std::array<float,2>{0.711950719f, 0.931203067f},
-std::array<float,2>{0.486523598f, 0.636933208f},
-std::array<float,2>{0.957265377f, 0.0610689893f},
-std::array<float,2>{0.0819448158f, 0.145644367f},
-std::array<float,2>{0.628108263f, 0.52071023f},
-std::array<float,2>{0.395300239f, 0.844072938f},
-std::array<float,2>{0.886263311f, 0.471998692f},
-std::array<float,2>{0.268524259f, 0.290909976f},
-std::array<float,2>{0.775621772f, 0.985003531f},
-std::array<float,2>{0.133535087f, 0.693392873f},
-std::array<float,2>{0.524283648f, 0.0892557427f},
-std::array<float,2>{0.446818799f, 0.00657793554f},
-std::array<float,2>{0.997070134f, 0.661207616f},
-std::array<float,2>{0.0533163957f, 0.884340048f},
-std::array<float,2>{0.734580278f, 0.374939352f},
-std::array<float,2>{0.233871251f, 0.413372368f},
-std::array<float,2>{0.620627165f, 0.801262498f},
-std::array<float,2>{0.322259754f, 0.619369924f},
-std::array<float,2>{0.825385571f, 0.189269349f},
-std::array<float,2>{0.0468287505f, 0.0468586721f},
-std::array<float,2>{0.726195872f, 0.647274196f},
-std::array<float,2>{0.45869109f, 0.914127111f},
-std::array<float,2>{0.972684622f, 0.322417945f},
-std::array<float,2>{0.341815203f, 0.377725989f},
-std::array<float,2>{0.840936601f, 0.780642927f},
-std::array<float,2>{0.24543269f, 0.582237899f},
-std::array<float,2>{0.596104681f, 0.244141221f},
-std::array<float,2>{0.379054129f, 0.185333148f},
-std::array<float,2>{0.898658514f, 0.557063818f},
-std::array<float,2>{0.075152874f, 0.827271998f},
-std::array<float,2>{0.645559549f, 0.464779139f},
-std::array<float,2>{0.14426817f, 0.275996149f},
-std::array<float,2>{0.512515843f, 0.958814263f},
-std::array<float,2>{0.26393947f, 0.745010614f},
-std::array<float,2>{0.755161524f, 0.123716906f},
-std::array<float,2>{0.216229856f, 0.203986436f},
-std::array<float,2>{0.574159682f, 0.599236429f},
-std::array<float,2>{0.368858337f, 0.782450557f},
-std::array<float,2>{0.866995513f, 0.425819695f},
-std::array<float,2>{0.478974879f, 0.355650544f},
-std::array<float,2>{0.94184643f, 0.895814419f},
-std::array<float,2>{0.000238006964f, 0.684968948f},
-std::array<float,2>{0.692548156f, 0.0262297541f},
-std::array<float,2>{0.294208735f, 0.0683395863f},
-std::array<float,2>{0.801159263f, 0.711431742f},
-std::array<float,2>{0.184933648f, 0.971658528f},
-std::array<float,2>{0.553015947f, 0.297689885f},
-std::array<float,2>{0.115388118f, 0.487273484f},
-std::array<float,2>{0.656319737f, 0.861122727f},
-std::array<float,2>{0.428367108f, 0.504055738f},
-std::array<float,2>{0.92186892f, 0.134821624f},
-std::array<float,2>{0.240327194f, 0.019204367f},
-std::array<float,2>{0.608004272f, 0.67708832f},
-std::array<float,2>{0.331192046f, 0.899595559f},
-std::array<float,2>{0.830441892f, 0.345528036f},
-std::array<float,2>{0.468225867f, 0.432712674f},
-std::array<float,2>{0.98109448f, 0.796289265f},
-std::array<float,2>{0.0339515395f, 0.6026088f},
-std::array<float,2>{0.728049636f, 0.211545944f},
-std::array<float,2>{0.257726192f, 0.13134627f},
-std::array<float,2>{0.763062119f, 0.513427675f},
-std::array<float,2>{0.156011075f, 0.868201554f},
-std::array<float,2>{0.504953742f, 0.492373705f},
-std::array<float,2>{0.0683750287f, 0.306909472f},
-std::array<float,2>{0.649369419f, 0.977860808f},
-std::array<float,2>{0.384564728f, 0.710442245f},
-std::array<float,2>{0.897188246f, 0.0758334845f},
-std::array<float,2>{0.0101106958f, 0.240875393f},
-std::array<float,2>{0.697560012f, 0.588998199f},
-std::array<float,2>{0.472913593f, 0.769127965f},
-std::array<float,2>{0.947631061f, 0.382840097f},
-std::array<float,2>{0.359739035f, 0.312523961f},
-std::array<float,2>{0.873973846f, 0.913582444f},
-std::array<float,2>{0.20804359f, 0.653104961f},
-std::array<float,2>{0.564389706f, 0.0334617458f},
-std::array<float,2>{0.430047512f, 0.113149211f},
-std::array<float,2>{0.909813702f, 0.736313999f},
-std::array<float,2>{0.119207926f, 0.961150348f},
-std::array<float,2>{0.664625585f, 0.267822176f},
-std::array<float,2>{0.174498513f, 0.45770058f},
-std::array<float,2>{0.558080077f, 0.817152321f},
-std::array<float,2>{0.287916809f, 0.554538786f},
-std::array<float,2>{0.812196016f, 0.177984342f},
-std::array<float,2>{0.103021771f, 0.0818452984f},
-std::array<float,2>{0.682878435f, 0.696584523f},
-std::array<float,2>{0.420462638f, 0.995399356f},
-std::array<float,2>{0.932675719f, 0.286824912f},
-std::array<float,2>{0.305480093f, 0.47685343f},
-std::array<float,2>{0.794708312f, 0.855320454f},
-std::array<float,2>{0.162563011f, 0.528195322f},
-std::array<float,2>{0.540503085f, 0.152583152f},
-std::array<float,2>{0.494619101f, 0.195339516f},
-std::array<float,2>{0.964276373f, 0.611998141f},
-std::array<float,2>{0.0216058083f, 0.806476235f},
-std::array<float,2>{0.706207395f, 0.417708933f},
-std::array<float,2>{0.195244759f, 0.360539407f},
-std::array<float,2>{0.583268404f, 0.876501739f},
-std::array<float,2>{0.350806981f, 0.671380877f},
-std::array<float,2>{0.848123789f, 0.00948965456f},
-std::array<float,2>{0.128462419f, 0.162917867f},
-std::array<float,2>{0.51892066f, 0.54506439f},
-std::array<float,2>{0.275535077f, 0.838428855f},
-std::array<float,2>{0.766171396f, 0.446087033f},
-std::array<float,2>{0.405951768f, 0.258235157f},
-std::array<float,2>{0.875264883f, 0.948398054f},
-std::array<float,2>{0.0930536315f, 0.732487321f},
-std::array<float,2>{0.634649932f, 0.109247573f},
-std::array<float,2>{0.314833403f, 0.0529027805f},
-std::array<float,2>{0.814911962f, 0.629083633f},
-std::array<float,2>{0.225917563f, 0.929080606f},
-std::array<float,2>{0.61647594f, 0.342035234f},
-std::array<float,2>{0.0604151264f, 0.394769102f},
-std::array<float,2>{0.743132591f, 0.762137949f},
-std::array<float,2>{0.442059398f, 0.56597656f},
-std::array<float,2>{0.990446568f, 0.220430687f},
-std::array<float,2>{0.198066697f, 0.0704861134f},
-std::array<float,2>{0.58853811f, 0.703467786f},
-std::array<float,2>{0.352418274f, 0.982682884f},
-std::array<float,2>{0.855319023f, 0.312288404f},
-std::array<float,2>{0.4913432f, 0.497436345f},
-std::array<float,2>{0.953167558f, 0.873100877f},
-std::array<float,2>{0.0306027271f, 0.511050105f},
-std::array<float,2>{0.716724277f, 0.126397043f},
-std::array<float,2>{0.297368288f, 0.218204588f},
-std::array<float,2>{0.786602259f, 0.609208703f},
-std::array<float,2>{0.16731672f, 0.792823792f},
-std::array<float,2>{0.533179283f, 0.43363753f},
-std::array<float,2>{0.0939485058f, 0.350215822f},
-std::array<float,2>{0.676993728f, 0.90318352f},
-std::array<float,2>{0.409302592f, 0.673904598f},
-std::array<float,2>{0.929442286f, 0.0202415977f},
-std::array<float,2>{0.0479814373f, 0.173467353f},
-std::array<float,2>{0.740406513f, 0.547789097f},
-std::array<float,2>{0.449923843f, 0.813270569f},
-std::array<float,2>{0.994494498f, 0.455759704f},
-std::array<float,2>{0.324424863f, 0.272408575f},
-std::array<float,2>{0.823487461f, 0.965205193f},
-std::array<float,2>{0.227304384f, 0.741125941f},
-std::array<float,2>{0.621904254f, 0.116471924f},
-std::array<float,2>{0.392950296f, 0.0360644683f},
-std::array<float,2>{0.887424886f, 0.648599565f},
-std::array<float,2>{0.0832961947f, 0.909231663f},
-std::array<float,2>{0.630153358f, 0.316962004f},
-std::array<float,2>{0.140172511f, 0.389993668f},
-std::array<float,2>{0.529676437f, 0.771684587f},
-std::array<float,2>{0.269972771f, 0.591322839f},
-std::array<float,2>{0.77784133f, 0.237003818f},
-std::array<float,2>{0.0711990893f, 0.013746839f},
-std::array<float,2>{0.643654227f, 0.664715707f},
-std::array<float,2>{0.375602126f, 0.880337834f},
-std::array<float,2>{0.90500319f, 0.365989447f},
-std::array<float,2>{0.260546684f, 0.418057531f},
-std::array<float,2>{0.752385676f, 0.810851634f},
-std::array<float,2>{0.147150144f, 0.614011168f},
-std::array<float,2>{0.508933246f, 0.201472014f},
-std::array<float,2>{0.453248173f, 0.148993865f},
-std::array<float,2>{0.969506085f, 0.523844063f},
-std::array<float,2>{0.0424195714f, 0.857233346f},
-std::array<float,2>{0.720948517f, 0.48056531f},
-std::array<float,2>{0.247626394f, 0.284429938f},
-std::array<float,2>{0.599061847f, 0.998316407f},
-std::array<float,2>{0.339669943f, 0.700713754f},
-std::array<float,2>{0.837535501f, 0.0850289539f},
-std::array<float,2>{0.182212934f, 0.225869045f},
-std::array<float,2>{0.547152698f, 0.56817621f},
-std::array<float,2>{0.291736066f, 0.758875549f},
-std::array<float,2>{0.800329387f, 0.391118795f},
-std::array<float,2>{0.423018992f, 0.337526679f},
-std::array<float,2>{0.914799631f, 0.923090219f},
-std::array<float,2>{0.110433057f, 0.626810491f},
-std::array<float,2>{0.660528243f, 0.0498566888f},
-std::array<float,2>{0.371872932f, 0.102533326f},
-std::array<float,2>{0.860250592f, 0.727435231f},
-std::array<float,2>{0.211374462f, 0.952245355f},
-std::array<float,2>{0.574654698f, 0.263348252f},
-std::array<float,2>{0.00441057095f, 0.452470124f},
-std::array<float,2>{0.688375533f, 0.84088105f},
-std::array<float,2>{0.483288109f, 0.539709926f},
-std::array<float,2>{0.940533102f, 0.157064855f},
-std::array<float,2>{0.150491431f, 0.0552751683f},
-std::array<float,2>{0.503240943f, 0.633080661f},
-std::array<float,2>{0.250659794f, 0.933694184f},
-std::array<float,2>{0.760448933f, 0.329234123f},
-std::array<float,2>{0.387836546f, 0.404318988f},
-std::array<float,2>{0.893997908f, 0.750433028f},
-std::array<float,2>{0.0651623309f, 0.572641253f},
-std::array<float,2>{0.65259999f, 0.228803247f},
-std::array<float,2>{0.332563937f, 0.170198858f},
-std::array<float,2>{0.832118273f, 0.533966005f},
-std::array<float,2>{0.235777661f, 0.829620063f},
-std::array<float,2>{0.604144931f, 0.439064771f},
-std::array<float,2>{0.0363191143f, 0.254195064f},
-std::array<float,2>{0.730912447f, 0.938664079f},
-std::array<float,2>{0.462814897f, 0.718970895f},
-std::array<float,2>{0.978632689f, 0.099445276f},
-std::array<float,2>{0.121719077f, 0.192110941f},
-std::array<float,2>{0.671587884f, 0.623808146f},
-std::array<float,2>{0.433598012f, 0.798224807f},
-std::array<float,2>{0.91385144f, 0.409362972f},
-std::array<float,2>{0.283404708f, 0.36972478f},
-std::array<float,2>{0.807175338f, 0.890203774f},
-std::array<float,2>{0.17722632f, 0.656352282f},
-std::array<float,2>{0.559496224f, 0.00132797426f},
-std::array<float,2>{0.470469445f, 0.0912678093f},
-std::array<float,2>{0.951655567f, 0.687917531f},
-std::array<float,2>{0.0153442472f, 0.989206672f},
-std::array<float,2>{0.699503779f, 0.295943767f},
-std::array<float,2>{0.204332307f, 0.473088086f},
-std::array<float,2>{0.568227112f, 0.849241138f},
-std::array<float,2>{0.365448415f, 0.516288161f},
-std::array<float,2>{0.871013343f, 0.144365802f},
-std::array<float,2>{0.0188390259f, 0.117591523f},
-std::array<float,2>{0.708165348f, 0.747960985f},
-std::array<float,2>{0.497227639f, 0.955818415f},
-std::array<float,2>{0.966936946f, 0.279648274f},
-std::array<float,2>{0.344107062f, 0.46639201f},
-std::array<float,2>{0.844245255f, 0.821312606f},
-std::array<float,2>{0.187743589f, 0.559133768f},
-std::array<float,2>{0.579714298f, 0.180738389f},
-std::array<float,2>{0.415937155f, 0.24893482f},
-std::array<float,2>{0.93610245f, 0.581946313f},
-std::array<float,2>{0.107815824f, 0.773656666f},
-std::array<float,2>{0.685113788f, 0.381780446f},
-std::array<float,2>{0.156800956f, 0.326181918f},
-std::array<float,2>{0.545325398f, 0.919187903f},
-std::array<float,2>{0.311193705f, 0.641643465f},
-std::array<float,2>{0.7912274f, 0.0426632091f},
-std::array<float,2>{0.220287472f, 0.137272477f},
-std::array<float,2>{0.609810352f, 0.501940131f},
-std::array<float,2>{0.319197685f, 0.865054607f},
-std::array<float,2>{0.819787681f, 0.491027921f},
-std::array<float,2>{0.439827472f, 0.304629236f},
-std::array<float,2>{0.987029612f, 0.974339545f},
-std::array<float,2>{0.0551208034f, 0.718545139f},
-std::array<float,2>{0.746370435f, 0.06493029f},
-std::array<float,2>{0.278230876f, 0.0275813807f},
-std::array<float,2>{0.772670329f, 0.680769742f},
-std::array<float,2>{0.12926887f, 0.8922171f},
-std::array<float,2>{0.520123363f, 0.352752268f},
-std::array<float,2>{0.088876836f, 0.423025817f},
-std::array<float,2>{0.6385355f, 0.787118733f},
-std::array<float,2>{0.398546189f, 0.59380722f},
-std::array<float,2>{0.882182717f, 0.208556324f},
-std::array<float,2>{0.135877684f, 0.0869006962f},
-std::array<float,2>{0.526874125f, 0.691686094f},
-std::array<float,2>{0.266952783f, 0.988040626f},
-std::array<float,2>{0.774770677f, 0.292791963f},
-std::array<float,2>{0.397094846f, 0.469816417f},
-std::array<float,2>{0.88446933f, 0.846869886f},
-std::array<float,2>{0.0800528675f, 0.522877574f},
-std::array<float,2>{0.62603724f, 0.147713915f},
-std::array<float,2>{0.322665632f, 0.189465269f},
-std::array<float,2>{0.826894462f, 0.618321002f},
-std::array<float,2>{0.231596097f, 0.803108573f},
-std::array<float,2>{0.618183672f, 0.410918623f},
-std::array<float,2>{0.0522793122f, 0.372380555f},
-std::array<float,2>{0.738135576f, 0.885532856f},
-std::array<float,2>{0.447359771f, 0.66303122f},
-std::array<float,2>{0.998873353f, 0.00537303789f},
-std::array<float,2>{0.100580044f, 0.164722979f},
-std::array<float,2>{0.67213124f, 0.537309527f},
-std::array<float,2>{0.411321253f, 0.833109558f},
-std::array<float,2>{0.923466623f, 0.444266319f},
-std::array<float,2>{0.303060174f, 0.253317326f},
-std::array<float,2>{0.782187402f, 0.944180906f},
-std::array<float,2>{0.168528169f, 0.72453928f},
-std::array<float,2>{0.537594259f, 0.095141761f},
-std::array<float,2>{0.485526949f, 0.0588241555f},
-std::array<float,2>{0.959036827f, 0.640335083f},
-std::array<float,2>{0.0255205259f, 0.932393909f},
-std::array<float,2>{0.713449895f, 0.332304865f},
-std::array<float,2>{0.201583654f, 0.401368916f},
-std::array<float,2>{0.590915024f, 0.757203519f},
-std::array<float,2>{0.356131285f, 0.574682057f},
-std::array<float,2>{0.857970059f, 0.231674343f},
-std::array<float,2>{0.00385464914f, 0.0250702854f},
-std::array<float,2>{0.693966746f, 0.686421335f},
-std::array<float,2>{0.477740049f, 0.89659971f},
-std::array<float,2>{0.944701552f, 0.358842313f},
-std::array<float,2>{0.370821804f, 0.429051906f},
-std::array<float,2>{0.864233673f, 0.783594906f},
-std::array<float,2>{0.218125299f, 0.601226151f},
-std::array<float,2>{0.570536494f, 0.206049219f},
-std::array<float,2>{0.426208794f, 0.133238405f},
-std::array<float,2>{0.918143809f, 0.507530451f},
-std::array<float,2>{0.114060655f, 0.861638129f},
-std::array<float,2>{0.659676611f, 0.484378219f},
-std::array<float,2>{0.185905397f, 0.300583482f},
-std::array<float,2>{0.551122963f, 0.970429599f},
-std::array<float,2>{0.295141488f, 0.713133574f},
-std::array<float,2>{0.803584695f, 0.0692343488f},
-std::array<float,2>{0.244060561f, 0.244053319f},
-std::array<float,2>{0.593934894f, 0.585502028f},
-std::array<float,2>{0.340967566f, 0.77873981f},
-std::array<float,2>{0.842010856f, 0.37590009f},
-std::array<float,2>{0.460190356f, 0.320919722f},
-std::array<float,2>{0.976481438f, 0.916859388f},
-std::array<float,2>{0.0446292982f, 0.645820796f},
-std::array<float,2>{0.724590898f, 0.0441650935f},
-std::array<float,2>{0.261797696f, 0.122991771f},
-std::array<float,2>{0.756752431f, 0.742753565f},
-std::array<float,2>{0.140909865f, 0.959480166f},
-std::array<float,2>{0.514731944f, 0.275178403f},
-std::array<float,2>{0.076697059f, 0.461991668f},
-std::array<float,2>{0.647673368f, 0.824425817f},
-std::array<float,2>{0.381182551f, 0.556336403f},
-std::array<float,2>{0.900648952f, 0.187283576f},
-std::array<float,2>{0.210915163f, 0.0327985212f},
-std::array<float,2>{0.564522922f, 0.656091571f},
-std::array<float,2>{0.361423969f, 0.911279798f},
-std::array<float,2>{0.871888041f, 0.314873159f},
-std::array<float,2>{0.476384491f, 0.385241598f},
-std::array<float,2>{0.946330726f, 0.767537653f},
-std::array<float,2>{0.00800749939f, 0.586685777f},
-std::array<float,2>{0.695875466f, 0.238327041f},
-std::array<float,2>{0.285912365f, 0.17663011f},
-std::array<float,2>{0.810070872f, 0.552177191f},
-std::array<float,2>{0.172139302f, 0.819346666f},
-std::array<float,2>{0.555546939f, 0.460262001f},
-std::array<float,2>{0.117763937f, 0.267411888f},
-std::array<float,2>{0.666217506f, 0.964198768f},
-std::array<float,2>{0.43185696f, 0.737221181f},
-std::array<float,2>{0.906744421f, 0.110217765f},
-std::array<float,2>{0.0314438567f, 0.213396043f},
-std::array<float,2>{0.730015695f, 0.605070889f},
-std::array<float,2>{0.465164721f, 0.793167949f},
-std::array<float,2>{0.983704388f, 0.43097508f},
-std::array<float,2>{0.329393804f, 0.346842825f},
-std::array<float,2>{0.829068482f, 0.901067257f},
-std::array<float,2>{0.2399652f, 0.678460658f},
-std::array<float,2>{0.607089698f, 0.0162560437f},
-std::array<float,2>{0.385374099f, 0.0774206817f},
-std::array<float,2>{0.895668387f, 0.707964301f},
-std::array<float,2>{0.0669415668f, 0.979297221f},
-std::array<float,2>{0.65186286f, 0.305070013f},
-std::array<float,2>{0.153018013f, 0.495993465f},
-std::array<float,2>{0.507512271f, 0.869353414f},
-std::array<float,2>{0.254900128f, 0.514896333f},
-std::array<float,2>{0.763898849f, 0.130281433f},
-std::array<float,2>{0.0911786631f, 0.106890604f},
-std::array<float,2>{0.635618448f, 0.73160845f},
-std::array<float,2>{0.403324693f, 0.94607389f},
-std::array<float,2>{0.877730012f, 0.260261804f},
-std::array<float,2>{0.274085194f, 0.448526174f},
-std::array<float,2>{0.768648803f, 0.836491764f},
-std::array<float,2>{0.126417398f, 0.544103205f},
-std::array<float,2>{0.516281247f, 0.161082461f},
-std::array<float,2>{0.443711728f, 0.220715553f},
-std::array<float,2>{0.98902446f, 0.563625038f},
-std::array<float,2>{0.061969094f, 0.763841093f},
-std::array<float,2>{0.744671464f, 0.396488249f},
-std::array<float,2>{0.223821342f, 0.341514885f},
-std::array<float,2>{0.614202678f, 0.926883817f},
-std::array<float,2>{0.314035267f, 0.631313503f},
-std::array<float,2>{0.813223302f, 0.0527039357f},
-std::array<float,2>{0.160978124f, 0.15466094f},
-std::array<float,2>{0.542430997f, 0.530780613f},
-std::array<float,2>{0.308038533f, 0.853465676f},
-std::array<float,2>{0.795743942f, 0.48029238f},
-std::array<float,2>{0.418845505f, 0.287516296f},
-std::array<float,2>{0.930728614f, 0.992851377f},
-std::array<float,2>{0.103760049f, 0.697701931f},
-std::array<float,2>{0.680563509f, 0.0796636865f},
-std::array<float,2>{0.349035352f, 0.010487562f},
-std::array<float,2>{0.850431323f, 0.669096172f},
-std::array<float,2>{0.192538783f, 0.877497852f},
-std::array<float,2>{0.585839689f, 0.361721098f},
-std::array<float,2>{0.0196130164f, 0.415203691f},
-std::array<float,2>{0.703941464f, 0.806998432f},
-std::array<float,2>{0.492356032f, 0.609444678f},
-std::array<float,2>{0.962533414f, 0.1973712f},
-std::array<float,2>{0.228807002f, 0.114658043f},
-std::array<float,2>{0.624701619f, 0.738725305f},
-std::array<float,2>{0.327224165f, 0.967817307f},
-std::array<float,2>{0.820411503f, 0.270266324f},
-std::array<float,2>{0.453046441f, 0.454531997f},
-std::array<float,2>{0.993581533f, 0.814705312f},
-std::array<float,2>{0.0506273918f, 0.548876762f},
-std::array<float,2>{0.740086675f, 0.175437093f},
-std::array<float,2>{0.271898299f, 0.235825211f},
-std::array<float,2>{0.779649377f, 0.592500925f},
-std::array<float,2>{0.138290912f, 0.771402895f},
-std::array<float,2>{0.528232813f, 0.388323367f},
-std::array<float,2>{0.0849209353f, 0.318547547f},
-std::array<float,2>{0.63214159f, 0.906802118f},
-std::array<float,2>{0.392113507f, 0.651524484f},
-std::array<float,2>{0.88902998f, 0.0373686329f},
-std::array<float,2>{0.0287038907f, 0.127124086f},
-std::array<float,2>{0.718275368f, 0.508169353f},
-std::array<float,2>{0.489453018f, 0.871977329f},
-std::array<float,2>{0.955196738f, 0.499582261f},
-std::array<float,2>{0.354827166f, 0.31044355f},
-std::array<float,2>{0.852512419f, 0.982233942f},
-std::array<float,2>{0.196344718f, 0.706854343f},
-std::array<float,2>{0.587716639f, 0.0737264156f},
-std::array<float,2>{0.406598777f, 0.0221204944f},
-std::array<float,2>{0.927218795f, 0.672910988f},
-std::array<float,2>{0.0967361555f, 0.906206846f},
-std::array<float,2>{0.677789688f, 0.348022968f},
-std::array<float,2>{0.165948808f, 0.437019795f},
-std::array<float,2>{0.533467531f, 0.790461779f},
-std::array<float,2>{0.299575388f, 0.606672347f},
-std::array<float,2>{0.787548661f, 0.216417268f},
-std::array<float,2>{0.112941884f, 0.0473428294f},
-std::array<float,2>{0.663143337f, 0.627684295f},
-std::array<float,2>{0.425377756f, 0.92493993f},
-std::array<float,2>{0.91724056f, 0.338010252f},
-std::array<float,2>{0.290794402f, 0.393562585f},
-std::array<float,2>{0.797849715f, 0.760490716f},
-std::array<float,2>{0.179806903f, 0.570127726f},
-std::array<float,2>{0.550120533f, 0.222692311f},
-std::array<float,2>{0.480634272f, 0.1583592f},
-std::array<float,2>{0.938476205f, 0.542566061f},
-std::array<float,2>{0.00774150295f, 0.843138397f},
-std::array<float,2>{0.691397369f, 0.450647742f},
-std::array<float,2>{0.213101447f, 0.264751107f},
-std::array<float,2>{0.57768327f, 0.95008266f},
-std::array<float,2>{0.374236763f, 0.728889227f},
-std::array<float,2>{0.86289078f, 0.103984483f},
-std::array<float,2>{0.146459028f, 0.19984749f},
-std::array<float,2>{0.509774804f, 0.61567086f},
-std::array<float,2>{0.258926123f, 0.809869528f},
-std::array<float,2>{0.750169992f, 0.421188354f},
-std::array<float,2>{0.377482355f, 0.363776147f},
-std::array<float,2>{0.903285444f, 0.881807327f},
-std::array<float,2>{0.072801277f, 0.667633116f},
-std::array<float,2>{0.641828001f, 0.0126161575f},
-std::array<float,2>{0.336229086f, 0.0824301094f},
-std::array<float,2>{0.838310182f, 0.702822626f},
-std::array<float,2>{0.249744877f, 0.997136116f},
-std::array<float,2>{0.601445317f, 0.282664627f},
-std::array<float,2>{0.0396007113f, 0.483892053f},
-std::array<float,2>{0.720126271f, 0.857716262f},
-std::array<float,2>{0.455264181f, 0.526418567f},
-std::array<float,2>{0.971241415f, 0.152134746f},
-std::array<float,2>{0.179539099f, 0.00332308793f},
-std::array<float,2>{0.560890853f, 0.658611f},
-std::array<float,2>{0.282787591f, 0.888078392f},
-std::array<float,2>{0.805887461f, 0.367659569f},
-std::array<float,2>{0.43678683f, 0.407649785f},
-std::array<float,2>{0.91140157f, 0.799291492f},
-std::array<float,2>{0.124415882f, 0.622986376f},
-std::array<float,2>{0.66942817f, 0.195260376f},
-std::array<float,2>{0.364930779f, 0.142045602f},
-std::array<float,2>{0.868068218f, 0.519254327f},
-std::array<float,2>{0.206086621f, 0.850213706f},
-std::array<float,2>{0.570245266f, 0.475399047f},
-std::array<float,2>{0.0129955309f, 0.29384023f},
-std::array<float,2>{0.701915801f, 0.991462708f},
-std::array<float,2>{0.472326875f, 0.689516008f},
-std::array<float,2>{0.949837089f, 0.0923332646f},
-std::array<float,2>{0.0634763315f, 0.226796016f},
-std::array<float,2>{0.65593195f, 0.571413755f},
-std::array<float,2>{0.389753759f, 0.752508819f},
-std::array<float,2>{0.890930235f, 0.403319597f},
-std::array<float,2>{0.253471076f, 0.33180964f},
-std::array<float,2>{0.758258104f, 0.937039852f},
-std::array<float,2>{0.148460239f, 0.634873986f},
-std::array<float,2>{0.500691354f, 0.0571097583f},
-std::array<float,2>{0.463071018f, 0.100775294f},
-std::array<float,2>{0.978485703f, 0.720732391f},
-std::array<float,2>{0.0389348269f, 0.940992951f},
-std::array<float,2>{0.734319866f, 0.257442623f},
-std::array<float,2>{0.238278419f, 0.440325648f},
-std::array<float,2>{0.602816999f, 0.830082119f},
-std::array<float,2>{0.335542589f, 0.532224059f},
-std::array<float,2>{0.835419059f, 0.168162838f},
-std::array<float,2>{0.0569214746f, 0.0634176284f},
-std::array<float,2>{0.749727726f, 0.716050863f},
-std::array<float,2>{0.439402789f, 0.976102412f},
-std::array<float,2>{0.985392511f, 0.302528739f},
-std::array<float,2>{0.317620575f, 0.490062654f},
-std::array<float,2>{0.818150461f, 0.865917683f},
-std::array<float,2>{0.221816495f, 0.502291739f},
-std::array<float,2>{0.612772644f, 0.138850451f},
-std::array<float,2>{0.400469661f, 0.209861666f},
-std::array<float,2>{0.878911316f, 0.596835434f},
-std::array<float,2>{0.087438412f, 0.78681469f},
-std::array<float,2>{0.640365839f, 0.425047308f},
-std::array<float,2>{0.131202042f, 0.354790777f},
-std::array<float,2>{0.522479117f, 0.894102275f},
-std::array<float,2>{0.279561013f, 0.683591485f},
-std::array<float,2>{0.770541072f, 0.031207012f},
-std::array<float,2>{0.189509019f, 0.181911826f},
-std::array<float,2>{0.580767095f, 0.56216532f},
-std::array<float,2>{0.346787453f, 0.824090123f},
-std::array<float,2>{0.846276104f, 0.468234956f},
-std::array<float,2>{0.498127818f, 0.278022975f},
-std::array<float,2>{0.966787279f, 0.953765869f},
-std::array<float,2>{0.0167099778f, 0.749021173f},
-std::array<float,2>{0.710802615f, 0.120342374f},
-std::array<float,2>{0.30933392f, 0.0407996401f},
-std::array<float,2>{0.790871799f, 0.643506765f},
-std::array<float,2>{0.159014851f, 0.920868576f},
-std::array<float,2>{0.543100178f, 0.325820416f},
-std::array<float,2>{0.106511749f, 0.379945844f},
-std::array<float,2>{0.686138809f, 0.776225626f},
-std::array<float,2>{0.416524172f, 0.579247773f},
-std::array<float,2>{0.93487668f, 0.246148735f},
-std::array<float,2>{0.12672472f, 0.108687609f},
-std::array<float,2>{0.516048133f, 0.732956886f},
-std::array<float,2>{0.273448974f, 0.949180961f},
-std::array<float,2>{0.76950109f, 0.258427203f},
-std::array<float,2>{0.403919727f, 0.445396096f},
-std::array<float,2>{0.877159297f, 0.838233113f},
-std::array<float,2>{0.0915118828f, 0.545684099f},
-std::array<float,2>{0.634807825f, 0.162322775f},
-std::array<float,2>{0.313646644f, 0.220084533f},
-std::array<float,2>{0.812704563f, 0.565439045f},
-std::array<float,2>{0.224297822f, 0.762667f},
-std::array<float,2>{0.613287628f, 0.395280689f},
-std::array<float,2>{0.0624932609f, 0.342320263f},
-std::array<float,2>{0.744415641f, 0.929314613f},
-std::array<float,2>{0.444205493f, 0.629466414f},
-std::array<float,2>{0.988412917f, 0.0535209291f},
-std::array<float,2>{0.104037747f, 0.153129488f},
-std::array<float,2>{0.679979265f, 0.52746892f},
-std::array<float,2>{0.418179095f, 0.854741096f},
-std::array<float,2>{0.931281447f, 0.47714147f},
-std::array<float,2>{0.308117777f, 0.286243707f},
-std::array<float,2>{0.7951051f, 0.995841265f},
-std::array<float,2>{0.160165742f, 0.696947336f},
-std::array<float,2>{0.542816043f, 0.0813595355f},
-std::array<float,2>{0.492931098f, 0.00903599896f},
-std::array<float,2>{0.962105215f, 0.671608925f},
-std::array<float,2>{0.0200445913f, 0.876241207f},
-std::array<float,2>{0.703422487f, 0.361174434f},
-std::array<float,2>{0.192893356f, 0.417127401f},
-std::array<float,2>{0.585130751f, 0.806000233f},
-std::array<float,2>{0.349539399f, 0.611650109f},
-std::array<float,2>{0.849837363f, 0.195996687f},
-std::array<float,2>{0.00876915455f, 0.0341280811f},
-std::array<float,2>{0.695436001f, 0.652421176f},
-std::array<float,2>{0.475727946f, 0.913376987f},
-std::array<float,2>{0.946818829f, 0.31307587f},
-std::array<float,2>{0.36211586f, 0.38347137f},
-std::array<float,2>{0.87136513f, 0.768674791f},
-std::array<float,2>{0.210443616f, 0.589501977f},
-std::array<float,2>{0.565197945f, 0.24041079f},
-std::array<float,2>{0.432241648f, 0.178494141f},
-std::array<float,2>{0.906479299f, 0.553883672f},
-std::array<float,2>{0.117299125f, 0.816791713f},
-std::array<float,2>{0.666534901f, 0.457395375f},
-std::array<float,2>{0.17282033f, 0.268240839f},
-std::array<float,2>{0.554751396f, 0.96161598f},
-std::array<float,2>{0.285345167f, 0.735542655f},
-std::array<float,2>{0.809741676f, 0.112426542f},
-std::array<float,2>{0.239704639f, 0.211206019f},
-std::array<float,2>{0.606594026f, 0.603353143f},
-std::array<float,2>{0.32974574f, 0.796741843f},
-std::array<float,2>{0.828602254f, 0.433579147f},
-std::array<float,2>{0.465426266f, 0.345214814f},
-std::array<float,2>{0.983961523f, 0.90014708f},
-std::array<float,2>{0.0321091153f, 0.677457273f},
-std::array<float,2>{0.729768097f, 0.0190068521f},
-std::array<float,2>{0.25577569f, 0.0755051374f},
-std::array<float,2>{0.764518559f, 0.710905612f},
-std::array<float,2>{0.152476683f, 0.978237689f},
-std::array<float,2>{0.507083118f, 0.307425827f},
-std::array<float,2>{0.0664410517f, 0.492980897f},
-std::array<float,2>{0.651508749f, 0.868882835f},
-std::array<float,2>{0.385014713f, 0.512725651f},
-std::array<float,2>{0.896454811f, 0.131775782f},
-std::array<float,2>{0.21831724f, 0.0255667195f},
-std::array<float,2>{0.571247637f, 0.685500085f},
-std::array<float,2>{0.370215327f, 0.89647162f},
-std::array<float,2>{0.863383055f, 0.356171578f},
-std::array<float,2>{0.478129953f, 0.42636016f},
-std::array<float,2>{0.945124805f, 0.782838404f},
-std::array<float,2>{0.00327708526f, 0.598924756f},
-std::array<float,2>{0.693636835f, 0.203219011f},
-std::array<float,2>{0.295667887f, 0.135263309f},
-std::array<float,2>{0.802879095f, 0.504764378f},
-std::array<float,2>{0.186484531f, 0.860467911f},
-std::array<float,2>{0.551735342f, 0.486328214f},
-std::array<float,2>{0.113420025f, 0.296986669f},
-std::array<float,2>{0.659421802f, 0.97074604f},
-std::array<float,2>{0.426472276f, 0.711040974f},
-std::array<float,2>{0.918511748f, 0.0677530169f},
-std::array<float,2>{0.0439495221f, 0.244963676f},
-std::array<float,2>{0.724100232f, 0.582744718f},
-std::array<float,2>{0.460594207f, 0.781012475f},
-std::array<float,2>{0.975817084f, 0.376976252f},
-std::array<float,2>{0.341670811f, 0.323114187f},
-std::array<float,2>{0.842528343f, 0.914721549f},
-std::array<float,2>{0.243431062f, 0.646900833f},
-std::array<float,2>{0.594525754f, 0.04590239f},
-std::array<float,2>{0.381563902f, 0.123272769f},
-std::array<float,2>{0.901133418f, 0.744574666f},
-std::array<float,2>{0.0765649229f, 0.958141148f},
-std::array<float,2>{0.648436725f, 0.275407255f},
-std::array<float,2>{0.14155589f, 0.464294225f},
-std::array<float,2>{0.515451849f, 0.827825546f},
-std::array<float,2>{0.26258406f, 0.557454884f},
-std::array<float,2>{0.756004453f, 0.184967607f},
-std::array<float,2>{0.0795319155f, 0.089596346f},
-std::array<float,2>{0.626831532f, 0.693989635f},
-std::array<float,2>{0.396812975f, 0.984582603f},
-std::array<float,2>{0.88391614f, 0.290425926f},
-std::array<float,2>{0.267568588f, 0.472611934f},
-std::array<float,2>{0.775379717f, 0.844650865f},
-std::array<float,2>{0.13626875f, 0.521202862f},
-std::array<float,2>{0.526700497f, 0.146469176f},
-std::array<float,2>{0.448148668f, 0.188491687f},
-std::array<float,2>{0.998119116f, 0.619666696f},
-std::array<float,2>{0.0518893264f, 0.8013767f},
-std::array<float,2>{0.737497091f, 0.414037168f},
-std::array<float,2>{0.232200161f, 0.374303609f},
-std::array<float,2>{0.618767679f, 0.884026647f},
-std::array<float,2>{0.322984189f, 0.661784768f},
-std::array<float,2>{0.826368451f, 0.00593614066f},
-std::array<float,2>{0.16833131f, 0.167138249f},
-std::array<float,2>{0.53761071f, 0.535497606f},
-std::array<float,2>{0.303258866f, 0.835388362f},
-std::array<float,2>{0.781565607f, 0.442854166f},
-std::array<float,2>{0.411885142f, 0.250324845f},
-std::array<float,2>{0.92288363f, 0.942328393f},
-std::array<float,2>{0.0997916535f, 0.725149512f},
-std::array<float,2>{0.67257458f, 0.0965974927f},
-std::array<float,2>{0.355843395f, 0.0610279366f},
-std::array<float,2>{0.85765785f, 0.637679815f},
-std::array<float,2>{0.201961696f, 0.930968702f},
-std::array<float,2>{0.591370523f, 0.334851682f},
-std::array<float,2>{0.0261992794f, 0.398623139f},
-std::array<float,2>{0.713096082f, 0.754768133f},
-std::array<float,2>{0.486069351f, 0.577250957f},
-std::array<float,2>{0.959666014f, 0.233620375f},
-std::array<float,2>{0.222561643f, 0.0651934221f},
-std::array<float,2>{0.613088608f, 0.717930973f},
-std::array<float,2>{0.318287373f, 0.973775268f},
-std::array<float,2>{0.817487299f, 0.304140985f},
-std::array<float,2>{0.43875733f, 0.490595847f},
-std::array<float,2>{0.986154675f, 0.86439544f},
-std::array<float,2>{0.0572625659f, 0.501095057f},
-std::array<float,2>{0.749064684f, 0.136882693f},
-std::array<float,2>{0.279818028f, 0.208227098f},
-std::array<float,2>{0.771015823f, 0.594586492f},
-std::array<float,2>{0.131384432f, 0.78768599f},
-std::array<float,2>{0.523151934f, 0.423414975f},
-std::array<float,2>{0.0871643201f, 0.353352338f},
-std::array<float,2>{0.63966161f, 0.892082036f},
-std::array<float,2>{0.400957495f, 0.681263328f},
-std::array<float,2>{0.879663169f, 0.0280327331f},
-std::array<float,2>{0.017236298f, 0.181313694f},
-std::array<float,2>{0.710301638f, 0.558956385f},
-std::array<float,2>{0.498844713f, 0.821936369f},
-std::array<float,2>{0.965910614f, 0.466240197f},
-std::array<float,2>{0.347378403f, 0.2799218f},
-std::array<float,2>{0.845823944f, 0.955551267f},
-std::array<float,2>{0.190092534f, 0.747429073f},
-std::array<float,2>{0.580175579f, 0.117899895f},
-std::array<float,2>{0.416477263f, 0.0423067436f},
-std::array<float,2>{0.935101986f, 0.642531097f},
-std::array<float,2>{0.107119322f, 0.919647515f},
-std::array<float,2>{0.685614288f, 0.326665372f},
-std::array<float,2>{0.158347711f, 0.380966783f},
-std::array<float,2>{0.543506682f, 0.774053216f},
-std::array<float,2>{0.308793277f, 0.581245244f},
-std::array<float,2>{0.790481687f, 0.248191267f},
-std::array<float,2>{0.124654822f, 0.00194229628f},
-std::array<float,2>{0.669690609f, 0.656916916f},
-std::array<float,2>{0.437105626f, 0.889755785f},
-std::array<float,2>{0.912070036f, 0.36927551f},
-std::array<float,2>{0.28234449f, 0.409894645f},
-std::array<float,2>{0.806188345f, 0.798419893f},
-std::array<float,2>{0.17873688f, 0.62314868f},
-std::array<float,2>{0.561468065f, 0.191841573f},
-std::array<float,2>{0.471896976f, 0.143571392f},
-std::array<float,2>{0.949234366f, 0.515890419f},
-std::array<float,2>{0.0135956565f, 0.848796964f},
-std::array<float,2>{0.70162189f, 0.47327885f},
-std::array<float,2>{0.206846997f, 0.296453893f},
-std::array<float,2>{0.569609761f, 0.988319218f},
-std::array<float,2>{0.364355296f, 0.68822664f},
-std::array<float,2>{0.867516518f, 0.0914551988f},
-std::array<float,2>{0.148950368f, 0.229406148f},
-std::array<float,2>{0.500157595f, 0.573168874f},
-std::array<float,2>{0.253313631f, 0.750931382f},
-std::array<float,2>{0.758467972f, 0.404947907f},
-std::array<float,2>{0.390584975f, 0.329824865f},
-std::array<float,2>{0.891370177f, 0.934450269f},
-std::array<float,2>{0.0628540665f, 0.633419275f},
-std::array<float,2>{0.655408502f, 0.0551108941f},
-std::array<float,2>{0.33536914f, 0.0987954289f},
-std::array<float,2>{0.835611403f, 0.719716609f},
-std::array<float,2>{0.237425193f, 0.939121008f},
-std::array<float,2>{0.603237689f, 0.25467518f},
-std::array<float,2>{0.0380875096f, 0.438477874f},
-std::array<float,2>{0.733691394f, 0.829150081f},
-std::array<float,2>{0.463565379f, 0.533236027f},
-std::array<float,2>{0.977964938f, 0.170573503f},
-std::array<float,2>{0.180355996f, 0.0503255799f},
-std::array<float,2>{0.550505757f, 0.626152396f},
-std::array<float,2>{0.290185481f, 0.923694551f},
-std::array<float,2>{0.797034621f, 0.337281376f},
-std::array<float,2>{0.424871624f, 0.390907645f},
-std::array<float,2>{0.91750294f, 0.759635389f},
-std::array<float,2>{0.112456232f, 0.567692399f},
-std::array<float,2>{0.663800359f, 0.226369604f},
-std::array<float,2>{0.374910355f, 0.156529188f},
-std::array<float,2>{0.862341583f, 0.539455295f},
-std::array<float,2>{0.213508457f, 0.841497719f},
-std::array<float,2>{0.577284992f, 0.452825874f},
-std::array<float,2>{0.0069021876f, 0.263177097f},
-std::array<float,2>{0.690558732f, 0.952856958f},
-std::array<float,2>{0.48133862f, 0.72689563f},
-std::array<float,2>{0.937638581f, 0.101857245f},
-std::array<float,2>{0.0723133683f, 0.202068686f},
-std::array<float,2>{0.642298818f, 0.613490522f},
-std::array<float,2>{0.377365232f, 0.81142503f},
-std::array<float,2>{0.90256536f, 0.418740183f},
-std::array<float,2>{0.259687394f, 0.365260184f},
-std::array<float,2>{0.750972748f, 0.88068223f},
-std::array<float,2>{0.145538807f, 0.6641078f},
-std::array<float,2>{0.510724485f, 0.0144344354f},
-std::array<float,2>{0.455941796f, 0.0857600421f},
-std::array<float,2>{0.970897794f, 0.700279295f},
-std::array<float,2>{0.0392633751f, 0.998910666f},
-std::array<float,2>{0.720502615f, 0.285137445f},
-std::array<float,2>{0.249135599f, 0.481280565f},
-std::array<float,2>{0.600928068f, 0.856860876f},
-std::array<float,2>{0.336783677f, 0.524177194f},
-std::array<float,2>{0.838736951f, 0.148643017f},
-std::array<float,2>{0.0498565398f, 0.116953477f},
-std::array<float,2>{0.739262283f, 0.740517735f},
-std::array<float,2>{0.452524304f, 0.965730786f},
-std::array<float,2>{0.993827045f, 0.271623641f},
-std::array<float,2>{0.328063339f, 0.455303401f},
-std::array<float,2>{0.821014941f, 0.812812746f},
-std::array<float,2>{0.229127243f, 0.547254026f},
-std::array<float,2>{0.624327242f, 0.172905326f},
-std::array<float,2>{0.391928524f, 0.2366568f},
-std::array<float,2>{0.889455199f, 0.590938389f},
-std::array<float,2>{0.0842285827f, 0.772438586f},
-std::array<float,2>{0.632411361f, 0.390212715f},
-std::array<float,2>{0.137925714f, 0.316506714f},
-std::array<float,2>{0.527542055f, 0.910092413f},
-std::array<float,2>{0.272263974f, 0.649381042f},
-std::array<float,2>{0.780179441f, 0.0355563127f},
-std::array<float,2>{0.197007865f, 0.1269162f},
-std::array<float,2>{0.587161183f, 0.51141572f},
-std::array<float,2>{0.355070591f, 0.873723865f},
-std::array<float,2>{0.851904511f, 0.49774757f},
-std::array<float,2>{0.490101427f, 0.312001854f},
-std::array<float,2>{0.956013381f, 0.983382642f},
-std::array<float,2>{0.0291361157f, 0.704019904f},
-std::array<float,2>{0.718229771f, 0.0710907131f},
-std::array<float,2>{0.299011856f, 0.0195696615f},
-std::array<float,2>{0.787692964f, 0.674393892f},
-std::array<float,2>{0.165422276f, 0.90240097f},
-std::array<float,2>{0.533823669f, 0.349664241f},
-std::array<float,2>{0.0976511016f, 0.434496641f},
-std::array<float,2>{0.678356826f, 0.792416573f},
-std::array<float,2>{0.406965494f, 0.608582139f},
-std::array<float,2>{0.927727401f, 0.218593881f},
-std::array<float,2>{0.162697718f, 0.0792761073f},
-std::array<float,2>{0.540737629f, 0.69805038f},
-std::array<float,2>{0.304791838f, 0.99263674f},
-std::array<float,2>{0.794072926f, 0.287843823f},
-std::array<float,2>{0.420369565f, 0.479640514f},
-std::array<float,2>{0.933251739f, 0.852691829f},
-std::array<float,2>{0.103063449f, 0.530328155f},
-std::array<float,2>{0.683576822f, 0.15501456f},
-std::array<float,2>{0.351329535f, 0.19801037f},
-std::array<float,2>{0.848455548f, 0.610179722f},
-std::array<float,2>{0.194514096f, 0.807542503f},
-std::array<float,2>{0.583594799f, 0.415775537f},
-std::array<float,2>{0.0220718365f, 0.361926138f},
-std::array<float,2>{0.707020223f, 0.877423942f},
-std::array<float,2>{0.495072752f, 0.669455469f},
-std::array<float,2>{0.964678049f, 0.0100594955f},
-std::array<float,2>{0.0933489352f, 0.160641551f},
-std::array<float,2>{0.634122431f, 0.544638097f},
-std::array<float,2>{0.40541935f, 0.836371124f},
-std::array<float,2>{0.87587291f, 0.44909212f},
-std::array<float,2>{0.275881916f, 0.260106832f},
-std::array<float,2>{0.765800655f, 0.945459723f},
-std::array<float,2>{0.128369808f, 0.732020319f},
-std::array<float,2>{0.51940167f, 0.10711287f},
-std::array<float,2>{0.44172129f, 0.0518769957f},
-std::array<float,2>{0.990728259f, 0.631528318f},
-std::array<float,2>{0.0598000102f, 0.927556753f},
-std::array<float,2>{0.742673457f, 0.341131032f},
-std::array<float,2>{0.22629343f, 0.397211075f},
-std::array<float,2>{0.616825759f, 0.764408231f},
-std::array<float,2>{0.31536749f, 0.564433813f},
-std::array<float,2>{0.815371215f, 0.221543446f},
-std::array<float,2>{0.03365786f, 0.01609906f},
-std::array<float,2>{0.727691531f, 0.678118348f},
-std::array<float,2>{0.468271017f, 0.900503755f},
-std::array<float,2>{0.980595827f, 0.347459733f},
-std::array<float,2>{0.331585735f, 0.431462377f},
-std::array<float,2>{0.830692947f, 0.793581307f},
-std::array<float,2>{0.240952268f, 0.604620397f},
-std::array<float,2>{0.607871771f, 0.212891251f},
-std::array<float,2>{0.383861244f, 0.130680531f},
-std::array<float,2>{0.896529138f, 0.515312195f},
-std::array<float,2>{0.0690156743f, 0.870032072f},
-std::array<float,2>{0.648830235f, 0.495405346f},
-std::array<float,2>{0.155598477f, 0.305435985f},
-std::array<float,2>{0.505723596f, 0.978546441f},
-std::array<float,2>{0.256856233f, 0.707297742f},
-std::array<float,2>{0.763493598f, 0.0780774206f},
-std::array<float,2>{0.208901912f, 0.239234567f},
-std::array<float,2>{0.563615203f, 0.586216569f},
-std::array<float,2>{0.360132098f, 0.766983867f},
-std::array<float,2>{0.873299897f, 0.385419369f},
-std::array<float,2>{0.473225832f, 0.315058351f},
-std::array<float,2>{0.947818279f, 0.911910951f},
-std::array<float,2>{0.0105401343f, 0.655739546f},
-std::array<float,2>{0.697792232f, 0.0326282009f},
-std::array<float,2>{0.287514508f, 0.109698027f},
-std::array<float,2>{0.81196481f, 0.736348391f},
-std::array<float,2>{0.174075812f, 0.964567602f},
-std::array<float,2>{0.558573544f, 0.26672411f},
-std::array<float,2>{0.119979456f, 0.460659534f},
-std::array<float,2>{0.664535522f, 0.820176244f},
-std::array<float,2>{0.430293024f, 0.552582324f},
-std::array<float,2>{0.909194708f, 0.176169679f},
-std::array<float,2>{0.24560973f, 0.0445300154f},
-std::array<float,2>{0.596506119f, 0.646182954f},
-std::array<float,2>{0.342626423f, 0.916085958f},
-std::array<float,2>{0.841720045f, 0.320474476f},
-std::array<float,2>{0.458056837f, 0.375062048f},
-std::array<float,2>{0.973428428f, 0.778980672f},
-std::array<float,2>{0.0463702679f, 0.585207105f},
-std::array<float,2>{0.725869596f, 0.243228197f},
-std::array<float,2>{0.264182001f, 0.186713293f},
-std::array<float,2>{0.755394638f, 0.556031168f},
-std::array<float,2>{0.143697113f, 0.824726939f},
-std::array<float,2>{0.511801779f, 0.462492108f},
-std::array<float,2>{0.074337475f, 0.27480942f},
-std::array<float,2>{0.64623946f, 0.959041417f},
-std::array<float,2>{0.379499704f, 0.742388129f},
-std::array<float,2>{0.899279058f, 0.122178584f},
-std::array<float,2>{0.000926980865f, 0.205449298f},
-std::array<float,2>{0.693282545f, 0.600769401f},
-std::array<float,2>{0.479219198f, 0.783808231f},
-std::array<float,2>{0.942227721f, 0.429536819f},
-std::array<float,2>{0.368204057f, 0.359316111f},
-std::array<float,2>{0.866330445f, 0.897401035f},
-std::array<float,2>{0.216372415f, 0.6857301f},
-std::array<float,2>{0.57367003f, 0.0246302467f},
-std::array<float,2>{0.428039432f, 0.0687516779f},
-std::array<float,2>{0.921362638f, 0.713616431f},
-std::array<float,2>{0.115905464f, 0.970038474f},
-std::array<float,2>{0.657169998f, 0.300125659f},
-std::array<float,2>{0.185452312f, 0.484932333f},
-std::array<float,2>{0.553343475f, 0.862265229f},
-std::array<float,2>{0.294904768f, 0.507264376f},
-std::array<float,2>{0.801499188f, 0.133460626f},
-std::array<float,2>{0.099499464f, 0.0953612626f},
-std::array<float,2>{0.673881352f, 0.724060476f},
-std::array<float,2>{0.413036942f, 0.943561256f},
-std::array<float,2>{0.924471796f, 0.253780782f},
-std::array<float,2>{0.301083267f, 0.443487138f},
-std::array<float,2>{0.783652723f, 0.833862722f},
-std::array<float,2>{0.170081913f, 0.53763473f},
-std::array<float,2>{0.535218656f, 0.164493993f},
-std::array<float,2>{0.486959845f, 0.232397318f},
-std::array<float,2>{0.957755566f, 0.574804425f},
-std::array<float,2>{0.02512151f, 0.757481694f},
-std::array<float,2>{0.712566733f, 0.402294308f},
-std::array<float,2>{0.199451342f, 0.332591623f},
-std::array<float,2>{0.591825962f, 0.932038486f},
-std::array<float,2>{0.358643174f, 0.640009522f},
-std::array<float,2>{0.856064975f, 0.0594541989f},
-std::array<float,2>{0.133156225f, 0.148092553f},
-std::array<float,2>{0.523913264f, 0.523201048f},
-std::array<float,2>{0.26779893f, 0.847584724f},
-std::array<float,2>{0.776013076f, 0.470329374f},
-std::array<float,2>{0.39487955f, 0.292098701f},
-std::array<float,2>{0.886165559f, 0.987688005f},
-std::array<float,2>{0.0814576596f, 0.692350149f},
-std::array<float,2>{0.628481627f, 0.0863144174f},
-std::array<float,2>{0.321492642f, 0.0050108633f},
-std::array<float,2>{0.825888276f, 0.662520826f},
-std::array<float,2>{0.234030128f, 0.884998679f},
-std::array<float,2>{0.620373666f, 0.372705519f},
-std::array<float,2>{0.0528879017f, 0.410596758f},
-std::array<float,2>{0.735011876f, 0.803431332f},
-std::array<float,2>{0.446699381f, 0.618921936f},
-std::array<float,2>{0.996389329f, 0.190267712f},
-std::array<float,2>{0.188417375f, 0.12064521f},
-std::array<float,2>{0.579290032f, 0.748308063f},
-std::array<float,2>{0.344340086f, 0.953517735f},
-std::array<float,2>{0.844182193f, 0.277436674f},
-std::array<float,2>{0.497909278f, 0.468360126f},
-std::array<float,2>{0.967595398f, 0.823497236f},
-std::array<float,2>{0.019459676f, 0.561607301f},
-std::array<float,2>{0.708685935f, 0.182486117f},
-std::array<float,2>{0.310665846f, 0.246624544f},
-std::array<float,2>{0.791939855f, 0.579961598f},
-std::array<float,2>{0.156614423f, 0.775425732f},
-std::array<float,2>{0.545449138f, 0.380798459f},
-std::array<float,2>{0.108115092f, 0.325589567f},
-std::array<float,2>{0.684990048f, 0.920251727f},
-std::array<float,2>{0.415525645f, 0.642879605f},
-std::array<float,2>{0.935598493f, 0.0401100516f},
-std::array<float,2>{0.0552713163f, 0.139345363f},
-std::array<float,2>{0.746646166f, 0.502456307f},
-std::array<float,2>{0.440331548f, 0.865680516f},
-std::array<float,2>{0.986415505f, 0.489611059f},
-std::array<float,2>{0.318798333f, 0.301977187f},
-std::array<float,2>{0.82012707f, 0.976047516f},
-std::array<float,2>{0.220190629f, 0.716445148f},
-std::array<float,2>{0.610153079f, 0.0625871718f},
-std::array<float,2>{0.399212331f, 0.0305127911f},
-std::array<float,2>{0.88255012f, 0.682707369f},
-std::array<float,2>{0.0895667523f, 0.893810272f},
-std::array<float,2>{0.638157427f, 0.355126321f},
-std::array<float,2>{0.129658371f, 0.425335735f},
-std::array<float,2>{0.519658923f, 0.786567509f},
-std::array<float,2>{0.277433872f, 0.59752959f},
-std::array<float,2>{0.773207188f, 0.209200829f},
-std::array<float,2>{0.0647080094f, 0.0576004684f},
-std::array<float,2>{0.6531865f, 0.635325134f},
-std::array<float,2>{0.388311118f, 0.936849892f},
-std::array<float,2>{0.894142151f, 0.331168801f},
-std::array<float,2>{0.25011161f, 0.40250361f},
-std::array<float,2>{0.759981036f, 0.752371728f},
-std::array<float,2>{0.151168182f, 0.572175324f},
-std::array<float,2>{0.503501117f, 0.227112964f},
-std::array<float,2>{0.462266833f, 0.168777227f},
-std::array<float,2>{0.979390025f, 0.531386018f},
-std::array<float,2>{0.0369735658f, 0.830738783f},
-std::array<float,2>{0.731308103f, 0.439838856f},
-std::array<float,2>{0.236134067f, 0.257129282f},
-std::array<float,2>{0.603567958f, 0.94085902f},
-std::array<float,2>{0.332440495f, 0.721432924f},
-std::array<float,2>{0.832656622f, 0.101109035f},
-std::array<float,2>{0.177649915f, 0.194716349f},
-std::array<float,2>{0.55901134f, 0.622385919f},
-std::array<float,2>{0.284020513f, 0.799414098f},
-std::array<float,2>{0.80704397f, 0.407764316f},
-std::array<float,2>{0.434388012f, 0.367848903f},
-std::array<float,2>{0.913343549f, 0.888616204f},
-std::array<float,2>{0.121098444f, 0.658799231f},
-std::array<float,2>{0.671099901f, 0.00358318095f},
-std::array<float,2>{0.365793407f, 0.092199944f},
-std::array<float,2>{0.870327711f, 0.690015256f},
-std::array<float,2>{0.204670697f, 0.991726518f},
-std::array<float,2>{0.567472398f, 0.293455154f},
-std::array<float,2>{0.0149548929f, 0.474999279f},
-std::array<float,2>{0.699935138f, 0.849652171f},
-std::array<float,2>{0.469992548f, 0.518649161f},
-std::array<float,2>{0.952082217f, 0.142438948f},
-std::array<float,2>{0.146672249f, 0.0118763065f},
-std::array<float,2>{0.509647667f, 0.667072237f},
-std::array<float,2>{0.259996623f, 0.881193519f},
-std::array<float,2>{0.752530277f, 0.363442302f},
-std::array<float,2>{0.375195205f, 0.421513617f},
-std::array<float,2>{0.904321492f, 0.810371637f},
-std::array<float,2>{0.0707064793f, 0.616054952f},
-std::array<float,2>{0.64446336f, 0.199656099f},
-std::array<float,2>{0.339095771f, 0.151806667f},
-std::array<float,2>{0.837349057f, 0.527256727f},
-std::array<float,2>{0.24754636f, 0.858032525f},
-std::array<float,2>{0.599432409f, 0.483401924f},
-std::array<float,2>{0.0425684527f, 0.282917887f},
-std::array<float,2>{0.721326828f, 0.997578561f},
-std::array<float,2>{0.453700095f, 0.702559114f},
-std::array<float,2>{0.968789399f, 0.0826570019f},
-std::array<float,2>{0.111231863f, 0.223518774f},
-std::array<float,2>{0.660728216f, 0.569464445f},
-std::array<float,2>{0.423496902f, 0.76010859f},
-std::array<float,2>{0.914100289f, 0.39423421f},
-std::array<float,2>{0.291053563f, 0.33869794f},
-std::array<float,2>{0.800238073f, 0.925703287f},
-std::array<float,2>{0.182066828f, 0.627419889f},
-std::array<float,2>{0.547848701f, 0.0475069471f},
-std::array<float,2>{0.482438862f, 0.104019113f},
-std::array<float,2>{0.941001952f, 0.729249239f},
-std::array<float,2>{0.00419612648f, 0.949276686f},
-std::array<float,2>{0.687959075f, 0.265461713f},
-std::array<float,2>{0.211610496f, 0.451067954f},
-std::array<float,2>{0.574886203f, 0.843733788f},
-std::array<float,2>{0.371458918f, 0.54229033f},
-std::array<float,2>{0.859716713f, 0.158919394f},
-std::array<float,2>{0.0309661608f, 0.0741024241f},
-std::array<float,2>{0.71622479f, 0.706403971f},
-std::array<float,2>{0.491751581f, 0.981542289f},
-std::array<float,2>{0.953773499f, 0.309974223f},
-std::array<float,2>{0.351565003f, 0.499307901f},
-std::array<float,2>{0.854787767f, 0.871179879f},
-std::array<float,2>{0.197622284f, 0.508723557f},
-std::array<float,2>{0.588332653f, 0.127843022f},
-std::array<float,2>{0.409847051f, 0.215904325f},
-std::array<float,2>{0.928863764f, 0.607207119f},
-std::array<float,2>{0.0943111405f, 0.790825963f},
-std::array<float,2>{0.677434146f, 0.436744183f},
-std::array<float,2>{0.167816564f, 0.348480135f},
-std::array<float,2>{0.532296836f, 0.905571699f},
-std::array<float,2>{0.296956599f, 0.673381746f},
-std::array<float,2>{0.786710143f, 0.0219111461f},
-std::array<float,2>{0.226782456f, 0.175165251f},
-std::array<float,2>{0.621133447f, 0.549592674f},
-std::array<float,2>{0.324798405f, 0.815166235f},
-std::array<float,2>{0.824209273f, 0.454760641f},
-std::array<float,2>{0.449318111f, 0.269548833f},
-std::array<float,2>{0.995089054f, 0.968636692f},
-std::array<float,2>{0.0486225709f, 0.738952935f},
-std::array<float,2>{0.741074145f, 0.114826657f},
-std::array<float,2>{0.270124018f, 0.0378493294f},
-std::array<float,2>{0.777643263f, 0.652163684f},
-std::array<float,2>{0.139854282f, 0.90666151f},
-std::array<float,2>{0.530053973f, 0.318890929f},
-std::array<float,2>{0.0839458033f, 0.387883335f},
-std::array<float,2>{0.630433798f, 0.770613194f},
-std::array<float,2>{0.393289745f, 0.592240274f},
-std::array<float,2>{0.886808395f, 0.236218899f},
-std::array<float,2>{0.175143018f, 0.111914992f},
-std::array<float,2>{0.557528079f, 0.734863162f},
-std::array<float,2>{0.288780421f, 0.962732017f},
-std::array<float,2>{0.810774207f, 0.268589973f},
-std::array<float,2>{0.430722684f, 0.458014488f},
-std::array<float,2>{0.908214867f, 0.81785959f},
-std::array<float,2>{0.120310098f, 0.553469419f},
-std::array<float,2>{0.665594935f, 0.178728372f},
-std::array<float,2>{0.360656023f, 0.241250858f},
-std::array<float,2>{0.874402165f, 0.58883363f},
-std::array<float,2>{0.207083523f, 0.768373311f},
-std::array<float,2>{0.563242793f, 0.383803815f},
-std::array<float,2>{0.0107455077f, 0.31416741f},
-std::array<float,2>{0.69832319f, 0.912443221f},
-std::array<float,2>{0.47424984f, 0.653334975f},
-std::array<float,2>{0.948763013f, 0.0348450765f},
-std::array<float,2>{0.0702588037f, 0.132698923f},
-std::array<float,2>{0.649604201f, 0.511916578f},
-std::array<float,2>{0.38368538f, 0.867631733f},
-std::array<float,2>{0.898063958f, 0.493688792f},
-std::array<float,2>{0.256348461f, 0.308457375f},
-std::array<float,2>{0.762266874f, 0.977037132f},
-std::array<float,2>{0.155230299f, 0.709569573f},
-std::array<float,2>{0.504295051f, 0.0749281794f},
-std::array<float,2>{0.46680361f, 0.0184319597f},
-std::array<float,2>{0.982122898f, 0.676054478f},
-std::array<float,2>{0.034929052f, 0.899278462f},
-std::array<float,2>{0.727331519f, 0.343948573f},
-std::array<float,2>{0.242003232f, 0.432461828f},
-std::array<float,2>{0.609141767f, 0.795714378f},
-std::array<float,2>{0.330613673f, 0.601586521f},
-std::array<float,2>{0.831656277f, 0.211953834f},
-std::array<float,2>{0.0592076816f, 0.0537456796f},
-std::array<float,2>{0.743967414f, 0.630259097f},
-std::array<float,2>{0.442483962f, 0.928426921f},
-std::array<float,2>{0.992087483f, 0.343515962f},
-std::array<float,2>{0.315902233f, 0.39648366f},
-std::array<float,2>{0.815463603f, 0.763102591f},
-std::array<float,2>{0.224620894f, 0.564520478f},
-std::array<float,2>{0.615349591f, 0.219344646f},
-std::array<float,2>{0.404439032f, 0.163146615f},
-std::array<float,2>{0.876116633f, 0.546233654f},
-std::array<float,2>{0.0918775499f, 0.839368761f},
-std::array<float,2>{0.633386195f, 0.447071195f},
-std::array<float,2>{0.127363458f, 0.258932859f},
-std::array<float,2>{0.517956495f, 0.947767437f},
-std::array<float,2>{0.276832581f, 0.734073997f},
-std::array<float,2>{0.767067969f, 0.107562169f},
-std::array<float,2>{0.193366021f, 0.196416706f},
-std::array<float,2>{0.582171082f, 0.612715364f},
-std::array<float,2>{0.350273609f, 0.805444121f},
-std::array<float,2>{0.848922849f, 0.416469187f},
-std::array<float,2>{0.495747089f, 0.360240668f},
-std::array<float,2>{0.963475764f, 0.875036836f},
-std::array<float,2>{0.0224827379f, 0.670470119f},
-std::array<float,2>{0.705251276f, 0.00848355703f},
-std::array<float,2>{0.305712134f, 0.0804357156f},
-std::array<float,2>{0.793055415f, 0.695406377f},
-std::array<float,2>{0.163554043f, 0.994882464f},
-std::array<float,2>{0.539505064f, 0.285233259f},
-std::array<float,2>{0.10236419f, 0.478441238f},
-std::array<float,2>{0.682448089f, 0.854456484f},
-std::array<float,2>{0.421801686f, 0.528772712f},
-std::array<float,2>{0.932182372f, 0.15419884f},
-std::array<float,2>{0.232945234f, 0.00720360782f},
-std::array<float,2>{0.619702578f, 0.660631478f},
-std::array<float,2>{0.321029872f, 0.883360147f},
-std::array<float,2>{0.824489415f, 0.373770326f},
-std::array<float,2>{0.446116865f, 0.412795991f},
-std::array<float,2>{0.997541428f, 0.802214026f},
-std::array<float,2>{0.054652188f, 0.62089318f},
-std::array<float,2>{0.73581928f, 0.187973201f},
-std::array<float,2>{0.269278646f, 0.145412609f},
-std::array<float,2>{0.77671659f, 0.51972574f},
-std::array<float,2>{0.134634987f, 0.845238864f},
-std::array<float,2>{0.525328934f, 0.471363455f},
-std::array<float,2>{0.080954805f, 0.289308965f},
-std::array<float,2>{0.627804279f, 0.985614896f},
-std::array<float,2>{0.396409154f, 0.694770455f},
-std::array<float,2>{0.885123134f, 0.0886528268f},
-std::array<float,2>{0.0243175104f, 0.232636735f},
-std::array<float,2>{0.71132195f, 0.576737821f},
-std::array<float,2>{0.488134503f, 0.755789161f},
-std::array<float,2>{0.958875954f, 0.399657071f},
-std::array<float,2>{0.358133942f, 0.335301548f},
-std::array<float,2>{0.856716275f, 0.929728031f},
-std::array<float,2>{0.200858891f, 0.638199747f},
-std::array<float,2>{0.59337765f, 0.0616624579f},
-std::array<float,2>{0.413369656f, 0.0967225581f},
-std::array<float,2>{0.925561845f, 0.725760758f},
-std::array<float,2>{0.0978757814f, 0.942912698f},
-std::array<float,2>{0.67573005f, 0.25171411f},
-std::array<float,2>{0.171692774f, 0.441740453f},
-std::array<float,2>{0.536458254f, 0.83405906f},
-std::array<float,2>{0.302140981f, 0.536735356f},
-std::array<float,2>{0.784457624f, 0.166963086f},
-std::array<float,2>{0.116767541f, 0.0667983815f},
-std::array<float,2>{0.657328725f, 0.712848842f},
-std::array<float,2>{0.429055065f, 0.972216606f},
-std::array<float,2>{0.920598567f, 0.298283726f},
-std::array<float,2>{0.293523878f, 0.487319887f},
-std::array<float,2>{0.801852405f, 0.85939759f},
-std::array<float,2>{0.184094638f, 0.504903316f},
-std::array<float,2>{0.554107726f, 0.136256322f},
-std::array<float,2>{0.48037079f, 0.204174459f},
-std::array<float,2>{0.943066239f, 0.598569691f},
-std::array<float,2>{0.00112853828f, 0.78179884f},
-std::array<float,2>{0.691767573f, 0.427373767f},
-std::array<float,2>{0.215671763f, 0.356591105f},
-std::array<float,2>{0.573012173f, 0.895418704f},
-std::array<float,2>{0.36752975f, 0.683601618f},
-std::array<float,2>{0.865937233f, 0.0264400225f},
-std::array<float,2>{0.143340126f, 0.18365708f},
-std::array<float,2>{0.51307559f, 0.558543205f},
-std::array<float,2>{0.264731944f, 0.826247036f},
-std::array<float,2>{0.754876912f, 0.463433444f},
-std::array<float,2>{0.380024552f, 0.276406109f},
-std::array<float,2>{0.9001019f, 0.95761472f},
-std::array<float,2>{0.0759343654f, 0.745413542f},
-std::array<float,2>{0.644623756f, 0.12443006f},
-std::array<float,2>{0.343022496f, 0.0454393998f},
-std::array<float,2>{0.840536058f, 0.647834241f},
-std::array<float,2>{0.244945213f, 0.915955842f},
-std::array<float,2>{0.597341239f, 0.32400775f},
-std::array<float,2>{0.0454131588f, 0.378433079f},
-std::array<float,2>{0.724749088f, 0.779416502f},
-std::array<float,2>{0.457515806f, 0.583222866f},
-std::array<float,2>{0.974516928f, 0.245656759f},
-std::array<float,2>{0.203969344f, 0.0899332836f},
-std::array<float,2>{0.56724453f, 0.688711524f},
-std::array<float,2>{0.367152274f, 0.990183771f},
-std::array<float,2>{0.869272351f, 0.295708239f},
-std::array<float,2>{0.469284952f, 0.474365443f},
-std::array<float,2>{0.952207565f, 0.847947419f},
-std::array<float,2>{0.0137538686f, 0.516743779f},
-std::array<float,2>{0.700235605f, 0.143081442f},
-std::array<float,2>{0.284240782f, 0.193294302f},
-std::array<float,2>{0.80770421f, 0.624501467f},
-std::array<float,2>{0.176273435f, 0.79728967f},
-std::array<float,2>{0.559895098f, 0.408807874f},
-std::array<float,2>{0.122704886f, 0.370382905f},
-std::array<float,2>{0.670580029f, 0.888705909f},
-std::array<float,2>{0.435538083f, 0.657791734f},
-std::array<float,2>{0.912935793f, 0.000882746885f},
-std::array<float,2>{0.0359936915f, 0.171622232f},
-std::array<float,2>{0.732094646f, 0.534185529f},
-std::array<float,2>{0.460989296f, 0.829044998f},
-std::array<float,2>{0.97949326f, 0.438296586f},
-std::array<float,2>{0.333589315f, 0.25517258f},
-std::array<float,2>{0.833956599f, 0.938124835f},
-std::array<float,2>{0.234812275f, 0.719878078f},
-std::array<float,2>{0.604597509f, 0.0976899564f},
-std::array<float,2>{0.387360901f, 0.056438867f},
-std::array<float,2>{0.892600596f, 0.634526074f},
-std::array<float,2>{0.0663794577f, 0.934982538f},
-std::array<float,2>{0.65401721f, 0.328395247f},
-std::array<float,2>{0.151814252f, 0.405846149f},
-std::array<float,2>{0.502237499f, 0.751412213f},
-std::array<float,2>{0.251390517f, 0.573675811f},
-std::array<float,2>{0.761370003f, 0.229879275f},
-std::array<float,2>{0.0884046182f, 0.029084485f},
-std::array<float,2>{0.63699156f, 0.680158794f},
-std::array<float,2>{0.400304854f, 0.891309917f},
-std::array<float,2>{0.881243467f, 0.351736099f},
-std::array<float,2>{0.278742611f, 0.422072262f},
-std::array<float,2>{0.771797955f, 0.788627565f},
-std::array<float,2>{0.130445898f, 0.59563905f},
-std::array<float,2>{0.521049976f, 0.207371563f},
-std::array<float,2>{0.441076905f, 0.137986556f},
-std::array<float,2>{0.987810552f, 0.500892103f},
-std::array<float,2>{0.0563179702f, 0.86354059f},
-std::array<float,2>{0.74746573f, 0.491957426f},
-std::array<float,2>{0.219423175f, 0.302928329f},
-std::array<float,2>{0.610748768f, 0.972664833f},
-std::array<float,2>{0.320164293f, 0.717391789f},
-std::array<float,2>{0.819326699f, 0.0662606284f},
-std::array<float,2>{0.157246009f, 0.249362007f},
-std::array<float,2>{0.545985639f, 0.580977201f},
-std::array<float,2>{0.312205911f, 0.7744416f},
-std::array<float,2>{0.792679965f, 0.382371992f},
-std::array<float,2>{0.414078653f, 0.327878267f},
-std::array<float,2>{0.937168956f, 0.918204844f},
-std::array<float,2>{0.109292462f, 0.641043484f},
-std::array<float,2>{0.684335053f, 0.0418659672f},
-std::array<float,2>{0.345247537f, 0.118925221f},
-std::array<float,2>{0.844821393f, 0.746554852f},
-std::array<float,2>{0.188638464f, 0.956625164f},
-std::array<float,2>{0.578845203f, 0.281054914f},
-std::array<float,2>{0.0180975758f, 0.465303034f},
-std::array<float,2>{0.707103014f, 0.820584357f},
-std::array<float,2>{0.49655658f, 0.559850812f},
-std::array<float,2>{0.968536973f, 0.179925576f},
-std::array<float,2>{0.138916165f, 0.0368273742f},
-std::array<float,2>{0.531096995f, 0.649612665f},
-std::array<float,2>{0.271311194f, 0.908653438f},
-std::array<float,2>{0.7789464f, 0.318338364f},
-std::array<float,2>{0.394017458f, 0.388887167f},
-std::array<float,2>{0.888204873f, 0.77336818f},
-std::array<float,2>{0.0828190073f, 0.590392113f},
-std::array<float,2>{0.629392028f, 0.237715915f},
-std::array<float,2>{0.325583935f, 0.172599718f},
-std::array<float,2>{0.822430313f, 0.548195481f},
-std::array<float,2>{0.228275463f, 0.814337969f},
-std::array<float,2>{0.622445703f, 0.456070751f},
-std::array<float,2>{0.0473274738f, 0.272957623f},
-std::array<float,2>{0.741456211f, 0.966014266f},
-std::array<float,2>{0.450888515f, 0.74124223f},
-std::array<float,2>{0.995355904f, 0.115608193f},
-std::array<float,2>{0.0954090208f, 0.217280135f},
-std::array<float,2>{0.676689506f, 0.608119369f},
-std::array<float,2>{0.408369243f, 0.791083038f},
-std::array<float,2>{0.928481877f, 0.434954822f},
-std::array<float,2>{0.298736036f, 0.351354808f},
-std::array<float,2>{0.785179675f, 0.904088199f},
-std::array<float,2>{0.166809455f, 0.675072014f},
-std::array<float,2>{0.531727791f, 0.0213524662f},
-std::array<float,2>{0.490618885f, 0.0713922977f},
-std::array<float,2>{0.954999626f, 0.704345167f},
-std::array<float,2>{0.0296936966f, 0.984336734f},
-std::array<float,2>{0.715811431f, 0.311062723f},
-std::array<float,2>{0.199163705f, 0.496189743f},
-std::array<float,2>{0.589064479f, 0.874148607f},
-std::array<float,2>{0.352934211f, 0.510076642f},
-std::array<float,2>{0.853615701f, 0.125139877f},
-std::array<float,2>{0.00497003458f, 0.102978624f},
-std::array<float,2>{0.68937254f, 0.727727413f},
-std::array<float,2>{0.483786762f, 0.951767862f},
-std::array<float,2>{0.939607501f, 0.262517571f},
-std::array<float,2>{0.372583508f, 0.451548845f},
-std::array<float,2>{0.860659361f, 0.839873075f},
-std::array<float,2>{0.212563068f, 0.540237427f},
-std::array<float,2>{0.575697064f, 0.158125922f},
-std::array<float,2>{0.421904922f, 0.224633694f},
-std::array<float,2>{0.915841341f, 0.566889942f},
-std::array<float,2>{0.109973311f, 0.758749664f},
-std::array<float,2>{0.662028849f, 0.392533273f},
-std::array<float,2>{0.183407217f, 0.336552471f},
-std::array<float,2>{0.548239529f, 0.922130585f},
-std::array<float,2>{0.292249948f, 0.625030458f},
-std::array<float,2>{0.798880696f, 0.0488415249f},
-std::array<float,2>{0.246994972f, 0.150057524f},
-std::array<float,2>{0.598380387f, 0.524670839f},
-std::array<float,2>{0.338447869f, 0.855587482f},
-std::array<float,2>{0.836776018f, 0.482066661f},
-std::array<float,2>{0.454766065f, 0.283860087f},
-std::array<float,2>{0.969898582f, 0.999354184f},
-std::array<float,2>{0.041208297f, 0.699382126f},
-std::array<float,2>{0.721684992f, 0.0844112486f},
-std::array<float,2>{0.261098504f, 0.0152902827f},
-std::array<float,2>{0.753880739f, 0.665540338f},
-std::array<float,2>{0.148120314f, 0.879538357f},
-std::array<float,2>{0.508627415f, 0.366640508f},
-std::array<float,2>{0.0714577362f, 0.419650346f},
-std::array<float,2>{0.643207967f, 0.811952889f},
-std::array<float,2>{0.376427382f, 0.61477381f},
-std::array<float,2>{0.90592885f, 0.202254266f},
-std::array<float,2>{0.154169098f, 0.0770683512f},
-std::array<float,2>{0.506226838f, 0.708758116f},
-std::array<float,2>{0.254688591f, 0.979801476f},
-std::array<float,2>{0.764873266f, 0.306392401f},
-std::array<float,2>{0.386691064f, 0.494538754f},
-std::array<float,2>{0.895329773f, 0.870782793f},
-std::array<float,2>{0.0674891695f, 0.51369828f},
-std::array<float,2>{0.651246071f, 0.129483938f},
-std::array<float,2>{0.3288306f, 0.21413216f},
-std::array<float,2>{0.829990387f, 0.604216754f},
-std::array<float,2>{0.239179015f, 0.794167399f},
-std::array<float,2>{0.606425822f, 0.429938555f},
-std::array<float,2>{0.0324032456f, 0.34622103f},
-std::array<float,2>{0.728569388f, 0.902165294f},
-std::array<float,2>{0.466049343f, 0.67920512f},
-std::array<float,2>{0.982558906f, 0.0170044005f},
-std::array<float,2>{0.118320033f, 0.177024543f},
-std::array<float,2>{0.667338669f, 0.551149607f},
-std::array<float,2>{0.432678044f, 0.81928736f},
-std::array<float,2>{0.908158541f, 0.459504545f},
-std::array<float,2>{0.286722571f, 0.26619485f},
-std::array<float,2>{0.808915138f, 0.963093638f},
-std::array<float,2>{0.173205391f, 0.737386048f},
-std::array<float,2>{0.555672646f, 0.111206271f},
-std::array<float,2>{0.475222081f, 0.0319727026f},
-std::array<float,2>{0.945406258f, 0.654995561f},
-std::array<float,2>{0.00905877445f, 0.910731196f},
-std::array<float,2>{0.696852028f, 0.315882385f},
-std::array<float,2>{0.209838405f, 0.386271387f},
-std::array<float,2>{0.566235363f, 0.766280353f},
-std::array<float,2>{0.363209069f, 0.587019026f},
-std::array<float,2>{0.872191191f, 0.240048543f},
-std::array<float,2>{0.021138357f, 0.0113749718f},
-std::array<float,2>{0.704700708f, 0.668848157f},
-std::array<float,2>{0.493657589f, 0.878617823f},
-std::array<float,2>{0.961402893f, 0.36254859f},
-std::array<float,2>{0.347889602f, 0.414630473f},
-std::array<float,2>{0.851422548f, 0.807826936f},
-std::array<float,2>{0.191969246f, 0.611201406f},
-std::array<float,2>{0.584760427f, 0.199140608f},
-std::array<float,2>{0.41977042f, 0.155320287f},
-std::array<float,2>{0.929863691f, 0.530014753f},
-std::array<float,2>{0.104708411f, 0.851687312f},
-std::array<float,2>{0.681166589f, 0.478967816f},
-std::array<float,2>{0.161531135f, 0.289060354f},
-std::array<float,2>{0.54128176f, 0.994046986f},
-std::array<float,2>{0.307464093f, 0.698945463f},
-std::array<float,2>{0.796623051f, 0.0788414627f},
-std::array<float,2>{0.223180994f, 0.222453922f},
-std::array<float,2>{0.615171313f, 0.563298702f},
-std::array<float,2>{0.312558621f, 0.765343189f},
-std::array<float,2>{0.814104557f, 0.398013651f},
-std::array<float,2>{0.444819182f, 0.340386868f},
-std::array<float,2>{0.989711583f, 0.926082075f},
-std::array<float,2>{0.0611464605f, 0.632124066f},
-std::array<float,2>{0.745428324f, 0.0508644916f},
-std::array<float,2>{0.275142401f, 0.106009834f},
-std::array<float,2>{0.768120825f, 0.731045902f},
-std::array<float,2>{0.125836894f, 0.946828187f},
-std::array<float,2>{0.517119706f, 0.261282146f},
-std::array<float,2>{0.0904517248f, 0.448227018f},
-std::array<float,2>{0.635779798f, 0.837196648f},
-std::array<float,2>{0.402938098f, 0.543254852f},
-std::array<float,2>{0.878062308f, 0.161510661f},
-std::array<float,2>{0.202815577f, 0.0600817353f},
-std::array<float,2>{0.590361536f, 0.638977528f},
-std::array<float,2>{0.356683284f, 0.932887971f},
-std::array<float,2>{0.859116137f, 0.333899379f},
-std::array<float,2>{0.48489213f, 0.400775969f},
-std::array<float,2>{0.960088432f, 0.756520212f},
-std::array<float,2>{0.0271106064f, 0.575999558f},
-std::array<float,2>{0.714777052f, 0.231357023f},
-std::array<float,2>{0.304265916f, 0.16532968f},
-std::array<float,2>{0.783120036f, 0.538217604f},
-std::array<float,2>{0.169673622f, 0.832498968f},
-std::array<float,2>{0.538353682f, 0.444487572f},
-std::array<float,2>{0.100719333f, 0.252284944f},
-std::array<float,2>{0.673080623f, 0.944365323f},
-std::array<float,2>{0.410483479f, 0.722843945f},
-std::array<float,2>{0.922640443f, 0.0946251005f},
-std::array<float,2>{0.0510961786f, 0.191387534f},
-std::array<float,2>{0.73723346f, 0.61727643f},
-std::array<float,2>{0.448574215f, 0.803771853f},
-std::array<float,2>{0.999462962f, 0.4120031f},
-std::array<float,2>{0.324156076f, 0.371408135f},
-std::array<float,2>{0.827196896f, 0.886592507f},
-std::array<float,2>{0.231380239f, 0.663249314f},
-std::array<float,2>{0.618055105f, 0.00395117374f},
-std::array<float,2>{0.397642761f, 0.0871698782f},
-std::array<float,2>{0.883410811f, 0.692715764f},
-std::array<float,2>{0.0789592862f, 0.986698806f},
-std::array<float,2>{0.625363588f, 0.291350037f},
-std::array<float,2>{0.135490209f, 0.469045043f},
-std::array<float,2>{0.525963843f, 0.84662956f},
-std::array<float,2>{0.266204685f, 0.522198439f},
-std::array<float,2>{0.774335444f, 0.146776587f},
-std::array<float,2>{0.0775965005f, 0.121437542f},
-std::array<float,2>{0.647043526f, 0.743616581f},
-std::array<float,2>{0.382650584f, 0.960608661f},
-std::array<float,2>{0.90194869f, 0.273638874f},
-std::array<float,2>{0.263581991f, 0.461164862f},
-std::array<float,2>{0.757289529f, 0.8256405f},
-std::array<float,2>{0.142408997f, 0.555606306f},
-std::array<float,2>{0.513884604f, 0.186149389f},
-std::array<float,2>{0.459621489f, 0.242262736f},
-std::array<float,2>{0.97532016f, 0.584282398f},
-std::array<float,2>{0.0436466746f, 0.777601123f},
-std::array<float,2>{0.722858131f, 0.376064986f},
-std::array<float,2>{0.242868125f, 0.321483135f},
-std::array<float,2>{0.594746947f, 0.91712296f},
-std::array<float,2>{0.340038091f, 0.644544482f},
-std::array<float,2>{0.843087673f, 0.0433724038f},
-std::array<float,2>{0.187140524f, 0.134428248f},
-std::array<float,2>{0.55261761f, 0.506285191f},
-std::array<float,2>{0.295943767f, 0.86289531f},
-std::array<float,2>{0.804622948f, 0.486147285f},
-std::array<float,2>{0.427458167f, 0.299185872f},
-std::array<float,2>{0.919427633f, 0.968952596f},
-std::array<float,2>{0.114724196f, 0.71390003f},
-std::array<float,2>{0.658704877f, 0.0693726838f},
-std::array<float,2>{0.369274795f, 0.0239512939f},
-std::array<float,2>{0.864285409f, 0.686860442f},
-std::array<float,2>{0.217657432f, 0.89809674f},
-std::array<float,2>{0.571667314f, 0.35770905f},
-std::array<float,2>{0.00224710326f, 0.428188562f},
-std::array<float,2>{0.694822967f, 0.784762263f},
-std::array<float,2>{0.477288336f, 0.600151002f},
-std::array<float,2>{0.943958938f, 0.20654045f},
-std::array<float,2>{0.236915082f, 0.100493804f},
-std::array<float,2>{0.602389812f, 0.722459197f},
-std::array<float,2>{0.334765017f, 0.939759195f},
-std::array<float,2>{0.834817946f, 0.256697118f},
-std::array<float,2>{0.464000732f, 0.441344678f},
-std::array<float,2>{0.97741586f, 0.831701219f},
-std::array<float,2>{0.0379933231f, 0.533014655f},
-std::array<float,2>{0.732534409f, 0.169915006f},
-std::array<float,2>{0.252710968f, 0.228203952f},
-std::array<float,2>{0.759008348f, 0.570832014f},
-std::array<float,2>{0.150353909f, 0.75371325f},
-std::array<float,2>{0.501531422f, 0.40357393f},
-std::array<float,2>{0.0641718581f, 0.330887318f},
-std::array<float,2>{0.654604793f, 0.936102748f},
-std::array<float,2>{0.388732702f, 0.63600862f},
-std::array<float,2>{0.891791224f, 0.0582117625f},
-std::array<float,2>{0.0123883653f, 0.140947863f},
-std::array<float,2>{0.702544749f, 0.517751753f},
-std::array<float,2>{0.471306324f, 0.85063237f},
-std::array<float,2>{0.950949192f, 0.475763261f},
-std::array<float,2>{0.363884181f, 0.294461548f},
-std::array<float,2>{0.868411303f, 0.990361512f},
-std::array<float,2>{0.205945894f, 0.690701127f},
-std::array<float,2>{0.568956792f, 0.0929395854f},
-std::array<float,2>{0.436019063f, 0.00204558531f},
-std::array<float,2>{0.910249472f, 0.660156071f},
-std::array<float,2>{0.123362273f, 0.887245595f},
-std::array<float,2>{0.668260813f, 0.36911881f},
-std::array<float,2>{0.178593501f, 0.407153219f},
-std::array<float,2>{0.562338948f, 0.800554514f},
-std::array<float,2>{0.282019556f, 0.621834219f},
-std::array<float,2>{0.805328488f, 0.193742454f},
-std::array<float,2>{0.105764069f, 0.0397179425f},
-std::array<float,2>{0.687148094f, 0.643904686f},
-std::array<float,2>{0.417801917f, 0.921024144f},
-std::array<float,2>{0.934004486f, 0.324862033f},
-std::array<float,2>{0.310451508f, 0.379103333f},
-std::array<float,2>{0.789996088f, 0.777311087f},
-std::array<float,2>{0.159795269f, 0.578914285f},
-std::array<float,2>{0.544570744f, 0.247371331f},
-std::array<float,2>{0.499843538f, 0.183385104f},
-std::array<float,2>{0.9655267f, 0.561142325f},
-std::array<float,2>{0.0159351993f, 0.822377205f},
-std::array<float,2>{0.709178329f, 0.466867954f},
-std::array<float,2>{0.190448418f, 0.279082894f},
-std::array<float,2>{0.581612945f, 0.954629362f},
-std::array<float,2>{0.346039027f, 0.749112904f},
-std::array<float,2>{0.847535253f, 0.119306818f},
-std::array<float,2>{0.132403016f, 0.210615903f},
-std::array<float,2>{0.521495044f, 0.596357226f},
-std::array<float,2>{0.280603349f, 0.785252631f},
-std::array<float,2>{0.770225942f, 0.424323052f},
-std::array<float,2>{0.401450664f, 0.354257673f},
-std::array<float,2>{0.880309939f, 0.893243194f},
-std::array<float,2>{0.0861864761f, 0.682513833f},
-std::array<float,2>{0.639036357f, 0.0297874697f},
-std::array<float,2>{0.316595793f, 0.0637887046f},
-std::array<float,2>{0.816562772f, 0.715678692f},
-std::array<float,2>{0.221116588f, 0.974665999f},
-std::array<float,2>{0.61141187f, 0.301650941f},
-std::array<float,2>{0.0576806441f, 0.488560945f},
-std::array<float,2>{0.748999953f, 0.866549313f},
-std::array<float,2>{0.438335091f, 0.503743947f},
-std::array<float,2>{0.98531574f, 0.140336007f},
-std::array<float,2>{0.165031523f, 0.0233725477f},
-std::array<float,2>{0.534914613f, 0.672082424f},
-std::array<float,2>{0.299815148f, 0.904501975f},
-std::array<float,2>{0.788121343f, 0.348710597f},
-std::array<float,2>{0.407586038f, 0.435660541f},
-std::array<float,2>{0.926339805f, 0.7897861f},
-std::array<float,2>{0.0958089381f, 0.60592258f},
-std::array<float,2>{0.679190636f, 0.215315893f},
-std::array<float,2>{0.353592038f, 0.128220975f},
-std::array<float,2>{0.852706611f, 0.50879997f},
-std::array<float,2>{0.195379242f, 0.872238874f},
-std::array<float,2>{0.586689651f, 0.49865225f},
-std::array<float,2>{0.0277073029f, 0.309526026f},
-std::array<float,2>{0.716845989f, 0.980910718f},
-std::array<float,2>{0.488758743f, 0.705694318f},
-std::array<float,2>{0.956727386f, 0.0727065876f},
-std::array<float,2>{0.0858645067f, 0.234820828f},
-std::array<float,2>{0.631582081f, 0.59332633f},
-std::array<float,2>{0.390802503f, 0.769668937f},
-std::array<float,2>{0.890075266f, 0.387057692f},
-std::array<float,2>{0.272585064f, 0.320113778f},
-std::array<float,2>{0.780368924f, 0.907942593f},
-std::array<float,2>{0.137001902f, 0.650829017f},
-std::array<float,2>{0.52843225f, 0.0390139781f},
-std::array<float,2>{0.451575339f, 0.113351122f},
-std::array<float,2>{0.992971122f, 0.739998579f},
-std::array<float,2>{0.0497675315f, 0.96737808f},
-std::array<float,2>{0.738970816f, 0.270737797f},
-std::array<float,2>{0.230070934f, 0.45371902f},
-std::array<float,2>{0.623478889f, 0.815725803f},
-std::array<float,2>{0.326789171f, 0.550145686f},
-std::array<float,2>{0.822092891f, 0.174612388f},
-std::array<float,2>{0.0404830389f, 0.0833286569f},
-std::array<float,2>{0.718755722f, 0.701194882f},
-std::array<float,2>{0.456795961f, 0.996566355f},
-std::array<float,2>{0.972145498f, 0.281928539f},
-std::array<float,2>{0.337310493f, 0.482554734f},
-std::array<float,2>{0.839386106f, 0.859076083f},
-std::array<float,2>{0.248347029f, 0.526141346f},
-std::array<float,2>{0.60028255f, 0.150604904f},
-std::array<float,2>{0.378900945f, 0.200652719f},
-std::array<float,2>{0.903659463f, 0.61625725f},
-std::array<float,2>{0.0739515573f, 0.809100509f},
-std::array<float,2>{0.640754282f, 0.420092016f},
-std::array<float,2>{0.14500615f, 0.364710271f},
-std::array<float,2>{0.511184216f, 0.88206315f},
-std::array<float,2>{0.258308023f, 0.666676104f},
-std::array<float,2>{0.751454651f, 0.0128367869f},
-std::array<float,2>{0.214404866f, 0.159336686f},
-std::array<float,2>{0.577102184f, 0.541809499f},
-std::array<float,2>{0.373545498f, 0.842728198f},
-std::array<float,2>{0.861663103f, 0.449725479f},
-std::array<float,2>{0.482082516f, 0.263896435f},
-std::array<float,2>{0.938771248f, 0.950300872f},
-std::array<float,2>{0.00596124073f, 0.729718983f},
-std::array<float,2>{0.690374672f, 0.104785658f},
-std::array<float,2>{0.289349616f, 0.0481206775f},
-std::array<float,2>{0.797947764f, 0.628354847f},
-std::array<float,2>{0.180839643f, 0.924643397f},
-std::array<float,2>{0.549249232f, 0.339220226f},
-std::array<float,2>{0.111875698f, 0.392604828f},
-std::array<float,2>{0.66287291f, 0.76086849f},
-std::array<float,2>{0.424703091f, 0.568569005f},
-std::array<float,2>{0.916977942f, 0.224455774f}}
\ No newline at end of file
@@ -1,4096 +0,0 @@
-{std::array<float,2>{0.36177215f, 0.88088572f},
-std::array<float,2>{0.686758637f, 0.0557854921f},
-std::array<float,2>{0.213871956f, 0.372461021f},
-std::array<float,2>{0.805456102f, 0.505559087f},
-std::array<float,2>{0.0275989585f, 0.628036857f},
-std::array<float,2>{0.971860409f, 0.496562302f},
-std::array<float,2>{0.448361158f, 0.215024933f},
-std::array<float,2>{0.617573678f, 0.754475415f},
-std::array<float,2>{0.141547382f, 0.818923056f},
-std::array<float,2>{0.822059572f, 0.149011508f},
-std::array<float,2>{0.305463672f, 0.432779163f},
-std::array<float,2>{0.741576374f, 0.748869598f},
-std::array<float,2>{0.402486563f, 0.601721704f},
-std::array<float,2>{0.560668647f, 0.306566596f},
-std::array<float,2>{0.103090644f, 0.123141967f},
-std::array<float,2>{0.892000616f, 0.991106808f},
-std::array<float,2>{0.498791784f, 0.807436109f},
-std::array<float,2>{0.573274851f, 0.228330836f},
-std::array<float,2>{0.0430630967f, 0.467666417f},
-std::array<float,2>{0.962492168f, 0.664821565f},
-std::array<float,2>{0.23837027f, 0.539949715f},
-std::array<float,2>{0.755486846f, 0.336345732f},
-std::array<float,2>{0.33703813f, 0.0290222056f},
-std::array<float,2>{0.635822117f, 0.911063254f},
-std::array<float,2>{0.0738517642f, 0.967730761f},
-std::array<float,2>{0.907470644f, 0.0755462199f},
-std::array<float,2>{0.406400621f, 0.25406912f},
-std::array<float,2>{0.518185914f, 0.586077094f},
-std::array<float,2>{0.261768311f, 0.699893773f},
-std::array<float,2>{0.709516168f, 0.379081339f},
-std::array<float,2>{0.157640696f, 0.187440097f},
-std::array<float,2>{0.874153137f, 0.845696151f},
-std::array<float,2>{0.421941698f, 0.976061583f},
-std::array<float,2>{0.503271461f, 0.106468834f},
-std::array<float,2>{0.0781939328f, 0.29626143f},
-std::array<float,2>{0.924071848f, 0.613687992f},
-std::array<float,2>{0.181504071f, 0.721013427f},
-std::array<float,2>{0.858585596f, 0.410952181f},
-std::array<float,2>{0.269219577f, 0.131234556f},
-std::array<float,2>{0.692301512f, 0.832183301f},
-std::array<float,2>{0.0497465022f, 0.772963166f},
-std::array<float,2>{0.950872898f, 0.193495542f},
-std::array<float,2>{0.475223601f, 0.478488714f},
-std::array<float,2>{0.58499527f, 0.64553678f},
-std::array<float,2>{0.322867811f, 0.521300316f},
-std::array<float,2>{0.640709877f, 0.355209976f},
-std::array<float,2>{0.219436049f, 0.0332545489f},
-std::array<float,2>{0.771063447f, 0.896476865f},
-std::array<float,2>{0.291009963f, 0.873959541f},
-std::array<float,2>{0.732873797f, 0.166643217f},
-std::array<float,2>{0.134539038f, 0.393316835f},
-std::array<float,2>{0.839959145f, 0.716920972f},
-std::array<float,2>{0.118457161f, 0.570151687f},
-std::array<float,2>{0.884184003f, 0.279564202f},
-std::array<float,2>{0.3805314f, 0.0782602876f},
-std::array<float,2>{0.533979654f, 0.950716376f},
-std::array<float,2>{0.192691714f, 0.922688961f},
-std::array<float,2>{0.789924145f, 0.0145628387f},
-std::array<float,2>{0.344522804f, 0.32267797f},
-std::array<float,2>{0.661986232f, 0.554965377f},
-std::array<float,2>{0.460337251f, 0.686565638f},
-std::array<float,2>{0.596831858f, 0.448098034f},
-std::array<float,2>{0.0117715243f, 0.240068272f},
-std::array<float,2>{0.98927623f, 0.783606768f},
-std::array<float,2>{0.2762326f, 0.942573845f},
-std::array<float,2>{0.698390365f, 0.0898761377f},
-std::array<float,2>{0.172188416f, 0.269479364f},
-std::array<float,2>{0.84702599f, 0.571383238f},
-std::array<float,2>{0.0863267705f, 0.710798621f},
-std::array<float,2>{0.93065536f, 0.399800301f},
-std::array<float,2>{0.432442635f, 0.156351596f},
-std::array<float,2>{0.515612543f, 0.86703968f},
-std::array<float,2>{0.231931865f, 0.792414129f},
-std::array<float,2>{0.778840125f, 0.2477801f},
-std::array<float,2>{0.316788912f, 0.44048357f},
-std::array<float,2>{0.649921179f, 0.674611449f},
-std::array<float,2>{0.47676602f, 0.551810026f},
-std::array<float,2>{0.593108952f, 0.313371032f},
-std::array<float,2>{0.0586399063f, 0.00141734444f},
-std::array<float,2>{0.943097532f, 0.931269169f},
-std::array<float,2>{0.390055656f, 0.83861649f},
-std::array<float,2>{0.545567453f, 0.138201624f},
-std::array<float,2>{0.115017176f, 0.415633768f},
-std::array<float,2>{0.87656039f, 0.730682552f},
-std::array<float,2>{0.127666235f, 0.621059358f},
-std::array<float,2>{0.831569672f, 0.286475927f},
-std::array<float,2>{0.286990225f, 0.09815716f},
-std::array<float,2>{0.721608222f, 0.982169569f},
-std::array<float,2>{0.00275601773f, 0.899622142f},
-std::array<float,2>{0.996406078f, 0.0394143611f},
-std::array<float,2>{0.467945963f, 0.347839564f},
-std::array<float,2>{0.604711175f, 0.524411082f},
-std::array<float,2>{0.355396718f, 0.654084623f},
-std::array<float,2>{0.670283616f, 0.475221157f},
-std::array<float,2>{0.200408295f, 0.196580917f},
-std::array<float,2>{0.786858737f, 0.774990797f},
-std::array<float,2>{0.445127875f, 0.918263614f},
-std::array<float,2>{0.615118921f, 0.0227464214f},
-std::array<float,2>{0.0162661448f, 0.332129061f},
-std::array<float,2>{0.980800092f, 0.53556174f},
-std::array<float,2>{0.203730509f, 0.662042379f},
-std::array<float,2>{0.797302485f, 0.455952257f},
-std::array<float,2>{0.370368361f, 0.225198895f},
-std::array<float,2>{0.673364639f, 0.79842633f},
-std::array<float,2>{0.094379805f, 0.859312117f},
-std::array<float,2>{0.902754903f, 0.176001787f},
-std::array<float,2>{0.397860467f, 0.388722211f},
-std::array<float,2>{0.550994873f, 0.68948257f},
-std::array<float,2>{0.301356614f, 0.580879509f},
-std::array<float,2>{0.742898762f, 0.258132935f},
-std::array<float,2>{0.154914752f, 0.0672628805f},
-std::array<float,2>{0.814695299f, 0.957722485f},
-std::array<float,2>{0.335134983f, 0.758021891f},
-std::array<float,2>{0.627500176f, 0.203797936f},
-std::array<float,2>{0.242324635f, 0.487398088f},
-std::array<float,2>{0.764812052f, 0.635663331f},
-std::array<float,2>{0.0330639929f, 0.513783038f},
-std::array<float,2>{0.954266846f, 0.36449945f},
-std::array<float,2>{0.487836927f, 0.0494253933f},
-std::array<float,2>{0.563824415f, 0.889076769f},
-std::array<float,2>{0.165244848f, 0.995683491f},
-std::array<float,2>{0.863023579f, 0.113898031f},
-std::array<float,2>{0.250038415f, 0.299029738f},
-std::array<float,2>{0.713834584f, 0.598004282f},
-std::array<float,2>{0.415584058f, 0.739862323f},
-std::array<float,2>{0.52783066f, 0.423785359f},
-std::array<float,2>{0.0696478114f, 0.147622555f},
-std::array<float,2>{0.921000481f, 0.821746051f},
-std::array<float,2>{0.312803984f, 0.985700607f},
-std::array<float,2>{0.654998124f, 0.119858302f},
-std::array<float,2>{0.226679444f, 0.311982423f},
-std::array<float,2>{0.775474846f, 0.608859539f},
-std::array<float,2>{0.0573794022f, 0.744252861f},
-std::array<float,2>{0.940656602f, 0.433956653f},
-std::array<float,2>{0.481142014f, 0.152753696f},
-std::array<float,2>{0.588448226f, 0.812598884f},
-std::array<float,2>{0.175939366f, 0.750651956f},
-std::array<float,2>{0.84775126f, 0.211055204f},
-std::array<float,2>{0.279738694f, 0.495203823f},
-std::array<float,2>{0.699757814f, 0.632680953f},
-std::array<float,2>{0.435217768f, 0.503847003f},
-std::array<float,2>{0.510225892f, 0.370244652f},
-std::array<float,2>{0.0913170651f, 0.0601161197f},
-std::array<float,2>{0.935195923f, 0.87514478f},
-std::array<float,2>{0.462431759f, 0.850072205f},
-std::array<float,2>{0.60782218f, 0.179923162f},
-std::array<float,2>{0.00507809594f, 0.377358198f},
-std::array<float,2>{0.99245435f, 0.697666705f},
-std::array<float,2>{0.195614204f, 0.591883898f},
-std::array<float,2>{0.782955587f, 0.250019133f},
-std::array<float,2>{0.358650565f, 0.0709549263f},
-std::array<float,2>{0.664534628f, 0.962869167f},
-std::array<float,2>{0.112699986f, 0.90747273f},
-std::array<float,2>{0.881398797f, 0.0270597395f},
-std::array<float,2>{0.383956701f, 0.343634427f},
-std::array<float,2>{0.539461195f, 0.544984341f},
-std::array<float,2>{0.281294107f, 0.671550512f},
-std::array<float,2>{0.724659741f, 0.462387085f},
-std::array<float,2>{0.130140588f, 0.23265627f},
-std::array<float,2>{0.833442032f, 0.809509277f},
-std::array<float,2>{0.391343981f, 0.890736282f},
-std::array<float,2>{0.546903312f, 0.038539242f},
-std::array<float,2>{0.100922905f, 0.356030762f},
-std::array<float,2>{0.900740504f, 0.516334295f},
-std::array<float,2>{0.148972526f, 0.641753495f},
-std::array<float,2>{0.8192119f, 0.480635434f},
-std::array<float,2>{0.297426492f, 0.187748358f},
-std::array<float,2>{0.749899387f, 0.768408597f},
-std::array<float,2>{0.0212450922f, 0.829653502f},
-std::array<float,2>{0.978383183f, 0.128057882f},
-std::array<float,2>{0.438054979f, 0.409869134f},
-std::array<float,2>{0.610011995f, 0.723401845f},
-std::array<float,2>{0.374157548f, 0.612199008f},
-std::array<float,2>{0.676025212f, 0.292804152f},
-std::array<float,2>{0.209405333f, 0.103778668f},
-std::array<float,2>{0.802134275f, 0.971285224f},
-std::array<float,2>{0.257281959f, 0.787591755f},
-std::array<float,2>{0.718373597f, 0.237936437f},
-std::array<float,2>{0.170930445f, 0.452760816f},
-std::array<float,2>{0.863596439f, 0.682318866f},
-std::array<float,2>{0.0651838854f, 0.56074661f},
-std::array<float,2>{0.915852427f, 0.32576403f},
-std::array<float,2>{0.419519037f, 0.0110661881f},
-std::array<float,2>{0.525380969f, 0.927282751f},
-std::array<float,2>{0.249717489f, 0.946206272f},
-std::array<float,2>{0.759730875f, 0.0841634497f},
-std::array<float,2>{0.331355572f, 0.276307195f},
-std::array<float,2>{0.629823327f, 0.56577456f},
-std::array<float,2>{0.489998579f, 0.712863088f},
-std::array<float,2>{0.56854111f, 0.394905567f},
-std::array<float,2>{0.038418401f, 0.171785697f},
-std::array<float,2>{0.957697093f, 0.869119406f},
-std::array<float,2>{0.308699757f, 0.936618984f},
-std::array<float,2>{0.73779124f, 0.00488568423f},
-std::array<float,2>{0.145086288f, 0.318235546f},
-std::array<float,2>{0.826256633f, 0.55033201f},
-std::array<float,2>{0.106196709f, 0.679394782f},
-std::array<float,2>{0.895560801f, 0.443897754f},
-std::array<float,2>{0.402177751f, 0.243364379f},
-std::array<float,2>{0.556092322f, 0.793005764f},
-std::array<float,2>{0.216561928f, 0.85993576f},
-std::array<float,2>{0.811063588f, 0.163786188f},
-std::array<float,2>{0.364944547f, 0.402405858f},
-std::array<float,2>{0.683349967f, 0.706910551f},
-std::array<float,2>{0.449356675f, 0.575931311f},
-std::array<float,2>{0.621756494f, 0.272770345f},
-std::array<float,2>{0.0242797472f, 0.0865373909f},
-std::array<float,2>{0.975588858f, 0.940181375f},
-std::array<float,2>{0.412529498f, 0.780329943f},
-std::array<float,2>{0.520564377f, 0.202598169f},
-std::array<float,2>{0.074517481f, 0.471635789f},
-std::array<float,2>{0.912813544f, 0.650652826f},
-std::array<float,2>{0.162788451f, 0.529206574f},
-std::array<float,2>{0.870019615f, 0.346919f},
-std::array<float,2>{0.258957684f, 0.0459605604f},
-std::array<float,2>{0.706214964f, 0.905299664f},
-std::array<float,2>{0.0424419791f, 0.979937673f},
-std::array<float,2>{0.967723429f, 0.0963944122f},
-std::array<float,2>{0.494321257f, 0.282131582f},
-std::array<float,2>{0.576848984f, 0.624229252f},
-std::array<float,2>{0.340068549f, 0.727864325f},
-std::array<float,2>{0.639441729f, 0.420790642f},
-std::array<float,2>{0.237054512f, 0.136369914f},
-std::array<float,2>{0.752094865f, 0.84296906f},
-std::array<float,2>{0.470732719f, 0.953947246f},
-std::array<float,2>{0.581090748f, 0.0648025945f},
-std::array<float,2>{0.0530617535f, 0.263352603f},
-std::array<float,2>{0.946947634f, 0.58519125f},
-std::array<float,2>{0.226214513f, 0.693421543f},
-std::array<float,2>{0.766240239f, 0.383958608f},
-std::array<float,2>{0.327297866f, 0.171962008f},
-std::array<float,2>{0.64512831f, 0.852700233f},
-std::array<float,2>{0.0855599269f, 0.801025391f},
-std::array<float,2>{0.928565979f, 0.221895397f},
-std::array<float,2>{0.426554918f, 0.459174752f},
-std::array<float,2>{0.507762372f, 0.657186866f},
-std::array<float,2>{0.271262527f, 0.532983899f},
-std::array<float,2>{0.687653184f, 0.331984788f},
-std::array<float,2>{0.185733318f, 0.016403731f},
-std::array<float,2>{0.853495181f, 0.916407466f},
-std::array<float,2>{0.348047018f, 0.827084124f},
-std::array<float,2>{0.657185256f, 0.140868336f},
-std::array<float,2>{0.190241084f, 0.426680803f},
-std::array<float,2>{0.79353714f, 0.737229407f},
-std::array<float,2>{0.00947449729f, 0.594635904f},
-std::array<float,2>{0.986550987f, 0.302942157f},
-std::array<float,2>{0.456923872f, 0.111939251f},
-std::array<float,2>{0.599900007f, 0.996290028f},
-std::array<float,2>{0.139888287f, 0.883231938f},
-std::array<float,2>{0.83633858f, 0.0538201928f},
-std::array<float,2>{0.296670586f, 0.362927914f},
-std::array<float,2>{0.726935208f, 0.507829607f},
-std::array<float,2>{0.3771258f, 0.6388762f},
-std::array<float,2>{0.537214935f, 0.490379512f},
-std::array<float,2>{0.122381002f, 0.208361894f},
-std::array<float,2>{0.889835894f, 0.762771368f},
-std::array<float,2>{0.337905884f, 0.913536608f},
-std::array<float,2>{0.634755433f, 0.0309189055f},
-std::array<float,2>{0.240683481f, 0.339724004f},
-std::array<float,2>{0.756012022f, 0.541655183f},
-std::array<float,2>{0.0453389436f, 0.666424632f},
-std::array<float,2>{0.964538336f, 0.466446698f},
-std::array<float,2>{0.49788779f, 0.228625894f},
-std::array<float,2>{0.570519745f, 0.806577861f},
-std::array<float,2>{0.159419015f, 0.846733451f},
-std::array<float,2>{0.872815251f, 0.185055256f},
-std::array<float,2>{0.264025211f, 0.382495463f},
-std::array<float,2>{0.708093405f, 0.702748716f},
-std::array<float,2>{0.408525854f, 0.588797987f},
-std::array<float,2>{0.515645444f, 0.25590384f},
-std::array<float,2>{0.070858404f, 0.077017203f},
-std::array<float,2>{0.909142554f, 0.965765238f},
-std::array<float,2>{0.446087033f, 0.757030785f},
-std::array<float,2>{0.620080948f, 0.218016475f},
-std::array<float,2>{0.0300493818f, 0.499732018f},
-std::array<float,2>{0.969064653f, 0.626776814f},
-std::array<float,2>{0.212697744f, 0.507300079f},
-std::array<float,2>{0.807501793f, 0.373376667f},
-std::array<float,2>{0.359592468f, 0.0572722144f},
-std::array<float,2>{0.684564471f, 0.878988445f},
-std::array<float,2>{0.105295092f, 0.988475502f},
-std::array<float,2>{0.894076347f, 0.122198604f},
-std::array<float,2>{0.405801505f, 0.307518423f},
-std::array<float,2>{0.56031853f, 0.605359554f},
-std::array<float,2>{0.30773595f, 0.746501625f},
-std::array<float,2>{0.739485562f, 0.430319697f},
-std::array<float,2>{0.14398253f, 0.150799111f},
-std::array<float,2>{0.823736548f, 0.818287849f},
-std::array<float,2>{0.382665396f, 0.952341318f},
-std::array<float,2>{0.531412601f, 0.0810396597f},
-std::array<float,2>{0.119152978f, 0.278549552f},
-std::array<float,2>{0.885533988f, 0.568309844f},
-std::array<float,2>{0.135948092f, 0.715346813f},
-std::array<float,2>{0.842057049f, 0.391490787f},
-std::array<float,2>{0.292861015f, 0.165990844f},
-std::array<float,2>{0.731070638f, 0.873043954f},
-std::array<float,2>{0.0154709434f, 0.782630324f},
-std::array<float,2>{0.990275502f, 0.240275115f},
-std::array<float,2>{0.457408756f, 0.446084976f},
-std::array<float,2>{0.594173372f, 0.685372651f},
-std::array<float,2>{0.346701145f, 0.557123184f},
-std::array<float,2>{0.662619054f, 0.320739895f},
-std::array<float,2>{0.19377929f, 0.0130273234f},
-std::array<float,2>{0.792833567f, 0.925545394f},
-std::array<float,2>{0.266291767f, 0.835321903f},
-std::array<float,2>{0.695152223f, 0.129581273f},
-std::array<float,2>{0.182307094f, 0.413789332f},
-std::array<float,2>{0.857131183f, 0.720261633f},
-std::array<float,2>{0.0804900825f, 0.615718186f},
-std::array<float,2>{0.922850728f, 0.294698924f},
-std::array<float,2>{0.424941778f, 0.108653009f},
-std::array<float,2>{0.500229001f, 0.973439693f},
-std::array<float,2>{0.222241998f, 0.897836864f},
-std::array<float,2>{0.772818744f, 0.0323031954f},
-std::array<float,2>{0.320725143f, 0.352731287f},
-std::array<float,2>{0.644302845f, 0.5225088f},
-std::array<float,2>{0.473508477f, 0.647059679f},
-std::array<float,2>{0.583937347f, 0.480297565f},
-std::array<float,2>{0.0480060652f, 0.192713365f},
-std::array<float,2>{0.953037918f, 0.769700706f},
-std::array<float,2>{0.287342578f, 0.984248579f},
-std::array<float,2>{0.720128f, 0.101513922f},
-std::array<float,2>{0.126875684f, 0.288502604f},
-std::array<float,2>{0.828178108f, 0.618180931f},
-std::array<float,2>{0.115825363f, 0.733773768f},
-std::array<float,2>{0.877809346f, 0.416885406f},
-std::array<float,2>{0.387179226f, 0.139544383f},
-std::array<float,2>{0.544386089f, 0.837865889f},
-std::array<float,2>{0.202315822f, 0.777008295f},
-std::array<float,2>{0.787769258f, 0.197972491f},
-std::array<float,2>{0.352656722f, 0.47453779f},
-std::array<float,2>{0.668185234f, 0.655103624f},
-std::array<float,2>{0.465053141f, 0.525436282f},
-std::array<float,2>{0.602509618f, 0.350523889f},
-std::array<float,2>{0.00103740557f, 0.042154979f},
-std::array<float,2>{0.99926579f, 0.901225924f},
-std::array<float,2>{0.431119621f, 0.86429739f},
-std::array<float,2>{0.512097299f, 0.159596935f},
-std::array<float,2>{0.0894994736f, 0.400648862f},
-std::array<float,2>{0.931718946f, 0.707550466f},
-std::array<float,2>{0.174401432f, 0.574074745f},
-std::array<float,2>{0.84446609f, 0.266415209f},
-std::array<float,2>{0.275268763f, 0.0921328962f},
-std::array<float,2>{0.69554919f, 0.9436782f},
-std::array<float,2>{0.0618868656f, 0.932332456f},
-std::array<float,2>{0.943419456f, 0.00379349408f},
-std::array<float,2>{0.480091691f, 0.316358596f},
-std::array<float,2>{0.591092587f, 0.553526461f},
-std::array<float,2>{0.319608003f, 0.672104359f},
-std::array<float,2>{0.65158236f, 0.43788749f},
-std::array<float,2>{0.232955858f, 0.249246627f},
-std::array<float,2>{0.780405164f, 0.789580703f},
-std::array<float,2>{0.485423803f, 0.888204396f},
-std::array<float,2>{0.56536597f, 0.0472221673f},
-std::array<float,2>{0.0341160856f, 0.366864234f},
-std::array<float,2>{0.95585686f, 0.511734009f},
-std::array<float,2>{0.244164646f, 0.634334564f},
-std::array<float,2>{0.762994409f, 0.486264318f},
-std::array<float,2>{0.332610011f, 0.206926748f},
-std::array<float,2>{0.625783682f, 0.760159254f},
-std::array<float,2>{0.0677065402f, 0.823453665f},
-std::array<float,2>{0.919671237f, 0.144738853f},
-std::array<float,2>{0.417270511f, 0.425025374f},
-std::array<float,2>{0.530544698f, 0.741229236f},
-std::array<float,2>{0.252632499f, 0.600352347f},
-std::array<float,2>{0.711166739f, 0.298153877f},
-std::array<float,2>{0.16679661f, 0.117046893f},
-std::array<float,2>{0.859437406f, 0.993651211f},
-std::array<float,2>{0.368873864f, 0.799548805f},
-std::array<float,2>{0.675563693f, 0.223892018f},
-std::array<float,2>{0.20653148f, 0.453178734f},
-std::array<float,2>{0.799538791f, 0.664002061f},
-std::array<float,2>{0.0176681783f, 0.537397921f},
-std::array<float,2>{0.983630002f, 0.334083289f},
-std::array<float,2>{0.441907287f, 0.0205917377f},
-std::array<float,2>{0.616541207f, 0.920405686f},
-std::array<float,2>{0.152431518f, 0.959174633f},
-std::array<float,2>{0.812744975f, 0.0687032491f},
-std::array<float,2>{0.303415507f, 0.260235429f},
-std::array<float,2>{0.745698452f, 0.578198552f},
-std::array<float,2>{0.39585042f, 0.689264417f},
-std::array<float,2>{0.553059638f, 0.388661265f},
-std::array<float,2>{0.09637025f, 0.178530529f},
-std::array<float,2>{0.905223787f, 0.857249618f},
-std::array<float,2>{0.357182235f, 0.964141905f},
-std::array<float,2>{0.666085243f, 0.0738766268f},
-std::array<float,2>{0.197269455f, 0.252402067f},
-std::array<float,2>{0.785027087f, 0.591207087f},
-std::array<float,2>{0.00589614687f, 0.696789443f},
-std::array<float,2>{0.995921612f, 0.375837773f},
-std::array<float,2>{0.463922471f, 0.18165724f},
-std::array<float,2>{0.605539918f, 0.84828198f},
-std::array<float,2>{0.132551402f, 0.811033964f},
-std::array<float,2>{0.835796058f, 0.230964363f},
-std::array<float,2>{0.28428328f, 0.463213295f},
-std::array<float,2>{0.722858965f, 0.668566763f},
-std::array<float,2>{0.38649404f, 0.543964207f},
-std::array<float,2>{0.541752338f, 0.340051025f},
-std::array<float,2>{0.110539399f, 0.0235368926f},
-std::array<float,2>{0.87954396f, 0.909309864f},
-std::array<float,2>{0.483607471f, 0.815427542f},
-std::array<float,2>{0.587700784f, 0.154370353f},
-std::array<float,2>{0.0550353527f, 0.436912268f},
-std::array<float,2>{0.938429713f, 0.743365407f},
-std::array<float,2>{0.228627354f, 0.607177973f},
-std::array<float,2>{0.775067627f, 0.310375333f},
-std::array<float,2>{0.314880788f, 0.117306262f},
-std::array<float,2>{0.653521895f, 0.987951159f},
-std::array<float,2>{0.0936954096f, 0.877522886f},
-std::array<float,2>{0.936940372f, 0.0617582649f},
-std::array<float,2>{0.436448187f, 0.367276847f},
-std::array<float,2>{0.509164393f, 0.500103235f},
-std::array<float,2>{0.27870816f, 0.630376339f},
-std::array<float,2>{0.701649547f, 0.492678642f},
-std::array<float,2>{0.177754164f, 0.214224979f},
-std::array<float,2>{0.850936353f, 0.753837407f},
-std::array<float,2>{0.421299458f, 0.927807927f},
-std::array<float,2>{0.526889503f, 0.00792711508f},
-std::array<float,2>{0.0633121952f, 0.327134907f},
-std::array<float,2>{0.916300952f, 0.560193777f},
-std::array<float,2>{0.167981595f, 0.680554748f},
-std::array<float,2>{0.866067529f, 0.450774819f},
-std::array<float,2>{0.255791277f, 0.235505119f},
-std::array<float,2>{0.716061592f, 0.786806107f},
-std::array<float,2>{0.0361281298f, 0.869586766f},
-std::array<float,2>{0.959886849f, 0.168258339f},
-std::array<float,2>{0.490813941f, 0.398004919f},
-std::array<float,2>{0.56662637f, 0.713474154f},
-std::array<float,2>{0.328722984f, 0.563438296f},
-std::array<float,2>{0.631577909f, 0.273588687f},
-std::array<float,2>{0.247896686f, 0.0825398788f},
-std::array<float,2>{0.761281788f, 0.949083328f},
-std::array<float,2>{0.29962039f, 0.766962826f},
-std::array<float,2>{0.746405959f, 0.191073924f},
-std::array<float,2>{0.15095605f, 0.482816249f},
-std::array<float,2>{0.817090392f, 0.642741919f},
-std::array<float,2>{0.0980437994f, 0.518692672f},
-std::array<float,2>{0.899021745f, 0.358728528f},
-std::array<float,2>{0.393445462f, 0.0358247235f},
-std::array<float,2>{0.550528347f, 0.89299345f},
-std::array<float,2>{0.208930895f, 0.970527351f},
-std::array<float,2>{0.80435437f, 0.103394277f},
-std::array<float,2>{0.371447682f, 0.289069951f},
-std::array<float,2>{0.678844512f, 0.610873282f},
-std::array<float,2>{0.440909058f, 0.72574991f},
-std::array<float,2>{0.612886488f, 0.406522572f},
-std::array<float,2>{0.0232506339f, 0.125206307f},
-std::array<float,2>{0.979603827f, 0.830907822f},
-std::array<float,2>{0.260046422f, 0.903804004f},
-std::array<float,2>{0.705038786f, 0.0443785116f},
-std::array<float,2>{0.161121249f, 0.343756288f},
-std::array<float,2>{0.867461264f, 0.529626608f},
-std::array<float,2>{0.0767308623f, 0.649898946f},
-std::array<float,2>{0.91160059f, 0.469840556f},
-std::array<float,2>{0.410575151f, 0.200439245f},
-std::array<float,2>{0.522668004f, 0.778178632f},
-std::array<float,2>{0.236118242f, 0.840493619f},
-std::array<float,2>{0.750142395f, 0.133974656f},
-std::array<float,2>{0.343300611f, 0.419773877f},
-std::array<float,2>{0.638057172f, 0.730307043f},
-std::array<float,2>{0.493034512f, 0.623007655f},
-std::array<float,2>{0.576095879f, 0.284385204f},
-std::array<float,2>{0.0398346484f, 0.0954316184f},
-std::array<float,2>{0.965469539f, 0.977923214f},
-std::array<float,2>{0.39901343f, 0.795580804f},
-std::array<float,2>{0.557903588f, 0.246051148f},
-std::array<float,2>{0.107607007f, 0.443013161f},
-std::array<float,2>{0.897553205f, 0.676468611f},
-std::array<float,2>{0.146752983f, 0.546910465f},
-std::array<float,2>{0.825420499f, 0.319470555f},
-std::array<float,2>{0.311045736f, 0.00677706255f},
-std::array<float,2>{0.73552978f, 0.934820294f},
-std::array<float,2>{0.0259729177f, 0.938788593f},
-std::array<float,2>{0.973144531f, 0.0883068219f},
-std::array<float,2>{0.452040076f, 0.27130416f},
-std::array<float,2>{0.623254657f, 0.578014076f},
-std::array<float,2>{0.367079109f, 0.704864085f},
-std::array<float,2>{0.680726767f, 0.406211406f},
-std::array<float,2>{0.217301622f, 0.160830751f},
-std::array<float,2>{0.810188174f, 0.863257229f},
-std::array<float,2>{0.454977006f, 0.999162197f},
-std::array<float,2>{0.598577857f, 0.110970512f},
-std::array<float,2>{0.0100323893f, 0.301261038f},
-std::array<float,2>{0.984931648f, 0.595836043f},
-std::array<float,2>{0.188541025f, 0.735615432f},
-std::array<float,2>{0.796825171f, 0.428683668f},
-std::array<float,2>{0.350541621f, 0.142916039f},
-std::array<float,2>{0.658501923f, 0.825651467f},
-std::array<float,2>{0.124768563f, 0.764385104f},
-std::array<float,2>{0.887698829f, 0.210349739f},
-std::array<float,2>{0.375445962f, 0.488441974f},
-std::array<float,2>{0.536141932f, 0.637606144f},
-std::array<float,2>{0.294397056f, 0.511218369f},
-std::array<float,2>{0.730449975f, 0.359619319f},
-std::array<float,2>{0.137273073f, 0.0511061065f},
-std::array<float,2>{0.838110507f, 0.885347486f},
-std::array<float,2>{0.324857861f, 0.853541672f},
-std::array<float,2>{0.647111475f, 0.17453146f},
-std::array<float,2>{0.22433193f, 0.38502574f},
-std::array<float,2>{0.769435227f, 0.692002296f},
-std::array<float,2>{0.0519484878f, 0.582463145f},
-std::array<float,2>{0.949192941f, 0.26410225f},
-std::array<float,2>{0.470291674f, 0.0640609115f},
-std::array<float,2>{0.579402506f, 0.955917537f},
-std::array<float,2>{0.184033245f, 0.915848792f},
-std::array<float,2>{0.854996324f, 0.0178528018f},
-std::array<float,2>{0.27197361f, 0.329455316f},
-std::array<float,2>{0.691401124f, 0.534870982f},
-std::array<float,2>{0.428487062f, 0.660110712f},
-std::array<float,2>{0.50532943f, 0.457146466f},
-std::array<float,2>{0.0830156133f, 0.21919331f},
-std::array<float,2>{0.927348197f, 0.803607285f},
-std::array<float,2>{0.321568221f, 0.895078778f},
-std::array<float,2>{0.643007159f, 0.0350502767f},
-std::array<float,2>{0.22080493f, 0.354001909f},
-std::array<float,2>{0.771547914f, 0.519567907f},
-std::array<float,2>{0.0475268513f, 0.644906461f},
-std::array<float,2>{0.951562703f, 0.477476448f},
-std::array<float,2>{0.474448979f, 0.195223793f},
-std::array<float,2>{0.582688749f, 0.772070169f},
-std::array<float,2>{0.182770178f, 0.833250105f},
-std::array<float,2>{0.856260359f, 0.132758752f},
-std::array<float,2>{0.267057925f, 0.411902726f},
-std::array<float,2>{0.693793237f, 0.722550929f},
-std::array<float,2>{0.424557f, 0.615113914f},
-std::array<float,2>{0.501415074f, 0.29580757f},
-std::array<float,2>{0.0814525634f, 0.10561391f},
-std::array<float,2>{0.923078537f, 0.974776983f},
-std::array<float,2>{0.45822081f, 0.78508532f},
-std::array<float,2>{0.595619023f, 0.238331243f},
-std::array<float,2>{0.0140404673f, 0.449063301f},
-std::array<float,2>{0.991222501f, 0.685843766f},
-std::array<float,2>{0.194596559f, 0.555675924f},
-std::array<float,2>{0.791131437f, 0.323364675f},
-std::array<float,2>{0.346099377f, 0.0149276778f},
-std::array<float,2>{0.663273096f, 0.923532069f},
-std::array<float,2>{0.12097346f, 0.950109184f},
-std::array<float,2>{0.886570573f, 0.0793603584f},
-std::array<float,2>{0.381243736f, 0.280866414f},
-std::array<float,2>{0.533159733f, 0.569043398f},
-std::array<float,2>{0.29189083f, 0.718506575f},
-std::array<float,2>{0.731675506f, 0.393681645f},
-std::array<float,2>{0.135047197f, 0.167106166f},
-std::array<float,2>{0.843258798f, 0.87489754f},
-std::array<float,2>{0.404329389f, 0.99121505f},
-std::array<float,2>{0.558713257f, 0.124079362f},
-std::array<float,2>{0.103777625f, 0.30489248f},
-std::array<float,2>{0.892970979f, 0.602669597f},
-std::array<float,2>{0.142786726f, 0.749785364f},
-std::array<float,2>{0.822333276f, 0.431857347f},
-std::array<float,2>{0.307020187f, 0.149605647f},
-std::array<float,2>{0.739186525f, 0.820141554f},
-std::array<float,2>{0.0311444458f, 0.755236804f},
-std::array<float,2>{0.970135748f, 0.21645321f},
-std::array<float,2>{0.446768582f, 0.497768819f},
-std::array<float,2>{0.62065345f, 0.627080619f},
-std::array<float,2>{0.360845119f, 0.504324436f},
-std::array<float,2>{0.684858918f, 0.371262074f},
-std::array<float,2>{0.211840615f, 0.0548524335f},
-std::array<float,2>{0.807767868f, 0.882689953f},
-std::array<float,2>{0.264962852f, 0.844427049f},
-std::array<float,2>{0.707118213f, 0.186124846f},
-std::array<float,2>{0.159089416f, 0.38004005f},
-std::array<float,2>{0.871194303f, 0.700917661f},
-std::array<float,2>{0.0722525194f, 0.587117672f},
-std::array<float,2>{0.909584522f, 0.255847156f},
-std::array<float,2>{0.409377813f, 0.0742834434f},
-std::array<float,2>{0.516726732f, 0.96874404f},
-std::array<float,2>{0.241518915f, 0.91183269f},
-std::array<float,2>{0.757487655f, 0.027953105f},
-std::array<float,2>{0.339019179f, 0.337763995f},
-std::array<float,2>{0.632959247f, 0.540441513f},
-std::array<float,2>{0.496664196f, 0.665272176f},
-std::array<float,2>{0.57212615f, 0.468263716f},
-std::array<float,2>{0.0463255979f, 0.226854801f},
-std::array<float,2>{0.963273108f, 0.808330834f},
-std::array<float,2>{0.30461967f, 0.958507359f},
-std::array<float,2>{0.744973898f, 0.0683366358f},
-std::array<float,2>{0.153438479f, 0.259464025f},
-std::array<float,2>{0.813630342f, 0.581317604f},
-std::array<float,2>{0.0973548293f, 0.690592825f},
-std::array<float,2>{0.905522823f, 0.389774054f},
-std::array<float,2>{0.395296514f, 0.177414149f},
-std::array<float,2>{0.554022431f, 0.858189881f},
-std::array<float,2>{0.205727652f, 0.797471166f},
-std::array<float,2>{0.800630212f, 0.225601286f},
-std::array<float,2>{0.36809352f, 0.456450343f},
-std::array<float,2>{0.674798727f, 0.660487533f},
-std::array<float,2>{0.442557812f, 0.536448359f},
-std::array<float,2>{0.61524564f, 0.333409995f},
-std::array<float,2>{0.0191966053f, 0.0220361277f},
-std::array<float,2>{0.983295858f, 0.919730484f},
-std::array<float,2>{0.41620326f, 0.8211689f},
-std::array<float,2>{0.529546499f, 0.147329167f},
-std::array<float,2>{0.0667871684f, 0.422497988f},
-std::array<float,2>{0.918381989f, 0.738974035f},
-std::array<float,2>{0.167632535f, 0.599364817f},
-std::array<float,2>{0.860608518f, 0.30023697f},
-std::array<float,2>{0.253436983f, 0.11428868f},
-std::array<float,2>{0.712848842f, 0.995101392f},
-std::array<float,2>{0.0344253182f, 0.889755189f},
-std::array<float,2>{0.956500471f, 0.0501801707f},
-std::array<float,2>{0.484539807f, 0.363612473f},
-std::array<float,2>{0.565926969f, 0.515302002f},
-std::array<float,2>{0.333833575f, 0.635816276f},
-std::array<float,2>{0.626280606f, 0.486608952f},
-std::array<float,2>{0.24571304f, 0.204375491f},
-std::array<float,2>{0.762616158f, 0.759138942f},
-std::array<float,2>{0.478787005f, 0.930168092f},
-std::array<float,2>{0.589878619f, 0.000186912628f},
-std::array<float,2>{0.061480239f, 0.314127058f},
-std::array<float,2>{0.944434404f, 0.551102519f},
-std::array<float,2>{0.233480304f, 0.675364494f},
-std::array<float,2>{0.779856622f, 0.440347105f},
-std::array<float,2>{0.318541199f, 0.246608257f},
-std::array<float,2>{0.650902689f, 0.79141736f},
-std::array<float,2>{0.0882761404f, 0.866012216f},
-std::array<float,2>{0.932629168f, 0.157980829f},
-std::array<float,2>{0.429808378f, 0.399088383f},
-std::array<float,2>{0.512790799f, 0.709186018f},
-std::array<float,2>{0.273790956f, 0.571000278f},
-std::array<float,2>{0.697101057f, 0.268089741f},
-std::array<float,2>{0.175660536f, 0.091526255f},
-std::array<float,2>{0.845049858f, 0.94237715f},
-std::array<float,2>{0.351656318f, 0.773596585f},
-std::array<float,2>{0.669139087f, 0.195328578f},
-std::array<float,2>{0.201599777f, 0.476346195f},
-std::array<float,2>{0.788461804f, 0.652541518f},
-std::array<float,2>{0.00096549181f, 0.525165737f},
-std::array<float,2>{0.998257041f, 0.348808855f},
-std::array<float,2>{0.466691881f, 0.0404107384f},
-std::array<float,2>{0.60294956f, 0.89914453f},
-std::array<float,2>{0.125549361f, 0.980544031f},
-std::array<float,2>{0.829790711f, 0.0989774913f},
-std::array<float,2>{0.288672805f, 0.285420775f},
-std::array<float,2>{0.718767285f, 0.619777381f},
-std::array<float,2>{0.388246775f, 0.731446385f},
-std::array<float,2>{0.543617547f, 0.415021449f},
-std::array<float,2>{0.116394967f, 0.136964038f},
-std::array<float,2>{0.878849328f, 0.839108646f},
-std::array<float,2>{0.372376412f, 0.972104907f},
-std::array<float,2>{0.678121746f, 0.105285838f},
-std::array<float,2>{0.207859308f, 0.291501462f},
-std::array<float,2>{0.803179741f, 0.613272905f},
-std::array<float,2>{0.0220961906f, 0.724203944f},
-std::array<float,2>{0.979146719f, 0.408268988f},
-std::array<float,2>{0.439664006f, 0.127398685f},
-std::array<float,2>{0.612100542f, 0.829028904f},
-std::array<float,2>{0.151497111f, 0.768671513f},
-std::array<float,2>{0.818200111f, 0.189048484f},
-std::array<float,2>{0.300174981f, 0.481473863f},
-std::array<float,2>{0.748045683f, 0.640753925f},
-std::array<float,2>{0.393950999f, 0.517178655f},
-std::array<float,2>{0.549485743f, 0.357257098f},
-std::array<float,2>{0.0989201963f, 0.0375608951f},
-std::array<float,2>{0.900188804f, 0.892157018f},
-std::array<float,2>{0.492147148f, 0.867628753f},
-std::array<float,2>{0.567852259f, 0.170410261f},
-std::array<float,2>{0.0367417f, 0.39624548f},
-std::array<float,2>{0.960314572f, 0.710943639f},
-std::array<float,2>{0.246931151f, 0.564651132f},
-std::array<float,2>{0.76025635f, 0.27654621f},
-std::array<float,2>{0.329910874f, 0.0858395547f},
-std::array<float,2>{0.632044375f, 0.946541846f},
-std::array<float,2>{0.0637459382f, 0.926294327f},
-std::array<float,2>{0.917075932f, 0.0103204492f},
-std::array<float,2>{0.419957638f, 0.325082213f},
-std::array<float,2>{0.526095152f, 0.561647117f},
-std::array<float,2>{0.25416711f, 0.68265456f},
-std::array<float,2>{0.715740144f, 0.451258481f},
-std::array<float,2>{0.169005841f, 0.237090588f},
-std::array<float,2>{0.867017508f, 0.788378716f},
-std::array<float,2>{0.436755508f, 0.876623333f},
-std::array<float,2>{0.508652806f, 0.059218049f},
-std::array<float,2>{0.0927678868f, 0.369190156f},
-std::array<float,2>{0.93605572f, 0.502425134f},
-std::array<float,2>{0.179475337f, 0.63176465f},
-std::array<float,2>{0.849996507f, 0.494650811f},
-std::array<float,2>{0.277569413f, 0.212843806f},
-std::array<float,2>{0.702877939f, 0.751899421f},
-std::array<float,2>{0.0563547015f, 0.814446211f},
-std::array<float,2>{0.939228773f, 0.153576151f},
-std::array<float,2>{0.483202606f, 0.434732825f},
-std::array<float,2>{0.586107731f, 0.74533844f},
-std::array<float,2>{0.315636367f, 0.607705355f},
-std::array<float,2>{0.653242052f, 0.311481833f},
-std::array<float,2>{0.229842678f, 0.120463483f},
-std::array<float,2>{0.774252295f, 0.985112369f},
-std::array<float,2>{0.284087718f, 0.810322225f},
-std::array<float,2>{0.724402487f, 0.233572185f},
-std::array<float,2>{0.131807193f, 0.461178899f},
-std::array<float,2>{0.834667563f, 0.670556486f},
-std::array<float,2>{0.109448582f, 0.546641886f},
-std::array<float,2>{0.88083154f, 0.342012823f},
-std::array<float,2>{0.385677665f, 0.0257469043f},
-std::array<float,2>{0.542948604f, 0.907208085f},
-std::array<float,2>{0.198434398f, 0.961470246f},
-std::array<float,2>{0.78411901f, 0.0719590932f},
-std::array<float,2>{0.355823487f, 0.251392156f},
-std::array<float,2>{0.66765666f, 0.593479812f},
-std::array<float,2>{0.46347928f, 0.699148536f},
-std::array<float,2>{0.606817245f, 0.378002435f},
-std::array<float,2>{0.00686215283f, 0.18131119f},
-std::array<float,2>{0.994815707f, 0.851338029f},
-std::array<float,2>{0.272918791f, 0.917459011f},
-std::array<float,2>{0.689691663f, 0.0166452508f},
-std::array<float,2>{0.184862912f, 0.330952287f},
-std::array<float,2>{0.854351938f, 0.53214246f},
-std::array<float,2>{0.0825380087f, 0.657340944f},
-std::array<float,2>{0.926009715f, 0.460651338f},
-std::array<float,2>{0.42910099f, 0.220991835f},
-std::array<float,2>{0.504627585f, 0.802390099f},
-std::array<float,2>{0.223017201f, 0.852240622f},
-std::array<float,2>{0.768185914f, 0.173816413f},
-std::array<float,2>{0.325298399f, 0.382987946f},
-std::array<float,2>{0.647766232f, 0.694459975f},
-std::array<float,2>{0.469036937f, 0.584404647f},
-std::array<float,2>{0.578536153f, 0.262426019f},
-std::array<float,2>{0.0516464077f, 0.0662839636f},
-std::array<float,2>{0.947856724f, 0.954827428f},
-std::array<float,2>{0.376790911f, 0.762650728f},
-std::array<float,2>{0.53612107f, 0.207931474f},
-std::array<float,2>{0.123483874f, 0.49205786f},
-std::array<float,2>{0.886938512f, 0.640611589f},
-std::array<float,2>{0.138116568f, 0.508986592f},
-std::array<float,2>{0.838887036f, 0.361985177f},
-std::array<float,2>{0.293433547f, 0.0536834374f},
-std::array<float,2>{0.728914857f, 0.884567559f},
-std::array<float,2>{0.011626279f, 0.997350633f},
-std::array<float,2>{0.985975146f, 0.112807125f},
-std::array<float,2>{0.454009593f, 0.304619044f},
-std::array<float,2>{0.598874986f, 0.595425069f},
-std::array<float,2>{0.35062325f, 0.738253891f},
-std::array<float,2>{0.659877121f, 0.427639574f},
-std::array<float,2>{0.188114241f, 0.142180547f},
-std::array<float,2>{0.79579246f, 0.82772696f},
-std::array<float,2>{0.452986538f, 0.940874338f},
-std::array<float,2>{0.624712348f, 0.0872788951f},
-std::array<float,2>{0.0268907528f, 0.272019327f},
-std::array<float,2>{0.974000633f, 0.574923098f},
-std::array<float,2>{0.217840299f, 0.705149531f},
-std::array<float,2>{0.80934763f, 0.403557122f},
-std::array<float,2>{0.365811676f, 0.162711307f},
-std::array<float,2>{0.679759324f, 0.860625267f},
-std::array<float,2>{0.108661667f, 0.794417143f},
-std::array<float,2>{0.896678329f, 0.242786214f},
-std::array<float,2>{0.399461448f, 0.445002615f},
-std::array<float,2>{0.557496667f, 0.67847997f},
-std::array<float,2>{0.312211633f, 0.549468219f},
-std::array<float,2>{0.73509258f, 0.316756934f},
-std::array<float,2>{0.148395583f, 0.00417998293f},
-std::array<float,2>{0.824532568f, 0.936199009f},
-std::array<float,2>{0.342445016f, 0.84239161f},
-std::array<float,2>{0.6372087f, 0.135281235f},
-std::array<float,2>{0.235031188f, 0.421324074f},
-std::array<float,2>{0.751324058f, 0.727184772f},
-std::array<float,2>{0.0403503552f, 0.623716593f},
-std::array<float,2>{0.965941846f, 0.28316015f},
-std::array<float,2>{0.493470818f, 0.0967020616f},
-std::array<float,2>{0.574770868f, 0.978967488f},
-std::array<float,2>{0.161396742f, 0.904361784f},
-std::array<float,2>{0.868945837f, 0.0452544838f},
-std::array<float,2>{0.261017084f, 0.346643388f},
-std::array<float,2>{0.703248501f, 0.52778548f},
-std::array<float,2>{0.411779523f, 0.651495636f},
-std::array<float,2>{0.522303045f, 0.472236753f},
-std::array<float,2>{0.0780790225f, 0.201790705f},
-std::array<float,2>{0.910870373f, 0.779715598f},
-std::array<float,2>{0.345607668f, 0.924666286f},
-std::array<float,2>{0.660872698f, 0.0117499214f},
-std::array<float,2>{0.191998333f, 0.321649402f},
-std::array<float,2>{0.790572941f, 0.558260381f},
-std::array<float,2>{0.0134547381f, 0.684418261f},
-std::array<float,2>{0.988980651f, 0.446360201f},
-std::array<float,2>{0.459581941f, 0.241505027f},
-std::array<float,2>{0.595750272f, 0.781868339f},
-std::array<float,2>{0.132849917f, 0.871987104f},
-std::array<float,2>{0.840857923f, 0.16439864f},
-std::array<float,2>{0.289134383f, 0.391725957f},
-std::array<float,2>{0.733406961f, 0.71645242f},
-std::array<float,2>{0.379497945f, 0.567129672f},
-std::array<float,2>{0.534339845f, 0.278218389f},
-std::array<float,2>{0.117354639f, 0.0816317573f},
-std::array<float,2>{0.883519888f, 0.951482832f},
-std::array<float,2>{0.475740284f, 0.77095741f},
-std::array<float,2>{0.584026456f, 0.19193925f},
-std::array<float,2>{0.0504520051f, 0.478893101f},
-std::array<float,2>{0.949841261f, 0.648147821f},
-std::array<float,2>{0.219890922f, 0.521502078f},
-std::array<float,2>{0.769644737f, 0.351946265f},
-std::array<float,2>{0.324024916f, 0.0313276425f},
-std::array<float,2>{0.642502189f, 0.896631479f},
-std::array<float,2>{0.0791257173f, 0.973995984f},
-std::array<float,2>{0.92520386f, 0.107837416f},
-std::array<float,2>{0.423295408f, 0.293331683f},
-std::array<float,2>{0.502013862f, 0.616503596f},
-std::array<float,2>{0.268516868f, 0.718956947f},
-std::array<float,2>{0.693286002f, 0.413037419f},
-std::array<float,2>{0.179924056f, 0.130508065f},
-std::array<float,2>{0.857887268f, 0.834019125f},
-std::array<float,2>{0.407409996f, 0.966609299f},
-std::array<float,2>{0.5190593f, 0.0776285529f},
-std::array<float,2>{0.0731161684f, 0.25724709f},
-std::array<float,2>{0.906527042f, 0.589256346f},
-std::array<float,2>{0.156322241f, 0.701216877f},
-std::array<float,2>{0.873093247f, 0.381591767f},
-std::array<float,2>{0.263441801f, 0.184164807f},
-std::array<float,2>{0.710053682f, 0.84657824f},
-std::array<float,2>{0.0445923842f, 0.804905236f},
-std::array<float,2>{0.96186924f, 0.230220601f},
-std::array<float,2>{0.499467224f, 0.465425998f},
-std::array<float,2>{0.572459817f, 0.667366743f},
-std::array<float,2>{0.336308599f, 0.542882979f},
-std::array<float,2>{0.635634005f, 0.338247567f},
-std::array<float,2>{0.239370316f, 0.0295889042f},
-std::array<float,2>{0.75451237f, 0.912308633f},
-std::array<float,2>{0.306561917f, 0.817306101f},
-std::array<float,2>{0.741005659f, 0.152213827f},
-std::array<float,2>{0.142414182f, 0.431039304f},
-std::array<float,2>{0.820438266f, 0.747739911f},
-std::array<float,2>{0.101786539f, 0.603747487f},
-std::array<float,2>{0.891368151f, 0.308206707f},
-std::array<float,2>{0.40426603f, 0.121222682f},
-std::array<float,2>{0.562377989f, 0.989316702f},
-std::array<float,2>{0.213678345f, 0.879959524f},
-std::array<float,2>{0.806132793f, 0.0584368929f},
-std::array<float,2>{0.363015085f, 0.37494728f},
-std::array<float,2>{0.686037719f, 0.506207883f},
-std::array<float,2>{0.447398156f, 0.625635207f},
-std::array<float,2>{0.618938446f, 0.498329908f},
-std::array<float,2>{0.0288039297f, 0.217144877f},
-std::array<float,2>{0.970822334f, 0.756034017f},
-std::array<float,2>{0.251100361f, 0.992642939f},
-std::array<float,2>{0.71400398f, 0.116024084f},
-std::array<float,2>{0.164077505f, 0.296905637f},
-std::array<float,2>{0.862078905f, 0.601069331f},
-std::array<float,2>{0.0693063959f, 0.741171956f},
-std::array<float,2>{0.920076668f, 0.424100369f},
-std::array<float,2>{0.414277941f, 0.145867303f},
-std::array<float,2>{0.529084027f, 0.823061287f},
-std::array<float,2>{0.243259117f, 0.761651695f},
-std::array<float,2>{0.764211893f, 0.205447823f},
-std::array<float,2>{0.334082156f, 0.485226095f},
-std::array<float,2>{0.62815845f, 0.633462965f},
-std::array<float,2>{0.487232059f, 0.513447046f},
-std::array<float,2>{0.56302321f, 0.365654737f},
-std::array<float,2>{0.0320628509f, 0.0484701023f},
-std::array<float,2>{0.953669131f, 0.886951029f},
-std::array<float,2>{0.396866381f, 0.855773807f},
-std::array<float,2>{0.551994264f, 0.178981319f},
-std::array<float,2>{0.0955101699f, 0.387321502f},
-std::array<float,2>{0.90333128f, 0.688337028f},
-std::array<float,2>{0.155834988f, 0.579406977f},
-std::array<float,2>{0.816147447f, 0.260767519f},
-std::array<float,2>{0.302378893f, 0.0701330453f},
-std::array<float,2>{0.743856788f, 0.96027267f},
-std::array<float,2>{0.0170354489f, 0.921037078f},
-std::array<float,2>{0.982132256f, 0.0199772455f},
-std::array<float,2>{0.443825394f, 0.335336626f},
-std::array<float,2>{0.614200115f, 0.538124561f},
-std::array<float,2>{0.369766355f, 0.663042367f},
-std::array<float,2>{0.672428131f, 0.454107672f},
-std::array<float,2>{0.204172969f, 0.223631546f},
-std::array<float,2>{0.798550606f, 0.800387025f},
-std::array<float,2>{0.466956377f, 0.902138114f},
-std::array<float,2>{0.603807926f, 0.0410505012f},
-std::array<float,2>{0.00358964573f, 0.351195067f},
-std::array<float,2>{0.997241855f, 0.526883245f},
-std::array<float,2>{0.199410573f, 0.656127036f},
-std::array<float,2>{0.785857022f, 0.47299552f},
-std::array<float,2>{0.353928447f, 0.198435724f},
-std::array<float,2>{0.670912445f, 0.775406957f},
-std::array<float,2>{0.113730945f, 0.836171925f},
-std::array<float,2>{0.875433028f, 0.139806077f},
-std::array<float,2>{0.388742477f, 0.417311043f},
-std::array<float,2>{0.546307743f, 0.733368933f},
-std::array<float,2>{0.285666466f, 0.617187619f},
-std::array<float,2>{0.721687019f, 0.287528008f},
-std::array<float,2>{0.128892556f, 0.100402825f},
-std::array<float,2>{0.830406964f, 0.982913554f},
-std::array<float,2>{0.317696542f, 0.790642917f},
-std::array<float,2>{0.648921371f, 0.248092502f},
-std::array<float,2>{0.231254995f, 0.438860118f},
-std::array<float,2>{0.777700782f, 0.673652649f},
-std::array<float,2>{0.0597675927f, 0.554619193f},
-std::array<float,2>{0.94162631f, 0.315063298f},
-std::array<float,2>{0.478048712f, 0.00255810982f},
-std::array<float,2>{0.592190921f, 0.933321595f},
-std::array<float,2>{0.173437208f, 0.944424689f},
-std::array<float,2>{0.846290946f, 0.092834577f},
-std::array<float,2>{0.276755154f, 0.266793668f},
-std::array<float,2>{0.697821319f, 0.572853684f},
-std::array<float,2>{0.432623029f, 0.708230495f},
-std::array<float,2>{0.514092922f, 0.401467383f},
-std::array<float,2>{0.0875725076f, 0.158792078f},
-std::array<float,2>{0.930985093f, 0.863978505f},
-std::array<float,2>{0.330780745f, 0.947308242f},
-std::array<float,2>{0.630734146f, 0.0836271122f},
-std::array<float,2>{0.249014795f, 0.275015503f},
-std::array<float,2>{0.758272052f, 0.564115047f},
-std::array<float,2>{0.0378424004f, 0.714797258f},
-std::array<float,2>{0.95865196f, 0.396942228f},
-std::array<float,2>{0.48873955f, 0.169282928f},
-std::array<float,2>{0.570174336f, 0.870299697f},
-std::array<float,2>{0.170636043f, 0.785881221f},
-std::array<float,2>{0.864497006f, 0.234717473f},
-std::array<float,2>{0.256310463f, 0.449250519f},
-std::array<float,2>{0.717171967f, 0.681401253f},
-std::array<float,2>{0.418382257f, 0.559428215f},
-std::array<float,2>{0.524297535f, 0.327557266f},
-std::array<float,2>{0.0657836422f, 0.00895333942f},
-std::array<float,2>{0.914370358f, 0.928945363f},
-std::array<float,2>{0.439348996f, 0.831068218f},
-std::array<float,2>{0.610860884f, 0.12632446f},
-std::array<float,2>{0.0196687561f, 0.407255679f},
-std::array<float,2>{0.977514863f, 0.724906981f},
-std::array<float,2>{0.210334525f, 0.609759867f},
-std::array<float,2>{0.801657796f, 0.29013443f},
-std::array<float,2>{0.373289943f, 0.101564713f},
-std::array<float,2>{0.677327931f, 0.969685733f},
-std::array<float,2>{0.100306816f, 0.89375335f},
-std::array<float,2>{0.902164638f, 0.0364177451f},
-std::array<float,2>{0.391784608f, 0.358380646f},
-std::array<float,2>{0.547915161f, 0.517907441f},
-std::array<float,2>{0.298492521f, 0.644305527f},
-std::array<float,2>{0.748886883f, 0.484127402f},
-std::array<float,2>{0.150034592f, 0.190387785f},
-std::array<float,2>{0.819585264f, 0.766377568f},
-std::array<float,2>{0.383443922f, 0.908494771f},
-std::array<float,2>{0.540802121f, 0.0245025158f},
-std::array<float,2>{0.111475423f, 0.341095209f},
-std::array<float,2>{0.881927788f, 0.543542445f},
-std::array<float,2>{0.129474148f, 0.669059277f},
-std::array<float,2>{0.832427144f, 0.464751184f},
-std::array<float,2>{0.282835245f, 0.232391074f},
-std::array<float,2>{0.725621402f, 0.811944485f},
-std::array<float,2>{0.00428428128f, 0.84878844f},
-std::array<float,2>{0.993759871f, 0.182720542f},
-std::array<float,2>{0.461074054f, 0.376038283f},
-std::array<float,2>{0.609247506f, 0.695414901f},
-std::array<float,2>{0.357664496f, 0.590499938f},
-std::array<float,2>{0.66580385f, 0.253773183f},
-std::array<float,2>{0.196653694f, 0.0724628866f},
-std::array<float,2>{0.781517029f, 0.963245749f},
-std::array<float,2>{0.281011194f, 0.752722263f},
-std::array<float,2>{0.700557411f, 0.213707492f},
-std::array<float,2>{0.177447692f, 0.493830979f},
-std::array<float,2>{0.848806083f, 0.629815817f},
-std::array<float,2>{0.0907085687f, 0.501329899f},
-std::array<float,2>{0.934073687f, 0.368758529f},
-std::array<float,2>{0.434541553f, 0.0613370128f},
-std::array<float,2>{0.511527359f, 0.878314853f},
-std::array<float,2>{0.228049502f, 0.987162888f},
-std::array<float,2>{0.777153909f, 0.118840724f},
-std::array<float,2>{0.314301521f, 0.30879882f},
-std::array<float,2>{0.655343771f, 0.606178045f},
-std::array<float,2>{0.482017249f, 0.742706299f},
-std::array<float,2>{0.588943183f, 0.436333507f},
-std::array<float,2>{0.0582546182f, 0.155697316f},
-std::array<float,2>{0.939823329f, 0.816063643f},
-std::array<float,2>{0.295739055f, 0.886137724f},
-std::array<float,2>{0.727828205f, 0.0522423722f},
-std::array<float,2>{0.139143541f, 0.360361129f},
-std::array<float,2>{0.837171674f, 0.509920239f},
-std::array<float,2>{0.12134479f, 0.637868643f},
-std::array<float,2>{0.889604867f, 0.489598334f},
-std::array<float,2>{0.377952546f, 0.209870026f},
-std::array<float,2>{0.538874686f, 0.764730752f},
-std::array<float,2>{0.190547884f, 0.824922442f},
-std::array<float,2>{0.794111431f, 0.144329444f},
-std::array<float,2>{0.348715752f, 0.429522425f},
-std::array<float,2>{0.657937407f, 0.734999299f},
-std::array<float,2>{0.455692142f, 0.597637355f},
-std::array<float,2>{0.601150513f, 0.302711576f},
-std::array<float,2>{0.00835910067f, 0.110259354f},
-std::array<float,2>{0.987512708f, 0.998751104f},
-std::array<float,2>{0.426820755f, 0.804484844f},
-std::array<float,2>{0.506249845f, 0.220322683f},
-std::array<float,2>{0.0848914012f, 0.458349794f},
-std::array<float,2>{0.929412663f, 0.658770263f},
-std::array<float,2>{0.187194645f, 0.5341627f},
-std::array<float,2>{0.851628482f, 0.32908985f},
-std::array<float,2>{0.270244122f, 0.0191116296f},
-std::array<float,2>{0.6885131f, 0.914572358f},
-std::array<float,2>{0.0545216426f, 0.956059158f},
-std::array<float,2>{0.945538461f, 0.0631994158f},
-std::array<float,2>{0.471713334f, 0.26501736f},
-std::array<float,2>{0.580168664f, 0.583857179f},
-std::array<float,2>{0.326601475f, 0.692701995f},
-std::array<float,2>{0.646079123f, 0.386362374f},
-std::array<float,2>{0.225041538f, 0.175441384f},
-std::array<float,2>{0.76705271f, 0.855232477f},
-std::array<float,2>{0.495435268f, 0.977278173f},
-std::array<float,2>{0.577943385f, 0.0945155472f},
-std::array<float,2>{0.0419464931f, 0.283714354f},
-std::array<float,2>{0.968728364f, 0.621677339f},
-std::array<float,2>{0.237677112f, 0.729052424f},
-std::array<float,2>{0.753260016f, 0.418793529f},
-std::array<float,2>{0.341289312f, 0.133599743f},
-std::array<float,2>{0.639815271f, 0.841215134f},
-std::array<float,2>{0.0756017938f, 0.778369188f},
-std::array<float,2>{0.913452804f, 0.199445412f},
-std::array<float,2>{0.4136464f, 0.469564885f},
-std::array<float,2>{0.520491958f, 0.6488204f},
-std::array<float,2>{0.258504689f, 0.530785918f},
-std::array<float,2>{0.70557487f, 0.344969511f},
-std::array<float,2>{0.163947403f, 0.0432300158f},
-std::array<float,2>{0.870298505f, 0.902602077f},
-std::array<float,2>{0.3634682f, 0.861709774f},
-std::array<float,2>{0.681930721f, 0.161369011f},
-std::array<float,2>{0.215150163f, 0.404977649f},
-std::array<float,2>{0.812312424f, 0.70370394f},
-std::array<float,2>{0.0252551381f, 0.576202333f},
-std::array<float,2>{0.974978566f, 0.26961422f},
-std::array<float,2>{0.450428843f, 0.0895064846f},
-std::array<float,2>{0.622340798f, 0.937832415f},
-std::array<float,2>{0.145652175f, 0.934117258f},
-std::array<float,2>{0.827895761f, 0.00688618189f},
-std::array<float,2>{0.309733957f, 0.319206566f},
-std::array<float,2>{0.736982644f, 0.548525035f},
-std::array<float,2>{0.400806695f, 0.677357972f},
-std::array<float,2>{0.555477977f, 0.442021281f},
-std::array<float,2>{0.107058167f, 0.244548887f},
-std::array<float,2>{0.895433605f, 0.796456814f},
-std::array<float,2>{0.354137421f, 0.898834229f},
-std::array<float,2>{0.671489f, 0.0405313224f},
-std::array<float,2>{0.199782461f, 0.349391758f},
-std::array<float,2>{0.785623789f, 0.52469039f},
-std::array<float,2>{0.00307870284f, 0.653252959f},
-std::array<float,2>{0.997749925f, 0.47574842f},
-std::array<float,2>{0.467658818f, 0.195999965f},
-std::array<float,2>{0.604339123f, 0.774411082f},
-std::array<float,2>{0.128105506f, 0.839472413f},
-std::array<float,2>{0.830691278f, 0.137340844f},
-std::array<float,2>{0.285506994f, 0.414212674f},
-std::array<float,2>{0.722619236f, 0.732077956f},
-std::array<float,2>{0.389208794f, 0.619500339f},
-std::array<float,2>{0.5466398f, 0.285795242f},
-std::array<float,2>{0.113918699f, 0.0995036066f},
-std::array<float,2>{0.875849962f, 0.980993152f},
-std::array<float,2>{0.477729261f, 0.791804552f},
-std::array<float,2>{0.59238869f, 0.246122554f},
-std::array<float,2>{0.0602410957f, 0.439654619f},
-std::array<float,2>{0.941991389f, 0.674971402f},
-std::array<float,2>{0.230924919f, 0.551621497f},
-std::array<float,2>{0.77805841f, 0.313929856f},
-std::array<float,2>{0.317963392f, 0.00071219448f},
-std::array<float,2>{0.649289966f, 0.930656254f},
-std::array<float,2>{0.0871923044f, 0.941442072f},
-std::array<float,2>{0.931615949f, 0.0912256166f},
-std::array<float,2>{0.433265775f, 0.268020362f},
-std::array<float,2>{0.514361739f, 0.570498943f},
-std::array<float,2>{0.276879489f, 0.709584832f},
-std::array<float,2>{0.697744489f, 0.398906857f},
-std::array<float,2>{0.17286475f, 0.157249361f},
-std::array<float,2>{0.84607178f, 0.865544021f},
-std::array<float,2>{0.414861739f, 0.994461119f},
-std::array<float,2>{0.528533518f, 0.115161233f},
-std::array<float,2>{0.0685903654f, 0.300528467f},
-std::array<float,2>{0.920705855f, 0.598685205f},
-std::array<float,2>{0.1649369f, 0.738618433f},
-std::array<float,2>{0.861660063f, 0.421900004f},
-std::array<float,2>{0.251506984f, 0.146706268f},
-std::array<float,2>{0.714819729f, 0.820519388f},
-std::array<float,2>{0.031441886f, 0.759447694f},
-std::array<float,2>{0.953348637f, 0.204765558f},
-std::array<float,2>{0.486622959f, 0.487191737f},
-std::array<float,2>{0.562624097f, 0.63638097f},
-std::array<float,2>{0.334508985f, 0.51503551f},
-std::array<float,2>{0.628764689f, 0.36396569f},
-std::array<float,2>{0.243890867f, 0.0504602604f},
-std::array<float,2>{0.763864994f, 0.890587091f},
-std::array<float,2>{0.30213201f, 0.857488096f},
-std::array<float,2>{0.74339962f, 0.176784679f},
-std::array<float,2>{0.155641302f, 0.39032653f},
-std::array<float,2>{0.815795839f, 0.691312194f},
-std::array<float,2>{0.0951210633f, 0.581561089f},
-std::array<float,2>{0.904148102f, 0.259195358f},
-std::array<float,2>{0.39719817f, 0.0677057803f},
-std::array<float,2>{0.55265677f, 0.958191872f},
-std::array<float,2>{0.204718679f, 0.919117332f},
-std::array<float,2>{0.797938466f, 0.0218926743f},
-std::array<float,2>{0.369365633f, 0.333679706f},
-std::array<float,2>{0.6722821f, 0.536798656f},
-std::array<float,2>{0.444279432f, 0.6608603f},
-std::array<float,2>{0.613339484f, 0.456971437f},
-std::array<float,2>{0.0173169449f, 0.226330027f},
-std::array<float,2>{0.981591582f, 0.797138989f},
-std::array<float,2>{0.262966007f, 0.967950761f},
-std::array<float,2>{0.710720122f, 0.0749060214f},
-std::array<float,2>{0.157176033f, 0.255206436f},
-std::array<float,2>{0.873948514f, 0.587623894f},
-std::array<float,2>{0.0727012902f, 0.700406253f},
-std::array<float,2>{0.907206714f, 0.380438358f},
-std::array<float,2>{0.40781951f, 0.185774654f},
-std::array<float,2>{0.518957675f, 0.843851328f},
-std::array<float,2>{0.239938378f, 0.80772984f},
-std::array<float,2>{0.754151225f, 0.227126226f},
-std::array<float,2>{0.336464405f, 0.468124062f},
-std::array<float,2>{0.634981632f, 0.665706694f},
-std::array<float,2>{0.4995974f, 0.540694296f},
-std::array<float,2>{0.573118865f, 0.337041616f},
-std::array<float,2>{0.0444271043f, 0.0277766455f},
-std::array<float,2>{0.96124953f, 0.91133523f},
-std::array<float,2>{0.40369764f, 0.819792032f},
-std::array<float,2>{0.56178093f, 0.150048301f},
-std::array<float,2>{0.102411479f, 0.432253927f},
-std::array<float,2>{0.890666664f, 0.749453723f},
-std::array<float,2>{0.14187634f, 0.603272319f},
-std::array<float,2>{0.821175814f, 0.305223614f},
-std::array<float,2>{0.305815071f, 0.124599375f},
-std::array<float,2>{0.740485072f, 0.991918266f},
-std::array<float,2>{0.0290297698f, 0.882035136f},
-std::array<float,2>{0.971529722f, 0.0554066561f},
-std::array<float,2>{0.447816789f, 0.372030288f},
-std::array<float,2>{0.618339181f, 0.504865408f},
-std::array<float,2>{0.362489372f, 0.627471983f},
-std::array<float,2>{0.685677469f, 0.497473955f},
-std::array<float,2>{0.213221133f, 0.215952724f},
-std::array<float,2>{0.806518614f, 0.755479813f},
-std::array<float,2>{0.459378183f, 0.923037291f},
-std::array<float,2>{0.59658438f, 0.0155605739f},
-std::array<float,2>{0.0131755108f, 0.324168384f},
-std::array<float,2>{0.988461912f, 0.556447029f},
-std::array<float,2>{0.191785872f, 0.686453223f},
-std::array<float,2>{0.790487409f, 0.448439837f},
-std::array<float,2>{0.344886512f, 0.239243895f},
-std::array<float,2>{0.660169542f, 0.784249961f},
-std::array<float,2>{0.118005976f, 0.874308467f},
-std::array<float,2>{0.883267462f, 0.16781278f},
-std::array<float,2>{0.379018605f, 0.394321024f},
-std::array<float,2>{0.535089374f, 0.717853069f},
-std::array<float,2>{0.289749771f, 0.568670392f},
-std::array<float,2>{0.734113395f, 0.280676544f},
-std::array<float,2>{0.133591846f, 0.0797254518f},
-std::array<float,2>{0.841690421f, 0.949528158f},
-std::array<float,2>{0.32328555f, 0.771637797f},
-std::array<float,2>{0.641696334f, 0.194558144f},
-std::array<float,2>{0.220562249f, 0.476786882f},
-std::array<float,2>{0.77012527f, 0.645388186f},
-std::array<float,2>{0.0500760451f, 0.520461261f},
-std::array<float,2>{0.949502766f, 0.354060411f},
-std::array<float,2>{0.476437569f, 0.0346639566f},
-std::array<float,2>{0.584820509f, 0.894541383f},
-std::array<float,2>{0.18024306f, 0.97530818f},
-std::array<float,2>{0.858206928f, 0.106436431f},
-std::array<float,2>{0.267870754f, 0.295014441f},
-std::array<float,2>{0.692719877f, 0.614281476f},
-std::array<float,2>{0.423814863f, 0.72213155f},
-std::array<float,2>{0.502688646f, 0.411516875f},
-std::array<float,2>{0.0797978714f, 0.132143497f},
-std::array<float,2>{0.925454915f, 0.833706617f},
-std::array<float,2>{0.341433793f, 0.979249597f},
-std::array<float,2>{0.640545964f, 0.0973228365f},
-std::array<float,2>{0.238252014f, 0.282525569f},
-std::array<float,2>{0.753883719f, 0.623523533f},
-std::array<float,2>{0.0411727093f, 0.726894975f},
-std::array<float,2>{0.967784286f, 0.421562672f},
-std::array<float,2>{0.495789438f, 0.134815693f},
-std::array<float,2>{0.577330172f, 0.842160642f},
-std::array<float,2>{0.163567871f, 0.780178726f},
-std::array<float,2>{0.870820403f, 0.201218307f},
-std::array<float,2>{0.257936686f, 0.471850902f},
-std::array<float,2>{0.70526731f, 0.651889682f},
-std::array<float,2>{0.413393438f, 0.528230846f},
-std::array<float,2>{0.519943655f, 0.346055746f},
-std::array<float,2>{0.0757755786f, 0.0454471186f},
-std::array<float,2>{0.91386199f, 0.905148149f},
-std::array<float,2>{0.451007724f, 0.860872507f},
-std::array<float,2>{0.622563958f, 0.162516594f},
-std::array<float,2>{0.0248626433f, 0.404175937f},
-std::array<float,2>{0.975377262f, 0.705968022f},
-std::array<float,2>{0.215597987f, 0.574425876f},
-std::array<float,2>{0.812006891f, 0.271570563f},
-std::array<float,2>{0.36403358f, 0.0874049887f},
-std::array<float,2>{0.682213962f, 0.940995395f},
-std::array<float,2>{0.106715776f, 0.935583889f},
-std::array<float,2>{0.894632936f, 0.0047813626f},
-std::array<float,2>{0.401198983f, 0.317331731f},
-std::array<float,2>{0.554938495f, 0.549290121f},
-std::array<float,2>{0.310409784f, 0.678048253f},
-std::array<float,2>{0.736348748f, 0.444636881f},
-std::array<float,2>{0.146363154f, 0.242484733f},
-std::array<float,2>{0.827573597f, 0.794462264f},
-std::array<float,2>{0.378640532f, 0.884049416f},
-std::array<float,2>{0.538299918f, 0.0531203449f},
-std::array<float,2>{0.121875398f, 0.361444056f},
-std::array<float,2>{0.888853431f, 0.50964278f},
-std::array<float,2>{0.139515981f, 0.639910817f},
-std::array<float,2>{0.837798893f, 0.491250277f},
-std::array<float,2>{0.295217216f, 0.207278982f},
-std::array<float,2>{0.728292286f, 0.762091458f},
-std::array<float,2>{0.00788036082f, 0.827297807f},
-std::array<float,2>{0.987924039f, 0.141702533f},
-std::array<float,2>{0.455252111f, 0.427082956f},
-std::array<float,2>{0.600917935f, 0.737436533f},
-std::array<float,2>{0.349522829f, 0.59479332f},
-std::array<float,2>{0.657562792f, 0.304069757f},
-std::array<float,2>{0.19103232f, 0.112314545f},
-std::array<float,2>{0.794778824f, 0.997911751f},
-std::array<float,2>{0.269568324f, 0.802220583f},
-std::array<float,2>{0.689385593f, 0.2212262f},
-std::array<float,2>{0.186531365f, 0.460352868f},
-std::array<float,2>{0.852296531f, 0.658089817f},
-std::array<float,2>{0.0843006447f, 0.531362891f},
-std::array<float,2>{0.929020345f, 0.330496281f},
-std::array<float,2>{0.427608341f, 0.0173380077f},
-std::array<float,2>{0.506482542f, 0.917513609f},
-std::array<float,2>{0.225253016f, 0.954279184f},
-std::array<float,2>{0.767130256f, 0.0658261478f},
-std::array<float,2>{0.32712248f, 0.261814803f},
-std::array<float,2>{0.645517707f, 0.584584832f},
-std::array<float,2>{0.47258082f, 0.695291877f},
-std::array<float,2>{0.580829084f, 0.383443952f},
-std::array<float,2>{0.05383249f, 0.17317377f},
-std::array<float,2>{0.945988059f, 0.851975799f},
-std::array<float,2>{0.282441437f, 0.906575322f},
-std::array<float,2>{0.726540744f, 0.0260168519f},
-std::array<float,2>{0.129010469f, 0.342656285f},
-std::array<float,2>{0.832982659f, 0.54608947f},
-std::array<float,2>{0.111935996f, 0.670331419f},
-std::array<float,2>{0.882733762f, 0.461797059f},
-std::array<float,2>{0.382891834f, 0.23397544f},
-std::array<float,2>{0.540205181f, 0.809645653f},
-std::array<float,2>{0.197184265f, 0.850871503f},
-std::array<float,2>{0.782056689f, 0.180735365f},
-std::array<float,2>{0.358299851f, 0.37877962f},
-std::array<float,2>{0.665143549f, 0.698641539f},
-std::array<float,2>{0.461563826f, 0.593173563f},
-std::array<float,2>{0.608789325f, 0.251501858f},
-std::array<float,2>{0.00459075905f, 0.071621798f},
-std::array<float,2>{0.993522525f, 0.961284518f},
-std::array<float,2>{0.433862448f, 0.751335859f},
-std::array<float,2>{0.511151373f, 0.212292284f},
-std::array<float,2>{0.0901445597f, 0.494271636f},
-std::array<float,2>{0.934316039f, 0.631006658f},
-std::array<float,2>{0.176917031f, 0.502476811f},
-std::array<float,2>{0.849291086f, 0.369961292f},
-std::array<float,2>{0.28035602f, 0.0588428304f},
-std::array<float,2>{0.700969696f, 0.876003742f},
-std::array<float,2>{0.0577082969f, 0.984618604f},
-std::array<float,2>{0.940181553f, 0.121085525f},
-std::array<float,2>{0.481770694f, 0.310821921f},
-std::array<float,2>{0.589684129f, 0.608228803f},
-std::array<float,2>{0.31375435f, 0.746020198f},
-std::array<float,2>{0.656226456f, 0.435312182f},
-std::array<float,2>{0.227843434f, 0.154153749f},
-std::array<float,2>{0.776847124f, 0.813852727f},
-std::array<float,2>{0.489130497f, 0.946809769f},
-std::array<float,2>{0.569532514f, 0.0850042328f},
-std::array<float,2>{0.0372539945f, 0.276918799f},
-std::array<float,2>{0.958105087f, 0.565361321f},
-std::array<float,2>{0.24807933f, 0.711769223f},
-std::array<float,2>{0.75856781f, 0.395984709f},
-std::array<float,2>{0.330121398f, 0.170306683f},
-std::array<float,2>{0.630365014f, 0.867800057f},
-std::array<float,2>{0.0660238564f, 0.788755f},
-std::array<float,2>{0.914556921f, 0.236723125f},
-std::array<float,2>{0.418489903f, 0.45167008f},
-std::array<float,2>{0.523458779f, 0.683350861f},
-std::array<float,2>{0.256643683f, 0.562370658f},
-std::array<float,2>{0.717725039f, 0.324704528f},
-std::array<float,2>{0.170253873f, 0.0100850146f},
-std::array<float,2>{0.864963651f, 0.926098228f},
-std::array<float,2>{0.373632044f, 0.828613162f},
-std::array<float,2>{0.677221835f, 0.127670839f},
-std::array<float,2>{0.210669801f, 0.408720046f},
-std::array<float,2>{0.801142573f, 0.723694921f},
-std::array<float,2>{0.0201761052f, 0.612437189f},
-std::array<float,2>{0.976564407f, 0.291783005f},
-std::array<float,2>{0.438858241f, 0.104661949f},
-std::array<float,2>{0.610697448f, 0.972212851f},
-std::array<float,2>{0.149878323f, 0.891997039f},
-std::array<float,2>{0.820301592f, 0.0378401391f},
-std::array<float,2>{0.297876924f, 0.356653363f},
-std::array<float,2>{0.748271704f, 0.51681602f},
-std::array<float,2>{0.392310321f, 0.641265392f},
-std::array<float,2>{0.548696041f, 0.482108295f},
-std::array<float,2>{0.100052819f, 0.188483596f},
-std::array<float,2>{0.901617825f, 0.769213319f},
-std::array<float,2>{0.319037586f, 0.933062971f},
-std::array<float,2>{0.650456965f, 0.00231624045f},
-std::array<float,2>{0.234049052f, 0.314920217f},
-std::array<float,2>{0.779409528f, 0.554120719f},
-std::array<float,2>{0.060750667f, 0.673293114f},
-std::array<float,2>{0.945206761f, 0.439270765f},
-std::array<float,2>{0.479412079f, 0.248765603f},
-std::array<float,2>{0.59048003f, 0.790241361f},
-std::array<float,2>{0.175002426f, 0.863294721f},
-std::array<float,2>{0.845454574f, 0.158341944f},
-std::array<float,2>{0.274333477f, 0.401870102f},
-std::array<float,2>{0.696289718f, 0.708635509f},
-std::array<float,2>{0.430300266f, 0.572395623f},
-std::array<float,2>{0.513429642f, 0.267279595f},
-std::array<float,2>{0.0886084363f, 0.0934364796f},
-std::array<float,2>{0.933155596f, 0.945074856f},
-std::array<float,2>{0.46589011f, 0.776074886f},
-std::array<float,2>{0.603072166f, 0.198753774f},
-std::array<float,2>{0.000354357908f, 0.473215818f},
-std::array<float,2>{0.998939872f, 0.655589581f},
-std::array<float,2>{0.202105209f, 0.52677387f},
-std::array<float,2>{0.788878262f, 0.350864172f},
-std::array<float,2>{0.352154344f, 0.0417833142f},
-std::array<float,2>{0.669690788f, 0.901533902f},
-std::array<float,2>{0.117140979f, 0.982436895f},
-std::array<float,2>{0.8779971f, 0.100049987f},
-std::array<float,2>{0.387963891f, 0.288050115f},
-std::array<float,2>{0.543172181f, 0.618067443f},
-std::array<float,2>{0.288396865f, 0.732853949f},
-std::array<float,2>{0.719409883f, 0.417669654f},
-std::array<float,2>{0.125358701f, 0.140165433f},
-std::array<float,2>{0.82958895f, 0.836733639f},
-std::array<float,2>{0.394845456f, 0.960682333f},
-std::array<float,2>{0.554234028f, 0.0695020333f},
-std::array<float,2>{0.0967460871f, 0.261452973f},
-std::array<float,2>{0.905862868f, 0.580016613f},
-std::array<float,2>{0.153964967f, 0.687793434f},
-std::array<float,2>{0.81442529f, 0.387072504f},
-std::array<float,2>{0.30389291f, 0.179530174f},
-std::array<float,2>{0.744485259f, 0.856389821f},
-std::array<float,2>{0.0186224096f, 0.799889028f},
-std::array<float,2>{0.982587099f, 0.222692996f},
-std::array<float,2>{0.443105906f, 0.454857409f},
-std::array<float,2>{0.615930319f, 0.662135243f},
-std::array<float,2>{0.367571861f, 0.53872925f},
-std::array<float,2>{0.674133182f, 0.335543483f},
-std::array<float,2>{0.205370933f, 0.0202176888f},
-std::array<float,2>{0.800089896f, 0.921480656f},
-std::array<float,2>{0.253006935f, 0.822369397f},
-std::array<float,2>{0.712161362f, 0.146239802f},
-std::array<float,2>{0.167384416f, 0.424664199f},
-std::array<float,2>{0.861194134f, 0.740348101f},
-std::array<float,2>{0.0672955215f, 0.601288259f},
-std::array<float,2>{0.918730795f, 0.297368079f},
-std::array<float,2>{0.416577131f, 0.115368858f},
-std::array<float,2>{0.530262411f, 0.992761552f},
-std::array<float,2>{0.245499507f, 0.887558162f},
-std::array<float,2>{0.761877537f, 0.0482000746f},
-std::array<float,2>{0.333447337f, 0.366063446f},
-std::array<float,2>{0.626507759f, 0.513161838f},
-std::array<float,2>{0.484883398f, 0.633290231f},
-std::array<float,2>{0.565674484f, 0.484675229f},
-std::array<float,2>{0.0349469557f, 0.205576777f},
-std::array<float,2>{0.9567855f, 0.761170387f},
-std::array<float,2>{0.307267457f, 0.990190804f},
-std::array<float,2>{0.738587439f, 0.121590599f},
-std::array<float,2>{0.143192068f, 0.307632715f},
-std::array<float,2>{0.822799087f, 0.604275823f},
-std::array<float,2>{0.104103059f, 0.747530818f},
-std::array<float,2>{0.893156469f, 0.43128708f},
-std::array<float,2>{0.405034035f, 0.151669607f},
-std::array<float,2>{0.559419632f, 0.816525817f},
-std::array<float,2>{0.211300716f, 0.756805599f},
-std::array<float,2>{0.808380067f, 0.217377901f},
-std::array<float,2>{0.36080268f, 0.498959988f},
-std::array<float,2>{0.685158014f, 0.625236452f},
-std::array<float,2>{0.447195709f, 0.506749332f},
-std::array<float,2>{0.620145142f, 0.374133021f},
-std::array<float,2>{0.0302973315f, 0.0576590672f},
-std::array<float,2>{0.970379889f, 0.880714357f},
-std::array<float,2>{0.410155207f, 0.846015573f},
-std::array<float,2>{0.517495155f, 0.183980092f},
-std::array<float,2>{0.0715327412f, 0.381002545f},
-std::array<float,2>{0.909744024f, 0.70195204f},
-std::array<float,2>{0.158285379f, 0.589603007f},
-std::array<float,2>{0.871799529f, 0.25773403f},
-std::array<float,2>{0.265318125f, 0.0780260488f},
-std::array<float,2>{0.707825601f, 0.966224372f},
-std::array<float,2>{0.0466704927f, 0.912673414f},
-std::array<float,2>{0.963846028f, 0.0300871693f},
-std::array<float,2>{0.496116459f, 0.338576883f},
-std::array<float,2>{0.57137543f, 0.542287171f},
-std::array<float,2>{0.339374185f, 0.667683244f},
-std::array<float,2>{0.633725286f, 0.46496278f},
-std::array<float,2>{0.241882652f, 0.229557112f},
-std::array<float,2>{0.757124007f, 0.805405736f},
-std::array<float,2>{0.474065363f, 0.896975219f},
-std::array<float,2>{0.582035303f, 0.0319635458f},
-std::array<float,2>{0.0472785346f, 0.352295041f},
-std::array<float,2>{0.951781273f, 0.522006929f},
-std::array<float,2>{0.221559733f, 0.647508442f},
-std::array<float,2>{0.772275209f, 0.47930792f},
-std::array<float,2>{0.321992904f, 0.191681609f},
-std::array<float,2>{0.643444479f, 0.771235228f},
-std::array<float,2>{0.0817930475f, 0.834877968f},
-std::array<float,2>{0.923469007f, 0.130128697f},
-std::array<float,2>{0.423956633f, 0.41226539f},
-std::array<float,2>{0.50177592f, 0.719370008f},
-std::array<float,2>{0.267366201f, 0.616907597f},
-std::array<float,2>{0.69399339f, 0.293711275f},
-std::array<float,2>{0.183518395f, 0.108241349f},
-std::array<float,2>{0.855901361f, 0.974483728f},
-std::array<float,2>{0.346661717f, 0.781390548f},
-std::array<float,2>{0.663839877f, 0.241978586f},
-std::array<float,2>{0.19493787f, 0.446788013f},
-std::array<float,2>{0.791574836f, 0.683867633f},
-std::array<float,2>{0.0145913595f, 0.557672024f},
-std::array<float,2>{0.992112339f, 0.321852356f},
-std::array<float,2>{0.458940834f, 0.0125657851f},
-std::array<float,2>{0.594734728f, 0.92426163f},
-std::array<float,2>{0.135427222f, 0.951862216f},
-std::array<float,2>{0.84328109f, 0.0813200772f},
-std::array<float,2>{0.291383952f, 0.277772635f},
-std::array<float,2>{0.732321918f, 0.566521287f},
-std::array<float,2>{0.381364256f, 0.715960145f},
-std::array<float,2>{0.532535672f, 0.392225474f},
-std::array<float,2>{0.120234594f, 0.164664045f},
-std::array<float,2>{0.886200011f, 0.871313572f},
-std::array<float,2>{0.365467548f, 0.938228965f},
-std::array<float,2>{0.680486858f, 0.0892790332f},
-std::array<float,2>{0.21869649f, 0.270476371f},
-std::array<float,2>{0.808877409f, 0.576873481f},
-std::array<float,2>{0.0268200617f, 0.703199327f},
-std::array<float,2>{0.974314094f, 0.404732674f},
-std::array<float,2>{0.452316016f, 0.162051111f},
-std::array<float,2>{0.624465883f, 0.861895204f},
-std::array<float,2>{0.147595644f, 0.796361744f},
-std::array<float,2>{0.824937999f, 0.24496913f},
-std::array<float,2>{0.311604738f, 0.441668332f},
-std::array<float,2>{0.734757841f, 0.676795423f},
-std::array<float,2>{0.399948418f, 0.547967076f},
-std::array<float,2>{0.556955218f, 0.318464965f},
-std::array<float,2>{0.109242804f, 0.00741642667f},
-std::array<float,2>{0.897347271f, 0.933789253f},
-std::array<float,2>{0.493991435f, 0.841486514f},
-std::array<float,2>{0.574382722f, 0.132976294f},
-std::array<float,2>{0.0405718572f, 0.418198973f},
-std::array<float,2>{0.966649115f, 0.728522718f},
-std::array<float,2>{0.234607399f, 0.621397555f},
-std::array<float,2>{0.75194478f, 0.283318013f},
-std::array<float,2>{0.342236847f, 0.0939800367f},
-std::array<float,2>{0.636899471f, 0.976703644f},
-std::array<float,2>{0.0775692984f, 0.90285188f},
-std::array<float,2>{0.910469711f, 0.0436945483f},
-std::array<float,2>{0.411237955f, 0.345592678f},
-std::array<float,2>{0.52156955f, 0.530447543f},
-std::array<float,2>{0.261276811f, 0.64901489f},
-std::array<float,2>{0.704040527f, 0.468963921f},
-std::array<float,2>{0.162030742f, 0.199800536f},
-std::array<float,2>{0.868461251f, 0.779009044f},
-std::array<float,2>{0.429649204f, 0.914099932f},
-std::array<float,2>{0.50415802f, 0.0188208502f},
-std::array<float,2>{0.0822505504f, 0.328334838f},
-std::array<float,2>{0.926312089f, 0.533673882f},
-std::array<float,2>{0.185207844f, 0.658284187f},
-std::array<float,2>{0.853589594f, 0.458732158f},
-std::array<float,2>{0.273218095f, 0.219987378f},
-std::array<float,2>{0.690417051f, 0.803786457f},
-std::array<float,2>{0.050842531f, 0.854507625f},
-std::array<float,2>{0.947335243f, 0.175169408f},
-std::array<float,2>{0.469601035f, 0.385797948f},
-std::array<float,2>{0.579078376f, 0.693262935f},
-std::array<float,2>{0.326110899f, 0.58306396f},
-std::array<float,2>{0.647994697f, 0.265378952f},
-std::array<float,2>{0.223500416f, 0.0626524165f},
-std::array<float,2>{0.768060505f, 0.956636786f},
-std::array<float,2>{0.293579966f, 0.765146255f},
-std::array<float,2>{0.729464114f, 0.209261104f},
-std::array<float,2>{0.138265908f, 0.490051031f},
-std::array<float,2>{0.839606225f, 0.638419151f},
-std::array<float,2>{0.123716861f, 0.510518372f},
-std::array<float,2>{0.887461782f, 0.361188531f},
-std::array<float,2>{0.376045704f, 0.0525751673f},
-std::array<float,2>{0.535502732f, 0.886560261f},
-std::array<float,2>{0.18778348f, 0.99850744f},
-std::array<float,2>{0.795188367f, 0.10956715f},
-std::array<float,2>{0.351255476f, 0.302152097f},
-std::array<float,2>{0.659658909f, 0.597157001f},
-std::array<float,2>{0.453192204f, 0.73457855f},
-std::array<float,2>{0.599302888f, 0.428808302f},
-std::array<float,2>{0.010974694f, 0.143871918f},
-std::array<float,2>{0.985587656f, 0.824549675f},
-std::array<float,2>{0.278172702f, 0.878703475f},
-std::array<float,2>{0.702368557f, 0.0609574839f},
-std::array<float,2>{0.179064885f, 0.368484914f},
-std::array<float,2>{0.850502133f, 0.50159055f},
-std::array<float,2>{0.0919394419f, 0.629271686f},
-std::array<float,2>{0.935923398f, 0.49332732f},
-std::array<float,2>{0.437265277f, 0.213285819f},
-std::array<float,2>{0.507970631f, 0.752264202f},
-std::array<float,2>{0.230386958f, 0.815531373f},
-std::array<float,2>{0.773511469f, 0.156245366f},
-std::array<float,2>{0.315986216f, 0.435943365f},
-std::array<float,2>{0.652614474f, 0.742468953f},
-std::array<float,2>{0.482463151f, 0.605783343f},
-std::array<float,2>{0.586776853f, 0.309378177f},
-std::array<float,2>{0.055746831f, 0.118313618f},
-std::array<float,2>{0.938839197f, 0.986452103f},
-std::array<float,2>{0.384856284f, 0.812193394f},
-std::array<float,2>{0.541996956f, 0.231622905f},
-std::array<float,2>{0.110083304f, 0.464185834f},
-std::array<float,2>{0.880161047f, 0.669478774f},
-std::array<float,2>{0.131142616f, 0.543302774f},
-std::array<float,2>{0.834240019f, 0.34167704f},
-std::array<float,2>{0.283527553f, 0.0250324868f},
-std::array<float,2>{0.723965704f, 0.908976138f},
-std::array<float,2>{0.00733795995f, 0.963573694f},
-std::array<float,2>{0.994373202f, 0.0729922354f},
-std::array<float,2>{0.463151217f, 0.253023475f},
-std::array<float,2>{0.60700345f, 0.590248346f},
-std::array<float,2>{0.356114984f, 0.69584316f},
-std::array<float,2>{0.667456746f, 0.376555622f},
-std::array<float,2>{0.19902578f, 0.183318526f},
-std::array<float,2>{0.783573925f, 0.849459291f},
-std::array<float,2>{0.440117061f, 0.969208062f},
-std::array<float,2>{0.611341238f, 0.102236591f},
-std::array<float,2>{0.0217648614f, 0.290787935f},
-std::array<float,2>{0.978565037f, 0.60996151f},
-std::array<float,2>{0.207500532f, 0.725482047f},
-std::array<float,2>{0.803577065f, 0.408003062f},
-std::array<float,2>{0.372576863f, 0.126632258f},
-std::array<float,2>{0.678418219f, 0.83193934f},
-std::array<float,2>{0.0993241295f, 0.766072989f},
-std::array<float,2>{0.899700522f, 0.189600796f},
-std::array<float,2>{0.394472033f, 0.483659893f},
-std::array<float,2>{0.549113154f, 0.643660247f},
-std::array<float,2>{0.300361007f, 0.518533766f},
-std::array<float,2>{0.74726516f, 0.357460231f},
-std::array<float,2>{0.152125761f, 0.0370456427f},
-std::array<float,2>{0.817643166f, 0.894509137f},
-std::array<float,2>{0.329549193f, 0.870902538f},
-std::array<float,2>{0.632752597f, 0.169766679f},
-std::array<float,2>{0.246313065f, 0.39698413f},
-std::array<float,2>{0.759965181f, 0.714169919f},
-std::array<float,2>{0.0363849923f, 0.563589931f},
-std::array<float,2>{0.960814357f, 0.27448535f},
-std::array<float,2>{0.49151668f, 0.0833543837f},
-std::array<float,2>{0.56809938f, 0.948027134f},
-std::array<float,2>{0.169528678f, 0.929281592f},
-std::array<float,2>{0.866248727f, 0.00975706056f},
-std::array<float,2>{0.254820764f, 0.327997386f},
-std::array<float,2>{0.715325296f, 0.558675945f},
-std::array<float,2>{0.420767874f, 0.681084156f},
-std::array<float,2>{0.525854707f, 0.449951887f},
-std::array<float,2>{0.0643258765f, 0.23493968f},
-std::array<float,2>{0.917582214f, 0.785378218f},
-std::array<float,2>{0.332081109f, 0.889569163f},
-std::array<float,2>{0.625433803f, 0.0488477089f},
-std::array<float,2>{0.244652599f, 0.364839733f},
-std::array<float,2>{0.763286829f, 0.514488876f},
-std::array<float,2>{0.0333685018f, 0.635154963f},
-std::array<float,2>{0.955548048f, 0.488029063f},
-std::array<float,2>{0.48600629f, 0.203350633f},
-std::array<float,2>{0.564520538f, 0.758501112f},
-std::array<float,2>{0.166118234f, 0.821828961f},
-std::array<float,2>{0.859944046f, 0.14831616f},
-std::array<float,2>{0.252292573f, 0.423247337f},
-std::array<float,2>{0.711647868f, 0.739605427f},
-std::array<float,2>{0.417933077f, 0.598463476f},
-std::array<float,2>{0.530826509f, 0.299644709f},
-std::array<float,2>{0.0683506951f, 0.113480628f},
-std::array<float,2>{0.919402897f, 0.99520421f},
-std::array<float,2>{0.441716552f, 0.797916174f},
-std::array<float,2>{0.61699158f, 0.22464475f},
-std::array<float,2>{0.0182945412f, 0.455239087f},
-std::array<float,2>{0.984323561f, 0.661212385f},
-std::array<float,2>{0.206561685f, 0.535792351f},
-std::array<float,2>{0.798898578f, 0.332912087f},
-std::array<float,2>{0.368435085f, 0.0232219379f},
-std::array<float,2>{0.674928486f, 0.918877721f},
-std::array<float,2>{0.0960469767f, 0.957201183f},
-std::array<float,2>{0.904518008f, 0.0666203797f},
-std::array<float,2>{0.396433383f, 0.258772731f},
-std::array<float,2>{0.553594291f, 0.580278099f},
-std::array<float,2>{0.302981466f, 0.690122783f},
-std::array<float,2>{0.745338917f, 0.389177322f},
-std::array<float,2>{0.153065115f, 0.176670611f},
-std::array<float,2>{0.812994182f, 0.858407199f},
-std::array<float,2>{0.387466222f, 0.981493711f},
-std::array<float,2>{0.544910252f, 0.0978306159f},
-std::array<float,2>{0.115369909f, 0.286857396f},
-std::array<float,2>{0.877031803f, 0.620599508f},
-std::array<float,2>{0.12607868f, 0.731198251f},
-std::array<float,2>{0.828746796f, 0.415219396f},
-std::array<float,2>{0.28779003f, 0.13786833f},
-std::array<float,2>{0.720534027f, 0.838038445f},
-std::array<float,2>{0.00180887152f, 0.77454704f},
-std::array<float,2>{0.99955368f, 0.197174221f},
-std::array<float,2>{0.465652108f, 0.474981368f},
-std::array<float,2>{0.601761758f, 0.65351826f},
-std::array<float,2>{0.35327363f, 0.523726523f},
-std::array<float,2>{0.668548584f, 0.348299772f},
-std::array<float,2>{0.202964276f, 0.0397070684f},
-std::array<float,2>{0.78715682f, 0.900277555f},
-std::array<float,2>{0.274641156f, 0.866597474f},
-std::array<float,2>{0.695897937f, 0.156946734f},
-std::array<float,2>{0.174276561f, 0.400025547f},
-std::array<float,2>{0.844189465f, 0.710344553f},
-std::array<float,2>{0.0889432579f, 0.571905613f},
-std::array<float,2>{0.932130933f, 0.268842936f},
-std::array<float,2>{0.431213975f, 0.0907841548f},
-std::array<float,2>{0.512364745f, 0.942893267f},
-std::array<float,2>{0.232567951f, 0.93112123f},
-std::array<float,2>{0.781202495f, 0.00190694816f},
-std::array<float,2>{0.319842726f, 0.312824965f},
-std::array<float,2>{0.652131617f, 0.552544475f},
-std::array<float,2>{0.479754418f, 0.67405951f},
-std::array<float,2>{0.591787875f, 0.441275656f},
-std::array<float,2>{0.0622996315f, 0.247368842f},
-std::array<float,2>{0.943888664f, 0.792645991f},
-std::array<float,2>{0.292247146f, 0.950253427f},
-std::array<float,2>{0.730817556f, 0.0790711492f},
-std::array<float,2>{0.136539385f, 0.280002385f},
-std::array<float,2>{0.842706621f, 0.569631875f},
-std::array<float,2>{0.119746603f, 0.717638195f},
-std::array<float,2>{0.884806931f, 0.392690092f},
-std::array<float,2>{0.381893456f, 0.166046202f},
-std::array<float,2>{0.532207847f, 0.873202503f},
-std::array<float,2>{0.193954781f, 0.783884943f},
-std::array<float,2>{0.792171836f, 0.239560083f},
-std::array<float,2>{0.347628146f, 0.447340429f},
-std::array<float,2>{0.662414849f, 0.687454939f},
-std::array<float,2>{0.457727104f, 0.555384457f},
-std::array<float,2>{0.594473481f, 0.322956294f},
-std::array<float,2>{0.0148505792f, 0.0137991691f},
-std::array<float,2>{0.991139531f, 0.922098637f},
-std::array<float,2>{0.425482631f, 0.832990825f},
-std::array<float,2>{0.500929654f, 0.131378889f},
-std::array<float,2>{0.080973722f, 0.410220385f},
-std::array<float,2>{0.922121584f, 0.721325934f},
-std::array<float,2>{0.181981921f, 0.613940656f},
-std::array<float,2>{0.856482685f, 0.296569705f},
-std::array<float,2>{0.266032398f, 0.107162528f},
-std::array<float,2>{0.694633722f, 0.976287603f},
-std::array<float,2>{0.0487877652f, 0.895603538f},
-std::array<float,2>{0.952534497f, 0.033938501f},
-std::array<float,2>{0.472918242f, 0.35473147f},
-std::array<float,2>{0.583074987f, 0.520960569f},
-std::array<float,2>{0.321038812f, 0.646040499f},
-std::array<float,2>{0.643599272f, 0.477558255f},
-std::array<float,2>{0.221770123f, 0.194035873f},
-std::array<float,2>{0.77322489f, 0.772530854f},
-std::array<float,2>{0.497296602f, 0.910596669f},
-std::array<float,2>{0.571199775f, 0.0283348057f},
-std::array<float,2>{0.0457878448f, 0.33650282f},
-std::array<float,2>{0.96393615f, 0.539368808f},
-std::array<float,2>{0.240974709f, 0.66438055f},
-std::array<float,2>{0.756732225f, 0.46694997f},
-std::array<float,2>{0.33870241f, 0.227964595f},
-std::array<float,2>{0.634039819f, 0.807084441f},
-std::array<float,2>{0.0703551397f, 0.845074594f},
-std::array<float,2>{0.908581793f, 0.186721489f},
-std::array<float,2>{0.408859223f, 0.379639447f},
-std::array<float,2>{0.516182899f, 0.699639976f},
-std::array<float,2>{0.264495224f, 0.586726487f},
-std::array<float,2>{0.708666563f, 0.254646868f},
-std::array<float,2>{0.159820318f, 0.0759628937f},
-std::array<float,2>{0.872558177f, 0.966805875f},
-std::array<float,2>{0.360346317f, 0.75422138f},
-std::array<float,2>{0.684046865f, 0.215382114f},
-std::array<float,2>{0.212066367f, 0.49663341f},
-std::array<float,2>{0.806988537f, 0.62864852f},
-std::array<float,2>{0.0295007937f, 0.505085468f},
-std::array<float,2>{0.969679773f, 0.372930676f},
-std::array<float,2>{0.445417315f, 0.0563878417f},
-std::array<float,2>{0.619175315f, 0.88167876f},
-std::array<float,2>{0.144138694f, 0.990433514f},
-std::array<float,2>{0.823529899f, 0.123859361f},
-std::array<float,2>{0.308478653f, 0.306060582f},
-std::array<float,2>{0.740032196f, 0.602496922f},
-std::array<float,2>{0.405385077f, 0.748438478f},
-std::array<float,2>{0.559958577f, 0.433505774f},
-std::array<float,2>{0.104614884f, 0.148481011f},
-std::array<float,2>{0.893712044f, 0.818719029f},
-std::array<float,2>{0.349634141f, 0.996941864f},
-std::array<float,2>{0.658764839f, 0.111526318f},
-std::array<float,2>{0.189265147f, 0.303327739f},
-std::array<float,2>{0.796200573f, 0.59402436f},
-std::array<float,2>{0.0107373064f, 0.736674786f},
-std::array<float,2>{0.984664738f, 0.425908476f},
-std::array<float,2>{0.45417735f, 0.14118816f},
-std::array<float,2>{0.598003805f, 0.826500356f},
-std::array<float,2>{0.13678655f, 0.763339162f},
-std::array<float,2>{0.838819802f, 0.208692878f},
-std::array<float,2>{0.294611663f, 0.490764111f},
-std::array<float,2>{0.729952574f, 0.639242053f},
-std::array<float,2>{0.375808001f, 0.508623183f},
-std::array<float,2>{0.536979198f, 0.362475902f},
-std::array<float,2>{0.124324732f, 0.0543346554f},
-std::array<float,2>{0.888499439f, 0.883633912f},
-std::array<float,2>{0.469969153f, 0.853491843f},
-std::array<float,2>{0.580047429f, 0.172801435f},
-std::array<float,2>{0.0526525266f, 0.384545445f},
-std::array<float,2>{0.948576868f, 0.694253206f},
-std::array<float,2>{0.223844066f, 0.585861504f},
-std::array<float,2>{0.768903673f, 0.26302591f},
-std::array<float,2>{0.324285001f, 0.0650477707f},
-std::array<float,2>{0.646687925f, 0.953385115f},
-std::array<float,2>{0.0835719109f, 0.91680479f},
-std::array<float,2>{0.926942766f, 0.015945619f},
-std::array<float,2>{0.42785272f, 0.331539989f},
-std::array<float,2>{0.505770326f, 0.532495916f},
-std::array<float,2>{0.271594048f, 0.656715095f},
-std::array<float,2>{0.69045794f, 0.459912062f},
-std::array<float,2>{0.184354961f, 0.222301349f},
-std::array<float,2>{0.854841888f, 0.801592469f},
-std::array<float,2>{0.410706967f, 0.905837238f},
-std::array<float,2>{0.522951245f, 0.0464651138f},
-std::array<float,2>{0.0764574781f, 0.347233474f},
-std::array<float,2>{0.911779702f, 0.528664649f},
-std::array<float,2>{0.160250336f, 0.651235402f},
-std::array<float,2>{0.867828727f, 0.471121013f},
-std::array<float,2>{0.260383546f, 0.203062743f},
-std::array<float,2>{0.704439521f, 0.780922472f},
-std::array<float,2>{0.0391876511f, 0.843657613f},
-std::array<float,2>{0.965265214f, 0.136110559f},
-std::array<float,2>{0.492474049f, 0.420231044f},
-std::array<float,2>{0.575247169f, 0.728149533f},
-std::array<float,2>{0.342994928f, 0.624680459f},
-std::array<float,2>{0.638623118f, 0.281599671f},
-std::array<float,2>{0.23540087f, 0.0958523005f},
-std::array<float,2>{0.750641525f, 0.980142117f},
-std::array<float,2>{0.310972869f, 0.793674946f},
-std::array<float,2>{0.735862136f, 0.243720114f},
-std::array<float,2>{0.147032201f, 0.443714827f},
-std::array<float,2>{0.825899422f, 0.679183245f},
-std::array<float,2>{0.108380392f, 0.550264776f},
-std::array<float,2>{0.89830929f, 0.317718178f},
-std::array<float,2>{0.398439109f, 0.00571160018f},
-std::array<float,2>{0.558457971f, 0.937441349f},
-std::array<float,2>{0.216941357f, 0.939759374f},
-std::array<float,2>{0.809613705f, 0.0863142163f},
-std::array<float,2>{0.366476685f, 0.273011178f},
-std::array<float,2>{0.681473851f, 0.575588286f},
-std::array<float,2>{0.451323211f, 0.706253827f},
-std::array<float,2>{0.623708487f, 0.403200984f},
-std::array<float,2>{0.0254389308f, 0.163307354f},
-std::array<float,2>{0.973558664f, 0.859666288f},
-std::array<float,2>{0.255274326f, 0.926857352f},
-std::array<float,2>{0.716573179f, 0.0113556413f},
-std::array<float,2>{0.168845415f, 0.325611442f},
-std::array<float,2>{0.865403295f, 0.561496913f},
-std::array<float,2>{0.0627385452f, 0.681745708f},
-std::array<float,2>{0.916653991f, 0.452302456f},
-std::array<float,2>{0.421687812f, 0.237523094f},
-std::array<float,2>{0.526540637f, 0.787711263f},
-std::array<float,2>{0.247232273f, 0.86856401f},
-std::array<float,2>{0.761132061f, 0.171239868f},
-std::array<float,2>{0.328531474f, 0.395387948f},
-std::array<float,2>{0.631183147f, 0.71234858f},
-std::array<float,2>{0.490244865f, 0.566347301f},
-std::array<float,2>{0.567341387f, 0.275858641f},
-std::array<float,2>{0.0355006605f, 0.0846621394f},
-std::array<float,2>{0.959107041f, 0.945600748f},
-std::array<float,2>{0.392728329f, 0.767898083f},
-std::array<float,2>{0.550052404f, 0.188381985f},
-std::array<float,2>{0.0985629037f, 0.481186271f},
-std::array<float,2>{0.898858488f, 0.642290592f},
-std::array<float,2>{0.15040572f, 0.515981972f},
-std::array<float,2>{0.816852391f, 0.355603367f},
-std::array<float,2>{0.298835933f, 0.0387434214f},
-std::array<float,2>{0.746977508f, 0.891305864f},
-std::array<float,2>{0.0226886366f, 0.971155345f},
-std::array<float,2>{0.980195642f, 0.104448691f},
-std::array<float,2>{0.441046149f, 0.292421341f},
-std::array<float,2>{0.612787724f, 0.611507356f},
-std::array<float,2>{0.37197727f, 0.72268188f},
-std::array<float,2>{0.679330826f, 0.409487158f},
-std::array<float,2>{0.208234251f, 0.128748491f},
-std::array<float,2>{0.803783f, 0.829193652f},
-std::array<float,2>{0.464373261f, 0.962017059f},
-std::array<float,2>{0.606147587f, 0.0704830959f},
-std::array<float,2>{0.00653813314f, 0.250531912f},
-std::array<float,2>{0.995277584f, 0.592675149f},
-std::array<float,2>{0.19802098f, 0.697816074f},
-std::array<float,2>{0.784515262f, 0.37749517f},
-std::array<float,2>{0.356695592f, 0.180636182f},
-std::array<float,2>{0.666923165f, 0.850377142f},
-std::array<float,2>{0.1110112f, 0.808655202f},
-std::array<float,2>{0.879130661f, 0.23291406f},
-std::array<float,2>{0.386126995f, 0.462608457f},
-std::array<float,2>{0.541034043f, 0.670978427f},
-std::array<float,2>{0.284942299f, 0.545606792f},
-std::array<float,2>{0.72350055f, 0.343098611f},
-std::array<float,2>{0.132063538f, 0.0264692064f},
-std::array<float,2>{0.835194528f, 0.908015788f},
-std::array<float,2>{0.315101504f, 0.81301254f},
-std::array<float,2>{0.654062927f, 0.152984142f},
-std::array<float,2>{0.229260415f, 0.434403688f},
-std::array<float,2>{0.774579585f, 0.744957447f},
-std::array<float,2>{0.0556211919f, 0.609332919f},
-std::array<float,2>{0.937637925f, 0.312047601f},
-std::array<float,2>{0.484137267f, 0.119170763f},
-std::array<float,2>{0.586917996f, 0.986316383f},
-std::array<float,2>{0.178432107f, 0.875940323f},
-std::array<float,2>{0.85132736f, 0.0595977567f},
-std::array<float,2>{0.278935045f, 0.370695055f},
-std::array<float,2>{0.701866448f, 0.503037572f},
-std::array<float,2>{0.435611129f, 0.632159054f},
-std::array<float,2>{0.509465873f, 0.495622814f},
-std::array<float,2>{0.0931122303f, 0.211820513f},
-std::array<float,2>{0.937478781f, 0.750100136f},
-std::array<float,2>{0.370857716f, 0.920712948f},
-std::array<float,2>{0.673031926f, 0.0213527735f},
-std::array<float,2>{0.203200474f, 0.334882557f},
-std::array<float,2>{0.79759866f, 0.537655771f},
-std::array<float,2>{0.0156366676f, 0.663541853f},
-std::array<float,2>{0.981137812f, 0.453807086f},
-std::array<float,2>{0.4445737f, 0.224567905f},
-std::array<float,2>{0.614385545f, 0.799053669f},
-std::array<float,2>{0.154495373f, 0.856549144f},
-std::array<float,2>{0.815246522f, 0.178152978f},
-std::array<float,2>{0.30091837f, 0.38792491f},
-std::array<float,2>{0.742241442f, 0.688581645f},
-std::array<float,2>{0.39842996f, 0.578721046f},
-std::array<float,2>{0.551372826f, 0.260584146f},
-std::array<float,2>{0.0940219611f, 0.0692671686f},
-std::array<float,2>{0.903094888f, 0.959777057f},
-std::array<float,2>{0.487520188f, 0.760405183f},
-std::array<float,2>{0.564385951f, 0.206189215f},
-std::array<float,2>{0.0326734483f, 0.485554725f},
-std::array<float,2>{0.954675078f, 0.633851707f},
-std::array<float,2>{0.242806882f, 0.512322068f},
-std::array<float,2>{0.765613556f, 0.36664623f},
-std::array<float,2>{0.335454285f, 0.0477814227f},
-std::array<float,2>{0.627226174f, 0.887797594f},
-std::array<float,2>{0.0698547289f, 0.994080663f},
-std::array<float,2>{0.921633363f, 0.116411842f},
-std::array<float,2>{0.415235162f, 0.298691273f},
-std::array<float,2>{0.528072596f, 0.599719465f},
-std::array<float,2>{0.250573695f, 0.74214673f},
-std::array<float,2>{0.713172853f, 0.425659359f},
-std::array<float,2>{0.165952533f, 0.145090774f},
-std::array<float,2>{0.862551868f, 0.823887825f},
-std::array<float,2>{0.431853741f, 0.944233775f},
-std::array<float,2>{0.515109777f, 0.0924723223f},
-std::array<float,2>{0.0868264884f, 0.265955061f},
-std::array<float,2>{0.929952383f, 0.573684931f},
-std::array<float,2>{0.172400236f, 0.70724678f},
-std::array<float,2>{0.847436726f, 0.40117687f},
-std::array<float,2>{0.27544561f, 0.159955367f},
-std::array<float,2>{0.699208558f, 0.865050614f},
-std::array<float,2>{0.0592876375f, 0.789114654f},
-std::array<float,2>{0.942413509f, 0.249870196f},
-std::array<float,2>{0.477201968f, 0.438228428f},
-std::array<float,2>{0.593612969f, 0.672605932f},
-std::array<float,2>{0.317341059f, 0.553179026f},
-std::array<float,2>{0.649450302f, 0.315498769f},
-std::array<float,2>{0.231980115f, 0.00324937608f},
-std::array<float,2>{0.778485417f, 0.932049572f},
-std::array<float,2>{0.286285132f, 0.837198555f},
-std::array<float,2>{0.720899999f, 0.139073178f},
-std::array<float,2>{0.127098411f, 0.416493773f},
-std::array<float,2>{0.831263661f, 0.733977616f},
-std::array<float,2>{0.114397861f, 0.618707538f},
-std::array<float,2>{0.876315117f, 0.288668931f},
-std::array<float,2>{0.390172213f, 0.100890532f},
-std::array<float,2>{0.54520452f, 0.983707607f},
-std::array<float,2>{0.200881019f, 0.900406003f},
-std::array<float,2>{0.786248386f, 0.0428304188f},
-std::array<float,2>{0.354588538f, 0.349795997f},
-std::array<float,2>{0.670587003f, 0.526078403f},
-std::array<float,2>{0.468365133f, 0.654480636f},
-std::array<float,2>{0.605169952f, 0.473796755f},
-std::array<float,2>{0.00209323643f, 0.197283298f},
-std::array<float,2>{0.996732116f, 0.776628613f},
-std::array<float,2>{0.268826306f, 0.972671211f},
-std::array<float,2>{0.691705465f, 0.109156623f},
-std::array<float,2>{0.18108125f, 0.294403374f},
-std::array<float,2>{0.859374404f, 0.615749598f},
-std::array<float,2>{0.078706719f, 0.720095158f},
-std::array<float,2>{0.924713194f, 0.413447648f},
-std::array<float,2>{0.422682673f, 0.129321039f},
-std::array<float,2>{0.503762901f, 0.835535526f},
-std::array<float,2>{0.218934447f, 0.770442247f},
-std::array<float,2>{0.770789504f, 0.192872286f},
-std::array<float,2>{0.322267026f, 0.479572475f},
-std::array<float,2>{0.641501963f, 0.646600544f},
-std::array<float,2>{0.47467491f, 0.522988081f},
-std::array<float,2>{0.585931063f, 0.353379816f},
-std::array<float,2>{0.0488366261f, 0.0329442583f},
-std::array<float,2>{0.950388849f, 0.897952437f},
-std::array<float,2>{0.379922211f, 0.872283936f},
-std::array<float,2>{0.53362906f, 0.165376261f},
-std::array<float,2>{0.1190494f, 0.391081095f},
-std::array<float,2>{0.884749889f, 0.715265334f},
-std::array<float,2>{0.133885756f, 0.567498028f},
-std::array<float,2>{0.840513706f, 0.278866112f},
-std::array<float,2>{0.290468156f, 0.0805185437f},
-std::array<float,2>{0.733127475f, 0.952799141f},
-std::array<float,2>{0.0124469148f, 0.925153494f},
-std::array<float,2>{0.989827037f, 0.0132140582f},
-std::array<float,2>{0.460806996f, 0.320881516f},
-std::array<float,2>{0.597439349f, 0.557284892f},
-std::array<float,2>{0.343931824f, 0.685016811f},
-std::array<float,2>{0.661487877f, 0.445622206f},
-std::array<float,2>{0.193276569f, 0.241131455f},
-std::array<float,2>{0.789247572f, 0.782969415f},
-std::array<float,2>{0.449085087f, 0.879774868f},
-std::array<float,2>{0.61784333f, 0.0567506887f},
-std::array<float,2>{0.0282288957f, 0.37357533f},
-std::array<float,2>{0.97231406f, 0.50741452f},
-std::array<float,2>{0.214774832f, 0.626408696f},
-std::array<float,2>{0.805131435f, 0.49946633f},
-std::array<float,2>{0.362184972f, 0.218709499f},
-std::array<float,2>{0.68718636f, 0.757607222f},
-std::array<float,2>{0.102906562f, 0.817567587f},
-std::array<float,2>{0.892268598f, 0.151169106f},
-std::array<float,2>{0.403240472f, 0.430160195f},
-std::array<float,2>{0.561239362f, 0.746882975f},
-std::array<float,2>{0.304749429f, 0.604639292f},
-std::array<float,2>{0.742147863f, 0.307013661f},
-std::array<float,2>{0.140807793f, 0.122696675f},
-std::array<float,2>{0.821770728f, 0.988961339f},
-std::array<float,2>{0.337416291f, 0.805960298f},
-std::array<float,2>{0.636294186f, 0.229321286f},
-std::array<float,2>{0.239038631f, 0.466202527f},
-std::array<float,2>{0.755070865f, 0.666595995f},
-std::array<float,2>{0.0436145216f, 0.541257322f},
-std::array<float,2>{0.962081432f, 0.338991672f},
-std::array<float,2>{0.498180658f, 0.0305188987f},
-std::array<float,2>{0.573779345f, 0.914018214f},
-std::array<float,2>{0.157855481f, 0.965193033f},
-std::array<float,2>{0.874942839f, 0.076239042f},
-std::array<float,2>{0.262646139f, 0.256556839f},
-std::array<float,2>{0.709272623f, 0.588161647f},
-std::array<float,2>{0.407194614f, 0.702452004f},
-std::array<float,2>{0.517653465f, 0.382063687f},
-std::array<float,2>{0.0733427629f, 0.185134292f},
-std::array<float,2>{0.907909334f, 0.847572863f},
-std::array<float,2>{0.32770583f, 0.955179036f},
-std::array<float,2>{0.644881785f, 0.0638564378f},
-std::array<float,2>{0.225902513f, 0.264568686f},
-std::array<float,2>{0.766055405f, 0.582728386f},
-std::array<float,2>{0.0537092686f, 0.691834688f},
-std::array<float,2>{0.946295321f, 0.385415733f},
-std::array<float,2>{0.471537024f, 0.173848391f},
-std::array<float,2>{0.581676722f, 0.85446918f},
-std::array<float,2>{0.186288953f, 0.803045452f},
-std::array<float,2>{0.852722704f, 0.219478503f},
-std::array<float,2>{0.270736605f, 0.457967639f},
-std::array<float,2>{0.688112736f, 0.659408271f},
-std::array<float,2>{0.42589882f, 0.534358859f},
-std::array<float,2>{0.507167876f, 0.329917222f},
-std::array<float,2>{0.0852830186f, 0.018477533f},
-std::array<float,2>{0.927951813f, 0.915186822f},
-std::array<float,2>{0.45643279f, 0.825981677f},
-std::array<float,2>{0.600487411f, 0.143383399f},
-std::array<float,2>{0.00886122324f, 0.427892715f},
-std::array<float,2>{0.987302005f, 0.736038208f},
-std::array<float,2>{0.189522117f, 0.596339107f},
-std::array<float,2>{0.793137848f, 0.301552206f},
-std::array<float,2>{0.348623335f, 0.110659868f},
-std::array<float,2>{0.656561136f, 0.999789476f},
-std::array<float,2>{0.122700274f, 0.885217726f},
-std::array<float,2>{0.890313804f, 0.0514184423f},
-std::array<float,2>{0.377547413f, 0.36025843f},
-std::array<float,2>{0.5380072f, 0.511477947f},
-std::array<float,2>{0.29615885f, 0.636858046f},
-std::array<float,2>{0.727176964f, 0.489218235f},
-std::array<float,2>{0.140351787f, 0.210750908f},
-std::array<float,2>{0.836546481f, 0.763722956f},
-std::array<float,2>{0.401587605f, 0.935511112f},
-std::array<float,2>{0.556509495f, 0.00596079044f},
-std::array<float,2>{0.105502002f, 0.320164651f},
-std::array<float,2>{0.896387637f, 0.547684431f},
-std::array<float,2>{0.144810706f, 0.675949454f},
-std::array<float,2>{0.826915324f, 0.442796052f},
-std::array<float,2>{0.309457123f, 0.245122775f},
-std::array<float,2>{0.73781234f, 0.795061707f},
-std::array<float,2>{0.0237554386f, 0.862420261f},
-std::array<float,2>{0.976353049f, 0.160240009f},
-std::array<float,2>{0.449894905f, 0.405498534f},
-std::array<float,2>{0.621541202f, 0.704437733f},
-std::array<float,2>{0.364307672f, 0.577151895f},
-std::array<float,2>{0.682762563f, 0.270694971f},
-std::array<float,2>{0.215830937f, 0.0888588354f},
-std::array<float,2>{0.810626447f, 0.939045548f},
-std::array<float,2>{0.259722084f, 0.777700007f},
-std::array<float,2>{0.707003176f, 0.200843677f},
-std::array<float,2>{0.162345767f, 0.470503539f},
-std::array<float,2>{0.869320095f, 0.650149941f},
-std::array<float,2>{0.0749807805f, 0.529890537f},
-std::array<float,2>{0.912279367f, 0.344689965f},
-std::array<float,2>{0.412734628f, 0.0447860882f},
-std::array<float,2>{0.521059394f, 0.903966546f},
-std::array<float,2>{0.236387908f, 0.978514493f},
-std::array<float,2>{0.752630889f, 0.0948554352f},
-std::array<float,2>{0.340564936f, 0.284843504f},
-std::array<float,2>{0.638691962f, 0.62214601f},
-std::array<float,2>{0.494871765f, 0.729729235f},
-std::array<float,2>{0.576516449f, 0.419066757f},
-std::array<float,2>{0.0428594723f, 0.134283051f},
-std::array<float,2>{0.967193544f, 0.840111792f},
-std::array<float,2>{0.297267973f, 0.893460333f},
-std::array<float,2>{0.74943018f, 0.0355711579f},
-std::array<float,2>{0.148802221f, 0.359208673f},
-std::array<float,2>{0.818766773f, 0.519256115f},
-std::array<float,2>{0.101401307f, 0.643372953f},
-std::array<float,2>{0.901058137f, 0.483036339f},
-std::array<float,2>{0.390812039f, 0.190842837f},
-std::array<float,2>{0.547809839f, 0.767367184f},
-std::array<float,2>{0.209811032f, 0.830136418f},
-std::array<float,2>{0.802560151f, 0.125592679f},
-std::array<float,2>{0.374811858f, 0.407132328f},
-std::array<float,2>{0.676295221f, 0.726359606f},
-std::array<float,2>{0.437557995f, 0.610660553f},
-std::array<float,2>{0.609772801f, 0.289744496f},
-std::array<float,2>{0.0207612496f, 0.102961317f},
-std::array<float,2>{0.977918744f, 0.969784796f},
-std::array<float,2>{0.419347435f, 0.786554039f},
-std::array<float,2>{0.524550676f, 0.236025572f},
-std::array<float,2>{0.0648418367f, 0.45038262f},
-std::array<float,2>{0.915130615f, 0.680125833f},
-std::array<float,2>{0.171859831f, 0.559798658f},
-std::array<float,2>{0.864142299f, 0.326431632f},
-std::array<float,2>{0.257808834f, 0.00837276503f},
-std::array<float,2>{0.718245029f, 0.928224027f},
-std::array<float,2>{0.0389913432f, 0.948477864f},
-std::array<float,2>{0.957157075f, 0.0822265968f},
-std::array<float,2>{0.489649206f, 0.274287581f},
-std::array<float,2>{0.569046617f, 0.562584162f},
-std::array<float,2>{0.331923068f, 0.713299394f},
-std::array<float,2>{0.629237175f, 0.397798419f},
-std::array<float,2>{0.249501064f, 0.168499738f},
-std::array<float,2>{0.759061337f, 0.869785428f},
-std::array<float,2>{0.480876774f, 0.987492502f},
-std::array<float,2>{0.587992191f, 0.117892705f},
-std::array<float,2>{0.056656234f, 0.309789449f},
-std::array<float,2>{0.941211402f, 0.606883228f},
-std::array<float,2>{0.227150336f, 0.7438761f},
-std::array<float,2>{0.775997937f, 0.437088042f},
-std::array<float,2>{0.313042402f, 0.155111179f},
-std::array<float,2>{0.654689074f, 0.814497828f},
-std::array<float,2>{0.0909585729f, 0.753118813f},
-std::array<float,2>{0.934711576f, 0.214462042f},
-std::array<float,2>{0.434998572f, 0.492348313f},
-std::array<float,2>{0.510616601f, 0.630211055f},
-std::array<float,2>{0.279798597f, 0.500975072f},
-std::array<float,2>{0.699510098f, 0.367711753f},
-std::array<float,2>{0.176570997f, 0.0622377396f},
-std::array<float,2>{0.848464251f, 0.877009094f},
-std::array<float,2>{0.35927698f, 0.847846389f},
-std::array<float,2>{0.664759994f, 0.182146102f},
-std::array<float,2>{0.196102887f, 0.3751975f},
-std::array<float,2>{0.782378614f, 0.696657658f},
-std::array<float,2>{0.00569518749f, 0.59131825f},
-std::array<float,2>{0.993143976f, 0.252474874f},
-std::array<float,2>{0.462025881f, 0.0736796185f},
-std::array<float,2>{0.608394504f, 0.964696765f},
-std::array<float,2>{0.130814046f, 0.909742653f},
-std::array<float,2>{0.833743095f, 0.0241677947f},
-std::array<float,2>{0.282072693f, 0.340653181f},
-std::array<float,2>{0.725333035f, 0.544691145f},
-std::array<float,2>{0.384745747f, 0.668173432f},
-std::array<float,2>{0.53960681f, 0.463790089f},
-std::array<float,2>{0.113247402f, 0.23086758f},
-std::array<float,2>{0.880988717f, 0.811430871f},
-std::array<float,2>{0.349108964f, 0.883437991f},
-std::array<float,2>{0.658165276f, 0.054483708f},
-std::array<float,2>{0.190728739f, 0.362605929f},
-std::array<float,2>{0.79442364f, 0.508312225f},
-std::array<float,2>{0.00855734292f, 0.639406621f},
-std::array<float,2>{0.987577021f, 0.491097659f},
-std::array<float,2>{0.45598489f, 0.208899647f},
-std::array<float,2>{0.601471603f, 0.763602972f},
-std::array<float,2>{0.138716266f, 0.826318264f},
-std::array<float,2>{0.836924493f, 0.141594321f},
-std::array<float,2>{0.295628786f, 0.42609784f},
-std::array<float,2>{0.72776407f, 0.736553729f},
-std::array<float,2>{0.378222138f, 0.59383297f},
-std::array<float,2>{0.538604915f, 0.303576052f},
-std::array<float,2>{0.121204607f, 0.111572348f},
-std::array<float,2>{0.889253318f, 0.996712744f},
-std::array<float,2>{0.472148091f, 0.801316857f},
-std::array<float,2>{0.580350041f, 0.222569749f},
-std::array<float,2>{0.0544178821f, 0.459634274f},
-std::array<float,2>{0.945736885f, 0.656257451f},
-std::array<float,2>{0.2247082f, 0.532326519f},
-std::array<float,2>{0.766731024f, 0.33127436f},
-std::array<float,2>{0.326275498f, 0.0157901384f},
-std::array<float,2>{0.646298409f, 0.916537404f},
-std::array<float,2>{0.0846760198f, 0.953346074f},
-std::array<float,2>{0.929668903f, 0.0654114261f},
-std::array<float,2>{0.427076548f, 0.262724489f},
-std::array<float,2>{0.506032109f, 0.585482001f},
-std::array<float,2>{0.270327479f, 0.694036365f},
-std::array<float,2>{0.688900769f, 0.384406894f},
-std::array<float,2>{0.187456995f, 0.172588125f},
-std::array<float,2>{0.851945698f, 0.853145778f},
-std::array<float,2>{0.413869321f, 0.980378032f},
-std::array<float,2>{0.520201325f, 0.096080564f},
-std::array<float,2>{0.0752592608f, 0.281375915f},
-std::array<float,2>{0.913325071f, 0.62499088f},
-std::array<float,2>{0.163666353f, 0.728315353f},
-std::array<float,2>{0.870579183f, 0.420125037f},
-std::array<float,2>{0.258623302f, 0.135790557f},
-std::array<float,2>{0.705885887f, 0.843395412f},
-std::array<float,2>{0.0415360369f, 0.781183541f},
-std::array<float,2>{0.968294621f, 0.202691972f},
-std::array<float,2>{0.495151013f, 0.470937818f},
-std::array<float,2>{0.577834427f, 0.650951266f},
-std::array<float,2>{0.340831786f, 0.528424501f},
-std::array<float,2>{0.64013344f, 0.347596198f},
-std::array<float,2>{0.237409204f, 0.0467131734f},
-std::array<float,2>{0.753155649f, 0.906006038f},
-std::array<float,2>{0.309923798f, 0.859510124f},
-std::array<float,2>{0.737124562f, 0.163519293f},
-std::array<float,2>{0.145908222f, 0.402987927f},
-std::array<float,2>{0.827871084f, 0.706420779f},
-std::array<float,2>{0.107179582f, 0.575232565f},
-std::array<float,2>{0.895205915f, 0.273395091f},
-std::array<float,2>{0.400590539f, 0.0860306844f},
-std::array<float,2>{0.55522269f, 0.939687729f},
-std::array<float,2>{0.214945734f, 0.937086403f},
-std::array<float,2>{0.812217474f, 0.00544978911f},
-std::array<float,2>{0.363601536f, 0.317478389f},
-std::array<float,2>{0.681783617f, 0.550020993f},
-std::array<float,2>{0.450622499f, 0.678866148f},
-std::array<float,2>{0.622284353f, 0.443515331f},
-std::array<float,2>{0.0251243953f, 0.243902862f},
-std::array<float,2>{0.97468704f, 0.793703437f},
-std::array<float,2>{0.256026328f, 0.945392132f},
-std::array<float,2>{0.716802359f, 0.0848891586f},
-std::array<float,2>{0.170748636f, 0.275405228f},
-std::array<float,2>{0.864587665f, 0.566154599f},
-std::array<float,2>{0.0654970184f, 0.712071478f},
-std::array<float,2>{0.914294958f, 0.395165294f},
-std::array<float,2>{0.418133885f, 0.171033025f},
-std::array<float,2>{0.524080873f, 0.86826396f},
-std::array<float,2>{0.248631388f, 0.787934959f},
-std::array<float,2>{0.757942617f, 0.23763895f},
-std::array<float,2>{0.330898046f, 0.452546954f},
-std::array<float,2>{0.630393565f, 0.682039797f},
-std::array<float,2>{0.488424063f, 0.561206341f},
-std::array<float,2>{0.569828928f, 0.325228155f},
-std::array<float,2>{0.0377338193f, 0.0115587823f},
-std::array<float,2>{0.95888406f, 0.927175105f},
-std::array<float,2>{0.39187032f, 0.829477072f},
-std::array<float,2>{0.548153281f, 0.128480613f},
-std::array<float,2>{0.100412153f, 0.409219146f},
-std::array<float,2>{0.902037382f, 0.722907901f},
-std::array<float,2>{0.150224671f, 0.611649692f},
-std::array<float,2>{0.819486797f, 0.292048037f},
-std::array<float,2>{0.298685312f, 0.104207709f},
-std::array<float,2>{0.748764336f, 0.970769644f},
-std::array<float,2>{0.0198901482f, 0.891456246f},
-std::array<float,2>{0.977105677f, 0.0389598273f},
-std::array<float,2>{0.439170986f, 0.355846971f},
-std::array<float,2>{0.611188412f, 0.515844584f},
-std::array<float,2>{0.373364836f, 0.642383754f},
-std::array<float,2>{0.677612722f, 0.4812738f},
-std::array<float,2>{0.210138902f, 0.188185155f},
-std::array<float,2>{0.801454365f, 0.767760813f},
-std::array<float,2>{0.46130383f, 0.907766402f},
-std::array<float,2>{0.609076679f, 0.0268476177f},
-std::array<float,2>{0.00394732552f, 0.342829138f},
-std::array<float,2>{0.994127691f, 0.545785248f},
-std::array<float,2>{0.196497485f, 0.671230972f},
-std::array<float,2>{0.781343877f, 0.462768108f},
-std::array<float,2>{0.357856423f, 0.233334914f},
-std::array<float,2>{0.665615022f, 0.808854997f},
-std::array<float,2>{0.111636348f, 0.850294471f},
-std::array<float,2>{0.88224417f, 0.180188686f},
-std::array<float,2>{0.383755296f, 0.377719313f},
-std::array<float,2>{0.540681958f, 0.69817096f},
-std::array<float,2>{0.282973737f, 0.592434585f},
-std::array<float,2>{0.72607398f, 0.250762969f},
-std::array<float,2>{0.129772201f, 0.0706694946f},
-std::array<float,2>{0.832064867f, 0.962238967f},
-std::array<float,2>{0.314178199f, 0.75029999f},
-std::array<float,2>{0.655647993f, 0.211611703f},
-std::array<float,2>{0.228335708f, 0.495886117f},
-std::array<float,2>{0.777081907f, 0.631851137f},
-std::array<float,2>{0.0585086085f, 0.503263772f},
-std::array<float,2>{0.9396106f, 0.371039182f},
-std::array<float,2>{0.482300729f, 0.0599167868f},
-std::array<float,2>{0.58932507f, 0.87549752f},
-std::array<float,2>{0.177683398f, 0.986045182f},
-std::array<float,2>{0.849094629f, 0.119462579f},
-std::array<float,2>{0.280837834f, 0.312423348f},
-std::array<float,2>{0.700420618f, 0.609068394f},
-std::array<float,2>{0.434127033f, 0.744707406f},
-std::array<float,2>{0.511461854f, 0.434293747f},
-std::array<float,2>{0.0905726105f, 0.153271258f},
-std::array<float,2>{0.933685064f, 0.813241482f},
-std::array<float,2>{0.334237367f, 0.995438337f},
-std::array<float,2>{0.628286481f, 0.113575272f},
-std::array<float,2>{0.243564412f, 0.299433649f},
-std::array<float,2>{0.764577091f, 0.598254383f},
-std::array<float,2>{0.0317732953f, 0.739469469f},
-std::array<float,2>{0.954029441f, 0.423006535f},
-std::array<float,2>{0.487011433f, 0.148025081f},
-std::array<float,2>{0.563284039f, 0.822041988f},
-std::array<float,2>{0.164377317f, 0.758618355f},
-std::array<float,2>{0.862059295f, 0.203526869f},
-std::array<float,2>{0.251402259f, 0.488215953f},
-std::array<float,2>{0.714311063f, 0.634959698f},
-std::array<float,2>{0.414330691f, 0.514389992f},
-std::array<float,2>{0.528958976f, 0.365016699f},
-std::array<float,2>{0.0689286515f, 0.0492996275f},
-std::array<float,2>{0.920376599f, 0.889180422f},
-std::array<float,2>{0.443597168f, 0.858878791f},
-std::array<float,2>{0.613926053f, 0.176383808f},
-std::array<float,2>{0.0166814961f, 0.389531821f},
-std::array<float,2>{0.982277691f, 0.690350115f},
-std::array<float,2>{0.204454958f, 0.580563307f},
-std::array<float,2>{0.798720479f, 0.258538246f},
-std::array<float,2>{0.369925857f, 0.0668445975f},
-std::array<float,2>{0.672663033f, 0.957282722f},
-std::array<float,2>{0.0952531621f, 0.918637395f},
-std::array<float,2>{0.903712988f, 0.0231809728f},
-std::array<float,2>{0.396567225f, 0.332682759f},
-std::array<float,2>{0.552193999f, 0.535944462f},
-std::array<float,2>{0.302598774f, 0.66156292f},
-std::array<float,2>{0.743935287f, 0.45542106f},
-std::array<float,2>{0.156132773f, 0.225018799f},
-std::array<float,2>{0.81636107f, 0.798335314f},
-std::array<float,2>{0.389097154f, 0.900124907f},
-std::array<float,2>{0.545954704f, 0.0398434699f},
-std::array<float,2>{0.113452189f, 0.348614186f},
-std::array<float,2>{0.875101745f, 0.523476064f},
-std::array<float,2>{0.128422648f, 0.653668106f},
-std::array<float,2>{0.830079675f, 0.474615633f},
-std::array<float,2>{0.286061496f, 0.197014093f},
-std::array<float,2>{0.72214365f, 0.774661243f},
-std::array<float,2>{0.00384921744f, 0.83819896f},
-std::array<float,2>{0.997508585f, 0.137941912f},
-std::array<float,2>{0.467170596f, 0.41550523f},
-std::array<float,2>{0.603633106f, 0.731268644f},
-std::array<float,2>{0.353518814f, 0.620242417f},
-std::array<float,2>{0.671174526f, 0.286894292f},
-std::array<float,2>{0.199528188f, 0.0981323272f},
-std::array<float,2>{0.786046743f, 0.981841683f},
-std::array<float,2>{0.276490331f, 0.792922318f},
-std::array<float,2>{0.698077083f, 0.247108683f},
-std::array<float,2>{0.17363742f, 0.440957099f},
-std::array<float,2>{0.846630514f, 0.674214542f},
-std::array<float,2>{0.0878796875f, 0.552454233f},
-std::array<float,2>{0.930734336f, 0.312524468f},
-std::array<float,2>{0.432941794f, 0.00150975678f},
-std::array<float,2>{0.513707697f, 0.930860877f},
-std::array<float,2>{0.231020123f, 0.943253398f},
-std::array<float,2>{0.777558565f, 0.0903593823f},
-std::array<float,2>{0.317542225f, 0.268721908f},
-std::array<float,2>{0.648463964f, 0.57221204f},
-std::array<float,2>{0.478370011f, 0.710185528f},
-std::array<float,2>{0.591933429f, 0.400234133f},
-std::array<float,2>{0.0600326844f, 0.157018736f},
-std::array<float,2>{0.941730976f, 0.866219103f},
-std::array<float,2>{0.289447248f, 0.9223364f},
-std::array<float,2>{0.733659327f, 0.0140367188f},
-std::array<float,2>{0.133131698f, 0.323145121f},
-std::array<float,2>{0.841278851f, 0.555524945f},
-std::array<float,2>{0.117504552f, 0.687179446f},
-std::array<float,2>{0.883619666f, 0.447629064f},
-std::array<float,2>{0.379708439f, 0.239454269f},
-std::array<float,2>{0.534659326f, 0.784135878f},
-std::array<float,2>{0.192225978f, 0.873337269f},
-std::array<float,2>{0.791000009f, 0.166380465f},
-std::array<float,2>{0.3454566f, 0.392958254f},
-std::array<float,2>{0.660905421f, 0.717354059f},
-std::array<float,2>{0.459739208f, 0.569556773f},
-std::array<float,2>{0.595996857f, 0.28017211f},
-std::array<float,2>{0.0133028096f, 0.0786753073f},
-std::array<float,2>{0.989167571f, 0.950643778f},
-std::array<float,2>{0.423011094f, 0.772771418f},
-std::array<float,2>{0.502300143f, 0.194277674f},
-std::array<float,2>{0.0794192627f, 0.478006721f},
-std::array<float,2>{0.924840868f, 0.646437824f},
-std::array<float,2>{0.179957524f, 0.520679891f},
-std::array<float,2>{0.857492745f, 0.354839116f},
-std::array<float,2>{0.268295527f, 0.0338706784f},
-std::array<float,2>{0.692985952f, 0.89577359f},
-std::array<float,2>{0.0507533178f, 0.976384938f},
-std::array<float,2>{0.950032771f, 0.10720472f},
-std::array<float,2>{0.475949168f, 0.296858162f},
-std::array<float,2>{0.584294617f, 0.614089429f},
-std::array<float,2>{0.323823243f, 0.721573889f},
-std::array<float,2>{0.642307997f, 0.410427511f},
-std::array<float,2>{0.220166951f, 0.131685346f},
-std::array<float,2>{0.769986987f, 0.832571208f},
-std::array<float,2>{0.499191701f, 0.967150986f},
-std::array<float,2>{0.572670639f, 0.0757112652f},
-std::array<float,2>{0.044777289f, 0.254465163f},
-std::array<float,2>{0.961656094f, 0.586562037f},
-std::array<float,2>{0.239601269f, 0.69937259f},
-std::array<float,2>{0.754792333f, 0.379426509f},
-std::array<float,2>{0.335975587f, 0.186968371f},
-std::array<float,2>{0.635267258f, 0.844791412f},
-std::array<float,2>{0.0728436932f, 0.806740224f},
-std::array<float,2>{0.906489849f, 0.227566063f},
-std::array<float,2>{0.407484353f, 0.467107952f},
-std::array<float,2>{0.519298494f, 0.664142191f},
-std::array<float,2>{0.263309658f, 0.539125383f},
-std::array<float,2>{0.710239351f, 0.336724132f},
-std::array<float,2>{0.156703711f, 0.0287488196f},
-std::array<float,2>{0.873429418f, 0.910212636f},
-std::array<float,2>{0.363042474f, 0.818449855f},
-std::array<float,2>{0.686311662f, 0.1489003f},
-std::array<float,2>{0.213522732f, 0.433309436f},
-std::array<float,2>{0.805876732f, 0.74823302f},
-std::array<float,2>{0.0284373369f, 0.602066934f},
-std::array<float,2>{0.971052885f, 0.305802435f},
-std::array<float,2>{0.447532773f, 0.123578295f},
-std::array<float,2>{0.618713975f, 0.990692139f},
-std::array<float,2>{0.142140895f, 0.88148433f},
-std::array<float,2>{0.820693135f, 0.0564148314f},
-std::array<float,2>{0.306169569f, 0.372576863f},
-std::array<float,2>{0.740906179f, 0.505268693f},
-std::array<float,2>{0.403819323f, 0.628851235f},
-std::array<float,2>{0.562218964f, 0.49703446f},
-std::array<float,2>{0.102027938f, 0.215705842f},
-std::array<float,2>{0.891188383f, 0.75414747f},
-std::array<float,2>{0.325673997f, 0.9153561f},
-std::array<float,2>{0.647529662f, 0.0182560049f},
-std::array<float,2>{0.222750902f, 0.329758704f},
-std::array<float,2>{0.768342435f, 0.53455025f},
-std::array<float,2>{0.0515032597f, 0.659509778f},
-std::array<float,2>{0.948053896f, 0.457559884f},
-std::array<float,2>{0.468892455f, 0.219686061f},
-std::array<float,2>{0.578154564f, 0.802940965f},
-std::array<float,2>{0.184643835f, 0.854061902f},
-std::array<float,2>{0.854132712f, 0.174123958f},
-std::array<float,2>{0.272522658f, 0.385620624f},
-std::array<float,2>{0.68993181f, 0.691406667f},
-std::array<float,2>{0.428776532f, 0.582907081f},
-std::array<float,2>{0.504861116f, 0.264301062f},
-std::array<float,2>{0.0828970149f, 0.0636000335f},
-std::array<float,2>{0.926028609f, 0.955332935f},
-std::array<float,2>{0.453850329f, 0.764051855f},
-std::array<float,2>{0.598983467f, 0.21055311f},
-std::array<float,2>{0.0114187812f, 0.488996327f},
-std::array<float,2>{0.986238956f, 0.637034357f},
-std::array<float,2>{0.188464731f, 0.511394799f},
-std::array<float,2>{0.795629263f, 0.359944224f},
-std::array<float,2>{0.350851655f, 0.0516138747f},
-std::array<float,2>{0.659953713f, 0.88485682f},
-std::array<float,2>{0.123225622f, 0.999695599f},
-std::array<float,2>{0.887002528f, 0.110374138f},
-std::array<float,2>{0.37649861f, 0.301385552f},
-std::array<float,2>{0.535882771f, 0.596466899f},
-std::array<float,2>{0.293108612f, 0.736284256f},
-std::array<float,2>{0.728631139f, 0.428175837f},
-std::array<float,2>{0.137782723f, 0.14318268f},
-std::array<float,2>{0.839199543f, 0.825867891f},
-std::array<float,2>{0.399863303f, 0.93929857f},
-std::array<float,2>{0.557345867f, 0.0884901062f},
-std::array<float,2>{0.108481981f, 0.270761997f},
-std::array<float,2>{0.896775424f, 0.577494919f},
-std::array<float,2>{0.148134738f, 0.704193413f},
-std::array<float,2>{0.824247479f, 0.405655831f},
-std::array<float,2>{0.312372327f, 0.160576895f},
-std::array<float,2>{0.735334694f, 0.862717569f},
-std::array<float,2>{0.0271023251f, 0.79527688f},
-std::array<float,2>{0.973695159f, 0.245480776f},
-std::array<float,2>{0.452826381f, 0.442480743f},
-std::array<float,2>{0.624849439f, 0.676208794f},
-std::array<float,2>{0.366037875f, 0.547386944f},
-std::array<float,2>{0.680168331f, 0.319923043f},
-std::array<float,2>{0.218253374f, 0.00617742259f},
-std::array<float,2>{0.8092255f, 0.935068667f},
-std::array<float,2>{0.260835648f, 0.839870155f},
-std::array<float,2>{0.703609765f, 0.134703845f},
-std::array<float,2>{0.161207408f, 0.419390589f},
-std::array<float,2>{0.868684471f, 0.729833066f},
-std::array<float,2>{0.0778225735f, 0.622518837f},
-std::array<float,2>{0.91106236f, 0.285038888f},
-std::array<float,2>{0.412025452f, 0.0950281247f},
-std::array<float,2>{0.52209866f, 0.978229702f},
-std::array<float,2>{0.235239714f, 0.904060721f},
-std::array<float,2>{0.751139641f, 0.0446356833f},
-std::array<float,2>{0.342770517f, 0.344279647f},
-std::array<float,2>{0.637533367f, 0.530194104f},
-std::array<float,2>{0.493256778f, 0.650035143f},
-std::array<float,2>{0.575013518f, 0.470420003f},
-std::array<float,2>{0.0402814448f, 0.201151937f},
-std::array<float,2>{0.966207087f, 0.777411997f},
-std::array<float,2>{0.300008327f, 0.96999681f},
-std::array<float,2>{0.747582853f, 0.102562748f},
-std::array<float,2>{0.15184474f, 0.289851785f},
-std::array<float,2>{0.81806314f, 0.610459507f},
-std::array<float,2>{0.0987092629f, 0.726297319f},
-std::array<float,2>{0.900107563f, 0.406862766f},
-std::array<float,2>{0.393740326f, 0.12593253f},
-std::array<float,2>{0.549783349f, 0.830469072f},
-std::array<float,2>{0.207563341f, 0.767146587f},
-std::array<float,2>{0.802792251f, 0.190536633f},
-std::array<float,2>{0.372244477f, 0.483317345f},
-std::array<float,2>{0.677784443f, 0.643150687f},
-std::array<float,2>{0.439884812f, 0.519419134f},
-std::array<float,2>{0.611974895f, 0.358960629f},
-std::array<float,2>{0.0223775208f, 0.0351928473f},
-std::array<float,2>{0.97929883f, 0.893306673f},
-std::array<float,2>{0.420356721f, 0.869931757f},
-std::array<float,2>{0.526306748f, 0.168873072f},
-std::array<float,2>{0.0635870844f, 0.397560149f},
-std::array<float,2>{0.917453408f, 0.713061631f},
-std::array<float,2>{0.169423297f, 0.562978745f},
-std::array<float,2>{0.866897821f, 0.274165303f},
-std::array<float,2>{0.254099369f, 0.0824169293f},
-std::array<float,2>{0.715397835f, 0.948704481f},
-std::array<float,2>{0.0369478241f, 0.928620219f},
-std::array<float,2>{0.96018827f, 0.00875249412f},
-std::array<float,2>{0.491716295f, 0.326263815f},
-std::array<float,2>{0.567413092f, 0.560025036f},
-std::array<float,2>{0.329601288f, 0.67992121f},
-std::array<float,2>{0.632130027f, 0.450450182f},
-std::array<float,2>{0.246598497f, 0.23631151f},
-std::array<float,2>{0.760607064f, 0.786201596f},
-std::array<float,2>{0.482930571f, 0.877357662f},
-std::array<float,2>{0.586415946f, 0.0624557175f},
-std::array<float,2>{0.0565364473f, 0.368159205f},
-std::array<float,2>{0.939148784f, 0.500510871f},
-std::array<float,2>{0.229572162f, 0.630001903f},
-std::array<float,2>{0.774000347f, 0.492658466f},
-std::array<float,2>{0.315783739f, 0.214715734f},
-std::array<float,2>{0.65299654f, 0.753229737f},
-std::array<float,2>{0.0924751312f, 0.814914823f},
-std::array<float,2>{0.936397135f, 0.15489459f},
-std::array<float,2>{0.436868727f, 0.437335402f},
-std::array<float,2>{0.508542418f, 0.744054139f},
-std::array<float,2>{0.277770758f, 0.606590033f},
-std::array<float,2>{0.702914774f, 0.309824675f},
-std::array<float,2>{0.179308191f, 0.117922217f},
-std::array<float,2>{0.849647999f, 0.987599313f},
-std::array<float,2>{0.355565608f, 0.811276495f},
-std::array<float,2>{0.667931676f, 0.230499491f},
-std::array<float,2>{0.198609322f, 0.463510722f},
-std::array<float,2>{0.783780277f, 0.6682235f},
-std::array<float,2>{0.00725845667f, 0.544555187f},
-std::array<float,2>{0.994927824f, 0.340555608f},
-std::array<float,2>{0.463857412f, 0.0242637806f},
-std::array<float,2>{0.606613874f, 0.91003406f},
-std::array<float,2>{0.131564155f, 0.964443207f},
-std::array<float,2>{0.834959686f, 0.0734657049f},
-std::array<float,2>{0.283833623f, 0.252742887f},
-std::array<float,2>{0.724234104f, 0.591773212f},
-std::array<float,2>{0.38526395f, 0.696395338f},
-std::array<float,2>{0.542672098f, 0.375481516f},
-std::array<float,2>{0.109627344f, 0.182438761f},
-std::array<float,2>{0.880557835f, 0.848103166f},
-std::array<float,2>{0.367709607f, 0.959488511f},
-std::array<float,2>{0.674421728f, 0.0690005347f},
-std::array<float,2>{0.205876738f, 0.260264605f},
-std::array<float,2>{0.800376236f, 0.579058111f},
-std::array<float,2>{0.0193923637f, 0.688791275f},
-std::array<float,2>{0.983093858f, 0.387979776f},
-std::array<float,2>{0.442727804f, 0.17786932f},
-std::array<float,2>{0.615669429f, 0.85673821f},
-std::array<float,2>{0.153716743f, 0.799133778f},
-std::array<float,2>{0.813727438f, 0.224246144f},
-std::array<float,2>{0.304278314f, 0.454055607f},
-std::array<float,2>{0.744805098f, 0.663176179f},
-std::array<float,2>{0.395215154f, 0.537924886f},
-std::array<float,2>{0.553767085f, 0.334474742f},
-std::array<float,2>{0.0975071117f, 0.021204561f},
-std::array<float,2>{0.905313432f, 0.920464098f},
-std::array<float,2>{0.484745443f, 0.824208617f},
-std::array<float,2>{0.566299796f, 0.145507067f},
-std::array<float,2>{0.0341912992f, 0.425413042f},
-std::array<float,2>{0.956077278f, 0.741784573f},
-std::array<float,2>{0.246038765f, 0.600038588f},
-std::array<float,2>{0.762307882f, 0.29839623f},
-std::array<float,2>{0.333725631f, 0.116496496f},
-std::array<float,2>{0.626206219f, 0.993800938f},
-std::array<float,2>{0.0664408728f, 0.887960672f},
-std::array<float,2>{0.918141186f, 0.0475629233f},
-std::array<float,2>{0.416351676f, 0.366334677f},
-std::array<float,2>{0.529389381f, 0.512563229f},
-std::array<float,2>{0.253839046f, 0.634198666f},
-std::array<float,2>{0.712485492f, 0.485745907f},
-std::array<float,2>{0.167752042f, 0.206312597f},
-std::array<float,2>{0.860368013f, 0.760630369f},
-std::array<float,2>{0.429970384f, 0.93175143f},
-std::array<float,2>{0.512948155f, 0.00305163581f},
-std::array<float,2>{0.0881269798f, 0.315680981f},
-std::array<float,2>{0.933031797f, 0.552918673f},
-std::array<float,2>{0.175480872f, 0.672672033f},
-std::array<float,2>{0.844943404f, 0.43833369f},
-std::array<float,2>{0.273456514f, 0.24962765f},
-std::array<float,2>{0.696876943f, 0.789320886f},
-std::array<float,2>{0.0612246655f, 0.864866853f},
-std::array<float,2>{0.944661915f, 0.159777761f},
-std::array<float,2>{0.47856319f, 0.400960922f},
-std::array<float,2>{0.590254843f, 0.707389474f},
-std::array<float,2>{0.318806142f, 0.573269844f},
-std::array<float,2>{0.651215971f, 0.265625775f},
-std::array<float,2>{0.233734176f, 0.0927364901f},
-std::array<float,2>{0.780111849f, 0.943904757f},
-std::array<float,2>{0.288819641f, 0.776408792f},
-std::array<float,2>{0.719043612f, 0.197735742f},
-std::array<float,2>{0.125784799f, 0.473979801f},
-std::array<float,2>{0.82985121f, 0.654584348f},
-std::array<float,2>{0.116540641f, 0.526131332f},
-std::array<float,2>{0.878474832f, 0.349907964f},
-std::array<float,2>{0.38845709f, 0.0426873043f},
-std::array<float,2>{0.543814182f, 0.900858343f},
-std::array<float,2>{0.201352015f, 0.983486116f},
-std::array<float,2>{0.788231015f, 0.10060022f},
-std::array<float,2>{0.352013528f, 0.288879961f},
-std::array<float,2>{0.66942364f, 0.618965507f},
-std::array<float,2>{0.466514558f, 0.734310687f},
-std::array<float,2>{0.602697849f, 0.41613248f},
-std::array<float,2>{0.000699262251f, 0.138712108f},
-std::array<float,2>{0.998331308f, 0.837112665f},
-std::array<float,2>{0.266837955f, 0.898374379f},
-std::array<float,2>{0.693468094f, 0.0330222547f},
-std::array<float,2>{0.182908148f, 0.353265405f},
-std::array<float,2>{0.8559829f, 0.523367703f},
-std::array<float,2>{0.0812561437f, 0.646915674f},
-std::array<float,2>{0.923146844f, 0.479913831f},
-std::array<float,2>{0.424723685f, 0.19329913f},
-std::array<float,2>{0.501170278f, 0.770255506f},
-std::array<float,2>{0.221169218f, 0.835744441f},
-std::array<float,2>{0.771898627f, 0.129050866f},
-std::array<float,2>{0.321363419f, 0.413193434f},
-std::array<float,2>{0.64281261f, 0.719899774f},
-std::array<float,2>{0.474185199f, 0.616179764f},
-std::array<float,2>{0.582869649f, 0.293960154f},
-std::array<float,2>{0.047675956f, 0.109017588f},
-std::array<float,2>{0.951356709f, 0.973144174f},
-std::array<float,2>{0.380881816f, 0.782738924f},
-std::array<float,2>{0.532770991f, 0.240815595f},
-std::array<float,2>{0.120796621f, 0.445410162f},
-std::array<float,2>{0.886232793f, 0.684649825f},
-std::array<float,2>{0.134939775f, 0.557495058f},
-std::array<float,2>{0.842936695f, 0.3211191f},
-std::array<float,2>{0.291648209f, 0.0136404103f},
-std::array<float,2>{0.731804192f, 0.92486012f},
-std::array<float,2>{0.0136844115f, 0.953072488f},
-std::array<float,2>{0.991469502f, 0.0802275464f},
-std::array<float,2>{0.458304673f, 0.279241234f},
-std::array<float,2>{0.595332801f, 0.567841589f},
-std::array<float,2>{0.345857322f, 0.714967132f},
-std::array<float,2>{0.663562775f, 0.390715092f},
-std::array<float,2>{0.19453536f, 0.165268525f},
-std::array<float,2>{0.791345417f, 0.872315109f},
-std::array<float,2>{0.446502954f, 0.989159167f},
-std::array<float,2>{0.620856106f, 0.122889496f},
-std::array<float,2>{0.030872656f, 0.306864321f},
-std::array<float,2>{0.969842613f, 0.604933143f},
-std::array<float,2>{0.211546436f, 0.746746957f},
-std::array<float,2>{0.807886899f, 0.429846942f},
-std::array<float,2>{0.361189038f, 0.1509756f},
-std::array<float,2>{0.684586406f, 0.817759871f},
-std::array<float,2>{0.103709914f, 0.757472157f},
-std::array<float,2>{0.892743826f, 0.218320996f},
-std::array<float,2>{0.404628813f, 0.499254316f},
-std::array<float,2>{0.559072673f, 0.626199067f},
-std::array<float,2>{0.306669235f, 0.507698417f},
-std::array<float,2>{0.738985181f, 0.373947203f},
-std::array<float,2>{0.143063262f, 0.0569742247f},
-std::array<float,2>{0.822667301f, 0.879587233f},
-std::array<float,2>{0.339270085f, 0.847386837f},
-std::array<float,2>{0.633098602f, 0.185394332f},
-std::array<float,2>{0.24129729f, 0.382101148f},
-std::array<float,2>{0.757704198f, 0.702330709f},
-std::array<float,2>{0.0461267605f, 0.58796978f},
-std::array<float,2>{0.962906003f, 0.256759942f},
-std::array<float,2>{0.496836811f, 0.0766484961f},
-std::array<float,2>{0.57196641f, 0.964968026f},
-std::array<float,2>{0.158904836f, 0.913800418f},
-std::array<float,2>{0.871543944f, 0.0302902013f},
-std::array<float,2>{0.264866322f, 0.339260489f},
-std::array<float,2>{0.707486629f, 0.54144901f},
-std::array<float,2>{0.409555793f, 0.66683501f},
-std::array<float,2>{0.517031014f, 0.465899974f},
-std::array<float,2>{0.0718741193f, 0.229098082f},
-std::array<float,2>{0.909393609f, 0.805876791f},
-std::array<float,2>{0.343566656f, 0.904903352f},
-std::array<float,2>{0.637876093f, 0.0457645655f},
-std::array<float,2>{0.235855594f, 0.345823973f},
-std::array<float,2>{0.750407338f, 0.527893782f},
-std::array<float,2>{0.0395794436f, 0.652127564f},
-std::array<float,2>{0.965630651f, 0.472105622f},
-std::array<float,2>{0.492911309f, 0.201583803f},
-std::array<float,2>{0.575895727f, 0.779857218f},
-std::array<float,2>{0.160745114f, 0.841883183f},
-std::array<float,2>{0.867303669f, 0.135093555f},
-std::array<float,2>{0.259824812f, 0.421646982f},
-std::array<float,2>{0.704782903f, 0.726707041f},
-std::array<float,2>{0.410215497f, 0.623082995f},
-std::array<float,2>{0.52294296f, 0.282378554f},
-std::array<float,2>{0.0770438313f, 0.0974290296f},
-std::array<float,2>{0.911192775f, 0.97913444f},
-std::array<float,2>{0.45176515f, 0.794911087f},
-std::array<float,2>{0.62338382f, 0.242303774f},
-std::array<float,2>{0.026321942f, 0.444433779f},
-std::array<float,2>{0.972826719f, 0.677969038f},
-std::array<float,2>{0.217597857f, 0.54902935f},
-std::array<float,2>{0.810478568f, 0.316979051f},
-std::array<float,2>{0.366911381f, 0.00445198128f},
-std::array<float,2>{0.681131601f, 0.935948849f},
-std::array<float,2>{0.107801035f, 0.941338539f},
-std::array<float,2>{0.897947609f, 0.087647371f},
-std::array<float,2>{0.399351776f, 0.271761328f},
-std::array<float,2>{0.557803929f, 0.574569762f},
-std::array<float,2>{0.311439037f, 0.705641747f},
-std::array<float,2>{0.735819697f, 0.404015571f},
-std::array<float,2>{0.146596238f, 0.162320435f},
-std::array<float,2>{0.825562537f, 0.861275434f},
-std::array<float,2>{0.375124902f, 0.99758786f},
-std::array<float,2>{0.536502302f, 0.112566017f},
-std::array<float,2>{0.124682091f, 0.303807914f},
-std::array<float,2>{0.888129234f, 0.595199406f},
-std::array<float,2>{0.137521818f, 0.737626493f},
-std::array<float,2>{0.838351607f, 0.426802874f},
-std::array<float,2>{0.293950438f, 0.141878739f},
-std::array<float,2>{0.730178058f, 0.827496767f},
-std::array<float,2>{0.00981073547f, 0.761803031f},
-std::array<float,2>{0.985212088f, 0.207210213f},
-std::array<float,2>{0.454656214f, 0.491514236f},
-std::array<float,2>{0.59837538f, 0.639718056f},
-std::array<float,2>{0.350223958f, 0.509354353f},
-std::array<float,2>{0.658338606f, 0.361770093f},
-std::array<float,2>{0.188802406f, 0.0529325232f},
-std::array<float,2>{0.79661864f, 0.883966982f},
-std::array<float,2>{0.272440523f, 0.851675808f},
-std::array<float,2>{0.691014946f, 0.172862396f},
-std::array<float,2>{0.18365398f, 0.383735806f},
-std::array<float,2>{0.855355799f, 0.694906831f},
-std::array<float,2>{0.0834472477f, 0.584923446f},
-std::array<float,2>{0.927561224f, 0.261966914f},
-std::array<float,2>{0.428299665f, 0.0654651225f},
-std::array<float,2>{0.504987419f, 0.954451621f},
-std::array<float,2>{0.224407405f, 0.91795969f},
-std::array<float,2>{0.769234061f, 0.0170983728f},
-std::array<float,2>{0.325119793f, 0.330300719f},
-std::array<float,2>{0.647322714f, 0.531732559f},
-std::array<float,2>{0.470645756f, 0.657887042f},
-std::array<float,2>{0.57919699f, 0.460136026f},
-std::array<float,2>{0.0520563796f, 0.221676126f},
-std::array<float,2>{0.948781729f, 0.801931798f},
-std::array<float,2>{0.284530908f, 0.960996866f},
-std::array<float,2>{0.72311902f, 0.0714171529f},
-std::array<float,2>{0.132688642f, 0.251726866f},
-std::array<float,2>{0.835503638f, 0.592837214f},
-std::array<float,2>{0.110610962f, 0.698344588f},
-std::array<float,2>{0.879808724f, 0.37863034f},
-std::array<float,2>{0.386433512f, 0.181115568f},
-std::array<float,2>{0.541660666f, 0.850598574f},
-std::array<float,2>{0.197667003f, 0.809989512f},
-std::array<float,2>{0.784908891f, 0.234303877f},
-std::array<float,2>{0.357079685f, 0.461556137f},
-std::array<float,2>{0.666380227f, 0.669926465f},
-std::array<float,2>{0.464327544f, 0.546297014f},
-std::array<float,2>{0.605713248f, 0.34252882f},
-std::array<float,2>{0.00628463505f, 0.0262034666f},
-std::array<float,2>{0.995714307f, 0.906271815f},
-std::array<float,2>{0.436053216f, 0.81355536f},
-std::array<float,2>{0.508961558f, 0.15388912f},
-std::array<float,2>{0.0932683125f, 0.435131609f},
-std::array<float,2>{0.936582625f, 0.745748401f},
-std::array<float,2>{0.178128242f, 0.608013451f},
-std::array<float,2>{0.850627661f, 0.310585916f},
-std::array<float,2>{0.278497964f, 0.120790392f},
-std::array<float,2>{0.701262355f, 0.984796286f},
-std::array<float,2>{0.0548939221f, 0.876269579f},
-std::array<float,2>{0.938123941f, 0.0587713085f},
-std::array<float,2>{0.483786404f, 0.369685411f},
-std::array<float,2>{0.587435722f, 0.502919495f},
-std::array<float,2>{0.314541757f, 0.631326854f},
-std::array<float,2>{0.653711855f, 0.494600326f},
-std::array<float,2>{0.228980854f, 0.212019712f},
-std::array<float,2>{0.775364935f, 0.751075387f},
-std::array<float,2>{0.491122425f, 0.925921738f},
-std::array<float,2>{0.566860199f, 0.00999393594f},
-std::array<float,2>{0.0357810147f, 0.32425043f},
-std::array<float,2>{0.959537148f, 0.562081754f},
-std::array<float,2>{0.247678787f, 0.683133841f},
-std::array<float,2>{0.761655807f, 0.452036172f},
-std::array<float,2>{0.328939319f, 0.236565903f},
-std::array<float,2>{0.631689489f, 0.788837552f},
-std::array<float,2>{0.0631811097f, 0.868099093f},
-std::array<float,2>{0.916052163f, 0.170045331f},
-std::array<float,2>{0.420990646f, 0.395519048f},
-std::array<float,2>{0.527193904f, 0.711528242f},
-std::array<float,2>{0.255574316f, 0.565050185f},
-std::array<float,2>{0.716189802f, 0.277140766f},
-std::array<float,2>{0.168213502f, 0.0853063688f},
-std::array<float,2>{0.865928948f, 0.947076082f},
-std::array<float,2>{0.371294558f, 0.769504488f},
-std::array<float,2>{0.679157853f, 0.188749954f},
-std::array<float,2>{0.208557174f, 0.482398719f},
-std::array<float,2>{0.804681301f, 0.641459465f},
-std::array<float,2>{0.0231472328f, 0.517002523f},
-std::array<float,2>{0.979810953f, 0.356761307f},
-std::array<float,2>{0.440471113f, 0.0379997827f},
-std::array<float,2>{0.613261819f, 0.891727924f},
-std::array<float,2>{0.151339397f, 0.972465277f},
-std::array<float,2>{0.817263544f, 0.104975052f},
-std::array<float,2>{0.299525201f, 0.291624725f},
-std::array<float,2>{0.746098042f, 0.61275667f},
-std::array<float,2>{0.393129915f, 0.723901033f},
-std::array<float,2>{0.55054301f, 0.40898791f},
-std::array<float,2>{0.097845003f, 0.127712026f},
-std::array<float,2>{0.899200797f, 0.828236163f},
-std::array<float,2>{0.352870077f, 0.981412768f},
-std::array<float,2>{0.668344319f, 0.0992857143f},
-std::array<float,2>{0.20239532f, 0.285944819f},
-std::array<float,2>{0.788008511f, 0.619241238f},
-std::array<float,2>{0.00140875066f, 0.732261837f},
-std::array<float,2>{0.999449432f, 0.414523691f},
-std::array<float,2>{0.465120375f, 0.137611598f},
-std::array<float,2>{0.602086961f, 0.839679122f},
-std::array<float,2>{0.12656188f, 0.774028659f},
-std::array<float,2>{0.828453422f, 0.196165636f},
-std::array<float,2>{0.287521273f, 0.476033747f},
-std::array<float,2>{0.719906986f, 0.653012395f},
-std::array<float,2>{0.386826485f, 0.524554372f},
-std::array<float,2>{0.544053316f, 0.349227428f},
-std::array<float,2>{0.116037868f, 0.0409034155f},
-std::array<float,2>{0.877536297f, 0.898654282f},
-std::array<float,2>{0.480269343f, 0.8652879f},
-std::array<float,2>{0.591042578f, 0.157524541f},
-std::array<float,2>{0.061610233f, 0.398571789f},
-std::array<float,2>{0.943745255f, 0.709732354f},
-std::array<float,2>{0.233332604f, 0.570725322f},
-std::array<float,2>{0.78066659f, 0.2676799f},
-std::array<float,2>{0.319370627f, 0.090899609f},
-std::array<float,2>{0.651640117f, 0.941781044f},
-std::array<float,2>{0.0897666663f, 0.930235684f},
-std::array<float,2>{0.931889117f, 0.00079507113f},
-std::array<float,2>{0.430856556f, 0.31348601f},
-std::array<float,2>{0.511915088f, 0.551511705f},
-std::array<float,2>{0.274914503f, 0.675170541f},
-std::array<float,2>{0.695689201f, 0.439771473f},
-std::array<float,2>{0.174578875f, 0.246371478f},
-std::array<float,2>{0.844495833f, 0.791650891f},
-std::array<float,2>{0.417186975f, 0.89034152f},
-std::array<float,2>{0.530350506f, 0.0507235378f},
-std::array<float,2>{0.0675294846f, 0.364064157f},
-std::array<float,2>{0.919792116f, 0.514768124f},
-std::array<float,2>{0.166606337f, 0.636620998f},
-std::array<float,2>{0.859692037f, 0.486978054f},
-std::array<float,2>{0.252889156f, 0.205077097f},
-std::array<float,2>{0.711195827f, 0.759665489f},
-std::array<float,2>{0.0338988267f, 0.820602655f},
-std::array<float,2>{0.955784142f, 0.146957457f},
-std::array<float,2>{0.485706478f, 0.422323763f},
-std::array<float,2>{0.565122783f, 0.738424718f},
-std::array<float,2>{0.332849085f, 0.598989189f},
-std::array<float,2>{0.625624657f, 0.300578088f},
-std::array<float,2>{0.244551495f, 0.114774048f},
-std::array<float,2>{0.762907982f, 0.994142592f},
-std::array<float,2>{0.303475708f, 0.797102273f},
-std::array<float,2>{0.746040463f, 0.2261599f},
-std::array<float,2>{0.152798042f, 0.456685156f},
-std::array<float,2>{0.812736094f, 0.661011338f},
-std::array<float,2>{0.0964494869f, 0.536929011f},
-std::array<float,2>{0.904911101f, 0.333766878f},
-std::array<float,2>{0.395527333f, 0.0216905847f},
-std::array<float,2>{0.552854538f, 0.919428647f},
-std::array<float,2>{0.206135318f, 0.958274007f},
-std::array<float,2>{0.799586594f, 0.0674812347f},
-std::array<float,2>{0.369063735f, 0.258877099f},
-std::array<float,2>{0.675504267f, 0.581911325f},
-std::array<float,2>{0.442325711f, 0.691074133f},
-std::array<float,2>{0.616323411f, 0.39061138f},
-std::array<float,2>{0.0178791713f, 0.17703025f},
-std::array<float,2>{0.983678818f, 0.857777297f},
-std::array<float,2>{0.26374799f, 0.911542356f},
-std::array<float,2>{0.708423078f, 0.0274191163f},
-std::array<float,2>{0.159531891f, 0.337332457f},
-std::array<float,2>{0.872606039f, 0.540859044f},
-std::array<float,2>{0.0712371022f, 0.665871441f},
-std::array<float,2>{0.908712924f, 0.467920005f},
-std::array<float,2>{0.408226639f, 0.227491185f},
-std::array<float,2>{0.516107857f, 0.808031321f},
-std::array<float,2>{0.240269616f, 0.844100893f},
-std::array<float,2>{0.756110489f, 0.185951322f},
-std::array<float,2>{0.338322878f, 0.380834788f},
-std::array<float,2>{0.634483576f, 0.700607419f},
-std::array<float,2>{0.497734189f, 0.587774396f},
-std::array<float,2>{0.570729792f, 0.254939049f},
-std::array<float,2>{0.044952061f, 0.0750126392f},
-std::array<float,2>{0.964601398f, 0.968087494f},
-std::array<float,2>{0.406094372f, 0.755723715f},
-std::array<float,2>{0.560257733f, 0.216081902f},
-std::array<float,2>{0.105114631f, 0.497270614f},
-std::array<float,2>{0.894484758f, 0.627724826f},
-std::array<float,2>{0.143663436f, 0.504563868f},
-std::array<float,2>{0.824101865f, 0.371594518f},
-std::array<float,2>{0.30795756f, 0.0556595623f},
-std::array<float,2>{0.739672959f, 0.882141292f},
-std::array<float,2>{0.0298548136f, 0.992064118f},
-std::array<float,2>{0.968951702f, 0.124916643f},
-std::array<float,2>{0.445819378f, 0.305552572f},
-std::array<float,2>{0.619873047f, 0.603132606f},
-std::array<float,2>{0.359784901f, 0.749025226f},
-std::array<float,2>{0.684241116f, 0.432608694f},
-std::array<float,2>{0.212409914f, 0.150199786f},
-std::array<float,2>{0.807143807f, 0.819387496f},
-std::array<float,2>{0.457092583f, 0.949444473f},
-std::array<float,2>{0.593825221f, 0.0799475238f},
-std::array<float,2>{0.0151732545f, 0.280335635f},
-std::array<float,2>{0.990538001f, 0.568463802f},
-std::array<float,2>{0.193457097f, 0.718089759f},
-std::array<float,2>{0.792634428f, 0.394094169f},
-std::array<float,2>{0.347069055f, 0.167492539f},
-std::array<float,2>{0.662997901f, 0.87415725f},
-std::array<float,2>{0.119469374f, 0.784536302f},
-std::array<float,2>{0.885339081f, 0.238953367f},
-std::array<float,2>{0.382473409f, 0.44856146f},
-std::array<float,2>{0.531639934f, 0.686225891f},
-std::array<float,2>{0.292638838f, 0.556218207f},
-std::array<float,2>{0.731322408f, 0.323753208f},
-std::array<float,2>{0.136197165f, 0.0152208749f},
-std::array<float,2>{0.84190315f, 0.923172712f},
-std::array<float,2>{0.320449471f, 0.833890319f},
-std::array<float,2>{0.644121528f, 0.131944507f},
-std::array<float,2>{0.22246705f, 0.411144137f},
-std::array<float,2>{0.772499502f, 0.721857846f},
-std::array<float,2>{0.0483271219f, 0.61465317f},
-std::array<float,2>{0.952848494f, 0.29539603f},
-std::array<float,2>{0.473291308f, 0.106025435f},
-std::array<float,2>{0.583642006f, 0.975357473f},
-std::array<float,2>{0.182593673f, 0.894930601f},
-std::array<float,2>{0.857341886f, 0.0343104601f},
-std::array<float,2>{0.266371876f, 0.354477674f},
-std::array<float,2>{0.694857955f, 0.520097852f},
-std::array<float,2>{0.42511332f, 0.645053327f},
-std::array<float,2>{0.500326216f, 0.476919144f},
-std::array<float,2>{0.0801991522f, 0.194622621f},
-std::array<float,2>{0.922508419f, 0.771887183f},
-std::array<float,2>{0.365206391f, 0.933842361f},
-std::array<float,2>{0.683339715f, 0.0076687946f},
-std::array<float,2>{0.216338545f, 0.318624198f},
-std::array<float,2>{0.811383188f, 0.548125386f},
-std::array<float,2>{0.0239732061f, 0.677045524f},
-std::array<float,2>{0.975922465f, 0.441589236f},
-std::array<float,2>{0.449517965f, 0.2446495f},
-std::array<float,2>{0.621968567f, 0.796045244f},
-std::array<float,2>{0.145492747f, 0.862240314f},
-std::array<float,2>{0.826533258f, 0.161831707f},
-std::array<float,2>{0.308937967f, 0.404387027f},
-std::array<float,2>{0.73736012f, 0.703594506f},
-std::array<float,2>{0.40191412f, 0.576939762f},
-std::array<float,2>{0.555896819f, 0.270041436f},
-std::array<float,2>{0.106267288f, 0.0889957026f},
-std::array<float,2>{0.89596051f, 0.938415349f},
-std::array<float,2>{0.494532615f, 0.779139102f},
-std::array<float,2>{0.577100277f, 0.20009312f},
-std::array<float,2>{0.0422102585f, 0.469135791f},
-std::array<float,2>{0.96731931f, 0.649263561f},
-std::array<float,2>{0.237182319f, 0.530553222f},
-std::array<float,2>{0.752414465f, 0.345435828f},
-std::array<float,2>{0.34019801f, 0.0437713936f},
-std::array<float,2>{0.639213264f, 0.903107464f},
-std::array<float,2>{0.0742727518f, 0.976864636f},
-std::array<float,2>{0.913004518f, 0.0940083116f},
-std::array<float,2>{0.412164748f, 0.28367883f},
-std::array<float,2>{0.52092582f, 0.621242642f},
-std::array<float,2>{0.259208858f, 0.728961825f},
-std::array<float,2>{0.706460416f, 0.418329984f},
-std::array<float,2>{0.162949935f, 0.133255184f},
-std::array<float,2>{0.869716763f, 0.84165132f},
-std::array<float,2>{0.426379323f, 0.95698899f},
-std::array<float,2>{0.507367909f, 0.0629834086f},
-std::array<float,2>{0.0858459771f, 0.265388548f},
-std::array<float,2>{0.928255618f, 0.583390355f},
-std::array<float,2>{0.185881153f, 0.693082213f},
-std::array<float,2>{0.853219986f, 0.386085987f},
-std::array<float,2>{0.271133631f, 0.174944475f},
-std::array<float,2>{0.687971473f, 0.854846179f},
-std::array<float,2>{0.0527406074f, 0.804195344f},
-std::array<float,2>{0.947136819f, 0.219845593f},
-std::array<float,2>{0.471104294f, 0.45896408f},
-std::array<float,2>{0.581476867f, 0.658482671f},
-std::array<float,2>{0.327526897f, 0.533314824f},
-std::array<float,2>{0.645404875f, 0.32848981f},
-std::array<float,2>{0.226545885f, 0.0186759494f},
-std::array<float,2>{0.766516626f, 0.914498687f},
-std::array<float,2>{0.296560794f, 0.824317992f},
-std::array<float,2>{0.726757407f, 0.143591791f},
-std::array<float,2>{0.139999658f, 0.42906183f},
-std::array<float,2>{0.835937858f, 0.734820068f},
-std::array<float,2>{0.122223638f, 0.596886754f},
-std::array<float,2>{0.890046358f, 0.30185166f},
-std::array<float,2>{0.377222478f, 0.109657779f},
-std::array<float,2>{0.537589252f, 0.998128414f},
-std::array<float,2>{0.189988106f, 0.886267006f},
-std::array<float,2>{0.793753445f, 0.0524783395f},
-std::array<float,2>{0.347870469f, 0.361047566f},
-std::array<float,2>{0.656766057f, 0.510335803f},
-std::array<float,2>{0.456661403f, 0.638654113f},
-std::array<float,2>{0.599742115f, 0.489940792f},
-std::array<float,2>{0.00954597536f, 0.209090337f},
-std::array<float,2>{0.986765921f, 0.765487492f},
-std::array<float,2>{0.279354781f, 0.986720681f},
-std::array<float,2>{0.700111568f, 0.118512087f},
-std::array<float,2>{0.176166162f, 0.309222043f},
-std::array<float,2>{0.847973228f, 0.605673313f},
-std::array<float,2>{0.0917520225f, 0.742234349f},
-std::array<float,2>{0.935543537f, 0.435787588f},
-std::array<float,2>{0.435380459f, 0.155799761f},
-std::array<float,2>{0.50976944f, 0.815852702f},
-std::array<float,2>{0.226823226f, 0.752145112f},
-std::array<float,2>{0.775658011f, 0.213106751f},
-std::array<float,2>{0.31270954f, 0.493541956f},
-std::array<float,2>{0.655120134f, 0.62907964f},
-std::array<float,2>{0.481204599f, 0.501814485f},
-std::array<float,2>{0.588665962f, 0.368249863f},
-std::array<float,2>{0.0573444553f, 0.0606636219f},
-std::array<float,2>{0.940895736f, 0.878619969f},
-std::array<float,2>{0.384204239f, 0.849271178f},
-std::array<float,2>{0.539139807f, 0.183378503f},
-std::array<float,2>{0.112356804f, 0.376833379f},
-std::array<float,2>{0.881773531f, 0.696160257f},
-std::array<float,2>{0.129943192f, 0.589947104f},
-std::array<float,2>{0.833223104f, 0.253368258f},
-std::array<float,2>{0.281568557f, 0.0730653703f},
-std::array<float,2>{0.725046039f, 0.963700771f},
-std::array<float,2>{0.00521811703f, 0.908739269f},
-std::array<float,2>{0.992367208f, 0.0252591111f},
-std::array<float,2>{0.462862492f, 0.341539621f},
-std::array<float,2>{0.607520342f, 0.542973101f},
-std::array<float,2>{0.35850054f, 0.669812679f},
-std::array<float,2>{0.66428864f, 0.463874161f},
-std::array<float,2>{0.195519686f, 0.231930822f},
-std::array<float,2>{0.783136368f, 0.812366724f},
-std::array<float,2>{0.438350171f, 0.894131362f},
-std::array<float,2>{0.61024034f, 0.0367232822f},
-std::array<float,2>{0.0211689677f, 0.357683569f},
-std::array<float,2>{0.978160024f, 0.518259108f},
-std::array<float,2>{0.209008411f, 0.64397049f},
-std::array<float,2>{0.801775515f, 0.483466059f},
-std::array<float,2>{0.374356925f, 0.189886436f},
-std::array<float,2>{0.676246524f, 0.765819907f},
-std::array<float,2>{0.100650989f, 0.831647992f},
-std::array<float,2>{0.900569856f, 0.126925677f},
-std::array<float,2>{0.391370445f, 0.407809258f},
-std::array<float,2>{0.547222137f, 0.725329459f},
-std::array<float,2>{0.297835171f, 0.610305309f},
-std::array<float,2>{0.749658346f, 0.290658474f},
-std::array<float,2>{0.149322346f, 0.102390073f},
-std::array<float,2>{0.819083512f, 0.96891135f},
-std::array<float,2>{0.331291974f, 0.785591245f},
-std::array<float,2>{0.629480302f, 0.235160857f},
-std::array<float,2>{0.249913856f, 0.449909121f},
-std::array<float,2>{0.759370923f, 0.680801272f},
-std::array<float,2>{0.0381857604f, 0.558849573f},
-std::array<float,2>{0.957824886f, 0.327743202f},
-std::array<float,2>{0.489813924f, 0.00933250319f},
-std::array<float,2>{0.568711221f, 0.929593205f},
-std::array<float,2>{0.171252146f, 0.947768748f},
-std::array<float,2>{0.86334759f, 0.0831996128f},
-std::array<float,2>{0.256855518f, 0.274714768f},
-std::array<float,2>{0.718615353f, 0.563945651f},
-std::array<float,2>{0.419798791f, 0.713971794f},
-std::array<float,2>{0.525021672f, 0.397294313f},
-std::array<float,2>{0.065199241f, 0.169517457f},
-std::array<float,2>{0.915538251f, 0.870835662f},
-std::array<float,2>{0.316635102f, 0.945040047f},
-std::array<float,2>{0.650236726f, 0.0935555995f},
-std::array<float,2>{0.231639221f, 0.267429531f},
-std::array<float,2>{0.779106319f, 0.572532475f},
-std::array<float,2>{0.0588922724f, 0.708750665f},
-std::array<float,2>{0.943231404f, 0.40216884f},
-std::array<float,2>{0.476986408f, 0.158478722f},
-std::array<float,2>{0.592914402f, 0.863563657f},
-std::array<float,2>{0.1721185f, 0.790405393f},
-std::array<float,2>{0.846682012f, 0.248841107f},
-std::array<float,2>{0.276008964f, 0.439160287f},
-std::array<float,2>{0.698539376f, 0.673041582f},
-std::array<float,2>{0.43225953f, 0.553802967f},
-std::array<float,2>{0.5153687f, 0.314610839f},
-std::array<float,2>{0.0861338824f, 0.00205562683f},
-std::array<float,2>{0.930327475f, 0.932637215f},
-std::array<float,2>{0.468077749f, 0.836479187f},
-std::array<float,2>{0.604940593f, 0.140498102f},
-std::array<float,2>{0.00259151682f, 0.417755276f},
-std::array<float,2>{0.996106207f, 0.732503116f},
-std::array<float,2>{0.200518683f, 0.617822766f},
-std::array<float,2>{0.786878765f, 0.287658006f},
-std::array<float,2>{0.355122238f, 0.0996247903f},
-std::array<float,2>{0.670023739f, 0.982856631f},
-std::array<float,2>{0.114765935f, 0.901619077f},
-std::array<float,2>{0.876879334f, 0.0415451005f},
-std::array<float,2>{0.389748096f, 0.350642294f},
-std::array<float,2>{0.545750856f, 0.526509583f},
-std::array<float,2>{0.286803871f, 0.655299485f},
-std::array<float,2>{0.72124964f, 0.473490447f},
-std::array<float,2>{0.127861112f, 0.19919236f},
-std::array<float,2>{0.831874907f, 0.776252568f},
-std::array<float,2>{0.397530705f, 0.921775937f},
-std::array<float,2>{0.551152527f, 0.0204492081f},
-std::array<float,2>{0.0944986716f, 0.335898638f},
-std::array<float,2>{0.902555466f, 0.538991034f},
-std::array<float,2>{0.155190229f, 0.662529647f},
-std::array<float,2>{0.814880073f, 0.454766661f},
-std::array<float,2>{0.301573932f, 0.222920626f},
-std::array<float,2>{0.743002415f, 0.800281882f},
-std::array<float,2>{0.0164391659f, 0.856030703f},
-std::array<float,2>{0.980494142f, 0.179281697f},
-std::array<float,2>{0.445029855f, 0.386720747f},
-std::array<float,2>{0.614775896f, 0.687633336f},
-std::array<float,2>{0.370231569f, 0.579732895f},
-std::array<float,2>{0.67363888f, 0.261623502f},
-std::array<float,2>{0.204057202f, 0.0698227137f},
-std::array<float,2>{0.796982884f, 0.960740209f},
-std::array<float,2>{0.250448078f, 0.760985851f},
-std::array<float,2>{0.71362114f, 0.206041768f},
-std::array<float,2>{0.165302619f, 0.484415114f},
-std::array<float,2>{0.863249302f, 0.632884622f},
-std::array<float,2>{0.0694507062f, 0.512781143f},
-std::array<float,2>{0.921343982f, 0.365763307f},
-std::array<float,2>{0.415785909f, 0.0479751825f},
-std::array<float,2>{0.527459502f, 0.887430668f},
-std::array<float,2>{0.242626995f, 0.992954016f},
-std::array<float,2>{0.765092134f, 0.115551859f},
-std::array<float,2>{0.335389405f, 0.297699362f},
-std::array<float,2>{0.627753377f, 0.601399243f},
-std::array<float,2>{0.488194734f, 0.740502298f},
-std::array<float,2>{0.563639641f, 0.42447421f},
-std::array<float,2>{0.0327884071f, 0.146444157f},
-std::array<float,2>{0.954483867f, 0.822598875f},
-std::array<float,2>{0.305393517f, 0.880591869f},
-std::array<float,2>{0.741445959f, 0.0581010506f},
-std::array<float,2>{0.141240969f, 0.374429911f},
-std::array<float,2>{0.821861982f, 0.506464064f},
-std::array<float,2>{0.10347151f, 0.625376821f},
-std::array<float,2>{0.891743064f, 0.498740256f},
-std::array<float,2>{0.402725846f, 0.217592463f},
-std::array<float,2>{0.560849667f, 0.756367683f},
-std::array<float,2>{0.214208126f, 0.816702187f},
-std::array<float,2>{0.805211604f, 0.151388481f},
-std::array<float,2>{0.36152932f, 0.431580931f},
-std::array<float,2>{0.686908662f, 0.747168839f},
-std::array<float,2>{0.448569506f, 0.604155183f},
-std::array<float,2>{0.617325425f, 0.307954818f},
-std::array<float,2>{0.0274813436f, 0.12183214f},
-std::array<float,2>{0.971976578f, 0.989939451f},
-std::array<float,2>{0.406589895f, 0.805498421f},
-std::array<float,2>{0.518527865f, 0.229904532f},
-std::array<float,2>{0.0740155205f, 0.465092033f},
-std::array<float,2>{0.90755868f, 0.667903066f},
-std::array<float,2>{0.157375291f, 0.542221785f},
-std::array<float,2>{0.874366522f, 0.338642657f},
-std::array<float,2>{0.262172937f, 0.0298455898f},
-std::array<float,2>{0.70980823f, 0.912910163f},
-std::array<float,2>{0.0433758423f, 0.965955138f},
-std::array<float,2>{0.962825596f, 0.0778577477f},
-std::array<float,2>{0.49859947f, 0.257490009f},
-std::array<float,2>{0.57372731f, 0.589481831f},
-std::array<float,2>{0.337363005f, 0.701805711f},
-std::array<float,2>{0.636058271f, 0.381225258f},
-std::array<float,2>{0.238562301f, 0.183722049f},
-std::array<float,2>{0.755690277f, 0.845760524f},
-std::array<float,2>{0.4755674f, 0.974154413f},
-std::array<float,2>{0.585424781f, 0.108024798f},
-std::array<float,2>{0.0494875684f, 0.293628633f},
-std::array<float,2>{0.951103747f, 0.616981149f},
-std::array<float,2>{0.219569579f, 0.719651639f},
-std::array<float,2>{0.771388888f, 0.412357956f},
-std::array<float,2>{0.32316646f, 0.129894048f},
-std::array<float,2>{0.640991926f, 0.83465296f},
-std::array<float,2>{0.0785121918f, 0.771462619f},
-std::array<float,2>{0.92424804f, 0.191578776f},
-std::array<float,2>{0.422296166f, 0.479117066f},
-std::array<float,2>{0.503122449f, 0.64774394f},
-std::array<float,2>{0.269368827f, 0.522249639f},
-std::array<float,2>{0.692005217f, 0.352186978f},
-std::array<float,2>{0.181202069f, 0.0320113599f},
-std::array<float,2>{0.858751357f, 0.897245407f},
-std::array<float,2>{0.344341844f, 0.871412277f},
-std::array<float,2>{0.661760509f, 0.164876148f},
-std::array<float,2>{0.1925129f, 0.39246732f},
-std::array<float,2>{0.789756715f, 0.716272116f},
-std::array<float,2>{0.0120987538f, 0.566810966f},
-std::array<float,2>{0.989656508f, 0.277527392f},
-std::array<float,2>{0.460004866f, 0.0812339336f},
-std::array<float,2>{0.597036541f, 0.951941073f},
-std::array<float,2>{0.134372637f, 0.92395699f},
-std::array<float,2>{0.840296566f, 0.0123334844f},
-std::array<float,2>{0.290714055f, 0.322067529f},
-std::array<float,2>{0.732535243f, 0.558086336f},
-std::array<float,2>{0.380702525f, 0.683801234f},
-std::array<float,2>{0.533899426f, 0.447030455f},
-std::array<float,2>{0.118397154f, 0.241915256f},
-std::array<float,2>{0.883904576f, 0.781673312f},
-std::array<float,2>{0.374642998f, 0.892402887f},
-std::array<float,2>{0.676671267f, 0.0372627117f},
-std::array<float,2>{0.209493265f, 0.357029557f},
-std::array<float,2>{0.802379131f, 0.51743716f},
-std::array<float,2>{0.02074074f, 0.640993953f},
-std::array<float,2>{0.977781475f, 0.481706291f},
-std::array<float,2>{0.437877029f, 0.189346835f},
-std::array<float,2>{0.609493017f, 0.768802822f},
-std::array<float,2>{0.148663536f, 0.828704357f},
-std::array<float,2>{0.818594158f, 0.127182513f},
-std::array<float,2>{0.297012895f, 0.408522189f},
-std::array<float,2>{0.749252856f, 0.72437942f},
-std::array<float,2>{0.390949577f, 0.612965822f},
-std::array<float,2>{0.547385573f, 0.291104585f},
-std::array<float,2>{0.101308398f, 0.105022728f},
-std::array<float,2>{0.901313841f, 0.971814871f},
-std::array<float,2>{0.48945865f, 0.788266063f},
-std::array<float,2>{0.569232106f, 0.237001091f},
-std::array<float,2>{0.0385826416f, 0.451544583f},
-std::array<float,2>{0.957428813f, 0.683079123f},
-std::array<float,2>{0.249137834f, 0.561911404f},
-std::array<float,2>{0.758802652f, 0.324913502f},
-std::array<float,2>{0.331715822f, 0.0106323082f},
-std::array<float,2>{0.628990352f, 0.926724315f},
-std::array<float,2>{0.0645633116f, 0.946488321f},
-std::array<float,2>{0.915390491f, 0.085533902f},
-std::array<float,2>{0.418946236f, 0.276622087f},
-std::array<float,2>{0.52486074f, 0.564788282f},
-std::array<float,2>{0.257419884f, 0.711393774f},
-std::array<float,2>{0.717777908f, 0.396074444f},
-std::array<float,2>{0.171529636f, 0.170764998f},
-std::array<float,2>{0.863787472f, 0.867400289f},
-std::array<float,2>{0.434772223f, 0.984916449f},
-std::array<float,2>{0.510254979f, 0.120171025f},
-std::array<float,2>{0.0912029743f, 0.311126322f},
-std::array<float,2>{0.934882998f, 0.607621491f},
-std::array<float,2>{0.176382795f, 0.745456457f},
-std::array<float,2>{0.8483814f, 0.434865564f},
-std::array<float,2>{0.280217856f, 0.153407335f},
-std::array<float,2>{0.699391007f, 0.814026892f},
-std::array<float,2>{0.0569149703f, 0.751660585f},
-std::array<float,2>{0.941083014f, 0.212438732f},
-std::array<float,2>{0.480624378f, 0.495043397f},
-std::array<float,2>{0.58832866f, 0.63146472f},
-std::array<float,2>{0.313475877f, 0.502042651f},
-std::array<float,2>{0.654465735f, 0.369491786f},
-std::array<float,2>{0.227475435f, 0.0594512746f},
-std::array<float,2>{0.776177943f, 0.876810551f},
-std::array<float,2>{0.281857342f, 0.851159036f},
-std::array<float,2>{0.725507557f, 0.181539208f},
-std::array<float,2>{0.130572289f, 0.378229529f},
-std::array<float,2>{0.833537102f, 0.6988042f},
-std::array<float,2>{0.112872638f, 0.593633115f},
-std::array<float,2>{0.881269395f, 0.251218051f},
-std::array<float,2>{0.384307593f, 0.0720575154f},
-std::array<float,2>{0.539988101f, 0.961757243f},
-std::array<float,2>{0.195974708f, 0.906976819f},
-std::array<float,2>{0.782565415f, 0.0255622026f},
-std::array<float,2>{0.359060496f, 0.342135698f},
-std::array<float,2>{0.664962173f, 0.546584308f},
-std::array<float,2>{0.462187737f, 0.670720816f},
-std::array<float,2>{0.608141005f, 0.46127075f},
-std::array<float,2>{0.00557726482f, 0.23387745f},
-std::array<float,2>{0.992894411f, 0.810299218f},
-std::array<float,2>{0.270940036f, 0.955050707f},
-std::array<float,2>{0.688368738f, 0.0660318956f},
-std::array<float,2>{0.186189219f, 0.262497634f},
-std::array<float,2>{0.852826238f, 0.584105909f},
-std::array<float,2>{0.0850791484f, 0.694681108f},
-std::array<float,2>{0.928212106f, 0.383134454f},
-std::array<float,2>{0.426162094f, 0.173420012f},
-std::array<float,2>{0.507028699f, 0.852355301f},
-std::array<float,2>{0.225766063f, 0.802615643f},
-std::array<float,2>{0.765751243f, 0.220837638f},
-std::array<float,2>{0.327948242f, 0.46086964f},
-std::array<float,2>{0.644664645f, 0.657638192f},
-std::array<float,2>{0.471194476f, 0.531885087f},
-std::array<float,2>{0.581852794f, 0.330702156f},
-std::array<float,2>{0.0532256775f, 0.0170806851f},
-std::array<float,2>{0.946739197f, 0.917224765f},
-std::array<float,2>{0.377739698f, 0.828026414f},
-std::array<float,2>{0.537728667f, 0.142380014f},
-std::array<float,2>{0.122915082f, 0.427279651f},
-std::array<float,2>{0.890609443f, 0.737855613f},
-std::array<float,2>{0.14045696f, 0.595611572f},
-std::array<float,2>{0.836894035f, 0.304324716f},
-std::array<float,2>{0.296114922f, 0.113062404f},
-std::array<float,2>{0.727504253f, 0.997260988f},
-std::array<float,2>{0.00919496734f, 0.884333372f},
-std::array<float,2>{0.986852586f, 0.0534606501f},
-std::array<float,2>{0.456189513f, 0.36229372f},
-std::array<float,2>{0.600290716f, 0.50917685f},
-std::array<float,2>{0.34835577f, 0.640247047f},
-std::array<float,2>{0.65627408f, 0.49182409f},
-std::array<float,2>{0.189782143f, 0.20768781f},
-std::array<float,2>{0.793236017f, 0.762398005f},
-std::array<float,2>{0.450043112f, 0.936465502f},
-std::array<float,2>{0.621154368f, 0.00408245204f},
-std::array<float,2>{0.0236137714f, 0.316519231f},
-std::array<float,2>{0.976146698f, 0.549706459f},
-std::array<float,2>{0.216303051f, 0.678232431f},
-std::array<float,2>{0.810953736f, 0.445222825f},
-std::array<float,2>{0.36455065f, 0.24302718f},
-std::array<float,2>{0.683013797f, 0.794016659f},
-std::array<float,2>{0.105882145f, 0.860534668f},
-std::array<float,2>{0.896052241f, 0.162958577f},
-std::array<float,2>{0.401830524f, 0.403639048f},
-std::array<float,2>{0.55616945f, 0.705412984f},
-std::array<float,2>{0.3091093f, 0.574986398f},
-std::array<float,2>{0.73810643f, 0.272397101f},
-std::array<float,2>{0.144731268f, 0.0870228112f},
-std::array<float,2>{0.826771319f, 0.940636456f},
-std::array<float,2>{0.340815991f, 0.77949512f},
-std::array<float,2>{0.638990581f, 0.202120066f},
-std::array<float,2>{0.236806378f, 0.472583562f},
-std::array<float,2>{0.752785087f, 0.651695609f},
-std::array<float,2>{0.0426927432f, 0.527493358f},
-std::array<float,2>{0.9669649f, 0.346220255f},
-std::array<float,2>{0.494885147f, 0.0451386943f},
-std::array<float,2>{0.576373458f, 0.904729843f},
-std::array<float,2>{0.162366405f, 0.97869575f},
-std::array<float,2>{0.86944437f, 0.0970416367f},
-std::array<float,2>{0.259406567f, 0.282859772f},
-std::array<float,2>{0.706760585f, 0.623898506f},
-std::array<float,2>{0.412857443f, 0.72745955f},
-std::array<float,2>{0.521290839f, 0.421030402f},
-std::array<float,2>{0.0748993233f, 0.135680825f},
-std::array<float,2>{0.912462354f, 0.84257865f},
-std::array<float,2>{0.322578013f, 0.97504741f},
-std::array<float,2>{0.641289473f, 0.105816752f},
-std::array<float,2>{0.219024315f, 0.29554826f},
-std::array<float,2>{0.770701885f, 0.614949107f},
-std::array<float,2>{0.0492527895f, 0.722344995f},
-std::array<float,2>{0.950459003f, 0.411811411f},
-std::array<float,2>{0.475013852f, 0.132491425f},
-std::array<float,2>{0.585540235f, 0.833302557f},
-std::array<float,2>{0.180736721f, 0.7723037f},
-std::array<float,2>{0.859062433f, 0.195067704f},
-std::array<float,2>{0.268791646f, 0.47706154f},
-std::array<float,2>{0.691576481f, 0.64454174f},
-std::array<float,2>{0.422496319f, 0.51996398f},
-std::array<float,2>{0.503462434f, 0.353603363f},
-std::array<float,2>{0.0789350718f, 0.0348003656f},
-std::array<float,2>{0.924499452f, 0.895395756f},
-std::array<float,2>{0.460631371f, 0.874599457f},
-std::array<float,2>{0.597235084f, 0.167452872f},
-std::array<float,2>{0.0126658464f, 0.393801779f},
-std::array<float,2>{0.990035892f, 0.718451023f},
-std::array<float,2>{0.192994222f, 0.569115162f},
-std::array<float,2>{0.789455771f, 0.281076193f},
-std::array<float,2>{0.344057798f, 0.0792979896f},
-std::array<float,2>{0.661305249f, 0.949808955f},
-std::array<float,2>{0.118671015f, 0.923654377f},
-std::array<float,2>{0.884373188f, 0.0148881236f},
-std::array<float,2>{0.380299121f, 0.323631674f},
-std::array<float,2>{0.533247411f, 0.555956304f},
-std::array<float,2>{0.29015097f, 0.685568929f},
-std::array<float,2>{0.733230412f, 0.448914766f},
-std::array<float,2>{0.134047061f, 0.238582119f},
-std::array<float,2>{0.840619326f, 0.784835637f},
-std::array<float,2>{0.403064728f, 0.88248533f},
-std::array<float,2>{0.561308801f, 0.0550303347f},
-std::array<float,2>{0.10261251f, 0.371526659f},
-std::array<float,2>{0.892374754f, 0.503984809f},
-std::array<float,2>{0.140922725f, 0.627400458f},
-std::array<float,2>{0.821485341f, 0.497936249f},
-std::array<float,2>{0.305049688f, 0.216726571f},
-std::array<float,2>{0.741735876f, 0.754971027f},
-std::array<float,2>{0.0279031657f, 0.819920003f},
-std::array<float,2>{0.972604573f, 0.149883598f},
-std::array<float,2>{0.448782504f, 0.431939214f},
-std::array<float,2>{0.618038774f, 0.74955827f},
-std::array<float,2>{0.361888289f, 0.602865219f},
-std::array<float,2>{0.687479854f, 0.30495438f},
-std::array<float,2>{0.214506656f, 0.124410927f},
-std::array<float,2>{0.804695189f, 0.991628528f},
-std::array<float,2>{0.262224585f, 0.808371603f},
-std::array<float,2>{0.709193945f, 0.226630405f},
-std::array<float,2>{0.15799132f, 0.46861586f},
-std::array<float,2>{0.874609888f, 0.665419638f},
-std::array<float,2>{0.0734933093f, 0.540070713f},
-std::array<float,2>{0.908175051f, 0.337460607f},
-std::array<float,2>{0.40674147f, 0.0282134395f},
-std::array<float,2>{0.517971635f, 0.912044466f},
-std::array<float,2>{0.238833368f, 0.968477547f},
-std::array<float,2>{0.755336523f, 0.0745669752f},
-std::array<float,2>{0.337759852f, 0.255531669f},
-std::array<float,2>{0.636659205f, 0.587224424f},
-std::array<float,2>{0.498493582f, 0.701066017f},
-std::array<float,2>{0.574106872f, 0.380274653f},
-std::array<float,2>{0.0438484848f, 0.186285257f},
-std::array<float,2>{0.962337434f, 0.844531715f},
-std::array<float,2>{0.301174909f, 0.919614255f},
-std::array<float,2>{0.742532313f, 0.0223675724f},
-std::array<float,2>{0.154570982f, 0.333221287f},
-std::array<float,2>{0.814947784f, 0.536191881f},
-std::array<float,2>{0.0938178673f, 0.660255909f},
-std::array<float,2>{0.903041005f, 0.456104487f},
-std::array<float,2>{0.397967964f, 0.226048082f},
-std::array<float,2>{0.551564276f, 0.797803462f},
-std::array<float,2>{0.203606918f, 0.85794735f},
-std::array<float,2>{0.797697723f, 0.177594319f},
-std::array<float,2>{0.370818675f, 0.390029848f},
-std::array<float,2>{0.673260212f, 0.690771818f},
-std::array<float,2>{0.44471246f, 0.581067801f},
-std::array<float,2>{0.614574313f, 0.25956586f},
-std::array<float,2>{0.0159927942f, 0.0679013729f},
-std::array<float,2>{0.981266201f, 0.958926558f},
-std::array<float,2>{0.415377438f, 0.758993328f},
-std::array<float,2>{0.528096259f, 0.204269096f},
-std::array<float,2>{0.0702672228f, 0.486351371f},
-std::array<float,2>{0.921508253f, 0.636147082f},
-std::array<float,2>{0.165656373f, 0.515418112f},
-std::array<float,2>{0.862515688f, 0.363334566f},
-std::array<float,2>{0.250860691f, 0.049903255f},
-std::array<float,2>{0.713000238f, 0.890078843f},
-std::array<float,2>{0.032386478f, 0.994850993f},
-std::array<float,2>{0.954993963f, 0.114713341f},
-std::array<float,2>{0.487610906f, 0.299818069f},
-std::array<float,2>{0.564183235f, 0.599502981f},
-std::array<float,2>{0.335796475f, 0.739100039f},
-std::array<float,2>{0.627094805f, 0.422849178f},
-std::array<float,2>{0.243086055f, 0.147096038f},
-std::array<float,2>{0.765297949f, 0.820818663f},
-std::array<float,2>{0.477309555f, 0.942073524f},
-std::array<float,2>{0.593421459f, 0.0916631445f},
-std::array<float,2>{0.0594002679f, 0.268469512f},
-std::array<float,2>{0.942757308f, 0.571156144f},
-std::array<float,2>{0.232359648f, 0.709307015f},
-std::array<float,2>{0.778686702f, 0.399193823f},
-std::array<float,2>{0.316980571f, 0.157908186f},
-std::array<float,2>{0.649690509f, 0.865889847f},
-std::array<float,2>{0.0866622031f, 0.791160703f},
-std::array<float,2>{0.929895997f, 0.246912554f},
-std::array<float,2>{0.431953728f, 0.440161794f},
-std::array<float,2>{0.514769256f, 0.675673604f},
-std::array<float,2>{0.275807947f, 0.550888598f},
-std::array<float,2>{0.698810875f, 0.314286619f},
-std::array<float,2>{0.172833562f, 0.000353691517f},
-std::array<float,2>{0.84734863f, 0.929710925f},
-std::array<float,2>{0.354940355f, 0.839195669f},
-std::array<float,2>{0.670788467f, 0.136954367f},
-std::array<float,2>{0.200976849f, 0.41459468f},
-std::array<float,2>{0.786578f, 0.731794f},
-std::array<float,2>{0.00222281483f, 0.619986832f},
-std::array<float,2>{0.996931255f, 0.285301179f},
-std::array<float,2>{0.468724906f, 0.0987999737f},
-std::array<float,2>{0.6054582f, 0.980827153f},
-std::array<float,2>{0.127251834f, 0.899321556f},
-std::array<float,2>{0.831473947f, 0.0400749333f},
-std::array<float,2>{0.286390692f, 0.348929167f},
-std::array<float,2>{0.72107619f, 0.524993181f},
-std::array<float,2>{0.390424013f, 0.652632236f},
-std::array<float,2>{0.545135856f, 0.476159543f},
-std::array<float,2>{0.114704765f, 0.19570221f},
-std::array<float,2>{0.876220107f, 0.773868859f},
-std::array<float,2>{0.328211278f, 0.929078519f},
-std::array<float,2>{0.630991995f, 0.00910018571f},
-std::array<float,2>{0.247483611f, 0.327202111f},
-std::array<float,2>{0.760765314f, 0.559205651f},
-std::array<float,2>{0.035253007f, 0.681309283f},
-std::array<float,2>{0.959307313f, 0.44947359f},
-std::array<float,2>{0.490595192f, 0.234525666f},
-std::array<float,2>{0.566969156f, 0.78609854f},
-std::array<float,2>{0.168576136f, 0.87056601f},
-std::array<float,2>{0.865673423f, 0.169151276f},
-std::array<float,2>{0.255083621f, 0.396544099f},
-std::array<float,2>{0.716476381f, 0.714534223f},
-std::array<float,2>{0.421599716f, 0.564275146f},
-std::array<float,2>{0.526748359f, 0.275266737f},
-std::array<float,2>{0.0628302917f, 0.0838536099f},
-std::array<float,2>{0.916751504f, 0.947710574f},
-std::array<float,2>{0.441287369f, 0.766316593f},
-std::array<float,2>{0.612471402f, 0.190114215f},
-std::array<float,2>{0.022945486f, 0.484160036f},
-std::array<float,2>{0.980254114f, 0.644190371f},
-std::array<float,2>{0.208489865f, 0.517723262f},
-std::array<float,2>{0.804113448f, 0.358061969f},
-std::array<float,2>{0.371597946f, 0.0361817665f},
-std::array<float,2>{0.679475069f, 0.894010186f},
-std::array<float,2>{0.0983170271f, 0.969429433f},
-std::array<float,2>{0.898521185f, 0.102038145f},
-std::array<float,2>{0.392843395f, 0.290356994f},
-std::array<float,2>{0.550014257f, 0.609450638f},
-std::array<float,2>{0.299224198f, 0.72481662f},
-std::array<float,2>{0.746639013f, 0.407631576f},
-std::array<float,2>{0.150670737f, 0.126112968f},
-std::array<float,2>{0.816438735f, 0.831304133f},
-std::array<float,2>{0.385886133f, 0.963084579f},
-std::array<float,2>{0.541326702f, 0.0726168454f},
-std::array<float,2>{0.111268133f, 0.253590167f},
-std::array<float,2>{0.879293382f, 0.590643883f},
-std::array<float,2>{0.132237911f, 0.695708692f},
-std::array<float,2>{0.835266173f, 0.376352847f},
-std::array<float,2>{0.284679979f, 0.183088675f},
-std::array<float,2>{0.723196566f, 0.8490991f},
-std::array<float,2>{0.00664216373f, 0.811620414f},
-std::array<float,2>{0.995582402f, 0.232061833f},
-std::array<float,2>{0.464835614f, 0.464383304f},
-std::array<float,2>{0.606256783f, 0.669221699f},
-std::array<float,2>{0.356655508f, 0.543844223f},
-std::array<float,2>{0.666665435f, 0.34103179f},
-std::array<float,2>{0.197845563f, 0.0246773604f},
-std::array<float,2>{0.784336507f, 0.908439696f},
-std::array<float,2>{0.279173911f, 0.816331506f},
-std::array<float,2>{0.70206672f, 0.155396819f},
-std::array<float,2>{0.178546026f, 0.436190337f},
-std::array<float,2>{0.851233482f, 0.742978632f},
-std::array<float,2>{0.0929174572f, 0.606226683f},
-std::array<float,2>{0.937253237f, 0.309032112f},
-std::array<float,2>{0.435987264f, 0.119025081f},
-std::array<float,2>{0.509533703f, 0.987018704f},
-std::array<float,2>{0.229176983f, 0.877979815f},
-std::array<float,2>{0.774731159f, 0.0610694364f},
-std::array<float,2>{0.315247267f, 0.36904335f},
-std::array<float,2>{0.654002726f, 0.501141667f},
-std::array<float,2>{0.484087139f, 0.629636347f},
-std::array<float,2>{0.587296128f, 0.494050443f},
-std::array<float,2>{0.0553046092f, 0.213526741f},
-std::array<float,2>{0.937929571f, 0.752474308f},
-std::array<float,2>{0.294802189f, 0.99901098f},
-std::array<float,2>{0.729532421f, 0.1100685f},
-std::array<float,2>{0.13701041f, 0.302290589f},
-std::array<float,2>{0.83858943f, 0.59728229f},
-std::array<float,2>{0.124165967f, 0.73519963f},
-std::array<float,2>{0.888339877f, 0.429360569f},
-std::array<float,2>{0.37569654f, 0.144216463f},
-std::array<float,2>{0.536733449f, 0.825111449f},
-std::array<float,2>{0.18906188f, 0.764929891f},
-std::array<float,2>{0.796039402f, 0.20969072f},
-std::array<float,2>{0.349904984f, 0.489319742f},
-std::array<float,2>{0.659154236f, 0.63807565f},
-std::array<float,2>{0.454540819f, 0.510052621f},
-std::array<float,2>{0.59777987f, 0.360717773f},
-std::array<float,2>{0.0104328757f, 0.0518513769f},
-std::array<float,2>{0.984436631f, 0.885855556f},
-std::array<float,2>{0.428062052f, 0.854988158f},
-std::array<float,2>{0.505552828f, 0.175545707f},
-std::array<float,2>{0.0837972686f, 0.386645526f},
-std::array<float,2>{0.92710346f, 0.692584515f},
-std::array<float,2>{0.184303612f, 0.583678961f},
-std::array<float,2>{0.854634643f, 0.264805317f},
-std::array<float,2>{0.271938056f, 0.0634697452f},
-std::array<float,2>{0.690774262f, 0.956433177f},
-std::array<float,2>{0.0523012094f, 0.914964557f},
-std::array<float,2>{0.948453248f, 0.019383654f},
-std::array<float,2>{0.470079988f, 0.328645021f},
-std::array<float,2>{0.579788268f, 0.533915699f},
-std::array<float,2>{0.324636042f, 0.659013331f},
-std::array<float,2>{0.646813154f, 0.458121061f},
-std::array<float,2>{0.224076688f, 0.220465258f},
-std::array<float,2>{0.768646657f, 0.804356158f},
-std::array<float,2>{0.492264479f, 0.902436137f},
-std::array<float,2>{0.575585306f, 0.0431392379f},
-std::array<float,2>{0.039442867f, 0.345121056f},
-std::array<float,2>{0.965064883f, 0.53124994f},
-std::array<float,2>{0.2356783f, 0.648589611f},
-std::array<float,2>{0.750930846f, 0.4694812f},
-std::array<float,2>{0.34314397f, 0.199472427f},
-std::array<float,2>{0.638225079f, 0.778621078f},
-std::array<float,2>{0.0762821138f, 0.840820789f},
-std::array<float,2>{0.911985159f, 0.133346841f},
-std::array<float,2>{0.410960555f, 0.418684989f},
-std::array<float,2>{0.523276091f, 0.729359686f},
-std::array<float,2>{0.260693192f, 0.621988773f},
-std::array<float,2>{0.704158425f, 0.284075886f},
-std::array<float,2>{0.160638437f, 0.0943014324f},
-std::array<float,2>{0.868108273f, 0.977492452f},
-std::array<float,2>{0.366366297f, 0.796695292f},
-std::array<float,2>{0.681386888f, 0.244268671f},
-std::array<float,2>{0.21713905f, 0.442361891f},
-std::array<float,2>{0.809945583f, 0.677621901f},
-std::array<float,2>{0.0257407986f, 0.548748553f},
-std::array<float,2>{0.973202646f, 0.318946362f},
-std::array<float,2>{0.451473027f, 0.00719499169f},
-std::array<float,2>{0.623960495f, 0.934461594f},
-std::array<float,2>{0.147236735f, 0.937592804f},
-std::array<float,2>{0.826106369f, 0.0896841288f},
-std::array<float,2>{0.310669959f, 0.269899875f},
-std::array<float,2>{0.736307561f, 0.576586187f},
-std::array<float,2>{0.398920655f, 0.703947425f},
-std::array<float,2>{0.558169365f, 0.405192405f},
-std::array<float,2>{0.108106248f, 0.161454871f},
-std::array<float,2>{0.898079157f, 0.861424804f},
-std::array<float,2>{0.347288728f, 0.951401293f},
-std::array<float,2>{0.662200451f, 0.0819238797f},
-std::array<float,2>{0.194178909f, 0.277911574f},
-std::array<float,2>{0.792389572f, 0.567160726f},
-std::array<float,2>{0.014976223f, 0.716635466f},
-std::array<float,2>{0.990809739f, 0.391981244f},
-std::array<float,2>{0.457768261f, 0.164282545f},
-std::array<float,2>{0.594698489f, 0.871610224f},
-std::array<float,2>{0.136243016f, 0.782082975f},
-std::array<float,2>{0.842452824f, 0.241329223f},
-std::array<float,2>{0.29199627f, 0.446536511f},
-std::array<float,2>{0.730587423f, 0.684291542f},
-std::array<float,2>{0.382197827f, 0.558575273f},
-std::array<float,2>{0.531806469f, 0.321469992f},
-std::array<float,2>{0.119904123f, 0.0120255658f},
-std::array<float,2>{0.885186672f, 0.924535394f},
-std::array<float,2>{0.472896606f, 0.834460258f},
-std::array<float,2>{0.583392024f, 0.130619287f},
-std::array<float,2>{0.0485562533f, 0.412768871f},
-std::array<float,2>{0.952160299f, 0.71910125f},
-std::array<float,2>{0.221959129f, 0.61643523f},
-std::array<float,2>{0.773179471f, 0.29303804f},
-std::array<float,2>{0.321173936f, 0.107604235f},
-std::array<float,2>{0.643996954f, 0.973837197f},
-std::array<float,2>{0.0807038099f, 0.896888137f},
-std::array<float,2>{0.921971262f, 0.0316818878f},
-std::array<float,2>{0.42559725f, 0.351691991f},
-std::array<float,2>{0.500677884f, 0.521969199f},
-std::array<float,2>{0.265771687f, 0.648293793f},
-std::array<float,2>{0.694387734f, 0.478550345f},
-std::array<float,2>{0.181718722f, 0.192353129f},
-std::array<float,2>{0.85670948f, 0.770610809f},
-std::array<float,2>{0.409100324f, 0.912444472f},
-std::array<float,2>{0.516510069f, 0.02951831f},
-std::array<float,2>{0.0707526058f, 0.337993771f},
-std::array<float,2>{0.908379018f, 0.542711794f},
-std::array<float,2>{0.15997833f, 0.667057455f},
-std::array<float,2>{0.872181535f, 0.46579957f},
-std::array<float,2>{0.264284194f, 0.230440423f},
-std::array<float,2>{0.708959401f, 0.804969192f},
-std::array<float,2>{0.0455615819f, 0.846434474f},
-std::array<float,2>{0.964161932f, 0.184518993f},
-std::array<float,2>{0.49753046f, 0.381818861f},
-std::array<float,2>{0.570922196f, 0.70148015f},
-std::array<float,2>{0.338457853f, 0.588901639f},
-std::array<float,2>{0.633791089f, 0.25702706f},
-std::array<float,2>{0.240929902f, 0.0772907883f},
-std::array<float,2>{0.756561875f, 0.966316104f},
-std::array<float,2>{0.30834043f, 0.756243944f},
-std::array<float,2>{0.739897251f, 0.216852963f},
-std::array<float,2>{0.144288272f, 0.498061746f},
-std::array<float,2>{0.823243976f, 0.625962675f},
-std::array<float,2>{0.104782075f, 0.506004632f},
-std::array<float,2>{0.894029975f, 0.374673039f},
-std::array<float,2>{0.405604839f, 0.0581857972f},
-std::array<float,2>{0.559738517f, 0.880351126f},
-std::array<float,2>{0.212310478f, 0.989586949f},
-std::array<float,2>{0.806867659f, 0.121442616f},
-std::array<float,2>{0.359946877f, 0.308458835f},
-std::array<float,2>{0.683813989f, 0.603762865f},
-std::array<float,2>{0.445713609f, 0.747975409f},
-std::array<float,2>{0.619399607f, 0.430809051f},
-std::array<float,2>{0.0297517609f, 0.152066156f},
-std::array<float,2>{0.969347f, 0.816901684f},
-std::array<float,2>{0.252129167f, 0.887187123f},
-std::array<float,2>{0.71186465f, 0.0487447977f},
-std::array<float,2>{0.166332692f, 0.365395308f},
-std::array<float,2>{0.860321403f, 0.513212502f},
-std::array<float,2>{0.0680877566f, 0.633571625f},
-std::array<float,2>{0.918986142f, 0.484934449f},
-std::array<float,2>{0.417723387f, 0.205093354f},
-std::array<float,2>{0.531077504f, 0.76126045f},
-std::array<float,2>{0.245018855f, 0.822953165f},
-std::array<float,2>{0.763480365f, 0.145629823f},
-std::array<float,2>{0.332339376f, 0.423837215f},
-std::array<float,2>{0.625123143f, 0.740942776f},
-std::array<float,2>{0.48609969f, 0.600713849f},
-std::array<float,2>{0.564736426f, 0.29716301f},
-std::array<float,2>{0.0334685184f, 0.115865752f},
-std::array<float,2>{0.955172777f, 0.992345929f},
-std::array<float,2>{0.396170914f, 0.800712585f},
-std::array<float,2>{0.553318799f, 0.223321676f},
-std::array<float,2>{0.095776841f, 0.454356968f},
-std::array<float,2>{0.904606164f, 0.662784696f},
-std::array<float,2>{0.153278694f, 0.538362384f},
-std::array<float,2>{0.813471496f, 0.335137218f},
-std::array<float,2>{0.302925617f, 0.0195891f},
-std::array<float,2>{0.745553255f, 0.921333253f},
-std::array<float,2>{0.0184071027f, 0.96017015f},
-std::array<float,2>{0.984024525f, 0.0699231178f},
-std::array<float,2>{0.441412002f, 0.261097938f},
-std::array<float,2>{0.616753221f, 0.579103172f},
-std::array<float,2>{0.368348241f, 0.688216567f},
-std::array<float,2>{0.675243378f, 0.387648165f},
-std::array<float,2>{0.20694074f, 0.178762004f},
-std::array<float,2>{0.799109042f, 0.855625093f},
-std::array<float,2>{0.4655509f, 0.983301699f},
-std::array<float,2>{0.6019243f, 0.100245148f},
-std::array<float,2>{0.00159970485f, 0.287324011f},
-std::array<float,2>{0.999959171f, 0.617475331f},
-std::array<float,2>{0.202757865f, 0.733081043f},
-std::array<float,2>{0.787455678f, 0.417120457f},
-std::array<float,2>{0.353157341f, 0.140013337f},
-std::array<float,2>{0.668756783f, 0.836211085f},
-std::array<float,2>{0.11565987f, 0.775690734f},
-std::array<float,2>{0.87723726f, 0.198564097f},
-std::array<float,2>{0.387442023f, 0.47276935f},
-std::array<float,2>{0.54451865f, 0.655988812f},
-std::array<float,2>{0.287928492f, 0.527140558f},
-std::array<float,2>{0.72038424f, 0.35136953f},
-std::array<float,2>{0.126235008f, 0.0414261632f},
-std::array<float,2>{0.828945875f, 0.901923299f},
-std::array<float,2>{0.320215285f, 0.864229798f},
-std::array<float,2>{0.652015507f, 0.159063324f},
-std::array<float,2>{0.232702971f, 0.401797801f},
-std::array<float,2>{0.780828655f, 0.708464742f},
-std::array<float,2>{0.0620414391f, 0.573026776f},
-std::array<float,2>{0.944171965f, 0.266910702f},
-std::array<float,2>{0.479652673f, 0.0930682272f},
-std::array<float,2>{0.59155184f, 0.944690704f},
-std::array<float,2>{0.173947334f, 0.933555841f},
-std::array<float,2>{0.843788207f, 0.00277107046f},
-std::array<float,2>{0.274860114f, 0.315419704f},
-std::array<float,2>{0.69607538f, 0.554306805f},
-std::array<float,2>{0.431425959f, 0.67354542f},
-std::array<float,2>{0.512604356f, 0.438575864f},
-std::array<float,2>{0.0891509578f, 0.248456359f},
-std::array<float,2>{0.932388008f, 0.790897191f},
-std::array<float,2>{0.316337615f, 0.875372767f},
-std::array<float,2>{0.652413964f, 0.0604487397f},
-std::array<float,2>{0.230162069f, 0.370464414f},
-std::array<float,2>{0.77380383f, 0.503482819f},
-std::array<float,2>{0.0560088344f, 0.632481813f},
-std::array<float,2>{0.938689888f, 0.495511144f},
-std::array<float,2>{0.482875377f, 0.211184099f},
-std::array<float,2>{0.586667061f, 0.750826061f},
-std::array<float,2>{0.17878072f, 0.812950373f},
-std::array<float,2>{0.85014987f, 0.152357176f},
-std::array<float,2>{0.278040975f, 0.433722764f},
-std::array<float,2>{0.702469885f, 0.744449735f},
-std::array<float,2>{0.437018067f, 0.60858804f},
-std::array<float,2>{0.508240819f, 0.311568141f},
-std::array<float,2>{0.0921710208f, 0.119920932f},
-std::array<float,2>{0.935738862f, 0.985580862f},
-std::array<float,2>{0.462937951f, 0.809234262f},
-std::array<float,2>{0.607297242f, 0.232811481f},
-std::array<float,2>{0.00771473162f, 0.462095112f},
-std::array<float,2>{0.994407237f, 0.671752214f},
-std::array<float,2>{0.198904723f, 0.545356691f},
-std::array<float,2>{0.783205748f, 0.343457609f},
-std::array<float,2>{0.356382132f, 0.0272267964f},
-std::array<float,2>{0.667076528f, 0.907338262f},
-std::array<float,2>{0.110123605f, 0.962532938f},
-std::array<float,2>{0.88007021f, 0.0710896328f},
-std::array<float,2>{0.385162532f, 0.250393331f},
-std::array<float,2>{0.542397261f, 0.59221673f},
-std::array<float,2>{0.283384502f, 0.697424591f},
-std::array<float,2>{0.723806858f, 0.377039284f},
-std::array<float,2>{0.130970582f, 0.179958075f},
-std::array<float,2>{0.834078133f, 0.849732518f},
-std::array<float,2>{0.394237429f, 0.97143954f},
-std::array<float,2>{0.548912227f, 0.103574708f},
-std::array<float,2>{0.0994135812f, 0.292563438f},
-std::array<float,2>{0.89965564f, 0.611991763f},
-std::array<float,2>{0.152014375f, 0.723309338f},
-std::array<float,2>{0.817398787f, 0.410096556f},
-std::array<float,2>{0.300736219f, 0.128188863f},
-std::array<float,2>{0.747531712f, 0.829873681f},
-std::array<float,2>{0.0216564443f, 0.768126786f},
-std::array<float,2>{0.978907645f, 0.18771714f},
-std::array<float,2>{0.440426111f, 0.480795026f},
-std::array<float,2>{0.611706197f, 0.641885281f},
-std::array<float,2>{0.372938991f, 0.516435266f},
-std::array<float,2>{0.678522289f, 0.356235206f},
-std::array<float,2>{0.207040384f, 0.0381445028f},
-std::array<float,2>{0.803435504f, 0.891030073f},
-std::array<float,2>{0.254452765f, 0.868838072f},
-std::array<float,2>{0.714860976f, 0.171395615f},
-std::array<float,2>{0.169741541f, 0.394760162f},
-std::array<float,2>{0.866538584f, 0.712601185f},
-std::array<float,2>{0.064078927f, 0.565630674f},
-std::array<float,2>{0.917791903f, 0.275915563f},
-std::array<float,2>{0.420575142f, 0.0842921659f},
-std::array<float,2>{0.525629401f, 0.945901394f},
-std::array<float,2>{0.246523991f, 0.927636862f},
-std::array<float,2>{0.760205507f, 0.0107863219f},
-std::array<float,2>{0.329340547f, 0.32611993f},
-std::array<float,2>{0.632528007f, 0.560949624f},
-std::array<float,2>{0.491230696f, 0.682539463f},
-std::array<float,2>{0.568313599f, 0.453116596f},
-std::array<float,2>{0.0362291299f, 0.238223329f},
-std::array<float,2>{0.960654736f, 0.787241697f},
-std::array<float,2>{0.311868131f, 0.940226257f},
-std::array<float,2>{0.734424651f, 0.0866830423f},
-std::array<float,2>{0.147706479f, 0.27248016f},
-std::array<float,2>{0.825096488f, 0.575736284f},
-std::array<float,2>{0.109058611f, 0.706560969f},
-std::array<float,2>{0.897010803f, 0.402649224f},
-std::array<float,2>{0.400313526f, 0.164018258f},
-std::array<float,2>{0.556874692f, 0.860270739f},
-std::array<float,2>{0.218466029f, 0.793265343f},
-std::array<float,2>{0.808696806f, 0.243636265f},
-std::array<float,2>{0.365510136f, 0.444142103f},
-std::array<float,2>{0.680363297f, 0.679455638f},
-std::array<float,2>{0.452476889f, 0.550573051f},
-std::array<float,2>{0.624256611f, 0.317879826f},
-std::array<float,2>{0.0265859999f, 0.00524995476f},
-std::array<float,2>{0.974598408f, 0.936919987f},
-std::array<float,2>{0.411432415f, 0.843192756f},
-std::array<float,2>{0.521797121f, 0.13657324f},
-std::array<float,2>{0.0771917254f, 0.420476228f},
-std::array<float,2>{0.910303533f, 0.727632761f},
-std::array<float,2>{0.161627367f, 0.624405801f},
-std::array<float,2>{0.868369877f, 0.281743765f},
-std::array<float,2>{0.261554688f, 0.0965595022f},
-std::array<float,2>{0.70384866f, 0.979503512f},
-std::array<float,2>{0.040823333f, 0.905646384f},
-std::array<float,2>{0.966439128f, 0.0463318154f},
-std::array<float,2>{0.493866652f, 0.347038597f},
-std::array<float,2>{0.574478149f, 0.528903544f},
-std::array<float,2>{0.341985196f, 0.650472581f},
-std::array<float,2>{0.637120187f, 0.471430451f},
-std::array<float,2>{0.234714225f, 0.202183634f},
-std::array<float,2>{0.75146836f, 0.780594826f},
-std::array<float,2>{0.469405055f, 0.916058302f},
-std::array<float,2>{0.578701198f, 0.0161479171f},
-std::array<float,2>{0.0512081832f, 0.331769377f},
-std::array<float,2>{0.947711527f, 0.532903016f},
-std::array<float,2>{0.223225042f, 0.656782687f},
-std::array<float,2>{0.76780194f, 0.459301561f},
-std::array<float,2>{0.325745046f, 0.222056746f},
-std::array<float,2>{0.648286402f, 0.80125618f},
-std::array<float,2>{0.0824161395f, 0.85291028f},
-std::array<float,2>{0.926689982f, 0.172143951f},
-std::array<float,2>{0.429330289f, 0.384198129f},
-std::array<float,2>{0.50401479f, 0.693748832f},
-std::array<float,2>{0.272976816f, 0.585225344f},
-std::array<float,2>{0.689994216f, 0.263468206f},
-std::array<float,2>{0.185370252f, 0.064624466f},
-std::array<float,2>{0.853983402f, 0.953830242f},
-std::array<float,2>{0.35149911f, 0.763112009f},
-std::array<float,2>{0.659293294f, 0.208014816f},
-std::array<float,2>{0.187532693f, 0.490718931f},
-std::array<float,2>{0.794983387f, 0.639093578f},
-std::array<float,2>{0.0112238415f, 0.508203626f},
-std::array<float,2>{0.985747993f, 0.363153338f},
-std::array<float,2>{0.4533813f, 0.0539899468f},
-std::array<float,2>{0.59956485f, 0.882841587f},
-std::array<float,2>{0.138454288f, 0.996458471f},
-std::array<float,2>{0.839460433f, 0.112245075f},
-std::array<float,2>{0.293937922f, 0.302991718f},
-std::array<float,2>{0.729218423f, 0.594440281f},
-std::array<float,2>{0.376384884f, 0.736884177f},
-std::array<float,2>{0.535208941f, 0.426485062f},
-std::array<float,2>{0.123818919f, 0.141035214f},
-std::array<float,2>{0.887375176f, 0.826825857f},
-std::array<float,2>{0.360561311f, 0.990767419f},
-std::array<float,2>{0.685382068f, 0.123318195f},
-std::array<float,2>{0.211043745f, 0.306206912f},
-std::array<float,2>{0.808174491f, 0.602013409f},
-std::array<float,2>{0.0306286812f, 0.74872905f},
-std::array<float,2>{0.970563471f, 0.43291235f},
-std::array<float,2>{0.446810544f, 0.149386302f},
-std::array<float,2>{0.620531321f, 0.819279552f},
-std::array<float,2>{0.14354609f, 0.754718006f},
-std::array<float,2>{0.823202908f, 0.215091601f},
-std::array<float,2>{0.307399064f, 0.496188611f},
-std::array<float,2>{0.738514662f, 0.628324032f},
-std::array<float,2>{0.404850334f, 0.505680263f},
-std::array<float,2>{0.559275568f, 0.372085005f},
-std::array<float,2>{0.104270995f, 0.056075722f},
-std::array<float,2>{0.893474281f, 0.8813169f},
-std::array<float,2>{0.496427625f, 0.845400631f},
-std::array<float,2>{0.57155484f, 0.187121034f},
-std::array<float,2>{0.0463910215f, 0.379281133f},
-std::array<float,2>{0.963535845f, 0.700175345f},
-std::array<float,2>{0.242166579f, 0.586331487f},
-std::array<float,2>{0.757067978f, 0.254227132f},
-std::array<float,2>{0.339841545f, 0.0753053427f},
-std::array<float,2>{0.633526027f, 0.967493534f},
-std::array<float,2>{0.0715685114f, 0.910668135f},
-std::array<float,2>{0.9100191f, 0.0291340426f},
-std::array<float,2>{0.409775436f, 0.336137801f},
-std::array<float,2>{0.51713872f, 0.539564967f},
-std::array<float,2>{0.265437037f, 0.664756656f},
-std::array<float,2>{0.707626104f, 0.467423528f},
-std::array<float,2>{0.158481151f, 0.228211954f},
-std::array<float,2>{0.871913433f, 0.807238638f},
-std::array<float,2>{0.424078941f, 0.896116078f},
-std::array<float,2>{0.501487374f, 0.0335379504f},
-std::array<float,2>{0.0816434696f, 0.355322242f},
-std::array<float,2>{0.923731863f, 0.521235943f},
-std::array<float,2>{0.183143169f, 0.645956576f},
-std::array<float,2>{0.855549574f, 0.478048414f},
-std::array<float,2>{0.267186612f, 0.193619117f},
-std::array<float,2>{0.694134533f, 0.773238719f},
-std::array<float,2>{0.0470005646f, 0.832293332f},
-std::array<float,2>{0.951945603f, 0.13088344f},
-std::array<float,2>{0.473635107f, 0.410788387f},
-std::array<float,2>{0.58235538f, 0.720740378f},
-std::array<float,2>{0.322202176f, 0.613371432f},
-std::array<float,2>{0.643181324f, 0.296077549f},
-std::array<float,2>{0.221229687f, 0.106714278f},
-std::array<float,2>{0.772177994f, 0.975652575f},
-std::array<float,2>{0.291243345f, 0.783216834f},
-std::array<float,2>{0.732042968f, 0.239852443f},
-std::array<float,2>{0.13561222f, 0.447849214f},
-std::array<float,2>{0.843528807f, 0.686803937f},
-std::array<float,2>{0.120593175f, 0.554723203f},
-std::array<float,2>{0.885764539f, 0.322458208f},
-std::array<float,2>{0.381724f, 0.0143486978f},
-std::array<float,2>{0.532467961f, 0.922364473f},
-std::array<float,2>{0.195269108f, 0.951055825f},
-std::array<float,2>{0.791961074f, 0.0785951614f},
-std::array<float,2>{0.346232861f, 0.279529601f},
-std::array<float,2>{0.663684428f, 0.56989187f},
-std::array<float,2>{0.458641112f, 0.717129707f},
-std::array<float,2>{0.5951702f, 0.393092185f},
-std::array<float,2>{0.0141817462f, 0.166971475f},
-std::array<float,2>{0.991818607f, 0.873704314f},
-std::array<float,2>{0.274019271f, 0.931498766f},
-std::array<float,2>{0.696731091f, 0.00120654842f},
-std::array<float,2>{0.17508173f, 0.3130202f},
-std::array<float,2>{0.845501721f, 0.552232862f},
-std::array<float,2>{0.0887716562f, 0.674488962f},
-std::array<float,2>{0.933443367f, 0.4409087f},
-std::array<float,2>{0.430480361f, 0.247881919f},
-std::array<float,2>{0.513242722f, 0.792171657f},
-std::array<float,2>{0.234276876f, 0.866719902f},
-std::array<float,2>{0.779670894f, 0.156526476f},
-std::array<float,2>{0.319325924f, 0.399634749f},
-std::array<float,2>{0.650744379f, 0.710463881f},
-std::array<float,2>{0.479062706f, 0.571643114f},
-std::array<float,2>{0.590610623f, 0.269134581f},
-std::array<float,2>{0.0610099994f, 0.0902239829f},
-std::array<float,2>{0.944993079f, 0.942786098f},
-std::array<float,2>{0.387911707f, 0.775243104f},
-std::array<float,2>{0.543393075f, 0.196354866f},
-std::array<float,2>{0.116736092f, 0.475411266f},
-std::array<float,2>{0.878365219f, 0.653925478f},
-std::array<float,2>{0.125127643f, 0.524033248f},
-std::array<float,2>{0.829344153f, 0.348023415f},
-std::array<float,2>{0.288251162f, 0.0392330214f},
-std::array<float,2>{0.719599366f, 0.899674892f},
-std::array<float,2>{6.50030488e-05f, 0.982398212f},
-std::array<float,2>{0.998734772f, 0.0985994264f},
-std::array<float,2>{0.466264933f, 0.286359221f},
-std::array<float,2>{0.603281021f, 0.620634019f},
-std::array<float,2>{0.35249126f, 0.730834961f},
-std::array<float,2>{0.669434786f, 0.415816337f},
-std::array<float,2>{0.201699972f, 0.138662934f},
-std::array<float,2>{0.788582265f, 0.838722348f},
-std::array<float,2>{0.443306744f, 0.957954764f},
-std::array<float,2>{0.616116405f, 0.0669409782f},
-std::array<float,2>{0.0189215411f, 0.257938862f},
-std::array<float,2>{0.982879341f, 0.580783784f},
-std::array<float,2>{0.205134422f, 0.689767063f},
-std::array<float,2>{0.799855649f, 0.389093071f},
-std::array<float,2>{0.367384315f, 0.176049054f},
-std::array<float,2>{0.673969746f, 0.85891664f},
-std::array<float,2>{0.0969929695f, 0.798617721f},
-std::array<float,2>{0.906163514f, 0.225447774f},
-std::array<float,2>{0.394548684f, 0.45563972f},
-std::array<float,2>{0.554667413f, 0.661763906f},
-std::array<float,2>{0.303981811f, 0.535368323f},
-std::array<float,2>{0.744193077f, 0.332488269f},
-std::array<float,2>{0.154196367f, 0.0225754939f},
-std::array<float,2>{0.813969016f, 0.918043196f},
-std::array<float,2>{0.333052546f, 0.821384907f},
-std::array<float,2>{0.626924336f, 0.147924647f},
-std::array<float,2>{0.245320886f, 0.42338863f},
-std::array<float,2>{0.76204896f, 0.740137279f},
-std::array<float,2>{0.0347699188f, 0.597841024f},
-std::array<float,2>{0.957010448f, 0.299258202f},
-std::array<float,2>{0.485225052f, 0.114203669f},
-std::array<float,2>{0.565624356f, 0.996035099f},
-std::array<float,2>{0.167197987f, 0.888703346f},
-std::array<float,2>{0.861011922f, 0.0496617146f},
-std::array<float,2>{0.253416985f, 0.364592463f},
-std::array<float,2>{0.712136686f, 0.514069796f},
-std::array<float,2>{0.416765392f, 0.63532418f},
-std::array<float,2>{0.529920757f, 0.487783581f},
-std::array<float,2>{0.0668980032f, 0.203866363f},
-std::array<float,2>{0.918535292f, 0.758273065f},
-std::array<float,2>{0.357954562f, 0.909633577f},
-std::array<float,2>{0.665464461f, 0.0237891749f},
-std::array<float,2>{0.196855724f, 0.34012714f},
-std::array<float,2>{0.78175211f, 0.544408858f},
-std::array<float,2>{0.00483442983f, 0.668934107f},
-std::array<float,2>{0.993272483f, 0.462971628f},
-std::array<float,2>{0.461869836f, 0.231235817f},
-std::array<float,2>{0.608520031f, 0.810786724f},
-std::array<float,2>{0.129276767f, 0.848472476f},
-std::array<float,2>{0.832752585f, 0.182000473f},
-std::array<float,2>{0.282571375f, 0.375577092f},
-std::array<float,2>{0.726138651f, 0.69705987f},
-std::array<float,2>{0.383286059f, 0.59098649f},
-std::array<float,2>{0.540464461f, 0.252083331f},
-std::array<float,2>{0.112134926f, 0.0740080625f},
-std::array<float,2>{0.882450104f, 0.963870108f},
-std::array<float,2>{0.48163563f, 0.753512025f},
-std::array<float,2>{0.589513421f, 0.214024857f},
-std::array<float,2>{0.0579461493f, 0.493030548f},
-std::array<float,2>{0.940397859f, 0.630626976f},
-std::array<float,2>{0.227729648f, 0.500404716f},
-std::array<float,2>{0.776453674f, 0.367624938f},
-std::array<float,2>{0.313694894f, 0.061932575f},
-std::array<float,2>{0.655837119f, 0.877877295f},
-std::array<float,2>{0.0899924785f, 0.988041103f},
-std::array<float,2>{0.934326708f, 0.117532313f},
-std::array<float,2>{0.433788687f, 0.310264111f},
-std::array<float,2>{0.51077491f, 0.607138574f},
-std::array<float,2>{0.280663103f, 0.743581176f},
-std::array<float,2>{0.700901508f, 0.436744332f},
-std::array<float,2>{0.177215874f, 0.154734328f},
-std::array<float,2>{0.849405527f, 0.815057456f},
-std::array<float,2>{0.418793678f, 0.948937356f},
-std::array<float,2>{0.523691893f, 0.0828920379f},
-std::array<float,2>{0.0663348064f, 0.273735404f},
-std::array<float,2>{0.914851308f, 0.563156068f},
-std::array<float,2>{0.170007721f, 0.713754594f},
-std::array<float,2>{0.86505568f, 0.398328304f},
-std::array<float,2>{0.256564587f, 0.168096006f},
-std::array<float,2>{0.717301846f, 0.8691926f},
-std::array<float,2>{0.0375570171f, 0.787106872f},
-std::array<float,2>{0.95826906f, 0.235684186f},
-std::array<float,2>{0.488795191f, 0.451164365f},
-std::array<float,2>{0.56973815f, 0.680313051f},
-std::array<float,2>{0.330354929f, 0.560310006f},
-std::array<float,2>{0.629936099f, 0.32673049f},
-std::array<float,2>{0.248454496f, 0.00815098826f},
-std::array<float,2>{0.758356035f, 0.92818737f},
-std::array<float,2>{0.298166722f, 0.830624998f},
-std::array<float,2>{0.748454034f, 0.125370532f},
-std::array<float,2>{0.149515152f, 0.406260401f},
-std::array<float,2>{0.820051014f, 0.725866616f},
-std::array<float,2>{0.0997299328f, 0.611257911f},
-std::array<float,2>{0.901498079f, 0.289476901f},
-std::array<float,2>{0.3924869f, 0.103099808f},
-std::array<float,2>{0.548409879f, 0.970348895f},
-std::array<float,2>{0.210731328f, 0.892818511f},
-std::array<float,2>{0.800824165f, 0.0360218249f},
-std::array<float,2>{0.373807728f, 0.358444721f},
-std::array<float,2>{0.67693156f, 0.51895839f},
-std::array<float,2>{0.43857795f, 0.642885506f},
-std::array<float,2>{0.610400259f, 0.482572466f},
-std::array<float,2>{0.0203981474f, 0.191337764f},
-std::array<float,2>{0.976818264f, 0.766668081f},
-std::array<float,2>{0.258128494f, 0.9777475f},
-std::array<float,2>{0.705417693f, 0.095537208f},
-std::array<float,2>{0.163088143f, 0.284619242f},
-std::array<float,2>{0.871090472f, 0.622660339f},
-std::array<float,2>{0.0759798735f, 0.730028093f},
-std::array<float,2>{0.913613081f, 0.419496149f},
-std::array<float,2>{0.413255572f, 0.134129047f},
-std::array<float,2>{0.519696951f, 0.840729952f},
-std::array<float,2>{0.237899944f, 0.778055072f},
-std::array<float,2>{0.753482163f, 0.200504482f},
-std::array<float,2>{0.34162125f, 0.470063627f},
-std::array<float,2>{0.640155196f, 0.649602473f},
-std::array<float,2>{0.495873749f, 0.52950114f},
-std::array<float,2>{0.57743746f, 0.34404406f},
-std::array<float,2>{0.0412872732f, 0.0441552736f},
-std::array<float,2>{0.968087554f, 0.903487325f},
-std::array<float,2>{0.40096873f, 0.862885058f},
-std::array<float,2>{0.554844558f, 0.161105365f},
-std::array<float,2>{0.106596768f, 0.405873388f},
-std::array<float,2>{0.894917727f, 0.704623938f},
-std::array<float,2>{0.146078452f, 0.577674031f},
-std::array<float,2>{0.827320933f, 0.271177769f},
-std::array<float,2>{0.310139745f, 0.0880355686f},
-std::array<float,2>{0.736731887f, 0.938528597f},
-std::array<float,2>{0.0245197285f, 0.934648633f},
-std::array<float,2>{0.975263238f, 0.00647999067f},
-std::array<float,2>{0.450816661f, 0.319674522f},
-std::array<float,2>{0.62280786f, 0.547332525f},
-std::array<float,2>{0.363815367f, 0.676730275f},
-std::array<float,2>{0.682593882f, 0.443200976f},
-std::array<float,2>{0.215503186f, 0.245724261f},
-std::array<float,2>{0.811752498f, 0.795812666f},
-std::array<float,2>{0.455517441f, 0.885619044f},
-std::array<float,2>{0.600693345f, 0.0508490466f},
-std::array<float,2>{0.00818747003f, 0.359409481f},
-std::array<float,2>{0.988236368f, 0.510941625f},
-std::array<float,2>{0.19134061f, 0.637384236f},
-std::array<float,2>{0.794647396f, 0.488580287f},
-std::array<float,2>{0.349342197f, 0.2099915f},
-std::array<float,2>{0.657335639f, 0.764416099f},
-std::array<float,2>{0.121692404f, 0.825389028f},
-std::array<float,2>{0.889037967f, 0.142772645f},
-std::array<float,2>{0.378896236f, 0.428429991f},
-std::array<float,2>{0.538499832f, 0.735456109f},
-std::array<float,2>{0.295110315f, 0.59611845f},
-std::array<float,2>{0.72812283f, 0.300944984f},
-std::array<float,2>{0.139228031f, 0.111324668f},
-std::array<float,2>{0.837628841f, 0.999435604f},
-std::array<float,2>{0.326780975f, 0.803324044f},
-std::array<float,2>{0.64592433f, 0.218991652f},
-std::array<float,2>{0.225479126f, 0.457474887f},
-std::array<float,2>{0.767418146f, 0.65986985f},
-std::array<float,2>{0.0540762432f, 0.534923255f},
-std::array<float,2>{0.946172893f, 0.329259336f},
-std::array<float,2>{0.472188711f, 0.0176691785f},
-std::array<float,2>{0.580635965f, 0.915720284f},
-std::array<float,2>{0.18692261f, 0.955609202f},
-std::array<float,2>{0.852208555f, 0.0643363893f},
-std::array<float,2>{0.269866884f, 0.263842911f},
-std::array<float,2>{0.688991845f, 0.582182765f},
-std::array<float,2>{0.427408993f, 0.69221741f},
-std::array<float,2>{0.506815016f, 0.384992957f},
-std::array<float,2>{0.0840866044f, 0.174687594f},
-std::array<float,2>{0.928715467f, 0.853818417f},
-std::array<float,2>{0.336860031f, 0.96547246f},
-std::array<float,2>{0.63510412f, 0.0768504143f},
-std::array<float,2>{0.240205854f, 0.256215334f},
-std::array<float,2>{0.75401932f, 0.588570356f},
-std::array<float,2>{0.0440344289f, 0.702979565f},
-std::array<float,2>{0.961143911f, 0.382717282f},
-std::array<float,2>{0.49988246f, 0.184707463f},
-std::array<float,2>{0.572935939f, 0.847006619f},
-std::array<float,2>{0.156787604f, 0.806199968f},
-std::array<float,2>{0.873578072f, 0.228991702f},
-std::array<float,2>{0.262903064f, 0.466626555f},
-std::array<float,2>{0.710467458f, 0.666128218f},
-std::array<float,2>{0.408013523f, 0.541794002f},
-std::array<float,2>{0.518738925f, 0.3394095f},
-std::array<float,2>{0.0724445134f, 0.0312094558f},
-std::array<float,2>{0.906849563f, 0.913125098f},
-std::array<float,2>{0.448227078f, 0.817932129f},
-std::array<float,2>{0.618587434f, 0.150495008f},
-std::array<float,2>{0.0290690698f, 0.430470318f},
-std::array<float,2>{0.971371412f, 0.746141732f},
-std::array<float,2>{0.212907687f, 0.605153024f},
-std::array<float,2>{0.80638957f, 0.307208091f},
-std::array<float,2>{0.362656564f, 0.122345485f},
-std::array<float,2>{0.686028242f, 0.988591015f},
-std::array<float,2>{0.102108888f, 0.8793872f},
-std::array<float,2>{0.890985608f, 0.05755518f},
-std::array<float,2>{0.403433412f, 0.37321341f},
-std::array<float,2>{0.561588049f, 0.506930292f},
-std::array<float,2>{0.306032449f, 0.626552224f},
-std::array<float,2>{0.740369201f, 0.499765038f},
-std::array<float,2>{0.141758695f, 0.218259558f},
-std::array<float,2>{0.820802987f, 0.757082164f},
-std::array<float,2>{0.379330307f, 0.925467193f},
-std::array<float,2>{0.534751713f, 0.0129303299f},
-std::array<float,2>{0.117784575f, 0.320500076f},
-std::array<float,2>{0.882860601f, 0.556654513f},
-std::array<float,2>{0.133399114f, 0.685081899f},
-std::array<float,2>{0.841472566f, 0.445838541f},
-std::array<float,2>{0.289836019f, 0.240523919f},
-std::array<float,2>{0.734322429f, 0.782367408f},
-std::array<float,2>{0.0127192652f, 0.87271589f},
-std::array<float,2>{0.988560438f, 0.165623099f},
-std::array<float,2>{0.459021598f, 0.391137987f},
-std::array<float,2>{0.596369386f, 0.715724528f},
-std::array<float,2>{0.345204204f, 0.567933857f},
-std::array<float,2>{0.660467923f, 0.278688937f},
-std::array<float,2>{0.191510901f, 0.0807360187f},
-std::array<float,2>{0.790206194f, 0.952554762f},
-std::array<float,2>{0.267647266f, 0.76990813f},
-std::array<float,2>{0.692587674f, 0.192421824f},
-std::array<float,2>{0.180659786f, 0.480049521f},
-std::array<float,2>{0.857980251f, 0.647375762f},
-std::array<float,2>{0.0798536688f, 0.522787154f},
-std::array<float,2>{0.925561011f, 0.35290879f},
-std::array<float,2>{0.423409849f, 0.0325313881f},
-std::array<float,2>{0.502551913f, 0.897472322f},
-std::array<float,2>{0.220343307f, 0.973271728f},
-std::array<float,2>{0.770362258f, 0.10854739f},
-std::array<float,2>{0.323684216f, 0.294543892f},
-std::array<float,2>{0.642032504f, 0.615332961f},
-std::array<float,2>{0.476296902f, 0.720552802f},
-std::array<float,2>{0.584540009f, 0.413853377f},
-std::array<float,2>{0.0498773195f, 0.129678607f},
-std::array<float,2>{0.949374199f, 0.835066617f},
-std::array<float,2>{0.285181165f, 0.900884807f},
-std::array<float,2>{0.722391009f, 0.042471271f},
-std::array<float,2>{0.12838237f, 0.350284249f},
-std::array<float,2>{0.830873907f, 0.525707424f},
-std::array<float,2>{0.11414817f, 0.654922247f},
-std::array<float,2>{0.875695646f, 0.474241108f},
-std::array<float,2>{0.389484197f, 0.198131755f},
-std::array<float,2>{0.546487927f, 0.777325213f},
-std::array<float,2>{0.200193748f, 0.837511957f},
-std::array<float,2>{0.785268724f, 0.139274254f},
-std::array<float,2>{0.354476362f, 0.416735947f},
-std::array<float,2>{0.671636939f, 0.733406365f},
-std::array<float,2>{0.46747759f, 0.618490875f},
-std::array<float,2>{0.6042189f, 0.288133651f},
-std::array<float,2>{0.00329252239f, 0.101125985f},
-std::array<float,2>{0.997895181f, 0.983946562f},
-std::array<float,2>{0.433569133f, 0.789841771f},
-std::array<float,2>{0.514580548f, 0.249343663f},
-std::array<float,2>{0.0869349837f, 0.437559605f},
-std::array<float,2>{0.931373715f, 0.672204375f},
-std::array<float,2>{0.173262313f, 0.553378522f},
-std::array<float,2>{0.845719159f, 0.315919399f},
-std::array<float,2>{0.277231544f, 0.00356595754f},
-std::array<float,2>{0.697454333f, 0.932433426f},
-std::array<float,2>{0.060472101f, 0.943480551f},
-std::array<float,2>{0.942244709f, 0.091860421f},
-std::array<float,2>{0.478027076f, 0.266244709f},
-std::array<float,2>{0.592679083f, 0.573944569f},
-std::array<float,2>{0.318233341f, 0.707936645f},
-std::array<float,2>{0.649106026f, 0.400474548f},
-std::array<float,2>{0.230700627f, 0.159236029f},
-std::array<float,2>{0.778096437f, 0.86453867f},
-std::array<float,2>{0.486392468f, 0.993311465f},
-std::array<float,2>{0.562830985f, 0.116903201f},
-std::array<float,2>{0.0317317881f, 0.297967374f},
-std::array<float,2>{0.953449607f, 0.600309432f},
-std::array<float,2>{0.244029969f, 0.741531968f},
-std::array<float,2>{0.76399976f, 0.425163001f},
-std::array<float,2>{0.334844202f, 0.144822523f},
-std::array<float,2>{0.628611803f, 0.82368201f},
-std::array<float,2>{0.0687114149f, 0.759876609f},
-std::array<float,2>{0.920582235f, 0.206694216f},
-std::array<float,2>{0.414591551f, 0.485968918f},
-std::array<float,2>{0.528572917f, 0.634545922f},
-std::array<float,2>{0.25179112f, 0.512091279f},
-std::array<float,2>{0.714464545f, 0.3671197f},
-std::array<float,2>{0.16463013f, 0.0470043607f},
-std::array<float,2>{0.861456037f, 0.88850826f},
-std::array<float,2>{0.369533062f, 0.857155323f},
-std::array<float,2>{0.671998382f, 0.178395703f},
-std::array<float,2>{0.204848289f, 0.388229936f},
-std::array<float,2>{0.798244298f, 0.689145386f},
-std::array<float,2>{0.0174904801f, 0.578469455f},
-std::array<float,2>{0.981879652f, 0.25988546f},
-std::array<float,2>{0.444049895f, 0.0684072822f},
-std::array<float,2>{0.613673985f, 0.959452093f},
-std::array<float,2>{0.155363321f, 0.920084596f},
-std::array<float,2>{0.815445721f, 0.0209590364f},
-std::array<float,2>{0.301988631f, 0.33441624f},
-std::array<float,2>{0.74361062f, 0.537241876f},
-std::array<float,2>{0.39734453f, 0.663656831f},
-std::array<float,2>{0.552341759f, 0.453601092f},
-std::array<float,2>{0.0948862731f, 0.223662063f},
-std::array<float,2>{0.903940856f, 0.799729705f}}
\ No newline at end of file
@@ -1,4096 +0,0 @@
-{std::array<float,2>{0.771968722f, 0.531835616f},
-std::array<float,2>{0.154035047f, 0.0987078622f},
-std::array<float,2>{0.559589386f, 0.337487549f},
-std::array<float,2>{0.395561576f, 0.783025682f},
-std::array<float,2>{0.662971735f, 0.893003047f},
-std::array<float,2>{0.303806841f, 0.463755965f},
-std::array<float,2>{0.899721801f, 0.173955634f},
-std::array<float,2>{0.0704917684f, 0.635316193f},
-std::array<float,2>{0.614268541f, 0.710124075f},
-std::array<float,2>{0.454155475f, 0.222131297f},
-std::array<float,2>{0.859617114f, 0.375475585f},
-std::array<float,2>{0.241632432f, 0.998898685f},
-std::array<float,2>{0.984965622f, 0.848845541f},
-std::array<float,2>{0.00697508128f, 0.282191843f},
-std::array<float,2>{0.713267028f, 0.041006282f},
-std::array<float,2>{0.334009022f, 0.617129028f},
-std::array<float,2>{0.91934073f, 0.682969093f},
-std::array<float,2>{0.117915906f, 0.131171614f},
-std::array<float,2>{0.634429097f, 0.480805337f},
-std::array<float,2>{0.279941112f, 0.93427819f},
-std::array<float,2>{0.510634005f, 0.757804692f},
-std::array<float,2>{0.409827322f, 0.348560303f},
-std::array<float,2>{0.81216377f, 0.0782877803f},
-std::array<float,2>{0.175869703f, 0.510400236f},
-std::array<float,2>{0.74997592f, 0.584238708f},
-std::array<float,2>{0.352059722f, 0.0302836373f},
-std::array<float,2>{0.964108944f, 0.268333465f},
-std::array<float,2>{0.060043741f, 0.822680473f},
-std::array<float,2>{0.8434847f, 0.948452234f},
-std::array<float,2>{0.198680952f, 0.429265231f},
-std::array<float,2>{0.564262211f, 0.205672219f},
-std::array<float,2>{0.489340484f, 0.745199382f},
-std::array<float,2>{0.850919724f, 0.729351819f},
-std::array<float,2>{0.226742625f, 0.199066624f},
-std::array<float,2>{0.600282431f, 0.416527748f},
-std::array<float,2>{0.438639075f, 0.959372222f},
-std::array<float,2>{0.693939686f, 0.840850651f},
-std::array<float,2>{0.315678388f, 0.261109143f},
-std::array<float,2>{0.969766498f, 0.00816301722f},
-std::array<float,2>{0.017313201f, 0.572264612f},
-std::array<float,2>{0.53426367f, 0.527366042f},
-std::array<float,2>{0.383515775f, 0.0648977086f},
-std::array<float,2>{0.76261425f, 0.366072118f},
-std::array<float,2>{0.131683126f, 0.775871634f},
-std::array<float,2>{0.878679514f, 0.908511639f},
-std::array<float,2>{0.0917369202f, 0.486421853f},
-std::array<float,2>{0.681487918f, 0.154226333f},
-std::array<float,2>{0.283844829f, 0.670687079f},
-std::array<float,2>{0.951654136f, 0.602636516f},
-std::array<float,2>{0.0420379415f, 0.0621800423f},
-std::array<float,2>{0.727527797f, 0.302552909f},
-std::array<float,2>{0.371283352f, 0.872866392f},
-std::array<float,2>{0.590467274f, 0.984140515f},
-std::array<float,2>{0.47704035f, 0.400083989f},
-std::array<float,2>{0.814082682f, 0.242518976f},
-std::array<float,2>{0.210490152f, 0.699374199f},
-std::array<float,2>{0.645260572f, 0.648804069f},
-std::array<float,2>{0.252028227f, 0.159115106f},
-std::array<float,2>{0.930323541f, 0.445920318f},
-std::array<float,2>{0.0965391994f, 0.881080329f},
-std::array<float,2>{0.787523329f, 0.807995081f},
-std::array<float,2>{0.161717936f, 0.314845443f},
-std::array<float,2>{0.523526251f, 0.117564395f},
-std::array<float,2>{0.428005576f, 0.560076356f},
-std::array<float,2>{0.824664652f, 0.565862238f},
-std::array<float,2>{0.212434635f, 0.00325331837f},
-std::array<float,2>{0.584587216f, 0.255503654f},
-std::array<float,2>{0.472101748f, 0.830142617f},
-std::array<float,2>{0.718872905f, 0.968643129f},
-std::array<float,2>{0.360417336f, 0.409525007f},
-std::array<float,2>{0.942890048f, 0.188490301f},
-std::array<float,2>{0.0369475f, 0.723266304f},
-std::array<float,2>{0.521454513f, 0.656621635f},
-std::array<float,2>{0.434885234f, 0.148285866f},
-std::array<float,2>{0.793882847f, 0.496982336f},
-std::array<float,2>{0.171369076f, 0.921853006f},
-std::array<float,2>{0.925742447f, 0.767536402f},
-std::array<float,2>{0.106558725f, 0.370802015f},
-std::array<float,2>{0.649456084f, 0.0775171816f},
-std::array<float,2>{0.259600729f, 0.523280203f},
-std::array<float,2>{0.982997239f, 0.691722333f},
-std::array<float,2>{0.0284077134f, 0.241796017f},
-std::array<float,2>{0.699104548f, 0.391769171f},
-std::array<float,2>{0.325224638f, 0.971631229f},
-std::array<float,2>{0.608695745f, 0.862275541f},
-std::array<float,2>{0.448067516f, 0.309369266f},
-std::array<float,2>{0.854190648f, 0.0484053865f},
-std::array<float,2>{0.222879544f, 0.594327688f},
-std::array<float,2>{0.673637807f, 0.546916306f},
-std::array<float,2>{0.294823587f, 0.115073532f},
-std::array<float,2>{0.888414502f, 0.326031864f},
-std::array<float,2>{0.0828798339f, 0.79734534f},
-std::array<float,2>{0.756690979f, 0.888553262f},
-std::array<float,2>{0.138363689f, 0.439846665f},
-std::array<float,2>{0.543446839f, 0.169234306f},
-std::array<float,2>{0.3752051f, 0.648046374f},
-std::array<float,2>{0.80045408f, 0.632735729f},
-std::array<float,2>{0.180380538f, 0.18457526f},
-std::array<float,2>{0.501562417f, 0.457281291f},
-std::array<float,2>{0.416071624f, 0.899944425f},
-std::array<float,2>{0.628113568f, 0.794119835f},
-std::array<float,2>{0.271964997f, 0.330961734f},
-std::array<float,2>{0.911672831f, 0.103088565f},
-std::array<float,2>{0.115677983f, 0.539138496f},
-std::array<float,2>{0.57728827f, 0.623747289f},
-std::array<float,2>{0.493611902f, 0.0360380225f},
-std::array<float,2>{0.832362473f, 0.296499103f},
-std::array<float,2>{0.190720782f, 0.852870643f},
-std::array<float,2>{0.954690456f, 0.991821587f},
-std::array<float,2>{0.0482198857f, 0.390220493f},
-std::array<float,2>{0.741634488f, 0.23308149f},
-std::array<float,2>{0.347578645f, 0.713554382f},
-std::array<float,2>{0.893425643f, 0.501767814f},
-std::array<float,2>{0.0677653775f, 0.0905443504f},
-std::array<float,2>{0.668029368f, 0.354402214f},
-std::array<float,2>{0.310699612f, 0.758595169f},
-std::array<float,2>{0.552188754f, 0.923116922f},
-std::array<float,2>{0.405856162f, 0.47260958f},
-std::array<float,2>{0.774784565f, 0.136534154f},
-std::array<float,2>{0.144212127f, 0.676822543f},
-std::array<float,2>{0.704632878f, 0.737864256f},
-std::array<float,2>{0.342872232f, 0.21458663f},
-std::array<float,2>{0.994392216f, 0.433840096f},
-std::array<float,2>{0.0111144213f, 0.939370096f},
-std::array<float,2>{0.871317208f, 0.820266426f},
-std::array<float,2>{0.24676691f, 0.274935246f},
-std::array<float,2>{0.623379648f, 0.0220225025f},
-std::array<float,2>{0.465944886f, 0.586845458f},
-std::array<float,2>{0.865362048f, 0.519022405f},
-std::array<float,2>{0.235041827f, 0.0711475387f},
-std::array<float,2>{0.611645877f, 0.37275365f},
-std::array<float,2>{0.459505558f, 0.771039546f},
-std::array<float,2>{0.717023313f, 0.915671408f},
-std::array<float,2>{0.329414546f, 0.492906719f},
-std::array<float,2>{0.990494847f, 0.143176168f},
-std::array<float,2>{0.00166004326f, 0.662788868f},
-std::array<float,2>{0.555254698f, 0.719819248f},
-std::array<float,2>{0.393688262f, 0.194335699f},
-std::array<float,2>{0.768473983f, 0.413533241f},
-std::array<float,2>{0.15230374f, 0.963384509f},
-std::array<float,2>{0.906057298f, 0.834999204f},
-std::array<float,2>{0.0744007528f, 0.251838595f},
-std::array<float,2>{0.657574356f, 0.00646368042f},
-std::array<float,2>{0.300628513f, 0.567990482f},
-std::array<float,2>{0.965302944f, 0.641892493f},
-std::array<float,2>{0.0563630946f, 0.166672796f},
-std::array<float,2>{0.742637992f, 0.443108708f},
-std::array<float,2>{0.358541012f, 0.886389077f},
-std::array<float,2>{0.567716599f, 0.803870618f},
-std::array<float,2>{0.486037999f, 0.320690513f},
-std::array<float,2>{0.839433134f, 0.110020854f},
-std::array<float,2>{0.202681094f, 0.551670969f},
-std::array<float,2>{0.637611449f, 0.601025045f},
-std::array<float,2>{0.27704066f, 0.0511901118f},
-std::array<float,2>{0.914632738f, 0.307816088f},
-std::array<float,2>{0.124680318f, 0.86498028f},
-std::array<float,2>{0.804968476f, 0.974982321f},
-std::array<float,2>{0.172018006f, 0.394962609f},
-std::array<float,2>{0.511978567f, 0.236210182f},
-std::array<float,2>{0.41123414f, 0.688690305f},
-std::array<float,2>{0.759242654f, 0.718204319f},
-std::array<float,2>{0.125116289f, 0.230088532f},
-std::array<float,2>{0.536190569f, 0.384347826f},
-std::array<float,2>{0.388622463f, 0.986207724f},
-std::array<float,2>{0.68481636f, 0.856948256f},
-std::array<float,2>{0.287607431f, 0.28958708f},
-std::array<float,2>{0.88136518f, 0.0334142148f},
-std::array<float,2>{0.0860274285f, 0.618123233f},
-std::array<float,2>{0.595522881f, 0.546052396f},
-std::array<float,2>{0.44291535f, 0.107029058f},
-std::array<float,2>{0.845689058f, 0.333527088f},
-std::array<float,2>{0.233303472f, 0.792410314f},
-std::array<float,2>{0.974884033f, 0.906000614f},
-std::array<float,2>{0.0196541902f, 0.45468685f},
-std::array<float,2>{0.689445615f, 0.183561295f},
-std::array<float,2>{0.319969743f, 0.625898123f},
-std::array<float,2>{0.937384546f, 0.591006398f},
-std::array<float,2>{0.0998426974f, 0.0179829188f},
-std::array<float,2>{0.642148495f, 0.277790129f},
-std::array<float,2>{0.254639834f, 0.813405633f},
-std::array<float,2>{0.530341923f, 0.944775879f},
-std::array<float,2>{0.424750507f, 0.430746824f},
-std::array<float,2>{0.782445371f, 0.218321711f},
-std::array<float,2>{0.159847811f, 0.741891146f},
-std::array<float,2>{0.733679891f, 0.674953878f},
-std::array<float,2>{0.369690031f, 0.140056551f},
-std::array<float,2>{0.947151363f, 0.474346519f},
-std::array<float,2>{0.0455158353f, 0.928762674f},
-std::array<float,2>{0.81860888f, 0.764276087f},
-std::array<float,2>{0.205262363f, 0.356925905f},
-std::array<float,2>{0.586361885f, 0.086450763f},
-std::array<float,2>{0.483405679f, 0.505724251f},
-std::array<float,2>{0.791300416f, 0.612678885f},
-std::array<float,2>{0.166964561f, 0.0467663966f},
-std::array<float,2>{0.518598974f, 0.286879927f},
-std::array<float,2>{0.431308717f, 0.847051978f},
-std::array<float,2>{0.652599037f, 0.992641985f},
-std::array<float,2>{0.263021171f, 0.379364669f},
-std::array<float,2>{0.929023445f, 0.223294795f},
-std::array<float,2>{0.103019454f, 0.706973433f},
-std::array<float,2>{0.580088198f, 0.637344658f},
-std::array<float,2>{0.476017654f, 0.176007941f},
-std::array<float,2>{0.820860386f, 0.466342419f},
-std::array<float,2>{0.218000844f, 0.89547199f},
-std::array<float,2>{0.93797493f, 0.789012074f},
-std::array<float,2>{0.031833142f, 0.340331316f},
-std::array<float,2>{0.726195216f, 0.0951830819f},
-std::array<float,2>{0.366455764f, 0.537721276f},
-std::array<float,2>{0.884389281f, 0.74928993f},
-std::array<float,2>{0.0816043541f, 0.208837718f},
-std::array<float,2>{0.679394305f, 0.425763756f},
-std::array<float,2>{0.292357981f, 0.950312793f},
-std::array<float,2>{0.542905211f, 0.827664018f},
-std::array<float,2>{0.380466998f, 0.272512615f},
-std::array<float,2>{0.753801107f, 0.0245972797f},
-std::array<float,2>{0.135107651f, 0.579329669f},
-std::array<float,2>{0.700921118f, 0.513332367f},
-std::array<float,2>{0.321668535f, 0.0838427842f},
-std::array<float,2>{0.978249192f, 0.347097546f},
-std::array<float,2>{0.0264466461f, 0.750974596f},
-std::array<float,2>{0.859021604f, 0.930250287f},
-std::array<float,2>{0.221996263f, 0.479316831f},
-std::array<float,2>{0.602863431f, 0.126369655f},
-std::array<float,2>{0.450796574f, 0.68716675f},
-std::array<float,2>{0.828817666f, 0.665028095f},
-std::array<float,2>{0.193610206f, 0.1503838f},
-std::array<float,2>{0.570374072f, 0.491209447f},
-std::array<float,2>{0.499281526f, 0.911694109f},
-std::array<float,2>{0.737267494f, 0.77978605f},
-std::array<float,2>{0.348675638f, 0.361303061f},
-std::array<float,2>{0.958255529f, 0.0674132779f},
-std::array<float,2>{0.0537878685f, 0.525863051f},
-std::array<float,2>{0.507096648f, 0.576284885f},
-std::array<float,2>{0.418067902f, 0.0140803969f},
-std::array<float,2>{0.802494109f, 0.261839837f},
-std::array<float,2>{0.185283914f, 0.83773315f},
-std::array<float,2>{0.907760799f, 0.956302106f},
-std::array<float,2>{0.110411108f, 0.418268025f},
-std::array<float,2>{0.62914145f, 0.201006919f},
-std::array<float,2>{0.2661452f, 0.734272003f},
-std::array<float,2>{0.99760735f, 0.55712992f},
-std::array<float,2>{0.0139656272f, 0.122756444f},
-std::array<float,2>{0.707213044f, 0.318884134f},
-std::array<float,2>{0.337657303f, 0.808712661f},
-std::array<float,2>{0.618651748f, 0.87741369f},
-std::array<float,2>{0.464766175f, 0.450228006f},
-std::array<float,2>{0.867494583f, 0.160720304f},
-std::array<float,2>{0.243676275f, 0.65323931f},
-std::array<float,2>{0.667878926f, 0.697949886f},
-std::array<float,2>{0.307663113f, 0.249192253f},
-std::array<float,2>{0.897895694f, 0.405961871f},
-std::array<float,2>{0.0632659718f, 0.978986204f},
-std::array<float,2>{0.780559123f, 0.869732201f},
-std::array<float,2>{0.147619277f, 0.298421174f},
-std::array<float,2>{0.547676444f, 0.0578382798f},
-std::array<float,2>{0.401440203f, 0.606456637f},
-std::array<float,2>{0.810100555f, 0.508736551f},
-std::array<float,2>{0.179437816f, 0.080839701f},
-std::array<float,2>{0.508095801f, 0.350007147f},
-std::array<float,2>{0.407182306f, 0.755767465f},
-std::array<float,2>{0.635216773f, 0.936907828f},
-std::array<float,2>{0.277441889f, 0.482683092f},
-std::array<float,2>{0.921843588f, 0.129734263f},
-std::array<float,2>{0.119546883f, 0.679708719f},
-std::array<float,2>{0.566137314f, 0.743652463f},
-std::array<float,2>{0.491283953f, 0.203614101f},
-std::array<float,2>{0.840343773f, 0.42602089f},
-std::array<float,2>{0.19585681f, 0.946856976f},
-std::array<float,2>{0.962751269f, 0.821229041f},
-std::array<float,2>{0.0620412752f, 0.267142326f},
-std::array<float,2>{0.747226477f, 0.0291084703f},
-std::array<float,2>{0.353593081f, 0.583350897f},
-std::array<float,2>{0.901285589f, 0.633155406f},
-std::array<float,2>{0.0726422966f, 0.172307625f},
-std::array<float,2>{0.660304844f, 0.462156802f},
-std::array<float,2>{0.301790625f, 0.890940607f},
-std::array<float,2>{0.561650634f, 0.78505218f},
-std::array<float,2>{0.397457302f, 0.338457257f},
-std::array<float,2>{0.769706428f, 0.100134693f},
-std::array<float,2>{0.154392213f, 0.534232199f},
-std::array<float,2>{0.712128699f, 0.613331139f},
-std::array<float,2>{0.333609074f, 0.0428595133f},
-std::array<float,2>{0.98662436f, 0.284054488f},
-std::array<float,2>{0.00444217911f, 0.850263119f},
-std::array<float,2>{0.862913251f, 0.996106446f},
-std::array<float,2>{0.240094602f, 0.378100574f},
-std::array<float,2>{0.615975022f, 0.218962267f},
-std::array<float,2>{0.455429494f, 0.707179368f},
-std::array<float,2>{0.815874457f, 0.703078926f},
-std::array<float,2>{0.208969429f, 0.245949641f},
-std::array<float,2>{0.592181206f, 0.401643544f},
-std::array<float,2>{0.478702366f, 0.981306553f},
-std::array<float,2>{0.72991544f, 0.873366654f},
-std::array<float,2>{0.373977661f, 0.303531826f},
-std::array<float,2>{0.949469507f, 0.0601841435f},
-std::array<float,2>{0.0397427678f, 0.603811443f},
-std::array<float,2>{0.526148736f, 0.561858058f},
-std::array<float,2>{0.427584171f, 0.120390028f},
-std::array<float,2>{0.785593271f, 0.312927097f},
-std::array<float,2>{0.163344696f, 0.805668652f},
-std::array<float,2>{0.931979001f, 0.879828691f},
-std::array<float,2>{0.0941802114f, 0.447507143f},
-std::array<float,2>{0.646579087f, 0.15713957f},
-std::array<float,2>{0.250047177f, 0.651919544f},
-std::array<float,2>{0.970731378f, 0.573936164f},
-std::array<float,2>{0.0189631842f, 0.0101782158f},
-std::array<float,2>{0.692369282f, 0.258589298f},
-std::array<float,2>{0.314086199f, 0.842651546f},
-std::array<float,2>{0.597872972f, 0.95812434f},
-std::array<float,2>{0.439810991f, 0.415465027f},
-std::array<float,2>{0.848636925f, 0.196060047f},
-std::array<float,2>{0.229219332f, 0.727967501f},
-std::array<float,2>{0.682942748f, 0.668233871f},
-std::array<float,2>{0.281279266f, 0.156013727f},
-std::array<float,2>{0.875990987f, 0.485830069f},
-std::array<float,2>{0.0922308788f, 0.907318592f},
-std::array<float,2>{0.764230609f, 0.773760915f},
-std::array<float,2>{0.130581081f, 0.364563465f},
-std::array<float,2>{0.532023907f, 0.0637821257f},
-std::array<float,2>{0.384881586f, 0.530283272f},
-std::array<float,2>{0.851670623f, 0.59745574f},
-std::array<float,2>{0.22645168f, 0.0490487926f},
-std::array<float,2>{0.606499791f, 0.312091827f},
-std::array<float,2>{0.447146624f, 0.860136151f},
-std::array<float,2>{0.696226358f, 0.970487952f},
-std::array<float,2>{0.328089684f, 0.393449306f},
-std::array<float,2>{0.981335878f, 0.239724621f},
-std::array<float,2>{0.029580893f, 0.694273353f},
-std::array<float,2>{0.546713054f, 0.645864546f},
-std::array<float,2>{0.378541499f, 0.170174181f},
-std::array<float,2>{0.75573808f, 0.437787592f},
-std::array<float,2>{0.140612781f, 0.890348375f},
-std::array<float,2>{0.889732182f, 0.799606681f},
-std::array<float,2>{0.0852023289f, 0.327803373f},
-std::array<float,2>{0.674589097f, 0.116272539f},
-std::array<float,2>{0.29527688f, 0.550313711f},
-std::array<float,2>{0.94343853f, 0.72582674f},
-std::array<float,2>{0.0377963707f, 0.191065237f},
-std::array<float,2>{0.721728623f, 0.408102989f},
-std::array<float,2>{0.361617595f, 0.965908885f},
-std::array<float,2>{0.583532333f, 0.828649521f},
-std::array<float,2>{0.470192373f, 0.256498098f},
-std::array<float,2>{0.826464117f, 0.00147500436f},
-std::array<float,2>{0.213956267f, 0.563029647f},
-std::array<float,2>{0.651122034f, 0.520354271f},
-std::array<float,2>{0.260616362f, 0.0744862109f},
-std::array<float,2>{0.922701955f, 0.368803531f},
-std::array<float,2>{0.108483829f, 0.768018723f},
-std::array<float,2>{0.794943035f, 0.919791222f},
-std::array<float,2>{0.168664321f, 0.499048889f},
-std::array<float,2>{0.523274302f, 0.145001471f},
-std::array<float,2>{0.436453313f, 0.659662664f},
-std::array<float,2>{0.775470674f, 0.678035378f},
-std::array<float,2>{0.141637549f, 0.132848486f},
-std::array<float,2>{0.55402106f, 0.469787896f},
-std::array<float,2>{0.403732508f, 0.925555587f},
-std::array<float,2>{0.67184943f, 0.761569262f},
-std::array<float,2>{0.310540557f, 0.352232248f},
-std::array<float,2>{0.89191407f, 0.0922660977f},
-std::array<float,2>{0.068841368f, 0.5024544f},
-std::array<float,2>{0.621363521f, 0.589418828f},
-std::array<float,2>{0.468157142f, 0.0214291215f},
-std::array<float,2>{0.874660254f, 0.276816547f},
-std::array<float,2>{0.248416886f, 0.816767573f},
-std::array<float,2>{0.992268324f, 0.939861894f},
-std::array<float,2>{0.00801906176f, 0.435910344f},
-std::array<float,2>{0.706137598f, 0.211591646f},
-std::array<float,2>{0.341674745f, 0.734433889f},
-std::array<float,2>{0.912668824f, 0.541531742f},
-std::array<float,2>{0.114280537f, 0.104169436f},
-std::array<float,2>{0.626807332f, 0.329485387f},
-std::array<float,2>{0.271169335f, 0.79660821f},
-std::array<float,2>{0.502752244f, 0.901874185f},
-std::array<float,2>{0.415873617f, 0.460512698f},
-std::array<float,2>{0.797766626f, 0.185661644f},
-std::array<float,2>{0.182351187f, 0.62932843f},
-std::array<float,2>{0.738971353f, 0.71172297f},
-std::array<float,2>{0.345575988f, 0.232179701f},
-std::array<float,2>{0.956542552f, 0.38825044f},
-std::array<float,2>{0.0502867289f, 0.990214586f},
-std::array<float,2>{0.8342067f, 0.853553891f},
-std::array<float,2>{0.188343599f, 0.294719249f},
-std::array<float,2>{0.575418293f, 0.0376056693f},
-std::array<float,2>{0.494264752f, 0.621531546f},
-std::array<float,2>{0.836853743f, 0.553686678f},
-std::array<float,2>{0.199564561f, 0.111475401f},
-std::array<float,2>{0.56868273f, 0.324218333f},
-std::array<float,2>{0.486946434f, 0.801960766f},
-std::array<float,2>{0.745934963f, 0.884054124f},
-std::array<float,2>{0.357290626f, 0.443973064f},
-std::array<float,2>{0.96754849f, 0.165204465f},
-std::array<float,2>{0.0579004958f, 0.642640233f},
-std::array<float,2>{0.514639914f, 0.690891683f},
-std::array<float,2>{0.413027108f, 0.236947194f},
-std::array<float,2>{0.807134867f, 0.397335321f},
-std::array<float,2>{0.174716875f, 0.973811388f},
-std::array<float,2>{0.917131364f, 0.866052926f},
-std::array<float,2>{0.122912116f, 0.305905849f},
-std::array<float,2>{0.640155733f, 0.0532049015f},
-std::array<float,2>{0.273973435f, 0.599042952f},
-std::array<float,2>{0.98895365f, 0.660597801f},
-std::array<float,2>{0.00354689127f, 0.140898108f},
-std::array<float,2>{0.715593696f, 0.49456206f},
-std::array<float,2>{0.330560893f, 0.916769207f},
-std::array<float,2>{0.609916031f, 0.77251786f},
-std::array<float,2>{0.457906425f, 0.373109311f},
-std::array<float,2>{0.864542544f, 0.0728273317f},
-std::array<float,2>{0.237352908f, 0.516694307f},
-std::array<float,2>{0.660003483f, 0.569558263f},
-std::array<float,2>{0.297501385f, 0.00444636447f},
-std::array<float,2>{0.903133392f, 0.251956105f},
-std::array<float,2>{0.0779768601f, 0.832449019f},
-std::array<float,2>{0.766710043f, 0.961942434f},
-std::array<float,2>{0.149319887f, 0.410728902f},
-std::array<float,2>{0.557377934f, 0.191586196f},
-std::array<float,2>{0.392140955f, 0.721680105f},
-std::array<float,2>{0.783641934f, 0.738725364f},
-std::array<float,2>{0.157553628f, 0.216791615f},
-std::array<float,2>{0.52792871f, 0.433214992f},
-std::array<float,2>{0.423756063f, 0.942496181f},
-std::array<float,2>{0.643567979f, 0.815655291f},
-std::array<float,2>{0.256493926f, 0.28110081f},
-std::array<float,2>{0.933987916f, 0.0173816029f},
-std::array<float,2>{0.0978883654f, 0.592372298f},
-std::array<float,2>{0.588795304f, 0.507386923f},
-std::array<float,2>{0.480516583f, 0.0881740302f},
-std::array<float,2>{0.818172157f, 0.358520299f},
-std::array<float,2>{0.204009071f, 0.761856556f},
-std::array<float,2>{0.94770813f, 0.926461399f},
-std::array<float,2>{0.0445043743f, 0.476272225f},
-std::array<float,2>{0.731367052f, 0.138201565f},
-std::array<float,2>{0.367204845f, 0.673147917f},
-std::array<float,2>{0.879597664f, 0.620037675f},
-std::array<float,2>{0.088329412f, 0.0315463133f},
-std::array<float,2>{0.686312795f, 0.292812377f},
-std::array<float,2>{0.28610903f, 0.858101785f},
-std::array<float,2>{0.537852168f, 0.986508131f},
-std::array<float,2>{0.389503956f, 0.385398686f},
-std::array<float,2>{0.760426521f, 0.228378445f},
-std::array<float,2>{0.12833111f, 0.71596688f},
-std::array<float,2>{0.690588713f, 0.628890812f},
-std::array<float,2>{0.316796929f, 0.180473432f},
-std::array<float,2>{0.973155379f, 0.45698306f},
-std::array<float,2>{0.0220667794f, 0.903352499f},
-std::array<float,2>{0.846797049f, 0.790154278f},
-std::array<float,2>{0.232227057f, 0.335655272f},
-std::array<float,2>{0.596159101f, 0.107665695f},
-std::array<float,2>{0.4437325f, 0.543936491f},
-std::array<float,2>{0.750365615f, 0.580387056f},
-std::array<float,2>{0.134617165f, 0.0267716199f},
-std::array<float,2>{0.540236056f, 0.270593882f},
-std::array<float,2>{0.381436139f, 0.825793982f},
-std::array<float,2>{0.676757157f, 0.952657163f},
-std::array<float,2>{0.29072997f, 0.423137367f},
-std::array<float,2>{0.885369837f, 0.209167883f},
-std::array<float,2>{0.0781292096f, 0.746882737f},
-std::array<float,2>{0.604417503f, 0.685400009f},
-std::array<float,2>{0.451183349f, 0.1276602f},
-std::array<float,2>{0.856526375f, 0.477012247f},
-std::array<float,2>{0.219868794f, 0.931804836f},
-std::array<float,2>{0.979409754f, 0.753176033f},
-std::array<float,2>{0.0241851136f, 0.34394604f},
-std::array<float,2>{0.702534854f, 0.0851517543f},
-std::array<float,2>{0.322726369f, 0.514365435f},
-std::array<float,2>{0.927533746f, 0.704635262f},
-std::array<float,2>{0.103918374f, 0.225446746f},
-std::array<float,2>{0.654862285f, 0.382395744f},
-std::array<float,2>{0.263688922f, 0.994327188f},
-std::array<float,2>{0.517143667f, 0.844783783f},
-std::array<float,2>{0.431886256f, 0.288082898f},
-std::array<float,2>{0.790994346f, 0.0443614572f},
-std::array<float,2>{0.164146334f, 0.610464871f},
-std::array<float,2>{0.722711086f, 0.535316646f},
-std::array<float,2>{0.363486022f, 0.0960717201f},
-std::array<float,2>{0.939462364f, 0.343176574f},
-std::array<float,2>{0.0348819718f, 0.786238134f},
-std::array<float,2>{0.822550774f, 0.897193015f},
-std::array<float,2>{0.21522361f, 0.468530774f},
-std::array<float,2>{0.579820752f, 0.178232819f},
-std::array<float,2>{0.473555893f, 0.640033603f},
-std::array<float,2>{0.869572163f, 0.655014813f},
-std::array<float,2>{0.245514095f, 0.16277431f},
-std::array<float,2>{0.620543242f, 0.452694565f},
-std::array<float,2>{0.46142441f, 0.875826001f},
-std::array<float,2>{0.710930169f, 0.811618328f},
-std::array<float,2>{0.339727461f, 0.317090809f},
-std::array<float,2>{0.998937428f, 0.123337194f},
-std::array<float,2>{0.0131221507f, 0.555412769f},
-std::array<float,2>{0.549984872f, 0.608727574f},
-std::array<float,2>{0.398600072f, 0.0563510768f},
-std::array<float,2>{0.779139757f, 0.299303174f},
-std::array<float,2>{0.145429939f, 0.867332816f},
-std::array<float,2>{0.896210134f, 0.977587461f},
-std::array<float,2>{0.0657983795f, 0.403600544f},
-std::array<float,2>{0.664812565f, 0.247128993f},
-std::array<float,2>{0.305565029f, 0.696076512f},
-std::array<float,2>{0.959548056f, 0.525163174f},
-std::array<float,2>{0.0516630933f, 0.0689732283f},
-std::array<float,2>{0.736061633f, 0.362419248f},
-std::array<float,2>{0.350728631f, 0.779234827f},
-std::array<float,2>{0.57379657f, 0.913385749f},
-std::array<float,2>{0.498024911f, 0.489837527f},
-std::array<float,2>{0.830881476f, 0.150446966f},
-std::array<float,2>{0.191983685f, 0.666763902f},
-std::array<float,2>{0.630986333f, 0.731208324f},
-std::array<float,2>{0.269486278f, 0.202660069f},
-std::array<float,2>{0.909684896f, 0.420311242f},
-std::array<float,2>{0.112608805f, 0.953145683f},
-std::array<float,2>{0.804143667f, 0.839098752f},
-std::array<float,2>{0.185640454f, 0.264083475f},
-std::array<float,2>{0.505522013f, 0.0118219275f},
-std::array<float,2>{0.420859039f, 0.574630558f},
-std::array<float,2>{0.762917101f, 0.52942276f},
-std::array<float,2>{0.131915927f, 0.06282489f},
-std::array<float,2>{0.534151137f, 0.363658011f},
-std::array<float,2>{0.3844679f, 0.775387466f},
-std::array<float,2>{0.679906547f, 0.907178342f},
-std::array<float,2>{0.284341663f, 0.484899431f},
-std::array<float,2>{0.876977503f, 0.154576257f},
-std::array<float,2>{0.0904364437f, 0.669423699f},
-std::array<float,2>{0.601306021f, 0.726646245f},
-std::array<float,2>{0.437962711f, 0.196423754f},
-std::array<float,2>{0.849811733f, 0.4146716f},
-std::array<float,2>{0.227829099f, 0.957609713f},
-std::array<float,2>{0.968870521f, 0.842981339f},
-std::array<float,2>{0.0158965681f, 0.259506971f},
-std::array<float,2>{0.694466293f, 0.0114814555f},
-std::array<float,2>{0.315190405f, 0.572831869f},
-std::array<float,2>{0.93159169f, 0.65072155f},
-std::array<float,2>{0.0971215293f, 0.157420486f},
-std::array<float,2>{0.646043181f, 0.448707908f},
-std::array<float,2>{0.253838986f, 0.880109847f},
-std::array<float,2>{0.52513659f, 0.805132687f},
-std::array<float,2>{0.429080784f, 0.314124644f},
-std::array<float,2>{0.788959861f, 0.119231023f},
-std::array<float,2>{0.160682008f, 0.560972214f},
-std::array<float,2>{0.728099167f, 0.605154455f},
-std::array<float,2>{0.372338533f, 0.0593633093f},
-std::array<float,2>{0.952970803f, 0.3038311f},
-std::array<float,2>{0.0411299504f, 0.874080777f},
-std::array<float,2>{0.813013077f, 0.982278407f},
-std::array<float,2>{0.209578201f, 0.400717616f},
-std::array<float,2>{0.591600895f, 0.244632587f},
-std::array<float,2>{0.47807312f, 0.701537192f},
-std::array<float,2>{0.860995471f, 0.708293557f},
-std::array<float,2>{0.240945518f, 0.220104575f},
-std::array<float,2>{0.614164412f, 0.377462119f},
-std::array<float,2>{0.453202724f, 0.997386098f},
-std::array<float,2>{0.714592397f, 0.851262391f},
-std::array<float,2>{0.334976137f, 0.285071969f},
-std::array<float,2>{0.985580504f, 0.0414150208f},
-std::array<float,2>{0.00599177554f, 0.614322782f},
-std::array<float,2>{0.558888853f, 0.533426404f},
-std::array<float,2>{0.394874573f, 0.101213746f},
-std::array<float,2>{0.77287817f, 0.339004517f},
-std::array<float,2>{0.152606979f, 0.783550501f},
-std::array<float,2>{0.898898065f, 0.891683102f},
-std::array<float,2>{0.0716110691f, 0.461085826f},
-std::array<float,2>{0.663740277f, 0.173210517f},
-std::array<float,2>{0.302899987f, 0.633910418f},
-std::array<float,2>{0.96337074f, 0.582922816f},
-std::array<float,2>{0.0585962906f, 0.0277523138f},
-std::array<float,2>{0.748238087f, 0.265792102f},
-std::array<float,2>{0.352971613f, 0.821850836f},
-std::array<float,2>{0.563259006f, 0.946044624f},
-std::array<float,2>{0.488456488f, 0.427391887f},
-std::array<float,2>{0.842263937f, 0.204455465f},
-std::array<float,2>{0.198123932f, 0.742500424f},
-std::array<float,2>{0.633488417f, 0.680986285f},
-std::array<float,2>{0.280459613f, 0.12997742f},
-std::array<float,2>{0.918491483f, 0.484270781f},
-std::array<float,2>{0.118267484f, 0.936053574f},
-std::array<float,2>{0.81127876f, 0.754132271f},
-std::array<float,2>{0.177068114f, 0.350634307f},
-std::array<float,2>{0.51093024f, 0.0811405033f},
-std::array<float,2>{0.409029394f, 0.509291112f},
-std::array<float,2>{0.833391786f, 0.622890532f},
-std::array<float,2>{0.190305308f, 0.0382080302f},
-std::array<float,2>{0.576634228f, 0.293452382f},
-std::array<float,2>{0.49284479f, 0.854572177f},
-std::array<float,2>{0.740475237f, 0.988670766f},
-std::array<float,2>{0.345912755f, 0.387365252f},
-std::array<float,2>{0.953876972f, 0.230831593f},
-std::array<float,2>{0.0474146605f, 0.712050974f},
-std::array<float,2>{0.500452578f, 0.630809367f},
-std::array<float,2>{0.417057574f, 0.187020376f},
-std::array<float,2>{0.798967183f, 0.459332854f},
-std::array<float,2>{0.181430608f, 0.901367128f},
-std::array<float,2>{0.911069214f, 0.795379877f},
-std::array<float,2>{0.116727293f, 0.328817815f},
-std::array<float,2>{0.627366841f, 0.104828954f},
-std::array<float,2>{0.27258119f, 0.542595863f},
-std::array<float,2>{0.995753288f, 0.736076355f},
-std::array<float,2>{0.0103556067f, 0.212822169f},
-std::array<float,2>{0.704021931f, 0.436917871f},
-std::array<float,2>{0.342521131f, 0.941129923f},
-std::array<float,2>{0.624217093f, 0.817426622f},
-std::array<float,2>{0.465171069f, 0.275605977f},
-std::array<float,2>{0.872299969f, 0.0202738103f},
-std::array<float,2>{0.247866914f, 0.588599503f},
-std::array<float,2>{0.669288218f, 0.503300548f},
-std::array<float,2>{0.311955065f, 0.093172498f},
-std::array<float,2>{0.893642604f, 0.352725476f},
-std::array<float,2>{0.0665497929f, 0.760658741f},
-std::array<float,2>{0.77370733f, 0.924438119f},
-std::array<float,2>{0.142828047f, 0.46897319f},
-std::array<float,2>{0.551605821f, 0.133993313f},
-std::array<float,2>{0.405088484f, 0.679491043f},
-std::array<float,2>{0.794194639f, 0.658419669f},
-std::array<float,2>{0.170757487f, 0.145740941f},
-std::array<float,2>{0.519668996f, 0.498954684f},
-std::array<float,2>{0.43379581f, 0.91819334f},
-std::array<float,2>{0.649269044f, 0.769448876f},
-std::array<float,2>{0.258778155f, 0.36797443f},
-std::array<float,2>{0.924223423f, 0.0754613951f},
-std::array<float,2>{0.106104471f, 0.520877063f},
-std::array<float,2>{0.585687399f, 0.563713849f},
-std::array<float,2>{0.471185118f, 0.000968871929f},
-std::array<float,2>{0.825327396f, 0.257429808f},
-std::array<float,2>{0.211556047f, 0.829494774f},
-std::array<float,2>{0.941515386f, 0.96512866f},
-std::array<float,2>{0.0359599702f, 0.407007337f},
-std::array<float,2>{0.720543325f, 0.189822942f},
-std::array<float,2>{0.359941274f, 0.725356519f},
-std::array<float,2>{0.886835396f, 0.549792707f},
-std::array<float,2>{0.0833899155f, 0.11604961f},
-std::array<float,2>{0.672417939f, 0.326701552f},
-std::array<float,2>{0.293034911f, 0.800742567f},
-std::array<float,2>{0.544419646f, 0.889380336f},
-std::array<float,2>{0.376916289f, 0.43909952f},
-std::array<float,2>{0.757708251f, 0.171669394f},
-std::array<float,2>{0.137317955f, 0.644845247f},
-std::array<float,2>{0.697597861f, 0.694852173f},
-std::array<float,2>{0.324829489f, 0.238772064f},
-std::array<float,2>{0.983491004f, 0.39361161f},
-std::array<float,2>{0.0279420856f, 0.969302773f},
-std::array<float,2>{0.855215311f, 0.86043787f},
-std::array<float,2>{0.223751828f, 0.310858518f},
-std::array<float,2>{0.608277261f, 0.049822446f},
-std::array<float,2>{0.448782563f, 0.596037388f},
-std::array<float,2>{0.844416618f, 0.544435203f},
-std::array<float,2>{0.233636916f, 0.108981043f},
-std::array<float,2>{0.59425348f, 0.334895134f},
-std::array<float,2>{0.441973418f, 0.789936483f},
-std::array<float,2>{0.688377738f, 0.902511358f},
-std::array<float,2>{0.318382472f, 0.455580413f},
-std::array<float,2>{0.976354778f, 0.181234851f},
-std::array<float,2>{0.0212517716f, 0.627442896f},
-std::array<float,2>{0.53578186f, 0.715549171f},
-std::array<float,2>{0.386718929f, 0.227343559f},
-std::array<float,2>{0.757829964f, 0.386605203f},
-std::array<float,2>{0.126107931f, 0.987521708f},
-std::array<float,2>{0.882527351f, 0.859148502f},
-std::array<float,2>{0.0873278454f, 0.291340649f},
-std::array<float,2>{0.68385613f, 0.0327601545f},
-std::array<float,2>{0.288469046f, 0.62107867f},
-std::array<float,2>{0.945581257f, 0.67250663f},
-std::array<float,2>{0.046548754f, 0.136810169f},
-std::array<float,2>{0.733342707f, 0.475401163f},
-std::array<float,2>{0.370215207f, 0.927327454f},
-std::array<float,2>{0.587850809f, 0.762731493f},
-std::array<float,2>{0.482654035f, 0.358360738f},
-std::array<float,2>{0.819799304f, 0.0891328529f},
-std::array<float,2>{0.206852898f, 0.506711423f},
-std::array<float,2>{0.641200602f, 0.593688667f},
-std::array<float,2>{0.254954576f, 0.0158359502f},
-std::array<float,2>{0.936147153f, 0.279365361f},
-std::array<float,2>{0.101521f, 0.814606011f},
-std::array<float,2>{0.781618953f, 0.942361534f},
-std::array<float,2>{0.158515185f, 0.432606339f},
-std::array<float,2>{0.529540718f, 0.215651914f},
-std::array<float,2>{0.424938679f, 0.739932835f},
-std::array<float,2>{0.769038856f, 0.720723808f},
-std::array<float,2>{0.150643244f, 0.192422628f},
-std::array<float,2>{0.556546807f, 0.411485314f},
-std::array<float,2>{0.393341303f, 0.961557627f},
-std::array<float,2>{0.656362414f, 0.833013713f},
-std::array<float,2>{0.299342155f, 0.253834963f},
-std::array<float,2>{0.904825032f, 0.00571512291f},
-std::array<float,2>{0.0758634359f, 0.568738103f},
-std::array<float,2>{0.612939179f, 0.516543925f},
-std::array<float,2>{0.460395724f, 0.0739694685f},
-std::array<float,2>{0.866781533f, 0.374070913f},
-std::array<float,2>{0.236325055f, 0.77222383f},
-std::array<float,2>{0.99126786f, 0.917715311f},
-std::array<float,2>{0.000162691882f, 0.495919555f},
-std::array<float,2>{0.718281209f, 0.14175877f},
-std::array<float,2>{0.328580558f, 0.662007451f},
-std::array<float,2>{0.915973008f, 0.598367393f},
-std::array<float,2>{0.123762958f, 0.0546115749f},
-std::array<float,2>{0.637903273f, 0.305483729f},
-std::array<float,2>{0.275984973f, 0.867093205f},
-std::array<float,2>{0.512744963f, 0.972763538f},
-std::array<float,2>{0.410193801f, 0.398103684f},
-std::array<float,2>{0.806505024f, 0.237961322f},
-std::array<float,2>{0.17322816f, 0.690359414f},
-std::array<float,2>{0.744013846f, 0.64399302f},
-std::array<float,2>{0.357686758f, 0.164804727f},
-std::array<float,2>{0.966537416f, 0.444958329f},
-std::array<float,2>{0.055250559f, 0.883770347f},
-std::array<float,2>{0.838238716f, 0.801178217f},
-std::array<float,2>{0.201776803f, 0.322859615f},
-std::array<float,2>{0.567050338f, 0.112479195f},
-std::array<float,2>{0.485251039f, 0.554669142f},
-std::array<float,2>{0.801293194f, 0.575897396f},
-std::array<float,2>{0.183943465f, 0.013078101f},
-std::array<float,2>{0.506397665f, 0.26483348f},
-std::array<float,2>{0.419911444f, 0.83838141f},
-std::array<float,2>{0.630515695f, 0.95438832f},
-std::array<float,2>{0.266852617f, 0.421112567f},
-std::array<float,2>{0.9068169f, 0.20208557f},
-std::array<float,2>{0.109682962f, 0.731905162f},
-std::array<float,2>{0.571546912f, 0.667026401f},
-std::array<float,2>{0.498081893f, 0.151855528f},
-std::array<float,2>{0.829789817f, 0.488896549f},
-std::array<float,2>{0.194485068f, 0.912136912f},
-std::array<float,2>{0.957958639f, 0.777910173f},
-std::array<float,2>{0.0533468276f, 0.361364782f},
-std::array<float,2>{0.737707913f, 0.0694042817f},
-std::array<float,2>{0.348042428f, 0.523465037f},
-std::array<float,2>{0.896520436f, 0.696335852f},
-std::array<float,2>{0.0639581755f, 0.246752456f},
-std::array<float,2>{0.666351557f, 0.402822405f},
-std::array<float,2>{0.307030648f, 0.976842046f},
-std::array<float,2>{0.548131645f, 0.868685603f},
-std::array<float,2>{0.40077284f, 0.299974978f},
-std::array<float,2>{0.779478788f, 0.0552761145f},
-std::array<float,2>{0.147321627f, 0.608008862f},
-std::array<float,2>{0.708849788f, 0.55567807f},
-std::array<float,2>{0.336081803f, 0.124053858f},
-std::array<float,2>{0.996198595f, 0.318291724f},
-std::array<float,2>{0.015590013f, 0.811500907f},
-std::array<float,2>{0.86898464f, 0.876857996f},
-std::array<float,2>{0.242579803f, 0.45196265f},
-std::array<float,2>{0.617891908f, 0.16358453f},
-std::array<float,2>{0.46339798f, 0.655650079f},
-std::array<float,2>{0.821752548f, 0.639448225f},
-std::array<float,2>{0.217110381f, 0.178955302f},
-std::array<float,2>{0.581896186f, 0.467306256f},
-std::array<float,2>{0.475276083f, 0.89747268f},
-std::array<float,2>{0.724930763f, 0.786031067f},
-std::array<float,2>{0.365348369f, 0.341909796f},
-std::array<float,2>{0.938999116f, 0.0975145176f},
-std::array<float,2>{0.0328572392f, 0.53659004f},
-std::array<float,2>{0.517638028f, 0.609841526f},
-std::array<float,2>{0.430354923f, 0.043718148f},
-std::array<float,2>{0.792657793f, 0.289032042f},
-std::array<float,2>{0.167177007f, 0.844613612f},
-std::array<float,2>{0.928326726f, 0.99525702f},
-std::array<float,2>{0.101932406f, 0.381232411f},
-std::array<float,2>{0.653504014f, 0.226270765f},
-std::array<float,2>{0.262363493f, 0.703442335f},
-std::array<float,2>{0.976593077f, 0.515334368f},
-std::array<float,2>{0.0257343799f, 0.0848964155f},
-std::array<float,2>{0.699929595f, 0.345358431f},
-std::array<float,2>{0.320463151f, 0.752352953f},
-std::array<float,2>{0.602105916f, 0.933065593f},
-std::array<float,2>{0.449614197f, 0.478248537f},
-std::array<float,2>{0.857687533f, 0.128285408f},
-std::array<float,2>{0.221588537f, 0.684297562f},
-std::array<float,2>{0.678690374f, 0.747453332f},
-std::array<float,2>{0.291718155f, 0.210686758f},
-std::array<float,2>{0.883691251f, 0.421926737f},
-std::array<float,2>{0.0801097155f, 0.951410294f},
-std::array<float,2>{0.752804279f, 0.825032771f},
-std::array<float,2>{0.136390999f, 0.270069808f},
-std::array<float,2>{0.541268349f, 0.0262600351f},
-std::array<float,2>{0.379230767f, 0.581712186f},
-std::array<float,2>{0.786333025f, 0.559019923f},
-std::array<float,2>{0.162123665f, 0.118360817f},
-std::array<float,2>{0.526552975f, 0.316376716f},
-std::array<float,2>{0.426148295f, 0.806961298f},
-std::array<float,2>{0.648305357f, 0.882176399f},
-std::array<float,2>{0.251049846f, 0.447010428f},
-std::array<float,2>{0.933217824f, 0.159804091f},
-std::array<float,2>{0.0947458744f, 0.649770617f},
-std::array<float,2>{0.593091726f, 0.700384498f},
-std::array<float,2>{0.479947984f, 0.243533686f},
-std::array<float,2>{0.814831197f, 0.398627788f},
-std::array<float,2>{0.207032844f, 0.983048022f},
-std::array<float,2>{0.950224102f, 0.871335089f},
-std::array<float,2>{0.0410060436f, 0.301287085f},
-std::array<float,2>{0.729140043f, 0.0612675957f},
-std::array<float,2>{0.374582499f, 0.602439582f},
-std::array<float,2>{0.87529707f, 0.671266377f},
-std::array<float,2>{0.0935106128f, 0.153257743f},
-std::array<float,2>{0.681986153f, 0.48742798f},
-std::array<float,2>{0.282738358f, 0.909465015f},
-std::array<float,2>{0.532750487f, 0.776560605f},
-std::array<float,2>{0.386538059f, 0.366519332f},
-std::array<float,2>{0.765580416f, 0.0664017797f},
-std::array<float,2>{0.129346967f, 0.529184222f},
-std::array<float,2>{0.692602277f, 0.571236372f},
-std::array<float,2>{0.313399732f, 0.00955405831f},
-std::array<float,2>{0.97179383f, 0.260424018f},
-std::array<float,2>{0.0182393435f, 0.840087354f},
-std::array<float,2>{0.848188937f, 0.960534871f},
-std::array<float,2>{0.230151102f, 0.417764843f},
-std::array<float,2>{0.598959446f, 0.197869003f},
-std::array<float,2>{0.441292584f, 0.729599953f},
-std::array<float,2>{0.841130137f, 0.744430482f},
-std::array<float,2>{0.196556821f, 0.20627223f},
-std::array<float,2>{0.564597845f, 0.428105563f},
-std::array<float,2>{0.490970761f, 0.947401941f},
-std::array<float,2>{0.746685207f, 0.823494673f},
-std::array<float,2>{0.355178535f, 0.269344091f},
-std::array<float,2>{0.961354792f, 0.029480692f},
-std::array<float,2>{0.0609731711f, 0.585410297f},
-std::array<float,2>{0.509550333f, 0.511129022f},
-std::array<float,2>{0.407960743f, 0.0793103129f},
-std::array<float,2>{0.808918536f, 0.348860562f},
-std::array<float,2>{0.178453118f, 0.755999207f},
-std::array<float,2>{0.920361876f, 0.934770107f},
-std::array<float,2>{0.120712623f, 0.482121348f},
-std::array<float,2>{0.636233926f, 0.132085085f},
-std::array<float,2>{0.278886139f, 0.681688488f},
-std::array<float,2>{0.987823963f, 0.615641236f},
-std::array<float,2>{0.00550005818f, 0.0395676233f},
-std::array<float,2>{0.711030245f, 0.282619298f},
-std::array<float,2>{0.332224488f, 0.847910702f},
-std::array<float,2>{0.616307497f, 0.999673128f},
-std::array<float,2>{0.456108272f, 0.376066744f},
-std::array<float,2>{0.861960649f, 0.221397936f},
-std::array<float,2>{0.238359183f, 0.709748924f},
-std::array<float,2>{0.66155231f, 0.636503875f},
-std::array<float,2>{0.30092302f, 0.175318614f},
-std::array<float,2>{0.902269185f, 0.46440962f},
-std::array<float,2>{0.0737849846f, 0.894194245f},
-std::array<float,2>{0.771298826f, 0.781309664f},
-std::array<float,2>{0.155311778f, 0.336254984f},
-std::array<float,2>{0.560585439f, 0.098089546f},
-std::array<float,2>{0.397924036f, 0.532597542f},
-std::array<float,2>{0.873249829f, 0.587329388f},
-std::array<float,2>{0.249380589f, 0.0230622888f},
-std::array<float,2>{0.622910023f, 0.274225622f},
-std::array<float,2>{0.467459679f, 0.818592131f},
-std::array<float,2>{0.705537856f, 0.938362002f},
-std::array<float,2>{0.340774089f, 0.434983045f},
-std::array<float,2>{0.993732095f, 0.213018805f},
-std::array<float,2>{0.00933329016f, 0.736884594f},
-std::array<float,2>{0.553476989f, 0.676730573f},
-std::array<float,2>{0.402555943f, 0.135620147f},
-std::array<float,2>{0.77658385f, 0.470735729f},
-std::array<float,2>{0.141468167f, 0.922705472f},
-std::array<float,2>{0.891520441f, 0.7597363f},
-std::array<float,2>{0.0698261186f, 0.355095714f},
-std::array<float,2>{0.670023084f, 0.0915947109f},
-std::array<float,2>{0.309033126f, 0.50000602f},
-std::array<float,2>{0.955156922f, 0.714734495f},
-std::array<float,2>{0.0493158028f, 0.233473912f},
-std::array<float,2>{0.739584386f, 0.388711601f},
-std::array<float,2>{0.344426751f, 0.990639746f},
-std::array<float,2>{0.574278057f, 0.851621866f},
-std::array<float,2>{0.495839894f, 0.295333356f},
-std::array<float,2>{0.835702538f, 0.0367964879f},
-std::array<float,2>{0.189007774f, 0.624947131f},
-std::array<float,2>{0.625143826f, 0.541010082f},
-std::array<float,2>{0.26971209f, 0.102507032f},
-std::array<float,2>{0.913284421f, 0.331591666f},
-std::array<float,2>{0.113350473f, 0.79366523f},
-std::array<float,2>{0.798252404f, 0.899293602f},
-std::array<float,2>{0.182675332f, 0.45871532f},
-std::array<float,2>{0.503410995f, 0.183790475f},
-std::array<float,2>{0.41463834f, 0.631305277f},
-std::array<float,2>{0.754175246f, 0.646916509f},
-std::array<float,2>{0.139440119f, 0.168413579f},
-std::array<float,2>{0.54508245f, 0.441266328f},
-std::array<float,2>{0.377738833f, 0.887363195f},
-std::array<float,2>{0.675487697f, 0.797893226f},
-std::array<float,2>{0.295970708f, 0.32518068f},
-std::array<float,2>{0.889113724f, 0.113776989f},
-std::array<float,2>{0.0846918747f, 0.548776209f},
-std::array<float,2>{0.60566932f, 0.594846785f},
-std::array<float,2>{0.445397854f, 0.0477937758f},
-std::array<float,2>{0.853010952f, 0.309736103f},
-std::array<float,2>{0.225454345f, 0.86309731f},
-std::array<float,2>{0.982089579f, 0.971935451f},
-std::array<float,2>{0.0310669038f, 0.391571254f},
-std::array<float,2>{0.696973383f, 0.240751192f},
-std::array<float,2>{0.326257199f, 0.693015993f},
-std::array<float,2>{0.92364496f, 0.52202636f},
-std::array<float,2>{0.108349986f, 0.0763219148f},
-std::array<float,2>{0.651919603f, 0.369397819f},
-std::array<float,2>{0.261506319f, 0.766265929f},
-std::array<float,2>{0.521812022f, 0.920815647f},
-std::array<float,2>{0.437070668f, 0.497613072f},
-std::array<float,2>{0.796216667f, 0.146696523f},
-std::array<float,2>{0.169009f, 0.658006012f},
-std::array<float,2>{0.721125185f, 0.723790348f},
-std::array<float,2>{0.36310187f, 0.188048512f},
-std::array<float,2>{0.945282102f, 0.408426911f},
-std::array<float,2>{0.0383651964f, 0.967062294f},
-std::array<float,2>{0.827721119f, 0.831482947f},
-std::array<float,2>{0.212919861f, 0.254688472f},
-std::array<float,2>{0.582428813f, 0.00207750639f},
-std::array<float,2>{0.469176263f, 0.565160692f},
-std::array<float,2>{0.816890538f, 0.504212737f},
-std::array<float,2>{0.204484761f, 0.0870512277f},
-std::array<float,2>{0.589440405f, 0.355909556f},
-std::array<float,2>{0.482061386f, 0.765084922f},
-std::array<float,2>{0.731773555f, 0.92834276f},
-std::array<float,2>{0.368892491f, 0.473168284f},
-std::array<float,2>{0.948330522f, 0.139329404f},
-std::array<float,2>{0.043666631f, 0.673852146f},
-std::array<float,2>{0.528811216f, 0.740438938f},
-std::array<float,2>{0.42224288f, 0.217545196f},
-std::array<float,2>{0.785143316f, 0.430170983f},
-std::array<float,2>{0.156277895f, 0.944073737f},
-std::array<float,2>{0.935001373f, 0.813871145f},
-std::array<float,2>{0.0986472964f, 0.279131889f},
-std::array<float,2>{0.642996192f, 0.0190310925f},
-std::array<float,2>{0.257179886f, 0.590443909f},
-std::array<float,2>{0.974242151f, 0.626636386f},
-std::array<float,2>{0.0227676891f, 0.18248257f},
-std::array<float,2>{0.690170765f, 0.454006672f},
-std::array<float,2>{0.317400068f, 0.904488981f},
-std::array<float,2>{0.597450018f, 0.791150928f},
-std::array<float,2>{0.44444859f, 0.332865357f},
-std::array<float,2>{0.845739961f, 0.106096141f},
-std::array<float,2>{0.230944127f, 0.544938684f},
-std::array<float,2>{0.687040389f, 0.618723333f},
-std::array<float,2>{0.28705743f, 0.0343003087f},
-std::array<float,2>{0.880061388f, 0.290238261f},
-std::array<float,2>{0.089030385f, 0.856362104f},
-std::array<float,2>{0.761579752f, 0.984778225f},
-std::array<float,2>{0.127472997f, 0.383466065f},
-std::array<float,2>{0.538260162f, 0.228748322f},
-std::array<float,2>{0.39043653f, 0.716913223f},
-std::array<float,2>{0.807887614f, 0.687798381f},
-std::array<float,2>{0.175388783f, 0.235319346f},
-std::array<float,2>{0.515363991f, 0.395637304f},
-std::array<float,2>{0.413347304f, 0.976080954f},
-std::array<float,2>{0.639101923f, 0.863685787f},
-std::array<float,2>{0.275259286f, 0.30676806f},
-std::array<float,2>{0.916151166f, 0.0517987087f},
-std::array<float,2>{0.12130139f, 0.60005796f},
-std::array<float,2>{0.570021033f, 0.551793933f},
-std::array<float,2>{0.487812489f, 0.110776894f},
-std::array<float,2>{0.836936533f, 0.321773291f},
-std::array<float,2>{0.200377315f, 0.803133428f},
-std::array<float,2>{0.96818912f, 0.885076702f},
-std::array<float,2>{0.0567855909f, 0.441659451f},
-std::array<float,2>{0.744951069f, 0.167157486f},
-std::array<float,2>{0.355996013f, 0.641330481f},
-std::array<float,2>{0.903730571f, 0.566838801f},
-std::array<float,2>{0.076534152f, 0.00771137187f},
-std::array<float,2>{0.658905864f, 0.250390857f},
-std::array<float,2>{0.298672318f, 0.834291041f},
-std::array<float,2>{0.557781458f, 0.964274108f},
-std::array<float,2>{0.390672773f, 0.412671268f},
-std::array<float,2>{0.765751898f, 0.194927588f},
-std::array<float,2>{0.150268078f, 0.719055653f},
-std::array<float,2>{0.716373146f, 0.663674653f},
-std::array<float,2>{0.331415504f, 0.143743098f},
-std::array<float,2>{0.990068555f, 0.493328094f},
-std::array<float,2>{0.00213171658f, 0.914595187f},
-std::array<float,2>{0.863936484f, 0.7695508f},
-std::array<float,2>{0.236687884f, 0.371899426f},
-std::array<float,2>{0.610825479f, 0.0722566694f},
-std::array<float,2>{0.458020717f, 0.518274844f},
-std::array<float,2>{0.777812243f, 0.606012344f},
-std::array<float,2>{0.145827606f, 0.0571348071f},
-std::array<float,2>{0.549732924f, 0.297693342f},
-std::array<float,2>{0.400284559f, 0.870446444f},
-std::array<float,2>{0.665867925f, 0.980069697f},
-std::array<float,2>{0.306332737f, 0.404302567f},
-std::array<float,2>{0.89459908f, 0.248153657f},
-std::array<float,2>{0.0650716424f, 0.698402405f},
-std::array<float,2>{0.619230866f, 0.653363228f},
-std::array<float,2>{0.462703228f, 0.161138013f},
-std::array<float,2>{0.870231926f, 0.449930727f},
-std::array<float,2>{0.245078892f, 0.878510535f},
-std::array<float,2>{0.999435782f, 0.809967935f},
-std::array<float,2>{0.012688648f, 0.31966266f},
-std::array<float,2>{0.709713578f, 0.121806256f},
-std::array<float,2>{0.338496506f, 0.55821079f},
-std::array<float,2>{0.908479273f, 0.732544959f},
-std::array<float,2>{0.111596294f, 0.199673936f},
-std::array<float,2>{0.632205963f, 0.419645548f},
-std::array<float,2>{0.26786235f, 0.955724418f},
-std::array<float,2>{0.504457951f, 0.836619198f},
-std::array<float,2>{0.420954078f, 0.263343602f},
-std::array<float,2>{0.803592503f, 0.0152333695f},
-std::array<float,2>{0.186622247f, 0.577413142f},
-std::array<float,2>{0.735311449f, 0.526733518f},
-std::array<float,2>{0.350278705f, 0.0671284571f},
-std::array<float,2>{0.960490942f, 0.360005677f},
-std::array<float,2>{0.0522062965f, 0.780527532f},
-std::array<float,2>{0.831387281f, 0.910325527f},
-std::array<float,2>{0.192565739f, 0.491455942f},
-std::array<float,2>{0.573036134f, 0.148926377f},
-std::array<float,2>{0.496760696f, 0.665449917f},
-std::array<float,2>{0.856407762f, 0.685841739f},
-std::array<float,2>{0.219511151f, 0.125221297f},
-std::array<float,2>{0.60534662f, 0.480244607f},
-std::array<float,2>{0.452583909f, 0.930764019f},
-std::array<float,2>{0.701202095f, 0.751508951f},
-std::array<float,2>{0.323464841f, 0.345715016f},
-std::array<float,2>{0.980463684f, 0.0826028585f},
-std::array<float,2>{0.0248861946f, 0.512379229f},
-std::array<float,2>{0.539243698f, 0.578588545f},
-std::array<float,2>{0.382219106f, 0.0242319386f},
-std::array<float,2>{0.751571417f, 0.271503538f},
-std::array<float,2>{0.133758947f, 0.82654053f},
-std::array<float,2>{0.886222005f, 0.949924946f},
-std::array<float,2>{0.0794462636f, 0.424111634f},
-std::array<float,2>{0.67706567f, 0.207674861f},
-std::array<float,2>{0.289612889f, 0.748816192f},
-std::array<float,2>{0.941397727f, 0.538170278f},
-std::array<float,2>{0.0334548689f, 0.0944275931f},
-std::array<float,2>{0.724336028f, 0.341247737f},
-std::array<float,2>{0.364469618f, 0.787517428f},
-std::array<float,2>{0.578222752f, 0.896020472f},
-std::array<float,2>{0.474454373f, 0.465469331f},
-std::array<float,2>{0.82341218f, 0.177033857f},
-std::array<float,2>{0.216315672f, 0.638416767f},
-std::array<float,2>{0.656023443f, 0.705934465f},
-std::array<float,2>{0.265339851f, 0.224411145f},
-std::array<float,2>{0.926417768f, 0.379997343f},
-std::array<float,2>{0.105241887f, 0.993790627f},
-std::array<float,2>{0.789973319f, 0.846277475f},
-std::array<float,2>{0.16511859f, 0.285924077f},
-std::array<float,2>{0.51650244f, 0.0452098846f},
-std::array<float,2>{0.433299214f, 0.61190331f},
-std::array<float,2>{0.756974459f, 0.548014879f},
-std::array<float,2>{0.137134448f, 0.11359372f},
-std::array<float,2>{0.544857085f, 0.324441284f},
-std::array<float,2>{0.37638554f, 0.798485577f},
-std::array<float,2>{0.672279477f, 0.887115538f},
-std::array<float,2>{0.293656915f, 0.440461695f},
-std::array<float,2>{0.887364268f, 0.168853879f},
-std::array<float,2>{0.0836724043f, 0.647401929f},
-std::array<float,2>{0.607594252f, 0.692658246f},
-std::array<float,2>{0.448478252f, 0.24057138f},
-std::array<float,2>{0.854581237f, 0.390739501f},
-std::array<float,2>{0.224453971f, 0.972504795f},
-std::array<float,2>{0.98408246f, 0.862586021f},
-std::array<float,2>{0.0273711383f, 0.310531616f},
-std::array<float,2>{0.69799763f, 0.0471919738f},
-std::array<float,2>{0.324219078f, 0.595574558f},
-std::array<float,2>{0.924754977f, 0.657477558f},
-std::array<float,2>{0.105913065f, 0.147420019f},
-std::array<float,2>{0.648771524f, 0.497134954f},
-std::array<float,2>{0.258264869f, 0.920107961f},
-std::array<float,2>{0.5202474f, 0.765990973f},
-std::array<float,2>{0.434445679f, 0.369652033f},
-std::array<float,2>{0.79484278f, 0.0768224448f},
-std::array<float,2>{0.170347467f, 0.521736205f},
-std::array<float,2>{0.719798386f, 0.564735234f},
-std::array<float,2>{0.359459281f, 0.00248632068f},
-std::array<float,2>{0.942214787f, 0.253953278f},
-std::array<float,2>{0.0352531597f, 0.831709743f},
-std::array<float,2>{0.825963497f, 0.967599392f},
-std::array<float,2>{0.210953474f, 0.40906775f},
-std::array<float,2>{0.585092008f, 0.187515676f},
-std::array<float,2>{0.471610963f, 0.724582791f},
-std::array<float,2>{0.872979343f, 0.736528993f},
-std::array<float,2>{0.247523665f, 0.21357879f},
-std::array<float,2>{0.624717593f, 0.435283303f},
-std::array<float,2>{0.465426385f, 0.937809289f},
-std::array<float,2>{0.703538954f, 0.819135487f},
-std::array<float,2>{0.342243493f, 0.273820102f},
-std::array<float,2>{0.99559468f, 0.0224978533f},
-std::array<float,2>{0.00978595577f, 0.587538421f},
-std::array<float,2>{0.551143885f, 0.500842333f},
-std::array<float,2>{0.40455696f, 0.0912127718f},
-std::array<float,2>{0.774045944f, 0.354777992f},
-std::array<float,2>{0.143230319f, 0.759209991f},
-std::array<float,2>{0.894265652f, 0.922136128f},
-std::array<float,2>{0.0669458658f, 0.471654266f},
-std::array<float,2>{0.669568002f, 0.135159075f},
-std::array<float,2>{0.312176168f, 0.675929964f},
-std::array<float,2>{0.95333606f, 0.62428546f},
-std::array<float,2>{0.0473186225f, 0.0362868458f},
-std::array<float,2>{0.741158009f, 0.295864999f},
-std::array<float,2>{0.346229732f, 0.85237819f},
-std::array<float,2>{0.576662898f, 0.99113673f},
-std::array<float,2>{0.492271334f, 0.389431089f},
-std::array<float,2>{0.833940923f, 0.234210804f},
-std::array<float,2>{0.189735293f, 0.713925481f},
-std::array<float,2>{0.627913535f, 0.631465733f},
-std::array<float,2>{0.273067385f, 0.184372455f},
-std::array<float,2>{0.910273612f, 0.458106726f},
-std::array<float,2>{0.11648608f, 0.898907721f},
-std::array<float,2>{0.799785018f, 0.793265581f},
-std::array<float,2>{0.181142569f, 0.331181079f},
-std::array<float,2>{0.500672936f, 0.101678386f},
-std::array<float,2>{0.417937517f, 0.540219486f},
-std::array<float,2>{0.842358828f, 0.58575803f},
-std::array<float,2>{0.197739407f, 0.0299890731f},
-std::array<float,2>{0.562761962f, 0.268728703f},
-std::array<float,2>{0.489015013f, 0.823891699f},
-std::array<float,2>{0.748996496f, 0.947832108f},
-std::array<float,2>{0.353252023f, 0.428635001f},
-std::array<float,2>{0.963697672f, 0.206841007f},
-std::array<float,2>{0.0594976582f, 0.745099843f},
-std::array<float,2>{0.511465669f, 0.682482123f},
-std::array<float,2>{0.408233106f, 0.132653549f},
-std::array<float,2>{0.810937583f, 0.481674165f},
-std::array<float,2>{0.177714661f, 0.93532896f},
-std::array<float,2>{0.918240726f, 0.756388485f},
-std::array<float,2>{0.119074494f, 0.349590898f},
-std::array<float,2>{0.633122683f, 0.0799145028f},
-std::array<float,2>{0.280967534f, 0.511547685f},
-std::array<float,2>{0.985943258f, 0.709185541f},
-std::array<float,2>{0.00652826019f, 0.221134454f},
-std::array<float,2>{0.714315891f, 0.37677744f},
-std::array<float,2>{0.335560232f, 0.999333739f},
-std::array<float,2>{0.613378704f, 0.84853977f},
-std::array<float,2>{0.453929305f, 0.282764226f},
-std::array<float,2>{0.860786319f, 0.0393247828f},
-std::array<float,2>{0.240404591f, 0.615787685f},
-std::array<float,2>{0.66337043f, 0.532718956f},
-std::array<float,2>{0.30348888f, 0.0981905013f},
-std::array<float,2>{0.899275541f, 0.336834699f},
-std::array<float,2>{0.0720421523f, 0.781912923f},
-std::array<float,2>{0.773434281f, 0.893905818f},
-std::array<float,2>{0.153221473f, 0.464120865f},
-std::array<float,2>{0.559442997f, 0.174898058f},
-std::array<float,2>{0.395023763f, 0.635912538f},
-std::array<float,2>{0.788394094f, 0.650335968f},
-std::array<float,2>{0.160225511f, 0.159425125f},
-std::array<float,2>{0.524766743f, 0.446620733f},
-std::array<float,2>{0.429419249f, 0.882399619f},
-std::array<float,2>{0.645596385f, 0.807548642f},
-std::array<float,2>{0.253201425f, 0.315430135f},
-std::array<float,2>{0.931075692f, 0.119047388f},
-std::array<float,2>{0.09726955f, 0.559208393f},
-std::array<float,2>{0.591015339f, 0.60189575f},
-std::array<float,2>{0.47758314f, 0.0610293783f},
-std::array<float,2>{0.812710941f, 0.300898731f},
-std::array<float,2>{0.209182799f, 0.871934474f},
-std::array<float,2>{0.952227473f, 0.982454836f},
-std::array<float,2>{0.0416395068f, 0.399113715f},
-std::array<float,2>{0.727868855f, 0.243751228f},
-std::array<float,2>{0.372915953f, 0.701033652f},
-std::array<float,2>{0.877606392f, 0.528714418f},
-std::array<float,2>{0.0899720117f, 0.0656636283f},
-std::array<float,2>{0.680325687f, 0.367031664f},
-std::array<float,2>{0.284769118f, 0.777123272f},
-std::array<float,2>{0.533620417f, 0.909804344f},
-std::array<float,2>{0.383954972f, 0.488126189f},
-std::array<float,2>{0.763497889f, 0.152546614f},
-std::array<float,2>{0.132408217f, 0.671646655f},
-std::array<float,2>{0.694904327f, 0.730070233f},
-std::array<float,2>{0.314748764f, 0.197696537f},
-std::array<float,2>{0.969323039f, 0.417273015f},
-std::array<float,2>{0.0161458291f, 0.96036613f},
-std::array<float,2>{0.850274324f, 0.840518534f},
-std::array<float,2>{0.228372499f, 0.259851605f},
-std::array<float,2>{0.600916982f, 0.00922905654f},
-std::array<float,2>{0.438353568f, 0.57039088f},
-std::array<float,2>{0.858344078f, 0.51178056f},
-std::array<float,2>{0.220966399f, 0.0823189616f},
-std::array<float,2>{0.602022827f, 0.346648991f},
-std::array<float,2>{0.449880302f, 0.751309991f},
-std::array<float,2>{0.699294806f, 0.931224644f},
-std::array<float,2>{0.321099788f, 0.479502618f},
-std::array<float,2>{0.977096021f, 0.125615373f},
-std::array<float,2>{0.0262429994f, 0.686307967f},
-std::array<float,2>{0.541646063f, 0.748275161f},
-std::array<float,2>{0.379872531f, 0.207155228f},
-std::array<float,2>{0.752158463f, 0.424527019f},
-std::array<float,2>{0.136218622f, 0.949446261f},
-std::array<float,2>{0.883042037f, 0.826804042f},
-std::array<float,2>{0.0809554458f, 0.272386074f},
-std::array<float,2>{0.67783618f, 0.0235142987f},
-std::array<float,2>{0.291347295f, 0.579005539f},
-std::array<float,2>{0.938926995f, 0.638066053f},
-std::array<float,2>{0.0325797126f, 0.177684516f},
-std::array<float,2>{0.72539854f, 0.46529004f},
-std::array<float,2>{0.365906358f, 0.89555347f},
-std::array<float,2>{0.581376731f, 0.787802219f},
-std::array<float,2>{0.474678695f, 0.34138146f},
-std::array<float,2>{0.822198331f, 0.0937893093f},
-std::array<float,2>{0.217432395f, 0.538864493f},
-std::array<float,2>{0.654133022f, 0.611697316f},
-std::array<float,2>{0.261728585f, 0.0454535149f},
-std::array<float,2>{0.928056121f, 0.285176128f},
-std::array<float,2>{0.102535866f, 0.845722675f},
-std::array<float,2>{0.792009473f, 0.993585289f},
-std::array<float,2>{0.167711914f, 0.380655825f},
-std::array<float,2>{0.518205345f, 0.224081919f},
-std::array<float,2>{0.429976374f, 0.705237329f},
-std::array<float,2>{0.780116498f, 0.698735714f},
-std::array<float,2>{0.146882862f, 0.248835802f},
-std::array<float,2>{0.548799634f, 0.405256391f},
-std::array<float,2>{0.401181191f, 0.979605675f},
-std::array<float,2>{0.666930854f, 0.870719552f},
-std::array<float,2>{0.30737704f, 0.2970981f},
-std::array<float,2>{0.897250831f, 0.0571051426f},
-std::array<float,2>{0.0643656701f, 0.605615973f},
-std::array<float,2>{0.617511213f, 0.557700217f},
-std::array<float,2>{0.463211209f, 0.121399552f},
-std::array<float,2>{0.868505776f, 0.320259601f},
-std::array<float,2>{0.242843792f, 0.810270846f},
-std::array<float,2>{0.997052133f, 0.878156662f},
-std::array<float,2>{0.0146624502f, 0.449660569f},
-std::array<float,2>{0.70800972f, 0.162100062f},
-std::array<float,2>{0.336879551f, 0.65427953f},
-std::array<float,2>{0.906378508f, 0.57781285f},
-std::array<float,2>{0.109898649f, 0.0150119467f},
-std::array<float,2>{0.630298316f, 0.263061285f},
-std::array<float,2>{0.267392576f, 0.836203039f},
-std::array<float,2>{0.506070971f, 0.955545545f},
-std::array<float,2>{0.419150263f, 0.41913271f},
-std::array<float,2>{0.801196873f, 0.199762568f},
-std::array<float,2>{0.184116423f, 0.733028769f},
-std::array<float,2>{0.738086224f, 0.665912628f},
-std::array<float,2>{0.348547488f, 0.148525238f},
-std::array<float,2>{0.957357705f, 0.491928011f},
-std::array<float,2>{0.0529975295f, 0.910979331f},
-std::array<float,2>{0.8291592f, 0.780858517f},
-std::array<float,2>{0.195152849f, 0.359390885f},
-std::array<float,2>{0.57189095f, 0.0668936446f},
-std::array<float,2>{0.498750418f, 0.526857555f},
-std::array<float,2>{0.805687904f, 0.600110948f},
-std::array<float,2>{0.173565656f, 0.0523443185f},
-std::array<float,2>{0.513666093f, 0.307559669f},
-std::array<float,2>{0.410874963f, 0.864135027f},
-std::array<float,2>{0.638385296f, 0.975824356f},
-std::array<float,2>{0.275622666f, 0.396451414f},
-std::array<float,2>{0.915299118f, 0.234751746f},
-std::array<float,2>{0.123179153f, 0.68832171f},
-std::array<float,2>{0.566861749f, 0.640989721f},
-std::array<float,2>{0.484393984f, 0.167571798f},
-std::array<float,2>{0.838439047f, 0.442117602f},
-std::array<float,2>{0.201366082f, 0.885452032f},
-std::array<float,2>{0.96610409f, 0.803570569f},
-std::array<float,2>{0.0547652096f, 0.32195738f},
-std::array<float,2>{0.743263543f, 0.111244611f},
-std::array<float,2>{0.358139068f, 0.552306235f},
-std::array<float,2>{0.904737592f, 0.719635725f},
-std::array<float,2>{0.0755855888f, 0.194618121f},
-std::array<float,2>{0.65685308f, 0.412386805f},
-std::array<float,2>{0.298839748f, 0.96481353f},
-std::array<float,2>{0.556104422f, 0.834583104f},
-std::array<float,2>{0.392980367f, 0.250501215f},
-std::array<float,2>{0.769212246f, 0.00704804249f},
-std::array<float,2>{0.151242241f, 0.567160904f},
-std::array<float,2>{0.718051076f, 0.517792344f},
-std::array<float,2>{0.329013646f, 0.0713267699f},
-std::array<float,2>{0.992163777f, 0.37117359f},
-std::array<float,2>{0.000973514805f, 0.77041012f},
-std::array<float,2>{0.866648912f, 0.914412796f},
-std::array<float,2>{0.235653624f, 0.493849456f},
-std::array<float,2>{0.612389684f, 0.144236684f},
-std::array<float,2>{0.460567474f, 0.66356498f},
-std::array<float,2>{0.820104718f, 0.674328685f},
-std::array<float,2>{0.206377491f, 0.139110163f},
-std::array<float,2>{0.587140083f, 0.472742409f},
-std::array<float,2>{0.483268261f, 0.927758813f},
-std::array<float,2>{0.732595026f, 0.765529931f},
-std::array<float,2>{0.371075243f, 0.356204987f},
-std::array<float,2>{0.946287334f, 0.0874414369f},
-std::array<float,2>{0.0462324917f, 0.504685521f},
-std::array<float,2>{0.530072987f, 0.590084434f},
-std::array<float,2>{0.425463855f, 0.0191246606f},
-std::array<float,2>{0.781965554f, 0.278574049f},
-std::array<float,2>{0.159141943f, 0.814335287f},
-std::array<float,2>{0.935953856f, 0.943746448f},
-std::array<float,2>{0.10074167f, 0.430348456f},
-std::array<float,2>{0.640821874f, 0.21701625f},
-std::array<float,2>{0.255468041f, 0.740762591f},
-std::array<float,2>{0.97569418f, 0.545510292f},
-std::array<float,2>{0.0207277033f, 0.10593091f},
-std::array<float,2>{0.687652111f, 0.332314491f},
-std::array<float,2>{0.318946272f, 0.791695595f},
-std::array<float,2>{0.594234884f, 0.904974341f},
-std::array<float,2>{0.441574365f, 0.453543097f},
-std::array<float,2>{0.843791425f, 0.182125643f},
-std::array<float,2>{0.234032869f, 0.626151562f},
-std::array<float,2>{0.684354484f, 0.717322707f},
-std::array<float,2>{0.288730532f, 0.229213476f},
-std::array<float,2>{0.881919086f, 0.382918566f},
-std::array<float,2>{0.0878718868f, 0.984957576f},
-std::array<float,2>{0.758731067f, 0.855542243f},
-std::array<float,2>{0.126818314f, 0.290768862f},
-std::array<float,2>{0.535555661f, 0.0349060707f},
-std::array<float,2>{0.387544006f, 0.618293464f},
-std::array<float,2>{0.796858788f, 0.521452129f},
-std::array<float,2>{0.169558495f, 0.0757297054f},
-std::array<float,2>{0.522072673f, 0.367255658f},
-std::array<float,2>{0.436958432f, 0.768737495f},
-std::array<float,2>{0.651409149f, 0.918830931f},
-std::array<float,2>{0.261211127f, 0.49821499f},
-std::array<float,2>{0.923192084f, 0.14641729f},
-std::array<float,2>{0.107475638f, 0.658813417f},
-std::array<float,2>{0.582889557f, 0.724844038f},
-std::array<float,2>{0.469624937f, 0.190057114f},
-std::array<float,2>{0.827279866f, 0.406701207f},
-std::array<float,2>{0.213481352f, 0.965698838f},
-std::array<float,2>{0.94455725f, 0.829749644f},
-std::array<float,2>{0.0389551595f, 0.257059336f},
-std::array<float,2>{0.721510053f, 0.000345296197f},
-std::array<float,2>{0.362717688f, 0.564049184f},
-std::array<float,2>{0.889576972f, 0.645388544f},
-std::array<float,2>{0.0843828768f, 0.171128914f},
-std::array<float,2>{0.674925208f, 0.438885957f},
-std::array<float,2>{0.296727419f, 0.889007092f},
-std::array<float,2>{0.545636356f, 0.799879849f},
-std::array<float,2>{0.377144396f, 0.326632172f},
-std::array<float,2>{0.75463599f, 0.115352027f},
-std::array<float,2>{0.138853207f, 0.549248815f},
-std::array<float,2>{0.696342468f, 0.596507132f},
-std::array<float,2>{0.32704103f, 0.0507724583f},
-std::array<float,2>{0.981823027f, 0.311308831f},
-std::array<float,2>{0.0305563007f, 0.86121887f},
-std::array<float,2>{0.853329837f, 0.96920234f},
-std::array<float,2>{0.225005716f, 0.394211739f},
-std::array<float,2>{0.606006086f, 0.238661185f},
-std::array<float,2>{0.446067333f, 0.694445491f},
-std::array<float,2>{0.835351229f, 0.712814331f},
-std::array<float,2>{0.188565239f, 0.230967417f},
-std::array<float,2>{0.574771821f, 0.386896253f},
-std::array<float,2>{0.49530223f, 0.988911033f},
-std::array<float,2>{0.740074337f, 0.855313718f},
-std::array<float,2>{0.343919128f, 0.293524325f},
-std::array<float,2>{0.955735981f, 0.0387430228f},
-std::array<float,2>{0.0496597029f, 0.622091591f},
-std::array<float,2>{0.50380075f, 0.542093456f},
-std::array<float,2>{0.4145118f, 0.105407104f},
-std::array<float,2>{0.798425555f, 0.328380585f},
-std::array<float,2>{0.183201522f, 0.795508564f},
-std::array<float,2>{0.913838983f, 0.900510967f},
-std::array<float,2>{0.114150427f, 0.459718555f},
-std::array<float,2>{0.625655353f, 0.186967298f},
-std::array<float,2>{0.270143807f, 0.63016206f},
-std::array<float,2>{0.993606269f, 0.587998271f},
-std::array<float,2>{0.00888609886f, 0.0198610388f},
-std::array<float,2>{0.705941439f, 0.275981009f},
-std::array<float,2>{0.339984775f, 0.818283677f},
-std::array<float,2>{0.622320414f, 0.940863907f},
-std::array<float,2>{0.466826618f, 0.437243313f},
-std::array<float,2>{0.874009132f, 0.212388247f},
-std::array<float,2>{0.249630719f, 0.735839546f},
-std::array<float,2>{0.670797825f, 0.678971231f},
-std::array<float,2>{0.309194118f, 0.134598687f},
-std::array<float,2>{0.891021252f, 0.469406843f},
-std::array<float,2>{0.0695201308f, 0.924313724f},
-std::array<float,2>{0.776887596f, 0.759861231f},
-std::array<float,2>{0.141059533f, 0.353382409f},
-std::array<float,2>{0.553195179f, 0.0933000073f},
-std::array<float,2>{0.403032839f, 0.503418148f},
-std::array<float,2>{0.861500978f, 0.615117252f},
-std::array<float,2>{0.239179656f, 0.0416222326f},
-std::array<float,2>{0.616994083f, 0.28445521f},
-std::array<float,2>{0.456758022f, 0.850759625f},
-std::array<float,2>{0.711505055f, 0.997667313f},
-std::array<float,2>{0.332603186f, 0.377399355f},
-std::array<float,2>{0.987650573f, 0.220302299f},
-std::array<float,2>{0.00519520789f, 0.708806574f},
-std::array<float,2>{0.561451018f, 0.63441205f},
-std::array<float,2>{0.398052424f, 0.173583046f},
-std::array<float,2>{0.770626009f, 0.461902857f},
-std::array<float,2>{0.156191155f, 0.89248234f},
-std::array<float,2>{0.901421368f, 0.783932626f},
-std::array<float,2>{0.0736310482f, 0.339525312f},
-std::array<float,2>{0.661822915f, 0.100604147f},
-std::array<float,2>{0.301382661f, 0.534018874f},
-std::array<float,2>{0.961771011f, 0.743106544f},
-std::array<float,2>{0.0613932051f, 0.204756603f},
-std::array<float,2>{0.74627769f, 0.427027464f},
-std::array<float,2>{0.354762584f, 0.945476592f},
-std::array<float,2>{0.565397739f, 0.82176882f},
-std::array<float,2>{0.490661532f, 0.266459227f},
-std::array<float,2>{0.841407418f, 0.0283165369f},
-std::array<float,2>{0.197103441f, 0.582069099f},
-std::array<float,2>{0.635831296f, 0.508858979f},
-std::array<float,2>{0.278603613f, 0.0815932676f},
-std::array<float,2>{0.920537174f, 0.351555437f},
-std::array<float,2>{0.120306246f, 0.754642427f},
-std::array<float,2>{0.80912292f, 0.936024249f},
-std::array<float,2>{0.178131834f, 0.483430296f},
-std::array<float,2>{0.508825123f, 0.130679682f},
-std::array<float,2>{0.407502741f, 0.681216776f},
-std::array<float,2>{0.765067697f, 0.669669688f},
-std::array<float,2>{0.12973012f, 0.155073568f},
-std::array<float,2>{0.532447398f, 0.484781444f},
-std::array<float,2>{0.385752767f, 0.90651691f},
-std::array<float,2>{0.682610631f, 0.774801254f},
-std::array<float,2>{0.282303005f, 0.363826662f},
-std::array<float,2>{0.875863254f, 0.0632622838f},
-std::array<float,2>{0.0932522565f, 0.530151486f},
-std::array<float,2>{0.5992679f, 0.57253617f},
-std::array<float,2>{0.440743119f, 0.0108253993f},
-std::array<float,2>{0.847722232f, 0.258842021f},
-std::array<float,2>{0.229636922f, 0.843419671f},
-std::array<float,2>{0.972420335f, 0.957311988f},
-std::array<float,2>{0.0178459715f, 0.414125621f},
-std::array<float,2>{0.693140388f, 0.196872622f},
-std::array<float,2>{0.312593907f, 0.727101803f},
-std::array<float,2>{0.933010101f, 0.561465204f},
-std::array<float,2>{0.0953638628f, 0.119648606f},
-std::array<float,2>{0.647500455f, 0.313585788f},
-std::array<float,2>{0.251531214f, 0.805452406f},
-std::array<float,2>{0.527316451f, 0.880755603f},
-std::array<float,2>{0.426285774f, 0.448991328f},
-std::array<float,2>{0.786817253f, 0.157876745f},
-std::array<float,2>{0.162980258f, 0.651280284f},
-std::array<float,2>{0.728842854f, 0.702091753f},
-std::array<float,2>{0.374280959f, 0.244286016f},
-std::array<float,2>{0.951074004f, 0.401121765f},
-std::array<float,2>{0.0400567614f, 0.981566787f},
-std::array<float,2>{0.815188169f, 0.87468493f},
-std::array<float,2>{0.207891554f, 0.304686189f},
-std::array<float,2>{0.593610764f, 0.0588804819f},
-std::array<float,2>{0.480032176f, 0.604626596f},
-std::array<float,2>{0.823911011f, 0.536679447f},
-std::array<float,2>{0.21601069f, 0.0967208222f},
-std::array<float,2>{0.578698456f, 0.342756152f},
-std::array<float,2>{0.473851979f, 0.785424232f},
-std::array<float,2>{0.723857164f, 0.898019671f},
-std::array<float,2>{0.365125358f, 0.466829658f},
-std::array<float,2>{0.940446556f, 0.179643467f},
-std::array<float,2>{0.0340847448f, 0.638969183f},
-std::array<float,2>{0.515822649f, 0.704064369f},
-std::array<float,2>{0.432852119f, 0.225760281f},
-std::array<float,2>{0.789325237f, 0.381690502f},
-std::array<float,2>{0.165977061f, 0.995969772f},
-std::array<float,2>{0.926065624f, 0.84402591f},
-std::array<float,2>{0.104523353f, 0.288517267f},
-std::array<float,2>{0.655614197f, 0.0430926494f},
-std::array<float,2>{0.264974982f, 0.60990864f},
-std::array<float,2>{0.979813695f, 0.683763921f},
-std::array<float,2>{0.0251670089f, 0.128489658f},
-std::array<float,2>{0.701893628f, 0.477895051f},
-std::array<float,2>{0.32415843f, 0.933186591f},
-std::array<float,2>{0.604905903f, 0.752642751f},
-std::array<float,2>{0.452770352f, 0.345146745f},
-std::array<float,2>{0.855867982f, 0.0841413513f},
-std::array<float,2>{0.218922064f, 0.514827549f},
-std::array<float,2>{0.677439392f, 0.581519663f},
-std::array<float,2>{0.289208978f, 0.0254603755f},
-std::array<float,2>{0.886715412f, 0.270007163f},
-std::array<float,2>{0.0799794644f, 0.824293554f},
-std::array<float,2>{0.751205802f, 0.952023566f},
-std::array<float,2>{0.133046329f, 0.422462076f},
-std::array<float,2>{0.539773226f, 0.210221425f},
-std::array<float,2>{0.382596135f, 0.748033762f},
-std::array<float,2>{0.803211808f, 0.732164979f},
-std::array<float,2>{0.187345386f, 0.201506048f},
-std::array<float,2>{0.504224539f, 0.421574801f},
-std::array<float,2>{0.421542764f, 0.954720557f},
-std::array<float,2>{0.632734418f, 0.838166296f},
-std::array<float,2>{0.268445671f, 0.265594095f},
-std::array<float,2>{0.909068525f, 0.0134454295f},
-std::array<float,2>{0.11218822f, 0.575339615f},
-std::array<float,2>{0.572489858f, 0.524339795f},
-std::array<float,2>{0.496453494f, 0.0699293166f},
-std::array<float,2>{0.83161521f, 0.362220883f},
-std::array<float,2>{0.193337873f, 0.777597845f},
-std::array<float,2>{0.960244775f, 0.912630796f},
-std::array<float,2>{0.0523770265f, 0.488612443f},
-std::array<float,2>{0.734797716f, 0.151703939f},
-std::array<float,2>{0.349746823f, 0.667568147f},
-std::array<float,2>{0.89503777f, 0.607533574f},
-std::array<float,2>{0.064511247f, 0.0551595017f},
-std::array<float,2>{0.665456653f, 0.300683916f},
-std::array<float,2>{0.306080282f, 0.868389428f},
-std::array<float,2>{0.549041152f, 0.977395177f},
-std::array<float,2>{0.399883568f, 0.403136402f},
-std::array<float,2>{0.778208375f, 0.246555507f},
-std::array<float,2>{0.146046773f, 0.696971416f},
-std::array<float,2>{0.709169209f, 0.656024218f},
-std::array<float,2>{0.338061184f, 0.163177714f},
-std::array<float,2>{0.999736845f, 0.451650947f},
-std::array<float,2>{0.011869913f, 0.876094282f},
-std::array<float,2>{0.871011734f, 0.810722768f},
-std::array<float,2>{0.244465962f, 0.317450166f},
-std::array<float,2>{0.619997919f, 0.124516539f},
-std::array<float,2>{0.462266862f, 0.556393683f},
-std::array<float,2>{0.766224861f, 0.568905711f},
-std::array<float,2>{0.149830773f, 0.00497106276f},
-std::array<float,2>{0.558490992f, 0.25327757f},
-std::array<float,2>{0.391326845f, 0.833582282f},
-std::array<float,2>{0.658516347f, 0.961410522f},
-std::array<float,2>{0.298286408f, 0.411833912f},
-std::array<float,2>{0.904044092f, 0.19312638f},
-std::array<float,2>{0.077116482f, 0.721441746f},
-std::array<float,2>{0.611326098f, 0.661177576f},
-std::array<float,2>{0.458663553f, 0.142228067f},
-std::array<float,2>{0.863582253f, 0.495562226f},
-std::array<float,2>{0.23718448f, 0.917132795f},
-std::array<float,2>{0.989545703f, 0.771640539f},
-std::array<float,2>{0.00288428948f, 0.374777645f},
-std::array<float,2>{0.715973854f, 0.0736083016f},
-std::array<float,2>{0.331995666f, 0.515681922f},
-std::array<float,2>{0.916795731f, 0.689557195f},
-std::array<float,2>{0.122048154f, 0.237742782f},
-std::array<float,2>{0.6391868f, 0.397672266f},
-std::array<float,2>{0.274431407f, 0.973558962f},
-std::array<float,2>{0.514821231f, 0.866223335f},
-std::array<float,2>{0.413805187f, 0.305126756f},
-std::array<float,2>{0.808344841f, 0.0539751314f},
-std::array<float,2>{0.17490679f, 0.597956896f},
-std::array<float,2>{0.74439472f, 0.553819954f},
-std::array<float,2>{0.355568618f, 0.113154374f},
-std::array<float,2>{0.968350291f, 0.322278053f},
-std::array<float,2>{0.0571648367f, 0.801413476f},
-std::array<float,2>{0.837539136f, 0.883260548f},
-std::array<float,2>{0.201022476f, 0.444492489f},
-std::array<float,2>{0.569653809f, 0.164261132f},
-std::array<float,2>{0.487484485f, 0.644139647f},
-std::array<float,2>{0.846326113f, 0.627159357f},
-std::array<float,2>{0.231252834f, 0.180823222f},
-std::array<float,2>{0.597014666f, 0.4551512f},
-std::array<float,2>{0.445061326f, 0.903196871f},
-std::array<float,2>{0.689702511f, 0.789399087f},
-std::array<float,2>{0.318224072f, 0.33423391f},
-std::array<float,2>{0.973761559f, 0.108789928f},
-std::array<float,2>{0.0234019998f, 0.544150531f},
-std::array<float,2>{0.538743854f, 0.620307744f},
-std::array<float,2>{0.389904499f, 0.0324994475f},
-std::array<float,2>{0.761006713f, 0.291695505f},
-std::array<float,2>{0.127049789f, 0.858503163f},
-std::array<float,2>{0.880396664f, 0.987849355f},
-std::array<float,2>{0.0896812901f, 0.385927469f},
-std::array<float,2>{0.686723351f, 0.226789728f},
-std::array<float,2>{0.286371797f, 0.714914858f},
-std::array<float,2>{0.948878467f, 0.506255627f},
-std::array<float,2>{0.0432257093f, 0.0897775367f},
-std::array<float,2>{0.732147396f, 0.357533842f},
-std::array<float,2>{0.36818248f, 0.7634601f},
-std::array<float,2>{0.589052022f, 0.926843524f},
-std::array<float,2>{0.481782049f, 0.474700809f},
-std::array<float,2>{0.817097485f, 0.137456745f},
-std::array<float,2>{0.205069691f, 0.67228806f},
-std::array<float,2>{0.643449664f, 0.739415586f},
-std::array<float,2>{0.2574265f, 0.21495147f},
-std::array<float,2>{0.935418129f, 0.431976408f},
-std::array<float,2>{0.099186331f, 0.941467702f},
-std::array<float,2>{0.784589052f, 0.815249085f},
-std::array<float,2>{0.156786114f, 0.280026108f},
-std::array<float,2>{0.528571129f, 0.0164582189f},
-std::array<float,2>{0.422474086f, 0.592812121f},
-std::array<float,2>{0.775298774f, 0.50213027f},
-std::array<float,2>{0.144012183f, 0.0927615985f},
-std::array<float,2>{0.552516639f, 0.35204798f},
-std::array<float,2>{0.405647486f, 0.761219561f},
-std::array<float,2>{0.668909311f, 0.924880266f},
-std::array<float,2>{0.311240643f, 0.470528275f},
-std::array<float,2>{0.892606974f, 0.133464262f},
-std::array<float,2>{0.0678825825f, 0.678490877f},
-std::array<float,2>{0.62363714f, 0.735280633f},
-std::array<float,2>{0.466520309f, 0.21108675f},
-std::array<float,2>{0.872054994f, 0.436481714f},
-std::array<float,2>{0.246390343f, 0.940412283f},
-std::array<float,2>{0.99503535f, 0.817093194f},
-std::array<float,2>{0.011230737f, 0.277102739f},
-std::array<float,2>{0.704344332f, 0.0209336784f},
-std::array<float,2>{0.343711019f, 0.58891046f},
-std::array<float,2>{0.911449611f, 0.629446089f},
-std::array<float,2>{0.116089858f, 0.186136708f},
-std::array<float,2>{0.628514051f, 0.460380733f},
-std::array<float,2>{0.272079587f, 0.901461959f},
-std::array<float,2>{0.501081824f, 0.796098053f},
-std::array<float,2>{0.416851312f, 0.329902381f},
-std::array<float,2>{0.800196052f, 0.103862256f},
-std::array<float,2>{0.17990765f, 0.541219234f},
-std::array<float,2>{0.742167354f, 0.621605039f},
-std::array<float,2>{0.346977323f, 0.0374864526f},
-std::array<float,2>{0.954474568f, 0.294218242f},
-std::array<float,2>{0.0488153286f, 0.854321182f},
-std::array<float,2>{0.832723856f, 0.989313841f},
-std::array<float,2>{0.191122591f, 0.387876242f},
-std::array<float,2>{0.577816725f, 0.231832549f},
-std::array<float,2>{0.493792266f, 0.711131573f},
-std::array<float,2>{0.853546202f, 0.693826437f},
-std::array<float,2>{0.223266751f, 0.239992514f},
-std::array<float,2>{0.609328091f, 0.392657489f},
-std::array<float,2>{0.44755742f, 0.970168233f},
-std::array<float,2>{0.698676109f, 0.859448791f},
-std::array<float,2>{0.325807273f, 0.311567873f},
-std::array<float,2>{0.982681215f, 0.049321115f},
-std::array<float,2>{0.0292065404f, 0.596756756f},
-std::array<float,2>{0.543849766f, 0.549921453f},
-std::array<float,2>{0.375789911f, 0.117156908f},
-std::array<float,2>{0.755988598f, 0.327533662f},
-std::array<float,2>{0.138176918f, 0.798988998f},
-std::array<float,2>{0.888164103f, 0.889811456f},
-std::array<float,2>{0.0822321773f, 0.438162148f},
-std::array<float,2>{0.67308861f, 0.170453578f},
-std::array<float,2>{0.294094324f, 0.646330774f},
-std::array<float,2>{0.942851365f, 0.562854409f},
-std::array<float,2>{0.0361904576f, 0.001061672f},
-std::array<float,2>{0.719691873f, 0.256247967f},
-std::array<float,2>{0.361260831f, 0.828274131f},
-std::array<float,2>{0.58436203f, 0.966674924f},
-std::array<float,2>{0.472257763f, 0.40763554f},
-std::array<float,2>{0.824917972f, 0.190818593f},
-std::array<float,2>{0.212344214f, 0.726193428f},
-std::array<float,2>{0.650353253f, 0.659885705f},
-std::array<float,2>{0.259202152f, 0.145119533f},
-std::array<float,2>{0.925203025f, 0.499866605f},
-std::array<float,2>{0.107391573f, 0.919143379f},
-std::array<float,2>{0.793289781f, 0.76837635f},
-std::array<float,2>{0.171855032f, 0.368578583f},
-std::array<float,2>{0.520705462f, 0.0749693587f},
-std::array<float,2>{0.435081035f, 0.51996994f},
-std::array<float,2>{0.813715756f, 0.604306519f},
-std::array<float,2>{0.210015237f, 0.0596120097f},
-std::array<float,2>{0.589885652f, 0.302837163f},
-std::array<float,2>{0.477195561f, 0.873742402f},
-std::array<float,2>{0.726754069f, 0.980671704f},
-std::array<float,2>{0.371819913f, 0.402070194f},
-std::array<float,2>{0.951707661f, 0.245499313f},
-std::array<float,2>{0.0427170023f, 0.70242703f},
-std::array<float,2>{0.524068177f, 0.651799619f},
-std::array<float,2>{0.428346276f, 0.15669629f},
-std::array<float,2>{0.7878564f, 0.448135108f},
-std::array<float,2>{0.161430866f, 0.879088461f},
-std::array<float,2>{0.9300403f, 0.80624789f},
-std::array<float,2>{0.0961648226f, 0.313392878f},
-std::array<float,2>{0.644862831f, 0.121043123f},
-std::array<float,2>{0.252653569f, 0.562454104f},
-std::array<float,2>{0.970613718f, 0.728431404f},
-std::array<float,2>{0.0166534167f, 0.1956027f},
-std::array<float,2>{0.693481386f, 0.415792316f},
-std::array<float,2>{0.31613791f, 0.958693027f},
-std::array<float,2>{0.59992367f, 0.842210889f},
-std::array<float,2>{0.439204544f, 0.257843167f},
-std::array<float,2>{0.851338685f, 0.0103650708f},
-std::array<float,2>{0.227080137f, 0.573368788f},
-std::array<float,2>{0.681120992f, 0.530969739f},
-std::array<float,2>{0.28329435f, 0.064221397f},
-std::array<float,2>{0.877945065f, 0.364936948f},
-std::array<float,2>{0.0910818875f, 0.773980379f},
-std::array<float,2>{0.762186229f, 0.907992482f},
-std::array<float,2>{0.131136209f, 0.486072272f},
-std::array<float,2>{0.535021603f, 0.155438393f},
-std::array<float,2>{0.382980287f, 0.668571055f},
-std::array<float,2>{0.811586082f, 0.680486977f},
-std::array<float,2>{0.176613271f, 0.129038304f},
-std::array<float,2>{0.509844959f, 0.483007997f},
-std::array<float,2>{0.409193218f, 0.937196136f},
-std::array<float,2>{0.634159863f, 0.755148292f},
-std::array<float,2>{0.279615343f, 0.350198954f},
-std::array<float,2>{0.919750631f, 0.080347769f},
-std::array<float,2>{0.11743845f, 0.507914126f},
-std::array<float,2>{0.563765705f, 0.583618462f},
-std::array<float,2>{0.490109324f, 0.0285116639f},
-std::array<float,2>{0.843084455f, 0.266881496f},
-std::array<float,2>{0.198892832f, 0.820497572f},
-std::array<float,2>{0.964798808f, 0.946359396f},
-std::array<float,2>{0.0604539141f, 0.426360756f},
-std::array<float,2>{0.749349236f, 0.203462079f},
-std::array<float,2>{0.351573646f, 0.743283093f},
-std::array<float,2>{0.900376916f, 0.535059333f},
-std::array<float,2>{0.0711664632f, 0.0997392386f},
-std::array<float,2>{0.662261128f, 0.337967098f},
-std::array<float,2>{0.304473698f, 0.784428716f},
-std::array<float,2>{0.560498238f, 0.891252756f},
-std::array<float,2>{0.396293014f, 0.462679058f},
-std::array<float,2>{0.772417307f, 0.172766984f},
-std::array<float,2>{0.153567418f, 0.63337791f},
-std::array<float,2>{0.713580847f, 0.707604825f},
-std::array<float,2>{0.33469069f, 0.219311535f},
-std::array<float,2>{0.984463632f, 0.378789186f},
-std::array<float,2>{0.00741678756f, 0.996790349f},
-std::array<float,2>{0.85996294f, 0.84997344f},
-std::array<float,2>{0.241849542f, 0.283355057f},
-std::array<float,2>{0.614779472f, 0.0424037576f},
-std::array<float,2>{0.455067754f, 0.613847435f},
-std::array<float,2>{0.868051708f, 0.554832816f},
-std::array<float,2>{0.24357529f, 0.123918146f},
-std::array<float,2>{0.618909895f, 0.316556275f},
-std::array<float,2>{0.464301944f, 0.812272131f},
-std::array<float,2>{0.707804501f, 0.87529844f},
-std::array<float,2>{0.336924225f, 0.452301502f},
-std::array<float,2>{0.997130632f, 0.162371784f},
-std::array<float,2>{0.0143833188f, 0.654315412f},
-std::array<float,2>{0.546987772f, 0.695436478f},
-std::array<float,2>{0.402234703f, 0.247786894f},
-std::array<float,2>{0.780806661f, 0.403922707f},
-std::array<float,2>{0.148309603f, 0.978107989f},
-std::array<float,2>{0.898347199f, 0.867927611f},
-std::array<float,2>{0.0628305525f, 0.299601823f},
-std::array<float,2>{0.667476237f, 0.0557584353f},
-std::array<float,2>{0.308540434f, 0.608969569f},
-std::array<float,2>{0.958501935f, 0.666266799f},
-std::array<float,2>{0.0543634482f, 0.150965884f},
-std::array<float,2>{0.73633033f, 0.4892928f},
-std::array<float,2>{0.349259347f, 0.913792849f},
-std::array<float,2>{0.570866644f, 0.778717875f},
-std::array<float,2>{0.499938905f, 0.363074213f},
-std::array<float,2>{0.828471541f, 0.0684697032f},
-std::array<float,2>{0.194298685f, 0.524745643f},
-std::array<float,2>{0.629626036f, 0.574830592f},
-std::array<float,2>{0.26610291f, 0.012424551f},
-std::array<float,2>{0.907620132f, 0.264266431f},
-std::array<float,2>{0.111178868f, 0.839469552f},
-std::array<float,2>{0.802156985f, 0.953805029f},
-std::array<float,2>{0.184954628f, 0.420608342f},
-std::array<float,2>{0.507486284f, 0.202285349f},
-std::array<float,2>{0.418634534f, 0.730686784f},
-std::array<float,2>{0.753334224f, 0.746116102f},
-std::array<float,2>{0.135706484f, 0.20964922f},
-std::array<float,2>{0.542261004f, 0.423586637f},
-std::array<float,2>{0.380206108f, 0.95232743f},
-std::array<float,2>{0.67917347f, 0.825359702f},
-std::array<float,2>{0.292632967f, 0.271273941f},
-std::array<float,2>{0.884138525f, 0.0269320384f},
-std::array<float,2>{0.0811719745f, 0.580656707f},
-std::array<float,2>{0.60319072f, 0.513899803f},
-std::array<float,2>{0.450629115f, 0.0858205184f},
-std::array<float,2>{0.85853374f, 0.344573766f},
-std::array<float,2>{0.222247154f, 0.753875792f},
-std::array<float,2>{0.977861166f, 0.9322716f},
-std::array<float,2>{0.0269876495f, 0.477191806f},
-std::array<float,2>{0.700521529f, 0.127013266f},
-std::array<float,2>{0.322192639f, 0.684617817f},
-std::array<float,2>{0.929478645f, 0.610862672f},
-std::array<float,2>{0.103172384f, 0.0447461009f},
-std::array<float,2>{0.653216839f, 0.287114143f},
-std::array<float,2>{0.263434291f, 0.84550494f},
-std::array<float,2>{0.519070506f, 0.994957328f},
-std::array<float,2>{0.430755764f, 0.382308364f},
-std::array<float,2>{0.791565478f, 0.224960014f},
-std::array<float,2>{0.166252092f, 0.704164803f},
-std::array<float,2>{0.72575444f, 0.640459716f},
-std::array<float,2>{0.366859525f, 0.177991435f},
-std::array<float,2>{0.938405871f, 0.467884451f},
-std::array<float,2>{0.0315337591f, 0.896704018f},
-std::array<float,2>{0.820636809f, 0.786934435f},
-std::array<float,2>{0.218473747f, 0.343579024f},
-std::array<float,2>{0.580910563f, 0.0965882838f},
-std::array<float,2>{0.476476133f, 0.535791934f},
-std::array<float,2>{0.782785356f, 0.591846228f},
-std::array<float,2>{0.159530506f, 0.0166336205f},
-std::array<float,2>{0.531198323f, 0.280602187f},
-std::array<float,2>{0.424025178f, 0.816227376f},
-std::array<float,2>{0.641876221f, 0.942998827f},
-std::array<float,2>{0.254075289f, 0.432969123f},
-std::array<float,2>{0.936906159f, 0.215957463f},
-std::array<float,2>{0.100448169f, 0.738862872f},
-std::array<float,2>{0.586843789f, 0.673574984f},
-std::array<float,2>{0.484311163f, 0.137744918f},
-std::array<float,2>{0.819062233f, 0.475933671f},
-std::array<float,2>{0.205943167f, 0.925898552f},
-std::array<float,2>{0.946391463f, 0.762216747f},
-std::array<float,2>{0.0451739095f, 0.359098911f},
-std::array<float,2>{0.733949065f, 0.0887441859f},
-std::array<float,2>{0.369333714f, 0.506948948f},
-std::array<float,2>{0.880915105f, 0.716517627f},
-std::array<float,2>{0.0866271257f, 0.227757975f},
-std::array<float,2>{0.685266972f, 0.38493228f},
-std::array<float,2>{0.287264377f, 0.986823678f},
-std::array<float,2>{0.536833644f, 0.857827902f},
-std::array<float,2>{0.388143957f, 0.292376995f},
-std::array<float,2>{0.759584785f, 0.0317524821f},
-std::array<float,2>{0.125614598f, 0.619568706f},
-std::array<float,2>{0.688704848f, 0.543414712f},
-std::array<float,2>{0.319466233f, 0.107930422f},
-std::array<float,2>{0.975490749f, 0.335341632f},
-std::array<float,2>{0.0202771723f, 0.790969789f},
-std::array<float,2>{0.844965398f, 0.904209673f},
-std::array<float,2>{0.232624352f, 0.456249833f},
-std::array<float,2>{0.594802082f, 0.179770634f},
-std::array<float,2>{0.442537814f, 0.628121376f},
-std::array<float,2>{0.838897645f, 0.643345714f},
-std::array<float,2>{0.202604979f, 0.16586262f},
-std::array<float,2>{0.568174422f, 0.443427354f},
-std::array<float,2>{0.485831797f, 0.884635508f},
-std::array<float,2>{0.743069589f, 0.80248338f},
-std::array<float,2>{0.359140813f, 0.323662728f},
-std::array<float,2>{0.965382993f, 0.111950032f},
-std::array<float,2>{0.0557475872f, 0.553078949f},
-std::array<float,2>{0.51246798f, 0.599214554f},
-std::array<float,2>{0.411906749f, 0.0537011549f},
-std::array<float,2>{0.805580914f, 0.306447476f},
-std::array<float,2>{0.17269516f, 0.865485966f},
-std::array<float,2>{0.914292872f, 0.974403501f},
-std::array<float,2>{0.124476418f, 0.396847159f},
-std::array<float,2>{0.636960387f, 0.236642063f},
-std::array<float,2>{0.276474327f, 0.690930963f},
-std::array<float,2>{0.991177678f, 0.517567694f},
-std::array<float,2>{0.00133248582f, 0.0722684935f},
-std::array<float,2>{0.717693388f, 0.373995245f},
-std::array<float,2>{0.329635948f, 0.773038924f},
-std::array<float,2>{0.61221993f, 0.91618979f},
-std::array<float,2>{0.459366441f, 0.495057791f},
-std::array<float,2>{0.865793228f, 0.141510695f},
-std::array<float,2>{0.234417498f, 0.661036849f},
-std::array<float,2>{0.658052206f, 0.722521424f},
-std::array<float,2>{0.299919933f, 0.192202792f},
-std::array<float,2>{0.905345142f, 0.410348505f},
-std::array<float,2>{0.0750354901f, 0.962422013f},
-std::array<float,2>{0.768046856f, 0.832930565f},
-std::array<float,2>{0.15141055f, 0.252537131f},
-std::array<float,2>{0.555159807f, 0.00393724628f},
-std::array<float,2>{0.394093931f, 0.570218563f},
-std::array<float,2>{0.797100723f, 0.540031016f},
-std::array<float,2>{0.181811169f, 0.102953941f},
-std::array<float,2>{0.502030253f, 0.330269128f},
-std::array<float,2>{0.415502191f, 0.794863403f},
-std::array<float,2>{0.626452506f, 0.899434805f},
-std::array<float,2>{0.270691335f, 0.457638413f},
-std::array<float,2>{0.912144303f, 0.185345039f},
-std::array<float,2>{0.115100302f, 0.631988823f},
-std::array<float,2>{0.575964451f, 0.713234961f},
-std::array<float,2>{0.494839072f, 0.232574731f},
-std::array<float,2>{0.834864914f, 0.389737397f},
-std::array<float,2>{0.187917948f, 0.991672993f},
-std::array<float,2>{0.956818163f, 0.853225648f},
-std::array<float,2>{0.0505339839f, 0.296178102f},
-std::array<float,2>{0.738566339f, 0.0351783372f},
-std::array<float,2>{0.344727576f, 0.623235464f},
-std::array<float,2>{0.892104566f, 0.677364409f},
-std::array<float,2>{0.0692765415f, 0.136073381f},
-std::array<float,2>{0.671014309f, 0.471752048f},
-std::array<float,2>{0.309674203f, 0.923397779f},
-std::array<float,2>{0.55429405f, 0.758274198f},
-std::array<float,2>{0.404044122f, 0.353920639f},
-std::array<float,2>{0.775947273f, 0.0899147466f},
-std::array<float,2>{0.142264128f, 0.501388431f},
-std::array<float,2>{0.70667845f, 0.586250424f},
-std::array<float,2>{0.340930939f, 0.021496946f},
-std::array<float,2>{0.993115187f, 0.274740636f},
-std::array<float,2>{0.00872241799f, 0.81934309f},
-std::array<float,2>{0.874170363f, 0.938800573f},
-std::array<float,2>{0.24874568f, 0.434086382f},
-std::array<float,2>{0.621905923f, 0.213933185f},
-std::array<float,2>{0.468598336f, 0.737560868f},
-std::array<float,2>{0.826982617f, 0.722776294f},
-std::array<float,2>{0.214727998f, 0.189354017f},
-std::array<float,2>{0.583147168f, 0.409781188f},
-std::array<float,2>{0.470660627f, 0.968079865f},
-std::array<float,2>{0.722613871f, 0.830815554f},
-std::array<float,2>{0.361829489f, 0.255150795f},
-std::array<float,2>{0.944136083f, 0.00382580957f},
-std::array<float,2>{0.0371514745f, 0.566047311f},
-std::array<float,2>{0.522642732f, 0.522570848f},
-std::array<float,2>{0.435616463f, 0.0780476481f},
-std::array<float,2>{0.795606434f, 0.37039265f},
-std::array<float,2>{0.168077052f, 0.766971707f},
-std::array<float,2>{0.922278345f, 0.921074867f},
-std::array<float,2>{0.109014019f, 0.49618268f},
-std::array<float,2>{0.650639296f, 0.147751793f},
-std::array<float,2>{0.260201961f, 0.657029688f},
-std::array<float,2>{0.980814457f, 0.594165981f},
-std::array<float,2>{0.0299572777f, 0.0479049608f},
-std::array<float,2>{0.695780277f, 0.308654517f},
-std::array<float,2>{0.327474743f, 0.86169976f},
-std::array<float,2>{0.607011974f, 0.970949411f},
-std::array<float,2>{0.446539462f, 0.392270714f},
-std::array<float,2>{0.85215956f, 0.241453633f},
-std::array<float,2>{0.225889221f, 0.692241549f},
-std::array<float,2>{0.673868001f, 0.647743702f},
-std::array<float,2>{0.295820802f, 0.169512093f},
-std::array<float,2>{0.890416741f, 0.440022528f},
-std::array<float,2>{0.0856617913f, 0.887945533f},
-std::array<float,2>{0.755170941f, 0.797592103f},
-std::array<float,2>{0.139727458f, 0.325512439f},
-std::array<float,2>{0.54630506f, 0.1145868f},
-std::array<float,2>{0.378074616f, 0.547596395f},
-std::array<float,2>{0.849267244f, 0.571600139f},
-std::array<float,2>{0.228605255f, 0.00874372292f},
-std::array<float,2>{0.598541081f, 0.261646539f},
-std::array<float,2>{0.440164238f, 0.841513693f},
-std::array<float,2>{0.69180876f, 0.959480882f},
-std::array<float,2>{0.313901126f, 0.416127741f},
-std::array<float,2>{0.971479714f, 0.198627815f},
-std::array<float,2>{0.0193590671f, 0.72863555f},
-std::array<float,2>{0.531587839f, 0.670187473f},
-std::array<float,2>{0.385734469f, 0.153538853f},
-std::array<float,2>{0.763850987f, 0.487175912f},
-std::array<float,2>{0.130043477f, 0.909176528f},
-std::array<float,2>{0.876790941f, 0.776248753f},
-std::array<float,2>{0.0923381522f, 0.365677118f},
-std::array<float,2>{0.683360457f, 0.0650273263f},
-std::array<float,2>{0.282053649f, 0.527933717f},
-std::array<float,2>{0.949812651f, 0.699744344f},
-std::array<float,2>{0.0393680036f, 0.242793277f},
-std::array<float,2>{0.730448186f, 0.399564505f},
-std::array<float,2>{0.373261929f, 0.983600616f},
-std::array<float,2>{0.592397988f, 0.872472167f},
-std::array<float,2>{0.479352981f, 0.301809967f},
-std::array<float,2>{0.815982163f, 0.0616105162f},
-std::array<float,2>{0.208031014f, 0.603042662f},
-std::array<float,2>{0.646976888f, 0.559754312f},
-std::array<float,2>{0.250926882f, 0.117987208f},
-std::array<float,2>{0.932477295f, 0.31495741f},
-std::array<float,2>{0.0944659933f, 0.808421373f},
-std::array<float,2>{0.785835922f, 0.881496131f},
-std::array<float,2>{0.163574263f, 0.445365429f},
-std::array<float,2>{0.52585727f, 0.158364788f},
-std::array<float,2>{0.42703861f, 0.649145186f},
-std::array<float,2>{0.770332277f, 0.634979904f},
-std::array<float,2>{0.1549512f, 0.174360126f},
-std::array<float,2>{0.562105119f, 0.463010669f},
-std::array<float,2>{0.396709055f, 0.893205345f},
-std::array<float,2>{0.660934508f, 0.782528758f},
-std::array<float,2>{0.302477539f, 0.337015867f},
-std::array<float,2>{0.900788069f, 0.0993161052f},
-std::array<float,2>{0.0727751702f, 0.531720579f},
-std::array<float,2>{0.615478873f, 0.616362453f},
-std::array<float,2>{0.455680668f, 0.0400618315f},
-std::array<float,2>{0.862463295f, 0.281670958f},
-std::array<float,2>{0.239452824f, 0.849608481f},
-std::array<float,2>{0.987131715f, 0.998206437f},
-std::array<float,2>{0.0041181827f, 0.375604302f},
-std::array<float,2>{0.712862432f, 0.222206011f},
-std::array<float,2>{0.333357304f, 0.710690737f},
-std::array<float,2>{0.921253979f, 0.510037661f},
-std::array<float,2>{0.119674698f, 0.0790961236f},
-std::array<float,2>{0.635645568f, 0.348035097f},
-std::array<float,2>{0.278138727f, 0.757226229f},
-std::array<float,2>{0.50838244f, 0.933622599f},
-std::array<float,2>{0.406474888f, 0.481427163f},
-std::array<float,2>{0.809845567f, 0.131831676f},
-std::array<float,2>{0.178757563f, 0.683154762f},
-std::array<float,2>{0.747619867f, 0.746072948f},
-std::array<float,2>{0.354171962f, 0.205413297f},
-std::array<float,2>{0.961981058f, 0.428958118f},
-std::array<float,2>{0.0617558137f, 0.948870242f},
-std::array<float,2>{0.839987099f, 0.82281965f},
-std::array<float,2>{0.195544064f, 0.268034846f},
-std::array<float,2>{0.565790713f, 0.0309164841f},
-std::array<float,2>{0.49211818f, 0.584523559f},
-std::array<float,2>{0.830164433f, 0.526271343f},
-std::array<float,2>{0.191424698f, 0.0679789111f},
-std::array<float,2>{0.573695958f, 0.360607386f},
-std::array<float,2>{0.497134954f, 0.779414058f},
-std::array<float,2>{0.735567689f, 0.911259413f},
-std::array<float,2>{0.351261675f, 0.490305603f},
-std::array<float,2>{0.959136128f, 0.149782196f},
-std::array<float,2>{0.0511385947f, 0.66451174f},
-std::array<float,2>{0.505354345f, 0.733652115f},
-std::array<float,2>{0.420111299f, 0.200227246f},
-std::array<float,2>{0.804641128f, 0.41890496f},
-std::array<float,2>{0.186247721f, 0.956861675f},
-std::array<float,2>{0.909551978f, 0.837317109f},
-std::array<float,2>{0.113187045f, 0.262210876f},
-std::array<float,2>{0.63182205f, 0.0144804418f},
-std::array<float,2>{0.268564939f, 0.576926887f},
-std::array<float,2>{0.998151243f, 0.652503669f},
-std::array<float,2>{0.0134097151f, 0.160419524f},
-std::array<float,2>{0.709985495f, 0.450812072f},
-std::array<float,2>{0.33902365f, 0.877859354f},
-std::array<float,2>{0.620692015f, 0.809539318f},
-std::array<float,2>{0.461436093f, 0.318788022f},
-std::array<float,2>{0.870008171f, 0.122544676f},
-std::array<float,2>{0.245930403f, 0.556951225f},
-std::array<float,2>{0.664452493f, 0.607071877f},
-std::array<float,2>{0.304821759f, 0.0584917329f},
-std::array<float,2>{0.895836532f, 0.29797101f},
-std::array<float,2>{0.0662598237f, 0.869471848f},
-std::array<float,2>{0.778658211f, 0.979087651f},
-std::array<float,2>{0.14453356f, 0.405519694f},
-std::array<float,2>{0.550744236f, 0.249569669f},
-std::array<float,2>{0.399087936f, 0.697293878f},
-std::array<float,2>{0.790415227f, 0.70639348f},
-std::array<float,2>{0.164599836f, 0.222799271f},
-std::array<float,2>{0.517037988f, 0.379685223f},
-std::array<float,2>{0.432188153f, 0.993092954f},
-std::array<float,2>{0.654589176f, 0.847343922f},
-std::array<float,2>{0.264557004f, 0.286203653f},
-std::array<float,2>{0.926898241f, 0.0460577197f},
-std::array<float,2>{0.104061909f, 0.613201499f},
-std::array<float,2>{0.579530776f, 0.537452579f},
-std::array<float,2>{0.47284618f, 0.0952361152f},
-std::array<float,2>{0.82294625f, 0.340521395f},
-std::array<float,2>{0.215783492f, 0.788293958f},
-std::array<float,2>{0.940157235f, 0.894663155f},
-std::array<float,2>{0.0344154872f, 0.466035843f},
-std::array<float,2>{0.723179102f, 0.176482469f},
-std::array<float,2>{0.364163965f, 0.637099743f},
-std::array<float,2>{0.885173023f, 0.5796175f},
-std::array<float,2>{0.0790185481f, 0.0249224771f},
-std::array<float,2>{0.675818861f, 0.273126721f},
-std::array<float,2>{0.290348381f, 0.827522337f},
-std::array<float,2>{0.540777624f, 0.950917959f},
-std::array<float,2>{0.380862623f, 0.425267994f},
-std::array<float,2>{0.750789762f, 0.208351105f},
-std::array<float,2>{0.134252146f, 0.749605954f},
-std::array<float,2>{0.703107417f, 0.686608076f},
-std::array<float,2>{0.323072314f, 0.126525536f},
-std::array<float,2>{0.978805184f, 0.478623062f},
-std::array<float,2>{0.0236274358f, 0.929768145f},
-std::array<float,2>{0.857201338f, 0.750450134f},
-std::array<float,2>{0.220664129f, 0.34762603f},
-std::array<float,2>{0.60384351f, 0.0830857754f},
-std::array<float,2>{0.451840758f, 0.512828767f},
-std::array<float,2>{0.760073066f, 0.617376566f},
-std::array<float,2>{0.128815442f, 0.0339620039f},
-std::array<float,2>{0.537303984f, 0.28928864f},
-std::array<float,2>{0.389155447f, 0.85690546f},
-std::array<float,2>{0.685822785f, 0.985775352f},
-std::array<float,2>{0.28553921f, 0.383993179f},
-std::array<float,2>{0.879013538f, 0.229856476f},
-std::array<float,2>{0.0887497142f, 0.718681216f},
-std::array<float,2>{0.596426129f, 0.625448585f},
-std::array<float,2>{0.44404909f, 0.182978705f},
-std::array<float,2>{0.847495258f, 0.454321325f},
-std::array<float,2>{0.23145014f, 0.905508518f},
-std::array<float,2>{0.972679496f, 0.792652309f},
-std::array<float,2>{0.0219230093f, 0.333357781f},
-std::array<float,2>{0.691040695f, 0.106673405f},
-std::array<float,2>{0.317155957f, 0.546757698f},
-std::array<float,2>{0.934256494f, 0.741314292f},
-std::array<float,2>{0.098245509f, 0.218045861f},
-std::array<float,2>{0.64448899f, 0.431240261f},
-std::array<float,2>{0.255908221f, 0.945109487f},
-std::array<float,2>{0.527517378f, 0.812517881f},
-std::array<float,2>{0.422993839f, 0.278030068f},
-std::array<float,2>{0.783799231f, 0.0183966327f},
-std::array<float,2>{0.157758966f, 0.591531038f},
-std::array<float,2>{0.730933845f, 0.504977643f},
-std::array<float,2>{0.368001223f, 0.0862833336f},
-std::array<float,2>{0.948048055f, 0.357387573f},
-std::array<float,2>{0.0439959653f, 0.764063179f},
-std::array<float,2>{0.817667961f, 0.929558992f},
-std::array<float,2>{0.203199565f, 0.473891258f},
-std::array<float,2>{0.58835578f, 0.140158802f},
-std::array<float,2>{0.48120603f, 0.675388515f},
-std::array<float,2>{0.864806771f, 0.662586629f},
-std::array<float,2>{0.238194615f, 0.142826453f},
-std::array<float,2>{0.609455824f, 0.492438048f},
-std::array<float,2>{0.457213134f, 0.915330946f},
-std::array<float,2>{0.715168357f, 0.770773411f},
-std::array<float,2>{0.330976635f, 0.372250974f},
-std::array<float,2>{0.988539934f, 0.0705256164f},
-std::array<float,2>{0.00315270969f, 0.519503117f},
-std::array<float,2>{0.556884766f, 0.567446887f},
-std::array<float,2>{0.392066568f, 0.00627801102f},
-std::array<float,2>{0.7673406f, 0.251161873f},
-std::array<float,2>{0.148673043f, 0.835601449f},
-std::array<float,2>{0.902789831f, 0.963085771f},
-std::array<float,2>{0.0774926245f, 0.41405344f},
-std::array<float,2>{0.659280121f, 0.193378478f},
-std::array<float,2>{0.297182918f, 0.720644295f},
-std::array<float,2>{0.967213213f, 0.551190794f},
-std::array<float,2>{0.0582719743f, 0.109586723f},
-std::array<float,2>{0.745548904f, 0.321103692f},
-std::array<float,2>{0.356631339f, 0.80431354f},
-std::array<float,2>{0.568921864f, 0.885748982f},
-std::array<float,2>{0.486499757f, 0.442469358f},
-std::array<float,2>{0.836083949f, 0.166057631f},
-std::array<float,2>{0.199819073f, 0.642423332f},
-std::array<float,2>{0.639702797f, 0.689083993f},
-std::array<float,2>{0.273712248f, 0.235634655f},
-std::array<float,2>{0.91764009f, 0.39505139f},
-std::array<float,2>{0.122232176f, 0.975378454f},
-std::array<float,2>{0.806842566f, 0.864369631f},
-std::array<float,2>{0.174235478f, 0.308218747f},
-std::array<float,2>{0.514083326f, 0.0516884662f},
-std::array<float,2>{0.412344098f, 0.601290762f},
-std::array<float,2>{0.781044781f, 0.558390856f},
-std::array<float,2>{0.148126125f, 0.122012548f},
-std::array<float,2>{0.547265887f, 0.31944555f},
-std::array<float,2>{0.402078569f, 0.809654415f},
-std::array<float,2>{0.667025626f, 0.878882647f},
-std::array<float,2>{0.308232784f, 0.450092375f},
-std::array<float,2>{0.898062766f, 0.161417857f},
-std::array<float,2>{0.0627088696f, 0.653610229f},
-std::array<float,2>{0.618714154f, 0.698632419f},
-std::array<float,2>{0.463871747f, 0.248471037f},
-std::array<float,2>{0.867746532f, 0.404758573f},
-std::array<float,2>{0.243278503f, 0.980330467f},
-std::array<float,2>{0.997508109f, 0.870286763f},
-std::array<float,2>{0.0145251323f, 0.297428906f},
-std::array<float,2>{0.707528234f, 0.0575081632f},
-std::array<float,2>{0.337243915f, 0.606357098f},
-std::array<float,2>{0.907466412f, 0.665126681f},
-std::array<float,2>{0.110967413f, 0.149174854f},
-std::array<float,2>{0.629857063f, 0.491384119f},
-std::array<float,2>{0.2657893f, 0.910400391f},
-std::array<float,2>{0.507702231f, 0.780277133f},
-std::array<float,2>{0.418756217f, 0.360148698f},
-std::array<float,2>{0.801820517f, 0.0672385618f},
-std::array<float,2>{0.184698328f, 0.526562095f},
-std::array<float,2>{0.736738384f, 0.577286601f},
-std::array<float,2>{0.349490941f, 0.0155935166f},
-std::array<float,2>{0.958956718f, 0.263505191f},
-std::array<float,2>{0.0546615534f, 0.836892605f},
-std::array<float,2>{0.828183949f, 0.955824494f},
-std::array<float,2>{0.19390738f, 0.419821143f},
-std::array<float,2>{0.571097374f, 0.199224338f},
-std::array<float,2>{0.499623984f, 0.732699096f},
-std::array<float,2>{0.858848095f, 0.748707831f},
-std::array<float,2>{0.222588271f, 0.207959399f},
-std::array<float,2>{0.603322148f, 0.424031317f},
-std::array<float,2>{0.450281292f, 0.950041234f},
-std::array<float,2>{0.700278223f, 0.826209724f},
-std::array<float,2>{0.321841925f, 0.271921843f},
-std::array<float,2>{0.977750242f, 0.0240976997f},
-std::array<float,2>{0.027170416f, 0.57817024f},
-std::array<float,2>{0.5420084f, 0.51260221f},
-std::array<float,2>{0.379980803f, 0.0828744024f},
-std::array<float,2>{0.753038049f, 0.34606421f},
-std::array<float,2>{0.135262564f, 0.751746297f},
-std::array<float,2>{0.883789599f, 0.931067467f},
-std::array<float,2>{0.0815276727f, 0.480193555f},
-std::array<float,2>{0.678877652f, 0.125264272f},
-std::array<float,2>{0.292961597f, 0.685761452f},
-std::array<float,2>{0.937993765f, 0.612207294f},
-std::array<float,2>{0.0314106531f, 0.0451642051f},
-std::array<float,2>{0.725874245f, 0.285888046f},
-std::array<float,2>{0.366945356f, 0.846669912f},
-std::array<float,2>{0.580658734f, 0.993920088f},
-std::array<float,2>{0.476079911f, 0.380265713f},
-std::array<float,2>{0.820383906f, 0.224174887f},
-std::array<float,2>{0.218550161f, 0.705596268f},
-std::array<float,2>{0.652874768f, 0.638528228f},
-std::array<float,2>{0.263385743f, 0.176805556f},
-std::array<float,2>{0.929332435f, 0.465684831f},
-std::array<float,2>{0.103428245f, 0.896325529f},
-std::array<float,2>{0.791921556f, 0.787145197f},
-std::array<float,2>{0.166479245f, 0.340899795f},
-std::array<float,2>{0.519419253f, 0.0946441889f},
-std::array<float,2>{0.431046158f, 0.538539767f},
-std::array<float,2>{0.819304287f, 0.590713561f},
-std::array<float,2>{0.205663651f, 0.0186629687f},
-std::array<float,2>{0.586516619f, 0.278876126f},
-std::array<float,2>{0.484063894f, 0.813610971f},
-std::array<float,2>{0.734310389f, 0.944206178f},
-std::array<float,2>{0.369536996f, 0.429737955f},
-std::array<float,2>{0.94653821f, 0.217435077f},
-std::array<float,2>{0.0449245721f, 0.740534484f},
-std::array<float,2>{0.530772269f, 0.674254477f},
-std::array<float,2>{0.424139678f, 0.139612377f},
-std::array<float,2>{0.78316927f, 0.473559409f},
-std::array<float,2>{0.159261569f, 0.928510964f},
-std::array<float,2>{0.936579347f, 0.764688373f},
-std::array<float,2>{0.100170054f, 0.355702609f},
-std::array<float,2>{0.641695201f, 0.0873326957f},
-std::array<float,2>{0.254163504f, 0.504124582f},
-std::array<float,2>{0.9751544f, 0.717184842f},
-std::array<float,2>{0.0201694407f, 0.228972346f},
-std::array<float,2>{0.688777804f, 0.383732319f},
-std::array<float,2>{0.319821686f, 0.984390974f},
-std::array<float,2>{0.595068753f, 0.856150329f},
-std::array<float,2>{0.442802936f, 0.290333539f},
-std::array<float,2>{0.845174432f, 0.0344606563f},
-std::array<float,2>{0.23287259f, 0.61910826f},
-std::array<float,2>{0.685494781f, 0.545192897f},
-std::array<float,2>{0.287474334f, 0.106316447f},
-std::array<float,2>{0.881290257f, 0.332711846f},
-std::array<float,2>{0.0866992846f, 0.791366279f},
-std::array<float,2>{0.759314239f, 0.904622734f},
-std::array<float,2>{0.125799447f, 0.453622788f},
-std::array<float,2>{0.536931396f, 0.182217196f},
-std::array<float,2>{0.387763888f, 0.626911461f},
-std::array<float,2>{0.805264354f, 0.64154911f},
-std::array<float,2>{0.172454149f, 0.167470485f},
-std::array<float,2>{0.512233198f, 0.441628993f},
-std::array<float,2>{0.41167891f, 0.884776652f},
-std::array<float,2>{0.637186646f, 0.802944064f},
-std::array<float,2>{0.27670747f, 0.321476579f},
-std::array<float,2>{0.914319098f, 0.110394068f},
-std::array<float,2>{0.124024913f, 0.552032232f},
-std::array<float,2>{0.567968667f, 0.599835873f},
-std::array<float,2>{0.485586137f, 0.0522021167f},
-std::array<float,2>{0.83916831f, 0.306973696f},
-std::array<float,2>{0.202164382f, 0.863437772f},
-std::array<float,2>{0.965659201f, 0.976409853f},
-std::array<float,2>{0.0561206751f, 0.395986468f},
-std::array<float,2>{0.742700577f, 0.235066816f},
-std::array<float,2>{0.358925134f, 0.687732935f},
-std::array<float,2>{0.905580878f, 0.518428624f},
-std::array<float,2>{0.074708797f, 0.0719877556f},
-std::array<float,2>{0.657738686f, 0.37170732f},
-std::array<float,2>{0.300061345f, 0.769855142f},
-std::array<float,2>{0.554797947f, 0.91492033f},
-std::array<float,2>{0.394476861f, 0.49342975f},
-std::array<float,2>{0.767683029f, 0.143945187f},
-std::array<float,2>{0.151748195f, 0.663929939f},
-std::array<float,2>{0.717461348f, 0.718776047f},
-std::array<float,2>{0.329942077f, 0.195158914f},
-std::array<float,2>{0.990899682f, 0.412996054f},
-std::array<float,2>{0.00113901321f, 0.963867664f},
-std::array<float,2>{0.865982533f, 0.833991468f},
-std::array<float,2>{0.234817922f, 0.250139385f},
-std::array<float,2>{0.612021089f, 0.00747872144f},
-std::array<float,2>{0.459102392f, 0.566599369f},
-std::array<float,2>{0.871597052f, 0.500468493f},
-std::array<float,2>{0.246186286f, 0.0914991722f},
-std::array<float,2>{0.623881042f, 0.355263978f},
-std::array<float,2>{0.466612875f, 0.759445369f},
-std::array<float,2>{0.704446137f, 0.922486126f},
-std::array<float,2>{0.343281448f, 0.471123964f},
-std::array<float,2>{0.994791627f, 0.135400802f},
-std::array<float,2>{0.0115489829f, 0.67639792f},
-std::array<float,2>{0.552468896f, 0.737086356f},
-std::array<float,2>{0.405496091f, 0.213200465f},
-std::array<float,2>{0.775048196f, 0.434699059f},
-std::array<float,2>{0.143627122f, 0.938104391f},
-std::array<float,2>{0.892975628f, 0.81882149f},
-std::array<float,2>{0.0683167353f, 0.2741476f},
-std::array<float,2>{0.668596923f, 0.0233599208f},
-std::array<float,2>{0.311320931f, 0.587073386f},
-std::array<float,2>{0.954266429f, 0.630885959f},
-std::array<float,2>{0.0484201163f, 0.184035122f},
-std::array<float,2>{0.741910934f, 0.458771139f},
-std::array<float,2>{0.346681535f, 0.898977578f},
-std::array<float,2>{0.578034818f, 0.79390645f},
-std::array<float,2>{0.494009525f, 0.332025021f},
-std::array<float,2>{0.832851052f, 0.102059267f},
-std::array<float,2>{0.191227794f, 0.540701628f},
-std::array<float,2>{0.628806114f, 0.624573529f},
-std::array<float,2>{0.272304982f, 0.037004035f},
-std::array<float,2>{0.911227405f, 0.295144141f},
-std::array<float,2>{0.115820095f, 0.851858974f},
-std::array<float,2>{0.799826264f, 0.990297854f},
-std::array<float,2>{0.179944426f, 0.388936311f},
-std::array<float,2>{0.501318753f, 0.233785644f},
-std::array<float,2>{0.416572452f, 0.714489162f},
-std::array<float,2>{0.756145239f, 0.693297625f},
-std::array<float,2>{0.137732998f, 0.241069347f},
-std::array<float,2>{0.543653965f, 0.391354203f},
-std::array<float,2>{0.375606388f, 0.971837521f},
-std::array<float,2>{0.673205793f, 0.862994194f},
-std::array<float,2>{0.294335574f, 0.309890538f},
-std::array<float,2>{0.887700021f, 0.0474449918f},
-std::array<float,2>{0.082331039f, 0.595014572f},
-std::array<float,2>{0.609019458f, 0.548538864f},
-std::array<float,2>{0.447269648f, 0.114227898f},
-std::array<float,2>{0.853898227f, 0.324825555f},
-std::array<float,2>{0.223397389f, 0.798337996f},
-std::array<float,2>{0.982438147f, 0.887593865f},
-std::array<float,2>{0.0289340466f, 0.441063911f},
-std::array<float,2>{0.698283732f, 0.167996094f},
-std::array<float,2>{0.325997591f, 0.646671295f},
-std::array<float,2>{0.925046325f, 0.565294147f},
-std::array<float,2>{0.107048519f, 0.00228061876f},
-std::array<float,2>{0.650093734f, 0.25459978f},
-std::array<float,2>{0.25883463f, 0.831096292f},
-std::array<float,2>{0.520871818f, 0.966996431f},
-std::array<float,2>{0.43548286f, 0.408627599f},
-std::array<float,2>{0.793018818f, 0.188405797f},
-std::array<float,2>{0.171588361f, 0.72409296f},
-std::array<float,2>{0.719440937f, 0.657739937f},
-std::array<float,2>{0.361054659f, 0.146765247f},
-std::array<float,2>{0.942578137f, 0.497997344f},
-std::array<float,2>{0.0365736596f, 0.920574188f},
-std::array<float,2>{0.825163424f, 0.766447127f},
-std::array<float,2>{0.212032095f, 0.369381338f},
-std::array<float,2>{0.58411473f, 0.0765405893f},
-std::array<float,2>{0.472472489f, 0.52242595f},
-std::array<float,2>{0.787618816f, 0.602194428f},
-std::array<float,2>{0.16118674f, 0.061303623f},
-std::array<float,2>{0.524352074f, 0.301597118f},
-std::array<float,2>{0.428637296f, 0.871369779f},
-std::array<float,2>{0.644617021f, 0.983215809f},
-std::array<float,2>{0.252889216f, 0.39891988f},
-std::array<float,2>{0.929907978f, 0.243270829f},
-std::array<float,2>{0.095761694f, 0.700630069f},
-std::array<float,2>{0.590166509f, 0.649531364f},
-std::array<float,2>{0.477520913f, 0.160105169f},
-std::array<float,2>{0.813863873f, 0.447249055f},
-std::array<float,2>{0.210327864f, 0.881890178f},
-std::array<float,2>{0.951944888f, 0.806859314f},
-std::array<float,2>{0.0427989215f, 0.316044569f},
-std::array<float,2>{0.726905406f, 0.118455872f},
-std::array<float,2>{0.372045487f, 0.558690965f},
-std::array<float,2>{0.878181875f, 0.729949117f},
-std::array<float,2>{0.0909522846f, 0.198224872f},
-std::array<float,2>{0.680853188f, 0.417640269f},
-std::array<float,2>{0.283594161f, 0.960879028f},
-std::array<float,2>{0.534728408f, 0.84029156f},
-std::array<float,2>{0.383234233f, 0.260726184f},
-std::array<float,2>{0.761946917f, 0.009386383f},
-std::array<float,2>{0.130896151f, 0.571008682f},
-std::array<float,2>{0.693757653f, 0.528909326f},
-std::array<float,2>{0.316340506f, 0.0660014302f},
-std::array<float,2>{0.970230103f, 0.366378427f},
-std::array<float,2>{0.0169028416f, 0.776630461f},
-std::array<float,2>{0.851222634f, 0.909263849f},
-std::array<float,2>{0.227471322f, 0.487650961f},
-std::array<float,2>{0.5997141f, 0.152978644f},
-std::array<float,2>{0.439418733f, 0.671081603f},
-std::array<float,2>{0.842878103f, 0.682041645f},
-std::array<float,2>{0.199063614f, 0.131922513f},
-std::array<float,2>{0.56359756f, 0.482267082f},
-std::array<float,2>{0.489808947f, 0.934911072f},
-std::array<float,2>{0.749035358f, 0.756202936f},
-std::array<float,2>{0.351855874f, 0.348879129f},
-std::array<float,2>{0.964492023f, 0.0793983564f},
-std::array<float,2>{0.0601696484f, 0.510914445f},
-std::array<float,2>{0.510247886f, 0.585003972f},
-std::array<float,2>{0.409502089f, 0.0297414511f},
-std::array<float,2>{0.811899304f, 0.269204795f},
-std::array<float,2>{0.176347375f, 0.82348454f},
-std::array<float,2>{0.91957438f, 0.947526932f},
-std::array<float,2>{0.117288314f, 0.427765131f},
-std::array<float,2>{0.633882642f, 0.206524625f},
-std::array<float,2>{0.279400915f, 0.744174659f},
-std::array<float,2>{0.984668016f, 0.532438874f},
-std::array<float,2>{0.00771369692f, 0.0976608172f},
-std::array<float,2>{0.713715911f, 0.3360838f},
-std::array<float,2>{0.334750563f, 0.781591773f},
-std::array<float,2>{0.61509788f, 0.894408047f},
-std::array<float,2>{0.454827696f, 0.464701205f},
-std::array<float,2>{0.860239387f, 0.175697118f},
-std::array<float,2>{0.242166638f, 0.63624537f},
-std::array<float,2>{0.662386477f, 0.709522784f},
-std::array<float,2>{0.304312348f, 0.221466228f},
-std::array<float,2>{0.900129676f, 0.376278579f},
-std::array<float,2>{0.0708391592f, 0.999924123f},
-std::array<float,2>{0.77197814f, 0.847892761f},
-std::array<float,2>{0.153550461f, 0.282407939f},
-std::array<float,2>{0.560189247f, 0.0399630405f},
-std::array<float,2>{0.396011353f, 0.615416408f},
-std::array<float,2>{0.804402471f, 0.523763537f},
-std::array<float,2>{0.186434656f, 0.0697396994f},
-std::array<float,2>{0.504947782f, 0.36179173f},
-std::array<float,2>{0.420379847f, 0.778115332f},
-std::array<float,2>{0.631477833f, 0.912395656f},
-std::array<float,2>{0.268918276f, 0.489058584f},
-std::array<float,2>{0.909408748f, 0.152228624f},
-std::array<float,2>{0.112946458f, 0.667456329f},
-std::array<float,2>{0.573454142f, 0.731683731f},
-std::array<float,2>{0.4975366f, 0.201816455f},
-std::array<float,2>{0.830350995f, 0.421320736f},
-std::array<float,2>{0.19182387f, 0.954132557f},
-std::array<float,2>{0.95926702f, 0.838833511f},
-std::array<float,2>{0.0508251376f, 0.264941722f},
-std::array<float,2>{0.735646069f, 0.0128615517f},
-std::array<float,2>{0.351536036f, 0.575981379f},
-std::array<float,2>{0.895598531f, 0.655452132f},
-std::array<float,2>{0.0661164671f, 0.164015785f},
-std::array<float,2>{0.664184988f, 0.451710105f},
-std::array<float,2>{0.305148065f, 0.876479566f},
-std::array<float,2>{0.550522447f, 0.811262488f},
-std::array<float,2>{0.399194658f, 0.317993075f},
-std::array<float,2>{0.778544486f, 0.124290362f},
-std::array<float,2>{0.144853935f, 0.556126595f},
-std::array<float,2>{0.710322618f, 0.608254552f},
-std::array<float,2>{0.339231998f, 0.0555887073f},
-std::array<float,2>{0.998456061f, 0.300103068f},
-std::array<float,2>{0.013456447f, 0.869016051f},
-std::array<float,2>{0.86982429f, 0.976597905f},
-std::array<float,2>{0.245660916f, 0.402543455f},
-std::array<float,2>{0.62095207f, 0.246983364f},
-std::array<float,2>{0.461831421f, 0.696608305f},
-std::array<float,2>{0.823234618f, 0.703285098f},
-std::array<float,2>{0.215473324f, 0.226418331f},
-std::array<float,2>{0.579344451f, 0.380964905f},
-std::array<float,2>{0.472970843f, 0.995461822f},
-std::array<float,2>{0.723425925f, 0.844250441f},
-std::array<float,2>{0.363898665f, 0.288600951f},
-std::array<float,2>{0.940225601f, 0.043464154f},
-std::array<float,2>{0.0344420113f, 0.609605849f},
-std::array<float,2>{0.516817153f, 0.536262929f},
-std::array<float,2>{0.432473511f, 0.0972286239f},
-std::array<float,2>{0.790278316f, 0.342082202f},
-std::array<float,2>{0.164904565f, 0.785662472f},
-std::array<float,2>{0.927150369f, 0.8978315f},
-std::array<float,2>{0.104285166f, 0.467583954f},
-std::array<float,2>{0.654444754f, 0.178741574f},
-std::array<float,2>{0.26430276f, 0.639207363f},
-std::array<float,2>{0.978555501f, 0.581919551f},
-std::array<float,2>{0.023709774f, 0.0260203015f},
-std::array<float,2>{0.702851951f, 0.270493716f},
-std::array<float,2>{0.32299611f, 0.824832916f},
-std::array<float,2>{0.603637993f, 0.95164448f},
-std::array<float,2>{0.45213294f, 0.422336847f},
-std::array<float,2>{0.856983781f, 0.210755989f},
-std::array<float,2>{0.220362201f, 0.747157037f},
-std::array<float,2>{0.67618382f, 0.684537113f},
-std::array<float,2>{0.290084213f, 0.127946913f},
-std::array<float,2>{0.88483125f, 0.478317648f},
-std::array<float,2>{0.0786178038f, 0.932851672f},
-std::array<float,2>{0.750597477f, 0.752111971f},
-std::array<float,2>{0.133937716f, 0.34566167f},
-std::array<float,2>{0.540564537f, 0.084476009f},
-std::array<float,2>{0.381259501f, 0.515414715f},
-std::array<float,2>{0.847271025f, 0.620763958f},
-std::array<float,2>{0.231847823f, 0.0329742283f},
-std::array<float,2>{0.596444726f, 0.291120648f},
-std::array<float,2>{0.444185793f, 0.858893931f},
-std::array<float,2>{0.691370666f, 0.987663627f},
-std::array<float,2>{0.317116618f, 0.386319667f},
-std::array<float,2>{0.972916782f, 0.227119341f},
-std::array<float,2>{0.0215605069f, 0.71574235f},
-std::array<float,2>{0.537459552f, 0.62783438f},
-std::array<float,2>{0.388762742f, 0.181515813f},
-std::array<float,2>{0.759961069f, 0.456031203f},
-std::array<float,2>{0.128530696f, 0.902607679f},
-std::array<float,2>{0.879179537f, 0.789689243f},
-std::array<float,2>{0.0884116143f, 0.334515989f},
-std::array<float,2>{0.68570286f, 0.109374948f},
-std::array<float,2>{0.285288483f, 0.54484117f},
-std::array<float,2>{0.947895408f, 0.740187109f},
-std::array<float,2>{0.0442891866f, 0.215510577f},
-std::array<float,2>{0.730516613f, 0.432346344f},
-std::array<float,2>{0.367684752f, 0.942115664f},
-std::array<float,2>{0.587908268f, 0.814817548f},
-std::array<float,2>{0.481171668f, 0.279759377f},
-std::array<float,2>{0.817438722f, 0.0161129404f},
-std::array<float,2>{0.203551009f, 0.593338311f},
-std::array<float,2>{0.644047558f, 0.506366849f},
-std::array<float,2>{0.256191969f, 0.0890529454f},
-std::array<float,2>{0.934400678f, 0.358108014f},
-std::array<float,2>{0.0985181555f, 0.763157427f},
-std::array<float,2>{0.784082115f, 0.927674592f},
-std::array<float,2>{0.158169419f, 0.475280941f},
-std::array<float,2>{0.527626514f, 0.137136802f},
-std::array<float,2>{0.423155278f, 0.672689378f},
-std::array<float,2>{0.767179012f, 0.661668539f},
-std::array<float,2>{0.14873156f, 0.141993955f},
-std::array<float,2>{0.556868851f, 0.495849013f},
-std::array<float,2>{0.391636252f, 0.917870581f},
-std::array<float,2>{0.659582794f, 0.772098541f},
-std::array<float,2>{0.297107965f, 0.374293745f},
-std::array<float,2>{0.902544618f, 0.0742096901f},
-std::array<float,2>{0.0772932991f, 0.516211092f},
-std::array<float,2>{0.609619498f, 0.568515658f},
-std::array<float,2>{0.457296222f, 0.00561218709f},
-std::array<float,2>{0.865015268f, 0.253641248f},
-std::array<float,2>{0.237871051f, 0.833410919f},
-std::array<float,2>{0.988360941f, 0.961789668f},
-std::array<float,2>{0.00323526002f, 0.411203623f},
-std::array<float,2>{0.714998066f, 0.192684904f},
-std::array<float,2>{0.330688357f, 0.721029103f},
-std::array<float,2>{0.917956412f, 0.554427505f},
-std::array<float,2>{0.122496091f, 0.1127735f},
-std::array<float,2>{0.639962316f, 0.323133498f},
-std::array<float,2>{0.273538172f, 0.800958812f},
-std::array<float,2>{0.513854623f, 0.883379102f},
-std::array<float,2>{0.412436783f, 0.445306778f},
-std::array<float,2>{0.806906581f, 0.164734706f},
-std::array<float,2>{0.173832297f, 0.643602312f},
-std::array<float,2>{0.745144546f, 0.689943254f},
-std::array<float,2>{0.356744468f, 0.23823759f},
-std::array<float,2>{0.966863394f, 0.398409456f},
-std::array<float,2>{0.0583936386f, 0.973044753f},
-std::array<float,2>{0.836241364f, 0.866932392f},
-std::array<float,2>{0.200153753f, 0.305266738f},
-std::array<float,2>{0.569223046f, 0.0543735847f},
-std::array<float,2>{0.486768872f, 0.598516703f},
-std::array<float,2>{0.834512234f, 0.542838335f},
-std::array<float,2>{0.187713891f, 0.104557343f},
-std::array<float,2>{0.575754285f, 0.328973323f},
-std::array<float,2>{0.495059758f, 0.795137167f},
-std::array<float,2>{0.738303542f, 0.900926709f},
-std::array<float,2>{0.345164239f, 0.459091634f},
-std::array<float,2>{0.956622481f, 0.187464952f},
-std::array<float,2>{0.0506739207f, 0.630535603f},
-std::array<float,2>{0.502385974f, 0.71224165f},
-std::array<float,2>{0.415076852f, 0.230560333f},
-std::array<float,2>{0.797312617f, 0.387521237f},
-std::array<float,2>{0.181969449f, 0.988419652f},
-std::array<float,2>{0.912377059f, 0.854944587f},
-std::array<float,2>{0.114760146f, 0.293131858f},
-std::array<float,2>{0.626093209f, 0.0384625122f},
-std::array<float,2>{0.270940155f, 0.622579098f},
-std::array<float,2>{0.992705345f, 0.679204226f},
-std::array<float,2>{0.00839984883f, 0.13419421f},
-std::array<float,2>{0.706856132f, 0.469236523f},
-std::array<float,2>{0.341164768f, 0.924753785f},
-std::array<float,2>{0.621766746f, 0.760280788f},
-std::array<float,2>{0.468340188f, 0.352825999f},
-std::array<float,2>{0.874406815f, 0.0928740799f},
-std::array<float,2>{0.248963982f, 0.502988815f},
-std::array<float,2>{0.671160579f, 0.588744402f},
-std::array<float,2>{0.309839219f, 0.0202043224f},
-std::array<float,2>{0.892532885f, 0.275834799f},
-std::array<float,2>{0.068856895f, 0.817694962f},
-std::array<float,2>{0.776317179f, 0.941181779f},
-std::array<float,2>{0.142428726f, 0.436525941f},
-std::array<float,2>{0.554620206f, 0.212592646f},
-std::array<float,2>{0.40423435f, 0.736257851f},
-std::array<float,2>{0.795783877f, 0.725254536f},
-std::array<float,2>{0.168246478f, 0.18946588f},
-std::array<float,2>{0.522818327f, 0.406864315f},
-std::array<float,2>{0.435883641f, 0.964930713f},
-std::array<float,2>{0.650533438f, 0.829103589f},
-std::array<float,2>{0.25999254f, 0.257625192f},
-std::array<float,2>{0.922018111f, 0.000710294291f},
-std::array<float,2>{0.109350622f, 0.563731611f},
-std::array<float,2>{0.583302677f, 0.520656288f},
-std::array<float,2>{0.470222563f, 0.0752622858f},
-std::array<float,2>{0.826882184f, 0.36777851f},
-std::array<float,2>{0.214543909f, 0.769280732f},
-std::array<float,2>{0.943967879f, 0.918342292f},
-std::array<float,2>{0.0373975262f, 0.498717964f},
-std::array<float,2>{0.722229719f, 0.145904213f},
-std::array<float,2>{0.362253398f, 0.658554077f},
-std::array<float,2>{0.890229285f, 0.595747769f},
-std::array<float,2>{0.0858138651f, 0.0501404665f},
-std::array<float,2>{0.674239993f, 0.31060043f},
-std::array<float,2>{0.295648128f, 0.860629916f},
-std::array<float,2>{0.546076298f, 0.969587028f},
-std::array<float,2>{0.378183812f, 0.393956572f},
-std::array<float,2>{0.755062163f, 0.2390517f},
-std::array<float,2>{0.140062124f, 0.695159853f},
-std::array<float,2>{0.695331752f, 0.644551516f},
-std::array<float,2>{0.327324301f, 0.17149514f},
-std::array<float,2>{0.980673552f, 0.439225316f},
-std::array<float,2>{0.0301697105f, 0.889554679f},
-std::array<float,2>{0.85251534f, 0.800451577f},
-std::array<float,2>{0.225675642f, 0.3270863f},
-std::array<float,2>{0.607389092f, 0.115937985f},
-std::array<float,2>{0.44646287f, 0.54931742f},
-std::array<float,2>{0.764004529f, 0.573037386f},
-std::array<float,2>{0.130261868f, 0.0112975826f},
-std::array<float,2>{0.531477392f, 0.259562373f},
-std::array<float,2>{0.385466188f, 0.843250334f},
-std::array<float,2>{0.683169425f, 0.957926393f},
-std::array<float,2>{0.28182134f, 0.414796174f},
-std::array<float,2>{0.876707435f, 0.196741804f},
-std::array<float,2>{0.0927546918f, 0.727010846f},
-std::array<float,2>{0.598182499f, 0.669013739f},
-std::array<float,2>{0.440254033f, 0.1543798f},
-std::array<float,2>{0.849595845f, 0.485108703f},
-std::array<float,2>{0.228885278f, 0.906875372f},
-std::array<float,2>{0.971199811f, 0.775007606f},
-std::array<float,2>{0.0190900657f, 0.363320649f},
-std::array<float,2>{0.691457212f, 0.0626836792f},
-std::array<float,2>{0.313632995f, 0.529780865f},
-std::array<float,2>{0.932338655f, 0.701392591f},
-std::array<float,2>{0.0946638733f, 0.245048553f},
-std::array<float,2>{0.647312701f, 0.400568664f},
-std::array<float,2>{0.250668615f, 0.981999397f},
-std::array<float,2>{0.525412738f, 0.874291956f},
-std::array<float,2>{0.426942408f, 0.303971112f},
-std::array<float,2>{0.785895526f, 0.0593126528f},
-std::array<float,2>{0.164002389f, 0.605463922f},
-std::array<float,2>{0.730157971f, 0.56066972f},
-std::array<float,2>{0.373312265f, 0.119552977f},
-std::array<float,2>{0.950003803f, 0.314218044f},
-std::array<float,2>{0.0391153507f, 0.804792345f},
-std::array<float,2>{0.816294849f, 0.880366266f},
-std::array<float,2>{0.208306715f, 0.448267817f},
-std::array<float,2>{0.592586398f, 0.157712191f},
-std::array<float,2>{0.47913754f, 0.650609314f},
-std::array<float,2>{0.862672567f, 0.634096146f},
-std::array<float,2>{0.23972857f, 0.173094392f},
-std::array<float,2>{0.615448534f, 0.461244434f},
-std::array<float,2>{0.455872715f, 0.891913712f},
-std::array<float,2>{0.712487578f, 0.783259273f},
-std::array<float,2>{0.333114892f, 0.339184791f},
-std::array<float,2>{0.986922681f, 0.101369984f},
-std::array<float,2>{0.00426675845f, 0.53364253f},
-std::array<float,2>{0.562336326f, 0.614598453f},
-std::array<float,2>{0.396756649f, 0.041055914f},
-std::array<float,2>{0.77025485f, 0.284783602f},
-std::array<float,2>{0.155094415f, 0.851433575f},
-std::array<float,2>{0.900605381f, 0.997122705f},
-std::array<float,2>{0.073129274f, 0.377821416f},
-std::array<float,2>{0.660802305f, 0.219857857f},
-std::array<float,2>{0.302499503f, 0.708179653f},
-std::array<float,2>{0.962382734f, 0.509649575f},
-std::array<float,2>{0.061873991f, 0.0813254341f},
-std::array<float,2>{0.747814178f, 0.351069987f},
-std::array<float,2>{0.354276717f, 0.754360318f},
-std::array<float,2>{0.565549731f, 0.936421692f},
-std::array<float,2>{0.49177587f, 0.484030932f},
-std::array<float,2>{0.840112567f, 0.130364403f},
-std::array<float,2>{0.195751727f, 0.680879593f},
-std::array<float,2>{0.635262012f, 0.74233371f},
-std::array<float,2>{0.277953446f, 0.204118118f},
-std::array<float,2>{0.920952499f, 0.427664787f},
-std::array<float,2>{0.119895801f, 0.946109712f},
-std::array<float,2>{0.809725583f, 0.822054744f},
-std::array<float,2>{0.179104447f, 0.266048133f},
-std::array<float,2>{0.508751631f, 0.0274820141f},
-std::array<float,2>{0.406736284f, 0.58270663f},
-std::array<float,2>{0.752242446f, 0.514432311f},
-std::array<float,2>{0.135923341f, 0.0853762627f},
-std::array<float,2>{0.541844428f, 0.344136447f},
-std::array<float,2>{0.379460692f, 0.752965689f},
-std::array<float,2>{0.678080082f, 0.932018816f},
-std::array<float,2>{0.291235596f, 0.476791352f},
-std::array<float,2>{0.883136153f, 0.127805844f},
-std::array<float,2>{0.0807580128f, 0.685237706f},
-std::array<float,2>{0.601795018f, 0.746625841f},
-std::array<float,2>{0.450107992f, 0.209340021f},
-std::array<float,2>{0.857942581f, 0.42309016f},
-std::array<float,2>{0.220759436f, 0.953095317f},
-std::array<float,2>{0.977439225f, 0.826079726f},
-std::array<float,2>{0.0261151865f, 0.270881474f},
-std::array<float,2>{0.699491978f, 0.0265230071f},
-std::array<float,2>{0.32088685f, 0.58013016f},
-std::array<float,2>{0.927867353f, 0.639708698f},
-std::array<float,2>{0.102229767f, 0.178531274f},
-std::array<float,2>{0.653996468f, 0.468391597f},
-std::array<float,2>{0.262191534f, 0.897242308f},
-std::array<float,2>{0.51838237f, 0.786446393f},
-std::array<float,2>{0.429818392f, 0.342968494f},
-std::array<float,2>{0.792469621f, 0.0957988426f},
-std::array<float,2>{0.167896241f, 0.535516918f},
-std::array<float,2>{0.725210011f, 0.610791147f},
-std::array<float,2>{0.366147488f, 0.0440439582f},
-std::array<float,2>{0.93869549f, 0.287748814f},
-std::array<float,2>{0.032464318f, 0.845169246f},
-std::array<float,2>{0.821818173f, 0.994569778f},
-std::array<float,2>{0.217773274f, 0.382611454f},
-std::array<float,2>{0.581065178f, 0.225155771f},
-std::array<float,2>{0.474899381f, 0.704930604f},
-std::array<float,2>{0.868287027f, 0.695906162f},
-std::array<float,2>{0.242985159f, 0.247432157f},
-std::array<float,2>{0.617312968f, 0.403504074f},
-std::array<float,2>{0.462891936f, 0.977968037f},
-std::array<float,2>{0.708319545f, 0.867640495f},
-std::array<float,2>{0.336625248f, 0.298895508f},
-std::array<float,2>{0.996709108f, 0.0564294159f},
-std::array<float,2>{0.0150140058f, 0.60855782f},
-std::array<float,2>{0.548441768f, 0.555660367f},
-std::array<float,2>{0.401081353f, 0.123154663f},
-std::array<float,2>{0.779910028f, 0.317326277f},
-std::array<float,2>{0.146643057f, 0.811844289f},
-std::array<float,2>{0.897166014f, 0.875671983f},
-std::array<float,2>{0.0640006289f, 0.452903897f},
-std::array<float,2>{0.666695535f, 0.16291301f},
-std::array<float,2>{0.307238936f, 0.655072987f},
-std::array<float,2>{0.957176745f, 0.574277401f},
-std::array<float,2>{0.0527657419f, 0.0120742274f},
-std::array<float,2>{0.737891912f, 0.263830096f},
-std::array<float,2>{0.348332763f, 0.839242578f},
-std::array<float,2>{0.572021902f, 0.953506351f},
-std::array<float,2>{0.498866081f, 0.41994226f},
-std::array<float,2>{0.829374492f, 0.202900365f},
-std::array<float,2>{0.194911569f, 0.730969369f},
-std::array<float,2>{0.629946947f, 0.666581094f},
-std::array<float,2>{0.267119735f, 0.150645658f},
-std::array<float,2>{0.906503677f, 0.490084529f},
-std::array<float,2>{0.110231027f, 0.91318047f},
-std::array<float,2>{0.800818682f, 0.779029071f},
-std::array<float,2>{0.184454456f, 0.36255613f},
-std::array<float,2>{0.50618124f, 0.0692839548f},
-std::array<float,2>{0.419332206f, 0.5250054f},
-std::array<float,2>{0.838736117f, 0.598808408f},
-std::array<float,2>{0.201509789f, 0.0527709238f},
-std::array<float,2>{0.566600144f, 0.306051493f},
-std::array<float,2>{0.484715998f, 0.865759254f},
-std::array<float,2>{0.743593335f, 0.974104404f},
-std::array<float,2>{0.358281761f, 0.397140741f},
-std::array<float,2>{0.965870976f, 0.237181634f},
-std::array<float,2>{0.055068817f, 0.690584064f},
-std::array<float,2>{0.513418496f, 0.642937422f},
-std::array<float,2>{0.410968542f, 0.165460885f},
-std::array<float,2>{0.805936992f, 0.444141686f},
-std::array<float,2>{0.173592255f, 0.883938372f},
-std::array<float,2>{0.915187776f, 0.8020913f},
-std::array<float,2>{0.123491272f, 0.323831886f},
-std::array<float,2>{0.638582528f, 0.111608624f},
-std::array<float,2>{0.275780886f, 0.553353071f},
-std::array<float,2>{0.991749942f, 0.722070456f},
-std::array<float,2>{0.000619336497f, 0.191729397f},
-std::array<float,2>{0.717929244f, 0.410939515f},
-std::array<float,2>{0.328842282f, 0.962292075f},
-std::array<float,2>{0.612630367f, 0.83215332f},
-std::array<float,2>{0.460935205f, 0.25222984f},
-std::array<float,2>{0.866389394f, 0.00484265713f},
-std::array<float,2>{0.235394359f, 0.569775701f},
-std::array<float,2>{0.657214105f, 0.517044961f},
-std::array<float,2>{0.299092621f, 0.0729997978f},
-std::array<float,2>{0.90437156f, 0.373526305f},
-std::array<float,2>{0.07533741f, 0.772858024f},
-std::array<float,2>{0.769288599f, 0.916591227f},
-std::array<float,2>{0.151057824f, 0.494220495f},
-std::array<float,2>{0.555782318f, 0.140726283f},
-std::array<float,2>{0.392759293f, 0.660351932f},
-std::array<float,2>{0.782075107f, 0.672985077f},
-std::array<float,2>{0.158819765f, 0.138615847f},
-std::array<float,2>{0.52989769f, 0.47636655f},
-std::array<float,2>{0.425578862f, 0.926602542f},
-std::array<float,2>{0.641000271f, 0.761992991f},
-std::array<float,2>{0.255761445f, 0.358853847f},
-std::array<float,2>{0.935573757f, 0.0879087374f},
-std::array<float,2>{0.101014003f, 0.507598341f},
-std::array<float,2>{0.58722955f, 0.592735529f},
-std::array<float,2>{0.483104825f, 0.0172901526f},
-std::array<float,2>{0.819933236f, 0.280936509f},
-std::array<float,2>{0.206138179f, 0.815869987f},
-std::array<float,2>{0.945951641f, 0.942646801f},
-std::array<float,2>{0.0460511111f, 0.433464974f},
-std::array<float,2>{0.732769847f, 0.216359258f},
-std::array<float,2>{0.370847642f, 0.738375187f},
-std::array<float,2>{0.882237196f, 0.543503821f},
-std::array<float,2>{0.087421827f, 0.107812762f},
-std::array<float,2>{0.684242845f, 0.335836172f},
-std::array<float,2>{0.288931459f, 0.790290534f},
-std::array<float,2>{0.535304129f, 0.903655469f},
-std::array<float,2>{0.387240857f, 0.456741959f},
-std::array<float,2>{0.758523107f, 0.180366829f},
-std::array<float,2>{0.12664938f, 0.628557682f},
-std::array<float,2>{0.687813878f, 0.716307223f},
-std::array<float,2>{0.319334f, 0.228222907f},
-std::array<float,2>{0.97600311f, 0.385698467f},
-std::array<float,2>{0.0208038557f, 0.986635089f},
-std::array<float,2>{0.844062865f, 0.858359575f},
-std::array<float,2>{0.234145433f, 0.292667389f},
-std::array<float,2>{0.593775511f, 0.03149404f},
-std::array<float,2>{0.441740453f, 0.619690657f},
-std::array<float,2>{0.854781508f, 0.550750256f},
-std::array<float,2>{0.224139988f, 0.116636463f},
-std::array<float,2>{0.607864559f, 0.3278974f},
-std::array<float,2>{0.448610842f, 0.799350739f},
-std::array<float,2>{0.698224068f, 0.890452385f},
-std::array<float,2>{0.324634999f, 0.437617034f},
-std::array<float,2>{0.984357655f, 0.170040637f},
-std::array<float,2>{0.0277155954f, 0.645595133f},
-std::array<float,2>{0.54454118f, 0.693874061f},
-std::array<float,2>{0.376035839f, 0.239458635f},
-std::array<float,2>{0.757080734f, 0.393102914f},
-std::array<float,2>{0.136752188f, 0.970408499f},
-std::array<float,2>{0.887584805f, 0.859894633f},
-std::array<float,2>{0.0839278549f, 0.31246838f},
-std::array<float,2>{0.672019005f, 0.0493160486f},
-std::array<float,2>{0.293706656f, 0.5973472f},
-std::array<float,2>{0.941958368f, 0.659269631f},
-std::array<float,2>{0.0354227088f, 0.144533262f},
-std::array<float,2>{0.720171809f, 0.499302566f},
-std::array<float,2>{0.359698683f, 0.919615209f},
-std::array<float,2>{0.585316598f, 0.767727077f},
-std::array<float,2>{0.471214652f, 0.369023681f},
-std::array<float,2>{0.825901568f, 0.0743396953f},
-std::array<float,2>{0.211314559f, 0.520094454f},
-std::array<float,2>{0.648527026f, 0.563375473f},
-std::array<float,2>{0.257858604f, 0.00184113462f},
-std::array<float,2>{0.924503326f, 0.256736845f},
-std::array<float,2>{0.105523422f, 0.828912497f},
-std::array<float,2>{0.794657111f, 0.966115117f},
-std::array<float,2>{0.170001805f, 0.407940567f},
-std::array<float,2>{0.520419955f, 0.191202149f},
-std::array<float,2>{0.434110731f, 0.726057708f},
-std::array<float,2>{0.774278224f, 0.734676123f},
-std::array<float,2>{0.143346459f, 0.211893812f},
-std::array<float,2>{0.550913751f, 0.435755283f},
-std::array<float,2>{0.404475957f, 0.939487517f},
-std::array<float,2>{0.669780493f, 0.81648612f},
-std::array<float,2>{0.312429637f, 0.276464403f},
-std::array<float,2>{0.894379795f, 0.0211260002f},
-std::array<float,2>{0.0672892332f, 0.589815974f},
-std::array<float,2>{0.624773204f, 0.502729058f},
-std::array<float,2>{0.465786904f, 0.091811046f},
-std::array<float,2>{0.872667551f, 0.352488041f},
-std::array<float,2>{0.247125f, 0.761428416f},
-std::array<float,2>{0.995356381f, 0.925374687f},
-std::array<float,2>{0.0102402279f, 0.47002092f},
-std::array<float,2>{0.703240633f, 0.133210495f},
-std::array<float,2>{0.341951907f, 0.677770853f},
-std::array<float,2>{0.910453558f, 0.621242523f},
-std::array<float,2>{0.116300054f, 0.03804392f},
-std::array<float,2>{0.627489626f, 0.294591159f},
-std::array<float,2>{0.2733877f, 0.853768766f},
-std::array<float,2>{0.500927389f, 0.98989296f},
-std::array<float,2>{0.417643875f, 0.388628989f},
-std::array<float,2>{0.799430907f, 0.232052103f},
-std::array<float,2>{0.18081224f, 0.711668849f},
-std::array<float,2>{0.740776241f, 0.629059136f},
-std::array<float,2>{0.346461922f, 0.185841024f},
-std::array<float,2>{0.953430951f, 0.460844606f},
-std::array<float,2>{0.0469488502f, 0.902320147f},
-std::array<float,2>{0.833672822f, 0.79677403f},
-std::array<float,2>{0.189621732f, 0.329344958f},
-std::array<float,2>{0.577087641f, 0.104291879f},
-std::array<float,2>{0.492504209f, 0.54177326f},
-std::array<float,2>{0.810597897f, 0.583070099f},
-std::array<float,2>{0.177442461f, 0.0289472695f},
-std::array<float,2>{0.511692345f, 0.267415315f},
-std::array<float,2>{0.408492714f, 0.820896268f},
-std::array<float,2>{0.632962644f, 0.94705236f},
-std::array<float,2>{0.281120718f, 0.42609027f},
-std::array<float,2>{0.918050826f, 0.203898773f},
-std::array<float,2>{0.11873357f, 0.74391669f},
-std::array<float,2>{0.562513232f, 0.680075467f},
-std::array<float,2>{0.488924026f, 0.129405141f},
-std::array<float,2>{0.842579663f, 0.482473314f},
-std::array<float,2>{0.197389022f, 0.936724305f},
-std::array<float,2>{0.963394165f, 0.755389512f},
-std::array<float,2>{0.0592588522f, 0.349666774f},
-std::array<float,2>{0.748652458f, 0.0807500333f},
-std::array<float,2>{0.353460759f, 0.508483708f},
-std::array<float,2>{0.8990587f, 0.707355499f},
-std::array<float,2>{0.0719922483f, 0.219133928f},
-std::array<float,2>{0.663239121f, 0.378311187f},
-std::array<float,2>{0.303254455f, 0.996353865f},
-std::array<float,2>{0.55916214f, 0.850521505f},
-std::array<float,2>{0.395491272f, 0.28371805f},
-std::array<float,2>{0.773058116f, 0.0425863974f},
-std::array<float,2>{0.152882293f, 0.613641977f},
-std::array<float,2>{0.713879645f, 0.534536541f},
-std::array<float,2>{0.335762024f, 0.100532554f},
-std::array<float,2>{0.986218035f, 0.338675112f},
-std::array<float,2>{0.00677391887f, 0.784828365f},
-std::array<float,2>{0.860382199f, 0.890701413f},
-std::array<float,2>{0.240664288f, 0.462291956f},
-std::array<float,2>{0.613588393f, 0.171922565f},
-std::array<float,2>{0.453840494f, 0.632956564f},
-std::array<float,2>{0.81298691f, 0.652193129f},
-std::array<float,2>{0.209393293f, 0.156953782f},
-std::array<float,2>{0.591223776f, 0.447532684f},
-std::array<float,2>{0.477965832f, 0.879601002f},
-std::array<float,2>{0.727568865f, 0.805936158f},
-std::array<float,2>{0.372586787f, 0.312644333f},
-std::array<float,2>{0.952542305f, 0.120142065f},
-std::array<float,2>{0.0418511294f, 0.561570525f},
-std::array<float,2>{0.524605632f, 0.603671372f},
-std::array<float,2>{0.429586709f, 0.0604857206f},
-std::array<float,2>{0.788182139f, 0.30344519f},
-std::array<float,2>{0.160515904f, 0.873252451f},
-std::array<float,2>{0.930742443f, 0.98096174f},
-std::array<float,2>{0.0974556506f, 0.401476473f},
-std::array<float,2>{0.645964563f, 0.245622426f},
-std::array<float,2>{0.253139824f, 0.702663124f},
-std::array<float,2>{0.969514906f, 0.530578971f},
-std::array<float,2>{0.0165109597f, 0.0636269301f},
-std::array<float,2>{0.695290029f, 0.36436981f},
-std::array<float,2>{0.31446895f, 0.773605824f},
-std::array<float,2>{0.600632131f, 0.90768975f},
-std::array<float,2>{0.438130051f, 0.48535803f},
-std::array<float,2>{0.850496352f, 0.155783579f},
-std::array<float,2>{0.228246257f, 0.668013692f},
-std::array<float,2>{0.680493355f, 0.727624238f},
-std::array<float,2>{0.285068959f, 0.196004644f},
-std::array<float,2>{0.877848625f, 0.415073484f},
-std::array<float,2>{0.0901750401f, 0.958386958f},
-std::array<float,2>{0.763205171f, 0.842411041f},
-std::array<float,2>{0.132786795f, 0.258474469f},
-std::array<float,2>{0.533313036f, 0.00998078473f},
-std::array<float,2>{0.384203047f, 0.574006915f},
-std::array<float,2>{0.789070666f, 0.537932336f},
-std::array<float,2>{0.165655762f, 0.0947380438f},
-std::array<float,2>{0.516094327f, 0.339866191f},
-std::array<float,2>{0.432914048f, 0.788626194f},
-std::array<float,2>{0.655357778f, 0.895078719f},
-std::array<float,2>{0.264806002f, 0.46672529f},
-std::array<float,2>{0.925976038f, 0.176118016f},
-std::array<float,2>{0.104912497f, 0.637666464f},
-std::array<float,2>{0.579096556f, 0.706672728f},
-std::array<float,2>{0.47396034f, 0.223589957f},
-std::array<float,2>{0.824038565f, 0.379041314f},
-std::array<float,2>{0.216089755f, 0.992235959f},
-std::array<float,2>{0.940683544f, 0.846899986f},
-std::array<float,2>{0.0337585807f, 0.286671311f},
-std::array<float,2>{0.72407198f, 0.0464496724f},
-std::array<float,2>{0.36488086f, 0.61233294f},
-std::array<float,2>{0.886405587f, 0.687331975f},
-std::array<float,2>{0.079758659f, 0.126214787f},
-std::array<float,2>{0.677704751f, 0.479136795f},
-std::array<float,2>{0.289524913f, 0.93047899f},
-std::array<float,2>{0.539854527f, 0.750633478f},
-std::array<float,2>{0.382499158f, 0.346868962f},
-std::array<float,2>{0.751356244f, 0.0837024227f},
-std::array<float,2>{0.133142531f, 0.513545096f},
-std::array<float,2>{0.702122986f, 0.579586744f},
-std::array<float,2>{0.323869586f, 0.0248854086f},
-std::array<float,2>{0.979559898f, 0.272846669f},
-std::array<float,2>{0.0250102673f, 0.828009903f},
-std::array<float,2>{0.855489433f, 0.950531244f},
-std::array<float,2>{0.219086736f, 0.425361991f},
-std::array<float,2>{0.604565978f, 0.208506897f},
-std::array<float,2>{0.453102797f, 0.749230027f},
-std::array<float,2>{0.831825018f, 0.733901262f},
-std::array<float,2>{0.192913204f, 0.200691983f},
-std::array<float,2>{0.572720945f, 0.418045133f},
-std::array<float,2>{0.496174693f, 0.956141651f},
-std::array<float,2>{0.734517872f, 0.837429821f},
-std::array<float,2>{0.350091517f, 0.261989892f},
-std::array<float,2>{0.960197091f, 0.0136721125f},
-std::array<float,2>{0.052619677f, 0.576474786f},
-std::array<float,2>{0.503941357f, 0.525400877f},
-std::array<float,2>{0.421839476f, 0.0678663775f},
-std::array<float,2>{0.802942812f, 0.360917985f},
-std::array<float,2>{0.187187463f, 0.780085742f},
-std::array<float,2>{0.908923745f, 0.912003934f},
-std::array<float,2>{0.111967511f, 0.490922332f},
-std::array<float,2>{0.632423162f, 0.150070712f},
-std::array<float,2>{0.268225491f, 0.664782882f},
-std::array<float,2>{0.999909341f, 0.606745243f},
-std::array<float,2>{0.0120672649f, 0.0578799024f},
-std::array<float,2>{0.709403515f, 0.298676401f},
-std::array<float,2>{0.338141918f, 0.869965553f},
-std::array<float,2>{0.619682074f, 0.978640914f},
-std::array<float,2>{0.461985976f, 0.406017244f},
-std::array<float,2>{0.870749176f, 0.249322236f},
-std::array<float,2>{0.244261667f, 0.698065519f},
-std::array<float,2>{0.665188372f, 0.652938366f},
-std::array<float,2>{0.305890948f, 0.1610834f},
-std::array<float,2>{0.895303667f, 0.450599641f},
-std::array<float,2>{0.0648352131f, 0.877030551f},
-std::array<float,2>{0.777952671f, 0.808916509f},
-std::array<float,2>{0.146379411f, 0.31912908f},
-std::array<float,2>{0.549112856f, 0.122986533f},
-std::array<float,2>{0.399461925f, 0.557502985f},
-std::array<float,2>{0.863282561f, 0.568313479f},
-std::array<float,2>{0.236838922f, 0.00667214952f},
-std::array<float,2>{0.610935986f, 0.251618356f},
-std::array<float,2>{0.458876312f, 0.835272789f},
-std::array<float,2>{0.716234863f, 0.963818848f},
-std::array<float,2>{0.331583083f, 0.413278639f},
-std::array<float,2>{0.989305615f, 0.193899691f},
-std::array<float,2>{0.00245270738f, 0.720187068f},
-std::array<float,2>{0.55815208f, 0.66293484f},
-std::array<float,2>{0.39157638f, 0.143337667f},
-std::array<float,2>{0.766487896f, 0.492981613f},
-std::array<float,2>{0.149559125f, 0.915966034f},
-std::array<float,2>{0.904250741f, 0.771301866f},
-std::array<float,2>{0.0766709819f, 0.372855246f},
-std::array<float,2>{0.658295155f, 0.0710243955f},
-std::array<float,2>{0.297901899f, 0.518671453f},
-std::array<float,2>{0.968562722f, 0.688720942f},
-std::array<float,2>{0.05739199f, 0.235937119f},
-std::array<float,2>{0.744257689f, 0.394652873f},
-std::array<float,2>{0.355834007f, 0.97468251f},
-std::array<float,2>{0.569481969f, 0.86513555f},
-std::array<float,2>{0.487747878f, 0.308078259f},
-std::array<float,2>{0.837686598f, 0.0508006327f},
-std::array<float,2>{0.200749606f, 0.600802064f},
-std::array<float,2>{0.639514923f, 0.551466763f},
-std::array<float,2>{0.274673641f, 0.11032173f},
-std::array<float,2>{0.916704178f, 0.320495665f},
-std::array<float,2>{0.121679015f, 0.804058194f},
-std::array<float,2>{0.808412433f, 0.886625648f},
-std::array<float,2>{0.175241128f, 0.443353742f},
-std::array<float,2>{0.514954865f, 0.166867211f},
-std::array<float,2>{0.413927019f, 0.641678572f},
-std::array<float,2>{0.760939837f, 0.625626028f},
-std::array<float,2>{0.127386153f, 0.183308944f},
-std::array<float,2>{0.538968563f, 0.455065936f},
-std::array<float,2>{0.389808446f, 0.906080425f},
-std::array<float,2>{0.686860323f, 0.792198658f},
-std::array<float,2>{0.2866005f, 0.333976895f},
-std::array<float,2>{0.880813241f, 0.107355341f},
-std::array<float,2>{0.0895075649f, 0.546263993f},
-std::array<float,2>{0.596851051f, 0.617686808f},
-std::array<float,2>{0.445248634f, 0.0334608369f},
-std::array<float,2>{0.84654969f, 0.289990306f},
-std::array<float,2>{0.231004283f, 0.857323825f},
-std::array<float,2>{0.974024117f, 0.985996723f},
-std::array<float,2>{0.0231291819f, 0.384632081f},
-std::array<float,2>{0.68951118f, 0.230295643f},
-std::array<float,2>{0.317904651f, 0.717803359f},
-std::array<float,2>{0.935069203f, 0.505559504f},
-std::array<float,2>{0.0994834155f, 0.0867125094f},
-std::array<float,2>{0.643104732f, 0.356460124f},
-std::array<float,2>{0.257593364f, 0.764607728f},
-std::array<float,2>{0.52853334f, 0.929037035f},
-std::array<float,2>{0.422792614f, 0.474555403f},
-std::array<float,2>{0.784398496f, 0.139659598f},
-std::array<float,2>{0.157161132f, 0.67520076f},
-std::array<float,2>{0.732183278f, 0.742132246f},
-std::array<float,2>{0.368577003f, 0.218665987f},
-std::array<float,2>{0.949105442f, 0.431070447f},
-std::array<float,2>{0.0430973805f, 0.944572151f},
-std::array<float,2>{0.817320168f, 0.813129127f},
-std::array<float,2>{0.204677865f, 0.277379125f},
-std::array<float,2>{0.589195907f, 0.0176720396f},
-std::array<float,2>{0.481603026f, 0.591133773f},
-std::array<float,2>{0.827608347f, 0.523094475f},
-std::array<float,2>{0.213688657f, 0.0771947652f},
-std::array<float,2>{0.582699418f, 0.370908976f},
-std::array<float,2>{0.469259977f, 0.767262757f},
-std::array<float,2>{0.721253932f, 0.921388388f},
-std::array<float,2>{0.362341404f, 0.49674058f},
-std::array<float,2>{0.944800317f, 0.147951007f},
-std::array<float,2>{0.0387528576f, 0.656409562f},
-std::array<float,2>{0.522390127f, 0.723388672f},
-std::array<float,2>{0.436647594f, 0.188729286f},
-std::array<float,2>{0.796497464f, 0.409349442f},
-std::array<float,2>{0.169867039f, 0.968492627f},
-std::array<float,2>{0.923071086f, 0.830397725f},
-std::array<float,2>{0.107682362f, 0.255657017f},
-std::array<float,2>{0.651759326f, 0.00316404272f},
-std::array<float,2>{0.260960013f, 0.565458775f},
-std::array<float,2>{0.981446505f, 0.648245692f},
-std::array<float,2>{0.0302971806f, 0.16911611f},
-std::array<float,2>{0.696545303f, 0.43960312f},
-std::array<float,2>{0.326735735f, 0.888329208f},
-std::array<float,2>{0.606270492f, 0.79695189f},
-std::array<float,2>{0.445956945f, 0.325684577f},
-std::array<float,2>{0.853081107f, 0.114746444f},
-std::array<float,2>{0.224800587f, 0.547195256f},
-std::array<float,2>{0.675259352f, 0.594643176f},
-std::array<float,2>{0.296552211f, 0.0487481803f},
-std::array<float,2>{0.889276385f, 0.30917713f},
-std::array<float,2>{0.0842174962f, 0.861858606f},
-std::array<float,2>{0.754808605f, 0.971346974f},
-std::array<float,2>{0.138940826f, 0.391934842f},
-std::array<float,2>{0.545820415f, 0.242085204f},
-std::array<float,2>{0.377250284f, 0.69161123f},
-std::array<float,2>{0.79877162f, 0.713783264f},
-std::array<float,2>{0.183561042f, 0.23316963f},
-std::array<float,2>{0.503542304f, 0.390409887f},
-std::array<float,2>{0.414191753f, 0.992181242f},
-std::array<float,2>{0.625813365f, 0.852763116f},
-std::array<float,2>{0.270396441f, 0.296640664f},
-std::array<float,2>{0.913597822f, 0.0357611887f},
-std::array<float,2>{0.11400111f, 0.623813272f},
-std::array<float,2>{0.575077057f, 0.539521098f},
-std::array<float,2>{0.495483816f, 0.103304751f},
-std::array<float,2>{0.834981263f, 0.33057344f},
-std::array<float,2>{0.188941106f, 0.794199169f},
-std::array<float,2>{0.955943644f, 0.90031904f},
-std::array<float,2>{0.0494806021f, 0.457050025f},
-std::array<float,2>{0.739843845f, 0.184842899f},
-std::array<float,2>{0.344134629f, 0.632546723f},
-std::array<float,2>{0.890670002f, 0.586585224f},
-std::array<float,2>{0.0696735606f, 0.0222407524f},
-std::array<float,2>{0.670537174f, 0.275352716f},
-std::array<float,2>{0.309525043f, 0.819955111f},
-std::array<float,2>{0.552770734f, 0.939084649f},
-std::array<float,2>{0.403293192f, 0.433780909f},
-std::array<float,2>{0.777191222f, 0.21479024f},
-std::array<float,2>{0.140661106f, 0.738066256f},
-std::array<float,2>{0.705616951f, 0.677086174f},
-std::array<float,2>{0.340149581f, 0.136370197f},
-std::array<float,2>{0.99329704f, 0.472380996f},
-std::array<float,2>{0.00915983506f, 0.922927976f},
-std::array<float,2>{0.873652697f, 0.758525848f},
-std::array<float,2>{0.249799445f, 0.354019076f},
-std::array<float,2>{0.622089922f, 0.0907590687f},
-std::array<float,2>{0.467207909f, 0.501467705f},
-std::array<float,2>{0.770933867f, 0.616709411f},
-std::array<float,2>{0.1558332f, 0.0407365486f},
-std::array<float,2>{0.561228096f, 0.28175053f},
-std::array<float,2>{0.39843145f, 0.848905385f},
-std::array<float,2>{0.661940277f, 0.998560488f},
-std::array<float,2>{0.301727682f, 0.375068396f},
-std::array<float,2>{0.90162015f, 0.221908614f},
-std::array<float,2>{0.0732468888f, 0.71023035f},
-std::array<float,2>{0.616761148f, 0.635578394f},
-std::array<float,2>{0.456863463f, 0.1740738f},
-std::array<float,2>{0.861665726f, 0.463474482f},
-std::array<float,2>{0.238924861f, 0.892668307f},
-std::array<float,2>{0.98745358f, 0.782729685f},
-std::array<float,2>{0.0049485974f, 0.337836951f},
-std::array<float,2>{0.711682856f, 0.0990994051f},
-std::array<float,2>{0.332800388f, 0.532098591f},
-std::array<float,2>{0.920688868f, 0.745571136f},
-std::array<float,2>{0.120582595f, 0.205954865f},
-std::array<float,2>{0.636052668f, 0.429665357f},
-std::array<float,2>{0.278345615f, 0.948534012f},
-std::array<float,2>{0.509038031f, 0.822338223f},
-std::array<float,2>{0.407300651f, 0.268080592f},
-std::array<float,2>{0.809464216f, 0.0305848159f},
-std::array<float,2>{0.177805915f, 0.584060431f},
-std::array<float,2>{0.746556818f, 0.510630012f},
-std::array<float,2>{0.354665399f, 0.0785177872f},
-std::array<float,2>{0.961448014f, 0.348247647f},
-std::array<float,2>{0.0610826798f, 0.757354319f},
-std::array<float,2>{0.841700137f, 0.934510648f},
-std::array<float,2>{0.19678545f, 0.480699092f},
-std::array<float,2>{0.564961493f, 0.131038561f},
-std::array<float,2>{0.490263224f, 0.682816088f},
-std::array<float,2>{0.847974181f, 0.670498013f},
-std::array<float,2>{0.229865938f, 0.153965265f},
-std::array<float,2>{0.59946543f, 0.486710846f},
-std::array<float,2>{0.440672219f, 0.908232689f},
-std::array<float,2>{0.692983329f, 0.775457323f},
-std::array<float,2>{0.312877238f, 0.365881026f},
-std::array<float,2>{0.97237134f, 0.0645535812f},
-std::array<float,2>{0.0176191926f, 0.527633309f},
-std::array<float,2>{0.532478273f, 0.571819484f},
-std::array<float,2>{0.386021107f, 0.0080400221f},
-std::array<float,2>{0.764834642f, 0.260949492f},
-std::array<float,2>{0.129618555f, 0.841237485f},
-std::array<float,2>{0.875562668f, 0.95911634f},
-std::array<float,2>{0.0928064659f, 0.416946799f},
-std::array<float,2>{0.68236959f, 0.198782697f},
-std::array<float,2>{0.282553107f, 0.729080915f},
-std::array<float,2>{0.950867891f, 0.5604617f},
-std::array<float,2>{0.0404534489f, 0.117292643f},
-std::array<float,2>{0.728683114f, 0.314532578f},
-std::array<float,2>{0.374149442f, 0.80785352f},
-std::array<float,2>{0.593401492f, 0.881211996f},
-std::array<float,2>{0.480275363f, 0.44622007f},
-std::array<float,2>{0.815055668f, 0.158812091f},
-std::array<float,2>{0.207741842f, 0.648676157f},
-std::array<float,2>{0.647879064f, 0.699472368f},
-std::array<float,2>{0.251735151f, 0.242278278f},
-std::array<float,2>{0.932835042f, 0.400362074f},
-std::array<float,2>{0.0956914797f, 0.983904898f},
-std::array<float,2>{0.786997914f, 0.87261337f},
-std::array<float,2>{0.162599966f, 0.3023552f},
-std::array<float,2>{0.526979029f, 0.0623079389f},
-std::array<float,2>{0.426588923f, 0.60278523f},
-std::array<float,2>{0.758080006f, 0.546562016f},
-std::array<float,2>{0.12641263f, 0.106812961f},
-std::array<float,2>{0.535955727f, 0.333068818f},
-std::array<float,2>{0.387188077f, 0.792744398f},
-std::array<float,2>{0.683595002f, 0.905641556f},
-std::array<float,2>{0.288225323f, 0.454429626f},
-std::array<float,2>{0.882619679f, 0.182758719f},
-std::array<float,2>{0.0869493783f, 0.625234902f},
-std::array<float,2>{0.59453541f, 0.718407154f},
-std::array<float,2>{0.442230314f, 0.229669705f},
-std::array<float,2>{0.844717741f, 0.384241372f},
-std::array<float,2>{0.233696431f, 0.985546112f},
-std::array<float,2>{0.976228297f, 0.856525719f},
-std::array<float,2>{0.0211875383f, 0.289548427f},
-std::array<float,2>{0.688106835f, 0.0338237509f},
-std::array<float,2>{0.318659514f, 0.617621899f},
-std::array<float,2>{0.936441839f, 0.675540745f},
-std::array<float,2>{0.10117951f, 0.140439272f},
-std::array<float,2>{0.641502261f, 0.473836213f},
-std::array<float,2>{0.255128682f, 0.929255903f},
-std::array<float,2>{0.529656291f, 0.763713181f},
-std::array<float,2>{0.425143749f, 0.357045054f},
-std::array<float,2>{0.781370938f, 0.0859399214f},
-std::array<float,2>{0.158308059f, 0.505351007f},
-std::array<float,2>{0.732922852f, 0.591656566f},
-std::array<float,2>{0.370477974f, 0.0180977713f},
-std::array<float,2>{0.945470214f, 0.278274894f},
-std::array<float,2>{0.0466782749f, 0.812801003f},
-std::array<float,2>{0.819380999f, 0.944857299f},
-std::array<float,2>{0.206611335f, 0.431405276f},
-std::array<float,2>{0.587422788f, 0.217819855f},
-std::array<float,2>{0.482743293f, 0.741652906f},
-std::array<float,2>{0.86711818f, 0.720336795f},
-std::array<float,2>{0.236036927f, 0.19375442f},
-std::array<float,2>{0.613233209f, 0.413765192f},
-std::array<float,2>{0.460140735f, 0.963318408f},
-std::array<float,2>{0.718520939f, 0.835881114f},
-std::array<float,2>{0.328142703f, 0.251431674f},
-std::array<float,2>{0.991681933f, 0.00587218581f},
-std::array<float,2>{0.000448783481f, 0.567736387f},
-std::array<float,2>{0.556270778f, 0.519117117f},
-std::array<float,2>{0.393191695f, 0.0706709176f},
-std::array<float,2>{0.768790126f, 0.372354805f},
-std::array<float,2>{0.150477633f, 0.770640731f},
-std::array<float,2>{0.905049026f, 0.915171087f},
-std::array<float,2>{0.0760279074f, 0.492414773f},
-std::array<float,2>{0.65661931f, 0.142698228f},
-std::array<float,2>{0.299565524f, 0.662276149f},
-std::array<float,2>{0.966708422f, 0.601540267f},
-std::array<float,2>{0.0554503538f, 0.0514373034f},
-std::array<float,2>{0.743779361f, 0.308486044f},
-std::array<float,2>{0.357550561f, 0.864628792f},
-std::array<float,2>{0.567239702f, 0.975288808f},
-std::array<float,2>{0.485038429f, 0.395333081f},
-std::array<float,2>{0.838006198f, 0.235594183f},
-std::array<float,2>{0.20199354f, 0.689214528f},
-std::array<float,2>{0.638176382f, 0.642121494f},
-std::array<float,2>{0.276139498f, 0.166469082f},
-std::array<float,2>{0.915745676f, 0.442861229f},
-std::array<float,2>{0.123850249f, 0.886169493f},
-std::array<float,2>{0.806289613f, 0.804636359f},
-std::array<float,2>{0.173059911f, 0.320909113f},
-std::array<float,2>{0.513125122f, 0.109828085f},
-std::array<float,2>{0.410462916f, 0.55101794f},
-std::array<float,2>{0.829874814f, 0.576817393f},
-std::array<float,2>{0.19479531f, 0.0143019417f},
-std::array<float,2>{0.571515501f, 0.262695253f},
-std::array<float,2>{0.498431444f, 0.837006748f},
-std::array<float,2>{0.737535954f, 0.956651568f},
-std::array<float,2>{0.347845197f, 0.418469578f},
-std::array<float,2>{0.957549334f, 0.200644568f},
-std::array<float,2>{0.0536742955f, 0.733585835f},
-std::array<float,2>{0.506787717f, 0.664132714f},
-std::array<float,2>{0.419652164f, 0.149534926f},
-std::array<float,2>{0.801708102f, 0.490587294f},
-std::array<float,2>{0.183809936f, 0.911420047f},
-std::array<float,2>{0.90721792f, 0.779563904f},
-std::array<float,2>{0.109510697f, 0.360584855f},
-std::array<float,2>{0.630697489f, 0.0682522729f},
-std::array<float,2>{0.266818345f, 0.526108265f},
-std::array<float,2>{0.996442378f, 0.697574019f},
-std::array<float,2>{0.0152473012f, 0.249981552f},
-std::array<float,2>{0.708598793f, 0.405499429f},
-std::array<float,2>{0.336351722f, 0.979491591f},
-std::array<float,2>{0.618062794f, 0.869171739f},
-std::array<float,2>{0.463773489f, 0.298097819f},
-std::array<float,2>{0.868683517f, 0.0583162233f},
-std::array<float,2>{0.242369071f, 0.607238352f},
-std::array<float,2>{0.666111171f, 0.556696475f},
-std::array<float,2>{0.306765586f, 0.122303993f},
-std::array<float,2>{0.896903634f, 0.318367094f},
-std::array<float,2>{0.0636236444f, 0.80931294f},
-std::array<float,2>{0.779578865f, 0.87756747f},
-std::array<float,2>{0.14716123f, 0.450998098f},
-std::array<float,2>{0.547945142f, 0.160190403f},
-std::array<float,2>{0.400628507f, 0.652708709f},
-std::array<float,2>{0.792759776f, 0.6368801f},
-std::array<float,2>{0.167368978f, 0.176665366f},
-std::array<float,2>{0.517851889f, 0.466112286f},
-std::array<float,2>{0.430647105f, 0.894960284f},
-std::array<float,2>{0.653802395f, 0.788572013f},
-std::array<float,2>{0.262610018f, 0.340706229f},
-std::array<float,2>{0.928640127f, 0.0955222547f},
-std::array<float,2>{0.101615511f, 0.537316859f},
-std::array<float,2>{0.581659257f, 0.612868786f},
-std::array<float,2>{0.475498706f, 0.0463520363f},
-std::array<float,2>{0.821445644f, 0.286495f},
-std::array<float,2>{0.21686247f, 0.847509563f},
-std::array<float,2>{0.939408779f, 0.992856443f},
-std::array<float,2>{0.0329831354f, 0.37954092f},
-std::array<float,2>{0.724803686f, 0.222933382f},
-std::array<float,2>{0.365533799f, 0.706156552f},
-std::array<float,2>{0.883364022f, 0.51300174f},
-std::array<float,2>{0.0803984031f, 0.08332178f},
-std::array<float,2>{0.678450167f, 0.347347319f},
-std::array<float,2>{0.291927874f, 0.750210583f},
-std::array<float,2>{0.541104138f, 0.930169523f},
-std::array<float,2>{0.379085481f, 0.478825301f},
-std::array<float,2>{0.7525962f, 0.126776129f},
-std::array<float,2>{0.13651289f, 0.686885834f},
-std::array<float,2>{0.700164199f, 0.749798059f},
-std::array<float,2>{0.320689291f, 0.208170086f},
-std::array<float,2>{0.976811707f, 0.424954444f},
-std::array<float,2>{0.0254815053f, 0.951009512f},
-std::array<float,2>{0.85765034f, 0.82724148f},
-std::array<float,2>{0.22141616f, 0.273427129f},
-std::array<float,2>{0.60244751f, 0.0253724754f},
-std::array<float,2>{0.449407101f, 0.579943597f},
-std::array<float,2>{0.850061059f, 0.528151333f},
-std::array<float,2>{0.227694407f, 0.0653872266f},
-std::array<float,2>{0.601477325f, 0.365369111f},
-std::array<float,2>{0.437534004f, 0.77602154f},
-std::array<float,2>{0.694686532f, 0.90870434f},
-std::array<float,2>{0.315165699f, 0.486969531f},
-std::array<float,2>{0.969109595f, 0.153710768f},
-std::array<float,2>{0.0158042982f, 0.670157075f},
-std::array<float,2>{0.533759952f, 0.728839159f},
-std::array<float,2>{0.384715199f, 0.198269561f},
-std::array<float,2>{0.763125837f, 0.416426957f},
-std::array<float,2>{0.13217321f, 0.9597857f},
-std::array<float,2>{0.877421737f, 0.841794372f},
-std::array<float,2>{0.0906520113f, 0.261337429f},
-std::array<float,2>{0.680074632f, 0.00846765377f},
-std::array<float,2>{0.284552723f, 0.57129854f},
-std::array<float,2>{0.952829301f, 0.649261415f},
-std::array<float,2>{0.0413374491f, 0.15855135f},
-std::array<float,2>{0.728286684f, 0.445740074f},
-std::array<float,2>{0.372162551f, 0.881789744f},
-std::array<float,2>{0.591483831f, 0.808134615f},
-std::array<float,2>{0.478378385f, 0.315273494f},
-std::array<float,2>{0.813413382f, 0.11771211f},
-std::array<float,2>{0.209793121f, 0.560055852f},
-std::array<float,2>{0.646399319f, 0.603414953f},
-std::array<float,2>{0.253538162f, 0.0617842637f},
-std::array<float,2>{0.931251943f, 0.302085608f},
-std::array<float,2>{0.0968808085f, 0.872070909f},
-std::array<float,2>{0.788668573f, 0.983690023f},
-std::array<float,2>{0.160972431f, 0.399846584f},
-std::array<float,2>{0.525153637f, 0.243036032f},
-std::array<float,2>{0.428786576f, 0.700083494f},
-std::array<float,2>{0.772539079f, 0.710918844f},
-std::array<float,2>{0.152564406f, 0.222606093f},
-std::array<float,2>{0.558755994f, 0.375767559f},
-std::array<float,2>{0.394639462f, 0.998343885f},
-std::array<float,2>{0.663960695f, 0.849164546f},
-std::array<float,2>{0.303012908f, 0.281429261f},
-std::array<float,2>{0.898535013f, 0.040421553f},
-std::array<float,2>{0.0715045109f, 0.616567016f},
-std::array<float,2>{0.61398232f, 0.53127104f},
-std::array<float,2>{0.453388989f, 0.0994425043f},
-std::array<float,2>{0.861213446f, 0.337231934f},
-std::array<float,2>{0.240978345f, 0.782374859f},
-std::array<float,2>{0.985776305f, 0.893450558f},
-std::array<float,2>{0.0063265427f, 0.463289887f},
-std::array<float,2>{0.714702725f, 0.174572662f},
-std::array<float,2>{0.335365891f, 0.63504225f},
-std::array<float,2>{0.918755651f, 0.584901035f},
-std::array<float,2>{0.118483186f, 0.0311712101f},
-std::array<float,2>{0.633674562f, 0.267700851f},
-std::array<float,2>{0.280602813f, 0.823163509f},
-std::array<float,2>{0.51116854f, 0.949209273f},
-std::array<float,2>{0.408927828f, 0.428845972f},
-std::array<float,2>{0.811296582f, 0.205257118f},
-std::array<float,2>{0.176964745f, 0.745752871f},
-std::array<float,2>{0.748354375f, 0.683510959f},
-std::array<float,2>{0.352772355f, 0.131457761f},
-std::array<float,2>{0.962896347f, 0.48096475f},
-std::array<float,2>{0.058866851f, 0.934042573f},
-std::array<float,2>{0.841939628f, 0.757023633f},
-std::array<float,2>{0.197805941f, 0.34767884f},
-std::array<float,2>{0.563016236f, 0.0788453445f},
-std::array<float,2>{0.488527596f, 0.509780288f},
-std::array<float,2>{0.799235582f, 0.623374045f},
-std::array<float,2>{0.181204319f, 0.0356372595f},
-std::array<float,2>{0.500070632f, 0.295992911f},
-std::array<float,2>{0.417265356f, 0.853447795f},
-std::array<float,2>{0.627021611f, 0.991264224f},
-std::array<float,2>{0.272911936f, 0.390062928f},
-std::array<float,2>{0.910761952f, 0.232848078f},
-std::array<float,2>{0.11696621f, 0.713058352f},
-std::array<float,2>{0.576276422f, 0.632312298f},
-std::array<float,2>{0.493127942f, 0.185147136f},
-std::array<float,2>{0.833192289f, 0.457831651f},
-std::array<float,2>{0.189984664f, 0.899696529f},
-std::array<float,2>{0.953787625f, 0.794637978f},
-std::array<float,2>{0.0477364026f, 0.330450863f},
-std::array<float,2>{0.740684807f, 0.102690302f},
-std::array<float,2>{0.346034378f, 0.539756775f},
-std::array<float,2>{0.893879473f, 0.737366319f},
-std::array<float,2>{0.0666610822f, 0.214310244f},
-std::array<float,2>{0.668991804f, 0.434453547f},
-std::array<float,2>{0.311651945f, 0.938642681f},
-std::array<float,2>{0.551445961f, 0.819810927f},
-std::array<float,2>{0.404955536f, 0.274501383f},
-std::array<float,2>{0.773663342f, 0.0218788758f},
-std::array<float,2>{0.142822176f, 0.586172879f},
-std::array<float,2>{0.70367229f, 0.50101155f},
-std::array<float,2>{0.342752904f, 0.0900971219f},
-std::array<float,2>{0.996067464f, 0.353663146f},
-std::array<float,2>{0.0106929466f, 0.757830501f},
-std::array<float,2>{0.872416258f, 0.923824489f},
-std::array<float,2>{0.247610107f, 0.472166777f},
-std::array<float,2>{0.624505043f, 0.135804296f},
-std::array<float,2>{0.464857787f, 0.67755276f},
-std::array<float,2>{0.825463653f, 0.656931102f},
-std::array<float,2>{0.21181421f, 0.147480518f},
-std::array<float,2>{0.585798919f, 0.496497959f},
-std::array<float,2>{0.47094512f, 0.921234429f},
-std::array<float,2>{0.720220506f, 0.766639888f},
-std::array<float,2>{0.360251039f, 0.370200425f},
-std::array<float,2>{0.94181031f, 0.07781367f},
-std::array<float,2>{0.0356727354f, 0.52277261f},
-std::array<float,2>{0.519968331f, 0.566310108f},
-std::array<float,2>{0.434072524f, 0.00345418812f},
-std::array<float,2>{0.794182301f, 0.25494954f},
-std::array<float,2>{0.170462996f, 0.830603659f},
-std::array<float,2>{0.9239375f, 0.967935503f},
-std::array<float,2>{0.106310733f, 0.410005987f},
-std::array<float,2>{0.649074316f, 0.189022556f},
-std::array<float,2>{0.258453965f, 0.722998023f},
-std::array<float,2>{0.983883142f, 0.547634065f},
-std::array<float,2>{0.0282461587f, 0.114302091f},
-std::array<float,2>{0.69747752f, 0.325321913f},
-std::array<float,2>{0.325000435f, 0.797849536f},
-std::array<float,2>{0.608050168f, 0.887782514f},
-std::array<float,2>{0.449063122f, 0.440290272f},
-std::array<float,2>{0.855392039f, 0.169851393f},
-std::array<float,2>{0.22406058f, 0.647516251f},
-std::array<float,2>{0.672629774f, 0.692110479f},
-std::array<float,2>{0.29329747f, 0.241673976f},
-std::array<float,2>{0.887161911f, 0.392400652f},
-std::array<float,2>{0.0830483735f, 0.970721006f},
-std::array<float,2>{0.757536411f, 0.861568093f},
-std::array<float,2>{0.137606144f, 0.308959126f},
-std::array<float,2>{0.544135273f, 0.0482665151f},
-std::array<float,2>{0.376674503f, 0.593871236f},
-std::array<float,2>{0.784690857f, 0.507197499f},
-std::array<float,2>{0.156681523f, 0.0885503516f},
-std::array<float,2>{0.529168487f, 0.359240115f},
-std::array<float,2>{0.422099024f, 0.762575209f},
-std::array<float,2>{0.642814815f, 0.926250041f},
-std::array<float,2>{0.256848037f, 0.475708723f},
-std::array<float,2>{0.934808969f, 0.137987852f},
-std::array<float,2>{0.0989872292f, 0.673698187f},
-std::array<float,2>{0.589805543f, 0.739123225f},
-std::array<float,2>{0.48222509f, 0.216070607f},
-std::array<float,2>{0.816612184f, 0.43283987f},
-std::array<float,2>{0.204163417f, 0.943190336f},
-std::array<float,2>{0.948488832f, 0.816080272f},
-std::array<float,2>{0.043921914f, 0.28049174f},
-std::array<float,2>{0.73152864f, 0.0170162842f},
-std::array<float,2>{0.368898273f, 0.592144847f},
-std::array<float,2>{0.880235732f, 0.62832278f},
-std::array<float,2>{0.0893410966f, 0.179971606f},
-std::array<float,2>{0.687446296f, 0.45630604f},
-std::array<float,2>{0.286655933f, 0.90404433f},
-std::array<float,2>{0.538391173f, 0.790737689f},
-std::array<float,2>{0.390229225f, 0.335168719f},
-std::array<float,2>{0.761434972f, 0.108282663f},
-std::array<float,2>{0.127923921f, 0.54301399f},
-std::array<float,2>{0.690347672f, 0.61929667f},
-std::array<float,2>{0.317751795f, 0.0322147273f},
-std::array<float,2>{0.974421859f, 0.292228818f},
-std::array<float,2>{0.0225005746f, 0.857608974f},
-std::array<float,2>{0.846179187f, 0.987122953f},
-std::array<float,2>{0.230611756f, 0.385039359f},
-std::array<float,2>{0.597216427f, 0.227804914f},
-std::array<float,2>{0.444697767f, 0.716763318f},
-std::array<float,2>{0.837241113f, 0.6912449f},
-std::array<float,2>{0.200552836f, 0.236532375f},
-std::array<float,2>{0.570276141f, 0.396552205f},
-std::array<float,2>{0.488095194f, 0.974132657f},
-std::array<float,2>{0.744825721f, 0.865243018f},
-std::array<float,2>{0.356261939f, 0.306192696f},
-std::array<float,2>{0.967891157f, 0.0532935299f},
-std::array<float,2>{0.0570898838f, 0.599607706f},
-std::array<float,2>{0.515512168f, 0.552916646f},
-std::array<float,2>{0.413278669f, 0.112214059f},
-std::array<float,2>{0.80771333f, 0.32346639f},
-std::array<float,2>{0.175675228f, 0.802617431f},
-std::array<float,2>{0.916336238f, 0.884445727f},
-std::array<float,2>{0.121453978f, 0.443660706f},
-std::array<float,2>{0.638905108f, 0.165651068f},
-std::array<float,2>{0.275115669f, 0.643198669f},
-std::array<float,2>{0.989898622f, 0.569925308f},
-std::array<float,2>{0.00224202266f, 0.00420940621f},
-std::array<float,2>{0.716557503f, 0.252791762f},
-std::array<float,2>{0.331259429f, 0.832552493f},
-std::array<float,2>{0.610372722f, 0.962670743f},
-std::array<float,2>{0.458284676f, 0.410534173f},
-std::array<float,2>{0.864069819f, 0.192027584f},
-std::array<float,2>{0.236475304f, 0.72239846f},
-std::array<float,2>{0.659120679f, 0.660805464f},
-std::array<float,2>{0.298458755f, 0.141176194f},
-std::array<float,2>{0.903343916f, 0.494816124f},
-std::array<float,2>{0.0763666406f, 0.916442513f},
-std::array<float,2>{0.766072094f, 0.773387432f},
-std::array<float,2>{0.150070667f, 0.373547077f},
-std::array<float,2>{0.557962894f, 0.0726159811f},
-std::array<float,2>{0.390962362f, 0.517288268f},
-std::array<float,2>{0.870570421f, 0.609219313f},
-std::array<float,2>{0.244736239f, 0.0560778081f},
-std::array<float,2>{0.619386196f, 0.29934442f},
-std::array<float,2>{0.462548792f, 0.867838979f},
-std::array<float,2>{0.709920049f, 0.97835052f},
-std::array<float,2>{0.338838696f, 0.404078096f},
-std::array<float,2>{0.999182403f, 0.247888818f},
-std::array<float,2>{0.0122357486f, 0.695707262f},
-std::array<float,2>{0.549512863f, 0.654730678f},
-std::array<float,2>{0.399941176f, 0.162203074f},
-std::array<float,2>{0.777583241f, 0.452531904f},
-std::array<float,2>{0.14568831f, 0.87506038f},
-std::array<float,2>{0.894816518f, 0.812244594f},
-std::array<float,2>{0.0652757064f, 0.316783637f},
-std::array<float,2>{0.665634453f, 0.123733565f},
-std::array<float,2>{0.306449533f, 0.554995239f},
-std::array<float,2>{0.960880399f, 0.730897903f},
-std::array<float,2>{0.0520009995f, 0.202553496f},
-std::array<float,2>{0.735030651f, 0.420830756f},
-std::array<float,2>{0.350359589f, 0.954045296f},
-std::array<float,2>{0.572911501f, 0.839665174f},
-std::array<float,2>{0.496914238f, 0.264409691f},
-std::array<float,2>{0.831116557f, 0.0126898577f},
-std::array<float,2>{0.192698881f, 0.575000703f},
-std::array<float,2>{0.632046163f, 0.524464309f},
-std::array<float,2>{0.267616272f, 0.0687520802f},
-std::array<float,2>{0.908266842f, 0.363016337f},
-std::array<float,2>{0.111459024f, 0.778458238f},
-std::array<float,2>{0.803408027f, 0.913973629f},
-std::array<float,2>{0.186801136f, 0.489684612f},
-std::array<float,2>{0.504701138f, 0.151237607f},
-std::array<float,2>{0.421188146f, 0.666056991f},
-std::array<float,2>{0.751792133f, 0.684943318f},
-std::array<float,2>{0.133309409f, 0.127323896f},
-std::array<float,2>{0.539505363f, 0.477323085f},
-std::array<float,2>{0.381967157f, 0.932509243f},
-std::array<float,2>{0.676846981f, 0.753555536f},
-std::array<float,2>{0.289942533f, 0.344338685f},
-std::array<float,2>{0.885832727f, 0.0855267495f},
-std::array<float,2>{0.0791303664f, 0.513979316f},
-std::array<float,2>{0.60520941f, 0.580975473f},
-std::array<float,2>{0.452282459f, 0.027282374f},
-std::array<float,2>{0.856059849f, 0.271178216f},
-std::array<float,2>{0.219394028f, 0.825655282f},
-std::array<float,2>{0.980194747f, 0.952497125f},
-std::array<float,2>{0.0245638248f, 0.423398376f},
-std::array<float,2>{0.701484442f, 0.209761158f},
-std::array<float,2>{0.323611319f, 0.746530414f},
-std::array<float,2>{0.926610589f, 0.535894036f},
-std::array<float,2>{0.105204418f, 0.0963951349f},
-std::array<float,2>{0.655901313f, 0.343463987f},
-std::array<float,2>{0.265548766f, 0.786732554f},
-std::array<float,2>{0.51625073f, 0.896779597f},
-std::array<float,2>{0.433591813f, 0.468046308f},
-std::array<float,2>{0.789792895f, 0.177863732f},
-std::array<float,2>{0.16537562f, 0.640310764f},
-std::array<float,2>{0.724365473f, 0.704572082f},
-std::array<float,2>{0.3646079f, 0.224829972f},
-std::array<float,2>{0.940998316f, 0.38188678f},
-std::array<float,2>{0.0332193077f, 0.994767189f},
-std::array<float,2>{0.823553503f, 0.845246136f},
-std::array<float,2>{0.216768399f, 0.28754884f},
-std::array<float,2>{0.578560233f, 0.0446759537f},
-std::array<float,2>{0.474162817f, 0.61125946f},
-std::array<float,2>{0.814454556f, 0.562226892f},
-std::array<float,2>{0.207293317f, 0.12064705f},
-std::array<float,2>{0.592962682f, 0.313059926f},
-std::array<float,2>{0.479567826f, 0.806569874f},
-std::array<float,2>{0.729251742f, 0.879359424f},
-std::array<float,2>{0.374867111f, 0.447945684f},
-std::array<float,2>{0.950479269f, 0.156283125f},
-std::array<float,2>{0.040720854f, 0.651600122f},
-std::array<float,2>{0.526721954f, 0.702297091f},
-std::array<float,2>{0.425953805f, 0.245287105f},
-std::array<float,2>{0.786455035f, 0.402265429f},
-std::array<float,2>{0.162531778f, 0.980921686f},
-std::array<float,2>{0.933427691f, 0.873830318f},
-std::array<float,2>{0.0952042118f, 0.303132892f},
-std::array<float,2>{0.648028433f, 0.060050901f},
-std::array<float,2>{0.251384228f, 0.604219258f},
-std::array<float,2>{0.971971452f, 0.668815672f},
-std::array<float,2>{0.018383963f, 0.155678779f},
-std::array<float,2>{0.692801416f, 0.486174047f},
-std::array<float,2>{0.313102245f, 0.907808959f},
-std::array<float,2>{0.598833978f, 0.774212837f},
-std::array<float,2>{0.441012025f, 0.365114123f},
-std::array<float,2>{0.848576784f, 0.0641872957f},
-std::array<float,2>{0.23030819f, 0.531106412f},
-std::array<float,2>{0.681884587f, 0.573722601f},
-std::array<float,2>{0.283166885f, 0.0106767751f},
-std::array<float,2>{0.875041127f, 0.258087963f},
-std::array<float,2>{0.0933107436f, 0.841942132f},
-std::array<float,2>{0.765242338f, 0.958838522f},
-std::array<float,2>{0.129090548f, 0.415689468f},
-std::array<float,2>{0.533129394f, 0.195327774f},
-std::array<float,2>{0.386278182f, 0.72813946f},
-std::array<float,2>{0.808716297f, 0.743457258f},
-std::array<float,2>{0.178572908f, 0.203241423f},
-std::array<float,2>{0.509367347f, 0.426537752f},
-std::array<float,2>{0.40792188f, 0.946723104f},
-std::array<float,2>{0.636534631f, 0.820748508f},
-std::array<float,2>{0.27905935f, 0.266615957f},
-std::array<float,2>{0.919954598f, 0.0285724159f},
-std::array<float,2>{0.121038035f, 0.583850145f},
-std::array<float,2>{0.564894497f, 0.508150578f},
-std::array<float,2>{0.49084428f, 0.0802427605f},
-std::array<float,2>{0.840879202f, 0.3505463f},
-std::array<float,2>{0.196505502f, 0.755046785f},
-std::array<float,2>{0.960962474f, 0.937346578f},
-std::array<float,2>{0.0605478473f, 0.483341277f},
-std::array<float,2>{0.747010648f, 0.129273325f},
-std::array<float,2>{0.355401456f, 0.680413008f},
-std::array<float,2>{0.901932538f, 0.61420095f},
-std::array<float,2>{0.074096106f, 0.0422048792f},
-std::array<float,2>{0.66116935f, 0.283466876f},
-std::array<float,2>{0.30124104f, 0.849688113f},
-std::array<float,2>{0.560810149f, 0.997027814f},
-std::array<float,2>{0.397538245f, 0.378640026f},
-std::array<float,2>{0.771047771f, 0.219545498f},
-std::array<float,2>{0.155639678f, 0.70797354f},
-std::array<float,2>{0.711313307f, 0.633678138f},
-std::array<float,2>{0.332390308f, 0.172376454f},
-std::array<float,2>{0.988182843f, 0.462591261f},
-std::array<float,2>{0.00571294362f, 0.89158076f},
-std::array<float,2>{0.86212641f, 0.784220815f},
-std::array<float,2>{0.238683864f, 0.338226557f},
-std::array<float,2>{0.616465271f, 0.100071467f},
-std::array<float,2>{0.456530064f, 0.534895539f},
-std::array<float,2>{0.776850224f, 0.589163482f},
-std::array<float,2>{0.141191348f, 0.020535741f},
-std::array<float,2>{0.553378105f, 0.277095646f},
-std::array<float,2>{0.402736336f, 0.817196727f},
-std::array<float,2>{0.670385838f, 0.940081358f},
-std::array<float,2>{0.30860725f, 0.436262786f},
-std::array<float,2>{0.891213119f, 0.211347282f},
-std::array<float,2>{0.0702834949f, 0.734890163f},
-std::array<float,2>{0.622692645f, 0.678265631f},
-std::array<float,2>{0.467645705f, 0.133629724f},
-std::array<float,2>{0.873306334f, 0.470340312f},
-std::array<float,2>{0.249103904f, 0.925160408f},
-std::array<float,2>{0.994028091f, 0.760850132f},
-std::array<float,2>{0.00966306217f, 0.351610154f},
-std::array<float,2>{0.705168545f, 0.0924672782f},
-std::array<float,2>{0.340550631f, 0.502431333f},
-std::array<float,2>{0.91340363f, 0.711344302f},
-std::array<float,2>{0.113621607f, 0.23151195f},
-std::array<float,2>{0.625333428f, 0.388098091f},
-std::array<float,2>{0.269994646f, 0.989504158f},
-std::array<float,2>{0.503070772f, 0.854194224f},
-std::array<float,2>{0.414809346f, 0.293999493f},
-std::array<float,2>{0.79785341f, 0.0371906087f},
-std::array<float,2>{0.183097899f, 0.621927261f},
-std::array<float,2>{0.739485264f, 0.54150337f},
-std::array<float,2>{0.344687402f, 0.103517026f},
-std::array<float,2>{0.955452263f, 0.329650581f},
-std::array<float,2>{0.04903372f, 0.796161711f},
-std::array<float,2>{0.835461259f, 0.901842713f},
-std::array<float,2>{0.189385518f, 0.460053802f},
-std::array<float,2>{0.574636459f, 0.186410457f},
-std::array<float,2>{0.495888025f, 0.629712939f},
-std::array<float,2>{0.852661252f, 0.646060407f},
-std::array<float,2>{0.225247383f, 0.17078042f},
-std::array<float,2>{0.605788469f, 0.438242406f},
-std::array<float,2>{0.445565075f, 0.890136242f},
-std::array<float,2>{0.69720155f, 0.799083054f},
-std::array<float,2>{0.326610416f, 0.327342987f},
-std::array<float,2>{0.98225826f, 0.116908468f},
-std::array<float,2>{0.0307837594f, 0.550233722f},
-std::array<float,2>{0.545275688f, 0.59715116f},
-std::array<float,2>{0.377507687f, 0.0496155433f},
-std::array<float,2>{0.753920853f, 0.311838716f},
-std::array<float,2>{0.139401644f, 0.859633684f},
-std::array<float,2>{0.888682544f, 0.969761312f},
-std::array<float,2>{0.0849483013f, 0.392841309f},
-std::array<float,2>{0.675765932f, 0.239846483f},
-std::array<float,2>{0.296265006f, 0.69347167f},
-std::array<float,2>{0.944987893f, 0.519727767f},
-std::array<float,2>{0.0383169614f, 0.0747899562f},
-std::array<float,2>{0.72080946f, 0.368407369f},
-std::array<float,2>{0.362870336f, 0.768076658f},
-std::array<float,2>{0.582143128f, 0.919266284f},
-std::array<float,2>{0.468968034f, 0.499520004f},
-std::array<float,2>{0.828098714f, 0.145416602f},
-std::array<float,2>{0.213156164f, 0.660023272f},
-std::array<float,2>{0.652136981f, 0.726519465f},
-std::array<float,2>{0.261419743f, 0.190536082f},
-std::array<float,2>{0.923578501f, 0.407317728f},
-std::array<float,2>{0.107963264f, 0.966504693f},
-std::array<float,2>{0.796022832f, 0.828412473f},
-std::array<float,2>{0.169250652f, 0.255936176f},
-std::array<float,2>{0.521586537f, 0.00126903877f},
-std::array<float,2>{0.437333226f, 0.562698185f},
-std::array<float,2>{0.768095434f, 0.515994787f},
-std::array<float,2>{0.151858166f, 0.0734399557f},
-std::array<float,2>{0.555455029f, 0.374520898f},
-std::array<float,2>{0.393919647f, 0.771938384f},
-std::array<float,2>{0.65743798f, 0.917425513f},
-std::array<float,2>{0.300347835f, 0.495208442f},
-std::array<float,2>{0.90597111f, 0.142404273f},
-std::array<float,2>{0.0744652972f, 0.66150558f},
-std::array<float,2>{0.611530662f, 0.72119534f},
-std::array<float,2>{0.459934145f, 0.192969561f},
-std::array<float,2>{0.865493476f, 0.412059635f},
-std::array<float,2>{0.235228643f, 0.961179316f},
-std::array<float,2>{0.990372062f, 0.833771229f},
-std::array<float,2>{0.00184798613f, 0.253032476f},
-std::array<float,2>{0.71726644f, 0.00527565647f},
-std::array<float,2>{0.329118699f, 0.569218993f},
-std::array<float,2>{0.914921939f, 0.644408345f},
-std::array<float,2>{0.124895044f, 0.164452955f},
-std::array<float,2>{0.637398958f, 0.444763482f},
-std::array<float,2>{0.277237058f, 0.88293457f},
-std::array<float,2>{0.511822224f, 0.80175662f},
-std::array<float,2>{0.411525697f, 0.322595596f},
-std::array<float,2>{0.804926097f, 0.113027297f},
-std::array<float,2>{0.172127843f, 0.553995073f},
-std::array<float,2>{0.742395461f, 0.597724617f},
-std::array<float,2>{0.358711153f, 0.0538608134f},
-std::array<float,2>{0.964891911f, 0.304878682f},
-std::array<float,2>{0.0565764792f, 0.866518021f},
-std::array<float,2>{0.839799523f, 0.973199487f},
-std::array<float,2>{0.202939719f, 0.397796929f},
-std::array<float,2>{0.567541957f, 0.237432569f},
-std::array<float,2>{0.48628661f, 0.689933598f},
-std::array<float,2>{0.845373392f, 0.715167344f},
-std::array<float,2>{0.232962102f, 0.22688055f},
-std::array<float,2>{0.59522289f, 0.38620919f},
-std::array<float,2>{0.443124443f, 0.988097072f},
-std::array<float,2>{0.689005673f, 0.858784437f},
-std::array<float,2>{0.320119649f, 0.291802138f},
-std::array<float,2>{0.97471118f, 0.0323951878f},
-std::array<float,2>{0.0198349319f, 0.620462954f},
-std::array<float,2>{0.536571741f, 0.54420501f},
-std::array<float,2>{0.388227433f, 0.108486451f},
-std::array<float,2>{0.759021401f, 0.334174633f},
-std::array<float,2>{0.125262767f, 0.789225399f},
-std::array<float,2>{0.881642878f, 0.903028786f},
-std::array<float,2>{0.0862468109f, 0.455385238f},
-std::array<float,2>{0.684712827f, 0.181043997f},
-std::array<float,2>{0.287996411f, 0.627260745f},
-std::array<float,2>{0.947002947f, 0.593241394f},
-std::array<float,2>{0.0458715446f, 0.0162841342f},
-std::array<float,2>{0.733578742f, 0.280036092f},
-std::array<float,2>{0.369916767f, 0.815102577f},
-std::array<float,2>{0.586044192f, 0.941699028f},
-std::array<float,2>{0.483736277f, 0.431844115f},
-std::array<float,2>{0.818534613f, 0.215274736f},
-std::array<float,2>{0.205389991f, 0.739720941f},
-std::array<float,2>{0.642492771f, 0.671953559f},
-std::array<float,2>{0.254417449f, 0.137361586f},
-std::array<float,2>{0.937096f, 0.474938631f},
-std::array<float,2>{0.0999213234f, 0.927109241f},
-std::array<float,2>{0.782510877f, 0.763380468f},
-std::array<float,2>{0.159921125f, 0.357672364f},
-std::array<float,2>{0.530566335f, 0.0894930288f},
-std::array<float,2>{0.424354464f, 0.506056547f},
-std::array<float,2>{0.821069598f, 0.610156357f},
-std::array<float,2>{0.218164802f, 0.0434107408f},
-std::array<float,2>{0.580353618f, 0.288223445f},
-std::array<float,2>{0.47577706f, 0.843822718f},
-std::array<float,2>{0.726496041f, 0.99573046f},
-std::array<float,2>{0.366334349f, 0.381416142f},
-std::array<float,2>{0.937640607f, 0.225857139f},
-std::array<float,2>{0.0320856906f, 0.703709841f},
-std::array<float,2>{0.51890415f, 0.638814092f},
-std::array<float,2>{0.431562513f, 0.179221734f},
-std::array<float,2>{0.791140854f, 0.467190653f},
-std::array<float,2>{0.166528344f, 0.898308694f},
-std::array<float,2>{0.928883314f, 0.785183847f},
-std::array<float,2>{0.102730602f, 0.342350125f},
-std::array<float,2>{0.65258348f, 0.0970880017f},
-std::array<float,2>{0.262913823f, 0.536918759f},
-std::array<float,2>{0.978501797f, 0.747766852f},
-std::array<float,2>{0.0268393941f, 0.210079655f},
-std::array<float,2>{0.701114297f, 0.422637105f},
-std::array<float,2>{0.321441829f, 0.951812983f},
-std::array<float,2>{0.602597237f, 0.824680269f},
-std::array<float,2>{0.450952739f, 0.26973787f},
-std::array<float,2>{0.859222591f, 0.0257019214f},
-std::array<float,2>{0.221762881f, 0.581144154f},
-std::array<float,2>{0.679536402f, 0.51499629f},
-std::array<float,2>{0.292193323f, 0.0842609257f},
-std::array<float,2>{0.884661555f, 0.344920546f},
-std::array<float,2>{0.08203087f, 0.752758741f},
-std::array<float,2>{0.753584266f, 0.933486879f},
-std::array<float,2>{0.134949207f, 0.477728963f},
-std::array<float,2>{0.542673707f, 0.128891572f},
-std::array<float,2>{0.380808622f, 0.683982611f},
-std::array<float,2>{0.80246222f, 0.667728007f},
-std::array<float,2>{0.185381219f, 0.151503742f},
-std::array<float,2>{0.506909966f, 0.488474399f},
-std::array<float,2>{0.418336809f, 0.912956476f},
-std::array<float,2>{0.62917304f, 0.77749604f},
-std::array<float,2>{0.266481489f, 0.361954957f},
-std::array<float,2>{0.908161759f, 0.0701778233f},
-std::array<float,2>{0.110714048f, 0.524077356f},
-std::array<float,2>{0.570644498f, 0.575540125f},
-std::array<float,2>{0.499061495f, 0.0132171968f},
-std::array<float,2>{0.829070747f, 0.265353799f},
-std::array<float,2>{0.193507984f, 0.837938249f},
-std::array<float,2>{0.958154857f, 0.955029011f},
-std::array<float,2>{0.0541140921f, 0.421735793f},
-std::array<float,2>{0.737021387f, 0.201200873f},
-std::array<float,2>{0.349074304f, 0.732392132f},
-std::array<float,2>{0.897485495f, 0.556409061f},
-std::array<float,2>{0.0630959868f, 0.124978304f},
-std::array<float,2>{0.667509377f, 0.317767709f},
-std::array<float,2>{0.308099478f, 0.810892999f},
-std::array<float,2>{0.547433794f, 0.876374483f},
-std::array<float,2>{0.401755244f, 0.45132795f},
-std::array<float,2>{0.780447185f, 0.163398534f},
-std::array<float,2>{0.147908062f, 0.655943155f},
-std::array<float,2>{0.707303464f, 0.697188556f},
-std::array<float,2>{0.337568343f, 0.246162564f},
-std::array<float,2>{0.997976661f, 0.402905703f},
-std::array<float,2>{0.0138672162f, 0.977214336f},
-std::array<float,2>{0.867327332f, 0.868650138f},
-std::array<float,2>{0.243974462f, 0.300440073f},
-std::array<float,2>{0.618239164f, 0.0547964387f},
-std::array<float,2>{0.464568108f, 0.607726514f},
-std::array<float,2>{0.859665215f, 0.533916473f},
-std::array<float,2>{0.241228744f, 0.100891702f},
-std::array<float,2>{0.614737749f, 0.339839607f},
-std::array<float,2>{0.454515278f, 0.784110129f},
-std::array<float,2>{0.713013351f, 0.892110586f},
-std::array<float,2>{0.334285527f, 0.461667717f},
-std::array<float,2>{0.985209942f, 0.17362529f},
-std::array<float,2>{0.00728547201f, 0.634741724f},
-std::array<float,2>{0.560052872f, 0.708674908f},
-std::array<float,2>{0.39598766f, 0.220614418f},
-std::array<float,2>{0.771571755f, 0.376988441f},
-std::array<float,2>{0.15413259f, 0.997843564f},
-std::array<float,2>{0.899649799f, 0.850866675f},
-std::array<float,2>{0.0707804263f, 0.28426069f},
-std::array<float,2>{0.662802517f, 0.0418927111f},
-std::array<float,2>{0.304110378f, 0.614990115f},
-std::array<float,2>{0.964128852f, 0.681399584f},
-std::array<float,2>{0.0597457737f, 0.130458489f},
-std::array<float,2>{0.749616385f, 0.483778983f},
-std::array<float,2>{0.352420717f, 0.93578285f},
-std::array<float,2>{0.564047933f, 0.754511774f},
-std::array<float,2>{0.489568651f, 0.351294219f},
-std::array<float,2>{0.843731701f, 0.0818876252f},
-std::array<float,2>{0.198255375f, 0.509245396f},
-std::array<float,2>{0.634572804f, 0.582440972f},
-std::array<float,2>{0.280111074f, 0.0279257707f},
-std::array<float,2>{0.919089735f, 0.266131967f},
-std::array<float,2>{0.118132643f, 0.8215276f},
-std::array<float,2>{0.812393904f, 0.945729494f},
-std::array<float,2>{0.176268309f, 0.426770717f},
-std::array<float,2>{0.510452867f, 0.204897657f},
-std::array<float,2>{0.41000092f, 0.742888153f},
-std::array<float,2>{0.762329638f, 0.727383852f},
-std::array<float,2>{0.131541073f, 0.197131395f},
-std::array<float,2>{0.534546912f, 0.414438576f},
-std::array<float,2>{0.383753508f, 0.957043052f},
-std::array<float,2>{0.681186676f, 0.843623996f},
-std::array<float,2>{0.284127206f, 0.259222239f},
-std::array<float,2>{0.878645957f, 0.0110839074f},
-std::array<float,2>{0.0914183706f, 0.572305143f},
-std::array<float,2>{0.600511551f, 0.529973626f},
-std::array<float,2>{0.438854039f, 0.0631750152f},
-std::array<float,2>{0.850788951f, 0.364218503f},
-std::array<float,2>{0.226938888f, 0.774431288f},
-std::array<float,2>{0.970054328f, 0.906339705f},
-std::array<float,2>{0.0174303949f, 0.484430522f},
-std::array<float,2>{0.69421649f, 0.154969543f},
-std::array<float,2>{0.315500647f, 0.669870973f},
-std::array<float,2>{0.930549443f, 0.604748785f},
-std::array<float,2>{0.0964155868f, 0.0587134399f},
-std::array<float,2>{0.645408332f, 0.304301858f},
-std::array<float,2>{0.252435058f, 0.87483871f},
-std::array<float,2>{0.523863256f, 0.981747448f},
-std::array<float,2>{0.427918434f, 0.401308805f},
-std::array<float,2>{0.787216842f, 0.244510964f},
-std::array<float,2>{0.162012845f, 0.701670527f},
-std::array<float,2>{0.727193117f, 0.651039839f},
-std::array<float,2>{0.371468335f, 0.158173412f},
-std::array<float,2>{0.95118165f, 0.448769182f},
-std::array<float,2>{0.0423039682f, 0.88045752f},
-std::array<float,2>{0.814414203f, 0.805319309f},
-std::array<float,2>{0.210779905f, 0.313935578f},
-std::array<float,2>{0.590768397f, 0.119915597f},
-std::array<float,2>{0.476584285f, 0.561206222f},
-std::array<float,2>{0.793695807f, 0.564411879f},
-std::array<float,2>{0.170970768f, 0.000157514471f},
-std::array<float,2>{0.521110475f, 0.25722307f},
-std::array<float,2>{0.43476066f, 0.829997897f},
-std::array<float,2>{0.649774492f, 0.965490758f},
-std::array<float,2>{0.259446144f, 0.40630427f},
-std::array<float,2>{0.925494194f, 0.190424368f},
-std::array<float,2>{0.106898062f, 0.724916995f},
-std::array<float,2>{0.584719837f, 0.659129262f},
-std::array<float,2>{0.471734256f, 0.146231517f},
-std::array<float,2>{0.824289143f, 0.49835968f},
-std::array<float,2>{0.21277231f, 0.91867578f},
-std::array<float,2>{0.943209529f, 0.768879414f},
-std::array<float,2>{0.0368074402f, 0.367597759f},
-std::array<float,2>{0.719033659f, 0.0761069581f},
-std::array<float,2>{0.360716134f, 0.521130383f},
-std::array<float,2>{0.888574719f, 0.694667518f},
-std::array<float,2>{0.0826399177f, 0.238473877f},
-std::array<float,2>{0.673478544f, 0.394306719f},
-std::array<float,2>{0.294564456f, 0.968806028f},
-std::array<float,2>{0.542970836f, 0.860974312f},
-std::array<float,2>{0.375447899f, 0.31108278f},
-std::array<float,2>{0.756562114f, 0.0502997935f},
-std::array<float,2>{0.138550952f, 0.59639138f},
-std::array<float,2>{0.698936105f, 0.548977852f},
-std::array<float,2>{0.325474471f, 0.115540721f},
-std::array<float,2>{0.983345628f, 0.326256335f},
-std::array<float,2>{0.028570557f, 0.800125897f},
-std::array<float,2>{0.854291797f, 0.888805747f},
-std::array<float,2>{0.222940937f, 0.438696206f},
-std::array<float,2>{0.608577669f, 0.171372145f},
-std::array<float,2>{0.447852582f, 0.64502728f},
-std::array<float,2>{0.832067549f, 0.63012296f},
-std::array<float,2>{0.190445825f, 0.186752588f},
-std::array<float,2>{0.577475131f, 0.45951885f},
-std::array<float,2>{0.493240237f, 0.900867641f},
-std::array<float,2>{0.741407573f, 0.795863092f},
-std::array<float,2>{0.347292155f, 0.328185767f},
-std::array<float,2>{0.955033243f, 0.105150461f},
-std::array<float,2>{0.0480043814f, 0.542435765f},
-std::array<float,2>{0.501750588f, 0.622389615f},
-std::array<float,2>{0.416268736f, 0.0388329402f},
-std::array<float,2>{0.80059278f, 0.293894559f},
-std::array<float,2>{0.180624872f, 0.855196357f},
-std::array<float,2>{0.912082195f, 0.989096344f},
-std::array<float,2>{0.115247779f, 0.387034684f},
-std::array<float,2>{0.628253758f, 0.231314272f},
-std::array<float,2>{0.271564215f, 0.712499797f},
-std::array<float,2>{0.994310975f, 0.50389725f},
-std::array<float,2>{0.0108216349f, 0.0937026143f},
-std::array<float,2>{0.70493257f, 0.353163272f},
-std::array<float,2>{0.343141437f, 0.760031283f},
-std::array<float,2>{0.623107135f, 0.923847318f},
-std::array<float,2>{0.466306388f, 0.469697058f},
-std::array<float,2>{0.871566057f, 0.134490818f},
-std::array<float,2>{0.246911973f, 0.678804755f},
-std::array<float,2>{0.668380916f, 0.73552376f},
-std::array<float,2>{0.310979307f, 0.211927935f},
-std::array<float,2>{0.893098891f, 0.437437683f},
-std::array<float,2>{0.0675270185f, 0.940558493f},
-std::array<float,2>{0.774600983f, 0.817977488f},
-std::array<float,2>{0.144326463f, 0.276228219f},
-std::array<float,2>{0.551959574f, 0.0196720455f},
-std::array<float,2>{0.406216621f, 0.588303685f},
-std::array<float,2>{0.807383716f, 0.552595258f},
-std::array<float,2>{0.174362361f, 0.110996634f},
-std::array<float,2>{0.514217377f, 0.322148263f},
-std::array<float,2>{0.412665278f, 0.803371429f},
-std::array<float,2>{0.640430272f, 0.885543108f},
-std::array<float,2>{0.274220914f, 0.442298412f},
-std::array<float,2>{0.917344272f, 0.167749435f},
-std::array<float,2>{0.122700416f, 0.640804648f},
-std::array<float,2>{0.568549573f, 0.688031912f},
-std::array<float,2>{0.487166435f, 0.234537214f},
-std::array<float,2>{0.836610973f, 0.39621219f},
-std::array<float,2>{0.1994434f, 0.975911617f},
-std::array<float,2>{0.967342973f, 0.863885939f},
-std::array<float,2>{0.0576830953f, 0.307309449f},
-std::array<float,2>{0.745776057f, 0.0525731109f},
-std::array<float,2>{0.357107192f, 0.600493789f},
-std::array<float,2>{0.902940392f, 0.66309309f},
-std::array<float,2>{0.0777161866f, 0.144382641f},
-std::array<float,2>{0.659770489f, 0.494057477f},
-std::array<float,2>{0.297849208f, 0.914065063f},
-std::array<float,2>{0.557144523f, 0.770094156f},
-std::array<float,2>{0.392438471f, 0.371386319f},
-std::array<float,2>{0.766928673f, 0.0716898516f},
-std::array<float,2>{0.149061665f, 0.518052757f},
-std::array<float,2>{0.715397656f, 0.567083061f},
-std::array<float,2>{0.330150545f, 0.00708119525f},
-std::array<float,2>{0.98903501f, 0.25084883f},
-std::array<float,2>{0.00375043438f, 0.834762752f},
-std::array<float,2>{0.864345491f, 0.964567602f},
-std::array<float,2>{0.237593248f, 0.41217497f},
-std::array<float,2>{0.610350609f, 0.194383353f},
-std::array<float,2>{0.457681894f, 0.719372153f},
-std::array<float,2>{0.818053484f, 0.741178036f},
-std::array<float,2>{0.20377402f, 0.217059895f},
-std::array<float,2>{0.588442624f, 0.4306238f},
-std::array<float,2>{0.480904907f, 0.943575442f},
-std::array<float,2>{0.731096983f, 0.814151108f},
-std::array<float,2>{0.367616773f, 0.278431445f},
-std::array<float,2>{0.947499931f, 0.019401025f},
-std::array<float,2>{0.0447897092f, 0.590125918f},
-std::array<float,2>{0.528180242f, 0.504557252f},
-std::array<float,2>{0.423471481f, 0.0878728777f},
-std::array<float,2>{0.783367395f, 0.355999947f},
-std::array<float,2>{0.157399058f, 0.765295148f},
-std::array<float,2>{0.933826804f, 0.928216636f},
-std::array<float,2>{0.0979125425f, 0.47293371f},
-std::array<float,2>{0.643938124f, 0.138733029f},
-std::array<float,2>{0.256770551f, 0.674772739f},
-std::array<float,2>{0.973589778f, 0.618412971f},
-std::array<float,2>{0.0224474184f, 0.0350734591f},
-std::array<float,2>{0.690800726f, 0.29096514f},
-std::array<float,2>{0.316546172f, 0.855911851f},
-std::array<float,2>{0.595714629f, 0.985205352f},
-std::array<float,2>{0.443444073f, 0.383132517f},
-std::array<float,2>{0.847110569f, 0.229462162f},
-std::array<float,2>{0.23209928f, 0.717670321f},
-std::array<float,2>{0.686107039f, 0.626230836f},
-std::array<float,2>{0.285711944f, 0.181762353f},
-std::array<float,2>{0.879644275f, 0.45321694f},
-std::array<float,2>{0.0879063755f, 0.905164421f},
-std::array<float,2>{0.760608137f, 0.791882098f},
-std::array<float,2>{0.128080785f, 0.332259476f},
-std::array<float,2>{0.537602305f, 0.105543621f},
-std::array<float,2>{0.38935253f, 0.545886338f},
-std::array<float,2>{0.85674721f, 0.578757763f},
-std::array<float,2>{0.220008433f, 0.0238036867f},
-std::array<float,2>{0.604204357f, 0.272114396f},
-std::array<float,2>{0.451544702f, 0.8269099f},
-std::array<float,2>{0.702388287f, 0.949636936f},
-std::array<float,2>{0.322363526f, 0.424782395f},
-std::array<float,2>{0.979100347f, 0.207277298f},
-std::array<float,2>{0.0241696443f, 0.748428643f},
-std::array<float,2>{0.540514827f, 0.68621248f},
-std::array<float,2>{0.381775767f, 0.125746489f},
-std::array<float,2>{0.750134051f, 0.47994864f},
-std::array<float,2>{0.134437203f, 0.931594491f},
-std::array<float,2>{0.885726511f, 0.75109911f},
-std::array<float,2>{0.0785787851f, 0.346345395f},
-std::array<float,2>{0.676357031f, 0.0822192803f},
-std::array<float,2>{0.290915221f, 0.512124181f},
-std::array<float,2>{0.939743221f, 0.705476284f},
-std::array<float,2>{0.0350694582f, 0.223714113f},
-std::array<float,2>{0.72300142f, 0.380585462f},
-std::array<float,2>{0.363599092f, 0.993363857f},
-std::array<float,2>{0.579976976f, 0.84613055f},
-std::array<float,2>{0.473282039f, 0.285461068f},
-std::array<float,2>{0.822446108f, 0.0456721149f},
-std::array<float,2>{0.215058297f, 0.61154598f},
-std::array<float,2>{0.655269563f, 0.538578451f},
-std::array<float,2>{0.264083028f, 0.0942033306f},
-std::array<float,2>{0.927357733f, 0.341740936f},
-std::array<float,2>{0.103623725f, 0.78805244f},
-std::array<float,2>{0.790593803f, 0.895814002f},
-std::array<float,2>{0.164335459f, 0.465038151f},
-std::array<float,2>{0.517481863f, 0.177467331f},
-std::array<float,2>{0.431717366f, 0.637907267f},
-std::array<float,2>{0.778909624f, 0.654033482f},
-std::array<float,2>{0.145074084f, 0.161718175f},
-std::array<float,2>{0.550195038f, 0.449297965f},
-std::array<float,2>{0.398810387f, 0.878363073f},
-std::array<float,2>{0.664709151f, 0.810482919f},
-std::array<float,2>{0.3052468f, 0.319857001f},
-std::array<float,2>{0.89632529f, 0.121263444f},
-std::array<float,2>{0.0655704364f, 0.557861507f},
-std::array<float,2>{0.620131373f, 0.605752349f},
-std::array<float,2>{0.461177558f, 0.0568810366f},
-std::array<float,2>{0.869143188f, 0.297211051f},
-std::array<float,2>{0.245130986f, 0.871044815f},
-std::array<float,2>{0.99861753f, 0.979872763f},
-std::array<float,2>{0.0127323465f, 0.40488863f},
-std::array<float,2>{0.710536659f, 0.248637974f},
-std::array<float,2>{0.339464068f, 0.699132144f},
-std::array<float,2>{0.909988463f, 0.527311146f},
-std::array<float,2>{0.11243777f, 0.0664601848f},
-std::array<float,2>{0.63120079f, 0.359699398f},
-std::array<float,2>{0.269202769f, 0.781182528f},
-std::array<float,2>{0.50564301f, 0.910865426f},
-std::array<float,2>{0.420470417f, 0.492002696f},
-std::array<float,2>{0.803732634f, 0.148747206f},
-std::array<float,2>{0.185991615f, 0.665745318f},
-std::array<float,2>{0.736153305f, 0.733224928f},
-std::array<float,2>{0.350913882f, 0.199973494f},
-std::array<float,2>{0.959853888f, 0.419338405f},
-std::array<float,2>{0.0513799228f, 0.955193162f},
-std::array<float,2>{0.830667794f, 0.836157322f},
-std::array<float,2>{0.19230552f, 0.262881368f},
-std::array<float,2>{0.574200273f, 0.0146950614f},
-std::array<float,2>{0.497575164f, 0.578052819f},
-std::array<float,2>{0.840716064f, 0.511459768f},
-std::array<float,2>{0.196208507f, 0.0797033459f},
-std::array<float,2>{0.566206753f, 0.349245101f},
-std::array<float,2>{0.491676807f, 0.756774247f},
-std::array<float,2>{0.747517169f, 0.93513757f},
-std::array<float,2>{0.35382989f, 0.481858224f},
-std::array<float,2>{0.962451816f, 0.132334813f},
-std::array<float,2>{0.0624077208f, 0.682340264f},
-std::array<float,2>{0.50796479f, 0.744664729f},
-std::array<float,2>{0.40684253f, 0.206752434f},
-std::array<float,2>{0.810503244f, 0.428440213f},
-std::array<float,2>{0.179629385f, 0.948048294f},
-std::array<float,2>{0.921403646f, 0.824120939f},
-std::array<float,2>{0.11929819f, 0.268987179f},
-std::array<float,2>{0.635007322f, 0.0300695449f},
-std::array<float,2>{0.27769196f, 0.585569441f},
-std::array<float,2>{0.986434281f, 0.636081815f},
-std::array<float,2>{0.00478786137f, 0.175160691f},
-std::array<float,2>{0.712356567f, 0.463868856f},
-std::array<float,2>{0.333969593f, 0.893607974f},
-std::array<float,2>{0.615887344f, 0.782168865f},
-std::array<float,2>{0.455266714f, 0.336479336f},
-std::array<float,2>{0.86320132f, 0.09850014f},
-std::array<float,2>{0.239798263f, 0.533191979f},
-std::array<float,2>{0.660549343f, 0.616059601f},
-std::array<float,2>{0.30216229f, 0.0393025838f},
-std::array<float,2>{0.901016414f, 0.283002347f},
-std::array<float,2>{0.0724260211f, 0.84833169f},
-std::array<float,2>{0.769964933f, 0.999260426f},
-std::array<float,2>{0.154567614f, 0.376514256f},
-std::array<float,2>{0.561913371f, 0.220767498f},
-std::array<float,2>{0.397010058f, 0.709443569f},
-std::array<float,2>{0.785286963f, 0.700899363f},
-std::array<float,2>{0.163306981f, 0.244019076f},
-std::array<float,2>{0.526038587f, 0.399406761f},
-std::array<float,2>{0.427432448f, 0.982680917f},
-std::array<float,2>{0.646960318f, 0.871685505f},
-std::array<float,2>{0.250349045f, 0.301227719f},
-std::array<float,2>{0.931675076f, 0.0606745481f},
-std::array<float,2>{0.0937596262f, 0.601693869f},
-std::array<float,2>{0.591975629f, 0.559371769f},
-std::array<float,2>{0.478959143f, 0.118787155f},
-std::array<float,2>{0.815636754f, 0.31579262f},
-std::array<float,2>{0.208598137f, 0.807316005f},
-std::array<float,2>{0.949362218f, 0.882660985f},
-std::array<float,2>{0.0398752503f, 0.446374565f},
-std::array<float,2>{0.729581952f, 0.159373552f},
-std::array<float,2>{0.373773545f, 0.64999032f},
-std::array<float,2>{0.876273036f, 0.570765793f},
-std::array<float,2>{0.092001982f, 0.0089508323f},
-std::array<float,2>{0.682783365f, 0.260057867f},
-std::array<float,2>{0.281707197f, 0.840590358f},
-std::array<float,2>{0.531760275f, 0.959995031f},
-std::array<float,2>{0.385149598f, 0.417091697f},
-std::array<float,2>{0.764592767f, 0.197279736f},
-std::array<float,2>{0.130646154f, 0.730392158f},
-std::array<float,2>{0.692063391f, 0.671552837f},
-std::array<float,2>{0.314427108f, 0.152759805f},
-std::array<float,2>{0.971149802f, 0.48798582f},
-std::array<float,2>{0.018623326f, 0.910136163f},
-std::array<float,2>{0.849019051f, 0.7768929f},
-std::array<float,2>{0.22935161f, 0.366923332f},
-std::array<float,2>{0.598059356f, 0.0657014474f},
-std::array<float,2>{0.439657748f, 0.528344452f},
-std::array<float,2>{0.75550276f, 0.595431566f},
-std::array<float,2>{0.140139177f, 0.0469017923f},
-std::array<float,2>{0.546433568f, 0.310290426f},
-std::array<float,2>{0.378882527f, 0.862522662f},
-std::array<float,2>{0.67440629f, 0.97225976f},
-std::array<float,2>{0.295093924f, 0.390872717f},
-std::array<float,2>{0.88995719f, 0.240451276f},
-std::array<float,2>{0.0853978619f, 0.692539096f},
-std::array<float,2>{0.606716752f, 0.647071123f},
-std::array<float,2>{0.446970165f, 0.168546617f},
-std::array<float,2>{0.851998508f, 0.440728605f},
-std::array<float,2>{0.226250321f, 0.886779487f},
-std::array<float,2>{0.981098711f, 0.798662305f},
-std::array<float,2>{0.0294238199f, 0.324587017f},
-std::array<float,2>{0.695837557f, 0.113416798f},
-std::array<float,2>{0.327724338f, 0.548258781f},
-std::array<float,2>{0.922477365f, 0.724189699f},
-std::array<float,2>{0.108673893f, 0.187985092f},
-std::array<float,2>{0.651349425f, 0.40884912f},
-std::array<float,2>{0.260280877f, 0.967329144f},
-std::array<float,2>{0.523118854f, 0.831809759f},
-std::array<float,2>{0.436196089f, 0.254337698f},
-std::array<float,2>{0.795232177f, 0.00288891559f},
-std::array<float,2>{0.168811485f, 0.564654112f},
-std::array<float,2>{0.722118676f, 0.521630049f},
-std::array<float,2>{0.361555964f, 0.0770040154f},
-std::array<float,2>{0.943620861f, 0.370043278f},
-std::array<float,2>{0.0379209891f, 0.765857995f},
-std::array<float,2>{0.826345682f, 0.92018044f},
-std::array<float,2>{0.214237496f, 0.497448862f},
-std::array<float,2>{0.583981633f, 0.147165313f},
-std::array<float,2>{0.469942838f, 0.657373071f},
-std::array<float,2>{0.874833345f, 0.676245272f},
-std::array<float,2>{0.248100534f, 0.134901792f},
-std::array<float,2>{0.621317863f, 0.471220404f},
-std::array<float,2>{0.467997193f, 0.921941221f},
-std::array<float,2>{0.706317544f, 0.758844912f},
-std::array<float,2>{0.341535896f, 0.354547232f},
-std::array<float,2>{0.992643237f, 0.0910006166f},
-std::array<float,2>{0.00817437284f, 0.50068146f},
-std::array<float,2>{0.553875923f, 0.587735653f},
-std::array<float,2>{0.403373271f, 0.0227651224f},
-std::array<float,2>{0.775856674f, 0.273611754f},
-std::array<float,2>{0.141854689f, 0.818921387f},
-std::array<float,2>{0.891635776f, 0.937738001f},
-std::array<float,2>{0.0683798045f, 0.435400546f},
-std::array<float,2>{0.671469033f, 0.213639125f},
-std::array<float,2>{0.310247838f, 0.736577988f},
-std::array<float,2>{0.956153393f, 0.540501297f},
-std::array<float,2>{0.0500208475f, 0.101965502f},
-std::array<float,2>{0.739181578f, 0.331443489f},
-std::array<float,2>{0.345226943f, 0.793109119f},
-std::array<float,2>{0.575531662f, 0.898654103f},
-std::array<float,2>{0.49449715f, 0.458317488f},
-std::array<float,2>{0.83439976f, 0.184248239f},
-std::array<float,2>{0.188074574f, 0.631602049f},
-std::array<float,2>{0.626505554f, 0.714197397f},
-std::array<float,2>{0.271373272f, 0.233944833f},
-std::array<float,2>{0.912906528f, 0.389189154f},
-std::array<float,2>{0.114667147f, 0.990893602f},
-std::array<float,2>{0.797565401f, 0.852242768f},
-std::array<float,2>{0.182400256f, 0.295566022f},
-std::array<float,2>{0.502527297f, 0.0365343206f},
-std::array<float,2>{0.415697724f, 0.624054551f}}
\ No newline at end of file
@@ -1,4096 +0,0 @@
-{std::array<float,2>{0.61133945f, 0.750245512f},
-std::array<float,2>{0.356272787f, 0.292401373f},
-std::array<float,2>{0.153974712f, 0.504231453f},
-std::array<float,2>{0.925358832f, 0.0720714256f},
-std::array<float,2>{0.799254715f, 0.701558352f},
-std::array<float,2>{0.0660899729f, 0.201256633f},
-std::array<float,2>{0.471780628f, 0.913766325f},
-std::array<float,2>{0.650102735f, 0.495321304f},
-std::array<float,2>{0.95969075f, 0.997419715f},
-std::array<float,2>{0.200710714f, 0.432930648f},
-std::array<float,2>{0.288742185f, 0.659239471f},
-std::array<float,2>{0.555887759f, 0.171419263f},
-std::array<float,2>{0.738738894f, 0.597124875f},
-std::array<float,2>{0.398560941f, 0.0463726632f},
-std::array<float,2>{0.0490422137f, 0.829647481f},
-std::array<float,2>{0.858025372f, 0.348574966f},
-std::array<float,2>{0.665027857f, 0.883642316f},
-std::array<float,2>{0.443716258f, 0.457634449f},
-std::array<float,2>{0.0937945917f, 0.737323046f},
-std::array<float,2>{0.779300749f, 0.24291499f},
-std::array<float,2>{0.884460449f, 0.549272716f},
-std::array<float,2>{0.157839388f, 0.113568492f},
-std::array<float,2>{0.316114932f, 0.784438908f},
-std::array<float,2>{0.581449687f, 0.2757622f},
-std::array<float,2>{0.816670537f, 0.848501742f},
-std::array<float,2>{0.00764812902f, 0.324398547f},
-std::array<float,2>{0.423006356f, 0.574066043f},
-std::array<float,2>{0.700747132f, 0.0170415342f},
-std::array<float,2>{0.514339387f, 0.628887475f},
-std::array<float,2>{0.263448119f, 0.128652081f},
-std::array<float,2>{0.246139497f, 0.956033289f},
-std::array<float,2>{0.987028599f, 0.393835396f},
-std::array<float,2>{0.533351243f, 0.945804656f},
-std::array<float,2>{0.300848037f, 0.383084506f},
-std::array<float,2>{0.218092158f, 0.651852489f},
-std::array<float,2>{0.950144589f, 0.146314964f},
-std::array<float,2>{0.866018116f, 0.582079947f},
-std::array<float,2>{0.0435453467f, 0.0153185669f},
-std::array<float,2>{0.389320761f, 0.860305369f},
-std::array<float,2>{0.732757449f, 0.335650265f},
-std::array<float,2>{0.911567509f, 0.799126685f},
-std::array<float,2>{0.134469405f, 0.265033871f},
-std::array<float,2>{0.360465199f, 0.544875085f},
-std::array<float,2>{0.600410759f, 0.0942711011f},
-std::array<float,2>{0.63821429f, 0.734094381f},
-std::array<float,2>{0.490105987f, 0.223071918f},
-std::array<float,2>{0.0816219002f, 0.900034845f},
-std::array<float,2>{0.783514082f, 0.442046613f},
-std::array<float,2>{0.706407845f, 0.815443277f},
-std::array<float,2>{0.407706887f, 0.373867899f},
-std::array<float,2>{0.0191818755f, 0.611755669f},
-std::array<float,2>{0.834164977f, 0.0609915704f},
-std::array<float,2>{0.972258508f, 0.684886158f},
-std::array<float,2>{0.225036129f, 0.179939315f},
-std::array<float,2>{0.279364973f, 0.970781684f},
-std::array<float,2>{0.529250205f, 0.409050882f},
-std::array<float,2>{0.757852376f, 0.932598531f},
-std::array<float,2>{0.118469633f, 0.478310078f},
-std::array<float,2>{0.457737535f, 0.70382005f},
-std::array<float,2>{0.675842166f, 0.206829071f},
-std::array<float,2>{0.574682117f, 0.52072984f},
-std::array<float,2>{0.333374113f, 0.0809246749f},
-std::array<float,2>{0.175177678f, 0.778380811f},
-std::array<float,2>{0.899399519f, 0.30057922f},
-std::array<float,2>{0.51786375f, 0.869214952f},
-std::array<float,2>{0.271283835f, 0.342359334f},
-std::array<float,2>{0.226732552f, 0.592940092f},
-std::array<float,2>{0.981233299f, 0.00687699998f},
-std::array<float,2>{0.839719176f, 0.646437824f},
-std::array<float,2>{0.0304450002f, 0.149222493f},
-std::array<float,2>{0.420072556f, 0.940405071f},
-std::array<float,2>{0.717616975f, 0.377385646f},
-std::array<float,2>{0.893675506f, 0.896424532f},
-std::array<float,2>{0.18111603f, 0.4466317f},
-std::array<float,2>{0.341311634f, 0.722907603f},
-std::array<float,2>{0.566641331f, 0.233194783f},
-std::array<float,2>{0.684778154f, 0.536595225f},
-std::array<float,2>{0.466158926f, 0.102350786f},
-std::array<float,2>{0.11025466f, 0.811089158f},
-std::array<float,2>{0.753350198f, 0.251152039f},
-std::array<float,2>{0.724813581f, 0.9834342f},
-std::array<float,2>{0.380113333f, 0.421631128f},
-std::array<float,2>{0.0349066369f, 0.67754668f},
-std::array<float,2>{0.869594455f, 0.176598847f},
-std::array<float,2>{0.943077564f, 0.61871314f},
-std::array<float,2>{0.206941187f, 0.0522735268f},
-std::array<float,2>{0.306210667f, 0.826393187f},
-std::array<float,2>{0.539210141f, 0.360295862f},
-std::array<float,2>{0.79373318f, 0.768131852f},
-std::array<float,2>{0.0906035379f, 0.307173193f},
-std::array<float,2>{0.492972404f, 0.527320325f},
-std::array<float,2>{0.626808882f, 0.0869653374f},
-std::array<float,2>{0.609252214f, 0.717271149f},
-std::array<float,2>{0.370120913f, 0.21471411f},
-std::array<float,2>{0.130322352f, 0.927153885f},
-std::array<float,2>{0.916038513f, 0.473536462f},
-std::array<float,2>{0.593042135f, 0.916654825f},
-std::array<float,2>{0.322878242f, 0.485715777f},
-std::array<float,2>{0.171621963f, 0.689683557f},
-std::array<float,2>{0.875155866f, 0.189277366f},
-std::array<float,2>{0.769733369f, 0.509399176f},
-std::array<float,2>{0.102252826f, 0.0628995076f},
-std::array<float,2>{0.448389947f, 0.760646462f},
-std::array<float,2>{0.657514691f, 0.281580269f},
-std::array<float,2>{0.996003509f, 0.837910116f},
-std::array<float,2>{0.238019347f, 0.35748899f},
-std::array<float,2>{0.253423214f, 0.603780568f},
-std::array<float,2>{0.503777921f, 0.0363001674f},
-std::array<float,2>{0.690536916f, 0.664817333f},
-std::array<float,2>{0.435917616f, 0.161284462f},
-std::array<float,2>{0.0114725288f, 0.986322641f},
-std::array<float,2>{0.827076018f, 0.423836499f},
-std::array<float,2>{0.647526145f, 0.794993699f},
-std::array<float,2>{0.477970898f, 0.267830372f},
-std::array<float,2>{0.0774527565f, 0.557214379f},
-std::array<float,2>{0.809631169f, 0.117222503f},
-std::array<float,2>{0.934414446f, 0.749672592f},
-std::array<float,2>{0.14560245f, 0.236329019f},
-std::array<float,2>{0.348231763f, 0.88087666f},
-std::array<float,2>{0.62302506f, 0.467690468f},
-std::array<float,2>{0.850542247f, 0.96680367f},
-std::array<float,2>{0.0600213669f, 0.40497008f},
-std::array<float,2>{0.395157397f, 0.635656595f},
-std::array<float,2>{0.749624431f, 0.139263809f},
-std::array<float,2>{0.552180171f, 0.568696678f},
-std::array<float,2>{0.293488592f, 0.0308758151f},
-std::array<float,2>{0.188178971f, 0.855043828f},
-std::array<float,2>{0.964128494f, 0.315553069f},
-std::array<float,2>{0.561701238f, 0.806200743f},
-std::array<float,2>{0.283984095f, 0.256507009f},
-std::array<float,2>{0.19753094f, 0.534036815f},
-std::array<float,2>{0.955122769f, 0.108396523f},
-std::array<float,2>{0.855096638f, 0.722572803f},
-std::array<float,2>{0.0516028702f, 0.226694405f},
-std::array<float,2>{0.404663116f, 0.891562581f},
-std::array<float,2>{0.734495699f, 0.451200455f},
-std::array<float,2>{0.926839352f, 0.941453874f},
-std::array<float,2>{0.149626553f, 0.382559121f},
-std::array<float,2>{0.352157652f, 0.641236842f},
-std::array<float,2>{0.615579784f, 0.153703988f},
-std::array<float,2>{0.655285895f, 0.588467062f},
-std::array<float,2>{0.476060569f, 0.0022179205f},
-std::array<float,2>{0.0670069978f, 0.874800682f},
-std::array<float,2>{0.804568589f, 0.337529212f},
-std::array<float,2>{0.695582807f, 0.921974719f},
-std::array<float,2>{0.427911311f, 0.471581757f},
-std::array<float,2>{0.0025074149f, 0.711006105f},
-std::array<float,2>{0.815174997f, 0.214912906f},
-std::array<float,2>{0.991908133f, 0.530454159f},
-std::array<float,2>{0.242334574f, 0.0930821672f},
-std::array<float,2>{0.25945133f, 0.771951437f},
-std::array<float,2>{0.509843767f, 0.309654295f},
-std::array<float,2>{0.776159048f, 0.823885381f},
-std::array<float,2>{0.101222478f, 0.366318762f},
-std::array<float,2>{0.439135432f, 0.624098718f},
-std::array<float,2>{0.671139657f, 0.0496623889f},
-std::array<float,2>{0.58253932f, 0.674172103f},
-std::array<float,2>{0.317415565f, 0.175299168f},
-std::array<float,2>{0.162116915f, 0.97748071f},
-std::array<float,2>{0.889581025f, 0.414421618f},
-std::array<float,2>{0.594869435f, 0.9889552f},
-std::array<float,2>{0.364555955f, 0.428799689f},
-std::array<float,2>{0.138933331f, 0.671809673f},
-std::array<float,2>{0.908608973f, 0.158229187f},
-std::array<float,2>{0.787694752f, 0.607257605f},
-std::array<float,2>{0.0858933106f, 0.0324257389f},
-std::array<float,2>{0.486121982f, 0.839962661f},
-std::array<float,2>{0.634496629f, 0.354961455f},
-std::array<float,2>{0.9453758f, 0.764921606f},
-std::array<float,2>{0.212436095f, 0.286621422f},
-std::array<float,2>{0.299390912f, 0.513486564f},
-std::array<float,2>{0.537572324f, 0.070065923f},
-std::array<float,2>{0.72698313f, 0.693685353f},
-std::array<float,2>{0.383410275f, 0.194046155f},
-std::array<float,2>{0.0396751687f, 0.918119967f},
-std::array<float,2>{0.862843335f, 0.489159703f},
-std::array<float,2>{0.67392683f, 0.856569707f},
-std::array<float,2>{0.455030292f, 0.317685574f},
-std::array<float,2>{0.121849008f, 0.565753281f},
-std::array<float,2>{0.763635814f, 0.0270814393f},
-std::array<float,2>{0.905035257f, 0.639896393f},
-std::array<float,2>{0.178953767f, 0.133002669f},
-std::array<float,2>{0.329949707f, 0.964782715f},
-std::array<float,2>{0.571535468f, 0.400324672f},
-std::array<float,2>{0.830735803f, 0.876550496f},
-std::array<float,2>{0.0229112096f, 0.463821471f},
-std::array<float,2>{0.412714422f, 0.742746234f},
-std::array<float,2>{0.710665762f, 0.239325106f},
-std::array<float,2>{0.525112152f, 0.561822116f},
-std::array<float,2>{0.275728792f, 0.123285338f},
-std::array<float,2>{0.218957871f, 0.792717576f},
-std::array<float,2>{0.973469973f, 0.271071136f},
-std::array<float,2>{0.564171851f, 0.832282186f},
-std::array<float,2>{0.338071346f, 0.344906837f},
-std::array<float,2>{0.185185254f, 0.598069012f},
-std::array<float,2>{0.897571385f, 0.0417672954f},
-std::array<float,2>{0.754368305f, 0.662864506f},
-std::array<float,2>{0.116028205f, 0.166525707f},
-std::array<float,2>{0.4614003f, 0.993890047f},
-std::array<float,2>{0.680603862f, 0.434862137f},
-std::array<float,2>{0.979607582f, 0.909312487f},
-std::array<float,2>{0.231994301f, 0.497887164f},
-std::array<float,2>{0.267944992f, 0.696828604f},
-std::array<float,2>{0.521450579f, 0.198824376f},
-std::array<float,2>{0.713590086f, 0.503526926f},
-std::array<float,2>{0.417739987f, 0.0749518052f},
-std::array<float,2>{0.0242662951f, 0.757754147f},
-std::array<float,2>{0.842196882f, 0.29682216f},
-std::array<float,2>{0.631020606f, 0.957903147f},
-std::array<float,2>{0.499995559f, 0.396884084f},
-std::array<float,2>{0.0893923268f, 0.630108058f},
-std::array<float,2>{0.792177379f, 0.130318746f},
-std::array<float,2>{0.920630157f, 0.577613652f},
-std::array<float,2>{0.126159161f, 0.0203588177f},
-std::array<float,2>{0.373848587f, 0.847330809f},
-std::array<float,2>{0.605110765f, 0.323781669f},
-std::array<float,2>{0.873137593f, 0.786239982f},
-std::array<float,2>{0.0365482196f, 0.278288752f},
-std::array<float,2>{0.377536684f, 0.553249538f},
-std::array<float,2>{0.72046876f, 0.110201374f},
-std::array<float,2>{0.544032753f, 0.740613937f},
-std::array<float,2>{0.311371773f, 0.246454537f},
-std::array<float,2>{0.209516242f, 0.889001727f},
-std::array<float,2>{0.938186049f, 0.456885815f},
-std::array<float,2>{0.506405234f, 0.904923081f},
-std::array<float,2>{0.253929049f, 0.438897312f},
-std::array<float,2>{0.238559872f, 0.727957249f},
-std::array<float,2>{0.998634398f, 0.220753357f},
-std::array<float,2>{0.821857691f, 0.540797472f},
-std::array<float,2>{0.0150241638f, 0.101538107f},
-std::array<float,2>{0.429918915f, 0.803288817f},
-std::array<float,2>{0.694574118f, 0.260685146f},
-std::array<float,2>{0.88050139f, 0.864605546f},
-std::array<float,2>{0.166792959f, 0.328360647f},
-std::array<float,2>{0.326068789f, 0.58020407f},
-std::array<float,2>{0.589034736f, 0.0106670838f},
-std::array<float,2>{0.661035955f, 0.655044258f},
-std::array<float,2>{0.450481087f, 0.142272279f},
-std::array<float,2>{0.108068138f, 0.951809466f},
-std::array<float,2>{0.768529177f, 0.386856019f},
-std::array<float,2>{0.745293558f, 0.775527418f},
-std::array<float,2>{0.392329395f, 0.302743912f},
-std::array<float,2>{0.0551147684f, 0.517377317f},
-std::array<float,2>{0.846527576f, 0.0843380988f},
-std::array<float,2>{0.965489864f, 0.707663059f},
-std::array<float,2>{0.191982821f, 0.210463032f},
-std::array<float,2>{0.291542292f, 0.936242878f},
-std::array<float,2>{0.54697156f, 0.482241035f},
-std::array<float,2>{0.806086242f, 0.972735286f},
-std::array<float,2>{0.0727866068f, 0.410389304f},
-std::array<float,2>{0.481221884f, 0.679732442f},
-std::array<float,2>{0.641461134f, 0.18405138f},
-std::array<float,2>{0.617438018f, 0.61541152f},
-std::array<float,2>{0.346981794f, 0.0568610169f},
-std::array<float,2>{0.140866876f, 0.820147872f},
-std::array<float,2>{0.932848096f, 0.367564082f},
-std::array<float,2>{0.57875526f, 0.781825721f},
-std::array<float,2>{0.313815266f, 0.27381137f},
-std::array<float,2>{0.159581885f, 0.547897875f},
-std::array<float,2>{0.886157215f, 0.116923288f},
-std::array<float,2>{0.778355241f, 0.734744191f},
-std::array<float,2>{0.0966615677f, 0.245580122f},
-std::array<float,2>{0.441991925f, 0.885708094f},
-std::array<float,2>{0.667378902f, 0.460786194f},
-std::array<float,2>{0.984927714f, 0.954131722f},
-std::array<float,2>{0.24975656f, 0.391357481f},
-std::array<float,2>{0.264034986f, 0.625293791f},
-std::array<float,2>{0.513497829f, 0.125619441f},
-std::array<float,2>{0.701412261f, 0.570804775f},
-std::array<float,2>{0.424038261f, 0.0178732034f},
-std::array<float,2>{0.00571608404f, 0.850517929f},
-std::array<float,2>{0.819520235f, 0.327868432f},
-std::array<float,2>{0.651819408f, 0.911486924f},
-std::array<float,2>{0.469228774f, 0.493401438f},
-std::array<float,2>{0.0625056624f, 0.700753093f},
-std::array<float,2>{0.797960818f, 0.200407803f},
-std::array<float,2>{0.922540247f, 0.507015884f},
-std::array<float,2>{0.154517621f, 0.0739275888f},
-std::array<float,2>{0.358581483f, 0.752603769f},
-std::array<float,2>{0.610186815f, 0.289309949f},
-std::array<float,2>{0.856231153f, 0.831941545f},
-std::array<float,2>{0.0483409613f, 0.351058573f},
-std::array<float,2>{0.402274817f, 0.594135582f},
-std::array<float,2>{0.742165208f, 0.0445350893f},
-std::array<float,2>{0.556977212f, 0.657520294f},
-std::array<float,2>{0.285499483f, 0.168639496f},
-std::array<float,2>{0.202282578f, 0.999180317f},
-std::array<float,2>{0.958171725f, 0.43150866f},
-std::array<float,2>{0.529666185f, 0.969222128f},
-std::array<float,2>{0.278398216f, 0.407620043f},
-std::array<float,2>{0.223128602f, 0.686578572f},
-std::array<float,2>{0.968814373f, 0.182141304f},
-std::array<float,2>{0.833598793f, 0.60980767f},
-std::array<float,2>{0.0157915875f, 0.0592738651f},
-std::array<float,2>{0.410033822f, 0.813969791f},
-std::array<float,2>{0.703143299f, 0.371669263f},
-std::array<float,2>{0.901627064f, 0.779415548f},
-std::array<float,2>{0.17311208f, 0.297473222f},
-std::array<float,2>{0.335838258f, 0.521633446f},
-std::array<float,2>{0.576352596f, 0.0791868716f},
-std::array<float,2>{0.678714812f, 0.705922842f},
-std::array<float,2>{0.460334629f, 0.204608515f},
-std::array<float,2>{0.11996422f, 0.929731369f},
-std::array<float,2>{0.761552513f, 0.478563607f},
-std::array<float,2>{0.732394636f, 0.862486243f},
-std::array<float,2>{0.386893034f, 0.332695186f},
-std::array<float,2>{0.0452018976f, 0.585924089f},
-std::array<float,2>{0.86446619f, 0.0117218988f},
-std::array<float,2>{0.95148766f, 0.648467422f},
-std::array<float,2>{0.21562086f, 0.147764042f},
-std::array<float,2>{0.303045452f, 0.948850036f},
-std::array<float,2>{0.531442165f, 0.384792566f},
-std::array<float,2>{0.781780839f, 0.901329637f},
-std::array<float,2>{0.079896681f, 0.444180846f},
-std::array<float,2>{0.491946191f, 0.73110503f},
-std::array<float,2>{0.640080094f, 0.225912094f},
-std::array<float,2>{0.597755671f, 0.544939578f},
-std::array<float,2>{0.362826496f, 0.0967435017f},
-std::array<float,2>{0.135414883f, 0.797051549f},
-std::array<float,2>{0.912448585f, 0.26342541f},
-std::array<float,2>{0.541234851f, 0.825637519f},
-std::array<float,2>{0.30726701f, 0.362726837f},
-std::array<float,2>{0.204521522f, 0.619984388f},
-std::array<float,2>{0.944482505f, 0.053450454f},
-std::array<float,2>{0.868243635f, 0.678817451f},
-std::array<float,2>{0.0321458429f, 0.178088933f},
-std::array<float,2>{0.38216731f, 0.982303202f},
-std::array<float,2>{0.724451065f, 0.418071151f},
-std::array<float,2>{0.91599524f, 0.928680897f},
-std::array<float,2>{0.132057905f, 0.475689858f},
-std::array<float,2>{0.368749052f, 0.716792107f},
-std::array<float,2>{0.606903374f, 0.211450592f},
-std::array<float,2>{0.628443301f, 0.525030077f},
-std::array<float,2>{0.495111376f, 0.0879664496f},
-std::array<float,2>{0.0933395252f, 0.767524779f},
-std::array<float,2>{0.795217633f, 0.30509156f},
-std::array<float,2>{0.716731131f, 0.938920856f},
-std::array<float,2>{0.418164611f, 0.3754403f},
-std::array<float,2>{0.0278741457f, 0.647131622f},
-std::array<float,2>{0.83690238f, 0.151275441f},
-std::array<float,2>{0.983290851f, 0.590932965f},
-std::array<float,2>{0.229992121f, 0.00404037954f},
-std::array<float,2>{0.272429287f, 0.867969096f},
-std::array<float,2>{0.516689599f, 0.33998093f},
-std::array<float,2>{0.750340462f, 0.810354114f},
-std::array<float,2>{0.112372451f, 0.252807915f},
-std::array<float,2>{0.468092233f, 0.537749767f},
-std::array<float,2>{0.686125338f, 0.104774259f},
-std::array<float,2>{0.568395138f, 0.724950671f},
-std::array<float,2>{0.341915399f, 0.232097849f},
-std::array<float,2>{0.182006955f, 0.897303402f},
-std::array<float,2>{0.891244829f, 0.447428167f},
-std::array<float,2>{0.624914348f, 0.879692793f},
-std::array<float,2>{0.350922704f, 0.465014398f},
-std::array<float,2>{0.146540642f, 0.746840477f},
-std::array<float,2>{0.937144876f, 0.234402731f},
-std::array<float,2>{0.810595155f, 0.556125045f},
-std::array<float,2>{0.0749231502f, 0.120431215f},
-std::array<float,2>{0.479116738f, 0.794004261f},
-std::array<float,2>{0.645388186f, 0.267474443f},
-std::array<float,2>{0.961810648f, 0.852230966f},
-std::array<float,2>{0.190289661f, 0.313676685f},
-std::array<float,2>{0.296805978f, 0.567972839f},
-std::array<float,2>{0.55436188f, 0.0279879831f},
-std::array<float,2>{0.747581363f, 0.633497059f},
-std::array<float,2>{0.398139894f, 0.138033137f},
-std::array<float,2>{0.0611775368f, 0.966724277f},
-std::array<float,2>{0.84813118f, 0.403244913f},
-std::array<float,2>{0.658221841f, 0.758689225f},
-std::array<float,2>{0.446355909f, 0.283799827f},
-std::array<float,2>{0.104776062f, 0.51039201f},
-std::array<float,2>{0.772502601f, 0.0657602549f},
-std::array<float,2>{0.877499521f, 0.688881099f},
-std::array<float,2>{0.16802533f, 0.190929189f},
-std::array<float,2>{0.321271241f, 0.914074481f},
-std::array<float,2>{0.590166867f, 0.487816185f},
-std::array<float,2>{0.824335217f, 0.988152325f},
-std::array<float,2>{0.00825559441f, 0.422730774f},
-std::array<float,2>{0.433873236f, 0.666865766f},
-std::array<float,2>{0.687822819f, 0.16277945f},
-std::array<float,2>{0.500932336f, 0.603251398f},
-std::array<float,2>{0.250833601f, 0.0384267159f},
-std::array<float,2>{0.235012069f, 0.836546719f},
-std::array<float,2>{0.993052959f, 0.356337667f},
-std::array<float,2>{0.508784831f, 0.770928204f},
-std::array<float,2>{0.260551572f, 0.311153829f},
-std::array<float,2>{0.245687485f, 0.527519464f},
-std::array<float,2>{0.989717245f, 0.0903229341f},
-std::array<float,2>{0.813013732f, 0.713623464f},
-std::array<float,2>{0.000255819061f, 0.217417464f},
-std::array<float,2>{0.4273175f, 0.925297558f},
-std::array<float,2>{0.699169159f, 0.470428914f},
-std::array<float,2>{0.887157977f, 0.980347991f},
-std::array<float,2>{0.161489084f, 0.417079061f},
-std::array<float,2>{0.320066333f, 0.673101008f},
-std::array<float,2>{0.585396588f, 0.172877237f},
-std::array<float,2>{0.669631779f, 0.621930063f},
-std::array<float,2>{0.440038204f, 0.048598852f},
-std::array<float,2>{0.0987514779f, 0.821549296f},
-std::array<float,2>{0.774160028f, 0.364960223f},
-std::array<float,2>{0.738063753f, 0.892772198f},
-std::array<float,2>{0.403934836f, 0.450332463f},
-std::array<float,2>{0.0545019619f, 0.718980849f},
-std::array<float,2>{0.851948977f, 0.230037451f},
-std::array<float,2>{0.953262806f, 0.53189069f},
-std::array<float,2>{0.195892677f, 0.106448866f},
-std::array<float,2>{0.283023298f, 0.808374166f},
-std::array<float,2>{0.559914052f, 0.255711913f},
-std::array<float,2>{0.802670777f, 0.87293458f},
-std::array<float,2>{0.0701217204f, 0.339828044f},
-std::array<float,2>{0.473160744f, 0.587426782f},
-std::array<float,2>{0.65411675f, 0.000658630102f},
-std::array<float,2>{0.614989758f, 0.642922521f},
-std::array<float,2>{0.354781151f, 0.154578656f},
-std::array<float,2>{0.150542393f, 0.944925308f},
-std::array<float,2>{0.928917348f, 0.379565209f},
-std::array<float,2>{0.572709143f, 0.961768627f},
-std::array<float,2>{0.331097871f, 0.400500417f},
-std::array<float,2>{0.17603752f, 0.637048721f},
-std::array<float,2>{0.903291225f, 0.135089457f},
-std::array<float,2>{0.763859272f, 0.564122736f},
-std::array<float,2>{0.124795094f, 0.0252500121f},
-std::array<float,2>{0.455122471f, 0.858648121f},
-std::array<float,2>{0.673801661f, 0.320057392f},
-std::array<float,2>{0.975384533f, 0.790934682f},
-std::array<float,2>{0.222576007f, 0.27232039f},
-std::array<float,2>{0.273620933f, 0.55956459f},
-std::array<float,2>{0.527197599f, 0.121952899f},
-std::array<float,2>{0.70731473f, 0.744494319f},
-std::array<float,2>{0.412072241f, 0.241793379f},
-std::array<float,2>{0.0210058223f, 0.878108442f},
-std::array<float,2>{0.829317153f, 0.462048769f},
-std::array<float,2>{0.635258794f, 0.84349829f},
-std::array<float,2>{0.486344039f, 0.351928413f},
-std::array<float,2>{0.0823783204f, 0.608276486f},
-std::array<float,2>{0.786005378f, 0.0334029645f},
-std::array<float,2>{0.906843305f, 0.669602633f},
-std::array<float,2>{0.136925101f, 0.156545863f},
-std::array<float,2>{0.366278589f, 0.991705954f},
-std::array<float,2>{0.596706629f, 0.426118314f},
-std::array<float,2>{0.859705925f, 0.920608342f},
-std::array<float,2>{0.0419018455f, 0.491942137f},
-std::array<float,2>{0.385235876f, 0.691635728f},
-std::array<float,2>{0.729024351f, 0.192087159f},
-std::array<float,2>{0.536696017f, 0.514807999f},
-std::array<float,2>{0.298751265f, 0.0668251291f},
-std::array<float,2>{0.214568615f, 0.76179117f},
-std::array<float,2>{0.947701216f, 0.287912369f},
-std::array<float,2>{0.601734042f, 0.844790339f},
-std::array<float,2>{0.373008788f, 0.321439475f},
-std::array<float,2>{0.128662035f, 0.575375557f},
-std::array<float,2>{0.918406069f, 0.0223159567f},
-std::array<float,2>{0.790781975f, 0.632153928f},
-std::array<float,2>{0.0868357718f, 0.132181838f},
-std::array<float,2>{0.49646765f, 0.959374011f},
-std::array<float,2>{0.629481554f, 0.395832628f},
-std::array<float,2>{0.939718843f, 0.8879022f},
-std::array<float,2>{0.208320603f, 0.45386523f},
-std::array<float,2>{0.309608996f, 0.739381015f},
-std::array<float,2>{0.546351552f, 0.249205291f},
-std::array<float,2>{0.722237527f, 0.552318752f},
-std::array<float,2>{0.375709683f, 0.111763969f},
-std::array<float,2>{0.0385214835f, 0.787411511f},
-std::array<float,2>{0.872419715f, 0.279500335f},
-std::array<float,2>{0.682964206f, 0.994966686f},
-std::array<float,2>{0.463860899f, 0.436812043f},
-std::array<float,2>{0.113975048f, 0.661521435f},
-std::array<float,2>{0.756170988f, 0.165253475f},
-std::array<float,2>{0.894636631f, 0.600275338f},
-std::array<float,2>{0.187177777f, 0.0408723578f},
-std::array<float,2>{0.336422026f, 0.835572779f},
-std::array<float,2>{0.566233277f, 0.347176313f},
-std::array<float,2>{0.840053439f, 0.754208267f},
-std::array<float,2>{0.0272388384f, 0.293050349f},
-std::array<float,2>{0.414266646f, 0.501052678f},
-std::array<float,2>{0.711408019f, 0.0780958161f},
-std::array<float,2>{0.522709131f, 0.697730124f},
-std::array<float,2>{0.265812069f, 0.197169334f},
-std::array<float,2>{0.234253481f, 0.906742275f},
-std::array<float,2>{0.977920234f, 0.498615831f},
-std::array<float,2>{0.550321221f, 0.93531388f},
-std::array<float,2>{0.289745897f, 0.482661277f},
-std::array<float,2>{0.195236921f, 0.710297346f},
-std::array<float,2>{0.967983425f, 0.20757772f},
-std::array<float,2>{0.844645202f, 0.519398153f},
-std::array<float,2>{0.058022704f, 0.0837076008f},
-std::array<float,2>{0.392680168f, 0.774616897f},
-std::array<float,2>{0.742566109f, 0.302058101f},
-std::array<float,2>{0.931572855f, 0.817309141f},
-std::array<float,2>{0.14451772f, 0.3699691f},
-std::array<float,2>{0.345429718f, 0.614824176f},
-std::array<float,2>{0.620416939f, 0.0557759777f},
-std::array<float,2>{0.642722607f, 0.682782948f},
-std::array<float,2>{0.484217256f, 0.186767131f},
-std::array<float,2>{0.0722160116f, 0.97531867f},
-std::array<float,2>{0.807760239f, 0.412373275f},
-std::array<float,2>{0.693131924f, 0.80125761f},
-std::array<float,2>{0.432010651f, 0.258374244f},
-std::array<float,2>{0.0117818154f, 0.541218162f},
-std::array<float,2>{0.82251209f, 0.0979013294f},
-std::array<float,2>{0.996112823f, 0.730074584f},
-std::array<float,2>{0.240354881f, 0.2195656f},
-std::array<float,2>{0.257334143f, 0.90395534f},
-std::array<float,2>{0.504071116f, 0.440064341f},
-std::array<float,2>{0.767040074f, 0.950583398f},
-std::array<float,2>{0.107092313f, 0.390033066f},
-std::array<float,2>{0.451278299f, 0.653186977f},
-std::array<float,2>{0.663329661f, 0.143087044f},
-std::array<float,2>{0.58777231f, 0.578533828f},
-std::array<float,2>{0.327984303f, 0.00781565811f},
-std::array<float,2>{0.164364979f, 0.866358697f},
-std::array<float,2>{0.882572234f, 0.331438601f},
-std::array<float,2>{0.601252854f, 0.797870874f},
-std::array<float,2>{0.359491616f, 0.261951566f},
-std::array<float,2>{0.133742496f, 0.545997679f},
-std::array<float,2>{0.910676241f, 0.0959682241f},
-std::array<float,2>{0.78438592f, 0.732134581f},
-std::array<float,2>{0.0806163624f, 0.224673048f},
-std::array<float,2>{0.488397568f, 0.901437163f},
-std::array<float,2>{0.637090862f, 0.445001632f},
-std::array<float,2>{0.951139033f, 0.947848737f},
-std::array<float,2>{0.216896981f, 0.386601508f},
-std::array<float,2>{0.302140057f, 0.649861336f},
-std::array<float,2>{0.534606099f, 0.146802008f},
-std::array<float,2>{0.733814716f, 0.584627986f},
-std::array<float,2>{0.389976293f, 0.0133193443f},
-std::array<float,2>{0.0444475226f, 0.862200201f},
-std::array<float,2>{0.86650604f, 0.333563477f},
-std::array<float,2>{0.677269638f, 0.931199431f},
-std::array<float,2>{0.45806393f, 0.479911149f},
-std::array<float,2>{0.118133873f, 0.706114352f},
-std::array<float,2>{0.759504497f, 0.203569517f},
-std::array<float,2>{0.899775028f, 0.523249209f},
-std::array<float,2>{0.174193338f, 0.078297317f},
-std::array<float,2>{0.332208425f, 0.780449569f},
-std::array<float,2>{0.576099873f, 0.298326761f},
-std::array<float,2>{0.835641801f, 0.812593758f},
-std::array<float,2>{0.0180918183f, 0.373042673f},
-std::array<float,2>{0.407110065f, 0.610825002f},
-std::array<float,2>{0.705857694f, 0.0598693714f},
-std::array<float,2>{0.527795434f, 0.686127126f},
-std::array<float,2>{0.281095982f, 0.183513477f},
-std::array<float,2>{0.22582598f, 0.969748139f},
-std::array<float,2>{0.97111237f, 0.406250358f},
-std::array<float,2>{0.554922402f, 0.998762548f},
-std::array<float,2>{0.28807956f, 0.430229723f},
-std::array<float,2>{0.199842855f, 0.657145679f},
-std::array<float,2>{0.960315228f, 0.169221237f},
-std::array<float,2>{0.859235764f, 0.594989777f},
-std::array<float,2>{0.0506437644f, 0.0437405258f},
-std::array<float,2>{0.400072068f, 0.830222428f},
-std::array<float,2>{0.739659011f, 0.350439191f},
-std::array<float,2>{0.923966944f, 0.753410816f},
-std::array<float,2>{0.15294382f, 0.290049583f},
-std::array<float,2>{0.35706237f, 0.506097496f},
-std::array<float,2>{0.612938583f, 0.0726398081f},
-std::array<float,2>{0.649094343f, 0.699917376f},
-std::array<float,2>{0.47147432f, 0.200081572f},
-std::array<float,2>{0.0650278628f, 0.910596073f},
-std::array<float,2>{0.800466716f, 0.492298186f},
-std::array<float,2>{0.6993168f, 0.851048112f},
-std::array<float,2>{0.421933621f, 0.32652393f},
-std::array<float,2>{0.00676741917f, 0.571727872f},
-std::array<float,2>{0.817873418f, 0.018625414f},
-std::array<float,2>{0.98817265f, 0.62686938f},
-std::array<float,2>{0.247803688f, 0.126392424f},
-std::array<float,2>{0.262648195f, 0.953867733f},
-std::array<float,2>{0.515381038f, 0.391998947f},
-std::array<float,2>{0.780671299f, 0.885808825f},
-std::array<float,2>{0.0951674134f, 0.459248483f},
-std::array<float,2>{0.444726348f, 0.735482752f},
-std::array<float,2>{0.665741384f, 0.244869947f},
-std::array<float,2>{0.580563128f, 0.547568738f},
-std::array<float,2>{0.31445691f, 0.115384012f},
-std::array<float,2>{0.156419441f, 0.782493055f},
-std::array<float,2>{0.883377135f, 0.274952948f},
-std::array<float,2>{0.502598405f, 0.837453723f},
-std::array<float,2>{0.252654225f, 0.356547475f},
-std::array<float,2>{0.236474782f, 0.60239464f},
-std::array<float,2>{0.994623065f, 0.0379721187f},
-std::array<float,2>{0.827225983f, 0.667394936f},
-std::array<float,2>{0.0102482606f, 0.163996652f},
-std::array<float,2>{0.437199861f, 0.986382544f},
-std::array<float,2>{0.689746976f, 0.423657358f},
-std::array<float,2>{0.876181126f, 0.915695369f},
-std::array<float,2>{0.170470953f, 0.486707628f},
-std::array<float,2>{0.323721558f, 0.688292265f},
-std::array<float,2>{0.592745006f, 0.189468503f},
-std::array<float,2>{0.656571805f, 0.511272252f},
-std::array<float,2>{0.447964638f, 0.0646075308f},
-std::array<float,2>{0.102925256f, 0.759713888f},
-std::array<float,2>{0.77091217f, 0.284355938f},
-std::array<float,2>{0.748845458f, 0.965445817f},
-std::array<float,2>{0.396414518f, 0.403450459f},
-std::array<float,2>{0.058942847f, 0.634145617f},
-std::array<float,2>{0.850634813f, 0.13753216f},
-std::array<float,2>{0.96292758f, 0.567234635f},
-std::array<float,2>{0.189042374f, 0.028726127f},
-std::array<float,2>{0.294664502f, 0.852601409f},
-std::array<float,2>{0.551746726f, 0.312835246f},
-std::array<float,2>{0.809352994f, 0.793914676f},
-std::array<float,2>{0.0762536079f, 0.265928149f},
-std::array<float,2>{0.476672918f, 0.555074155f},
-std::array<float,2>{0.647046745f, 0.119591452f},
-std::array<float,2>{0.621587873f, 0.747208297f},
-std::array<float,2>{0.349506408f, 0.235842049f},
-std::array<float,2>{0.144641444f, 0.880539596f},
-std::array<float,2>{0.935212374f, 0.465893537f},
-std::array<float,2>{0.567982376f, 0.898001313f},
-std::array<float,2>{0.340806007f, 0.44864133f},
-std::array<float,2>{0.18042095f, 0.725719988f},
-std::array<float,2>{0.893444836f, 0.231227234f},
-std::array<float,2>{0.751975f, 0.538205564f},
-std::array<float,2>{0.110757604f, 0.104209185f},
-std::array<float,2>{0.465759903f, 0.808969319f},
-std::array<float,2>{0.684204042f, 0.253481895f},
-std::array<float,2>{0.981843829f, 0.868566692f},
-std::array<float,2>{0.22760199f, 0.341182441f},
-std::array<float,2>{0.269622356f, 0.590164125f},
-std::array<float,2>{0.519259274f, 0.00509041129f},
-std::array<float,2>{0.718585908f, 0.6479159f},
-std::array<float,2>{0.421008736f, 0.151843622f},
-std::array<float,2>{0.0298510659f, 0.937538445f},
-std::array<float,2>{0.838512897f, 0.376324028f},
-std::array<float,2>{0.625781715f, 0.765874028f},
-std::array<float,2>{0.493915796f, 0.305695713f},
-std::array<float,2>{0.0912519544f, 0.524321973f},
-std::array<float,2>{0.794639826f, 0.0892317295f},
-std::array<float,2>{0.91745156f, 0.715362728f},
-std::array<float,2>{0.129384264f, 0.212439671f},
-std::array<float,2>{0.370068133f, 0.928894818f},
-std::array<float,2>{0.60826844f, 0.475398451f},
-std::array<float,2>{0.870414197f, 0.981415927f},
-std::array<float,2>{0.0334921815f, 0.419513345f},
-std::array<float,2>{0.3790254f, 0.678190947f},
-std::array<float,2>{0.726486742f, 0.17938742f},
-std::array<float,2>{0.540285051f, 0.620907485f},
-std::array<float,2>{0.305063128f, 0.0544883609f},
-std::array<float,2>{0.205935165f, 0.824739277f},
-std::array<float,2>{0.942062259f, 0.361348242f},
-std::array<float,2>{0.538555562f, 0.76364994f},
-std::array<float,2>{0.300219476f, 0.288923055f},
-std::array<float,2>{0.211109892f, 0.514254391f},
-std::array<float,2>{0.947215199f, 0.0683119223f},
-std::array<float,2>{0.861345053f, 0.693008184f},
-std::array<float,2>{0.0405082963f, 0.192461312f},
-std::array<float,2>{0.38470614f, 0.92130971f},
-std::array<float,2>{0.72850877f, 0.490606844f},
-std::array<float,2>{0.909829855f, 0.990941107f},
-std::array<float,2>{0.14020735f, 0.427593648f},
-std::array<float,2>{0.364016891f, 0.668769479f},
-std::array<float,2>{0.594654858f, 0.157721803f},
-std::array<float,2>{0.633190274f, 0.608934224f},
-std::array<float,2>{0.484596878f, 0.0350626521f},
-std::array<float,2>{0.0842707008f, 0.842182398f},
-std::array<float,2>{0.788771451f, 0.353185326f},
-std::array<float,2>{0.709613979f, 0.877399087f},
-std::array<float,2>{0.413591176f, 0.460939139f},
-std::array<float,2>{0.0222596247f, 0.745130658f},
-std::array<float,2>{0.831262648f, 0.241169021f},
-std::array<float,2>{0.974573076f, 0.560323119f},
-std::array<float,2>{0.219756708f, 0.122664228f},
-std::array<float,2>{0.276741922f, 0.789303303f},
-std::array<float,2>{0.52388519f, 0.272652179f},
-std::array<float,2>{0.761762738f, 0.857709646f},
-std::array<float,2>{0.122660078f, 0.319040895f},
-std::array<float,2>{0.454084694f, 0.563118041f},
-std::array<float,2>{0.675673902f, 0.0237105954f},
-std::array<float,2>{0.570804834f, 0.637964368f},
-std::array<float,2>{0.328865886f, 0.136487871f},
-std::array<float,2>{0.1784354f, 0.962559521f},
-std::array<float,2>{0.906055748f, 0.40202105f},
-std::array<float,2>{0.616492569f, 0.943611622f},
-std::array<float,2>{0.353038996f, 0.380821466f},
-std::array<float,2>{0.148887351f, 0.64382571f},
-std::array<float,2>{0.926060557f, 0.155965f},
-std::array<float,2>{0.803552449f, 0.586507857f},
-std::array<float,2>{0.0675516725f, 0.00117052696f},
-std::array<float,2>{0.475464016f, 0.871956408f},
-std::array<float,2>{0.654533327f, 0.338351279f},
-std::array<float,2>{0.956524968f, 0.80676204f},
-std::array<float,2>{0.198620871f, 0.254505128f},
-std::array<float,2>{0.284746468f, 0.533100724f},
-std::array<float,2>{0.561066747f, 0.106159776f},
-std::array<float,2>{0.735411048f, 0.720041454f},
-std::array<float,2>{0.405605882f, 0.229072869f},
-std::array<float,2>{0.0525924116f, 0.894340515f},
-std::array<float,2>{0.854293585f, 0.449561298f},
-std::array<float,2>{0.670315325f, 0.820361316f},
-std::array<float,2>{0.437685013f, 0.363878548f},
-std::array<float,2>{0.0997977853f, 0.622184396f},
-std::array<float,2>{0.777219117f, 0.0477380343f},
-std::array<float,2>{0.889865816f, 0.672095537f},
-std::array<float,2>{0.163417712f, 0.172376201f},
-std::array<float,2>{0.317086667f, 0.979171336f},
-std::array<float,2>{0.58327508f, 0.416123152f},
-std::array<float,2>{0.816117048f, 0.924665749f},
-std::array<float,2>{0.00336305192f, 0.469632149f},
-std::array<float,2>{0.42907238f, 0.714354455f},
-std::array<float,2>{0.696372032f, 0.218383983f},
-std::array<float,2>{0.511255443f, 0.528574467f},
-std::array<float,2>{0.25866574f, 0.0913970321f},
-std::array<float,2>{0.243649632f, 0.770241439f},
-std::array<float,2>{0.990316093f, 0.311540067f},
-std::array<float,2>{0.588498235f, 0.865323126f},
-std::array<float,2>{0.324884892f, 0.330538213f},
-std::array<float,2>{0.167900473f, 0.579667151f},
-std::array<float,2>{0.879455209f, 0.0090703927f},
-std::array<float,2>{0.768884957f, 0.654168427f},
-std::array<float,2>{0.109198377f, 0.144209251f},
-std::array<float,2>{0.449637711f, 0.9496333f},
-std::array<float,2>{0.661993206f, 0.388948768f},
-std::array<float,2>{0.999953449f, 0.902431905f},
-std::array<float,2>{0.239873052f, 0.440461367f},
-std::array<float,2>{0.254932046f, 0.728687167f},
-std::array<float,2>{0.507564545f, 0.220226243f},
-std::array<float,2>{0.694032907f, 0.542018652f},
-std::array<float,2>{0.430823237f, 0.0993901119f},
-std::array<float,2>{0.0137856938f, 0.802602291f},
-std::array<float,2>{0.820673704f, 0.259641498f},
-std::array<float,2>{0.641854882f, 0.975596309f},
-std::array<float,2>{0.482015729f, 0.413280398f},
-std::array<float,2>{0.0733240545f, 0.682308495f},
-std::array<float,2>{0.805652678f, 0.186107531f},
-std::array<float,2>{0.932395279f, 0.613597453f},
-std::array<float,2>{0.14238897f, 0.0555906035f},
-std::array<float,2>{0.346638441f, 0.81745702f},
-std::array<float,2>{0.618949592f, 0.370863527f},
-std::array<float,2>{0.847066402f, 0.77344048f},
-std::array<float,2>{0.0565610938f, 0.301731855f},
-std::array<float,2>{0.391250491f, 0.518099248f},
-std::array<float,2>{0.74505198f, 0.0829767957f},
-std::array<float,2>{0.548731327f, 0.709720671f},
-std::array<float,2>{0.29237318f, 0.208445117f},
-std::array<float,2>{0.192872107f, 0.933713675f},
-std::array<float,2>{0.965985179f, 0.483971715f},
-std::array<float,2>{0.520264864f, 0.907319903f},
-std::array<float,2>{0.269069612f, 0.499124587f},
-std::array<float,2>{0.231042668f, 0.698302746f},
-std::array<float,2>{0.978624642f, 0.195659339f},
-std::array<float,2>{0.843290627f, 0.500194848f},
-std::array<float,2>{0.0251346473f, 0.0765507966f},
-std::array<float,2>{0.41620788f, 0.755603075f},
-std::array<float,2>{0.714601099f, 0.294677675f},
-std::array<float,2>{0.89715898f, 0.8344841f},
-std::array<float,2>{0.183630466f, 0.346283644f},
-std::array<float,2>{0.33906725f, 0.601146281f},
-std::array<float,2>{0.563089013f, 0.0398475118f},
-std::array<float,2>{0.681331456f, 0.660276651f},
-std::array<float,2>{0.462397784f, 0.164788976f},
-std::array<float,2>{0.116717331f, 0.995661974f},
-std::array<float,2>{0.755659819f, 0.435720116f},
-std::array<float,2>{0.718760014f, 0.788820982f},
-std::array<float,2>{0.378083497f, 0.280983269f},
-std::array<float,2>{0.0357691161f, 0.550900102f},
-std::array<float,2>{0.874504626f, 0.112353727f},
-std::array<float,2>{0.939396501f, 0.738639534f},
-std::array<float,2>{0.210636601f, 0.248774827f},
-std::array<float,2>{0.311840445f, 0.887107432f},
-std::array<float,2>{0.543028712f, 0.454226047f},
-std::array<float,2>{0.791421592f, 0.960194528f},
-std::array<float,2>{0.0886916816f, 0.395398259f},
-std::array<float,2>{0.498730481f, 0.631451547f},
-std::array<float,2>{0.632228076f, 0.131311819f},
-std::array<float,2>{0.604046881f, 0.574807405f},
-std::array<float,2>{0.374126107f, 0.0233556833f},
-std::array<float,2>{0.125052735f, 0.843911111f},
-std::array<float,2>{0.921016932f, 0.320789158f},
-std::array<float,2>{0.578062296f, 0.778028131f},
-std::array<float,2>{0.334047884f, 0.299199551f},
-std::array<float,2>{0.172253877f, 0.519733965f},
-std::array<float,2>{0.900786042f, 0.0816423967f},
-std::array<float,2>{0.760489106f, 0.70495832f},
-std::array<float,2>{0.121055171f, 0.205808014f},
-std::array<float,2>{0.459306479f, 0.933338702f},
-std::array<float,2>{0.678091466f, 0.477220148f},
-std::array<float,2>{0.970619977f, 0.97239536f},
-std::array<float,2>{0.223648712f, 0.409765631f},
-std::array<float,2>{0.277424812f, 0.684291363f},
-std::array<float,2>{0.531206727f, 0.181616053f},
-std::array<float,2>{0.704272687f, 0.612686932f},
-std::array<float,2>{0.40822348f, 0.0617080778f},
-std::array<float,2>{0.0166854877f, 0.814466238f},
-std::array<float,2>{0.832994401f, 0.374772638f},
-std::array<float,2>{0.639012277f, 0.899227679f},
-std::array<float,2>{0.490736812f, 0.442690581f},
-std::array<float,2>{0.0787245929f, 0.732626617f},
-std::array<float,2>{0.78300947f, 0.223870143f},
-std::array<float,2>{0.913814843f, 0.543410718f},
-std::array<float,2>{0.136413127f, 0.0947523341f},
-std::array<float,2>{0.361953706f, 0.800300062f},
-std::array<float,2>{0.599061072f, 0.264284372f},
-std::array<float,2>{0.863378525f, 0.861179054f},
-std::array<float,2>{0.046792835f, 0.334395289f},
-std::array<float,2>{0.388150215f, 0.583487868f},
-std::array<float,2>{0.730486214f, 0.0143979909f},
-std::array<float,2>{0.532981038f, 0.650986969f},
-std::array<float,2>{0.303991765f, 0.145268351f},
-std::array<float,2>{0.216494411f, 0.946671605f},
-std::array<float,2>{0.952266574f, 0.383926272f},
-std::array<float,2>{0.512135446f, 0.956745565f},
-std::array<float,2>{0.26472348f, 0.393284857f},
-std::array<float,2>{0.24848628f, 0.627259731f},
-std::array<float,2>{0.986182392f, 0.127329111f},
-std::array<float,2>{0.818852007f, 0.572323382f},
-std::array<float,2>{0.00403818768f, 0.0165236089f},
-std::array<float,2>{0.425704628f, 0.849523127f},
-std::array<float,2>{0.702616632f, 0.325332135f},
-std::array<float,2>{0.885193408f, 0.783621788f},
-std::array<float,2>{0.159083351f, 0.276883096f},
-std::array<float,2>{0.312820941f, 0.549994051f},
-std::array<float,2>{0.57948637f, 0.114415929f},
-std::array<float,2>{0.666939259f, 0.736834526f},
-std::array<float,2>{0.443295389f, 0.243865743f},
-std::array<float,2>{0.0974195674f, 0.88379395f},
-std::array<float,2>{0.777473748f, 0.45881173f},
-std::array<float,2>{0.740708053f, 0.828566909f},
-std::array<float,2>{0.400958747f, 0.348902375f},
-std::array<float,2>{0.0476297624f, 0.595850706f},
-std::array<float,2>{0.856774867f, 0.0452115424f},
-std::array<float,2>{0.957496703f, 0.658720434f},
-std::array<float,2>{0.201499701f, 0.170886889f},
-std::array<float,2>{0.28674081f, 0.997001588f},
-std::array<float,2>{0.558234334f, 0.431730926f},
-std::array<float,2>{0.797216654f, 0.912426829f},
-std::array<float,2>{0.0643869564f, 0.494197309f},
-std::array<float,2>{0.470220387f, 0.70248884f},
-std::array<float,2>{0.650812626f, 0.202912316f},
-std::array<float,2>{0.611073077f, 0.50542289f},
-std::array<float,2>{0.357423782f, 0.0711981282f},
-std::array<float,2>{0.155728117f, 0.751916111f},
-std::array<float,2>{0.92342186f, 0.291288286f},
-std::array<float,2>{0.55358696f, 0.85355854f},
-std::array<float,2>{0.295615882f, 0.31450662f},
-std::array<float,2>{0.190855265f, 0.570232689f},
-std::array<float,2>{0.961957693f, 0.0295551792f},
-std::array<float,2>{0.848800242f, 0.636089027f},
-std::array<float,2>{0.0623868406f, 0.139978662f},
-std::array<float,2>{0.39733994f, 0.968052745f},
-std::array<float,2>{0.746489167f, 0.405361056f},
-std::array<float,2>{0.936139107f, 0.881929278f},
-std::array<float,2>{0.148278579f, 0.468147457f},
-std::array<float,2>{0.350073248f, 0.749009907f},
-std::array<float,2>{0.623092711f, 0.237927496f},
-std::array<float,2>{0.646465898f, 0.55773288f},
-std::array<float,2>{0.479945064f, 0.118184716f},
-std::array<float,2>{0.0759624019f, 0.796381414f},
-std::array<float,2>{0.811730504f, 0.269118011f},
-std::array<float,2>{0.689075887f, 0.985327661f},
-std::array<float,2>{0.43537572f, 0.425242543f},
-std::array<float,2>{0.00905925408f, 0.665548325f},
-std::array<float,2>{0.8257429f, 0.160892934f},
-std::array<float,2>{0.993994057f, 0.605000496f},
-std::array<float,2>{0.235576972f, 0.0351613052f},
-std::array<float,2>{0.251381785f, 0.839091539f},
-std::array<float,2>{0.501381874f, 0.358648539f},
-std::array<float,2>{0.771564543f, 0.76092881f},
-std::array<float,2>{0.104419529f, 0.282936901f},
-std::array<float,2>{0.445560366f, 0.508317292f},
-std::array<float,2>{0.659485638f, 0.0640155226f},
-std::array<float,2>{0.591285706f, 0.691309571f},
-std::array<float,2>{0.321561933f, 0.187620565f},
-std::array<float,2>{0.169677049f, 0.917184651f},
-std::array<float,2>{0.878456175f, 0.48476851f},
-std::array<float,2>{0.60554719f, 0.926262558f},
-std::array<float,2>{0.367780924f, 0.4744744f},
-std::array<float,2>{0.131544054f, 0.71782589f},
-std::array<float,2>{0.914770484f, 0.213279262f},
-std::array<float,2>{0.796854913f, 0.526351571f},
-std::array<float,2>{0.0918105617f, 0.0868791118f},
-std::array<float,2>{0.49595052f, 0.769528627f},
-std::array<float,2>{0.627925038f, 0.308493912f},
-std::array<float,2>{0.944136083f, 0.827989936f},
-std::array<float,2>{0.203551099f, 0.360445321f},
-std::array<float,2>{0.307951748f, 0.61768961f},
-std::array<float,2>{0.542537928f, 0.0513933226f},
-std::array<float,2>{0.722849309f, 0.676402509f},
-std::array<float,2>{0.381269366f, 0.177215055f},
-std::array<float,2>{0.0328083299f, 0.983392298f},
-std::array<float,2>{0.867241025f, 0.42062822f},
-std::array<float,2>{0.686605632f, 0.812026739f},
-std::array<float,2>{0.467217386f, 0.250166684f},
-std::array<float,2>{0.112179875f, 0.535412371f},
-std::array<float,2>{0.751832128f, 0.103209414f},
-std::array<float,2>{0.891747773f, 0.723985195f},
-std::array<float,2>{0.182853043f, 0.234231532f},
-std::array<float,2>{0.343108594f, 0.895300329f},
-std::array<float,2>{0.570180416f, 0.445383549f},
-std::array<float,2>{0.837071359f, 0.940503716f},
-std::array<float,2>{0.0292408094f, 0.378391147f},
-std::array<float,2>{0.419004649f, 0.644775331f},
-std::array<float,2>{0.715210438f, 0.15038003f},
-std::array<float,2>{0.516348183f, 0.592086852f},
-std::array<float,2>{0.27280131f, 0.0067561497f},
-std::array<float,2>{0.229245991f, 0.870569468f},
-std::array<float,2>{0.98424387f, 0.343619794f},
-std::array<float,2>{0.526247144f, 0.791162312f},
-std::array<float,2>{0.274840087f, 0.269802123f},
-std::array<float,2>{0.221420065f, 0.560880959f},
-std::array<float,2>{0.976033747f, 0.124244876f},
-std::array<float,2>{0.828892589f, 0.744074523f},
-std::array<float,2>{0.01961568f, 0.238740578f},
-std::array<float,2>{0.410588831f, 0.875478625f},
-std::array<float,2>{0.70824182f, 0.464661926f},
-std::array<float,2>{0.903481245f, 0.963209212f},
-std::array<float,2>{0.176810697f, 0.398896605f},
-std::array<float,2>{0.331028789f, 0.639441013f},
-std::array<float,2>{0.573541403f, 0.134580106f},
-std::array<float,2>{0.672331214f, 0.565101922f},
-std::array<float,2>{0.456701159f, 0.0255526081f},
-std::array<float,2>{0.123192415f, 0.855694473f},
-std::array<float,2>{0.765096128f, 0.317212373f},
-std::array<float,2>{0.73042202f, 0.91926533f},
-std::array<float,2>{0.38590166f, 0.489290088f},
-std::array<float,2>{0.0425476879f, 0.694610536f},
-std::array<float,2>{0.860705495f, 0.194947809f},
-std::array<float,2>{0.949112058f, 0.512670577f},
-std::array<float,2>{0.213800415f, 0.0687150434f},
-std::array<float,2>{0.297167391f, 0.764251232f},
-std::array<float,2>{0.535674512f, 0.285267323f},
-std::array<float,2>{0.786988616f, 0.840858698f},
-std::array<float,2>{0.0838266313f, 0.353677243f},
-std::array<float,2>{0.487496525f, 0.60584712f},
-std::array<float,2>{0.635994315f, 0.0313498154f},
-std::array<float,2>{0.596499205f, 0.670382202f},
-std::array<float,2>{0.36564061f, 0.159545794f},
-std::array<float,2>{0.138335153f, 0.989536405f},
-std::array<float,2>{0.908133626f, 0.428140223f},
-std::array<float,2>{0.584031403f, 0.97824651f},
-std::array<float,2>{0.319153875f, 0.415655941f},
-std::array<float,2>{0.161042482f, 0.675675035f},
-std::array<float,2>{0.888249516f, 0.17402567f},
-std::array<float,2>{0.774528146f, 0.623533309f},
-std::array<float,2>{0.0984763578f, 0.0499290004f},
-std::array<float,2>{0.440446943f, 0.822527289f},
-std::array<float,2>{0.668217421f, 0.365763068f},
-std::array<float,2>{0.988722622f, 0.772964656f},
-std::array<float,2>{0.244508505f, 0.309559405f},
-std::array<float,2>{0.260745227f, 0.529348314f},
-std::array<float,2>{0.50975436f, 0.0920987427f},
-std::array<float,2>{0.698189437f, 0.712580323f},
-std::array<float,2>{0.426457733f, 0.216259018f},
-std::array<float,2>{0.00181662315f, 0.923058569f},
-std::array<float,2>{0.813812435f, 0.472482383f},
-std::array<float,2>{0.652547598f, 0.873560488f},
-std::array<float,2>{0.474153876f, 0.336834669f},
-std::array<float,2>{0.0691006482f, 0.589503348f},
-std::array<float,2>{0.801665962f, 0.00307154655f},
-std::array<float,2>{0.928641677f, 0.642423928f},
-std::array<float,2>{0.152070329f, 0.152706891f},
-std::array<float,2>{0.354269892f, 0.943296134f},
-std::array<float,2>{0.613628507f, 0.381269217f},
-std::array<float,2>{0.852695286f, 0.892381907f},
-std::array<float,2>{0.0530386381f, 0.452203363f},
-std::array<float,2>{0.402681291f, 0.721117854f},
-std::array<float,2>{0.7369681f, 0.228330314f},
-std::array<float,2>{0.558600366f, 0.534768164f},
-std::array<float,2>{0.281951636f, 0.108912371f},
-std::array<float,2>{0.196646005f, 0.805148304f},
-std::array<float,2>{0.955045104f, 0.257165819f},
-std::array<float,2>{0.619589746f, 0.818980932f},
-std::array<float,2>{0.344656587f, 0.368447661f},
-std::array<float,2>{0.143154621f, 0.616695404f},
-std::array<float,2>{0.930609882f, 0.0582681708f},
-std::array<float,2>{0.806855083f, 0.680972755f},
-std::array<float,2>{0.0705766827f, 0.185372502f},
-std::array<float,2>{0.482488275f, 0.974395633f},
-std::array<float,2>{0.643609762f, 0.411541432f},
-std::array<float,2>{0.967617154f, 0.93740499f},
-std::array<float,2>{0.194052234f, 0.480821848f},
-std::array<float,2>{0.290215045f, 0.70833838f},
-std::array<float,2>{0.548986018f, 0.209602594f},
-std::array<float,2>{0.743203819f, 0.516238928f},
-std::array<float,2>{0.393751919f, 0.0857508034f},
-std::array<float,2>{0.0567917265f, 0.77643162f},
-std::array<float,2>{0.845453203f, 0.303935617f},
-std::array<float,2>{0.662832081f, 0.952858865f},
-std::array<float,2>{0.45220378f, 0.388563573f},
-std::array<float,2>{0.106245115f, 0.656173408f},
-std::array<float,2>{0.766187489f, 0.141180813f},
-std::array<float,2>{0.881438673f, 0.581794381f},
-std::array<float,2>{0.165387958f, 0.0109963613f},
-std::array<float,2>{0.326421171f, 0.863582671f},
-std::array<float,2>{0.586537778f, 0.329458386f},
-std::array<float,2>{0.823268354f, 0.803711176f},
-std::array<float,2>{0.0128139313f, 0.260771513f},
-std::array<float,2>{0.43317607f, 0.539297104f},
-std::array<float,2>{0.691997349f, 0.0998704061f},
-std::array<float,2>{0.505613148f, 0.726596236f},
-std::array<float,2>{0.256817877f, 0.221932441f},
-std::array<float,2>{0.241540775f, 0.906165838f},
-std::array<float,2>{0.997552872f, 0.43791613f},
-std::array<float,2>{0.545161188f, 0.890493572f},
-std::array<float,2>{0.309173942f, 0.455357224f},
-std::array<float,2>{0.207391605f, 0.741941333f},
-std::array<float,2>{0.940656722f, 0.247199193f},
-std::array<float,2>{0.871773541f, 0.553911924f},
-std::array<float,2>{0.0374490134f, 0.110922448f},
-std::array<float,2>{0.376601666f, 0.785967469f},
-std::array<float,2>{0.721574962f, 0.27893737f},
-std::array<float,2>{0.919341147f, 0.846229315f},
-std::array<float,2>{0.127632886f, 0.322539866f},
-std::array<float,2>{0.371215492f, 0.576393008f},
-std::array<float,2>{0.60312438f, 0.0205981247f},
-std::array<float,2>{0.630049348f, 0.629519343f},
-std::array<float,2>{0.497101218f, 0.129681125f},
-std::array<float,2>{0.0873490199f, 0.958095908f},
-std::array<float,2>{0.78947866f, 0.397487462f},
-std::array<float,2>{0.711991012f, 0.756112397f},
-std::array<float,2>{0.41551885f, 0.295028567f},
-std::array<float,2>{0.0255016442f, 0.502808273f},
-std::array<float,2>{0.841513872f, 0.0753274262f},
-std::array<float,2>{0.977289379f, 0.695525825f},
-std::array<float,2>{0.232530326f, 0.197995007f},
-std::array<float,2>{0.266943753f, 0.90880239f},
-std::array<float,2>{0.52233839f, 0.496973902f},
-std::array<float,2>{0.757608473f, 0.992851198f},
-std::array<float,2>{0.115142755f, 0.434427828f},
-std::array<float,2>{0.464073628f, 0.663758695f},
-std::array<float,2>{0.682150185f, 0.167631581f},
-std::array<float,2>{0.564717174f, 0.599540949f},
-std::array<float,2>{0.337513119f, 0.0422253199f},
-std::array<float,2>{0.186211452f, 0.833226919f},
-std::array<float,2>{0.895523012f, 0.344122112f},
-std::array<float,2>{0.607676446f, 0.768951416f},
-std::array<float,2>{0.369599104f, 0.308048427f},
-std::array<float,2>{0.129817382f, 0.525653243f},
-std::array<float,2>{0.917652547f, 0.0861470923f},
-std::array<float,2>{0.793954313f, 0.718527198f},
-std::array<float,2>{0.0916757733f, 0.213595331f},
-std::array<float,2>{0.493410259f, 0.926309943f},
-std::array<float,2>{0.625089169f, 0.473692328f},
-std::array<float,2>{0.941439092f, 0.982422948f},
-std::array<float,2>{0.205329463f, 0.419935435f},
-std::array<float,2>{0.305315793f, 0.676115215f},
-std::array<float,2>{0.540898502f, 0.177645698f},
-std::array<float,2>{0.7258178f, 0.617372453f},
-std::array<float,2>{0.379793167f, 0.0512337051f},
-std::array<float,2>{0.0337649584f, 0.827217996f},
-std::array<float,2>{0.870788932f, 0.361007184f},
-std::array<float,2>{0.683909059f, 0.895001173f},
-std::array<float,2>{0.465119988f, 0.445859462f},
-std::array<float,2>{0.110876426f, 0.724343538f},
-std::array<float,2>{0.752619624f, 0.233776495f},
-std::array<float,2>{0.892911434f, 0.536080837f},
-std::array<float,2>{0.179879144f, 0.102801666f},
-std::array<float,2>{0.339845598f, 0.811855495f},
-std::array<float,2>{0.567452192f, 0.250569135f},
-std::array<float,2>{0.83823365f, 0.870678842f},
-std::array<float,2>{0.0295556132f, 0.343077093f},
-std::array<float,2>{0.421789706f, 0.592561722f},
-std::array<float,2>{0.718037128f, 0.00618335325f},
-std::array<float,2>{0.518603563f, 0.645397604f},
-std::array<float,2>{0.270217717f, 0.149864316f},
-std::array<float,2>{0.228095219f, 0.941251397f},
-std::array<float,2>{0.982082367f, 0.378511608f},
-std::array<float,2>{0.551125526f, 0.968503177f},
-std::array<float,2>{0.293978572f, 0.405799299f},
-std::array<float,2>{0.188774914f, 0.636604607f},
-std::array<float,2>{0.963454664f, 0.140610039f},
-std::array<float,2>{0.851201475f, 0.569595456f},
-std::array<float,2>{0.0592137165f, 0.0300226174f},
-std::array<float,2>{0.395543694f, 0.854074299f},
-std::array<float,2>{0.748349488f, 0.315309435f},
-std::array<float,2>{0.934600234f, 0.796400666f},
-std::array<float,2>{0.145372257f, 0.268929034f},
-std::array<float,2>{0.348851681f, 0.558253706f},
-std::array<float,2>{0.621533632f, 0.11894232f},
-std::array<float,2>{0.646917045f, 0.748347282f},
-std::array<float,2>{0.477417916f, 0.237735853f},
-std::array<float,2>{0.0770860314f, 0.882685483f},
-std::array<float,2>{0.808982432f, 0.468735844f},
-std::array<float,2>{0.690107942f, 0.839447081f},
-std::array<float,2>{0.436837822f, 0.359149247f},
-std::array<float,2>{0.0106353275f, 0.604537368f},
-std::array<float,2>{0.827648401f, 0.0358596519f},
-std::array<float,2>{0.994688451f, 0.665183246f},
-std::array<float,2>{0.237252891f, 0.160401359f},
-std::array<float,2>{0.252086967f, 0.984685481f},
-std::array<float,2>{0.502150536f, 0.425317198f},
-std::array<float,2>{0.771423459f, 0.917564571f},
-std::array<float,2>{0.103058979f, 0.485025585f},
-std::array<float,2>{0.44753027f, 0.690729856f},
-std::array<float,2>{0.656883955f, 0.188366994f},
-std::array<float,2>{0.592134535f, 0.507955492f},
-std::array<float,2>{0.323955894f, 0.0635898039f},
-std::array<float,2>{0.170072377f, 0.761670649f},
-std::array<float,2>{0.876660824f, 0.282366216f},
-std::array<float,2>{0.514687419f, 0.849066854f},
-std::array<float,2>{0.261783391f, 0.326024979f},
-std::array<float,2>{0.247176215f, 0.572904348f},
-std::array<float,2>{0.987430751f, 0.0156616457f},
-std::array<float,2>{0.817624927f, 0.627844214f},
-std::array<float,2>{0.00609892746f, 0.127552971f},
-std::array<float,2>{0.422705501f, 0.956251025f},
-std::array<float,2>{0.699771404f, 0.393030763f},
-std::array<float,2>{0.883157849f, 0.884478271f},
-std::array<float,2>{0.157065138f, 0.458063215f},
-std::array<float,2>{0.315111786f, 0.73660773f},
-std::array<float,2>{0.580873907f, 0.243253082f},
-std::array<float,2>{0.665243506f, 0.550749004f},
-std::array<float,2>{0.444990903f, 0.114855543f},
-std::array<float,2>{0.0954027027f, 0.784035742f},
-std::array<float,2>{0.781089246f, 0.276636869f},
-std::array<float,2>{0.740071714f, 0.996563077f},
-std::array<float,2>{0.399437129f, 0.43217802f},
-std::array<float,2>{0.0501515046f, 0.658608317f},
-std::array<float,2>{0.858578265f, 0.170099437f},
-std::array<float,2>{0.960571826f, 0.596547186f},
-std::array<float,2>{0.199430749f, 0.0455923565f},
-std::array<float,2>{0.287299365f, 0.828986168f},
-std::array<float,2>{0.555451751f, 0.349441648f},
-std::array<float,2>{0.800250411f, 0.751461983f},
-std::array<float,2>{0.0646847934f, 0.29180643f},
-std::array<float,2>{0.471029788f, 0.505188048f},
-std::array<float,2>{0.648533046f, 0.0705740675f},
-std::array<float,2>{0.612499595f, 0.702830732f},
-std::array<float,2>{0.356598765f, 0.202313676f},
-std::array<float,2>{0.152749166f, 0.913042128f},
-std::array<float,2>{0.924583256f, 0.494756252f},
-std::array<float,2>{0.575407743f, 0.932932496f},
-std::array<float,2>{0.332845986f, 0.476801485f},
-std::array<float,2>{0.174675211f, 0.704173326f},
-std::array<float,2>{0.900333107f, 0.205530778f},
-std::array<float,2>{0.759079516f, 0.520046473f},
-std::array<float,2>{0.117269456f, 0.0811760202f},
-std::array<float,2>{0.458685696f, 0.777814686f},
-std::array<float,2>{0.67677927f, 0.299641281f},
-std::array<float,2>{0.971610129f, 0.815290093f},
-std::array<float,2>{0.226081714f, 0.374380678f},
-std::array<float,2>{0.280555338f, 0.613244176f},
-std::array<float,2>{0.528053522f, 0.0621646531f},
-std::array<float,2>{0.705448031f, 0.683945596f},
-std::array<float,2>{0.406491458f, 0.180923641f},
-std::array<float,2>{0.0177270211f, 0.971758246f},
-std::array<float,2>{0.835012853f, 0.409598887f},
-std::array<float,2>{0.637506783f, 0.800159991f},
-std::array<float,2>{0.488895178f, 0.264122874f},
-std::array<float,2>{0.0804247409f, 0.543738842f},
-std::array<float,2>{0.784979224f, 0.0956487581f},
-std::array<float,2>{0.910450399f, 0.733070135f},
-std::array<float,2>{0.132823572f, 0.224272087f},
-std::array<float,2>{0.360208154f, 0.898648441f},
-std::array<float,2>{0.600729644f, 0.443127006f},
-std::array<float,2>{0.866742849f, 0.946988702f},
-std::array<float,2>{0.0443882868f, 0.384337038f},
-std::array<float,2>{0.390271783f, 0.650514305f},
-std::array<float,2>{0.734275997f, 0.144892558f},
-std::array<float,2>{0.534695983f, 0.583676875f},
-std::array<float,2>{0.302569211f, 0.0138858212f},
-std::array<float,2>{0.217458606f, 0.860643923f},
-std::array<float,2>{0.950454891f, 0.334957868f},
-std::array<float,2>{0.543836951f, 0.785171688f},
-std::array<float,2>{0.312488616f, 0.278349459f},
-std::array<float,2>{0.210051715f, 0.554599822f},
-std::array<float,2>{0.938625693f, 0.110703886f},
-std::array<float,2>{0.874668539f, 0.741467893f},
-std::array<float,2>{0.0352663659f, 0.247918934f},
-std::array<float,2>{0.3788293f, 0.889858365f},
-std::array<float,2>{0.719256222f, 0.455699742f},
-std::array<float,2>{0.921649218f, 0.958640575f},
-std::array<float,2>{0.125575945f, 0.398390114f},
-std::array<float,2>{0.374807417f, 0.629314899f},
-std::array<float,2>{0.603799462f, 0.128987134f},
-std::array<float,2>{0.632739246f, 0.577049911f},
-std::array<float,2>{0.498118371f, 0.021001786f},
-std::array<float,2>{0.0879733041f, 0.84584111f},
-std::array<float,2>{0.791758955f, 0.323033392f},
-std::array<float,2>{0.714015841f, 0.908490479f},
-std::array<float,2>{0.416922063f, 0.496126056f},
-std::array<float,2>{0.0248032697f, 0.696114361f},
-std::array<float,2>{0.842783749f, 0.197305486f},
-std::array<float,2>{0.979369462f, 0.502420783f},
-std::array<float,2>{0.230820537f, 0.0761431158f},
-std::array<float,2>{0.26861167f, 0.756698489f},
-std::array<float,2>{0.519967735f, 0.295490175f},
-std::array<float,2>{0.754980564f, 0.833974957f},
-std::array<float,2>{0.116384096f, 0.34470278f},
-std::array<float,2>{0.46284014f, 0.59868896f},
-std::array<float,2>{0.680732489f, 0.0425352119f},
-std::array<float,2>{0.562692702f, 0.663107157f},
-std::array<float,2>{0.33954367f, 0.167284206f},
-std::array<float,2>{0.184570253f, 0.992646217f},
-std::array<float,2>{0.896783233f, 0.433852911f},
-std::array<float,2>{0.618505895f, 0.973939717f},
-std::array<float,2>{0.346184582f, 0.411792517f},
-std::array<float,2>{0.141675428f, 0.681226373f},
-std::array<float,2>{0.931918442f, 0.184912309f},
-std::array<float,2>{0.805022061f, 0.616767704f},
-std::array<float,2>{0.0741718113f, 0.0580039397f},
-std::array<float,2>{0.481639951f, 0.818750262f},
-std::array<float,2>{0.64241153f, 0.368831813f},
-std::array<float,2>{0.966440678f, 0.777200878f},
-std::array<float,2>{0.192392722f, 0.304436564f},
-std::array<float,2>{0.292945594f, 0.515855193f},
-std::array<float,2>{0.54833132f, 0.0852611214f},
-std::array<float,2>{0.744185627f, 0.708574951f},
-std::array<float,2>{0.391052455f, 0.209412575f},
-std::array<float,2>{0.0560212582f, 0.936692536f},
-std::array<float,2>{0.847327948f, 0.481048077f},
-std::array<float,2>{0.661338568f, 0.863878667f},
-std::array<float,2>{0.449897856f, 0.330059171f},
-std::array<float,2>{0.108671233f, 0.581376731f},
-std::array<float,2>{0.76937896f, 0.0115963211f},
-std::array<float,2>{0.879255235f, 0.655635357f},
-std::array<float,2>{0.167380214f, 0.140800938f},
-std::array<float,2>{0.324272424f, 0.952555239f},
-std::array<float,2>{0.588164151f, 0.388166845f},
-std::array<float,2>{0.821100891f, 0.905290961f},
-std::array<float,2>{0.0145508898f, 0.438420892f},
-std::array<float,2>{0.431351751f, 0.727117598f},
-std::array<float,2>{0.693435431f, 0.222200304f},
-std::array<float,2>{0.507075727f, 0.539901555f},
-std::array<float,2>{0.255646884f, 0.100100622f},
-std::array<float,2>{0.239270076f, 0.804556549f},
-std::array<float,2>{0.999411464f, 0.261479378f},
-std::array<float,2>{0.583742678f, 0.822933733f},
-std::array<float,2>{0.316832125f, 0.365518332f},
-std::array<float,2>{0.163725987f, 0.623604894f},
-std::array<float,2>{0.890335321f, 0.0507124625f},
-std::array<float,2>{0.776482582f, 0.674847722f},
-std::array<float,2>{0.100340396f, 0.174362257f},
-std::array<float,2>{0.438027948f, 0.977960348f},
-std::array<float,2>{0.670789719f, 0.415123701f},
-std::array<float,2>{0.991096258f, 0.923454523f},
-std::array<float,2>{0.243756056f, 0.471683294f},
-std::array<float,2>{0.258207321f, 0.711980462f},
-std::array<float,2>{0.511222959f, 0.21659632f},
-std::array<float,2>{0.697168648f, 0.530157983f},
-std::array<float,2>{0.429311365f, 0.0924371481f},
-std::array<float,2>{0.00382464635f, 0.772911429f},
-std::array<float,2>{0.815443635f, 0.309079409f},
-std::array<float,2>{0.654900491f, 0.942436397f},
-std::array<float,2>{0.474625289f, 0.381452113f},
-std::array<float,2>{0.0681786761f, 0.641798317f},
-std::array<float,2>{0.802939892f, 0.152881935f},
-std::array<float,2>{0.926577985f, 0.589256763f},
-std::array<float,2>{0.149413288f, 0.00384685188f},
-std::array<float,2>{0.352605879f, 0.873047054f},
-std::array<float,2>{0.617009759f, 0.336243391f},
-std::array<float,2>{0.853659153f, 0.805481911f},
-std::array<float,2>{0.0521063432f, 0.257745743f},
-std::array<float,2>{0.406232864f, 0.534604311f},
-std::array<float,2>{0.735984921f, 0.108741544f},
-std::array<float,2>{0.560553849f, 0.721401632f},
-std::array<float,2>{0.284512699f, 0.227812245f},
-std::array<float,2>{0.19904162f, 0.891927004f},
-std::array<float,2>{0.956702113f, 0.452797264f},
-std::array<float,2>{0.524210215f, 0.875840724f},
-std::array<float,2>{0.277142495f, 0.464267284f},
-std::array<float,2>{0.220445827f, 0.743374407f},
-std::array<float,2>{0.973994076f, 0.239227459f},
-std::array<float,2>{0.831627905f, 0.561129868f},
-std::array<float,2>{0.0215435009f, 0.124591343f},
-std::array<float,2>{0.413186312f, 0.791661441f},
-std::array<float,2>{0.709392726f, 0.270225167f},
-std::array<float,2>{0.905296326f, 0.856112421f},
-std::array<float,2>{0.177865461f, 0.316805065f},
-std::array<float,2>{0.328158408f, 0.564862311f},
-std::array<float,2>{0.570621073f, 0.0259338543f},
-std::array<float,2>{0.675210595f, 0.63884151f},
-std::array<float,2>{0.453522265f, 0.134037852f},
-std::array<float,2>{0.122192621f, 0.963472724f},
-std::array<float,2>{0.762337685f, 0.399243265f},
-std::array<float,2>{0.727953255f, 0.763912916f},
-std::array<float,2>{0.384189248f, 0.285963893f},
-std::array<float,2>{0.0405853204f, 0.511752009f},
-std::array<float,2>{0.861845911f, 0.0690071136f},
-std::array<float,2>{0.946464777f, 0.694882214f},
-std::array<float,2>{0.211866841f, 0.194823176f},
-std::array<float,2>{0.300577193f, 0.919910073f},
-std::array<float,2>{0.539017498f, 0.489979714f},
-std::array<float,2>{0.788356662f, 0.989829361f},
-std::array<float,2>{0.0849485397f, 0.428240418f},
-std::array<float,2>{0.48525092f, 0.670488358f},
-std::array<float,2>{0.633704126f, 0.159749433f},
-std::array<float,2>{0.593853414f, 0.606080592f},
-std::array<float,2>{0.363332361f, 0.0321927443f},
-std::array<float,2>{0.13976334f, 0.841626167f},
-std::array<float,2>{0.909612238f, 0.354282856f},
-std::array<float,2>{0.569500029f, 0.809373856f},
-std::array<float,2>{0.343485594f, 0.253327042f},
-std::array<float,2>{0.183232874f, 0.538876712f},
-std::array<float,2>{0.892410159f, 0.103559762f},
-std::array<float,2>{0.751024187f, 0.72615993f},
-std::array<float,2>{0.11143329f, 0.230863437f},
-std::array<float,2>{0.467550427f, 0.897468448f},
-std::array<float,2>{0.687475324f, 0.448826969f},
-std::array<float,2>{0.983844101f, 0.938367844f},
-std::array<float,2>{0.228898153f, 0.376801938f},
-std::array<float,2>{0.272949874f, 0.648267329f},
-std::array<float,2>{0.515879273f, 0.151861399f},
-std::array<float,2>{0.715353072f, 0.590414286f},
-std::array<float,2>{0.419743806f, 0.0057354155f},
-std::array<float,2>{0.028752882f, 0.868957996f},
-std::array<float,2>{0.837652564f, 0.341381192f},
-std::array<float,2>{0.627180696f, 0.929357469f},
-std::array<float,2>{0.49522382f, 0.474701434f},
-std::array<float,2>{0.0926480219f, 0.71497947f},
-std::array<float,2>{0.796168149f, 0.212227583f},
-std::array<float,2>{0.914356947f, 0.523437798f},
-std::array<float,2>{0.131340206f, 0.0896379873f},
-std::array<float,2>{0.36753419f, 0.76611954f},
-std::array<float,2>{0.606063843f, 0.30653131f},
-std::array<float,2>{0.867791653f, 0.824231625f},
-std::array<float,2>{0.0326463878f, 0.361878753f},
-std::array<float,2>{0.381637931f, 0.620332539f},
-std::array<float,2>{0.723332882f, 0.0537474453f},
-std::array<float,2>{0.542376816f, 0.678345919f},
-std::array<float,2>{0.30855161f, 0.178883418f},
-std::array<float,2>{0.203732505f, 0.980887234f},
-std::array<float,2>{0.943787456f, 0.419099659f},
-std::array<float,2>{0.501912713f, 0.987161398f},
-std::array<float,2>{0.251920074f, 0.422922939f},
-std::array<float,2>{0.236038536f, 0.667629838f},
-std::array<float,2>{0.993220925f, 0.163274005f},
-std::array<float,2>{0.825476587f, 0.601883709f},
-std::array<float,2>{0.00959647447f, 0.0372797921f},
-std::array<float,2>{0.434736967f, 0.83732146f},
-std::array<float,2>{0.688582003f, 0.357395411f},
-std::array<float,2>{0.878268063f, 0.759128392f},
-std::array<float,2>{0.16906783f, 0.285036743f},
-std::array<float,2>{0.322205067f, 0.510778487f},
-std::array<float,2>{0.591753721f, 0.0651387125f},
-std::array<float,2>{0.659680188f, 0.687574148f},
-std::array<float,2>{0.446000099f, 0.190318286f},
-std::array<float,2>{0.103747956f, 0.915319741f},
-std::array<float,2>{0.772353828f, 0.486834794f},
-std::array<float,2>{0.746943653f, 0.853506327f},
-std::array<float,2>{0.396942586f, 0.313251644f},
-std::array<float,2>{0.0619333573f, 0.566702187f},
-std::array<float,2>{0.849434853f, 0.0292360093f},
-std::array<float,2>{0.962570846f, 0.634651959f},
-std::array<float,2>{0.191294342f, 0.136790514f},
-std::array<float,2>{0.295026869f, 0.965045393f},
-std::array<float,2>{0.553106308f, 0.404133946f},
-std::array<float,2>{0.812283874f, 0.879967391f},
-std::array<float,2>{0.0753162652f, 0.466522127f},
-std::array<float,2>{0.480158269f, 0.747601926f},
-std::array<float,2>{0.645814061f, 0.235666037f},
-std::array<float,2>{0.623829424f, 0.555406392f},
-std::array<float,2>{0.350132465f, 0.119962506f},
-std::array<float,2>{0.147838339f, 0.793047428f},
-std::array<float,2>{0.935657203f, 0.266115099f},
-std::array<float,2>{0.557714641f, 0.830879986f},
-std::array<float,2>{0.286518514f, 0.349807322f},
-std::array<float,2>{0.202023283f, 0.595687211f},
-std::array<float,2>{0.95768398f, 0.0432367362f},
-std::array<float,2>{0.857282937f, 0.656472981f},
-std::array<float,2>{0.0472662263f, 0.16950658f},
-std::array<float,2>{0.400594413f, 0.998313129f},
-std::array<float,2>{0.740829289f, 0.429689437f},
-std::array<float,2>{0.922925234f, 0.911100984f},
-std::array<float,2>{0.15600732f, 0.493159622f},
-std::array<float,2>{0.35835889f, 0.699560881f},
-std::array<float,2>{0.610729396f, 0.199704975f},
-std::array<float,2>{0.651305795f, 0.50659287f},
-std::array<float,2>{0.470205307f, 0.0730792359f},
-std::array<float,2>{0.0637117326f, 0.753788233f},
-std::array<float,2>{0.79760772f, 0.290767282f},
-std::array<float,2>{0.70307529f, 0.953301549f},
-std::array<float,2>{0.4249475f, 0.392377794f},
-std::array<float,2>{0.00456259679f, 0.626236677f},
-std::array<float,2>{0.818552554f, 0.126846373f},
-std::array<float,2>{0.985574722f, 0.571927011f},
-std::array<float,2>{0.248588338f, 0.0193952713f},
-std::array<float,2>{0.265378058f, 0.851079345f},
-std::array<float,2>{0.512323439f, 0.32670486f},
-std::array<float,2>{0.777852595f, 0.782734036f},
-std::array<float,2>{0.0967299938f, 0.274854034f},
-std::array<float,2>{0.44249171f, 0.547306657f},
-std::array<float,2>{0.666359663f, 0.115810387f},
-std::array<float,2>{0.579697967f, 0.736281753f},
-std::array<float,2>{0.313118517f, 0.244603857f},
-std::array<float,2>{0.158206031f, 0.886502624f},
-std::array<float,2>{0.885256469f, 0.459705591f},
-std::array<float,2>{0.599533141f, 0.902055144f},
-std::array<float,2>{0.361521155f, 0.444392413f},
-std::array<float,2>{0.135849163f, 0.731909752f},
-std::array<float,2>{0.913158834f, 0.225142956f},
-std::array<float,2>{0.782229543f, 0.546446979f},
-std::array<float,2>{0.0783651844f, 0.0963819176f},
-std::array<float,2>{0.490499973f, 0.798392236f},
-std::array<float,2>{0.639644325f, 0.262318701f},
-std::array<float,2>{0.952951074f, 0.861654401f},
-std::array<float,2>{0.215832874f, 0.333456755f},
-std::array<float,2>{0.30451256f, 0.584309161f},
-std::array<float,2>{0.53225714f, 0.0129528511f},
-std::array<float,2>{0.731180847f, 0.65007776f},
-std::array<float,2>{0.388646394f, 0.147076935f},
-std::array<float,2>{0.0461004116f, 0.947713733f},
-std::array<float,2>{0.864247143f, 0.386084735f},
-std::array<float,2>{0.678259015f, 0.781100929f},
-std::array<float,2>{0.459905088f, 0.298598528f},
-std::array<float,2>{0.120567419f, 0.522711515f},
-std::array<float,2>{0.759940624f, 0.0787891001f},
-std::array<float,2>{0.901081204f, 0.70675683f},
-std::array<float,2>{0.172434777f, 0.20378387f},
-std::array<float,2>{0.334817141f, 0.930995882f},
-std::array<float,2>{0.577351153f, 0.480201811f},
-std::array<float,2>{0.832145691f, 0.970626473f},
-std::array<float,2>{0.0172304194f, 0.406775415f},
-std::array<float,2>{0.408775032f, 0.685728848f},
-std::array<float,2>{0.70499742f, 0.182667643f},
-std::array<float,2>{0.530330062f, 0.611027896f},
-std::array<float,2>{0.278166473f, 0.0604819432f},
-std::array<float,2>{0.224519014f, 0.813047349f},
-std::array<float,2>{0.970142722f, 0.372348189f},
-std::array<float,2>{0.521746159f, 0.755062103f},
-std::array<float,2>{0.267095685f, 0.294189066f},
-std::array<float,2>{0.233230352f, 0.500725448f},
-std::array<float,2>{0.976562977f, 0.0769849792f},
-std::array<float,2>{0.840844631f, 0.699114323f},
-std::array<float,2>{0.0262332968f, 0.196114019f},
-std::array<float,2>{0.415727288f, 0.907983065f},
-std::array<float,2>{0.712666929f, 0.499807537f},
-std::array<float,2>{0.896097541f, 0.995408654f},
-std::array<float,2>{0.185730428f, 0.436287493f},
-std::array<float,2>{0.337151527f, 0.660762608f},
-std::array<float,2>{0.565356553f, 0.164318725f},
-std::array<float,2>{0.681937933f, 0.600802898f},
-std::array<float,2>{0.46446079f, 0.0395462252f},
-std::array<float,2>{0.11447414f, 0.834107578f},
-std::array<float,2>{0.757283807f, 0.34592694f},
-std::array<float,2>{0.720999241f, 0.88757062f},
-std::array<float,2>{0.376224339f, 0.45466584f},
-std::array<float,2>{0.0377315357f, 0.739118695f},
-std::array<float,2>{0.871450543f, 0.248512238f},
-std::array<float,2>{0.941060007f, 0.551610172f},
-std::array<float,2>{0.207859591f, 0.113179766f},
-std::array<float,2>{0.30882147f, 0.788495123f},
-std::array<float,2>{0.545598447f, 0.280604333f},
-std::array<float,2>{0.789721072f, 0.844659209f},
-std::array<float,2>{0.08780808f, 0.321112603f},
-std::array<float,2>{0.497985721f, 0.574313223f},
-std::array<float,2>{0.630592465f, 0.0229385514f},
-std::array<float,2>{0.602873683f, 0.630975664f},
-std::array<float,2>{0.371727049f, 0.131556913f},
-std::array<float,2>{0.127095073f, 0.960739613f},
-std::array<float,2>{0.919668019f, 0.394925088f},
-std::array<float,2>{0.586373627f, 0.949910343f},
-std::array<float,2>{0.326909065f, 0.389624774f},
-std::array<float,2>{0.165896937f, 0.653346598f},
-std::array<float,2>{0.880981743f, 0.14359121f},
-std::array<float,2>{0.765795887f, 0.57926029f},
-std::array<float,2>{0.10547445f, 0.00949534588f},
-std::array<float,2>{0.45265609f, 0.865742683f},
-std::array<float,2>{0.662462771f, 0.330597669f},
-std::array<float,2>{0.997802913f, 0.801960468f},
-std::array<float,2>{0.242041618f, 0.258810431f},
-std::array<float,2>{0.256052971f, 0.54253459f},
-std::array<float,2>{0.505363703f, 0.0986743346f},
-std::array<float,2>{0.691704869f, 0.729241252f},
-std::array<float,2>{0.433039427f, 0.219926909f},
-std::array<float,2>{0.0134573197f, 0.903250813f},
-std::array<float,2>{0.823895931f, 0.441388994f},
-std::array<float,2>{0.64424336f, 0.817908823f},
-std::array<float,2>{0.483360976f, 0.370368868f},
-std::array<float,2>{0.0709048584f, 0.613930166f},
-std::array<float,2>{0.807182729f, 0.0550397076f},
-std::array<float,2>{0.930093825f, 0.681848288f},
-std::array<float,2>{0.143047065f, 0.185708478f},
-std::array<float,2>{0.344139546f, 0.9765113f},
-std::array<float,2>{0.619635105f, 0.413936019f},
-std::array<float,2>{0.845118463f, 0.934091032f},
-std::array<float,2>{0.0573974624f, 0.483865052f},
-std::array<float,2>{0.394349128f, 0.709003925f},
-std::array<float,2>{0.743998766f, 0.208931327f},
-std::array<float,2>{0.549749494f, 0.517649949f},
-std::array<float,2>{0.290703565f, 0.0824774429f},
-std::array<float,2>{0.19361046f, 0.774187386f},
-std::array<float,2>{0.967013359f, 0.301219821f},
-std::array<float,2>{0.613943577f, 0.87115407f},
-std::array<float,2>{0.353633821f, 0.338484287f},
-std::array<float,2>{0.151537225f, 0.58628875f},
-std::array<float,2>{0.928183496f, 0.00168543344f},
-std::array<float,2>{0.801269531f, 0.644341826f},
-std::array<float,2>{0.0687120631f, 0.155679703f},
-std::array<float,2>{0.473715603f, 0.943848968f},
-std::array<float,2>{0.652912736f, 0.38021028f},
-std::array<float,2>{0.954422891f, 0.893720806f},
-std::array<float,2>{0.196961164f, 0.449788362f},
-std::array<float,2>{0.281402528f, 0.720552146f},
-std::array<float,2>{0.559513509f, 0.2287637f},
-std::array<float,2>{0.736430705f, 0.532686412f},
-std::array<float,2>{0.403239548f, 0.10573981f},
-std::array<float,2>{0.0533576794f, 0.807261825f},
-std::array<float,2>{0.853246868f, 0.254331082f},
-std::array<float,2>{0.668520927f, 0.978589654f},
-std::array<float,2>{0.441236466f, 0.416900307f},
-std::array<float,2>{0.098069571f, 0.672774017f},
-std::array<float,2>{0.775096893f, 0.172261596f},
-std::array<float,2>{0.887781322f, 0.622923732f},
-std::array<float,2>{0.16021657f, 0.0470899045f},
-std::array<float,2>{0.318773866f, 0.820813894f},
-std::array<float,2>{0.584925175f, 0.363326162f},
-std::array<float,2>{0.814038932f, 0.769815981f},
-std::array<float,2>{0.00111760944f, 0.312033683f},
-std::array<float,2>{0.426246464f, 0.529249847f},
-std::array<float,2>{0.69727093f, 0.0909444764f},
-std::array<float,2>{0.509152234f, 0.714552104f},
-std::array<float,2>{0.26143977f, 0.217872441f},
-std::array<float,2>{0.244788557f, 0.923973083f},
-std::array<float,2>{0.989065349f, 0.46894744f},
-std::array<float,2>{0.535592198f, 0.921504676f},
-std::array<float,2>{0.297805607f, 0.490880221f},
-std::array<float,2>{0.213263094f, 0.692846477f},
-std::array<float,2>{0.948368847f, 0.192881122f},
-std::array<float,2>{0.86110276f, 0.513904989f},
-std::array<float,2>{0.0421711244f, 0.0675019175f},
-std::array<float,2>{0.386456847f, 0.762731612f},
-std::array<float,2>{0.729567468f, 0.288351417f},
-std::array<float,2>{0.90751791f, 0.84242487f},
-std::array<float,2>{0.137837797f, 0.352986395f},
-std::array<float,2>{0.366038024f, 0.608666182f},
-std::array<float,2>{0.596011102f, 0.0346633978f},
-std::array<float,2>{0.636531532f, 0.668157518f},
-std::array<float,2>{0.48779422f, 0.157644823f},
-std::array<float,2>{0.0834395587f, 0.99053961f},
-std::array<float,2>{0.7865206f, 0.427118212f},
-std::array<float,2>{0.708663881f, 0.789782763f},
-std::array<float,2>{0.410969287f, 0.273038328f},
-std::array<float,2>{0.020321263f, 0.559928954f},
-std::array<float,2>{0.828425586f, 0.12240538f},
-std::array<float,2>{0.976404369f, 0.746032298f},
-std::array<float,2>{0.221136257f, 0.240359306f},
-std::array<float,2>{0.274953723f, 0.877790034f},
-std::array<float,2>{0.525603473f, 0.461619943f},
-std::array<float,2>{0.765502989f, 0.962348223f},
-std::array<float,2>{0.123737425f, 0.401849031f},
-std::array<float,2>{0.456329495f, 0.638434947f},
-std::array<float,2>{0.672822595f, 0.135956094f},
-std::array<float,2>{0.573812425f, 0.562929451f},
-std::array<float,2>{0.330121666f, 0.0243147183f},
-std::array<float,2>{0.177518919f, 0.858150899f},
-std::array<float,2>{0.903900564f, 0.318429977f},
-std::array<float,2>{0.622300744f, 0.794499516f},
-std::array<float,2>{0.348033875f, 0.26668635f},
-std::array<float,2>{0.146061897f, 0.556264579f},
-std::array<float,2>{0.933617651f, 0.120821729f},
-std::array<float,2>{0.810285866f, 0.746157825f},
-std::array<float,2>{0.0780182704f, 0.235033393f},
-std::array<float,2>{0.478158116f, 0.879198134f},
-std::array<float,2>{0.64820528f, 0.465567768f},
-std::array<float,2>{0.964375734f, 0.965873837f},
-std::array<float,2>{0.187757239f, 0.402508706f},
-std::array<float,2>{0.293127507f, 0.632829189f},
-std::array<float,2>{0.55268532f, 0.138192639f},
-std::array<float,2>{0.749506295f, 0.567716658f},
-std::array<float,2>{0.394971728f, 0.0277026743f},
-std::array<float,2>{0.0601922534f, 0.851710677f},
-std::array<float,2>{0.849638879f, 0.314213693f},
-std::array<float,2>{0.657977045f, 0.914690912f},
-std::array<float,2>{0.449147671f, 0.487501353f},
-std::array<float,2>{0.101780638f, 0.689337909f},
-std::array<float,2>{0.7701177f, 0.190589711f},
-std::array<float,2>{0.875490963f, 0.509809077f},
-std::array<float,2>{0.171231121f, 0.0662150085f},
-std::array<float,2>{0.322580397f, 0.757837713f},
-std::array<float,2>{0.593725383f, 0.283319741f},
-std::array<float,2>{0.826518297f, 0.836042583f},
-std::array<float,2>{0.0108362157f, 0.355583102f},
-std::array<float,2>{0.436282963f, 0.602904558f},
-std::array<float,2>{0.691296697f, 0.038906645f},
-std::array<float,2>{0.50339973f, 0.666350961f},
-std::array<float,2>{0.253127664f, 0.162498355f},
-std::array<float,2>{0.237533987f, 0.987337053f},
-std::array<float,2>{0.995385945f, 0.421900839f},
-std::array<float,2>{0.539620817f, 0.981690764f},
-std::array<float,2>{0.305949867f, 0.418606669f},
-std::array<float,2>{0.206416905f, 0.679440081f},
-std::array<float,2>{0.942501545f, 0.178522646f},
-std::array<float,2>{0.869638443f, 0.619176686f},
-std::array<float,2>{0.0346373469f, 0.0532142073f},
-std::array<float,2>{0.380816549f, 0.825858593f},
-std::array<float,2>{0.725098729f, 0.362928927f},
-std::array<float,2>{0.916945219f, 0.767007768f},
-std::array<float,2>{0.130650729f, 0.305359453f},
-std::array<float,2>{0.370642096f, 0.524832964f},
-std::array<float,2>{0.608444273f, 0.0887902305f},
-std::array<float,2>{0.62645185f, 0.71603924f},
-std::array<float,2>{0.492207974f, 0.211083785f},
-std::array<float,2>{0.0900807977f, 0.928063929f},
-std::array<float,2>{0.793332219f, 0.47634995f},
-std::array<float,2>{0.716900945f, 0.867673695f},
-std::array<float,2>{0.420743555f, 0.340446532f},
-std::array<float,2>{0.0311218873f, 0.591745377f},
-std::array<float,2>{0.839310586f, 0.0044845948f},
-std::array<float,2>{0.980583847f, 0.646778405f},
-std::array<float,2>{0.227486014f, 0.150434181f},
-std::array<float,2>{0.27076751f, 0.939156175f},
-std::array<float,2>{0.518366337f, 0.375582546f},
-std::array<float,2>{0.753661931f, 0.896653116f},
-std::array<float,2>{0.109780148f, 0.447843403f},
-std::array<float,2>{0.466583461f, 0.725266159f},
-std::array<float,2>{0.685191154f, 0.231778309f},
-std::array<float,2>{0.566980422f, 0.537380755f},
-std::array<float,2>{0.340941221f, 0.105297245f},
-std::array<float,2>{0.181504056f, 0.809703887f},
-std::array<float,2>{0.894052148f, 0.252019286f},
-std::array<float,2>{0.528411806f, 0.813480794f},
-std::array<float,2>{0.279983491f, 0.371220559f},
-std::array<float,2>{0.225322232f, 0.610277236f},
-std::array<float,2>{0.971949935f, 0.0586516224f},
-std::array<float,2>{0.834614813f, 0.687175214f},
-std::array<float,2>{0.0187576097f, 0.181857318f},
-std::array<float,2>{0.408075958f, 0.969283044f},
-std::array<float,2>{0.706888676f, 0.407827914f},
-std::array<float,2>{0.898557246f, 0.930339694f},
-std::array<float,2>{0.175550148f, 0.479143322f},
-std::array<float,2>{0.333707124f, 0.705260277f},
-std::array<float,2>{0.57475704f, 0.204319254f},
-std::array<float,2>{0.676439822f, 0.522182226f},
-std::array<float,2>{0.457087636f, 0.0796289891f},
-std::array<float,2>{0.1191319f, 0.779896617f},
-std::array<float,2>{0.75855881f, 0.297128141f},
-std::array<float,2>{0.733287632f, 0.948543131f},
-std::array<float,2>{0.388713747f, 0.385678649f},
-std::array<float,2>{0.0431776345f, 0.649106383f},
-std::array<float,2>{0.865346909f, 0.148236558f},
-std::array<float,2>{0.949423611f, 0.584968448f},
-std::array<float,2>{0.218555018f, 0.0126112113f},
-std::array<float,2>{0.301733613f, 0.862800717f},
-std::array<float,2>{0.533929527f, 0.332239985f},
-std::array<float,2>{0.783821225f, 0.797677815f},
-std::array<float,2>{0.0811442807f, 0.263152361f},
-std::array<float,2>{0.489498913f, 0.545426667f},
-std::array<float,2>{0.637793601f, 0.0974348634f},
-std::array<float,2>{0.599894285f, 0.730898499f},
-std::array<float,2>{0.36086151f, 0.226366311f},
-std::array<float,2>{0.133870393f, 0.900784492f},
-std::array<float,2>{0.911843836f, 0.443471402f},
-std::array<float,2>{0.581767857f, 0.884929478f},
-std::array<float,2>{0.315820038f, 0.460206896f},
-std::array<float,2>{0.157616317f, 0.735093117f},
-std::array<float,2>{0.884053886f, 0.245874614f},
-std::array<float,2>{0.780082881f, 0.548722625f},
-std::array<float,2>{0.0946823806f, 0.116423726f},
-std::array<float,2>{0.443903089f, 0.781616569f},
-std::array<float,2>{0.664373398f, 0.274304181f},
-std::array<float,2>{0.986570299f, 0.849668145f},
-std::array<float,2>{0.246784627f, 0.327635854f},
-std::array<float,2>{0.26271686f, 0.570496857f},
-std::array<float,2>{0.513835907f, 0.0182914771f},
-std::array<float,2>{0.700596452f, 0.625565648f},
-std::array<float,2>{0.423424214f, 0.125307634f},
-std::array<float,2>{0.0072247982f, 0.954959512f},
-std::array<float,2>{0.817131877f, 0.391055107f},
-std::array<float,2>{0.649608314f, 0.752028584f},
-std::array<float,2>{0.472429276f, 0.289954752f},
-std::array<float,2>{0.0655783564f, 0.507660329f},
-std::array<float,2>{0.799329102f, 0.0736388862f},
-std::array<float,2>{0.92502445f, 0.700403631f},
-std::array<float,2>{0.153380036f, 0.200892404f},
-std::array<float,2>{0.355507404f, 0.911915123f},
-std::array<float,2>{0.611939788f, 0.4937841f},
-std::array<float,2>{0.857780516f, 0.999677598f},
-std::array<float,2>{0.0496539213f, 0.430833638f},
-std::array<float,2>{0.399079889f, 0.658084393f},
-std::array<float,2>{0.739161551f, 0.168041199f},
-std::array<float,2>{0.556471646f, 0.594466031f},
-std::array<float,2>{0.288456023f, 0.0441939384f},
-std::array<float,2>{0.200224489f, 0.831411064f},
-std::array<float,2>{0.959358335f, 0.351125032f},
-std::array<float,2>{0.547733366f, 0.775065958f},
-std::array<float,2>{0.29105407f, 0.302730292f},
-std::array<float,2>{0.191516742f, 0.51881367f},
-std::array<float,2>{0.964928448f, 0.0834577903f},
-std::array<float,2>{0.84592098f, 0.710467875f},
-std::array<float,2>{0.0552436933f, 0.207335994f},
-std::array<float,2>{0.391828507f, 0.934896946f},
-std::array<float,2>{0.745723248f, 0.48338756f},
-std::array<float,2>{0.933585763f, 0.974789798f},
-std::array<float,2>{0.141438261f, 0.413028091f},
-std::array<float,2>{0.347453713f, 0.683159828f},
-std::array<float,2>{0.617869675f, 0.187165514f},
-std::array<float,2>{0.640645683f, 0.614545643f},
-std::array<float,2>{0.480789781f, 0.056234248f},
-std::array<float,2>{0.0726585835f, 0.816567898f},
-std::array<float,2>{0.806467712f, 0.369270265f},
-std::array<float,2>{0.694984496f, 0.903501689f},
-std::array<float,2>{0.430514634f, 0.439800918f},
-std::array<float,2>{0.0152923455f, 0.729646742f},
-std::array<float,2>{0.821612298f, 0.218957201f},
-std::array<float,2>{0.998084545f, 0.541521311f},
-std::array<float,2>{0.238788396f, 0.0984940231f},
-std::array<float,2>{0.254697978f, 0.801746964f},
-std::array<float,2>{0.506125629f, 0.258126557f},
-std::array<float,2>{0.767991662f, 0.866984606f},
-std::array<float,2>{0.107631177f, 0.331937075f},
-std::array<float,2>{0.450870574f, 0.57878691f},
-std::array<float,2>{0.660570562f, 0.00863862783f},
-std::array<float,2>{0.589794099f, 0.652352989f},
-std::array<float,2>{0.32565549f, 0.143032953f},
-std::array<float,2>{0.166158527f, 0.950891316f},
-std::array<float,2>{0.880345523f, 0.390524179f},
-std::array<float,2>{0.604921222f, 0.959605813f},
-std::array<float,2>{0.373122424f, 0.396025598f},
-std::array<float,2>{0.126918703f, 0.632434368f},
-std::array<float,2>{0.92024225f, 0.132739827f},
-std::array<float,2>{0.79283911f, 0.575947046f},
-std::array<float,2>{0.0893379077f, 0.0216713399f},
-std::array<float,2>{0.499203384f, 0.845612526f},
-std::array<float,2>{0.631699324f, 0.321831048f},
-std::array<float,2>{0.937633812f, 0.787706017f},
-std::array<float,2>{0.209013239f, 0.279807895f},
-std::array<float,2>{0.310774416f, 0.551982343f},
-std::array<float,2>{0.544549525f, 0.112038203f},
-std::array<float,2>{0.719831705f, 0.740091681f},
-std::array<float,2>{0.377083719f, 0.249645844f},
-std::array<float,2>{0.036755614f, 0.88852942f},
-std::array<float,2>{0.873878181f, 0.453335255f},
-std::array<float,2>{0.679963887f, 0.834966838f},
-std::array<float,2>{0.461557776f, 0.346839964f},
-std::array<float,2>{0.115550436f, 0.599651158f},
-std::array<float,2>{0.754600167f, 0.0402224846f},
-std::array<float,2>{0.898436785f, 0.661774516f},
-std::array<float,2>{0.1849038f, 0.165915355f},
-std::array<float,2>{0.338583201f, 0.994212806f},
-std::array<float,2>{0.563535869f, 0.437381685f},
-std::array<float,2>{0.842403352f, 0.906398118f},
-std::array<float,2>{0.0237418599f, 0.498451233f},
-std::array<float,2>{0.417033285f, 0.698148072f},
-std::array<float,2>{0.713000178f, 0.196643531f},
-std::array<float,2>{0.520545661f, 0.501698136f},
-std::array<float,2>{0.26842761f, 0.0776096955f},
-std::array<float,2>{0.231766969f, 0.754547775f},
-std::array<float,2>{0.980441809f, 0.29361552f},
-std::array<float,2>{0.572118521f, 0.859169126f},
-std::array<float,2>{0.329340011f, 0.319756508f},
-std::array<float,2>{0.179247171f, 0.563936472f},
-std::array<float,2>{0.90463835f, 0.0245106649f},
-std::array<float,2>{0.763113379f, 0.637690604f},
-std::array<float,2>{0.121174052f, 0.135415629f},
-std::array<float,2>{0.454363883f, 0.961057842f},
-std::array<float,2>{0.674665689f, 0.400909692f},
-std::array<float,2>{0.972974241f, 0.878840148f},
-std::array<float,2>{0.219651967f, 0.462847531f},
-std::array<float,2>{0.276127338f, 0.744888783f},
-std::array<float,2>{0.524450779f, 0.241583705f},
-std::array<float,2>{0.710347712f, 0.558899462f},
-std::array<float,2>{0.412293136f, 0.121518567f},
-std::array<float,2>{0.0232135747f, 0.790274501f},
-std::array<float,2>{0.830227673f, 0.271862268f},
-std::array<float,2>{0.633909583f, 0.991256893f},
-std::array<float,2>{0.485447407f, 0.426708132f},
-std::array<float,2>{0.085358426f, 0.669100046f},
-std::array<float,2>{0.787415504f, 0.156883448f},
-std::array<float,2>{0.909116209f, 0.607792795f},
-std::array<float,2>{0.139196172f, 0.0341345668f},
-std::array<float,2>{0.364891946f, 0.843205333f},
-std::array<float,2>{0.59538728f, 0.352415383f},
-std::array<float,2>{0.862687469f, 0.762541294f},
-std::array<float,2>{0.0391197726f, 0.287236542f},
-std::array<float,2>{0.383095711f, 0.515324771f},
-std::array<float,2>{0.727516472f, 0.0670981705f},
-std::array<float,2>{0.537852943f, 0.692363143f},
-std::array<float,2>{0.299265355f, 0.191759422f},
-std::array<float,2>{0.211981967f, 0.92011863f},
-std::array<float,2>{0.946056724f, 0.491447806f},
-std::array<float,2>{0.510657609f, 0.925010443f},
-std::array<float,2>{0.258846045f, 0.470051557f},
-std::array<float,2>{0.243104264f, 0.71330446f},
-std::array<float,2>{0.991527855f, 0.21712786f},
-std::array<float,2>{0.814875364f, 0.528075933f},
-std::array<float,2>{0.0023553872f, 0.0905726925f},
-std::array<float,2>{0.428520918f, 0.77146554f},
-std::array<float,2>{0.696051002f, 0.310641319f},
-std::array<float,2>{0.888695896f, 0.82210654f},
-std::array<float,2>{0.162780404f, 0.364402533f},
-std::array<float,2>{0.317942351f, 0.621471286f},
-std::array<float,2>{0.582101882f, 0.0481680557f},
-std::array<float,2>{0.671863079f, 0.673714757f},
-std::array<float,2>{0.43850553f, 0.173511446f},
-std::array<float,2>{0.100691751f, 0.979608119f},
-std::array<float,2>{0.775861382f, 0.417652398f},
-std::array<float,2>{0.73488611f, 0.807740331f},
-std::array<float,2>{0.404793739f, 0.255038291f},
-std::array<float,2>{0.0510503463f, 0.53136301f},
-std::array<float,2>{0.854628682f, 0.107360825f},
-std::array<float,2>{0.955601156f, 0.719268918f},
-std::array<float,2>{0.198147491f, 0.229905397f},
-std::array<float,2>{0.283227473f, 0.893229425f},
-std::array<float,2>{0.562018514f, 0.451015204f},
-std::array<float,2>{0.803961754f, 0.944376945f},
-std::array<float,2>{0.0668488592f, 0.379186362f},
-std::array<float,2>{0.476276129f, 0.643292964f},
-std::array<float,2>{0.65609318f, 0.155258834f},
-std::array<float,2>{0.615741253f, 0.587086618f},
-std::array<float,2>{0.351844251f, 0.000109056069f},
-std::array<float,2>{0.149993077f, 0.872188926f},
-std::array<float,2>{0.927375138f, 0.339216501f},
-std::array<float,2>{0.590629995f, 0.759899437f},
-std::array<float,2>{0.320672959f, 0.282200426f},
-std::array<float,2>{0.168532386f, 0.508973718f},
-std::array<float,2>{0.877301991f, 0.0630788282f},
-std::array<float,2>{0.773423672f, 0.690335095f},
-std::array<float,2>{0.105227105f, 0.188679174f},
-std::array<float,2>{0.447174728f, 0.916319907f},
-std::array<float,2>{0.658948958f, 0.486059815f},
-std::array<float,2>{0.992258012f, 0.985516071f},
-std::array<float,2>{0.234525502f, 0.424668342f},
-std::array<float,2>{0.250331879f, 0.664412141f},
-std::array<float,2>{0.500336051f, 0.162103415f},
-std::array<float,2>{0.688073695f, 0.604170144f},
-std::array<float,2>{0.434310436f, 0.0366425812f},
-std::array<float,2>{0.00844974816f, 0.838788331f},
-std::array<float,2>{0.825003922f, 0.358099461f},
-std::array<float,2>{0.644725084f, 0.881655455f},
-std::array<float,2>{0.478521109f, 0.467167735f},
-std::array<float,2>{0.0745487809f, 0.749279737f},
-std::array<float,2>{0.811040819f, 0.23730363f},
-std::array<float,2>{0.936936319f, 0.556754529f},
-std::array<float,2>{0.147440806f, 0.118104897f},
-std::array<float,2>{0.351142257f, 0.795501828f},
-std::array<float,2>{0.624433517f, 0.268261909f},
-std::array<float,2>{0.848183393f, 0.854640961f},
-std::array<float,2>{0.060963098f, 0.316056192f},
-std::array<float,2>{0.397477239f, 0.568905532f},
-std::array<float,2>{0.747379363f, 0.0306822583f},
-std::array<float,2>{0.553779423f, 0.635053337f},
-std::array<float,2>{0.295905799f, 0.138786659f},
-std::array<float,2>{0.189463809f, 0.967424095f},
-std::array<float,2>{0.96104902f, 0.404622436f},
-std::array<float,2>{0.517500699f, 0.939556301f},
-std::array<float,2>{0.271574199f, 0.377717853f},
-std::array<float,2>{0.229804784f, 0.645928144f},
-std::array<float,2>{0.982900858f, 0.148765787f},
-std::array<float,2>{0.835992515f, 0.593573093f},
-std::array<float,2>{0.0274737161f, 0.00751805864f},
-std::array<float,2>{0.418923885f, 0.870095611f},
-std::array<float,2>{0.716017902f, 0.342267752f},
-std::array<float,2>{0.890753746f, 0.810661435f},
-std::array<float,2>{0.182152331f, 0.251636356f},
-std::array<float,2>{0.342457235f, 0.536634803f},
-std::array<float,2>{0.569166005f, 0.101581618f},
-std::array<float,2>{0.685909331f, 0.723313332f},
-std::array<float,2>{0.468449026f, 0.232900321f},
-std::array<float,2>{0.113259673f, 0.895602942f},
-std::array<float,2>{0.750697255f, 0.447223246f},
-std::array<float,2>{0.723764181f, 0.826841533f},
-std::array<float,2>{0.382703632f, 0.359847277f},
-std::array<float,2>{0.0316275805f, 0.61846441f},
-std::array<float,2>{0.869005978f, 0.0517957769f},
-std::array<float,2>{0.945084631f, 0.676777124f},
-std::array<float,2>{0.20470199f, 0.175890878f},
-std::array<float,2>{0.306995034f, 0.984204113f},
-std::array<float,2>{0.54198873f, 0.421361238f},
-std::array<float,2>{0.795609236f, 0.927458286f},
-std::array<float,2>{0.0928446203f, 0.472743899f},
-std::array<float,2>{0.494258463f, 0.717429817f},
-std::array<float,2>{0.628006935f, 0.214138478f},
-std::array<float,2>{0.607261837f, 0.526494563f},
-std::array<float,2>{0.368237287f, 0.0877548382f},
-std::array<float,2>{0.132510349f, 0.767661452f},
-std::array<float,2>{0.915097415f, 0.306936383f},
-std::array<float,2>{0.532163858f, 0.859466672f},
-std::array<float,2>{0.303599596f, 0.335143983f},
-std::array<float,2>{0.214878261f, 0.58273989f},
-std::array<float,2>{0.951922238f, 0.0148912817f},
-std::array<float,2>{0.865220368f, 0.652256787f},
-std::array<float,2>{0.0454489924f, 0.145967767f},
-std::array<float,2>{0.387483686f, 0.945524335f},
-std::array<float,2>{0.731673837f, 0.383496761f},
-std::array<float,2>{0.912936151f, 0.899634361f},
-std::array<float,2>{0.135154679f, 0.441775292f},
-std::array<float,2>{0.362428069f, 0.733587623f},
-std::array<float,2>{0.598566473f, 0.223602995f},
-std::array<float,2>{0.640188634f, 0.544253826f},
-std::array<float,2>{0.491324872f, 0.0939618498f},
-std::array<float,2>{0.0791817755f, 0.799752653f},
-std::array<float,2>{0.781597674f, 0.265209496f},
-std::array<float,2>{0.703811586f, 0.971208155f},
-std::array<float,2>{0.409560859f, 0.408219367f},
-std::array<float,2>{0.0164066385f, 0.685403883f},
-std::array<float,2>{0.833369017f, 0.18059358f},
-std::array<float,2>{0.969573498f, 0.612038732f},
-std::array<float,2>{0.223189473f, 0.0611299202f},
-std::array<float,2>{0.279180706f, 0.815996408f},
-std::array<float,2>{0.529936433f, 0.373512834f},
-std::array<float,2>{0.760965228f, 0.779134393f},
-std::array<float,2>{0.119493663f, 0.30026406f},
-std::array<float,2>{0.460453182f, 0.521321118f},
-std::array<float,2>{0.679528832f, 0.0804005414f},
-std::array<float,2>{0.576816022f, 0.703493237f},
-std::array<float,2>{0.334979862f, 0.206360087f},
-std::array<float,2>{0.173817873f, 0.931642532f},
-std::array<float,2>{0.902320623f, 0.477650136f},
-std::array<float,2>{0.609735966f, 0.913213134f},
-std::array<float,2>{0.359096199f, 0.496093094f},
-std::array<float,2>{0.155223414f, 0.701763809f},
-std::array<float,2>{0.922028542f, 0.202002585f},
-std::array<float,2>{0.798508644f, 0.504677832f},
-std::array<float,2>{0.0630451888f, 0.0714374855f},
-std::array<float,2>{0.469490916f, 0.750947118f},
-std::array<float,2>{0.651932895f, 0.292650551f},
-std::array<float,2>{0.958843648f, 0.829131663f},
-std::array<float,2>{0.203117818f, 0.34769538f},
-std::array<float,2>{0.286049426f, 0.597399533f},
-std::array<float,2>{0.557519376f, 0.0466703996f},
-std::array<float,2>{0.741495132f, 0.660065651f},
-std::array<float,2>{0.4016864f, 0.171023577f},
-std::array<float,2>{0.0482608415f, 0.997992992f},
-std::array<float,2>{0.855933249f, 0.433278203f},
-std::array<float,2>{0.667712629f, 0.785117626f},
-std::array<float,2>{0.441610813f, 0.275893569f},
-std::array<float,2>{0.0961514935f, 0.549337149f},
-std::array<float,2>{0.779061615f, 0.11397671f},
-std::array<float,2>{0.886330187f, 0.737843812f},
-std::array<float,2>{0.160040259f, 0.24228999f},
-std::array<float,2>{0.314101756f, 0.883218408f},
-std::array<float,2>{0.57858187f, 0.457488805f},
-std::array<float,2>{0.820161283f, 0.955559552f},
-std::array<float,2>{0.00500869751f, 0.394049883f},
-std::array<float,2>{0.424433261f, 0.628228724f},
-std::array<float,2>{0.701961339f, 0.128265917f},
-std::array<float,2>{0.512922287f, 0.573374927f},
-std::array<float,2>{0.264171511f, 0.0171346106f},
-std::array<float,2>{0.249399364f, 0.848001361f},
-std::array<float,2>{0.984585106f, 0.325130314f},
-std::array<float,2>{0.504417539f, 0.802942455f},
-std::array<float,2>{0.256945431f, 0.259851664f},
-std::array<float,2>{0.240773931f, 0.540412366f},
-std::array<float,2>{0.997068524f, 0.100698285f},
-std::array<float,2>{0.82277751f, 0.7283324f},
-std::array<float,2>{0.0125648379f, 0.22136794f},
-std::array<float,2>{0.432280689f, 0.904394686f},
-std::array<float,2>{0.692526579f, 0.439302653f},
-std::array<float,2>{0.882016659f, 0.951558053f},
-std::array<float,2>{0.16480355f, 0.387257367f},
-std::array<float,2>{0.327294916f, 0.654452264f},
-std::array<float,2>{0.587312877f, 0.141807765f},
-std::array<float,2>{0.663632691f, 0.580879748f},
-std::array<float,2>{0.451698631f, 0.010169223f},
-std::array<float,2>{0.106912464f, 0.86497122f},
-std::array<float,2>{0.767284691f, 0.329010814f},
-std::array<float,2>{0.742992043f, 0.935887158f},
-std::array<float,2>{0.393123746f, 0.481627524f},
-std::array<float,2>{0.0581384934f, 0.707241833f},
-std::array<float,2>{0.84402293f, 0.209981084f},
-std::array<float,2>{0.968511939f, 0.516610622f},
-std::array<float,2>{0.194508642f, 0.0847152993f},
-std::array<float,2>{0.289527237f, 0.776096344f},
-std::array<float,2>{0.549992442f, 0.303310841f},
-std::array<float,2>{0.808306813f, 0.819488525f},
-std::array<float,2>{0.0713136569f, 0.368086874f},
-std::array<float,2>{0.483482927f, 0.615824163f},
-std::array<float,2>{0.643198133f, 0.0575049408f},
-std::array<float,2>{0.620731413f, 0.680320024f},
-std::array<float,2>{0.345033675f, 0.184259862f},
-std::array<float,2>{0.143805563f, 0.973422945f},
-std::array<float,2>{0.931068599f, 0.410862505f},
-std::array<float,2>{0.565701842f, 0.993182063f},
-std::array<float,2>{0.336666197f, 0.435281545f},
-std::array<float,2>{0.186587319f, 0.662328601f},
-std::array<float,2>{0.895505905f, 0.166183338f},
-std::array<float,2>{0.756822109f, 0.598385334f},
-std::array<float,2>{0.113621145f, 0.0412359647f},
-std::array<float,2>{0.463276595f, 0.833005965f},
-std::array<float,2>{0.68313688f, 0.345323354f},
-std::array<float,2>{0.978067398f, 0.757200539f},
-std::array<float,2>{0.233825907f, 0.296349138f},
-std::array<float,2>{0.266181409f, 0.503349245f},
-std::array<float,2>{0.52335906f, 0.0742775574f},
-std::array<float,2>{0.711838067f, 0.696554482f},
-std::array<float,2>{0.414867371f, 0.198724672f},
-std::array<float,2>{0.0264018681f, 0.909914613f},
-std::array<float,2>{0.840424299f, 0.497380763f},
-std::array<float,2>{0.629032195f, 0.847088277f},
-std::array<float,2>{0.497061908f, 0.3235282f},
-std::array<float,2>{0.0862005726f, 0.577772796f},
-std::array<float,2>{0.790278971f, 0.0199536812f},
-std::array<float,2>{0.918722749f, 0.630689204f},
-std::array<float,2>{0.128308266f, 0.130824581f},
-std::array<float,2>{0.372359097f, 0.957113028f},
-std::array<float,2>{0.602239609f, 0.397109926f},
-std::array<float,2>{0.872761607f, 0.889512956f},
-std::array<float,2>{0.0388666503f, 0.456285179f},
-std::array<float,2>{0.375320703f, 0.741125166f},
-std::array<float,2>{0.721878946f, 0.246626705f},
-std::array<float,2>{0.546491504f, 0.5530954f},
-std::array<float,2>{0.310418934f, 0.10965991f},
-std::array<float,2>{0.20893918f, 0.786848545f},
-std::array<float,2>{0.940312684f, 0.27755177f},
-std::array<float,2>{0.597417831f, 0.840383589f},
-std::array<float,2>{0.36690414f, 0.355177701f},
-std::array<float,2>{0.13765125f, 0.60655123f},
-std::array<float,2>{0.906451762f, 0.0331704877f},
-std::array<float,2>{0.785223603f, 0.671273589f},
-std::array<float,2>{0.0826135129f, 0.158902213f},
-std::array<float,2>{0.486858904f, 0.988723814f},
-std::array<float,2>{0.634941578f, 0.429307103f},
-std::array<float,2>{0.947930574f, 0.918467164f},
-std::array<float,2>{0.214344442f, 0.488638699f},
-std::array<float,2>{0.298267871f, 0.694202304f},
-std::array<float,2>{0.536233485f, 0.193362311f},
-std::array<float,2>{0.728909135f, 0.512922883f},
-std::array<float,2>{0.385665864f, 0.0694881305f},
-std::array<float,2>{0.0411243439f, 0.765170634f},
-std::array<float,2>{0.859883428f, 0.286459178f},
-std::array<float,2>{0.673083186f, 0.964344084f},
-std::array<float,2>{0.455864757f, 0.399671882f},
-std::array<float,2>{0.124343723f, 0.640348196f},
-std::array<float,2>{0.764636934f, 0.133735344f},
-std::array<float,2>{0.902634203f, 0.566306412f},
-std::array<float,2>{0.17664434f, 0.0268064942f},
-std::array<float,2>{0.332021058f, 0.857284129f},
-std::array<float,2>{0.573147833f, 0.318030626f},
-std::array<float,2>{0.829755485f, 0.792437613f},
-std::array<float,2>{0.0205566529f, 0.270939261f},
-std::array<float,2>{0.411191106f, 0.5621171f},
-std::array<float,2>{0.707955003f, 0.123924553f},
-std::array<float,2>{0.52679497f, 0.742240667f},
-std::array<float,2>{0.27440691f, 0.240017965f},
-std::array<float,2>{0.221683815f, 0.876199663f},
-std::array<float,2>{0.974876106f, 0.463265449f},
-std::array<float,2>{0.560446322f, 0.890731096f},
-std::array<float,2>{0.282495558f, 0.451914877f},
-std::array<float,2>{0.195452765f, 0.721779466f},
-std::array<float,2>{0.953872919f, 0.227250934f},
-std::array<float,2>{0.852113903f, 0.5336743f},
-std::array<float,2>{0.0537849851f, 0.107465051f},
-std::array<float,2>{0.403533131f, 0.805914819f},
-std::array<float,2>{0.737542152f, 0.256147146f},
-std::array<float,2>{0.929496706f, 0.874490976f},
-std::array<float,2>{0.15107432f, 0.336996585f},
-std::array<float,2>{0.355099201f, 0.588056028f},
-std::array<float,2>{0.614580333f, 0.0026025502f},
-std::array<float,2>{0.653395832f, 0.640653551f},
-std::array<float,2>{0.473018974f, 0.153926909f},
-std::array<float,2>{0.0697970167f, 0.942000747f},
-std::array<float,2>{0.802241027f, 0.382164091f},
-std::array<float,2>{0.69859761f, 0.772367656f},
-std::array<float,2>{0.42719394f, 0.310180634f},
-std::array<float,2>{0.000561963592f, 0.531099319f},
-std::array<float,2>{0.812725902f, 0.0935938731f},
-std::array<float,2>{0.990011632f, 0.711894751f},
-std::array<float,2>{0.245574847f, 0.215727568f},
-std::array<float,2>{0.26001215f, 0.922698379f},
-std::array<float,2>{0.50826931f, 0.470836133f},
-std::array<float,2>{0.773661077f, 0.976975739f},
-std::array<float,2>{0.099414207f, 0.414809078f},
-std::array<float,2>{0.439498812f, 0.674610674f},
-std::array<float,2>{0.669393241f, 0.175107986f},
-std::array<float,2>{0.585607648f, 0.62453723f},
-std::array<float,2>{0.319408566f, 0.048879467f},
-std::array<float,2>{0.161814958f, 0.823630929f},
-std::array<float,2>{0.88761133f, 0.366784543f},
-std::array<float,2>{0.617981136f, 0.776723325f},
-std::array<float,2>{0.347337812f, 0.304141551f},
-std::array<float,2>{0.141301244f, 0.516394913f},
-std::array<float,2>{0.933135986f, 0.0856051147f},
-std::array<float,2>{0.806348383f, 0.708051503f},
-std::array<float,2>{0.0724941567f, 0.209801912f},
-std::array<float,2>{0.480694383f, 0.937180936f},
-std::array<float,2>{0.640990913f, 0.480570972f},
-std::array<float,2>{0.965235174f, 0.974350214f},
-std::array<float,2>{0.19181326f, 0.411246777f},
-std::array<float,2>{0.291343927f, 0.680880606f},
-std::array<float,2>{0.547462881f, 0.185110524f},
-std::array<float,2>{0.745869577f, 0.616294026f},
-std::array<float,2>{0.391863525f, 0.0583519638f},
-std::array<float,2>{0.0555277206f, 0.819251597f},
-std::array<float,2>{0.846093297f, 0.368227452f},
-std::array<float,2>{0.660394549f, 0.905813694f},
-std::array<float,2>{0.451049447f, 0.437621176f},
-std::array<float,2>{0.107746281f, 0.726869106f},
-std::array<float,2>{0.767814457f, 0.221892416f},
-std::array<float,2>{0.87989074f, 0.539519966f},
-std::array<float,2>{0.166476861f, 0.099760443f},
-std::array<float,2>{0.325233966f, 0.80417788f},
-std::array<float,2>{0.589456081f, 0.26119706f},
-std::array<float,2>{0.821349442f, 0.863487959f},
-std::array<float,2>{0.0155324852f, 0.329296976f},
-std::array<float,2>{0.430184722f, 0.581725657f},
-std::array<float,2>{0.695190251f, 0.0109347971f},
-std::array<float,2>{0.505870461f, 0.655934751f},
-std::array<float,2>{0.254476935f, 0.141430259f},
-std::array<float,2>{0.239127144f, 0.952894568f},
-std::array<float,2>{0.998399258f, 0.388337255f},
-std::array<float,2>{0.544799864f, 0.958479464f},
-std::array<float,2>{0.310889333f, 0.397852868f},
-std::array<float,2>{0.209458217f, 0.629724205f},
-std::array<float,2>{0.937859952f, 0.12950848f},
-std::array<float,2>{0.873664856f, 0.576559365f},
-std::array<float,2>{0.036895778f, 0.0209490452f},
-std::array<float,2>{0.377398521f, 0.846640289f},
-std::array<float,2>{0.720212758f, 0.322502345f},
-std::array<float,2>{0.919955552f, 0.785654247f},
-std::array<float,2>{0.126479268f, 0.279087067f},
-std::array<float,2>{0.373382747f, 0.554019332f},
-std::array<float,2>{0.604605615f, 0.111088522f},
-std::array<float,2>{0.631407201f, 0.74212271f},
-std::array<float,2>{0.499452144f, 0.247402504f},
-std::array<float,2>{0.088980101f, 0.890282035f},
-std::array<float,2>{0.792573333f, 0.455086261f},
-std::array<float,2>{0.713289678f, 0.833453596f},
-std::array<float,2>{0.417238265f, 0.34393844f},
-std::array<float,2>{0.0235930756f, 0.599147141f},
-std::array<float,2>{0.842704177f, 0.0422375612f},
-std::array<float,2>{0.980224431f, 0.663855791f},
-std::array<float,2>{0.231544122f, 0.167751461f},
-std::array<float,2>{0.268101811f, 0.993004024f},
-std::array<float,2>{0.52091825f, 0.434211612f},
-std::array<float,2>{0.754762828f, 0.909173608f},
-std::array<float,2>{0.11523547f, 0.496613115f},
-std::array<float,2>{0.461741388f, 0.695708156f},
-std::array<float,2>{0.679785728f, 0.198202714f},
-std::array<float,2>{0.563799024f, 0.502504885f},
-std::array<float,2>{0.338823199f, 0.0755965933f},
-std::array<float,2>{0.184747085f, 0.755945385f},
-std::array<float,2>{0.898016214f, 0.295262128f},
-std::array<float,2>{0.524755001f, 0.855856657f},
-std::array<float,2>{0.276062191f, 0.316910475f},
-std::array<float,2>{0.219265625f, 0.565288484f},
-std::array<float,2>{0.972710431f, 0.0258282498f},
-std::array<float,2>{0.830526948f, 0.639296353f},
-std::array<float,2>{0.023151774f, 0.13450855f},
-std::array<float,2>{0.412505984f, 0.963086188f},
-std::array<float,2>{0.710061252f, 0.398440689f},
-std::array<float,2>{0.904339135f, 0.87517345f},
-std::array<float,2>{0.179635003f, 0.46443978f},
-std::array<float,2>{0.329394341f, 0.743769765f},
-std::array<float,2>{0.571888685f, 0.238503203f},
-std::array<float,2>{0.674511731f, 0.560774088f},
-std::array<float,2>{0.454286575f, 0.124496318f},
-std::array<float,2>{0.121546604f, 0.791260779f},
-std::array<float,2>{0.762699485f, 0.26969254f},
-std::array<float,2>{0.727131784f, 0.989351094f},
-std::array<float,2>{0.38283211f, 0.42782414f},
-std::array<float,2>{0.039533902f, 0.670058072f},
-std::array<float,2>{0.862409532f, 0.159266159f},
-std::array<float,2>{0.94585526f, 0.605569124f},
-std::array<float,2>{0.212329149f, 0.03166667f},
-std::array<float,2>{0.298899978f, 0.841306925f},
-std::array<float,2>{0.53776294f, 0.353861243f},
-std::array<float,2>{0.787137628f, 0.764496803f},
-std::array<float,2>{0.0851129144f, 0.285584033f},
-std::array<float,2>{0.485687256f, 0.512251019f},
-std::array<float,2>{0.634174466f, 0.0685672984f},
-std::array<float,2>{0.59562856f, 0.694336891f},
-std::array<float,2>{0.365050286f, 0.195204392f},
-std::array<float,2>{0.139589831f, 0.919137955f},
-std::array<float,2>{0.908700883f, 0.489514083f},
-std::array<float,2>{0.582322001f, 0.923202634f},
-std::array<float,2>{0.31816569f, 0.472197235f},
-std::array<float,2>{0.16291061f, 0.712662816f},
-std::array<float,2>{0.888920426f, 0.21583356f},
-std::array<float,2>{0.775589287f, 0.529738545f},
-std::array<float,2>{0.100866035f, 0.0918317214f},
-std::array<float,2>{0.438868612f, 0.773352206f},
-std::array<float,2>{0.671536565f, 0.309168905f},
-std::array<float,2>{0.991381884f, 0.822506189f},
-std::array<float,2>{0.242834702f, 0.366010785f},
-std::array<float,2>{0.25924316f, 0.6231668f},
-std::array<float,2>{0.510379732f, 0.0501320586f},
-std::array<float,2>{0.695874035f, 0.675384998f},
-std::array<float,2>{0.428372264f, 0.174203053f},
-std::array<float,2>{0.00209849607f, 0.978444099f},
-std::array<float,2>{0.81448859f, 0.415914893f},
-std::array<float,2>{0.655830383f, 0.804786146f},
-std::array<float,2>{0.476411223f, 0.256919593f},
-std::array<float,2>{0.0664923489f, 0.53498131f},
-std::array<float,2>{0.803928494f, 0.109307557f},
-std::array<float,2>{0.927677691f, 0.720712781f},
-std::array<float,2>{0.150388882f, 0.22810699f},
-std::array<float,2>{0.351768941f, 0.892279625f},
-std::array<float,2>{0.616117835f, 0.452394903f},
-std::array<float,2>{0.85477984f, 0.94297272f},
-std::array<float,2>{0.0508698858f, 0.380917668f},
-std::array<float,2>{0.405251414f, 0.642298758f},
-std::array<float,2>{0.735289454f, 0.152424544f},
-std::array<float,2>{0.562358499f, 0.58964777f},
-std::array<float,2>{0.283676118f, 0.00334843458f},
-std::array<float,2>{0.197896942f, 0.873980343f},
-std::array<float,2>{0.955968678f, 0.336617231f},
-std::array<float,2>{0.552396715f, 0.796128988f},
-std::array<float,2>{0.293253541f, 0.26942277f},
-std::array<float,2>{0.187530175f, 0.557898998f},
-std::array<float,2>{0.9648121f, 0.118461713f},
-std::array<float,2>{0.850031853f, 0.748633444f},
-std::array<float,2>{0.0604039021f, 0.238108039f},
-std::array<float,2>{0.394603252f, 0.882115543f},
-std::array<float,2>{0.749044001f, 0.46777612f},
-std::array<float,2>{0.933996618f, 0.968016386f},
-std::array<float,2>{0.146257728f, 0.405731857f},
-std::array<float,2>{0.347788244f, 0.635812283f},
-std::array<float,2>{0.622418702f, 0.139713615f},
-std::array<float,2>{0.648069561f, 0.56984657f},
-std::array<float,2>{0.478336811f, 0.0295070484f},
-std::array<float,2>{0.0777414367f, 0.853801072f},
-std::array<float,2>{0.810450971f, 0.314792842f},
-std::array<float,2>{0.691105366f, 0.917305291f},
-std::array<float,2>{0.436102331f, 0.484532654f},
-std::array<float,2>{0.0111282738f, 0.691009581f},
-std::array<float,2>{0.826367199f, 0.187753499f},
-std::array<float,2>{0.995295465f, 0.508562386f},
-std::array<float,2>{0.23777616f, 0.0644268394f},
-std::array<float,2>{0.253383398f, 0.761066198f},
-std::array<float,2>{0.502970636f, 0.283017933f},
-std::array<float,2>{0.770351768f, 0.83913219f},
-std::array<float,2>{0.101861514f, 0.358475477f},
-std::array<float,2>{0.448743492f, 0.605399311f},
-std::array<float,2>{0.657868683f, 0.0355893485f},
-std::array<float,2>{0.593333662f, 0.666007102f},
-std::array<float,2>{0.322316468f, 0.160705835f},
-std::array<float,2>{0.171111897f, 0.984897316f},
-std::array<float,2>{0.875928998f, 0.424943656f},
-std::array<float,2>{0.6088503f, 0.982926548f},
-std::array<float,2>{0.370880842f, 0.420759231f},
-std::array<float,2>{0.130614579f, 0.676600218f},
-std::array<float,2>{0.91664052f, 0.176857188f},
-std::array<float,2>{0.792977393f, 0.617952526f},
-std::array<float,2>{0.0900881514f, 0.0516682789f},
-std::array<float,2>{0.492624223f, 0.827750325f},
-std::array<float,2>{0.626214385f, 0.360648781f},
-std::array<float,2>{0.942780554f, 0.769143522f},
-std::array<float,2>{0.206239268f, 0.308186918f},
-std::array<float,2>{0.305717409f, 0.526027262f},
-std::array<float,2>{0.539925992f, 0.0866053477f},
-std::array<float,2>{0.725399792f, 0.71815908f},
-std::array<float,2>{0.380442798f, 0.213022605f},
-std::array<float,2>{0.0343976505f, 0.925992787f},
-std::array<float,2>{0.869997561f, 0.474296421f},
-std::array<float,2>{0.685393512f, 0.870309055f},
-std::array<float,2>{0.466512442f, 0.343344897f},
-std::array<float,2>{0.109461658f, 0.591955841f},
-std::array<float,2>{0.753837585f, 0.00644275174f},
-std::array<float,2>{0.894301713f, 0.644821107f},
-std::array<float,2>{0.181393623f, 0.149990916f},
-std::array<float,2>{0.341073602f, 0.940827429f},
-std::array<float,2>{0.567349672f, 0.377959847f},
-std::array<float,2>{0.83891201f, 0.895171344f},
-std::array<float,2>{0.0309136715f, 0.445682019f},
-std::array<float,2>{0.420558244f, 0.7236678f},
-std::array<float,2>{0.717224956f, 0.233954236f},
-std::array<float,2>{0.518211246f, 0.535181582f},
-std::array<float,2>{0.270715684f, 0.103503473f},
-std::array<float,2>{0.227153093f, 0.812358558f},
-std::array<float,2>{0.980877399f, 0.25044623f},
-std::array<float,2>{0.57512486f, 0.814821243f},
-std::array<float,2>{0.333859712f, 0.374748081f},
-std::array<float,2>{0.175339699f, 0.612514377f},
-std::array<float,2>{0.898888826f, 0.0618971847f},
-std::array<float,2>{0.758426011f, 0.684458017f},
-std::array<float,2>{0.118847653f, 0.181352302f},
-std::array<float,2>{0.457395345f, 0.972466826f},
-std::array<float,2>{0.676730692f, 0.410044223f},
-std::array<float,2>{0.971918464f, 0.933481693f},
-std::array<float,2>{0.225533545f, 0.477352709f},
-std::array<float,2>{0.280163229f, 0.704750419f},
-std::array<float,2>{0.528669238f, 0.205837786f},
-std::array<float,2>{0.706685483f, 0.519949973f},
-std::array<float,2>{0.407842755f, 0.081864737f},
-std::array<float,2>{0.0188482441f, 0.778199255f},
-std::array<float,2>{0.834726572f, 0.29886198f},
-std::array<float,2>{0.637991786f, 0.946416318f},
-std::array<float,2>{0.489513189f, 0.384046316f},
-std::array<float,2>{0.0813190788f, 0.651185513f},
-std::array<float,2>{0.784116507f, 0.145097062f},
-std::array<float,2>{0.912003875f, 0.583056331f},
-std::array<float,2>{0.134073123f, 0.0144967111f},
-std::array<float,2>{0.361226231f, 0.861076176f},
-std::array<float,2>{0.59980309f, 0.33415395f},
-std::array<float,2>{0.865701556f, 0.800649047f},
-std::array<float,2>{0.0432427563f, 0.264519244f},
-std::array<float,2>{0.389117271f, 0.54317826f},
-std::array<float,2>{0.733098567f, 0.0950610563f},
-std::array<float,2>{0.533962548f, 0.732778013f},
-std::array<float,2>{0.301488668f, 0.223877922f},
-std::array<float,2>{0.218411267f, 0.899030507f},
-std::array<float,2>{0.949548244f, 0.442424655f},
-std::array<float,2>{0.514122665f, 0.884040773f},
-std::array<float,2>{0.262962788f, 0.458538324f},
-std::array<float,2>{0.247022361f, 0.737180591f},
-std::array<float,2>{0.986692131f, 0.243938431f},
-std::array<float,2>{0.817176282f, 0.550264955f},
-std::array<float,2>{0.00704645738f, 0.114557147f},
-std::array<float,2>{0.42363295f, 0.783264399f},
-std::array<float,2>{0.70037204f, 0.27710557f},
-std::array<float,2>{0.88383323f, 0.849335909f},
-std::array<float,2>{0.157273278f, 0.325540394f},
-std::array<float,2>{0.315493286f, 0.572658956f},
-std::array<float,2>{0.581789553f, 0.0161324721f},
-std::array<float,2>{0.664242506f, 0.627103567f},
-std::array<float,2>{0.444204718f, 0.127073467f},
-std::array<float,2>{0.0943689123f, 0.957020521f},
-std::array<float,2>{0.780014515f, 0.393460155f},
-std::array<float,2>{0.738865554f, 0.751621604f},
-std::array<float,2>{0.399276972f, 0.291241884f},
-std::array<float,2>{0.0495562665f, 0.505638421f},
-std::array<float,2>{0.857565105f, 0.0708282962f},
-std::array<float,2>{0.959154427f, 0.702272356f},
-std::array<float,2>{0.20059f, 0.202647433f},
-std::array<float,2>{0.288089246f, 0.912176669f},
-std::array<float,2>{0.556216717f, 0.494549662f},
-std::array<float,2>{0.799625695f, 0.996625185f},
-std::array<float,2>{0.0658329874f, 0.432001889f},
-std::array<float,2>{0.47227028f, 0.65898031f},
-std::array<float,2>{0.649676323f, 0.170500547f},
-std::array<float,2>{0.612290025f, 0.596164882f},
-std::array<float,2>{0.355856448f, 0.0449518412f},
-std::array<float,2>{0.153796256f, 0.828217268f},
-std::array<float,2>{0.925126135f, 0.348833501f},
-std::array<float,2>{0.587036252f, 0.802319109f},
-std::array<float,2>{0.327518582f, 0.259414434f},
-std::array<float,2>{0.164575398f, 0.542240262f},
-std::array<float,2>{0.882306337f, 0.099234283f},
-std::array<float,2>{0.767431617f, 0.728836f},
-std::array<float,2>{0.106642835f, 0.220562384f},
-std::array<float,2>{0.451976568f, 0.90261507f},
-std::array<float,2>{0.663864732f, 0.440760136f},
-std::array<float,2>{0.996716917f, 0.949250758f},
-std::array<float,2>{0.241124511f, 0.388706744f},
-std::array<float,2>{0.257205218f, 0.654034138f},
-std::array<float,2>{0.504830956f, 0.14434877f},
-std::array<float,2>{0.692673504f, 0.579938233f},
-std::array<float,2>{0.432616174f, 0.00889036618f},
-std::array<float,2>{0.0123309195f, 0.865519583f},
-std::array<float,2>{0.823140323f, 0.330304474f},
-std::array<float,2>{0.643349767f, 0.933933556f},
-std::array<float,2>{0.483799517f, 0.484340012f},
-std::array<float,2>{0.0715336353f, 0.709679246f},
-std::array<float,2>{0.808407247f, 0.208101556f},
-std::array<float,2>{0.930824876f, 0.518366456f},
-std::array<float,2>{0.143598229f, 0.0825955048f},
-std::array<float,2>{0.344874114f, 0.773823023f},
-std::array<float,2>{0.621026814f, 0.301434904f},
-std::array<float,2>{0.843928337f, 0.817846239f},
-std::array<float,2>{0.0585269667f, 0.370711654f},
-std::array<float,2>{0.393386066f, 0.613436162f},
-std::array<float,2>{0.742687285f, 0.0552843921f},
-std::array<float,2>{0.550148845f, 0.682395518f},
-std::array<float,2>{0.289296478f, 0.186345145f},
-std::array<float,2>{0.194701508f, 0.975865543f},
-std::array<float,2>{0.968425214f, 0.413564056f},
-std::array<float,2>{0.523106039f, 0.995876968f},
-std::array<float,2>{0.266526639f, 0.435857117f},
-std::array<float,2>{0.233502805f, 0.660624683f},
-std::array<float,2>{0.978441119f, 0.165012881f},
-std::array<float,2>{0.840599358f, 0.601335227f},
-std::array<float,2>{0.0266370978f, 0.0397572443f},
-std::array<float,2>{0.414576441f, 0.834842741f},
-std::array<float,2>{0.711535633f, 0.346493721f},
-std::array<float,2>{0.895125687f, 0.755850375f},
-std::array<float,2>{0.186949298f, 0.294767737f},
-std::array<float,2>{0.336727977f, 0.500337362f},
-std::array<float,2>{0.565497637f, 0.0763017759f},
-std::array<float,2>{0.683468878f, 0.698580027f},
-std::array<float,2>{0.463109553f, 0.195548922f},
-std::array<float,2>{0.113430426f, 0.907691896f},
-std::array<float,2>{0.75654906f, 0.499306917f},
-std::array<float,2>{0.722070694f, 0.844201624f},
-std::array<float,2>{0.375090152f, 0.320398808f},
-std::array<float,2>{0.0387364253f, 0.575090706f},
-std::array<float,2>{0.87285012f, 0.0229969639f},
-std::array<float,2>{0.939978719f, 0.631645441f},
-std::array<float,2>{0.208601728f, 0.130905062f},
-std::array<float,2>{0.310302556f, 0.960363746f},
-std::array<float,2>{0.54670918f, 0.395249307f},
-std::array<float,2>{0.790309548f, 0.886739492f},
-std::array<float,2>{0.085999459f, 0.454545677f},
-std::array<float,2>{0.496807843f, 0.738434553f},
-std::array<float,2>{0.629321218f, 0.248992726f},
-std::array<float,2>{0.602436066f, 0.551128745f},
-std::array<float,2>{0.372231364f, 0.112560987f},
-std::array<float,2>{0.127949491f, 0.788609982f},
-std::array<float,2>{0.918696046f, 0.281246454f},
-std::array<float,2>{0.536500812f, 0.842009366f},
-std::array<float,2>{0.297950596f, 0.353453487f},
-std::array<float,2>{0.213943869f, 0.609313726f},
-std::array<float,2>{0.948030472f, 0.0347664766f},
-std::array<float,2>{0.860226452f, 0.66850096f},
-std::array<float,2>{0.0413139537f, 0.158151597f},
-std::array<float,2>{0.385354668f, 0.991171241f},
-std::array<float,2>{0.728715956f, 0.427362591f},
-std::array<float,2>{0.906588018f, 0.920942843f},
-std::array<float,2>{0.137250856f, 0.490322977f},
-std::array<float,2>{0.367126584f, 0.693336964f},
-std::array<float,2>{0.597324312f, 0.192685485f},
-std::array<float,2>{0.635017633f, 0.514604032f},
-std::array<float,2>{0.487186939f, 0.0680168867f},
-std::array<float,2>{0.0827815756f, 0.763331056f},
-std::array<float,2>{0.785526693f, 0.288686007f},
-std::array<float,2>{0.707687855f, 0.96281445f},
-std::array<float,2>{0.411561847f, 0.402108103f},
-std::array<float,2>{0.0208723508f, 0.637836695f},
-std::array<float,2>{0.830047309f, 0.13636522f},
-std::array<float,2>{0.974848688f, 0.563314378f},
-std::array<float,2>{0.221954688f, 0.0235914271f},
-std::array<float,2>{0.274160951f, 0.857497752f},
-std::array<float,2>{0.526569724f, 0.319111735f},
-std::array<float,2>{0.764342904f, 0.789453864f},
-std::array<float,2>{0.1241493f, 0.272784501f},
-std::array<float,2>{0.455593944f, 0.560251474f},
-std::array<float,2>{0.673303962f, 0.122862652f},
-std::array<float,2>{0.572897673f, 0.745431006f},
-std::array<float,2>{0.331768572f, 0.240763873f},
-std::array<float,2>{0.176360562f, 0.876968861f},
-std::array<float,2>{0.902351379f, 0.461270571f},
-std::array<float,2>{0.614413857f, 0.894129932f},
-std::array<float,2>{0.355251253f, 0.449391186f},
-std::array<float,2>{0.151146516f, 0.719916642f},
-std::array<float,2>{0.929325759f, 0.229315758f},
-std::array<float,2>{0.801993608f, 0.53291434f},
-std::array<float,2>{0.0694287419f, 0.106349461f},
-std::array<float,2>{0.472685963f, 0.807083189f},
-std::array<float,2>{0.653649628f, 0.25474596f},
-std::array<float,2>{0.953689575f, 0.871609032f},
-std::array<float,2>{0.195691034f, 0.337962806f},
-std::array<float,2>{0.282263905f, 0.586786628f},
-std::array<float,2>{0.560063839f, 0.00126715878f},
-std::array<float,2>{0.737555385f, 0.643631637f},
-std::array<float,2>{0.403761834f, 0.156165466f},
-std::array<float,2>{0.0540678874f, 0.943492651f},
-std::array<float,2>{0.852451921f, 0.380571455f},
-std::array<float,2>{0.669169664f, 0.770425439f},
-std::array<float,2>{0.439856797f, 0.311921924f},
-std::array<float,2>{0.099226594f, 0.528329313f},
-std::array<float,2>{0.773874938f, 0.091789335f},
-std::array<float,2>{0.88739723f, 0.713901281f},
-std::array<float,2>{0.16196537f, 0.218598261f},
-std::array<float,2>{0.319591016f, 0.924466491f},
-std::array<float,2>{0.585812449f, 0.469432056f},
-std::array<float,2>{0.812883854f, 0.979453504f},
-std::array<float,2>{0.000890037743f, 0.416369766f},
-std::array<float,2>{0.42687279f, 0.672123671f},
-std::array<float,2>{0.698361337f, 0.17277804f},
-std::array<float,2>{0.508006334f, 0.62239331f},
-std::array<float,2>{0.259840369f, 0.0474108718f},
-std::array<float,2>{0.245347753f, 0.820602715f},
-std::array<float,2>{0.989896655f, 0.364212334f},
-std::array<float,2>{0.500202298f, 0.759432912f},
-std::array<float,2>{0.250074267f, 0.284650624f},
-std::array<float,2>{0.234644383f, 0.511684299f},
-std::array<float,2>{0.992461622f, 0.064856492f},
-std::array<float,2>{0.824890137f, 0.688019753f},
-std::array<float,2>{0.00867460016f, 0.189913183f},
-std::array<float,2>{0.43432653f, 0.915829778f},
-std::array<float,2>{0.688241243f, 0.486364961f},
-std::array<float,2>{0.877083838f, 0.986699998f},
-std::array<float,2>{0.168726012f, 0.423346698f},
-std::array<float,2>{0.320401639f, 0.667153358f},
-std::array<float,2>{0.590510726f, 0.163704455f},
-std::array<float,2>{0.658752143f, 0.602141619f},
-std::array<float,2>{0.446885437f, 0.0377240703f},
-std::array<float,2>{0.105094314f, 0.837673843f},
-std::array<float,2>{0.773147881f, 0.356719166f},
-std::array<float,2>{0.747311115f, 0.880820632f},
-std::array<float,2>{0.397805512f, 0.466283619f},
-std::array<float,2>{0.0606162399f, 0.747403085f},
-std::array<float,2>{0.848627627f, 0.236248553f},
-std::array<float,2>{0.961208224f, 0.554801404f},
-std::array<float,2>{0.189779133f, 0.119252309f},
-std::array<float,2>{0.29630664f, 0.793637693f},
-std::array<float,2>{0.554084182f, 0.265769273f},
-std::array<float,2>{0.81144017f, 0.852952898f},
-std::array<float,2>{0.0743064359f, 0.312682807f},
-std::array<float,2>{0.478966862f, 0.566935539f},
-std::array<float,2>{0.644996226f, 0.0284825582f},
-std::array<float,2>{0.624199629f, 0.633993804f},
-std::array<float,2>{0.351525068f, 0.137316793f},
-std::array<float,2>{0.147005945f, 0.965610445f},
-std::array<float,2>{0.936691403f, 0.403627336f},
-std::array<float,2>{0.569040298f, 0.937864959f},
-std::array<float,2>{0.342647672f, 0.376054615f},
-std::array<float,2>{0.182530135f, 0.647628307f},
-std::array<float,2>{0.891111672f, 0.151451543f},
-std::array<float,2>{0.750882447f, 0.590036511f},
-std::array<float,2>{0.112813346f, 0.00524930982f},
-std::array<float,2>{0.468522012f, 0.868241668f},
-std::array<float,2>{0.685547292f, 0.340937644f},
-std::array<float,2>{0.982560873f, 0.80880183f},
-std::array<float,2>{0.229660839f, 0.253712595f},
-std::array<float,2>{0.271749198f, 0.538456082f},
-std::array<float,2>{0.517117977f, 0.104468532f},
-std::array<float,2>{0.71617049f, 0.725926876f},
-std::array<float,2>{0.418596119f, 0.231143817f},
-std::array<float,2>{0.0278100949f, 0.898396611f},
-std::array<float,2>{0.836372614f, 0.448483944f},
-std::array<float,2>{0.628219187f, 0.825022638f},
-std::array<float,2>{0.49456346f, 0.361662745f},
-std::array<float,2>{0.0932279602f, 0.620739639f},
-std::array<float,2>{0.795707643f, 0.0543260016f},
-std::array<float,2>{0.915409327f, 0.677907646f},
-std::array<float,2>{0.132686302f, 0.179608539f},
-std::array<float,2>{0.368623257f, 0.981165171f},
-std::array<float,2>{0.607064784f, 0.41973272f},
-std::array<float,2>{0.868762016f, 0.92906338f},
-std::array<float,2>{0.0314071216f, 0.475160688f},
-std::array<float,2>{0.382478058f, 0.71562314f},
-std::array<float,2>{0.724055409f, 0.212727472f},
-std::array<float,2>{0.541745484f, 0.523980677f},
-std::array<float,2>{0.306780875f, 0.0889359862f},
-std::array<float,2>{0.205034494f, 0.765846789f},
-std::array<float,2>{0.944926262f, 0.305993795f},
-std::array<float,2>{0.598176539f, 0.861829102f},
-std::array<float,2>{0.362619609f, 0.333948433f},
-std::array<float,2>{0.134851784f, 0.584884107f},
-std::array<float,2>{0.912718832f, 0.0134610981f},
-std::array<float,2>{0.781324327f, 0.649625003f},
-std::array<float,2>{0.0795391947f, 0.146701857f},
-std::array<float,2>{0.491465122f, 0.948194623f},
-std::array<float,2>{0.640620887f, 0.386311829f},
-std::array<float,2>{0.951742768f, 0.901709676f},
-std::array<float,2>{0.215318277f, 0.445214391f},
-std::array<float,2>{0.303458303f, 0.732195735f},
-std::array<float,2>{0.531900942f, 0.22497277f},
-std::array<float,2>{0.731926501f, 0.546333969f},
-std::array<float,2>{0.387450784f, 0.095794104f},
-std::array<float,2>{0.0458904877f, 0.798220873f},
-std::array<float,2>{0.864819109f, 0.26205036f},
-std::array<float,2>{0.679236412f, 0.970170557f},
-std::array<float,2>{0.460818946f, 0.406663358f},
-std::array<float,2>{0.119312398f, 0.686413407f},
-std::array<float,2>{0.761204302f, 0.183230087f},
-std::array<float,2>{0.901911438f, 0.610529482f},
-std::array<float,2>{0.173540592f, 0.0597744696f},
-std::array<float,2>{0.335243225f, 0.812951148f},
-std::array<float,2>{0.577112734f, 0.372649282f},
-std::array<float,2>{0.83320123f, 0.780594826f},
-std::array<float,2>{0.0161319803f, 0.298033416f},
-std::array<float,2>{0.409304976f, 0.523159504f},
-std::array<float,2>{0.703884065f, 0.0783915445f},
-std::array<float,2>{0.53023833f, 0.706450403f},
-std::array<float,2>{0.279049873f, 0.203150332f},
-std::array<float,2>{0.223472282f, 0.931550682f},
-std::array<float,2>{0.96943742f, 0.479676098f},
-std::array<float,2>{0.557272196f, 0.910378039f},
-std::array<float,2>{0.285737634f, 0.49243623f},
-std::array<float,2>{0.202641234f, 0.699987113f},
-std::array<float,2>{0.958619058f, 0.199935675f},
-std::array<float,2>{0.85566771f, 0.506283283f},
-std::array<float,2>{0.0479677804f, 0.0724318251f},
-std::array<float,2>{0.401497126f, 0.753141403f},
-std::array<float,2>{0.741366982f, 0.290328413f},
-std::array<float,2>{0.922254205f, 0.830553114f},
-std::array<float,2>{0.154941559f, 0.350103736f},
-std::array<float,2>{0.35922116f, 0.594938159f},
-std::array<float,2>{0.609589934f, 0.0437010191f},
-std::array<float,2>{0.652121127f, 0.656904101f},
-std::array<float,2>{0.469344616f, 0.169136092f},
-std::array<float,2>{0.0633404702f, 0.998978674f},
-std::array<float,2>{0.798643172f, 0.430537015f},
-std::array<float,2>{0.701848149f, 0.782237589f},
-std::array<float,2>{0.4247666f, 0.275197536f},
-std::array<float,2>{0.00521062547f, 0.547805905f},
-std::array<float,2>{0.819982588f, 0.115678348f},
-std::array<float,2>{0.984823763f, 0.735714197f},
-std::array<float,2>{0.249196783f, 0.244950727f},
-std::array<float,2>{0.264622658f, 0.88616997f},
-std::array<float,2>{0.512967229f, 0.459145993f},
-std::array<float,2>{0.778973103f, 0.953614295f},
-std::array<float,2>{0.095743522f, 0.39169699f},
-std::array<float,2>{0.441653997f, 0.626497626f},
-std::array<float,2>{0.667892575f, 0.126109809f},
-std::array<float,2>{0.578175128f, 0.571375489f},
-std::array<float,2>{0.314407855f, 0.0189023912f},
-std::array<float,2>{0.15973711f, 0.850723565f},
-std::array<float,2>{0.88656044f, 0.326305151f},
-std::array<float,2>{0.603580177f, 0.787125945f},
-std::array<float,2>{0.374586731f, 0.279672235f},
-std::array<float,2>{0.1258782f, 0.552531362f},
-std::array<float,2>{0.921517968f, 0.111568108f},
-std::array<float,2>{0.79150939f, 0.739695609f},
-std::array<float,2>{0.088240318f, 0.24932465f},
-std::array<float,2>{0.498340845f, 0.887954652f},
-std::array<float,2>{0.632475972f, 0.453734905f},
-std::array<float,2>{0.938950539f, 0.959123194f},
-std::array<float,2>{0.210378319f, 0.395664394f},
-std::array<float,2>{0.312022597f, 0.631847858f},
-std::array<float,2>{0.543632627f, 0.131910622f},
-std::array<float,2>{0.719551265f, 0.575589478f},
-std::array<float,2>{0.378456146f, 0.0221058093f},
-std::array<float,2>{0.0354347043f, 0.84515959f},
-std::array<float,2>{0.874981701f, 0.321565419f},
-std::array<float,2>{0.680958807f, 0.90715462f},
-std::array<float,2>{0.462421626f, 0.498802245f},
-std::array<float,2>{0.116479144f, 0.697324753f},
-std::array<float,2>{0.75532639f, 0.196929783f},
-std::array<float,2>{0.89663136f, 0.501358747f},
-std::array<float,2>{0.184165075f, 0.0776766911f},
-std::array<float,2>{0.339703619f, 0.753916681f},
-std::array<float,2>{0.562885463f, 0.293432295f},
-std::array<float,2>{0.84315151f, 0.835741758f},
-std::array<float,2>{0.0244201068f, 0.347530454f},
-std::array<float,2>{0.416683972f, 0.600511432f},
-std::array<float,2>{0.714353442f, 0.0406765267f},
-std::array<float,2>{0.519645631f, 0.661326885f},
-std::array<float,2>{0.269017696f, 0.16534707f},
-std::array<float,2>{0.230551496f, 0.994804442f},
-std::array<float,2>{0.979062676f, 0.436532795f},
-std::array<float,2>{0.547915101f, 0.975418687f},
-std::array<float,2>{0.292637795f, 0.412133783f},
-std::array<float,2>{0.192750007f, 0.68289572f},
-std::array<float,2>{0.966611803f, 0.186922491f},
-std::array<float,2>{0.847433746f, 0.615184069f},
-std::array<float,2>{0.0557620265f, 0.0560237393f},
-std::array<float,2>{0.390837908f, 0.816895545f},
-std::array<float,2>{0.744483948f, 0.369812429f},
-std::array<float,2>{0.931687593f, 0.774901271f},
-std::array<float,2>{0.14192611f, 0.30193454f},
-std::array<float,2>{0.345872253f, 0.519171357f},
-std::array<float,2>{0.618325293f, 0.0838558227f},
-std::array<float,2>{0.642154098f, 0.710181236f},
-std::array<float,2>{0.481780708f, 0.207815424f},
-std::array<float,2>{0.0738013908f, 0.93512094f},
-std::array<float,2>{0.804817498f, 0.482685149f},
-std::array<float,2>{0.693764865f, 0.866472065f},
-std::array<float,2>{0.431452811f, 0.331099331f},
-std::array<float,2>{0.0142348409f, 0.578262627f},
-std::array<float,2>{0.821024656f, 0.00820340123f},
-std::array<float,2>{0.999056876f, 0.653046608f},
-std::array<float,2>{0.239516288f, 0.143352836f},
-std::array<float,2>{0.255556554f, 0.95028168f},
-std::array<float,2>{0.50714767f, 0.38967514f},
-std::array<float,2>{0.769191861f, 0.904155731f},
-std::array<float,2>{0.108409971f, 0.440246284f},
-std::array<float,2>{0.449954063f, 0.730333209f},
-std::array<float,2>{0.661549926f, 0.219450578f},
-std::array<float,2>{0.587965071f, 0.54136169f},
-std::array<float,2>{0.324699938f, 0.0977728516f},
-std::array<float,2>{0.166993275f, 0.800812542f},
-std::array<float,2>{0.879026234f, 0.258773118f},
-std::array<float,2>{0.510800362f, 0.821390867f},
-std::array<float,2>{0.257990241f, 0.365013152f},
-std::array<float,2>{0.243942559f, 0.621793985f},
-std::array<float,2>{0.990858912f, 0.0484620407f},
-std::array<float,2>{0.815811157f, 0.672969699f},
-std::array<float,2>{0.00363762304f, 0.173289403f},
-std::array<float,2>{0.42968154f, 0.980084479f},
-std::array<float,2>{0.696891367f, 0.417396456f},
-std::array<float,2>{0.890464604f, 0.925731301f},
-std::array<float,2>{0.16392751f, 0.47066465f},
-std::array<float,2>{0.316505998f, 0.713425577f},
-std::array<float,2>{0.583694458f, 0.21772252f},
-std::array<float,2>{0.670522809f, 0.527627766f},
-std::array<float,2>{0.43841365f, 0.0899081156f},
-std::array<float,2>{0.100483313f, 0.770591974f},
-std::array<float,2>{0.776823878f, 0.31143719f},
-std::array<float,2>{0.736232936f, 0.945206583f},
-std::array<float,2>{0.405771047f, 0.379763275f},
-std::array<float,2>{0.0518610105f, 0.642679214f},
-std::array<float,2>{0.853781104f, 0.154432684f},
-std::array<float,2>{0.95691216f, 0.587806165f},
-std::array<float,2>{0.198968187f, 0.00097270438f},
-std::array<float,2>{0.284299195f, 0.872794986f},
-std::array<float,2>{0.561034739f, 0.339541078f},
-std::array<float,2>{0.803055346f, 0.808128834f},
-std::array<float,2>{0.0679804757f, 0.255513549f},
-std::array<float,2>{0.474970281f, 0.532038212f},
-std::array<float,2>{0.655032933f, 0.106881961f},
-std::array<float,2>{0.616903782f, 0.719027519f},
-std::array<float,2>{0.35294944f, 0.23038125f},
-std::array<float,2>{0.149081334f, 0.892930686f},
-std::array<float,2>{0.926478446f, 0.450558662f},
-std::array<float,2>{0.570479393f, 0.878185868f},
-std::array<float,2>{0.328515708f, 0.462313026f},
-std::array<float,2>{0.178136215f, 0.744197309f},
-std::array<float,2>{0.905587554f, 0.241988033f},
-std::array<float,2>{0.762516558f, 0.559320569f},
-std::array<float,2>{0.122509852f, 0.121813551f},
-std::array<float,2>{0.453274578f, 0.790630937f},
-std::array<float,2>{0.67485702f, 0.272097826f},
-std::array<float,2>{0.973826408f, 0.858460605f},
-std::array<float,2>{0.220688641f, 0.32014519f},
-std::array<float,2>{0.277029395f, 0.564396083f},
-std::array<float,2>{0.524093866f, 0.0251085311f},
-std::array<float,2>{0.709118009f, 0.63681978f},
-std::array<float,2>{0.413506955f, 0.134926513f},
-std::array<float,2>{0.0219685137f, 0.96145153f},
-std::array<float,2>{0.831840038f, 0.400859743f},
-std::array<float,2>{0.633474708f, 0.762173891f},
-std::array<float,2>{0.48498854f, 0.287772566f},
-std::array<float,2>{0.0845004097f, 0.514952004f},
-std::array<float,2>{0.788271844f, 0.0664602742f},
-std::array<float,2>{0.909261465f, 0.69184649f},
-std::array<float,2>{0.140027508f, 0.192291781f},
-std::array<float,2>{0.363710999f, 0.920794308f},
-std::array<float,2>{0.594201148f, 0.491960585f},
-std::array<float,2>{0.862228334f, 0.992050171f},
-std::array<float,2>{0.0408127382f, 0.426019847f},
-std::array<float,2>{0.383941799f, 0.669700205f},
-std::array<float,2>{0.727675557f, 0.156469926f},
-std::array<float,2>{0.538795948f, 0.608042121f},
-std::array<float,2>{0.300376177f, 0.0334569663f},
-std::array<float,2>{0.211507112f, 0.843674898f},
-std::array<float,2>{0.94656992f, 0.35175094f},
-std::array<float,2>{0.540765107f, 0.767130554f},
-std::array<float,2>{0.305582613f, 0.304755628f},
-std::array<float,2>{0.205253303f, 0.525287807f},
-std::array<float,2>{0.941806495f, 0.0883581787f},
-std::array<float,2>{0.871054113f, 0.716374397f},
-std::array<float,2>{0.0341746733f, 0.211801246f},
-std::array<float,2>{0.379507035f, 0.928291082f},
-std::array<float,2>{0.726067185f, 0.475861073f},
-std::array<float,2>{0.917822778f, 0.982034624f},
-std::array<float,2>{0.12944892f, 0.418343753f},
-std::array<float,2>{0.369278729f, 0.679075718f},
-std::array<float,2>{0.607654929f, 0.177788243f},
-std::array<float,2>{0.625304103f, 0.619645178f},
-std::array<float,2>{0.493226856f, 0.0535377972f},
-std::array<float,2>{0.0913178846f, 0.825410068f},
-std::array<float,2>{0.794372082f, 0.362413317f},
-std::array<float,2>{0.717806339f, 0.896994948f},
-std::array<float,2>{0.421434224f, 0.447589397f},
-std::array<float,2>{0.0295308083f, 0.72466749f},
-std::array<float,2>{0.837931037f, 0.232361391f},
-std::array<float,2>{0.982304633f, 0.537870109f},
-std::array<float,2>{0.228412822f, 0.104724534f},
-std::array<float,2>{0.270363033f, 0.810182929f},
-std::array<float,2>{0.51901716f, 0.252570748f},
-std::array<float,2>{0.752727568f, 0.86789006f},
-std::array<float,2>{0.111109041f, 0.340139568f},
-std::array<float,2>{0.465076745f, 0.591089368f},
-std::array<float,2>{0.683749735f, 0.0042534587f},
-std::array<float,2>{0.56766957f, 0.647382617f},
-std::array<float,2>{0.340158761f, 0.151019067f},
-std::array<float,2>{0.179934129f, 0.938525677f},
-std::array<float,2>{0.892817676f, 0.375090182f},
-std::array<float,2>{0.621201038f, 0.966491282f},
-std::array<float,2>{0.348973811f, 0.4029046f},
-std::array<float,2>{0.145042613f, 0.63376379f},
-std::array<float,2>{0.935007274f, 0.137871563f},
-std::array<float,2>{0.808707714f, 0.568177819f},
-std::array<float,2>{0.0768491998f, 0.0282692928f},
-std::array<float,2>{0.477144331f, 0.852442384f},
-std::array<float,2>{0.646494865f, 0.313924968f},
-std::array<float,2>{0.963713765f, 0.794271886f},
-std::array<float,2>{0.188478187f, 0.267110109f},
-std::array<float,2>{0.294286579f, 0.555692673f},
-std::array<float,2>{0.550980628f, 0.120324701f},
-std::array<float,2>{0.74815619f, 0.746753335f},
-std::array<float,2>{0.395778805f, 0.234645247f},
-std::array<float,2>{0.0593362115f, 0.879406631f},
-std::array<float,2>{0.85144794f, 0.465156585f},
-std::array<float,2>{0.657078862f, 0.836835146f},
-std::array<float,2>{0.447352946f, 0.355996102f},
-std::array<float,2>{0.103474312f, 0.603430271f},
-std::array<float,2>{0.771186948f, 0.0380906463f},
-std::array<float,2>{0.876781702f, 0.666733027f},
-std::array<float,2>{0.170352682f, 0.162940785f},
-std::array<float,2>{0.324049979f, 0.987851858f},
-std::array<float,2>{0.591933906f, 0.422405779f},
-std::array<float,2>{0.828023434f, 0.914437652f},
-std::array<float,2>{0.0104524605f, 0.488080889f},
-std::array<float,2>{0.436624765f, 0.688693881f},
-std::array<float,2>{0.690372944f, 0.191292703f},
-std::array<float,2>{0.502333879f, 0.510626256f},
-std::array<float,2>{0.252394617f, 0.0654887855f},
-std::array<float,2>{0.236979738f, 0.758347273f},
-std::array<float,2>{0.994887769f, 0.284016043f},
-std::array<float,2>{0.580574036f, 0.850266635f},
-std::array<float,2>{0.315193295f, 0.327906668f},
-std::array<float,2>{0.156893879f, 0.571151316f},
-std::array<float,2>{0.882866263f, 0.0176321864f},
-std::array<float,2>{0.78098768f, 0.625019908f},
-std::array<float,2>{0.0955019593f, 0.125931352f},
-std::array<float,2>{0.445264131f, 0.954419374f},
-std::array<float,2>{0.665483475f, 0.391213685f},
-std::array<float,2>{0.987622321f, 0.885443509f},
-std::array<float,2>{0.247525856f, 0.460550576f},
-std::array<float,2>{0.262204558f, 0.734495401f},
-std::array<float,2>{0.515054822f, 0.245129839f},
-std::array<float,2>{0.700092494f, 0.548136234f},
-std::array<float,2>{0.422467291f, 0.117175587f},
-std::array<float,2>{0.00617157575f, 0.782191157f},
-std::array<float,2>{0.817823172f, 0.273587704f},
-std::array<float,2>{0.648800969f, 0.999306262f},
-std::array<float,2>{0.470912308f, 0.431387246f},
-std::array<float,2>{0.0649220571f, 0.657324314f},
-std::array<float,2>{0.799955308f, 0.168921605f},
-std::array<float,2>{0.924503505f, 0.593792498f},
-std::array<float,2>{0.152512476f, 0.0446799435f},
-std::array<float,2>{0.356825799f, 0.831758738f},
-std::array<float,2>{0.612671554f, 0.350755036f},
-std::array<float,2>{0.85871917f, 0.752744496f},
-std::array<float,2>{0.049882371f, 0.289070904f},
-std::array<float,2>{0.399744719f, 0.507147431f},
-std::array<float,2>{0.73995471f, 0.0741976053f},
-std::array<float,2>{0.555265784f, 0.701063693f},
-std::array<float,2>{0.287422419f, 0.200508326f},
-std::array<float,2>{0.19961971f, 0.911337912f},
-std::array<float,2>{0.960748672f, 0.4935489f},
-std::array<float,2>{0.528120339f, 0.930096924f},
-std::array<float,2>{0.280515343f, 0.47881031f},
-std::array<float,2>{0.226405665f, 0.705619156f},
-std::array<float,2>{0.971409559f, 0.204912186f},
-std::array<float,2>{0.835341692f, 0.521947265f},
-std::array<float,2>{0.0178950764f, 0.0793756768f},
-std::array<float,2>{0.406571805f, 0.779746115f},
-std::array<float,2>{0.705129027f, 0.297707945f},
-std::array<float,2>{0.900021851f, 0.814323068f},
-std::array<float,2>{0.174417451f, 0.371944517f},
-std::array<float,2>{0.332646161f, 0.609583735f},
-std::array<float,2>{0.575490713f, 0.0595447868f},
-std::array<float,2>{0.677207172f, 0.686953008f},
-std::array<float,2>{0.458856046f, 0.182559058f},
-std::array<float,2>{0.117666423f, 0.968874037f},
-std::array<float,2>{0.758862257f, 0.407230645f},
-std::array<float,2>{0.734130323f, 0.797245264f},
-std::array<float,2>{0.390437871f, 0.263537049f},
-std::array<float,2>{0.0440568142f, 0.545177042f},
-std::array<float,2>{0.867081523f, 0.0971188694f},
-std::array<float,2>{0.950283587f, 0.73134321f},
-std::array<float,2>{0.217596292f, 0.225789085f},
-std::array<float,2>{0.302467972f, 0.901026666f},
-std::array<float,2>{0.534985602f, 0.444047391f},
-std::array<float,2>{0.784754455f, 0.949069083f},
-std::array<float,2>{0.0802698508f, 0.385172963f},
-std::array<float,2>{0.489145637f, 0.648822069f},
-std::array<float,2>{0.637355924f, 0.147573709f},
-std::array<float,2>{0.600844502f, 0.585471094f},
-std::array<float,2>{0.359935224f, 0.0121663865f},
-std::array<float,2>{0.133237898f, 0.862571001f},
-std::array<float,2>{0.910306931f, 0.332947671f},
-std::array<float,2>{0.565164566f, 0.757421374f},
-std::array<float,2>{0.337249666f, 0.296528667f},
-std::array<float,2>{0.18583332f, 0.503788948f},
-std::array<float,2>{0.896393836f, 0.0747648999f},
-std::array<float,2>{0.757010996f, 0.697174251f},
-std::array<float,2>{0.114695147f, 0.199142516f},
-std::array<float,2>{0.464809507f, 0.909560621f},
-std::array<float,2>{0.681835592f, 0.49767819f},
-std::array<float,2>{0.976898611f, 0.993957222f},
-std::array<float,2>{0.233139917f, 0.434731364f},
-std::array<float,2>{0.267469347f, 0.662786424f},
-std::array<float,2>{0.521540999f, 0.166949123f},
-std::array<float,2>{0.712574303f, 0.597768903f},
-std::array<float,2>{0.415905446f, 0.0417238399f},
-std::array<float,2>{0.0260989107f, 0.832198739f},
-std::array<float,2>{0.84108758f, 0.345207006f},
-std::array<float,2>{0.630688548f, 0.8887465f},
-std::array<float,2>{0.497602075f, 0.456664205f},
-std::array<float,2>{0.0875633284f, 0.740326881f},
-std::array<float,2>{0.789814889f, 0.246163025f},
-std::array<float,2>{0.919786632f, 0.553548098f},
-std::array<float,2>{0.127258644f, 0.109896034f},
-std::array<float,2>{0.371892482f, 0.786504507f},
-std::array<float,2>{0.602711856f, 0.277968615f},
-std::array<float,2>{0.871161163f, 0.847469807f},
-std::array<float,2>{0.0378997549f, 0.324152917f},
-std::array<float,2>{0.376002818f, 0.577171504f},
-std::array<float,2>{0.720718205f, 0.0201437958f},
-std::array<float,2>{0.545775294f, 0.630208611f},
-std::array<float,2>{0.309031785f, 0.130064949f},
-std::array<float,2>{0.207634971f, 0.957698584f},
-std::array<float,2>{0.941250026f, 0.39656496f},
-std::array<float,2>{0.505012929f, 0.952012002f},
-std::array<float,2>{0.256208032f, 0.387139142f},
-std::array<float,2>{0.241791278f, 0.654918969f},
-std::array<float,2>{0.997688949f, 0.142554224f},
-std::array<float,2>{0.824021637f, 0.58049947f},
-std::array<float,2>{0.0133851031f, 0.0103603499f},
-std::array<float,2>{0.432841033f, 0.864309728f},
-std::array<float,2>{0.691558897f, 0.328443199f},
-std::array<float,2>{0.881235301f, 0.803569257f},
-std::array<float,2>{0.165651381f, 0.260376602f},
-std::array<float,2>{0.326710522f, 0.540687501f},
-std::array<float,2>{0.586113036f, 0.101281285f},
-std::array<float,2>{0.662148535f, 0.727571905f},
-std::array<float,2>{0.453026325f, 0.221145689f},
-std::array<float,2>{0.105742581f, 0.905216098f},
-std::array<float,2>{0.766066253f, 0.438584089f},
-std::array<float,2>{0.743798673f, 0.819920778f},
-std::array<float,2>{0.394271791f, 0.367336065f},
-std::array<float,2>{0.05715397f, 0.615696788f},
-std::array<float,2>{0.844759107f, 0.0569525175f},
-std::array<float,2>{0.967061639f, 0.679971337f},
-std::array<float,2>{0.193570867f, 0.18379423f},
-std::array<float,2>{0.290898263f, 0.97291559f},
-std::array<float,2>{0.549331784f, 0.410532862f},
-std::array<float,2>{0.807598531f, 0.936479449f},
-std::array<float,2>{0.071119979f, 0.482096165f},
-std::array<float,2>{0.482984155f, 0.707804024f},
-std::array<float,2>{0.644361138f, 0.210749775f},
-std::array<float,2>{0.61994487f, 0.517167091f},
-std::array<float,2>{0.343943566f, 0.0840796903f},
-std::array<float,2>{0.142640457f, 0.775872111f},
-std::array<float,2>{0.929870367f, 0.303215235f},
-std::array<float,2>{0.559220493f, 0.874625981f},
-std::array<float,2>{0.281647116f, 0.337726831f},
-std::array<float,2>{0.197202757f, 0.588741004f},
-std::array<float,2>{0.954285324f, 0.0021046889f},
-std::array<float,2>{0.853357673f, 0.641491771f},
-std::array<float,2>{0.0535813943f, 0.153386101f},
-std::array<float,2>{0.402871132f, 0.941731691f},
-std::array<float,2>{0.736608684f, 0.382797062f},
-std::array<float,2>{0.927957654f, 0.891125917f},
-std::array<float,2>{0.151613623f, 0.451650828f},
-std::array<float,2>{0.35394454f, 0.722326458f},
-std::array<float,2>{0.614177287f, 0.226864725f},
-std::array<float,2>{0.653128982f, 0.533918798f},
-std::array<float,2>{0.474005073f, 0.107944563f},
-std::array<float,2>{0.0685467198f, 0.806604862f},
-std::array<float,2>{0.800899029f, 0.256769747f},
-std::array<float,2>{0.697568059f, 0.977123857f},
-std::array<float,2>{0.425802767f, 0.414247215f},
-std::array<float,2>{0.00128382852f, 0.674052596f},
-std::array<float,2>{0.814305902f, 0.175553173f},
-std::array<float,2>{0.988889337f, 0.62432605f},
-std::array<float,2>{0.24511072f, 0.0495480709f},
-std::array<float,2>{0.261478037f, 0.824079454f},
-std::array<float,2>{0.508893847f, 0.366693497f},
-std::array<float,2>{0.7753672f, 0.77151078f},
-std::array<float,2>{0.0978603885f, 0.30998525f},
-std::array<float,2>{0.44096902f, 0.530707479f},
-std::array<float,2>{0.668774188f, 0.0929550231f},
-std::array<float,2>{0.584554493f, 0.711323261f},
-std::array<float,2>{0.318487048f, 0.215156436f},
-std::array<float,2>{0.160470605f, 0.922174811f},
-std::array<float,2>{0.888133943f, 0.471257895f},
-std::array<float,2>{0.595797181f, 0.918292761f},
-std::array<float,2>{0.365930438f, 0.488922715f},
-std::array<float,2>{0.138005763f, 0.693400383f},
-std::array<float,2>{0.907465518f, 0.194179714f},
-std::array<float,2>{0.786211252f, 0.513408601f},
-std::array<float,2>{0.0832417905f, 0.0701114908f},
-std::array<float,2>{0.488136649f, 0.764656246f},
-std::array<float,2>{0.636333346f, 0.287042618f},
-std::array<float,2>{0.948509753f, 0.84024626f},
-std::array<float,2>{0.213014394f, 0.354513258f},
-std::array<float,2>{0.297521949f, 0.606987774f},
-std::array<float,2>{0.535236359f, 0.0326176994f},
-std::array<float,2>{0.729913294f, 0.671398044f},
-std::array<float,2>{0.386617959f, 0.158489197f},
-std::array<float,2>{0.0424268506f, 0.98912102f},
-std::array<float,2>{0.860948801f, 0.429018199f},
-std::array<float,2>{0.672372878f, 0.792818546f},
-std::array<float,2>{0.456156701f, 0.271476507f},
-std::array<float,2>{0.123784207f, 0.56170994f},
-std::array<float,2>{0.765172184f, 0.123425715f},
-std::array<float,2>{0.904172003f, 0.742974997f},
-std::array<float,2>{0.177448794f, 0.239582509f},
-std::array<float,2>{0.330508649f, 0.876829803f},
-std::array<float,2>{0.574192047f, 0.463606179f},
-std::array<float,2>{0.828151047f, 0.964566052f},
-std::array<float,2>{0.0200231001f, 0.399954647f},
-std::array<float,2>{0.410723358f, 0.639830112f},
-std::array<float,2>{0.708741426f, 0.133143857f},
-std::array<float,2>{0.52585268f, 0.565612197f},
-std::array<float,2>{0.275258303f, 0.0271326769f},
-std::array<float,2>{0.220934376f, 0.856892228f},
-std::array<float,2>{0.976156414f, 0.317398846f},
-std::array<float,2>{0.515772998f, 0.811373889f},
-std::array<float,2>{0.273297727f, 0.251460075f},
-std::array<float,2>{0.22857362f, 0.536191046f},
-std::array<float,2>{0.983589172f, 0.102072954f},
-std::array<float,2>{0.837593973f, 0.722827911f},
-std::array<float,2>{0.0285216328f, 0.233022228f},
-std::array<float,2>{0.419530928f, 0.896179259f},
-std::array<float,2>{0.71564424f, 0.446425676f},
-std::array<float,2>{0.892201424f, 0.940139651f},
-std::array<float,2>{0.183422878f, 0.377071589f},
-std::array<float,2>{0.343679041f, 0.646047652f},
-std::array<float,2>{0.569609106f, 0.149020731f},
-std::array<float,2>{0.687036216f, 0.593041658f},
-std::array<float,2>{0.467330009f, 0.00722211925f},
-std::array<float,2>{0.111712918f, 0.869470477f},
-std::array<float,2>{0.751430154f, 0.342701167f},
-std::array<float,2>{0.723446727f, 0.92691952f},
-std::array<float,2>{0.381465375f, 0.473364502f},
-std::array<float,2>{0.0324293151f, 0.71700877f},
-std::array<float,2>{0.86812979f, 0.21456553f},
-std::array<float,2>{0.94348067f, 0.527088702f},
-std::array<float,2>{0.204015955f, 0.0873485059f},
-std::array<float,2>{0.308133662f, 0.768549263f},
-std::array<float,2>{0.542014837f, 0.307581961f},
-std::array<float,2>{0.795935571f, 0.826608956f},
-std::array<float,2>{0.0924991369f, 0.360081196f},
-std::array<float,2>{0.495479822f, 0.618993402f},
-std::array<float,2>{0.627301693f, 0.0527136512f},
-std::array<float,2>{0.606396079f, 0.677273929f},
-std::array<float,2>{0.367213607f, 0.176402032f},
-std::array<float,2>{0.131080538f, 0.983830631f},
-std::array<float,2>{0.914088309f, 0.42155841f},
-std::array<float,2>{0.591466069f, 0.98597157f},
-std::array<float,2>{0.321812063f, 0.424096316f},
-std::array<float,2>{0.169249132f, 0.664556026f},
-std::array<float,2>{0.877939641f, 0.161416635f},
-std::array<float,2>{0.771986663f, 0.603573263f},
-std::array<float,2>{0.103796363f, 0.0365677811f},
-std::array<float,2>{0.446070045f, 0.83818984f},
-std::array<float,2>{0.660075724f, 0.357680321f},
-std::array<float,2>{0.993585169f, 0.760472834f},
-std::array<float,2>{0.23623082f, 0.281430304f},
-std::array<float,2>{0.251472831f, 0.509604514f},
-std::array<float,2>{0.501632512f, 0.0626994967f},
-std::array<float,2>{0.688818276f, 0.689782202f},
-std::array<float,2>{0.434977353f, 0.189035043f},
-std::array<float,2>{0.009451285f, 0.916872084f},
-std::array<float,2>{0.825326204f, 0.485492617f},
-std::array<float,2>{0.6455158f, 0.855408907f},
-std::array<float,2>{0.480399162f, 0.315676183f},
-std::array<float,2>{0.0755854845f, 0.568588972f},
-std::array<float,2>{0.812043965f, 0.0311656632f},
-std::array<float,2>{0.935956359f, 0.635371506f},
-std::array<float,2>{0.147557899f, 0.139491022f},
-std::array<float,2>{0.350548595f, 0.967194557f},
-std::array<float,2>{0.62371552f, 0.405227751f},
-std::array<float,2>{0.849179506f, 0.881286502f},
-std::array<float,2>{0.0616100505f, 0.467524439f},
-std::array<float,2>{0.396607369f, 0.749855757f},
-std::array<float,2>{0.746628284f, 0.236698508f},
-std::array<float,2>{0.552764773f, 0.557510972f},
-std::array<float,2>{0.295175493f, 0.117532164f},
-std::array<float,2>{0.190999702f, 0.795242667f},
-std::array<float,2>{0.962696552f, 0.267795682f},
-std::array<float,2>{0.610556364f, 0.829862535f},
-std::array<float,2>{0.357991755f, 0.348372459f},
-std::array<float,2>{0.155826837f, 0.596888423f},
-std::array<float,2>{0.923163354f, 0.046060577f},
-std::array<float,2>{0.797596693f, 0.659623146f},
-std::array<float,2>{0.0638861954f, 0.171729326f},
-std::array<float,2>{0.469773471f, 0.997267127f},
-std::array<float,2>{0.650927722f, 0.43269223f},
-std::array<float,2>{0.957896233f, 0.913853168f},
-std::array<float,2>{0.201861605f, 0.495518774f},
-std::array<float,2>{0.286325812f, 0.701212108f},
-std::array<float,2>{0.557985544f, 0.201611638f},
-std::array<float,2>{0.741131842f, 0.503937721f},
-std::array<float,2>{0.400707155f, 0.0718100891f},
-std::array<float,2>{0.0469160154f, 0.750048101f},
-std::array<float,2>{0.857007504f, 0.292223632f},
-std::array<float,2>{0.666171432f, 0.955641448f},
-std::array<float,2>{0.442860544f, 0.393583804f},
-std::array<float,2>{0.0970681533f, 0.628418207f},
-std::array<float,2>{0.778182805f, 0.12872003f},
-std::array<float,2>{0.88574034f, 0.57392621f},
-std::array<float,2>{0.158585176f, 0.0166933127f},
-std::array<float,2>{0.313337535f, 0.848362863f},
-std::array<float,2>{0.579907477f, 0.324557394f},
-std::array<float,2>{0.818672657f, 0.784408808f},
-std::array<float,2>{0.00471249083f, 0.275442392f},
-std::array<float,2>{0.42512539f, 0.549044847f},
-std::array<float,2>{0.70287627f, 0.113341741f},
-std::array<float,2>{0.512639046f, 0.737786889f},
-std::array<float,2>{0.265392452f, 0.242956579f},
-std::array<float,2>{0.24886705f, 0.8833763f},
-std::array<float,2>{0.98582828f, 0.457784057f},
-std::array<float,2>{0.532612681f, 0.900304914f},
-std::array<float,2>{0.304379791f, 0.442143619f},
-std::array<float,2>{0.216242924f, 0.734208763f},
-std::array<float,2>{0.952638447f, 0.222871765f},
-std::array<float,2>{0.863871157f, 0.544650018f},
-std::array<float,2>{0.0462999046f, 0.0945155546f},
-std::array<float,2>{0.388286114f, 0.798856735f},
-std::array<float,2>{0.731277883f, 0.264841557f},
-std::array<float,2>{0.913571179f, 0.860061288f},
-std::array<float,2>{0.136177778f, 0.335710406f},
-std::array<float,2>{0.361772686f, 0.582433462f},
-std::array<float,2>{0.599236786f, 0.0155376447f},
-std::array<float,2>{0.639299273f, 0.651460171f},
-std::array<float,2>{0.490331411f, 0.146041632f},
-std::array<float,2>{0.0784945413f, 0.946212828f},
-std::array<float,2>{0.782659352f, 0.382939488f},
-std::array<float,2>{0.704748333f, 0.778689027f},
-std::array<float,2>{0.409069717f, 0.300493121f},
-std::array<float,2>{0.0175164733f, 0.520864666f},
-std::array<float,2>{0.832301259f, 0.0806893632f},
-std::array<float,2>{0.969896078f, 0.704014778f},
-std::array<float,2>{0.224343032f, 0.206601724f},
-std::array<float,2>{0.278019518f, 0.932324469f},
-std::array<float,2>{0.530529618f, 0.478179485f},
-std::array<float,2>{0.760157704f, 0.971171737f},
-std::array<float,2>{0.120293267f, 0.408848643f},
-std::array<float,2>{0.459575802f, 0.684778929f},
-std::array<float,2>{0.678696275f, 0.179918453f},
-std::array<float,2>{0.577468395f, 0.611423552f},
-std::array<float,2>{0.334477037f, 0.0607405528f},
-std::array<float,2>{0.172800615f, 0.815791965f},
-std::array<float,2>{0.901230097f, 0.373756409f},
-std::array<float,2>{0.594470143f, 0.765624344f},
-std::array<float,2>{0.363909692f, 0.28618136f},
-std::array<float,2>{0.140535235f, 0.513101161f},
-std::array<float,2>{0.910104215f, 0.0696498081f},
-std::array<float,2>{0.788944662f, 0.693911731f},
-std::array<float,2>{0.0840781629f, 0.193684623f},
-std::array<float,2>{0.484829307f, 0.918708801f},
-std::array<float,2>{0.633026123f, 0.488282681f},
-std::array<float,2>{0.946967781f, 0.98829931f},
-std::array<float,2>{0.211242631f, 0.429662883f},
-std::array<float,2>{0.299891829f, 0.670985281f},
-std::array<float,2>{0.538090765f, 0.159175172f},
-std::array<float,2>{0.728153884f, 0.606908917f},
-std::array<float,2>{0.384413749f, 0.0329473577f},
-std::array<float,2>{0.0401891097f, 0.840587795f},
-std::array<float,2>{0.861620188f, 0.355246097f},
-std::array<float,2>{0.675303817f, 0.876310885f},
-std::array<float,2>{0.453790903f, 0.463092893f},
-std::array<float,2>{0.122805662f, 0.742597759f},
-std::array<float,2>{0.762033641f, 0.239796966f},
-std::array<float,2>{0.905994773f, 0.562301338f},
-std::array<float,2>{0.178527161f, 0.123675011f},
-std::array<float,2>{0.328700155f, 0.792195857f},
-std::array<float,2>{0.571156621f, 0.27063489f},
-std::array<float,2>{0.831423938f, 0.856948197f},
-std::array<float,2>{0.0222072508f, 0.318281233f},
-std::array<float,2>{0.413961351f, 0.565999568f},
-std::array<float,2>{0.709789038f, 0.0264449939f},
-std::array<float,2>{0.523496985f, 0.640538096f},
-std::array<float,2>{0.27659148f, 0.133489639f},
-std::array<float,2>{0.219976634f, 0.964103341f},
-std::array<float,2>{0.974334896f, 0.399619579f},
-std::array<float,2>{0.561295807f, 0.942189872f},
-std::array<float,2>{0.284927577f, 0.382065028f},
-std::array<float,2>{0.198293015f, 0.640922725f},
-std::array<float,2>{0.956224918f, 0.154246539f},
-std::array<float,2>{0.854070127f, 0.588200092f},
-std::array<float,2>{0.0524014644f, 0.0028870427f},
-std::array<float,2>{0.405440927f, 0.874215722f},
-std::array<float,2>{0.735781252f, 0.337200999f},
-std::array<float,2>{0.926002324f, 0.805852532f},
-std::array<float,2>{0.148529068f, 0.255867392f},
-std::array<float,2>{0.353504956f, 0.533345342f},
-std::array<float,2>{0.616304874f, 0.107812002f},
-std::array<float,2>{0.654628813f, 0.722011626f},
-std::array<float,2>{0.475332767f, 0.227416456f},
-std::array<float,2>{0.0678292289f, 0.890896678f},
-std::array<float,2>{0.803352237f, 0.451742142f},
-std::array<float,2>{0.696734965f, 0.823283255f},
-std::array<float,2>{0.428712606f, 0.367116511f},
-std::array<float,2>{0.00296384958f, 0.624905705f},
-std::array<float,2>{0.816350639f, 0.0491637811f},
-std::array<float,2>{0.990530252f, 0.674482763f},
-std::array<float,2>{0.243207633f, 0.174998403f},
-std::array<float,2>{0.258435011f, 0.976694763f},
-std::array<float,2>{0.511577785f, 0.414643914f},
-std::array<float,2>{0.776916206f, 0.922463715f},
-std::array<float,2>{0.0999448523f, 0.471030593f},
-std::array<float,2>{0.437889844f, 0.711448967f},
-std::array<float,2>{0.670040965f, 0.215526715f},
-std::array<float,2>{0.583025455f, 0.530871511f},
-std::array<float,2>{0.317224175f, 0.0934184641f},
-std::array<float,2>{0.163266703f, 0.77221179f},
-std::array<float,2>{0.889951348f, 0.310523421f},
-std::array<float,2>{0.507680118f, 0.865177631f},
-std::array<float,2>{0.255289614f, 0.328838885f},
-std::array<float,2>{0.240171164f, 0.580604196f},
-std::array<float,2>{0.999517083f, 0.00991193485f},
-std::array<float,2>{0.820525229f, 0.654783964f},
-std::array<float,2>{0.0139281498f, 0.141846195f},
-std::array<float,2>{0.431137621f, 0.951300204f},
-std::array<float,2>{0.694191813f, 0.387498975f},
-std::array<float,2>{0.879733026f, 0.904663324f},
-std::array<float,2>{0.16752626f, 0.439044684f},
-std::array<float,2>{0.325185418f, 0.728044391f},
-std::array<float,2>{0.588702083f, 0.22155112f},
-std::array<float,2>{0.661631763f, 0.540283084f},
-std::array<float,2>{0.449302167f, 0.100955427f},
-std::array<float,2>{0.10911072f, 0.803080559f},
-std::array<float,2>{0.768781841f, 0.260227025f},
-std::array<float,2>{0.744746149f, 0.973312676f},
-std::array<float,2>{0.391522378f, 0.41091615f},
-std::array<float,2>{0.0562561043f, 0.680590987f},
-std::array<float,2>{0.846811295f, 0.184530288f},
-std::array<float,2>{0.96627599f, 0.615989983f},
-std::array<float,2>{0.193221927f, 0.0573164597f},
-std::array<float,2>{0.292037427f, 0.819789469f},
-std::array<float,2>{0.548403442f, 0.367754191f},
-std::array<float,2>{0.805177391f, 0.776205063f},
-std::array<float,2>{0.0737208053f, 0.303637505f},
-std::array<float,2>{0.482278675f, 0.517086923f},
-std::array<float,2>{0.641605377f, 0.0849534944f},
-std::array<float,2>{0.61879158f, 0.707385659f},
-std::array<float,2>{0.346356124f, 0.210237876f},
-std::array<float,2>{0.142315209f, 0.935619831f},
-std::array<float,2>{0.932316601f, 0.481904596f},
-std::array<float,2>{0.56327641f, 0.909692109f},
-std::array<float,2>{0.339121252f, 0.497071803f},
-std::array<float,2>{0.183874533f, 0.696303904f},
-std::array<float,2>{0.897307694f, 0.198352277f},
-std::array<float,2>{0.755397499f, 0.503129303f},
-std::array<float,2>{0.117096819f, 0.0746910125f},
-std::array<float,2>{0.46214366f, 0.756992936f},
-std::array<float,2>{0.681407034f, 0.296056032f},
-std::array<float,2>{0.978917837f, 0.832639933f},
-std::array<float,2>{0.231362417f, 0.345639676f},
-std::array<float,2>{0.26945141f, 0.598559022f},
-std::array<float,2>{0.52013737f, 0.0414199606f},
-std::array<float,2>{0.714370847f, 0.662378192f},
-std::array<float,2>{0.416375846f, 0.166309103f},
-std::array<float,2>{0.0252599493f, 0.993497372f},
-std::array<float,2>{0.843534529f, 0.435496032f},
-std::array<float,2>{0.632007301f, 0.786955297f},
-std::array<float,2>{0.4988406f, 0.277818382f},
-std::array<float,2>{0.0885780379f, 0.552826822f},
-std::array<float,2>{0.791028917f, 0.109508343f},
-std::array<float,2>{0.921319723f, 0.740735531f},
-std::array<float,2>{0.125379354f, 0.246828318f},
-std::array<float,2>{0.374350578f, 0.889353037f},
-std::array<float,2>{0.604300678f, 0.456492335f},
-std::array<float,2>{0.874092102f, 0.957435369f},
-std::array<float,2>{0.03608419f, 0.397246659f},
-std::array<float,2>{0.378323376f, 0.63046056f},
-std::array<float,2>{0.71905762f, 0.130460352f},
-std::array<float,2>{0.543255448f, 0.577991784f},
-std::array<float,2>{0.311546624f, 0.0196792893f},
-std::array<float,2>{0.210827425f, 0.846829593f},
-std::array<float,2>{0.939193368f, 0.323453724f},
-std::array<float,2>{0.534204662f, 0.799417496f},
-std::array<float,2>{0.301762044f, 0.265605956f},
-std::array<float,2>{0.217201874f, 0.544018865f},
-std::array<float,2>{0.950728178f, 0.0941687748f},
-std::array<float,2>{0.86621654f, 0.733668983f},
-std::array<float,2>{0.0449017622f, 0.223252594f},
-std::array<float,2>{0.389752001f, 0.899819016f},
-std::array<float,2>{0.733541548f, 0.441610396f},
-std::array<float,2>{0.911018014f, 0.945613623f},
-std::array<float,2>{0.133483768f, 0.383750379f},
-std::array<float,2>{0.359824419f, 0.652063608f},
-std::array<float,2>{0.601333618f, 0.145590588f},
-std::array<float,2>{0.636846662f, 0.582864583f},
-std::array<float,2>{0.488739073f, 0.0150460713f},
-std::array<float,2>{0.0809363797f, 0.859845102f},
-std::array<float,2>{0.784662127f, 0.335433394f},
-std::array<float,2>{0.705717325f, 0.932027102f},
-std::array<float,2>{0.4068425f, 0.477876067f},
-std::array<float,2>{0.0185230151f, 0.703184247f},
-std::array<float,2>{0.835734904f, 0.206065789f},
-std::array<float,2>{0.970798671f, 0.521209002f},
-std::array<float,2>{0.225958571f, 0.0802007243f},
-std::array<float,2>{0.280883938f, 0.778874278f},
-std::array<float,2>{0.527477384f, 0.299920708f},
-std::array<float,2>{0.75955981f, 0.816230655f},
-std::array<float,2>{0.117723703f, 0.373188049f},
-std::array<float,2>{0.458264858f, 0.612093091f},
-std::array<float,2>{0.677701771f, 0.0613205694f},
-std::array<float,2>{0.575722694f, 0.685100019f},
-std::array<float,2>{0.332448483f, 0.180326447f},
-std::array<float,2>{0.173872009f, 0.971484542f},
-std::array<float,2>{0.899537444f, 0.40846169f},
-std::array<float,2>{0.613277078f, 0.997604311f},
-std::array<float,2>{0.357291341f, 0.433533132f},
-std::array<float,2>{0.153128535f, 0.659693897f},
-std::array<float,2>{0.924139977f, 0.171244338f},
-std::array<float,2>{0.800701022f, 0.597560942f},
-std::array<float,2>{0.0653384477f, 0.0465423651f},
-std::array<float,2>{0.471427232f, 0.829430878f},
-std::array<float,2>{0.649302304f, 0.347938687f},
-std::array<float,2>{0.960119307f, 0.750490904f},
-std::array<float,2>{0.199997455f, 0.292921722f},
-std::array<float,2>{0.287645131f, 0.504546344f},
-std::array<float,2>{0.555004954f, 0.0716372281f},
-std::array<float,2>{0.739308834f, 0.702030778f},
-std::array<float,2>{0.400309861f, 0.201800376f},
-std::array<float,2>{0.0505179018f, 0.913331866f},
-std::array<float,2>{0.858921647f, 0.495613813f},
-std::array<float,2>{0.665923536f, 0.847754121f},
-std::array<float,2>{0.444498718f, 0.324794233f},
-std::array<float,2>{0.0949663371f, 0.573684454f},
-std::array<float,2>{0.780316651f, 0.017511623f},
-std::array<float,2>{0.883634388f, 0.627929986f},
-std::array<float,2>{0.156566352f, 0.127980486f},
-std::array<float,2>{0.3147811f, 0.955160797f},
-std::array<float,2>{0.580320418f, 0.394420952f},
-std::array<float,2>{0.818355501f, 0.882935584f},
-std::array<float,2>{0.00646540802f, 0.457035571f},
-std::array<float,2>{0.422344804f, 0.738198042f},
-std::array<float,2>{0.699696958f, 0.242625669f},
-std::array<float,2>{0.515215993f, 0.549562275f},
-std::array<float,2>{0.262413025f, 0.114167161f},
-std::array<float,2>{0.247763887f, 0.784875572f},
-std::array<float,2>{0.98786813f, 0.276246399f},
-std::array<float,2>{0.592441678f, 0.83846575f},
-std::array<float,2>{0.323323786f, 0.358205736f},
-std::array<float,2>{0.170816973f, 0.604462743f},
-std::array<float,2>{0.876404464f, 0.0369707383f},
-std::array<float,2>{0.770691812f, 0.664262414f},
-std::array<float,2>{0.10260395f, 0.161738142f},
-std::array<float,2>{0.448039353f, 0.985757947f},
-std::array<float,2>{0.65639472f, 0.424451083f},
-std::array<float,2>{0.994212508f, 0.916154385f},
-std::array<float,2>{0.236662298f, 0.486318529f},
-std::array<float,2>{0.252699286f, 0.690001428f},
-std::array<float,2>{0.502873898f, 0.188756391f},
-std::array<float,2>{0.689575732f, 0.509159446f},
-std::array<float,2>{0.437415034f, 0.0633893982f},
-std::array<float,2>{0.00987219717f, 0.76015234f},
-std::array<float,2>{0.82745862f, 0.281850576f},
-std::array<float,2>{0.647274554f, 0.967756212f},
-std::array<float,2>{0.477024853f, 0.404533416f},
-std::array<float,2>{0.0765291229f, 0.63485384f},
-std::array<float,2>{0.809160709f, 0.139022276f},
-std::array<float,2>{0.935385406f, 0.569272399f},
-std::array<float,2>{0.144882798f, 0.0303851571f},
-std::array<float,2>{0.349143028f, 0.854922056f},
-std::array<float,2>{0.622014761f, 0.316277504f},
-std::array<float,2>{0.850965977f, 0.795725942f},
-std::array<float,2>{0.0588225164f, 0.268366396f},
-std::array<float,2>{0.396082729f, 0.557065845f},
-std::array<float,2>{0.748770714f, 0.117722869f},
-std::array<float,2>{0.551359653f, 0.749088883f},
-std::array<float,2>{0.294718206f, 0.236956194f},
-std::array<float,2>{0.189402014f, 0.881550372f},
-std::array<float,2>{0.963185668f, 0.466800004f},
-std::array<float,2>{0.519478858f, 0.895868361f},
-std::array<float,2>{0.269890577f, 0.446916759f},
-std::array<float,2>{0.227939636f, 0.723470926f},
-std::array<float,2>{0.981530845f, 0.232623041f},
-std::array<float,2>{0.838815749f, 0.536870062f},
-std::array<float,2>{0.030044185f, 0.101827368f},
-std::array<float,2>{0.421370715f, 0.810814798f},
-std::array<float,2>{0.718337476f, 0.251876682f},
-std::array<float,2>{0.893121123f, 0.869655609f},
-std::array<float,2>{0.18024005f, 0.341921598f},
-std::array<float,2>{0.340530187f, 0.593396842f},
-std::array<float,2>{0.568137884f, 0.00758889364f},
-std::array<float,2>{0.684334993f, 0.645715237f},
-std::array<float,2>{0.465437204f, 0.148486078f},
-std::array<float,2>{0.110563152f, 0.939825475f},
-std::array<float,2>{0.75229001f, 0.377463102f},
-std::array<float,2>{0.726205409f, 0.76784426f},
-std::array<float,2>{0.379174709f, 0.306774974f},
-std::array<float,2>{0.0334438905f, 0.526724517f},
-std::array<float,2>{0.870186031f, 0.0876098126f},
-std::array<float,2>{0.942186356f, 0.717531979f},
-std::array<float,2>{0.205685616f, 0.213969156f},
-std::array<float,2>{0.30472517f, 0.927522421f},
-std::array<float,2>{0.540187001f, 0.472960263f},
-std::array<float,2>{0.794797719f, 0.984023333f},
-std::array<float,2>{0.0909226388f, 0.420900315f},
-std::array<float,2>{0.493677974f, 0.677027702f},
-std::array<float,2>{0.625559747f, 0.17619054f},
-std::array<float,2>{0.607940853f, 0.618336618f},
-std::array<float,2>{0.369762242f, 0.0522245094f},
-std::array<float,2>{0.129062146f, 0.827121675f},
-std::array<float,2>{0.917053163f, 0.359530687f},
-std::array<float,2>{0.573311865f, 0.790347338f},
-std::array<float,2>{0.330628037f, 0.271664143f},
-std::array<float,2>{0.17701222f, 0.558689058f},
-std::array<float,2>{0.903748631f, 0.121187292f},
-std::array<float,2>{0.764782786f, 0.744700015f},
-std::array<float,2>{0.123339266f, 0.241444826f},
-std::array<float,2>{0.45697251f, 0.87846452f},
-std::array<float,2>{0.671925366f, 0.462447077f},
-std::array<float,2>{0.975693762f, 0.961182237f},
-std::array<float,2>{0.221550807f, 0.401130736f},
-std::array<float,2>{0.274508208f, 0.637303174f},
-std::array<float,2>{0.525968611f, 0.135689154f},
-std::array<float,2>{0.708391428f, 0.56370312f},
-std::array<float,2>{0.410226464f, 0.0248558372f},
-std::array<float,2>{0.0198417846f, 0.858963728f},
-std::array<float,2>{0.828672111f, 0.319414884f},
-std::array<float,2>{0.635885477f, 0.920238554f},
-std::array<float,2>{0.487659216f, 0.491514325f},
-std::array<float,2>{0.0837107599f, 0.692135572f},
-std::array<float,2>{0.786689222f, 0.191511676f},
-std::array<float,2>{0.907826424f, 0.51560986f},
-std::array<float,2>{0.138496488f, 0.067197375f},
-std::array<float,2>{0.365382373f, 0.762355506f},
-std::array<float,2>{0.59633714f, 0.287412554f},
-std::array<float,2>{0.860530198f, 0.842888415f},
-std::array<float,2>{0.0429654643f, 0.352071881f},
-std::array<float,2>{0.385994881f, 0.607482433f},
-std::array<float,2>{0.730065405f, 0.0337244943f},
-std::array<float,2>{0.53607285f, 0.669308841f},
-std::array<float,2>{0.297056019f, 0.157181457f},
-std::array<float,2>{0.213543564f, 0.991671145f},
-std::array<float,2>{0.948744714f, 0.426272005f},
-std::array<float,2>{0.509300351f, 0.979931653f},
-std::array<float,2>{0.2610403f, 0.417813122f},
-std::array<float,2>{0.244198561f, 0.673394799f},
-std::array<float,2>{0.988454401f, 0.173713222f},
-std::array<float,2>{0.813634098f, 0.621231616f},
-std::array<float,2>{0.00146862632f, 0.0479088016f},
-std::array<float,2>{0.426546037f, 0.821793258f},
-std::array<float,2>{0.697906315f, 0.364543438f},
-std::array<float,2>{0.8884601f, 0.771048486f},
-std::array<float,2>{0.160767496f, 0.310932696f},
-std::array<float,2>{0.318944722f, 0.528108358f},
-std::array<float,2>{0.584333539f, 0.0906597376f},
-std::array<float,2>{0.668035448f, 0.713121891f},
-std::array<float,2>{0.440735877f, 0.216899887f},
-std::array<float,2>{0.098321557f, 0.925091326f},
-std::array<float,2>{0.774806023f, 0.469815373f},
-std::array<float,2>{0.737209857f, 0.872534215f},
-std::array<float,2>{0.402363807f, 0.338867247f},
-std::array<float,2>{0.0528082103f, 0.587284863f},
-std::array<float,2>{0.852992773f, 0.000322721055f},
-std::array<float,2>{0.954808354f, 0.643365383f},
-std::array<float,2>{0.196505308f, 0.154851213f},
-std::array<float,2>{0.282149792f, 0.944681108f},
-std::array<float,2>{0.558934152f, 0.379148453f},
-std::array<float,2>{0.801342428f, 0.89353621f},
-std::array<float,2>{0.0689731687f, 0.450779021f},
-std::array<float,2>{0.474589616f, 0.719725013f},
-std::array<float,2>{0.652815938f, 0.229698256f},
-std::array<float,2>{0.613479614f, 0.53149873f},
-std::array<float,2>{0.354030043f, 0.106989354f},
-std::array<float,2>{0.152325287f, 0.807955027f},
-std::array<float,2>{0.928288519f, 0.255209297f},
-std::array<float,2>{0.549197197f, 0.816713631f},
-std::array<float,2>{0.290290326f, 0.369416237f},
-std::array<float,2>{0.194232777f, 0.614432454f},
-std::array<float,2>{0.967289031f, 0.0564481169f},
-std::array<float,2>{0.845628321f, 0.683389962f},
-std::array<float,2>{0.057024505f, 0.187313989f},
-std::array<float,2>{0.393970996f, 0.974969208f},
-std::array<float,2>{0.743596554f, 0.412801981f},
-std::array<float,2>{0.930207014f, 0.934686482f},
-std::array<float,2>{0.143424496f, 0.483111203f},
-std::array<float,2>{0.344356894f, 0.710908473f},
-std::array<float,2>{0.619258106f, 0.207090825f},
-std::array<float,2>{0.643813372f, 0.518771112f},
-std::array<float,2>{0.482814044f, 0.0832364485f},
-std::array<float,2>{0.0704563633f, 0.775168777f},
-std::array<float,2>{0.807012796f, 0.302251339f},
-std::array<float,2>{0.692247629f, 0.951115727f},
-std::array<float,2>{0.433475792f, 0.390341789f},
-std::array<float,2>{0.0130160935f, 0.652786791f},
-std::array<float,2>{0.823547542f, 0.142609984f},
-std::array<float,2>{0.99713552f, 0.578900874f},
-std::array<float,2>{0.241324261f, 0.00844649039f},
-std::array<float,2>{0.256393373f, 0.866916955f},
-std::array<float,2>{0.505701125f, 0.331614047f},
-std::array<float,2>{0.766519845f, 0.801497757f},
-std::array<float,2>{0.106071606f, 0.257910043f},
-std::array<float,2>{0.452425629f, 0.541909039f},
-std::array<float,2>{0.662896991f, 0.0982001349f},
-std::array<float,2>{0.586774647f, 0.729754448f},
-std::array<float,2>{0.326290309f, 0.219105616f},
-std::array<float,2>{0.165217355f, 0.903782845f},
-std::array<float,2>{0.881730676f, 0.439596206f},
-std::array<float,2>{0.603325903f, 0.88827759f},
-std::array<float,2>{0.371378243f, 0.453557491f},
-std::array<float,2>{0.127881363f, 0.739975154f},
-std::array<float,2>{0.919172585f, 0.249941617f},
-std::array<float,2>{0.789179802f, 0.552214742f},
-std::array<float,2>{0.0870557353f, 0.112261251f},
-std::array<float,2>{0.497502387f, 0.7879529f},
-std::array<float,2>{0.630315244f, 0.280045062f},
-std::array<float,2>{0.940906644f, 0.845380783f},
-std::array<float,2>{0.207138717f, 0.322197318f},
-std::array<float,2>{0.309450775f, 0.575830102f},
-std::array<float,2>{0.545372665f, 0.0219556391f},
-std::array<float,2>{0.721262515f, 0.632632315f},
-std::array<float,2>{0.376829833f, 0.132369608f},
-std::array<float,2>{0.0372970067f, 0.959857404f},
-std::array<float,2>{0.871891081f, 0.396257788f},
-std::array<float,2>{0.68258518f, 0.75469476f},
-std::array<float,2>{0.464159429f, 0.293869972f},
-std::array<float,2>{0.114925802f, 0.501846671f},
-std::array<float,2>{0.757495999f, 0.0771807581f},
-std::array<float,2>{0.895770192f, 0.697849393f},
-std::array<float,2>{0.186351463f, 0.196509004f},
-std::array<float,2>{0.337843448f, 0.906582832f},
-std::array<float,2>{0.564693034f, 0.498110116f},
-std::array<float,2>{0.84163481f, 0.994506538f},
-std::array<float,2>{0.0256840624f, 0.437246889f},
-std::array<float,2>{0.415062279f, 0.661890864f},
-std::array<float,2>{0.712304413f, 0.165719867f},
-std::array<float,2>{0.522053719f, 0.600091398f},
-std::array<float,2>{0.266700566f, 0.0402925685f},
-std::array<float,2>{0.23269777f, 0.83527714f},
-std::array<float,2>{0.977460921f, 0.347100645f},
-std::array<float,2>{0.530803263f, 0.780240357f},
-std::array<float,2>{0.277684778f, 0.297108859f},
-std::array<float,2>{0.224080816f, 0.522433341f},
-std::array<float,2>{0.970372736f, 0.0800056979f},
-std::array<float,2>{0.832717597f, 0.705467582f},
-std::array<float,2>{0.0168648399f, 0.204556316f},
-std::array<float,2>{0.408463299f, 0.93054384f},
-std::array<float,2>{0.704478443f, 0.479474783f},
-std::array<float,2>{0.900607288f, 0.969724536f},
-std::array<float,2>{0.172105744f, 0.408049911f},
-std::array<float,2>{0.334415287f, 0.687476575f},
-std::array<float,2>{0.577655613f, 0.182034314f},
-std::array<float,2>{0.677918375f, 0.610078216f},
-std::array<float,2>{0.45911184f, 0.0589998923f},
-std::array<float,2>{0.120747447f, 0.813898265f},
-std::array<float,2>{0.760523617f, 0.371338695f},
-std::array<float,2>{0.730841339f, 0.900443375f},
-std::array<float,2>{0.387836516f, 0.44361797f},
-std::array<float,2>{0.0465564281f, 0.730656445f},
-std::array<float,2>{0.863681674f, 0.226286635f},
-std::array<float,2>{0.952602506f, 0.545760334f},
-std::array<float,2>{0.216572642f, 0.0973541886f},
-std::array<float,2>{0.303868115f, 0.797434509f},
-std::array<float,2>{0.532800615f, 0.26287961f},
-std::array<float,2>{0.782873273f, 0.863194346f},
-std::array<float,2>{0.0789548755f, 0.332461685f},
-std::array<float,2>{0.491025597f, 0.58527416f},
-std::array<float,2>{0.638871312f, 0.0123205995f},
-std::array<float,2>{0.598762214f, 0.64934361f},
-std::array<float,2>{0.362107038f, 0.148097932f},
-std::array<float,2>{0.136511073f, 0.948470473f},
-std::array<float,2>{0.91382736f, 0.385321617f},
-std::array<float,2>{0.579305708f, 0.954674482f},
-std::array<float,2>{0.312608957f, 0.390862197f},
-std::array<float,2>{0.158774883f, 0.625867009f},
-std::array<float,2>{0.884925485f, 0.125139385f},
-std::array<float,2>{0.777790904f, 0.570722282f},
-std::array<float,2>{0.0972825214f, 0.0184330381f},
-std::array<float,2>{0.443049163f, 0.850009799f},
-std::array<float,2>{0.666513205f, 0.327192932f},
-std::array<float,2>{0.985879362f, 0.781447053f},
-std::array<float,2>{0.248212576f, 0.274102032f},
-std::array<float,2>{0.264997602f, 0.548431933f},
-std::array<float,2>{0.511740088f, 0.116587982f},
-std::array<float,2>{0.702258468f, 0.735298038f},
-std::array<float,2>{0.425418258f, 0.245723367f},
-std::array<float,2>{0.00428737653f, 0.885225177f},
-std::array<float,2>{0.819126487f, 0.460163176f},
-std::array<float,2>{0.650573313f, 0.831129551f},
-std::array<float,2>{0.470575094f, 0.351433963f},
-std::array<float,2>{0.0640200749f, 0.594655395f},
-std::array<float,2>{0.796875834f, 0.0439836383f},
-std::array<float,2>{0.923770845f, 0.657819688f},
-std::array<float,2>{0.155447051f, 0.168332532f},
-std::array<float,2>{0.357837021f, 0.999768555f},
-std::array<float,2>{0.61117959f, 0.431102991f},
-std::array<float,2>{0.85646826f, 0.911625981f},
-std::array<float,2>{0.0474034213f, 0.494089246f},
-std::array<float,2>{0.401184946f, 0.700518906f},
-std::array<float,2>{0.740405798f, 0.201085448f},
-std::array<float,2>{0.558531165f, 0.507366717f},
-std::array<float,2>{0.287060469f, 0.0732626766f},
-std::array<float,2>{0.201273024f, 0.752204418f},
-std::array<float,2>{0.957171917f, 0.289714545f},
-std::array<float,2>{0.623497069f, 0.851864219f},
-std::array<float,2>{0.349762231f, 0.314116955f},
-std::array<float,2>{0.148143664f, 0.56741643f},
-std::array<float,2>{0.936518252f, 0.0273595024f},
-std::array<float,2>{0.811880589f, 0.63323319f},
-std::array<float,2>{0.0757262781f, 0.138586134f},
-std::array<float,2>{0.479547024f, 0.966206312f},
-std::array<float,2>{0.646134675f, 0.402627409f},
-std::array<float,2>{0.962323785f, 0.87891531f},
-std::array<float,2>{0.190436497f, 0.465725243f},
-std::array<float,2>{0.295841336f, 0.746390641f},
-std::array<float,2>{0.553386807f, 0.235149533f},
-std::array<float,2>{0.746201873f, 0.556551397f},
-std::array<float,2>{0.397123367f, 0.120881326f},
-std::array<float,2>{0.062225379f, 0.794861436f},
-std::array<float,2>{0.848902047f, 0.26685515f},
-std::array<float,2>{0.659357429f, 0.987638831f},
-std::array<float,2>{0.445364207f, 0.42231372f},
-std::array<float,2>{0.104080819f, 0.666111708f},
-std::array<float,2>{0.771845758f, 0.162278146f},
-std::array<float,2>{0.878887773f, 0.602733135f},
-std::array<float,2>{0.169794038f, 0.0387022234f},
-std::array<float,2>{0.321316153f, 0.836208522f},
-std::array<float,2>{0.590963781f, 0.355812967f},
-std::array<float,2>{0.826134026f, 0.758247674f},
-std::array<float,2>{0.00903092884f, 0.283483356f},
-std::array<float,2>{0.435129941f, 0.510156751f},
-std::array<float,2>{0.689423025f, 0.0659964383f},
-std::array<float,2>{0.500992835f, 0.689190805f},
-std::array<float,2>{0.251192659f, 0.19087337f},
-std::array<float,2>{0.235751092f, 0.915033996f},
-std::array<float,2>{0.993748248f, 0.487623304f},
-std::array<float,2>{0.542875886f, 0.927744389f},
-std::array<float,2>{0.307701349f, 0.476109564f},
-std::array<float,2>{0.203314394f, 0.716245055f},
-std::array<float,2>{0.94401896f, 0.211286828f},
-std::array<float,2>{0.867468357f, 0.524597645f},
-std::array<float,2>{0.0331512503f, 0.0885377079f},
-std::array<float,2>{0.381019562f, 0.766732812f},
-std::array<float,2>{0.723113358f, 0.305439144f},
-std::array<float,2>{0.914899945f, 0.826148272f},
-std::array<float,2>{0.131677449f, 0.36305806f},
-std::array<float,2>{0.367972255f, 0.619507551f},
-std::array<float,2>{0.605894029f, 0.0529606864f},
-std::array<float,2>{0.627536893f, 0.679452419f},
-std::array<float,2>{0.495655477f, 0.178414971f},
-std::array<float,2>{0.0920767114f, 0.981647789f},
-std::array<float,2>{0.796391249f, 0.41890496f},
-std::array<float,2>{0.714932859f, 0.809842944f},
-std::array<float,2>{0.419431895f, 0.252410084f},
-std::array<float,2>{0.0290302243f, 0.537118554f},
-std::array<float,2>{0.837199211f, 0.105069913f},
-std::array<float,2>{0.984076679f, 0.72555232f},
-std::array<float,2>{0.2292898f, 0.231578603f},
-std::array<float,2>{0.272687823f, 0.896898031f},
-std::array<float,2>{0.516460836f, 0.44802618f},
-std::array<float,2>{0.75158751f, 0.939449847f},
-std::array<float,2>{0.111841835f, 0.375888556f},
-std::array<float,2>{0.466984093f, 0.646524727f},
-std::array<float,2>{0.686793029f, 0.150828913f},
-std::array<float,2>{0.569920778f, 0.591492176f},
-std::array<float,2>{0.342973262f, 0.00483183656f},
-std::array<float,2>{0.182965621f, 0.867284298f},
-std::array<float,2>{0.892077386f, 0.340692818f},
-std::array<float,2>{0.615234494f, 0.807409704f},
-std::array<float,2>{0.35239923f, 0.254035115f},
-std::array<float,2>{0.149738982f, 0.532388389f},
-std::array<float,2>{0.927011669f, 0.105569653f},
-std::array<float,2>{0.80438292f, 0.720411003f},
-std::array<float,2>{0.0672517493f, 0.228642195f},
-std::array<float,2>{0.475645125f, 0.893924177f},
-std::array<float,2>{0.655745983f, 0.450140268f},
-std::array<float,2>{0.955497384f, 0.944271982f},
-std::array<float,2>{0.197503626f, 0.379889101f},
-std::array<float,2>{0.283878118f, 0.644076407f},
-std::array<float,2>{0.56191802f, 0.155346408f},
-std::array<float,2>{0.73465991f, 0.586045444f},
-std::array<float,2>{0.404369652f, 0.001951301f},
-std::array<float,2>{0.0513315275f, 0.87134707f},
-std::array<float,2>{0.855243027f, 0.338629723f},
-std::array<float,2>{0.67117852f, 0.924220979f},
-std::array<float,2>{0.439295471f, 0.469007015f},
-std::array<float,2>{0.101400174f, 0.714674115f},
-std::array<float,2>{0.77597928f, 0.218231395f},
-std::array<float,2>{0.889275968f, 0.528867543f},
-std::array<float,2>{0.162365869f, 0.0911204442f},
-std::array<float,2>{0.317816556f, 0.769626081f},
-std::array<float,2>{0.582797885f, 0.312310725f},
-std::array<float,2>{0.815363169f, 0.821055233f},
-std::array<float,2>{0.00277701044f, 0.363691717f},
-std::array<float,2>{0.428012758f, 0.622578025f},
-std::array<float,2>{0.695367694f, 0.0471643247f},
-std::array<float,2>{0.510062754f, 0.672475934f},
-std::array<float,2>{0.259760201f, 0.172037706f},
-std::array<float,2>{0.242530465f, 0.978829503f},
-std::array<float,2>{0.992040098f, 0.416548789f},
-std::array<float,2>{0.537333608f, 0.990301371f},
-std::array<float,2>{0.299771398f, 0.426802516f},
-std::array<float,2>{0.212723017f, 0.668242514f},
-std::array<float,2>{0.945717156f, 0.157297924f},
-std::array<float,2>{0.86318469f, 0.608538926f},
-std::array<float,2>{0.0398456901f, 0.034307275f},
-std::array<float,2>{0.383691341f, 0.842680216f},
-std::array<float,2>{0.726672888f, 0.352692872f},
-std::array<float,2>{0.908295035f, 0.762974858f},
-std::array<float,2>{0.13883467f, 0.288257897f},
-std::array<float,2>{0.364280701f, 0.513917327f},
-std::array<float,2>{0.595035017f, 0.0677089542f},
-std::array<float,2>{0.634596229f, 0.692508996f},
-std::array<float,2>{0.485873699f, 0.193347529f},
-std::array<float,2>{0.0854817927f, 0.921841621f},
-std::array<float,2>{0.788062155f, 0.491101474f},
-std::array<float,2>{0.710856974f, 0.858252168f},
-std::array<float,2>{0.412908554f, 0.31861335f},
-std::array<float,2>{0.0226364043f, 0.562577009f},
-std::array<float,2>{0.830828071f, 0.0241386555f},
-std::array<float,2>{0.973292828f, 0.638207972f},
-std::array<float,2>{0.219230011f, 0.136023968f},
-std::array<float,2>{0.275600404f, 0.962110877f},
-std::array<float,2>{0.525271833f, 0.401482999f},
-std::array<float,2>{0.763357937f, 0.877496898f},
-std::array<float,2>{0.121703833f, 0.46183756f},
-std::array<float,2>{0.454699755f, 0.745622754f},
-std::array<float,2>{0.674181104f, 0.240515947f},
-std::array<float,2>{0.571518481f, 0.559663296f},
-std::array<float,2>{0.329811513f, 0.122146077f},
-std::array<float,2>{0.17914243f, 0.7899912f},
-std::array<float,2>{0.904858649f, 0.273250788f},
-std::array<float,2>{0.521059871f, 0.834468424f},
-std::array<float,2>{0.26776737f, 0.346091241f},
-std::array<float,2>{0.232271537f, 0.601045847f},
-std::array<float,2>{0.979826033f, 0.03930372f},
-std::array<float,2>{0.841988981f, 0.66095382f},
-std::array<float,2>{0.0241174661f, 0.16427201f},
-std::array<float,2>{0.417500824f, 0.99531126f},
-std::array<float,2>{0.713699877f, 0.436212957f},
-std::array<float,2>{0.897910535f, 0.907849133f},
-std::array<float,2>{0.185433626f, 0.499737293f},
-std::array<float,2>{0.338149369f, 0.698786736f},
-std::array<float,2>{0.564369738f, 0.196007192f},
-std::array<float,2>{0.68021673f, 0.500962973f},
-std::array<float,2>{0.461168677f, 0.0767219812f},
-std::array<float,2>{0.115744099f, 0.75521785f},
-std::array<float,2>{0.753906369f, 0.294269532f},
-std::array<float,2>{0.72023356f, 0.960629582f},
-std::array<float,2>{0.377725929f, 0.394583464f},
-std::array<float,2>{0.0361361131f, 0.63132453f},
-std::array<float,2>{0.873409033f, 0.131777614f},
-std::array<float,2>{0.938262582f, 0.574538708f},
-std::array<float,2>{0.209751561f, 0.0225379486f},
-std::array<float,2>{0.311205477f, 0.844402134f},
-std::array<float,2>{0.544384718f, 0.320830673f},
-std::array<float,2>{0.792265892f, 0.788223028f},
-std::array<float,2>{0.0896000937f, 0.280462831f},
-std::array<float,2>{0.499599993f, 0.551421463f},
-std::array<float,2>{0.63127023f, 0.112964071f},
-std::array<float,2>{0.605397165f, 0.738992989f},
-std::array<float,2>{0.373731732f, 0.248076722f},
-std::array<float,2>{0.12642011f, 0.887327671f},
-std::array<float,2>{0.92085439f, 0.454944342f},
-std::array<float,2>{0.58913666f, 0.902891695f},
-std::array<float,2>{0.32585755f, 0.440998316f},
-std::array<float,2>{0.166661173f, 0.729405046f},
-std::array<float,2>{0.880706549f, 0.220013082f},
-std::array<float,2>{0.768143535f, 0.542904556f},
-std::array<float,2>{0.108368486f, 0.0990763083f},
-std::array<float,2>{0.450207263f, 0.80209589f},
-std::array<float,2>{0.660725296f, 0.259267509f},
-std::array<float,2>{0.998944819f, 0.86613965f},
-std::array<float,2>{0.238482371f, 0.330936402f},
-std::array<float,2>{0.254359454f, 0.579566717f},
-std::array<float,2>{0.506786823f, 0.00954677351f},
-std::array<float,2>{0.694792867f, 0.65368396f},
-std::array<float,2>{0.430146754f, 0.14386861f},
-std::array<float,2>{0.0148900142f, 0.950045049f},
-std::array<float,2>{0.822215855f, 0.389326721f},
-std::array<float,2>{0.641296029f, 0.773933887f},
-std::array<float,2>{0.481025755f, 0.300887913f},
-std::array<float,2>{0.0730657279f, 0.517940819f},
-std::array<float,2>{0.805869102f, 0.0821336657f},
-std::array<float,2>{0.932882011f, 0.709241509f},
-std::array<float,2>{0.140979707f, 0.208626568f},
-std::array<float,2>{0.346795946f, 0.934479654f},
-std::array<float,2>{0.617347002f, 0.483620346f},
-std::array<float,2>{0.846315801f, 0.976299047f},
-std::array<float,2>{0.0547968261f, 0.413705409f},
-std::array<float,2>{0.392367125f, 0.681982696f},
-std::array<float,2>{0.74545157f, 0.185849249f},
-std::array<float,2>{0.547161162f, 0.614075243f},
-std::array<float,2>{0.291968554f, 0.0547962859f},
-std::array<float,2>{0.192268744f, 0.818185627f},
-std::array<float,2>{0.965688944f, 0.370240808f},
-std::array<float,2>{0.556143105f, 0.753496706f},
-std::array<float,2>{0.288887918f, 0.290969491f},
-std::array<float,2>{0.201008976f, 0.506361902f},
-std::array<float,2>{0.959909678f, 0.0729103535f},
-std::array<float,2>{0.858284116f, 0.699272931f},
-std::array<float,2>{0.0491930656f, 0.199462339f},
-std::array<float,2>{0.398761541f, 0.910817206f},
-std::array<float,2>{0.73851943f, 0.492706537f},
-std::array<float,2>{0.925652683f, 0.998241842f},
-std::array<float,2>{0.15417625f, 0.430051565f},
-std::array<float,2>{0.355983675f, 0.656624317f},
-std::array<float,2>{0.611685455f, 0.16989772f},
-std::array<float,2>{0.650291085f, 0.595422983f},
-std::array<float,2>{0.4720155f, 0.0430215485f},
-std::array<float,2>{0.0663380697f, 0.830735028f},
-std::array<float,2>{0.799000561f, 0.350041419f},
-std::array<float,2>{0.700947583f, 0.886262655f},
-std::array<float,2>{0.423137635f, 0.459841043f},
-std::array<float,2>{0.00743522123f, 0.735870659f},
-std::array<float,2>{0.81663394f, 0.244342417f},
-std::array<float,2>{0.987189412f, 0.547041655f},
-std::array<float,2>{0.246558592f, 0.116130427f},
-std::array<float,2>{0.263271213f, 0.783141613f},
-std::array<float,2>{0.514416456f, 0.274591148f},
-std::array<float,2>{0.779624581f, 0.851510584f},
-std::array<float,2>{0.0940563455f, 0.326925099f},
-std::array<float,2>{0.443487793f, 0.5720824f},
-std::array<float,2>{0.664750576f, 0.0192149635f},
-std::array<float,2>{0.581231773f, 0.626097798f},
-std::array<float,2>{0.316168368f, 0.126490101f},
-std::array<float,2>{0.158050418f, 0.953490078f},
-std::array<float,2>{0.884723783f, 0.392291218f},
-std::array<float,2>{0.600321472f, 0.94745189f},
-std::array<float,2>{0.360795349f, 0.38591826f},
-std::array<float,2>{0.134595722f, 0.650288582f},
-std::array<float,2>{0.911132991f, 0.147428483f},
-std::array<float,2>{0.783414364f, 0.584077477f},
-std::array<float,2>{0.0818073452f, 0.01282214f},
-std::array<float,2>{0.489924312f, 0.861539304f},
-std::array<float,2>{0.638438642f, 0.333170563f},
-std::array<float,2>{0.949764252f, 0.798795521f},
-std::array<float,2>{0.217933893f, 0.262588084f},
-std::array<float,2>{0.301246315f, 0.546649575f},
-std::array<float,2>{0.533635437f, 0.0966219082f},
-std::array<float,2>{0.732590199f, 0.73161447f},
-std::array<float,2>{0.389512658f, 0.225529507f},
-std::array<float,2>{0.0438666493f, 0.902299285f},
-std::array<float,2>{0.865807593f, 0.444680601f},
-std::array<float,2>{0.676041424f, 0.813464642f},
-std::array<float,2>{0.457840741f, 0.372077733f},
-std::array<float,2>{0.118318304f, 0.611176312f},
-std::array<float,2>{0.758232415f, 0.0602266043f},
-std::array<float,2>{0.89899087f, 0.685833752f},
-std::array<float,2>{0.174847409f, 0.182974339f},
-std::array<float,2>{0.333059847f, 0.970296264f},
-std::array<float,2>{0.574455082f, 0.407085091f},
-std::array<float,2>{0.834336102f, 0.930805743f},
-std::array<float,2>{0.0193409249f, 0.480392963f},
-std::array<float,2>{0.407334626f, 0.70679903f},
-std::array<float,2>{0.706276655f, 0.204005703f},
-std::array<float,2>{0.528884888f, 0.522493958f},
-std::array<float,2>{0.27970016f, 0.0790375248f},
-std::array<float,2>{0.224788606f, 0.780779004f},
-std::array<float,2>{0.972513556f, 0.298387319f},
-std::array<float,2>{0.566651106f, 0.868677199f},
-std::array<float,2>{0.341648966f, 0.341617465f},
-std::array<float,2>{0.180873528f, 0.590763569f},
-std::array<float,2>{0.893883288f, 0.00552132726f},
-std::array<float,2>{0.753109753f, 0.648145139f},
-std::array<float,2>{0.109907217f, 0.152310386f},
-std::array<float,2>{0.466035604f, 0.938159347f},
-std::array<float,2>{0.684898794f, 0.376706481f},
-std::array<float,2>{0.980966628f, 0.897844911f},
-std::array<float,2>{0.226915151f, 0.44906646f},
-std::array<float,2>{0.271161109f, 0.726473689f},
-std::array<float,2>{0.517773807f, 0.230568469f},
-std::array<float,2>{0.717302024f, 0.538578868f},
-std::array<float,2>{0.420403332f, 0.104000561f},
-std::array<float,2>{0.0307601579f, 0.809167206f},
-std::array<float,2>{0.839576066f, 0.253148228f},
-std::array<float,2>{0.626610398f, 0.980610907f},
-std::array<float,2>{0.492853016f, 0.419313937f},
-std::array<float,2>{0.0904173329f, 0.678624809f},
-std::array<float,2>{0.793479085f, 0.17918849f},
-std::array<float,2>{0.916451037f, 0.620384216f},
-std::array<float,2>{0.130119279f, 0.0541293621f},
-std::array<float,2>{0.370406181f, 0.824646831f},
-std::array<float,2>{0.608980417f, 0.36207661f},
-std::array<float,2>{0.869245172f, 0.766431272f},
-std::array<float,2>{0.0351093747f, 0.306259423f},
-std::array<float,2>{0.380243242f, 0.52387619f},
-std::array<float,2>{0.724879444f, 0.0895587355f},
-std::array<float,2>{0.539477706f, 0.715101123f},
-std::array<float,2>{0.306543261f, 0.212081537f},
-std::array<float,2>{0.206616789f, 0.929516494f},
-std::array<float,2>{0.943290114f, 0.474953532f},
-std::array<float,2>{0.503616452f, 0.915198863f},
-std::array<float,2>{0.253735811f, 0.487209469f},
-std::array<float,2>{0.238096848f, 0.687879801f},
-std::array<float,2>{0.995849133f, 0.190184876f},
-std::array<float,2>{0.826755285f, 0.511041641f},
-std::array<float,2>{0.0115584787f, 0.0652255863f},
-std::array<float,2>{0.435629249f, 0.758989871f},
-std::array<float,2>{0.690792084f, 0.284762621f},
-std::array<float,2>{0.875374198f, 0.836919308f},
-std::array<float,2>{0.171800643f, 0.357022226f},
-std::array<float,2>{0.323211551f, 0.601700306f},
-std::array<float,2>{0.59285301f, 0.0373984128f},
-std::array<float,2>{0.657270968f, 0.667846859f},
-std::array<float,2>{0.448579311f, 0.163512528f},
-std::array<float,2>{0.10244561f, 0.986843169f},
-std::array<float,2>{0.769936979f, 0.423242629f},
-std::array<float,2>{0.749791026f, 0.793410003f},
-std::array<float,2>{0.395347029f, 0.266472369f},
-std::array<float,2>{0.0595703907f, 0.555523813f},
-std::array<float,2>{0.850244343f, 0.119811103f},
-std::array<float,2>{0.964060128f, 0.747992158f},
-std::array<float,2>{0.188317552f, 0.235404179f},
-std::array<float,2>{0.293717176f, 0.88015914f},
-std::array<float,2>{0.551862538f, 0.466590762f},
-std::array<float,2>{0.809853911f, 0.965260506f},
-std::array<float,2>{0.077297233f, 0.404020637f},
-std::array<float,2>{0.477735072f, 0.634299517f},
-std::array<float,2>{0.647824407f, 0.137127504f},
-std::array<float,2>{0.622602344f, 0.56645143f},
-std::array<float,2>{0.348423928f, 0.0288625695f},
-std::array<float,2>{0.145776585f, 0.85304606f},
-std::array<float,2>{0.934280396f, 0.313140929f},
-std::array<float,2>{0.585114062f, 0.772517085f},
-std::array<float,2>{0.320147455f, 0.30881986f},
-std::array<float,2>{0.161356211f, 0.529902756f},
-std::array<float,2>{0.886775076f, 0.09253259f},
-std::array<float,2>{0.774399459f, 0.712312043f},
-std::array<float,2>{0.0991044641f, 0.21637243f},
-std::array<float,2>{0.440235198f, 0.923665345f},
-std::array<float,2>{0.66970402f, 0.471968442f},
-std::array<float,2>{0.989347696f, 0.977743864f},
-std::array<float,2>{0.245920956f, 0.415432155f},
-std::array<float,2>{0.260457546f, 0.675261557f},
-std::array<float,2>{0.508401513f, 0.174684301f},
-std::array<float,2>{0.698781788f, 0.623879135f},
-std::array<float,2>{0.427540392f, 0.0505278967f},
-std::array<float,2>{0.000185346726f, 0.823166132f},
-std::array<float,2>{0.813306451f, 0.365418375f},
-std::array<float,2>{0.653894663f, 0.891786098f},
-std::array<float,2>{0.473565251f, 0.453034937f},
-std::array<float,2>{0.0698520541f, 0.721630573f},
-std::array<float,2>{0.802356541f, 0.227728397f},
-std::array<float,2>{0.929098785f, 0.534360349f},
-std::array<float,2>{0.150809795f, 0.108602256f},
-std::array<float,2>{0.354595482f, 0.805329859f},
-std::array<float,2>{0.615083635f, 0.257373214f},
-std::array<float,2>{0.851706505f, 0.873377979f},
-std::array<float,2>{0.0544390641f, 0.335947484f},
-std::array<float,2>{0.404145449f, 0.589096904f},
-std::array<float,2>{0.737845063f, 0.0034945081f},
-std::array<float,2>{0.559616148f, 0.641857505f},
-std::array<float,2>{0.282941759f, 0.153232038f},
-std::array<float,2>{0.196070775f, 0.942750216f},
-std::array<float,2>{0.953389347f, 0.381609112f},
-std::array<float,2>{0.527039051f, 0.963637888f},
-std::array<float,2>{0.273757339f, 0.39906311f},
-std::array<float,2>{0.222349912f, 0.639001012f},
-std::array<float,2>{0.975205302f, 0.133853287f},
-std::array<float,2>{0.829391837f, 0.564478934f},
-std::array<float,2>{0.0213918816f, 0.026203312f},
-std::array<float,2>{0.411815256f, 0.856346786f},
-std::array<float,2>{0.707231581f, 0.316430569f},
-std::array<float,2>{0.902878225f, 0.791885376f},
-std::array<float,2>{0.175910875f, 0.27040115f},
-std::array<float,2>{0.331357151f, 0.561418176f},
-std::array<float,2>{0.572369516f, 0.124932349f},
-std::array<float,2>{0.673392892f, 0.743579328f},
-std::array<float,2>{0.455412269f, 0.238942429f},
-std::array<float,2>{0.124753721f, 0.87556833f},
-std::array<float,2>{0.764072359f, 0.463886082f},
-std::array<float,2>{0.729421735f, 0.841412187f},
-std::array<float,2>{0.384786338f, 0.354158342f},
-std::array<float,2>{0.0416710936f, 0.606263041f},
-std::array<float,2>{0.859460652f, 0.0318257548f},
-std::array<float,2>{0.947416902f, 0.670706272f},
-std::array<float,2>{0.214627087f, 0.15994902f},
-std::array<float,2>{0.29842487f, 0.990052164f},
-std::array<float,2>{0.536929727f, 0.42852214f},
-std::array<float,2>{0.785723925f, 0.919463575f},
-std::array<float,2>{0.082238704f, 0.49017179f},
-std::array<float,2>{0.486750901f, 0.695140481f},
-std::array<float,2>{0.63563472f, 0.194505647f},
-std::array<float,2>{0.597092271f, 0.512001455f},
-std::array<float,2>{0.366682798f, 0.0692907572f},
-std::array<float,2>{0.137037009f, 0.76396215f},
-std::array<float,2>{0.907133043f, 0.285645455f},
-std::array<float,2>{0.545990467f, 0.845971882f},
-std::array<float,2>{0.310003042f, 0.322953135f},
-std::array<float,2>{0.208240256f, 0.576873958f},
-std::array<float,2>{0.939523518f, 0.0213780217f},
-std::array<float,2>{0.872107685f, 0.629049599f},
-std::array<float,2>{0.0381859466f, 0.129244536f},
-std::array<float,2>{0.375950813f, 0.958865464f},
-std::array<float,2>{0.722591043f, 0.398066282f},
-std::array<float,2>{0.918211997f, 0.890012205f},
-std::array<float,2>{0.128902808f, 0.455895036f},
-std::array<float,2>{0.372706413f, 0.741396964f},
-std::array<float,2>{0.601887882f, 0.247728094f},
-std::array<float,2>{0.629766941f, 0.554285347f},
-std::array<float,2>{0.496186763f, 0.110416181f},
-std::array<float,2>{0.0864779875f, 0.785440207f},
-std::array<float,2>{0.790535986f, 0.278670937f},
-std::array<float,2>{0.710969925f, 0.992290199f},
-std::array<float,2>{0.414487988f, 0.433732241f},
-std::array<float,2>{0.0269328002f, 0.663446367f},
-std::array<float,2>{0.84029609f, 0.167038694f},
-std::array<float,2>{0.977625668f, 0.599028766f},
-std::array<float,2>{0.233950362f, 0.0429440141f},
-std::array<float,2>{0.266079754f, 0.833667636f},
-std::array<float,2>{0.522471011f, 0.344288051f},
-std::array<float,2>{0.755933642f, 0.756375253f},
-std::array<float,2>{0.114194222f, 0.29581055f},
-std::array<float,2>{0.463530719f, 0.502009749f},
-std::array<float,2>{0.682660162f, 0.075696826f},
-std::array<float,2>{0.56597662f, 0.695946455f},
-std::array<float,2>{0.335975021f, 0.197677061f},
-std::array<float,2>{0.187263966f, 0.90835309f},
-std::array<float,2>{0.894818842f, 0.496523499f},
-std::array<float,2>{0.620172083f, 0.936797202f},
-std::array<float,2>{0.345538706f, 0.481427491f},
-std::array<float,2>{0.144054011f, 0.708815634f},
-std::array<float,2>{0.931171179f, 0.20916988f},
-std::array<float,2>{0.807864904f, 0.515914679f},
-std::array<float,2>{0.0719501302f, 0.085168086f},
-std::array<float,2>{0.48395589f, 0.777063191f},
-std::array<float,2>{0.642879486f, 0.304664254f},
-std::array<float,2>{0.96810317f, 0.818426728f},
-std::array<float,2>{0.194911227f, 0.369125158f},
-std::array<float,2>{0.289799303f, 0.617175519f},
-std::array<float,2>{0.550596952f, 0.0576393716f},
-std::array<float,2>{0.742368281f, 0.681473315f},
-std::array<float,2>{0.392954558f, 0.184676647f},
-std::array<float,2>{0.0576839447f, 0.9736498f},
-std::array<float,2>{0.844310284f, 0.411890447f},
-std::array<float,2>{0.663562655f, 0.804328561f},
-std::array<float,2>{0.451562941f, 0.261364102f},
-std::array<float,2>{0.107383288f, 0.539591551f},
-std::array<float,2>{0.766800225f, 0.100405663f},
-std::array<float,2>{0.882433951f, 0.727323592f},
-std::array<float,2>{0.164122075f, 0.222542971f},
-std::array<float,2>{0.327648491f, 0.905535877f},
-std::array<float,2>{0.587584674f, 0.438191175f},
-std::array<float,2>{0.822410464f, 0.952207267f},
-std::array<float,2>{0.0120638143f, 0.387891591f},
-std::array<float,2>{0.431801021f, 0.655309558f},
-std::array<float,2>{0.692997098f, 0.140989542f},
-std::array<float,2>{0.504185438f, 0.58122766f},
-std::array<float,2>{0.25772956f, 0.0112690926f},
-std::array<float,2>{0.240606129f, 0.864232361f},
-std::array<float,2>{0.996406317f, 0.3298316f},
-std::array<float,2>{0.513289571f, 0.783826649f},
-std::array<float,2>{0.263705403f, 0.276387274f},
-std::array<float,2>{0.249563485f, 0.550533175f},
-std::array<float,2>{0.985143423f, 0.115015388f},
-std::array<float,2>{0.819688797f, 0.73654592f},
-std::array<float,2>{0.00541302934f, 0.24343513f},
-std::array<float,2>{0.424108267f, 0.884533525f},
-std::array<float,2>{0.701464593f, 0.458471119f},
-std::array<float,2>{0.885836005f, 0.956517339f},
-std::array<float,2>{0.159417704f, 0.392754138f},
-std::array<float,2>{0.313495189f, 0.627462626f},
-std::array<float,2>{0.579026043f, 0.127702206f},
-std::array<float,2>{0.667208612f, 0.573238015f},
-std::array<float,2>{0.442360878f, 0.0160833783f},
-std::array<float,2>{0.0963473469f, 0.848772049f},
-std::array<float,2>{0.778646111f, 0.325727075f},
-std::array<float,2>{0.74177134f, 0.91277355f},
-std::array<float,2>{0.40190953f, 0.49500066f},
-std::array<float,2>{0.0486802235f, 0.703047633f},
-std::array<float,2>{0.856126726f, 0.202617168f},
-std::array<float,2>{0.958387673f, 0.505085826f},
-std::array<float,2>{0.202481925f, 0.0703983605f},
-std::array<float,2>{0.285376459f, 0.751163602f},
-std::array<float,2>{0.556731164f, 0.291630268f},
-std::array<float,2>{0.798128724f, 0.828727722f},
-std::array<float,2>{0.0629042089f, 0.349275082f},
-std::array<float,2>{0.468957663f, 0.596354544f},
-std::array<float,2>{0.651454449f, 0.0458940975f},
-std::array<float,2>{0.610059142f, 0.658430099f},
-std::array<float,2>{0.358739436f, 0.170204714f},
-std::array<float,2>{0.154573902f, 0.996222794f},
-std::array<float,2>{0.92265296f, 0.432561904f},
-std::array<float,2>{0.576549351f, 0.971991181f},
-std::array<float,2>{0.335650325f, 0.409372568f},
-std::array<float,2>{0.17306307f, 0.683814108f},
-std::array<float,2>{0.901434243f, 0.180863127f},
-std::array<float,2>{0.761421561f, 0.612828493f},
-std::array<float,2>{0.119674146f, 0.0624899492f},
-std::array<float,2>{0.46009627f, 0.815055132f},
-std::array<float,2>{0.67903775f, 0.374145627f},
-std::array<float,2>{0.969168842f, 0.77755338f},
-std::array<float,2>{0.222830653f, 0.299344271f},
-std::array<float,2>{0.278665274f, 0.520311952f},
-std::array<float,2>{0.529458046f, 0.0814980343f},
-std::array<float,2>{0.703591943f, 0.704540074f},
-std::array<float,2>{0.409850717f, 0.205291301f},
-std::array<float,2>{0.0159600228f, 0.932673752f},
-std::array<float,2>{0.833841741f, 0.476946592f},
-std::array<float,2>{0.639731586f, 0.860486269f},
-std::array<float,2>{0.491904616f, 0.334618449f},
-std::array<float,2>{0.0796611905f, 0.583840787f},
-std::array<float,2>{0.782102466f, 0.0139770005f},
-std::array<float,2>{0.912307501f, 0.65071547f},
-std::array<float,2>{0.135648906f, 0.144691601f},
-std::array<float,2>{0.363147765f, 0.947203815f},
-std::array<float,2>{0.597941637f, 0.384619117f},
-std::array<float,2>{0.864613593f, 0.898817956f},
-std::array<float,2>{0.0451352447f, 0.443032444f},
-std::array<float,2>{0.38705495f, 0.733368099f},
-std::array<float,2>{0.732077956f, 0.224506751f},
-std::array<float,2>{0.531645536f, 0.543475151f},
-std::array<float,2>{0.302856922f, 0.0953579992f},
-std::array<float,2>{0.215570033f, 0.799919903f},
-std::array<float,2>{0.951183975f, 0.263687372f},
-std::array<float,2>{0.606660783f, 0.827608764f},
-std::array<float,2>{0.368930161f, 0.361165226f},
-std::array<float,2>{0.132193893f, 0.617546499f},
-std::array<float,2>{0.91553998f, 0.0508132838f},
-std::array<float,2>{0.795037746f, 0.675948501f},
-std::array<float,2>{0.0935625732f, 0.177323923f},
-std::array<float,2>{0.494818985f, 0.982752621f},
-std::array<float,2>{0.628690422f, 0.420374393f},
-std::array<float,2>{0.944818616f, 0.926660299f},
-std::array<float,2>{0.20415701f, 0.473881274f},
-std::array<float,2>{0.307493776f, 0.718288183f},
-std::array<float,2>{0.541455925f, 0.213729575f},
-std::array<float,2>{0.724190235f, 0.525488198f},
-std::array<float,2>{0.381961465f, 0.0862927586f},
-std::array<float,2>{0.0317600854f, 0.768712342f},
-std::array<float,2>{0.868537307f, 0.307845622f},
-std::array<float,2>{0.686520755f, 0.941020727f},
-std::array<float,2>{0.467923433f, 0.378859758f},
-std::array<float,2>{0.112721108f, 0.645231426f},
-std::array<float,2>{0.750218749f, 0.149414554f},
-std::array<float,2>{0.891372323f, 0.592381954f},
-std::array<float,2>{0.181876779f, 0.00605678931f},
-std::array<float,2>{0.342237473f, 0.871071756f},
-std::array<float,2>{0.568834841f, 0.342870951f},
-std::array<float,2>{0.836553037f, 0.811603785f},
-std::array<float,2>{0.0281131361f, 0.250756085f},
-std::array<float,2>{0.418232471f, 0.53588438f},
-std::array<float,2>{0.716326535f, 0.102757514f},
-std::array<float,2>{0.516920447f, 0.724532008f},
-std::array<float,2>{0.272042483f, 0.233599469f},
-std::array<float,2>{0.230357066f, 0.894546628f},
-std::array<float,2>{0.983089745f, 0.446105808f},
-std::array<float,2>{0.554662347f, 0.882452667f},
-std::array<float,2>{0.296621084f, 0.468321443f},
-std::array<float,2>{0.190110907f, 0.748153806f},
-std::array<float,2>{0.961492717f, 0.237548172f},
-std::array<float,2>{0.847832084f, 0.558511257f},
-std::array<float,2>{0.0614463724f, 0.118893258f},
-std::array<float,2>{0.398421824f, 0.796673894f},
-std::array<float,2>{0.748041689f, 0.268734008f},
-std::array<float,2>{0.937454522f, 0.854423344f},
-std::array<float,2>{0.146822423f, 0.315056533f},
-std::array<float,2>{0.350665182f, 0.569389999f},
-std::array<float,2>{0.624722242f, 0.0300744157f},
-std::array<float,2>{0.64514941f, 0.636257827f},
-std::array<float,2>{0.479412943f, 0.140282065f},
-std::array<float,2>{0.0750114024f, 0.968738079f},
-std::array<float,2>{0.81092751f, 0.406214744f},
-std::array<float,2>{0.687521219f, 0.761243582f},
-std::array<float,2>{0.433604598f, 0.282551736f},
-std::array<float,2>{0.00800276361f, 0.508064091f},
-std::array<float,2>{0.824499667f, 0.0638104603f},
-std::array<float,2>{0.992732167f, 0.690574944f},
-std::array<float,2>{0.23520492f, 0.188179642f},
-std::array<float,2>{0.250596017f, 0.917812347f},
-std::array<float,2>{0.500665605f, 0.485132158f},
-std::array<float,2>{0.772814989f, 0.984381497f},
-std::array<float,2>{0.104634993f, 0.425736159f},
-std::array<float,2>{0.446747392f, 0.66532582f},
-std::array<float,2>{0.65866369f, 0.160311729f},
-std::array<float,2>{0.590051711f, 0.604745626f},
-std::array<float,2>{0.320872694f, 0.0359865613f},
-std::array<float,2>{0.168332398f, 0.839631736f},
-std::array<float,2>{0.877880752f, 0.358925134f}}
\ No newline at end of file
@@ -1,4096 +0,0 @@
-{std::array<float,2>{0.974096537f, 0.996059597f},
-std::array<float,2>{0.487410247f, 0.266105115f},
-std::array<float,2>{0.0374489874f, 0.640973568f},
-std::array<float,2>{0.585222185f, 0.0987680107f},
-std::array<float,2>{0.729234278f, 0.569679201f},
-std::array<float,2>{0.243816257f, 0.132535204f},
-std::array<float,2>{0.339804113f, 0.755601704f},
-std::array<float,2>{0.823515058f, 0.418189198f},
-std::array<float,2>{0.808897614f, 0.698053122f},
-std::array<float,2>{0.285121977f, 0.0177285261f},
-std::array<float,2>{0.187208951f, 0.907660365f},
-std::array<float,2>{0.679431379f, 0.317922235f},
-std::array<float,2>{0.525664806f, 0.819750011f},
-std::array<float,2>{0.0878622904f, 0.474081933f},
-std::array<float,2>{0.419031918f, 0.54157269f},
-std::array<float,2>{0.892979383f, 0.194286644f},
-std::array<float,2>{0.87143743f, 0.810878932f},
-std::array<float,2>{0.345751375f, 0.379534304f},
-std::array<float,2>{0.207973182f, 0.617216349f},
-std::array<float,2>{0.710716486f, 0.172866404f},
-std::array<float,2>{0.59679848f, 0.672965884f},
-std::array<float,2>{0.000169284482f, 0.0823842958f},
-std::array<float,2>{0.440243751f, 0.967851698f},
-std::array<float,2>{0.965436697f, 0.288638562f},
-std::array<float,2>{0.908926189f, 0.505431533f},
-std::array<float,2>{0.404209822f, 0.242706805f},
-std::array<float,2>{0.0954077467f, 0.85204953f},
-std::array<float,2>{0.532299876f, 0.463654727f},
-std::array<float,2>{0.625597477f, 0.895360649f},
-std::array<float,2>{0.149075717f, 0.356748343f},
-std::array<float,2>{0.251097322f, 0.741873384f},
-std::array<float,2>{0.761310339f, 0.0616339371f},
-std::array<float,2>{0.774366856f, 0.927977562f},
-std::array<float,2>{0.267981827f, 0.340133101f},
-std::array<float,2>{0.126425534f, 0.704544783f},
-std::array<float,2>{0.646030664f, 0.000953313604f},
-std::array<float,2>{0.547695756f, 0.552340209f},
-std::array<float,2>{0.1237773f, 0.205212951f},
-std::array<float,2>{0.380063146f, 0.828402936f},
-std::array<float,2>{0.929852009f, 0.498707861f},
-std::array<float,2>{0.945936859f, 0.630783319f},
-std::array<float,2>{0.463124365f, 0.124176942f},
-std::array<float,2>{0.019053271f, 0.971901059f},
-std::array<float,2>{0.618351758f, 0.258062959f},
-std::array<float,2>{0.701136112f, 0.774855196f},
-std::array<float,2>{0.196610227f, 0.421925247f},
-std::array<float,2>{0.363858014f, 0.588530302f},
-std::array<float,2>{0.85315758f, 0.146786973f},
-std::array<float,2>{0.887527764f, 0.874213099f},
-std::array<float,2>{0.428073764f, 0.443403274f},
-std::array<float,2>{0.0692977533f, 0.520811856f},
-std::array<float,2>{0.510050178f, 0.229139492f},
-std::array<float,2>{0.663269281f, 0.732070446f},
-std::array<float,2>{0.15636006f, 0.0315778889f},
-std::array<float,2>{0.312244445f, 0.889937758f},
-std::array<float,2>{0.784131467f, 0.359477699f},
-std::array<float,2>{0.83757025f, 0.604062498f},
-std::array<float,2>{0.324899614f, 0.166027278f},
-std::array<float,2>{0.226814389f, 0.792400241f},
-std::array<float,2>{0.739881635f, 0.403009504f},
-std::array<float,2>{0.569668651f, 0.943937659f},
-std::array<float,2>{0.054247424f, 0.300378203f},
-std::array<float,2>{0.477643192f, 0.66732353f},
-std::array<float,2>{0.992083728f, 0.0763573572f},
-std::array<float,2>{0.924980283f, 0.878539979f},
-std::array<float,2>{0.39016366f, 0.367420226f},
-std::array<float,2>{0.111779004f, 0.719164789f},
-std::array<float,2>{0.558020651f, 0.0406243317f},
-std::array<float,2>{0.653691292f, 0.52521944f},
-std::array<float,2>{0.134904832f, 0.219167158f},
-std::array<float,2>{0.280845106f, 0.863046765f},
-std::array<float,2>{0.773348272f, 0.448573411f},
-std::array<float,2>{0.843979478f, 0.659580886f},
-std::array<float,2>{0.374494076f, 0.0699200332f},
-std::array<float,2>{0.19381699f, 0.946654379f},
-std::array<float,2>{0.691609144f, 0.309930593f},
-std::array<float,2>{0.613034725f, 0.785293996f},
-std::array<float,2>{0.0307604857f, 0.396117389f},
-std::array<float,2>{0.459594429f, 0.600007176f},
-std::array<float,2>{0.942621291f, 0.162063628f},
-std::array<float,2>{0.791565716f, 0.837026477f},
-std::array<float,2>{0.297459513f, 0.484692067f},
-std::array<float,2>{0.164555445f, 0.558327734f},
-std::array<float,2>{0.670296788f, 0.214529827f},
-std::array<float,2>{0.503929555f, 0.716162503f},
-std::array<float,2>{0.0741488785f, 0.0108431913f},
-std::array<float,2>{0.435939282f, 0.935752213f},
-std::array<float,2>{0.88221401f, 0.328397483f},
-std::array<float,2>{0.998353422f, 0.582533479f},
-std::array<float,2>{0.476516485f, 0.151919097f},
-std::array<float,2>{0.0622361638f, 0.766431749f},
-std::array<float,2>{0.578080297f, 0.432654172f},
-std::array<float,2>{0.748607814f, 0.981466174f},
-std::array<float,2>{0.22624594f, 0.257463634f},
-std::array<float,2>{0.314861983f, 0.633356035f},
-std::array<float,2>{0.835649967f, 0.116346836f},
-std::array<float,2>{0.814229786f, 0.953179181f},
-std::array<float,2>{0.332956046f, 0.289555281f},
-std::array<float,2>{0.2361366f, 0.680218577f},
-std::array<float,2>{0.725414872f, 0.0890473351f},
-std::array<float,2>{0.593368471f, 0.614620626f},
-std::array<float,2>{0.0439244658f, 0.18538706f},
-std::array<float,2>{0.496499896f, 0.798982024f},
-std::array<float,2>{0.977637291f, 0.387806356f},
-std::array<float,2>{0.904810429f, 0.745355844f},
-std::array<float,2>{0.409583539f, 0.053378325f},
-std::array<float,2>{0.0853883401f, 0.902073264f},
-std::array<float,2>{0.519707382f, 0.347058862f},
-std::array<float,2>{0.68497473f, 0.844781578f},
-std::array<float,2>{0.177390933f, 0.460888684f},
-std::array<float,2>{0.291345954f, 0.509733796f},
-std::array<float,2>{0.797297895f, 0.237064853f},
-std::array<float,2>{0.960221708f, 0.764957309f},
-std::array<float,2>{0.448621601f, 0.413099796f},
-std::array<float,2>{0.0153381098f, 0.577223003f},
-std::array<float,2>{0.606174648f, 0.135366514f},
-std::array<float,2>{0.715187967f, 0.652542293f},
-std::array<float,2>{0.211526632f, 0.108300619f},
-std::array<float,2>{0.356183082f, 0.986216247f},
-std::array<float,2>{0.863575041f, 0.277913153f},
-std::array<float,2>{0.757105112f, 0.535364449f},
-std::array<float,2>{0.264101416f, 0.199159876f},
-std::array<float,2>{0.142874479f, 0.821870148f},
-std::array<float,2>{0.636124909f, 0.478903472f},
-std::array<float,2>{0.540462077f, 0.915773809f},
-std::array<float,2>{0.105672434f, 0.327765405f},
-std::array<float,2>{0.390661567f, 0.692866504f},
-std::array<float,2>{0.916536391f, 0.0277121663f},
-std::array<float,2>{0.940992296f, 0.910299778f},
-std::array<float,2>{0.455370992f, 0.315854371f},
-std::array<float,2>{0.027238762f, 0.701934755f},
-std::array<float,2>{0.615331233f, 0.0199451875f},
-std::array<float,2>{0.691052675f, 0.54627645f},
-std::array<float,2>{0.188662678f, 0.191088378f},
-std::array<float,2>{0.368877232f, 0.812671244f},
-std::array<float,2>{0.849654496f, 0.469907314f},
-std::array<float,2>{0.766169727f, 0.647115886f},
-std::array<float,2>{0.275672764f, 0.0942559466f},
-std::array<float,2>{0.140093088f, 0.99897933f},
-std::array<float,2>{0.65191263f, 0.270289004f},
-std::array<float,2>{0.560642838f, 0.751403272f},
-std::array<float,2>{0.11510729f, 0.417240828f},
-std::array<float,2>{0.385739386f, 0.563083112f},
-std::array<float,2>{0.925789714f, 0.125074759f},
-std::array<float,2>{0.830126882f, 0.85814476f},
-std::array<float,2>{0.320283443f, 0.466668397f},
-std::array<float,2>{0.219180748f, 0.501662731f},
-std::array<float,2>{0.744598567f, 0.249080196f},
-std::array<float,2>{0.573793769f, 0.736534595f},
-std::array<float,2>{0.0573916696f, 0.0558995567f},
-std::array<float,2>{0.471608251f, 0.890991032f},
-std::array<float,2>{0.993973374f, 0.351657063f},
-std::array<float,2>{0.878531873f, 0.624142289f},
-std::array<float,2>{0.43147248f, 0.178778425f},
-std::array<float,2>{0.0767780468f, 0.80583334f},
-std::array<float,2>{0.501740813f, 0.376952112f},
-std::array<float,2>{0.665739417f, 0.962717772f},
-std::array<float,2>{0.171587616f, 0.283261895f},
-std::array<float,2>{0.304016978f, 0.679585218f},
-std::array<float,2>{0.795024633f, 0.0811988935f},
-std::array<float,2>{0.804095924f, 0.975161612f},
-std::array<float,2>{0.295078367f, 0.263621271f},
-std::array<float,2>{0.171902776f, 0.628783762f},
-std::array<float,2>{0.680903912f, 0.120755903f},
-std::array<float,2>{0.517824531f, 0.591493785f},
-std::array<float,2>{0.081385009f, 0.142215192f},
-std::array<float,2>{0.410592258f, 0.778407454f},
-std::array<float,2>{0.900804281f, 0.428722322f},
-std::array<float,2>{0.983036816f, 0.710507929f},
-std::array<float,2>{0.496090949f, 0.004652292f},
-std::array<float,2>{0.0395808518f, 0.922558963f},
-std::array<float,2>{0.587984324f, 0.338797629f},
-std::array<float,2>{0.719272077f, 0.835117459f},
-std::array<float,2>{0.241171062f, 0.493857116f},
-std::array<float,2>{0.328541994f, 0.548598945f},
-std::array<float,2>{0.820102274f, 0.207299843f},
-std::array<float,2>{0.918968976f, 0.793775797f},
-std::array<float,2>{0.395583123f, 0.40003562f},
-std::array<float,2>{0.104397088f, 0.608011663f},
-std::array<float,2>{0.544249773f, 0.171841145f},
-std::array<float,2>{0.636901915f, 0.669291377f},
-std::array<float,2>{0.147926986f, 0.0734112412f},
-std::array<float,2>{0.260598928f, 0.940051019f},
-std::array<float,2>{0.750844777f, 0.301511496f},
-std::array<float,2>{0.859964907f, 0.518616319f},
-std::array<float,2>{0.354631573f, 0.230732486f},
-std::array<float,2>{0.214942992f, 0.869548857f},
-std::array<float,2>{0.712719202f, 0.439756274f},
-std::array<float,2>{0.604917705f, 0.884954691f},
-std::array<float,2>{0.00934203248f, 0.365848511f},
-std::array<float,2>{0.450957775f, 0.727973104f},
-std::array<float,2>{0.956159174f, 0.0381010137f},
-std::array<float,2>{0.894878209f, 0.950512052f},
-std::array<float,2>{0.415178597f, 0.307004243f},
-std::array<float,2>{0.0912549272f, 0.661204636f},
-std::array<float,2>{0.529433668f, 0.0636067912f},
-std::array<float,2>{0.672671139f, 0.59455514f},
-std::array<float,2>{0.180972546f, 0.158869192f},
-std::array<float,2>{0.286916077f, 0.782158136f},
-std::array<float,2>{0.80806011f, 0.39306581f},
-std::array<float,2>{0.824613154f, 0.724767029f},
-std::array<float,2>{0.340050012f, 0.0461636186f},
-std::array<float,2>{0.249890253f, 0.88236928f},
-std::array<float,2>{0.733738661f, 0.373180032f},
-std::array<float,2>{0.580201447f, 0.8644225f},
-std::array<float,2>{0.0332092158f, 0.452295631f},
-std::array<float,2>{0.488734066f, 0.528101981f},
-std::array<float,2>{0.971692085f, 0.223965824f},
-std::array<float,2>{0.763960838f, 0.77332437f},
-std::array<float,2>{0.254936874f, 0.436326325f},
-std::array<float,2>{0.155539155f, 0.578908443f},
-std::array<float,2>{0.629616559f, 0.155471563f},
-std::array<float,2>{0.536272347f, 0.637220323f},
-std::array<float,2>{0.0992107689f, 0.1106271f},
-std::array<float,2>{0.399108261f, 0.976857126f},
-std::array<float,2>{0.912129819f, 0.250626355f},
-std::array<float,2>{0.962310612f, 0.559004307f},
-std::array<float,2>{0.442132801f, 0.217582896f},
-std::array<float,2>{0.00493351929f, 0.840839505f},
-std::array<float,2>{0.601095438f, 0.490035683f},
-std::array<float,2>{0.706982791f, 0.932403862f},
-std::array<float,2>{0.206222504f, 0.333708197f},
-std::array<float,2>{0.351500779f, 0.713429213f},
-std::array<float,2>{0.868300378f, 0.014037041f},
-std::array<float,2>{0.8568905f, 0.90356344f},
-std::array<float,2>{0.361115634f, 0.349451184f},
-std::array<float,2>{0.200866923f, 0.746992707f},
-std::array<float,2>{0.698394179f, 0.0470063426f},
-std::array<float,2>{0.624189854f, 0.51189512f},
-std::array<float,2>{0.022161277f, 0.239869773f},
-std::array<float,2>{0.467522949f, 0.847657502f},
-std::array<float,2>{0.949313164f, 0.456074178f},
-std::array<float,2>{0.937288225f, 0.685790718f},
-std::array<float,2>{0.377897173f, 0.0924748927f},
-std::array<float,2>{0.119594425f, 0.9581846f},
-std::array<float,2>{0.552094221f, 0.294331729f},
-std::array<float,2>{0.641314805f, 0.804101825f},
-std::array<float,2>{0.132075116f, 0.384366721f},
-std::array<float,2>{0.271702021f, 0.609553397f},
-std::array<float,2>{0.780274093f, 0.182032615f},
-std::array<float,2>{0.985035837f, 0.824580848f},
-std::array<float,2>{0.483035475f, 0.481744677f},
-std::array<float,2>{0.0472138263f, 0.531479478f},
-std::array<float,2>{0.563941956f, 0.200066626f},
-std::array<float,2>{0.734947264f, 0.691346049f},
-std::array<float,2>{0.231157154f, 0.0254143924f},
-std::array<float,2>{0.323705912f, 0.919803321f},
-std::array<float,2>{0.841894984f, 0.320669979f},
-std::array<float,2>{0.786588669f, 0.571868181f},
-std::array<float,2>{0.306284964f, 0.139118508f},
-std::array<float,2>{0.163467526f, 0.758098066f},
-std::array<float,2>{0.658011377f, 0.408098161f},
-std::array<float,2>{0.515158892f, 0.989736497f},
-std::array<float,2>{0.0642152131f, 0.275063723f},
-std::array<float,2>{0.423632294f, 0.651058555f},
-std::array<float,2>{0.886580944f, 0.105453759f},
-std::array<float,2>{0.967409551f, 0.965864778f},
-std::array<float,2>{0.438090205f, 0.286187202f},
-std::array<float,2>{0.00282368902f, 0.674651265f},
-std::array<float,2>{0.595217586f, 0.0848047063f},
-std::array<float,2>{0.708660126f, 0.620741129f},
-std::array<float,2>{0.209673181f, 0.175019637f},
-std::array<float,2>{0.344611764f, 0.810085595f},
-std::array<float,2>{0.87405026f, 0.382527292f},
-std::array<float,2>{0.757992029f, 0.73847729f},
-std::array<float,2>{0.252748698f, 0.0591332205f},
-std::array<float,2>{0.152290061f, 0.897719979f},
-std::array<float,2>{0.627378702f, 0.35867092f},
-std::array<float,2>{0.5334512f, 0.85546577f},
-std::array<float,2>{0.0969396308f, 0.462305844f},
-std::array<float,2>{0.40467f, 0.50735718f},
-std::array<float,2>{0.906880438f, 0.245137304f},
-std::array<float,2>{0.821331859f, 0.756662607f},
-std::array<float,2>{0.337092698f, 0.421059459f},
-std::array<float,2>{0.244848445f, 0.567811608f},
-std::array<float,2>{0.726618528f, 0.129126042f},
-std::array<float,2>{0.58264333f, 0.644443095f},
-std::array<float,2>{0.0368402489f, 0.100187056f},
-std::array<float,2>{0.485932171f, 0.992569983f},
-std::array<float,2>{0.974654377f, 0.268251896f},
-std::array<float,2>{0.891050339f, 0.540639222f},
-std::array<float,2>{0.421173304f, 0.19167006f},
-std::array<float,2>{0.0885032639f, 0.817820907f},
-std::array<float,2>{0.524537385f, 0.474784911f},
-std::array<float,2>{0.676965356f, 0.908437967f},
-std::array<float,2>{0.184660956f, 0.319109142f},
-std::array<float,2>{0.281689167f, 0.695483983f},
-std::array<float,2>{0.811025083f, 0.015962448f},
-std::array<float,2>{0.782011032f, 0.888481319f},
-std::array<float,2>{0.308615178f, 0.362192661f},
-std::array<float,2>{0.158676282f, 0.733394623f},
-std::array<float,2>{0.66148746f, 0.0348535068f},
-std::array<float,2>{0.507834256f, 0.523189962f},
-std::array<float,2>{0.0672248229f, 0.22700423f},
-std::array<float,2>{0.427191406f, 0.872722089f},
-std::array<float,2>{0.889193356f, 0.442625105f},
-std::array<float,2>{0.988530278f, 0.664350271f},
-std::array<float,2>{0.479122579f, 0.075634025f},
-std::array<float,2>{0.0512657054f, 0.942289293f},
-std::array<float,2>{0.568163931f, 0.298311621f},
-std::array<float,2>{0.741585493f, 0.789943695f},
-std::array<float,2>{0.229514375f, 0.404482782f},
-std::array<float,2>{0.32639879f, 0.602247596f},
-std::array<float,2>{0.839568079f, 0.165951714f},
-std::array<float,2>{0.933507442f, 0.830652654f},
-std::array<float,2>{0.381104916f, 0.49799329f},
-std::array<float,2>{0.121728189f, 0.553488076f},
-std::array<float,2>{0.550489187f, 0.204284221f},
-std::array<float,2>{0.64818567f, 0.705529928f},
-std::array<float,2>{0.128064394f, 0.00287244888f},
-std::array<float,2>{0.265664697f, 0.926198244f},
-std::array<float,2>{0.776709318f, 0.342137516f},
-std::array<float,2>{0.854061127f, 0.586800337f},
-std::array<float,2>{0.366099477f, 0.145441219f},
-std::array<float,2>{0.19855094f, 0.775776565f},
-std::array<float,2>{0.702384531f, 0.425387949f},
-std::array<float,2>{0.620000303f, 0.970268309f},
-std::array<float,2>{0.0166598465f, 0.260889471f},
-std::array<float,2>{0.461132348f, 0.631890953f},
-std::array<float,2>{0.947956681f, 0.121947348f},
-std::array<float,2>{0.879364371f, 0.933604777f},
-std::array<float,2>{0.435506314f, 0.331318408f},
-std::array<float,2>{0.0714009553f, 0.718546748f},
-std::array<float,2>{0.507188141f, 0.00866041239f},
-std::array<float,2>{0.669905186f, 0.555856109f},
-std::array<float,2>{0.167917773f, 0.211272627f},
-std::array<float,2>{0.299706966f, 0.839742482f},
-std::array<float,2>{0.790746987f, 0.487497389f},
-std::array<float,2>{0.832832158f, 0.636524618f},
-std::array<float,2>{0.314188719f, 0.113342851f},
-std::array<float,2>{0.223797962f, 0.983146191f},
-std::array<float,2>{0.746124744f, 0.25557366f},
-std::array<float,2>{0.574532688f, 0.768568516f},
-std::array<float,2>{0.0594622418f, 0.430216253f},
-std::array<float,2>{0.473681211f, 0.58530879f},
-std::array<float,2>{0.997176528f, 0.148735344f},
-std::array<float,2>{0.77015233f, 0.859665036f},
-std::array<float,2>{0.278919727f, 0.445425272f},
-std::array<float,2>{0.133549675f, 0.526307404f},
-std::array<float,2>{0.654618621f, 0.221128896f},
-std::array<float,2>{0.555482686f, 0.721606195f},
-std::array<float,2>{0.109851323f, 0.0415883325f},
-std::array<float,2>{0.388351858f, 0.876784086f},
-std::array<float,2>{0.922371924f, 0.369357407f},
-std::array<float,2>{0.944739997f, 0.599431396f},
-std::array<float,2>{0.45840615f, 0.162302569f},
-std::array<float,2>{0.0277874265f, 0.787251174f},
-std::array<float,2>{0.610917985f, 0.397906005f},
-std::array<float,2>{0.695080757f, 0.94774735f},
-std::array<float,2>{0.193000302f, 0.311624974f},
-std::array<float,2>{0.371689558f, 0.657894075f},
-std::array<float,2>{0.847127438f, 0.0674110502f},
-std::array<float,2>{0.865258992f, 0.98826021f},
-std::array<float,2>{0.359014183f, 0.280237317f},
-std::array<float,2>{0.213786587f, 0.654772758f},
-std::array<float,2>{0.717384458f, 0.107178256f},
-std::array<float,2>{0.609312832f, 0.574421883f},
-std::array<float,2>{0.0121736862f, 0.13384825f},
-std::array<float,2>{0.445579052f, 0.761879861f},
-std::array<float,2>{0.957579434f, 0.41132611f},
-std::array<float,2>{0.915269077f, 0.69477874f},
-std::array<float,2>{0.393914878f, 0.0312483441f},
-std::array<float,2>{0.109164223f, 0.917295992f},
-std::array<float,2>{0.542138994f, 0.325716674f},
-std::array<float,2>{0.634721398f, 0.823023677f},
-std::array<float,2>{0.142464072f, 0.476655513f},
-std::array<float,2>{0.26224491f, 0.537986219f},
-std::array<float,2>{0.755784988f, 0.197175995f},
-std::array<float,2>{0.979580402f, 0.797165871f},
-std::array<float,2>{0.498869359f, 0.389763653f},
-std::array<float,2>{0.0452823564f, 0.61657089f},
-std::array<float,2>{0.59074831f, 0.186595887f},
-std::array<float,2>{0.723741233f, 0.683285654f},
-std::array<float,2>{0.237219617f, 0.08658389f},
-std::array<float,2>{0.335012197f, 0.955418408f},
-std::array<float,2>{0.815309167f, 0.291247994f},
-std::array<float,2>{0.800279021f, 0.511002541f},
-std::array<float,2>{0.290902615f, 0.23607257f},
-std::array<float,2>{0.179248616f, 0.84609282f},
-std::array<float,2>{0.687301278f, 0.45797804f},
-std::array<float,2>{0.522282302f, 0.900198579f},
-std::array<float,2>{0.082406491f, 0.344257236f},
-std::array<float,2>{0.406690329f, 0.743990242f},
-std::array<float,2>{0.904087842f, 0.0520367958f},
-std::array<float,2>{0.995525539f, 0.893455744f},
-std::array<float,2>{0.470661581f, 0.353743702f},
-std::array<float,2>{0.0549260229f, 0.736004233f},
-std::array<float,2>{0.571318746f, 0.0567413867f},
-std::array<float,2>{0.744117081f, 0.502505183f},
-std::array<float,2>{0.221736416f, 0.246458322f},
-std::array<float,2>{0.317680269f, 0.857384861f},
-std::array<float,2>{0.829338789f, 0.468509704f},
-std::array<float,2>{0.794819951f, 0.677046478f},
-std::array<float,2>{0.300872058f, 0.0799977332f},
-std::array<float,2>{0.168050081f, 0.963606834f},
-std::array<float,2>{0.666636169f, 0.282836914f},
-std::array<float,2>{0.503799379f, 0.807349741f},
-std::array<float,2>{0.075992845f, 0.377546728f},
-std::array<float,2>{0.432968855f, 0.622038007f},
-std::array<float,2>{0.87574029f, 0.176019609f},
-std::array<float,2>{0.849152982f, 0.814657807f},
-std::array<float,2>{0.370770276f, 0.471919835f},
-std::array<float,2>{0.190974817f, 0.544049919f},
-std::array<float,2>{0.689163923f, 0.188341334f},
-std::array<float,2>{0.614689529f, 0.69930625f},
-std::array<float,2>{0.0241165403f, 0.0217775814f},
-std::array<float,2>{0.453241616f, 0.913171351f},
-std::array<float,2>{0.938309968f, 0.312830687f},
-std::array<float,2>{0.929516435f, 0.565049291f},
-std::array<float,2>{0.383585215f, 0.128808275f},
-std::array<float,2>{0.116426505f, 0.752165735f},
-std::array<float,2>{0.559147775f, 0.414526403f},
-std::array<float,2>{0.649902105f, 0.997115731f},
-std::array<float,2>{0.137342736f, 0.271831483f},
-std::array<float,2>{0.275363117f, 0.644871175f},
-std::array<float,2>{0.769213498f, 0.0974023119f},
-std::array<float,2>{0.752083957f, 0.937728465f},
-std::array<float,2>{0.259177655f, 0.304510742f},
-std::array<float,2>{0.145362452f, 0.670981407f},
-std::array<float,2>{0.639597595f, 0.0719821751f},
-std::array<float,2>{0.545114815f, 0.60717684f},
-std::array<float,2>{0.102138437f, 0.168906897f},
-std::array<float,2>{0.396547824f, 0.796726882f},
-std::array<float,2>{0.921755612f, 0.402006596f},
-std::array<float,2>{0.953609645f, 0.73031354f},
-std::array<float,2>{0.451607496f, 0.0367827863f},
-std::array<float,2>{0.0107509652f, 0.884143472f},
-std::array<float,2>{0.602400362f, 0.364603758f},
-std::array<float,2>{0.713016868f, 0.867937982f},
-std::array<float,2>{0.217695951f, 0.438272655f},
-std::array<float,2>{0.352992773f, 0.515744448f},
-std::array<float,2>{0.86238414f, 0.232488215f},
-std::array<float,2>{0.898447752f, 0.779354274f},
-std::array<float,2>{0.413758725f, 0.426144689f},
-std::array<float,2>{0.0781529546f, 0.593096495f},
-std::array<float,2>{0.5166623f, 0.144360825f},
-std::array<float,2>{0.683550656f, 0.625135183f},
-std::array<float,2>{0.174649373f, 0.117970966f},
-std::array<float,2>{0.294246525f, 0.974142849f},
-std::array<float,2>{0.802732885f, 0.263846666f},
-std::array<float,2>{0.817605317f, 0.550439477f},
-std::array<float,2>{0.330727577f, 0.209275588f},
-std::array<float,2>{0.238738641f, 0.832061112f},
-std::array<float,2>{0.722171724f, 0.494593054f},
-std::array<float,2>{0.586475313f, 0.924658656f},
-std::array<float,2>{0.0425100662f, 0.337144852f},
-std::array<float,2>{0.493215472f, 0.707693756f},
-std::array<float,2>{0.980939925f, 0.00753835123f},
-std::array<float,2>{0.912090778f, 0.979546785f},
-std::array<float,2>{0.401396841f, 0.25273326f},
-std::array<float,2>{0.100991622f, 0.640415609f},
-std::array<float,2>{0.537140369f, 0.113066606f},
-std::array<float,2>{0.632687509f, 0.582024097f},
-std::array<float,2>{0.153906718f, 0.153869107f},
-std::array<float,2>{0.257127553f, 0.770686686f},
-std::array<float,2>{0.762262404f, 0.435203701f},
-std::array<float,2>{0.869554937f, 0.712184131f},
-std::array<float,2>{0.34783268f, 0.0134619996f},
-std::array<float,2>{0.204530224f, 0.93053925f},
-std::array<float,2>{0.703896165f, 0.334623605f},
-std::array<float,2>{0.597883403f, 0.842484593f},
-std::array<float,2>{0.00735001126f, 0.491247028f},
-std::array<float,2>{0.445011109f, 0.562134266f},
-std::array<float,2>{0.963745117f, 0.214998484f},
-std::array<float,2>{0.806155682f, 0.783727944f},
-std::array<float,2>{0.288455993f, 0.392204642f},
-std::array<float,2>{0.182086557f, 0.596667349f},
-std::array<float,2>{0.673840463f, 0.156538025f},
-std::array<float,2>{0.527737558f, 0.662705362f},
-std::array<float,2>{0.0926730484f, 0.0659172088f},
-std::array<float,2>{0.416362166f, 0.95134747f},
-std::array<float,2>{0.897871137f, 0.306623548f},
-std::array<float,2>{0.970660985f, 0.529613733f},
-std::array<float,2>{0.491327554f, 0.224992648f},
-std::array<float,2>{0.0314762853f, 0.86629355f},
-std::array<float,2>{0.578816712f, 0.450652987f},
-std::array<float,2>{0.73090297f, 0.880782843f},
-std::array<float,2>{0.247094035f, 0.371289432f},
-std::array<float,2>{0.342180818f, 0.722790837f},
-std::array<float,2>{0.827437699f, 0.0448265933f},
-std::array<float,2>{0.841176212f, 0.920337737f},
-std::array<float,2>{0.322072715f, 0.324210882f},
-std::array<float,2>{0.232935593f, 0.689133465f},
-std::array<float,2>{0.738090396f, 0.0236230567f},
-std::array<float,2>{0.565620005f, 0.534492612f},
-std::array<float,2>{0.0494333655f, 0.202810854f},
-std::array<float,2>{0.482023746f, 0.827116132f},
-std::array<float,2>{0.9879722f, 0.483212858f},
-std::array<float,2>{0.883336484f, 0.649642348f},
-std::array<float,2>{0.424529046f, 0.101914793f},
-std::array<float,2>{0.0651812479f, 0.992158711f},
-std::array<float,2>{0.512054324f, 0.276709288f},
-std::array<float,2>{0.659069479f, 0.759974658f},
-std::array<float,2>{0.162045002f, 0.409580052f},
-std::array<float,2>{0.306721747f, 0.57317239f},
-std::array<float,2>{0.787867844f, 0.137544528f},
-std::array<float,2>{0.951805353f, 0.851355135f},
-std::array<float,2>{0.464891881f, 0.453817189f},
-std::array<float,2>{0.0212766621f, 0.514892995f},
-std::array<float,2>{0.621759772f, 0.24053055f},
-std::array<float,2>{0.696742415f, 0.748614728f},
-std::array<float,2>{0.201486081f, 0.0503512397f},
-std::array<float,2>{0.363006145f, 0.904430807f},
-std::array<float,2>{0.858237803f, 0.350201875f},
-std::array<float,2>{0.777437508f, 0.61313051f},
-std::array<float,2>{0.269921243f, 0.180981785f},
-std::array<float,2>{0.12987648f, 0.801794827f},
-std::array<float,2>{0.642925441f, 0.386525571f},
-std::array<float,2>{0.553691447f, 0.960264146f},
-std::array<float,2>{0.117223665f, 0.296377957f},
-std::array<float,2>{0.375043571f, 0.683775365f},
-std::array<float,2>{0.933959067f, 0.0902004391f},
-std::array<float,2>{0.990858912f, 0.942804337f},
-std::array<float,2>{0.476900101f, 0.297729582f},
-std::array<float,2>{0.0534747541f, 0.665777266f},
-std::array<float,2>{0.568696678f, 0.0749380812f},
-std::array<float,2>{0.738931239f, 0.603001952f},
-std::array<float,2>{0.227769718f, 0.164810687f},
-std::array<float,2>{0.325365961f, 0.790070713f},
-std::array<float,2>{0.836136401f, 0.405955464f},
-std::array<float,2>{0.784307957f, 0.73348695f},
-std::array<float,2>{0.311305225f, 0.0338398814f},
-std::array<float,2>{0.157515869f, 0.887563646f},
-std::array<float,2>{0.662507832f, 0.362469703f},
-std::array<float,2>{0.510778487f, 0.872062147f},
-std::array<float,2>{0.070311591f, 0.442157388f},
-std::array<float,2>{0.429581702f, 0.522049069f},
-std::array<float,2>{0.887874186f, 0.228494734f},
-std::array<float,2>{0.851566434f, 0.77647531f},
-std::array<float,2>{0.364887893f, 0.424573839f},
-std::array<float,2>{0.195326835f, 0.5870924f},
-std::array<float,2>{0.700156987f, 0.146248877f},
-std::array<float,2>{0.618008792f, 0.631160378f},
-std::array<float,2>{0.0176577847f, 0.12289001f},
-std::array<float,2>{0.463917911f, 0.968859434f},
-std::array<float,2>{0.946717978f, 0.260101706f},
-std::array<float,2>{0.9312675f, 0.554551661f},
-std::array<float,2>{0.379480898f, 0.203219548f},
-std::array<float,2>{0.124976337f, 0.8315624f},
-std::array<float,2>{0.548469484f, 0.496260941f},
-std::array<float,2>{0.645115554f, 0.927271247f},
-std::array<float,2>{0.125346944f, 0.343319088f},
-std::array<float,2>{0.268907905f, 0.706198812f},
-std::array<float,2>{0.77520889f, 0.00330568734f},
-std::array<float,2>{0.760632336f, 0.897040784f},
-std::array<float,2>{0.250890285f, 0.357873857f},
-std::array<float,2>{0.149725467f, 0.740193009f},
-std::array<float,2>{0.626768887f, 0.0599447563f},
-std::array<float,2>{0.5312922f, 0.506044388f},
-std::array<float,2>{0.094604902f, 0.244631484f},
-std::array<float,2>{0.402667642f, 0.854364991f},
-std::array<float,2>{0.909879208f, 0.461684942f},
-std::array<float,2>{0.966604412f, 0.67565167f},
-std::array<float,2>{0.440851629f, 0.0856382251f},
-std::array<float,2>{0.00171670434f, 0.965185463f},
-std::array<float,2>{0.59624207f, 0.285180837f},
-std::array<float,2>{0.709762275f, 0.809186339f},
-std::array<float,2>{0.208268806f, 0.381652027f},
-std::array<float,2>{0.347019762f, 0.619556427f},
-std::array<float,2>{0.872936547f, 0.173983559f},
-std::array<float,2>{0.894040406f, 0.816953361f},
-std::array<float,2>{0.418323666f, 0.476388782f},
-std::array<float,2>{0.0865871087f, 0.540013134f},
-std::array<float,2>{0.526869774f, 0.193321809f},
-std::array<float,2>{0.678444624f, 0.697131157f},
-std::array<float,2>{0.185934916f, 0.0168524329f},
-std::array<float,2>{0.284133017f, 0.909764528f},
-std::array<float,2>{0.810477436f, 0.319439232f},
-std::array<float,2>{0.823151231f, 0.566885054f},
-std::array<float,2>{0.338046879f, 0.130207166f},
-std::array<float,2>{0.242216289f, 0.756958246f},
-std::array<float,2>{0.730389953f, 0.420021236f},
-std::array<float,2>{0.584599376f, 0.993908405f},
-std::array<float,2>{0.0384461917f, 0.269468278f},
-std::array<float,2>{0.48716563f, 0.64258939f},
-std::array<float,2>{0.973631024f, 0.100767486f},
-std::array<float,2>{0.917257488f, 0.916424155f},
-std::array<float,2>{0.392412722f, 0.324752182f},
-std::array<float,2>{0.106919229f, 0.694268107f},
-std::array<float,2>{0.53977257f, 0.0299333576f},
-std::array<float,2>{0.635270536f, 0.538535178f},
-std::array<float,2>{0.143699437f, 0.195550844f},
-std::array<float,2>{0.265021682f, 0.823491633f},
-std::array<float,2>{0.756451666f, 0.477889508f},
-std::array<float,2>{0.864780724f, 0.655311882f},
-std::array<float,2>{0.35666585f, 0.106104895f},
-std::array<float,2>{0.212125316f, 0.986400962f},
-std::array<float,2>{0.716688335f, 0.281065285f},
-std::array<float,2>{0.607161343f, 0.763599098f},
-std::array<float,2>{0.0141057577f, 0.410945863f},
-std::array<float,2>{0.4477202f, 0.575414777f},
-std::array<float,2>{0.959138572f, 0.133309439f},
-std::array<float,2>{0.798323572f, 0.847511649f},
-std::array<float,2>{0.292482644f, 0.458983928f},
-std::array<float,2>{0.176265836f, 0.510684609f},
-std::array<float,2>{0.684298098f, 0.23502259f},
-std::array<float,2>{0.521247923f, 0.742385149f},
-std::array<float,2>{0.0842422321f, 0.050864093f},
-std::array<float,2>{0.408850044f, 0.899347782f},
-std::array<float,2>{0.905297101f, 0.345010102f},
-std::array<float,2>{0.97677362f, 0.615395129f},
-std::array<float,2>{0.497885823f, 0.186167508f},
-std::array<float,2>{0.0447210521f, 0.798635185f},
-std::array<float,2>{0.591976464f, 0.389075786f},
-std::array<float,2>{0.725810051f, 0.956494272f},
-std::array<float,2>{0.234520733f, 0.292727321f},
-std::array<float,2>{0.3339037f, 0.681829333f},
-std::array<float,2>{0.812577546f, 0.0871331915f},
-std::array<float,2>{0.834385097f, 0.983688951f},
-std::array<float,2>{0.315502375f, 0.254381895f},
-std::array<float,2>{0.2249569f, 0.635569334f},
-std::array<float,2>{0.749518275f, 0.114508696f},
-std::array<float,2>{0.576385021f, 0.584151208f},
-std::array<float,2>{0.0606832542f, 0.150280505f},
-std::array<float,2>{0.474683464f, 0.767961085f},
-std::array<float,2>{0.999715686f, 0.431448817f},
-std::array<float,2>{0.881231487f, 0.717344284f},
-std::array<float,2>{0.436632663f, 0.00882978458f},
-std::array<float,2>{0.072612457f, 0.93512857f},
-std::array<float,2>{0.505468607f, 0.330247313f},
-std::array<float,2>{0.671424687f, 0.838348627f},
-std::array<float,2>{0.165254116f, 0.486673087f},
-std::array<float,2>{0.298337102f, 0.555057466f},
-std::array<float,2>{0.792209387f, 0.212225884f},
-std::array<float,2>{0.941661954f, 0.788579106f},
-std::array<float,2>{0.460234195f, 0.397233725f},
-std::array<float,2>{0.0297896694f, 0.597726822f},
-std::array<float,2>{0.611551523f, 0.163825825f},
-std::array<float,2>{0.693300188f, 0.657209754f},
-std::array<float,2>{0.194362789f, 0.0672399029f},
-std::array<float,2>{0.373596609f, 0.948245168f},
-std::array<float,2>{0.845092952f, 0.310818642f},
-std::array<float,2>{0.772072256f, 0.526431799f},
-std::array<float,2>{0.279842347f, 0.222548127f},
-std::array<float,2>{0.136146724f, 0.860968888f},
-std::array<float,2>{0.652693272f, 0.447166979f},
-std::array<float,2>{0.557555497f, 0.875497699f},
-std::array<float,2>{0.112428568f, 0.371055692f},
-std::array<float,2>{0.38913843f, 0.721778452f},
-std::array<float,2>{0.923953354f, 0.0426861458f},
-std::array<float,2>{0.95572716f, 0.88290441f},
-std::array<float,2>{0.449573308f, 0.363659352f},
-std::array<float,2>{0.00782982726f, 0.728990555f},
-std::array<float,2>{0.604354024f, 0.0354864225f},
-std::array<float,2>{0.711079299f, 0.516877055f},
-std::array<float,2>{0.216183364f, 0.234255731f},
-std::array<float,2>{0.353561729f, 0.868688524f},
-std::array<float,2>{0.860997975f, 0.43931061f},
-std::array<float,2>{0.751459837f, 0.670062363f},
-std::array<float,2>{0.261544287f, 0.0711412504f},
-std::array<float,2>{0.146635011f, 0.938777387f},
-std::array<float,2>{0.638644278f, 0.303259611f},
-std::array<float,2>{0.543607175f, 0.795601428f},
-std::array<float,2>{0.104835495f, 0.400885224f},
-std::array<float,2>{0.395174205f, 0.60580349f},
-std::array<float,2>{0.918029249f, 0.169405416f},
-std::array<float,2>{0.818915963f, 0.833578229f},
-std::array<float,2>{0.329294533f, 0.495598555f},
-std::array<float,2>{0.24187617f, 0.549710691f},
-std::array<float,2>{0.719945967f, 0.210467935f},
-std::array<float,2>{0.589747667f, 0.708025694f},
-std::array<float,2>{0.0404977277f, 0.0067105554f},
-std::array<float,2>{0.494178683f, 0.925316989f},
-std::array<float,2>{0.984046817f, 0.336395442f},
-std::array<float,2>{0.901792705f, 0.591986358f},
-std::array<float,2>{0.411630124f, 0.142831653f},
-std::array<float,2>{0.0801269934f, 0.780600071f},
-std::array<float,2>{0.518904746f, 0.4275769f},
-std::array<float,2>{0.679820955f, 0.9735021f},
-std::array<float,2>{0.173721105f, 0.265058458f},
-std::array<float,2>{0.296469629f, 0.626058459f},
-std::array<float,2>{0.803687036f, 0.11853049f},
-std::array<float,2>{0.795982778f, 0.963969529f},
-std::array<float,2>{0.30332458f, 0.281494349f},
-std::array<float,2>{0.170822978f, 0.67600137f},
-std::array<float,2>{0.664532423f, 0.0785314664f},
-std::array<float,2>{0.500313938f, 0.622794449f},
-std::array<float,2>{0.0774878338f, 0.176969022f},
-std::array<float,2>{0.429865628f, 0.808343053f},
-std::array<float,2>{0.877511024f, 0.378575325f},
-std::array<float,2>{0.992864192f, 0.734740615f},
-std::array<float,2>{0.472200364f, 0.0577379167f},
-std::array<float,2>{0.0584686399f, 0.894346893f},
-std::array<float,2>{0.572929382f, 0.355265677f},
-std::array<float,2>{0.745486081f, 0.856093466f},
-std::array<float,2>{0.220632836f, 0.467586458f},
-std::array<float,2>{0.31887272f, 0.503356218f},
-std::array<float,2>{0.831753731f, 0.247251257f},
-std::array<float,2>{0.927150428f, 0.753457785f},
-std::array<float,2>{0.385783255f, 0.415554792f},
-std::array<float,2>{0.114128619f, 0.565734625f},
-std::array<float,2>{0.562421203f, 0.127422854f},
-std::array<float,2>{0.650741518f, 0.646118104f},
-std::array<float,2>{0.138853446f, 0.0959781259f},
-std::array<float,2>{0.277113259f, 0.9965294f},
-std::array<float,2>{0.767416596f, 0.273081392f},
-std::array<float,2>{0.851226985f, 0.543486536f},
-std::array<float,2>{0.367780805f, 0.189291343f},
-std::array<float,2>{0.188336983f, 0.815508306f},
-std::array<float,2>{0.690355182f, 0.470913559f},
-std::array<float,2>{0.617170811f, 0.912939012f},
-std::array<float,2>{0.0258246269f, 0.314056516f},
-std::array<float,2>{0.456714213f, 0.7010355f},
-std::array<float,2>{0.940286338f, 0.023300644f},
-std::array<float,2>{0.884951353f, 0.990631044f},
-std::array<float,2>{0.422439843f, 0.275940925f},
-std::array<float,2>{0.0626766309f, 0.648753822f},
-std::array<float,2>{0.513928533f, 0.103132896f},
-std::array<float,2>{0.656796575f, 0.573376596f},
-std::array<float,2>{0.163045615f, 0.138038635f},
-std::array<float,2>{0.305124521f, 0.761241674f},
-std::array<float,2>{0.785385966f, 0.408958435f},
-std::array<float,2>{0.843067527f, 0.687615991f},
-std::array<float,2>{0.32276085f, 0.0252719726f},
-std::array<float,2>{0.232345775f, 0.921820223f},
-std::array<float,2>{0.73535341f, 0.322672695f},
-std::array<float,2>{0.563458562f, 0.827772856f},
-std::array<float,2>{0.0484645925f, 0.484288275f},
-std::array<float,2>{0.483889788f, 0.533357799f},
-std::array<float,2>{0.985628307f, 0.201344296f},
-std::array<float,2>{0.779658377f, 0.801282108f},
-std::array<float,2>{0.273362756f, 0.385248005f},
-std::array<float,2>{0.131289318f, 0.612124264f},
-std::array<float,2>{0.64193958f, 0.179913014f},
-std::array<float,2>{0.551603198f, 0.685493946f},
-std::array<float,2>{0.120478965f, 0.0916840062f},
-std::array<float,2>{0.378192514f, 0.959027171f},
-std::array<float,2>{0.936146438f, 0.294959396f},
-std::array<float,2>{0.950439334f, 0.513878703f},
-std::array<float,2>{0.468498826f, 0.241741017f},
-std::array<float,2>{0.0227272511f, 0.849864125f},
-std::array<float,2>{0.623275399f, 0.454388708f},
-std::array<float,2>{0.69750911f, 0.906018674f},
-std::array<float,2>{0.199615851f, 0.351302177f},
-std::array<float,2>{0.359843135f, 0.74966073f},
-std::array<float,2>{0.856217206f, 0.0488790013f},
-std::array<float,2>{0.867659688f, 0.931618929f},
-std::array<float,2>{0.349660575f, 0.335468084f},
-std::array<float,2>{0.205780029f, 0.711233199f},
-std::array<float,2>{0.706038475f, 0.0121022929f},
-std::array<float,2>{0.60025382f, 0.561119199f},
-std::array<float,2>{0.0041214563f, 0.21616143f},
-std::array<float,2>{0.443240196f, 0.843459249f},
-std::array<float,2>{0.961374581f, 0.491042793f},
-std::array<float,2>{0.913493037f, 0.639609933f},
-std::array<float,2>{0.400217891f, 0.11168278f},
-std::array<float,2>{0.0982967317f, 0.978735864f},
-std::array<float,2>{0.535910547f, 0.253093094f},
-std::array<float,2>{0.630622923f, 0.770038486f},
-std::array<float,2>{0.154822677f, 0.43403241f},
-std::array<float,2>{0.254132003f, 0.580699861f},
-std::array<float,2>{0.764659524f, 0.152772769f},
-std::array<float,2>{0.971144736f, 0.865959048f},
-std::array<float,2>{0.489429861f, 0.449707717f},
-std::array<float,2>{0.0348089598f, 0.530739665f},
-std::array<float,2>{0.581233978f, 0.226206362f},
-std::array<float,2>{0.73324573f, 0.724351287f},
-std::array<float,2>{0.248857781f, 0.043738611f},
-std::array<float,2>{0.341684878f, 0.879719079f},
-std::array<float,2>{0.825862408f, 0.372314334f},
-std::array<float,2>{0.807290852f, 0.597499907f},
-std::array<float,2>{0.285191238f, 0.15729405f},
-std::array<float,2>{0.180547327f, 0.784827232f},
-std::array<float,2>{0.673249483f, 0.391526401f},
-std::array<float,2>{0.530865192f, 0.953121901f},
-std::array<float,2>{0.0903751776f, 0.305451274f},
-std::array<float,2>{0.414430499f, 0.663187146f},
-std::array<float,2>{0.895691574f, 0.0651424453f},
-std::array<float,2>{0.948743999f, 0.970990896f},
-std::array<float,2>{0.462097555f, 0.258802354f},
-std::array<float,2>{0.016482316f, 0.629538596f},
-std::array<float,2>{0.620794892f, 0.123238206f},
-std::array<float,2>{0.702097535f, 0.589073837f},
-std::array<float,2>{0.197337031f, 0.148104101f},
-std::array<float,2>{0.366246969f, 0.774076104f},
-std::array<float,2>{0.854500473f, 0.423050344f},
-std::array<float,2>{0.775748491f, 0.703651369f},
-std::array<float,2>{0.267096013f, 0.00114205049f},
-std::array<float,2>{0.127580717f, 0.928876281f},
-std::array<float,2>{0.647043169f, 0.341589153f},
-std::array<float,2>{0.549243808f, 0.829440832f},
-std::array<float,2>{0.122760601f, 0.499651462f},
-std::array<float,2>{0.381887257f, 0.550929606f},
-std::array<float,2>{0.932606876f, 0.206403539f},
-std::array<float,2>{0.838098049f, 0.791023195f},
-std::array<float,2>{0.327792108f, 0.403756738f},
-std::array<float,2>{0.228944317f, 0.605083525f},
-std::array<float,2>{0.740971208f, 0.167728215f},
-std::array<float,2>{0.566922784f, 0.666662574f},
-std::array<float,2>{0.0526807271f, 0.0779458284f},
-std::array<float,2>{0.479625106f, 0.944550872f},
-std::array<float,2>{0.989641666f, 0.299566984f},
-std::array<float,2>{0.890234649f, 0.520302117f},
-std::array<float,2>{0.42609182f, 0.229854658f},
-std::array<float,2>{0.0681224242f, 0.87308991f},
-std::array<float,2>{0.509548426f, 0.444921374f},
-std::array<float,2>{0.660789371f, 0.889075339f},
-std::array<float,2>{0.159984991f, 0.361228913f},
-std::array<float,2>{0.310146838f, 0.730578482f},
-std::array<float,2>{0.783065915f, 0.0326292142f},
-std::array<float,2>{0.812369823f, 0.90651232f},
-std::array<float,2>{0.282815605f, 0.31657666f},
-std::array<float,2>{0.184391022f, 0.698882878f},
-std::array<float,2>{0.675942838f, 0.01863271f},
-std::array<float,2>{0.523906589f, 0.542830586f},
-std::array<float,2>{0.0889122486f, 0.194842607f},
-std::array<float,2>{0.420690477f, 0.818880856f},
-std::array<float,2>{0.891612232f, 0.473283917f},
-std::array<float,2>{0.975762308f, 0.641801596f},
-std::array<float,2>{0.48492077f, 0.0978235155f},
-std::array<float,2>{0.0354346782f, 0.994295478f},
-std::array<float,2>{0.583373368f, 0.267530859f},
-std::array<float,2>{0.728383541f, 0.754841506f},
-std::array<float,2>{0.245816544f, 0.41895476f},
-std::array<float,2>{0.336326659f, 0.569291353f},
-std::array<float,2>{0.821219623f, 0.131116048f},
-std::array<float,2>{0.908128917f, 0.853030801f},
-std::array<float,2>{0.405973941f, 0.464011878f},
-std::array<float,2>{0.096292302f, 0.504425228f},
-std::array<float,2>{0.534907997f, 0.243665338f},
-std::array<float,2>{0.627966881f, 0.741073668f},
-std::array<float,2>{0.15069817f, 0.060983628f},
-std::array<float,2>{0.253307402f, 0.896483004f},
-std::array<float,2>{0.759244144f, 0.356173605f},
-std::array<float,2>{0.873245358f, 0.618425429f},
-std::array<float,2>{0.345141828f, 0.172285736f},
-std::array<float,2>{0.210659146f, 0.812226474f},
-std::array<float,2>{0.70703125f, 0.380439937f},
-std::array<float,2>{0.594206631f, 0.967197418f},
-std::array<float,2>{0.00374101149f, 0.288083285f},
-std::array<float,2>{0.438638628f, 0.672558784f},
-std::array<float,2>{0.968214989f, 0.0836663544f},
-std::array<float,2>{0.902403116f, 0.900546432f},
-std::array<float,2>{0.407455981f, 0.346129954f},
-std::array<float,2>{0.0835226476f, 0.744405627f},
-std::array<float,2>{0.522925735f, 0.0538018718f},
-std::array<float,2>{0.685739636f, 0.508575499f},
-std::array<float,2>{0.177825138f, 0.23744905f},
-std::array<float,2>{0.28946197f, 0.84444952f},
-std::array<float,2>{0.799358606f, 0.459574223f},
-std::array<float,2>{0.815789461f, 0.680777431f},
-std::array<float,2>{0.334871411f, 0.0884019583f},
-std::array<float,2>{0.237337455f, 0.954867184f},
-std::array<float,2>{0.722994328f, 0.290884703f},
-std::array<float,2>{0.591039062f, 0.799982369f},
-std::array<float,2>{0.046348691f, 0.387569189f},
-std::array<float,2>{0.499995887f, 0.613382995f},
-std::array<float,2>{0.979384243f, 0.184350267f},
-std::array<float,2>{0.754838943f, 0.820667982f},
-std::array<float,2>{0.263395131f, 0.48012206f},
-std::array<float,2>{0.141014531f, 0.53672713f},
-std::array<float,2>{0.632907212f, 0.197545066f},
-std::array<float,2>{0.541522682f, 0.692327499f},
-std::array<float,2>{0.108211659f, 0.0289641395f},
-std::array<float,2>{0.392711163f, 0.914152026f},
-std::array<float,2>{0.914523244f, 0.326687455f},
-std::array<float,2>{0.958194077f, 0.576745212f},
-std::array<float,2>{0.446975023f, 0.136165828f},
-std::array<float,2>{0.0130007537f, 0.763910472f},
-std::array<float,2>{0.60789144f, 0.412387282f},
-std::array<float,2>{0.718027413f, 0.984552979f},
-std::array<float,2>{0.214664295f, 0.278687507f},
-std::array<float,2>{0.358365148f, 0.653611064f},
-std::array<float,2>{0.867013752f, 0.109184064f},
-std::array<float,2>{0.84605217f, 0.945547462f},
-std::array<float,2>{0.37254259f, 0.308840603f},
-std::array<float,2>{0.191639856f, 0.658884346f},
-std::array<float,2>{0.694258451f, 0.068432048f},
-std::array<float,2>{0.609397292f, 0.601000965f},
-std::array<float,2>{0.0288775899f, 0.160577118f},
-std::array<float,2>{0.457861423f, 0.786728084f},
-std::array<float,2>{0.943846285f, 0.394780815f},
-std::array<float,2>{0.923664272f, 0.719857216f},
-std::array<float,2>{0.387221992f, 0.0397116914f},
-std::array<float,2>{0.111003362f, 0.877251685f},
-std::array<float,2>{0.556510985f, 0.369115293f},
-std::array<float,2>{0.655413806f, 0.861611307f},
-std::array<float,2>{0.134029523f, 0.448196739f},
-std::array<float,2>{0.277649313f, 0.524333894f},
-std::array<float,2>{0.771077216f, 0.220687822f},
-std::array<float,2>{0.996149838f, 0.767045915f},
-std::array<float,2>{0.472721905f, 0.432006031f},
-std::array<float,2>{0.0595885664f, 0.58343786f},
-std::array<float,2>{0.575560153f, 0.151124254f},
-std::array<float,2>{0.747323394f, 0.633824944f},
-std::array<float,2>{0.222891957f, 0.115391284f},
-std::array<float,2>{0.31319508f, 0.981206656f},
-std::array<float,2>{0.833511829f, 0.256017983f},
-std::array<float,2>{0.789286375f, 0.557551146f},
-std::array<float,2>{0.300567508f, 0.213760853f},
-std::array<float,2>{0.166924134f, 0.836886346f},
-std::array<float,2>{0.668129981f, 0.485600948f},
-std::array<float,2>{0.506533802f, 0.936875582f},
-std::array<float,2>{0.0709643289f, 0.329554915f},
-std::array<float,2>{0.433658421f, 0.715330124f},
-std::array<float,2>{0.8799178f, 0.0100058103f},
-std::array<float,2>{0.9814713f, 0.923794806f},
-std::array<float,2>{0.492199689f, 0.339632928f},
-std::array<float,2>{0.0417347699f, 0.709724307f},
-std::array<float,2>{0.587360978f, 0.00545288436f},
-std::array<float,2>{0.720771194f, 0.547678769f},
-std::array<float,2>{0.240017816f, 0.20818615f},
-std::array<float,2>{0.331913859f, 0.834937096f},
-std::array<float,2>{0.816508234f, 0.492792904f},
-std::array<float,2>{0.801155448f, 0.627754867f},
-std::array<float,2>{0.29307428f, 0.119897202f},
-std::array<float,2>{0.175538257f, 0.976220965f},
-std::array<float,2>{0.682235122f, 0.262289405f},
-std::array<float,2>{0.515977621f, 0.778040111f},
-std::array<float,2>{0.0792379975f, 0.427852511f},
-std::array<float,2>{0.412611961f, 0.589885652f},
-std::array<float,2>{0.899734735f, 0.141068071f},
-std::array<float,2>{0.861518085f, 0.870490611f},
-std::array<float,2>{0.352176517f, 0.440885574f},
-std::array<float,2>{0.217882916f, 0.517712653f},
-std::array<float,2>{0.714183807f, 0.232256949f},
-std::array<float,2>{0.603090525f, 0.726936996f},
-std::array<float,2>{0.0100276573f, 0.0375878587f},
-std::array<float,2>{0.453011185f, 0.88633281f},
-std::array<float,2>{0.954852283f, 0.366503358f},
-std::array<float,2>{0.920299709f, 0.609028161f},
-std::array<float,2>{0.398258954f, 0.170560449f},
-std::array<float,2>{0.103230059f, 0.79423362f},
-std::array<float,2>{0.54613477f, 0.399184495f},
-std::array<float,2>{0.640098453f, 0.940462947f},
-std::array<float,2>{0.14617829f, 0.302489311f},
-std::array<float,2>{0.257930368f, 0.668708265f},
-std::array<float,2>{0.753723383f, 0.0726256296f},
-std::array<float,2>{0.768490732f, 0.99933511f},
-std::array<float,2>{0.273713231f, 0.270597517f},
-std::array<float,2>{0.137959734f, 0.648032904f},
-std::array<float,2>{0.649361014f, 0.0949474275f},
-std::array<float,2>{0.559750259f, 0.564175129f},
-std::array<float,2>{0.115535915f, 0.126615763f},
-std::array<float,2>{0.384518951f, 0.750530183f},
-std::array<float,2>{0.928411603f, 0.416286975f},
-std::array<float,2>{0.938981652f, 0.702661276f},
-std::array<float,2>{0.454409152f, 0.0213962961f},
-std::array<float,2>{0.0248535387f, 0.911282241f},
-std::array<float,2>{0.614114165f, 0.315168023f},
-std::array<float,2>{0.687547028f, 0.813994706f},
-std::array<float,2>{0.189972311f, 0.469624639f},
-std::array<float,2>{0.370089054f, 0.54561162f},
-std::array<float,2>{0.848473191f, 0.189764678f},
-std::array<float,2>{0.876126587f, 0.804787159f},
-std::array<float,2>{0.431770831f, 0.375301152f},
-std::array<float,2>{0.0749039873f, 0.623160839f},
-std::array<float,2>{0.502083361f, 0.178111583f},
-std::array<float,2>{0.667388558f, 0.677776992f},
-std::array<float,2>{0.169188738f, 0.0809782743f},
-std::array<float,2>{0.302361995f, 0.961121917f},
-std::array<float,2>{0.793605924f, 0.284951061f},
-std::array<float,2>{0.828665435f, 0.50060147f},
-std::array<float,2>{0.317288756f, 0.248215437f},
-std::array<float,2>{0.220841557f, 0.858700633f},
-std::array<float,2>{0.742402732f, 0.464909881f},
-std::array<float,2>{0.570569992f, 0.892217577f},
-std::array<float,2>{0.0560394488f, 0.353116214f},
-std::array<float,2>{0.46891883f, 0.738103509f},
-std::array<float,2>{0.994514227f, 0.0553707778f},
-std::array<float,2>{0.934743166f, 0.95791322f},
-std::array<float,2>{0.376798749f, 0.293264568f},
-std::array<float,2>{0.118620716f, 0.687227011f},
-std::array<float,2>{0.553748727f, 0.0933063999f},
-std::array<float,2>{0.643851876f, 0.610446393f},
-std::array<float,2>{0.130034491f, 0.182753414f},
-std::array<float,2>{0.271146029f, 0.803668797f},
-std::array<float,2>{0.778745115f, 0.383693457f},
-std::array<float,2>{0.858484745f, 0.74712497f},
-std::array<float,2>{0.361793697f, 0.0481126644f},
-std::array<float,2>{0.202763587f, 0.90294534f},
-std::array<float,2>{0.696184456f, 0.347877473f},
-std::array<float,2>{0.622849941f, 0.849591494f},
-std::array<float,2>{0.0202819109f, 0.455994189f},
-std::array<float,2>{0.465902776f, 0.51352483f},
-std::array<float,2>{0.953107834f, 0.238363504f},
-std::array<float,2>{0.788190663f, 0.759424031f},
-std::array<float,2>{0.307916254f, 0.406567425f},
-std::array<float,2>{0.160702273f, 0.570628405f},
-std::array<float,2>{0.660113156f, 0.139658764f},
-std::array<float,2>{0.513365507f, 0.652227461f},
-std::array<float,2>{0.0660878718f, 0.104234882f},
-std::array<float,2>{0.424849868f, 0.988923252f},
-std::array<float,2>{0.884630442f, 0.273812085f},
-std::array<float,2>{0.986328721f, 0.532676697f},
-std::array<float,2>{0.480861902f, 0.200346798f},
-std::array<float,2>{0.0504207499f, 0.825784445f},
-std::array<float,2>{0.565365553f, 0.481044054f},
-std::array<float,2>{0.737289786f, 0.918785691f},
-std::array<float,2>{0.234034106f, 0.322159559f},
-std::array<float,2>{0.321140796f, 0.689708412f},
-std::array<float,2>{0.840208113f, 0.0266202632f},
-std::array<float,2>{0.826229334f, 0.881741285f},
-std::array<float,2>{0.343612105f, 0.374171942f},
-std::array<float,2>{0.24637945f, 0.726378143f},
-std::array<float,2>{0.73226577f, 0.045431003f},
-std::array<float,2>{0.579485416f, 0.528949142f},
-std::array<float,2>{0.0325952061f, 0.223297939f},
-std::array<float,2>{0.490791053f, 0.863525808f},
-std::array<float,2>{0.96964848f, 0.451739222f},
-std::array<float,2>{0.897290707f, 0.660566688f},
-std::array<float,2>{0.417464077f, 0.0625292957f},
-std::array<float,2>{0.0935750678f, 0.949927151f},
-std::array<float,2>{0.529212654f, 0.308145553f},
-std::array<float,2>{0.675314188f, 0.782691896f},
-std::array<float,2>{0.183322385f, 0.393929213f},
-std::array<float,2>{0.287296057f, 0.595031917f},
-std::array<float,2>{0.805407643f, 0.159670979f},
-std::array<float,2>{0.964750946f, 0.84001416f},
-std::array<float,2>{0.443730146f, 0.488786668f},
-std::array<float,2>{0.00675660279f, 0.560063183f},
-std::array<float,2>{0.599485338f, 0.218036652f},
-std::array<float,2>{0.704262853f, 0.714376271f},
-std::array<float,2>{0.203867912f, 0.0151341213f},
-std::array<float,2>{0.349601418f, 0.932711959f},
-std::array<float,2>{0.870231509f, 0.332458526f},
-std::array<float,2>{0.762741625f, 0.579157174f},
-std::array<float,2>{0.25682801f, 0.154639587f},
-std::array<float,2>{0.152896553f, 0.771647274f},
-std::array<float,2>{0.631715059f, 0.436561018f},
-std::array<float,2>{0.538404822f, 0.97843045f},
-std::array<float,2>{0.0999704599f, 0.251900762f},
-std::array<float,2>{0.401057124f, 0.638118625f},
-std::array<float,2>{0.910995662f, 0.110112093f},
-std::array<float,2>{0.999299407f, 0.980936825f},
-std::array<float,2>{0.475340784f, 0.256504655f},
-std::array<float,2>{0.0612511858f, 0.634358644f},
-std::array<float,2>{0.57699728f, 0.115808047f},
-std::array<float,2>{0.749455214f, 0.583681643f},
-std::array<float,2>{0.225288823f, 0.150826275f},
-std::array<float,2>{0.315990686f, 0.767458379f},
-std::array<float,2>{0.834484279f, 0.432137042f},
-std::array<float,2>{0.792905629f, 0.715350866f},
-std::array<float,2>{0.298503637f, 0.0105411531f},
-std::array<float,2>{0.16600965f, 0.93725419f},
-std::array<float,2>{0.671277642f, 0.329990387f},
-std::array<float,2>{0.505089402f, 0.836386204f},
-std::array<float,2>{0.0729138181f, 0.485966176f},
-std::array<float,2>{0.437019289f, 0.557008862f},
-std::array<float,2>{0.881766796f, 0.213304117f},
-std::array<float,2>{0.845354319f, 0.786359549f},
-std::array<float,2>{0.373463631f, 0.3954449f},
-std::array<float,2>{0.194893479f, 0.60128969f},
-std::array<float,2>{0.692509353f, 0.16092746f},
-std::array<float,2>{0.612075269f, 0.658404052f},
-std::array<float,2>{0.02945989f, 0.0689710379f},
-std::array<float,2>{0.460694373f, 0.945841312f},
-std::array<float,2>{0.942159832f, 0.309102982f},
-std::array<float,2>{0.924587727f, 0.523872733f},
-std::array<float,2>{0.389553338f, 0.220188543f},
-std::array<float,2>{0.112875491f, 0.862122476f},
-std::array<float,2>{0.556673288f, 0.447649956f},
-std::array<float,2>{0.652967989f, 0.877907038f},
-std::array<float,2>{0.136354268f, 0.368439555f},
-std::array<float,2>{0.279388875f, 0.720267653f},
-std::array<float,2>{0.771962285f, 0.039170146f},
-std::array<float,2>{0.755863249f, 0.914644539f},
-std::array<float,2>{0.265577734f, 0.326224864f},
-std::array<float,2>{0.144155562f, 0.691552162f},
-std::array<float,2>{0.63489151f, 0.0285067018f},
-std::array<float,2>{0.539281785f, 0.536420643f},
-std::array<float,2>{0.107217871f, 0.198044285f},
-std::array<float,2>{0.391711801f, 0.8208341f},
-std::array<float,2>{0.91756624f, 0.479699343f},
-std::array<float,2>{0.959699273f, 0.654265046f},
-std::array<float,2>{0.447913677f, 0.108456098f},
-std::array<float,2>{0.0146294395f, 0.98527199f},
-std::array<float,2>{0.606770039f, 0.278845251f},
-std::array<float,2>{0.716139793f, 0.764551699f},
-std::array<float,2>{0.212582201f, 0.412663847f},
-std::array<float,2>{0.356986046f, 0.576227486f},
-std::array<float,2>{0.864303231f, 0.136289269f},
-std::array<float,2>{0.906082988f, 0.844213188f},
-std::array<float,2>{0.408325285f, 0.459159583f},
-std::array<float,2>{0.0849287957f, 0.508038223f},
-std::array<float,2>{0.520801485f, 0.238132372f},
-std::array<float,2>{0.683676064f, 0.744636655f},
-std::array<float,2>{0.176317155f, 0.0544027649f},
-std::array<float,2>{0.292211026f, 0.901194036f},
-std::array<float,2>{0.798709512f, 0.346402258f},
-std::array<float,2>{0.813100815f, 0.613981307f},
-std::array<float,2>{0.33344388f, 0.183932379f},
-std::array<float,2>{0.235085651f, 0.800631344f},
-std::array<float,2>{0.726217508f, 0.387073696f},
-std::array<float,2>{0.592561185f, 0.954184651f},
-std::array<float,2>{0.044330366f, 0.290439874f},
-std::array<float,2>{0.497542769f, 0.681286097f},
-std::array<float,2>{0.977303743f, 0.0880252793f},
-std::array<float,2>{0.909540713f, 0.895569146f},
-std::array<float,2>{0.40315944f, 0.355902821f},
-std::array<float,2>{0.0939302221f, 0.74070555f},
-std::array<float,2>{0.531881571f, 0.0612014569f},
-std::array<float,2>{0.626281083f, 0.504235625f},
-std::array<float,2>{0.150007665f, 0.243379354f},
-std::array<float,2>{0.250451416f, 0.85294044f},
-std::array<float,2>{0.759820819f, 0.464764982f},
-std::array<float,2>{0.872304201f, 0.672345102f},
-std::array<float,2>{0.347385079f, 0.0833852142f},
-std::array<float,2>{0.208939165f, 0.967464745f},
-std::array<float,2>{0.709204674f, 0.287496656f},
-std::array<float,2>{0.595849037f, 0.811968386f},
-std::array<float,2>{0.00141030096f, 0.380146116f},
-std::array<float,2>{0.441166013f, 0.618811429f},
-std::array<float,2>{0.966017306f, 0.172794878f},
-std::array<float,2>{0.809628248f, 0.818386674f},
-std::array<float,2>{0.283664882f, 0.473123133f},
-std::array<float,2>{0.186225057f, 0.54236573f},
-std::array<float,2>{0.677939653f, 0.194536909f},
-std::array<float,2>{0.526505172f, 0.69825536f},
-std::array<float,2>{0.0860556513f, 0.019136833f},
-std::array<float,2>{0.41867882f, 0.907181561f},
-std::array<float,2>{0.894194484f, 0.317242056f},
-std::array<float,2>{0.9726668f, 0.568701506f},
-std::array<float,2>{0.486511767f, 0.131661326f},
-std::array<float,2>{0.038854301f, 0.754041374f},
-std::array<float,2>{0.584133089f, 0.419655293f},
-std::array<float,2>{0.729548752f, 0.994804919f},
-std::array<float,2>{0.243128255f, 0.266635746f},
-std::array<float,2>{0.338645041f, 0.642350376f},
-std::array<float,2>{0.822319388f, 0.0983887091f},
-std::array<float,2>{0.836663067f, 0.945304275f},
-std::array<float,2>{0.326045096f, 0.29884696f},
-std::array<float,2>{0.228254005f, 0.66627115f},
-std::array<float,2>{0.738357365f, 0.0771603063f},
-std::array<float,2>{0.568952382f, 0.604571819f},
-std::array<float,2>{0.0527910478f, 0.167227432f},
-std::array<float,2>{0.477415413f, 0.791652203f},
-std::array<float,2>{0.990637958f, 0.404195011f},
-std::array<float,2>{0.888388753f, 0.731148422f},
-std::array<float,2>{0.428996593f, 0.0331898443f},
-std::array<float,2>{0.0697600618f, 0.889249265f},
-std::array<float,2>{0.511285901f, 0.360681862f},
-std::array<float,2>{0.663062811f, 0.873686671f},
-std::array<float,2>{0.157999769f, 0.444491565f},
-std::array<float,2>{0.311023206f, 0.519923925f},
-std::array<float,2>{0.785060287f, 0.230213344f},
-std::array<float,2>{0.946861207f, 0.773639739f},
-std::array<float,2>{0.464752555f, 0.423448682f},
-std::array<float,2>{0.0181101691f, 0.58982408f},
-std::array<float,2>{0.617471457f, 0.147597775f},
-std::array<float,2>{0.699666202f, 0.62903744f},
-std::array<float,2>{0.195944771f, 0.12390659f},
-std::array<float,2>{0.364306539f, 0.97152251f},
-std::array<float,2>{0.852433801f, 0.259727955f},
-std::array<float,2>{0.774722099f, 0.551457703f},
-std::array<float,2>{0.26915291f, 0.206737548f},
-std::array<float,2>{0.125696927f, 0.829883575f},
-std::array<float,2>{0.644966364f, 0.499309808f},
-std::array<float,2>{0.548098147f, 0.929404914f},
-std::array<float,2>{0.124061562f, 0.340894938f},
-std::array<float,2>{0.379217327f, 0.703174174f},
-std::array<float,2>{0.930903971f, 0.00159654289f},
-std::array<float,2>{0.961783528f, 0.933128536f},
-std::array<float,2>{0.442420691f, 0.332925409f},
-std::array<float,2>{0.00482534524f, 0.713869095f},
-std::array<float,2>{0.599653959f, 0.0153642111f},
-std::array<float,2>{0.705380261f, 0.559993982f},
-std::array<float,2>{0.205528036f, 0.218442142f},
-std::array<float,2>{0.350115508f, 0.840617657f},
-std::array<float,2>{0.867736816f, 0.488301009f},
-std::array<float,2>{0.7655617f, 0.638332665f},
-std::array<float,2>{0.254811734f, 0.109608725f},
-std::array<float,2>{0.154761329f, 0.977918088f},
-std::array<float,2>{0.630041122f, 0.251000106f},
-std::array<float,2>{0.535384238f, 0.772370756f},
-std::array<float,2>{0.0977187008f, 0.43729195f},
-std::array<float,2>{0.399496108f, 0.580028057f},
-std::array<float,2>{0.913833022f, 0.155061886f},
-std::array<float,2>{0.825297177f, 0.8640517f},
-std::array<float,2>{0.340834498f, 0.451552927f},
-std::array<float,2>{0.248366401f, 0.528406084f},
-std::array<float,2>{0.732689321f, 0.222666949f},
-std::array<float,2>{0.581545174f, 0.725597441f},
-std::array<float,2>{0.0344557166f, 0.0449969284f},
-std::array<float,2>{0.489936084f, 0.880909503f},
-std::array<float,2>{0.971385479f, 0.37458986f},
-std::array<float,2>{0.896403074f, 0.595615864f},
-std::array<float,2>{0.414867282f, 0.159571558f},
-std::array<float,2>{0.0899972767f, 0.782797575f},
-std::array<float,2>{0.530649185f, 0.394265711f},
-std::array<float,2>{0.673656344f, 0.94926548f},
-std::array<float,2>{0.179785937f, 0.307932138f},
-std::array<float,2>{0.286106765f, 0.661026239f},
-std::array<float,2>{0.806715965f, 0.0633652657f},
-std::array<float,2>{0.786025643f, 0.988509119f},
-std::array<float,2>{0.305596948f, 0.274335921f},
-std::array<float,2>{0.162560999f, 0.651519716f},
-std::array<float,2>{0.656576455f, 0.103992507f},
-std::array<float,2>{0.51453054f, 0.570995629f},
-std::array<float,2>{0.0634286925f, 0.14028202f},
-std::array<float,2>{0.422128528f, 0.758911073f},
-std::array<float,2>{0.885589838f, 0.406944394f},
-std::array<float,2>{0.985950053f, 0.690331936f},
-std::array<float,2>{0.483511388f, 0.0270994212f},
-std::array<float,2>{0.0480925776f, 0.918398798f},
-std::array<float,2>{0.562937379f, 0.321547717f},
-std::array<float,2>{0.736140609f, 0.825405002f},
-std::array<float,2>{0.231745034f, 0.480746895f},
-std::array<float,2>{0.322401792f, 0.533198178f},
-std::array<float,2>{0.843521476f, 0.200748309f},
-std::array<float,2>{0.935548425f, 0.80283159f},
-std::array<float,2>{0.378481656f, 0.383093297f},
-std::array<float,2>{0.120860785f, 0.61086148f},
-std::array<float,2>{0.551046312f, 0.183431759f},
-std::array<float,2>{0.642169535f, 0.686573327f},
-std::array<float,2>{0.131694987f, 0.0928152874f},
-std::array<float,2>{0.272700548f, 0.957161069f},
-std::array<float,2>{0.780226827f, 0.293469846f},
-std::array<float,2>{0.855628967f, 0.512862325f},
-std::array<float,2>{0.360049635f, 0.23880218f},
-std::array<float,2>{0.200150728f, 0.848649979f},
-std::array<float,2>{0.697896361f, 0.455213726f},
-std::array<float,2>{0.623606622f, 0.902790487f},
-std::array<float,2>{0.0231330432f, 0.348383427f},
-std::array<float,2>{0.468173832f, 0.747680306f},
-std::array<float,2>{0.950987816f, 0.0483429283f},
-std::array<float,2>{0.87743783f, 0.961747885f},
-std::array<float,2>{0.430513144f, 0.284512967f},
-std::array<float,2>{0.0778384432f, 0.678384125f},
-std::array<float,2>{0.500574052f, 0.0803159997f},
-std::array<float,2>{0.664625645f, 0.623945594f},
-std::array<float,2>{0.170050785f, 0.178474545f},
-std::array<float,2>{0.302879512f, 0.805490375f},
-std::array<float,2>{0.796872199f, 0.375849903f},
-std::array<float,2>{0.831525981f, 0.737689912f},
-std::array<float,2>{0.318600833f, 0.05495793f},
-std::array<float,2>{0.220107079f, 0.891690493f},
-std::array<float,2>{0.745836079f, 0.352756292f},
-std::array<float,2>{0.572643936f, 0.859294295f},
-std::array<float,2>{0.0577277616f, 0.465538979f},
-std::array<float,2>{0.471748292f, 0.500210643f},
-std::array<float,2>{0.992242336f, 0.248948276f},
-std::array<float,2>{0.766903937f, 0.750367165f},
-std::array<float,2>{0.276570171f, 0.41663155f},
-std::array<float,2>{0.139273837f, 0.563509464f},
-std::array<float,2>{0.651346803f, 0.126264185f},
-std::array<float,2>{0.561657965f, 0.647525609f},
-std::array<float,2>{0.1137361f, 0.0954714417f},
-std::array<float,2>{0.386500508f, 0.999965668f},
-std::array<float,2>{0.92751646f, 0.271157771f},
-std::array<float,2>{0.939763486f, 0.544958234f},
-std::array<float,2>{0.456238449f, 0.189967558f},
-std::array<float,2>{0.0263310242f, 0.813627481f},
-std::array<float,2>{0.616548181f, 0.468998432f},
-std::array<float,2>{0.689575732f, 0.911940336f},
-std::array<float,2>{0.187986627f, 0.31471321f},
-std::array<float,2>{0.367667258f, 0.702503383f},
-std::array<float,2>{0.850814939f, 0.0207998343f},
-std::array<float,2>{0.860505044f, 0.886176169f},
-std::array<float,2>{0.354303658f, 0.366753846f},
-std::array<float,2>{0.216523275f, 0.727524579f},
-std::array<float,2>{0.711550236f, 0.0380820744f},
-std::array<float,2>{0.603584588f, 0.518374026f},
-std::array<float,2>{0.00864209142f, 0.231817678f},
-std::array<float,2>{0.449843377f, 0.870942235f},
-std::array<float,2>{0.955182314f, 0.440948576f},
-std::array<float,2>{0.918932796f, 0.667989135f},
-std::array<float,2>{0.394731224f, 0.0731553063f},
-std::array<float,2>{0.105279513f, 0.941399992f},
-std::array<float,2>{0.543165445f, 0.301801682f},
-std::array<float,2>{0.638032079f, 0.794461489f},
-std::array<float,2>{0.147402734f, 0.398755312f},
-std::array<float,2>{0.261167347f, 0.608596146f},
-std::array<float,2>{0.75170064f, 0.169926181f},
-std::array<float,2>{0.983584881f, 0.834290147f},
-std::array<float,2>{0.494712144f, 0.492305338f},
-std::array<float,2>{0.0406185016f, 0.547044516f},
-std::array<float,2>{0.588935256f, 0.208705023f},
-std::array<float,2>{0.720417738f, 0.709010482f},
-std::array<float,2>{0.24161841f, 0.00518420758f},
-std::array<float,2>{0.330063045f, 0.92293179f},
-std::array<float,2>{0.818805337f, 0.339092672f},
-std::array<float,2>{0.802928209f, 0.590814352f},
-std::array<float,2>{0.296375066f, 0.141390309f},
-std::array<float,2>{0.173160538f, 0.777377129f},
-std::array<float,2>{0.680369079f, 0.428341329f},
-std::array<float,2>{0.519262552f, 0.975803494f},
-std::array<float,2>{0.0805764645f, 0.261849493f},
-std::array<float,2>{0.411378801f, 0.627249956f},
-std::array<float,2>{0.90214771f, 0.11936181f},
-std::array<float,2>{0.943950355f, 0.949139893f},
-std::array<float,2>{0.457254022f, 0.311456621f},
-std::array<float,2>{0.0283356868f, 0.656360388f},
-std::array<float,2>{0.610111535f, 0.0668500215f},
-std::array<float,2>{0.693737984f, 0.59858644f},
-std::array<float,2>{0.192213684f, 0.163548097f},
-std::array<float,2>{0.372943848f, 0.788129747f},
-std::array<float,2>{0.846396208f, 0.396906495f},
-std::array<float,2>{0.770816207f, 0.722334325f},
-std::array<float,2>{0.278062612f, 0.0423676074f},
-std::array<float,2>{0.134467229f, 0.875119686f},
-std::array<float,2>{0.655868411f, 0.370221436f},
-std::array<float,2>{0.555943429f, 0.860409558f},
-std::array<float,2>{0.110722169f, 0.446372449f},
-std::array<float,2>{0.387160391f, 0.527057588f},
-std::array<float,2>{0.92317301f, 0.221808672f},
-std::array<float,2>{0.833397269f, 0.768196702f},
-std::array<float,2>{0.312741131f, 0.430785507f},
-std::array<float,2>{0.223336384f, 0.584687412f},
-std::array<float,2>{0.74767673f, 0.149619818f},
-std::array<float,2>{0.575717807f, 0.634798288f},
-std::array<float,2>{0.0602931753f, 0.114902712f},
-std::array<float,2>{0.473301113f, 0.983986437f},
-std::array<float,2>{0.996986032f, 0.254458874f},
-std::array<float,2>{0.88046366f, 0.555348396f},
-std::array<float,2>{0.434359998f, 0.212844804f},
-std::array<float,2>{0.0706472993f, 0.838429987f},
-std::array<float,2>{0.506342411f, 0.487047315f},
-std::array<float,2>{0.668655396f, 0.934977829f},
-std::array<float,2>{0.166285172f, 0.330709398f},
-std::array<float,2>{0.299916685f, 0.716877222f},
-std::array<float,2>{0.789601743f, 0.00951568782f},
-std::array<float,2>{0.799056649f, 0.898922265f},
-std::array<float,2>{0.289578646f, 0.345313191f},
-std::array<float,2>{0.17840597f, 0.743097901f},
-std::array<float,2>{0.686251283f, 0.0515011176f},
-std::array<float,2>{0.523030162f, 0.509790719f},
-std::array<float,2>{0.0833552182f, 0.234724253f},
-std::array<float,2>{0.407986641f, 0.846716642f},
-std::array<float,2>{0.903091729f, 0.458372176f},
-std::array<float,2>{0.978758574f, 0.682399452f},
-std::array<float,2>{0.499207586f, 0.0874696076f},
-std::array<float,2>{0.046725519f, 0.956546903f},
-std::array<float,2>{0.591467977f, 0.292077988f},
-std::array<float,2>{0.723403215f, 0.798075616f},
-std::array<float,2>{0.2380777f, 0.389559448f},
-std::array<float,2>{0.334334046f, 0.616084695f},
-std::array<float,2>{0.816015184f, 0.185590506f},
-std::array<float,2>{0.914705396f, 0.823813438f},
-std::array<float,2>{0.39313522f, 0.478281617f},
-std::array<float,2>{0.107650824f, 0.538853824f},
-std::array<float,2>{0.541060984f, 0.196166769f},
-std::array<float,2>{0.633468807f, 0.693606257f},
-std::array<float,2>{0.141309604f, 0.0293550286f},
-std::array<float,2>{0.262749046f, 0.916572392f},
-std::array<float,2>{0.753938258f, 0.324500531f},
-std::array<float,2>{0.866320312f, 0.576167703f},
-std::array<float,2>{0.357506156f, 0.133226827f},
-std::array<float,2>{0.213870943f, 0.762806058f},
-std::array<float,2>{0.718581378f, 0.410201371f},
-std::array<float,2>{0.608365595f, 0.987269044f},
-std::array<float,2>{0.0132963816f, 0.280741066f},
-std::array<float,2>{0.446416944f, 0.656166077f},
-std::array<float,2>{0.958874345f, 0.105591714f},
-std::array<float,2>{0.892184913f, 0.909655988f},
-std::array<float,2>{0.42018792f, 0.320260167f},
-std::array<float,2>{0.0898333639f, 0.696750462f},
-std::array<float,2>{0.524012625f, 0.0173361246f},
-std::array<float,2>{0.676488519f, 0.539093912f},
-std::array<float,2>{0.184002683f, 0.192421511f},
-std::array<float,2>{0.282544553f, 0.816800416f},
-std::array<float,2>{0.811755359f, 0.475741237f},
-std::array<float,2>{0.820668221f, 0.643293202f},
-std::array<float,2>{0.336699396f, 0.101294868f},
-std::array<float,2>{0.245372832f, 0.993641198f},
-std::array<float,2>{0.727862895f, 0.268690169f},
-std::array<float,2>{0.583601236f, 0.757359385f},
-std::array<float,2>{0.0359023027f, 0.420817018f},
-std::array<float,2>{0.484850675f, 0.56729579f},
-std::array<float,2>{0.976195931f, 0.13067387f},
-std::array<float,2>{0.759364843f, 0.853846967f},
-std::array<float,2>{0.253422856f, 0.461410761f},
-std::array<float,2>{0.151066795f, 0.506542802f},
-std::array<float,2>{0.628486574f, 0.244402289f},
-std::array<float,2>{0.534611404f, 0.739485085f},
-std::array<float,2>{0.0959696695f, 0.0603461713f},
-std::array<float,2>{0.405352145f, 0.896935642f},
-std::array<float,2>{0.907482564f, 0.358079135f},
-std::array<float,2>{0.968383849f, 0.619771779f},
-std::array<float,2>{0.439216763f, 0.174741611f},
-std::array<float,2>{0.00335956272f, 0.808803558f},
-std::array<float,2>{0.594347894f, 0.38132605f},
-std::array<float,2>{0.70778966f, 0.965349376f},
-std::array<float,2>{0.210393786f, 0.286118627f},
-std::array<float,2>{0.345433325f, 0.674981058f},
-std::array<float,2>{0.873787999f, 0.0850783139f},
-std::array<float,2>{0.855438292f, 0.96958822f},
-std::array<float,2>{0.367104471f, 0.260284007f},
-std::array<float,2>{0.198136449f, 0.631636381f},
-std::array<float,2>{0.701354682f, 0.122380823f},
-std::array<float,2>{0.620313346f, 0.587860823f},
-std::array<float,2>{0.0158833154f, 0.145940647f},
-std::array<float,2>{0.462480903f, 0.777066112f},
-std::array<float,2>{0.948660672f, 0.423841f},
-std::array<float,2>{0.931693852f, 0.706779718f},
-std::array<float,2>{0.382485956f, 0.00348959747f},
-std::array<float,2>{0.122173674f, 0.926790774f},
-std::array<float,2>{0.549394011f, 0.342883766f},
-std::array<float,2>{0.646842718f, 0.831484079f},
-std::array<float,2>{0.127414793f, 0.496835351f},
-std::array<float,2>{0.267046809f, 0.554038584f},
-std::array<float,2>{0.77611953f, 0.204074904f},
-std::array<float,2>{0.990168989f, 0.790546596f},
-std::array<float,2>{0.480012268f, 0.405693799f},
-std::array<float,2>{0.0519565828f, 0.603264391f},
-std::array<float,2>{0.56645602f, 0.164193586f},
-std::array<float,2>{0.740560591f, 0.665442467f},
-std::array<float,2>{0.229208484f, 0.0745695457f},
-std::array<float,2>{0.327152848f, 0.942878306f},
-std::array<float,2>{0.838495791f, 0.297074497f},
-std::array<float,2>{0.782253265f, 0.52182132f},
-std::array<float,2>{0.30989626f, 0.227806002f},
-std::array<float,2>{0.159622118f, 0.87156713f},
-std::array<float,2>{0.660595f, 0.441709638f},
-std::array<float,2>{0.50911051f, 0.887019932f},
-std::array<float,2>{0.0675231516f, 0.363148868f},
-std::array<float,2>{0.426343381f, 0.734241784f},
-std::array<float,2>{0.889734685f, 0.0333212055f},
-std::array<float,2>{0.969212115f, 0.87910533f},
-std::array<float,2>{0.490606904f, 0.372857273f},
-std::array<float,2>{0.0328637175f, 0.723788857f},
-std::array<float,2>{0.579713106f, 0.0433313847f},
-std::array<float,2>{0.731556296f, 0.530965567f},
-std::array<float,2>{0.246593431f, 0.225783408f},
-std::array<float,2>{0.343198061f, 0.865522385f},
-std::array<float,2>{0.8269732f, 0.449596554f},
-std::array<float,2>{0.804753721f, 0.663761735f},
-std::array<float,2>{0.287759006f, 0.0648704097f},
-std::array<float,2>{0.182669759f, 0.952463865f},
-std::array<float,2>{0.674968302f, 0.305078834f},
-std::array<float,2>{0.528634727f, 0.784418523f},
-std::array<float,2>{0.0928645805f, 0.390930027f},
-std::array<float,2>{0.417608291f, 0.596850634f},
-std::array<float,2>{0.896815479f, 0.158098876f},
-std::array<float,2>{0.870740891f, 0.84281683f},
-std::array<float,2>{0.348639816f, 0.49064061f},
-std::array<float,2>{0.203581139f, 0.560775459f},
-std::array<float,2>{0.705055535f, 0.216776237f},
-std::array<float,2>{0.598832667f, 0.711479306f},
-std::array<float,2>{0.00608814601f, 0.0124849202f},
-std::array<float,2>{0.444224745f, 0.930856645f},
-std::array<float,2>{0.964227378f, 0.334974319f},
-std::array<float,2>{0.910255313f, 0.580193877f},
-std::array<float,2>{0.400537431f, 0.153153345f},
-std::array<float,2>{0.10035973f, 0.769887805f},
-std::array<float,2>{0.538746178f, 0.434327602f},
-std::array<float,2>{0.631255627f, 0.97912401f},
-std::array<float,2>{0.152484044f, 0.253659189f},
-std::array<float,2>{0.255946547f, 0.639008939f},
-std::array<float,2>{0.763486564f, 0.112124868f},
-std::array<float,2>{0.778944433f, 0.959697008f},
-std::array<float,2>{0.270765692f, 0.295613974f},
-std::array<float,2>{0.130824178f, 0.684749961f},
-std::array<float,2>{0.644121647f, 0.0911943242f},
-std::array<float,2>{0.55450654f, 0.611586988f},
-std::array<float,2>{0.118680783f, 0.180363372f},
-std::array<float,2>{0.376419723f, 0.80083406f},
-std::array<float,2>{0.935473025f, 0.385324121f},
-std::array<float,2>{0.952405691f, 0.749458909f},
-std::array<float,2>{0.466461807f, 0.049481336f},
-std::array<float,2>{0.0198369753f, 0.905375719f},
-std::array<float,2>{0.622157514f, 0.35090217f},
-std::array<float,2>{0.695557356f, 0.850207269f},
-std::array<float,2>{0.202284724f, 0.454886019f},
-std::array<float,2>{0.362189919f, 0.514301419f},
-std::array<float,2>{0.85889554f, 0.241458803f},
-std::array<float,2>{0.883871973f, 0.760753989f},
-std::array<float,2>{0.425400883f, 0.408462197f},
-std::array<float,2>{0.0656244904f, 0.573967874f},
-std::array<float,2>{0.51308006f, 0.138541535f},
-std::array<float,2>{0.659359932f, 0.649105251f},
-std::array<float,2>{0.160377994f, 0.102797799f},
-std::array<float,2>{0.308243185f, 0.990882933f},
-std::array<float,2>{0.788742661f, 0.275865942f},
-std::array<float,2>{0.840779364f, 0.533767939f},
-std::array<float,2>{0.320429355f, 0.201998606f},
-std::array<float,2>{0.233444318f, 0.827509284f},
-std::array<float,2>{0.736725986f, 0.483693123f},
-std::array<float,2>{0.564739287f, 0.920954585f},
-std::array<float,2>{0.0502374694f, 0.322959185f},
-std::array<float,2>{0.481412292f, 0.688436091f},
-std::array<float,2>{0.986933827f, 0.0248118434f},
-std::array<float,2>{0.928095758f, 0.99705255f},
-std::array<float,2>{0.384161025f, 0.272836387f},
-std::array<float,2>{0.116158262f, 0.645744205f},
-std::array<float,2>{0.560530305f, 0.0964399651f},
-std::array<float,2>{0.648443043f, 0.566299796f},
-std::array<float,2>{0.138300106f, 0.127508149f},
-std::array<float,2>{0.274287403f, 0.753229558f},
-std::array<float,2>{0.767856658f, 0.415297151f},
-std::array<float,2>{0.848013282f, 0.700666487f},
-std::array<float,2>{0.369190663f, 0.0225251131f},
-std::array<float,2>{0.189625889f, 0.912219405f},
-std::array<float,2>{0.688137352f, 0.313705772f},
-std::array<float,2>{0.613563597f, 0.816283524f},
-std::array<float,2>{0.0253487229f, 0.471615702f},
-std::array<float,2>{0.454830289f, 0.543006957f},
-std::array<float,2>{0.938524544f, 0.188710287f},
-std::array<float,2>{0.793279171f, 0.807708025f},
-std::array<float,2>{0.301873803f, 0.378121942f},
-std::array<float,2>{0.169814199f, 0.62211895f},
-std::array<float,2>{0.667737901f, 0.17754294f},
-std::array<float,2>{0.502690136f, 0.676497877f},
-std::array<float,2>{0.074489221f, 0.0786307752f},
-std::array<float,2>{0.43234551f, 0.964511096f},
-std::array<float,2>{0.876857281f, 0.282188177f},
-std::array<float,2>{0.994935334f, 0.503650784f},
-std::array<float,2>{0.469596267f, 0.247859657f},
-std::array<float,2>{0.0561670735f, 0.855497599f},
-std::array<float,2>{0.570938706f, 0.466953337f},
-std::array<float,2>{0.742773175f, 0.893957973f},
-std::array<float,2>{0.221618548f, 0.354546428f},
-std::array<float,2>{0.316460758f, 0.734904766f},
-std::array<float,2>{0.828341424f, 0.0583362058f},
-std::array<float,2>{0.817104638f, 0.924940825f},
-std::array<float,2>{0.331331402f, 0.336681247f},
-std::array<float,2>{0.239429981f, 0.708697557f},
-std::array<float,2>{0.721244216f, 0.00595783954f},
-std::array<float,2>{0.587877691f, 0.549121857f},
-std::array<float,2>{0.0411680304f, 0.210069925f},
-std::array<float,2>{0.492969006f, 0.833470821f},
-std::array<float,2>{0.982014298f, 0.496047616f},
-std::array<float,2>{0.900264084f, 0.626583755f},
-std::array<float,2>{0.412194282f, 0.11901328f},
-std::array<float,2>{0.0797283575f, 0.972810566f},
-std::array<float,2>{0.516494393f, 0.265223384f},
-std::array<float,2>{0.682099044f, 0.780929327f},
-std::array<float,2>{0.175250903f, 0.427087009f},
-std::array<float,2>{0.293677419f, 0.592637837f},
-std::array<float,2>{0.801711082f, 0.143280238f},
-std::array<float,2>{0.954190314f, 0.868594825f},
-std::array<float,2>{0.452632993f, 0.438950717f},
-std::array<float,2>{0.0103960484f, 0.51733458f},
-std::array<float,2>{0.602613866f, 0.233558565f},
-std::array<float,2>{0.714790523f, 0.729351342f},
-std::array<float,2>{0.218427852f, 0.0359454602f},
-std::array<float,2>{0.351916224f, 0.883385599f},
-std::array<float,2>{0.862040162f, 0.363771379f},
-std::array<float,2>{0.753180206f, 0.606406152f},
-std::array<float,2>{0.25838539f, 0.16947116f},
-std::array<float,2>{0.145632088f, 0.795364439f},
-std::array<float,2>{0.640338421f, 0.40078637f},
-std::array<float,2>{0.546528697f, 0.938999653f},
-std::array<float,2>{0.102632925f, 0.303015083f},
-std::array<float,2>{0.397665799f, 0.670569718f},
-std::array<float,2>{0.920523643f, 0.0707499534f},
-std::array<float,2>{0.978410304f, 0.955766737f},
-std::array<float,2>{0.496944577f, 0.291670889f},
-std::array<float,2>{0.0434153005f, 0.682976305f},
-std::array<float,2>{0.593091667f, 0.0861020312f},
-std::array<float,2>{0.72482127f, 0.617184997f},
-std::array<float,2>{0.235447869f, 0.187075585f},
-std::array<float,2>{0.332247823f, 0.797388077f},
-std::array<float,2>{0.81363833f, 0.390470535f},
-std::array<float,2>{0.797487378f, 0.743258178f},
-std::array<float,2>{0.291664809f, 0.0526113063f},
-std::array<float,2>{0.17720598f, 0.899746001f},
-std::array<float,2>{0.685507178f, 0.344116598f},
-std::array<float,2>{0.520485759f, 0.846416593f},
-std::array<float,2>{0.0856397748f, 0.457198054f},
-std::array<float,2>{0.409946054f, 0.511305869f},
-std::array<float,2>{0.904530764f, 0.235647559f},
-std::array<float,2>{0.864161193f, 0.762677193f},
-std::array<float,2>{0.355469733f, 0.411919236f},
-std::array<float,2>{0.21096085f, 0.574832857f},
-std::array<float,2>{0.715442777f, 0.13431567f},
-std::array<float,2>{0.605774462f, 0.655263662f},
-std::array<float,2>{0.0148349311f, 0.106727704f},
-std::array<float,2>{0.448805362f, 0.987652183f},
-std::array<float,2>{0.960506678f, 0.27933681f},
-std::array<float,2>{0.916029394f, 0.537120759f},
-std::array<float,2>{0.391227692f, 0.196380779f},
-std::array<float,2>{0.106364042f, 0.822714627f},
-std::array<float,2>{0.54090023f, 0.47727108f},
-std::array<float,2>{0.636376977f, 0.917902827f},
-std::array<float,2>{0.143541038f, 0.325545371f},
-std::array<float,2>{0.264622867f, 0.694846213f},
-std::array<float,2>{0.757352173f, 0.0302946419f},
-std::array<float,2>{0.772487283f, 0.876116097f},
-std::array<float,2>{0.28073898f, 0.369640797f},
-std::array<float,2>{0.135683522f, 0.720911503f},
-std::array<float,2>{0.653961658f, 0.041289065f},
-std::array<float,2>{0.558468163f, 0.525712907f},
-std::array<float,2>{0.11189656f, 0.221544534f},
-std::array<float,2>{0.38989681f, 0.860341072f},
-std::array<float,2>{0.925300777f, 0.445934296f},
-std::array<float,2>{0.943047106f, 0.657265782f},
-std::array<float,2>{0.459066093f, 0.0681301877f},
-std::array<float,2>{0.0308702234f, 0.948171258f},
-std::array<float,2>{0.612516999f, 0.312151611f},
-std::array<float,2>{0.69224596f, 0.788029611f},
-std::array<float,2>{0.19390738f, 0.398342937f},
-std::array<float,2>{0.374684781f, 0.598791301f},
-std::array<float,2>{0.84467715f, 0.163054064f},
-std::array<float,2>{0.882625937f, 0.839305878f},
-std::array<float,2>{0.436266989f, 0.487818867f},
-std::array<float,2>{0.0735983402f, 0.556264102f},
-std::array<float,2>{0.504592061f, 0.211595044f},
-std::array<float,2>{0.670689523f, 0.717944682f},
-std::array<float,2>{0.164149657f, 0.00826725364f},
-std::array<float,2>{0.296882749f, 0.934125662f},
-std::array<float,2>{0.791171253f, 0.331562996f},
-std::array<float,2>{0.835382104f, 0.585554063f},
-std::array<float,2>{0.315102339f, 0.149053469f},
-std::array<float,2>{0.2259067f, 0.769478261f},
-std::array<float,2>{0.74849385f, 0.429695517f},
-std::array<float,2>{0.577257693f, 0.982756138f},
-std::array<float,2>{0.0615479946f, 0.255101502f},
-std::array<float,2>{0.476044565f, 0.636204958f},
-std::array<float,2>{0.998770475f, 0.113776378f},
-std::array<float,2>{0.93065542f, 0.926722646f},
-std::array<float,2>{0.380473346f, 0.342559963f},
-std::array<float,2>{0.123071752f, 0.705759466f},
-std::array<float,2>{0.546924293f, 0.00218233513f},
-std::array<float,2>{0.645867527f, 0.553203881f},
-std::array<float,2>{0.126666397f, 0.204978004f},
-std::array<float,2>{0.268107921f, 0.830159366f},
-std::array<float,2>{0.773739994f, 0.497103959f},
-std::array<float,2>{0.852968752f, 0.632698417f},
-std::array<float,2>{0.363413125f, 0.121333137f},
-std::array<float,2>{0.197169989f, 0.969894707f},
-std::array<float,2>{0.700544775f, 0.261424929f},
-std::array<float,2>{0.618653059f, 0.775972843f},
-std::array<float,2>{0.0186440032f, 0.425146312f},
-std::array<float,2>{0.463711828f, 0.586057365f},
-std::array<float,2>{0.945765793f, 0.144891798f},
-std::array<float,2>{0.783250213f, 0.872369826f},
-std::array<float,2>{0.311563402f, 0.442871451f},
-std::array<float,2>{0.157070771f, 0.522516847f},
-std::array<float,2>{0.663698196f, 0.227095217f},
-std::array<float,2>{0.510300994f, 0.732820451f},
-std::array<float,2>{0.0683961138f, 0.0343777873f},
-std::array<float,2>{0.428409368f, 0.888069212f},
-std::array<float,2>{0.887095153f, 0.361350834f},
-std::array<float,2>{0.991538405f, 0.602009177f},
-std::array<float,2>{0.478257716f, 0.165475175f},
-std::array<float,2>{0.0540648773f, 0.789176345f},
-std::array<float,2>{0.570129812f, 0.405230045f},
-std::array<float,2>{0.739531398f, 0.941531777f},
-std::array<float,2>{0.227424309f, 0.298379719f},
-std::array<float,2>{0.324586272f, 0.664955556f},
-std::array<float,2>{0.837362468f, 0.0757850558f},
-std::array<float,2>{0.82420361f, 0.992817163f},
-std::array<float,2>{0.339282215f, 0.267665386f},
-std::array<float,2>{0.243499681f, 0.643662095f},
-std::array<float,2>{0.728695333f, 0.0997119173f},
-std::array<float,2>{0.585536242f, 0.568180144f},
-std::array<float,2>{0.0377465934f, 0.129579544f},
-std::array<float,2>{0.488167554f, 0.755871296f},
-std::array<float,2>{0.974139631f, 0.421681583f},
-std::array<float,2>{0.893066883f, 0.696283877f},
-std::array<float,2>{0.419908494f, 0.0163670629f},
-std::array<float,2>{0.0871891156f, 0.908879936f},
-std::array<float,2>{0.525884449f, 0.318739712f},
-std::array<float,2>{0.678865194f, 0.818099022f},
-std::array<float,2>{0.186879486f, 0.475218654f},
-std::array<float,2>{0.284489065f, 0.540367126f},
-std::array<float,2>{0.809284031f, 0.192044631f},
-std::array<float,2>{0.965184331f, 0.809957564f},
-std::array<float,2>{0.439579278f, 0.382013977f},
-std::array<float,2>{0.000887171947f, 0.620176315f},
-std::array<float,2>{0.597364962f, 0.175739765f},
-std::array<float,2>{0.710408449f, 0.673844934f},
-std::array<float,2>{0.207371801f, 0.0841608718f},
-std::array<float,2>{0.346618056f, 0.966367304f},
-std::array<float,2>{0.87163651f, 0.286726594f},
-std::array<float,2>{0.760970652f, 0.507042944f},
-std::array<float,2>{0.251854211f, 0.24568595f},
-std::array<float,2>{0.148653015f, 0.85467279f},
-std::array<float,2>{0.625242412f, 0.462638229f},
-std::array<float,2>{0.532728434f, 0.898187935f},
-std::array<float,2>{0.0948573127f, 0.359016299f},
-std::array<float,2>{0.403798252f, 0.739027381f},
-std::array<float,2>{0.908219516f, 0.0588452332f},
-std::array<float,2>{0.949825764f, 0.904879332f},
-std::array<float,2>{0.46711278f, 0.349716902f},
-std::array<float,2>{0.0215675216f, 0.748241007f},
-std::array<float,2>{0.624513984f, 0.0498830304f},
-std::array<float,2>{0.698812246f, 0.51543045f},
-std::array<float,2>{0.200350612f, 0.241200313f},
-std::array<float,2>{0.360601306f, 0.85080719f},
-std::array<float,2>{0.85735625f, 0.453563601f},
-std::array<float,2>{0.781108558f, 0.684120774f},
-std::array<float,2>{0.272105575f, 0.0905500352f},
-std::array<float,2>{0.132699564f, 0.960622013f},
-std::array<float,2>{0.640826762f, 0.296759605f},
-std::array<float,2>{0.552419007f, 0.802505136f},
-std::array<float,2>{0.12002641f, 0.385858476f},
-std::array<float,2>{0.377414167f, 0.612689972f},
-std::array<float,2>{0.936719f, 0.181430846f},
-std::array<float,2>{0.842314363f, 0.82630986f},
-std::array<float,2>{0.324145854f, 0.482784241f},
-std::array<float,2>{0.230609387f, 0.534702599f},
-std::array<float,2>{0.734482765f, 0.202390775f},
-std::array<float,2>{0.564052463f, 0.688714921f},
-std::array<float,2>{0.0473718345f, 0.0240354091f},
-std::array<float,2>{0.482741416f, 0.920585632f},
-std::array<float,2>{0.98453778f, 0.323482424f},
-std::array<float,2>{0.885766268f, 0.572552323f},
-std::array<float,2>{0.422870159f, 0.136762157f},
-std::array<float,2>{0.0638666302f, 0.760480344f},
-std::array<float,2>{0.514862061f, 0.410015881f},
-std::array<float,2>{0.657579601f, 0.991239846f},
-std::array<float,2>{0.163639545f, 0.277047247f},
-std::array<float,2>{0.306088805f, 0.650237918f},
-std::array<float,2>{0.786642075f, 0.102419376f},
-std::array<float,2>{0.808410585f, 0.952113926f},
-std::array<float,2>{0.286564469f, 0.305776954f},
-std::array<float,2>{0.181576446f, 0.66255641f},
-std::array<float,2>{0.672220647f, 0.0662160516f},
-std::array<float,2>{0.529929578f, 0.596049786f},
-std::array<float,2>{0.0915747583f, 0.156795904f},
-std::array<float,2>{0.41587466f, 0.783342361f},
-std::array<float,2>{0.895069599f, 0.391721398f},
-std::array<float,2>{0.972303867f, 0.723497331f},
-std::array<float,2>{0.489202648f, 0.0440783612f},
-std::array<float,2>{0.0337529555f, 0.880277455f},
-std::array<float,2>{0.580639124f, 0.371711552f},
-std::array<float,2>{0.734135389f, 0.866734982f},
-std::array<float,2>{0.249237776f, 0.451165438f},
-std::array<float,2>{0.340573341f, 0.529920042f},
-std::array<float,2>{0.824982226f, 0.225180015f},
-std::array<float,2>{0.91260165f, 0.771343291f},
-std::array<float,2>{0.398684353f, 0.434685051f},
-std::array<float,2>{0.0987001583f, 0.581476092f},
-std::array<float,2>{0.536684096f, 0.153731048f},
-std::array<float,2>{0.629297435f, 0.639884472f},
-std::array<float,2>{0.155862376f, 0.112776764f},
-std::array<float,2>{0.255847454f, 0.980116546f},
-std::array<float,2>{0.764484346f, 0.252185792f},
-std::array<float,2>{0.869069934f, 0.561760604f},
-std::array<float,2>{0.350926936f, 0.215636462f},
-std::array<float,2>{0.206702322f, 0.841857135f},
-std::array<float,2>{0.706266701f, 0.491997778f},
-std::array<float,2>{0.600942314f, 0.929887116f},
-std::array<float,2>{0.0056029032f, 0.334461242f},
-std::array<float,2>{0.441537321f, 0.712777674f},
-std::array<float,2>{0.962420821f, 0.0129351914f},
-std::array<float,2>{0.90116632f, 0.973926902f},
-std::array<float,2>{0.410863966f, 0.264523476f},
-std::array<float,2>{0.0816070586f, 0.625959039f},
-std::array<float,2>{0.518376887f, 0.117315732f},
-std::array<float,2>{0.681200981f, 0.593504369f},
-std::array<float,2>{0.172757119f, 0.143937349f},
-std::array<float,2>{0.295888275f, 0.780142546f},
-std::array<float,2>{0.804613233f, 0.426455945f},
-std::array<float,2>{0.819487333f, 0.707179487f},
-std::array<float,2>{0.328698128f, 0.00685264589f},
-std::array<float,2>{0.240531236f, 0.923877001f},
-std::array<float,2>{0.718831003f, 0.337533295f},
-std::array<float,2>{0.588644207f, 0.833002448f},
-std::array<float,2>{0.039146848f, 0.494766563f},
-std::array<float,2>{0.495371699f, 0.5499717f},
-std::array<float,2>{0.982625067f, 0.209898055f},
-std::array<float,2>{0.750029504f, 0.796138942f},
-std::array<float,2>{0.260099262f, 0.4015764f},
-std::array<float,2>{0.148004547f, 0.606742024f},
-std::array<float,2>{0.637567937f, 0.16818051f},
-std::array<float,2>{0.544461429f, 0.671514153f},
-std::array<float,2>{0.1038469f, 0.0716453344f},
-std::array<float,2>{0.396438748f, 0.93799305f},
-std::array<float,2>{0.919700027f, 0.303975135f},
-std::array<float,2>{0.956909955f, 0.516146302f},
-std::array<float,2>{0.450649709f, 0.233166978f},
-std::array<float,2>{0.00912056025f, 0.867564142f},
-std::array<float,2>{0.605462134f, 0.437817931f},
-std::array<float,2>{0.711993873f, 0.884436965f},
-std::array<float,2>{0.215438887f, 0.36485371f},
-std::array<float,2>{0.355251908f, 0.729779422f},
-std::array<float,2>{0.859663069f, 0.0361665748f},
-std::array<float,2>{0.850434899f, 0.91380167f},
-std::array<float,2>{0.368370324f, 0.313125044f},
-std::array<float,2>{0.189204887f, 0.700144589f},
-std::array<float,2>{0.690713227f, 0.0223051812f},
-std::array<float,2>{0.616124213f, 0.544665396f},
-std::array<float,2>{0.0264723022f, 0.187507659f},
-std::array<float,2>{0.455636263f, 0.814952552f},
-std::array<float,2>{0.940613508f, 0.472531885f},
-std::array<float,2>{0.926664054f, 0.645358741f},
-std::array<float,2>{0.385252565f, 0.0966932997f},
-std::array<float,2>{0.114384957f, 0.997840762f},
-std::array<float,2>{0.561269045f, 0.272223622f},
-std::array<float,2>{0.651620865f, 0.752738535f},
-std::array<float,2>{0.140357241f, 0.414809525f},
-std::array<float,2>{0.276355714f, 0.564846992f},
-std::array<float,2>{0.765928984f, 0.128157675f},
-std::array<float,2>{0.99332124f, 0.856668234f},
-std::array<float,2>{0.470813125f, 0.468243927f},
-std::array<float,2>{0.0567402206f, 0.502290428f},
-std::array<float,2>{0.573658943f, 0.247028738f},
-std::array<float,2>{0.745079339f, 0.735667884f},
-std::array<float,2>{0.219659418f, 0.0573454462f},
-std::array<float,2>{0.319558561f, 0.892669439f},
-std::array<float,2>{0.830958843f, 0.354317278f},
-std::array<float,2>{0.795498967f, 0.621560693f},
-std::array<float,2>{0.304327279f, 0.176690012f},
-std::array<float,2>{0.171026453f, 0.806783557f},
-std::array<float,2>{0.665096402f, 0.377243727f},
-std::array<float,2>{0.501368046f, 0.963162482f},
-std::array<float,2>{0.0765121505f, 0.282472581f},
-std::array<float,2>{0.430949181f, 0.677507758f},
-std::array<float,2>{0.878038287f, 0.0793085843f},
-std::array<float,2>{0.957396269f, 0.985752106f},
-std::array<float,2>{0.445880979f, 0.277456909f},
-std::array<float,2>{0.0125112254f, 0.652977467f},
-std::array<float,2>{0.608855367f, 0.107863285f},
-std::array<float,2>{0.717012644f, 0.578067303f},
-std::array<float,2>{0.213048622f, 0.135058001f},
-std::array<float,2>{0.358586669f, 0.765180111f},
-std::array<float,2>{0.866086185f, 0.413778394f},
-std::array<float,2>{0.755132854f, 0.69291079f},
-std::array<float,2>{0.262091815f, 0.0282158032f},
-std::array<float,2>{0.141779169f, 0.915054321f},
-std::array<float,2>{0.633805573f, 0.327415019f},
-std::array<float,2>{0.542945981f, 0.821461141f},
-std::array<float,2>{0.108604632f, 0.479356736f},
-std::array<float,2>{0.394345284f, 0.536064267f},
-std::array<float,2>{0.915748894f, 0.198281974f},
-std::array<float,2>{0.814538836f, 0.799482167f},
-std::array<float,2>{0.335720927f, 0.388521075f},
-std::array<float,2>{0.23661676f, 0.615147829f},
-std::array<float,2>{0.724423826f, 0.18502599f},
-std::array<float,2>{0.590309739f, 0.679976583f},
-std::array<float,2>{0.0458981544f, 0.0893853903f},
-std::array<float,2>{0.49849385f, 0.954023361f},
-std::array<float,2>{0.980022669f, 0.2893475f},
-std::array<float,2>{0.903454244f, 0.509240389f},
-std::array<float,2>{0.406777978f, 0.236373648f},
-std::array<float,2>{0.08281748f, 0.845672011f},
-std::array<float,2>{0.521544218f, 0.460039645f},
-std::array<float,2>{0.686878741f, 0.901760221f},
-std::array<float,2>{0.178951636f, 0.347484887f},
-std::array<float,2>{0.290419281f, 0.746061683f},
-std::array<float,2>{0.800503731f, 0.0530017763f},
-std::array<float,2>{0.790072918f, 0.93625623f},
-std::array<float,2>{0.299198896f, 0.328719407f},
-std::array<float,2>{0.167207688f, 0.716781616f},
-std::array<float,2>{0.669167936f, 0.0117005538f},
-std::array<float,2>{0.507615507f, 0.557798564f},
-std::array<float,2>{0.0718057379f, 0.214307219f},
-std::array<float,2>{0.43470639f, 0.837436736f},
-std::array<float,2>{0.879721403f, 0.485105425f},
-std::array<float,2>{0.997610927f, 0.632930815f},
-std::array<float,2>{0.474241942f, 0.116705768f},
-std::array<float,2>{0.0589994565f, 0.982059181f},
-std::array<float,2>{0.574940681f, 0.256934404f},
-std::array<float,2>{0.74678874f, 0.765889108f},
-std::array<float,2>{0.224383786f, 0.433557719f},
-std::array<float,2>{0.313786209f, 0.582113087f},
-std::array<float,2>{0.832293689f, 0.151784241f},
-std::array<float,2>{0.921883106f, 0.862704098f},
-std::array<float,2>{0.387899667f, 0.449112266f},
-std::array<float,2>{0.110104755f, 0.524870336f},
-std::array<float,2>{0.55482024f, 0.219416931f},
-std::array<float,2>{0.655047596f, 0.719244838f},
-std::array<float,2>{0.133014843f, 0.0403594635f},
-std::array<float,2>{0.278391898f, 0.878084302f},
-std::array<float,2>{0.769864321f, 0.368057042f},
-std::array<float,2>{0.847334146f, 0.600320578f},
-std::array<float,2>{0.37135005f, 0.161589324f},
-std::array<float,2>{0.192432895f, 0.786071837f},
-std::array<float,2>{0.694654524f, 0.395981401f},
-std::array<float,2>{0.610677004f, 0.947208941f},
-std::array<float,2>{0.0279304888f, 0.31050539f},
-std::array<float,2>{0.458735883f, 0.659922421f},
-std::array<float,2>{0.945240736f, 0.0697362944f},
-std::array<float,2>{0.888978362f, 0.890250564f},
-std::array<float,2>{0.427289814f, 0.360040158f},
-std::array<float,2>{0.0667146668f, 0.731795609f},
-std::array<float,2>{0.508613408f, 0.0321759582f},
-std::array<float,2>{0.662039638f, 0.521469057f},
-std::array<float,2>{0.159008175f, 0.228606701f},
-std::array<float,2>{0.309512317f, 0.874566615f},
-std::array<float,2>{0.781443715f, 0.443952769f},
-std::array<float,2>{0.839290917f, 0.6676476f},
-std::array<float,2>{0.326741189f, 0.076861605f},
-std::array<float,2>{0.230195984f, 0.943381369f},
-std::array<float,2>{0.741735995f, 0.299957991f},
-std::array<float,2>{0.567547798f, 0.792748153f},
-std::array<float,2>{0.0514457338f, 0.402620047f},
-std::array<float,2>{0.478881985f, 0.603823483f},
-std::array<float,2>{0.988903821f, 0.16683583f},
-std::array<float,2>{0.777241528f, 0.828864336f},
-std::array<float,2>{0.266436338f, 0.498056054f},
-std::array<float,2>{0.128603771f, 0.551870584f},
-std::array<float,2>{0.647787273f, 0.205640882f},
-std::array<float,2>{0.549914598f, 0.7048195f},
-std::array<float,2>{0.121476211f, 0.000485968834f},
-std::array<float,2>{0.3814542f, 0.928648472f},
-std::array<float,2>{0.932656765f, 0.340360969f},
-std::array<float,2>{0.947673798f, 0.588318646f},
-std::array<float,2>{0.461764693f, 0.147459134f},
-std::array<float,2>{0.0174626056f, 0.775276542f},
-std::array<float,2>{0.619327724f, 0.422671348f},
-std::array<float,2>{0.702970564f, 0.972597897f},
-std::array<float,2>{0.198824048f, 0.258317411f},
-std::array<float,2>{0.365526259f, 0.629927278f},
-std::array<float,2>{0.853583574f, 0.124661662f},
-std::array<float,2>{0.874697208f, 0.968534887f},
-std::array<float,2>{0.34396857f, 0.288539112f},
-std::array<float,2>{0.20927307f, 0.673427463f},
-std::array<float,2>{0.708424389f, 0.0828326121f},
-std::array<float,2>{0.594870746f, 0.618082404f},
-std::array<float,2>{0.00218063686f, 0.173794448f},
-std::array<float,2>{0.437509954f, 0.811394751f},
-std::array<float,2>{0.966929376f, 0.379332036f},
-std::array<float,2>{0.906428993f, 0.741650343f},
-std::array<float,2>{0.404956281f, 0.0620581582f},
-std::array<float,2>{0.0975852236f, 0.894635677f},
-std::array<float,2>{0.533894241f, 0.357378602f},
-std::array<float,2>{0.627748907f, 0.85226506f},
-std::array<float,2>{0.151628301f, 0.463207871f},
-std::array<float,2>{0.252253354f, 0.505314112f},
-std::array<float,2>{0.75854516f, 0.242242754f},
-std::array<float,2>{0.975197494f, 0.755032659f},
-std::array<float,2>{0.485738039f, 0.418746978f},
-std::array<float,2>{0.0363904312f, 0.570177436f},
-std::array<float,2>{0.582385838f, 0.13194716f},
-std::array<float,2>{0.72724849f, 0.641115665f},
-std::array<float,2>{0.244514182f, 0.0992719382f},
-std::array<float,2>{0.337575287f, 0.995409489f},
-std::array<float,2>{0.821981907f, 0.266510189f},
-std::array<float,2>{0.811219275f, 0.541351616f},
-std::array<float,2>{0.281781971f, 0.193602517f},
-std::array<float,2>{0.185468867f, 0.819940388f},
-std::array<float,2>{0.677679539f, 0.474600106f},
-std::array<float,2>{0.524983823f, 0.907988369f},
-std::array<float,2>{0.0882543027f, 0.317495733f},
-std::array<float,2>{0.421704173f, 0.69753468f},
-std::array<float,2>{0.891197085f, 0.018313257f},
-std::array<float,2>{0.987742722f, 0.919073761f},
-std::array<float,2>{0.481837928f, 0.321026176f},
-std::array<float,2>{0.0489480719f, 0.690867901f},
-std::array<float,2>{0.565992117f, 0.026199095f},
-std::array<float,2>{0.73767823f, 0.531804681f},
-std::array<float,2>{0.232894763f, 0.199317694f},
-std::array<float,2>{0.321401596f, 0.825068057f},
-std::array<float,2>{0.841635823f, 0.482027054f},
-std::array<float,2>{0.787585855f, 0.650654256f},
-std::array<float,2>{0.30746004f, 0.104659632f},
-std::array<float,2>{0.161455125f, 0.989762962f},
-std::array<float,2>{0.658635795f, 0.274895757f},
-std::array<float,2>{0.512211144f, 0.758335471f},
-std::array<float,2>{0.0645978078f, 0.407620162f},
-std::array<float,2>{0.424124748f, 0.571517944f},
-std::array<float,2>{0.883241057f, 0.139402419f},
-std::array<float,2>{0.857743323f, 0.848337114f},
-std::array<float,2>{0.362785578f, 0.4569664f},
-std::array<float,2>{0.201733008f, 0.512586415f},
-std::array<float,2>{0.696799278f, 0.239514902f},
-std::array<float,2>{0.621427774f, 0.746414602f},
-std::array<float,2>{0.0207721852f, 0.0474038869f},
-std::array<float,2>{0.465512127f, 0.903866708f},
-std::array<float,2>{0.951436222f, 0.348668993f},
-std::array<float,2>{0.934426606f, 0.610095084f},
-std::array<float,2>{0.375932485f, 0.182600871f},
-std::array<float,2>{0.118132792f, 0.804512501f},
-std::array<float,2>{0.552919507f, 0.383868039f},
-std::array<float,2>{0.643366694f, 0.958780229f},
-std::array<float,2>{0.129084691f, 0.294529647f},
-std::array<float,2>{0.270486087f, 0.686326802f},
-std::array<float,2>{0.77786082f, 0.0919310823f},
-std::array<float,2>{0.76182276f, 0.977059662f},
-std::array<float,2>{0.257618159f, 0.250150591f},
-std::array<float,2>{0.153687641f, 0.637090385f},
-std::array<float,2>{0.632107079f, 0.111139484f},
-std::array<float,2>{0.537810206f, 0.578501463f},
-std::array<float,2>{0.101456136f, 0.155964613f},
-std::array<float,2>{0.40195933f, 0.77290833f},
-std::array<float,2>{0.911194444f, 0.435851902f},
-std::array<float,2>{0.963195264f, 0.713368952f},
-std::array<float,2>{0.444760621f, 0.0142428307f},
-std::array<float,2>{0.00702355383f, 0.931641757f},
-std::array<float,2>{0.598589838f, 0.333449662f},
-std::array<float,2>{0.703158319f, 0.84141171f},
-std::array<float,2>{0.205069378f, 0.489296019f},
-std::array<float,2>{0.348368615f, 0.559135735f},
-std::array<float,2>{0.87002331f, 0.216989353f},
-std::array<float,2>{0.898320556f, 0.781510174f},
-std::array<float,2>{0.416720867f, 0.39340952f},
-std::array<float,2>{0.09215229f, 0.593797922f},
-std::array<float,2>{0.528284669f, 0.158502504f},
-std::array<float,2>{0.67451328f, 0.661763668f},
-std::array<float,2>{0.182608843f, 0.064263545f},
-std::array<float,2>{0.288603604f, 0.950877249f},
-std::array<float,2>{0.805668652f, 0.30745855f},
-std::array<float,2>{0.827646315f, 0.527396202f},
-std::array<float,2>{0.342729151f, 0.22449033f},
-std::array<float,2>{0.247568339f, 0.86516881f},
-std::array<float,2>{0.730971396f, 0.452913105f},
-std::array<float,2>{0.578513026f, 0.882029474f},
-std::array<float,2>{0.0321897492f, 0.373605967f},
-std::array<float,2>{0.491806746f, 0.725340426f},
-std::array<float,2>{0.969962358f, 0.0465244837f},
-std::array<float,2>{0.921173275f, 0.939810276f},
-std::array<float,2>{0.397382081f, 0.300919473f},
-std::array<float,2>{0.101730295f, 0.669693947f},
-std::array<float,2>{0.545458734f, 0.0739626065f},
-std::array<float,2>{0.639032066f, 0.607906401f},
-std::array<float,2>{0.144998699f, 0.171095923f},
-std::array<float,2>{0.259487212f, 0.793097615f},
-std::array<float,2>{0.752701521f, 0.399559647f},
-std::array<float,2>{0.863118827f, 0.728513479f},
-std::array<float,2>{0.353239506f, 0.0386120677f},
-std::array<float,2>{0.216981292f, 0.88528353f},
-std::array<float,2>{0.713837266f, 0.365645349f},
-std::array<float,2>{0.602019846f, 0.869733632f},
-std::array<float,2>{0.0116693052f, 0.440107673f},
-std::array<float,2>{0.451985389f, 0.519367397f},
-std::array<float,2>{0.953755915f, 0.231394351f},
-std::array<float,2>{0.802141607f, 0.7792629f},
-std::array<float,2>{0.294606328f, 0.429575205f},
-std::array<float,2>{0.174155414f, 0.591284811f},
-std::array<float,2>{0.683094561f, 0.142018273f},
-std::array<float,2>{0.517127931f, 0.628092051f},
-std::array<float,2>{0.078906253f, 0.120574422f},
-std::array<float,2>{0.413241476f, 0.974794209f},
-std::array<float,2>{0.899038553f, 0.263004303f},
-std::array<float,2>{0.981115878f, 0.548056662f},
-std::array<float,2>{0.494009316f, 0.207849622f},
-std::array<float,2>{0.042374067f, 0.835731626f},
-std::array<float,2>{0.586116254f, 0.493256181f},
-std::array<float,2>{0.722116172f, 0.922096312f},
-std::array<float,2>{0.239109784f, 0.33829537f},
-std::array<float,2>{0.33026129f, 0.710441589f},
-std::array<float,2>{0.817955196f, 0.00432609767f},
-std::array<float,2>{0.830003679f, 0.89152956f},
-std::array<float,2>{0.318027884f, 0.352486223f},
-std::array<float,2>{0.222618595f, 0.737181485f},
-std::array<float,2>{0.743416786f, 0.0565049909f},
-std::array<float,2>{0.571846604f, 0.501202762f},
-std::array<float,2>{0.0556285195f, 0.249797389f},
-std::array<float,2>{0.469786823f, 0.857664347f},
-std::array<float,2>{0.996007562f, 0.466290891f},
-std::array<float,2>{0.875280082f, 0.678967297f},
-std::array<float,2>{0.433167994f, 0.0818105489f},
-std::array<float,2>{0.0756555572f, 0.961941957f},
-std::array<float,2>{0.503061414f, 0.283981353f},
-std::array<float,2>{0.666094124f, 0.806523561f},
-std::array<float,2>{0.168497309f, 0.376226455f},
-std::array<float,2>{0.301368982f, 0.624836266f},
-std::array<float,2>{0.794277191f, 0.179227084f},
-std::array<float,2>{0.937920451f, 0.813354731f},
-std::array<float,2>{0.453631341f, 0.470319927f},
-std::array<float,2>{0.0237829071f, 0.546737373f},
-std::array<float,2>{0.614975393f, 0.190612122f},
-std::array<float,2>{0.688768387f, 0.701490223f},
-std::array<float,2>{0.190606296f, 0.0202732384f},
-std::array<float,2>{0.370478839f, 0.91099453f},
-std::array<float,2>{0.848883331f, 0.316112459f},
-std::array<float,2>{0.768856525f, 0.562766373f},
-std::array<float,2>{0.27468437f, 0.125661895f},
-std::array<float,2>{0.136912897f, 0.751814067f},
-std::array<float,2>{0.650100052f, 0.417686224f},
-std::array<float,2>{0.558661282f, 0.998230338f},
-std::array<float,2>{0.117011286f, 0.269602686f},
-std::array<float,2>{0.38327536f, 0.646954894f},
-std::array<float,2>{0.92886734f, 0.0940470994f},
-std::array<float,2>{0.985570908f, 0.990070939f},
-std::array<float,2>{0.48413673f, 0.274549097f},
-std::array<float,2>{0.0487338006f, 0.65040791f},
-std::array<float,2>{0.563220501f, 0.104973152f},
-std::array<float,2>{0.735839307f, 0.571616113f},
-std::array<float,2>{0.232065752f, 0.139508769f},
-std::array<float,2>{0.323191136f, 0.75861299f},
-std::array<float,2>{0.842997611f, 0.407457322f},
-std::array<float,2>{0.785546184f, 0.690517724f},
-std::array<float,2>{0.304834634f, 0.0259139277f},
-std::array<float,2>{0.162654549f, 0.91922313f},
-std::array<float,2>{0.657146275f, 0.321167409f},
-std::array<float,2>{0.513869941f, 0.824859023f},
-std::array<float,2>{0.0629584491f, 0.482337624f},
-std::array<float,2>{0.422727585f, 0.532009661f},
-std::array<float,2>{0.885252476f, 0.199663505f},
-std::array<float,2>{0.856024146f, 0.804374456f},
-std::array<float,2>{0.35941875f, 0.384216219f},
-std::array<float,2>{0.199225187f, 0.610279381f},
-std::array<float,2>{0.697736204f, 0.182342261f},
-std::array<float,2>{0.623533905f, 0.686100483f},
-std::array<float,2>{0.0226344429f, 0.0922549963f},
-std::array<float,2>{0.468692482f, 0.958636224f},
-std::array<float,2>{0.950463951f, 0.294725239f},
-std::array<float,2>{0.936503589f, 0.512306035f},
-std::array<float,2>{0.378025115f, 0.239337862f},
-std::array<float,2>{0.120226212f, 0.848516762f},
-std::array<float,2>{0.551341593f, 0.456770688f},
-std::array<float,2>{0.641786814f, 0.904168725f},
-std::array<float,2>{0.130907118f, 0.349039227f},
-std::array<float,2>{0.273115784f, 0.746202767f},
-std::array<float,2>{0.779316366f, 0.0476924032f},
-std::array<float,2>{0.764934242f, 0.932102144f},
-std::array<float,2>{0.254287541f, 0.333157629f},
-std::array<float,2>{0.155045763f, 0.712999701f},
-std::array<float,2>{0.63041985f, 0.0144104725f},
-std::array<float,2>{0.535771012f, 0.559409201f},
-std::array<float,2>{0.0985300839f, 0.217084542f},
-std::array<float,2>{0.400034577f, 0.841575444f},
-std::array<float,2>{0.913241267f, 0.489583939f},
-std::array<float,2>{0.961136401f, 0.636839926f},
-std::array<float,2>{0.442956388f, 0.11103753f},
-std::array<float,2>{0.00436472753f, 0.977460623f},
-std::array<float,2>{0.600523233f, 0.250310332f},
-std::array<float,2>{0.705708623f, 0.77267468f},
-std::array<float,2>{0.205917865f, 0.43564713f},
-std::array<float,2>{0.350032508f, 0.578216076f},
-std::array<float,2>{0.867243052f, 0.156012699f},
-std::array<float,2>{0.895951152f, 0.864891052f},
-std::array<float,2>{0.414300263f, 0.452841341f},
-std::array<float,2>{0.0905784667f, 0.527717292f},
-std::array<float,2>{0.531124771f, 0.224337533f},
-std::array<float,2>{0.672937274f, 0.725391269f},
-std::array<float,2>{0.180317864f, 0.046730943f},
-std::array<float,2>{0.285529077f, 0.882251561f},
-std::array<float,2>{0.807530224f, 0.37392357f},
-std::array<float,2>{0.826159f, 0.594227374f},
-std::array<float,2>{0.341394633f, 0.158279687f},
-std::array<float,2>{0.24858366f, 0.781427145f},
-std::array<float,2>{0.733049572f, 0.39329499f},
-std::array<float,2>{0.58145535f, 0.951050222f},
-std::array<float,2>{0.0350194871f, 0.307313114f},
-std::array<float,2>{0.489690512f, 0.661950827f},
-std::array<float,2>{0.970831335f, 0.0641356856f},
-std::array<float,2>{0.918269515f, 0.885564983f},
-std::array<float,2>{0.395482183f, 0.365261674f},
-std::array<float,2>{0.104628175f, 0.728027642f},
-std::array<float,2>{0.543737352f, 0.0388609357f},
-std::array<float,2>{0.638424814f, 0.519164264f},
-std::array<float,2>{0.146817267f, 0.23117055f},
-std::array<float,2>{0.261254877f, 0.87002492f},
-std::array<float,2>{0.751201332f, 0.440330923f},
-std::array<float,2>{0.861120701f, 0.669571459f},
-std::array<float,2>{0.353846669f, 0.0741520599f},
-std::array<float,2>{0.215849563f, 0.939594507f},
-std::array<float,2>{0.711316764f, 0.301066935f},
-std::array<float,2>{0.604117453f, 0.793442845f},
-std::array<float,2>{0.00810168311f, 0.399861276f},
-std::array<float,2>{0.449268669f, 0.607635438f},
-std::array<float,2>{0.956038952f, 0.171276435f},
-std::array<float,2>{0.803446829f, 0.835476577f},
-std::array<float,2>{0.296637446f, 0.493570417f},
-std::array<float,2>{0.173543394f, 0.548207581f},
-std::array<float,2>{0.680053532f, 0.207665205f},
-std::array<float,2>{0.518727303f, 0.710038602f},
-std::array<float,2>{0.080354996f, 0.00394925009f},
-std::array<float,2>{0.411881208f, 0.922347069f},
-std::array<float,2>{0.901383936f, 0.33791551f},
-std::array<float,2>{0.984238505f, 0.5909127f},
-std::array<float,2>{0.494567454f, 0.141754165f},
-std::array<float,2>{0.0400610827f, 0.778867126f},
-std::array<float,2>{0.589478612f, 0.429412693f},
-std::array<float,2>{0.720096767f, 0.975055754f},
-std::array<float,2>{0.242093965f, 0.262898982f},
-std::array<float,2>{0.329472214f, 0.628195822f},
-std::array<float,2>{0.819093108f, 0.120321639f},
-std::array<float,2>{0.831913054f, 0.962345958f},
-std::array<float,2>{0.319098264f, 0.283693284f},
-std::array<float,2>{0.220442444f, 0.678952992f},
-std::array<float,2>{0.745167553f, 0.0817793533f},
-std::array<float,2>{0.573132217f, 0.624567986f},
-std::array<float,2>{0.0583081394f, 0.17946963f},
-std::array<float,2>{0.472475052f, 0.806289375f},
-std::array<float,2>{0.992953897f, 0.375996321f},
-std::array<float,2>{0.877712369f, 0.737057984f},
-std::array<float,2>{0.4301337f, 0.0562614128f},
-std::array<float,2>{0.0772550106f, 0.891210258f},
-std::array<float,2>{0.500045776f, 0.352154642f},
-std::array<float,2>{0.664251745f, 0.857811809f},
-std::array<float,2>{0.170481667f, 0.465954989f},
-std::array<float,2>{0.303551823f, 0.501373112f},
-std::array<float,2>{0.796278238f, 0.24967055f},
-std::array<float,2>{0.940031767f, 0.75165534f},
-std::array<float,2>{0.456819028f, 0.417959094f},
-std::array<float,2>{0.0255675409f, 0.562502325f},
-std::array<float,2>{0.616713285f, 0.125863075f},
-std::array<float,2>{0.690074265f, 0.646622837f},
-std::array<float,2>{0.18802169f, 0.0937953517f},
-std::array<float,2>{0.36801669f, 0.998487771f},
-std::array<float,2>{0.851433575f, 0.26991865f},
-std::array<float,2>{0.767283618f, 0.546533704f},
-std::array<float,2>{0.277012765f, 0.190689415f},
-std::array<float,2>{0.138992772f, 0.813000143f},
-std::array<float,2>{0.650508642f, 0.470614493f},
-std::array<float,2>{0.56219846f, 0.910711646f},
-std::array<float,2>{0.113884337f, 0.316298395f},
-std::array<float,2>{0.386094362f, 0.701354742f},
-std::array<float,2>{0.926849127f, 0.0201708768f},
-std::array<float,2>{0.959252536f, 0.915370107f},
-std::array<float,2>{0.44728297f, 0.32738024f},
-std::array<float,2>{0.0137990164f, 0.693146765f},
-std::array<float,2>{0.607243419f, 0.0280662999f},
-std::array<float,2>{0.716329515f, 0.535684049f},
-std::array<float,2>{0.212230459f, 0.198684707f},
-std::array<float,2>{0.356721491f, 0.821661532f},
-std::array<float,2>{0.865066528f, 0.47915417f},
-std::array<float,2>{0.756745934f, 0.653158128f},
-std::array<float,2>{0.264866918f, 0.107453562f},
-std::array<float,2>{0.143813208f, 0.985557079f},
-std::array<float,2>{0.635624826f, 0.277767539f},
-std::array<float,2>{0.53993839f, 0.765448153f},
-std::array<float,2>{0.10658358f, 0.4140113f},
-std::array<float,2>{0.392212361f, 0.577851832f},
-std::array<float,2>{0.917002797f, 0.134905413f},
-std::array<float,2>{0.812956095f, 0.84532851f},
-std::array<float,2>{0.333576947f, 0.460332185f},
-std::array<float,2>{0.23481673f, 0.508852005f},
-std::array<float,2>{0.72593981f, 0.236813873f},
-std::array<float,2>{0.592142463f, 0.745723784f},
-std::array<float,2>{0.0446009301f, 0.0528156385f},
-std::array<float,2>{0.497795314f, 0.901537001f},
-std::array<float,2>{0.976937056f, 0.347362101f},
-std::array<float,2>{0.905688882f, 0.614807546f},
-std::array<float,2>{0.409072727f, 0.184761301f},
-std::array<float,2>{0.0842050686f, 0.799674571f},
-std::array<float,2>{0.521148682f, 0.388402998f},
-std::array<float,2>{0.684359193f, 0.953618288f},
-std::array<float,2>{0.175824061f, 0.28918919f},
-std::array<float,2>{0.292735219f, 0.679714501f},
-std::array<float,2>{0.797941685f, 0.0896771923f},
-std::array<float,2>{0.792323351f, 0.982215345f},
-std::array<float,2>{0.297922492f, 0.257213831f},
-std::array<float,2>{0.165297329f, 0.633235693f},
-std::array<float,2>{0.671748579f, 0.117086835f},
-std::array<float,2>{0.505618215f, 0.582474709f},
-std::array<float,2>{0.0723422989f, 0.151570395f},
-std::array<float,2>{0.436888963f, 0.765667319f},
-std::array<float,2>{0.881046057f, 0.433133334f},
-std::array<float,2>{0.999797821f, 0.716311634f},
-std::array<float,2>{0.474995911f, 0.0113466792f},
-std::array<float,2>{0.0608751476f, 0.936441541f},
-std::array<float,2>{0.576538384f, 0.329012662f},
-std::array<float,2>{0.749919355f, 0.837808073f},
-std::array<float,2>{0.224757686f, 0.485293239f},
-std::array<float,2>{0.315831333f, 0.557900429f},
-std::array<float,2>{0.834189475f, 0.21405521f},
-std::array<float,2>{0.924099445f, 0.785728514f},
-std::array<float,2>{0.388754904f, 0.39572385f},
-std::array<float,2>{0.11258506f, 0.600429296f},
-std::array<float,2>{0.557186663f, 0.161243141f},
-std::array<float,2>{0.652386844f, 0.659880519f},
-std::array<float,2>{0.135822296f, 0.0694264695f},
-std::array<float,2>{0.280156583f, 0.946841061f},
-std::array<float,2>{0.772227705f, 0.310083121f},
-std::array<float,2>{0.844792008f, 0.52458328f},
-std::array<float,2>{0.373815745f, 0.219596773f},
-std::array<float,2>{0.194598764f, 0.862451434f},
-std::array<float,2>{0.693002045f, 0.44876951f},
-std::array<float,2>{0.611718178f, 0.878178f},
-std::array<float,2>{0.0301640555f, 0.367858678f},
-std::array<float,2>{0.460196823f, 0.719497502f},
-std::array<float,2>{0.941548049f, 0.0400832668f},
-std::array<float,2>{0.888040781f, 0.943661511f},
-std::array<float,2>{0.429291248f, 0.300151676f},
-std::array<float,2>{0.0699642003f, 0.667890549f},
-std::array<float,2>{0.511047065f, 0.0770535991f},
-std::array<float,2>{0.662178278f, 0.603626907f},
-std::array<float,2>{0.157338887f, 0.166556329f},
-std::array<float,2>{0.311038673f, 0.792562246f},
-std::array<float,2>{0.784645438f, 0.402566701f},
-std::array<float,2>{0.836308122f, 0.73160851f},
-std::array<float,2>{0.325682014f, 0.0317811109f},
-std::array<float,2>{0.227901965f, 0.890448689f},
-std::array<float,2>{0.739202976f, 0.360251188f},
-std::array<float,2>{0.568409026f, 0.874756277f},
-std::array<float,2>{0.0533816069f, 0.444228888f},
-std::array<float,2>{0.47672078f, 0.521221697f},
-std::array<float,2>{0.991058767f, 0.228825539f},
-std::array<float,2>{0.775059402f, 0.774940908f},
-std::array<float,2>{0.268760592f, 0.422558457f},
-std::array<float,2>{0.125094503f, 0.588046253f},
-std::array<float,2>{0.645397425f, 0.147166595f},
-std::array<float,2>{0.548825502f, 0.630264878f},
-std::array<float,2>{0.124711089f, 0.124902852f},
-std::array<float,2>{0.379826635f, 0.972271681f},
-std::array<float,2>{0.931545079f, 0.258578271f},
-std::array<float,2>{0.946423531f, 0.552211761f},
-std::array<float,2>{0.464316577f, 0.205874547f},
-std::array<float,2>{0.0178606864f, 0.82869041f},
-std::array<float,2>{0.617871106f, 0.498392582f},
-std::array<float,2>{0.69994688f, 0.928230345f},
-std::array<float,2>{0.195763886f, 0.340655506f},
-std::array<float,2>{0.365086555f, 0.704874158f},
-std::array<float,2>{0.851983428f, 7.00464579e-06f},
-std::array<float,2>{0.872729599f, 0.894909441f},
-std::array<float,2>{0.346834421f, 0.357048452f},
-std::array<float,2>{0.208219469f, 0.741290748f},
-std::array<float,2>{0.709518611f, 0.0624475926f},
-std::array<float,2>{0.596460044f, 0.505032003f},
-std::array<float,2>{0.00161675375f, 0.242449135f},
-std::array<float,2>{0.440527231f, 0.852481186f},
-std::array<float,2>{0.966524601f, 0.463063121f},
-std::array<float,2>{0.909966946f, 0.673651993f},
-std::array<float,2>{0.402556568f, 0.0825744495f},
-std::array<float,2>{0.094371058f, 0.968475997f},
-std::array<float,2>{0.531713724f, 0.288273335f},
-std::array<float,2>{0.62664336f, 0.811128378f},
-std::array<float,2>{0.149585128f, 0.379004806f},
-std::array<float,2>{0.250609934f, 0.617722571f},
-std::array<float,2>{0.760492861f, 0.173397347f},
-std::array<float,2>{0.973195434f, 0.820248663f},
-std::array<float,2>{0.486915439f, 0.474135101f},
-std::array<float,2>{0.0383222252f, 0.541247725f},
-std::array<float,2>{0.584735513f, 0.193680868f},
-std::array<float,2>{0.729985654f, 0.697400391f},
-std::array<float,2>{0.242586166f, 0.0182941575f},
-std::array<float,2>{0.338293493f, 0.907765508f},
-std::array<float,2>{0.822990835f, 0.317820609f},
-std::array<float,2>{0.810172379f, 0.569943786f},
-std::array<float,2>{0.283837587f, 0.132291853f},
-std::array<float,2>{0.185713843f, 0.755370557f},
-std::array<float,2>{0.678578615f, 0.418524563f},
-std::array<float,2>{0.527336597f, 0.995176136f},
-std::array<float,2>{0.0867580995f, 0.266135275f},
-std::array<float,2>{0.418091327f, 0.641595662f},
-std::array<float,2>{0.893587708f, 0.0995886549f},
-std::array<float,2>{0.952854395f, 0.960851312f},
-std::array<float,2>{0.466135293f, 0.296589971f},
-std::array<float,2>{0.0200312547f, 0.684566975f},
-std::array<float,2>{0.622585297f, 0.0906149223f},
-std::array<float,2>{0.695836842f, 0.612409174f},
-std::array<float,2>{0.20304203f, 0.181159988f},
-std::array<float,2>{0.361339569f, 0.80235213f},
-std::array<float,2>{0.858882546f, 0.386045158f},
-std::array<float,2>{0.778414369f, 0.748504937f},
-std::array<float,2>{0.271418542f, 0.0501166582f},
-std::array<float,2>{0.130194083f, 0.905116916f},
-std::array<float,2>{0.643673539f, 0.349999934f},
-std::array<float,2>{0.554044724f, 0.850873888f},
-std::array<float,2>{0.118184462f, 0.453265876f},
-std::array<float,2>{0.376574069f, 0.515266716f},
-std::array<float,2>{0.934961557f, 0.240736634f},
-std::array<float,2>{0.840019822f, 0.76058358f},
-std::array<float,2>{0.320985049f, 0.409757972f},
-std::array<float,2>{0.234209031f, 0.572484255f},
-std::array<float,2>{0.736964464f, 0.137073368f},
-std::array<float,2>{0.564960659f, 0.650001764f},
-std::array<float,2>{0.0507694706f, 0.10217309f},
-std::array<float,2>{0.480596155f, 0.991642177f},
-std::array<float,2>{0.986657023f, 0.277194291f},
-std::array<float,2>{0.884473681f, 0.534923553f},
-std::array<float,2>{0.425079346f, 0.202486604f},
-std::array<float,2>{0.0661959201f, 0.826462209f},
-std::array<float,2>{0.513428211f, 0.48265034f},
-std::array<float,2>{0.659795344f, 0.920663655f},
-std::array<float,2>{0.161067873f, 0.323683649f},
-std::array<float,2>{0.307818234f, 0.688850701f},
-std::array<float,2>{0.788396776f, 0.0242045056f},
-std::array<float,2>{0.805501401f, 0.88008523f},
-std::array<float,2>{0.28755787f, 0.371852815f},
-std::array<float,2>{0.183416814f, 0.723316789f},
-std::array<float,2>{0.675618708f, 0.0443832874f},
-std::array<float,2>{0.528991997f, 0.530230701f},
-std::array<float,2>{0.0934714302f, 0.225542784f},
-std::array<float,2>{0.417100012f, 0.866997182f},
-std::array<float,2>{0.897009432f, 0.450865239f},
-std::array<float,2>{0.969295859f, 0.662196994f},
-std::array<float,2>{0.490995079f, 0.066087015f},
-std::array<float,2>{0.0322299525f, 0.951698005f},
-std::array<float,2>{0.579328597f, 0.306055427f},
-std::array<float,2>{0.732089043f, 0.783477545f},
-std::array<float,2>{0.246199325f, 0.391955256f},
-std::array<float,2>{0.343358338f, 0.595936418f},
-std::array<float,2>{0.826484382f, 0.156992048f},
-std::array<float,2>{0.910880625f, 0.842050135f},
-std::array<float,2>{0.401128769f, 0.491737157f},
-std::array<float,2>{0.0998313278f, 0.5617733f},
-std::array<float,2>{0.538106918f, 0.215356946f},
-std::array<float,2>{0.631511748f, 0.712515652f},
-std::array<float,2>{0.15330261f, 0.0131789092f},
-std::array<float,2>{0.256416976f, 0.930011451f},
-std::array<float,2>{0.76301378f, 0.334184796f},
-std::array<float,2>{0.870533228f, 0.581080139f},
-std::array<float,2>{0.349247426f, 0.153475598f},
-std::array<float,2>{0.203782052f, 0.771150291f},
-std::array<float,2>{0.704449534f, 0.435056686f},
-std::array<float,2>{0.599281013f, 0.980361342f},
-std::array<float,2>{0.00643385248f, 0.252438366f},
-std::array<float,2>{0.443473011f, 0.640001535f},
-std::array<float,2>{0.964404285f, 0.112357065f},
-std::array<float,2>{0.899546325f, 0.924223542f},
-std::array<float,2>{0.413071245f, 0.337754637f},
-std::array<float,2>{0.0795429796f, 0.70749259f},
-std::array<float,2>{0.515655696f, 0.00712958304f},
-std::array<float,2>{0.682478249f, 0.550176144f},
-std::array<float,2>{0.175529569f, 0.20964624f},
-std::array<float,2>{0.29321456f, 0.83274281f},
-std::array<float,2>{0.80080986f, 0.495065302f},
-std::array<float,2>{0.816813409f, 0.625572801f},
-std::array<float,2>{0.331579179f, 0.117508665f},
-std::array<float,2>{0.239982307f, 0.973782361f},
-std::array<float,2>{0.721119761f, 0.264253944f},
-std::array<float,2>{0.587088346f, 0.779935718f},
-std::array<float,2>{0.0418033563f, 0.426571578f},
-std::array<float,2>{0.492563009f, 0.593610466f},
-std::array<float,2>{0.981895804f, 0.143563166f},
-std::array<float,2>{0.753608048f, 0.867429733f},
-std::array<float,2>{0.258220613f, 0.437527627f},
-std::array<float,2>{0.146249235f, 0.516494632f},
-std::array<float,2>{0.63988477f, 0.233084828f},
-std::array<float,2>{0.546242297f, 0.729712427f},
-std::array<float,2>{0.103349641f, 0.0365063809f},
-std::array<float,2>{0.397979647f, 0.884658337f},
-std::array<float,2>{0.920102775f, 0.3650226f},
-std::array<float,2>{0.954700828f, 0.60653621f},
-std::array<float,2>{0.452880114f, 0.168328017f},
-std::array<float,2>{0.00984536391f, 0.796243727f},
-std::array<float,2>{0.603444338f, 0.401729375f},
-std::array<float,2>{0.714029789f, 0.938469946f},
-std::array<float,2>{0.218022048f, 0.303944021f},
-std::array<float,2>{0.352378249f, 0.671871006f},
-std::array<float,2>{0.861672997f, 0.0712949708f},
-std::array<float,2>{0.848242402f, 0.997636318f},
-std::array<float,2>{0.369648427f, 0.272216082f},
-std::array<float,2>{0.190189764f, 0.645260334f},
-std::array<float,2>{0.687952936f, 0.0971230865f},
-std::array<float,2>{0.613852382f, 0.56449455f},
-std::array<float,2>{0.0244659632f, 0.12832348f},
-std::array<float,2>{0.45431298f, 0.752607644f},
-std::array<float,2>{0.939227939f, 0.414593875f},
-std::array<float,2>{0.928568125f, 0.699895859f},
-std::array<float,2>{0.384676397f, 0.0222044345f},
-std::array<float,2>{0.115385145f, 0.913829744f},
-std::array<float,2>{0.560048938f, 0.313363314f},
-std::array<float,2>{0.649002194f, 0.815272272f},
-std::array<float,2>{0.13782391f, 0.47226733f},
-std::array<float,2>{0.273562461f, 0.544710457f},
-std::array<float,2>{0.768239558f, 0.187786326f},
-std::array<float,2>{0.994210124f, 0.806965172f},
-std::array<float,2>{0.469165117f, 0.376954585f},
-std::array<float,2>{0.0558159724f, 0.621172309f},
-std::array<float,2>{0.570424318f, 0.176480681f},
-std::array<float,2>{0.742567599f, 0.677342653f},
-std::array<float,2>{0.221027538f, 0.0795675963f},
-std::array<float,2>{0.317090809f, 0.96311605f},
-std::array<float,2>{0.828945458f, 0.282241911f},
-std::array<float,2>{0.793749809f, 0.502006531f},
-std::array<float,2>{0.302626014f, 0.246744856f},
-std::array<float,2>{0.169226065f, 0.856851876f},
-std::array<float,2>{0.667073071f, 0.467913747f},
-std::array<float,2>{0.502292693f, 0.892901421f},
-std::array<float,2>{0.0750336125f, 0.354146987f},
-std::array<float,2>{0.431893438f, 0.735377312f},
-std::array<float,2>{0.876259089f, 0.0575411208f},
-std::array<float,2>{0.979113579f, 0.899599612f},
-std::array<float,2>{0.499682993f, 0.343935966f},
-std::array<float,2>{0.0461271144f, 0.743464231f},
-std::array<float,2>{0.591139138f, 0.0524420999f},
-std::array<float,2>{0.722821474f, 0.511546254f},
-std::array<float,2>{0.237637907f, 0.235523134f},
-std::array<float,2>{0.334577084f, 0.846468687f},
-std::array<float,2>{0.815433621f, 0.457373053f},
-std::array<float,2>{0.799739838f, 0.68264991f},
-std::array<float,2>{0.289093614f, 0.0861828998f},
-std::array<float,2>{0.178085059f, 0.955846071f},
-std::array<float,2>{0.685922205f, 0.291949481f},
-std::array<float,2>{0.52258563f, 0.797653377f},
-std::array<float,2>{0.0839309767f, 0.390137166f},
-std::array<float,2>{0.407664895f, 0.616744101f},
-std::array<float,2>{0.902646184f, 0.187329918f},
-std::array<float,2>{0.866875291f, 0.822298825f},
-std::array<float,2>{0.358081281f, 0.477470547f},
-std::array<float,2>{0.214545071f, 0.537464976f},
-std::array<float,2>{0.717829406f, 0.196697921f},
-std::array<float,2>{0.607449591f, 0.695127606f},
-std::array<float,2>{0.012767056f, 0.0305819847f},
-std::array<float,2>{0.447067827f, 0.917694628f},
-std::array<float,2>{0.958315194f, 0.325330198f},
-std::array<float,2>{0.914112866f, 0.574987769f},
-std::array<float,2>{0.392886519f, 0.134570047f},
-std::array<float,2>{0.108044334f, 0.762428582f},
-std::array<float,2>{0.541818082f, 0.411767215f},
-std::array<float,2>{0.633162677f, 0.987377703f},
-std::array<float,2>{0.140821993f, 0.279713541f},
-std::array<float,2>{0.263669431f, 0.654816806f},
-std::array<float,2>{0.754469752f, 0.106490992f},
-std::array<float,2>{0.771371663f, 0.947994351f},
-std::array<float,2>{0.277502656f, 0.312475502f},
-std::array<float,2>{0.134079337f, 0.657692373f},
-std::array<float,2>{0.655750334f, 0.0680128038f},
-std::array<float,2>{0.556359291f, 0.59888339f},
-std::array<float,2>{0.111293264f, 0.162738636f},
-std::array<float,2>{0.387649864f, 0.78760767f},
-std::array<float,2>{0.923490107f, 0.398147881f},
-std::array<float,2>{0.943492174f, 0.721129954f},
-std::array<float,2>{0.457654864f, 0.0410203226f},
-std::array<float,2>{0.0292056184f, 0.876265168f},
-std::array<float,2>{0.609749377f, 0.369877189f},
-std::array<float,2>{0.69409126f, 0.859887183f},
-std::array<float,2>{0.191751406f, 0.446285337f},
-std::array<float,2>{0.372178048f, 0.525471509f},
-std::array<float,2>{0.845801294f, 0.221221909f},
-std::array<float,2>{0.88035059f, 0.769238293f},
-std::array<float,2>{0.433972716f, 0.430103093f},
-std::array<float,2>{0.0712436065f, 0.585791826f},
-std::array<float,2>{0.506803095f, 0.149371743f},
-std::array<float,2>{0.668293893f, 0.635897934f},
-std::array<float,2>{0.166669995f, 0.114038415f},
-std::array<float,2>{0.30051896f, 0.982649386f},
-std::array<float,2>{0.7893641f, 0.255236387f},
-std::array<float,2>{0.833770096f, 0.556602597f},
-std::array<float,2>{0.313445091f, 0.211879596f},
-std::array<float,2>{0.2230528f, 0.839046597f},
-std::array<float,2>{0.747250199f, 0.48821041f},
-std::array<float,2>{0.575298786f, 0.9343943f},
-std::array<float,2>{0.0600490905f, 0.331932604f},
-std::array<float,2>{0.472946852f, 0.718073487f},
-std::array<float,2>{0.996357381f, 0.00794138759f},
-std::array<float,2>{0.932310104f, 0.969984472f},
-std::array<float,2>{0.382310599f, 0.261562079f},
-std::array<float,2>{0.12302193f, 0.632533729f},
-std::array<float,2>{0.548935771f, 0.121414483f},
-std::array<float,2>{0.647383749f, 0.586243331f},
-std::array<float,2>{0.127698466f, 0.144697353f},
-std::array<float,2>{0.267421097f, 0.776253819f},
-std::array<float,2>{0.775412261f, 0.425037682f},
-std::array<float,2>{0.85476923f, 0.705841422f},
-std::array<float,2>{0.366607904f, 0.00233641826f},
-std::array<float,2>{0.197716206f, 0.92639327f},
-std::array<float,2>{0.70173198f, 0.34232071f},
-std::array<float,2>{0.621027827f, 0.830494881f},
-std::array<float,2>{0.0162553359f, 0.497523844f},
-std::array<float,2>{0.462183446f, 0.55276376f},
-std::array<float,2>{0.949168146f, 0.204642668f},
-std::array<float,2>{0.782754838f, 0.7894243f},
-std::array<float,2>{0.310369879f, 0.404875457f},
-std::array<float,2>{0.159769446f, 0.601740718f},
-std::array<float,2>{0.661023259f, 0.165173188f},
-std::array<float,2>{0.50943011f, 0.664773405f},
-std::array<float,2>{0.0679186881f, 0.0760307387f},
-std::array<float,2>{0.425883919f, 0.941797614f},
-std::array<float,2>{0.890472174f, 0.298603177f},
-std::array<float,2>{0.989374042f, 0.522797108f},
-std::array<float,2>{0.479841322f, 0.227528617f},
-std::array<float,2>{0.0523036197f, 0.872098923f},
-std::array<float,2>{0.567352951f, 0.443236589f},
-std::array<float,2>{0.740900815f, 0.887739599f},
-std::array<float,2>{0.228722334f, 0.361684144f},
-std::array<float,2>{0.328005999f, 0.732601881f},
-std::array<float,2>{0.838220835f, 0.0345074758f},
-std::array<float,2>{0.820831895f, 0.909002602f},
-std::array<float,2>{0.336119831f, 0.318475962f},
-std::array<float,2>{0.245983303f, 0.695829272f},
-std::array<float,2>{0.72825712f, 0.0162190069f},
-std::array<float,2>{0.58307606f, 0.540217459f},
-std::array<float,2>{0.0352135934f, 0.192345843f},
-std::array<float,2>{0.485110164f, 0.818217278f},
-std::array<float,2>{0.975957036f, 0.475479931f},
-std::array<float,2>{0.892004609f, 0.643936038f},
-std::array<float,2>{0.42060709f, 0.100045621f},
-std::array<float,2>{0.0891821235f, 0.992947638f},
-std::array<float,2>{0.523495793f, 0.267918825f},
-std::array<float,2>{0.676198423f, 0.756343842f},
-std::array<float,2>{0.184174851f, 0.421408683f},
-std::array<float,2>{0.283190519f, 0.56800884f},
-std::array<float,2>{0.812062323f, 0.129743636f},
-std::array<float,2>{0.96796757f, 0.854738533f},
-std::array<float,2>{0.438817859f, 0.462687135f},
-std::array<float,2>{0.00346802874f, 0.507115543f},
-std::array<float,2>{0.593903065f, 0.246035621f},
-std::array<float,2>{0.707280874f, 0.738788247f},
-std::array<float,2>{0.210820064f, 0.0587663315f},
-std::array<float,2>{0.344806641f, 0.898252368f},
-std::array<float,2>{0.873528719f, 0.359203607f},
-std::array<float,2>{0.758892059f, 0.620504737f},
-std::array<float,2>{0.253119022f, 0.175321653f},
-std::array<float,2>{0.150543869f, 0.809697509f},
-std::array<float,2>{0.628368318f, 0.38211447f},
-std::array<float,2>{0.534948409f, 0.96657759f},
-std::array<float,2>{0.0966565832f, 0.286988318f},
-std::array<float,2>{0.40606913f, 0.674135089f},
-std::array<float,2>{0.907926857f, 0.0843624696f},
-std::array<float,2>{0.972144425f, 0.9523592f},
-std::array<float,2>{0.488445908f, 0.304702818f},
-std::array<float,2>{0.0335759111f, 0.663894236f},
-std::array<float,2>{0.58050555f, 0.064562358f},
-std::array<float,2>{0.733479619f, 0.597127259f},
-std::array<float,2>{0.249678433f, 0.157813996f},
-std::array<float,2>{0.340137154f, 0.784442961f},
-std::array<float,2>{0.824334383f, 0.390799344f},
-std::array<float,2>{0.807834506f, 0.724071205f},
-std::array<float,2>{0.286664754f, 0.043025177f},
-std::array<float,2>{0.180863276f, 0.879392207f},
-std::array<float,2>{0.672458529f, 0.37263763f},
-std::array<float,2>{0.529686451f, 0.865380526f},
-std::array<float,2>{0.0908323452f, 0.449413478f},
-std::array<float,2>{0.415393293f, 0.531197667f},
-std::array<float,2>{0.894699574f, 0.225946993f},
-std::array<float,2>{0.86846453f, 0.76964283f},
-std::array<float,2>{0.351165265f, 0.434309214f},
-std::array<float,2>{0.206328988f, 0.580425501f},
-std::array<float,2>{0.706737459f, 0.153005734f},
-std::array<float,2>{0.601460338f, 0.638746202f},
-std::array<float,2>{0.00526781566f, 0.111911021f},
-std::array<float,2>{0.442304552f, 0.979471982f},
-std::array<float,2>{0.962095082f, 0.253663391f},
-std::array<float,2>{0.912404537f, 0.56094867f},
-std::array<float,2>{0.399379671f, 0.216452375f},
-std::array<float,2>{0.0994649157f, 0.843254507f},
-std::array<float,2>{0.536402583f, 0.490293831f},
-std::array<float,2>{0.629723847f, 0.9309659f},
-std::array<float,2>{0.155460015f, 0.335397094f},
-std::array<float,2>{0.25536114f, 0.711768031f},
-std::array<float,2>{0.763878524f, 0.0123347826f},
-std::array<float,2>{0.780653059f, 0.905749023f},
-std::array<float,2>{0.271928281f, 0.350807101f},
-std::array<float,2>{0.132146508f, 0.749139905f},
-std::array<float,2>{0.641488075f, 0.049587708f},
-std::array<float,2>{0.55188787f, 0.514465094f},
-std::array<float,2>{0.11914634f, 0.241424397f},
-std::array<float,2>{0.377666146f, 0.850565135f},
-std::array<float,2>{0.937219083f, 0.454601824f},
-std::array<float,2>{0.949652553f, 0.684976816f},
-std::array<float,2>{0.467529953f, 0.0910064504f},
-std::array<float,2>{0.0223225076f, 0.959892511f},
-std::array<float,2>{0.624426603f, 0.295697242f},
-std::array<float,2>{0.698680699f, 0.801183522f},
-std::array<float,2>{0.201119453f, 0.385652542f},
-std::array<float,2>{0.360896617f, 0.61136663f},
-std::array<float,2>{0.856617749f, 0.180618703f},
-std::array<float,2>{0.886465847f, 0.827295721f},
-std::array<float,2>{0.423423827f, 0.483455598f},
-std::array<float,2>{0.0641492307f, 0.53399837f},
-std::array<float,2>{0.515529871f, 0.201817602f},
-std::array<float,2>{0.657788932f, 0.688106954f},
-std::array<float,2>{0.163302094f, 0.024628045f},
-std::array<float,2>{0.306499064f, 0.921363354f},
-std::array<float,2>{0.786257982f, 0.323202848f},
-std::array<float,2>{0.842159092f, 0.574186206f},
-std::array<float,2>{0.323396683f, 0.13825044f},
-std::array<float,2>{0.231310651f, 0.761004806f},
-std::array<float,2>{0.73521173f, 0.408267945f},
-std::array<float,2>{0.563602209f, 0.991098285f},
-std::array<float,2>{0.046966698f, 0.275557667f},
-std::array<float,2>{0.483240157f, 0.649259806f},
-std::array<float,2>{0.98521471f, 0.102613531f},
-std::array<float,2>{0.926114559f, 0.912509739f},
-std::array<float,2>{0.385391444f, 0.31385836f},
-std::array<float,2>{0.114908427f, 0.700370908f},
-std::array<float,2>{0.56093806f, 0.0229154229f},
-std::array<float,2>{0.652206302f, 0.543306828f},
-std::array<float,2>{0.139659017f, 0.188777879f},
-std::array<float,2>{0.275433809f, 0.815957963f},
-std::array<float,2>{0.766501606f, 0.471316516f},
-std::array<float,2>{0.849973202f, 0.645780265f},
-std::array<float,2>{0.368962437f, 0.0963615626f},
-std::array<float,2>{0.188914999f, 0.996810436f},
-std::array<float,2>{0.691343367f, 0.27266863f},
-std::array<float,2>{0.615613461f, 0.75307864f},
-std::array<float,2>{0.0268703271f, 0.415253073f},
-std::array<float,2>{0.455085307f, 0.566101789f},
-std::array<float,2>{0.941300035f, 0.127777889f},
-std::array<float,2>{0.795187652f, 0.855878592f},
-std::array<float,2>{0.303934753f, 0.467218518f},
-std::array<float,2>{0.171824157f, 0.503876567f},
-std::array<float,2>{0.66601336f, 0.247671649f},
-std::array<float,2>{0.501659811f, 0.735149622f},
-std::array<float,2>{0.0771045834f, 0.0584252253f},
-std::array<float,2>{0.431343317f, 0.893658817f},
-std::array<float,2>{0.878826737f, 0.354939461f},
-std::array<float,2>{0.993674397f, 0.62248987f},
-std::array<float,2>{0.471356601f, 0.177455097f},
-std::array<float,2>{0.0573113933f, 0.807897925f},
-std::array<float,2>{0.574034452f, 0.378296047f},
-std::array<float,2>{0.744274676f, 0.96484071f},
-std::array<float,2>{0.218939379f, 0.281754315f},
-std::array<float,2>{0.320008188f, 0.676522315f},
-std::array<float,2>{0.830332994f, 0.0789478123f},
-std::array<float,2>{0.819966197f, 0.973133445f},
-std::array<float,2>{0.328311384f, 0.26562494f},
-std::array<float,2>{0.24096413f, 0.626835287f},
-std::array<float,2>{0.719549596f, 0.118799582f},
-std::array<float,2>{0.588148654f, 0.592458427f},
-std::array<float,2>{0.0400379188f, 0.143420279f},
-std::array<float,2>{0.495727658f, 0.781073093f},
-std::array<float,2>{0.983386815f, 0.426843107f},
-std::array<float,2>{0.900443077f, 0.708780169f},
-std::array<float,2>{0.410365671f, 0.00624596328f},
-std::array<float,2>{0.0810643882f, 0.925182581f},
-std::array<float,2>{0.51764375f, 0.336437196f},
-std::array<float,2>{0.681005657f, 0.833086371f},
-std::array<float,2>{0.172211483f, 0.495620698f},
-std::array<float,2>{0.29530549f, 0.548993528f},
-std::array<float,2>{0.803746402f, 0.210383892f},
-std::array<float,2>{0.956392109f, 0.795044839f},
-std::array<float,2>{0.450822979f, 0.400585264f},
-std::array<float,2>{0.00959734619f, 0.606193483f},
-std::array<float,2>{0.604707897f, 0.169738173f},
-std::array<float,2>{0.712498665f, 0.670749426f},
-std::array<float,2>{0.215299249f, 0.0704553425f},
-std::array<float,2>{0.354857445f, 0.939390421f},
-std::array<float,2>{0.860140741f, 0.302770257f},
-std::array<float,2>{0.750513375f, 0.517115474f},
-std::array<float,2>{0.260269195f, 0.233848169f},
-std::array<float,2>{0.147692114f, 0.868292511f},
-std::array<float,2>{0.637019873f, 0.438605189f},
-std::array<float,2>{0.544087946f, 0.883692861f},
-std::array<float,2>{0.104170881f, 0.364079177f},
-std::array<float,2>{0.395962387f, 0.72913301f},
-std::array<float,2>{0.91942209f, 0.0358015224f},
-std::array<float,2>{0.94273293f, 0.875428021f},
-std::array<float,2>{0.459733933f, 0.37050131f},
-std::array<float,2>{0.0304656271f, 0.72245276f},
-std::array<float,2>{0.613056421f, 0.0421169177f},
-std::array<float,2>{0.691736639f, 0.527339756f},
-std::array<float,2>{0.193592966f, 0.222051233f},
-std::array<float,2>{0.374111235f, 0.86077857f},
-std::array<float,2>{0.844058514f, 0.446630776f},
-std::array<float,2>{0.77317524f, 0.656705379f},
-std::array<float,2>{0.281247258f, 0.0665790439f},
-std::array<float,2>{0.135136351f, 0.948866904f},
-std::array<float,2>{0.653558791f, 0.311265886f},
-std::array<float,2>{0.557719707f, 0.788389325f},
-std::array<float,2>{0.111464828f, 0.396659404f},
-std::array<float,2>{0.390580207f, 0.598159611f},
-std::array<float,2>{0.92519784f, 0.163306206f},
-std::array<float,2>{0.835760355f, 0.838647366f},
-std::array<float,2>{0.314525634f, 0.487300307f},
-std::array<float,2>{0.226504728f, 0.555643559f},
-std::array<float,2>{0.749005854f, 0.21257633f},
-std::array<float,2>{0.577825487f, 0.717057228f},
-std::array<float,2>{0.0623717718f, 0.00955070369f},
-std::array<float,2>{0.476271629f, 0.934784293f},
-std::array<float,2>{0.998243332f, 0.331048191f},
-std::array<float,2>{0.882049501f, 0.584824681f},
-std::array<float,2>{0.435693026f, 0.149737984f},
-std::array<float,2>{0.0738863647f, 0.768327892f},
-std::array<float,2>{0.504349828f, 0.430919439f},
-std::array<float,2>{0.670106053f, 0.984298408f},
-std::array<float,2>{0.164947435f, 0.254839808f},
-std::array<float,2>{0.297785044f, 0.63522619f},
-std::array<float,2>{0.791769862f, 0.115142889f},
-std::array<float,2>{0.796980143f, 0.956824362f},
-std::array<float,2>{0.291042477f, 0.292266369f},
-std::array<float,2>{0.177683875f, 0.68225801f},
-std::array<float,2>{0.684667051f, 0.0877145603f},
-std::array<float,2>{0.520017505f, 0.615795612f},
-std::array<float,2>{0.0849790722f, 0.185827345f},
-std::array<float,2>{0.40936023f, 0.798167586f},
-std::array<float,2>{0.905067146f, 0.389168411f},
-std::array<float,2>{0.977830231f, 0.742680252f},
-std::array<float,2>{0.496157825f, 0.0516359098f},
-std::array<float,2>{0.0435485803f, 0.898608565f},
-std::array<float,2>{0.593711555f, 0.345641822f},
-std::array<float,2>{0.72527945f, 0.846948802f},
-std::array<float,2>{0.235975564f, 0.458248377f},
-std::array<float,2>{0.332713574f, 0.510015547f},
-std::array<float,2>{0.814117074f, 0.234606221f},
-std::array<float,2>{0.916907012f, 0.763120949f},
-std::array<float,2>{0.3909446f, 0.410462111f},
-std::array<float,2>{0.105912477f, 0.575879633f},
-std::array<float,2>{0.540199757f, 0.132974505f},
-std::array<float,2>{0.635888338f, 0.655801773f},
-std::array<float,2>{0.142806292f, 0.10582675f},
-std::array<float,2>{0.263877749f, 0.98691529f},
-std::array<float,2>{0.756876469f, 0.280383676f},
-std::array<float,2>{0.863478839f, 0.538728833f},
-std::array<float,2>{0.35624516f, 0.195991278f},
-std::array<float,2>{0.21172218f, 0.824210405f},
-std::array<float,2>{0.714915335f, 0.478187919f},
-std::array<float,2>{0.606377363f, 0.916922748f},
-std::array<float,2>{0.015451706f, 0.324382782f},
-std::array<float,2>{0.448321164f, 0.693496943f},
-std::array<float,2>{0.960118651f, 0.0296405312f},
-std::array<float,2>{0.892750204f, 0.993227065f},
-std::array<float,2>{0.41930598f, 0.268992454f},
-std::array<float,2>{0.0874529034f, 0.643312991f},
-std::array<float,2>{0.525586486f, 0.101404198f},
-std::array<float,2>{0.679488122f, 0.567037761f},
-std::array<float,2>{0.187461689f, 0.130401328f},
-std::array<float,2>{0.284806967f, 0.757787645f},
-std::array<float,2>{0.808767259f, 0.420412123f},
-std::array<float,2>{0.823295176f, 0.696485102f},
-std::array<float,2>{0.339374125f, 0.0171872694f},
-std::array<float,2>{0.244092554f, 0.909185886f},
-std::array<float,2>{0.72928381f, 0.319942594f},
-std::array<float,2>{0.585074484f, 0.816508293f},
-std::array<float,2>{0.0372465625f, 0.475931138f},
-std::array<float,2>{0.487627804f, 0.539420724f},
-std::array<float,2>{0.973748684f, 0.192833886f},
-std::array<float,2>{0.761566699f, 0.808905005f},
-std::array<float,2>{0.251320928f, 0.381081372f},
-std::array<float,2>{0.149213955f, 0.619981468f},
-std::array<float,2>{0.625786424f, 0.174326852f},
-std::array<float,2>{0.532680571f, 0.675082505f},
-std::array<float,2>{0.0955036283f, 0.0852395296f},
-std::array<float,2>{0.403905988f, 0.965699792f},
-std::array<float,2>{0.908955097f, 0.285738826f},
-std::array<float,2>{0.965617359f, 0.506647348f},
-std::array<float,2>{0.44015339f, 0.244155765f},
-std::array<float,2>{0.000359982019f, 0.853567004f},
-std::array<float,2>{0.596943557f, 0.461069971f},
-std::array<float,2>{0.710614264f, 0.89658612f},
-std::array<float,2>{0.207535475f, 0.358338505f},
-std::array<float,2>{0.346140832f, 0.739547133f},
-std::array<float,2>{0.871302426f, 0.060301207f},
-std::array<float,2>{0.853423238f, 0.927044272f},
-std::array<float,2>{0.364052564f, 0.343096226f},
-std::array<float,2>{0.196432799f, 0.70691967f},
-std::array<float,2>{0.700736582f, 0.0038873842f},
-std::array<float,2>{0.618555725f, 0.553801239f},
-std::array<float,2>{0.0194861442f, 0.203641891f},
-std::array<float,2>{0.46330148f, 0.831163585f},
-std::array<float,2>{0.946105599f, 0.496612966f},
-std::array<float,2>{0.930155218f, 0.631400585f},
-std::array<float,2>{0.380290419f, 0.12208429f},
-std::array<float,2>{0.123796515f, 0.96942997f},
-std::array<float,2>{0.547488928f, 0.260568351f},
-std::array<float,2>{0.646438122f, 0.777267575f},
-std::array<float,2>{0.126201957f, 0.424266398f},
-std::array<float,2>{0.267715275f, 0.587625623f},
-std::array<float,2>{0.774077356f, 0.145677641f},
-std::array<float,2>{0.991773367f, 0.871109843f},
-std::array<float,2>{0.477828115f, 0.441628367f},
-std::array<float,2>{0.0546337105f, 0.521662951f},
-std::array<float,2>{0.569410205f, 0.227744639f},
-std::array<float,2>{0.739997864f, 0.734080553f},
-std::array<float,2>{0.226622641f, 0.0336228684f},
-std::array<float,2>{0.325114042f, 0.88683939f},
-std::array<float,2>{0.837701082f, 0.362809509f},
-std::array<float,2>{0.78378135f, 0.60339576f},
-std::array<float,2>{0.312456995f, 0.164432436f},
-std::array<float,2>{0.156548306f, 0.790917397f},
-std::array<float,2>{0.663421631f, 0.405314565f},
-std::array<float,2>{0.509958565f, 0.943166137f},
-std::array<float,2>{0.0689031035f, 0.297187537f},
-std::array<float,2>{0.427851111f, 0.665118575f},
-std::array<float,2>{0.887370944f, 0.0744199827f},
-std::array<float,2>{0.9634462f, 0.977699578f},
-std::array<float,2>{0.445147008f, 0.251407534f},
-std::array<float,2>{0.00769549701f, 0.638557196f},
-std::array<float,2>{0.597902834f, 0.1097067f},
-std::array<float,2>{0.703735471f, 0.579751432f},
-std::array<float,2>{0.204249948f, 0.154917195f},
-std::array<float,2>{0.348082453f, 0.77201438f},
-std::array<float,2>{0.869207442f, 0.43715778f},
-std::array<float,2>{0.762661219f, 0.714319527f},
-std::array<float,2>{0.25701654f, 0.0154797686f},
-std::array<float,2>{0.154218927f, 0.933458149f},
-std::array<float,2>{0.632498443f, 0.332724899f},
-std::array<float,2>{0.537380755f, 0.840414703f},
-std::array<float,2>{0.100678861f, 0.488722295f},
-std::array<float,2>{0.401773453f, 0.559669375f},
-std::array<float,2>{0.911832452f, 0.218599856f},
-std::array<float,2>{0.827173889f, 0.78311497f},
-std::array<float,2>{0.341800123f, 0.394479811f},
-std::array<float,2>{0.24746339f, 0.595351577f},
-std::array<float,2>{0.730649114f, 0.15939638f},
-std::array<float,2>{0.578969896f, 0.660787702f},
-std::array<float,2>{0.0316725746f, 0.0632167086f},
-std::array<float,2>{0.491632789f, 0.949648082f},
-std::array<float,2>{0.970249712f, 0.307684779f},
-std::array<float,2>{0.897554755f, 0.528622389f},
-std::array<float,2>{0.416085273f, 0.223071083f},
-std::array<float,2>{0.0924295932f, 0.863912702f},
-std::array<float,2>{0.527552426f, 0.451356083f},
-std::array<float,2>{0.674199879f, 0.881269515f},
-std::array<float,2>{0.181733057f, 0.374822557f},
-std::array<float,2>{0.288095236f, 0.725987017f},
-std::array<float,2>{0.806624234f, 0.0453435108f},
-std::array<float,2>{0.787660599f, 0.91797936f},
-std::array<float,2>{0.306939811f, 0.321383774f},
-std::array<float,2>{0.161805451f, 0.690167546f},
-std::array<float,2>{0.658852577f, 0.0271074921f},
-std::array<float,2>{0.511876643f, 0.532810509f},
-std::array<float,2>{0.0653025657f, 0.201086044f},
-std::array<float,2>{0.424624264f, 0.825460374f},
-std::array<float,2>{0.883717954f, 0.480524689f},
-std::array<float,2>{0.988276541f, 0.651769936f},
-std::array<float,2>{0.482378483f, 0.103668734f},
-std::array<float,2>{0.0497831404f, 0.988731623f},
-std::array<float,2>{0.565752864f, 0.273987174f},
-std::array<float,2>{0.738021255f, 0.759272337f},
-std::array<float,2>{0.233349279f, 0.407140702f},
-std::array<float,2>{0.321937203f, 0.571112156f},
-std::array<float,2>{0.840984821f, 0.140440539f},
-std::array<float,2>{0.933682263f, 0.848979473f},
-std::array<float,2>{0.375466913f, 0.455371231f},
-std::array<float,2>{0.117646292f, 0.51297766f},
-std::array<float,2>{0.553227246f, 0.239105061f},
-std::array<float,2>{0.642615676f, 0.747953296f},
-std::array<float,2>{0.129429281f, 0.0487704501f},
-std::array<float,2>{0.269571394f, 0.902579546f},
-std::array<float,2>{0.777742386f, 0.348494947f},
-std::array<float,2>{0.858114898f, 0.6110906f},
-std::array<float,2>{0.363268226f, 0.183318272f},
-std::array<float,2>{0.201380402f, 0.802978754f},
-std::array<float,2>{0.696483672f, 0.382826149f},
-std::array<float,2>{0.62206614f, 0.957516611f},
-std::array<float,2>{0.021221621f, 0.293928295f},
-std::array<float,2>{0.465108424f, 0.686837792f},
-std::array<float,2>{0.951907694f, 0.0930623114f},
-std::array<float,2>{0.875676215f, 0.892045498f},
-std::array<float,2>{0.432745218f, 0.353023827f},
-std::array<float,2>{0.0759206116f, 0.737368047f},
-std::array<float,2>{0.503517926f, 0.0548177324f},
-std::array<float,2>{0.666901171f, 0.500367701f},
-std::array<float,2>{0.16833882f, 0.248641193f},
-std::array<float,2>{0.301202565f, 0.858968139f},
-std::array<float,2>{0.79451865f, 0.465643495f},
-std::array<float,2>{0.829374433f, 0.67865181f},
-std::array<float,2>{0.317441821f, 0.0803269148f},
-std::array<float,2>{0.221972644f, 0.961613417f},
-std::array<float,2>{0.743786097f, 0.284294397f},
-std::array<float,2>{0.571555853f, 0.805352211f},
-std::array<float,2>{0.0549322702f, 0.375658542f},
-std::array<float,2>{0.470435828f, 0.623773575f},
-std::array<float,2>{0.99515444f, 0.178252131f},
-std::array<float,2>{0.769440711f, 0.81392777f},
-std::array<float,2>{0.274996579f, 0.468775183f},
-std::array<float,2>{0.137504533f, 0.545227408f},
-std::array<float,2>{0.649641216f, 0.190371543f},
-std::array<float,2>{0.559352994f, 0.702307045f},
-std::array<float,2>{0.11662697f, 0.0205832887f},
-std::array<float,2>{0.383511931f, 0.911649764f},
-std::array<float,2>{0.929274499f, 0.314593583f},
-std::array<float,2>{0.93805635f, 0.56387639f},
-std::array<float,2>{0.453430057f, 0.126056969f},
-std::array<float,2>{0.0243601147f, 0.750012398f},
-std::array<float,2>{0.614376545f, 0.416880995f},
-std::array<float,2>{0.689288437f, 0.999717534f},
-std::array<float,2>{0.191300645f, 0.271390408f},
-std::array<float,2>{0.370965362f, 0.647908211f},
-std::array<float,2>{0.84945637f, 0.0954064727f},
-std::array<float,2>{0.862672687f, 0.940945446f},
-std::array<float,2>{0.352713406f, 0.302026093f},
-std::array<float,2>{0.217490643f, 0.668359458f},
-std::array<float,2>{0.713259637f, 0.072813727f},
-std::array<float,2>{0.602161705f, 0.608768761f},
-std::array<float,2>{0.0110937888f, 0.170281544f},
-std::array<float,2>{0.451392442f, 0.794732511f},
-std::array<float,2>{0.953250408f, 0.39855653f},
-std::array<float,2>{0.921606481f, 0.727144659f},
-std::array<float,2>{0.396809489f, 0.0377518386f},
-std::array<float,2>{0.102367334f, 0.885892928f},
-std::array<float,2>{0.54517889f, 0.367167562f},
-std::array<float,2>{0.639172077f, 0.870674968f},
-std::array<float,2>{0.14507167f, 0.441398323f},
-std::array<float,2>{0.258938134f, 0.518097222f},
-std::array<float,2>{0.75231272f, 0.231458411f},
-std::array<float,2>{0.980538309f, 0.777774215f},
-std::array<float,2>{0.493588507f, 0.428576171f},
-std::array<float,2>{0.0427879952f, 0.59036541f},
-std::array<float,2>{0.586823225f, 0.141279757f},
-std::array<float,2>{0.722602963f, 0.627135754f},
-std::array<float,2>{0.238285467f, 0.119509868f},
-std::array<float,2>{0.330997616f, 0.975982606f},
-std::array<float,2>{0.817692757f, 0.262081385f},
-std::array<float,2>{0.802307844f, 0.547257841f},
-std::array<float,2>{0.294176668f, 0.20882757f},
-std::array<float,2>{0.174393401f, 0.834183991f},
-std::array<float,2>{0.683261573f, 0.492557108f},
-std::array<float,2>{0.516933858f, 0.923315048f},
-std::array<float,2>{0.0785470009f, 0.339227974f},
-std::array<float,2>{0.413827419f, 0.709350646f},
-std::array<float,2>{0.898701727f, 0.005059761f},
-std::array<float,2>{0.997414768f, 0.937469542f},
-std::array<float,2>{0.474118441f, 0.32976988f},
-std::array<float,2>{0.0591990054f, 0.715628564f},
-std::array<float,2>{0.574335515f, 0.0103685977f},
-std::array<float,2>{0.746437073f, 0.556766748f},
-std::array<float,2>{0.223981068f, 0.213104114f},
-std::array<float,2>{0.314277649f, 0.836131334f},
-std::array<float,2>{0.832607448f, 0.486262918f},
-std::array<float,2>{0.790832162f, 0.634655654f},
-std::array<float,2>{0.299554795f, 0.116117731f},
-std::array<float,2>{0.167552724f, 0.980488241f},
-std::array<float,2>{0.669535637f, 0.256684691f},
-std::array<float,2>{0.506867945f, 0.767212451f},
-std::array<float,2>{0.071688056f, 0.432598054f},
-std::array<float,2>{0.435146213f, 0.583889961f},
-std::array<float,2>{0.87903434f, 0.150458992f},
-std::array<float,2>{0.846820652f, 0.861974239f},
-std::array<float,2>{0.372032851f, 0.447419435f},
-std::array<float,2>{0.19332242f, 0.523589492f},
-std::array<float,2>{0.694960296f, 0.219911531f},
-std::array<float,2>{0.611135244f, 0.720532179f},
-std::array<float,2>{0.0274442583f, 0.0394308083f},
-std::array<float,2>{0.458028734f, 0.877625644f},
-std::array<float,2>{0.94455862f, 0.368227512f},
-std::array<float,2>{0.922790408f, 0.60134989f},
-std::array<float,2>{0.388605565f, 0.160811529f},
-std::array<float,2>{0.109503381f, 0.786386907f},
-std::array<float,2>{0.555202961f, 0.395037532f},
-std::array<float,2>{0.654457748f, 0.946174443f},
-std::array<float,2>{0.133533493f, 0.309551209f},
-std::array<float,2>{0.279250264f, 0.658510268f},
-std::array<float,2>{0.770279706f, 0.0693029091f},
-std::array<float,2>{0.755546808f, 0.984928548f},
-std::array<float,2>{0.262572706f, 0.279082656f},
-std::array<float,2>{0.14225173f, 0.653824627f},
-std::array<float,2>{0.634436369f, 0.108726218f},
-std::array<float,2>{0.542238712f, 0.57664752f},
-std::array<float,2>{0.10912741f, 0.136686131f},
-std::array<float,2>{0.393707693f, 0.764381647f},
-std::array<float,2>{0.915306866f, 0.412911415f},
-std::array<float,2>{0.957931161f, 0.69172895f},
-std::array<float,2>{0.445446521f, 0.0285999533f},
-std::array<float,2>{0.0118768988f, 0.9150334f},
-std::array<float,2>{0.608996332f, 0.326488733f},
-std::array<float,2>{0.717735648f, 0.821137786f},
-std::array<float,2>{0.213449627f, 0.479854852f},
-std::array<float,2>{0.359213054f, 0.536294937f},
-std::array<float,2>{0.865550935f, 0.197815463f},
-std::array<float,2>{0.903844833f, 0.800535381f},
-std::array<float,2>{0.406461298f, 0.386794955f},
-std::array<float,2>{0.0822199732f, 0.614165485f},
-std::array<float,2>{0.522069812f, 0.183732122f},
-std::array<float,2>{0.687118888f, 0.681589961f},
-std::array<float,2>{0.179456443f, 0.088328056f},
-std::array<float,2>{0.29053244f, 0.9543643f},
-std::array<float,2>{0.799906731f, 0.290269256f},
-std::array<float,2>{0.815160275f, 0.50813055f},
-std::array<float,2>{0.335390806f, 0.237884894f},
-std::array<float,2>{0.236951038f, 0.843778372f},
-std::array<float,2>{0.723952889f, 0.45926252f},
-std::array<float,2>{0.590510488f, 0.901049554f},
-std::array<float,2>{0.0450254083f, 0.346569866f},
-std::array<float,2>{0.498576075f, 0.744877994f},
-std::array<float,2>{0.979781866f, 0.0545292161f},
-std::array<float,2>{0.907068789f, 0.967673182f},
-std::array<float,2>{0.404372483f, 0.287221372f},
-std::array<float,2>{0.09668383f, 0.671901822f},
-std::array<float,2>{0.533213139f, 0.0831055641f},
-std::array<float,2>{0.627133191f, 0.619070053f},
-std::array<float,2>{0.151873454f, 0.172559559f},
-std::array<float,2>{0.252530307f, 0.81167388f},
-std::array<float,2>{0.758090436f, 0.379948109f},
-std::array<float,2>{0.874331295f, 0.740425229f},
-std::array<float,2>{0.344367057f, 0.0614786372f},
-std::array<float,2>{0.209896594f, 0.89598453f},
-std::array<float,2>{0.708769321f, 0.355601639f},
-std::array<float,2>{0.595463872f, 0.852658808f},
-std::array<float,2>{0.00263154157f, 0.464580357f},
-std::array<float,2>{0.438353807f, 0.503997266f},
-std::array<float,2>{0.967727721f, 0.243610844f},
-std::array<float,2>{0.81056118f, 0.754324913f},
-std::array<float,2>{0.281401396f, 0.419792384f},
-std::array<float,2>{0.184828684f, 0.568530679f},
-std::array<float,2>{0.677013159f, 0.131494284f},
-std::array<float,2>{0.524864733f, 0.642116547f},
-std::array<float,2>{0.0888031647f, 0.0982006267f},
-std::array<float,2>{0.42098394f, 0.995104074f},
-std::array<float,2>{0.890794218f, 0.266894609f},
-std::array<float,2>{0.974877596f, 0.542233467f},
-std::array<float,2>{0.486105084f, 0.194630414f},
-std::array<float,2>{0.037079189f, 0.818632543f},
-std::array<float,2>{0.582855582f, 0.472767889f},
-std::array<float,2>{0.726928055f, 0.906759441f},
-std::array<float,2>{0.24505946f, 0.317133427f},
-std::array<float,2>{0.337384164f, 0.698506892f},
-std::array<float,2>{0.821612179f, 0.0194904394f},
-std::array<float,2>{0.839707315f, 0.889526486f},
-std::array<float,2>{0.32650429f, 0.360574871f},
-std::array<float,2>{0.229834467f, 0.731284261f},
-std::array<float,2>{0.741395295f, 0.0329424404f},
-std::array<float,2>{0.568094611f, 0.519619107f},
-std::array<float,2>{0.0510076284f, 0.230396584f},
-std::array<float,2>{0.47938326f, 0.873944104f},
-std::array<float,2>{0.988438368f, 0.444748104f},
-std::array<float,2>{0.889471054f, 0.66611129f},
-std::array<float,2>{0.426774025f, 0.0776237249f},
-std::array<float,2>{0.0671217516f, 0.945023954f},
-std::array<float,2>{0.508171022f, 0.299218059f},
-std::array<float,2>{0.661313415f, 0.79175365f},
-std::array<float,2>{0.158274621f, 0.404038101f},
-std::array<float,2>{0.308849871f, 0.604875147f},
-std::array<float,2>{0.781776488f, 0.167479381f},
-std::array<float,2>{0.948230565f, 0.829819977f},
-std::array<float,2>{0.461387813f, 0.49912101f},
-std::array<float,2>{0.0170871373f, 0.551746726f},
-std::array<float,2>{0.619629443f, 0.206820458f},
-std::array<float,2>{0.702584803f, 0.703428686f},
-std::array<float,2>{0.198364586f, 0.00192664168f},
-std::array<float,2>{0.365805835f, 0.929557502f},
-std::array<float,2>{0.854248166f, 0.341199636f},
-std::array<float,2>{0.776546419f, 0.58942318f},
-std::array<float,2>{0.265927672f, 0.147874191f},
-std::array<float,2>{0.128375486f, 0.77390027f},
-std::array<float,2>{0.648279727f, 0.423794031f},
-std::array<float,2>{0.550769448f, 0.971398413f},
-std::array<float,2>{0.121860228f, 0.259304583f},
-std::array<float,2>{0.380924076f, 0.629206538f},
-std::array<float,2>{0.933279574f, 0.12370763f},
-std::array<float,2>{0.982689381f, 0.976528287f},
-std::array<float,2>{0.495298833f, 0.262500674f},
-std::array<float,2>{0.0395437703f, 0.627542317f},
-std::array<float,2>{0.58846128f, 0.119764447f},
-std::array<float,2>{0.719081044f, 0.590191364f},
-std::array<float,2>{0.240256131f, 0.140736371f},
-std::array<float,2>{0.328860283f, 0.778245389f},
-std::array<float,2>{0.81961745f, 0.428089291f},
-std::array<float,2>{0.804341137f, 0.709668994f},
-std::array<float,2>{0.295440584f, 0.00563564105f},
-std::array<float,2>{0.172552004f, 0.923506021f},
-std::array<float,2>{0.681484759f, 0.339544237f},
-std::array<float,2>{0.518095315f, 0.83459878f},
-std::array<float,2>{0.0819608793f, 0.493011504f},
-std::array<float,2>{0.410920292f, 0.547391534f},
-std::array<float,2>{0.901111662f, 0.208369732f},
-std::array<float,2>{0.85954845f, 0.793970108f},
-std::array<float,2>{0.355223f, 0.399157554f},
-std::array<float,2>{0.215789169f, 0.609202027f},
-std::array<float,2>{0.712269843f, 0.170892373f},
-std::array<float,2>{0.605192602f, 0.668698609f},
-std::array<float,2>{0.0089106895f, 0.0723243356f},
-std::array<float,2>{0.450307369f, 0.940700054f},
-std::array<float,2>{0.95661068f, 0.302495807f},
-std::array<float,2>{0.919631898f, 0.51788187f},
-std::array<float,2>{0.396055579f, 0.232002899f},
-std::array<float,2>{0.103730865f, 0.870265305f},
-std::array<float,2>{0.544802308f, 0.440447688f},
-std::array<float,2>{0.637331009f, 0.886652827f},
-std::array<float,2>{0.148302108f, 0.366379678f},
-std::array<float,2>{0.259938687f, 0.72658813f},
-std::array<float,2>{0.750453055f, 0.0371494256f},
-std::array<float,2>{0.765773177f, 0.911386669f},
-std::array<float,2>{0.276009142f, 0.315301657f},
-std::array<float,2>{0.140557364f, 0.702973366f},
-std::array<float,2>{0.651423216f, 0.0212170929f},
-std::array<float,2>{0.561476111f, 0.545787811f},
-std::array<float,2>{0.114598669f, 0.189458281f},
-std::array<float,2>{0.384925455f, 0.81426996f},
-std::array<float,2>{0.92630893f, 0.469318479f},
-std::array<float,2>{0.940838277f, 0.648424685f},
-std::array<float,2>{0.455983758f, 0.095129624f},
-std::array<float,2>{0.0268034693f, 0.999036372f},
-std::array<float,2>{0.615826011f, 0.270905435f},
-std::array<float,2>{0.690580904f, 0.75074482f},
-std::array<float,2>{0.189348489f, 0.416021585f},
-std::array<float,2>{0.368513912f, 0.564297855f},
-std::array<float,2>{0.85016346f, 0.126836434f},
-std::array<float,2>{0.878377616f, 0.858416259f},
-std::array<float,2>{0.430682629f, 0.465178043f},
-std::array<float,2>{0.0761989877f, 0.500763416f},
-std::array<float,2>{0.50104028f, 0.248350576f},
-std::array<float,2>{0.665307939f, 0.737972975f},
-std::array<float,2>{0.171166971f, 0.0554453805f},
-std::array<float,2>{0.304670781f, 0.89239347f},
-std::array<float,2>{0.795828521f, 0.353430867f},
-std::array<float,2>{0.830720484f, 0.623455942f},
-std::array<float,2>{0.319640428f, 0.177811652f},
-std::array<float,2>{0.219299003f, 0.805009902f},
-std::array<float,2>{0.744632065f, 0.375048578f},
-std::array<float,2>{0.573405564f, 0.961317897f},
-std::array<float,2>{0.0569992624f, 0.284826517f},
-std::array<float,2>{0.471019119f, 0.678138196f},
-std::array<float,2>{0.993633747f, 0.0806676671f},
-std::array<float,2>{0.93677628f, 0.903120279f},
-std::array<float,2>{0.377069443f, 0.347950101f},
-std::array<float,2>{0.119802371f, 0.747350216f},
-std::array<float,2>{0.552496672f, 0.0480597876f},
-std::array<float,2>{0.640995026f, 0.513342381f},
-std::array<float,2>{0.132472873f, 0.238704205f},
-std::array<float,2>{0.272444248f, 0.849358201f},
-std::array<float,2>{0.780954361f, 0.455804259f},
-std::array<float,2>{0.857044637f, 0.687493265f},
-std::array<float,2>{0.360363811f, 0.0936907381f},
-std::array<float,2>{0.200576261f, 0.95763433f},
-std::array<float,2>{0.699073434f, 0.293013871f},
-std::array<float,2>{0.624955177f, 0.803402126f},
-std::array<float,2>{0.0218614228f, 0.383480817f},
-std::array<float,2>{0.466914415f, 0.610738933f},
-std::array<float,2>{0.950055718f, 0.183071971f},
-std::array<float,2>{0.786980152f, 0.825991094f},
-std::array<float,2>{0.305803269f, 0.481254369f},
-std::array<float,2>{0.164024368f, 0.532236934f},
-std::array<float,2>{0.657341838f, 0.200477883f},
-std::array<float,2>{0.515077949f, 0.689597249f},
-std::array<float,2>{0.063499935f, 0.026530996f},
-std::array<float,2>{0.423155606f, 0.918518066f},
-std::array<float,2>{0.88610512f, 0.321822435f},
-std::array<float,2>{0.984646738f, 0.570314944f},
-std::array<float,2>{0.48257789f, 0.139999658f},
-std::array<float,2>{0.0476831347f, 0.759583771f},
-std::array<float,2>{0.564304113f, 0.406326056f},
-std::array<float,2>{0.734636366f, 0.989100277f},
-std::array<float,2>{0.230743974f, 0.273632914f},
-std::array<float,2>{0.323853314f, 0.651913762f},
-std::array<float,2>{0.842739701f, 0.104465686f},
-std::array<float,2>{0.824739337f, 0.950065792f},
-std::array<float,2>{0.340702355f, 0.308419943f},
-std::array<float,2>{0.249310777f, 0.660224617f},
-std::array<float,2>{0.733976305f, 0.0629341677f},
-std::array<float,2>{0.581033885f, 0.594911575f},
-std::array<float,2>{0.0340955481f, 0.159985408f},
-std::array<float,2>{0.488970011f, 0.782354653f},
-std::array<float,2>{0.972509384f, 0.393745542f},
-std::array<float,2>{0.895421028f, 0.726169109f},
-std::array<float,2>{0.415619999f, 0.0458108746f},
-std::array<float,2>{0.0914504677f, 0.881443143f},
-std::array<float,2>{0.530032575f, 0.374386728f},
-std::array<float,2>{0.671887755f, 0.863458157f},
-std::array<float,2>{0.181384534f, 0.452006042f},
-std::array<float,2>{0.286259919f, 0.529151142f},
-std::array<float,2>{0.808336914f, 0.223538697f},
-std::array<float,2>{0.962869346f, 0.771810591f},
-std::array<float,2>{0.441770971f, 0.436968058f},
-std::array<float,2>{0.00580202928f, 0.579408824f},
-std::array<float,2>{0.600633383f, 0.154424712f},
-std::array<float,2>{0.706320286f, 0.637901008f},
-std::array<float,2>{0.206851318f, 0.109873377f},
-std::array<float,2>{0.350627512f, 0.978073239f},
-std::array<float,2>{0.868818462f, 0.251687378f},
-std::array<float,2>{0.764372945f, 0.560352266f},
-std::array<float,2>{0.255524665f, 0.21786882f},
-std::array<float,2>{0.156144634f, 0.840168774f},
-std::array<float,2>{0.62899369f, 0.489151984f},
-std::array<float,2>{0.536885619f, 0.932862043f},
-std::array<float,2>{0.0990381092f, 0.332162738f},
-std::array<float,2>{0.398572266f, 0.714772642f},
-std::array<float,2>{0.913057625f, 0.0146638006f},
-std::array<float,2>{0.945325792f, 0.929178357f},
-std::array<float,2>{0.463399857f, 0.341386586f},
-std::array<float,2>{0.018852964f, 0.703890324f},
-std::array<float,2>{0.619016588f, 0.0012649399f},
-std::array<float,2>{0.70035553f, 0.551135778f},
-std::array<float,2>{0.196884871f, 0.206157818f},
-std::array<float,2>{0.363762945f, 0.82912904f},
-std::array<float,2>{0.852772355f, 0.499818563f},
-std::array<float,2>{0.773532391f, 0.629803956f},
-std::array<float,2>{0.268470556f, 0.123335823f},
-std::array<float,2>{0.126807019f, 0.970886052f},
-std::array<float,2>{0.645683825f, 0.259244949f},
-std::array<float,2>{0.547340274f, 0.774315953f},
-std::array<float,2>{0.123451769f, 0.4231745f},
-std::array<float,2>{0.380756974f, 0.589220881f},
-std::array<float,2>{0.930343866f, 0.14822574f},
-std::array<float,2>{0.837024629f, 0.873449564f},
-std::array<float,2>{0.32442525f, 0.445077091f},
-std::array<float,2>{0.22707893f, 0.520160794f},
-std::array<float,2>{0.739278316f, 0.229558393f},
-std::array<float,2>{0.570023596f, 0.730899811f},
-std::array<float,2>{0.0538482778f, 0.0323430747f},
-std::array<float,2>{0.478314728f, 0.888768077f},
-std::array<float,2>{0.991270304f, 0.360901088f},
-std::array<float,2>{0.886807382f, 0.605273962f},
-std::array<float,2>{0.428512454f, 0.167509899f},
-std::array<float,2>{0.0688416511f, 0.791265488f},
-std::array<float,2>{0.510509312f, 0.40336132f},
-std::array<float,2>{0.664055824f, 0.944713295f},
-std::array<float,2>{0.156778246f, 0.299318045f},
-std::array<float,2>{0.311857939f, 0.666801214f},
-std::array<float,2>{0.78364718f, 0.0777727216f},
-std::array<float,2>{0.809532225f, 0.994527817f},
-std::array<float,2>{0.284200162f, 0.267161101f},
-std::array<float,2>{0.186554253f, 0.642074466f},
-std::array<float,2>{0.679034829f, 0.0981320515f},
-std::array<float,2>{0.526335955f, 0.568869948f},
-std::array<float,2>{0.0870943367f, 0.130915463f},
-std::array<float,2>{0.419454962f, 0.754507124f},
-std::array<float,2>{0.893384337f, 0.41919297f},
-std::array<float,2>{0.974430323f, 0.69912833f},
-std::array<float,2>{0.487910926f, 0.0188886542f},
-std::array<float,2>{0.0379924178f, 0.906380653f},
-std::array<float,2>{0.585894823f, 0.316883445f},
-std::array<float,2>{0.728843153f, 0.819186211f},
-std::array<float,2>{0.243266582f, 0.47355485f},
-std::array<float,2>{0.339051455f, 0.542531252f},
-std::array<float,2>{0.823899508f, 0.195195809f},
-std::array<float,2>{0.908547342f, 0.812358141f},
-std::array<float,2>{0.40348351f, 0.380789906f},
-std::array<float,2>{0.0951976851f, 0.618178248f},
-std::array<float,2>{0.533061624f, 0.172011673f},
-std::array<float,2>{0.625291049f, 0.672656417f},
-std::array<float,2>{0.148864925f, 0.0837907642f},
-std::array<float,2>{0.251540989f, 0.966827989f},
-std::array<float,2>{0.761054516f, 0.287796229f},
-std::array<float,2>{0.871972322f, 0.504852355f},
-std::array<float,2>{0.346280098f, 0.244067952f},
-std::array<float,2>{0.207193807f, 0.853313744f},
-std::array<float,2>{0.709994435f, 0.464278817f},
-std::array<float,2>{0.59758383f, 0.896032751f},
-std::array<float,2>{0.000557809835f, 0.356368005f},
-std::array<float,2>{0.439907402f, 0.740837216f},
-std::array<float,2>{0.965017796f, 0.0605832413f},
-std::array<float,2>{0.90470624f, 0.954643667f},
-std::array<float,2>{0.409878671f, 0.290682256f},
-std::array<float,2>{0.0858259946f, 0.681039453f},
-std::array<float,2>{0.520031035f, 0.0887352824f},
-std::array<float,2>{0.685094595f, 0.613534987f},
-std::array<float,2>{0.176852033f, 0.184289455f},
-std::array<float,2>{0.291929513f, 0.800202906f},
-std::array<float,2>{0.797626495f, 0.387436628f},
-std::array<float,2>{0.813730001f, 0.744215429f},
-std::array<float,2>{0.332417548f, 0.0541221984f},
-std::array<float,2>{0.23570767f, 0.900654972f},
-std::array<float,2>{0.725090861f, 0.345883131f},
-std::array<float,2>{0.592796624f, 0.844634891f},
-std::array<float,2>{0.0430801399f, 0.459918708f},
-std::array<float,2>{0.496684432f, 0.508325338f},
-std::array<float,2>{0.978248179f, 0.237600967f},
-std::array<float,2>{0.757692456f, 0.763957262f},
-std::array<float,2>{0.26416871f, 0.412296563f},
-std::array<float,2>{0.143150896f, 0.577037811f},
-std::array<float,2>{0.636536062f, 0.135821462f},
-std::array<float,2>{0.540595412f, 0.653501332f},
-std::array<float,2>{0.106077224f, 0.108895302f},
-std::array<float,2>{0.391393065f, 0.984722018f},
-std::array<float,2>{0.916483223f, 0.278403848f},
-std::array<float,2>{0.960757315f, 0.53698045f},
-std::array<float,2>{0.449211329f, 0.19746615f},
-std::array<float,2>{0.0150055299f, 0.820325494f},
-std::array<float,2>{0.605490267f, 0.48041898f},
-std::array<float,2>{0.715694666f, 0.914339542f},
-std::array<float,2>{0.211204067f, 0.327105075f},
-std::array<float,2>{0.355793089f, 0.692115724f},
-std::array<float,2>{0.863883376f, 0.0292394329f},
-std::array<float,2>{0.844300032f, 0.876988709f},
-std::array<float,2>{0.374950975f, 0.368678987f},
-std::array<float,2>{0.194153085f, 0.720071971f},
-std::array<float,2>{0.69202441f, 0.0398795158f},
-std::array<float,2>{0.612701595f, 0.524075449f},
-std::array<float,2>{0.0312499087f, 0.220453829f},
-std::array<float,2>{0.459395558f, 0.861498713f},
-std::array<float,2>{0.943305373f, 0.447959989f},
-std::array<float,2>{0.925775051f, 0.658959746f},
-std::array<float,2>{0.389843732f, 0.0688105747f},
-std::array<float,2>{0.112185605f, 0.945607245f},
-std::array<float,2>{0.558151007f, 0.308811694f},
-std::array<float,2>{0.654277027f, 0.786948681f},
-std::array<float,2>{0.135495141f, 0.394715488f},
-std::array<float,2>{0.280276716f, 0.600824356f},
-std::array<float,2>{0.772780836f, 0.160215154f},
-std::array<float,2>{0.998996854f, 0.836457491f},
-std::array<float,2>{0.475684077f, 0.48537311f},
-std::array<float,2>{0.0617921278f, 0.55731082f},
-std::array<float,2>{0.577628672f, 0.213506058f},
-std::array<float,2>{0.748081386f, 0.714975774f},
-std::array<float,2>{0.22568813f, 0.0101236627f},
-std::array<float,2>{0.315252513f, 0.936686456f},
-std::array<float,2>{0.835051417f, 0.329284698f},
-std::array<float,2>{0.791369379f, 0.583239675f},
-std::array<float,2>{0.297170281f, 0.151067808f},
-std::array<float,2>{0.164424345f, 0.766694784f},
-std::array<float,2>{0.670493841f, 0.431695074f},
-std::array<float,2>{0.504721403f, 0.980997562f},
-std::array<float,2>{0.0734684616f, 0.256217122f},
-std::array<float,2>{0.436381519f, 0.63411051f},
-std::array<float,2>{0.882476509f, 0.115560256f},
-std::array<float,2>{0.953902602f, 0.938600779f},
-std::array<float,2>{0.451870382f, 0.30358389f},
-std::array<float,2>{0.011424819f, 0.670280576f},
-std::array<float,2>{0.601622403f, 0.0709338784f},
-std::array<float,2>{0.713553309f, 0.605693221f},
-std::array<float,2>{0.217097536f, 0.169038847f},
-std::array<float,2>{0.353323013f, 0.795802295f},
-std::array<float,2>{0.862892628f, 0.401139528f},
-std::array<float,2>{0.752617538f, 0.728689849f},
-std::array<float,2>{0.259657502f, 0.0351772085f},
-std::array<float,2>{0.144740611f, 0.883291304f},
-std::array<float,2>{0.638701141f, 0.363476515f},
-std::array<float,2>{0.545858741f, 0.869119406f},
-std::array<float,2>{0.101890989f, 0.438975632f},
-std::array<float,2>{0.397141397f, 0.516796172f},
-std::array<float,2>{0.921039104f, 0.234094352f},
-std::array<float,2>{0.818259537f, 0.780506313f},
-std::array<float,2>{0.330350637f, 0.427420467f},
-std::array<float,2>{0.238937229f, 0.592202544f},
-std::array<float,2>{0.721768022f, 0.142739013f},
-std::array<float,2>{0.586276472f, 0.626409948f},
-std::array<float,2>{0.0421737991f, 0.118212357f},
-std::array<float,2>{0.493759423f, 0.973377705f},
-std::array<float,2>{0.981294453f, 0.264826745f},
-std::array<float,2>{0.899219453f, 0.549362242f},
-std::array<float,2>{0.413400084f, 0.210756198f},
-std::array<float,2>{0.0787995383f, 0.833757937f},
-std::array<float,2>{0.517488003f, 0.495155901f},
-std::array<float,2>{0.682793319f, 0.925612032f},
-std::array<float,2>{0.17402637f, 0.336041868f},
-std::array<float,2>{0.294820189f, 0.708478987f},
-std::array<float,2>{0.801975369f, 0.00653397385f},
-std::array<float,2>{0.794181764f, 0.894138694f},
-std::array<float,2>{0.301544368f, 0.355156243f},
-std::array<float,2>{0.168864757f, 0.734458327f},
-std::array<float,2>{0.66642344f, 0.0579023659f},
-std::array<float,2>{0.503306925f, 0.502953887f},
-std::array<float,2>{0.0753247365f, 0.247338578f},
-std::array<float,2>{0.433520794f, 0.856343746f},
-std::array<float,2>{0.875124872f, 0.467395604f},
-std::array<float,2>{0.99583602f, 0.676158071f},
-std::array<float,2>{0.470048636f, 0.0781547576f},
-std::array<float,2>{0.0553612746f, 0.964138687f},
-std::array<float,2>{0.572228074f, 0.281421185f},
-std::array<float,2>{0.743282497f, 0.808368266f},
-std::array<float,2>{0.22220777f, 0.378856182f},
-std::array<float,2>{0.318199873f, 0.623002648f},
-std::array<float,2>{0.82979244f, 0.177134499f},
-std::array<float,2>{0.929161787f, 0.815707028f},
-std::array<float,2>{0.382883638f, 0.471030354f},
-std::array<float,2>{0.116915807f, 0.543897271f},
-std::array<float,2>{0.558962941f, 0.189199865f},
-std::array<float,2>{0.650238872f, 0.700841308f},
-std::array<float,2>{0.136999562f, 0.0230643637f},
-std::array<float,2>{0.274516642f, 0.912814796f},
-std::array<float,2>{0.768579304f, 0.314394861f},
-std::array<float,2>{0.848712862f, 0.565510392f},
-std::array<float,2>{0.370254368f, 0.126995653f},
-std::array<float,2>{0.190758631f, 0.753885329f},
-std::array<float,2>{0.688716888f, 0.415858448f},
-std::array<float,2>{0.615135789f, 0.996248662f},
-std::array<float,2>{0.0235852879f, 0.273279756f},
-std::array<float,2>{0.453899473f, 0.646478295f},
-std::array<float,2>{0.937612236f, 0.0957060009f},
-std::array<float,2>{0.882829309f, 0.921403527f},
-std::array<float,2>{0.423985958f, 0.322401673f},
-std::array<float,2>{0.0648811683f, 0.687818468f},
-std::array<float,2>{0.512626767f, 0.0250545051f},
-std::array<float,2>{0.658393919f, 0.533492267f},
-std::array<float,2>{0.161275536f, 0.201579258f},
-std::array<float,2>{0.307195336f, 0.828012228f},
-std::array<float,2>{0.787316442f, 0.484076887f},
-std::array<float,2>{0.841548443f, 0.648525f},
-std::array<float,2>{0.321538091f, 0.103480287f},
-std::array<float,2>{0.232565954f, 0.990397811f},
-std::array<float,2>{0.737459421f, 0.276339114f},
-std::array<float,2>{0.566263437f, 0.761565864f},
-std::array<float,2>{0.0492884368f, 0.408916116f},
-std::array<float,2>{0.481462151f, 0.57372272f},
-std::array<float,2>{0.987547994f, 0.137892529f},
-std::array<float,2>{0.778165877f, 0.849725664f},
-std::array<float,2>{0.270161599f, 0.454174459f},
-std::array<float,2>{0.129384011f, 0.513949931f},
-std::array<float,2>{0.643117547f, 0.24210611f},
-std::array<float,2>{0.553045928f, 0.749891281f},
-std::array<float,2>{0.117685929f, 0.0492557064f},
-std::array<float,2>{0.375527591f, 0.905985177f},
-std::array<float,2>{0.934123397f, 0.351352364f},
-std::array<float,2>{0.951360047f, 0.611835063f},
-std::array<float,2>{0.465735465f, 0.180159315f},
-std::array<float,2>{0.020677885f, 0.80171138f},
-std::array<float,2>{0.621206582f, 0.38492915f},
-std::array<float,2>{0.697190762f, 0.959330738f},
-std::array<float,2>{0.202011466f, 0.295295f},
-std::array<float,2>{0.362305254f, 0.685219586f},
-std::array<float,2>{0.857546687f, 0.0913951546f},
-std::array<float,2>{0.869691432f, 0.978857636f},
-std::array<float,2>{0.348524421f, 0.253324628f},
-std::array<float,2>{0.204599366f, 0.639240623f},
-std::array<float,2>{0.703514934f, 0.111361288f},
-std::array<float,2>{0.598235607f, 0.581019044f},
-std::array<float,2>{0.00715479907f, 0.152465954f},
-std::array<float,2>{0.444371194f, 0.770411611f},
-std::array<float,2>{0.963055551f, 0.433696777f},
-std::array<float,2>{0.911479652f, 0.710966229f},
-std::array<float,2>{0.402311325f, 0.0118186772f},
-std::array<float,2>{0.10129194f, 0.93128109f},
-std::array<float,2>{0.537880778f, 0.335854799f},
-std::array<float,2>{0.632064879f, 0.843735993f},
-std::array<float,2>{0.153459787f, 0.490863144f},
-std::array<float,2>{0.257342696f, 0.561326325f},
-std::array<float,2>{0.762146652f, 0.215947703f},
-std::array<float,2>{0.970121086f, 0.785075307f},
-std::array<float,2>{0.491970003f, 0.391170353f},
-std::array<float,2>{0.0318220034f, 0.597259223f},
-std::array<float,2>{0.578128099f, 0.157506585f},
-std::array<float,2>{0.731331527f, 0.663330615f},
-std::array<float,2>{0.247953594f, 0.0652235448f},
-std::array<float,2>{0.342296153f, 0.952858686f},
-std::array<float,2>{0.827923298f, 0.305314749f},
-std::array<float,2>{0.806040823f, 0.530427337f},
-std::array<float,2>{0.288857073f, 0.226525635f},
-std::array<float,2>{0.182195812f, 0.866016507f},
-std::array<float,2>{0.67472446f, 0.450146973f},
-std::array<float,2>{0.528024435f, 0.87956655f},
-std::array<float,2>{0.0919617116f, 0.372557998f},
-std::array<float,2>{0.416834325f, 0.724578083f},
-std::array<float,2>{0.89802742f, 0.0435863771f},
-std::array<float,2>{0.989046335f, 0.88740015f},
-std::array<float,2>{0.478523314f, 0.362780094f},
-std::array<float,2>{0.0516237803f, 0.733876348f},
-std::array<float,2>{0.56785053f, 0.0340291373f},
-std::array<float,2>{0.742160082f, 0.522454321f},
-std::array<float,2>{0.230326265f, 0.228253424f},
-std::array<float,2>{0.327125728f, 0.871662617f},
-std::array<float,2>{0.839028478f, 0.441922545f},
-std::array<float,2>{0.781598032f, 0.66572094f},
-std::array<float,2>{0.309233606f, 0.0750847533f},
-std::array<float,2>{0.158724099f, 0.942527711f},
-std::array<float,2>{0.661856234f, 0.297436267f},
-std::array<float,2>{0.508488297f, 0.790334105f},
-std::array<float,2>{0.0664765984f, 0.406030744f},
-std::array<float,2>{0.427633554f, 0.602597535f},
-std::array<float,2>{0.888734579f, 0.164760292f},
-std::array<float,2>{0.853829741f, 0.83189857f},
-std::array<float,2>{0.365384847f, 0.496380687f},
-std::array<float,2>{0.199138701f, 0.554357648f},
-std::array<float,2>{0.702724934f, 0.203474835f},
-std::array<float,2>{0.619618773f, 0.706459224f},
-std::array<float,2>{0.0172532313f, 0.00297964434f},
-std::array<float,2>{0.461467892f, 0.927566946f},
-std::array<float,2>{0.947420001f, 0.343527377f},
-std::array<float,2>{0.933088124f, 0.587218761f},
-std::array<float,2>{0.381721169f, 0.146233559f},
-std::array<float,2>{0.121334895f, 0.776782393f},
-std::array<float,2>{0.550179958f, 0.42438373f},
-std::array<float,2>{0.647662282f, 0.96914953f},
-std::array<float,2>{0.128738239f, 0.259825736f},
-std::array<float,2>{0.266199261f, 0.631079257f},
-std::array<float,2>{0.776981115f, 0.122713879f},
-std::array<float,2>{0.758318484f, 0.964885592f},
-std::array<float,2>{0.252126992f, 0.285552591f},
-std::array<float,2>{0.151585072f, 0.675299108f},
-std::array<float,2>{0.627625048f, 0.0858803466f},
-std::array<float,2>{0.534071982f, 0.619172335f},
-std::array<float,2>{0.0972581282f, 0.174231514f},
-std::array<float,2>{0.405247808f, 0.809352458f},
-std::array<float,2>{0.906685293f, 0.381415367f},
-std::array<float,2>{0.967225969f, 0.739780724f},
-std::array<float,2>{0.437815905f, 0.0595785789f},
-std::array<float,2>{0.00221253769f, 0.897302508f},
-std::array<float,2>{0.595203996f, 0.357560039f},
-std::array<float,2>{0.708153248f, 0.854156494f},
-std::array<float,2>{0.209139869f, 0.461509824f},
-std::array<float,2>{0.344179809f, 0.506257176f},
-std::array<float,2>{0.874933124f, 0.245113909f},
-std::array<float,2>{0.891486466f, 0.757233858f},
-std::array<float,2>{0.421591043f, 0.420200855f},
-std::array<float,2>{0.0881336704f, 0.566527486f},
-std::array<float,2>{0.525357842f, 0.130121887f},
-std::array<float,2>{0.677400589f, 0.642838895f},
-std::array<float,2>{0.185293972f, 0.100859836f},
-std::array<float,2>{0.282002449f, 0.993736982f},
-std::array<float,2>{0.811411321f, 0.269164324f},
-std::array<float,2>{0.822264135f, 0.539616227f},
-std::array<float,2>{0.337664664f, 0.193114668f},
-std::array<float,2>{0.244166464f, 0.817360282f},
-std::array<float,2>{0.727353275f, 0.476231724f},
-std::array<float,2>{0.582095981f, 0.910109162f},
-std::array<float,2>{0.0362405255f, 0.319775999f},
-std::array<float,2>{0.485419303f, 0.696954846f},
-std::array<float,2>{0.975533903f, 0.0168061927f},
-std::array<float,2>{0.916003346f, 0.986611485f},
-std::array<float,2>{0.394133508f, 0.281001151f},
-std::array<float,2>{0.108801946f, 0.655704021f},
-std::array<float,2>{0.542532563f, 0.10627985f},
-std::array<float,2>{0.63420862f, 0.575636506f},
-std::array<float,2>{0.141971827f, 0.133593991f},
-std::array<float,2>{0.261725932f, 0.763319314f},
-std::array<float,2>{0.754982531f, 0.410887897f},
-std::array<float,2>{0.865789652f, 0.693966329f},
-std::array<float,2>{0.358707309f, 0.0300845262f},
-std::array<float,2>{0.213279188f, 0.916191995f},
-std::array<float,2>{0.717101634f, 0.32517451f},
-std::array<float,2>{0.60849607f, 0.823367178f},
-std::array<float,2>{0.0122765834f, 0.477668732f},
-std::array<float,2>{0.446068943f, 0.538102746f},
-std::array<float,2>{0.957268655f, 0.19567208f},
-std::array<float,2>{0.800560892f, 0.798560441f},
-std::array<float,2>{0.290188491f, 0.388793647f},
-std::array<float,2>{0.179150417f, 0.615572512f},
-std::array<float,2>{0.68668586f, 0.18629995f},
-std::array<float,2>{0.521799684f, 0.681992352f},
-std::array<float,2>{0.0826830566f, 0.0872721374f},
-std::array<float,2>{0.407081068f, 0.956253171f},
-std::array<float,2>{0.903585434f, 0.29258579f},
-std::array<float,2>{0.980238438f, 0.510396421f},
-std::array<float,2>{0.498125464f, 0.235139593f},
-std::array<float,2>{0.0455946662f, 0.847355902f},
-std::array<float,2>{0.589936674f, 0.45859161f},
-std::array<float,2>{0.724348247f, 0.899164081f},
-std::array<float,2>{0.236477911f, 0.344934702f},
-std::array<float,2>{0.335628629f, 0.742675602f},
-std::array<float,2>{0.814939141f, 0.0510637835f},
-std::array<float,2>{0.832212925f, 0.935477436f},
-std::array<float,2>{0.313685298f, 0.330527693f},
-std::array<float,2>{0.224243835f, 0.717605174f},
-std::array<float,2>{0.746858716f, 0.00912985113f},
-std::array<float,2>{0.574972391f, 0.554709911f},
-std::array<float,2>{0.058725331f, 0.212086007f},
-std::array<float,2>{0.474593103f, 0.838094354f},
-std::array<float,2>{0.997867823f, 0.486338526f},
-std::array<float,2>{0.879526556f, 0.635395646f},
-std::array<float,2>{0.434847146f, 0.114398301f},
-std::array<float,2>{0.0721233189f, 0.983438253f},
-std::array<float,2>{0.50749892f, 0.253938496f},
-std::array<float,2>{0.669288695f, 0.767756104f},
-std::array<float,2>{0.167476237f, 0.431159854f},
-std::array<float,2>{0.298971862f, 0.584241867f},
-std::array<float,2>{0.79031837f, 0.149913475f},
-std::array<float,2>{0.944896042f, 0.86118269f},
-std::array<float,2>{0.458869725f, 0.446801364f},
-std::array<float,2>{0.0281969178f, 0.52678144f},
-std::array<float,2>{0.61046505f, 0.22222887f},
-std::array<float,2>{0.694417179f, 0.72194016f},
-std::array<float,2>{0.192718118f, 0.0427342094f},
-std::array<float,2>{0.371190816f, 0.87574482f},
-std::array<float,2>{0.847517788f, 0.370747149f},
-std::array<float,2>{0.769578278f, 0.598019242f},
-std::array<float,2>{0.278722495f, 0.163681582f},
-std::array<float,2>{0.133128777f, 0.788948894f},
-std::array<float,2>{0.6547966f, 0.397160351f},
-std::array<float,2>{0.554998696f, 0.948660433f},
-std::array<float,2>{0.110141635f, 0.310608983f},
-std::array<float,2>{0.388072878f, 0.656880379f},
-std::array<float,2>{0.922251225f, 0.067101188f},
-std::array<float,2>{0.992500961f, 0.96386385f},
-std::array<float,2>{0.472160339f, 0.283093721f},
-std::array<float,2>{0.0579399504f, 0.676757991f},
-std::array<float,2>{0.57250011f, 0.0797737315f},
-std::array<float,2>{0.745928943f, 0.621769488f},
-std::array<float,2>{0.219954655f, 0.176120594f},
-std::array<float,2>{0.318807483f, 0.807484448f},
-std::array<float,2>{0.831140637f, 0.377823234f},
-std::array<float,2>{0.796577275f, 0.736205339f},
-std::array<float,2>{0.302988052f, 0.0569997206f},
-std::array<float,2>{0.170409009f, 0.893174112f},
-std::array<float,2>{0.664990902f, 0.353828371f},
-std::array<float,2>{0.500828445f, 0.857107997f},
-std::array<float,2>{0.0779393911f, 0.468324929f},
-std::array<float,2>{0.430334836f, 0.502862394f},
-std::array<float,2>{0.877176046f, 0.246269599f},
-std::array<float,2>{0.850943744f, 0.752258539f},
-std::array<float,2>{0.367385596f, 0.414215505f},
-std::array<float,2>{0.187586069f, 0.565220535f},
-std::array<float,2>{0.689833939f, 0.128562063f},
-std::array<float,2>{0.616224229f, 0.64460355f},
-std::array<float,2>{0.0259450227f, 0.0976026282f},
-std::array<float,2>{0.456444889f, 0.997554839f},
-std::array<float,2>{0.93952769f, 0.271495432f},
-std::array<float,2>{0.927255094f, 0.544308305f},
-std::array<float,2>{0.386309355f, 0.188041031f},
-std::array<float,2>{0.113420092f, 0.814827979f},
-std::array<float,2>{0.561788201f, 0.472094774f},
-std::array<float,2>{0.650883555f, 0.913493693f},
-std::array<float,2>{0.139444068f, 0.312532514f},
-std::array<float,2>{0.276633292f, 0.699704289f},
-std::array<float,2>{0.766714454f, 0.021652896f},
-std::array<float,2>{0.751868188f, 0.883914709f},
-std::array<float,2>{0.26085189f, 0.364449233f},
-std::array<float,2>{0.147046179f, 0.730178297f},
-std::array<float,2>{0.637841821f, 0.0370872021f},
-std::array<float,2>{0.543258965f, 0.516110122f},
-std::array<float,2>{0.105000205f, 0.232700527f},
-std::array<float,2>{0.395011157f, 0.867796838f},
-std::array<float,2>{0.918544352f, 0.438116342f},
-std::array<float,2>{0.955442488f, 0.671350598f},
-std::array<float,2>{0.449985534f, 0.0722562149f},
-std::array<float,2>{0.00837722607f, 0.937867045f},
-std::array<float,2>{0.604000747f, 0.304394215f},
-std::array<float,2>{0.711894512f, 0.796392739f},
-std::array<float,2>{0.216637284f, 0.402203441f},
-std::array<float,2>{0.354088038f, 0.607216299f},
-std::array<float,2>{0.860770106f, 0.168614313f},
-std::array<float,2>{0.901955664f, 0.832494497f},
-std::array<float,2>{0.411275715f, 0.494360209f},
-std::array<float,2>{0.0808807313f, 0.550721228f},
-std::array<float,2>{0.519325376f, 0.209195063f},
-std::array<float,2>{0.680521488f, 0.70795089f},
-std::array<float,2>{0.172878936f, 0.00770258671f},
-std::array<float,2>{0.295962512f, 0.924345195f},
-std::array<float,2>{0.803168893f, 0.337289393f},
-std::array<float,2>{0.818541169f, 0.5928092f},
-std::array<float,2>{0.329748511f, 0.144284084f},
-std::array<float,2>{0.241362453f, 0.779623151f},
-std::array<float,2>{0.720521927f, 0.425909698f},
-std::array<float,2>{0.589260519f, 0.974557579f},
-std::array<float,2>{0.0410047397f, 0.26391679f},
-std::array<float,2>{0.495035797f, 0.625384569f},
-std::array<float,2>{0.983658552f, 0.117678434f},
-std::array<float,2>{0.913683176f, 0.930249393f},
-std::array<float,2>{0.399671227f, 0.334786117f},
-std::array<float,2>{0.0979604572f, 0.71201545f},
-std::array<float,2>{0.535469353f, 0.0132137844f},
-std::array<float,2>{0.630257964f, 0.56235534f},
-std::array<float,2>{0.154427707f, 0.215239525f},
-std::array<float,2>{0.254449904f, 0.842722833f},
-std::array<float,2>{0.765218377f, 0.491512179f},
-std::array<float,2>{0.867967486f, 0.640143216f},
-std::array<float,2>{0.350402266f, 0.11293564f},
-std::array<float,2>{0.20520924f, 0.979904771f},
-std::array<float,2>{0.705113053f, 0.252651989f},
-std::array<float,2>{0.599854589f, 0.770765424f},
-std::array<float,2>{0.00443807198f, 0.435388178f},
-std::array<float,2>{0.44280827f, 0.581627607f},
-std::array<float,2>{0.961627424f, 0.154252335f},
-std::array<float,2>{0.806998074f, 0.866554677f},
-std::array<float,2>{0.285769641f, 0.450317711f},
-std::array<float,2>{0.179947779f, 0.529456198f},
-std::array<float,2>{0.673368394f, 0.224763051f},
-std::array<float,2>{0.530476093f, 0.723085225f},
-std::array<float,2>{0.0903122351f, 0.0444588549f},
-std::array<float,2>{0.414708942f, 0.880614042f},
-std::array<float,2>{0.896190703f, 0.371513635f},
-std::array<float,2>{0.971488953f, 0.596219301f},
-std::array<float,2>{0.490016639f, 0.156398788f},
-std::array<float,2>{0.034218736f, 0.784015179f},
-std::array<float,2>{0.581959903f, 0.392417163f},
-std::array<float,2>{0.73251605f, 0.951483905f},
-std::array<float,2>{0.248112842f, 0.306153625f},
-std::array<float,2>{0.341295242f, 0.663037002f},
-std::array<float,2>{0.825568736f, 0.0656076148f},
-std::array<float,2>{0.843281984f, 0.99179107f},
-std::array<float,2>{0.322519571f, 0.276418656f},
-std::array<float,2>{0.231567457f, 0.649808168f},
-std::array<float,2>{0.735928059f, 0.101574205f},
-std::array<float,2>{0.562720656f, 0.572794437f},
-std::array<float,2>{0.0482324138f, 0.137269184f},
-std::array<float,2>{0.483749121f, 0.760040283f},
-std::array<float,2>{0.986199737f, 0.409240574f},
-std::array<float,2>{0.885447025f, 0.689210057f},
-std::array<float,2>{0.422047257f, 0.0238675494f},
-std::array<float,2>{0.0630041957f, 0.920120239f},
-std::array<float,2>{0.51418215f, 0.323969036f},
-std::array<float,2>{0.656441569f, 0.826855302f},
-std::array<float,2>{0.162138447f, 0.483109593f},
-std::array<float,2>{0.305236489f, 0.534393847f},
-std::array<float,2>{0.78580451f, 0.203044876f},
-std::array<float,2>{0.950895071f, 0.802046359f},
-std::array<float,2>{0.467814714f, 0.386294067f},
-std::array<float,2>{0.023223266f, 0.612900019f},
-std::array<float,2>{0.623934031f, 0.180840731f},
-std::array<float,2>{0.698175073f, 0.683911383f},
-std::array<float,2>{0.19979237f, 0.0900138915f},
-std::array<float,2>{0.360310465f, 0.960173309f},
-std::array<float,2>{0.855832338f, 0.296050757f},
-std::array<float,2>{0.779866517f, 0.51484859f},
-std::array<float,2>{0.272751629f, 0.240292966f},
-std::array<float,2>{0.131514475f, 0.851210892f},
-std::array<float,2>{0.642344058f, 0.453981876f},
-std::array<float,2>{0.550986171f, 0.904688001f},
-std::array<float,2>{0.120825015f, 0.350495458f},
-std::array<float,2>{0.378823608f, 0.748780489f},
-std::array<float,2>{0.935812533f, 0.0505564474f},
-std::array<float,2>{0.966263294f, 0.897583663f},
-std::array<float,2>{0.440983832f, 0.358623743f},
-std::array<float,2>{0.00104725163f, 0.738573372f},
-std::array<float,2>{0.596169472f, 0.0595639497f},
-std::array<float,2>{0.709355414f, 0.507591963f},
-std::array<float,2>{0.208537146f, 0.245591998f},
-std::array<float,2>{0.347412318f, 0.855107903f},
-std::array<float,2>{0.872554898f, 0.461999953f},
-std::array<float,2>{0.760030031f, 0.674346507f},
-std::array<float,2>{0.250019848f, 0.0845845193f},
-std::array<float,2>{0.15029785f, 0.966098964f},
-std::array<float,2>{0.626187384f, 0.286539525f},
-std::array<float,2>{0.532030523f, 0.810354948f},
-std::array<float,2>{0.0941858143f, 0.382791907f},
-std::array<float,2>{0.40285933f, 0.621086955f},
-std::array<float,2>{0.909276605f, 0.175210863f},
-std::array<float,2>{0.82255286f, 0.81753701f},
-std::array<float,2>{0.338456422f, 0.474967688f},
-std::array<float,2>{0.242701098f, 0.540830553f},
-std::array<float,2>{0.729750514f, 0.191501066f},
-std::array<float,2>{0.584420681f, 0.695577025f},
-std::array<float,2>{0.0386561342f, 0.0156814959f},
-std::array<float,2>{0.486700654f, 0.908627808f},
-std::array<float,2>{0.973099947f, 0.31894055f},
-std::array<float,2>{0.894370615f, 0.567489266f},
-std::array<float,2>{0.41885677f, 0.129159942f},
-std::array<float,2>{0.0864188001f, 0.756550074f},
-std::array<float,2>{0.526743889f, 0.421306521f},
-std::array<float,2>{0.678028643f, 0.992364824f},
-std::array<float,2>{0.186398014f, 0.268509686f},
-std::array<float,2>{0.283268332f, 0.644129276f},
-std::array<float,2>{0.809986949f, 0.100398973f},
-std::array<float,2>{0.784813404f, 0.941967249f},
-std::array<float,2>{0.310652941f, 0.297996283f},
-std::array<float,2>{0.157942519f, 0.664112508f},
-std::array<float,2>{0.662597835f, 0.0752243102f},
-std::array<float,2>{0.511530578f, 0.602460384f},
-std::array<float,2>{0.0694104731f, 0.165663049f},
-std::array<float,2>{0.428860962f, 0.789789438f},
-std::array<float,2>{0.888430953f, 0.404778957f},
-std::array<float,2>{0.990420341f, 0.733010054f},
-std::array<float,2>{0.477139086f, 0.0349637829f},
-std::array<float,2>{0.0530294031f, 0.888305545f},
-std::array<float,2>{0.569193542f, 0.36192143f},
-std::array<float,2>{0.738629997f, 0.873013675f},
-std::array<float,2>{0.228473887f, 0.442649841f},
-std::array<float,2>{0.325781047f, 0.523396313f},
-std::array<float,2>{0.836825788f, 0.226576224f},
-std::array<float,2>{0.930920005f, 0.77554214f},
-std::array<float,2>{0.379057497f, 0.425741285f},
-std::array<float,2>{0.124357261f, 0.586655974f},
-std::array<float,2>{0.547953784f, 0.14509064f},
-std::array<float,2>{0.644541323f, 0.632108927f},
-std::array<float,2>{0.125850677f, 0.121763937f},
-std::array<float,2>{0.269507527f, 0.970508277f},
-std::array<float,2>{0.774600744f, 0.261127651f},
-std::array<float,2>{0.852163434f, 0.553425372f},
-std::array<float,2>{0.36455524f, 0.204523325f},
-std::array<float,2>{0.196098194f, 0.830834091f},
-std::array<float,2>{0.699410617f, 0.497563958f},
-std::array<float,2>{0.617404044f, 0.925897956f},
-std::array<float,2>{0.0183541514f, 0.341953307f},
-std::array<float,2>{0.464386344f, 0.705098927f},
-std::array<float,2>{0.947022259f, 0.0025254034f},
-std::array<float,2>{0.881423533f, 0.983169734f},
-std::array<float,2>{0.437316269f, 0.255661964f},
-std::array<float,2>{0.0731915534f, 0.63638556f},
-std::array<float,2>{0.505350828f, 0.113644511f},
-std::array<float,2>{0.670907557f, 0.58510077f},
-std::array<float,2>{0.165599227f, 0.148601919f},
-std::array<float,2>{0.298817366f, 0.768993556f},
-std::array<float,2>{0.792623222f, 0.430644959f},
-std::array<float,2>{0.834829211f, 0.718288898f},
-std::array<float,2>{0.316341072f, 0.00844187755f},
-std::array<float,2>{0.225493878f, 0.933996141f},
-std::array<float,2>{0.749236643f, 0.331258029f},
-std::array<float,2>{0.576801658f, 0.839373887f},
-std::array<float,2>{0.061499916f, 0.487755269f},
-std::array<float,2>{0.475489348f, 0.555992067f},
-std::array<float,2>{0.999151289f, 0.211144581f},
-std::array<float,2>{0.771638453f, 0.787460744f},
-std::array<float,2>{0.27969715f, 0.397523791f},
-std::array<float,2>{0.136671185f, 0.599268198f},
-std::array<float,2>{0.653120935f, 0.162361383f},
-std::array<float,2>{0.55712235f, 0.657966614f},
-std::array<float,2>{0.113203399f, 0.0677297488f},
-std::array<float,2>{0.389296025f, 0.947426438f},
-std::array<float,2>{0.924418449f, 0.311852843f},
-std::array<float,2>{0.941969275f, 0.526095986f},
-std::array<float,2>{0.460677236f, 0.220709607f},
-std::array<float,2>{0.0296222623f, 0.859585047f},
-std::array<float,2>{0.6120193f, 0.445584923f},
-std::array<float,2>{0.692667186f, 0.876656651f},
-std::array<float,2>{0.195157751f, 0.369574487f},
-std::array<float,2>{0.373048007f, 0.721419513f},
-std::array<float,2>{0.845590889f, 0.0419149771f},
-std::array<float,2>{0.864677489f, 0.917036891f},
-std::array<float,2>{0.357219309f, 0.326144844f},
-std::array<float,2>{0.212888718f, 0.694396615f},
-std::array<float,2>{0.715963125f, 0.0308217481f},
-std::array<float,2>{0.606462717f, 0.537735283f},
-std::array<float,2>{0.0143212257f, 0.19693622f},
-std::array<float,2>{0.448205203f, 0.822994471f},
-std::array<float,2>{0.959815025f, 0.476868987f},
-std::array<float,2>{0.91775322f, 0.654322088f},
-std::array<float,2>{0.392059356f, 0.107065156f},
-std::array<float,2>{0.106933728f, 0.987875044f},
-std::array<float,2>{0.539450526f, 0.279807985f},
-std::array<float,2>{0.635032833f, 0.761987627f},
-std::array<float,2>{0.144382864f, 0.41141203f},
-std::array<float,2>{0.265313834f, 0.574521244f},
-std::array<float,2>{0.756342649f, 0.134236082f},
-std::array<float,2>{0.977265835f, 0.845835268f},
-std::array<float,2>{0.4972969f, 0.457562566f},
-std::array<float,2>{0.0440475121f, 0.510896385f},
-std::array<float,2>{0.592512667f, 0.236193553f},
-std::array<float,2>{0.72644639f, 0.743775606f},
-std::array<float,2>{0.235280633f, 0.0517859384f},
-std::array<float,2>{0.333037108f, 0.900005579f},
-std::array<float,2>{0.813431323f, 0.344664365f},
-std::array<float,2>{0.798576891f, 0.616323352f},
-std::array<float,2>{0.292376369f, 0.186813667f},
-std::array<float,2>{0.176584244f, 0.797094941f},
-std::array<float,2>{0.684018135f, 0.390124798f},
-std::array<float,2>{0.520520568f, 0.955235124f},
-std::array<float,2>{0.0846075639f, 0.291262597f},
-std::array<float,2>{0.408637613f, 0.683377385f},
-std::array<float,2>{0.905974805f, 0.086732626f},
-std::array<float,2>{0.938934028f, 0.998771966f},
-std::array<float,2>{0.454849541f, 0.270039976f},
-std::array<float,2>{0.0249952935f, 0.647249639f},
-std::array<float,2>{0.613332808f, 0.0945597515f},
-std::array<float,2>{0.688309729f, 0.563376963f},
-std::array<float,2>{0.189895838f, 0.125330329f},
-std::array<float,2>{0.369502962f, 0.751064837f},
-std::array<float,2>{0.8477633f, 0.417126983f},
-std::array<float,2>{0.767619133f, 0.70169878f},
-std::array<float,2>{0.27400893f, 0.0196821354f},
-std::array<float,2>{0.138510466f, 0.910541296f},
-std::array<float,2>{0.648815274f, 0.315519899f},
-std::array<float,2>{0.560236216f, 0.812888622f},
-std::array<float,2>{0.115751348f, 0.470110834f},
-std::array<float,2>{0.384003639f, 0.5460127f},
-std::array<float,2>{0.927903771f, 0.191397995f},
-std::array<float,2>{0.828438163f, 0.806005597f},
-std::array<float,2>{0.316687286f, 0.376703471f},
-std::array<float,2>{0.221350953f, 0.624425709f},
-std::array<float,2>{0.742922843f, 0.179187164f},
-std::array<float,2>{0.571063578f, 0.679397941f},
-std::array<float,2>{0.0564565063f, 0.0814643726f},
-std::array<float,2>{0.469477445f, 0.962439239f},
-std::array<float,2>{0.994792283f, 0.283535004f},
-std::array<float,2>{0.876620412f, 0.501902878f},
-std::array<float,2>{0.432536572f, 0.24941875f},
-std::array<float,2>{0.0742917359f, 0.858178437f},
-std::array<float,2>{0.502654016f, 0.466467887f},
-std::array<float,2>{0.667598188f, 0.890791774f},
-std::array<float,2>{0.169623494f, 0.351842433f},
-std::array<float,2>{0.302074611f, 0.736708105f},
-std::array<float,2>{0.79316926f, 0.0559247471f},
-std::array<float,2>{0.80141592f, 0.922652662f},
-std::array<float,2>{0.2939035f, 0.338502347f},
-std::array<float,2>{0.174952537f, 0.710935056f},
-std::array<float,2>{0.681830108f, 0.00449958816f},
-std::array<float,2>{0.516328871f, 0.548394263f},
-std::array<float,2>{0.0798364058f, 0.207205981f},
-std::array<float,2>{0.412503511f, 0.835271716f},
-std::array<float,2>{0.900004148f, 0.493897557f},
-std::array<float,2>{0.982400596f, 0.628608048f},
-std::array<float,2>{0.492870569f, 0.120875977f},
-std::array<float,2>{0.0412921011f, 0.975374162f},
-std::array<float,2>{0.587435484f, 0.263377905f},
-std::array<float,2>{0.721467793f, 0.778692961f},
-std::array<float,2>{0.23970367f, 0.429055452f},
-std::array<float,2>{0.331111103f, 0.591560245f},
-std::array<float,2>{0.817267239f, 0.142428786f},
-std::array<float,2>{0.920687735f, 0.869375825f},
-std::array<float,2>{0.397724777f, 0.439456224f},
-std::array<float,2>{0.102829345f, 0.518909991f},
-std::array<float,2>{0.546790838f, 0.230550602f},
-std::array<float,2>{0.640542328f, 0.727779448f},
-std::array<float,2>{0.145790249f, 0.038452968f},
-std::array<float,2>{0.25865379f, 0.88520509f},
-std::array<float,2>{0.753119171f, 0.366166294f},
-std::array<float,2>{0.862300694f, 0.608240426f},
-std::array<float,2>{0.351777971f, 0.171403021f},
-std::array<float,2>{0.218696505f, 0.793519855f},
-std::array<float,2>{0.714416206f, 0.400226802f},
-std::array<float,2>{0.602910519f, 0.940386772f},
-std::array<float,2>{0.010533778f, 0.301660597f},
-std::array<float,2>{0.452176154f, 0.66900456f},
-std::array<float,2>{0.954555035f, 0.073615104f},
-std::array<float,2>{0.896649659f, 0.882780969f},
-std::array<float,2>{0.417915285f, 0.373410463f},
-std::array<float,2>{0.0930754393f, 0.725062013f},
-std::array<float,2>{0.52855432f, 0.0460117869f},
-std::array<float,2>{0.675193071f, 0.527894378f},
-std::array<float,2>{0.182971001f, 0.223682076f},
-std::array<float,2>{0.288048536f, 0.864575207f},
-std::array<float,2>{0.805101931f, 0.452440351f},
-std::array<float,2>{0.826754868f, 0.661423385f},
-std::array<float,2>{0.342791706f, 0.0638284162f},
-std::array<float,2>{0.246888995f, 0.950294137f},
-std::array<float,2>{0.731744885f, 0.306739479f},
-std::array<float,2>{0.579954505f, 0.781906247f},
-std::array<float,2>{0.0330983028f, 0.392602295f},
-std::array<float,2>{0.490272224f, 0.594474077f},
-std::array<float,2>{0.96898073f, 0.15910089f},
-std::array<float,2>{0.763306081f, 0.841303468f},
-std::array<float,2>{0.256136835f, 0.489795417f},
-std::array<float,2>{0.152600199f, 0.558735013f},
-std::array<float,2>{0.631101191f, 0.217450246f},
-std::array<float,2>{0.538956523f, 0.713819206f},
-std::array<float,2>{0.100307189f, 0.0137215862f},
-std::array<float,2>{0.400745124f, 0.932331443f},
-std::array<float,2>{0.910461009f, 0.333871454f},
-std::array<float,2>{0.963881671f, 0.57884109f},
-std::array<float,2>{0.443980128f, 0.155661985f},
-std::array<float,2>{0.00617044279f, 0.773038208f},
-std::array<float,2>{0.599056542f, 0.43625778f},
-std::array<float,2>{0.704711318f, 0.976744235f},
-std::array<float,2>{0.203262612f, 0.250916153f},
-std::array<float,2>{0.348961115f, 0.637600243f},
-std::array<float,2>{0.871026993f, 0.110466562f},
-std::array<float,2>{0.859191298f, 0.958405793f},
-std::array<float,2>{0.362041652f, 0.293990195f},
-std::array<float,2>{0.202600479f, 0.685843289f},
-std::array<float,2>{0.695528388f, 0.0925952569f},
-std::array<float,2>{0.622532487f, 0.609856725f},
-std::array<float,2>{0.0197285544f, 0.181642562f},
-std::array<float,2>{0.46661526f, 0.803844035f},
-std::array<float,2>{0.952336669f, 0.384632796f},
-std::array<float,2>{0.935227275f, 0.746583104f},
-std::array<float,2>{0.375989348f, 0.0471617021f},
-std::array<float,2>{0.11909245f, 0.903636277f},
-std::array<float,2>{0.55430609f, 0.34930557f},
-std::array<float,2>{0.644467175f, 0.848106444f},
-std::array<float,2>{0.130531088f, 0.456519485f},
-std::array<float,2>{0.270604581f, 0.512132466f},
-std::array<float,2>{0.779105246f, 0.240225062f},
-std::array<float,2>{0.98714596f, 0.757944345f},
-std::array<float,2>{0.480991572f, 0.407836407f},
-std::array<float,2>{0.0499488078f, 0.57226038f},
-std::array<float,2>{0.564566076f, 0.138695017f},
-std::array<float,2>{0.736384928f, 0.651208878f},
-std::array<float,2>{0.233784914f, 0.105023861f},
-std::array<float,2>{0.320749044f, 0.989286065f},
-std::array<float,2>{0.840544999f, 0.275170118f},
-std::array<float,2>{0.788923383f, 0.531572759f},
-std::array<float,2>{0.308433235f, 0.199769795f},
-std::array<float,2>{0.160541713f, 0.824409902f},
-std::array<float,2>{0.659544826f, 0.481620103f},
-std::array<float,2>{0.512714922f, 0.919646323f},
-std::array<float,2>{0.0657376945f, 0.320363313f},
-std::array<float,2>{0.425586998f, 0.691153526f},
-std::array<float,2>{0.884163499f, 0.0256901905f},
-std::array<float,2>{0.976520896f, 0.907229662f},
-std::array<float,2>{0.484583139f, 0.318211526f},
-std::array<float,2>{0.0357499197f, 0.69799161f},
-std::array<float,2>{0.583915591f, 0.0178699549f},
-std::array<float,2>{0.727593184f, 0.54196167f},
-std::array<float,2>{0.245137274f, 0.194029465f},
-std::array<float,2>{0.336602747f, 0.819532335f},
-std::array<float,2>{0.82047528f, 0.473762214f},
-std::array<float,2>{0.811921954f, 0.640682518f},
-std::array<float,2>{0.282355815f, 0.0989358127f},
-std::array<float,2>{0.183828473f, 0.995714366f},
-std::array<float,2>{0.676546633f, 0.265724927f},
-std::array<float,2>{0.524285972f, 0.755780697f},
-std::array<float,2>{0.0894081071f, 0.418264925f},
-std::array<float,2>{0.419927508f, 0.569353878f},
-std::array<float,2>{0.892422915f, 0.132575646f},
-std::array<float,2>{0.873689711f, 0.851796746f},
-std::array<float,2>{0.345511734f, 0.463495612f},
-std::array<float,2>{0.210059002f, 0.505787253f},
-std::array<float,2>{0.707705975f, 0.243044049f},
-std::array<float,2>{0.594491661f, 0.741980314f},
-std::array<float,2>{0.0030098753f, 0.0619750097f},
-std::array<float,2>{0.439057916f, 0.895038009f},
-std::array<float,2>{0.968669832f, 0.356612951f},
-std::array<float,2>{0.907289028f, 0.617631733f},
-std::array<float,2>{0.405555338f, 0.17323643f},
-std::array<float,2>{0.0957483947f, 0.810788929f},
-std::array<float,2>{0.534332693f, 0.379677922f},
-std::array<float,2>{0.628889978f, 0.968257546f},
-std::array<float,2>{0.151359662f, 0.288891762f},
-std::array<float,2>{0.253794283f, 0.673319161f},
-std::array<float,2>{0.759681702f, 0.082187444f},
-std::array<float,2>{0.776260555f, 0.972166598f},
-std::array<float,2>{0.266650975f, 0.257968515f},
-std::array<float,2>{0.127045974f, 0.630601645f},
-std::array<float,2>{0.646569669f, 0.124490887f},
-std::array<float,2>{0.549769938f, 0.588828743f},
-std::array<float,2>{0.122508839f, 0.146606833f},
-std::array<float,2>{0.382746994f, 0.774647772f},
-std::array<float,2>{0.931889355f, 0.422320724f},
-std::array<float,2>{0.948344767f, 0.704292834f},
-std::array<float,2>{0.462759882f, 0.000561307883f},
-std::array<float,2>{0.0157492999f, 0.927993119f},
-std::array<float,2>{0.620486438f, 0.339937747f},
-std::array<float,2>{0.70152545f, 0.82819277f},
-std::array<float,2>{0.197770298f, 0.498854727f},
-std::array<float,2>{0.366885751f, 0.552507341f},
-std::array<float,2>{0.855135739f, 0.205538869f},
-std::array<float,2>{0.890066564f, 0.792022169f},
-std::array<float,2>{0.426686049f, 0.403182328f},
-std::array<float,2>{0.0677615032f, 0.604403555f},
-std::array<float,2>{0.508931398f, 0.166373804f},
-std::array<float,2>{0.660210788f, 0.666994095f},
-std::array<float,2>{0.159296468f, 0.0765599757f},
-std::array<float,2>{0.309737056f, 0.944159269f},
-std::array<float,2>{0.7825315f, 0.30072543f},
-std::array<float,2>{0.838671923f, 0.520509183f},
-std::array<float,2>{0.3276169f, 0.22946246f},
-std::array<float,2>{0.229308099f, 0.874301791f},
-std::array<float,2>{0.740305007f, 0.44383049f},
-std::array<float,2>{0.566787601f, 0.88968128f},
-std::array<float,2>{0.0522034541f, 0.359666198f},
-std::array<float,2>{0.480326742f, 0.732394934f},
-std::array<float,2>{0.989955783f, 0.0314024426f},
-std::array<float,2>{0.922970295f, 0.946455479f},
-std::array<float,2>{0.386794597f, 0.3096928f},
-std::array<float,2>{0.110360667f, 0.659220517f},
-std::array<float,2>{0.555856407f, 0.0700706318f},
-std::array<float,2>{0.656019092f, 0.599842012f},
-std::array<float,2>{0.134532943f, 0.161626115f},
-std::array<float,2>{0.27829653f, 0.785437405f},
-std::array<float,2>{0.770711243f, 0.396403134f},
-std::array<float,2>{0.846449018f, 0.718993008f},
-std::array<float,2>{0.372669578f, 0.0407828204f},
-std::array<float,2>{0.191919833f, 0.878847182f},
-std::array<float,2>{0.693556547f, 0.367460251f},
-std::array<float,2>{0.609920204f, 0.862816274f},
-std::array<float,2>{0.028637981f, 0.448457897f},
-std::array<float,2>{0.457427382f, 0.525042653f},
-std::array<float,2>{0.944213152f, 0.218939796f},
-std::array<float,2>{0.789882243f, 0.766281247f},
-std::array<float,2>{0.300206661f, 0.433073163f},
-std::array<float,2>{0.1662191f, 0.582871079f},
-std::array<float,2>{0.668747604f, 0.15233618f},
-std::array<float,2>{0.505902529f, 0.633576274f},
-std::array<float,2>{0.0703943744f, 0.116627522f},
-std::array<float,2>{0.434180617f, 0.981752276f},
-std::array<float,2>{0.8807289f, 0.257583886f},
-std::array<float,2>{0.996706069f, 0.558350086f},
-std::array<float,2>{0.473431855f, 0.214672744f},
-std::array<float,2>{0.060501162f, 0.837365746f},
-std::array<float,2>{0.576101542f, 0.484483778f},
-std::array<float,2>{0.748010397f, 0.935909986f},
-std::array<float,2>{0.223484635f, 0.328286201f},
-std::array<float,2>{0.312774658f, 0.715947568f},
-std::array<float,2>{0.833078623f, 0.011069471f},
-std::array<float,2>{0.81628871f, 0.902321875f},
-std::array<float,2>{0.334004611f, 0.346790314f},
-std::array<float,2>{0.237942249f, 0.745457709f},
-std::array<float,2>{0.723227561f, 0.0534713343f},
-std::array<float,2>{0.59159863f, 0.509385288f},
-std::array<float,2>{0.0464351699f, 0.23705852f},
-std::array<float,2>{0.49944976f, 0.845077753f},
-std::array<float,2>{0.978849649f, 0.460480005f},
-std::array<float,2>{0.902961791f, 0.680525184f},
-std::array<float,2>{0.40776512f, 0.0891917795f},
-std::array<float,2>{0.0831016004f, 0.953378916f},
-std::array<float,2>{0.523207545f, 0.289861828f},
-std::array<float,2>{0.686484516f, 0.799182832f},
-std::array<float,2>{0.178623989f, 0.38816148f},
-std::array<float,2>{0.28996557f, 0.614312112f},
-std::array<float,2>{0.799272537f, 0.18528603f},
-std::array<float,2>{0.958631814f, 0.822136641f},
-std::array<float,2>{0.446554422f, 0.47855857f},
-std::array<float,2>{0.0134343933f, 0.535404086f},
-std::array<float,2>{0.608070731f, 0.198867828f},
-std::array<float,2>{0.718342364f, 0.692409873f},
-std::array<float,2>{0.214301258f, 0.0274750218f},
-std::array<float,2>{0.357805997f, 0.915540397f},
-std::array<float,2>{0.866636992f, 0.327949226f},
-std::array<float,2>{0.754377127f, 0.577394605f},
-std::array<float,2>{0.263078839f, 0.135517687f},
-std::array<float,2>{0.141413689f, 0.764705658f},
-std::array<float,2>{0.633666217f, 0.413533121f},
-std::array<float,2>{0.541361988f, 0.98584336f},
-std::array<float,2>{0.107749648f, 0.278285682f},
-std::array<float,2>{0.393477917f, 0.652691185f},
-std::array<float,2>{0.914910078f, 0.107961632f}}
\ No newline at end of file
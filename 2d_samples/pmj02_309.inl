@@ -1,4096 +0,0 @@
-{std::array<float,2>{0.268188238f, 0.463087738f},
-std::array<float,2>{0.559549987f, 0.938699365f},
-std::array<float,2>{0.848923028f, 0.090697743f},
-std::array<float,2>{0.190221772f, 0.6317752f},
-std::array<float,2>{0.0386196785f, 0.151877016f},
-std::array<float,2>{0.988018453f, 0.526563644f},
-std::array<float,2>{0.744502306f, 0.308108836f},
-std::array<float,2>{0.410694778f, 0.823881567f},
-std::array<float,2>{0.455103099f, 0.00156290107f},
-std::array<float,2>{0.66053462f, 0.688704371f},
-std::array<float,2>{0.91434592f, 0.411981821f},
-std::array<float,2>{0.109435417f, 0.894041181f},
-std::array<float,2>{0.177049443f, 0.323566943f},
-std::array<float,2>{0.80242902f, 0.791167676f},
-std::array<float,2>{0.607980788f, 0.239699692f},
-std::array<float,2>{0.364246786f, 0.573187351f},
-std::array<float,2>{0.381992102f, 0.26201275f},
-std::array<float,2>{0.715159953f, 0.867754698f},
-std::array<float,2>{0.951454341f, 0.160651088f},
-std::array<float,2>{0.0255655758f, 0.538664758f},
-std::array<float,2>{0.236698449f, 0.123017967f},
-std::array<float,2>{0.822880924f, 0.673391581f},
-std::array<float,2>{0.526966751f, 0.478705347f},
-std::array<float,2>{0.285949737f, 0.994362652f},
-std::array<float,2>{0.339743555f, 0.207120359f},
-std::array<float,2>{0.583284616f, 0.60138911f},
-std::array<float,2>{0.757914186f, 0.356248468f},
-std::array<float,2>{0.128649324f, 0.768175423f},
-std::array<float,2>{0.0829263479f, 0.392651379f},
-std::array<float,2>{0.877770841f, 0.918430328f},
-std::array<float,2>{0.646538854f, 0.0431119502f},
-std::array<float,2>{0.478509188f, 0.743092716f},
-std::array<float,2>{0.498868763f, 0.42942974f},
-std::array<float,2>{0.637421846f, 0.877700746f},
-std::array<float,2>{0.903028965f, 0.0181654524f},
-std::array<float,2>{0.0749511048f, 0.703188181f},
-std::array<float,2>{0.142577633f, 0.224872261f},
-std::array<float,2>{0.77371347f, 0.579029441f},
-std::array<float,2>{0.573901534f, 0.328784049f},
-std::array<float,2>{0.323594779f, 0.811086237f},
-std::array<float,2>{0.299740911f, 0.0738931447f},
-std::array<float,2>{0.50474304f, 0.656026065f},
-std::array<float,2>{0.83703649f, 0.439088255f},
-std::array<float,2>{0.221328795f, 0.962456405f},
-std::array<float,2>{0.0109552434f, 0.28687799f},
-std::array<float,2>{0.967727721f, 0.840002477f},
-std::array<float,2>{0.699882984f, 0.134057343f},
-std::array<float,2>{0.401292592f, 0.515111029f},
-std::array<float,2>{0.345972806f, 0.370567203f},
-std::array<float,2>{0.613190889f, 0.755356967f},
-std::array<float,2>{0.782226026f, 0.194904357f},
-std::array<float,2>{0.160938099f, 0.61046207f},
-std::array<float,2>{0.106718071f, 0.061948888f},
-std::array<float,2>{0.930330873f, 0.720783293f},
-std::array<float,2>{0.685595334f, 0.376958042f},
-std::array<float,2>{0.44118163f, 0.933472335f},
-std::array<float,2>{0.437115371f, 0.185242578f},
-std::array<float,2>{0.73146987f, 0.55812937f},
-std::array<float,2>{0.971702099f, 0.281048834f},
-std::array<float,2>{0.0534462743f, 0.856693804f},
-std::array<float,2>{0.206432521f, 0.496630132f},
-std::array<float,2>{0.871927083f, 0.970461667f},
-std::array<float,2>{0.535950303f, 0.0992599353f},
-std::array<float,2>{0.261049658f, 0.66372329f},
-std::array<float,2>{0.314424396f, 0.386354029f},
-std::array<float,2>{0.567784667f, 0.927701116f},
-std::array<float,2>{0.769009888f, 0.0478697494f},
-std::array<float,2>{0.15319635f, 0.733214676f},
-std::array<float,2>{0.0669828057f, 0.199736103f},
-std::array<float,2>{0.898093343f, 0.619918764f},
-std::array<float,2>{0.630877018f, 0.366675973f},
-std::array<float,2>{0.484776735f, 0.763543248f},
-std::array<float,2>{0.391380608f, 0.104635313f},
-std::array<float,2>{0.690095544f, 0.668421686f},
-std::array<float,2>{0.9600932f, 0.488381058f},
-std::array<float,2>{0.00460925139f, 0.98108089f},
-std::array<float,2>{0.227346852f, 0.266786665f},
-std::array<float,2>{0.831602752f, 0.84536767f},
-std::array<float,2>{0.507911682f, 0.171952173f},
-std::array<float,2>{0.306770504f, 0.552882195f},
-std::array<float,2>{0.449671328f, 0.33652252f},
-std::array<float,2>{0.678424835f, 0.804217041f},
-std::array<float,2>{0.92646277f, 0.233387113f},
-std::array<float,2>{0.0962280557f, 0.593610823f},
-std::array<float,2>{0.164210334f, 0.0290643778f},
-std::array<float,2>{0.793953538f, 0.712290645f},
-std::array<float,2>{0.618719935f, 0.432475805f},
-std::array<float,2>{0.358941287f, 0.890394926f},
-std::array<float,2>{0.254336298f, 0.131955802f},
-std::array<float,2>{0.542479932f, 0.507780254f},
-std::array<float,2>{0.862157404f, 0.290118456f},
-std::array<float,2>{0.211030006f, 0.832350373f},
-std::array<float,2>{0.0547105484f, 0.447089165f},
-std::array<float,2>{0.977771401f, 0.957378089f},
-std::array<float,2>{0.721463621f, 0.0671079159f},
-std::array<float,2>{0.425107598f, 0.644515097f},
-std::array<float,2>{0.416879058f, 0.474296957f},
-std::array<float,2>{0.739465654f, 0.989409626f},
-std::array<float,2>{0.99408561f, 0.112723932f},
-std::array<float,2>{0.0454177149f, 0.680237651f},
-std::array<float,2>{0.200968206f, 0.168871924f},
-std::array<float,2>{0.857952535f, 0.539083481f},
-std::array<float,2>{0.551024795f, 0.255572468f},
-std::array<float,2>{0.273992181f, 0.86393404f},
-std::array<float,2>{0.368558645f, 0.0390218832f},
-std::array<float,2>{0.595279515f, 0.738181889f},
-std::array<float,2>{0.809598982f, 0.402279884f},
-std::array<float,2>{0.185556173f, 0.912796319f},
-std::array<float,2>{0.117674634f, 0.348760933f},
-std::array<float,2>{0.906308115f, 0.774925411f},
-std::array<float,2>{0.669825971f, 0.214743614f},
-std::array<float,2>{0.462829351f, 0.602008462f},
-std::array<float,2>{0.291124344f, 0.302164167f},
-std::array<float,2>{0.518860638f, 0.815356672f},
-std::array<float,2>{0.816568792f, 0.145072088f},
-std::array<float,2>{0.243313551f, 0.518725157f},
-std::array<float,2>{0.0167861935f, 0.0856120288f},
-std::array<float,2>{0.942243695f, 0.635980666f},
-std::array<float,2>{0.70978862f, 0.45806849f},
-std::array<float,2>{0.390059084f, 0.949625134f},
-std::array<float,2>{0.476072043f, 0.243124813f},
-std::array<float,2>{0.653830767f, 0.564184129f},
-std::array<float,2>{0.884926498f, 0.313179046f},
-std::array<float,2>{0.0907651559f, 0.78286171f},
-std::array<float,2>{0.13789168f, 0.421269506f},
-std::array<float,2>{0.756615996f, 0.905338347f},
-std::array<float,2>{0.589123905f, 0.00973987021f},
-std::array<float,2>{0.328819364f, 0.696709275f},
-std::array<float,2>{0.309442759f, 0.409301221f},
-std::array<float,2>{0.515434027f, 0.895127058f},
-std::array<float,2>{0.832833469f, 0.00440812809f},
-std::array<float,2>{0.234249592f, 0.693423986f},
-std::array<float,2>{0.000495525135f, 0.236303061f},
-std::array<float,2>{0.953939319f, 0.575172603f},
-std::array<float,2>{0.69434011f, 0.328057379f},
-std::array<float,2>{0.394943744f, 0.7954247f},
-std::array<float,2>{0.490399212f, 0.0893956646f},
-std::array<float,2>{0.625558972f, 0.62648201f},
-std::array<float,2>{0.891920865f, 0.467218846f},
-std::array<float,2>{0.0625422969f, 0.942385137f},
-std::array<float,2>{0.149628788f, 0.311525792f},
-std::array<float,2>{0.770072401f, 0.826372981f},
-std::array<float,2>{0.56281358f, 0.152836993f},
-std::array<float,2>{0.318960398f, 0.529005945f},
-std::array<float,2>{0.427867889f, 0.353213876f},
-std::array<float,2>{0.72523427f, 0.771800399f},
-std::array<float,2>{0.981711447f, 0.205068529f},
-std::array<float,2>{0.0599848703f, 0.595491648f},
-std::array<float,2>{0.216271073f, 0.0426029675f},
-std::array<float,2>{0.865104616f, 0.747463405f},
-std::array<float,2>{0.545744658f, 0.39587149f},
-std::array<float,2>{0.253381163f, 0.916385591f},
-std::array<float,2>{0.352924287f, 0.158647805f},
-std::array<float,2>{0.621413469f, 0.532938063f},
-std::array<float,2>{0.791966379f, 0.258665591f},
-std::array<float,2>{0.168514192f, 0.87420398f},
-std::array<float,2>{0.0999655426f, 0.48268044f},
-std::array<float,2>{0.924085081f, 0.996325314f},
-std::array<float,2>{0.674955249f, 0.119283482f},
-std::array<float,2>{0.445978701f, 0.676137805f},
-std::array<float,2>{0.468606621f, 0.443995327f},
-std::array<float,2>{0.667752504f, 0.967936814f},
-std::array<float,2>{0.913160622f, 0.0745810643f},
-std::array<float,2>{0.123312473f, 0.650520682f},
-std::array<float,2>{0.181742385f, 0.140213221f},
-std::array<float,2>{0.805758774f, 0.508935153f},
-std::array<float,2>{0.598315895f, 0.282590091f},
-std::array<float,2>{0.374230891f, 0.836903989f},
-std::array<float,2>{0.280215949f, 0.0220731851f},
-std::array<float,2>{0.548864782f, 0.709924698f},
-std::array<float,2>{0.852815509f, 0.424087644f},
-std::array<float,2>{0.19597742f, 0.880274653f},
-std::array<float,2>{0.0409593508f, 0.33273679f},
-std::array<float,2>{0.997100055f, 0.80651921f},
-std::array<float,2>{0.735343099f, 0.22029762f},
-std::array<float,2>{0.417984992f, 0.583097458f},
-std::array<float,2>{0.333688319f, 0.274101049f},
-std::array<float,2>{0.59311974f, 0.851898074f},
-std::array<float,2>{0.752212286f, 0.182271883f},
-std::array<float,2>{0.136076719f, 0.560909092f},
-std::array<float,2>{0.0870139077f, 0.0953486264f},
-std::array<float,2>{0.889078915f, 0.659853816f},
-std::array<float,2>{0.651523113f, 0.49565953f},
-std::array<float,2>{0.472545773f, 0.973513305f},
-std::array<float,2>{0.383154005f, 0.191227943f},
-std::array<float,2>{0.703932703f, 0.616013706f},
-std::array<float,2>{0.938131511f, 0.3746503f},
-std::array<float,2>{0.0206672475f, 0.753765345f},
-std::array<float,2>{0.246609345f, 0.381222934f},
-std::array<float,2>{0.816036761f, 0.933822513f},
-std::array<float,2>{0.521997154f, 0.0572555065f},
-std::array<float,2>{0.296208203f, 0.724529624f},
-std::array<float,2>{0.361550868f, 0.485776633f},
-std::array<float,2>{0.604310095f, 0.980447054f},
-std::array<float,2>{0.799559772f, 0.107266955f},
-std::array<float,2>{0.174011603f, 0.667213917f},
-std::array<float,2>{0.1170175f, 0.177918181f},
-std::array<float,2>{0.918857276f, 0.548821807f},
-std::array<float,2>{0.658671916f, 0.271128982f},
-std::array<float,2>{0.460871369f, 0.848770022f},
-std::array<float,2>{0.406419545f, 0.0508903675f},
-std::array<float,2>{0.748970568f, 0.729093194f},
-std::array<float,2>{0.990996718f, 0.388758719f},
-std::array<float,2>{0.0322590321f, 0.924608469f},
-std::array<float,2>{0.192915827f, 0.36097759f},
-std::array<float,2>{0.847011566f, 0.759769261f},
-std::array<float,2>{0.555342019f, 0.198464572f},
-std::array<float,2>{0.270755261f, 0.623375773f},
-std::array<float,2>{0.482525766f, 0.295221537f},
-std::array<float,2>{0.640902102f, 0.828217089f},
-std::array<float,2>{0.880702853f, 0.127086192f},
-std::array<float,2>{0.0813405961f, 0.503125489f},
-std::array<float,2>{0.132330909f, 0.0654311776f},
-std::array<float,2>{0.763437271f, 0.647973478f},
-std::array<float,2>{0.581072569f, 0.452534646f},
-std::array<float,2>{0.341199785f, 0.956041515f},
-std::array<float,2>{0.28325808f, 0.229466006f},
-std::array<float,2>{0.528165996f, 0.589838922f},
-std::array<float,2>{0.828075051f, 0.341133028f},
-std::array<float,2>{0.241129518f, 0.80060786f},
-std::array<float,2>{0.0286964756f, 0.43419379f},
-std::array<float,2>{0.948175669f, 0.884333491f},
-std::array<float,2>{0.711199939f, 0.0247118752f},
-std::array<float,2>{0.377569407f, 0.716774464f},
-std::array<float,2>{0.40471372f, 0.403724521f},
-std::array<float,2>{0.699094296f, 0.90782088f},
-std::array<float,2>{0.963175476f, 0.0319916569f},
-std::array<float,2>{0.0118809231f, 0.740144074f},
-std::array<float,2>{0.224157289f, 0.217117742f},
-std::array<float,2>{0.841628432f, 0.607554376f},
-std::array<float,2>{0.501844347f, 0.345023632f},
-std::array<float,2>{0.302315801f, 0.77944684f},
-std::array<float,2>{0.327232778f, 0.115799084f},
-std::array<float,2>{0.578113437f, 0.686611593f},
-std::array<float,2>{0.777960896f, 0.470735699f},
-std::array<float,2>{0.148242474f, 0.985191226f},
-std::array<float,2>{0.0722289383f, 0.252693057f},
-std::array<float,2>{0.900178194f, 0.861057937f},
-std::array<float,2>{0.635497928f, 0.165658727f},
-std::array<float,2>{0.495176941f, 0.545472324f},
-std::array<float,2>{0.261792898f, 0.318946272f},
-std::array<float,2>{0.534994483f, 0.785877228f},
-std::array<float,2>{0.870938301f, 0.246465355f},
-std::array<float,2>{0.208392203f, 0.569136024f},
-std::array<float,2>{0.0487591214f, 0.0151064796f},
-std::array<float,2>{0.974876225f, 0.699567258f},
-std::array<float,2>{0.729372799f, 0.416460037f},
-std::array<float,2>{0.432938516f, 0.899469495f},
-std::array<float,2>{0.442860484f, 0.1432257f},
-std::array<float,2>{0.682027876f, 0.523228407f},
-std::array<float,2>{0.935977042f, 0.296990246f},
-std::array<float,2>{0.103905685f, 0.816798329f},
-std::array<float,2>{0.158836097f, 0.455549151f},
-std::array<float,2>{0.786083519f, 0.94644171f},
-std::array<float,2>{0.613566756f, 0.0787724108f},
-std::array<float,2>{0.349480957f, 0.637324274f},
-std::array<float,2>{0.288126588f, 0.477032244f},
-std::array<float,2>{0.524887145f, 0.993335962f},
-std::array<float,2>{0.821405649f, 0.123642609f},
-std::array<float,2>{0.235684887f, 0.67399925f},
-std::array<float,2>{0.0244151484f, 0.163947821f},
-std::array<float,2>{0.951043785f, 0.537095487f},
-std::array<float,2>{0.717082739f, 0.264895231f},
-std::array<float,2>{0.379816711f, 0.870666564f},
-std::array<float,2>{0.479143977f, 0.0456618667f},
-std::array<float,2>{0.646391511f, 0.744671941f},
-std::array<float,2>{0.876489043f, 0.39099732f},
-std::array<float,2>{0.0856572837f, 0.921665847f},
-std::array<float,2>{0.125485495f, 0.358922482f},
-std::array<float,2>{0.761277735f, 0.766126215f},
-std::array<float,2>{0.584859729f, 0.210803062f},
-std::array<float,2>{0.336488247f, 0.599301279f},
-std::array<float,2>{0.41246289f, 0.304866642f},
-std::array<float,2>{0.742991269f, 0.82173115f},
-std::array<float,2>{0.984532535f, 0.149147511f},
-std::array<float,2>{0.0367547721f, 0.525007784f},
-std::array<float,2>{0.189204216f, 0.0922337621f},
-std::array<float,2>{0.851319075f, 0.629502594f},
-std::array<float,2>{0.562368393f, 0.4623757f},
-std::array<float,2>{0.266828775f, 0.939580977f},
-std::array<float,2>{0.365238458f, 0.242006227f},
-std::array<float,2>{0.606181324f, 0.570670724f},
-std::array<float,2>{0.804423988f, 0.321714371f},
-std::array<float,2>{0.177942336f, 0.790860534f},
-std::array<float,2>{0.113029279f, 0.413388401f},
-std::array<float,2>{0.9171772f, 0.891867638f},
-std::array<float,2>{0.662160218f, 0.00321286777f},
-std::array<float,2>{0.454205304f, 0.689552426f},
-std::array<float,2>{0.438358068f, 0.375488847f},
-std::array<float,2>{0.68512398f, 0.931086659f},
-std::array<float,2>{0.932506502f, 0.0593379959f},
-std::array<float,2>{0.108407848f, 0.719003379f},
-std::array<float,2>{0.162552655f, 0.192075327f},
-std::array<float,2>{0.783218324f, 0.612717986f},
-std::array<float,2>{0.610576391f, 0.367553413f},
-std::array<float,2>{0.344188154f, 0.756415784f},
-std::array<float,2>{0.258679956f, 0.0999845937f},
-std::array<float,2>{0.538682759f, 0.660975397f},
-std::array<float,2>{0.873344779f, 0.499209464f},
-std::array<float,2>{0.204106122f, 0.972447991f},
-std::array<float,2>{0.0520647652f, 0.277915239f},
-std::array<float,2>{0.970402956f, 0.858507991f},
-std::array<float,2>{0.732631028f, 0.187310517f},
-std::array<float,2>{0.434025168f, 0.556215763f},
-std::array<float,2>{0.321792811f, 0.330627978f},
-std::array<float,2>{0.570648074f, 0.810153425f},
-std::array<float,2>{0.777326941f, 0.223711163f},
-std::array<float,2>{0.142934799f, 0.581114769f},
-std::array<float,2>{0.0768579394f, 0.016360525f},
-std::array<float,2>{0.904949665f, 0.705271542f},
-std::array<float,2>{0.639548063f, 0.425931573f},
-std::array<float,2>{0.497292221f, 0.875764549f},
-std::array<float,2>{0.400380135f, 0.135909766f},
-std::array<float,2>{0.702305377f, 0.512857378f},
-std::array<float,2>{0.966180146f, 0.288630158f},
-std::array<float,2>{0.00969699398f, 0.84230566f},
-std::array<float,2>{0.220065579f, 0.441363871f},
-std::array<float,2>{0.839174092f, 0.963289678f},
-std::array<float,2>{0.50737834f, 0.0713001117f},
-std::array<float,2>{0.297302902f, 0.653596103f},
-std::array<float,2>{0.357015431f, 0.431357801f},
-std::array<float,2>{0.619769633f, 0.888169289f},
-std::array<float,2>{0.796370983f, 0.0310842395f},
-std::array<float,2>{0.166504905f, 0.714182019f},
-std::array<float,2>{0.0955148786f, 0.231753081f},
-std::array<float,2>{0.928105772f, 0.590056717f},
-std::array<float,2>{0.676136136f, 0.338656396f},
-std::array<float,2>{0.45268923f, 0.801573992f},
-std::array<float,2>{0.423731953f, 0.0691737086f},
-std::array<float,2>{0.719542086f, 0.640694797f},
-std::array<float,2>{0.980211496f, 0.44859603f},
-std::array<float,2>{0.0573192798f, 0.960389197f},
-std::array<float,2>{0.214046627f, 0.291091621f},
-std::array<float,2>{0.861240447f, 0.834598422f},
-std::array<float,2>{0.540021777f, 0.13057825f},
-std::array<float,2>{0.25730437f, 0.505423844f},
-std::array<float,2>{0.487308472f, 0.364306986f},
-std::array<float,2>{0.629381239f, 0.764872313f},
-std::array<float,2>{0.895533383f, 0.201243818f},
-std::array<float,2>{0.0691653937f, 0.618525743f},
-std::array<float,2>{0.155623123f, 0.0499355868f},
-std::array<float,2>{0.765808046f, 0.730851293f},
-std::array<float,2>{0.569161415f, 0.383062452f},
-std::array<float,2>{0.315727323f, 0.927926183f},
-std::array<float,2>{0.306240141f, 0.175613254f},
-std::array<float,2>{0.511352777f, 0.552462697f},
-std::array<float,2>{0.829504251f, 0.268088371f},
-std::array<float,2>{0.230275661f, 0.846174419f},
-std::array<float,2>{0.00721138297f, 0.491075754f},
-std::array<float,2>{0.957719207f, 0.982893884f},
-std::array<float,2>{0.688507915f, 0.102688015f},
-std::array<float,2>{0.393122733f, 0.670983434f},
-std::array<float,2>{0.387941331f, 0.460605472f},
-std::array<float,2>{0.708191514f, 0.952849329f},
-std::array<float,2>{0.943525195f, 0.0838960707f},
-std::array<float,2>{0.0184010863f, 0.634549618f},
-std::array<float,2>{0.24447231f, 0.147524849f},
-std::array<float,2>{0.819805861f, 0.516059697f},
-std::array<float,2>{0.516467035f, 0.304276079f},
-std::array<float,2>{0.289203078f, 0.813584208f},
-std::array<float,2>{0.331667125f, 0.0112638716f},
-std::array<float,2>{0.587093413f, 0.699161589f},
-std::array<float,2>{0.755141139f, 0.418582797f},
-std::array<float,2>{0.139938399f, 0.903292418f},
-std::array<float,2>{0.0936403424f, 0.315706104f},
-std::array<float,2>{0.884037435f, 0.783393681f},
-std::array<float,2>{0.65604043f, 0.244367078f},
-std::array<float,2>{0.473799467f, 0.565670967f},
-std::array<float,2>{0.276455134f, 0.257644296f},
-std::array<float,2>{0.553007424f, 0.865622699f},
-std::array<float,2>{0.856997907f, 0.170154825f},
-std::array<float,2>{0.202391952f, 0.541106582f},
-std::array<float,2>{0.043346338f, 0.109593332f},
-std::array<float,2>{0.995787621f, 0.682403147f},
-std::array<float,2>{0.741054416f, 0.474697739f},
-std::array<float,2>{0.414995611f, 0.990948617f},
-std::array<float,2>{0.463800609f, 0.210946038f},
-std::array<float,2>{0.67079699f, 0.605028331f},
-std::array<float,2>{0.90955478f, 0.350263655f},
-std::array<float,2>{0.120793134f, 0.776303053f},
-std::array<float,2>{0.184217572f, 0.399996877f},
-std::array<float,2>{0.811142027f, 0.910812497f},
-std::array<float,2>{0.596003413f, 0.0368803255f},
-std::array<float,2>{0.369485945f, 0.736174881f},
-std::array<float,2>{0.251841784f, 0.397182941f},
-std::array<float,2>{0.543769419f, 0.914139748f},
-std::array<float,2>{0.866620779f, 0.0408552215f},
-std::array<float,2>{0.218361825f, 0.748924613f},
-std::array<float,2>{0.0617878325f, 0.206767201f},
-std::array<float,2>{0.984355211f, 0.595853627f},
-std::array<float,2>{0.724275649f, 0.353990525f},
-std::array<float,2>{0.42666173f, 0.771163762f},
-std::array<float,2>{0.449112952f, 0.118365653f},
-std::array<float,2>{0.673493624f, 0.678017497f},
-std::array<float,2>{0.92288959f, 0.480577022f},
-std::array<float,2>{0.0980538949f, 0.999078453f},
-std::array<float,2>{0.171278715f, 0.260265112f},
-std::array<float,2>{0.790279269f, 0.872626543f},
-std::array<float,2>{0.623561263f, 0.156263143f},
-std::array<float,2>{0.355332017f, 0.53459692f},
-std::array<float,2>{0.398202926f, 0.324364394f},
-std::array<float,2>{0.69271487f, 0.794295788f},
-std::array<float,2>{0.955249548f, 0.237019435f},
-std::array<float,2>{0.00312376441f, 0.576691926f},
-std::array<float,2>{0.231298089f, 0.0073022549f},
-std::array<float,2>{0.834633648f, 0.692496657f},
-std::array<float,2>{0.512988985f, 0.407010913f},
-std::array<float,2>{0.312348843f, 0.898016214f},
-std::array<float,2>{0.31644401f, 0.156158283f},
-std::array<float,2>{0.564537048f, 0.530700982f},
-std::array<float,2>{0.771810889f, 0.310479045f},
-std::array<float,2>{0.150786877f, 0.824244916f},
-std::array<float,2>{0.064817749f, 0.465724051f},
-std::array<float,2>{0.892877042f, 0.943747699f},
-std::array<float,2>{0.627873003f, 0.0862531289f},
-std::array<float,2>{0.489033222f, 0.627254665f},
-std::array<float,2>{0.469804287f, 0.492419809f},
-std::array<float,2>{0.649958134f, 0.976203322f},
-std::array<float,2>{0.887307405f, 0.09610416f},
-std::array<float,2>{0.0893148854f, 0.657262623f},
-std::array<float,2>{0.132885724f, 0.181492388f},
-std::array<float,2>{0.750772953f, 0.559978604f},
-std::array<float,2>{0.591348469f, 0.276281387f},
-std::array<float,2>{0.33559835f, 0.855394721f},
-std::array<float,2>{0.293884754f, 0.0554151498f},
-std::array<float,2>{0.520685315f, 0.726130962f},
-std::array<float,2>{0.814413548f, 0.379268587f},
-std::array<float,2>{0.249230817f, 0.937298954f},
-std::array<float,2>{0.0217267517f, 0.372481704f},
-std::array<float,2>{0.939897418f, 0.750366688f},
-std::array<float,2>{0.706510723f, 0.188003689f},
-std::array<float,2>{0.386209726f, 0.614136994f},
-std::array<float,2>{0.373001963f, 0.284546316f},
-std::array<float,2>{0.599781334f, 0.838968575f},
-std::array<float,2>{0.80804199f, 0.137605116f},
-std::array<float,2>{0.180767149f, 0.510983109f},
-std::array<float,2>{0.121696129f, 0.0781054199f},
-std::array<float,2>{0.910696745f, 0.648902178f},
-std::array<float,2>{0.664910138f, 0.442803651f},
-std::array<float,2>{0.465813488f, 0.966152132f},
-std::array<float,2>{0.420568347f, 0.221203893f},
-std::array<float,2>{0.736741424f, 0.585005462f},
-std::array<float,2>{0.998409748f, 0.334569216f},
-std::array<float,2>{0.0419386961f, 0.807035804f},
-std::array<float,2>{0.198659614f, 0.423587739f},
-std::array<float,2>{0.854670644f, 0.881766379f},
-std::array<float,2>{0.548111796f, 0.0195710436f},
-std::array<float,2>{0.278025329f, 0.707044721f},
-std::array<float,2>{0.341914117f, 0.44929117f},
-std::array<float,2>{0.57895714f, 0.954614937f},
-std::array<float,2>{0.765592396f, 0.0641243085f},
-std::array<float,2>{0.129492745f, 0.646235824f},
-std::array<float,2>{0.0794333443f, 0.126444668f},
-std::array<float,2>{0.882750452f, 0.500307262f},
-std::array<float,2>{0.644055426f, 0.294193029f},
-std::array<float,2>{0.480736703f, 0.830727994f},
-std::array<float,2>{0.376577944f, 0.0262854639f},
-std::array<float,2>{0.713443756f, 0.718644619f},
-std::array<float,2>{0.94596535f, 0.436870813f},
-std::array<float,2>{0.0308916215f, 0.886069953f},
-std::array<float,2>{0.238397866f, 0.343476623f},
-std::array<float,2>{0.825658441f, 0.798243999f},
-std::array<float,2>{0.530044615f, 0.228090301f},
-std::array<float,2>{0.282927454f, 0.586658597f},
-std::array<float,2>{0.457076639f, 0.272305697f},
-std::array<float,2>{0.656336069f, 0.849809766f},
-std::array<float,2>{0.920608938f, 0.176697299f},
-std::array<float,2>{0.114601202f, 0.549263716f},
-std::array<float,2>{0.173309892f, 0.107632935f},
-std::array<float,2>{0.796933115f, 0.665191054f},
-std::array<float,2>{0.603210092f, 0.486765444f},
-std::array<float,2>{0.36093241f, 0.977594614f},
-std::array<float,2>{0.272277504f, 0.196639091f},
-std::array<float,2>{0.557419896f, 0.621555984f},
-std::array<float,2>{0.845451057f, 0.362731993f},
-std::array<float,2>{0.194473714f, 0.758907974f},
-std::array<float,2>{0.0341181904f, 0.387867123f},
-std::array<float,2>{0.989446402f, 0.922329605f},
-std::array<float,2>{0.746406436f, 0.0534668341f},
-std::array<float,2>{0.409732968f, 0.727979958f},
-std::array<float,2>{0.42975691f, 0.415924162f},
-std::array<float,2>{0.728004336f, 0.901989877f},
-std::array<float,2>{0.974049687f, 0.0120170219f},
-std::array<float,2>{0.0489021242f, 0.701224923f},
-std::array<float,2>{0.209750608f, 0.249702111f},
-std::array<float,2>{0.868270397f, 0.56643784f},
-std::array<float,2>{0.531953216f, 0.318323255f},
-std::array<float,2>{0.264682412f, 0.788245678f},
-std::array<float,2>{0.349892765f, 0.0813643262f},
-std::array<float,2>{0.615995407f, 0.639791369f},
-std::array<float,2>{0.787196696f, 0.454349726f},
-std::array<float,2>{0.156721026f, 0.947658181f},
-std::array<float,2>{0.102380894f, 0.300730765f},
-std::array<float,2>{0.935437262f, 0.82024008f},
-std::array<float,2>{0.679888964f, 0.141753137f},
-std::array<float,2>{0.444859236f, 0.519742012f},
-std::array<float,2>{0.302758396f, 0.346408606f},
-std::array<float,2>{0.503736556f, 0.778808713f},
-std::array<float,2>{0.841887951f, 0.215842545f},
-std::array<float,2>{0.224744469f, 0.606988609f},
-std::array<float,2>{0.0154009154f, 0.0348671973f},
-std::array<float,2>{0.962497234f, 0.741645098f},
-std::array<float,2>{0.696756423f, 0.405547053f},
-std::array<float,2>{0.402972251f, 0.90864253f},
-std::array<float,2>{0.493098259f, 0.166744724f},
-std::array<float,2>{0.632965624f, 0.543580711f},
-std::array<float,2>{0.90095222f, 0.251019031f},
-std::array<float,2>{0.0741260573f, 0.862036645f},
-std::array<float,2>{0.145332173f, 0.469771206f},
-std::array<float,2>{0.780311644f, 0.988019228f},
-std::array<float,2>{0.574528396f, 0.113283187f},
-std::array<float,2>{0.326010525f, 0.68463999f},
-std::array<float,2>{0.259939462f, 0.498957515f},
-std::array<float,2>{0.536560953f, 0.97163254f},
-std::array<float,2>{0.872982681f, 0.101414025f},
-std::array<float,2>{0.205685705f, 0.661837637f},
-std::array<float,2>{0.0537536032f, 0.186036929f},
-std::array<float,2>{0.971574366f, 0.554865122f},
-std::array<float,2>{0.731163383f, 0.279083043f},
-std::array<float,2>{0.436295897f, 0.857541561f},
-std::array<float,2>{0.439576566f, 0.0601739734f},
-std::array<float,2>{0.686560571f, 0.719917238f},
-std::array<float,2>{0.931282997f, 0.376350433f},
-std::array<float,2>{0.106309004f, 0.930640399f},
-std::array<float,2>{0.161757499f, 0.36886093f},
-std::array<float,2>{0.782713056f, 0.756924272f},
-std::array<float,2>{0.611983895f, 0.19265011f},
-std::array<float,2>{0.347560734f, 0.611649752f},
-std::array<float,2>{0.401738197f, 0.287792116f},
-std::array<float,2>{0.700357258f, 0.842914522f},
-std::array<float,2>{0.967837453f, 0.135602161f},
-std::array<float,2>{0.0107117798f, 0.512448728f},
-std::array<float,2>{0.222623691f, 0.0704666302f},
-std::array<float,2>{0.836337328f, 0.653302491f},
-std::array<float,2>{0.505004585f, 0.43972525f},
-std::array<float,2>{0.299859285f, 0.963884056f},
-std::array<float,2>{0.32270965f, 0.222846046f},
-std::array<float,2>{0.572454751f, 0.581039786f},
-std::array<float,2>{0.774670601f, 0.331493467f},
-std::array<float,2>{0.141028464f, 0.808952868f},
-std::array<float,2>{0.0758320764f, 0.427342057f},
-std::array<float,2>{0.903728008f, 0.87635082f},
-std::array<float,2>{0.637983263f, 0.0170014799f},
-std::array<float,2>{0.499628723f, 0.706072807f},
-std::array<float,2>{0.476672649f, 0.391619325f},
-std::array<float,2>{0.647913754f, 0.919994652f},
-std::array<float,2>{0.878076255f, 0.0466936342f},
-std::array<float,2>{0.0831491798f, 0.745549142f},
-std::array<float,2>{0.127497703f, 0.209249094f},
-std::array<float,2>{0.759733498f, 0.598577797f},
-std::array<float,2>{0.582546771f, 0.358326584f},
-std::array<float,2>{0.338499397f, 0.767059803f},
-std::array<float,2>{0.286653012f, 0.124025337f},
-std::array<float,2>{0.525892138f, 0.675228119f},
-std::array<float,2>{0.823777378f, 0.477786362f},
-std::array<float,2>{0.238041908f, 0.992478132f},
-std::array<float,2>{0.0269093309f, 0.263923049f},
-std::array<float,2>{0.953072906f, 0.869371951f},
-std::array<float,2>{0.715924025f, 0.162179992f},
-std::array<float,2>{0.38098675f, 0.535160661f},
-std::array<float,2>{0.364587218f, 0.320516407f},
-std::array<float,2>{0.6086936f, 0.789257467f},
-std::array<float,2>{0.801650584f, 0.240423918f},
-std::array<float,2>{0.175942183f, 0.57220614f},
-std::array<float,2>{0.110465281f, 0.00277987635f},
-std::array<float,2>{0.915645301f, 0.691079259f},
-std::array<float,2>{0.66157949f, 0.412142962f},
-std::array<float,2>{0.456872284f, 0.89127779f},
-std::array<float,2>{0.41167447f, 0.149861589f},
-std::array<float,2>{0.745757282f, 0.524367273f},
-std::array<float,2>{0.987059593f, 0.305841565f},
-std::array<float,2>{0.0371854976f, 0.820968688f},
-std::array<float,2>{0.190598309f, 0.461801171f},
-std::array<float,2>{0.84809804f, 0.940683007f},
-std::array<float,2>{0.559623837f, 0.092899248f},
-std::array<float,2>{0.269148469f, 0.630703568f},
-std::array<float,2>{0.329165369f, 0.418985069f},
-std::array<float,2>{0.588037729f, 0.903671682f},
-std::array<float,2>{0.75764972f, 0.0103313318f},
-std::array<float,2>{0.136805117f, 0.697609842f},
-std::array<float,2>{0.0917030126f, 0.245175257f},
-std::array<float,2>{0.886239588f, 0.564665854f},
-std::array<float,2>{0.653004169f, 0.315277547f},
-std::array<float,2>{0.475536555f, 0.784700513f},
-std::array<float,2>{0.389220595f, 0.0823362172f},
-std::array<float,2>{0.710918665f, 0.633354485f},
-std::array<float,2>{0.942465007f, 0.459643096f},
-std::array<float,2>{0.0164080039f, 0.951426089f},
-std::array<float,2>{0.24252446f, 0.303096443f},
-std::array<float,2>{0.818150878f, 0.81326431f},
-std::array<float,2>{0.51855123f, 0.146917075f},
-std::array<float,2>{0.292655528f, 0.517115176f},
-std::array<float,2>{0.461882293f, 0.351494342f},
-std::array<float,2>{0.668617606f, 0.777171552f},
-std::array<float,2>{0.907973707f, 0.212172717f},
-std::array<float,2>{0.118276551f, 0.604025841f},
-std::array<float,2>{0.186711684f, 0.0355700776f},
-std::array<float,2>{0.809271693f, 0.734757423f},
-std::array<float,2>{0.594617188f, 0.399180144f},
-std::array<float,2>{0.367272139f, 0.911778092f},
-std::array<float,2>{0.27441442f, 0.171050474f},
-std::array<float,2>{0.552282155f, 0.542029738f},
-std::array<float,2>{0.858677685f, 0.256102741f},
-std::array<float,2>{0.199474201f, 0.866314709f},
-std::array<float,2>{0.0461031199f, 0.475779682f},
-std::array<float,2>{0.992473781f, 0.991240382f},
-std::array<float,2>{0.738445401f, 0.111204229f},
-std::array<float,2>{0.417922914f, 0.683169663f},
-std::array<float,2>{0.424619079f, 0.448200792f},
-std::array<float,2>{0.722083271f, 0.959355593f},
-std::array<float,2>{0.977216959f, 0.0702337697f},
-std::array<float,2>{0.0557827614f, 0.641620517f},
-std::array<float,2>{0.212641984f, 0.129411682f},
-std::array<float,2>{0.863045275f, 0.504074335f},
-std::array<float,2>{0.541055083f, 0.292076677f},
-std::array<float,2>{0.255408645f, 0.835581124f},
-std::array<float,2>{0.358072221f, 0.0299699698f},
-std::array<float,2>{0.61801064f, 0.71289593f},
-std::array<float,2>{0.793126106f, 0.430381566f},
-std::array<float,2>{0.165266037f, 0.887098491f},
-std::array<float,2>{0.0970081985f, 0.339221269f},
-std::array<float,2>{0.927542865f, 0.801969051f},
-std::array<float,2>{0.679232419f, 0.231291592f},
-std::array<float,2>{0.450603932f, 0.591715693f},
-std::array<float,2>{0.308290422f, 0.269316822f},
-std::array<float,2>{0.509094954f, 0.847284496f},
-std::array<float,2>{0.830113769f, 0.174255282f},
-std::array<float,2>{0.227642313f, 0.551618814f},
-std::array<float,2>{0.00522665214f, 0.102455452f},
-std::array<float,2>{0.959212661f, 0.670459628f},
-std::array<float,2>{0.690648139f, 0.491565347f},
-std::array<float,2>{0.391938597f, 0.983430624f},
-std::array<float,2>{0.486086488f, 0.202825487f},
-std::array<float,2>{0.632008195f, 0.617202997f},
-std::array<float,2>{0.896726966f, 0.363689095f},
-std::array<float,2>{0.0681305379f, 0.764060795f},
-std::array<float,2>{0.15398486f, 0.384504795f},
-std::array<float,2>{0.768436134f, 0.929300547f},
-std::array<float,2>{0.566951334f, 0.0490082949f},
-std::array<float,2>{0.312635571f, 0.731726408f},
-std::array<float,2>{0.294938534f, 0.380558044f},
-std::array<float,2>{0.522931337f, 0.935777366f},
-std::array<float,2>{0.814876914f, 0.0562432371f},
-std::array<float,2>{0.247132689f, 0.725032389f},
-std::array<float,2>{0.0204740744f, 0.188938633f},
-std::array<float,2>{0.938753247f, 0.6147632f},
-std::array<float,2>{0.704266012f, 0.371465892f},
-std::array<float,2>{0.384160429f, 0.751920164f},
-std::array<float,2>{0.47118032f, 0.0975235477f},
-std::array<float,2>{0.650510728f, 0.656296611f},
-std::array<float,2>{0.890146017f, 0.493472844f},
-std::array<float,2>{0.0862810016f, 0.975500762f},
-std::array<float,2>{0.135413542f, 0.276799262f},
-std::array<float,2>{0.753726721f, 0.854015768f},
-std::array<float,2>{0.592199862f, 0.180620268f},
-std::array<float,2>{0.33223629f, 0.559071481f},
-std::array<float,2>{0.419744343f, 0.335936397f},
-std::array<float,2>{0.736315668f, 0.808296561f},
-std::array<float,2>{0.99646312f, 0.22259827f},
-std::array<float,2>{0.0399296768f, 0.58406949f},
-std::array<float,2>{0.197091624f, 0.0208403021f},
-std::array<float,2>{0.851930022f, 0.708708763f},
-std::array<float,2>{0.550031781f, 0.422342747f},
-std::array<float,2>{0.281066298f, 0.881962061f},
-std::array<float,2>{0.373912305f, 0.137731135f},
-std::array<float,2>{0.598939419f, 0.510733902f},
-std::array<float,2>{0.805092216f, 0.284160078f},
-std::array<float,2>{0.182908505f, 0.838015378f},
-std::array<float,2>{0.124608777f, 0.441603094f},
-std::array<float,2>{0.912383497f, 0.965798736f},
-std::array<float,2>{0.666758955f, 0.0764712989f},
-std::array<float,2>{0.467003018f, 0.650164962f},
-std::array<float,2>{0.447005332f, 0.4814924f},
-std::array<float,2>{0.674646497f, 0.998152733f},
-std::array<float,2>{0.925019383f, 0.117236532f},
-std::array<float,2>{0.101178207f, 0.679520309f},
-std::array<float,2>{0.169182211f, 0.158152252f},
-std::array<float,2>{0.792711198f, 0.533978939f},
-std::array<float,2>{0.622732222f, 0.260864854f},
-std::array<float,2>{0.351634681f, 0.871692836f},
-std::array<float,2>{0.252333283f, 0.0394708738f},
-std::array<float,2>{0.546713114f, 0.749331951f},
-std::array<float,2>{0.863729179f, 0.398029089f},
-std::array<float,2>{0.215695843f, 0.915256619f},
-std::array<float,2>{0.0595167503f, 0.355223298f},
-std::array<float,2>{0.981164575f, 0.769962251f},
-std::array<float,2>{0.726397872f, 0.205883592f},
-std::array<float,2>{0.428747743f, 0.597197831f},
-std::array<float,2>{0.319925368f, 0.309124649f},
-std::array<float,2>{0.564029098f, 0.825452447f},
-std::array<float,2>{0.771319509f, 0.154850274f},
-std::array<float,2>{0.148595989f, 0.529626489f},
-std::array<float,2>{0.06429746f, 0.0873460472f},
-std::array<float,2>{0.890807569f, 0.628384888f},
-std::array<float,2>{0.626085877f, 0.466427952f},
-std::array<float,2>{0.491509765f, 0.944644868f},
-std::array<float,2>{0.395548046f, 0.237900868f},
-std::array<float,2>{0.69429338f, 0.577701032f},
-std::array<float,2>{0.95459497f, 0.325912058f},
-std::array<float,2>{0.00125815836f, 0.793738306f},
-std::array<float,2>{0.233185902f, 0.407259285f},
-std::array<float,2>{0.833151281f, 0.897023559f},
-std::array<float,2>{0.513946712f, 0.00639845058f},
-std::array<float,2>{0.309677511f, 0.691774964f},
-std::array<float,2>{0.347724646f, 0.453634292f},
-std::array<float,2>{0.614662588f, 0.948454142f},
-std::array<float,2>{0.786145151f, 0.0801435262f},
-std::array<float,2>{0.159919232f, 0.639343739f},
-std::array<float,2>{0.104964219f, 0.141399264f},
-std::array<float,2>{0.936645091f, 0.520721197f},
-std::array<float,2>{0.683472037f, 0.299030155f},
-std::array<float,2>{0.441980422f, 0.818508685f},
-std::array<float,2>{0.431952417f, 0.0128001329f},
-std::array<float,2>{0.730391622f, 0.702525377f},
-std::array<float,2>{0.976269186f, 0.414609224f},
-std::array<float,2>{0.0473364703f, 0.900847018f},
-std::array<float,2>{0.207924813f, 0.316809595f},
-std::array<float,2>{0.869248152f, 0.787443757f},
-std::array<float,2>{0.534103513f, 0.248544604f},
-std::array<float,2>{0.262887836f, 0.568034708f},
-std::array<float,2>{0.494696409f, 0.250398457f},
-std::array<float,2>{0.636518121f, 0.862967193f},
-std::array<float,2>{0.898632646f, 0.167258352f},
-std::array<float,2>{0.0712524503f, 0.544038415f},
-std::array<float,2>{0.146567732f, 0.114703037f},
-std::array<float,2>{0.779178917f, 0.68399322f},
-std::array<float,2>{0.576541364f, 0.469641358f},
-std::array<float,2>{0.326623857f, 0.986652374f},
-std::array<float,2>{0.301336646f, 0.215383366f},
-std::array<float,2>{0.500563502f, 0.605938792f},
-std::array<float,2>{0.840165377f, 0.346980214f},
-std::array<float,2>{0.223583832f, 0.77737987f},
-std::array<float,2>{0.013034597f, 0.404313534f},
-std::array<float,2>{0.96394664f, 0.909558177f},
-std::array<float,2>{0.697661936f, 0.0338794589f},
-std::array<float,2>{0.405899972f, 0.741063595f},
-std::array<float,2>{0.378202766f, 0.435774386f},
-std::array<float,2>{0.712087393f, 0.885701358f},
-std::array<float,2>{0.948863685f, 0.0266328603f},
-std::array<float,2>{0.0278835148f, 0.717058182f},
-std::array<float,2>{0.242055342f, 0.227045149f},
-std::array<float,2>{0.826374352f, 0.586972177f},
-std::array<float,2>{0.528747976f, 0.341810584f},
-std::array<float,2>{0.284954458f, 0.796935201f},
-std::array<float,2>{0.340725571f, 0.0633254945f},
-std::array<float,2>{0.580442905f, 0.645376563f},
-std::array<float,2>{0.762147427f, 0.450519174f},
-std::array<float,2>{0.131539494f, 0.953700244f},
-std::array<float,2>{0.0802259222f, 0.293142855f},
-std::array<float,2>{0.879450858f, 0.831923962f},
-std::array<float,2>{0.642241299f, 0.125793815f},
-std::array<float,2>{0.483797789f, 0.501635969f},
-std::array<float,2>{0.269830078f, 0.362012118f},
-std::array<float,2>{0.556635082f, 0.758517861f},
-std::array<float,2>{0.845888555f, 0.196013957f},
-std::array<float,2>{0.191533759f, 0.62228018f},
-std::array<float,2>{0.0312687233f, 0.0542468652f},
-std::array<float,2>{0.991701186f, 0.72711134f},
-std::array<float,2>{0.749579847f, 0.386893779f},
-std::array<float,2>{0.408202946f, 0.922860801f},
-std::array<float,2>{0.459820956f, 0.177343965f},
-std::array<float,2>{0.659567714f, 0.549930751f},
-std::array<float,2>{0.919311166f, 0.273201525f},
-std::array<float,2>{0.115972482f, 0.851131618f},
-std::array<float,2>{0.175534338f, 0.487406522f},
-std::array<float,2>{0.800122678f, 0.977001727f},
-std::array<float,2>{0.605150521f, 0.109165259f},
-std::array<float,2>{0.363141865f, 0.664076567f},
-std::array<float,2>{0.298190892f, 0.438104212f},
-std::array<float,2>{0.506426215f, 0.961256206f},
-std::array<float,2>{0.838325262f, 0.0725244358f},
-std::array<float,2>{0.218915194f, 0.654743671f},
-std::array<float,2>{0.00805487204f, 0.13314639f},
-std::array<float,2>{0.965567291f, 0.51430279f},
-std::array<float,2>{0.701528549f, 0.285553247f},
-std::array<float,2>{0.399071574f, 0.841054559f},
-std::array<float,2>{0.496993452f, 0.0186574552f},
-std::array<float,2>{0.640459955f, 0.704385877f},
-std::array<float,2>{0.90594995f, 0.428556144f},
-std::array<float,2>{0.0772689953f, 0.878410339f},
-std::array<float,2>{0.143994525f, 0.329126537f},
-std::array<float,2>{0.775987685f, 0.812241137f},
-std::array<float,2>{0.571642876f, 0.226066142f},
-std::array<float,2>{0.320651829f, 0.579196274f},
-std::array<float,2>{0.434616268f, 0.279366255f},
-std::array<float,2>{0.734006166f, 0.856100321f},
-std::array<float,2>{0.969621778f, 0.184424967f},
-std::array<float,2>{0.0509971343f, 0.55720818f},
-std::array<float,2>{0.20361945f, 0.0984445587f},
-std::array<float,2>{0.874544501f, 0.662598431f},
-std::array<float,2>{0.537825048f, 0.49719727f},
-std::array<float,2>{0.259388775f, 0.969079733f},
-std::array<float,2>{0.34567374f, 0.194317907f},
-std::array<float,2>{0.60972178f, 0.60984689f},
-std::array<float,2>{0.785068274f, 0.369869918f},
-std::array<float,2>{0.163582027f, 0.754349172f},
-std::array<float,2>{0.108121701f, 0.378609717f},
-std::array<float,2>{0.932742059f, 0.931799769f},
-std::array<float,2>{0.683805883f, 0.0609315932f},
-std::array<float,2>{0.438962519f, 0.722074449f},
-std::array<float,2>{0.453911871f, 0.410456508f},
-std::array<float,2>{0.663426876f, 0.892964661f},
-std::array<float,2>{0.916763783f, 0.000331940741f},
-std::array<float,2>{0.111423068f, 0.688149452f},
-std::array<float,2>{0.179070249f, 0.239162937f},
-std::array<float,2>{0.802888215f, 0.574006379f},
-std::array<float,2>{0.606779337f, 0.323035449f},
-std::array<float,2>{0.367079139f, 0.792347968f},
-std::array<float,2>{0.266101927f, 0.0915110856f},
-std::array<float,2>{0.560718477f, 0.63213551f},
-std::array<float,2>{0.850099981f, 0.464174211f},
-std::array<float,2>{0.188290179f, 0.938042939f},
-std::array<float,2>{0.0360342935f, 0.307255745f},
-std::array<float,2>{0.986199677f, 0.823025405f},
-std::array<float,2>{0.743972659f, 0.150728196f},
-std::array<float,2>{0.413759857f, 0.526002645f},
-std::array<float,2>{0.3378869f, 0.356793582f},
-std::array<float,2>{0.585282624f, 0.769016564f},
-std::array<float,2>{0.759945869f, 0.208885536f},
-std::array<float,2>{0.126916707f, 0.599619627f},
-std::array<float,2>{0.0841155201f, 0.044617746f},
-std::array<float,2>{0.875828266f, 0.743872821f},
-std::array<float,2>{0.644807875f, 0.39424786f},
-std::array<float,2>{0.480382442f, 0.919197738f},
-std::array<float,2>{0.379885614f, 0.161813945f},
-std::array<float,2>{0.718580663f, 0.537460625f},
-std::array<float,2>{0.949223936f, 0.263237655f},
-std::array<float,2>{0.0242828745f, 0.869005084f},
-std::array<float,2>{0.234556347f, 0.480413675f},
-std::array<float,2>{0.821166575f, 0.995649338f},
-std::array<float,2>{0.524142206f, 0.121309638f},
-std::array<float,2>{0.287119329f, 0.672355294f},
-std::array<float,2>{0.370963335f, 0.401019573f},
-std::array<float,2>{0.596975446f, 0.913673222f},
-std::array<float,2>{0.811732829f, 0.0378942937f},
-std::array<float,2>{0.185056597f, 0.7366817f},
-std::array<float,2>{0.119678929f, 0.21378319f},
-std::array<float,2>{0.908663988f, 0.603386343f},
-std::array<float,2>{0.671377659f, 0.347703248f},
-std::array<float,2>{0.46461755f, 0.773620188f},
-std::array<float,2>{0.415800869f, 0.111818299f},
-std::array<float,2>{0.741875231f, 0.680910647f},
-std::array<float,2>{0.994549394f, 0.473607779f},
-std::array<float,2>{0.0441434719f, 0.988871455f},
-std::array<float,2>{0.201889902f, 0.254866421f},
-std::array<float,2>{0.855595529f, 0.864715517f},
-std::array<float,2>{0.55441153f, 0.169869184f},
-std::array<float,2>{0.276120424f, 0.540512323f},
-std::array<float,2>{0.473111182f, 0.314356148f},
-std::array<float,2>{0.655181289f, 0.782175183f},
-std::array<float,2>{0.88311398f, 0.243502855f},
-std::array<float,2>{0.0923039392f, 0.562532783f},
-std::array<float,2>{0.138962209f, 0.00816142838f},
-std::array<float,2>{0.754394054f, 0.695403755f},
-std::array<float,2>{0.586189806f, 0.420144767f},
-std::array<float,2>{0.330964148f, 0.905252695f},
-std::array<float,2>{0.29028064f, 0.146287009f},
-std::array<float,2>{0.517285466f, 0.518029988f},
-std::array<float,2>{0.818362117f, 0.301381111f},
-std::array<float,2>{0.245977029f, 0.816302657f},
-std::array<float,2>{0.018673392f, 0.457495093f},
-std::array<float,2>{0.944458008f, 0.950399935f},
-std::array<float,2>{0.707054675f, 0.084926717f},
-std::array<float,2>{0.38697356f, 0.635333002f},
-std::array<float,2>{0.394284099f, 0.489509434f},
-std::array<float,2>{0.68780154f, 0.981736124f},
-std::array<float,2>{0.958359778f, 0.104061536f},
-std::array<float,2>{0.00597953144f, 0.669553816f},
-std::array<float,2>{0.229228154f, 0.172882468f},
-std::array<float,2>{0.829030216f, 0.554293275f},
-std::array<float,2>{0.510082722f, 0.265708447f},
-std::array<float,2>{0.305287212f, 0.844711185f},
-std::array<float,2>{0.315183908f, 0.0472848192f},
-std::array<float,2>{0.569415867f, 0.734084249f},
-std::array<float,2>{0.766805053f, 0.385321647f},
-std::array<float,2>{0.154594138f, 0.925929368f},
-std::array<float,2>{0.0694792569f, 0.365284055f},
-std::array<float,2>{0.894561708f, 0.762421489f},
-std::array<float,2>{0.630660117f, 0.200981155f},
-std::array<float,2>{0.486534536f, 0.620959282f},
-std::array<float,2>{0.256504864f, 0.289479166f},
-std::array<float,2>{0.54096961f, 0.833240807f},
-std::array<float,2>{0.860329151f, 0.13144508f},
-std::array<float,2>{0.213039055f, 0.506237388f},
-std::array<float,2>{0.0584706962f, 0.0681024939f},
-std::array<float,2>{0.979462802f, 0.643045187f},
-std::array<float,2>{0.71980226f, 0.445634842f},
-std::array<float,2>{0.422505438f, 0.958973229f},
-std::array<float,2>{0.451906055f, 0.233533099f},
-std::array<float,2>{0.676787794f, 0.592194557f},
-std::array<float,2>{0.929364324f, 0.337166995f},
-std::array<float,2>{0.09432666f, 0.803699732f},
-std::array<float,2>{0.167292237f, 0.433000416f},
-std::array<float,2>{0.795866549f, 0.888684213f},
-std::array<float,2>{0.620135963f, 0.0279769059f},
-std::array<float,2>{0.355750144f, 0.711144328f},
-std::array<float,2>{0.279285699f, 0.425023019f},
-std::array<float,2>{0.547497392f, 0.879710793f},
-std::array<float,2>{0.854255557f, 0.0232444685f},
-std::array<float,2>{0.198022038f, 0.710558057f},
-std::array<float,2>{0.0428718403f, 0.219531149f},
-std::array<float,2>{0.999423921f, 0.582274377f},
-std::array<float,2>{0.737923205f, 0.33340764f},
-std::array<float,2>{0.421025306f, 0.804768503f},
-std::array<float,2>{0.465937436f, 0.0759026483f},
-std::array<float,2>{0.665140748f, 0.652171254f},
-std::array<float,2>{0.911272168f, 0.444968283f},
-std::array<float,2>{0.122940704f, 0.967557549f},
-std::array<float,2>{0.180339217f, 0.281615347f},
-std::array<float,2>{0.807109952f, 0.83775878f},
-std::array<float,2>{0.601281583f, 0.139124066f},
-std::array<float,2>{0.372015238f, 0.507949114f},
-std::array<float,2>{0.385111779f, 0.373287082f},
-std::array<float,2>{0.705835581f, 0.752891243f},
-std::array<float,2>{0.940608919f, 0.190292165f},
-std::array<float,2>{0.0227037258f, 0.616913795f},
-std::array<float,2>{0.248665288f, 0.0577988438f},
-std::array<float,2>{0.813410103f, 0.723507881f},
-std::array<float,2>{0.519586921f, 0.382415146f},
-std::array<float,2>{0.294856489f, 0.935456753f},
-std::array<float,2>{0.334468037f, 0.183338001f},
-std::array<float,2>{0.590492129f, 0.5624879f},
-std::array<float,2>{0.751447499f, 0.275029272f},
-std::array<float,2>{0.13392593f, 0.852982581f},
-std::array<float,2>{0.0884801671f, 0.494628787f},
-std::array<float,2>{0.887946069f, 0.974498451f},
-std::array<float,2>{0.649016917f, 0.0946154594f},
-std::array<float,2>{0.469457239f, 0.658508778f},
-std::array<float,2>{0.489941388f, 0.468670011f},
-std::array<float,2>{0.628168821f, 0.942304432f},
-std::array<float,2>{0.893811584f, 0.0880576149f},
-std::array<float,2>{0.0656578988f, 0.625241518f},
-std::array<float,2>{0.152234882f, 0.153951198f},
-std::array<float,2>{0.772861302f, 0.527778208f},
-std::array<float,2>{0.565434098f, 0.31084767f},
-std::array<float,2>{0.317504406f, 0.827203989f},
-std::array<float,2>{0.310581297f, 0.0055682743f},
-std::array<float,2>{0.512286425f, 0.694624722f},
-std::array<float,2>{0.835186481f, 0.408576965f},
-std::array<float,2>{0.23147361f, 0.895545542f},
-std::array<float,2>{0.00209989259f, 0.327122331f},
-std::array<float,2>{0.956120074f, 0.79663074f},
-std::array<float,2>{0.692314327f, 0.234624565f},
-std::array<float,2>{0.39712581f, 0.575266302f},
-std::array<float,2>{0.35397014f, 0.259507298f},
-std::array<float,2>{0.624509871f, 0.873638511f},
-std::array<float,2>{0.789997935f, 0.159824476f},
-std::array<float,2>{0.170262039f, 0.53156513f},
-std::array<float,2>{0.0986817628f, 0.120672889f},
-std::array<float,2>{0.922038972f, 0.677257776f},
-std::array<float,2>{0.672794104f, 0.484044194f},
-std::array<float,2>{0.447950274f, 0.997256517f},
-std::array<float,2>{0.427455366f, 0.203892678f},
-std::array<float,2>{0.723536313f, 0.594121039f},
-std::array<float,2>{0.982482314f, 0.352330565f},
-std::array<float,2>{0.0607549623f, 0.77321285f},
-std::array<float,2>{0.217419565f, 0.395380855f},
-std::array<float,2>{0.866188526f, 0.917804539f},
-std::array<float,2>{0.544821978f, 0.0410327464f},
-std::array<float,2>{0.250251025f, 0.746538997f},
-std::array<float,2>{0.325005203f, 0.472305954f},
-std::array<float,2>{0.575634599f, 0.985447884f},
-std::array<float,2>{0.779720783f, 0.11649055f},
-std::array<float,2>{0.146471247f, 0.685643792f},
-std::array<float,2>{0.0732080787f, 0.164878994f},
-std::array<float,2>{0.902266264f, 0.546218812f},
-std::array<float,2>{0.633965671f, 0.253298432f},
-std::array<float,2>{0.494121313f, 0.859908462f},
-std::array<float,2>{0.403339237f, 0.0326884948f},
-std::array<float,2>{0.695659101f, 0.739046335f},
-std::array<float,2>{0.96105355f, 0.403160155f},
-std::array<float,2>{0.0146376081f, 0.906945288f},
-std::array<float,2>{0.225975052f, 0.344159871f},
-std::array<float,2>{0.842926621f, 0.780367315f},
-std::array<float,2>{0.502620161f, 0.218493924f},
-std::array<float,2>{0.3045353f, 0.608506739f},
-std::array<float,2>{0.443564475f, 0.298343241f},
-std::array<float,2>{0.681572318f, 0.81747824f},
-std::array<float,2>{0.934467614f, 0.14358221f},
-std::array<float,2>{0.102550067f, 0.521909714f},
-std::array<float,2>{0.15820305f, 0.0793680027f},
-std::array<float,2>{0.788976371f, 0.638285697f},
-std::array<float,2>{0.616335034f, 0.456160218f},
-std::array<float,2>{0.351299316f, 0.946266234f},
-std::array<float,2>{0.264522821f, 0.247739255f},
-std::array<float,2>{0.532833934f, 0.56992811f},
-std::array<float,2>{0.867199481f, 0.319596797f},
-std::array<float,2>{0.210316822f, 0.786156237f},
-std::array<float,2>{0.0500492007f, 0.41709435f},
-std::array<float,2>{0.973595023f, 0.898611009f},
-std::array<float,2>{0.726839185f, 0.0144575182f},
-std::array<float,2>{0.430976331f, 0.70068115f},
-std::array<float,2>{0.408283651f, 0.390095711f},
-std::array<float,2>{0.747226655f, 0.925641179f},
-std::array<float,2>{0.989207327f, 0.0524199791f},
-std::array<float,2>{0.0344627425f, 0.730402768f},
-std::array<float,2>{0.193416342f, 0.197333992f},
-std::array<float,2>{0.843750954f, 0.624506533f},
-std::array<float,2>{0.558009386f, 0.359924763f},
-std::array<float,2>{0.273131877f, 0.761328578f},
-std::array<float,2>{0.359866053f, 0.105736613f},
-std::array<float,2>{0.602419853f, 0.666758597f},
-std::array<float,2>{0.798076332f, 0.484496117f},
-std::array<float,2>{0.172771797f, 0.979278266f},
-std::array<float,2>{0.113885708f, 0.270434797f},
-std::array<float,2>{0.921366334f, 0.848133445f},
-std::array<float,2>{0.657363355f, 0.179163933f},
-std::array<float,2>{0.458496481f, 0.547525227f},
-std::array<float,2>{0.282112926f, 0.340514272f},
-std::array<float,2>{0.530777216f, 0.79940784f},
-std::array<float,2>{0.824416876f, 0.23003915f},
-std::array<float,2>{0.239854023f, 0.588381708f},
-std::array<float,2>{0.029879747f, 0.0243027024f},
-std::array<float,2>{0.946359098f, 0.715792716f},
-std::array<float,2>{0.714733124f, 0.435377836f},
-std::array<float,2>{0.375163108f, 0.883630335f},
-std::array<float,2>{0.482421339f, 0.128107131f},
-std::array<float,2>{0.643286586f, 0.502190113f},
-std::array<float,2>{0.881758332f, 0.296670556f},
-std::array<float,2>{0.0783629715f, 0.829732716f},
-std::array<float,2>{0.130540863f, 0.451653391f},
-std::array<float,2>{0.764258027f, 0.956141055f},
-std::array<float,2>{0.579766333f, 0.0653391182f},
-std::array<float,2>{0.34345454f, 0.647077382f},
-std::array<float,2>{0.255353689f, 0.446121365f},
-std::array<float,2>{0.541959882f, 0.958392382f},
-std::array<float,2>{0.862309098f, 0.0673919469f},
-std::array<float,2>{0.212120473f, 0.643180907f},
-std::array<float,2>{0.0561571531f, 0.130976006f},
-std::array<float,2>{0.976708233f, 0.506677389f},
-std::array<float,2>{0.722252965f, 0.289760262f},
-std::array<float,2>{0.423886895f, 0.833959281f},
-std::array<float,2>{0.450691909f, 0.0275190491f},
-std::array<float,2>{0.679092705f, 0.711484194f},
-std::array<float,2>{0.927003562f, 0.433359891f},
-std::array<float,2>{0.0972632468f, 0.889168501f},
-std::array<float,2>{0.165636554f, 0.337837458f},
-std::array<float,2>{0.79391408f, 0.803174853f},
-std::array<float,2>{0.617273748f, 0.234024242f},
-std::array<float,2>{0.357648611f, 0.592480361f},
-std::array<float,2>{0.392518103f, 0.266227782f},
-std::array<float,2>{0.691068411f, 0.844084322f},
-std::array<float,2>{0.959810913f, 0.17373544f},
-std::array<float,2>{0.00585252419f, 0.554114521f},
-std::array<float,2>{0.228248388f, 0.103677601f},
-std::array<float,2>{0.830898881f, 0.669333339f},
-std::array<float,2>{0.50969857f, 0.489837229f},
-std::array<float,2>{0.307908118f, 0.982023001f},
-std::array<float,2>{0.313260943f, 0.200267866f},
-std::array<float,2>{0.566868126f, 0.620233238f},
-std::array<float,2>{0.76767242f, 0.366199762f},
-std::array<float,2>{0.153785184f, 0.761897862f},
-std::array<float,2>{0.0675709844f, 0.385144472f},
-std::array<float,2>{0.897405624f, 0.926535189f},
-std::array<float,2>{0.632647395f, 0.0473788828f},
-std::array<float,2>{0.485361636f, 0.733726144f},
-std::array<float,2>{0.474824369f, 0.420504034f},
-std::array<float,2>{0.652614415f, 0.904748142f},
-std::array<float,2>{0.88600558f, 0.00846706238f},
-std::array<float,2>{0.0909905061f, 0.69619453f},
-std::array<float,2>{0.137354016f, 0.244006798f},
-std::array<float,2>{0.757038653f, 0.563263416f},
-std::array<float,2>{0.588495851f, 0.313797176f},
-std::array<float,2>{0.329777837f, 0.781595051f},
-std::array<float,2>{0.292339981f, 0.0842794552f},
-std::array<float,2>{0.517942667f, 0.635220706f},
-std::array<float,2>{0.817482114f, 0.457657218f},
-std::array<float,2>{0.24306713f, 0.950950921f},
-std::array<float,2>{0.0160090476f, 0.301021665f},
-std::array<float,2>{0.943125606f, 0.815436363f},
-std::array<float,2>{0.710110009f, 0.14591752f},
-std::array<float,2>{0.38910681f, 0.518410861f},
-std::array<float,2>{0.368121177f, 0.348539531f},
-std::array<float,2>{0.594095886f, 0.774007738f},
-std::array<float,2>{0.808723509f, 0.213167652f},
-std::array<float,2>{0.187170669f, 0.602813542f},
-std::array<float,2>{0.119100891f, 0.0372038744f},
-std::array<float,2>{0.907462656f, 0.736849487f},
-std::array<float,2>{0.668419838f, 0.400669307f},
-std::array<float,2>{0.461128473f, 0.913278639f},
-std::array<float,2>{0.417201936f, 0.16894944f},
-std::array<float,2>{0.738828957f, 0.540969372f},
-std::array<float,2>{0.992818773f, 0.254265457f},
-std::array<float,2>{0.046501644f, 0.865046918f},
-std::array<float,2>{0.19982633f, 0.472864002f},
-std::array<float,2>{0.859088659f, 0.988503337f},
-std::array<float,2>{0.551789284f, 0.111443445f},
-std::array<float,2>{0.275016218f, 0.68147862f},
-std::array<float,2>{0.337933362f, 0.393689841f},
-std::array<float,2>{0.582283378f, 0.919769049f},
-std::array<float,2>{0.759272456f, 0.044179596f},
-std::array<float,2>{0.127182752f, 0.74339062f},
-std::array<float,2>{0.083644338f, 0.208013013f},
-std::array<float,2>{0.878825843f, 0.600484908f},
-std::array<float,2>{0.648042619f, 0.356967062f},
-std::array<float,2>{0.477156579f, 0.769135416f},
-std::array<float,2>{0.381736755f, 0.121772602f},
-std::array<float,2>{0.716556132f, 0.672535777f},
-std::array<float,2>{0.952175498f, 0.479632735f},
-std::array<float,2>{0.0268481579f, 0.995216012f},
-std::array<float,2>{0.237677395f, 0.262815952f},
-std::array<float,2>{0.82365787f, 0.868501425f},
-std::array<float,2>{0.525625646f, 0.161460504f},
-std::array<float,2>{0.286298633f, 0.538061559f},
-std::array<float,2>{0.45652613f, 0.322429299f},
-std::array<float,2>{0.661807299f, 0.792538702f},
-std::array<float,2>{0.915260136f, 0.238661572f},
-std::array<float,2>{0.111109532f, 0.573607028f},
-std::array<float,2>{0.176437721f, 0.000976254174f},
-std::array<float,2>{0.800994039f, 0.68785733f},
-std::array<float,2>{0.609367311f, 0.410766155f},
-std::array<float,2>{0.364996731f, 0.893361866f},
-std::array<float,2>{0.268958181f, 0.150891632f},
-std::array<float,2>{0.560207009f, 0.525855839f},
-std::array<float,2>{0.848186016f, 0.30687961f},
-std::array<float,2>{0.191264018f, 0.822409749f},
-std::array<float,2>{0.037970908f, 0.464811295f},
-std::array<float,2>{0.986386478f, 0.937967539f},
-std::array<float,2>{0.745495439f, 0.0911249369f},
-std::array<float,2>{0.411237299f, 0.632630467f},
-std::array<float,2>{0.436028004f, 0.497849226f},
-std::array<float,2>{0.730948985f, 0.969658673f},
-std::array<float,2>{0.971139967f, 0.0977016017f},
-std::array<float,2>{0.054526411f, 0.662377775f},
-std::array<float,2>{0.205191165f, 0.183640659f},
-std::array<float,2>{0.872359753f, 0.556775093f},
-std::array<float,2>{0.53685832f, 0.279931396f},
-std::array<float,2>{0.260527581f, 0.85559696f},
-std::array<float,2>{0.347100586f, 0.0613020398f},
-std::array<float,2>{0.611386716f, 0.722313166f},
-std::array<float,2>{0.782908976f, 0.378416419f},
-std::array<float,2>{0.161370218f, 0.932474196f},
-std::array<float,2>{0.105674602f, 0.369574636f},
-std::array<float,2>{0.930845976f, 0.75475949f},
-std::array<float,2>{0.687137842f, 0.193621099f},
-std::array<float,2>{0.440310746f, 0.610341012f},
-std::array<float,2>{0.300338447f, 0.285844088f},
-std::array<float,2>{0.505629241f, 0.841785431f},
-std::array<float,2>{0.836529434f, 0.133604303f},
-std::array<float,2>{0.221836358f, 0.514108896f},
-std::array<float,2>{0.0101999044f, 0.0731577352f},
-std::array<float,2>{0.968514264f, 0.655048847f},
-std::array<float,2>{0.700730801f, 0.437630206f},
-std::array<float,2>{0.402278215f, 0.961515844f},
-std::array<float,2>{0.499080509f, 0.226154521f},
-std::array<float,2>{0.638221443f, 0.579811692f},
-std::array<float,2>{0.904060423f, 0.329794675f},
-std::array<float,2>{0.0752045214f, 0.811889589f},
-std::array<float,2>{0.14127022f, 0.42774874f},
-std::array<float,2>{0.774974167f, 0.87857163f},
-std::array<float,2>{0.57300508f, 0.0190436356f},
-std::array<float,2>{0.32281965f, 0.704639733f},
-std::array<float,2>{0.284461409f, 0.434987128f},
-std::array<float,2>{0.528998196f, 0.883124709f},
-std::array<float,2>{0.827112615f, 0.023606902f},
-std::array<float,2>{0.241521493f, 0.71495831f},
-std::array<float,2>{0.0277052615f, 0.229645088f},
-std::array<float,2>{0.948297441f, 0.588107109f},
-std::array<float,2>{0.712500453f, 0.340126216f},
-std::array<float,2>{0.378518105f, 0.799019873f},
-std::array<float,2>{0.48414731f, 0.0645099282f},
-std::array<float,2>{0.641896188f, 0.646837473f},
-std::array<float,2>{0.879076123f, 0.451752365f},
-std::array<float,2>{0.0808009952f, 0.956919789f},
-std::array<float,2>{0.131249174f, 0.296338737f},
-std::array<float,2>{0.762599111f, 0.829225838f},
-std::array<float,2>{0.580990195f, 0.128855094f},
-std::array<float,2>{0.340200812f, 0.50248152f},
-std::array<float,2>{0.407307535f, 0.359522462f},
-std::array<float,2>{0.749500692f, 0.760974586f},
-std::array<float,2>{0.991534173f, 0.197800159f},
-std::array<float,2>{0.0321170464f, 0.624584079f},
-std::array<float,2>{0.192351967f, 0.0517761409f},
-std::array<float,2>{0.846636415f, 0.72988987f},
-std::array<float,2>{0.555727065f, 0.390228599f},
-std::array<float,2>{0.270383328f, 0.925145745f},
-std::array<float,2>{0.362497836f, 0.179615587f},
-std::array<float,2>{0.604521215f, 0.54703337f},
-std::array<float,2>{0.800752938f, 0.26990819f},
-std::array<float,2>{0.175006613f, 0.848527431f},
-std::array<float,2>{0.115546137f, 0.485161424f},
-std::array<float,2>{0.919630289f, 0.978747129f},
-std::array<float,2>{0.65974319f, 0.106288314f},
-std::array<float,2>{0.458992153f, 0.6663059f},
-std::array<float,2>{0.441536903f, 0.457001179f},
-std::array<float,2>{0.682854116f, 0.945786893f},
-std::array<float,2>{0.937170386f, 0.0799545869f},
-std::array<float,2>{0.105287433f, 0.638158143f},
-std::array<float,2>{0.159435168f, 0.144447476f},
-std::array<float,2>{0.786812067f, 0.522222519f},
-std::array<float,2>{0.615216851f, 0.297911555f},
-std::array<float,2>{0.348348349f, 0.81800586f},
-std::array<float,2>{0.263609946f, 0.0138987079f},
-std::array<float,2>{0.533682346f, 0.70094198f},
-std::array<float,2>{0.869788587f, 0.417825073f},
-std::array<float,2>{0.20744215f, 0.899294019f},
-std::array<float,2>{0.0476459004f, 0.320290059f},
-std::array<float,2>{0.975611091f, 0.78685385f},
-std::array<float,2>{0.729753852f, 0.247375473f},
-std::array<float,2>{0.432329148f, 0.569638014f},
-std::array<float,2>{0.326801628f, 0.253800154f},
-std::array<float,2>{0.577063382f, 0.859450817f},
-std::array<float,2>{0.778572083f, 0.164083973f},
-std::array<float,2>{0.147343189f, 0.546395123f},
-std::array<float,2>{0.07055749f, 0.116994493f},
-std::array<float,2>{0.899169326f, 0.686252892f},
-std::array<float,2>{0.63600117f, 0.471749932f},
-std::array<float,2>{0.49451226f, 0.985899389f},
-std::array<float,2>{0.405323774f, 0.217920423f},
-std::array<float,2>{0.698065042f, 0.609227777f},
-std::array<float,2>{0.964543104f, 0.344464511f},
-std::array<float,2>{0.0133193536f, 0.780912876f},
-std::array<float,2>{0.223030657f, 0.402561784f},
-std::array<float,2>{0.84038806f, 0.906268179f},
-std::array<float,2>{0.500362277f, 0.0328729525f},
-std::array<float,2>{0.301265955f, 0.738304675f},
-std::array<float,2>{0.352106571f, 0.483724385f},
-std::array<float,2>{0.622348189f, 0.997585118f},
-std::array<float,2>{0.792413712f, 0.120190479f},
-std::array<float,2>{0.169639021f, 0.67710346f},
-std::array<float,2>{0.10088978f, 0.159179747f},
-std::array<float,2>{0.925363779f, 0.532173395f},
-std::array<float,2>{0.673926532f, 0.259097785f},
-std::array<float,2>{0.446396112f, 0.873232365f},
-std::array<float,2>{0.429510593f, 0.0417069159f},
-std::array<float,2>{0.726052403f, 0.746625125f},
-std::array<float,2>{0.980843663f, 0.394909501f},
-std::array<float,2>{0.0588706993f, 0.917152226f},
-std::array<float,2>{0.215035349f, 0.351626277f},
-std::array<float,2>{0.864252687f, 0.77271533f},
-std::array<float,2>{0.546058178f, 0.20322299f},
-std::array<float,2>{0.252464533f, 0.594679773f},
-std::array<float,2>{0.491978616f, 0.311395615f},
-std::array<float,2>{0.626906931f, 0.828080893f},
-std::array<float,2>{0.891312718f, 0.153656155f},
-std::array<float,2>{0.0635244325f, 0.527839959f},
-std::array<float,2>{0.149409577f, 0.0885427669f},
-std::array<float,2>{0.770626962f, 0.625604153f},
-std::array<float,2>{0.563546777f, 0.467972964f},
-std::array<float,2>{0.319545716f, 0.941793442f},
-std::array<float,2>{0.310138464f, 0.235207409f},
-std::array<float,2>{0.514579833f, 0.576063454f},
-std::array<float,2>{0.833762884f, 0.326529145f},
-std::array<float,2>{0.232837945f, 0.796083033f},
-std::array<float,2>{0.0019124347f, 0.408692598f},
-std::array<float,2>{0.954284728f, 0.8960374f},
-std::array<float,2>{0.693704903f, 0.00495901238f},
-std::array<float,2>{0.396146685f, 0.694964945f},
-std::array<float,2>{0.3847076f, 0.38228786f},
-std::array<float,2>{0.704835415f, 0.934838772f},
-std::array<float,2>{0.939203262f, 0.0583990701f},
-std::array<float,2>{0.0199686475f, 0.722806036f},
-std::array<float,2>{0.248031899f, 0.189596608f},
-std::array<float,2>{0.815274417f, 0.61665076f},
-std::array<float,2>{0.523157835f, 0.373572171f},
-std::array<float,2>{0.29583928f, 0.752008498f},
-std::array<float,2>{0.332598954f, 0.0939846411f},
-std::array<float,2>{0.592288613f, 0.658899844f},
-std::array<float,2>{0.753386319f, 0.494957417f},
-std::array<float,2>{0.135124415f, 0.973697066f},
-std::array<float,2>{0.0867327452f, 0.274845332f},
-std::array<float,2>{0.889932573f, 0.853151321f},
-std::array<float,2>{0.651306689f, 0.18266423f},
-std::array<float,2>{0.471252978f, 0.561529517f},
-std::array<float,2>{0.280455261f, 0.333596498f},
-std::array<float,2>{0.550624549f, 0.805284798f},
-std::array<float,2>{0.852137983f, 0.219134629f},
-std::array<float,2>{0.196299747f, 0.582874537f},
-std::array<float,2>{0.0390987433f, 0.0229205042f},
-std::array<float,2>{0.996981263f, 0.710032523f},
-std::array<float,2>{0.735795021f, 0.425432742f},
-std::array<float,2>{0.419363439f, 0.879081964f},
-std::array<float,2>{0.467490286f, 0.139622614f},
-std::array<float,2>{0.666145563f, 0.508571088f},
-std::array<float,2>{0.91304034f, 0.282057941f},
-std::array<float,2>{0.124256447f, 0.83724755f},
-std::array<float,2>{0.183111519f, 0.444795698f},
-std::array<float,2>{0.805629849f, 0.966829121f},
-std::array<float,2>{0.599144399f, 0.0753887445f},
-std::array<float,2>{0.373294771f, 0.651834965f},
-std::array<float,2>{0.304897785f, 0.491901785f},
-std::array<float,2>{0.510583699f, 0.983904541f},
-std::array<float,2>{0.828255713f, 0.101593189f},
-std::array<float,2>{0.228603199f, 0.670392931f},
-std::array<float,2>{0.00673392462f, 0.174779743f},
-std::array<float,2>{0.958786726f, 0.551176786f},
-std::array<float,2>{0.688026726f, 0.268665463f},
-std::array<float,2>{0.393983185f, 0.846762657f},
-std::array<float,2>{0.487224162f, 0.049795758f},
-std::array<float,2>{0.630116045f, 0.732354283f},
-std::array<float,2>{0.89522928f, 0.383846223f},
-std::array<float,2>{0.070126608f, 0.928820312f},
-std::array<float,2>{0.155017972f, 0.363889784f},
-std::array<float,2>{0.76741153f, 0.764405668f},
-std::array<float,2>{0.570193529f, 0.202309608f},
-std::array<float,2>{0.314687937f, 0.617971539f},
-std::array<float,2>{0.422176272f, 0.292770445f},
-std::array<float,2>{0.720518172f, 0.834994078f},
-std::array<float,2>{0.978914738f, 0.129126966f},
-std::array<float,2>{0.0578546897f, 0.504610181f},
-std::array<float,2>{0.21341759f, 0.0694096163f},
-std::array<float,2>{0.859703898f, 0.64211446f},
-std::array<float,2>{0.54009521f, 0.447268367f},
-std::array<float,2>{0.256075263f, 0.959504902f},
-std::array<float,2>{0.356264561f, 0.230794027f},
-std::array<float,2>{0.621022582f, 0.591232777f},
-std::array<float,2>{0.795178354f, 0.339824051f},
-std::array<float,2>{0.167488098f, 0.802597404f},
-std::array<float,2>{0.094012849f, 0.429735541f},
-std::array<float,2>{0.928836882f, 0.887632549f},
-std::array<float,2>{0.677293062f, 0.0295012221f},
-std::array<float,2>{0.451200396f, 0.713472366f},
-std::array<float,2>{0.46431309f, 0.398516834f},
-std::array<float,2>{0.671779633f, 0.911440969f},
-std::array<float,2>{0.908706665f, 0.0359756574f},
-std::array<float,2>{0.119288772f, 0.734913766f},
-std::array<float,2>{0.185529247f, 0.212814063f},
-std::array<float,2>{0.812036514f, 0.603641689f},
-std::array<float,2>{0.597286642f, 0.350750983f},
-std::array<float,2>{0.370234907f, 0.776561141f},
-std::array<float,2>{0.275460422f, 0.110591426f},
-std::array<float,2>{0.55393821f, 0.68281579f},
-std::array<float,2>{0.856186867f, 0.476411879f},
-std::array<float,2>{0.201549858f, 0.991899133f},
-std::array<float,2>{0.044728037f, 0.256655306f},
-std::array<float,2>{0.99467063f, 0.866990149f},
-std::array<float,2>{0.741453409f, 0.171800166f},
-std::array<float,2>{0.415104359f, 0.542494357f},
-std::array<float,2>{0.330474615f, 0.314606965f},
-std::array<float,2>{0.586621284f, 0.78441292f},
-std::array<float,2>{0.754726291f, 0.245727554f},
-std::array<float,2>{0.139362782f, 0.56505394f},
-std::array<float,2>{0.091853559f, 0.0101942951f},
-std::array<float,2>{0.883784533f, 0.697863102f},
-std::array<float,2>{0.654703081f, 0.419779092f},
-std::array<float,2>{0.47356075f, 0.903915703f},
-std::array<float,2>{0.38746956f, 0.147138521f},
-std::array<float,2>{0.707857251f, 0.516773403f},
-std::array<float,2>{0.945113778f, 0.303426355f},
-std::array<float,2>{0.0194749348f, 0.812669873f},
-std::array<float,2>{0.245564118f, 0.459150106f},
-std::array<float,2>{0.819215536f, 0.951843977f},
-std::array<float,2>{0.517040789f, 0.08274661f},
-std::array<float,2>{0.290527761f, 0.632872701f},
-std::array<float,2>{0.366260022f, 0.412692398f},
-std::array<float,2>{0.607367277f, 0.891091704f},
-std::array<float,2>{0.803293526f, 0.00221433397f},
-std::array<float,2>{0.179276899f, 0.690824211f},
-std::array<float,2>{0.111949131f, 0.240970403f},
-std::array<float,2>{0.916422844f, 0.571664333f},
-std::array<float,2>{0.663934886f, 0.320993483f},
-std::array<float,2>{0.453583598f, 0.789605558f},
-std::array<float,2>{0.413269848f, 0.0934235379f},
-std::array<float,2>{0.743222594f, 0.629905581f},
-std::array<float,2>{0.985486627f, 0.461088896f},
-std::array<float,2>{0.0355377346f, 0.941291332f},
-std::array<float,2>{0.187610552f, 0.306252092f},
-std::array<float,2>{0.849694669f, 0.820779741f},
-std::array<float,2>{0.561441064f, 0.150237307f},
-std::array<float,2>{0.266288787f, 0.523853302f},
-std::array<float,2>{0.479930311f, 0.357451379f},
-std::array<float,2>{0.645153344f, 0.76729846f},
-std::array<float,2>{0.875002742f, 0.209835038f},
-std::array<float,2>{0.084792152f, 0.597734928f},
-std::array<float,2>{0.126055911f, 0.0462368131f},
-std::array<float,2>{0.76030463f, 0.74605155f},
-std::array<float,2>{0.58582598f, 0.392482579f},
-std::array<float,2>{0.337162942f, 0.92087394f},
-std::array<float,2>{0.287843913f, 0.162841439f},
-std::array<float,2>{0.523915529f, 0.536129713f},
-std::array<float,2>{0.820597708f, 0.264343053f},
-std::array<float,2>{0.235114843f, 0.869965971f},
-std::array<float,2>{0.0236712489f, 0.478306413f},
-std::array<float,2>{0.949797928f, 0.993133247f},
-std::array<float,2>{0.718123257f, 0.124599956f},
-std::array<float,2>{0.380792409f, 0.675374389f},
-std::array<float,2>{0.398904324f, 0.440073103f},
-std::array<float,2>{0.701807797f, 0.964538991f},
-std::array<float,2>{0.965274334f, 0.0710341334f},
-std::array<float,2>{0.00860123057f, 0.652703285f},
-std::array<float,2>{0.219297692f, 0.134945095f},
-std::array<float,2>{0.83865577f, 0.511980116f},
-std::array<float,2>{0.506143749f, 0.287182808f},
-std::array<float,2>{0.298417419f, 0.843500376f},
-std::array<float,2>{0.320811361f, 0.0174828712f},
-std::array<float,2>{0.5720281f, 0.707008958f},
-std::array<float,2>{0.775427878f, 0.426845014f},
-std::array<float,2>{0.144516036f, 0.876872957f},
-std::array<float,2>{0.0780045092f, 0.331852317f},
-std::array<float,2>{0.905618787f, 0.809431076f},
-std::array<float,2>{0.639971077f, 0.223346606f},
-std::array<float,2>{0.496379942f, 0.580092013f},
-std::array<float,2>{0.258885771f, 0.278485119f},
-std::array<float,2>{0.53758955f, 0.858294785f},
-std::array<float,2>{0.87445569f, 0.185722098f},
-std::array<float,2>{0.203438833f, 0.555635035f},
-std::array<float,2>{0.0517388918f, 0.100635141f},
-std::array<float,2>{0.969058871f, 0.661246121f},
-std::array<float,2>{0.733860373f, 0.498242587f},
-std::array<float,2>{0.435529381f, 0.971084893f},
-std::array<float,2>{0.439015538f, 0.192953512f},
-std::array<float,2>{0.684112668f, 0.611990869f},
-std::array<float,2>{0.933314145f, 0.368546247f},
-std::array<float,2>{0.107714817f, 0.757364452f},
-std::array<float,2>{0.163499713f, 0.376819998f},
-std::array<float,2>{0.784457505f, 0.930141032f},
-std::array<float,2>{0.610141218f, 0.0596677326f},
-std::array<float,2>{0.344950289f, 0.720262945f},
-std::array<float,2>{0.272841752f, 0.387660444f},
-std::array<float,2>{0.55840385f, 0.92360419f},
-std::array<float,2>{0.84424293f, 0.0540446825f},
-std::array<float,2>{0.193853959f, 0.726803541f},
-std::array<float,2>{0.0346840173f, 0.195392981f},
-std::array<float,2>{0.988358796f, 0.622930348f},
-std::array<float,2>{0.747872293f, 0.361637086f},
-std::array<float,2>{0.408799529f, 0.757908285f},
-std::array<float,2>{0.458321005f, 0.108621493f},
-std::array<float,2>{0.658150792f, 0.664682209f},
-std::array<float,2>{0.921804428f, 0.488060147f},
-std::array<float,2>{0.11360354f, 0.977142215f},
-std::array<float,2>{0.172148809f, 0.27272442f},
-std::array<float,2>{0.798491538f, 0.850765169f},
-std::array<float,2>{0.601619065f, 0.177026972f},
-std::array<float,2>{0.359736025f, 0.550553381f},
-std::array<float,2>{0.375837773f, 0.342472374f},
-std::array<float,2>{0.713927269f, 0.797747195f},
-std::array<float,2>{0.947021604f, 0.227514982f},
-std::array<float,2>{0.0294850674f, 0.587565839f},
-std::array<float,2>{0.239618167f, 0.0268649235f},
-std::array<float,2>{0.824889719f, 0.717710793f},
-std::array<float,2>{0.530277669f, 0.436159641f},
-std::array<float,2>{0.281273216f, 0.885231674f},
-std::array<float,2>{0.342864454f, 0.125479475f},
-std::array<float,2>{0.579525828f, 0.500995338f},
-std::array<float,2>{0.763803422f, 0.293891162f},
-std::array<float,2>{0.13034527f, 0.831180573f},
-std::array<float,2>{0.0790280402f, 0.451126903f},
-std::array<float,2>{0.88087666f, 0.953529775f},
-std::array<float,2>{0.642855644f, 0.0626301765f},
-std::array<float,2>{0.48165524f, 0.6449821f},
-std::array<float,2>{0.493578821f, 0.469125479f},
-std::array<float,2>{0.634682f, 0.987294734f},
-std::array<float,2>{0.901478231f, 0.115218252f},
-std::array<float,2>{0.0725712106f, 0.684491396f},
-std::array<float,2>{0.145680234f, 0.167875633f},
-std::array<float,2>{0.779813707f, 0.544497073f},
-std::array<float,2>{0.575888395f, 0.250773728f},
-std::array<float,2>{0.324305177f, 0.862606525f},
-std::array<float,2>{0.303795099f, 0.0335331596f},
-std::array<float,2>{0.502123296f, 0.740513861f},
-std::array<float,2>{0.843267441f, 0.405158311f},
-std::array<float,2>{0.226240858f, 0.910106003f},
-std::array<float,2>{0.0139027545f, 0.347580403f},
-std::array<float,2>{0.961703539f, 0.778286338f},
-std::array<float,2>{0.696212471f, 0.214914232f},
-std::array<float,2>{0.404255211f, 0.605980814f},
-std::array<float,2>{0.35059604f, 0.299668252f},
-std::array<float,2>{0.616789877f, 0.819255531f},
-std::array<float,2>{0.788433671f, 0.140770584f},
-std::array<float,2>{0.15753828f, 0.521040857f},
-std::array<float,2>{0.103044048f, 0.081004709f},
-std::array<float,2>{0.933937252f, 0.638810575f},
-std::array<float,2>{0.680674553f, 0.453460932f},
-std::array<float,2>{0.444209367f, 0.949059904f},
-std::array<float,2>{0.431239575f, 0.248403668f},
-std::array<float,2>{0.727301538f, 0.567510486f},
-std::array<float,2>{0.97300905f, 0.316960216f},
-std::array<float,2>{0.0505501069f, 0.787609339f},
-std::array<float,2>{0.210664123f, 0.414388895f},
-std::array<float,2>{0.868100107f, 0.901314974f},
-std::array<float,2>{0.532306671f, 0.0132825039f},
-std::array<float,2>{0.263707429f, 0.702818811f},
-std::array<float,2>{0.318172425f, 0.46611768f},
-std::array<float,2>{0.566142917f, 0.945086479f},
-std::array<float,2>{0.77338326f, 0.0875211135f},
-std::array<float,2>{0.151515171f, 0.628743589f},
-std::array<float,2>{0.0659235492f, 0.154320076f},
-std::array<float,2>{0.894305468f, 0.52995652f},
-std::array<float,2>{0.6284886f, 0.30904451f},
-std::array<float,2>{0.489726454f, 0.826054573f},
-std::array<float,2>{0.396584481f, 0.00599941751f},
-std::array<float,2>{0.691725969f, 0.692265391f},
-std::array<float,2>{0.956899762f, 0.407974273f},
-std::array<float,2>{0.00277796132f, 0.89692831f},
-std::array<float,2>{0.232235342f, 0.325656503f},
-std::array<float,2>{0.835781336f, 0.79315412f},
-std::array<float,2>{0.511809051f, 0.23746416f},
-std::array<float,2>{0.311145604f, 0.577224791f},
-std::array<float,2>{0.447600365f, 0.261578083f},
-std::array<float,2>{0.672218561f, 0.871178508f},
-std::array<float,2>{0.922605693f, 0.15725027f},
-std::array<float,2>{0.0994171277f, 0.533681035f},
-std::array<float,2>{0.170828968f, 0.117767408f},
-std::array<float,2>{0.789096296f, 0.679129958f},
-std::array<float,2>{0.624636829f, 0.482376963f},
-std::array<float,2>{0.354066163f, 0.998705566f},
-std::array<float,2>{0.250582546f, 0.205401689f},
-std::array<float,2>{0.544214547f, 0.597121418f},
-std::array<float,2>{0.865610123f, 0.354701698f},
-std::array<float,2>{0.216804758f, 0.770213127f},
-std::array<float,2>{0.0615130886f, 0.397802651f},
-std::array<float,2>{0.982953072f, 0.91587466f},
-std::array<float,2>{0.722925365f, 0.0396204256f},
-std::array<float,2>{0.426806897f, 0.749560893f},
-std::array<float,2>{0.421733469f, 0.422486395f},
-std::array<float,2>{0.737565398f, 0.882457614f},
-std::array<float,2>{0.999535322f, 0.021072505f},
-std::array<float,2>{0.0421300642f, 0.708367646f},
-std::array<float,2>{0.197521448f, 0.222159341f},
-std::array<float,2>{0.853678226f, 0.58458811f},
-std::array<float,2>{0.547050953f, 0.335131377f},
-std::array<float,2>{0.278576881f, 0.807687521f},
-std::array<float,2>{0.371309042f, 0.0770778209f},
-std::array<float,2>{0.600623667f, 0.649489343f},
-std::array<float,2>{0.807428777f, 0.442381054f},
-std::array<float,2>{0.179835692f, 0.964968681f},
-std::array<float,2>{0.122078963f, 0.283645511f},
-std::array<float,2>{0.912062287f, 0.838800788f},
-std::array<float,2>{0.665650368f, 0.138184085f},
-std::array<float,2>{0.466416061f, 0.509832025f},
-std::array<float,2>{0.293986022f, 0.371851414f},
-std::array<float,2>{0.520394444f, 0.75116241f},
-std::array<float,2>{0.81295979f, 0.189215004f},
-std::array<float,2>{0.248274624f, 0.614720166f},
-std::array<float,2>{0.0233310219f, 0.0558261164f},
-std::array<float,2>{0.940976799f, 0.725462735f},
-std::array<float,2>{0.70518738f, 0.380251199f},
-std::array<float,2>{0.385628164f, 0.936204553f},
-std::array<float,2>{0.468750954f, 0.179996029f},
-std::array<float,2>{0.64861244f, 0.559166193f},
-std::array<float,2>{0.888630927f, 0.276953101f},
-std::array<float,2>{0.0879517943f, 0.853658915f},
-std::array<float,2>{0.13455148f, 0.493687421f},
-std::array<float,2>{0.751711607f, 0.97499752f},
-std::array<float,2>{0.59001708f, 0.0970995575f},
-std::array<float,2>{0.334564298f, 0.657155752f},
-std::array<float,2>{0.273693442f, 0.47513485f},
-std::array<float,2>{0.551360309f, 0.990575671f},
-std::array<float,2>{0.857577324f, 0.110000275f},
-std::array<float,2>{0.200453743f, 0.681969285f},
-std::array<float,2>{0.0452089012f, 0.170737788f},
-std::array<float,2>{0.993525207f, 0.541843116f},
-std::array<float,2>{0.73976171f, 0.256998599f},
-std::array<float,2>{0.416328311f, 0.866081238f},
-std::array<float,2>{0.461950392f, 0.036483746f},
-std::array<float,2>{0.668977559f, 0.735597074f},
-std::array<float,2>{0.907131612f, 0.399517626f},
-std::array<float,2>{0.117921859f, 0.910486996f},
-std::array<float,2>{0.186156511f, 0.350060254f},
-std::array<float,2>{0.810293734f, 0.775629282f},
-std::array<float,2>{0.595103264f, 0.211899266f},
-std::array<float,2>{0.369043589f, 0.604566634f},
-std::array<float,2>{0.390326589f, 0.303772241f},
-std::array<float,2>{0.709012032f, 0.814351857f},
-std::array<float,2>{0.941585958f, 0.148280323f},
-std::array<float,2>{0.0174226258f, 0.516551435f},
-std::array<float,2>{0.243833333f, 0.0834292248f},
-std::array<float,2>{0.817257345f, 0.633794725f},
-std::array<float,2>{0.519329846f, 0.460400015f},
-std::array<float,2>{0.291573644f, 0.952556968f},
-std::array<float,2>{0.328466147f, 0.244655743f},
-std::array<float,2>{0.589842558f, 0.566190243f},
-std::array<float,2>{0.756286681f, 0.316383034f},
-std::array<float,2>{0.138455361f, 0.784172118f},
-std::array<float,2>{0.0903119221f, 0.418129832f},
-std::array<float,2>{0.885738015f, 0.902724564f},
-std::array<float,2>{0.653428018f, 0.0111941667f},
-std::array<float,2>{0.476537734f, 0.6984725f},
-std::array<float,2>{0.485059619f, 0.383387417f},
-std::array<float,2>{0.631755531f, 0.928325117f},
-std::array<float,2>{0.897756159f, 0.0506353304f},
-std::array<float,2>{0.066763252f, 0.73115629f},
-std::array<float,2>{0.15277037f, 0.201899424f},
-std::array<float,2>{0.769127488f, 0.619122028f},
-std::array<float,2>{0.568005979f, 0.364828557f},
-std::array<float,2>{0.313669831f, 0.765383303f},
-std::array<float,2>{0.307316571f, 0.103464454f},
-std::array<float,2>{0.508706033f, 0.671702623f},
-std::array<float,2>{0.831384718f, 0.490239471f},
-std::array<float,2>{0.226875961f, 0.98308146f},
-std::array<float,2>{0.0042213127f, 0.267719805f},
-std::array<float,2>{0.960841238f, 0.846216202f},
-std::array<float,2>{0.68974632f, 0.175057158f},
-std::array<float,2>{0.390679598f, 0.551759601f},
-std::array<float,2>{0.358732522f, 0.338318259f},
-std::array<float,2>{0.61862874f, 0.801218569f},
-std::array<float,2>{0.79484123f, 0.232122302f},
-std::array<float,2>{0.164652124f, 0.590507388f},
-std::array<float,2>{0.0960192457f, 0.0302818995f},
-std::array<float,2>{0.92599076f, 0.714775741f},
-std::array<float,2>{0.67801404f, 0.431100994f},
-std::array<float,2>{0.449736416f, 0.888348579f},
-std::array<float,2>{0.425444484f, 0.130125374f},
-std::array<float,2>{0.720949292f, 0.505284786f},
-std::array<float,2>{0.978095353f, 0.291563004f},
-std::array<float,2>{0.0554868132f, 0.83401823f},
-std::array<float,2>{0.211652339f, 0.448960245f},
-std::array<float,2>{0.861804783f, 0.960603476f},
-std::array<float,2>{0.542700231f, 0.0686367601f},
-std::array<float,2>{0.254416376f, 0.641198218f},
-std::array<float,2>{0.324068159f, 0.426270396f},
-std::array<float,2>{0.573299825f, 0.875042737f},
-std::array<float,2>{0.774327099f, 0.015880499f},
-std::array<float,2>{0.142005146f, 0.705692708f},
-std::array<float,2>{0.0746801049f, 0.224157736f},
-std::array<float,2>{0.902488828f, 0.581935108f},
-std::array<float,2>{0.63673991f, 0.330414921f},
-std::array<float,2>{0.498348773f, 0.809910893f},
-std::array<float,2>{0.400861353f, 0.0722211599f},
-std::array<float,2>{0.699705839f, 0.653832197f},
-std::array<float,2>{0.96682626f, 0.440867692f},
-std::array<float,2>{0.0114362566f, 0.963566899f},
-std::array<float,2>{0.220817924f, 0.288181454f},
-std::array<float,2>{0.837410808f, 0.841972888f},
-std::array<float,2>{0.504155517f, 0.136288494f},
-std::array<float,2>{0.29896757f, 0.513522029f},
-std::array<float,2>{0.4406479f, 0.367681205f},
-std::array<float,2>{0.686283529f, 0.75608784f},
-std::array<float,2>{0.929694891f, 0.191883698f},
-std::array<float,2>{0.107147753f, 0.613035679f},
-std::array<float,2>{0.160401821f, 0.058664564f},
-std::array<float,2>{0.781589925f, 0.719421923f},
-std::array<float,2>{0.612732887f, 0.375360996f},
-std::array<float,2>{0.346488595f, 0.931431532f},
-std::array<float,2>{0.261339784f, 0.18668139f},
-std::array<float,2>{0.535334706f, 0.555754304f},
-std::array<float,2>{0.871332347f, 0.277515382f},
-std::array<float,2>{0.2067803f, 0.858936071f},
-std::array<float,2>{0.0527743623f, 0.499956906f},
-std::array<float,2>{0.972391486f, 0.971701682f},
-std::array<float,2>{0.732036829f, 0.100471392f},
-std::array<float,2>{0.436788231f, 0.660473228f},
-std::array<float,2>{0.410484433f, 0.462859064f},
-std::array<float,2>{0.74481672f, 0.940077603f},
-std::array<float,2>{0.987676501f, 0.0925347358f},
-std::array<float,2>{0.0383265167f, 0.629251659f},
-std::array<float,2>{0.189576298f, 0.148448005f},
-std::array<float,2>{0.849313676f, 0.52458477f},
-std::array<float,2>{0.558804154f, 0.305578679f},
-std::array<float,2>{0.26790756f, 0.822066903f},
-std::array<float,2>{0.363718331f, 0.00344790914f},
-std::array<float,2>{0.607579231f, 0.690016091f},
-std::array<float,2>{0.801967025f, 0.413778782f},
-std::array<float,2>{0.177529559f, 0.892510176f},
-std::array<float,2>{0.109932713f, 0.322098851f},
-std::array<float,2>{0.914561212f, 0.790253043f},
-std::array<float,2>{0.66104877f, 0.2414013f},
-std::array<float,2>{0.455972672f, 0.571175754f},
-std::array<float,2>{0.285284251f, 0.265607715f},
-std::array<float,2>{0.526716709f, 0.870431483f},
-std::array<float,2>{0.822482705f, 0.163325071f},
-std::array<float,2>{0.236963108f, 0.536208332f},
-std::array<float,2>{0.0259448662f, 0.123050675f},
-std::array<float,2>{0.951747537f, 0.674547791f},
-std::array<float,2>{0.715438247f, 0.477249473f},
-std::array<float,2>{0.382645339f, 0.993993521f},
-std::array<float,2>{0.477576464f, 0.210395306f},
-std::array<float,2>{0.647061646f, 0.599042892f},
-std::array<float,2>{0.877408147f, 0.358617008f},
-std::array<float,2>{0.0821944997f, 0.765886307f},
-std::array<float,2>{0.128159523f, 0.39125371f},
-std::array<float,2>{0.758518159f, 0.921155512f},
-std::array<float,2>{0.583781302f, 0.0449615903f},
-std::array<float,2>{0.338877052f, 0.744460881f},
-std::array<float,2>{0.301822752f, 0.406121671f},
-std::array<float,2>{0.501404345f, 0.909047723f},
-std::array<float,2>{0.841164708f, 0.0343563817f},
-std::array<float,2>{0.224113926f, 0.741844952f},
-std::array<float,2>{0.012267842f, 0.216771334f},
-std::array<float,2>{0.963695109f, 0.606636882f},
-std::array<float,2>{0.69844085f, 0.345781863f},
-std::array<float,2>{0.405063719f, 0.77842015f},
-std::array<float,2>{0.495739967f, 0.1139872f},
-std::array<float,2>{0.635002494f, 0.685382366f},
-std::array<float,2>{0.89953196f, 0.470436633f},
-std::array<float,2>{0.0714849234f, 0.987557352f},
-std::array<float,2>{0.147467792f, 0.251535833f},
-std::array<float,2>{0.777671993f, 0.86150372f},
-std::array<float,2>{0.577431083f, 0.166096851f},
-std::array<float,2>{0.32792446f, 0.54312247f},
-std::array<float,2>{0.43312037f, 0.317709953f},
-std::array<float,2>{0.728838503f, 0.788961232f},
-std::array<float,2>{0.975387752f, 0.249341041f},
-std::array<float,2>{0.0480019972f, 0.567338407f},
-std::array<float,2>{0.20851393f, 0.0125466287f},
-std::array<float,2>{0.870413184f, 0.701792181f},
-std::array<float,2>{0.534187794f, 0.415307462f},
-std::array<float,2>{0.262283862f, 0.901403844f},
-std::array<float,2>{0.349011034f, 0.142205968f},
-std::array<float,2>{0.613868117f, 0.52048099f},
-std::array<float,2>{0.785501659f, 0.300224781f},
-std::array<float,2>{0.158652917f, 0.819352269f},
-std::array<float,2>{0.104379743f, 0.454842657f},
-std::array<float,2>{0.936300576f, 0.94785279f},
-std::array<float,2>{0.682218254f, 0.0818116069f},
-std::array<float,2>{0.443133831f, 0.640530705f},
-std::array<float,2>{0.46020472f, 0.487002492f},
-std::array<float,2>{0.658829033f, 0.978468359f},
-std::array<float,2>{0.918203354f, 0.108370207f},
-std::array<float,2>{0.116644032f, 0.665815771f},
-std::array<float,2>{0.174710259f, 0.175852343f},
-std::array<float,2>{0.799309969f, 0.549745381f},
-std::array<float,2>{0.603536725f, 0.271888524f},
-std::array<float,2>{0.362085402f, 0.850377858f},
-std::array<float,2>{0.271185011f, 0.0531158186f},
-std::array<float,2>{0.555096149f, 0.728350937f},
-std::array<float,2>{0.847219169f, 0.38836664f},
-std::array<float,2>{0.192754477f, 0.922369957f},
-std::array<float,2>{0.0331140198f, 0.362918139f},
-std::array<float,2>{0.990249872f, 0.759484947f},
-std::array<float,2>{0.748095036f, 0.197090194f},
-std::array<float,2>{0.407095939f, 0.621653318f},
-std::array<float,2>{0.341405004f, 0.294466138f},
-std::array<float,2>{0.581812322f, 0.830141425f},
-std::array<float,2>{0.762972713f, 0.126631066f},
-std::array<float,2>{0.132080346f, 0.500773966f},
-std::array<float,2>{0.0819481015f, 0.0636919513f},
-std::array<float,2>{0.880077064f, 0.645550132f},
-std::array<float,2>{0.64116776f, 0.449730784f},
-std::array<float,2>{0.48327288f, 0.954470932f},
-std::array<float,2>{0.377179414f, 0.227809399f},
-std::array<float,2>{0.711784959f, 0.58622998f},
-std::array<float,2>{0.94772011f, 0.343089312f},
-std::array<float,2>{0.0288734175f, 0.798617899f},
-std::array<float,2>{0.240608737f, 0.43710655f},
-std::array<float,2>{0.827514887f, 0.886661947f},
-std::array<float,2>{0.527484298f, 0.025732955f},
-std::array<float,2>{0.283968776f, 0.718245447f},
-std::array<float,2>{0.374629974f, 0.442966849f},
-std::array<float,2>{0.597701132f, 0.966749251f},
-std::array<float,2>{0.806590796f, 0.077353023f},
-std::array<float,2>{0.182323992f, 0.649113238f},
-std::array<float,2>{0.123815395f, 0.136735126f},
-std::array<float,2>{0.913815498f, 0.511645436f},
-std::array<float,2>{0.667206347f, 0.284672737f},
-std::array<float,2>{0.468016028f, 0.839570165f},
-std::array<float,2>{0.418507159f, 0.0200655721f},
-std::array<float,2>{0.734842479f, 0.707709193f},
-std::array<float,2>{0.997689664f, 0.423184872f},
-std::array<float,2>{0.0400893763f, 0.881242335f},
-std::array<float,2>{0.195377812f, 0.334330052f},
-std::array<float,2>{0.853393972f, 0.807203472f},
-std::array<float,2>{0.549507618f, 0.220774248f},
-std::array<float,2>{0.279556483f, 0.585476279f},
-std::array<float,2>{0.47170949f, 0.275861472f},
-std::array<float,2>{0.652170062f, 0.85476011f},
-std::array<float,2>{0.889636338f, 0.180674955f},
-std::array<float,2>{0.0877727717f, 0.560242951f},
-std::array<float,2>{0.136269689f, 0.0966178849f},
-std::array<float,2>{0.7528947f, 0.657879472f},
-std::array<float,2>{0.593465507f, 0.49270317f},
-std::array<float,2>{0.333386093f, 0.975636899f},
-std::array<float,2>{0.296707004f, 0.187902451f},
-std::array<float,2>{0.521592319f, 0.613292515f},
-std::array<float,2>{0.815487385f, 0.37288782f},
-std::array<float,2>{0.24649477f, 0.75082022f},
-std::array<float,2>{0.0210157409f, 0.379554868f},
-std::array<float,2>{0.937549531f, 0.936544478f},
-std::array<float,2>{0.703194261f, 0.0549394637f},
-std::array<float,2>{0.38345173f, 0.725875974f},
-std::array<float,2>{0.3951419f, 0.40667209f},
-std::array<float,2>{0.694937587f, 0.897526562f},
-std::array<float,2>{0.953609526f, 0.00739328656f},
-std::array<float,2>{7.13127301e-05f, 0.693183601f},
-std::array<float,2>{0.233740255f, 0.236352116f},
-std::array<float,2>{0.832096279f, 0.576241136f},
-std::array<float,2>{0.515052259f, 0.325064331f},
-std::array<float,2>{0.308980525f, 0.794587016f},
-std::array<float,2>{0.318813145f, 0.0867110342f},
-std::array<float,2>{0.563039899f, 0.62756294f},
-std::array<float,2>{0.769583941f, 0.465115756f},
-std::array<float,2>{0.150224f, 0.943955362f},
-std::array<float,2>{0.0630121529f, 0.309665859f},
-std::array<float,2>{0.892420709f, 0.825119793f},
-std::array<float,2>{0.625132143f, 0.155274361f},
-std::array<float,2>{0.49072969f, 0.531103134f},
-std::array<float,2>{0.253454953f, 0.354078084f},
-std::array<float,2>{0.545118034f, 0.770951211f},
-std::array<float,2>{0.864376009f, 0.206314325f},
-std::array<float,2>{0.216610119f, 0.596559465f},
-std::array<float,2>{0.0604881421f, 0.0400762931f},
-std::array<float,2>{0.982377291f, 0.748306155f},
-std::array<float,2>{0.724947155f, 0.396546245f},
-std::array<float,2>{0.428628206f, 0.914731681f},
-std::array<float,2>{0.445624679f, 0.156964719f},
-std::array<float,2>{0.675586939f, 0.534951568f},
-std::array<float,2>{0.924494386f, 0.259898752f},
-std::array<float,2>{0.100159898f, 0.872354269f},
-std::array<float,2>{0.168453082f, 0.481342942f},
-std::array<float,2>{0.791232884f, 0.999744177f},
-std::array<float,2>{0.621659875f, 0.118697479f},
-std::array<float,2>{0.35343352f, 0.678311527f},
-std::array<float,2>{0.289973974f, 0.458737701f},
-std::array<float,2>{0.515845001f, 0.950110018f},
-std::array<float,2>{0.820262611f, 0.0851446167f},
-std::array<float,2>{0.244683966f, 0.636717677f},
-std::array<float,2>{0.017909091f, 0.144755051f},
-std::array<float,2>{0.944275022f, 0.519165874f},
-std::array<float,2>{0.708966732f, 0.302588612f},
-std::array<float,2>{0.388317227f, 0.814683378f},
-std::array<float,2>{0.474474758f, 0.00882736314f},
-std::array<float,2>{0.655609548f, 0.697238445f},
-std::array<float,2>{0.884315193f, 0.421558529f},
-std::array<float,2>{0.0928296298f, 0.906024098f},
-std::array<float,2>{0.14049843f, 0.312612593f},
-std::array<float,2>{0.755690038f, 0.782350123f},
-std::array<float,2>{0.587536752f, 0.242499948f},
-std::array<float,2>{0.331196725f, 0.563942611f},
-std::array<float,2>{0.41438821f, 0.255150527f},
-std::array<float,2>{0.740549922f, 0.863455653f},
-std::array<float,2>{0.995209277f, 0.168320686f},
-std::array<float,2>{0.0438772216f, 0.539830267f},
-std::array<float,2>{0.202720016f, 0.112904958f},
-std::array<float,2>{0.856667876f, 0.680155754f},
-std::array<float,2>{0.553269506f, 0.47406134f},
-std::array<float,2>{0.27717787f, 0.990061641f},
-std::array<float,2>{0.369992763f, 0.214092746f},
-std::array<float,2>{0.596257746f, 0.602509558f},
-std::array<float,2>{0.810920775f, 0.349405617f},
-std::array<float,2>{0.183606625f, 0.774648607f},
-std::array<float,2>{0.120548613f, 0.401839495f},
-std::array<float,2>{0.909972072f, 0.912122846f},
-std::array<float,2>{0.670207322f, 0.0382144488f},
-std::array<float,2>{0.463025898f, 0.737436116f},
-std::array<float,2>{0.452412695f, 0.43202576f},
-std::array<float,2>{0.676504016f, 0.889725149f},
-std::array<float,2>{0.928473711f, 0.0285394583f},
-std::array<float,2>{0.0950153023f, 0.712678671f},
-std::array<float,2>{0.166485593f, 0.232478321f},
-std::array<float,2>{0.79676038f, 0.593230009f},
-std::array<float,2>{0.619318724f, 0.336353987f},
-std::array<float,2>{0.356928885f, 0.804014444f},
-std::array<float,2>{0.257697046f, 0.0665337518f},
-std::array<float,2>{0.539337158f, 0.643570483f},
-std::array<float,2>{0.860557497f, 0.44640547f},
-std::array<float,2>{0.214730561f, 0.957869589f},
-std::array<float,2>{0.0567620136f, 0.290598333f},
-std::array<float,2>{0.979627669f, 0.832742214f},
-std::array<float,2>{0.718758345f, 0.132341787f},
-std::array<float,2>{0.422929525f, 0.506888568f},
-std::array<float,2>{0.316327691f, 0.367006898f},
-std::array<float,2>{0.56876719f, 0.762699366f},
-std::array<float,2>{0.766173303f, 0.199472904f},
-std::array<float,2>{0.155954525f, 0.619492531f},
-std::array<float,2>{0.0684612095f, 0.0485959761f},
-std::array<float,2>{0.8963269f, 0.732613325f},
-std::array<float,2>{0.629395843f, 0.385982245f},
-std::array<float,2>{0.488091022f, 0.926893413f},
-std::array<float,2>{0.392862648f, 0.172781676f},
-std::array<float,2>{0.689086974f, 0.553596437f},
-std::array<float,2>{0.957240164f, 0.267101556f},
-std::array<float,2>{0.00780881476f, 0.844954967f},
-std::array<float,2>{0.229744032f, 0.489089638f},
-std::array<float,2>{0.83005929f, 0.980480194f},
-std::array<float,2>{0.511051714f, 0.105245188f},
-std::array<float,2>{0.306095719f, 0.668850183f},
-std::array<float,2>{0.344558537f, 0.377885431f},
-std::array<float,2>{0.611210287f, 0.933085442f},
-std::array<float,2>{0.783756316f, 0.0624986961f},
-std::array<float,2>{0.162717491f, 0.721470773f},
-std::array<float,2>{0.109348461f, 0.194756448f},
-std::array<float,2>{0.931878507f, 0.6111148f},
-std::array<float,2>{0.68499285f, 0.371068627f},
-std::array<float,2>{0.437589079f, 0.755528033f},
-std::array<float,2>{0.434183329f, 0.0987070948f},
-std::array<float,2>{0.733165622f, 0.663349807f},
-std::array<float,2>{0.969901323f, 0.496515274f},
-std::array<float,2>{0.0523316972f, 0.970065892f},
-std::array<float,2>{0.205067053f, 0.280411124f},
-std::array<float,2>{0.873615205f, 0.857107043f},
-std::array<float,2>{0.538480937f, 0.185001016f},
-std::array<float,2>{0.257975549f, 0.557834566f},
-std::array<float,2>{0.497706532f, 0.328160554f},
-std::array<float,2>{0.639073074f, 0.810807645f},
-std::array<float,2>{0.90451479f, 0.225185454f},
-std::array<float,2>{0.0764601305f, 0.578333318f},
-std::array<float,2>{0.143264174f, 0.0180412158f},
-std::array<float,2>{0.776798308f, 0.70395112f},
-std::array<float,2>{0.57105583f, 0.42873019f},
-std::array<float,2>{0.321650773f, 0.877285719f},
-std::array<float,2>{0.297463626f, 0.134700462f},
-std::array<float,2>{0.507035017f, 0.515606165f},
-std::array<float,2>{0.839708328f, 0.286385149f},
-std::array<float,2>{0.220325977f, 0.840560019f},
-std::array<float,2>{0.00883562118f, 0.438868731f},
-std::array<float,2>{0.966793239f, 0.961948693f},
-std::array<float,2>{0.702724159f, 0.0735148862f},
-std::array<float,2>{0.399857998f, 0.655589402f},
-std::array<float,2>{0.379083633f, 0.47944966f},
-std::array<float,2>{0.717551649f, 0.994670033f},
-std::array<float,2>{0.95031631f, 0.12254753f},
-std::array<float,2>{0.0253837667f, 0.673023939f},
-std::array<float,2>{0.236232683f, 0.160382599f},
-std::array<float,2>{0.822171748f, 0.538352907f},
-std::array<float,2>{0.525222361f, 0.262606859f},
-std::array<float,2>{0.288686097f, 0.867638528f},
-std::array<float,2>{0.336012453f, 0.0435534231f},
-std::array<float,2>{0.584171355f, 0.742494106f},
-std::array<float,2>{0.761203647f, 0.393104851f},
-std::array<float,2>{0.125695109f, 0.918597758f},
-std::array<float,2>{0.0853170678f, 0.355764538f},
-std::array<float,2>{0.876086235f, 0.767738402f},
-std::array<float,2>{0.645942569f, 0.207567453f},
-std::array<float,2>{0.478854835f, 0.600600243f},
-std::array<float,2>{0.267167419f, 0.307799399f},
-std::array<float,2>{0.561613441f, 0.823457181f},
-std::array<float,2>{0.851028442f, 0.151542291f},
-std::array<float,2>{0.188578293f, 0.527223408f},
-std::array<float,2>{0.0361553282f, 0.0899335742f},
-std::array<float,2>{0.985225499f, 0.631194293f},
-std::array<float,2>{0.742559552f, 0.463393271f},
-std::array<float,2>{0.412943184f, 0.938982546f},
-std::array<float,2>{0.455046356f, 0.239980012f},
-std::array<float,2>{0.662984252f, 0.572417498f},
-std::array<float,2>{0.917749882f, 0.324150294f},
-std::array<float,2>{0.112679973f, 0.791826487f},
-std::array<float,2>{0.178300858f, 0.411376119f},
-std::array<float,2>{0.804018915f, 0.894179761f},
-std::array<float,2>{0.605599403f, 0.00117009215f},
-std::array<float,2>{0.366184443f, 0.689144135f},
-std::array<float,2>{0.265500456f, 0.41681698f},
-std::array<float,2>{0.53152597f, 0.900022745f},
-std::array<float,2>{0.869085968f, 0.0152919488f},
-std::array<float,2>{0.209086969f, 0.70015049f},
-std::array<float,2>{0.0494711623f, 0.247046053f},
-std::array<float,2>{0.974512339f, 0.568810105f},
-std::array<float,2>{0.728110015f, 0.318426311f},
-std::array<float,2>{0.430258721f, 0.78540951f},
-std::array<float,2>{0.444823802f, 0.0782660395f},
-std::array<float,2>{0.680408537f, 0.63672632f},
-std::array<float,2>{0.935007811f, 0.455586165f},
-std::array<float,2>{0.10176298f, 0.947116733f},
-std::array<float,2>{0.157090262f, 0.297625154f},
-std::array<float,2>{0.788023353f, 0.817318141f},
-std::array<float,2>{0.615242064f, 0.142916054f},
-std::array<float,2>{0.350170255f, 0.522604406f},
-std::array<float,2>{0.402387232f, 0.345628619f},
-std::array<float,2>{0.697190702f, 0.78019464f},
-std::array<float,2>{0.962118506f, 0.217652619f},
-std::array<float,2>{0.0148603572f, 0.608042657f},
-std::array<float,2>{0.225311577f, 0.0314485729f},
-std::array<float,2>{0.842437863f, 0.739702702f},
-std::array<float,2>{0.503061235f, 0.404199809f},
-std::array<float,2>{0.303318381f, 0.90758431f},
-std::array<float,2>{0.325505793f, 0.165497348f},
-std::array<float,2>{0.574730992f, 0.54509294f},
-std::array<float,2>{0.780909002f, 0.252435505f},
-std::array<float,2>{0.144565165f, 0.860830724f},
-std::array<float,2>{0.0733553991f, 0.471563101f},
-std::array<float,2>{0.900742292f, 0.984817863f},
-std::array<float,2>{0.633775592f, 0.115419626f},
-std::array<float,2>{0.492287844f, 0.687257767f},
-std::array<float,2>{0.480977982f, 0.452934295f},
-std::array<float,2>{0.643709242f, 0.955161512f},
-std::array<float,2>{0.881963015f, 0.06613601f},
-std::array<float,2>{0.0799662545f, 0.647685051f},
-std::array<float,2>{0.12900804f, 0.127588704f},
-std::array<float,2>{0.765112996f, 0.503841877f},
-std::array<float,2>{0.578387141f, 0.295473784f},
-std::array<float,2>{0.342513233f, 0.828653216f},
-std::array<float,2>{0.282308608f, 0.02537876f},
-std::array<float,2>{0.529643655f, 0.716264665f},
-std::array<float,2>{0.825866044f, 0.433948785f},
-std::array<float,2>{0.238771409f, 0.883930862f},
-std::array<float,2>{0.0307466649f, 0.341639042f},
-std::array<float,2>{0.945445716f, 0.800023913f},
-std::array<float,2>{0.713076055f, 0.228892043f},
-std::array<float,2>{0.376452804f, 0.589323938f},
-std::array<float,2>{0.360663354f, 0.270592541f},
-std::array<float,2>{0.602911949f, 0.849436164f},
-std::array<float,2>{0.79740876f, 0.178276688f},
-std::array<float,2>{0.173735335f, 0.548189998f},
-std::array<float,2>{0.114965864f, 0.106924273f},
-std::array<float,2>{0.92006439f, 0.667793691f},
-std::array<float,2>{0.657218635f, 0.486180127f},
-std::array<float,2>{0.457668334f, 0.979616761f},
-std::array<float,2>{0.409482092f, 0.199026212f},
-std::array<float,2>{0.747004092f, 0.623971403f},
-std::array<float,2>{0.989790797f, 0.360443801f},
-std::array<float,2>{0.0332867764f, 0.760597885f},
-std::array<float,2>{0.194826916f, 0.389309645f},
-std::array<float,2>{0.844964266f, 0.924311936f},
-std::array<float,2>{0.556756496f, 0.0514736176f},
-std::array<float,2>{0.271582901f, 0.728541613f},
-std::array<float,2>{0.335112244f, 0.495452732f},
-std::array<float,2>{0.590955079f, 0.973119795f},
-std::array<float,2>{0.750338793f, 0.0948109329f},
-std::array<float,2>{0.133581057f, 0.659234166f},
-std::array<float,2>{0.0894503146f, 0.181663737f},
-std::array<float,2>{0.886768818f, 0.561377645f},
-std::array<float,2>{0.649890363f, 0.273896396f},
-std::array<float,2>{0.470618695f, 0.852225482f},
-std::array<float,2>{0.386615843f, 0.0570074581f},
-std::array<float,2>{0.706800044f, 0.723705053f},
-std::array<float,2>{0.940049589f, 0.381651968f},
-std::array<float,2>{0.0220116302f, 0.934283018f},
-std::array<float,2>{0.249817699f, 0.374506444f},
-std::array<float,2>{0.813948691f, 0.753169656f},
-std::array<float,2>{0.521157682f, 0.190584615f},
-std::array<float,2>{0.293158144f, 0.615515351f},
-std::array<float,2>{0.46491164f, 0.282724559f},
-std::array<float,2>{0.664496541f, 0.836306632f},
-std::array<float,2>{0.910400152f, 0.139720604f},
-std::array<float,2>{0.121325284f, 0.509571254f},
-std::array<float,2>{0.181259468f, 0.074956201f},
-std::array<float,2>{0.808568656f, 0.65122056f},
-std::array<float,2>{0.60050106f, 0.443761677f},
-std::array<float,2>{0.372555465f, 0.968621671f},
-std::array<float,2>{0.277428031f, 0.220077381f},
-std::array<float,2>{0.548744798f, 0.58390063f},
-std::array<float,2>{0.855384946f, 0.33247152f},
-std::array<float,2>{0.199000552f, 0.806028605f},
-std::array<float,2>{0.0414211638f, 0.424534142f},
-std::array<float,2>{0.998839676f, 0.880744338f},
-std::array<float,2>{0.737302005f, 0.0215686075f},
-std::array<float,2>{0.420303673f, 0.709003985f},
-std::array<float,2>{0.425908625f, 0.396299392f},
-std::array<float,2>{0.723856807f, 0.91654855f},
-std::array<float,2>{0.983829021f, 0.0419949479f},
-std::array<float,2>{0.0621252507f, 0.747801185f},
-std::array<float,2>{0.218051389f, 0.20449014f},
-std::array<float,2>{0.866988361f, 0.595068634f},
-std::array<float,2>{0.543227136f, 0.352935672f},
-std::array<float,2>{0.251123607f, 0.772175193f},
-std::array<float,2>{0.354900837f, 0.120057717f},
-std::array<float,2>{0.623344481f, 0.676356554f},
-std::array<float,2>{0.790990591f, 0.483369172f},
-std::array<float,2>{0.171527147f, 0.997012258f},
-std::array<float,2>{0.0981715396f, 0.257931381f},
-std::array<float,2>{0.923462927f, 0.8746472f},
-std::array<float,2>{0.673031449f, 0.158736333f},
-std::array<float,2>{0.448309392f, 0.532489419f},
-std::array<float,2>{0.311722547f, 0.327473164f},
-std::array<float,2>{0.513379633f, 0.795342624f},
-std::array<float,2>{0.83405149f, 0.235831961f},
-std::array<float,2>{0.230898857f, 0.574324965f},
-std::array<float,2>{0.00382064492f, 0.00409657601f},
-std::array<float,2>{0.95587641f, 0.694125831f},
-std::array<float,2>{0.692874849f, 0.409749299f},
-std::array<float,2>{0.397640914f, 0.89454627f},
-std::array<float,2>{0.488754928f, 0.152749181f},
-std::array<float,2>{0.626978397f, 0.528659999f},
-std::array<float,2>{0.893416822f, 0.312131643f},
-std::array<float,2>{0.0651805624f, 0.82679373f},
-std::array<float,2>{0.151309296f, 0.467491955f},
-std::array<float,2>{0.772014618f, 0.94313401f},
-std::array<float,2>{0.565002739f, 0.089311637f},
-std::array<float,2>{0.317106128f, 0.626050413f},
-std::array<float,2>{0.279527783f, 0.445303231f},
-std::array<float,2>{0.549776018f, 0.967348099f},
-std::array<float,2>{0.853101313f, 0.0761233941f},
-std::array<float,2>{0.195613325f, 0.652074933f},
-std::array<float,2>{0.0405051783f, 0.138764828f},
-std::array<float,2>{0.997831285f, 0.508174121f},
-std::array<float,2>{0.734421074f, 0.281361103f},
-std::array<float,2>{0.418782413f, 0.837477803f},
-std::array<float,2>{0.468053818f, 0.0231253318f},
-std::array<float,2>{0.667346656f, 0.710721374f},
-std::array<float,2>{0.91382736f, 0.425105691f},
-std::array<float,2>{0.123595864f, 0.879487634f},
-std::array<float,2>{0.182408467f, 0.333241314f},
-std::array<float,2>{0.80638206f, 0.805118084f},
-std::array<float,2>{0.598047674f, 0.21938695f},
-std::array<float,2>{0.374921501f, 0.582429707f},
-std::array<float,2>{0.383676857f, 0.275148332f},
-std::array<float,2>{0.703516185f, 0.852596879f},
-std::array<float,2>{0.937859297f, 0.183356017f},
-std::array<float,2>{0.0213159733f, 0.562054873f},
-std::array<float,2>{0.246195495f, 0.0944261923f},
-std::array<float,2>{0.815699935f, 0.658434868f},
-std::array<float,2>{0.521912158f, 0.494163394f},
-std::array<float,2>{0.296580046f, 0.974208832f},
-std::array<float,2>{0.333228618f, 0.190026134f},
-std::array<float,2>{0.593660057f, 0.617033899f},
-std::array<float,2>{0.752681375f, 0.373496771f},
-std::array<float,2>{0.136704504f, 0.752451599f},
-std::array<float,2>{0.0875810683f, 0.382701814f},
-std::array<float,2>{0.889182389f, 0.935086131f},
-std::array<float,2>{0.651996493f, 0.0579419658f},
-std::array<float,2>{0.471956253f, 0.723249197f},
-std::array<float,2>{0.491194665f, 0.408393919f},
-std::array<float,2>{0.62534821f, 0.895792007f},
-std::array<float,2>{0.892282844f, 0.00578313228f},
-std::array<float,2>{0.063468799f, 0.694551706f},
-std::array<float,2>{0.149967477f, 0.234423429f},
-std::array<float,2>{0.76992768f, 0.575521529f},
-std::array<float,2>{0.563349783f, 0.326838315f},
-std::array<float,2>{0.318407178f, 0.796719313f},
-std::array<float,2>{0.308783144f, 0.0883179083f},
-std::array<float,2>{0.514814138f, 0.625421941f},
-std::array<float,2>{0.832333088f, 0.46848008f},
-std::array<float,2>{0.233595178f, 0.941956997f},
-std::array<float,2>{0.000385875377f, 0.310586274f},
-std::array<float,2>{0.953151762f, 0.827545047f},
-std::array<float,2>{0.695272207f, 0.154273093f},
-std::array<float,2>{0.395368338f, 0.527567744f},
-std::array<float,2>{0.353139371f, 0.352102786f},
-std::array<float,2>{0.622041583f, 0.773013651f},
-std::array<float,2>{0.791503549f, 0.203758508f},
-std::array<float,2>{0.168085352f, 0.59376502f},
-std::array<float,2>{0.100389652f, 0.0412879921f},
-std::array<float,2>{0.924596608f, 0.746334016f},
-std::array<float,2>{0.675332248f, 0.395121217f},
-std::array<float,2>{0.44540295f, 0.917523324f},
-std::array<float,2>{0.428360462f, 0.159952044f},
-std::array<float,2>{0.724845409f, 0.531264126f},
-std::array<float,2>{0.982130945f, 0.259521514f},
-std::array<float,2>{0.06025327f, 0.873891354f},
-std::array<float,2>{0.216488987f, 0.484264642f},
-std::array<float,2>{0.864598334f, 0.997451484f},
-std::array<float,2>{0.545364976f, 0.120951124f},
-std::array<float,2>{0.253760099f, 0.677661419f},
-std::array<float,2>{0.327770799f, 0.402902901f},
-std::array<float,2>{0.57720232f, 0.90717572f},
-std::array<float,2>{0.77751416f, 0.0324706025f},
-std::array<float,2>{0.147840604f, 0.73888278f},
-std::array<float,2>{0.071628876f, 0.218560889f},
-std::array<float,2>{0.89975065f, 0.608778358f},
-std::array<float,2>{0.635229647f, 0.343916506f},
-std::array<float,2>{0.495992154f, 0.780667663f},
-std::array<float,2>{0.405027688f, 0.116338544f},
-std::array<float,2>{0.698627949f, 0.685800672f},
-std::array<float,2>{0.963560104f, 0.472423077f},
-std::array<float,2>{0.0126646282f, 0.985602081f},
-std::array<float,2>{0.223763034f, 0.253093064f},
-std::array<float,2>{0.840831101f, 0.860336363f},
-std::array<float,2>{0.501091361f, 0.164577991f},
-std::array<float,2>{0.302070498f, 0.546084702f},
-std::array<float,2>{0.442968279f, 0.319480181f},
-std::array<float,2>{0.682592034f, 0.786553979f},
-std::array<float,2>{0.936128378f, 0.247830063f},
-std::array<float,2>{0.10401883f, 0.570286393f},
-std::array<float,2>{0.158373624f, 0.0141601749f},
-std::array<float,2>{0.785189807f, 0.70041579f},
-std::array<float,2>{0.614239156f, 0.417241544f},
-std::array<float,2>{0.348870516f, 0.898828208f},
-std::array<float,2>{0.262591809f, 0.143929824f},
-std::array<float,2>{0.534497321f, 0.521537006f},
-std::array<float,2>{0.870354831f, 0.298807681f},
-std::array<float,2>{0.208901227f, 0.817665994f},
-std::array<float,2>{0.0481553487f, 0.456534505f},
-std::array<float,2>{0.975282609f, 0.946014166f},
-std::array<float,2>{0.728540897f, 0.079192102f},
-std::array<float,2>{0.433417797f, 0.63857317f},
-std::array<float,2>{0.406846881f, 0.484738618f},
-std::array<float,2>{0.748385966f, 0.979192734f},
-std::array<float,2>{0.990712821f, 0.105594449f},
-std::array<float,2>{0.0328288712f, 0.666587114f},
-std::array<float,2>{0.192602023f, 0.17875506f},
-std::array<float,2>{0.847636223f, 0.547703683f},
-std::array<float,2>{0.554862261f, 0.270136923f},
-std::array<float,2>{0.27144143f, 0.847656965f},
-std::array<float,2>{0.36189273f, 0.0525024049f},
-std::array<float,2>{0.603899598f, 0.730151355f},
-std::array<float,2>{0.799024403f, 0.389831513f},
-std::array<float,2>{0.174431741f, 0.925415516f},
-std::array<float,2>{0.116383366f, 0.360133141f},
-std::array<float,2>{0.918410659f, 0.76148814f},
-std::array<float,2>{0.659156024f, 0.197525859f},
-std::array<float,2>{0.460407495f, 0.624128699f},
-std::array<float,2>{0.283929497f, 0.296615392f},
-std::array<float,2>{0.527717054f, 0.829839289f},
-std::array<float,2>{0.827389181f, 0.128382668f},
-std::array<float,2>{0.240446851f, 0.502287865f},
-std::array<float,2>{0.0292859077f, 0.065074414f},
-std::array<float,2>{0.947509229f, 0.647399724f},
-std::array<float,2>{0.711627364f, 0.451332927f},
-std::array<float,2>{0.377402872f, 0.956527472f},
-std::array<float,2>{0.483061582f, 0.230299547f},
-std::array<float,2>{0.641443908f, 0.58864671f},
-std::array<float,2>{0.880144596f, 0.340810418f},
-std::array<float,2>{0.0816059262f, 0.79977411f},
-std::array<float,2>{0.132061109f, 0.43506816f},
-std::array<float,2>{0.762891352f, 0.883505881f},
-std::array<float,2>{0.581742585f, 0.0240578521f},
-std::array<float,2>{0.341787428f, 0.715452492f},
-std::array<float,2>{0.299242675f, 0.428417623f},
-std::array<float,2>{0.503997386f, 0.877993643f},
-std::array<float,2>{0.837720633f, 0.0189799368f},
-std::array<float,2>{0.22098425f, 0.704149246f},
-std::array<float,2>{0.0115708541f, 0.22560738f},
-std::array<float,2>{0.967202961f, 0.579487979f},
-std::array<float,2>{0.699310482f, 0.329543233f},
-std::array<float,2>{0.400402993f, 0.812459469f},
-std::array<float,2>{0.498115838f, 0.0722657815f},
-std::array<float,2>{0.637175322f, 0.654483259f},
-std::array<float,2>{0.90270555f, 0.43825236f},
-std::array<float,2>{0.0744339898f, 0.96100235f},
-std::array<float,2>{0.14174521f, 0.285283685f},
-std::array<float,2>{0.774129748f, 0.841076732f},
-std::array<float,2>{0.573687315f, 0.132999614f},
-std::array<float,2>{0.323918164f, 0.514436841f},
-std::array<float,2>{0.436577737f, 0.369900405f},
-std::array<float,2>{0.732342541f, 0.754010975f},
-std::array<float,2>{0.972444773f, 0.193945557f},
-std::array<float,2>{0.0531288721f, 0.609547436f},
-std::array<float,2>{0.206966668f, 0.0607296713f},
-std::array<float,2>{0.871488392f, 0.721697509f},
-std::array<float,2>{0.535442054f, 0.378903329f},
-std::array<float,2>{0.26156354f, 0.931970775f},
-std::array<float,2>{0.346319288f, 0.18426691f},
-std::array<float,2>{0.612538517f, 0.557404757f},
-std::array<float,2>{0.781276345f, 0.27978155f},
-std::array<float,2>{0.160191894f, 0.856424451f},
-std::array<float,2>{0.107270449f, 0.497423619f},
-std::array<float,2>{0.930147827f, 0.968985856f},
-std::array<float,2>{0.686237574f, 0.0982315615f},
-std::array<float,2>{0.44070074f, 0.662978947f},
-std::array<float,2>{0.455673456f, 0.463944465f},
-std::array<float,2>{0.660811603f, 0.938388705f},
-std::array<float,2>{0.914878964f, 0.0917221382f},
-std::array<float,2>{0.11025954f, 0.631898165f},
-std::array<float,2>{0.177470222f, 0.150429979f},
-std::array<float,2>{0.802210689f, 0.526282728f},
-std::array<float,2>{0.607810318f, 0.307431996f},
-std::array<float,2>{0.363304645f, 0.8229931f},
-std::array<float,2>{0.267644495f, 4.23609854e-05f},
-std::array<float,2>{0.559077978f, 0.688355744f},
-std::array<float,2>{0.849578559f, 0.410282314f},
-std::array<float,2>{0.189731285f, 0.89261049f},
-std::array<float,2>{0.0384381972f, 0.322817147f},
-std::array<float,2>{0.987392008f, 0.792061269f},
-std::array<float,2>{0.745055854f, 0.238865033f},
-std::array<float,2>{0.410331696f, 0.573930025f},
-std::array<float,2>{0.339239389f, 0.263638258f},
-std::array<float,2>{0.583622038f, 0.868660152f},
-std::array<float,2>{0.758716345f, 0.162022695f},
-std::array<float,2>{0.128388628f, 0.537127495f},
-std::array<float,2>{0.0824786499f, 0.121411122f},
-std::array<float,2>{0.877176404f, 0.672001719f},
-std::array<float,2>{0.64737618f, 0.480182499f},
-std::array<float,2>{0.477989703f, 0.99602443f},
-std::array<float,2>{0.382362366f, 0.208662391f},
-std::array<float,2>{0.715733469f, 0.6000489f},
-std::array<float,2>{0.951914966f, 0.356671542f},
-std::array<float,2>{0.0262247566f, 0.76871103f},
-std::array<float,2>{0.237256154f, 0.394530058f},
-std::array<float,2>{0.822629392f, 0.919052184f},
-std::array<float,2>{0.526524544f, 0.0448307618f},
-std::array<float,2>{0.285538465f, 0.743954837f},
-std::array<float,2>{0.368865877f, 0.473186076f},
-std::array<float,2>{0.59485352f, 0.989097655f},
-std::array<float,2>{0.810491025f, 0.112176962f},
-std::array<float,2>{0.186419666f, 0.680709064f},
-std::array<float,2>{0.117896929f, 0.169490084f},
-std::array<float,2>{0.906823277f, 0.540142655f},
-std::array<float,2>{0.669220686f, 0.254533112f},
-std::array<float,2>{0.462329388f, 0.864302158f},
-std::array<float,2>{0.416104585f, 0.037617255f},
-std::array<float,2>{0.740053773f, 0.736361027f},
-std::array<float,2>{0.993276477f, 0.40131548f},
-std::array<float,2>{0.0449876264f, 0.913929999f},
-std::array<float,2>{0.200276703f, 0.347919583f},
-std::array<float,2>{0.857869267f, 0.773862362f},
-std::array<float,2>{0.551567674f, 0.213397831f},
-std::array<float,2>{0.273457885f, 0.603203833f},
-std::array<float,2>{0.476229727f, 0.301533163f},
-std::array<float,2>{0.653659165f, 0.815949261f},
-std::array<float,2>{0.885445178f, 0.146043018f},
-std::array<float,2>{0.0899545997f, 0.517734826f},
-std::array<float,2>{0.138288394f, 0.0847031623f},
-std::array<float,2>{0.756049633f, 0.635658979f},
-std::array<float,2>{0.589515626f, 0.457034767f},
-std::array<float,2>{0.328175038f, 0.950549722f},
-std::array<float,2>{0.291922063f, 0.243271604f},
-std::array<float,2>{0.519194365f, 0.562857628f},
-std::array<float,2>{0.817044437f, 0.314168423f},
-std::array<float,2>{0.24400726f, 0.781934977f},
-std::array<float,2>{0.0171525832f, 0.420181006f},
-std::array<float,2>{0.941830754f, 0.904935777f},
-std::array<float,2>{0.709383309f, 0.0079138279f},
-std::array<float,2>{0.390432179f, 0.695745289f},
-std::array<float,2>{0.390978426f, 0.385554463f},
-std::array<float,2>{0.689479172f, 0.926040888f},
-std::array<float,2>{0.960459292f, 0.0469929501f},
-std::array<float,2>{0.00393106043f, 0.73428303f},
-std::array<float,2>{0.226591557f, 0.200720683f},
-std::array<float,2>{0.831243634f, 0.620818138f},
-std::array<float,2>{0.508399725f, 0.365659833f},
-std::array<float,2>{0.307576984f, 0.762539089f},
-std::array<float,2>{0.313814282f, 0.104294501f},
-std::array<float,2>{0.56823951f, 0.669763267f},
-std::array<float,2>{0.76942718f, 0.489281595f},
-std::array<float,2>{0.152371258f, 0.981577337f},
-std::array<float,2>{0.0664572492f, 0.266009629f},
-std::array<float,2>{0.897482872f, 0.844285309f},
-std::array<float,2>{0.631551504f, 0.17320165f},
-std::array<float,2>{0.48527202f, 0.554586172f},
-std::array<float,2>{0.254875928f, 0.337145358f},
-std::array<float,2>{0.542907476f, 0.803359032f},
-std::array<float,2>{0.861406446f, 0.233782396f},
-std::array<float,2>{0.211677164f, 0.591892838f},
-std::array<float,2>{0.0552187599f, 0.0281303097f},
-std::array<float,2>{0.978434086f, 0.711188614f},
-std::array<float,2>{0.720743299f, 0.432798475f},
-std::array<float,2>{0.425562799f, 0.889012814f},
-std::array<float,2>{0.450058281f, 0.131624863f},
-std::array<float,2>{0.677830696f, 0.505913019f},
-std::array<float,2>{0.926216245f, 0.289152503f},
-std::array<float,2>{0.0959154069f, 0.833336353f},
-std::array<float,2>{0.164930627f, 0.445416212f},
-std::array<float,2>{0.794471145f, 0.958613038f},
-std::array<float,2>{0.618263602f, 0.0682272017f},
-std::array<float,2>{0.358557731f, 0.642583609f},
-std::array<float,2>{0.293309689f, 0.49317351f},
-std::array<float,2>{0.521357119f, 0.975160897f},
-std::array<float,2>{0.813675225f, 0.0973063707f},
-std::array<float,2>{0.249618605f, 0.656529844f},
-std::array<float,2>{0.0223188065f, 0.18041271f},
-std::array<float,2>{0.940372705f, 0.558627605f},
-std::array<float,2>{0.706573248f, 0.276592225f},
-std::array<float,2>{0.38636747f, 0.854334354f},
-std::array<float,2>{0.470293403f, 0.0564372316f},
-std::array<float,2>{0.649604738f, 0.724821627f},
-std::array<float,2>{0.887150645f, 0.380825281f},
-std::array<float,2>{0.0896797478f, 0.935804248f},
-std::array<float,2>{0.133538648f, 0.371193737f},
-std::array<float,2>{0.750099599f, 0.751530349f},
-std::array<float,2>{0.591290116f, 0.188551232f},
-std::array<float,2>{0.335407734f, 0.615097284f},
-std::array<float,2>{0.420058548f, 0.283731312f},
-std::array<float,2>{0.736988425f, 0.838362277f},
-std::array<float,2>{0.998754859f, 0.137961492f},
-std::array<float,2>{0.0410280786f, 0.510309696f},
-std::array<float,2>{0.198837385f, 0.0762942135f},
-std::array<float,2>{0.855161667f, 0.650034249f},
-std::array<float,2>{0.548470199f, 0.441755563f},
-std::array<float,2>{0.277588964f, 0.965349376f},
-std::array<float,2>{0.372230709f, 0.222314253f},
-std::array<float,2>{0.6002478f, 0.584366858f},
-std::array<float,2>{0.808169425f, 0.335592061f},
-std::array<float,2>{0.181497395f, 0.808454514f},
-std::array<float,2>{0.121488802f, 0.422057807f},
-std::array<float,2>{0.910482347f, 0.882136166f},
-std::array<float,2>{0.664171278f, 0.0206979811f},
-std::array<float,2>{0.465231478f, 0.70896703f},
-std::array<float,2>{0.448591322f, 0.398253918f},
-std::array<float,2>{0.673135996f, 0.915450871f},
-std::array<float,2>{0.92368722f, 0.0392737202f},
-std::array<float,2>{0.0985911861f, 0.749092281f},
-std::array<float,2>{0.171789974f, 0.20561932f},
-std::array<float,2>{0.790659249f, 0.597527862f},
-std::array<float,2>{0.623138964f, 0.355319232f},
-std::array<float,2>{0.354601651f, 0.769629359f},
-std::array<float,2>{0.25129354f, 0.117631152f},
-std::array<float,2>{0.543081522f, 0.679404199f},
-std::array<float,2>{0.866906106f, 0.481917918f},
-std::array<float,2>{0.217792302f, 0.998344004f},
-std::array<float,2>{0.0623384081f, 0.261013091f},
-std::array<float,2>{0.983495951f, 0.872013569f},
-std::array<float,2>{0.723901212f, 0.157898828f},
-std::array<float,2>{0.426223636f, 0.533873856f},
-std::array<float,2>{0.317216367f, 0.326016843f},
-std::array<float,2>{0.565282345f, 0.793570578f},
-std::array<float,2>{0.772314727f, 0.238093674f},
-std::array<float,2>{0.150944546f, 0.577881336f},
-std::array<float,2>{0.0652439892f, 0.00678140763f},
-std::array<float,2>{0.89317733f, 0.691596508f},
-std::array<float,2>{0.627353489f, 0.407640159f},
-std::array<float,2>{0.488476992f, 0.897386134f},
-std::array<float,2>{0.397797376f, 0.155140251f},
-std::array<float,2>{0.693201542f, 0.52930671f},
-std::array<float,2>{0.955655277f, 0.309411973f},
-std::array<float,2>{0.0036036619f, 0.825294912f},
-std::array<float,2>{0.230529308f, 0.466657788f},
-std::array<float,2>{0.834387362f, 0.944560468f},
-std::array<float,2>{0.513472974f, 0.0869832784f},
-std::array<float,2>{0.311888427f, 0.62807703f},
-std::array<float,2>{0.350545436f, 0.415019542f},
-std::array<float,2>{0.615689039f, 0.900610566f},
-std::array<float,2>{0.78773731f, 0.0130427303f},
-std::array<float,2>{0.156884924f, 0.702332437f},
-std::array<float,2>{0.101839468f, 0.24887909f},
-std::array<float,2>{0.934681594f, 0.568293631f},
-std::array<float,2>{0.680611432f, 0.3164756f},
-std::array<float,2>{0.444438994f, 0.787273228f},
-std::array<float,2>{0.430458575f, 0.0803654715f},
-std::array<float,2>{0.72833401f, 0.639451623f},
-std::array<float,2>{0.974256694f, 0.454058707f},
-std::array<float,2>{0.0496052988f, 0.948618054f},
-std::array<float,2>{0.209417343f, 0.299270451f},
-std::array<float,2>{0.86876303f, 0.818836212f},
-std::array<float,2>{0.531280577f, 0.141123191f},
-std::array<float,2>{0.265234262f, 0.520812273f},
-std::array<float,2>{0.492645413f, 0.346782744f},
-std::array<float,2>{0.633542895f, 0.777666032f},
-std::array<float,2>{0.900526404f, 0.215792447f},
-std::array<float,2>{0.0735069513f, 0.605693042f},
-std::array<float,2>{0.145014644f, 0.0341344774f},
-std::array<float,2>{0.781209707f, 0.740774691f},
-std::array<float,2>{0.575017452f, 0.404701978f},
-std::array<float,2>{0.325369716f, 0.909328222f},
-std::array<float,2>{0.30369404f, 0.167152688f},
-std::array<float,2>{0.503180206f, 0.54437232f},
-std::array<float,2>{0.842740893f, 0.250195414f},
-std::array<float,2>{0.225523189f, 0.863174379f},
-std::array<float,2>{0.0150810191f, 0.469447792f},
-std::array<float,2>{0.962158978f, 0.986404121f},
-std::array<float,2>{0.696953833f, 0.114289381f},
-std::array<float,2>{0.402660877f, 0.683611751f},
-std::array<float,2>{0.375984669f, 0.45031625f},
-std::array<float,2>{0.713168919f, 0.954072356f},
-std::array<float,2>{0.945670903f, 0.0631041005f},
-std::array<float,2>{0.0303620305f, 0.645141184f},
-std::array<float,2>{0.239154831f, 0.125506923f},
-std::array<float,2>{0.825946629f, 0.501903772f},
-std::array<float,2>{0.529300749f, 0.293330491f},
-std::array<float,2>{0.282490134f, 0.831546307f},
-std::array<float,2>{0.342748165f, 0.0266027059f},
-std::array<float,2>{0.578181922f, 0.71687603f},
-std::array<float,2>{0.764710963f, 0.436031848f},
-std::array<float,2>{0.129178122f, 0.885454655f},
-std::array<float,2>{0.0796967f, 0.342101961f},
-std::array<float,2>{0.882307947f, 0.797159016f},
-std::array<float,2>{0.643848002f, 0.226718038f},
-std::array<float,2>{0.481423229f, 0.587392032f},
-std::array<float,2>{0.271870375f, 0.273055375f},
-std::array<float,2>{0.557104409f, 0.851549268f},
-std::array<float,2>{0.845154166f, 0.177647382f},
-std::array<float,2>{0.19511272f, 0.550189674f},
-std::array<float,2>{0.0334944017f, 0.108962744f},
-std::array<float,2>{0.990038872f, 0.664467335f},
-std::array<float,2>{0.746768892f, 0.487689346f},
-std::array<float,2>{0.409217983f, 0.976710618f},
-std::array<float,2>{0.457945734f, 0.196258605f},
-std::array<float,2>{0.656951606f, 0.622387171f},
-std::array<float,2>{0.920205414f, 0.362140387f},
-std::array<float,2>{0.114999443f, 0.758582473f},
-std::array<float,2>{0.173446164f, 0.387064487f},
-std::array<float,2>{0.797631264f, 0.923227489f},
-std::array<float,2>{0.602636933f, 0.0545882955f},
-std::array<float,2>{0.360559881f, 0.727378845f},
-std::array<float,2>{0.258106142f, 0.376073688f},
-std::array<float,2>{0.538140535f, 0.93030709f},
-std::array<float,2>{0.873926818f, 0.0604184121f},
-std::array<float,2>{0.204751506f, 0.720102072f},
-std::array<float,2>{0.0526024699f, 0.192515925f},
-std::array<float,2>{0.969973505f, 0.611439824f},
-std::array<float,2>{0.733004451f, 0.3690404f},
-std::array<float,2>{0.434474617f, 0.757134855f},
-std::array<float,2>{0.437985301f, 0.101238891f},
-std::array<float,2>{0.684735596f, 0.661924362f},
-std::array<float,2>{0.931993961f, 0.49869749f},
-std::array<float,2>{0.109111026f, 0.971313536f},
-std::array<float,2>{0.163078859f, 0.278875768f},
-std::array<float,2>{0.78414917f, 0.857873857f},
-std::array<float,2>{0.61089325f, 0.18641226f},
-std::array<float,2>{0.34446907f, 0.555090427f},
-std::array<float,2>{0.399647057f, 0.331061155f},
-std::array<float,2>{0.70300734f, 0.80871737f},
-std::array<float,2>{0.966378331f, 0.223070964f},
-std::array<float,2>{0.00910462439f, 0.580659032f},
-std::array<float,2>{0.220701441f, 0.0167670436f},
-std::array<float,2>{0.839505076f, 0.706389189f},
-std::array<float,2>{0.507312179f, 0.427490264f},
-std::array<float,2>{0.297617346f, 0.87608099f},
-std::array<float,2>{0.321408033f, 0.135454401f},
-std::array<float,2>{0.570870817f, 0.512660801f},
-std::array<float,2>{0.776368737f, 0.287921816f},
-std::array<float,2>{0.143335804f, 0.84302789f},
-std::array<float,2>{0.0761946142f, 0.43967396f},
-std::array<float,2>{0.904588163f, 0.964319766f},
-std::array<float,2>{0.638686597f, 0.0706829131f},
-std::array<float,2>{0.49791795f, 0.653031647f},
-std::array<float,2>{0.478612572f, 0.477637142f},
-std::array<float,2>{0.645563662f, 0.992248654f},
-std::array<float,2>{0.876276135f, 0.124489009f},
-std::array<float,2>{0.0851867571f, 0.674875021f},
-std::array<float,2>{0.125804245f, 0.162393048f},
-std::array<float,2>{0.760843813f, 0.535550535f},
-std::array<float,2>{0.584445179f, 0.263771385f},
-std::array<float,2>{0.336347431f, 0.869545758f},
-std::array<float,2>{0.288879156f, 0.046392329f},
-std::array<float,2>{0.525143266f, 0.74517113f},
-std::array<float,2>{0.821943343f, 0.392010719f},
-std::array<float,2>{0.235922337f, 0.920194626f},
-std::array<float,2>{0.025079608f, 0.358118594f},
-std::array<float,2>{0.95062995f, 0.766645551f},
-std::array<float,2>{0.717413604f, 0.208997935f},
-std::array<float,2>{0.379182458f, 0.598290026f},
-std::array<float,2>{0.36588788f, 0.306064218f},
-std::array<float,2>{0.605735362f, 0.821093678f},
-std::array<float,2>{0.803740978f, 0.149601534f},
-std::array<float,2>{0.178502887f, 0.524120927f},
-std::array<float,2>{0.112441435f, 0.0932024196f},
-std::array<float,2>{0.917525709f, 0.630432248f},
-std::array<float,2>{0.662810564f, 0.461573422f},
-std::array<float,2>{0.454710633f, 0.940454662f},
-std::array<float,2>{0.412797153f, 0.240662098f},
-std::array<float,2>{0.742263615f, 0.57188338f},
-std::array<float,2>{0.984942853f, 0.320720047f},
-std::array<float,2>{0.0365946703f, 0.789365768f},
-std::array<float,2>{0.188895151f, 0.412474751f},
-std::array<float,2>{0.850769758f, 0.891494989f},
-std::array<float,2>{0.561983526f, 0.00263504242f},
-std::array<float,2>{0.267362177f, 0.691295803f},
-std::array<float,2>{0.331512898f, 0.459763348f},
-std::array<float,2>{0.587768674f, 0.951377928f},
-std::array<float,2>{0.755405486f, 0.0821426734f},
-std::array<float,2>{0.140263408f, 0.633704424f},
-std::array<float,2>{0.0932569802f, 0.146626696f},
-std::array<float,2>{0.884710371f, 0.517445743f},
-std::array<float,2>{0.655326843f, 0.302853554f},
-std::array<float,2>{0.474129021f, 0.813123882f},
-std::array<float,2>{0.388529152f, 0.010546159f},
-std::array<float,2>{0.708698332f, 0.697504759f},
-std::array<float,2>{0.94389981f, 0.419253916f},
-std::array<float,2>{0.017812077f, 0.903449714f},
-std::array<float,2>{0.245072857f, 0.315176517f},
-std::array<float,2>{0.820013821f, 0.784936249f},
-std::array<float,2>{0.515900433f, 0.245394915f},
-std::array<float,2>{0.289637089f, 0.56478858f},
-std::array<float,2>{0.463279605f, 0.256161809f},
-std::array<float,2>{0.670039713f, 0.866585076f},
-std::array<float,2>{0.909905612f, 0.171308666f},
-std::array<float,2>{0.120276116f, 0.542313218f},
-std::array<float,2>{0.183928728f, 0.110841095f},
-std::array<float,2>{0.810790896f, 0.683422983f},
-std::array<float,2>{0.596606851f, 0.475898594f},
-std::array<float,2>{0.369767994f, 0.991658688f},
-std::array<float,2>{0.277080208f, 0.212069616f},
-std::array<float,2>{0.553603351f, 0.604284227f},
-std::array<float,2>{0.856840193f, 0.351125419f},
-std::array<float,2>{0.203052774f, 0.77705586f},
-std::array<float,2>{0.0436579399f, 0.399073273f},
-std::array<float,2>{0.995458663f, 0.912095547f},
-std::array<float,2>{0.740300179f, 0.0353177749f},
-std::array<float,2>{0.414243728f, 0.734507918f},
-std::array<float,2>{0.423175186f, 0.430591136f},
-std::array<float,2>{0.71919471f, 0.886765659f},
-std::array<float,2>{0.979823232f, 0.0302505102f},
-std::array<float,2>{0.0569081903f, 0.713226259f},
-std::array<float,2>{0.214385509f, 0.231185913f},
-std::array<float,2>{0.8607651f, 0.591493547f},
-std::array<float,2>{0.539069772f, 0.33909595f},
-std::array<float,2>{0.257499307f, 0.802043378f},
-std::array<float,2>{0.356525362f, 0.0698292404f},
-std::array<float,2>{0.619476676f, 0.642003119f},
-std::array<float,2>{0.796389699f, 0.447778255f},
-std::array<float,2>{0.166216895f, 0.959227562f},
-std::array<float,2>{0.0948599428f, 0.292295158f},
-std::array<float,2>{0.928430676f, 0.835711241f},
-std::array<float,2>{0.676680088f, 0.129723996f},
-std::array<float,2>{0.452318192f, 0.504366517f},
-std::array<float,2>{0.305821776f, 0.363514811f},
-std::array<float,2>{0.510812759f, 0.763770103f},
-std::array<float,2>{0.829738617f, 0.202947736f},
-std::array<float,2>{0.229691297f, 0.617652893f},
-std::array<float,2>{0.00737838354f, 0.0492561162f},
-std::array<float,2>{0.95744288f, 0.73150146f},
-std::array<float,2>{0.6894117f, 0.384744138f},
-std::array<float,2>{0.392777383f, 0.929559588f},
-std::array<float,2>{0.487900287f, 0.174011752f},
-std::array<float,2>{0.629681468f, 0.551424921f},
-std::array<float,2>{0.896150053f, 0.269247174f},
-std::array<float,2>{0.0687212124f, 0.847528696f},
-std::array<float,2>{0.156061321f, 0.491390586f},
-std::array<float,2>{0.766528189f, 0.983673513f},
-std::array<float,2>{0.568496644f, 0.102123f},
-std::array<float,2>{0.315961152f, 0.670711815f},
-std::array<float,2>{0.25287798f, 0.480716556f},
-std::array<float,2>{0.546250641f, 0.999287188f},
-std::array<float,2>{0.863898158f, 0.11851044f},
-std::array<float,2>{0.215285942f, 0.677804351f},
-std::array<float,2>{0.058612898f, 0.156662062f},
-std::array<float,2>{0.980669916f, 0.534329414f},
-std::array<float,2>{0.72560066f, 0.260540187f},
-std::array<float,2>{0.429347873f, 0.872877538f},
-std::array<float,2>{0.446621597f, 0.0406780019f},
-std::array<float,2>{0.674282432f, 0.748537362f},
-std::array<float,2>{0.925562859f, 0.397333592f},
-std::array<float,2>{0.100718439f, 0.914496481f},
-std::array<float,2>{0.169723988f, 0.353625149f},
-std::array<float,2>{0.792178154f, 0.771484137f},
-std::array<float,2>{0.622306287f, 0.206877515f},
-std::array<float,2>{0.352536827f, 0.596003294f},
-std::array<float,2>{0.396388561f, 0.310247838f},
-std::array<float,2>{0.693438768f, 0.824496567f},
-std::array<float,2>{0.954438508f, 0.155762658f},
-std::array<float,2>{0.00152941723f, 0.530290067f},
-std::array<float,2>{0.232651889f, 0.0861158893f},
-std::array<float,2>{0.833670497f, 0.626993954f},
-std::array<float,2>{0.514375687f, 0.465554535f},
-std::array<float,2>{0.310414344f, 0.943396032f},
-std::array<float,2>{0.319731772f, 0.237184465f},
-std::array<float,2>{0.563767076f, 0.577081144f},
-std::array<float,2>{0.770811796f, 0.32451123f},
-std::array<float,2>{0.149011537f, 0.794098854f},
-std::array<float,2>{0.0637846962f, 0.406864315f},
-std::array<float,2>{0.89145261f, 0.898362696f},
-std::array<float,2>{0.626601577f, 0.00693591218f},
-std::array<float,2>{0.491918296f, 0.69281286f},
-std::array<float,2>{0.471619368f, 0.37890628f},
-std::array<float,2>{0.651047587f, 0.93722111f},
-std::array<float,2>{0.889684618f, 0.0554657914f},
-std::array<float,2>{0.0864586085f, 0.726549268f},
-std::array<float,2>{0.134814113f, 0.188411787f},
-std::array<float,2>{0.753158808f, 0.613815606f},
-std::array<float,2>{0.59270221f, 0.372274309f},
-std::array<float,2>{0.332774878f, 0.750145674f},
-std::array<float,2>{0.295628905f, 0.0959345177f},
-std::array<float,2>{0.523326635f, 0.657662928f},
-std::array<float,2>{0.815022469f, 0.49260819f},
-std::array<float,2>{0.247673258f, 0.976323128f},
-std::array<float,2>{0.0196573772f, 0.276019812f},
-std::array<float,2>{0.93940556f, 0.855074406f},
-std::array<float,2>{0.704788446f, 0.181309313f},
-std::array<float,2>{0.384513766f, 0.559575498f},
-std::array<float,2>{0.373071998f, 0.33472991f},
-std::array<float,2>{0.599424124f, 0.806876898f},
-std::array<float,2>{0.805178642f, 0.221568495f},
-std::array<float,2>{0.18358317f, 0.585261881f},
-std::array<float,2>{0.12429326f, 0.0199626982f},
-std::array<float,2>{0.912801683f, 0.707473278f},
-std::array<float,2>{0.666390479f, 0.423567414f},
-std::array<float,2>{0.467619091f, 0.881584525f},
-std::array<float,2>{0.418961197f, 0.137348413f},
-std::array<float,2>{0.73550415f, 0.511092603f},
-std::array<float,2>{0.996616662f, 0.284255207f},
-std::array<float,2>{0.0394454077f, 0.839163482f},
-std::array<float,2>{0.196634173f, 0.44253099f},
-std::array<float,2>{0.852367759f, 0.965934098f},
-std::array<float,2>{0.5503757f, 0.0777655914f},
-std::array<float,2>{0.280555338f, 0.648521721f},
-std::array<float,2>{0.339867324f, 0.436691314f},
-std::array<float,2>{0.580681384f, 0.885976374f},
-std::array<float,2>{0.762383342f, 0.0259292256f},
-std::array<float,2>{0.131053165f, 0.718491614f},
-std::array<float,2>{0.0809841231f, 0.228481576f},
-std::array<float,2>{0.879301012f, 0.586839736f},
-std::array<float,2>{0.641684115f, 0.343747348f},
-std::array<float,2>{0.484111279f, 0.798086941f},
-std::array<float,2>{0.378903568f, 0.0643149763f},
-std::array<float,2>{0.712830007f, 0.646254003f},
-std::array<float,2>{0.948660076f, 0.449558228f},
-std::array<float,2>{0.0274565611f, 0.954995632f},
-std::array<float,2>{0.241407946f, 0.294168115f},
-std::array<float,2>{0.826667428f, 0.831027389f},
-std::array<float,2>{0.529110491f, 0.12607716f},
-std::array<float,2>{0.284317791f, 0.50016427f},
-std::array<float,2>{0.459400803f, 0.362502635f},
-std::array<float,2>{0.660145462f, 0.759134591f},
-std::array<float,2>{0.919761181f, 0.196408957f},
-std::array<float,2>{0.115282319f, 0.621317208f},
-std::array<float,2>{0.175250635f, 0.0534551367f},
-std::array<float,2>{0.800399423f, 0.72765559f},
-std::array<float,2>{0.604775608f, 0.388099015f},
-std::array<float,2>{0.362729728f, 0.922045469f},
-std::array<float,2>{0.270025492f, 0.176395908f},
-std::array<float,2>{0.55614984f, 0.548985004f},
-std::array<float,2>{0.846358538f, 0.27216962f},
-std::array<float,2>{0.192087993f, 0.849930644f},
-std::array<float,2>{0.0319011137f, 0.486519873f},
-std::array<float,2>{0.991385996f, 0.977968395f},
-std::array<float,2>{0.749177754f, 0.107777685f},
-std::array<float,2>{0.407711327f, 0.665410459f},
-std::array<float,2>{0.43260771f, 0.45415622f},
-std::array<float,2>{0.72950387f, 0.947455943f},
-std::array<float,2>{0.975858688f, 0.0812211186f},
-std::array<float,2>{0.0474677235f, 0.640115261f},
-std::array<float,2>{0.207237512f, 0.142081559f},
-std::array<float,2>{0.869967818f, 0.519996643f},
-std::array<float,2>{0.533436894f, 0.300419539f},
-std::array<float,2>{0.263400316f, 0.819929779f},
-std::array<float,2>{0.34853211f, 0.0119356783f},
-std::array<float,2>{0.614987731f, 0.70147562f},
-std::array<float,2>{0.787006855f, 0.41575101f},
-std::array<float,2>{0.159207761f, 0.902154148f},
-std::array<float,2>{0.105010927f, 0.317995131f},
-std::array<float,2>{0.93748343f, 0.788446069f},
-std::array<float,2>{0.682943583f, 0.249853387f},
-std::array<float,2>{0.441808283f, 0.566843629f},
-std::array<float,2>{0.300967038f, 0.251361638f},
-std::array<float,2>{0.500218809f, 0.862261832f},
-std::array<float,2>{0.840800583f, 0.166955933f},
-std::array<float,2>{0.222723573f, 0.543766737f},
-std::array<float,2>{0.0134600382f, 0.113640845f},
-std::array<float,2>{0.964743614f, 0.684909701f},
-std::array<float,2>{0.697914839f, 0.47003904f},
-std::array<float,2>{0.405555338f, 0.988100886f},
-std::array<float,2>{0.494291306f, 0.216205776f},
-std::array<float,2>{0.635882676f, 0.607316554f},
-std::array<float,2>{0.899397194f, 0.346446335f},
-std::array<float,2>{0.0704585686f, 0.779225707f},
-std::array<float,2>{0.146998227f, 0.405355245f},
-std::array<float,2>{0.778417289f, 0.908275783f},
-std::array<float,2>{0.576887906f, 0.0349237137f},
-std::array<float,2>{0.326989651f, 0.74137789f},
-std::array<float,2>{0.286606789f, 0.390866727f},
-std::array<float,2>{0.525857985f, 0.921512723f},
-std::array<float,2>{0.823465466f, 0.0456326976f},
-std::array<float,2>{0.237492949f, 0.744881332f},
-std::array<float,2>{0.0265019331f, 0.210655108f},
-std::array<float,2>{0.952517152f, 0.599407375f},
-std::array<float,2>{0.716365159f, 0.359296978f},
-std::array<float,2>{0.381475747f, 0.766490579f},
-std::array<float,2>{0.477421731f, 0.123904496f},
-std::array<float,2>{0.648259699f, 0.674224913f},
-std::array<float,2>{0.878430545f, 0.476580173f},
-std::array<float,2>{0.0839412659f, 0.993565798f},
-std::array<float,2>{0.127235591f, 0.264728993f},
-std::array<float,2>{0.758974791f, 0.870925605f},
-std::array<float,2>{0.582039237f, 0.163721547f},
-std::array<float,2>{0.338159889f, 0.536840558f},
-std::array<float,2>{0.411513776f, 0.321407318f},
-std::array<float,2>{0.745347559f, 0.790754974f},
-std::array<float,2>{0.986746728f, 0.241863459f},
-std::array<float,2>{0.037626721f, 0.570493639f},
-std::array<float,2>{0.191098705f, 0.00317208772f},
-std::array<float,2>{0.848464847f, 0.689866662f},
-std::array<float,2>{0.560354233f, 0.413276136f},
-std::array<float,2>{0.268785954f, 0.89181f},
-std::array<float,2>{0.364854991f, 0.149203494f},
-std::array<float,2>{0.608965099f, 0.525282919f},
-std::array<float,2>{0.801141024f, 0.305172056f},
-std::array<float,2>{0.176646695f, 0.821352303f},
-std::array<float,2>{0.110925429f, 0.462116182f},
-std::array<float,2>{0.915406823f, 0.939795613f},
-std::array<float,2>{0.661909819f, 0.0919151679f},
-std::array<float,2>{0.456202149f, 0.629653871f},
-std::array<float,2>{0.440007269f, 0.499497056f},
-std::array<float,2>{0.687461913f, 0.972368002f},
-std::array<float,2>{0.930988312f, 0.0996619165f},
-std::array<float,2>{0.10585779f, 0.660751581f},
-std::array<float,2>{0.161378711f, 0.187146127f},
-std::array<float,2>{0.783106089f, 0.556411147f},
-std::array<float,2>{0.61174655f, 0.278154522f},
-std::array<float,2>{0.346869618f, 0.858649015f},
-std::array<float,2>{0.260256886f, 0.0591993183f},
-std::array<float,2>{0.537075937f, 0.718968987f},
-std::array<float,2>{0.872234464f, 0.375906914f},
-std::array<float,2>{0.205324426f, 0.930905163f},
-std::array<float,2>{0.054309722f, 0.367349118f},
-std::array<float,2>{0.970755816f, 0.756641567f},
-std::array<float,2>{0.730703056f, 0.192274809f},
-std::array<float,2>{0.435658872f, 0.61235857f},
-std::array<float,2>{0.323223352f, 0.288829565f},
-std::array<float,2>{0.572909474f, 0.842687726f},
-std::array<float,2>{0.77528429f, 0.136214048f},
-std::array<float,2>{0.141461104f, 0.512991726f},
-std::array<float,2>{0.0755953193f, 0.0716195256f},
-std::array<float,2>{0.904030144f, 0.653415799f},
-std::array<float,2>{0.638451755f, 0.440948039f},
-std::array<float,2>{0.499309242f, 0.962963879f},
-std::array<float,2>{0.402095526f, 0.223961487f},
-std::array<float,2>{0.701003015f, 0.581434727f},
-std::array<float,2>{0.968443871f, 0.330923289f},
-std::array<float,2>{0.00999500696f, 0.810525239f},
-std::array<float,2>{0.222077161f, 0.42624703f},
-std::array<float,2>{0.836786926f, 0.875696361f},
-std::array<float,2>{0.505449533f, 0.0162749961f},
-std::array<float,2>{0.300568014f, 0.705459952f},
-std::array<float,2>{0.357876629f, 0.448308855f},
-std::array<float,2>{0.617491305f, 0.960103989f},
-std::array<float,2>{0.793694139f, 0.0690113232f},
-std::array<float,2>{0.165775716f, 0.640964806f},
-std::array<float,2>{0.0974971578f, 0.130777135f},
-std::array<float,2>{0.92682296f, 0.505803108f},
-std::array<float,2>{0.678828061f, 0.291336745f},
-std::array<float,2>{0.45115301f, 0.834951341f},
-std::array<float,2>{0.424161077f, 0.0309705455f},
-std::array<float,2>{0.722417116f, 0.714107931f},
-std::array<float,2>{0.976959169f, 0.431548476f},
-std::array<float,2>{0.05656204f, 0.887869298f},
-std::array<float,2>{0.21235697f, 0.338403374f},
-std::array<float,2>{0.862673163f, 0.801417291f},
-std::array<float,2>{0.541724861f, 0.231504992f},
-std::array<float,2>{0.255058914f, 0.590215325f},
-std::array<float,2>{0.4857364f, 0.268502533f},
-std::array<float,2>{0.632460475f, 0.845899045f},
-std::array<float,2>{0.897146285f, 0.175311252f},
-std::array<float,2>{0.0677135661f, 0.552571833f},
-std::array<float,2>{0.153446987f, 0.10300602f},
-std::array<float,2>{0.767867804f, 0.671192467f},
-std::array<float,2>{0.56641376f, 0.490858316f},
-std::array<float,2>{0.313067138f, 0.982569993f},
-std::array<float,2>{0.30780381f, 0.201635942f},
-std::array<float,2>{0.509411454f, 0.618303299f},
-std::array<float,2>{0.830628037f, 0.36464721f},
-std::array<float,2>{0.228383631f, 0.764973462f},
-std::array<float,2>{0.00546583813f, 0.382878929f},
-std::array<float,2>{0.959504545f, 0.927992821f},
-std::array<float,2>{0.691386402f, 0.0501159802f},
-std::array<float,2>{0.392136365f, 0.730663121f},
-std::array<float,2>{0.388796449f, 0.418900132f},
-std::array<float,2>{0.710360467f, 0.902903974f},
-std::array<float,2>{0.943016589f, 0.0116969896f},
-std::array<float,2>{0.0158174094f, 0.698884666f},
-std::array<float,2>{0.24284482f, 0.244387716f},
-std::array<float,2>{0.817768872f, 0.565842032f},
-std::array<float,2>{0.517658055f, 0.315499187f},
-std::array<float,2>{0.292088687f, 0.783631861f},
-std::array<float,2>{0.329844087f, 0.0835686475f},
-std::array<float,2>{0.588847339f, 0.634412348f},
-std::array<float,2>{0.757290959f, 0.460915029f},
-std::array<float,2>{0.137502596f, 0.953112006f},
-std::array<float,2>{0.0910973623f, 0.304472744f},
-std::array<float,2>{0.885950923f, 0.813749433f},
-std::array<float,2>{0.652470231f, 0.147826061f},
-std::array<float,2>{0.474963337f, 0.515813947f},
-std::array<float,2>{0.275297016f, 0.350572914f},
-std::array<float,2>{0.552005172f, 0.776079953f},
-std::array<float,2>{0.859162092f, 0.21118708f},
-std::array<float,2>{0.20005998f, 0.605425537f},
-std::array<float,2>{0.0466994755f, 0.0366914533f},
-std::array<float,2>{0.993065298f, 0.736018538f},
-std::array<float,2>{0.739094436f, 0.400363863f},
-std::array<float,2>{0.417425156f, 0.910933316f},
-std::array<float,2>{0.461329162f, 0.170383275f},
-std::array<float,2>{0.668079436f, 0.541272402f},
-std::array<float,2>{0.907691956f, 0.257412225f},
-std::array<float,2>{0.118703507f, 0.865285993f},
-std::array<float,2>{0.187361985f, 0.474855125f},
-std::array<float,2>{0.808990777f, 0.991025269f},
-std::array<float,2>{0.59381187f, 0.109831773f},
-std::array<float,2>{0.367733061f, 0.682148039f},
-std::array<float,2>{0.31142056f, 0.466924787f},
-std::array<float,2>{0.511986136f, 0.942709684f},
-std::array<float,2>{0.835500419f, 0.0896356478f},
-std::array<float,2>{0.232006952f, 0.626755536f},
-std::array<float,2>{0.00263890182f, 0.153314263f},
-std::array<float,2>{0.956760406f, 0.529241383f},
-std::array<float,2>{0.691594601f, 0.311909407f},
-std::array<float,2>{0.396937937f, 0.826527297f},
-std::array<float,2>{0.489380419f, 0.0047053704f},
-std::array<float,2>{0.628741503f, 0.693645239f},
-std::array<float,2>{0.894235194f, 0.409639835f},
-std::array<float,2>{0.06622722f, 0.895475686f},
-std::array<float,2>{0.151703924f, 0.327836394f},
-std::array<float,2>{0.772975981f, 0.795693755f},
-std::array<float,2>{0.56621933f, 0.235931575f},
-std::array<float,2>{0.318012238f, 0.574890971f},
-std::array<float,2>{0.4272044f, 0.258494824f},
-std::array<float,2>{0.722671747f, 0.874494553f},
-std::array<float,2>{0.983312249f, 0.158443063f},
-std::array<float,2>{0.0611335039f, 0.533193648f},
-std::array<float,2>{0.217123106f, 0.119585335f},
-std::array<float,2>{0.86533457f, 0.675851166f},
-std::array<float,2>{0.544070125f, 0.482433945f},
-std::array<float,2>{0.250914991f, 0.996464312f},
-std::array<float,2>{0.354463696f, 0.204746321f},
-std::array<float,2>{0.624955237f, 0.595282137f},
-std::array<float,2>{0.789504468f, 0.353340507f},
-std::array<float,2>{0.170482963f, 0.77168107f},
-std::array<float,2>{0.0992467925f, 0.395610243f},
-std::array<float,2>{0.922683537f, 0.916217566f},
-std::array<float,2>{0.672052264f, 0.0428276211f},
-std::array<float,2>{0.447442979f, 0.747173071f},
-std::array<float,2>{0.46661073f, 0.423852891f},
-std::array<float,2>{0.665861547f, 0.880074084f},
-std::array<float,2>{0.911700308f, 0.0223501064f},
-std::array<float,2>{0.122453444f, 0.709661245f},
-std::array<float,2>{0.180070996f, 0.220547289f},
-std::array<float,2>{0.807359755f, 0.583272576f},
-std::array<float,2>{0.600898206f, 0.332917452f},
-std::array<float,2>{0.371442705f, 0.80622077f},
-std::array<float,2>{0.278472364f, 0.0744437501f},
-std::array<float,2>{0.547120452f, 0.650641501f},
-std::array<float,2>{0.853862524f, 0.444261432f},
-std::array<float,2>{0.197456136f, 0.968052983f},
-std::array<float,2>{0.0424080566f, 0.282261252f},
-std::array<float,2>{0.999950945f, 0.836660862f},
-std::array<float,2>{0.737519562f, 0.140398294f},
-std::array<float,2>{0.421600431f, 0.509108484f},
-std::array<float,2>{0.334823519f, 0.374780834f},
-std::array<float,2>{0.590145111f, 0.753559053f},
-std::array<float,2>{0.751643002f, 0.190964848f},
-std::array<float,2>{0.134441793f, 0.615766823f},
-std::array<float,2>{0.0882225409f, 0.0575763211f},
-std::array<float,2>{0.888198256f, 0.724192083f},
-std::array<float,2>{0.648820937f, 0.38107869f},
-std::array<float,2>{0.469096333f, 0.934009314f},
-std::array<float,2>{0.385302454f, 0.182504237f},
-std::array<float,2>{0.705328345f, 0.560690343f},
-std::array<float,2>{0.941318631f, 0.274323165f},
-std::array<float,2>{0.023014525f, 0.851619601f},
-std::array<float,2>{0.248398393f, 0.495931059f},
-std::array<float,2>{0.812666535f, 0.973371327f},
-std::array<float,2>{0.520161152f, 0.0955150574f},
-std::array<float,2>{0.294374347f, 0.660116494f},
-std::array<float,2>{0.359587282f, 0.388946801f},
-std::array<float,2>{0.601954997f, 0.924437702f},
-std::array<float,2>{0.798657f, 0.0511248931f},
-std::array<float,2>{0.171912298f, 0.729346216f},
-std::array<float,2>{0.113357916f, 0.198512211f},
-std::array<float,2>{0.921424389f, 0.62321651f},
-std::array<float,2>{0.657832444f, 0.361271888f},
-std::array<float,2>{0.458029985f, 0.760147333f},
-std::array<float,2>{0.40904659f, 0.106971785f},
-std::array<float,2>{0.747670233f, 0.667383611f},
-std::array<float,2>{0.988708019f, 0.485543847f},
-std::array<float,2>{0.0351445787f, 0.980187893f},
-std::array<float,2>{0.194130763f, 0.271429032f},
-std::array<float,2>{0.844521403f, 0.848957956f},
-std::array<float,2>{0.55820173f, 0.177989826f},
-std::array<float,2>{0.272487521f, 0.5483495f},
-std::array<float,2>{0.48169446f, 0.340865791f},
-std::array<float,2>{0.642615616f, 0.800348461f},
-std::array<float,2>{0.881345451f, 0.22913149f},
-std::array<float,2>{0.0786502212f, 0.589531243f},
-std::array<float,2>{0.130004287f, 0.0245103855f},
-std::array<float,2>{0.764152944f, 0.716332436f},
-std::array<float,2>{0.579134941f, 0.434359342f},
-std::array<float,2>{0.343229085f, 0.884624779f},
-std::array<float,2>{0.281596571f, 0.127354532f},
-std::array<float,2>{0.530703723f, 0.50340426f},
-std::array<float,2>{0.825175703f, 0.295118064f},
-std::array<float,2>{0.239473984f, 0.828491569f},
-std::array<float,2>{0.0297212023f, 0.452391505f},
-std::array<float,2>{0.946796715f, 0.955640316f},
-std::array<float,2>{0.714216828f, 0.065856874f},
-std::array<float,2>{0.375699431f, 0.648270249f},
-std::array<float,2>{0.403811365f, 0.471049011f},
-std::array<float,2>{0.695820093f, 0.984957337f},
-std::array<float,2>{0.961480081f, 0.116098456f},
-std::array<float,2>{0.0140415505f, 0.68680203f},
-std::array<float,2>{0.226522148f, 0.165987849f},
-std::array<float,2>{0.843733311f, 0.545746744f},
-std::array<float,2>{0.502254665f, 0.252503514f},
-std::array<float,2>{0.304110676f, 0.861092806f},
-std::array<float,2>{0.324508131f, 0.031927269f},
-std::array<float,2>{0.575934589f, 0.73991549f},
-std::array<float,2>{0.780236542f, 0.403392762f},
-std::array<float,2>{0.145764768f, 0.908115625f},
-std::array<float,2>{0.0724520907f, 0.344900757f},
-std::array<float,2>{0.901773155f, 0.779685557f},
-std::array<float,2>{0.634372652f, 0.216898113f},
-std::array<float,2>{0.493195653f, 0.607719898f},
-std::array<float,2>{0.264089942f, 0.297125906f},
-std::array<float,2>{0.532614172f, 0.816490114f},
-std::array<float,2>{0.8677423f, 0.143317729f},
-std::array<float,2>{0.210778058f, 0.523048103f},
-std::array<float,2>{0.0504792519f, 0.0789235607f},
-std::array<float,2>{0.972721875f, 0.637493134f},
-std::array<float,2>{0.727267325f, 0.455140799f},
-std::array<float,2>{0.431535155f, 0.946574867f},
-std::array<float,2>{0.444028944f, 0.246179909f},
-std::array<float,2>{0.681098998f, 0.568853498f},
-std::array<float,2>{0.933771551f, 0.31911701f},
-std::array<float,2>{0.103439763f, 0.786106408f},
-std::array<float,2>{0.157315224f, 0.416123748f},
-std::array<float,2>{0.788154006f, 0.899842739f},
-std::array<float,2>{0.616945565f, 0.0148000056f},
-std::array<float,2>{0.350945473f, 0.699307323f},
-std::array<float,2>{0.266476303f, 0.411672413f},
-std::array<float,2>{0.561250389f, 0.893710375f},
-std::array<float,2>{0.849940538f, 0.00172777509f},
-std::array<float,2>{0.187840059f, 0.688841283f},
-std::array<float,2>{0.0353873335f, 0.23932752f},
-std::array<float,2>{0.985713005f, 0.572950959f},
-std::array<float,2>{0.743508339f, 0.323283702f},
-std::array<float,2>{0.413372815f, 0.791348517f},
-std::array<float,2>{0.453270227f, 0.0904937759f},
-std::array<float,2>{0.663683176f, 0.631371737f},
-std::array<float,2>{0.916176498f, 0.463192344f},
-std::array<float,2>{0.112276413f, 0.938949108f},
-std::array<float,2>{0.179515913f, 0.308543146f},
-std::array<float,2>{0.803552985f, 0.824116707f},
-std::array<float,2>{0.60699898f, 0.152341589f},
-std::array<float,2>{0.366659403f, 0.5267061f},
-std::array<float,2>{0.380478084f, 0.356178761f},
-std::array<float,2>{0.717844188f, 0.768401086f},
-std::array<float,2>{0.950151861f, 0.207320064f},
-std::array<float,2>{0.0237876493f, 0.601197779f},
-std::array<float,2>{0.234991565f, 0.0434387624f},
-std::array<float,2>{0.820374846f, 0.742771268f},
-std::array<float,2>{0.523495853f, 0.392997801f},
-std::array<float,2>{0.287732482f, 0.91805613f},
-std::array<float,2>{0.336949527f, 0.161039874f},
-std::array<float,2>{0.585689127f, 0.538864911f},
-std::array<float,2>{0.76052171f, 0.261869311f},
-std::array<float,2>{0.126304984f, 0.867951453f},
-std::array<float,2>{0.0845519826f, 0.478978634f},
-std::array<float,2>{0.875284314f, 0.994586825f},
-std::array<float,2>{0.645455003f, 0.122723855f},
-std::array<float,2>{0.479590297f, 0.673752725f},
-std::array<float,2>{0.496126264f, 0.439253956f},
-std::array<float,2>{0.639709413f, 0.962888122f},
-std::array<float,2>{0.905336857f, 0.074127987f},
-std::array<float,2>{0.0777159259f, 0.65600425f},
-std::array<float,2>{0.144233406f, 0.133917511f},
-std::array<float,2>{0.775782526f, 0.514745951f},
-std::array<float,2>{0.572013438f, 0.286760449f},
-std::array<float,2>{0.321223795f, 0.840302646f},
-std::array<float,2>{0.29880017f, 0.018542327f},
-std::array<float,2>{0.505939484f, 0.703397572f},
-std::array<float,2>{0.838597655f, 0.429501116f},
-std::array<float,2>{0.219527155f, 0.877471328f},
-std::array<float,2>{0.00831766799f, 0.32895568f},
-std::array<float,2>{0.964970648f, 0.811491251f},
-std::array<float,2>{0.702119887f, 0.224668562f},
-std::array<float,2>{0.398629427f, 0.578707695f},
-std::array<float,2>{0.345003694f, 0.280968815f},
-std::array<float,2>{0.609990597f, 0.856499672f},
-std::array<float,2>{0.784294605f, 0.185385644f},
-std::array<float,2>{0.163227543f, 0.558397591f},
-std::array<float,2>{0.107602984f, 0.0994901285f},
-std::array<float,2>{0.933350921f, 0.664002299f},
-std::array<float,2>{0.684351206f, 0.496882677f},
-std::array<float,2>{0.439377636f, 0.970230639f},
-std::array<float,2>{0.435098141f, 0.195291147f},
-std::array<float,2>{0.733464658f, 0.610819638f},
-std::array<float,2>{0.968757093f, 0.37026614f},
-std::array<float,2>{0.051410839f, 0.754984915f},
-std::array<float,2>{0.203326434f, 0.3772735f},
-std::array<float,2>{0.874241233f, 0.933249891f},
-std::array<float,2>{0.537347138f, 0.0617033243f},
-std::array<float,2>{0.259262711f, 0.721154213f},
-std::array<float,2>{0.314719081f, 0.488645256f},
-std::array<float,2>{0.570052803f, 0.981211543f},
-std::array<float,2>{0.767159164f, 0.104941063f},
-std::array<float,2>{0.15525791f, 0.668075621f},
-std::array<float,2>{0.0699518621f, 0.172223777f},
-std::array<float,2>{0.895344973f, 0.553045332f},
-std::array<float,2>{0.630340993f, 0.266852021f},
-std::array<float,2>{0.486821085f, 0.845546365f},
-std::array<float,2>{0.393559486f, 0.048266124f},
-std::array<float,2>{0.688262403f, 0.732963085f},
-std::array<float,2>{0.958714843f, 0.386658818f},
-std::array<float,2>{0.00654990273f, 0.92726022f},
-std::array<float,2>{0.228956997f, 0.366255373f},
-std::array<float,2>{0.828384936f, 0.763351858f},
-std::array<float,2>{0.510319412f, 0.200048804f},
-std::array<float,2>{0.305034548f, 0.619788885f},
-std::array<float,2>{0.451577336f, 0.290459931f},
-std::array<float,2>{0.677704513f, 0.832200885f},
-std::array<float,2>{0.929033756f, 0.132146165f},
-std::array<float,2>{0.0939239115f, 0.507368088f},
-std::array<float,2>{0.167948812f, 0.0672907308f},
-std::array<float,2>{0.79507935f, 0.644191086f},
-std::array<float,2>{0.620714486f, 0.447009623f},
-std::array<float,2>{0.356080085f, 0.957047582f},
-std::array<float,2>{0.256222606f, 0.233122364f},
-std::array<float,2>{0.540323317f, 0.593432844f},
-std::array<float,2>{0.859425426f, 0.336804479f},
-std::array<float,2>{0.213792056f, 0.804520667f},
-std::array<float,2>{0.0578744225f, 0.432308525f},
-std::array<float,2>{0.978569925f, 0.890242755f},
-std::array<float,2>{0.720411122f, 0.0289321691f},
-std::array<float,2>{0.42206645f, 0.711930335f},
-std::array<float,2>{0.415510982f, 0.401900649f},
-std::array<float,2>{0.741606891f, 0.912936926f},
-std::array<float,2>{0.994965434f, 0.0387120396f},
-std::array<float,2>{0.0445945412f, 0.73797524f},
-std::array<float,2>{0.201382861f, 0.214532837f},
-std::array<float,2>{0.856378794f, 0.601701736f},
-std::array<float,2>{0.554152012f, 0.34906584f},
-std::array<float,2>{0.275755942f, 0.775215626f},
-std::array<float,2>{0.370588541f, 0.112305976f},
-std::array<float,2>{0.597490847f, 0.680555224f},
-std::array<float,2>{0.812285542f, 0.474531025f},
-std::array<float,2>{0.18519415f, 0.989517987f},
-std::array<float,2>{0.119556122f, 0.255809337f},
-std::array<float,2>{0.909017622f, 0.864144862f},
-std::array<float,2>{0.671410501f, 0.168696016f},
-std::array<float,2>{0.464089245f, 0.539486766f},
-std::array<float,2>{0.290816247f, 0.313437283f},
-std::array<float,2>{0.516662836f, 0.783126652f},
-std::array<float,2>{0.818850517f, 0.242913201f},
-std::array<float,2>{0.245154634f, 0.564217746f},
-std::array<float,2>{0.0192163438f, 0.00933008827f},
-std::array<float,2>{0.944858909f, 0.696503997f},
-std::array<float,2>{0.70774585f, 0.420992732f},
-std::array<float,2>{0.387358755f, 0.905604303f},
-std::array<float,2>{0.47320053f, 0.145447463f},
-std::array<float,2>{0.654441833f, 0.518943608f},
-std::array<float,2>{0.883341968f, 0.30178076f},
-std::array<float,2>{0.092120707f, 0.81510514f},
-std::array<float,2>{0.139511734f, 0.458304912f},
-std::array<float,2>{0.754397452f, 0.949420989f},
-std::array<float,2>{0.586769104f, 0.0857381821f},
-std::array<float,2>{0.330240458f, 0.636216938f},
-std::array<float,2>{0.263111442f, 0.455955893f},
-std::array<float,2>{0.533918083f, 0.946913481f},
-std::array<float,2>{0.869580626f, 0.0785102025f},
-std::array<float,2>{0.207610875f, 0.637150466f},
-std::array<float,2>{0.0471018478f, 0.142800972f},
-std::array<float,2>{0.976423919f, 0.522802413f},
-std::array<float,2>{0.730130613f, 0.297451615f},
-std::array<float,2>{0.431649864f, 0.817114651f},
-std::array<float,2>{0.442216426f, 0.015534617f},
-std::array<float,2>{0.683123648f, 0.699788034f},
-std::array<float,2>{0.936797798f, 0.416568398f},
-std::array<float,2>{0.104567274f, 0.900191009f},
-std::array<float,2>{0.159828305f, 0.318752259f},
-std::array<float,2>{0.786415815f, 0.785393476f},
-std::array<float,2>{0.614402771f, 0.246704534f},
-std::array<float,2>{0.348003834f, 0.568596065f},
-std::array<float,2>{0.406120956f, 0.25203374f},
-std::array<float,2>{0.697434962f, 0.860568821f},
-std::array<float,2>{0.964117169f, 0.16509752f},
-std::array<float,2>{0.0127312914f, 0.545384467f},
-std::array<float,2>{0.223146319f, 0.115664564f},
-std::array<float,2>{0.840001523f, 0.687030733f},
-std::array<float,2>{0.50085485f, 0.471210212f},
-std::array<float,2>{0.301690012f, 0.984380603f},
-std::array<float,2>{0.326250374f, 0.217350423f},
-std::array<float,2>{0.576388836f, 0.608336329f},
-std::array<float,2>{0.779016733f, 0.345352501f},
-std::array<float,2>{0.146830723f, 0.779854357f},
-std::array<float,2>{0.0710073784f, 0.403879076f},
-std::array<float,2>{0.898737729f, 0.907263219f},
-std::array<float,2>{0.636466503f, 0.0315947719f},
-std::array<float,2>{0.495041937f, 0.739345968f},
-std::array<float,2>{0.483563185f, 0.433655083f},
-std::array<float,2>{0.642481208f, 0.884124219f},
-std::array<float,2>{0.879677296f, 0.0249980167f},
-std::array<float,2>{0.080340147f, 0.715867341f},
-std::array<float,2>{0.131789207f, 0.228750795f},
-std::array<float,2>{0.761723042f, 0.588960707f},
-std::array<float,2>{0.580248892f, 0.34145692f},
-std::array<float,2>{0.340575188f, 0.800057113f},
-std::array<float,2>{0.284792125f, 0.0664003715f},
-std::array<float,2>{0.528431296f, 0.647836506f},
-std::array<float,2>{0.826418877f, 0.452748507f},
-std::array<float,2>{0.241867974f, 0.955339134f},
-std::array<float,2>{0.0282458123f, 0.295751721f},
-std::array<float,2>{0.949142575f, 0.828910947f},
-std::array<float,2>{0.712379396f, 0.127813697f},
-std::array<float,2>{0.377992719f, 0.503614426f},
-std::array<float,2>{0.362988681f, 0.36072731f},
-std::array<float,2>{0.605228126f, 0.760402977f},
-std::array<float,2>{0.799869776f, 0.198890865f},
-std::array<float,2>{0.175610498f, 0.623679817f},
-std::array<float,2>{0.115762442f, 0.0515848249f},
-std::array<float,2>{0.919078231f, 0.728842497f},
-std::array<float,2>{0.659348011f, 0.389587075f},
-std::array<float,2>{0.459484428f, 0.923967063f},
-std::array<float,2>{0.407918185f, 0.178508177f},
-std::array<float,2>{0.749900222f, 0.547869921f},
-std::array<float,2>{0.992160022f, 0.270761102f},
-std::array<float,2>{0.0315287001f, 0.849242449f},
-std::array<float,2>{0.191745982f, 0.486002028f},
-std::array<float,2>{0.846100211f, 0.979862332f},
-std::array<float,2>{0.556353867f, 0.106571689f},
-std::array<float,2>{0.269583523f, 0.667713165f},
-std::array<float,2>{0.332508296f, 0.381583899f},
-std::array<float,2>{0.591939569f, 0.934327781f},
-std::array<float,2>{0.753644288f, 0.0566693507f},
-std::array<float,2>{0.135526776f, 0.724095762f},
-std::array<float,2>{0.0859921277f, 0.190807804f},
-std::array<float,2>{0.890472353f, 0.615408421f},
-std::array<float,2>{0.650749922f, 0.374166727f},
-std::array<float,2>{0.47086978f, 0.753409207f},
-std::array<float,2>{0.383793086f, 0.0952085778f},
-std::array<float,2>{0.70446372f, 0.659442544f},
-std::array<float,2>{0.938540101f, 0.495229363f},
-std::array<float,2>{0.0200336464f, 0.97275269f},
-std::array<float,2>{0.247500047f, 0.273634762f},
-std::array<float,2>{0.814590931f, 0.85242635f},
-std::array<float,2>{0.522701025f, 0.181956843f},
-std::array<float,2>{0.29526791f, 0.561100483f},
-std::array<float,2>{0.467161208f, 0.332092851f},
-std::array<float,2>{0.666545808f, 0.805795133f},
-std::array<float,2>{0.912351191f, 0.219881222f},
-std::array<float,2>{0.124785215f, 0.583652437f},
-std::array<float,2>{0.182835475f, 0.0217879936f},
-std::array<float,2>{0.804748476f, 0.709391534f},
-std::array<float,2>{0.598693967f, 0.424683899f},
-std::array<float,2>{0.373641998f, 0.880539894f},
-std::array<float,2>{0.280835569f, 0.139960498f},
-std::array<float,2>{0.550098479f, 0.509352744f},
-std::array<float,2>{0.85157901f, 0.283129096f},
-std::array<float,2>{0.196826518f, 0.836129487f},
-std::array<float,2>{0.0397756584f, 0.443456143f},
-std::array<float,2>{0.996254623f, 0.968337595f},
-std::array<float,2>{0.735872149f, 0.0748342574f},
-std::array<float,2>{0.41966027f, 0.650921524f},
-std::array<float,2>{0.429163724f, 0.483076572f},
-std::array<float,2>{0.726182282f, 0.996767402f},
-std::array<float,2>{0.981358945f, 0.11970441f},
-std::array<float,2>{0.0592648163f, 0.676580071f},
-std::array<float,2>{0.215393782f, 0.159068793f},
-std::array<float,2>{0.86348927f, 0.532461047f},
-std::array<float,2>{0.546583593f, 0.258173198f},
-std::array<float,2>{0.252051771f, 0.874921203f},
-std::array<float,2>{0.351918608f, 0.0424123965f},
-std::array<float,2>{0.622979164f, 0.747944713f},
-std::array<float,2>{0.792856157f, 0.396074444f},
-std::array<float,2>{0.169401929f, 0.916922271f},
-std::array<float,2>{0.101324104f, 0.35266459f},
-std::array<float,2>{0.925086021f, 0.772312343f},
-std::array<float,2>{0.674473822f, 0.204224348f},
-std::array<float,2>{0.447093606f, 0.594920397f},
-std::array<float,2>{0.309952527f, 0.312363982f},
-std::array<float,2>{0.513874233f, 0.827053189f},
-std::array<float,2>{0.833288252f, 0.152480528f},
-std::array<float,2>{0.232930794f, 0.528337002f},
-std::array<float,2>{0.000979971956f, 0.0889337584f},
-std::array<float,2>{0.955008805f, 0.626384616f},
-std::array<float,2>{0.69385916f, 0.467612237f},
-std::array<float,2>{0.39585799f, 0.943003714f},
-std::array<float,2>{0.491223276f, 0.23558268f},
-std::array<float,2>{0.626305282f, 0.574549794f},
-std::array<float,2>{0.89100343f, 0.327270329f},
-std::array<float,2>{0.0641445145f, 0.795161426f},
-std::array<float,2>{0.148757443f, 0.410088122f},
-std::array<float,2>{0.771082759f, 0.894929528f},
-std::array<float,2>{0.564447582f, 0.00437643938f},
-std::array<float,2>{0.320238799f, 0.69402492f},
-std::array<float,2>{0.2928783f, 0.42167598f},
-std::array<float,2>{0.518080771f, 0.905831575f},
-std::array<float,2>{0.818075597f, 0.00913378596f},
-std::array<float,2>{0.242339969f, 0.696814835f},
-std::array<float,2>{0.0162105728f, 0.242228404f},
-std::array<float,2>{0.942811966f, 0.563656032f},
-std::array<float,2>{0.710466206f, 0.312744409f},
-std::array<float,2>{0.389568865f, 0.782712221f},
-std::array<float,2>{0.475282878f, 0.0854038745f},
-std::array<float,2>{0.653246462f, 0.636369348f},
-std::array<float,2>{0.886689246f, 0.458834499f},
-std::array<float,2>{0.0913926363f, 0.949829042f},
-std::array<float,2>{0.137165502f, 0.302248359f},
-std::array<float,2>{0.757343769f, 0.814742446f},
-std::array<float,2>{0.588220835f, 0.144950718f},
-std::array<float,2>{0.329432726f, 0.519444168f},
-std::array<float,2>{0.417521f, 0.349259913f},
-std::array<float,2>{0.7387501f, 0.774888396f},
-std::array<float,2>{0.992247045f, 0.21419096f},
-std::array<float,2>{0.0462213941f, 0.602095425f},
-std::array<float,2>{0.19941178f, 0.0384774394f},
-std::array<float,2>{0.858504832f, 0.737616658f},
-std::array<float,2>{0.5527004f, 0.40160042f},
-std::array<float,2>{0.274726063f, 0.912518024f},
-std::array<float,2>{0.367637157f, 0.168085858f},
-std::array<float,2>{0.594357967f, 0.539633691f},
-std::array<float,2>{0.809430718f, 0.254931509f},
-std::array<float,2>{0.186977789f, 0.863765121f},
-std::array<float,2>{0.118629299f, 0.473824739f},
-std::array<float,2>{0.907807827f, 0.989988923f},
-std::array<float,2>{0.668719411f, 0.113231532f},
-std::array<float,2>{0.461535394f, 0.679702342f},
-std::array<float,2>{0.450314522f, 0.44669795f},
-std::array<float,2>{0.679639637f, 0.957611442f},
-std::array<float,2>{0.927388787f, 0.0667182505f},
-std::array<float,2>{0.0969047099f, 0.643829405f},
-std::array<float,2>{0.165470496f, 0.132658169f},
-std::array<float,2>{0.793432593f, 0.507205784f},
-std::array<float,2>{0.617890418f, 0.290902764f},
-std::array<float,2>{0.358397514f, 0.832806706f},
-std::array<float,2>{0.255638957f, 0.0285977889f},
-std::array<float,2>{0.541459084f, 0.712611377f},
-std::array<float,2>{0.862802207f, 0.431693226f},
-std::array<float,2>{0.212841272f, 0.890072584f},
-std::array<float,2>{0.0559812263f, 0.336113542f},
-std::array<float,2>{0.977412581f, 0.803729832f},
-std::array<float,2>{0.721696317f, 0.232876405f},
-std::array<float,2>{0.424477875f, 0.592988729f},
-std::array<float,2>{0.312953472f, 0.267403722f},
-std::array<float,2>{0.567280293f, 0.845191836f},
-std::array<float,2>{0.768100262f, 0.172561437f},
-std::array<float,2>{0.154231474f, 0.553327441f},
-std::array<float,2>{0.0679144859f, 0.105106704f},
-std::array<float,2>{0.896775663f, 0.668488026f},
-std::array<float,2>{0.632101357f, 0.488882005f},
-std::array<float,2>{0.485892862f, 0.980806172f},
-std::array<float,2>{0.391838133f, 0.199296057f},
-std::array<float,2>{0.690704405f, 0.619270027f},
-std::array<float,2>{0.959455848f, 0.36690709f},
-std::array<float,2>{0.00489264214f, 0.763061285f},
-std::array<float,2>{0.227923244f, 0.386188626f},
-std::array<float,2>{0.830414951f, 0.927037835f},
-std::array<float,2>{0.509006798f, 0.0483664386f},
-std::array<float,2>{0.308591813f, 0.732678771f},
-std::array<float,2>{0.347356498f, 0.496155441f},
-std::array<float,2>{0.612181008f, 0.969733f},
-std::array<float,2>{0.782339871f, 0.0990481451f},
-std::array<float,2>{0.161928326f, 0.663268209f},
-std::array<float,2>{0.106103875f, 0.184736803f},
-std::array<float,2>{0.931407392f, 0.558004379f},
-std::array<float,2>{0.686783612f, 0.280551553f},
-std::array<float,2>{0.439734548f, 0.857222676f},
-std::array<float,2>{0.436160237f, 0.0621571206f},
-std::array<float,2>{0.731392026f, 0.721334457f},
-std::array<float,2>{0.97129482f, 0.377595603f},
-std::array<float,2>{0.0540199056f, 0.932747185f},
-std::array<float,2>{0.205938593f, 0.370824337f},
-std::array<float,2>{0.872559369f, 0.755619168f},
-std::array<float,2>{0.536304176f, 0.19441168f},
-std::array<float,2>{0.26017794f, 0.610932827f},
-std::array<float,2>{0.499950349f, 0.2862508f},
-std::array<float,2>{0.637906432f, 0.840658724f},
-std::array<float,2>{0.903375566f, 0.134457991f},
-std::array<float,2>{0.0761450008f, 0.515286028f},
-std::array<float,2>{0.140764982f, 0.0734687895f},
-std::array<float,2>{0.774419963f, 0.655439675f},
-std::array<float,2>{0.572747946f, 0.438670337f},
-std::array<float,2>{0.322457761f, 0.962280154f},
-std::array<float,2>{0.300182998f, 0.225503922f},
-std::array<float,2>{0.505251706f, 0.578446269f},
-std::array<float,2>{0.835991919f, 0.328612983f},
-std::array<float,2>{0.222377583f, 0.810661376f},
-std::array<float,2>{0.0103384461f, 0.429091066f},
-std::array<float,2>{0.968074501f, 0.877011061f},
-std::array<float,2>{0.700563967f, 0.0177713111f},
-std::array<float,2>{0.401491404f, 0.70384109f},
-std::array<float,2>{0.381232858f, 0.393310785f},
-std::array<float,2>{0.716292262f, 0.918742001f},
-std::array<float,2>{0.952763915f, 0.0437481366f},
-std::array<float,2>{0.0272626709f, 0.742390573f},
-std::array<float,2>{0.237921938f, 0.207847476f},
-std::array<float,2>{0.824040711f, 0.600961328f},
-std::array<float,2>{0.526171207f, 0.355579615f},
-std::array<float,2>{0.28704375f, 0.768001437f},
-std::array<float,2>{0.338823229f, 0.122276194f},
-std::array<float,2>{0.58300066f, 0.673223913f},
-std::array<float,2>{0.759464204f, 0.479025513f},
-std::array<float,2>{0.127758905f, 0.994982362f},
-std::array<float,2>{0.0834789425f, 0.262246966f},
-std::array<float,2>{0.878305972f, 0.867413461f},
-std::array<float,2>{0.647564769f, 0.160461441f},
-std::array<float,2>{0.476990819f, 0.538166463f},
-std::array<float,2>{0.269374311f, 0.323924363f},
-std::array<float,2>{0.560039222f, 0.791649222f},
-std::array<float,2>{0.847690761f, 0.240078762f},
-std::array<float,2>{0.19080247f, 0.572604835f},
-std::array<float,2>{0.0375603847f, 0.00138498039f},
-std::array<float,2>{0.987185419f, 0.689317942f},
-std::array<float,2>{0.746003866f, 0.411618471f},
-std::array<float,2>{0.411883861f, 0.894314647f},
-std::array<float,2>{0.456639796f, 0.151840851f},
-std::array<float,2>{0.66121614f, 0.526971936f},
-std::array<float,2>{0.915946782f, 0.307947367f},
-std::array<float,2>{0.110829167f, 0.823590755f},
-std::array<float,2>{0.176112339f, 0.463859499f},
-std::array<float,2>{0.801304162f, 0.939397216f},
-std::array<float,2>{0.608595431f, 0.0901031867f},
-std::array<float,2>{0.364422947f, 0.630951524f},
-std::array<float,2>{0.304361135f, 0.470672101f},
-std::array<float,2>{0.50285244f, 0.987340212f},
-std::array<float,2>{0.84307152f, 0.114224099f},
-std::array<float,2>{0.22577332f, 0.685156941f},
-std::array<float,2>{0.0143647566f, 0.166426107f},
-std::array<float,2>{0.961422026f, 0.543253779f},
-std::array<float,2>{0.695464373f, 0.251711071f},
-std::array<float,2>{0.403807759f, 0.861611664f},
-std::array<float,2>{0.49389407f, 0.0345901512f},
-std::array<float,2>{0.634159088f, 0.742165089f},
-std::array<float,2>{0.901886463f, 0.405930609f},
-std::array<float,2>{0.072759375f, 0.90886116f},
-std::array<float,2>{0.146171272f, 0.346030891f},
-std::array<float,2>{0.779342175f, 0.77859664f},
-std::array<float,2>{0.575347543f, 0.216544315f},
-std::array<float,2>{0.324822009f, 0.606932342f},
-std::array<float,2>{0.430675745f, 0.299846262f},
-std::array<float,2>{0.72659272f, 0.8197456f},
-std::array<float,2>{0.973342478f, 0.142380536f},
-std::array<float,2>{0.0499871746f, 0.520161033f},
-std::array<float,2>{0.209971145f, 0.0815719068f},
-std::array<float,2>{0.867646992f, 0.640241742f},
-std::array<float,2>{0.533080518f, 0.454666436f},
-std::array<float,2>{0.264166772f, 0.948145568f},
-std::array<float,2>{0.351551086f, 0.249183312f},
-std::array<float,2>{0.616538584f, 0.566952169f},
-std::array<float,2>{0.788816988f, 0.31755963f},
-std::array<float,2>{0.157875627f, 0.788641691f},
-std::array<float,2>{0.102888815f, 0.415131152f},
-std::array<float,2>{0.934242427f, 0.90166223f},
-std::array<float,2>{0.681309521f, 0.0123690711f},
-std::array<float,2>{0.443782121f, 0.702022433f},
-std::array<float,2>{0.458867252f, 0.388550788f},
-std::array<float,2>{0.657549918f, 0.922633171f},
-std::array<float,2>{0.92110455f, 0.0529565252f},
-std::array<float,2>{0.114195973f, 0.728176892f},
-std::array<float,2>{0.172594011f, 0.196813717f},
-std::array<float,2>{0.798105121f, 0.621953785f},
-std::array<float,2>{0.602143526f, 0.363199443f},
-std::array<float,2>{0.360124588f, 0.759696245f},
-std::array<float,2>{0.273243159f, 0.108061269f},
-std::array<float,2>{0.557639599f, 0.665591478f},
-std::array<float,2>{0.844186902f, 0.487213433f},
-std::array<float,2>{0.193803668f, 0.978060901f},
-std::array<float,2>{0.0343333073f, 0.271674931f},
-std::array<float,2>{0.988792598f, 0.850176811f},
-std::array<float,2>{0.74731648f, 0.176220983f},
-std::array<float,2>{0.408679187f, 0.549472153f},
-std::array<float,2>{0.343705982f, 0.342858851f},
-std::array<float,2>{0.579988658f, 0.798571169f},
-std::array<float,2>{0.764432609f, 0.22768116f},
-std::array<float,2>{0.130733609f, 0.586129427f},
-std::array<float,2>{0.0784530193f, 0.0254060682f},
-std::array<float,2>{0.881489635f, 0.718001962f},
-std::array<float,2>{0.643386066f, 0.437363446f},
-std::array<float,2>{0.482135385f, 0.886392772f},
-std::array<float,2>{0.375460863f, 0.126818165f},
-std::array<float,2>{0.714416564f, 0.500531495f},
-std::array<float,2>{0.94661504f, 0.294915885f},
-std::array<float,2>{0.0300948415f, 0.830509067f},
-std::array<float,2>{0.240097821f, 0.450182647f},
-std::array<float,2>{0.824688435f, 0.954255283f},
-std::array<float,2>{0.531221569f, 0.0638811812f},
-std::array<float,2>{0.281844944f, 0.645901501f},
-std::array<float,2>{0.37171784f, 0.422945589f},
-std::array<float,2>{0.601526618f, 0.880923271f},
-std::array<float,2>{0.806814134f, 0.0202744175f},
-std::array<float,2>{0.180431962f, 0.707925141f},
-std::array<float,2>{0.122598305f, 0.220951974f},
-std::array<float,2>{0.911542058f, 0.585721552f},
-std::array<float,2>{0.665304959f, 0.334134489f},
-std::array<float,2>{0.466213822f, 0.807583094f},
-std::array<float,2>{0.421314806f, 0.0774507895f},
-std::array<float,2>{0.738239765f, 0.649216831f},
-std::array<float,2>{0.999129295f, 0.443280429f},
-std::array<float,2>{0.0426752605f, 0.966454268f},
-std::array<float,2>{0.197951451f, 0.285116971f},
-std::array<float,2>{0.854043543f, 0.839703739f},
-std::array<float,2>{0.547726214f, 0.137068108f},
-std::array<float,2>{0.27899611f, 0.511365473f},
-std::array<float,2>{0.469695687f, 0.372718215f},
-std::array<float,2>{0.649213195f, 0.750586569f},
-std::array<float,2>{0.88787353f, 0.187646508f},
-std::array<float,2>{0.0888578892f, 0.613601863f},
-std::array<float,2>{0.134055793f, 0.0547423959f},
-std::array<float,2>{0.751142561f, 0.725587785f},
-std::array<float,2>{0.590815425f, 0.379703075f},
-std::array<float,2>{0.334172159f, 0.93690908f},
-std::array<float,2>{0.294569403f, 0.181111991f},
-std::array<float,2>{0.519888043f, 0.560425103f},
-std::array<float,2>{0.81314671f, 0.275592208f},
-std::array<float,2>{0.248883188f, 0.854683638f},
-std::array<float,2>{0.0227679797f, 0.493135124f},
-std::array<float,2>{0.940857053f, 0.975998461f},
-std::array<float,2>{0.705720544f, 0.0962086171f},
-std::array<float,2>{0.384820938f, 0.65805161f},
-std::array<float,2>{0.397294909f, 0.465011626f},
-std::array<float,2>{0.692075431f, 0.944284201f},
-std::array<float,2>{0.95651114f, 0.0865981951f},
-std::array<float,2>{0.00222169445f, 0.627776325f},
-std::array<float,2>{0.231718153f, 0.155595645f},
-std::array<float,2>{0.835403621f, 0.531000495f},
-std::array<float,2>{0.512662947f, 0.309848219f},
-std::array<float,2>{0.311003804f, 0.824804723f},
-std::array<float,2>{0.317840189f, 0.00768474443f},
-std::array<float,2>{0.565686643f, 0.69299078f},
-std::array<float,2>{0.772536576f, 0.406398445f},
-std::array<float,2>{0.151930287f, 0.89780122f},
-std::array<float,2>{0.0657366142f, 0.324941695f},
-std::array<float,2>{0.893586159f, 0.794783533f},
-std::array<float,2>{0.628290415f, 0.236635223f},
-std::array<float,2>{0.490141749f, 0.576512992f},
-std::array<float,2>{0.25008449f, 0.26022315f},
-std::array<float,2>{0.544652045f, 0.872202635f},
-std::array<float,2>{0.86574012f, 0.156986371f},
-std::array<float,2>{0.217634216f, 0.534817219f},
-std::array<float,2>{0.0608138144f, 0.118963413f},
-std::array<float,2>{0.982874632f, 0.678644538f},
-std::array<float,2>{0.723289728f, 0.481093854f},
-std::array<float,2>{0.427521944f, 0.999774754f},
-std::array<float,2>{0.448069304f, 0.206275076f},
-std::array<float,2>{0.672374487f, 0.596362829f},
-std::array<float,2>{0.92225337f, 0.354272276f},
-std::array<float,2>{0.0990134701f, 0.770644605f},
-std::array<float,2>{0.17012848f, 0.396823108f},
-std::array<float,2>{0.789708257f, 0.914984703f},
-std::array<float,2>{0.624072433f, 0.0403592624f},
-std::array<float,2>{0.353596687f, 0.748102188f},
-std::array<float,2>{0.276358247f, 0.399701238f},
-std::array<float,2>{0.554641485f, 0.910257936f},
-std::array<float,2>{0.855818689f, 0.0362328067f},
-std::array<float,2>{0.201939613f, 0.735419333f},
-std::array<float,2>{0.0441963039f, 0.21161145f},
-std::array<float,2>{0.994314551f, 0.60493809f},
-std::array<float,2>{0.741971552f, 0.349670589f},
-std::array<float,2>{0.415639251f, 0.775816202f},
-std::array<float,2>{0.464408755f, 0.110349923f},
-std::array<float,2>{0.670920372f, 0.681830168f},
-std::array<float,2>{0.908326685f, 0.475503504f},
-std::array<float,2>{0.119890325f, 0.990369201f},
-std::array<float,2>{0.184747279f, 0.257175475f},
-std::array<float,2>{0.811818182f, 0.865949988f},
-std::array<float,2>{0.59680903f, 0.170585155f},
-std::array<float,2>{0.370767772f, 0.54151386f},
-std::array<float,2>{0.386790514f, 0.316030115f},
-std::array<float,2>{0.707433939f, 0.783787727f},
-std::array<float,2>{0.944599152f, 0.244881213f},
-std::array<float,2>{0.018898841f, 0.566160738f},
-std::array<float,2>{0.245708182f, 0.010850843f},
-std::array<float,2>{0.818822801f, 0.69856894f},
-std::array<float,2>{0.517349601f, 0.418322623f},
-std::array<float,2>{0.290419698f, 0.902358711f},
-std::array<float,2>{0.330755353f, 0.147996515f},
-std::array<float,2>{0.586046338f, 0.516134501f},
-std::array<float,2>{0.753992796f, 0.304097235f},
-std::array<float,2>{0.138837025f, 0.814074636f},
-std::array<float,2>{0.0926502943f, 0.460099787f},
-std::array<float,2>{0.88299638f, 0.952174902f},
-std::array<float,2>{0.654986084f, 0.0831328556f},
-std::array<float,2>{0.472709358f, 0.634060204f},
-std::array<float,2>{0.486660898f, 0.490671933f},
-std::array<float,2>{0.630430102f, 0.983357608f},
-std::array<float,2>{0.894835234f, 0.103028409f},
-std::array<float,2>{0.0698207468f, 0.671575904f},
-std::array<float,2>{0.154379845f, 0.174998805f},
-std::array<float,2>{0.767000258f, 0.552217603f},
-std::array<float,2>{0.569618285f, 0.26795575f},
-std::array<float,2>{0.315280467f, 0.846616566f},
-std::array<float,2>{0.305545121f, 0.0504840985f},
-std::array<float,2>{0.509936273f, 0.731211424f},
-std::array<float,2>{0.828855693f, 0.383564949f},
-std::array<float,2>{0.229396209f, 0.928476155f},
-std::array<float,2>{0.00612808764f, 0.365174294f},
-std::array<float,2>{0.958056271f, 0.765147448f},
-std::array<float,2>{0.687598944f, 0.202038467f},
-std::array<float,2>{0.394460052f, 0.618781447f},
-std::array<float,2>{0.355540723f, 0.291780442f},
-std::array<float,2>{0.620402217f, 0.834315002f},
-std::array<float,2>{0.795497656f, 0.13036719f},
-std::array<float,2>{0.167151302f, 0.505014777f},
-std::array<float,2>{0.0944878757f, 0.0685753524f},
-std::array<float,2>{0.92944777f, 0.641527295f},
-std::array<float,2>{0.677074671f, 0.449207634f},
-std::array<float,2>{0.451787293f, 0.960843325f},
-std::array<float,2>{0.422760278f, 0.232197866f},
-std::array<float,2>{0.720188558f, 0.590683877f},
-std::array<float,2>{0.97924304f, 0.337922364f},
-std::array<float,2>{0.0583068617f, 0.800997972f},
-std::array<float,2>{0.21332556f, 0.430864751f},
-std::array<float,2>{0.859895527f, 0.888542295f},
-std::array<float,2>{0.540631831f, 0.0307157971f},
-std::array<float,2>{0.256621271f, 0.714401007f},
-std::array<float,2>{0.320444047f, 0.440659851f},
-std::array<float,2>{0.571369827f, 0.963823378f},
-std::array<float,2>{0.776231766f, 0.0720204189f},
-std::array<float,2>{0.143779531f, 0.654260993f},
-std::array<float,2>{0.0774020925f, 0.136649773f},
-std::array<float,2>{0.906216145f, 0.513302386f},
-std::array<float,2>{0.640192688f, 0.288478136f},
-std::array<float,2>{0.496794462f, 0.842195094f},
-std::array<float,2>{0.399410427f, 0.0157680344f},
-std::array<float,2>{0.701339245f, 0.705816269f},
-std::array<float,2>{0.965611756f, 0.426754594f},
-std::array<float,2>{0.00819216762f, 0.875436544f},
-std::array<float,2>{0.219059169f, 0.330306232f},
-std::array<float,2>{0.837910831f, 0.809800267f},
-std::array<float,2>{0.506710529f, 0.2245294f},
-std::array<float,2>{0.297919303f, 0.581684113f},
-std::array<float,2>{0.438512146f, 0.277725726f},
-std::array<float,2>{0.684039295f, 0.859336793f},
-std::array<float,2>{0.933006704f, 0.186861724f},
-std::array<float,2>{0.108199373f, 0.555992782f},
-std::array<float,2>{0.164003804f, 0.10010916f},
-std::array<float,2>{0.784780025f, 0.6602301f},
-std::array<float,2>{0.609603226f, 0.499573708f},
-std::array<float,2>{0.345290661f, 0.971940339f},
-std::array<float,2>{0.259645998f, 0.191498384f},
-std::array<float,2>{0.538042068f, 0.613134563f},
-std::array<float,2>{0.874784112f, 0.367973566f},
-std::array<float,2>{0.203903794f, 0.756276011f},
-std::array<float,2>{0.0511444546f, 0.37512973f},
-std::array<float,2>{0.969395816f, 0.931387901f},
-std::array<float,2>{0.734142303f, 0.0590076819f},
-std::array<float,2>{0.434937298f, 0.719545543f},
-std::array<float,2>{0.413823605f, 0.413979262f},
-std::array<float,2>{0.743868947f, 0.892281413f},
-std::array<float,2>{0.985860527f, 0.00367137929f},
-std::array<float,2>{0.0356846824f, 0.690254688f},
-std::array<float,2>{0.188062519f, 0.241629243f},
-std::array<float,2>{0.850492179f, 0.570975721f},
-std::array<float,2>{0.560954154f, 0.321960717f},
-std::array<float,2>{0.265630066f, 0.790454268f},
-std::array<float,2>{0.36692065f, 0.092529133f},
-std::array<float,2>{0.606661856f, 0.629072964f},
-std::array<float,2>{0.803099334f, 0.462587476f},
-std::array<float,2>{0.178794667f, 0.940355301f},
-std::array<float,2>{0.111714177f, 0.305406958f},
-std::array<float,2>{0.916558623f, 0.821989298f},
-std::array<float,2>{0.663169742f, 0.148859009f},
-std::array<float,2>{0.453831851f, 0.524886668f},
-std::array<float,2>{0.287528306f, 0.358651221f},
-std::array<float,2>{0.524380326f, 0.76564312f},
-std::array<float,2>{0.820824683f, 0.210021839f},
-std::array<float,2>{0.234761417f, 0.598759532f},
-std::array<float,2>{0.0239667688f, 0.0453250855f},
-std::array<float,2>{0.949578702f, 0.74419874f},
-std::array<float,2>{0.718394876f, 0.391386777f},
-std::array<float,2>{0.380183965f, 0.920953631f},
-std::array<float,2>{0.480129004f, 0.163409114f},
-std::array<float,2>{0.6447106f, 0.536506355f},
-std::array<float,2>{0.875549972f, 0.265317947f},
-std::array<float,2>{0.084244363f, 0.870318651f},
-std::array<float,2>{0.126625538f, 0.477469832f},
-std::array<float,2>{0.760141611f, 0.993825018f},
-std::array<float,2>{0.584984601f, 0.123531297f},
-std::array<float,2>{0.33741203f, 0.674772263f},
-std::array<float,2>{0.270736516f, 0.487833858f},
-std::array<float,2>{0.555522382f, 0.977521122f},
-std::array<float,2>{0.846920371f, 0.108692117f},
-std::array<float,2>{0.193303183f, 0.664859056f},
-std::array<float,2>{0.0324710719f, 0.176864892f},
-std::array<float,2>{0.990741134f, 0.550420463f},
-std::array<float,2>{0.74873656f, 0.272576749f},
-std::array<float,2>{0.406593353f, 0.850850582f},
-std::array<float,2>{0.460678875f, 0.0537443049f},
-std::array<float,2>{0.658299148f, 0.72684443f},
-std::array<float,2>{0.918598056f, 0.387251228f},
-std::array<float,2>{0.116817072f, 0.92357254f},
-std::array<float,2>{0.174311444f, 0.36135903f},
-std::array<float,2>{0.799652874f, 0.758218408f},
-std::array<float,2>{0.604072452f, 0.195690081f},
-std::array<float,2>{0.361738563f, 0.622718811f},
-std::array<float,2>{0.377905071f, 0.293695062f},
-std::array<float,2>{0.710994601f, 0.831409752f},
-std::array<float,2>{0.947794795f, 0.125041574f},
-std::array<float,2>{0.0283440333f, 0.501460791f},
-std::array<float,2>{0.24078396f, 0.0628482774f},
-std::array<float,2>{0.827649355f, 0.644587934f},
-std::array<float,2>{0.527948558f, 0.450696528f},
-std::array<float,2>{0.283482701f, 0.953275621f},
-std::array<float,2>{0.340910226f, 0.22724992f},
-std::array<float,2>{0.581413448f, 0.587824225f},
-std::array<float,2>{0.76339221f, 0.342562497f},
-std::array<float,2>{0.132631272f, 0.79750663f},
-std::array<float,2>{0.081120111f, 0.436492205f},
-std::array<float,2>{0.880396247f, 0.884825408f},
-std::array<float,2>{0.640830815f, 0.0272915158f},
-std::array<float,2>{0.482720256f, 0.717497706f},
-std::array<float,2>{0.495581061f, 0.404960573f},
-std::array<float,2>{0.635648906f, 0.909877896f},
-std::array<float,2>{0.899972618f, 0.0332946852f},
-std::array<float,2>{0.0719732642f, 0.740397036f},
-std::array<float,2>{0.148044616f, 0.215319902f},
-std::array<float,2>{0.778302014f, 0.606209815f},
-std::array<float,2>{0.577728271f, 0.347189784f},
-std::array<float,2>{0.327410191f, 0.778015077f},
-std::array<float,2>{0.302654624f, 0.114825949f},
-std::array<float,2>{0.501688123f, 0.68409282f},
-std::array<float,2>{0.841542959f, 0.468981802f},
-std::array<float,2>{0.224567294f, 0.987006962f},
-std::array<float,2>{0.0121061495f, 0.250679135f},
-std::array<float,2>{0.962907434f, 0.862529576f},
-std::array<float,2>{0.698845923f, 0.167532414f},
-std::array<float,2>{0.404373109f, 0.544784248f},
-std::array<float,2>{0.349246442f, 0.317242205f},
-std::array<float,2>{0.613523006f, 0.787842512f},
-std::array<float,2>{0.785885632f, 0.248207748f},
-std::array<float,2>{0.159069881f, 0.567831993f},
-std::array<float,2>{0.103690237f, 0.0136200851f},
-std::array<float,2>{0.935646176f, 0.70302099f},
-std::array<float,2>{0.681882203f, 0.414155334f},
-std::array<float,2>{0.442606598f, 0.901051521f},
-std::array<float,2>{0.432681084f, 0.141100019f},
-std::array<float,2>{0.729072869f, 0.52138412f},
-std::array<float,2>{0.974798262f, 0.299424499f},
-std::array<float,2>{0.0483701006f, 0.818894744f},
-std::array<float,2>{0.208160654f, 0.453286558f},
-std::array<float,2>{0.870845437f, 0.948957503f},
-std::array<float,2>{0.534719825f, 0.0807040036f},
-std::array<float,2>{0.262014836f, 0.639031231f},
-std::array<float,2>{0.31910187f, 0.407864481f},
-std::array<float,2>{0.562585592f, 0.896535158f},
-std::array<float,2>{0.770422459f, 0.00627381541f},
-std::array<float,2>{0.149700388f, 0.69199878f},
-std::array<float,2>{0.0628724396f, 0.237644657f},
-std::array<float,2>{0.891684532f, 0.577541113f},
-std::array<float,2>{0.625973165f, 0.32536608f},
-std::array<float,2>{0.490604192f, 0.793251216f},
-std::array<float,2>{0.394531727f, 0.0878271386f},
-std::array<float,2>{0.694723248f, 0.628659785f},
-std::array<float,2>{0.953749776f, 0.466010004f},
-std::array<float,2>{0.000762269599f, 0.945061207f},
-std::array<float,2>{0.234127149f, 0.308743626f},
-std::array<float,2>{0.832732499f, 0.825833321f},
-std::array<float,2>{0.515331268f, 0.154711306f},
-std::array<float,2>{0.309199095f, 0.530072987f},
-std::array<float,2>{0.446260959f, 0.354863197f},
-std::array<float,2>{0.675255597f, 0.770415902f},
-std::array<float,2>{0.923884869f, 0.205138177f},
-std::array<float,2>{0.0996844396f, 0.596866369f},
-std::array<float,2>{0.168930352f, 0.0399231911f},
-std::array<float,2>{0.791508675f, 0.74976939f},
-std::array<float,2>{0.621225774f, 0.397591829f},
-std::array<float,2>{0.352638066f, 0.915592194f},
-std::array<float,2>{0.252970576f, 0.157694191f},
-std::array<float,2>{0.545410156f, 0.533269525f},
-std::array<float,2>{0.86493957f, 0.26139617f},
-std::array<float,2>{0.216021746f, 0.871392012f},
-std::array<float,2>{0.0597204342f, 0.482037246f},
-std::array<float,2>{0.981509745f, 0.998858035f},
-std::array<float,2>{0.725460708f, 0.118065223f},
-std::array<float,2>{0.428138465f, 0.67879045f},
-std::array<float,2>{0.418276846f, 0.442047209f},
-std::array<float,2>{0.735049844f, 0.965133309f},
-std::array<float,2>{0.997500062f, 0.0767331719f},
-std::array<float,2>{0.0405974574f, 0.649839103f},
-std::array<float,2>{0.196046203f, 0.138650671f},
-std::array<float,2>{0.85272032f, 0.51023829f},
-std::array<float,2>{0.549075007f, 0.283213705f},
-std::array<float,2>{0.279842496f, 0.838518262f},
-std::array<float,2>{0.374371588f, 0.021242857f},
-std::array<float,2>{0.59850812f, 0.708105564f},
-std::array<float,2>{0.80601871f, 0.422675014f},
-std::array<float,2>{0.182024017f, 0.88276732f},
-std::array<float,2>{0.123148143f, 0.335235327f},
-std::array<float,2>{0.91349107f, 0.808031499f},
-std::array<float,2>{0.667659104f, 0.221714646f},
-std::array<float,2>{0.468402505f, 0.584881842f},
-std::array<float,2>{0.296087384f, 0.277220041f},
-std::array<float,2>{0.522334754f, 0.853880942f},
-std::array<float,2>{0.816393554f, 0.179870993f},
-std::array<float,2>{0.246946365f, 0.559505999f},
-std::array<float,2>{0.0207905397f, 0.0968352482f},
-std::array<float,2>{0.938381851f, 0.656925738f},
-std::array<float,2>{0.703810155f, 0.49389866f},
-std::array<float,2>{0.383050621f, 0.974689603f},
-std::array<float,2>{0.472302228f, 0.189071223f},
-std::array<float,2>{0.651733398f, 0.614408016f},
-std::array<float,2>{0.888766527f, 0.371769577f},
-std::array<float,2>{0.0873284861f, 0.751248777f},
-std::array<float,2>{0.135769844f, 0.379962415f},
-std::array<float,2>{0.7521438f, 0.936510205f},
-std::array<float,2>{0.592845678f, 0.0561259277f},
-std::array<float,2>{0.333802402f, 0.725184798f},
-std::array<float,2>{0.307123721f, 0.384092063f},
-std::array<float,2>{0.508153677f, 0.929110765f},
-std::array<float,2>{0.832005501f, 0.0493984558f},
-std::array<float,2>{0.227168277f, 0.732159495f},
-std::array<float,2>{0.00471075391f, 0.202532664f},
-std::array<float,2>{0.960339487f, 0.617724776f},
-std::array<float,2>{0.690305054f, 0.364121377f},
-std::array<float,2>{0.39113f, 0.764356554f},
-std::array<float,2>{0.484570682f, 0.101917721f},
-std::array<float,2>{0.631117821f, 0.669970632f},
-std::array<float,2>{0.898346901f, 0.492087215f},
-std::array<float,2>{0.0672566816f, 0.984233022f},
-std::array<float,2>{0.15289925f, 0.268816948f},
-std::array<float,2>{0.768669486f, 0.847069919f},
-std::array<float,2>{0.567501128f, 0.174360856f},
-std::array<float,2>{0.314128578f, 0.550833821f},
-std::array<float,2>{0.425019443f, 0.339434803f},
-std::array<float,2>{0.721314311f, 0.802379787f},
-std::array<float,2>{0.977890372f, 0.230504677f},
-std::array<float,2>{0.0551355556f, 0.590967417f},
-std::array<float,2>{0.211375192f, 0.0295849051f},
-std::array<float,2>{0.862057447f, 0.713708341f},
-std::array<float,2>{0.542055428f, 0.42993921f},
-std::array<float,2>{0.254107088f, 0.887314737f},
-std::array<float,2>{0.359184086f, 0.129187211f},
-std::array<float,2>{0.619106472f, 0.504706979f},
-std::array<float,2>{0.794400394f, 0.292639136f},
-std::array<float,2>{0.164315745f, 0.835247874f},
-std::array<float,2>{0.0964669287f, 0.447669864f},
-std::array<float,2>{0.926668525f, 0.959783733f},
-std::array<float,2>{0.678670824f, 0.0696151927f},
-std::array<float,2>{0.449438721f, 0.64247489f},
-std::array<float,2>{0.46248889f, 0.476293236f},
-std::array<float,2>{0.669636369f, 0.992013574f},
-std::array<float,2>{0.90664196f, 0.110632494f},
-std::array<float,2>{0.117255956f, 0.682890713f},
-std::array<float,2>{0.186001927f, 0.171398684f},
-std::array<float,2>{0.810021162f, 0.542854369f},
-std::array<float,2>{0.595574498f, 0.256484628f},
-std::array<float,2>{0.368299097f, 0.866828442f},
-std::array<float,2>{0.274198592f, 0.0357381031f},
-std::array<float,2>{0.551231921f, 0.735173821f},
-std::array<float,2>{0.858164191f, 0.398728341f},
-std::array<float,2>{0.200845599f, 0.911318064f},
-std::array<float,2>{0.0458527245f, 0.350844622f},
-std::array<float,2>{0.99372673f, 0.776721656f},
-std::array<float,2>{0.739688039f, 0.212443814f},
-std::array<float,2>{0.416675866f, 0.603965104f},
-std::array<float,2>{0.328972787f, 0.303586662f},
-std::array<float,2>{0.589079678f, 0.812788248f},
-std::array<float,2>{0.756380379f, 0.147368789f},
-std::array<float,2>{0.138164818f, 0.51689738f},
-std::array<float,2>{0.0904160962f, 0.0827840343f},
-std::array<float,2>{0.885124564f, 0.633242071f},
-std::array<float,2>{0.654240608f, 0.459443927f},
-std::array<float,2>{0.475608915f, 0.952091396f},
-std::array<float,2>{0.389871657f, 0.245947957f},
-std::array<float,2>{0.709648967f, 0.565283179f},
-std::array<float,2>{0.942016244f, 0.314842969f},
-std::array<float,2>{0.0168910865f, 0.784620762f},
-std::array<float,2>{0.243543774f, 0.419541806f},
-std::array<float,2>{0.816838264f, 0.904053032f},
-std::array<float,2>{0.518632114f, 0.00983539037f},
-std::array<float,2>{0.291333318f, 0.698192716f},
-std::array<float,2>{0.363838494f, 0.461302519f},
-std::array<float,2>{0.608381331f, 0.940969348f},
-std::array<float,2>{0.802601695f, 0.0935244188f},
-std::array<float,2>{0.176908851f, 0.630302191f},
-std::array<float,2>{0.109803431f, 0.149908707f},
-std::array<float,2>{0.914089561f, 0.523579538f},
-std::array<float,2>{0.660279095f, 0.306537539f},
-std::array<float,2>{0.455553085f, 0.820432544f},
-std::array<float,2>{0.411117196f, 0.00208870019f},
-std::array<float,2>{0.744280279f, 0.690641582f},
-std::array<float,2>{0.988239169f, 0.41302219f},
-std::array<float,2>{0.0390563384f, 0.890655816f},
-std::array<float,2>{0.189955533f, 0.32117638f},
-std::array<float,2>{0.848638475f, 0.789993525f},
-std::array<float,2>{0.55911082f, 0.240963221f},
-std::array<float,2>{0.268533885f, 0.571436524f},
-std::array<float,2>{0.478033155f, 0.264512151f},
-std::array<float,2>{0.646739125f, 0.869752765f},
-std::array<float,2>{0.877567589f, 0.162852973f},
-std::array<float,2>{0.0825992897f, 0.535873771f},
-std::array<float,2>{0.128718376f, 0.12496721f},
-std::array<float,2>{0.758240521f, 0.675651491f},
-std::array<float,2>{0.583133936f, 0.478063524f},
-std::array<float,2>{0.339532942f, 0.992904127f},
-std::array<float,2>{0.285843551f, 0.209551141f},
-std::array<float,2>{0.527137995f, 0.598046243f},
-std::array<float,2>{0.823146462f, 0.357781202f},
-std::array<float,2>{0.236394748f, 0.767521262f},
-std::array<float,2>{0.0257377345f, 0.392107278f},
-std::array<float,2>{0.951400757f, 0.92059809f},
-std::array<float,2>{0.714930952f, 0.0458988994f},
-std::array<float,2>{0.382212609f, 0.745757282f},
-std::array<float,2>{0.400969654f, 0.427122235f},
-std::array<float,2>{0.700186849f, 0.876565337f},
-std::array<float,2>{0.967432618f, 0.0171909723f},
-std::array<float,2>{0.0110394238f, 0.706678987f},
-std::array<float,2>{0.221596882f, 0.223547399f},
-std::array<float,2>{0.837350845f, 0.580468893f},
-std::array<float,2>{0.504448831f, 0.331651956f},
-std::array<float,2>{0.29952988f, 0.80922395f},
-std::array<float,2>{0.323260158f, 0.0712659732f},
-std::array<float,2>{0.574007273f, 0.652387023f},
-std::array<float,2>{0.773564339f, 0.440196693f},
-std::array<float,2>{0.142279804f, 0.964674294f},
-std::array<float,2>{0.0751318261f, 0.287494063f},
-std::array<float,2>{0.903301775f, 0.843550026f},
-std::array<float,2>{0.637532532f, 0.135076463f},
-std::array<float,2>{0.498554558f, 0.511777461f},
-std::array<float,2>{0.260873258f, 0.368327975f},
-std::array<float,2>{0.535728753f, 0.757784903f},
-std::array<float,2>{0.871617138f, 0.193132415f},
-std::array<float,2>{0.206203893f, 0.612295866f},
-std::array<float,2>{0.0535763837f, 0.0599875152f},
-std::array<float,2>{0.972045004f, 0.72064513f},
-std::array<float,2>{0.731764078f, 0.376472324f},
-std::array<float,2>{0.437461346f, 0.929760337f},
-std::array<float,2>{0.441135496f, 0.185992301f},
-std::array<float,2>{0.685945749f, 0.555369258f},
-std::array<float,2>{0.930519819f, 0.278621972f},
-std::array<float,2>{0.106654026f, 0.858108222f},
-std::array<float,2>{0.160666093f, 0.498388797f},
-std::array<float,2>{0.781775951f, 0.970764995f},
-std::array<float,2>{0.612876415f, 0.100974016f},
-std::array<float,2>{0.345800847f, 0.661414623f},
-std::array<float,2>{0.283001781f, 0.452069759f},
-std::array<float,2>{0.529834628f, 0.956769049f},
-std::array<float,2>{0.825259626f, 0.0647433996f},
-std::array<float,2>{0.238556892f, 0.646529853f},
-std::array<float,2>{0.0310475547f, 0.128635064f},
-std::array<float,2>{0.946288466f, 0.502840638f},
-std::array<float,2>{0.713651538f, 0.295966864f},
-std::array<float,2>{0.376854897f, 0.829382598f},
-std::array<float,2>{0.480634838f, 0.0237571057f},
-std::array<float,2>{0.644527435f, 0.715257585f},
-std::array<float,2>{0.882563114f, 0.434713036f},
-std::array<float,2>{0.0791110545f, 0.883039534f},
-std::array<float,2>{0.129784465f, 0.340062499f},
-std::array<float,2>{0.765291691f, 0.799213946f},
-std::array<float,2>{0.578790188f, 0.229741886f},
-std::array<float,2>{0.342278868f, 0.588174641f},
-std::array<float,2>{0.410003543f, 0.269555986f},
-std::array<float,2>{0.746297061f, 0.848350644f},
-std::array<float,2>{0.989511132f, 0.179204211f},
-std::array<float,2>{0.0337287821f, 0.547253847f},
-std::array<float,2>{0.194674924f, 0.105960786f},
-std::array<float,2>{0.845692873f, 0.666232347f},
-std::array<float,2>{0.557145834f, 0.484874666f},
-std::array<float,2>{0.272049367f, 0.978891015f},
-std::array<float,2>{0.361185431f, 0.198032543f},
-std::array<float,2>{0.603433847f, 0.62488544f},
-std::array<float,2>{0.79729408f, 0.359820783f},
-std::array<float,2>{0.172898263f, 0.761040628f},
-std::array<float,2>{0.114361651f, 0.390412241f},
-std::array<float,2>{0.920663059f, 0.924962461f},
-std::array<float,2>{0.656538367f, 0.0520568341f},
-std::array<float,2>{0.457496405f, 0.729521871f},
-std::array<float,2>{0.445176542f, 0.417596519f},
-std::array<float,2>{0.680076897f, 0.89915961f},
-std::array<float,2>{0.935287774f, 0.014098417f},
-std::array<float,2>{0.102205701f, 0.700711071f},
-std::array<float,2>{0.156398535f, 0.247240886f},
-std::array<float,2>{0.787573636f, 0.569384694f},
-std::array<float,2>{0.615803778f, 0.319981307f},
-std::array<float,2>{0.349758506f, 0.786924958f},
-std::array<float,2>{0.265008777f, 0.0798019171f},
-std::array<float,2>{0.532141328f, 0.637868583f},
-std::array<float,2>{0.868509889f, 0.456754804f},
-std::array<float,2>{0.209532186f, 0.94555372f},
-std::array<float,2>{0.0492975153f, 0.298256308f},
-std::array<float,2>{0.973747373f, 0.818227947f},
-std::array<float,2>{0.727607906f, 0.144246668f},
-std::array<float,2>{0.430085182f, 0.522195876f},
-std::array<float,2>{0.325727046f, 0.344682038f},
-std::array<float,2>{0.574452698f, 0.781199336f},
-std::array<float,2>{0.780648828f, 0.218054771f},
-std::array<float,2>{0.145136878f, 0.608898163f},
-std::array<float,2>{0.07378719f, 0.0330681652f},
-std::array<float,2>{0.901229441f, 0.738633037f},
-std::array<float,2>{0.633069992f, 0.402753741f},
-std::array<float,2>{0.492912203f, 0.906552017f},
-std::array<float,2>{0.403253585f, 0.164532587f},
-std::array<float,2>{0.696410894f, 0.546678305f},
-std::array<float,2>{0.962660432f, 0.25360173f},
-std::array<float,2>{0.0153037151f, 0.859680235f},
-std::array<float,2>{0.224961817f, 0.472120672f},
-std::array<float,2>{0.842179656f, 0.986234844f},
-std::array<float,2>{0.503628016f, 0.116919205f},
-std::array<float,2>{0.303053617f, 0.686309636f},
-std::array<float,2>{0.355026275f, 0.394557834f},
-std::array<float,2>{0.623994172f, 0.917382777f},
-std::array<float,2>{0.790406823f, 0.041929502f},
-std::array<float,2>{0.170920581f, 0.746914506f},
-std::array<float,2>{0.0976734012f, 0.203591496f},
-std::array<float,2>{0.923115492f, 0.594408512f},
-std::array<float,2>{0.67367661f, 0.352038056f},
-std::array<float,2>{0.448827684f, 0.772565007f},
-std::array<float,2>{0.426343232f, 0.120490469f},
-std::array<float,2>{0.724428892f, 0.676906943f},
-std::array<float,2>{0.984104395f, 0.483589262f},
-std::array<float,2>{0.0615365244f, 0.997910917f},
-std::array<float,2>{0.218607187f, 0.258838981f},
-std::array<float,2>{0.866306782f, 0.873403192f},
-std::array<float,2>{0.543483853f, 0.15958029f},
-std::array<float,2>{0.251469523f, 0.531833231f},
-std::array<float,2>{0.488856196f, 0.32619077f},
-std::array<float,2>{0.627636611f, 0.796204388f},
-std::array<float,2>{0.892795324f, 0.235093683f},
-std::array<float,2>{0.0644797757f, 0.575905621f},
-std::array<float,2>{0.150589943f, 0.00532491552f},
-std::array<float,2>{0.771596372f, 0.695248425f},
-std::array<float,2>{0.564907789f, 0.409152091f},
-std::array<float,2>{0.316672444f, 0.896460474f},
-std::array<float,2>{0.312174052f, 0.153445423f},
-std::array<float,2>{0.512902439f, 0.528210402f},
-std::array<float,2>{0.8347947f, 0.311266124f},
-std::array<float,2>{0.230982155f, 0.827640235f},
-std::array<float,2>{0.00336986221f, 0.468071669f},
-std::array<float,2>{0.955484211f, 0.941455185f},
-std::array<float,2>{0.692574501f, 0.0886519179f},
-std::array<float,2>{0.398029774f, 0.625909448f},
-std::array<float,2>{0.385919452f, 0.494664848f},
-std::array<float,2>{0.706127346f, 0.973934054f},
-std::array<float,2>{0.939617932f, 0.0941094458f},
-std::array<float,2>{0.0219688602f, 0.659157276f},
-std::array<float,2>{0.249323934f, 0.183071718f},
-std::array<float,2>{0.814066529f, 0.561829209f},
-std::array<float,2>{0.520758152f, 0.274474829f},
-std::array<float,2>{0.293466538f, 0.853474259f},
-std::array<float,2>{0.335704297f, 0.0582998693f},
-std::array<float,2>{0.591716945f, 0.723072767f},
-std::array<float,2>{0.7507236f, 0.382021815f},
-std::array<float,2>{0.133275986f, 0.934714675f},
-std::array<float,2>{0.088944003f, 0.373962462f},
-std::array<float,2>{0.887511015f, 0.752326071f},
-std::array<float,2>{0.650382161f, 0.189836189f},
-std::array<float,2>{0.470132142f, 0.616453409f},
-std::array<float,2>{0.278077215f, 0.28174907f},
-std::array<float,2>{0.548042595f, 0.836915374f},
-std::array<float,2>{0.85481894f, 0.139331177f},
-std::array<float,2>{0.198436081f, 0.508306682f},
-std::array<float,2>{0.0417106412f, 0.075588271f},
-std::array<float,2>{0.998226881f, 0.651588857f},
-std::array<float,2>{0.736425161f, 0.444403917f},
-std::array<float,2>{0.420747578f, 0.967155159f},
-std::array<float,2>{0.465425223f, 0.218894243f},
-std::array<float,2>{0.664610744f, 0.582527995f},
-std::array<float,2>{0.911089838f, 0.333832026f},
-std::array<float,2>{0.121885777f, 0.805621564f},
-std::array<float,2>{0.180935979f, 0.425670177f},
-std::array<float,2>{0.807696462f, 0.879251778f},
-std::array<float,2>{0.599900663f, 0.0226638783f},
-std::array<float,2>{0.372630626f, 0.710380673f},
-std::array<float,2>{0.257003576f, 0.433194607f},
-std::array<float,2>{0.539568126f, 0.889549851f},
-std::array<float,2>{0.860916078f, 0.0277096257f},
-std::array<float,2>{0.214178905f, 0.711757779f},
-std::array<float,2>{0.0574684218f, 0.234261677f},
-std::array<float,2>{0.980423093f, 0.592734218f},
-std::array<float,2>{0.719359696f, 0.337621301f},
-std::array<float,2>{0.42341733f, 0.802931726f},
-std::array<float,2>{0.452999949f, 0.0677576959f},
-std::array<float,2>{0.675921321f, 0.643518209f},
-std::array<float,2>{0.927822351f, 0.445850939f},
-std::array<float,2>{0.0954058543f, 0.958250225f},
-std::array<float,2>{0.166842312f, 0.290027022f},
-std::array<float,2>{0.796057105f, 0.833700061f},
-std::array<float,2>{0.619974911f, 0.131246224f},
-std::array<float,2>{0.357387513f, 0.5065763f},
-std::array<float,2>{0.393446147f, 0.36575076f},
-std::array<float,2>{0.688787997f, 0.762113214f},
-std::array<float,2>{0.957968354f, 0.200539187f},
-std::array<float,2>{0.00704847137f, 0.620425403f},
-std::array<float,2>{0.23001273f, 0.0476385988f},
-std::array<float,2>{0.829328299f, 0.733477056f},
-std::array<float,2>{0.511658967f, 0.384932071f},
-std::array<float,2>{0.306539059f, 0.926492631f},
-std::array<float,2>{0.31566295f, 0.173413426f},
-std::array<float,2>{0.568982661f, 0.553915381f},
-std::array<float,2>{0.766046047f, 0.266448706f},
-std::array<float,2>{0.155354261f, 0.843756139f},
-std::array<float,2>{0.0689755455f, 0.490200698f},
-std::array<float,2>{0.895920455f, 0.982403994f},
-std::array<float,2>{0.629084468f, 0.103955306f},
-std::array<float,2>{0.487584889f, 0.669005036f},
-std::array<float,2>{0.474031389f, 0.457898498f},
-std::array<float,2>{0.6559183f, 0.950686812f},
-std::array<float,2>{0.883829355f, 0.0840973184f},
-std::array<float,2>{0.093455255f, 0.634930611f},
-std::array<float,2>{0.139689237f, 0.145621479f},
-std::array<float,2>{0.754995286f, 0.518203497f},
-std::array<float,2>{0.587275267f, 0.301040381f},
-std::array<float,2>{0.331952125f, 0.815803707f},
-std::array<float,2>{0.289525837f, 0.00870278198f},
-std::array<float,2>{0.516118884f, 0.695870876f},
-std::array<float,2>{0.819380999f, 0.420692742f},
-std::array<float,2>{0.244184911f, 0.904469252f},
-std::array<float,2>{0.0181739219f, 0.313569725f},
-std::array<float,2>{0.943705797f, 0.781354189f},
-std::array<float,2>{0.708455086f, 0.243706152f},
-std::array<float,2>{0.387703061f, 0.562997878f},
-std::array<float,2>{0.369205922f, 0.254118383f},
-std::array<float,2>{0.595857561f, 0.864822984f},
-std::array<float,2>{0.811522841f, 0.169253051f},
-std::array<float,2>{0.184500024f, 0.540608168f},
-std::array<float,2>{0.12099836f, 0.111629955f},
-std::array<float,2>{0.90930748f, 0.681321204f},
-std::array<float,2>{0.670571923f, 0.472975582f},
-std::array<float,2>{0.463488162f, 0.988619745f},
-std::array<float,2>{0.414743066f, 0.212989345f},
-std::array<float,2>{0.740805864f, 0.602705479f},
-std::array<float,2>{0.996065378f, 0.348181635f},
-std::array<float,2>{0.0429708734f, 0.77425313f},
-std::array<float,2>{0.202592567f, 0.400463313f},
-std::array<float,2>{0.857394934f, 0.913345039f},
-std::array<float,2>{0.552907705f, 0.0374639779f},
-std::array<float,2>{0.276831925f, 0.737113118f},
-std::array<float,2>{0.3368164f, 0.479862809f},
-std::array<float,2>{0.584661186f, 0.995396852f},
-std::array<float,2>{0.761525512f, 0.121996209f},
-std::array<float,2>{0.125078648f, 0.672754049f},
-std::array<float,2>{0.0857062936f, 0.161343142f},
-std::array<float,2>{0.876919687f, 0.537804008f},
-std::array<float,2>{0.646087646f, 0.263042986f},
-std::array<float,2>{0.479254007f, 0.868259788f},
-std::array<float,2>{0.379495621f, 0.0441902131f},
-std::array<float,2>{0.716998339f, 0.743586957f},
-std::array<float,2>{0.950761974f, 0.393823177f},
-std::array<float,2>{0.0246601664f, 0.919496894f},
-std::array<float,2>{0.235477552f, 0.357247233f},
-std::array<float,2>{0.82161516f, 0.769360125f},
-std::array<float,2>{0.524627686f, 0.208405927f},
-std::array<float,2>{0.288496971f, 0.600241899f},
-std::array<float,2>{0.454559356f, 0.306970954f},
-std::array<float,2>{0.662556231f, 0.822585881f},
-std::array<float,2>{0.917461395f, 0.1513592f},
-std::array<float,2>{0.113103941f, 0.525410354f},
-std::array<float,2>{0.177993566f, 0.0909420624f},
-std::array<float,2>{0.804444194f, 0.632519066f},
-std::array<float,2>{0.606287777f, 0.46459192f},
-std::array<float,2>{0.365710169f, 0.937605083f},
-std::array<float,2>{0.266964227f, 0.238500908f},
-std::array<float,2>{0.562248409f, 0.57330054f},
-std::array<float,2>{0.851317108f, 0.32268697f},
-std::array<float,2>{0.189260557f, 0.792929173f},
-std::array<float,2>{0.0369662829f, 0.410922676f},
-std::array<float,2>{0.984761894f, 0.89317441f},
-std::array<float,2>{0.742677331f, 0.000630683615f},
-std::array<float,2>{0.412200481f, 0.687550008f},
-std::array<float,2>{0.433795363f, 0.378141731f},
-std::array<float,2>{0.732864678f, 0.932274222f},
-std::array<float,2>{0.970666647f, 0.0612092242f},
-std::array<float,2>{0.0518347174f, 0.722467482f},
-std::array<float,2>{0.20443441f, 0.193466797f},
-std::array<float,2>{0.873288751f, 0.609931409f},
-std::array<float,2>{0.538846374f, 0.369202405f},
-std::array<float,2>{0.258515894f, 0.754500628f},
-std::array<float,2>{0.343897492f, 0.0981224254f},
-std::array<float,2>{0.610758185f, 0.662249327f},
-std::array<float,2>{0.783507466f, 0.497773021f},
-std::array<float,2>{0.16223827f, 0.969444692f},
-std::array<float,2>{0.108686872f, 0.280154318f},
-std::array<float,2>{0.932137489f, 0.855919838f},
-std::array<float,2>{0.685537219f, 0.183861822f},
-std::array<float,2>{0.43818152f, 0.55691129f},
-std::array<float,2>{0.297042459f, 0.330038935f},
-std::array<float,2>{0.507635057f, 0.811665893f},
-std::array<float,2>{0.838922679f, 0.226412371f},
-std::array<float,2>{0.219731838f, 0.580017924f},
-std::array<float,2>{0.00932899863f, 0.0192989614f},
-std::array<float,2>{0.966051459f, 0.70499897f},
-std::array<float,2>{0.702620149f, 0.428194433f},
-std::array<float,2>{0.400122851f, 0.878712416f},
-std::array<float,2>{0.497384787f, 0.133539468f},
-std::array<float,2>{0.63924706f, 0.513850391f},
-std::array<float,2>{0.905165732f, 0.285910308f},
-std::array<float,2>{0.07692267f, 0.841408134f},
-std::array<float,2>{0.142639592f, 0.437763929f},
-std::array<float,2>{0.776865244f, 0.961907744f},
-std::array<float,2>{0.570437729f, 0.072827749f},
-std::array<float,2>{0.322129458f, 0.654875576f}}
\ No newline at end of file
@@ -1,4096 +0,0 @@
-{std::array<float,2>{0.968471766f, 0.954729915f},
-std::array<float,2>{0.0890100971f, 0.28394267f},
-std::array<float,2>{0.704655051f, 0.234741583f},
-std::array<float,2>{0.431101531f, 0.606163502f},
-std::array<float,2>{0.57567203f, 0.694180012f},
-std::array<float,2>{0.34748733f, 0.0281460639f},
-std::array<float,2>{0.797708035f, 0.483027786f},
-std::array<float,2>{0.236696199f, 0.794268548f},
-std::array<float,2>{0.855870903f, 0.516279757f},
-std::array<float,2>{0.154401109f, 0.162275136f},
-std::array<float,2>{0.531344473f, 0.32228592f},
-std::array<float,2>{0.275097936f, 0.909057558f},
-std::array<float,2>{0.641509593f, 0.828913987f},
-std::array<float,2>{0.498284191f, 0.396357745f},
-std::array<float,2>{0.894129217f, 0.101019241f},
-std::array<float,2>{0.000519138121f, 0.669944644f},
-std::array<float,2>{0.766817749f, 0.763871968f},
-std::array<float,2>{0.205185741f, 0.446653992f},
-std::array<float,2>{0.594113529f, 0.0334257968f},
-std::array<float,2>{0.326652586f, 0.74136734f},
-std::array<float,2>{0.724027395f, 0.575718343f},
-std::array<float,2>{0.393652618f, 0.194457322f},
-std::array<float,2>{0.987588465f, 0.251210421f},
-std::array<float,2>{0.099081479f, 0.988366604f},
-std::array<float,2>{0.906830311f, 0.651939094f},
-std::array<float,2>{0.0363879278f, 0.090901643f},
-std::array<float,2>{0.669360876f, 0.42111811f},
-std::array<float,2>{0.448694676f, 0.872827649f},
-std::array<float,2>{0.517352462f, 0.877890706f},
-std::array<float,2>{0.281632662f, 0.35123378f},
-std::array<float,2>{0.826013684f, 0.13581568f},
-std::array<float,2>{0.180605814f, 0.561115503f},
-std::array<float,2>{0.882851481f, 0.845399261f},
-std::array<float,2>{0.0187410638f, 0.433530927f},
-std::array<float,2>{0.632597446f, 0.070444338f},
-std::array<float,2>{0.474319875f, 0.630772769f},
-std::array<float,2>{0.562260807f, 0.540720165f},
-std::array<float,2>{0.250323057f, 0.145541742f},
-std::array<float,2>{0.867920399f, 0.362052411f},
-std::array<float,2>{0.132175282f, 0.905811369f},
-std::array<float,2>{0.789353192f, 0.719621181f},
-std::array<float,2>{0.219562396f, 0.0532869212f},
-std::array<float,2>{0.588790059f, 0.468038142f},
-std::array<float,2>{0.363375247f, 0.774025977f},
-std::array<float,2>{0.697806418f, 0.978152215f},
-std::array<float,2>{0.41646862f, 0.273935258f},
-std::array<float,2>{0.94816035f, 0.20750396f},
-std::array<float,2>{0.0636502057f, 0.58916235f},
-std::array<float,2>{0.834425032f, 0.937292218f},
-std::array<float,2>{0.161050633f, 0.33805716f},
-std::array<float,2>{0.502871394f, 0.183765009f},
-std::array<float,2>{0.299927324f, 0.512478769f},
-std::array<float,2>{0.678885639f, 0.674337626f},
-std::array<float,2>{0.457505435f, 0.120261207f},
-std::array<float,2>{0.923746407f, 0.383944482f},
-std::array<float,2>{0.0584036559f, 0.821331561f},
-std::array<float,2>{0.972253919f, 0.622332811f},
-std::array<float,2>{0.117469907f, 0.232771084f},
-std::array<float,2>{0.74665314f, 0.307154894f},
-std::array<float,2>{0.377357215f, 0.943131864f},
-std::array<float,2>{0.619726777f, 0.804685712f},
-std::array<float,2>{0.333715945f, 0.492182493f},
-std::array<float,2>{0.755970776f, 0.00325118867f},
-std::array<float,2>{0.198914379f, 0.703611076f},
-std::array<float,2>{0.934740007f, 0.895257294f},
-std::array<float,2>{0.0544467047f, 0.369437069f},
-std::array<float,2>{0.683603227f, 0.152036324f},
-std::array<float,2>{0.467516661f, 0.535036862f},
-std::array<float,2>{0.514326036f, 0.636161685f},
-std::array<float,2>{0.307043284f, 0.0658817217f},
-std::array<float,2>{0.84127748f, 0.428958684f},
-std::array<float,2>{0.164570361f, 0.859367669f},
-std::array<float,2>{0.759813607f, 0.580030262f},
-std::array<float,2>{0.191709906f, 0.215659931f},
-std::array<float,2>{0.613138199f, 0.269637495f},
-std::array<float,2>{0.33611989f, 0.974450409f},
-std::array<float,2>{0.738645077f, 0.769081712f},
-std::array<float,2>{0.389826268f, 0.456275761f},
-std::array<float,2>{0.978112221f, 0.055423215f},
-std::array<float,2>{0.110519327f, 0.729960084f},
-std::array<float,2>{0.866818964f, 0.817045867f},
-std::array<float,2>{0.140122309f, 0.379375011f},
-std::array<float,2>{0.54919678f, 0.114477135f},
-std::array<float,2>{0.265078783f, 0.686498821f},
-std::array<float,2>{0.638005614f, 0.500187516f},
-std::array<float,2>{0.481411874f, 0.176760197f},
-std::array<float,2>{0.878070891f, 0.331558794f},
-std::array<float,2>{0.0310076699f, 0.922477007f},
-std::array<float,2>{0.9435184f, 0.713694513f},
-std::array<float,2>{0.0748737529f, 0.00870058127f},
-std::array<float,2>{0.69010812f, 0.496783078f},
-std::array<float,2>{0.411733657f, 0.81211102f},
-std::array<float,2>{0.585521758f, 0.950937927f},
-std::array<float,2>{0.36838913f, 0.299217045f},
-std::array<float,2>{0.784346879f, 0.223201945f},
-std::array<float,2>{0.228361428f, 0.609982014f},
-std::array<float,2>{0.993421435f, 0.78543222f},
-std::array<float,2>{0.103699446f, 0.473319083f},
-std::array<float,2>{0.733343363f, 0.0209348612f},
-std::array<float,2>{0.39948523f, 0.702804804f},
-std::array<float,2>{0.60283792f, 0.597670913f},
-std::array<float,2>{0.314133257f, 0.242328107f},
-std::array<float,2>{0.774658859f, 0.289732873f},
-std::array<float,2>{0.218648359f, 0.963732421f},
-std::array<float,2>{0.814598143f, 0.658645272f},
-std::array<float,2>{0.174160883f, 0.107405104f},
-std::array<float,2>{0.527886629f, 0.405843288f},
-std::array<float,2>{0.291493714f, 0.840447187f},
-std::array<float,2>{0.663863659f, 0.914847016f},
-std::array<float,2>{0.438489437f, 0.315881014f},
-std::array<float,2>{0.915995896f, 0.167371616f},
-std::array<float,2>{0.0425133072f, 0.525127709f},
-std::array<float,2>{0.804947078f, 0.996010065f},
-std::array<float,2>{0.248753279f, 0.259824455f},
-std::array<float,2>{0.566452384f, 0.200365543f},
-std::array<float,2>{0.351611584f, 0.569356084f},
-std::array<float,2>{0.717139721f, 0.74360013f},
-std::array<float,2>{0.423799425f, 0.0397694074f},
-std::array<float,2>{0.960238338f, 0.443364412f},
-std::array<float,2>{0.0809904858f, 0.757441878f},
-std::array<float,2>{0.899791241f, 0.550434113f},
-std::array<float,2>{0.0128117921f, 0.128868833f},
-std::array<float,2>{0.650784016f, 0.354982853f},
-std::array<float,2>{0.48810333f, 0.88521111f},
-std::array<float,2>{0.544045687f, 0.865279257f},
-std::array<float,2>{0.267072201f, 0.408192456f},
-std::array<float,2>{0.8501724f, 0.0799728036f},
-std::array<float,2>{0.14280732f, 0.647323132f},
-std::array<float,2>{0.981686532f, 0.910364211f},
-std::array<float,2>{0.114624538f, 0.325203449f},
-std::array<float,2>{0.73751241f, 0.159433499f},
-std::array<float,2>{0.382977664f, 0.519966662f},
-std::array<float,2>{0.614922047f, 0.665460587f},
-std::array<float,2>{0.343511522f, 0.0945774317f},
-std::array<float,2>{0.764847219f, 0.391141891f},
-std::array<float,2>{0.190317169f, 0.835180998f},
-std::array<float,2>{0.83775562f, 0.603137136f},
-std::array<float,2>{0.168885008f, 0.23916319f},
-std::array<float,2>{0.509922564f, 0.287478119f},
-std::array<float,2>{0.312334627f, 0.960819483f},
-std::array<float,2>{0.680772066f, 0.790167093f},
-std::array<float,2>{0.461426526f, 0.479028374f},
-std::array<float,2>{0.933234751f, 0.024273036f},
-std::array<float,2>{0.0493080653f, 0.68758148f},
-std::array<float,2>{0.787852049f, 0.867795169f},
-std::array<float,2>{0.231232882f, 0.416124195f},
-std::array<float,2>{0.58143419f, 0.0867967755f},
-std::array<float,2>{0.371408701f, 0.654022098f},
-std::array<float,2>{0.69417119f, 0.556012511f},
-std::array<float,2>{0.407287925f, 0.139098272f},
-std::array<float,2>{0.937668502f, 0.345581949f},
-std::array<float,2>{0.0704123452f, 0.881372273f},
-std::array<float,2>{0.879836261f, 0.737701654f},
-std::array<float,2>{0.0246902071f, 0.0372689515f},
-std::array<float,2>{0.635004401f, 0.450722814f},
-std::array<float,2>{0.478631377f, 0.761681914f},
-std::array<float,2>{0.550867856f, 0.986097753f},
-std::array<float,2>{0.261698246f, 0.255849332f},
-std::array<float,2>{0.861994505f, 0.188708544f},
-std::array<float,2>{0.136188403f, 0.573834658f},
-std::array<float,2>{0.918434262f, 0.780847192f},
-std::array<float,2>{0.0459405817f, 0.461575955f},
-std::array<float,2>{0.658694863f, 0.0491978563f},
-std::array<float,2>{0.444916278f, 0.726266086f},
-std::array<float,2>{0.526335418f, 0.591326833f},
-std::array<float,2>{0.293389946f, 0.204968825f},
-std::array<float,2>{0.818272173f, 0.28026107f},
-std::array<float,2>{0.177030593f, 0.980948448f},
-std::array<float,2>{0.778030872f, 0.625339925f},
-std::array<float,2>{0.214032829f, 0.0763736442f},
-std::array<float,2>{0.607642114f, 0.435788453f},
-std::array<float,2>{0.318433672f, 0.849292099f},
-std::array<float,2>{0.729744732f, 0.900185585f},
-std::array<float,2>{0.405014277f, 0.364892125f},
-std::array<float,2>{0.997991264f, 0.142903924f},
-std::array<float,2>{0.107327819f, 0.545978844f},
-std::array<float,2>{0.845945299f, 0.94066292f},
-std::array<float,2>{0.147211671f, 0.310931027f},
-std::array<float,2>{0.540307105f, 0.228427678f},
-std::array<float,2>{0.272831678f, 0.619988203f},
-std::array<float,2>{0.652981937f, 0.708249271f},
-std::array<float,2>{0.489213288f, 0.00549490005f},
-std::array<float,2>{0.904437423f, 0.486579865f},
-std::array<float,2>{0.00960503053f, 0.79988879f},
-std::array<float,2>{0.953890383f, 0.509691119f},
-std::array<float,2>{0.0841952115f, 0.180535436f},
-std::array<float,2>{0.712565839f, 0.343135357f},
-std::array<float,2>{0.426992476f, 0.932294726f},
-std::array<float,2>{0.562525809f, 0.825004101f},
-std::array<float,2>{0.356996179f, 0.390463442f},
-std::array<float,2>{0.812370956f, 0.122390836f},
-std::array<float,2>{0.243458346f, 0.679375947f},
-std::array<float,2>{0.896449924f, 0.97082746f},
-std::array<float,2>{0.00448208069f, 0.268135607f},
-std::array<float,2>{0.646047175f, 0.213547274f},
-std::array<float,2>{0.494337887f, 0.583657205f},
-std::array<float,2>{0.537988722f, 0.732817471f},
-std::array<float,2>{0.281042606f, 0.0600919239f},
-std::array<float,2>{0.853067458f, 0.460308731f},
-std::array<float,2>{0.151941746f, 0.772729814f},
-std::array<float,2>{0.800905585f, 0.53711921f},
-std::array<float,2>{0.239334315f, 0.155955762f},
-std::array<float,2>{0.573581278f, 0.372544229f},
-std::array<float,2>{0.34906137f, 0.893365741f},
-std::array<float,2>{0.710629344f, 0.854466081f},
-std::array<float,2>{0.435586661f, 0.422679633f},
-std::array<float,2>{0.962916791f, 0.0684892386f},
-std::array<float,2>{0.092633523f, 0.63823086f},
-std::array<float,2>{0.822853684f, 0.807759821f},
-std::array<float,2>{0.185022354f, 0.495719403f},
-std::array<float,2>{0.521695614f, 0.0137169389f},
-std::array<float,2>{0.285728723f, 0.714951694f},
-std::array<float,2>{0.665114522f, 0.616827726f},
-std::array<float,2>{0.45131892f, 0.220883206f},
-std::array<float,2>{0.913340509f, 0.301115811f},
-std::array<float,2>{0.034137059f, 0.948299825f},
-std::array<float,2>{0.990148485f, 0.683326781f},
-std::array<float,2>{0.0949766263f, 0.112814844f},
-std::array<float,2>{0.719813645f, 0.37771073f},
-std::array<float,2>{0.396378607f, 0.814539015f},
-std::array<float,2>{0.601320267f, 0.92802316f},
-std::array<float,2>{0.32258448f, 0.333993047f},
-std::array<float,2>{0.772743821f, 0.172275111f},
-std::array<float,2>{0.210085213f, 0.506990135f},
-std::array<float,2>{0.952192128f, 0.837150097f},
-std::array<float,2>{0.069908902f, 0.401962906f},
-std::array<float,2>{0.702192485f, 0.101760678f},
-std::array<float,2>{0.421750158f, 0.661653399f},
-std::array<float,2>{0.592646658f, 0.531202078f},
-std::array<float,2>{0.360228628f, 0.17107676f},
-std::array<float,2>{0.79503274f, 0.316604435f},
-std::array<float,2>{0.222816005f, 0.91904074f},
-std::array<float,2>{0.874767482f, 0.698084176f},
-std::array<float,2>{0.125443131f, 0.0159805305f},
-std::array<float,2>{0.555541277f, 0.47180596f},
-std::array<float,2>{0.256603926f, 0.78486371f},
-std::array<float,2>{0.625200331f, 0.966286242f},
-std::array<float,2>{0.469813079f, 0.295645952f},
-std::array<float,2>{0.888488829f, 0.247606039f},
-std::array<float,2>{0.0217155553f, 0.596636951f},
-std::array<float,2>{0.75064671f, 0.89006412f},
-std::array<float,2>{0.203076929f, 0.355575025f},
-std::array<float,2>{0.624239504f, 0.131801039f},
-std::array<float,2>{0.331954926f, 0.554383993f},
-std::array<float,2>{0.74421066f, 0.641516507f},
-std::array<float,2>{0.378938794f, 0.0854364261f},
-std::array<float,2>{0.973367989f, 0.412183434f},
-std::array<float,2>{0.121722959f, 0.860620499f},
-std::array<float,2>{0.928983212f, 0.56413877f},
-std::array<float,2>{0.0612665899f, 0.195996851f},
-std::array<float,2>{0.673259437f, 0.265614957f},
-std::array<float,2>{0.453142643f, 0.998518705f},
-std::array<float,2>{0.507586718f, 0.751426578f},
-std::array<float,2>{0.303343117f, 0.437812865f},
-std::array<float,2>{0.831159413f, 0.0447715446f},
-std::array<float,2>{0.157935634f, 0.748177707f},
-std::array<float,2>{0.985049069f, 0.990585804f},
-std::array<float,2>{0.10065987f, 0.252868533f},
-std::array<float,2>{0.724621356f, 0.192676827f},
-std::array<float,2>{0.391508311f, 0.5777812f},
-std::array<float,2>{0.597196162f, 0.738316476f},
-std::array<float,2>{0.324985057f, 0.0312654115f},
-std::array<float,2>{0.768346906f, 0.449063748f},
-std::array<float,2>{0.203534886f, 0.762895405f},
-std::array<float,2>{0.826682568f, 0.560002744f},
-std::array<float,2>{0.182518408f, 0.133452699f},
-std::array<float,2>{0.518284678f, 0.349075466f},
-std::array<float,2>{0.28333506f, 0.875742137f},
-std::array<float,2>{0.671172738f, 0.873500049f},
-std::array<float,2>{0.446517408f, 0.418468386f},
-std::array<float,2>{0.909727693f, 0.091947563f},
-std::array<float,2>{0.0381468274f, 0.64933604f},
-std::array<float,2>{0.799063325f, 0.795487881f},
-std::array<float,2>{0.234763995f, 0.480877846f},
-std::array<float,2>{0.576496303f, 0.0300690606f},
-std::array<float,2>{0.34429583f, 0.692869067f},
-std::array<float,2>{0.705433726f, 0.608647287f},
-std::array<float,2>{0.433054954f, 0.23695904f},
-std::array<float,2>{0.966543078f, 0.2818636f},
-std::array<float,2>{0.0876263082f, 0.956049621f},
-std::array<float,2>{0.891301155f, 0.669400215f},
-std::array<float,2>{0.00289026462f, 0.0985577255f},
-std::array<float,2>{0.643754303f, 0.397709936f},
-std::array<float,2>{0.497784644f, 0.831735313f},
-std::array<float,2>{0.533943951f, 0.906326413f},
-std::array<float,2>{0.276400864f, 0.321405768f},
-std::array<float,2>{0.859118819f, 0.160563126f},
-std::array<float,2>{0.154169053f, 0.519366682f},
-std::array<float,2>{0.924779356f, 0.823706508f},
-std::array<float,2>{0.056556195f, 0.385567605f},
-std::array<float,2>{0.676162243f, 0.118054502f},
-std::array<float,2>{0.460224718f, 0.67228812f},
-std::array<float,2>{0.501408815f, 0.5139305f},
-std::array<float,2>{0.298333585f, 0.187164545f},
-std::array<float,2>{0.832290828f, 0.336269826f},
-std::array<float,2>{0.163040653f, 0.935168982f},
-std::array<float,2>{0.754319131f, 0.705971181f},
-std::array<float,2>{0.196501896f, 0.00154018239f},
-std::array<float,2>{0.618975341f, 0.488551736f},
-std::array<float,2>{0.335403115f, 0.801214695f},
-std::array<float,2>{0.748881876f, 0.944379807f},
-std::array<float,2>{0.376216263f, 0.306017846f},
-std::array<float,2>{0.96960634f, 0.231873393f},
-std::array<float,2>{0.119654618f, 0.623307347f},
-std::array<float,2>{0.869914174f, 0.90273726f},
-std::array<float,2>{0.130784497f, 0.360076904f},
-std::array<float,2>{0.560387492f, 0.146789089f},
-std::array<float,2>{0.253694892f, 0.542445064f},
-std::array<float,2>{0.629585981f, 0.63185221f},
-std::array<float,2>{0.475107163f, 0.0740532428f},
-std::array<float,2>{0.885354221f, 0.43103233f},
-std::array<float,2>{0.016100429f, 0.845848739f},
-std::array<float,2>{0.946934223f, 0.587308884f},
-std::array<float,2>{0.0654573217f, 0.209744155f},
-std::array<float,2>{0.696709514f, 0.276073098f},
-std::array<float,2>{0.415017992f, 0.978877425f},
-std::array<float,2>{0.586575985f, 0.777255654f},
-std::array<float,2>{0.366155624f, 0.466252297f},
-std::array<float,2>{0.791816771f, 0.052223146f},
-std::array<float,2>{0.221886575f, 0.721416414f},
-std::array<float,2>{0.876860857f, 0.923971534f},
-std::array<float,2>{0.027691856f, 0.329274476f},
-std::array<float,2>{0.639367819f, 0.178391129f},
-std::array<float,2>{0.48249045f, 0.503616691f},
-std::array<float,2>{0.54827404f, 0.684354782f},
-std::array<float,2>{0.261841327f, 0.117165893f},
-std::array<float,2>{0.863498569f, 0.382443815f},
-std::array<float,2>{0.137917012f, 0.81927985f},
-std::array<float,2>{0.783159256f, 0.613144815f},
-std::array<float,2>{0.229550436f, 0.225707769f},
-std::array<float,2>{0.583351851f, 0.298783422f},
-std::array<float,2>{0.369737536f, 0.952230453f},
-std::array<float,2>{0.687580705f, 0.810367823f},
-std::array<float,2>{0.413376778f, 0.499973774f},
-std::array<float,2>{0.942784131f, 0.00978886988f},
-std::array<float,2>{0.0767658725f, 0.712771118f},
-std::array<float,2>{0.842279077f, 0.856457889f},
-std::array<float,2>{0.166967437f, 0.427350819f},
-std::array<float,2>{0.512804687f, 0.0643371642f},
-std::array<float,2>{0.305772632f, 0.632988632f},
-std::array<float,2>{0.685870051f, 0.533147693f},
-std::array<float,2>{0.465679824f, 0.1493714f},
-std::array<float,2>{0.93594557f, 0.367874801f},
-std::array<float,2>{0.0510041974f, 0.897689223f},
-std::array<float,2>{0.979511738f, 0.728042841f},
-std::array<float,2>{0.111818478f, 0.0580881871f},
-std::array<float,2>{0.740377367f, 0.453485459f},
-std::array<float,2>{0.387778759f, 0.765800834f},
-std::array<float,2>{0.610988736f, 0.976263106f},
-std::array<float,2>{0.338289529f, 0.27240929f},
-std::array<float,2>{0.758397877f, 0.217802227f},
-std::array<float,2>{0.195129067f, 0.581256986f},
-std::array<float,2>{0.958507657f, 0.755221426f},
-std::array<float,2>{0.0793774202f, 0.443321884f},
-std::array<float,2>{0.715687156f, 0.0421271659f},
-std::array<float,2>{0.425294131f, 0.744957447f},
-std::array<float,2>{0.568545043f, 0.5682832f},
-std::array<float,2>{0.354807734f, 0.202949047f},
-std::array<float,2>{0.806884646f, 0.259611636f},
-std::array<float,2>{0.247744337f, 0.99316299f},
-std::array<float,2>{0.84794277f, 0.645364761f},
-std::array<float,2>{0.141511828f, 0.0818946734f},
-std::array<float,2>{0.546238422f, 0.410118937f},
-std::array<float,2>{0.268463224f, 0.863791108f},
-std::array<float,2>{0.650331616f, 0.883642554f},
-std::array<float,2>{0.484570473f, 0.353419125f},
-std::array<float,2>{0.901768923f, 0.126256794f},
-std::array<float,2>{0.0151204662f, 0.547600746f},
-std::array<float,2>{0.775812566f, 0.962124228f},
-std::array<float,2>{0.21679315f, 0.292088926f},
-std::array<float,2>{0.604983807f, 0.246028721f},
-std::array<float,2>{0.314622521f, 0.601435244f},
-std::array<float,2>{0.732097864f, 0.700894594f},
-std::array<float,2>{0.402304947f, 0.0229566917f},
-std::array<float,2>{0.994791031f, 0.47495386f},
-std::array<float,2>{0.103007376f, 0.788981676f},
-std::array<float,2>{0.91677165f, 0.52600807f},
-std::array<float,2>{0.0402701385f, 0.165853724f},
-std::array<float,2>{0.661851823f, 0.313557982f},
-std::array<float,2>{0.439786732f, 0.917196751f},
-std::array<float,2>{0.529361665f, 0.842499077f},
-std::array<float,2>{0.289762229f, 0.402360231f},
-std::array<float,2>{0.812912405f, 0.109364882f},
-std::array<float,2>{0.173817798f, 0.657062829f},
-std::array<float,2>{0.940681756f, 0.879398823f},
-std::array<float,2>{0.0724651441f, 0.347512126f},
-std::array<float,2>{0.691856205f, 0.137344956f},
-std::array<float,2>{0.410018533f, 0.557091892f},
-std::array<float,2>{0.579689562f, 0.655185461f},
-std::array<float,2>{0.374105483f, 0.0884831473f},
-std::array<float,2>{0.785537958f, 0.415553987f},
-std::array<float,2>{0.232784301f, 0.870660961f},
-std::array<float,2>{0.861295402f, 0.570730209f},
-std::array<float,2>{0.133029252f, 0.190032169f},
-std::array<float,2>{0.554439545f, 0.257369965f},
-std::array<float,2>{0.258067816f, 0.987040639f},
-std::array<float,2>{0.634087443f, 0.758020759f},
-std::array<float,2>{0.477827698f, 0.452815413f},
-std::array<float,2>{0.882189512f, 0.0353524163f},
-std::array<float,2>{0.0269424953f, 0.735804617f},
-std::array<float,2>{0.763148904f, 0.833146632f},
-std::array<float,2>{0.189047322f, 0.393912405f},
-std::array<float,2>{0.616962969f, 0.0961355716f},
-std::array<float,2>{0.340988994f, 0.666703761f},
-std::array<float,2>{0.736057341f, 0.522546828f},
-std::array<float,2>{0.385733426f, 0.156373411f},
-std::array<float,2>{0.984103918f, 0.327305049f},
-std::array<float,2>{0.117052913f, 0.913799584f},
-std::array<float,2>{0.931583583f, 0.691019356f},
-std::array<float,2>{0.0480663478f, 0.0257692635f},
-std::array<float,2>{0.683371782f, 0.478463203f},
-std::array<float,2>{0.464722067f, 0.791341484f},
-std::array<float,2>{0.508274555f, 0.958707213f},
-std::array<float,2>{0.30974707f, 0.285520583f},
-std::array<float,2>{0.839752674f, 0.241923228f},
-std::array<float,2>{0.169993773f, 0.604785442f},
-std::array<float,2>{0.902819276f, 0.79820621f},
-std::array<float,2>{0.0113372486f, 0.486023545f},
-std::array<float,2>{0.654462099f, 0.00705613149f},
-std::array<float,2>{0.490983278f, 0.709706604f},
-std::array<float,2>{0.541525185f, 0.618522525f},
-std::array<float,2>{0.269939423f, 0.228702873f},
-std::array<float,2>{0.843752563f, 0.309291482f},
-std::array<float,2>{0.144631594f, 0.93774575f},
-std::array<float,2>{0.81014818f, 0.67680496f},
-std::array<float,2>{0.244645149f, 0.124422342f},
-std::array<float,2>{0.565446615f, 0.386987358f},
-std::array<float,2>{0.358608335f, 0.826359272f},
-std::array<float,2>{0.713507414f, 0.929909766f},
-std::array<float,2>{0.429070145f, 0.341759682f},
-std::array<float,2>{0.955845773f, 0.183373511f},
-std::array<float,2>{0.0831568167f, 0.511442959f},
-std::array<float,2>{0.81898427f, 0.983031213f},
-std::array<float,2>{0.177882358f, 0.278677523f},
-std::array<float,2>{0.525268614f, 0.206267476f},
-std::array<float,2>{0.295408458f, 0.592739284f},
-std::array<float,2>{0.657901049f, 0.722911716f},
-std::array<float,2>{0.442314804f, 0.0484201312f},
-std::array<float,2>{0.920611322f, 0.464318752f},
-std::array<float,2>{0.044158861f, 0.777623892f},
-std::array<float,2>{0.999892771f, 0.543140709f},
-std::array<float,2>{0.108038858f, 0.142319128f},
-std::array<float,2>{0.727875948f, 0.367140174f},
-std::array<float,2>{0.404048681f, 0.901214421f},
-std::array<float,2>{0.607005358f, 0.850736678f},
-std::array<float,2>{0.317485541f, 0.435431331f},
-std::array<float,2>{0.779798508f, 0.0748863444f},
-std::array<float,2>{0.212510824f, 0.62790066f},
-std::array<float,2>{0.911691725f, 0.946185529f},
-std::array<float,2>{0.0318921506f, 0.303886861f},
-std::array<float,2>{0.667322516f, 0.219620273f},
-std::array<float,2>{0.449905783f, 0.614781976f},
-std::array<float,2>{0.52078563f, 0.717946351f},
-std::array<float,2>{0.287873775f, 0.0123754339f},
-std::array<float,2>{0.820871711f, 0.493204325f},
-std::array<float,2>{0.187270865f, 0.806622803f},
-std::array<float,2>{0.771172822f, 0.504676878f},
-std::array<float,2>{0.207629129f, 0.17512852f},
-std::array<float,2>{0.599308908f, 0.333363444f},
-std::array<float,2>{0.321310669f, 0.92713213f},
-std::array<float,2>{0.722584248f, 0.814213336f},
-std::array<float,2>{0.396834701f, 0.375686347f},
-std::array<float,2>{0.991192698f, 0.110225759f},
-std::array<float,2>{0.0972803012f, 0.680336773f},
-std::array<float,2>{0.855032802f, 0.771163523f},
-std::array<float,2>{0.14863269f, 0.458530486f},
-std::array<float,2>{0.536274135f, 0.0622750111f},
-std::array<float,2>{0.278864741f, 0.731285453f},
-std::array<float,2>{0.64720583f, 0.585480571f},
-std::array<float,2>{0.492823958f, 0.212191328f},
-std::array<float,2>{0.898221314f, 0.266363114f},
-std::array<float,2>{0.00691121444f, 0.970688939f},
-std::array<float,2>{0.961791277f, 0.639673352f},
-std::array<float,2>{0.0909620151f, 0.0665039718f},
-std::array<float,2>{0.707454145f, 0.424515605f},
-std::array<float,2>{0.435027629f, 0.852850139f},
-std::array<float,2>{0.570789397f, 0.890821636f},
-std::array<float,2>{0.350110084f, 0.373882949f},
-std::array<float,2>{0.804384947f, 0.153656021f},
-std::array<float,2>{0.242090672f, 0.535682499f},
-std::array<float,2>{0.976179957f, 0.861857712f},
-std::array<float,2>{0.12314482f, 0.410313904f},
-std::array<float,2>{0.743500054f, 0.0834290907f},
-std::array<float,2>{0.381040037f, 0.64440316f},
-std::array<float,2>{0.621501625f, 0.551381707f},
-std::array<float,2>{0.328237951f, 0.129728094f},
-std::array<float,2>{0.752786219f, 0.359374732f},
-std::array<float,2>{0.200161725f, 0.887548089f},
-std::array<float,2>{0.829116404f, 0.74700886f},
-std::array<float,2>{0.159751251f, 0.0464606434f},
-std::array<float,2>{0.503961265f, 0.440971404f},
-std::array<float,2>{0.302446693f, 0.75366199f},
-std::array<float,2>{0.674984396f, 0.997034907f},
-std::array<float,2>{0.455189735f, 0.262027472f},
-std::array<float,2>{0.927201867f, 0.198327407f},
-std::array<float,2>{0.060320124f, 0.564756215f},
-std::array<float,2>{0.793137074f, 0.920035303f},
-std::array<float,2>{0.225481644f, 0.318760037f},
-std::array<float,2>{0.591163218f, 0.169602752f},
-std::array<float,2>{0.363030612f, 0.527791798f},
-std::array<float,2>{0.700398922f, 0.663600147f},
-std::array<float,2>{0.419070482f, 0.104997821f},
-std::array<float,2>{0.950376153f, 0.39892745f},
-std::array<float,2>{0.0673626736f, 0.838326156f},
-std::array<float,2>{0.889417827f, 0.595041811f},
-std::array<float,2>{0.0205251537f, 0.248592779f},
-std::array<float,2>{0.628058255f, 0.294294059f},
-std::array<float,2>{0.472081482f, 0.967462182f},
-std::array<float,2>{0.557349682f, 0.781450391f},
-std::array<float,2>{0.254930615f, 0.4690516f},
-std::array<float,2>{0.872601748f, 0.0179421306f},
-std::array<float,2>{0.128871843f, 0.695760548f},
-std::array<float,2>{0.970213413f, 0.941992521f},
-std::array<float,2>{0.120318331f, 0.307879955f},
-std::array<float,2>{0.749764442f, 0.233571351f},
-std::array<float,2>{0.375530094f, 0.622023821f},
-std::array<float,2>{0.617655993f, 0.704348922f},
-std::array<float,2>{0.33405444f, 0.00212652376f},
-std::array<float,2>{0.75539583f, 0.491154611f},
-std::array<float,2>{0.195737287f, 0.802962601f},
-std::array<float,2>{0.833553135f, 0.513178051f},
-std::array<float,2>{0.163252786f, 0.184987307f},
-std::array<float,2>{0.500796854f, 0.33901906f},
-std::array<float,2>{0.297446012f, 0.936152101f},
-std::array<float,2>{0.677716136f, 0.821211874f},
-std::array<float,2>{0.459525704f, 0.382958651f},
-std::array<float,2>{0.924971163f, 0.119268052f},
-std::array<float,2>{0.0548513234f, 0.675643563f},
-std::array<float,2>{0.792808831f, 0.775357425f},
-std::array<float,2>{0.220765397f, 0.467435807f},
-std::array<float,2>{0.587419927f, 0.0546340756f},
-std::array<float,2>{0.366521716f, 0.72014308f},
-std::array<float,2>{0.695872486f, 0.588145375f},
-std::array<float,2>{0.415311933f, 0.208595738f},
-std::array<float,2>{0.945790291f, 0.274581879f},
-std::array<float,2>{0.0651458651f, 0.977111518f},
-std::array<float,2>{0.88668406f, 0.62962991f},
-std::array<float,2>{0.0169413984f, 0.0713556856f},
-std::array<float,2>{0.630146146f, 0.432237864f},
-std::array<float,2>{0.476559669f, 0.844657838f},
-std::array<float,2>{0.559208155f, 0.905082583f},
-std::array<float,2>{0.252389193f, 0.362421721f},
-std::array<float,2>{0.870651662f, 0.144533917f},
-std::array<float,2>{0.129317731f, 0.539475262f},
-std::array<float,2>{0.908317327f, 0.871617794f},
-std::array<float,2>{0.0377203934f, 0.420080215f},
-std::array<float,2>{0.670199335f, 0.0898455009f},
-std::array<float,2>{0.446093678f, 0.650939703f},
-std::array<float,2>{0.519032776f, 0.561625361f},
-std::array<float,2>{0.284481108f, 0.135437846f},
-std::array<float,2>{0.828026831f, 0.350053847f},
-std::array<float,2>{0.183195829f, 0.878478527f},
-std::array<float,2>{0.769412816f, 0.740760863f},
-std::array<float,2>{0.205009773f, 0.0347152427f},
-std::array<float,2>{0.596303165f, 0.446029991f},
-std::array<float,2>{0.325534672f, 0.765054584f},
-std::array<float,2>{0.725608826f, 0.989900112f},
-std::array<float,2>{0.391852081f, 0.250605434f},
-std::array<float,2>{0.985478878f, 0.193911389f},
-std::array<float,2>{0.100237682f, 0.574745238f},
-std::array<float,2>{0.858055651f, 0.910052001f},
-std::array<float,2>{0.153302163f, 0.323819548f},
-std::array<float,2>{0.534796894f, 0.163839728f},
-std::array<float,2>{0.275995195f, 0.517345786f},
-std::array<float,2>{0.643210113f, 0.671497583f},
-std::array<float,2>{0.49635458f, 0.0997902304f},
-std::array<float,2>{0.891664326f, 0.395450622f},
-std::array<float,2>{0.00324474811f, 0.829661131f},
-std::array<float,2>{0.965771794f, 0.606574833f},
-std::array<float,2>{0.0860575959f, 0.235664636f},
-std::array<float,2>{0.70632863f, 0.284742415f},
-std::array<float,2>{0.43215856f, 0.953894794f},
-std::array<float,2>{0.577226043f, 0.793307364f},
-std::array<float,2>{0.344848633f, 0.483504802f},
-std::array<float,2>{0.799834132f, 0.0291005708f},
-std::array<float,2>{0.23552455f, 0.694941759f},
-std::array<float,2>{0.900810301f, 0.886428714f},
-std::array<float,2>{0.0146455886f, 0.353659391f},
-std::array<float,2>{0.648745954f, 0.127906248f},
-std::array<float,2>{0.485547572f, 0.549582481f},
-std::array<float,2>{0.545668066f, 0.647658706f},
-std::array<float,2>{0.268771082f, 0.0789639577f},
-std::array<float,2>{0.849575281f, 0.40669778f},
-std::array<float,2>{0.142555371f, 0.8669976f},
-std::array<float,2>{0.808022678f, 0.569176257f},
-std::array<float,2>{0.246435747f, 0.199808329f},
-std::array<float,2>{0.570126534f, 0.261592507f},
-std::array<float,2>{0.354076117f, 0.994232059f},
-std::array<float,2>{0.716663897f, 0.755887985f},
-std::array<float,2>{0.424206316f, 0.444963485f},
-std::array<float,2>{0.957716644f, 0.0406528488f},
-std::array<float,2>{0.078210257f, 0.742327631f},
-std::array<float,2>{0.813519955f, 0.841374815f},
-std::array<float,2>{0.172368899f, 0.404590398f},
-std::array<float,2>{0.530695975f, 0.106249228f},
-std::array<float,2>{0.29013291f, 0.65954721f},
-std::array<float,2>{0.661030769f, 0.523775637f},
-std::array<float,2>{0.44088316f, 0.166387722f},
-std::array<float,2>{0.917284727f, 0.31531018f},
-std::array<float,2>{0.0396711715f, 0.915711224f},
-std::array<float,2>{0.996089458f, 0.701587677f},
-std::array<float,2>{0.102340668f, 0.0200098995f},
-std::array<float,2>{0.730961621f, 0.474014878f},
-std::array<float,2>{0.400741637f, 0.786626935f},
-std::array<float,2>{0.60400027f, 0.96429044f},
-std::array<float,2>{0.31626001f, 0.290858299f},
-std::array<float,2>{0.776414931f, 0.243876085f},
-std::array<float,2>{0.214976519f, 0.598983169f},
-std::array<float,2>{0.941462278f, 0.811262369f},
-std::array<float,2>{0.077772446f, 0.498011887f},
-std::array<float,2>{0.688549936f, 0.0091415355f},
-std::array<float,2>{0.412403435f, 0.714685023f},
-std::array<float,2>{0.58300221f, 0.610672712f},
-std::array<float,2>{0.37060827f, 0.224529698f},
-std::array<float,2>{0.781570911f, 0.299818158f},
-std::array<float,2>{0.228578955f, 0.950088382f},
-std::array<float,2>{0.864860713f, 0.687202096f},
-std::array<float,2>{0.137415245f, 0.11406032f},
-std::array<float,2>{0.547343493f, 0.380768716f},
-std::array<float,2>{0.262859583f, 0.817759395f},
-std::array<float,2>{0.640426934f, 0.923158109f},
-std::array<float,2>{0.483827204f, 0.33018133f},
-std::array<float,2>{0.875885546f, 0.175830692f},
-std::array<float,2>{0.0290289856f, 0.50118947f},
-std::array<float,2>{0.758948326f, 0.973403454f},
-std::array<float,2>{0.193711311f, 0.270689309f},
-std::array<float,2>{0.609823942f, 0.216522381f},
-std::array<float,2>{0.338975787f, 0.578522265f},
-std::array<float,2>{0.741957426f, 0.729371905f},
-std::array<float,2>{0.386941373f, 0.0559108108f},
-std::array<float,2>{0.978926361f, 0.455726147f},
-std::array<float,2>{0.113280639f, 0.768497705f},
-std::array<float,2>{0.937491536f, 0.533885241f},
-std::array<float,2>{0.0525302365f, 0.150543705f},
-std::array<float,2>{0.687312245f, 0.370946229f},
-std::array<float,2>{0.465870559f, 0.896266639f},
-std::array<float,2>{0.511831224f, 0.85828054f},
-std::array<float,2>{0.305511922f, 0.428159893f},
-std::array<float,2>{0.843191981f, 0.0649280548f},
-std::array<float,2>{0.167542771f, 0.634963036f},
-std::array<float,2>{0.956250429f, 0.932829559f},
-std::array<float,2>{0.0821246877f, 0.342448652f},
-std::array<float,2>{0.714620352f, 0.181156978f},
-std::array<float,2>{0.428070277f, 0.508160114f},
-std::array<float,2>{0.565289915f, 0.677882493f},
-std::array<float,2>{0.357741475f, 0.121963628f},
-std::array<float,2>{0.809100032f, 0.389496148f},
-std::array<float,2>{0.245344236f, 0.826030135f},
-std::array<float,2>{0.845536649f, 0.621061623f},
-std::array<float,2>{0.14614448f, 0.227090165f},
-std::array<float,2>{0.54233706f, 0.311884493f},
-std::array<float,2>{0.270932615f, 0.940084755f},
-std::array<float,2>{0.655733466f, 0.799446404f},
-std::array<float,2>{0.491491646f, 0.487686306f},
-std::array<float,2>{0.903671205f, 0.00453783618f},
-std::array<float,2>{0.0104660774f, 0.707687676f},
-std::array<float,2>{0.781113982f, 0.847795367f},
-std::array<float,2>{0.211664006f, 0.437421054f},
-std::array<float,2>{0.606293082f, 0.0776255801f},
-std::array<float,2>{0.316690117f, 0.62660259f},
-std::array<float,2>{0.726750135f, 0.544948816f},
-std::array<float,2>{0.402446479f, 0.143943354f},
-std::array<float,2>{0.998149157f, 0.363790423f},
-std::array<float,2>{0.109064892f, 0.899083018f},
-std::array<float,2>{0.921112001f, 0.725224495f},
-std::array<float,2>{0.0429802276f, 0.0504322015f},
-std::array<float,2>{0.656539977f, 0.462138116f},
-std::array<float,2>{0.443084478f, 0.779585123f},
-std::array<float,2>{0.524064958f, 0.982146442f},
-std::array<float,2>{0.296502143f, 0.281042546f},
-std::array<float,2>{0.820026994f, 0.20365949f},
-std::array<float,2>{0.178713351f, 0.589930713f},
-std::array<float,2>{0.88105315f, 0.760734141f},
-std::array<float,2>{0.0254309848f, 0.450141221f},
-std::array<float,2>{0.633046091f, 0.0389024951f},
-std::array<float,2>{0.476983488f, 0.737084568f},
-std::array<float,2>{0.553547025f, 0.572447121f},
-std::array<float,2>{0.258795619f, 0.188278347f},
-std::array<float,2>{0.859483182f, 0.254869282f},
-std::array<float,2>{0.134545714f, 0.984575808f},
-std::array<float,2>{0.786660492f, 0.653190315f},
-std::array<float,2>{0.234363928f, 0.0875694454f},
-std::array<float,2>{0.579039514f, 0.417156279f},
-std::array<float,2>{0.37319839f, 0.869013667f},
-std::array<float,2>{0.692734659f, 0.882115006f},
-std::array<float,2>{0.408357143f, 0.344370753f},
-std::array<float,2>{0.939842522f, 0.139655828f},
-std::array<float,2>{0.0736112222f, 0.555148304f},
-std::array<float,2>{0.83811456f, 0.959015906f},
-std::array<float,2>{0.171108514f, 0.288735837f},
-std::array<float,2>{0.509518743f, 0.239449129f},
-std::array<float,2>{0.30874458f, 0.60209924f},
-std::array<float,2>{0.682370007f, 0.688718975f},
-std::array<float,2>{0.463056326f, 0.0246456396f},
-std::array<float,2>{0.930351138f, 0.480310321f},
-std::array<float,2>{0.0474525169f, 0.789477706f},
-std::array<float,2>{0.982702672f, 0.521087825f},
-std::array<float,2>{0.116030857f, 0.158727214f},
-std::array<float,2>{0.734557509f, 0.324956834f},
-std::array<float,2>{0.385872006f, 0.912022829f},
-std::array<float,2>{0.615731537f, 0.834298849f},
-std::array<float,2>{0.339936495f, 0.392538428f},
-std::array<float,2>{0.762359142f, 0.0955438241f},
-std::array<float,2>{0.188077226f, 0.664249241f},
-std::array<float,2>{0.926721275f, 0.999661446f},
-std::array<float,2>{0.0587851442f, 0.264286488f},
-std::array<float,2>{0.673971236f, 0.196883455f},
-std::array<float,2>{0.456226796f, 0.562709749f},
-std::array<float,2>{0.505399644f, 0.749076903f},
-std::array<float,2>{0.301260501f, 0.0435128696f},
-std::array<float,2>{0.828638732f, 0.43849209f},
-std::array<float,2>{0.159133509f, 0.750395596f},
-std::array<float,2>{0.753042281f, 0.552970052f},
-std::array<float,2>{0.20045954f, 0.132589966f},
-std::array<float,2>{0.622764289f, 0.357275128f},
-std::array<float,2>{0.329372972f, 0.889347494f},
-std::array<float,2>{0.742385685f, 0.86032784f},
-std::array<float,2>{0.382727265f, 0.413738817f},
-std::array<float,2>{0.975305915f, 0.0848691612f},
-std::array<float,2>{0.124513f, 0.642392099f},
-std::array<float,2>{0.871389627f, 0.783478916f},
-std::array<float,2>{0.127401069f, 0.471519262f},
-std::array<float,2>{0.557655752f, 0.0169700775f},
-std::array<float,2>{0.25408569f, 0.698438942f},
-std::array<float,2>{0.627103746f, 0.59688586f},
-std::array<float,2>{0.47141549f, 0.246168613f},
-std::array<float,2>{0.889802217f, 0.296079367f},
-std::array<float,2>{0.0197123121f, 0.965146184f},
-std::array<float,2>{0.949321032f, 0.66046077f},
-std::array<float,2>{0.0680811703f, 0.103281252f},
-std::array<float,2>{0.700099409f, 0.400922686f},
-std::array<float,2>{0.418466002f, 0.836754322f},
-std::array<float,2>{0.590392232f, 0.918497443f},
-std::array<float,2>{0.362125337f, 0.317930847f},
-std::array<float,2>{0.793987811f, 0.170063496f},
-std::array<float,2>{0.226018474f, 0.529756367f},
-std::array<float,2>{0.991542816f, 0.815878034f},
-std::array<float,2>{0.0961215869f, 0.378460616f},
-std::array<float,2>{0.721070468f, 0.111695245f},
-std::array<float,2>{0.397707313f, 0.68171066f},
-std::array<float,2>{0.598201871f, 0.505898297f},
-std::array<float,2>{0.321198523f, 0.173537955f},
-std::array<float,2>{0.770299733f, 0.33548069f},
-std::array<float,2>{0.20827511f, 0.929030478f},
-std::array<float,2>{0.821545541f, 0.716561258f},
-std::array<float,2>{0.18583858f, 0.0155453123f},
-std::array<float,2>{0.520252824f, 0.494344741f},
-std::array<float,2>{0.288222373f, 0.806775928f},
-std::array<float,2>{0.666362882f, 0.948073626f},
-std::array<float,2>{0.450215071f, 0.302396327f},
-std::array<float,2>{0.910581648f, 0.221806675f},
-std::array<float,2>{0.0331600085f, 0.615594149f},
-std::array<float,2>{0.803176641f, 0.893641829f},
-std::array<float,2>{0.240486711f, 0.37194705f},
-std::array<float,2>{0.571390092f, 0.154302865f},
-std::array<float,2>{0.351468682f, 0.538767695f},
-std::array<float,2>{0.708132684f, 0.637616932f},
-std::array<float,2>{0.433594555f, 0.0699664503f},
-std::array<float,2>{0.962228f, 0.423099548f},
-std::array<float,2>{0.0904738382f, 0.854845345f},
-std::array<float,2>{0.896540403f, 0.582932293f},
-std::array<float,2>{0.00613636663f, 0.214444637f},
-std::array<float,2>{0.647575319f, 0.269435704f},
-std::array<float,2>{0.494060785f, 0.97234863f},
-std::array<float,2>{0.535683811f, 0.772153378f},
-std::array<float,2>{0.2782875f, 0.459354848f},
-std::array<float,2>{0.853878498f, 0.0589973554f},
-std::array<float,2>{0.150347412f, 0.733682036f},
-std::array<float,2>{0.949158072f, 0.980011165f},
-std::array<float,2>{0.0627191216f, 0.277275085f},
-std::array<float,2>{0.698458314f, 0.210129276f},
-std::array<float,2>{0.417132497f, 0.586734235f},
-std::array<float,2>{0.589420557f, 0.72252357f},
-std::array<float,2>{0.365046322f, 0.051513698f},
-std::array<float,2>{0.790586233f, 0.465434641f},
-std::array<float,2>{0.21983014f, 0.775456905f},
-std::array<float,2>{0.868537426f, 0.541294992f},
-std::array<float,2>{0.131129593f, 0.148391321f},
-std::array<float,2>{0.560626209f, 0.361201793f},
-std::array<float,2>{0.251100361f, 0.903480887f},
-std::array<float,2>{0.63177985f, 0.846979797f},
-std::array<float,2>{0.473372579f, 0.429754168f},
-std::array<float,2>{0.88471216f, 0.0723846778f},
-std::array<float,2>{0.0179583579f, 0.631018281f},
-std::array<float,2>{0.75725013f, 0.802436054f},
-std::array<float,2>{0.197725445f, 0.489696115f},
-std::array<float,2>{0.620313942f, 5.4953005e-05f},
-std::array<float,2>{0.332395524f, 0.706851482f},
-std::array<float,2>{0.747600198f, 0.624496877f},
-std::array<float,2>{0.378594905f, 0.230912521f},
-std::array<float,2>{0.971360743f, 0.305181831f},
-std::array<float,2>{0.119068302f, 0.944270551f},
-std::array<float,2>{0.922248125f, 0.673724771f},
-std::array<float,2>{0.0567052513f, 0.118441366f},
-std::array<float,2>{0.678507805f, 0.386187524f},
-std::array<float,2>{0.458022028f, 0.823055029f},
-std::array<float,2>{0.503688097f, 0.933984339f},
-std::array<float,2>{0.299381733f, 0.337797642f},
-std::array<float,2>{0.835030198f, 0.186078966f},
-std::array<float,2>{0.162068188f, 0.515467525f},
-std::array<float,2>{0.893126607f, 0.830717385f},
-std::array<float,2>{0.00156588771f, 0.397168189f},
-std::array<float,2>{0.641800404f, 0.0995209888f},
-std::array<float,2>{0.49961552f, 0.668443918f},
-std::array<float,2>{0.532233f, 0.518415213f},
-std::array<float,2>{0.274332404f, 0.161148697f},
-std::array<float,2>{0.856975675f, 0.32107535f},
-std::array<float,2>{0.156210378f, 0.907687068f},
-std::array<float,2>{0.798009753f, 0.692055523f},
-std::array<float,2>{0.237939924f, 0.0311200712f},
-std::array<float,2>{0.574697375f, 0.481773525f},
-std::array<float,2>{0.346071333f, 0.796263039f},
-std::array<float,2>{0.703375995f, 0.956947863f},
-std::array<float,2>{0.4305242f, 0.283000261f},
-std::array<float,2>{0.967321515f, 0.237365991f},
-std::array<float,2>{0.0888417065f, 0.608289182f},
-std::array<float,2>{0.824500024f, 0.876773477f},
-std::array<float,2>{0.1813052f, 0.348213524f},
-std::array<float,2>{0.516113937f, 0.134242252f},
-std::array<float,2>{0.28252089f, 0.559331656f},
-std::array<float,2>{0.668869317f, 0.650216818f},
-std::array<float,2>{0.447749108f, 0.0929199383f},
-std::array<float,2>{0.907375336f, 0.419649392f},
-std::array<float,2>{0.0353614241f, 0.874543726f},
-std::array<float,2>{0.987175584f, 0.577000558f},
-std::array<float,2>{0.0985348821f, 0.192292005f},
-std::array<float,2>{0.722842097f, 0.253864139f},
-std::array<float,2>{0.393108308f, 0.991870403f},
-std::array<float,2>{0.59497273f, 0.762633979f},
-std::array<float,2>{0.328071296f, 0.448218495f},
-std::array<float,2>{0.765935302f, 0.0322801135f},
-std::array<float,2>{0.206143245f, 0.739463091f},
-std::array<float,2>{0.914956987f, 0.916920543f},
-std::array<float,2>{0.0417394713f, 0.312613577f},
-std::array<float,2>{0.662249923f, 0.164189771f},
-std::array<float,2>{0.437971741f, 0.526807666f},
-std::array<float,2>{0.528779447f, 0.65800333f},
-std::array<float,2>{0.292188078f, 0.10751725f},
-std::array<float,2>{0.815937519f, 0.40386501f},
-std::array<float,2>{0.175116166f, 0.842888176f},
-std::array<float,2>{0.773491621f, 0.600393653f},
-std::array<float,2>{0.217552394f, 0.245016187f},
-std::array<float,2>{0.601837933f, 0.291693419f},
-std::array<float,2>{0.312520146f, 0.96162796f},
-std::array<float,2>{0.734094799f, 0.787613809f},
-std::array<float,2>{0.399028748f, 0.475971133f},
-std::array<float,2>{0.992797673f, 0.0216201264f},
-std::array<float,2>{0.105409451f, 0.700036049f},
-std::array<float,2>{0.851420999f, 0.865202188f},
-std::array<float,2>{0.144053295f, 0.409137964f},
-std::array<float,2>{0.543021202f, 0.0806960687f},
-std::array<float,2>{0.265920013f, 0.646217048f},
-std::array<float,2>{0.651844144f, 0.548751593f},
-std::array<float,2>{0.486656278f, 0.125955939f},
-std::array<float,2>{0.898953617f, 0.352476239f},
-std::array<float,2>{0.0117375394f, 0.883801937f},
-std::array<float,2>{0.959597945f, 0.745132923f},
-std::array<float,2>{0.081497103f, 0.0416169837f},
-std::array<float,2>{0.717788935f, 0.44166398f},
-std::array<float,2>{0.421910107f, 0.754388928f},
-std::array<float,2>{0.567542315f, 0.994138956f},
-std::array<float,2>{0.353349626f, 0.258147478f},
-std::array<float,2>{0.805906236f, 0.201285452f},
-std::array<float,2>{0.249668047f, 0.56670177f},
-std::array<float,2>{0.976619959f, 0.766702056f},
-std::array<float,2>{0.109731756f, 0.454822004f},
-std::array<float,2>{0.740041196f, 0.0566784367f},
-std::array<float,2>{0.389291257f, 0.726597548f},
-std::array<float,2>{0.612146854f, 0.580106914f},
-std::array<float,2>{0.33788681f, 0.21711503f},
-std::array<float,2>{0.761635423f, 0.27314961f},
-std::array<float,2>{0.193333745f, 0.974775374f},
-std::array<float,2>{0.840505362f, 0.634315848f},
-std::array<float,2>{0.165128902f, 0.0634522662f},
-std::array<float,2>{0.514785469f, 0.426718712f},
-std::array<float,2>{0.308553249f, 0.855969727f},
-std::array<float,2>{0.685465634f, 0.89742738f},
-std::array<float,2>{0.468354911f, 0.368172318f},
-std::array<float,2>{0.934246421f, 0.149624616f},
-std::array<float,2>{0.0536226816f, 0.531993091f},
-std::array<float,2>{0.783764422f, 0.951646149f},
-std::array<float,2>{0.227105632f, 0.297252774f},
-std::array<float,2>{0.584912896f, 0.225360245f},
-std::array<float,2>{0.367545217f, 0.611898661f},
-std::array<float,2>{0.69137311f, 0.711614549f},
-std::array<float,2>{0.410951972f, 0.0113828862f},
-std::array<float,2>{0.94525528f, 0.498413414f},
-std::array<float,2>{0.0759358257f, 0.808947206f},
-std::array<float,2>{0.877015352f, 0.502282858f},
-std::array<float,2>{0.0297241658f, 0.17912364f},
-std::array<float,2>{0.6369223f, 0.328913182f},
-std::array<float,2>{0.481889963f, 0.925473273f},
-std::array<float,2>{0.549852848f, 0.819462657f},
-std::array<float,2>{0.263917983f, 0.381412596f},
-std::array<float,2>{0.865265846f, 0.115406103f},
-std::array<float,2>{0.138798878f, 0.685199082f},
-std::array<float,2>{0.996811569f, 0.901624739f},
-std::array<float,2>{0.106435105f, 0.365757257f},
-std::array<float,2>{0.729168117f, 0.140853897f},
-std::array<float,2>{0.405533612f, 0.544432759f},
-std::array<float,2>{0.608480334f, 0.62841171f},
-std::array<float,2>{0.319710046f, 0.0759468973f},
-std::array<float,2>{0.778354764f, 0.434378743f},
-std::array<float,2>{0.213801712f, 0.850009859f},
-std::array<float,2>{0.816846192f, 0.59364593f},
-std::array<float,2>{0.176637515f, 0.206015304f},
-std::array<float,2>{0.526618659f, 0.277573973f},
-std::array<float,2>{0.294232398f, 0.983753681f},
-std::array<float,2>{0.659436345f, 0.778880954f},
-std::array<float,2>{0.443989336f, 0.463495255f},
-std::array<float,2>{0.919213951f, 0.0468922183f},
-std::array<float,2>{0.0453446284f, 0.723679781f},
-std::array<float,2>{0.810882449f, 0.827166319f},
-std::array<float,2>{0.243046224f, 0.38820067f},
-std::array<float,2>{0.563557684f, 0.123078987f},
-std::array<float,2>{0.356297076f, 0.676353753f},
-std::array<float,2>{0.711515307f, 0.510001957f},
-std::array<float,2>{0.426457584f, 0.181647986f},
-std::array<float,2>{0.954262078f, 0.340177089f},
-std::array<float,2>{0.0853290707f, 0.930706203f},
-std::array<float,2>{0.905870616f, 0.710696518f},
-std::array<float,2>{0.0086184293f, 0.00624544639f},
-std::array<float,2>{0.653425097f, 0.485059261f},
-std::array<float,2>{0.489420712f, 0.797035694f},
-std::array<float,2>{0.539616287f, 0.939199209f},
-std::array<float,2>{0.271910369f, 0.310223371f},
-std::array<float,2>{0.846973121f, 0.230205044f},
-std::array<float,2>{0.14756678f, 0.617423594f},
-std::array<float,2>{0.931656718f, 0.792779446f},
-std::array<float,2>{0.0507767871f, 0.477485925f},
-std::array<float,2>{0.680576026f, 0.0265743081f},
-std::array<float,2>{0.462069184f, 0.689654291f},
-std::array<float,2>{0.510756135f, 0.604191244f},
-std::array<float,2>{0.310998172f, 0.241201282f},
-std::array<float,2>{0.836222768f, 0.287091732f},
-std::array<float,2>{0.169309422f, 0.957511127f},
-std::array<float,2>{0.764315188f, 0.66766417f},
-std::array<float,2>{0.190873876f, 0.0973316729f},
-std::array<float,2>{0.613819599f, 0.393517554f},
-std::array<float,2>{0.342197239f, 0.832904816f},
-std::array<float,2>{0.737030268f, 0.91277796f},
-std::array<float,2>{0.384621024f, 0.327106655f},
-std::array<float,2>{0.98142612f, 0.158063278f},
-std::array<float,2>{0.113925301f, 0.521512091f},
-std::array<float,2>{0.862845898f, 0.987639368f},
-std::array<float,2>{0.135318294f, 0.256561816f},
-std::array<float,2>{0.552609563f, 0.190625429f},
-std::array<float,2>{0.260547191f, 0.571831226f},
-std::array<float,2>{0.63640976f, 0.734976053f},
-std::array<float,2>{0.479542732f, 0.036576204f},
-std::array<float,2>{0.880364716f, 0.451907396f},
-std::array<float,2>{0.0242902711f, 0.759383082f},
-std::array<float,2>{0.938801527f, 0.557739317f},
-std::array<float,2>{0.0715270415f, 0.137873843f},
-std::array<float,2>{0.694665015f, 0.345948428f},
-std::array<float,2>{0.407215416f, 0.880580366f},
-std::array<float,2>{0.58021009f, 0.869942486f},
-std::array<float,2>{0.372968763f, 0.41406405f},
-std::array<float,2>{0.78901875f, 0.0895161107f},
-std::array<float,2>{0.232160866f, 0.65578258f},
-std::array<float,2>{0.886757016f, 0.96825707f},
-std::array<float,2>{0.0234159883f, 0.293652773f},
-std::array<float,2>{0.625983477f, 0.24964577f},
-std::array<float,2>{0.469214618f, 0.594514191f},
-std::array<float,2>{0.555950046f, 0.696482301f},
-std::array<float,2>{0.257548541f, 0.0186998211f},
-std::array<float,2>{0.873118997f, 0.470590562f},
-std::array<float,2>{0.126888901f, 0.783078432f},
-std::array<float,2>{0.796871662f, 0.528844237f},
-std::array<float,2>{0.224009871f, 0.168247834f},
-std::array<float,2>{0.593658864f, 0.319406152f},
-std::array<float,2>{0.360890061f, 0.92126137f},
-std::array<float,2>{0.701372981f, 0.839376628f},
-std::array<float,2>{0.420278519f, 0.399606407f},
-std::array<float,2>{0.951747537f, 0.103534169f},
-std::array<float,2>{0.0691303462f, 0.662252367f},
-std::array<float,2>{0.83010757f, 0.752589643f},
-std::array<float,2>{0.156714261f, 0.440393388f},
-std::array<float,2>{0.50643158f, 0.0455122963f},
-std::array<float,2>{0.304510832f, 0.747722447f},
-std::array<float,2>{0.672614694f, 0.566233218f},
-std::array<float,2>{0.454385757f, 0.19794786f},
-std::array<float,2>{0.927903414f, 0.263624668f},
-std::array<float,2>{0.0619537197f, 0.997169554f},
-std::array<float,2>{0.974562109f, 0.643221319f},
-std::array<float,2>{0.122992694f, 0.0820406154f},
-std::array<float,2>{0.745360076f, 0.411584705f},
-std::array<float,2>{0.380000681f, 0.862736642f},
-std::array<float,2>{0.623186827f, 0.887980044f},
-std::array<float,2>{0.330538064f, 0.357521653f},
-std::array<float,2>{0.751220047f, 0.130256146f},
-std::array<float,2>{0.201444939f, 0.551994443f},
-std::array<float,2>{0.964834332f, 0.851707935f},
-std::array<float,2>{0.0928179175f, 0.425732076f},
-std::array<float,2>{0.709872425f, 0.067460306f},
-std::array<float,2>{0.437499464f, 0.638780534f},
-std::array<float,2>{0.572622955f, 0.536947489f},
-std::array<float,2>{0.348247051f, 0.153158158f},
-std::array<float,2>{0.801771224f, 0.37431708f},
-std::array<float,2>{0.238324508f, 0.892081559f},
-std::array<float,2>{0.851894438f, 0.731783748f},
-std::array<float,2>{0.151305839f, 0.0611854345f},
-std::array<float,2>{0.538097918f, 0.457979858f},
-std::array<float,2>{0.280070931f, 0.769546211f},
-std::array<float,2>{0.64472878f, 0.968762457f},
-std::array<float,2>{0.495770872f, 0.267393917f},
-std::array<float,2>{0.895307124f, 0.211643934f},
-std::array<float,2>{0.00524320779f, 0.58486861f},
-std::array<float,2>{0.771883547f, 0.926542401f},
-std::array<float,2>{0.209524587f, 0.333000988f},
-std::array<float,2>{0.599653363f, 0.174339026f},
-std::array<float,2>{0.324114472f, 0.505009413f},
-std::array<float,2>{0.719384193f, 0.681261539f},
-std::array<float,2>{0.39499411f, 0.110769756f},
-std::array<float,2>{0.989008427f, 0.376738995f},
-std::array<float,2>{0.0942109898f, 0.81342423f},
-std::array<float,2>{0.91284281f, 0.613792002f},
-std::array<float,2>{0.0345629901f, 0.220389232f},
-std::array<float,2>{0.66489321f, 0.303623021f},
-std::array<float,2>{0.452578813f, 0.946416199f},
-std::array<float,2>{0.52292031f, 0.805041432f},
-std::array<float,2>{0.286748976f, 0.492563128f},
-std::array<float,2>{0.823646903f, 0.0134726483f},
-std::array<float,2>{0.184541747f, 0.717451215f},
-std::array<float,2>{0.944797695f, 0.949500322f},
-std::array<float,2>{0.075207524f, 0.300583452f},
-std::array<float,2>{0.690517306f, 0.2236965f},
-std::array<float,2>{0.410300314f, 0.610991895f},
-std::array<float,2>{0.584351301f, 0.71422714f},
-std::array<float,2>{0.367948323f, 0.00963736698f},
-std::array<float,2>{0.783402622f, 0.497346491f},
-std::array<float,2>{0.226648957f, 0.810632229f},
-std::array<float,2>{0.865830183f, 0.501663625f},
-std::array<float,2>{0.139331669f, 0.176724643f},
-std::array<float,2>{0.55038017f, 0.330587596f},
-std::array<float,2>{0.264276534f, 0.923517644f},
-std::array<float,2>{0.637614667f, 0.81815207f},
-std::array<float,2>{0.482011646f, 0.380229056f},
-std::array<float,2>{0.877625942f, 0.113416635f},
-std::array<float,2>{0.0302110463f, 0.686848462f},
-std::array<float,2>{0.761063635f, 0.767631412f},
-std::array<float,2>{0.192472026f, 0.455251276f},
-std::array<float,2>{0.611809373f, 0.056193348f},
-std::array<float,2>{0.336997986f, 0.728985727f},
-std::array<float,2>{0.739509881f, 0.578895569f},
-std::array<float,2>{0.38870129f, 0.215895623f},
-std::array<float,2>{0.977160871f, 0.271382362f},
-std::array<float,2>{0.109929807f, 0.973000884f},
-std::array<float,2>{0.933609724f, 0.635350227f},
-std::array<float,2>{0.0531846918f, 0.0650621057f},
-std::array<float,2>{0.68491137f, 0.428269953f},
-std::array<float,2>{0.467793405f, 0.857640922f},
-std::array<float,2>{0.515410364f, 0.895688653f},
-std::array<float,2>{0.307725668f, 0.370364785f},
-std::array<float,2>{0.840274632f, 0.151254594f},
-std::array<float,2>{0.165740535f, 0.533613324f},
-std::array<float,2>{0.898647606f, 0.86651051f},
-std::array<float,2>{0.0126757296f, 0.406990856f},
-std::array<float,2>{0.652222395f, 0.0781260356f},
-std::array<float,2>{0.487058133f, 0.648069024f},
-std::array<float,2>{0.543829799f, 0.548829913f},
-std::array<float,2>{0.26639533f, 0.127302706f},
-std::array<float,2>{0.850753248f, 0.354406506f},
-std::array<float,2>{0.143989444f, 0.886161566f},
-std::array<float,2>{0.806421638f, 0.742793202f},
-std::array<float,2>{0.249363616f, 0.040434204f},
-std::array<float,2>{0.568042815f, 0.444797873f},
-std::array<float,2>{0.352646708f, 0.756772399f},
-std::array<float,2>{0.718552649f, 0.995059788f},
-std::array<float,2>{0.422576517f, 0.26075241f},
-std::array<float,2>{0.959086716f, 0.199363202f},
-std::array<float,2>{0.0815465227f, 0.568446398f},
-std::array<float,2>{0.815557361f, 0.915114105f},
-std::array<float,2>{0.175364733f, 0.314688593f},
-std::array<float,2>{0.529099762f, 0.166512102f},
-std::array<float,2>{0.292699009f, 0.523939013f},
-std::array<float,2>{0.662826717f, 0.659866154f},
-std::array<float,2>{0.438067287f, 0.105912812f},
-std::array<float,2>{0.914270997f, 0.405207127f},
-std::array<float,2>{0.0410961546f, 0.841215372f},
-std::array<float,2>{0.992385507f, 0.599388838f},
-std::array<float,2>{0.104837827f, 0.243561596f},
-std::array<float,2>{0.733804345f, 0.290507793f},
-std::array<float,2>{0.398480058f, 0.964559019f},
-std::array<float,2>{0.602319956f, 0.786453664f},
-std::array<float,2>{0.313355565f, 0.474278539f},
-std::array<float,2>{0.77417022f, 0.0203730613f},
-std::array<float,2>{0.217081457f, 0.702096343f},
-std::array<float,2>{0.907955527f, 0.878102958f},
-std::array<float,2>{0.0359847993f, 0.350524396f},
-std::array<float,2>{0.668393791f, 0.135003492f},
-std::array<float,2>{0.448188573f, 0.562298596f},
-std::array<float,2>{0.515864432f, 0.650769472f},
-std::array<float,2>{0.283102632f, 0.0907356516f},
-std::array<float,2>{0.824897707f, 0.420531988f},
-std::array<float,2>{0.180993602f, 0.871343613f},
-std::array<float,2>{0.766263664f, 0.57430315f},
-std::array<float,2>{0.206637055f, 0.193523392f},
-std::array<float,2>{0.595354795f, 0.250193954f},
-std::array<float,2>{0.327480048f, 0.989677727f},
-std::array<float,2>{0.723152399f, 0.765510082f},
-std::array<float,2>{0.392793089f, 0.445620596f},
-std::array<float,2>{0.986410201f, 0.0344054215f},
-std::array<float,2>{0.0980145112f, 0.740383148f},
-std::array<float,2>{0.856524229f, 0.829351246f},
-std::array<float,2>{0.15546295f, 0.394783437f},
-std::array<float,2>{0.533000827f, 0.100433081f},
-std::array<float,2>{0.273515821f, 0.67122817f},
-std::array<float,2>{0.642239332f, 0.516857862f},
-std::array<float,2>{0.499459833f, 0.163184017f},
-std::array<float,2>{0.892634988f, 0.323570251f},
-std::array<float,2>{0.00141134404f, 0.909316659f},
-std::array<float,2>{0.967224479f, 0.694369853f},
-std::array<float,2>{0.088051863f, 0.0283376835f},
-std::array<float,2>{0.703731954f, 0.484328508f},
-std::array<float,2>{0.430163473f, 0.793774009f},
-std::array<float,2>{0.5751037f, 0.953187108f},
-std::array<float,2>{0.346428305f, 0.284469187f},
-std::array<float,2>{0.798508227f, 0.236099005f},
-std::array<float,2>{0.237721547f, 0.607418537f},
-std::array<float,2>{0.970966518f, 0.80352205f},
-std::array<float,2>{0.118278205f, 0.49055782f},
-std::array<float,2>{0.747154713f, 0.00264049391f},
-std::array<float,2>{0.378353685f, 0.704975545f},
-std::array<float,2>{0.621039629f, 0.621256411f},
-std::array<float,2>{0.33274281f, 0.233918205f},
-std::array<float,2>{0.757646799f, 0.308493704f},
-std::array<float,2>{0.19795157f, 0.941432416f},
-std::array<float,2>{0.835485041f, 0.675035477f},
-std::array<float,2>{0.161169007f, 0.119783513f},
-std::array<float,2>{0.503044784f, 0.383732677f},
-std::array<float,2>{0.299027979f, 0.820785522f},
-std::array<float,2>{0.678007722f, 0.935789704f},
-std::array<float,2>{0.458674788f, 0.339758843f},
-std::array<float,2>{0.922696769f, 0.185242802f},
-std::array<float,2>{0.0573829077f, 0.513621509f},
-std::array<float,2>{0.790394902f, 0.976849437f},
-std::array<float,2>{0.220278725f, 0.275357664f},
-std::array<float,2>{0.588869095f, 0.208428979f},
-std::array<float,2>{0.364374965f, 0.588854313f},
-std::array<float,2>{0.699014306f, 0.720380783f},
-std::array<float,2>{0.417884201f, 0.0541049615f},
-std::array<float,2>{0.948356509f, 0.467158943f},
-std::array<float,2>{0.0629978627f, 0.774439037f},
-std::array<float,2>{0.88402158f, 0.540000558f},
-std::array<float,2>{0.0182074104f, 0.145229742f},
-std::array<float,2>{0.631138682f, 0.362988979f},
-std::array<float,2>{0.472916126f, 0.904710948f},
-std::array<float,2>{0.561428666f, 0.843820691f},
-std::array<float,2>{0.251612186f, 0.431767762f},
-std::array<float,2>{0.869036973f, 0.0720849335f},
-std::array<float,2>{0.131637335f, 0.629320145f},
-std::array<float,2>{0.988694251f, 0.929667115f},
-std::array<float,2>{0.0945403054f, 0.335112512f},
-std::array<float,2>{0.71894592f, 0.17288363f},
-std::array<float,2>{0.395382464f, 0.506538987f},
-std::array<float,2>{0.600423038f, 0.68232137f},
-std::array<float,2>{0.323710889f, 0.112040356f},
-std::array<float,2>{0.772034764f, 0.378221184f},
-std::array<float,2>{0.209164202f, 0.816282332f},
-std::array<float,2>{0.82387054f, 0.615897357f},
-std::array<float,2>{0.183836341f, 0.22257109f},
-std::array<float,2>{0.523289084f, 0.302044243f},
-std::array<float,2>{0.286205351f, 0.947366118f},
-std::array<float,2>{0.664481163f, 0.807270825f},
-std::array<float,2>{0.452850878f, 0.494798899f},
-std::array<float,2>{0.912437618f, 0.0149494978f},
-std::array<float,2>{0.035056781f, 0.716017544f},
-std::array<float,2>{0.802493513f, 0.855070949f},
-std::array<float,2>{0.239119589f, 0.423738986f},
-std::array<float,2>{0.573104858f, 0.0695613921f},
-std::array<float,2>{0.347747654f, 0.636908829f},
-std::array<float,2>{0.709438026f, 0.538103342f},
-std::array<float,2>{0.436786652f, 0.155089349f},
-std::array<float,2>{0.964326441f, 0.371429563f},
-std::array<float,2>{0.0934234262f, 0.894281983f},
-std::array<float,2>{0.894986391f, 0.734321713f},
-std::array<float,2>{0.0054510287f, 0.0595175251f},
-std::array<float,2>{0.645331562f, 0.459886491f},
-std::array<float,2>{0.495230824f, 0.771809757f},
-std::array<float,2>{0.538615763f, 0.971758664f},
-std::array<float,2>{0.27932027f, 0.268883735f},
-std::array<float,2>{0.852203906f, 0.214347571f},
-std::array<float,2>{0.150701731f, 0.582308948f},
-std::array<float,2>{0.928585768f, 0.750646055f},
-std::array<float,2>{0.0623088814f, 0.439129055f},
-std::array<float,2>{0.672087848f, 0.0430024043f},
-std::array<float,2>{0.454691112f, 0.749871016f},
-std::array<float,2>{0.506287515f, 0.563037574f},
-std::array<float,2>{0.303863198f, 0.196349874f},
-std::array<float,2>{0.830578983f, 0.263993353f},
-std::array<float,2>{0.1568214f, 0.999295831f},
-std::array<float,2>{0.751588464f, 0.641683102f},
-std::array<float,2>{0.201944172f, 0.0843451843f},
-std::array<float,2>{0.624022901f, 0.41346848f},
-std::array<float,2>{0.330948651f, 0.859403551f},
-std::array<float,2>{0.746052265f, 0.88882941f},
-std::array<float,2>{0.38074556f, 0.356740236f},
-std::array<float,2>{0.973951399f, 0.132152259f},
-std::array<float,2>{0.122423455f, 0.553384781f},
-std::array<float,2>{0.873962164f, 0.965361595f},
-std::array<float,2>{0.125993431f, 0.296560645f},
-std::array<float,2>{0.556499779f, 0.24702704f},
-std::array<float,2>{0.257233351f, 0.597296953f},
-std::array<float,2>{0.626721978f, 0.699207664f},
-std::array<float,2>{0.469550639f, 0.0175083131f},
-std::array<float,2>{0.887350619f, 0.47113356f},
-std::array<float,2>{0.0224633981f, 0.783908486f},
-std::array<float,2>{0.951339841f, 0.529872954f},
-std::array<float,2>{0.0684163049f, 0.170881107f},
-std::array<float,2>{0.702031136f, 0.317554712f},
-std::array<float,2>{0.420602918f, 0.918320298f},
-std::array<float,2>{0.592915714f, 0.836376607f},
-std::array<float,2>{0.360712141f, 0.400526613f},
-std::array<float,2>{0.796007991f, 0.102930821f},
-std::array<float,2>{0.224300072f, 0.660756707f},
-std::array<float,2>{0.880740941f, 0.984977484f},
-std::array<float,2>{0.0234630276f, 0.254368782f},
-std::array<float,2>{0.635952294f, 0.187724248f},
-std::array<float,2>{0.480101913f, 0.572955608f},
-std::array<float,2>{0.551859379f, 0.736672878f},
-std::array<float,2>{0.260147303f, 0.0382122882f},
-std::array<float,2>{0.86268574f, 0.449476838f},
-std::array<float,2>{0.13514623f, 0.759860575f},
-std::array<float,2>{0.788243651f, 0.555504382f},
-std::array<float,2>{0.231579617f, 0.140533224f},
-std::array<float,2>{0.58060801f, 0.344096392f},
-std::array<float,2>{0.37231195f, 0.882562637f},
-std::array<float,2>{0.695061445f, 0.868605077f},
-std::array<float,2>{0.406535685f, 0.417529404f},
-std::array<float,2>{0.939195514f, 0.0873604417f},
-std::array<float,2>{0.071928747f, 0.652374685f},
-std::array<float,2>{0.83684057f, 0.789784074f},
-std::array<float,2>{0.169792995f, 0.479514718f},
-std::array<float,2>{0.511684954f, 0.0252851043f},
-std::array<float,2>{0.311361611f, 0.689238429f},
-std::array<float,2>{0.679903626f, 0.60183531f},
-std::array<float,2>{0.462685317f, 0.239964008f},
-std::array<float,2>{0.932265103f, 0.288205385f},
-std::array<float,2>{0.0502280146f, 0.959532857f},
-std::array<float,2>{0.98064971f, 0.66501987f},
-std::array<float,2>{0.113753885f, 0.0951091349f},
-std::array<float,2>{0.736762345f, 0.392044663f},
-std::array<float,2>{0.384201288f, 0.834549963f},
-std::array<float,2>{0.613757789f, 0.911603928f},
-std::array<float,2>{0.342567176f, 0.324502766f},
-std::array<float,2>{0.764086127f, 0.158552036f},
-std::array<float,2>{0.190949395f, 0.520788252f},
-std::array<float,2>{0.954929113f, 0.825268209f},
-std::array<float,2>{0.0858512297f, 0.389140129f},
-std::array<float,2>{0.711275816f, 0.121543437f},
-std::array<float,2>{0.425792456f, 0.678587437f},
-std::array<float,2>{0.564392269f, 0.508762658f},
-std::array<float,2>{0.355615944f, 0.180998638f},
-std::array<float,2>{0.811103404f, 0.342038274f},
-std::array<float,2>{0.242500439f, 0.93331641f},
-std::array<float,2>{0.847517073f, 0.707280755f},
-std::array<float,2>{0.1480041f, 0.00435315585f},
-std::array<float,2>{0.539510012f, 0.488087833f},
-std::array<float,2>{0.272050768f, 0.799043775f},
-std::array<float,2>{0.653855383f, 0.939471424f},
-std::array<float,2>{0.489843309f, 0.312346816f},
-std::array<float,2>{0.905592561f, 0.226960748f},
-std::array<float,2>{0.00789947528f, 0.620521009f},
-std::array<float,2>{0.778955281f, 0.898889184f},
-std::array<float,2>{0.21336329f, 0.363658875f},
-std::array<float,2>{0.609315276f, 0.144239515f},
-std::array<float,2>{0.320116758f, 0.545850515f},
-std::array<float,2>{0.728619158f, 0.626132369f},
-std::array<float,2>{0.405797809f, 0.0779981092f},
-std::array<float,2>{0.996511579f, 0.436910033f},
-std::array<float,2>{0.105766259f, 0.84846884f},
-std::array<float,2>{0.919907749f, 0.590676665f},
-std::array<float,2>{0.0456333868f, 0.203589812f},
-std::array<float,2>{0.659849346f, 0.280373961f},
-std::array<float,2>{0.443556547f, 0.981651306f},
-std::array<float,2>{0.527319849f, 0.779921412f},
-std::array<float,2>{0.294473231f, 0.462697297f},
-std::array<float,2>{0.817044556f, 0.0499908365f},
-std::array<float,2>{0.176062539f, 0.724747658f},
-std::array<float,2>{0.979375064f, 0.975541711f},
-std::array<float,2>{0.112429023f, 0.272808015f},
-std::array<float,2>{0.741616547f, 0.217471182f},
-std::array<float,2>{0.38752085f, 0.580815375f},
-std::array<float,2>{0.610323846f, 0.727123737f},
-std::array<float,2>{0.339677781f, 0.0574356541f},
-std::array<float,2>{0.759410918f, 0.4542059f},
-std::array<float,2>{0.194227964f, 0.76737535f},
-std::array<float,2>{0.84370786f, 0.531519353f},
-std::array<float,2>{0.167452842f, 0.150305942f},
-std::array<float,2>{0.512430012f, 0.369045973f},
-std::array<float,2>{0.305027336f, 0.896601677f},
-std::array<float,2>{0.686959088f, 0.855857134f},
-std::array<float,2>{0.466602713f, 0.425875187f},
-std::array<float,2>{0.93700701f, 0.0625408962f},
-std::array<float,2>{0.0519978553f, 0.63395685f},
-std::array<float,2>{0.782152653f, 0.809404969f},
-std::array<float,2>{0.229403928f, 0.49863714f},
-std::array<float,2>{0.582287848f, 0.0110582747f},
-std::array<float,2>{0.370468229f, 0.711374164f},
-std::array<float,2>{0.688981891f, 0.611804664f},
-std::array<float,2>{0.412907422f, 0.225077868f},
-std::array<float,2>{0.942270517f, 0.297800869f},
-std::array<float,2>{0.0772236958f, 0.951672435f},
-std::array<float,2>{0.875191092f, 0.684606135f},
-std::array<float,2>{0.0286098234f, 0.115887105f},
-std::array<float,2>{0.639896929f, 0.381259412f},
-std::array<float,2>{0.483988941f, 0.819931149f},
-std::array<float,2>{0.547735035f, 0.924849927f},
-std::array<float,2>{0.26333347f, 0.328450233f},
-std::array<float,2>{0.86473012f, 0.179286733f},
-std::array<float,2>{0.136742055f, 0.502592385f},
-std::array<float,2>{0.917899787f, 0.843602479f},
-std::array<float,2>{0.03944638f, 0.403470069f},
-std::array<float,2>{0.660187423f, 0.1083562f},
-std::array<float,2>{0.441019982f, 0.657330751f},
-std::array<float,2>{0.531208396f, 0.527320802f},
-std::array<float,2>{0.290740222f, 0.164711505f},
-std::array<float,2>{0.814375818f, 0.313228577f},
-std::array<float,2>{0.172350809f, 0.916066289f},
-std::array<float,2>{0.777327061f, 0.69969964f},
-std::array<float,2>{0.215465307f, 0.0220965315f},
-std::array<float,2>{0.604176164f, 0.476145595f},
-std::array<float,2>{0.315874219f, 0.787441552f},
-std::array<float,2>{0.730685115f, 0.961130261f},
-std::array<float,2>{0.401209652f, 0.291231215f},
-std::array<float,2>{0.995421886f, 0.244416699f},
-std::array<float,2>{0.101982191f, 0.599795341f},
-std::array<float,2>{0.849044859f, 0.88431865f},
-std::array<float,2>{0.142085925f, 0.351733625f},
-std::array<float,2>{0.545013249f, 0.125334695f},
-std::array<float,2>{0.269427389f, 0.547952056f},
-std::array<float,2>{0.649346232f, 0.645836771f},
-std::array<float,2>{0.486034989f, 0.0803027228f},
-std::array<float,2>{0.901029289f, 0.408626169f},
-std::array<float,2>{0.0139756091f, 0.864695489f},
-std::array<float,2>{0.957052052f, 0.567209005f},
-std::array<float,2>{0.0786571354f, 0.201870441f},
-std::array<float,2>{0.71623075f, 0.258304298f},
-std::array<float,2>{0.424552292f, 0.993419886f},
-std::array<float,2>{0.569765627f, 0.75460422f},
-std::array<float,2>{0.353985995f, 0.442326963f},
-std::array<float,2>{0.808327436f, 0.0411681458f},
-std::array<float,2>{0.246681839f, 0.745787561f},
-std::array<float,2>{0.892499685f, 0.907724679f},
-std::array<float,2>{0.00356222969f, 0.320522547f},
-std::array<float,2>{0.642682254f, 0.161771312f},
-std::array<float,2>{0.496699363f, 0.517711222f},
-std::array<float,2>{0.534232318f, 0.668532073f},
-std::array<float,2>{0.275719494f, 0.0989872068f},
-std::array<float,2>{0.857551932f, 0.396631896f},
-std::array<float,2>{0.152377084f, 0.830301106f},
-std::array<float,2>{0.800545514f, 0.607817233f},
-std::array<float,2>{0.236180738f, 0.237976223f},
-std::array<float,2>{0.577780843f, 0.282393694f},
-std::array<float,2>{0.345562845f, 0.956107259f},
-std::array<float,2>{0.706798434f, 0.79659903f},
-std::array<float,2>{0.431872547f, 0.482312977f},
-std::array<float,2>{0.965259135f, 0.0305953249f},
-std::array<float,2>{0.0867112055f, 0.691580653f},
-std::array<float,2>{0.827452481f, 0.874474287f},
-std::array<float,2>{0.182904288f, 0.419089735f},
-std::array<float,2>{0.519395888f, 0.0935546458f},
-std::array<float,2>{0.284761399f, 0.64964813f},
-std::array<float,2>{0.670608044f, 0.559068501f},
-std::array<float,2>{0.44567284f, 0.134553954f},
-std::array<float,2>{0.90894568f, 0.348057449f},
-std::array<float,2>{0.037226256f, 0.876419485f},
-std::array<float,2>{0.985983193f, 0.739860237f},
-std::array<float,2>{0.0996803716f, 0.0328350104f},
-std::array<float,2>{0.72633785f, 0.447707564f},
-std::array<float,2>{0.392409295f, 0.762197435f},
-std::array<float,2>{0.595728934f, 0.991411805f},
-std::array<float,2>{0.325846106f, 0.253107965f},
-std::array<float,2>{0.768726707f, 0.191709727f},
-std::array<float,2>{0.204527199f, 0.576312304f},
-std::array<float,2>{0.946101427f, 0.775945783f},
-std::array<float,2>{0.0645240396f, 0.464968473f},
-std::array<float,2>{0.695667446f, 0.0508323461f},
-std::array<float,2>{0.415905863f, 0.722166419f},
-std::array<float,2>{0.587078452f, 0.586035609f},
-std::array<float,2>{0.366735727f, 0.210619748f},
-std::array<float,2>{0.792067945f, 0.276403785f},
-std::array<float,2>{0.221270129f, 0.979572415f},
-std::array<float,2>{0.870127261f, 0.631645858f},
-std::array<float,2>{0.129624546f, 0.0731995851f},
-std::array<float,2>{0.558760226f, 0.430405349f},
-std::array<float,2>{0.252929091f, 0.847612798f},
-std::array<float,2>{0.630512297f, 0.904281914f},
-std::array<float,2>{0.475809604f, 0.360773861f},
-std::array<float,2>{0.885792613f, 0.147948414f},
-std::array<float,2>{0.0171303228f, 0.541932404f},
-std::array<float,2>{0.755168498f, 0.943683445f},
-std::array<float,2>{0.196285158f, 0.30509463f},
-std::array<float,2>{0.61809355f, 0.23115392f},
-std::array<float,2>{0.334718168f, 0.624736965f},
-std::array<float,2>{0.749299109f, 0.706359744f},
-std::array<float,2>{0.375199318f, 0.000547577103f},
-std::array<float,2>{0.970502436f, 0.489787102f},
-std::array<float,2>{0.120843507f, 0.801784575f},
-std::array<float,2>{0.92534405f, 0.514657795f},
-std::array<float,2>{0.0552618131f, 0.185687378f},
-std::array<float,2>{0.676809788f, 0.33729583f},
-std::array<float,2>{0.459207594f, 0.934083939f},
-std::array<float,2>{0.50002557f, 0.822555184f},
-std::array<float,2>{0.297178894f, 0.386600196f},
-std::array<float,2>{0.833229125f, 0.118881606f},
-std::array<float,2>{0.164014325f, 0.673104525f},
-std::array<float,2>{0.962451637f, 0.892424583f},
-std::array<float,2>{0.0899016038f, 0.374914259f},
-std::array<float,2>{0.70864743f, 0.152423725f},
-std::array<float,2>{0.434465617f, 0.536392272f},
-std::array<float,2>{0.571857452f, 0.639280736f},
-std::array<float,2>{0.350925446f, 0.068137534f},
-std::array<float,2>{0.803260505f, 0.425165087f},
-std::array<float,2>{0.24101916f, 0.852229118f},
-std::array<float,2>{0.854257703f, 0.584190905f},
-std::array<float,2>{0.149517402f, 0.210981667f},
-std::array<float,2>{0.535639882f, 0.266822547f},
-std::array<float,2>{0.277495444f, 0.969416916f},
-std::array<float,2>{0.648355842f, 0.770203173f},
-std::array<float,2>{0.493648618f, 0.457406491f},
-std::array<float,2>{0.897206366f, 0.0605500117f},
-std::array<float,2>{0.00665511424f, 0.732217014f},
-std::array<float,2>{0.769646764f, 0.812879562f},
-std::array<float,2>{0.208521232f, 0.376120269f},
-std::array<float,2>{0.597898304f, 0.111293584f},
-std::array<float,2>{0.320403904f, 0.680756271f},
-std::array<float,2>{0.72145772f, 0.505561769f},
-std::array<float,2>{0.398105413f, 0.174293458f},
-std::array<float,2>{0.992146492f, 0.332242638f},
-std::array<float,2>{0.0963695645f, 0.92614466f},
-std::array<float,2>{0.910962701f, 0.716835797f},
-std::array<float,2>{0.0325427689f, 0.0127613917f},
-std::array<float,2>{0.666856587f, 0.493022114f},
-std::array<float,2>{0.450894952f, 0.805204034f},
-std::array<float,2>{0.519579828f, 0.947187424f},
-std::array<float,2>{0.288846552f, 0.302775919f},
-std::array<float,2>{0.822114825f, 0.220052704f},
-std::array<float,2>{0.186408386f, 0.613645077f},
-std::array<float,2>{0.890379786f, 0.782257915f},
-std::array<float,2>{0.0205075759f, 0.470135629f},
-std::array<float,2>{0.627548873f, 0.0194444563f},
-std::array<float,2>{0.471088588f, 0.697250783f},
-std::array<float,2>{0.558528483f, 0.594141781f},
-std::array<float,2>{0.254611403f, 0.249029785f},
-std::array<float,2>{0.871802092f, 0.293456972f},
-std::array<float,2>{0.127795726f, 0.968545735f},
-std::array<float,2>{0.794603527f, 0.662991881f},
-std::array<float,2>{0.226438135f, 0.104425982f},
-std::array<float,2>{0.590287566f, 0.400050253f},
-std::array<float,2>{0.361688495f, 0.839185834f},
-std::array<float,2>{0.699686468f, 0.921795011f},
-std::array<float,2>{0.418343216f, 0.319948792f},
-std::array<float,2>{0.94994688f, 0.16893135f},
-std::array<float,2>{0.067438826f, 0.528585196f},
-std::array<float,2>{0.828141749f, 0.997925758f},
-std::array<float,2>{0.158505812f, 0.263121903f},
-std::array<float,2>{0.50489521f, 0.197624832f},
-std::array<float,2>{0.30139035f, 0.565851927f},
-std::array<float,2>{0.674542308f, 0.74723047f},
-std::array<float,2>{0.456862062f, 0.045214057f},
-std::array<float,2>{0.926047146f, 0.43952772f},
-std::array<float,2>{0.0591097176f, 0.75201416f},
-std::array<float,2>{0.974758685f, 0.552282214f},
-std::array<float,2>{0.124277756f, 0.130851105f},
-std::array<float,2>{0.743090987f, 0.358143181f},
-std::array<float,2>{0.382318765f, 0.888588071f},
-std::array<float,2>{0.622243702f, 0.863139749f},
-std::array<float,2>{0.329622149f, 0.411903441f},
-std::array<float,2>{0.75374347f, 0.0828686059f},
-std::array<float,2>{0.200866327f, 0.642639279f},
-std::array<float,2>{0.929861426f, 0.957745314f},
-std::array<float,2>{0.04698845f, 0.286486655f},
-std::array<float,2>{0.682104647f, 0.24062711f},
-std::array<float,2>{0.463451535f, 0.603956759f},
-std::array<float,2>{0.509085536f, 0.69002825f},
-std::array<float,2>{0.309247822f, 0.0271464977f},
-std::array<float,2>{0.838651478f, 0.476753205f},
-std::array<float,2>{0.171656787f, 0.79245162f},
-std::array<float,2>{0.761889935f, 0.522128344f},
-std::array<float,2>{0.187841982f, 0.157494843f},
-std::array<float,2>{0.615662336f, 0.326280534f},
-std::array<float,2>{0.340406597f, 0.912516773f},
-std::array<float,2>{0.735028028f, 0.832150698f},
-std::array<float,2>{0.386702716f, 0.393049359f},
-std::array<float,2>{0.983287513f, 0.0967556164f},
-std::array<float,2>{0.115452237f, 0.667093098f},
-std::array<float,2>{0.859997451f, 0.759218693f},
-std::array<float,2>{0.133893207f, 0.451218873f},
-std::array<float,2>{0.552974641f, 0.036936786f},
-std::array<float,2>{0.259709358f, 0.734458566f},
-std::array<float,2>{0.63373667f, 0.57164073f},
-std::array<float,2>{0.477228433f, 0.191270903f},
-std::array<float,2>{0.881515086f, 0.256142616f},
-std::array<float,2>{0.0260012653f, 0.988025665f},
-std::array<float,2>{0.940123618f, 0.655349731f},
-std::array<float,2>{0.0738518164f, 0.0888972357f},
-std::array<float,2>{0.693254173f, 0.414809614f},
-std::array<float,2>{0.408763438f, 0.869336247f},
-std::array<float,2>{0.578172743f, 0.880247593f},
-std::array<float,2>{0.373604715f, 0.346541554f},
-std::array<float,2>{0.78643328f, 0.138306186f},
-std::array<float,2>{0.233857766f, 0.558438659f},
-std::array<float,2>{0.998809218f, 0.850422859f},
-std::array<float,2>{0.108507358f, 0.433883339f},
-std::array<float,2>{0.727240026f, 0.0755780786f},
-std::array<float,2>{0.403315574f, 0.628883362f},
-std::array<float,2>{0.605941951f, 0.544761479f},
-std::array<float,2>{0.316939771f, 0.141480446f},
-std::array<float,2>{0.780624866f, 0.365639508f},
-std::array<float,2>{0.211296052f, 0.902278781f},
-std::array<float,2>{0.819561362f, 0.724433839f},
-std::array<float,2>{0.17923221f, 0.0478267223f},
-std::array<float,2>{0.523605943f, 0.463047475f},
-std::array<float,2>{0.295995891f, 0.778335273f},
-std::array<float,2>{0.656842411f, 0.984077334f},
-std::array<float,2>{0.442822069f, 0.278169453f},
-std::array<float,2>{0.92139858f, 0.205181524f},
-std::array<float,2>{0.0439369716f, 0.592931688f},
-std::array<float,2>{0.808671653f, 0.931461811f},
-std::array<float,2>{0.245734915f, 0.340718776f},
-std::array<float,2>{0.564660966f, 0.182566226f},
-std::array<float,2>{0.358107924f, 0.510510623f},
-std::array<float,2>{0.714182675f, 0.676197648f},
-std::array<float,2>{0.428269058f, 0.123831451f},
-std::array<float,2>{0.956576824f, 0.387854278f},
-std::array<float,2>{0.0828450695f, 0.828122675f},
-std::array<float,2>{0.90388006f, 0.617857933f},
-std::array<float,2>{0.00992704555f, 0.229906172f},
-std::array<float,2>{0.656111062f, 0.309983402f},
-std::array<float,2>{0.491858542f, 0.938727379f},
-std::array<float,2>{0.542699695f, 0.797395766f},
-std::array<float,2>{0.27100426f, 0.484558165f},
-std::array<float,2>{0.845139503f, 0.00677742297f},
-std::array<float,2>{0.145644307f, 0.710053861f},
-std::array<float,2>{0.99422276f, 0.963150203f},
-std::array<float,2>{0.103117794f, 0.28921786f},
-std::array<float,2>{0.731849909f, 0.242758349f},
-std::array<float,2>{0.401775479f, 0.598514557f},
-std::array<float,2>{0.604926884f, 0.702418089f},
-std::array<float,2>{0.315017819f, 0.0211683847f},
-std::array<float,2>{0.776152492f, 0.472852796f},
-std::array<float,2>{0.216221869f, 0.785951793f},
-std::array<float,2>{0.813079476f, 0.524618387f},
-std::array<float,2>{0.173046142f, 0.16792725f},
-std::array<float,2>{0.529904246f, 0.315935075f},
-std::array<float,2>{0.289471686f, 0.914457202f},
-std::array<float,2>{0.661456287f, 0.84029752f},
-std::array<float,2>{0.440079272f, 0.405532539f},
-std::array<float,2>{0.916202486f, 0.106788076f},
-std::array<float,2>{0.0408987291f, 0.659082115f},
-std::array<float,2>{0.807501078f, 0.757285833f},
-std::array<float,2>{0.247532606f, 0.444003105f},
-std::array<float,2>{0.568947971f, 0.0391805992f},
-std::array<float,2>{0.355248183f, 0.744013608f},
-std::array<float,2>{0.715224028f, 0.570106447f},
-std::array<float,2>{0.42482245f, 0.200734809f},
-std::array<float,2>{0.958298326f, 0.260307789f},
-std::array<float,2>{0.0798356459f, 0.995328963f},
-std::array<float,2>{0.902195156f, 0.646702111f},
-std::array<float,2>{0.0151976719f, 0.0794759393f},
-std::array<float,2>{0.64959538f, 0.407611847f},
-std::array<float,2>{0.48526299f, 0.865762174f},
-std::array<float,2>{0.546429455f, 0.885495186f},
-std::array<float,2>{0.267780483f, 0.354682267f},
-std::array<float,2>{0.848338664f, 0.128281206f},
-std::array<float,2>{0.140635103f, 0.549859166f},
-std::array<float,2>{0.936223686f, 0.858727217f},
-std::array<float,2>{0.051540073f, 0.429522395f},
-std::array<float,2>{0.686235368f, 0.0660535842f},
-std::array<float,2>{0.465182453f, 0.636335492f},
-std::array<float,2>{0.513540983f, 0.534402251f},
-std::array<float,2>{0.306545198f, 0.151786104f},
-std::array<float,2>{0.842453837f, 0.369880348f},
-std::array<float,2>{0.166085675f, 0.894835234f},
-std::array<float,2>{0.758142948f, 0.730244577f},
-std::array<float,2>{0.194453627f, 0.0549702719f},
-std::array<float,2>{0.610498726f, 0.4567931f},
-std::array<float,2>{0.338785887f, 0.768792331f},
-std::array<float,2>{0.741204321f, 0.973657668f},
-std::array<float,2>{0.388329923f, 0.270164132f},
-std::array<float,2>{0.980351686f, 0.215243772f},
-std::array<float,2>{0.11154969f, 0.579514563f},
-std::array<float,2>{0.864191055f, 0.922189415f},
-std::array<float,2>{0.13828896f, 0.331186354f},
-std::array<float,2>{0.548438072f, 0.177718863f},
-std::array<float,2>{0.262428582f, 0.500696361f},
-std::array<float,2>{0.639032602f, 0.685903132f},
-std::array<float,2>{0.483190954f, 0.115165204f},
-std::array<float,2>{0.876006484f, 0.379603684f},
-std::array<float,2>{0.0281523596f, 0.81667459f},
-std::array<float,2>{0.94332689f, 0.609407306f},
-std::array<float,2>{0.0762682483f, 0.22282283f},
-std::array<float,2>{0.687995732f, 0.299572408f},
-std::array<float,2>{0.41371572f, 0.950236082f},
-std::array<float,2>{0.583804011f, 0.811767936f},
-std::array<float,2>{0.369385988f, 0.496261328f},
-std::array<float,2>{0.782376051f, 0.00829281937f},
-std::array<float,2>{0.230325848f, 0.712925971f},
-std::array<float,2>{0.884909809f, 0.905577302f},
-std::array<float,2>{0.0165133476f, 0.361662239f},
-std::array<float,2>{0.62923491f, 0.146265402f},
-std::array<float,2>{0.474903017f, 0.540319622f},
-std::array<float,2>{0.560005605f, 0.630077422f},
-std::array<float,2>{0.252950817f, 0.0712566748f},
-std::array<float,2>{0.869623661f, 0.432844192f},
-std::array<float,2>{0.130026698f, 0.844786644f},
-std::array<float,2>{0.791153967f, 0.58946979f},
-std::array<float,2>{0.22232382f, 0.207666844f},
-std::array<float,2>{0.586167872f, 0.273797333f},
-std::array<float,2>{0.365470529f, 0.977839291f},
-std::array<float,2>{0.696956038f, 0.773883104f},
-std::array<float,2>{0.414153457f, 0.468662322f},
-std::array<float,2>{0.946698844f, 0.0528704412f},
-std::array<float,2>{0.0661560297f, 0.718934119f},
-std::array<float,2>{0.832648456f, 0.822057784f},
-std::array<float,2>{0.162370026f, 0.38438645f},
-std::array<float,2>{0.501677215f, 0.12092571f},
-std::array<float,2>{0.298458934f, 0.673954129f},
-std::array<float,2>{0.676497579f, 0.511912704f},
-std::array<float,2>{0.460531294f, 0.184330806f},
-std::array<float,2>{0.923891187f, 0.33867231f},
-std::array<float,2>{0.0560819916f, 0.936736643f},
-std::array<float,2>{0.969181955f, 0.703722f},
-std::array<float,2>{0.119594678f, 0.00376567896f},
-std::array<float,2>{0.748357534f, 0.491563499f},
-std::array<float,2>{0.376575917f, 0.804167867f},
-std::array<float,2>{0.618454278f, 0.942534089f},
-std::array<float,2>{0.33551985f, 0.306754947f},
-std::array<float,2>{0.754734814f, 0.233018458f},
-std::array<float,2>{0.197218269f, 0.622631848f},
-std::array<float,2>{0.966149628f, 0.794477463f},
-std::array<float,2>{0.0872453451f, 0.482899666f},
-std::array<float,2>{0.705946803f, 0.0277692694f},
-std::array<float,2>{0.433315933f, 0.693479657f},
-std::array<float,2>{0.577106953f, 0.605686903f},
-std::array<float,2>{0.343901813f, 0.234943867f},
-std::array<float,2>{0.799632728f, 0.283308655f},
-std::array<float,2>{0.235272899f, 0.954378963f},
-std::array<float,2>{0.858420491f, 0.670554459f},
-std::array<float,2>{0.153323099f, 0.101115294f},
-std::array<float,2>{0.533480585f, 0.395562202f},
-std::array<float,2>{0.276934892f, 0.828257501f},
-std::array<float,2>{0.644432485f, 0.908455551f},
-std::array<float,2>{0.497196108f, 0.323110431f},
-std::array<float,2>{0.891058147f, 0.162833169f},
-std::array<float,2>{0.00230009039f, 0.515798748f},
-std::array<float,2>{0.767654598f, 0.988896549f},
-std::array<float,2>{0.203785315f, 0.251935542f},
-std::array<float,2>{0.596889138f, 0.195189103f},
-std::array<float,2>{0.324642956f, 0.575677693f},
-std::array<float,2>{0.725191772f, 0.741721749f},
-std::array<float,2>{0.391068697f, 0.0340625718f},
-std::array<float,2>{0.98461771f, 0.447041333f},
-std::array<float,2>{0.101453088f, 0.764469922f},
-std::array<float,2>{0.909439981f, 0.560999095f},
-std::array<float,2>{0.038807109f, 0.13642931f},
-std::array<float,2>{0.671402156f, 0.351042956f},
-std::array<float,2>{0.446929246f, 0.877111614f},
-std::array<float,2>{0.517841578f, 0.872511268f},
-std::array<float,2>{0.284050643f, 0.421810955f},
-std::array<float,2>{0.826300561f, 0.091795899f},
-std::array<float,2>{0.182102695f, 0.651583731f},
-std::array<float,2>{0.951044977f, 0.919699311f},
-std::array<float,2>{0.0667927787f, 0.316902488f},
-std::array<float,2>{0.70076865f, 0.171655387f},
-std::array<float,2>{0.419634372f, 0.530390739f},
-std::array<float,2>{0.591443956f, 0.661461651f},
-std::array<float,2>{0.362329811f, 0.102279112f},
-std::array<float,2>{0.793637931f, 0.401695848f},
-std::array<float,2>{0.224954009f, 0.837430418f},
-std::array<float,2>{0.872080505f, 0.596095383f},
-std::array<float,2>{0.12796174f, 0.247496352f},
-std::array<float,2>{0.55703342f, 0.295090169f},
-std::array<float,2>{0.255770504f, 0.966646254f},
-std::array<float,2>{0.628433585f, 0.784438848f},
-std::array<float,2>{0.472305506f, 0.472526401f},
-std::array<float,2>{0.889046311f, 0.0165344328f},
-std::array<float,2>{0.0213633105f, 0.697399795f},
-std::array<float,2>{0.752421439f, 0.861193895f},
-std::array<float,2>{0.199643418f, 0.412684679f},
-std::array<float,2>{0.622011483f, 0.0857752562f},
-std::array<float,2>{0.328929007f, 0.640766621f},
-std::array<float,2>{0.744131982f, 0.553991377f},
-std::array<float,2>{0.381810427f, 0.131071836f},
-std::array<float,2>{0.975853562f, 0.356417626f},
-std::array<float,2>{0.123950906f, 0.890304208f},
-std::array<float,2>{0.927641749f, 0.74900943f},
-std::array<float,2>{0.0599021241f, 0.0442719646f},
-std::array<float,2>{0.675762713f, 0.438089103f},
-std::array<float,2>{0.45559749f, 0.751691461f},
-std::array<float,2>{0.504784167f, 0.998857021f},
-std::array<float,2>{0.301852673f, 0.264666378f},
-std::array<float,2>{0.829784572f, 0.195691705f},
-std::array<float,2>{0.15949744f, 0.563959241f},
-std::array<float,2>{0.897670567f, 0.773260832f},
-std::array<float,2>{0.00768004358f, 0.460903943f},
-std::array<float,2>{0.646553993f, 0.0597607009f},
-std::array<float,2>{0.492509604f, 0.733389199f},
-std::array<float,2>{0.537036419f, 0.58330512f},
-std::array<float,2>{0.278671592f, 0.213331327f},
-std::array<float,2>{0.854721427f, 0.267870814f},
-std::array<float,2>{0.148979217f, 0.971359909f},
-std::array<float,2>{0.804027915f, 0.638083518f},
-std::array<float,2>{0.24168773f, 0.0691869035f},
-std::array<float,2>{0.57108444f, 0.421924949f},
-std::array<float,2>{0.350089699f, 0.85391885f},
-std::array<float,2>{0.707905471f, 0.892817616f},
-std::array<float,2>{0.435273916f, 0.372779101f},
-std::array<float,2>{0.961331069f, 0.155460805f},
-std::array<float,2>{0.0914311633f, 0.537698984f},
-std::array<float,2>{0.820698678f, 0.948783576f},
-std::array<float,2>{0.186795384f, 0.30164516f},
-std::array<float,2>{0.521252811f, 0.221358299f},
-std::array<float,2>{0.287171513f, 0.616661012f},
-std::array<float,2>{0.667889535f, 0.715791047f},
-std::array<float,2>{0.449272573f, 0.0144811226f},
-std::array<float,2>{0.911337852f, 0.495490342f},
-std::array<float,2>{0.0312524289f, 0.808291912f},
-std::array<float,2>{0.99036926f, 0.507641613f},
-std::array<float,2>{0.0968372449f, 0.172519758f},
-std::array<float,2>{0.721922934f, 0.334606647f},
-std::array<float,2>{0.39746049f, 0.928579807f},
-std::array<float,2>{0.598904252f, 0.815407336f},
-std::array<float,2>{0.322087705f, 0.376993209f},
-std::array<float,2>{0.770872831f, 0.112461269f},
-std::array<float,2>{0.207510531f, 0.68277061f},
-std::array<float,2>{0.920386136f, 0.980985641f},
-std::array<float,2>{0.0445539393f, 0.279555112f},
-std::array<float,2>{0.657334328f, 0.204329282f},
-std::array<float,2>{0.441676825f, 0.591275692f},
-std::array<float,2>{0.524452269f, 0.72585845f},
-std::array<float,2>{0.295820147f, 0.0493440889f},
-std::array<float,2>{0.818697691f, 0.460970193f},
-std::array<float,2>{0.178270638f, 0.780614555f},
-std::array<float,2>{0.779769301f, 0.546489537f},
-std::array<float,2>{0.21207346f, 0.143166527f},
-std::array<float,2>{0.606688559f, 0.364593655f},
-std::array<float,2>{0.318015248f, 0.899886072f},
-std::array<float,2>{0.728470027f, 0.848954141f},
-std::array<float,2>{0.403634101f, 0.436086416f},
-std::array<float,2>{0.999174595f, 0.0770582929f},
-std::array<float,2>{0.107429661f, 0.625674844f},
-std::array<float,2>{0.844351649f, 0.800492108f},
-std::array<float,2>{0.145050377f, 0.487002045f},
-std::array<float,2>{0.54129535f, 0.00523402588f},
-std::array<float,2>{0.270290017f, 0.708768606f},
-std::array<float,2>{0.65499568f, 0.619489372f},
-std::array<float,2>{0.490623713f, 0.227646902f},
-std::array<float,2>{0.903284669f, 0.31150341f},
-std::array<float,2>{0.0111392234f, 0.940977037f},
-std::array<float,2>{0.955193222f, 0.678973496f},
-std::array<float,2>{0.083637394f, 0.12271288f},
-std::array<float,2>{0.713168681f, 0.389746785f},
-std::array<float,2>{0.429666966f, 0.824228644f},
-std::array<float,2>{0.566153526f, 0.93184793f},
-std::array<float,2>{0.359142751f, 0.34338069f},
-std::array<float,2>{0.809976697f, 0.180053487f},
-std::array<float,2>{0.244387165f, 0.508948386f},
-std::array<float,2>{0.983628631f, 0.835672319f},
-std::array<float,2>{0.116676398f, 0.390794784f},
-std::array<float,2>{0.735493541f, 0.0941931754f},
-std::array<float,2>{0.384923995f, 0.665948987f},
-std::array<float,2>{0.616586447f, 0.520127356f},
-std::array<float,2>{0.341788352f, 0.160091579f},
-std::array<float,2>{0.763271093f, 0.325787574f},
-std::array<float,2>{0.18853344f, 0.910871446f},
-std::array<float,2>{0.839258492f, 0.688426197f},
-std::array<float,2>{0.170730963f, 0.0235593095f},
-std::array<float,2>{0.508760929f, 0.47877118f},
-std::array<float,2>{0.310312539f, 0.79073143f},
-std::array<float,2>{0.682744861f, 0.960009634f},
-std::array<float,2>{0.463881105f, 0.288037539f},
-std::array<float,2>{0.93089664f, 0.238697618f},
-std::array<float,2>{0.0486244597f, 0.602646351f},
-std::array<float,2>{0.785736501f, 0.881032526f},
-std::array<float,2>{0.233172178f, 0.345131069f},
-std::array<float,2>{0.579239368f, 0.139465883f},
-std::array<float,2>{0.374743104f, 0.556216061f},
-std::array<float,2>{0.692201793f, 0.653535604f},
-std::array<float,2>{0.409537703f, 0.0863804594f},
-std::array<float,2>{0.941175699f, 0.416751832f},
-std::array<float,2>{0.0729784295f, 0.86747545f},
-std::array<float,2>{0.882724285f, 0.573318243f},
-std::array<float,2>{0.0264501534f, 0.189223453f},
-std::array<float,2>{0.634577751f, 0.255061686f},
-std::array<float,2>{0.478204817f, 0.985638022f},
-std::array<float,2>{0.553971589f, 0.760834038f},
-std::array<float,2>{0.258472621f, 0.450412005f},
-std::array<float,2>{0.860449076f, 0.0376118645f},
-std::array<float,2>{0.133552969f, 0.738049984f},
-std::array<float,2>{0.96089083f, 0.992665827f},
-std::array<float,2>{0.0803593919f, 0.259060204f},
-std::array<float,2>{0.717744231f, 0.202350661f},
-std::array<float,2>{0.423225522f, 0.56763494f},
-std::array<float,2>{0.567208707f, 0.744620204f},
-std::array<float,2>{0.352058113f, 0.0429098122f},
-std::array<float,2>{0.805511832f, 0.44270274f},
-std::array<float,2>{0.248242274f, 0.755591214f},
-std::array<float,2>{0.849681854f, 0.546966255f},
-std::array<float,2>{0.143136173f, 0.126676291f},
-std::array<float,2>{0.544709027f, 0.352978259f},
-std::array<float,2>{0.26715371f, 0.88288939f},
-std::array<float,2>{0.651339293f, 0.863394856f},
-std::array<float,2>{0.487782955f, 0.409341455f},
-std::array<float,2>{0.900137961f, 0.081301786f},
-std::array<float,2>{0.0136321746f, 0.644980133f},
-std::array<float,2>{0.774961591f, 0.788181126f},
-std::array<float,2>{0.218186513f, 0.47511667f},
-std::array<float,2>{0.60343349f, 0.0225676373f},
-std::array<float,2>{0.313613564f, 0.700205564f},
-std::array<float,2>{0.732754827f, 0.600641787f},
-std::array<float,2>{0.40031141f, 0.245222509f},
-std::array<float,2>{0.993735135f, 0.292617112f},
-std::array<float,2>{0.104094803f, 0.962437034f},
-std::array<float,2>{0.915174127f, 0.656670809f},
-std::array<float,2>{0.0421135649f, 0.108837269f},
-std::array<float,2>{0.663493037f, 0.403048784f},
-std::array<float,2>{0.439177781f, 0.841996193f},
-std::array<float,2>{0.527649522f, 0.917679667f},
-std::array<float,2>{0.291885376f, 0.314242095f},
-std::array<float,2>{0.815339148f, 0.165525794f},
-std::array<float,2>{0.174328819f, 0.525713801f},
-std::array<float,2>{0.878693342f, 0.818429291f},
-std::array<float,2>{0.0305054914f, 0.381921977f},
-std::array<float,2>{0.638192475f, 0.116220966f},
-std::array<float,2>{0.48095119f, 0.683968186f},
-std::array<float,2>{0.549570262f, 0.503370225f},
-std::array<float,2>{0.265341461f, 0.177745476f},
-std::array<float,2>{0.866360307f, 0.329852492f},
-std::array<float,2>{0.140375212f, 0.924652696f},
-std::array<float,2>{0.784730017f, 0.711917043f},
-std::array<float,2>{0.227610111f, 0.0103505468f},
-std::array<float,2>{0.58539474f, 0.499056667f},
-std::array<float,2>{0.368731141f, 0.809951127f},
-std::array<float,2>{0.689873219f, 0.952991128f},
-std::array<float,2>{0.411375791f, 0.298092723f},
-std::array<float,2>{0.944257855f, 0.226496667f},
-std::array<float,2>{0.0744831488f, 0.612654507f},
-std::array<float,2>{0.841567218f, 0.898029447f},
-std::array<float,2>{0.164434046f, 0.367340297f},
-std::array<float,2>{0.514131784f, 0.148743749f},
-std::array<float,2>{0.307309508f, 0.532671452f},
-std::array<float,2>{0.684282422f, 0.633716941f},
-std::array<float,2>{0.46715501f, 0.0639328137f},
-std::array<float,2>{0.935197234f, 0.427136868f},
-std::array<float,2>{0.0539997034f, 0.857327044f},
-std::array<float,2>{0.977790892f, 0.581908941f},
-std::array<float,2>{0.111189857f, 0.218586564f},
-std::array<float,2>{0.739227712f, 0.271791518f},
-std::array<float,2>{0.390296578f, 0.97585988f},
-std::array<float,2>{0.612344146f, 0.766224265f},
-std::array<float,2>{0.336585701f, 0.454028994f},
-std::array<float,2>{0.760646105f, 0.0581171736f},
-std::array<float,2>{0.191959247f, 0.728004396f},
-std::array<float,2>{0.922864914f, 0.934570551f},
-std::array<float,2>{0.0577202663f, 0.336561352f},
-std::array<float,2>{0.67920661f, 0.186748385f},
-std::array<float,2>{0.457989007f, 0.514354408f},
-std::array<float,2>{0.502389133f, 0.672692478f},
-std::array<float,2>{0.300559998f, 0.117672674f},
-std::array<float,2>{0.834941387f, 0.384859979f},
-std::array<float,2>{0.160231873f, 0.82379806f},
-std::array<float,2>{0.756801367f, 0.623800993f},
-std::array<float,2>{0.198406518f, 0.232011825f},
-std::array<float,2>{0.619194746f, 0.306482285f},
-std::array<float,2>{0.333385766f, 0.945048153f},
-std::array<float,2>{0.746388376f, 0.80137378f},
-std::array<float,2>{0.37787354f, 0.488773823f},
-std::array<float,2>{0.97214222f, 0.00146108563f},
-std::array<float,2>{0.118028685f, 0.705218554f},
-std::array<float,2>{0.867516398f, 0.846264541f},
-std::array<float,2>{0.132340297f, 0.43154192f},
-std::array<float,2>{0.562002122f, 0.0732448325f},
-std::array<float,2>{0.250639319f, 0.632639945f},
-std::array<float,2>{0.631970704f, 0.542681217f},
-std::array<float,2>{0.473668814f, 0.147095725f},
-std::array<float,2>{0.883534431f, 0.359461993f},
-std::array<float,2>{0.0191101581f, 0.902916968f},
-std::array<float,2>{0.947651565f, 0.721073508f},
-std::array<float,2>{0.0643182993f, 0.0524582416f},
-std::array<float,2>{0.697462976f, 0.466314912f},
-std::array<float,2>{0.416533172f, 0.776424408f},
-std::array<float,2>{0.588124871f, 0.979077637f},
-std::array<float,2>{0.364194125f, 0.275757939f},
-std::array<float,2>{0.789966524f, 0.209187239f},
-std::array<float,2>{0.219059557f, 0.587559879f},
-std::array<float,2>{0.987867117f, 0.763613582f},
-std::array<float,2>{0.0995271653f, 0.44869101f},
-std::array<float,2>{0.724304438f, 0.032036867f},
-std::array<float,2>{0.394257665f, 0.73897773f},
-std::array<float,2>{0.594533205f, 0.577179372f},
-std::array<float,2>{0.327114969f, 0.193232015f},
-std::array<float,2>{0.767308712f, 0.252358675f},
-std::array<float,2>{0.205806047f, 0.991143823f},
-std::array<float,2>{0.825270236f, 0.648909807f},
-std::array<float,2>{0.180027172f, 0.092618145f},
-std::array<float,2>{0.517047405f, 0.418397784f},
-std::array<float,2>{0.282109916f, 0.873937666f},
-std::array<float,2>{0.669907451f, 0.875146627f},
-std::array<float,2>{0.448811203f, 0.34943068f},
-std::array<float,2>{0.906455219f, 0.13293539f},
-std::array<float,2>{0.0370830148f, 0.560198963f},
-std::array<float,2>{0.797215104f, 0.955376625f},
-std::array<float,2>{0.237182274f, 0.281681269f},
-std::array<float,2>{0.575751543f, 0.236662045f},
-std::array<float,2>{0.346869916f, 0.609275341f},
-std::array<float,2>{0.704365849f, 0.693032444f},
-std::array<float,2>{0.431495219f, 0.0294122305f},
-std::array<float,2>{0.967978358f, 0.481085062f},
-std::array<float,2>{0.0894590467f, 0.795321643f},
-std::array<float,2>{0.8937639f, 0.518733382f},
-std::array<float,2>{0.00042817925f, 0.160936147f},
-std::array<float,2>{0.641058862f, 0.321852714f},
-std::array<float,2>{0.498748034f, 0.906823158f},
-std::array<float,2>{0.532012343f, 0.831498384f},
-std::array<float,2>{0.274727464f, 0.398276508f},
-std::array<float,2>{0.856146574f, 0.0977461487f},
-std::array<float,2>{0.154888704f, 0.669648647f},
-std::array<float,2>{0.972901106f, 0.887034595f},
-std::array<float,2>{0.121392816f, 0.358640105f},
-std::array<float,2>{0.744853139f, 0.129120857f},
-std::array<float,2>{0.379747033f, 0.550947964f},
-std::array<float,2>{0.624936223f, 0.64389199f},
-std::array<float,2>{0.331162393f, 0.0836605579f},
-std::array<float,2>{0.750398695f, 0.411063194f},
-std::array<float,2>{0.202367485f, 0.861720562f},
-std::array<float,2>{0.831646681f, 0.565211594f},
-std::array<float,2>{0.157638744f, 0.199032754f},
-std::array<float,2>{0.507234991f, 0.262227893f},
-std::array<float,2>{0.302929759f, 0.996475041f},
-std::array<float,2>{0.673798263f, 0.75313586f},
-std::array<float,2>{0.45389396f, 0.440872282f},
-std::array<float,2>{0.929220021f, 0.0463764593f},
-std::array<float,2>{0.0606343895f, 0.746374011f},
-std::array<float,2>{0.795786679f, 0.838445067f},
-std::array<float,2>{0.223260775f, 0.398577392f},
-std::array<float,2>{0.592239022f, 0.10469465f},
-std::array<float,2>{0.359727979f, 0.663221598f},
-std::array<float,2>{0.702781618f, 0.528241158f},
-std::array<float,2>{0.421340317f, 0.169209018f},
-std::array<float,2>{0.95291096f, 0.318988383f},
-std::array<float,2>{0.0694532767f, 0.920489252f},
-std::array<float,2>{0.887925923f, 0.696172893f},
-std::array<float,2>{0.0222678203f, 0.0180682987f},
-std::array<float,2>{0.625672996f, 0.469450474f},
-std::array<float,2>{0.470303327f, 0.781849146f},
-std::array<float,2>{0.554697931f, 0.967245281f},
-std::array<float,2>{0.256079108f, 0.294801801f},
-std::array<float,2>{0.874180019f, 0.248266444f},
-std::array<float,2>{0.125710487f, 0.595304251f},
-std::array<float,2>{0.91369319f, 0.805904567f},
-std::array<float,2>{0.0333765f, 0.493988007f},
-std::array<float,2>{0.665585935f, 0.0121435449f},
-std::array<float,2>{0.452003628f, 0.718436837f},
-std::array<float,2>{0.522063315f, 0.614403486f},
-std::array<float,2>{0.28523162f, 0.21920602f},
-std::array<float,2>{0.822321415f, 0.304655552f},
-std::array<float,2>{0.185226858f, 0.945507646f},
-std::array<float,2>{0.773330092f, 0.679807425f},
-std::array<float,2>{0.210767657f, 0.109492868f},
-std::array<float,2>{0.600983799f, 0.375137538f},
-std::array<float,2>{0.322943002f, 0.813836455f},
-std::array<float,2>{0.720324337f, 0.927472353f},
-std::array<float,2>{0.395927757f, 0.333842933f},
-std::array<float,2>{0.989460468f, 0.175481871f},
-std::array<float,2>{0.095600374f, 0.504151881f},
-std::array<float,2>{0.852691233f, 0.969914258f},
-std::array<float,2>{0.151831001f, 0.265899628f},
-std::array<float,2>{0.537142932f, 0.212750733f},
-std::array<float,2>{0.280275643f, 0.585186541f},
-std::array<float,2>{0.645659864f, 0.730820358f},
-std::array<float,2>{0.494822294f, 0.0615358092f},
-std::array<float,2>{0.89576f, 0.458339036f},
-std::array<float,2>{0.00401465548f, 0.770667672f},
-std::array<float,2>{0.963704944f, 0.535620749f},
-std::array<float,2>{0.0918130577f, 0.154008374f},
-std::array<float,2>{0.710344911f, 0.373527169f},
-std::array<float,2>{0.436487496f, 0.891436875f},
-std::array<float,2>{0.57382375f, 0.853362978f},
-std::array<float,2>{0.349145114f, 0.423948556f},
-std::array<float,2>{0.801457524f, 0.0669687539f},
-std::array<float,2>{0.240221784f, 0.6404562f},
-std::array<float,2>{0.905262589f, 0.938159108f},
-std::array<float,2>{0.00883352291f, 0.30864197f},
-std::array<float,2>{0.652599156f, 0.229227588f},
-std::array<float,2>{0.488372892f, 0.619039357f},
-std::array<float,2>{0.540814936f, 0.709195316f},
-std::array<float,2>{0.273162335f, 0.00761711411f},
-std::array<float,2>{0.846632302f, 0.485832572f},
-std::array<float,2>{0.146649644f, 0.798614979f},
-std::array<float,2>{0.811841309f, 0.510918021f},
-std::array<float,2>{0.243991971f, 0.183007658f},
-std::array<float,2>{0.563168168f, 0.341045916f},
-std::array<float,2>{0.356813759f, 0.930219233f},
-std::array<float,2>{0.712304294f, 0.827009797f},
-std::array<float,2>{0.427272201f, 0.387621343f},
-std::array<float,2>{0.95349288f, 0.124513693f},
-std::array<float,2>{0.0848163888f, 0.677499175f},
-std::array<float,2>{0.817640483f, 0.778039336f},
-std::array<float,2>{0.177359194f, 0.46462363f},
-std::array<float,2>{0.525559247f, 0.0481184646f},
-std::array<float,2>{0.293718874f, 0.723186433f},
-std::array<float,2>{0.658470631f, 0.59221679f},
-std::array<float,2>{0.444366872f, 0.206973895f},
-std::array<float,2>{0.918753862f, 0.278881222f},
-std::array<float,2>{0.0468721278f, 0.982561588f},
-std::array<float,2>{0.997442484f, 0.627074897f},
-std::array<float,2>{0.106686212f, 0.0743865892f},
-std::array<float,2>{0.73045069f, 0.434758425f},
-std::array<float,2>{0.404781908f, 0.851467967f},
-std::array<float,2>{0.608139157f, 0.900780737f},
-std::array<float,2>{0.318938971f, 0.366641492f},
-std::array<float,2>{0.777423441f, 0.141883299f},
-std::array<float,2>{0.214469105f, 0.543526053f},
-std::array<float,2>{0.938404918f, 0.870458424f},
-std::array<float,2>{0.0708731189f, 0.415262729f},
-std::array<float,2>{0.693574548f, 0.0881445035f},
-std::array<float,2>{0.407859057f, 0.654641271f},
-std::array<float,2>{0.581987739f, 0.557182491f},
-std::array<float,2>{0.371899694f, 0.137095645f},
-std::array<float,2>{0.787429094f, 0.346968323f},
-std::array<float,2>{0.230505422f, 0.879112005f},
-std::array<float,2>{0.861543894f, 0.736298561f},
-std::array<float,2>{0.136651978f, 0.0357839651f},
-std::array<float,2>{0.551449955f, 0.452546656f},
-std::array<float,2>{0.261157721f, 0.758570433f},
-std::array<float,2>{0.635529697f, 0.986731887f},
-std::array<float,2>{0.479019195f, 0.257026225f},
-std::array<float,2>{0.879296243f, 0.189772323f},
-std::array<float,2>{0.0250347946f, 0.571146846f},
-std::array<float,2>{0.765550256f, 0.913179636f},
-std::array<float,2>{0.189492971f, 0.327906102f},
-std::array<float,2>{0.614286482f, 0.156752631f},
-std::array<float,2>{0.343203098f, 0.523235977f},
-std::array<float,2>{0.738147318f, 0.666414022f},
-std::array<float,2>{0.383594751f, 0.0965213925f},
-std::array<float,2>{0.982405603f, 0.394215494f},
-std::array<float,2>{0.115071297f, 0.83370465f},
-std::array<float,2>{0.932712078f, 0.605400324f},
-std::array<float,2>{0.0495087467f, 0.241554692f},
-std::array<float,2>{0.681488037f, 0.2858513f},
-std::array<float,2>{0.461365908f, 0.958299398f},
-std::array<float,2>{0.510331213f, 0.791781783f},
-std::array<float,2>{0.311587751f, 0.477855563f},
-std::array<float,2>{0.837390482f, 0.0260958299f},
-std::array<float,2>{0.168158278f, 0.690708935f},
-std::array<float,2>{0.953207493f, 0.940372467f},
-std::array<float,2>{0.0845918208f, 0.311573029f},
-std::array<float,2>{0.712028623f, 0.227327406f},
-std::array<float,2>{0.427662104f, 0.620748997f},
-std::array<float,2>{0.563290775f, 0.707971454f},
-std::array<float,2>{0.356669277f, 0.00481923949f},
-std::array<float,2>{0.811690271f, 0.487413019f},
-std::array<float,2>{0.24367848f, 0.799618781f},
-std::array<float,2>{0.846370459f, 0.507983983f},
-std::array<float,2>{0.146840513f, 0.181581408f},
-std::array<float,2>{0.540691972f, 0.342625588f},
-std::array<float,2>{0.27328825f, 0.932935715f},
-std::array<float,2>{0.652486086f, 0.825692058f},
-std::array<float,2>{0.488635391f, 0.389207631f},
-std::array<float,2>{0.904824615f, 0.121692128f},
-std::array<float,2>{0.00921521429f, 0.678220868f},
-std::array<float,2>{0.777670264f, 0.779379904f},
-std::array<float,2>{0.214613959f, 0.462226391f},
-std::array<float,2>{0.608236015f, 0.0507470146f},
-std::array<float,2>{0.319258094f, 0.725546837f},
-std::array<float,2>{0.730135858f, 0.59019053f},
-std::array<float,2>{0.40433234f, 0.204018354f},
-std::array<float,2>{0.997222662f, 0.280973226f},
-std::array<float,2>{0.106793575f, 0.982286811f},
-std::array<float,2>{0.918682158f, 0.626799345f},
-std::array<float,2>{0.0466133803f, 0.077177465f},
-std::array<float,2>{0.658420086f, 0.437235922f},
-std::array<float,2>{0.444619983f, 0.847945988f},
-std::array<float,2>{0.525688052f, 0.899309576f},
-std::array<float,2>{0.293520421f, 0.364208013f},
-std::array<float,2>{0.817392886f, 0.143603995f},
-std::array<float,2>{0.177541539f, 0.545275807f},
-std::array<float,2>{0.879112005f, 0.868867218f},
-std::array<float,2>{0.0251892786f, 0.417284608f},
-std::array<float,2>{0.635356963f, 0.087810263f},
-std::array<float,2>{0.479345769f, 0.65287739f},
-std::array<float,2>{0.551664233f, 0.554700077f},
-std::array<float,2>{0.260962039f, 0.140055552f},
-std::array<float,2>{0.861661673f, 0.344574928f},
-std::array<float,2>{0.136302873f, 0.881853402f},
-std::array<float,2>{0.787201703f, 0.736941576f},
-std::array<float,2>{0.230870873f, 0.0388156101f},
-std::array<float,2>{0.581673682f, 0.449799001f},
-std::array<float,2>{0.371774375f, 0.760267019f},
-std::array<float,2>{0.693710744f, 0.984797835f},
-std::array<float,2>{0.408030242f, 0.254443228f},
-std::array<float,2>{0.938159704f, 0.188093066f},
-std::array<float,2>{0.0712257624f, 0.572745025f},
-std::array<float,2>{0.836968064f, 0.911728144f},
-std::array<float,2>{0.168301538f, 0.324856758f},
-std::array<float,2>{0.510736108f, 0.158936426f},
-std::array<float,2>{0.311811805f, 0.521245301f},
-std::array<float,2>{0.681248903f, 0.664520741f},
-std::array<float,2>{0.460993975f, 0.0954474732f},
-std::array<float,2>{0.932917058f, 0.392265558f},
-std::array<float,2>{0.0497623757f, 0.83402437f},
-std::array<float,2>{0.982015252f, 0.602425635f},
-std::array<float,2>{0.11495474f, 0.239567831f},
-std::array<float,2>{0.737883925f, 0.288898945f},
-std::array<float,2>{0.383376896f, 0.959292114f},
-std::array<float,2>{0.61455816f, 0.789172232f},
-std::array<float,2>{0.343009204f, 0.480175465f},
-std::array<float,2>{0.765339077f, 0.0246858839f},
-std::array<float,2>{0.189941138f, 0.688764393f},
-std::array<float,2>{0.929605722f, 0.889442801f},
-std::array<float,2>{0.0609288402f, 0.357038915f},
-std::array<float,2>{0.673455715f, 0.132419109f},
-std::array<float,2>{0.453621656f, 0.553091228f},
-std::array<float,2>{0.506887376f, 0.642093599f},
-std::array<float,2>{0.303030044f, 0.084593825f},
-std::array<float,2>{0.831833899f, 0.413994879f},
-std::array<float,2>{0.15746358f, 0.859984219f},
-std::array<float,2>{0.750166595f, 0.562843323f},
-std::array<float,2>{0.202554554f, 0.197242722f},
-std::array<float,2>{0.624551237f, 0.264637709f},
-std::array<float,2>{0.331507146f, 0.99991864f},
-std::array<float,2>{0.744879901f, 0.7501176f},
-std::array<float,2>{0.379550159f, 0.438800901f},
-std::array<float,2>{0.972858787f, 0.0438574813f},
-std::array<float,2>{0.121261619f, 0.749493599f},
-std::array<float,2>{0.87443012f, 0.836558878f},
-std::array<float,2>{0.125942588f, 0.401353955f},
-std::array<float,2>{0.555073082f, 0.103046611f},
-std::array<float,2>{0.256134272f, 0.660304785f},
-std::array<float,2>{0.625774086f, 0.529504418f},
-std::array<float,2>{0.470613837f, 0.170327693f},
-std::array<float,2>{0.887977839f, 0.318291336f},
-std::array<float,2>{0.0221483577f, 0.91870749f},
-std::array<float,2>{0.952687323f, 0.698528588f},
-std::array<float,2>{0.0697738007f, 0.0168186687f},
-std::array<float,2>{0.703080475f, 0.471267998f},
-std::array<float,2>{0.420929343f, 0.783217609f},
-std::array<float,2>{0.591902852f, 0.964865029f},
-std::array<float,2>{0.359461069f, 0.296376437f},
-std::array<float,2>{0.795414984f, 0.246372983f},
-std::array<float,2>{0.223476276f, 0.596987605f},
-std::array<float,2>{0.989696562f, 0.806981444f},
-std::array<float,2>{0.0952741653f, 0.494565606f},
-std::array<float,2>{0.720701158f, 0.0152828926f},
-std::array<float,2>{0.395640552f, 0.716446519f},
-std::array<float,2>{0.600682139f, 0.615387261f},
-std::array<float,2>{0.323172539f, 0.222104251f},
-std::array<float,2>{0.772984743f, 0.302680135f},
-std::array<float,2>{0.210528135f, 0.947956681f},
-std::array<float,2>{0.822588861f, 0.682112336f},
-std::array<float,2>{0.185539097f, 0.111452356f},
-std::array<float,2>{0.522252977f, 0.378797203f},
-std::array<float,2>{0.285565794f, 0.815623462f},
-std::array<float,2>{0.666003644f, 0.928845108f},
-std::array<float,2>{0.451772094f, 0.335719675f},
-std::array<float,2>{0.913826704f, 0.173671052f},
-std::array<float,2>{0.03353801f, 0.506151378f},
-std::array<float,2>{0.80153966f, 0.972533822f},
-std::array<float,2>{0.239833251f, 0.269217193f},
-std::array<float,2>{0.574207544f, 0.214640781f},
-std::array<float,2>{0.349609315f, 0.582704723f},
-std::array<float,2>{0.710076094f, 0.733586669f},
-std::array<float,2>{0.436089307f, 0.0587915033f},
-std::array<float,2>{0.963514507f, 0.459173113f},
-std::array<float,2>{0.0921906158f, 0.772430718f},
-std::array<float,2>{0.895514607f, 0.538824558f},
-std::array<float,2>{0.00434428826f, 0.154640734f},
-std::array<float,2>{0.645964503f, 0.371768832f},
-std::array<float,2>{0.495094627f, 0.893799245f},
-std::array<float,2>{0.537495613f, 0.85451746f},
-std::array<float,2>{0.280697316f, 0.422980934f},
-std::array<float,2>{0.853007138f, 0.0702911839f},
-std::array<float,2>{0.15155074f, 0.637248993f},
-std::array<float,2>{0.971887887f, 0.936427236f},
-std::array<float,2>{0.117807068f, 0.339286894f},
-std::array<float,2>{0.746168673f, 0.184721366f},
-std::array<float,2>{0.377616405f, 0.512928963f},
-std::array<float,2>{0.619568825f, 0.675405324f},
-std::array<float,2>{0.333108127f, 0.11955788f},
-std::array<float,2>{0.75651449f, 0.383294553f},
-std::array<float,2>{0.198656082f, 0.820970118f},
-std::array<float,2>{0.834552228f, 0.621790946f},
-std::array<float,2>{0.160507068f, 0.233647123f},
-std::array<float,2>{0.501957774f, 0.307766467f},
-std::array<float,2>{0.300367415f, 0.942182124f},
-std::array<float,2>{0.679566979f, 0.803056598f},
-std::array<float,2>{0.457546175f, 0.49084264f},
-std::array<float,2>{0.923277855f, 0.00244000414f},
-std::array<float,2>{0.0579798035f, 0.704202831f},
-std::array<float,2>{0.789702356f, 0.844343841f},
-std::array<float,2>{0.218829051f, 0.43254897f},
-std::array<float,2>{0.588265657f, 0.0717234612f},
-std::array<float,2>{0.364009112f, 0.629675269f},
-std::array<float,2>{0.697575986f, 0.539300084f},
-std::array<float,2>{0.416931838f, 0.144864365f},
-std::array<float,2>{0.94738704f, 0.362581372f},
-std::array<float,2>{0.0641864911f, 0.904835582f},
-std::array<float,2>{0.88359338f, 0.719782293f},
-std::array<float,2>{0.0194488429f, 0.0543996245f},
-std::array<float,2>{0.632240474f, 0.467724353f},
-std::array<float,2>{0.474006683f, 0.774936557f},
-std::array<float,2>{0.56153059f, 0.977390766f},
-std::array<float,2>{0.250832081f, 0.274720997f},
-std::array<float,2>{0.867385507f, 0.208843186f},
-std::array<float,2>{0.132741496f, 0.587984443f},
-std::array<float,2>{0.906661391f, 0.764846087f},
-std::array<float,2>{0.0368099138f, 0.446047932f},
-std::array<float,2>{0.669552982f, 0.0350225419f},
-std::array<float,2>{0.449022114f, 0.741146088f},
-std::array<float,2>{0.516726077f, 0.575104237f},
-std::array<float,2>{0.281903297f, 0.194203481f},
-std::array<float,2>{0.825561523f, 0.250851095f},
-std::array<float,2>{0.179724783f, 0.990199685f},
-std::array<float,2>{0.767424881f, 0.651220858f},
-std::array<float,2>{0.205938756f, 0.0903168172f},
-std::array<float,2>{0.594254315f, 0.42019999f},
-std::array<float,2>{0.326746792f, 0.871944487f},
-std::array<float,2>{0.724578917f, 0.878752053f},
-std::array<float,2>{0.394316167f, 0.349718958f},
-std::array<float,2>{0.988229275f, 0.135729015f},
-std::array<float,2>{0.0992614999f, 0.561992407f},
-std::array<float,2>{0.856368124f, 0.953618109f},
-std::array<float,2>{0.155055672f, 0.285119623f},
-std::array<float,2>{0.531846821f, 0.235394105f},
-std::array<float,2>{0.27455616f, 0.606765091f},
-std::array<float,2>{0.640774667f, 0.695259333f},
-std::array<float,2>{0.498858809f, 0.0290305167f},
-std::array<float,2>{0.8939116f, 0.483801574f},
-std::array<float,2>{0.000172313346f, 0.793014765f},
-std::array<float,2>{0.968213677f, 0.517306745f},
-std::array<float,2>{0.089804776f, 0.163651034f},
-std::array<float,2>{0.704295397f, 0.324067265f},
-std::array<float,2>{0.431366086f, 0.909853339f},
-std::array<float,2>{0.576044619f, 0.830065727f},
-std::array<float,2>{0.347019136f, 0.395204604f},
-std::array<float,2>{0.796922386f, 0.0999311507f},
-std::array<float,2>{0.236974329f, 0.671731532f},
-std::array<float,2>{0.9001984f, 0.994509399f},
-std::array<float,2>{0.0134156235f, 0.261339247f},
-std::array<float,2>{0.650912881f, 0.199972108f},
-std::array<float,2>{0.487428069f, 0.569078803f},
-std::array<float,2>{0.544578373f, 0.742631674f},
-std::array<float,2>{0.267515957f, 0.0409078412f},
-std::array<float,2>{0.849932969f, 0.445261061f},
-std::array<float,2>{0.143419147f, 0.756177843f},
-std::array<float,2>{0.80539602f, 0.549517632f},
-std::array<float,2>{0.248480082f, 0.127522573f},
-std::array<float,2>{0.567028284f, 0.353871226f},
-std::array<float,2>{0.352535635f, 0.886707425f},
-std::array<float,2>{0.717456996f, 0.866807878f},
-std::array<float,2>{0.422937125f, 0.406423748f},
-std::array<float,2>{0.960524261f, 0.0786664486f},
-std::array<float,2>{0.0801316872f, 0.647724926f},
-std::array<float,2>{0.814944148f, 0.787010431f},
-std::array<float,2>{0.174750075f, 0.473812252f},
-std::array<float,2>{0.527465105f, 0.0196253825f},
-std::array<float,2>{0.291562527f, 0.701226771f},
-std::array<float,2>{0.663297236f, 0.59872812f},
-std::array<float,2>{0.439278215f, 0.24403432f},
-std::array<float,2>{0.915353239f, 0.290674686f},
-std::array<float,2>{0.0423151851f, 0.963948667f},
-std::array<float,2>{0.99398303f, 0.659354985f},
-std::array<float,2>{0.104443729f, 0.106165111f},
-std::array<float,2>{0.732606709f, 0.404325485f},
-std::array<float,2>{0.399911404f, 0.841741443f},
-std::array<float,2>{0.603144228f, 0.915793538f},
-std::array<float,2>{0.313765705f, 0.315026432f},
-std::array<float,2>{0.775198698f, 0.166019633f},
-std::array<float,2>{0.217871159f, 0.523460209f},
-std::array<float,2>{0.944036603f, 0.817485273f},
-std::array<float,2>{0.0743139312f, 0.380563229f},
-std::array<float,2>{0.689624727f, 0.113774396f},
-std::array<float,2>{0.411537141f, 0.68746233f},
-std::array<float,2>{0.585169435f, 0.501456022f},
-std::array<float,2>{0.368974715f, 0.176039815f},
-std::array<float,2>{0.784918308f, 0.330415487f},
-std::array<float,2>{0.22793673f, 0.922946572f},
-std::array<float,2>{0.86669457f, 0.714492738f},
-std::array<float,2>{0.140433997f, 0.00895764586f},
-std::array<float,2>{0.549416542f, 0.497736514f},
-std::array<float,2>{0.265556186f, 0.811377227f},
-std::array<float,2>{0.638465524f, 0.949856162f},
-std::array<float,2>{0.480597675f, 0.300241083f},
-std::array<float,2>{0.87864244f, 0.224319607f},
-std::array<float,2>{0.0307514016f, 0.610405147f},
-std::array<float,2>{0.760369301f, 0.896030843f},
-std::array<float,2>{0.192153811f, 0.37063542f},
-std::array<float,2>{0.612561643f, 0.150708705f},
-std::array<float,2>{0.336800605f, 0.533945143f},
-std::array<float,2>{0.738881528f, 0.635114729f},
-std::array<float,2>{0.390450805f, 0.0644818023f},
-std::array<float,2>{0.977597058f, 0.427751213f},
-std::array<float,2>{0.111083306f, 0.858118415f},
-std::array<float,2>{0.935401976f, 0.578249395f},
-std::array<float,2>{0.0538774021f, 0.216636151f},
-std::array<float,2>{0.684433281f, 0.270776302f},
-std::array<float,2>{0.467035353f, 0.973345101f},
-std::array<float,2>{0.51375252f, 0.768267095f},
-std::array<float,2>{0.307552606f, 0.456013143f},
-std::array<float,2>{0.841485322f, 0.0558353327f},
-std::array<float,2>{0.164182723f, 0.729104221f},
-std::array<float,2>{0.999334514f, 0.983401239f},
-std::array<float,2>{0.107816294f, 0.277800739f},
-std::array<float,2>{0.728239298f, 0.205609038f},
-std::array<float,2>{0.403425992f, 0.59333849f},
-std::array<float,2>{0.606851816f, 0.723931491f},
-std::array<float,2>{0.318267852f, 0.0473466143f},
-std::array<float,2>{0.779368043f, 0.463791609f},
-std::array<float,2>{0.212399393f, 0.779083014f},
-std::array<float,2>{0.818570077f, 0.544054747f},
-std::array<float,2>{0.178598642f, 0.141051963f},
-std::array<float,2>{0.524744034f, 0.366065919f},
-std::array<float,2>{0.295502543f, 0.901580215f},
-std::array<float,2>{0.657699227f, 0.849643052f},
-std::array<float,2>{0.441558987f, 0.434226632f},
-std::array<float,2>{0.919995487f, 0.0757348612f},
-std::array<float,2>{0.044884596f, 0.628055751f},
-std::array<float,2>{0.809657693f, 0.797284007f},
-std::array<float,2>{0.244338334f, 0.485197961f},
-std::array<float,2>{0.566274941f, 0.00591996638f},
-std::array<float,2>{0.359030753f, 0.710500121f},
-std::array<float,2>{0.713130176f, 0.61750257f},
-std::array<float,2>{0.42943874f, 0.230396077f},
-std::array<float,2>{0.95553261f, 0.310516804f},
-std::array<float,2>{0.0838429853f, 0.939275086f},
-std::array<float,2>{0.902916133f, 0.676546514f},
-std::array<float,2>{0.0107930349f, 0.123423919f},
-std::array<float,2>{0.655073285f, 0.388624221f},
-std::array<float,2>{0.490251213f, 0.827590823f},
-std::array<float,2>{0.541218281f, 0.931143284f},
-std::array<float,2>{0.270140678f, 0.339907914f},
-std::array<float,2>{0.84460479f, 0.182092592f},
-std::array<float,2>{0.145345047f, 0.510068834f},
-std::array<float,2>{0.931118906f, 0.832537174f},
-std::array<float,2>{0.0485103726f, 0.393151522f},
-std::array<float,2>{0.682955742f, 0.097488381f},
-std::array<float,2>{0.464273274f, 0.667786777f},
-std::array<float,2>{0.508505344f, 0.521759868f},
-std::array<float,2>{0.310275972f, 0.157822669f},
-std::array<float,2>{0.839006305f, 0.326872975f},
-std::array<float,2>{0.170487821f, 0.91286695f},
-std::array<float,2>{0.763480127f, 0.689855516f},
-std::array<float,2>{0.188759953f, 0.0267181862f},
-std::array<float,2>{0.61644274f, 0.477257758f},
-std::array<float,2>{0.341520905f, 0.792619348f},
-std::array<float,2>{0.73561728f, 0.957266748f},
-std::array<float,2>{0.38510558f, 0.286704451f},
-std::array<float,2>{0.983696818f, 0.240735009f},
-std::array<float,2>{0.11644648f, 0.604482889f},
-std::array<float,2>{0.860786676f, 0.88067466f},
-std::array<float,2>{0.133452371f, 0.345787972f},
-std::array<float,2>{0.553797543f, 0.138066635f},
-std::array<float,2>{0.258639067f, 0.55809176f},
-std::array<float,2>{0.634428084f, 0.656117082f},
-std::array<float,2>{0.478456914f, 0.0896640196f},
-std::array<float,2>{0.882517755f, 0.414550334f},
-std::array<float,2>{0.0268384442f, 0.869836509f},
-std::array<float,2>{0.941048563f, 0.572061121f},
-std::array<float,2>{0.0732123256f, 0.190874308f},
-std::array<float,2>{0.691947341f, 0.256635398f},
-std::array<float,2>{0.4092215f, 0.987352729f},
-std::array<float,2>{0.579501092f, 0.759742141f},
-std::array<float,2>{0.374794245f, 0.451881766f},
-std::array<float,2>{0.785972714f, 0.0361793749f},
-std::array<float,2>{0.232921332f, 0.735346794f},
-std::array<float,2>{0.888827443f, 0.921090245f},
-std::array<float,2>{0.021045167f, 0.319751561f},
-std::array<float,2>{0.628862202f, 0.168002948f},
-std::array<float,2>{0.47246924f, 0.52906239f},
-std::array<float,2>{0.556820869f, 0.662435234f},
-std::array<float,2>{0.255429298f, 0.103896938f},
-std::array<float,2>{0.872392058f, 0.399825215f},
-std::array<float,2>{0.12829043f, 0.839729369f},
-std::array<float,2>{0.793882966f, 0.594270766f},
-std::array<float,2>{0.224678546f, 0.249952585f},
-std::array<float,2>{0.591626763f, 0.293835789f},
-std::array<float,2>{0.362747312f, 0.967921257f},
-std::array<float,2>{0.701049685f, 0.782860756f},
-std::array<float,2>{0.419764668f, 0.470232338f},
-std::array<float,2>{0.95072037f, 0.0188157838f},
-std::array<float,2>{0.0665247664f, 0.696698487f},
-std::array<float,2>{0.830002129f, 0.86246419f},
-std::array<float,2>{0.159392327f, 0.411305726f},
-std::array<float,2>{0.504594386f, 0.0824246705f},
-std::array<float,2>{0.302004457f, 0.643378377f},
-std::array<float,2>{0.675337553f, 0.552068889f},
-std::array<float,2>{0.455815226f, 0.130043313f},
-std::array<float,2>{0.927253485f, 0.357753605f},
-std::array<float,2>{0.0596828423f, 0.887929678f},
-std::array<float,2>{0.975692034f, 0.747873843f},
-std::array<float,2>{0.12360087f, 0.0456830859f},
-std::array<float,2>{0.743680954f, 0.440086126f},
-std::array<float,2>{0.381587982f, 0.752712309f},
-std::array<float,2>{0.621660113f, 0.997489154f},
-std::array<float,2>{0.328668952f, 0.26327759f},
-std::array<float,2>{0.752009392f, 0.198021919f},
-std::array<float,2>{0.199264213f, 0.565929234f},
-std::array<float,2>{0.961084545f, 0.76979208f},
-std::array<float,2>{0.0917133689f, 0.457741946f},
-std::array<float,2>{0.707612634f, 0.061511036f},
-std::array<float,2>{0.435450882f, 0.731650889f},
-std::array<float,2>{0.57100451f, 0.584561408f},
-std::array<float,2>{0.349700868f, 0.211785972f},
-std::array<float,2>{0.803952813f, 0.267172933f},
-std::array<float,2>{0.241393968f, 0.969009042f},
-std::array<float,2>{0.854773045f, 0.639097571f},
-std::array<float,2>{0.149180055f, 0.0677811131f},
-std::array<float,2>{0.536856353f, 0.425425738f},
-std::array<float,2>{0.278535366f, 0.852034867f},
-std::array<float,2>{0.646763563f, 0.891637325f},
-std::array<float,2>{0.492396265f, 0.374181926f},
-std::array<float,2>{0.897802353f, 0.152918965f},
-std::array<float,2>{0.00734372018f, 0.536744893f},
-std::array<float,2>{0.770710051f, 0.946574688f},
-std::array<float,2>{0.207219258f, 0.30326128f},
-std::array<float,2>{0.598844945f, 0.220612213f},
-std::array<float,2>{0.321877807f, 0.614157975f},
-std::array<float,2>{0.722027063f, 0.717537224f},
-std::array<float,2>{0.396974832f, 0.0132124331f},
-std::array<float,2>{0.990629435f, 0.492428303f},
-std::array<float,2>{0.0971662626f, 0.804882705f},
-std::array<float,2>{0.91159004f, 0.505164862f},
-std::array<float,2>{0.0315044373f, 0.174699038f},
-std::array<float,2>{0.667620838f, 0.332690865f},
-std::array<float,2>{0.449603736f, 0.926311612f},
-std::array<float,2>{0.521097898f, 0.813227594f},
-std::array<float,2>{0.287389219f, 0.376592487f},
-std::array<float,2>{0.820464849f, 0.110554896f},
-std::array<float,2>{0.18674852f, 0.681585312f},
-std::array<float,2>{0.946466744f, 0.903613865f},
-std::array<float,2>{0.0663219467f, 0.361068666f},
-std::array<float,2>{0.697179735f, 0.148099124f},
-std::array<float,2>{0.414415628f, 0.541181743f},
-std::array<float,2>{0.586413562f, 0.631196856f},
-std::array<float,2>{0.365487069f, 0.0727133602f},
-std::array<float,2>{0.791318476f, 0.430032223f},
-std::array<float,2>{0.222474054f, 0.846872628f},
-std::array<float,2>{0.869268775f, 0.586458743f},
-std::array<float,2>{0.130334914f, 0.210257038f},
-std::array<float,2>{0.559679627f, 0.277027547f},
-std::array<float,2>{0.253322721f, 0.980434f},
-std::array<float,2>{0.629031718f, 0.775794566f},
-std::array<float,2>{0.474672914f, 0.465642989f},
-std::array<float,2>{0.88506943f, 0.0514449328f},
-std::array<float,2>{0.016130751f, 0.722411036f},
-std::array<float,2>{0.754621565f, 0.822826922f},
-std::array<float,2>{0.19698748f, 0.385762721f},
-std::array<float,2>{0.618237436f, 0.118267648f},
-std::array<float,2>{0.335911959f, 0.673557937f},
-std::array<float,2>{0.748212039f, 0.515140772f},
-std::array<float,2>{0.376805842f, 0.186502397f},
-std::array<float,2>{0.968902886f, 0.337500751f},
-std::array<float,2>{0.119246684f, 0.933720887f},
-std::array<float,2>{0.924286127f, 0.706554353f},
-std::array<float,2>{0.055907432f, 0.000338647107f},
-std::array<float,2>{0.676583767f, 0.489264697f},
-std::array<float,2>{0.460901469f, 0.80256176f},
-std::array<float,2>{0.501778066f, 0.944068134f},
-std::array<float,2>{0.29877606f, 0.305446118f},
-std::array<float,2>{0.832889438f, 0.230574459f},
-std::array<float,2>{0.162114918f, 0.624099433f},
-std::array<float,2>{0.890731156f, 0.795996785f},
-std::array<float,2>{0.00210327259f, 0.481498778f},
-std::array<float,2>{0.644193649f, 0.0309443902f},
-std::array<float,2>{0.497391403f, 0.692263484f},
-std::array<float,2>{0.533356428f, 0.608086646f},
-std::array<float,2>{0.277211666f, 0.237605408f},
-std::array<float,2>{0.858804405f, 0.282883972f},
-std::array<float,2>{0.153670147f, 0.956662834f},
-std::array<float,2>{0.799326181f, 0.668116152f},
-std::array<float,2>{0.23493892f, 0.0992355943f},
-std::array<float,2>{0.576845825f, 0.397398204f},
-std::array<float,2>{0.344082922f, 0.83091712f},
-std::array<float,2>{0.705601335f, 0.907326818f},
-std::array<float,2>{0.433582395f, 0.32083714f},
-std::array<float,2>{0.966055095f, 0.16143699f},
-std::array<float,2>{0.0870277733f, 0.518150806f},
-std::array<float,2>{0.826637506f, 0.992113948f},
-std::array<float,2>{0.181842774f, 0.253459126f},
-std::array<float,2>{0.517639875f, 0.19202812f},
-std::array<float,2>{0.283928692f, 0.576813817f},
-std::array<float,2>{0.671639025f, 0.739505291f},
-std::array<float,2>{0.44710052f, 0.032677114f},
-std::array<float,2>{0.909362853f, 0.447899997f},
-std::array<float,2>{0.0389367193f, 0.762308836f},
-std::array<float,2>{0.984623492f, 0.559117854f},
-std::array<float,2>{0.101279542f, 0.133871466f},
-std::array<float,2>{0.725430369f, 0.348418236f},
-std::array<float,2>{0.390639991f, 0.876479447f},
-std::array<float,2>{0.597054183f, 0.874865234f},
-std::array<float,2>{0.324430555f, 0.419681966f},
-std::array<float,2>{0.768046975f, 0.0932117626f},
-std::array<float,2>{0.204067156f, 0.650012434f},
-std::array<float,2>{0.916315556f, 0.961847425f},
-std::array<float,2>{0.040588662f, 0.291981578f},
-std::array<float,2>{0.661221206f, 0.244841352f},
-std::array<float,2>{0.44028154f, 0.600341499f},
-std::array<float,2>{0.530197382f, 0.699807107f},
-std::array<float,2>{0.289151162f, 0.0218011569f},
-std::array<float,2>{0.813361764f, 0.475715697f},
-std::array<float,2>{0.173198313f, 0.78808254f},
-std::array<float,2>{0.775918663f, 0.526415527f},
-std::array<float,2>{0.215903178f, 0.164306864f},
-std::array<float,2>{0.604523838f, 0.312987566f},
-std::array<float,2>{0.315282285f, 0.916630805f},
-std::array<float,2>{0.731650651f, 0.843027174f},
-std::array<float,2>{0.40138033f, 0.404254198f},
-std::array<float,2>{0.994520724f, 0.107909903f},
-std::array<float,2>{0.103443824f, 0.657838762f},
-std::array<float,2>{0.848561883f, 0.753948867f},
-std::array<float,2>{0.140982151f, 0.441649526f},
-std::array<float,2>{0.546698332f, 0.0418372937f},
-std::array<float,2>{0.267909825f, 0.745588481f},
-std::array<float,2>{0.649763882f, 0.566422403f},
-std::array<float,2>{0.485077292f, 0.201470375f},
-std::array<float,2>{0.902014375f, 0.257913232f},
-std::array<float,2>{0.0156147527f, 0.99386096f},
-std::array<float,2>{0.958186567f, 0.646354079f},
-std::array<float,2>{0.0796688721f, 0.0808175728f},
-std::array<float,2>{0.715022862f, 0.40888238f},
-std::array<float,2>{0.42509979f, 0.86482501f},
-std::array<float,2>{0.56922698f, 0.884113967f},
-std::array<float,2>{0.354988247f, 0.352110624f},
-std::array<float,2>{0.807289958f, 0.125583142f},
-std::array<float,2>{0.247279331f, 0.548443198f},
-std::array<float,2>{0.980209291f, 0.856229544f},
-std::array<float,2>{0.111668058f, 0.426491201f},
-std::array<float,2>{0.740949452f, 0.0631514192f},
-std::array<float,2>{0.388595164f, 0.634547889f},
-std::array<float,2>{0.610659361f, 0.531746089f},
-std::array<float,2>{0.338499188f, 0.149860114f},
-std::array<float,2>{0.757863045f, 0.368564665f},
-std::array<float,2>{0.194677025f, 0.896984041f},
-std::array<float,2>{0.842751205f, 0.726878822f},
-std::array<float,2>{0.166407466f, 0.057012286f},
-std::array<float,2>{0.513194025f, 0.454939276f},
-std::array<float,2>{0.306312948f, 0.767058611f},
-std::array<float,2>{0.686499894f, 0.974974275f},
-std::array<float,2>{0.464907408f, 0.27329424f},
-std::array<float,2>{0.936439276f, 0.216862485f},
-std::array<float,2>{0.0514600277f, 0.580543995f},
-std::array<float,2>{0.782633722f, 0.925733805f},
-std::array<float,2>{0.230162725f, 0.328839511f},
-std::array<float,2>{0.583506048f, 0.17874305f},
-std::array<float,2>{0.369279206f, 0.502122819f},
-std::array<float,2>{0.688366771f, 0.685368121f},
-std::array<float,2>{0.41394636f, 0.115665309f},
-std::array<float,2>{0.942950606f, 0.381698996f},
-std::array<float,2>{0.0764399692f, 0.819646835f},
-std::array<float,2>{0.876269519f, 0.612088442f},
-std::array<float,2>{0.0278949067f, 0.225200221f},
-std::array<float,2>{0.638760209f, 0.296939939f},
-std::array<float,2>{0.482941777f, 0.951233566f},
-std::array<float,2>{0.548718512f, 0.8086707f},
-std::array<float,2>{0.262571782f, 0.498063952f},
-std::array<float,2>{0.863796175f, 0.0117065022f},
-std::array<float,2>{0.138536409f, 0.711770654f},
-std::array<float,2>{0.98309058f, 0.960686684f},
-std::array<float,2>{0.115715951f, 0.287242502f},
-std::array<float,2>{0.735321522f, 0.239003778f},
-std::array<float,2>{0.386328816f, 0.603319168f},
-std::array<float,2>{0.615329027f, 0.687867105f},
-std::array<float,2>{0.34071666f, 0.0241550207f},
-std::array<float,2>{0.762125731f, 0.479409993f},
-std::array<float,2>{0.187514648f, 0.790297747f},
-std::array<float,2>{0.838460028f, 0.519752264f},
-std::array<float,2>{0.171561763f, 0.159305856f},
-std::array<float,2>{0.509018779f, 0.325622708f},
-std::array<float,2>{0.309362531f, 0.910541952f},
-std::array<float,2>{0.68186599f, 0.835319042f},
-std::array<float,2>{0.463705033f, 0.391483158f},
-std::array<float,2>{0.930022299f, 0.0944763571f},
-std::array<float,2>{0.0473552831f, 0.665241539f},
-std::array<float,2>{0.786346912f, 0.761398375f},
-std::array<float,2>{0.233519584f, 0.451152533f},
-std::array<float,2>{0.578581393f, 0.0374696516f},
-std::array<float,2>{0.374004722f, 0.737351656f},
-std::array<float,2>{0.692886293f, 0.574038327f},
-std::array<float,2>{0.408964396f, 0.188952744f},
-std::array<float,2>{0.94035542f, 0.255498081f},
-std::array<float,2>{0.0740742832f, 0.985955536f},
-std::array<float,2>{0.881669104f, 0.654254258f},
-std::array<float,2>{0.0261361375f, 0.086559318f},
-std::array<float,2>{0.633422732f, 0.416264445f},
-std::array<float,2>{0.477388859f, 0.868044138f},
-std::array<float,2>{0.5530321f, 0.881719291f},
-std::array<float,2>{0.259329408f, 0.345372319f},
-std::array<float,2>{0.860116243f, 0.138726801f},
-std::array<float,2>{0.134225443f, 0.555903554f},
-std::array<float,2>{0.921863616f, 0.849528134f},
-std::array<float,2>{0.0434718281f, 0.43589744f},
-std::array<float,2>{0.657148957f, 0.0765974f},
-std::array<float,2>{0.4424344f, 0.625182688f},
-std::array<float,2>{0.523800194f, 0.546317995f},
-std::array<float,2>{0.296186894f, 0.142636821f},
-std::array<float,2>{0.819778264f, 0.365183324f},
-std::array<float,2>{0.179612488f, 0.900006711f},
-std::array<float,2>{0.780395687f, 0.726447642f},
-std::array<float,2>{0.211083055f, 0.0489970148f},
-std::array<float,2>{0.60568583f, 0.461757123f},
-std::array<float,2>{0.317282587f, 0.781009018f},
-std::array<float,2>{0.727395177f, 0.980501771f},
-std::array<float,2>{0.402962416f, 0.279817343f},
-std::array<float,2>{0.998737097f, 0.204604581f},
-std::array<float,2>{0.108652376f, 0.591759562f},
-std::array<float,2>{0.844797075f, 0.932574093f},
-std::array<float,2>{0.145928025f, 0.34300369f},
-std::array<float,2>{0.542767882f, 0.180378839f},
-std::array<float,2>{0.271413922f, 0.509277403f},
-std::array<float,2>{0.655930996f, 0.679667234f},
-std::array<float,2>{0.492156059f, 0.122111954f},
-std::array<float,2>{0.904056191f, 0.390330583f},
-std::array<float,2>{0.0100610219f, 0.824767292f},
-std::array<float,2>{0.956868529f, 0.619714439f},
-std::array<float,2>{0.0826237649f, 0.228234366f},
-std::array<float,2>{0.713900268f, 0.310637265f},
-std::array<float,2>{0.428490043f, 0.940900743f},
-std::array<float,2>{0.564750075f, 0.800217867f},
-std::array<float,2>{0.358317465f, 0.486425638f},
-std::array<float,2>{0.808904409f, 0.0056913686f},
-std::array<float,2>{0.245869368f, 0.708322287f},
-std::array<float,2>{0.897417367f, 0.893178105f},
-std::array<float,2>{0.00656552752f, 0.37219581f},
-std::array<float,2>{0.64812386f, 0.156160623f},
-std::array<float,2>{0.493373841f, 0.537529111f},
-std::array<float,2>{0.535373807f, 0.638662755f},
-std::array<float,2>{0.277667195f, 0.0687366724f},
-std::array<float,2>{0.85404408f, 0.422439903f},
-std::array<float,2>{0.149807915f, 0.854059994f},
-std::array<float,2>{0.803645194f, 0.583835483f},
-std::array<float,2>{0.240880981f, 0.213827521f},
-std::array<float,2>{0.572231531f, 0.268528998f},
-std::array<float,2>{0.350596547f, 0.971092463f},
-std::array<float,2>{0.708759308f, 0.772572935f},
-std::array<float,2>{0.434212208f, 0.460123777f},
-std::array<float,2>{0.962666512f, 0.0604044758f},
-std::array<float,2>{0.0902570412f, 0.732482076f},
-std::array<float,2>{0.821991265f, 0.814915717f},
-std::array<float,2>{0.186075389f, 0.377581f},
-std::array<float,2>{0.519831121f, 0.113067433f},
-std::array<float,2>{0.288765073f, 0.68356818f},
-std::array<float,2>{0.666717112f, 0.507161021f},
-std::array<float,2>{0.451057792f, 0.171923995f},
-std::array<float,2>{0.910652518f, 0.334286124f},
-std::array<float,2>{0.0324402079f, 0.927853882f},
-std::array<float,2>{0.991815269f, 0.715191901f},
-std::array<float,2>{0.096658662f, 0.0140733635f},
-std::array<float,2>{0.721338332f, 0.496021569f},
-std::array<float,2>{0.39820084f, 0.807861984f},
-std::array<float,2>{0.597906888f, 0.948628008f},
-std::array<float,2>{0.320641875f, 0.301023215f},
-std::array<float,2>{0.769905627f, 0.221105695f},
-std::array<float,2>{0.208767936f, 0.617003798f},
-std::array<float,2>{0.950145245f, 0.785027444f},
-std::array<float,2>{0.0676394626f, 0.471998245f},
-std::array<float,2>{0.699431837f, 0.0156490281f},
-std::array<float,2>{0.418102294f, 0.697761953f},
-std::array<float,2>{0.589966834f, 0.596210063f},
-std::array<float,2>{0.361399531f, 0.247949481f},
-std::array<float,2>{0.79484117f, 0.295822978f},
-std::array<float,2>{0.226097405f, 0.965838075f},
-std::array<float,2>{0.871940792f, 0.662042141f},
-std::array<float,2>{0.127442986f, 0.101899892f},
-std::array<float,2>{0.558203936f, 0.40220204f},
-std::array<float,2>{0.254659295f, 0.837166965f},
-std::array<float,2>{0.627730489f, 0.919269979f},
-std::array<float,2>{0.470802516f, 0.316820383f},
-std::array<float,2>{0.890610993f, 0.17122972f},
-std::array<float,2>{0.0201353375f, 0.530785203f},
-std::array<float,2>{0.753651857f, 0.998190582f},
-std::array<float,2>{0.201047376f, 0.265288413f},
-std::array<float,2>{0.62247324f, 0.196247503f},
-std::array<float,2>{0.329856634f, 0.564386666f},
-std::array<float,2>{0.742908597f, 0.748403192f},
-std::array<float,2>{0.381897897f, 0.0445935875f},
-std::array<float,2>{0.974979281f, 0.437726766f},
-std::array<float,2>{0.124130949f, 0.751149178f},
-std::array<float,2>{0.925914347f, 0.554674625f},
-std::array<float,2>{0.059541665f, 0.131356806f},
-std::array<float,2>{0.674701929f, 0.355801791f},
-std::array<float,2>{0.456731766f, 0.889666438f},
-std::array<float,2>{0.50530231f, 0.860352099f},
-std::array<float,2>{0.301674396f, 0.412428558f},
-std::array<float,2>{0.828486562f, 0.0851271749f},
-std::array<float,2>{0.158424094f, 0.641295254f},
-std::array<float,2>{0.964961469f, 0.908720911f},
-std::array<float,2>{0.0866373777f, 0.322631985f},
-std::array<float,2>{0.706636786f, 0.162572786f},
-std::array<float,2>{0.431897461f, 0.516492307f},
-std::array<float,2>{0.577883422f, 0.670393229f},
-std::array<float,2>{0.34526673f, 0.100633815f},
-std::array<float,2>{0.800358355f, 0.396095872f},
-std::array<float,2>{0.236067668f, 0.828664601f},
-std::array<float,2>{0.857847095f, 0.60620296f},
-std::array<float,2>{0.152588934f, 0.234609231f},
-std::array<float,2>{0.534454644f, 0.283900976f},
-std::array<float,2>{0.275509059f, 0.954996049f},
-std::array<float,2>{0.642903984f, 0.794071555f},
-std::array<float,2>{0.496860623f, 0.48316431f},
-std::array<float,2>{0.892118275f, 0.0279772356f},
-std::array<float,2>{0.00386683247f, 0.693863511f},
-std::array<float,2>{0.769004285f, 0.87259376f},
-std::array<float,2>{0.204283074f, 0.421382815f},
-std::array<float,2>{0.596088231f, 0.0911841318f},
-std::array<float,2>{0.325980872f, 0.652144969f},
-std::array<float,2>{0.726294577f, 0.561289132f},
-std::array<float,2>{0.392330438f, 0.136021554f},
-std::array<float,2>{0.986126959f, 0.351428151f},
-std::array<float,2>{0.100070477f, 0.87747705f},
-std::array<float,2>{0.908775985f, 0.741607428f},
-std::array<float,2>{0.0375644676f, 0.0336537883f},
-std::array<float,2>{0.670833647f, 0.446519494f},
-std::array<float,2>{0.445408911f, 0.764080405f},
-std::array<float,2>{0.519219875f, 0.988681138f},
-std::array<float,2>{0.285063535f, 0.251327366f},
-std::array<float,2>{0.827378452f, 0.194725901f},
-std::array<float,2>{0.182730213f, 0.576090455f},
-std::array<float,2>{0.886126518f, 0.774345875f},
-std::array<float,2>{0.017404722f, 0.467892349f},
-std::array<float,2>{0.630741835f, 0.0535094626f},
-std::array<float,2>{0.475984246f, 0.719334006f},
-std::array<float,2>{0.558924556f, 0.589013457f},
-std::array<float,2>{0.25262174f, 0.207218468f},
-std::array<float,2>{0.870487809f, 0.274242699f},
-std::array<float,2>{0.129846752f, 0.978316367f},
-std::array<float,2>{0.792459071f, 0.630433142f},
-std::array<float,2>{0.221519843f, 0.0708003193f},
-std::array<float,2>{0.587303579f, 0.433215588f},
-std::array<float,2>{0.367106587f, 0.845618069f},
-std::array<float,2>{0.695509911f, 0.906048238f},
-std::array<float,2>{0.415743202f, 0.362176985f},
-std::array<float,2>{0.946004868f, 0.145911604f},
-std::array<float,2>{0.0646992326f, 0.540780783f},
-std::array<float,2>{0.83338064f, 0.94288969f},
-std::array<float,2>{0.163766563f, 0.307466805f},
-std::array<float,2>{0.500486314f, 0.232589751f},
-std::array<float,2>{0.29707402f, 0.622231245f},
-std::array<float,2>{0.67714107f, 0.703200817f},
-std::array<float,2>{0.459298134f, 0.00296515715f},
-std::array<float,2>{0.925690711f, 0.491734833f},
-std::array<float,2>{0.0555883981f, 0.804425359f},
-std::array<float,2>{0.970299363f, 0.512406886f},
-std::array<float,2>{0.120903388f, 0.183945581f},
-std::array<float,2>{0.749244332f, 0.338225871f},
-std::array<float,2>{0.375349432f, 0.937065363f},
-std::array<float,2>{0.617756903f, 0.821631134f},
-std::array<float,2>{0.334677726f, 0.38410449f},
-std::array<float,2>{0.755096078f, 0.120519631f},
-std::array<float,2>{0.195991457f, 0.67473197f},
-std::array<float,2>{0.936533034f, 0.974262118f},
-std::array<float,2>{0.0522092208f, 0.269906163f},
-std::array<float,2>{0.68658942f, 0.215416566f},
-std::array<float,2>{0.466402084f, 0.579706073f},
-std::array<float,2>{0.512511909f, 0.729518294f},
-std::array<float,2>{0.304803401f, 0.0553335026f},
-std::array<float,2>{0.843435287f, 0.456381947f},
-std::array<float,2>{0.167025775f, 0.769418418f},
-std::array<float,2>{0.759566069f, 0.534780145f},
-std::array<float,2>{0.193979993f, 0.152207762f},
-std::array<float,2>{0.610105693f, 0.369230568f},
-std::array<float,2>{0.339402795f, 0.895299792f},
-std::array<float,2>{0.741306305f, 0.859033704f},
-std::array<float,2>{0.387339801f, 0.428828984f},
-std::array<float,2>{0.979129851f, 0.0656643137f},
-std::array<float,2>{0.112589337f, 0.635755777f},
-std::array<float,2>{0.864462435f, 0.812269926f},
-std::array<float,2>{0.137078702f, 0.496967316f},
-std::array<float,2>{0.547528863f, 0.00838516094f},
-std::array<float,2>{0.263507694f, 0.713600278f},
-std::array<float,2>{0.639654338f, 0.610285044f},
-std::array<float,2>{0.484143913f, 0.223526508f},
-std::array<float,2>{0.875441134f, 0.298860431f},
-std::array<float,2>{0.0284676403f, 0.950908601f},
-std::array<float,2>{0.94206202f, 0.686054945f},
-std::array<float,2>{0.0775462687f, 0.114527397f},
-std::array<float,2>{0.689369261f, 0.378908426f},
-std::array<float,2>{0.412811607f, 0.817349911f},
-std::array<float,2>{0.582117975f, 0.922636628f},
-std::array<float,2>{0.370259821f, 0.331875026f},
-std::array<float,2>{0.781780899f, 0.17713438f},
-std::array<float,2>{0.229236558f, 0.500253916f},
-std::array<float,2>{0.995346308f, 0.84077853f},
-std::array<float,2>{0.101567224f, 0.406169921f},
-std::array<float,2>{0.730935931f, 0.106998488f},
-std::array<float,2>{0.401118696f, 0.658369064f},
-std::array<float,2>{0.604490519f, 0.525181115f},
-std::array<float,2>{0.315600455f, 0.167027369f},
-std::array<float,2>{0.776928127f, 0.315632075f},
-std::array<float,2>{0.215764835f, 0.914643705f},
-std::array<float,2>{0.814141691f, 0.702973187f},
-std::array<float,2>{0.172013447f, 0.0206207354f},
-std::array<float,2>{0.530834019f, 0.473437488f},
-std::array<float,2>{0.290920824f, 0.785377979f},
-std::array<float,2>{0.660561681f, 0.963605046f},
-std::array<float,2>{0.441355288f, 0.290003389f},
-std::array<float,2>{0.917543471f, 0.242588669f},
-std::array<float,2>{0.0391595401f, 0.598116398f},
-std::array<float,2>{0.80855161f, 0.884935558f},
-std::array<float,2>{0.246921986f, 0.355309635f},
-std::array<float,2>{0.56948173f, 0.128464296f},
-std::array<float,2>{0.353574365f, 0.550591886f},
-std::array<float,2>{0.715878069f, 0.647087276f},
-std::array<float,2>{0.424656123f, 0.0797519162f},
-std::array<float,2>{0.957454085f, 0.40793699f},
-std::array<float,2>{0.0790257752f, 0.865719318f},
-std::array<float,2>{0.901362062f, 0.5696702f},
-std::array<float,2>{0.0137336478f, 0.200518414f},
-std::array<float,2>{0.648976088f, 0.260148436f},
-std::array<float,2>{0.486279249f, 0.995717406f},
-std::array<float,2>{0.545253038f, 0.757660925f},
-std::array<float,2>{0.269162506f, 0.443656415f},
-std::array<float,2>{0.848757207f, 0.039962694f},
-std::array<float,2>{0.141732782f, 0.74317795f},
-std::array<float,2>{0.93924582f, 0.987199068f},
-std::array<float,2>{0.0720381811f, 0.257730901f},
-std::array<float,2>{0.695147932f, 0.190420479f},
-std::array<float,2>{0.406349748f, 0.570447445f},
-std::array<float,2>{0.581039667f, 0.735415876f},
-std::array<float,2>{0.372510254f, 0.0354637615f},
-std::array<float,2>{0.788514316f, 0.453003198f},
-std::array<float,2>{0.231887788f, 0.758246124f},
-std::array<float,2>{0.862465143f, 0.55683285f},
-std::array<float,2>{0.134893388f, 0.137609825f},
-std::array<float,2>{0.552190602f, 0.347365052f},
-std::array<float,2>{0.259838462f, 0.879716575f},
-std::array<float,2>{0.636030018f, 0.87105906f},
-std::array<float,2>{0.48044917f, 0.415846646f},
-std::array<float,2>{0.880542338f, 0.0887832046f},
-std::array<float,2>{0.0237022396f, 0.65493679f},
-std::array<float,2>{0.76383996f, 0.791024745f},
-std::array<float,2>{0.191234201f, 0.478213847f},
-std::array<float,2>{0.613458037f, 0.0256064292f},
-std::array<float,2>{0.342494935f, 0.691372633f},
-std::array<float,2>{0.736440897f, 0.60462606f},
-std::array<float,2>{0.383984089f, 0.242016017f},
-std::array<float,2>{0.980825722f, 0.285290241f},
-std::array<float,2>{0.113443084f, 0.958844185f},
-std::array<float,2>{0.932590485f, 0.666945815f},
-std::array<float,2>{0.0500211641f, 0.0958531722f},
-std::array<float,2>{0.680100381f, 0.393760026f},
-std::array<float,2>{0.462551892f, 0.833432734f},
-std::array<float,2>{0.511416316f, 0.913942039f},
-std::array<float,2>{0.311083436f, 0.327514738f},
-std::array<float,2>{0.836607456f, 0.156673163f},
-std::array<float,2>{0.169464886f, 0.522859573f},
-std::array<float,2>{0.905335844f, 0.826580405f},
-std::array<float,2>{0.00808552187f, 0.3868559f},
-std::array<float,2>{0.654224753f, 0.124190576f},
-std::array<float,2>{0.490010142f, 0.677081585f},
-std::array<float,2>{0.539265871f, 0.511624038f},
-std::array<float,2>{0.272259086f, 0.183156073f},
-std::array<float,2>{0.847263932f, 0.341454178f},
-std::array<float,2>{0.148252353f, 0.930155396f},
-std::array<float,2>{0.811441064f, 0.709783018f},
-std::array<float,2>{0.242376313f, 0.00721722841f},
-std::array<float,2>{0.564170957f, 0.486210704f},
-std::array<float,2>{0.355773211f, 0.79798317f},
-std::array<float,2>{0.711127937f, 0.937556505f},
-std::array<float,2>{0.426180005f, 0.309411168f},
-std::array<float,2>{0.954691291f, 0.22897619f},
-std::array<float,2>{0.0855264887f, 0.618340552f},
-std::array<float,2>{0.817230225f, 0.901078999f},
-std::array<float,2>{0.175801545f, 0.366898209f},
-std::array<float,2>{0.526991606f, 0.142476901f},
-std::array<float,2>{0.294707239f, 0.543438554f},
-std::array<float,2>{0.660011232f, 0.627666533f},
-std::array<float,2>{0.443752587f, 0.0750762746f},
-std::array<float,2>{0.919597149f, 0.435150236f},
-std::array<float,2>{0.0457013696f, 0.850889981f},
-std::array<float,2>{0.996190786f, 0.592515111f},
-std::array<float,2>{0.105553888f, 0.206321537f},
-std::array<float,2>{0.728765905f, 0.278402418f},
-std::array<float,2>{0.40622434f, 0.983365178f},
-std::array<float,2>{0.608991504f, 0.777385473f},
-std::array<float,2>{0.31986323f, 0.464099854f},
-std::array<float,2>{0.779235601f, 0.0485948734f},
-std::array<float,2>{0.212940156f, 0.722871006f},
-std::array<float,2>{0.912339866f, 0.926829815f},
-std::array<float,2>{0.0347758159f, 0.333193183f},
-std::array<float,2>{0.664071262f, 0.174911126f},
-std::array<float,2>{0.452983499f, 0.504487813f},
-std::array<float,2>{0.523160338f, 0.680451751f},
-std::array<float,2>{0.286556631f, 0.11007221f},
-std::array<float,2>{0.824164808f, 0.375824362f},
-std::array<float,2>{0.183881089f, 0.813982368f},
-std::array<float,2>{0.772409201f, 0.615064383f},
-std::array<float,2>{0.209336162f, 0.219358608f},
-std::array<float,2>{0.600267291f, 0.304017484f},
-std::array<float,2>{0.323433071f, 0.945937872f},
-std::array<float,2>{0.719075024f, 0.80624795f},
-std::array<float,2>{0.39514485f, 0.493475884f},
-std::array<float,2>{0.988379657f, 0.0126461331f},
-std::array<float,2>{0.0942550376f, 0.718250275f},
-std::array<float,2>{0.852526724f, 0.852698088f},
-std::array<float,2>{0.150488555f, 0.424774885f},
-std::array<float,2>{0.539038479f, 0.0668025166f},
-std::array<float,2>{0.279697418f, 0.639958322f},
-std::array<float,2>{0.645239234f, 0.535954177f},
-std::array<float,2>{0.495486051f, 0.153365389f},
-std::array<float,2>{0.894652665f, 0.373632133f},
-std::array<float,2>{0.00564483786f, 0.890887082f},
-std::array<float,2>{0.964072585f, 0.730969548f},
-std::array<float,2>{0.0936556682f, 0.0620792508f},
-std::array<float,2>{0.709140182f, 0.458767116f},
-std::array<float,2>{0.436620921f, 0.771263361f},
-std::array<float,2>{0.572782338f, 0.970454037f},
-std::array<float,2>{0.347977698f, 0.266201377f},
-std::array<float,2>{0.802290738f, 0.212138414f},
-std::array<float,2>{0.239001721f, 0.58586061f},
-std::array<float,2>{0.973873138f, 0.75373441f},
-std::array<float,2>{0.122247122f, 0.441198111f},
-std::array<float,2>{0.745748043f, 0.0466961265f},
-std::array<float,2>{0.380485356f, 0.746738255f},
-std::array<float,2>{0.623595119f, 0.56457144f},
-std::array<float,2>{0.330710828f, 0.198547304f},
-std::array<float,2>{0.751826704f, 0.261860013f},
-std::array<float,2>{0.201809913f, 0.996630907f},
-std::array<float,2>{0.831017196f, 0.644083202f},
-std::array<float,2>{0.15713273f, 0.083078213f},
-std::array<float,2>{0.506093681f, 0.410535276f},
-std::array<float,2>{0.304155499f, 0.862157464f},
-std::array<float,2>{0.672257066f, 0.88726306f},
-std::array<float,2>{0.454942226f, 0.359051675f},
-std::array<float,2>{0.928305686f, 0.12953271f},
-std::array<float,2>{0.0620806068f, 0.551669478f},
-std::array<float,2>{0.796348572f, 0.967637002f},
-std::array<float,2>{0.224424288f, 0.294148833f},
-std::array<float,2>{0.593156219f, 0.248996079f},
-std::array<float,2>{0.360529929f, 0.594879031f},
-std::array<float,2>{0.701802909f, 0.695349693f},
-std::array<float,2>{0.420885205f, 0.0177280512f},
-std::array<float,2>{0.951570749f, 0.468894422f},
-std::array<float,2>{0.0687227026f, 0.781547368f},
-std::array<float,2>{0.887493193f, 0.527584791f},
-std::array<float,2>{0.0227732006f, 0.169919506f},
-std::array<float,2>{0.626580894f, 0.318517834f},
-std::array<float,2>{0.469474077f, 0.920203269f},
-std::array<float,2>{0.556309998f, 0.837901831f},
-std::array<float,2>{0.25685665f, 0.399398774f},
-std::array<float,2>{0.873771489f, 0.105451882f},
-std::array<float,2>{0.126260757f, 0.664042115f},
-std::array<float,2>{0.986742556f, 0.875647366f},
-std::array<float,2>{0.0977080837f, 0.348861009f},
-std::array<float,2>{0.72363013f, 0.133670464f},
-std::array<float,2>{0.393057704f, 0.559624374f},
-std::array<float,2>{0.595621586f, 0.649095714f},
-std::array<float,2>{0.327294081f, 0.0922286585f},
-std::array<float,2>{0.766429245f, 0.418754786f},
-std::array<float,2>{0.206936523f, 0.873263001f},
-std::array<float,2>{0.824993551f, 0.577881336f},
-std::array<float,2>{0.180811971f, 0.19252035f},
-std::array<float,2>{0.516067982f, 0.252603382f},
-std::array<float,2>{0.282857627f, 0.99029386f},
-std::array<float,2>{0.668014765f, 0.763044715f},
-std::array<float,2>{0.447855532f, 0.448847264f},
-std::array<float,2>{0.908138573f, 0.0315915383f},
-std::array<float,2>{0.0358717293f, 0.738549411f},
-std::array<float,2>{0.798620045f, 0.831943214f},
-std::array<float,2>{0.237354949f, 0.397575915f},
-std::array<float,2>{0.574759185f, 0.0982863158f},
-std::array<float,2>{0.346475184f, 0.66912508f},
-std::array<float,2>{0.703892529f, 0.51923579f},
-std::array<float,2>{0.429801881f, 0.160290793f},
-std::array<float,2>{0.966924131f, 0.321719915f},
-std::array<float,2>{0.0882705823f, 0.90665549f},
-std::array<float,2>{0.892876208f, 0.692433476f},
-std::array<float,2>{0.00105527334f, 0.029859798f},
-std::array<float,2>{0.642453909f, 0.480635673f},
-std::array<float,2>{0.499087483f, 0.795850635f},
-std::array<float,2>{0.532818258f, 0.955622017f},
-std::array<float,2>{0.273691922f, 0.282202393f},
-std::array<float,2>{0.856836319f, 0.237158909f},
-std::array<float,2>{0.15557684f, 0.608510911f},
-std::array<float,2>{0.922495365f, 0.800957024f},
-std::array<float,2>{0.0571295023f, 0.488342881f},
-std::array<float,2>{0.677935481f, 0.00194119627f},
-std::array<float,2>{0.458839387f, 0.705699027f},
-std::array<float,2>{0.503256798f, 0.623145819f},
-std::array<float,2>{0.299113572f, 0.231596157f},
-std::array<float,2>{0.835768461f, 0.305903137f},
-std::array<float,2>{0.16139482f, 0.944626927f},
-std::array<float,2>{0.75749886f, 0.672094822f},
-std::array<float,2>{0.198065832f, 0.117885582f},
-std::array<float,2>{0.620751262f, 0.3852925f},
-std::array<float,2>{0.332966238f, 0.823322415f},
-std::array<float,2>{0.747374475f, 0.935546458f},
-std::array<float,2>{0.378003031f, 0.336149693f},
-std::array<float,2>{0.970816612f, 0.187411532f},
-std::array<float,2>{0.11844112f, 0.513836861f},
-std::array<float,2>{0.868746698f, 0.97851789f},
-std::array<float,2>{0.131350204f, 0.276363283f},
-std::array<float,2>{0.561222315f, 0.209660798f},
-std::array<float,2>{0.251947194f, 0.587140858f},
-std::array<float,2>{0.630974531f, 0.721548975f},
-std::array<float,2>{0.472731382f, 0.0519628115f},
-std::array<float,2>{0.884108067f, 0.466052473f},
-std::array<float,2>{0.0183368344f, 0.777066469f},
-std::array<float,2>{0.948521912f, 0.542117655f},
-std::array<float,2>{0.0634388179f, 0.146712765f},
-std::array<float,2>{0.698856711f, 0.360270768f},
-std::array<float,2>{0.41751191f, 0.90236938f},
-std::array<float,2>{0.589219153f, 0.846191168f},
-std::array<float,2>{0.364706933f, 0.430760503f},
-std::array<float,2>{0.790251076f, 0.0737900063f},
-std::array<float,2>{0.220652312f, 0.632082105f},
-std::array<float,2>{0.87781173f, 0.952394366f},
-std::array<float,2>{0.0299743507f, 0.298422813f},
-std::array<float,2>{0.637234867f, 0.225919232f},
-std::array<float,2>{0.48226285f, 0.612951159f},
-std::array<float,2>{0.550557792f, 0.712534428f},
-std::array<float,2>{0.264597178f, 0.010151919f},
-std::array<float,2>{0.866142154f, 0.499621034f},
-std::array<float,2>{0.139474154f, 0.810280085f},
-std::array<float,2>{0.783574224f, 0.503845215f},
-std::array<float,2>{0.226868093f, 0.178527772f},
-std::array<float,2>{0.584095001f, 0.329391897f},
-std::array<float,2>{0.367848217f, 0.924157977f},
-std::array<float,2>{0.690817356f, 0.818979204f},
-std::array<float,2>{0.410504878f, 0.382773101f},
-std::array<float,2>{0.944449663f, 0.116903916f},
-std::array<float,2>{0.0756333843f, 0.68429333f},
-std::array<float,2>{0.840028882f, 0.766073644f},
-std::array<float,2>{0.165961862f, 0.453363776f},
-std::array<float,2>{0.515181661f, 0.0577613525f},
-std::array<float,2>{0.307891876f, 0.728375912f},
-std::array<float,2>{0.684633255f, 0.581416607f},
-std::array<float,2>{0.468187094f, 0.218225628f},
-std::array<float,2>{0.933971882f, 0.272171378f},
-std::array<float,2>{0.0528380275f, 0.976323187f},
-std::array<float,2>{0.977415144f, 0.633176148f},
-std::array<float,2>{0.110239901f, 0.0641956031f},
-std::array<float,2>{0.73929286f, 0.427502692f},
-std::array<float,2>{0.389015406f, 0.85690254f},
-std::array<float,2>{0.611462653f, 0.897803128f},
-std::array<float,2>{0.337383419f, 0.368100554f},
-std::array<float,2>{0.760751843f, 0.149059236f},
-std::array<float,2>{0.192849219f, 0.532766759f},
-std::array<float,2>{0.959367692f, 0.864186585f},
-std::array<float,2>{0.0819295868f, 0.40967983f},
-std::array<float,2>{0.718504667f, 0.0815952718f},
-std::array<float,2>{0.42267704f, 0.645138264f},
-std::array<float,2>{0.568142176f, 0.547664046f},
-std::array<float,2>{0.352880269f, 0.126161143f},
-std::array<float,2>{0.80633688f, 0.353035927f},
-std::array<float,2>{0.249148488f, 0.883425891f},
-std::array<float,2>{0.850861967f, 0.744781792f},
-std::array<float,2>{0.143655062f, 0.0423001014f},
-std::array<float,2>{0.543560624f, 0.44292587f},
-std::array<float,2>{0.26635471f, 0.755071819f},
-std::array<float,2>{0.651858389f, 0.992873311f},
-std::array<float,2>{0.487250954f, 0.259291738f},
-std::array<float,2>{0.898906648f, 0.202866107f},
-std::array<float,2>{0.0122526959f, 0.567957938f},
-std::array<float,2>{0.774163723f, 0.917433798f},
-std::array<float,2>{0.217006266f, 0.313770562f},
-std::array<float,2>{0.602274895f, 0.165586933f},
-std::array<float,2>{0.313139707f, 0.526174188f},
-std::array<float,2>{0.733470917f, 0.656840324f},
-std::array<float,2>{0.398919463f, 0.109035671f},
-std::array<float,2>{0.992467821f, 0.402679592f},
-std::array<float,2>{0.10459698f, 0.842584491f},
-std::array<float,2>{0.914496303f, 0.601276159f},
-std::array<float,2>{0.0414924957f, 0.245847464f},
-std::array<float,2>{0.663064599f, 0.292267025f},
-std::array<float,2>{0.438374728f, 0.962291598f},
-std::array<float,2>{0.528870583f, 0.788728952f},
-std::array<float,2>{0.292879939f, 0.474677235f},
-std::array<float,2>{0.815890372f, 0.0232172608f},
-std::array<float,2>{0.175777808f, 0.701034129f},
-std::array<float,2>{0.951979876f, 0.966484487f},
-std::array<float,2>{0.0690433234f, 0.295197099f},
-std::array<float,2>{0.701508701f, 0.247105956f},
-std::array<float,2>{0.41993618f, 0.595822096f},
-std::array<float,2>{0.593440473f, 0.697641194f},
-std::array<float,2>{0.361153275f, 0.0161469001f},
-std::array<float,2>{0.796501637f, 0.472362369f},
-std::array<float,2>{0.223661765f, 0.784300387f},
-std::array<float,2>{0.873497486f, 0.530712485f},
-std::array<float,2>{0.126617506f, 0.171411544f},
-std::array<float,2>{0.555874169f, 0.317273825f},
-std::array<float,2>{0.257801324f, 0.919665515f},
-std::array<float,2>{0.626269996f, 0.83767581f},
-std::array<float,2>{0.468827993f, 0.401591718f},
-std::array<float,2>{0.887050211f, 0.10237994f},
-std::array<float,2>{0.0230725892f, 0.661177576f},
-std::array<float,2>{0.75142467f, 0.751726449f},
-std::array<float,2>{0.201246604f, 0.438299567f},
-std::array<float,2>{0.623413146f, 0.0441612564f},
-std::array<float,2>{0.330218613f, 0.748581052f},
-std::array<float,2>{0.745575905f, 0.563556254f},
-std::array<float,2>{0.380248547f, 0.195554152f},
-std::array<float,2>{0.974286437f, 0.264946789f},
-std::array<float,2>{0.122589141f, 0.998609662f},
-std::array<float,2>{0.928173482f, 0.640990496f},
-std::array<float,2>{0.0615413822f, 0.0856061205f},
-std::array<float,2>{0.672447145f, 0.412856072f},
-std::array<float,2>{0.454146862f, 0.860862553f},
-std::array<float,2>{0.506799459f, 0.890381992f},
-std::array<float,2>{0.304261148f, 0.356166035f},
-std::array<float,2>{0.830558836f, 0.131282225f},
-std::array<float,2>{0.156470463f, 0.553773105f},
-std::array<float,2>{0.895230711f, 0.853735089f},
-std::array<float,2>{0.00505168689f, 0.422298074f},
-std::array<float,2>{0.645018995f, 0.0690316409f},
-std::array<float,2>{0.495974571f, 0.637826264f},
-std::array<float,2>{0.538524151f, 0.537985563f},
-std::array<float,2>{0.279920518f, 0.155565932f},
-std::array<float,2>{0.851693392f, 0.372936815f},
-std::array<float,2>{0.150955006f, 0.89300549f},
-std::array<float,2>{0.802164435f, 0.733120561f},
-std::array<float,2>{0.238548622f, 0.0599961914f},
-std::array<float,2>{0.572489858f, 0.460476637f},
-std::array<float,2>{0.348526627f, 0.77314657f},
-std::array<float,2>{0.709639609f, 0.97161603f},
-std::array<float,2>{0.437209964f, 0.267589569f},
-std::array<float,2>{0.964594901f, 0.21310541f},
-std::array<float,2>{0.0931603536f, 0.583064497f},
-std::array<float,2>{0.823248446f, 0.928440809f},
-std::array<float,2>{0.184214741f, 0.334802747f},
-std::array<float,2>{0.52265054f, 0.172739804f},
-std::array<float,2>{0.286976159f, 0.507425606f},
-std::array<float,2>{0.66456604f, 0.682947576f},
-std::array<float,2>{0.452234805f, 0.112777695f},
-std::array<float,2>{0.912644684f, 0.377302855f},
-std::array<float,2>{0.0342420638f, 0.815094829f},
-std::array<float,2>{0.989058197f, 0.616355717f},
-std::array<float,2>{0.0937552899f, 0.221461639f},
-std::array<float,2>{0.719537675f, 0.301439136f},
-std::array<float,2>{0.394705027f, 0.949164271f},
-std::array<float,2>{0.599926293f, 0.808570921f},
-std::array<float,2>{0.323799759f, 0.495175153f},
-std::array<float,2>{0.771671832f, 0.0143934535f},
-std::array<float,2>{0.209823981f, 0.715412557f},
-std::array<float,2>{0.91900748f, 0.899576485f},
-std::array<float,2>{0.045116663f, 0.364381284f},
-std::array<float,2>{0.659292281f, 0.14346391f},
-std::array<float,2>{0.444217682f, 0.546648145f},
-std::array<float,2>{0.526482999f, 0.625936091f},
-std::array<float,2>{0.294118762f, 0.0766811892f},
-std::array<float,2>{0.816499829f, 0.436387509f},
-std::array<float,2>{0.176409647f, 0.848691404f},
-std::array<float,2>{0.778623819f, 0.590988517f},
-std::array<float,2>{0.213422745f, 0.204578817f},
-std::array<float,2>{0.608862042f, 0.27939406f},
-std::array<float,2>{0.319363683f, 0.981425107f},
-std::array<float,2>{0.729285777f, 0.780471683f},
-std::array<float,2>{0.405482978f, 0.461396158f},
-std::array<float,2>{0.99699831f, 0.0497256517f},
-std::array<float,2>{0.106196254f, 0.725736439f},
-std::array<float,2>{0.846738636f, 0.824583709f},
-std::array<float,2>{0.147897318f, 0.389947355f},
-std::array<float,2>{0.539853632f, 0.122914903f},
-std::array<float,2>{0.271526724f, 0.678839684f},
-std::array<float,2>{0.653662562f, 0.50904125f},
-std::array<float,2>{0.489532828f, 0.179815173f},
-std::array<float,2>{0.90619725f, 0.343569458f},
-std::array<float,2>{0.00836063549f, 0.932010114f},
-std::array<float,2>{0.954485357f, 0.708686829f},
-std::array<float,2>{0.0851701126f, 0.00493055955f},
-std::array<float,2>{0.71185118f, 0.487159342f},
-std::array<float,2>{0.426646858f, 0.800694108f},
-std::array<float,2>{0.563779175f, 0.941384614f},
-std::array<float,2>{0.356189787f, 0.31112349f},
-std::array<float,2>{0.81075269f, 0.227898493f},
-std::array<float,2>{0.242723837f, 0.619151831f},
-std::array<float,2>{0.981106997f, 0.790875018f},
-std::array<float,2>{0.114194974f, 0.478748471f},
-std::array<float,2>{0.737225711f, 0.0237489957f},
-std::array<float,2>{0.384477317f, 0.688091874f},
-std::array<float,2>{0.614161849f, 0.602940857f},
-std::array<float,2>{0.341961563f, 0.238524377f},
-std::array<float,2>{0.764412522f, 0.287619352f},
-std::array<float,2>{0.190529585f, 0.960402966f},
-std::array<float,2>{0.836072981f, 0.665726304f},
-std::array<float,2>{0.169173047f, 0.0939832181f},
-std::array<float,2>{0.511174679f, 0.391098022f},
-std::array<float,2>{0.310748667f, 0.8357265f},
-std::array<float,2>{0.680341661f, 0.910906732f},
-std::array<float,2>{0.46237877f, 0.325950295f},
-std::array<float,2>{0.931925476f, 0.159799382f},
-std::array<float,2>{0.0504105464f, 0.520437598f},
-std::array<float,2>{0.788690448f, 0.985369861f},
-std::array<float,2>{0.232329249f, 0.255167872f},
-std::array<float,2>{0.580403626f, 0.189160466f},
-std::array<float,2>{0.372684598f, 0.573717773f},
-std::array<float,2>{0.694345295f, 0.737983942f},
-std::array<float,2>{0.406749934f, 0.0380858742f},
-std::array<float,2>{0.938649595f, 0.45046854f},
-std::array<float,2>{0.0716639161f, 0.761048794f},
-std::array<float,2>{0.879993558f, 0.556447744f},
-std::array<float,2>{0.0240289383f, 0.139294997f},
-std::array<float,2>{0.636607528f, 0.344939828f},
-std::array<float,2>{0.479765058f, 0.881225288f},
-std::array<float,2>{0.552390456f, 0.867236912f},
-std::array<float,2>{0.260382384f, 0.416742355f},
-std::array<float,2>{0.863158524f, 0.0861811414f},
-std::array<float,2>{0.135506347f, 0.653777361f},
-std::array<float,2>{0.993007421f, 0.914175093f},
-std::array<float,2>{0.105111361f, 0.316375583f},
-std::array<float,2>{0.73416245f, 0.167711809f},
-std::array<float,2>{0.399382502f, 0.524834931f},
-std::array<float,2>{0.601677835f, 0.658820033f},
-std::array<float,2>{0.31281665f, 0.106635951f},
-std::array<float,2>{0.773782909f, 0.405397177f},
-std::array<float,2>{0.217365608f, 0.839998484f},
-std::array<float,2>{0.816215336f, 0.598274112f},
-std::array<float,2>{0.17504023f, 0.243110359f},
-std::array<float,2>{0.528323114f, 0.289318442f},
-std::array<float,2>{0.292465568f, 0.963098466f},
-std::array<float,2>{0.662362516f, 0.785727084f},
-std::array<float,2>{0.437736422f, 0.472925782f},
-std::array<float,2>{0.914726079f, 0.0212834533f},
-std::array<float,2>{0.0418642946f, 0.70227319f},
-std::array<float,2>{0.80591774f, 0.866100788f},
-std::array<float,2>{0.249865264f, 0.407292813f},
-std::array<float,2>{0.567635715f, 0.0792377591f},
-std::array<float,2>{0.35320425f, 0.646841466f},
-std::array<float,2>{0.718173265f, 0.550100684f},
-std::array<float,2>{0.422253966f, 0.12810643f},
-std::array<float,2>{0.959782779f, 0.354741395f},
-std::array<float,2>{0.0811946839f, 0.885678232f},
-std::array<float,2>{0.899401307f, 0.743880033f},
-std::array<float,2>{0.0121010514f, 0.0393441506f},
-std::array<float,2>{0.65153563f, 0.44430694f},
-std::array<float,2>{0.486448675f, 0.75707227f},
-std::array<float,2>{0.543340683f, 0.995458901f},
-std::array<float,2>{0.265643448f, 0.260661244f},
-std::array<float,2>{0.851257443f, 0.201135531f},
-std::array<float,2>{0.144350454f, 0.56989783f},
-std::array<float,2>{0.934486032f, 0.76904279f},
-std::array<float,2>{0.0532886982f, 0.456627935f},
-std::array<float,2>{0.685221314f, 0.0547838025f},
-std::array<float,2>{0.468730688f, 0.730107844f},
-std::array<float,2>{0.515018582f, 0.579257607f},
-std::array<float,2>{0.3083224f, 0.214858606f},
-std::array<float,2>{0.840583205f, 0.270394385f},
-std::array<float,2>{0.165439099f, 0.973970771f},
-std::array<float,2>{0.761389792f, 0.636659741f},
-std::array<float,2>{0.192879125f, 0.0663426518f},
-std::array<float,2>{0.611905515f, 0.42939508f},
-std::array<float,2>{0.337405175f, 0.858516872f},
-std::array<float,2>{0.739763677f, 0.894695222f},
-std::array<float,2>{0.389412761f, 0.369649827f},
-std::array<float,2>{0.976969004f, 0.151585147f},
-std::array<float,2>{0.109498061f, 0.53448236f},
-std::array<float,2>{0.865699291f, 0.95062089f},
-std::array<float,2>{0.138930678f, 0.299327284f},
-std::array<float,2>{0.55027467f, 0.223008543f},
-std::array<float,2>{0.263844341f, 0.609835923f},
-std::array<float,2>{0.637174845f, 0.713365138f},
-std::array<float,2>{0.481569141f, 0.00790389534f},
-std::array<float,2>{0.877260923f, 0.496542215f},
-std::array<float,2>{0.0293631814f, 0.811604559f},
-std::array<float,2>{0.94487834f, 0.500933468f},
-std::array<float,2>{0.0758322254f, 0.177250087f},
-std::array<float,2>{0.691147327f, 0.331493914f},
-std::array<float,2>{0.410718769f, 0.92190212f},
-std::array<float,2>{0.58455056f, 0.816432297f},
-std::array<float,2>{0.367298186f, 0.379743278f},
-std::array<float,2>{0.784070909f, 0.114900813f},
-std::array<float,2>{0.227338612f, 0.685642719f},
-std::array<float,2>{0.884365499f, 0.97778064f},
-std::array<float,2>{0.0177064277f, 0.273552448f},
-std::array<float,2>{0.631539166f, 0.20800285f},
-std::array<float,2>{0.473465621f, 0.589670062f},
-std::array<float,2>{0.560883224f, 0.719144344f},
-std::array<float,2>{0.251231045f, 0.053096734f},
-std::array<float,2>{0.868232787f, 0.468472064f},
-std::array<float,2>{0.131086379f, 0.773496747f},
-std::array<float,2>{0.790842414f, 0.540221751f},
-std::array<float,2>{0.220063403f, 0.146127135f},
-std::array<float,2>{0.589744508f, 0.361487776f},
-std::array<float,2>{0.36492914f, 0.905428052f},
-std::array<float,2>{0.698656917f, 0.844970703f},
-std::array<float,2>{0.417430401f, 0.432896405f},
-std::array<float,2>{0.948805034f, 0.0708201826f},
-std::array<float,2>{0.0628871843f, 0.630203307f},
-std::array<float,2>{0.835310221f, 0.803829372f},
-std::array<float,2>{0.161783338f, 0.491279244f},
-std::array<float,2>{0.503571808f, 0.00353050069f},
-std::array<float,2>{0.299793035f, 0.703938007f},
-std::array<float,2>{0.678396404f, 0.623007059f},
-std::array<float,2>{0.458407372f, 0.233330637f},
-std::array<float,2>{0.922078133f, 0.307015806f},
-std::array<float,2>{0.0570550635f, 0.942651808f},
-std::array<float,2>{0.971616805f, 0.674173534f},
-std::array<float,2>{0.118655175f, 0.120682813f},
-std::array<float,2>{0.747831285f, 0.384601116f},
-std::array<float,2>{0.378775418f, 0.821914554f},
-std::array<float,2>{0.62042886f, 0.936827481f},
-std::array<float,2>{0.332248122f, 0.338431329f},
-std::array<float,2>{0.75704217f, 0.184118092f},
-std::array<float,2>{0.197351784f, 0.511983812f},
-std::array<float,2>{0.967740893f, 0.82849443f},
-std::array<float,2>{0.0885093734f, 0.395805448f},
-std::array<float,2>{0.703151166f, 0.101481952f},
-std::array<float,2>{0.430186301f, 0.670696676f},
-std::array<float,2>{0.574408054f, 0.51608336f},
-std::array<float,2>{0.345780373f, 0.163060561f},
-std::array<float,2>{0.79814589f, 0.322819382f},
-std::array<float,2>{0.238261774f, 0.908244312f},
-std::array<float,2>{0.857361138f, 0.693702161f},
-std::array<float,2>{0.155875251f, 0.0274782535f},
-std::array<float,2>{0.532477617f, 0.482492447f},
-std::array<float,2>{0.27393654f, 0.794684052f},
-std::array<float,2>{0.641954601f, 0.954335034f},
-std::array<float,2>{0.49991712f, 0.283468634f},
-std::array<float,2>{0.893375158f, 0.235116571f},
-std::array<float,2>{0.00172611629f, 0.605889142f},
-std::array<float,2>{0.765746772f, 0.877350271f},
-std::array<float,2>{0.206520677f, 0.350630641f},
-std::array<float,2>{0.594762683f, 0.136707589f},
-std::array<float,2>{0.327672035f, 0.56056571f},
-std::array<float,2>{0.72306633f, 0.65166223f},
-std::array<float,2>{0.393394947f, 0.0913901329f},
-std::array<float,2>{0.986840963f, 0.421553612f},
-std::array<float,2>{0.0983525366f, 0.872208714f},
-std::array<float,2>{0.907561243f, 0.575384319f},
-std::array<float,2>{0.0355188064f, 0.195003569f},
-std::array<float,2>{0.668551207f, 0.251577079f},
-std::array<float,2>{0.44747144f, 0.989167273f},
-std::array<float,2>{0.516532302f, 0.764249742f},
-std::array<float,2>{0.282286197f, 0.44694671f},
-std::array<float,2>{0.82441783f, 0.0338149779f},
-std::array<float,2>{0.181575388f, 0.741983712f},
-std::array<float,2>{0.975492597f, 0.996133149f},
-std::array<float,2>{0.124873072f, 0.262577653f},
-std::array<float,2>{0.742435038f, 0.198748097f},
-std::array<float,2>{0.382424802f, 0.565042675f},
-std::array<float,2>{0.622891068f, 0.746182203f},
-std::array<float,2>{0.329272836f, 0.046037633f},
-std::array<float,2>{0.753380299f, 0.440445155f},
-std::array<float,2>{0.200382143f, 0.753340244f},
-std::array<float,2>{0.829092979f, 0.551243007f},
-std::array<float,2>{0.158745155f, 0.12930876f},
-std::array<float,2>{0.505676091f, 0.35877797f},
-std::array<float,2>{0.300909042f, 0.886881113f},
-std::array<float,2>{0.674221694f, 0.861395597f},
-std::array<float,2>{0.456389129f, 0.410671473f},
-std::array<float,2>{0.926512599f, 0.0837605521f},
-std::array<float,2>{0.0590458997f, 0.643604577f},
-std::array<float,2>{0.794327497f, 0.782215953f},
-std::array<float,2>{0.225613788f, 0.46961391f},
-std::array<float,2>{0.590626538f, 0.0184890125f},
-std::array<float,2>{0.362028927f, 0.695894659f},
-std::array<float,2>{0.699835122f, 0.595653951f},
-std::array<float,2>{0.418716997f, 0.248396978f},
-std::array<float,2>{0.949496031f, 0.294613779f},
-std::array<float,2>{0.0683297217f, 0.966831982f},
-std::array<float,2>{0.890108526f, 0.663343966f},
-std::array<float,2>{0.0199589171f, 0.104817823f},
-std::array<float,2>{0.627211511f, 0.398870856f},
-std::array<float,2>{0.47159645f, 0.838663101f},
-std::array<float,2>{0.558005393f, 0.920747936f},
-std::array<float,2>{0.254169375f, 0.319118857f},
-std::array<float,2>{0.871109366f, 0.169038579f},
-std::array<float,2>{0.126975477f, 0.528038323f},
-std::array<float,2>{0.910342455f, 0.813557923f},
-std::array<float,2>{0.0327493586f, 0.375293642f},
-std::array<float,2>{0.666050255f, 0.109771766f},
-std::array<float,2>{0.45048058f, 0.680110633f},
-std::array<float,2>{0.520456672f, 0.503950775f},
-std::array<float,2>{0.288422942f, 0.175552681f},
-std::array<float,2>{0.821307361f, 0.333642364f},
-std::array<float,2>{0.185680896f, 0.927557886f},
-std::array<float,2>{0.770116091f, 0.718679607f},
-std::array<float,2>{0.208080128f, 0.0117705837f},
-std::array<float,2>{0.598542333f, 0.493736237f},
-std::array<float,2>{0.320964724f, 0.806029975f},
-std::array<float,2>{0.720941842f, 0.945633411f},
-std::array<float,2>{0.39761132f, 0.304307997f},
-std::array<float,2>{0.991369009f, 0.218930155f},
-std::array<float,2>{0.0957131609f, 0.61461246f},
-std::array<float,2>{0.853700578f, 0.891332805f},
-std::array<float,2>{0.150108621f, 0.373135835f},
-std::array<float,2>{0.535900414f, 0.154234454f},
-std::array<float,2>{0.278072834f, 0.535237014f},
-std::array<float,2>{0.64793539f, 0.640231371f},
-std::array<float,2>{0.493687034f, 0.0672616139f},
-std::array<float,2>{0.89692992f, 0.424274892f},
-std::array<float,2>{0.00603344385f, 0.853046656f},
-std::array<float,2>{0.962114334f, 0.585415721f},
-std::array<float,2>{0.090709269f, 0.212593123f},
-std::array<float,2>{0.708402455f, 0.265858024f},
-std::array<float,2>{0.433918834f, 0.970080733f},
-std::array<float,2>{0.571754098f, 0.7709378f},
-std::array<float,2>{0.351243019f, 0.45821318f},
-std::array<float,2>{0.802914202f, 0.0618431941f},
-std::array<float,2>{0.24039793f, 0.730658591f},
-std::array<float,2>{0.903328955f, 0.930425704f},
-std::array<float,2>{0.0106660128f, 0.341122925f},
-std::array<float,2>{0.655461729f, 0.18274647f},
-std::array<float,2>{0.491227299f, 0.511000931f},
-std::array<float,2>{0.542059124f, 0.677383244f},
-std::array<float,2>{0.270522416f, 0.124822274f},
-std::array<float,2>{0.845265806f, 0.387367964f},
-std::array<float,2>{0.146257579f, 0.826836765f},
-std::array<float,2>{0.809352994f, 0.618704736f},
-std::array<float,2>{0.245532364f, 0.229308009f},
-std::array<float,2>{0.565091908f, 0.308912903f},
-std::array<float,2>{0.357438415f, 0.938356578f},
-std::array<float,2>{0.714503586f, 0.79846859f},
-std::array<float,2>{0.427757442f, 0.485375971f},
-std::array<float,2>{0.956349194f, 0.00754479179f},
-std::array<float,2>{0.0825045481f, 0.709290862f},
-std::array<float,2>{0.820077837f, 0.85121572f},
-std::array<float,2>{0.17903541f, 0.434932142f},
-std::array<float,2>{0.524189472f, 0.0745693147f},
-std::array<float,2>{0.296867967f, 0.627221048f},
-std::array<float,2>{0.656491399f, 0.543733478f},
-std::array<float,2>{0.443325698f, 0.141627669f},
-std::array<float,2>{0.921359539f, 0.366273284f},
-std::array<float,2>{0.0432814173f, 0.900521636f},
-std::array<float,2>{0.998484552f, 0.723620355f},
-std::array<float,2>{0.109173886f, 0.0480621345f},
-std::array<float,2>{0.726997018f, 0.464364529f},
-std::array<float,2>{0.402599216f, 0.778108537f},
-std::array<float,2>{0.606052816f, 0.982794642f},
-std::array<float,2>{0.316622436f, 0.279124737f},
-std::array<float,2>{0.780806303f, 0.206577316f},
-std::array<float,2>{0.211808026f, 0.592005968f},
-std::array<float,2>{0.939540744f, 0.758397281f},
-std::array<float,2>{0.0734756365f, 0.452254385f},
-std::array<float,2>{0.692619205f, 0.0360459127f},
-std::array<float,2>{0.408545226f, 0.73593688f},
-std::array<float,2>{0.578629851f, 0.571013331f},
-std::array<float,2>{0.373356164f, 0.189554155f},
-std::array<float,2>{0.787068665f, 0.257234693f},
-std::array<float,2>{0.234081343f, 0.986559093f},
-std::array<float,2>{0.85980624f, 0.654453993f},
-std::array<float,2>{0.134319633f, 0.0880644843f},
-std::array<float,2>{0.553273797f, 0.415431678f},
-std::array<float,2>{0.259233326f, 0.87014848f},
-std::array<float,2>{0.633254826f, 0.879388332f},
-std::array<float,2>{0.476694375f, 0.3468602f},
-std::array<float,2>{0.881263018f, 0.136888891f},
-std::array<float,2>{0.0257216264f, 0.557388902f},
-std::array<float,2>{0.762666166f, 0.958080053f},
-std::array<float,2>{0.188381895f, 0.285987854f},
-std::array<float,2>{0.616033971f, 0.241251066f},
-std::array<float,2>{0.340215445f, 0.605117202f},
-std::array<float,2>{0.734700918f, 0.69047308f},
-std::array<float,2>{0.386225373f, 0.0263311304f},
-std::array<float,2>{0.98257494f, 0.477641791f},
-std::array<float,2>{0.115904205f, 0.79154712f},
-std::array<float,2>{0.930631757f, 0.523123443f},
-std::array<float,2>{0.0477342419f, 0.15711318f},
-std::array<float,2>{0.68257463f, 0.327854574f},
-std::array<float,2>{0.463179529f, 0.91355896f},
-std::array<float,2>{0.509720683f, 0.833741009f},
-std::array<float,2>{0.309031069f, 0.394495994f},
-std::array<float,2>{0.838339984f, 0.096413888f},
-std::array<float,2>{0.171313331f, 0.666208446f},
-std::array<float,2>{0.957821846f, 0.883064032f},
-std::array<float,2>{0.0783921853f, 0.352582633f},
-std::array<float,2>{0.716439486f, 0.126902655f},
-std::array<float,2>{0.424043268f, 0.547357082f},
-std::array<float,2>{0.569970787f, 0.644547939f},
-std::array<float,2>{0.354308605f, 0.0812488496f},
-std::array<float,2>{0.807774127f, 0.409564972f},
-std::array<float,2>{0.246215776f, 0.863696158f},
-std::array<float,2>{0.84935534f, 0.56742394f},
-std::array<float,2>{0.142320871f, 0.202612832f},
-std::array<float,2>{0.545527041f, 0.258945912f},
-std::array<float,2>{0.268940806f, 0.992231846f},
-std::array<float,2>{0.648635149f, 0.755850732f},
-std::array<float,2>{0.485817015f, 0.442582101f},
-std::array<float,2>{0.900544345f, 0.0425671227f},
-std::array<float,2>{0.0143122962f, 0.74427098f},
-std::array<float,2>{0.776772082f, 0.842121661f},
-std::array<float,2>{0.215323552f, 0.403206319f},
-std::array<float,2>{0.603691041f, 0.108491831f},
-std::array<float,2>{0.316158086f, 0.656347156f},
-std::array<float,2>{0.731284738f, 0.525534809f},
-std::array<float,2>{0.400623292f, 0.165220752f},
-std::array<float,2>{0.995756388f, 0.314188719f},
-std::array<float,2>{0.10225933f, 0.917929411f},
-std::array<float,2>{0.917115033f, 0.700511813f},
-std::array<float,2>{0.0399166234f, 0.0228303839f},
-std::array<float,2>{0.660663188f, 0.475580394f},
-std::array<float,2>{0.440654248f, 0.788463831f},
-std::array<float,2>{0.53031522f, 0.962688506f},
-std::array<float,2>{0.290295422f, 0.292923599f},
-std::array<float,2>{0.8137784f, 0.245577738f},
-std::array<float,2>{0.172654286f, 0.600887835f},
-std::array<float,2>{0.875546694f, 0.809728742f},
-std::array<float,2>{0.0292236973f, 0.499417812f},
-std::array<float,2>{0.640374184f, 0.0106624728f},
-std::array<float,2>{0.48341161f, 0.712377906f},
-std::array<float,2>{0.547080219f, 0.612442255f},
-std::array<float,2>{0.263155043f, 0.226106063f},
-std::array<float,2>{0.86510855f, 0.298244447f},
-std::array<float,2>{0.137641177f, 0.952803969f},
-std::array<float,2>{0.781297982f, 0.683616698f},
-std::array<float,2>{0.228867546f, 0.116653576f},
-std::array<float,2>{0.582603276f, 0.382202327f},
-std::array<float,2>{0.371076435f, 0.818621576f},
-std::array<float,2>{0.688915074f, 0.924463272f},
-std::array<float,2>{0.412324011f, 0.329722106f},
-std::array<float,2>{0.941674829f, 0.178128406f},
-std::array<float,2>{0.0780074298f, 0.5031721f},
-std::array<float,2>{0.842811465f, 0.975757599f},
-std::array<float,2>{0.167857498f, 0.271682888f},
-std::array<float,2>{0.512041092f, 0.218488172f},
-std::array<float,2>{0.305353254f, 0.581619799f},
-std::array<float,2>{0.687152207f, 0.72770071f},
-std::array<float,2>{0.466230869f, 0.0584017299f},
-std::array<float,2>{0.937140048f, 0.453686923f},
-std::array<float,2>{0.0522484779f, 0.766559958f},
-std::array<float,2>{0.978627682f, 0.532347679f},
-std::array<float,2>{0.112981312f, 0.148450091f},
-std::array<float,2>{0.741920114f, 0.367653549f},
-std::array<float,2>{0.387082636f, 0.898264408f},
-std::array<float,2>{0.609563589f, 0.857122958f},
-std::array<float,2>{0.33927843f, 0.426843613f},
-std::array<float,2>{0.759140372f, 0.0635954142f},
-std::array<float,2>{0.19359456f, 0.633387506f},
-std::array<float,2>{0.925173283f, 0.945157886f},
-std::array<float,2>{0.055142764f, 0.306272477f},
-std::array<float,2>{0.677298546f, 0.232408762f},
-std::array<float,2>{0.45987463f, 0.62376529f},
-std::array<float,2>{0.500644863f, 0.705431044f},
-std::array<float,2>{0.297741652f, 0.00111434108f},
-std::array<float,2>{0.833918452f, 0.489054471f},
-std::array<float,2>{0.163487002f, 0.801739573f},
-std::array<float,2>{0.755733252f, 0.514549494f},
-std::array<float,2>{0.195479795f, 0.186929196f},
-std::array<float,2>{0.617264152f, 0.336730838f},
-std::array<float,2>{0.334399223f, 0.934881568f},
-std::array<float,2>{0.749664485f, 0.824156582f},
-std::array<float,2>{0.37595582f, 0.38517198f},
-std::array<float,2>{0.969962656f, 0.117397085f},
-std::array<float,2>{0.120530948f, 0.672509432f},
-std::array<float,2>{0.870860398f, 0.776702285f},
-std::array<float,2>{0.12913695f, 0.466581732f},
-std::array<float,2>{0.559375346f, 0.052659478f},
-std::array<float,2>{0.252163619f, 0.720888972f},
-std::array<float,2>{0.629911542f, 0.587731659f},
-std::array<float,2>{0.476219982f, 0.209339112f},
-std::array<float,2>{0.886387408f, 0.275537878f},
-std::array<float,2>{0.0167796705f, 0.979320705f},
-std::array<float,2>{0.945345044f, 0.63243711f},
-std::array<float,2>{0.065295957f, 0.0734969452f},
-std::array<float,2>{0.696284473f, 0.431324095f},
-std::array<float,2>{0.415249765f, 0.846524179f},
-std::array<float,2>{0.587712646f, 0.903215468f},
-std::array<float,2>{0.366443545f, 0.359708697f},
-std::array<float,2>{0.792621255f, 0.147356853f},
-std::array<float,2>{0.221053481f, 0.542835236f},
-std::array<float,2>{0.985672057f, 0.873676896f},
-std::array<float,2>{0.100480139f, 0.418069631f},
-std::array<float,2>{0.725879431f, 0.0924412534f},
-std::array<float,2>{0.391825497f, 0.648542762f},
-std::array<float,2>{0.596464813f, 0.560303986f},
-std::array<float,2>{0.3252877f, 0.133142188f},
-std::array<float,2>{0.76922071f, 0.349123418f},
-std::array<float,2>{0.204626352f, 0.875333905f},
-std::array<float,2>{0.827733397f, 0.739104867f},
-std::array<float,2>{0.183457837f, 0.0317533165f},
-std::array<float,2>{0.518664241f, 0.448314756f},
-std::array<float,2>{0.284381598f, 0.763205707f},
-std::array<float,2>{0.670150995f, 0.990905046f},
-std::array<float,2>{0.445929617f, 0.252002925f},
-std::array<float,2>{0.908552885f, 0.19298169f},
-std::array<float,2>{0.0380382203f, 0.577605665f},
-std::array<float,2>{0.800241172f, 0.906999648f},
-std::array<float,2>{0.235597298f, 0.32212618f},
-std::array<float,2>{0.577577889f, 0.160653248f},
-std::array<float,2>{0.34502992f, 0.518885136f},
-std::array<float,2>{0.706151545f, 0.669857025f},
-std::array<float,2>{0.432570547f, 0.0979942381f},
-std::array<float,2>{0.965559721f, 0.397982985f},
-std::array<float,2>{0.0862378478f, 0.831248701f},
-std::array<float,2>{0.892010391f, 0.608888149f},
-std::array<float,2>{0.00297191157f, 0.236329794f},
-std::array<float,2>{0.643389106f, 0.281278849f},
-std::array<float,2>{0.496246725f, 0.955317795f},
-std::array<float,2>{0.534980118f, 0.795057714f},
-std::array<float,2>{0.276326329f, 0.48134917f},
-std::array<float,2>{0.858209252f, 0.0296742544f},
-std::array<float,2>{0.153046414f, 0.693126976f},
-std::array<float,2>{0.990855753f, 0.947629333f},
-std::array<float,2>{0.0974280983f, 0.301794738f},
-std::array<float,2>{0.722268522f, 0.222349271f},
-std::array<float,2>{0.396530867f, 0.616201699f},
-std::array<float,2>{0.599377275f, 0.716123581f},
-std::array<float,2>{0.321578085f, 0.0148735503f},
-std::array<float,2>{0.77132839f, 0.49497813f},
-std::array<float,2>{0.207959458f, 0.807472765f},
-std::array<float,2>{0.821225464f, 0.506638467f},
-std::array<float,2>{0.187166736f, 0.173150837f},
-std::array<float,2>{0.520657361f, 0.335354626f},
-std::array<float,2>{0.287714511f, 0.9292413f},
-std::array<float,2>{0.667210877f, 0.816079915f},
-std::array<float,2>{0.450069368f, 0.378098339f},
-std::array<float,2>{0.912089825f, 0.112208679f},
-std::array<float,2>{0.0321100354f, 0.682395101f},
-std::array<float,2>{0.804469943f, 0.771529913f},
-std::array<float,2>{0.241786227f, 0.45954442f},
-std::array<float,2>{0.570358753f, 0.0592467114f},
-std::array<float,2>{0.350515157f, 0.73396343f},
-std::array<float,2>{0.707143605f, 0.582205892f},
-std::array<float,2>{0.434806824f, 0.214091331f},
-std::array<float,2>{0.961529613f, 0.268585473f},
-std::array<float,2>{0.0912287459f, 0.972013652f},
-std::array<float,2>{0.898055851f, 0.637108088f},
-std::array<float,2>{0.00715239951f, 0.0697083026f},
-std::array<float,2>{0.64730984f, 0.423359543f},
-std::array<float,2>{0.493098736f, 0.855329454f},
-std::array<float,2>{0.536414146f, 0.894384086f},
-std::array<float,2>{0.279188514f, 0.371194839f},
-std::array<float,2>{0.855438948f, 0.155022994f},
-std::array<float,2>{0.14879401f, 0.53838855f},
-std::array<float,2>{0.926934659f, 0.859645307f},
-std::array<float,2>{0.060069371f, 0.413120568f},
-std::array<float,2>{0.675108373f, 0.0841060206f},
-std::array<float,2>{0.455557436f, 0.642007291f},
-std::array<float,2>{0.504245341f, 0.553498447f},
-std::array<float,2>{0.302723199f, 0.131884813f},
-std::array<float,2>{0.829583585f, 0.356669426f},
-std::array<float,2>{0.160143897f, 0.888973713f},
-std::array<float,2>{0.752645195f, 0.749643922f},
-std::array<float,2>{0.199915305f, 0.043395862f},
-std::array<float,2>{0.621304452f, 0.439319372f},
-std::array<float,2>{0.328530669f, 0.750911355f},
-std::array<float,2>{0.74321264f, 0.999109209f},
-std::array<float,2>{0.381279916f, 0.263809413f},
-std::array<float,2>{0.976470292f, 0.196538106f},
-std::array<float,2>{0.123502105f, 0.563251615f},
-std::array<float,2>{0.872969925f, 0.918008029f},
-std::array<float,2>{0.128622815f, 0.317643791f},
-std::array<float,2>{0.557558f, 0.170622498f},
-std::array<float,2>{0.25516665f, 0.530136585f},
-std::array<float,2>{0.628266156f, 0.661125004f},
-std::array<float,2>{0.471782953f, 0.102746896f},
-std::array<float,2>{0.889180779f, 0.400757939f},
-std::array<float,2>{0.0209811032f, 0.836099267f},
-std::array<float,2>{0.950657785f, 0.597646952f},
-std::array<float,2>{0.0669130906f, 0.246597201f},
-std::array<float,2>{0.700476587f, 0.296659768f},
-std::array<float,2>{0.419288546f, 0.965638936f},
-std::array<float,2>{0.590944827f, 0.784061313f},
-std::array<float,2>{0.363069326f, 0.470894843f},
-std::array<float,2>{0.793234646f, 0.0171879251f},
-std::array<float,2>{0.225151062f, 0.698788762f},
-std::array<float,2>{0.881928563f, 0.882735252f},
-std::array<float,2>{0.0271209516f, 0.343937248f},
-std::array<float,2>{0.633903086f, 0.140219316f},
-std::array<float,2>{0.477654576f, 0.555190563f},
-std::array<float,2>{0.554459393f, 0.65262711f},
-std::array<float,2>{0.258012712f, 0.0870230794f},
-std::array<float,2>{0.860883892f, 0.41773212f},
-std::array<float,2>{0.133170724f, 0.8683303f},
-std::array<float,2>{0.785354257f, 0.573134482f},
-std::array<float,2>{0.232476279f, 0.187796265f},
-std::array<float,2>{0.580026746f, 0.253949702f},
-std::array<float,2>{0.374413908f, 0.985214472f},
-std::array<float,2>{0.691611528f, 0.760194182f},
-std::array<float,2>{0.409911215f, 0.449295789f},
-std::array<float,2>{0.940631986f, 0.0384064279f},
-std::array<float,2>{0.0725178719f, 0.736375034f},
-std::array<float,2>{0.839571357f, 0.834851503f},
-std::array<float,2>{0.170182332f, 0.391742855f},
-std::array<float,2>{0.508033812f, 0.0948229358f},
-std::array<float,2>{0.309884727f, 0.664789855f},
-std::array<float,2>{0.683243036f, 0.520561278f},
-std::array<float,2>{0.464541584f, 0.158331975f},
-std::array<float,2>{0.931159914f, 0.32433334f},
-std::array<float,2>{0.0482874364f, 0.911338329f},
-std::array<float,2>{0.984369993f, 0.689079225f},
-std::array<float,2>{0.116774641f, 0.0249970518f},
-std::array<float,2>{0.736162245f, 0.479757458f},
-std::array<float,2>{0.385461837f, 0.789992332f},
-std::array<float,2>{0.616700172f, 0.959834695f},
-std::array<float,2>{0.341301918f, 0.288538277f},
-std::array<float,2>{0.762843609f, 0.240179777f},
-std::array<float,2>{0.189421803f, 0.601701558f},
-std::array<float,2>{0.955787241f, 0.799092174f},
-std::array<float,2>{0.0834623501f, 0.487817019f},
-std::array<float,2>{0.713769555f, 0.00402275985f},
-std::array<float,2>{0.428855628f, 0.707117736f},
-std::array<float,2>{0.565793514f, 0.620132446f},
-std::array<float,2>{0.358680755f, 0.226706102f},
-std::array<float,2>{0.810315609f, 0.312076479f},
-std::array<float,2>{0.244974598f, 0.939771652f},
-std::array<float,2>{0.844149172f, 0.678388238f},
-std::array<float,2>{0.144815907f, 0.121260725f},
-std::array<float,2>{0.541992128f, 0.388749093f},
-std::array<float,2>{0.269582987f, 0.825629771f},
-std::array<float,2>{0.654671848f, 0.933459699f},
-std::array<float,2>{0.490941435f, 0.342064172f},
-std::array<float,2>{0.902580619f, 0.180782542f},
-std::array<float,2>{0.0116530471f, 0.508349657f},
-std::array<float,2>{0.780213118f, 0.981933475f},
-std::array<float,2>{0.212799996f, 0.280556262f},
-std::array<float,2>{0.607375205f, 0.203368619f},
-std::array<float,2>{0.317702025f, 0.590463638f},
-std::array<float,2>{0.727713227f, 0.725096107f},
-std::array<float,2>{0.404054195f, 0.0502292179f},
-std::array<float,2>{0.999626994f, 0.462637693f},
-std::array<float,2>{0.10835588f, 0.780238628f},
-std::array<float,2>{0.920786381f, 0.545422018f},
-std::array<float,2>{0.0444258861f, 0.144338533f},
-std::array<float,2>{0.658103764f, 0.363442838f},
-std::array<float,2>{0.441925943f, 0.898546219f},
-std::array<float,2>{0.525025308f, 0.848181665f},
-std::array<float,2>{0.295052588f, 0.436683953f},
-std::array<float,2>{0.819091976f, 0.077789247f},
-std::array<float,2>{0.178127497f, 0.626355886f},
-std::array<float,2>{0.942511559f, 0.923827589f},
-std::array<float,2>{0.0770580694f, 0.330859989f},
-std::array<float,2>{0.687841356f, 0.176400006f},
-std::array<float,2>{0.413291842f, 0.501778662f},
-std::array<float,2>{0.583226204f, 0.686535656f},
-std::array<float,2>{0.369886994f, 0.11359708f},
-std::array<float,2>{0.782730401f, 0.37999931f},
-std::array<float,2>{0.22993134f, 0.817942142f},
-std::array<float,2>{0.863697231f, 0.611125648f},
-std::array<float,2>{0.13803336f, 0.223879278f},
-std::array<float,2>{0.547976792f, 0.300298095f},
-std::array<float,2>{0.262106985f, 0.949223518f},
-std::array<float,2>{0.639430821f, 0.810843408f},
-std::array<float,2>{0.482782662f, 0.497118711f},
-std::array<float,2>{0.876702666f, 0.00927763805f},
-std::array<float,2>{0.0275579784f, 0.713933051f},
-std::array<float,2>{0.758691192f, 0.857780695f},
-std::array<float,2>{0.194903553f, 0.428688914f},
-std::array<float,2>{0.61109966f, 0.0653796569f},
-std::array<float,2>{0.338105708f, 0.635543406f},
-std::array<float,2>{0.740565658f, 0.533240557f},
-std::array<float,2>{0.388031006f, 0.150992572f},
-std::array<float,2>{0.979954064f, 0.370330513f},
-std::array<float,2>{0.112246074f, 0.895871162f},
-std::array<float,2>{0.935764313f, 0.728557944f},
-std::array<float,2>{0.0510740615f, 0.0564135425f},
-std::array<float,2>{0.685728371f, 0.455461621f},
-std::array<float,2>{0.465422273f, 0.768028677f},
-std::array<float,2>{0.512995601f, 0.972781241f},
-std::array<float,2>{0.306020409f, 0.271046281f},
-std::array<float,2>{0.841852248f, 0.216121957f},
-std::array<float,2>{0.16666846f, 0.578728318f},
-std::array<float,2>{0.901525021f, 0.7565099f},
-std::array<float,2>{0.0148287658f, 0.444461226f},
-std::array<float,2>{0.650108576f, 0.0400650501f},
-std::array<float,2>{0.484640896f, 0.74302572f},
-std::array<float,2>{0.545956373f, 0.568772733f},
-std::array<float,2>{0.268197924f, 0.199624911f},
-std::array<float,2>{0.847896099f, 0.261008918f},
-std::array<float,2>{0.141153902f, 0.994777262f},
-std::array<float,2>{0.807126343f, 0.648237586f},
-std::array<float,2>{0.247978255f, 0.0784428939f},
-std::array<float,2>{0.568805993f, 0.406801641f},
-std::array<float,2>{0.354540706f, 0.866353929f},
-std::array<float,2>{0.71541971f, 0.885926962f},
-std::array<float,2>{0.42570588f, 0.354033679f},
-std::array<float,2>{0.958876312f, 0.127060428f},
-std::array<float,2>{0.0791038796f, 0.54909867f},
-std::array<float,2>{0.812518299f, 0.964685798f},
-std::array<float,2>{0.173351541f, 0.290041506f},
-std::array<float,2>{0.529636383f, 0.243386343f},
-std::array<float,2>{0.289978057f, 0.599289179f},
-std::array<float,2>{0.662004948f, 0.701775372f},
-std::array<float,2>{0.439629078f, 0.0200975928f},
-std::array<float,2>{0.916542768f, 0.474526942f},
-std::array<float,2>{0.040397916f, 0.78632468f},
-std::array<float,2>{0.995052457f, 0.524238646f},
-std::array<float,2>{0.102752499f, 0.166926116f},
-std::array<float,2>{0.732262731f, 0.314913571f},
-std::array<float,2>{0.401983768f, 0.91533041f},
-std::array<float,2>{0.605232418f, 0.840902567f},
-std::array<float,2>{0.31477356f, 0.404797554f},
-std::array<float,2>{0.775421858f, 0.105585046f},
-std::array<float,2>{0.21653454f, 0.660053432f},
-std::array<float,2>{0.910107911f, 0.989372492f},
-std::array<float,2>{0.0384527184f, 0.250344813f},
-std::array<float,2>{0.671038032f, 0.193746597f},
-std::array<float,2>{0.446620554f, 0.574671745f},
-std::array<float,2>{0.518461585f, 0.740698814f},
-std::array<float,2>{0.283593357f, 0.0345375687f},
-std::array<float,2>{0.826914847f, 0.445432514f},
-std::array<float,2>{0.1821457f, 0.765203774f},
-std::array<float,2>{0.768105865f, 0.562253177f},
-std::array<float,2>{0.20332171f, 0.135130227f},
-std::array<float,2>{0.597584128f, 0.350112319f},
-std::array<float,2>{0.324722558f, 0.878225982f},
-std::array<float,2>{0.724979103f, 0.87117964f},
-std::array<float,2>{0.391275048f, 0.420881093f},
-std::array<float,2>{0.985144079f, 0.0904616192f},
-std::array<float,2>{0.100837775f, 0.650444448f},
-std::array<float,2>{0.85917443f, 0.793619454f},
-std::array<float,2>{0.153891087f, 0.483982831f},
-std::array<float,2>{0.533892989f, 0.0287840273f},
-std::array<float,2>{0.276613235f, 0.694761813f},
-std::array<float,2>{0.644015074f, 0.60704428f},
-std::array<float,2>{0.497980982f, 0.236009851f},
-std::array<float,2>{0.891430914f, 0.284387708f},
-std::array<float,2>{0.00251885713f, 0.953596234f},
-std::array<float,2>{0.966699839f, 0.670986652f},
-std::array<float,2>{0.087785989f, 0.100165479f},
-std::array<float,2>{0.705220222f, 0.394559234f},
-std::array<float,2>{0.432824731f, 0.829174757f},
-std::array<float,2>{0.576350451f, 0.909431219f},
-std::array<float,2>{0.34469983f, 0.323284477f},
-std::array<float,2>{0.799210072f, 0.163544104f},
-std::array<float,2>{0.234527916f, 0.516741276f},
-std::array<float,2>{0.969244242f, 0.820536375f},
-std::array<float,2>{0.120067209f, 0.38333866f},
-std::array<float,2>{0.748601258f, 0.120100528f},
-std::array<float,2>{0.376279533f, 0.675188839f},
-std::array<float,2>{0.618664682f, 0.513371944f},
-std::array<float,2>{0.335018724f, 0.185450271f},
-std::array<float,2>{0.753951669f, 0.339511275f},
-std::array<float,2>{0.196655124f, 0.935903728f},
-std::array<float,2>{0.832091868f, 0.70467037f},
-std::array<float,2>{0.162749514f, 0.00281890202f},
-std::array<float,2>{0.501206577f, 0.490285367f},
-std::array<float,2>{0.297957093f, 0.803224742f},
-std::array<float,2>{0.676011503f, 0.941785097f},
-std::array<float,2>{0.459976137f, 0.308335125f},
-std::array<float,2>{0.924462736f, 0.234292343f},
-std::array<float,2>{0.0563938655f, 0.621414304f},
-std::array<float,2>{0.791578948f, 0.904388309f},
-std::array<float,2>{0.222147286f, 0.363214254f},
-std::array<float,2>{0.586703002f, 0.145346165f},
-std::array<float,2>{0.365829438f, 0.539720476f},
-std::array<float,2>{0.696351588f, 0.628975451f},
-std::array<float,2>{0.414588332f, 0.071907118f},
-std::array<float,2>{0.947157264f, 0.43210876f},
-std::array<float,2>{0.0657526776f, 0.844047964f},
-std::array<float,2>{0.885724664f, 0.588539183f},
-std::array<float,2>{0.0156426448f, 0.20806773f},
-std::array<float,2>{0.629764199f, 0.275031149f},
-std::array<float,2>{0.475404501f, 0.976663411f},
-std::array<float,2>{0.560229242f, 0.77472651f},
-std::array<float,2>{0.253427356f, 0.466885656f},
-std::array<float,2>{0.869729877f, 0.0537260994f},
-std::array<float,2>{0.130375147f, 0.720511794f},
-std::array<float,2>{0.96319145f, 0.969701171f},
-std::array<float,2>{0.0924689248f, 0.266884953f},
-std::array<float,2>{0.710851729f, 0.211412311f},
-std::array<float,2>{0.435882598f, 0.584239602f},
-std::array<float,2>{0.57328856f, 0.731938779f},
-std::array<float,2>{0.348736823f, 0.0608524792f},
-std::array<float,2>{0.801127434f, 0.457160473f},
-std::array<float,2>{0.239737853f, 0.770421326f},
-std::array<float,2>{0.853437364f, 0.536328375f},
-std::array<float,2>{0.152277172f, 0.152700141f},
-std::array<float,2>{0.537811458f, 0.374753475f},
-std::array<float,2>{0.280972391f, 0.892282128f},
-std::array<float,2>{0.646454811f, 0.852330744f},
-std::array<float,2>{0.494391769f, 0.424833268f},
-std::array<float,2>{0.896075547f, 0.0680702329f},
-std::array<float,2>{0.0047347378f, 0.639630914f},
-std::array<float,2>{0.772617757f, 0.805621505f},
-std::array<float,2>{0.210383683f, 0.49274087f},
-std::array<float,2>{0.601253033f, 0.0131025566f},
-std::array<float,2>{0.322304219f, 0.717243135f},
-std::array<float,2>{0.720116377f, 0.613510609f},
-std::array<float,2>{0.396075726f, 0.219830319f},
-std::array<float,2>{0.989887238f, 0.303156704f},
-std::array<float,2>{0.0949238017f, 0.946888626f},
-std::array<float,2>{0.913203061f, 0.680957496f},
-std::array<float,2>{0.0338439494f, 0.110888153f},
-std::array<float,2>{0.665526211f, 0.376309365f},
-std::array<float,2>{0.45150134f, 0.812637925f},
-std::array<float,2>{0.521842539f, 0.925872505f},
-std::array<float,2>{0.286045998f, 0.332486093f},
-std::array<float,2>{0.823113501f, 0.173930541f},
-std::array<float,2>{0.18465203f, 0.505738676f},
-std::array<float,2>{0.888243973f, 0.83890301f},
-std::array<float,2>{0.0218635071f, 0.400345653f},
-std::array<float,2>{0.62543112f, 0.104113519f},
-std::array<float,2>{0.470105082f, 0.662758827f},
-std::array<float,2>{0.555275619f, 0.52842319f},
-std::array<float,2>{0.256488025f, 0.168553814f},
-std::array<float,2>{0.874652207f, 0.320120126f},
-std::array<float,2>{0.125234932f, 0.921475649f},
-std::array<float,2>{0.795268834f, 0.696998894f},
-std::array<float,2>{0.223028898f, 0.0191439427f},
-std::array<float,2>{0.592289507f, 0.4698838f},
-std::array<float,2>{0.360038549f, 0.782520354f},
-std::array<float,2>{0.702454329f, 0.968365908f},
-std::array<float,2>{0.421491802f, 0.293208987f},
-std::array<float,2>{0.952591658f, 0.249289677f},
-std::array<float,2>{0.0703068003f, 0.593924999f},
-std::array<float,2>{0.831436038f, 0.888194919f},
-std::array<float,2>{0.158097565f, 0.358343065f},
-std::array<float,2>{0.507433712f, 0.130379975f},
-std::array<float,2>{0.303490996f, 0.55258441f},
-std::array<float,2>{0.672951043f, 0.642860591f},
-std::array<float,2>{0.453492969f, 0.0825797915f},
-std::array<float,2>{0.928769171f, 0.411816686f},
-std::array<float,2>{0.061445713f, 0.86281532f},
-std::array<float,2>{0.973416865f, 0.565450191f},
-std::array<float,2>{0.121935427f, 0.197419167f},
-std::array<float,2>{0.744402766f, 0.262840807f},
-std::array<float,2>{0.3792229f, 0.997689724f},
-std::array<float,2>{0.624330938f, 0.752406538f},
-std::array<float,2>{0.331625015f, 0.439804018f},
-std::array<float,2>{0.750864327f, 0.0450211503f},
-std::array<float,2>{0.202775985f, 0.747404695f},
-std::array<float,2>{0.933565497f, 0.912186623f},
-std::array<float,2>{0.0490264222f, 0.326659054f},
-std::array<float,2>{0.680962324f, 0.15740554f},
-std::array<float,2>{0.461779922f, 0.522440851f},
-std::array<float,2>{0.51008302f, 0.667403519f},
-std::array<float,2>{0.312115908f, 0.0970317498f},
-std::array<float,2>{0.837546051f, 0.392612398f},
-std::array<float,2>{0.16869238f, 0.832376361f},
-std::array<float,2>{0.764924526f, 0.603721261f},
-std::array<float,2>{0.190036044f, 0.240417838f},
-std::array<float,2>{0.615041316f, 0.286357582f},
-std::array<float,2>{0.34338057f, 0.95779264f},
-std::array<float,2>{0.737614334f, 0.792152286f},
-std::array<float,2>{0.383208185f, 0.476960838f},
-std::array<float,2>{0.981857538f, 0.0269367453f},
-std::array<float,2>{0.114374772f, 0.690200388f},
-std::array<float,2>{0.862156451f, 0.869464934f},
-std::array<float,2>{0.135910481f, 0.414649546f},
-std::array<float,2>{0.55104053f, 0.089167811f},
-std::array<float,2>{0.26142922f, 0.655704081f},
-std::array<float,2>{0.635056078f, 0.558331668f},
-std::array<float,2>{0.478883386f, 0.138578475f},
-std::array<float,2>{0.879576087f, 0.346414536f},
-std::array<float,2>{0.0245598648f, 0.879992425f},
-std::array<float,2>{0.937911212f, 0.734649718f},
-std::array<float,2>{0.0706547946f, 0.0367629863f},
-std::array<float,2>{0.693873703f, 0.451655358f},
-std::array<float,2>{0.407706976f, 0.758908689f},
-std::array<float,2>{0.581114173f, 0.98817265f},
-std::array<float,2>{0.371175408f, 0.25601241f},
-std::array<float,2>{0.787732124f, 0.19103615f},
-std::array<float,2>{0.231054902f, 0.571349621f},
-std::array<float,2>{0.997748554f, 0.778735578f},
-std::array<float,2>{0.107020862f, 0.463327527f},
-std::array<float,2>{0.729535639f, 0.0474275947f},
-std::array<float,2>{0.405178845f, 0.724155486f},
-std::array<float,2>{0.607869148f, 0.593175709f},
-std::array<float,2>{0.318629026f, 0.205395892f},
-std::array<float,2>{0.778179944f, 0.277959973f},
-std::array<float,2>{0.214312792f, 0.984262705f},
-std::array<float,2>{0.817949831f, 0.628514707f},
-std::array<float,2>{0.176770151f, 0.0752992034f},
-std::array<float,2>{0.526016176f, 0.43377617f},
-std::array<float,2>{0.293156594f, 0.850164115f},
-std::array<float,2>{0.659028828f, 0.902000487f},
-std::array<float,2>{0.445303321f, 0.365371168f},
-std::array<float,2>{0.918143034f, 0.14115949f},
-std::array<float,2>{0.0462337807f, 0.544634283f},
-std::array<float,2>{0.812053144f, 0.938631535f},
-std::array<float,2>{0.243406937f, 0.309696347f},
-std::array<float,2>{0.562987566f, 0.22960335f},
-std::array<float,2>{0.357265472f, 0.618091524f},
-std::array<float,2>{0.712695003f, 0.710334897f},
-std::array<float,2>{0.427179039f, 0.0065762992f},
-std::array<float,2>{0.953666389f, 0.484697968f},
-std::array<float,2>{0.0842741579f, 0.797835588f},
-std::array<float,2>{0.904731095f, 0.510315001f},
-std::array<float,2>{0.00930745993f, 0.18227917f},
-std::array<float,2>{0.653289676f, 0.340521246f},
-std::array<float,2>{0.488918811f, 0.931238592f},
-std::array<float,2>{0.540063083f, 0.827765644f},
-std::array<float,2>{0.272492737f, 0.388090402f},
-std::array<float,2>{0.845997512f, 0.123674951f},
-std::array<float,2>{0.147280484f, 0.675805986f},
-std::array<float,2>{0.978512764f, 0.896761656f},
-std::array<float,2>{0.110731319f, 0.368850976f},
-std::array<float,2>{0.738312304f, 0.15011768f},
-std::array<float,2>{0.390042722f, 0.531360865f},
-std::array<float,2>{0.613004744f, 0.634214997f},
-std::array<float,2>{0.336258888f, 0.062925458f},
-std::array<float,2>{0.760056376f, 0.426067054f},
-std::array<float,2>{0.191440448f, 0.855712354f},
-std::array<float,2>{0.841051221f, 0.580592096f},
-std::array<float,2>{0.164946571f, 0.217730075f},
-std::array<float,2>{0.514568806f, 0.272528321f},
-std::array<float,2>{0.306734711f, 0.975245118f},
-std::array<float,2>{0.683965743f, 0.767095864f},
-std::array<float,2>{0.467653453f, 0.454376757f},
-std::array<float,2>{0.93491137f, 0.0571895465f},
-std::array<float,2>{0.0543879755f, 0.727490604f},
-std::array<float,2>{0.784616411f, 0.820269167f},
-std::array<float,2>{0.228184432f, 0.381014019f},
-std::array<float,2>{0.585698664f, 0.116011158f},
-std::array<float,2>{0.368646652f, 0.684957981f},
-std::array<float,2>{0.690287054f, 0.502835035f},
-std::array<float,2>{0.411938131f, 0.179480553f},
-std::array<float,2>{0.943771601f, 0.328243077f},
-std::array<float,2>{0.0751873925f, 0.925174892f},
-std::array<float,2>{0.878338993f, 0.710950792f},
-std::array<float,2>{0.0307685547f, 0.0109691527f},
-std::array<float,2>{0.637875557f, 0.498797178f},
-std::array<float,2>{0.481165648f, 0.809155703f},
-std::array<float,2>{0.549059153f, 0.952076077f},
-std::array<float,2>{0.264736533f, 0.297481269f},
-std::array<float,2>{0.867166758f, 0.224798396f},
-std::array<float,2>{0.13978456f, 0.611379802f},
-std::array<float,2>{0.915565729f, 0.787147403f},
-std::array<float,2>{0.0429311804f, 0.476325661f},
-std::array<float,2>{0.663756371f, 0.0223488286f},
-std::array<float,2>{0.438916892f, 0.699271441f},
-std::array<float,2>{0.528312683f, 0.599869251f},
-std::array<float,2>{0.291166931f, 0.244176313f},
-std::array<float,2>{0.814901173f, 0.291487455f},
-std::array<float,2>{0.1738372f, 0.96135205f},
-std::array<float,2>{0.774501562f, 0.657694757f},
-std::array<float,2>{0.218315542f, 0.107914448f},
-std::array<float,2>{0.60254401f, 0.403671354f},
-std::array<float,2>{0.314225435f, 0.843282342f},
-std::array<float,2>{0.732918203f, 0.91631943f},
-std::array<float,2>{0.399663836f, 0.313457757f},
-std::array<float,2>{0.993216574f, 0.164886624f},
-std::array<float,2>{0.103979945f, 0.526967466f},
-std::array<float,2>{0.850356221f, 0.993381441f},
-std::array<float,2>{0.143006146f, 0.258547872f},
-std::array<float,2>{0.544338882f, 0.201970741f},
-std::array<float,2>{0.2666879f, 0.567021489f},
-std::array<float,2>{0.650393665f, 0.745997787f},
-std::array<float,2>{0.487859547f, 0.041486714f},
-std::array<float,2>{0.899457574f, 0.441999555f},
-std::array<float,2>{0.013060702f, 0.754788458f},
-std::array<float,2>{0.960130751f, 0.548125207f},
-std::array<float,2>{0.0805950984f, 0.125076845f},
-std::array<float,2>{0.716892362f, 0.35187307f},
-std::array<float,2>{0.423546553f, 0.884604394f},
-std::array<float,2>{0.566720068f, 0.864377081f},
-std::array<float,2>{0.351932049f, 0.408228576f},
-std::array<float,2>{0.804890871f, 0.0804527104f},
-std::array<float,2>{0.248934761f, 0.645571053f},
-std::array<float,2>{0.894329607f, 0.95649004f},
-std::array<float,2>{0.0009483748f, 0.282529593f},
-std::array<float,2>{0.641314507f, 0.238244906f},
-std::array<float,2>{0.498308212f, 0.60751003f},
-std::array<float,2>{0.531631589f, 0.691687644f},
-std::array<float,2>{0.27521202f, 0.0303690601f},
-std::array<float,2>{0.855599284f, 0.482004851f},
-std::array<float,2>{0.154545829f, 0.796752334f},
-std::array<float,2>{0.797502875f, 0.517939091f},
-std::array<float,2>{0.236443639f, 0.161969155f},
-std::array<float,2>{0.575247109f, 0.320796043f},
-std::array<float,2>{0.347181976f, 0.908042014f},
-std::array<float,2>{0.704890192f, 0.830533922f},
-std::array<float,2>{0.430821091f, 0.396833748f},
-std::array<float,2>{0.968517005f, 0.0987048224f},
-std::array<float,2>{0.0891699269f, 0.668835044f},
-std::array<float,2>{0.825727463f, 0.761919439f},
-std::array<float,2>{0.180182472f, 0.447302341f},
-std::array<float,2>{0.517158329f, 0.0331264883f},
-std::array<float,2>{0.281489402f, 0.740156949f},
-std::array<float,2>{0.669015348f, 0.576595426f},
-std::array<float,2>{0.448456168f, 0.191489592f},
-std::array<float,2>{0.906994522f, 0.253291994f},
-std::array<float,2>{0.0362433009f, 0.991600454f},
-std::array<float,2>{0.987390697f, 0.649822772f},
-std::array<float,2>{0.0988517478f, 0.0934932977f},
-std::array<float,2>{0.723819375f, 0.419236094f},
-std::array<float,2>{0.393888533f, 0.874180853f},
-std::array<float,2>{0.593978941f, 0.876046717f},
-std::array<float,2>{0.326217741f, 0.347776145f},
-std::array<float,2>{0.766861916f, 0.134445697f},
-std::array<float,2>{0.205444649f, 0.558668554f},
-std::array<float,2>{0.947991312f, 0.847287476f},
-std::array<float,2>{0.0639442354f, 0.430618018f},
-std::array<float,2>{0.698063672f, 0.0728833228f},
-std::array<float,2>{0.416249514f, 0.631362021f},
-std::array<float,2>{0.588512182f, 0.541606188f},
-std::array<float,2>{0.363582939f, 0.147607148f},
-std::array<float,2>{0.789129019f, 0.360417485f},
-std::array<float,2>{0.219479695f, 0.903927386f},
-std::array<float,2>{0.8677513f, 0.721830428f},
-std::array<float,2>{0.132067025f, 0.0510509908f},
-std::array<float,2>{0.562238932f, 0.465318739f},
-std::array<float,2>{0.250089705f, 0.776326895f},
-std::array<float,2>{0.632521391f, 0.979765594f},
-std::array<float,2>{0.47438705f, 0.276721448f},
-std::array<float,2>{0.88325876f, 0.210730582f},
-std::array<float,2>{0.0189780854f, 0.586360395f},
-std::array<float,2>{0.756315947f, 0.934506416f},
-std::array<float,2>{0.198986709f, 0.336986601f},
-std::array<float,2>{0.620032132f, 0.185824111f},
-std::array<float,2>{0.333857715f, 0.515105069f},
-std::array<float,2>{0.746872306f, 0.672930539f},
-std::array<float,2>{0.377088547f, 0.119136155f},
-std::array<float,2>{0.972482204f, 0.386377007f},
-std::array<float,2>{0.117412247f, 0.822364211f},
-std::array<float,2>{0.923470497f, 0.624989688f},
-std::array<float,2>{0.0582599081f, 0.231355742f},
-std::array<float,2>{0.679108858f, 0.304827452f},
-std::array<float,2>{0.457132965f, 0.943502367f},
-std::array<float,2>{0.502472401f, 0.802185476f},
-std::array<float,2>{0.300184339f, 0.490083247f},
-std::array<float,2>{0.834029794f, 0.000782240299f},
-std::array<float,2>{0.160817415f, 0.70618397f}}
\ No newline at end of file
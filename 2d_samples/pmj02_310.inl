@@ -1,4096 +0,0 @@
-{std::array<float,2>{0.111578308f, 0.705241978f},
-std::array<float,2>{0.541744351f, 0.0159202218f},
-std::array<float,2>{0.460383743f, 0.414859623f},
-std::array<float,2>{0.86317271f, 0.822426319f},
-std::array<float,2>{0.320271224f, 0.905597985f},
-std::array<float,2>{0.886920452f, 0.365023583f},
-std::array<float,2>{0.171593398f, 0.127963558f},
-std::array<float,2>{0.694005311f, 0.55646342f},
-std::array<float,2>{0.194052979f, 0.761818409f},
-std::array<float,2>{0.628615916f, 0.450224578f},
-std::array<float,2>{0.27312988f, 0.0879019573f},
-std::array<float,2>{0.981281281f, 0.678950667f},
-std::array<float,2>{0.414868265f, 0.619044125f},
-std::array<float,2>{0.81047684f, 0.234528005f},
-std::array<float,2>{0.0367777683f, 0.30311811f},
-std::array<float,2>{0.602080703f, 0.9482674f},
-std::array<float,2>{0.13949655f, 0.505262613f},
-std::array<float,2>{0.721734405f, 0.174897477f},
-std::array<float,2>{0.372427762f, 0.32023707f},
-std::array<float,2>{0.933116257f, 0.926038921f},
-std::array<float,2>{0.487377971f, 0.873434901f},
-std::array<float,2>{0.838300645f, 0.394392103f},
-std::array<float,2>{0.0647993088f, 0.0497148335f},
-std::array<float,2>{0.517132044f, 0.7211079f},
-std::array<float,2>{0.00855395012f, 0.998476088f},
-std::array<float,2>{0.572217405f, 0.265377134f},
-std::array<float,2>{0.377896637f, 0.214446291f},
-std::array<float,2>{0.772523165f, 0.591056764f},
-std::array<float,2>{0.293108761f, 0.645431757f},
-std::array<float,2>{0.945888937f, 0.100846246f},
-std::array<float,2>{0.228143543f, 0.474161237f},
-std::array<float,2>{0.666546464f, 0.786058068f},
-std::array<float,2>{0.0592774339f, 0.568078935f},
-std::array<float,2>{0.623549223f, 0.201394141f},
-std::array<float,2>{0.436626136f, 0.274951965f},
-std::array<float,2>{0.784356058f, 0.981169522f},
-std::array<float,2>{0.255512923f, 0.80545485f},
-std::array<float,2>{0.984869778f, 0.485107929f},
-std::array<float,2>{0.215579137f, 0.109798759f},
-std::array<float,2>{0.641608f, 0.635018766f},
-std::array<float,2>{0.180889279f, 0.917601645f},
-std::array<float,2>{0.710155427f, 0.337170333f},
-std::array<float,2>{0.336786866f, 0.159823254f},
-std::array<float,2>{0.892122149f, 0.521731555f},
-std::array<float,2>{0.451921403f, 0.743058324f},
-std::array<float,2>{0.859366f, 0.0320354067f},
-std::array<float,2>{0.0996682346f, 0.377355278f},
-std::array<float,2>{0.558338523f, 0.854763567f},
-std::array<float,2>{0.248876929f, 0.657164216f},
-std::array<float,2>{0.685959876f, 0.0657269657f},
-std::array<float,2>{0.309853643f, 0.462194592f},
-std::array<float,2>{0.959513247f, 0.775797606f},
-std::array<float,2>{0.39437145f, 0.958175302f},
-std::array<float,2>{0.762563884f, 0.294214785f},
-std::array<float,2>{0.0169002917f, 0.230049014f},
-std::array<float,2>{0.588080704f, 0.60639447f},
-std::array<float,2>{0.0802936554f, 0.842552602f},
-std::array<float,2>{0.506519854f, 0.427055538f},
-std::array<float,2>{0.472348869f, 0.0140234474f},
-std::array<float,2>{0.823523939f, 0.694781601f},
-std::array<float,2>{0.350357711f, 0.540896535f},
-std::array<float,2>{0.911515594f, 0.148913458f},
-std::array<float,2>{0.148025677f, 0.344648093f},
-std::array<float,2>{0.748600781f, 0.884340525f},
-std::array<float,2>{0.0268106516f, 0.625787616f},
-std::array<float,2>{0.579366803f, 0.121589333f},
-std::array<float,2>{0.403643847f, 0.495678902f},
-std::array<float,2>{0.750949919f, 0.802614748f},
-std::array<float,2>{0.302906334f, 0.969061017f},
-std::array<float,2>{0.96227181f, 0.270021707f},
-std::array<float,2>{0.237355456f, 0.187687308f},
-std::array<float,2>{0.678211391f, 0.570454597f},
-std::array<float,2>{0.152168363f, 0.846046209f},
-std::array<float,2>{0.741079509f, 0.387720466f},
-std::array<float,2>{0.355817884f, 0.0403659977f},
-std::array<float,2>{0.92164427f, 0.739473999f},
-std::array<float,2>{0.478925347f, 0.527168453f},
-std::array<float,2>{0.816802919f, 0.166095331f},
-std::array<float,2>{0.0881057754f, 0.335570961f},
-std::array<float,2>{0.514625609f, 0.91225338f},
-std::array<float,2>{0.210467041f, 0.600738168f},
-std::array<float,2>{0.655695617f, 0.219505325f},
-std::array<float,2>{0.260580212f, 0.285923392f},
-std::array<float,2>{0.995803595f, 0.96289587f},
-std::array<float,2>{0.428334773f, 0.770442724f},
-std::array<float,2>{0.795557916f, 0.454088122f},
-std::array<float,2>{0.0495181456f, 0.0731833056f},
-std::array<float,2>{0.610969901f, 0.671224833f},
-std::array<float,2>{0.108793981f, 0.882138133f},
-std::array<float,2>{0.55180943f, 0.353126645f},
-std::array<float,2>{0.440735042f, 0.140687659f},
-std::array<float,2>{0.847163081f, 0.536663949f},
-std::array<float,2>{0.329039335f, 0.699636221f},
-std::array<float,2>{0.899912834f, 0.0010135218f},
-std::array<float,2>{0.174213514f, 0.437454969f},
-std::array<float,2>{0.715672672f, 0.834699988f},
-std::array<float,2>{0.0739598572f, 0.548989415f},
-std::array<float,2>{0.529638052f, 0.137265712f},
-std::array<float,2>{0.495904893f, 0.367678404f},
-std::array<float,2>{0.831075966f, 0.894518614f},
-std::array<float,2>{0.359386533f, 0.815100014f},
-std::array<float,2>{0.925478876f, 0.407760859f},
-std::array<float,2>{0.12590836f, 0.0290822145f},
-std::array<float,2>{0.731530547f, 0.7168172f},
-std::array<float,2>{0.225030184f, 0.941817284f},
-std::array<float,2>{0.65816623f, 0.305286735f},
-std::array<float,2>{0.288712919f, 0.249777928f},
-std::array<float,2>{0.942181051f, 0.611017048f},
-std::array<float,2>{0.383433014f, 0.684440494f},
-std::array<float,2>{0.775554538f, 0.0788239539f},
-std::array<float,2>{0.00385129917f, 0.443482041f},
-std::array<float,2>{0.567835271f, 0.753677487f},
-std::array<float,2>{0.162152082f, 0.733024061f},
-std::array<float,2>{0.69767642f, 0.0589510612f},
-std::array<float,2>{0.324454457f, 0.404136211f},
-std::array<float,2>{0.87590301f, 0.861363769f},
-std::array<float,2>{0.466814667f, 0.93219763f},
-std::array<float,2>{0.868030727f, 0.324751079f},
-std::array<float,2>{0.119436584f, 0.181480184f},
-std::array<float,2>{0.532942653f, 0.515220761f},
-std::array<float,2>{0.0415786318f, 0.793314874f},
-std::array<float,2>{0.601035655f, 0.477181464f},
-std::array<float,2>{0.409604013f, 0.103192784f},
-std::array<float,2>{0.803295314f, 0.651928902f},
-std::array<float,2>{0.277876437f, 0.585818231f},
-std::array<float,2>{0.973706126f, 0.203561977f},
-std::array<float,2>{0.202460721f, 0.254413754f},
-std::array<float,2>{0.636393487f, 0.985689223f},
-std::array<float,2>{0.0905300081f, 0.672697008f},
-std::array<float,2>{0.508038223f, 0.0918917805f},
-std::array<float,2>{0.482376844f, 0.44841966f},
-std::array<float,2>{0.815124035f, 0.761295199f},
-std::array<float,2>{0.351852775f, 0.950174868f},
-std::array<float,2>{0.915795982f, 0.299375623f},
-std::array<float,2>{0.153369278f, 0.241174042f},
-std::array<float,2>{0.737382114f, 0.622826338f},
-std::array<float,2>{0.239919424f, 0.824835122f},
-std::array<float,2>{0.675777018f, 0.421726763f},
-std::array<float,2>{0.297462702f, 0.0216875393f},
-std::array<float,2>{0.966371477f, 0.710668981f},
-std::array<float,2>{0.399952233f, 0.559658945f},
-std::array<float,2>{0.755395651f, 0.12984851f},
-std::array<float,2>{0.0298706032f, 0.363253862f},
-std::array<float,2>{0.58235985f, 0.901823521f},
-std::array<float,2>{0.179131716f, 0.586681366f},
-std::array<float,2>{0.711972773f, 0.218362421f},
-std::array<float,2>{0.332143843f, 0.259631127f},
-std::array<float,2>{0.905019104f, 0.992545187f},
-std::array<float,2>{0.442869008f, 0.781734467f},
-std::array<float,2>{0.850819051f, 0.468869597f},
-std::array<float,2>{0.104327962f, 0.0962767005f},
-std::array<float,2>{0.548254251f, 0.643648326f},
-std::array<float,2>{0.0526987053f, 0.922488153f},
-std::array<float,2>{0.616128147f, 0.316369802f},
-std::array<float,2>{0.424735099f, 0.177519321f},
-std::array<float,2>{0.792417943f, 0.503720999f},
-std::array<float,2>{0.262193829f, 0.723371923f},
-std::array<float,2>{0.996580184f, 0.0536662415f},
-std::array<float,2>{0.20433788f, 0.394801915f},
-std::array<float,2>{0.648678958f, 0.867841601f},
-std::array<float,2>{0.00552722858f, 0.515759051f},
-std::array<float,2>{0.564513206f, 0.160776228f},
-std::array<float,2>{0.390591264f, 0.343451619f},
-std::array<float,2>{0.780367315f, 0.92118001f},
-std::array<float,2>{0.282143831f, 0.858287334f},
-std::array<float,2>{0.938417315f, 0.381005049f},
-std::array<float,2>{0.221127629f, 0.0362680592f},
-std::array<float,2>{0.66405344f, 0.747788489f},
-std::array<float,2>{0.129978731f, 0.980109155f},
-std::array<float,2>{0.728608489f, 0.278787881f},
-std::array<float,2>{0.364682108f, 0.197517991f},
-std::array<float,2>{0.927276492f, 0.564210773f},
-std::array<float,2>{0.498728544f, 0.638517201f},
-std::array<float,2>{0.832396507f, 0.113617048f},
-std::array<float,2>{0.0743728355f, 0.491156727f},
-std::array<float,2>{0.524553955f, 0.809918344f},
-std::array<float,2>{0.195590347f, 0.688734055f},
-std::array<float,2>{0.63974309f, 0.0104946224f},
-std::array<float,2>{0.275204808f, 0.422687203f},
-std::array<float,2>{0.968938887f, 0.838339508f},
-std::array<float,2>{0.41032353f, 0.887153506f},
-std::array<float,2>{0.797625542f, 0.347969741f},
-std::array<float,2>{0.0457319058f, 0.152889907f},
-std::array<float,2>{0.59654063f, 0.546149194f},
-std::array<float,2>{0.123817205f, 0.778069794f},
-std::array<float,2>{0.538911939f, 0.465611428f},
-std::array<float,2>{0.463802606f, 0.0688830167f},
-std::array<float,2>{0.871212363f, 0.662133396f},
-std::array<float,2>{0.323186278f, 0.605347097f},
-std::array<float,2>{0.880030632f, 0.23353374f},
-std::array<float,2>{0.158224791f, 0.289405733f},
-std::array<float,2>{0.701283932f, 0.955177128f},
-std::array<float,2>{0.0316415727f, 0.736783504f},
-std::array<float,2>{0.609068096f, 0.0462386571f},
-std::array<float,2>{0.418475717f, 0.382829159f},
-std::array<float,2>{0.807426631f, 0.849056184f},
-std::array<float,2>{0.266036212f, 0.906291187f},
-std::array<float,2>{0.979503393f, 0.329387844f},
-std::array<float,2>{0.189016953f, 0.170033112f},
-std::array<float,2>{0.632400692f, 0.530966401f},
-std::array<float,2>{0.164265081f, 0.79918474f},
-std::array<float,2>{0.688992381f, 0.497510165f},
-std::array<float,2>{0.312797338f, 0.118916899f},
-std::array<float,2>{0.885211051f, 0.63212508f},
-std::array<float,2>{0.45610851f, 0.576388776f},
-std::array<float,2>{0.863821447f, 0.195083499f},
-std::array<float,2>{0.113873526f, 0.265878558f},
-std::array<float,2>{0.546789646f, 0.974368393f},
-std::array<float,2>{0.231990993f, 0.534591913f},
-std::array<float,2>{0.668394923f, 0.14495863f},
-std::array<float,2>{0.289153546f, 0.35654375f},
-std::array<float,2>{0.952936769f, 0.876357496f},
-std::array<float,2>{0.381869137f, 0.831115305f},
-std::array<float,2>{0.767383218f, 0.431544989f},
-std::array<float,2>{0.0151580917f, 0.00447198423f},
-std::array<float,2>{0.575337172f, 0.69754374f},
-std::array<float,2>{0.0696020573f, 0.967201531f},
-std::array<float,2>{0.520457685f, 0.283578634f},
-std::array<float,2>{0.488593459f, 0.223880008f},
-std::array<float,2>{0.842822313f, 0.595457911f},
-std::array<float,2>{0.370563537f, 0.66427505f},
-std::array<float,2>{0.933632851f, 0.0759899616f},
-std::array<float,2>{0.133178204f, 0.459142983f},
-std::array<float,2>{0.723895848f, 0.765815973f},
-std::array<float,2>{0.096389398f, 0.614586949f},
-std::array<float,2>{0.559300184f, 0.242586583f},
-std::array<float,2>{0.447481662f, 0.30949685f},
-std::array<float,2>{0.854207039f, 0.937895775f},
-std::array<float,2>{0.340486109f, 0.756189167f},
-std::array<float,2>{0.897658408f, 0.439816058f},
-std::array<float,2>{0.187457487f, 0.0845592245f},
-std::array<float,2>{0.705411434f, 0.680249751f},
-std::array<float,2>{0.210947588f, 0.8976385f},
-std::array<float,2>{0.646160066f, 0.37420243f},
-std::array<float,2>{0.251647264f, 0.133403808f},
-std::array<float,2>{0.991257548f, 0.55165273f},
-std::array<float,2>{0.433327705f, 0.71351558f},
-std::array<float,2>{0.785997987f, 0.0269693546f},
-std::array<float,2>{0.0584765673f, 0.411724478f},
-std::array<float,2>{0.6195786f, 0.817512095f},
-std::array<float,2>{0.142949745f, 0.655089974f},
-std::array<float,2>{0.744117558f, 0.108498566f},
-std::array<float,2>{0.346559614f, 0.482234061f},
-std::array<float,2>{0.909108698f, 0.790861607f},
-std::array<float,2>{0.475209594f, 0.989111304f},
-std::array<float,2>{0.825612545f, 0.253589064f},
-std::array<float,2>{0.0846529603f, 0.207201615f},
-std::array<float,2>{0.500716448f, 0.578647971f},
-std::array<float,2>{0.0205238871f, 0.863679409f},
-std::array<float,2>{0.593608975f, 0.402306378f},
-std::array<float,2>{0.397832036f, 0.0556075461f},
-std::array<float,2>{0.761334956f, 0.727774322f},
-std::array<float,2>{0.307489634f, 0.510585189f},
-std::array<float,2>{0.953841507f, 0.18685545f},
-std::array<float,2>{0.242228419f, 0.322790146f},
-std::array<float,2>{0.680054784f, 0.936434746f},
-std::array<float,2>{0.0629565343f, 0.72023803f},
-std::array<float,2>{0.51820308f, 0.0471384004f},
-std::array<float,2>{0.485777408f, 0.392562062f},
-std::array<float,2>{0.836811125f, 0.872214913f},
-std::array<float,2>{0.373525262f, 0.928330243f},
-std::array<float,2>{0.931144536f, 0.318241149f},
-std::array<float,2>{0.138577968f, 0.172882482f},
-std::array<float,2>{0.719989002f, 0.507047534f},
-std::array<float,2>{0.228867054f, 0.787832379f},
-std::array<float,2>{0.664533854f, 0.474917829f},
-std::array<float,2>{0.296720952f, 0.0978232697f},
-std::array<float,2>{0.948937237f, 0.647026241f},
-std::array<float,2>{0.376708001f, 0.59220773f},
-std::array<float,2>{0.771265507f, 0.212424219f},
-std::array<float,2>{0.0110282581f, 0.261820942f},
-std::array<float,2>{0.572787583f, 0.997836053f},
-std::array<float,2>{0.169657797f, 0.557224333f},
-std::array<float,2>{0.692463636f, 0.126000345f},
-std::array<float,2>{0.317976326f, 0.367024213f},
-std::array<float,2>{0.889684677f, 0.903729141f},
-std::array<float,2>{0.45840463f, 0.82164073f},
-std::array<float,2>{0.860571265f, 0.417934239f},
-std::array<float,2>{0.110370204f, 0.0184376519f},
-std::array<float,2>{0.541009545f, 0.703395009f},
-std::array<float,2>{0.0372481346f, 0.946554124f},
-std::array<float,2>{0.605395377f, 0.301794797f},
-std::array<float,2>{0.416413277f, 0.238166586f},
-std::array<float,2>{0.811913788f, 0.620535791f},
-std::array<float,2>{0.270614386f, 0.676996827f},
-std::array<float,2>{0.982626855f, 0.0865842924f},
-std::array<float,2>{0.192469969f, 0.453040332f},
-std::array<float,2>{0.625770748f, 0.764550149f},
-std::array<float,2>{0.0193201844f, 0.607878625f},
-std::array<float,2>{0.586797118f, 0.227162242f},
-std::array<float,2>{0.391456544f, 0.296392947f},
-std::array<float,2>{0.764415801f, 0.959766269f},
-std::array<float,2>{0.310855508f, 0.774717987f},
-std::array<float,2>{0.95726335f, 0.463048577f},
-std::array<float,2>{0.247176811f, 0.0626251101f},
-std::array<float,2>{0.683814704f, 0.658923388f},
-std::array<float,2>{0.144757256f, 0.885685027f},
-std::array<float,2>{0.74732846f, 0.347191989f},
-std::array<float,2>{0.348878413f, 0.151458621f},
-std::array<float,2>{0.913580716f, 0.541202605f},
-std::array<float,2>{0.469359636f, 0.693358541f},
-std::array<float,2>{0.821142018f, 0.0134747755f},
-std::array<float,2>{0.0794411898f, 0.429238975f},
-std::array<float,2>{0.505025029f, 0.840750396f},
-std::array<float,2>{0.217120722f, 0.632949531f},
-std::array<float,2>{0.643658876f, 0.111523896f},
-std::array<float,2>{0.256651074f, 0.487328231f},
-std::array<float,2>{0.986556888f, 0.806794584f},
-std::array<float,2>{0.434399188f, 0.982683122f},
-std::array<float,2>{0.781826437f, 0.276410908f},
-std::array<float,2>{0.0605679564f, 0.199248716f},
-std::array<float,2>{0.621974766f, 0.570165634f},
-std::array<float,2>{0.0984781161f, 0.852841914f},
-std::array<float,2>{0.555561483f, 0.376548171f},
-std::array<float,2>{0.44964695f, 0.0337243937f},
-std::array<float,2>{0.856235266f, 0.74465692f},
-std::array<float,2>{0.33867979f, 0.520283461f},
-std::array<float,2>{0.893334806f, 0.156653151f},
-std::array<float,2>{0.181781918f, 0.339345247f},
-std::array<float,2>{0.708555639f, 0.915162265f},
-std::array<float,2>{0.0486621223f, 0.668337762f},
-std::array<float,2>{0.612137079f, 0.071448639f},
-std::array<float,2>{0.427148312f, 0.455558181f},
-std::array<float,2>{0.794892788f, 0.773299575f},
-std::array<float,2>{0.25829652f, 0.962525666f},
-std::array<float,2>{0.992202461f, 0.288901985f},
-std::array<float,2>{0.208361357f, 0.222282693f},
-std::array<float,2>{0.653739631f, 0.599360526f},
-std::array<float,2>{0.17282185f, 0.833951175f},
-std::array<float,2>{0.717385709f, 0.435522974f},
-std::array<float,2>{0.331624091f, 0.00221890188f},
-std::array<float,2>{0.900573552f, 0.701321065f},
-std::array<float,2>{0.438596606f, 0.538593531f},
-std::array<float,2>{0.845206261f, 0.143469393f},
-std::array<float,2>{0.106683336f, 0.355132639f},
-std::array<float,2>{0.552900255f, 0.879786789f},
-std::array<float,2>{0.234628871f, 0.572386205f},
-std::array<float,2>{0.677147269f, 0.191295505f},
-std::array<float,2>{0.30112043f, 0.272928476f},
-std::array<float,2>{0.963555694f, 0.971986294f},
-std::array<float,2>{0.40439406f, 0.804316998f},
-std::array<float,2>{0.753834963f, 0.493830472f},
-std::array<float,2>{0.0239363965f, 0.124891669f},
-std::array<float,2>{0.581984341f, 0.627087057f},
-std::array<float,2>{0.0862582177f, 0.91153115f},
-std::array<float,2>{0.513502538f, 0.332456291f},
-std::array<float,2>{0.477877438f, 0.165238261f},
-std::array<float,2>{0.818590879f, 0.525162756f},
-std::array<float,2>{0.359169453f, 0.741691887f},
-std::array<float,2>{0.919155955f, 0.041033648f},
-std::array<float,2>{0.150189206f, 0.389765561f},
-std::array<float,2>{0.739721537f, 0.844262421f},
-std::array<float,2>{0.117555037f, 0.512342989f},
-std::array<float,2>{0.534071386f, 0.182394549f},
-std::array<float,2>{0.466694415f, 0.327309489f},
-std::array<float,2>{0.870169818f, 0.93100512f},
-std::array<float,2>{0.327044666f, 0.861326575f},
-std::array<float,2>{0.878162205f, 0.40488857f},
-std::array<float,2>{0.161921144f, 0.0606303141f},
-std::array<float,2>{0.695507944f, 0.731496334f},
-std::array<float,2>{0.200958088f, 0.986847103f},
-std::array<float,2>{0.633719444f, 0.257573605f},
-std::array<float,2>{0.280991554f, 0.206177399f},
-std::array<float,2>{0.975461304f, 0.582915306f},
-std::array<float,2>{0.407527953f, 0.65007621f},
-std::array<float,2>{0.800873578f, 0.104361229f},
-std::array<float,2>{0.0398980342f, 0.47947824f},
-std::array<float,2>{0.599072576f, 0.795946062f},
-std::array<float,2>{0.127196535f, 0.716774642f},
-std::array<float,2>{0.733117044f, 0.0297650862f},
-std::array<float,2>{0.362212807f, 0.409521759f},
-std::array<float,2>{0.92287612f, 0.812721431f},
-std::array<float,2>{0.493607461f, 0.891657174f},
-std::array<float,2>{0.829828382f, 0.369320214f},
-std::array<float,2>{0.0722117499f, 0.139916345f},
-std::array<float,2>{0.528859377f, 0.547299564f},
-std::array<float,2>{0.00140453922f, 0.751047134f},
-std::array<float,2>{0.57030344f, 0.442232937f},
-std::array<float,2>{0.386231095f, 0.0802894905f},
-std::array<float,2>{0.775031686f, 0.686211586f},
-std::array<float,2>{0.285400271f, 0.611512899f},
-std::array<float,2>{0.94363004f, 0.24693954f},
-std::array<float,2>{0.224124923f, 0.307056367f},
-std::array<float,2>{0.658989847f, 0.944457531f},
-std::array<float,2>{0.101971112f, 0.642405689f},
-std::array<float,2>{0.550643921f, 0.0949440822f},
-std::array<float,2>{0.444191277f, 0.472005606f},
-std::array<float,2>{0.84847641f, 0.784825206f},
-std::array<float,2>{0.334260076f, 0.994919062f},
-std::array<float,2>{0.903138816f, 0.260520935f},
-std::array<float,2>{0.176511362f, 0.215993032f},
-std::array<float,2>{0.713157952f, 0.588140726f},
-std::array<float,2>{0.206785649f, 0.870440722f},
-std::array<float,2>{0.65217644f, 0.398337781f},
-std::array<float,2>{0.265023172f, 0.0513901561f},
-std::array<float,2>{0.999553621f, 0.725786567f},
-std::array<float,2>{0.423366547f, 0.50144732f},
-std::array<float,2>{0.789070606f, 0.178460956f},
-std::array<float,2>{0.053565871f, 0.312656194f},
-std::array<float,2>{0.61398989f, 0.92492485f},
-std::array<float,2>{0.15482752f, 0.624158084f},
-std::array<float,2>{0.73573792f, 0.239503428f},
-std::array<float,2>{0.354738742f, 0.298638135f},
-std::array<float,2>{0.917951524f, 0.952045381f},
-std::array<float,2>{0.482929528f, 0.759032905f},
-std::array<float,2>{0.813697994f, 0.446757972f},
-std::array<float,2>{0.0920221433f, 0.0914271772f},
-std::array<float,2>{0.510285258f, 0.67507416f},
-std::array<float,2>{0.0287353639f, 0.899395943f},
-std::array<float,2>{0.585695386f, 0.360749006f},
-std::array<float,2>{0.401403844f, 0.131754696f},
-std::array<float,2>{0.756516099f, 0.561100185f},
-std::array<float,2>{0.299914926f, 0.708624005f},
-std::array<float,2>{0.968670011f, 0.0213790499f},
-std::array<float,2>{0.241824999f, 0.418147445f},
-std::array<float,2>{0.673331797f, 0.826304555f},
-std::array<float,2>{0.0434525348f, 0.544216812f},
-std::array<float,2>{0.594627082f, 0.15471293f},
-std::array<float,2>{0.414036602f, 0.35143131f},
-std::array<float,2>{0.798971951f, 0.889992177f},
-std::array<float,2>{0.276444882f, 0.836512268f},
-std::array<float,2>{0.971147597f, 0.424549162f},
-std::array<float,2>{0.197691366f, 0.00838173833f},
-std::array<float,2>{0.637006581f, 0.691358268f},
-std::array<float,2>{0.156499237f, 0.954032302f},
-std::array<float,2>{0.699252605f, 0.291202903f},
-std::array<float,2>{0.322026789f, 0.231091723f},
-std::array<float,2>{0.882091701f, 0.602153718f},
-std::array<float,2>{0.461363852f, 0.661562085f},
-std::array<float,2>{0.873152673f, 0.0676382482f},
-std::array<float,2>{0.122913517f, 0.468282253f},
-std::array<float,2>{0.535598576f, 0.780724585f},
-std::array<float,2>{0.220286608f, 0.748803377f},
-std::array<float,2>{0.661465049f, 0.0371761695f},
-std::array<float,2>{0.283801138f, 0.380443126f},
-std::array<float,2>{0.940581083f, 0.856327355f},
-std::array<float,2>{0.388156652f, 0.91964072f},
-std::array<float,2>{0.778212845f, 0.341667145f},
-std::array<float,2>{0.00721597392f, 0.162898287f},
-std::array<float,2>{0.563298464f, 0.518115103f},
-std::array<float,2>{0.0772590563f, 0.812136889f},
-std::array<float,2>{0.525808573f, 0.488393426f},
-std::array<float,2>{0.497433186f, 0.115275815f},
-std::array<float,2>{0.834534049f, 0.639008522f},
-std::array<float,2>{0.365477562f, 0.566076994f},
-std::array<float,2>{0.929074824f, 0.19626303f},
-std::array<float,2>{0.131547406f, 0.280804336f},
-std::array<float,2>{0.727712333f, 0.978388369f},
-std::array<float,2>{0.0122772846f, 0.69624126f},
-std::array<float,2>{0.577262402f, 0.00668911915f},
-std::array<float,2>{0.37907213f, 0.431847662f},
-std::array<float,2>{0.768994391f, 0.829223931f},
-std::array<float,2>{0.291123927f, 0.877143383f},
-std::array<float,2>{0.949263334f, 0.357519567f},
-std::array<float,2>{0.232513487f, 0.14729178f},
-std::array<float,2>{0.671467841f, 0.532021046f},
-std::array<float,2>{0.136262253f, 0.767685115f},
-std::array<float,2>{0.726184964f, 0.458101064f},
-std::array<float,2>{0.368748486f, 0.0762979612f},
-std::array<float,2>{0.93617177f, 0.667810202f},
-std::array<float,2>{0.490676135f, 0.596215785f},
-std::array<float,2>{0.840447128f, 0.225083411f},
-std::array<float,2>{0.0668776631f, 0.281763554f},
-std::array<float,2>{0.522537887f, 0.96540302f},
-std::array<float,2>{0.190985888f, 0.527903914f},
-std::array<float,2>{0.63054496f, 0.168394864f},
-std::array<float,2>{0.269140452f, 0.331614226f},
-std::array<float,2>{0.978413463f, 0.909346759f},
-std::array<float,2>{0.421136826f, 0.851442456f},
-std::array<float,2>{0.805665195f, 0.386709511f},
-std::array<float,2>{0.0340035819f, 0.0447698496f},
-std::array<float,2>{0.605947971f, 0.734578431f},
-std::array<float,2>{0.116244636f, 0.975332141f},
-std::array<float,2>{0.544551313f, 0.269265592f},
-std::array<float,2>{0.45348236f, 0.193263263f},
-std::array<float,2>{0.867060423f, 0.576039255f},
-std::array<float,2>{0.316375822f, 0.629223466f},
-std::array<float,2>{0.884519041f, 0.119985707f},
-std::array<float,2>{0.167390928f, 0.498669833f},
-std::array<float,2>{0.689900398f, 0.797623992f},
-std::array<float,2>{0.0836885646f, 0.581475019f},
-std::array<float,2>{0.503818214f, 0.209865287f},
-std::array<float,2>{0.473395735f, 0.251634032f},
-std::array<float,2>{0.826805413f, 0.99198842f},
-std::array<float,2>{0.345146596f, 0.792891622f},
-std::array<float,2>{0.906832993f, 0.482659012f},
-std::array<float,2>{0.140643254f, 0.106812075f},
-std::array<float,2>{0.745298386f, 0.653022647f},
-std::array<float,2>{0.245123446f, 0.934834063f},
-std::array<float,2>{0.682148457f, 0.322212875f},
-std::array<float,2>{0.304805607f, 0.185279787f},
-std::array<float,2>{0.956121564f, 0.508567393f},
-std::array<float,2>{0.394908756f, 0.72932601f},
-std::array<float,2>{0.759390652f, 0.0584808923f},
-std::array<float,2>{0.0222691558f, 0.398583382f},
-std::array<float,2>{0.591345191f, 0.86673975f},
-std::array<float,2>{0.185173512f, 0.683300197f},
-std::array<float,2>{0.70398885f, 0.0833214447f},
-std::array<float,2>{0.343527645f, 0.43846485f},
-std::array<float,2>{0.895371795f, 0.754127443f},
-std::array<float,2>{0.447079509f, 0.939756572f},
-std::array<float,2>{0.852568209f, 0.310991585f},
-std::array<float,2>{0.0948700681f, 0.244965672f},
-std::array<float,2>{0.561485529f, 0.615594506f},
-std::array<float,2>{0.0564976893f, 0.818723798f},
-std::array<float,2>{0.618590355f, 0.413502276f},
-std::array<float,2>{0.431138933f, 0.0236852039f},
-std::array<float,2>{0.788291991f, 0.711556196f},
-std::array<float,2>{0.253313065f, 0.554198682f},
-std::array<float,2>{0.990017414f, 0.135805786f},
-std::array<float,2>{0.213480502f, 0.372700423f},
-std::array<float,2>{0.646688521f, 0.895574689f},
-std::array<float,2>{0.100822344f, 0.745784104f},
-std::array<float,2>{0.556778848f, 0.0343358852f},
-std::array<float,2>{0.452390432f, 0.375552654f},
-std::array<float,2>{0.858200252f, 0.852258444f},
-std::array<float,2>{0.337530851f, 0.914747059f},
-std::array<float,2>{0.890872896f, 0.337997645f},
-std::array<float,2>{0.180242151f, 0.157261834f},
-std::array<float,2>{0.709932387f, 0.520784616f},
-std::array<float,2>{0.21631889f, 0.807732522f},
-std::array<float,2>{0.641578794f, 0.486828595f},
-std::array<float,2>{0.254267246f, 0.112763472f},
-std::array<float,2>{0.986131251f, 0.634723544f},
-std::array<float,2>{0.43650803f, 0.568631053f},
-std::array<float,2>{0.783449829f, 0.201073438f},
-std::array<float,2>{0.0597919896f, 0.276281685f},
-std::array<float,2>{0.624624908f, 0.983993053f},
-std::array<float,2>{0.146643162f, 0.542803586f},
-std::array<float,2>{0.749184251f, 0.150477186f},
-std::array<float,2>{0.351128191f, 0.346475869f},
-std::array<float,2>{0.911055684f, 0.886457503f},
-std::array<float,2>{0.470870733f, 0.840906262f},
-std::array<float,2>{0.822328925f, 0.428304046f},
-std::array<float,2>{0.0820030794f, 0.0124404849f},
-std::array<float,2>{0.506987691f, 0.692001581f},
-std::array<float,2>{0.0163992774f, 0.960812807f},
-std::array<float,2>{0.588873446f, 0.295124412f},
-std::array<float,2>{0.392865032f, 0.228051901f},
-std::array<float,2>{0.763625324f, 0.609141767f},
-std::array<float,2>{0.309070021f, 0.6599406f},
-std::array<float,2>{0.960203528f, 0.063934207f},
-std::array<float,2>{0.24917917f, 0.464727283f},
-std::array<float,2>{0.687207103f, 0.773886263f},
-std::array<float,2>{0.0355561823f, 0.619894743f},
-std::array<float,2>{0.602740347f, 0.236609399f},
-std::array<float,2>{0.415591627f, 0.301127493f},
-std::array<float,2>{0.808820665f, 0.94558084f},
-std::array<float,2>{0.271796286f, 0.765181184f},
-std::array<float,2>{0.981843054f, 0.451698661f},
-std::array<float,2>{0.195007741f, 0.0878416896f},
-std::array<float,2>{0.62763834f, 0.676103473f},
-std::array<float,2>{0.169958189f, 0.902960718f},
-std::array<float,2>{0.695254087f, 0.365552992f},
-std::array<float,2>{0.31884709f, 0.125734553f},
-std::array<float,2>{0.887769759f, 0.55798614f},
-std::array<float,2>{0.459495097f, 0.704788089f},
-std::array<float,2>{0.861788332f, 0.0191113167f},
-std::array<float,2>{0.113001376f, 0.416848034f},
-std::array<float,2>{0.542482734f, 0.820490539f},
-std::array<float,2>{0.22748673f, 0.647931576f},
-std::array<float,2>{0.667415559f, 0.0988859162f},
-std::array<float,2>{0.294182718f, 0.476441771f},
-std::array<float,2>{0.946700394f, 0.788806558f},
-std::array<float,2>{0.378873825f, 0.996716976f},
-std::array<float,2>{0.772044778f, 0.262909502f},
-std::array<float,2>{0.0096830707f, 0.211020738f},
-std::array<float,2>{0.570601404f, 0.593096673f},
-std::array<float,2>{0.066342853f, 0.871298313f},
-std::array<float,2>{0.516267359f, 0.39092049f},
-std::array<float,2>{0.486362994f, 0.0478922911f},
-std::array<float,2>{0.839771807f, 0.719554126f},
-std::array<float,2>{0.371450156f, 0.506619155f},
-std::array<float,2>{0.93193984f, 0.17205593f},
-std::array<float,2>{0.139953673f, 0.317320943f},
-std::array<float,2>{0.721530259f, 0.929215789f},
-std::array<float,2>{0.00200996175f, 0.687036753f},
-std::array<float,2>{0.56673032f, 0.0813245252f},
-std::array<float,2>{0.384609818f, 0.443294436f},
-std::array<float,2>{0.776979804f, 0.75020349f},
-std::array<float,2>{0.287939698f, 0.943992198f},
-std::array<float,2>{0.942845762f, 0.308149695f},
-std::array<float,2>{0.226439387f, 0.247580633f},
-std::array<float,2>{0.656889975f, 0.612934113f},
-std::array<float,2>{0.126102209f, 0.813702464f},
-std::array<float,2>{0.731299162f, 0.40845722f},
-std::array<float,2>{0.361288011f, 0.0312339235f},
-std::array<float,2>{0.924636781f, 0.715405285f},
-std::array<float,2>{0.494603217f, 0.54859823f},
-std::array<float,2>{0.830139995f, 0.139343724f},
-std::array<float,2>{0.0727384612f, 0.370553136f},
-std::array<float,2>{0.530469477f, 0.891441524f},
-std::array<float,2>{0.201963276f, 0.583314002f},
-std::array<float,2>{0.635126054f, 0.205231398f},
-std::array<float,2>{0.278347433f, 0.255874991f},
-std::array<float,2>{0.973063707f, 0.987371385f},
-std::array<float,2>{0.408477724f, 0.794951379f},
-std::array<float,2>{0.804458082f, 0.480083674f},
-std::array<float,2>{0.0426132381f, 0.104913212f},
-std::array<float,2>{0.599809229f, 0.648705781f},
-std::array<float,2>{0.120945163f, 0.930606306f},
-std::array<float,2>{0.531463504f, 0.32617721f},
-std::array<float,2>{0.468602061f, 0.183174074f},
-std::array<float,2>{0.869028032f, 0.51350522f},
-std::array<float,2>{0.326069653f, 0.731105506f},
-std::array<float,2>{0.876345456f, 0.0621174201f},
-std::array<float,2>{0.163694501f, 0.405322105f},
-std::array<float,2>{0.698558867f, 0.859457135f},
-std::array<float,2>{0.0890562385f, 0.523850143f},
-std::array<float,2>{0.514763892f, 0.164198235f},
-std::array<float,2>{0.480211198f, 0.333596736f},
-std::array<float,2>{0.817646563f, 0.91032958f},
-std::array<float,2>{0.357210755f, 0.845556378f},
-std::array<float,2>{0.919959843f, 0.388851374f},
-std::array<float,2>{0.15059042f, 0.0424964204f},
-std::array<float,2>{0.742029548f, 0.741096914f},
-std::array<float,2>{0.236697704f, 0.971192241f},
-std::array<float,2>{0.679219186f, 0.27179274f},
-std::array<float,2>{0.304591537f, 0.189995006f},
-std::array<float,2>{0.961295426f, 0.573417723f},
-std::array<float,2>{0.403207093f, 0.628242493f},
-std::array<float,2>{0.751948357f, 0.123960689f},
-std::array<float,2>{0.0258627739f, 0.492400825f},
-std::array<float,2>{0.578923345f, 0.803123891f},
-std::array<float,2>{0.175573558f, 0.70292294f},
-std::array<float,2>{0.716768384f, 0.00347081455f},
-std::array<float,2>{0.329185903f, 0.433670521f},
-std::array<float,2>{0.898738027f, 0.832500279f},
-std::array<float,2>{0.439484775f, 0.880124748f},
-std::array<float,2>{0.846298873f, 0.354108363f},
-std::array<float,2>{0.108370051f, 0.144355625f},
-std::array<float,2>{0.551175058f, 0.537789881f},
-std::array<float,2>{0.0501658395f, 0.771937847f},
-std::array<float,2>{0.610319018f, 0.456339419f},
-std::array<float,2>{0.428874403f, 0.0706803501f},
-std::array<float,2>{0.796083629f, 0.669290304f},
-std::array<float,2>{0.261715531f, 0.598086417f},
-std::array<float,2>{0.994501531f, 0.221458167f},
-std::array<float,2>{0.209174752f, 0.287724465f},
-std::array<float,2>{0.654622853f, 0.961334407f},
-std::array<float,2>{0.0752182454f, 0.639721632f},
-std::array<float,2>{0.523515463f, 0.116306335f},
-std::array<float,2>{0.499154538f, 0.490185797f},
-std::array<float,2>{0.833458185f, 0.811445951f},
-std::array<float,2>{0.364224821f, 0.977492929f},
-std::array<float,2>{0.926666856f, 0.2798509f},
-std::array<float,2>{0.12910001f, 0.197002441f},
-std::array<float,2>{0.729579389f, 0.565239966f},
-std::array<float,2>{0.221909538f, 0.85737747f},
-std::array<float,2>{0.66288507f, 0.379391551f},
-std::array<float,2>{0.282726884f, 0.0382489823f},
-std::array<float,2>{0.939262748f, 0.749666333f},
-std::array<float,2>{0.388739645f, 0.51906383f},
-std::array<float,2>{0.779321432f, 0.163914159f},
-std::array<float,2>{0.0044465987f, 0.340067506f},
-std::array<float,2>{0.565921187f, 0.918868661f},
-std::array<float,2>{0.159426421f, 0.602872014f},
-std::array<float,2>{0.702300966f, 0.2318822f},
-std::array<float,2>{0.323580384f, 0.292474657f},
-std::array<float,2>{0.879270077f, 0.954598725f},
-std::array<float,2>{0.464763254f, 0.780166864f},
-std::array<float,2>{0.872897267f, 0.467439622f},
-std::array<float,2>{0.124743678f, 0.067025505f},
-std::array<float,2>{0.538051963f, 0.66025871f},
-std::array<float,2>{0.0461842045f, 0.88930124f},
-std::array<float,2>{0.596745193f, 0.350279868f},
-std::array<float,2>{0.411286503f, 0.155527636f},
-std::array<float,2>{0.798042536f, 0.543570161f},
-std::array<float,2>{0.274245501f, 0.69011718f},
-std::array<float,2>{0.970318019f, 0.00943505298f},
-std::array<float,2>{0.196848348f, 0.42488119f},
-std::array<float,2>{0.639549077f, 0.837462902f},
-std::array<float,2>{0.0311919283f, 0.561780274f},
-std::array<float,2>{0.583718121f, 0.13246353f},
-std::array<float,2>{0.398738533f, 0.360336363f},
-std::array<float,2>{0.754051745f, 0.899702132f},
-std::array<float,2>{0.298202544f, 0.82810241f},
-std::array<float,2>{0.964849472f, 0.419419527f},
-std::array<float,2>{0.239173144f, 0.019751614f},
-std::array<float,2>{0.674792409f, 0.707519352f},
-std::array<float,2>{0.152776808f, 0.952908576f},
-std::array<float,2>{0.736724913f, 0.296991557f},
-std::array<float,2>{0.352914661f, 0.23869738f},
-std::array<float,2>{0.914910614f, 0.623575449f},
-std::array<float,2>{0.480907112f, 0.674295247f},
-std::array<float,2>{0.816047728f, 0.0903530419f},
-std::array<float,2>{0.0910556838f, 0.446127146f},
-std::array<float,2>{0.509096742f, 0.757915735f},
-std::array<float,2>{0.203424037f, 0.725291371f},
-std::array<float,2>{0.64959687f, 0.0518891253f},
-std::array<float,2>{0.263400167f, 0.396931618f},
-std::array<float,2>{0.997889817f, 0.870031893f},
-std::array<float,2>{0.425205886f, 0.923828423f},
-std::array<float,2>{0.79180342f, 0.313853413f},
-std::array<float,2>{0.0514640845f, 0.178854167f},
-std::array<float,2>{0.616498649f, 0.500516653f},
-std::array<float,2>{0.104734272f, 0.78406471f},
-std::array<float,2>{0.547022045f, 0.471296936f},
-std::array<float,2>{0.441897035f, 0.0942495838f},
-std::array<float,2>{0.850578606f, 0.641183257f},
-std::array<float,2>{0.333654225f, 0.589172006f},
-std::array<float,2>{0.90533334f, 0.215504393f},
-std::array<float,2>{0.177764237f, 0.261583447f},
-std::array<float,2>{0.711581707f, 0.99574101f},
-std::array<float,2>{0.0569529906f, 0.712790787f},
-std::array<float,2>{0.620821953f, 0.0248807389f},
-std::array<float,2>{0.432323456f, 0.412655234f},
-std::array<float,2>{0.786278665f, 0.820017636f},
-std::array<float,2>{0.250465751f, 0.895019352f},
-std::array<float,2>{0.990821421f, 0.371423513f},
-std::array<float,2>{0.212723374f, 0.135183334f},
-std::array<float,2>{0.644572437f, 0.553132355f},
-std::array<float,2>{0.186141253f, 0.755007207f},
-std::array<float,2>{0.70701623f, 0.438623071f},
-std::array<float,2>{0.340985566f, 0.0829450861f},
-std::array<float,2>{0.897152424f, 0.682234943f},
-std::array<float,2>{0.448448181f, 0.61695087f},
-std::array<float,2>{0.854567707f, 0.245512635f},
-std::array<float,2>{0.0973844379f, 0.312369138f},
-std::array<float,2>{0.559603691f, 0.941360891f},
-std::array<float,2>{0.244084239f, 0.509171605f},
-std::array<float,2>{0.681250334f, 0.184545532f},
-std::array<float,2>{0.307680905f, 0.3209171f},
-std::array<float,2>{0.954740763f, 0.934397042f},
-std::array<float,2>{0.397315264f, 0.866002679f},
-std::array<float,2>{0.760358512f, 0.399686247f},
-std::array<float,2>{0.0204159636f, 0.0568629354f},
-std::array<float,2>{0.592732549f, 0.730158746f},
-std::array<float,2>{0.0856100246f, 0.990565062f},
-std::array<float,2>{0.501694083f, 0.250876576f},
-std::array<float,2>{0.475852966f, 0.210303053f},
-std::array<float,2>{0.825144887f, 0.580214798f},
-std::array<float,2>{0.346766025f, 0.653517008f},
-std::array<float,2>{0.909228027f, 0.105521485f},
-std::array<float,2>{0.143962517f, 0.484219372f},
-std::array<float,2>{0.743045628f, 0.791632175f},
-std::array<float,2>{0.114280775f, 0.574739933f},
-std::array<float,2>{0.545002878f, 0.191625029f},
-std::array<float,2>{0.455164224f, 0.268120706f},
-std::array<float,2>{0.865219533f, 0.975862682f},
-std::array<float,2>{0.3136594f, 0.798605442f},
-std::array<float,2>{0.885966003f, 0.499700159f},
-std::array<float,2>{0.165786758f, 0.120620482f},
-std::array<float,2>{0.687632442f, 0.63033098f},
-std::array<float,2>{0.188125283f, 0.908478558f},
-std::array<float,2>{0.63168627f, 0.330694884f},
-std::array<float,2>{0.266722023f, 0.169276282f},
-std::array<float,2>{0.978906691f, 0.529135585f},
-std::array<float,2>{0.419901162f, 0.735729098f},
-std::array<float,2>{0.808151841f, 0.0434620082f},
-std::array<float,2>{0.0323669128f, 0.385546327f},
-std::array<float,2>{0.607675493f, 0.850064218f},
-std::array<float,2>{0.133840069f, 0.666513562f},
-std::array<float,2>{0.722826123f, 0.0781091973f},
-std::array<float,2>{0.369625896f, 0.457944781f},
-std::array<float,2>{0.935216367f, 0.769257963f},
-std::array<float,2>{0.489950657f, 0.96604383f},
-std::array<float,2>{0.841908753f, 0.282442153f},
-std::array<float,2>{0.0687579587f, 0.226405993f},
-std::array<float,2>{0.520775318f, 0.596921921f},
-std::array<float,2>{0.0144018196f, 0.828488171f},
-std::array<float,2>{0.574701607f, 0.433462024f},
-std::array<float,2>{0.380899042f, 0.00691917166f},
-std::array<float,2>{0.765969634f, 0.696563125f},
-std::array<float,2>{0.290598094f, 0.532977521f},
-std::array<float,2>{0.951334178f, 0.147853091f},
-std::array<float,2>{0.23084943f, 0.35840106f},
-std::array<float,2>{0.66900605f, 0.878773034f},
-std::array<float,2>{0.0788574666f, 0.69397676f},
-std::array<float,2>{0.503917396f, 0.014867004f},
-std::array<float,2>{0.470041096f, 0.426594973f},
-std::array<float,2>{0.821673572f, 0.84372735f},
-std::array<float,2>{0.348013192f, 0.883279264f},
-std::array<float,2>{0.912644267f, 0.345249325f},
-std::array<float,2>{0.145519644f, 0.150383562f},
-std::array<float,2>{0.746267498f, 0.539749146f},
-std::array<float,2>{0.246367425f, 0.777264953f},
-std::array<float,2>{0.68502146f, 0.46104899f},
-std::array<float,2>{0.311793119f, 0.0645732433f},
-std::array<float,2>{0.958632648f, 0.658052921f},
-std::array<float,2>{0.392307281f, 0.607407212f},
-std::array<float,2>{0.765129924f, 0.228956878f},
-std::array<float,2>{0.0178245101f, 0.293235958f},
-std::array<float,2>{0.587263167f, 0.957871139f},
-std::array<float,2>{0.182836637f, 0.523065567f},
-std::array<float,2>{0.707647204f, 0.158494964f},
-std::array<float,2>{0.339021236f, 0.33672455f},
-std::array<float,2>{0.894460857f, 0.916174114f},
-std::array<float,2>{0.450533599f, 0.853723526f},
-std::array<float,2>{0.856992662f, 0.378636628f},
-std::array<float,2>{0.0988039151f, 0.0325307213f},
-std::array<float,2>{0.556191206f, 0.743424416f},
-std::array<float,2>{0.0620271601f, 0.981859565f},
-std::array<float,2>{0.622294366f, 0.273503423f},
-std::array<float,2>{0.435016513f, 0.202787489f},
-std::array<float,2>{0.783065796f, 0.567196965f},
-std::array<float,2>{0.257508099f, 0.636703193f},
-std::array<float,2>{0.987825751f, 0.110841922f},
-std::array<float,2>{0.217892036f, 0.485894978f},
-std::array<float,2>{0.643024504f, 0.805818021f},
-std::array<float,2>{0.0102655776f, 0.590569437f},
-std::array<float,2>{0.573292136f, 0.213093996f},
-std::array<float,2>{0.375727564f, 0.263760269f},
-std::array<float,2>{0.77048403f, 0.99991709f},
-std::array<float,2>{0.295815766f, 0.786299467f},
-std::array<float,2>{0.948225796f, 0.473450541f},
-std::array<float,2>{0.230202362f, 0.0997096673f},
-std::array<float,2>{0.66569221f, 0.645677209f},
-std::array<float,2>{0.137251362f, 0.927135468f},
-std::array<float,2>{0.718896091f, 0.318416476f},
-std::array<float,2>{0.374259561f, 0.173892036f},
-std::array<float,2>{0.930410683f, 0.504069388f},
-std::array<float,2>{0.484476805f, 0.722606122f},
-std::array<float,2>{0.837267399f, 0.0506102256f},
-std::array<float,2>{0.0639307499f, 0.393167257f},
-std::array<float,2>{0.518765867f, 0.874469042f},
-std::array<float,2>{0.192101911f, 0.678035796f},
-std::array<float,2>{0.626939058f, 0.0894084424f},
-std::array<float,2>{0.269602865f, 0.449803442f},
-std::array<float,2>{0.983573079f, 0.763544679f},
-std::array<float,2>{0.417631596f, 0.947681069f},
-std::array<float,2>{0.810739279f, 0.303759873f},
-std::array<float,2>{0.0386462435f, 0.236009195f},
-std::array<float,2>{0.603961587f, 0.617966056f},
-std::array<float,2>{0.109600902f, 0.823293686f},
-std::array<float,2>{0.539907038f, 0.415703446f},
-std::array<float,2>{0.457714647f, 0.0168207642f},
-std::array<float,2>{0.860278487f, 0.706386685f},
-std::array<float,2>{0.316459924f, 0.555491388f},
-std::array<float,2>{0.889513671f, 0.12764287f},
-std::array<float,2>{0.168892041f, 0.363796234f},
-std::array<float,2>{0.691446662f, 0.905065f},
-std::array<float,2>{0.0404488072f, 0.651053965f},
-std::array<float,2>{0.59796989f, 0.102260552f},
-std::array<float,2>{0.407012939f, 0.477597624f},
-std::array<float,2>{0.801814258f, 0.794695795f},
-std::array<float,2>{0.279306293f, 0.985346675f},
-std::array<float,2>{0.976047993f, 0.255604804f},
-std::array<float,2>{0.199424803f, 0.204156786f},
-std::array<float,2>{0.633874714f, 0.584187746f},
-std::array<float,2>{0.160964951f, 0.86232692f},
-std::array<float,2>{0.696321011f, 0.402853221f},
-std::array<float,2>{0.327616632f, 0.0598518103f},
-std::array<float,2>{0.877890527f, 0.734156728f},
-std::array<float,2>{0.46555078f, 0.514608562f},
-std::array<float,2>{0.870105982f, 0.179918885f},
-std::array<float,2>{0.118412957f, 0.32540682f},
-std::array<float,2>{0.534438372f, 0.933381319f},
-std::array<float,2>{0.2234734f, 0.609649837f},
-std::array<float,2>{0.659411132f, 0.24858743f},
-std::array<float,2>{0.286489993f, 0.306047678f},
-std::array<float,2>{0.944514155f, 0.9425717f},
-std::array<float,2>{0.384804398f, 0.752245486f},
-std::array<float,2>{0.774030983f, 0.444895834f},
-std::array<float,2>{0.00038970646f, 0.0798733905f},
-std::array<float,2>{0.568445861f, 0.684667826f},
-std::array<float,2>{0.0706805289f, 0.892996073f},
-std::array<float,2>{0.528317094f, 0.368987888f},
-std::array<float,2>{0.492830276f, 0.137922749f},
-std::array<float,2>{0.828859925f, 0.550704181f},
-std::array<float,2>{0.362608522f, 0.718192041f},
-std::array<float,2>{0.922617793f, 0.0276687574f},
-std::array<float,2>{0.128148824f, 0.406549752f},
-std::array<float,2>{0.73432982f, 0.815729141f},
-std::array<float,2>{0.105492264f, 0.535335124f},
-std::array<float,2>{0.554026306f, 0.141982526f},
-std::array<float,2>{0.438311845f, 0.352502555f},
-std::array<float,2>{0.844258666f, 0.881581068f},
-std::array<float,2>{0.330305219f, 0.835183978f},
-std::array<float,2>{0.902266085f, 0.435803741f},
-std::array<float,2>{0.173033223f, 0.000410272973f},
-std::array<float,2>{0.718028665f, 0.700405121f},
-std::array<float,2>{0.207385615f, 0.964076996f},
-std::array<float,2>{0.652427614f, 0.286469609f},
-std::array<float,2>{0.258933276f, 0.220588177f},
-std::array<float,2>{0.993356705f, 0.599622905f},
-std::array<float,2>{0.426299155f, 0.670226932f},
-std::array<float,2>{0.793143034f, 0.073307313f},
-std::array<float,2>{0.0476059392f, 0.454290479f},
-std::array<float,2>{0.612809539f, 0.771007717f},
-std::array<float,2>{0.148838311f, 0.73871237f},
-std::array<float,2>{0.7387833f, 0.0397200696f},
-std::array<float,2>{0.358042508f, 0.387041003f},
-std::array<float,2>{0.918521702f, 0.847599685f},
-std::array<float,2>{0.476983726f, 0.913590908f},
-std::array<float,2>{0.820073903f, 0.334297985f},
-std::array<float,2>{0.0874015465f, 0.167613611f},
-std::array<float,2>{0.512170672f, 0.525966525f},
-std::array<float,2>{0.0245672315f, 0.801574826f},
-std::array<float,2>{0.580741704f, 0.494625717f},
-std::array<float,2>{0.405286074f, 0.122465007f},
-std::array<float,2>{0.75255847f, 0.626936674f},
-std::array<float,2>{0.301864535f, 0.571479023f},
-std::array<float,2>{0.964798331f, 0.189001933f},
-std::array<float,2>{0.235831246f, 0.270727813f},
-std::array<float,2>{0.676408887f, 0.970482826f},
-std::array<float,2>{0.121781051f, 0.66343987f},
-std::array<float,2>{0.53709197f, 0.0694041774f},
-std::array<float,2>{0.462705076f, 0.465845674f},
-std::array<float,2>{0.874097049f, 0.778497517f},
-std::array<float,2>{0.320376486f, 0.956557393f},
-std::array<float,2>{0.880956233f, 0.290129304f},
-std::array<float,2>{0.157859385f, 0.232514143f},
-std::array<float,2>{0.70116955f, 0.604465306f},
-std::array<float,2>{0.198281586f, 0.839497805f},
-std::array<float,2>{0.638617873f, 0.422880292f},
-std::array<float,2>{0.275652349f, 0.011495715f},
-std::array<float,2>{0.972285628f, 0.688074589f},
-std::array<float,2>{0.412754744f, 0.545524001f},
-std::array<float,2>{0.800465405f, 0.153680071f},
-std::array<float,2>{0.0447848774f, 0.349384636f},
-std::array<float,2>{0.595504582f, 0.888543904f},
-std::array<float,2>{0.132227406f, 0.563089728f},
-std::array<float,2>{0.727006972f, 0.199083f},
-std::array<float,2>{0.366396755f, 0.277416348f},
-std::array<float,2>{0.928502619f, 0.979365587f},
-std::array<float,2>{0.496445656f, 0.808621109f},
-std::array<float,2>{0.835839808f, 0.492163032f},
-std::array<float,2>{0.0761913881f, 0.115116842f},
-std::array<float,2>{0.526956558f, 0.637115896f},
-std::array<float,2>{0.00639195135f, 0.920421302f},
-std::array<float,2>{0.563973486f, 0.342614442f},
-std::array<float,2>{0.387538075f, 0.161594272f},
-std::array<float,2>{0.779101312f, 0.517290413f},
-std::array<float,2>{0.284388989f, 0.747036994f},
-std::array<float,2>{0.939464986f, 0.0359907299f},
-std::array<float,2>{0.21925582f, 0.382142425f},
-std::array<float,2>{0.661059856f, 0.858569026f},
-std::array<float,2>{0.0546670705f, 0.502674043f},
-std::array<float,2>{0.614565194f, 0.175876603f},
-std::array<float,2>{0.422339678f, 0.315224588f},
-std::array<float,2>{0.790158272f, 0.92331773f},
-std::array<float,2>{0.263844222f, 0.868254244f},
-std::array<float,2>{0.998584926f, 0.396471411f},
-std::array<float,2>{0.205818027f, 0.0546214096f},
-std::array<float,2>{0.650727212f, 0.724184752f},
-std::array<float,2>{0.177602768f, 0.993572533f},
-std::array<float,2>{0.714572012f, 0.258057714f},
-std::array<float,2>{0.33576259f, 0.217356235f},
-std::array<float,2>{0.903446198f, 0.587032735f},
-std::array<float,2>{0.445291162f, 0.642790973f},
-std::array<float,2>{0.849218309f, 0.0976184309f},
-std::array<float,2>{0.102927022f, 0.470481485f},
-std::array<float,2>{0.549362719f, 0.782388747f},
-std::array<float,2>{0.240676031f, 0.709609747f},
-std::array<float,2>{0.672155678f, 0.0233117528f},
-std::array<float,2>{0.299016595f, 0.420311749f},
-std::array<float,2>{0.966885805f, 0.825710714f},
-std::array<float,2>{0.401296318f, 0.901149869f},
-std::array<float,2>{0.757282853f, 0.361482173f},
-std::array<float,2>{0.0279052984f, 0.130119279f},
-std::array<float,2>{0.584217489f, 0.558596134f},
-std::array<float,2>{0.0935780853f, 0.760225356f},
-std::array<float,2>{0.511620224f, 0.447799146f},
-std::array<float,2>{0.484307647f, 0.0934148654f},
-std::array<float,2>{0.813028812f, 0.672867596f},
-std::array<float,2>{0.354181409f, 0.621985018f},
-std::array<float,2>{0.916965485f, 0.242127463f},
-std::array<float,2>{0.155858532f, 0.300637275f},
-std::array<float,2>{0.734430969f, 0.950755835f},
-std::array<float,2>{0.0228043236f, 0.727392375f},
-std::array<float,2>{0.590644538f, 0.0560303107f},
-std::array<float,2>{0.396442026f, 0.401012629f},
-std::array<float,2>{0.758292377f, 0.865113974f},
-std::array<float,2>{0.30646202f, 0.936577737f},
-std::array<float,2>{0.955946565f, 0.323259234f},
-std::array<float,2>{0.244974151f, 0.186231717f},
-std::array<float,2>{0.683129907f, 0.511171222f},
-std::array<float,2>{0.142434314f, 0.789510071f},
-std::array<float,2>{0.744569361f, 0.480613202f},
-std::array<float,2>{0.343998671f, 0.107944757f},
-std::array<float,2>{0.908012211f, 0.656002998f},
-std::array<float,2>{0.473891348f, 0.579282224f},
-std::array<float,2>{0.827863812f, 0.20855169f},
-std::array<float,2>{0.0820685178f, 0.252640367f},
-std::array<float,2>{0.502287984f, 0.989579737f},
-std::array<float,2>{0.214519337f, 0.552669704f},
-std::array<float,2>{0.647967219f, 0.134272039f},
-std::array<float,2>{0.252310693f, 0.373854667f},
-std::array<float,2>{0.989121437f, 0.896778464f},
-std::array<float,2>{0.429854751f, 0.816998601f},
-std::array<float,2>{0.787755013f, 0.410722703f},
-std::array<float,2>{0.0550991967f, 0.0259951781f},
-std::array<float,2>{0.61786747f, 0.714712441f},
-std::array<float,2>{0.0941797942f, 0.939055741f},
-std::array<float,2>{0.562370241f, 0.309615046f},
-std::array<float,2>{0.445649803f, 0.243673936f},
-std::array<float,2>{0.852197886f, 0.614024997f},
-std::array<float,2>{0.342093527f, 0.680942178f},
-std::array<float,2>{0.895778596f, 0.0858788937f},
-std::array<float,2>{0.184078485f, 0.4407776f},
-std::array<float,2>{0.704425514f, 0.757123768f},
-std::array<float,2>{0.0678593591f, 0.594327211f},
-std::array<float,2>{0.521800578f, 0.223140746f},
-std::array<float,2>{0.491506368f, 0.284922302f},
-std::array<float,2>{0.841408551f, 0.968426287f},
-std::array<float,2>{0.367197722f, 0.767023683f},
-std::array<float,2>{0.937439799f, 0.460507005f},
-std::array<float,2>{0.135681063f, 0.0747381598f},
-std::array<float,2>{0.724892318f, 0.665612161f},
-std::array<float,2>{0.234009981f, 0.875077367f},
-std::array<float,2>{0.67009443f, 0.35602805f},
-std::array<float,2>{0.29215762f, 0.146003157f},
-std::array<float,2>{0.950671434f, 0.534017324f},
-std::array<float,2>{0.379948735f, 0.699009776f},
-std::array<float,2>{0.768061399f, 0.00489625568f},
-std::array<float,2>{0.0128975166f, 0.430273116f},
-std::array<float,2>{0.576668262f, 0.830248713f},
-std::array<float,2>{0.166384816f, 0.631778955f},
-std::array<float,2>{0.690492749f, 0.117421448f},
-std::array<float,2>{0.314537406f, 0.4969953f},
-std::array<float,2>{0.883574784f, 0.800210297f},
-std::array<float,2>{0.455041081f, 0.97310847f},
-std::array<float,2>{0.86537987f, 0.267286986f},
-std::array<float,2>{0.11559014f, 0.193406448f},
-std::array<float,2>{0.543260336f, 0.577196717f},
-std::array<float,2>{0.0342109799f, 0.848552763f},
-std::array<float,2>{0.606565237f, 0.384090155f},
-std::array<float,2>{0.420754492f, 0.0451829731f},
-std::array<float,2>{0.805242836f, 0.737863481f},
-std::array<float,2>{0.267996252f, 0.530200839f},
-std::array<float,2>{0.976795733f, 0.171550766f},
-std::array<float,2>{0.189792603f, 0.328363866f},
-std::array<float,2>{0.629108965f, 0.907699287f},
-std::array<float,2>{0.107803859f, 0.700846553f},
-std::array<float,2>{0.551314414f, 0.00073192548f},
-std::array<float,2>{0.440083861f, 0.436247051f},
-std::array<float,2>{0.845784903f, 0.835839927f},
-std::array<float,2>{0.329665035f, 0.881134152f},
-std::array<float,2>{0.899212837f, 0.351724535f},
-std::array<float,2>{0.174914405f, 0.142509326f},
-std::array<float,2>{0.716090798f, 0.535748124f},
-std::array<float,2>{0.20965296f, 0.770523071f},
-std::array<float,2>{0.655124307f, 0.454722226f},
-std::array<float,2>{0.261040896f, 0.0741771311f},
-std::array<float,2>{0.994833529f, 0.67055887f},
-std::array<float,2>{0.429233164f, 0.600229561f},
-std::array<float,2>{0.79669714f, 0.219937578f},
-std::array<float,2>{0.0506318286f, 0.2868554f},
-std::array<float,2>{0.609575093f, 0.964512885f},
-std::array<float,2>{0.151136354f, 0.525825381f},
-std::array<float,2>{0.741398513f, 0.167331636f},
-std::array<float,2>{0.356719166f, 0.334694892f},
-std::array<float,2>{0.92059654f, 0.913443923f},
-std::array<float,2>{0.479587287f, 0.846868575f},
-std::array<float,2>{0.818321943f, 0.387591839f},
-std::array<float,2>{0.0898080394f, 0.0392394736f},
-std::array<float,2>{0.515296102f, 0.739209235f},
-std::array<float,2>{0.0263474062f, 0.969816446f},
-std::array<float,2>{0.578196824f, 0.271145582f},
-std::array<float,2>{0.40244776f, 0.188563257f},
-std::array<float,2>{0.751395941f, 0.572169006f},
-std::array<float,2>{0.303970665f, 0.626007438f},
-std::array<float,2>{0.961634994f, 0.122747906f},
-std::array<float,2>{0.237275988f, 0.495006561f},
-std::array<float,2>{0.679084539f, 0.801061749f},
-std::array<float,2>{0.0424100682f, 0.58496052f},
-std::array<float,2>{0.600526929f, 0.205057666f},
-std::array<float,2>{0.408870995f, 0.255092531f},
-std::array<float,2>{0.804056346f, 0.984612048f},
-std::array<float,2>{0.278994054f, 0.794174433f},
-std::array<float,2>{0.973283648f, 0.47813195f},
-std::array<float,2>{0.201565623f, 0.101639546f},
-std::array<float,2>{0.63573122f, 0.650722444f},
-std::array<float,2>{0.163137436f, 0.933061838f},
-std::array<float,2>{0.698826253f, 0.325994521f},
-std::array<float,2>{0.325557888f, 0.180285081f},
-std::array<float,2>{0.87688458f, 0.513697326f},
-std::array<float,2>{0.467965633f, 0.733521104f},
-std::array<float,2>{0.86829567f, 0.0602238104f},
-std::array<float,2>{0.120231636f, 0.402406454f},
-std::array<float,2>{0.531911373f, 0.863094091f},
-std::array<float,2>{0.225829512f, 0.685305476f},
-std::array<float,2>{0.656541049f, 0.0794019848f},
-std::array<float,2>{0.287114054f, 0.444681287f},
-std::array<float,2>{0.942937553f, 0.752558649f},
-std::array<float,2>{0.384254813f, 0.942952812f},
-std::array<float,2>{0.776374817f, 0.306608021f},
-std::array<float,2>{0.00261449651f, 0.248289347f},
-std::array<float,2>{0.567067504f, 0.610241234f},
-std::array<float,2>{0.0730402023f, 0.816248536f},
-std::array<float,2>{0.530955493f, 0.40688917f},
-std::array<float,2>{0.49505794f, 0.0282276701f},
-std::array<float,2>{0.830959618f, 0.71855557f},
-std::array<float,2>{0.360595912f, 0.550216198f},
-std::array<float,2>{0.923918009f, 0.138257369f},
-std::array<float,2>{0.126486138f, 0.368619233f},
-std::array<float,2>{0.730917215f, 0.893355489f},
-std::array<float,2>{0.0090760095f, 0.646031559f},
-std::array<float,2>{0.571244061f, 0.100390524f},
-std::array<float,2>{0.3782565f, 0.47266826f},
-std::array<float,2>{0.77169627f, 0.787080467f},
-std::array<float,2>{0.294794649f, 0.999388754f},
-std::array<float,2>{0.947153687f, 0.264483213f},
-std::array<float,2>{0.226701647f, 0.213837281f},
-std::array<float,2>{0.667942166f, 0.590328157f},
-std::array<float,2>{0.140534937f, 0.874690056f},
-std::array<float,2>{0.721045375f, 0.392722547f},
-std::array<float,2>{0.371918499f, 0.0500239842f},
-std::array<float,2>{0.932185411f, 0.721991956f},
-std::array<float,2>{0.487279683f, 0.504847765f},
-std::array<float,2>{0.839136839f, 0.174745023f},
-std::array<float,2>{0.0658527911f, 0.319231391f},
-std::array<float,2>{0.515868485f, 0.927528203f},
-std::array<float,2>{0.194736198f, 0.617666423f},
-std::array<float,2>{0.627208948f, 0.235368311f},
-std::array<float,2>{0.272170931f, 0.304230779f},
-std::array<float,2>{0.982133985f, 0.947839618f},
-std::array<float,2>{0.415148318f, 0.763087749f},
-std::array<float,2>{0.809486687f, 0.449595779f},
-std::array<float,2>{0.0360885076f, 0.0891838074f},
-std::array<float,2>{0.603074074f, 0.678591728f},
-std::array<float,2>{0.112347014f, 0.904314756f},
-std::array<float,2>{0.542465687f, 0.363754392f},
-std::array<float,2>{0.459066987f, 0.127042621f},
-std::array<float,2>{0.861967206f, 0.554877102f},
-std::array<float,2>{0.318946153f, 0.706970453f},
-std::array<float,2>{0.888190091f, 0.0171361323f},
-std::array<float,2>{0.170883045f, 0.41546303f},
-std::array<float,2>{0.694420159f, 0.824129462f},
-std::array<float,2>{0.0812363625f, 0.539542496f},
-std::array<float,2>{0.507341981f, 0.149799183f},
-std::array<float,2>{0.471307278f, 0.34496364f},
-std::array<float,2>{0.822842002f, 0.883681297f},
-std::array<float,2>{0.350694746f, 0.8429389f},
-std::array<float,2>{0.91032815f, 0.42621389f},
-std::array<float,2>{0.147059515f, 0.0152987242f},
-std::array<float,2>{0.74966085f, 0.693564594f},
-std::array<float,2>{0.249968141f, 0.957281828f},
-std::array<float,2>{0.686569095f, 0.293832928f},
-std::array<float,2>{0.309193492f, 0.229352579f},
-std::array<float,2>{0.960799336f, 0.606764317f},
-std::array<float,2>{0.393251687f, 0.657689989f},
-std::array<float,2>{0.763004303f, 0.0652230904f},
-std::array<float,2>{0.0160719994f, 0.461882353f},
-std::array<float,2>{0.589590728f, 0.776732743f},
-std::array<float,2>{0.179836258f, 0.743696213f},
-std::array<float,2>{0.709447384f, 0.0327185057f},
-std::array<float,2>{0.337273538f, 0.378366143f},
-std::array<float,2>{0.891386986f, 0.854406595f},
-std::array<float,2>{0.453007638f, 0.916687191f},
-std::array<float,2>{0.857450783f, 0.336284608f},
-std::array<float,2>{0.101511814f, 0.158844367f},
-std::array<float,2>{0.557409227f, 0.522598624f},
-std::array<float,2>{0.0602656975f, 0.806624293f},
-std::array<float,2>{0.624388635f, 0.485785425f},
-std::array<float,2>{0.435875446f, 0.110665485f},
-std::array<float,2>{0.783926845f, 0.63600719f},
-std::array<float,2>{0.254812688f, 0.566406608f},
-std::array<float,2>{0.985762715f, 0.202340409f},
-std::array<float,2>{0.215966806f, 0.274333477f},
-std::array<float,2>{0.640673816f, 0.982265592f},
-std::array<float,2>{0.0689798295f, 0.665052474f},
-std::array<float,2>{0.521171451f, 0.0745294616f},
-std::array<float,2>{0.489681512f, 0.460401356f},
-std::array<float,2>{0.84265089f, 0.767572105f},
-std::array<float,2>{0.370004624f, 0.967864871f},
-std::array<float,2>{0.935049355f, 0.284313083f},
-std::array<float,2>{0.13449423f, 0.223450184f},
-std::array<float,2>{0.723569334f, 0.594103634f},
-std::array<float,2>{0.231128842f, 0.830943763f},
-std::array<float,2>{0.669768274f, 0.430084556f},
-std::array<float,2>{0.290196866f, 0.00551872374f},
-std::array<float,2>{0.951858819f, 0.698336482f},
-std::array<float,2>{0.381480634f, 0.533631265f},
-std::array<float,2>{0.766447902f, 0.145890296f},
-std::array<float,2>{0.0140340002f, 0.355545044f},
-std::array<float,2>{0.574929655f, 0.875965893f},
-std::array<float,2>{0.165271267f, 0.577890992f},
-std::array<float,2>{0.688313425f, 0.19399415f},
-std::array<float,2>{0.314150006f, 0.266893208f},
-std::array<float,2>{0.886496067f, 0.973500788f},
-std::array<float,2>{0.455789506f, 0.800687611f},
-std::array<float,2>{0.864473879f, 0.496407926f},
-std::array<float,2>{0.114908449f, 0.117989518f},
-std::array<float,2>{0.545604944f, 0.631347179f},
-std::array<float,2>{0.0328901149f, 0.907767832f},
-std::array<float,2>{0.608025908f, 0.328771681f},
-std::array<float,2>{0.419105023f, 0.171052039f},
-std::array<float,2>{0.807848513f, 0.529698789f},
-std::array<float,2>{0.267350197f, 0.737759531f},
-std::array<float,2>{0.979339957f, 0.0456386805f},
-std::array<float,2>{0.187545016f, 0.384380281f},
-std::array<float,2>{0.631263435f, 0.847869039f},
-std::array<float,2>{0.0197254028f, 0.511425972f},
-std::array<float,2>{0.592168987f, 0.185592234f},
-std::array<float,2>{0.396938473f, 0.324016154f},
-std::array<float,2>{0.760196984f, 0.937102973f},
-std::array<float,2>{0.308192611f, 0.864564776f},
-std::array<float,2>{0.95454818f, 0.400771409f},
-std::array<float,2>{0.243199229f, 0.0562544726f},
-std::array<float,2>{0.680923522f, 0.726733983f},
-std::array<float,2>{0.144046158f, 0.989792943f},
-std::array<float,2>{0.742534637f, 0.252400398f},
-std::array<float,2>{0.347622216f, 0.208358899f},
-std::array<float,2>{0.909704089f, 0.579821527f},
-std::array<float,2>{0.476561338f, 0.655727088f},
-std::array<float,2>{0.824640334f, 0.10755308f},
-std::array<float,2>{0.084989287f, 0.481362492f},
-std::array<float,2>{0.501177788f, 0.789981365f},
-std::array<float,2>{0.212355569f, 0.714156151f},
-std::array<float,2>{0.645429611f, 0.0256294999f},
-std::array<float,2>{0.250500649f, 0.410358697f},
-std::array<float,2>{0.990454078f, 0.816888332f},
-std::array<float,2>{0.431978911f, 0.89735651f},
-std::array<float,2>{0.786909103f, 0.373406142f},
-std::array<float,2>{0.0572422221f, 0.134577736f},
-std::array<float,2>{0.620570004f, 0.551960826f},
-std::array<float,2>{0.0967596844f, 0.757669389f},
-std::array<float,2>{0.560223401f, 0.441124827f},
-std::array<float,2>{0.448911488f, 0.085104987f},
-std::array<float,2>{0.854993343f, 0.681441128f},
-std::array<float,2>{0.341738641f, 0.613368809f},
-std::array<float,2>{0.89650768f, 0.243435994f},
-std::array<float,2>{0.185643271f, 0.310143262f},
-std::array<float,2>{0.706413507f, 0.938501954f},
-std::array<float,2>{0.0509632155f, 0.723713934f},
-std::array<float,2>{0.617124677f, 0.0537516214f},
-std::array<float,2>{0.425421715f, 0.395513713f},
-std::array<float,2>{0.79146558f, 0.869105101f},
-std::array<float,2>{0.262769192f, 0.923578084f},
-std::array<float,2>{0.997482598f, 0.314494103f},
-std::array<float,2>{0.203809738f, 0.176392749f},
-std::array<float,2>{0.650195122f, 0.502346694f},
-std::array<float,2>{0.17869927f, 0.783127487f},
-std::array<float,2>{0.711067557f, 0.469970763f},
-std::array<float,2>{0.333281279f, 0.0970543474f},
-std::array<float,2>{0.906085968f, 0.643539906f},
-std::array<float,2>{0.441570938f, 0.587469399f},
-std::array<float,2>{0.849974632f, 0.216897666f},
-std::array<float,2>{0.105073549f, 0.258546114f},
-std::array<float,2>{0.547491074f, 0.993849874f},
-std::array<float,2>{0.238670319f, 0.559192002f},
-std::array<float,2>{0.674135327f, 0.13078092f},
-std::array<float,2>{0.298544466f, 0.362113327f},
-std::array<float,2>{0.965389907f, 0.900724053f},
-std::array<float,2>{0.399183959f, 0.825511575f},
-std::array<float,2>{0.754792452f, 0.42061913f},
-std::array<float,2>{0.0307017453f, 0.0225336943f},
-std::array<float,2>{0.583472192f, 0.709375799f},
-std::array<float,2>{0.0916133896f, 0.950588107f},
-std::array<float,2>{0.50970906f, 0.300286561f},
-std::array<float,2>{0.481410682f, 0.241412133f},
-std::array<float,2>{0.815680265f, 0.621537507f},
-std::array<float,2>{0.353491098f, 0.673499167f},
-std::array<float,2>{0.91449827f, 0.093207933f},
-std::array<float,2>{0.152946919f, 0.447646201f},
-std::array<float,2>{0.737157047f, 0.760584295f},
-std::array<float,2>{0.124233104f, 0.603753507f},
-std::array<float,2>{0.537390172f, 0.233247191f},
-std::array<float,2>{0.464222491f, 0.290751398f},
-std::array<float,2>{0.872181833f, 0.956435382f},
-std::array<float,2>{0.324033022f, 0.778881013f},
-std::array<float,2>{0.879646063f, 0.466793507f},
-std::array<float,2>{0.159927309f, 0.0702981427f},
-std::array<float,2>{0.702932596f, 0.663743377f},
-std::array<float,2>{0.196663797f, 0.887772322f},
-std::array<float,2>{0.638830483f, 0.348673493f},
-std::array<float,2>{0.27385512f, 0.154014185f},
-std::array<float,2>{0.969928563f, 0.545174897f},
-std::array<float,2>{0.412014961f, 0.68781209f},
-std::array<float,2>{0.79867208f, 0.0111906594f},
-std::array<float,2>{0.0468643494f, 0.423625231f},
-std::array<float,2>{0.597309053f, 0.839047551f},
-std::array<float,2>{0.129589975f, 0.637677729f},
-std::array<float,2>{0.730334103f, 0.114274867f},
-std::array<float,2>{0.363470614f, 0.491642416f},
-std::array<float,2>{0.926257491f, 0.809543669f},
-std::array<float,2>{0.499846399f, 0.978892446f},
-std::array<float,2>{0.833916664f, 0.277870625f},
-std::array<float,2>{0.0761067793f, 0.198459044f},
-std::array<float,2>{0.52425468f, 0.562550604f},
-std::array<float,2>{0.00433391612f, 0.859128892f},
-std::array<float,2>{0.565751076f, 0.382454365f},
-std::array<float,2>{0.389406204f, 0.0351933427f},
-std::array<float,2>{0.779903829f, 0.746556461f},
-std::array<float,2>{0.28267467f, 0.516903698f},
-std::array<float,2>{0.938481748f, 0.161899418f},
-std::array<float,2>{0.222619265f, 0.342266083f},
-std::array<float,2>{0.662271619f, 0.920280159f},
-std::array<float,2>{0.0876013413f, 0.740420043f},
-std::array<float,2>{0.512691081f, 0.0423641913f},
-std::array<float,2>{0.477218598f, 0.389309019f},
-std::array<float,2>{0.819570243f, 0.844943523f},
-std::array<float,2>{0.35759148f, 0.910705984f},
-std::array<float,2>{0.918195426f, 0.333117485f},
-std::array<float,2>{0.149025038f, 0.164713547f},
-std::array<float,2>{0.738654196f, 0.52429992f},
-std::array<float,2>{0.236167103f, 0.803567648f},
-std::array<float,2>{0.675836146f, 0.492861331f},
-std::array<float,2>{0.30241546f, 0.123420954f},
-std::array<float,2>{0.96423018f, 0.62887007f},
-std::array<float,2>{0.405900329f, 0.573994994f},
-std::array<float,2>{0.751975775f, 0.18953155f},
-std::array<float,2>{0.0253296942f, 0.272165239f},
-std::array<float,2>{0.580465972f, 0.971114576f},
-std::array<float,2>{0.173600912f, 0.537192345f},
-std::array<float,2>{0.718443215f, 0.143554881f},
-std::array<float,2>{0.33061561f, 0.35364455f},
-std::array<float,2>{0.901600122f, 0.880531013f},
-std::array<float,2>{0.437614113f, 0.832632482f},
-std::array<float,2>{0.844234169f, 0.434127331f},
-std::array<float,2>{0.106027447f, 0.00311082695f},
-std::array<float,2>{0.554374576f, 0.702621341f},
-std::array<float,2>{0.0469563194f, 0.961609006f},
-std::array<float,2>{0.612314045f, 0.287222177f},
-std::array<float,2>{0.42586413f, 0.220814422f},
-std::array<float,2>{0.793512464f, 0.598207295f},
-std::array<float,2>{0.259726524f, 0.669481874f},
-std::array<float,2>{0.994049966f, 0.0712336525f},
-std::array<float,2>{0.207630157f, 0.456971854f},
-std::array<float,2>{0.652969599f, 0.772035718f},
-std::array<float,2>{0.000491065031f, 0.612525642f},
-std::array<float,2>{0.568920255f, 0.247124508f},
-std::array<float,2>{0.385406762f, 0.307774603f},
-std::array<float,2>{0.77370888f, 0.943487465f},
-std::array<float,2>{0.286632061f, 0.750654221f},
-std::array<float,2>{0.945190489f, 0.44245553f},
-std::array<float,2>{0.223075509f, 0.0818509758f},
-std::array<float,2>{0.659987032f, 0.686658382f},
-std::array<float,2>{0.128642559f, 0.890806019f},
-std::array<float,2>{0.733441293f, 0.371081203f},
-std::array<float,2>{0.362925142f, 0.138764322f},
-std::array<float,2>{0.921892703f, 0.548161626f},
-std::array<float,2>{0.492360562f, 0.715102792f},
-std::array<float,2>{0.828378797f, 0.0305192899f},
-std::array<float,2>{0.0710252151f, 0.408791989f},
-std::array<float,2>{0.527357876f, 0.814219654f},
-std::array<float,2>{0.200192794f, 0.648988664f},
-std::array<float,2>{0.634562194f, 0.105183311f},
-std::array<float,2>{0.280252665f, 0.479964226f},
-std::array<float,2>{0.976361215f, 0.795601249f},
-std::array<float,2>{0.406339794f, 0.987943232f},
-std::array<float,2>{0.802402318f, 0.256648064f},
-std::array<float,2>{0.0408053473f, 0.205708429f},
-std::array<float,2>{0.59826529f, 0.583749175f},
-std::array<float,2>{0.118806869f, 0.860246122f},
-std::array<float,2>{0.534980297f, 0.405987561f},
-std::array<float,2>{0.465038747f, 0.0617995448f},
-std::array<float,2>{0.869403362f, 0.73062849f},
-std::array<float,2>{0.327983409f, 0.513076782f},
-std::array<float,2>{0.877354145f, 0.182689935f},
-std::array<float,2>{0.160271421f, 0.327084929f},
-std::array<float,2>{0.697010994f, 0.930082321f},
-std::array<float,2>{0.0382283852f, 0.676536024f},
-std::array<float,2>{0.604159772f, 0.0869293287f},
-std::array<float,2>{0.417350322f, 0.45124802f},
-std::array<float,2>{0.811194301f, 0.764883757f},
-std::array<float,2>{0.270336777f, 0.946080744f},
-std::array<float,2>{0.984352231f, 0.301363736f},
-std::array<float,2>{0.191420257f, 0.237116143f},
-std::array<float,2>{0.626144052f, 0.619222999f},
-std::array<float,2>{0.167968884f, 0.821230531f},
-std::array<float,2>{0.692278206f, 0.416432351f},
-std::array<float,2>{0.317222595f, 0.018961845f},
-std::array<float,2>{0.889109433f, 0.704356015f},
-std::array<float,2>{0.457316399f, 0.558171213f},
-std::array<float,2>{0.859541297f, 0.125332236f},
-std::array<float,2>{0.110050902f, 0.365765452f},
-std::array<float,2>{0.539325178f, 0.902554274f},
-std::array<float,2>{0.229709953f, 0.593537211f},
-std::array<float,2>{0.66551286f, 0.211503252f},
-std::array<float,2>{0.295003742f, 0.263295293f},
-std::array<float,2>{0.947620094f, 0.996095479f},
-std::array<float,2>{0.375255436f, 0.78849268f},
-std::array<float,2>{0.769788325f, 0.475669175f},
-std::array<float,2>{0.0097741941f, 0.0995601788f},
-std::array<float,2>{0.574009895f, 0.648014784f},
-std::array<float,2>{0.0644356906f, 0.928803682f},
-std::array<float,2>{0.51942575f, 0.316824436f},
-std::array<float,2>{0.485319257f, 0.172449782f},
-std::array<float,2>{0.837880492f, 0.506016254f},
-std::array<float,2>{0.37490055f, 0.718798578f},
-std::array<float,2>{0.92996031f, 0.0486228466f},
-std::array<float,2>{0.136720896f, 0.391426027f},
-std::array<float,2>{0.719281435f, 0.871736169f},
-std::array<float,2>{0.0993342325f, 0.521069527f},
-std::array<float,2>{0.555700302f, 0.157720998f},
-std::array<float,2>{0.451131761f, 0.338797301f},
-std::array<float,2>{0.856771767f, 0.91449368f},
-std::array<float,2>{0.339490473f, 0.852044523f},
-std::array<float,2>{0.893842995f, 0.375482529f},
-std::array<float,2>{0.183220953f, 0.0348381996f},
-std::array<float,2>{0.707046211f, 0.745152056f},
-std::array<float,2>{0.218486279f, 0.983546913f},
-std::array<float,2>{0.643391013f, 0.275835127f},
-std::array<float,2>{0.256920218f, 0.200405389f},
-std::array<float,2>{0.987575114f, 0.56900084f},
-std::array<float,2>{0.435276926f, 0.633803606f},
-std::array<float,2>{0.782337785f, 0.113252312f},
-std::array<float,2>{0.0615404993f, 0.486491114f},
-std::array<float,2>{0.623036206f, 0.808226883f},
-std::array<float,2>{0.146394432f, 0.691539168f},
-std::array<float,2>{0.746583939f, 0.0119674876f},
-std::array<float,2>{0.348615974f, 0.428111315f},
-std::array<float,2>{0.912123621f, 0.841451526f},
-std::array<float,2>{0.470268995f, 0.88578999f},
-std::array<float,2>{0.822016895f, 0.345989317f},
-std::array<float,2>{0.0782715529f, 0.151131555f},
-std::array<float,2>{0.504644811f, 0.542190135f},
-std::array<float,2>{0.0181507654f, 0.774383664f},
-std::array<float,2>{0.58785522f, 0.464028955f},
-std::array<float,2>{0.392051786f, 0.0639747456f},
-std::array<float,2>{0.765194833f, 0.659404516f},
-std::array<float,2>{0.312329262f, 0.608575404f},
-std::array<float,2>{0.958218455f, 0.227748841f},
-std::array<float,2>{0.246945798f, 0.295527577f},
-std::array<float,2>{0.685302138f, 0.960312903f},
-std::array<float,2>{0.115784466f, 0.63057816f},
-std::array<float,2>{0.543714523f, 0.1203174f},
-std::array<float,2>{0.454140306f, 0.499511182f},
-std::array<float,2>{0.865974069f, 0.79808569f},
-std::array<float,2>{0.314985991f, 0.976559818f},
-std::array<float,2>{0.88326782f, 0.267888039f},
-std::array<float,2>{0.166568547f, 0.192345142f},
-std::array<float,2>{0.691391528f, 0.574432611f},
-std::array<float,2>{0.190044403f, 0.850316882f},
-std::array<float,2>{0.629617393f, 0.385126829f},
-std::array<float,2>{0.268081307f, 0.0431062281f},
-std::array<float,2>{0.977412224f, 0.735896111f},
-std::array<float,2>{0.42017132f, 0.5285061f},
-std::array<float,2>{0.804745913f, 0.169625223f},
-std::array<float,2>{0.03515568f, 0.330227554f},
-std::array<float,2>{0.607245207f, 0.908899307f},
-std::array<float,2>{0.134812474f, 0.59749198f},
-std::array<float,2>{0.725468874f, 0.225719124f},
-std::array<float,2>{0.367886245f, 0.282928109f},
-std::array<float,2>{0.936562419f, 0.96669215f},
-std::array<float,2>{0.491739988f, 0.768962383f},
-std::array<float,2>{0.840971172f, 0.457042217f},
-std::array<float,2>{0.0682119355f, 0.0775635615f},
-std::array<float,2>{0.522248685f, 0.666162729f},
-std::array<float,2>{0.0132774785f, 0.878067374f},
-std::array<float,2>{0.576604128f, 0.359116077f},
-std::array<float,2>{0.380655408f, 0.147968873f},
-std::array<float,2>{0.76842308f, 0.532651484f},
-std::array<float,2>{0.292818666f, 0.696947992f},
-std::array<float,2>{0.950928271f, 0.00742715411f},
-std::array<float,2>{0.233845592f, 0.432804078f},
-std::array<float,2>{0.670660555f, 0.828721225f},
-std::array<float,2>{0.0555563681f, 0.553680241f},
-std::array<float,2>{0.617273271f, 0.135613292f},
-std::array<float,2>{0.430356085f, 0.371695787f},
-std::array<float,2>{0.787184536f, 0.895161152f},
-std::array<float,2>{0.252625257f, 0.819631815f},
-std::array<float,2>{0.988320887f, 0.412174612f},
-std::array<float,2>{0.214319199f, 0.0251950715f},
-std::array<float,2>{0.647662222f, 0.712174833f},
-std::array<float,2>{0.184408948f, 0.940736532f},
-std::array<float,2>{0.7049281f, 0.311628044f},
-std::array<float,2>{0.342529267f, 0.245775938f},
-std::array<float,2>{0.896045685f, 0.616517603f},
-std::array<float,2>{0.445968091f, 0.681836426f},
-std::array<float,2>{0.851655483f, 0.0823620483f},
-std::array<float,2>{0.094298929f, 0.439350158f},
-std::array<float,2>{0.561879754f, 0.755698979f},
-std::array<float,2>{0.244491354f, 0.729788542f},
-std::array<float,2>{0.682692885f, 0.0574654676f},
-std::array<float,2>{0.306113422f, 0.400099993f},
-std::array<float,2>{0.955401838f, 0.865331888f},
-std::array<float,2>{0.395542145f, 0.93398124f},
-std::array<float,2>{0.75866884f, 0.320500135f},
-std::array<float,2>{0.0230884273f, 0.183750391f},
-std::array<float,2>{0.590047538f, 0.509521604f},
-std::array<float,2>{0.0825973377f, 0.791131616f},
-std::array<float,2>{0.502903283f, 0.483502537f},
-std::array<float,2>{0.474286258f, 0.10602092f},
-std::array<float,2>{0.827351153f, 0.653838754f},
-std::array<float,2>{0.344536513f, 0.580677986f},
-std::array<float,2>{0.907556474f, 0.210627288f},
-std::array<float,2>{0.141919971f, 0.250172585f},
-std::array<float,2>{0.745021284f, 0.990725815f},
-std::array<float,2>{0.0275618918f, 0.707569182f},
-std::array<float,2>{0.584787488f, 0.0202171952f},
-std::array<float,2>{0.400431275f, 0.419480473f},
-std::array<float,2>{0.757477045f, 0.827162921f},
-std::array<float,2>{0.299606472f, 0.900327623f},
-std::array<float,2>{0.967621326f, 0.359773248f},
-std::array<float,2>{0.240962267f, 0.132056624f},
-std::array<float,2>{0.672793567f, 0.562044144f},
-std::array<float,2>{0.155648708f, 0.758774161f},
-std::array<float,2>{0.735289812f, 0.445548505f},
-std::array<float,2>{0.353582472f, 0.0902042761f},
-std::array<float,2>{0.916435421f, 0.674349546f},
-std::array<float,2>{0.483817995f, 0.623324692f},
-std::array<float,2>{0.812920392f, 0.238953605f},
-std::array<float,2>{0.0930976197f, 0.297531545f},
-std::array<float,2>{0.511026919f, 0.952299654f},
-std::array<float,2>{0.205404505f, 0.500359535f},
-std::array<float,2>{0.651252031f, 0.179470792f},
-std::array<float,2>{0.264189661f, 0.313997835f},
-std::array<float,2>{0.998500645f, 0.924389362f},
-std::array<float,2>{0.422372401f, 0.869173586f},
-std::array<float,2>{0.790953875f, 0.397075534f},
-std::array<float,2>{0.0539025851f, 0.0523568876f},
-std::array<float,2>{0.615203321f, 0.724911451f},
-std::array<float,2>{0.103379123f, 0.995319784f},
-std::array<float,2>{0.549205959f, 0.261127293f},
-std::array<float,2>{0.444626987f, 0.215209648f},
-std::array<float,2>{0.848964751f, 0.589479923f},
-std::array<float,2>{0.335333526f, 0.641081333f},
-std::array<float,2>{0.903874338f, 0.0937591046f},
-std::array<float,2>{0.177154005f, 0.470918328f},
-std::array<float,2>{0.714087248f, 0.783631027f},
-std::array<float,2>{0.0769082904f, 0.564818323f},
-std::array<float,2>{0.526785195f, 0.196713418f},
-std::array<float,2>{0.496750355f, 0.27977699f},
-std::array<float,2>{0.835424364f, 0.976587892f},
-std::array<float,2>{0.367026061f, 0.810946584f},
-std::array<float,2>{0.927896857f, 0.48936826f},
-std::array<float,2>{0.132517874f, 0.117179193f},
-std::array<float,2>{0.727402568f, 0.640226066f},
-std::array<float,2>{0.21895957f, 0.918360054f},
-std::array<float,2>{0.660582721f, 0.340751499f},
-std::array<float,2>{0.284820765f, 0.163314149f},
-std::array<float,2>{0.939941466f, 0.518990636f},
-std::array<float,2>{0.386825025f, 0.749445021f},
-std::array<float,2>{0.778625011f, 0.0387776345f},
-std::array<float,2>{0.00613167137f, 0.379838169f},
-std::array<float,2>{0.563609302f, 0.856929898f},
-std::array<float,2>{0.157420978f, 0.660982847f},
-std::array<float,2>{0.700559974f, 0.06661015f},
-std::array<float,2>{0.320909262f, 0.466910332f},
-std::array<float,2>{0.881676674f, 0.779450774f},
-std::array<float,2>{0.462088138f, 0.954167902f},
-std::array<float,2>{0.874830008f, 0.29252556f},
-std::array<float,2>{0.121186726f, 0.232316017f},
-std::array<float,2>{0.536280394f, 0.603213668f},
-std::array<float,2>{0.0443972424f, 0.837117791f},
-std::array<float,2>{0.594731748f, 0.425720304f},
-std::array<float,2>{0.412266821f, 0.00926637184f},
-std::array<float,2>{0.800177634f, 0.689818442f},
-std::array<float,2>{0.276038468f, 0.543338418f},
-std::array<float,2>{0.971736372f, 0.155830011f},
-std::array<float,2>{0.198762998f, 0.350050509f},
-std::array<float,2>{0.637833536f, 0.888858855f},
-std::array<float,2>{0.119923346f, 0.732100368f},
-std::array<float,2>{0.532677829f, 0.0613657199f},
-std::array<float,2>{0.467679977f, 0.404678315f},
-std::array<float,2>{0.867600441f, 0.860617578f},
-std::array<float,2>{0.324881464f, 0.931290388f},
-std::array<float,2>{0.875102401f, 0.327869058f},
-std::array<float,2>{0.162832946f, 0.181840494f},
-std::array<float,2>{0.698087752f, 0.51177597f},
-std::array<float,2>{0.202969208f, 0.796761632f},
-std::array<float,2>{0.636179745f, 0.478593111f},
-std::array<float,2>{0.277440131f, 0.103762992f},
-std::array<float,2>{0.974148571f, 0.649610281f},
-std::array<float,2>{0.409998983f, 0.582313597f},
-std::array<float,2>{0.802907586f, 0.206639558f},
-std::array<float,2>{0.0414270125f, 0.25704816f},
-std::array<float,2>{0.601461828f, 0.986422658f},
-std::array<float,2>{0.125208616f, 0.54779762f},
-std::array<float,2>{0.732262194f, 0.140204251f},
-std::array<float,2>{0.360063881f, 0.369917274f},
-std::array<float,2>{0.925115526f, 0.892456055f},
-std::array<float,2>{0.495283753f, 0.813132524f},
-std::array<float,2>{0.831850529f, 0.409906954f},
-std::array<float,2>{0.0736482739f, 0.0298952833f},
-std::array<float,2>{0.529851437f, 0.715969682f},
-std::array<float,2>{0.00315375556f, 0.945231736f},
-std::array<float,2>{0.568255901f, 0.307349443f},
-std::array<float,2>{0.383071542f, 0.246500835f},
-std::array<float,2>{0.776101828f, 0.612072408f},
-std::array<float,2>{0.288426667f, 0.685637951f},
-std::array<float,2>{0.94184649f, 0.0809350833f},
-std::array<float,2>{0.225405589f, 0.44183141f},
-std::array<float,2>{0.657392442f, 0.751770854f},
-std::array<float,2>{0.0489160568f, 0.599101424f},
-std::array<float,2>{0.610822976f, 0.221881524f},
-std::array<float,2>{0.427849293f, 0.288375348f},
-std::array<float,2>{0.795090914f, 0.962345958f},
-std::array<float,2>{0.259937525f, 0.772886217f},
-std::array<float,2>{0.995289028f, 0.455898315f},
-std::array<float,2>{0.210062593f, 0.0722040683f},
-std::array<float,2>{0.6559515f, 0.668694675f},
-std::array<float,2>{0.174639881f, 0.879176319f},
-std::array<float,2>{0.715321243f, 0.354807377f},
-std::array<float,2>{0.328442276f, 0.142664045f},
-std::array<float,2>{0.899555743f, 0.538265884f},
-std::array<float,2>{0.441148937f, 0.701956809f},
-std::array<float,2>{0.847342372f, 0.00253149145f},
-std::array<float,2>{0.109107003f, 0.434655815f},
-std::array<float,2>{0.552478135f, 0.833021224f},
-std::array<float,2>{0.238118961f, 0.6277529f},
-std::array<float,2>{0.678510427f, 0.12414661f},
-std::array<float,2>{0.303538024f, 0.493338913f},
-std::array<float,2>{0.962459922f, 0.803957999f},
-std::array<float,2>{0.404147476f, 0.972529471f},
-std::array<float,2>{0.750208735f, 0.273034722f},
-std::array<float,2>{0.0272749234f, 0.190738857f},
-std::array<float,2>{0.579834938f, 0.572796464f},
-std::array<float,2>{0.0884948671f, 0.843990624f},
-std::array<float,2>{0.514023066f, 0.390218705f},
-std::array<float,2>{0.47946471f, 0.0417382233f},
-std::array<float,2>{0.817347586f, 0.742156804f},
-std::array<float,2>{0.356364489f, 0.524653971f},
-std::array<float,2>{0.921294689f, 0.166001633f},
-std::array<float,2>{0.151472405f, 0.332839251f},
-std::array<float,2>{0.740524888f, 0.91180408f},
-std::array<float,2>{0.017296087f, 0.658465743f},
-std::array<float,2>{0.588570535f, 0.0630902946f},
-std::array<float,2>{0.394033462f, 0.463620692f},
-std::array<float,2>{0.761919081f, 0.775272727f},
-std::array<float,2>{0.310396194f, 0.959034503f},
-std::array<float,2>{0.959103525f, 0.296022177f},
-std::array<float,2>{0.248172313f, 0.227033854f},
-std::array<float,2>{0.686389565f, 0.608373046f},
-std::array<float,2>{0.147793412f, 0.84021157f},
-std::array<float,2>{0.748272777f, 0.42910409f},
-std::array<float,2>{0.349689156f, 0.0127137713f},
-std::array<float,2>{0.911741436f, 0.692779899f},
-std::array<float,2>{0.472030312f, 0.541761577f},
-std::array<float,2>{0.823775649f, 0.152308673f},
-std::array<float,2>{0.081042625f, 0.346804619f},
-std::array<float,2>{0.506179452f, 0.884785473f},
-std::array<float,2>{0.21488817f, 0.56956166f},
-std::array<float,2>{0.642558038f, 0.200054303f},
-std::array<float,2>{0.255255014f, 0.277180761f},
-std::array<float,2>{0.984695137f, 0.983283877f},
-std::array<float,2>{0.437152267f, 0.807328582f},
-std::array<float,2>{0.784888983f, 0.487869501f},
-std::array<float,2>{0.0590383112f, 0.112228647f},
-std::array<float,2>{0.623072028f, 0.633569658f},
-std::array<float,2>{0.100361794f, 0.915820897f},
-std::array<float,2>{0.557873011f, 0.339798242f},
-std::array<float,2>{0.451221615f, 0.15696007f},
-std::array<float,2>{0.858510852f, 0.519729555f},
-std::array<float,2>{0.336047202f, 0.744273543f},
-std::array<float,2>{0.891973495f, 0.033621572f},
-std::array<float,2>{0.181326672f, 0.376320839f},
-std::array<float,2>{0.710516334f, 0.853079021f},
-std::array<float,2>{0.0651223063f, 0.507726312f},
-std::array<float,2>{0.51705122f, 0.173478037f},
-std::array<float,2>{0.487945199f, 0.317749888f},
-std::array<float,2>{0.838497877f, 0.927999556f},
-std::array<float,2>{0.372906923f, 0.872665703f},
-std::array<float,2>{0.932644188f, 0.392008215f},
-std::array<float,2>{0.139006197f, 0.0477883369f},
-std::array<float,2>{0.722446382f, 0.720053434f},
-std::array<float,2>{0.227635995f, 0.997460663f},
-std::array<float,2>{0.666092455f, 0.262559921f},
-std::array<float,2>{0.293783307f, 0.212339997f},
-std::array<float,2>{0.945692718f, 0.592386067f},
-std::array<float,2>{0.377142251f, 0.646772444f},
-std::array<float,2>{0.773264706f, 0.0983835384f},
-std::array<float,2>{0.00792567991f, 0.475497723f},
-std::array<float,2>{0.571684957f, 0.787491858f},
-std::array<float,2>{0.171090975f, 0.703859806f},
-std::array<float,2>{0.693538785f, 0.0180625543f},
-std::array<float,2>{0.319487005f, 0.417428762f},
-std::array<float,2>{0.887350082f, 0.822085917f},
-std::array<float,2>{0.460886687f, 0.904229045f},
-std::array<float,2>{0.86260277f, 0.366375595f},
-std::array<float,2>{0.112281285f, 0.126552254f},
-std::array<float,2>{0.541487813f, 0.557037115f},
-std::array<float,2>{0.0361781381f, 0.763791084f},
-std::array<float,2>{0.601598382f, 0.452321053f},
-std::array<float,2>{0.414381355f, 0.086047858f},
-std::array<float,2>{0.810028255f, 0.677520096f},
-std::array<float,2>{0.272581041f, 0.620925665f},
-std::array<float,2>{0.980685532f, 0.23738955f},
-std::array<float,2>{0.193793282f, 0.30235979f},
-std::array<float,2>{0.628151119f, 0.947215199f},
-std::array<float,2>{0.0844236761f, 0.652779639f},
-std::array<float,2>{0.500274956f, 0.107235856f},
-std::array<float,2>{0.474746913f, 0.483255744f},
-std::array<float,2>{0.825738907f, 0.792355776f},
-std::array<float,2>{0.346134186f, 0.991691172f},
-std::array<float,2>{0.908643305f, 0.251042157f},
-std::array<float,2>{0.143218473f, 0.209386259f},
-std::array<float,2>{0.743325174f, 0.581811786f},
-std::array<float,2>{0.24306944f, 0.866458833f},
-std::array<float,2>{0.680635154f, 0.399225563f},
-std::array<float,2>{0.306920558f, 0.0580471233f},
-std::array<float,2>{0.953246713f, 0.728524208f},
-std::array<float,2>{0.398192853f, 0.508287191f},
-std::array<float,2>{0.76101613f, 0.185013041f},
-std::array<float,2>{0.0212181453f, 0.321680307f},
-std::array<float,2>{0.593253434f, 0.935296357f},
-std::array<float,2>{0.186622649f, 0.616174579f},
-std::array<float,2>{0.705803096f, 0.244493023f},
-std::array<float,2>{0.340068132f, 0.311384439f},
-std::array<float,2>{0.897963345f, 0.940047324f},
-std::array<float,2>{0.448124945f, 0.75462687f},
-std::array<float,2>{0.853956878f, 0.4376055f},
-std::array<float,2>{0.0961405337f, 0.0838707536f},
-std::array<float,2>{0.558871329f, 0.68286401f},
-std::array<float,2>{0.0580625944f, 0.896316469f},
-std::array<float,2>{0.619937778f, 0.372544736f},
-std::array<float,2>{0.432765096f, 0.136446595f},
-std::array<float,2>{0.785174608f, 0.554414809f},
-std::array<float,2>{0.251063168f, 0.711133897f},
-std::array<float,2>{0.992077053f, 0.0239443071f},
-std::array<float,2>{0.211626783f, 0.413692296f},
-std::array<float,2>{0.64591527f, 0.819262803f},
-std::array<float,2>{0.0147353504f, 0.531316936f},
-std::array<float,2>{0.575828254f, 0.146581814f},
-std::array<float,2>{0.382581949f, 0.358365715f},
-std::array<float,2>{0.766817868f, 0.877833784f},
-std::array<float,2>{0.289660841f, 0.83005774f},
-std::array<float,2>{0.952594817f, 0.432135314f},
-std::array<float,2>{0.231760502f, 0.00589581626f},
-std::array<float,2>{0.66877073f, 0.6955809f},
-std::array<float,2>{0.133693427f, 0.965227842f},
-std::array<float,2>{0.724162877f, 0.28137517f},
-std::array<float,2>{0.371058822f, 0.225348592f},
-std::array<float,2>{0.934152901f, 0.595729947f},
-std::array<float,2>{0.489251167f, 0.667046666f},
-std::array<float,2>{0.84354353f, 0.0766665861f},
-std::array<float,2>{0.0698856115f, 0.4585765f},
-std::array<float,2>{0.519971013f, 0.768149495f},
-std::array<float,2>{0.188608065f, 0.735188425f},
-std::array<float,2>{0.632137358f, 0.0443869196f},
-std::array<float,2>{0.266438991f, 0.386172682f},
-std::array<float,2>{0.980382025f, 0.850950837f},
-std::array<float,2>{0.418164134f, 0.910152793f},
-std::array<float,2>{0.806655943f, 0.331211954f},
-std::array<float,2>{0.0320935212f, 0.168753788f},
-std::array<float,2>{0.608663738f, 0.527433276f},
-std::array<float,2>{0.113511994f, 0.797081053f},
-std::array<float,2>{0.545954823f, 0.49814555f},
-std::array<float,2>{0.456880867f, 0.119417526f},
-std::array<float,2>{0.863333583f, 0.629558921f},
-std::array<float,2>{0.31301567f, 0.575269759f},
-std::array<float,2>{0.885569274f, 0.192478821f},
-std::array<float,2>{0.164783359f, 0.268778265f},
-std::array<float,2>{0.688618958f, 0.975036919f},
-std::array<float,2>{0.0450226068f, 0.690583885f},
-std::array<float,2>{0.595914185f, 0.00798188709f},
-std::array<float,2>{0.411053181f, 0.423847497f},
-std::array<float,2>{0.797294438f, 0.836320877f},
-std::array<float,2>{0.274667859f, 0.890289843f},
-std::array<float,2>{0.969390988f, 0.350718379f},
-std::array<float,2>{0.196247265f, 0.15504244f},
-std::array<float,2>{0.640565753f, 0.544499516f},
-std::array<float,2>{0.15908584f, 0.781045556f},
-std::array<float,2>{0.70171082f, 0.468196332f},
-std::array<float,2>{0.322567254f, 0.0681793317f},
-std::array<float,2>{0.88060683f, 0.662020743f},
-std::array<float,2>{0.462934047f, 0.602045298f},
-std::array<float,2>{0.871600151f, 0.230691716f},
-std::array<float,2>{0.123512551f, 0.29168573f},
-std::array<float,2>{0.538407087f, 0.953142047f},
-std::array<float,2>{0.221264333f, 0.517620504f},
-std::array<float,2>{0.663497686f, 0.162165821f},
-std::array<float,2>{0.281262845f, 0.341284811f},
-std::array<float,2>{0.937874854f, 0.919391572f},
-std::array<float,2>{0.389692873f, 0.855867565f},
-std::array<float,2>{0.781110585f, 0.380204707f},
-std::array<float,2>{0.0053575444f, 0.0377964638f},
-std::array<float,2>{0.56504488f, 0.74808073f},
-std::array<float,2>{0.0748092532f, 0.977773428f},
-std::array<float,2>{0.525216103f, 0.280365139f},
-std::array<float,2>{0.498229533f, 0.195608631f},
-std::array<float,2>{0.832541406f, 0.565484703f},
-std::array<float,2>{0.365109473f, 0.63917315f},
-std::array<float,2>{0.926877201f, 0.115743771f},
-std::array<float,2>{0.130734429f, 0.488897145f},
-std::array<float,2>{0.729249477f, 0.811766863f},
-std::array<float,2>{0.10383261f, 0.588467002f},
-std::array<float,2>{0.548600733f, 0.216424063f},
-std::array<float,2>{0.443206966f, 0.25984174f},
-std::array<float,2>{0.851085424f, 0.994520247f},
-std::array<float,2>{0.332940638f, 0.784336865f},
-std::array<float,2>{0.904588163f, 0.472245634f},
-std::array<float,2>{0.179530904f, 0.0956249014f},
-std::array<float,2>{0.712818384f, 0.641801894f},
-std::array<float,2>{0.204590604f, 0.9257254f},
-std::array<float,2>{0.649084866f, 0.313036412f},
-std::array<float,2>{0.26228705f, 0.177994817f},
-std::array<float,2>{0.996665895f, 0.501905799f},
-std::array<float,2>{0.424039513f, 0.726347744f},
-std::array<float,2>{0.7926687f, 0.0510157347f},
-std::array<float,2>{0.0518494062f, 0.397464901f},
-std::array<float,2>{0.615546703f, 0.871070504f},
-std::array<float,2>{0.154143006f, 0.675503612f},
-std::array<float,2>{0.738227606f, 0.0911634564f},
-std::array<float,2>{0.352154672f, 0.447168708f},
-std::array<float,2>{0.915421486f, 0.759749055f},
-std::array<float,2>{0.481649011f, 0.951531351f},
-std::array<float,2>{0.81473273f, 0.298129469f},
-std::array<float,2>{0.0899595767f, 0.24012816f},
-std::array<float,2>{0.508317828f, 0.624549508f},
-std::array<float,2>{0.0294554122f, 0.826724648f},
-std::array<float,2>{0.582820892f, 0.418936491f},
-std::array<float,2>{0.399599344f, 0.0206384063f},
-std::array<float,2>{0.755294025f, 0.708481669f},
-std::array<float,2>{0.296914697f, 0.560755968f},
-std::array<float,2>{0.966207087f, 0.131054461f},
-std::array<float,2>{0.239681646f, 0.360919535f},
-std::array<float,2>{0.675185978f, 0.898633182f},
-std::array<float,2>{0.0712893456f, 0.717687905f},
-std::array<float,2>{0.52840507f, 0.0285547618f},
-std::array<float,2>{0.493801832f, 0.407645553f},
-std::array<float,2>{0.82932061f, 0.814558089f},
-std::array<float,2>{0.361418545f, 0.893647611f},
-std::array<float,2>{0.923821568f, 0.367334217f},
-std::array<float,2>{0.12768513f, 0.137095124f},
-std::array<float,2>{0.732833207f, 0.54942286f},
-std::array<float,2>{0.223924026f, 0.753040671f},
-std::array<float,2>{0.658317864f, 0.444149584f},
-std::array<float,2>{0.286018014f, 0.0785270706f},
-std::array<float,2>{0.943919063f, 0.683730066f},
-std::array<float,2>{0.385969043f, 0.610573173f},
-std::array<float,2>{0.774646699f, 0.249381393f},
-std::array<float,2>{0.00161906495f, 0.304899096f},
-std::array<float,2>{0.569619894f, 0.942344904f},
-std::array<float,2>{0.161337063f, 0.515047789f},
-std::array<float,2>{0.695960164f, 0.181107044f},
-std::array<float,2>{0.326496542f, 0.324669242f},
-std::array<float,2>{0.878489554f, 0.931863368f},
-std::array<float,2>{0.466101766f, 0.862028778f},
-std::array<float,2>{0.870906055f, 0.403585821f},
-std::array<float,2>{0.118146837f, 0.0594733134f},
-std::array<float,2>{0.53354311f, 0.732840538f},
-std::array<float,2>{0.039078813f, 0.986023128f},
-std::array<float,2>{0.599476159f, 0.254041493f},
-std::array<float,2>{0.407976359f, 0.203767493f},
-std::array<float,2>{0.801460862f, 0.585036159f},
-std::array<float,2>{0.280613691f, 0.651440382f},
-std::array<float,2>{0.974869907f, 0.102997608f},
-std::array<float,2>{0.200377434f, 0.476835608f},
-std::array<float,2>{0.633218646f, 0.793526173f},
-std::array<float,2>{0.0236914437f, 0.571029246f},
-std::array<float,2>{0.581425965f, 0.188046291f},
-std::array<float,2>{0.405117422f, 0.269780248f},
-std::array<float,2>{0.753042936f, 0.969466925f},
-std::array<float,2>{0.301575363f, 0.802009583f},
-std::array<float,2>{0.963030875f, 0.495299667f},
-std::array<float,2>{0.235040978f, 0.121422f},
-std::array<float,2>{0.677559137f, 0.625252664f},
-std::array<float,2>{0.149565741f, 0.912814915f},
-std::array<float,2>{0.739978611f, 0.334991068f},
-std::array<float,2>{0.358475268f, 0.166961178f},
-std::array<float,2>{0.919799209f, 0.52651298f},
-std::array<float,2>{0.478046387f, 0.740014255f},
-std::array<float,2>{0.819221556f, 0.0409163535f},
-std::array<float,2>{0.086772576f, 0.3885988f},
-std::array<float,2>{0.512776971f, 0.846636355f},
-std::array<float,2>{0.20889008f, 0.671617448f},
-std::array<float,2>{0.65411216f, 0.0725904852f},
-std::array<float,2>{0.258492976f, 0.453560472f},
-std::array<float,2>{0.993039012f, 0.769794166f},
-std::array<float,2>{0.427662998f, 0.963678002f},
-std::array<float,2>{0.794090867f, 0.285413176f},
-std::array<float,2>{0.047876738f, 0.218922079f},
-std::array<float,2>{0.611530602f, 0.601554275f},
-std::array<float,2>{0.107399106f, 0.834380686f},
-std::array<float,2>{0.553408921f, 0.436724186f},
-std::array<float,2>{0.439025044f, 0.00172669243f},
-std::array<float,2>{0.845329821f, 0.700106859f},
-std::array<float,2>{0.331493378f, 0.536147058f},
-std::array<float,2>{0.901153505f, 0.141543478f},
-std::array<float,2>{0.172070146f, 0.352663159f},
-std::array<float,2>{0.717177451f, 0.882625699f},
-std::array<float,2>{0.0613258332f, 0.635479748f},
-std::array<float,2>{0.621477902f, 0.109867401f},
-std::array<float,2>{0.433743387f, 0.484727263f},
-std::array<float,2>{0.781395078f, 0.804732442f},
-std::array<float,2>{0.255922854f, 0.980807006f},
-std::array<float,2>{0.986889303f, 0.274689645f},
-std::array<float,2>{0.217528686f, 0.201841816f},
-std::array<float,2>{0.644069195f, 0.567547917f},
-std::array<float,2>{0.182266518f, 0.855298042f},
-std::array<float,2>{0.708400011f, 0.377870351f},
-std::array<float,2>{0.338331848f, 0.0315346047f},
-std::array<float,2>{0.893035948f, 0.742630959f},
-std::array<float,2>{0.449904829f, 0.522022903f},
-std::array<float,2>{0.855604112f, 0.159186453f},
-std::array<float,2>{0.097810775f, 0.33774063f},
-std::array<float,2>{0.555085778f, 0.917400002f},
-std::array<float,2>{0.247902155f, 0.605759859f},
-std::array<float,2>{0.684455097f, 0.229670733f},
-std::array<float,2>{0.311396897f, 0.294766337f},
-std::array<float,2>{0.95778352f, 0.958954334f},
-std::array<float,2>{0.390873253f, 0.776046216f},
-std::array<float,2>{0.763754964f, 0.462797493f},
-std::array<float,2>{0.0188362598f, 0.0659236461f},
-std::array<float,2>{0.586367786f, 0.656269848f},
-std::array<float,2>{0.0796247646f, 0.883935332f},
-std::array<float,2>{0.505492091f, 0.343909591f},
-std::array<float,2>{0.469043642f, 0.149008691f},
-std::array<float,2>{0.820597649f, 0.540495336f},
-std::array<float,2>{0.349448651f, 0.695181251f},
-std::array<float,2>{0.913145959f, 0.0141822025f},
-std::array<float,2>{0.145452276f, 0.42760703f},
-std::array<float,2>{0.747995734f, 0.842132151f},
-std::array<float,2>{0.11127951f, 0.555929184f},
-std::array<float,2>{0.540384352f, 0.128651828f},
-std::array<float,2>{0.458829552f, 0.36428079f},
-std::array<float,2>{0.86104548f, 0.905926883f},
-std::array<float,2>{0.31760323f, 0.82283169f},
-std::array<float,2>{0.890372097f, 0.414214224f},
-std::array<float,2>{0.1693497f, 0.0165575519f},
-std::array<float,2>{0.692956805f, 0.705606461f},
-std::array<float,2>{0.193021297f, 0.948843956f},
-std::array<float,2>{0.625020206f, 0.303238451f},
-std::array<float,2>{0.271053731f, 0.235241383f},
-std::array<float,2>{0.983062565f, 0.618552327f},
-std::array<float,2>{0.416565597f, 0.679289818f},
-std::array<float,2>{0.812068105f, 0.0887867883f},
-std::array<float,2>{0.037861187f, 0.451012701f},
-std::array<float,2>{0.604656279f, 0.762555301f},
-std::array<float,2>{0.137755826f, 0.721421003f},
-std::array<float,2>{0.720468402f, 0.0491450578f},
-std::array<float,2>{0.373991251f, 0.393750191f},
-std::array<float,2>{0.931531549f, 0.873913467f},
-std::array<float,2>{0.486275464f, 0.926496804f},
-std::array<float,2>{0.836193979f, 0.319710553f},
-std::array<float,2>{0.0633901358f, 0.175378099f},
-std::array<float,2>{0.51763761f, 0.505458772f},
-std::array<float,2>{0.0114429854f, 0.785528004f},
-std::array<float,2>{0.572521508f, 0.473772675f},
-std::array<float,2>{0.376201987f, 0.101511203f},
-std::array<float,2>{0.770517111f, 0.644943058f},
-std::array<float,2>{0.296131879f, 0.591475964f},
-std::array<float,2>{0.948522151f, 0.214212611f},
-std::array<float,2>{0.229077235f, 0.26504463f},
-std::array<float,2>{0.664573193f, 0.998698592f},
-std::array<float,2>{0.0955787376f, 0.679929018f},
-std::array<float,2>{0.560891688f, 0.0841439739f},
-std::array<float,2>{0.44642967f, 0.440240026f},
-std::array<float,2>{0.853408694f, 0.756726682f},
-std::array<float,2>{0.34300822f, 0.938130021f},
-std::array<float,2>{0.894763529f, 0.308998942f},
-std::array<float,2>{0.184844017f, 0.242715344f},
-std::array<float,2>{0.70349443f, 0.61475718f},
-std::array<float,2>{0.21301879f, 0.817905247f},
-std::array<float,2>{0.647185743f, 0.411200106f},
-std::array<float,2>{0.25361526f, 0.0267760903f},
-std::array<float,2>{0.989435434f, 0.712986767f},
-std::array<float,2>{0.431216866f, 0.551098704f},
-std::array<float,2>{0.788722634f, 0.133077875f},
-std::array<float,2>{0.0558764711f, 0.374787658f},
-std::array<float,2>{0.61869204f, 0.898228824f},
-std::array<float,2>{0.141183436f, 0.578541398f},
-std::array<float,2>{0.745613515f, 0.207630187f},
-std::array<float,2>{0.34561345f, 0.253352791f},
-std::array<float,2>{0.906403303f, 0.988646746f},
-std::array<float,2>{0.47275731f, 0.790250778f},
-std::array<float,2>{0.826636314f, 0.481599122f},
-std::array<float,2>{0.0833551213f, 0.108965844f},
-std::array<float,2>{0.502944648f, 0.654408574f},
-std::array<float,2>{0.0215390157f, 0.935796142f},
-std::array<float,2>{0.590985954f, 0.322619617f},
-std::array<float,2>{0.395064294f, 0.187385187f},
-std::array<float,2>{0.759186983f, 0.509805739f},
-std::array<float,2>{0.305197448f, 0.728223085f},
-std::array<float,2>{0.956620932f, 0.0547433794f},
-std::array<float,2>{0.245697066f, 0.40137729f},
-std::array<float,2>{0.682058513f, 0.864181936f},
-std::array<float,2>{0.0333495438f, 0.53075999f},
-std::array<float,2>{0.606417835f, 0.170424104f},
-std::array<float,2>{0.421404302f, 0.32991451f},
-std::array<float,2>{0.806600332f, 0.90691334f},
-std::array<float,2>{0.268875986f, 0.849366546f},
-std::array<float,2>{0.977892339f, 0.38350749f},
-std::array<float,2>{0.190579683f, 0.04639557f},
-std::array<float,2>{0.630022168f, 0.737285852f},
-std::array<float,2>{0.167879745f, 0.97397393f},
-std::array<float,2>{0.690320611f, 0.266144305f},
-std::array<float,2>{0.315490305f, 0.194545016f},
-std::array<float,2>{0.883862317f, 0.57703805f},
-std::array<float,2>{0.4539406f, 0.632325351f},
-std::array<float,2>{0.86630857f, 0.118414752f},
-std::array<float,2>{0.116914965f, 0.497830331f},
-std::array<float,2>{0.544338405f, 0.799627542f},
-std::array<float,2>{0.233156011f, 0.698135078f},
-std::array<float,2>{0.670898914f, 0.00421102019f},
-std::array<float,2>{0.291718006f, 0.431090683f},
-std::array<float,2>{0.950019479f, 0.831986725f},
-std::array<float,2>{0.379767507f, 0.876838923f},
-std::array<float,2>{0.769058466f, 0.357260585f},
-std::array<float,2>{0.0118342694f, 0.145313039f},
-std::array<float,2>{0.577896237f, 0.535078168f},
-std::array<float,2>{0.0670950115f, 0.766267359f},
-std::array<float,2>{0.52327621f, 0.45967719f},
-std::array<float,2>{0.491175979f, 0.0753834173f},
-std::array<float,2>{0.84029907f, 0.664630771f},
-std::array<float,2>{0.368390799f, 0.59520489f},
-std::array<float,2>{0.935806692f, 0.224477515f},
-std::array<float,2>{0.136207581f, 0.284063488f},
-std::array<float,2>{0.725784421f, 0.967747748f},
-std::array<float,2>{0.00779328449f, 0.747478664f},
-std::array<float,2>{0.562985301f, 0.0366991311f},
-std::array<float,2>{0.388215989f, 0.381793231f},
-std::array<float,2>{0.777805328f, 0.857546747f},
-std::array<float,2>{0.283617228f, 0.921543956f},
-std::array<float,2>{0.940998971f, 0.34287852f},
-std::array<float,2>{0.220106393f, 0.160587668f},
-std::array<float,2>{0.662017286f, 0.516198277f},
-std::array<float,2>{0.131176218f, 0.810370982f},
-std::array<float,2>{0.728304684f, 0.490631104f},
-std::array<float,2>{0.366156012f, 0.114040114f},
-std::array<float,2>{0.929606497f, 0.638113618f},
-std::array<float,2>{0.497610807f, 0.563753128f},
-std::array<float,2>{0.834396303f, 0.198237985f},
-std::array<float,2>{0.0779801905f, 0.279245436f},
-std::array<float,2>{0.526192069f, 0.979686379f},
-std::array<float,2>{0.197807372f, 0.546498954f},
-std::array<float,2>{0.637416482f, 0.152381316f},
-std::array<float,2>{0.276884794f, 0.348148912f},
-std::array<float,2>{0.971217453f, 0.887579024f},
-std::array<float,2>{0.413240075f, 0.838499188f},
-std::array<float,2>{0.799439132f, 0.422129154f},
-std::array<float,2>{0.0437138267f, 0.00980015565f},
-std::array<float,2>{0.594032288f, 0.689325273f},
-std::array<float,2>{0.122179456f, 0.95599395f},
-std::array<float,2>{0.535863638f, 0.289701313f},
-std::array<float,2>{0.461771011f, 0.234038308f},
-std::array<float,2>{0.873679578f, 0.604831398f},
-std::array<float,2>{0.321674645f, 0.662916183f},
-std::array<float,2>{0.882480025f, 0.0684050992f},
-std::array<float,2>{0.157019407f, 0.465134025f},
-std::array<float,2>{0.699983895f, 0.777658105f},
-std::array<float,2>{0.0925306678f, 0.622259855f},
-std::array<float,2>{0.51019603f, 0.240605786f},
-std::array<float,2>{0.482740521f, 0.299099624f},
-std::array<float,2>{0.814205945f, 0.949450612f},
-std::array<float,2>{0.355387986f, 0.761148572f},
-std::array<float,2>{0.917244971f, 0.448928446f},
-std::array<float,2>{0.154565737f, 0.0924398303f},
-std::array<float,2>{0.736137271f, 0.671991169f},
-std::array<float,2>{0.241453975f, 0.90210706f},
-std::array<float,2>{0.673389971f, 0.362617582f},
-std::array<float,2>{0.300678968f, 0.129171193f},
-std::array<float,2>{0.967908502f, 0.560491264f},
-std::array<float,2>{0.402168274f, 0.710087895f},
-std::array<float,2>{0.756153524f, 0.0221272428f},
-std::array<float,2>{0.0290309377f, 0.420967817f},
-std::array<float,2>{0.585276484f, 0.824356973f},
-std::array<float,2>{0.176238641f, 0.644171417f},
-std::array<float,2>{0.713383317f, 0.096158728f},
-std::array<float,2>{0.334704638f, 0.469459713f},
-std::array<float,2>{0.902590692f, 0.782104254f},
-std::array<float,2>{0.443424523f, 0.992920518f},
-std::array<float,2>{0.84795773f, 0.25900656f},
-std::array<float,2>{0.102065399f, 0.217936307f},
-std::array<float,2>{0.549871981f, 0.586069524f},
-std::array<float,2>{0.052763354f, 0.867674172f},
-std::array<float,2>{0.613738716f, 0.395433843f},
-std::array<float,2>{0.423130631f, 0.0530461818f},
-std::array<float,2>{0.789898574f, 0.722824454f},
-std::array<float,2>{0.265187532f, 0.503279746f},
-std::array<float,2>{0.999121964f, 0.177046627f},
-std::array<float,2>{0.206386283f, 0.315623552f},
-std::array<float,2>{0.651455939f, 0.922210813f},
-std::array<float,2>{0.123119339f, 0.688463688f},
-std::array<float,2>{0.538205862f, 0.011305307f},
-std::array<float,2>{0.463217854f, 0.423197031f},
-std::array<float,2>{0.872013628f, 0.839649796f},
-std::array<float,2>{0.322434366f, 0.88828516f},
-std::array<float,2>{0.880652845f, 0.349329382f},
-std::array<float,2>{0.158747792f, 0.153501004f},
-std::array<float,2>{0.702025294f, 0.545719802f},
-std::array<float,2>{0.195919558f, 0.778785825f},
-std::array<float,2>{0.640304267f, 0.466185033f},
-std::array<float,2>{0.274654061f, 0.069725208f},
-std::array<float,2>{0.969587684f, 0.663302302f},
-std::array<float,2>{0.41086328f, 0.604177833f},
-std::array<float,2>{0.797098756f, 0.232769474f},
-std::array<float,2>{0.0452999733f, 0.290428609f},
-std::array<float,2>{0.595990539f, 0.95695442f},
-std::array<float,2>{0.130391806f, 0.517571628f},
-std::array<float,2>{0.729118645f, 0.16117923f},
-std::array<float,2>{0.364874691f, 0.342443645f},
-std::array<float,2>{0.927163422f, 0.920827746f},
-std::array<float,2>{0.498332232f, 0.858798683f},
-std::array<float,2>{0.832783222f, 0.381984204f},
-std::array<float,2>{0.0749863237f, 0.0357956253f},
-std::array<float,2>{0.525010228f, 0.746760845f},
-std::array<float,2>{0.00490404433f, 0.97923696f},
-std::array<float,2>{0.565294981f, 0.277781814f},
-std::array<float,2>{0.389982313f, 0.198785976f},
-std::array<float,2>{0.780919909f, 0.563349843f},
-std::array<float,2>{0.281654567f, 0.636936843f},
-std::array<float,2>{0.937505603f, 0.114867434f},
-std::array<float,2>{0.221458703f, 0.491867512f},
-std::array<float,2>{0.663273335f, 0.809004128f},
-std::array<float,2>{0.0520494133f, 0.587160885f},
-std::array<float,2>{0.61546278f, 0.217689633f},
-std::array<float,2>{0.424189895f, 0.257812947f},
-std::array<float,2>{0.792912722f, 0.993316054f},
-std::array<float,2>{0.262519091f, 0.78257519f},
-std::array<float,2>{0.996892452f, 0.470381677f},
-std::array<float,2>{0.205043942f, 0.097259298f},
-std::array<float,2>{0.649329841f, 0.642881453f},
-std::array<float,2>{0.179303214f, 0.92285794f},
-std::array<float,2>{0.712432027f, 0.314958036f},
-std::array<float,2>{0.332598299f, 0.17610462f},
-std::array<float,2>{0.90448916f, 0.502743483f},
-std::array<float,2>{0.44305262f, 0.724462628f},
-std::array<float,2>{0.851502836f, 0.0542272702f},
-std::array<float,2>{0.103732139f, 0.396096706f},
-std::array<float,2>{0.54839313f, 0.868416369f},
-std::array<float,2>{0.239339605f, 0.673164427f},
-std::array<float,2>{0.674939513f, 0.0935442969f},
-std::array<float,2>{0.297294289f, 0.448163807f},
-std::array<float,2>{0.96584028f, 0.759766996f},
-std::array<float,2>{0.399851143f, 0.951115191f},
-std::array<float,2>{0.75512141f, 0.300315201f},
-std::array<float,2>{0.0297310054f, 0.241831183f},
-std::array<float,2>{0.582673073f, 0.621737599f},
-std::array<float,2>{0.0901519954f, 0.826090932f},
-std::array<float,2>{0.508651257f, 0.420001417f},
-std::array<float,2>{0.481926382f, 0.0231456999f},
-std::array<float,2>{0.814492643f, 0.70991528f},
-std::array<float,2>{0.352356285f, 0.559013069f},
-std::array<float,2>{0.915076554f, 0.130223602f},
-std::array<float,2>{0.153824344f, 0.361584663f},
-std::array<float,2>{0.737817109f, 0.900996089f},
-std::array<float,2>{0.0212884601f, 0.656244636f},
-std::array<float,2>{0.592897773f, 0.108391225f},
-std::array<float,2>{0.39836511f, 0.480937153f},
-std::array<float,2>{0.760939658f, 0.789169729f},
-std::array<float,2>{0.306814462f, 0.989440262f},
-std::array<float,2>{0.953507781f, 0.252891332f},
-std::array<float,2>{0.242718205f, 0.208780691f},
-std::array<float,2>{0.680286229f, 0.579561651f},
-std::array<float,2>{0.143378943f, 0.864965916f},
-std::array<float,2>{0.74349606f, 0.40122816f},
-std::array<float,2>{0.345877796f, 0.0556861646f},
-std::array<float,2>{0.908423007f, 0.72710216f},
-std::array<float,2>{0.475039274f, 0.510929406f},
-std::array<float,2>{0.826100588f, 0.186447084f},
-std::array<float,2>{0.0842121691f, 0.323599905f},
-std::array<float,2>{0.50023061f, 0.937004328f},
-std::array<float,2>{0.211806372f, 0.613955677f},
-std::array<float,2>{0.645668387f, 0.243958339f},
-std::array<float,2>{0.251355022f, 0.310012579f},
-std::array<float,2>{0.991891384f, 0.939448774f},
-std::array<float,2>{0.432899415f, 0.757002592f},
-std::array<float,2>{0.785616934f, 0.44052279f},
-std::array<float,2>{0.0576414987f, 0.0855818465f},
-std::array<float,2>{0.619722128f, 0.680759192f},
-std::array<float,2>{0.0958727226f, 0.896563649f},
-std::array<float,2>{0.558804333f, 0.373663157f},
-std::array<float,2>{0.447839797f, 0.133893356f},
-std::array<float,2>{0.853574276f, 0.552463591f},
-std::array<float,2>{0.340141088f, 0.714404047f},
-std::array<float,2>{0.898234427f, 0.0262661148f},
-std::array<float,2>{0.186853588f, 0.411079466f},
-std::array<float,2>{0.705887198f, 0.817206621f},
-std::array<float,2>{0.070131138f, 0.533880115f},
-std::array<float,2>{0.519569099f, 0.146402493f},
-std::array<float,2>{0.488794088f, 0.356360286f},
-std::array<float,2>{0.843500674f, 0.875261724f},
-std::array<float,2>{0.370680004f, 0.830550313f},
-std::array<float,2>{0.93454653f, 0.430608869f},
-std::array<float,2>{0.133473724f, 0.00518419454f},
-std::array<float,2>{0.724392474f, 0.698864877f},
-std::array<float,2>{0.231680244f, 0.968526006f},
-std::array<float,2>{0.668605566f, 0.284760565f},
-std::array<float,2>{0.290004611f, 0.222701252f},
-std::array<float,2>{0.952369809f, 0.594637752f},
-std::array<float,2>{0.382522464f, 0.665888369f},
-std::array<float,2>{0.767062902f, 0.0750891417f},
-std::array<float,2>{0.0150080174f, 0.460720152f},
-std::array<float,2>{0.576108277f, 0.766842902f},
-std::array<float,2>{0.164954752f, 0.738220751f},
-std::array<float,2>{0.688767612f, 0.0449567288f},
-std::array<float,2>{0.313468844f, 0.383976579f},
-std::array<float,2>{0.885264218f, 0.848362684f},
-std::array<float,2>{0.456548721f, 0.907280266f},
-std::array<float,2>{0.863691151f, 0.328558475f},
-std::array<float,2>{0.11375621f, 0.171634465f},
-std::array<float,2>{0.54618752f, 0.529811263f},
-std::array<float,2>{0.0318626724f, 0.799890101f},
-std::array<float,2>{0.608598888f, 0.496702373f},
-std::array<float,2>{0.418214172f, 0.117537282f},
-std::array<float,2>{0.806904376f, 0.631349146f},
-std::array<float,2>{0.266184866f, 0.57756114f},
-std::array<float,2>{0.980101049f, 0.193701982f},
-std::array<float,2>{0.188763499f, 0.267449588f},
-std::array<float,2>{0.631937385f, 0.972832561f},
-std::array<float,2>{0.0807145312f, 0.657725871f},
-std::array<float,2>{0.50607115f, 0.0648067743f},
-std::array<float,2>{0.471829206f, 0.461360872f},
-std::array<float,2>{0.824167848f, 0.777001321f},
-std::array<float,2>{0.349918485f, 0.957640827f},
-std::array<float,2>{0.911873221f, 0.293089956f},
-std::array<float,2>{0.147595063f, 0.228713721f},
-std::array<float,2>{0.748486936f, 0.606958032f},
-std::array<float,2>{0.248319298f, 0.843372524f},
-std::array<float,2>{0.68617475f, 0.426510751f},
-std::array<float,2>{0.310150504f, 0.0149100451f},
-std::array<float,2>{0.959401906f, 0.694240749f},
-std::array<float,2>{0.393638968f, 0.539956629f},
-std::array<float,2>{0.761964738f, 0.150115296f},
-std::array<float,2>{0.0175502114f, 0.345538884f},
-std::array<float,2>{0.588805795f, 0.883042276f},
-std::array<float,2>{0.181495145f, 0.567005634f},
-std::array<float,2>{0.710898221f, 0.202899739f},
-std::array<float,2>{0.336418718f, 0.273923069f},
-std::array<float,2>{0.891789198f, 0.98163408f},
-std::array<float,2>{0.451446056f, 0.80596137f},
-std::array<float,2>{0.858730495f, 0.486295968f},
-std::array<float,2>{0.100150123f, 0.111133724f},
-std::array<float,2>{0.557771325f, 0.636293709f},
-std::array<float,2>{0.0587696694f, 0.916469634f},
-std::array<float,2>{0.623395443f, 0.336528927f},
-std::array<float,2>{0.437360108f, 0.158220708f},
-std::array<float,2>{0.784966707f, 0.523333013f},
-std::array<float,2>{0.254919142f, 0.743331194f},
-std::array<float,2>{0.984527469f, 0.0324462466f},
-std::array<float,2>{0.215223968f, 0.378905535f},
-std::array<float,2>{0.642113686f, 0.853823841f},
-std::array<float,2>{0.00818821508f, 0.504387259f},
-std::array<float,2>{0.571362972f, 0.174122766f},
-std::array<float,2>{0.377420425f, 0.318659514f},
-std::array<float,2>{0.773004234f, 0.926881969f},
-std::array<float,2>{0.293567032f, 0.874230325f},
-std::array<float,2>{0.945338786f, 0.393400729f},
-std::array<float,2>{0.227860063f, 0.050328169f},
-std::array<float,2>{0.666491807f, 0.722318649f},
-std::array<float,2>{0.138700843f, 0.999635935f},
-std::array<float,2>{0.722271621f, 0.263943255f},
-std::array<float,2>{0.372742444f, 0.213308215f},
-std::array<float,2>{0.933101356f, 0.590699971f},
-std::array<float,2>{0.488265604f, 0.645762801f},
-std::array<float,2>{0.838683844f, 0.0999589264f},
-std::array<float,2>{0.0652065277f, 0.473377883f},
-std::array<float,2>{0.516813815f, 0.786620975f},
-std::array<float,2>{0.193579897f, 0.706260681f},
-std::array<float,2>{0.628324091f, 0.0168568213f},
-std::array<float,2>{0.27271226f, 0.415791005f},
-std::array<float,2>{0.980767906f, 0.823521018f},
-std::array<float,2>{0.414137602f, 0.904795408f},
-std::array<float,2>{0.809780002f, 0.364049584f},
-std::array<float,2>{0.0366013572f, 0.127689376f},
-std::array<float,2>{0.601964414f, 0.555211127f},
-std::array<float,2>{0.111837707f, 0.763334692f},
-std::array<float,2>{0.541230202f, 0.450081438f},
-std::array<float,2>{0.460546255f, 0.0896285772f},
-std::array<float,2>{0.862334192f, 0.677828908f},
-std::array<float,2>{0.319804251f, 0.617885351f},
-std::array<float,2>{0.887475133f, 0.236241877f},
-std::array<float,2>{0.171322167f, 0.304102898f},
-std::array<float,2>{0.693654418f, 0.947508216f},
-std::array<float,2>{0.0410685018f, 0.734000087f},
-std::array<float,2>{0.601168036f, 0.0596498773f},
-std::array<float,2>{0.409833014f, 0.403293461f},
-std::array<float,2>{0.803051591f, 0.86256057f},
-std::array<float,2>{0.277764797f, 0.933208704f},
-std::array<float,2>{0.974508524f, 0.325545579f},
-std::array<float,2>{0.202797443f, 0.180023775f},
-std::array<float,2>{0.635926902f, 0.514187992f},
-std::array<float,2>{0.162842512f, 0.794575036f},
-std::array<float,2>{0.697789609f, 0.477922589f},
-std::array<float,2>{0.324988365f, 0.102507822f},
-std::array<float,2>{0.875462055f, 0.651325703f},
-std::array<float,2>{0.467434227f, 0.584389567f},
-std::array<float,2>{0.867213726f, 0.20434688f},
-std::array<float,2>{0.119841956f, 0.255835921f},
-std::array<float,2>{0.53239435f, 0.984978795f},
-std::array<float,2>{0.225141957f, 0.550293684f},
-std::array<float,2>{0.657706261f, 0.138175309f},
-std::array<float,2>{0.288205653f, 0.368749052f},
-std::array<float,2>{0.941516638f, 0.892805815f},
-std::array<float,2>{0.382819295f, 0.815649629f},
-std::array<float,2>{0.776227117f, 0.406319618f},
-std::array<float,2>{0.00333893113f, 0.0274919141f},
-std::array<float,2>{0.567899406f, 0.717901766f},
-std::array<float,2>{0.073323667f, 0.942755342f},
-std::array<float,2>{0.530078769f, 0.305702299f},
-std::array<float,2>{0.495365471f, 0.248916879f},
-std::array<float,2>{0.831775486f, 0.60947758f},
-std::array<float,2>{0.360203683f, 0.684913278f},
-std::array<float,2>{0.925029397f, 0.0796597451f},
-std::array<float,2>{0.125295773f, 0.445187598f},
-std::array<float,2>{0.732006133f, 0.752145112f},
-std::array<float,2>{0.109159954f, 0.600010931f},
-std::array<float,2>{0.552532256f, 0.220348522f},
-std::array<float,2>{0.441220045f, 0.286182404f},
-std::array<float,2>{0.847444773f, 0.964317262f},
-std::array<float,2>{0.328336656f, 0.771326482f},
-std::array<float,2>{0.899859369f, 0.454432756f},
-std::array<float,2>{0.174449027f, 0.0736849904f},
-std::array<float,2>{0.715008557f, 0.67012167f},
-std::array<float,2>{0.210394979f, 0.881795347f},
-std::array<float,2>{0.656181097f, 0.352179617f},
-std::array<float,2>{0.260036439f, 0.141773269f},
-std::array<float,2>{0.995364964f, 0.535453498f},
-std::array<float,2>{0.428010792f, 0.700583398f},
-std::array<float,2>{0.795339286f, 1.08116119e-05f},
-std::array<float,2>{0.0491504297f, 0.435687751f},
-std::array<float,2>{0.61059469f, 0.835306585f},
-std::array<float,2>{0.151673019f, 0.626485646f},
-std::array<float,2>{0.740276635f, 0.122186184f},
-std::array<float,2>{0.356042266f, 0.49437651f},
-std::array<float,2>{0.921055436f, 0.801477551f},
-std::array<float,2>{0.479124129f, 0.970258474f},
-std::array<float,2>{0.817009449f, 0.270817548f},
-std::array<float,2>{0.0887638405f, 0.189304933f},
-std::array<float,2>{0.513789117f, 0.571586609f},
-std::array<float,2>{0.0268939715f, 0.84730792f},
-std::array<float,2>{0.57983315f, 0.386755139f},
-std::array<float,2>{0.403908283f, 0.0398184769f},
-std::array<float,2>{0.750323355f, 0.738349199f},
-std::array<float,2>{0.303260386f, 0.526280999f},
-std::array<float,2>{0.962854803f, 0.167929068f},
-std::array<float,2>{0.237816051f, 0.333986521f},
-std::array<float,2>{0.678239644f, 0.913872898f},
-std::array<float,2>{0.0778675452f, 0.74987483f},
-std::array<float,2>{0.525966883f, 0.0384352617f},
-std::array<float,2>{0.497937918f, 0.378965199f},
-std::array<float,2>{0.834096789f, 0.856975675f},
-std::array<float,2>{0.365780175f, 0.918579221f},
-std::array<float,2>{0.929406226f, 0.340188563f},
-std::array<float,2>{0.130972773f, 0.163762853f},
-std::array<float,2>{0.728191555f, 0.519327879f},
-std::array<float,2>{0.21990703f, 0.811100602f},
-std::array<float,2>{0.661660492f, 0.489829868f},
-std::array<float,2>{0.283296883f, 0.116546594f},
-std::array<float,2>{0.941282988f, 0.640057981f},
-std::array<float,2>{0.388483316f, 0.565061927f},
-std::array<float,2>{0.777355671f, 0.197241142f},
-std::array<float,2>{0.00735106599f, 0.28016749f},
-std::array<float,2>{0.562664688f, 0.97723484f},
-std::array<float,2>{0.156849772f, 0.543939948f},
-std::array<float,2>{0.699771881f, 0.155438334f},
-std::array<float,2>{0.321424276f, 0.350434631f},
-std::array<float,2>{0.88270545f, 0.889592409f},
-std::array<float,2>{0.461543083f, 0.837828338f},
-std::array<float,2>{0.873864055f, 0.425076365f},
-std::array<float,2>{0.122499548f, 0.00957351457f},
-std::array<float,2>{0.53610146f, 0.690392137f},
-std::array<float,2>{0.0435579866f, 0.954889953f},
-std::array<float,2>{0.593909562f, 0.292035908f},
-std::array<float,2>{0.413548946f, 0.231577292f},
-std::array<float,2>{0.79959923f, 0.60263449f},
-std::array<float,2>{0.277146429f, 0.660533786f},
-std::array<float,2>{0.971536934f, 0.0671607852f},
-std::array<float,2>{0.198123291f, 0.46753636f},
-std::array<float,2>{0.637596726f, 0.779902279f},
-std::array<float,2>{0.0291214567f, 0.623832583f},
-std::array<float,2>{0.584981203f, 0.238446414f},
-std::array<float,2>{0.401954144f, 0.297176063f},
-std::array<float,2>{0.755930305f, 0.952753246f},
-std::array<float,2>{0.300331146f, 0.758139014f},
-std::array<float,2>{0.968153715f, 0.445939869f},
-std::array<float,2>{0.24169901f, 0.0905818045f},
-std::array<float,2>{0.673709095f, 0.673831999f},
-std::array<float,2>{0.154384986f, 0.89954257f},
-std::array<float,2>{0.73606658f, 0.360055566f},
-std::array<float,2>{0.355149537f, 0.13271381f},
-std::array<float,2>{0.917030156f, 0.561735392f},
-std::array<float,2>{0.482533425f, 0.707161725f},
-std::array<float,2>{0.814237297f, 0.0199514721f},
-std::array<float,2>{0.0923679173f, 0.419158816f},
-std::array<float,2>{0.509860635f, 0.827753723f},
-std::array<float,2>{0.206170276f, 0.6415658f},
-std::array<float,2>{0.651655316f, 0.0946617872f},
-std::array<float,2>{0.265391648f, 0.471579552f},
-std::array<float,2>{0.999492645f, 0.783770442f},
-std::array<float,2>{0.422961324f, 0.995986879f},
-std::array<float,2>{0.789658248f, 0.261240989f},
-std::array<float,2>{0.0530227609f, 0.215703711f},
-std::array<float,2>{0.613363624f, 0.588926673f},
-std::array<float,2>{0.102522314f, 0.869667292f},
-std::array<float,2>{0.550160348f, 0.396680981f},
-std::array<float,2>{0.443690538f, 0.0521439202f},
-std::array<float,2>{0.847682595f, 0.725582004f},
-std::array<float,2>{0.334931791f, 0.500802279f},
-std::array<float,2>{0.902358174f, 0.17914331f},
-std::array<float,2>{0.175940692f, 0.313582271f},
-std::array<float,2>{0.713748932f, 0.924178541f},
-std::array<float,2>{0.0560456589f, 0.682540178f},
-std::array<float,2>{0.618911207f, 0.0826741755f},
-std::array<float,2>{0.431479543f, 0.438847125f},
-std::array<float,2>{0.789048672f, 0.755335391f},
-std::array<float,2>{0.25382039f, 0.940927625f},
-std::array<float,2>{0.989734828f, 0.312093586f},
-std::array<float,2>{0.213266283f, 0.245155647f},
-std::array<float,2>{0.647352874f, 0.616924167f},
-std::array<float,2>{0.184634492f, 0.820227265f},
-std::array<float,2>{0.703293979f, 0.41293022f},
-std::array<float,2>{0.343245149f, 0.0245237499f},
-std::array<float,2>{0.894892931f, 0.712607026f},
-std::array<float,2>{0.446691006f, 0.552810967f},
-std::array<float,2>{0.853248596f, 0.1347882f},
-std::array<float,2>{0.0954291821f, 0.371171445f},
-std::array<float,2>{0.560549259f, 0.894764423f},
-std::array<float,2>{0.245980695f, 0.580430448f},
-std::array<float,2>{0.681812406f, 0.210102499f},
-std::array<float,2>{0.305633605f, 0.250554532f},
-std::array<float,2>{0.956879675f, 0.990306437f},
-std::array<float,2>{0.395352423f, 0.791965127f},
-std::array<float,2>{0.759010732f, 0.48409918f},
-std::array<float,2>{0.0218163542f, 0.105826847f},
-std::array<float,2>{0.591101408f, 0.653754532f},
-std::array<float,2>{0.0831795558f, 0.934203029f},
-std::array<float,2>{0.503345668f, 0.321226239f},
-std::array<float,2>{0.472999036f, 0.184133247f},
-std::array<float,2>{0.826400995f, 0.508948565f},
-std::array<float,2>{0.345252872f, 0.730385423f},
-std::array<float,2>{0.906582594f, 0.0569106676f},
-std::array<float,2>{0.141558811f, 0.399572372f},
-std::array<float,2>{0.746043086f, 0.865770221f},
-std::array<float,2>{0.117088042f, 0.528902054f},
-std::array<float,2>{0.54398936f, 0.169089064f},
-std::array<float,2>{0.453734994f, 0.330924302f},
-std::array<float,2>{0.866587996f, 0.908219278f},
-std::array<float,2>{0.315851808f, 0.849666417f},
-std::array<float,2>{0.88405627f, 0.385263354f},
-std::array<float,2>{0.167681187f, 0.0437759534f},
-std::array<float,2>{0.690151095f, 0.735386074f},
-std::array<float,2>{0.190727264f, 0.975734174f},
-std::array<float,2>{0.630189359f, 0.268328846f},
-std::array<float,2>{0.268750548f, 0.191794813f},
-std::array<float,2>{0.977633953f, 0.574969411f},
-std::array<float,2>{0.421788275f, 0.630097151f},
-std::array<float,2>{0.806208253f, 0.12104474f},
-std::array<float,2>{0.033662539f, 0.499813884f},
-std::array<float,2>{0.606143117f, 0.798370063f},
-std::array<float,2>{0.135967255f, 0.69639492f},
-std::array<float,2>{0.725965738f, 0.00711779902f},
-std::array<float,2>{0.368470758f, 0.433162898f},
-std::array<float,2>{0.935666203f, 0.828339219f},
-std::array<float,2>{0.490744382f, 0.878533244f},
-std::array<float,2>{0.840053678f, 0.358724624f},
-std::array<float,2>{0.0672831908f, 0.147486657f},
-std::array<float,2>{0.523180246f, 0.532777607f},
-std::array<float,2>{0.0120169865f, 0.769413173f},
-std::array<float,2>{0.577817976f, 0.457599521f},
-std::array<float,2>{0.379614085f, 0.0778041855f},
-std::array<float,2>{0.769289792f, 0.666924357f},
-std::array<float,2>{0.291951478f, 0.597162664f},
-std::array<float,2>{0.949767113f, 0.22625497f},
-std::array<float,2>{0.232932568f, 0.282471806f},
-std::array<float,2>{0.671290517f, 0.966307521f},
-std::array<float,2>{0.0981212631f, 0.634312689f},
-std::array<float,2>{0.554771543f, 0.112326302f},
-std::array<float,2>{0.449958146f, 0.487108111f},
-std::array<float,2>{0.85585773f, 0.807862878f},
-std::array<float,2>{0.338133901f, 0.984242618f},
-std::array<float,2>{0.892670214f, 0.276100487f},
-std::array<float,2>{0.182413444f, 0.200888425f},
-std::array<float,2>{0.708096325f, 0.568447351f},
-std::array<float,2>{0.217639312f, 0.852431297f},
-std::array<float,2>{0.644371927f, 0.375790119f},
-std::array<float,2>{0.256117076f, 0.0345022008f},
-std::array<float,2>{0.98720479f, 0.745981514f},
-std::array<float,2>{0.433928162f, 0.520517528f},
-std::array<float,2>{0.781532109f, 0.157627746f},
-std::array<float,2>{0.0611186624f, 0.338312149f},
-std::array<float,2>{0.621234238f, 0.915027738f},
-std::array<float,2>{0.145047262f, 0.609118223f},
-std::array<float,2>{0.747650146f, 0.228444755f},
-std::array<float,2>{0.349157393f, 0.295177072f},
-std::array<float,2>{0.913427114f, 0.960667968f},
-std::array<float,2>{0.468783975f, 0.77344656f},
-std::array<float,2>{0.820341229f, 0.464451849f},
-std::array<float,2>{0.0799167678f, 0.0635763928f},
-std::array<float,2>{0.505770743f, 0.659718037f},
-std::array<float,2>{0.0186845176f, 0.886632502f},
-std::array<float,2>{0.586004674f, 0.346232414f},
-std::array<float,2>{0.390733749f, 0.150656074f},
-std::array<float,2>{0.764057219f, 0.542512298f},
-std::array<float,2>{0.311146498f, 0.692304134f},
-std::array<float,2>{0.957726538f, 0.0125102103f},
-std::array<float,2>{0.2475826f, 0.428497106f},
-std::array<float,2>{0.684136748f, 0.841224253f},
-std::array<float,2>{0.0377747789f, 0.557808876f},
-std::array<float,2>{0.604834735f, 0.12549457f},
-std::array<float,2>{0.416770756f, 0.365391165f},
-std::array<float,2>{0.812497258f, 0.903080463f},
-std::array<float,2>{0.271244317f, 0.820591033f},
-std::array<float,2>{0.98330307f, 0.416640222f},
-std::array<float,2>{0.193233505f, 0.0194800049f},
-std::array<float,2>{0.625345707f, 0.704895318f},
-std::array<float,2>{0.169167206f, 0.945409f},
-std::array<float,2>{0.693141878f, 0.300927103f},
-std::array<float,2>{0.317839652f, 0.236559287f},
-std::array<float,2>{0.890479088f, 0.619847238f},
-std::array<float,2>{0.458715558f, 0.675822496f},
-std::array<float,2>{0.861316264f, 0.0874402672f},
-std::array<float,2>{0.110896029f, 0.451961517f},
-std::array<float,2>{0.540229023f, 0.765535831f},
-std::array<float,2>{0.229399994f, 0.719339848f},
-std::array<float,2>{0.664967656f, 0.0481824763f},
-std::array<float,2>{0.29614988f, 0.390685648f},
-std::array<float,2>{0.948438227f, 0.871465027f},
-std::array<float,2>{0.37624532f, 0.929567814f},
-std::array<float,2>{0.770779788f, 0.317008436f},
-std::array<float,2>{0.0116724139f, 0.172307491f},
-std::array<float,2>{0.572342217f, 0.506452084f},
-std::array<float,2>{0.0630861446f, 0.788870037f},
-std::array<float,2>{0.51796484f, 0.476079583f},
-std::array<float,2>{0.486063302f, 0.0987211615f},
-std::array<float,2>{0.836079121f, 0.647492826f},
-std::array<float,2>{0.373559386f, 0.592885196f},
-std::array<float,2>{0.931237757f, 0.211357251f},
-std::array<float,2>{0.138139173f, 0.262981474f},
-std::array<float,2>{0.720249891f, 0.996857524f},
-std::array<float,2>{0.00190276175f, 0.715643167f},
-std::array<float,2>{0.56957823f, 0.0309190899f},
-std::array<float,2>{0.386155427f, 0.408309698f},
-std::array<float,2>{0.77472502f, 0.813758433f},
-std::array<float,2>{0.285833925f, 0.891283751f},
-std::array<float,2>{0.944262207f, 0.370170891f},
-std::array<float,2>{0.22363314f, 0.139634177f},
-std::array<float,2>{0.658546329f, 0.548444688f},
-std::array<float,2>{0.127850294f, 0.750350416f},
-std::array<float,2>{0.732644737f, 0.442940414f},
-std::array<float,2>{0.361666441f, 0.0812812597f},
-std::array<float,2>{0.923418999f, 0.687434494f},
-std::array<float,2>{0.493947834f, 0.613245845f},
-std::array<float,2>{0.829398751f, 0.247935653f},
-std::array<float,2>{0.0717104077f, 0.308486611f},
-std::array<float,2>{0.528656662f, 0.944198549f},
-std::array<float,2>{0.200569779f, 0.513334394f},
-std::array<float,2>{0.63290906f, 0.18348223f},
-std::array<float,2>{0.280339479f, 0.326616943f},
-std::array<float,2>{0.974639177f, 0.930390358f},
-std::array<float,2>{0.407891542f, 0.859742939f},
-std::array<float,2>{0.801694036f, 0.405758798f},
-std::array<float,2>{0.0394874588f, 0.0622696765f},
-std::array<float,2>{0.599330246f, 0.731266797f},
-std::array<float,2>{0.11783991f, 0.987731993f},
-std::array<float,2>{0.533212602f, 0.256240189f},
-std::array<float,2>{0.465873539f, 0.205474809f},
-std::array<float,2>{0.870642602f, 0.583140373f},
-std::array<float,2>{0.326338738f, 0.648494601f},
-std::array<float,2>{0.878872633f, 0.104584463f},
-std::array<float,2>{0.161614165f, 0.480467767f},
-std::array<float,2>{0.696059883f, 0.795276284f},
-std::array<float,2>{0.0865460932f, 0.57351917f},
-std::array<float,2>{0.513081193f, 0.190212369f},
-std::array<float,2>{0.478488028f, 0.271510512f},
-std::array<float,2>{0.818906069f, 0.971458077f},
-std::array<float,2>{0.358809441f, 0.802794933f},
-std::array<float,2>{0.919524014f, 0.492589682f},
-std::array<float,2>{0.149697915f, 0.123697147f},
-std::array<float,2>{0.740142763f, 0.627944529f},
-std::array<float,2>{0.235315233f, 0.910626888f},
-std::array<float,2>{0.677444279f, 0.333893567f},
-std::array<float,2>{0.301408708f, 0.164461181f},
-std::array<float,2>{0.963242292f, 0.523674607f},
-std::array<float,2>{0.40491569f, 0.740780711f},
-std::array<float,2>{0.753243268f, 0.0427625217f},
-std::array<float,2>{0.0235483479f, 0.389030308f},
-std::array<float,2>{0.581184566f, 0.84525907f},
-std::array<float,2>{0.172230795f, 0.668996155f},
-std::array<float,2>{0.716952503f, 0.070433706f},
-std::array<float,2>{0.331278384f, 0.45608598f},
-std::array<float,2>{0.900971115f, 0.771568418f},
-std::array<float,2>{0.439232469f, 0.961025059f},
-std::array<float,2>{0.845702469f, 0.287923604f},
-std::array<float,2>{0.10713134f, 0.221309707f},
-std::array<float,2>{0.55365473f, 0.597896636f},
-std::array<float,2>{0.0481381826f, 0.832071543f},
-std::array<float,2>{0.611682773f, 0.434060752f},
-std::array<float,2>{0.427427173f, 0.00375426817f},
-std::array<float,2>{0.794209898f, 0.702663422f},
-std::array<float,2>{0.258689582f, 0.537909746f},
-std::array<float,2>{0.992829204f, 0.144242331f},
-std::array<float,2>{0.208584249f, 0.354367793f},
-std::array<float,2>{0.653842986f, 0.880153835f},
-std::array<float,2>{0.105464108f, 0.725965321f},
-std::array<float,2>{0.54780972f, 0.0515184142f},
-std::array<float,2>{0.441820472f, 0.39796111f},
-std::array<float,2>{0.849832296f, 0.870126665f},
-std::array<float,2>{0.333026379f, 0.925119102f},
-std::array<float,2>{0.905917406f, 0.312975734f},
-std::array<float,2>{0.178254709f, 0.178508222f},
-std::array<float,2>{0.711360514f, 0.50107187f},
-std::array<float,2>{0.204042658f, 0.785115242f},
-std::array<float,2>{0.65004456f, 0.471838027f},
-std::array<float,2>{0.263001144f, 0.0949954167f},
-std::array<float,2>{0.997282088f, 0.642295301f},
-std::array<float,2>{0.425673485f, 0.587940395f},
-std::array<float,2>{0.791183352f, 0.21623078f},
-std::array<float,2>{0.0511001572f, 0.260301411f},
-std::array<float,2>{0.61682117f, 0.994662166f},
-std::array<float,2>{0.153312489f, 0.561409533f},
-std::array<float,2>{0.736899912f, 0.131424621f},
-std::array<float,2>{0.353045344f, 0.360415131f},
-std::array<float,2>{0.914219558f, 0.899020255f},
-std::array<float,2>{0.481180876f, 0.826436818f},
-std::array<float,2>{0.815491974f, 0.418242604f},
-std::array<float,2>{0.0915038809f, 0.0210455526f},
-std::array<float,2>{0.509396493f, 0.708957076f},
-std::array<float,2>{0.0304880161f, 0.951796532f},
-std::array<float,2>{0.583027661f, 0.298583925f},
-std::array<float,2>{0.398982823f, 0.239447236f},
-std::array<float,2>{0.754615963f, 0.624489009f},
-std::array<float,2>{0.29876703f, 0.674875021f},
-std::array<float,2>{0.96558547f, 0.091752328f},
-std::array<float,2>{0.238423884f, 0.446437746f},
-std::array<float,2>{0.674071968f, 0.759125829f},
-std::array<float,2>{0.0465587862f, 0.602389276f},
-std::array<float,2>{0.597433031f, 0.231437728f},
-std::array<float,2>{0.411699027f, 0.291360706f},
-std::array<float,2>{0.798465192f, 0.953638077f},
-std::array<float,2>{0.273638159f, 0.7803334f},
-std::array<float,2>{0.970166206f, 0.468600035f},
-std::array<float,2>{0.19652082f, 0.0673973709f},
-std::array<float,2>{0.6391325f, 0.661330521f},
-std::array<float,2>{0.159706786f, 0.889847994f},
-std::array<float,2>{0.702718675f, 0.351296157f},
-std::array<float,2>{0.323836118f, 0.154453412f},
-std::array<float,2>{0.879568577f, 0.544178665f},
-std::array<float,2>{0.463940084f, 0.690989375f},
-std::array<float,2>{0.872532129f, 0.00862265192f},
-std::array<float,2>{0.124345705f, 0.424595922f},
-std::array<float,2>{0.537311196f, 0.836775362f},
-std::array<float,2>{0.222327307f, 0.638821185f},
-std::array<float,2>{0.662428021f, 0.115497187f},
-std::array<float,2>{0.282273233f, 0.488751829f},
-std::array<float,2>{0.93880868f, 0.812468648f},
-std::array<float,2>{0.389398426f, 0.978033364f},
-std::array<float,2>{0.780078769f, 0.281149238f},
-std::array<float,2>{0.00393848633f, 0.195910618f},
-std::array<float,2>{0.565645814f, 0.566358685f},
-std::array<float,2>{0.0757723004f, 0.856132269f},
-std::array<float,2>{0.523937285f, 0.380769044f},
-std::array<float,2>{0.499711305f, 0.037484996f},
-std::array<float,2>{0.833570063f, 0.748736143f},
-std::array<float,2>{0.363620341f, 0.518406987f},
-std::array<float,2>{0.925927937f, 0.162762359f},
-std::array<float,2>{0.12984252f, 0.341342688f},
-std::array<float,2>{0.730221868f, 0.919847429f},
-std::array<float,2>{0.0138413236f, 0.667534649f},
-std::array<float,2>{0.575073242f, 0.0766131878f},
-std::array<float,2>{0.381664634f, 0.458432287f},
-std::array<float,2>{0.766241133f, 0.767945588f},
-std::array<float,2>{0.290293694f, 0.965733409f},
-std::array<float,2>{0.952013552f, 0.282116711f},
-std::array<float,2>{0.231251493f, 0.22471875f},
-std::array<float,2>{0.669481814f, 0.596582055f},
-std::array<float,2>{0.134679914f, 0.829483807f},
-std::array<float,2>{0.723370075f, 0.432107836f},
-std::array<float,2>{0.369678825f, 0.00645108335f},
-std::array<float,2>{0.934800446f, 0.695950091f},
-std::array<float,2>{0.489401639f, 0.531824708f},
-std::array<float,2>{0.842490911f, 0.147076428f},
-std::array<float,2>{0.0692679435f, 0.357782125f},
-std::array<float,2>{0.521409333f, 0.877378643f},
-std::array<float,2>{0.187912703f, 0.575761318f},
-std::array<float,2>{0.631052315f, 0.192880243f},
-std::array<float,2>{0.267325729f, 0.269293368f},
-std::array<float,2>{0.979222119f, 0.9754107f},
-std::array<float,2>{0.419292599f, 0.797548115f},
-std::array<float,2>{0.808060646f, 0.4989492f},
-std::array<float,2>{0.0331183262f, 0.119773909f},
-std::array<float,2>{0.6083709f, 0.628957808f},
-std::array<float,2>{0.114999488f, 0.909543097f},
-std::array<float,2>{0.545734107f, 0.332028419f},
-std::array<float,2>{0.455839127f, 0.168149173f},
-std::array<float,2>{0.864636958f, 0.528109968f},
-std::array<float,2>{0.31425637f, 0.734770298f},
-std::array<float,2>{0.886414945f, 0.0445473641f},
-std::array<float,2>{0.165502876f, 0.38643977f},
-std::array<float,2>{0.688151777f, 0.851235807f},
-std::array<float,2>{0.0852081776f, 0.508333445f},
-std::array<float,2>{0.501405656f, 0.185506046f},
-std::array<float,2>{0.476084679f, 0.321970373f},
-std::array<float,2>{0.824316323f, 0.934735239f},
-std::array<float,2>{0.347244769f, 0.866965711f},
-std::array<float,2>{0.909958243f, 0.398733616f},
-std::array<float,2>{0.144469664f, 0.0582928732f},
-std::array<float,2>{0.742324829f, 0.729095638f},
-std::array<float,2>{0.243580729f, 0.991715968f},
-std::array<float,2>{0.680709243f, 0.251715481f},
-std::array<float,2>{0.308466733f, 0.209635362f},
-std::array<float,2>{0.95416981f, 0.581255496f},
-std::array<float,2>{0.396609634f, 0.653226614f},
-std::array<float,2>{0.759979963f, 0.106462017f},
-std::array<float,2>{0.0198528171f, 0.482764423f},
-std::array<float,2>{0.591961145f, 0.792579472f},
-std::array<float,2>{0.185805216f, 0.71182549f},
-std::array<float,2>{0.706101716f, 0.0236158967f},
-std::array<float,2>{0.341308773f, 0.413247168f},
-std::array<float,2>{0.896777332f, 0.818520546f},
-std::array<float,2>{0.449054658f, 0.895778954f},
-std::array<float,2>{0.855310977f, 0.373006195f},
-std::array<float,2>{0.0970395356f, 0.136062101f},
-std::array<float,2>{0.560507655f, 0.553868115f},
-std::array<float,2>{0.0576150864f, 0.754255533f},
-std::array<float,2>{0.620159566f, 0.438194603f},
-std::array<float,2>{0.43164891f, 0.0831270516f},
-std::array<float,2>{0.786767364f, 0.68339628f},
-std::array<float,2>{0.250918359f, 0.615431428f},
-std::array<float,2>{0.990569592f, 0.244638517f},
-std::array<float,2>{0.211949661f, 0.310563564f},
-std::array<float,2>{0.645228624f, 0.939516187f},
-std::array<float,2>{0.0654411912f, 0.6473248f},
-std::array<float,2>{0.516079485f, 0.097942844f},
-std::array<float,2>{0.486958951f, 0.4748272f},
-std::array<float,2>{0.838938415f, 0.788057268f},
-std::array<float,2>{0.371739149f, 0.997603178f},
-std::array<float,2>{0.932497382f, 0.262030423f},
-std::array<float,2>{0.14034228f, 0.212732226f},
-std::array<float,2>{0.720945239f, 0.591804266f},
-std::array<float,2>{0.226942718f, 0.872499645f},
-std::array<float,2>{0.667591035f, 0.392311811f},
-std::array<float,2>{0.294660449f, 0.0470220596f},
-std::array<float,2>{0.946966588f, 0.720503569f},
-std::array<float,2>{0.378096342f, 0.507269859f},
-std::array<float,2>{0.771936059f, 0.173296362f},
-std::array<float,2>{0.0087978309f, 0.317921877f},
-std::array<float,2>{0.570955455f, 0.92849493f},
-std::array<float,2>{0.170532838f, 0.620163918f},
-std::array<float,2>{0.694626749f, 0.237993702f},
-std::array<float,2>{0.319255829f, 0.302127123f},
-std::array<float,2>{0.888623893f, 0.94632268f},
-std::array<float,2>{0.459458739f, 0.764375627f},
-std::array<float,2>{0.862152696f, 0.452752531f},
-std::array<float,2>{0.112657622f, 0.0868392885f},
-std::array<float,2>{0.542184114f, 0.67723757f},
-std::array<float,2>{0.035705924f, 0.903438747f},
-std::array<float,2>{0.603479683f, 0.366905868f},
-std::array<float,2>{0.415476471f, 0.126242459f},
-std::array<float,2>{0.809197724f, 0.557450652f},
-std::array<float,2>{0.272444516f, 0.703141034f},
-std::array<float,2>{0.982399642f, 0.0182497445f},
-std::array<float,2>{0.194403037f, 0.417540997f},
-std::array<float,2>{0.627149045f, 0.821396589f},
-std::array<float,2>{0.0156835001f, 0.541369319f},
-std::array<float,2>{0.589691222f, 0.151819855f},
-std::array<float,2>{0.393504828f, 0.347629488f},
-std::array<float,2>{0.762722254f, 0.885432839f},
-std::array<float,2>{0.309408754f, 0.840452552f},
-std::array<float,2>{0.960653722f, 0.429571778f},
-std::array<float,2>{0.24967593f, 0.013265254f},
-std::array<float,2>{0.686815321f, 0.692914546f},
-std::array<float,2>{0.147431493f, 0.959636331f},
-std::array<float,2>{0.749870002f, 0.296765715f},
-std::array<float,2>{0.350990355f, 0.227457494f},
-std::array<float,2>{0.91041255f, 0.607642829f},
-std::array<float,2>{0.471572548f, 0.659017324f},
-std::array<float,2>{0.823024929f, 0.0628320202f},
-std::array<float,2>{0.0815195739f, 0.463262796f},
-std::array<float,2>{0.50769794f, 0.774454057f},
-std::array<float,2>{0.216159344f, 0.745086789f},
-std::array<float,2>{0.640982628f, 0.0339402929f},
-std::array<float,2>{0.25444892f, 0.376758248f},
-std::array<float,2>{0.985547543f, 0.852558076f},
-std::array<float,2>{0.43567571f, 0.915459573f},
-std::array<float,2>{0.783985794f, 0.339028031f},
-std::array<float,2>{0.0604107641f, 0.156320736f},
-std::array<float,2>{0.624067605f, 0.520112634f},
-std::array<float,2>{0.101107761f, 0.807009101f},
-std::array<float,2>{0.557229638f, 0.487709761f},
-std::array<float,2>{0.452874184f, 0.111769862f},
-std::array<float,2>{0.857896924f, 0.633212507f},
-std::array<float,2>{0.336996734f, 0.56982559f},
-std::array<float,2>{0.891248584f, 0.19968006f},
-std::array<float,2>{0.179955021f, 0.276833117f},
-std::array<float,2>{0.709010065f, 0.982423425f},
-std::array<float,2>{0.050529778f, 0.701513052f},
-std::array<float,2>{0.609660268f, 0.00199181587f},
-std::array<float,2>{0.429669917f, 0.43519485f},
-std::array<float,2>{0.79655987f, 0.833580017f},
-std::array<float,2>{0.260840923f, 0.879480898f},
-std::array<float,2>{0.995029986f, 0.355408549f},
-std::array<float,2>{0.209788248f, 0.143229768f},
-std::array<float,2>{0.654925287f, 0.538912833f},
-std::array<float,2>{0.175181717f, 0.773093045f},
-std::array<float,2>{0.715834022f, 0.455148458f},
-std::array<float,2>{0.330046982f, 0.0715697035f},
-std::array<float,2>{0.899131656f, 0.668138385f},
-std::array<float,2>{0.440398008f, 0.599599242f},
-std::array<float,2>{0.84601146f, 0.222655356f},
-std::array<float,2>{0.107567236f, 0.288646668f},
-std::array<float,2>{0.551618278f, 0.962766469f},
-std::array<float,2>{0.237045214f, 0.525145948f},
-std::array<float,2>{0.678807199f, 0.165428191f},
-std::array<float,2>{0.303808957f, 0.332200289f},
-std::array<float,2>{0.961735845f, 0.911286175f},
-std::array<float,2>{0.402713984f, 0.844601512f},
-std::array<float,2>{0.75113672f, 0.389976948f},
-std::array<float,2>{0.0259362031f, 0.041370254f},
-std::array<float,2>{0.578589737f, 0.741266429f},
-std::array<float,2>{0.0894330516f, 0.971917689f},
-std::array<float,2>{0.515511394f, 0.272586554f},
-std::array<float,2>{0.479970008f, 0.191052824f},
-std::array<float,2>{0.818039775f, 0.572614074f},
-std::array<float,2>{0.356677264f, 0.627214193f},
-std::array<float,2>{0.920876265f, 0.124533221f},
-std::array<float,2>{0.150993109f, 0.493931234f},
-std::array<float,2>{0.741492212f, 0.804621458f},
-std::array<float,2>{0.120600022f, 0.582714736f},
-std::array<float,2>{0.53222096f, 0.206371546f},
-std::array<float,2>{0.468238801f, 0.257534444f},
-std::array<float,2>{0.8685202f, 0.987161875f},
-std::array<float,2>{0.325227082f, 0.796353996f},
-std::array<float,2>{0.876566589f, 0.479158968f},
-std::array<float,2>{0.163462415f, 0.104198091f},
-std::array<float,2>{0.699216127f, 0.65035826f},
-std::array<float,2>{0.201263636f, 0.930889606f},
-std::array<float,2>{0.635353446f, 0.327440262f},
-std::array<float,2>{0.27909103f, 0.182263762f},
-std::array<float,2>{0.973560035f, 0.512502372f},
-std::array<float,2>{0.409157872f, 0.731770635f},
-std::array<float,2>{0.803723156f, 0.0609229021f},
-std::array<float,2>{0.0420301557f, 0.405235648f},
-std::array<float,2>{0.600287914f, 0.860982358f},
-std::array<float,2>{0.126896635f, 0.686437666f},
-std::array<float,2>{0.730657399f, 0.0804787502f},
-std::array<float,2>{0.360496074f, 0.442089528f},
-std::array<float,2>{0.924176812f, 0.751360297f},
-std::array<float,2>{0.494766355f, 0.944815874f},
-std::array<float,2>{0.830786943f, 0.306831628f},
-std::array<float,2>{0.0728718415f, 0.246687204f},
-std::array<float,2>{0.531134248f, 0.611642599f},
-std::array<float,2>{0.00282008643f, 0.812796354f},
-std::array<float,2>{0.5671435f, 0.409399599f},
-std::array<float,2>{0.383860499f, 0.02952764f},
-std::array<float,2>{0.776633739f, 0.71652323f},
-std::array<float,2>{0.287581384f, 0.546977758f},
-std::array<float,2>{0.943135977f, 0.139718994f},
-std::array<float,2>{0.225970805f, 0.369567037f},
-std::array<float,2>{0.656354547f, 0.891973197f},
-std::array<float,2>{0.0930118412f, 0.710717618f},
-std::array<float,2>{0.51094079f, 0.0219221804f},
-std::array<float,2>{0.483634621f, 0.421446115f},
-std::array<float,2>{0.812588692f, 0.825176001f},
-std::array<float,2>{0.353893369f, 0.901594102f},
-std::array<float,2>{0.916082859f, 0.36281094f},
-std::array<float,2>{0.155418232f, 0.129526064f},
-std::array<float,2>{0.735052526f, 0.559994996f},
-std::array<float,2>{0.241074279f, 0.76159054f},
-std::array<float,2>{0.67245084f, 0.448721975f},
-std::array<float,2>{0.299521834f, 0.0921398848f},
-std::array<float,2>{0.967350423f, 0.672569692f},
-std::array<float,2>{0.400872141f, 0.622571647f},
-std::array<float,2>{0.757774591f, 0.240891203f},
-std::array<float,2>{0.02773696f, 0.299798012f},
-std::array<float,2>{0.584494233f, 0.949872255f},
-std::array<float,2>{0.176817626f, 0.503441691f},
-std::array<float,2>{0.714292049f, 0.177445382f},
-std::array<float,2>{0.335079938f, 0.316075623f},
-std::array<float,2>{0.904231489f, 0.922620654f},
-std::array<float,2>{0.444578528f, 0.86796546f},
-std::array<float,2>{0.848725677f, 0.394580245f},
-std::array<float,2>{0.10322275f, 0.0534289405f},
-std::array<float,2>{0.548828125f, 0.723461032f},
-std::array<float,2>{0.0541551001f, 0.992244422f},
-std::array<float,2>{0.614919662f, 0.259300023f},
-std::array<float,2>{0.422846526f, 0.218527064f},
-std::array<float,2>{0.79070282f, 0.586561143f},
-std::array<float,2>{0.26460731f, 0.643936574f},
-std::array<float,2>{0.998250842f, 0.0966610983f},
-std::array<float,2>{0.205159947f, 0.469022661f},
-std::array<float,2>{0.650907099f, 0.781458139f},
-std::array<float,2>{0.00609643757f, 0.564086676f},
-std::array<float,2>{0.563777268f, 0.197463527f},
-std::array<float,2>{0.387179703f, 0.278462768f},
-std::array<float,2>{0.778558552f, 0.980334759f},
-std::array<float,2>{0.284972608f, 0.809685528f},
-std::array<float,2>{0.940287113f, 0.490958333f},
-std::array<float,2>{0.21917294f, 0.113285296f},
-std::array<float,2>{0.660156667f, 0.638422608f},
-std::array<float,2>{0.132697955f, 0.921005011f},
-std::array<float,2>{0.727227449f, 0.343575418f},
-std::array<float,2>{0.366900325f, 0.16112116f},
-std::array<float,2>{0.928082228f, 0.516037643f},
-std::array<float,2>{0.497051507f, 0.747981012f},
-std::array<float,2>{0.835087478f, 0.0363883451f},
-std::array<float,2>{0.0766785368f, 0.38133347f},
-std::array<float,2>{0.526456773f, 0.858135045f},
-std::array<float,2>{0.198987752f, 0.662407815f},
-std::array<float,2>{0.63812542f, 0.0693246052f},
-std::array<float,2>{0.276278973f, 0.46557346f},
-std::array<float,2>{0.972152889f, 0.778231859f},
-std::array<float,2>{0.412421972f, 0.955408454f},
-std::array<float,2>{0.799929976f, 0.28918153f},
-std::array<float,2>{0.0439928025f, 0.233671695f},
-std::array<float,2>{0.595170021f, 0.605032861f},
-std::array<float,2>{0.121501006f, 0.838053226f},
-std::array<float,2>{0.536405683f, 0.422380894f},
-std::array<float,2>{0.462235361f, 0.010647296f},
-std::array<float,2>{0.874644578f, 0.688494086f},
-std::array<float,2>{0.321104378f, 0.545954883f},
-std::array<float,2>{0.881462038f, 0.153133318f},
-std::array<float,2>{0.157710582f, 0.347747177f},
-std::array<float,2>{0.700396419f, 0.886844873f},
-std::array<float,2>{0.0347523466f, 0.631862879f},
-std::array<float,2>{0.60702163f, 0.118770771f},
-std::array<float,2>{0.419965863f, 0.497161716f},
-std::array<float,2>{0.805033386f, 0.79892838f},
-std::array<float,2>{0.268473059f, 0.974123597f},
-std::array<float,2>{0.977119744f, 0.265811384f},
-std::array<float,2>{0.190323606f, 0.195022434f},
-std::array<float,2>{0.62978065f, 0.576458752f},
-std::array<float,2>{0.166962847f, 0.848819315f},
-std::array<float,2>{0.691155434f, 0.383275747f},
-std::array<float,2>{0.315411627f, 0.0459224544f},
-std::array<float,2>{0.883023322f, 0.73638612f},
-std::array<float,2>{0.454448044f, 0.531159341f},
-std::array<float,2>{0.865900457f, 0.170376301f},
-std::array<float,2>{0.115967445f, 0.329296947f},
-std::array<float,2>{0.543621004f, 0.906593919f},
-std::array<float,2>{0.233456716f, 0.595530093f},
-std::array<float,2>{0.670594811f, 0.223709032f},
-std::array<float,2>{0.292604357f, 0.28343156f},
-std::array<float,2>{0.950898588f, 0.96700412f},
-std::array<float,2>{0.380501479f, 0.766000509f},
-std::array<float,2>{0.768136084f, 0.459392458f},
-std::array<float,2>{0.0135124279f, 0.0758925602f},
-std::array<float,2>{0.576192975f, 0.664503634f},
-std::array<float,2>{0.0679496154f, 0.876176119f},
-std::array<float,2>{0.522211969f, 0.356818199f},
-std::array<float,2>{0.49210602f, 0.144672483f},
-std::array<float,2>{0.841212034f, 0.534315407f},
-std::array<float,2>{0.368105978f, 0.697375715f},
-std::array<float,2>{0.936963558f, 0.00486581912f},
-std::array<float,2>{0.135072514f, 0.431260467f},
-std::array<float,2>{0.725294113f, 0.831301093f},
-std::array<float,2>{0.0947119743f, 0.551505089f},
-std::array<float,2>{0.561632872f, 0.13355796f},
-std::array<float,2>{0.44607529f, 0.37428388f},
-std::array<float,2>{0.852002978f, 0.897816122f},
-std::array<float,2>{0.342661291f, 0.817637861f},
-std::array<float,2>{0.896446705f, 0.412004203f},
-std::array<float,2>{0.184244558f, 0.0272280611f},
-std::array<float,2>{0.704832137f, 0.713821352f},
-std::array<float,2>{0.213983238f, 0.93755281f},
-std::array<float,2>{0.647769392f, 0.30921036f},
-std::array<float,2>{0.252693892f, 0.242251456f},
-std::array<float,2>{0.988566041f, 0.614264905f},
-std::array<float,2>{0.430609465f, 0.680575609f},
-std::array<float,2>{0.787570536f, 0.0848082229f},
-std::array<float,2>{0.0554042794f, 0.439468503f},
-std::array<float,2>{0.617490351f, 0.755982876f},
-std::array<float,2>{0.141718835f, 0.727874994f},
-std::array<float,2>{0.744751334f, 0.0552592911f},
-std::array<float,2>{0.344364941f, 0.401873112f},
-std::array<float,2>{0.907329381f, 0.863412201f},
-std::array<float,2>{0.474423528f, 0.936245561f},
-std::array<float,2>{0.827439725f, 0.323057681f},
-std::array<float,2>{0.0829177126f, 0.186685264f},
-std::array<float,2>{0.502449989f, 0.510291457f},
-std::array<float,2>{0.0232142918f, 0.790673673f},
-std::array<float,2>{0.590257227f, 0.482060105f},
-std::array<float,2>{0.395880073f, 0.108715661f},
-std::array<float,2>{0.758407593f, 0.654863596f},
-std::array<float,2>{0.305675447f, 0.579053938f},
-std::array<float,2>{0.955137372f, 0.207376778f},
-std::array<float,2>{0.24422273f, 0.253695428f},
-std::array<float,2>{0.682976544f, 0.988965929f},
-std::array<float,2>{0.110304236f, 0.679140031f},
-std::array<float,2>{0.539300978f, 0.08830484f},
-std::array<float,2>{0.457139194f, 0.450680465f},
-std::array<float,2>{0.859817028f, 0.762095451f},
-std::array<float,2>{0.317111403f, 0.948551476f},
-std::array<float,2>{0.888899148f, 0.302955896f},
-std::array<float,2>{0.168379843f, 0.234641969f},
-std::array<float,2>{0.692034066f, 0.618829191f},
-std::array<float,2>{0.191807315f, 0.822623193f},
-std::array<float,2>{0.626434386f, 0.414594978f},
-std::array<float,2>{0.270172387f, 0.0157639403f},
-std::array<float,2>{0.984090924f, 0.705431461f},
-std::array<float,2>{0.41704914f, 0.556206465f},
-std::array<float,2>{0.811503291f, 0.128376931f},
-std::array<float,2>{0.0384854823f, 0.364982963f},
-std::array<float,2>{0.604326248f, 0.905409873f},
-std::array<float,2>{0.13706632f, 0.591166317f},
-std::array<float,2>{0.719638228f, 0.214757353f},
-std::array<float,2>{0.374579638f, 0.265624732f},
-std::array<float,2>{0.929761589f, 0.998071373f},
-std::array<float,2>{0.484888405f, 0.785648227f},
-std::array<float,2>{0.837438226f, 0.474486202f},
-std::array<float,2>{0.064109616f, 0.100810364f},
-std::array<float,2>{0.519166291f, 0.645096958f},
-std::array<float,2>{0.010185739f, 0.926023841f},
-std::array<float,2>{0.57381475f, 0.319906563f},
-std::array<float,2>{0.375118405f, 0.175093085f},
-std::array<float,2>{0.769665956f, 0.504925609f},
-std::array<float,2>{0.295232147f, 0.720825672f},
-std::array<float,2>{0.947424769f, 0.0494733416f},
-std::array<float,2>{0.229885772f, 0.394076139f},
-std::array<float,2>{0.66513139f, 0.873243749f},
-std::array<float,2>{0.0618400164f, 0.521494687f},
-std::array<float,2>{0.622567296f, 0.159979209f},
-std::array<float,2>{0.435357213f, 0.337036341f},
-std::array<float,2>{0.782572687f, 0.917842329f},
-std::array<float,2>{0.257260084f, 0.854656041f},
-std::array<float,2>{0.987500548f, 0.377052635f},
-std::array<float,2>{0.218577743f, 0.0318069458f},
-std::array<float,2>{0.643250644f, 0.742763519f},
-std::array<float,2>{0.183492646f, 0.981279731f},
-std::array<float,2>{0.707359552f, 0.275229573f},
-std::array<float,2>{0.339718223f, 0.201558203f},
-std::array<float,2>{0.893558919f, 0.568125844f},
-std::array<float,2>{0.450856268f, 0.634936094f},
-std::array<float,2>{0.856540263f, 0.109401532f},
-std::array<float,2>{0.0995320901f, 0.485099047f},
-std::array<float,2>{0.556108713f, 0.805274427f},
-std::array<float,2>{0.246761262f, 0.694390714f},
-std::array<float,2>{0.685448647f, 0.0137658911f},
-std::array<float,2>{0.312252641f, 0.426985264f},
-std::array<float,2>{0.958445072f, 0.84237951f},
-std::array<float,2>{0.391720235f, 0.884666264f},
-std::array<float,2>{0.765442967f, 0.344394445f},
-std::array<float,2>{0.0184338875f, 0.148544163f},
-std::array<float,2>{0.587539375f, 0.540531576f},
-std::array<float,2>{0.0785289854f, 0.775446296f},
-std::array<float,2>{0.504620552f, 0.461994559f},
-std::array<float,2>{0.470493466f, 0.0654357225f},
-std::array<float,2>{0.822256744f, 0.656825721f},
-std::array<float,2>{0.348146021f, 0.606030822f},
-std::array<float,2>{0.91236335f, 0.230418459f},
-std::array<float,2>{0.146044433f, 0.294096589f},
-std::array<float,2>{0.746942103f, 0.958476245f},
-std::array<float,2>{0.0250629913f, 0.739511251f},
-std::array<float,2>{0.580106735f, 0.0402400941f},
-std::array<float,2>{0.406231165f, 0.387969702f},
-std::array<float,2>{0.752386034f, 0.845873296f},
-std::array<float,2>{0.302501976f, 0.912491918f},
-std::array<float,2>{0.963895857f, 0.335725099f},
-std::array<float,2>{0.235974506f, 0.166396886f},
-std::array<float,2>{0.676114857f, 0.526922286f},
-std::array<float,2>{0.149280787f, 0.802352726f},
-std::array<float,2>{0.738519609f, 0.495901257f},
-std::array<float,2>{0.357682198f, 0.12198741f},
-std::array<float,2>{0.918334365f, 0.625728607f},
-std::array<float,2>{0.477394521f, 0.570596457f},
-std::array<float,2>{0.819754779f, 0.187794685f},
-std::array<float,2>{0.0877601355f, 0.270494491f},
-std::array<float,2>{0.51233691f, 0.96895051f},
-std::array<float,2>{0.207949102f, 0.53707099f},
-std::array<float,2>{0.653241217f, 0.14107129f},
-std::array<float,2>{0.259455562f, 0.35350436f},
-std::array<float,2>{0.993843555f, 0.882073998f},
-std::array<float,2>{0.42617932f, 0.834918678f},
-std::array<float,2>{0.793876231f, 0.437115639f},
-std::array<float,2>{0.04718218f, 0.00130701344f},
-std::array<float,2>{0.612572014f, 0.699440062f},
-std::array<float,2>{0.106378749f, 0.963189721f},
-std::array<float,2>{0.55461663f, 0.285853207f},
-std::array<float,2>{0.437932819f, 0.219419509f},
-std::array<float,2>{0.843785644f, 0.600889146f},
-std::array<float,2>{0.330925792f, 0.670979559f},
-std::array<float,2>{0.901726604f, 0.0728584751f},
-std::array<float,2>{0.173401177f, 0.453746885f},
-std::array<float,2>{0.718688369f, 0.770029068f},
-std::array<float,2>{0.0711958557f, 0.61119473f},
-std::array<float,2>{0.527606785f, 0.249515831f},
-std::array<float,2>{0.492583007f, 0.305453062f},
-std::array<float,2>{0.828126132f, 0.941495657f},
-std::array<float,2>{0.363142461f, 0.753618777f},
-std::array<float,2>{0.922163308f, 0.443840832f},
-std::array<float,2>{0.128876761f, 0.0788917094f},
-std::array<float,2>{0.733868003f, 0.684170961f},
-std::array<float,2>{0.22272557f, 0.894177318f},
-std::array<float,2>{0.659821749f, 0.368056417f},
-std::array<float,2>{0.287046164f, 0.137505636f},
-std::array<float,2>{0.945003033f, 0.549176097f},
-std::array<float,2>{0.385595709f, 0.717272818f},
-std::array<float,2>{0.77344811f, 0.0288852919f},
-std::array<float,2>{0.00095771224f, 0.407959014f},
-std::array<float,2>{0.569096208f, 0.815333247f},
-std::array<float,2>{0.160497859f, 0.652200043f},
-std::array<float,2>{0.697184563f, 0.103380419f},
-std::array<float,2>{0.327660769f, 0.477319419f},
-std::array<float,2>{0.877081215f, 0.79311496f},
-std::array<float,2>{0.465266049f, 0.985515356f},
-std::array<float,2>{0.869209409f, 0.25464192f},
-std::array<float,2>{0.118996665f, 0.203148633f},
-std::array<float,2>{0.534888208f, 0.585540235f},
-std::array<float,2>{0.040720243f, 0.861753047f},
-std::array<float,2>{0.598587871f, 0.403918445f},
-std::array<float,2>{0.406624556f, 0.0587529019f},
-std::array<float,2>{0.802668393f, 0.7331599f},
-std::array<float,2>{0.279889524f, 0.515430033f},
-std::array<float,2>{0.976107895f, 0.181361452f},
-std::array<float,2>{0.199942872f, 0.325189471f},
-std::array<float,2>{0.634302676f, 0.932484865f},
-std::array<float,2>{0.0976293385f, 0.713331223f},
-std::array<float,2>{0.559856296f, 0.0265388843f},
-std::array<float,2>{0.448677927f, 0.411586553f},
-std::array<float,2>{0.854868352f, 0.818333268f},
-std::array<float,2>{0.341198981f, 0.897980094f},
-std::array<float,2>{0.897234023f, 0.374701202f},
-std::array<float,2>{0.186451793f, 0.132951617f},
-std::array<float,2>{0.706732988f, 0.550904334f},
-std::array<float,2>{0.212427944f, 0.75640738f},
-std::array<float,2>{0.644968271f, 0.440043181f},
-std::array<float,2>{0.250047028f, 0.0844260827f},
-std::array<float,2>{0.991028249f, 0.679943264f},
-std::array<float,2>{0.432446688f, 0.615173459f},
-std::array<float,2>{0.786587417f, 0.243155494f},
-std::array<float,2>{0.0567118786f, 0.30874899f},
-std::array<float,2>{0.620853245f, 0.938362002f},
-std::array<float,2>{0.14362748f, 0.510229826f},
-std::array<float,2>{0.742849588f, 0.187252209f},
-std::array<float,2>{0.347160578f, 0.322408855f},
-std::array<float,2>{0.909488797f, 0.935654223f},
-std::array<float,2>{0.475656927f, 0.863886893f},
-std::array<float,2>{0.824887931f, 0.401815146f},
-std::array<float,2>{0.0858483389f, 0.0550352521f},
-std::array<float,2>{0.501909792f, 0.728321731f},
-std::array<float,2>{0.0200847182f, 0.988376439f},
-std::array<float,2>{0.592329621f, 0.253076702f},
-std::array<float,2>{0.397200882f, 0.207810208f},
-std::array<float,2>{0.760659456f, 0.578337491f},
-std::array<float,2>{0.308000714f, 0.654556751f},
-std::array<float,2>{0.954954088f, 0.109270565f},
-std::array<float,2>{0.243800268f, 0.481708765f},
-std::array<float,2>{0.681419134f, 0.790427506f},
-std::array<float,2>{0.0325017199f, 0.576794267f},
-std::array<float,2>{0.607517183f, 0.194582745f},
-std::array<float,2>{0.419448435f, 0.266512811f},
-std::array<float,2>{0.808448613f, 0.973651171f},
-std::array<float,2>{0.267010868f, 0.799488962f},
-std::array<float,2>{0.978748977f, 0.49769491f},
-std::array<float,2>{0.188465893f, 0.118282758f},
-std::array<float,2>{0.63150847f, 0.632597387f},
-std::array<float,2>{0.165562034f, 0.907015085f},
-std::array<float,2>{0.687770188f, 0.329739958f},
-std::array<float,2>{0.313942701f, 0.170752689f},
-std::array<float,2>{0.886019945f, 0.530299127f},
-std::array<float,2>{0.455397666f, 0.73681885f},
-std::array<float,2>{0.864813149f, 0.0466690622f},
-std::array<float,2>{0.114684775f, 0.383787245f},
-std::array<float,2>{0.545297623f, 0.849158525f},
-std::array<float,2>{0.230580673f, 0.665035307f},
-std::array<float,2>{0.669355512f, 0.0756262764f},
-std::array<float,2>{0.290921658f, 0.45982796f},
-std::array<float,2>{0.951578557f, 0.766396224f},
-std::array<float,2>{0.38120532f, 0.967319965f},
-std::array<float,2>{0.765852988f, 0.283751309f},
-std::array<float,2>{0.0145468106f, 0.224123582f},
-std::array<float,2>{0.574349582f, 0.594954848f},
-std::array<float,2>{0.0685995147f, 0.831752837f},
-std::array<float,2>{0.520508826f, 0.430723786f},
-std::array<float,2>{0.490099549f, 0.00398912048f},
-std::array<float,2>{0.84215194f, 0.697957933f},
-std::array<float,2>{0.36924991f, 0.534771383f},
-std::array<float,2>{0.935531795f, 0.145149231f},
-std::array<float,2>{0.13403973f, 0.356993228f},
-std::array<float,2>{0.722901285f, 0.876539767f},
-std::array<float,2>{0.00483510317f, 0.637755275f},
-std::array<float,2>{0.566323876f, 0.113892958f},
-std::array<float,2>{0.388983965f, 0.490390897f},
-std::array<float,2>{0.779603362f, 0.810108185f},
-std::array<float,2>{0.283110738f, 0.97983706f},
-std::array<float,2>{0.939077377f, 0.2788091f},
-std::array<float,2>{0.222027734f, 0.197858453f},
-std::array<float,2>{0.662687778f, 0.563557923f},
-std::array<float,2>{0.129158303f, 0.857722461f},
-std::array<float,2>{0.729772627f, 0.38135913f},
-std::array<float,2>{0.363841057f, 0.0368902683f},
-std::array<float,2>{0.926374972f, 0.74726671f},
-std::array<float,2>{0.499437749f, 0.516495109f},
-std::array<float,2>{0.833161056f, 0.160334766f},
-std::array<float,2>{0.0755841359f, 0.343036294f},
-std::array<float,2>{0.523691833f, 0.921696901f},
-std::array<float,2>{0.197173387f, 0.604690313f},
-std::array<float,2>{0.639266372f, 0.23423034f},
-std::array<float,2>{0.273941278f, 0.28999418f},
-std::array<float,2>{0.970620453f, 0.95566088f},
-std::array<float,2>{0.411532819f, 0.777393639f},
-std::array<float,2>{0.798170328f, 0.465073317f},
-std::array<float,2>{0.0459663607f, 0.0688054636f},
-std::array<float,2>{0.596957743f, 0.662606835f},
-std::array<float,2>{0.12489105f, 0.887232125f},
-std::array<float,2>{0.537692964f, 0.348617643f},
-std::array<float,2>{0.464450955f, 0.152731821f},
-std::array<float,2>{0.872710943f, 0.546815097f},
-std::array<float,2>{0.323450178f, 0.689037263f},
-std::array<float,2>{0.879102528f, 0.0100136008f},
-std::array<float,2>{0.159419671f, 0.421900481f},
-std::array<float,2>{0.702635646f, 0.838766634f},
-std::array<float,2>{0.0910823196f, 0.560230255f},
-std::array<float,2>{0.508926451f, 0.129096046f},
-std::array<float,2>{0.480518043f, 0.362454832f},
-std::array<float,2>{0.816279471f, 0.90207243f},
-std::array<float,2>{0.352777421f, 0.824598134f},
-std::array<float,2>{0.914749265f, 0.421234131f},
-std::array<float,2>{0.152472124f, 0.0223364625f},
-std::array<float,2>{0.736340344f, 0.71042788f},
-std::array<float,2>{0.238847867f, 0.949511647f},
-std::array<float,2>{0.67437464f, 0.298846632f},
-std::array<float,2>{0.298068881f, 0.240367606f},
-std::array<float,2>{0.965135634f, 0.622506917f},
-std::array<float,2>{0.398492664f, 0.672155797f},
-std::array<float,2>{0.754356265f, 0.0926098675f},
-std::array<float,2>{0.0309438836f, 0.449013084f},
-std::array<float,2>{0.583942592f, 0.760909498f},
-std::array<float,2>{0.178000197f, 0.723038495f},
-std::array<float,2>{0.711864114f, 0.0527697802f},
-std::array<float,2>{0.333776683f, 0.395128429f},
-std::array<float,2>{0.905626953f, 0.867289603f},
-std::array<float,2>{0.442199141f, 0.921898484f},
-std::array<float,2>{0.850305557f, 0.315829813f},
-std::array<float,2>{0.104863085f, 0.176875189f},
-std::array<float,2>{0.547343135f, 0.502981722f},
-std::array<float,2>{0.0515376702f, 0.781896353f},
-std::array<float,2>{0.616263866f, 0.469575226f},
-std::array<float,2>{0.424884766f, 0.0957433283f},
-std::array<float,2>{0.791694522f, 0.644467294f},
-std::array<float,2>{0.263535023f, 0.586286485f},
-std::array<float,2>{0.997772038f, 0.218260139f},
-std::array<float,2>{0.203222543f, 0.259037644f},
-std::array<float,2>{0.649666727f, 0.992899179f},
-std::array<float,2>{0.0723129213f, 0.684052467f},
-std::array<float,2>{0.530676961f, 0.078304626f},
-std::array<float,2>{0.494348079f, 0.443975389f},
-std::array<float,2>{0.830537081f, 0.753310382f},
-std::array<float,2>{0.361020535f, 0.942078888f},
-std::array<float,2>{0.924542785f, 0.305080771f},
-std::array<float,2>{0.126428604f, 0.249152914f},
-std::array<float,2>{0.731164455f, 0.610706508f},
-std::array<float,2>{0.226168096f, 0.814730525f},
-std::array<float,2>{0.657003164f, 0.407384247f},
-std::array<float,2>{0.287710249f, 0.0286677033f},
-std::array<float,2>{0.942608893f, 0.717461705f},
-std::array<float,2>{0.384342045f, 0.549669623f},
-std::array<float,2>{0.777336895f, 0.136872262f},
-std::array<float,2>{0.00236877915f, 0.367595524f},
-std::array<float,2>{0.566571057f, 0.893874049f},
-std::array<float,2>{0.163827345f, 0.585437238f},
-std::array<float,2>{0.698441029f, 0.203973874f},
-std::array<float,2>{0.325765342f, 0.254388034f},
-std::array<float,2>{0.87616092f, 0.986090362f},
-std::array<float,2>{0.468448192f, 0.793751776f},
-std::array<float,2>{0.868833005f, 0.47674039f},
-std::array<float,2>{0.12074206f, 0.102761582f},
-std::array<float,2>{0.531574965f, 0.651745081f},
-std::array<float,2>{0.0427625105f, 0.932044148f},
-std::array<float,2>{0.600007355f, 0.324356019f},
-std::array<float,2>{0.408361107f, 0.180692852f},
-std::array<float,2>{0.804371119f, 0.514851034f},
-std::array<float,2>{0.27877447f, 0.732484639f},
-std::array<float,2>{0.972837448f, 0.0591771826f},
-std::array<float,2>{0.201896101f, 0.403435677f},
-std::array<float,2>{0.63498044f, 0.862235427f},
-std::array<float,2>{0.0254615974f, 0.526718676f},
-std::array<float,2>{0.57884711f, 0.166556194f},
-std::array<float,2>{0.402880847f, 0.335235715f},
-std::array<float,2>{0.751608133f, 0.912916899f},
-std::array<float,2>{0.304324538f, 0.846289337f},
-std::array<float,2>{0.961151421f, 0.388260692f},
-std::array<float,2>{0.236359194f, 0.0406690128f},
-std::array<float,2>{0.67956686f, 0.739878714f},
-std::array<float,2>{0.15086633f, 0.969680548f},
-std::array<float,2>{0.741713107f, 0.269667417f},
-std::array<float,2>{0.357034624f, 0.188466623f},
-std::array<float,2>{0.920395076f, 0.571167707f},
-std::array<float,2>{0.480282068f, 0.625013053f},
-std::array<float,2>{0.817443669f, 0.121290103f},
-std::array<float,2>{0.0891802683f, 0.495525867f},
-std::array<float,2>{0.515070617f, 0.801959276f},
-std::array<float,2>{0.209301814f, 0.699898303f},
-std::array<float,2>{0.65447253f, 0.00150322169f},
-std::array<float,2>{0.26147306f, 0.437001795f},
-std::array<float,2>{0.994277f, 0.834154785f},
-std::array<float,2>{0.429154634f, 0.882401109f},
-std::array<float,2>{0.796383262f, 0.352916002f},
-std::array<float,2>{0.0498671308f, 0.141348585f},
-std::array<float,2>{0.610071838f, 0.536419809f},
-std::array<float,2>{0.108028263f, 0.76953882f},
-std::array<float,2>{0.550921977f, 0.453247458f},
-std::array<float,2>{0.439798027f, 0.0724161491f},
-std::array<float,2>{0.846624672f, 0.671850443f},
-std::array<float,2>{0.329371572f, 0.601112425f},
-std::array<float,2>{0.898571253f, 0.219053507f},
-std::array<float,2>{0.175454929f, 0.28528282f},
-std::array<float,2>{0.7163288f, 0.96343869f},
-std::array<float,2>{0.0599675439f, 0.742349088f},
-std::array<float,2>{0.624770582f, 0.0312542841f},
-std::array<float,2>{0.436220884f, 0.377619565f},
-std::array<float,2>{0.783225179f, 0.855064929f},
-std::array<float,2>{0.253912866f, 0.917145133f},
-std::array<float,2>{0.985921681f, 0.337489337f},
-std::array<float,2>{0.216770798f, 0.159655437f},
-std::array<float,2>{0.641322494f, 0.522460461f},
-std::array<float,2>{0.180455476f, 0.805074692f},
-std::array<float,2>{0.709528327f, 0.484393984f},
-std::array<float,2>{0.337670803f, 0.110200413f},
-std::array<float,2>{0.89086473f, 0.635618448f},
-std::array<float,2>{0.452495396f, 0.567805469f},
-std::array<float,2>{0.858019114f, 0.202035978f},
-std::array<float,2>{0.100879967f, 0.2746135f},
-std::array<float,2>{0.556921065f, 0.980589449f},
-std::array<float,2>{0.249390468f, 0.540275991f},
-std::array<float,2>{0.687444568f, 0.149360016f},
-std::array<float,2>{0.308704734f, 0.344092458f},
-std::array<float,2>{0.960278511f, 0.884186924f},
-std::array<float,2>{0.392668754f, 0.841926455f},
-std::array<float,2>{0.763399899f, 0.427407533f},
-std::array<float,2>{0.016201688f, 0.0145743312f},
-std::array<float,2>{0.589293659f, 0.694933295f},
-std::array<float,2>{0.081678763f, 0.958533645f},
-std::array<float,2>{0.50731498f, 0.294562757f},
-std::array<float,2>{0.471060961f, 0.229924664f},
-std::array<float,2>{0.822617531f, 0.605493724f},
-std::array<float,2>{0.351482421f, 0.656584501f},
-std::array<float,2>{0.910657346f, 0.0662560537f},
-std::array<float,2>{0.146781251f, 0.462616354f},
-std::array<float,2>{0.749272883f, 0.776326716f},
-std::array<float,2>{0.113231145f, 0.6182217f},
-std::array<float,2>{0.54274559f, 0.234894112f},
-std::array<float,2>{0.459732354f, 0.303696245f},
-std::array<float,2>{0.86132884f, 0.94916749f},
-std::array<float,2>{0.318368942f, 0.762307942f},
-std::array<float,2>{0.888072252f, 0.450767756f},
-std::array<float,2>{0.170210406f, 0.0885215551f},
-std::array<float,2>{0.695031941f, 0.679630935f},
-std::array<float,2>{0.195310131f, 0.906030059f},
-std::array<float,2>{0.627909362f, 0.364553213f},
-std::array<float,2>{0.271610647f, 0.128897801f},
-std::array<float,2>{0.981551945f, 0.555866361f},
-std::array<float,2>{0.415832698f, 0.70588398f},
-std::array<float,2>{0.808849514f, 0.0162181035f},
-std::array<float,2>{0.0352333114f, 0.414452255f},
-std::array<float,2>{0.602880895f, 0.82323736f},
-std::array<float,2>{0.139725834f, 0.644739211f},
-std::array<float,2>{0.72131151f, 0.10117989f},
-std::array<float,2>{0.371270686f, 0.473963976f},
-std::array<float,2>{0.931664646f, 0.78532356f},
-std::array<float,2>{0.486741662f, 0.998836517f},
-std::array<float,2>{0.839481771f, 0.264735669f},
-std::array<float,2>{0.0660683215f, 0.213927686f},
-std::array<float,2>{0.516466379f, 0.591630459f},
-std::array<float,2>{0.00942877587f, 0.873558402f},
-std::array<float,2>{0.570317388f, 0.393844754f},
-std::array<float,2>{0.378554404f, 0.0489259325f},
-std::array<float,2>{0.77231741f, 0.721637487f},
-std::array<float,2>{0.294298381f, 0.505701125f},
-std::array<float,2>{0.946517408f, 0.175662547f},
-std::array<float,2>{0.227157936f, 0.319507062f},
-std::array<float,2>{0.667050242f, 0.926665843f},
-std::array<float,2>{0.0823313072f, 0.728953719f},
-std::array<float,2>{0.501980484f, 0.0576834641f},
-std::array<float,2>{0.473702341f, 0.399026453f},
-std::array<float,2>{0.828048289f, 0.866282821f},
-std::array<float,2>{0.343947858f, 0.935406148f},
-std::array<float,2>{0.907944918f, 0.321496427f},
-std::array<float,2>{0.142274722f, 0.184704065f},
-std::array<float,2>{0.74425739f, 0.507941723f},
-std::array<float,2>{0.24479568f, 0.792118907f},
-std::array<float,2>{0.683429778f, 0.48292169f},
-std::array<float,2>{0.306310534f, 0.106977738f},
-std::array<float,2>{0.955800533f, 0.652448237f},
-std::array<float,2>{0.396179318f, 0.581778884f},
-std::array<float,2>{0.75803721f, 0.209074959f},
-std::array<float,2>{0.0225169286f, 0.251366824f},
-std::array<float,2>{0.590399027f, 0.991221726f},
-std::array<float,2>{0.183780119f, 0.554498434f},
-std::array<float,2>{0.7042346f, 0.13659808f},
-std::array<float,2>{0.34185645f, 0.372166365f},
-std::array<float,2>{0.895648122f, 0.896064878f},
-std::array<float,2>{0.445425987f, 0.818956614f},
-std::array<float,2>{0.852327228f, 0.413842857f},
-std::array<float,2>{0.093800962f, 0.0243940614f},
-std::array<float,2>{0.562222362f, 0.711369693f},
-std::array<float,2>{0.0547913201f, 0.940259397f},
-std::array<float,2>{0.618000388f, 0.311141908f},
-std::array<float,2>{0.429936111f, 0.244286433f},
-std::array<float,2>{0.787937999f, 0.615899026f},
-std::array<float,2>{0.252168417f, 0.682756245f},
-std::array<float,2>{0.988774717f, 0.0837199762f},
-std::array<float,2>{0.214759722f, 0.437761068f},
-std::array<float,2>{0.648357391f, 0.754856825f},
-std::array<float,2>{0.01304843f, 0.596131206f},
-std::array<float,2>{0.577021182f, 0.225118369f},
-std::array<float,2>{0.380338848f, 0.281719208f},
-std::array<float,2>{0.767761409f, 0.965026855f},
-std::array<float,2>{0.292442143f, 0.768370271f},
-std::array<float,2>{0.950315893f, 0.458924413f},
-std::array<float,2>{0.234245554f, 0.0770526528f},
-std::array<float,2>{0.670352459f, 0.667435467f},
-std::array<float,2>{0.135476887f, 0.877451658f},
-std::array<float,2>{0.724657655f, 0.35798347f},
-std::array<float,2>{0.367662758f, 0.146819085f},
-std::array<float,2>{0.937060416f, 0.531625748f},
-std::array<float,2>{0.491283208f, 0.695424855f},
-std::array<float,2>{0.841729879f, 0.00632922677f},
-std::array<float,2>{0.0675210506f, 0.432451934f},
-std::array<float,2>{0.521649778f, 0.82960856f},
-std::array<float,2>{0.189530015f, 0.62966913f},
-std::array<float,2>{0.629344642f, 0.119219281f},
-std::array<float,2>{0.267758965f, 0.498458803f},
-std::array<float,2>{0.976903021f, 0.797271252f},
-std::array<float,2>{0.420441538f, 0.974811196f},
-std::array<float,2>{0.805609405f, 0.268911213f},
-std::array<float,2>{0.0345092453f, 0.192843601f},
-std::array<float,2>{0.606829703f, 0.575454295f},
-std::array<float,2>{0.115261205f, 0.850746989f},
-std::array<float,2>{0.54304564f, 0.385756046f},
-std::array<float,2>{0.454624712f, 0.044093892f},
-std::array<float,2>{0.865690351f, 0.734983623f},
-std::array<float,2>{0.314930111f, 0.527613223f},
-std::array<float,2>{0.883312583f, 0.168536335f},
-std::array<float,2>{0.166027278f, 0.331500888f},
-std::array<float,2>{0.690751791f, 0.909875751f},
-std::array<float,2>{0.0444645323f, 0.661846936f},
-std::array<float,2>{0.595349729f, 0.0678801313f},
-std::array<float,2>{0.412972093f, 0.46781081f},
-std::array<float,2>{0.800593078f, 0.780889452f},
-std::array<float,2>{0.27542913f, 0.953543782f},
-std::array<float,2>{0.972548366f, 0.291912913f},
-std::array<float,2>{0.198686913f, 0.230938673f},
-std::array<float,2>{0.638381183f, 0.601718307f},
-std::array<float,2>{0.158022195f, 0.836170793f},
-std::array<float,2>{0.700739741f, 0.424242139f},
-std::array<float,2>{0.3207919f, 0.00829753745f},
-std::array<float,2>{0.881195009f, 0.690755367f},
-std::array<float,2>{0.462528765f, 0.544741631f},
-std::array<float,2>{0.87449491f, 0.154992461f},
-std::array<float,2>{0.122014113f, 0.350962043f},
-std::array<float,2>{0.536778331f, 0.890398502f},
-std::array<float,2>{0.219499245f, 0.565767586f},
-std::array<float,2>{0.660720646f, 0.195533425f},
-std::array<float,2>{0.28461054f, 0.280683011f},
-std::array<float,2>{0.939701676f, 0.977951109f},
-std::array<float,2>{0.387229919f, 0.811992943f},
-std::array<float,2>{0.778915286f, 0.489180088f},
-std::array<float,2>{0.00669374783f, 0.116061144f},
-std::array<float,2>{0.564398825f, 0.639526248f},
-std::array<float,2>{0.0765038207f, 0.919091403f},
-std::array<float,2>{0.527124405f, 0.341019064f},
-std::array<float,2>{0.49631682f, 0.162398174f},
-std::array<float,2>{0.835650682f, 0.517961144f},
-std::array<float,2>{0.366491556f, 0.748422265f},
-std::array<float,2>{0.928439736f, 0.03801075f},
-std::array<float,2>{0.13199079f, 0.380120933f},
-std::array<float,2>{0.726798415f, 0.855636001f},
-std::array<float,2>{0.102720469f, 0.501624227f},
-std::array<float,2>{0.549724221f, 0.177832365f},
-std::array<float,2>{0.445033163f, 0.313349456f},
-std::array<float,2>{0.849426389f, 0.925320148f},
-std::array<float,2>{0.335611999f, 0.870829165f},
-std::array<float,2>{0.903633475f, 0.397938102f},
-std::array<float,2>{0.177412868f, 0.0512096733f},
-std::array<float,2>{0.714804471f, 0.726122975f},
-std::array<float,2>{0.205711141f, 0.994285822f},
-std::array<float,2>{0.650443375f, 0.260045856f},
-std::array<float,2>{0.264009297f, 0.216683209f},
-std::array<float,2>{0.998784304f, 0.588811636f},
-std::array<float,2>{0.422041208f, 0.642043769f},
-std::array<float,2>{0.790506423f, 0.0954001322f},
-std::array<float,2>{0.0542031489f, 0.47249043f},
-std::array<float,2>{0.61433816f, 0.784601569f},
-std::array<float,2>{0.156218529f, 0.708215535f},
-std::array<float,2>{0.734808862f, 0.0207645129f},
-std::array<float,2>{0.354402333f, 0.418479264f},
-std::array<float,2>{0.916602015f, 0.826993287f},
-std::array<float,2>{0.483899951f, 0.898703098f},
-std::array<float,2>{0.813275337f, 0.361156076f},
-std::array<float,2>{0.093355529f, 0.131337315f},
-std::array<float,2>{0.511306465f, 0.560793042f},
-std::array<float,2>{0.0281948615f, 0.75928092f},
-std::array<float,2>{0.584368765f, 0.446957797f},
-std::array<float,2>{0.401046574f, 0.0910203531f},
-std::array<float,2>{0.757011354f, 0.675617874f},
-std::array<float,2>{0.299250543f, 0.624854147f},
-std::array<float,2>{0.967050612f, 0.239870667f},
-std::array<float,2>{0.240282342f, 0.298017442f},
-std::array<float,2>{0.672028601f, 0.951352119f},
-std::array<float,2>{0.118281707f, 0.649884164f},
-std::array<float,2>{0.53419733f, 0.10370329f},
-std::array<float,2>{0.465746105f, 0.478911698f},
-std::array<float,2>{0.869858682f, 0.796480536f},
-std::array<float,2>{0.327247918f, 0.986646295f},
-std::array<float,2>{0.877448201f, 0.257113457f},
-std::array<float,2>{0.160808742f, 0.206887081f},
-std::array<float,2>{0.696644843f, 0.582173049f},
-std::array<float,2>{0.199581295f, 0.860424101f},
-std::array<float,2>{0.634091675f, 0.404504567f},
-std::array<float,2>{0.279622197f, 0.0610629916f},
-std::array<float,2>{0.975701392f, 0.732191861f},
-std::array<float,2>{0.406941921f, 0.511996806f},
-std::array<float,2>{0.802124441f, 0.182042986f},
-std::array<float,2>{0.0401243791f, 0.328113556f},
-std::array<float,2>{0.597691774f, 0.93146956f},
-std::array<float,2>{0.128281742f, 0.611969113f},
-std::array<float,2>{0.73401171f, 0.246210173f},
-std::array<float,2>{0.362428099f, 0.307505101f},
-std::array<float,2>{0.922379076f, 0.945045769f},
-std::array<float,2>{0.493024141f, 0.751527905f},
-std::array<float,2>{0.82880193f, 0.441425294f},
-std::array<float,2>{0.0705335066f, 0.0807234868f},
-std::array<float,2>{0.528054357f, 0.685829937f},
-std::array<float,2>{0.000209472797f, 0.892121196f},
-std::array<float,2>{0.568650961f, 0.369694948f},
-std::array<float,2>{0.385107726f, 0.14054957f},
-std::array<float,2>{0.774354815f, 0.547517717f},
-std::array<float,2>{0.286319524f, 0.716161311f},
-std::array<float,2>{0.944647551f, 0.0300440919f},
-std::array<float,2>{0.223289773f, 0.409966141f},
-std::array<float,2>{0.659527659f, 0.813473344f},
-std::array<float,2>{0.0476168506f, 0.538361013f},
-std::array<float,2>{0.613081098f, 0.142832085f},
-std::array<float,2>{0.426695883f, 0.354568988f},
-std::array<float,2>{0.793226004f, 0.879000425f},
-std::array<float,2>{0.259165257f, 0.833298087f},
-std::array<float,2>{0.993465066f, 0.434814811f},
-std::array<float,2>{0.207119107f, 0.00288830465f},
-std::array<float,2>{0.652661502f, 0.701809883f},
-std::array<float,2>{0.173322558f, 0.961928785f},
-std::array<float,2>{0.717872918f, 0.288155854f},
-std::array<float,2>{0.330432534f, 0.221981868f},
-std::array<float,2>{0.901947379f, 0.598690331f},
-std::array<float,2>{0.438145608f, 0.668884277f},
-std::array<float,2>{0.844674587f, 0.0719732121f},
-std::array<float,2>{0.10591273f, 0.455798924f},
-std::array<float,2>{0.553870797f, 0.772673368f},
-std::array<float,2>{0.235451654f, 0.741780341f},
-std::array<float,2>{0.676695943f, 0.0417682007f},
-std::array<float,2>{0.302129894f, 0.390566081f},
-std::array<float,2>{0.964401424f, 0.844128668f},
-std::array<float,2>{0.405583352f, 0.911998928f},
-std::array<float,2>{0.752840042f, 0.332619011f},
-std::array<float,2>{0.0246860124f, 0.165564135f},
-std::array<float,2>{0.58097589f, 0.524772048f},
-std::array<float,2>{0.0869524106f, 0.803742349f},
-std::array<float,2>{0.511916101f, 0.493425876f},
-std::array<float,2>{0.476737708f, 0.124477431f},
-std::array<float,2>{0.819940984f, 0.627557933f},
-std::array<float,2>{0.358226776f, 0.573181689f},
-std::array<float,2>{0.918771386f, 0.190517187f},
-std::array<float,2>{0.148628235f, 0.273360938f},
-std::array<float,2>{0.739253998f, 0.972172618f},
-std::array<float,2>{0.0177982915f, 0.692432582f},
-std::array<float,2>{0.58705312f, 0.0131196398f},
-std::array<float,2>{0.392447054f, 0.428899676f},
-std::array<float,2>{0.764694691f, 0.840037227f},
-std::array<float,2>{0.311748892f, 0.885226727f},
-std::array<float,2>{0.958762944f, 0.34695372f},
-std::array<float,2>{0.246204212f, 0.151975289f},
-std::array<float,2>{0.684602201f, 0.541626275f},
-std::array<float,2>{0.145869866f, 0.77511245f},
-std::array<float,2>{0.746403754f, 0.463688046f},
-std::array<float,2>{0.34780407f, 0.0633277148f},
-std::array<float,2>{0.913019478f, 0.658353806f},
-std::array<float,2>{0.46973297f, 0.608071446f},
-std::array<float,2>{0.821496904f, 0.226629779f},
-std::array<float,2>{0.078815192f, 0.296296388f},
-std::array<float,2>{0.504302084f, 0.959255397f},
-std::array<float,2>{0.218234316f, 0.520013988f},
-std::array<float,2>{0.64260751f, 0.157067686f},
-std::array<float,2>{0.257638216f, 0.339372844f},
-std::array<float,2>{0.988183498f, 0.915734768f},
-std::array<float,2>{0.434762567f, 0.853400767f},
-std::array<float,2>{0.78285569f, 0.376131386f},
-std::array<float,2>{0.0623772591f, 0.0334321484f},
-std::array<float,2>{0.622322857f, 0.744622052f},
-std::array<float,2>{0.0990404338f, 0.982989132f},
-std::array<float,2>{0.556524456f, 0.276859939f},
-std::array<float,2>{0.450213164f, 0.199868366f},
-std::array<float,2>{0.857257068f, 0.569618881f},
-std::array<float,2>{0.339200258f, 0.633312643f},
-std::array<float,2>{0.894209504f, 0.111852042f},
-std::array<float,2>{0.182926327f, 0.488197744f},
-std::array<float,2>{0.707906842f, 0.807578087f},
-std::array<float,2>{0.0635454357f, 0.592702568f},
-std::array<float,2>{0.518975496f, 0.212016255f},
-std::array<float,2>{0.484746069f, 0.262330413f},
-std::array<float,2>{0.837007284f, 0.997109652f},
-std::array<float,2>{0.374408424f, 0.787284076f},
-std::array<float,2>{0.930627823f, 0.475109369f},
-std::array<float,2>{0.137474075f, 0.098570846f},
-std::array<float,2>{0.719107151f, 0.646505654f},
-std::array<float,2>{0.230264053f, 0.927756727f},
-std::array<float,2>{0.66582936f, 0.31759122f},
-std::array<float,2>{0.295578569f, 0.173791349f},
-std::array<float,2>{0.947935343f, 0.507418275f},
-std::array<float,2>{0.375802457f, 0.719882786f},
-std::array<float,2>{0.770151079f, 0.0474337824f},
-std::array<float,2>{0.0106628137f, 0.391620696f},
-std::array<float,2>{0.573520064f, 0.872918487f},
-std::array<float,2>{0.168488562f, 0.677414417f},
-std::array<float,2>{0.691733062f, 0.0861966908f},
-std::array<float,2>{0.316824704f, 0.452513307f},
-std::array<float,2>{0.889363766f, 0.764054239f},
-std::array<float,2>{0.457861841f, 0.946854591f},
-std::array<float,2>{0.859976768f, 0.30272913f},
-std::array<float,2>{0.109737322f, 0.237734869f},
-std::array<float,2>{0.539732099f, 0.62069273f},
-std::array<float,2>{0.0390230007f, 0.821793377f},
-std::array<float,2>{0.603670478f, 0.417068928f},
-std::array<float,2>{0.417744279f, 0.0177644547f},
-std::array<float,2>{0.810853004f, 0.703615427f},
-std::array<float,2>{0.269955367f, 0.556732535f},
-std::array<float,2>{0.983741939f, 0.126843616f},
-std::array<float,2>{0.19226338f, 0.366643578f},
-std::array<float,2>{0.6266765f, 0.903977156f},
-std::array<float,2>{0.114215486f, 0.73613888f},
-std::array<float,2>{0.546565175f, 0.0432912521f},
-std::array<float,2>{0.456369698f, 0.384989083f},
-std::array<float,2>{0.864110112f, 0.850399852f},
-std::array<float,2>{0.312602937f, 0.909053087f},
-std::array<float,2>{0.884965062f, 0.330441028f},
-std::array<float,2>{0.164435491f, 0.169817701f},
-std::array<float,2>{0.689351141f, 0.528791964f},
-std::array<float,2>{0.189390644f, 0.798110664f},
-std::array<float,2>{0.632668555f, 0.499177247f},
-std::array<float,2>{0.265832335f, 0.120453298f},
-std::array<float,2>{0.979901195f, 0.630781293f},
-std::array<float,2>{0.418864489f, 0.574624598f},
-std::array<float,2>{0.807192922f, 0.192055419f},
-std::array<float,2>{0.0313490629f, 0.267666042f},
-std::array<float,2>{0.609166086f, 0.976298571f},
-std::array<float,2>{0.132911429f, 0.532470047f},
-std::array<float,2>{0.723855019f, 0.14820613f},
-std::array<float,2>{0.370126635f, 0.359217703f},
-std::array<float,2>{0.933884919f, 0.878236234f},
-std::array<float,2>{0.488499314f, 0.82893604f},
-std::array<float,2>{0.843151093f, 0.433020234f},
-std::array<float,2>{0.0693406463f, 0.00772386696f},
-std::array<float,2>{0.52018255f, 0.697155118f},
-std::array<float,2>{0.0154829137f, 0.966362834f},
-std::array<float,2>{0.575616539f, 0.282974213f},
-std::array<float,2>{0.382137209f, 0.225899801f},
-std::array<float,2>{0.76714921f, 0.597276747f},
-std::array<float,2>{0.289307147f, 0.666294813f},
-std::array<float,2>{0.952718258f, 0.0771986321f},
-std::array<float,2>{0.232283413f, 0.457435727f},
-std::array<float,2>{0.667998195f, 0.768594086f},
-std::array<float,2>{0.0581626371f, 0.616350412f},
-std::array<float,2>{0.619328201f, 0.246030673f},
-std::array<float,2>{0.433507293f, 0.311978757f},
-std::array<float,2>{0.785672963f, 0.940645993f},
-std::array<float,2>{0.251913756f, 0.755536735f},
-std::array<float,2>{0.991533995f, 0.43907553f},
-std::array<float,2>{0.211279914f, 0.0821359381f},
-std::array<float,2>{0.646241665f, 0.682019055f},
-std::array<float,2>{0.187026694f, 0.895438433f},
-std::array<float,2>{0.705080748f, 0.371971518f},
-std::array<float,2>{0.340726793f, 0.135264665f},
-std::array<float,2>{0.897772014f, 0.553335011f},
-std::array<float,2>{0.447673053f, 0.71199584f},
-std::array<float,2>{0.854415238f, 0.0249334145f},
-std::array<float,2>{0.0965525955f, 0.412468135f},
-std::array<float,2>{0.559561491f, 0.819526017f},
-std::array<float,2>{0.242660537f, 0.654290855f},
-std::array<float,2>{0.679780006f, 0.106288195f},
-std::array<float,2>{0.307327449f, 0.48368451f},
-std::array<float,2>{0.954065979f, 0.791349649f},
-std::array<float,2>{0.397689611f, 0.99118042f},
-std::array<float,2>{0.761646688f, 0.250248164f},
-std::array<float,2>{0.0208470207f, 0.210700661f},
-std::array<float,2>{0.593357861f, 0.580974102f},
-std::array<float,2>{0.0848559141f, 0.865681887f},
-std::array<float,2>{0.500840902f, 0.400235206f},
-std::array<float,2>{0.475409776f, 0.0573603474f},
-std::array<float,2>{0.825272322f, 0.729706109f},
-std::array<float,2>{0.346408457f, 0.509283304f},
-std::array<float,2>{0.908711612f, 0.184080824f},
-std::array<float,2>{0.142581508f, 0.320678324f},
-std::array<float,2>{0.743830621f, 0.933757842f},
-std::array<float,2>{0.0301286895f, 0.674577355f},
-std::array<float,2>{0.582072556f, 0.0900066867f},
-std::array<float,2>{0.400231451f, 0.445588022f},
-std::array<float,2>{0.755640209f, 0.758368194f},
-std::array<float,2>{0.297781736f, 0.952635467f},
-std::array<float,2>{0.96669668f, 0.297804415f},
-std::array<float,2>{0.240142137f, 0.23912923f},
-std::array<float,2>{0.675412297f, 0.623087227f},
-std::array<float,2>{0.15373078f, 0.827580333f},
-std::array<float,2>{0.737790644f, 0.419885397f},
-std::array<float,2>{0.35169819f, 0.0204452183f},
-std::array<float,2>{0.915582716f, 0.707791686f},
-std::array<float,2>{0.482009023f, 0.562292337f},
-std::array<float,2>{0.815410793f, 0.13213253f},
-std::array<float,2>{0.0908153504f, 0.359568357f},
-std::array<float,2>{0.508144438f, 0.900039792f},
-std::array<float,2>{0.204415783f, 0.589687407f},
-std::array<float,2>{0.648800135f, 0.21490179f},
-std::array<float,2>{0.261840075f, 0.260813296f},
-std::array<float,2>{0.99616462f, 0.995570183f},
-std::array<float,2>{0.424416214f, 0.783240914f},
-std::array<float,2>{0.792164862f, 0.471090972f},
-std::array<float,2>{0.0522645153f, 0.0941965804f},
-std::array<float,2>{0.615960121f, 0.640860915f},
-std::array<float,2>{0.104162641f, 0.924706757f},
-std::array<float,2>{0.547997713f, 0.314214587f},
-std::array<float,2>{0.44243744f, 0.179225668f},
-std::array<float,2>{0.85085845f, 0.50004375f},
-std::array<float,2>{0.332317978f, 0.724621654f},
-std::array<float,2>{0.905250907f, 0.0526951812f},
-std::array<float,2>{0.178922176f, 0.397320539f},
-std::array<float,2>{0.712332368f, 0.86945647f},
-std::array<float,2>{0.0746734813f, 0.518577933f},
-std::array<float,2>{0.52468735f, 0.163529307f},
-std::array<float,2>{0.49885723f, 0.340354472f},
-std::array<float,2>{0.832231879f, 0.918091774f},
-std::array<float,2>{0.364406586f, 0.85650295f},
-std::array<float,2>{0.927677214f, 0.379537702f},
-std::array<float,2>{0.130301878f, 0.0388742872f},
-std::array<float,2>{0.728773594f, 0.749237597f},
-std::array<float,2>{0.220886484f, 0.976951897f},
-std::array<float,2>{0.663706481f, 0.279335111f},
-std::array<float,2>{0.281901747f, 0.196414903f},
-std::array<float,2>{0.938154578f, 0.564602733f},
-std::array<float,2>{0.390235692f, 0.640580058f},
-std::array<float,2>{0.78066355f, 0.116848819f},
-std::array<float,2>{0.00577954296f, 0.489611357f},
-std::array<float,2>{0.564916015f, 0.810605764f},
-std::array<float,2>{0.158688515f, 0.68949753f},
-std::array<float,2>{0.70151341f, 0.00886020251f},
-std::array<float,2>{0.322940767f, 0.425462693f},
-std::array<float,2>{0.880368173f, 0.837290645f},
-std::array<float,2>{0.463509023f, 0.889005125f},
-std::array<float,2>{0.871527851f, 0.34982729f},
-std::array<float,2>{0.123761833f, 0.156030595f},
-std::array<float,2>{0.538627863f, 0.543174326f},
-std::array<float,2>{0.0456104875f, 0.779675961f},
-std::array<float,2>{0.596329868f, 0.467270344f},
-std::array<float,2>{0.410443425f, 0.0668816119f},
-std::array<float,2>{0.797371864f, 0.660776615f},
-std::array<float,2>{0.274960726f, 0.603354633f},
-std::array<float,2>{0.96908778f, 0.232094318f},
-std::array<float,2>{0.19555217f, 0.292757958f},
-std::array<float,2>{0.640120149f, 0.954421759f},
-std::array<float,2>{0.0881536007f, 0.628450334f},
-std::array<float,2>{0.514369667f, 0.123109803f},
-std::array<float,2>{0.478657007f, 0.493097454f},
-std::array<float,2>{0.816529274f, 0.803460836f},
-std::array<float,2>{0.35569638f, 0.970947146f},
-std::array<float,2>{0.921407342f, 0.272220582f},
-std::array<float,2>{0.151868865f, 0.189741924f},
-std::array<float,2>{0.740753829f, 0.573746324f},
-std::array<float,2>{0.237755328f, 0.844978869f},
-std::array<float,2>{0.677852511f, 0.389536798f},
-std::array<float,2>{0.303155154f, 0.0420794375f},
-std::array<float,2>{0.962056935f, 0.740619123f},
-std::array<float,2>{0.403343737f, 0.523983061f},
-std::array<float,2>{0.75054729f, 0.164882198f},
-std::array<float,2>{0.0264814161f, 0.333316714f},
-std::array<float,2>{0.579115391f, 0.911048174f},
-std::array<float,2>{0.174057722f, 0.598474741f},
-std::array<float,2>{0.71555984f, 0.220952854f},
-std::array<float,2>{0.328651428f, 0.287550718f},
-std::array<float,2>{0.900204718f, 0.961813211f},
-std::array<float,2>{0.44054836f, 0.772296429f},
-std::array<float,2>{0.846737504f, 0.456612617f},
-std::array<float,2>{0.108454056f, 0.0709189177f},
-std::array<float,2>{0.552242339f, 0.669834137f},
-std::array<float,2>{0.0496287607f, 0.880641401f},
-std::array<float,2>{0.611123085f, 0.353814453f},
-std::array<float,2>{0.428514093f, 0.143953636f},
-std::array<float,2>{0.79584986f, 0.537372947f},
-std::array<float,2>{0.260276586f, 0.702197671f},
-std::array<float,2>{0.995921373f, 0.00335633475f},
-std::array<float,2>{0.2107438f, 0.434472203f},
-std::array<float,2>{0.655360401f, 0.832854152f},
-std::array<float,2>{0.00350680947f, 0.548082232f},
-std::array<float,2>{0.56746614f, 0.139095142f},
-std::array<float,2>{0.383679807f, 0.370698035f},
-std::array<float,2>{0.775716007f, 0.891020954f},
-std::array<float,2>{0.289024144f, 0.814021409f},
-std::array<float,2>{0.94202888f, 0.409020782f},
-std::array<float,2>{0.224834651f, 0.0303149968f},
-std::array<float,2>{0.657731116f, 0.715021551f},
-std::array<float,2>{0.125530601f, 0.943757594f},
-std::array<float,2>{0.731747806f, 0.30797863f},
-std::array<float,2>{0.359787047f, 0.247352913f},
-std::array<float,2>{0.925719321f, 0.612644076f},
-std::array<float,2>{0.495633006f, 0.686879814f},
-std::array<float,2>{0.831377447f, 0.0816810727f},
-std::array<float,2>{0.0742050111f, 0.442812055f},
-std::array<float,2>{0.529491067f, 0.750921965f},
-std::array<float,2>{0.20231621f, 0.730901301f},
-std::array<float,2>{0.636582673f, 0.0615276508f},
-std::array<float,2>{0.278139889f, 0.406083465f},
-std::array<float,2>{0.973902941f, 0.860037506f},
-std::array<float,2>{0.409231871f, 0.929783285f},
-std::array<float,2>{0.803648353f, 0.326883554f},
-std::array<float,2>{0.0417768694f, 0.183081925f},
-std::array<float,2>{0.600668967f, 0.512915969f},
-std::array<float,2>{0.119201697f, 0.795692444f},
-std::array<float,2>{0.532984376f, 0.479594946f},
-std::array<float,2>{0.46720013f, 0.105434299f},
-std::array<float,2>{0.867800117f, 0.649227977f},
-std::array<float,2>{0.324616402f, 0.583693922f},
-std::array<float,2>{0.875611067f, 0.205836147f},
-std::array<float,2>{0.162482992f, 0.256410986f},
-std::array<float,2>{0.697354674f, 0.988265753f},
-std::array<float,2>{0.0369271562f, 0.704279006f},
-std::array<float,2>{0.602448344f, 0.0186939687f},
-std::array<float,2>{0.414668411f, 0.416134059f},
-std::array<float,2>{0.81029588f, 0.820831537f},
-std::array<float,2>{0.273382217f, 0.902687311f},
-std::array<float,2>{0.981075585f, 0.366009772f},
-std::array<float,2>{0.194335625f, 0.125030905f},
-std::array<float,2>{0.628901064f, 0.558450282f},
-std::array<float,2>{0.171698153f, 0.765024126f},
-std::array<float,2>{0.694133282f, 0.451486707f},
-std::array<float,2>{0.319841474f, 0.0871770158f},
-std::array<float,2>{0.886965096f, 0.676417887f},
-std::array<float,2>{0.460130036f, 0.619470119f},
-std::array<float,2>{0.862830341f, 0.236832246f},
-std::array<float,2>{0.111515105f, 0.301612914f},
-std::array<float,2>{0.541894257f, 0.945885241f},
-std::array<float,2>{0.228421241f, 0.506159008f},
-std::array<float,2>{0.666846573f, 0.17262958f},
-std::array<float,2>{0.293322682f, 0.316515744f},
-std::array<float,2>{0.946173131f, 0.929109812f},
-std::array<float,2>{0.377471149f, 0.871855557f},
-std::array<float,2>{0.77278471f, 0.391293406f},
-std::array<float,2>{0.00842750818f, 0.0485439561f},
-std::array<float,2>{0.572009444f, 0.719232917f},
-std::array<float,2>{0.0646935925f, 0.996483445f},
-std::array<float,2>{0.517384768f, 0.263464928f},
-std::array<float,2>{0.487695128f, 0.211906955f},
-std::array<float,2>{0.838092387f, 0.59346652f},
-std::array<float,2>{0.372134f, 0.648346305f},
-std::array<float,2>{0.933501303f, 0.0991801322f},
-std::array<float,2>{0.139188394f, 0.476039588f},
-std::array<float,2>{0.722038269f, 0.788262069f},
-std::array<float,2>{0.0999917611f, 0.569102645f},
-std::array<float,2>{0.558489203f, 0.20046401f},
-std::array<float,2>{0.451738715f, 0.275450259f},
-std::array<float,2>{0.858889997f, 0.983669341f},
-std::array<float,2>{0.336496025f, 0.808502436f},
-std::array<float,2>{0.892459273f, 0.486689359f},
-std::array<float,2>{0.180943534f, 0.112853885f},
-std::array<float,2>{0.710365057f, 0.634218633f},
-std::array<float,2>{0.215342954f, 0.914121389f},
-std::array<float,2>{0.641861975f, 0.338598251f},
-std::array<float,2>{0.255692005f, 0.157977104f},
-std::array<float,2>{0.985309601f, 0.521380424f},
-std::array<float,2>{0.436903566f, 0.745367467f},
-std::array<float,2>{0.784623444f, 0.0350678377f},
-std::array<float,2>{0.0595629662f, 0.375098765f},
-std::array<float,2>{0.623959363f, 0.851596534f},
-std::array<float,2>{0.148355171f, 0.659644961f},
-std::array<float,2>{0.748787165f, 0.0642438084f},
-std::array<float,2>{0.350141823f, 0.464300603f},
-std::array<float,2>{0.911163092f, 0.77402395f},
-std::array<float,2>{0.472599953f, 0.959961057f},
-std::array<float,2>{0.823266804f, 0.295758039f},
-std::array<float,2>{0.08033178f, 0.227814898f},
-std::array<float,2>{0.506804287f, 0.608842134f},
-std::array<float,2>{0.0166945755f, 0.841724038f},
-std::array<float,2>{0.588355899f, 0.427888632f},
-std::array<float,2>{0.394134521f, 0.011784696f},
-std::array<float,2>{0.762293279f, 0.691858828f},
-std::array<float,2>{0.30959475f, 0.542328656f},
-std::array<float,2>{0.959877849f, 0.151048496f},
-std::array<float,2>{0.248550028f, 0.345779538f},
-std::array<float,2>{0.685638011f, 0.886039615f},
-std::array<float,2>{0.0665338859f, 0.698644936f},
-std::array<float,2>{0.522913814f, 0.00568063557f},
-std::array<float,2>{0.490284294f, 0.429849803f},
-std::array<float,2>{0.840676963f, 0.830772102f},
-std::array<float,2>{0.368900955f, 0.875664234f},
-std::array<float,2>{0.936394215f, 0.355764568f},
-std::array<float,2>{0.136578456f, 0.145575017f},
-std::array<float,2>{0.726344585f, 0.53338033f},
-std::array<float,2>{0.23267898f, 0.767146468f},
-std::array<float,2>{0.671810567f, 0.460196525f},
-std::array<float,2>{0.291266203f, 0.0742742866f},
-std::array<float,2>{0.949486375f, 0.665292263f},
-std::array<float,2>{0.379247606f, 0.593763947f},
-std::array<float,2>{0.768655419f, 0.223229662f},
-std::array<float,2>{0.0124592911f, 0.284428328f},
-std::array<float,2>{0.577495933f, 0.968145788f},
-std::array<float,2>{0.16705513f, 0.529329538f},
-std::array<float,2>{0.689542472f, 0.171372086f},
-std::array<float,2>{0.31615442f, 0.329089791f},
-std::array<float,2>{0.884651542f, 0.908168316f},
-std::array<float,2>{0.453173161f, 0.847918332f},
-std::array<float,2>{0.86676079f, 0.38461116f},
-std::array<float,2>{0.116633058f, 0.0457811505f},
-std::array<float,2>{0.5448246f, 0.737525046f},
-std::array<float,2>{0.0337759703f, 0.973358333f},
-std::array<float,2>{0.605559707f, 0.266682208f},
-std::array<float,2>{0.421304733f, 0.194334269f},
-std::array<float,2>{0.80592382f, 0.577845693f},
-std::array<float,2>{0.26932469f, 0.630929589f},
-std::array<float,2>{0.978168249f, 0.117820144f},
-std::array<float,2>{0.191363215f, 0.496215194f},
-std::array<float,2>{0.630819976f, 0.800522447f},
-std::array<float,2>{0.0220656525f, 0.580039918f},
-std::array<float,2>{0.591675341f, 0.20809707f},
-std::array<float,2>{0.394762576f, 0.252004981f},
-std::array<float,2>{0.759663999f, 0.990052283f},
-std::array<float,2>{0.305122972f, 0.789771616f},
-std::array<float,2>{0.956492186f, 0.481184065f},
-std::array<float,2>{0.245600656f, 0.107715294f},
-std::array<float,2>{0.682452202f, 0.655503035f},
-std::array<float,2>{0.14092207f, 0.937431931f},
-std::array<float,2>{0.745509446f, 0.323746204f},
-std::array<float,2>{0.344832063f, 0.185969561f},
-std::array<float,2>{0.90704298f, 0.51150769f},
-std::array<float,2>{0.473149925f, 0.726904094f},
-std::array<float,2>{0.827060103f, 0.0565595739f},
-std::array<float,2>{0.0839830488f, 0.400397748f},
-std::array<float,2>{0.50342536f, 0.864390671f},
-std::array<float,2>{0.213771686f, 0.681388021f},
-std::array<float,2>{0.646801531f, 0.0854089558f},
-std::array<float,2>{0.253063172f, 0.441170216f},
-std::array<float,2>{0.989966989f, 0.757527828f},
-std::array<float,2>{0.430727452f, 0.93881011f},
-std::array<float,2>{0.788543463f, 0.310405016f},
-std::array<float,2>{0.0563778765f, 0.243273512f},
-std::array<float,2>{0.618326008f, 0.613684535f},
-std::array<float,2>{0.0950177759f, 0.816532016f},
-std::array<float,2>{0.56110692f, 0.410536259f},
-std::array<float,2>{0.446935862f, 0.025869377f},
-std::array<float,2>{0.85291028f, 0.714019299f},
-std::array<float,2>{0.343497723f, 0.552172959f},
-std::array<float,2>{0.895022213f, 0.134347007f},
-std::array<float,2>{0.185313538f, 0.373187155f},
-std::array<float,2>{0.703844309f, 0.897003233f},
-std::array<float,2>{0.0533630252f, 0.643175244f},
-std::array<float,2>{0.614088714f, 0.0966889784f},
-std::array<float,2>{0.423619598f, 0.469847023f},
-std::array<float,2>{0.789367557f, 0.782827139f},
-std::array<float,2>{0.264821976f, 0.994097888f},
-std::array<float,2>{0.999952793f, 0.25853771f},
-std::array<float,2>{0.206875443f, 0.217257753f},
-std::array<float,2>{0.651934981f, 0.587727427f},
-std::array<float,2>{0.176711112f, 0.868739426f},
-std::array<float,2>{0.712981999f, 0.395894408f},
-std::array<float,2>{0.334174275f, 0.0541799627f},
-std::array<float,2>{0.902842104f, 0.724038363f},
-std::array<float,2>{0.443947077f, 0.502055109f},
-std::array<float,2>{0.848206937f, 0.176652968f},
-std::array<float,2>{0.10170114f, 0.31472975f},
-std::array<float,2>{0.550451398f, 0.9237293f},
-std::array<float,2>{0.242145121f, 0.621233225f},
-std::array<float,2>{0.672938704f, 0.241485611f},
-std::array<float,2>{0.300076187f, 0.299913406f},
-std::array<float,2>{0.968450248f, 0.950241089f},
-std::array<float,2>{0.401794434f, 0.760294318f},
-std::array<float,2>{0.75674516f, 0.447419047f},
-std::array<float,2>{0.0284383576f, 0.0929895937f},
-std::array<float,2>{0.585531652f, 0.673622549f},
-std::array<float,2>{0.0920672342f, 0.900405228f},
-std::array<float,2>{0.510539114f, 0.361944199f},
-std::array<float,2>{0.483341068f, 0.130440265f},
-std::array<float,2>{0.813895106f, 0.55936408f},
-std::array<float,2>{0.354676694f, 0.709070504f},
-std::array<float,2>{0.917512298f, 0.0227697566f},
-std::array<float,2>{0.155257776f, 0.42089504f},
-std::array<float,2>{0.73556006f, 0.825430036f},
-std::array<float,2>{0.122624665f, 0.54509747f},
-std::array<float,2>{0.53522253f, 0.15420267f},
-std::array<float,2>{0.460983455f, 0.349030197f},
-std::array<float,2>{0.873414457f, 0.888100505f},
-std::array<float,2>{0.321868122f, 0.839216411f},
-std::array<float,2>{0.881956279f, 0.423401505f},
-std::array<float,2>{0.156402066f, 0.0109246774f},
-std::array<float,2>{0.699598968f, 0.687518299f},
-std::array<float,2>{0.197427019f, 0.956260979f},
-std::array<float,2>{0.636891186f, 0.290838122f},
-std::array<float,2>{0.276660413f, 0.232978463f},
-std::array<float,2>{0.970887363f, 0.603762031f},
-std::array<float,2>{0.413612217f, 0.663860619f},
-std::array<float,2>{0.799232602f, 0.0698472038f},
-std::array<float,2>{0.0431990214f, 0.46649003f},
-std::array<float,2>{0.594333768f, 0.779147029f},
-std::array<float,2>{0.131603688f, 0.746288121f},
-std::array<float,2>{0.727859378f, 0.0356232598f},
-std::array<float,2>{0.365711957f, 0.382730305f},
-std::array<float,2>{0.928836465f, 0.859253526f},
-std::array<float,2>{0.497206956f, 0.920096457f},
-std::array<float,2>{0.834866166f, 0.341954589f},
-std::array<float,2>{0.0775827467f, 0.16164951f},
-std::array<float,2>{0.525454283f, 0.516782403f},
-std::array<float,2>{0.00686043315f, 0.809270561f},
-std::array<float,2>{0.563206494f, 0.491416126f},
-std::array<float,2>{0.387827635f, 0.114534326f},
-std::array<float,2>{0.778054893f, 0.637263894f},
-std::array<float,2>{0.284112066f, 0.562940001f},
-std::array<float,2>{0.940916836f, 0.198646933f},
-std::array<float,2>{0.22065261f, 0.27818501f},
-std::array<float,2>{0.661226571f, 0.978574634f},
-std::array<float,2>{0.106823325f, 0.670842528f},
-std::array<float,2>{0.55305481f, 0.0738315731f},
-std::array<float,2>{0.438798189f, 0.454866648f},
-std::array<float,2>{0.844837785f, 0.770792186f},
-std::array<float,2>{0.331848025f, 0.964684129f},
-std::array<float,2>{0.900778472f, 0.28701514f},
-std::array<float,2>{0.172496542f, 0.220172063f},
-std::array<float,2>{0.717712641f, 0.600483239f},
-std::array<float,2>{0.208083466f, 0.835544169f},
-std::array<float,2>{0.653450906f, 0.43643719f},
-std::array<float,2>{0.257843852f, 0.00096427754f},
-std::array<float,2>{0.992432117f, 0.701111555f},
-std::array<float,2>{0.426939875f, 0.53601402f},
-std::array<float,2>{0.794541836f, 0.142146498f},
-std::array<float,2>{0.0484441705f, 0.351835877f},
-std::array<float,2>{0.611960292f, 0.880864024f},
-std::array<float,2>{0.150086477f, 0.571790338f},
-std::array<float,2>{0.739301205f, 0.188836515f},
-std::array<float,2>{0.359000444f, 0.271307379f},
-std::array<float,2>{0.919244647f, 0.969979405f},
-std::array<float,2>{0.477633297f, 0.800799727f},
-std::array<float,2>{0.818810105f, 0.494655252f},
-std::array<float,2>{0.0860582367f, 0.122989006f},
-std::array<float,2>{0.51333034f, 0.626285672f},
-std::array<float,2>{0.0242831223f, 0.913282156f},
-std::array<float,2>{0.581646621f, 0.334791809f},
-std::array<float,2>{0.404549867f, 0.167212978f},
-std::array<float,2>{0.75349313f, 0.525516212f},
-std::array<float,2>{0.300915807f, 0.738887072f},
-std::array<float,2>{0.963794827f, 0.0394700617f},
-std::array<float,2>{0.234452978f, 0.387406439f},
-std::array<float,2>{0.67696023f, 0.846971571f},
-std::array<float,2>{0.0396308638f, 0.513922513f},
-std::array<float,2>{0.598710775f, 0.180616587f},
-std::array<float,2>{0.407394707f, 0.325848907f},
-std::array<float,2>{0.801088512f, 0.932735085f},
-std::array<float,2>{0.281226426f, 0.862806141f},
-std::array<float,2>{0.975282073f, 0.402685046f},
-std::array<float,2>{0.200835034f, 0.0603957698f},
-std::array<float,2>{0.633330584f, 0.733808458f},
-std::array<float,2>{0.161858082f, 0.984691739f},
-std::array<float,2>{0.69573319f, 0.255370021f},
-std::array<float,2>{0.326807439f, 0.204689071f},
-std::array<float,2>{0.878361642f, 0.584494114f},
-std::array<float,2>{0.466491699f, 0.650523067f},
-std::array<float,2>{0.870584786f, 0.102007888f},
-std::array<float,2>{0.117192872f, 0.478493422f},
-std::array<float,2>{0.53377521f, 0.794363856f},
-std::array<float,2>{0.22439459f, 0.71832335f},
-std::array<float,2>{0.658933342f, 0.0280688908f},
-std::array<float,2>{0.285601705f, 0.407000214f},
-std::array<float,2>{0.943507552f, 0.816113532f},
-std::array<float,2>{0.386592627f, 0.893249452f},
-std::array<float,2>{0.775146663f, 0.368246734f},
-std::array<float,2>{0.00109844131f, 0.138637781f},
-std::array<float,2>{0.569894135f, 0.549991071f},
-std::array<float,2>{0.0717886686f, 0.75271672f},
-std::array<float,2>{0.529101431f, 0.444520473f},
-std::array<float,2>{0.493207067f, 0.0792867914f},
-std::array<float,2>{0.829949975f, 0.685178101f},
-std::array<float,2>{0.361956f, 0.609901905f},
-std::array<float,2>{0.923260868f, 0.248362154f},
-std::array<float,2>{0.127286956f, 0.30617398f},
-std::array<float,2>{0.733349085f, 0.943138063f},
-std::array<float,2>{0.0108891325f, 0.721885741f},
-std::array<float,2>{0.573032558f, 0.050182119f},
-std::array<float,2>{0.376715243f, 0.39302054f},
-std::array<float,2>{0.771221876f, 0.874808133f},
-std::array<float,2>{0.296521753f, 0.927326202f},
-std::array<float,2>{0.949163318f, 0.319019377f},
-std::array<float,2>{0.228686392f, 0.174325407f},
-std::array<float,2>{0.664116144f, 0.504467905f},
-std::array<float,2>{0.138386801f, 0.786626875f},
-std::array<float,2>{0.719755471f, 0.472972602f},
-std::array<float,2>{0.373152375f, 0.100158043f},
-std::array<float,2>{0.930760324f, 0.646465003f},
-std::array<float,2>{0.485460162f, 0.590041459f},
-std::array<float,2>{0.836620629f, 0.213398874f},
-std::array<float,2>{0.0625288785f, 0.264361113f},
-std::array<float,2>{0.518439651f, 0.999123633f},
-std::array<float,2>{0.192728981f, 0.554969907f},
-std::array<float,2>{0.625527799f, 0.127287284f},
-std::array<float,2>{0.270910889f, 0.363395154f},
-std::array<float,2>{0.982794523f, 0.904782534f},
-std::array<float,2>{0.416098475f, 0.823945642f},
-std::array<float,2>{0.8117522f, 0.415063053f},
-std::array<float,2>{0.0374718793f, 0.0175315309f},
-std::array<float,2>{0.605164111f, 0.706633449f},
-std::array<float,2>{0.110746965f, 0.948159456f},
-std::array<float,2>{0.540768802f, 0.304549217f},
-std::array<float,2>{0.458114952f, 0.235631436f},
-std::array<float,2>{0.860640287f, 0.617188811f},
-std::array<float,2>{0.318119526f, 0.678346217f},
-std::array<float,2>{0.889916301f, 0.0890157223f},
-std::array<float,2>{0.169858605f, 0.449273974f},
-std::array<float,2>{0.692863107f, 0.762759328f},
-std::array<float,2>{0.0791053772f, 0.60645777f},
-std::array<float,2>{0.505278528f, 0.229177445f},
-std::array<float,2>{0.469547331f, 0.293566227f},
-std::array<float,2>{0.820821404f, 0.957221985f},
-std::array<float,2>{0.348789543f, 0.776498437f},
-std::array<float,2>{0.914023042f, 0.461472452f},
-std::array<float,2>{0.144898787f, 0.065025799f},
-std::array<float,2>{0.747193456f, 0.657375813f},
-std::array<float,2>{0.247531459f, 0.883353472f},
-std::array<float,2>{0.68403393f, 0.344997615f},
-std::array<float,2>{0.310768574f, 0.149657562f},
-std::array<float,2>{0.957451403f, 0.539171517f},
-std::array<float,2>{0.39112848f, 0.69376415f},
-std::array<float,2>{0.764270306f, 0.0154306293f},
-std::array<float,2>{0.0192845184f, 0.425809592f},
-std::array<float,2>{0.586476743f, 0.843043387f},
-std::array<float,2>{0.182069525f, 0.635813713f},
-std::array<float,2>{0.708749175f, 0.11050535f},
-std::array<float,2>{0.33841306f, 0.485476494f},
-std::array<float,2>{0.893162549f, 0.806277335f},
-std::array<float,2>{0.449398696f, 0.982115388f},
-std::array<float,2>{0.855970085f, 0.273955613f},
-std::array<float,2>{0.098198466f, 0.20245868f},
-std::array<float,2>{0.555333495f, 0.56677711f},
-std::array<float,2>{0.0609989874f, 0.854007959f},
-std::array<float,2>{0.621747971f, 0.378147602f},
-std::array<float,2>{0.434181333f, 0.0331784412f},
-std::array<float,2>{0.782193422f, 0.744127572f},
-std::array<float,2>{0.256555766f, 0.522870898f},
-std::array<float,2>{0.986666858f, 0.159156471f},
-std::array<float,2>{0.217011631f, 0.336112291f},
-std::array<float,2>{0.64401263f, 0.916770935f}}
\ No newline at end of file
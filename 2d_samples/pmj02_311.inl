@@ -1,4096 +0,0 @@
-{std::array<float,2>{0.171310723f, 0.399726838f},
-std::array<float,2>{0.53959614f, 0.988270342f},
-std::array<float,2>{0.43661204f, 0.606646478f},
-std::array<float,2>{0.940207005f, 0.105393864f},
-std::array<float,2>{0.337934822f, 0.136029646f},
-std::array<float,2>{0.753055036f, 0.724772692f},
-std::array<float,2>{0.0572528094f, 0.754963458f},
-std::array<float,2>{0.64882046f, 0.34136942f},
-std::array<float,2>{0.072262615f, 0.0366965756f},
-std::array<float,2>{0.692372382f, 0.53297627f},
-std::array<float,2>{0.301318496f, 0.901947379f},
-std::array<float,2>{0.831496775f, 0.44974941f},
-std::array<float,2>{0.438706547f, 0.291441798f},
-std::array<float,2>{0.893416524f, 0.869795442f},
-std::array<float,2>{0.189499721f, 0.630453885f},
-std::array<float,2>{0.594100177f, 0.2439318f},
-std::array<float,2>{0.0178307015f, 0.363507539f},
-std::array<float,2>{0.663841724f, 0.791065335f},
-std::array<float,2>{0.368080735f, 0.714044213f},
-std::array<float,2>{0.802164733f, 0.164489895f},
-std::array<float,2>{0.388342649f, 0.0717931464f},
-std::array<float,2>{0.991590023f, 0.583701193f},
-std::array<float,2>{0.148514628f, 0.954056561f},
-std::array<float,2>{0.518310666f, 0.41449967f},
-std::array<float,2>{0.220088705f, 0.216656238f},
-std::array<float,2>{0.575331271f, 0.683421135f},
-std::array<float,2>{0.485052288f, 0.815857112f},
-std::array<float,2>{0.911205173f, 0.255856961f},
-std::array<float,2>{0.266936392f, 0.490640342f},
-std::array<float,2>{0.849376023f, 0.937042773f},
-std::array<float,2>{0.113621123f, 0.510459185f},
-std::array<float,2>{0.73767966f, 0.0100925742f},
-std::array<float,2>{0.104732573f, 0.453828484f},
-std::array<float,2>{0.734312713f, 0.879849911f},
-std::array<float,2>{0.254202247f, 0.550316632f},
-std::array<float,2>{0.861397326f, 0.0605858117f},
-std::array<float,2>{0.471714318f, 0.233095661f},
-std::array<float,2>{0.925970972f, 0.640941501f},
-std::array<float,2>{0.241098985f, 0.84859854f},
-std::array<float,2>{0.591263294f, 0.30943501f},
-std::array<float,2>{0.138230667f, 0.117112458f},
-std::array<float,2>{0.509670973f, 0.618267834f},
-std::array<float,2>{0.396199971f, 0.974847317f},
-std::array<float,2>{0.983833253f, 0.388053626f},
-std::array<float,2>{0.345953941f, 0.31389606f},
-std::array<float,2>{0.783200264f, 0.777808666f},
-std::array<float,2>{0.0048482269f, 0.743424118f},
-std::array<float,2>{0.675319672f, 0.150172904f},
-std::array<float,2>{0.215414047f, 0.270141333f},
-std::array<float,2>{0.620234132f, 0.841317654f},
-std::array<float,2>{0.462120771f, 0.660318077f},
-std::array<float,2>{0.881647885f, 0.196933776f},
-std::array<float,2>{0.284667373f, 0.0256823897f},
-std::array<float,2>{0.82681489f, 0.516915083f},
-std::array<float,2>{0.0901772454f, 0.909874439f},
-std::array<float,2>{0.706436813f, 0.469039381f},
-std::array<float,2>{0.0351147987f, 0.173728183f},
-std::array<float,2>{0.640479028f, 0.696249485f},
-std::array<float,2>{0.317546904f, 0.800137639f},
-std::array<float,2>{0.779793739f, 0.349203289f},
-std::array<float,2>{0.419395536f, 0.428363681f},
-std::array<float,2>{0.955214381f, 0.943604887f},
-std::array<float,2>{0.173807651f, 0.56515336f},
-std::array<float,2>{0.551499367f, 0.0933005884f},
-std::array<float,2>{0.24290888f, 0.482578695f},
-std::array<float,2>{0.580437779f, 0.91841948f},
-std::array<float,2>{0.482818305f, 0.524609268f},
-std::array<float,2>{0.930394769f, 0.0215722863f},
-std::array<float,2>{0.263999373f, 0.190778539f},
-std::array<float,2>{0.874905527f, 0.665800333f},
-std::array<float,2>{0.0979535058f, 0.833055675f},
-std::array<float,2>{0.723131061f, 0.278081864f},
-std::array<float,2>{0.0104828728f, 0.0856129751f},
-std::array<float,2>{0.67991972f, 0.577512383f},
-std::array<float,2>{0.354563683f, 0.951074421f},
-std::array<float,2>{0.795163989f, 0.433803648f},
-std::array<float,2>{0.404632866f, 0.35321039f},
-std::array<float,2>{0.976473212f, 0.806919992f},
-std::array<float,2>{0.128542975f, 0.690621555f},
-std::array<float,2>{0.50341332f, 0.184386328f},
-std::array<float,2>{0.082925342f, 0.299402326f},
-std::array<float,2>{0.713966846f, 0.857112229f},
-std::array<float,2>{0.290327698f, 0.64966923f},
-std::array<float,2>{0.817041278f, 0.222212821f},
-std::array<float,2>{0.456317812f, 0.0504431576f},
-std::array<float,2>{0.890014887f, 0.560553432f},
-std::array<float,2>{0.203829944f, 0.889199376f},
-std::array<float,2>{0.613569915f, 0.465124518f},
-std::array<float,2>{0.184608757f, 0.143198907f},
-std::array<float,2>{0.557592511f, 0.73975116f},
-std::array<float,2>{0.406781912f, 0.770165205f},
-std::array<float,2>{0.964408636f, 0.324855566f},
-std::array<float,2>{0.322143734f, 0.379844338f},
-std::array<float,2>{0.770394802f, 0.980175257f},
-std::array<float,2>{0.0432207175f, 0.612763464f},
-std::array<float,2>{0.632591486f, 0.123390421f},
-std::array<float,2>{0.0512679927f, 0.41213125f},
-std::array<float,2>{0.64212358f, 0.967465699f},
-std::array<float,2>{0.33308205f, 0.593587458f},
-std::array<float,2>{0.758504391f, 0.0659423172f},
-std::array<float,2>{0.429508209f, 0.161914632f},
-std::array<float,2>{0.949551761f, 0.706147909f},
-std::array<float,2>{0.157058418f, 0.781749904f},
-std::array<float,2>{0.537849188f, 0.367406726f},
-std::array<float,2>{0.201345712f, 0.00371138309f},
-std::array<float,2>{0.60606128f, 0.501212358f},
-std::array<float,2>{0.452997297f, 0.92754966f},
-std::array<float,2>{0.904562712f, 0.493030101f},
-std::array<float,2>{0.30890426f, 0.261580467f},
-std::array<float,2>{0.840331137f, 0.82199347f},
-std::array<float,2>{0.0627022684f, 0.672306001f},
-std::array<float,2>{0.70085907f, 0.208804488f},
-std::array<float,2>{0.141053841f, 0.331586272f},
-std::array<float,2>{0.529044211f, 0.761921287f},
-std::array<float,2>{0.377046555f, 0.730635405f},
-std::array<float,2>{0.998873293f, 0.131319925f},
-std::array<float,2>{0.363820463f, 0.0989041626f},
-std::array<float,2>{0.808605194f, 0.598590851f},
-std::array<float,2>{0.0291690063f, 0.994642675f},
-std::array<float,2>{0.667958975f, 0.391742826f},
-std::array<float,2>{0.124842718f, 0.235676795f},
-std::array<float,2>{0.747816741f, 0.633614302f},
-std::array<float,2>{0.275681019f, 0.865803301f},
-std::array<float,2>{0.856439233f, 0.28834796f},
-std::array<float,2>{0.493731529f, 0.443253964f},
-std::array<float,2>{0.915881097f, 0.896280825f},
-std::array<float,2>{0.23048076f, 0.539458156f},
-std::array<float,2>{0.56648165f, 0.0410674401f},
-std::array<float,2>{0.132380575f, 0.448507637f},
-std::array<float,2>{0.505901039f, 0.903769553f},
-std::array<float,2>{0.400236011f, 0.535509109f},
-std::array<float,2>{0.96945405f, 0.0342526771f},
-std::array<float,2>{0.358905286f, 0.248459682f},
-std::array<float,2>{0.79205054f, 0.625112593f},
-std::array<float,2>{0.013424403f, 0.872622013f},
-std::array<float,2>{0.684964418f, 0.294091791f},
-std::array<float,2>{0.0960209891f, 0.106257476f},
-std::array<float,2>{0.7214517f, 0.604470432f},
-std::array<float,2>{0.260761797f, 0.988409936f},
-std::array<float,2>{0.8694489f, 0.405963063f},
-std::array<float,2>{0.477685034f, 0.338974953f},
-std::array<float,2>{0.937350988f, 0.75077498f},
-std::array<float,2>{0.249879956f, 0.720365047f},
-std::array<float,2>{0.583055675f, 0.139162511f},
-std::array<float,2>{0.0391594023f, 0.251446784f},
-std::array<float,2>{0.62564671f, 0.82015121f},
-std::array<float,2>{0.326973557f, 0.686295033f},
-std::array<float,2>{0.768878043f, 0.214464635f},
-std::array<float,2>{0.411278009f, 0.0137931099f},
-std::array<float,2>{0.968260527f, 0.514251947f},
-std::array<float,2>{0.182319671f, 0.929827869f},
-std::array<float,2>{0.561137497f, 0.484608561f},
-std::array<float,2>{0.208570808f, 0.169494748f},
-std::array<float,2>{0.60965836f, 0.716132164f},
-std::array<float,2>{0.460056692f, 0.795048356f},
-std::array<float,2>{0.883937955f, 0.361688614f},
-std::array<float,2>{0.296688765f, 0.419340104f},
-std::array<float,2>{0.813963354f, 0.959033191f},
-std::array<float,2>{0.0805509239f, 0.580966175f},
-std::array<float,2>{0.715794206f, 0.0742883086f},
-std::array<float,2>{0.0683690161f, 0.383832037f},
-std::array<float,2>{0.697840452f, 0.970400572f},
-std::array<float,2>{0.304775715f, 0.623440206f},
-std::array<float,2>{0.837991774f, 0.113252819f},
-std::array<float,2>{0.44855383f, 0.154359594f},
-std::array<float,2>{0.9001019f, 0.74931699f},
-std::array<float,2>{0.199038282f, 0.775660157f},
-std::array<float,2>{0.605086684f, 0.316989601f},
-std::array<float,2>{0.160526797f, 0.0575112887f},
-std::array<float,2>{0.533276916f, 0.554046392f},
-std::array<float,2>{0.422368407f, 0.87707001f},
-std::array<float,2>{0.9456743f, 0.460713595f},
-std::array<float,2>{0.329171836f, 0.305722356f},
-std::array<float,2>{0.764613688f, 0.844831705f},
-std::array<float,2>{0.0491655804f, 0.648353457f},
-std::array<float,2>{0.645922661f, 0.229193345f},
-std::array<float,2>{0.226640746f, 0.344427019f},
-std::array<float,2>{0.564366639f, 0.80393827f},
-std::array<float,2>{0.498723656f, 0.700163841f},
-std::array<float,2>{0.92011112f, 0.179417521f},
-std::array<float,2>{0.279690981f, 0.0864414275f},
-std::array<float,2>{0.854411662f, 0.56779629f},
-std::array<float,2>{0.117751494f, 0.941212177f},
-std::array<float,2>{0.743515968f, 0.423736513f},
-std::array<float,2>{0.0267638601f, 0.20277299f},
-std::array<float,2>{0.669405997f, 0.659318924f},
-std::array<float,2>{0.361516058f, 0.839433253f},
-std::array<float,2>{0.807256401f, 0.26809594f},
-std::array<float,2>{0.378966033f, 0.47518006f},
-std::array<float,2>{0.993906856f, 0.913625717f},
-std::array<float,2>{0.145211875f, 0.520191312f},
-std::array<float,2>{0.527335048f, 0.0296392161f},
-std::array<float,2>{0.193415314f, 0.430511445f},
-std::array<float,2>{0.598294318f, 0.949059665f},
-std::array<float,2>{0.442610413f, 0.572183132f},
-std::array<float,2>{0.898100257f, 0.0790470317f},
-std::array<float,2>{0.298683017f, 0.180707946f},
-std::array<float,2>{0.83532542f, 0.693727314f},
-std::array<float,2>{0.0759904981f, 0.812005341f},
-std::array<float,2>{0.690001905f, 0.35654065f},
-std::array<float,2>{0.0588702001f, 0.0190531854f},
-std::array<float,2>{0.654877424f, 0.53017509f},
-std::array<float,2>{0.340631783f, 0.917624772f},
-std::array<float,2>{0.755764961f, 0.478638023f},
-std::array<float,2>{0.42979148f, 0.275702268f},
-std::array<float,2>{0.942939818f, 0.830246985f},
-std::array<float,2>{0.165195018f, 0.669976771f},
-std::array<float,2>{0.545278907f, 0.192286938f},
-std::array<float,2>{0.111376837f, 0.321291953f},
-std::array<float,2>{0.74097681f, 0.765724182f},
-std::array<float,2>{0.272540838f, 0.736906052f},
-std::array<float,2>{0.844855905f, 0.147179678f},
-std::array<float,2>{0.491475105f, 0.117753692f},
-std::array<float,2>{0.909225047f, 0.616674781f},
-std::array<float,2>{0.224117249f, 0.982020915f},
-std::array<float,2>{0.571184158f, 0.375111818f},
-std::array<float,2>{0.155284524f, 0.225265294f},
-std::array<float,2>{0.521854281f, 0.654573023f},
-std::array<float,2>{0.386462122f, 0.854612708f},
-std::array<float,2>{0.985685647f, 0.302404076f},
-std::array<float,2>{0.371915311f, 0.463066846f},
-std::array<float,2>{0.798632801f, 0.884059072f},
-std::array<float,2>{0.0225943271f, 0.55703336f},
-std::array<float,2>{0.657917142f, 0.0533168986f},
-std::array<float,2>{0.00192473491f, 0.499548167f},
-std::array<float,2>{0.677940309f, 0.923773468f},
-std::array<float,2>{0.351258248f, 0.5065943f},
-std::array<float,2>{0.785728395f, 0.00725439005f},
-std::array<float,2>{0.393171132f, 0.203760803f},
-std::array<float,2>{0.97736764f, 0.678809166f},
-std::array<float,2>{0.13640593f, 0.825022936f},
-std::array<float,2>{0.515530109f, 0.263800085f},
-std::array<float,2>{0.234972522f, 0.0694201142f},
-std::array<float,2>{0.589505851f, 0.586478174f},
-std::array<float,2>{0.474925488f, 0.9614622f},
-std::array<float,2>{0.925206602f, 0.408559799f},
-std::array<float,2>{0.251577765f, 0.372995704f},
-std::array<float,2>{0.864411116f, 0.78815347f},
-std::array<float,2>{0.10861209f, 0.707048237f},
-std::array<float,2>{0.72999841f, 0.157117248f},
-std::array<float,2>{0.177936584f, 0.283108354f},
-std::array<float,2>{0.549698949f, 0.860269725f},
-std::array<float,2>{0.414498687f, 0.638563037f},
-std::array<float,2>{0.959793806f, 0.242054671f},
-std::array<float,2>{0.312713474f, 0.0447068587f},
-std::array<float,2>{0.775745034f, 0.545644522f},
-std::array<float,2>{0.0362882987f, 0.891520202f},
-std::array<float,2>{0.633469462f, 0.438258588f},
-std::array<float,2>{0.087647438f, 0.126524925f},
-std::array<float,2>{0.708134413f, 0.729299843f},
-std::array<float,2>{0.287392914f, 0.758028805f},
-std::array<float,2>{0.821001709f, 0.333266079f},
-std::array<float,2>{0.468405277f, 0.397170007f},
-std::array<float,2>{0.878433764f, 0.999277472f},
-std::array<float,2>{0.211364225f, 0.593792439f},
-std::array<float,2>{0.624365151f, 0.0955802128f},
-std::array<float,2>{0.151802227f, 0.417527735f},
-std::array<float,2>{0.516134262f, 0.956656218f},
-std::array<float,2>{0.389273345f, 0.585109234f},
-std::array<float,2>{0.990012765f, 0.0725941435f},
-std::array<float,2>{0.371008992f, 0.166720748f},
-std::array<float,2>{0.804412186f, 0.712700725f},
-std::array<float,2>{0.0157060716f, 0.789753795f},
-std::array<float,2>{0.661248446f, 0.365326017f},
-std::array<float,2>{0.115289345f, 0.00912726764f},
-std::array<float,2>{0.735952616f, 0.509536803f},
-std::array<float,2>{0.26934424f, 0.934480011f},
-std::array<float,2>{0.850959182f, 0.489471704f},
-std::array<float,2>{0.487445265f, 0.256760091f},
-std::array<float,2>{0.913552046f, 0.813796759f},
-std::array<float,2>{0.220708653f, 0.681567669f},
-std::array<float,2>{0.577439904f, 0.217327774f},
-std::array<float,2>{0.0559900329f, 0.342162251f},
-std::array<float,2>{0.650837958f, 0.756015897f},
-std::array<float,2>{0.337826848f, 0.723205626f},
-std::array<float,2>{0.751872957f, 0.134683236f},
-std::array<float,2>{0.4338153f, 0.102262631f},
-std::array<float,2>{0.938323796f, 0.608436346f},
-std::array<float,2>{0.168990269f, 0.98491317f},
-std::array<float,2>{0.541071236f, 0.400446147f},
-std::array<float,2>{0.188077748f, 0.245512038f},
-std::array<float,2>{0.595930994f, 0.632078707f},
-std::array<float,2>{0.440806985f, 0.868327618f},
-std::array<float,2>{0.891706645f, 0.290137112f},
-std::array<float,2>{0.303048372f, 0.451613069f},
-std::array<float,2>{0.829024732f, 0.89995563f},
-std::array<float,2>{0.073112227f, 0.534243226f},
-std::array<float,2>{0.694643438f, 0.0383708477f},
-std::array<float,2>{0.0934622213f, 0.472433567f},
-std::array<float,2>{0.704563439f, 0.907675445f},
-std::array<float,2>{0.282379955f, 0.518643975f},
-std::array<float,2>{0.825932562f, 0.0252739619f},
-std::array<float,2>{0.463859499f, 0.197341904f},
-std::array<float,2>{0.880522192f, 0.662546873f},
-std::array<float,2>{0.217228934f, 0.842767537f},
-std::array<float,2>{0.619004011f, 0.273030877f},
-std::array<float,2>{0.174100563f, 0.0914185718f},
-std::array<float,2>{0.553455234f, 0.563517809f},
-std::array<float,2>{0.420613647f, 0.941691041f},
-std::array<float,2>{0.954444647f, 0.427010357f},
-std::array<float,2>{0.320017576f, 0.350200623f},
-std::array<float,2>{0.778590977f, 0.797762334f},
-std::array<float,2>{0.0321509205f, 0.699174106f},
-std::array<float,2>{0.638497233f, 0.174408928f},
-std::array<float,2>{0.239335328f, 0.312097251f},
-std::array<float,2>{0.592631698f, 0.851460218f},
-std::array<float,2>{0.469967037f, 0.643663943f},
-std::array<float,2>{0.928862274f, 0.231537074f},
-std::array<float,2>{0.257320613f, 0.0601821616f},
-std::array<float,2>{0.860987663f, 0.548521519f},
-std::array<float,2>{0.102108426f, 0.88164705f},
-std::array<float,2>{0.731022179f, 0.455679655f},
-std::array<float,2>{0.00658791931f, 0.150758386f},
-std::array<float,2>{0.672680497f, 0.745014369f},
-std::array<float,2>{0.344875008f, 0.779634774f},
-std::array<float,2>{0.784436166f, 0.315258354f},
-std::array<float,2>{0.398324251f, 0.390376478f},
-std::array<float,2>{0.981867075f, 0.973190308f},
-std::array<float,2>{0.1397807f, 0.620168388f},
-std::array<float,2>{0.511504471f, 0.11439652f},
-std::array<float,2>{0.206236616f, 0.467510223f},
-std::array<float,2>{0.615813792f, 0.887043655f},
-std::array<float,2>{0.453525394f, 0.560432255f},
-std::array<float,2>{0.888307333f, 0.0481771231f},
-std::array<float,2>{0.291683823f, 0.218931481f},
-std::array<float,2>{0.819375515f, 0.650757432f},
-std::array<float,2>{0.0848662108f, 0.857893944f},
-std::array<float,2>{0.711264849f, 0.298086822f},
-std::array<float,2>{0.0464222506f, 0.12267147f},
-std::array<float,2>{0.629339993f, 0.610276878f},
-std::array<float,2>{0.323279053f, 0.9773615f},
-std::array<float,2>{0.773121238f, 0.38087377f},
-std::array<float,2>{0.409823269f, 0.327844292f},
-std::array<float,2>{0.960952222f, 0.77333349f},
-std::array<float,2>{0.186435759f, 0.740840316f},
-std::array<float,2>{0.555223644f, 0.142329916f},
-std::array<float,2>{0.10066849f, 0.280623943f},
-std::array<float,2>{0.726481259f, 0.835052609f},
-std::array<float,2>{0.261724472f, 0.666614532f},
-std::array<float,2>{0.87291944f, 0.189150527f},
-std::array<float,2>{0.480486035f, 0.0198175367f},
-std::array<float,2>{0.932156801f, 0.525815189f},
-std::array<float,2>{0.245417193f, 0.920238972f},
-std::array<float,2>{0.578285813f, 0.481175989f},
-std::array<float,2>{0.126862466f, 0.185944095f},
-std::array<float,2>{0.50150013f, 0.688510954f},
-std::array<float,2>{0.402760714f, 0.805392385f},
-std::array<float,2>{0.973968148f, 0.355341703f},
-std::array<float,2>{0.353489846f, 0.436706483f},
-std::array<float,2>{0.793293953f, 0.951951623f},
-std::array<float,2>{0.00826234836f, 0.575550973f},
-std::array<float,2>{0.683125794f, 0.0824158192f},
-std::array<float,2>{0.0298250318f, 0.394220769f},
-std::array<float,2>{0.665341139f, 0.992573023f},
-std::array<float,2>{0.366800725f, 0.600270927f},
-std::array<float,2>{0.811229646f, 0.0999260172f},
-std::array<float,2>{0.376648307f, 0.130049556f},
-std::array<float,2>{0.997873425f, 0.734063447f},
-std::array<float,2>{0.144242615f, 0.765080035f},
-std::array<float,2>{0.531118512f, 0.32855013f},
-std::array<float,2>{0.234266251f, 0.0400860198f},
-std::array<float,2>{0.569875717f, 0.541240454f},
-std::array<float,2>{0.494145364f, 0.897740841f},
-std::array<float,2>{0.916707993f, 0.444117963f},
-std::array<float,2>{0.275335282f, 0.286707789f},
-std::array<float,2>{0.857462227f, 0.864497185f},
-std::array<float,2>{0.122685f, 0.635470033f},
-std::array<float,2>{0.748811781f, 0.237304926f},
-std::array<float,2>{0.159805045f, 0.370681643f},
-std::array<float,2>{0.535255551f, 0.784041047f},
-std::array<float,2>{0.427169979f, 0.703894675f},
-std::array<float,2>{0.951224446f, 0.162469462f},
-std::array<float,2>{0.335920602f, 0.0632052943f},
-std::array<float,2>{0.760797143f, 0.591777205f},
-std::array<float,2>{0.0545077659f, 0.966299891f},
-std::array<float,2>{0.64312917f, 0.410892606f},
-std::array<float,2>{0.0653342977f, 0.210618272f},
-std::array<float,2>{0.701705396f, 0.674027264f},
-std::array<float,2>{0.311950713f, 0.8240273f},
-std::array<float,2>{0.843286395f, 0.259189904f},
-std::array<float,2>{0.45112434f, 0.494560063f},
-std::array<float,2>{0.90420413f, 0.928867042f},
-std::array<float,2>{0.200345054f, 0.503872514f},
-std::array<float,2>{0.608482599f, 0.000761235831f},
-std::array<float,2>{0.180334553f, 0.486800551f},
-std::array<float,2>{0.559383631f, 0.931730866f},
-std::array<float,2>{0.4123694f, 0.512803078f},
-std::array<float,2>{0.966795981f, 0.0122722313f},
-std::array<float,2>{0.326030046f, 0.212520659f},
-std::array<float,2>{0.766333282f, 0.685021758f},
-std::array<float,2>{0.0420011841f, 0.817556024f},
-std::array<float,2>{0.627298415f, 0.253795624f},
-std::array<float,2>{0.0800579414f, 0.07810013f},
-std::array<float,2>{0.71847713f, 0.578849554f},
-std::array<float,2>{0.293212682f, 0.958787739f},
-std::array<float,2>{0.816287577f, 0.420340538f},
-std::array<float,2>{0.458290607f, 0.360015541f},
-std::array<float,2>{0.885455966f, 0.793009698f},
-std::array<float,2>{0.209176987f, 0.717390954f},
-std::array<float,2>{0.612203479f, 0.171016499f},
-std::array<float,2>{0.014943867f, 0.296127111f},
-std::array<float,2>{0.686686516f, 0.873455882f},
-std::array<float,2>{0.357321948f, 0.628070295f},
-std::array<float,2>{0.789179504f, 0.247070402f},
-std::array<float,2>{0.40123415f, 0.0325435698f},
-std::array<float,2>{0.972551227f, 0.538414955f},
-std::array<float,2>{0.129165217f, 0.90490526f},
-std::array<float,2>{0.505423903f, 0.446104109f},
-std::array<float,2>{0.246668622f, 0.13862513f},
-std::array<float,2>{0.585686922f, 0.721839309f},
-std::array<float,2>{0.479507864f, 0.753793895f},
-std::array<float,2>{0.935412407f, 0.337228596f},
-std::array<float,2>{0.258420646f, 0.402365148f},
-std::array<float,2>{0.86839968f, 0.990432143f},
-std::array<float,2>{0.0955715477f, 0.60304004f},
-std::array<float,2>{0.719182253f, 0.108928546f},
-std::array<float,2>{0.119333886f, 0.424933672f},
-std::array<float,2>{0.745475352f, 0.939263463f},
-std::array<float,2>{0.279030561f, 0.569806159f},
-std::array<float,2>{0.85191685f, 0.0889507756f},
-std::array<float,2>{0.497341961f, 0.177704111f},
-std::array<float,2>{0.918463171f, 0.701988816f},
-std::array<float,2>{0.229311287f, 0.802521944f},
-std::array<float,2>{0.565178096f, 0.346755564f},
-std::array<float,2>{0.147176728f, 0.0287515484f},
-std::array<float,2>{0.52462846f, 0.521619081f},
-std::array<float,2>{0.382506877f, 0.910333753f},
-std::array<float,2>{0.994915247f, 0.47331804f},
-std::array<float,2>{0.360452831f, 0.266610771f},
-std::array<float,2>{0.805048287f, 0.837038279f},
-std::array<float,2>{0.0235691015f, 0.657689869f},
-std::array<float,2>{0.670164704f, 0.199458107f},
-std::array<float,2>{0.196652487f, 0.318778366f},
-std::array<float,2>{0.601837277f, 0.773471892f},
-std::array<float,2>{0.447233766f, 0.747523904f},
-std::array<float,2>{0.902214348f, 0.152703539f},
-std::array<float,2>{0.308055341f, 0.110819899f},
-std::array<float,2>{0.836586058f, 0.622767866f},
-std::array<float,2>{0.0668083876f, 0.970973611f},
-std::array<float,2>{0.696686149f, 0.386170328f},
-std::array<float,2>{0.0468885079f, 0.227185845f},
-std::array<float,2>{0.648182988f, 0.645180941f},
-std::array<float,2>{0.330371678f, 0.846301019f},
-std::array<float,2>{0.762158573f, 0.308078229f},
-std::array<float,2>{0.424772263f, 0.458696544f},
-std::array<float,2>{0.947817743f, 0.875019073f},
-std::array<float,2>{0.163943022f, 0.552081883f},
-std::array<float,2>{0.533045352f, 0.0564944446f},
-std::array<float,2>{0.224839881f, 0.378450871f},
-std::array<float,2>{0.572632253f, 0.982440472f},
-std::array<float,2>{0.489860147f, 0.614319742f},
-std::array<float,2>{0.90769279f, 0.119902149f},
-std::array<float,2>{0.269707233f, 0.14601101f},
-std::array<float,2>{0.846416712f, 0.736186564f},
-std::array<float,2>{0.110531621f, 0.768799841f},
-std::array<float,2>{0.739785016f, 0.323666126f},
-std::array<float,2>{0.0210316051f, 0.0512534827f},
-std::array<float,2>{0.659304619f, 0.556105733f},
-std::array<float,2>{0.373365551f, 0.885172009f},
-std::array<float,2>{0.800617099f, 0.461770982f},
-std::array<float,2>{0.384651899f, 0.303589553f},
-std::array<float,2>{0.987254143f, 0.851649761f},
-std::array<float,2>{0.153744712f, 0.653591454f},
-std::array<float,2>{0.521044672f, 0.223942965f},
-std::array<float,2>{0.0774148032f, 0.358728349f},
-std::array<float,2>{0.687585413f, 0.809621811f},
-std::array<float,2>{0.300467968f, 0.692085981f},
-std::array<float,2>{0.832154512f, 0.183515459f},
-std::array<float,2>{0.444999725f, 0.0810606256f},
-std::array<float,2>{0.896131992f, 0.574195564f},
-std::array<float,2>{0.192740574f, 0.945365965f},
-std::array<float,2>{0.601334333f, 0.433266401f},
-std::array<float,2>{0.167055964f, 0.194651082f},
-std::array<float,2>{0.543462217f, 0.66980052f},
-std::array<float,2>{0.432724208f, 0.829950988f},
-std::array<float,2>{0.944318891f, 0.274226636f},
-std::array<float,2>{0.342755586f, 0.47714752f},
-std::array<float,2>{0.756590366f, 0.915023804f},
-std::array<float,2>{0.0612562113f, 0.528116882f},
-std::array<float,2>{0.654120684f, 0.0160315391f},
-std::array<float,2>{0.0382223912f, 0.439690918f},
-std::array<float,2>{0.635260582f, 0.893372893f},
-std::array<float,2>{0.315165073f, 0.543346643f},
-std::array<float,2>{0.775303304f, 0.0465618521f},
-std::array<float,2>{0.41699025f, 0.239731207f},
-std::array<float,2>{0.957809508f, 0.639233351f},
-std::array<float,2>{0.176364645f, 0.862572789f},
-std::array<float,2>{0.547583461f, 0.28373912f},
-std::array<float,2>{0.213314399f, 0.0966831967f},
-std::array<float,2>{0.621606648f, 0.597366393f},
-std::array<float,2>{0.46677196f, 0.996852577f},
-std::array<float,2>{0.875638247f, 0.39572686f},
-std::array<float,2>{0.285581648f, 0.334426641f},
-std::array<float,2>{0.824086547f, 0.760322332f},
-std::array<float,2>{0.0896998197f, 0.726969004f},
-std::array<float,2>{0.710458457f, 0.127897561f},
-std::array<float,2>{0.133368373f, 0.26353547f},
-std::array<float,2>{0.513585985f, 0.827049911f},
-std::array<float,2>{0.391505241f, 0.677220702f},
-std::array<float,2>{0.978578627f, 0.205855042f},
-std::array<float,2>{0.349559069f, 0.00514801219f},
-std::array<float,2>{0.787332416f, 0.505251586f},
-std::array<float,2>{0.0026642934f, 0.92525357f},
-std::array<float,2>{0.676169634f, 0.497337013f},
-std::array<float,2>{0.106277592f, 0.1588355f},
-std::array<float,2>{0.728225648f, 0.710326314f},
-std::array<float,2>{0.252286464f, 0.785777032f},
-std::array<float,2>{0.866035581f, 0.373854607f},
-std::array<float,2>{0.473224044f, 0.406900525f},
-std::array<float,2>{0.921976626f, 0.963381529f},
-std::array<float,2>{0.23796919f, 0.589689493f},
-std::array<float,2>{0.586154401f, 0.0670099556f},
-std::array<float,2>{0.139064446f, 0.387394637f},
-std::array<float,2>{0.510679722f, 0.975794554f},
-std::array<float,2>{0.396968424f, 0.617477596f},
-std::array<float,2>{0.980469465f, 0.116206437f},
-std::array<float,2>{0.343972117f, 0.149376586f},
-std::array<float,2>{0.78335017f, 0.742807806f},
-std::array<float,2>{0.00763856526f, 0.778474629f},
-std::array<float,2>{0.673747957f, 0.313201219f},
-std::array<float,2>{0.103140883f, 0.0617141165f},
-std::array<float,2>{0.732283533f, 0.548989356f},
-std::array<float,2>{0.256222159f, 0.880053043f},
-std::array<float,2>{0.860159993f, 0.454254895f},
-std::array<float,2>{0.46960783f, 0.309781551f},
-std::array<float,2>{0.928378284f, 0.849119008f},
-std::array<float,2>{0.238669232f, 0.641721845f},
-std::array<float,2>{0.593406022f, 0.233985543f},
-std::array<float,2>{0.0323338583f, 0.347717345f},
-std::array<float,2>{0.636899352f, 0.799147189f},
-std::array<float,2>{0.318958759f, 0.697248459f},
-std::array<float,2>{0.777706742f, 0.172163844f},
-std::array<float,2>{0.421778798f, 0.0921388716f},
-std::array<float,2>{0.953715622f, 0.565522969f},
-std::array<float,2>{0.175648585f, 0.945204496f},
-std::array<float,2>{0.554631472f, 0.429379553f},
-std::array<float,2>{0.218439505f, 0.195513651f},
-std::array<float,2>{0.618023574f, 0.661689818f},
-std::array<float,2>{0.463884354f, 0.840232193f},
-std::array<float,2>{0.878997326f, 0.270754576f},
-std::array<float,2>{0.281281561f, 0.470134795f},
-std::array<float,2>{0.824522138f, 0.908773661f},
-std::array<float,2>{0.0923780575f, 0.515687346f},
-std::array<float,2>{0.703183889f, 0.0272031501f},
-std::array<float,2>{0.0740165263f, 0.450987965f},
-std::array<float,2>{0.693765819f, 0.90081799f},
-std::array<float,2>{0.304327071f, 0.531621993f},
-std::array<float,2>{0.829688549f, 0.0353997909f},
-std::array<float,2>{0.439722151f, 0.242789373f},
-std::array<float,2>{0.891120911f, 0.629668772f},
-std::array<float,2>{0.189145848f, 0.870993912f},
-std::array<float,2>{0.597167015f, 0.292400151f},
-std::array<float,2>{0.168032855f, 0.104207769f},
-std::array<float,2>{0.542941153f, 0.606178164f},
-std::array<float,2>{0.434589773f, 0.987073243f},
-std::array<float,2>{0.939249754f, 0.398623168f},
-std::array<float,2>{0.335973144f, 0.339947015f},
-std::array<float,2>{0.750560462f, 0.75447017f},
-std::array<float,2>{0.0552248508f, 0.725733459f},
-std::array<float,2>{0.652110219f, 0.135325387f},
-std::array<float,2>{0.222607687f, 0.254289299f},
-std::array<float,2>{0.576347053f, 0.814700067f},
-std::array<float,2>{0.487296581f, 0.682314873f},
-std::array<float,2>{0.912683308f, 0.215719551f},
-std::array<float,2>{0.267686158f, 0.0107845534f},
-std::array<float,2>{0.849971712f, 0.511109352f},
-std::array<float,2>{0.116759472f, 0.93617183f},
-std::array<float,2>{0.734941125f, 0.491537511f},
-std::array<float,2>{0.0170187689f, 0.165059164f},
-std::array<float,2>{0.66113013f, 0.713096738f},
-std::array<float,2>{0.369916409f, 0.792083979f},
-std::array<float,2>{0.803133905f, 0.364484996f},
-std::array<float,2>{0.390205711f, 0.415213019f},
-std::array<float,2>{0.989211559f, 0.954895496f},
-std::array<float,2>{0.150422648f, 0.582346439f},
-std::array<float,2>{0.51695025f, 0.0708420351f},
-std::array<float,2>{0.199813977f, 0.494080901f},
-std::array<float,2>{0.607614934f, 0.926359773f},
-std::array<float,2>{0.449860185f, 0.500789404f},
-std::array<float,2>{0.902752638f, 0.00216640625f},
-std::array<float,2>{0.310677588f, 0.207804352f},
-std::array<float,2>{0.84257257f, 0.673252761f},
-std::array<float,2>{0.0658861175f, 0.820892155f},
-std::array<float,2>{0.702254832f, 0.260548323f},
-std::array<float,2>{0.0528005846f, 0.0647000819f},
-std::array<float,2>{0.644163609f, 0.592338443f},
-std::array<float,2>{0.334079355f, 0.968332171f},
-std::array<float,2>{0.760231197f, 0.413326621f},
-std::array<float,2>{0.426282674f, 0.368694454f},
-std::array<float,2>{0.952795565f, 0.782412231f},
-std::array<float,2>{0.15836738f, 0.705313385f},
-std::array<float,2>{0.536713958f, 0.160693094f},
-std::array<float,2>{0.121910445f, 0.287134796f},
-std::array<float,2>{0.749920011f, 0.866791785f},
-std::array<float,2>{0.273547888f, 0.634710073f},
-std::array<float,2>{0.858415604f, 0.235271275f},
-std::array<float,2>{0.49571076f, 0.0424838886f},
-std::array<float,2>{0.917031467f, 0.540161133f},
-std::array<float,2>{0.233103544f, 0.895305693f},
-std::array<float,2>{0.569288075f, 0.442088425f},
-std::array<float,2>{0.142628282f, 0.132184267f},
-std::array<float,2>{0.529321551f, 0.731753051f},
-std::array<float,2>{0.375127852f, 0.763234317f},
-std::array<float,2>{0.996576309f, 0.330095708f},
-std::array<float,2>{0.365665823f, 0.390995979f},
-std::array<float,2>{0.811719537f, 0.995431662f},
-std::array<float,2>{0.0307689197f, 0.599590719f},
-std::array<float,2>{0.664700687f, 0.0979600921f},
-std::array<float,2>{0.00946966745f, 0.435436636f},
-std::array<float,2>{0.682444274f, 0.949310958f},
-std::array<float,2>{0.351822525f, 0.576525927f},
-std::array<float,2>{0.794394493f, 0.0847359523f},
-std::array<float,2>{0.403882742f, 0.185509264f},
-std::array<float,2>{0.972834229f, 0.689474463f},
-std::array<float,2>{0.125041157f, 0.808050811f},
-std::array<float,2>{0.500555575f, 0.35181284f},
-std::array<float,2>{0.245088056f, 0.0228592269f},
-std::array<float,2>{0.579970956f, 0.52394104f},
-std::array<float,2>{0.481808841f, 0.919591427f},
-std::array<float,2>{0.932984114f, 0.483940184f},
-std::array<float,2>{0.263110757f, 0.279110849f},
-std::array<float,2>{0.871504903f, 0.832053423f},
-std::array<float,2>{0.100264847f, 0.664524078f},
-std::array<float,2>{0.725441635f, 0.189923212f},
-std::array<float,2>{0.187195331f, 0.326081097f},
-std::array<float,2>{0.556482553f, 0.771239042f},
-std::array<float,2>{0.408567369f, 0.739141941f},
-std::array<float,2>{0.962688267f, 0.143789113f},
-std::array<float,2>{0.322532684f, 0.124424919f},
-std::array<float,2>{0.771700859f, 0.611452699f},
-std::array<float,2>{0.0449237265f, 0.979202151f},
-std::array<float,2>{0.630627215f, 0.380598962f},
-std::array<float,2>{0.0851024687f, 0.220955074f},
-std::array<float,2>{0.712087274f, 0.648634672f},
-std::array<float,2>{0.292476743f, 0.855986118f},
-std::array<float,2>{0.819318056f, 0.300478995f},
-std::array<float,2>{0.454471558f, 0.466432959f},
-std::array<float,2>{0.886909127f, 0.889904559f},
-std::array<float,2>{0.205336735f, 0.562279105f},
-std::array<float,2>{0.616217315f, 0.0492201857f},
-std::array<float,2>{0.162727937f, 0.459349185f},
-std::array<float,2>{0.531781673f, 0.878619075f},
-std::array<float,2>{0.425557941f, 0.553179026f},
-std::array<float,2>{0.948353887f, 0.0584351234f},
-std::array<float,2>{0.331783026f, 0.229957283f},
-std::array<float,2>{0.763670027f, 0.646957755f},
-std::array<float,2>{0.0484019853f, 0.844639301f},
-std::array<float,2>{0.647298813f, 0.304851741f},
-std::array<float,2>{0.0674929321f, 0.11195638f},
-std::array<float,2>{0.695692718f, 0.624731183f},
-std::array<float,2>{0.30750531f, 0.969518542f},
-std::array<float,2>{0.837790132f, 0.383648574f},
-std::array<float,2>{0.445529282f, 0.317685008f},
-std::array<float,2>{0.90087074f, 0.776459813f},
-std::array<float,2>{0.195547417f, 0.748855293f},
-std::array<float,2>{0.602634609f, 0.156194836f},
-std::array<float,2>{0.0246584564f, 0.268766075f},
-std::array<float,2>{0.670961261f, 0.838377357f},
-std::array<float,2>{0.359410167f, 0.659155607f},
-std::array<float,2>{0.806423306f, 0.201915056f},
-std::array<float,2>{0.381490648f, 0.0311752483f},
-std::array<float,2>{0.995617867f, 0.520520866f},
-std::array<float,2>{0.148177654f, 0.912212491f},
-std::array<float,2>{0.524134159f, 0.476348788f},
-std::array<float,2>{0.229940757f, 0.178416684f},
-std::array<float,2>{0.565574706f, 0.700763166f},
-std::array<float,2>{0.496388704f, 0.803493381f},
-std::array<float,2>{0.91913569f, 0.345172733f},
-std::array<float,2>{0.27798146f, 0.422367454f},
-std::array<float,2>{0.853480339f, 0.939737737f},
-std::array<float,2>{0.120579444f, 0.566657782f},
-std::array<float,2>{0.74452579f, 0.0870467946f},
-std::array<float,2>{0.0944107249f, 0.404559314f},
-std::array<float,2>{0.720396519f, 0.989545047f},
-std::array<float,2>{0.259464651f, 0.604727328f},
-std::array<float,2>{0.867739737f, 0.107043773f},
-std::array<float,2>{0.478950948f, 0.140246034f},
-std::array<float,2>{0.934135914f, 0.719415367f},
-std::array<float,2>{0.247241884f, 0.751300633f},
-std::array<float,2>{0.584075391f, 0.338857353f},
-std::array<float,2>{0.130286917f, 0.0332103819f},
-std::array<float,2>{0.504224241f, 0.536325872f},
-std::array<float,2>{0.40161863f, 0.903200746f},
-std::array<float,2>{0.971501589f, 0.447450221f},
-std::array<float,2>{0.355637223f, 0.293606669f},
-std::array<float,2>{0.790965974f, 0.871438086f},
-std::array<float,2>{0.0141562093f, 0.626406312f},
-std::array<float,2>{0.685740113f, 0.249470696f},
-std::array<float,2>{0.210627854f, 0.362732798f},
-std::array<float,2>{0.613071144f, 0.796425581f},
-std::array<float,2>{0.457075238f, 0.715173841f},
-std::array<float,2>{0.885850787f, 0.168627203f},
-std::array<float,2>{0.294524491f, 0.0758978277f},
-std::array<float,2>{0.815092981f, 0.581250608f},
-std::array<float,2>{0.0783266872f, 0.96064198f},
-std::array<float,2>{0.7174173f, 0.418203264f},
-std::array<float,2>{0.0413408279f, 0.212931424f},
-std::array<float,2>{0.628849089f, 0.686660707f},
-std::array<float,2>{0.325059444f, 0.819320381f},
-std::array<float,2>{0.767177284f, 0.250562608f},
-std::array<float,2>{0.413405091f, 0.485460073f},
-std::array<float,2>{0.964898765f, 0.931513846f},
-std::array<float,2>{0.181323037f, 0.515435159f},
-std::array<float,2>{0.56044507f, 0.015023889f},
-std::array<float,2>{0.23689954f, 0.409795314f},
-std::array<float,2>{0.587338865f, 0.962310851f},
-std::array<float,2>{0.47370699f, 0.586946189f},
-std::array<float,2>{0.923319101f, 0.0687456653f},
-std::array<float,2>{0.253481358f, 0.158025548f},
-std::array<float,2>{0.866424918f, 0.70892781f},
-std::array<float,2>{0.106752612f, 0.78772068f},
-std::array<float,2>{0.727264404f, 0.371594965f},
-std::array<float,2>{0.00331669534f, 0.00594675587f},
-std::array<float,2>{0.677295387f, 0.507422984f},
-std::array<float,2>{0.347669482f, 0.921966493f},
-std::array<float,2>{0.788601458f, 0.49860695f},
-std::array<float,2>{0.3920286f, 0.26548627f},
-std::array<float,2>{0.979827821f, 0.826156974f},
-std::array<float,2>{0.13414228f, 0.678625643f},
-std::array<float,2>{0.512312412f, 0.204769358f},
-std::array<float,2>{0.0884452164f, 0.332864553f},
-std::array<float,2>{0.70960027f, 0.759383857f},
-std::array<float,2>{0.286171347f, 0.729965329f},
-std::array<float,2>{0.823041558f, 0.125503495f},
-std::array<float,2>{0.465697795f, 0.0940350071f},
-std::array<float,2>{0.876802683f, 0.595410705f},
-std::array<float,2>{0.21427986f, 0.998526871f},
-std::array<float,2>{0.622197509f, 0.39798969f},
-std::array<float,2>{0.177007571f, 0.240981087f},
-std::array<float,2>{0.548402429f, 0.63715893f},
-std::array<float,2>{0.417223036f, 0.860811651f},
-std::array<float,2>{0.958197534f, 0.281899273f},
-std::array<float,2>{0.315933824f, 0.439199239f},
-std::array<float,2>{0.774127662f, 0.892260611f},
-std::array<float,2>{0.0371141434f, 0.546044409f},
-std::array<float,2>{0.636616886f, 0.0437757373f},
-std::array<float,2>{0.0623266362f, 0.480080932f},
-std::array<float,2>{0.652653873f, 0.91619426f},
-std::array<float,2>{0.342961043f, 0.530865192f},
-std::array<float,2>{0.757400751f, 0.0179518778f},
-std::array<float,2>{0.432045937f, 0.192830846f},
-std::array<float,2>{0.944521189f, 0.671085954f},
-std::array<float,2>{0.166328356f, 0.83123529f},
-std::array<float,2>{0.544734299f, 0.277143091f},
-std::array<float,2>{0.191629127f, 0.0798146725f},
-std::array<float,2>{0.599929512f, 0.571193755f},
-std::array<float,2>{0.443948299f, 0.947900891f},
-std::array<float,2>{0.895167053f, 0.431132019f},
-std::array<float,2>{0.299110353f, 0.355941713f},
-std::array<float,2>{0.833699703f, 0.810952246f},
-std::array<float,2>{0.0769256577f, 0.694496453f},
-std::array<float,2>{0.689393938f, 0.180120602f},
-std::array<float,2>{0.152874082f, 0.301706493f},
-std::array<float,2>{0.520319402f, 0.853732586f},
-std::array<float,2>{0.383354157f, 0.655514836f},
-std::array<float,2>{0.987876713f, 0.226492926f},
-std::array<float,2>{0.374639958f, 0.0543449149f},
-std::array<float,2>{0.799473107f, 0.558145881f},
-std::array<float,2>{0.0198494252f, 0.88340205f},
-std::array<float,2>{0.658695817f, 0.464830279f},
-std::array<float,2>{0.110285625f, 0.14754647f},
-std::array<float,2>{0.738633096f, 0.738151729f},
-std::array<float,2>{0.270648748f, 0.766785443f},
-std::array<float,2>{0.846832156f, 0.321088821f},
-std::array<float,2>{0.489145696f, 0.376165986f},
-std::array<float,2>{0.906915367f, 0.98077035f},
-std::array<float,2>{0.225916922f, 0.616098464f},
-std::array<float,2>{0.573965073f, 0.118931279f},
-std::array<float,2>{0.172139853f, 0.426108241f},
-std::array<float,2>{0.551880479f, 0.942693293f},
-std::array<float,2>{0.418530911f, 0.563067079f},
-std::array<float,2>{0.956839323f, 0.0903792009f},
-std::array<float,2>{0.317360222f, 0.175408497f},
-std::array<float,2>{0.780959427f, 0.697372675f},
-std::array<float,2>{0.0337990448f, 0.798089445f},
-std::array<float,2>{0.638794661f, 0.351040035f},
-std::array<float,2>{0.0910784304f, 0.0237370972f},
-std::array<float,2>{0.705435812f, 0.518032551f},
-std::array<float,2>{0.283347905f, 0.906783581f},
-std::array<float,2>{0.827676117f, 0.471615374f},
-std::array<float,2>{0.461507708f, 0.271778047f},
-std::array<float,2>{0.882436752f, 0.842851222f},
-std::array<float,2>{0.216569856f, 0.663354576f},
-std::array<float,2>{0.619545698f, 0.198244631f},
-std::array<float,2>{0.00559973344f, 0.315525323f},
-std::array<float,2>{0.673874557f, 0.781146169f},
-std::array<float,2>{0.346900225f, 0.745163202f},
-std::array<float,2>{0.781496882f, 0.151694968f},
-std::array<float,2>{0.394981533f, 0.11366903f},
-std::array<float,2>{0.982447207f, 0.620098889f},
-std::array<float,2>{0.137587756f, 0.974014103f},
-std::array<float,2>{0.508370101f, 0.389553219f},
-std::array<float,2>{0.241701201f, 0.230977356f},
-std::array<float,2>{0.590646267f, 0.643214643f},
-std::array<float,2>{0.471110761f, 0.850476503f},
-std::array<float,2>{0.927373767f, 0.31092751f},
-std::array<float,2>{0.25488621f, 0.456747353f},
-std::array<float,2>{0.862794816f, 0.881898582f},
-std::array<float,2>{0.104354978f, 0.547522783f},
-std::array<float,2>{0.732801139f, 0.0592898354f},
-std::array<float,2>{0.114526615f, 0.489142865f},
-std::array<float,2>{0.736539125f, 0.934637368f},
-std::array<float,2>{0.265812755f, 0.508052707f},
-std::array<float,2>{0.847755134f, 0.00843344349f},
-std::array<float,2>{0.485966265f, 0.218534008f},
-std::array<float,2>{0.911009312f, 0.679706335f},
-std::array<float,2>{0.219560966f, 0.812614381f},
-std::array<float,2>{0.574925363f, 0.257204562f},
-std::array<float,2>{0.150180608f, 0.0741302297f},
-std::array<float,2>{0.518633246f, 0.584200203f},
-std::array<float,2>{0.387067914f, 0.9551332f},
-std::array<float,2>{0.990408421f, 0.416950047f},
-std::array<float,2>{0.368317425f, 0.366278052f},
-std::array<float,2>{0.801433504f, 0.79084748f},
-std::array<float,2>{0.0186332911f, 0.711415291f},
-std::array<float,2>{0.662257493f, 0.167528167f},
-std::array<float,2>{0.191091835f, 0.289430887f},
-std::array<float,2>{0.595446825f, 0.867217779f},
-std::array<float,2>{0.438113421f, 0.630929649f},
-std::array<float,2>{0.894156754f, 0.244203553f},
-std::array<float,2>{0.302258581f, 0.0377949402f},
-std::array<float,2>{0.830862224f, 0.533986211f},
-std::array<float,2>{0.0708559081f, 0.899250805f},
-std::array<float,2>{0.692940235f, 0.452925444f},
-std::array<float,2>{0.0578074567f, 0.132840917f},
-std::array<float,2>{0.649519861f, 0.724174917f},
-std::array<float,2>{0.339071274f, 0.757682025f},
-std::array<float,2>{0.752200186f, 0.343078703f},
-std::array<float,2>{0.436363995f, 0.402316332f},
-std::array<float,2>{0.941065133f, 0.985584438f},
-std::array<float,2>{0.17050983f, 0.607749939f},
-std::array<float,2>{0.540130913f, 0.102955721f},
-std::array<float,2>{0.231722653f, 0.444670379f},
-std::array<float,2>{0.568293631f, 0.897225797f},
-std::array<float,2>{0.492306709f, 0.542292893f},
-std::array<float,2>{0.914062917f, 0.0394663103f},
-std::array<float,2>{0.276700377f, 0.236622989f},
-std::array<float,2>{0.85685432f, 0.636079848f},
-std::array<float,2>{0.123844855f, 0.864171684f},
-std::array<float,2>{0.74660635f, 0.285634935f},
-std::array<float,2>{0.0279842671f, 0.10062778f},
-std::array<float,2>{0.666038096f, 0.600967705f},
-std::array<float,2>{0.364963263f, 0.993524849f},
-std::array<float,2>{0.809979975f, 0.393346369f},
-std::array<float,2>{0.378680706f, 0.329611927f},
-std::array<float,2>{0.999981999f, 0.764562547f},
-std::array<float,2>{0.142438278f, 0.732601225f},
-std::array<float,2>{0.527414918f, 0.12985605f},
-std::array<float,2>{0.0643715709f, 0.258430719f},
-std::array<float,2>{0.699713945f, 0.822553337f},
-std::array<float,2>{0.310219735f, 0.675227284f},
-std::array<float,2>{0.841127932f, 0.209837139f},
-std::array<float,2>{0.451331556f, 0.00112713699f},
-std::array<float,2>{0.905855179f, 0.502373636f},
-std::array<float,2>{0.202296942f, 0.928285658f},
-std::array<float,2>{0.606968939f, 0.495138586f},
-std::array<float,2>{0.158060178f, 0.163695589f},
-std::array<float,2>{0.538591564f, 0.704496801f},
-std::array<float,2>{0.427923292f, 0.784288526f},
-std::array<float,2>{0.950584352f, 0.369470537f},
-std::array<float,2>{0.332784414f, 0.411879957f},
-std::array<float,2>{0.759757102f, 0.964886308f},
-std::array<float,2>{0.0519877411f, 0.590171695f},
-std::array<float,2>{0.641589761f, 0.0637719184f},
-std::array<float,2>{0.0444200486f, 0.382585943f},
-std::array<float,2>{0.631202221f, 0.977988243f},
-std::array<float,2>{0.32088685f, 0.610465467f},
-std::array<float,2>{0.771280468f, 0.122055948f},
-std::array<float,2>{0.408199668f, 0.140908688f},
-std::array<float,2>{0.963596165f, 0.741599798f},
-std::array<float,2>{0.183666915f, 0.771587431f},
-std::array<float,2>{0.558546841f, 0.3264516f},
-std::array<float,2>{0.204812109f, 0.0475318171f},
-std::array<float,2>{0.614834547f, 0.559467733f},
-std::array<float,2>{0.455836803f, 0.88862896f},
-std::array<float,2>{0.889182031f, 0.468109846f},
-std::array<float,2>{0.289765894f, 0.29737103f},
-std::array<float,2>{0.817920208f, 0.859339297f},
-std::array<float,2>{0.0838414878f, 0.651483357f},
-std::array<float,2>{0.712947309f, 0.220589325f},
-std::array<float,2>{0.127307117f, 0.354127914f},
-std::array<float,2>{0.502827644f, 0.806100786f},
-std::array<float,2>{0.405574858f, 0.688337803f},
-std::array<float,2>{0.975427449f, 0.187357917f},
-std::array<float,2>{0.354388326f, 0.0832354054f},
-std::array<float,2>{0.796490848f, 0.575124621f},
-std::array<float,2>{0.0116733871f, 0.953092813f},
-std::array<float,2>{0.68118608f, 0.436003238f},
-std::array<float,2>{0.0991032943f, 0.188458964f},
-std::array<float,2>{0.724384069f, 0.667720795f},
-std::array<float,2>{0.265525311f, 0.834408224f},
-std::array<float,2>{0.873069167f, 0.280126631f},
-std::array<float,2>{0.483998984f, 0.482171476f},
-std::array<float,2>{0.93109268f, 0.921255887f},
-std::array<float,2>{0.243872613f, 0.526914835f},
-std::array<float,2>{0.581796825f, 0.0213915017f},
-std::array<float,2>{0.145653933f, 0.474262118f},
-std::array<float,2>{0.526163161f, 0.911924958f},
-std::array<float,2>{0.380112559f, 0.52285099f},
-std::array<float,2>{0.993136764f, 0.0280136503f},
-std::array<float,2>{0.363117725f, 0.20058462f},
-std::array<float,2>{0.808459759f, 0.657160163f},
-std::array<float,2>{0.0260414891f, 0.836377561f},
-std::array<float,2>{0.668942094f, 0.265745223f},
-std::array<float,2>{0.118725628f, 0.0885715187f},
-std::array<float,2>{0.743062079f, 0.569137275f},
-std::array<float,2>{0.280569077f, 0.937791586f},
-std::array<float,2>{0.854955375f, 0.424386382f},
-std::array<float,2>{0.499689639f, 0.34637481f},
-std::array<float,2>{0.921035767f, 0.801246941f},
-std::array<float,2>{0.227573618f, 0.70287168f},
-std::array<float,2>{0.562747002f, 0.176498726f},
-std::array<float,2>{0.0505900867f, 0.306943715f},
-std::array<float,2>{0.645055711f, 0.847399771f},
-std::array<float,2>{0.328952283f, 0.64597851f},
-std::array<float,2>{0.765179813f, 0.228452623f},
-std::array<float,2>{0.423676819f, 0.0552718639f},
-std::array<float,2>{0.946498215f, 0.551668048f},
-std::array<float,2>{0.161658168f, 0.876809776f},
-std::array<float,2>{0.534570754f, 0.457979709f},
-std::array<float,2>{0.197827846f, 0.153785363f},
-std::array<float,2>{0.603912234f, 0.746897936f},
-std::array<float,2>{0.447710395f, 0.774593532f},
-std::array<float,2>{0.89858222f, 0.31940639f},
-std::array<float,2>{0.306353986f, 0.38543278f},
-std::array<float,2>{0.839019239f, 0.972319663f},
-std::array<float,2>{0.0693431199f, 0.621512949f},
-std::array<float,2>{0.698977053f, 0.109491996f},
-std::array<float,2>{0.0811638758f, 0.421796829f},
-std::array<float,2>{0.716781855f, 0.957064569f},
-std::array<float,2>{0.295482278f, 0.579668045f},
-std::array<float,2>{0.812927246f, 0.0770218968f},
-std::array<float,2>{0.459656268f, 0.170093536f},
-std::array<float,2>{0.883141994f, 0.71835202f},
-std::array<float,2>{0.207259193f, 0.794119179f},
-std::array<float,2>{0.610364974f, 0.361159742f},
-std::array<float,2>{0.183116257f, 0.0136350971f},
-std::array<float,2>{0.561606407f, 0.512260556f},
-std::array<float,2>{0.41071412f, 0.932836294f},
-std::array<float,2>{0.967451692f, 0.487603903f},
-std::array<float,2>{0.327607304f, 0.25234589f},
-std::array<float,2>{0.768303037f, 0.816745043f},
-std::array<float,2>{0.0403674282f, 0.684136391f},
-std::array<float,2>{0.6269328f, 0.211008027f},
-std::array<float,2>{0.248785138f, 0.336190432f},
-std::array<float,2>{0.582789421f, 0.752101541f},
-std::array<float,2>{0.477524579f, 0.721476018f},
-std::array<float,2>{0.935686827f, 0.136942014f},
-std::array<float,2>{0.259995908f, 0.107889995f},
-std::array<float,2>{0.870362997f, 0.601640046f},
-std::array<float,2>{0.0970960632f, 0.991545022f},
-std::array<float,2>{0.722471118f, 0.40338254f},
-std::array<float,2>{0.0124568939f, 0.24706389f},
-std::array<float,2>{0.684274971f, 0.627608001f},
-std::array<float,2>{0.357483953f, 0.874421299f},
-std::array<float,2>{0.791367233f, 0.295265228f},
-std::array<float,2>{0.398521513f, 0.446394324f},
-std::array<float,2>{0.970120192f, 0.905616045f},
-std::array<float,2>{0.130884171f, 0.537422717f},
-std::array<float,2>{0.507402658f, 0.0319820568f},
-std::array<float,2>{0.212592945f, 0.395403206f},
-std::array<float,2>{0.623153567f, 0.997712731f},
-std::array<float,2>{0.467252344f, 0.595915556f},
-std::array<float,2>{0.877835691f, 0.0957123637f},
-std::array<float,2>{0.288586318f, 0.128535777f},
-std::array<float,2>{0.821683228f, 0.728149712f},
-std::array<float,2>{0.0863563195f, 0.761149049f},
-std::array<float,2>{0.707976103f, 0.335100681f},
-std::array<float,2>{0.0357368588f, 0.0458597653f},
-std::array<float,2>{0.634104431f, 0.544323623f},
-std::array<float,2>{0.313576669f, 0.893685877f},
-std::array<float,2>{0.777312875f, 0.440876693f},
-std::array<float,2>{0.415199846f, 0.285101891f},
-std::array<float,2>{0.960555553f, 0.862022042f},
-std::array<float,2>{0.179575145f, 0.639982045f},
-std::array<float,2>{0.550135493f, 0.238908976f},
-std::array<float,2>{0.107460625f, 0.374991298f},
-std::array<float,2>{0.729406476f, 0.787101865f},
-std::array<float,2>{0.250538051f, 0.708991408f},
-std::array<float,2>{0.863321483f, 0.159414962f},
-std::array<float,2>{0.476119995f, 0.0680410936f},
-std::array<float,2>{0.924362302f, 0.587903142f},
-std::array<float,2>{0.236109376f, 0.964426458f},
-std::array<float,2>{0.588548243f, 0.408006221f},
-std::array<float,2>{0.134805992f, 0.206780285f},
-std::array<float,2>{0.514368951f, 0.676021516f},
-std::array<float,2>{0.393658817f, 0.827769399f},
-std::array<float,2>{0.977684557f, 0.261986107f},
-std::array<float,2>{0.350478649f, 0.496372551f},
-std::array<float,2>{0.786375642f, 0.924784482f},
-std::array<float,2>{0.00081139477f, 0.504246593f},
-std::array<float,2>{0.678989172f, 0.00418198574f},
-std::array<float,2>{0.0221609976f, 0.462325633f},
-std::array<float,2>{0.656550109f, 0.885784984f},
-std::array<float,2>{0.37248376f, 0.555647314f},
-std::array<float,2>{0.796974182f, 0.0525083765f},
-std::array<float,2>{0.385535538f, 0.223620951f},
-std::array<float,2>{0.985184193f, 0.653138041f},
-std::array<float,2>{0.154710501f, 0.853150249f},
-std::array<float,2>{0.522677124f, 0.304401845f},
-std::array<float,2>{0.223081887f, 0.120795034f},
-std::array<float,2>{0.571814775f, 0.614022136f},
-std::array<float,2>{0.490941972f, 0.984127104f},
-std::array<float,2>{0.908463657f, 0.377498925f},
-std::array<float,2>{0.272439808f, 0.322293162f},
-std::array<float,2>{0.844403505f, 0.768472373f},
-std::array<float,2>{0.112310976f, 0.735276163f},
-std::array<float,2>{0.741764843f, 0.145047739f},
-std::array<float,2>{0.164162591f, 0.274905324f},
-std::array<float,2>{0.546593904f, 0.828926742f},
-std::array<float,2>{0.43072924f, 0.66876018f},
-std::array<float,2>{0.941625535f, 0.193977997f},
-std::array<float,2>{0.341557831f, 0.0170345325f},
-std::array<float,2>{0.75454402f, 0.528570592f},
-std::array<float,2>{0.059866745f, 0.915587008f},
-std::array<float,2>{0.655662358f, 0.477906227f},
-std::array<float,2>{0.0751062483f, 0.182411686f},
-std::array<float,2>{0.69059211f, 0.692904294f},
-std::array<float,2>{0.297036022f, 0.808817804f},
-std::array<float,2>{0.834072053f, 0.358256072f},
-std::array<float,2>{0.442007273f, 0.432579935f},
-std::array<float,2>{0.896776438f, 0.947031558f},
-std::array<float,2>{0.194472998f, 0.5728091f},
-std::array<float,2>{0.59951055f, 0.0802058205f},
-std::array<float,2>{0.184296325f, 0.380053967f},
-std::array<float,2>{0.558084309f, 0.978651345f},
-std::array<float,2>{0.407418668f, 0.612045169f},
-std::array<float,2>{0.963062584f, 0.12489973f},
-std::array<float,2>{0.320595056f, 0.144068643f},
-std::array<float,2>{0.770623744f, 0.738419592f},
-std::array<float,2>{0.0448070988f, 0.77060461f},
-std::array<float,2>{0.631790936f, 0.325476676f},
-std::array<float,2>{0.0832186863f, 0.0496495664f},
-std::array<float,2>{0.713779151f, 0.56158787f},
-std::array<float,2>{0.289475262f, 0.890260816f},
-std::array<float,2>{0.817733347f, 0.466170937f},
-std::array<float,2>{0.455418646f, 0.300218225f},
-std::array<float,2>{0.888681412f, 0.855816543f},
-std::array<float,2>{0.20423086f, 0.649369121f},
-std::array<float,2>{0.614657044f, 0.221334741f},
-std::array<float,2>{0.0108441589f, 0.352197587f},
-std::array<float,2>{0.680683434f, 0.80841285f},
-std::array<float,2>{0.353578925f, 0.689966321f},
-std::array<float,2>{0.796003461f, 0.185048789f},
-std::array<float,2>{0.406223029f, 0.0842705294f},
-std::array<float,2>{0.974619508f, 0.577146828f},
-std::array<float,2>{0.127808645f, 0.94982326f},
-std::array<float,2>{0.502406299f, 0.434839994f},
-std::array<float,2>{0.243626684f, 0.190419525f},
-std::array<float,2>{0.581347287f, 0.664913893f},
-std::array<float,2>{0.483562082f, 0.832976341f},
-std::array<float,2>{0.931153059f, 0.278800786f},
-std::array<float,2>{0.264900506f, 0.483652562f},
-std::array<float,2>{0.873797953f, 0.918952167f},
-std::array<float,2>{0.0994471163f, 0.523512304f},
-std::array<float,2>{0.723649681f, 0.0231521614f},
-std::array<float,2>{0.123124979f, 0.441765726f},
-std::array<float,2>{0.746275127f, 0.894990027f},
-std::array<float,2>{0.276962489f, 0.540933549f},
-std::array<float,2>{0.857276201f, 0.0421159901f},
-std::array<float,2>{0.492896974f, 0.23455748f},
-std::array<float,2>{0.914575875f, 0.633948743f},
-std::array<float,2>{0.232034341f, 0.866589487f},
-std::array<float,2>{0.567853749f, 0.287786543f},
-std::array<float,2>{0.141772702f, 0.0981988758f},
-std::array<float,2>{0.528173387f, 0.59863919f},
-std::array<float,2>{0.377976447f, 0.995987594f},
-std::array<float,2>{0.999279678f, 0.391549885f},
-std::array<float,2>{0.364615977f, 0.330971211f},
-std::array<float,2>{0.810136199f, 0.763027847f},
-std::array<float,2>{0.0277861804f, 0.732379198f},
-std::array<float,2>{0.666883707f, 0.132803544f},
-std::array<float,2>{0.203121483f, 0.259957999f},
-std::array<float,2>{0.606540143f, 0.820694804f},
-std::array<float,2>{0.452046603f, 0.673416138f},
-std::array<float,2>{0.905491829f, 0.207366049f},
-std::array<float,2>{0.309948921f, 0.00251960219f},
-std::array<float,2>{0.841397762f, 0.500380337f},
-std::array<float,2>{0.0637769923f, 0.926238418f},
-std::array<float,2>{0.699280262f, 0.493479311f},
-std::array<float,2>{0.0522480495f, 0.160307169f},
-std::array<float,2>{0.641053438f, 0.705819666f},
-std::array<float,2>{0.332214117f, 0.78290838f},
-std::array<float,2>{0.758911133f, 0.368571281f},
-std::array<float,2>{0.42867732f, 0.413597882f},
-std::array<float,2>{0.950839758f, 0.968104661f},
-std::array<float,2>{0.157670945f, 0.591877401f},
-std::array<float,2>{0.538252413f, 0.0653693229f},
-std::array<float,2>{0.218981728f, 0.491732776f},
-std::array<float,2>{0.574229598f, 0.935579598f},
-std::array<float,2>{0.485478699f, 0.511568367f},
-std::array<float,2>{0.910587728f, 0.0113071231f},
-std::array<float,2>{0.2664074f, 0.215268165f},
-std::array<float,2>{0.848386467f, 0.681933224f},
-std::array<float,2>{0.115137465f, 0.81515646f},
-std::array<float,2>{0.737076461f, 0.254651487f},
-std::array<float,2>{0.0194237754f, 0.0704329237f},
-std::array<float,2>{0.662780881f, 0.583006144f},
-std::array<float,2>{0.369059294f, 0.954508305f},
-std::array<float,2>{0.801060855f, 0.415612787f},
-std::array<float,2>{0.387492746f, 0.364852756f},
-std::array<float,2>{0.991139472f, 0.792708695f},
-std::array<float,2>{0.149824157f, 0.713473022f},
-std::array<float,2>{0.519135177f, 0.165781483f},
-std::array<float,2>{0.0703155249f, 0.292904884f},
-std::array<float,2>{0.692857683f, 0.870362699f},
-std::array<float,2>{0.301988155f, 0.629027367f},
-std::array<float,2>{0.830254674f, 0.242661163f},
-std::array<float,2>{0.437987f, 0.0361027382f},
-std::array<float,2>{0.893594325f, 0.532200336f},
-std::array<float,2>{0.190862447f, 0.900936067f},
-std::array<float,2>{0.595071912f, 0.450227886f},
-std::array<float,2>{0.17018877f, 0.134857953f},
-std::array<float,2>{0.540671468f, 0.726198971f},
-std::array<float,2>{0.43572849f, 0.754045427f},
-std::array<float,2>{0.940444708f, 0.340438515f},
-std::array<float,2>{0.339731276f, 0.399193794f},
-std::array<float,2>{0.752509117f, 0.986813843f},
-std::array<float,2>{0.0585344397f, 0.605526984f},
-std::array<float,2>{0.650108218f, 0.103833921f},
-std::array<float,2>{0.0332257338f, 0.428964794f},
-std::array<float,2>{0.639394462f, 0.94467622f},
-std::array<float,2>{0.316413879f, 0.56640017f},
-std::array<float,2>{0.780575514f, 0.0927221328f},
-std::array<float,2>{0.418359309f, 0.172687709f},
-std::array<float,2>{0.956202984f, 0.696688414f},
-std::array<float,2>{0.172657743f, 0.799593687f},
-std::array<float,2>{0.552362621f, 0.348409235f},
-std::array<float,2>{0.215874106f, 0.0267468393f},
-std::array<float,2>{0.619766831f, 0.516563058f},
-std::array<float,2>{0.461144775f, 0.908589542f},
-std::array<float,2>{0.882322252f, 0.470339924f},
-std::array<float,2>{0.284020752f, 0.271104783f},
-std::array<float,2>{0.827617288f, 0.840380669f},
-std::array<float,2>{0.09158355f, 0.661497056f},
-std::array<float,2>{0.7056005f, 0.195964873f},
-std::array<float,2>{0.136725977f, 0.312611967f},
-std::array<float,2>{0.508091807f, 0.778906822f},
-std::array<float,2>{0.395182639f, 0.742543161f},
-std::array<float,2>{0.983354449f, 0.148577094f},
-std::array<float,2>{0.347235262f, 0.115390331f},
-std::array<float,2>{0.782014728f, 0.617977142f},
-std::array<float,2>{0.00501028541f, 0.976347089f},
-std::array<float,2>{0.674441099f, 0.386999756f},
-std::array<float,2>{0.10361807f, 0.233733505f},
-std::array<float,2>{0.73313421f, 0.642214596f},
-std::array<float,2>{0.25573954f, 0.84921366f},
-std::array<float,2>{0.862431645f, 0.310105681f},
-std::array<float,2>{0.471365929f, 0.454631537f},
-std::array<float,2>{0.927031338f, 0.880379498f},
-std::array<float,2>{0.24164331f, 0.549598575f},
-std::array<float,2>{0.590102255f, 0.0620386153f},
-std::array<float,2>{0.154868051f, 0.46388945f},
-std::array<float,2>{0.523107767f, 0.883071005f},
-std::array<float,2>{0.385048836f, 0.558070123f},
-std::array<float,2>{0.984839618f, 0.0541460849f},
-std::array<float,2>{0.372912973f, 0.225874335f},
-std::array<float,2>{0.797712922f, 0.656223416f},
-std::array<float,2>{0.0217313487f, 0.854131758f},
-std::array<float,2>{0.657118678f, 0.301168263f},
-std::array<float,2>{0.113106623f, 0.118457548f},
-std::array<float,2>{0.741531372f, 0.615302145f},
-std::array<float,2>{0.271839857f, 0.981205106f},
-std::array<float,2>{0.843855739f, 0.376564085f},
-std::array<float,2>{0.490490615f, 0.320559978f},
-std::array<float,2>{0.908929288f, 0.767520607f},
-std::array<float,2>{0.223613679f, 0.737599432f},
-std::array<float,2>{0.57172209f, 0.148239568f},
-std::array<float,2>{0.0600686632f, 0.276586711f},
-std::array<float,2>{0.656078756f, 0.83188355f},
-std::array<float,2>{0.341155082f, 0.67155838f},
-std::array<float,2>{0.7542575f, 0.193186775f},
-std::array<float,2>{0.431279898f, 0.0182720851f},
-std::array<float,2>{0.942017913f, 0.530468047f},
-std::array<float,2>{0.16492933f, 0.916759074f},
-std::array<float,2>{0.546320438f, 0.47993803f},
-std::array<float,2>{0.195200548f, 0.180627435f},
-std::array<float,2>{0.598990142f, 0.695067585f},
-std::array<float,2>{0.441803426f, 0.811229885f},
-std::array<float,2>{0.897023141f, 0.356154919f},
-std::array<float,2>{0.297657996f, 0.431188285f},
-std::array<float,2>{0.834924161f, 0.947717786f},
-std::array<float,2>{0.0746486709f, 0.570737898f},
-std::array<float,2>{0.691270411f, 0.0792819858f},
-std::array<float,2>{0.0868730098f, 0.397862256f},
-std::array<float,2>{0.707332313f, 0.998964071f},
-std::array<float,2>{0.288423032f, 0.595128655f},
-std::array<float,2>{0.82191664f, 0.0945566222f},
-std::array<float,2>{0.467602402f, 0.125335708f},
-std::array<float,2>{0.877151489f, 0.730400681f},
-std::array<float,2>{0.212033659f, 0.758903027f},
-std::array<float,2>{0.623731971f, 0.332264245f},
-std::array<float,2>{0.179153204f, 0.0431697443f},
-std::array<float,2>{0.550324678f, 0.546641469f},
-std::array<float,2>{0.415596962f, 0.892077625f},
-std::array<float,2>{0.960019708f, 0.438612789f},
-std::array<float,2>{0.314331293f, 0.281359881f},
-std::array<float,2>{0.776603043f, 0.86107564f},
-std::array<float,2>{0.0352701992f, 0.637413979f},
-std::array<float,2>{0.634289503f, 0.240710646f},
-std::array<float,2>{0.235741898f, 0.371504605f},
-std::array<float,2>{0.588053882f, 0.787533045f},
-std::array<float,2>{0.475798339f, 0.708218813f},
-std::array<float,2>{0.924091637f, 0.157245368f},
-std::array<float,2>{0.250166506f, 0.0690652728f},
-std::array<float,2>{0.864007652f, 0.587637305f},
-std::array<float,2>{0.10813003f, 0.962791324f},
-std::array<float,2>{0.728937149f, 0.409447104f},
-std::array<float,2>{0.000185270386f, 0.204552814f},
-std::array<float,2>{0.679561734f, 0.678115249f},
-std::array<float,2>{0.349753112f, 0.825618267f},
-std::array<float,2>{0.786697984f, 0.264914483f},
-std::array<float,2>{0.39444828f, 0.498133808f},
-std::array<float,2>{0.978298604f, 0.922425687f},
-std::array<float,2>{0.135423318f, 0.507047832f},
-std::array<float,2>{0.513697684f, 0.00678573176f},
-std::array<float,2>{0.207947031f, 0.418882251f},
-std::array<float,2>{0.611188531f, 0.960106552f},
-std::array<float,2>{0.45945105f, 0.581976354f},
-std::array<float,2>{0.883768439f, 0.0753881782f},
-std::array<float,2>{0.295171976f, 0.168258488f},
-std::array<float,2>{0.81319052f, 0.715670168f},
-std::array<float,2>{0.0818036497f, 0.795944452f},
-std::array<float,2>{0.71614176f, 0.363107294f},
-std::array<float,2>{0.0405288227f, 0.015403281f},
-std::array<float,2>{0.626152337f, 0.514750242f},
-std::array<float,2>{0.32766661f, 0.930780828f},
-std::array<float,2>{0.768061459f, 0.486085802f},
-std::array<float,2>{0.410275906f, 0.250087291f},
-std::array<float,2>{0.96698308f, 0.818834722f},
-std::array<float,2>{0.182868242f, 0.687227726f},
-std::array<float,2>{0.56247884f, 0.21380432f},
-std::array<float,2>{0.0976072922f, 0.338333398f},
-std::array<float,2>{0.722149014f, 0.751475573f},
-std::array<float,2>{0.260366917f, 0.718951523f},
-std::array<float,2>{0.870787859f, 0.139978871f},
-std::array<float,2>{0.476845294f, 0.106592543f},
-std::array<float,2>{0.936416447f, 0.605079532f},
-std::array<float,2>{0.248050034f, 0.989847004f},
-std::array<float,2>{0.58249718f, 0.40520823f},
-std::array<float,2>{0.131429642f, 0.249975473f},
-std::array<float,2>{0.507209957f, 0.626891077f},
-std::array<float,2>{0.399080575f, 0.871658146f},
-std::array<float,2>{0.970371544f, 0.293442428f},
-std::array<float,2>{0.358089387f, 0.447867841f},
-std::array<float,2>{0.79157877f, 0.902464807f},
-std::array<float,2>{0.0120804543f, 0.536754906f},
-std::array<float,2>{0.683685124f, 0.034168981f},
-std::array<float,2>{0.0254593771f, 0.475660503f},
-std::array<float,2>{0.668131471f, 0.91290313f},
-std::array<float,2>{0.362593323f, 0.521473944f},
-std::array<float,2>{0.807652593f, 0.0303136427f},
-std::array<float,2>{0.380794764f, 0.201258764f},
-std::array<float,2>{0.99253279f, 0.658664942f},
-std::array<float,2>{0.146056369f, 0.838803291f},
-std::array<float,2>{0.525499105f, 0.269522697f},
-std::array<float,2>{0.228416145f, 0.0874626637f},
-std::array<float,2>{0.563409328f, 0.567065656f},
-std::array<float,2>{0.49922365f, 0.940177381f},
-std::array<float,2>{0.921652138f, 0.4222956f},
-std::array<float,2>{0.281080723f, 0.34542945f},
-std::array<float,2>{0.855320871f, 0.803036332f},
-std::array<float,2>{0.118199795f, 0.700647235f},
-std::array<float,2>{0.742631555f, 0.178190574f},
-std::array<float,2>{0.16156517f, 0.305214912f},
-std::array<float,2>{0.535104692f, 0.843846738f},
-std::array<float,2>{0.423164219f, 0.647264421f},
-std::array<float,2>{0.94692421f, 0.230199367f},
-std::array<float,2>{0.328360081f, 0.0576780252f},
-std::array<float,2>{0.764826953f, 0.553443074f},
-std::array<float,2>{0.0498090163f, 0.878368676f},
-std::array<float,2>{0.644789755f, 0.459751576f},
-std::array<float,2>{0.0700300634f, 0.155313492f},
-std::array<float,2>{0.698653996f, 0.748532832f},
-std::array<float,2>{0.305685908f, 0.777209938f},
-std::array<float,2>{0.839491189f, 0.317970842f},
-std::array<float,2>{0.448142439f, 0.383118749f},
-std::array<float,2>{0.899247468f, 0.969022453f},
-std::array<float,2>{0.197424427f, 0.624111176f},
-std::array<float,2>{0.60427326f, 0.111422636f},
-std::array<float,2>{0.12563993f, 0.436328501f},
-std::array<float,2>{0.500087678f, 0.952354372f},
-std::array<float,2>{0.403447479f, 0.574569106f},
-std::array<float,2>{0.973180652f, 0.0839514285f},
-std::array<float,2>{0.352281064f, 0.186592698f},
-std::array<float,2>{0.794559419f, 0.68769908f},
-std::array<float,2>{0.00891857501f, 0.806312442f},
-std::array<float,2>{0.681776404f, 0.353540629f},
-std::array<float,2>{0.0997738391f, 0.0206153318f},
-std::array<float,2>{0.724685133f, 0.526736736f},
-std::array<float,2>{0.263592571f, 0.921472073f},
-std::array<float,2>{0.871660888f, 0.481597245f},
-std::array<float,2>{0.481993914f, 0.279755741f},
-std::array<float,2>{0.933318734f, 0.83462745f},
-std::array<float,2>{0.244487986f, 0.666994035f},
-std::array<float,2>{0.579122901f, 0.18797791f},
-std::array<float,2>{0.0457999445f, 0.327046841f},
-std::array<float,2>{0.630222976f, 0.772351801f},
-std::array<float,2>{0.322928995f, 0.742011487f},
-std::array<float,2>{0.772050619f, 0.141152248f},
-std::array<float,2>{0.409000844f, 0.121446371f},
-std::array<float,2>{0.96209538f, 0.610879838f},
-std::array<float,2>{0.186848506f, 0.978511095f},
-std::array<float,2>{0.555681229f, 0.381908447f},
-std::array<float,2>{0.205748349f, 0.219783515f},
-std::array<float,2>{0.616823077f, 0.652272105f},
-std::array<float,2>{0.45496738f, 0.858735025f},
-std::array<float,2>{0.887270689f, 0.297215402f},
-std::array<float,2>{0.292630672f, 0.468338072f},
-std::array<float,2>{0.818608522f, 0.887827873f},
-std::array<float,2>{0.0858103782f, 0.558900177f},
-std::array<float,2>{0.712682366f, 0.0470305607f},
-std::array<float,2>{0.0661416277f, 0.495708734f},
-std::array<float,2>{0.702657402f, 0.928096116f},
-std::array<float,2>{0.311472327f, 0.502573133f},
-std::array<float,2>{0.841860712f, 0.00168367918f},
-std::array<float,2>{0.449661672f, 0.208989233f},
-std::array<float,2>{0.903165877f, 0.675690114f},
-std::array<float,2>{0.199378848f, 0.823069811f},
-std::array<float,2>{0.608058095f, 0.258249789f},
-std::array<float,2>{0.159133032f, 0.0641155839f},
-std::array<float,2>{0.53658247f, 0.590817809f},
-std::array<float,2>{0.426171094f, 0.96579957f},
-std::array<float,2>{0.952614188f, 0.411453873f},
-std::array<float,2>{0.334852129f, 0.369734108f},
-std::array<float,2>{0.760622919f, 0.784905255f},
-std::array<float,2>{0.0535249002f, 0.704667568f},
-std::array<float,2>{0.643779218f, 0.163147956f},
-std::array<float,2>{0.232601777f, 0.285730124f},
-std::array<float,2>{0.568406641f, 0.86373806f},
-std::array<float,2>{0.495396703f, 0.636682987f},
-std::array<float,2>{0.917553127f, 0.236848012f},
-std::array<float,2>{0.273935407f, 0.0396929309f},
-std::array<float,2>{0.859096944f, 0.542577267f},
-std::array<float,2>{0.121533595f, 0.896967471f},
-std::array<float,2>{0.749323249f, 0.445094228f},
-std::array<float,2>{0.0305071734f, 0.129157379f},
-std::array<float,2>{0.664548159f, 0.733033895f},
-std::array<float,2>{0.365778416f, 0.763679981f},
-std::array<float,2>{0.812114418f, 0.329529554f},
-std::array<float,2>{0.37596333f, 0.392772138f},
-std::array<float,2>{0.99695164f, 0.993665218f},
-std::array<float,2>{0.143372685f, 0.601425886f},
-std::array<float,2>{0.53013885f, 0.101138212f},
-std::array<float,2>{0.188908845f, 0.452301532f},
-std::array<float,2>{0.597448587f, 0.898912191f},
-std::array<float,2>{0.440394133f, 0.53322345f},
-std::array<float,2>{0.890720367f, 0.037336804f},
-std::array<float,2>{0.30390653f, 0.244647399f},
-std::array<float,2>{0.829574227f, 0.631377995f},
-std::array<float,2>{0.0736313239f, 0.867828369f},
-std::array<float,2>{0.694299996f, 0.289604425f},
-std::array<float,2>{0.0547631867f, 0.103495948f},
-std::array<float,2>{0.651536107f, 0.608365774f},
-std::array<float,2>{0.336681306f, 0.986100554f},
-std::array<float,2>{0.750430703f, 0.401828825f},
-std::array<float,2>{0.435146749f, 0.343686968f},
-std::array<float,2>{0.938845992f, 0.757291257f},
-std::array<float,2>{0.168727383f, 0.723944843f},
-std::array<float,2>{0.542280614f, 0.133403838f},
-std::array<float,2>{0.116216473f, 0.257706553f},
-std::array<float,2>{0.734532773f, 0.813405752f},
-std::array<float,2>{0.268497765f, 0.680364549f},
-std::array<float,2>{0.85055685f, 0.217793152f},
-std::array<float,2>{0.486698836f, 0.00786608551f},
-std::array<float,2>{0.912344635f, 0.508674622f},
-std::array<float,2>{0.222002268f, 0.935183585f},
-std::array<float,2>{0.577032208f, 0.48840642f},
-std::array<float,2>{0.151339293f, 0.167173043f},
-std::array<float,2>{0.517546058f, 0.711606145f},
-std::array<float,2>{0.389881313f, 0.79022187f},
-std::array<float,2>{0.988652885f, 0.367026389f},
-std::array<float,2>{0.369533867f, 0.416461498f},
-std::array<float,2>{0.803556025f, 0.955685139f},
-std::array<float,2>{0.0171992276f, 0.584647477f},
-std::array<float,2>{0.660553575f, 0.0733554885f},
-std::array<float,2>{0.00726426626f, 0.388700694f},
-std::array<float,2>{0.673249662f, 0.974473715f},
-std::array<float,2>{0.344622999f, 0.619273722f},
-std::array<float,2>{0.783959866f, 0.113976061f},
-std::array<float,2>{0.397334754f, 0.152270287f},
-std::array<float,2>{0.981186867f, 0.745643675f},
-std::array<float,2>{0.139451593f, 0.78061229f},
-std::array<float,2>{0.509930432f, 0.316062659f},
-std::array<float,2>{0.23881501f, 0.0588052645f},
-std::array<float,2>{0.592823029f, 0.546996176f},
-std::array<float,2>{0.468827605f, 0.882518589f},
-std::array<float,2>{0.927833259f, 0.456372172f},
-std::array<float,2>{0.256442815f, 0.311268896f},
-std::array<float,2>{0.859785378f, 0.849842966f},
-std::array<float,2>{0.102716133f, 0.642995775f},
-std::array<float,2>{0.731544375f, 0.230620772f},
-std::array<float,2>{0.174851015f, 0.351557195f},
-std::array<float,2>{0.554048061f, 0.798581243f},
-std::array<float,2>{0.420944661f, 0.697936535f},
-std::array<float,2>{0.953473747f, 0.175108224f},
-std::array<float,2>{0.318751663f, 0.0903274044f},
-std::array<float,2>{0.777917385f, 0.562875092f},
-std::array<float,2>{0.0328518264f, 0.943293452f},
-std::array<float,2>{0.637686789f, 0.426505774f},
-std::array<float,2>{0.0918880254f, 0.198866457f},
-std::array<float,2>{0.703895748f, 0.663716316f},
-std::array<float,2>{0.281949371f, 0.84330225f},
-std::array<float,2>{0.825140357f, 0.272126466f},
-std::array<float,2>{0.464690804f, 0.470868409f},
-std::array<float,2>{0.879488647f, 0.906327426f},
-std::array<float,2>{0.217908606f, 0.518482447f},
-std::array<float,2>{0.617352903f, 0.0243170541f},
-std::array<float,2>{0.166956022f, 0.478253096f},
-std::array<float,2>{0.544192851f, 0.915112078f},
-std::array<float,2>{0.432337403f, 0.529214978f},
-std::array<float,2>{0.945280612f, 0.0175616667f},
-std::array<float,2>{0.343438029f, 0.193551943f},
-std::array<float,2>{0.757294416f, 0.668003917f},
-std::array<float,2>{0.0619853735f, 0.828271925f},
-std::array<float,2>{0.653198481f, 0.274775594f},
-std::array<float,2>{0.0765475482f, 0.0809909701f},
-std::array<float,2>{0.688808322f, 0.572469294f},
-std::array<float,2>{0.299655825f, 0.946701825f},
-std::array<float,2>{0.833399177f, 0.431742638f},
-std::array<float,2>{0.443461925f, 0.357750148f},
-std::array<float,2>{0.894612908f, 0.809509397f},
-std::array<float,2>{0.192034841f, 0.692708373f},
-std::array<float,2>{0.600504279f, 0.182052657f},
-std::array<float,2>{0.0202269871f, 0.304193854f},
-std::array<float,2>{0.658499718f, 0.852807283f},
-std::array<float,2>{0.374046028f, 0.652452767f},
-std::array<float,2>{0.798907638f, 0.223032847f},
-std::array<float,2>{0.382996768f, 0.0519278497f},
-std::array<float,2>{0.98737222f, 0.555153489f},
-std::array<float,2>{0.152495518f, 0.886517525f},
-std::array<float,2>{0.519952357f, 0.46283859f},
-std::array<float,2>{0.226413459f, 0.144533515f},
-std::array<float,2>{0.573590696f, 0.734626293f},
-std::array<float,2>{0.488723218f, 0.767927289f},
-std::array<float,2>{0.906412363f, 0.322814643f},
-std::array<float,2>{0.271359801f, 0.377373815f},
-std::array<float,2>{0.847554326f, 0.983882546f},
-std::array<float,2>{0.109579854f, 0.613572717f},
-std::array<float,2>{0.739208996f, 0.120328687f},
-std::array<float,2>{0.106936142f, 0.407520503f},
-std::array<float,2>{0.727001667f, 0.964031696f},
-std::array<float,2>{0.2531856f, 0.588408947f},
-std::array<float,2>{0.867014825f, 0.0674845874f},
-std::array<float,2>{0.474362791f, 0.160006389f},
-std::array<float,2>{0.923413336f, 0.709498286f},
-std::array<float,2>{0.236642957f, 0.786499023f},
-std::array<float,2>{0.587513924f, 0.374042749f},
-std::array<float,2>{0.134360358f, 0.00484830886f},
-std::array<float,2>{0.511911631f, 0.504820943f},
-std::array<float,2>{0.392392218f, 0.924284816f},
-std::array<float,2>{0.980229139f, 0.496734232f},
-std::array<float,2>{0.34824121f, 0.26266405f},
-std::array<float,2>{0.788475156f, 0.827368319f},
-std::array<float,2>{0.00348068704f, 0.676521063f},
-std::array<float,2>{0.677041173f, 0.206173226f},
-std::array<float,2>{0.214519367f, 0.335661918f},
-std::array<float,2>{0.622819185f, 0.761504948f},
-std::array<float,2>{0.465161115f, 0.727789462f},
-std::array<float,2>{0.876207888f, 0.12801531f},
-std::array<float,2>{0.286767721f, 0.096433416f},
-std::array<float,2>{0.822538495f, 0.596670628f},
-std::array<float,2>{0.0880032629f, 0.997335792f},
-std::array<float,2>{0.709020853f, 0.39493677f},
-std::array<float,2>{0.0376204923f, 0.238670498f},
-std::array<float,2>{0.635948539f, 0.640315473f},
-std::array<float,2>{0.315517604f, 0.861331701f},
-std::array<float,2>{0.77392149f, 0.284320116f},
-std::array<float,2>{0.417920679f, 0.441215485f},
-std::array<float,2>{0.958588719f, 0.894153595f},
-std::array<float,2>{0.177573949f, 0.544578671f},
-std::array<float,2>{0.547966957f, 0.0452739f},
-std::array<float,2>{0.247686043f, 0.403918743f},
-std::array<float,2>{0.584517717f, 0.991756201f},
-std::array<float,2>{0.479140252f, 0.602341533f},
-std::array<float,2>{0.933737636f, 0.107938074f},
-std::array<float,2>{0.259237409f, 0.137275323f},
-std::array<float,2>{0.867240548f, 0.721137106f},
-std::array<float,2>{0.0937901214f, 0.752527952f},
-std::array<float,2>{0.719913423f, 0.33654809f},
-std::array<float,2>{0.014601374f, 0.0316090994f},
-std::array<float,2>{0.686037302f, 0.538038313f},
-std::array<float,2>{0.356220156f, 0.906196296f},
-std::array<float,2>{0.790181994f, 0.446888775f},
-std::array<float,2>{0.401863277f, 0.295781344f},
-std::array<float,2>{0.971041083f, 0.874957263f},
-std::array<float,2>{0.130423561f, 0.627053797f},
-std::array<float,2>{0.504644871f, 0.24657014f},
-std::array<float,2>{0.0788076818f, 0.360586733f},
-std::array<float,2>{0.716877878f, 0.794865549f},
-std::array<float,2>{0.294044346f, 0.718217075f},
-std::array<float,2>{0.814689875f, 0.170474634f},
-std::array<float,2>{0.45763582f, 0.0764908344f},
-std::array<float,2>{0.886465132f, 0.579212368f},
-std::array<float,2>{0.209976912f, 0.957843006f},
-std::array<float,2>{0.612517774f, 0.421086252f},
-std::array<float,2>{0.180908069f, 0.211769328f},
-std::array<float,2>{0.559958458f, 0.684008062f},
-std::array<float,2>{0.413941205f, 0.817126393f},
-std::array<float,2>{0.965427637f, 0.252878875f},
-std::array<float,2>{0.324552506f, 0.488247752f},
-std::array<float,2>{0.766728163f, 0.933421195f},
-std::array<float,2>{0.0416726768f, 0.512096643f},
-std::array<float,2>{0.628171444f, 0.0127389226f},
-std::array<float,2>{0.0482034311f, 0.457442522f},
-std::array<float,2>{0.646934509f, 0.876323164f},
-std::array<float,2>{0.331462801f, 0.55090481f},
-std::array<float,2>{0.76290524f, 0.0547445863f},
-std::array<float,2>{0.424888045f, 0.227699071f},
-std::array<float,2>{0.948764384f, 0.646086812f},
-std::array<float,2>{0.162452236f, 0.846769094f},
-std::array<float,2>{0.531556487f, 0.307328194f},
-std::array<float,2>{0.196091548f, 0.110002249f},
-std::array<float,2>{0.60316354f, 0.622028053f},
-std::array<float,2>{0.446194828f, 0.971938491f},
-std::array<float,2>{0.900959909f, 0.385237932f},
-std::array<float,2>{0.306895912f, 0.320080966f},
-std::array<float,2>{0.837328434f, 0.775373578f},
-std::array<float,2>{0.068049781f, 0.746247053f},
-std::array<float,2>{0.695969701f, 0.154008418f},
-std::array<float,2>{0.147627324f, 0.266453177f},
-std::array<float,2>{0.523570657f, 0.83658427f},
-std::array<float,2>{0.381185532f, 0.656362832f},
-std::array<float,2>{0.995157719f, 0.200998455f},
-std::array<float,2>{0.360189021f, 0.0275720507f},
-std::array<float,2>{0.805677831f, 0.523419082f},
-std::array<float,2>{0.0253370292f, 0.911209226f},
-std::array<float,2>{0.671866834f, 0.473865598f},
-std::array<float,2>{0.120845526f, 0.17599003f},
-std::array<float,2>{0.745092452f, 0.702219844f},
-std::array<float,2>{0.277762443f, 0.801441908f},
-std::array<float,2>{0.852730215f, 0.34596625f},
-std::array<float,2>{0.496996045f, 0.42422092f},
-std::array<float,2>{0.919539273f, 0.938253582f},
-std::array<float,2>{0.230408922f, 0.568642259f},
-std::array<float,2>{0.566098809f, 0.0880978778f},
-std::array<float,2>{0.143905565f, 0.392438591f},
-std::array<float,2>{0.530639172f, 0.994252086f},
-std::array<float,2>{0.376269966f, 0.597912014f},
-std::array<float,2>{0.997218132f, 0.0992551744f},
-std::array<float,2>{0.366560876f, 0.131600484f},
-std::array<float,2>{0.810711622f, 0.731323361f},
-std::array<float,2>{0.0293957666f, 0.762218773f},
-std::array<float,2>{0.665854156f, 0.331480056f},
-std::array<float,2>{0.122367561f, 0.0415518209f},
-std::array<float,2>{0.748405576f, 0.539664149f},
-std::array<float,2>{0.274687618f, 0.895664871f},
-std::array<float,2>{0.858332336f, 0.44265005f},
-std::array<float,2>{0.494942576f, 0.288850397f},
-std::array<float,2>{0.91605252f, 0.865348816f},
-std::array<float,2>{0.233767822f, 0.633170247f},
-std::array<float,2>{0.569709539f, 0.236073568f},
-std::array<float,2>{0.0539506301f, 0.367897898f},
-std::array<float,2>{0.642736495f, 0.781482577f},
-std::array<float,2>{0.335435629f, 0.707002819f},
-std::array<float,2>{0.761512876f, 0.161610186f},
-std::array<float,2>{0.427560866f, 0.0656785443f},
-std::array<float,2>{0.951684117f, 0.593045413f},
-std::array<float,2>{0.15952076f, 0.967261612f},
-std::array<float,2>{0.535746336f, 0.412649602f},
-std::array<float,2>{0.201164946f, 0.208105236f},
-std::array<float,2>{0.609319568f, 0.672566056f},
-std::array<float,2>{0.450339139f, 0.82133472f},
-std::array<float,2>{0.903751314f, 0.261229604f},
-std::array<float,2>{0.31227839f, 0.492671102f},
-std::array<float,2>{0.843035817f, 0.92695421f},
-std::array<float,2>{0.0648191422f, 0.501908302f},
-std::array<float,2>{0.7012555f, 0.00322104408f},
-std::array<float,2>{0.0841531679f, 0.465441585f},
-std::array<float,2>{0.711771488f, 0.889112055f},
-std::array<float,2>{0.291162342f, 0.561493516f},
-std::array<float,2>{0.819908261f, 0.0499681011f},
-std::array<float,2>{0.453793228f, 0.221690655f},
-std::array<float,2>{0.888178885f, 0.650029898f},
-std::array<float,2>{0.206983626f, 0.85670507f},
-std::array<float,2>{0.615649104f, 0.299096107f},
-std::array<float,2>{0.185731411f, 0.123968087f},
-std::array<float,2>{0.554720879f, 0.613210738f},
-std::array<float,2>{0.409341604f, 0.979817748f},
-std::array<float,2>{0.961856127f, 0.379029036f},
-std::array<float,2>{0.323962957f, 0.324481159f},
-std::array<float,2>{0.772575438f, 0.769850731f},
-std::array<float,2>{0.0463507064f, 0.739562511f},
-std::array<float,2>{0.629822433f, 0.142869323f},
-std::array<float,2>{0.245827541f, 0.27765277f},
-std::array<float,2>{0.578644216f, 0.833610713f},
-std::array<float,2>{0.48119393f, 0.665321946f},
-std::array<float,2>{0.931692362f, 0.191290036f},
-std::array<float,2>{0.262306482f, 0.0220992565f},
-std::array<float,2>{0.872266889f, 0.525006592f},
-std::array<float,2>{0.101544939f, 0.918570161f},
-std::array<float,2>{0.725899339f, 0.483018547f},
-std::array<float,2>{0.00844527315f, 0.183976576f},
-std::array<float,2>{0.683000147f, 0.691176772f},
-std::array<float,2>{0.353015214f, 0.807522774f},
-std::array<float,2>{0.793484151f, 0.352596372f},
-std::array<float,2>{0.402972907f, 0.434548169f},
-std::array<float,2>{0.974409699f, 0.950608969f},
-std::array<float,2>{0.126429901f, 0.577723026f},
-std::array<float,2>{0.501336455f, 0.085414283f},
-std::array<float,2>{0.217769966f, 0.469662219f},
-std::array<float,2>{0.618405819f, 0.909300923f},
-std::array<float,2>{0.463105351f, 0.517127872f},
-std::array<float,2>{0.880148768f, 0.0262668766f},
-std::array<float,2>{0.283037215f, 0.196398601f},
-std::array<float,2>{0.825411499f, 0.661088407f},
-std::array<float,2>{0.0929592848f, 0.841135681f},
-std::array<float,2>{0.704889357f, 0.269586384f},
-std::array<float,2>{0.0313138515f, 0.0930616632f},
-std::array<float,2>{0.637932777f, 0.564493597f},
-std::array<float,2>{0.319591403f, 0.944204271f},
-std::array<float,2>{0.779207826f, 0.42814979f},
-std::array<float,2>{0.420208663f, 0.34887135f},
-std::array<float,2>{0.955077112f, 0.800519109f},
-std::array<float,2>{0.174680516f, 0.695473731f},
-std::array<float,2>{0.552735269f, 0.172869042f},
-std::array<float,2>{0.101714954f, 0.30872798f},
-std::array<float,2>{0.730877221f, 0.847794294f},
-std::array<float,2>{0.257683247f, 0.64158237f},
-std::array<float,2>{0.860721052f, 0.232476488f},
-std::array<float,2>{0.470587671f, 0.0615159385f},
-std::array<float,2>{0.92950058f, 0.549877107f},
-std::array<float,2>{0.23980324f, 0.878980279f},
-std::array<float,2>{0.592282057f, 0.453413248f},
-std::array<float,2>{0.140485108f, 0.149811029f},
-std::array<float,2>{0.510874629f, 0.743768334f},
-std::array<float,2>{0.397851348f, 0.778262436f},
-std::array<float,2>{0.982354343f, 0.314427465f},
-std::array<float,2>{0.345249712f, 0.388406217f},
-std::array<float,2>{0.784706712f, 0.975565076f},
-std::array<float,2>{0.0061541358f, 0.618939638f},
-std::array<float,2>{0.672244728f, 0.116239265f},
-std::array<float,2>{0.0165278167f, 0.414671302f},
-std::array<float,2>{0.661930203f, 0.953130364f},
-std::array<float,2>{0.370432496f, 0.583396912f},
-std::array<float,2>{0.803808033f, 0.0714152679f},
-std::array<float,2>{0.388724834f, 0.16502966f},
-std::array<float,2>{0.989614248f, 0.714520752f},
-std::array<float,2>{0.152253881f, 0.791666329f},
-std::array<float,2>{0.5159325f, 0.363895565f},
-std::array<float,2>{0.221276447f, 0.0103306239f},
-std::array<float,2>{0.57795614f, 0.509833872f},
-std::array<float,2>{0.488019347f, 0.936611831f},
-std::array<float,2>{0.913741171f, 0.490762323f},
-std::array<float,2>{0.268821597f, 0.2548922f},
-std::array<float,2>{0.851396859f, 0.816263139f},
-std::array<float,2>{0.115985952f, 0.682653904f},
-std::array<float,2>{0.735808015f, 0.215874314f},
-std::array<float,2>{0.16968286f, 0.341087461f},
-std::array<float,2>{0.54185766f, 0.755548179f},
-std::array<float,2>{0.434396625f, 0.725538969f},
-std::array<float,2>{0.937841952f, 0.136401191f},
-std::array<float,2>{0.337154865f, 0.104704469f},
-std::array<float,2>{0.751057267f, 0.607300162f},
-std::array<float,2>{0.0565688238f, 0.987772703f},
-std::array<float,2>{0.651320517f, 0.400089502f},
-std::array<float,2>{0.0724814907f, 0.243629515f},
-std::array<float,2>{0.69491744f, 0.630141854f},
-std::array<float,2>{0.303259641f, 0.869454503f},
-std::array<float,2>{0.828523397f, 0.291888416f},
-std::array<float,2>{0.441122264f, 0.449313849f},
-std::array<float,2>{0.892466962f, 0.901796877f},
-std::array<float,2>{0.187632501f, 0.53238821f},
-std::array<float,2>{0.596550584f, 0.0364141688f},
-std::array<float,2>{0.175836071f, 0.437671721f},
-std::array<float,2>{0.547283709f, 0.890754044f},
-std::array<float,2>{0.416448236f, 0.545355618f},
-std::array<float,2>{0.957221985f, 0.0440013893f},
-std::array<float,2>{0.314569384f, 0.241531655f},
-std::array<float,2>{0.774856389f, 0.637725472f},
-std::array<float,2>{0.0387444124f, 0.859408617f},
-std::array<float,2>{0.634967029f, 0.282400578f},
-std::array<float,2>{0.0893312916f, 0.0947278142f},
-std::array<float,2>{0.710224509f, 0.594450891f},
-std::array<float,2>{0.285661638f, 0.999890864f},
-std::array<float,2>{0.82334578f, 0.396599025f},
-std::array<float,2>{0.465904027f, 0.333913475f},
-std::array<float,2>{0.875092745f, 0.758326948f},
-std::array<float,2>{0.213413328f, 0.728842378f},
-std::array<float,2>{0.621290982f, 0.126315087f},
-std::array<float,2>{0.00205576443f, 0.264313847f},
-std::array<float,2>{0.676706374f, 0.82447052f},
-std::array<float,2>{0.349058419f, 0.679343522f},
-std::array<float,2>{0.787991405f, 0.203296497f},
-std::array<float,2>{0.390749335f, 0.00778472936f},
-std::array<float,2>{0.979328454f, 0.506153226f},
-std::array<float,2>{0.133002326f, 0.922977924f},
-std::array<float,2>{0.512862682f, 0.499267876f},
-std::array<float,2>{0.237712771f, 0.156729862f},
-std::array<float,2>{0.586716115f, 0.707812905f},
-std::array<float,2>{0.472682029f, 0.788776159f},
-std::array<float,2>{0.922391057f, 0.372422278f},
-std::array<float,2>{0.252699137f, 0.408891171f},
-std::array<float,2>{0.865430355f, 0.961089015f},
-std::array<float,2>{0.105744332f, 0.586215854f},
-std::array<float,2>{0.727888644f, 0.0700418055f},
-std::array<float,2>{0.111100793f, 0.375915587f},
-std::array<float,2>{0.73962909f, 0.981514037f},
-std::array<float,2>{0.270159513f, 0.617028236f},
-std::array<float,2>{0.846053421f, 0.117651187f},
-std::array<float,2>{0.489662677f, 0.14686951f},
-std::array<float,2>{0.908094287f, 0.736444473f},
-std::array<float,2>{0.225569278f, 0.766277611f},
-std::array<float,2>{0.572779715f, 0.322212845f},
-std::array<float,2>{0.153941661f, 0.0528587066f},
-std::array<float,2>{0.520759463f, 0.557419777f},
-std::array<float,2>{0.384036779f, 0.884743452f},
-std::array<float,2>{0.986480832f, 0.463499039f},
-std::array<float,2>{0.373596251f, 0.301950455f},
-std::array<float,2>{0.800131738f, 0.855317891f},
-std::array<float,2>{0.020758843f, 0.654857516f},
-std::array<float,2>{0.659789741f, 0.22495383f},
-std::array<float,2>{0.193234265f, 0.357055068f},
-std::array<float,2>{0.601061165f, 0.812393606f},
-std::array<float,2>{0.444506943f, 0.694184363f},
-std::array<float,2>{0.895531356f, 0.181361541f},
-std::array<float,2>{0.300047487f, 0.0783443078f},
-std::array<float,2>{0.832614422f, 0.571729362f},
-std::array<float,2>{0.0780719146f, 0.948670864f},
-std::array<float,2>{0.688140631f, 0.430144668f},
-std::array<float,2>{0.0605595149f, 0.191419378f},
-std::array<float,2>{0.653433204f, 0.670697749f},
-std::array<float,2>{0.342088878f, 0.830927312f},
-std::array<float,2>{0.755908132f, 0.275948077f},
-std::array<float,2>{0.433171272f, 0.479483366f},
-std::array<float,2>{0.943465173f, 0.916994333f},
-std::array<float,2>{0.167500675f, 0.529630601f},
-std::array<float,2>{0.543313444f, 0.0189877972f},
-std::array<float,2>{0.228766561f, 0.423247278f},
-std::array<float,2>{0.56477958f, 0.940491974f},
-std::array<float,2>{0.497791141f, 0.568256557f},
-std::array<float,2>{0.91821152f, 0.0860771462f},
-std::array<float,2>{0.278679907f, 0.178728268f},
-std::array<float,2>{0.852407336f, 0.699676812f},
-std::array<float,2>{0.120021008f, 0.804291844f},
-std::array<float,2>{0.745640635f, 0.343886882f},
-std::array<float,2>{0.0240771119f, 0.0301790629f},
-std::array<float,2>{0.670722902f, 0.519802988f},
-std::array<float,2>{0.361305803f, 0.913305521f},
-std::array<float,2>{0.805299222f, 0.475046545f},
-std::array<float,2>{0.382261813f, 0.26770702f},
-std::array<float,2>{0.994143069f, 0.839139342f},
-std::array<float,2>{0.146584839f, 0.659782529f},
-std::array<float,2>{0.525114119f, 0.202601418f},
-std::array<float,2>{0.0672248378f, 0.316596031f},
-std::array<float,2>{0.697002053f, 0.776299119f},
-std::array<float,2>{0.308470845f, 0.749814689f},
-std::array<float,2>{0.836289644f, 0.154800236f},
-std::array<float,2>{0.446774542f, 0.112757862f},
-std::array<float,2>{0.901603878f, 0.623738885f},
-std::array<float,2>{0.19711943f, 0.969960332f},
-std::array<float,2>{0.602245271f, 0.384585649f},
-std::array<float,2>{0.163310632f, 0.228828698f},
-std::array<float,2>{0.532615185f, 0.647931159f},
-std::array<float,2>{0.424030513f, 0.845271349f},
-std::array<float,2>{0.947268069f, 0.30626291f},
-std::array<float,2>{0.330794662f, 0.460398465f},
-std::array<float,2>{0.7623806f, 0.877475917f},
-std::array<float,2>{0.0475625806f, 0.554308891f},
-std::array<float,2>{0.647591531f, 0.0570229478f},
-std::array<float,2>{0.0426964238f, 0.485245019f},
-std::array<float,2>{0.627542853f, 0.930304587f},
-std::array<float,2>{0.325389564f, 0.514012575f},
-std::array<float,2>{0.765715718f, 0.0145989554f},
-std::array<float,2>{0.412735611f, 0.214351982f},
-std::array<float,2>{0.966180027f, 0.685925663f},
-std::array<float,2>{0.17985104f, 0.819380045f},
-std::array<float,2>{0.558707237f, 0.251911134f},
-std::array<float,2>{0.209520042f, 0.0751375332f},
-std::array<float,2>{0.611343563f, 0.580230474f},
-std::array<float,2>{0.45858562f, 0.959571719f},
-std::array<float,2>{0.884868979f, 0.41956386f},
-std::array<float,2>{0.293682724f, 0.362247169f},
-std::array<float,2>{0.815557778f, 0.795713246f},
-std::array<float,2>{0.0792647079f, 0.716751397f},
-std::array<float,2>{0.718031704f, 0.16937311f},
-std::array<float,2>{0.129637122f, 0.294524729f},
-std::array<float,2>{0.50491631f, 0.872403681f},
-std::array<float,2>{0.400876492f, 0.625520945f},
-std::array<float,2>{0.971783698f, 0.248859271f},
-std::array<float,2>{0.356598377f, 0.0349486396f},
-std::array<float,2>{0.789923072f, 0.535789251f},
-std::array<float,2>{0.0153752789f, 0.904183745f},
-std::array<float,2>{0.687198997f, 0.449027777f},
-std::array<float,2>{0.0949948505f, 0.138882801f},
-std::array<float,2>{0.719611764f, 0.720117033f},
-std::array<float,2>{0.257884115f, 0.750105619f},
-std::array<float,2>{0.869023025f, 0.339677066f},
-std::array<float,2>{0.480074883f, 0.405486882f},
-std::array<float,2>{0.934944808f, 0.989123285f},
-std::array<float,2>{0.246296003f, 0.603528321f},
-std::array<float,2>{0.585167885f, 0.105556756f},
-std::array<float,2>{0.156654149f, 0.41042155f},
-std::array<float,2>{0.537376285f, 0.966727734f},
-std::array<float,2>{0.428873301f, 0.59104228f},
-std::array<float,2>{0.949882448f, 0.0628218427f},
-std::array<float,2>{0.333702266f, 0.162624434f},
-std::array<float,2>{0.758092821f, 0.703572452f},
-std::array<float,2>{0.0512822382f, 0.783297062f},
-std::array<float,2>{0.64179486f, 0.370190471f},
-std::array<float,2>{0.0630867109f, 0.000215438602f},
-std::array<float,2>{0.700389445f, 0.503278613f},
-std::array<float,2>{0.309393525f, 0.929310679f},
-std::array<float,2>{0.840659142f, 0.495066315f},
-std::array<float,2>{0.452495962f, 0.259317935f},
-std::array<float,2>{0.904828608f, 0.823280752f},
-std::array<float,2>{0.201665193f, 0.674763501f},
-std::array<float,2>{0.60593915f, 0.210321829f},
-std::array<float,2>{0.0287786014f, 0.328631639f},
-std::array<float,2>{0.667439282f, 0.765464783f},
-std::array<float,2>{0.363311499f, 0.733800411f},
-std::array<float,2>{0.809270203f, 0.130455524f},
-std::array<float,2>{0.377539873f, 0.100275949f},
-std::array<float,2>{0.998455048f, 0.599841654f},
-std::array<float,2>{0.141382977f, 0.993072033f},
-std::array<float,2>{0.528769493f, 0.3935664f},
-std::array<float,2>{0.231026843f, 0.238035128f},
-std::array<float,2>{0.567071915f, 0.635093629f},
-std::array<float,2>{0.493314862f, 0.864998877f},
-std::array<float,2>{0.915323257f, 0.28648293f},
-std::array<float,2>{0.276352912f, 0.443589807f},
-std::array<float,2>{0.85553968f, 0.898409545f},
-std::array<float,2>{0.124039464f, 0.541738272f},
-std::array<float,2>{0.747251034f, 0.0409306958f},
-std::array<float,2>{0.098493576f, 0.480913579f},
-std::array<float,2>{0.72316277f, 0.920582771f},
-std::array<float,2>{0.264552981f, 0.526179314f},
-std::array<float,2>{0.874377012f, 0.0201422945f},
-std::array<float,2>{0.482952476f, 0.188665062f},
-std::array<float,2>{0.930104315f, 0.666280866f},
-std::array<float,2>{0.242463171f, 0.835907221f},
-std::array<float,2>{0.580954313f, 0.280842751f},
-std::array<float,2>{0.127965674f, 0.0829832479f},
-std::array<float,2>{0.503780901f, 0.575887978f},
-std::array<float,2>{0.405126393f, 0.951656878f},
-std::array<float,2>{0.976034164f, 0.437296212f},
-std::array<float,2>{0.355298012f, 0.354700565f},
-std::array<float,2>{0.795847952f, 0.804974496f},
-std::array<float,2>{0.00986860879f, 0.688985407f},
-std::array<float,2>{0.6804564f, 0.186262846f},
-std::array<float,2>{0.203251988f, 0.298760533f},
-std::array<float,2>{0.614224195f, 0.858228207f},
-std::array<float,2>{0.456913114f, 0.651062369f},
-std::array<float,2>{0.890624225f, 0.219418913f},
-std::array<float,2>{0.290979445f, 0.0486482978f},
-std::array<float,2>{0.816625595f, 0.559706211f},
-std::array<float,2>{0.0821191743f, 0.887376547f},
-std::array<float,2>{0.714549184f, 0.467285097f},
-std::array<float,2>{0.0434880033f, 0.141805515f},
-std::array<float,2>{0.632305622f, 0.740658581f},
-std::array<float,2>{0.321324944f, 0.772843897f},
-std::array<float,2>{0.770003021f, 0.327482134f},
-std::array<float,2>{0.406631559f, 0.381774932f},
-std::array<float,2>{0.964266658f, 0.976653516f},
-std::array<float,2>{0.185183316f, 0.609485984f},
-std::array<float,2>{0.556983054f, 0.122366682f},
-std::array<float,2>{0.240539774f, 0.455146223f},
-std::array<float,2>{0.591701448f, 0.88116318f},
-std::array<float,2>{0.472345501f, 0.548056006f},
-std::array<float,2>{0.926526606f, 0.0596135445f},
-std::array<float,2>{0.254490227f, 0.232283965f},
-std::array<float,2>{0.861846149f, 0.644285858f},
-std::array<float,2>{0.105049573f, 0.851073742f},
-std::array<float,2>{0.733580589f, 0.311870545f},
-std::array<float,2>{0.00432760734f, 0.114906214f},
-std::array<float,2>{0.674969614f, 0.621047318f},
-std::array<float,2>{0.346526414f, 0.973001897f},
-std::array<float,2>{0.782330573f, 0.38998121f},
-std::array<float,2>{0.3958866f, 0.314812154f},
-std::array<float,2>{0.984178305f, 0.779907286f},
-std::array<float,2>{0.138087988f, 0.74426055f},
-std::array<float,2>{0.509103537f, 0.150970444f},
-std::array<float,2>{0.0905593485f, 0.27266866f},
-std::array<float,2>{0.706895709f, 0.841828227f},
-std::array<float,2>{0.285097897f, 0.662805498f},
-std::array<float,2>{0.826361895f, 0.197888523f},
-std::array<float,2>{0.462767541f, 0.0246400665f},
-std::array<float,2>{0.880942166f, 0.519393265f},
-std::array<float,2>{0.215012431f, 0.908013403f},
-std::array<float,2>{0.620638788f, 0.471952349f},
-std::array<float,2>{0.173094988f, 0.174198732f},
-std::array<float,2>{0.551252186f, 0.698401988f},
-std::array<float,2>{0.419768542f, 0.797013223f},
-std::array<float,2>{0.955620587f, 0.349734604f},
-std::array<float,2>{0.318130463f, 0.427353054f},
-std::array<float,2>{0.779696047f, 0.941968799f},
-std::array<float,2>{0.0346551202f, 0.564209819f},
-std::array<float,2>{0.639711857f, 0.0910308808f},
-std::array<float,2>{0.0568163358f, 0.400901377f},
-std::array<float,2>{0.64908278f, 0.984695077f},
-std::array<float,2>{0.338608593f, 0.609190285f},
-std::array<float,2>{0.753605127f, 0.101859771f},
-std::array<float,2>{0.437219441f, 0.134210259f},
-std::array<float,2>{0.939871132f, 0.722914457f},
-std::array<float,2>{0.171537548f, 0.756686032f},
-std::array<float,2>{0.539460599f, 0.342359573f},
-std::array<float,2>{0.190210029f, 0.038838096f},
-std::array<float,2>{0.594704866f, 0.534833074f},
-std::array<float,2>{0.439090967f, 0.899426758f},
-std::array<float,2>{0.892611563f, 0.451949596f},
-std::array<float,2>{0.301123261f, 0.290630132f},
-std::array<float,2>{0.831693649f, 0.869017124f},
-std::array<float,2>{0.0714823753f, 0.63254261f},
-std::array<float,2>{0.691431582f, 0.245610282f},
-std::array<float,2>{0.148948953f, 0.366046876f},
-std::array<float,2>{0.517660558f, 0.789394081f},
-std::array<float,2>{0.387789428f, 0.712024808f},
-std::array<float,2>{0.991770327f, 0.166293517f},
-std::array<float,2>{0.367305815f, 0.0727914125f},
-std::array<float,2>{0.8023628f, 0.585786462f},
-std::array<float,2>{0.0181799028f, 0.956541419f},
-std::array<float,2>{0.663455248f, 0.417138755f},
-std::array<float,2>{0.114232451f, 0.216977566f},
-std::array<float,2>{0.738033593f, 0.681055307f},
-std::array<float,2>{0.267140985f, 0.814257026f},
-std::array<float,2>{0.848954618f, 0.25596562f},
-std::array<float,2>{0.484458357f, 0.490091145f},
-std::array<float,2>{0.911641121f, 0.933621764f},
-std::array<float,2>{0.220644474f, 0.50897789f},
-std::array<float,2>{0.576112866f, 0.00961219613f},
-std::array<float,2>{0.136042342f, 0.497838587f},
-std::array<float,2>{0.514739633f, 0.925432146f},
-std::array<float,2>{0.392826498f, 0.505555451f},
-std::array<float,2>{0.976591587f, 0.00540302834f},
-std::array<float,2>{0.351003498f, 0.205185071f},
-std::array<float,2>{0.785267055f, 0.67772764f},
-std::array<float,2>{0.0010301728f, 0.82620877f},
-std::array<float,2>{0.678405643f, 0.262855351f},
-std::array<float,2>{0.108986951f, 0.0667517483f},
-std::array<float,2>{0.729828179f, 0.589277387f},
-std::array<float,2>{0.251175106f, 0.963070571f},
-std::array<float,2>{0.864814043f, 0.406664163f},
-std::array<float,2>{0.475245088f, 0.373369068f},
-std::array<float,2>{0.925344229f, 0.785418808f},
-std::array<float,2>{0.234753013f, 0.710853219f},
-std::array<float,2>{0.589028299f, 0.158650339f},
-std::array<float,2>{0.036647547f, 0.283617973f},
-std::array<float,2>{0.633213878f, 0.863143921f},
-std::array<float,2>{0.313082844f, 0.638894618f},
-std::array<float,2>{0.776342273f, 0.240079239f},
-std::array<float,2>{0.414649516f, 0.0462960936f},
-std::array<float,2>{0.959335327f, 0.543820918f},
-std::array<float,2>{0.178384557f, 0.893054128f},
-std::array<float,2>{0.54917419f, 0.440417469f},
-std::array<float,2>{0.211642429f, 0.127058417f},
-std::array<float,2>{0.62466979f, 0.727382421f},
-std::array<float,2>{0.46790868f, 0.760128081f},
-std::array<float,2>{0.878172517f, 0.334588438f},
-std::array<float,2>{0.287731349f, 0.396342844f},
-std::array<float,2>{0.820355237f, 0.996456444f},
-std::array<float,2>{0.0871099606f, 0.597093225f},
-std::array<float,2>{0.708972752f, 0.0972810164f},
-std::array<float,2>{0.0753034204f, 0.433014095f},
-std::array<float,2>{0.689505517f, 0.945992231f},
-std::array<float,2>{0.298328966f, 0.573545158f},
-std::array<float,2>{0.83556813f, 0.081667155f},
-std::array<float,2>{0.443174899f, 0.182910711f},
-std::array<float,2>{0.89764601f, 0.69143486f},
-std::array<float,2>{0.193921775f, 0.810114682f},
-std::array<float,2>{0.597682893f, 0.359093696f},
-std::array<float,2>{0.165623218f, 0.0164877102f},
-std::array<float,2>{0.545859993f, 0.527591765f},
-std::array<float,2>{0.430360943f, 0.914212108f},
-std::array<float,2>{0.942401052f, 0.476601064f},
-std::array<float,2>{0.340063781f, 0.273535818f},
-std::array<float,2>{0.75515151f, 0.829300463f},
-std::array<float,2>{0.0595681779f, 0.669189453f},
-std::array<float,2>{0.654327273f, 0.195197761f},
-std::array<float,2>{0.224282473f, 0.323864967f},
-std::array<float,2>{0.570471466f, 0.769277632f},
-std::array<float,2>{0.4921619f, 0.735509157f},
-std::array<float,2>{0.909876168f, 0.145726129f},
-std::array<float,2>{0.272975683f, 0.119321302f},
-std::array<float,2>{0.845351398f, 0.615039229f},
-std::array<float,2>{0.112046309f, 0.982936084f},
-std::array<float,2>{0.740521371f, 0.378278524f},
-std::array<float,2>{0.0231149588f, 0.224604949f},
-std::array<float,2>{0.657449901f, 0.653951883f},
-std::array<float,2>{0.371437401f, 0.852289319f},
-std::array<float,2>{0.797977984f, 0.302896112f},
-std::array<float,2>{0.386024445f, 0.461002469f},
-std::array<float,2>{0.986061037f, 0.885438383f},
-std::array<float,2>{0.155919448f, 0.556515336f},
-std::array<float,2>{0.522228777f, 0.0514424071f},
-std::array<float,2>{0.198320106f, 0.38657403f},
-std::array<float,2>{0.604698122f, 0.971267998f},
-std::array<float,2>{0.448951811f, 0.622280121f},
-std::array<float,2>{0.899655044f, 0.11103145f},
-std::array<float,2>{0.305287123f, 0.15284434f},
-std::array<float,2>{0.838583171f, 0.747625172f},
-std::array<float,2>{0.0691072643f, 0.774204791f},
-std::array<float,2>{0.697450578f, 0.319126964f},
-std::array<float,2>{0.0496692732f, 0.0558896326f},
-std::array<float,2>{0.646221161f, 0.552687347f},
-std::array<float,2>{0.329758495f, 0.875914454f},
-std::array<float,2>{0.763787091f, 0.458405763f},
-std::array<float,2>{0.422284931f, 0.308426887f},
-std::array<float,2>{0.945902944f, 0.846028626f},
-std::array<float,2>{0.161069557f, 0.64467591f},
-std::array<float,2>{0.533806562f, 0.22656998f},
-std::array<float,2>{0.117526531f, 0.347288698f},
-std::array<float,2>{0.743701398f, 0.801980793f},
-std::array<float,2>{0.279843062f, 0.701491535f},
-std::array<float,2>{0.853882253f, 0.17689167f},
-std::array<float,2>{0.498063892f, 0.0894385576f},
-std::array<float,2>{0.92071563f, 0.570203245f},
-std::array<float,2>{0.227304146f, 0.938867807f},
-std::array<float,2>{0.563603401f, 0.4253802f},
-std::array<float,2>{0.144682944f, 0.199893162f},
-std::array<float,2>{0.526723385f, 0.657749951f},
-std::array<float,2>{0.379407406f, 0.837527335f},
-std::array<float,2>{0.993449152f, 0.267273992f},
-std::array<float,2>{0.362150431f, 0.47270444f},
-std::array<float,2>{0.806788504f, 0.910956681f},
-std::array<float,2>{0.026954202f, 0.522110224f},
-std::array<float,2>{0.669870853f, 0.0289464593f},
-std::array<float,2>{0.0131317079f, 0.445717245f},
-std::array<float,2>{0.685531974f, 0.904593349f},
-std::array<float,2>{0.358780503f, 0.538831472f},
-std::array<float,2>{0.792755425f, 0.0330236964f},
-std::array<float,2>{0.399790764f, 0.247894257f},
-std::array<float,2>{0.969215333f, 0.628746867f},
-std::array<float,2>{0.132147044f, 0.873599887f},
-std::array<float,2>{0.506540895f, 0.296449393f},
-std::array<float,2>{0.249120444f, 0.108506389f},
-std::array<float,2>{0.583952844f, 0.602946639f},
-std::array<float,2>{0.478144974f, 0.99081713f},
-std::array<float,2>{0.936598122f, 0.402867466f},
-std::array<float,2>{0.261372536f, 0.337865978f},
-std::array<float,2>{0.870060503f, 0.75330317f},
-std::array<float,2>{0.0962864235f, 0.72236371f},
-std::array<float,2>{0.721036077f, 0.137882173f},
-std::array<float,2>{0.181940556f, 0.253008574f},
-std::array<float,2>{0.560665607f, 0.818169713f},
-std::array<float,2>{0.411993086f, 0.6851511f},
-std::array<float,2>{0.968289495f, 0.212315187f},
-std::array<float,2>{0.326205105f, 0.0118055921f},
-std::array<float,2>{0.769159794f, 0.513300598f},
-std::array<float,2>{0.039874386f, 0.932551324f},
-std::array<float,2>{0.625321805f, 0.486995667f},
-std::array<float,2>{0.0806813613f, 0.171700463f},
-std::array<float,2>{0.715151012f, 0.71718055f},
-std::array<float,2>{0.296224058f, 0.793682814f},
-std::array<float,2>{0.814208806f, 0.359489053f},
-std::array<float,2>{0.460638165f, 0.420495838f},
-std::array<float,2>{0.884552896f, 0.958440304f},
-std::array<float,2>{0.208187535f, 0.578531981f},
-std::array<float,2>{0.610255599f, 0.0774364024f},
-std::array<float,2>{0.179437295f, 0.396888167f},
-std::array<float,2>{0.550023437f, 0.999707818f},
-std::array<float,2>{0.415366143f, 0.594554126f},
-std::array<float,2>{0.96076107f, 0.0951659381f},
-std::array<float,2>{0.313903034f, 0.126200855f},
-std::array<float,2>{0.776910424f, 0.728685915f},
-std::array<float,2>{0.0360245854f, 0.758660495f},
-std::array<float,2>{0.633805633f, 0.333506674f},
-std::array<float,2>{0.085956797f, 0.0443292819f},
-std::array<float,2>{0.707597435f, 0.544982493f},
-std::array<float,2>{0.288862705f, 0.890943527f},
-std::array<float,2>{0.821349204f, 0.437859148f},
-std::array<float,2>{0.466907084f, 0.28270483f},
-std::array<float,2>{0.877579451f, 0.859833956f},
-std::array<float,2>{0.212848917f, 0.638065457f},
-std::array<float,2>{0.623447359f, 0.241280675f},
-std::array<float,2>{0.000539821573f, 0.372167021f},
-std::array<float,2>{0.678886235f, 0.788883924f},
-std::array<float,2>{0.350248456f, 0.707681537f},
-std::array<float,2>{0.786476851f, 0.156447887f},
-std::array<float,2>{0.393961161f, 0.0702347383f},
-std::array<float,2>{0.977825701f, 0.586161554f},
-std::array<float,2>{0.135027975f, 0.961331666f},
-std::array<float,2>{0.514523566f, 0.409084678f},
-std::array<float,2>{0.235847458f, 0.203497007f},
-std::array<float,2>{0.588840663f, 0.679500699f},
-std::array<float,2>{0.476499885f, 0.824243426f},
-std::array<float,2>{0.924797654f, 0.264467806f},
-std::array<float,2>{0.250870347f, 0.499102533f},
-std::array<float,2>{0.863566458f, 0.923265815f},
-std::array<float,2>{0.107707292f, 0.506095946f},
-std::array<float,2>{0.729065955f, 0.00756041799f},
-std::array<float,2>{0.112615131f, 0.463698596f},
-std::array<float,2>{0.741969764f, 0.884282768f},
-std::array<float,2>{0.272080541f, 0.557129204f},
-std::array<float,2>{0.844521284f, 0.0530150644f},
-std::array<float,2>{0.491044432f, 0.224728003f},
-std::array<float,2>{0.908361077f, 0.655103862f},
-std::array<float,2>{0.222836569f, 0.855178595f},
-std::array<float,2>{0.572198868f, 0.302185953f},
-std::array<float,2>{0.154444098f, 0.117404573f},
-std::array<float,2>{0.522735357f, 0.616729558f},
-std::array<float,2>{0.385388136f, 0.98175925f},
-std::array<float,2>{0.985021055f, 0.375567496f},
-std::array<float,2>{0.372255772f, 0.321914971f},
-std::array<float,2>{0.797358453f, 0.766562402f},
-std::array<float,2>{0.0224595908f, 0.736731768f},
-std::array<float,2>{0.656299233f, 0.146502793f},
-std::array<float,2>{0.19480592f, 0.276135981f},
-std::array<float,2>{0.599265277f, 0.830753982f},
-std::array<float,2>{0.442179978f, 0.670496166f},
-std::array<float,2>{0.896510184f, 0.191821307f},
-std::array<float,2>{0.297272801f, 0.0187168308f},
-std::array<float,2>{0.834380507f, 0.529490948f},
-std::array<float,2>{0.0748889893f, 0.91740334f},
-std::array<float,2>{0.690786302f, 0.479239017f},
-std::array<float,2>{0.0596531704f, 0.181525618f},
-std::array<float,2>{0.655312777f, 0.693928719f},
-std::array<float,2>{0.341500312f, 0.812245667f},
-std::array<float,2>{0.754721999f, 0.357209861f},
-std::array<float,2>{0.430988908f, 0.429819971f},
-std::array<float,2>{0.94177413f, 0.948262751f},
-std::array<float,2>{0.164470211f, 0.571326733f},
-std::array<float,2>{0.546661258f, 0.0785274878f},
-std::array<float,2>{0.227860242f, 0.474690974f},
-std::array<float,2>{0.562542439f, 0.913542032f},
-std::array<float,2>{0.499852329f, 0.519663751f},
-std::array<float,2>{0.921359956f, 0.0299522616f},
-std::array<float,2>{0.280506164f, 0.202357337f},
-std::array<float,2>{0.854605973f, 0.659991622f},
-std::array<float,2>{0.119000673f, 0.838976562f},
-std::array<float,2>{0.742757142f, 0.268028349f},
-std::array<float,2>{0.0261318795f, 0.0864254162f},
-std::array<float,2>{0.668627381f, 0.567984343f},
-std::array<float,2>{0.362861186f, 0.940796733f},
-std::array<float,2>{0.808161139f, 0.423023969f},
-std::array<float,2>{0.380224198f, 0.344028383f},
-std::array<float,2>{0.992897749f, 0.804479182f},
-std::array<float,2>{0.145782009f, 0.699441254f},
-std::array<float,2>{0.526044726f, 0.179092348f},
-std::array<float,2>{0.069758229f, 0.306515634f},
-std::array<float,2>{0.698910892f, 0.845496237f},
-std::array<float,2>{0.306612074f, 0.647614002f},
-std::array<float,2>{0.839140296f, 0.228726968f},
-std::array<float,2>{0.447302461f, 0.0568595715f},
-std::array<float,2>{0.898895562f, 0.554587483f},
-std::array<float,2>{0.198230535f, 0.877914548f},
-std::array<float,2>{0.603601515f, 0.460084796f},
-std::array<float,2>{0.161929503f, 0.15522486f},
-std::array<float,2>{0.534276605f, 0.749719143f},
-std::array<float,2>{0.423512667f, 0.776057959f},
-std::array<float,2>{0.946634769f, 0.316833824f},
-std::array<float,2>{0.328819573f, 0.384445518f},
-std::array<float,2>{0.765448093f, 0.969988227f},
-std::array<float,2>{0.0503460281f, 0.623824775f},
-std::array<float,2>{0.645503283f, 0.112430319f},
-std::array<float,2>{0.0401280969f, 0.419750005f},
-std::array<float,2>{0.626581907f, 0.9598158f},
-std::array<float,2>{0.32739076f, 0.580436766f},
-std::array<float,2>{0.76846689f, 0.0749364495f},
-std::array<float,2>{0.410970151f, 0.169059336f},
-std::array<float,2>{0.967664003f, 0.716309309f},
-std::array<float,2>{0.183504626f, 0.795565963f},
-std::array<float,2>{0.561816096f, 0.361822277f},
-std::array<float,2>{0.207297802f, 0.0142837008f},
-std::array<float,2>{0.610772491f, 0.51386714f},
-std::array<float,2>{0.45981586f, 0.930605233f},
-std::array<float,2>{0.883031428f, 0.485091388f},
-std::array<float,2>{0.295771658f, 0.251530707f},
-std::array<float,2>{0.812696338f, 0.819777727f},
-std::array<float,2>{0.0815378204f, 0.685626149f},
-std::array<float,2>{0.716458261f, 0.214014664f},
-std::array<float,2>{0.131181479f, 0.339440942f},
-std::array<float,2>{0.507726669f, 0.750436187f},
-std::array<float,2>{0.398814857f, 0.719949961f},
-std::array<float,2>{0.969937623f, 0.139037356f},
-std::array<float,2>{0.357806325f, 0.105938643f},
-std::array<float,2>{0.791227102f, 0.603777885f},
-std::array<float,2>{0.0123722255f, 0.988835871f},
-std::array<float,2>{0.684459805f, 0.405519545f},
-std::array<float,2>{0.0967501923f, 0.248551503f},
-std::array<float,2>{0.722285032f, 0.625898182f},
-std::array<float,2>{0.260244697f, 0.872080863f},
-std::array<float,2>{0.870277107f, 0.294773906f},
-std::array<float,2>{0.477089107f, 0.448780596f},
-std::array<float,2>{0.935847044f, 0.904009819f},
-std::array<float,2>{0.248556301f, 0.536042511f},
-std::array<float,2>{0.582630336f, 0.03472789f},
-std::array<float,2>{0.142140299f, 0.442484021f},
-std::array<float,2>{0.527821958f, 0.895901382f},
-std::array<float,2>{0.378588498f, 0.539801896f},
-std::array<float,2>{0.999592423f, 0.0419000499f},
-std::array<float,2>{0.364997953f, 0.236185595f},
-std::array<float,2>{0.809626043f, 0.632860124f},
-std::array<float,2>{0.0282957442f, 0.865550518f},
-std::array<float,2>{0.666461945f, 0.288679391f},
-std::array<float,2>{0.123637125f, 0.0995369181f},
-std::array<float,2>{0.746943235f, 0.597753465f},
-std::array<float,2>{0.276516676f, 0.994621992f},
-std::array<float,2>{0.856517136f, 0.392119139f},
-std::array<float,2>{0.492450505f, 0.331135809f},
-std::array<float,2>{0.914462328f, 0.762503922f},
-std::array<float,2>{0.231652796f, 0.730992615f},
-std::array<float,2>{0.568095386f, 0.131439418f},
-std::array<float,2>{0.0520609356f, 0.260788262f},
-std::array<float,2>{0.64124912f, 0.821648419f},
-std::array<float,2>{0.332578719f, 0.672850311f},
-std::array<float,2>{0.759284616f, 0.208418712f},
-std::array<float,2>{0.427987039f, 0.00311917113f},
-std::array<float,2>{0.950374901f, 0.501692533f},
-std::array<float,2>{0.157819569f, 0.927045286f},
-std::array<float,2>{0.538858414f, 0.492197603f},
-std::array<float,2>{0.202484936f, 0.161300048f},
-std::array<float,2>{0.607406259f, 0.706659675f},
-std::array<float,2>{0.451470971f, 0.781529844f},
-std::array<float,2>{0.906231046f, 0.367945194f},
-std::array<float,2>{0.310421973f, 0.413020313f},
-std::array<float,2>{0.841007292f, 0.966862202f},
-std::array<float,2>{0.0641219541f, 0.592918277f},
-std::array<float,2>{0.69998914f, 0.0654751733f},
-std::array<float,2>{0.0836135149f, 0.379248679f},
-std::array<float,2>{0.713368773f, 0.979590654f},
-std::array<float,2>{0.289987475f, 0.612844586f},
-std::array<float,2>{0.818165958f, 0.123735413f},
-std::array<float,2>{0.455653757f, 0.142754942f},
-std::array<float,2>{0.889530957f, 0.7393291f},
-std::array<float,2>{0.204870418f, 0.769709826f},
-std::array<float,2>{0.615139425f, 0.324220747f},
-std::array<float,2>{0.184043497f, 0.0502799638f},
-std::array<float,2>{0.558263004f, 0.561188757f},
-std::array<float,2>{0.407854915f, 0.888817906f},
-std::array<float,2>{0.963649094f, 0.46577245f},
-std::array<float,2>{0.321109056f, 0.298924834f},
-std::array<float,2>{0.771125138f, 0.856492639f},
-std::array<float,2>{0.0439991318f, 0.650192976f},
-std::array<float,2>{0.631096125f, 0.221947655f},
-std::array<float,2>{0.244077861f, 0.352820247f},
-std::array<float,2>{0.581606865f, 0.807294369f},
-std::array<float,2>{0.484171718f, 0.691060841f},
-std::array<float,2>{0.930681765f, 0.183724597f},
-std::array<float,2>{0.265178412f, 0.0851447955f},
-std::array<float,2>{0.873413622f, 0.57789731f},
-std::array<float,2>{0.0988530666f, 0.950237572f},
-std::array<float,2>{0.724330246f, 0.434205621f},
-std::array<float,2>{0.0113075376f, 0.191068679f},
-std::array<float,2>{0.681591451f, 0.665192366f},
-std::array<float,2>{0.354037464f, 0.83384198f},
-std::array<float,2>{0.796634555f, 0.277579516f},
-std::array<float,2>{0.405469716f, 0.483220816f},
-std::array<float,2>{0.975105703f, 0.918761909f},
-std::array<float,2>{0.127126291f, 0.52534169f},
-std::array<float,2>{0.502482414f, 0.0222236365f},
-std::array<float,2>{0.216512695f, 0.427819759f},
-std::array<float,2>{0.619199455f, 0.943931341f},
-std::array<float,2>{0.461912274f, 0.564893305f},
-std::array<float,2>{0.882573187f, 0.0928367302f},
-std::array<float,2>{0.283575803f, 0.173150703f},
-std::array<float,2>{0.827912152f, 0.695771277f},
-std::array<float,2>{0.0908252373f, 0.80058521f},
-std::array<float,2>{0.705298007f, 0.349041969f},
-std::array<float,2>{0.034084633f, 0.0260893237f},
-std::array<float,2>{0.638989985f, 0.517514348f},
-std::array<float,2>{0.316991836f, 0.909620345f},
-std::array<float,2>{0.78107065f, 0.46947512f},
-std::array<float,2>{0.418944359f, 0.269922823f},
-std::array<float,2>{0.956640303f, 0.840929687f},
-std::array<float,2>{0.172019601f, 0.660817981f},
-std::array<float,2>{0.552208245f, 0.196546316f},
-std::array<float,2>{0.104176752f, 0.314012676f},
-std::array<float,2>{0.73254317f, 0.777942479f},
-std::array<float,2>{0.255287647f, 0.744088829f},
-std::array<float,2>{0.863067627f, 0.149457648f},
-std::array<float,2>{0.470826089f, 0.116686016f},
-std::array<float,2>{0.927723169f, 0.618846953f},
-std::array<float,2>{0.241981655f, 0.975195825f},
-std::array<float,2>{0.590347648f, 0.388443619f},
-std::array<float,2>{0.13722685f, 0.232818082f},
-std::array<float,2>{0.508707166f, 0.641114533f},
-std::array<float,2>{0.394721299f, 0.847986937f},
-std::array<float,2>{0.982873797f, 0.309067309f},
-std::array<float,2>{0.346953064f, 0.453148693f},
-std::array<float,2>{0.781268299f, 0.879253447f},
-std::array<float,2>{0.00585649116f, 0.550174296f},
-std::array<float,2>{0.674110293f, 0.0612248667f},
-std::array<float,2>{0.018902991f, 0.491180956f},
-std::array<float,2>{0.662501276f, 0.936800599f},
-std::array<float,2>{0.368528664f, 0.51010865f},
-std::array<float,2>{0.80160594f, 0.010610464f},
-std::array<float,2>{0.386909276f, 0.216110945f},
-std::array<float,2>{0.990551829f, 0.682902038f},
-std::array<float,2>{0.149941653f, 0.816138208f},
-std::array<float,2>{0.518821716f, 0.255306184f},
-std::array<float,2>{0.219451264f, 0.0715716928f},
-std::array<float,2>{0.575042248f, 0.583181262f},
-std::array<float,2>{0.486213952f, 0.95358181f},
-std::array<float,2>{0.910737872f, 0.414900154f},
-std::array<float,2>{0.265926957f, 0.364186496f},
-std::array<float,2>{0.847979307f, 0.791770697f},
-std::array<float,2>{0.114445888f, 0.714789331f},
-std::array<float,2>{0.736663163f, 0.164732143f},
-std::array<float,2>{0.170741186f, 0.291664034f},
-std::array<float,2>{0.540471911f, 0.869200408f},
-std::array<float,2>{0.436105222f, 0.630080223f},
-std::array<float,2>{0.941333354f, 0.243207723f},
-std::array<float,2>{0.339202136f, 0.0363758318f},
-std::array<float,2>{0.752180278f, 0.532602668f},
-std::array<float,2>{0.0578692779f, 0.90157491f},
-std::array<float,2>{0.649851859f, 0.449551761f},
-std::array<float,2>{0.0711468756f, 0.136715382f},
-std::array<float,2>{0.693270624f, 0.725111723f},
-std::array<float,2>{0.30259794f, 0.755738735f},
-std::array<float,2>{0.830728829f, 0.340892404f},
-std::array<float,2>{0.438300163f, 0.400265813f},
-std::array<float,2>{0.894426227f, 0.987518728f},
-std::array<float,2>{0.191224501f, 0.606945276f},
-std::array<float,2>{0.595602751f, 0.10475637f},
-std::array<float,2>{0.133850724f, 0.406261444f},
-std::array<float,2>{0.512514472f, 0.963141263f},
-std::array<float,2>{0.39170292f, 0.588911414f},
-std::array<float,2>{0.979685009f, 0.0664820001f},
-std::array<float,2>{0.348049998f, 0.1584059f},
-std::array<float,2>{0.788933218f, 0.710650206f},
-std::array<float,2>{0.00310955429f, 0.785276055f},
-std::array<float,2>{0.677588105f, 0.37315312f},
-std::array<float,2>{0.106677093f, 0.00569480332f},
-std::array<float,2>{0.727339327f, 0.505652308f},
-std::array<float,2>{0.253745824f, 0.925749242f},
-std::array<float,2>{0.866584718f, 0.497671872f},
-std::array<float,2>{0.47390902f, 0.263066828f},
-std::array<float,2>{0.922878921f, 0.826447427f},
-std::array<float,2>{0.2372908f, 0.677432001f},
-std::array<float,2>{0.587041795f, 0.205518723f},
-std::array<float,2>{0.037449114f, 0.33482641f},
-std::array<float,2>{0.63629359f, 0.759845614f},
-std::array<float,2>{0.316194892f, 0.727290034f},
-std::array<float,2>{0.774249077f, 0.127381772f},
-std::array<float,2>{0.41743508f, 0.0975666195f},
-std::array<float,2>{0.958333135f, 0.596696317f},
-std::array<float,2>{0.176841512f, 0.996189058f},
-std::array<float,2>{0.548696458f, 0.396213323f},
-std::array<float,2>{0.213925168f, 0.239862069f},
-std::array<float,2>{0.622392297f, 0.639123321f},
-std::array<float,2>{0.46538493f, 0.862824619f},
-std::array<float,2>{0.876684308f, 0.283422291f},
-std::array<float,2>{0.286414921f, 0.440061092f},
-std::array<float,2>{0.822968304f, 0.892777979f},
-std::array<float,2>{0.0886799768f, 0.543501318f},
-std::array<float,2>{0.709805608f, 0.0458992943f},
-std::array<float,2>{0.07684201f, 0.476933628f},
-std::array<float,2>{0.689087749f, 0.91452384f},
-std::array<float,2>{0.299057454f, 0.527408719f},
-std::array<float,2>{0.833940208f, 0.0163136404f},
-std::array<float,2>{0.444290936f, 0.194939569f},
-std::array<float,2>{0.895465732f, 0.669124663f},
-std::array<float,2>{0.191761792f, 0.829401493f},
-std::array<float,2>{0.599609852f, 0.273830205f},
-std::array<float,2>{0.16624628f, 0.081882894f},
-std::array<float,2>{0.544555902f, 0.573481739f},
-std::array<float,2>{0.431862086f, 0.946054518f},
-std::array<float,2>{0.944723189f, 0.432732195f},
-std::array<float,2>{0.34313482f, 0.359215915f},
-std::array<float,2>{0.757683694f, 0.810480773f},
-std::array<float,2>{0.0620330945f, 0.691685081f},
-std::array<float,2>{0.652545929f, 0.182796717f},
-std::array<float,2>{0.225758061f, 0.303005427f},
-std::array<float,2>{0.574156404f, 0.852490246f},
-std::array<float,2>{0.488873124f, 0.654066205f},
-std::array<float,2>{0.907000184f, 0.224245161f},
-std::array<float,2>{0.270952374f, 0.051674068f},
-std::array<float,2>{0.847004652f, 0.556183636f},
-std::array<float,2>{0.110024504f, 0.885638058f},
-std::array<float,2>{0.738290071f, 0.461326241f},
-std::array<float,2>{0.0195434745f, 0.145897895f},
-std::array<float,2>{0.658983767f, 0.735800683f},
-std::array<float,2>{0.374959946f, 0.769473612f},
-std::array<float,2>{0.799651921f, 0.324201435f},
-std::array<float,2>{0.383558393f, 0.378140748f},
-std::array<float,2>{0.988098025f, 0.983164549f},
-std::array<float,2>{0.153269097f, 0.614881516f},
-std::array<float,2>{0.520168662f, 0.119437978f},
-std::array<float,2>{0.19572936f, 0.458108366f},
-std::array<float,2>{0.602823079f, 0.875723183f},
-std::array<float,2>{0.445683002f, 0.552328765f},
-std::array<float,2>{0.900551915f, 0.0559175871f},
-std::array<float,2>{0.307199925f, 0.226856098f},
-std::array<float,2>{0.837530732f, 0.64495492f},
-std::array<float,2>{0.067706421f, 0.845759571f},
-std::array<float,2>{0.695444643f, 0.308333099f},
-std::array<float,2>{0.0487881154f, 0.111173876f},
-std::array<float,2>{0.647113323f, 0.622517884f},
-std::array<float,2>{0.331807852f, 0.971522331f},
-std::array<float,2>{0.763386667f, 0.386433542f},
-std::array<float,2>{0.4254466f, 0.318984121f},
-std::array<float,2>{0.948633611f, 0.774157941f},
-std::array<float,2>{0.162879869f, 0.748009264f},
-std::array<float,2>{0.531989157f, 0.153217718f},
-std::array<float,2>{0.120316893f, 0.267523646f},
-std::array<float,2>{0.744381905f, 0.837806702f},
-std::array<float,2>{0.278169692f, 0.658196926f},
-std::array<float,2>{0.853189528f, 0.200188994f},
-std::array<float,2>{0.496202856f, 0.0292526782f},
-std::array<float,2>{0.919417202f, 0.52238369f},
-std::array<float,2>{0.229637757f, 0.910865545f},
-std::array<float,2>{0.565842867f, 0.473101556f},
-std::array<float,2>{0.148292199f, 0.177181169f},
-std::array<float,2>{0.524388194f, 0.701377511f},
-std::array<float,2>{0.381628901f, 0.802226782f},
-std::array<float,2>{0.996058762f, 0.34758091f},
-std::array<float,2>{0.359848469f, 0.425581455f},
-std::array<float,2>{0.806269586f, 0.93852514f},
-std::array<float,2>{0.0245695729f, 0.570002019f},
-std::array<float,2>{0.671340466f, 0.0897647217f},
-std::array<float,2>{0.0138964206f, 0.403300792f},
-std::array<float,2>{0.685900986f, 0.991024554f},
-std::array<float,2>{0.355837196f, 0.602551281f},
-std::array<float,2>{0.790559351f, 0.108754419f},
-std::array<float,2>{0.401409924f, 0.137966916f},
-std::array<float,2>{0.971350193f, 0.722485125f},
-std::array<float,2>{0.129940316f, 0.753083348f},
-std::array<float,2>{0.503918886f, 0.337636441f},
-std::array<float,2>{0.247409478f, 0.0327522978f},
-std::array<float,2>{0.58446908f, 0.538699329f},
-std::array<float,2>{0.478704482f, 0.904323757f},
-std::array<float,2>{0.934514642f, 0.4453668f},
-std::array<float,2>{0.259727865f, 0.296769023f},
-std::array<float,2>{0.867926836f, 0.873874247f},
-std::array<float,2>{0.0946378261f, 0.628586769f},
-std::array<float,2>{0.720614612f, 0.247681111f},
-std::array<float,2>{0.181633085f, 0.359691888f},
-std::array<float,2>{0.560074091f, 0.79377389f},
-std::array<float,2>{0.413157552f, 0.716931999f},
-std::array<float,2>{0.965115488f, 0.171498969f},
-std::array<float,2>{0.324735194f, 0.07730712f},
-std::array<float,2>{0.767440319f, 0.578144073f},
-std::array<float,2>{0.041127909f, 0.958159387f},
-std::array<float,2>{0.628628969f, 0.420776725f},
-std::array<float,2>{0.0784552321f, 0.211999431f},
-std::array<float,2>{0.717589736f, 0.685418308f},
-std::array<float,2>{0.294770747f, 0.818042278f},
-std::array<float,2>{0.815344274f, 0.253405362f},
-std::array<float,2>{0.457472742f, 0.487202466f},
-std::array<float,2>{0.886034548f, 0.932334781f},
-std::array<float,2>{0.210818499f, 0.513597548f},
-std::array<float,2>{0.612932861f, 0.0121079171f},
-std::array<float,2>{0.158670112f, 0.494685829f},
-std::array<float,2>{0.537037432f, 0.929505765f},
-std::array<float,2>{0.42665261f, 0.503068626f},
-std::array<float,2>{0.953073323f, 0.000391088921f},
-std::array<float,2>{0.334278375f, 0.210194662f},
-std::array<float,2>{0.759968698f, 0.674432337f},
-std::array<float,2>{0.0530656539f, 0.823500156f},
-std::array<float,2>{0.644389451f, 0.259561986f},
-std::array<float,2>{0.0655931681f, 0.0625786334f},
-std::array<float,2>{0.702578366f, 0.591234684f},
-std::array<float,2>{0.31099245f, 0.966415584f},
-std::array<float,2>{0.842429638f, 0.410344779f},
-std::array<float,2>{0.450019658f, 0.370509058f},
-std::array<float,2>{0.90247196f, 0.783669055f},
-std::array<float,2>{0.200150162f, 0.703206956f},
-std::array<float,2>{0.60767889f, 0.163038805f},
-std::array<float,2>{0.0311991647f, 0.286293864f},
-std::array<float,2>{0.664982915f, 0.864967167f},
-std::array<float,2>{0.36526069f, 0.634902418f},
-std::array<float,2>{0.811950386f, 0.238277227f},
-std::array<float,2>{0.375308603f, 0.0405812673f},
-std::array<float,2>{0.996144116f, 0.541876137f},
-std::array<float,2>{0.142913178f, 0.898133814f},
-std::array<float,2>{0.529778659f, 0.443615377f},
-std::array<float,2>{0.233222708f, 0.13067016f},
-std::array<float,2>{0.568932891f, 0.733515263f},
-std::array<float,2>{0.495858818f, 0.765364349f},
-std::array<float,2>{0.917316318f, 0.328891426f},
-std::array<float,2>{0.273798704f, 0.393878043f},
-std::array<float,2>{0.858872652f, 0.992692173f},
-std::array<float,2>{0.121650644f, 0.59990555f},
-std::array<float,2>{0.749685705f, 0.100574508f},
-std::array<float,2>{0.100483976f, 0.437136233f},
-std::array<float,2>{0.725323915f, 0.951209724f},
-std::array<float,2>{0.262938172f, 0.576114416f},
-std::array<float,2>{0.871204853f, 0.0827286914f},
-std::array<float,2>{0.481594235f, 0.186361f},
-std::array<float,2>{0.932769299f, 0.689291179f},
-std::array<float,2>{0.24487184f, 0.804728746f},
-std::array<float,2>{0.579761088f, 0.354832321f},
-std::array<float,2>{0.125251353f, 0.0203794353f},
-std::array<float,2>{0.500778973f, 0.526036263f},
-std::array<float,2>{0.404169798f, 0.920779884f},
-std::array<float,2>{0.973025441f, 0.480693638f},
-std::array<float,2>{0.351790577f, 0.28124249f},
-std::array<float,2>{0.793954134f, 0.835647285f},
-std::array<float,2>{0.0097231837f, 0.66625005f},
-std::array<float,2>{0.682244003f, 0.188905865f},
-std::array<float,2>{0.205312744f, 0.327328324f},
-std::array<float,2>{0.616593182f, 0.772614598f},
-std::array<float,2>{0.454104751f, 0.740309775f},
-std::array<float,2>{0.886968315f, 0.14197208f},
-std::array<float,2>{0.292167008f, 0.122132875f},
-std::array<float,2>{0.819030583f, 0.609804928f},
-std::array<float,2>{0.0852054879f, 0.977039397f},
-std::array<float,2>{0.712376773f, 0.381524086f},
-std::array<float,2>{0.045291137f, 0.219645664f},
-std::array<float,2>{0.63044703f, 0.651165605f},
-std::array<float,2>{0.322497547f, 0.858101308f},
-std::array<float,2>{0.771738231f, 0.298466295f},
-std::array<float,2>{0.408421457f, 0.466968298f},
-std::array<float,2>{0.962560952f, 0.887658834f},
-std::array<float,2>{0.187300056f, 0.559938729f},
-std::array<float,2>{0.556190312f, 0.0485389866f},
-std::array<float,2>{0.238415673f, 0.389662147f},
-std::array<float,2>{0.593589962f, 0.972876847f},
-std::array<float,2>{0.469342828f, 0.620708287f},
-std::array<float,2>{0.928491592f, 0.115025528f},
-std::array<float,2>{0.255998075f, 0.151256412f},
-std::array<float,2>{0.860030651f, 0.744458795f},
-std::array<float,2>{0.103479445f, 0.780226052f},
-std::array<float,2>{0.732113779f, 0.314487219f},
-std::array<float,2>{0.00737019954f, 0.0598154068f},
-std::array<float,2>{0.673411787f, 0.548170328f},
-std::array<float,2>{0.344177514f, 0.880937874f},
-std::array<float,2>{0.783559024f, 0.455563098f},
-std::array<float,2>{0.396719187f, 0.311585635f},
-std::array<float,2>{0.980913281f, 0.850720823f},
-std::array<float,2>{0.138766304f, 0.644510448f},
-std::array<float,2>{0.510422766f, 0.231959686f},
-std::array<float,2>{0.0926359147f, 0.349894315f},
-std::array<float,2>{0.703548431f, 0.797342598f},
-std::array<float,2>{0.281712234f, 0.698640227f},
-std::array<float,2>{0.824407041f, 0.173898458f},
-std::array<float,2>{0.464159012f, 0.0911377072f},
-std::array<float,2>{0.879270375f, 0.564038754f},
-std::array<float,2>{0.218676612f, 0.942251563f},
-std::array<float,2>{0.617703855f, 0.427681029f},
-std::array<float,2>{0.17531915f, 0.198091477f},
-std::array<float,2>{0.554403961f, 0.66297847f},
-std::array<float,2>{0.421524107f, 0.842171192f},
-std::array<float,2>{0.953879535f, 0.272803515f},
-std::array<float,2>{0.31932053f, 0.471831292f},
-std::array<float,2>{0.777353644f, 0.907728314f},
-std::array<float,2>{0.0326945186f, 0.519065976f},
-std::array<float,2>{0.637137473f, 0.0248276275f},
-std::array<float,2>{0.0555864461f, 0.451760322f},
-std::array<float,2>{0.651951253f, 0.899795771f},
-std::array<float,2>{0.336299986f, 0.534996688f},
-std::array<float,2>{0.750912428f, 0.0386330336f},
-std::array<float,2>{0.43490383f, 0.245851979f},
-std::array<float,2>{0.939004004f, 0.632668436f},
-std::array<float,2>{0.168313682f, 0.868791282f},
-std::array<float,2>{0.54255259f, 0.290924788f},
-std::array<float,2>{0.18925631f, 0.101589032f},
-std::array<float,2>{0.596798182f, 0.6090433f},
-std::array<float,2>{0.439691246f, 0.984585762f},
-std::array<float,2>{0.891566157f, 0.401217788f},
-std::array<float,2>{0.304570526f, 0.342554867f},
-std::array<float,2>{0.830022335f, 0.756432354f},
-std::array<float,2>{0.0737844184f, 0.722713411f},
-std::array<float,2>{0.693596661f, 0.133958533f},
-std::array<float,2>{0.150856569f, 0.256135553f},
-std::array<float,2>{0.516744554f, 0.81414789f},
-std::array<float,2>{0.390454859f, 0.680902898f},
-std::array<float,2>{0.98888886f, 0.217273921f},
-std::array<float,2>{0.36973846f, 0.00934273843f},
-std::array<float,2>{0.802933216f, 0.509171486f},
-std::array<float,2>{0.0167345684f, 0.933858156f},
-std::array<float,2>{0.660658002f, 0.489915341f},
-std::array<float,2>{0.117086783f, 0.166050881f},
-std::array<float,2>{0.735240579f, 0.712324858f},
-std::array<float,2>{0.268040359f, 0.789251804f},
-std::array<float,2>{0.84976536f, 0.365899295f},
-std::array<float,2>{0.486968338f, 0.417394608f},
-std::array<float,2>{0.913046062f, 0.956074834f},
-std::array<float,2>{0.222325966f, 0.585621953f},
-std::array<float,2>{0.57644093f, 0.073050648f},
-std::array<float,2>{0.153540701f, 0.376884937f},
-std::array<float,2>{0.521254301f, 0.981106102f},
-std::array<float,2>{0.384310722f, 0.61555481f},
-std::array<float,2>{0.986911893f, 0.118249476f},
-std::array<float,2>{0.373262137f, 0.148132712f},
-std::array<float,2>{0.800492764f, 0.737542689f},
-std::array<float,2>{0.0214598849f, 0.767316461f},
-std::array<float,2>{0.659424543f, 0.32035622f},
-std::array<float,2>{0.110670112f, 0.0537720919f},
-std::array<float,2>{0.740051329f, 0.557714105f},
-std::array<float,2>{0.269861877f, 0.883043766f},
-std::array<float,2>{0.84645021f, 0.464301199f},
-std::array<float,2>{0.490052491f, 0.300866455f},
-std::array<float,2>{0.907442808f, 0.854454994f},
-std::array<float,2>{0.225083411f, 0.655955732f},
-std::array<float,2>{0.572391927f, 0.225735366f},
-std::array<float,2>{0.0614232905f, 0.356240541f},
-std::array<float,2>{0.653901994f, 0.811504424f},
-std::array<float,2>{0.342416316f, 0.695282519f},
-std::array<float,2>{0.756713808f, 0.18017894f},
-std::array<float,2>{0.432898432f, 0.0794015303f},
-std::array<float,2>{0.943897426f, 0.570378184f},
-std::array<float,2>{0.167335376f, 0.947363853f},
-std::array<float,2>{0.543719113f, 0.431448758f},
-std::array<float,2>{0.192479819f, 0.193019733f},
-std::array<float,2>{0.601205647f, 0.67169261f},
-std::array<float,2>{0.445220083f, 0.83171767f},
-std::array<float,2>{0.896284938f, 0.27680707f},
-std::array<float,2>{0.300566852f, 0.479724169f},
-std::array<float,2>{0.832400084f, 0.916572034f},
-std::array<float,2>{0.0772725567f, 0.530693948f},
-std::array<float,2>{0.687986434f, 0.018517863f},
-std::array<float,2>{0.0894629955f, 0.438920379f},
-std::array<float,2>{0.710846186f, 0.891669214f},
-std::array<float,2>{0.285227925f, 0.546411872f},
-std::array<float,2>{0.823783636f, 0.0432620347f},
-std::array<float,2>{0.466472536f, 0.240313247f},
-std::array<float,2>{0.875818372f, 0.637592912f},
-std::array<float,2>{0.213128254f, 0.861157119f},
-std::array<float,2>{0.621850848f, 0.281715006f},
-std::array<float,2>{0.176597759f, 0.0944190025f},
-std::array<float,2>{0.547624767f, 0.594807982f},
-std::array<float,2>{0.416664869f, 0.998722255f},
-std::array<float,2>{0.957721174f, 0.397686273f},
-std::array<float,2>{0.315325052f, 0.332508951f},
-std::array<float,2>{0.775090694f, 0.759107888f},
-std::array<float,2>{0.0385251902f, 0.730121195f},
-std::array<float,2>{0.635659456f, 0.125150457f},
-std::array<float,2>{0.238246486f, 0.26472339f},
-std::array<float,2>{0.586303532f, 0.825232089f},
-std::array<float,2>{0.473482192f, 0.677873313f},
-std::array<float,2>{0.922256649f, 0.204240307f},
-std::array<float,2>{0.252038777f, 0.0065210457f},
-std::array<float,2>{0.865933061f, 0.507190049f},
-std::array<float,2>{0.105983205f, 0.922760844f},
-std::array<float,2>{0.728380024f, 0.498372823f},
-std::array<float,2>{0.00286590075f, 0.157651275f},
-std::array<float,2>{0.675814748f, 0.708421767f},
-std::array<float,2>{0.349246204f, 0.78723073f},
-std::array<float,2>{0.787581861f, 0.37123552f},
-std::array<float,2>{0.391295731f, 0.409248859f},
-std::array<float,2>{0.978991568f, 0.962527454f},
-std::array<float,2>{0.133645058f, 0.587682188f},
-std::array<float,2>{0.51340282f, 0.0691750869f},
-std::array<float,2>{0.209337011f, 0.485899895f},
-std::array<float,2>{0.611881912f, 0.930982172f},
-std::array<float,2>{0.458169878f, 0.515125751f},
-std::array<float,2>{0.885695994f, 0.0152778942f},
-std::array<float,2>{0.293263137f, 0.213574305f},
-std::array<float,2>{0.816117764f, 0.687361658f},
-std::array<float,2>{0.0795994177f, 0.81855768f},
-std::array<float,2>{0.71855998f, 0.2503874f},
-std::array<float,2>{0.0424483903f, 0.075456962f},
-std::array<float,2>{0.627063334f, 0.58167392f},
-std::array<float,2>{0.325836986f, 0.960244656f},
-std::array<float,2>{0.766459525f, 0.418628156f},
-std::array<float,2>{0.412320971f, 0.362931162f},
-std::array<float,2>{0.966493607f, 0.796224833f},
-std::array<float,2>{0.18062982f, 0.715506971f},
-std::array<float,2>{0.559114397f, 0.168073222f},
-std::array<float,2>{0.0953251198f, 0.292998314f},
-std::array<float,2>{0.718899786f, 0.872053087f},
-std::array<float,2>{0.258779854f, 0.626652062f},
-std::array<float,2>{0.868440509f, 0.249616489f},
-std::array<float,2>{0.479831755f, 0.0339061879f},
-std::array<float,2>{0.935220361f, 0.537002444f},
-std::array<float,2>{0.246830985f, 0.902810991f},
-std::array<float,2>{0.585727215f, 0.448127389f},
-std::array<float,2>{0.129146799f, 0.139763683f},
-std::array<float,2>{0.505632341f, 0.71917367f},
-std::array<float,2>{0.40090403f, 0.751758337f},
-std::array<float,2>{0.972275794f, 0.338114828f},
-std::array<float,2>{0.357162982f, 0.404889047f},
-std::array<float,2>{0.789545834f, 0.99002707f},
-std::array<float,2>{0.0146537237f, 0.605254054f},
-std::array<float,2>{0.686995208f, 0.106854945f},
-std::array<float,2>{0.0238237195f, 0.422067106f},
-std::array<float,2>{0.670391679f, 0.940372229f},
-std::array<float,2>{0.360699087f, 0.567279577f},
-std::array<float,2>{0.804750025f, 0.0876925886f},
-std::array<float,2>{0.382575005f, 0.177974001f},
-std::array<float,2>{0.994720042f, 0.700347185f},
-std::array<float,2>{0.147367775f, 0.802946329f},
-std::array<float,2>{0.524685144f, 0.345632374f},
-std::array<float,2>{0.229164302f, 0.0306882951f},
-std::array<float,2>{0.565364182f, 0.521160483f},
-std::array<float,2>{0.497225642f, 0.912622869f},
-std::array<float,2>{0.918823242f, 0.475889653f},
-std::array<float,2>{0.279152542f, 0.269174725f},
-std::array<float,2>{0.851737857f, 0.838542521f},
-std::array<float,2>{0.11943274f, 0.658283174f},
-std::array<float,2>{0.745285809f, 0.201467037f},
-std::array<float,2>{0.163619965f, 0.318236321f},
-std::array<float,2>{0.532750964f, 0.777084231f},
-std::array<float,2>{0.424533546f, 0.748215258f},
-std::array<float,2>{0.94814086f, 0.155644819f},
-std::array<float,2>{0.330299228f, 0.111811712f},
-std::array<float,2>{0.761857033f, 0.624399126f},
-std::array<float,2>{0.0473573618f, 0.968957543f},
-std::array<float,2>{0.648361266f, 0.382918596f},
-std::array<float,2>{0.0664536655f, 0.230331808f},
-std::array<float,2>{0.696465313f, 0.647115827f},
-std::array<float,2>{0.307650328f, 0.844191253f},
-std::array<float,2>{0.836819351f, 0.305598617f},
-std::array<float,2>{0.446811914f, 0.459532082f},
-std::array<float,2>{0.901878119f, 0.878019333f},
-std::array<float,2>{0.196354628f, 0.553507864f},
-std::array<float,2>{0.601645887f, 0.0580033883f},
-std::array<float,2>{0.186229318f, 0.465902597f},
-std::array<float,2>{0.555581748f, 0.890503645f},
-std::array<float,2>{0.409928173f, 0.561968625f},
-std::array<float,2>{0.961289763f, 0.0494833551f},
-std::array<float,2>{0.323629767f, 0.221465111f},
-std::array<float,2>{0.773354709f, 0.649159849f},
-std::array<float,2>{0.0468276665f, 0.855575323f},
-std::array<float,2>{0.628954351f, 0.299894005f},
-std::array<float,2>{0.0844967067f, 0.124642082f},
-std::array<float,2>{0.711120963f, 0.612188518f},
-std::array<float,2>{0.291932553f, 0.978763103f},
-std::array<float,2>{0.819706619f, 0.380247623f},
-std::array<float,2>{0.453246474f, 0.325215787f},
-std::array<float,2>{0.88849771f, 0.770784378f},
-std::array<float,2>{0.206530586f, 0.738555968f},
-std::array<float,2>{0.616064787f, 0.144431904f},
-std::array<float,2>{0.00803594105f, 0.278372556f},
-std::array<float,2>{0.683538079f, 0.832636416f},
-std::array<float,2>{0.353084594f, 0.664710522f},
-std::array<float,2>{0.792984128f, 0.189999789f},
-std::array<float,2>{0.402434766f, 0.023433866f},
-std::array<float,2>{0.973641396f, 0.523696303f},
-std::array<float,2>{0.126696065f, 0.91936481f},
-std::array<float,2>{0.501803398f, 0.483466238f},
-std::array<float,2>{0.245155707f, 0.184809729f},
-std::array<float,2>{0.578487992f, 0.690362394f},
-std::array<float,2>{0.480779409f, 0.808270276f},
-std::array<float,2>{0.932554126f, 0.352512002f},
-std::array<float,2>{0.261968702f, 0.434610248f},
-std::array<float,2>{0.872696161f, 0.950071812f},
-std::array<float,2>{0.100915581f, 0.576745391f},
-std::array<float,2>{0.726292312f, 0.0840013921f},
-std::array<float,2>{0.122874334f, 0.391174197f},
-std::array<float,2>{0.748657107f, 0.995615304f},
-std::array<float,2>{0.275100142f, 0.599070013f},
-std::array<float,2>{0.857907355f, 0.0985295549f},
-std::array<float,2>{0.494452536f, 0.132464707f},
-std::array<float,2>{0.916776776f, 0.732055843f},
-std::array<float,2>{0.234118506f, 0.762697339f},
-std::array<float,2>{0.570286572f, 0.330594003f},
-std::array<float,2>{0.144425794f, 0.0423176326f},
-std::array<float,2>{0.530940711f, 0.540563345f},
-std::array<float,2>{0.37682879f, 0.894555926f},
-std::array<float,2>{0.997609258f, 0.441509426f},
-std::array<float,2>{0.367155701f, 0.28797999f},
-std::array<float,2>{0.811371446f, 0.866349757f},
-std::array<float,2>{0.0302635524f, 0.634085059f},
-std::array<float,2>{0.665142357f, 0.234682098f},
-std::array<float,2>{0.200589284f, 0.368175089f},
-std::array<float,2>{0.60885632f, 0.78312403f},
-std::array<float,2>{0.45080933f, 0.705795169f},
-std::array<float,2>{0.903828204f, 0.160544187f},
-std::array<float,2>{0.311632961f, 0.0651421994f},
-std::array<float,2>{0.843580365f, 0.592077434f},
-std::array<float,2>{0.0651568696f, 0.967834592f},
-std::array<float,2>{0.701909184f, 0.413848817f},
-std::array<float,2>{0.0543309376f, 0.207256809f},
-std::array<float,2>{0.643362582f, 0.673588634f},
-std::array<float,2>{0.335675001f, 0.820359349f},
-std::array<float,2>{0.761107683f, 0.260158867f},
-std::array<float,2>{0.426953197f, 0.49340111f},
-std::array<float,2>{0.951598644f, 0.925903738f},
-std::array<float,2>{0.159975454f, 0.500112414f},
-std::array<float,2>{0.535476565f, 0.00278146868f},
-std::array<float,2>{0.221139044f, 0.415973902f},
-std::array<float,2>{0.577198267f, 0.95432806f},
-std::array<float,2>{0.487634808f, 0.582699299f},
-std::array<float,2>{0.913267374f, 0.0705850944f},
-std::array<float,2>{0.269154578f, 0.165575385f},
-std::array<float,2>{0.850818992f, 0.713648558f},
-std::array<float,2>{0.115611508f, 0.792836845f},
-std::array<float,2>{0.736307263f, 0.365111709f},
-std::array<float,2>{0.0159204751f, 0.0116975326f},
-std::array<float,2>{0.661573589f, 0.511258125f},
-std::array<float,2>{0.370623797f, 0.935847878f},
-std::array<float,2>{0.804453254f, 0.492133588f},
-std::array<float,2>{0.389543593f, 0.254498154f},
-std::array<float,2>{0.989985764f, 0.815274596f},
-std::array<float,2>{0.151606247f, 0.681854725f},
-std::array<float,2>{0.516394377f, 0.215006769f},
-std::array<float,2>{0.0728898421f, 0.340721309f},
-std::array<float,2>{0.69451493f, 0.754206419f},
-std::array<float,2>{0.302916139f, 0.72638905f},
-std::array<float,2>{0.828803718f, 0.135063902f},
-std::array<float,2>{0.440536261f, 0.103558384f},
-std::array<float,2>{0.891864955f, 0.605811834f},
-std::array<float,2>{0.188289091f, 0.986506879f},
-std::array<float,2>{0.595954657f, 0.399025619f},
-std::array<float,2>{0.169211879f, 0.24242647f},
-std::array<float,2>{0.541366696f, 0.629243612f},
-std::array<float,2>{0.433986068f, 0.870329142f},
-std::array<float,2>{0.938131094f, 0.292582124f},
-std::array<float,2>{0.337452203f, 0.450573206f},
-std::array<float,2>{0.751549065f, 0.901136875f},
-std::array<float,2>{0.0557249673f, 0.53187567f},
-std::array<float,2>{0.650418937f, 0.0357162766f},
-std::array<float,2>{0.0319258943f, 0.470683575f},
-std::array<float,2>{0.638257861f, 0.908270955f},
-std::array<float,2>{0.320258766f, 0.516302347f},
-std::array<float,2>{0.778341055f, 0.0263859555f},
-std::array<float,2>{0.420677722f, 0.196077898f},
-std::array<float,2>{0.954320312f, 0.661175191f},
-std::array<float,2>{0.173831537f, 0.840593517f},
-std::array<float,2>{0.553620934f, 0.271373808f},
-std::array<float,2>{0.216964707f, 0.0922975987f},
-std::array<float,2>{0.618887544f, 0.566000819f},
-std::array<float,2>{0.463521004f, 0.944417834f},
-std::array<float,2>{0.88083297f, 0.428747088f},
-std::array<float,2>{0.28260693f, 0.348196179f},
-std::array<float,2>{0.825875998f, 0.799474597f},
-std::array<float,2>{0.0937433615f, 0.696450651f},
-std::array<float,2>{0.704121411f, 0.172486067f},
-std::array<float,2>{0.139999121f, 0.310340762f},
-std::array<float,2>{0.511421561f, 0.849580109f},
-std::array<float,2>{0.398001105f, 0.642484009f},
-std::array<float,2>{0.981548309f, 0.233447403f},
-std::array<float,2>{0.345001042f, 0.0624158792f},
-std::array<float,2>{0.784313679f, 0.549403667f},
-std::array<float,2>{0.00661981152f, 0.880803466f},
-std::array<float,2>{0.67236495f, 0.454932034f},
-std::array<float,2>{0.102426074f, 0.148732916f},
-std::array<float,2>{0.73143816f, 0.742200136f},
-std::array<float,2>{0.256836653f, 0.779205203f},
-std::array<float,2>{0.861263216f, 0.312840223f},
-std::array<float,2>{0.470138013f, 0.386834353f},
-std::array<float,2>{0.929158628f, 0.976217389f},
-std::array<float,2>{0.239640087f, 0.61786741f},
-std::array<float,2>{0.592336476f, 0.115639731f},
-std::array<float,2>{0.165298417f, 0.432001531f},
-std::array<float,2>{0.545051754f, 0.946478903f},
-std::array<float,2>{0.429968357f, 0.572621763f},
-std::array<float,2>{0.943293095f, 0.0806803331f},
-std::array<float,2>{0.340363801f, 0.181798324f},
-std::array<float,2>{0.755560637f, 0.692452967f},
-std::array<float,2>{0.0587421097f, 0.809089124f},
-std::array<float,2>{0.655053794f, 0.357601821f},
-std::array<float,2>{0.0758009255f, 0.0170969218f},
-std::array<float,2>{0.690374553f, 0.528812528f},
-std::array<float,2>{0.298352808f, 0.915364027f},
-std::array<float,2>{0.835076511f, 0.478478283f},
-std::array<float,2>{0.442721337f, 0.274478316f},
-std::array<float,2>{0.89841634f, 0.828612387f},
-std::array<float,2>{0.193734035f, 0.668419719f},
-std::array<float,2>{0.598582327f, 0.193700701f},
-std::array<float,2>{0.0228087697f, 0.323199362f},
-std::array<float,2>{0.657992005f, 0.767642915f},
-std::array<float,2>{0.37176612f, 0.73457092f},
-std::array<float,2>{0.79834938f, 0.14483422f},
-std::array<float,2>{0.386556298f, 0.120420836f},
-std::array<float,2>{0.98535794f, 0.613405049f},
-std::array<float,2>{0.15551956f, 0.983398557f},
-std::array<float,2>{0.521655917f, 0.377187967f},
-std::array<float,2>{0.223667473f, 0.222724304f},
-std::array<float,2>{0.57092452f, 0.652819872f},
-std::array<float,2>{0.491314203f, 0.852639556f},
-std::array<float,2>{0.909601927f, 0.303901076f},
-std::array<float,2>{0.272853076f, 0.462645233f},
-std::array<float,2>{0.845123768f, 0.886310518f},
-std::array<float,2>{0.111735225f, 0.554902554f},
-std::array<float,2>{0.740867615f, 0.0521793328f},
-std::array<float,2>{0.108702026f, 0.496892333f},
-std::array<float,2>{0.730258942f, 0.923922777f},
-std::array<float,2>{0.251713723f, 0.504509926f},
-std::array<float,2>{0.864602506f, 0.00443181442f},
-std::array<float,2>{0.474816799f, 0.206529781f},
-std::array<float,2>{0.924984753f, 0.676486492f},
-std::array<float,2>{0.235258073f, 0.827606916f},
-std::array<float,2>{0.589699566f, 0.262218893f},
-std::array<float,2>{0.13660723f, 0.0678045526f},
-std::array<float,2>{0.515138865f, 0.588835239f},
-std::array<float,2>{0.393539757f, 0.964165807f},
-std::array<float,2>{0.977207422f, 0.407355845f},
-std::array<float,2>{0.351507366f, 0.374446481f},
-std::array<float,2>{0.786128819f, 0.786259472f},
-std::array<float,2>{0.00148494774f, 0.709885955f},
-std::array<float,2>{0.67816782f, 0.15982905f},
-std::array<float,2>{0.211140692f, 0.284646213f},
-std::array<float,2>{0.624147356f, 0.861682594f},
-std::array<float,2>{0.468580276f, 0.640497863f},
-std::array<float,2>{0.878685296f, 0.238435909f},
-std::array<float,2>{0.287256837f, 0.0449786f},
-std::array<float,2>{0.821215212f, 0.544817626f},
-std::array<float,2>{0.0874434933f, 0.894372344f},
-std::array<float,2>{0.70827359f, 0.440958828f},
-std::array<float,2>{0.0363842212f, 0.128215328f},
-std::array<float,2>{0.633625805f, 0.727664828f},
-std::array<float,2>{0.312945127f, 0.761335671f},
-std::array<float,2>{0.775563955f, 0.335842431f},
-std::array<float,2>{0.414249867f, 0.394694209f},
-std::array<float,2>{0.959568202f, 0.997092962f},
-std::array<float,2>{0.17800419f, 0.596402705f},
-std::array<float,2>{0.549452901f, 0.0964399427f},
-std::array<float,2>{0.249680072f, 0.447054803f},
-std::array<float,2>{0.583343327f, 0.905947685f},
-std::array<float,2>{0.477977723f, 0.537725985f},
-std::array<float,2>{0.937119663f, 0.0314071439f},
-std::array<float,2>{0.261061996f, 0.246239021f},
-std::array<float,2>{0.869173408f, 0.627426624f},
-std::array<float,2>{0.0957255661f, 0.874590993f},
-std::array<float,2>{0.721390903f, 0.29558906f},
-std::array<float,2>{0.0134649491f, 0.108282231f},
-std::array<float,2>{0.684766293f, 0.602280378f},
-std::array<float,2>{0.35934177f, 0.992055893f},
-std::array<float,2>{0.792390287f, 0.404213071f},
-std::array<float,2>{0.400089234f, 0.336727887f},
-std::array<float,2>{0.969590902f, 0.752908885f},
-std::array<float,2>{0.132768631f, 0.720946789f},
-std::array<float,2>{0.506123006f, 0.137527943f},
-std::array<float,2>{0.0802987963f, 0.252562612f},
-std::array<float,2>{0.715399504f, 0.817250907f},
-std::array<float,2>{0.296485513f, 0.68370682f},
-std::array<float,2>{0.813589692f, 0.211659104f},
-std::array<float,2>{0.46025911f, 0.0129466327f},
-std::array<float,2>{0.884092391f, 0.511872768f},
-std::array<float,2>{0.208830312f, 0.933160245f},
-std::array<float,2>{0.609521687f, 0.487911075f},
-std::array<float,2>{0.182501107f, 0.170894504f},
-std::array<float,2>{0.561496735f, 0.717846394f},
-std::array<float,2>{0.411420941f, 0.794453621f},
-std::array<float,2>{0.967948079f, 0.360673338f},
-std::array<float,2>{0.326670796f, 0.421162605f},
-std::array<float,2>{0.768597901f, 0.957609773f},
-std::array<float,2>{0.0394616611f, 0.579562068f},
-std::array<float,2>{0.625870109f, 0.0762324855f},
-std::array<float,2>{0.0489003211f, 0.384931058f},
-std::array<float,2>{0.64558351f, 0.971875668f},
-std::array<float,2>{0.329416454f, 0.621737659f},
-std::array<float,2>{0.764354348f, 0.110166512f},
-std::array<float,2>{0.422614783f, 0.15428324f},
-std::array<float,2>{0.945512712f, 0.746510684f},
-std::array<float,2>{0.160212189f, 0.774955809f},
-std::array<float,2>{0.53362745f, 0.319892615f},
-std::array<float,2>{0.198847711f, 0.0550084971f},
-std::array<float,2>{0.60539639f, 0.551032126f},
-std::array<float,2>{0.448420256f, 0.876107037f},
-std::array<float,2>{0.900309145f, 0.457179099f},
-std::array<float,2>{0.305112034f, 0.307510406f},
-std::array<float,2>{0.838148832f, 0.847131252f},
-std::array<float,2>{0.0686426833f, 0.646276176f},
-std::array<float,2>{0.698019981f, 0.227917537f},
-std::array<float,2>{0.14547725f, 0.345706791f},
-std::array<float,2>{0.526860297f, 0.801736653f},
-std::array<float,2>{0.379308969f, 0.702436984f},
-std::array<float,2>{0.993812323f, 0.176190645f},
-std::array<float,2>{0.361645877f, 0.0883347541f},
-std::array<float,2>{0.807487965f, 0.568418145f},
-std::array<float,2>{0.0265417956f, 0.938208401f},
-std::array<float,2>{0.669119656f, 0.423931807f},
-std::array<float,2>{0.118134849f, 0.200750366f},
-std::array<float,2>{0.743194342f, 0.656660616f},
-std::array<float,2>{0.279355884f, 0.836735725f},
-std::array<float,2>{0.854205787f, 0.266261369f},
-std::array<float,2>{0.49879986f, 0.474034756f},
-std::array<float,2>{0.920228779f, 0.911511481f},
-std::array<float,2>{0.226886824f, 0.523002744f},
-std::array<float,2>{0.564000905f, 0.0276648849f},
-std::array<float,2>{0.128810763f, 0.481865615f},
-std::array<float,2>{0.503162742f, 0.921830177f},
-std::array<float,2>{0.404411972f, 0.52642709f},
-std::array<float,2>{0.976293027f, 0.0208492205f},
-std::array<float,2>{0.354790598f, 0.187736839f},
-std::array<float,2>{0.795257151f, 0.667313397f},
-std::array<float,2>{0.0106785111f, 0.834742486f},
-std::array<float,2>{0.679936767f, 0.279297382f},
-std::array<float,2>{0.0978753492f, 0.0836737305f},
-std::array<float,2>{0.722760975f, 0.574311435f},
-std::array<float,2>{0.263779998f, 0.952394366f},
-std::array<float,2>{0.87455976f, 0.436049521f},
-std::array<float,2>{0.482489228f, 0.353821933f},
-std::array<float,2>{0.930590689f, 0.806607068f},
-std::array<float,2>{0.243037298f, 0.687883615f},
-std::array<float,2>{0.580237627f, 0.186842665f},
-std::array<float,2>{0.043183364f, 0.297052085f},
-std::array<float,2>{0.632564068f, 0.858430982f},
-std::array<float,2>{0.321980029f, 0.651922405f},
-std::array<float,2>{0.770180881f, 0.219999164f},
-std::array<float,2>{0.407010496f, 0.0473558269f},
-std::array<float,2>{0.96462369f, 0.55876416f},
-std::array<float,2>{0.184971169f, 0.888001621f},
-std::array<float,2>{0.557180047f, 0.468677253f},
-std::array<float,2>{0.203933388f, 0.14151068f},
-std::array<float,2>{0.613438845f, 0.741866469f},
-std::array<float,2>{0.456142426f, 0.772020102f},
-std::array<float,2>{0.889680922f, 0.326690137f},
-std::array<float,2>{0.290193439f, 0.382257879f},
-std::array<float,2>{0.817240357f, 0.978126943f},
-std::array<float,2>{0.0827372521f, 0.611112118f},
-std::array<float,2>{0.714272916f, 0.121298864f},
-std::array<float,2>{0.0629119873f, 0.411288798f},
-std::array<float,2>{0.701002717f, 0.965485156f},
-std::array<float,2>{0.30882746f, 0.590505481f},
-std::array<float,2>{0.839919031f, 0.0642782375f},
-std::array<float,2>{0.45280692f, 0.163417116f},
-std::array<float,2>{0.904448926f, 0.704919696f},
-std::array<float,2>{0.201429009f, 0.785121202f},
-std::array<float,2>{0.606431544f, 0.369954228f},
-std::array<float,2>{0.156767607f, 0.00174378057f},
-std::array<float,2>{0.53764683f, 0.502752542f},
-std::array<float,2>{0.429214984f, 0.92784667f},
-std::array<float,2>{0.949383259f, 0.496003687f},
-std::array<float,2>{0.333358467f, 0.258035988f},
-std::array<float,2>{0.758749187f, 0.822769046f},
-std::array<float,2>{0.0509044006f, 0.675474405f},
-std::array<float,2>{0.642541051f, 0.209311306f},
-std::array<float,2>{0.230843604f, 0.329150021f},
-std::array<float,2>{0.566788554f, 0.764008105f},
-std::array<float,2>{0.493966967f, 0.733361721f},
-std::array<float,2>{0.915655255f, 0.12911728f},
-std::array<float,2>{0.275610089f, 0.101328947f},
-std::array<float,2>{0.856091738f, 0.601306975f},
-std::array<float,2>{0.124553628f, 0.994035602f},
-std::array<float,2>{0.747712612f, 0.392865926f},
-std::array<float,2>{0.0290248711f, 0.237194106f},
-std::array<float,2>{0.66771096f, 0.636288166f},
-std::array<float,2>{0.364182085f, 0.863511026f},
-std::array<float,2>{0.808896899f, 0.286104918f},
-std::array<float,2>{0.377352536f, 0.44487679f},
-std::array<float,2>{0.998765111f, 0.896601617f},
-std::array<float,2>{0.140630111f, 0.542937517f},
-std::array<float,2>{0.529075563f, 0.039849557f},
-std::array<float,2>{0.189699158f, 0.40151155f},
-std::array<float,2>{0.593812108f, 0.985950291f},
-std::array<float,2>{0.438765675f, 0.607974946f},
-std::array<float,2>{0.893300653f, 0.103048034f},
-std::array<float,2>{0.30173409f, 0.133702144f},
-std::array<float,2>{0.831153095f, 0.723680317f},
-std::array<float,2>{0.0717784092f, 0.756942272f},
-std::array<float,2>{0.692090511f, 0.343426794f},
-std::array<float,2>{0.057599429f, 0.0375513621f},
-std::array<float,2>{0.648561418f, 0.533643842f},
-std::array<float,2>{0.33835572f, 0.898599863f},
-std::array<float,2>{0.753228843f, 0.452553898f},
-std::array<float,2>{0.436823964f, 0.28996098f},
-std::array<float,2>{0.940177619f, 0.867968202f},
-std::array<float,2>{0.170938268f, 0.631824374f},
-std::array<float,2>{0.53983444f, 0.244967982f},
-std::array<float,2>{0.113343745f, 0.366741329f},
-std::array<float,2>{0.737456858f, 0.790441453f},
-std::array<float,2>{0.266762197f, 0.711816609f},
-std::array<float,2>{0.849349499f, 0.167265922f},
-std::array<float,2>{0.485244095f, 0.0735916346f},
-std::array<float,2>{0.911503971f, 0.584887803f},
-std::array<float,2>{0.219794437f, 0.955918789f},
-std::array<float,2>{0.575529873f, 0.416181594f},
-std::array<float,2>{0.14874436f, 0.218172461f},
-std::array<float,2>{0.518090248f, 0.680536091f},
-std::array<float,2>{0.388633758f, 0.813197911f},
-std::array<float,2>{0.991332352f, 0.257401913f},
-std::array<float,2>{0.367830247f, 0.488631666f},
-std::array<float,2>{0.801829159f, 0.935406327f},
-std::array<float,2>{0.0176251419f, 0.508521259f},
-std::array<float,2>{0.663592041f, 0.00812027883f},
-std::array<float,2>{0.0044350191f, 0.456124246f},
-std::array<float,2>{0.675616801f, 0.882764578f},
-std::array<float,2>{0.345941663f, 0.547152281f},
-std::array<float,2>{0.78287828f, 0.0589180067f},
-std::array<float,2>{0.396468967f, 0.230868295f},
-std::array<float,2>{0.983537972f, 0.64259243f},
-std::array<float,2>{0.138519183f, 0.849979699f},
-std::array<float,2>{0.509497464f, 0.311363697f},
-std::array<float,2>{0.240817994f, 0.114241734f},
-std::array<float,2>{0.591057122f, 0.619502962f},
-std::array<float,2>{0.472109407f, 0.974168003f},
-std::array<float,2>{0.926174343f, 0.389152795f},
-std::array<float,2>{0.253914058f, 0.316240579f},
-std::array<float,2>{0.861655474f, 0.780415416f},
-std::array<float,2>{0.104908511f, 0.745899379f},
-std::array<float,2>{0.734015286f, 0.151908904f},
-std::array<float,2>{0.173448607f, 0.272227883f},
-std::array<float,2>{0.551639974f, 0.843675017f},
-std::array<float,2>{0.419029415f, 0.663860142f},
-std::array<float,2>{0.955365598f, 0.199188307f},
-std::array<float,2>{0.317869812f, 0.0240234677f},
-std::array<float,2>{0.780044556f, 0.518139243f},
-std::array<float,2>{0.0348047018f, 0.906674743f},
-std::array<float,2>{0.640257359f, 0.470950305f},
-std::array<float,2>{0.0900775418f, 0.175042659f},
-std::array<float,2>{0.706259906f, 0.698079407f},
-std::array<float,2>{0.284202725f, 0.798745751f},
-std::array<float,2>{0.827101707f, 0.351122528f},
-std::array<float,2>{0.4622913f, 0.426631242f},
-std::array<float,2>{0.881570756f, 0.943084478f},
-std::array<float,2>{0.215799242f, 0.562503099f},
-std::array<float,2>{0.620540142f, 0.0898804814f},
-std::array<float,2>{0.160813913f, 0.383496761f},
-std::array<float,2>{0.533944368f, 0.969253838f},
-std::array<float,2>{0.422032088f, 0.624908507f},
-std::array<float,2>{0.946161687f, 0.112145744f},
-std::array<float,2>{0.329917073f, 0.155866787f},
-std::array<float,2>{0.763922274f, 0.748774111f},
-std::array<float,2>{0.0493545085f, 0.776626289f},
-std::array<float,2>{0.646284163f, 0.317541599f},
-std::array<float,2>{0.0688896254f, 0.0581779331f},
-std::array<float,2>{0.697575748f, 0.552927792f},
-std::array<float,2>{0.305580616f, 0.878738999f},
-std::array<float,2>{0.838865459f, 0.459055781f},
-std::array<float,2>{0.449196577f, 0.305171609f},
-std::array<float,2>{0.899672031f, 0.844419658f},
-std::array<float,2>{0.198589981f, 0.646597624f},
-std::array<float,2>{0.604885936f, 0.229637325f},
-std::array<float,2>{0.0272628441f, 0.344944865f},
-std::array<float,2>{0.66952455f, 0.803274035f},
-std::array<float,2>{0.362055272f, 0.700931907f},
-std::array<float,2>{0.806975186f, 0.178590357f},
-std::array<float,2>{0.379775971f, 0.0871722847f},
-std::array<float,2>{0.993367195f, 0.566616476f},
-std::array<float,2>{0.14487955f, 0.939660907f},
-std::array<float,2>{0.526453316f, 0.422768712f},
-std::array<float,2>{0.227120265f, 0.201890245f},
-std::array<float,2>{0.563913286f, 0.658751309f},
-std::array<float,2>{0.498494029f, 0.838027835f},
-std::array<float,2>{0.920562088f, 0.268845707f},
-std::array<float,2>{0.280119151f, 0.476088107f},
-std::array<float,2>{0.853538454f, 0.912410855f},
-std::array<float,2>{0.117312804f, 0.520975769f},
-std::array<float,2>{0.74394697f, 0.0310052559f},
-std::array<float,2>{0.0964977667f, 0.447531372f},
-std::array<float,2>{0.720815003f, 0.90283376f},
-std::array<float,2>{0.261560589f, 0.536492169f},
-std::array<float,2>{0.869677424f, 0.0336687155f},
-std::array<float,2>{0.478311896f, 0.249227598f},
-std::array<float,2>{0.936838448f, 0.62597692f},
-std::array<float,2>{0.249485716f, 0.871144652f},
-std::array<float,2>{0.583584905f, 0.293791413f},
-std::array<float,2>{0.131845042f, 0.107181303f},
-std::array<float,2>{0.506664574f, 0.604759753f},
-std::array<float,2>{0.399507284f, 0.989356577f},
-std::array<float,2>{0.968951166f, 0.4045268f},
-std::array<float,2>{0.358577847f, 0.338493258f},
-std::array<float,2>{0.792545378f, 0.750997841f},
-std::array<float,2>{0.0128552476f, 0.719524741f},
-std::array<float,2>{0.685131013f, 0.140418202f},
-std::array<float,2>{0.208318919f, 0.250881374f},
-std::array<float,2>{0.60994029f, 0.819048882f},
-std::array<float,2>{0.460720569f, 0.686911166f},
-std::array<float,2>{0.884423137f, 0.213364765f},
-std::array<float,2>{0.296015412f, 0.0148509908f},
-std::array<float,2>{0.814391911f, 0.515371799f},
-std::array<float,2>{0.0810242444f, 0.931285799f},
-std::array<float,2>{0.714990556f, 0.485699236f},
-std::array<float,2>{0.0397094116f, 0.168804824f},
-std::array<float,2>{0.625121415f, 0.714980245f},
-std::array<float,2>{0.326546371f, 0.796641648f},
-std::array<float,2>{0.769327164f, 0.362363249f},
-std::array<float,2>{0.41174227f, 0.418419003f},
-std::array<float,2>{0.968652964f, 0.960909545f},
-std::array<float,2>{0.181757122f, 0.581518352f},
-std::array<float,2>{0.560954988f, 0.0761142448f},
-std::array<float,2>{0.2344414f, 0.498793006f},
-std::array<float,2>{0.589268327f, 0.922182798f},
-std::array<float,2>{0.47546351f, 0.507741153f},
-std::array<float,2>{0.925574183f, 0.00626343954f},
-std::array<float,2>{0.251362234f, 0.204989985f},
-std::array<float,2>{0.865016282f, 0.67843473f},
-std::array<float,2>{0.109153777f, 0.825709045f},
-std::array<float,2>{0.729688108f, 0.265294611f},
-std::array<float,2>{0.00140511384f, 0.0685116425f},
-std::array<float,2>{0.678552926f, 0.587327361f},
-std::array<float,2>{0.35072881f, 0.962144375f},
-std::array<float,2>{0.785419106f, 0.409979731f},
-std::array<float,2>{0.392796785f, 0.37182644f},
-std::array<float,2>{0.976892114f, 0.788037419f},
-std::array<float,2>{0.135948017f, 0.708572149f},
-std::array<float,2>{0.51491648f, 0.157892719f},
-std::array<float,2>{0.0873402953f, 0.282048464f},
-std::array<float,2>{0.708522618f, 0.860390246f},
-std::array<float,2>{0.287867665f, 0.636796713f},
-std::array<float,2>{0.820717156f, 0.240748569f},
-std::array<float,2>{0.468125701f, 0.0436756909f},
-std::array<float,2>{0.878207445f, 0.546178639f},
-std::array<float,2>{0.211794764f, 0.892464638f},
-std::array<float,2>{0.624819279f, 0.439342171f},
-std::array<float,2>{0.178598106f, 0.12574403f},
-std::array<float,2>{0.549045265f, 0.729609489f},
-std::array<float,2>{0.414856434f, 0.759747922f},
-std::array<float,2>{0.958987474f, 0.332722366f},
-std::array<float,2>{0.313267857f, 0.398196697f},
-std::array<float,2>{0.776097298f, 0.998087823f},
-std::array<float,2>{0.0369376913f, 0.595644355f},
-std::array<float,2>{0.632988274f, 0.0939268097f},
-std::array<float,2>{0.0590868108f, 0.430821598f},
-std::array<float,2>{0.654718578f, 0.948093414f},
-std::array<float,2>{0.340281874f, 0.570835412f},
-std::array<float,2>{0.754919231f, 0.0800020695f},
-std::array<float,2>{0.430636704f, 0.179903731f},
-std::array<float,2>{0.942732692f, 0.694669306f},
-std::array<float,2>{0.165905356f, 0.810783148f},
-std::array<float,2>{0.545441806f, 0.35571146f},
-std::array<float,2>{0.194233164f, 0.0176028367f},
-std::array<float,2>{0.598126352f, 0.53118366f},
-std::array<float,2>{0.442974091f, 0.916345954f},
-std::array<float,2>{0.897813022f, 0.480434716f},
-std::array<float,2>{0.29806453f, 0.276938409f},
-std::array<float,2>{0.835875928f, 0.831478238f},
-std::array<float,2>{0.0756667107f, 0.671150446f},
-std::array<float,2>{0.689885259f, 0.192504764f},
-std::array<float,2>{0.156105384f, 0.321030319f},
-std::array<float,2>{0.521992564f, 0.766874313f},
-std::array<float,2>{0.385771841f, 0.73788929f},
-std::array<float,2>{0.986187279f, 0.147903085f},
-std::array<float,2>{0.371105075f, 0.118847869f},
-std::array<float,2>{0.798118591f, 0.615945101f},
-std::array<float,2>{0.0234001558f, 0.980624497f},
-std::array<float,2>{0.657549441f, 0.376237482f},
-std::array<float,2>{0.112142786f, 0.226114377f},
-std::array<float,2>{0.740437686f, 0.655647278f},
-std::array<float,2>{0.273259938f, 0.853845716f},
-std::array<float,2>{0.845657051f, 0.301376909f},
-std::array<float,2>{0.491749853f, 0.464448541f},
-std::array<float,2>{0.909984708f, 0.883689106f},
-std::array<float,2>{0.224585637f, 0.558543384f},
-std::array<float,2>{0.570750415f, 0.0544713326f},
-std::array<float,2>{0.13773708f, 0.45438087f},
-std::array<float,2>{0.508911312f, 0.880246758f},
-std::array<float,2>{0.395525992f, 0.549274325f},
-std::array<float,2>{0.9840222f, 0.0618840158f},
-std::array<float,2>{0.346287161f, 0.234368056f},
-std::array<float,2>{0.782518327f, 0.641998649f},
-std::array<float,2>{0.00405819248f, 0.84869808f},
-std::array<float,2>{0.67521131f, 0.309886724f},
-std::array<float,2>{0.10534098f, 0.115890816f},
-std::array<float,2>{0.733666778f, 0.617314219f},
-std::array<float,2>{0.254864961f, 0.975959301f},
-std::array<float,2>{0.862240851f, 0.387611777f},
-std::array<float,2>{0.472598702f, 0.313332558f},
-std::array<float,2>{0.92636925f, 0.778789282f},
-std::array<float,2>{0.240251243f, 0.743093133f},
-std::array<float,2>{0.591422141f, 0.14894034f},
-std::array<float,2>{0.0343661867f, 0.270748168f},
-std::array<float,2>{0.639918625f, 0.839943886f},
-std::array<float,2>{0.318018049f, 0.661984265f},
-std::array<float,2>{0.77948004f, 0.195759922f},
-std::array<float,2>{0.419434398f, 0.0269320216f},
-std::array<float,2>{0.955908954f, 0.515887618f},
-std::array<float,2>{0.173214421f, 0.909035623f},
-std::array<float,2>{0.550914228f, 0.469866097f},
-std::array<float,2>{0.215202019f, 0.171965748f},
-std::array<float,2>{0.62095952f, 0.696859121f},
-std::array<float,2>{0.462405235f, 0.79898411f},
-std::array<float,2>{0.881130278f, 0.348064959f},
-std::array<float,2>{0.284743994f, 0.429663688f},
-std::array<float,2>{0.826483727f, 0.94505477f},
-std::array<float,2>{0.0907400921f, 0.565850437f},
-std::array<float,2>{0.706636488f, 0.09183494f},
-std::array<float,2>{0.0716920421f, 0.398786515f},
-std::array<float,2>{0.691707551f, 0.986998618f},
-std::array<float,2>{0.300859034f, 0.606435359f},
-std::array<float,2>{0.832025051f, 0.104388691f},
-std::array<float,2>{0.439346969f, 0.135525793f},
-std::array<float,2>{0.892956316f, 0.726066947f},
-std::array<float,2>{0.190054595f, 0.754721045f},
-std::array<float,2>{0.59433341f, 0.340262502f},
-std::array<float,2>{0.171772301f, 0.0355271026f},
-std::array<float,2>{0.539234817f, 0.531381726f},
-std::array<float,2>{0.437344402f, 0.900619268f},
-std::array<float,2>{0.939464331f, 0.450906187f},
-std::array<float,2>{0.338684738f, 0.292229533f},
-std::array<float,2>{0.753835976f, 0.870655656f},
-std::array<float,2>{0.0569972284f, 0.629454434f},
-std::array<float,2>{0.649329782f, 0.242974177f},
-std::array<float,2>{0.220247284f, 0.364648759f},
-std::array<float,2>{0.575911999f, 0.792256117f},
-std::array<float,2>{0.484712034f, 0.71325624f},
-std::array<float,2>{0.911873519f, 0.165442571f},
-std::array<float,2>{0.267493248f, 0.0711424649f},
-std::array<float,2>{0.848699689f, 0.58209151f},
-std::array<float,2>{0.113954976f, 0.954761446f},
-std::array<float,2>{0.738188148f, 0.415481031f},
-std::array<float,2>{0.0184821784f, 0.215344653f},
-std::array<float,2>{0.663204551f, 0.682600379f},
-std::array<float,2>{0.367659003f, 0.814539194f},
-std::array<float,2>{0.802706242f, 0.253924131f},
-std::array<float,2>{0.387959421f, 0.49137339f},
-std::array<float,2>{0.99213177f, 0.936313033f},
-std::array<float,2>{0.149310648f, 0.510795057f},
-std::array<float,2>{0.517919838f, 0.0110983346f},
-std::array<float,2>{0.202063203f, 0.413496673f},
-std::array<float,2>{0.605508566f, 0.968699336f},
-std::array<float,2>{0.452362835f, 0.592599869f},
-std::array<float,2>{0.905270815f, 0.0646625385f},
-std::array<float,2>{0.309309751f, 0.160926551f},
-std::array<float,2>{0.840338528f, 0.705426395f},
-std::array<float,2>{0.063343063f, 0.782496274f},
-std::array<float,2>{0.700583935f, 0.368943304f},
-std::array<float,2>{0.0515975729f, 0.00233480171f},
-std::array<float,2>{0.642029166f, 0.500678599f},
-std::array<float,2>{0.333967835f, 0.926534414f},
-std::array<float,2>{0.75782454f, 0.493764013f},
-std::array<float,2>{0.429026335f, 0.260424197f},
-std::array<float,2>{0.949959338f, 0.821151197f},
-std::array<float,2>{0.156445742f, 0.673083603f},
-std::array<float,2>{0.537259042f, 0.207577795f},
-std::array<float,2>{0.124437816f, 0.330566287f},
-std::array<float,2>{0.747327924f, 0.763511419f},
-std::array<float,2>{0.27612257f, 0.731533587f},
-std::array<float,2>{0.855849028f, 0.131949514f},
-std::array<float,2>{0.493463695f, 0.0977548137f},
-std::array<float,2>{0.915182114f, 0.599164724f},
-std::array<float,2>{0.231351405f, 0.995328009f},
-std::array<float,2>{0.56729424f, 0.390749246f},
-std::array<float,2>{0.141211078f, 0.235081121f},
-std::array<float,2>{0.52854377f, 0.634308994f},
-std::array<float,2>{0.377809614f, 0.867097199f},
-std::array<float,2>{0.998155415f, 0.28752324f},
-std::array<float,2>{0.363608271f, 0.442180216f},
-std::array<float,2>{0.809359968f, 0.895161808f},
-std::array<float,2>{0.0284185372f, 0.540416479f},
-std::array<float,2>{0.667135775f, 0.0429207571f},
-std::array<float,2>{0.0102043934f, 0.484224111f},
-std::array<float,2>{0.680259585f, 0.919901371f},
-std::array<float,2>{0.355142295f, 0.524292886f},
-std::array<float,2>{0.795421958f, 0.0224936884f},
-std::array<float,2>{0.404845834f, 0.189497426f},
-std::array<float,2>{0.975615919f, 0.664122522f},
-std::array<float,2>{0.128267676f, 0.832479894f},
-std::array<float,2>{0.503427565f, 0.27899152f},
-std::array<float,2>{0.242310122f, 0.0844943076f},
-std::array<float,2>{0.58079052f, 0.576285958f},
-std::array<float,2>{0.483244121f, 0.949702442f},
-std::array<float,2>{0.92973125f, 0.435115904f},
-std::array<float,2>{0.264192492f, 0.351712942f},
-std::array<float,2>{0.874156356f, 0.807851076f},
-std::array<float,2>{0.098159343f, 0.689901292f},
-std::array<float,2>{0.7234326f, 0.185223445f},
-std::array<float,2>{0.185516834f, 0.300675839f},
-std::array<float,2>{0.556779325f, 0.856213391f},
-std::array<float,2>{0.406279773f, 0.648731649f},
-std::array<float,2>{0.964043617f, 0.220818326f},
-std::array<float,2>{0.321619511f, 0.0489111803f},
-std::array<float,2>{0.769658267f, 0.562214136f},
-std::array<float,2>{0.043804761f, 0.889862657f},
-std::array<float,2>{0.631992042f, 0.466626137f},
-std::array<float,2>{0.0822795108f, 0.143844515f},
-std::array<float,2>{0.714655578f, 0.738853812f},
-std::array<float,2>{0.290667653f, 0.771474957f},
-std::array<float,2>{0.816888809f, 0.325838715f},
-std::array<float,2>{0.456575423f, 0.38065508f},
-std::array<float,2>{0.890165865f, 0.979300261f},
-std::array<float,2>{0.203457475f, 0.611641467f},
-std::array<float,2>{0.613808513f, 0.124122642f},
-std::array<float,2>{0.14680779f, 0.424586594f},
-std::array<float,2>{0.525162518f, 0.937531531f},
-std::array<float,2>{0.381855279f, 0.569052041f},
-std::array<float,2>{0.994423687f, 0.0888026133f},
-std::array<float,2>{0.3610183f, 0.176636308f},
-std::array<float,2>{0.805502534f, 0.702932775f},
-std::array<float,2>{0.0242407396f, 0.800969005f},
-std::array<float,2>{0.670433164f, 0.346483171f},
-std::array<float,2>{0.119818553f, 0.028255526f},
-std::array<float,2>{0.745943189f, 0.522632778f},
-std::array<float,2>{0.278491616f, 0.91185528f},
-std::array<float,2>{0.85225004f, 0.474461496f},
-std::array<float,2>{0.497949302f, 0.265874952f},
-std::array<float,2>{0.918270886f, 0.836159885f},
-std::array<float,2>{0.22871168f, 0.656934023f},
-std::array<float,2>{0.564670742f, 0.200206876f},
-std::array<float,2>{0.0477147773f, 0.319724232f},
-std::array<float,2>{0.647730052f, 0.774744332f},
-std::array<float,2>{0.33094576f, 0.746810615f},
-std::array<float,2>{0.762462199f, 0.153441131f},
-std::array<float,2>{0.424089611f, 0.109731659f},
-std::array<float,2>{0.947555661f, 0.621298611f},
-std::array<float,2>{0.16355966f, 0.972524762f},
-std::array<float,2>{0.532448947f, 0.385617018f},
-std::array<float,2>{0.196982756f, 0.228216767f},
-std::array<float,2>{0.602333486f, 0.64562583f},
-std::array<float,2>{0.446432739f, 0.847526431f},
-std::array<float,2>{0.901659548f, 0.306762815f},
-std::array<float,2>{0.308324635f, 0.457549661f},
-std::array<float,2>{0.836099684f, 0.876704872f},
-std::array<float,2>{0.0669708475f, 0.55142808f},
-std::array<float,2>{0.697173059f, 0.0555730797f},
-std::array<float,2>{0.0795818642f, 0.487365425f},
-std::array<float,2>{0.717863023f, 0.932933211f},
-std::array<float,2>{0.293875247f, 0.512548089f},
-std::array<float,2>{0.815900445f, 0.0133629348f},
-std::array<float,2>{0.458756596f, 0.211197093f},
-std::array<float,2>{0.885096729f, 0.68453753f},
-std::array<float,2>{0.209807396f, 0.816555083f},
-std::array<float,2>{0.61163795f, 0.251964897f},
-std::array<float,2>{0.180130661f, 0.0767256692f},
-std::array<float,2>{0.559048593f, 0.579940379f},
-std::array<float,2>{0.413066089f, 0.957393587f},
-std::array<float,2>{0.965972722f, 0.421427846f},
-std::array<float,2>{0.325469285f, 0.360968351f},
-std::array<float,2>{0.766070426f, 0.794419706f},
-std::array<float,2>{0.0428508036f, 0.718748331f},
-std::array<float,2>{0.627690434f, 0.170309812f},
-std::array<float,2>{0.246383131f, 0.295006454f},
-std::array<float,2>{0.585425317f, 0.874251604f},
-std::array<float,2>{0.480268717f, 0.627878189f},
-std::array<float,2>{0.934644878f, 0.246805653f},
-std::array<float,2>{0.258299679f, 0.0321193412f},
-std::array<float,2>{0.868707299f, 0.537109494f},
-std::array<float,2>{0.0948021188f, 0.905456781f},
-std::array<float,2>{0.719353318f, 0.44673717f},
-std::array<float,2>{0.0154375602f, 0.137185976f},
-std::array<float,2>{0.687425673f, 0.721277535f},
-std::array<float,2>{0.356854945f, 0.752299786f},
-std::array<float,2>{0.789660871f, 0.335981429f},
-std::array<float,2>{0.400591195f, 0.403610528f},
-std::array<float,2>{0.972146749f, 0.991339028f},
-std::array<float,2>{0.129725069f, 0.602021396f},
-std::array<float,2>{0.505161703f, 0.107451633f},
-std::array<float,2>{0.21363847f, 0.440472156f},
-std::array<float,2>{0.62147665f, 0.893812001f},
-std::array<float,2>{0.466181159f, 0.544069946f},
-std::array<float,2>{0.875345051f, 0.0455844514f},
-std::array<float,2>{0.285913676f, 0.239228204f},
-std::array<float,2>{0.823631108f, 0.639659166f},
-std::array<float,2>{0.0889492184f, 0.862286448f},
-std::array<float,2>{0.710127771f, 0.284810662f},
-std::array<float,2>{0.0390361585f, 0.0961002558f},
-std::array<float,2>{0.635235429f, 0.595962703f},
-std::array<float,2>{0.314926684f, 0.997932553f},
-std::array<float,2>{0.774461389f, 0.395161033f},
-std::array<float,2>{0.416258544f, 0.335374385f},
-std::array<float,2>{0.957284749f, 0.760803223f},
-std::array<float,2>{0.176219106f, 0.728310227f},
-std::array<float,2>{0.547077239f, 0.12879011f},
-std::array<float,2>{0.105498143f, 0.261897862f},
-std::array<float,2>{0.727775037f, 0.828050792f},
-std::array<float,2>{0.252628207f, 0.676238894f},
-std::array<float,2>{0.865492225f, 0.206975624f},
-std::array<float,2>{0.472955167f, 0.00413634907f},
-std::array<float,2>{0.922617495f, 0.504124522f},
-std::array<float,2>{0.237420723f, 0.924327612f},
-std::array<float,2>{0.586594284f, 0.496112227f},
-std::array<float,2>{0.133150443f, 0.159425288f},
-std::array<float,2>{0.513074577f, 0.709409952f},
-std::array<float,2>{0.390970349f, 0.786791682f},
-std::array<float,2>{0.979206562f, 0.37469703f},
-std::array<float,2>{0.348768294f, 0.407899052f},
-std::array<float,2>{0.787635148f, 0.964798927f},
-std::array<float,2>{0.00220378675f, 0.588184059f},
-std::array<float,2>{0.676304817f, 0.0681915432f},
-std::array<float,2>{0.0207090192f, 0.377911448f},
-std::array<float,2>{0.660104811f, 0.984138966f},
-std::array<float,2>{0.373934269f, 0.613786161f},
-std::array<float,2>{0.799915373f, 0.121002443f},
-std::array<float,2>{0.383875638f, 0.145363837f},
-std::array<float,2>{0.986801624f, 0.735088229f},
-std::array<float,2>{0.154206619f, 0.76814574f},
-std::array<float,2>{0.520557165f, 0.322682559f},
-std::array<float,2>{0.225231618f, 0.0524302572f},
-std::array<float,2>{0.573195279f, 0.555256426f},
-std::array<float,2>{0.489341944f, 0.885993183f},
-std::array<float,2>{0.907893121f, 0.462151676f},
-std::array<float,2>{0.27044341f, 0.304652184f},
-std::array<float,2>{0.845785797f, 0.853500783f},
-std::array<float,2>{0.111004286f, 0.653002679f},
-std::array<float,2>{0.739331007f, 0.223211467f},
-std::array<float,2>{0.16788815f, 0.358100623f},
-std::array<float,2>{0.542972445f, 0.808853269f},
-std::array<float,2>{0.433454633f, 0.693289995f},
-std::array<float,2>{0.943715036f, 0.182266355f},
-std::array<float,2>{0.341944128f, 0.0803651139f},
-std::array<float,2>{0.756330967f, 0.573206186f},
-std::array<float,2>{0.0607948005f, 0.946807265f},
-std::array<float,2>{0.653774858f, 0.432315797f},
-std::array<float,2>{0.0778746828f, 0.194159344f},
-std::array<float,2>{0.688432395f, 0.668574452f},
-std::array<float,2>{0.300140351f, 0.828776121f},
-std::array<float,2>{0.832962215f, 0.275329292f},
-std::array<float,2>{0.444744736f, 0.477758408f},
-std::array<float,2>{0.895810544f, 0.91590631f},
-std::array<float,2>{0.193061963f, 0.528524816f},
-std::array<float,2>{0.600602865f, 0.0167521294f},
-std::array<float,2>{0.174410358f, 0.471199721f},
-std::array<float,2>{0.552987754f, 0.907019913f},
-std::array<float,2>{0.419945478f, 0.517700315f},
-std::array<float,2>{0.954648018f, 0.0235298295f},
-std::array<float,2>{0.319453955f, 0.198560447f},
-std::array<float,2>{0.778956532f, 0.663219154f},
-std::array<float,2>{0.031736251f, 0.843093574f},
-std::array<float,2>{0.637942493f, 0.271532178f},
-std::array<float,2>{0.0930703878f, 0.0906188414f},
-std::array<float,2>{0.704602003f, 0.563284338f},
-std::array<float,2>{0.282907456f, 0.94261688f},
-std::array<float,2>{0.825637996f, 0.425834239f},
-std::array<float,2>{0.46329537f, 0.350661278f},
-std::array<float,2>{0.880079806f, 0.798216343f},
-std::array<float,2>{0.217347115f, 0.697713554f},
-std::array<float,2>{0.618459284f, 0.175573647f},
-std::array<float,2>{0.00596188987f, 0.310777724f},
-std::array<float,2>{0.672090113f, 0.850334644f},
-std::array<float,2>{0.345659763f, 0.643460691f},
-std::array<float,2>{0.785011053f, 0.231425539f},
-std::array<float,2>{0.39751333f, 0.0594409145f},
-std::array<float,2>{0.982060552f, 0.547746897f},
-std::array<float,2>{0.140310585f, 0.882091761f},
-std::array<float,2>{0.511139691f, 0.456790626f},
-std::array<float,2>{0.240111217f, 0.151505709f},
-std::array<float,2>{0.591947138f, 0.745579302f},
-std::array<float,2>{0.470256269f, 0.780978322f},
-std::array<float,2>{0.929270744f, 0.315697879f},
-std::array<float,2>{0.257541895f, 0.389314085f},
-std::array<float,2>{0.860537827f, 0.973803997f},
-std::array<float,2>{0.102004491f, 0.619829357f},
-std::array<float,2>{0.730497301f, 0.113326006f},
-std::array<float,2>{0.115775034f, 0.416588247f},
-std::array<float,2>{0.735409081f, 0.955460429f},
-std::array<float,2>{0.268677652f, 0.584332466f},
-std::array<float,2>{0.851284802f, 0.0738440901f},
-std::array<float,2>{0.488204986f, 0.16783601f},
-std::array<float,2>{0.914034188f, 0.711113453f},
-std::array<float,2>{0.221482784f, 0.790674806f},
-std::array<float,2>{0.577725708f, 0.366456866f},
-std::array<float,2>{0.151987866f, 0.00856033433f},
-std::array<float,2>{0.515758216f, 0.508083224f},
-std::array<float,2>{0.389020622f, 0.935011685f},
-std::array<float,2>{0.989282489f, 0.488925368f},
-std::array<float,2>{0.370236844f, 0.257018954f},
-std::array<float,2>{0.804088235f, 0.812791884f},
-std::array<float,2>{0.0163428579f, 0.680070102f},
-std::array<float,2>{0.661756814f, 0.218333542f},
-std::array<float,2>{0.187806949f, 0.342968225f},
-std::array<float,2>{0.596420884f, 0.757375538f},
-std::array<float,2>{0.441314876f, 0.724527717f},
-std::array<float,2>{0.892333508f, 0.133274242f},
-std::array<float,2>{0.303607732f, 0.102618799f},
-std::array<float,2>{0.828301728f, 0.607539833f},
-std::array<float,2>{0.0727450848f, 0.985662401f},
-std::array<float,2>{0.695230186f, 0.401878357f},
-std::array<float,2>{0.0561957918f, 0.244536012f},
-std::array<float,2>{0.651100338f, 0.631334841f},
-std::array<float,2>{0.337245077f, 0.867637277f},
-std::array<float,2>{0.751233816f, 0.289304972f},
-std::array<float,2>{0.434186429f, 0.452754766f},
-std::array<float,2>{0.937589228f, 0.899132073f},
-std::array<float,2>{0.16949904f, 0.533759475f},
-std::array<float,2>{0.541736841f, 0.037851613f},
-std::array<float,2>{0.23361969f, 0.393294901f},
-std::array<float,2>{0.569340765f, 0.993393362f},
-std::array<float,2>{0.494812548f, 0.600612819f},
-std::array<float,2>{0.916280866f, 0.100969099f},
-std::array<float,2>{0.274488211f, 0.129408136f},
-std::array<float,2>{0.858109236f, 0.732679904f},
-std::array<float,2>{0.122205965f, 0.764199495f},
-std::array<float,2>{0.748133242f, 0.329935282f},
-std::array<float,2>{0.0296190735f, 0.0391890928f},
-std::array<float,2>{0.665685654f, 0.542040706f},
-std::array<float,2>{0.366255909f, 0.896992326f},
-std::array<float,2>{0.810806453f, 0.444344103f},
-std::array<float,2>{0.376013994f, 0.285387009f},
-std::array<float,2>{0.997448027f, 0.863926947f},
-std::array<float,2>{0.143585309f, 0.635808706f},
-std::array<float,2>{0.53039825f, 0.236439437f},
-std::array<float,2>{0.0645820573f, 0.369206429f},
-std::array<float,2>{0.7014184f, 0.784631252f},
-std::array<float,2>{0.31202516f, 0.704101562f},
-std::array<float,2>{0.842783034f, 0.163909405f},
-std::array<float,2>{0.450671613f, 0.0636528432f},
-std::array<float,2>{0.903429508f, 0.589987814f},
-std::array<float,2>{0.200687051f, 0.965196609f},
-std::array<float,2>{0.608970761f, 0.411855996f},
-std::array<float,2>{0.159250349f, 0.209554285f},
-std::array<float,2>{0.536071897f, 0.674934149f},
-std::array<float,2>{0.427277237f, 0.822288871f},
-std::array<float,2>{0.952077448f, 0.258722156f},
-std::array<float,2>{0.335098505f, 0.495558888f},
-std::array<float,2>{0.761398733f, 0.928668678f},
-std::array<float,2>{0.054109659f, 0.502050579f},
-std::array<float,2>{0.64292407f, 0.00144721975f},
-std::array<float,2>{0.0460216478f, 0.468007386f},
-std::array<float,2>{0.629567862f, 0.888310254f},
-std::array<float,2>{0.324014515f, 0.559305608f},
-std::array<float,2>{0.772936106f, 0.0477202535f},
-std::array<float,2>{0.409520775f, 0.220285505f},
-std::array<float,2>{0.961428285f, 0.651783466f},
-std::array<float,2>{0.185830772f, 0.858939528f},
-std::array<float,2>{0.555019975f, 0.297714531f},
-std::array<float,2>{0.206768706f, 0.121765338f},
-std::array<float,2>{0.615308523f, 0.610816658f},
-std::array<float,2>{0.453891039f, 0.977595747f},
-std::array<float,2>{0.887741685f, 0.382530272f},
-std::array<float,2>{0.291426867f, 0.326313078f},
-std::array<float,2>{0.820068479f, 0.771897197f},
-std::array<float,2>{0.0842857286f, 0.741281569f},
-std::array<float,2>{0.711516082f, 0.140824288f},
-std::array<float,2>{0.126069665f, 0.279815167f},
-std::array<float,2>{0.501026452f, 0.834102452f},
-std::array<float,2>{0.403110325f, 0.66777277f},
-std::array<float,2>{0.974242091f, 0.188075513f},
-std::array<float,2>{0.352586418f, 0.0212039743f},
-std::array<float,2>{0.793867648f, 0.527129114f},
-std::array<float,2>{0.00873230398f, 0.921000123f},
-std::array<float,2>{0.68264246f, 0.482226253f},
-std::array<float,2>{0.101291455f, 0.187091693f},
-std::array<float,2>{0.725594759f, 0.688026965f},
-std::array<float,2>{0.262570292f, 0.80581069f},
-std::array<float,2>{0.872331738f, 0.35427627f},
-std::array<float,2>{0.481238246f, 0.435788691f},
-std::array<float,2>{0.932113767f, 0.952733696f},
-std::array<float,2>{0.246065646f, 0.574918747f},
-std::array<float,2>{0.578860164f, 0.0833566561f},
-std::array<float,2>{0.130648464f, 0.406162888f},
-std::array<float,2>{0.504525781f, 0.988557935f},
-std::array<float,2>{0.40220812f, 0.604232073f},
-std::array<float,2>{0.97075963f, 0.10616754f},
-std::array<float,2>{0.356132239f, 0.139621153f},
-std::array<float,2>{0.790369511f, 0.720616043f},
-std::array<float,2>{0.0142258052f, 0.75058043f},
-std::array<float,2>{0.686371028f, 0.339312911f},
-std::array<float,2>{0.0940084159f, 0.0346671566f},
-std::array<float,2>{0.720145166f, 0.535323977f},
-std::array<float,2>{0.258941084f, 0.903416991f},
-std::array<float,2>{0.867623568f, 0.448426038f},
-std::array<float,2>{0.479462147f, 0.294192016f},
-std::array<float,2>{0.933864713f, 0.872953236f},
-std::array<float,2>{0.247899905f, 0.625266731f},
-std::array<float,2>{0.584783912f, 0.248276889f},
-std::array<float,2>{0.0419681929f, 0.361391336f},
-std::array<float,2>{0.628296793f, 0.795262337f},
-std::array<float,2>{0.324320495f, 0.715908766f},
-std::array<float,2>{0.766977012f, 0.169890389f},
-std::array<float,2>{0.413585752f, 0.0746791139f},
-std::array<float,2>{0.96566093f, 0.580594242f},
-std::array<float,2>{0.18092145f, 0.959306598f},
-std::array<float,2>{0.559789956f, 0.419138759f},
-std::array<float,2>{0.210365549f, 0.214638114f},
-std::array<float,2>{0.612760663f, 0.686209381f},
-std::array<float,2>{0.457787156f, 0.820002615f},
-std::array<float,2>{0.886619568f, 0.250993073f},
-std::array<float,2>{0.29436323f, 0.484723061f},
-std::array<float,2>{0.814835727f, 0.929940462f},
-std::array<float,2>{0.0789605975f, 0.514437914f},
-std::array<float,2>{0.717281044f, 0.0141346222f},
-std::array<float,2>{0.0681492761f, 0.460493743f},
-std::array<float,2>{0.696195304f, 0.87726903f},
-std::array<float,2>{0.306745946f, 0.553933561f},
-std::array<float,2>{0.837058961f, 0.0571943298f},
-std::array<float,2>{0.44585824f, 0.229405224f},
-std::array<float,2>{0.901208043f, 0.648147345f},
-std::array<float,2>{0.195857793f, 0.845012188f},
-std::array<float,2>{0.603503644f, 0.30591464f},
-std::array<float,2>{0.162126243f, 0.112872526f},
-std::array<float,2>{0.531361103f, 0.623188138f},
-std::array<float,2>{0.425244063f, 0.970635295f},
-std::array<float,2>{0.949153543f, 0.384216934f},
-std::array<float,2>{0.331213981f, 0.317204207f},
-std::array<float,2>{0.763129413f, 0.775476456f},
-std::array<float,2>{0.0480274148f, 0.749193549f},
-std::array<float,2>{0.646611392f, 0.154750973f},
-std::array<float,2>{0.229983032f, 0.26842472f},
-std::array<float,2>{0.56628561f, 0.839729548f},
-std::array<float,2>{0.496735334f, 0.659454525f},
-std::array<float,2>{0.919857085f, 0.203066409f},
-std::array<float,2>{0.277573138f, 0.029492816f},
-std::array<float,2>{0.85288173f, 0.520498514f},
-std::array<float,2>{0.12086343f, 0.913948476f},
-std::array<float,2>{0.744755447f, 0.475503296f},
-std::array<float,2>{0.0250191689f, 0.179556459f},
-std::array<float,2>{0.671545088f, 0.699929178f},
-std::array<float,2>{0.359993845f, 0.80409795f},
-std::array<float,2>{0.806013584f, 0.344555616f},
-std::array<float,2>{0.381011903f, 0.423544973f},
-std::array<float,2>{0.995366573f, 0.941004217f},
-std::array<float,2>{0.14784269f, 0.567549825f},
-std::array<float,2>{0.523879468f, 0.0867242068f},
-std::array<float,2>{0.19238247f, 0.478986055f},
-std::array<float,2>{0.60023874f, 0.917743683f},
-std::array<float,2>{0.44381395f, 0.529874623f},
-std::array<float,2>{0.894941568f, 0.0193260573f},
-std::array<float,2>{0.299518526f, 0.191945985f},
-std::array<float,2>{0.833242655f, 0.670192719f},
-std::array<float,2>{0.0762894675f, 0.830399394f},
-std::array<float,2>{0.688490212f, 0.275600582f},
-std::array<float,2>{0.0616656356f, 0.0786755383f},
-std::array<float,2>{0.652841032f, 0.571837187f},
-std::array<float,2>{0.343685925f, 0.948916137f},
-std::array<float,2>{0.757038057f, 0.43033424f},
-std::array<float,2>{0.432458758f, 0.356769472f},
-std::array<float,2>{0.944948673f, 0.81174922f},
-std::array<float,2>{0.166745231f, 0.693505108f},
-std::array<float,2>{0.544131637f, 0.180988103f},
-std::array<float,2>{0.109729245f, 0.302684575f},
-std::array<float,2>{0.738874137f, 0.854857624f},
-std::array<float,2>{0.271095693f, 0.654439867f},
-std::array<float,2>{0.847358465f, 0.225424275f},
-std::array<float,2>{0.488414049f, 0.0536650121f},
-std::array<float,2>{0.906643987f, 0.556655705f},
-std::array<float,2>{0.22608757f, 0.883950531f},
-std::array<float,2>{0.573389351f, 0.463165492f},
-std::array<float,2>{0.152626663f, 0.147385076f},
-std::array<float,2>{0.519583941f, 0.737108231f},
-std::array<float,2>{0.38329041f, 0.766105831f},
-std::array<float,2>{0.987672389f, 0.321649045f},
-std::array<float,2>{0.37439248f, 0.375303686f},
-std::array<float,2>{0.799312174f, 0.982387245f},
-std::array<float,2>{0.0203380138f, 0.616254985f},
-std::array<float,2>{0.658349514f, 0.1179647f},
-std::array<float,2>{0.00370066427f, 0.408361107f},
-std::array<float,2>{0.676987469f, 0.961683333f},
-std::array<float,2>{0.348584235f, 0.586891592f},
-std::array<float,2>{0.788178146f, 0.0697770417f},
-std::array<float,2>{0.392221332f, 0.156743839f},
-std::array<float,2>{0.980208695f, 0.707435369f},
-std::array<float,2>{0.134727612f, 0.788492501f},
-std::array<float,2>{0.512139499f, 0.372591257f},
-std::array<float,2>{0.236458153f, 0.00691521494f},
-std::array<float,2>{0.587677419f, 0.506407082f},
-std::array<float,2>{0.474458814f, 0.923536777f},
-std::array<float,2>{0.92378962f, 0.499853522f},
-std::array<float,2>{0.253079623f, 0.264136672f},
-std::array<float,2>{0.866859019f, 0.824820757f},
-std::array<float,2>{0.10741359f, 0.678982079f},
-std::array<float,2>{0.726589203f, 0.203876376f},
-std::array<float,2>{0.177396834f, 0.333222747f},
-std::array<float,2>{0.548290968f, 0.758263409f},
-std::array<float,2>{0.417707413f, 0.729226232f},
-std::array<float,2>{0.958843529f, 0.126833603f},
-std::array<float,2>{0.315865189f, 0.0952951089f},
-std::array<float,2>{0.773537397f, 0.594173968f},
-std::array<float,2>{0.0379264355f, 0.999210656f},
-std::array<float,2>{0.636003315f, 0.397404134f},
-std::array<float,2>{0.0881577209f, 0.241725653f},
-std::array<float,2>{0.70934999f, 0.638395548f},
-std::array<float,2>{0.2869398f, 0.859869957f},
-std::array<float,2>{0.822270334f, 0.282842159f},
-std::array<float,2>{0.465064734f, 0.438221693f},
-std::array<float,2>{0.8762694f, 0.891213715f},
-std::array<float,2>{0.2146364f, 0.545807302f},
-std::array<float,2>{0.62270838f, 0.0445653796f},
-std::array<float,2>{0.168493763f, 0.450037926f},
-std::array<float,2>{0.542024791f, 0.902315795f},
-std::array<float,2>{0.435342103f, 0.532826006f},
-std::array<float,2>{0.938647211f, 0.0371019468f},
-std::array<float,2>{0.336627513f, 0.24367328f},
-std::array<float,2>{0.750200987f, 0.630815744f},
-std::array<float,2>{0.0550730675f, 0.869898975f},
-std::array<float,2>{0.651845872f, 0.291136205f},
-std::array<float,2>{0.0733519867f, 0.105134651f},
-std::array<float,2>{0.693870664f, 0.60674876f},
-std::array<float,2>{0.304175884f, 0.987796962f},
-std::array<float,2>{0.829196036f, 0.399657041f},
-std::array<float,2>{0.440034181f, 0.34172076f},
-std::array<float,2>{0.890976608f, 0.755147994f},
-std::array<float,2>{0.188630566f, 0.72494787f},
-std::array<float,2>{0.597239256f, 0.135881409f},
-std::array<float,2>{0.0173691083f, 0.255440742f},
-std::array<float,2>{0.660218835f, 0.815491796f},
-std::array<float,2>{0.369226843f, 0.683174193f},
-std::array<float,2>{0.803403556f, 0.216428444f},
-std::array<float,2>{0.390133858f, 0.00995453354f},
-std::array<float,2>{0.988293409f, 0.510519743f},
-std::array<float,2>{0.150954872f, 0.937457561f},
-std::array<float,2>{0.517238557f, 0.49040103f},
-std::array<float,2>{0.2217049f, 0.164092854f},
-std::array<float,2>{0.576855481f, 0.714258969f},
-std::array<float,2>{0.48640576f, 0.791411281f},
-std::array<float,2>{0.912495553f, 0.363705695f},
-std::array<float,2>{0.268252254f, 0.414192468f},
-std::array<float,2>{0.850179613f, 0.953740716f},
-std::array<float,2>{0.116461925f, 0.583936334f},
-std::array<float,2>{0.734653294f, 0.0721575022f},
-std::array<float,2>{0.103017583f, 0.387709588f},
-std::array<float,2>{0.731785119f, 0.974954486f},
-std::array<float,2>{0.256654173f, 0.618503392f},
-std::array<float,2>{0.859452486f, 0.116822995f},
-std::array<float,2>{0.469221056f, 0.15010111f},
-std::array<float,2>{0.928001165f, 0.743241251f},
-std::array<float,2>{0.239051849f, 0.777435184f},
-std::array<float,2>{0.593071043f, 0.313554794f},
-std::array<float,2>{0.13937825f, 0.0608675182f},
-std::array<float,2>{0.510043919f, 0.550677717f},
-std::array<float,2>{0.397130758f, 0.879463315f},
-std::array<float,2>{0.981278777f, 0.453948349f},
-std::array<float,2>{0.344300687f, 0.309192181f},
-std::array<float,2>{0.783732533f, 0.848222315f},
-std::array<float,2>{0.00689193653f, 0.640674889f},
-std::array<float,2>{0.672949731f, 0.233336747f},
-std::array<float,2>{0.218041912f, 0.349533856f},
-std::array<float,2>{0.617542505f, 0.799856544f},
-std::array<float,2>{0.464475513f, 0.696040452f},
-std::array<float,2>{0.879760146f, 0.17358008f},
-std::array<float,2>{0.282133609f, 0.093675293f},
-std::array<float,2>{0.824797094f, 0.5653795f},
-std::array<float,2>{0.0922361314f, 0.943455398f},
-std::array<float,2>{0.703812122f, 0.42847839f},
-std::array<float,2>{0.0331128165f, 0.197214261f},
-std::array<float,2>{0.637339771f, 0.660496533f},
-std::array<float,2>{0.318377882f, 0.84158814f},
-std::array<float,2>{0.77811718f, 0.270507604f},
-std::array<float,2>{0.421290994f, 0.468888015f},
-std::array<float,2>{0.953306139f, 0.909972548f},
-std::array<float,2>{0.175159246f, 0.516650259f},
-std::array<float,2>{0.553763092f, 0.0254198629f},
-std::array<float,2>{0.244212389f, 0.433843732f},
-std::array<float,2>{0.57943666f, 0.95070821f},
-std::array<float,2>{0.482382029f, 0.577257276f},
-std::array<float,2>{0.933351696f, 0.0857111961f},
-std::array<float,2>{0.263423115f, 0.184171766f},
-std::array<float,2>{0.87205565f, 0.690847695f},
-std::array<float,2>{0.0999481082f, 0.806851745f},
-std::array<float,2>{0.724962234f, 0.353476971f},
-std::array<float,2>{0.00921570975f, 0.0217302553f},
-std::array<float,2>{0.682044029f, 0.524814188f},
-std::array<float,2>{0.352342963f, 0.91804266f},
-std::array<float,2>{0.794858217f, 0.482749462f},
-std::array<float,2>{0.403770775f, 0.278064042f},
-std::array<float,2>{0.973404467f, 0.833396018f},
-std::array<float,2>{0.125828743f, 0.665747762f},
-std::array<float,2>{0.500382006f, 0.190486073f},
-std::array<float,2>{0.0855134875f, 0.325033575f},
-std::array<float,2>{0.712611675f, 0.770366549f},
-std::array<float,2>{0.292734385f, 0.740117908f},
-std::array<float,2>{0.818425059f, 0.143348366f},
-std::array<float,2>{0.454815298f, 0.123148799f},
-std::array<float,2>{0.8875193f, 0.612420976f},
-std::array<float,2>{0.206053689f, 0.980467021f},
-std::array<float,2>{0.617127955f, 0.379597962f},
-std::array<float,2>{0.18670091f, 0.222536474f},
-std::array<float,2>{0.556100488f, 0.649647176f},
-std::array<float,2>{0.408895999f, 0.857347012f},
-std::array<float,2>{0.962168336f, 0.299664438f},
-std::array<float,2>{0.323226899f, 0.464990824f},
-std::array<float,2>{0.772443056f, 0.889637411f},
-std::array<float,2>{0.04550457f, 0.560951471f},
-std::array<float,2>{0.629956424f, 0.0506391414f},
-std::array<float,2>{0.0532825179f, 0.492695451f},
-std::array<float,2>{0.643958449f, 0.927255034f},
-std::array<float,2>{0.334694326f, 0.501316905f},
-std::array<float,2>{0.760306656f, 0.00352408364f},
-std::array<float,2>{0.425900698f, 0.208582908f},
-std::array<float,2>{0.952158451f, 0.672057927f},
-std::array<float,2>{0.158708528f, 0.822072685f},
-std::array<float,2>{0.536215305f, 0.261253983f},
-std::array<float,2>{0.199592322f, 0.0662579089f},
-std::array<float,2>{0.608158231f, 0.593371928f},
-std::array<float,2>{0.449366271f, 0.967537344f},
-std::array<float,2>{0.902879953f, 0.412437886f},
-std::array<float,2>{0.311213195f, 0.367597371f},
-std::array<float,2>{0.842064679f, 0.782119513f},
-std::array<float,2>{0.0663398504f, 0.706361055f},
-std::array<float,2>{0.702910304f, 0.161852986f},
-std::array<float,2>{0.14317742f, 0.288227916f},
-std::array<float,2>{0.529820502f, 0.866070688f},
-std::array<float,2>{0.375632256f, 0.633500159f},
-std::array<float,2>{0.996712089f, 0.235435113f},
-std::array<float,2>{0.366157979f, 0.0413266569f},
-std::array<float,2>{0.812289655f, 0.539141297f},
-std::array<float,2>{0.0307009052f, 0.896027505f},
-std::array<float,2>{0.664247453f, 0.443060398f},
-std::array<float,2>{0.121191986f, 0.130938753f},
-std::array<float,2>{0.749193549f, 0.730807483f},
-std::array<float,2>{0.274277687f, 0.76216656f},
-std::array<float,2>{0.859203279f, 0.33180356f},
-std::array<float,2>{0.495273292f, 0.392060995f},
-std::array<float,2>{0.917751193f, 0.99490571f},
-std::array<float,2>{0.232873738f, 0.598291337f},
-std::array<float,2>{0.568810284f, 0.0986570641f},
-std::array<float,2>{0.182794869f, 0.419987231f},
-std::array<float,2>{0.562226117f, 0.958726525f},
-std::array<float,2>{0.410640955f, 0.578892708f},
-std::array<float,2>{0.967216134f, 0.0777713954f},
-std::array<float,2>{0.328077227f, 0.1711777f},
-std::array<float,2>{0.767789423f, 0.717632949f},
-std::array<float,2>{0.0408338346f, 0.793288529f},
-std::array<float,2>{0.626448452f, 0.360262156f},
-std::array<float,2>{0.0816958696f, 0.0126812868f},
-std::array<float,2>{0.715910196f, 0.51296258f},
-std::array<float,2>{0.295025766f, 0.931888461f},
-std::array<float,2>{0.813306153f, 0.486336142f},
-std::array<float,2>{0.459226847f, 0.25361082f},
-std::array<float,2>{0.883305728f, 0.817696452f},
-std::array<float,2>{0.207543164f, 0.684639156f},
-std::array<float,2>{0.611067951f, 0.212790161f},
-std::array<float,2>{0.0118407821f, 0.336967349f},
-std::array<float,2>{0.684026539f, 0.753647506f},
-std::array<float,2>{0.358352989f, 0.722165585f},
-std::array<float,2>{0.791850507f, 0.138403878f},
-std::array<float,2>{0.399276197f, 0.109362915f},
-std::array<float,2>{0.97061193f, 0.603288233f},
-std::array<float,2>{0.131753653f, 0.990671039f},
-std::array<float,2>{0.50691241f, 0.402654856f},
-std::array<float,2>{0.248522595f, 0.247490361f},
-std::array<float,2>{0.582082808f, 0.628333569f},
-std::array<float,2>{0.47676754f, 0.873060882f},
-std::array<float,2>{0.936138928f, 0.296155393f},
-std::array<float,2>{0.260597497f, 0.445816576f},
-std::array<float,2>{0.870886087f, 0.905086279f},
-std::array<float,2>{0.0973159522f, 0.538298786f},
-std::array<float,2>{0.721692562f, 0.0322274268f},
-std::array<float,2>{0.118512794f, 0.473441213f},
-std::array<float,2>{0.742321014f, 0.910408378f},
-std::array<float,2>{0.281000853f, 0.521911561f},
-std::array<float,2>{0.855082154f, 0.0284582488f},
-std::array<float,2>{0.499420732f, 0.199570209f},
-std::array<float,2>{0.921465397f, 0.657273173f},
-std::array<float,2>{0.228181735f, 0.837378025f},
-std::array<float,2>{0.562990367f, 0.267056227f},
-std::array<float,2>{0.146327317f, 0.0891803056f},
-std::array<float,2>{0.52567488f, 0.56946373f},
-std::array<float,2>{0.380546987f, 0.939136684f},
-std::array<float,2>{0.992336333f, 0.425190628f},
-std::array<float,2>{0.362533569f, 0.347026646f},
-std::array<float,2>{0.808007061f, 0.802482545f},
-std::array<float,2>{0.0257799663f, 0.701821506f},
-std::array<float,2>{0.668212891f, 0.177382737f},
-std::array<float,2>{0.197548866f, 0.307777345f},
-std::array<float,2>{0.604196668f, 0.84652853f},
-std::array<float,2>{0.447924405f, 0.645286798f},
-std::array<float,2>{0.899081588f, 0.227407679f},
-std::array<float,2>{0.306107938f, 0.0563124046f},
-std::array<float,2>{0.839747429f, 0.551984966f},
-std::array<float,2>{0.0700686276f, 0.875451624f},
-std::array<float,2>{0.698330164f, 0.458847731f},
-std::array<float,2>{0.0502632484f, 0.152545795f},
-std::array<float,2>{0.644644678f, 0.747242332f},
-std::array<float,2>{0.328522414f, 0.773684621f},
-std::array<float,2>{0.764901042f, 0.318501592f},
-std::array<float,2>{0.422979504f, 0.385828793f},
-std::array<float,2>{0.947201192f, 0.970915616f},
-std::array<float,2>{0.161310628f, 0.62301147f},
-std::array<float,2>{0.534730911f, 0.110409938f},
-std::array<float,2>{0.223234311f, 0.461483747f},
-std::array<float,2>{0.571321189f, 0.88493681f},
-std::array<float,2>{0.490468979f, 0.55576098f},
-std::array<float,2>{0.909067035f, 0.0509133711f},
-std::array<float,2>{0.271657318f, 0.223815158f},
-std::array<float,2>{0.844036996f, 0.653355896f},
-std::array<float,2>{0.112885863f, 0.851829112f},
-std::array<float,2>{0.741319358f, 0.303407341f},
-std::array<float,2>{0.0215961728f, 0.119648926f},
-std::array<float,2>{0.656976163f, 0.614518166f},
-std::array<float,2>{0.372690916f, 0.982819319f},
-std::array<float,2>{0.797508359f, 0.37888515f},
-std::array<float,2>{0.384783268f, 0.323275566f},
-std::array<float,2>{0.984459758f, 0.768752038f},
-std::array<float,2>{0.155223772f, 0.736032784f},
-std::array<float,2>{0.52323848f, 0.146343812f},
-std::array<float,2>{0.0743438676f, 0.274141699f},
-std::array<float,2>{0.691016078f, 0.829653382f},
-std::array<float,2>{0.297467738f, 0.669503331f},
-std::array<float,2>{0.834612966f, 0.194381014f},
-std::array<float,2>{0.441526234f, 0.0157784335f},
-std::array<float,2>{0.897447586f, 0.528060794f},
-std::array<float,2>{0.195051029f, 0.914785683f},
-std::array<float,2>{0.598753452f, 0.477524012f},
-std::array<float,2>{0.164753154f, 0.183182344f},
-std::array<float,2>{0.54602325f, 0.692343175f},
-std::array<float,2>{0.431569457f, 0.809842587f},
-std::array<float,2>{0.942197561f, 0.358591825f},
-std::array<float,2>{0.341032863f, 0.433489174f},
-std::array<float,2>{0.754140735f, 0.945666909f},
-std::array<float,2>{0.0603157058f, 0.573788166f},
-std::array<float,2>{0.655807793f, 0.0813700259f},
-std::array<float,2>{0.0355279595f, 0.395925283f},
-std::array<float,2>{0.634558976f, 0.996673644f},
-std::array<float,2>{0.314149112f, 0.597626805f},
-std::array<float,2>{0.776693046f, 0.096925877f},
-std::array<float,2>{0.415894181f, 0.127509922f},
-std::array<float,2>{0.960208476f, 0.726804614f},
-std::array<float,2>{0.178949952f, 0.760659039f},
-std::array<float,2>{0.550706387f, 0.334117532f},
-std::array<float,2>{0.212260932f, 0.046665255f},
-std::array<float,2>{0.623811245f, 0.543125689f},
-std::array<float,2>{0.467414409f, 0.893109441f},
-std::array<float,2>{0.877390385f, 0.439925939f},
-std::array<float,2>{0.288161278f, 0.284114093f},
-std::array<float,2>{0.822206736f, 0.862379611f},
-std::array<float,2>{0.0866222531f, 0.639518678f},
-std::array<float,2>{0.707102537f, 0.23949714f},
-std::array<float,2>{0.135614544f, 0.373604685f},
-std::array<float,2>{0.514005423f, 0.786113441f},
-std::array<float,2>{0.394256681f, 0.71008265f},
-std::array<float,2>{0.978091478f, 0.159091726f},
-std::array<float,2>{0.34996444f, 0.0671442524f},
-std::array<float,2>{0.786916316f, 0.58937031f},
-std::array<float,2>{0.000367406843f, 0.963699639f},
-std::array<float,2>{0.679441154f, 0.407113433f},
-std::array<float,2>{0.108196862f, 0.205650061f},
-std::array<float,2>{0.7286008f, 0.676912487f},
-std::array<float,2>{0.250433445f, 0.826844931f},
-std::array<float,2>{0.864175975f, 0.263277411f},
-std::array<float,2>{0.47601226f, 0.497163713f},
-std::array<float,2>{0.923894048f, 0.92489332f},
-std::array<float,2>{0.235571548f, 0.504974842f},
-std::array<float,2>{0.588182628f, 0.00499449298f},
-std::array<float,2>{0.14952901f, 0.489510834f},
-std::array<float,2>{0.519464195f, 0.934206843f},
-std::array<float,2>{0.387207299f, 0.509385884f},
-std::array<float,2>{0.990726888f, 0.00879530516f},
-std::array<float,2>{0.368755251f, 0.217739567f},
-std::array<float,2>{0.800793052f, 0.681305766f},
-std::array<float,2>{0.0192763414f, 0.813695312f},
-std::array<float,2>{0.66290617f, 0.256551266f},
-std::array<float,2>{0.114973918f, 0.0724611208f},
-std::array<float,2>{0.736928105f, 0.585394382f},
-std::array<float,2>{0.266345948f, 0.956860781f},
-std::array<float,2>{0.848492265f, 0.417845845f},
-std::array<float,2>{0.485773474f, 0.365704894f},
-std::array<float,2>{0.910367429f, 0.789966106f},
-std::array<float,2>{0.219022542f, 0.712476671f},
-std::array<float,2>{0.574674129f, 0.166762039f},
-std::array<float,2>{0.058312241f, 0.290490091f},
-std::array<float,2>{0.650366664f, 0.868471205f},
-std::array<float,2>{0.339422435f, 0.632227123f},
-std::array<float,2>{0.752898812f, 0.245242521f},
-std::array<float,2>{0.435820103f, 0.0382426344f},
-std::array<float,2>{0.940863729f, 0.53443557f},
-std::array<float,2>{0.170131937f, 0.900305927f},
-std::array<float,2>{0.540944636f, 0.451229453f},
-std::array<float,2>{0.190483466f, 0.134480208f},
-std::array<float,2>{0.594892919f, 0.723557472f},
-std::array<float,2>{0.437641054f, 0.756246567f},
-std::array<float,2>{0.893933654f, 0.341830522f},
-std::array<float,2>{0.302110225f, 0.400711775f},
-std::array<float,2>{0.830476999f, 0.98532331f},
-std::array<float,2>{0.0706018358f, 0.608812392f},
-std::array<float,2>{0.692541242f, 0.102296881f},
-std::array<float,2>{0.0914029032f, 0.426780164f},
-std::array<float,2>{0.706041634f, 0.941557348f},
-std::array<float,2>{0.283740997f, 0.563916028f},
-std::array<float,2>{0.827240169f, 0.0916530266f},
-std::array<float,2>{0.461212635f, 0.17476891f},
-std::array<float,2>{0.882027149f, 0.698928654f},
-std::array<float,2>{0.216110885f, 0.79748714f},
-std::array<float,2>{0.620112836f, 0.350482076f},
-std::array<float,2>{0.172547385f, 0.0250124112f},
-std::array<float,2>{0.552568614f, 0.518907368f},
-std::array<float,2>{0.418096334f, 0.907406986f},
-std::array<float,2>{0.956471682f, 0.472175211f},
-std::array<float,2>{0.31677869f, 0.2731978f},
-std::array<float,2>{0.780285656f, 0.84252882f},
-std::array<float,2>{0.033597663f, 0.662168205f},
-std::array<float,2>{0.639452934f, 0.197626442f},
-std::array<float,2>{0.241383106f, 0.315172702f},
-std::array<float,2>{0.589877367f, 0.779328704f},
-std::array<float,2>{0.471535861f, 0.74467659f},
-std::array<float,2>{0.926948488f, 0.150488079f},
-std::array<float,2>{0.25560227f, 0.114651583f},
-std::array<float,2>{0.862597525f, 0.620472372f},
-std::array<float,2>{0.103923701f, 0.973491251f},
-std::array<float,2>{0.733202636f, 0.390593559f},
-std::array<float,2>{0.0051724175f, 0.231805444f},
-std::array<float,2>{0.674642861f, 0.644039869f},
-std::array<float,2>{0.347571194f, 0.851114154f},
-std::array<float,2>{0.781805813f, 0.312448859f},
-std::array<float,2>{0.395360142f, 0.455974102f},
-std::array<float,2>{0.983108163f, 0.881396115f},
-std::array<float,2>{0.137182444f, 0.548800111f},
-std::array<float,2>{0.507812858f, 0.0603822246f},
-std::array<float,2>{0.204361379f, 0.381328315f},
-std::array<float,2>{0.61443615f, 0.977280557f},
-std::array<float,2>{0.455298513f, 0.60988009f},
-std::array<float,2>{0.888982177f, 0.122847594f},
-std::array<float,2>{0.28908664f, 0.142509386f},
-std::array<float,2>{0.817490637f, 0.741106868f},
-std::array<float,2>{0.083289057f, 0.773089111f},
-std::array<float,2>{0.713385403f, 0.327933311f},
-std::array<float,2>{0.0444851704f, 0.0479774699f},
-std::array<float,2>{0.631565809f, 0.560182273f},
-std::array<float,2>{0.320506871f, 0.886803985f},
-std::array<float,2>{0.770936847f, 0.467598349f},
-std::array<float,2>{0.40764159f, 0.298318416f},
-std::array<float,2>{0.963306367f, 0.857520103f},
-std::array<float,2>{0.184386492f, 0.650493741f},
-std::array<float,2>{0.557682633f, 0.21902737f},
-std::array<float,2>{0.0991554782f, 0.355117172f},
-std::array<float,2>{0.723969281f, 0.805484056f},
-std::array<float,2>{0.264676094f, 0.688772857f},
-std::array<float,2>{0.873715639f, 0.185723558f},
-std::array<float,2>{0.483819783f, 0.0821959898f},
-std::array<float,2>{0.931464732f, 0.57541877f},
-std::array<float,2>{0.243240282f, 0.951864839f},
-std::array<float,2>{0.581152439f, 0.436889052f},
-std::array<float,2>{0.127676353f, 0.189408079f},
-std::array<float,2>{0.502122104f, 0.66691637f},
-std::array<float,2>{0.406004339f, 0.835414112f},
-std::array<float,2>{0.974941611f, 0.280280888f},
-std::array<float,2>{0.353773683f, 0.481227785f},
-std::array<float,2>{0.796299577f, 0.920155406f},
-std::array<float,2>{0.0110852253f, 0.525425434f},
-std::array<float,2>{0.680992603f, 0.0196138117f},
-std::array<float,2>{0.0274991877f, 0.443878919f},
-std::array<float,2>{0.666585505f, 0.897603929f},
-std::array<float,2>{0.364368647f, 0.541269362f},
-std::array<float,2>{0.810371578f, 0.0402889177f},
-std::array<float,2>{0.37820071f, 0.237627074f},
-std::array<float,2>{0.999081135f, 0.635731816f},
-std::array<float,2>{0.14188908f, 0.864622474f},
-std::array<float,2>{0.52785027f, 0.287073493f},
-std::array<float,2>{0.23231034f, 0.0998417735f},
-std::array<float,2>{0.567602217f, 0.600456893f},
-std::array<float,2>{0.493071258f, 0.992327213f},
-std::array<float,2>{0.914971352f, 0.394492269f},
-std::array<float,2>{0.277124375f, 0.328230679f},
-std::array<float,2>{0.857147038f, 0.764780045f},
-std::array<float,2>{0.12348f, 0.734239578f},
-std::array<float,2>{0.746383905f, 0.130128682f},
-std::array<float,2>{0.15733254f, 0.259000212f},
-std::array<float,2>{0.538448811f, 0.823933721f},
-std::array<float,2>{0.428352207f, 0.674121022f},
-std::array<float,2>{0.951099873f, 0.210842103f},
-std::array<float,2>{0.332398474f, 0.000718049472f},
-std::array<float,2>{0.759112835f, 0.503649116f},
-std::array<float,2>{0.0524937846f, 0.928967297f},
-std::array<float,2>{0.640788674f, 0.49421218f},
-std::array<float,2>{0.0635888129f, 0.162276015f},
-std::array<float,2>{0.69963634f, 0.703811526f},
-std::array<float,2>{0.309769034f, 0.783879161f},
-std::array<float,2>{0.841624677f, 0.371085078f},
-std::array<float,2>{0.45168075f, 0.410817891f},
-std::array<float,2>{0.905621827f, 0.965904713f},
-std::array<float,2>{0.202805519f, 0.5914855f},
-std::array<float,2>{0.606880844f, 0.0634152144f}}
\ No newline at end of file
@@ -1,4096 +0,0 @@
-{std::array<float,2>{0.302758574f, 0.0430243127f},
-std::array<float,2>{0.9790681f, 0.906635523f},
-std::array<float,2>{0.609044373f, 0.464162797f},
-std::array<float,2>{0.0695945621f, 0.557006955f},
-std::array<float,2>{0.242171794f, 0.336465836f},
-std::array<float,2>{0.674079955f, 0.722035408f},
-std::array<float,2>{0.839366794f, 0.18628493f},
-std::array<float,2>{0.375608742f, 0.755543888f},
-std::array<float,2>{0.0565636307f, 0.219856039f},
-std::array<float,2>{0.53795284f, 0.820066094f},
-std::array<float,2>{0.89832294f, 0.257374883f},
-std::array<float,2>{0.363463491f, 0.665322959f},
-std::array<float,2>{0.4403148f, 0.391631395f},
-std::array<float,2>{0.753403604f, 0.5947541f},
-std::array<float,2>{0.724317491f, 0.124231227f},
-std::array<float,2>{0.169559687f, 0.971946478f},
-std::array<float,2>{0.429800838f, 0.13858217f},
-std::array<float,2>{0.853239715f, 0.786426723f},
-std::array<float,2>{0.628335118f, 0.349204421f},
-std::array<float,2>{0.209216684f, 0.692638278f},
-std::array<float,2>{0.110060453f, 0.471366525f},
-std::array<float,2>{0.587999105f, 0.514986932f},
-std::array<float,2>{0.953910232f, 0.0281243566f},
-std::array<float,2>{0.257659823f, 0.898570478f},
-std::array<float,2>{0.130031571f, 0.0694729537f},
-std::array<float,2>{0.691388428f, 0.946121633f},
-std::array<float,2>{0.793927312f, 0.431435555f},
-std::array<float,2>{0.470300198f, 0.577451706f},
-std::array<float,2>{0.340292037f, 0.302738637f},
-std::array<float,2>{0.910982192f, 0.626762927f},
-std::array<float,2>{0.51425308f, 0.218621388f},
-std::array<float,2>{0.0293202624f, 0.861468375f},
-std::array<float,2>{0.489333719f, 0.101664439f},
-std::array<float,2>{0.808156788f, 0.986801982f},
-std::array<float,2>{0.713428736f, 0.390410095f},
-std::array<float,2>{0.140886933f, 0.618797481f},
-std::array<float,2>{0.0111236526f, 0.273990571f},
-std::array<float,2>{0.518372059f, 0.684713662f},
-std::array<float,2>{0.921946764f, 0.247609481f},
-std::array<float,2>{0.313343257f, 0.828813553f},
-std::array<float,2>{0.201581508f, 0.160002276f},
-std::array<float,2>{0.650191665f, 0.770744085f},
-std::array<float,2>{0.864917278f, 0.318383694f},
-std::array<float,2>{0.408503413f, 0.739952624f},
-std::array<float,2>{0.276721537f, 0.443041772f},
-std::array<float,2>{0.937923193f, 0.538674295f},
-std::array<float,2>{0.564710081f, 0.0554616116f},
-std::array<float,2>{0.097637549f, 0.927289128f},
-std::array<float,2>{0.357466519f, 0.200745702f},
-std::array<float,2>{0.877997696f, 0.850577474f},
-std::array<float,2>{0.560316205f, 0.291998178f},
-std::array<float,2>{0.0333569907f, 0.644305885f},
-std::array<float,2>{0.177250281f, 0.413733065f},
-std::array<float,2>{0.745995522f, 0.586385906f},
-std::array<float,2>{0.779121161f, 0.0836749673f},
-std::array<float,2>{0.460464299f, 0.964455962f},
-std::array<float,2>{0.0828545019f, 0.00807726011f},
-std::array<float,2>{0.623324335f, 0.888171136f},
-std::array<float,2>{0.985190928f, 0.494421691f},
-std::array<float,2>{0.285548508f, 0.51643914f},
-std::array<float,2>{0.395854831f, 0.367071122f},
-std::array<float,2>{0.827782094f, 0.714956939f},
-std::array<float,2>{0.6629287f, 0.146847591f},
-std::array<float,2>{0.221214756f, 0.806606174f},
-std::array<float,2>{0.322529465f, 0.0920295715f},
-std::array<float,2>{0.931055665f, 0.957279146f},
-std::array<float,2>{0.52504915f, 0.4177908f},
-std::array<float,2>{9.48494999e-05f, 0.582446992f},
-std::array<float,2>{0.149465621f, 0.283599436f},
-std::array<float,2>{0.709322631f, 0.650051177f},
-std::array<float,2>{0.799726069f, 0.18767482f},
-std::array<float,2>{0.499960542f, 0.855295897f},
-std::array<float,2>{0.104044139f, 0.151900113f},
-std::array<float,2>{0.574807763f, 0.798056781f},
-std::array<float,2>{0.949111998f, 0.368675351f},
-std::array<float,2>{0.269152761f, 0.707575858f},
-std::array<float,2>{0.415721208f, 0.486124754f},
-std::array<float,2>{0.868331611f, 0.527820468f},
-std::array<float,2>{0.644000828f, 0.000230466278f},
-std::array<float,2>{0.193436816f, 0.878932297f},
-std::array<float,2>{0.463094801f, 0.237185389f},
-std::array<float,2>{0.768216372f, 0.841923594f},
-std::array<float,2>{0.734978616f, 0.272570163f},
-std::array<float,2>{0.180879548f, 0.673137844f},
-std::array<float,2>{0.0396311916f, 0.381107152f},
-std::array<float,2>{0.551366687f, 0.610262036f},
-std::array<float,2>{0.882878661f, 0.0981622785f},
-std::array<float,2>{0.350591481f, 0.994141519f},
-std::array<float,2>{0.233197257f, 0.0501502827f},
-std::array<float,2>{0.668581903f, 0.937262774f},
-std::array<float,2>{0.815084934f, 0.449199528f},
-std::array<float,2>{0.401698768f, 0.544730604f},
-std::array<float,2>{0.292586088f, 0.322079033f},
-std::array<float,2>{0.993846774f, 0.742505848f},
-std::array<float,2>{0.614780068f, 0.167448208f},
-std::array<float,2>{0.0862190053f, 0.773462951f},
-std::array<float,2>{0.382816046f, 0.0173090696f},
-std::array<float,2>{0.832317352f, 0.897957802f},
-std::array<float,2>{0.687302291f, 0.479585677f},
-std::array<float,2>{0.244324982f, 0.50751847f},
-std::array<float,2>{0.0723896772f, 0.355352819f},
-std::array<float,2>{0.60030365f, 0.699961185f},
-std::array<float,2>{0.97090745f, 0.127746463f},
-std::array<float,2>{0.309125662f, 0.790629625f},
-std::array<float,2>{0.163737863f, 0.209425062f},
-std::array<float,2>{0.727784038f, 0.868546486f},
-std::array<float,2>{0.762548327f, 0.310471892f},
-std::array<float,2>{0.448145896f, 0.635787904f},
-std::array<float,2>{0.369038194f, 0.422347724f},
-std::array<float,2>{0.900902212f, 0.569237173f},
-std::array<float,2>{0.542972028f, 0.0758536085f},
-std::array<float,2>{0.0519945882f, 0.942899108f},
-std::array<float,2>{0.260079175f, 0.172813296f},
-std::array<float,2>{0.967626631f, 0.761166453f},
-std::array<float,2>{0.578426421f, 0.329437405f},
-std::array<float,2>{0.120652094f, 0.732864499f},
-std::array<float,2>{0.216268644f, 0.453680277f},
-std::array<float,2>{0.638947666f, 0.549170017f},
-std::array<float,2>{0.8506639f, 0.0344939157f},
-std::array<float,2>{0.425249666f, 0.916812897f},
-std::array<float,2>{0.0178497024f, 0.115021601f},
-std::array<float,2>{0.505846679f, 0.983462512f},
-std::array<float,2>{0.920742631f, 0.403753787f},
-std::array<float,2>{0.330726027f, 0.608981669f},
-std::array<float,2>{0.479125619f, 0.260164738f},
-std::array<float,2>{0.788230598f, 0.66369009f},
-std::array<float,2>{0.698007703f, 0.230049059f},
-std::array<float,2>{0.140279591f, 0.825960815f},
-std::array<float,2>{0.272587478f, 0.119792655f},
-std::array<float,2>{0.952968121f, 0.974420249f},
-std::array<float,2>{0.571684003f, 0.397713602f},
-std::array<float,2>{0.107156359f, 0.600214839f},
-std::array<float,2>{0.188922539f, 0.252953857f},
-std::array<float,2>{0.644987524f, 0.671025395f},
-std::array<float,2>{0.87284106f, 0.222871557f},
-std::array<float,2>{0.421083122f, 0.813382745f},
-std::array<float,2>{0.00568231521f, 0.183266476f},
-std::array<float,2>{0.530975759f, 0.753808379f},
-std::array<float,2>{0.934088409f, 0.343100965f},
-std::array<float,2>{0.327545822f, 0.723467231f},
-std::array<float,2>{0.493594199f, 0.466123551f},
-std::array<float,2>{0.803768635f, 0.561680675f},
-std::array<float,2>{0.70535624f, 0.0407005362f},
-std::array<float,2>{0.154552385f, 0.913793981f},
-std::array<float,2>{0.403060883f, 0.21162495f},
-std::array<float,2>{0.817795396f, 0.867152274f},
-std::array<float,2>{0.667962074f, 0.297780097f},
-std::array<float,2>{0.227841109f, 0.629681647f},
-std::array<float,2>{0.091831103f, 0.433882147f},
-std::array<float,2>{0.612187505f, 0.573287845f},
-std::array<float,2>{0.997016788f, 0.0632842183f},
-std::array<float,2>{0.29376781f, 0.953074872f},
-std::array<float,2>{0.185451478f, 0.0247986801f},
-std::array<float,2>{0.738706887f, 0.906011045f},
-std::array<float,2>{0.772526741f, 0.475029051f},
-std::array<float,2>{0.465043724f, 0.510680199f},
-std::array<float,2>{0.346811861f, 0.34496963f},
-std::array<float,2>{0.888958156f, 0.688601792f},
-std::array<float,2>{0.54790473f, 0.135338724f},
-std::array<float,2>{0.0465109646f, 0.78222537f},
-std::array<float,2>{0.449349463f, 0.0605057515f},
-std::array<float,2>{0.761080921f, 0.923491538f},
-std::array<float,2>{0.733387589f, 0.44088459f},
-std::array<float,2>{0.158344343f, 0.53468734f},
-std::array<float,2>{0.0503738374f, 0.316122681f},
-std::array<float,2>{0.542269886f, 0.735318005f},
-std::array<float,2>{0.905384183f, 0.162645623f},
-std::array<float,2>{0.371279597f, 0.767272949f},
-std::array<float,2>{0.247082263f, 0.244736791f},
-std::array<float,2>{0.680429101f, 0.83566457f},
-std::array<float,2>{0.829012215f, 0.280641377f},
-std::array<float,2>{0.389155746f, 0.680054545f},
-std::array<float,2>{0.307565838f, 0.384419948f},
-std::array<float,2>{0.974773049f, 0.623561859f},
-std::array<float,2>{0.595496714f, 0.106016599f},
-std::array<float,2>{0.0754052922f, 0.991398811f},
-std::array<float,2>{0.332300127f, 0.144162878f},
-std::array<float,2>{0.914369106f, 0.811814487f},
-std::array<float,2>{0.501370907f, 0.360946506f},
-std::array<float,2>{0.0230751634f, 0.711717188f},
-std::array<float,2>{0.133458957f, 0.49985379f},
-std::array<float,2>{0.700435162f, 0.521236956f},
-std::array<float,2>{0.782525837f, 0.0125510367f},
-std::array<float,2>{0.480959266f, 0.8848598f},
-std::array<float,2>{0.123479858f, 0.0809532404f},
-std::array<float,2>{0.584322572f, 0.968226254f},
-std::array<float,2>{0.960961401f, 0.406304389f},
-std::array<float,2>{0.262882322f, 0.59009707f},
-std::array<float,2>{0.42811203f, 0.294810832f},
-std::array<float,2>{0.846327901f, 0.647087336f},
-std::array<float,2>{0.636689842f, 0.195379168f},
-std::array<float,2>{0.212947428f, 0.84476608f},
-std::array<float,2>{0.362219781f, 0.00616368279f},
-std::array<float,2>{0.89445895f, 0.875049293f},
-std::array<float,2>{0.532868207f, 0.49067679f},
-std::array<float,2>{0.0611083582f, 0.527058959f},
-std::array<float,2>{0.167014062f, 0.371580005f},
-std::array<float,2>{0.72206825f, 0.703708529f},
-std::array<float,2>{0.755487919f, 0.153441817f},
-std::array<float,2>{0.442494541f, 0.80106169f},
-std::array<float,2>{0.0636379346f, 0.193697989f},
-std::array<float,2>{0.604349971f, 0.856127918f},
-std::array<float,2>{0.982040226f, 0.287814528f},
-std::array<float,2>{0.299107432f, 0.653363824f},
-std::array<float,2>{0.382630318f, 0.419771701f},
-std::array<float,2>{0.843626618f, 0.581731677f},
-std::array<float,2>{0.67643857f, 0.0871692672f},
-std::array<float,2>{0.236068383f, 0.95381248f},
-std::array<float,2>{0.475279331f, 0.169160709f},
-std::array<float,2>{0.792744637f, 0.777577937f},
-std::array<float,2>{0.693036497f, 0.326608717f},
-std::array<float,2>{0.12812455f, 0.749839902f},
-std::array<float,2>{0.0258737262f, 0.449277997f},
-std::array<float,2>{0.509002566f, 0.539954722f},
-std::array<float,2>{0.908471823f, 0.0530239418f},
-std::array<float,2>{0.339010596f, 0.932098389f},
-std::array<float,2>{0.204295546f, 0.0971398354f},
-std::array<float,2>{0.631571829f, 0.996980906f},
-std::array<float,2>{0.858153403f, 0.375432223f},
-std::array<float,2>{0.435907245f, 0.614018321f},
-std::array<float,2>{0.252438873f, 0.268949896f},
-std::array<float,2>{0.957744837f, 0.677251816f},
-std::array<float,2>{0.590330958f, 0.238411739f},
-std::array<float,2>{0.114988945f, 0.836593628f},
-std::array<float,2>{0.411052763f, 0.0718467906f},
-std::array<float,2>{0.862032473f, 0.937928855f},
-std::array<float,2>{0.655742824f, 0.427374452f},
-std::array<float,2>{0.197391242f, 0.5641976f},
-std::array<float,2>{0.101487964f, 0.30802086f},
-std::array<float,2>{0.568840146f, 0.639362037f},
-std::array<float,2>{0.941423237f, 0.205900982f},
-std::array<float,2>{0.279608697f, 0.874478877f},
-std::array<float,2>{0.147935569f, 0.12891458f},
-std::array<float,2>{0.716196001f, 0.795016646f},
-std::array<float,2>{0.808860004f, 0.35633862f},
-std::array<float,2>{0.484766573f, 0.69701165f},
-std::array<float,2>{0.320143938f, 0.483038008f},
-std::array<float,2>{0.926643252f, 0.500036657f},
-std::array<float,2>{0.519744217f, 0.0217644498f},
-std::array<float,2>{0.0140062943f, 0.891519606f},
-std::array<float,2>{0.283982217f, 0.232007444f},
-std::array<float,2>{0.989034891f, 0.822528183f},
-std::array<float,2>{0.61989522f, 0.26271379f},
-std::array<float,2>{0.0819180608f, 0.659496665f},
-std::array<float,2>{0.22419475f, 0.40105021f},
-std::array<float,2>{0.658835053f, 0.60327363f},
-std::array<float,2>{0.823420703f, 0.109626904f},
-std::array<float,2>{0.392564416f, 0.979858279f},
-std::array<float,2>{0.0390247256f, 0.0380464792f},
-std::array<float,2>{0.557128191f, 0.921719372f},
-std::array<float,2>{0.881224215f, 0.459450543f},
-std::array<float,2>{0.352567524f, 0.551917791f},
-std::array<float,2>{0.45558086f, 0.335068613f},
-std::array<float,2>{0.774154782f, 0.730189621f},
-std::array<float,2>{0.746866643f, 0.177443951f},
-std::array<float,2>{0.172764137f, 0.763242662f},
-std::array<float,2>{0.255626768f, 0.0311858226f},
-std::array<float,2>{0.955335498f, 0.902305603f},
-std::array<float,2>{0.586990058f, 0.470596939f},
-std::array<float,2>{0.112934127f, 0.512217045f},
-std::array<float,2>{0.20855926f, 0.350247502f},
-std::array<float,2>{0.626253784f, 0.694505036f},
-std::array<float,2>{0.85474056f, 0.139426515f},
-std::array<float,2>{0.432460576f, 0.78825146f},
-std::array<float,2>{0.0275024436f, 0.215508491f},
-std::array<float,2>{0.512288988f, 0.859541595f},
-std::array<float,2>{0.913758039f, 0.301540971f},
-std::array<float,2>{0.342601717f, 0.628264606f},
-std::array<float,2>{0.472574919f, 0.431854486f},
-std::array<float,2>{0.79525274f, 0.575684369f},
-std::array<float,2>{0.688909411f, 0.0666575432f},
-std::array<float,2>{0.132167742f, 0.947314501f},
-std::array<float,2>{0.378242671f, 0.185163006f},
-std::array<float,2>{0.837263286f, 0.756557286f},
-std::array<float,2>{0.673256338f, 0.338319093f},
-std::array<float,2>{0.238894194f, 0.718871117f},
-std::array<float,2>{0.0672119185f, 0.461768091f},
-std::array<float,2>{0.606425166f, 0.556373775f},
-std::array<float,2>{0.977821767f, 0.0458461866f},
-std::array<float,2>{0.301256031f, 0.909354985f},
-std::array<float,2>{0.171163499f, 0.121428527f},
-std::array<float,2>{0.724751115f, 0.970308006f},
-std::array<float,2>{0.750705719f, 0.394364446f},
-std::array<float,2>{0.438163519f, 0.596899748f},
-std::array<float,2>{0.367097676f, 0.254423916f},
-std::array<float,2>{0.895243347f, 0.666551769f},
-std::array<float,2>{0.53625983f, 0.222218156f},
-std::array<float,2>{0.058385618f, 0.817615271f},
-std::array<float,2>{0.45860818f, 0.0841660574f},
-std::array<float,2>{0.780507982f, 0.961386263f},
-std::array<float,2>{0.743483365f, 0.412028909f},
-std::array<float,2>{0.178650483f, 0.588265121f},
-std::array<float,2>{0.0324057676f, 0.289549977f},
-std::array<float,2>{0.56082654f, 0.64192003f},
-std::array<float,2>{0.876472652f, 0.201247647f},
-std::array<float,2>{0.357282668f, 0.849364758f},
-std::array<float,2>{0.219469547f, 0.145488873f},
-std::array<float,2>{0.661618471f, 0.807550728f},
-std::array<float,2>{0.825409651f, 0.363388777f},
-std::array<float,2>{0.396830052f, 0.718614042f},
-std::array<float,2>{0.288732231f, 0.492871135f},
-std::array<float,2>{0.987635374f, 0.519490957f},
-std::array<float,2>{0.621257544f, 0.0105422875f},
-std::array<float,2>{0.08420939f, 0.888985038f},
-std::array<float,2>{0.315313667f, 0.248248443f},
-std::array<float,2>{0.925456583f, 0.830172002f},
-std::array<float,2>{0.516138494f, 0.276429921f},
-std::array<float,2>{0.00890136603f, 0.686392605f},
-std::array<float,2>{0.144352004f, 0.386884272f},
-std::array<float,2>{0.711885273f, 0.620959759f},
-std::array<float,2>{0.804723382f, 0.104073867f},
-std::array<float,2>{0.490562469f, 0.986157417f},
-std::array<float,2>{0.0954174548f, 0.058420334f},
-std::array<float,2>{0.562955379f, 0.929044008f},
-std::array<float,2>{0.939601541f, 0.444649637f},
-std::array<float,2>{0.275108904f, 0.536942422f},
-std::array<float,2>{0.407046497f, 0.317286789f},
-std::array<float,2>{0.865516782f, 0.740508437f},
-std::array<float,2>{0.652039766f, 0.15750967f},
-std::array<float,2>{0.200465515f, 0.772035182f},
-std::array<float,2>{0.349481672f, 0.100016132f},
-std::array<float,2>{0.885375261f, 0.993191659f},
-std::array<float,2>{0.554285884f, 0.379972875f},
-std::array<float,2>{0.0427230671f, 0.612721801f},
-std::array<float,2>{0.183064029f, 0.270102084f},
-std::array<float,2>{0.737704396f, 0.675275147f},
-std::array<float,2>{0.766174495f, 0.235345691f},
-std::array<float,2>{0.462501496f, 0.84168148f},
-std::array<float,2>{0.087925598f, 0.164973319f},
-std::array<float,2>{0.616427481f, 0.777081668f},
-std::array<float,2>{0.99554795f, 0.322266549f},
-std::array<float,2>{0.290046275f, 0.745287657f},
-std::array<float,2>{0.39850983f, 0.445896745f},
-std::array<float,2>{0.81419903f, 0.545009315f},
-std::array<float,2>{0.671124279f, 0.0471123867f},
-std::array<float,2>{0.231934369f, 0.935510635f},
-std::array<float,2>{0.496234864f, 0.189467281f},
-std::array<float,2>{0.798642516f, 0.851806581f},
-std::array<float,2>{0.708459675f, 0.282830924f},
-std::array<float,2>{0.151798978f, 0.652171612f},
-std::array<float,2>{0.00209081103f, 0.415320575f},
-std::array<float,2>{0.526212871f, 0.585110545f},
-std::array<float,2>{0.933152616f, 0.0905705318f},
-std::array<float,2>{0.320843846f, 0.959919214f},
-std::array<float,2>{0.193193316f, 0.00233025011f},
-std::array<float,2>{0.642145276f, 0.881480277f},
-std::array<float,2>{0.870767772f, 0.487692088f},
-std::array<float,2>{0.416950017f, 0.529451847f},
-std::array<float,2>{0.267189801f, 0.369236887f},
-std::array<float,2>{0.946088374f, 0.709937632f},
-std::array<float,2>{0.576388955f, 0.148834795f},
-std::array<float,2>{0.101751074f, 0.79999733f},
-std::array<float,2>{0.423580348f, 0.0331938416f},
-std::array<float,2>{0.848192573f, 0.914996207f},
-std::array<float,2>{0.636813223f, 0.455369383f},
-std::array<float,2>{0.218594f, 0.548187256f},
-std::array<float,2>{0.117768176f, 0.330693036f},
-std::array<float,2>{0.580752552f, 0.731626809f},
-std::array<float,2>{0.96563822f, 0.17421478f},
-std::array<float,2>{0.258075207f, 0.75813061f},
-std::array<float,2>{0.138628066f, 0.22728239f},
-std::array<float,2>{0.695851445f, 0.826423287f},
-std::array<float,2>{0.7864905f, 0.259569883f},
-std::array<float,2>{0.477391988f, 0.660274029f},
-std::array<float,2>{0.328964412f, 0.405106187f},
-std::array<float,2>{0.91927433f, 0.605732918f},
-std::array<float,2>{0.50668788f, 0.115725823f},
-std::array<float,2>{0.0162517969f, 0.981379449f},
-std::array<float,2>{0.311572433f, 0.125143349f},
-std::array<float,2>{0.969681203f, 0.792668045f},
-std::array<float,2>{0.598942459f, 0.352354556f},
-std::array<float,2>{0.0718482882f, 0.702090085f},
-std::array<float,2>{0.242889106f, 0.476873606f},
-std::array<float,2>{0.684654951f, 0.505835891f},
-std::array<float,2>{0.834707558f, 0.017848203f},
-std::array<float,2>{0.386657447f, 0.894723296f},
-std::array<float,2>{0.0545685738f, 0.0764677897f},
-std::array<float,2>{0.546754003f, 0.945069492f},
-std::array<float,2>{0.900371909f, 0.424872041f},
-std::array<float,2>{0.370620459f, 0.567681611f},
-std::array<float,2>{0.447146565f, 0.311739087f},
-std::array<float,2>{0.764890373f, 0.633464873f},
-std::array<float,2>{0.729495466f, 0.207878307f},
-std::array<float,2>{0.160895929f, 0.870187163f},
-std::array<float,2>{0.296668977f, 0.0651032776f},
-std::array<float,2>{0.999661386f, 0.949467242f},
-std::array<float,2>{0.609778166f, 0.436382264f},
-std::array<float,2>{0.0917423666f, 0.570878327f},
-std::array<float,2>{0.23006992f, 0.299375415f},
-std::array<float,2>{0.664177418f, 0.632342637f},
-std::array<float,2>{0.819987714f, 0.213722855f},
-std::array<float,2>{0.405561715f, 0.864019215f},
-std::array<float,2>{0.0439839065f, 0.133614242f},
-std::array<float,2>{0.54939568f, 0.7845788f},
-std::array<float,2>{0.887200534f, 0.346870214f},
-std::array<float,2>{0.344055861f, 0.690202177f},
-std::array<float,2>{0.468038559f, 0.4733769f},
-std::array<float,2>{0.770469844f, 0.508072436f},
-std::array<float,2>{0.740801454f, 0.0272500627f},
-std::array<float,2>{0.186353445f, 0.903279543f},
-std::array<float,2>{0.418091774f, 0.225584269f},
-std::array<float,2>{0.873223782f, 0.816131234f},
-std::array<float,2>{0.646716237f, 0.251170248f},
-std::array<float,2>{0.190677643f, 0.668956041f},
-std::array<float,2>{0.107566811f, 0.395194709f},
-std::array<float,2>{0.572543919f, 0.599160373f},
-std::array<float,2>{0.949351609f, 0.117780842f},
-std::array<float,2>{0.26954037f, 0.976545691f},
-std::array<float,2>{0.153377265f, 0.0413689986f},
-std::array<float,2>{0.703642845f, 0.911154151f},
-std::array<float,2>{0.801213801f, 0.468104064f},
-std::array<float,2>{0.495764166f, 0.559482872f},
-std::array<float,2>{0.324498236f, 0.341781288f},
-std::array<float,2>{0.936143875f, 0.72537905f},
-std::array<float,2>{0.527920187f, 0.179879293f},
-std::array<float,2>{0.00760129467f, 0.751536787f},
-std::array<float,2>{0.483799487f, 0.0155657372f},
-std::array<float,2>{0.784063458f, 0.883455575f},
-std::array<float,2>{0.701408565f, 0.496638447f},
-std::array<float,2>{0.135968611f, 0.521559954f},
-std::array<float,2>{0.0204160213f, 0.362132341f},
-std::array<float,2>{0.503853917f, 0.713347316f},
-std::array<float,2>{0.916101992f, 0.141109407f},
-std::array<float,2>{0.33454302f, 0.809020996f},
-std::array<float,2>{0.212085366f, 0.198571756f},
-std::array<float,2>{0.634580314f, 0.846849263f},
-std::array<float,2>{0.845550954f, 0.295936614f},
-std::array<float,2>{0.426843137f, 0.645287156f},
-std::array<float,2>{0.265006185f, 0.409100085f},
-std::array<float,2>{0.963800371f, 0.593062162f},
-std::array<float,2>{0.58232224f, 0.0790923983f},
-std::array<float,2>{0.122639298f, 0.966106772f},
-std::array<float,2>{0.37374717f, 0.161160886f},
-std::array<float,2>{0.904207051f, 0.768983662f},
-std::array<float,2>{0.539129317f, 0.312778711f},
-std::array<float,2>{0.0470567197f, 0.736715913f},
-std::array<float,2>{0.158076465f, 0.437943369f},
-std::array<float,2>{0.731202185f, 0.531814814f},
-std::array<float,2>{0.758213639f, 0.0607382208f},
-std::array<float,2>{0.452847004f, 0.924497366f},
-std::array<float,2>{0.0767763332f, 0.109132536f},
-std::array<float,2>{0.59640491f, 0.989590466f},
-std::array<float,2>{0.972963512f, 0.385157764f},
-std::array<float,2>{0.30572477f, 0.622632027f},
-std::array<float,2>{0.387186199f, 0.279147327f},
-std::array<float,2>{0.830158353f, 0.681831837f},
-std::array<float,2>{0.683331013f, 0.242844224f},
-std::array<float,2>{0.248317316f, 0.83248955f},
-std::array<float,2>{0.337717742f, 0.050806988f},
-std::array<float,2>{0.906603694f, 0.931203425f},
-std::array<float,2>{0.511429608f, 0.452457726f},
-std::array<float,2>{0.0246613435f, 0.542036474f},
-std::array<float,2>{0.12607114f, 0.32578665f},
-std::array<float,2>{0.694609106f, 0.746468663f},
-std::array<float,2>{0.789691627f, 0.170056328f},
-std::array<float,2>{0.47367385f, 0.779360712f},
-std::array<float,2>{0.11538323f, 0.240531012f},
-std::array<float,2>{0.592463195f, 0.839303613f},
-std::array<float,2>{0.95940274f, 0.265856594f},
-std::array<float,2>{0.250239789f, 0.67823869f},
-std::array<float,2>{0.434843659f, 0.378032207f},
-std::array<float,2>{0.857341409f, 0.615889966f},
-std::array<float,2>{0.629491508f, 0.0952096209f},
-std::array<float,2>{0.206601202f, 0.99903214f},
-std::array<float,2>{0.443434f, 0.154355288f},
-std::array<float,2>{0.75649333f, 0.803971708f},
-std::array<float,2>{0.719823658f, 0.373556107f},
-std::array<float,2>{0.165150985f, 0.705216229f},
-std::array<float,2>{0.0596373081f, 0.489262551f},
-std::array<float,2>{0.534743488f, 0.524942636f},
-std::array<float,2>{0.890731633f, 0.00523510855f},
-std::array<float,2>{0.36118111f, 0.878235579f},
-std::array<float,2>{0.23732163f, 0.0890297145f},
-std::array<float,2>{0.678314626f, 0.95612824f},
-std::array<float,2>{0.840747476f, 0.421458125f},
-std::array<float,2>{0.379526079f, 0.579928517f},
-std::array<float,2>{0.298722178f, 0.286197424f},
-std::array<float,2>{0.98320055f, 0.655371308f},
-std::array<float,2>{0.602536976f, 0.192859128f},
-std::array<float,2>{0.0663172081f, 0.85899806f},
-std::array<float,2>{0.393252701f, 0.111554995f},
-std::array<float,2>{0.821282268f, 0.978239298f},
-std::array<float,2>{0.657611728f, 0.399069399f},
-std::array<float,2>{0.225882456f, 0.60391891f},
-std::array<float,2>{0.0792263597f, 0.263793796f},
-std::array<float,2>{0.619110465f, 0.656852782f},
-std::array<float,2>{0.991589904f, 0.233288884f},
-std::array<float,2>{0.281551987f, 0.821376324f},
-std::array<float,2>{0.17559047f, 0.178728223f},
-std::array<float,2>{0.748639882f, 0.765118361f},
-std::array<float,2>{0.775683761f, 0.333416402f},
-std::array<float,2>{0.454187691f, 0.72810173f},
-std::array<float,2>{0.353622973f, 0.45771572f},
-std::array<float,2>{0.878920615f, 0.554257393f},
-std::array<float,2>{0.55624193f, 0.03551884f},
-std::array<float,2>{0.0352318473f, 0.918422103f},
-std::array<float,2>{0.27760461f, 0.203736171f},
-std::array<float,2>{0.944875002f, 0.872470796f},
-std::array<float,2>{0.567315698f, 0.306027293f},
-std::array<float,2>{0.0992224738f, 0.638200819f},
-std::array<float,2>{0.195937514f, 0.429242432f},
-std::array<float,2>{0.653893888f, 0.564659357f},
-std::array<float,2>{0.859386981f, 0.0724179f},
-std::array<float,2>{0.41306603f, 0.941392481f},
-std::array<float,2>{0.0118547622f, 0.0204994399f},
-std::array<float,2>{0.522608101f, 0.89364332f},
-std::array<float,2>{0.928434849f, 0.481420666f},
-std::array<float,2>{0.316631258f, 0.502157688f},
-std::array<float,2>{0.486920416f, 0.358432442f},
-std::array<float,2>{0.812302411f, 0.699165463f},
-std::array<float,2>{0.717791259f, 0.131498456f},
-std::array<float,2>{0.145713836f, 0.793468118f},
-std::array<float,2>{0.274087489f, 0.0565674417f},
-std::array<float,2>{0.940713823f, 0.926313043f},
-std::array<float,2>{0.56407392f, 0.441790968f},
-std::array<float,2>{0.0944087952f, 0.537476301f},
-std::array<float,2>{0.20002456f, 0.319971412f},
-std::array<float,2>{0.6509431f, 0.738619804f},
-std::array<float,2>{0.866492331f, 0.158844039f},
-std::array<float,2>{0.407474995f, 0.769673467f},
-std::array<float,2>{0.00789920799f, 0.246581182f},
-std::array<float,2>{0.517421424f, 0.829390049f},
-std::array<float,2>{0.924093127f, 0.275354713f},
-std::array<float,2>{0.31587404f, 0.684136093f},
-std::array<float,2>{0.491416126f, 0.389164448f},
-std::array<float,2>{0.806168795f, 0.617308199f},
-std::array<float,2>{0.712021768f, 0.102787413f},
-std::array<float,2>{0.143437877f, 0.987396061f},
-std::array<float,2>{0.397712588f, 0.148335457f},
-std::array<float,2>{0.824884176f, 0.80554533f},
-std::array<float,2>{0.660508752f, 0.365721941f},
-std::array<float,2>{0.220700502f, 0.716653168f},
-std::array<float,2>{0.0851040632f, 0.495211631f},
-std::array<float,2>{0.622717917f, 0.517391682f},
-std::array<float,2>{0.98686415f, 0.00922267884f},
-std::array<float,2>{0.287803262f, 0.88724035f},
-std::array<float,2>{0.178848416f, 0.0826730803f},
-std::array<float,2>{0.742767811f, 0.963703752f},
-std::array<float,2>{0.779869258f, 0.412972987f},
-std::array<float,2>{0.457195431f, 0.587049842f},
-std::array<float,2>{0.356407583f, 0.29185608f},
-std::array<float,2>{0.875025928f, 0.643541753f},
-std::array<float,2>{0.561696529f, 0.200079754f},
-std::array<float,2>{0.0313478038f, 0.850735247f},
-std::array<float,2>{0.438578159f, 0.123597316f},
-std::array<float,2>{0.751292706f, 0.970809579f},
-std::array<float,2>{0.725972176f, 0.391225517f},
-std::array<float,2>{0.170856327f, 0.594546974f},
-std::array<float,2>{0.056809444f, 0.255910039f},
-std::array<float,2>{0.535360277f, 0.664234757f},
-std::array<float,2>{0.895979166f, 0.218883887f},
-std::array<float,2>{0.366067648f, 0.818653703f},
-std::array<float,2>{0.239348426f, 0.18671146f},
-std::array<float,2>{0.671927273f, 0.753928185f},
-std::array<float,2>{0.836048424f, 0.33716014f},
-std::array<float,2>{0.377728522f, 0.721095562f},
-std::array<float,2>{0.302052289f, 0.463628858f},
-std::array<float,2>{0.977257133f, 0.557789862f},
-std::array<float,2>{0.606967747f, 0.0445567034f},
-std::array<float,2>{0.0674635842f, 0.908125579f},
-std::array<float,2>{0.343465239f, 0.217439204f},
-std::array<float,2>{0.912768424f, 0.862418771f},
-std::array<float,2>{0.513567448f, 0.303852677f},
-std::array<float,2>{0.0292920936f, 0.625087619f},
-std::array<float,2>{0.131453693f, 0.429726362f},
-std::array<float,2>{0.687568963f, 0.576287746f},
-std::array<float,2>{0.796323955f, 0.0690798908f},
-std::array<float,2>{0.471074522f, 0.947188675f},
-std::array<float,2>{0.112053044f, 0.0284671653f},
-std::array<float,2>{0.586147845f, 0.899536073f},
-std::array<float,2>{0.956297994f, 0.472308129f},
-std::array<float,2>{0.254545003f, 0.514076769f},
-std::array<float,2>{0.433437079f, 0.348367482f},
-std::array<float,2>{0.854126751f, 0.691840112f},
-std::array<float,2>{0.625895262f, 0.137073219f},
-std::array<float,2>{0.207240656f, 0.785681307f},
-std::array<float,2>{0.369670421f, 0.0749091506f},
-std::array<float,2>{0.899036467f, 0.941553712f},
-std::array<float,2>{0.545627236f, 0.423728257f},
-std::array<float,2>{0.053320881f, 0.56998837f},
-std::array<float,2>{0.162046373f, 0.30911237f},
-std::array<float,2>{0.72858274f, 0.635725439f},
-std::array<float,2>{0.764392376f, 0.210657373f},
-std::array<float,2>{0.446152657f, 0.867942333f},
-std::array<float,2>{0.0703456104f, 0.128061116f},
-std::array<float,2>{0.598127842f, 0.789085031f},
-std::array<float,2>{0.970070779f, 0.353998899f},
-std::array<float,2>{0.310972989f, 0.700466514f},
-std::array<float,2>{0.385001212f, 0.478635013f},
-std::array<float,2>{0.835847914f, 0.506029427f},
-std::array<float,2>{0.684397817f, 0.0159568656f},
-std::array<float,2>{0.243827268f, 0.896550417f},
-std::array<float,2>{0.478089362f, 0.228533283f},
-std::array<float,2>{0.785431445f, 0.825171888f},
-std::array<float,2>{0.696594834f, 0.261225998f},
-std::array<float,2>{0.13690266f, 0.662245989f},
-std::array<float,2>{0.0175279863f, 0.403090447f},
-std::array<float,2>{0.507168412f, 0.608154178f},
-std::array<float,2>{0.918474674f, 0.113815941f},
-std::array<float,2>{0.329168886f, 0.982733727f},
-std::array<float,2>{0.217507243f, 0.0338655002f},
-std::array<float,2>{0.637918591f, 0.917554677f},
-std::array<float,2>{0.848990738f, 0.454451948f},
-std::array<float,2>{0.422125489f, 0.550084412f},
-std::array<float,2>{0.259617418f, 0.328162223f},
-std::array<float,2>{0.96644783f, 0.733543336f},
-std::array<float,2>{0.581942677f, 0.172960535f},
-std::array<float,2>{0.118594974f, 0.760099947f},
-std::array<float,2>{0.417280823f, 0.00113475625f},
-std::array<float,2>{0.869382441f, 0.880852222f},
-std::array<float,2>{0.64070785f, 0.484716266f},
-std::array<float,2>{0.191602945f, 0.529027224f},
-std::array<float,2>{0.102783471f, 0.367949516f},
-std::array<float,2>{0.577220082f, 0.708644092f},
-std::array<float,2>{0.946879864f, 0.150560424f},
-std::array<float,2>{0.266077578f, 0.797175944f},
-std::array<float,2>{0.1512575f, 0.189272329f},
-std::array<float,2>{0.707416117f, 0.85408479f},
-std::array<float,2>{0.797598481f, 0.284603506f},
-std::array<float,2>{0.497078478f, 0.64890486f},
-std::array<float,2>{0.321613878f, 0.416111887f},
-std::array<float,2>{0.932160616f, 0.583938062f},
-std::array<float,2>{0.527160108f, 0.0929687023f},
-std::array<float,2>{0.0032991434f, 0.95833081f},
-std::array<float,2>{0.289720714f, 0.166497186f},
-std::array<float,2>{0.994619668f, 0.774519265f},
-std::array<float,2>{0.615364015f, 0.320320576f},
-std::array<float,2>{0.0895101875f, 0.743728101f},
-std::array<float,2>{0.230549768f, 0.447785795f},
-std::array<float,2>{0.670175433f, 0.543508768f},
-std::array<float,2>{0.813361347f, 0.0494924858f},
-std::array<float,2>{0.400387168f, 0.936519206f},
-std::array<float,2>{0.0419636443f, 0.0987107083f},
-std::array<float,2>{0.552739918f, 0.995455205f},
-std::array<float,2>{0.885880709f, 0.382308304f},
-std::array<float,2>{0.348184705f, 0.610832989f},
-std::array<float,2>{0.460985601f, 0.271965802f},
-std::array<float,2>{0.767006338f, 0.672450721f},
-std::array<float,2>{0.736927629f, 0.237570301f},
-std::array<float,2>{0.181675956f, 0.842893302f},
-std::array<float,2>{0.305487245f, 0.106548458f},
-std::array<float,2>{0.974351704f, 0.990537465f},
-std::array<float,2>{0.596812844f, 0.382888466f},
-std::array<float,2>{0.0772468671f, 0.624764979f},
-std::array<float,2>{0.24920851f, 0.279660016f},
-std::array<float,2>{0.682601094f, 0.681542397f},
-std::array<float,2>{0.8316589f, 0.24539642f},
-std::array<float,2>{0.388504714f, 0.834648252f},
-std::array<float,2>{0.0483300351f, 0.163748994f},
-std::array<float,2>{0.540086746f, 0.765904665f},
-std::array<float,2>{0.902768552f, 0.31460765f},
-std::array<float,2>{0.374493748f, 0.736204922f},
-std::array<float,2>{0.452112705f, 0.440392047f},
-std::array<float,2>{0.758887053f, 0.533744931f},
-std::array<float,2>{0.732391894f, 0.0589740835f},
-std::array<float,2>{0.157108575f, 0.92233032f},
-std::array<float,2>{0.425864398f, 0.197104707f},
-std::array<float,2>{0.844158888f, 0.84387809f},
-std::array<float,2>{0.633522391f, 0.29349649f},
-std::array<float,2>{0.211436003f, 0.6476174f},
-std::array<float,2>{0.121290013f, 0.407532871f},
-std::array<float,2>{0.583235323f, 0.591593206f},
-std::array<float,2>{0.964185894f, 0.0815438032f},
-std::array<float,2>{0.263860554f, 0.967279613f},
-std::array<float,2>{0.135610849f, 0.0128929839f},
-std::array<float,2>{0.702644765f, 0.88598907f},
-std::array<float,2>{0.784681678f, 0.499013484f},
-std::array<float,2>{0.482957184f, 0.52038461f},
-std::array<float,2>{0.335721701f, 0.360194474f},
-std::array<float,2>{0.917669654f, 0.712522864f},
-std::array<float,2>{0.502364159f, 0.142915472f},
-std::array<float,2>{0.0210006423f, 0.810561895f},
-std::array<float,2>{0.494306564f, 0.039999783f},
-std::array<float,2>{0.802130461f, 0.91246444f},
-std::array<float,2>{0.70431757f, 0.465181291f},
-std::array<float,2>{0.153110057f, 0.560556293f},
-std::array<float,2>{0.00647319993f, 0.342346609f},
-std::array<float,2>{0.528716922f, 0.724228382f},
-std::array<float,2>{0.936993003f, 0.182514161f},
-std::array<float,2>{0.325856537f, 0.75278151f},
-std::array<float,2>{0.19032912f, 0.224129394f},
-std::array<float,2>{0.647534013f, 0.813637674f},
-std::array<float,2>{0.874336839f, 0.252659023f},
-std::array<float,2>{0.419678897f, 0.670562088f},
-std::array<float,2>{0.27147609f, 0.396941066f},
-std::array<float,2>{0.950270832f, 0.60106498f},
-std::array<float,2>{0.574201226f, 0.12080054f},
-std::array<float,2>{0.109214544f, 0.972892225f},
-std::array<float,2>{0.344737977f, 0.136477679f},
-std::array<float,2>{0.888635814f, 0.782323301f},
-std::array<float,2>{0.550287843f, 0.34403044f},
-std::array<float,2>{0.0434979983f, 0.688457787f},
-std::array<float,2>{0.186919674f, 0.476201534f},
-std::array<float,2>{0.742046952f, 0.51147604f},
-std::array<float,2>{0.77080828f, 0.0241249446f},
-std::array<float,2>{0.467137694f, 0.904923201f},
-std::array<float,2>{0.0898925066f, 0.0644284114f},
-std::array<float,2>{0.610794365f, 0.951827884f},
-std::array<float,2>{0.998997927f, 0.435013741f},
-std::array<float,2>{0.295023978f, 0.572697997f},
-std::array<float,2>{0.404674739f, 0.29794234f},
-std::array<float,2>{0.819084048f, 0.630821228f},
-std::array<float,2>{0.665948868f, 0.212448031f},
-std::array<float,2>{0.228688061f, 0.865998745f},
-std::array<float,2>{0.317610949f, 0.0227684565f},
-std::array<float,2>{0.929006994f, 0.891819119f},
-std::array<float,2>{0.521623611f, 0.483436674f},
-std::array<float,2>{0.0129830334f, 0.501621604f},
-std::array<float,2>{0.145309761f, 0.356602013f},
-std::array<float,2>{0.717181265f, 0.695830166f},
-std::array<float,2>{0.810956478f, 0.130478173f},
-std::array<float,2>{0.488192409f, 0.796410084f},
-std::array<float,2>{0.0980651677f, 0.206468239f},
-std::array<float,2>{0.567728043f, 0.873886645f},
-std::array<float,2>{0.944085777f, 0.30693683f},
-std::array<float,2>{0.278332978f, 0.640349686f},
-std::array<float,2>{0.413927108f, 0.426573366f},
-std::array<float,2>{0.860766947f, 0.563056827f},
-std::array<float,2>{0.653028011f, 0.0704620257f},
-std::array<float,2>{0.197019204f, 0.939130843f},
-std::array<float,2>{0.453346699f, 0.176612839f},
-std::array<float,2>{0.776826501f, 0.761752248f},
-std::array<float,2>{0.74991852f, 0.334355921f},
-std::array<float,2>{0.174570128f, 0.729424059f},
-std::array<float,2>{0.0367870331f, 0.460091352f},
-std::array<float,2>{0.555362046f, 0.55166775f},
-std::array<float,2>{0.88051033f, 0.0386637859f},
-std::array<float,2>{0.355118364f, 0.920554221f},
-std::array<float,2>{0.225542992f, 0.110407867f},
-std::array<float,2>{0.656760395f, 0.97903192f},
-std::array<float,2>{0.821314931f, 0.401929051f},
-std::array<float,2>{0.393573284f, 0.602264941f},
-std::array<float,2>{0.282846153f, 0.262363702f},
-std::array<float,2>{0.990782797f, 0.658712626f},
-std::array<float,2>{0.617321074f, 0.231386125f},
-std::array<float,2>{0.0788961649f, 0.823522925f},
-std::array<float,2>{0.380245149f, 0.086650826f},
-std::array<float,2>{0.841740906f, 0.954778731f},
-std::array<float,2>{0.679086447f, 0.418625891f},
-std::array<float,2>{0.237101808f, 0.580760896f},
-std::array<float,2>{0.0649717301f, 0.288636446f},
-std::array<float,2>{0.603186011f, 0.652569473f},
-std::array<float,2>{0.984266818f, 0.194466829f},
-std::array<float,2>{0.297098577f, 0.856622517f},
-std::array<float,2>{0.164571241f, 0.153162926f},
-std::array<float,2>{0.719052374f, 0.802397311f},
-std::array<float,2>{0.757576644f, 0.372239798f},
-std::array<float,2>{0.445301712f, 0.705012619f},
-std::array<float,2>{0.359482259f, 0.491863936f},
-std::array<float,2>{0.89185524f, 0.525771439f},
-std::array<float,2>{0.533858776f, 0.00701292371f},
-std::array<float,2>{0.0588538684f, 0.876436234f},
-std::array<float,2>{0.251571536f, 0.239340812f},
-std::array<float,2>{0.960330248f, 0.837802291f},
-std::array<float,2>{0.592921495f, 0.267641276f},
-std::array<float,2>{0.116684139f, 0.676245451f},
-std::array<float,2>{0.205970988f, 0.376126021f},
-std::array<float,2>{0.630217135f, 0.615137398f},
-std::array<float,2>{0.856378734f, 0.0960525349f},
-std::array<float,2>{0.434028268f, 0.9971205f},
-std::array<float,2>{0.0241003763f, 0.0537533797f},
-std::array<float,2>{0.510478675f, 0.93302685f},
-std::array<float,2>{0.907384455f, 0.450318664f},
-std::array<float,2>{0.336478025f, 0.54077965f},
-std::array<float,2>{0.473592699f, 0.32779479f},
-std::array<float,2>{0.790068746f, 0.748867452f},
-std::array<float,2>{0.693820357f, 0.168590173f},
-std::array<float,2>{0.125448778f, 0.779156864f},
-std::array<float,2>{0.286394715f, 0.0114701213f},
-std::array<float,2>{0.985470414f, 0.890154243f},
-std::array<float,2>{0.624421477f, 0.494009972f},
-std::array<float,2>{0.0834649503f, 0.518258095f},
-std::array<float,2>{0.221821964f, 0.364779353f},
-std::array<float,2>{0.663616061f, 0.717735589f},
-std::array<float,2>{0.826590836f, 0.145704791f},
-std::array<float,2>{0.395259351f, 0.808259308f},
-std::array<float,2>{0.0350802764f, 0.20235604f},
-std::array<float,2>{0.559130788f, 0.847823143f},
-std::array<float,2>{0.877606213f, 0.290389061f},
-std::array<float,2>{0.358524382f, 0.641001284f},
-std::array<float,2>{0.459572017f, 0.411092281f},
-std::array<float,2>{0.777532637f, 0.589285016f},
-std::array<float,2>{0.744934857f, 0.0851457939f},
-std::array<float,2>{0.175836563f, 0.962027192f},
-std::array<float,2>{0.409914792f, 0.156539217f},
-std::array<float,2>{0.863408566f, 0.773279369f},
-std::array<float,2>{0.648812175f, 0.317696452f},
-std::array<float,2>{0.202265963f, 0.741697907f},
-std::array<float,2>{0.0960801169f, 0.443457276f},
-std::array<float,2>{0.565469086f, 0.535894096f},
-std::array<float,2>{0.939046919f, 0.0569268242f},
-std::array<float,2>{0.275934786f, 0.92846781f},
-std::array<float,2>{0.142287701f, 0.104621395f},
-std::array<float,2>{0.714182734f, 0.984655797f},
-std::array<float,2>{0.806958497f, 0.388393492f},
-std::array<float,2>{0.489101708f, 0.619363368f},
-std::array<float,2>{0.313987821f, 0.276088834f},
-std::array<float,2>{0.923463523f, 0.686933875f},
-std::array<float,2>{0.518621802f, 0.249431595f},
-std::array<float,2>{0.0102744997f, 0.831097484f},
-std::array<float,2>{0.469361663f, 0.0680255294f},
-std::array<float,2>{0.794597864f, 0.9490695f},
-std::array<float,2>{0.690264642f, 0.432796091f},
-std::array<float,2>{0.129691169f, 0.575024188f},
-std::array<float,2>{0.0303058345f, 0.301894784f},
-std::array<float,2>{0.515268624f, 0.627232313f},
-std::array<float,2>{0.911343634f, 0.216154471f},
-std::array<float,2>{0.341683656f, 0.861303687f},
-std::array<float,2>{0.21091564f, 0.140044212f},
-std::array<float,2>{0.627240121f, 0.787470758f},
-std::array<float,2>{0.851879299f, 0.351481885f},
-std::array<float,2>{0.431346118f, 0.69378227f},
-std::array<float,2>{0.255879611f, 0.469179899f},
-std::array<float,2>{0.954798043f, 0.513387561f},
-std::array<float,2>{0.589603782f, 0.0298145842f},
-std::array<float,2>{0.110403396f, 0.900982738f},
-std::array<float,2>{0.364984274f, 0.220703587f},
-std::array<float,2>{0.897271752f, 0.816559911f},
-std::array<float,2>{0.538592517f, 0.255785257f},
-std::array<float,2>{0.0554582737f, 0.667306662f},
-std::array<float,2>{0.168139592f, 0.393035561f},
-std::array<float,2>{0.722881138f, 0.596215069f},
-std::array<float,2>{0.752058744f, 0.122200273f},
-std::array<float,2>{0.440785348f, 0.969179749f},
-std::array<float,2>{0.0685502887f, 0.0467714891f},
-std::array<float,2>{0.608044207f, 0.90860045f},
-std::array<float,2>{0.980275929f, 0.462091893f},
-std::array<float,2>{0.304346919f, 0.555011094f},
-std::array<float,2>{0.376016557f, 0.339113623f},
-std::array<float,2>{0.838449359f, 0.720532477f},
-std::array<float,2>{0.675328791f, 0.184202448f},
-std::array<float,2>{0.240846351f, 0.757526577f},
-std::array<float,2>{0.331742913f, 0.116499357f},
-std::array<float,2>{0.921747684f, 0.982324719f},
-std::array<float,2>{0.504679739f, 0.406204104f},
-std::array<float,2>{0.0190852266f, 0.607100487f},
-std::array<float,2>{0.138950214f, 0.257952183f},
-std::array<float,2>{0.698712707f, 0.662094891f},
-std::array<float,2>{0.787385464f, 0.227845699f},
-std::array<float,2>{0.479829103f, 0.827425778f},
-std::array<float,2>{0.119162977f, 0.174844533f},
-std::array<float,2>{0.580044389f, 0.75924325f},
-std::array<float,2>{0.968521953f, 0.33147791f},
-std::array<float,2>{0.261511028f, 0.731103241f},
-std::array<float,2>{0.424089313f, 0.456135601f},
-std::array<float,2>{0.850163877f, 0.547638178f},
-std::array<float,2>{0.639808774f, 0.0317022502f},
-std::array<float,2>{0.215603322f, 0.915207982f},
-std::array<float,2>{0.448878407f, 0.208547875f},
-std::array<float,2>{0.763353527f, 0.869865f},
-std::array<float,2>{0.727304041f, 0.310683608f},
-std::array<float,2>{0.162403807f, 0.633836508f},
-std::array<float,2>{0.0515157357f, 0.423897415f},
-std::array<float,2>{0.544638395f, 0.567167222f},
-std::array<float,2>{0.901728332f, 0.077394411f},
-std::array<float,2>{0.367838651f, 0.944075048f},
-std::array<float,2>{0.245684981f, 0.0188919716f},
-std::array<float,2>{0.686083376f, 0.895876288f},
-std::array<float,2>{0.833199501f, 0.478327662f},
-std::array<float,2>{0.38408944f, 0.504116118f},
-std::array<float,2>{0.310161769f, 0.353144974f},
-std::array<float,2>{0.972205579f, 0.702389419f},
-std::array<float,2>{0.600853264f, 0.126042977f},
-std::array<float,2>{0.073327601f, 0.791616619f},
-std::array<float,2>{0.401122123f, 0.0479399525f},
-std::array<float,2>{0.816060662f, 0.934068143f},
-std::array<float,2>{0.669246435f, 0.446685821f},
-std::array<float,2>{0.234252229f, 0.546647549f},
-std::array<float,2>{0.087552093f, 0.323273361f},
-std::array<float,2>{0.613638461f, 0.744941235f},
-std::array<float,2>{0.992458045f, 0.165753588f},
-std::array<float,2>{0.291089475f, 0.776256859f},
-std::array<float,2>{0.180214137f, 0.23563236f},
-std::array<float,2>{0.735920608f, 0.840639889f},
-std::array<float,2>{0.768795252f, 0.27104941f},
-std::array<float,2>{0.464139432f, 0.674036801f},
-std::array<float,2>{0.350205779f, 0.379147142f},
-std::array<float,2>{0.884310961f, 0.611868322f},
-std::array<float,2>{0.551759779f, 0.100809216f},
-std::array<float,2>{0.0406147465f, 0.992740989f},
-std::array<float,2>{0.268415391f, 0.149854615f},
-std::array<float,2>{0.947902203f, 0.799083412f},
-std::array<float,2>{0.575423777f, 0.370680153f},
-std::array<float,2>{0.104948819f, 0.71047008f},
-std::array<float,2>{0.194744349f, 0.48654452f},
-std::array<float,2>{0.642903566f, 0.530907869f},
-std::array<float,2>{0.868031323f, 0.00319485506f},
-std::array<float,2>{0.414815396f, 0.882475555f},
-std::array<float,2>{0.00128072419f, 0.09114106f},
-std::array<float,2>{0.523460388f, 0.96056813f},
-std::array<float,2>{0.929779172f, 0.41422078f},
-std::array<float,2>{0.323555082f, 0.584040523f},
-std::array<float,2>{0.498887777f, 0.281657964f},
-std::array<float,2>{0.800508082f, 0.650720656f},
-std::array<float,2>{0.71072185f, 0.191210732f},
-std::array<float,2>{0.148949713f, 0.853047252f},
-std::array<float,2>{0.262091577f, 0.0794421285f},
-std::array<float,2>{0.96212852f, 0.964982092f},
-std::array<float,2>{0.585527182f, 0.409293741f},
-std::array<float,2>{0.124045417f, 0.59221077f},
-std::array<float,2>{0.214680925f, 0.295006931f},
-std::array<float,2>{0.635225236f, 0.646178067f},
-std::array<float,2>{0.847182155f, 0.197582006f},
-std::array<float,2>{0.429110348f, 0.84667623f},
-std::array<float,2>{0.022024231f, 0.141841367f},
-std::array<float,2>{0.500545025f, 0.810011446f},
-std::array<float,2>{0.91576004f, 0.362495601f},
-std::array<float,2>{0.333137542f, 0.714235246f},
-std::array<float,2>{0.481825292f, 0.497079462f},
-std::array<float,2>{0.781937599f, 0.52267319f},
-std::array<float,2>{0.700067043f, 0.0145746991f},
-std::array<float,2>{0.133820087f, 0.884231865f},
-std::array<float,2>{0.39001438f, 0.24374263f},
-std::array<float,2>{0.82923162f, 0.833021104f},
-std::array<float,2>{0.680873036f, 0.278262347f},
-std::array<float,2>{0.246615961f, 0.682620466f},
-std::array<float,2>{0.0744335204f, 0.386271179f},
-std::array<float,2>{0.593757749f, 0.621713042f},
-std::array<float,2>{0.975947022f, 0.107437395f},
-std::array<float,2>{0.308031827f, 0.988611281f},
-std::array<float,2>{0.159426242f, 0.0617336556f},
-std::array<float,2>{0.734291613f, 0.925049663f},
-std::array<float,2>{0.760712147f, 0.438561797f},
-std::array<float,2>{0.450469315f, 0.532540798f},
-std::array<float,2>{0.372209877f, 0.313518941f},
-std::array<float,2>{0.904420614f, 0.737678289f},
-std::array<float,2>{0.541540146f, 0.16017215f},
-std::array<float,2>{0.0497114286f, 0.768001437f},
-std::array<float,2>{0.466214687f, 0.0258371197f},
-std::array<float,2>{0.772081137f, 0.903878868f},
-std::array<float,2>{0.739830792f, 0.473702908f},
-std::array<float,2>{0.183642983f, 0.509167612f},
-std::array<float,2>{0.0452846847f, 0.345895678f},
-std::array<float,2>{0.547482729f, 0.690871298f},
-std::array<float,2>{0.88981849f, 0.134298235f},
-std::array<float,2>{0.346230537f, 0.783988059f},
-std::array<float,2>{0.22730194f, 0.21473828f},
-std::array<float,2>{0.666696787f, 0.864888132f},
-std::array<float,2>{0.817160189f, 0.300749451f},
-std::array<float,2>{0.403397024f, 0.631302714f},
-std::array<float,2>{0.294231683f, 0.437039554f},
-std::array<float,2>{0.997381926f, 0.571984589f},
-std::array<float,2>{0.613048017f, 0.0657213926f},
-std::array<float,2>{0.0929137543f, 0.950539649f},
-std::array<float,2>{0.326314688f, 0.181156635f},
-std::array<float,2>{0.934775233f, 0.750819921f},
-std::array<float,2>{0.530262589f, 0.340421885f},
-std::array<float,2>{0.00477373879f, 0.726558149f},
-std::array<float,2>{0.155831069f, 0.466887623f},
-std::array<float,2>{0.706202626f, 0.560176253f},
-std::array<float,2>{0.802969456f, 0.0426627956f},
-std::array<float,2>{0.49274689f, 0.911129534f},
-std::array<float,2>{0.105995715f, 0.119009085f},
-std::array<float,2>{0.570505142f, 0.974666595f},
-std::array<float,2>{0.95181632f, 0.395766854f},
-std::array<float,2>{0.271570772f, 0.597796023f},
-std::array<float,2>{0.420832455f, 0.250418961f},
-std::array<float,2>{0.871816933f, 0.668250918f},
-std::array<float,2>{0.645937085f, 0.225969747f},
-std::array<float,2>{0.188022822f, 0.814688087f},
-std::array<float,2>{0.352106303f, 0.0366348848f},
-std::array<float,2>{0.882215381f, 0.919008553f},
-std::array<float,2>{0.558045924f, 0.458498836f},
-std::array<float,2>{0.0371711813f, 0.553691983f},
-std::array<float,2>{0.173364222f, 0.332363784f},
-std::array<float,2>{0.747437f, 0.727528572f},
-std::array<float,2>{0.774509251f, 0.178364128f},
-std::array<float,2>{0.456374466f, 0.763898492f},
-std::array<float,2>{0.0809905529f, 0.233637258f},
-std::array<float,2>{0.620189011f, 0.820605934f},
-std::array<float,2>{0.989728868f, 0.265378892f},
-std::array<float,2>{0.284632891f, 0.657989025f},
-std::array<float,2>{0.390792012f, 0.400325179f},
-std::array<float,2>{0.822565913f, 0.605257452f},
-std::array<float,2>{0.659903586f, 0.112390332f},
-std::array<float,2>{0.223206803f, 0.977021933f},
-std::array<float,2>{0.485724777f, 0.132359222f},
-std::array<float,2>{0.809845328f, 0.794601202f},
-std::array<float,2>{0.71538043f, 0.358050466f},
-std::array<float,2>{0.146887168f, 0.697897494f},
-std::array<float,2>{0.0152839292f, 0.482067853f},
-std::array<float,2>{0.521263003f, 0.503457963f},
-std::array<float,2>{0.927008033f, 0.0211099368f},
-std::array<float,2>{0.318995446f, 0.892889738f},
-std::array<float,2>{0.198888883f, 0.0739644393f},
-std::array<float,2>{0.65442431f, 0.939545929f},
-std::array<float,2>{0.862724245f, 0.428453356f},
-std::array<float,2>{0.411506027f, 0.566275775f},
-std::array<float,2>{0.281002522f, 0.305449337f},
-std::array<float,2>{0.94300282f, 0.637425065f},
-std::array<float,2>{0.569843888f, 0.205035657f},
-std::array<float,2>{0.09968362f, 0.871824205f},
-std::array<float,2>{0.436793178f, 0.094709903f},
-std::array<float,2>{0.859048724f, 0.998970985f},
-std::array<float,2>{0.632501602f, 0.377557635f},
-std::array<float,2>{0.203341275f, 0.616537988f},
-std::array<float,2>{0.114251412f, 0.26686126f},
-std::array<float,2>{0.591140032f, 0.679403007f},
-std::array<float,2>{0.958957314f, 0.242184609f},
-std::array<float,2>{0.253103793f, 0.838077188f},
-std::array<float,2>{0.127066404f, 0.17131938f},
-std::array<float,2>{0.691423893f, 0.780865908f},
-std::array<float,2>{0.791931629f, 0.324482352f},
-std::array<float,2>{0.476544708f, 0.747949064f},
-std::array<float,2>{0.338370681f, 0.451648474f},
-std::array<float,2>{0.909770966f, 0.541491449f},
-std::array<float,2>{0.507890701f, 0.0526804663f},
-std::array<float,2>{0.0271130148f, 0.929818034f},
-std::array<float,2>{0.300117701f, 0.191552162f},
-std::array<float,2>{0.980510473f, 0.857554793f},
-std::array<float,2>{0.604804695f, 0.285420775f},
-std::array<float,2>{0.0630311146f, 0.654452026f},
-std::array<float,2>{0.234751567f, 0.420477122f},
-std::array<float,2>{0.677631974f, 0.579083204f},
-std::array<float,2>{0.841891348f, 0.0879459009f},
-std::array<float,2>{0.381048113f, 0.955988407f},
-std::array<float,2>{0.0619525649f, 0.00410462031f},
-std::array<float,2>{0.532162547f, 0.876975536f},
-std::array<float,2>{0.893069446f, 0.488695681f},
-std::array<float,2>{0.363075644f, 0.523597538f},
-std::array<float,2>{0.44190836f, 0.374109685f},
-std::array<float,2>{0.75409019f, 0.706884027f},
-std::array<float,2>{0.721328676f, 0.155830905f},
-std::array<float,2>{0.166932017f, 0.802866697f},
-std::array<float,2>{0.29174459f, 0.0489143506f},
-std::array<float,2>{0.992772162f, 0.935663044f},
-std::array<float,2>{0.613903821f, 0.44774583f},
-std::array<float,2>{0.0870250538f, 0.543336391f},
-std::array<float,2>{0.233515993f, 0.321200281f},
-std::array<float,2>{0.669775069f, 0.74333775f},
-std::array<float,2>{0.815548837f, 0.166516647f},
-std::array<float,2>{0.400833368f, 0.775045037f},
-std::array<float,2>{0.0400919169f, 0.2380867f},
-std::array<float,2>{0.552321434f, 0.843628764f},
-std::array<float,2>{0.883900583f, 0.272168219f},
-std::array<float,2>{0.349631071f, 0.672093391f},
-std::array<float,2>{0.464658588f, 0.382385015f},
-std::array<float,2>{0.769145429f, 0.611234009f},
-std::array<float,2>{0.735758424f, 0.0994458348f},
-std::array<float,2>{0.179687902f, 0.995625138f},
-std::array<float,2>{0.414333731f, 0.151060238f},
-std::array<float,2>{0.867512107f, 0.797707081f},
-std::array<float,2>{0.643492699f, 0.367313862f},
-std::array<float,2>{0.195120499f, 0.708279371f},
-std::array<float,2>{0.105239123f, 0.48519823f},
-std::array<float,2>{0.576126337f, 0.528682768f},
-std::array<float,2>{0.947303951f, 0.0017879121f},
-std::array<float,2>{0.267797112f, 0.880049229f},
-std::array<float,2>{0.148598284f, 0.0935381129f},
-std::array<float,2>{0.710307717f, 0.95891732f},
-std::array<float,2>{0.799819648f, 0.416594237f},
-std::array<float,2>{0.498483866f, 0.583285034f},
-std::array<float,2>{0.323839366f, 0.28508535f},
-std::array<float,2>{0.930511653f, 0.649378002f},
-std::array<float,2>{0.524109304f, 0.188670546f},
-std::array<float,2>{0.00149414479f, 0.853902817f},
-std::array<float,2>{0.480215847f, 0.113595776f},
-std::array<float,2>{0.787911773f, 0.983018875f},
-std::array<float,2>{0.699197352f, 0.402439713f},
-std::array<float,2>{0.13943252f, 0.607693136f},
-std::array<float,2>{0.0189021975f, 0.261412263f},
-std::array<float,2>{0.504149079f, 0.662762105f},
-std::array<float,2>{0.921224475f, 0.229452536f},
-std::array<float,2>{0.331384212f, 0.824363232f},
-std::array<float,2>{0.215255216f, 0.173433647f},
-std::array<float,2>{0.640287876f, 0.760464251f},
-std::array<float,2>{0.84988296f, 0.32866469f},
-std::array<float,2>{0.424655378f, 0.733991861f},
-std::array<float,2>{0.260936856f, 0.454972774f},
-std::array<float,2>{0.968119502f, 0.550447822f},
-std::array<float,2>{0.579342902f, 0.0335844569f},
-std::array<float,2>{0.120029502f, 0.917307734f},
-std::array<float,2>{0.367456615f, 0.210338324f},
-std::array<float,2>{0.902278841f, 0.867503226f},
-std::array<float,2>{0.544215262f, 0.309053242f},
-std::array<float,2>{0.0509500131f, 0.635165036f},
-std::array<float,2>{0.16301848f, 0.423134059f},
-std::array<float,2>{0.726862431f, 0.569473922f},
-std::array<float,2>{0.763140976f, 0.0744762048f},
-std::array<float,2>{0.44867149f, 0.942260802f},
-std::array<float,2>{0.0738534853f, 0.0163280722f},
-std::array<float,2>{0.601075053f, 0.897291422f},
-std::array<float,2>{0.971764922f, 0.479120195f},
-std::array<float,2>{0.309783518f, 0.506618917f},
-std::array<float,2>{0.384567201f, 0.354370534f},
-std::array<float,2>{0.8339203f, 0.700828493f},
-std::array<float,2>{0.685875416f, 0.128597081f},
-std::array<float,2>{0.245435238f, 0.789605498f},
-std::array<float,2>{0.341053009f, 0.0685091093f},
-std::array<float,2>{0.911935925f, 0.946561217f},
-std::array<float,2>{0.514652967f, 0.430539936f},
-std::array<float,2>{0.0310050305f, 0.576945484f},
-std::array<float,2>{0.129050344f, 0.304205537f},
-std::array<float,2>{0.689856172f, 0.625876367f},
-std::array<float,2>{0.794122458f, 0.217171222f},
-std::array<float,2>{0.468867183f, 0.863056898f},
-std::array<float,2>{0.111213066f, 0.13733381f},
-std::array<float,2>{0.589008927f, 0.785464048f},
-std::array<float,2>{0.954462171f, 0.347921014f},
-std::array<float,2>{0.256632596f, 0.692145884f},
-std::array<float,2>{0.431052953f, 0.471804827f},
-std::array<float,2>{0.852190077f, 0.514502883f},
-std::array<float,2>{0.627849519f, 0.0291278344f},
-std::array<float,2>{0.210332438f, 0.900229931f},
-std::array<float,2>{0.440964937f, 0.219561279f},
-std::array<float,2>{0.752754092f, 0.819156349f},
-std::array<float,2>{0.723469496f, 0.256532073f},
-std::array<float,2>{0.168888703f, 0.664695263f},
-std::array<float,2>{0.0550141782f, 0.390696108f},
-std::array<float,2>{0.538219988f, 0.594137371f},
-std::array<float,2>{0.896884382f, 0.123412125f},
-std::array<float,2>{0.364271313f, 0.971240342f},
-std::array<float,2>{0.240674317f, 0.0443183035f},
-std::array<float,2>{0.675224781f, 0.907642066f},
-std::array<float,2>{0.838296175f, 0.46307683f},
-std::array<float,2>{0.376666903f, 0.558316588f},
-std::array<float,2>{0.304132611f, 0.337633461f},
-std::array<float,2>{0.979649246f, 0.721355736f},
-std::array<float,2>{0.607818007f, 0.187354952f},
-std::array<float,2>{0.0689412877f, 0.754561365f},
-std::array<float,2>{0.394575357f, 0.00958417356f},
-std::array<float,2>{0.827001631f, 0.887044728f},
-std::array<float,2>{0.663225532f, 0.496064156f},
-std::array<float,2>{0.222280264f, 0.51701802f},
-std::array<float,2>{0.083546862f, 0.366112232f},
-std::array<float,2>{0.624733508f, 0.715963781f},
-std::array<float,2>{0.986035824f, 0.147898659f},
-std::array<float,2>{0.286689579f, 0.804718971f},
-std::array<float,2>{0.176497072f, 0.199269652f},
-std::array<float,2>{0.744472384f, 0.851251245f},
-std::array<float,2>{0.778053105f, 0.291368663f},
-std::array<float,2>{0.459098697f, 0.642700732f},
-std::array<float,2>{0.358999789f, 0.412119299f},
-std::array<float,2>{0.87735337f, 0.587649226f},
-std::array<float,2>{0.558958411f, 0.0821753889f},
-std::array<float,2>{0.0344124921f, 0.963351071f},
-std::array<float,2>{0.27539596f, 0.15856111f},
-std::array<float,2>{0.938732326f, 0.770480096f},
-std::array<float,2>{0.566322446f, 0.31935212f},
-std::array<float,2>{0.0965620205f, 0.739010751f},
-std::array<float,2>{0.202670395f, 0.442040592f},
-std::array<float,2>{0.649230838f, 0.53773433f},
-std::array<float,2>{0.863869369f, 0.0558451302f},
-std::array<float,2>{0.409446836f, 0.926164865f},
-std::array<float,2>{0.0100037325f, 0.103389353f},
-std::array<float,2>{0.519122839f, 0.987820089f},
-std::array<float,2>{0.923242986f, 0.388759434f},
-std::array<float,2>{0.313506395f, 0.617880285f},
-std::array<float,2>{0.488755107f, 0.274846733f},
-std::array<float,2>{0.807372332f, 0.683777452f},
-std::array<float,2>{0.714787364f, 0.246778771f},
-std::array<float,2>{0.142061442f, 0.829743981f},
-std::array<float,2>{0.253672868f, 0.0966013297f},
-std::array<float,2>{0.958274484f, 0.997742534f},
-std::array<float,2>{0.591604829f, 0.376616627f},
-std::array<float,2>{0.113764644f, 0.614423513f},
-std::array<float,2>{0.203868285f, 0.268344551f},
-std::array<float,2>{0.632125378f, 0.676475108f},
-std::array<float,2>{0.858416438f, 0.240141645f},
-std::array<float,2>{0.437241197f, 0.837184906f},
-std::array<float,2>{0.0264203474f, 0.168194562f},
-std::array<float,2>{0.508538306f, 0.778789222f},
-std::array<float,2>{0.909615457f, 0.3275989f},
-std::array<float,2>{0.338643104f, 0.748114586f},
-std::array<float,2>{0.475613236f, 0.450813234f},
-std::array<float,2>{0.791160107f, 0.540446699f},
-std::array<float,2>{0.692112625f, 0.0545752347f},
-std::array<float,2>{0.127739578f, 0.933504403f},
-std::array<float,2>{0.38144958f, 0.195253432f},
-std::array<float,2>{0.842451632f, 0.857375979f},
-std::array<float,2>{0.676802218f, 0.28829214f},
-std::array<float,2>{0.234927937f, 0.653025329f},
-std::array<float,2>{0.0628919601f, 0.418011963f},
-std::array<float,2>{0.605215967f, 0.580497086f},
-std::array<float,2>{0.981308699f, 0.0863306895f},
-std::array<float,2>{0.300516516f, 0.954472065f},
-std::array<float,2>{0.166243166f, 0.00769759854f},
-std::array<float,2>{0.721131623f, 0.87669909f},
-std::array<float,2>{0.754398167f, 0.49149394f},
-std::array<float,2>{0.441665888f, 0.526120424f},
-std::array<float,2>{0.362589389f, 0.373010606f},
-std::array<float,2>{0.893041313f, 0.704242647f},
-std::array<float,2>{0.531393588f, 0.152592853f},
-std::array<float,2>{0.0620350726f, 0.801998138f},
-std::array<float,2>{0.456661642f, 0.0384118371f},
-std::array<float,2>{0.775360763f, 0.920144141f},
-std::array<float,2>{0.747816443f, 0.460695535f},
-std::array<float,2>{0.172903165f, 0.551115394f},
-std::array<float,2>{0.0376628414f, 0.334840834f},
-std::array<float,2>{0.558113873f, 0.728783965f},
-std::array<float,2>{0.882601738f, 0.176132843f},
-std::array<float,2>{0.351617247f, 0.762211025f},
-std::array<float,2>{0.222751394f, 0.230566651f},
-std::array<float,2>{0.659568787f, 0.823828816f},
-std::array<float,2>{0.82310009f, 0.261799276f},
-std::array<float,2>{0.391234189f, 0.658449888f},
-std::array<float,2>{0.284729987f, 0.401693702f},
-std::array<float,2>{0.990108132f, 0.601953566f},
-std::array<float,2>{0.620774865f, 0.111166291f},
-std::array<float,2>{0.0804753825f, 0.978837907f},
-std::array<float,2>{0.318776011f, 0.130001754f},
-std::array<float,2>{0.927365482f, 0.795987546f},
-std::array<float,2>{0.520617247f, 0.35710004f},
-std::array<float,2>{0.0150570273f, 0.695593596f},
-std::array<float,2>{0.147272423f, 0.48394531f},
-std::array<float,2>{0.715233445f, 0.501056314f},
-std::array<float,2>{0.810186148f, 0.0231455658f},
-std::array<float,2>{0.486296326f, 0.89238143f},
-std::array<float,2>{0.100526072f, 0.0710314736f},
-std::array<float,2>{0.569588423f, 0.938581884f},
-std::array<float,2>{0.942843914f, 0.426129133f},
-std::array<float,2>{0.280284911f, 0.562555552f},
-std::array<float,2>{0.411802918f, 0.307142079f},
-std::array<float,2>{0.86286968f, 0.639925778f},
-std::array<float,2>{0.655165911f, 0.206885546f},
-std::array<float,2>{0.198640585f, 0.873431265f},
-std::array<float,2>{0.345840693f, 0.0237205625f},
-std::array<float,2>{0.890271425f, 0.904536724f},
-std::array<float,2>{0.547212422f, 0.47602725f},
-std::array<float,2>{0.0458260924f, 0.510787427f},
-std::array<float,2>{0.184184924f, 0.344557315f},
-std::array<float,2>{0.73964119f, 0.687522292f},
-std::array<float,2>{0.771778762f, 0.135948807f},
-std::array<float,2>{0.466562867f, 0.783033788f},
-std::array<float,2>{0.0934865847f, 0.212402016f},
-std::array<float,2>{0.61256057f, 0.865293086f},
-std::array<float,2>{0.997598171f, 0.298514992f},
-std::array<float,2>{0.294846952f, 0.630145133f},
-std::array<float,2>{0.403824389f, 0.435419649f},
-std::array<float,2>{0.816553712f, 0.572901964f},
-std::array<float,2>{0.666417956f, 0.063813895f},
-std::array<float,2>{0.227047354f, 0.951314092f},
-std::array<float,2>{0.49224183f, 0.181862518f},
-std::array<float,2>{0.803539693f, 0.752151668f},
-std::array<float,2>{0.707004726f, 0.341814786f},
-std::array<float,2>{0.155737147f, 0.72408855f},
-std::array<float,2>{0.00427551055f, 0.465468526f},
-std::array<float,2>{0.529722273f, 0.561512291f},
-std::array<float,2>{0.935448587f, 0.03924435f},
-std::array<float,2>{0.32703048f, 0.912675381f},
-std::array<float,2>{0.18770884f, 0.120198406f},
-std::array<float,2>{0.646195471f, 0.97321713f},
-std::array<float,2>{0.87116307f, 0.397109598f},
-std::array<float,2>{0.420346469f, 0.601255417f},
-std::array<float,2>{0.272429585f, 0.252175421f},
-std::array<float,2>{0.951561689f, 0.670120299f},
-std::array<float,2>{0.571174145f, 0.223743185f},
-std::array<float,2>{0.105732299f, 0.814085484f},
-std::array<float,2>{0.429293513f, 0.0811280906f},
-std::array<float,2>{0.847145736f, 0.96754086f},
-std::array<float,2>{0.635532916f, 0.40805456f},
-std::array<float,2>{0.214194342f, 0.591053605f},
-std::array<float,2>{0.124633618f, 0.293315977f},
-std::array<float,2>{0.585438251f, 0.648109734f},
-std::array<float,2>{0.962811053f, 0.196601227f},
-std::array<float,2>{0.262407094f, 0.844680607f},
-std::array<float,2>{0.134496659f, 0.143227369f},
-std::array<float,2>{0.699692607f, 0.811453938f},
-std::array<float,2>{0.781704783f, 0.359691352f},
-std::array<float,2>{0.481965154f, 0.712240756f},
-std::array<float,2>{0.333867162f, 0.498409778f},
-std::array<float,2>{0.915327907f, 0.519879937f},
-std::array<float,2>{0.500182927f, 0.0134192817f},
-std::array<float,2>{0.0215038676f, 0.886458516f},
-std::array<float,2>{0.308586717f, 0.246028498f},
-std::array<float,2>{0.976547718f, 0.834254086f},
-std::array<float,2>{0.594437718f, 0.279926986f},
-std::array<float,2>{0.0748719797f, 0.680789471f},
-std::array<float,2>{0.246325642f, 0.383568436f},
-std::array<float,2>{0.681621969f, 0.624085665f},
-std::array<float,2>{0.829908788f, 0.107205614f},
-std::array<float,2>{0.390480042f, 0.990983427f},
-std::array<float,2>{0.0489613079f, 0.0590833202f},
-std::array<float,2>{0.541139424f, 0.922722399f},
-std::array<float,2>{0.904826045f, 0.439780384f},
-std::array<float,2>{0.373040497f, 0.53330034f},
-std::array<float,2>{0.450848699f, 0.315205157f},
-std::array<float,2>{0.759773612f, 0.735388517f},
-std::array<float,2>{0.733599305f, 0.163344145f},
-std::array<float,2>{0.159675822f, 0.766386151f},
-std::array<float,2>{0.266549855f, 0.00382587803f},
-std::array<float,2>{0.946638227f, 0.882294834f},
-std::array<float,2>{0.577867687f, 0.487219334f},
-std::array<float,2>{0.103124157f, 0.530526161f},
-std::array<float,2>{0.191957042f, 0.370266229f},
-std::array<float,2>{0.641248524f, 0.710204303f},
-std::array<float,2>{0.869888425f, 0.150313661f},
-std::array<float,2>{0.417507619f, 0.79939872f},
-std::array<float,2>{0.00342012243f, 0.190711722f},
-std::array<float,2>{0.526577353f, 0.852916837f},
-std::array<float,2>{0.932080209f, 0.281780392f},
-std::array<float,2>{0.32178393f, 0.651000023f},
-std::array<float,2>{0.49769032f, 0.414626807f},
-std::array<float,2>{0.797210932f, 0.584679723f},
-std::array<float,2>{0.707552969f, 0.0914875865f},
-std::array<float,2>{0.150510371f, 0.959961355f},
-std::array<float,2>{0.399442703f, 0.165292084f},
-std::array<float,2>{0.812814772f, 0.775878191f},
-std::array<float,2>{0.67061621f, 0.323932052f},
-std::array<float,2>{0.23108238f, 0.744199753f},
-std::array<float,2>{0.0893218666f, 0.44713375f},
-std::array<float,2>{0.615802407f, 0.546349883f},
-std::array<float,2>{0.994640112f, 0.0487977974f},
-std::array<float,2>{0.289084494f, 0.934451699f},
-std::array<float,2>{0.18234916f, 0.101488709f},
-std::array<float,2>{0.736493766f, 0.99246192f},
-std::array<float,2>{0.767511249f, 0.379801482f},
-std::array<float,2>{0.461897135f, 0.611525834f},
-std::array<float,2>{0.347858429f, 0.27095446f},
-std::array<float,2>{0.886509538f, 0.67433697f},
-std::array<float,2>{0.553614795f, 0.235883996f},
-std::array<float,2>{0.0414953791f, 0.840168715f},
-std::array<float,2>{0.445369154f, 0.0778147802f},
-std::array<float,2>{0.763981998f, 0.943412364f},
-std::array<float,2>{0.729037821f, 0.424405247f},
-std::array<float,2>{0.161155894f, 0.566663861f},
-std::array<float,2>{0.0528843291f, 0.311365098f},
-std::array<float,2>{0.545154691f, 0.634475112f},
-std::array<float,2>{0.898770392f, 0.20829545f},
-std::array<float,2>{0.36955446f, 0.869568348f},
-std::array<float,2>{0.243621677f, 0.126883835f},
-std::array<float,2>{0.683786213f, 0.791407645f},
-std::array<float,2>{0.835125506f, 0.352776647f},
-std::array<float,2>{0.38538146f, 0.702993095f},
-std::array<float,2>{0.311493903f, 0.477849096f},
-std::array<float,2>{0.970227599f, 0.504665315f},
-std::array<float,2>{0.598232031f, 0.0194504093f},
-std::array<float,2>{0.0710266307f, 0.89605391f},
-std::array<float,2>{0.329735428f, 0.228508621f},
-std::array<float,2>{0.918382883f, 0.827841997f},
-std::array<float,2>{0.50736928f, 0.258542329f},
-std::array<float,2>{0.0169343669f, 0.661615133f},
-std::array<float,2>{0.137540609f, 0.405333668f},
-std::array<float,2>{0.696926475f, 0.606739879f},
-std::array<float,2>{0.785668969f, 0.117109112f},
-std::array<float,2>{0.477996558f, 0.981724143f},
-std::array<float,2>{0.119045936f, 0.0317696817f},
-std::array<float,2>{0.581264019f, 0.915979087f},
-std::array<float,2>{0.966234207f, 0.456555992f},
-std::array<float,2>{0.258966953f, 0.547049582f},
-std::array<float,2>{0.422491968f, 0.332025647f},
-std::array<float,2>{0.849439859f, 0.730576754f},
-std::array<float,2>{0.638250291f, 0.17546165f},
-std::array<float,2>{0.217126384f, 0.759544551f},
-std::array<float,2>{0.36556074f, 0.122726761f},
-std::array<float,2>{0.896328986f, 0.969329178f},
-std::array<float,2>{0.535708964f, 0.39344123f},
-std::array<float,2>{0.0573188253f, 0.59617275f},
-std::array<float,2>{0.170153946f, 0.255015194f},
-std::array<float,2>{0.726295352f, 0.667484462f},
-std::array<float,2>{0.751622498f, 0.221657038f},
-std::array<float,2>{0.439028621f, 0.816967428f},
-std::array<float,2>{0.0681562647f, 0.183668897f},
-std::array<float,2>{0.606581926f, 0.757254779f},
-std::array<float,2>{0.976769984f, 0.339790761f},
-std::array<float,2>{0.302714705f, 0.720145643f},
-std::array<float,2>{0.377053618f, 0.462623924f},
-std::array<float,2>{0.836549759f, 0.555461526f},
-std::array<float,2>{0.672671854f, 0.0463000275f},
-std::array<float,2>{0.240169555f, 0.908900142f},
-std::array<float,2>{0.471358031f, 0.216608331f},
-std::array<float,2>{0.796848297f, 0.860361338f},
-std::array<float,2>{0.688372433f, 0.302654982f},
-std::array<float,2>{0.130866647f, 0.627924204f},
-std::array<float,2>{0.0283229891f, 0.433485568f},
-std::array<float,2>{0.513119936f, 0.574331284f},
-std::array<float,2>{0.912494957f, 0.0678660795f},
-std::array<float,2>{0.342859685f, 0.948675752f},
-std::array<float,2>{0.20769684f, 0.0293092337f},
-std::array<float,2>{0.625065267f, 0.900402009f},
-std::array<float,2>{0.853944659f, 0.469286859f},
-std::array<float,2>{0.432850599f, 0.513128757f},
-std::array<float,2>{0.254063398f, 0.350725532f},
-std::array<float,2>{0.95692569f, 0.694168031f},
-std::array<float,2>{0.58675456f, 0.1402978f},
-std::array<float,2>{0.111465976f, 0.787985921f},
-std::array<float,2>{0.40775463f, 0.057164602f},
-std::array<float,2>{0.867175281f, 0.928045928f},
-std::array<float,2>{0.650396407f, 0.443992049f},
-std::array<float,2>{0.199541837f, 0.535321116f},
-std::array<float,2>{0.0939328596f, 0.318048894f},
-std::array<float,2>{0.563832402f, 0.741803944f},
-std::array<float,2>{0.941146255f, 0.156752095f},
-std::array<float,2>{0.273625761f, 0.772577047f},
-std::array<float,2>{0.142615929f, 0.249635831f},
-std::array<float,2>{0.712638915f, 0.831790566f},
-std::array<float,2>{0.805973291f, 0.27562806f},
-std::array<float,2>{0.491936117f, 0.687140346f},
-std::array<float,2>{0.31637165f, 0.387718439f},
-std::array<float,2>{0.924345076f, 0.619877219f},
-std::array<float,2>{0.516988337f, 0.105042838f},
-std::array<float,2>{0.00853352435f, 0.984925628f},
-std::array<float,2>{0.287410259f, 0.145999879f},
-std::array<float,2>{0.986745179f, 0.807995975f},
-std::array<float,2>{0.622323751f, 0.364689678f},
-std::array<float,2>{0.0857863948f, 0.716994822f},
-std::array<float,2>{0.220137104f, 0.493567646f},
-std::array<float,2>{0.661115468f, 0.517590821f},
-std::array<float,2>{0.82433486f, 0.0109512294f},
-std::array<float,2>{0.398374647f, 0.88998276f},
-std::array<float,2>{0.0320460051f, 0.0854810849f},
-std::array<float,2>{0.562459052f, 0.962868571f},
-std::array<float,2>{0.875894904f, 0.410309613f},
-std::array<float,2>{0.355765611f, 0.589508772f},
-std::array<float,2>{0.4576011f, 0.290676802f},
-std::array<float,2>{0.779428542f, 0.641425371f},
-std::array<float,2>{0.74231416f, 0.202737689f},
-std::array<float,2>{0.179601461f, 0.848555148f},
-std::array<float,2>{0.297681779f, 0.0887823552f},
-std::array<float,2>{0.98345983f, 0.955094278f},
-std::array<float,2>{0.602787971f, 0.420304239f},
-std::array<float,2>{0.0646488965f, 0.578156829f},
-std::array<float,2>{0.236337736f, 0.285997331f},
-std::array<float,2>{0.679439962f, 0.654932678f},
-std::array<float,2>{0.841204345f, 0.192233697f},
-std::array<float,2>{0.380424172f, 0.858058035f},
-std::array<float,2>{0.0595552847f, 0.155355409f},
-std::array<float,2>{0.533398867f, 0.803234518f},
-std::array<float,2>{0.892340779f, 0.3745417f},
-std::array<float,2>{0.360108912f, 0.706359625f},
-std::array<float,2>{0.444553584f, 0.488914073f},
-std::array<float,2>{0.757227182f, 0.524358392f},
-std::array<float,2>{0.719516277f, 0.00456172088f},
-std::array<float,2>{0.16439949f, 0.877816677f},
-std::array<float,2>{0.434274703f, 0.241464496f},
-std::array<float,2>{0.855952621f, 0.838616312f},
-std::array<float,2>{0.630767524f, 0.26712954f},
-std::array<float,2>{0.205547675f, 0.679114699f},
-std::array<float,2>{0.116728492f, 0.377246052f},
-std::array<float,2>{0.593555391f, 0.616898715f},
-std::array<float,2>{0.960741818f, 0.0939710811f},
-std::array<float,2>{0.251090705f, 0.998367906f},
-std::array<float,2>{0.125540823f, 0.0517820865f},
-std::array<float,2>{0.694251239f, 0.930324614f},
-std::array<float,2>{0.790766358f, 0.451759249f},
-std::array<float,2>{0.472805351f, 0.541565359f},
-std::array<float,2>{0.335960269f, 0.324920446f},
-std::array<float,2>{0.908085763f, 0.747171938f},
-std::array<float,2>{0.509950161f, 0.171607822f},
-std::array<float,2>{0.0237062499f, 0.78034842f},
-std::array<float,2>{0.487737477f, 0.020731343f},
-std::array<float,2>{0.811269224f, 0.893101573f},
-std::array<float,2>{0.717500746f, 0.481591105f},
-std::array<float,2>{0.144692555f, 0.503028095f},
-std::array<float,2>{0.0135291424f, 0.357638985f},
-std::array<float,2>{0.522376239f, 0.697536647f},
-std::array<float,2>{0.929466844f, 0.131984785f},
-std::array<float,2>{0.318348378f, 0.794343233f},
-std::array<float,2>{0.196362704f, 0.204134524f},
-std::array<float,2>{0.65268153f, 0.871536374f},
-std::array<float,2>{0.860934913f, 0.304998964f},
-std::array<float,2>{0.413501084f, 0.637014091f},
-std::array<float,2>{0.27915591f, 0.428097069f},
-std::array<float,2>{0.943812847f, 0.565592587f},
-std::array<float,2>{0.568005145f, 0.0735750198f},
-std::array<float,2>{0.0985070094f, 0.940083086f},
-std::array<float,2>{0.354900837f, 0.177876979f},
-std::array<float,2>{0.880105734f, 0.764454603f},
-std::array<float,2>{0.555047572f, 0.332540363f},
-std::array<float,2>{0.0363037214f, 0.726688504f},
-std::array<float,2>{0.174233899f, 0.458143145f},
-std::array<float,2>{0.749509513f, 0.552833498f},
-std::array<float,2>{0.777270734f, 0.0362467095f},
-std::array<float,2>{0.453884989f, 0.919484854f},
-std::array<float,2>{0.0784228742f, 0.113259703f},
-std::array<float,2>{0.618045688f, 0.977344751f},
-std::array<float,2>{0.99053061f, 0.39945507f},
-std::array<float,2>{0.282235712f, 0.60456425f},
-std::array<float,2>{0.394528091f, 0.264675677f},
-std::array<float,2>{0.822036982f, 0.65754813f},
-std::array<float,2>{0.656627238f, 0.23432219f},
-std::array<float,2>{0.224963635f, 0.821060121f},
-std::array<float,2>{0.325547248f, 0.0423008651f},
-std::array<float,2>{0.937256217f, 0.910426915f},
-std::array<float,2>{0.52882874f, 0.467553854f},
-std::array<float,2>{0.00594161823f, 0.559610546f},
-std::array<float,2>{0.152423441f, 0.33996442f},
-std::array<float,2>{0.705016613f, 0.725599229f},
-std::array<float,2>{0.802631319f, 0.180822387f},
-std::array<float,2>{0.494701892f, 0.750072896f},
-std::array<float,2>{0.108838931f, 0.226290703f},
-std::array<float,2>{0.573726177f, 0.815067291f},
-std::array<float,2>{0.951053083f, 0.250529945f},
-std::array<float,2>{0.270725071f, 0.668496728f},
-std::array<float,2>{0.419246495f, 0.396314323f},
-std::array<float,2>{0.874983788f, 0.598576486f},
-std::array<float,2>{0.648379326f, 0.118465044f},
-std::array<float,2>{0.189453155f, 0.975255966f},
-std::array<float,2>{0.46740675f, 0.134083748f},
-std::array<float,2>{0.77104944f, 0.783587992f},
-std::array<float,2>{0.741590261f, 0.346492082f},
-std::array<float,2>{0.18705143f, 0.691250801f},
-std::array<float,2>{0.0432002582f, 0.474577993f},
-std::array<float,2>{0.550404489f, 0.509601951f},
-std::array<float,2>{0.887787223f, 0.0263180528f},
-std::array<float,2>{0.345676422f, 0.903671801f},
-std::array<float,2>{0.229331002f, 0.0660069957f},
-std::array<float,2>{0.665359199f, 0.950947583f},
-std::array<float,2>{0.818534136f, 0.436641008f},
-std::array<float,2>{0.40504986f, 0.57135576f},
-std::array<float,2>{0.295547634f, 0.300090045f},
-std::array<float,2>{0.998047531f, 0.631426871f},
-std::array<float,2>{0.611077547f, 0.213916168f},
-std::array<float,2>{0.0907255039f, 0.864569247f},
-std::array<float,2>{0.387965918f, 0.107954793f},
-std::array<float,2>{0.831461251f, 0.989202559f},
-std::array<float,2>{0.681794405f, 0.385897875f},
-std::array<float,2>{0.249769002f, 0.621448219f},
-std::array<float,2>{0.0778666735f, 0.277372897f},
-std::array<float,2>{0.597466052f, 0.683164477f},
-std::array<float,2>{0.974014461f, 0.243577674f},
-std::array<float,2>{0.305040658f, 0.833511055f},
-std::array<float,2>{0.156604484f, 0.160804152f},
-std::array<float,2>{0.731841445f, 0.768262565f},
-std::array<float,2>{0.75962323f, 0.314157039f},
-std::array<float,2>{0.451659232f, 0.738222241f},
-std::array<float,2>{0.374896824f, 0.439368218f},
-std::array<float,2>{0.902844012f, 0.532799363f},
-std::array<float,2>{0.540847659f, 0.0620474219f},
-std::array<float,2>{0.0486673452f, 0.925764441f},
-std::array<float,2>{0.264387161f, 0.198055804f},
-std::array<float,2>{0.964735031f, 0.845798135f},
-std::array<float,2>{0.583961129f, 0.295581788f},
-std::array<float,2>{0.121767297f, 0.645988762f},
-std::array<float,2>{0.211424842f, 0.409775883f},
-std::array<float,2>{0.633194149f, 0.592421412f},
-std::array<float,2>{0.844660878f, 0.079775542f},
-std::array<float,2>{0.426453829f, 0.965483844f},
-std::array<float,2>{0.0205750298f, 0.0138682928f},
-std::array<float,2>{0.502863288f, 0.884312809f},
-std::array<float,2>{0.917018235f, 0.497751862f},
-std::array<float,2>{0.335146576f, 0.522997975f},
-std::array<float,2>{0.482634634f, 0.363099664f},
-std::array<float,2>{0.784311473f, 0.714703977f},
-std::array<float,2>{0.702529788f, 0.142114699f},
-std::array<float,2>{0.135209769f, 0.810291708f},
-std::array<float,2>{0.258319467f, 0.0348921046f},
-std::array<float,2>{0.965305209f, 0.916482627f},
-std::array<float,2>{0.580493212f, 0.45347023f},
-std::array<float,2>{0.117390312f, 0.549604475f},
-std::array<float,2>{0.218252853f, 0.329712212f},
-std::array<float,2>{0.637358665f, 0.73295486f},
-std::array<float,2>{0.847948253f, 0.171889931f},
-std::array<float,2>{0.423285514f, 0.761340022f},
-std::array<float,2>{0.0160952285f, 0.229835823f},
-std::array<float,2>{0.506124079f, 0.825195968f},
-std::array<float,2>{0.919525146f, 0.260506421f},
-std::array<float,2>{0.328456521f, 0.663315535f},
-std::array<float,2>{0.476930857f, 0.404199064f},
-std::array<float,2>{0.787086964f, 0.608806789f},
-std::array<float,2>{0.695405185f, 0.114636585f},
-std::array<float,2>{0.137841716f, 0.984246373f},
-std::array<float,2>{0.385766566f, 0.127303123f},
-std::array<float,2>{0.834058344f, 0.790388584f},
-std::array<float,2>{0.685504675f, 0.35488826f},
-std::array<float,2>{0.242210999f, 0.699601293f},
-std::array<float,2>{0.071436204f, 0.480116785f},
-std::array<float,2>{0.599496841f, 0.507122993f},
-std::array<float,2>{0.968751848f, 0.0167918094f},
-std::array<float,2>{0.312117904f, 0.897494316f},
-std::array<float,2>{0.160417318f, 0.0753300041f},
-std::array<float,2>{0.730453372f, 0.942764938f},
-std::array<float,2>{0.765323818f, 0.422816008f},
-std::array<float,2>{0.446407557f, 0.568757355f},
-std::array<float,2>{0.37021023f, 0.309829533f},
-std::array<float,2>{0.899620712f, 0.636657536f},
-std::array<float,2>{0.546294451f, 0.209581539f},
-std::array<float,2>{0.053879112f, 0.869015455f},
-std::array<float,2>{0.462051153f, 0.0976810455f},
-std::array<float,2>{0.765936553f, 0.994704604f},
-std::array<float,2>{0.737887681f, 0.381754458f},
-std::array<float,2>{0.183182403f, 0.609502614f},
-std::array<float,2>{0.0422818623f, 0.273082346f},
-std::array<float,2>{0.554180145f, 0.673493505f},
-std::array<float,2>{0.884835958f, 0.236332074f},
-std::array<float,2>{0.348724365f, 0.84263438f},
-std::array<float,2>{0.231589049f, 0.167707235f},
-std::array<float,2>{0.671443701f, 0.77400738f},
-std::array<float,2>{0.813558102f, 0.321520627f},
-std::array<float,2>{0.399319261f, 0.743063927f},
-std::array<float,2>{0.290890276f, 0.448639125f},
-std::array<float,2>{0.995966315f, 0.544076681f},
-std::array<float,2>{0.616932929f, 0.0507031381f},
-std::array<float,2>{0.0886704177f, 0.936616302f},
-std::array<float,2>{0.320416927f, 0.188206762f},
-std::array<float,2>{0.932870924f, 0.854768634f},
-std::array<float,2>{0.525581241f, 0.283806115f},
-std::array<float,2>{0.00275055016f, 0.649762511f},
-std::array<float,2>{0.152056664f, 0.417056471f},
-std::array<float,2>{0.708649814f, 0.582797408f},
-std::array<float,2>{0.797907114f, 0.0927726179f},
-std::array<float,2>{0.496961743f, 0.957795501f},
-std::array<float,2>{0.102161624f, 0.000488394173f},
-std::array<float,2>{0.57684797f, 0.879726887f},
-std::array<float,2>{0.945704281f, 0.485785604f},
-std::array<float,2>{0.266677648f, 0.52803278f},
-std::array<float,2>{0.416016579f, 0.368337154f},
-std::array<float,2>{0.870604515f, 0.707505167f},
-std::array<float,2>{0.64196527f, 0.1515885f},
-std::array<float,2>{0.192417741f, 0.798644423f},
-std::array<float,2>{0.356451273f, 0.0830905139f},
-std::array<float,2>{0.876007915f, 0.964156747f},
-std::array<float,2>{0.56145829f, 0.413206935f},
-std::array<float,2>{0.0330578163f, 0.586532891f},
-std::array<float,2>{0.17818521f, 0.292791665f},
-std::array<float,2>{0.74372226f, 0.64375037f},
-std::array<float,2>{0.780845404f, 0.200422123f},
-std::array<float,2>{0.458359987f, 0.849763453f},
-std::array<float,2>{0.0848849937f, 0.147269517f},
-std::array<float,2>{0.62185061f, 0.806095064f},
-std::array<float,2>{0.987817287f, 0.366363704f},
-std::array<float,2>{0.288448781f, 0.715549111f},
-std::array<float,2>{0.397148758f, 0.49490726f},
-std::array<float,2>{0.826021075f, 0.515899301f},
-std::array<float,2>{0.661707163f, 0.00845096633f},
-std::array<float,2>{0.219146743f, 0.888257921f},
-std::array<float,2>{0.491194457f, 0.247210816f},
-std::array<float,2>{0.805371821f, 0.82816565f},
-std::array<float,2>{0.711055279f, 0.273696929f},
-std::array<float,2>{0.143577605f, 0.685346127f},
-std::array<float,2>{0.00954548083f, 0.389780849f},
-std::array<float,2>{0.515882969f, 0.618210852f},
-std::array<float,2>{0.924997628f, 0.102317877f},
-std::array<float,2>{0.314461261f, 0.986885309f},
-std::array<float,2>{0.200770393f, 0.0548313074f},
-std::array<float,2>{0.651537359f, 0.926893353f},
-std::array<float,2>{0.865955114f, 0.442602187f},
-std::array<float,2>{0.4063977f, 0.538192809f},
-std::array<float,2>{0.274675161f, 0.319214374f},
-std::array<float,2>{0.939954877f, 0.739304841f},
-std::array<float,2>{0.563429058f, 0.159461722f},
-std::array<float,2>{0.0949878246f, 0.771020293f},
-std::array<float,2>{0.432029366f, 0.0277925432f},
-std::array<float,2>{0.855034173f, 0.899098635f},
-std::array<float,2>{0.626910388f, 0.470924497f},
-std::array<float,2>{0.208021283f, 0.515216827f},
-std::array<float,2>{0.112633899f, 0.348878056f},
-std::array<float,2>{0.587522745f, 0.693338692f},
-std::array<float,2>{0.955699563f, 0.137721211f},
-std::array<float,2>{0.255366415f, 0.787056327f},
-std::array<float,2>{0.132752031f, 0.2182028f},
-std::array<float,2>{0.68940115f, 0.862295568f},
-std::array<float,2>{0.7957955f, 0.303337008f},
-std::array<float,2>{0.471916616f, 0.62641567f},
-std::array<float,2>{0.342007428f, 0.430710495f},
-std::array<float,2>{0.913156569f, 0.577853978f},
-std::array<float,2>{0.51215744f, 0.0700134933f},
-std::array<float,2>{0.0279004518f, 0.945594549f},
-std::array<float,2>{0.301334918f, 0.185735524f},
-std::array<float,2>{0.978049874f, 0.755187273f},
-std::array<float,2>{0.605907321f, 0.336403668f},
-std::array<float,2>{0.0666455999f, 0.722512066f},
-std::array<float,2>{0.238333851f, 0.464748621f},
-std::array<float,2>{0.67376864f, 0.557421565f},
-std::array<float,2>{0.837629795f, 0.0435370021f},
-std::array<float,2>{0.378753394f, 0.907146454f},
-std::array<float,2>{0.0577891506f, 0.124748498f},
-std::array<float,2>{0.536841035f, 0.97253412f},
-std::array<float,2>{0.894953489f, 0.392170459f},
-std::array<float,2>{0.366647243f, 0.595695198f},
-std::array<float,2>{0.437978595f, 0.257228673f},
-std::array<float,2>{0.750430107f, 0.665997624f},
-std::array<float,2>{0.725317538f, 0.220496267f},
-std::array<float,2>{0.17185697f, 0.819720209f},
-std::array<float,2>{0.28194648f, 0.110168606f},
-std::array<float,2>{0.992169678f, 0.98046577f},
-std::array<float,2>{0.618228912f, 0.40072456f},
-std::array<float,2>{0.0797531977f, 0.602637112f},
-std::array<float,2>{0.226359874f, 0.263652056f},
-std::array<float,2>{0.657807231f, 0.660130799f},
-std::array<float,2>{0.820555925f, 0.231490538f},
-std::array<float,2>{0.39287281f, 0.822852731f},
-std::array<float,2>{0.035969574f, 0.177240029f},
-std::array<float,2>{0.555682182f, 0.763095498f},
-std::array<float,2>{0.879530847f, 0.335889488f},
-std::array<float,2>{0.354374677f, 0.729667842f},
-std::array<float,2>{0.454771966f, 0.459850788f},
-std::array<float,2>{0.775941908f, 0.552385807f},
-std::array<float,2>{0.748180866f, 0.0371407382f},
-std::array<float,2>{0.174849033f, 0.921373069f},
-std::array<float,2>{0.412205547f, 0.205343381f},
-std::array<float,2>{0.860189378f, 0.874811232f},
-std::array<float,2>{0.653382301f, 0.308463305f},
-std::array<float,2>{0.195621938f, 0.638968587f},
-std::array<float,2>{0.0990251154f, 0.426794589f},
-std::array<float,2>{0.566812098f, 0.563923359f},
-std::array<float,2>{0.944401205f, 0.0717293397f},
-std::array<float,2>{0.278047919f, 0.938472033f},
-std::array<float,2>{0.146431789f, 0.0223862268f},
-std::array<float,2>{0.718359113f, 0.890920043f},
-std::array<float,2>{0.812007427f, 0.482566655f},
-std::array<float,2>{0.486537099f, 0.500800073f},
-std::array<float,2>{0.317053199f, 0.355930328f},
-std::array<float,2>{0.928154707f, 0.696632326f},
-std::array<float,2>{0.523380399f, 0.129415125f},
-std::array<float,2>{0.0125392675f, 0.795696735f},
-std::array<float,2>{0.474147558f, 0.0536441021f},
-std::array<float,2>{0.789382696f, 0.932185054f},
-std::array<float,2>{0.69518131f, 0.449959666f},
-std::array<float,2>{0.126896083f, 0.539092481f},
-std::array<float,2>{0.0249920394f, 0.327106267f},
-std::array<float,2>{0.510876596f, 0.749377131f},
-std::array<float,2>{0.907159865f, 0.169495195f},
-std::array<float,2>{0.337061763f, 0.778057814f},
-std::array<float,2>{0.206318289f, 0.239242405f},
-std::array<float,2>{0.629174948f, 0.836259365f},
-std::array<float,2>{0.85680151f, 0.269079864f},
-std::array<float,2>{0.43532449f, 0.676902592f},
-std::array<float,2>{0.25068751f, 0.375840247f},
-std::array<float,2>{0.959581256f, 0.613550305f},
-std::array<float,2>{0.591804802f, 0.0974023938f},
-std::array<float,2>{0.115849666f, 0.996209741f},
-std::array<float,2>{0.360386908f, 0.153892994f},
-std::array<float,2>{0.891474247f, 0.80131191f},
-std::array<float,2>{0.534478188f, 0.37188673f},
-std::array<float,2>{0.0601121373f, 0.703346491f},
-std::array<float,2>{0.165814251f, 0.49094981f},
-std::array<float,2>{0.720614552f, 0.526425242f},
-std::array<float,2>{0.756094038f, 0.0065159658f},
-std::array<float,2>{0.444299042f, 0.87596786f},
-std::array<float,2>{0.0658900365f, 0.0877223685f},
-std::array<float,2>{0.601956308f, 0.953214169f},
-std::array<float,2>{0.982740402f, 0.419120491f},
-std::array<float,2>{0.298041701f, 0.581524312f},
-std::array<float,2>{0.379351795f, 0.287489712f},
-std::array<float,2>{0.840015829f, 0.653877616f},
-std::array<float,2>{0.67789501f, 0.193999872f},
-std::array<float,2>{0.238115802f, 0.855540812f},
-std::array<float,2>{0.334103465f, 0.0118744215f},
-std::array<float,2>{0.916972935f, 0.885311425f},
-std::array<float,2>{0.503205061f, 0.499480516f},
-std::array<float,2>{0.0197500158f, 0.520817578f},
-std::array<float,2>{0.13667348f, 0.360744268f},
-std::array<float,2>{0.702093244f, 0.711275697f},
-std::array<float,2>{0.783387959f, 0.144039497f},
-std::array<float,2>{0.484223068f, 0.812165141f},
-std::array<float,2>{0.12231309f, 0.195851013f},
-std::array<float,2>{0.58299911f, 0.845598876f},
-std::array<float,2>{0.963045716f, 0.294089109f},
-std::array<float,2>{0.265207916f, 0.646614254f},
-std::array<float,2>{0.427366644f, 0.406761229f},
-std::array<float,2>{0.844995081f, 0.590523005f},
-std::array<float,2>{0.63424319f, 0.0801740587f},
-std::array<float,2>{0.212652788f, 0.968672752f},
-std::array<float,2>{0.452295542f, 0.162192941f},
-std::array<float,2>{0.758418739f, 0.766918242f},
-std::array<float,2>{0.730636954f, 0.315525025f},
-std::array<float,2>{0.157384142f, 0.734743714f},
-std::array<float,2>{0.0473758429f, 0.441367954f},
-std::array<float,2>{0.539647639f, 0.534632742f},
-std::array<float,2>{0.903337121f, 0.0598907135f},
-std::array<float,2>{0.373240352f, 0.92312479f},
-std::array<float,2>{0.248589948f, 0.105737291f},
-std::array<float,2>{0.682827294f, 0.991746485f},
-std::array<float,2>{0.830896854f, 0.383915871f},
-std::array<float,2>{0.387500226f, 0.623347878f},
-std::array<float,2>{0.306257218f, 0.280974388f},
-std::array<float,2>{0.97356075f, 0.680450559f},
-std::array<float,2>{0.595814288f, 0.244405463f},
-std::array<float,2>{0.0762797296f, 0.835124075f},
-std::array<float,2>{0.405774772f, 0.0629681647f},
-std::array<float,2>{0.819421351f, 0.952170789f},
-std::array<float,2>{0.664739132f, 0.434143692f},
-std::array<float,2>{0.229742274f, 0.573824048f},
-std::array<float,2>{0.0912542567f, 0.297145367f},
-std::array<float,2>{0.609972835f, 0.628918707f},
-std::array<float,2>{0.999225736f, 0.210941613f},
-std::array<float,2>{0.296069145f, 0.866568089f},
-std::array<float,2>{0.185728699f, 0.134881288f},
-std::array<float,2>{0.740572691f, 0.781350195f},
-std::array<float,2>{0.770000398f, 0.345348716f},
-std::array<float,2>{0.468446642f, 0.689351261f},
-std::array<float,2>{0.344438791f, 0.475142211f},
-std::array<float,2>{0.887501836f, 0.509950638f},
-std::array<float,2>{0.549046099f, 0.0252081193f},
-std::array<float,2>{0.0446911454f, 0.905318797f},
-std::array<float,2>{0.270124376f, 0.223448381f},
-std::array<float,2>{0.949806571f, 0.812673271f},
-std::array<float,2>{0.572902858f, 0.253495425f},
-std::array<float,2>{0.10812699f, 0.671554983f},
-std::array<float,2>{0.191184685f, 0.398214728f},
-std::array<float,2>{0.646979809f, 0.599774778f},
-std::array<float,2>{0.873702586f, 0.119492941f},
-std::array<float,2>{0.418481141f, 0.973896146f},
-std::array<float,2>{0.00721194921f, 0.040209163f},
-std::array<float,2>{0.527607501f, 0.913087547f},
-std::array<float,2>{0.93589294f, 0.466581345f},
-std::array<float,2>{0.324861944f, 0.562319458f},
-std::array<float,2>{0.495496362f, 0.343497455f},
-std::array<float,2>{0.801577806f, 0.722996056f},
-std::array<float,2>{0.703173757f, 0.18275167f},
-std::array<float,2>{0.154038027f, 0.753153145f},
-std::array<float,2>{0.308956534f, 0.0182215255f},
-std::array<float,2>{0.971569657f, 0.895137846f},
-std::array<float,2>{0.599683881f, 0.477465749f},
-std::array<float,2>{0.0731563792f, 0.505348027f},
-std::array<float,2>{0.244991958f, 0.351988643f},
-std::array<float,2>{0.686854124f, 0.701275945f},
-std::array<float,2>{0.832887173f, 0.125701949f},
-std::array<float,2>{0.383587003f, 0.792117059f},
-std::array<float,2>{0.0524751917f, 0.20727928f},
-std::array<float,2>{0.543828249f, 0.870852232f},
-std::array<float,2>{0.900578201f, 0.312366247f},
-std::array<float,2>{0.36860162f, 0.633219957f},
-std::array<float,2>{0.447294205f, 0.425668716f},
-std::array<float,2>{0.76181072f, 0.568152368f},
-std::array<float,2>{0.728127003f, 0.0769724473f},
-std::array<float,2>{0.163542688f, 0.944819987f},
-std::array<float,2>{0.425644666f, 0.174779579f},
-std::array<float,2>{0.851344407f, 0.758628488f},
-std::array<float,2>{0.639558554f, 0.330348134f},
-std::array<float,2>{0.21641466f, 0.732405305f},
-std::array<float,2>{0.12052235f, 0.455887318f},
-std::array<float,2>{0.578871429f, 0.548700452f},
-std::array<float,2>{0.967196822f, 0.0323351547f},
-std::array<float,2>{0.260657132f, 0.914244235f},
-std::array<float,2>{0.140030965f, 0.115316555f},
-std::array<float,2>{0.697360635f, 0.980549872f},
-std::array<float,2>{0.788918495f, 0.404597849f},
-std::array<float,2>{0.478811562f, 0.606302559f},
-std::array<float,2>{0.330488652f, 0.258797973f},
-std::array<float,2>{0.920336008f, 0.660835207f},
-std::array<float,2>{0.505164564f, 0.226955861f},
-std::array<float,2>{0.0185466725f, 0.826798737f},
-std::array<float,2>{0.499107152f, 0.090086773f},
-std::array<float,2>{0.798987806f, 0.959303379f},
-std::array<float,2>{0.709692836f, 0.415722966f},
-std::array<float,2>{0.150319517f, 0.585856915f},
-std::array<float,2>{0.00093289389f, 0.28240642f},
-std::array<float,2>{0.524892032f, 0.651585937f},
-std::array<float,2>{0.931400776f, 0.190030798f},
-std::array<float,2>{0.323088318f, 0.852125049f},
-std::array<float,2>{0.194273502f, 0.149206042f},
-std::array<float,2>{0.644364059f, 0.800439954f},
-std::array<float,2>{0.869023919f, 0.369787782f},
-std::array<float,2>{0.415079713f, 0.709348738f},
-std::array<float,2>{0.268845767f, 0.48813045f},
-std::array<float,2>{0.948325515f, 0.529877305f},
-std::array<float,2>{0.574343026f, 0.00287682121f},
-std::array<float,2>{0.103759483f, 0.881011307f},
-std::array<float,2>{0.351443142f, 0.234445721f},
-std::array<float,2>{0.883733511f, 0.84129715f},
-std::array<float,2>{0.551205754f, 0.269550174f},
-std::array<float,2>{0.0391001068f, 0.675567389f},
-std::array<float,2>{0.181542873f, 0.380834758f},
-std::array<float,2>{0.734527647f, 0.612913191f},
-std::array<float,2>{0.767712355f, 0.100557119f},
-std::array<float,2>{0.463597268f, 0.993779898f},
-std::array<float,2>{0.0864751115f, 0.0474252291f},
-std::array<float,2>{0.614674687f, 0.934823036f},
-std::array<float,2>{0.993447959f, 0.445783138f},
-std::array<float,2>{0.292053968f, 0.545721173f},
-std::array<float,2>{0.402300298f, 0.323214829f},
-std::array<float,2>{0.814884305f, 0.745680094f},
-std::array<float,2>{0.668320835f, 0.164233908f},
-std::array<float,2>{0.232536912f, 0.776492953f},
-std::array<float,2>{0.312864453f, 0.103517115f},
-std::array<float,2>{0.922805965f, 0.985389888f},
-std::array<float,2>{0.51775074f, 0.387284875f},
-std::array<float,2>{0.0114611275f, 0.620307267f},
-std::array<float,2>{0.141484857f, 0.277310818f},
-std::array<float,2>{0.713138163f, 0.685818315f},
-std::array<float,2>{0.808086157f, 0.24858515f},
-std::array<float,2>{0.489904046f, 0.830968618f},
-std::array<float,2>{0.0970293507f, 0.157721892f},
-std::array<float,2>{0.565245211f, 0.771583736f},
-std::array<float,2>{0.938156903f, 0.316440016f},
-std::array<float,2>{0.277169406f, 0.740991175f},
-std::array<float,2>{0.408990115f, 0.445048571f},
-std::array<float,2>{0.864715934f, 0.536595762f},
-std::array<float,2>{0.649605334f, 0.0580333471f},
-std::array<float,2>{0.201847985f, 0.929280698f},
-std::array<float,2>{0.460383415f, 0.201711982f},
-std::array<float,2>{0.778441489f, 0.848738611f},
-std::array<float,2>{0.745180666f, 0.289996743f},
-std::array<float,2>{0.177076802f, 0.642165303f},
-std::array<float,2>{0.0337736346f, 0.411296844f},
-std::array<float,2>{0.56001097f, 0.588383794f},
-std::array<float,2>{0.878514111f, 0.0845825672f},
-std::array<float,2>{0.358146966f, 0.961898625f},
-std::array<float,2>{0.220808774f, 0.0100907711f},
-std::array<float,2>{0.662402689f, 0.889505386f},
-std::array<float,2>{0.827373922f, 0.492192566f},
-std::array<float,2>{0.396263808f, 0.518930912f},
-std::array<float,2>{0.286100209f, 0.363792509f},
-std::array<float,2>{0.984636366f, 0.717889428f},
-std::array<float,2>{0.623889744f, 0.144667134f},
-std::array<float,2>{0.0822747946f, 0.806888998f},
-std::array<float,2>{0.375261933f, 0.0453280285f},
-std::array<float,2>{0.839085579f, 0.909747243f},
-std::array<float,2>{0.674354374f, 0.461396843f},
-std::array<float,2>{0.241431296f, 0.555717528f},
-std::array<float,2>{0.0698911473f, 0.338656068f},
-std::array<float,2>{0.608596504f, 0.719587266f},
-std::array<float,2>{0.978877425f, 0.184614345f},
-std::array<float,2>{0.303489864f, 0.75603193f},
-std::array<float,2>{0.169376463f, 0.222066671f},
-std::array<float,2>{0.723846316f, 0.818214238f},
-std::array<float,2>{0.753898382f, 0.253912538f},
-std::array<float,2>{0.439694852f, 0.666399837f},
-std::array<float,2>{0.364130139f, 0.39384827f},
-std::array<float,2>{0.897824943f, 0.597254932f},
-std::array<float,2>{0.537148476f, 0.122057058f},
-std::array<float,2>{0.0560598858f, 0.969800055f},
-std::array<float,2>{0.25703603f, 0.139040306f},
-std::array<float,2>{0.953213215f, 0.788940251f},
-std::array<float,2>{0.588836551f, 0.349839061f},
-std::array<float,2>{0.109696694f, 0.695072353f},
-std::array<float,2>{0.209867552f, 0.470026374f},
-std::array<float,2>{0.628649116f, 0.511960804f},
-std::array<float,2>{0.852807701f, 0.0303424746f},
-std::array<float,2>{0.430642664f, 0.901777983f},
-std::array<float,2>{0.030002486f, 0.0670909733f},
-std::array<float,2>{0.513813972f, 0.948110938f},
-std::array<float,2>{0.910260975f, 0.432266951f},
-std::array<float,2>{0.340642035f, 0.575317621f},
-std::array<float,2>{0.470180601f, 0.300809622f},
-std::array<float,2>{0.793012857f, 0.628831148f},
-std::array<float,2>{0.690508664f, 0.215027705f},
-std::array<float,2>{0.130422652f, 0.860265195f},
-std::array<float,2>{0.279837132f, 0.0727799907f},
-std::array<float,2>{0.942334652f, 0.940761387f},
-std::array<float,2>{0.569089711f, 0.428834051f},
-std::array<float,2>{0.100968368f, 0.565106392f},
-std::array<float,2>{0.198070183f, 0.306600958f},
-std::array<float,2>{0.65608716f, 0.63811475f},
-std::array<float,2>{0.861609221f, 0.203196436f},
-std::array<float,2>{0.41017282f, 0.872994244f},
-std::array<float,2>{0.0143637247f, 0.131134942f},
-std::array<float,2>{0.520448685f, 0.793244421f},
-std::array<float,2>{0.92610687f, 0.359339237f},
-std::array<float,2>{0.319452107f, 0.698718727f},
-std::array<float,2>{0.485298246f, 0.480939806f},
-std::array<float,2>{0.809139907f, 0.502595723f},
-std::array<float,2>{0.716630101f, 0.0196920503f},
-std::array<float,2>{0.148258761f, 0.894205689f},
-std::array<float,2>{0.392010748f, 0.232548267f},
-std::array<float,2>{0.824086964f, 0.822159111f},
-std::array<float,2>{0.658578396f, 0.264398068f},
-std::array<float,2>{0.22378917f, 0.656719685f},
-std::array<float,2>{0.0811871961f, 0.398694038f},
-std::array<float,2>{0.619403183f, 0.604015529f},
-std::array<float,2>{0.988661766f, 0.112141304f},
-std::array<float,2>{0.283501923f, 0.977591038f},
-std::array<float,2>{0.171954289f, 0.0357472263f},
-std::array<float,2>{0.746168733f, 0.918690681f},
-std::array<float,2>{0.773778141f, 0.457327366f},
-std::array<float,2>{0.455299467f, 0.55379653f},
-std::array<float,2>{0.353268415f, 0.3337273f},
-std::array<float,2>{0.881817102f, 0.727853954f},
-std::array<float,2>{0.557142735f, 0.17930685f},
-std::array<float,2>{0.0383370556f, 0.76526016f},
-std::array<float,2>{0.443292648f, 0.00552707817f},
-std::array<float,2>{0.75536567f, 0.878822207f},
-std::array<float,2>{0.72249192f, 0.489832073f},
-std::array<float,2>{0.167812407f, 0.524876356f},
-std::array<float,2>{0.0606917851f, 0.373187721f},
-std::array<float,2>{0.532518566f, 0.705809593f},
-std::array<float,2>{0.893868506f, 0.155196428f},
-std::array<float,2>{0.36180985f, 0.804588199f},
-std::array<float,2>{0.235642269f, 0.193246633f},
-std::array<float,2>{0.675809622f, 0.85850215f},
-std::array<float,2>{0.842884421f, 0.287070692f},
-std::array<float,2>{0.381959289f, 0.656021953f},
-std::array<float,2>{0.299316674f, 0.421381474f},
-std::array<float,2>{0.981631398f, 0.579516709f},
-std::array<float,2>{0.603877485f, 0.0897341073f},
-std::array<float,2>{0.0641699806f, 0.956616044f},
-std::array<float,2>{0.339707851f, 0.170752138f},
-std::array<float,2>{0.908911705f, 0.77982831f},
-std::array<float,2>{0.509738922f, 0.325603366f},
-std::array<float,2>{0.0259244852f, 0.746987224f},
-std::array<float,2>{0.128688142f, 0.452984691f},
-std::array<float,2>{0.69252485f, 0.542825997f},
-std::array<float,2>{0.792010963f, 0.051707264f},
-std::array<float,2>{0.474821866f, 0.931143463f},
-std::array<float,2>{0.114286445f, 0.0953879803f},
-std::array<float,2>{0.590741456f, 0.999574661f},
-std::array<float,2>{0.957460582f, 0.37886259f},
-std::array<float,2>{0.252584815f, 0.615493476f},
-std::array<float,2>{0.436478376f, 0.266167045f},
-std::array<float,2>{0.857675791f, 0.678167999f},
-std::array<float,2>{0.631291568f, 0.241157442f},
-std::array<float,2>{0.204859838f, 0.839603364f},
-std::array<float,2>{0.372027308f, 0.061512135f},
-std::array<float,2>{0.905921698f, 0.924099445f},
-std::array<float,2>{0.542501092f, 0.438303798f},
-std::array<float,2>{0.0498059131f, 0.531381726f},
-std::array<float,2>{0.158889025f, 0.313145846f},
-std::array<float,2>{0.732460618f, 0.736919284f},
-std::array<float,2>{0.761567831f, 0.161863863f},
-std::array<float,2>{0.449819326f, 0.769156277f},
-std::array<float,2>{0.0759076849f, 0.242561519f},
-std::array<float,2>{0.595149457f, 0.832635462f},
-std::array<float,2>{0.975154519f, 0.278664917f},
-std::array<float,2>{0.306928188f, 0.68251735f},
-std::array<float,2>{0.389418393f, 0.385411233f},
-std::array<float,2>{0.828355908f, 0.622456014f},
-std::array<float,2>{0.679926515f, 0.108551912f},
-std::array<float,2>{0.247947127f, 0.989948809f},
-std::array<float,2>{0.480592608f, 0.14140889f},
-std::array<float,2>{0.783142149f, 0.80941385f},
-std::array<float,2>{0.700755179f, 0.361719638f},
-std::array<float,2>{0.132915586f, 0.713677704f},
-std::array<float,2>{0.022703154f, 0.496241242f},
-std::array<float,2>{0.501854599f, 0.522152007f},
-std::array<float,2>{0.914570272f, 0.014789978f},
-std::array<float,2>{0.332742155f, 0.883040547f},
-std::array<float,2>{0.213442653f, 0.0785894692f},
-std::array<float,2>{0.63613981f, 0.966795921f},
-std::array<float,2>{0.846188903f, 0.408209413f},
-std::array<float,2>{0.428528816f, 0.593741357f},
-std::array<float,2>{0.263320297f, 0.296421379f},
-std::array<float,2>{0.961496234f, 0.644718289f},
-std::array<float,2>{0.584744811f, 0.198953524f},
-std::array<float,2>{0.123595461f, 0.84729749f},
-std::array<float,2>{0.421644479f, 0.117550872f},
-std::array<float,2>{0.872514367f, 0.975900114f},
-std::array<float,2>{0.645303488f, 0.394831926f},
-std::array<float,2>{0.189425915f, 0.598841608f},
-std::array<float,2>{0.106615894f, 0.251890451f},
-std::array<float,2>{0.571830094f, 0.669907987f},
-std::array<float,2>{0.95221287f, 0.22485058f},
-std::array<float,2>{0.273123741f, 0.81569612f},
-std::array<float,2>{0.154957488f, 0.180279851f},
-std::array<float,2>{0.705733776f, 0.751382768f},
-std::array<float,2>{0.804230213f, 0.341091245f},
-std::array<float,2>{0.493992299f, 0.72476393f},
-std::array<float,2>{0.327809393f, 0.468330711f},
-std::array<float,2>{0.933917165f, 0.55864805f},
-std::array<float,2>{0.530389607f, 0.041738119f},
-std::array<float,2>{0.00488345884f, 0.912051857f},
-std::array<float,2>{0.293169379f, 0.212891489f},
-std::array<float,2>{0.996271014f, 0.863667548f},
-std::array<float,2>{0.611542583f, 0.299164593f},
-std::array<float,2>{0.0926232487f, 0.632207334f},
-std::array<float,2>{0.228275746f, 0.435573846f},
-std::array<float,2>{0.667098343f, 0.570399463f},
-std::array<float,2>{0.818330228f, 0.0649362504f},
-std::array<float,2>{0.402734846f, 0.949996173f},
-std::array<float,2>{0.0461858362f, 0.0268154945f},
-std::array<float,2>{0.548378766f, 0.902761638f},
-std::array<float,2>{0.889415085f, 0.473020583f},
-std::array<float,2>{0.347395122f, 0.508597672f},
-std::array<float,2>{0.465798646f, 0.34757334f},
-std::array<float,2>{0.773035049f, 0.68985033f},
-std::array<float,2>{0.739001095f, 0.133274272f},
-std::array<float,2>{0.184911415f, 0.784701109f},
-std::array<float,2>{0.306679189f, 0.0588120148f},
-std::array<float,2>{0.975479782f, 0.922113597f},
-std::array<float,2>{0.594863296f, 0.440048665f},
-std::array<float,2>{0.0761165991f, 0.534064412f},
-std::array<float,2>{0.247773871f, 0.31490761f},
-std::array<float,2>{0.679961741f, 0.73606199f},
-std::array<float,2>{0.828372359f, 0.163861394f},
-std::array<float,2>{0.389268011f, 0.765636384f},
-std::array<float,2>{0.0501226f, 0.245334819f},
-std::array<float,2>{0.54290545f, 0.834797382f},
-std::array<float,2>{0.906098008f, 0.279311776f},
-std::array<float,2>{0.371725172f, 0.681172013f},
-std::array<float,2>{0.450107783f, 0.383137435f},
-std::array<float,2>{0.761471331f, 0.624553919f},
-std::array<float,2>{0.73267597f, 0.106933288f},
-std::array<float,2>{0.159116089f, 0.990471423f},
-std::array<float,2>{0.428225636f, 0.142681792f},
-std::array<float,2>{0.845728576f, 0.811019301f},
-std::array<float,2>{0.635887325f, 0.360079497f},
-std::array<float,2>{0.21366711f, 0.712659419f},
-std::array<float,2>{0.123917751f, 0.498732328f},
-std::array<float,2>{0.584661067f, 0.520200849f},
-std::array<float,2>{0.96171689f, 0.0131092127f},
-std::array<float,2>{0.263518274f, 0.885976553f},
-std::array<float,2>{0.133229554f, 0.0818845108f},
-std::array<float,2>{0.701008856f, 0.967004895f},
-std::array<float,2>{0.782880425f, 0.407270819f},
-std::array<float,2>{0.480856121f, 0.591519833f},
-std::array<float,2>{0.332791984f, 0.293706775f},
-std::array<float,2>{0.914869964f, 0.647812724f},
-std::array<float,2>{0.501552641f, 0.196821272f},
-std::array<float,2>{0.0228072293f, 0.844229996f},
-std::array<float,2>{0.493748695f, 0.121059038f},
-std::array<float,2>{0.804502368f, 0.972979069f},
-std::array<float,2>{0.705954015f, 0.396542847f},
-std::array<float,2>{0.155046031f, 0.600649536f},
-std::array<float,2>{0.00527128391f, 0.25292775f},
-std::array<float,2>{0.53071624f, 0.67069304f},
-std::array<float,2>{0.933737874f, 0.224454463f},
-std::array<float,2>{0.327964604f, 0.813840747f},
-std::array<float,2>{0.18911691f, 0.182318777f},
-std::array<float,2>{0.645054519f, 0.752638638f},
-std::array<float,2>{0.872142553f, 0.342648923f},
-std::array<float,2>{0.42157653f, 0.724424541f},
-std::array<float,2>{0.273389339f, 0.46497342f},
-std::array<float,2>{0.952434003f, 0.560849965f},
-std::array<float,2>{0.572100043f, 0.0396531336f},
-std::array<float,2>{0.106900088f, 0.912246704f},
-std::array<float,2>{0.347641528f, 0.212863997f},
-std::array<float,2>{0.889305592f, 0.865892529f},
-std::array<float,2>{0.548623085f, 0.29809621f},
-std::array<float,2>{0.0460256487f, 0.630484521f},
-std::array<float,2>{0.184589252f, 0.434608668f},
-std::array<float,2>{0.73902446f, 0.572381556f},
-std::array<float,2>{0.773248553f, 0.063976258f},
-std::array<float,2>{0.465506822f, 0.952111542f},
-std::array<float,2>{0.0924538001f, 0.0242447853f},
-std::array<float,2>{0.611695588f, 0.90514487f},
-std::array<float,2>{0.996571779f, 0.47653383f},
-std::array<float,2>{0.293250293f, 0.511350572f},
-std::array<float,2>{0.402374238f, 0.343987525f},
-std::array<float,2>{0.818066061f, 0.688079476f},
-std::array<float,2>{0.667342067f, 0.136447698f},
-std::array<float,2>{0.228103727f, 0.782558322f},
-std::array<float,2>{0.319721073f, 0.0706414506f},
-std::array<float,2>{0.925884366f, 0.939242661f},
-std::array<float,2>{0.520140171f, 0.42639631f},
-std::array<float,2>{0.0144892065f, 0.563454628f},
-std::array<float,2>{0.147979349f, 0.306811273f},
-std::array<float,2>{0.71653372f, 0.640567064f},
-std::array<float,2>{0.809360147f, 0.206212163f},
-std::array<float,2>{0.484963328f, 0.873759627f},
-std::array<float,2>{0.100785099f, 0.130740106f},
-std::array<float,2>{0.569162071f, 0.796787739f},
-std::array<float,2>{0.941986382f, 0.356828243f},
-std::array<float,2>{0.280072361f, 0.69625473f},
-std::array<float,2>{0.410488099f, 0.483807325f},
-std::array<float,2>{0.861354411f, 0.501762629f},
-std::array<float,2>{0.655994773f, 0.022660261f},
-std::array<float,2>{0.19794865f, 0.891873837f},
-std::array<float,2>{0.455363303f, 0.23106496f},
-std::array<float,2>{0.773534477f, 0.823329151f},
-std::array<float,2>{0.746504068f, 0.262484431f},
-std::array<float,2>{0.172288075f, 0.659030855f},
-std::array<float,2>{0.0383280478f, 0.402224571f},
-std::array<float,2>{0.557411671f, 0.602432013f},
-std::array<float,2>{0.881476283f, 0.11079859f},
-std::array<float,2>{0.353384614f, 0.979313791f},
-std::array<float,2>{0.223938301f, 0.038932886f},
-std::array<float,2>{0.658367515f, 0.920857608f},
-std::array<float,2>{0.823789656f, 0.460308343f},
-std::array<float,2>{0.391765475f, 0.551401079f},
-std::array<float,2>{0.283273548f, 0.334107697f},
-std::array<float,2>{0.988410294f, 0.72908318f},
-std::array<float,2>{0.619153082f, 0.176342815f},
-std::array<float,2>{0.081513159f, 0.762182236f},
-std::array<float,2>{0.382262856f, 0.00718401279f},
-std::array<float,2>{0.843115151f, 0.876133561f},
-std::array<float,2>{0.676265419f, 0.492092937f},
-std::array<float,2>{0.235398889f, 0.52561307f},
-std::array<float,2>{0.0643730983f, 0.372542322f},
-std::array<float,2>{0.603743672f, 0.704627275f},
-std::array<float,2>{0.981830835f, 0.152954355f},
-std::array<float,2>{0.299590737f, 0.802621841f},
-std::array<float,2>{0.167497829f, 0.194715723f},
-std::array<float,2>{0.722320974f, 0.856825233f},
-std::array<float,2>{0.755060375f, 0.288938463f},
-std::array<float,2>{0.44293353f, 0.652680516f},
-std::array<float,2>{0.361495316f, 0.418826103f},
-std::array<float,2>{0.893612027f, 0.581022382f},
-std::array<float,2>{0.532353103f, 0.0868135542f},
-std::array<float,2>{0.060913045f, 0.954884589f},
-std::array<float,2>{0.252765775f, 0.168840528f},
-std::array<float,2>{0.957098603f, 0.779049158f},
-std::array<float,2>{0.590422809f, 0.328093171f},
-std::array<float,2>{0.114682019f, 0.748597264f},
-std::array<float,2>{0.204707578f, 0.45065096f},
-std::array<float,2>{0.631098986f, 0.540542781f},
-std::array<float,2>{0.857544899f, 0.0540497154f},
-std::array<float,2>{0.436270297f, 0.932765186f},
-std::array<float,2>{0.0261510052f, 0.0957136452f},
-std::array<float,2>{0.50947988f, 0.997478664f},
-std::array<float,2>{0.909027398f, 0.376376539f},
-std::array<float,2>{0.339436769f, 0.614800811f},
-std::array<float,2>{0.474947959f, 0.267873257f},
-std::array<float,2>{0.79228425f, 0.67580235f},
-std::array<float,2>{0.692757905f, 0.239743367f},
-std::array<float,2>{0.128447503f, 0.83755976f},
-std::array<float,2>{0.277009368f, 0.102707006f},
-std::array<float,2>{0.938259125f, 0.987776637f},
-std::array<float,2>{0.56500411f, 0.389459282f},
-std::array<float,2>{0.0968804434f, 0.617540538f},
-std::array<float,2>{0.202056065f, 0.275033861f},
-std::array<float,2>{0.649674773f, 0.684536815f},
-std::array<float,2>{0.864481747f, 0.246196955f},
-std::array<float,2>{0.408851534f, 0.829238474f},
-std::array<float,2>{0.0115419962f, 0.159151673f},
-std::array<float,2>{0.517975986f, 0.769935966f},
-std::array<float,2>{0.922550917f, 0.320102215f},
-std::array<float,2>{0.31264323f, 0.738446593f},
-std::array<float,2>{0.490131468f, 0.441648126f},
-std::array<float,2>{0.80772537f, 0.537314713f},
-std::array<float,2>{0.712938428f, 0.056376487f},
-std::array<float,2>{0.141197994f, 0.926592231f},
-std::array<float,2>{0.396168739f, 0.199908301f},
-std::array<float,2>{0.827596962f, 0.850877106f},
-std::array<float,2>{0.662135541f, 0.291644394f},
-std::array<float,2>{0.221075401f, 0.643083036f},
-std::array<float,2>{0.0823863819f, 0.412635356f},
-std::array<float,2>{0.623701155f, 0.587334514f},
-std::array<float,2>{0.984521627f, 0.0829273388f},
-std::array<float,2>{0.285679728f, 0.963537037f},
-std::array<float,2>{0.176975235f, 0.00882211979f},
-std::array<float,2>{0.745547295f, 0.88746053f},
-std::array<float,2>{0.778774083f, 0.495458871f},
-std::array<float,2>{0.460028917f, 0.517252982f},
-std::array<float,2>{0.358218223f, 0.365428895f},
-std::array<float,2>{0.878723025f, 0.716494203f},
-std::array<float,2>{0.559695005f, 0.148119584f},
-std::array<float,2>{0.0340372287f, 0.805365205f},
-std::array<float,2>{0.439787805f, 0.0448225066f},
-std::array<float,2>{0.753459096f, 0.907880843f},
-std::array<float,2>{0.724090517f, 0.463536322f},
-std::array<float,2>{0.169079155f, 0.557940006f},
-std::array<float,2>{0.0557499491f, 0.336980164f},
-std::array<float,2>{0.537430644f, 0.720716536f},
-std::array<float,2>{0.897633612f, 0.186973408f},
-std::array<float,2>{0.363875151f, 0.754390061f},
-std::array<float,2>{0.241677612f, 0.219170898f},
-std::array<float,2>{0.674680352f, 0.818589747f},
-std::array<float,2>{0.83925885f, 0.256134421f},
-std::array<float,2>{0.375005394f, 0.664349079f},
-std::array<float,2>{0.30340299f, 0.391386867f},
-std::array<float,2>{0.978652179f, 0.594407439f},
-std::array<float,2>{0.608855605f, 0.123952858f},
-std::array<float,2>{0.070204027f, 0.970953763f},
-std::array<float,2>{0.340563387f, 0.136728033f},
-std::array<float,2>{0.910552979f, 0.786054134f},
-std::array<float,2>{0.514115155f, 0.348468482f},
-std::array<float,2>{0.0300807133f, 0.691565633f},
-std::array<float,2>{0.130856216f, 0.472531438f},
-std::array<float,2>{0.690853059f, 0.513820708f},
-std::array<float,2>{0.793290496f, 0.0286980756f},
-std::array<float,2>{0.469951272f, 0.89969492f},
-std::array<float,2>{0.109590776f, 0.0693113878f},
-std::array<float,2>{0.58861804f, 0.946875393f},
-std::array<float,2>{0.953426242f, 0.43004635f},
-std::array<float,2>{0.257170975f, 0.576490164f},
-std::array<float,2>{0.430244952f, 0.304043531f},
-std::array<float,2>{0.852603197f, 0.62541312f},
-std::array<float,2>{0.628772676f, 0.217757627f},
-std::array<float,2>{0.209497601f, 0.862716973f},
-std::array<float,2>{0.368273884f, 0.0158576164f},
-std::array<float,2>{0.900874019f, 0.896902025f},
-std::array<float,2>{0.543466151f, 0.478903383f},
-std::array<float,2>{0.0524938107f, 0.506114721f},
-std::array<float,2>{0.163206965f, 0.35371381f},
-std::array<float,2>{0.72829634f, 0.70041132f},
-std::array<float,2>{0.762161076f, 0.128325447f},
-std::array<float,2>{0.447676808f, 0.789519072f},
-std::array<float,2>{0.0729873627f, 0.210932821f},
-std::array<float,2>{0.599993408f, 0.867823839f},
-std::array<float,2>{0.971197009f, 0.309567451f},
-std::array<float,2>{0.30872342f, 0.635425329f},
-std::array<float,2>{0.383313924f, 0.423550516f},
-std::array<float,2>{0.832672894f, 0.570213616f},
-std::array<float,2>{0.686545312f, 0.0751865655f},
-std::array<float,2>{0.24464792f, 0.941654384f},
-std::array<float,2>{0.478613466f, 0.173145175f},
-std::array<float,2>{0.788664639f, 0.759776711f},
-std::array<float,2>{0.69752866f, 0.328477025f},
-std::array<float,2>{0.13972047f, 0.733865261f},
-std::array<float,2>{0.0181295425f, 0.454169303f},
-std::array<float,2>{0.504948616f, 0.549905062f},
-std::array<float,2>{0.920132935f, 0.0340564884f},
-std::array<float,2>{0.330224514f, 0.917805076f},
-std::array<float,2>{0.21656239f, 0.114163674f},
-std::array<float,2>{0.639356852f, 0.982622266f},
-std::array<float,2>{0.851195574f, 0.403033137f},
-std::array<float,2>{0.425447702f, 0.608168542f},
-std::array<float,2>{0.260263383f, 0.260963529f},
-std::array<float,2>{0.966849208f, 0.662498534f},
-std::array<float,2>{0.5788396f, 0.228913978f},
-std::array<float,2>{0.120243594f, 0.824747086f},
-std::array<float,2>{0.415502816f, 0.0930604786f},
-std::array<float,2>{0.868652821f, 0.958244026f},
-std::array<float,2>{0.644044816f, 0.41643244f},
-std::array<float,2>{0.193875343f, 0.583511889f},
-std::array<float,2>{0.103810579f, 0.284256965f},
-std::array<float,2>{0.574668586f, 0.648515642f},
-std::array<float,2>{0.948683441f, 0.189208299f},
-std::array<float,2>{0.268678248f, 0.854466915f},
-std::array<float,2>{0.149975151f, 0.150798857f},
-std::array<float,2>{0.709885478f, 0.796985686f},
-std::array<float,2>{0.799240053f, 0.367750287f},
-std::array<float,2>{0.49945417f, 0.708963811f},
-std::array<float,2>{0.322888464f, 0.484536111f},
-std::array<float,2>{0.93118912f, 0.529187322f},
-std::array<float,2>{0.524494469f, 0.00124946795f},
-std::array<float,2>{0.000669321336f, 0.880406797f},
-std::array<float,2>{0.292436123f, 0.237422362f},
-std::array<float,2>{0.993394136f, 0.843164861f},
-std::array<float,2>{0.61446023f, 0.271638721f},
-std::array<float,2>{0.0867877603f, 0.672637403f},
-std::array<float,2>{0.232713729f, 0.381954461f},
-std::array<float,2>{0.667999089f, 0.610584676f},
-std::array<float,2>{0.814673662f, 0.0989830717f},
-std::array<float,2>{0.401892304f, 0.995275021f},
-std::array<float,2>{0.0394836962f, 0.049601689f},
-std::array<float,2>{0.550894797f, 0.936126769f},
-std::array<float,2>{0.883532584f, 0.448008716f},
-std::array<float,2>{0.351281494f, 0.543923855f},
-std::array<float,2>{0.463853717f, 0.320681334f},
-std::array<float,2>{0.767913997f, 0.744017899f},
-std::array<float,2>{0.734841883f, 0.166228354f},
-std::array<float,2>{0.181321368f, 0.774834573f},
-std::array<float,2>{0.265586406f, 0.0141818365f},
-std::array<float,2>{0.963139951f, 0.883970737f},
-std::array<float,2>{0.58275646f, 0.497449219f},
-std::array<float,2>{0.122428484f, 0.52275455f},
-std::array<float,2>{0.212607831f, 0.362700403f},
-std::array<float,2>{0.63385731f, 0.713944018f},
-std::array<float,2>{0.844800472f, 0.142087549f},
-std::array<float,2>{0.427640676f, 0.809660673f},
-std::array<float,2>{0.019777203f, 0.197446167f},
-std::array<float,2>{0.502939403f, 0.846205235f},
-std::array<float,2>{0.916695356f, 0.295168281f},
-std::array<float,2>{0.33446762f, 0.64643091f},
-std::array<float,2>{0.484113306f, 0.40948227f},
-std::array<float,2>{0.78352952f, 0.59191221f},
-std::array<float,2>{0.701704144f, 0.0791281909f},
-std::array<float,2>{0.136410922f, 0.965227664f},
-std::array<float,2>{0.387305766f, 0.160511449f},
-std::array<float,2>{0.830802679f, 0.767642081f},
-std::array<float,2>{0.682867467f, 0.313761503f},
-std::array<float,2>{0.248926893f, 0.737448514f},
-std::array<float,2>{0.0765444934f, 0.438886672f},
-std::array<float,2>{0.596138597f, 0.532237411f},
-std::array<float,2>{0.973359525f, 0.061843615f},
-std::array<float,2>{0.306496024f, 0.924911559f},
-std::array<float,2>{0.157689705f, 0.107672594f},
-std::array<float,2>{0.730858684f, 0.988320291f},
-std::array<float,2>{0.758732736f, 0.386705279f},
-std::array<float,2>{0.452521175f, 0.62187916f},
-std::array<float,2>{0.373510212f, 0.278072476f},
-std::array<float,2>{0.903655887f, 0.683081448f},
-std::array<float,2>{0.539960682f, 0.244110644f},
-std::array<float,2>{0.0476208143f, 0.833316147f},
-std::array<float,2>{0.468703926f, 0.0654720888f},
-std::array<float,2>{0.769646525f, 0.950307369f},
-std::array<float,2>{0.740439951f, 0.43743962f},
-std::array<float,2>{0.185976386f, 0.572064936f},
-std::array<float,2>{0.0444891378f, 0.30046016f},
-std::array<float,2>{0.549082518f, 0.630953968f},
-std::array<float,2>{0.887393892f, 0.214418024f},
-std::array<float,2>{0.344552189f, 0.865091324f},
-std::array<float,2>{0.229730412f, 0.134612009f},
-std::array<float,2>{0.664892793f, 0.783935428f},
-std::array<float,2>{0.819589376f, 0.346124232f},
-std::array<float,2>{0.406131983f, 0.690583289f},
-std::array<float,2>{0.296352684f, 0.474039674f},
-std::array<float,2>{0.99937433f, 0.508882046f},
-std::array<float,2>{0.61026901f, 0.0255949926f},
-std::array<float,2>{0.0908961892f, 0.904220223f},
-std::array<float,2>{0.325038224f, 0.225626469f},
-std::array<float,2>{0.935678124f, 0.814928353f},
-std::array<float,2>{0.527549207f, 0.250011176f},
-std::array<float,2>{0.00690211821f, 0.668209851f},
-std::array<float,2>{0.154202357f, 0.395625204f},
-std::array<float,2>{0.703571498f, 0.597935498f},
-std::array<float,2>{0.801366031f, 0.118812762f},
-std::array<float,2>{0.495245248f, 0.974889696f},
-std::array<float,2>{0.108164266f, 0.042832613f},
-std::array<float,2>{0.57315737f, 0.910718501f},
-std::array<float,2>{0.950048387f, 0.467067182f},
-std::array<float,2>{0.27037546f, 0.560539663f},
-std::array<float,2>{0.41880843f, 0.340721697f},
-std::array<float,2>{0.874013722f, 0.726289332f},
-std::array<float,2>{0.647444487f, 0.181445464f},
-std::array<float,2>{0.190947577f, 0.750523329f},
-std::array<float,2>{0.354185164f, 0.112692878f},
-std::array<float,2>{0.879713476f, 0.976735413f},
-std::array<float,2>{0.555935264f, 0.40013057f},
-std::array<float,2>{0.0357170887f, 0.605163038f},
-std::array<float,2>{0.175122797f, 0.265385181f},
-std::array<float,2>{0.748508751f, 0.657863081f},
-std::array<float,2>{0.776353657f, 0.233748645f},
-std::array<float,2>{0.455072314f, 0.820554972f},
-std::array<float,2>{0.0800683796f, 0.178602576f},
-std::array<float,2>{0.618586838f, 0.764102638f},
-std::array<float,2>{0.991922319f, 0.332062453f},
-std::array<float,2>{0.282090247f, 0.727110505f},
-std::array<float,2>{0.392676234f, 0.458925992f},
-std::array<float,2>{0.82057035f, 0.553466558f},
-std::array<float,2>{0.658159316f, 0.0369516499f},
-std::array<float,2>{0.226189315f, 0.919419408f},
-std::array<float,2>{0.486592054f, 0.204720631f},
-std::array<float,2>{0.811715305f, 0.872051835f},
-std::array<float,2>{0.71853739f, 0.305400491f},
-std::array<float,2>{0.146019772f, 0.63767302f},
-std::array<float,2>{0.0124303084f, 0.428521037f},
-std::array<float,2>{0.523094654f, 0.566001773f},
-std::array<float,2>{0.927902281f, 0.0739957616f},
-std::array<float,2>{0.317209452f, 0.939715564f},
-std::array<float,2>{0.195385396f, 0.0212888066f},
-std::array<float,2>{0.653691292f, 0.892766833f},
-std::array<float,2>{0.859924257f, 0.482372552f},
-std::array<float,2>{0.412560314f, 0.503712773f},
-std::array<float,2>{0.278236657f, 0.358333975f},
-std::array<float,2>{0.944797695f, 0.698005497f},
-std::array<float,2>{0.566555798f, 0.132685691f},
-std::array<float,2>{0.0987832919f, 0.794917941f},
-std::array<float,2>{0.435088754f, 0.0523330718f},
-std::array<float,2>{0.856475294f, 0.930038214f},
-std::array<float,2>{0.628977954f, 0.451257378f},
-std::array<float,2>{0.206171155f, 0.541092992f},
-std::array<float,2>{0.116100498f, 0.324427038f},
-std::array<float,2>{0.592063725f, 0.747614801f},
-std::array<float,2>{0.9599002f, 0.171019346f},
-std::array<float,2>{0.250849247f, 0.781111598f},
-std::array<float,2>{0.126586705f, 0.241922185f},
-std::array<float,2>{0.69492501f, 0.838365793f},
-std::array<float,2>{0.789267242f, 0.266697526f},
-std::array<float,2>{0.474607497f, 0.679659307f},
-std::array<float,2>{0.337380618f, 0.377894491f},
-std::array<float,2>{0.906825244f, 0.616232932f},
-std::array<float,2>{0.511094213f, 0.094275035f},
-std::array<float,2>{0.0252904203f, 0.998725116f},
-std::array<float,2>{0.298213482f, 0.156074032f},
-std::array<float,2>{0.982508004f, 0.803002954f},
-std::array<float,2>{0.601734638f, 0.374353915f},
-std::array<float,2>{0.0656707883f, 0.706615508f},
-std::array<float,2>{0.238001883f, 0.488435477f},
-std::array<float,2>{0.678103149f, 0.52373147f},
-std::array<float,2>{0.840169549f, 0.00418423116f},
-std::array<float,2>{0.378994912f, 0.877227902f},
-std::array<float,2>{0.060474705f, 0.0882355273f},
-std::array<float,2>{0.534226537f, 0.955740392f},
-std::array<float,2>{0.891124904f, 0.42080304f},
-std::array<float,2>{0.360659629f, 0.578773677f},
-std::array<float,2>{0.443893462f, 0.285187334f},
-std::array<float,2>{0.756186187f, 0.654757857f},
-std::array<float,2>{0.720244348f, 0.191757709f},
-std::array<float,2>{0.16557917f, 0.857705772f},
-std::array<float,2>{0.288221568f, 0.0852168277f},
-std::array<float,2>{0.988243222f, 0.962215662f},
-std::array<float,2>{0.621729612f, 0.410736173f},
-std::array<float,2>{0.0845653638f, 0.589033723f},
-std::array<float,2>{0.218985274f, 0.290101141f},
-std::array<float,2>{0.661982715f, 0.640630305f},
-std::array<float,2>{0.825703919f, 0.202610999f},
-std::array<float,2>{0.397430658f, 0.847907722f},
-std::array<float,2>{0.0328692831f, 0.145938009f},
-std::array<float,2>{0.561174154f, 0.808371961f},
-std::array<float,2>{0.876264036f, 0.365118742f},
-std::array<float,2>{0.3568241f, 0.717321515f},
-std::array<float,2>{0.458218694f, 0.493891597f},
-std::array<float,2>{0.78120774f, 0.518466592f},
-std::array<float,2>{0.743938923f, 0.0114751253f},
-std::array<float,2>{0.177877173f, 0.890395224f},
-std::array<float,2>{0.406572968f, 0.249232873f},
-std::array<float,2>{0.866058111f, 0.831310928f},
-std::array<float,2>{0.651828885f, 0.276182741f},
-std::array<float,2>{0.201160192f, 0.68665731f},
-std::array<float,2>{0.094850786f, 0.388606459f},
-std::array<float,2>{0.563199162f, 0.61961031f},
-std::array<float,2>{0.940403283f, 0.104829662f},
-std::array<float,2>{0.27442953f, 0.984418154f},
-std::array<float,2>{0.144016698f, 0.0567371584f},
-std::array<float,2>{0.711330891f, 0.9282673f},
-std::array<float,2>{0.805552423f, 0.443756074f},
-std::array<float,2>{0.490943968f, 0.535754621f},
-std::array<float,2>{0.314843118f, 0.317414731f},
-std::array<float,2>{0.92506814f, 0.741320014f},
-std::array<float,2>{0.515782714f, 0.156449333f},
-std::array<float,2>{0.00930912979f, 0.773159862f},
-std::array<float,2>{0.472152948f, 0.0300684571f},
-std::array<float,2>{0.795641482f, 0.901153028f},
-std::array<float,2>{0.689208686f, 0.4688389f},
-std::array<float,2>{0.132418275f, 0.513616085f},
-std::array<float,2>{0.0282014534f, 0.351250023f},
-std::array<float,2>{0.5117203f, 0.693402886f},
-std::array<float,2>{0.913572013f, 0.139884636f},
-std::array<float,2>{0.342056781f, 0.787324429f},
-std::array<float,2>{0.208411589f, 0.215865791f},
-std::array<float,2>{0.626499057f, 0.860943139f},
-std::array<float,2>{0.855226576f, 0.302202612f},
-std::array<float,2>{0.43185252f, 0.627015114f},
-std::array<float,2>{0.254991651f, 0.43295747f},
-std::array<float,2>{0.955907345f, 0.574907959f},
-std::array<float,2>{0.58784771f, 0.0683372244f},
-std::array<float,2>{0.112511881f, 0.948747635f},
-std::array<float,2>{0.366303891f, 0.184458688f},
-std::array<float,2>{0.894724131f, 0.757651329f},
-std::array<float,2>{0.537054598f, 0.339059293f},
-std::array<float,2>{0.0579430386f, 0.720244348f},
-std::array<float,2>{0.171401411f, 0.462311387f},
-std::array<float,2>{0.725495815f, 0.554908991f},
-std::array<float,2>{0.750176668f, 0.0464956872f},
-std::array<float,2>{0.437522173f, 0.908228993f},
-std::array<float,2>{0.0667534098f, 0.122351691f},
-std::array<float,2>{0.605701387f, 0.968985379f},
-std::array<float,2>{0.978407502f, 0.39272818f},
-std::array<float,2>{0.301615834f, 0.596458852f},
-std::array<float,2>{0.378603995f, 0.25555858f},
-std::array<float,2>{0.837870657f, 0.667118609f},
-std::array<float,2>{0.673524857f, 0.221133441f},
-std::array<float,2>{0.238576263f, 0.816795588f},
-std::array<float,2>{0.328284472f, 0.0314497836f},
-std::array<float,2>{0.919773161f, 0.915440619f},
-std::array<float,2>{0.505886853f, 0.456407309f},
-std::array<float,2>{0.0156255197f, 0.547379136f},
-std::array<float,2>{0.138104931f, 0.331163555f},
-std::array<float,2>{0.695609987f, 0.731419384f},
-std::array<float,2>{0.786714852f, 0.175118759f},
-std::array<float,2>{0.476564407f, 0.758895874f},
-std::array<float,2>{0.117493398f, 0.227615863f},
-std::array<float,2>{0.580113888f, 0.827332318f},
-std::array<float,2>{0.965059757f, 0.258060545f},
-std::array<float,2>{0.258705229f, 0.661726534f},
-std::array<float,2>{0.423025548f, 0.405958086f},
-std::array<float,2>{0.847667754f, 0.607268929f},
-std::array<float,2>{0.637595534f, 0.116444424f},
-std::array<float,2>{0.217965856f, 0.981982827f},
-std::array<float,2>{0.446770072f, 0.126296386f},
-std::array<float,2>{0.765479743f, 0.791856706f},
-std::array<float,2>{0.730067968f, 0.353285462f},
-std::array<float,2>{0.160283282f, 0.702619612f},
-std::array<float,2>{0.0539797954f, 0.478091091f},
-std::array<float,2>{0.5461362f, 0.504301429f},
-std::array<float,2>{0.899828017f, 0.0187767111f},
-std::array<float,2>{0.370375007f, 0.895690978f},
-std::array<float,2>{0.242474928f, 0.0772527233f},
-std::array<float,2>{0.6852777f, 0.944213629f},
-std::array<float,2>{0.834422886f, 0.42417407f},
-std::array<float,2>{0.386174679f, 0.567128778f},
-std::array<float,2>{0.31242606f, 0.310871005f},
-std::array<float,2>{0.969074428f, 0.634276211f},
-std::array<float,2>{0.599363863f, 0.208816841f},
-std::array<float,2>{0.0716265291f, 0.870030761f},
-std::array<float,2>{0.398938835f, 0.101030491f},
-std::array<float,2>{0.813936353f, 0.99296093f},
-std::array<float,2>{0.671714067f, 0.379387975f},
-std::array<float,2>{0.231815904f, 0.612106264f},
-std::array<float,2>{0.0884328485f, 0.27136758f},
-std::array<float,2>{0.617015481f, 0.674164116f},
-std::array<float,2>{0.995652199f, 0.235540912f},
-std::array<float,2>{0.290621877f, 0.840533733f},
-std::array<float,2>{0.183416873f, 0.165972799f},
-std::array<float,2>{0.738172293f, 0.775993586f},
-std::array<float,2>{0.765717626f, 0.323593497f},
-std::array<float,2>{0.462389916f, 0.744853735f},
-std::array<float,2>{0.349114925f, 0.446430832f},
-std::array<float,2>{0.885252953f, 0.546426833f},
-std::array<float,2>{0.553751707f, 0.0482226759f},
-std::array<float,2>{0.0421831198f, 0.933639288f},
-std::array<float,2>{0.267062366f, 0.191076204f},
-std::array<float,2>{0.945479035f, 0.853471279f},
-std::array<float,2>{0.57695955f, 0.281378686f},
-std::array<float,2>{0.102437802f, 0.650532305f},
-std::array<float,2>{0.192775965f, 0.414405078f},
-std::array<float,2>{0.641807973f, 0.584336817f},
-std::array<float,2>{0.870315492f, 0.090830408f},
-std::array<float,2>{0.416502625f, 0.960706234f},
-std::array<float,2>{0.00264776289f, 0.00313796639f},
-std::array<float,2>{0.525726974f, 0.882587016f},
-std::array<float,2>{0.932678103f, 0.486599624f},
-std::array<float,2>{0.320779324f, 0.531179726f},
-std::array<float,2>{0.496699005f, 0.371005386f},
-std::array<float,2>{0.798108041f, 0.710751474f},
-std::array<float,2>{0.708780766f, 0.149637893f},
-std::array<float,2>{0.152120486f, 0.79894805f},
-std::array<float,2>{0.270769686f, 0.0408626236f},
-std::array<float,2>{0.950770795f, 0.913859308f},
-std::array<float,2>{0.57348156f, 0.465949059f},
-std::array<float,2>{0.108465567f, 0.561989486f},
-std::array<float,2>{0.189736262f, 0.342820257f},
-std::array<float,2>{0.647972167f, 0.723212063f},
-std::array<float,2>{0.874706089f, 0.183503434f},
-std::array<float,2>{0.419085443f, 0.753584743f},
-std::array<float,2>{0.00624695234f, 0.2229978f},
-std::array<float,2>{0.529054761f, 0.813009381f},
-std::array<float,2>{0.937238336f, 0.253317416f},
-std::array<float,2>{0.325386792f, 0.671253145f},
-std::array<float,2>{0.495075881f, 0.397527158f},
-std::array<float,2>{0.802296519f, 0.600419462f},
-std::array<float,2>{0.70468837f, 0.119890101f},
-std::array<float,2>{0.152696133f, 0.974180162f},
-std::array<float,2>{0.404916018f, 0.135634705f},
-std::array<float,2>{0.818797529f, 0.78175211f},
-std::array<float,2>{0.665237963f, 0.345172018f},
-std::array<float,2>{0.229155958f, 0.688833594f},
-std::array<float,2>{0.0905454904f, 0.474763393f},
-std::array<float,2>{0.611222565f, 0.510364234f},
-std::array<float,2>{0.998390794f, 0.0244855173f},
-std::array<float,2>{0.295834184f, 0.905859351f},
-std::array<float,2>{0.187367812f, 0.0631060973f},
-std::array<float,2>{0.741237402f, 0.952809215f},
-std::array<float,2>{0.771395624f, 0.433648258f},
-std::array<float,2>{0.467615753f, 0.573507011f},
-std::array<float,2>{0.345383942f, 0.297528148f},
-std::array<float,2>{0.888044357f, 0.629398823f},
-std::array<float,2>{0.550607204f, 0.211879194f},
-std::array<float,2>{0.0434563458f, 0.866771698f},
-std::array<float,2>{0.451294959f, 0.106346555f},
-std::array<float,2>{0.759278476f, 0.991627991f},
-std::array<float,2>{0.73147577f, 0.384559125f},
-std::array<float,2>{0.156251281f, 0.623916447f},
-std::array<float,2>{0.0485114567f, 0.280454636f},
-std::array<float,2>{0.54060173f, 0.679928899f},
-std::array<float,2>{0.903144538f, 0.245109454f},
-std::array<float,2>{0.374755621f, 0.83577317f},
-std::array<float,2>{0.249661684f, 0.162851557f},
-std::array<float,2>{0.681902111f, 0.767463565f},
-std::array<float,2>{0.831137717f, 0.316305816f},
-std::array<float,2>{0.38789618f, 0.734884799f},
-std::array<float,2>{0.304687798f, 0.440444708f},
-std::array<float,2>{0.973868132f, 0.535154402f},
-std::array<float,2>{0.597339094f, 0.0602377281f},
-std::array<float,2>{0.0779288709f, 0.923826396f},
-std::array<float,2>{0.33527562f, 0.19577603f},
-std::array<float,2>{0.917395711f, 0.845125079f},
-std::array<float,2>{0.502625108f, 0.294588476f},
-std::array<float,2>{0.0209566317f, 0.647440135f},
-std::array<float,2>{0.13480562f, 0.406565189f},
-std::array<float,2>{0.702372134f, 0.589890003f},
-std::array<float,2>{0.78446877f, 0.0808044299f},
-std::array<float,2>{0.482671231f, 0.967815042f},
-std::array<float,2>{0.122011885f, 0.0123351365f},
-std::array<float,2>{0.583635509f, 0.885047972f},
-std::array<float,2>{0.96437037f, 0.49954018f},
-std::array<float,2>{0.264622003f, 0.52138567f},
-std::array<float,2>{0.426527143f, 0.361114949f},
-std::array<float,2>{0.844261825f, 0.711583138f},
-std::array<float,2>{0.632851958f, 0.144422352f},
-std::array<float,2>{0.210943073f, 0.811535299f},
-std::array<float,2>{0.360017508f, 0.0869722515f},
-std::array<float,2>{0.892259121f, 0.953893661f},
-std::array<float,2>{0.533678472f, 0.419566154f},
-std::array<float,2>{0.0592990741f, 0.581985891f},
-std::array<float,2>{0.164163679f, 0.287957072f},
-std::array<float,2>{0.719430745f, 0.653657436f},
-std::array<float,2>{0.756914377f, 0.19357565f},
-std::array<float,2>{0.44459796f, 0.856366754f},
-std::array<float,2>{0.064707689f, 0.153600007f},
-std::array<float,2>{0.602669418f, 0.80080682f},
-std::array<float,2>{0.983792305f, 0.371256143f},
-std::array<float,2>{0.29741472f, 0.704041958f},
-std::array<float,2>{0.380771339f, 0.490313709f},
-std::array<float,2>{0.840851307f, 0.527337372f},
-std::array<float,2>{0.679542899f, 0.00602764171f},
-std::array<float,2>{0.23674342f, 0.875464618f},
-std::array<float,2>{0.472922623f, 0.238765329f},
-std::array<float,2>{0.79091841f, 0.836698771f},
-std::array<float,2>{0.693936229f, 0.268572807f},
-std::array<float,2>{0.125770271f, 0.677517414f},
-std::array<float,2>{0.0234789643f, 0.375077605f},
-std::array<float,2>{0.510043859f, 0.613825023f},
-std::array<float,2>{0.907765687f, 0.0968583301f},
-std::array<float,2>{0.336208373f, 0.99668479f},
-std::array<float,2>{0.205208182f, 0.0528117567f},
-std::array<float,2>{0.630529761f, 0.931817651f},
-std::array<float,2>{0.855525315f, 0.449645132f},
-std::array<float,2>{0.434393883f, 0.539664447f},
-std::array<float,2>{0.251322299f, 0.32629627f},
-std::array<float,2>{0.960658967f, 0.749599993f},
-std::array<float,2>{0.593325377f, 0.16930756f},
-std::array<float,2>{0.117076077f, 0.777766943f},
-std::array<float,2>{0.413189381f, 0.0216662474f},
-std::array<float,2>{0.861248553f, 0.891124904f},
-std::array<float,2>{0.65254575f, 0.483255535f},
-std::array<float,2>{0.196592063f, 0.500430107f},
-std::array<float,2>{0.0982183218f, 0.356051117f},
-std::array<float,2>{0.568298817f, 0.697240055f},
-std::array<float,2>{0.943600297f, 0.129177317f},
-std::array<float,2>{0.278995842f, 0.79524529f},
-std::array<float,2>{0.144976556f, 0.205755338f},
-std::array<float,2>{0.717759609f, 0.87414223f},
-std::array<float,2>{0.811388433f, 0.307709634f},
-std::array<float,2>{0.487334996f, 0.639576018f},
-std::array<float,2>{0.318063051f, 0.4276416f},
-std::array<float,2>{0.92936188f, 0.564443707f},
-std::array<float,2>{0.522149444f, 0.0720606148f},
-std::array<float,2>{0.0131939612f, 0.937506318f},
-std::array<float,2>{0.282635599f, 0.177648664f},
-std::array<float,2>{0.990279377f, 0.763579667f},
-std::array<float,2>{0.61779815f, 0.33523339f},
-std::array<float,2>{0.0781468078f, 0.73042959f},
-std::array<float,2>{0.224619105f, 0.459132463f},
-std::array<float,2>{0.656307817f, 0.552213967f},
-std::array<float,2>{0.821832001f, 0.03783039f},
-std::array<float,2>{0.394051433f, 0.921615779f},
-std::array<float,2>{0.0364109725f, 0.109539293f},
-std::array<float,2>{0.554800093f, 0.979626775f},
-std::array<float,2>{0.880139232f, 0.401128888f},
-std::array<float,2>{0.354595721f, 0.603161275f},
-std::array<float,2>{0.453723818f, 0.263116181f},
-std::array<float,2>{0.776872993f, 0.659298837f},
-std::array<float,2>{0.749178886f, 0.232285529f},
-std::array<float,2>{0.173902929f, 0.822488546f},
-std::array<float,2>{0.302302033f, 0.124385066f},
-std::array<float,2>{0.976953804f, 0.971784472f},
-std::array<float,2>{0.606757283f, 0.391944021f},
-std::array<float,2>{0.0679004937f, 0.595142126f},
-std::array<float,2>{0.239949614f, 0.257725954f},
-std::array<float,2>{0.672586143f, 0.66506052f},
-std::array<float,2>{0.836700141f, 0.220001087f},
-std::array<float,2>{0.377242237f, 0.820213199f},
-std::array<float,2>{0.0573901534f, 0.186098516f},
-std::array<float,2>{0.53609395f, 0.755821466f},
-std::array<float,2>{0.896150887f, 0.336876303f},
-std::array<float,2>{0.365357846f, 0.721853495f},
-std::array<float,2>{0.439288706f, 0.464095086f},
-std::array<float,2>{0.75180614f, 0.55674535f},
-std::array<float,2>{0.726452589f, 0.0433202982f},
-std::array<float,2>{0.170392007f, 0.906325042f},
-std::array<float,2>{0.433089703f, 0.218447492f},
-std::array<float,2>{0.853567779f, 0.861585796f},
-std::array<float,2>{0.625358284f, 0.303171009f},
-std::array<float,2>{0.207879826f, 0.626499414f},
-std::array<float,2>{0.111777388f, 0.43121919f},
-std::array<float,2>{0.58666712f, 0.57729423f},
-std::array<float,2>{0.956755161f, 0.0696934164f},
-std::array<float,2>{0.254209042f, 0.94602412f},
-std::array<float,2>{0.131346986f, 0.0279611554f},
-std::array<float,2>{0.688083768f, 0.898792982f},
-std::array<float,2>{0.796393871f, 0.471612155f},
-std::array<float,2>{0.471567065f, 0.514657438f},
-std::array<float,2>{0.343193531f, 0.349553198f},
-std::array<float,2>{0.912151754f, 0.692387104f},
-std::array<float,2>{0.512804091f, 0.138400868f},
-std::array<float,2>{0.0285932217f, 0.786142826f},
-std::array<float,2>{0.492173254f, 0.0552826412f},
-std::array<float,2>{0.805670023f, 0.927610159f},
-std::array<float,2>{0.712702692f, 0.443209916f},
-std::array<float,2>{0.142828643f, 0.538915217f},
-std::array<float,2>{0.00858542696f, 0.318772763f},
-std::array<float,2>{0.516632199f, 0.740126908f},
-std::array<float,2>{0.92478478f, 0.15973042f},
-std::array<float,2>{0.316112548f, 0.770861864f},
-std::array<float,2>{0.199423105f, 0.248010918f},
-std::array<float,2>{0.650748968f, 0.828933835f},
-std::array<float,2>{0.866920471f, 0.274191827f},
-std::array<float,2>{0.40815568f, 0.68504864f},
-std::array<float,2>{0.273792148f, 0.390284389f},
-std::array<float,2>{0.941297174f, 0.619037271f},
-std::array<float,2>{0.563643873f, 0.101873405f},
-std::array<float,2>{0.0941363722f, 0.986530006f},
-std::array<float,2>{0.355564237f, 0.146645486f},
-std::array<float,2>{0.875496089f, 0.80619818f},
-std::array<float,2>{0.562085211f, 0.366848648f},
-std::array<float,2>{0.0317505226f, 0.715234458f},
-std::array<float,2>{0.179368407f, 0.494141489f},
-std::array<float,2>{0.742584229f, 0.516342521f},
-std::array<float,2>{0.779743493f, 0.00788758788f},
-std::array<float,2>{0.45784232f, 0.887729049f},
-std::array<float,2>{0.085671559f, 0.0837901384f},
-std::array<float,2>{0.622225463f, 0.964649916f},
-std::array<float,2>{0.986450791f, 0.413946986f},
-std::array<float,2>{0.287338167f, 0.586036742f},
-std::array<float,2>{0.397982448f, 0.292259514f},
-std::array<float,2>{0.824687243f, 0.644198954f},
-std::array<float,2>{0.660738468f, 0.20115383f},
-std::array<float,2>{0.219828472f, 0.850316048f},
-std::array<float,2>{0.322173417f, 0.000349713606f},
-std::array<float,2>{0.931651652f, 0.879207015f},
-std::array<float,2>{0.526731551f, 0.486025065f},
-std::array<float,2>{0.00371108484f, 0.52747494f},
-std::array<float,2>{0.150783822f, 0.368958831f},
-std::array<float,2>{0.707882643f, 0.707847953f},
-std::array<float,2>{0.796981096f, 0.152218983f},
-std::array<float,2>{0.497914195f, 0.798299491f},
-std::array<float,2>{0.103484005f, 0.187900811f},
-std::array<float,2>{0.577926636f, 0.85521841f},
-std::array<float,2>{0.946368217f, 0.283361346f},
-std::array<float,2>{0.266253084f, 0.65035522f},
-std::array<float,2>{0.417955846f, 0.41768375f},
-std::array<float,2>{0.86977911f, 0.582149148f},
-std::array<float,2>{0.64146477f, 0.0922439769f},
-std::array<float,2>{0.192189112f, 0.957039475f},
-std::array<float,2>{0.461468518f, 0.167151302f},
-std::array<float,2>{0.767142117f, 0.773826599f},
-std::array<float,2>{0.736700535f, 0.321802437f},
-std::array<float,2>{0.182413101f, 0.74225384f},
-std::array<float,2>{0.0410563983f, 0.448767781f},
-std::array<float,2>{0.553372025f, 0.544650733f},
-std::array<float,2>{0.886342347f, 0.0498900488f},
-std::array<float,2>{0.347950429f, 0.937090695f},
-std::array<float,2>{0.231205136f, 0.0985184461f},
-std::array<float,2>{0.670746267f, 0.994535625f},
-std::array<float,2>{0.812714577f, 0.381070435f},
-std::array<float,2>{0.399881721f, 0.610040128f},
-std::array<float,2>{0.28948158f, 0.272783011f},
-std::array<float,2>{0.995014727f, 0.67301476f},
-std::array<float,2>{0.616202831f, 0.237005413f},
-std::array<float,2>{0.0889496803f, 0.842173994f},
-std::array<float,2>{0.385680169f, 0.0760439709f},
-std::array<float,2>{0.835366011f, 0.943254173f},
-std::array<float,2>{0.68400985f, 0.422057897f},
-std::array<float,2>{0.243387789f, 0.569062054f},
-std::array<float,2>{0.0712562352f, 0.310264945f},
-std::array<float,2>{0.598432183f, 0.636142135f},
-std::array<float,2>{0.970623612f, 0.209093019f},
-std::array<float,2>{0.311159462f, 0.86830008f},
-std::array<float,2>{0.161525771f, 0.127681598f},
-std::array<float,2>{0.729448438f, 0.790895581f},
-std::array<float,2>{0.763682187f, 0.355123848f},
-std::array<float,2>{0.445646822f, 0.699868798f},
-std::array<float,2>{0.369250238f, 0.479855001f},
-std::array<float,2>{0.898518145f, 0.507729113f},
-std::array<float,2>{0.545304775f, 0.0175495315f},
-std::array<float,2>{0.0531616621f, 0.898203552f},
-std::array<float,2>{0.259181857f, 0.230320826f},
-std::array<float,2>{0.965909183f, 0.825769842f},
-std::array<float,2>{0.58136332f, 0.259807944f},
-std::array<float,2>{0.118825518f, 0.663990855f},
-std::array<float,2>{0.21680519f, 0.403471589f},
-std::array<float,2>{0.638648987f, 0.609278083f},
-std::array<float,2>{0.849221706f, 0.114815727f},
-std::array<float,2>{0.422706246f, 0.983722091f},
-std::array<float,2>{0.0168398302f, 0.0341840275f},
-std::array<float,2>{0.507602632f, 0.916626155f},
-std::array<float,2>{0.918006241f, 0.454098165f},
-std::array<float,2>{0.329915851f, 0.549015224f},
-std::array<float,2>{0.477636456f, 0.329233944f},
-std::array<float,2>{0.785890877f, 0.732493639f},
-std::array<float,2>{0.69714886f, 0.172501326f},
-std::array<float,2>{0.137395948f, 0.760896087f},
-std::array<float,2>{0.294574708f, 0.026888581f},
-std::array<float,2>{0.99803853f, 0.902881503f},
-std::array<float,2>{0.612510979f, 0.473619014f},
-std::array<float,2>{0.0936817452f, 0.508039296f},
-std::array<float,2>{0.226764143f, 0.347146094f},
-std::array<float,2>{0.666045427f, 0.690039098f},
-std::array<float,2>{0.816746354f, 0.133455664f},
-std::array<float,2>{0.404085159f, 0.784263968f},
-std::array<float,2>{0.0456038229f, 0.213494629f},
-std::array<float,2>{0.546895385f, 0.864013314f},
-std::array<float,2>{0.890425026f, 0.299673676f},
-std::array<float,2>{0.346142709f, 0.632763684f},
-std::array<float,2>{0.466442704f, 0.436273098f},
-std::array<float,2>{0.771600604f, 0.571065426f},
-std::array<float,2>{0.739407718f, 0.065285936f},
-std::array<float,2>{0.184494272f, 0.949413121f},
-std::array<float,2>{0.419969499f, 0.18012999f},
-std::array<float,2>{0.871473372f, 0.751712024f},
-std::array<float,2>{0.646343827f, 0.341408312f},
-std::array<float,2>{0.187911734f, 0.725222468f},
-std::array<float,2>{0.105694726f, 0.468000263f},
-std::array<float,2>{0.570856571f, 0.559271157f},
-std::array<float,2>{0.951277256f, 0.0412300266f},
-std::array<float,2>{0.272129983f, 0.91148138f},
-std::array<float,2>{0.155294403f, 0.117983259f},
-std::array<float,2>{0.706750989f, 0.976307452f},
-std::array<float,2>{0.803355277f, 0.395397544f},
-std::array<float,2>{0.49254182f, 0.599429488f},
-std::array<float,2>{0.326771438f, 0.251311839f},
-std::array<float,2>{0.935274899f, 0.669417322f},
-std::array<float,2>{0.529472232f, 0.225253627f},
-std::array<float,2>{0.00392066129f, 0.816323757f},
-std::array<float,2>{0.482346922f, 0.0787390471f},
-std::array<float,2>{0.781312704f, 0.965955973f},
-std::array<float,2>{0.699377f, 0.408845693f},
-std::array<float,2>{0.134555131f, 0.592962861f},
-std::array<float,2>{0.0217520036f, 0.296288759f},
-std::array<float,2>{0.500300109f, 0.645159125f},
-std::array<float,2>{0.915250719f, 0.198404491f},
-std::array<float,2>{0.333668649f, 0.847079039f},
-std::array<float,2>{0.214005545f, 0.140723437f},
-std::array<float,2>{0.63538754f, 0.808711529f},
-std::array<float,2>{0.846838653f, 0.361935645f},
-std::array<float,2>{0.429575771f, 0.712925017f},
-std::array<float,2>{0.262471318f, 0.497056335f},
-std::array<float,2>{0.962485552f, 0.521895587f},
-std::array<float,2>{0.585137308f, 0.0153713347f},
-std::array<float,2>{0.124782495f, 0.883672118f},
-std::array<float,2>{0.372784674f, 0.243069202f},
-std::array<float,2>{0.905049443f, 0.832211316f},
-std::array<float,2>{0.541427076f, 0.278995484f},
-std::array<float,2>{0.0493049696f, 0.681915522f},
-std::array<float,2>{0.159997433f, 0.385005057f},
-std::array<float,2>{0.733883023f, 0.62296319f},
-std::array<float,2>{0.760033727f, 0.109106623f},
-std::array<float,2>{0.451052338f, 0.989335656f},
-std::array<float,2>{0.0751014799f, 0.0610242598f},
-std::array<float,2>{0.594595253f, 0.924747348f},
-std::array<float,2>{0.976248682f, 0.437640369f},
-std::array<float,2>{0.308290392f, 0.532069027f},
-std::array<float,2>{0.390366703f, 0.312645465f},
-std::array<float,2>{0.829597235f, 0.736558855f},
-std::array<float,2>{0.681164503f, 0.161471114f},
-std::array<float,2>{0.246451572f, 0.768586755f},
-std::array<float,2>{0.338481635f, 0.0947648287f},
-std::array<float,2>{0.909309149f, 0.999390543f},
-std::array<float,2>{0.508756816f, 0.378345639f},
-std::array<float,2>{0.0268397182f, 0.616069913f},
-std::array<float,2>{0.127562568f, 0.266086668f},
-std::array<float,2>{0.692178965f, 0.678568721f},
-std::array<float,2>{0.791294754f, 0.240453362f},
-std::array<float,2>{0.475883722f, 0.838946283f},
-std::array<float,2>{0.113402531f, 0.170169592f},
-std::array<float,2>{0.591485143f, 0.779714286f},
-std::array<float,2>{0.958073199f, 0.325988978f},
-std::array<float,2>{0.253562987f, 0.746114492f},
-std::array<float,2>{0.437457591f, 0.452262819f},
-std::array<float,2>{0.858816803f, 0.542356193f},
-std::array<float,2>{0.63196975f, 0.0511275865f},
-std::array<float,2>{0.203846395f, 0.931628883f},
-std::array<float,2>{0.441408992f, 0.192416191f},
-std::array<float,2>{0.754700661f, 0.859252334f},
-std::array<float,2>{0.720939755f, 0.286593676f},
-std::array<float,2>{0.166263849f, 0.655636787f},
-std::array<float,2>{0.0624802262f, 0.421709806f},
-std::array<float,2>{0.5316118f, 0.579669774f},
-std::array<float,2>{0.892812192f, 0.0893517584f},
-std::array<float,2>{0.362411261f, 0.956506014f},
-std::array<float,2>{0.23513326f, 0.00499173161f},
-std::array<float,2>{0.677233279f, 0.877967834f},
-std::array<float,2>{0.842705965f, 0.489690036f},
-std::array<float,2>{0.381606907f, 0.525357425f},
-std::array<float,2>{0.300633043f, 0.373841763f},
-std::array<float,2>{0.981096447f, 0.705427945f},
-std::array<float,2>{0.605325103f, 0.154632106f},
-std::array<float,2>{0.0625754222f, 0.803797662f},
-std::array<float,2>{0.391365319f, 0.0352231525f},
-std::array<float,2>{0.822978437f, 0.918044031f},
-std::array<float,2>{0.659214437f, 0.458002716f},
-std::array<float,2>{0.222968996f, 0.554457366f},
-std::array<float,2>{0.0801857635f, 0.333182216f},
-std::array<float,2>{0.621056378f, 0.728473604f},
-std::array<float,2>{0.989765942f, 0.179026321f},
-std::array<float,2>{0.284929693f, 0.764773428f},
-std::array<float,2>{0.173214644f, 0.233081296f},
-std::array<float,2>{0.747597516f, 0.821725547f},
-std::array<float,2>{0.775080442f, 0.264017284f},
-std::array<float,2>{0.456843615f, 0.657187581f},
-std::array<float,2>{0.35186401f, 0.399269551f},
-std::array<float,2>{0.882344604f, 0.603605747f},
-std::array<float,2>{0.558505833f, 0.111811593f},
-std::array<float,2>{0.0378537811f, 0.978299856f},
-std::array<float,2>{0.280620635f, 0.131595209f},
-std::array<float,2>{0.942444623f, 0.793919623f},
-std::array<float,2>{0.569498539f, 0.358706623f},
-std::array<float,2>{0.100256763f, 0.698832512f},
-std::array<float,2>{0.198451728f, 0.481056035f},
-std::array<float,2>{0.654850662f, 0.502245188f},
-std::array<float,2>{0.863279283f, 0.0201519579f},
-std::array<float,2>{0.412086874f, 0.893931568f},
-std::array<float,2>{0.014796529f, 0.0725963637f},
-std::array<float,2>{0.520912111f, 0.940933645f},
-std::array<float,2>{0.927670658f, 0.429581016f},
-std::array<float,2>{0.318412423f, 0.564752698f},
-std::array<float,2>{0.4859339f, 0.305851609f},
-std::array<float,2>{0.810306966f, 0.638598323f},
-std::array<float,2>{0.715084374f, 0.203959242f},
-std::array<float,2>{0.147215724f, 0.872221708f},
-std::array<float,2>{0.256565928f, 0.0665146187f},
-std::array<float,2>{0.954111993f, 0.947611094f},
-std::array<float,2>{0.589119613f, 0.432053596f},
-std::array<float,2>{0.11093723f, 0.576077104f},
-std::array<float,2>{0.210018516f, 0.301503778f},
-std::array<float,2>{0.627578378f, 0.628025115f},
-std::array<float,2>{0.852445662f, 0.215631127f},
-std::array<float,2>{0.430688232f, 0.859642267f},
-std::array<float,2>{0.0311224554f, 0.139331415f},
-std::array<float,2>{0.514958262f, 0.788529098f},
-std::array<float,2>{0.911834657f, 0.350354761f},
-std::array<float,2>{0.341087878f, 0.694819748f},
-std::array<float,2>{0.469094276f, 0.47024712f},
-std::array<float,2>{0.794326603f, 0.512641609f},
-std::array<float,2>{0.68960017f, 0.0307970401f},
-std::array<float,2>{0.129222408f, 0.902052939f},
-std::array<float,2>{0.376843035f, 0.222464502f},
-std::array<float,2>{0.838113844f, 0.817712545f},
-std::array<float,2>{0.674923301f, 0.254689455f},
-std::array<float,2>{0.240404502f, 0.66698128f},
-std::array<float,2>{0.0692456067f, 0.394279689f},
-std::array<float,2>{0.607437015f, 0.596932232f},
-std::array<float,2>{0.979855001f, 0.121230476f},
-std::array<float,2>{0.303886682f, 0.97051543f},
-std::array<float,2>{0.168586135f, 0.0455685966f},
-std::array<float,2>{0.723164141f, 0.909437656f},
-std::array<float,2>{0.752489746f, 0.461627245f},
-std::array<float,2>{0.441206902f, 0.556478202f},
-std::array<float,2>{0.364730865f, 0.3380678f},
-std::array<float,2>{0.896589696f, 0.719205141f},
-std::array<float,2>{0.53840512f, 0.18532595f},
-std::array<float,2>{0.0548967831f, 0.756599367f},
-std::array<float,2>{0.459314138f, 0.0102945156f},
-std::array<float,2>{0.778287888f, 0.888697565f},
-std::array<float,2>{0.744189322f, 0.493067682f},
-std::array<float,2>{0.176517069f, 0.519085228f},
-std::array<float,2>{0.0345368758f, 0.363722473f},
-std::array<float,2>{0.558693409f, 0.718266428f},
-std::array<float,2>{0.877028167f, 0.145085514f},
-std::array<float,2>{0.359199136f, 0.807332933f},
-std::array<float,2>{0.222415045f, 0.201617733f},
-std::array<float,2>{0.663332045f, 0.849563479f},
-std::array<float,2>{0.826676726f, 0.289095998f},
-std::array<float,2>{0.394796342f, 0.641677558f},
-std::array<float,2>{0.286988884f, 0.411766082f},
-std::array<float,2>{0.986207664f, 0.588002324f},
-std::array<float,2>{0.624920964f, 0.0844002664f},
-std::array<float,2>{0.083753489f, 0.961005569f},
-std::array<float,2>{0.313752383f, 0.157467991f},
-std::array<float,2>{0.922899604f, 0.772242129f},
-std::array<float,2>{0.519507468f, 0.316897988f},
-std::array<float,2>{0.0102157239f, 0.740337312f},
-std::array<float,2>{0.141821682f, 0.444339126f},
-std::array<float,2>{0.714567065f, 0.53668344f},
-std::array<float,2>{0.807578206f, 0.0583061762f},
-std::array<float,2>{0.488333881f, 0.92884177f},
-std::array<float,2>{0.0963844284f, 0.104259044f},
-std::array<float,2>{0.565947771f, 0.985854685f},
-std::array<float,2>{0.938551188f, 0.387044221f},
-std::array<float,2>{0.275717437f, 0.620823443f},
-std::array<float,2>{0.409357369f, 0.276837856f},
-std::array<float,2>{0.86416775f, 0.686065137f},
-std::array<float,2>{0.648974121f, 0.248451516f},
-std::array<float,2>{0.202945426f, 0.830523849f},
-std::array<float,2>{0.349888831f, 0.0471263416f},
-std::array<float,2>{0.884242296f, 0.935185671f},
-std::array<float,2>{0.552669823f, 0.446082443f},
-std::array<float,2>{0.0404927544f, 0.545373976f},
-std::array<float,2>{0.18009685f, 0.32270667f},
-std::array<float,2>{0.735467196f, 0.745443463f},
-std::array<float,2>{0.769397557f, 0.164626524f},
-std::array<float,2>{0.46458444f, 0.77734071f},
-std::array<float,2>{0.0872605592f, 0.235068202f},
-std::array<float,2>{0.614035368f, 0.841504872f},
-std::array<float,2>{0.992995083f, 0.27041325f},
-std::array<float,2>{0.29192251f, 0.674870372f},
-std::array<float,2>{0.400422215f, 0.380288154f},
-std::array<float,2>{0.815740764f, 0.612468064f},
-std::array<float,2>{0.66953814f, 0.0997781828f},
-std::array<float,2>{0.233856231f, 0.993608117f},
-std::array<float,2>{0.498188078f, 0.148646653f},
-std::array<float,2>{0.800149262f, 0.800129473f},
-std::array<float,2>{0.710069478f, 0.369385362f},
-std::array<float,2>{0.148921281f, 0.709569454f},
-std::array<float,2>{0.00176860823f, 0.487531036f},
-std::array<float,2>{0.524256587f, 0.529769421f},
-std::array<float,2>{0.930193186f, 0.00204515853f},
-std::array<float,2>{0.324022889f, 0.881617785f},
-std::array<float,2>{0.195028484f, 0.0906599537f},
-std::array<float,2>{0.643215835f, 0.959697366f},
-std::array<float,2>{0.867225349f, 0.415208042f},
-std::array<float,2>{0.41406396f, 0.585346937f},
-std::array<float,2>{0.267869741f, 0.283152997f},
-std::array<float,2>{0.94758904f, 0.652065217f},
-std::array<float,2>{0.575750291f, 0.189787716f},
-std::array<float,2>{0.105027214f, 0.852050066f},
-std::array<float,2>{0.424406201f, 0.116107345f},
-std::array<float,2>{0.849833846f, 0.980969727f},
-std::array<float,2>{0.640617311f, 0.404815108f},
-std::array<float,2>{0.215061098f, 0.605508149f},
-std::array<float,2>{0.119640753f, 0.259481132f},
-std::array<float,2>{0.579475939f, 0.660623193f},
-std::array<float,2>{0.967858672f, 0.227362394f},
-std::array<float,2>{0.260988623f, 0.826243103f},
-std::array<float,2>{0.139161482f, 0.174047098f},
-std::array<float,2>{0.69885087f, 0.757971168f},
-std::array<float,2>{0.78782028f, 0.330948025f},
-std::array<float,2>{0.48032257f, 0.731870711f},
-std::array<float,2>{0.331230372f, 0.455285937f},
-std::array<float,2>{0.921056747f, 0.548000693f},
-std::array<float,2>{0.504362166f, 0.0328190923f},
-std::array<float,2>{0.0187100843f, 0.914587021f},
-std::array<float,2>{0.309882313f, 0.207570121f},
-std::array<float,2>{0.972024024f, 0.870571196f},
-std::array<float,2>{0.60144484f, 0.311775625f},
-std::array<float,2>{0.0740614906f, 0.633579493f},
-std::array<float,2>{0.245244741f, 0.425211489f},
-std::array<float,2>{0.685585201f, 0.567423165f},
-std::array<float,2>{0.833525658f, 0.0763999373f},
-std::array<float,2>{0.384408414f, 0.944952071f},
-std::array<float,2>{0.0511199832f, 0.0177114271f},
-std::array<float,2>{0.544124365f, 0.894844532f},
-std::array<float,2>{0.90192318f, 0.476678193f},
-std::array<float,2>{0.367261469f, 0.50558424f},
-std::array<float,2>{0.448364288f, 0.352194369f},
-std::array<float,2>{0.762833655f, 0.701831043f},
-std::array<float,2>{0.726658404f, 0.125385359f},
-std::array<float,2>{0.162823215f, 0.792955101f},
-std::array<float,2>{0.284310311f, 0.0374341868f},
-std::array<float,2>{0.989317f, 0.920936108f},
-std::array<float,2>{0.620372176f, 0.459541529f},
-std::array<float,2>{0.0807520971f, 0.55252862f},
-std::array<float,2>{0.223632753f, 0.335501999f},
-std::array<float,2>{0.660149276f, 0.729977846f},
-std::array<float,2>{0.822496653f, 0.176934928f},
-std::array<float,2>{0.390926659f, 0.762794077f},
-std::array<float,2>{0.0373575054f, 0.23182115f},
-std::array<float,2>{0.557710648f, 0.82301712f},
-std::array<float,2>{0.881848514f, 0.263395548f},
-std::array<float,2>{0.352422088f, 0.659717441f},
-std::array<float,2>{0.45609048f, 0.400525182f},
-std::array<float,2>{0.774900734f, 0.602997065f},
-std::array<float,2>{0.747198284f, 0.110019982f},
-std::array<float,2>{0.173723295f, 0.980030417f},
-std::array<float,2>{0.41129908f, 0.129810572f},
-std::array<float,2>{0.862375677f, 0.79550761f},
-std::array<float,2>{0.654713869f, 0.355498582f},
-std::array<float,2>{0.199089348f, 0.696337938f},
-std::array<float,2>{0.100016132f, 0.482804507f},
-std::array<float,2>{0.57020849f, 0.500492692f},
-std::array<float,2>{0.943173945f, 0.0221694373f},
-std::array<float,2>{0.28110978f, 0.890675902f},
-std::array<float,2>{0.146534443f, 0.0713592544f},
-std::array<float,2>{0.715781391f, 0.938023031f},
-std::array<float,2>{0.80964005f, 0.427228689f},
-std::array<float,2>{0.485373497f, 0.563523352f},
-std::array<float,2>{0.319156826f, 0.308310628f},
-std::array<float,2>{0.926899016f, 0.638796628f},
-std::array<float,2>{0.521086812f, 0.205268711f},
-std::array<float,2>{0.0154911438f, 0.874651313f},
-std::array<float,2>{0.476305038f, 0.0976098701f},
-std::array<float,2>{0.791653395f, 0.996377766f},
-std::array<float,2>{0.691884279f, 0.375643879f},
-std::array<float,2>{0.12735042f, 0.613488317f},
-std::array<float,2>{0.0269550588f, 0.269313604f},
-std::array<float,2>{0.508263588f, 0.677241027f},
-std::array<float,2>{0.909986138f, 0.238864779f},
-std::array<float,2>{0.338072479f, 0.836131454f},
-std::array<float,2>{0.203564391f, 0.169724435f},
-std::array<float,2>{0.632679999f, 0.778161705f},
-std::array<float,2>{0.859218121f, 0.326883256f},
-std::array<float,2>{0.436695367f, 0.749091268f},
-std::array<float,2>{0.253218204f, 0.449858516f},
-std::array<float,2>{0.958726346f, 0.539316356f},
-std::array<float,2>{0.590843558f, 0.0532841943f},
-std::array<float,2>{0.113935493f, 0.932606399f},
-std::array<float,2>{0.362970263f, 0.194185227f},
-std::array<float,2>{0.893499255f, 0.855819225f},
-std::array<float,2>{0.531869054f, 0.287139267f},
-std::array<float,2>{0.0616923496f, 0.654289901f},
-std::array<float,2>{0.166650131f, 0.419359714f},
-std::array<float,2>{0.721468151f, 0.581165195f},
-std::array<float,2>{0.754224777f, 0.0875650868f},
-std::array<float,2>{0.442178875f, 0.953542054f},
-std::array<float,2>{0.0633112639f, 0.00681304792f},
-std::array<float,2>{0.604630828f, 0.875673831f},
-std::array<float,2>{0.98088038f, 0.491105884f},
-std::array<float,2>{0.299851447f, 0.526691675f},
-std::array<float,2>{0.381175935f, 0.371769905f},
-std::array<float,2>{0.84226799f, 0.703564525f},
-std::array<float,2>{0.677288949f, 0.154255509f},
-std::array<float,2>{0.234398022f, 0.80157572f},
-std::array<float,2>{0.333491921f, 0.0804914907f},
-std::array<float,2>{0.9158566f, 0.968490064f},
-std::array<float,2>{0.500856698f, 0.406982869f},
-std::array<float,2>{0.0224101208f, 0.590768576f},
-std::array<float,2>{0.134103119f, 0.294347495f},
-std::array<float,2>{0.699730992f, 0.646766007f},
-std::array<float,2>{0.782086372f, 0.19617866f},
-std::array<float,2>{0.481494397f, 0.845224738f},
-std::array<float,2>{0.124317929f, 0.143761694f},
-std::array<float,2>{0.585835218f, 0.812484503f},
-std::array<float,2>{0.962309897f, 0.360493004f},
-std::array<float,2>{0.261955351f, 0.711162865f},
-std::array<float,2>{0.428907245f, 0.499098718f},
-std::array<float,2>{0.847509444f, 0.520697951f},
-std::array<float,2>{0.63483125f, 0.0120134773f},
-std::array<float,2>{0.214554563f, 0.88557303f},
-std::array<float,2>{0.450363636f, 0.244365737f},
-std::array<float,2>{0.760280252f, 0.835437655f},
-std::array<float,2>{0.734126329f, 0.281197697f},
-std::array<float,2>{0.159341618f, 0.680213451f},
-std::array<float,2>{0.0494622774f, 0.384115785f},
-std::array<float,2>{0.54182142f, 0.623221695f},
-std::array<float,2>{0.904762983f, 0.105513029f},
-std::array<float,2>{0.372403383f, 0.991981685f},
-std::array<float,2>{0.247037709f, 0.0596987754f},
-std::array<float,2>{0.681020379f, 0.922926366f},
-std::array<float,2>{0.82955116f, 0.441135705f},
-std::array<float,2>{0.389699072f, 0.53420949f},
-std::array<float,2>{0.307806224f, 0.31574738f},
-std::array<float,2>{0.975635529f, 0.734616578f},
-std::array<float,2>{0.594186246f, 0.16247955f},
-std::array<float,2>{0.0745053068f, 0.766772926f},
-std::array<float,2>{0.403624862f, 0.0250940062f},
-std::array<float,2>{0.817086875f, 0.905620396f},
-std::array<float,2>{0.66695708f, 0.4754664f},
-std::array<float,2>{0.227162793f, 0.510217071f},
-std::array<float,2>{0.0930328816f, 0.345465928f},
-std::array<float,2>{0.612914205f, 0.689188898f},
-std::array<float,2>{0.997237086f, 0.135143831f},
-std::array<float,2>{0.293978155f, 0.78161937f},
-std::array<float,2>{0.184024706f, 0.21136497f},
-std::array<float,2>{0.740145564f, 0.866394579f},
-std::array<float,2>{0.772381902f, 0.296916008f},
-std::array<float,2>{0.465829909f, 0.629273117f},
-std::array<float,2>{0.346526206f, 0.434357733f},
-std::array<float,2>{0.890047431f, 0.574130476f},
-std::array<float,2>{0.547787786f, 0.0626144335f},
-std::array<float,2>{0.0451483205f, 0.952469051f},
-std::array<float,2>{0.271838576f, 0.183021918f},
-std::array<float,2>{0.95201546f, 0.753215134f},
-std::array<float,2>{0.57057184f, 0.343744814f},
-std::array<float,2>{0.106232673f, 0.722687244f},
-std::array<float,2>{0.188475519f, 0.466380477f},
-std::array<float,2>{0.645613492f, 0.562191725f},
-std::array<float,2>{0.871968925f, 0.0403516255f},
-std::array<float,2>{0.420484155f, 0.913506269f},
-std::array<float,2>{0.00447376724f, 0.119192779f},
-std::array<float,2>{0.529795349f, 0.973693848f},
-std::array<float,2>{0.934981048f, 0.39817369f},
-std::array<float,2>{0.326643229f, 0.599958718f},
-std::array<float,2>{0.493057013f, 0.253772378f},
-std::array<float,2>{0.803001523f, 0.671672463f},
-std::array<float,2>{0.706409991f, 0.22328119f},
-std::array<float,2>{0.156083912f, 0.812789559f},
-std::array<float,2>{0.261401772f, 0.114404485f},
-std::array<float,2>{0.968387663f, 0.984047174f},
-std::array<float,2>{0.57966578f, 0.403933823f},
-std::array<float,2>{0.119596131f, 0.608497143f},
-std::array<float,2>{0.215563074f, 0.260469079f},
-std::array<float,2>{0.639915466f, 0.663528323f},
-std::array<float,2>{0.850521326f, 0.229702502f},
-std::array<float,2>{0.423964143f, 0.825593412f},
-std::array<float,2>{0.0193672981f, 0.172260761f},
-std::array<float,2>{0.504469872f, 0.761480272f},
-std::array<float,2>{0.921525896f, 0.329933792f},
-std::array<float,2>{0.331893623f, 0.733343005f},
-std::array<float,2>{0.479531378f, 0.453145117f},
-std::array<float,2>{0.787149966f, 0.549443901f},
-std::array<float,2>{0.698434055f, 0.0350801535f},
-std::array<float,2>{0.138717443f, 0.916173518f},
-std::array<float,2>{0.383980572f, 0.209813491f},
-std::array<float,2>{0.833295286f, 0.868830979f},
-std::array<float,2>{0.686390221f, 0.309676558f},
-std::array<float,2>{0.245865211f, 0.636286557f},
-std::array<float,2>{0.0736655146f, 0.422590643f},
-std::array<float,2>{0.600693703f, 0.568424404f},
-std::array<float,2>{0.972534299f, 0.075502634f},
-std::array<float,2>{0.310400039f, 0.942497432f},
-std::array<float,2>{0.162285656f, 0.0169853866f},
-std::array<float,2>{0.727194369f, 0.897914529f},
-std::array<float,2>{0.763643742f, 0.48033613f},
-std::array<float,2>{0.449046493f, 0.506917179f},
-std::array<float,2>{0.368113309f, 0.354550034f},
-std::array<float,2>{0.901501834f, 0.699312627f},
-std::array<float,2>{0.544798136f, 0.127036974f},
-std::array<float,2>{0.0514185168f, 0.790226281f},
-std::array<float,2>{0.463981062f, 0.0503751226f},
-std::array<float,2>{0.768802881f, 0.936929345f},
-std::array<float,2>{0.736244619f, 0.448255032f},
-std::array<float,2>{0.180581242f, 0.544200063f},
-std::array<float,2>{0.0408198461f, 0.321668774f},
-std::array<float,2>{0.552218318f, 0.742910802f},
-std::array<float,2>{0.88468504f, 0.167747229f},
-std::array<float,2>{0.350520372f, 0.774377286f},
-std::array<float,2>{0.23398602f, 0.236787781f},
-std::array<float,2>{0.66896522f, 0.842526674f},
-std::array<float,2>{0.816230416f, 0.273293853f},
-std::array<float,2>{0.401313305f, 0.673800647f},
-std::array<float,2>{0.291323841f, 0.381375521f},
-std::array<float,2>{0.992264271f, 0.609652519f},
-std::array<float,2>{0.613329887f, 0.0979172215f},
-std::array<float,2>{0.0876772553f, 0.994889379f},
-std::array<float,2>{0.323351324f, 0.151696563f},
-std::array<float,2>{0.930016935f, 0.798451841f},
-std::array<float,2>{0.523755193f, 0.368644953f},
-std::array<float,2>{0.00117299007f, 0.707189679f},
-std::array<float,2>{0.149263427f, 0.485372663f},
-std::array<float,2>{0.710498929f, 0.528083801f},
-std::array<float,2>{0.800711036f, 0.000975581235f},
-std::array<float,2>{0.49874723f, 0.879397035f},
-std::array<float,2>{0.104523823f, 0.0924479142f},
-std::array<float,2>{0.575524807f, 0.957694173f},
-std::array<float,2>{0.948034465f, 0.41743499f},
-std::array<float,2>{0.268104345f, 0.582540929f},
-std::array<float,2>{0.414585054f, 0.284069479f},
-std::array<float,2>{0.867703497f, 0.649484634f},
-std::array<float,2>{0.642686009f, 0.188314304f},
-std::array<float,2>{0.194389999f, 0.85468781f},
-std::array<float,2>{0.358659208f, 0.00867628865f},
-std::array<float,2>{0.877763808f, 0.888599038f},
-std::array<float,2>{0.559535682f, 0.494695693f},
-std::array<float,2>{0.0347434245f, 0.515642822f},
-std::array<float,2>{0.176088721f, 0.366565943f},
-std::array<float,2>{0.744689941f, 0.715616167f},
-std::array<float,2>{0.777597368f, 0.147204995f},
-std::array<float,2>{0.459764272f, 0.805873454f},
-std::array<float,2>{0.0830789208f, 0.200616285f},
-std::array<float,2>{0.624183297f, 0.849948645f},
-std::array<float,2>{0.985698819f, 0.292554677f},
-std::array<float,2>{0.286167771f, 0.643997312f},
-std::array<float,2>{0.395296931f, 0.413452148f},
-std::array<float,2>{0.826218605f, 0.586888552f},
-std::array<float,2>{0.663964391f, 0.0832555294f},
-std::array<float,2>{0.222055241f, 0.963934064f},
-std::array<float,2>{0.48887974f, 0.159325808f},
-std::array<float,2>{0.806806087f, 0.771338403f},
-std::array<float,2>{0.714077353f, 0.318995714f},
-std::array<float,2>{0.142411947f, 0.739546776f},
-std::array<float,2>{0.0105687296f, 0.442755461f},
-std::array<float,2>{0.518860161f, 0.538462281f},
-std::array<float,2>{0.923622489f, 0.055025056f},
-std::array<float,2>{0.314248532f, 0.92710197f},
-std::array<float,2>{0.202480316f, 0.10212744f},
-std::array<float,2>{0.648577273f, 0.987183392f},
-std::array<float,2>{0.863594115f, 0.390085518f},
-std::array<float,2>{0.409762859f, 0.61845237f},
-std::array<float,2>{0.276335895f, 0.273495615f},
-std::array<float,2>{0.939326942f, 0.685193777f},
-std::array<float,2>{0.565916598f, 0.247402623f},
-std::array<float,2>{0.0958726034f, 0.828570366f},
-std::array<float,2>{0.431582481f, 0.0701196268f},
-std::array<float,2>{0.851648927f, 0.945543766f},
-std::array<float,2>{0.627012849f, 0.431037992f},
-std::array<float,2>{0.210496008f, 0.577888906f},
-std::array<float,2>{0.11064896f, 0.303678364f},
-std::array<float,2>{0.589386046f, 0.626177847f},
-std::array<float,2>{0.954860926f, 0.217945352f},
-std::array<float,2>{0.256297231f, 0.862042725f},
-std::array<float,2>{0.129538417f, 0.138131902f},
-std::array<float,2>{0.690061927f, 0.786840439f},
-std::array<float,2>{0.79489857f, 0.348704368f},
-std::array<float,2>{0.46953243f, 0.692956984f},
-std::array<float,2>{0.341482073f, 0.471139461f},
-std::array<float,2>{0.911418617f, 0.51546371f},
-std::array<float,2>{0.51540637f, 0.0274195299f},
-std::array<float,2>{0.0307391137f, 0.899232924f},
-std::array<float,2>{0.304511458f, 0.220396444f},
-std::array<float,2>{0.980036557f, 0.819386721f},
-std::array<float,2>{0.608226478f, 0.256946743f},
-std::array<float,2>{0.0687782094f, 0.665664971f},
-std::array<float,2>{0.241140559f, 0.392476767f},
-std::array<float,2>{0.67557472f, 0.59527427f},
-std::array<float,2>{0.83867985f, 0.12482027f},
-std::array<float,2>{0.376343161f, 0.972180963f},
-std::array<float,2>{0.0553835109f, 0.0437643863f},
-std::array<float,2>{0.539056838f, 0.906881571f},
-std::array<float,2>{0.897015989f, 0.464506358f},
-std::array<float,2>{0.365216404f, 0.557364702f},
-std::array<float,2>{0.440673172f, 0.336022496f},
-std::array<float,2>{0.752357543f, 0.722401083f},
-std::array<float,2>{0.722987473f, 0.185947478f},
-std::array<float,2>{0.1683532f, 0.754913807f},
-std::array<float,2>{0.278625757f, 0.0198186617f},
-std::array<float,2>{0.944161236f, 0.894473732f},
-std::array<float,2>{0.567494214f, 0.480668098f},
-std::array<float,2>{0.0978384763f, 0.502845168f},
-std::array<float,2>{0.197091565f, 0.359016687f},
-std::array<float,2>{0.653105974f, 0.69844842f},
-std::array<float,2>{0.860565186f, 0.130996063f},
-std::array<float,2>{0.413724303f, 0.792993546f},
-std::array<float,2>{0.0128776887f, 0.203534231f},
-std::array<float,2>{0.52178359f, 0.872728467f},
-std::array<float,2>{0.928793013f, 0.306165516f},
-std::array<float,2>{0.317769349f, 0.637798548f},
-std::array<float,2>{0.48782146f, 0.429189414f},
-std::array<float,2>{0.81056273f, 0.565224409f},
-std::array<float,2>{0.716871619f, 0.0731917769f},
-std::array<float,2>{0.145104691f, 0.940612614f},
-std::array<float,2>{0.39387095f, 0.179554105f},
-std::array<float,2>{0.82173568f, 0.765447736f},
-std::array<float,2>{0.657156169f, 0.333820224f},
-std::array<float,2>{0.225324035f, 0.727763176f},
-std::array<float,2>{0.0788068473f, 0.457273513f},
-std::array<float,2>{0.61749965f, 0.554041028f},
-std::array<float,2>{0.991203845f, 0.0360143185f},
-std::array<float,2>{0.283172101f, 0.91886729f},
-std::array<float,2>{0.174459741f, 0.112052888f},
-std::array<float,2>{0.749625325f, 0.97797364f},
-std::array<float,2>{0.776518166f, 0.398552477f},
-std::array<float,2>{0.453453511f, 0.604330003f},
-std::array<float,2>{0.355467737f, 0.2644054f},
-std::array<float,2>{0.880725443f, 0.656316102f},
-std::array<float,2>{0.555587471f, 0.232738256f},
-std::array<float,2>{0.0371076912f, 0.821949661f},
-std::array<float,2>{0.444986284f, 0.0893838629f},
-std::array<float,2>{0.757444322f, 0.956896722f},
-std::array<float,2>{0.718972802f, 0.421065986f},
-std::array<float,2>{0.164986178f, 0.57925427f},
-std::array<float,2>{0.0587169565f, 0.286687523f},
-std::array<float,2>{0.534038723f, 0.655832648f},
-std::array<float,2>{0.891638577f, 0.192971557f},
-std::array<float,2>{0.359843075f, 0.858686745f},
-std::array<float,2>{0.236865744f, 0.15484564f},
-std::array<float,2>{0.678870797f, 0.804417491f},
-std::array<float,2>{0.841537714f, 0.373401225f},
-std::array<float,2>{0.38007319f, 0.7059955f},
-std::array<float,2>{0.297261596f, 0.490222424f},
-std::array<float,2>{0.983932734f, 0.524596274f},
-std::array<float,2>{0.603363454f, 0.00569631485f},
-std::array<float,2>{0.0653364956f, 0.878535688f},
-std::array<float,2>{0.336701423f, 0.240846246f},
-std::array<float,2>{0.907491744f, 0.839412749f},
-std::array<float,2>{0.510664284f, 0.266416252f},
-std::array<float,2>{0.02427046f, 0.677768886f},
-std::array<float,2>{0.125006378f, 0.378469139f},
-std::array<float,2>{0.693461299f, 0.615475476f},
-std::array<float,2>{0.790488183f, 0.0956930444f},
-std::array<float,2>{0.473379135f, 0.999881566f},
-std::array<float,2>{0.116295613f, 0.0514509305f},
-std::array<float,2>{0.593073428f, 0.930781603f},
-std::array<float,2>{0.960072398f, 0.452807128f},
-std::array<float,2>{0.251903713f, 0.542513609f},
-std::array<float,2>{0.433662027f, 0.325205654f},
-std::array<float,2>{0.856018186f, 0.746801496f},
-std::array<float,2>{0.630071402f, 0.170560494f},
-std::array<float,2>{0.205689102f, 0.780190229f},
-std::array<float,2>{0.374147832f, 0.108751677f},
-std::array<float,2>{0.902369976f, 0.990051091f},
-std::array<float,2>{0.540327847f, 0.385609925f},
-std::array<float,2>{0.0479805693f, 0.622264862f},
-std::array<float,2>{0.156798944f, 0.278323829f},
-std::array<float,2>{0.73195976f, 0.682289839f},
-std::array<float,2>{0.759243906f, 0.242418602f},
-std::array<float,2>{0.451833069f, 0.832824409f},
-std::array<float,2>{0.0776105151f, 0.161905333f},
-std::array<float,2>{0.597034395f, 0.769400418f},
-std::array<float,2>{0.974381924f, 0.313280165f},
-std::array<float,2>{0.305225641f, 0.737205446f},
-std::array<float,2>{0.388247907f, 0.438070327f},
-std::array<float,2>{0.831967235f, 0.531649947f},
-std::array<float,2>{0.682252526f, 0.0610474385f},
-std::array<float,2>{0.249417305f, 0.923982918f},
-std::array<float,2>{0.483255029f, 0.199192271f},
-std::array<float,2>{0.784959555f, 0.847621143f},
-std::array<float,2>{0.702973127f, 0.296867937f},
-std::array<float,2>{0.135482416f, 0.644905627f},
-std::array<float,2>{0.0214448646f, 0.408518314f},
-std::array<float,2>{0.502117813f, 0.593312085f},
-std::array<float,2>{0.917837918f, 0.0782060996f},
-std::array<float,2>{0.335626453f, 0.966531813f},
-std::array<float,2>{0.211756051f, 0.0149910534f},
-std::array<float,2>{0.633731127f, 0.883083761f},
-std::array<float,2>{0.843866646f, 0.496402293f},
-std::array<float,2>{0.426198483f, 0.522343099f},
-std::array<float,2>{0.263944358f, 0.361472487f},
-std::array<float,2>{0.964023829f, 0.713474989f},
-std::array<float,2>{0.583361983f, 0.141326472f},
-std::array<float,2>{0.121366687f, 0.809320748f},
-std::array<float,2>{0.419660956f, 0.0417878293f},
-std::array<float,2>{0.874183178f, 0.911626101f},
-std::array<float,2>{0.647944629f, 0.468538642f},
-std::array<float,2>{0.190095142f, 0.558891058f},
-std::array<float,2>{0.108974725f, 0.34104389f},
-std::array<float,2>{0.573912084f, 0.724891841f},
-std::array<float,2>{0.950624228f, 0.18062897f},
-std::array<float,2>{0.271140456f, 0.751133502f},
-std::array<float,2>{0.15296337f, 0.224860609f},
-std::array<float,2>{0.704359591f, 0.815474391f},
-std::array<float,2>{0.801983774f, 0.251682699f},
-std::array<float,2>{0.494620085f, 0.66944629f},
-std::array<float,2>{0.325940579f, 0.394655585f},
-std::array<float,2>{0.936642408f, 0.599109054f},
-std::array<float,2>{0.528552055f, 0.117254607f},
-std::array<float,2>{0.00672703143f, 0.975642979f},
-std::array<float,2>{0.295208305f, 0.133034378f},
-std::array<float,2>{0.998744905f, 0.784935355f},
-std::array<float,2>{0.610565841f, 0.347274631f},
-std::array<float,2>{0.0902563557f, 0.689627826f},
-std::array<float,2>{0.228986427f, 0.472814798f},
-std::array<float,2>{0.665759921f, 0.508528411f},
-std::array<float,2>{0.819231749f, 0.0264569167f},
-std::array<float,2>{0.404399037f, 0.902399719f},
-std::array<float,2>{0.043850679f, 0.0645709559f},
-std::array<float,2>{0.549999535f, 0.949820876f},
-std::array<float,2>{0.88842696f, 0.435795665f},
-std::array<float,2>{0.345118493f, 0.570645571f},
-std::array<float,2>{0.466867626f, 0.298978776f},
-std::array<float,2>{0.770628452f, 0.631930351f},
-std::array<float,2>{0.741797268f, 0.213317022f},
-std::array<float,2>{0.186555997f, 0.863346994f},
-std::array<float,2>{0.310789794f, 0.0768097788f},
-std::array<float,2>{0.969767869f, 0.944521129f},
-std::array<float,2>{0.597805679f, 0.425374955f},
-std::array<float,2>{0.0705736279f, 0.567878842f},
-std::array<float,2>{0.244002998f, 0.312015921f},
-std::array<float,2>{0.684186101f, 0.632923782f},
-std::array<float,2>{0.835603654f, 0.207096577f},
-std::array<float,2>{0.385084718f, 0.870717347f},
-std::array<float,2>{0.0535025895f, 0.12590228f},
-std::array<float,2>{0.545706332f, 0.792281926f},
-std::array<float,2>{0.899304986f, 0.351760298f},
-std::array<float,2>{0.370010763f, 0.701539159f},
-std::array<float,2>{0.445916414f, 0.477115124f},
-std::array<float,2>{0.764441609f, 0.505015314f},
-std::array<float,2>{0.728861392f, 0.0183501095f},
-std::array<float,2>{0.161813408f, 0.895449698f},
-std::array<float,2>{0.422086269f, 0.226568297f},
-std::array<float,2>{0.848846614f, 0.827110708f},
-std::array<float,2>{0.637983561f, 0.259247482f},
-std::array<float,2>{0.217718542f, 0.661037505f},
-std::array<float,2>{0.118296847f, 0.4044559f},
-std::array<float,2>{0.58157289f, 0.60603106f},
-std::array<float,2>{0.96663934f, 0.115482591f},
-std::array<float,2>{0.259465963f, 0.980923176f},
-std::array<float,2>{0.136967912f, 0.0326488912f},
-std::array<float,2>{0.696292937f, 0.914474368f},
-std::array<float,2>{0.785364807f, 0.455566645f},
-std::array<float,2>{0.478451133f, 0.548364222f},
-std::array<float,2>{0.329484463f, 0.33018747f},
-std::array<float,2>{0.918921113f, 0.731967747f},
-std::array<float,2>{0.506905079f, 0.174331397f},
-std::array<float,2>{0.0172628667f, 0.758436918f},
-std::array<float,2>{0.497474521f, 0.0026443142f},
-std::array<float,2>{0.797649503f, 0.881218672f},
-std::array<float,2>{0.707145691f, 0.4878048f},
-std::array<float,2>{0.151010722f, 0.530211568f},
-std::array<float,2>{0.00312047102f, 0.369952708f},
-std::array<float,2>{0.526961029f, 0.709106207f},
-std::array<float,2>{0.932550669f, 0.149106175f},
-std::array<float,2>{0.321523458f, 0.800677717f},
-std::array<float,2>{0.191814244f, 0.190380648f},
-std::array<float,2>{0.640914619f, 0.852421403f},
-std::array<float,2>{0.869483292f, 0.282627046f},
-std::array<float,2>{0.417008132f, 0.65181005f},
-std::array<float,2>{0.265695691f, 0.415779918f},
-std::array<float,2>{0.94715476f, 0.585456073f},
-std::array<float,2>{0.577473223f, 0.0901530907f},
-std::array<float,2>{0.102612719f, 0.959134877f},
-std::array<float,2>{0.348417193f, 0.164463878f},
-std::array<float,2>{0.886053741f, 0.776649475f},
-std::array<float,2>{0.55311054f, 0.322922409f},
-std::array<float,2>{0.0415527932f, 0.745968699f},
-std::array<float,2>{0.182054922f, 0.445495039f},
-std::array<float,2>{0.73724103f, 0.545455456f},
-std::array<float,2>{0.766654253f, 0.0477588996f},
-std::array<float,2>{0.461285502f, 0.934800863f},
-std::array<float,2>{0.0897359923f, 0.100254416f},
-std::array<float,2>{0.615661621f, 0.993903756f},
-std::array<float,2>{0.994155884f, 0.380556613f},
-std::array<float,2>{0.289857715f, 0.613155961f},
-std::array<float,2>{0.400107771f, 0.269967049f},
-std::array<float,2>{0.81318444f, 0.675434828f},
-std::array<float,2>{0.670115709f, 0.234738052f},
-std::array<float,2>{0.230947837f, 0.840939879f},
-std::array<float,2>{0.315490276f, 0.0577743649f},
-std::array<float,2>{0.92389375f, 0.92962569f},
-std::array<float,2>{0.517180324f, 0.445131123f},
-std::array<float,2>{0.00814990699f, 0.536290109f},
-std::array<float,2>{0.143185496f, 0.31673044f},
-std::array<float,2>{0.712309837f, 0.740777493f},
-std::array<float,2>{0.806495726f, 0.158004835f},
-std::array<float,2>{0.491561204f, 0.771957815f},
-std::array<float,2>{0.0946394727f, 0.248970687f},
-std::array<float,2>{0.564425886f, 0.830658078f},
-std::array<float,2>{0.94053328f, 0.276976705f},
-std::array<float,2>{0.274271429f, 0.685732484f},
-std::array<float,2>{0.40729025f, 0.387686998f},
-std::array<float,2>{0.866327167f, 0.62054795f},
-std::array<float,2>{0.651328027f, 0.103825122f},
-std::array<float,2>{0.199752316f, 0.985598028f},
-std::array<float,2>{0.457459629f, 0.145017684f},
-std::array<float,2>{0.780173957f, 0.806690812f},
-std::array<float,2>{0.743076563f, 0.364038497f},
-std::array<float,2>{0.178988531f, 0.718130827f},
-std::array<float,2>{0.0315951593f, 0.492485315f},
-std::array<float,2>{0.561905205f, 0.518777966f},
-std::array<float,2>{0.875423729f, 0.0098401336f},
-std::array<float,2>{0.355998784f, 0.889337659f},
-std::array<float,2>{0.22031039f, 0.0848898292f},
-std::array<float,2>{0.660163164f, 0.961442888f},
-std::array<float,2>{0.824978054f, 0.411537647f},
-std::array<float,2>{0.397580683f, 0.588813424f},
-std::array<float,2>{0.287959039f, 0.289757311f},
-std::array<float,2>{0.987087786f, 0.642410994f},
-std::array<float,2>{0.622819602f, 0.202010274f},
-std::array<float,2>{0.0853482038f, 0.848989666f},
-std::array<float,2>{0.377559185f, 0.121708475f},
-std::array<float,2>{0.836287439f, 0.970044911f},
-std::array<float,2>{0.672151923f, 0.393716812f},
-std::array<float,2>{0.239679992f, 0.597592056f},
-std::array<float,2>{0.067694284f, 0.254157305f},
-std::array<float,2>{0.607302964f, 0.66611582f},
-std::array<float,2>{0.977501631f, 0.221832559f},
-std::array<float,2>{0.301885873f, 0.817981482f},
-std::array<float,2>{0.170569763f, 0.185052782f},
-std::array<float,2>{0.725650489f, 0.756127596f},
-std::array<float,2>{0.751118481f, 0.33861348f},
-std::array<float,2>{0.438930541f, 0.719400585f},
-std::array<float,2>{0.365846783f, 0.461030692f},
-std::array<float,2>{0.895630419f, 0.556010365f},
-std::array<float,2>{0.535433531f, 0.0449797325f},
-std::array<float,2>{0.057002876f, 0.90994215f},
-std::array<float,2>{0.254849494f, 0.215202928f},
-std::array<float,2>{0.956325293f, 0.860010862f},
-std::array<float,2>{0.586387753f, 0.301182389f},
-std::array<float,2>{0.112101972f, 0.628594756f},
-std::array<float,2>{0.207429826f, 0.432384253f},
-std::array<float,2>{0.625652909f, 0.575648069f},
-std::array<float,2>{0.85440737f, 0.0672471747f},
-std::array<float,2>{0.433279395f, 0.947853744f},
-std::array<float,2>{0.028859457f, 0.0307123363f},
-std::array<float,2>{0.51324141f, 0.901424706f},
-std::array<float,2>{0.913045526f, 0.469901413f},
-std::array<float,2>{0.343610525f, 0.51198405f},
-std::array<float,2>{0.470905423f, 0.350067407f},
-std::array<float,2>{0.7959764f, 0.694933414f},
-std::array<float,2>{0.687906802f, 0.138863608f},
-std::array<float,2>{0.131618038f, 0.788734555f},
-std::array<float,2>{0.250412703f, 0.0543687865f},
-std::array<float,2>{0.959015012f, 0.93320328f},
-std::array<float,2>{0.592628539f, 0.451128334f},
-std::array<float,2>{0.115570225f, 0.540065646f},
-std::array<float,2>{0.206936568f, 0.32731548f},
-std::array<float,2>{0.629652977f, 0.748325825f},
-std::array<float,2>{0.857046902f, 0.168372646f},
-std::array<float,2>{0.434603602f, 0.77848649f},
-std::array<float,2>{0.0246338099f, 0.239876494f},
-std::array<float,2>{0.511647642f, 0.837093353f},
-std::array<float,2>{0.906369388f, 0.268086225f},
-std::array<float,2>{0.337519526f, 0.676644027f},
-std::array<float,2>{0.474046588f, 0.376860827f},
-std::array<float,2>{0.789952934f, 0.614601433f},
-std::array<float,2>{0.694368958f, 0.0964337289f},
-std::array<float,2>{0.126224175f, 0.998023987f},
-std::array<float,2>{0.379702389f, 0.152514428f},
-std::array<float,2>{0.840379417f, 0.802095234f},
-std::array<float,2>{0.678564072f, 0.372772157f},
-std::array<float,2>{0.237724796f, 0.704512835f},
-std::array<float,2>{0.0660775304f, 0.49136433f},
-std::array<float,2>{0.602260053f, 0.526283085f},
-std::array<float,2>{0.983080685f, 0.00756655168f},
-std::array<float,2>{0.298392624f, 0.876755238f},
-std::array<float,2>{0.165369898f, 0.0860027596f},
-std::array<float,2>{0.720083535f, 0.954177916f},
-std::array<float,2>{0.756604254f, 0.418368459f},
-std::array<float,2>{0.443846464f, 0.580138743f},
-std::array<float,2>{0.360918671f, 0.288526088f},
-std::array<float,2>{0.890946388f, 0.653249443f},
-std::array<float,2>{0.53508836f, 0.194933563f},
-std::array<float,2>{0.0598218143f, 0.857078612f},
-std::array<float,2>{0.454399884f, 0.110981487f},
-std::array<float,2>{0.775547862f, 0.978576779f},
-std::array<float,2>{0.748862207f, 0.401604205f},
-std::array<float,2>{0.175363556f, 0.601613641f},
-std::array<float,2>{0.0355989076f, 0.262182444f},
-std::array<float,2>{0.556563079f, 0.658281863f},
-std::array<float,2>{0.879230797f, 0.230897725f},
-std::array<float,2>{0.353847742f, 0.824146867f},
-std::array<float,2>{0.225677416f, 0.175993592f},
-std::array<float,2>{0.657435179f, 0.762522638f},
-std::array<float,2>{0.82100004f, 0.334678948f},
-std::array<float,2>{0.393434823f, 0.728539944f},
-std::array<float,2>{0.281410098f, 0.460567057f},
-std::array<float,2>{0.991249323f, 0.550902843f},
-std::array<float,2>{0.61886698f, 0.0380978175f},
-std::array<float,2>{0.0795450583f, 0.920268357f},
-std::array<float,2>{0.316668183f, 0.206641227f},
-std::array<float,2>{0.92850554f, 0.873093069f},
-std::array<float,2>{0.522749543f, 0.307392806f},
-std::array<float,2>{0.0119965198f, 0.639807224f},
-std::array<float,2>{0.145898342f, 0.425894022f},
-std::array<float,2>{0.718068957f, 0.562774897f},
-std::array<float,2>{0.812115073f, 0.07106518f},
-std::array<float,2>{0.48706755f, 0.938872099f},
-std::array<float,2>{0.099459812f, 0.0234011523f},
-std::array<float,2>{0.566972852f, 0.89225316f},
-std::array<float,2>{0.945261419f, 0.48415029f},
-std::array<float,2>{0.277478725f, 0.501357734f},
-std::array<float,2>{0.412663043f, 0.357410133f},
-std::array<float,2>{0.859781027f, 0.695476055f},
-std::array<float,2>{0.654114723f, 0.130127966f},
-std::array<float,2>{0.196046546f, 0.796192527f},
-std::array<float,2>{0.343938619f, 0.0635703281f},
-std::array<float,2>{0.886790693f, 0.951486111f},
-std::array<float,2>{0.549629748f, 0.435289383f},
-std::array<float,2>{0.0442678034f, 0.573215127f},
-std::array<float,2>{0.186109319f, 0.298803717f},
-std::array<float,2>{0.741092026f, 0.629965782f},
-std::array<float,2>{0.770047128f, 0.211965069f},
-std::array<float,2>{0.467894793f, 0.865516722f},
-std::array<float,2>{0.0914298221f, 0.136145681f},
-std::array<float,2>{0.609381795f, 0.782893062f},
-std::array<float,2>{0.999921024f, 0.344370157f},
-std::array<float,2>{0.29662928f, 0.687830687f},
-std::array<float,2>{0.405429363f, 0.47571072f},
-std::array<float,2>{0.820104003f, 0.511173368f},
-std::array<float,2>{0.664491355f, 0.0235785097f},
-std::array<float,2>{0.230326861f, 0.904620111f},
-std::array<float,2>{0.49599573f, 0.224017084f},
-std::array<float,2>{0.800958395f, 0.814353645f},
-std::array<float,2>{0.704016328f, 0.252428323f},
-std::array<float,2>{0.153721049f, 0.670305967f},
-std::array<float,2>{0.00741658499f, 0.39736712f},
-std::array<float,2>{0.528098822f, 0.601540327f},
-std::array<float,2>{0.936381817f, 0.120376162f},
-std::array<float,2>{0.324351132f, 0.973398507f},
-std::array<float,2>{0.19052659f, 0.0393589549f},
-std::array<float,2>{0.646828413f, 0.912992001f},
-std::array<float,2>{0.873367012f, 0.465649694f},
-std::array<float,2>{0.418248087f, 0.561170757f},
-std::array<float,2>{0.269882828f, 0.342236847f},
-std::array<float,2>{0.949539602f, 0.723690271f},
-std::array<float,2>{0.572493076f, 0.182001561f},
-std::array<float,2>{0.107692681f, 0.75234592f},
-std::array<float,2>{0.427179158f, 0.0134392045f},
-std::array<float,2>{0.845244825f, 0.88650614f},
-std::array<float,2>{0.634509683f, 0.498078793f},
-std::array<float,2>{0.212177962f, 0.519690752f},
-std::array<float,2>{0.122987479f, 0.359557301f},
-std::array<float,2>{0.582147539f, 0.712114275f},
-std::array<float,2>{0.963484228f, 0.143315971f},
-std::array<float,2>{0.264832258f, 0.811094522f},
-std::array<float,2>{0.136048645f, 0.196472645f},
-std::array<float,2>{0.701531827f, 0.844315052f},
-std::array<float,2>{0.783742428f, 0.293155938f},
-std::array<float,2>{0.483558685f, 0.648417413f},
-std::array<float,2>{0.334763944f, 0.40785706f},
-std::array<float,2>{0.916408181f, 0.591157973f},
-std::array<float,2>{0.503448367f, 0.081413798f},
-std::array<float,2>{0.0202070288f, 0.967414796f},
-std::array<float,2>{0.306073427f, 0.163230464f},
-std::array<float,2>{0.972718775f, 0.766220152f},
-std::array<float,2>{0.596548796f, 0.315183729f},
-std::array<float,2>{0.0770114884f, 0.73568964f},
-std::array<float,2>{0.248185515f, 0.439656138f},
-std::array<float,2>{0.68342334f, 0.53354609f},
-std::array<float,2>{0.830566168f, 0.0594786257f},
-std::array<float,2>{0.386837542f, 0.92254442f},
-std::array<float,2>{0.0473219976f, 0.107177533f},
-std::array<float,2>{0.539343238f, 0.990844011f},
-std::array<float,2>{0.903834939f, 0.383415937f},
-std::array<float,2>{0.373829186f, 0.624393761f},
-std::array<float,2>{0.45296067f, 0.280113608f},
-std::array<float,2>{0.757816255f, 0.680964947f},
-std::array<float,2>{0.730963111f, 0.245748162f},
-std::array<float,2>{0.157898739f, 0.834024668f},
-std::array<float,2>{0.290384591f, 0.099360697f},
-std::array<float,2>{0.995177865f, 0.995975852f},
-std::array<float,2>{0.61668551f, 0.382687777f},
-std::array<float,2>{0.088361986f, 0.610905349f},
-std::array<float,2>{0.232351586f, 0.27243343f},
-std::array<float,2>{0.671149135f, 0.67221421f},
-std::array<float,2>{0.814344347f, 0.238027379f},
-std::array<float,2>{0.39879939f, 0.843493938f},
-std::array<float,2>{0.0428147838f, 0.166858569f},
-std::array<float,2>{0.554624319f, 0.775180817f},
-std::array<float,2>{0.885693431f, 0.32092768f},
-std::array<float,2>{0.349222571f, 0.743594646f},
-std::array<float,2>{0.462738663f, 0.447382212f},
-std::array<float,2>{0.766588449f, 0.5430215f},
-std::array<float,2>{0.737462282f, 0.0492424704f},
-std::array<float,2>{0.182741433f, 0.935979545f},
-std::array<float,2>{0.41656819f, 0.188864872f},
-std::array<float,2>{0.871059775f, 0.85360229f},
-std::array<float,2>{0.642406046f, 0.284808248f},
-std::array<float,2>{0.192947522f, 0.64911586f},
-std::array<float,2>{0.102005005f, 0.416751415f},
-std::array<float,2>{0.57665962f, 0.583148241f},
-std::array<float,2>{0.945849895f, 0.0933553874f},
-std::array<float,2>{0.267477572f, 0.958645761f},
-std::array<float,2>{0.151601121f, 0.00147152448f},
-std::array<float,2>{0.708044171f, 0.880182147f},
-std::array<float,2>{0.798562646f, 0.484969705f},
-std::array<float,2>{0.496512681f, 0.528398812f},
-std::array<float,2>{0.321045786f, 0.367491603f},
-std::array<float,2>{0.933360815f, 0.708191872f},
-std::array<float,2>{0.525922298f, 0.151364535f},
-std::array<float,2>{0.0022625085f, 0.797373831f},
-std::array<float,2>{0.477244645f, 0.0332220644f},
-std::array<float,2>{0.786138117f, 0.917156816f},
-std::array<float,2>{0.696263373f, 0.454618782f},
-std::array<float,2>{0.13836588f, 0.550687253f},
-std::array<float,2>{0.0163820535f, 0.329010218f},
-std::array<float,2>{0.506489694f, 0.734230757f},
-std::array<float,2>{0.919040382f, 0.173695907f},
-std::array<float,2>{0.328742415f, 0.760617375f},
-std::array<float,2>{0.218334675f, 0.229068473f},
-std::array<float,2>{0.636963844f, 0.824698269f},
-std::array<float,2>{0.848630846f, 0.261715829f},
-std::array<float,2>{0.423714876f, 0.662848949f},
-std::array<float,2>{0.257895291f, 0.402706861f},
-std::array<float,2>{0.96539712f, 0.607474625f},
-std::array<float,2>{0.580930352f, 0.113521338f},
-std::array<float,2>{0.118099265f, 0.983225763f},
-std::array<float,2>{0.370959491f, 0.128714055f},
-std::array<float,2>{0.900035143f, 0.789870322f},
-std::array<float,2>{0.546604335f, 0.354178071f},
-std::array<float,2>{0.0542903878f, 0.700978875f},
-std::array<float,2>{0.160864294f, 0.479359567f},
-std::array<float,2>{0.729771972f, 0.506566167f},
-std::array<float,2>{0.764952779f, 0.0164619554f},
-std::array<float,2>{0.446871519f, 0.896991491f},
-std::array<float,2>{0.0721529126f, 0.0743058473f},
-std::array<float,2>{0.598716915f, 0.942032993f},
-std::array<float,2>{0.969250739f, 0.423005402f},
-std::array<float,2>{0.311779052f, 0.569765091f},
-std::array<float,2>{0.386239678f, 0.308629245f},
-std::array<float,2>{0.834913015f, 0.635008037f},
-std::array<float,2>{0.684838414f, 0.210046917f},
-std::array<float,2>{0.243028998f, 0.86737597f},
-std::array<float,2>{0.342506707f, 0.0289713703f},
-std::array<float,2>{0.913857877f, 0.900018334f},
-std::array<float,2>{0.512546122f, 0.472033828f},
-std::array<float,2>{0.0278293565f, 0.514275253f},
-std::array<float,2>{0.132070214f, 0.347756356f},
-std::array<float,2>{0.688564479f, 0.69205308f},
-std::array<float,2>{0.795134425f, 0.137686178f},
-std::array<float,2>{0.472344965f, 0.785263419f},
-std::array<float,2>{0.11305552f, 0.216957375f},
-std::array<float,2>{0.587340415f, 0.862808108f},
-std::array<float,2>{0.955320597f, 0.304463595f},
-std::array<float,2>{0.255506605f, 0.625494957f},
-std::array<float,2>{0.432236403f, 0.430224895f},
-std::array<float,2>{0.854553759f, 0.57684958f},
-std::array<float,2>{0.626057208f, 0.0687407106f},
-std::array<float,2>{0.208951131f, 0.946455061f},
-std::array<float,2>{0.438332707f, 0.187194467f},
-std::array<float,2>{0.750852406f, 0.754638672f},
-std::array<float,2>{0.724927604f, 0.337776512f},
-std::array<float,2>{0.171066985f, 0.721509516f},
-std::array<float,2>{0.0581397563f, 0.463335723f},
-std::array<float,2>{0.536540508f, 0.558566749f},
-std::array<float,2>{0.895427704f, 0.0439491756f},
-std::array<float,2>{0.366922319f, 0.907274842f},
-std::array<float,2>{0.239014551f, 0.123286627f},
-std::array<float,2>{0.672983825f, 0.97167176f},
-std::array<float,2>{0.83699888f, 0.391085476f},
-std::array<float,2>{0.378098339f, 0.593959451f},
-std::array<float,2>{0.300969034f, 0.256757349f},
-std::array<float,2>{0.977681637f, 0.664950192f},
-std::array<float,2>{0.605959296f, 0.219437703f},
-std::array<float,2>{0.0669168532f, 0.818973243f},
-std::array<float,2>{0.396632284f, 0.082437098f},
-std::array<float,2>{0.825490296f, 0.962894201f},
-std::array<float,2>{0.66136241f, 0.412404895f},
-std::array<float,2>{0.219504371f, 0.587599516f},
-std::array<float,2>{0.0844350904f, 0.291141152f},
-std::array<float,2>{0.621368349f, 0.642842352f},
-std::array<float,2>{0.987367392f, 0.199668273f},
-std::array<float,2>{0.289026141f, 0.851538539f},
-std::array<float,2>{0.178288221f, 0.147518069f},
-std::array<float,2>{0.743206501f, 0.805149019f},
-std::array<float,2>{0.780572772f, 0.365729064f},
-std::array<float,2>{0.458872557f, 0.716191649f},
-std::array<float,2>{0.356942505f, 0.495629072f},
-std::array<float,2>{0.876919568f, 0.516823351f},
-std::array<float,2>{0.560738564f, 0.00944452733f},
-std::array<float,2>{0.0327087156f, 0.886841059f},
-std::array<float,2>{0.275229335f, 0.24699457f},
-std::array<float,2>{0.939816713f, 0.829976618f},
-std::array<float,2>{0.562735617f, 0.274505436f},
-std::array<float,2>{0.095667474f, 0.683883607f},
-std::array<float,2>{0.200260505f, 0.388958335f},
-std::array<float,2>{0.652149737f, 0.61798203f},
-std::array<float,2>{0.865458548f, 0.103249021f},
-std::array<float,2>{0.406890422f, 0.988173068f},
-std::array<float,2>{0.00913356338f, 0.0559214838f},
-std::array<float,2>{0.516528606f, 0.925876617f},
-std::array<float,2>{0.925678253f, 0.442286491f},
-std::array<float,2>{0.314961672f, 0.538082182f},
-std::array<float,2>{0.490309179f, 0.319758266f},
-std::array<float,2>{0.805089533f, 0.739243269f},
-std::array<float,2>{0.711557448f, 0.158288971f},
-std::array<float,2>{0.144094378f, 0.770164549f},
-std::array<float,2>{0.298959702f, 0.00476596132f},
-std::array<float,2>{0.982277393f, 0.877568483f},
-std::array<float,2>{0.604044318f, 0.489175171f},
-std::array<float,2>{0.0639067516f, 0.524149716f},
-std::array<float,2>{0.236248702f, 0.374759823f},
-std::array<float,2>{0.676560998f, 0.706201077f},
-std::array<float,2>{0.843283474f, 0.155706942f},
-std::array<float,2>{0.382550508f, 0.803511024f},
-std::array<float,2>{0.0614268743f, 0.192010045f},
-std::array<float,2>{0.53304106f, 0.858324349f},
-std::array<float,2>{0.894201577f, 0.285883486f},
-std::array<float,2>{0.361953199f, 0.655212402f},
-std::array<float,2>{0.442860365f, 0.420155436f},
-std::array<float,2>{0.755708814f, 0.578502357f},
-std::array<float,2>{0.721830368f, 0.0885958001f},
-std::array<float,2>{0.167443618f, 0.95552516f},
-std::array<float,2>{0.435643852f, 0.171704665f},
-std::array<float,2>{0.85834533f, 0.780587852f},
-std::array<float,2>{0.631605029f, 0.324988097f},
-std::array<float,2>{0.204524696f, 0.747328758f},
-std::array<float,2>{0.115039445f, 0.452016681f},
-std::array<float,2>{0.58999157f, 0.541906595f},
-std::array<float,2>{0.957835615f, 0.0520790853f},
-std::array<float,2>{0.252127439f, 0.930643559f},
-std::array<float,2>{0.128387719f, 0.0941944644f},
-std::array<float,2>{0.693224013f, 0.998050272f},
-std::array<float,2>{0.792593598f, 0.37698856f},
-std::array<float,2>{0.475423038f, 0.616946697f},
-std::array<float,2>{0.339177936f, 0.267544419f},
-std::array<float,2>{0.90843153f, 0.678848088f},
-std::array<float,2>{0.5090608f, 0.241353884f},
-std::array<float,2>{0.0256336555f, 0.838838696f},
-std::array<float,2>{0.484543085f, 0.0733065978f},
-std::array<float,2>{0.808683395f, 0.940364838f},
-std::array<float,2>{0.716057539f, 0.427968562f},
-std::array<float,2>{0.14762865f, 0.565856516f},
-std::array<float,2>{0.0138100283f, 0.304899067f},
-std::array<float,2>{0.519869208f, 0.636865973f},
-std::array<float,2>{0.926481664f, 0.204589516f},
-std::array<float,2>{0.319889367f, 0.87112695f},
-std::array<float,2>{0.197555333f, 0.132146016f},
-std::array<float,2>{0.655359387f, 0.794004023f},
-std::array<float,2>{0.862193704f, 0.357804716f},
-std::array<float,2>{0.410677731f, 0.697391093f},
-std::array<float,2>{0.279303998f, 0.481931865f},
-std::array<float,2>{0.941681206f, 0.503281891f},
-std::array<float,2>{0.568477213f, 0.020903172f},
-std::array<float,2>{0.101131506f, 0.893338501f},
-std::array<float,2>{0.352931976f, 0.234091625f},
-std::array<float,2>{0.881051183f, 0.821033061f},
-std::array<float,2>{0.556872547f, 0.264917731f},
-std::array<float,2>{0.0387471654f, 0.657319784f},
-std::array<float,2>{0.172568336f, 0.399891764f},
-std::array<float,2>{0.746596992f, 0.604884565f},
-std::array<float,2>{0.774185479f, 0.11294163f},
-std::array<float,2>{0.455966562f, 0.977135241f},
-std::array<float,2>{0.0816323459f, 0.0366110392f},
-std::array<float,2>{0.61974293f, 0.919874489f},
-std::array<float,2>{0.988861501f, 0.458306879f},
-std::array<float,2>{0.283903003f, 0.553179562f},
-std::array<float,2>{0.392202228f, 0.33281076f},
-std::array<float,2>{0.823646307f, 0.726938069f},
-std::array<float,2>{0.659143865f, 0.17818518f},
-std::array<float,2>{0.224478155f, 0.764196038f},
-std::array<float,2>{0.327351093f, 0.118315645f},
-std::array<float,2>{0.934525311f, 0.975580275f},
-std::array<float,2>{0.531070471f, 0.39608869f},
-std::array<float,2>{0.00543266023f, 0.59827739f},
-std::array<float,2>{0.154399812f, 0.250836223f},
-std::array<float,2>{0.705312729f, 0.668879926f},
-std::array<float,2>{0.80401808f, 0.226410344f},
-std::array<float,2>{0.493388027f, 0.815405965f},
-std::array<float,2>{0.107181042f, 0.181127176f},
-std::array<float,2>{0.57143569f, 0.750275135f},
-std::array<float,2>{0.952864885f, 0.340314448f},
-std::array<float,2>{0.272844404f, 0.726011813f},
-std::array<float,2>{0.421271294f, 0.467390329f},
-std::array<float,2>{0.872656882f, 0.560055554f},
-std::array<float,2>{0.64459312f, 0.0420400389f},
-std::array<float,2>{0.188490465f, 0.910373688f},
-std::array<float,2>{0.465314686f, 0.214182958f},
-std::array<float,2>{0.772819996f, 0.864358842f},
-std::array<float,2>{0.738292873f, 0.299993187f},
-std::array<float,2>{0.185285777f, 0.631632924f},
-std::array<float,2>{0.0467062518f, 0.436911881f},
-std::array<float,2>{0.548319638f, 0.571639478f},
-std::array<float,2>{0.888812602f, 0.0661770403f},
-std::array<float,2>{0.347003549f, 0.950848818f},
-std::array<float,2>{0.227665946f, 0.0261212476f},
-std::array<float,2>{0.667525649f, 0.903514266f},
-std::array<float,2>{0.817485571f, 0.474144906f},
-std::array<float,2>{0.403297305f, 0.509336233f},
-std::array<float,2>{0.293581367f, 0.346342355f},
-std::array<float,2>{0.996806324f, 0.691115201f},
-std::array<float,2>{0.611941397f, 0.133993447f},
-std::array<float,2>{0.0921798572f, 0.783342421f},
-std::array<float,2>{0.388706237f, 0.0622958168f},
-std::array<float,2>{0.828810573f, 0.925408423f},
-std::array<float,2>{0.680379927f, 0.439026803f},
-std::array<float,2>{0.24734664f, 0.533083558f},
-std::array<float,2>{0.0755532086f, 0.314327925f},
-std::array<float,2>{0.595337868f, 0.737905502f},
-std::array<float,2>{0.97506398f, 0.161032215f},
-std::array<float,2>{0.30717954f, 0.768463433f},
-std::array<float,2>{0.158577308f, 0.243247896f},
-std::array<float,2>{0.733128369f, 0.833949029f},
-std::array<float,2>{0.760948062f, 0.277699679f},
-std::array<float,2>{0.449495643f, 0.683531046f},
-std::array<float,2>{0.371393263f, 0.386127293f},
-std::array<float,2>{0.905677199f, 0.621336162f},
-std::array<float,2>{0.542042553f, 0.108322829f},
-std::array<float,2>{0.0506478287f, 0.988818228f},
-std::array<float,2>{0.263083756f, 0.142386347f},
-std::array<float,2>{0.961316466f, 0.810515404f},
-std::array<float,2>{0.584084988f, 0.36285603f},
-std::array<float,2>{0.123215035f, 0.71450752f},
-std::array<float,2>{0.213152811f, 0.497918189f},
-std::array<float,2>{0.636472642f, 0.523402333f},
-std::array<float,2>{0.846516013f, 0.0140475584f},
-std::array<float,2>{0.427777231f, 0.884761751f},
-std::array<float,2>{0.0233059954f, 0.0798546001f},
-std::array<float,2>{0.501122236f, 0.965642214f},
-std::array<float,2>{0.914146006f, 0.410088658f},
-std::array<float,2>{0.332055986f, 0.59258014f},
-std::array<float,2>{0.48143822f, 0.295683473f},
-std::array<float,2>{0.78225553f, 0.645715654f},
-std::array<float,2>{0.700643778f, 0.197875351f},
-std::array<float,2>{0.133692786f, 0.84606564f},
-std::array<float,2>{0.269526839f, 0.0916944072f},
-std::array<float,2>{0.948944449f, 0.960206807f},
-std::array<float,2>{0.575162053f, 0.414831251f},
-std::array<float,2>{0.104366928f, 0.584798813f},
-std::array<float,2>{0.193629161f, 0.282080561f},
-std::array<float,2>{0.643704534f, 0.65120399f},
-std::array<float,2>{0.868460953f, 0.190476075f},
-std::array<float,2>{0.415957183f, 0.852660477f},
-std::array<float,2>{0.000441020908f, 0.150041893f},
-std::array<float,2>{0.525340319f, 0.799713492f},
-std::array<float,2>{0.93070966f, 0.370542765f},
-std::array<float,2>{0.322325945f, 0.710356057f},
-std::array<float,2>{0.499662548f, 0.486973733f},
-std::array<float,2>{0.799548447f, 0.530435741f},
-std::array<float,2>{0.709184229f, 0.00351533131f},
-std::array<float,2>{0.149783298f, 0.881872058f},
-std::array<float,2>{0.401534587f, 0.236160606f},
-std::array<float,2>{0.81537497f, 0.839956939f},
-std::array<float,2>{0.668834269f, 0.270511687f},
-std::array<float,2>{0.232957095f, 0.674579501f},
-std::array<float,2>{0.0861033499f, 0.379413068f},
-std::array<float,2>{0.615195036f, 0.61181128f},
-std::array<float,2>{0.994139552f, 0.101297192f},
-std::array<float,2>{0.292808801f, 0.992232203f},
-std::array<float,2>{0.181080803f, 0.0485191345f},
-std::array<float,2>{0.735122561f, 0.934156418f},
-std::array<float,2>{0.768312633f, 0.446810931f},
-std::array<float,2>{0.463341564f, 0.545967579f},
-std::array<float,2>{0.350921154f, 0.324042737f},
-std::array<float,2>{0.883219719f, 0.744467378f},
-std::array<float,2>{0.551613212f, 0.165198922f},
-std::array<float,2>{0.039879214f, 0.77543354f},
-std::array<float,2>{0.447880238f, 0.0190793425f},
-std::array<float,2>{0.762346387f, 0.896320879f},
-std::array<float,2>{0.727572918f, 0.477759778f},
-std::array<float,2>{0.163988844f, 0.504611135f},
-std::array<float,2>{0.0521660261f, 0.352787763f},
-std::array<float,2>{0.54343015f, 0.702732682f},
-std::array<float,2>{0.901364028f, 0.126630381f},
-std::array<float,2>{0.368837178f, 0.791016459f},
-std::array<float,2>{0.2446253f, 0.208190545f},
-std::array<float,2>{0.687237024f, 0.86921376f},
-std::array<float,2>{0.83217597f, 0.311136514f},
-std::array<float,2>{0.383280724f, 0.634573162f},
-std::array<float,2>{0.309568524f, 0.424699038f},
-std::array<float,2>{0.971032858f, 0.566458941f},
-std::array<float,2>{0.600392342f, 0.0780005082f},
-std::array<float,2>{0.0726444572f, 0.943662882f},
-std::array<float,2>{0.330968291f, 0.17559965f},
-std::array<float,2>{0.920429647f, 0.759330034f},
-std::array<float,2>{0.505409777f, 0.331580937f},
-std::array<float,2>{0.0175810698f, 0.730892658f},
-std::array<float,2>{0.140409946f, 0.456839353f},
-std::array<float,2>{0.697990537f, 0.547352672f},
-std::array<float,2>{0.78848511f, 0.0321903452f},
-std::array<float,2>{0.479459137f, 0.915769041f},
-std::array<float,2>{0.121024773f, 0.116888419f},
-std::array<float,2>{0.578213692f, 0.981550813f},
-std::array<float,2>{0.967372894f, 0.405691713f},
-std::array<float,2>{0.259850353f, 0.606604457f},
-std::array<float,2>{0.424918681f, 0.25868693f},
-std::array<float,2>{0.850967228f, 0.661229432f},
-std::array<float,2>{0.638812125f, 0.228090733f},
-std::array<float,2>{0.215984553f, 0.828093588f},
-std::array<float,2>{0.36367926f, 0.0460801609f},
-std::array<float,2>{0.898164392f, 0.90910244f},
-std::array<float,2>{0.537804544f, 0.462847173f},
-std::array<float,2>{0.0562005267f, 0.555395663f},
-std::array<float,2>{0.169709772f, 0.339571536f},
-std::array<float,2>{0.72446233f, 0.719958365f},
-std::array<float,2>{0.752941132f, 0.183838263f},
-std::array<float,2>{0.44012183f, 0.756960928f},
-std::array<float,2>{0.0695454255f, 0.221214503f},
-std::array<float,2>{0.609202445f, 0.81727761f},
-std::array<float,2>{0.979416966f, 0.255273908f},
-std::array<float,2>{0.302981764f, 0.667814434f},
-std::array<float,2>{0.375823796f, 0.393144906f},
-std::array<float,2>{0.839713931f, 0.595871866f},
-std::array<float,2>{0.673860669f, 0.123001918f},
-std::array<float,2>{0.241889611f, 0.96966368f},
-std::array<float,2>{0.470469683f, 0.140528113f},
-std::array<float,2>{0.793489635f, 0.787737429f},
-std::array<float,2>{0.691029727f, 0.351011425f},
-std::array<float,2>{0.130315349f, 0.693944752f},
-std::array<float,2>{0.0297041126f, 0.46954152f},
-std::array<float,2>{0.514639497f, 0.512878537f},
-std::array<float,2>{0.910819769f, 0.0296579003f},
-std::array<float,2>{0.339979053f, 0.900648952f},
-std::array<float,2>{0.209364578f, 0.0674190298f},
-std::array<float,2>{0.628035188f, 0.948343158f},
-std::array<float,2>{0.853303671f, 0.433301985f},
-std::array<float,2>{0.430077225f, 0.574567735f},
-std::array<float,2>{0.257429272f, 0.302359998f},
-std::array<float,2>{0.953759134f, 0.627602816f},
-std::array<float,2>{0.58824712f, 0.21634002f},
-std::array<float,2>{0.110229172f, 0.860767424f},
-std::array<float,2>{0.408259958f, 0.105468698f},
-std::array<float,2>{0.865126133f, 0.985337853f},
-std::array<float,2>{0.650103509f, 0.388115138f},
-std::array<float,2>{0.201330081f, 0.619805753f},
-std::array<float,2>{0.0973146707f, 0.275672555f},
-std::array<float,2>{0.564485192f, 0.687382758f},
-std::array<float,2>{0.937719464f, 0.249852717f},
-std::array<float,2>{0.276605487f, 0.831714272f},
-std::array<float,2>{0.140747339f, 0.157028079f},
-std::array<float,2>{0.713851035f, 0.772916615f},
-std::array<float,2>{0.808406651f, 0.318240881f},
-std::array<float,2>{0.489624292f, 0.742061794f},
-std::array<float,2>{0.313185245f, 0.444167882f},
-std::array<float,2>{0.922343373f, 0.535554886f},
-std::array<float,2>{0.51809454f, 0.0573754385f},
-std::array<float,2>{0.0109316492f, 0.927785635f},
-std::array<float,2>{0.285339117f, 0.203103557f},
-std::array<float,2>{0.985009789f, 0.848204792f},
-std::array<float,2>{0.623280942f, 0.290999502f},
-std::array<float,2>{0.082624577f, 0.64116019f},
-std::array<float,2>{0.221624121f, 0.410474449f},
-std::array<float,2>{0.662747622f, 0.589639783f},
-std::array<float,2>{0.827925742f, 0.0858676359f},
-std::array<float,2>{0.395725787f, 0.962575197f},
-std::array<float,2>{0.0335113779f, 0.0110277263f},
-std::array<float,2>{0.560143113f, 0.889763474f},
-std::array<float,2>{0.878183186f, 0.493185818f},
-std::array<float,2>{0.357806385f, 0.518038869f},
-std::array<float,2>{0.460741311f, 0.364259571f},
-std::array<float,2>{0.778966486f, 0.71721375f},
-std::array<float,2>{0.745828032f, 0.146286398f},
-std::array<float,2>{0.17767112f, 0.807846367f}}
\ No newline at end of file
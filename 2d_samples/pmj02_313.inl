@@ -1,4096 +0,0 @@
-{std::array<float,2>{0.302603036f, 0.581819534f},
-std::array<float,2>{0.602012455f, 0.348435879f},
-std::array<float,2>{0.888377905f, 0.86191678f},
-std::array<float,2>{0.123812675f, 0.107479602f},
-std::array<float,2>{0.165670514f, 0.969316602f},
-std::array<float,2>{0.826635838f, 0.145068794f},
-std::array<float,2>{0.659910142f, 0.672080755f},
-std::array<float,2>{0.497685254f, 0.397472531f},
-std::array<float,2>{0.415840924f, 0.771117449f},
-std::array<float,2>{0.733088136f, 0.0303944871f},
-std::array<float,2>{0.798819125f, 0.513651609f},
-std::array<float,2>{0.23683393f, 0.262021005f},
-std::array<float,2>{0.0617700033f, 0.725698471f},
-std::array<float,2>{0.968750477f, 0.477862f},
-std::array<float,2>{0.516260922f, 0.916411519f},
-std::array<float,2>{0.350385845f, 0.232439116f},
-std::array<float,2>{0.44848451f, 0.646932721f},
-std::array<float,2>{0.65221256f, 0.421653032f},
-std::array<float,2>{0.857815683f, 0.954294264f},
-std::array<float,2>{0.144559309f, 0.17739813f},
-std::array<float,2>{0.0633982047f, 0.825909138f},
-std::array<float,2>{0.909334719f, 0.0928567871f},
-std::array<float,2>{0.565650344f, 0.600161195f},
-std::array<float,2>{0.250494421f, 0.325894237f},
-std::array<float,2>{0.33209148f, 0.905028224f},
-std::array<float,2>{0.557264686f, 0.207988992f},
-std::array<float,2>{0.945789218f, 0.712789357f},
-std::array<float,2>{0.00668512704f, 0.439644814f},
-std::array<float,2>{0.19623974f, 0.560529411f},
-std::array<float,2>{0.76864773f, 0.30461061f},
-std::array<float,2>{0.711228907f, 0.807583213f},
-std::array<float,2>{0.405885607f, 0.0623431168f},
-std::array<float,2>{0.385768056f, 0.526485145f},
-std::array<float,2>{0.69554621f, 0.273422539f},
-std::array<float,2>{0.759634018f, 0.757104576f},
-std::array<float,2>{0.20724301f, 0.000231132552f},
-std::array<float,2>{0.0252994001f, 0.927996218f},
-std::array<float,2>{0.957863748f, 0.24118118f},
-std::array<float,2>{0.541200042f, 0.739457309f},
-std::array<float,2>{0.313013047f, 0.49750632f},
-std::array<float,2>{0.274538547f, 0.849320829f},
-std::array<float,2>{0.593446553f, 0.119055167f},
-std::array<float,2>{0.925982654f, 0.572544575f},
-std::array<float,2>{0.08644142f, 0.36915496f},
-std::array<float,2>{0.133279786f, 0.656745195f},
-std::array<float,2>{0.868045688f, 0.386507839f},
-std::array<float,2>{0.639581978f, 0.99476254f},
-std::array<float,2>{0.461759806f, 0.126650304f},
-std::array<float,2>{0.362094164f, 0.698099315f},
-std::array<float,2>{0.511661947f, 0.45603323f},
-std::array<float,2>{0.990569055f, 0.879678249f},
-std::array<float,2>{0.0406565964f, 0.193173423f},
-std::array<float,2>{0.222522676f, 0.786950886f},
-std::array<float,2>{0.794693649f, 0.0456672385f},
-std::array<float,2>{0.73901701f, 0.53948921f},
-std::array<float,2>{0.432428718f, 0.29287377f},
-std::array<float,2>{0.468853951f, 0.944310188f},
-std::array<float,2>{0.680033565f, 0.170103148f},
-std::array<float,2>{0.842154205f, 0.629116595f},
-std::array<float,2>{0.176763058f, 0.434135914f},
-std::array<float,2>{0.101069994f, 0.610919774f},
-std::array<float,2>{0.894458771f, 0.3383286f},
-std::array<float,2>{0.616876483f, 0.830285311f},
-std::array<float,2>{0.293743432f, 0.0717369542f},
-std::array<float,2>{0.325912535f, 0.53216666f},
-std::array<float,2>{0.53453964f, 0.286379129f},
-std::array<float,2>{0.968060672f, 0.795029938f},
-std::array<float,2>{0.0221682303f, 0.0390547551f},
-std::array<float,2>{0.216843933f, 0.885235488f},
-std::array<float,2>{0.757526636f, 0.20092757f},
-std::array<float,2>{0.691379488f, 0.694046319f},
-std::array<float,2>{0.377646476f, 0.462825745f},
-std::array<float,2>{0.453600645f, 0.838379025f},
-std::array<float,2>{0.629598856f, 0.0662386864f},
-std::array<float,2>{0.864282727f, 0.617819726f},
-std::array<float,2>{0.132208824f, 0.330943704f},
-std::array<float,2>{0.0794181153f, 0.63668555f},
-std::array<float,2>{0.932704985f, 0.428543776f},
-std::array<float,2>{0.584993482f, 0.946905196f},
-std::array<float,2>{0.267862976f, 0.158261716f},
-std::array<float,2>{0.423287272f, 0.746021748f},
-std::array<float,2>{0.744773448f, 0.491788775f},
-std::array<float,2>{0.786457658f, 0.931494892f},
-std::array<float,2>{0.226876557f, 0.247939527f},
-std::array<float,2>{0.0376277044f, 0.765142441f},
-std::array<float,2>{0.993532658f, 0.0113271484f},
-std::array<float,2>{0.504739881f, 0.516975403f},
-std::array<float,2>{0.367392629f, 0.274213314f},
-std::array<float,2>{0.286709905f, 0.987216771f},
-std::array<float,2>{0.620921791f, 0.138781711f},
-std::array<float,2>{0.90086782f, 0.666936338f},
-std::array<float,2>{0.107812963f, 0.378108829f},
-std::array<float,2>{0.184440061f, 0.567219675f},
-std::array<float,2>{0.829260826f, 0.365739495f},
-std::array<float,2>{0.672679007f, 0.858645916f},
-std::array<float,2>{0.479401201f, 0.116192557f},
-std::array<float,2>{0.487241507f, 0.601844668f},
-std::array<float,2>{0.667613983f, 0.320259631f},
-std::array<float,2>{0.817377687f, 0.819975019f},
-std::array<float,2>{0.160066396f, 0.0811089203f},
-std::array<float,2>{0.117093727f, 0.967424512f},
-std::array<float,2>{0.875292122f, 0.187165245f},
-std::array<float,2>{0.595616519f, 0.651880085f},
-std::array<float,2>{0.30931437f, 0.407804012f},
-std::array<float,2>{0.355293483f, 0.80050832f},
-std::array<float,2>{0.523852348f, 0.0493089668f},
-std::array<float,2>{0.981010497f, 0.552835107f},
-std::array<float,2>{0.0484247692f, 0.309662104f},
-std::array<float,2>{0.246103361f, 0.705132484f},
-std::array<float,2>{0.805739462f, 0.449425757f},
-std::array<float,2>{0.72611469f, 0.895028472f},
-std::array<float,2>{0.413060188f, 0.218326464f},
-std::array<float,2>{0.263986439f, 0.685758531f},
-std::array<float,2>{0.574281812f, 0.40396145f},
-std::array<float,2>{0.918727577f, 0.981948555f},
-std::array<float,2>{0.0710351393f, 0.153569743f},
-std::array<float,2>{0.152279019f, 0.873107791f},
-std::array<float,2>{0.850841105f, 0.0965648666f},
-std::array<float,2>{0.642081082f, 0.590224802f},
-std::array<float,2>{0.44317019f, 0.352252632f},
-std::array<float,2>{0.394227564f, 0.911475718f},
-std::array<float,2>{0.705284953f, 0.224003106f},
-std::array<float,2>{0.774266005f, 0.730865717f},
-std::array<float,2>{0.19064796f, 0.475618809f},
-std::array<float,2>{0.0124540711f, 0.500220895f},
-std::array<float,2>{0.940882146f, 0.252671093f},
-std::array<float,2>{0.55453223f, 0.774534106f},
-std::array<float,2>{0.336707324f, 0.0174554512f},
-std::array<float,2>{0.273158401f, 0.50891602f},
-std::array<float,2>{0.578156233f, 0.260650188f},
-std::array<float,2>{0.936316252f, 0.767778337f},
-std::array<float,2>{0.0833976269f, 0.0273326188f},
-std::array<float,2>{0.128398046f, 0.921515405f},
-std::array<float,2>{0.862113953f, 0.228541583f},
-std::array<float,2>{0.625848889f, 0.720197618f},
-std::array<float,2>{0.458272845f, 0.481149554f},
-std::array<float,2>{0.382216245f, 0.864290833f},
-std::array<float,2>{0.691436529f, 0.104276292f},
-std::array<float,2>{0.752406418f, 0.583473325f},
-std::array<float,2>{0.212459087f, 0.345116377f},
-std::array<float,2>{0.0172809083f, 0.677722573f},
-std::array<float,2>{0.963435888f, 0.391830176f},
-std::array<float,2>{0.53531456f, 0.973414302f},
-std::array<float,2>{0.323548049f, 0.142334223f},
-std::array<float,2>{0.48119086f, 0.715951324f},
-std::array<float,2>{0.678072751f, 0.441999346f},
-std::array<float,2>{0.833056629f, 0.901042402f},
-std::array<float,2>{0.182157964f, 0.204840168f},
-std::array<float,2>{0.103487462f, 0.812152922f},
-std::array<float,2>{0.90578407f, 0.0565510653f},
-std::array<float,2>{0.622830927f, 0.556975543f},
-std::array<float,2>{0.284504533f, 0.299522728f},
-std::array<float,2>{0.373386681f, 0.95785898f},
-std::array<float,2>{0.501681209f, 0.173560783f},
-std::array<float,2>{0.999654233f, 0.642041743f},
-std::array<float,2>{0.0336897857f, 0.417518109f},
-std::array<float,2>{0.231572032f, 0.595949292f},
-std::array<float,2>{0.784765005f, 0.32262516f},
-std::array<float,2>{0.749110401f, 0.82412684f},
-std::array<float,2>{0.429540426f, 0.0887379646f},
-std::array<float,2>{0.406643152f, 0.57665813f},
-std::array<float,2>{0.722496092f, 0.373230129f},
-std::array<float,2>{0.81014204f, 0.845332026f},
-std::array<float,2>{0.245492324f, 0.123151436f},
-std::array<float,2>{0.0546756871f, 0.99827379f},
-std::array<float,2>{0.977241278f, 0.129976317f},
-std::array<float,2>{0.530175388f, 0.6640535f},
-std::array<float,2>{0.357830435f, 0.390594721f},
-std::array<float,2>{0.307182908f, 0.752741456f},
-std::array<float,2>{0.599767387f, 0.00752171595f},
-std::array<float,2>{0.880991518f, 0.529584289f},
-std::array<float,2>{0.110244177f, 0.26577428f},
-std::array<float,2>{0.162515968f, 0.737818241f},
-std::array<float,2>{0.814297616f, 0.49478668f},
-std::array<float,2>{0.67102617f, 0.925593019f},
-std::array<float,2>{0.488557577f, 0.235608757f},
-std::array<float,2>{0.34305352f, 0.62867105f},
-std::array<float,2>{0.547653615f, 0.431405157f},
-std::array<float,2>{0.943502009f, 0.939684212f},
-std::array<float,2>{0.0100079896f, 0.165259525f},
-std::array<float,2>{0.192210779f, 0.833042622f},
-std::array<float,2>{0.781242371f, 0.0776680335f},
-std::array<float,2>{0.708935082f, 0.616761982f},
-std::array<float,2>{0.395833492f, 0.34123826f},
-std::array<float,2>{0.440596193f, 0.878513217f},
-std::array<float,2>{0.648003757f, 0.188405305f},
-std::array<float,2>{0.843800664f, 0.701569915f},
-std::array<float,2>{0.152986526f, 0.460678041f},
-std::array<float,2>{0.0763076842f, 0.545393407f},
-std::array<float,2>{0.916433692f, 0.296217561f},
-std::array<float,2>{0.572202742f, 0.784933448f},
-std::array<float,2>{0.258868188f, 0.0392867699f},
-std::array<float,2>{0.344958365f, 0.622674048f},
-std::array<float,2>{0.523432791f, 0.333677858f},
-std::array<float,2>{0.976354241f, 0.842711985f},
-std::array<float,2>{0.0561536513f, 0.0678879619f},
-std::array<float,2>{0.241609216f, 0.952349007f},
-std::array<float,2>{0.80430609f, 0.162508667f},
-std::array<float,2>{0.72715348f, 0.640019178f},
-std::array<float,2>{0.418116063f, 0.422201127f},
-std::array<float,2>{0.495100021f, 0.79065764f},
-std::array<float,2>{0.660384119f, 0.033966843f},
-std::array<float,2>{0.821335256f, 0.536003113f},
-std::array<float,2>{0.168897003f, 0.284831524f},
-std::array<float,2>{0.120651796f, 0.688698292f},
-std::array<float,2>{0.884828985f, 0.468192697f},
-std::array<float,2>{0.606204629f, 0.887302577f},
-std::array<float,2>{0.296960294f, 0.196304798f},
-std::array<float,2>{0.400240451f, 0.668060958f},
-std::array<float,2>{0.714955926f, 0.381493866f},
-std::array<float,2>{0.770510256f, 0.990527093f},
-std::array<float,2>{0.202160552f, 0.136066049f},
-std::array<float,2>{0.00155497808f, 0.852332413f},
-std::array<float,2>{0.952637613f, 0.112261772f},
-std::array<float,2>{0.559267998f, 0.564817071f},
-std::array<float,2>{0.331731856f, 0.361678213f},
-std::array<float,2>{0.254864186f, 0.937264025f},
-std::array<float,2>{0.567080677f, 0.244137377f},
-std::array<float,2>{0.910880983f, 0.74802494f},
-std::array<float,2>{0.0678400472f, 0.488052517f},
-std::array<float,2>{0.143492684f, 0.521825135f},
-std::array<float,2>{0.855236828f, 0.279144585f},
-std::array<float,2>{0.654354215f, 0.759160757f},
-std::array<float,2>{0.449294806f, 0.0153048681f},
-std::array<float,2>{0.46856159f, 0.547062337f},
-std::array<float,2>{0.633668184f, 0.30487743f},
-std::array<float,2>{0.874156296f, 0.804111183f},
-std::array<float,2>{0.138927788f, 0.053560622f},
-std::array<float,2>{0.0913834423f, 0.890722036f},
-std::array<float,2>{0.924097061f, 0.212126836f},
-std::array<float,2>{0.587213039f, 0.709917128f},
-std::array<float,2>{0.279343486f, 0.445336044f},
-std::array<float,2>{0.319004238f, 0.812514305f},
-std::array<float,2>{0.545253098f, 0.0842565149f},
-std::array<float,2>{0.954356015f, 0.608628452f},
-std::array<float,2>{0.0300727617f, 0.315944284f},
-std::array<float,2>{0.206340194f, 0.655048728f},
-std::array<float,2>{0.763047159f, 0.411978215f},
-std::array<float,2>{0.6999349f, 0.964592457f},
-std::array<float,2>{0.387216657f, 0.182023913f},
-std::array<float,2>{0.291796952f, 0.729811788f},
-std::array<float,2>{0.612736762f, 0.470878869f},
-std::array<float,2>{0.894586921f, 0.90659833f},
-std::array<float,2>{0.0939470753f, 0.218911156f},
-std::array<float,2>{0.173668131f, 0.778137565f},
-std::array<float,2>{0.836192012f, 0.0214306787f},
-std::array<float,2>{0.687131941f, 0.50580883f},
-std::array<float,2>{0.475963622f, 0.25639087f},
-std::array<float,2>{0.435464323f, 0.979416013f},
-std::array<float,2>{0.738032699f, 0.150532082f},
-std::array<float,2>{0.791952193f, 0.68202734f},
-std::array<float,2>{0.226416603f, 0.399143368f},
-std::array<float,2>{0.0455075614f, 0.586039603f},
-std::array<float,2>{0.987665653f, 0.356335491f},
-std::array<float,2>{0.513061702f, 0.86797899f},
-std::array<float,2>{0.364728719f, 0.0985335037f},
-std::array<float,2>{0.25230816f, 0.598703682f},
-std::array<float,2>{0.562940478f, 0.327722967f},
-std::array<float,2>{0.90636605f, 0.826682568f},
-std::array<float,2>{0.0658935681f, 0.0910687223f},
-std::array<float,2>{0.146724865f, 0.956545651f},
-std::array<float,2>{0.857024729f, 0.177940801f},
-std::array<float,2>{0.648678601f, 0.644535124f},
-std::array<float,2>{0.446322203f, 0.418037266f},
-std::array<float,2>{0.404025853f, 0.805037856f},
-std::array<float,2>{0.713882208f, 0.0605304614f},
-std::array<float,2>{0.766074955f, 0.561707735f},
-std::array<float,2>{0.198712483f, 0.302566856f},
-std::array<float,2>{0.00476747658f, 0.714038908f},
-std::array<float,2>{0.947355449f, 0.437744945f},
-std::array<float,2>{0.554942787f, 0.902758121f},
-std::array<float,2>{0.335773915f, 0.21037446f},
-std::array<float,2>{0.498511076f, 0.675667584f},
-std::array<float,2>{0.657372415f, 0.396322936f},
-std::array<float,2>{0.824377179f, 0.97087878f},
-std::array<float,2>{0.167795643f, 0.148130849f},
-std::array<float,2>{0.121781804f, 0.860351801f},
-std::array<float,2>{0.890365243f, 0.106054559f},
-std::array<float,2>{0.604292333f, 0.578505993f},
-std::array<float,2>{0.303716302f, 0.350282371f},
-std::array<float,2>{0.348523915f, 0.914228439f},
-std::array<float,2>{0.517683446f, 0.231954768f},
-std::array<float,2>{0.971647978f, 0.723206878f},
-std::array<float,2>{0.0587332174f, 0.478900731f},
-std::array<float,2>{0.235995218f, 0.51542598f},
-std::array<float,2>{0.800580204f, 0.264769137f},
-std::array<float,2>{0.732248068f, 0.772098064f},
-std::array<float,2>{0.417224705f, 0.0288512856f},
-std::array<float,2>{0.430044532f, 0.542387009f},
-std::array<float,2>{0.741138816f, 0.290679306f},
-std::array<float,2>{0.795051217f, 0.787543595f},
-std::array<float,2>{0.22053656f, 0.0444953293f},
-std::array<float,2>{0.0413138308f, 0.880967617f},
-std::array<float,2>{0.989167929f, 0.195051044f},
-std::array<float,2>{0.508168876f, 0.697131813f},
-std::array<float,2>{0.361257374f, 0.454334974f},
-std::array<float,2>{0.295227736f, 0.829878867f},
-std::array<float,2>{0.614547789f, 0.0735704377f},
-std::array<float,2>{0.891996026f, 0.612817466f},
-std::array<float,2>{0.0981638059f, 0.337888062f},
-std::array<float,2>{0.179187536f, 0.632257879f},
-std::array<float,2>{0.840206385f, 0.436129153f},
-std::array<float,2>{0.68253547f, 0.942938805f},
-std::array<float,2>{0.471841037f, 0.168741867f},
-std::array<float,2>{0.316360414f, 0.741563797f},
-std::array<float,2>{0.540125668f, 0.499340683f},
-std::array<float,2>{0.959293127f, 0.92644906f},
-std::array<float,2>{0.0267867092f, 0.239516363f},
-std::array<float,2>{0.20978865f, 0.754928231f},
-std::array<float,2>{0.760375977f, 0.00232881028f},
-std::array<float,2>{0.698121071f, 0.52353245f},
-std::array<float,2>{0.383250028f, 0.270629495f},
-std::array<float,2>{0.464580655f, 0.993094027f},
-std::array<float,2>{0.638081968f, 0.128208622f},
-std::array<float,2>{0.871025443f, 0.65899992f},
-std::array<float,2>{0.134906158f, 0.384122729f},
-std::array<float,2>{0.0893082097f, 0.572080016f},
-std::array<float,2>{0.92888242f, 0.367874026f},
-std::array<float,2>{0.591394007f, 0.851032674f},
-std::array<float,2>{0.277096301f, 0.119225919f},
-std::array<float,2>{0.370847762f, 0.518450737f},
-std::array<float,2>{0.507127047f, 0.275801659f},
-std::array<float,2>{0.995363653f, 0.761954427f},
-std::array<float,2>{0.0354568623f, 0.00788093079f},
-std::array<float,2>{0.228639156f, 0.933381379f},
-std::array<float,2>{0.788265765f, 0.248641878f},
-std::array<float,2>{0.743803024f, 0.74390626f},
-std::array<float,2>{0.425594896f, 0.489374876f},
-std::array<float,2>{0.47692886f, 0.85644275f},
-std::array<float,2>{0.675446928f, 0.114504613f},
-std::array<float,2>{0.830081522f, 0.569679022f},
-std::array<float,2>{0.187305823f, 0.363698334f},
-std::array<float,2>{0.107260548f, 0.665989816f},
-std::array<float,2>{0.898781419f, 0.375436574f},
-std::array<float,2>{0.618645787f, 0.986083865f},
-std::array<float,2>{0.287279695f, 0.137221605f},
-std::array<float,2>{0.375549257f, 0.691859365f},
-std::array<float,2>{0.688850701f, 0.464529157f},
-std::array<float,2>{0.755118847f, 0.883591056f},
-std::array<float,2>{0.215539724f, 0.202270046f},
-std::array<float,2>{0.0206520502f, 0.793318808f},
-std::array<float,2>{0.966703713f, 0.0354586281f},
-std::array<float,2>{0.53289032f, 0.533915102f},
-std::array<float,2>{0.326526165f, 0.288818151f},
-std::array<float,2>{0.266028166f, 0.947686136f},
-std::array<float,2>{0.582303226f, 0.158096418f},
-std::array<float,2>{0.930527329f, 0.633838177f},
-std::array<float,2>{0.0818516687f, 0.426253885f},
-std::array<float,2>{0.1306701f, 0.62051177f},
-std::array<float,2>{0.866294503f, 0.329818457f},
-std::array<float,2>{0.632707536f, 0.836028993f},
-std::array<float,2>{0.45607233f, 0.0638639033f},
-std::array<float,2>{0.444990963f, 0.59315455f},
-std::array<float,2>{0.642985106f, 0.354112387f},
-std::array<float,2>{0.84819448f, 0.87116915f},
-std::array<float,2>{0.149297893f, 0.0955308005f},
-std::array<float,2>{0.0730713606f, 0.982974172f},
-std::array<float,2>{0.921872139f, 0.155319378f},
-std::array<float,2>{0.578000903f, 0.685546517f},
-std::array<float,2>{0.263237119f, 0.405479163f},
-std::array<float,2>{0.338381141f, 0.775392532f},
-std::array<float,2>{0.551878512f, 0.0178198293f},
-std::array<float,2>{0.938115001f, 0.502669036f},
-std::array<float,2>{0.0148975449f, 0.250729442f},
-std::array<float,2>{0.188527152f, 0.734104156f},
-std::array<float,2>{0.776850581f, 0.473539501f},
-std::array<float,2>{0.703912377f, 0.912459612f},
-std::array<float,2>{0.39165315f, 0.226424664f},
-std::array<float,2>{0.312217742f, 0.648644507f},
-std::array<float,2>{0.59627974f, 0.409490287f},
-std::array<float,2>{0.877426803f, 0.965426087f},
-std::array<float,2>{0.114114888f, 0.184065923f},
-std::array<float,2>{0.156401902f, 0.818296671f},
-std::array<float,2>{0.819864511f, 0.0796013847f},
-std::array<float,2>{0.664184451f, 0.604910135f},
-std::array<float,2>{0.485078067f, 0.317573994f},
-std::array<float,2>{0.411206931f, 0.897614777f},
-std::array<float,2>{0.724390805f, 0.216144979f},
-std::array<float,2>{0.806693733f, 0.703732014f},
-std::array<float,2>{0.249991715f, 0.45121333f},
-std::array<float,2>{0.0506281033f, 0.550845385f},
-std::array<float,2>{0.982799113f, 0.311232477f},
-std::array<float,2>{0.525853455f, 0.797860146f},
-std::array<float,2>{0.352301598f, 0.0483217835f},
-std::array<float,2>{0.282546699f, 0.556566238f},
-std::array<float,2>{0.624210358f, 0.298252285f},
-std::array<float,2>{0.903787613f, 0.809849143f},
-std::array<float,2>{0.104440354f, 0.0585398637f},
-std::array<float,2>{0.180776238f, 0.899249673f},
-std::array<float,2>{0.834675252f, 0.205980048f},
-std::array<float,2>{0.675912678f, 0.718144774f},
-std::array<float,2>{0.484266698f, 0.445203215f},
-std::array<float,2>{0.426423639f, 0.820911825f},
-std::array<float,2>{0.746586144f, 0.0866662264f},
-std::array<float,2>{0.782234728f, 0.595119953f},
-std::array<float,2>{0.233166218f, 0.321792066f},
-std::array<float,2>{0.033056289f, 0.644320905f},
-std::array<float,2>{0.996415615f, 0.415420502f},
-std::array<float,2>{0.502608776f, 0.959163129f},
-std::array<float,2>{0.371157199f, 0.175529569f},
-std::array<float,2>{0.460880518f, 0.721749306f},
-std::array<float,2>{0.628575325f, 0.484329015f},
-std::array<float,2>{0.860838652f, 0.919180095f},
-std::array<float,2>{0.126000345f, 0.228431702f},
-std::array<float,2>{0.0845094025f, 0.765889347f},
-std::array<float,2>{0.933974862f, 0.0251665637f},
-std::array<float,2>{0.580465555f, 0.510149479f},
-std::array<float,2>{0.27078864f, 0.258527964f},
-std::array<float,2>{0.32128486f, 0.976208508f},
-std::array<float,2>{0.538352072f, 0.144169107f},
-std::array<float,2>{0.961581826f, 0.67797482f},
-std::array<float,2>{0.0193200149f, 0.392844945f},
-std::array<float,2>{0.213198781f, 0.584531486f},
-std::array<float,2>{0.751367152f, 0.346819252f},
-std::array<float,2>{0.694661856f, 0.865731537f},
-std::array<float,2>{0.38062796f, 0.10339132f},
-std::array<float,2>{0.39767313f, 0.61501807f},
-std::array<float,2>{0.710664093f, 0.34278971f},
-std::array<float,2>{0.777910411f, 0.835345268f},
-std::array<float,2>{0.193750888f, 0.0752795339f},
-std::array<float,2>{0.00838434231f, 0.93795234f},
-std::array<float,2>{0.942887843f, 0.166529313f},
-std::array<float,2>{0.549708366f, 0.625048816f},
-std::array<float,2>{0.341769695f, 0.432925433f},
-std::array<float,2>{0.260212898f, 0.781975269f},
-std::array<float,2>{0.572778642f, 0.0417988114f},
-std::array<float,2>{0.91467154f, 0.544877291f},
-std::array<float,2>{0.0755313262f, 0.293255389f},
-std::array<float,2>{0.155227274f, 0.700069606f},
-std::array<float,2>{0.84763515f, 0.458130091f},
-std::array<float,2>{0.644900858f, 0.87557745f},
-std::array<float,2>{0.43918246f, 0.190146133f},
-std::array<float,2>{0.355686367f, 0.66131264f},
-std::array<float,2>{0.528833926f, 0.387151271f},
-std::array<float,2>{0.97853142f, 0.996659756f},
-std::array<float,2>{0.0515143424f, 0.131343156f},
-std::array<float,2>{0.24406904f, 0.847112894f},
-std::array<float,2>{0.810755074f, 0.121982679f},
-std::array<float,2>{0.718853056f, 0.575799406f},
-std::array<float,2>{0.408385456f, 0.373011529f},
-std::array<float,2>{0.490429729f, 0.923819005f},
-std::array<float,2>{0.669324219f, 0.237043247f},
-std::array<float,2>{0.814472616f, 0.734671772f},
-std::array<float,2>{0.161760733f, 0.492428482f},
-std::array<float,2>{0.113044046f, 0.529076338f},
-std::array<float,2>{0.879099131f, 0.2694152f},
-std::array<float,2>{0.598050535f, 0.751097977f},
-std::array<float,2>{0.306351334f, 0.00468427083f},
-std::array<float,2>{0.328342676f, 0.564130664f},
-std::array<float,2>{0.561564505f, 0.359570295f},
-std::array<float,2>{0.950315058f, 0.855302811f},
-std::array<float,2>{0.00347412797f, 0.110688649f},
-std::array<float,2>{0.200241253f, 0.989934742f},
-std::array<float,2>{0.77249068f, 0.133788645f},
-std::array<float,2>{0.718485355f, 0.671025455f},
-std::array<float,2>{0.401600778f, 0.379061341f},
-std::array<float,2>{0.452286482f, 0.761249483f},
-std::array<float,2>{0.652956665f, 0.0122269569f},
-std::array<float,2>{0.85194397f, 0.52053237f},
-std::array<float,2>{0.140733629f, 0.28103444f},
-std::array<float,2>{0.0692369267f, 0.749870598f},
-std::array<float,2>{0.913365901f, 0.485753149f},
-std::array<float,2>{0.56959635f, 0.934099436f},
-std::array<float,2>{0.257559717f, 0.245238855f},
-std::array<float,2>{0.420210093f, 0.637228429f},
-std::array<float,2>{0.729773462f, 0.424919426f},
-std::array<float,2>{0.80240649f, 0.950156033f},
-std::array<float,2>{0.239038557f, 0.160337806f},
-std::array<float,2>{0.058584135f, 0.84101665f},
-std::array<float,2>{0.973804176f, 0.068475388f},
-std::array<float,2>{0.51975441f, 0.624549508f},
-std::array<float,2>{0.346408606f, 0.335223556f},
-std::array<float,2>{0.298921198f, 0.889669299f},
-std::array<float,2>{0.608360946f, 0.197924301f},
-std::array<float,2>{0.883549988f, 0.689771652f},
-std::array<float,2>{0.118709967f, 0.465437204f},
-std::array<float,2>{0.170871809f, 0.538125396f},
-std::array<float,2>{0.823271751f, 0.281597048f},
-std::array<float,2>{0.662901223f, 0.792750955f},
-std::array<float,2>{0.492667109f, 0.032277938f},
-std::array<float,2>{0.473328888f, 0.506347179f},
-std::array<float,2>{0.68445605f, 0.254284859f},
-std::array<float,2>{0.838628113f, 0.780609369f},
-std::array<float,2>{0.175006106f, 0.0228592567f},
-std::array<float,2>{0.096130304f, 0.909904122f},
-std::array<float,2>{0.898381233f, 0.221190512f},
-std::array<float,2>{0.610386312f, 0.72825855f},
-std::array<float,2>{0.290701061f, 0.470071614f},
-std::array<float,2>{0.366905212f, 0.870443165f},
-std::array<float,2>{0.514623165f, 0.100377947f},
-std::array<float,2>{0.986125052f, 0.588252783f},
-std::array<float,2>{0.0439078324f, 0.358040482f},
-std::array<float,2>{0.223054975f, 0.681095541f},
-std::array<float,2>{0.790661156f, 0.400698155f},
-std::array<float,2>{0.734585226f, 0.977739692f},
-std::array<float,2>{0.435786933f, 0.149084374f},
-std::array<float,2>{0.279110938f, 0.707251191f},
-std::array<float,2>{0.588517785f, 0.447357744f},
-std::array<float,2>{0.922237515f, 0.894110382f},
-std::array<float,2>{0.0926249176f, 0.213021323f},
-std::array<float,2>{0.13811478f, 0.801601887f},
-std::array<float,2>{0.872672141f, 0.0510035232f},
-std::array<float,2>{0.635269761f, 0.550194979f},
-std::array<float,2>{0.465167552f, 0.308186769f},
-std::array<float,2>{0.389959425f, 0.961938322f},
-std::array<float,2>{0.701752722f, 0.181260407f},
-std::array<float,2>{0.764079452f, 0.652895927f},
-std::array<float,2>{0.203408629f, 0.413011998f},
-std::array<float,2>{0.0278006885f, 0.607294798f},
-std::array<float,2>{0.95538187f, 0.312664896f},
-std::array<float,2>{0.54373771f, 0.815070927f},
-std::array<float,2>{0.318169802f, 0.0826811269f},
-std::array<float,2>{0.275623798f, 0.573462248f},
-std::array<float,2>{0.590625942f, 0.370318055f},
-std::array<float,2>{0.928275883f, 0.847756505f},
-std::array<float,2>{0.0885662511f, 0.117775545f},
-std::array<float,2>{0.135918677f, 0.995567381f},
-std::array<float,2>{0.869705021f, 0.1259574f},
-std::array<float,2>{0.636777222f, 0.657728255f},
-std::array<float,2>{0.463786691f, 0.385656804f},
-std::array<float,2>{0.384115189f, 0.756595254f},
-std::array<float,2>{0.698391378f, 0.00177294773f},
-std::array<float,2>{0.761320829f, 0.526166677f},
-std::array<float,2>{0.210037798f, 0.271786988f},
-std::array<float,2>{0.0258632861f, 0.739207625f},
-std::array<float,2>{0.960422695f, 0.496849209f},
-std::array<float,2>{0.539817035f, 0.929617405f},
-std::array<float,2>{0.315217644f, 0.241792142f},
-std::array<float,2>{0.471354038f, 0.630538166f},
-std::array<float,2>{0.68312335f, 0.434824049f},
-std::array<float,2>{0.841475546f, 0.945068181f},
-std::array<float,2>{0.178465918f, 0.171203509f},
-std::array<float,2>{0.0990213007f, 0.831208885f},
-std::array<float,2>{0.891477108f, 0.0712476447f},
-std::array<float,2>{0.614209592f, 0.609500289f},
-std::array<float,2>{0.296583951f, 0.33910495f},
-std::array<float,2>{0.360232562f, 0.880362153f},
-std::array<float,2>{0.508801162f, 0.191543251f},
-std::array<float,2>{0.989438057f, 0.699062765f},
-std::array<float,2>{0.0421980359f, 0.456242502f},
-std::array<float,2>{0.219082087f, 0.540174127f},
-std::array<float,2>{0.795960665f, 0.291561455f},
-std::array<float,2>{0.741562963f, 0.785214663f},
-std::array<float,2>{0.430855989f, 0.0461667441f},
-std::array<float,2>{0.416325629f, 0.512250662f},
-std::array<float,2>{0.731110752f, 0.263553977f},
-std::array<float,2>{0.79928869f, 0.770218611f},
-std::array<float,2>{0.234969631f, 0.0299158245f},
-std::array<float,2>{0.0600100346f, 0.917746782f},
-std::array<float,2>{0.972651899f, 0.234011054f},
-std::array<float,2>{0.519329488f, 0.724632859f},
-std::array<float,2>{0.349122316f, 0.477197349f},
-std::array<float,2>{0.30299443f, 0.862814069f},
-std::array<float,2>{0.604649901f, 0.108846255f},
-std::array<float,2>{0.889426231f, 0.581013143f},
-std::array<float,2>{0.122072101f, 0.348778576f},
-std::array<float,2>{0.166870102f, 0.673780859f},
-std::array<float,2>{0.825256109f, 0.396756232f},
-std::array<float,2>{0.656795263f, 0.97068119f},
-std::array<float,2>{0.499434203f, 0.146440446f},
-std::array<float,2>{0.334418803f, 0.711419523f},
-std::array<float,2>{0.556459904f, 0.440772951f},
-std::array<float,2>{0.948437989f, 0.905831158f},
-std::array<float,2>{0.00512422761f, 0.208914667f},
-std::array<float,2>{0.197297707f, 0.808588207f},
-std::array<float,2>{0.766885102f, 0.0613333173f},
-std::array<float,2>{0.713009059f, 0.559244871f},
-std::array<float,2>{0.40303579f, 0.303288072f},
-std::array<float,2>{0.445950687f, 0.953771055f},
-std::array<float,2>{0.649620593f, 0.176657006f},
-std::array<float,2>{0.855880857f, 0.647975266f},
-std::array<float,2>{0.148084849f, 0.42064932f},
-std::array<float,2>{0.0646588728f, 0.600984573f},
-std::array<float,2>{0.907875121f, 0.325086683f},
-std::array<float,2>{0.563774526f, 0.824382722f},
-std::array<float,2>{0.253426075f, 0.0924140736f},
-std::array<float,2>{0.353357732f, 0.554179609f},
-std::array<float,2>{0.52661407f, 0.309128284f},
-std::array<float,2>{0.98386991f, 0.799075365f},
-std::array<float,2>{0.049064368f, 0.0505287088f},
-std::array<float,2>{0.248858616f, 0.89575249f},
-std::array<float,2>{0.807852507f, 0.217235371f},
-std::array<float,2>{0.722686112f, 0.706830144f},
-std::array<float,2>{0.410343945f, 0.450607657f},
-std::array<float,2>{0.485652834f, 0.818395853f},
-std::array<float,2>{0.665446401f, 0.080657959f},
-std::array<float,2>{0.818834662f, 0.603126824f},
-std::array<float,2>{0.157852858f, 0.319317967f},
-std::array<float,2>{0.115011536f, 0.65050149f},
-std::array<float,2>{0.878152668f, 0.406536222f},
-std::array<float,2>{0.596758604f, 0.968276083f},
-std::array<float,2>{0.310911685f, 0.186107308f},
-std::array<float,2>{0.391251117f, 0.731491148f},
-std::array<float,2>{0.704139829f, 0.475126594f},
-std::array<float,2>{0.77593118f, 0.910424829f},
-std::array<float,2>{0.187861174f, 0.222980976f},
-std::array<float,2>{0.0145008434f, 0.773708165f},
-std::array<float,2>{0.938535333f, 0.0165694039f},
-std::array<float,2>{0.550988793f, 0.501032412f},
-std::array<float,2>{0.339537621f, 0.253578842f},
-std::array<float,2>{0.261901468f, 0.980965018f},
-std::array<float,2>{0.57690078f, 0.152633697f},
-std::array<float,2>{0.920039296f, 0.686798215f},
-std::array<float,2>{0.0732754171f, 0.402456015f},
-std::array<float,2>{0.150091395f, 0.591231048f},
-std::array<float,2>{0.849170625f, 0.3532601f},
-std::array<float,2>{0.643872499f, 0.874519587f},
-std::array<float,2>{0.444299489f, 0.09690696f},
-std::array<float,2>{0.455263734f, 0.618231237f},
-std::array<float,2>{0.630969286f, 0.331371725f},
-std::array<float,2>{0.865753531f, 0.83918047f},
-std::array<float,2>{0.129519701f, 0.0645022616f},
-std::array<float,2>{0.0810263008f, 0.945388675f},
-std::array<float,2>{0.93136996f, 0.159374341f},
-std::array<float,2>{0.583844066f, 0.634957016f},
-std::array<float,2>{0.266628802f, 0.42948699f},
-std::array<float,2>{0.327571213f, 0.796362281f},
-std::array<float,2>{0.532108068f, 0.0371312201f},
-std::array<float,2>{0.965703249f, 0.533159316f},
-std::array<float,2>{0.0197528396f, 0.28560096f},
-std::array<float,2>{0.216484338f, 0.694835603f},
-std::array<float,2>{0.754059553f, 0.46142152f},
-std::array<float,2>{0.688033581f, 0.886096299f},
-std::array<float,2>{0.376060486f, 0.20019114f},
-std::array<float,2>{0.288292259f, 0.667533159f},
-std::array<float,2>{0.617398858f, 0.377008349f},
-std::array<float,2>{0.899701655f, 0.987939954f},
-std::array<float,2>{0.10600321f, 0.140127197f},
-std::array<float,2>{0.186080605f, 0.857613802f},
-std::array<float,2>{0.831816971f, 0.11632663f},
-std::array<float,2>{0.673946083f, 0.567476988f},
-std::array<float,2>{0.477859497f, 0.366298825f},
-std::array<float,2>{0.423931479f, 0.930179358f},
-std::array<float,2>{0.742985845f, 0.246525779f},
-std::array<float,2>{0.787530541f, 0.744516134f},
-std::array<float,2>{0.229568034f, 0.490263075f},
-std::array<float,2>{0.0365544967f, 0.516041875f},
-std::array<float,2>{0.995013535f, 0.274790823f},
-std::array<float,2>{0.506650984f, 0.764084578f},
-std::array<float,2>{0.36941123f, 0.0099672759f},
-std::array<float,2>{0.305072665f, 0.531012058f},
-std::array<float,2>{0.599458635f, 0.267465025f},
-std::array<float,2>{0.880102515f, 0.753649175f},
-std::array<float,2>{0.111537799f, 0.00592453824f},
-std::array<float,2>{0.1603567f, 0.924071074f},
-std::array<float,2>{0.816008329f, 0.234759703f},
-std::array<float,2>{0.668591499f, 0.737196743f},
-std::array<float,2>{0.491520822f, 0.495754242f},
-std::array<float,2>{0.409764498f, 0.844384849f},
-std::array<float,2>{0.719870448f, 0.124275833f},
-std::array<float,2>{0.811693966f, 0.577400029f},
-std::array<float,2>{0.242778331f, 0.374675512f},
-std::array<float,2>{0.0526814461f, 0.662907422f},
-std::array<float,2>{0.979657412f, 0.389633f},
-std::array<float,2>{0.528123498f, 0.99993223f},
-std::array<float,2>{0.356906176f, 0.12928766f},
-std::array<float,2>{0.437524527f, 0.703031182f},
-std::array<float,2>{0.646238208f, 0.459024936f},
-std::array<float,2>{0.846094489f, 0.877630055f},
-std::array<float,2>{0.155561611f, 0.189151645f},
-std::array<float,2>{0.0744437203f, 0.78344363f},
-std::array<float,2>{0.915446579f, 0.0405026004f},
-std::array<float,2>{0.573474169f, 0.546112776f},
-std::array<float,2>{0.261418432f, 0.295140982f},
-std::array<float,2>{0.340037495f, 0.941323817f},
-std::array<float,2>{0.550152361f, 0.164084107f},
-std::array<float,2>{0.942322373f, 0.627160072f},
-std::array<float,2>{0.00889391545f, 0.429713786f},
-std::array<float,2>{0.194433779f, 0.615667701f},
-std::array<float,2>{0.778628409f, 0.340535313f},
-std::array<float,2>{0.709432483f, 0.832036853f},
-std::array<float,2>{0.396863461f, 0.0766675696f},
-std::array<float,2>{0.379558176f, 0.582131147f},
-std::array<float,2>{0.694225669f, 0.344266474f},
-std::array<float,2>{0.750180483f, 0.863571584f},
-std::array<float,2>{0.214316308f, 0.104714893f},
-std::array<float,2>{0.0179066099f, 0.973960757f},
-std::array<float,2>{0.962744594f, 0.140741959f},
-std::array<float,2>{0.537516177f, 0.676120579f},
-std::array<float,2>{0.322190404f, 0.391329587f},
-std::array<float,2>{0.269669861f, 0.768993795f},
-std::array<float,2>{0.581455886f, 0.0262273178f},
-std::array<float,2>{0.934598088f, 0.507950604f},
-std::array<float,2>{0.0857343227f, 0.26080519f},
-std::array<float,2>{0.12583749f, 0.719260275f},
-std::array<float,2>{0.860049963f, 0.482325554f},
-std::array<float,2>{0.627219915f, 0.920602143f},
-std::array<float,2>{0.459110349f, 0.229497775f},
-std::array<float,2>{0.372625202f, 0.641003609f},
-std::array<float,2>{0.503590047f, 0.416049004f},
-std::array<float,2>{0.997788012f, 0.958500922f},
-std::array<float,2>{0.0317893401f, 0.171959072f},
-std::array<float,2>{0.234289363f, 0.82272929f},
-std::array<float,2>{0.781438112f, 0.0889833793f},
-std::array<float,2>{0.747333705f, 0.597152174f},
-std::array<float,2>{0.427180707f, 0.324127197f},
-std::array<float,2>{0.482842088f, 0.901857793f},
-std::array<float,2>{0.677302241f, 0.204035789f},
-std::array<float,2>{0.835169971f, 0.715625226f},
-std::array<float,2>{0.180351213f, 0.442689985f},
-std::array<float,2>{0.104509167f, 0.558485746f},
-std::array<float,2>{0.903097451f, 0.299933404f},
-std::array<float,2>{0.623936594f, 0.810589671f},
-std::array<float,2>{0.281865001f, 0.0556444265f},
-std::array<float,2>{0.317222089f, 0.607787192f},
-std::array<float,2>{0.544071615f, 0.315174997f},
-std::array<float,2>{0.956649184f, 0.813507318f},
-std::array<float,2>{0.0290506575f, 0.0858442634f},
-std::array<float,2>{0.205053777f, 0.963446021f},
-std::array<float,2>{0.765488625f, 0.182899654f},
-std::array<float,2>{0.702836335f, 0.655625761f},
-std::array<float,2>{0.388758034f, 0.410552979f},
-std::array<float,2>{0.466104001f, 0.803234935f},
-std::array<float,2>{0.636281312f, 0.0542989895f},
-std::array<float,2>{0.871971965f, 0.548434973f},
-std::array<float,2>{0.137552828f, 0.305743396f},
-std::array<float,2>{0.0933420733f, 0.710631371f},
-std::array<float,2>{0.923098743f, 0.446899354f},
-std::array<float,2>{0.589699805f, 0.892460644f},
-std::array<float,2>{0.2779724f, 0.210959688f},
-std::array<float,2>{0.43664518f, 0.683006048f},
-std::array<float,2>{0.736187875f, 0.399877906f},
-std::array<float,2>{0.789584637f, 0.979896367f},
-std::array<float,2>{0.223717272f, 0.151547119f},
-std::array<float,2>{0.0440716185f, 0.868760288f},
-std::array<float,2>{0.985295475f, 0.0993586183f},
-std::array<float,2>{0.51560545f, 0.587637901f},
-std::array<float,2>{0.365928888f, 0.356470555f},
-std::array<float,2>{0.289374143f, 0.907868624f},
-std::array<float,2>{0.610221505f, 0.220041335f},
-std::array<float,2>{0.897193611f, 0.728877902f},
-std::array<float,2>{0.0967595279f, 0.472390145f},
-std::array<float,2>{0.173855796f, 0.504081845f},
-std::array<float,2>{0.839082539f, 0.25768134f},
-std::array<float,2>{0.685011566f, 0.779178858f},
-std::array<float,2>{0.474400371f, 0.0200130492f},
-std::array<float,2>{0.493478954f, 0.536621153f},
-std::array<float,2>{0.663845658f, 0.284074545f},
-std::array<float,2>{0.822827816f, 0.789534032f},
-std::array<float,2>{0.17157498f, 0.0345432051f},
-std::array<float,2>{0.117547154f, 0.888101935f},
-std::array<float,2>{0.883826435f, 0.195420042f},
-std::array<float,2>{0.609056413f, 0.687903821f},
-std::array<float,2>{0.299805075f, 0.46772939f},
-std::array<float,2>{0.346945435f, 0.843363643f},
-std::array<float,2>{0.521391809f, 0.0666923076f},
-std::array<float,2>{0.972922385f, 0.621548951f},
-std::array<float,2>{0.0566831008f, 0.332508624f},
-std::array<float,2>{0.239499912f, 0.638683796f},
-std::array<float,2>{0.801257193f, 0.423728019f},
-std::array<float,2>{0.729202747f, 0.951194942f},
-std::array<float,2>{0.421573669f, 0.163738504f},
-std::array<float,2>{0.256645352f, 0.746285796f},
-std::array<float,2>{0.568770111f, 0.48710826f},
-std::array<float,2>{0.912901819f, 0.935970902f},
-std::array<float,2>{0.0700425729f, 0.243029118f},
-std::array<float,2>{0.142217234f, 0.758462191f},
-std::array<float,2>{0.85327518f, 0.0137917763f},
-std::array<float,2>{0.654032588f, 0.522805154f},
-std::array<float,2>{0.451852441f, 0.278275013f},
-std::array<float,2>{0.400832742f, 0.991283298f},
-std::array<float,2>{0.717648923f, 0.135548592f},
-std::array<float,2>{0.771755695f, 0.669185817f},
-std::array<float,2>{0.199517712f, 0.382551312f},
-std::array<float,2>{0.00250421045f, 0.565675974f},
-std::array<float,2>{0.949687779f, 0.362461716f},
-std::array<float,2>{0.56088388f, 0.853068352f},
-std::array<float,2>{0.329797715f, 0.112996511f},
-std::array<float,2>{0.294341028f, 0.612065732f},
-std::array<float,2>{0.61551249f, 0.336832762f},
-std::array<float,2>{0.893322051f, 0.828966558f},
-std::array<float,2>{0.0997807011f, 0.0728336126f},
-std::array<float,2>{0.176212445f, 0.941640258f},
-std::array<float,2>{0.843639433f, 0.169774741f},
-std::array<float,2>{0.681178808f, 0.631116092f},
-std::array<float,2>{0.470383078f, 0.437462628f},
-std::array<float,2>{0.433446318f, 0.788112938f},
-std::array<float,2>{0.739793777f, 0.043174915f},
-std::array<float,2>{0.793183208f, 0.541979134f},
-std::array<float,2>{0.220866784f, 0.289444149f},
-std::array<float,2>{0.0396195501f, 0.695405602f},
-std::array<float,2>{0.991419494f, 0.453242511f},
-std::array<float,2>{0.510633767f, 0.882332802f},
-std::array<float,2>{0.362785131f, 0.19337368f},
-std::array<float,2>{0.462084234f, 0.659564435f},
-std::array<float,2>{0.640257716f, 0.383696318f},
-std::array<float,2>{0.869098127f, 0.993915856f},
-std::array<float,2>{0.133945599f, 0.127869233f},
-std::array<float,2>{0.0874940977f, 0.850049257f},
-std::array<float,2>{0.927208841f, 0.12073867f},
-std::array<float,2>{0.592071235f, 0.570487797f},
-std::array<float,2>{0.273795336f, 0.368330926f},
-std::array<float,2>{0.314221531f, 0.927405894f},
-std::array<float,2>{0.542941749f, 0.239149973f},
-std::array<float,2>{0.958492875f, 0.741047978f},
-std::array<float,2>{0.0238856915f, 0.498446375f},
-std::array<float,2>{0.20834212f, 0.525037646f},
-std::array<float,2>{0.757860899f, 0.27017796f},
-std::array<float,2>{0.696504891f, 0.754760563f},
-std::array<float,2>{0.38501668f, 0.00344252051f},
-std::array<float,2>{0.404732406f, 0.56057024f},
-std::array<float,2>{0.712108135f, 0.301120907f},
-std::array<float,2>{0.767785966f, 0.806483507f},
-std::array<float,2>{0.197201177f, 0.0595218875f},
-std::array<float,2>{0.0071628117f, 0.904184699f},
-std::array<float,2>{0.946516216f, 0.209660977f},
-std::array<float,2>{0.55853188f, 0.713721395f},
-std::array<float,2>{0.333816469f, 0.4393498f},
-std::array<float,2>{0.251928061f, 0.827922106f},
-std::array<float,2>{0.565312624f, 0.0904626623f},
-std::array<float,2>{0.908691406f, 0.598402739f},
-std::array<float,2>{0.064077206f, 0.326488853f},
-std::array<float,2>{0.145617664f, 0.645516157f},
-std::array<float,2>{0.85932982f, 0.419885784f},
-std::array<float,2>{0.651194155f, 0.955537975f},
-std::array<float,2>{0.448136717f, 0.179313198f},
-std::array<float,2>{0.351197302f, 0.723992586f},
-std::array<float,2>{0.517538249f, 0.480311781f},
-std::array<float,2>{0.970252693f, 0.915868461f},
-std::array<float,2>{0.0606702194f, 0.230828494f},
-std::array<float,2>{0.237869829f, 0.772761345f},
-std::array<float,2>{0.797395527f, 0.0277845915f},
-std::array<float,2>{0.734206855f, 0.514588475f},
-std::array<float,2>{0.41406408f, 0.264113128f},
-std::array<float,2>{0.49683556f, 0.972042859f},
-std::array<float,2>{0.658774555f, 0.14742732f},
-std::array<float,2>{0.827884376f, 0.674301326f},
-std::array<float,2>{0.164372891f, 0.394944996f},
-std::array<float,2>{0.12413314f, 0.579510391f},
-std::array<float,2>{0.887652636f, 0.351052284f},
-std::array<float,2>{0.603042603f, 0.859556854f},
-std::array<float,2>{0.301016659f, 0.106596798f},
-std::array<float,2>{0.337286144f, 0.50365293f},
-std::array<float,2>{0.553410172f, 0.251488328f},
-std::array<float,2>{0.940305889f, 0.776943684f},
-std::array<float,2>{0.0131237283f, 0.0193783231f},
-std::array<float,2>{0.189493448f, 0.913213074f},
-std::array<float,2>{0.774942815f, 0.22461243f},
-std::array<float,2>{0.706267715f, 0.733199f},
-std::array<float,2>{0.393256754f, 0.473996431f},
-std::array<float,2>{0.442244172f, 0.87285769f},
-std::array<float,2>{0.640629053f, 0.0939816087f},
-std::array<float,2>{0.849937916f, 0.592270732f},
-std::array<float,2>{0.150798261f, 0.354846895f},
-std::array<float,2>{0.0713647604f, 0.68411088f},
-std::array<float,2>{0.919149518f, 0.405218273f},
-std::array<float,2>{0.576164186f, 0.983862698f},
-std::array<float,2>{0.265208393f, 0.154393062f},
-std::array<float,2>{0.41341117f, 0.704201877f},
-std::array<float,2>{0.725060165f, 0.452743828f},
-std::array<float,2>{0.805187583f, 0.897301674f},
-std::array<float,2>{0.2472516f, 0.215195119f},
-std::array<float,2>{0.0474608131f, 0.797350764f},
-std::array<float,2>{0.982039511f, 0.0474499427f},
-std::array<float,2>{0.524596989f, 0.551916718f},
-std::array<float,2>{0.354154736f, 0.312381774f},
-std::array<float,2>{0.309800029f, 0.966515064f},
-std::array<float,2>{0.594249547f, 0.184855133f},
-std::array<float,2>{0.876057804f, 0.649907827f},
-std::array<float,2>{0.115585394f, 0.409162134f},
-std::array<float,2>{0.158922479f, 0.60401839f},
-std::array<float,2>{0.818143964f, 0.317362666f},
-std::array<float,2>{0.666741967f, 0.817337632f},
-std::array<float,2>{0.48821339f, 0.0787958875f},
-std::array<float,2>{0.480333775f, 0.5684219f},
-std::array<float,2>{0.672922552f, 0.365163386f},
-std::array<float,2>{0.828479886f, 0.856462777f},
-std::array<float,2>{0.184700534f, 0.114069372f},
-std::array<float,2>{0.108856916f, 0.985074818f},
-std::array<float,2>{0.902284265f, 0.138638273f},
-std::array<float,2>{0.619937479f, 0.664917707f},
-std::array<float,2>{0.285601884f, 0.376725733f},
-std::array<float,2>{0.369094878f, 0.763546586f},
-std::array<float,2>{0.50555557f, 0.00963194109f},
-std::array<float,2>{0.992452085f, 0.519044876f},
-std::array<float,2>{0.0389546789f, 0.277267873f},
-std::array<float,2>{0.228047684f, 0.742333591f},
-std::array<float,2>{0.786122024f, 0.488285661f},
-std::array<float,2>{0.745899141f, 0.931911051f},
-std::array<float,2>{0.422320157f, 0.249482781f},
-std::array<float,2>{0.268705815f, 0.632952154f},
-std::array<float,2>{0.584443092f, 0.427320004f},
-std::array<float,2>{0.932131231f, 0.948837042f},
-std::array<float,2>{0.0785823837f, 0.156791523f},
-std::array<float,2>{0.131009161f, 0.837417424f},
-std::array<float,2>{0.863652647f, 0.0632300004f},
-std::array<float,2>{0.630402744f, 0.619467437f},
-std::array<float,2>{0.454683661f, 0.328979552f},
-std::array<float,2>{0.378248274f, 0.884705305f},
-std::array<float,2>{0.689999282f, 0.202100039f},
-std::array<float,2>{0.756020725f, 0.692948341f},
-std::array<float,2>{0.217864916f, 0.463152736f},
-std::array<float,2>{0.0229176115f, 0.534319878f},
-std::array<float,2>{0.967664182f, 0.287515849f},
-std::array<float,2>{0.533473909f, 0.794465065f},
-std::array<float,2>{0.324383885f, 0.0364131853f},
-std::array<float,2>{0.258776963f, 0.543891311f},
-std::array<float,2>{0.570691705f, 0.294129729f},
-std::array<float,2>{0.917633176f, 0.782527506f},
-std::array<float,2>{0.0772399232f, 0.0424235761f},
-std::array<float,2>{0.153517157f, 0.876506746f},
-std::array<float,2>{0.845174134f, 0.190480769f},
-std::array<float,2>{0.646912396f, 0.70104754f},
-std::array<float,2>{0.439797193f, 0.457146853f},
-std::array<float,2>{0.395382404f, 0.834076107f},
-std::array<float,2>{0.707808912f, 0.0742188692f},
-std::array<float,2>{0.779574037f, 0.613710344f},
-std::array<float,2>{0.192858651f, 0.342175156f},
-std::array<float,2>{0.0109594176f, 0.626517355f},
-std::array<float,2>{0.945123911f, 0.431787282f},
-std::array<float,2>{0.548750341f, 0.938596129f},
-std::array<float,2>{0.342213988f, 0.167866066f},
-std::array<float,2>{0.489875466f, 0.735563159f},
-std::array<float,2>{0.670796037f, 0.493694663f},
-std::array<float,2>{0.812507331f, 0.922672749f},
-std::array<float,2>{0.16348967f, 0.237819284f},
-std::array<float,2>{0.111274071f, 0.750069261f},
-std::array<float,2>{0.882561445f, 0.00578745082f},
-std::array<float,2>{0.601017296f, 0.527850389f},
-std::array<float,2>{0.307877183f, 0.268497318f},
-std::array<float,2>{0.35860011f, 0.998031676f},
-std::array<float,2>{0.531131983f, 0.132496461f},
-std::array<float,2>{0.978369296f, 0.660554051f},
-std::array<float,2>{0.0536241792f, 0.388638943f},
-std::array<float,2>{0.244304925f, 0.575004876f},
-std::array<float,2>{0.808598816f, 0.371431649f},
-std::array<float,2>{0.720767319f, 0.8457551f},
-std::array<float,2>{0.407297403f, 0.122575603f},
-std::array<float,2>{0.428675503f, 0.594298184f},
-std::array<float,2>{0.748799384f, 0.320927471f},
-std::array<float,2>{0.783849776f, 0.822040081f},
-std::array<float,2>{0.230836347f, 0.0871908665f},
-std::array<float,2>{0.0347525552f, 0.960455537f},
-std::array<float,2>{0.998503327f, 0.174104124f},
-std::array<float,2>{0.500621378f, 0.642937064f},
-std::array<float,2>{0.37454468f, 0.414872676f},
-std::array<float,2>{0.283683717f, 0.808762193f},
-std::array<float,2>{0.621948481f, 0.0570001937f},
-std::array<float,2>{0.904645383f, 0.555398703f},
-std::array<float,2>{0.102242075f, 0.297812253f},
-std::array<float,2>{0.182798848f, 0.716912925f},
-std::array<float,2>{0.832214594f, 0.443607897f},
-std::array<float,2>{0.679226875f, 0.899458468f},
-std::array<float,2>{0.481812596f, 0.206851974f},
-std::array<float,2>{0.322884798f, 0.679104865f},
-std::array<float,2>{0.536502123f, 0.394257963f},
-std::array<float,2>{0.964835823f, 0.974663913f},
-std::array<float,2>{0.0159382373f, 0.14344281f},
-std::array<float,2>{0.211261302f, 0.866774082f},
-std::array<float,2>{0.753661871f, 0.102442756f},
-std::array<float,2>{0.692472458f, 0.585790396f},
-std::array<float,2>{0.381478816f, 0.346421272f},
-std::array<float,2>{0.457438946f, 0.918619394f},
-std::array<float,2>{0.626891315f, 0.227373108f},
-std::array<float,2>{0.862397552f, 0.7215994f},
-std::array<float,2>{0.127908453f, 0.482906103f},
-std::array<float,2>{0.0827281997f, 0.511156857f},
-std::array<float,2>{0.937261581f, 0.259588271f},
-std::array<float,2>{0.579611242f, 0.766941011f},
-std::array<float,2>{0.271621019f, 0.0235339869f},
-std::array<float,2>{0.363381386f, 0.589598775f},
-std::array<float,2>{0.512464225f, 0.358920455f},
-std::array<float,2>{0.986899078f, 0.869492829f},
-std::array<float,2>{0.0459197834f, 0.101460293f},
-std::array<float,2>{0.224943206f, 0.976893961f},
-std::array<float,2>{0.792661726f, 0.149871975f},
-std::array<float,2>{0.736524463f, 0.679805756f},
-std::array<float,2>{0.433865428f, 0.401880622f},
-std::array<float,2>{0.475408792f, 0.779878676f},
-std::array<float,2>{0.686505377f, 0.022052858f},
-std::array<float,2>{0.837692738f, 0.507133901f},
-std::array<float,2>{0.172198966f, 0.255031168f},
-std::array<float,2>{0.0952651724f, 0.726868033f},
-std::array<float,2>{0.895774961f, 0.469413102f},
-std::array<float,2>{0.611412406f, 0.908990681f},
-std::array<float,2>{0.292194039f, 0.222146764f},
-std::array<float,2>{0.388048738f, 0.653389752f},
-std::array<float,2>{0.701000929f, 0.413711101f},
-std::array<float,2>{0.762284696f, 0.961876452f},
-std::array<float,2>{0.205742106f, 0.179797649f},
-std::array<float,2>{0.0309566278f, 0.816393018f},
-std::array<float,2>{0.953459024f, 0.0837892294f},
-std::array<float,2>{0.545987725f, 0.60603708f},
-std::array<float,2>{0.320212215f, 0.313907415f},
-std::array<float,2>{0.280682266f, 0.893032253f},
-std::array<float,2>{0.586836874f, 0.214193866f},
-std::array<float,2>{0.925175786f, 0.708112776f},
-std::array<float,2>{0.0907389f, 0.449097604f},
-std::array<float,2>{0.140501365f, 0.549431384f},
-std::array<float,2>{0.873125136f, 0.307256162f},
-std::array<float,2>{0.634557009f, 0.802223027f},
-std::array<float,2>{0.467711538f, 0.0523704737f},
-std::array<float,2>{0.450823843f, 0.520019948f},
-std::array<float,2>{0.656138361f, 0.280181587f},
-std::array<float,2>{0.854472399f, 0.760661066f},
-std::array<float,2>{0.143900096f, 0.0132176336f},
-std::array<float,2>{0.0664075911f, 0.935317576f},
-std::array<float,2>{0.912001848f, 0.244828671f},
-std::array<float,2>{0.567423522f, 0.748696625f},
-std::array<float,2>{0.255009323f, 0.48453027f},
-std::array<float,2>{0.330515146f, 0.854030669f},
-std::array<float,2>{0.559609056f, 0.109381676f},
-std::array<float,2>{0.951906204f, 0.562811434f},
-std::array<float,2>{0.000834220555f, 0.36072731f},
-std::array<float,2>{0.201560512f, 0.670346618f},
-std::array<float,2>{0.769904912f, 0.380599737f},
-std::array<float,2>{0.716172695f, 0.989181936f},
-std::array<float,2>{0.398502499f, 0.134346187f},
-std::array<float,2>{0.298738956f, 0.69081378f},
-std::array<float,2>{0.606463909f, 0.466468155f},
-std::array<float,2>{0.886158586f, 0.888701975f},
-std::array<float,2>{0.119814374f, 0.198735505f},
-std::array<float,2>{0.169749692f, 0.791396677f},
-std::array<float,2>{0.820521772f, 0.0320397429f},
-std::array<float,2>{0.661803067f, 0.53761518f},
-std::array<float,2>{0.495229691f, 0.282756716f},
-std::array<float,2>{0.419122279f, 0.950416267f},
-std::array<float,2>{0.727563739f, 0.161904737f},
-std::array<float,2>{0.803388894f, 0.637706578f},
-std::array<float,2>{0.240737021f, 0.423951179f},
-std::array<float,2>{0.0549124181f, 0.623656511f},
-std::array<float,2>{0.974996865f, 0.334909946f},
-std::array<float,2>{0.521569729f, 0.840355873f},
-std::array<float,2>{0.34460175f, 0.0701400489f},
-std::array<float,2>{0.285972476f, 0.567993343f},
-std::array<float,2>{0.619394422f, 0.367145091f},
-std::array<float,2>{0.901545584f, 0.85830754f},
-std::array<float,2>{0.108995654f, 0.117154844f},
-std::array<float,2>{0.18543525f, 0.987412155f},
-std::array<float,2>{0.828747034f, 0.140541464f},
-std::array<float,2>{0.673340976f, 0.667394876f},
-std::array<float,2>{0.479802698f, 0.377612263f},
-std::array<float,2>{0.42267099f, 0.764371037f},
-std::array<float,2>{0.745266557f, 0.010371903f},
-std::array<float,2>{0.785556316f, 0.516546726f},
-std::array<float,2>{0.22797218f, 0.275169313f},
-std::array<float,2>{0.0380942561f, 0.744988859f},
-std::array<float,2>{0.992946565f, 0.491053224f},
-std::array<float,2>{0.505295455f, 0.929758728f},
-std::array<float,2>{0.368183285f, 0.246807024f},
-std::array<float,2>{0.454528302f, 0.635720432f},
-std::array<float,2>{0.629887581f, 0.428772271f},
-std::array<float,2>{0.864057779f, 0.945819795f},
-std::array<float,2>{0.131764978f, 0.159811258f},
-std::array<float,2>{0.0790940374f, 0.839632273f},
-std::array<float,2>{0.931802332f, 0.0651717335f},
-std::array<float,2>{0.584626734f, 0.618930042f},
-std::array<float,2>{0.269241333f, 0.331767857f},
-std::array<float,2>{0.32506752f, 0.886278868f},
-std::array<float,2>{0.534134984f, 0.199374855f},
-std::array<float,2>{0.967065871f, 0.694420815f},
-std::array<float,2>{0.0229896661f, 0.461832613f},
-std::array<float,2>{0.218456298f, 0.532393336f},
-std::array<float,2>{0.756519198f, 0.285960615f},
-std::array<float,2>{0.689903855f, 0.796870589f},
-std::array<float,2>{0.378447562f, 0.0377080888f},
-std::array<float,2>{0.392716289f, 0.50181675f},
-std::array<float,2>{0.706800222f, 0.253205329f},
-std::array<float,2>{0.774659693f, 0.773994982f},
-std::array<float,2>{0.190398619f, 0.0157287326f},
-std::array<float,2>{0.0133718001f, 0.910938263f},
-std::array<float,2>{0.939936161f, 0.22359556f},
-std::array<float,2>{0.552787244f, 0.732419193f},
-std::array<float,2>{0.337627947f, 0.474699467f},
-std::array<float,2>{0.264769584f, 0.874367893f},
-std::array<float,2>{0.5753268f, 0.0972749218f},
-std::array<float,2>{0.919802129f, 0.591383755f},
-std::array<float,2>{0.0717843249f, 0.352737546f},
-std::array<float,2>{0.151003301f, 0.687062979f},
-std::array<float,2>{0.850105524f, 0.403133005f},
-std::array<float,2>{0.641258359f, 0.980911672f},
-std::array<float,2>{0.441505164f, 0.152967632f},
-std::array<float,2>{0.354003549f, 0.706314445f},
-std::array<float,2>{0.525081694f, 0.451064259f},
-std::array<float,2>{0.981686413f, 0.896098912f},
-std::array<float,2>{0.0471973307f, 0.217725664f},
-std::array<float,2>{0.24779588f, 0.799580097f},
-std::array<float,2>{0.804726183f, 0.0500714816f},
-std::array<float,2>{0.725530386f, 0.554565012f},
-std::array<float,2>{0.413812578f, 0.308594674f},
-std::array<float,2>{0.487333447f, 0.968204081f},
-std::array<float,2>{0.666502833f, 0.185988903f},
-std::array<float,2>{0.817576766f, 0.651307225f},
-std::array<float,2>{0.158606306f, 0.407139897f},
-std::array<float,2>{0.11616379f, 0.602917433f},
-std::array<float,2>{0.876594782f, 0.318518221f},
-std::array<float,2>{0.593941867f, 0.819218993f},
-std::array<float,2>{0.310486376f, 0.0805347413f},
-std::array<float,2>{0.333050877f, 0.558981359f},
-std::array<float,2>{0.557952404f, 0.302737266f},
-std::array<float,2>{0.947035015f, 0.807739079f},
-std::array<float,2>{0.0075710048f, 0.0609833859f},
-std::array<float,2>{0.196394354f, 0.905481219f},
-std::array<float,2>{0.768439174f, 0.20805569f},
-std::array<float,2>{0.71284914f, 0.71187067f},
-std::array<float,2>{0.405022234f, 0.441232324f},
-std::array<float,2>{0.447590113f, 0.824712634f},
-std::array<float,2>{0.650816023f, 0.0918270051f},
-std::array<float,2>{0.85854733f, 0.601116776f},
-std::array<float,2>{0.146064848f, 0.324493319f},
-std::array<float,2>{0.0634942874f, 0.647483945f},
-std::array<float,2>{0.909047365f, 0.420192212f},
-std::array<float,2>{0.564574122f, 0.953448951f},
-std::array<float,2>{0.251178771f, 0.176233277f},
-std::array<float,2>{0.414924204f, 0.725195527f},
-std::array<float,2>{0.733472347f, 0.477002144f},
-std::array<float,2>{0.797076643f, 0.917455435f},
-std::array<float,2>{0.237592399f, 0.233641312f},
-std::array<float,2>{0.0612417124f, 0.769579351f},
-std::array<float,2>{0.970077097f, 0.0296039321f},
-std::array<float,2>{0.516858697f, 0.511978269f},
-std::array<float,2>{0.350860566f, 0.262983084f},
-std::array<float,2>{0.301494628f, 0.970031738f},
-std::array<float,2>{0.60262388f, 0.145666733f},
-std::array<float,2>{0.887052298f, 0.673089325f},
-std::array<float,2>{0.124529451f, 0.397149712f},
-std::array<float,2>{0.16479288f, 0.580284715f},
-std::array<float,2>{0.827589512f, 0.349242151f},
-std::array<float,2>{0.658341646f, 0.862661004f},
-std::array<float,2>{0.496387213f, 0.109303586f},
-std::array<float,2>{0.469957173f, 0.609872818f},
-std::array<float,2>{0.681005359f, 0.339502424f},
-std::array<float,2>{0.84277606f, 0.831907928f},
-std::array<float,2>{0.176317409f, 0.0703685284f},
-std::array<float,2>{0.100390583f, 0.94479841f},
-std::array<float,2>{0.892922342f, 0.171696976f},
-std::array<float,2>{0.61577785f, 0.630311549f},
-std::array<float,2>{0.294834256f, 0.435380727f},
-std::array<float,2>{0.363049835f, 0.785839498f},
-std::array<float,2>{0.509788275f, 0.0463886783f},
-std::array<float,2>{0.991731167f, 0.540546834f},
-std::array<float,2>{0.0393897742f, 0.29118976f},
-std::array<float,2>{0.221240446f, 0.698503554f},
-std::array<float,2>{0.793482542f, 0.456725538f},
-std::array<float,2>{0.739457965f, 0.880692601f},
-std::array<float,2>{0.432942569f, 0.192160442f},
-std::array<float,2>{0.274071395f, 0.657461882f},
-std::array<float,2>{0.592744291f, 0.385102183f},
-std::array<float,2>{0.927664042f, 0.995920539f},
-std::array<float,2>{0.087196447f, 0.125017658f},
-std::array<float,2>{0.134288102f, 0.848356128f},
-std::array<float,2>{0.868377984f, 0.117531694f},
-std::array<float,2>{0.639790893f, 0.573971331f},
-std::array<float,2>{0.462765425f, 0.370624036f},
-std::array<float,2>{0.385438979f, 0.928852201f},
-std::array<float,2>{0.697064638f, 0.241556302f},
-std::array<float,2>{0.758363605f, 0.738288701f},
-std::array<float,2>{0.208877608f, 0.496313512f},
-std::array<float,2>{0.0241011605f, 0.525592506f},
-std::array<float,2>{0.95851171f, 0.27216664f},
-std::array<float,2>{0.542351186f, 0.756214559f},
-std::array<float,2>{0.313763261f, 0.00144615676f},
-std::array<float,2>{0.255705595f, 0.52308017f},
-std::array<float,2>{0.567983449f, 0.277605414f},
-std::array<float,2>{0.911469162f, 0.757855952f},
-std::array<float,2>{0.0673520491f, 0.0143343378f},
-std::array<float,2>{0.144091681f, 0.93636483f},
-std::array<float,2>{0.853682458f, 0.242382184f},
-std::array<float,2>{0.655332267f, 0.746814728f},
-std::array<float,2>{0.450578302f, 0.486597478f},
-std::array<float,2>{0.399267644f, 0.852627635f},
-std::array<float,2>{0.716493845f, 0.112457253f},
-std::array<float,2>{0.770276725f, 0.5663293f},
-std::array<float,2>{0.202090412f, 0.363157898f},
-std::array<float,2>{0.000373839226f, 0.669743299f},
-std::array<float,2>{0.951652408f, 0.381876886f},
-std::array<float,2>{0.560362279f, 0.991833031f},
-std::array<float,2>{0.330671728f, 0.134815156f},
-std::array<float,2>{0.495686948f, 0.688102722f},
-std::array<float,2>{0.661303341f, 0.466899514f},
-std::array<float,2>{0.820829391f, 0.888574421f},
-std::array<float,2>{0.169041902f, 0.196275041f},
-std::array<float,2>{0.11928834f, 0.789890528f},
-std::array<float,2>{0.886239231f, 0.0348837264f},
-std::array<float,2>{0.607165217f, 0.536294222f},
-std::array<float,2>{0.297991604f, 0.283315539f},
-std::array<float,2>{0.343798906f, 0.952097297f},
-std::array<float,2>{0.522314906f, 0.163546532f},
-std::array<float,2>{0.975513279f, 0.639570892f},
-std::array<float,2>{0.0553263761f, 0.422941834f},
-std::array<float,2>{0.240356937f, 0.621704638f},
-std::array<float,2>{0.803067207f, 0.332608253f},
-std::array<float,2>{0.728223383f, 0.843064368f},
-std::array<float,2>{0.41980204f, 0.0672824234f},
-std::array<float,2>{0.434208542f, 0.587297857f},
-std::array<float,2>{0.737240911f, 0.357061982f},
-std::array<float,2>{0.792391181f, 0.868465781f},
-std::array<float,2>{0.225441098f, 0.0989885032f},
-std::array<float,2>{0.0467806309f, 0.980262935f},
-std::array<float,2>{0.986815333f, 0.152260184f},
-std::array<float,2>{0.511963069f, 0.683382094f},
-std::array<float,2>{0.36408174f, 0.399914294f},
-std::array<float,2>{0.292825162f, 0.778618455f},
-std::array<float,2>{0.611986518f, 0.0201140102f},
-std::array<float,2>{0.896426439f, 0.504451096f},
-std::array<float,2>{0.0947732478f, 0.256986648f},
-std::array<float,2>{0.172674835f, 0.729005575f},
-std::array<float,2>{0.836927056f, 0.472127706f},
-std::array<float,2>{0.685808897f, 0.907470226f},
-std::array<float,2>{0.474780887f, 0.220656127f},
-std::array<float,2>{0.319494754f, 0.655767024f},
-std::array<float,2>{0.54657048f, 0.410770416f},
-std::array<float,2>{0.953625917f, 0.963166952f},
-std::array<float,2>{0.0305883456f, 0.183325857f},
-std::array<float,2>{0.205281764f, 0.814247489f},
-std::array<float,2>{0.761895061f, 0.0853654817f},
-std::array<float,2>{0.700452983f, 0.608309507f},
-std::array<float,2>{0.388343751f, 0.314673394f},
-std::array<float,2>{0.46714437f, 0.891730547f},
-std::array<float,2>{0.633997738f, 0.211625874f},
-std::array<float,2>{0.873730242f, 0.71028471f},
-std::array<float,2>{0.140135333f, 0.44655025f},
-std::array<float,2>{0.0899227485f, 0.547862709f},
-std::array<float,2>{0.92561692f, 0.30647999f},
-std::array<float,2>{0.585995555f, 0.80310601f},
-std::array<float,2>{0.280787885f, 0.0537983477f},
-std::array<float,2>{0.374054939f, 0.597576499f},
-std::array<float,2>{0.500273347f, 0.323332012f},
-std::array<float,2>{0.998688638f, 0.822807789f},
-std::array<float,2>{0.0343622379f, 0.0894740447f},
-std::array<float,2>{0.231400296f, 0.958110034f},
-std::array<float,2>{0.783593476f, 0.172677442f},
-std::array<float,2>{0.748314202f, 0.641138136f},
-std::array<float,2>{0.427938044f, 0.416778326f},
-std::array<float,2>{0.481934071f, 0.811490715f},
-std::array<float,2>{0.678838849f, 0.0550415963f},
-std::array<float,2>{0.832708597f, 0.55777806f},
-std::array<float,2>{0.183427304f, 0.300348997f},
-std::array<float,2>{0.101858996f, 0.715012968f},
-std::array<float,2>{0.905129135f, 0.443255186f},
-std::array<float,2>{0.621395588f, 0.901406407f},
-std::array<float,2>{0.284024656f, 0.203549892f},
-std::array<float,2>{0.381160885f, 0.676657557f},
-std::array<float,2>{0.693097889f, 0.390742213f},
-std::array<float,2>{0.753290713f, 0.974530041f},
-std::array<float,2>{0.211455151f, 0.141191259f},
-std::array<float,2>{0.0161713753f, 0.863915145f},
-std::array<float,2>{0.963896871f, 0.105083495f},
-std::array<float,2>{0.536807895f, 0.582607985f},
-std::array<float,2>{0.322624087f, 0.343894839f},
-std::array<float,2>{0.272425622f, 0.92029947f},
-std::array<float,2>{0.579581916f, 0.230195716f},
-std::array<float,2>{0.936959922f, 0.719184875f},
-std::array<float,2>{0.0823761672f, 0.481847107f},
-std::array<float,2>{0.12714316f, 0.508354843f},
-std::array<float,2>{0.863200784f, 0.261592507f},
-std::array<float,2>{0.626159132f, 0.769493997f},
-std::array<float,2>{0.457877636f, 0.0254157912f},
-std::array<float,2>{0.440065593f, 0.546748698f},
-std::array<float,2>{0.647317708f, 0.295468301f},
-std::array<float,2>{0.84536624f, 0.78412801f},
-std::array<float,2>{0.154126763f, 0.0407826714f},
-std::array<float,2>{0.0779531449f, 0.877162516f},
-std::array<float,2>{0.917408705f, 0.188822463f},
-std::array<float,2>{0.570938587f, 0.70215714f},
-std::array<float,2>{0.257950634f, 0.459604651f},
-std::array<float,2>{0.342560947f, 0.832989872f},
-std::array<float,2>{0.547906697f, 0.0762891993f},
-std::array<float,2>{0.944484234f, 0.615887225f},
-std::array<float,2>{0.0112682087f, 0.340036899f},
-std::array<float,2>{0.193254471f, 0.627925634f},
-std::array<float,2>{0.77998513f, 0.430209279f},
-std::array<float,2>{0.707037091f, 0.940773487f},
-std::array<float,2>{0.394678921f, 0.164649725f},
-std::array<float,2>{0.308565021f, 0.736407638f},
-std::array<float,2>{0.60133642f, 0.495322347f},
-std::array<float,2>{0.882141232f, 0.924742043f},
-std::array<float,2>{0.110625423f, 0.235074997f},
-std::array<float,2>{0.163871273f, 0.753092587f},
-std::array<float,2>{0.813348353f, 0.00675436994f},
-std::array<float,2>{0.670248449f, 0.530596316f},
-std::array<float,2>{0.489529461f, 0.266877264f},
-std::array<float,2>{0.407773495f, 0.999430656f},
-std::array<float,2>{0.72153306f, 0.129725382f},
-std::array<float,2>{0.809298694f, 0.662195027f},
-std::array<float,2>{0.245095402f, 0.388855577f},
-std::array<float,2>{0.0530803613f, 0.577687144f},
-std::array<float,2>{0.97780323f, 0.374454081f},
-std::array<float,2>{0.530534267f, 0.843892336f},
-std::array<float,2>{0.358992517f, 0.124726422f},
-std::array<float,2>{0.267511874f, 0.619967818f},
-std::array<float,2>{0.583011806f, 0.32831046f},
-std::array<float,2>{0.930875063f, 0.837316692f},
-std::array<float,2>{0.0805463716f, 0.0628050715f},
-std::array<float,2>{0.129108042f, 0.948430002f},
-std::array<float,2>{0.865361035f, 0.156670421f},
-std::array<float,2>{0.631403387f, 0.633735657f},
-std::array<float,2>{0.455753475f, 0.426895946f},
-std::array<float,2>{0.376952499f, 0.794178605f},
-std::array<float,2>{0.687921882f, 0.036838159f},
-std::array<float,2>{0.754423618f, 0.534724653f},
-std::array<float,2>{0.21608384f, 0.287900805f},
-std::array<float,2>{0.0202313885f, 0.692867517f},
-std::array<float,2>{0.964973688f, 0.463854313f},
-std::array<float,2>{0.531282544f, 0.88404274f},
-std::array<float,2>{0.327735424f, 0.201590866f},
-std::array<float,2>{0.47837013f, 0.664129853f},
-std::array<float,2>{0.674800336f, 0.376306206f},
-std::array<float,2>{0.831169844f, 0.984502316f},
-std::array<float,2>{0.185575008f, 0.137827367f},
-std::array<float,2>{0.105952516f, 0.857009649f},
-std::array<float,2>{0.899910271f, 0.1135194f},
-std::array<float,2>{0.617900074f, 0.569236517f},
-std::array<float,2>{0.288954616f, 0.364556491f},
-std::array<float,2>{0.36982885f, 0.932383537f},
-std::array<float,2>{0.506036639f, 0.249729738f},
-std::array<float,2>{0.994628489f, 0.742723048f},
-std::array<float,2>{0.0367167853f, 0.489129514f},
-std::array<float,2>{0.230150536f, 0.518885791f},
-std::array<float,2>{0.78787303f, 0.276545644f},
-std::array<float,2>{0.742309093f, 0.763174653f},
-std::array<float,2>{0.424654484f, 0.00883338042f},
-std::array<float,2>{0.410812199f, 0.552532077f},
-std::array<float,2>{0.72330606f, 0.311604679f},
-std::array<float,2>{0.808447719f, 0.797686994f},
-std::array<float,2>{0.248169437f, 0.0470222645f},
-std::array<float,2>{0.0496499278f, 0.896662891f},
-std::array<float,2>{0.98406142f, 0.215451598f},
-std::array<float,2>{0.527123749f, 0.704846144f},
-std::array<float,2>{0.352751851f, 0.452501565f},
-std::array<float,2>{0.311185688f, 0.816665411f},
-std::array<float,2>{0.597574413f, 0.078565754f},
-std::array<float,2>{0.878706098f, 0.603813648f},
-std::array<float,2>{0.114724867f, 0.316886097f},
-std::array<float,2>{0.157606304f, 0.649424851f},
-std::array<float,2>{0.819264829f, 0.408581138f},
-std::array<float,2>{0.665793359f, 0.965850055f},
-std::array<float,2>{0.485962152f, 0.185094059f},
-std::array<float,2>{0.339110225f, 0.732749283f},
-std::array<float,2>{0.551501691f, 0.474386811f},
-std::array<float,2>{0.939422905f, 0.913989186f},
-std::array<float,2>{0.0137463799f, 0.225351602f},
-std::array<float,2>{0.188077912f, 0.776496053f},
-std::array<float,2>{0.775434136f, 0.0190280881f},
-std::array<float,2>{0.704973459f, 0.502984524f},
-std::array<float,2>{0.3907758f, 0.251383454f},
-std::array<float,2>{0.443650186f, 0.983919919f},
-std::array<float,2>{0.64422071f, 0.154984206f},
-std::array<float,2>{0.849071383f, 0.684009314f},
-std::array<float,2>{0.149616599f, 0.404341787f},
-std::array<float,2>{0.0741916522f, 0.592330694f},
-std::array<float,2>{0.920430064f, 0.355285287f},
-std::array<float,2>{0.57632494f, 0.872378707f},
-std::array<float,2>{0.262616664f, 0.0945511833f},
-std::array<float,2>{0.348863572f, 0.513904393f},
-std::array<float,2>{0.518649757f, 0.264629275f},
-std::array<float,2>{0.971927524f, 0.77329582f},
-std::array<float,2>{0.0601699501f, 0.028228119f},
-std::array<float,2>{0.234520584f, 0.915053725f},
-std::array<float,2>{0.799675345f, 0.231260374f},
-std::array<float,2>{0.730818629f, 0.724152207f},
-std::array<float,2>{0.416853666f, 0.479865253f},
-std::array<float,2>{0.49953115f, 0.860130072f},
-std::array<float,2>{0.656339824f, 0.107163593f},
-std::array<float,2>{0.825695634f, 0.580060065f},
-std::array<float,2>{0.166244209f, 0.351358324f},
-std::array<float,2>{0.122870922f, 0.67449671f},
-std::array<float,2>{0.889070392f, 0.395258427f},
-std::array<float,2>{0.605378151f, 0.972359776f},
-std::array<float,2>{0.303416342f, 0.146537662f},
-std::array<float,2>{0.402609199f, 0.712913632f},
-std::array<float,2>{0.713843465f, 0.438904822f},
-std::array<float,2>{0.767105579f, 0.903708875f},
-std::array<float,2>{0.197852433f, 0.209212363f},
-std::array<float,2>{0.00541112991f, 0.805829525f},
-std::array<float,2>{0.9490605f, 0.0587240905f},
-std::array<float,2>{0.555890083f, 0.561308801f},
-std::array<float,2>{0.334495902f, 0.301386327f},
-std::array<float,2>{0.252938956f, 0.955622673f},
-std::array<float,2>{0.564212859f, 0.178913683f},
-std::array<float,2>{0.907526314f, 0.646425426f},
-std::array<float,2>{0.0649960861f, 0.419329345f},
-std::array<float,2>{0.147477239f, 0.597920239f},
-std::array<float,2>{0.856433153f, 0.326694459f},
-std::array<float,2>{0.650113225f, 0.827387989f},
-std::array<float,2>{0.445532888f, 0.0898469016f},
-std::array<float,2>{0.463310421f, 0.571050644f},
-std::array<float,2>{0.637261391f, 0.369051039f},
-std::array<float,2>{0.8691926f, 0.8502056f},
-std::array<float,2>{0.136687011f, 0.120444402f},
-std::array<float,2>{0.0882203132f, 0.993563592f},
-std::array<float,2>{0.92805624f, 0.127270982f},
-std::array<float,2>{0.590010166f, 0.659810126f},
-std::array<float,2>{0.276268482f, 0.383187175f},
-std::array<float,2>{0.314497948f, 0.754086792f},
-std::array<float,2>{0.539367616f, 0.00312625431f},
-std::array<float,2>{0.960680902f, 0.524896026f},
-std::array<float,2>{0.0259208865f, 0.269728363f},
-std::array<float,2>{0.21062623f, 0.740324914f},
-std::array<float,2>{0.761113107f, 0.499021769f},
-std::array<float,2>{0.698764682f, 0.926900685f},
-std::array<float,2>{0.384420037f, 0.238291472f},
-std::array<float,2>{0.296053648f, 0.631426036f},
-std::array<float,2>{0.613391101f, 0.436715394f},
-std::array<float,2>{0.89068532f, 0.942002356f},
-std::array<float,2>{0.0991286933f, 0.169159129f},
-std::array<float,2>{0.178071439f, 0.828357816f},
-std::array<float,2>{0.841180623f, 0.0724925846f},
-std::array<float,2>{0.683093429f, 0.611681163f},
-std::array<float,2>{0.471090168f, 0.336375862f},
-std::array<float,2>{0.431209415f, 0.882182002f},
-std::array<float,2>{0.742156148f, 0.193868101f},
-std::array<float,2>{0.796464264f, 0.696113467f},
-std::array<float,2>{0.219438121f, 0.453834653f},
-std::array<float,2>{0.0427817069f, 0.541328907f},
-std::array<float,2>{0.99019748f, 0.289991051f},
-std::array<float,2>{0.509730697f, 0.788618147f},
-std::array<float,2>{0.359484732f, 0.043595355f},
-std::array<float,2>{0.300705492f, 0.537182033f},
-std::array<float,2>{0.608624995f, 0.282496363f},
-std::array<float,2>{0.884406626f, 0.791851521f},
-std::array<float,2>{0.117764488f, 0.0314849354f},
-std::array<float,2>{0.171072751f, 0.88956213f},
-std::array<float,2>{0.822740316f, 0.198269665f},
-std::array<float,2>{0.663157284f, 0.691398561f},
-std::array<float,2>{0.493886322f, 0.466106117f},
-std::array<float,2>{0.421362579f, 0.840236247f},
-std::array<float,2>{0.728822768f, 0.069373861f},
-std::array<float,2>{0.801547766f, 0.62310189f},
-std::array<float,2>{0.240019336f, 0.334123343f},
-std::array<float,2>{0.0571414158f, 0.638581991f},
-std::array<float,2>{0.973229587f, 0.424614906f},
-std::array<float,2>{0.520541012f, 0.950842023f},
-std::array<float,2>{0.347375453f, 0.161579609f},
-std::array<float,2>{0.451283127f, 0.748378217f},
-std::array<float,2>{0.653577745f, 0.485123426f},
-std::array<float,2>{0.852616906f, 0.934801996f},
-std::array<float,2>{0.141887352f, 0.244325757f},
-std::array<float,2>{0.0693883821f, 0.76017195f},
-std::array<float,2>{0.912267745f, 0.0131285787f},
-std::array<float,2>{0.56917578f, 0.519645691f},
-std::array<float,2>{0.256064981f, 0.279758334f},
-std::array<float,2>{0.32931149f, 0.988296211f},
-std::array<float,2>{0.561281443f, 0.133973777f},
-std::array<float,2>{0.949819565f, 0.670691073f},
-std::array<float,2>{0.00225877319f, 0.379973114f},
-std::array<float,2>{0.199849889f, 0.563201964f},
-std::array<float,2>{0.772248149f, 0.361125857f},
-std::array<float,2>{0.716908693f, 0.853523731f},
-std::array<float,2>{0.40130505f, 0.109934352f},
-std::array<float,2>{0.3894912f, 0.605615795f},
-std::array<float,2>{0.702165306f, 0.314239204f},
-std::array<float,2>{0.76508826f, 0.815604985f},
-std::array<float,2>{0.204242185f, 0.083238706f},
-std::array<float,2>{0.0286137071f, 0.961267292f},
-std::array<float,2>{0.956247687f, 0.180379361f},
-std::array<float,2>{0.544896901f, 0.654050291f},
-std::array<float,2>{0.316545874f, 0.413149297f},
-std::array<float,2>{0.277605474f, 0.802452028f},
-std::array<float,2>{0.589120269f, 0.0521308109f},
-std::array<float,2>{0.923678577f, 0.549228489f},
-std::array<float,2>{0.0930681601f, 0.306942403f},
-std::array<float,2>{0.136885941f, 0.708519459f},
-std::array<float,2>{0.87136656f, 0.448360413f},
-std::array<float,2>{0.636181653f, 0.893244505f},
-std::array<float,2>{0.466583669f, 0.214616001f},
-std::array<float,2>{0.36571604f, 0.680501223f},
-std::array<float,2>{0.514722943f, 0.401534498f},
-std::array<float,2>{0.984408081f, 0.977334857f},
-std::array<float,2>{0.0449020974f, 0.150289148f},
-std::array<float,2>{0.224182859f, 0.870008767f},
-std::array<float,2>{0.789254069f, 0.100820974f},
-std::array<float,2>{0.735647202f, 0.588892817f},
-std::array<float,2>{0.437290102f, 0.358810663f},
-std::array<float,2>{0.474116534f, 0.908215821f},
-std::array<float,2>{0.685472071f, 0.22231023f},
-std::array<float,2>{0.839581072f, 0.727511287f},
-std::array<float,2>{0.174644455f, 0.468914866f},
-std::array<float,2>{0.0971927717f, 0.507682502f},
-std::array<float,2>{0.896756828f, 0.255534828f},
-std::array<float,2>{0.6095348f, 0.77965641f},
-std::array<float,2>{0.289839417f, 0.0218439568f},
-std::array<float,2>{0.32161063f, 0.58519417f},
-std::array<float,2>{0.537716866f, 0.345835656f},
-std::array<float,2>{0.961925626f, 0.866562366f},
-std::array<float,2>{0.0185322613f, 0.101568833f},
-std::array<float,2>{0.214566693f, 0.975160062f},
-std::array<float,2>{0.750572145f, 0.142732069f},
-std::array<float,2>{0.693463266f, 0.679665983f},
-std::array<float,2>{0.379016519f, 0.393707395f},
-std::array<float,2>{0.45964095f, 0.76745528f},
-std::array<float,2>{0.627765477f, 0.0243957285f},
-std::array<float,2>{0.859773338f, 0.511430502f},
-std::array<float,2>{0.125371188f, 0.258833289f},
-std::array<float,2>{0.0851345882f, 0.721019447f},
-std::array<float,2>{0.93506074f, 0.482997209f},
-std::array<float,2>{0.581703901f, 0.918337464f},
-std::array<float,2>{0.270235866f, 0.226685137f},
-std::array<float,2>{0.427570969f, 0.643382311f},
-std::array<float,2>{0.747685552f, 0.414215505f},
-std::array<float,2>{0.782004774f, 0.960361958f},
-std::array<float,2>{0.233623981f, 0.174547687f},
-std::array<float,2>{0.031639263f, 0.821439326f},
-std::array<float,2>{0.997497618f, 0.0876243934f},
-std::array<float,2>{0.503310919f, 0.594132364f},
-std::array<float,2>{0.372305125f, 0.320629507f},
-std::array<float,2>{0.281568915f, 0.900208235f},
-std::array<float,2>{0.623320043f, 0.206071481f},
-std::array<float,2>{0.902518988f, 0.717416704f},
-std::array<float,2>{0.10529305f, 0.444018513f},
-std::array<float,2>{0.180124909f, 0.55493933f},
-std::array<float,2>{0.835585833f, 0.297298938f},
-std::array<float,2>{0.677134633f, 0.809310675f},
-std::array<float,2>{0.483059347f, 0.0573709942f},
-std::array<float,2>{0.491902918f, 0.527535141f},
-std::array<float,2>{0.668020844f, 0.268052459f},
-std::array<float,2>{0.815630138f, 0.750968158f},
-std::array<float,2>{0.160840482f, 0.00515932497f},
-std::array<float,2>{0.111881673f, 0.922278166f},
-std::array<float,2>{0.880372882f, 0.237573117f},
-std::array<float,2>{0.598793387f, 0.736120105f},
-std::array<float,2>{0.305546433f, 0.49363327f},
-std::array<float,2>{0.357326657f, 0.846441925f},
-std::array<float,2>{0.527827263f, 0.122410998f},
-std::array<float,2>{0.98032856f, 0.574377894f},
-std::array<float,2>{0.0519210026f, 0.371598125f},
-std::array<float,2>{0.242368013f, 0.660784602f},
-std::array<float,2>{0.812229097f, 0.387866735f},
-std::array<float,2>{0.720328212f, 0.997296512f},
-std::array<float,2>{0.409210861f, 0.132007286f},
-std::array<float,2>{0.260747731f, 0.700393498f},
-std::array<float,2>{0.574085653f, 0.457683504f},
-std::array<float,2>{0.915771246f, 0.876175761f},
-std::array<float,2>{0.07508035f, 0.191377774f},
-std::array<float,2>{0.156064004f, 0.782900751f},
-std::array<float,2>{0.846397877f, 0.0426415987f},
-std::array<float,2>{0.645793974f, 0.543122113f},
-std::array<float,2>{0.43823576f, 0.294797152f},
-std::array<float,2>{0.39741376f, 0.939142883f},
-std::array<float,2>{0.709732294f, 0.167325497f},
-std::array<float,2>{0.779112697f, 0.626106203f},
-std::array<float,2>{0.195256501f, 0.432296187f},
-std::array<float,2>{0.00974467024f, 0.614217877f},
-std::array<float,2>{0.9415766f, 0.342585117f},
-std::array<float,2>{0.55044961f, 0.834638894f},
-std::array<float,2>{0.340464085f, 0.0751686841f},
-std::array<float,2>{0.263095081f, 0.590457976f},
-std::array<float,2>{0.577421844f, 0.35188809f},
-std::array<float,2>{0.921040595f, 0.873678744f},
-std::array<float,2>{0.0726089254f, 0.0961264297f},
-std::array<float,2>{0.148555398f, 0.981803715f},
-std::array<float,2>{0.847671747f, 0.154139474f},
-std::array<float,2>{0.643122494f, 0.686351717f},
-std::array<float,2>{0.444353908f, 0.403707266f},
-std::array<float,2>{0.39243558f, 0.77503556f},
-std::array<float,2>{0.703250825f, 0.0170367341f},
-std::array<float,2>{0.776988804f, 0.500901818f},
-std::array<float,2>{0.189231604f, 0.252212763f},
-std::array<float,2>{0.0152450986f, 0.731010199f},
-std::array<float,2>{0.93759352f, 0.476351351f},
-std::array<float,2>{0.55224967f, 0.911960006f},
-std::array<float,2>{0.337939054f, 0.224421665f},
-std::array<float,2>{0.484728634f, 0.65182513f},
-std::array<float,2>{0.664836943f, 0.407660276f},
-std::array<float,2>{0.81955272f, 0.966935933f},
-std::array<float,2>{0.157095477f, 0.18666175f},
-std::array<float,2>{0.113747939f, 0.819799125f},
-std::array<float,2>{0.877894223f, 0.0818026662f},
-std::array<float,2>{0.596170545f, 0.602360249f},
-std::array<float,2>{0.311765164f, 0.319380254f},
-std::array<float,2>{0.351805091f, 0.894577503f},
-std::array<float,2>{0.526099145f, 0.217828974f},
-std::array<float,2>{0.983191252f, 0.705659807f},
-std::array<float,2>{0.0499190614f, 0.450141042f},
-std::array<float,2>{0.249152198f, 0.553506851f},
-std::array<float,2>{0.807432652f, 0.310129076f},
-std::array<float,2>{0.723883688f, 0.79980725f},
-std::array<float,2>{0.411661595f, 0.049668394f},
-std::array<float,2>{0.425290793f, 0.517110407f},
-std::array<float,2>{0.743335128f, 0.273570687f},
-std::array<float,2>{0.788587689f, 0.76470834f},
-std::array<float,2>{0.229251698f, 0.0111255227f},
-std::array<float,2>{0.035926532f, 0.931112647f},
-std::array<float,2>{0.995885491f, 0.247374624f},
-std::array<float,2>{0.507718384f, 0.745341957f},
-std::array<float,2>{0.370319963f, 0.49157548f},
-std::array<float,2>{0.288083106f, 0.859273076f},
-std::array<float,2>{0.618892014f, 0.115436465f},
-std::array<float,2>{0.899235129f, 0.566491961f},
-std::array<float,2>{0.106617309f, 0.365486622f},
-std::array<float,2>{0.186836436f, 0.666461289f},
-std::array<float,2>{0.830748558f, 0.378765374f},
-std::array<float,2>{0.674989522f, 0.986535311f},
-std::array<float,2>{0.477501571f, 0.139221817f},
-std::array<float,2>{0.327017516f, 0.693542123f},
-std::array<float,2>{0.532259166f, 0.462232172f},
-std::array<float,2>{0.965845644f, 0.885254264f},
-std::array<float,2>{0.0214290041f, 0.200355127f},
-std::array<float,2>{0.21514152f, 0.795422554f},
-std::array<float,2>{0.755821347f, 0.0383495875f},
-std::array<float,2>{0.689377367f, 0.531368256f},
-std::array<float,2>{0.375152171f, 0.286941826f},
-std::array<float,2>{0.456617385f, 0.946331203f},
-std::array<float,2>{0.632023036f, 0.158740923f},
-std::array<float,2>{0.866875172f, 0.635824382f},
-std::array<float,2>{0.129993469f, 0.427975237f},
-std::array<float,2>{0.0813417584f, 0.617536843f},
-std::array<float,2>{0.9298473f, 0.330400378f},
-std::array<float,2>{0.582682252f, 0.838060677f},
-std::array<float,2>{0.266133487f, 0.0656846091f},
-std::array<float,2>{0.360413104f, 0.539883137f},
-std::array<float,2>{0.508407831f, 0.292260438f},
-std::array<float,2>{0.988639832f, 0.786477625f},
-std::array<float,2>{0.041812066f, 0.044961255f},
-std::array<float,2>{0.220124513f, 0.878944993f},
-std::array<float,2>{0.795572877f, 0.192441002f},
-std::array<float,2>{0.740250707f, 0.697715759f},
-std::array<float,2>{0.430236578f, 0.455361575f},
-std::array<float,2>{0.472521573f, 0.830847979f},
-std::array<float,2>{0.681989908f, 0.0718818456f},
-std::array<float,2>{0.840808988f, 0.610749006f},
-std::array<float,2>{0.1794976f, 0.338578612f},
-std::array<float,2>{0.0979150236f, 0.629808903f},
-std::array<float,2>{0.892358243f, 0.433728814f},
-std::array<float,2>{0.614907742f, 0.94376272f},
-std::array<float,2>{0.295545816f, 0.170621321f},
-std::array<float,2>{0.383361518f, 0.740176558f},
-std::array<float,2>{0.697573245f, 0.497831196f},
-std::array<float,2>{0.76008445f, 0.928545415f},
-std::array<float,2>{0.209390059f, 0.240660384f},
-std::array<float,2>{0.0271288585f, 0.757539034f},
-std::array<float,2>{0.959529936f, 0.00093555596f},
-std::array<float,2>{0.540585041f, 0.527107835f},
-std::array<float,2>{0.315712422f, 0.272686124f},
-std::array<float,2>{0.276671618f, 0.994186342f},
-std::array<float,2>{0.591007411f, 0.125987083f},
-std::array<float,2>{0.929506063f, 0.656267047f},
-std::array<float,2>{0.0895834118f, 0.386088371f},
-std::array<float,2>{0.135358185f, 0.572884023f},
-std::array<float,2>{0.870220244f, 0.370088816f},
-std::array<float,2>{0.638340712f, 0.84894067f},
-std::array<float,2>{0.46390754f, 0.118172929f},
-std::array<float,2>{0.447035193f, 0.59963727f},
-std::array<float,2>{0.649347782f, 0.325416267f},
-std::array<float,2>{0.856636643f, 0.825413167f},
-std::array<float,2>{0.147453204f, 0.0935879499f},
-std::array<float,2>{0.0660225824f, 0.955008388f},
-std::array<float,2>{0.90673995f, 0.176770627f},
-std::array<float,2>{0.563199401f, 0.646978498f},
-std::array<float,2>{0.252797991f, 0.421013415f},
-std::array<float,2>{0.335056454f, 0.806949079f},
-std::array<float,2>{0.555187523f, 0.0616965517f},
-std::array<float,2>{0.948187411f, 0.55974257f},
-std::array<float,2>{0.00396283297f, 0.303737193f},
-std::array<float,2>{0.199190348f, 0.711941361f},
-std::array<float,2>{0.766288877f, 0.440317482f},
-std::array<float,2>{0.71437782f, 0.904367089f},
-std::array<float,2>{0.403799027f, 0.207114384f},
-std::array<float,2>{0.304675579f, 0.67274034f},
-std::array<float,2>{0.603528917f, 0.398396999f},
-std::array<float,2>{0.889680922f, 0.96892333f},
-std::array<float,2>{0.121351182f, 0.144720629f},
-std::array<float,2>{0.167164862f, 0.861758232f},
-std::array<float,2>{0.82483691f, 0.108219981f},
-std::array<float,2>{0.657738745f, 0.581294239f},
-std::array<float,2>{0.499003023f, 0.347763628f},
-std::array<float,2>{0.417806536f, 0.916817009f},
-std::array<float,2>{0.731738687f, 0.233104661f},
-std::array<float,2>{0.800153136f, 0.72647357f},
-std::array<float,2>{0.235782698f, 0.478124171f},
-std::array<float,2>{0.059372779f, 0.512858987f},
-std::array<float,2>{0.970723867f, 0.262606442f},
-std::array<float,2>{0.518483758f, 0.770588577f},
-std::array<float,2>{0.347827047f, 0.0310057327f},
-std::array<float,2>{0.290134549f, 0.504994333f},
-std::array<float,2>{0.611263335f, 0.255877584f},
-std::array<float,2>{0.897680521f, 0.777810872f},
-std::array<float,2>{0.0962795988f, 0.0206042919f},
-std::array<float,2>{0.175647199f, 0.906817555f},
-std::array<float,2>{0.838079274f, 0.21941942f},
-std::array<float,2>{0.683673382f, 0.730080366f},
-std::array<float,2>{0.472833246f, 0.471334487f},
-std::array<float,2>{0.436164618f, 0.867635131f},
-std::array<float,2>{0.735315502f, 0.0980979204f},
-std::array<float,2>{0.790353477f, 0.5865376f},
-std::array<float,2>{0.223283142f, 0.355522901f},
-std::array<float,2>{0.0432364531f, 0.682159901f},
-std::array<float,2>{0.985547662f, 0.398600042f},
-std::array<float,2>{0.513977408f, 0.978830934f},
-std::array<float,2>{0.366581529f, 0.15123792f},
-std::array<float,2>{0.465472788f, 0.709140122f},
-std::array<float,2>{0.635187626f, 0.446021229f},
-std::array<float,2>{0.872175217f, 0.89131254f},
-std::array<float,2>{0.138196468f, 0.212413028f},
-std::array<float,2>{0.0920634568f, 0.80444926f},
-std::array<float,2>{0.922604084f, 0.0530717298f},
-std::array<float,2>{0.588094592f, 0.547472775f},
-std::array<float,2>{0.278511316f, 0.305380881f},
-std::array<float,2>{0.317412287f, 0.963989139f},
-std::array<float,2>{0.543435514f, 0.182142541f},
-std::array<float,2>{0.95569694f, 0.654420137f},
-std::array<float,2>{0.0280015562f, 0.411330104f},
-std::array<float,2>{0.203807279f, 0.609252632f},
-std::array<float,2>{0.764610529f, 0.315916896f},
-std::array<float,2>{0.701246083f, 0.813109219f},
-std::array<float,2>{0.390232176f, 0.0845705941f},
-std::array<float,2>{0.401871026f, 0.565140963f},
-std::array<float,2>{0.717893362f, 0.362072915f},
-std::array<float,2>{0.77339673f, 0.851562798f},
-std::array<float,2>{0.200827166f, 0.111500263f},
-std::array<float,2>{0.00297449972f, 0.991004705f},
-std::array<float,2>{0.951107621f, 0.136623651f},
-std::array<float,2>{0.562425613f, 0.668882251f},
-std::array<float,2>{0.328905791f, 0.380935431f},
-std::array<float,2>{0.256861687f, 0.759572148f},
-std::array<float,2>{0.569844127f, 0.014721347f},
-std::array<float,2>{0.913634002f, 0.522058249f},
-std::array<float,2>{0.0684570596f, 0.278366864f},
-std::array<float,2>{0.141180754f, 0.747107208f},
-std::array<float,2>{0.8520841f, 0.487406373f},
-std::array<float,2>{0.652660906f, 0.936728776f},
-std::array<float,2>{0.452729404f, 0.243243992f},
-std::array<float,2>{0.346030295f, 0.640246272f},
-std::array<float,2>{0.520359039f, 0.422650367f},
-std::array<float,2>{0.974260032f, 0.953065634f},
-std::array<float,2>{0.0579773411f, 0.162920713f},
-std::array<float,2>{0.238431141f, 0.8421731f},
-std::array<float,2>{0.801768184f, 0.0675650761f},
-std::array<float,2>{0.730256081f, 0.622399807f},
-std::array<float,2>{0.420652956f, 0.333082378f},
-std::array<float,2>{0.493155897f, 0.886774004f},
-std::array<float,2>{0.662130058f, 0.196951792f},
-std::array<float,2>{0.823926032f, 0.688978374f},
-std::array<float,2>{0.170175821f, 0.4686625f},
-std::array<float,2>{0.118183069f, 0.535180628f},
-std::array<float,2>{0.883146703f, 0.284375459f},
-std::array<float,2>{0.607754886f, 0.790440619f},
-std::array<float,2>{0.299340129f, 0.0333377123f},
-std::array<float,2>{0.340873808f, 0.61668539f},
-std::array<float,2>{0.548984706f, 0.341360003f},
-std::array<float,2>{0.942493618f, 0.833918333f},
-std::array<float,2>{0.00797155686f, 0.0774934366f},
-std::array<float,2>{0.194009975f, 0.940124154f},
-std::array<float,2>{0.777555168f, 0.165917143f},
-std::array<float,2>{0.710210025f, 0.627989233f},
-std::array<float,2>{0.397981793f, 0.430784732f},
-std::array<float,2>{0.438536763f, 0.78418839f},
-std::array<float,2>{0.645313978f, 0.0400182791f},
-std::array<float,2>{0.846781671f, 0.54582262f},
-std::array<float,2>{0.154533088f, 0.296700448f},
-std::array<float,2>{0.0760895014f, 0.701788008f},
-std::array<float,2>{0.914126158f, 0.460330367f},
-std::array<float,2>{0.572710097f, 0.877999425f},
-std::array<float,2>{0.260737598f, 0.18770723f},
-std::array<float,2>{0.40869987f, 0.663453758f},
-std::array<float,2>{0.719579637f, 0.389884382f},
-std::array<float,2>{0.811149955f, 0.998875976f},
-std::array<float,2>{0.243211016f, 0.130468488f},
-std::array<float,2>{0.0512397029f, 0.844872177f},
-std::array<float,2>{0.979313731f, 0.123620518f},
-std::array<float,2>{0.528693318f, 0.576697111f},
-std::array<float,2>{0.356022149f, 0.373644412f},
-std::array<float,2>{0.305836856f, 0.924947739f},
-std::array<float,2>{0.598205864f, 0.235988498f},
-std::array<float,2>{0.879451454f, 0.737343252f},
-std::array<float,2>{0.112632319f, 0.494574934f},
-std::array<float,2>{0.161247045f, 0.530207276f},
-std::array<float,2>{0.814994454f, 0.266469091f},
-std::array<float,2>{0.669616997f, 0.752030432f},
-std::array<float,2>{0.491004556f, 0.0069211279f},
-std::array<float,2>{0.483401209f, 0.557313502f},
-std::array<float,2>{0.67671144f, 0.298882872f},
-std::array<float,2>{0.834162831f, 0.811704457f},
-std::array<float,2>{0.181312814f, 0.0560432859f},
-std::array<float,2>{0.10372556f, 0.900556505f},
-std::array<float,2>{0.904293656f, 0.204541489f},
-std::array<float,2>{0.62490344f, 0.716437817f},
-std::array<float,2>{0.283143491f, 0.441824824f},
-std::array<float,2>{0.371681273f, 0.823283494f},
-std::array<float,2>{0.502379656f, 0.0880653858f},
-std::array<float,2>{0.99675715f, 0.596636951f},
-std::array<float,2>{0.032687556f, 0.322830588f},
-std::array<float,2>{0.232805967f, 0.642501235f},
-std::array<float,2>{0.782743156f, 0.417082548f},
-std::array<float,2>{0.746326029f, 0.957161844f},
-std::array<float,2>{0.425911307f, 0.172961041f},
-std::array<float,2>{0.271143675f, 0.720550716f},
-std::array<float,2>{0.580709755f, 0.480796158f},
-std::array<float,2>{0.934178948f, 0.921285212f},
-std::array<float,2>{0.0841359496f, 0.229441717f},
-std::array<float,2>{0.126853123f, 0.768476486f},
-std::array<float,2>{0.860984743f, 0.0264945477f},
-std::array<float,2>{0.628117204f, 0.509397209f},
-std::array<float,2>{0.460244864f, 0.259846032f},
-std::array<float,2>{0.380271971f, 0.972817063f},
-std::array<float,2>{0.694871783f, 0.141912252f},
-std::array<float,2>{0.751630247f, 0.67698288f},
-std::array<float,2>{0.213845715f, 0.392452776f},
-std::array<float,2>{0.0190102011f, 0.583836615f},
-std::array<float,2>{0.961098015f, 0.34552595f},
-std::array<float,2>{0.53897351f, 0.864873171f},
-std::array<float,2>{0.320463091f, 0.103682831f},
-std::array<float,2>{0.308718443f, 0.605073392f},
-std::array<float,2>{0.594819248f, 0.3180677f},
-std::array<float,2>{0.875736713f, 0.817587554f},
-std::array<float,2>{0.116584018f, 0.079121463f},
-std::array<float,2>{0.159512267f, 0.96507591f},
-std::array<float,2>{0.816882253f, 0.184188858f},
-std::array<float,2>{0.667376041f, 0.649275899f},
-std::array<float,2>{0.486625373f, 0.409815103f},
-std::array<float,2>{0.412208945f, 0.798365951f},
-std::array<float,2>{0.725737691f, 0.0486262962f},
-std::array<float,2>{0.806222439f, 0.551693201f},
-std::array<float,2>{0.246644586f, 0.310691953f},
-std::array<float,2>{0.0479797274f, 0.703477442f},
-std::array<float,2>{0.980577648f, 0.451935887f},
-std::array<float,2>{0.52414149f, 0.898159921f},
-std::array<float,2>{0.354645133f, 0.216783658f},
-std::array<float,2>{0.442803621f, 0.684974968f},
-std::array<float,2>{0.642136514f, 0.405909956f},
-std::array<float,2>{0.851134479f, 0.982899189f},
-std::array<float,2>{0.151460394f, 0.155881345f},
-std::array<float,2>{0.0706310049f, 0.871950328f},
-std::array<float,2>{0.91821748f, 0.094892934f},
-std::array<float,2>{0.574936867f, 0.593701839f},
-std::array<float,2>{0.264487773f, 0.353576183f},
-std::array<float,2>{0.336042434f, 0.91277355f},
-std::array<float,2>{0.553988695f, 0.225598872f},
-std::array<float,2>{0.94116801f, 0.733592153f},
-std::array<float,2>{0.0118016405f, 0.472938508f},
-std::array<float,2>{0.191205263f, 0.502176821f},
-std::array<float,2>{0.773917317f, 0.250450909f},
-std::array<float,2>{0.706007361f, 0.776351213f},
-std::array<float,2>{0.393571824f, 0.0181542132f},
-std::array<float,2>{0.377384871f, 0.533589363f},
-std::array<float,2>{0.690900028f, 0.288518578f},
-std::array<float,2>{0.757144034f, 0.793753624f},
-std::array<float,2>{0.217400938f, 0.0358248316f},
-std::array<float,2>{0.0218278673f, 0.883178174f},
-std::array<float,2>{0.968321025f, 0.202759206f},
-std::array<float,2>{0.534961224f, 0.692027032f},
-std::array<float,2>{0.325418741f, 0.463966668f},
-std::array<float,2>{0.268249393f, 0.836577356f},
-std::array<float,2>{0.585883141f, 0.064142637f},
-std::array<float,2>{0.933192849f, 0.620904565f},
-std::array<float,2>{0.0800506398f, 0.329211354f},
-std::array<float,2>{0.132716849f, 0.634510338f},
-std::array<float,2>{0.864804983f, 0.426424444f},
-std::array<float,2>{0.629056454f, 0.947856784f},
-std::array<float,2>{0.453677416f, 0.157235265f},
-std::array<float,2>{0.36775592f, 0.743570149f},
-std::array<float,2>{0.504139304f, 0.489863753f},
-std::array<float,2>{0.994078159f, 0.933058679f},
-std::array<float,2>{0.0371130779f, 0.248081312f},
-std::array<float,2>{0.227162108f, 0.762670279f},
-std::array<float,2>{0.786791801f, 0.0083580967f},
-std::array<float,2>{0.744627178f, 0.517679274f},
-std::array<float,2>{0.423628598f, 0.276021838f},
-std::array<float,2>{0.478789657f, 0.985487103f},
-std::array<float,2>{0.672175169f, 0.137191594f},
-std::array<float,2>{0.829883635f, 0.66519177f},
-std::array<float,2>{0.183938608f, 0.375792861f},
-std::array<float,2>{0.108270288f, 0.570030689f},
-std::array<float,2>{0.901105344f, 0.364238501f},
-std::array<float,2>{0.620511353f, 0.855475128f},
-std::array<float,2>{0.286215693f, 0.115129545f},
-std::array<float,2>{0.312890917f, 0.52423811f},
-std::array<float,2>{0.541857243f, 0.27142936f},
-std::array<float,2>{0.957324505f, 0.755716741f},
-std::array<float,2>{0.0244827326f, 0.0026710995f},
-std::array<float,2>{0.207951859f, 0.926175237f},
-std::array<float,2>{0.759197533f, 0.240181074f},
-std::array<float,2>{0.69604224f, 0.742040813f},
-std::array<float,2>{0.3864519f, 0.4997513f},
-std::array<float,2>{0.461378902f, 0.851504326f},
-std::array<float,2>{0.638833642f, 0.120106965f},
-std::array<float,2>{0.867663801f, 0.571723878f},
-std::array<float,2>{0.133751616f, 0.367589623f},
-std::array<float,2>{0.0860627964f, 0.658230484f},
-std::array<float,2>{0.926322401f, 0.384512067f},
-std::array<float,2>{0.593160868f, 0.992265284f},
-std::array<float,2>{0.275369346f, 0.128806025f},
-std::array<float,2>{0.431650192f, 0.69647032f},
-std::array<float,2>{0.738678992f, 0.454680502f},
-std::array<float,2>{0.794194698f, 0.881737053f},
-std::array<float,2>{0.221716031f, 0.194397911f},
-std::array<float,2>{0.0402484722f, 0.787852824f},
-std::array<float,2>{0.990836918f, 0.0441044495f},
-std::array<float,2>{0.510817051f, 0.542839885f},
-std::array<float,2>{0.361415714f, 0.29045105f},
-std::array<float,2>{0.293004513f, 0.942386985f},
-std::array<float,2>{0.616379082f, 0.168403551f},
-std::array<float,2>{0.893978298f, 0.632504582f},
-std::array<float,2>{0.101495862f, 0.435936153f},
-std::array<float,2>{0.177505165f, 0.612487435f},
-std::array<float,2>{0.842622578f, 0.337314457f},
-std::array<float,2>{0.680381238f, 0.829105735f},
-std::array<float,2>{0.469457448f, 0.0740340129f},
-std::array<float,2>{0.49707523f, 0.578673303f},
-std::array<float,2>{0.659417927f, 0.349652171f},
-std::array<float,2>{0.826798618f, 0.861199558f},
-std::array<float,2>{0.165162861f, 0.105933808f},
-std::array<float,2>{0.123141132f, 0.97163254f},
-std::array<float,2>{0.887718737f, 0.147473961f},
-std::array<float,2>{0.602159262f, 0.675115049f},
-std::array<float,2>{0.301943958f, 0.395978808f},
-std::array<float,2>{0.349609762f, 0.771652579f},
-std::array<float,2>{0.515675068f, 0.0284833517f},
-std::array<float,2>{0.969588339f, 0.514674008f},
-std::array<float,2>{0.0620287731f, 0.265151054f},
-std::array<float,2>{0.236693397f, 0.722689569f},
-std::array<float,2>{0.798102081f, 0.479280531f},
-std::array<float,2>{0.732656479f, 0.914829731f},
-std::array<float,2>{0.415190011f, 0.23144792f},
-std::array<float,2>{0.25023821f, 0.645278037f},
-std::array<float,2>{0.566180944f, 0.418581933f},
-std::array<float,2>{0.909942567f, 0.956453979f},
-std::array<float,2>{0.0626533031f, 0.178379104f},
-std::array<float,2>{0.145179465f, 0.826317549f},
-std::array<float,2>{0.858295381f, 0.0915880427f},
-std::array<float,2>{0.651517332f, 0.599400401f},
-std::array<float,2>{0.449172169f, 0.327573866f},
-std::array<float,2>{0.405750841f, 0.903055608f},
-std::array<float,2>{0.71144402f, 0.210616246f},
-std::array<float,2>{0.769324124f, 0.714602709f},
-std::array<float,2>{0.195454925f, 0.438319176f},
-std::array<float,2>{0.00591144525f, 0.562229633f},
-std::array<float,2>{0.945857882f, 0.302088886f},
-std::array<float,2>{0.55683291f, 0.805540442f},
-std::array<float,2>{0.332995027f, 0.0600214154f},
-std::array<float,2>{0.279824317f, 0.550346076f},
-std::array<float,2>{0.587652981f, 0.307870984f},
-std::array<float,2>{0.924719632f, 0.80107677f},
-std::array<float,2>{0.0910747871f, 0.0513658486f},
-std::array<float,2>{0.139602274f, 0.893937409f},
-std::array<float,2>{0.874810696f, 0.213602543f},
-std::array<float,2>{0.633068562f, 0.707729638f},
-std::array<float,2>{0.467955738f, 0.448142827f},
-std::array<float,2>{0.386893302f, 0.81474483f},
-std::array<float,2>{0.699360013f, 0.0822394341f},
-std::array<float,2>{0.763621271f, 0.606577039f},
-std::array<float,2>{0.206631601f, 0.313372672f},
-std::array<float,2>{0.0293946788f, 0.652709842f},
-std::array<float,2>{0.954728544f, 0.41256696f},
-std::array<float,2>{0.545455039f, 0.962720692f},
-std::array<float,2>{0.318719715f, 0.181052387f},
-std::array<float,2>{0.476114959f, 0.727775156f},
-std::array<float,2>{0.686962426f, 0.470538884f},
-std::array<float,2>{0.836444438f, 0.909295321f},
-std::array<float,2>{0.172926426f, 0.221542239f},
-std::array<float,2>{0.094265826f, 0.780998349f},
-std::array<float,2>{0.895405829f, 0.0230858121f},
-std::array<float,2>{0.612895668f, 0.5065189f},
-std::array<float,2>{0.291325599f, 0.254853547f},
-std::array<float,2>{0.365154415f, 0.978078842f},
-std::array<float,2>{0.513498664f, 0.148562312f},
-std::array<float,2>{0.988035083f, 0.681266487f},
-std::array<float,2>{0.0453387015f, 0.400930464f},
-std::array<float,2>{0.225762233f, 0.588428855f},
-std::array<float,2>{0.791172504f, 0.357887894f},
-std::array<float,2>{0.737569153f, 0.870847344f},
-std::array<float,2>{0.43467328f, 0.0997276679f},
-std::array<float,2>{0.418546259f, 0.624303639f},
-std::array<float,2>{0.7267645f, 0.335595876f},
-std::array<float,2>{0.803855419f, 0.841750681f},
-std::array<float,2>{0.242054313f, 0.0691776648f},
-std::array<float,2>{0.0557058156f, 0.949289441f},
-std::array<float,2>{0.975786686f, 0.16093275f},
-std::array<float,2>{0.522944152f, 0.636912525f},
-std::array<float,2>{0.345375776f, 0.425411344f},
-std::array<float,2>{0.297756881f, 0.792140841f},
-std::array<float,2>{0.6055848f, 0.0328332633f},
-std::array<float,2>{0.885432601f, 0.538791835f},
-std::array<float,2>{0.120162949f, 0.281808734f},
-std::array<float,2>{0.168060586f, 0.690239549f},
-std::array<float,2>{0.82180506f, 0.464984328f},
-std::array<float,2>{0.66066885f, 0.890256047f},
-std::array<float,2>{0.4944942f, 0.197409824f},
-std::array<float,2>{0.331536323f, 0.671709418f},
-std::array<float,2>{0.558851123f, 0.379739881f},
-std::array<float,2>{0.952180564f, 0.989402771f},
-std::array<float,2>{0.0014492044f, 0.133180723f},
-std::array<float,2>{0.203094959f, 0.854602158f},
-std::array<float,2>{0.771268725f, 0.110887729f},
-std::array<float,2>{0.715717912f, 0.563912153f},
-std::array<float,2>{0.399567395f, 0.360278606f},
-std::array<float,2>{0.449986368f, 0.933772027f},
-std::array<float,2>{0.654855967f, 0.24563989f},
-std::array<float,2>{0.85489732f, 0.749161065f},
-std::array<float,2>{0.14289017f, 0.48592338f},
-std::array<float,2>{0.0683362335f, 0.52117008f},
-std::array<float,2>{0.910466135f, 0.280509591f},
-std::array<float,2>{0.566654503f, 0.760949433f},
-std::array<float,2>{0.253925771f, 0.0117263542f},
-std::array<float,2>{0.358018339f, 0.575198829f},
-std::array<float,2>{0.529648542f, 0.372300118f},
-std::array<float,2>{0.976837277f, 0.847335339f},
-std::array<float,2>{0.0540467948f, 0.121477053f},
-std::array<float,2>{0.245730281f, 0.996551394f},
-std::array<float,2>{0.809945524f, 0.131372482f},
-std::array<float,2>{0.721949995f, 0.661903024f},
-std::array<float,2>{0.407116592f, 0.387447625f},
-std::array<float,2>{0.489044875f, 0.751743257f},
-std::array<float,2>{0.671398103f, 0.00396078406f},
-std::array<float,2>{0.813623071f, 0.528632581f},
-std::array<float,2>{0.162665263f, 0.268916368f},
-std::array<float,2>{0.109410264f, 0.734939575f},
-std::array<float,2>{0.881797194f, 0.492818892f},
-std::array<float,2>{0.600225151f, 0.923109949f},
-std::array<float,2>{0.306976438f, 0.236392722f},
-std::array<float,2>{0.396448433f, 0.625868976f},
-std::array<float,2>{0.708103895f, 0.433469534f},
-std::array<float,2>{0.780281723f, 0.938348353f},
-std::array<float,2>{0.191498518f, 0.166496322f},
-std::array<float,2>{0.0103852004f, 0.835488737f},
-std::array<float,2>{0.943906546f, 0.0760457888f},
-std::array<float,2>{0.54713279f, 0.61472708f},
-std::array<float,2>{0.343516141f, 0.343351692f},
-std::array<float,2>{0.259626538f, 0.875437975f},
-std::array<float,2>{0.571448982f, 0.189779937f},
-std::array<float,2>{0.916964769f, 0.699335217f},
-std::array<float,2>{0.07670293f, 0.458704531f},
-std::array<float,2>{0.152414754f, 0.544252753f},
-std::array<float,2>{0.844721913f, 0.293873012f},
-std::array<float,2>{0.647745788f, 0.78129524f},
-std::array<float,2>{0.441229969f, 0.0413951613f},
-std::array<float,2>{0.4589504f, 0.510490477f},
-std::array<float,2>{0.625357389f, 0.258252621f},
-std::array<float,2>{0.86138016f, 0.766344547f},
-std::array<float,2>{0.128811657f, 0.0247089118f},
-std::array<float,2>{0.0837788433f, 0.919623196f},
-std::array<float,2>{0.935606062f, 0.22760731f},
-std::array<float,2>{0.579006612f, 0.722343683f},
-std::array<float,2>{0.272654057f, 0.483616769f},
-std::array<float,2>{0.323778957f, 0.865362823f},
-std::array<float,2>{0.536032379f, 0.102976464f},
-std::array<float,2>{0.963211417f, 0.584288776f},
-std::array<float,2>{0.0169491917f, 0.347373992f},
-std::array<float,2>{0.211991951f, 0.678587794f},
-std::array<float,2>{0.75270164f, 0.3934668f},
-std::array<float,2>{0.691900373f, 0.975960732f},
-std::array<float,2>{0.382748336f, 0.143636674f},
-std::array<float,2>{0.284954816f, 0.718263209f},
-std::array<float,2>{0.622120857f, 0.444808483f},
-std::array<float,2>{0.905505538f, 0.898875475f},
-std::array<float,2>{0.102799609f, 0.205353081f},
-std::array<float,2>{0.182082996f, 0.81008476f},
-std::array<float,2>{0.833629012f, 0.057837151f},
-std::array<float,2>{0.67870909f, 0.555895984f},
-std::array<float,2>{0.480493098f, 0.298743904f},
-std::array<float,2>{0.428841352f, 0.959596336f},
-std::array<float,2>{0.749747932f, 0.175288439f},
-std::array<float,2>{0.784390748f, 0.643877387f},
-std::array<float,2>{0.232313842f, 0.415891796f},
-std::array<float,2>{0.0337688625f, 0.595480204f},
-std::array<float,2>{0.999203682f, 0.321432024f},
-std::array<float,2>{0.501212716f, 0.820753813f},
-std::array<float,2>{0.373581856f, 0.0862147138f},
-std::array<float,2>{0.292327523f, 0.586674631f},
-std::array<float,2>{0.61180675f, 0.355791897f},
-std::array<float,2>{0.895564675f, 0.867344677f},
-std::array<float,2>{0.0956371874f, 0.0977141634f},
-std::array<float,2>{0.171927154f, 0.978726745f},
-std::array<float,2>{0.837512791f, 0.150912791f},
-std::array<float,2>{0.686095893f, 0.68248421f},
-std::array<float,2>{0.47515282f, 0.398798168f},
-std::array<float,2>{0.433796406f, 0.777579069f},
-std::array<float,2>{0.736630082f, 0.0208898056f},
-std::array<float,2>{0.792955577f, 0.505246937f},
-std::array<float,2>{0.224737182f, 0.256231368f},
-std::array<float,2>{0.0462411791f, 0.730251908f},
-std::array<float,2>{0.987160325f, 0.471533626f},
-std::array<float,2>{0.512394369f, 0.907098591f},
-std::array<float,2>{0.363759965f, 0.219540969f},
-std::array<float,2>{0.467362911f, 0.654652297f},
-std::array<float,2>{0.634375393f, 0.411384523f},
-std::array<float,2>{0.873470783f, 0.964253366f},
-std::array<float,2>{0.14029035f, 0.182535052f},
-std::array<float,2>{0.0904225931f, 0.8134377f},
-std::array<float,2>{0.924958646f, 0.0849216506f},
-std::array<float,2>{0.586435318f, 0.609032571f},
-std::array<float,2>{0.28037858f, 0.315539777f},
-std::array<float,2>{0.319867522f, 0.891429603f},
-std::array<float,2>{0.546296477f, 0.212840721f},
-std::array<float,2>{0.953159988f, 0.709234297f},
-std::array<float,2>{0.0311883818f, 0.446204484f},
-std::array<float,2>{0.205978096f, 0.547827899f},
-std::array<float,2>{0.762514293f, 0.305572331f},
-std::array<float,2>{0.700843155f, 0.804249585f},
-std::array<float,2>{0.387774765f, 0.0527753346f},
-std::array<float,2>{0.398835868f, 0.52232331f},
-std::array<float,2>{0.715865493f, 0.27867654f},
-std::array<float,2>{0.769554138f, 0.759449005f},
-std::array<float,2>{0.201300815f, 0.0150332842f},
-std::array<float,2>{0.000700026401f, 0.936849713f},
-std::array<float,2>{0.951725185f, 0.243597567f},
-std::array<float,2>{0.559829056f, 0.747523367f},
-std::array<float,2>{0.330174595f, 0.487579703f},
-std::array<float,2>{0.255327433f, 0.851886153f},
-std::array<float,2>{0.567716956f, 0.111659087f},
-std::array<float,2>{0.911647737f, 0.565289259f},
-std::array<float,2>{0.0666873828f, 0.361842722f},
-std::array<float,2>{0.143733278f, 0.668494403f},
-std::array<float,2>{0.85420233f, 0.381260604f},
-std::array<float,2>{0.655994475f, 0.990849257f},
-std::array<float,2>{0.451071113f, 0.13626492f},
-std::array<float,2>{0.344349235f, 0.689245105f},
-std::array<float,2>{0.521799684f, 0.46841386f},
-std::array<float,2>{0.974751532f, 0.887145817f},
-std::array<float,2>{0.0551658757f, 0.197068259f},
-std::array<float,2>{0.241094321f, 0.790112972f},
-std::array<float,2>{0.80364275f, 0.0334537216f},
-std::array<float,2>{0.727991521f, 0.535643816f},
-std::array<float,2>{0.419239759f, 0.284556389f},
-std::array<float,2>{0.495545775f, 0.952730894f},
-std::array<float,2>{0.661988735f, 0.16281651f},
-std::array<float,2>{0.820762753f, 0.640475869f},
-std::array<float,2>{0.169617131f, 0.422450811f},
-std::array<float,2>{0.119922929f, 0.622167468f},
-std::array<float,2>{0.885892332f, 0.33333382f},
-std::array<float,2>{0.606818855f, 0.841950476f},
-std::array<float,2>{0.298397541f, 0.0677592382f},
-std::array<float,2>{0.341941774f, 0.545594096f},
-std::array<float,2>{0.548429728f, 0.296461016f},
-std::array<float,2>{0.944878042f, 0.784502447f},
-std::array<float,2>{0.0111271171f, 0.039669957f},
-std::array<float,2>{0.192539483f, 0.878377378f},
-std::array<float,2>{0.779475451f, 0.187883005f},
-std::array<float,2>{0.707760394f, 0.702028871f},
-std::array<float,2>{0.395192653f, 0.460064411f},
-std::array<float,2>{0.439561754f, 0.833693981f},
-std::array<float,2>{0.646544993f, 0.0772687197f},
-std::array<float,2>{0.844930947f, 0.616372168f},
-std::array<float,2>{0.153764069f, 0.341709286f},
-std::array<float,2>{0.0775859207f, 0.628246069f},
-std::array<float,2>{0.917731941f, 0.431138724f},
-std::array<float,2>{0.570515871f, 0.940341592f},
-std::array<float,2>{0.258425325f, 0.16562508f},
-std::array<float,2>{0.407652527f, 0.737751842f},
-std::array<float,2>{0.720996261f, 0.494297713f},
-std::array<float,2>{0.808994055f, 0.925059676f},
-std::array<float,2>{0.2445876f, 0.236125663f},
-std::array<float,2>{0.0534531437f, 0.752293646f},
-std::array<float,2>{0.978199184f, 0.00728159025f},
-std::array<float,2>{0.530884743f, 0.529808104f},
-std::array<float,2>{0.358842731f, 0.266250312f},
-std::array<float,2>{0.307782561f, 0.998770833f},
-std::array<float,2>{0.600806534f, 0.130697802f},
-std::array<float,2>{0.882673144f, 0.66327703f},
-std::array<float,2>{0.110999249f, 0.390100151f},
-std::array<float,2>{0.163234144f, 0.577095866f},
-std::array<float,2>{0.812863648f, 0.373850077f},
-std::array<float,2>{0.670467854f, 0.845205247f},
-std::array<float,2>{0.490058899f, 0.123797335f},
-std::array<float,2>{0.481509775f, 0.596221447f},
-std::array<float,2>{0.679526925f, 0.323200673f},
-std::array<float,2>{0.832397819f, 0.823707402f},
-std::array<float,2>{0.182908356f, 0.0881722346f},
-std::array<float,2>{0.102512091f, 0.957361698f},
-std::array<float,2>{0.904413402f, 0.173124135f},
-std::array<float,2>{0.621602893f, 0.642234147f},
-std::array<float,2>{0.283380479f, 0.417479217f},
-std::array<float,2>{0.374991f, 0.811829448f},
-std::array<float,2>{0.500808597f, 0.0557930507f},
-std::array<float,2>{0.998260438f, 0.557469606f},
-std::array<float,2>{0.0350800864f, 0.299230695f},
-std::array<float,2>{0.230669528f, 0.716576397f},
-std::array<float,2>{0.784022212f, 0.441555411f},
-std::array<float,2>{0.748623908f, 0.900639176f},
-std::array<float,2>{0.428411216f, 0.204279706f},
-std::array<float,2>{0.271737933f, 0.677138448f},
-std::array<float,2>{0.579838514f, 0.392221451f},
-std::array<float,2>{0.937238634f, 0.973104775f},
-std::array<float,2>{0.0829463229f, 0.141627237f},
-std::array<float,2>{0.127668977f, 0.865100324f},
-std::array<float,2>{0.862739801f, 0.103861719f},
-std::array<float,2>{0.626477361f, 0.583680093f},
-std::array<float,2>{0.457199275f, 0.345283717f},
-std::array<float,2>{0.38170284f, 0.921135724f},
-std::array<float,2>{0.692856371f, 0.229012072f},
-std::array<float,2>{0.753683448f, 0.720439792f},
-std::array<float,2>{0.21107462f, 0.480600357f},
-std::array<float,2>{0.0156862233f, 0.509545088f},
-std::array<float,2>{0.964414716f, 0.260175467f},
-std::array<float,2>{0.536189616f, 0.768155277f},
-std::array<float,2>{0.32303068f, 0.0267086755f},
-std::array<float,2>{0.265522152f, 0.500588894f},
-std::array<float,2>{0.575822592f, 0.251977265f},
-std::array<float,2>{0.919413686f, 0.775199115f},
-std::array<float,2>{0.0716883019f, 0.0166168995f},
-std::array<float,2>{0.150580272f, 0.911839306f},
-std::array<float,2>{0.849816144f, 0.224148735f},
-std::array<float,2>{0.641110718f, 0.731431007f},
-std::array<float,2>{0.441900611f, 0.476153255f},
-std::array<float,2>{0.393537402f, 0.873851717f},
-std::array<float,2>{0.706374645f, 0.0958831459f},
-std::array<float,2>{0.77525872f, 0.590754211f},
-std::array<float,2>{0.189787507f, 0.351658523f},
-std::array<float,2>{0.0128777372f, 0.686153412f},
-std::array<float,2>{0.940155089f, 0.403320968f},
-std::array<float,2>{0.553581536f, 0.981558561f},
-std::array<float,2>{0.336973995f, 0.153811648f},
-std::array<float,2>{0.487911671f, 0.706047297f},
-std::array<float,2>{0.66683948f, 0.449860394f},
-std::array<float,2>{0.81800127f, 0.894986629f},
-std::array<float,2>{0.158993974f, 0.218114883f},
-std::array<float,2>{0.11539647f, 0.800213695f},
-std::array<float,2>{0.876433611f, 0.049555786f},
-std::array<float,2>{0.594715059f, 0.553321779f},
-std::array<float,2>{0.309948176f, 0.310328513f},
-std::array<float,2>{0.354385555f, 0.967168152f},
-std::array<float,2>{0.524901032f, 0.18682535f},
-std::array<float,2>{0.98229295f, 0.651500583f},
-std::array<float,2>{0.0476939604f, 0.407288849f},
-std::array<float,2>{0.247348413f, 0.602168858f},
-std::array<float,2>{0.805614948f, 0.319665343f},
-std::array<float,2>{0.72463882f, 0.819559753f},
-std::array<float,2>{0.413105011f, 0.081586577f},
-std::array<float,2>{0.422082484f, 0.566868961f},
-std::array<float,2>{0.745645463f, 0.365264833f},
-std::array<float,2>{0.78565377f, 0.859121323f},
-std::array<float,2>{0.228292048f, 0.115508422f},
-std::array<float,2>{0.0385924391f, 0.98674643f},
-std::array<float,2>{0.992363036f, 0.139550418f},
-std::array<float,2>{0.505770266f, 0.666180551f},
-std::array<float,2>{0.368880689f, 0.378523886f},
-std::array<float,2>{0.28517285f, 0.765049994f},
-std::array<float,2>{0.619850814f, 0.0109854955f},
-std::array<float,2>{0.902044713f, 0.517522454f},
-std::array<float,2>{0.108613878f, 0.273826122f},
-std::array<float,2>{0.185054094f, 0.745448351f},
-std::array<float,2>{0.828307629f, 0.491262496f},
-std::array<float,2>{0.67312479f, 0.930723965f},
-std::array<float,2>{0.480177492f, 0.247192591f},
-std::array<float,2>{0.324613333f, 0.636212885f},
-std::array<float,2>{0.533422232f, 0.428050369f},
-std::array<float,2>{0.967317283f, 0.946598589f},
-std::array<float,2>{0.0226347279f, 0.159011155f},
-std::array<float,2>{0.218247339f, 0.838184178f},
-std::array<float,2>{0.756217957f, 0.0654612854f},
-std::array<float,2>{0.69029516f, 0.617411673f},
-std::array<float,2>{0.378051519f, 0.330262899f},
-std::array<float,2>{0.454949975f, 0.885569632f},
-std::array<float,2>{0.630701602f, 0.2006329f},
-std::array<float,2>{0.863521993f, 0.693623424f},
-std::array<float,2>{0.131340086f, 0.461943001f},
-std::array<float,2>{0.0783494785f, 0.531621933f},
-std::array<float,2>{0.932574868f, 0.28663668f},
-std::array<float,2>{0.583991289f, 0.795696795f},
-std::array<float,2>{0.268970996f, 0.038109567f},
-std::array<float,2>{0.362473428f, 0.610487461f},
-std::array<float,2>{0.510277689f, 0.338655382f},
-std::array<float,2>{0.991649508f, 0.830669522f},
-std::array<float,2>{0.0398671739f, 0.0722555593f},
-std::array<float,2>{0.221129984f, 0.943472862f},
-std::array<float,2>{0.793216228f, 0.170884132f},
-std::array<float,2>{0.740097463f, 0.62946856f},
-std::array<float,2>{0.4332093f, 0.433871627f},
-std::array<float,2>{0.47060284f, 0.786201537f},
-std::array<float,2>{0.681592643f, 0.0453994423f},
-std::array<float,2>{0.843484402f, 0.539610922f},
-std::array<float,2>{0.175833791f, 0.292228639f},
-std::array<float,2>{0.099978976f, 0.697308719f},
-std::array<float,2>{0.893121421f, 0.455236852f},
-std::array<float,2>{0.615340531f, 0.879256725f},
-std::array<float,2>{0.294147432f, 0.192717925f},
-std::array<float,2>{0.384879649f, 0.656591773f},
-std::array<float,2>{0.69668442f, 0.385834545f},
-std::array<float,2>{0.758114457f, 0.994448423f},
-std::array<float,2>{0.208014905f, 0.12627469f},
-std::array<float,2>{0.0236205999f, 0.848682404f},
-std::array<float,2>{0.958087146f, 0.118488699f},
-std::array<float,2>{0.542593241f, 0.573227406f},
-std::array<float,2>{0.31409049f, 0.36972034f},
-std::array<float,2>{0.273598045f, 0.928356349f},
-std::array<float,2>{0.592026412f, 0.240309909f},
-std::array<float,2>{0.926879942f, 0.739974141f},
-std::array<float,2>{0.0877054185f, 0.497666687f},
-std::array<float,2>{0.134155944f, 0.526857376f},
-std::array<float,2>{0.86872685f, 0.272817165f},
-std::array<float,2>{0.640527666f, 0.757678509f},
-std::array<float,2>{0.462360412f, 0.000665653031f},
-std::array<float,2>{0.447869658f, 0.559929907f},
-std::array<float,2>{0.650921345f, 0.304163814f},
-std::array<float,2>{0.858983994f, 0.806796908f},
-std::array<float,2>{0.145955265f, 0.0618638955f},
-std::array<float,2>{0.0643802881f, 0.904606402f},
-std::array<float,2>{0.908272147f, 0.207494587f},
-std::array<float,2>{0.565031409f, 0.712190151f},
-std::array<float,2>{0.251695901f, 0.440058112f},
-std::array<float,2>{0.333537787f, 0.82545042f},
-std::array<float,2>{0.558289528f, 0.0934167802f},
-std::array<float,2>{0.946654916f, 0.599933445f},
-std::array<float,2>{0.00706476439f, 0.32551676f},
-std::array<float,2>{0.196936712f, 0.647401214f},
-std::array<float,2>{0.767975092f, 0.421190023f},
-std::array<float,2>{0.712256014f, 0.954622686f},
-std::array<float,2>{0.404503047f, 0.177239597f},
-std::array<float,2>{0.301143855f, 0.72611618f},
-std::array<float,2>{0.603426218f, 0.478422582f},
-std::array<float,2>{0.887319148f, 0.916707218f},
-std::array<float,2>{0.124329656f, 0.23317723f},
-std::array<float,2>{0.164076015f, 0.770837605f},
-std::array<float,2>{0.827716231f, 0.0310245436f},
-std::array<float,2>{0.659144759f, 0.513087213f},
-std::array<float,2>{0.496584326f, 0.262445211f},
-std::array<float,2>{0.414517552f, 0.969061434f},
-std::array<float,2>{0.733935714f, 0.144794121f},
-std::array<float,2>{0.797683358f, 0.672403574f},
-std::array<float,2>{0.238103941f, 0.397999823f},
-std::array<float,2>{0.0608220287f, 0.581354797f},
-std::array<float,2>{0.970487773f, 0.347977936f},
-std::array<float,2>{0.517187178f, 0.861503184f},
-std::array<float,2>{0.351543933f, 0.108015791f},
-std::array<float,2>{0.278085977f, 0.606741786f},
-std::array<float,2>{0.589505196f, 0.313057184f},
-std::array<float,2>{0.922869384f, 0.814628661f},
-std::array<float,2>{0.0935643166f, 0.0824213251f},
-std::array<float,2>{0.137447566f, 0.962588847f},
-std::array<float,2>{0.871708989f, 0.180877462f},
-std::array<float,2>{0.636623621f, 0.652413428f},
-std::array<float,2>{0.465850919f, 0.412340462f},
-std::array<float,2>{0.389150739f, 0.800847948f},
-std::array<float,2>{0.702884257f, 0.0515237674f},
-std::array<float,2>{0.765246809f, 0.550547898f},
-std::array<float,2>{0.204686731f, 0.307779461f},
-std::array<float,2>{0.0292077977f, 0.707851231f},
-std::array<float,2>{0.956829131f, 0.447895259f},
-std::array<float,2>{0.544287324f, 0.893733263f},
-std::array<float,2>{0.317063808f, 0.213842824f},
-std::array<float,2>{0.474319011f, 0.681493223f},
-std::array<float,2>{0.684757054f, 0.401200891f},
-std::array<float,2>{0.839152098f, 0.978457272f},
-std::array<float,2>{0.174161762f, 0.148684889f},
-std::array<float,2>{0.0969262272f, 0.87105006f},
-std::array<float,2>{0.897301555f, 0.100079872f},
-std::array<float,2>{0.609929442f, 0.588722289f},
-std::array<float,2>{0.289173484f, 0.35744074f},
-std::array<float,2>{0.366199762f, 0.909515738f},
-std::array<float,2>{0.515341341f, 0.221383959f},
-std::array<float,2>{0.985042095f, 0.728023052f},
-std::array<float,2>{0.0443193763f, 0.470347047f},
-std::array<float,2>{0.224110678f, 0.506801724f},
-std::array<float,2>{0.790019393f, 0.254595309f},
-std::array<float,2>{0.7358495f, 0.781018913f},
-std::array<float,2>{0.436814189f, 0.0232341792f},
-std::array<float,2>{0.421705335f, 0.538861156f},
-std::array<float,2>{0.729338944f, 0.282011479f},
-std::array<float,2>{0.80088973f, 0.792367578f},
-std::array<float,2>{0.239618048f, 0.03312736f},
-std::array<float,2>{0.0571009442f, 0.890510499f},
-std::array<float,2>{0.972740591f, 0.197545692f},
-std::array<float,2>{0.52108413f, 0.69001317f},
-std::array<float,2>{0.346851051f, 0.465146452f},
-std::array<float,2>{0.300151795f, 0.841379941f},
-std::array<float,2>{0.60920316f, 0.0689453855f},
-std::array<float,2>{0.884261012f, 0.62422508f},
-std::array<float,2>{0.117206767f, 0.335920155f},
-std::array<float,2>{0.17169553f, 0.636968613f},
-std::array<float,2>{0.823208511f, 0.425649345f},
-std::array<float,2>{0.66357851f, 0.949619114f},
-std::array<float,2>{0.493287891f, 0.160853848f},
-std::array<float,2>{0.329994112f, 0.749346793f},
-std::array<float,2>{0.560789585f, 0.486281812f},
-std::array<float,2>{0.949405372f, 0.934062481f},
-std::array<float,2>{0.00289303809f, 0.246023118f},
-std::array<float,2>{0.199320644f, 0.761137664f},
-std::array<float,2>{0.771500409f, 0.0121660717f},
-std::array<float,2>{0.717484176f, 0.521374881f},
-std::array<float,2>{0.40058592f, 0.280606031f},
-std::array<float,2>{0.451969028f, 0.989524782f},
-std::array<float,2>{0.654147744f, 0.133054093f},
-std::array<float,2>{0.853271067f, 0.671565592f},
-std::array<float,2>{0.142346889f, 0.379566461f},
-std::array<float,2>{0.0702994764f, 0.563625634f},
-std::array<float,2>{0.912728667f, 0.359904677f},
-std::array<float,2>{0.568412423f, 0.854763031f},
-std::array<float,2>{0.256451964f, 0.111326039f},
-std::array<float,2>{0.356508285f, 0.528544188f},
-std::array<float,2>{0.527928174f, 0.268605351f},
-std::array<float,2>{0.979760051f, 0.75160557f},
-std::array<float,2>{0.0523664504f, 0.00435466878f},
-std::array<float,2>{0.243041188f, 0.922856331f},
-std::array<float,2>{0.811826646f, 0.236685783f},
-std::array<float,2>{0.720106304f, 0.735294759f},
-std::array<float,2>{0.409963995f, 0.493035823f},
-std::array<float,2>{0.491295636f, 0.847567439f},
-std::array<float,2>{0.668865025f, 0.121255986f},
-std::array<float,2>{0.81622237f, 0.575554132f},
-std::array<float,2>{0.160457909f, 0.372317433f},
-std::array<float,2>{0.111684084f, 0.661804974f},
-std::array<float,2>{0.880225837f, 0.387491316f},
-std::array<float,2>{0.59930402f, 0.996170819f},
-std::array<float,2>{0.304703593f, 0.131780565f},
-std::array<float,2>{0.39671281f, 0.699548006f},
-std::array<float,2>{0.70917964f, 0.458798349f},
-std::array<float,2>{0.77853924f, 0.875020564f},
-std::array<float,2>{0.194702521f, 0.189640567f},
-std::array<float,2>{0.0092633618f, 0.781642914f},
-std::array<float,2>{0.941900373f, 0.0412048846f},
-std::array<float,2>{0.549984217f, 0.543950737f},
-std::array<float,2>{0.340277135f, 0.293461055f},
-std::array<float,2>{0.261539847f, 0.937996507f},
-std::array<float,2>{0.573612869f, 0.166113734f},
-std::array<float,2>{0.915245235f, 0.625626087f},
-std::array<float,2>{0.0746540353f, 0.43322593f},
-std::array<float,2>{0.155376181f, 0.614427209f},
-std::array<float,2>{0.845724583f, 0.343717754f},
-std::array<float,2>{0.646335959f, 0.835903525f},
-std::array<float,2>{0.437896758f, 0.0759082958f},
-std::array<float,2>{0.459331006f, 0.58421129f},
-std::array<float,2>{0.6270836f, 0.34762305f},
-std::array<float,2>{0.86012435f, 0.865549326f},
-std::array<float,2>{0.125491008f, 0.102616571f},
-std::array<float,2>{0.0856411383f, 0.975784361f},
-std::array<float,2>{0.934957445f, 0.143831521f},
-std::array<float,2>{0.581147313f, 0.678439438f},
-std::array<float,2>{0.269835114f, 0.393127501f},
-std::array<float,2>{0.321871012f, 0.766596019f},
-std::array<float,2>{0.537335873f, 0.0244460423f},
-std::array<float,2>{0.962537169f, 0.51051712f},
-std::array<float,2>{0.0177166536f, 0.25783664f},
-std::array<float,2>{0.213906363f, 0.722644985f},
-std::array<float,2>{0.750426471f, 0.48381725f},
-std::array<float,2>{0.694032192f, 0.919891655f},
-std::array<float,2>{0.379835486f, 0.227834061f},
-std::array<float,2>{0.282175034f, 0.643731177f},
-std::array<float,2>{0.623679996f, 0.415732741f},
-std::array<float,2>{0.902864277f, 0.959902585f},
-std::array<float,2>{0.10491091f, 0.174920112f},
-std::array<float,2>{0.18055898f, 0.820439041f},
-std::array<float,2>{0.835358679f, 0.0860451534f},
-std::array<float,2>{0.677497029f, 0.595343649f},
-std::array<float,2>{0.482594162f, 0.321570873f},
-std::array<float,2>{0.426781088f, 0.898507237f},
-std::array<float,2>{0.747232616f, 0.205239445f},
-std::array<float,2>{0.781522155f, 0.718523324f},
-std::array<float,2>{0.234083682f, 0.444402963f},
-std::array<float,2>{0.0320183225f, 0.555912018f},
-std::array<float,2>{0.998041928f, 0.298524678f},
-std::array<float,2>{0.50386852f, 0.810540259f},
-std::array<float,2>{0.372998118f, 0.0580277331f},
-std::array<float,2>{0.310756624f, 0.551321387f},
-std::array<float,2>{0.597023368f, 0.31101957f},
-std::array<float,2>{0.878379047f, 0.798627615f},
-std::array<float,2>{0.11487072f, 0.0483607836f},
-std::array<float,2>{0.158017427f, 0.898410499f},
-std::array<float,2>{0.818573117f, 0.216398552f},
-std::array<float,2>{0.665281296f, 0.703322053f},
-std::array<float,2>{0.485475183f, 0.451665491f},
-std::array<float,2>{0.410594553f, 0.817796588f},
-std::array<float,2>{0.722998798f, 0.0795807093f},
-std::array<float,2>{0.807957768f, 0.605355084f},
-std::array<float,2>{0.24858959f, 0.318184167f},
-std::array<float,2>{0.0491719097f, 0.649030089f},
-std::array<float,2>{0.983456612f, 0.409953326f},
-std::array<float,2>{0.526450276f, 0.965295553f},
-std::array<float,2>{0.35307166f, 0.184354037f},
-std::array<float,2>{0.443952411f, 0.733738422f},
-std::array<float,2>{0.643587768f, 0.472705483f},
-std::array<float,2>{0.849500537f, 0.912915349f},
-std::array<float,2>{0.150233254f, 0.225974768f},
-std::array<float,2>{0.0735388026f, 0.776052237f},
-std::array<float,2>{0.920186281f, 0.0183541924f},
-std::array<float,2>{0.577118993f, 0.502256513f},
-std::array<float,2>{0.261963457f, 0.250242114f},
-std::array<float,2>{0.339705944f, 0.982649744f},
-std::array<float,2>{0.551054955f, 0.156064883f},
-std::array<float,2>{0.938907504f, 0.684578359f},
-std::array<float,2>{0.0143514741f, 0.406119764f},
-std::array<float,2>{0.187683374f, 0.593436241f},
-std::array<float,2>{0.776204586f, 0.353797704f},
-std::array<float,2>{0.704552174f, 0.871593595f},
-std::array<float,2>{0.391383231f, 0.0950982049f},
-std::array<float,2>{0.376443952f, 0.620792925f},
-std::array<float,2>{0.688457429f, 0.329555601f},
-std::array<float,2>{0.754153967f, 0.836854577f},
-std::array<float,2>{0.216613755f, 0.0642515868f},
-std::array<float,2>{0.0198415592f, 0.948009491f},
-std::array<float,2>{0.965369582f, 0.15762341f},
-std::array<float,2>{0.531787455f, 0.634690642f},
-std::array<float,2>{0.327242702f, 0.426597863f},
-std::array<float,2>{0.266862452f, 0.793636501f},
-std::array<float,2>{0.583700001f, 0.0359102003f},
-std::array<float,2>{0.931575f, 0.533439994f},
-std::array<float,2>{0.0807956979f, 0.288158625f},
-std::array<float,2>{0.129640922f, 0.692162514f},
-std::array<float,2>{0.866120756f, 0.464344561f},
-std::array<float,2>{0.631115377f, 0.882941365f},
-std::array<float,2>{0.455473304f, 0.202929482f},
-std::array<float,2>{0.369183421f, 0.6654796f},
-std::array<float,2>{0.506518602f, 0.375650257f},
-std::array<float,2>{0.994736135f, 0.985808313f},
-std::array<float,2>{0.0363566577f, 0.136804909f},
-std::array<float,2>{0.229842901f, 0.855855167f},
-std::array<float,2>{0.787293494f, 0.114897572f},
-std::array<float,2>{0.742853105f, 0.570082605f},
-std::array<float,2>{0.424082965f, 0.36393708f},
-std::array<float,2>{0.477764964f, 0.932831228f},
-std::array<float,2>{0.674174547f, 0.248375431f},
-std::array<float,2>{0.831769347f, 0.743354082f},
-std::array<float,2>{0.186466336f, 0.490100741f},
-std::array<float,2>{0.106435291f, 0.51799804f},
-std::array<float,2>{0.899581313f, 0.276334494f},
-std::array<float,2>{0.61744976f, 0.762407005f},
-std::array<float,2>{0.288429558f, 0.00877173524f},
-std::array<float,2>{0.315025866f, 0.571309924f},
-std::array<float,2>{0.539665818f, 0.367299736f},
-std::array<float,2>{0.960191786f, 0.851179838f},
-std::array<float,2>{0.0255421307f, 0.119751431f},
-std::array<float,2>{0.21038875f, 0.992627144f},
-std::array<float,2>{0.761534452f, 0.12849462f},
-std::array<float,2>{0.698705673f, 0.658681631f},
-std::array<float,2>{0.383880675f, 0.384740144f},
-std::array<float,2>{0.463597804f, 0.755379975f},
-std::array<float,2>{0.637016475f, 0.00276472932f},
-std::array<float,2>{0.8698771f, 0.524131f},
-std::array<float,2>{0.136172011f, 0.271185309f},
-std::array<float,2>{0.0886347219f, 0.741836488f},
-std::array<float,2>{0.928497732f, 0.499916881f},
-std::array<float,2>{0.590382159f, 0.925976098f},
-std::array<float,2>{0.275877953f, 0.239864573f},
-std::array<float,2>{0.431109279f, 0.632581294f},
-std::array<float,2>{0.74135828f, 0.435667962f},
-std::array<float,2>{0.796298027f, 0.942734003f},
-std::array<float,2>{0.218855456f, 0.168034106f},
-std::array<float,2>{0.0423220582f, 0.829461336f},
-std::array<float,2>{0.989668489f, 0.0739285797f},
-std::array<float,2>{0.509043157f, 0.612705767f},
-std::array<float,2>{0.359883934f, 0.337151557f},
-std::array<float,2>{0.296814173f, 0.881380856f},
-std::array<float,2>{0.613891244f, 0.194693476f},
-std::array<float,2>{0.891231954f, 0.696591556f},
-std::array<float,2>{0.0987816676f, 0.454907507f},
-std::array<float,2>{0.178579465f, 0.542555749f},
-std::array<float,2>{0.841580153f, 0.290040672f},
-std::array<float,2>{0.683368981f, 0.787633479f},
-std::array<float,2>{0.471610129f, 0.0443292335f},
-std::array<float,2>{0.499215692f, 0.51496315f},
-std::array<float,2>{0.657083869f, 0.265523463f},
-std::array<float,2>{0.825474918f, 0.771756053f},
-std::array<float,2>{0.166532397f, 0.0287344586f},
-std::array<float,2>{0.122557789f, 0.914605319f},
-std::array<float,2>{0.889232278f, 0.231844023f},
-std::array<float,2>{0.604977131f, 0.723139584f},
-std::array<float,2>{0.302846521f, 0.479247749f},
-std::array<float,2>{0.349369764f, 0.861024201f},
-std::array<float,2>{0.519268453f, 0.105682164f},
-std::array<float,2>{0.972402155f, 0.57907474f},
-std::array<float,2>{0.0596764684f, 0.35000962f},
-std::array<float,2>{0.235160768f, 0.674938619f},
-std::array<float,2>{0.798976719f, 0.395659745f},
-std::array<float,2>{0.731301427f, 0.971199453f},
-std::array<float,2>{0.4161731f, 0.147862539f},
-std::array<float,2>{0.253697276f, 0.714452088f},
-std::array<float,2>{0.563576043f, 0.438176453f},
-std::array<float,2>{0.908073485f, 0.903247535f},
-std::array<float,2>{0.0647946075f, 0.210865125f},
-std::array<float,2>{0.148341343f, 0.80521512f},
-std::array<float,2>{0.85560292f, 0.0597782433f},
-std::array<float,2>{0.649767816f, 0.562316477f},
-std::array<float,2>{0.44624573f, 0.301947683f},
-std::array<float,2>{0.40324387f, 0.956174374f},
-std::array<float,2>{0.71321851f, 0.178567708f},
-std::array<float,2>{0.766641796f, 0.645163357f},
-std::array<float,2>{0.19771485f, 0.418938905f},
-std::array<float,2>{0.00516655948f, 0.599324465f},
-std::array<float,2>{0.948543906f, 0.327348351f},
-std::array<float,2>{0.556272984f, 0.826520503f},
-std::array<float,2>{0.33418861f, 0.0913905054f},
-std::array<float,2>{0.257745385f, 0.566047013f},
-std::array<float,2>{0.569348752f, 0.363034308f},
-std::array<float,2>{0.913324237f, 0.852950692f},
-std::array<float,2>{0.0689619556f, 0.112734832f},
-std::array<float,2>{0.140892729f, 0.991956472f},
-std::array<float,2>{0.851760745f, 0.135098651f},
-std::array<float,2>{0.653160036f, 0.669637322f},
-std::array<float,2>{0.452518672f, 0.382316053f},
-std::array<float,2>{0.401752174f, 0.758112907f},
-std::array<float,2>{0.718648195f, 0.0145301539f},
-std::array<float,2>{0.772863805f, 0.523314655f},
-std::array<float,2>{0.200523317f, 0.277577579f},
-std::array<float,2>{0.00372830103f, 0.746903181f},
-std::array<float,2>{0.950512886f, 0.486507922f},
-std::array<float,2>{0.561823249f, 0.936177552f},
-std::array<float,2>{0.328471422f, 0.242539898f},
-std::array<float,2>{0.492323697f, 0.639357567f},
-std::array<float,2>{0.662810922f, 0.423143774f},
-std::array<float,2>{0.823517323f, 0.951833367f},
-std::array<float,2>{0.170417756f, 0.16319789f},
-std::array<float,2>{0.118971288f, 0.842838168f},
-std::array<float,2>{0.883369744f, 0.0669798702f},
-std::array<float,2>{0.608035982f, 0.621903062f},
-std::array<float,2>{0.299082875f, 0.332805842f},
-std::array<float,2>{0.346667975f, 0.888239563f},
-std::array<float,2>{0.51984185f, 0.196007505f},
-std::array<float,2>{0.974003315f, 0.688318968f},
-std::array<float,2>{0.0582276024f, 0.467130125f},
-std::array<float,2>{0.238914594f, 0.536518574f},
-std::array<float,2>{0.802705705f, 0.283674181f},
-std::array<float,2>{0.729531586f, 0.78962189f},
-std::array<float,2>{0.4200086f, 0.0351176225f},
-std::array<float,2>{0.43582195f, 0.504728019f},
-std::array<float,2>{0.734817207f, 0.257184625f},
-std::array<float,2>{0.790786803f, 0.778387666f},
-std::array<float,2>{0.222789124f, 0.020414209f},
-std::array<float,2>{0.0435089245f, 0.90757525f},
-std::array<float,2>{0.985907674f, 0.220231265f},
-std::array<float,2>{0.514277399f, 0.729338169f},
-std::array<float,2>{0.367056966f, 0.471708596f},
-std::array<float,2>{0.290796459f, 0.86840117f},
-std::array<float,2>{0.61081171f, 0.098779358f},
-std::array<float,2>{0.89812386f, 0.586997926f},
-std::array<float,2>{0.0957097635f, 0.357407689f},
-std::array<float,2>{0.175180227f, 0.683340371f},
-std::array<float,2>{0.838393986f, 0.400278151f},
-std::array<float,2>{0.68413198f, 0.980191708f},
-std::array<float,2>{0.473620892f, 0.151986092f},
-std::array<float,2>{0.318079472f, 0.710188389f},
-std::array<float,2>{0.543541133f, 0.446383089f},
-std::array<float,2>{0.955135703f, 0.891879857f},
-std::array<float,2>{0.0275106449f, 0.211852193f},
-std::array<float,2>{0.203231886f, 0.802824378f},
-std::array<float,2>{0.76391232f, 0.0541650988f},
-std::array<float,2>{0.702131987f, 0.548224807f},
-std::array<float,2>{0.389683545f, 0.306295246f},
-std::array<float,2>{0.464977831f, 0.962975383f},
-std::array<float,2>{0.635623395f, 0.183383688f},
-std::array<float,2>{0.87297672f, 0.656198382f},
-std::array<float,2>{0.137753472f, 0.411016822f},
-std::array<float,2>{0.0925281495f, 0.608117402f},
-std::array<float,2>{0.921983123f, 0.314795613f},
-std::array<float,2>{0.58863157f, 0.814175546f},
-std::array<float,2>{0.278868109f, 0.0851680636f},
-std::array<float,2>{0.371368408f, 0.557874262f},
-std::array<float,2>{0.50279808f, 0.30055958f},
-std::array<float,2>{0.996307254f, 0.811144114f},
-std::array<float,2>{0.0327627137f, 0.0548650734f},
-std::array<float,2>{0.23304081f, 0.901765108f},
-std::array<float,2>{0.782696068f, 0.203149781f},
-std::array<float,2>{0.746912181f, 0.715137005f},
-std::array<float,2>{0.426673353f, 0.442946851f},
-std::array<float,2>{0.483944088f, 0.82304734f},
-std::array<float,2>{0.676245809f, 0.0896645933f},
-std::array<float,2>{0.834903061f, 0.597295582f},
-std::array<float,2>{0.181080848f, 0.323573142f},
-std::array<float,2>{0.104200378f, 0.641360998f},
-std::array<float,2>{0.903437972f, 0.416656494f},
-std::array<float,2>{0.624324322f, 0.958304644f},
-std::array<float,2>{0.282360852f, 0.172414348f},
-std::array<float,2>{0.380529374f, 0.718842208f},
-std::array<float,2>{0.694487929f, 0.481596172f},
-std::array<float,2>{0.751092732f, 0.92006427f},
-std::array<float,2>{0.21297203f, 0.230458528f},
-std::array<float,2>{0.0192625243f, 0.769174695f},
-std::array<float,2>{0.961881101f, 0.0258121789f},
-std::array<float,2>{0.538282335f, 0.508733511f},
-std::array<float,2>{0.320962369f, 0.26144439f},
-std::array<float,2>{0.270534664f, 0.974245548f},
-std::array<float,2>{0.580111265f, 0.141520411f},
-std::array<float,2>{0.933747411f, 0.676388562f},
-std::array<float,2>{0.0848396868f, 0.390899986f},
-std::array<float,2>{0.126242384f, 0.582840025f},
-std::array<float,2>{0.860564351f, 0.344140589f},
-std::array<float,2>{0.628766656f, 0.864034891f},
-std::array<float,2>{0.460619032f, 0.105243266f},
-std::array<float,2>{0.43923831f, 0.616055131f},
-std::array<float,2>{0.644734442f, 0.340253174f},
-std::array<float,2>{0.847227752f, 0.832577825f},
-std::array<float,2>{0.154903859f, 0.0764743984f},
-std::array<float,2>{0.0753431618f, 0.940569282f},
-std::array<float,2>{0.914797246f, 0.16490832f},
-std::array<float,2>{0.573090315f, 0.627529681f},
-std::array<float,2>{0.259863436f, 0.430552274f},
-std::array<float,2>{0.341458052f, 0.783815503f},
-std::array<float,2>{0.54951036f, 0.0406181179f},
-std::array<float,2>{0.943346083f, 0.546564817f},
-std::array<float,2>{0.00873403624f, 0.295879215f},
-std::array<float,2>{0.19357191f, 0.702444196f},
-std::array<float,2>{0.778175771f, 0.459728003f},
-std::array<float,2>{0.710738659f, 0.877370059f},
-std::array<float,2>{0.397781998f, 0.188594267f},
-std::array<float,2>{0.306628406f, 0.662447453f},
-std::array<float,2>{0.597771704f, 0.389132202f},
-std::array<float,2>{0.879241645f, 0.999225378f},
-std::array<float,2>{0.112831108f, 0.129486293f},
-std::array<float,2>{0.162082314f, 0.844100535f},
-std::array<float,2>{0.81485188f, 0.124901995f},
-std::array<float,2>{0.669021249f, 0.577998519f},
-std::array<float,2>{0.490592927f, 0.374068171f},
-std::array<float,2>{0.408486754f, 0.924375296f},
-std::array<float,2>{0.719192743f, 0.235152543f},
-std::array<float,2>{0.811004162f, 0.736677825f},
-std::array<float,2>{0.243790478f, 0.495400637f},
-std::array<float,2>{0.0515037477f, 0.530454278f},
-std::array<float,2>{0.978811562f, 0.266772002f},
-std::array<float,2>{0.529284358f, 0.753311157f},
-std::array<float,2>{0.355900019f, 0.00641546678f},
-std::array<float,2>{0.287555754f, 0.51622647f},
-std::array<float,2>{0.618366539f, 0.274951011f},
-std::array<float,2>{0.898590565f, 0.764430106f},
-std::array<float,2>{0.106945224f, 0.0105837965f},
-std::array<float,2>{0.187048092f, 0.929948807f},
-std::array<float,2>{0.830373347f, 0.246844694f},
-std::array<float,2>{0.675686717f, 0.744760871f},
-std::array<float,2>{0.476728082f, 0.490871996f},
-std::array<float,2>{0.425442696f, 0.857949495f},
-std::array<float,2>{0.744063854f, 0.116791524f},
-std::array<float,2>{0.788503945f, 0.568253338f},
-std::array<float,2>{0.228926554f, 0.36692813f},
-std::array<float,2>{0.0352763496f, 0.667218447f},
-std::array<float,2>{0.995205402f, 0.377692163f},
-std::array<float,2>{0.506909847f, 0.98762989f},
-std::array<float,2>{0.371016443f, 0.140345022f},
-std::array<float,2>{0.456375003f, 0.694600105f},
-std::array<float,2>{0.632385433f, 0.46158877f},
-std::array<float,2>{0.866667271f, 0.886679053f},
-std::array<float,2>{0.130534634f, 0.19952853f},
-std::array<float,2>{0.0815817788f, 0.796626925f},
-std::array<float,2>{0.930341065f, 0.0379938148f},
-std::array<float,2>{0.582104683f, 0.532696784f},
-std::array<float,2>{0.265726268f, 0.285699785f},
-std::array<float,2>{0.326301575f, 0.946172655f},
-std::array<float,2>{0.53312546f, 0.160103157f},
-std::array<float,2>{0.966422975f, 0.635389626f},
-std::array<float,2>{0.0207994133f, 0.429121494f},
-std::array<float,2>{0.215763345f, 0.618812203f},
-std::array<float,2>{0.755230606f, 0.331999153f},
-std::array<float,2>{0.688697934f, 0.839414418f},
-std::array<float,2>{0.375748724f, 0.0653935075f},
-std::array<float,2>{0.392082125f, 0.591658056f},
-std::array<float,2>{0.703829527f, 0.352959245f},
-std::array<float,2>{0.776402533f, 0.874224067f},
-std::array<float,2>{0.188725248f, 0.0975039676f},
-std::array<float,2>{0.0146894995f, 0.980470181f},
-std::array<float,2>{0.938430667f, 0.153263599f},
-std::array<float,2>{0.552015483f, 0.687273145f},
-std::array<float,2>{0.338829249f, 0.402979851f},
-std::array<float,2>{0.263501406f, 0.774190903f},
-std::array<float,2>{0.577805579f, 0.01600408f},
-std::array<float,2>{0.921492994f, 0.501664519f},
-std::array<float,2>{0.072856456f, 0.253077745f},
-std::array<float,2>{0.1491604f, 0.732119799f},
-std::array<float,2>{0.848445296f, 0.475054055f},
-std::array<float,2>{0.642805517f, 0.910692215f},
-std::array<float,2>{0.445201755f, 0.223313227f},
-std::array<float,2>{0.352073073f, 0.651068509f},
-std::array<float,2>{0.525460243f, 0.406808078f},
-std::array<float,2>{0.98258853f, 0.967844605f},
-std::array<float,2>{0.0504142679f, 0.185686305f},
-std::array<float,2>{0.249621436f, 0.818893135f},
-std::array<float,2>{0.806919992f, 0.0801938996f},
-std::array<float,2>{0.724263668f, 0.602605104f},
-std::array<float,2>{0.411590695f, 0.318620831f},
-std::array<float,2>{0.485327959f, 0.896292984f},
-std::array<float,2>{0.664312184f, 0.217384979f},
-std::array<float,2>{0.820275724f, 0.706159592f},
-std::array<float,2>{0.15666309f, 0.450898975f},
-std::array<float,2>{0.113992497f, 0.554206252f},
-std::array<float,2>{0.876957059f, 0.309022993f},
-std::array<float,2>{0.596498787f, 0.799397826f},
-std::array<float,2>{0.312341601f, 0.0498742349f},
-std::array<float,2>{0.335485488f, 0.601477385f},
-std::array<float,2>{0.554784417f, 0.324292034f},
-std::array<float,2>{0.94753778f, 0.825045705f},
-std::array<float,2>{0.00450555002f, 0.0922687799f},
-std::array<float,2>{0.198477566f, 0.953341365f},
-std::array<float,2>{0.765823722f, 0.176012293f},
-std::array<float,2>{0.71432656f, 0.647849262f},
-std::array<float,2>{0.40426904f, 0.419923723f},
-std::array<float,2>{0.446608841f, 0.808052659f},
-std::array<float,2>{0.648719847f, 0.060690932f},
-std::array<float,2>{0.857381403f, 0.558807611f},
-std::array<float,2>{0.146732286f, 0.303043395f},
-std::array<float,2>{0.0654729381f, 0.711553991f},
-std::array<float,2>{0.906521916f, 0.441144139f},
-std::array<float,2>{0.562622249f, 0.905682147f},
-std::array<float,2>{0.252133936f, 0.208335832f},
-std::array<float,2>{0.417440474f, 0.673260987f},
-std::array<float,2>{0.731939793f, 0.397381812f},
-std::array<float,2>{0.800322354f, 0.969833314f},
-std::array<float,2>{0.236279234f, 0.14580141f},
-std::array<float,2>{0.0589838102f, 0.86251682f},
-std::array<float,2>{0.971295595f, 0.108998448f},
-std::array<float,2>{0.517851591f, 0.580329418f},
-std::array<float,2>{0.348172635f, 0.349584907f},
-std::array<float,2>{0.304096997f, 0.917026758f},
-std::array<float,2>{0.604217947f, 0.233795553f},
-std::array<float,2>{0.890494227f, 0.725355566f},
-std::array<float,2>{0.12197835f, 0.476750016f},
-std::array<float,2>{0.167551681f, 0.511891782f},
-std::array<float,2>{0.824642837f, 0.262776315f},
-std::array<float,2>{0.657633066f, 0.769879043f},
-std::array<float,2>{0.49811694f, 0.0293651167f},
-std::array<float,2>{0.472138852f, 0.540925682f},
-std::array<float,2>{0.682302594f, 0.291380525f},
-std::array<float,2>{0.840078056f, 0.785957038f},
-std::array<float,2>{0.178797349f, 0.0468371809f},
-std::array<float,2>{0.0984098017f, 0.880469143f},
-std::array<float,2>{0.8916502f, 0.191899687f},
-std::array<float,2>{0.61442852f, 0.698376358f},
-std::array<float,2>{0.29495126f, 0.456910104f},
-std::array<float,2>{0.360848963f, 0.831723928f},
-std::array<float,2>{0.507903457f, 0.0707560629f},
-std::array<float,2>{0.988781393f, 0.610220969f},
-std::array<float,2>{0.0410846584f, 0.339794338f},
-std::array<float,2>{0.220326856f, 0.63011235f},
-std::array<float,2>{0.795185626f, 0.435214847f},
-std::array<float,2>{0.740825057f, 0.944430113f},
-std::array<float,2>{0.429879427f, 0.171414703f},
-std::array<float,2>{0.277149916f, 0.738660753f},
-std::array<float,2>{0.591601551f, 0.496487379f},
-std::array<float,2>{0.929022372f, 0.929074168f},
-std::array<float,2>{0.088972725f, 0.241306275f},
-std::array<float,2>{0.135095969f, 0.755912602f},
-std::array<float,2>{0.870678306f, 0.00102765043f},
-std::array<float,2>{0.63783139f, 0.525669158f},
-std::array<float,2>{0.464613497f, 0.272318631f},
-std::array<float,2>{0.382964879f, 0.995838881f},
-std::array<float,2>{0.697900891f, 0.12530145f},
-std::array<float,2>{0.760682642f, 0.657711625f},
-std::array<float,2>{0.209538698f, 0.384927511f},
-std::array<float,2>{0.0265858304f, 0.57397604f},
-std::array<float,2>{0.959086776f, 0.37106657f},
-std::array<float,2>{0.540365458f, 0.848545015f},
-std::array<float,2>{0.315974504f, 0.117310502f},
-std::array<float,2>{0.297259897f, 0.623489678f},
-std::array<float,2>{0.606158555f, 0.334370285f},
-std::array<float,2>{0.8851915f, 0.839863837f},
-std::array<float,2>{0.121050477f, 0.0698194727f},
-std::array<float,2>{0.16853936f, 0.950988829f},
-std::array<float,2>{0.821712136f, 0.161147267f},
-std::array<float,2>{0.660407722f, 0.638332367f},
-std::array<float,2>{0.494748086f, 0.424479902f},
-std::array<float,2>{0.418272644f, 0.791545331f},
-std::array<float,2>{0.727386236f, 0.0315007158f},
-std::array<float,2>{0.804563284f, 0.537387431f},
-std::array<float,2>{0.241392359f, 0.282265782f},
-std::array<float,2>{0.0564212389f, 0.691075563f},
-std::array<float,2>{0.976145804f, 0.465860903f},
-std::array<float,2>{0.523054242f, 0.889349759f},
-std::array<float,2>{0.345069408f, 0.198624611f},
-std::array<float,2>{0.449691951f, 0.670580328f},
-std::array<float,2>{0.654720068f, 0.380320579f},
-std::array<float,2>{0.855033219f, 0.988542557f},
-std::array<float,2>{0.143282548f, 0.134098217f},
-std::array<float,2>{0.0674652532f, 0.853898168f},
-std::array<float,2>{0.911037028f, 0.110214263f},
-std::array<float,2>{0.567143083f, 0.563397408f},
-std::array<float,2>{0.254589558f, 0.360933959f},
-std::array<float,2>{0.331839144f, 0.934832513f},
-std::array<float,2>{0.559540153f, 0.244481206f},
-std::array<float,2>{0.953094959f, 0.748117328f},
-std::array<float,2>{0.00174644741f, 0.485081375f},
-std::array<float,2>{0.202405185f, 0.519966602f},
-std::array<float,2>{0.77080816f, 0.279479533f},
-std::array<float,2>{0.715300202f, 0.759907067f},
-std::array<float,2>{0.400012881f, 0.0127167953f},
-std::array<float,2>{0.387491345f, 0.548844635f},
-std::array<float,2>{0.700058222f, 0.306843907f},
-std::array<float,2>{0.762938797f, 0.80264467f},
-std::array<float,2>{0.206122428f, 0.051928658f},
-std::array<float,2>{0.0298121665f, 0.893516541f},
-std::array<float,2>{0.954112649f, 0.214526504f},
-std::array<float,2>{0.544978023f, 0.708817422f},
-std::array<float,2>{0.319250017f, 0.448691696f},
-std::array<float,2>{0.279606253f, 0.815774322f},
-std::array<float,2>{0.587047458f, 0.0834437013f},
-std::array<float,2>{0.923955381f, 0.605784118f},
-std::array<float,2>{0.0916120261f, 0.314203858f},
-std::array<float,2>{0.138856232f, 0.654120445f},
-std::array<float,2>{0.874340475f, 0.413472384f},
-std::array<float,2>{0.633469939f, 0.9610883f},
-std::array<float,2>{0.468497485f, 0.180633634f},
-std::array<float,2>{0.364276975f, 0.727061212f},
-std::array<float,2>{0.512869179f, 0.469103277f},
-std::array<float,2>{0.987381518f, 0.908559203f},
-std::array<float,2>{0.0456570648f, 0.222507894f},
-std::array<float,2>{0.226193488f, 0.779435337f},
-std::array<float,2>{0.791711271f, 0.0216489658f},
-std::array<float,2>{0.738190353f, 0.507456541f},
-std::array<float,2>{0.435143888f, 0.255847186f},
-std::array<float,2>{0.475803673f, 0.977086008f},
-std::array<float,2>{0.687259197f, 0.149977595f},
-std::array<float,2>{0.836035669f, 0.680405617f},
-std::array<float,2>{0.173442692f, 0.401637375f},
-std::array<float,2>{0.0942203701f, 0.58911252f},
-std::array<float,2>{0.894899011f, 0.358439118f},
-std::array<float,2>{0.612403095f, 0.869804025f},
-std::array<float,2>{0.291702002f, 0.10102009f},
-std::array<float,2>{0.323449761f, 0.511635303f},
-std::array<float,2>{0.535621166f, 0.259091794f},
-std::array<float,2>{0.963673294f, 0.767259836f},
-std::array<float,2>{0.0175518859f, 0.0240501948f},
-std::array<float,2>{0.212749436f, 0.917989314f},
-std::array<float,2>{0.752058387f, 0.226958394f},
-std::array<float,2>{0.691752195f, 0.72074908f},
-std::array<float,2>{0.381955862f, 0.483263493f},
-std::array<float,2>{0.458164364f, 0.866437495f},
-std::array<float,2>{0.625489652f, 0.101871334f},
-std::array<float,2>{0.862046361f, 0.585335791f},
-std::array<float,2>{0.128028408f, 0.345995188f},
-std::array<float,2>{0.0832131803f, 0.679199338f},
-std::array<float,2>{0.936240435f, 0.393868268f},
-std::array<float,2>{0.57838577f, 0.975359797f},
-std::array<float,2>{0.27335912f, 0.142824352f},
-std::array<float,2>{0.429350913f, 0.71757859f},
-std::array<float,2>{0.749459803f, 0.444121331f},
-std::array<float,2>{0.784943819f, 0.900086284f},
-std::array<float,2>{0.231727973f, 0.206454635f},
-std::array<float,2>{0.0333386213f, 0.809416533f},
-std::array<float,2>{0.999905825f, 0.0574760139f},
-std::array<float,2>{0.50183177f, 0.554803014f},
-std::array<float,2>{0.373157769f, 0.297067821f},
-std::array<float,2>{0.284306586f, 0.959974766f},
-std::array<float,2>{0.622785032f, 0.174573943f},
-std::array<float,2>{0.906030238f, 0.643294454f},
-std::array<float,2>{0.103109486f, 0.414433002f},
-std::array<float,2>{0.182418317f, 0.593863308f},
-std::array<float,2>{0.833320022f, 0.320532471f},
-std::array<float,2>{0.677740932f, 0.821652472f},
-std::array<float,2>{0.481291622f, 0.0877306759f},
-std::array<float,2>{0.488448054f, 0.574613214f},
-std::array<float,2>{0.671194851f, 0.371837437f},
-std::array<float,2>{0.814174473f, 0.846299112f},
-std::array<float,2>{0.162158877f, 0.122190148f},
-std::array<float,2>{0.110077381f, 0.997537732f},
-std::array<float,2>{0.881186426f, 0.13225086f},
-std::array<float,2>{0.600031912f, 0.661117733f},
-std::array<float,2>{0.307538211f, 0.388045371f},
-std::array<float,2>{0.357540131f, 0.750590742f},
-std::array<float,2>{0.52997905f, 0.00493850186f},
-std::array<float,2>{0.977329195f, 0.527795553f},
-std::array<float,2>{0.0544235334f, 0.267663419f},
-std::array<float,2>{0.245335028f, 0.736036956f},
-std::array<float,2>{0.81050998f, 0.493336231f},
-std::array<float,2>{0.722187698f, 0.921956182f},
-std::array<float,2>{0.406254053f, 0.237328127f},
-std::array<float,2>{0.25919649f, 0.626458645f},
-std::array<float,2>{0.571937561f, 0.432447523f},
-std::array<float,2>{0.916153014f, 0.939288855f},
-std::array<float,2>{0.0764961541f, 0.167139694f},
-std::array<float,2>{0.153186873f, 0.834721029f},
-std::array<float,2>{0.844215751f, 0.0749186277f},
-std::array<float,2>{0.64826858f, 0.613953829f},
-std::array<float,2>{0.440882385f, 0.342443228f},
-std::array<float,2>{0.39560318f, 0.87642926f},
-std::array<float,2>{0.708515525f, 0.191030174f},
-std::array<float,2>{0.780914485f, 0.700460553f},
-std::array<float,2>{0.192118257f, 0.457911283f},
-std::array<float,2>{0.0100520747f, 0.543269157f},
-std::array<float,2>{0.94375211f, 0.2946302f},
-std::array<float,2>{0.547545373f, 0.78300935f},
-std::array<float,2>{0.342841208f, 0.0427997224f},
-std::array<float,2>{0.267593741f, 0.535022676f},
-std::array<float,2>{0.585366845f, 0.287754297f},
-std::array<float,2>{0.933096528f, 0.794302702f},
-std::array<float,2>{0.0791614056f, 0.0371008292f},
-std::array<float,2>{0.132069677f, 0.883793056f},
-std::array<float,2>{0.864562809f, 0.20117943f},
-std::array<float,2>{0.629800439f, 0.69240284f},
-std::array<float,2>{0.453156501f, 0.463572264f},
-std::array<float,2>{0.377693862f, 0.837051809f},
-std::array<float,2>{0.690959454f, 0.0626612082f},
-std::array<float,2>{0.757601976f, 0.619638324f},
-std::array<float,2>{0.217070192f, 0.328490287f},
-std::array<float,2>{0.0223714244f, 0.633439243f},
-std::array<float,2>{0.967808425f, 0.42705667f},
-std::array<float,2>{0.534291267f, 0.94855541f},
-std::array<float,2>{0.326045871f, 0.156385064f},
-std::array<float,2>{0.479051262f, 0.743070781f},
-std::array<float,2>{0.672399044f, 0.48887229f},
-std::array<float,2>{0.829560816f, 0.932140827f},
-std::array<float,2>{0.184144914f, 0.249975249f},
-std::array<float,2>{0.107473634f, 0.762721479f},
-std::array<float,2>{0.900522709f, 0.00912462641f},
-std::array<float,2>{0.620785654f, 0.518613398f},
-std::array<float,2>{0.287084073f, 0.276794791f},
-std::array<float,2>{0.367438883f, 0.98485285f},
-std::array<float,2>{0.504566729f, 0.137960568f},
-std::array<float,2>{0.993399799f, 0.664393544f},
-std::array<float,2>{0.0380601995f, 0.37603724f},
-std::array<float,2>{0.226723567f, 0.56889987f},
-std::array<float,2>{0.786224782f, 0.364318758f},
-std::array<float,2>{0.745006144f, 0.857262313f},
-std::array<float,2>{0.422974348f, 0.113531366f},
-std::array<float,2>{0.412803203f, 0.603681147f},
-std::array<float,2>{0.726406574f, 0.316410482f},
-std::array<float,2>{0.805995405f, 0.816468656f},
-std::array<float,2>{0.246393964f, 0.0782789737f},
-std::array<float,2>{0.0486106351f, 0.966183603f},
-std::array<float,2>{0.981423557f, 0.185344636f},
-std::array<float,2>{0.523660123f, 0.649762809f},
-std::array<float,2>{0.35508889f, 0.408239156f},
-std::array<float,2>{0.309356779f, 0.797396064f},
-std::array<float,2>{0.595223725f, 0.0472915806f},
-std::array<float,2>{0.87519604f, 0.552312613f},
-std::array<float,2>{0.116729356f, 0.311801761f},
-std::array<float,2>{0.159682095f, 0.704676747f},
-std::array<float,2>{0.816930175f, 0.452300787f},
-std::array<float,2>{0.667825937f, 0.896919966f},
-std::array<float,2>{0.486935556f, 0.215678871f},
-std::array<float,2>{0.336601496f, 0.68373245f},
-std::array<float,2>{0.554430008f, 0.404598236f},
-std::array<float,2>{0.940668404f, 0.98437196f},
-std::array<float,2>{0.0123897074f, 0.155244187f},
-std::array<float,2>{0.190729246f, 0.872224331f},
-std::array<float,2>{0.774047673f, 0.0942943916f},
-std::array<float,2>{0.705328822f, 0.59256357f},
-std::array<float,2>{0.394390047f, 0.355175734f},
-std::array<float,2>{0.443087161f, 0.913732886f},
-std::array<float,2>{0.641614199f, 0.225285754f},
-std::array<float,2>{0.850662589f, 0.732632577f},
-std::array<float,2>{0.152090907f, 0.474290788f},
-std::array<float,2>{0.0711818635f, 0.503184974f},
-std::array<float,2>{0.918507695f, 0.251066357f},
-std::array<float,2>{0.574556828f, 0.776780188f},
-std::array<float,2>{0.263799906f, 0.0185799319f},
-std::array<float,2>{0.350300729f, 0.57961452f},
-std::array<float,2>{0.516408384f, 0.351204634f},
-std::array<float,2>{0.969219387f, 0.860007286f},
-std::array<float,2>{0.061638847f, 0.10725867f},
-std::array<float,2>{0.237234116f, 0.972536027f},
-std::array<float,2>{0.798341811f, 0.146768808f},
-std::array<float,2>{0.733303308f, 0.674611986f},
-std::array<float,2>{0.415664166f, 0.395404935f},
-std::array<float,2>{0.497944504f, 0.773009956f},
-std::array<float,2>{0.660125434f, 0.0278587416f},
-std::array<float,2>{0.826364994f, 0.514045537f},
-std::array<float,2>{0.165807009f, 0.264313072f},
-std::array<float,2>{0.123614065f, 0.724367201f},
-std::array<float,2>{0.888649106f, 0.479694515f},
-std::array<float,2>{0.601640105f, 0.915518165f},
-std::array<float,2>{0.302318573f, 0.231041551f},
-std::array<float,2>{0.406119108f, 0.646009445f},
-std::array<float,2>{0.711156845f, 0.419094861f},
-std::array<float,2>{0.768864274f, 0.955887914f},
-std::array<float,2>{0.196034044f, 0.17903696f},
-std::array<float,2>{0.00641555525f, 0.827417254f},
-std::array<float,2>{0.945467055f, 0.0901008099f},
-std::array<float,2>{0.557556391f, 0.597785532f},
-std::array<float,2>{0.332517564f, 0.326972663f},
-std::array<float,2>{0.250747293f, 0.903550148f},
-std::array<float,2>{0.565731227f, 0.209315315f},
-std::array<float,2>{0.909483373f, 0.713191807f},
-std::array<float,2>{0.0631871894f, 0.438656569f},
-std::array<float,2>{0.144943222f, 0.56104511f},
-std::array<float,2>{0.857655227f, 0.301651329f},
-std::array<float,2>{0.652048051f, 0.806133568f},
-std::array<float,2>{0.448696792f, 0.0588738844f},
-std::array<float,2>{0.461604774f, 0.524652004f},
-std::array<float,2>{0.639379442f, 0.269968092f},
-std::array<float,2>{0.867800534f, 0.754313707f},
-std::array<float,2>{0.1330145f, 0.00339700212f},
-std::array<float,2>{0.0867775753f, 0.927085042f},
-std::array<float,2>{0.926198065f, 0.238684043f},
-std::array<float,2>{0.593550324f, 0.74059248f},
-std::array<float,2>{0.274806499f, 0.498647213f},
-std::array<float,2>{0.31337288f, 0.850359321f},
-std::array<float,2>{0.5413149f, 0.120326713f},
-std::array<float,2>{0.957664967f, 0.570920885f},
-std::array<float,2>{0.0250492394f, 0.368859172f},
-std::array<float,2>{0.207393169f, 0.660039067f},
-std::array<float,2>{0.759382427f, 0.382820427f},
-std::array<float,2>{0.695573986f, 0.993321002f},
-std::array<float,2>{0.386201024f, 0.127110764f},
-std::array<float,2>{0.293478578f, 0.695865512f},
-std::array<float,2>{0.617172122f, 0.453952223f},
-std::array<float,2>{0.894164324f, 0.882019937f},
-std::array<float,2>{0.100673363f, 0.194244429f},
-std::array<float,2>{0.177231684f, 0.788836062f},
-std::array<float,2>{0.841931224f, 0.0437363274f},
-std::array<float,2>{0.679844081f, 0.541079104f},
-std::array<float,2>{0.468996435f, 0.289607465f},
-std::array<float,2>{0.432212144f, 0.942155421f},
-std::array<float,2>{0.738990486f, 0.169407576f},
-std::array<float,2>{0.794518411f, 0.631835818f},
-std::array<float,2>{0.222337395f, 0.436767668f},
-std::array<float,2>{0.0410058126f, 0.611455977f},
-std::array<float,2>{0.990385592f, 0.336025685f},
-std::array<float,2>{0.511308908f, 0.828505993f},
-std::array<float,2>{0.361860394f, 0.0727105141f},
-std::array<float,2>{0.306825101f, 0.577254653f},
-std::array<float,2>{0.600488126f, 0.374923199f},
-std::array<float,2>{0.88138479f, 0.844662905f},
-std::array<float,2>{0.109805837f, 0.124263853f},
-std::array<float,2>{0.162855476f, 0.999560297f},
-std::array<float,2>{0.813913524f, 0.129037797f},
-std::array<float,2>{0.671644509f, 0.662729084f},
-std::array<float,2>{0.488858998f, 0.389212936f},
-std::array<float,2>{0.406894952f, 0.753726304f},
-std::array<float,2>{0.72190541f, 0.00619074469f},
-std::array<float,2>{0.809717596f, 0.530832052f},
-std::array<float,2>{0.245937884f, 0.267281771f},
-std::array<float,2>{0.0539465174f, 0.737057328f},
-std::array<float,2>{0.976635396f, 0.495857298f},
-std::array<float,2>{0.529426336f, 0.92409116f},
-std::array<float,2>{0.358337849f, 0.234557346f},
-std::array<float,2>{0.440979779f, 0.627316535f},
-std::array<float,2>{0.647550225f, 0.430091918f},
-std::array<float,2>{0.844244719f, 0.941080749f},
-std::array<float,2>{0.152616203f, 0.164475322f},
-std::array<float,2>{0.0770580769f, 0.832359314f},
-std::array<float,2>{0.91656065f, 0.077072829f},
-std::array<float,2>{0.571555853f, 0.615394294f},
-std::array<float,2>{0.259325147f, 0.340742081f},
-std::array<float,2>{0.343345016f, 0.877903104f},
-std::array<float,2>{0.547037721f, 0.189282f},
-std::array<float,2>{0.944186747f, 0.702817798f},
-std::array<float,2>{0.0107395584f, 0.459249258f},
-std::array<float,2>{0.191758126f, 0.546318173f},
-std::array<float,2>{0.780522227f, 0.295189023f},
-std::array<float,2>{0.708324969f, 0.783452749f},
-std::array<float,2>{0.396134913f, 0.0402756631f},
-std::array<float,2>{0.382369041f, 0.508108497f},
-std::array<float,2>{0.69223088f, 0.261221141f},
-std::array<float,2>{0.752463758f, 0.768577456f},
-std::array<float,2>{0.21224004f, 0.0259317141f},
-std::array<float,2>{0.0167916268f, 0.920826256f},
-std::array<float,2>{0.96310246f, 0.229833871f},
-std::array<float,2>{0.535781145f, 0.71957922f},
-std::array<float,2>{0.324073881f, 0.482173324f},
-std::array<float,2>{0.272720963f, 0.863395274f},
-std::array<float,2>{0.578780413f, 0.104915775f},
-std::array<float,2>{0.935843706f, 0.582349479f},
-std::array<float,2>{0.0835361555f, 0.344607264f},
-std::array<float,2>{0.1284841f, 0.675810277f},
-std::array<float,2>{0.861760139f, 0.391462922f},
-std::array<float,2>{0.625133574f, 0.973757565f},
-std::array<float,2>{0.458704144f, 0.141025037f},
-std::array<float,2>{0.373801947f, 0.715514243f},
-std::array<float,2>{0.501240611f, 0.442419112f},
-std::array<float,2>{0.999302924f, 0.902212918f},
-std::array<float,2>{0.0341131613f, 0.203783825f},
-std::array<float,2>{0.232162997f, 0.810893297f},
-std::array<float,2>{0.784485519f, 0.0552090593f},
-std::array<float,2>{0.749791026f, 0.558114707f},
-std::array<float,2>{0.429157734f, 0.30027625f},
-std::array<float,2>{0.480948865f, 0.958778322f},
-std::array<float,2>{0.678386748f, 0.172281802f},
-std::array<float,2>{0.83379072f, 0.640828252f},
-std::array<float,2>{0.181834906f, 0.416446388f},
-std::array<float,2>{0.102760859f, 0.596739471f},
-std::array<float,2>{0.905751705f, 0.323772371f},
-std::array<float,2>{0.622498453f, 0.822343528f},
-std::array<float,2>{0.284843087f, 0.0891142413f},
-std::array<float,2>{0.318527609f, 0.548772931f},
-std::array<float,2>{0.545762837f, 0.306027532f},
-std::array<float,2>{0.95503509f, 0.803709745f},
-std::array<float,2>{0.0295802914f, 0.0546250343f},
-std::array<float,2>{0.206936762f, 0.892210186f},
-std::array<float,2>{0.763335407f, 0.211244971f},
-std::array<float,2>{0.699521482f, 0.710906863f},
-std::array<float,2>{0.387165695f, 0.447177917f},
-std::array<float,2>{0.468137771f, 0.813849211f},
-std::array<float,2>{0.632848203f, 0.0855916888f},
-std::array<float,2>{0.874605f, 0.607563853f},
-std::array<float,2>{0.139277786f, 0.3153418f},
-std::array<float,2>{0.0910485461f, 0.655318379f},
-std::array<float,2>{0.924421787f, 0.410290062f},
-std::array<float,2>{0.587553859f, 0.963751972f},
-std::array<float,2>{0.280246705f, 0.182783127f},
-std::array<float,2>{0.435000181f, 0.728752494f},
-std::array<float,2>{0.737414598f, 0.472620368f},
-std::array<float,2>{0.791499853f, 0.908067405f},
-std::array<float,2>{0.225859344f, 0.219847932f},
-std::array<float,2>{0.0449295528f, 0.778835416f},
-std::array<float,2>{0.988273919f, 0.0197564438f},
-std::array<float,2>{0.513246953f, 0.504217982f},
-std::array<float,2>{0.36496076f, 0.257456362f},
-std::array<float,2>{0.291080981f, 0.979671717f},
-std::array<float,2>{0.613081932f, 0.151642814f},
-std::array<float,2>{0.895134628f, 0.682667077f},
-std::array<float,2>{0.0945326164f, 0.399437875f},
-std::array<float,2>{0.173242763f, 0.587779522f},
-std::array<float,2>{0.836776376f, 0.356750637f},
-std::array<float,2>{0.68663758f, 0.868971467f},
-std::array<float,2>{0.476403922f, 0.0995774791f},
-std::array<float,2>{0.494170427f, 0.621313989f},
-std::array<float,2>{0.66112113f, 0.332189322f},
-std::array<float,2>{0.822149396f, 0.843617976f},
-std::array<float,2>{0.168301329f, 0.0665635467f},
-std::array<float,2>{0.120573215f, 0.951535285f},
-std::array<float,2>{0.885602236f, 0.164035544f},
-std::array<float,2>{0.605922043f, 0.63894552f},
-std::array<float,2>{0.297597885f, 0.423375875f},
-std::array<float,2>{0.34556666f, 0.789178252f},
-std::array<float,2>{0.522696137f, 0.0343317613f},
-std::array<float,2>{0.976041913f, 0.536902189f},
-std::array<float,2>{0.0559846647f, 0.283785015f},
-std::array<float,2>{0.241709262f, 0.687627912f},
-std::array<float,2>{0.804080665f, 0.467304379f},
-std::array<float,2>{0.726953268f, 0.887913167f},
-std::array<float,2>{0.418836057f, 0.195749283f},
-std::array<float,2>{0.254260272f, 0.669340312f},
-std::array<float,2>{0.566631377f, 0.382767797f},
-std::array<float,2>{0.910205245f, 0.99166435f},
-std::array<float,2>{0.0680661947f, 0.13549155f},
-std::array<float,2>{0.142805636f, 0.853306174f},
-std::array<float,2>{0.854577661f, 0.11309468f},
-std::array<float,2>{0.655212104f, 0.565599859f},
-std::array<float,2>{0.449819565f, 0.362575144f},
-std::array<float,2>{0.399874449f, 0.935692191f},
-std::array<float,2>{0.71536988f, 0.242824122f},
-std::array<float,2>{0.771049261f, 0.746409059f},
-std::array<float,2>{0.20269087f, 0.487027079f},
-std::array<float,2>{0.00117750128f, 0.522506356f},
-std::array<float,2>{0.952404022f, 0.277938902f},
-std::array<float,2>{0.558691204f, 0.758758247f},
-std::array<float,2>{0.331267595f, 0.0141467536f},
-std::array<float,2>{0.275008291f, 0.52596271f},
-std::array<float,2>{0.59294045f, 0.271712393f},
-std::array<float,2>{0.926611006f, 0.756404817f},
-std::array<float,2>{0.0863140523f, 0.00165092025f},
-std::array<float,2>{0.133372039f, 0.92943877f},
-std::array<float,2>{0.867270768f, 0.242037237f},
-std::array<float,2>{0.638997376f, 0.73894155f},
-std::array<float,2>{0.461029112f, 0.496584177f},
-std::array<float,2>{0.386520028f, 0.848018289f},
-std::array<float,2>{0.696155369f, 0.118052363f},
-std::array<float,2>{0.758954823f, 0.573486984f},
-std::array<float,2>{0.207679942f, 0.370520264f},
-std::array<float,2>{0.0248842705f, 0.658123672f},
-std::array<float,2>{0.957085133f, 0.385357767f},
-std::array<float,2>{0.541680336f, 0.995187342f},
-std::array<float,2>{0.312624484f, 0.125708088f},
-std::array<float,2>{0.46962595f, 0.69895494f},
-std::array<float,2>{0.680629551f, 0.456342906f},
-std::array<float,2>{0.842388511f, 0.880078912f},
-std::array<float,2>{0.17728202f, 0.191711202f},
-std::array<float,2>{0.101097874f, 0.785437763f},
-std::array<float,2>{0.893637359f, 0.0460172482f},
-std::array<float,2>{0.61656177f, 0.54038322f},
-std::array<float,2>{0.293341815f, 0.291936696f},
-std::array<float,2>{0.361814529f, 0.945189595f},
-std::array<float,2>{0.511095762f, 0.170910209f},
-std::array<float,2>{0.991185546f, 0.630699456f},
-std::array<float,2>{0.0402858146f, 0.434608102f},
-std::array<float,2>{0.221993029f, 0.609799087f},
-std::array<float,2>{0.79408896f, 0.339145154f},
-std::array<float,2>{0.738427818f, 0.83135283f},
-std::array<float,2>{0.431941271f, 0.0709647685f},
-std::array<float,2>{0.415476233f, 0.580768824f},
-std::array<float,2>{0.732785523f, 0.349117905f},
-std::array<float,2>{0.797904968f, 0.863224924f},
-std::array<float,2>{0.236333162f, 0.10858845f},
-std::array<float,2>{0.0624899082f, 0.970260382f},
-std::array<float,2>{0.969350457f, 0.146028116f},
-std::array<float,2>{0.515956461f, 0.673371851f},
-std::array<float,2>{0.349885643f, 0.396709502f},
-std::array<float,2>{0.302150995f, 0.77045995f},
-std::array<float,2>{0.602425218f, 0.0300857686f},
-std::array<float,2>{0.888039529f, 0.512634873f},
-std::array<float,2>{0.123294957f, 0.263410181f},
-std::array<float,2>{0.165477768f, 0.725056827f},
-std::array<float,2>{0.827128172f, 0.477484643f},
-std::array<float,2>{0.659475565f, 0.917548954f},
-std::array<float,2>{0.497435361f, 0.234254569f},
-std::array<float,2>{0.332712591f, 0.648389041f},
-std::array<float,2>{0.557046771f, 0.420763224f},
-std::array<float,2>{0.946175992f, 0.954037845f},
-std::array<float,2>{0.00617503608f, 0.176302522f},
-std::array<float,2>{0.195641994f, 0.824573219f},
-std::array<float,2>{0.769207954f, 0.0926526859f},
-std::array<float,2>{0.711677849f, 0.600648105f},
-std::array<float,2>{0.405413896f, 0.324892193f},
-std::array<float,2>{0.448971957f, 0.906128585f},
-std::array<float,2>{0.651771605f, 0.208644986f},
-std::array<float,2>{0.85800606f, 0.711057961f},
-std::array<float,2>{0.145407453f, 0.440477163f},
-std::array<float,2>{0.0628848895f, 0.559532106f},
-std::array<float,2>{0.90977037f, 0.303655386f},
-std::array<float,2>{0.56598711f, 0.808206797f},
-std::array<float,2>{0.250332534f, 0.0610939004f},
-std::array<float,2>{0.354808718f, 0.603445053f},
-std::array<float,2>{0.524256289f, 0.318950146f},
-std::array<float,2>{0.980757415f, 0.818772018f},
-std::array<float,2>{0.0482504703f, 0.081017442f},
-std::array<float,2>{0.247066066f, 0.968676865f},
-std::array<float,2>{0.806413829f, 0.186354086f},
-std::array<float,2>{0.726020515f, 0.650805652f},
-std::array<float,2>{0.412395507f, 0.406387478f},
-std::array<float,2>{0.48646614f, 0.798860908f},
-std::array<float,2>{0.667197764f, 0.0506265759f},
-std::array<float,2>{0.816452205f, 0.553917825f},
-std::array<float,2>{0.159328073f, 0.309536994f},
-std::array<float,2>{0.116322257f, 0.706766546f},
-std::array<float,2>{0.875505149f, 0.450423032f},
-std::array<float,2>{0.595030367f, 0.895527542f},
-std::array<float,2>{0.309018582f, 0.216845274f},
-std::array<float,2>{0.393995255f, 0.686549425f},
-std::array<float,2>{0.705678701f, 0.402682006f},
-std::array<float,2>{0.773532569f, 0.981246412f},
-std::array<float,2>{0.190963209f, 0.152530044f},
-std::array<float,2>{0.0121592041f, 0.874769926f},
-std::array<float,2>{0.941111684f, 0.0969767421f},
-std::array<float,2>{0.553860068f, 0.591055453f},
-std::array<float,2>{0.336276859f, 0.353507727f},
-std::array<float,2>{0.264214426f, 0.910226882f},
-std::array<float,2>{0.575118363f, 0.222894073f},
-std::array<float,2>{0.918084502f, 0.731801689f},
-std::array<float,2>{0.0704848766f, 0.475343913f},
-std::array<float,2>{0.151774615f, 0.50127691f},
-std::array<float,2>{0.851405621f, 0.253833771f},
-std::array<float,2>{0.642570734f, 0.773517191f},
-std::array<float,2>{0.442423046f, 0.0162278116f},
-std::array<float,2>{0.454094976f, 0.532764077f},
-std::array<float,2>{0.629296243f, 0.285282224f},
-std::array<float,2>{0.865116656f, 0.796123087f},
-std::array<float,2>{0.132490933f, 0.0374926887f},
-std::array<float,2>{0.0797348619f, 0.885798573f},
-std::array<float,2>{0.933424532f, 0.199900568f},
-std::array<float,2>{0.585673332f, 0.695172846f},
-std::array<float,2>{0.26849997f, 0.461171627f},
-std::array<float,2>{0.325586289f, 0.838983595f},
-std::array<float,2>{0.534824193f, 0.0649116412f},
-std::array<float,2>{0.968624592f, 0.618530095f},
-std::array<float,2>{0.0214869678f, 0.331150651f},
-std::array<float,2>{0.217723563f, 0.635059774f},
-std::array<float,2>{0.756873429f, 0.429433942f},
-std::array<float,2>{0.690498531f, 0.945669711f},
-std::array<float,2>{0.377016068f, 0.159483582f},
-std::array<float,2>{0.286466628f, 0.744355857f},
-std::array<float,2>{0.620323598f, 0.490557849f},
-std::array<float,2>{0.901337802f, 0.930520713f},
-std::array<float,2>{0.107991651f, 0.246206313f},
-std::array<float,2>{0.183639258f, 0.763869345f},
-std::array<float,2>{0.8296175f, 0.010098408f},
-std::array<float,2>{0.67207545f, 0.515703261f},
-std::array<float,2>{0.478527129f, 0.274518639f},
-std::array<float,2>{0.423536986f, 0.988082886f},
-std::array<float,2>{0.744221687f, 0.139726445f},
-std::array<float,2>{0.786916852f, 0.667768717f},
-std::array<float,2>{0.227400988f, 0.377434015f},
-std::array<float,2>{0.0374265462f, 0.567819595f},
-std::array<float,2>{0.993670225f, 0.366658896f},
-std::array<float,2>{0.504278958f, 0.85779196f},
-std::array<float,2>{0.367939383f, 0.116604164f},
-std::array<float,2>{0.260287255f, 0.613418221f},
-std::array<float,2>{0.572266459f, 0.342019737f},
-std::array<float,2>{0.914320052f, 0.834438682f},
-std::array<float,2>{0.0758856982f, 0.0744753182f},
-std::array<float,2>{0.154597923f, 0.938947439f},
-std::array<float,2>{0.846949399f, 0.167539999f},
-std::array<float,2>{0.645057321f, 0.626798391f},
-std::array<float,2>{0.438926697f, 0.431939512f},
-std::array<float,2>{0.398282796f, 0.782263279f},
-std::array<float,2>{0.710196137f, 0.0420484059f},
-std::array<float,2>{0.77776444f, 0.543477058f},
-std::array<float,2>{0.194102824f, 0.294407606f},
-std::array<float,2>{0.00822115783f, 0.700910568f},
-std::array<float,2>{0.942745566f, 0.457407564f},
-std::array<float,2>{0.549132705f, 0.876767576f},
-std::array<float,2>{0.341124684f, 0.19083111f},
-std::array<float,2>{0.49082619f, 0.660256207f},
-std::array<float,2>{0.669782937f, 0.38834393f},
-std::array<float,2>{0.815217078f, 0.997643948f},
-std::array<float,2>{0.161593989f, 0.132581577f},
-std::array<float,2>{0.112517253f, 0.845989048f},
-std::array<float,2>{0.879829049f, 0.12288329f},
-std::array<float,2>{0.598534763f, 0.574837923f},
-std::array<float,2>{0.306022644f, 0.371208817f},
-std::array<float,2>{0.356431663f, 0.922528982f},
-std::array<float,2>{0.528421044f, 0.238139078f},
-std::array<float,2>{0.97917372f, 0.735760987f},
-std::array<float,2>{0.0507935695f, 0.49406907f},
-std::array<float,2>{0.243597552f, 0.528119028f},
-std::array<float,2>{0.811321318f, 0.268232524f},
-std::array<float,2>{0.719276726f, 0.750332296f},
-std::array<float,2>{0.409129292f, 0.00549242878f},
-std::array<float,2>{0.426103771f, 0.555510044f},
-std::array<float,2>{0.746400535f, 0.297546238f},
-std::array<float,2>{0.783061147f, 0.809075356f},
-std::array<float,2>{0.232538864f, 0.056666512f},
-std::array<float,2>{0.0324198194f, 0.899849117f},
-std::array<float,2>{0.996860445f, 0.206644207f},
-std::array<float,2>{0.502117276f, 0.71720612f},
-std::array<float,2>{0.371857017f, 0.443579942f},
-std::array<float,2>{0.282939255f, 0.821828723f},
-std::array<float,2>{0.624667525f, 0.0870861188f},
-std::array<float,2>{0.903994441f, 0.59452486f},
-std::array<float,2>{0.103952281f, 0.321118981f},
-std::array<float,2>{0.181396738f, 0.642807901f},
-std::array<float,2>{0.834444523f, 0.414781809f},
-std::array<float,2>{0.676405668f, 0.960737169f},
-std::array<float,2>{0.483725786f, 0.173835486f},
-std::array<float,2>{0.320681483f, 0.721264601f},
-std::array<float,2>{0.538796961f, 0.48260662f},
-std::array<float,2>{0.961265802f, 0.918810725f},
-std::array<float,2>{0.018674273f, 0.227279812f},
-std::array<float,2>{0.213556111f, 0.766809464f},
-std::array<float,2>{0.751797855f, 0.0237735063f},
-std::array<float,2>{0.695266008f, 0.510765612f},
-std::array<float,2>{0.379942358f, 0.259477645f},
-std::array<float,2>{0.460032761f, 0.974863172f},
-std::array<float,2>{0.628272057f, 0.143205091f},
-std::array<float,2>{0.861232579f, 0.6788432f},
-std::array<float,2>{0.126519546f, 0.394500345f},
-std::array<float,2>{0.0842336565f, 0.585477531f},
-std::array<float,2>{0.93444401f, 0.346538931f},
-std::array<float,2>{0.580922365f, 0.867177188f},
-std::array<float,2>{0.271437764f, 0.102082357f},
-std::array<float,2>{0.366309494f, 0.506910622f},
-std::array<float,2>{0.513770521f, 0.255358398f},
-std::array<float,2>{0.985832036f, 0.780084133f},
-std::array<float,2>{0.0431642085f, 0.0222261846f},
-std::array<float,2>{0.223612458f, 0.90878135f},
-std::array<float,2>{0.790195525f, 0.221882418f},
-std::array<float,2>{0.734923601f, 0.726791024f},
-std::array<float,2>{0.43639493f, 0.469647557f},
-std::array<float,2>{0.473062605f, 0.869149983f},
-std::array<float,2>{0.684050918f, 0.101146758f},
-std::array<float,2>{0.838345349f, 0.589813888f},
-std::array<float,2>{0.1753878f, 0.359216154f},
-std::array<float,2>{0.0966512635f, 0.680157304f},
-std::array<float,2>{0.897783935f, 0.40227294f},
-std::array<float,2>{0.610939324f, 0.97668618f},
-std::array<float,2>{0.290442258f, 0.149443299f},
-std::array<float,2>{0.390465319f, 0.708289027f},
-std::array<float,2>{0.701494396f, 0.44877252f},
-std::array<float,2>{0.764168561f, 0.892772675f},
-std::array<float,2>{0.2038683f, 0.213948399f},
-std::array<float,2>{0.0282730889f, 0.801885307f},
-std::array<float,2>{0.955891371f, 0.0525985733f},
-std::array<float,2>{0.543045044f, 0.54979527f},
-std::array<float,2>{0.317701459f, 0.30744797f},
-std::array<float,2>{0.278715432f, 0.961531281f},
-std::array<float,2>{0.588357508f, 0.179946765f},
-std::array<float,2>{0.922613382f, 0.653602064f},
-std::array<float,2>{0.0919966325f, 0.413920313f},
-std::array<float,2>{0.138494626f, 0.606292248f},
-std::array<float,2>{0.872464299f, 0.313703805f},
-std::array<float,2>{0.634897768f, 0.815971553f},
-std::array<float,2>{0.46560967f, 0.0835036859f},
-std::array<float,2>{0.452894449f, 0.562718511f},
-std::array<float,2>{0.652427554f, 0.360431314f},
-std::array<float,2>{0.852358699f, 0.854315042f},
-std::array<float,2>{0.141417772f, 0.109836489f},
-std::array<float,2>{0.0687165707f, 0.989004612f},
-std::array<float,2>{0.913831651f, 0.134558737f},
-std::array<float,2>{0.570177734f, 0.67000854f},
-std::array<float,2>{0.257157296f, 0.38069436f},
-std::array<float,2>{0.328691989f, 0.760448515f},
-std::array<float,2>{0.562084436f, 0.0136380997f},
-std::array<float,2>{0.950806141f, 0.52039665f},
-std::array<float,2>{0.0032506159f, 0.279978484f},
-std::array<float,2>{0.201148689f, 0.748857915f},
-std::array<float,2>{0.773050904f, 0.484679431f},
-std::array<float,2>{0.71822834f, 0.93529892f},
-std::array<float,2>{0.402221292f, 0.244883165f},
-std::array<float,2>{0.299578279f, 0.637992918f},
-std::array<float,2>{0.607533276f, 0.424269706f},
-std::array<float,2>{0.882974088f, 0.95058018f},
-std::array<float,2>{0.118644252f, 0.161856294f},
-std::array<float,2>{0.17010574f, 0.840668857f},
-std::array<float,2>{0.824034393f, 0.0698653385f},
-std::array<float,2>{0.662562907f, 0.623825073f},
-std::array<float,2>{0.492915243f, 0.334538013f},
-std::array<float,2>{0.42087236f, 0.889130414f},
-std::array<float,2>{0.730118036f, 0.199013889f},
-std::array<float,2>{0.802097142f, 0.690448403f},
-std::array<float,2>{0.238530025f, 0.466751754f},
-std::array<float,2>{0.0577955134f, 0.537978888f},
-std::array<float,2>{0.974562347f, 0.283119202f},
-std::array<float,2>{0.520177245f, 0.791061103f},
-std::array<float,2>{0.345882237f, 0.0318838283f},
-std::array<float,2>{0.295741141f, 0.541739881f},
-std::array<float,2>{0.615070522f, 0.289284885f},
-std::array<float,2>{0.89211762f, 0.788502097f},
-std::array<float,2>{0.0978014395f, 0.0434180573f},
-std::array<float,2>{0.179261148f, 0.88264519f},
-std::array<float,2>{0.840374708f, 0.193614408f},
-std::array<float,2>{0.681863546f, 0.695726633f},
-std::array<float,2>{0.472409666f, 0.453557581f},
-std::array<float,2>{0.43043378f, 0.828666449f},
-std::array<float,2>{0.740553558f, 0.0731158629f},
-std::array<float,2>{0.795678556f, 0.611877084f},
-std::array<float,2>{0.219750211f, 0.336523414f},
-std::array<float,2>{0.0415410884f, 0.631049335f},
-std::array<float,2>{0.98834908f, 0.437141746f},
-std::array<float,2>{0.50860709f, 0.941846967f},
-std::array<float,2>{0.360834599f, 0.169512048f},
-std::array<float,2>{0.464113861f, 0.740887284f},
-std::array<float,2>{0.638457716f, 0.498130679f},
-std::array<float,2>{0.870497108f, 0.927517653f},
-std::array<float,2>{0.135700837f, 0.238990486f},
-std::array<float,2>{0.0897580981f, 0.754616678f},
-std::array<float,2>{0.929382741f, 0.00375006045f},
-std::array<float,2>{0.591271639f, 0.525270522f},
-std::array<float,2>{0.276373237f, 0.270469785f},
-std::array<float,2>{0.315485328f, 0.993750334f},
-std::array<float,2>{0.540898383f, 0.127673224f},
-std::array<float,2>{0.959842563f, 0.659227967f},
-std::array<float,2>{0.0270956624f, 0.383507282f},
-std::array<float,2>{0.209005654f, 0.570741892f},
-std::array<float,2>{0.7598598f, 0.368461668f},
-std::array<float,2>{0.697318912f, 0.849660218f},
-std::array<float,2>{0.38376534f, 0.120860733f},
-std::array<float,2>{0.403395325f, 0.598378241f},
-std::array<float,2>{0.714641333f, 0.326355129f},
-std::array<float,2>{0.766594768f, 0.827778757f},
-std::array<float,2>{0.198888481f, 0.0908075795f},
-std::array<float,2>{0.0043749758f, 0.955257535f},
-std::array<float,2>{0.947814941f, 0.179559872f},
-std::array<float,2>{0.555434465f, 0.645826101f},
-std::array<float,2>{0.335230231f, 0.419594377f},
-std::array<float,2>{0.252594769f, 0.806242466f},
-std::array<float,2>{0.563452899f, 0.0591722243f},
-std::array<float,2>{0.907147348f, 0.560951531f},
-std::array<float,2>{0.0663603395f, 0.300858378f},
-std::array<float,2>{0.146984518f, 0.713491142f},
-std::array<float,2>{0.856764972f, 0.438968837f},
-std::array<float,2>{0.649000704f, 0.903974354f},
-std::array<float,2>{0.446820021f, 0.209894255f},
-std::array<float,2>{0.347916365f, 0.673858166f},
-std::array<float,2>{0.518110394f, 0.394552261f},
-std::array<float,2>{0.971062303f, 0.97182852f},
-std::array<float,2>{0.0591588952f, 0.147207588f},
-std::array<float,2>{0.235498622f, 0.859702468f},
-std::array<float,2>{0.800042808f, 0.106878385f},
-std::array<float,2>{0.731522024f, 0.579295218f},
-std::array<float,2>{0.417676747f, 0.35070473f},
-std::array<float,2>{0.498724282f, 0.91570586f},
-std::array<float,2>{0.658117354f, 0.230591685f},
-std::array<float,2>{0.825172067f, 0.723697722f},
-std::array<float,2>{0.167425752f, 0.480157405f},
-std::array<float,2>{0.121151686f, 0.514341295f},
-std::array<float,2>{0.889935911f, 0.263776034f},
-std::array<float,2>{0.603863776f, 0.772631347f},
-std::array<float,2>{0.304417074f, 0.0275172424f},
-std::array<float,2>{0.338136673f, 0.592013478f},
-std::array<float,2>{0.552550018f, 0.354651034f},
-std::array<float,2>{0.937821984f, 0.872625649f},
-std::array<float,2>{0.0155577734f, 0.094157815f},
-std::array<float,2>{0.189009041f, 0.983578205f},
-std::array<float,2>{0.777329564f, 0.154595986f},
-std::array<float,2>{0.703535438f, 0.68442595f},
-std::array<float,2>{0.392175108f, 0.405021608f},
-std::array<float,2>{0.444734335f, 0.777129292f},
-std::array<float,2>{0.643438756f, 0.0191576537f},
-std::array<float,2>{0.847937644f, 0.503878713f},
-std::array<float,2>{0.148689359f, 0.251811653f},
-std::array<float,2>{0.0724361613f, 0.732926786f},
-std::array<float,2>{0.921343207f, 0.47384426f},
-std::array<float,2>{0.577365816f, 0.913479686f},
-std::array<float,2>{0.262928277f, 0.225051224f},
-std::array<float,2>{0.411894023f, 0.650232911f},
-std::array<float,2>{0.723641872f, 0.408835769f},
-std::array<float,2>{0.807320118f, 0.966688037f},
-std::array<float,2>{0.249410272f, 0.184741363f},
-std::array<float,2>{0.0501595624f, 0.817009389f},
-std::array<float,2>{0.98292619f, 0.0789820626f},
-std::array<float,2>{0.526238024f, 0.604300261f},
-std::array<float,2>{0.351817429f, 0.316959351f},
-std::array<float,2>{0.311982453f, 0.897100031f},
-std::array<float,2>{0.595835447f, 0.214970127f},
-std::array<float,2>{0.877505541f, 0.70440191f},
-std::array<float,2>{0.113452978f, 0.452993751f},
-std::array<float,2>{0.156892344f, 0.552048445f},
-std::array<float,2>{0.819721043f, 0.312046111f},
-std::array<float,2>{0.664586067f, 0.796934187f},
-std::array<float,2>{0.484478801f, 0.0477769114f},
-std::array<float,2>{0.477092117f, 0.51930058f},
-std::array<float,2>{0.675210238f, 0.276950628f},
-std::array<float,2>{0.831002235f, 0.763293624f},
-std::array<float,2>{0.186659738f, 0.00928026717f},
-std::array<float,2>{0.106760576f, 0.931649327f},
-std::array<float,2>{0.899091482f, 0.249242902f},
-std::array<float,2>{0.618917882f, 0.742477894f},
-std::array<float,2>{0.287742704f, 0.488573402f},
-std::array<float,2>{0.370447397f, 0.856834531f},
-std::array<float,2>{0.507494688f, 0.113888301f},
-std::array<float,2>{0.995721996f, 0.568650901f},
-std::array<float,2>{0.035831932f, 0.364840001f},
-std::array<float,2>{0.22918272f, 0.664553583f},
-std::array<float,2>{0.789037347f, 0.37669459f},
-std::array<float,2>{0.74364084f, 0.985191405f},
-std::array<float,2>{0.424814492f, 0.138391897f},
-std::array<float,2>{0.266535521f, 0.693280399f},
-std::array<float,2>{0.582843006f, 0.462906957f},
-std::array<float,2>{0.929959059f, 0.884319365f},
-std::array<float,2>{0.0812594816f, 0.201742023f},
-std::array<float,2>{0.130177319f, 0.794824719f},
-std::array<float,2>{0.86715883f, 0.0363382585f},
-std::array<float,2>{0.632233977f, 0.53454566f},
-std::array<float,2>{0.456939459f, 0.287304074f},
-std::array<float,2>{0.375426382f, 0.949033558f},
-std::array<float,2>{0.689176917f, 0.15700677f},
-std::array<float,2>{0.755470216f, 0.633113623f},
-std::array<float,2>{0.215064108f, 0.427708387f},
-std::array<float,2>{0.0210590549f, 0.619258106f},
-std::array<float,2>{0.96606493f, 0.32875365f},
-std::array<float,2>{0.532528698f, 0.837776542f},
-std::array<float,2>{0.32672134f, 0.063470982f},
-std::array<float,2>{0.27027151f, 0.58309269f},
-std::array<float,2>{0.581836343f, 0.344848871f},
-std::array<float,2>{0.935492158f, 0.864560246f},
-std::array<float,2>{0.0852499604f, 0.10415341f},
-std::array<float,2>{0.125148267f, 0.973149955f},
-std::array<float,2>{0.859578729f, 0.142258987f},
-std::array<float,2>{0.62745589f, 0.677393079f},
-std::array<float,2>{0.459739983f, 0.391887754f},
-std::array<float,2>{0.37924397f, 0.768014491f},
-std::array<float,2>{0.693626165f, 0.026972048f},
-std::array<float,2>{0.750817537f, 0.509217501f},
-std::array<float,2>{0.214801639f, 0.260497481f},
-std::array<float,2>{0.0182201583f, 0.719862819f},
-std::array<float,2>{0.962372303f, 0.481259197f},
-std::array<float,2>{0.53785938f, 0.921771944f},
-std::array<float,2>{0.321444362f, 0.228953063f},
-std::array<float,2>{0.483237177f, 0.641630769f},
-std::array<float,2>{0.676818132f, 0.4177894f},
-std::array<float,2>{0.835861146f, 0.95772928f},
-std::array<float,2>{0.179711044f, 0.17376709f},
-std::array<float,2>{0.105049439f, 0.823954999f},
-std::array<float,2>{0.902650416f, 0.0884028003f},
-std::array<float,2>{0.623202026f, 0.59579128f},
-std::array<float,2>{0.281430304f, 0.322464645f},
-std::array<float,2>{0.372458071f, 0.901202381f},
-std::array<float,2>{0.503035128f, 0.2046635f},
-std::array<float,2>{0.997211456f, 0.716103315f},
-std::array<float,2>{0.0314867832f, 0.442353666f},
-std::array<float,2>{0.233812451f, 0.556798339f},
-std::array<float,2>{0.781738698f, 0.299686879f},
-std::array<float,2>{0.748006403f, 0.812396288f},
-std::array<float,2>{0.427263141f, 0.0562929064f},
-std::array<float,2>{0.409482867f, 0.529539406f},
-std::array<float,2>{0.720520496f, 0.266085863f},
-std::array<float,2>{0.812434733f, 0.752470255f},
-std::array<float,2>{0.242661059f, 0.00766714849f},
-std::array<float,2>{0.0521245785f, 0.925293088f},
-std::array<float,2>{0.980068505f, 0.235577762f},
-std::array<float,2>{0.527436912f, 0.738161743f},
-std::array<float,2>{0.357060999f, 0.494960964f},
-std::array<float,2>{0.305412114f, 0.845527172f},
-std::array<float,2>{0.598959506f, 0.123453833f},
-std::array<float,2>{0.880701959f, 0.576180696f},
-std::array<float,2>{0.112187259f, 0.373492658f},
-std::array<float,2>{0.16094254f, 0.663613737f},
-std::array<float,2>{0.815829277f, 0.390333235f},
-std::array<float,2>{0.668230712f, 0.998449981f},
-std::array<float,2>{0.491997242f, 0.130201623f},
-std::array<float,2>{0.340781897f, 0.701279581f},
-std::array<float,2>{0.550755858f, 0.460934669f},
-std::array<float,2>{0.941748857f, 0.87876904f},
-std::array<float,2>{0.00933363754f, 0.188026696f},
-std::array<float,2>{0.194871709f, 0.784739017f},
-std::array<float,2>{0.779025495f, 0.0395403802f},
-std::array<float,2>{0.709570885f, 0.545093894f},
-std::array<float,2>{0.397113264f, 0.296092898f},
-std::array<float,2>{0.437997043f, 0.93988049f},
-std::array<float,2>{0.645700634f, 0.16540052f},
-std::array<float,2>{0.846455097f, 0.628453016f},
-std::array<float,2>{0.155842558f, 0.431386858f},
-std::array<float,2>{0.074897714f, 0.617125094f},
-std::array<float,2>{0.915961802f, 0.340943277f},
-std::array<float,2>{0.573915839f, 0.833387673f},
-std::array<float,2>{0.261124998f, 0.0779383034f},
-std::array<float,2>{0.347490907f, 0.535852075f},
-std::array<float,2>{0.520963311f, 0.284980893f},
-std::array<float,2>{0.973546267f, 0.79096365f},
-std::array<float,2>{0.0575800128f, 0.0339169465f},
-std::array<float,2>{0.239953399f, 0.887456596f},
-std::array<float,2>{0.801284313f, 0.196551889f},
-std::array<float,2>{0.728615105f, 0.688758314f},
-std::array<float,2>{0.420903414f, 0.467877805f},
-std::array<float,2>{0.493907899f, 0.842377305f},
-std::array<float,2>{0.663564146f, 0.068274051f},
-std::array<float,2>{0.822506547f, 0.622893333f},
-std::array<float,2>{0.171306044f, 0.333938032f},
-std::array<float,2>{0.117938481f, 0.639790833f},
-std::array<float,2>{0.884642482f, 0.421938837f},
-std::array<float,2>{0.608696699f, 0.952547371f},
-std::array<float,2>{0.300452083f, 0.162156716f},
-std::array<float,2>{0.401082009f, 0.74756968f},
-std::array<float,2>{0.717119813f, 0.487803966f},
-std::array<float,2>{0.772185206f, 0.937200427f},
-std::array<float,2>{0.200097784f, 0.243780136f},
-std::array<float,2>{0.00213966938f, 0.758848846f},
-std::array<float,2>{0.949993432f, 0.0154231712f},
-std::array<float,2>{0.561220825f, 0.521643698f},
-std::array<float,2>{0.329381883f, 0.278835744f},
-std::array<float,2>{0.25623557f, 0.990380883f},
-std::array<float,2>{0.569039881f, 0.135823816f},
-std::array<float,2>{0.912380099f, 0.668373525f},
-std::array<float,2>{0.0697690845f, 0.381779641f},
-std::array<float,2>{0.14169009f, 0.564657569f},
-std::array<float,2>{0.852820933f, 0.361540049f},
-std::array<float,2>{0.653557062f, 0.852162838f},
-std::array<float,2>{0.451491654f, 0.112054497f},
-std::array<float,2>{0.466372192f, 0.608810425f},
-std::array<float,2>{0.635902345f, 0.31620568f},
-std::array<float,2>{0.871272922f, 0.812797606f},
-std::array<float,2>{0.136973247f, 0.0842060074f},
-std::array<float,2>{0.0928291827f, 0.96472764f},
-std::array<float,2>{0.92336297f, 0.181651697f},
-std::array<float,2>{0.588901579f, 0.655026913f},
-std::array<float,2>{0.277480185f, 0.411824822f},
-std::array<float,2>{0.316873163f, 0.803950846f},
-std::array<float,2>{0.544547141f, 0.053337913f},
-std::array<float,2>{0.95638001f, 0.547326505f},
-std::array<float,2>{0.028392002f, 0.305091619f},
-std::array<float,2>{0.204449564f, 0.709663033f},
-std::array<float,2>{0.764768541f, 0.445707142f},
-std::array<float,2>{0.702456951f, 0.890953362f},
-std::array<float,2>{0.38925916f, 0.21237734f},
-std::array<float,2>{0.289619923f, 0.681656539f},
-std::array<float,2>{0.609712243f, 0.399355382f},
-std::array<float,2>{0.896582603f, 0.97916317f},
-std::array<float,2>{0.0974843353f, 0.150682405f},
-std::array<float,2>{0.174376458f, 0.867836297f},
-std::array<float,2>{0.839652359f, 0.0983146429f},
-std::array<float,2>{0.68529439f, 0.586375237f},
-std::array<float,2>{0.473744929f, 0.356003374f},
-std::array<float,2>{0.437017858f, 0.906264663f},
-std::array<float,2>{0.735486627f, 0.219191685f},
-std::array<float,2>{0.789511979f, 0.729675055f},
-std::array<float,2>{0.224476337f, 0.471121132f},
-std::array<float,2>{0.0446697809f, 0.505396664f},
-std::array<float,2>{0.984632671f, 0.256691158f},
-std::array<float,2>{0.515086472f, 0.777833223f},
-std::array<float,2>{0.365341932f, 0.0210492741f},
-std::array<float,2>{0.303583145f, 0.513385713f},
-std::array<float,2>{0.605099142f, 0.261814654f},
-std::array<float,2>{0.888855577f, 0.771403611f},
-std::array<float,2>{0.122592978f, 0.0305460822f},
-std::array<float,2>{0.166446626f, 0.916209757f},
-std::array<float,2>{0.826090991f, 0.232860923f},
-std::array<float,2>{0.656515539f, 0.726059675f},
-std::array<float,2>{0.499914736f, 0.477610141f},
-std::array<float,2>{0.416633427f, 0.862291932f},
-std::array<float,2>{0.730706871f, 0.107852325f},
-std::array<float,2>{0.799432099f, 0.581604838f},
-std::array<float,2>{0.234859064f, 0.348180324f},
-std::array<float,2>{0.0604971983f, 0.672261834f},
-std::array<float,2>{0.971851707f, 0.397753894f},
-std::array<float,2>{0.518949986f, 0.969680071f},
-std::array<float,2>{0.348916531f, 0.145474583f},
-std::array<float,2>{0.445733637f, 0.712518096f},
-std::array<float,2>{0.650244236f, 0.439911723f},
-std::array<float,2>{0.855993927f, 0.905065536f},
-std::array<float,2>{0.147775605f, 0.207714066f},
-std::array<float,2>{0.065185912f, 0.807225764f},
-std::array<float,2>{0.907352686f, 0.0621353649f},
-std::array<float,2>{0.563987494f, 0.560145974f},
-std::array<float,2>{0.253410906f, 0.304252028f},
-std::array<float,2>{0.334786654f, 0.95447737f},
-std::array<float,2>{0.556138754f, 0.177544668f},
-std::array<float,2>{0.948847234f, 0.646653414f},
-std::array<float,2>{0.00567222992f, 0.421558857f},
-std::array<float,2>{0.198072374f, 0.600551903f},
-std::array<float,2>{0.767445087f, 0.326113433f},
-std::array<float,2>{0.713475347f, 0.826016903f},
-std::array<float,2>{0.402418733f, 0.0932378322f},
-std::array<float,2>{0.38474372f, 0.572348297f},
-std::array<float,2>{0.698987663f, 0.369600922f},
-std::array<float,2>{0.760952115f, 0.849569261f},
-std::array<float,2>{0.210866272f, 0.118790515f},
-std::array<float,2>{0.0262122843f, 0.995113611f},
-std::array<float,2>{0.960846186f, 0.126748294f},
-std::array<float,2>{0.539287746f, 0.657033622f},
-std::array<float,2>{0.314918339f, 0.386287093f},
-std::array<float,2>{0.275998235f, 0.757016718f},
-std::array<float,2>{0.590238035f, 0.000323007436f},
-std::array<float,2>{0.927805603f, 0.526751757f},
-std::array<float,2>{0.0879027843f, 0.273188651f},
-std::array<float,2>{0.136361524f, 0.739573061f},
-std::array<float,2>{0.869605839f, 0.497119278f},
-std::array<float,2>{0.637594998f, 0.927820861f},
-std::array<float,2>{0.463019043f, 0.24087961f},
-std::array<float,2>{0.359856486f, 0.629353762f},
-std::array<float,2>{0.509290576f, 0.434548438f},
-std::array<float,2>{0.989796281f, 0.943987489f},
-std::array<float,2>{0.0425655246f, 0.17039068f},
-std::array<float,2>{0.219717965f, 0.830331743f},
-std::array<float,2>{0.796775281f, 0.0714616403f},
-std::array<float,2>{0.741789401f, 0.611270845f},
-std::array<float,2>{0.431589901f, 0.337918282f},
-std::array<float,2>{0.470748127f, 0.879395604f},
-std::array<float,2>{0.682671845f, 0.193074957f},
-std::array<float,2>{0.840972364f, 0.697975338f},
-std::array<float,2>{0.177954659f, 0.455633163f},
-std::array<float,2>{0.0993921906f, 0.539090216f},
-std::array<float,2>{0.891083896f, 0.292623967f},
-std::array<float,2>{0.613703549f, 0.786747277f},
-std::array<float,2>{0.296287239f, 0.0454205312f},
-std::array<float,2>{0.328119338f, 0.617997944f},
-std::array<float,2>{0.531608343f, 0.33077246f},
-std::array<float,2>{0.965226889f, 0.838700652f},
-std::array<float,2>{0.0204557907f, 0.0661371276f},
-std::array<float,2>{0.215997145f, 0.947230339f},
-std::array<float,2>{0.754687548f, 0.158618122f},
-std::array<float,2>{0.687627077f, 0.636231542f},
-std::array<float,2>{0.37660712f, 0.428354353f},
-std::array<float,2>{0.456013203f, 0.79530865f},
-std::array<float,2>{0.631722093f, 0.0387190357f},
-std::array<float,2>{0.865515769f, 0.531978786f},
-std::array<float,2>{0.129236892f, 0.286345363f},
-std::array<float,2>{0.0802943334f, 0.694215655f},
-std::array<float,2>{0.931060493f, 0.462629288f},
-std::array<float,2>{0.583445668f, 0.884810507f},
-std::array<float,2>{0.267230868f, 0.200949937f},
-std::array<float,2>{0.424340755f, 0.666627526f},
-std::array<float,2>{0.742605567f, 0.378217787f},
-std::array<float,2>{0.787816525f, 0.986901045f},
-std::array<float,2>{0.230411813f, 0.139080599f},
-std::array<float,2>{0.0370379724f, 0.858511329f},
-std::array<float,2>{0.99429816f, 0.115766034f},
-std::array<float,2>{0.506266713f, 0.567018747f},
-std::array<float,2>{0.369925678f, 0.366070867f},
-std::array<float,2>{0.288778961f, 0.931330264f},
-std::array<float,2>{0.618050694f, 0.247627571f},
-std::array<float,2>{0.900224388f, 0.745752394f},
-std::array<float,2>{0.105681218f, 0.491963148f},
-std::array<float,2>{0.185971618f, 0.516730547f},
-std::array<float,2>{0.831455708f, 0.274071038f},
-std::array<float,2>{0.674472392f, 0.765403032f},
-std::array<float,2>{0.478114307f, 0.011525657f},
-std::array<float,2>{0.486267805f, 0.553070009f},
-std::array<float,2>{0.665685117f, 0.309848398f},
-std::array<float,2>{0.818931341f, 0.800760508f},
-std::array<float,2>{0.157423496f, 0.0490597188f},
-std::array<float,2>{0.114460558f, 0.895385087f},
-std::array<float,2>{0.878473878f, 0.218660936f},
-std::array<float,2>{0.597387552f, 0.705340087f},
-std::array<float,2>{0.311324865f, 0.449615508f},
-std::array<float,2>{0.35280633f, 0.820096314f},
-std::array<float,2>{0.527027845f, 0.0814731419f},
-std::array<float,2>{0.984185934f, 0.601619899f},
-std::array<float,2>{0.0493490435f, 0.320043623f},
-std::array<float,2>{0.248371542f, 0.652115703f},
-std::array<float,2>{0.808131278f, 0.408160567f},
-std::array<float,2>{0.72355175f, 0.96772182f},
-std::array<float,2>{0.410949737f, 0.187329546f},
-std::array<float,2>{0.262444317f, 0.730642974f},
-std::array<float,2>{0.576491833f, 0.476023823f},
-std::array<float,2>{0.920750678f, 0.911373556f},
-std::array<float,2>{0.0738476962f, 0.223686203f},
-std::array<float,2>{0.149765566f, 0.774694324f},
-std::array<float,2>{0.848776042f, 0.0172553044f},
-std::array<float,2>{0.644360662f, 0.500461102f},
-std::array<float,2>{0.443415552f, 0.252882332f},
-std::array<float,2>{0.391074479f, 0.982272267f},
-std::array<float,2>{0.704786241f, 0.153543323f},
-std::array<float,2>{0.77581811f, 0.686028421f},
-std::array<float,2>{0.188232675f, 0.404276907f},
-std::array<float,2>{0.0141085964f, 0.59001261f},
-std::array<float,2>{0.939164281f, 0.352356702f},
-std::array<float,2>{0.551651716f, 0.873345852f},
-std::array<float,2>{0.339283496f, 0.0964255407f},
-std::array<float,2>{0.283924937f, 0.594788015f},
-std::array<float,2>{0.621236742f, 0.322067648f},
-std::array<float,2>{0.904921949f, 0.82105124f},
-std::array<float,2>{0.101791009f, 0.086716488f},
-std::array<float,2>{0.183255717f, 0.959267616f},
-std::array<float,2>{0.832909465f, 0.175558254f},
-std::array<float,2>{0.678969681f, 0.644096136f},
-std::array<float,2>{0.482228786f, 0.415109575f},
-std::array<float,2>{0.428171247f, 0.80963695f},
-std::array<float,2>{0.748115361f, 0.058110822f},
-std::array<float,2>{0.783256829f, 0.556208491f},
-std::array<float,2>{0.231012315f, 0.297856331f},
-std::array<float,2>{0.0346089974f, 0.717785954f},
-std::array<float,2>{0.998921573f, 0.444932818f},
-std::array<float,2>{0.500244021f, 0.899001896f},
-std::array<float,2>{0.374416202f, 0.205599338f},
-std::array<float,2>{0.457733333f, 0.678044736f},
-std::array<float,2>{0.626397371f, 0.392696083f},
-std::array<float,2>{0.862902343f, 0.976354599f},
-std::array<float,2>{0.127347648f, 0.144383594f},
-std::array<float,2>{0.0821309164f, 0.866033792f},
-std::array<float,2>{0.936566412f, 0.103220157f},
-std::array<float,2>{0.579187453f, 0.584953785f},
-std::array<float,2>{0.27201274f, 0.346970797f},
-std::array<float,2>{0.322311759f, 0.919258058f},
-std::array<float,2>{0.53687489f, 0.22812593f},
-std::array<float,2>{0.964112461f, 0.7220245f},
-std::array<float,2>{0.0164128859f, 0.483926117f},
-std::array<float,2>{0.211762398f, 0.509885192f},
-std::array<float,2>{0.753051758f, 0.25870049f},
-std::array<float,2>{0.693185806f, 0.76573199f},
-std::array<float,2>{0.380872577f, 0.0249771681f},
-std::array<float,2>{0.394828051f, 0.544663727f},
-std::array<float,2>{0.707494438f, 0.293131471f},
-std::array<float,2>{0.780156314f, 0.782058835f},
-std::array<float,2>{0.193046615f, 0.0416122228f},
-std::array<float,2>{0.0116882017f, 0.87592864f},
-std::array<float,2>{0.944661438f, 0.190217078f},
-std::array<float,2>{0.548226118f, 0.699903071f},
-std::array<float,2>{0.342324525f, 0.458278626f},
-std::array<float,2>{0.258296043f, 0.835160494f},
-std::array<float,2>{0.571222663f, 0.0754894689f},
-std::array<float,2>{0.917095661f, 0.614833891f},
-std::array<float,2>{0.0778544471f, 0.343028218f},
-std::array<float,2>{0.154000506f, 0.625388741f},
-std::array<float,2>{0.845669329f, 0.432815164f},
-std::array<float,2>{0.647028148f, 0.937743902f},
-std::array<float,2>{0.440378338f, 0.166802779f},
-std::array<float,2>{0.359166145f, 0.734485388f},
-std::array<float,2>{0.530405819f, 0.492466241f},
-std::array<float,2>{0.977603436f, 0.923513234f},
-std::array<float,2>{0.0529176034f, 0.237103149f},
-std::array<float,2>{0.244659364f, 0.751452923f},
-std::array<float,2>{0.809398949f, 0.00450708251f},
-std::array<float,2>{0.721202075f, 0.528921723f},
-std::array<float,2>{0.408060282f, 0.269157797f},
-std::array<float,2>{0.489328682f, 0.996826708f},
-std::array<float,2>{0.67001754f, 0.131016597f},
-std::array<float,2>{0.813041031f, 0.661515117f},
-std::array<float,2>{0.163657784f, 0.386837035f},
-std::array<float,2>{0.110535286f, 0.5759601f},
-std::array<float,2>{0.881987035f, 0.37270236f},
-std::array<float,2>{0.601078808f, 0.846793294f},
-std::array<float,2>{0.308299035f, 0.12172956f},
-std::array<float,2>{0.33086136f, 0.520992577f},
-std::array<float,2>{0.5601421f, 0.280825406f},
-std::array<float,2>{0.951327562f, 0.76151216f},
-std::array<float,2>{0.00020720149f, 0.0126783177f},
-std::array<float,2>{0.201808959f, 0.934528589f},
-std::array<float,2>{0.770216107f, 0.245559141f},
-std::array<float,2>{0.716578424f, 0.749555707f},
-std::array<float,2>{0.398979485f, 0.485541701f},
-std::array<float,2>{0.450199544f, 0.85499984f},
-std::array<float,2>{0.655614913f, 0.110403404f},
-std::array<float,2>{0.853888392f, 0.564330161f},
-std::array<float,2>{0.144346207f, 0.359859258f},
-std::array<float,2>{0.0669437051f, 0.671251416f},
-std::array<float,2>{0.911346734f, 0.379371107f},
-std::array<float,2>{0.568285167f, 0.990008175f},
-std::array<float,2>{0.255551875f, 0.133382976f},
-std::array<float,2>{0.419557989f, 0.689590454f},
-std::array<float,2>{0.728487074f, 0.465764701f},
-std::array<float,2>{0.80290097f, 0.890002489f},
-std::array<float,2>{0.240505263f, 0.198189422f},
-std::array<float,2>{0.0555638708f, 0.792502105f},
-std::array<float,2>{0.975130796f, 0.0326577313f},
-std::array<float,2>{0.522176027f, 0.538535357f},
-std::array<float,2>{0.344032884f, 0.281442463f},
-std::array<float,2>{0.298240095f, 0.949734867f},
-std::array<float,2>{0.607225001f, 0.160591781f},
-std::array<float,2>{0.886508465f, 0.63753897f},
-std::array<float,2>{0.119624235f, 0.425206065f},
-std::array<float,2>{0.16942808f, 0.62476325f},
-std::array<float,2>{0.821243644f, 0.335146964f},
-std::array<float,2>{0.661439002f, 0.841102064f},
-std::array<float,2>{0.496089876f, 0.0686471909f},
-std::array<float,2>{0.475003958f, 0.588084936f},
-std::array<float,2>{0.685689867f, 0.358261287f},
-std::array<float,2>{0.837296247f, 0.870305955f},
-std::array<float,2>{0.172574654f, 0.10020531f},
-std::array<float,2>{0.0951232985f, 0.977861643f},
-std::array<float,2>{0.896040618f, 0.149317533f},
-std::array<float,2>{0.612262607f, 0.680736482f},
-std::array<float,2>{0.292509824f, 0.400514454f},
-std::array<float,2>{0.363887787f, 0.780481458f},
-std::array<float,2>{0.511857092f, 0.022498969f},
-std::array<float,2>{0.986514568f, 0.506085396f},
-std::array<float,2>{0.0465313159f, 0.254146904f},
-std::array<float,2>{0.225103304f, 0.728488147f},
-std::array<float,2>{0.792068541f, 0.469779402f},
-std::array<float,2>{0.737012684f, 0.910045683f},
-std::array<float,2>{0.434431314f, 0.220720768f},
-std::array<float,2>{0.281218588f, 0.653099418f},
-std::array<float,2>{0.586249232f, 0.412807792f},
-std::array<float,2>{0.925353646f, 0.96217525f},
-std::array<float,2>{0.0901034027f, 0.181478202f},
-std::array<float,2>{0.139799789f, 0.815214396f},
-std::array<float,2>{0.873925686f, 0.0828692317f},
-std::array<float,2>{0.634169757f, 0.607071519f},
-std::array<float,2>{0.466834426f, 0.312900424f},
-std::array<float,2>{0.388608605f, 0.894331872f},
-std::array<float,2>{0.700246453f, 0.213362366f},
-std::array<float,2>{0.762072146f, 0.707362235f},
-std::array<float,2>{0.205512241f, 0.447512001f},
-std::array<float,2>{0.0303326398f, 0.549957395f},
-std::array<float,2>{0.954053044f, 0.308520883f},
-std::array<float,2>{0.546693027f, 0.801503599f},
-std::array<float,2>{0.319600999f, 0.0512057394f},
-std::array<float,2>{0.251368493f, 0.561943114f},
-std::array<float,2>{0.564752519f, 0.302362114f},
-std::array<float,2>{0.908906758f, 0.804695189f},
-std::array<float,2>{0.0639209673f, 0.0600761063f},
-std::array<float,2>{0.146323308f, 0.902372241f},
-std::array<float,2>{0.858728647f, 0.210177481f},
-std::array<float,2>{0.650562525f, 0.714153588f},
-std::array<float,2>{0.447385967f, 0.437556952f},
-std::array<float,2>{0.405104756f, 0.827069223f},
-std::array<float,2>{0.712429583f, 0.0910324082f},
-std::array<float,2>{0.768078148f, 0.59907043f},
-std::array<float,2>{0.196669638f, 0.328043252f},
-std::array<float,2>{0.00746961357f, 0.645009577f},
-std::array<float,2>{0.946852267f, 0.418348312f},
-std::array<float,2>{0.557783008f, 0.956833601f},
-std::array<float,2>{0.333301663f, 0.178201571f},
-std::array<float,2>{0.49611342f, 0.723410428f},
-std::array<float,2>{0.658540308f, 0.478582084f},
-std::array<float,2>{0.827322423f, 0.914512515f},
-std::array<float,2>{0.164980099f, 0.232297957f},
-std::array<float,2>{0.124926977f, 0.772336781f},
-std::array<float,2>{0.886860371f, 0.0291020256f},
-std::array<float,2>{0.602931917f, 0.515174747f},
-std::array<float,2>{0.301603526f, 0.265111327f},
-std::array<float,2>{0.350693136f, 0.970974743f},
-std::array<float,2>{0.516616583f, 0.148304909f},
-std::array<float,2>{0.969853282f, 0.675428629f},
-std::array<float,2>{0.0612820163f, 0.396151632f},
-std::array<float,2>{0.237501696f, 0.578259766f},
-std::array<float,2>{0.797151625f, 0.350392699f},
-std::array<float,2>{0.733749807f, 0.860635936f},
-std::array<float,2>{0.414788127f, 0.106363438f},
-std::array<float,2>{0.432798445f, 0.613090098f},
-std::array<float,2>{0.739662111f, 0.337581903f},
-std::array<float,2>{0.793889999f, 0.829709768f},
-std::array<float,2>{0.221470043f, 0.0733837485f},
-std::array<float,2>{0.0392887704f, 0.943240583f},
-std::array<float,2>{0.992098212f, 0.168531045f},
-std::array<float,2>{0.510082304f, 0.631980598f},
-std::array<float,2>{0.362832874f, 0.436469406f},
-std::array<float,2>{0.294557512f, 0.787208557f},
-std::array<float,2>{0.616133153f, 0.0448500998f},
-std::array<float,2>{0.892694771f, 0.542057633f},
-std::array<float,2>{0.100125305f, 0.290971518f},
-std::array<float,2>{0.176630571f, 0.696951926f},
-std::array<float,2>{0.843184292f, 0.454465926f},
-std::array<float,2>{0.680841506f, 0.881298244f},
-std::array<float,2>{0.470134497f, 0.195075333f},
-std::array<float,2>{0.313571215f, 0.658709526f},
-std::array<float,2>{0.542033911f, 0.383975148f},
-std::array<float,2>{0.958780587f, 0.992849529f},
-std::array<float,2>{0.0243002512f, 0.127998203f},
-std::array<float,2>{0.208649009f, 0.850668788f},
-std::array<float,2>{0.758751512f, 0.11948783f},
-std::array<float,2>{0.69680655f, 0.57194519f},
-std::array<float,2>{0.385534972f, 0.368013144f},
-std::array<float,2>{0.462567031f, 0.926745713f},
-std::array<float,2>{0.639919579f, 0.239305243f},
-std::array<float,2>{0.868597567f, 0.741413057f},
-std::array<float,2>{0.134562075f, 0.499210477f},
-std::array<float,2>{0.0870675221f, 0.523751259f},
-std::array<float,2>{0.927461565f, 0.270762831f},
-std::array<float,2>{0.592421353f, 0.755208194f},
-std::array<float,2>{0.274356872f, 0.00195340742f},
-std::array<float,2>{0.368467361f, 0.569363773f},
-std::array<float,2>{0.504927337f, 0.363285184f},
-std::array<float,2>{0.99285078f, 0.85615617f},
-std::array<float,2>{0.0383976288f, 0.114417076f},
-std::array<float,2>{0.22757335f, 0.986243486f},
-std::array<float,2>{0.78529501f, 0.137482002f},
-std::array<float,2>{0.745512486f, 0.665656686f},
-std::array<float,2>{0.422443449f, 0.375154227f},
-std::array<float,2>{0.479705721f, 0.761980295f},
-std::array<float,2>{0.673625588f, 0.0081269322f},
-std::array<float,2>{0.828881145f, 0.518072486f},
-std::array<float,2>{0.185291901f, 0.275488734f},
-std::array<float,2>{0.109345123f, 0.743771613f},
-std::array<float,2>{0.901666343f, 0.489571661f},
-std::array<float,2>{0.619341195f, 0.93316859f},
-std::array<float,2>{0.285791576f, 0.248971984f},
-std::array<float,2>{0.378776371f, 0.634051263f},
-std::array<float,2>{0.689569652f, 0.425996721f},
-std::array<float,2>{0.756834626f, 0.947286665f},
-std::array<float,2>{0.218568578f, 0.157793194f},
-std::array<float,2>{0.0232088882f, 0.836256564f},
-std::array<float,2>{0.967031479f, 0.0636750609f},
-std::array<float,2>{0.533908665f, 0.620233059f},
-std::array<float,2>{0.324922681f, 0.330023348f},
-std::array<float,2>{0.26939097f, 0.883505583f},
-std::array<float,2>{0.584853828f, 0.202626929f},
-std::array<float,2>{0.93206352f, 0.691452086f},
-std::array<float,2>{0.0787677243f, 0.464724869f},
-std::array<float,2>{0.131439239f, 0.534173667f},
-std::array<float,2>{0.863810003f, 0.28898555f},
-std::array<float,2>{0.630178511f, 0.793133855f},
-std::array<float,2>{0.454256743f, 0.0352724828f},
-std::array<float,2>{0.44181782f, 0.502731681f},
-std::array<float,2>{0.64140743f, 0.250804871f},
-std::array<float,2>{0.850357115f, 0.775740981f},
-std::array<float,2>{0.151186347f, 0.0178522244f},
-std::array<float,2>{0.0721150786f, 0.912272751f},
-std::array<float,2>{0.919523478f, 0.226170287f},
-std::array<float,2>{0.575638235f, 0.734266758f},
-std::array<float,2>{0.265032321f, 0.473235428f},
-std::array<float,2>{0.337805897f, 0.871577382f},
-std::array<float,2>{0.55318445f, 0.0952521488f},
-std::array<float,2>{0.939502776f, 0.592975318f},
-std::array<float,2>{0.0136007667f, 0.354468465f},
-std::array<float,2>{0.190060571f, 0.685234845f},
-std::array<float,2>{0.774592757f, 0.405657351f},
-std::array<float,2>{0.706632197f, 0.983365119f},
-std::array<float,2>{0.392984539f, 0.155694708f},
-std::array<float,2>{0.310171127f, 0.703889847f},
-std::array<float,2>{0.594175041f, 0.451489002f},
-std::array<float,2>{0.876934469f, 0.89782691f},
-std::array<float,2>{0.115852654f, 0.216017485f},
-std::array<float,2>{0.158285275f, 0.79814595f},
-std::array<float,2>{0.817818046f, 0.0479671843f},
-std::array<float,2>{0.666143715f, 0.551069975f},
-std::array<float,2>{0.487575799f, 0.311490625f},
-std::array<float,2>{0.413863301f, 0.965762734f},
-std::array<float,2>{0.725293458f, 0.183705539f},
-std::array<float,2>{0.804955423f, 0.648683667f},
-std::array<float,2>{0.247828782f, 0.409183592f},
-std::array<float,2>{0.0470003821f, 0.604537845f},
-std::array<float,2>{0.981703162f, 0.317679822f},
-std::array<float,2>{0.525156319f, 0.81794703f},
-std::array<float,2>{0.353516966f, 0.0799116865f}}
\ No newline at end of file
@@ -1,4096 +0,0 @@
-{std::array<float,2>{0.926304042f, 0.395990968f},
-std::array<float,2>{0.163703963f, 0.804519713f},
-std::array<float,2>{0.676899135f, 0.550575852f},
-std::array<float,2>{0.349785239f, 0.0332898721f},
-std::array<float,2>{0.618780196f, 0.144179523f},
-std::array<float,2>{0.377917528f, 0.67375356f},
-std::array<float,2>{0.810037673f, 0.941437185f},
-std::array<float,2>{0.0360686332f, 0.352492064f},
-std::array<float,2>{0.711843908f, 0.269520879f},
-std::array<float,2>{0.256066889f, 0.879686773f},
-std::array<float,2>{0.995066643f, 0.734348118f},
-std::array<float,2>{0.191029191f, 0.206893668f},
-std::array<float,2>{0.82540226f, 0.107006252f},
-std::array<float,2>{0.122134127f, 0.569503665f},
-std::array<float,2>{0.561286092f, 0.852546155f},
-std::array<float,2>{0.465631932f, 0.484972f},
-std::array<float,2>{0.771852493f, 0.331360966f},
-std::array<float,2>{0.0224799961f, 0.972397447f},
-std::array<float,2>{0.573495448f, 0.638321102f},
-std::array<float,2>{0.437416315f, 0.165047526f},
-std::array<float,2>{0.646888316f, 0.00328774704f},
-std::array<float,2>{0.327462882f, 0.504937172f},
-std::array<float,2>{0.893180549f, 0.758252025f},
-std::array<float,2>{0.131673425f, 0.424546599f},
-std::array<float,2>{0.529675603f, 0.445282042f},
-std::array<float,2>{0.47022745f, 0.830938816f},
-std::array<float,2>{0.8659181f, 0.610444129f},
-std::array<float,2>{0.0764506459f, 0.086886026f},
-std::array<float,2>{0.955832124f, 0.229469672f},
-std::array<float,2>{0.247128159f, 0.715452731f},
-std::array<float,2>{0.744725943f, 0.913016081f},
-std::array<float,2>{0.295440912f, 0.291986227f},
-std::array<float,2>{0.976740062f, 0.299265474f},
-std::array<float,2>{0.210621864f, 0.931248009f},
-std::array<float,2>{0.688154578f, 0.691935658f},
-std::array<float,2>{0.277160555f, 0.2448145f},
-std::array<float,2>{0.535250902f, 0.0634521395f},
-std::array<float,2>{0.439915597f, 0.603669941f},
-std::array<float,2>{0.833266914f, 0.818204224f},
-std::array<float,2>{0.102486759f, 0.455292046f},
-std::array<float,2>{0.666403055f, 0.42143026f},
-std::array<float,2>{0.369985044f, 0.775035083f},
-std::array<float,2>{0.915892839f, 0.529277027f},
-std::array<float,2>{0.178432956f, 0.0188585296f},
-std::array<float,2>{0.793987334f, 0.182458431f},
-std::array<float,2>{0.0579163954f, 0.646005452f},
-std::array<float,2>{0.60583204f, 0.99539578f},
-std::array<float,2>{0.39959079f, 0.32583037f},
-std::array<float,2>{0.848867595f, 0.471857905f},
-std::array<float,2>{0.0927632973f, 0.864864051f},
-std::array<float,2>{0.505140066f, 0.579377592f},
-std::array<float,2>{0.488219619f, 0.12459188f},
-std::array<float,2>{0.73150456f, 0.188651085f},
-std::array<float,2>{0.305850893f, 0.749292254f},
-std::array<float,2>{0.938770413f, 0.9024418f},
-std::array<float,2>{0.229139164f, 0.254606038f},
-std::array<float,2>{0.592145085f, 0.364847809f},
-std::array<float,2>{0.412515104f, 0.966460288f},
-std::array<float,2>{0.765593767f, 0.669788539f},
-std::array<float,2>{0.00432829838f, 0.133468553f},
-std::array<float,2>{0.888205171f, 0.0599132702f},
-std::array<float,2>{0.147480085f, 0.543068767f},
-std::array<float,2>{0.631885588f, 0.795228422f},
-std::array<float,2>{0.32859993f, 0.378965676f},
-std::array<float,2>{0.950178385f, 0.468062103f},
-std::array<float,2>{0.224348426f, 0.823597729f},
-std::array<float,2>{0.726269901f, 0.596901655f},
-std::array<float,2>{0.302045166f, 0.0778790116f},
-std::array<float,2>{0.512945712f, 0.241345137f},
-std::array<float,2>{0.498829514f, 0.696783423f},
-std::array<float,2>{0.856164336f, 0.928803742f},
-std::array<float,2>{0.0846359208f, 0.312352002f},
-std::array<float,2>{0.635648727f, 0.314689934f},
-std::array<float,2>{0.336122632f, 0.991665065f},
-std::array<float,2>{0.876061201f, 0.649247825f},
-std::array<float,2>{0.149259061f, 0.17261979f},
-std::array<float,2>{0.754537165f, 0.0257246289f},
-std::array<float,2>{0.014821548f, 0.516155541f},
-std::array<float,2>{0.583437562f, 0.772670925f},
-std::array<float,2>{0.415785193f, 0.412977606f},
-std::array<float,2>{0.841093779f, 0.263681442f},
-std::array<float,2>{0.0995090231f, 0.896764278f},
-std::array<float,2>{0.539714217f, 0.736128032f},
-std::array<float,2>{0.448386669f, 0.202507213f},
-std::array<float,2>{0.701287806f, 0.113449104f},
-std::array<float,2>{0.266807348f, 0.593469262f},
-std::array<float,2>{0.970617056f, 0.869741917f},
-std::array<float,2>{0.212923914f, 0.483361572f},
-std::array<float,2>{0.600621581f, 0.385170013f},
-std::array<float,2>{0.397143185f, 0.788604558f},
-std::array<float,2>{0.786631584f, 0.537701905f},
-std::array<float,2>{0.0468855277f, 0.0492701866f},
-std::array<float,2>{0.907293439f, 0.125466406f},
-std::array<float,2>{0.186136201f, 0.659463227f},
-std::array<float,2>{0.660072744f, 0.960161269f},
-std::array<float,2>{0.365408212f, 0.372397691f},
-std::array<float,2>{0.906021833f, 0.343978643f},
-std::array<float,2>{0.134566769f, 0.952305138f},
-std::array<float,2>{0.653655469f, 0.685621858f},
-std::array<float,2>{0.315253437f, 0.14934893f},
-std::array<float,2>{0.564035833f, 0.0430151932f},
-std::array<float,2>{0.427182883f, 0.556415677f},
-std::array<float,2>{0.777925968f, 0.806811869f},
-std::array<float,2>{0.0258065425f, 0.401301235f},
-std::array<float,2>{0.739439011f, 0.498411477f},
-std::array<float,2>{0.282296926f, 0.848554969f},
-std::array<float,2>{0.967794836f, 0.577567339f},
-std::array<float,2>{0.241149262f, 0.0942069516f},
-std::array<float,2>{0.868133605f, 0.218348101f},
-std::array<float,2>{0.0648495406f, 0.722473979f},
-std::array<float,2>{0.516759157f, 0.889861703f},
-std::array<float,2>{0.480097264f, 0.280491769f},
-std::array<float,2>{0.798618734f, 0.437107354f},
-std::array<float,2>{0.0439118855f, 0.753842652f},
-std::array<float,2>{0.611963391f, 0.509327233f},
-std::array<float,2>{0.386216074f, 0.0120407809f},
-std::array<float,2>{0.681231499f, 0.161317244f},
-std::array<float,2>{0.358629405f, 0.625921726f},
-std::array<float,2>{0.936145484f, 0.983145297f},
-std::array<float,2>{0.169771686f, 0.340956122f},
-std::array<float,2>{0.549311876f, 0.283021033f},
-std::array<float,2>{0.45810762f, 0.914620399f},
-std::array<float,2>{0.813294828f, 0.708316982f},
-std::array<float,2>{0.111367598f, 0.221805423f},
-std::array<float,2>{0.990123391f, 0.0831248909f},
-std::array<float,2>{0.196039781f, 0.623260021f},
-std::array<float,2>{0.704047382f, 0.837329388f},
-std::array<float,2>{0.259309828f, 0.4453924f},
-std::array<float,2>{0.998229325f, 0.408560902f},
-std::array<float,2>{0.192033902f, 0.769291639f},
-std::array<float,2>{0.715465426f, 0.520424426f},
-std::array<float,2>{0.251017809f, 0.0289340708f},
-std::array<float,2>{0.55521512f, 0.175887942f},
-std::array<float,2>{0.463447243f, 0.652703941f},
-std::array<float,2>{0.822034836f, 0.985091209f},
-std::array<float,2>{0.120537452f, 0.319256455f},
-std::array<float,2>{0.675111234f, 0.305897117f},
-std::array<float,2>{0.346192777f, 0.925294399f},
-std::array<float,2>{0.923957229f, 0.702175915f},
-std::array<float,2>{0.157701671f, 0.237391263f},
-std::array<float,2>{0.807650745f, 0.071064271f},
-std::array<float,2>{0.0333265103f, 0.597977877f},
-std::array<float,2>{0.623575807f, 0.826371551f},
-std::array<float,2>{0.379731536f, 0.463804811f},
-std::array<float,2>{0.860473514f, 0.36835894f},
-std::array<float,2>{0.0721053258f, 0.953258336f},
-std::array<float,2>{0.526876569f, 0.66196394f},
-std::array<float,2>{0.473041922f, 0.129105881f},
-std::array<float,2>{0.749123156f, 0.0512185246f},
-std::array<float,2>{0.292238832f, 0.533267915f},
-std::array<float,2>{0.959815025f, 0.782283306f},
-std::array<float,2>{0.245415971f, 0.389656961f},
-std::array<float,2>{0.574509442f, 0.480334163f},
-std::array<float,2>{0.429889262f, 0.873056889f},
-std::array<float,2>{0.769513488f, 0.589457631f},
-std::array<float,2>{0.0188295823f, 0.11259754f},
-std::array<float,2>{0.896399736f, 0.198440254f},
-std::array<float,2>{0.126477391f, 0.739864409f},
-std::array<float,2>{0.64438051f, 0.894146144f},
-std::array<float,2>{0.321977913f, 0.259808093f},
-std::array<float,2>{0.919445217f, 0.275158674f},
-std::array<float,2>{0.175281286f, 0.8848418f},
-std::array<float,2>{0.669641733f, 0.723086596f},
-std::array<float,2>{0.372947603f, 0.213081926f},
-std::array<float,2>{0.601997554f, 0.100177974f},
-std::array<float,2>{0.406129479f, 0.572851837f},
-std::array<float,2>{0.791273892f, 0.847007573f},
-std::array<float,2>{0.0624999665f, 0.494636834f},
-std::array<float,2>{0.692825139f, 0.405642211f},
-std::array<float,2>{0.279831439f, 0.811724365f},
-std::array<float,2>{0.980916917f, 0.558713734f},
-std::array<float,2>{0.203613147f, 0.0397488289f},
-std::array<float,2>{0.829516232f, 0.155968472f},
-std::array<float,2>{0.106699131f, 0.682024717f},
-std::array<float,2>{0.533654988f, 0.948822677f},
-std::array<float,2>{0.445167631f, 0.349614769f},
-std::array<float,2>{0.758562624f, 0.449631989f},
-std::array<float,2>{0.00288624596f, 0.840384901f},
-std::array<float,2>{0.587952018f, 0.619929731f},
-std::array<float,2>{0.409672141f, 0.0798075274f},
-std::array<float,2>{0.628523827f, 0.224062502f},
-std::array<float,2>{0.332345098f, 0.706583083f},
-std::array<float,2>{0.885646582f, 0.918680966f},
-std::array<float,2>{0.143413544f, 0.285614848f},
-std::array<float,2>{0.503183544f, 0.336883157f},
-std::array<float,2>{0.491352558f, 0.97856611f},
-std::array<float,2>{0.846943259f, 0.630343378f},
-std::array<float,2>{0.0863091275f, 0.156507224f},
-std::array<float,2>{0.942637026f, 0.00860920735f},
-std::array<float,2>{0.234009221f, 0.512140393f},
-std::array<float,2>{0.729762554f, 0.754668057f},
-std::array<float,2>{0.310228735f, 0.429769814f},
-std::array<float,2>{0.87964195f, 0.488497883f},
-std::array<float,2>{0.15601632f, 0.858368337f},
-std::array<float,2>{0.640177488f, 0.5659886f},
-std::array<float,2>{0.341446698f, 0.103595473f},
-std::array<float,2>{0.580150366f, 0.208735779f},
-std::array<float,2>{0.418872833f, 0.729123354f},
-std::array<float,2>{0.752957165f, 0.877581f},
-std::array<float,2>{0.0106533794f, 0.271579325f},
-std::array<float,2>{0.722629011f, 0.355478376f},
-std::array<float,2>{0.297573924f, 0.939894795f},
-std::array<float,2>{0.945472777f, 0.675848544f},
-std::array<float,2>{0.222641125f, 0.147830755f},
-std::array<float,2>{0.855301321f, 0.0367645621f},
-std::array<float,2>{0.0787213892f, 0.552815139f},
-std::array<float,2>{0.509753823f, 0.797108471f},
-std::array<float,2>{0.493404448f, 0.392258406f},
-std::array<float,2>{0.783180058f, 0.296546251f},
-std::array<float,2>{0.053902939f, 0.908159375f},
-std::array<float,2>{0.595945597f, 0.71462965f},
-std::array<float,2>{0.392555147f, 0.231880799f},
-std::array<float,2>{0.662495732f, 0.0929569006f},
-std::array<float,2>{0.363086849f, 0.615548611f},
-std::array<float,2>{0.911838353f, 0.835863292f},
-std::array<float,2>{0.182865769f, 0.441085637f},
-std::array<float,2>{0.543455064f, 0.428599566f},
-std::array<float,2>{0.451553047f, 0.763887703f},
-std::array<float,2>{0.836988986f, 0.502362847f},
-std::array<float,2>{0.0938354954f, 0.00693882164f},
-std::array<float,2>{0.976304054f, 0.168672681f},
-std::array<float,2>{0.217456058f, 0.634089351f},
-std::array<float,2>{0.695485711f, 0.974060595f},
-std::array<float,2>{0.272979707f, 0.334104717f},
-std::array<float,2>{0.962020695f, 0.320387691f},
-std::array<float,2>{0.23770912f, 0.998975635f},
-std::array<float,2>{0.736150861f, 0.640977442f},
-std::array<float,2>{0.285668105f, 0.185336202f},
-std::array<float,2>{0.520112097f, 0.0208301097f},
-std::array<float,2>{0.480634004f, 0.527247369f},
-std::array<float,2>{0.872331023f, 0.778247178f},
-std::array<float,2>{0.0685770363f, 0.416390389f},
-std::array<float,2>{0.64943707f, 0.460768133f},
-std::array<float,2>{0.320016384f, 0.812958539f},
-std::array<float,2>{0.899680018f, 0.607523084f},
-std::array<float,2>{0.138017848f, 0.0674855337f},
-std::array<float,2>{0.776365876f, 0.246705502f},
-std::array<float,2>{0.0296308231f, 0.689799309f},
-std::array<float,2>{0.568781734f, 0.935174108f},
-std::array<float,2>{0.422321856f, 0.303748578f},
-std::array<float,2>{0.820113897f, 0.375896335f},
-std::array<float,2>{0.113543667f, 0.789357245f},
-std::array<float,2>{0.550986528f, 0.542704046f},
-std::array<float,2>{0.4568308f, 0.0551149398f},
-std::array<float,2>{0.709151149f, 0.136963516f},
-std::array<float,2>{0.262132108f, 0.666238844f},
-std::array<float,2>{0.986790776f, 0.962884545f},
-std::array<float,2>{0.202644184f, 0.360375524f},
-std::array<float,2>{0.615233064f, 0.251516342f},
-std::array<float,2>{0.388841689f, 0.899289072f},
-std::array<float,2>{0.802537799f, 0.744239807f},
-std::array<float,2>{0.0423124805f, 0.194490537f},
-std::array<float,2>{0.932803094f, 0.117518015f},
-std::array<float,2>{0.16509591f, 0.582749546f},
-std::array<float,2>{0.683937788f, 0.861010253f},
-std::array<float,2>{0.352214694f, 0.475459993f},
-std::array<float,2>{0.892423987f, 0.423591256f},
-std::array<float,2>{0.129896954f, 0.760426283f},
-std::array<float,2>{0.646228313f, 0.506726801f},
-std::array<float,2>{0.324512094f, 0.00109772664f},
-std::array<float,2>{0.571407676f, 0.166878089f},
-std::array<float,2>{0.434207588f, 0.640208721f},
-std::array<float,2>{0.769922674f, 0.969054043f},
-std::array<float,2>{0.019750772f, 0.32979691f},
-std::array<float,2>{0.742422163f, 0.290299088f},
-std::array<float,2>{0.293852448f, 0.911699414f},
-std::array<float,2>{0.954080462f, 0.717398226f},
-std::array<float,2>{0.249943554f, 0.227695107f},
-std::array<float,2>{0.864692271f, 0.0892152563f},
-std::array<float,2>{0.0746333227f, 0.611640871f},
-std::array<float,2>{0.528924108f, 0.829439938f},
-std::array<float,2>{0.472393423f, 0.443096548f},
-std::array<float,2>{0.811585605f, 0.353998959f},
-std::array<float,2>{0.0388441272f, 0.945010304f},
-std::array<float,2>{0.620988429f, 0.675546348f},
-std::array<float,2>{0.376177728f, 0.140805125f},
-std::array<float,2>{0.67941767f, 0.032623183f},
-std::array<float,2>{0.34944585f, 0.548505187f},
-std::array<float,2>{0.928803504f, 0.801246107f},
-std::array<float,2>{0.161425382f, 0.396763772f},
-std::array<float,2>{0.559062183f, 0.487959951f},
-std::array<float,2>{0.467675239f, 0.853752077f},
-std::array<float,2>{0.826379836f, 0.568122566f},
-std::array<float,2>{0.123561554f, 0.108622104f},
-std::array<float,2>{0.993611336f, 0.20343937f},
-std::array<float,2>{0.188622028f, 0.731519818f},
-std::array<float,2>{0.714488685f, 0.881945074f},
-std::array<float,2>{0.255119503f, 0.267011046f},
-std::array<float,2>{0.940764368f, 0.257571489f},
-std::array<float,2>{0.226796463f, 0.905094087f},
-std::array<float,2>{0.732993126f, 0.747882009f},
-std::array<float,2>{0.308360547f, 0.191207498f},
-std::array<float,2>{0.507686675f, 0.122587264f},
-std::array<float,2>{0.485830724f, 0.581861556f},
-std::array<float,2>{0.850128889f, 0.865970671f},
-std::array<float,2>{0.0903999209f, 0.470298499f},
-std::array<float,2>{0.6290133f, 0.382411033f},
-std::array<float,2>{0.331367403f, 0.794501305f},
-std::array<float,2>{0.888688326f, 0.546474397f},
-std::array<float,2>{0.145535588f, 0.0611048937f},
-std::array<float,2>{0.761825144f, 0.135150388f},
-std::array<float,2>{0.00773572689f, 0.670990229f},
-std::array<float,2>{0.590290368f, 0.967879176f},
-std::array<float,2>{0.41099602f, 0.366397768f},
-std::array<float,2>{0.834076881f, 0.454917073f},
-std::array<float,2>{0.104953535f, 0.819792449f},
-std::array<float,2>{0.537434876f, 0.603239298f},
-std::array<float,2>{0.437991709f, 0.0646448433f},
-std::array<float,2>{0.689581335f, 0.243243754f},
-std::array<float,2>{0.274615139f, 0.694655836f},
-std::array<float,2>{0.979960501f, 0.933233857f},
-std::array<float,2>{0.207945839f, 0.298016667f},
-std::array<float,2>{0.609363973f, 0.32654044f},
-std::array<float,2>{0.401673287f, 0.993030429f},
-std::array<float,2>{0.796787322f, 0.647849679f},
-std::array<float,2>{0.0548850484f, 0.18026264f},
-std::array<float,2>{0.916407168f, 0.0164978337f},
-std::array<float,2>{0.177249104f, 0.530062973f},
-std::array<float,2>{0.664396405f, 0.776923597f},
-std::array<float,2>{0.367560327f, 0.419547707f},
-std::array<float,2>{0.970763683f, 0.481112033f},
-std::array<float,2>{0.21114561f, 0.868062496f},
-std::array<float,2>{0.700800002f, 0.591430902f},
-std::array<float,2>{0.269408107f, 0.116434425f},
-std::array<float,2>{0.542359114f, 0.201045349f},
-std::array<float,2>{0.446180046f, 0.73713696f},
-std::array<float,2>{0.843367338f, 0.895650327f},
-std::array<float,2>{0.100496873f, 0.262691051f},
-std::array<float,2>{0.657152355f, 0.373747885f},
-std::array<float,2>{0.363772511f, 0.957935274f},
-std::array<float,2>{0.909398675f, 0.65698266f},
-std::array<float,2>{0.18531701f, 0.128266856f},
-std::array<float,2>{0.787480056f, 0.0483666025f},
-std::array<float,2>{0.0503687635f, 0.535538256f},
-std::array<float,2>{0.599210083f, 0.785210967f},
-std::array<float,2>{0.395973414f, 0.382842392f},
-std::array<float,2>{0.858140051f, 0.309091508f},
-std::array<float,2>{0.0825020373f, 0.92625612f},
-std::array<float,2>{0.514196754f, 0.698985934f},
-std::array<float,2>{0.496878982f, 0.240004137f},
-std::array<float,2>{0.723515391f, 0.0751880407f},
-std::array<float,2>{0.303885132f, 0.594932973f},
-std::array<float,2>{0.951764405f, 0.821817517f},
-std::array<float,2>{0.225021243f, 0.465292186f},
-std::array<float,2>{0.585175097f, 0.410807878f},
-std::array<float,2>{0.417616725f, 0.770354569f},
-std::array<float,2>{0.755968511f, 0.519137025f},
-std::array<float,2>{0.0130785424f, 0.0241769794f},
-std::array<float,2>{0.877628684f, 0.174130216f},
-std::array<float,2>{0.15066883f, 0.651016414f},
-std::array<float,2>{0.633597314f, 0.990140259f},
-std::array<float,2>{0.338692814f, 0.313378721f},
-std::array<float,2>{0.934766114f, 0.34231481f},
-std::array<float,2>{0.170444041f, 0.981788814f},
-std::array<float,2>{0.682162821f, 0.627574861f},
-std::array<float,2>{0.356068462f, 0.162354857f},
-std::array<float,2>{0.610342681f, 0.0146282949f},
-std::array<float,2>{0.383026093f, 0.510814428f},
-std::array<float,2>{0.800712228f, 0.750548184f},
-std::array<float,2>{0.046256572f, 0.433927894f},
-std::array<float,2>{0.705416203f, 0.448187888f},
-std::array<float,2>{0.259833694f, 0.839059055f},
-std::array<float,2>{0.991650879f, 0.622352362f},
-std::array<float,2>{0.19758518f, 0.0849003047f},
-std::array<float,2>{0.814979851f, 0.218989953f},
-std::array<float,2>{0.110861018f, 0.710329771f},
-std::array<float,2>{0.54798317f, 0.916062474f},
-std::array<float,2>{0.459578484f, 0.285007f},
-std::array<float,2>{0.77979213f, 0.399924427f},
-std::array<float,2>{0.0238015316f, 0.805856347f},
-std::array<float,2>{0.565270066f, 0.556819618f},
-std::array<float,2>{0.428399056f, 0.0464388691f},
-std::array<float,2>{0.655001938f, 0.152132541f},
-std::array<float,2>{0.312991917f, 0.685133755f},
-std::array<float,2>{0.903624594f, 0.950291276f},
-std::array<float,2>{0.13541694f, 0.345860243f},
-std::array<float,2>{0.518045783f, 0.278235346f},
-std::array<float,2>{0.477374196f, 0.887961209f},
-std::array<float,2>{0.869989216f, 0.720594585f},
-std::array<float,2>{0.0628850237f, 0.21602349f},
-std::array<float,2>{0.965951145f, 0.0968596712f},
-std::array<float,2>{0.238922969f, 0.575967789f},
-std::array<float,2>{0.741053224f, 0.85021323f},
-std::array<float,2>{0.28500706f, 0.496339023f},
-std::array<float,2>{0.957979798f, 0.388294697f},
-std::array<float,2>{0.243132636f, 0.784845531f},
-std::array<float,2>{0.746399283f, 0.531684577f},
-std::array<float,2>{0.291012675f, 0.0545071587f},
-std::array<float,2>{0.52492553f, 0.132223755f},
-std::array<float,2>{0.475280166f, 0.663489282f},
-std::array<float,2>{0.862438619f, 0.956954956f},
-std::array<float,2>{0.0731457844f, 0.369384587f},
-std::array<float,2>{0.642511964f, 0.258104026f},
-std::array<float,2>{0.322474122f, 0.891603053f},
-std::array<float,2>{0.897986591f, 0.741773665f},
-std::array<float,2>{0.12738049f, 0.195868134f},
-std::array<float,2>{0.765924037f, 0.111111186f},
-std::array<float,2>{0.0159674939f, 0.587433279f},
-std::array<float,2>{0.577751398f, 0.871830761f},
-std::array<float,2>{0.431790382f, 0.47672236f},
-std::array<float,2>{0.822395861f, 0.318256736f},
-std::array<float,2>{0.117570773f, 0.987255871f},
-std::array<float,2>{0.557130456f, 0.655762792f},
-std::array<float,2>{0.462297112f, 0.178192794f},
-std::array<float,2>{0.717740893f, 0.0293930005f},
-std::array<float,2>{0.252586216f, 0.52158618f},
-std::array<float,2>{0.996357143f, 0.766410649f},
-std::array<float,2>{0.194784135f, 0.407202542f},
-std::array<float,2>{0.621666551f, 0.461579084f},
-std::array<float,2>{0.382515252f, 0.824647963f},
-std::array<float,2>{0.804890752f, 0.600095034f},
-std::array<float,2>{0.0319515653f, 0.0732925534f},
-std::array<float,2>{0.921993732f, 0.235718533f},
-std::array<float,2>{0.15825057f, 0.700709164f},
-std::array<float,2>{0.672959983f, 0.92353934f},
-std::array<float,2>{0.344982535f, 0.307308972f},
-std::array<float,2>{0.883381486f, 0.288396984f},
-std::array<float,2>{0.141639963f, 0.921823025f},
-std::array<float,2>{0.625875771f, 0.704694271f},
-std::array<float,2>{0.334836543f, 0.224863201f},
-std::array<float,2>{0.586104035f, 0.0807117224f},
-std::array<float,2>{0.407995194f, 0.617958009f},
-std::array<float,2>{0.760981202f, 0.84371978f},
-std::array<float,2>{0.000132538582f, 0.451505303f},
-std::array<float,2>{0.727896273f, 0.432235301f},
-std::array<float,2>{0.311553985f, 0.757100224f},
-std::array<float,2>{0.943512678f, 0.514594197f},
-std::array<float,2>{0.231247768f, 0.0101532163f},
-std::array<float,2>{0.844544351f, 0.160036415f},
-std::array<float,2>{0.0887314305f, 0.632740855f},
-std::array<float,2>{0.500195384f, 0.97785306f},
-std::array<float,2>{0.48907578f, 0.33888489f},
-std::array<float,2>{0.789844513f, 0.493517756f},
-std::array<float,2>{0.058600504f, 0.843968213f},
-std::array<float,2>{0.603655934f, 0.571006775f},
-std::array<float,2>{0.402504385f, 0.099283956f},
-std::array<float,2>{0.670809567f, 0.212716639f},
-std::array<float,2>{0.373503655f, 0.724908531f},
-std::array<float,2>{0.920741558f, 0.883191526f},
-std::array<float,2>{0.17351757f, 0.276941478f},
-std::array<float,2>{0.53213346f, 0.34890002f},
-std::array<float,2>{0.441532642f, 0.945747316f},
-std::array<float,2>{0.831901073f, 0.681306839f},
-std::array<float,2>{0.108821005f, 0.152473211f},
-std::array<float,2>{0.983634353f, 0.0412973464f},
-std::array<float,2>{0.206445158f, 0.560886979f},
-std::array<float,2>{0.693968475f, 0.810288489f},
-std::array<float,2>{0.278277367f, 0.403948128f},
-std::array<float,2>{0.913142741f, 0.439062357f},
-std::array<float,2>{0.180971876f, 0.833961427f},
-std::array<float,2>{0.661207139f, 0.61454004f},
-std::array<float,2>{0.360059053f, 0.0912020952f},
-std::array<float,2>{0.594136596f, 0.23340781f},
-std::array<float,2>{0.393909842f, 0.712317646f},
-std::array<float,2>{0.785085976f, 0.909265161f},
-std::array<float,2>{0.0509204678f, 0.294846117f},
-std::array<float,2>{0.69786191f, 0.333844751f},
-std::array<float,2>{0.271441221f, 0.976373076f},
-std::array<float,2>{0.973404825f, 0.635538399f},
-std::array<float,2>{0.215793625f, 0.170945123f},
-std::array<float,2>{0.838807166f, 0.00404057652f},
-std::array<float,2>{0.0957991257f, 0.500341415f},
-std::array<float,2>{0.546871006f, 0.7624892f},
-std::array<float,2>{0.449700326f, 0.425849885f},
-std::array<float,2>{0.750246823f, 0.270838052f},
-std::array<float,2>{0.00908608455f, 0.87580198f},
-std::array<float,2>{0.578390241f, 0.726629794f},
-std::array<float,2>{0.421870083f, 0.209957615f},
-std::array<float,2>{0.637913465f, 0.103061229f},
-std::array<float,2>{0.343025237f, 0.562610567f},
-std::array<float,2>{0.882544458f, 0.855745614f},
-std::array<float,2>{0.154089212f, 0.49172771f},
-std::array<float,2>{0.5104146f, 0.394024909f},
-std::array<float,2>{0.49603045f, 0.799138844f},
-std::array<float,2>{0.853314757f, 0.552288949f},
-std::array<float,2>{0.0808483809f, 0.0374948606f},
-std::array<float,2>{0.947684705f, 0.144808203f},
-std::array<float,2>{0.220693767f, 0.679340005f},
-std::array<float,2>{0.720376492f, 0.939134955f},
-std::array<float,2>{0.300629079f, 0.358275026f},
-std::array<float,2>{0.985672176f, 0.361788273f},
-std::array<float,2>{0.199773863f, 0.963820755f},
-std::array<float,2>{0.708105981f, 0.665420651f},
-std::array<float,2>{0.265491843f, 0.13908878f},
-std::array<float,2>{0.554474115f, 0.057445053f},
-std::array<float,2>{0.454051077f, 0.539343297f},
-std::array<float,2>{0.816588581f, 0.79188174f},
-std::array<float,2>{0.116609819f, 0.37800172f},
-std::array<float,2>{0.686587811f, 0.473049879f},
-std::array<float,2>{0.354089081f, 0.861870527f},
-std::array<float,2>{0.930687726f, 0.585420609f},
-std::array<float,2>{0.166862413f, 0.119815215f},
-std::array<float,2>{0.803994119f, 0.192964301f},
-std::array<float,2>{0.0392504558f, 0.743961811f},
-std::array<float,2>{0.615536809f, 0.901734591f},
-std::array<float,2>{0.387076765f, 0.253802091f},
-std::array<float,2>{0.8749547f, 0.414726466f},
-std::array<float,2>{0.0670903102f, 0.780291796f},
-std::array<float,2>{0.521701455f, 0.524605751f},
-std::array<float,2>{0.482422322f, 0.0217123572f},
-std::array<float,2>{0.736658394f, 0.186426193f},
-std::array<float,2>{0.287463009f, 0.644107282f},
-std::array<float,2>{0.963643432f, 0.997438669f},
-std::array<float,2>{0.234916285f, 0.322473675f},
-std::array<float,2>{0.5670349f, 0.302627116f},
-std::array<float,2>{0.424126804f, 0.937267601f},
-std::array<float,2>{0.774258316f, 0.688508689f},
-std::array<float,2>{0.0289563127f, 0.249157846f},
-std::array<float,2>{0.900564194f, 0.0690488517f},
-std::array<float,2>{0.140353993f, 0.606013417f},
-std::array<float,2>{0.650663078f, 0.81539005f},
-std::array<float,2>{0.317825049f, 0.457346112f},
-std::array<float,2>{0.890095234f, 0.380525351f},
-std::array<float,2>{0.144552693f, 0.796054184f},
-std::array<float,2>{0.63048178f, 0.544145048f},
-std::array<float,2>{0.330739796f, 0.0587064698f},
-std::array<float,2>{0.591766536f, 0.133805841f},
-std::array<float,2>{0.412053317f, 0.668125987f},
-std::array<float,2>{0.762933612f, 0.965373158f},
-std::array<float,2>{0.00674974313f, 0.364108562f},
-std::array<float,2>{0.734266818f, 0.255582094f},
-std::array<float,2>{0.307359099f, 0.903755546f},
-std::array<float,2>{0.939461887f, 0.748784125f},
-std::array<float,2>{0.228379816f, 0.18782793f},
-std::array<float,2>{0.851097405f, 0.123414062f},
-std::array<float,2>{0.0909856632f, 0.578805685f},
-std::array<float,2>{0.506100059f, 0.863336682f},
-std::array<float,2>{0.485158831f, 0.47083357f},
-std::array<float,2>{0.795067608f, 0.324397862f},
-std::array<float,2>{0.0557556748f, 0.994175434f},
-std::array<float,2>{0.607838392f, 0.644677341f},
-std::array<float,2>{0.40078333f, 0.183008641f},
-std::array<float,2>{0.665041208f, 0.0176337846f},
-std::array<float,2>{0.368424803f, 0.527830839f},
-std::array<float,2>{0.917604268f, 0.77371192f},
-std::array<float,2>{0.176601619f, 0.420346767f},
-std::array<float,2>{0.538154483f, 0.456274658f},
-std::array<float,2>{0.439006984f, 0.816518962f},
-std::array<float,2>{0.835360944f, 0.605307519f},
-std::array<float,2>{0.103800319f, 0.0638323948f},
-std::array<float,2>{0.979283214f, 0.245202467f},
-std::array<float,2>{0.208494797f, 0.692574561f},
-std::array<float,2>{0.69130379f, 0.930486858f},
-std::array<float,2>{0.274276733f, 0.300566971f},
-std::array<float,2>{0.954830468f, 0.292484134f},
-std::array<float,2>{0.248121783f, 0.913847148f},
-std::array<float,2>{0.743367374f, 0.716201186f},
-std::array<float,2>{0.294175118f, 0.229639217f},
-std::array<float,2>{0.527410924f, 0.0872521996f},
-std::array<float,2>{0.47093749f, 0.609788358f},
-std::array<float,2>{0.863953054f, 0.831208646f},
-std::array<float,2>{0.0755719766f, 0.44355318f},
-std::array<float,2>{0.644897699f, 0.42516166f},
-std::array<float,2>{0.325845242f, 0.759557247f},
-std::array<float,2>{0.891443133f, 0.50397557f},
-std::array<float,2>{0.129653186f, 0.00227483781f},
-std::array<float,2>{0.771022677f, 0.16421397f},
-std::array<float,2>{0.0211783592f, 0.637593508f},
-std::array<float,2>{0.570792794f, 0.971638739f},
-std::array<float,2>{0.435254931f, 0.331048042f},
-std::array<float,2>{0.827796102f, 0.486131489f},
-std::array<float,2>{0.124952272f, 0.852203369f},
-std::array<float,2>{0.559741259f, 0.569044411f},
-std::array<float,2>{0.468078017f, 0.106415682f},
-std::array<float,2>{0.713395476f, 0.20594053f},
-std::array<float,2>{0.254346877f, 0.73292166f},
-std::array<float,2>{0.992774487f, 0.880587816f},
-std::array<float,2>{0.188319474f, 0.268326312f},
-std::array<float,2>{0.619373262f, 0.352789342f},
-std::array<float,2>{0.375510365f, 0.94311893f},
-std::array<float,2>{0.811364889f, 0.672394931f},
-std::array<float,2>{0.0371983908f, 0.142603263f},
-std::array<float,2>{0.927956998f, 0.0344781764f},
-std::array<float,2>{0.160948709f, 0.54968214f},
-std::array<float,2>{0.678667545f, 0.803366244f},
-std::array<float,2>{0.348312914f, 0.395288557f},
-std::array<float,2>{0.990479946f, 0.446774542f},
-std::array<float,2>{0.19888562f, 0.836810052f},
-std::array<float,2>{0.706950366f, 0.624499977f},
-std::array<float,2>{0.261510283f, 0.0823846161f},
-std::array<float,2>{0.546977341f, 0.221170306f},
-std::array<float,2>{0.460291445f, 0.707078397f},
-std::array<float,2>{0.815781295f, 0.915389001f},
-std::array<float,2>{0.109476723f, 0.282127976f},
-std::array<float,2>{0.683300793f, 0.340136319f},
-std::array<float,2>{0.356731564f, 0.984146059f},
-std::array<float,2>{0.933733523f, 0.626593828f},
-std::array<float,2>{0.171354517f, 0.160824314f},
-std::array<float,2>{0.799204409f, 0.0128878346f},
-std::array<float,2>{0.0453037694f, 0.508340001f},
-std::array<float,2>{0.610887051f, 0.752453268f},
-std::array<float,2>{0.384736627f, 0.435581118f},
-std::array<float,2>{0.870894372f, 0.279524773f},
-std::array<float,2>{0.0637805238f, 0.889245927f},
-std::array<float,2>{0.519079566f, 0.721367896f},
-std::array<float,2>{0.478030205f, 0.216944829f},
-std::array<float,2>{0.741533995f, 0.0947957337f},
-std::array<float,2>{0.284120768f, 0.577097774f},
-std::array<float,2>{0.965246797f, 0.849106252f},
-std::array<float,2>{0.239606664f, 0.499769211f},
-std::array<float,2>{0.566388965f, 0.401493758f},
-std::array<float,2>{0.429368138f, 0.807920992f},
-std::array<float,2>{0.780534804f, 0.555596173f},
-std::array<float,2>{0.0248996336f, 0.0448667593f},
-std::array<float,2>{0.90260911f, 0.150288656f},
-std::array<float,2>{0.136027485f, 0.687461913f},
-std::array<float,2>{0.655325949f, 0.951398671f},
-std::array<float,2>{0.313840121f, 0.345522881f},
-std::array<float,2>{0.908421278f, 0.371500582f},
-std::array<float,2>{0.183821857f, 0.959870994f},
-std::array<float,2>{0.657397091f, 0.658659995f},
-std::array<float,2>{0.364877373f, 0.126238197f},
-std::array<float,2>{0.598244309f, 0.0498947836f},
-std::array<float,2>{0.39501825f, 0.538278341f},
-std::array<float,2>{0.788104415f, 0.787460506f},
-std::array<float,2>{0.049127575f, 0.386303008f},
-std::array<float,2>{0.700058758f, 0.483738661f},
-std::array<float,2>{0.267718226f, 0.870212734f},
-std::array<float,2>{0.971800327f, 0.592461526f},
-std::array<float,2>{0.212350205f, 0.115052097f},
-std::array<float,2>{0.842570007f, 0.202073708f},
-std::array<float,2>{0.101120517f, 0.735275328f},
-std::array<float,2>{0.541924894f, 0.897891462f},
-std::array<float,2>{0.446763694f, 0.264671385f},
-std::array<float,2>{0.756890953f, 0.413659632f},
-std::array<float,2>{0.0121554276f, 0.772421539f},
-std::array<float,2>{0.584337771f, 0.517085195f},
-std::array<float,2>{0.416205853f, 0.0264449026f},
-std::array<float,2>{0.634291947f, 0.172960639f},
-std::array<float,2>{0.339138448f, 0.649597645f},
-std::array<float,2>{0.878174245f, 0.990296483f},
-std::array<float,2>{0.151661783f, 0.315664679f},
-std::array<float,2>{0.514710903f, 0.311243087f},
-std::array<float,2>{0.497712821f, 0.928198397f},
-std::array<float,2>{0.858878791f, 0.695922017f},
-std::array<float,2>{0.0838083625f, 0.240480274f},
-std::array<float,2>{0.952237368f, 0.0768068284f},
-std::array<float,2>{0.225722507f, 0.595977843f},
-std::array<float,2>{0.723965585f, 0.822281241f},
-std::array<float,2>{0.303610563f, 0.467669219f},
-std::array<float,2>{0.94524616f, 0.431611896f},
-std::array<float,2>{0.231652871f, 0.755671382f},
-std::array<float,2>{0.72670722f, 0.512963355f},
-std::array<float,2>{0.310786754f, 0.00971468538f},
-std::array<float,2>{0.501646698f, 0.157837257f},
-std::array<float,2>{0.489747316f, 0.629403234f},
-std::array<float,2>{0.844993949f, 0.979955673f},
-std::array<float,2>{0.0893919915f, 0.33766374f},
-std::array<float,2>{0.626124859f, 0.286534846f},
-std::array<float,2>{0.33591339f, 0.919120073f},
-std::array<float,2>{0.884327292f, 0.705147564f},
-std::array<float,2>{0.141085401f, 0.22298269f},
-std::array<float,2>{0.760372877f, 0.0788822621f},
-std::array<float,2>{0.00130604173f, 0.620848954f},
-std::array<float,2>{0.587330699f, 0.841434538f},
-std::array<float,2>{0.406613261f, 0.450247675f},
-std::array<float,2>{0.830477476f, 0.350711524f},
-std::array<float,2>{0.108236179f, 0.947874606f},
-std::array<float,2>{0.532633841f, 0.683277667f},
-std::array<float,2>{0.442942321f, 0.154950216f},
-std::array<float,2>{0.694871545f, 0.0406686738f},
-std::array<float,2>{0.278342605f, 0.559786499f},
-std::array<float,2>{0.982683957f, 0.811372399f},
-std::array<float,2>{0.205147892f, 0.404704183f},
-std::array<float,2>{0.604757249f, 0.495887727f},
-std::array<float,2>{0.403542191f, 0.846030891f},
-std::array<float,2>{0.79095f, 0.573808074f},
-std::array<float,2>{0.059618175f, 0.101177461f},
-std::array<float,2>{0.921808541f, 0.214201361f},
-std::array<float,2>{0.172402084f, 0.723671198f},
-std::array<float,2>{0.6713956f, 0.886017442f},
-std::array<float,2>{0.374625444f, 0.274208903f},
-std::array<float,2>{0.897310674f, 0.260972053f},
-std::array<float,2>{0.128253609f, 0.892733395f},
-std::array<float,2>{0.641172826f, 0.739022911f},
-std::array<float,2>{0.324192643f, 0.198121697f},
-std::array<float,2>{0.576779008f, 0.111634344f},
-std::array<float,2>{0.433233708f, 0.588672101f},
-std::array<float,2>{0.76684612f, 0.874530077f},
-std::array<float,2>{0.0168492217f, 0.479043841f},
-std::array<float,2>{0.747474492f, 0.38891679f},
-std::array<float,2>{0.28919211f, 0.782074213f},
-std::array<float,2>{0.958856702f, 0.534679174f},
-std::array<float,2>{0.24320446f, 0.0522160456f},
-std::array<float,2>{0.861813784f, 0.13006863f},
-std::array<float,2>{0.0735882148f, 0.660967112f},
-std::array<float,2>{0.523869455f, 0.954522669f},
-std::array<float,2>{0.476236939f, 0.367681175f},
-std::array<float,2>{0.806194901f, 0.464686781f},
-std::array<float,2>{0.0327498727f, 0.827896595f},
-std::array<float,2>{0.622373104f, 0.598970532f},
-std::array<float,2>{0.380955875f, 0.0718748495f},
-std::array<float,2>{0.67201966f, 0.237175658f},
-std::array<float,2>{0.343808711f, 0.70197624f},
-std::array<float,2>{0.923288405f, 0.924554825f},
-std::array<float,2>{0.159238517f, 0.305433542f},
-std::array<float,2>{0.558356106f, 0.319387704f},
-std::array<float,2>{0.461826384f, 0.985981107f},
-std::array<float,2>{0.823416889f, 0.653697908f},
-std::array<float,2>{0.118908092f, 0.176997364f},
-std::array<float,2>{0.997604549f, 0.0273689292f},
-std::array<float,2>{0.193876907f, 0.521213949f},
-std::array<float,2>{0.718208253f, 0.768145442f},
-std::array<float,2>{0.253070056f, 0.410030812f},
-std::array<float,2>{0.929717004f, 0.475898296f},
-std::array<float,2>{0.167005911f, 0.860223651f},
-std::array<float,2>{0.686024487f, 0.583199382f},
-std::array<float,2>{0.354849011f, 0.118228368f},
-std::array<float,2>{0.616409957f, 0.194326326f},
-std::array<float,2>{0.388663501f, 0.745217621f},
-std::array<float,2>{0.802963734f, 0.89978379f},
-std::array<float,2>{0.040473558f, 0.250833839f},
-std::array<float,2>{0.707966864f, 0.360014975f},
-std::array<float,2>{0.264163822f, 0.961507082f},
-std::array<float,2>{0.984554768f, 0.667062998f},
-std::array<float,2>{0.200818732f, 0.138069734f},
-std::array<float,2>{0.818255723f, 0.0556876287f},
-std::array<float,2>{0.115691885f, 0.541940629f},
-std::array<float,2>{0.553619206f, 0.790067554f},
-std::array<float,2>{0.454599798f, 0.376767367f},
-std::array<float,2>{0.775359035f, 0.3028391f},
-std::array<float,2>{0.0281616785f, 0.934336782f},
-std::array<float,2>{0.567694008f, 0.691030979f},
-std::array<float,2>{0.42557314f, 0.247735307f},
-std::array<float,2>{0.651473165f, 0.0669776574f},
-std::array<float,2>{0.31700632f, 0.608959734f},
-std::array<float,2>{0.901760757f, 0.813591301f},
-std::array<float,2>{0.138974026f, 0.459539026f},
-std::array<float,2>{0.523191094f, 0.41705519f},
-std::array<float,2>{0.483913064f, 0.778847873f},
-std::array<float,2>{0.873095393f, 0.526195586f},
-std::array<float,2>{0.0681184009f, 0.0203120839f},
-std::array<float,2>{0.964202464f, 0.183669165f},
-std::array<float,2>{0.235515803f, 0.642404675f},
-std::array<float,2>{0.737937152f, 0.999681294f},
-std::array<float,2>{0.288235724f, 0.321543902f},
-std::array<float,2>{0.974068761f, 0.335351437f},
-std::array<float,2>{0.216626436f, 0.973048627f},
-std::array<float,2>{0.698463857f, 0.632853627f},
-std::array<float,2>{0.270087153f, 0.169728309f},
-std::array<float,2>{0.545048296f, 0.00644814596f},
-std::array<float,2>{0.450585842f, 0.503567994f},
-std::array<float,2>{0.839129567f, 0.764876425f},
-std::array<float,2>{0.0968019664f, 0.428719223f},
-std::array<float,2>{0.660996795f, 0.43953228f},
-std::array<float,2>{0.361314178f, 0.834290206f},
-std::array<float,2>{0.912160635f, 0.616245806f},
-std::array<float,2>{0.180218324f, 0.0924713016f},
-std::array<float,2>{0.783702612f, 0.230716184f},
-std::array<float,2>{0.0519365631f, 0.713744998f},
-std::array<float,2>{0.595116973f, 0.906681478f},
-std::array<float,2>{0.392728597f, 0.295089692f},
-std::array<float,2>{0.851954103f, 0.390928775f},
-std::array<float,2>{0.081403397f, 0.798574448f},
-std::array<float,2>{0.510793984f, 0.553930521f},
-std::array<float,2>{0.494346648f, 0.0355406702f},
-std::array<float,2>{0.719023228f, 0.146807924f},
-std::array<float,2>{0.299600691f, 0.676938415f},
-std::array<float,2>{0.948479176f, 0.940993667f},
-std::array<float,2>{0.219257951f, 0.356474131f},
-std::array<float,2>{0.579799771f, 0.272770405f},
-std::array<float,2>{0.420264006f, 0.877962291f},
-std::array<float,2>{0.751444399f, 0.73043102f},
-std::array<float,2>{0.00872354582f, 0.207566977f},
-std::array<float,2>{0.881388903f, 0.104886591f},
-std::array<float,2>{0.152929142f, 0.565237403f},
-std::array<float,2>{0.636933863f, 0.85877192f},
-std::array<float,2>{0.342544258f, 0.48996979f},
-std::array<float,2>{0.91499114f, 0.418052375f},
-std::array<float,2>{0.179052845f, 0.775446892f},
-std::array<float,2>{0.667782128f, 0.530854642f},
-std::array<float,2>{0.370996624f, 0.0173379667f},
-std::array<float,2>{0.606455684f, 0.180715188f},
-std::array<float,2>{0.398688793f, 0.64721626f},
-std::array<float,2>{0.793667376f, 0.993185341f},
-std::array<float,2>{0.0567612424f, 0.327216893f},
-std::array<float,2>{0.689206362f, 0.297573477f},
-std::array<float,2>{0.276258737f, 0.932300746f},
-std::array<float,2>{0.977544367f, 0.693646371f},
-std::array<float,2>{0.209592834f, 0.242999375f},
-std::array<float,2>{0.832476497f, 0.065682888f},
-std::array<float,2>{0.102867551f, 0.601773739f},
-std::array<float,2>{0.53636229f, 0.818654001f},
-std::array<float,2>{0.441373527f, 0.453979939f},
-std::array<float,2>{0.764283836f, 0.365418345f},
-std::array<float,2>{0.00511665968f, 0.967450798f},
-std::array<float,2>{0.592921913f, 0.670691967f},
-std::array<float,2>{0.413833112f, 0.136297107f},
-std::array<float,2>{0.631694913f, 0.0621210337f},
-std::array<float,2>{0.329336226f, 0.545590222f},
-std::array<float,2>{0.887348592f, 0.793747485f},
-std::array<float,2>{0.146707132f, 0.380909115f},
-std::array<float,2>{0.504174113f, 0.469319493f},
-std::array<float,2>{0.486548185f, 0.866320968f},
-std::array<float,2>{0.848142147f, 0.580765843f},
-std::array<float,2>{0.0932827294f, 0.121405691f},
-std::array<float,2>{0.937546849f, 0.189468041f},
-std::array<float,2>{0.23041524f, 0.746583998f},
-std::array<float,2>{0.731265008f, 0.90530473f},
-std::array<float,2>{0.304691881f, 0.256021172f},
-std::array<float,2>{0.995395899f, 0.266182691f},
-std::array<float,2>{0.189626023f, 0.881105721f},
-std::array<float,2>{0.712110937f, 0.730894685f},
-std::array<float,2>{0.25750035f, 0.204592317f},
-std::array<float,2>{0.562251985f, 0.108124495f},
-std::array<float,2>{0.466000229f, 0.56703198f},
-std::array<float,2>{0.824927568f, 0.855326533f},
-std::array<float,2>{0.121335097f, 0.486685723f},
-std::array<float,2>{0.676059246f, 0.398295522f},
-std::array<float,2>{0.351461768f, 0.802124679f},
-std::array<float,2>{0.927411616f, 0.547226727f},
-std::array<float,2>{0.162423268f, 0.0318759531f},
-std::array<float,2>{0.80911988f, 0.142275378f},
-std::array<float,2>{0.0368442945f, 0.674345851f},
-std::array<float,2>{0.61801815f, 0.944114149f},
-std::array<float,2>{0.37826696f, 0.355083048f},
-std::array<float,2>{0.866952479f, 0.442234248f},
-std::array<float,2>{0.0771622956f, 0.828642905f},
-std::array<float,2>{0.530343175f, 0.612453997f},
-std::array<float,2>{0.468827486f, 0.0881956145f},
-std::array<float,2>{0.745868385f, 0.226935059f},
-std::array<float,2>{0.29634431f, 0.718716025f},
-std::array<float,2>{0.956197441f, 0.910969198f},
-std::array<float,2>{0.246294737f, 0.289582789f},
-std::array<float,2>{0.572793305f, 0.329026312f},
-std::array<float,2>{0.436345786f, 0.970387459f},
-std::array<float,2>{0.773389637f, 0.639588177f},
-std::array<float,2>{0.0220144615f, 0.167137504f},
-std::array<float,2>{0.894403458f, 0.000431236753f},
-std::array<float,2>{0.132243812f, 0.507705152f},
-std::array<float,2>{0.647704661f, 0.761113226f},
-std::array<float,2>{0.326929957f, 0.422368377f},
-std::array<float,2>{0.967764318f, 0.497411966f},
-std::array<float,2>{0.241587982f, 0.851492643f},
-std::array<float,2>{0.738345087f, 0.575144231f},
-std::array<float,2>{0.282041073f, 0.095737949f},
-std::array<float,2>{0.516011119f, 0.214992538f},
-std::array<float,2>{0.479418278f, 0.718886435f},
-std::array<float,2>{0.868645668f, 0.887023091f},
-std::array<float,2>{0.065796338f, 0.278621852f},
-std::array<float,2>{0.652613997f, 0.346948415f},
-std::array<float,2>{0.315673441f, 0.949831903f},
-std::array<float,2>{0.904602885f, 0.684021115f},
-std::array<float,2>{0.133343279f, 0.150476158f},
-std::array<float,2>{0.778869152f, 0.044967141f},
-std::array<float,2>{0.0265557375f, 0.558475316f},
-std::array<float,2>{0.56254226f, 0.805306554f},
-std::array<float,2>{0.426667899f, 0.399180055f},
-std::array<float,2>{0.813495815f, 0.283631533f},
-std::array<float,2>{0.112485737f, 0.917336881f},
-std::array<float,2>{0.550053775f, 0.709902644f},
-std::array<float,2>{0.457369655f, 0.220246866f},
-std::array<float,2>{0.70457083f, 0.0856293067f},
-std::array<float,2>{0.257816166f, 0.621898949f},
-std::array<float,2>{0.989094734f, 0.838300943f},
-std::array<float,2>{0.196683273f, 0.448670566f},
-std::array<float,2>{0.613034189f, 0.434594929f},
-std::array<float,2>{0.384928226f, 0.751600921f},
-std::array<float,2>{0.797326326f, 0.510662735f},
-std::array<float,2>{0.0447435081f, 0.0150167244f},
-std::array<float,2>{0.936725855f, 0.16356656f},
-std::array<float,2>{0.168014988f, 0.628354907f},
-std::array<float,2>{0.680563211f, 0.981355667f},
-std::array<float,2>{0.357674778f, 0.343040079f},
-std::array<float,2>{0.87529546f, 0.314079076f},
-std::array<float,2>{0.149805874f, 0.98877424f},
-std::array<float,2>{0.63629353f, 0.651942194f},
-std::array<float,2>{0.337201059f, 0.175476775f},
-std::array<float,2>{0.582922339f, 0.0253271777f},
-std::array<float,2>{0.414767027f, 0.517746627f},
-std::array<float,2>{0.755133212f, 0.770860791f},
-std::array<float,2>{0.0140068885f, 0.411235601f},
-std::array<float,2>{0.724620759f, 0.466681093f},
-std::array<float,2>{0.301068455f, 0.820620537f},
-std::array<float,2>{0.950353444f, 0.593817651f},
-std::array<float,2>{0.223006219f, 0.0754210651f},
-std::array<float,2>{0.857029259f, 0.238981918f},
-std::array<float,2>{0.0858474672f, 0.697805107f},
-std::array<float,2>{0.512295604f, 0.927256405f},
-std::array<float,2>{0.49950096f, 0.31021297f},
-std::array<float,2>{0.78601706f, 0.384642959f},
-std::array<float,2>{0.0487417318f, 0.786505818f},
-std::array<float,2>{0.599854529f, 0.536141872f},
-std::array<float,2>{0.397486091f, 0.0474297628f},
-std::array<float,2>{0.658610582f, 0.127765357f},
-std::array<float,2>{0.366919905f, 0.657934785f},
-std::array<float,2>{0.907135665f, 0.958096147f},
-std::array<float,2>{0.187067106f, 0.374168545f},
-std::array<float,2>{0.540300667f, 0.262939632f},
-std::array<float,2>{0.447785109f, 0.894907892f},
-std::array<float,2>{0.840319097f, 0.737576663f},
-std::array<float,2>{0.0985220745f, 0.199300945f},
-std::array<float,2>{0.968811572f, 0.11589618f},
-std::array<float,2>{0.213888943f, 0.590334177f},
-std::array<float,2>{0.702905416f, 0.868423045f},
-std::array<float,2>{0.265657961f, 0.4821859f},
-std::array<float,2>{0.982045233f, 0.403309107f},
-std::array<float,2>{0.204530418f, 0.809483886f},
-std::array<float,2>{0.691582024f, 0.561779261f},
-std::array<float,2>{0.280410886f, 0.0427274778f},
-std::array<float,2>{0.535103142f, 0.153866976f},
-std::array<float,2>{0.443522215f, 0.679805875f},
-std::array<float,2>{0.828411222f, 0.946706951f},
-std::array<float,2>{0.106044248f, 0.34832868f},
-std::array<float,2>{0.668113351f, 0.276088387f},
-std::array<float,2>{0.371533811f, 0.883885443f},
-std::array<float,2>{0.91873008f, 0.725825965f},
-std::array<float,2>{0.174275056f, 0.211411744f},
-std::array<float,2>{0.792188525f, 0.0982967988f},
-std::array<float,2>{0.0610647686f, 0.572107673f},
-std::array<float,2>{0.603086591f, 0.845526516f},
-std::array<float,2>{0.404639393f, 0.492802024f},
-std::array<float,2>{0.846465826f, 0.338447839f},
-std::array<float,2>{0.0869537741f, 0.977179468f},
-std::array<float,2>{0.502746105f, 0.631275415f},
-std::array<float,2>{0.491082758f, 0.158821851f},
-std::array<float,2>{0.729273975f, 0.0116205681f},
-std::array<float,2>{0.308839262f, 0.514886916f},
-std::array<float,2>{0.941525877f, 0.756029606f},
-std::array<float,2>{0.23328343f, 0.433313191f},
-std::array<float,2>{0.589093685f, 0.452340603f},
-std::array<float,2>{0.408286661f, 0.842569292f},
-std::array<float,2>{0.759352386f, 0.619137704f},
-std::array<float,2>{0.00309637142f, 0.0816536471f},
-std::array<float,2>{0.886021316f, 0.225852475f},
-std::array<float,2>{0.144342989f, 0.7039904f},
-std::array<float,2>{0.627906144f, 0.920799494f},
-std::array<float,2>{0.333099037f, 0.287518561f},
-std::array<float,2>{0.92535907f, 0.307618797f},
-std::array<float,2>{0.156346902f, 0.922296166f},
-std::array<float,2>{0.67469734f, 0.699790776f},
-std::array<float,2>{0.346851557f, 0.234745622f},
-std::array<float,2>{0.62442857f, 0.0724040642f},
-std::array<float,2>{0.380212665f, 0.60142684f},
-std::array<float,2>{0.807223499f, 0.825369298f},
-std::array<float,2>{0.0349260308f, 0.462756395f},
-std::array<float,2>{0.716484189f, 0.407634288f},
-std::array<float,2>{0.25000003f, 0.766918838f},
-std::array<float,2>{0.999890864f, 0.522835493f},
-std::array<float,2>{0.193271577f, 0.0304853357f},
-std::array<float,2>{0.820699632f, 0.178865269f},
-std::array<float,2>{0.119236648f, 0.65508455f},
-std::array<float,2>{0.556363046f, 0.988166749f},
-std::array<float,2>{0.464324474f, 0.316723019f},
-std::array<float,2>{0.768553793f, 0.477885842f},
-std::array<float,2>{0.0177033246f, 0.872335136f},
-std::array<float,2>{0.575566828f, 0.58634007f},
-std::array<float,2>{0.431608826f, 0.110020183f},
-std::array<float,2>{0.642880678f, 0.196480989f},
-std::array<float,2>{0.320384115f, 0.740681887f},
-std::array<float,2>{0.894924581f, 0.891292572f},
-std::array<float,2>{0.125286058f, 0.259181648f},
-std::array<float,2>{0.526355922f, 0.370295107f},
-std::array<float,2>{0.4737266f, 0.955285251f},
-std::array<float,2>{0.860042453f, 0.662461877f},
-std::array<float,2>{0.0711758956f, 0.131402671f},
-std::array<float,2>{0.960283041f, 0.0533696115f},
-std::array<float,2>{0.244753331f, 0.532443702f},
-std::array<float,2>{0.748779833f, 0.783553243f},
-std::array<float,2>{0.291500449f, 0.38740623f},
-std::array<float,2>{0.899055898f, 0.45859459f},
-std::array<float,2>{0.137286544f, 0.815859914f},
-std::array<float,2>{0.64882642f, 0.607362807f},
-std::array<float,2>{0.318820834f, 0.0693402141f},
-std::array<float,2>{0.569720089f, 0.248426586f},
-std::array<float,2>{0.422949523f, 0.688288152f},
-std::array<float,2>{0.776679695f, 0.936255753f},
-std::array<float,2>{0.0306241289f, 0.301605552f},
-std::array<float,2>{0.734608471f, 0.323943079f},
-std::array<float,2>{0.286903918f, 0.996994853f},
-std::array<float,2>{0.961514056f, 0.643027663f},
-std::array<float,2>{0.236829415f, 0.18696408f},
-std::array<float,2>{0.871868908f, 0.022973178f},
-std::array<float,2>{0.0701815411f, 0.523541749f},
-std::array<float,2>{0.521225393f, 0.779666007f},
-std::array<float,2>{0.482208341f, 0.415154934f},
-std::array<float,2>{0.801507592f, 0.251968175f},
-std::array<float,2>{0.041254051f, 0.900486052f},
-std::array<float,2>{0.613512278f, 0.742991328f},
-std::array<float,2>{0.39050138f, 0.191918343f},
-std::array<float,2>{0.685270607f, 0.120397449f},
-std::array<float,2>{0.353071421f, 0.58444047f},
-std::array<float,2>{0.931864679f, 0.862606883f},
-std::array<float,2>{0.164736316f, 0.473973453f},
-std::array<float,2>{0.552055597f, 0.377746582f},
-std::array<float,2>{0.455575615f, 0.792176604f},
-std::array<float,2>{0.81876713f, 0.540607154f},
-std::array<float,2>{0.114983603f, 0.0577812977f},
-std::array<float,2>{0.987314522f, 0.139954537f},
-std::array<float,2>{0.20143947f, 0.664846063f},
-std::array<float,2>{0.710155308f, 0.964023829f},
-std::array<float,2>{0.263661355f, 0.362781674f},
-std::array<float,2>{0.947251618f, 0.35924077f},
-std::array<float,2>{0.220843107f, 0.937572539f},
-std::array<float,2>{0.721125126f, 0.677788436f},
-std::array<float,2>{0.298723906f, 0.146396101f},
-std::array<float,2>{0.508217514f, 0.0385960601f},
-std::array<float,2>{0.492524713f, 0.551169932f},
-std::array<float,2>{0.853830397f, 0.800115466f},
-std::array<float,2>{0.0797320232f, 0.393295079f},
-std::array<float,2>{0.63942343f, 0.490982056f},
-std::array<float,2>{0.340029627f, 0.856558204f},
-std::array<float,2>{0.880159974f, 0.563659072f},
-std::array<float,2>{0.155032292f, 0.102494568f},
-std::array<float,2>{0.752449572f, 0.210386693f},
-std::array<float,2>{0.0109270327f, 0.728257895f},
-std::array<float,2>{0.58117187f, 0.876844347f},
-std::array<float,2>{0.419344366f, 0.269656777f},
-std::array<float,2>{0.836462796f, 0.427095711f},
-std::array<float,2>{0.0948821381f, 0.763514936f},
-std::array<float,2>{0.544087231f, 0.501006484f},
-std::array<float,2>{0.452501029f, 0.00496670743f},
-std::array<float,2>{0.696333051f, 0.169955179f},
-std::array<float,2>{0.271966517f, 0.636255145f},
-std::array<float,2>{0.97542572f, 0.974625289f},
-std::array<float,2>{0.218236402f, 0.332084507f},
-std::array<float,2>{0.59701705f, 0.293014914f},
-std::array<float,2>{0.39139241f, 0.90837419f},
-std::array<float,2>{0.782164633f, 0.711702168f},
-std::array<float,2>{0.0528495125f, 0.233325779f},
-std::array<float,2>{0.910817683f, 0.0902582482f},
-std::array<float,2>{0.182057038f, 0.613564789f},
-std::array<float,2>{0.663496554f, 0.832473934f},
-std::array<float,2>{0.362262189f, 0.438012004f},
-std::array<float,2>{0.906426132f, 0.385829359f},
-std::array<float,2>{0.1866166f, 0.787961483f},
-std::array<float,2>{0.658733487f, 0.538935602f},
-std::array<float,2>{0.366505414f, 0.0504694618f},
-std::array<float,2>{0.600252748f, 0.126950517f},
-std::array<float,2>{0.397959113f, 0.658821404f},
-std::array<float,2>{0.785298049f, 0.95939827f},
-std::array<float,2>{0.0479345284f, 0.372029275f},
-std::array<float,2>{0.702375114f, 0.265401423f},
-std::array<float,2>{0.266172558f, 0.897994578f},
-std::array<float,2>{0.969374359f, 0.734768987f},
-std::array<float,2>{0.214489758f, 0.201508924f},
-std::array<float,2>{0.84073478f, 0.114276513f},
-std::array<float,2>{0.0980029553f, 0.592215657f},
-std::array<float,2>{0.540863037f, 0.871084809f},
-std::array<float,2>{0.4476147f, 0.484081f},
-std::array<float,2>{0.755695581f, 0.316199988f},
-std::array<float,2>{0.014311065f, 0.990754128f},
-std::array<float,2>{0.582118273f, 0.650079668f},
-std::array<float,2>{0.414285541f, 0.173724994f},
-std::array<float,2>{0.636035144f, 0.0271071102f},
-std::array<float,2>{0.337675154f, 0.517361462f},
-std::array<float,2>{0.87549299f, 0.771508873f},
-std::array<float,2>{0.150273412f, 0.413092881f},
-std::array<float,2>{0.51205647f, 0.46685335f},
-std::array<float,2>{0.499945462f, 0.822960496f},
-std::array<float,2>{0.856680095f, 0.596605897f},
-std::array<float,2>{0.0853463113f, 0.0761948004f},
-std::array<float,2>{0.950740159f, 0.241066039f},
-std::array<float,2>{0.223484308f, 0.695704997f},
-std::array<float,2>{0.725281537f, 0.928526282f},
-std::array<float,2>{0.301413774f, 0.310720116f},
-std::array<float,2>{0.988590896f, 0.281435311f},
-std::array<float,2>{0.197246224f, 0.91569984f},
-std::array<float,2>{0.705025911f, 0.707718134f},
-std::array<float,2>{0.258705258f, 0.221199974f},
-std::array<float,2>{0.550670862f, 0.0826209709f},
-std::array<float,2>{0.457847655f, 0.624893367f},
-std::array<float,2>{0.81443131f, 0.836289585f},
-std::array<float,2>{0.112962276f, 0.44690755f},
-std::array<float,2>{0.680150568f, 0.436442494f},
-std::array<float,2>{0.358055562f, 0.752385914f},
-std::array<float,2>{0.937282622f, 0.508282304f},
-std::array<float,2>{0.168829247f, 0.0131962169f},
-std::array<float,2>{0.797501326f, 0.160198793f},
-std::array<float,2>{0.0440978482f, 0.626043081f},
-std::array<float,2>{0.612343609f, 0.983880281f},
-std::array<float,2>{0.385684371f, 0.340777397f},
-std::array<float,2>{0.868994772f, 0.499164492f},
-std::array<float,2>{0.0662781894f, 0.849121392f},
-std::array<float,2>{0.516486883f, 0.576301396f},
-std::array<float,2>{0.47862798f, 0.0956354812f},
-std::array<float,2>{0.739165545f, 0.217714816f},
-std::array<float,2>{0.281511515f, 0.720864236f},
-std::array<float,2>{0.967242658f, 0.888845146f},
-std::array<float,2>{0.241781652f, 0.280272841f},
-std::array<float,2>{0.563038766f, 0.3447752f},
-std::array<float,2>{0.426001906f, 0.95199275f},
-std::array<float,2>{0.778808117f, 0.686853826f},
-std::array<float,2>{0.027004173f, 0.149721652f},
-std::array<float,2>{0.904901981f, 0.0443294868f},
-std::array<float,2>{0.133054987f, 0.555059731f},
-std::array<float,2>{0.653121233f, 0.808213115f},
-std::array<float,2>{0.31619975f, 0.40221411f},
-std::array<float,2>{0.956924915f, 0.444291562f},
-std::array<float,2>{0.247069731f, 0.831677735f},
-std::array<float,2>{0.74554503f, 0.609987915f},
-std::array<float,2>{0.29670912f, 0.0876993984f},
-std::array<float,2>{0.530940056f, 0.230245486f},
-std::array<float,2>{0.469681114f, 0.716566503f},
-std::array<float,2>{0.866321921f, 0.913182914f},
-std::array<float,2>{0.078106001f, 0.292352527f},
-std::array<float,2>{0.648219466f, 0.330223888f},
-std::array<float,2>{0.326605916f, 0.970880747f},
-std::array<float,2>{0.893730462f, 0.636987865f},
-std::array<float,2>{0.132608995f, 0.164846539f},
-std::array<float,2>{0.772651553f, 0.0025279494f},
-std::array<float,2>{0.0216225591f, 0.504532039f},
-std::array<float,2>{0.572364867f, 0.758818328f},
-std::array<float,2>{0.435938954f, 0.425485313f},
-std::array<float,2>{0.82445538f, 0.267866105f},
-std::array<float,2>{0.121856235f, 0.880150437f},
-std::array<float,2>{0.561870515f, 0.732748449f},
-std::array<float,2>{0.466369599f, 0.205510959f},
-std::array<float,2>{0.71246922f, 0.105487943f},
-std::array<float,2>{0.257196993f, 0.568450511f},
-std::array<float,2>{0.995720148f, 0.851881504f},
-std::array<float,2>{0.190284073f, 0.485514045f},
-std::array<float,2>{0.617271304f, 0.394881994f},
-std::array<float,2>{0.378563672f, 0.802902162f},
-std::array<float,2>{0.80861032f, 0.549171984f},
-std::array<float,2>{0.0363557748f, 0.0349672362f},
-std::array<float,2>{0.926990271f, 0.143165678f},
-std::array<float,2>{0.162741929f, 0.672265887f},
-std::array<float,2>{0.676610529f, 0.942732334f},
-std::array<float,2>{0.350836098f, 0.353236586f},
-std::array<float,2>{0.887069166f, 0.363757104f},
-std::array<float,2>{0.147348031f, 0.965030134f},
-std::array<float,2>{0.631307721f, 0.668844223f},
-std::array<float,2>{0.329997301f, 0.134313658f},
-std::array<float,2>{0.593344271f, 0.0592792258f},
-std::array<float,2>{0.413276166f, 0.544518292f},
-std::array<float,2>{0.763984144f, 0.796393871f},
-std::array<float,2>{0.00556177599f, 0.380007267f},
-std::array<float,2>{0.730778694f, 0.471423775f},
-std::array<float,2>{0.305412889f, 0.863861859f},
-std::array<float,2>{0.938392341f, 0.578149557f},
-std::array<float,2>{0.229560286f, 0.124013685f},
-std::array<float,2>{0.848472416f, 0.188308924f},
-std::array<float,2>{0.0931584239f, 0.748178422f},
-std::array<float,2>{0.504832447f, 0.903890491f},
-std::array<float,2>{0.487024367f, 0.255350351f},
-std::array<float,2>{0.793431759f, 0.420779884f},
-std::array<float,2>{0.0571414456f, 0.774383724f},
-std::array<float,2>{0.60695231f, 0.527886629f},
-std::array<float,2>{0.399203837f, 0.0183691904f},
-std::array<float,2>{0.667135298f, 0.183458164f},
-std::array<float,2>{0.37053299f, 0.645397186f},
-std::array<float,2>{0.914157152f, 0.994929314f},
-std::array<float,2>{0.179310605f, 0.324871957f},
-std::array<float,2>{0.536891282f, 0.299859673f},
-std::array<float,2>{0.440720201f, 0.930007637f},
-std::array<float,2>{0.832752347f, 0.692977369f},
-std::array<float,2>{0.103119515f, 0.245951846f},
-std::array<float,2>{0.978465199f, 0.0641490892f},
-std::array<float,2>{0.209275112f, 0.604569852f},
-std::array<float,2>{0.688783228f, 0.817194819f},
-std::array<float,2>{0.275813252f, 0.456839293f},
-std::array<float,2>{0.974676311f, 0.429255038f},
-std::array<float,2>{0.218643144f, 0.765499175f},
-std::array<float,2>{0.696802378f, 0.503134072f},
-std::array<float,2>{0.272036999f, 0.00631073071f},
-std::array<float,2>{0.544582129f, 0.169222385f},
-std::array<float,2>{0.452976227f, 0.633697391f},
-std::array<float,2>{0.836031258f, 0.973157883f},
-std::array<float,2>{0.0956273824f, 0.335497737f},
-std::array<float,2>{0.663766026f, 0.295861959f},
-std::array<float,2>{0.361586154f, 0.906913042f},
-std::array<float,2>{0.910240114f, 0.713374674f},
-std::array<float,2>{0.182199538f, 0.231085271f},
-std::array<float,2>{0.781393886f, 0.0920059904f},
-std::array<float,2>{0.0534326844f, 0.61677438f},
-std::array<float,2>{0.597591639f, 0.83450067f},
-std::array<float,2>{0.39087376f, 0.440291494f},
-std::array<float,2>{0.854298472f, 0.35697183f},
-std::array<float,2>{0.0791283846f, 0.940470636f},
-std::array<float,2>{0.508347392f, 0.677576542f},
-std::array<float,2>{0.492975801f, 0.147113174f},
-std::array<float,2>{0.721565902f, 0.0357617773f},
-std::array<float,2>{0.29832074f, 0.554546475f},
-std::array<float,2>{0.946573198f, 0.79822737f},
-std::array<float,2>{0.221509725f, 0.391463101f},
-std::array<float,2>{0.581833839f, 0.489679903f},
-std::array<float,2>{0.41947031f, 0.859198809f},
-std::array<float,2>{0.751998961f, 0.564894259f},
-std::array<float,2>{0.0114542125f, 0.105382949f},
-std::array<float,2>{0.880781531f, 0.207507327f},
-std::array<float,2>{0.154332012f, 0.729868591f},
-std::array<float,2>{0.638992906f, 0.878599524f},
-std::array<float,2>{0.340494186f, 0.273008853f},
-std::array<float,2>{0.932267606f, 0.250428081f},
-std::array<float,2>{0.164404228f, 0.900123715f},
-std::array<float,2>{0.685051739f, 0.74588865f},
-std::array<float,2>{0.352702767f, 0.193451911f},
-std::array<float,2>{0.613950908f, 0.118755177f},
-std::array<float,2>{0.389894664f, 0.583922386f},
-std::array<float,2>{0.801193953f, 0.859834731f},
-std::array<float,2>{0.0417433828f, 0.476280272f},
-std::array<float,2>{0.710849166f, 0.376410574f},
-std::array<float,2>{0.262999564f, 0.790641308f},
-std::array<float,2>{0.987947583f, 0.541245043f},
-std::array<float,2>{0.202024683f, 0.0564776622f},
-std::array<float,2>{0.819300056f, 0.138295665f},
-std::array<float,2>{0.114730924f, 0.667595029f},
-std::array<float,2>{0.552441478f, 0.961131632f},
-std::array<float,2>{0.455413461f, 0.359830171f},
-std::array<float,2>{0.776977479f, 0.459368408f},
-std::array<float,2>{0.0309197642f, 0.814198375f},
-std::array<float,2>{0.569847167f, 0.608650208f},
-std::array<float,2>{0.423474491f, 0.0665990114f},
-std::array<float,2>{0.648940563f, 0.247124165f},
-std::array<float,2>{0.319092125f, 0.690552235f},
-std::array<float,2>{0.898491919f, 0.933694303f},
-std::array<float,2>{0.13688755f, 0.303304136f},
-std::array<float,2>{0.520809472f, 0.322208226f},
-std::array<float,2>{0.481499225f, 0.999218583f},
-std::array<float,2>{0.871362388f, 0.641999602f},
-std::array<float,2>{0.0693386868f, 0.184522092f},
-std::array<float,2>{0.961408079f, 0.0197309218f},
-std::array<float,2>{0.236585751f, 0.525487185f},
-std::array<float,2>{0.735218465f, 0.77859956f},
-std::array<float,2>{0.286150783f, 0.417631358f},
-std::array<float,2>{0.895490587f, 0.478897393f},
-std::array<float,2>{0.125563189f, 0.874438822f},
-std::array<float,2>{0.643201232f, 0.588333309f},
-std::array<float,2>{0.320915848f, 0.112287194f},
-std::array<float,2>{0.575694442f, 0.197282106f},
-std::array<float,2>{0.430785865f, 0.738760591f},
-std::array<float,2>{0.767658591f, 0.893404186f},
-std::array<float,2>{0.0181129742f, 0.261668116f},
-std::array<float,2>{0.748216093f, 0.367291152f},
-std::array<float,2>{0.291792631f, 0.954702318f},
-std::array<float,2>{0.960617185f, 0.66018492f},
-std::array<float,2>{0.244274974f, 0.130537376f},
-std::array<float,2>{0.85951823f, 0.0523560308f},
-std::array<float,2>{0.0706102774f, 0.534661353f},
-std::array<float,2>{0.525446355f, 0.781431496f},
-std::array<float,2>{0.474349797f, 0.389643282f},
-std::array<float,2>{0.806878567f, 0.304774582f},
-std::array<float,2>{0.0343517736f, 0.924045503f},
-std::array<float,2>{0.62484473f, 0.701383114f},
-std::array<float,2>{0.38049528f, 0.236528695f},
-std::array<float,2>{0.674090266f, 0.0715413615f},
-std::array<float,2>{0.347214818f, 0.599377275f},
-std::array<float,2>{0.925021231f, 0.827420354f},
-std::array<float,2>{0.157152802f, 0.463952482f},
-std::array<float,2>{0.556138992f, 0.409191102f},
-std::array<float,2>{0.464807212f, 0.767773509f},
-std::array<float,2>{0.820891976f, 0.52086097f},
-std::array<float,2>{0.120069332f, 0.0279909428f},
-std::array<float,2>{0.99928689f, 0.177499115f},
-std::array<float,2>{0.192637682f, 0.654102027f},
-std::array<float,2>{0.715862453f, 0.985675335f},
-std::array<float,2>{0.250794381f, 0.320161462f},
-std::array<float,2>{0.941923261f, 0.337393254f},
-std::array<float,2>{0.232546404f, 0.980224073f},
-std::array<float,2>{0.728753984f, 0.628926575f},
-std::array<float,2>{0.309417427f, 0.157588109f},
-std::array<float,2>{0.502125561f, 0.00902858935f},
-std::array<float,2>{0.490577847f, 0.513632536f},
-std::array<float,2>{0.846156299f, 0.75506109f},
-std::array<float,2>{0.0874091759f, 0.4309735f},
-std::array<float,2>{0.627286851f, 0.450876445f},
-std::array<float,2>{0.333877504f, 0.841078222f},
-std::array<float,2>{0.886517227f, 0.620554566f},
-std::array<float,2>{0.143865839f, 0.0785360634f},
-std::array<float,2>{0.759014785f, 0.223549381f},
-std::array<float,2>{0.00351647637f, 0.705570877f},
-std::array<float,2>{0.58940506f, 0.919477046f},
-std::array<float,2>{0.409061044f, 0.287026554f},
-std::array<float,2>{0.828624249f, 0.404917777f},
-std::array<float,2>{0.105602078f, 0.811028957f},
-std::array<float,2>{0.534225225f, 0.560440898f},
-std::array<float,2>{0.443980634f, 0.0404637195f},
-std::array<float,2>{0.692149162f, 0.154382348f},
-std::array<float,2>{0.280819923f, 0.682852149f},
-std::array<float,2>{0.981609106f, 0.947363257f},
-std::array<float,2>{0.205071911f, 0.351284534f},
-std::array<float,2>{0.602616847f, 0.273856401f},
-std::array<float,2>{0.405245602f, 0.886289239f},
-std::array<float,2>{0.792738378f, 0.72412467f},
-std::array<float,2>{0.0607169047f, 0.214732736f},
-std::array<float,2>{0.917972147f, 0.100982398f},
-std::array<float,2>{0.174554557f, 0.573660254f},
-std::array<float,2>{0.668833733f, 0.846498013f},
-std::array<float,2>{0.372004718f, 0.495569408f},
-std::array<float,2>{0.878667235f, 0.411921233f},
-std::array<float,2>{0.152160063f, 0.771338046f},
-std::array<float,2>{0.633800447f, 0.518487811f},
-std::array<float,2>{0.339592159f, 0.0244162548f},
-std::array<float,2>{0.584577918f, 0.175161988f},
-std::array<float,2>{0.416600287f, 0.651817679f},
-std::array<float,2>{0.757647753f, 0.988415837f},
-std::array<float,2>{0.0124484869f, 0.31379196f},
-std::array<float,2>{0.724588037f, 0.309709638f},
-std::array<float,2>{0.303186893f, 0.926987529f},
-std::array<float,2>{0.952901006f, 0.697705746f},
-std::array<float,2>{0.226380944f, 0.238533288f},
-std::array<float,2>{0.85931319f, 0.0760666579f},
-std::array<float,2>{0.0830738395f, 0.594257712f},
-std::array<float,2>{0.515435696f, 0.820990562f},
-std::array<float,2>{0.497075915f, 0.46604526f},
-std::array<float,2>{0.788716733f, 0.37480399f},
-std::array<float,2>{0.0497493036f, 0.958772302f},
-std::array<float,2>{0.597746015f, 0.657390058f},
-std::array<float,2>{0.395310104f, 0.127425045f},
-std::array<float,2>{0.65811193f, 0.0473253429f},
-std::array<float,2>{0.364706844f, 0.537015319f},
-std::array<float,2>{0.909038961f, 0.787099421f},
-std::array<float,2>{0.184430823f, 0.383901715f},
-std::array<float,2>{0.541271448f, 0.481762648f},
-std::array<float,2>{0.447017699f, 0.869031012f},
-std::array<float,2>{0.842031896f, 0.589865446f},
-std::array<float,2>{0.100753039f, 0.115554504f},
-std::array<float,2>{0.972234666f, 0.199797392f},
-std::array<float,2>{0.212756619f, 0.738172054f},
-std::array<float,2>{0.69950068f, 0.895391107f},
-std::array<float,2>{0.268376291f, 0.263364017f},
-std::array<float,2>{0.965412855f, 0.279112935f},
-std::array<float,2>{0.239777818f, 0.88738209f},
-std::array<float,2>{0.741926014f, 0.719421804f},
-std::array<float,2>{0.283435911f, 0.215534315f},
-std::array<float,2>{0.518864989f, 0.0962521061f},
-std::array<float,2>{0.477639198f, 0.574602604f},
-std::array<float,2>{0.870414197f, 0.850948334f},
-std::array<float,2>{0.0640095174f, 0.497806668f},
-std::array<float,2>{0.656005859f, 0.398449123f},
-std::array<float,2>{0.314195991f, 0.805022359f},
-std::array<float,2>{0.903277695f, 0.55771184f},
-std::array<float,2>{0.136429667f, 0.0458270796f},
-std::array<float,2>{0.780844331f, 0.151102394f},
-std::array<float,2>{0.0253570955f, 0.684355319f},
-std::array<float,2>{0.565913796f, 0.949220419f},
-std::array<float,2>{0.429065764f, 0.347448289f},
-std::array<float,2>{0.815998197f, 0.448971868f},
-std::array<float,2>{0.110097349f, 0.838861287f},
-std::array<float,2>{0.547768354f, 0.621242285f},
-std::array<float,2>{0.460639894f, 0.085090898f},
-std::array<float,2>{0.70608902f, 0.219970956f},
-std::array<float,2>{0.260950267f, 0.709200621f},
-std::array<float,2>{0.990792513f, 0.917551398f},
-std::array<float,2>{0.198583513f, 0.283747852f},
-std::array<float,2>{0.610806823f, 0.34351337f},
-std::array<float,2>{0.384093016f, 0.980642617f},
-std::array<float,2>{0.799617052f, 0.62842828f},
-std::array<float,2>{0.0455173366f, 0.163720906f},
-std::array<float,2>{0.934451461f, 0.0153706037f},
-std::array<float,2>{0.171554253f, 0.509952962f},
-std::array<float,2>{0.68291539f, 0.751446843f},
-std::array<float,2>{0.357192814f, 0.435211003f},
-std::array<float,2>{0.992270887f, 0.487071246f},
-std::array<float,2>{0.187987953f, 0.854514897f},
-std::array<float,2>{0.712908506f, 0.566673815f},
-std::array<float,2>{0.25474146f, 0.107798442f},
-std::array<float,2>{0.560407162f, 0.204280376f},
-std::array<float,2>{0.468315601f, 0.730968237f},
-std::array<float,2>{0.827251077f, 0.881825924f},
-std::array<float,2>{0.124115437f, 0.26592356f},
-std::array<float,2>{0.678195119f, 0.354648858f},
-std::array<float,2>{0.348132312f, 0.943433344f},
-std::array<float,2>{0.928591311f, 0.673943758f},
-std::array<float,2>{0.160210133f, 0.141819865f},
-std::array<float,2>{0.810731173f, 0.0313635804f},
-std::array<float,2>{0.0376306735f, 0.547815144f},
-std::array<float,2>{0.620087922f, 0.802678645f},
-std::array<float,2>{0.375186384f, 0.397735775f},
-std::array<float,2>{0.863636434f, 0.289098591f},
-std::array<float,2>{0.0757141337f, 0.910474002f},
-std::array<float,2>{0.528262973f, 0.717826545f},
-std::array<float,2>{0.471654236f, 0.227457017f},
-std::array<float,2>{0.743725419f, 0.0888448358f},
-std::array<float,2>{0.29480511f, 0.612901747f},
-std::array<float,2>{0.954215407f, 0.828220844f},
-std::array<float,2>{0.248791084f, 0.441886902f},
-std::array<float,2>{0.570809424f, 0.422264576f},
-std::array<float,2>{0.434908628f, 0.76151979f},
-std::array<float,2>{0.770524979f, 0.507086337f},
-std::array<float,2>{0.0206190832f, 0.000636052224f},
-std::array<float,2>{0.89103514f, 0.167624101f},
-std::array<float,2>{0.12896356f, 0.639090955f},
-std::array<float,2>{0.645241857f, 0.969742298f},
-std::array<float,2>{0.325230896f, 0.328413397f},
-std::array<float,2>{0.917093396f, 0.327993721f},
-std::array<float,2>{0.176244095f, 0.993882895f},
-std::array<float,2>{0.665563107f, 0.646955431f},
-std::array<float,2>{0.369112521f, 0.181302741f},
-std::array<float,2>{0.607969463f, 0.016968552f},
-std::array<float,2>{0.401300371f, 0.530416071f},
-std::array<float,2>{0.795472324f, 0.776029348f},
-std::array<float,2>{0.0563652068f, 0.418898851f},
-std::array<float,2>{0.69076097f, 0.453597873f},
-std::array<float,2>{0.273704708f, 0.819157004f},
-std::array<float,2>{0.978859127f, 0.602082491f},
-std::array<float,2>{0.208762214f, 0.0661361963f},
-std::array<float,2>{0.835685134f, 0.242369771f},
-std::array<float,2>{0.104468457f, 0.69404f},
-std::array<float,2>{0.538773417f, 0.931822896f},
-std::array<float,2>{0.438558459f, 0.297229677f},
-std::array<float,2>{0.763506114f, 0.381827056f},
-std::array<float,2>{0.0058930763f, 0.79340744f},
-std::array<float,2>{0.591039121f, 0.54535526f},
-std::array<float,2>{0.411231309f, 0.0617746599f},
-std::array<float,2>{0.630156875f, 0.136040181f},
-std::array<float,2>{0.330365241f, 0.670075595f},
-std::array<float,2>{0.890393198f, 0.96687609f},
-std::array<float,2>{0.145378724f, 0.366159379f},
-std::array<float,2>{0.506468177f, 0.256822318f},
-std::array<float,2>{0.484674871f, 0.906236589f},
-std::array<float,2>{0.851026773f, 0.746362269f},
-std::array<float,2>{0.0916268602f, 0.190079167f},
-std::array<float,2>{0.940015614f, 0.121676035f},
-std::array<float,2>{0.227584794f, 0.580354154f},
-std::array<float,2>{0.733486891f, 0.866746664f},
-std::array<float,2>{0.306660891f, 0.469226986f},
-std::array<float,2>{0.948841751f, 0.392849505f},
-std::array<float,2>{0.219144613f, 0.800358653f},
-std::array<float,2>{0.719492197f, 0.551627159f},
-std::array<float,2>{0.299067289f, 0.03855858f},
-std::array<float,2>{0.511524439f, 0.145809591f},
-std::array<float,2>{0.49486959f, 0.678338766f},
-std::array<float,2>{0.852168858f, 0.938060522f},
-std::array<float,2>{0.0815960988f, 0.358793378f},
-std::array<float,2>{0.637500763f, 0.270088136f},
-std::array<float,2>{0.342043847f, 0.876330435f},
-std::array<float,2>{0.881059945f, 0.72787267f},
-std::array<float,2>{0.152779981f, 0.210497513f},
-std::array<float,2>{0.751738966f, 0.10185533f},
-std::array<float,2>{0.00792388618f, 0.564358652f},
-std::array<float,2>{0.579540253f, 0.857101202f},
-std::array<float,2>{0.42066291f, 0.490432084f},
-std::array<float,2>{0.839684367f, 0.332645148f},
-std::array<float,2>{0.0976071879f, 0.97548604f},
-std::array<float,2>{0.54554069f, 0.636120558f},
-std::array<float,2>{0.45096758f, 0.170547441f},
-std::array<float,2>{0.698793292f, 0.00556644611f},
-std::array<float,2>{0.269582599f, 0.501750171f},
-std::array<float,2>{0.974500835f, 0.76304239f},
-std::array<float,2>{0.216139853f, 0.427650005f},
-std::array<float,2>{0.595253229f, 0.437873691f},
-std::array<float,2>{0.393298626f, 0.832973063f},
-std::array<float,2>{0.783378422f, 0.614218295f},
-std::array<float,2>{0.0525055192f, 0.0906243026f},
-std::array<float,2>{0.912647665f, 0.232822046f},
-std::array<float,2>{0.179870054f, 0.711012661f},
-std::array<float,2>{0.660200119f, 0.908941627f},
-std::array<float,2>{0.360776067f, 0.293940604f},
-std::array<float,2>{0.901951134f, 0.301222801f},
-std::array<float,2>{0.139307722f, 0.935753465f},
-std::array<float,2>{0.652332842f, 0.687818766f},
-std::array<float,2>{0.31654942f, 0.248556778f},
-std::array<float,2>{0.56822288f, 0.070037961f},
-std::array<float,2>{0.425207794f, 0.606810629f},
-std::array<float,2>{0.77473402f, 0.815996468f},
-std::array<float,2>{0.0274283681f, 0.458235502f},
-std::array<float,2>{0.737386525f, 0.416006982f},
-std::array<float,2>{0.28897664f, 0.780263245f},
-std::array<float,2>{0.964624465f, 0.524055898f},
-std::array<float,2>{0.236218721f, 0.0229094215f},
-std::array<float,2>{0.87359941f, 0.187330067f},
-std::array<float,2>{0.0675915852f, 0.643079937f},
-std::array<float,2>{0.522929311f, 0.99629128f},
-std::array<float,2>{0.483763278f, 0.323271394f},
-std::array<float,2>{0.803445458f, 0.474509537f},
-std::array<float,2>{0.0407597907f, 0.862941861f},
-std::array<float,2>{0.617103159f, 0.584512711f},
-std::array<float,2>{0.387778699f, 0.120839968f},
-std::array<float,2>{0.686239481f, 0.191774756f},
-std::array<float,2>{0.355188549f, 0.742431104f},
-std::array<float,2>{0.930437565f, 0.901081324f},
-std::array<float,2>{0.167578459f, 0.252870947f},
-std::array<float,2>{0.553145468f, 0.363149881f},
-std::array<float,2>{0.454180688f, 0.964460969f},
-std::array<float,2>{0.817661643f, 0.664326608f},
-std::array<float,2>{0.11577715f, 0.140146837f},
-std::array<float,2>{0.985018194f, 0.0581619591f},
-std::array<float,2>{0.200447768f, 0.540381968f},
-std::array<float,2>{0.707359493f, 0.792829692f},
-std::array<float,2>{0.263792455f, 0.377013892f},
-std::array<float,2>{0.923629463f, 0.462042004f},
-std::array<float,2>{0.159847111f, 0.825864553f},
-std::array<float,2>{0.672542632f, 0.601052642f},
-std::array<float,2>{0.344642937f, 0.0727662072f},
-std::array<float,2>{0.62261492f, 0.235238433f},
-std::array<float,2>{0.381546378f, 0.699532986f},
-std::array<float,2>{0.806021512f, 0.922446549f},
-std::array<float,2>{0.0322279409f, 0.3082183f},
-std::array<float,2>{0.718689024f, 0.317326874f},
-std::array<float,2>{0.253678888f, 0.98764956f},
-std::array<float,2>{0.997211635f, 0.654693902f},
-std::array<float,2>{0.193572998f, 0.179621741f},
-std::array<float,2>{0.823739767f, 0.0312443115f},
-std::array<float,2>{0.11844679f, 0.523165286f},
-std::array<float,2>{0.557990193f, 0.767168999f},
-std::array<float,2>{0.460990369f, 0.407957256f},
-std::array<float,2>{0.76710856f, 0.259696513f},
-std::array<float,2>{0.0172715168f, 0.891037524f},
-std::array<float,2>{0.57645458f, 0.741008639f},
-std::array<float,2>{0.433075458f, 0.197059169f},
-std::array<float,2>{0.640770972f, 0.109821118f},
-std::array<float,2>{0.323440224f, 0.58690393f},
-std::array<float,2>{0.896569967f, 0.872770131f},
-std::array<float,2>{0.128709778f, 0.47839424f},
-std::array<float,2>{0.52404511f, 0.386825502f},
-std::array<float,2>{0.475794137f, 0.783925176f},
-std::array<float,2>{0.861905754f, 0.533052266f},
-std::array<float,2>{0.0740625337f, 0.0529994965f},
-std::array<float,2>{0.958334506f, 0.130886599f},
-std::array<float,2>{0.244115829f, 0.66282171f},
-std::array<float,2>{0.747659981f, 0.955840468f},
-std::array<float,2>{0.289598942f, 0.370887369f},
-std::array<float,2>{0.983051717f, 0.348078281f},
-std::array<float,2>{0.205940738f, 0.946989179f},
-std::array<float,2>{0.694608808f, 0.680399418f},
-std::array<float,2>{0.27923879f, 0.153549895f},
-std::array<float,2>{0.532955766f, 0.0420591868f},
-std::array<float,2>{0.44261843f, 0.562159956f},
-std::array<float,2>{0.830990374f, 0.80866462f},
-std::array<float,2>{0.107758388f, 0.402555525f},
-std::array<float,2>{0.671181917f, 0.492630243f},
-std::array<float,2>{0.374042481f, 0.845049679f},
-std::array<float,2>{0.921206832f, 0.571572781f},
-std::array<float,2>{0.172109023f, 0.097977221f},
-std::array<float,2>{0.790438533f, 0.211715311f},
-std::array<float,2>{0.0603276677f, 0.726180613f},
-std::array<float,2>{0.605069041f, 0.884497404f},
-std::array<float,2>{0.403989017f, 0.275664806f},
-std::array<float,2>{0.845695198f, 0.432870567f},
-std::array<float,2>{0.0890344903f, 0.756831765f},
-std::array<float,2>{0.501214564f, 0.51526165f},
-std::array<float,2>{0.489739388f, 0.0108467145f},
-std::array<float,2>{0.727321565f, 0.158247262f},
-std::array<float,2>{0.31111908f, 0.631767154f},
-std::array<float,2>{0.944383442f, 0.976774752f},
-std::array<float,2>{0.232369334f, 0.338073015f},
-std::array<float,2>{0.587632954f, 0.28771162f},
-std::array<float,2>{0.406873703f, 0.920126796f},
-std::array<float,2>{0.75985992f, 0.703435719f},
-std::array<float,2>{0.00194204855f, 0.226159766f},
-std::array<float,2>{0.884001136f, 0.0814599991f},
-std::array<float,2>{0.141235441f, 0.618206859f},
-std::array<float,2>{0.626553714f, 0.841897786f},
-std::array<float,2>{0.335076988f, 0.452993602f},
-std::array<float,2>{0.904121876f, 0.400639176f},
-std::array<float,2>{0.134990185f, 0.807590902f},
-std::array<float,2>{0.654333115f, 0.55573225f},
-std::array<float,2>{0.31269002f, 0.0438002869f},
-std::array<float,2>{0.564853847f, 0.148791537f},
-std::array<float,2>{0.427894145f, 0.68621707f},
-std::array<float,2>{0.779559612f, 0.953045249f},
-std::array<float,2>{0.0241177212f, 0.344577223f},
-std::array<float,2>{0.740643024f, 0.281178445f},
-std::array<float,2>{0.284627706f, 0.890546024f},
-std::array<float,2>{0.966763616f, 0.72210139f},
-std::array<float,2>{0.238686755f, 0.21803835f},
-std::array<float,2>{0.869163096f, 0.0944300517f},
-std::array<float,2>{0.0633514151f, 0.578094244f},
-std::array<float,2>{0.518069506f, 0.84796977f},
-std::array<float,2>{0.476765484f, 0.498981446f},
-std::array<float,2>{0.799973607f, 0.341416746f},
-std::array<float,2>{0.0466306396f, 0.982818902f},
-std::array<float,2>{0.609834075f, 0.625128627f},
-std::array<float,2>{0.383726627f, 0.16195713f},
-std::array<float,2>{0.681761324f, 0.0124920504f},
-std::array<float,2>{0.355700046f, 0.508951962f},
-std::array<float,2>{0.93541193f, 0.753165007f},
-std::array<float,2>{0.170110032f, 0.43686825f},
-std::array<float,2>{0.548511386f, 0.446071923f},
-std::array<float,2>{0.459363848f, 0.837525189f},
-std::array<float,2>{0.814456403f, 0.623795986f},
-std::array<float,2>{0.110738255f, 0.0838363543f},
-std::array<float,2>{0.992092848f, 0.222381115f},
-std::array<float,2>{0.197802946f, 0.708650649f},
-std::array<float,2>{0.705972433f, 0.914461076f},
-std::array<float,2>{0.260605037f, 0.282248974f},
-std::array<float,2>{0.951462328f, 0.31163007f},
-std::array<float,2>{0.22547853f, 0.929334223f},
-std::array<float,2>{0.722886741f, 0.696475446f},
-std::array<float,2>{0.304266602f, 0.242032737f},
-std::array<float,2>{0.514099181f, 0.0772601292f},
-std::array<float,2>{0.496364623f, 0.597416162f},
-std::array<float,2>{0.857686698f, 0.824063897f},
-std::array<float,2>{0.0829005986f, 0.46847567f},
-std::array<float,2>{0.632956743f, 0.412163854f},
-std::array<float,2>{0.337941915f, 0.773231685f},
-std::array<float,2>{0.877190769f, 0.515822411f},
-std::array<float,2>{0.151283249f, 0.0260125101f},
-std::array<float,2>{0.75670433f, 0.172072053f},
-std::array<float,2>{0.0136486525f, 0.648635805f},
-std::array<float,2>{0.585783005f, 0.992162704f},
-std::array<float,2>{0.417320877f, 0.315323502f},
-std::array<float,2>{0.842796326f, 0.48260206f},
-std::array<float,2>{0.0999973342f, 0.869300544f},
-std::array<float,2>{0.542920291f, 0.593028903f},
-std::array<float,2>{0.445541471f, 0.113815628f},
-std::array<float,2>{0.700576484f, 0.202718005f},
-std::array<float,2>{0.268598408f, 0.735645235f},
-std::array<float,2>{0.971320152f, 0.897459269f},
-std::array<float,2>{0.211523846f, 0.264486849f},
-std::array<float,2>{0.599081159f, 0.372758985f},
-std::array<float,2>{0.396026909f, 0.960680306f},
-std::array<float,2>{0.787729681f, 0.659859061f},
-std::array<float,2>{0.0502787232f, 0.125634179f},
-std::array<float,2>{0.910049677f, 0.0496623479f},
-std::array<float,2>{0.184773371f, 0.537305892f},
-std::array<float,2>{0.656575263f, 0.788313389f},
-std::array<float,2>{0.363398701f, 0.38534835f},
-std::array<float,2>{0.980162263f, 0.455583006f},
-std::array<float,2>{0.207220107f, 0.817747831f},
-std::array<float,2>{0.690411091f, 0.604406357f},
-std::array<float,2>{0.275369853f, 0.0628166869f},
-std::array<float,2>{0.537612498f, 0.244556576f},
-std::array<float,2>{0.437923878f, 0.691815615f},
-std::array<float,2>{0.834519386f, 0.930707633f},
-std::array<float,2>{0.105390608f, 0.299564272f},
-std::array<float,2>{0.66486454f, 0.325429618f},
-std::array<float,2>{0.367740482f, 0.995638907f},
-std::array<float,2>{0.916698098f, 0.645581424f},
-std::array<float,2>{0.17704992f, 0.181932196f},
-std::array<float,2>{0.796090662f, 0.0192515645f},
-std::array<float,2>{0.0551827997f, 0.528389037f},
-std::array<float,2>{0.60886097f, 0.774694562f},
-std::array<float,2>{0.402088046f, 0.420914739f},
-std::array<float,2>{0.850048482f, 0.254109919f},
-std::array<float,2>{0.0900720805f, 0.903116763f},
-std::array<float,2>{0.506978214f, 0.749593019f},
-std::array<float,2>{0.486202717f, 0.189237669f},
-std::array<float,2>{0.732642829f, 0.124101713f},
-std::array<float,2>{0.307849884f, 0.579601407f},
-std::array<float,2>{0.941072166f, 0.864350379f},
-std::array<float,2>{0.227456763f, 0.472483039f},
-std::array<float,2>{0.590594351f, 0.379538089f},
-std::array<float,2>{0.410571903f, 0.795802593f},
-std::array<float,2>{0.762479842f, 0.543869019f},
-std::array<float,2>{0.00732122036f, 0.0605131537f},
-std::array<float,2>{0.889399529f, 0.133024171f},
-std::array<float,2>{0.14614816f, 0.669069529f},
-std::array<float,2>{0.629801214f, 0.965878963f},
-std::array<float,2>{0.331863672f, 0.364288539f},
-std::array<float,2>{0.929515481f, 0.351597726f},
-std::array<float,2>{0.161968723f, 0.942106724f},
-std::array<float,2>{0.678741693f, 0.67313832f},
-std::array<float,2>{0.349048138f, 0.143840984f},
-std::array<float,2>{0.620195925f, 0.0341337956f},
-std::array<float,2>{0.376897335f, 0.550239503f},
-std::array<float,2>{0.812198579f, 0.803878129f},
-std::array<float,2>{0.0382500738f, 0.396320641f},
-std::array<float,2>{0.714254797f, 0.484389871f},
-std::array<float,2>{0.255820841f, 0.85351491f},
-std::array<float,2>{0.993837118f, 0.570234239f},
-std::array<float,2>{0.189397305f, 0.106740676f},
-std::array<float,2>{0.826954246f, 0.206106335f},
-std::array<float,2>{0.123071648f, 0.733839989f},
-std::array<float,2>{0.559404135f, 0.879372895f},
-std::array<float,2>{0.467095643f, 0.268949598f},
-std::array<float,2>{0.77036947f, 0.423960507f},
-std::array<float,2>{0.0203569848f, 0.758570194f},
-std::array<float,2>{0.572053373f, 0.50564456f},
-std::array<float,2>{0.433854759f, 0.00374076352f},
-std::array<float,2>{0.645706415f, 0.165708065f},
-std::array<float,2>{0.325061858f, 0.637996733f},
-std::array<float,2>{0.89181757f, 0.971941352f},
-std::array<float,2>{0.130751088f, 0.331939429f},
-std::array<float,2>{0.528669953f, 0.291486681f},
-std::array<float,2>{0.472034693f, 0.91211617f},
-std::array<float,2>{0.864946306f, 0.714904845f},
-std::array<float,2>{0.0751743764f, 0.228916109f},
-std::array<float,2>{0.953282118f, 0.0862090364f},
-std::array<float,2>{0.249364361f, 0.611169338f},
-std::array<float,2>{0.742984414f, 0.830504358f},
-std::array<float,2>{0.293126255f, 0.444772691f},
-std::array<float,2>{0.963006258f, 0.416678637f},
-std::array<float,2>{0.234483883f, 0.77766484f},
-std::array<float,2>{0.736871481f, 0.526540518f},
-std::array<float,2>{0.287829548f, 0.0211363994f},
-std::array<float,2>{0.522429287f, 0.184605822f},
-std::array<float,2>{0.483150601f, 0.641346097f},
-std::array<float,2>{0.874176264f, 0.998161972f},
-std::array<float,2>{0.066676937f, 0.320918471f},
-std::array<float,2>{0.650919318f, 0.304369211f},
-std::array<float,2>{0.31798169f, 0.934989393f},
-std::array<float,2>{0.900964081f, 0.689997852f},
-std::array<float,2>{0.140056744f, 0.246259749f},
-std::array<float,2>{0.773599148f, 0.0679908469f},
-std::array<float,2>{0.0283617061f, 0.608311236f},
-std::array<float,2>{0.566450477f, 0.81298852f},
-std::array<float,2>{0.424476206f, 0.460278124f},
-std::array<float,2>{0.81703198f, 0.360975355f},
-std::array<float,2>{0.116975948f, 0.962204397f},
-std::array<float,2>{0.55410856f, 0.666545868f},
-std::array<float,2>{0.453609735f, 0.137216568f},
-std::array<float,2>{0.708778441f, 0.055323679f},
-std::array<float,2>{0.264721513f, 0.542311549f},
-std::array<float,2>{0.986307025f, 0.789853692f},
-std::array<float,2>{0.199302405f, 0.375267059f},
-std::array<float,2>{0.616103947f, 0.474918991f},
-std::array<float,2>{0.387449384f, 0.860764086f},
-std::array<float,2>{0.804454982f, 0.582148552f},
-std::array<float,2>{0.0399747156f, 0.118094057f},
-std::array<float,2>{0.931242228f, 0.19487223f},
-std::array<float,2>{0.16611065f, 0.74497503f},
-std::array<float,2>{0.687290549f, 0.89890039f},
-std::array<float,2>{0.353852302f, 0.251193076f},
-std::array<float,2>{0.882138312f, 0.272009015f},
-std::array<float,2>{0.153659254f, 0.877385318f},
-std::array<float,2>{0.638506174f, 0.728663623f},
-std::array<float,2>{0.343682766f, 0.208030477f},
-std::array<float,2>{0.5789873f, 0.104289882f},
-std::array<float,2>{0.421157837f, 0.565787137f},
-std::array<float,2>{0.75058347f, 0.857687116f},
-std::array<float,2>{0.00957734883f, 0.489238203f},
-std::array<float,2>{0.72005564f, 0.39190039f},
-std::array<float,2>{0.300024003f, 0.797655821f},
-std::array<float,2>{0.947927594f, 0.553692758f},
-std::array<float,2>{0.219887912f, 0.036486607f},
-std::array<float,2>{0.852924049f, 0.148390234f},
-std::array<float,2>{0.0803516954f, 0.676454186f},
-std::array<float,2>{0.510229409f, 0.94005686f},
-std::array<float,2>{0.495226413f, 0.355969101f},
-std::array<float,2>{0.784482002f, 0.440685451f},
-std::array<float,2>{0.0516859666f, 0.835239828f},
-std::array<float,2>{0.594292819f, 0.616129756f},
-std::array<float,2>{0.394282132f, 0.093704693f},
-std::array<float,2>{0.661811769f, 0.232164174f},
-std::array<float,2>{0.359710544f, 0.714033127f},
-std::array<float,2>{0.913972616f, 0.907669246f},
-std::array<float,2>{0.181622609f, 0.296371579f},
-std::array<float,2>{0.546037912f, 0.334673226f},
-std::array<float,2>{0.449711114f, 0.97437495f},
-std::array<float,2>{0.837897778f, 0.634304106f},
-std::array<float,2>{0.0964624733f, 0.168274701f},
-std::array<float,2>{0.972664475f, 0.00748406956f},
-std::array<float,2>{0.215093642f, 0.502718925f},
-std::array<float,2>{0.697490811f, 0.764298022f},
-std::array<float,2>{0.270712137f, 0.427878231f},
-std::array<float,2>{0.920175374f, 0.494485885f},
-std::array<float,2>{0.173039883f, 0.847340882f},
-std::array<float,2>{0.670229137f, 0.572293878f},
-std::array<float,2>{0.37401107f, 0.0997950062f},
-std::array<float,2>{0.604335129f, 0.213422999f},
-std::array<float,2>{0.403079897f, 0.723289847f},
-std::array<float,2>{0.789442658f, 0.885261118f},
-std::array<float,2>{0.0591706559f, 0.274455577f},
-std::array<float,2>{0.693597257f, 0.350543052f},
-std::array<float,2>{0.277675092f, 0.948476076f},
-std::array<float,2>{0.984199762f, 0.68219471f},
-std::array<float,2>{0.206608221f, 0.155559346f},
-std::array<float,2>{0.831431508f, 0.0392154157f},
-std::array<float,2>{0.10901951f, 0.559274316f},
-std::array<float,2>{0.531651497f, 0.812162995f},
-std::array<float,2>{0.442095876f, 0.405896008f},
-std::array<float,2>{0.761667728f, 0.285707116f},
-std::array<float,2>{0.000880595006f, 0.918073773f},
-std::array<float,2>{0.586853325f, 0.706055343f},
-std::array<float,2>{0.407656074f, 0.224425063f},
-std::array<float,2>{0.625357866f, 0.0793375149f},
-std::array<float,2>{0.334409624f, 0.61962533f},
-std::array<float,2>{0.88285923f, 0.840302706f},
-std::array<float,2>{0.142122194f, 0.449877173f},
-std::array<float,2>{0.500719428f, 0.430477381f},
-std::array<float,2>{0.488530725f, 0.754243731f},
-std::array<float,2>{0.844103813f, 0.512624323f},
-std::array<float,2>{0.0880593881f, 0.00814836286f},
-std::array<float,2>{0.943884611f, 0.157041684f},
-std::array<float,2>{0.230771169f, 0.630655766f},
-std::array<float,2>{0.728383362f, 0.979402363f},
-std::array<float,2>{0.312034398f, 0.336055279f},
-std::array<float,2>{0.996900439f, 0.318635792f},
-std::array<float,2>{0.194902688f, 0.984761655f},
-std::array<float,2>{0.717282832f, 0.653236985f},
-std::array<float,2>{0.252233237f, 0.176526457f},
-std::array<float,2>{0.556643486f, 0.0284915138f},
-std::array<float,2>{0.462684184f, 0.519604206f},
-std::array<float,2>{0.822902501f, 0.76901871f},
-std::array<float,2>{0.117854439f, 0.409001291f},
-std::array<float,2>{0.673521399f, 0.463124216f},
-std::array<float,2>{0.345457554f, 0.827075541f},
-std::array<float,2>{0.92256391f, 0.598550558f},
-std::array<float,2>{0.159014657f, 0.0707657188f},
-std::array<float,2>{0.805235207f, 0.237979427f},
-std::array<float,2>{0.0316266343f, 0.703102529f},
-std::array<float,2>{0.621242702f, 0.924978852f},
-std::array<float,2>{0.381879985f, 0.306551218f},
-std::array<float,2>{0.863093615f, 0.390225202f},
-std::array<float,2>{0.0723822489f, 0.782896459f},
-std::array<float,2>{0.524833679f, 0.533864141f},
-std::array<float,2>{0.474680394f, 0.0517228879f},
-std::array<float,2>{0.746834099f, 0.129831195f},
-std::array<float,2>{0.290060252f, 0.661564708f},
-std::array<float,2>{0.957101166f, 0.953634322f},
-std::array<float,2>{0.242391527f, 0.368743956f},
-std::array<float,2>{0.577352464f, 0.260429502f},
-std::array<float,2>{0.432516545f, 0.893950462f},
-std::array<float,2>{0.766224742f, 0.739695668f},
-std::array<float,2>{0.0165325254f, 0.199155688f},
-std::array<float,2>{0.89758122f, 0.113081172f},
-std::array<float,2>{0.127904207f, 0.589213192f},
-std::array<float,2>{0.642063141f, 0.873560488f},
-std::array<float,2>{0.323022455f, 0.479719669f},
-std::array<float,2>{0.935956657f, 0.434505165f},
-std::array<float,2>{0.1690844f, 0.750030339f},
-std::array<float,2>{0.681096256f, 0.511709273f},
-std::array<float,2>{0.358969361f, 0.0139739839f},
-std::array<float,2>{0.611788452f, 0.16261223f},
-std::array<float,2>{0.386436552f, 0.627332509f},
-std::array<float,2>{0.798144877f, 0.982322991f},
-std::array<float,2>{0.0432694629f, 0.341982245f},
-std::array<float,2>{0.703484356f, 0.284199655f},
-std::array<float,2>{0.258826375f, 0.916538596f},
-std::array<float,2>{0.989544392f, 0.710741818f},
-std::array<float,2>{0.1953675f, 0.2193501f},
-std::array<float,2>{0.812953711f, 0.0841712505f},
-std::array<float,2>{0.112235285f, 0.622860551f},
-std::array<float,2>{0.549427927f, 0.83937484f},
-std::array<float,2>{0.458921075f, 0.447660178f},
-std::array<float,2>{0.777528584f, 0.346316367f},
-std::array<float,2>{0.026231207f, 0.950829744f},
-std::array<float,2>{0.56368345f, 0.684814215f},
-std::array<float,2>{0.427634269f, 0.151806474f},
-std::array<float,2>{0.65424335f, 0.0459067076f},
-std::array<float,2>{0.314733297f, 0.557413876f},
-std::array<float,2>{0.905694723f, 0.806496739f},
-std::array<float,2>{0.133790955f, 0.399698317f},
-std::array<float,2>{0.517242908f, 0.496857524f},
-std::array<float,2>{0.479826272f, 0.84984231f},
-std::array<float,2>{0.867557943f, 0.57539773f},
-std::array<float,2>{0.0653293505f, 0.0972968787f},
-std::array<float,2>{0.968311131f, 0.216744944f},
-std::array<float,2>{0.240263253f, 0.719798744f},
-std::array<float,2>{0.740039706f, 0.888531923f},
-std::array<float,2>{0.282809943f, 0.277488947f},
-std::array<float,2>{0.970044494f, 0.26218307f},
-std::array<float,2>{0.213782147f, 0.896009862f},
-std::array<float,2>{0.702124953f, 0.736756861f},
-std::array<float,2>{0.267476469f, 0.200342506f},
-std::array<float,2>{0.539137065f, 0.116887823f},
-std::array<float,2>{0.448764205f, 0.591018975f},
-std::array<float,2>{0.841669202f, 0.867502272f},
-std::array<float,2>{0.0990832075f, 0.480739802f},
-std::array<float,2>{0.659651756f, 0.383384705f},
-std::array<float,2>{0.366048157f, 0.785664201f},
-std::array<float,2>{0.907776415f, 0.536011279f},
-std::array<float,2>{0.18554768f, 0.0482797846f},
-std::array<float,2>{0.786420166f, 0.128625095f},
-std::array<float,2>{0.0473967455f, 0.656391919f},
-std::array<float,2>{0.601519883f, 0.957371533f},
-std::array<float,2>{0.396623284f, 0.373224556f},
-std::array<float,2>{0.855846286f, 0.465521097f},
-std::array<float,2>{0.0840913355f, 0.821533144f},
-std::array<float,2>{0.513216794f, 0.595491111f},
-std::array<float,2>{0.498200148f, 0.0743826106f},
-std::array<float,2>{0.725949049f, 0.239727855f},
-std::array<float,2>{0.302552968f, 0.698505223f},
-std::array<float,2>{0.949537396f, 0.926408887f},
-std::array<float,2>{0.223919928f, 0.308984727f},
-std::array<float,2>{0.583727121f, 0.312519759f},
-std::array<float,2>{0.415141493f, 0.989376783f},
-std::array<float,2>{0.754166782f, 0.650680006f},
-std::array<float,2>{0.0152560603f, 0.174590781f},
-std::array<float,2>{0.876584113f, 0.0234836545f},
-std::array<float,2>{0.148622915f, 0.518908381f},
-std::array<float,2>{0.634971499f, 0.769826949f},
-std::array<float,2>{0.336817026f, 0.410406858f},
-std::array<float,2>{0.939203143f, 0.470210731f},
-std::array<float,2>{0.228960037f, 0.865662217f},
-std::array<float,2>{0.732208431f, 0.581150711f},
-std::array<float,2>{0.306537598f, 0.122146897f},
-std::array<float,2>{0.505692244f, 0.190501049f},
-std::array<float,2>{0.487466574f, 0.747528613f},
-std::array<float,2>{0.849559665f, 0.904488564f},
-std::array<float,2>{0.0919119194f, 0.257093728f},
-std::array<float,2>{0.632416844f, 0.366737276f},
-std::array<float,2>{0.328707576f, 0.968506575f},
-std::array<float,2>{0.887778342f, 0.671462476f},
-std::array<float,2>{0.147987843f, 0.135332257f},
-std::array<float,2>{0.765111804f, 0.0609572232f},
-std::array<float,2>{0.0046869996f, 0.545923889f},
-std::array<float,2>{0.592426777f, 0.793966711f},
-std::array<float,2>{0.4126831f, 0.381951302f},
-std::array<float,2>{0.8335886f, 0.298529118f},
-std::array<float,2>{0.101979442f, 0.932960927f},
-std::array<float,2>{0.535951793f, 0.695280075f},
-std::array<float,2>{0.440037578f, 0.243783742f},
-std::array<float,2>{0.687610447f, 0.0651133507f},
-std::array<float,2>{0.276618749f, 0.602787435f},
-std::array<float,2>{0.977432966f, 0.819897294f},
-std::array<float,2>{0.210396931f, 0.454211801f},
-std::array<float,2>{0.60629499f, 0.419427395f},
-std::array<float,2>{0.400267422f, 0.776480973f},
-std::array<float,2>{0.794909894f, 0.529711246f},
-std::array<float,2>{0.0581521504f, 0.0156495813f},
-std::array<float,2>{0.91548264f, 0.180007681f},
-std::array<float,2>{0.177759081f, 0.647958815f},
-std::array<float,2>{0.666862547f, 0.992536187f},
-std::array<float,2>{0.369352788f, 0.326833338f},
-std::array<float,2>{0.893032968f, 0.329222023f},
-std::array<float,2>{0.131024033f, 0.969280839f},
-std::array<float,2>{0.647128582f, 0.639886737f},
-std::array<float,2>{0.327905446f, 0.166105822f},
-std::array<float,2>{0.573858023f, 0.00171735894f},
-std::array<float,2>{0.436861575f, 0.506209016f},
-std::array<float,2>{0.772323668f, 0.760151088f},
-std::array<float,2>{0.0232194103f, 0.423042059f},
-std::array<float,2>{0.744239211f, 0.442548275f},
-std::array<float,2>{0.295110255f, 0.829743981f},
-std::array<float,2>{0.955139577f, 0.612052441f},
-std::array<float,2>{0.248042807f, 0.0894719213f},
-std::array<float,2>{0.865375996f, 0.228275865f},
-std::array<float,2>{0.0767364204f, 0.71708405f},
-std::array<float,2>{0.529888093f, 0.911264956f},
-std::array<float,2>{0.469774097f, 0.290801972f},
-std::array<float,2>{0.810395598f, 0.397435009f},
-std::array<float,2>{0.0352186561f, 0.801613986f},
-std::array<float,2>{0.618185103f, 0.547929585f},
-std::array<float,2>{0.377124786f, 0.0329438187f},
-std::array<float,2>{0.677263856f, 0.141315758f},
-std::array<float,2>{0.350328267f, 0.674903393f},
-std::array<float,2>{0.926116347f, 0.944510162f},
-std::array<float,2>{0.163549587f, 0.354448795f},
-std::array<float,2>{0.560951114f, 0.267566055f},
-std::array<float,2>{0.465120137f, 0.8824687f},
-std::array<float,2>{0.825759292f, 0.732108474f},
-std::array<float,2>{0.122871123f, 0.203651667f},
-std::array<float,2>{0.994617105f, 0.109024085f},
-std::array<float,2>{0.190438986f, 0.567471564f},
-std::array<float,2>{0.71112752f, 0.854243934f},
-std::array<float,2>{0.256397992f, 0.487586468f},
-std::array<float,2>{0.987212598f, 0.378740221f},
-std::array<float,2>{0.202523798f, 0.791126132f},
-std::array<float,2>{0.70966357f, 0.539906204f},
-std::array<float,2>{0.262580127f, 0.056782078f},
-std::array<float,2>{0.551615238f, 0.139403701f},
-std::array<float,2>{0.456436992f, 0.665723383f},
-std::array<float,2>{0.819597065f, 0.963069975f},
-std::array<float,2>{0.113795288f, 0.362162352f},
-std::array<float,2>{0.68446821f, 0.253170222f},
-std::array<float,2>{0.351645887f, 0.901894391f},
-std::array<float,2>{0.93320632f, 0.743295491f},
-std::array<float,2>{0.165806115f, 0.192609951f},
-std::array<float,2>{0.802021861f, 0.119409911f},
-std::array<float,2>{0.0429400094f, 0.585880935f},
-std::array<float,2>{0.614634097f, 0.86144793f},
-std::array<float,2>{0.389250338f, 0.473250121f},
-std::array<float,2>{0.873027503f, 0.322831273f},
-std::array<float,2>{0.068937093f, 0.997764468f},
-std::array<float,2>{0.519894838f, 0.644038737f},
-std::array<float,2>{0.481326759f, 0.185659215f},
-std::array<float,2>{0.735827208f, 0.0222103707f},
-std::array<float,2>{0.285584867f, 0.525342822f},
-std::array<float,2>{0.962723911f, 0.780772269f},
-std::array<float,2>{0.237969726f, 0.414264888f},
-std::array<float,2>{0.569069147f, 0.457952529f},
-std::array<float,2>{0.422702342f, 0.814650118f},
-std::array<float,2>{0.775434971f, 0.605890572f},
-std::array<float,2>{0.0298773907f, 0.0685830563f},
-std::array<float,2>{0.900150061f, 0.24998115f},
-std::array<float,2>{0.13854301f, 0.689164937f},
-std::array<float,2>{0.650163293f, 0.936531186f},
-std::array<float,2>{0.319404364f, 0.301834136f},
-std::array<float,2>{0.91131109f, 0.29412213f},
-std::array<float,2>{0.183591649f, 0.910011411f},
-std::array<float,2>{0.662627161f, 0.712716103f},
-std::array<float,2>{0.362504393f, 0.234091982f},
-std::array<float,2>{0.596377313f, 0.0916491076f},
-std::array<float,2>{0.392033517f, 0.615010083f},
-std::array<float,2>{0.782496691f, 0.833409607f},
-std::array<float,2>{0.0544490963f, 0.438788563f},
-std::array<float,2>{0.69603163f, 0.426535547f},
-std::array<float,2>{0.272746146f, 0.761853099f},
-std::array<float,2>{0.975993693f, 0.500575006f},
-std::array<float,2>{0.217211515f, 0.00470988778f},
-std::array<float,2>{0.837459743f, 0.171462148f},
-std::array<float,2>{0.0946282446f, 0.635180175f},
-std::array<float,2>{0.543815732f, 0.975620031f},
-std::array<float,2>{0.451867551f, 0.333229095f},
-std::array<float,2>{0.753786683f, 0.491403192f},
-std::array<float,2>{0.00982150529f, 0.856215298f},
-std::array<float,2>{0.580885649f, 0.563411772f},
-std::array<float,2>{0.418278724f, 0.102920018f},
-std::array<float,2>{0.639670908f, 0.209457397f},
-std::array<float,2>{0.341237277f, 0.727364898f},
-std::array<float,2>{0.879185557f, 0.875463605f},
-std::array<float,2>{0.155426741f, 0.271410465f},
-std::array<float,2>{0.508977294f, 0.357608348f},
-std::array<float,2>{0.493863821f, 0.938689888f},
-std::array<float,2>{0.854533672f, 0.678913295f},
-std::array<float,2>{0.0783217773f, 0.145311087f},
-std::array<float,2>{0.946033835f, 0.0379843004f},
-std::array<float,2>{0.221711591f, 0.551789582f},
-std::array<float,2>{0.72201997f, 0.799747467f},
-std::array<float,2>{0.297131211f, 0.394496799f},
-std::array<float,2>{0.885103941f, 0.451834708f},
-std::array<float,2>{0.143060371f, 0.843116522f},
-std::array<float,2>{0.628067851f, 0.617630601f},
-std::array<float,2>{0.332948387f, 0.0802522451f},
-std::array<float,2>{0.588662326f, 0.225467727f},
-std::array<float,2>{0.409257591f, 0.704210401f},
-std::array<float,2>{0.758254349f, 0.920989513f},
-std::array<float,2>{0.00235785428f, 0.288680047f},
-std::array<float,2>{0.730012417f, 0.339643449f},
-std::array<float,2>{0.310058206f, 0.97828716f},
-std::array<float,2>{0.942934275f, 0.632080138f},
-std::array<float,2>{0.233684108f, 0.15927583f},
-std::array<float,2>{0.847191989f, 0.0105977198f},
-std::array<float,2>{0.0869052485f, 0.513820946f},
-std::array<float,2>{0.503739715f, 0.757495522f},
-std::array<float,2>{0.492165327f, 0.431692898f},
-std::array<float,2>{0.791716874f, 0.276810735f},
-std::array<float,2>{0.0616668835f, 0.883761704f},
-std::array<float,2>{0.602212667f, 0.72546798f},
-std::array<float,2>{0.405536264f, 0.21222806f},
-std::array<float,2>{0.669042945f, 0.0988448486f},
-std::array<float,2>{0.372537583f, 0.570684552f},
-std::array<float,2>{0.918952525f, 0.844624281f},
-std::array<float,2>{0.175562799f, 0.493849963f},
-std::array<float,2>{0.533854544f, 0.403334051f},
-std::array<float,2>{0.444643676f, 0.810016096f},
-std::array<float,2>{0.830069244f, 0.561448336f},
-std::array<float,2>{0.107296623f, 0.0415389724f},
-std::array<float,2>{0.981171191f, 0.1532626f},
-std::array<float,2>{0.203941628f, 0.680721521f},
-std::array<float,2>{0.692964792f, 0.945896506f},
-std::array<float,2>{0.279743314f, 0.349559605f},
-std::array<float,2>{0.959418118f, 0.370039791f},
-std::array<float,2>{0.245846793f, 0.956199348f},
-std::array<float,2>{0.749527276f, 0.663700938f},
-std::array<float,2>{0.292777628f, 0.132803291f},
-std::array<float,2>{0.526486218f, 0.0539683662f},
-std::array<float,2>{0.473267943f, 0.531934798f},
-std::array<float,2>{0.860987484f, 0.78455323f},
-std::array<float,2>{0.0715416968f, 0.387985498f},
-std::array<float,2>{0.643838644f, 0.477189302f},
-std::array<float,2>{0.321526885f, 0.871124625f},
-std::array<float,2>{0.895851791f, 0.587063968f},
-std::array<float,2>{0.126166239f, 0.110358715f},
-std::array<float,2>{0.768680215f, 0.195442364f},
-std::array<float,2>{0.019121429f, 0.741217852f},
-std::array<float,2>{0.57490617f, 0.892361999f},
-std::array<float,2>{0.430574685f, 0.25851506f},
-std::array<float,2>{0.821504235f, 0.406612813f},
-std::array<float,2>{0.120850377f, 0.765808165f},
-std::array<float,2>{0.555116057f, 0.522426069f},
-std::array<float,2>{0.463032216f, 0.0302625317f},
-std::array<float,2>{0.715165913f, 0.178569242f},
-std::array<float,2>{0.251712978f, 0.655439973f},
-std::array<float,2>{0.99883461f, 0.986581206f},
-std::array<float,2>{0.191476271f, 0.317580938f},
-std::array<float,2>{0.623154044f, 0.306719571f},
-std::array<float,2>{0.378920943f, 0.923230171f},
-std::array<float,2>{0.808351219f, 0.700459838f},
-std::array<float,2>{0.0338391848f, 0.236273423f},
-std::array<float,2>{0.924621522f, 0.074018538f},
-std::array<float,2>{0.157858267f, 0.600457311f},
-std::array<float,2>{0.67544359f, 0.825168967f},
-std::array<float,2>{0.346132487f, 0.461069643f},
-std::array<float,2>{0.918458283f, 0.406056225f},
-std::array<float,2>{0.173939764f, 0.812455475f},
-std::array<float,2>{0.668248594f, 0.559506655f},
-std::array<float,2>{0.371310294f, 0.0394249596f},
-std::array<float,2>{0.603510916f, 0.155378073f},
-std::array<float,2>{0.404392809f, 0.682605684f},
-std::array<float,2>{0.792333722f, 0.948505759f},
-std::array<float,2>{0.0613350347f, 0.350244164f},
-std::array<float,2>{0.691752553f, 0.274694175f},
-std::array<float,2>{0.280538559f, 0.8856951f},
-std::array<float,2>{0.982216239f, 0.723520398f},
-std::array<float,2>{0.204119533f, 0.213664949f},
-std::array<float,2>{0.828325391f, 0.0998717919f},
-std::array<float,2>{0.106406607f, 0.572637916f},
-std::array<float,2>{0.534888983f, 0.847578764f},
-std::array<float,2>{0.44365859f, 0.49416694f},
-std::array<float,2>{0.759688497f, 0.336261868f},
-std::array<float,2>{0.00318749412f, 0.979042113f},
-std::array<float,2>{0.589305162f, 0.630598009f},
-std::array<float,2>{0.408588618f, 0.156940743f},
-std::array<float,2>{0.627664268f, 0.00788978301f},
-std::array<float,2>{0.333279878f, 0.512257397f},
-std::array<float,2>{0.88579613f, 0.753926277f},
-std::array<float,2>{0.144112378f, 0.430192143f},
-std::array<float,2>{0.502577364f, 0.450009823f},
-std::array<float,2>{0.490795851f, 0.839946806f},
-std::array<float,2>{0.846277893f, 0.619323373f},
-std::array<float,2>{0.0873204395f, 0.0795065835f},
-std::array<float,2>{0.941685438f, 0.224199265f},
-std::array<float,2>{0.233090535f, 0.706444085f},
-std::array<float,2>{0.729186058f, 0.91835016f},
-std::array<float,2>{0.30879584f, 0.286090374f},
-std::array<float,2>{0.999662101f, 0.306350917f},
-std::array<float,2>{0.192991138f, 0.925054312f},
-std::array<float,2>{0.716657817f, 0.702708423f},
-std::array<float,2>{0.250390559f, 0.238275573f},
-std::array<float,2>{0.55655551f, 0.0704840273f},
-std::array<float,2>{0.463929117f, 0.598152101f},
-std::array<float,2>{0.820314467f, 0.826767564f},
-std::array<float,2>{0.119465381f, 0.463177383f},
-std::array<float,2>{0.674448788f, 0.408709496f},
-std::array<float,2>{0.346955717f, 0.768755496f},
-std::array<float,2>{0.925760448f, 0.519786477f},
-std::array<float,2>{0.156607315f, 0.0287459046f},
-std::array<float,2>{0.807556272f, 0.176399887f},
-std::array<float,2>{0.0348374322f, 0.652871192f},
-std::array<float,2>{0.624186218f, 0.984479606f},
-std::array<float,2>{0.379911631f, 0.318481624f},
-std::array<float,2>{0.860225379f, 0.479874343f},
-std::array<float,2>{0.0708154738f, 0.874014616f},
-std::array<float,2>{0.526027024f, 0.588908553f},
-std::array<float,2>{0.473980576f, 0.1130227f},
-std::array<float,2>{0.748752117f, 0.19884859f},
-std::array<float,2>{0.291238725f, 0.739351749f},
-std::array<float,2>{0.959999323f, 0.89356941f},
-std::array<float,2>{0.24510254f, 0.260556906f},
-std::array<float,2>{0.575319231f, 0.369054586f},
-std::array<float,2>{0.431257099f, 0.954076231f},
-std::array<float,2>{0.768152356f, 0.661195338f},
-std::array<float,2>{0.0179775339f, 0.12942031f},
-std::array<float,2>{0.894684792f, 0.0512906574f},
-std::array<float,2>{0.125000834f, 0.534164131f},
-std::array<float,2>{0.642623663f, 0.782975137f},
-std::array<float,2>{0.320715994f, 0.390561789f},
-std::array<float,2>{0.961806238f, 0.460056335f},
-std::array<float,2>{0.237103134f, 0.813309789f},
-std::array<float,2>{0.734739602f, 0.607927859f},
-std::array<float,2>{0.286810309f, 0.0681833699f},
-std::array<float,2>{0.521438003f, 0.246557504f},
-std::array<float,2>{0.482111335f, 0.690399468f},
-std::array<float,2>{0.871670067f, 0.934684217f},
-std::array<float,2>{0.0698638335f, 0.304578066f},
-std::array<float,2>{0.648624778f, 0.321182698f},
-std::array<float,2>{0.31854403f, 0.99851501f},
-std::array<float,2>{0.899278641f, 0.641485989f},
-std::array<float,2>{0.137502432f, 0.184832156f},
-std::array<float,2>{0.776442468f, 0.0213176217f},
-std::array<float,2>{0.0303236861f, 0.526796699f},
-std::array<float,2>{0.569401622f, 0.777432263f},
-std::array<float,2>{0.423110604f, 0.416914821f},
-std::array<float,2>{0.818570018f, 0.251279682f},
-std::array<float,2>{0.115219742f, 0.898611546f},
-std::array<float,2>{0.551870883f, 0.744721949f},
-std::array<float,2>{0.455995888f, 0.195135906f},
-std::array<float,2>{0.710411429f, 0.117825352f},
-std::array<float,2>{0.26333952f, 0.582289934f},
-std::array<float,2>{0.987730205f, 0.860591888f},
-std::array<float,2>{0.201400846f, 0.474768907f},
-std::array<float,2>{0.613645911f, 0.37519598f},
-std::array<float,2>{0.390340596f, 0.789585114f},
-std::array<float,2>{0.801566005f, 0.542149365f},
-std::array<float,2>{0.0413766131f, 0.0554908365f},
-std::array<float,2>{0.931994259f, 0.137460738f},
-std::array<float,2>{0.164958388f, 0.666826844f},
-std::array<float,2>{0.685445607f, 0.961942613f},
-std::array<float,2>{0.35333395f, 0.361234039f},
-std::array<float,2>{0.880079985f, 0.356440634f},
-std::array<float,2>{0.154849052f, 0.940212727f},
-std::array<float,2>{0.639169276f, 0.676553369f},
-std::array<float,2>{0.340117067f, 0.148087159f},
-std::array<float,2>{0.58135277f, 0.0362433381f},
-std::array<float,2>{0.419038475f, 0.553374231f},
-std::array<float,2>{0.752851903f, 0.797445118f},
-std::array<float,2>{0.0112275174f, 0.391696155f},
-std::array<float,2>{0.720816433f, 0.488810956f},
-std::array<float,2>{0.298420548f, 0.85757643f},
-std::array<float,2>{0.94683218f, 0.565604806f},
-std::array<float,2>{0.221031427f, 0.104106098f},
-std::array<float,2>{0.853708386f, 0.208400711f},
-std::array<float,2>{0.079931125f, 0.728857458f},
-std::array<float,2>{0.507874966f, 0.876973689f},
-std::array<float,2>{0.492399156f, 0.272403479f},
-std::array<float,2>{0.781829596f, 0.427996665f},
-std::array<float,2>{0.0530144088f, 0.764583468f},
-std::array<float,2>{0.596716166f, 0.502607942f},
-std::array<float,2>{0.391296864f, 0.00772823673f},
-std::array<float,2>{0.663253009f, 0.168171376f},
-std::array<float,2>{0.362005204f, 0.634571135f},
-std::array<float,2>{0.910968721f, 0.974311173f},
-std::array<float,2>{0.181866989f, 0.334948003f},
-std::array<float,2>{0.544320405f, 0.295902312f},
-std::array<float,2>{0.452180505f, 0.907246649f},
-std::array<float,2>{0.836674094f, 0.714310527f},
-std::array<float,2>{0.0951243713f, 0.232330665f},
-std::array<float,2>{0.9751333f, 0.0934634656f},
-std::array<float,2>{0.217834309f, 0.615858138f},
-std::array<float,2>{0.696750402f, 0.834985495f},
-std::array<float,2>{0.271512032f, 0.440671682f},
-std::array<float,2>{0.977805853f, 0.421251357f},
-std::array<float,2>{0.209723115f, 0.774558663f},
-std::array<float,2>{0.689445317f, 0.528801262f},
-std::array<float,2>{0.276016265f, 0.0195270237f},
-std::array<float,2>{0.536501348f, 0.181735337f},
-std::array<float,2>{0.440942347f, 0.645934463f},
-std::array<float,2>{0.832231939f, 0.995903134f},
-std::array<float,2>{0.102682658f, 0.32559067f},
-std::array<float,2>{0.667660713f, 0.299482852f},
-std::array<float,2>{0.370680034f, 0.931048572f},
-std::array<float,2>{0.914557934f, 0.691580534f},
-std::array<float,2>{0.178923622f, 0.244337365f},
-std::array<float,2>{0.793800116f, 0.0625566989f},
-std::array<float,2>{0.0569163933f, 0.604143262f},
-std::array<float,2>{0.606770635f, 0.817460239f},
-std::array<float,2>{0.398619205f, 0.455885798f},
-std::array<float,2>{0.847820759f, 0.364617914f},
-std::array<float,2>{0.0935491547f, 0.966247737f},
-std::array<float,2>{0.503942966f, 0.669427395f},
-std::array<float,2>{0.486602932f, 0.133169621f},
-std::array<float,2>{0.731138289f, 0.0601200238f},
-std::array<float,2>{0.305066824f, 0.543567002f},
-std::array<float,2>{0.937977552f, 0.79550451f},
-std::array<float,2>{0.230213672f, 0.379837781f},
-std::array<float,2>{0.593096375f, 0.472289741f},
-std::array<float,2>{0.413810313f, 0.864607513f},
-std::array<float,2>{0.76462096f, 0.580069602f},
-std::array<float,2>{0.00517756864f, 0.124363691f},
-std::array<float,2>{0.887691557f, 0.189069003f},
-std::array<float,2>{0.146774873f, 0.749872744f},
-std::array<float,2>{0.631364942f, 0.90296483f},
-std::array<float,2>{0.329478264f, 0.254277617f},
-std::array<float,2>{0.927659929f, 0.268797517f},
-std::array<float,2>{0.162188545f, 0.878944635f},
-std::array<float,2>{0.675827503f, 0.733481288f},
-std::array<float,2>{0.351116031f, 0.206421673f},
-std::array<float,2>{0.61785543f, 0.106542856f},
-std::array<float,2>{0.378107697f, 0.569956243f},
-std::array<float,2>{0.809499502f, 0.853153467f},
-std::array<float,2>{0.0370294675f, 0.484673917f},
-std::array<float,2>{0.712288678f, 0.396186739f},
-std::array<float,2>{0.257685602f, 0.803997099f},
-std::array<float,2>{0.995143175f, 0.549939156f},
-std::array<float,2>{0.189753875f, 0.0339214914f},
-std::array<float,2>{0.825105429f, 0.143698514f},
-std::array<float,2>{0.121428482f, 0.672978938f},
-std::array<float,2>{0.562328517f, 0.942331612f},
-std::array<float,2>{0.46609354f, 0.351897955f},
-std::array<float,2>{0.773015261f, 0.444483131f},
-std::array<float,2>{0.0222968347f, 0.830140412f},
-std::array<float,2>{0.57313478f, 0.610919654f},
-std::array<float,2>{0.43616423f, 0.0859945863f},
-std::array<float,2>{0.647842348f, 0.228697464f},
-std::array<float,2>{0.326729208f, 0.715163648f},
-std::array<float,2>{0.894145966f, 0.91253823f},
-std::array<float,2>{0.132026285f, 0.291037142f},
-std::array<float,2>{0.530636847f, 0.331699133f},
-std::array<float,2>{0.469127297f, 0.971829176f},
-std::array<float,2>{0.866804838f, 0.637866795f},
-std::array<float,2>{0.0776150152f, 0.165806115f},
-std::array<float,2>{0.956387162f, 0.00354784518f},
-std::array<float,2>{0.246481165f, 0.50545156f},
-std::array<float,2>{0.745817423f, 0.758415103f},
-std::array<float,2>{0.296015322f, 0.424203753f},
-std::array<float,2>{0.904406369f, 0.498646617f},
-std::array<float,2>{0.133786768f, 0.847776592f},
-std::array<float,2>{0.652469873f, 0.57764852f},
-std::array<float,2>{0.315814108f, 0.0946899205f},
-std::array<float,2>{0.562962711f, 0.217910737f},
-std::array<float,2>{0.426464081f, 0.721789002f},
-std::array<float,2>{0.779217958f, 0.890322447f},
-std::array<float,2>{0.0268016402f, 0.280888498f},
-std::array<float,2>{0.738744736f, 0.344239175f},
-std::array<float,2>{0.281955004f, 0.952692926f},
-std::array<float,2>{0.967426062f, 0.686445355f},
-std::array<float,2>{0.241403088f, 0.148475096f},
-std::array<float,2>{0.868374646f, 0.0436359681f},
-std::array<float,2>{0.0654407069f, 0.555994868f},
-std::array<float,2>{0.515781045f, 0.807262838f},
-std::array<float,2>{0.479188412f, 0.4005211f},
-std::array<float,2>{0.796985269f, 0.28266412f},
-std::array<float,2>{0.0446347408f, 0.914134443f},
-std::array<float,2>{0.613204896f, 0.708869517f},
-std::array<float,2>{0.385253429f, 0.222640276f},
-std::array<float,2>{0.680402875f, 0.0835305974f},
-std::array<float,2>{0.357522339f, 0.623557687f},
-std::array<float,2>{0.936802685f, 0.83787185f},
-std::array<float,2>{0.168286502f, 0.445983291f},
-std::array<float,2>{0.549911261f, 0.436548263f},
-std::array<float,2>{0.457156867f, 0.75335747f},
-std::array<float,2>{0.813797593f, 0.509248137f},
-std::array<float,2>{0.112785727f, 0.0123082343f},
-std::array<float,2>{0.988827944f, 0.161814436f},
-std::array<float,2>{0.196310088f, 0.625381172f},
-std::array<float,2>{0.70430094f, 0.982587457f},
-std::array<float,2>{0.258240938f, 0.341667145f},
-std::array<float,2>{0.950665534f, 0.315033734f},
-std::array<float,2>{0.222844779f, 0.991758525f},
-std::array<float,2>{0.72501421f, 0.648880959f},
-std::array<float,2>{0.300842673f, 0.172226846f},
-std::array<float,2>{0.512538731f, 0.0263256375f},
-std::array<float,2>{0.499248981f, 0.51603055f},
-std::array<float,2>{0.857284963f, 0.773102283f},
-std::array<float,2>{0.085651353f, 0.412392646f},
-std::array<float,2>{0.636644542f, 0.468724936f},
-std::array<float,2>{0.337002277f, 0.823785841f},
-std::array<float,2>{0.875091016f, 0.597212255f},
-std::array<float,2>{0.149580076f, 0.0774107724f},
-std::array<float,2>{0.755036116f, 0.241829395f},
-std::array<float,2>{0.013849291f, 0.696718097f},
-std::array<float,2>{0.582564235f, 0.92963171f},
-std::array<float,2>{0.414808542f, 0.311785042f},
-std::array<float,2>{0.839935303f, 0.385541052f},
-std::array<float,2>{0.098374337f, 0.788511395f},
-std::array<float,2>{0.540234447f, 0.537441492f},
-std::array<float,2>{0.448030323f, 0.0494437031f},
-std::array<float,2>{0.702720404f, 0.125915304f},
-std::array<float,2>{0.266063482f, 0.660080969f},
-std::array<float,2>{0.969218194f, 0.960860908f},
-std::array<float,2>{0.214349672f, 0.372891784f},
-std::array<float,2>{0.599745154f, 0.264265448f},
-std::array<float,2>{0.397803158f, 0.897001743f},
-std::array<float,2>{0.785686255f, 0.735403001f},
-std::array<float,2>{0.0485319234f, 0.202893987f},
-std::array<float,2>{0.90697819f, 0.114046499f},
-std::array<float,2>{0.187302977f, 0.592950106f},
-std::array<float,2>{0.658358216f, 0.869540393f},
-std::array<float,2>{0.367164999f, 0.482733339f},
-std::array<float,2>{0.884554207f, 0.431913316f},
-std::array<float,2>{0.140693977f, 0.757758796f},
-std::array<float,2>{0.6263026f, 0.51408577f},
-std::array<float,2>{0.335474849f, 0.0104608573f},
-std::array<float,2>{0.586919308f, 0.159472302f},
-std::array<float,2>{0.406438679f, 0.631917477f},
-std::array<float,2>{0.760620356f, 0.978185475f},
-std::array<float,2>{0.00108727638f, 0.339523852f},
-std::array<float,2>{0.727033615f, 0.288959354f},
-std::array<float,2>{0.310892254f, 0.921166778f},
-std::array<float,2>{0.944938779f, 0.704535902f},
-std::array<float,2>{0.231712431f, 0.225209206f},
-std::array<float,2>{0.844813108f, 0.0805264562f},
-std::array<float,2>{0.0896518081f, 0.617375314f},
-std::array<float,2>{0.501876771f, 0.842915118f},
-std::array<float,2>{0.490149379f, 0.452113837f},
-std::array<float,2>{0.790632308f, 0.349335372f},
-std::array<float,2>{0.0599502809f, 0.946190238f},
-std::array<float,2>{0.604720533f, 0.681030691f},
-std::array<float,2>{0.403722137f, 0.152974918f},
-std::array<float,2>{0.671726882f, 0.0418471321f},
-std::array<float,2>{0.374981195f, 0.561108828f},
-std::array<float,2>{0.921548009f, 0.809616089f},
-std::array<float,2>{0.172800586f, 0.40359661f},
-std::array<float,2>{0.532397985f, 0.494096696f},
-std::array<float,2>{0.443307251f, 0.8444224f},
-std::array<float,2>{0.830187261f, 0.570376277f},
-std::array<float,2>{0.107979879f, 0.0990919918f},
-std::array<float,2>{0.982614815f, 0.211963296f},
-std::array<float,2>{0.205545381f, 0.725337625f},
-std::array<float,2>{0.695144057f, 0.883463621f},
-std::array<float,2>{0.278687507f, 0.276376009f},
-std::array<float,2>{0.958517253f, 0.258769184f},
-std::array<float,2>{0.243634716f, 0.892142832f},
-std::array<float,2>{0.747117221f, 0.741523147f},
-std::array<float,2>{0.289343536f, 0.195625767f},
-std::array<float,2>{0.523671746f, 0.110644966f},
-std::array<float,2>{0.476528376f, 0.587323606f},
-std::array<float,2>{0.86138612f, 0.871417582f},
-std::array<float,2>{0.0734355673f, 0.477301955f},
-std::array<float,2>{0.641361594f, 0.38774541f},
-std::array<float,2>{0.323901594f, 0.784324586f},
-std::array<float,2>{0.897200108f, 0.532059669f},
-std::array<float,2>{0.12813203f, 0.0538736433f},
-std::array<float,2>{0.766654253f, 0.132523686f},
-std::array<float,2>{0.0167349316f, 0.663909912f},
-std::array<float,2>{0.57697475f, 0.956316113f},
-std::array<float,2>{0.4335576f, 0.369842321f},
-std::array<float,2>{0.82373035f, 0.461226463f},
-std::array<float,2>{0.118802875f, 0.824910641f},
-std::array<float,2>{0.558122039f, 0.600256503f},
-std::array<float,2>{0.461627185f, 0.073858127f},
-std::array<float,2>{0.717896283f, 0.236049682f},
-std::array<float,2>{0.253363132f, 0.70036155f},
-std::array<float,2>{0.99788487f, 0.923049271f},
-std::array<float,2>{0.194195315f, 0.306902349f},
-std::array<float,2>{0.622102737f, 0.317723811f},
-std::array<float,2>{0.381195515f, 0.986344934f},
-std::array<float,2>{0.806423366f, 0.655753493f},
-std::array<float,2>{0.0331657045f, 0.178359225f},
-std::array<float,2>{0.923040926f, 0.0298837982f},
-std::array<float,2>{0.159662411f, 0.522030473f},
-std::array<float,2>{0.67233181f, 0.765878618f},
-std::array<float,2>{0.344030082f, 0.406491846f},
-std::array<float,2>{0.984690547f, 0.47339654f},
-std::array<float,2>{0.201165512f, 0.861768484f},
-std::array<float,2>{0.707602859f, 0.58560437f},
-std::array<float,2>{0.264479786f, 0.119218148f},
-std::array<float,2>{0.553388596f, 0.192840561f},
-std::array<float,2>{0.454915166f, 0.743518114f},
-std::array<float,2>{0.817970932f, 0.902255893f},
-std::array<float,2>{0.115478195f, 0.253180176f},
-std::array<float,2>{0.68555069f, 0.361993283f},
-std::array<float,2>{0.354711682f, 0.963341832f},
-std::array<float,2>{0.930142581f, 0.665803254f},
-std::array<float,2>{0.16739732f, 0.139536038f},
-std::array<float,2>{0.803129196f, 0.056967169f},
-std::array<float,2>{0.0402410515f, 0.539671063f},
-std::array<float,2>{0.616543829f, 0.791502118f},
-std::array<float,2>{0.38838172f, 0.378607124f},
-std::array<float,2>{0.873333514f, 0.302151471f},
-std::array<float,2>{0.0679684803f, 0.936923444f},
-std::array<float,2>{0.523342788f, 0.689447105f},
-std::array<float,2>{0.484183878f, 0.249669746f},
-std::array<float,2>{0.73811537f, 0.0686730817f},
-std::array<float,2>{0.288358063f, 0.605478883f},
-std::array<float,2>{0.963884532f, 0.8149333f},
-std::array<float,2>{0.235662431f, 0.457598418f},
-std::array<float,2>{0.567528784f, 0.41433832f},
-std::array<float,2>{0.425479144f, 0.781181991f},
-std::array<float,2>{0.775102496f, 0.524933636f},
-std::array<float,2>{0.0280614104f, 0.0223114491f},
-std::array<float,2>{0.901417911f, 0.185984015f},
-std::array<float,2>{0.138906553f, 0.643607855f},
-std::array<float,2>{0.651659608f, 0.998004019f},
-std::array<float,2>{0.317370355f, 0.323008209f},
-std::array<float,2>{0.912489235f, 0.333473146f},
-std::array<float,2>{0.180603132f, 0.975999773f},
-std::array<float,2>{0.660839379f, 0.634997666f},
-std::array<float,2>{0.361062586f, 0.171649337f},
-std::array<float,2>{0.594797432f, 0.00453057699f},
-std::array<float,2>{0.392924011f, 0.500888944f},
-std::array<float,2>{0.784168005f, 0.762004495f},
-std::array<float,2>{0.0522182249f, 0.426445574f},
-std::array<float,2>{0.698559463f, 0.438688725f},
-std::array<float,2>{0.270418614f, 0.833231747f},
-std::array<float,2>{0.973637044f, 0.614971817f},
-std::array<float,2>{0.216468811f, 0.0915251523f},
-std::array<float,2>{0.838952899f, 0.234199315f},
-std::array<float,2>{0.0970979333f, 0.712642968f},
-std::array<float,2>{0.545320749f, 0.909873784f},
-std::array<float,2>{0.45039016f, 0.294249415f},
-std::array<float,2>{0.751097977f, 0.394053727f},
-std::array<float,2>{0.00832054578f, 0.799391508f},
-std::array<float,2>{0.579941213f, 0.552059948f},
-std::array<float,2>{0.419931263f, 0.0377851427f},
-std::array<float,2>{0.63708508f, 0.145248055f},
-std::array<float,2>{0.342449903f, 0.679176629f},
-std::array<float,2>{0.881824315f, 0.938963056f},
-std::array<float,2>{0.15330407f, 0.357771218f},
-std::array<float,2>{0.511079907f, 0.2712363f},
-std::array<float,2>{0.494520754f, 0.875107169f},
-std::array<float,2>{0.851582825f, 0.727112412f},
-std::array<float,2>{0.0812610388f, 0.209088042f},
-std::array<float,2>{0.948553026f, 0.102718666f},
-std::array<float,2>{0.219538048f, 0.563220382f},
-std::array<float,2>{0.718838811f, 0.856080711f},
-std::array<float,2>{0.299479008f, 0.491506636f},
-std::array<float,2>{0.939814985f, 0.382177174f},
-std::array<float,2>{0.228216082f, 0.794298768f},
-std::array<float,2>{0.733905733f, 0.546149194f},
-std::array<float,2>{0.307457715f, 0.0607894957f},
-std::array<float,2>{0.50617373f, 0.135605618f},
-std::array<float,2>{0.484951288f, 0.671868503f},
-std::array<float,2>{0.851426244f, 0.968441129f},
-std::array<float,2>{0.0910926387f, 0.367164105f},
-std::array<float,2>{0.630619407f, 0.257005125f},
-std::array<float,2>{0.330891877f, 0.904577017f},
-std::array<float,2>{0.889659464f, 0.747276723f},
-std::array<float,2>{0.144863591f, 0.190675825f},
-std::array<float,2>{0.763147593f, 0.122437127f},
-std::array<float,2>{0.00658513512f, 0.581505001f},
-std::array<float,2>{0.591469407f, 0.86537379f},
-std::array<float,2>{0.411651105f, 0.469907105f},
-std::array<float,2>{0.835037053f, 0.327008694f},
-std::array<float,2>{0.103620857f, 0.992352545f},
-std::array<float,2>{0.538358629f, 0.648300111f},
-std::array<float,2>{0.439393669f, 0.179755926f},
-std::array<float,2>{0.691057801f, 0.0159874819f},
-std::array<float,2>{0.274023592f, 0.529411256f},
-std::array<float,2>{0.979230642f, 0.776803434f},
-std::array<float,2>{0.208204806f, 0.418999016f},
-std::array<float,2>{0.607497633f, 0.454382718f},
-std::array<float,2>{0.400443882f, 0.820199072f},
-std::array<float,2>{0.795247495f, 0.602780461f},
-std::array<float,2>{0.0560355447f, 0.0654283687f},
-std::array<float,2>{0.917961597f, 0.243960604f},
-std::array<float,2>{0.176502243f, 0.694993556f},
-std::array<float,2>{0.66530478f, 0.932754517f},
-std::array<float,2>{0.368228316f, 0.29867512f},
-std::array<float,2>{0.891161144f, 0.290604711f},
-std::array<float,2>{0.129553452f, 0.911484599f},
-std::array<float,2>{0.644622862f, 0.716805756f},
-std::array<float,2>{0.32611683f, 0.228181168f},
-std::array<float,2>{0.570536792f, 0.0897515938f},
-std::array<float,2>{0.435317338f, 0.612083852f},
-std::array<float,2>{0.771372736f, 0.829956591f},
-std::array<float,2>{0.0214763507f, 0.442705035f},
-std::array<float,2>{0.743524253f, 0.423208892f},
-std::array<float,2>{0.294281602f, 0.759932041f},
-std::array<float,2>{0.955033362f, 0.506018579f},
-std::array<float,2>{0.248436272f, 0.00154143164f},
-std::array<float,2>{0.86414361f, 0.166452467f},
-std::array<float,2>{0.075312838f, 0.640102804f},
-std::array<float,2>{0.527634621f, 0.969574869f},
-std::array<float,2>{0.470998257f, 0.329497069f},
-std::array<float,2>{0.811181128f, 0.487492561f},
-std::array<float,2>{0.0375005417f, 0.854432762f},
-std::array<float,2>{0.619576037f, 0.567649126f},
-std::array<float,2>{0.375796378f, 0.10914243f},
-std::array<float,2>{0.678272188f, 0.203971729f},
-std::array<float,2>{0.348466516f, 0.732401907f},
-std::array<float,2>{0.928163052f, 0.882810175f},
-std::array<float,2>{0.1606455f, 0.267318249f},
-std::array<float,2>{0.559903204f, 0.354078025f},
-std::array<float,2>{0.467847109f, 0.944764495f},
-std::array<float,2>{0.827913642f, 0.675079167f},
-std::array<float,2>{0.124642357f, 0.141568482f},
-std::array<float,2>{0.992923379f, 0.0330721959f},
-std::array<float,2>{0.188001364f, 0.548208356f},
-std::array<float,2>{0.713645935f, 0.801324666f},
-std::array<float,2>{0.254025757f, 0.396992356f},
-std::array<float,2>{0.934042335f, 0.447459966f},
-std::array<float,2>{0.171100721f, 0.839715898f},
-std::array<float,2>{0.683550239f, 0.62268436f},
-std::array<float,2>{0.356445491f, 0.0844642147f},
-std::array<float,2>{0.611090064f, 0.21956183f},
-std::array<float,2>{0.384460449f, 0.710627437f},
-std::array<float,2>{0.798880517f, 0.916923761f},
-std::array<float,2>{0.045103915f, 0.284645736f},
-std::array<float,2>{0.706629932f, 0.342238635f},
-std::array<float,2>{0.261421889f, 0.982055306f},
-std::array<float,2>{0.990309656f, 0.627001703f},
-std::array<float,2>{0.19898355f, 0.162959009f},
-std::array<float,2>{0.815507233f, 0.0137867499f},
-std::array<float,2>{0.109828971f, 0.511402488f},
-std::array<float,2>{0.547255695f, 0.750283062f},
-std::array<float,2>{0.460057676f, 0.434268832f},
-std::array<float,2>{0.780431986f, 0.277622938f},
-std::array<float,2>{0.0244273096f, 0.888252378f},
-std::array<float,2>{0.566080332f, 0.720174015f},
-std::array<float,2>{0.429570794f, 0.216524959f},
-std::array<float,2>{0.655674219f, 0.0975816026f},
-std::array<float,2>{0.313489467f, 0.575447381f},
-std::array<float,2>{0.902355611f, 0.849961102f},
-std::array<float,2>{0.135956362f, 0.496733189f},
-std::array<float,2>{0.51946187f, 0.399614871f},
-std::array<float,2>{0.478464454f, 0.806325018f},
-std::array<float,2>{0.870824754f, 0.557331741f},
-std::array<float,2>{0.063480705f, 0.0461883545f},
-std::array<float,2>{0.964855731f, 0.151410669f},
-std::array<float,2>{0.239336371f, 0.684987187f},
-std::array<float,2>{0.74143517f, 0.950983942f},
-std::array<float,2>{0.283821225f, 0.346655607f},
-std::array<float,2>{0.97206521f, 0.373485118f},
-std::array<float,2>{0.212014705f, 0.957157016f},
-std::array<float,2>{0.699741304f, 0.656566441f},
-std::array<float,2>{0.267856777f, 0.128802896f},
-std::array<float,2>{0.54170388f, 0.0479013361f},
-std::array<float,2>{0.446531475f, 0.535690725f},
-std::array<float,2>{0.8424716f, 0.785905659f},
-std::array<float,2>{0.101533636f, 0.383725554f},
-std::array<float,2>{0.657673836f, 0.480654478f},
-std::array<float,2>{0.36511749f, 0.867254734f},
-std::array<float,2>{0.908601582f, 0.591242671f},
-std::array<float,2>{0.18396765f, 0.117083967f},
-std::array<float,2>{0.788398504f, 0.200605631f},
-std::array<float,2>{0.048906114f, 0.736344874f},
-std::array<float,2>{0.598569095f, 0.896291256f},
-std::array<float,2>{0.3946805f, 0.261955112f},
-std::array<float,2>{0.85857445f, 0.410158932f},
-std::array<float,2>{0.0836201012f, 0.769630075f},
-std::array<float,2>{0.515079319f, 0.518797576f},
-std::array<float,2>{0.497972041f, 0.0238513742f},
-std::array<float,2>{0.723711669f, 0.174427792f},
-std::array<float,2>{0.303440571f, 0.650440931f},
-std::array<float,2>{0.952456772f, 0.989670575f},
-std::array<float,2>{0.226071835f, 0.312867939f},
-std::array<float,2>{0.584047139f, 0.308645159f},
-std::array<float,2>{0.416294545f, 0.926634967f},
-std::array<float,2>{0.757212698f, 0.698433161f},
-std::array<float,2>{0.0118746841f, 0.239457354f},
-std::array<float,2>{0.877976656f, 0.0746496022f},
-std::array<float,2>{0.151566863f, 0.595302284f},
-std::array<float,2>{0.634577632f, 0.821569681f},
-std::array<float,2>{0.339058101f, 0.465771705f},
-std::array<float,2>{0.898321092f, 0.389182299f},
-std::array<float,2>{0.127148986f, 0.781558454f},
-std::array<float,2>{0.642215788f, 0.534223497f},
-std::array<float,2>{0.322660029f, 0.0526588783f},
-std::array<float,2>{0.578029513f, 0.130699828f},
-std::array<float,2>{0.432100654f, 0.660448253f},
-std::array<float,2>{0.765785813f, 0.954849124f},
-std::array<float,2>{0.0157184713f, 0.36754328f},
-std::array<float,2>{0.746231794f, 0.261380166f},
-std::array<float,2>{0.290527523f, 0.893196046f},
-std::array<float,2>{0.957628191f, 0.738506854f},
-std::array<float,2>{0.242911443f, 0.197590575f},
-std::array<float,2>{0.862789452f, 0.111849017f},
-std::array<float,2>{0.0728090331f, 0.58811748f},
-std::array<float,2>{0.525273323f, 0.874244869f},
-std::array<float,2>{0.475422204f, 0.47862491f},
-std::array<float,2>{0.804940999f, 0.319926381f},
-std::array<float,2>{0.032171607f, 0.985413313f},
-std::array<float,2>{0.621985853f, 0.653924346f},
-std::array<float,2>{0.382760286f, 0.177278146f},
-std::array<float,2>{0.673291981f, 0.0282542799f},
-std::array<float,2>{0.344817936f, 0.520683289f},
-std::array<float,2>{0.922321141f, 0.768019378f},
-std::array<float,2>{0.158688679f, 0.409612924f},
-std::array<float,2>{0.557517946f, 0.464227736f},
-std::array<float,2>{0.462139875f, 0.827326179f},
-std::array<float,2>{0.822751105f, 0.599289298f},
-std::array<float,2>{0.117261045f, 0.0714130253f},
-std::array<float,2>{0.996175885f, 0.236811325f},
-std::array<float,2>{0.19436413f, 0.701657712f},
-std::array<float,2>{0.717455149f, 0.924247205f},
-std::array<float,2>{0.252739608f, 0.305017799f},
-std::array<float,2>{0.943747044f, 0.286725163f},
-std::array<float,2>{0.231082365f, 0.919712901f},
-std::array<float,2>{0.727751493f, 0.70595926f},
-std::array<float,2>{0.31197831f, 0.223217115f},
-std::array<float,2>{0.500281513f, 0.078330934f},
-std::array<float,2>{0.488811821f, 0.620207191f},
-std::array<float,2>{0.84431994f, 0.841007292f},
-std::array<float,2>{0.0885401592f, 0.451025039f},
-std::array<float,2>{0.625679076f, 0.430851221f},
-std::array<float,2>{0.334542423f, 0.755288124f},
-std::array<float,2>{0.883767664f, 0.513330758f},
-std::array<float,2>{0.141975671f, 0.00919921789f},
-std::array<float,2>{0.761116743f, 0.15723075f},
-std::array<float,2>{0.00048384312f, 0.629173398f},
-std::array<float,2>{0.586367369f, 0.980261266f},
-std::array<float,2>{0.407835096f, 0.336932898f},
-std::array<float,2>{0.831627071f, 0.49517709f},
-std::array<float,2>{0.108620591f, 0.846280396f},
-std::array<float,2>{0.531748235f, 0.57337904f},
-std::array<float,2>{0.441776872f, 0.100764513f},
-std::array<float,2>{0.69430691f, 0.214486822f},
-std::array<float,2>{0.277838737f, 0.724528372f},
-std::array<float,2>{0.983881533f, 0.886538446f},
-std::array<float,2>{0.206298336f, 0.27361533f},
-std::array<float,2>{0.603966355f, 0.351339757f},
-std::array<float,2>{0.402783602f, 0.947595775f},
-std::array<float,2>{0.78975451f, 0.68301779f},
-std::array<float,2>{0.0590442084f, 0.154673696f},
-std::array<float,2>{0.920508623f, 0.0400511697f},
-std::array<float,2>{0.173609987f, 0.560158193f},
-std::array<float,2>{0.67049849f, 0.810576499f},
-std::array<float,2>{0.373250633f, 0.405098379f},
-std::array<float,2>{0.973251939f, 0.440014213f},
-std::array<float,2>{0.215562269f, 0.834749341f},
-std::array<float,2>{0.698055148f, 0.616975844f},
-std::array<float,2>{0.271236956f, 0.0920889601f},
-std::array<float,2>{0.546409428f, 0.231372401f},
-std::array<float,2>{0.449395448f, 0.712898552f},
-std::array<float,2>{0.838454545f, 0.907043993f},
-std::array<float,2>{0.095994398f, 0.295531601f},
-std::array<float,2>{0.661599457f, 0.335856974f},
-std::array<float,2>{0.360117644f, 0.973574936f},
-std::array<float,2>{0.913515747f, 0.63331908f},
-std::array<float,2>{0.180724666f, 0.16902715f},
-std::array<float,2>{0.784783185f, 0.00601657759f},
-std::array<float,2>{0.0512398966f, 0.503237963f},
-std::array<float,2>{0.593936503f, 0.765147865f},
-std::array<float,2>{0.393587381f, 0.429604352f},
-std::array<float,2>{0.853198946f, 0.273263574f},
-std::array<float,2>{0.0806600749f, 0.878667951f},
-std::array<float,2>{0.51071018f, 0.729562223f},
-std::array<float,2>{0.495623976f, 0.207109898f},
-std::array<float,2>{0.720468998f, 0.105207331f},
-std::array<float,2>{0.300403267f, 0.564510584f},
-std::array<float,2>{0.947327077f, 0.85891664f},
-std::array<float,2>{0.220337361f, 0.489306003f},
-std::array<float,2>{0.578137994f, 0.391125858f},
-std::array<float,2>{0.421396762f, 0.79788661f},
-std::array<float,2>{0.750217259f, 0.55438298f},
-std::array<float,2>{0.00889064465f, 0.0359933227f},
-std::array<float,2>{0.882780969f, 0.147412509f},
-std::array<float,2>{0.153810829f, 0.677334189f},
-std::array<float,2>{0.637990534f, 0.940834343f},
-std::array<float,2>{0.34278217f, 0.357380241f},
-std::array<float,2>{0.931139767f, 0.359473914f},
-std::array<float,2>{0.166650087f, 0.961412728f},
-std::array<float,2>{0.686793685f, 0.66795665f},
-std::array<float,2>{0.354282379f, 0.138554618f},
-std::array<float,2>{0.615389347f, 0.0561961494f},
-std::array<float,2>{0.386827737f, 0.54128629f},
-std::array<float,2>{0.803790927f, 0.790794849f},
-std::array<float,2>{0.0395063348f, 0.3760221f},
-std::array<float,2>{0.70835191f, 0.476441205f},
-std::array<float,2>{0.265363961f, 0.859380126f},
-std::array<float,2>{0.98558265f, 0.583682418f},
-std::array<float,2>{0.19997257f, 0.118906014f},
-std::array<float,2>{0.816724598f, 0.193651855f},
-std::array<float,2>{0.116375238f, 0.745815635f},
-std::array<float,2>{0.554254532f, 0.900348306f},
-std::array<float,2>{0.45367831f, 0.250100881f},
-std::array<float,2>{0.774075091f, 0.417818815f},
-std::array<float,2>{0.0290534832f, 0.778379917f},
-std::array<float,2>{0.567340851f, 0.525727153f},
-std::array<float,2>{0.423975527f, 0.0199083872f},
-std::array<float,2>{0.650518298f, 0.184192955f},
-std::array<float,2>{0.317626923f, 0.641687334f},
-std::array<float,2>{0.900754035f, 0.999505818f},
-std::array<float,2>{0.140577957f, 0.321820974f},
-std::array<float,2>{0.521771371f, 0.303605855f},
-std::array<float,2>{0.482748091f, 0.934071541f},
-std::array<float,2>{0.874618649f, 0.690892696f},
-std::array<float,2>{0.0672804415f, 0.24737069f},
-std::array<float,2>{0.96342659f, 0.066671893f},
-std::array<float,2>{0.235276863f, 0.608620405f},
-std::array<float,2>{0.736430168f, 0.814324021f},
-std::array<float,2>{0.287234813f, 0.459209114f},
-std::array<float,2>{0.953720748f, 0.425632596f},
-std::array<float,2>{0.24954021f, 0.759094298f},
-std::array<float,2>{0.742471039f, 0.50487417f},
-std::array<float,2>{0.293657959f, 0.00274269585f},
-std::array<float,2>{0.529174864f, 0.164722592f},
-std::array<float,2>{0.472651631f, 0.636754215f},
-std::array<float,2>{0.864370465f, 0.971048057f},
-std::array<float,2>{0.0743614361f, 0.330445468f},
-std::array<float,2>{0.646481812f, 0.292081624f},
-std::array<float,2>{0.324356169f, 0.913476408f},
-std::array<float,2>{0.892332375f, 0.71649307f},
-std::array<float,2>{0.13020125f, 0.230041817f},
-std::array<float,2>{0.769648194f, 0.0875043198f},
-std::array<float,2>{0.0199001078f, 0.610270739f},
-std::array<float,2>{0.571765304f, 0.831960917f},
-std::array<float,2>{0.434561312f, 0.443965852f},
-std::array<float,2>{0.826420188f, 0.353485912f},
-std::array<float,2>{0.123917148f, 0.942448854f},
-std::array<float,2>{0.55881232f, 0.672100961f},
-std::array<float,2>{0.46744743f, 0.143518165f},
-std::array<float,2>{0.714619279f, 0.0347192958f},
-std::array<float,2>{0.255139172f, 0.548901916f},
-std::array<float,2>{0.993197501f, 0.803061664f},
-std::array<float,2>{0.188889027f, 0.39464438f},
-std::array<float,2>{0.620813966f, 0.485745907f},
-std::array<float,2>{0.376425266f, 0.851803064f},
-std::array<float,2>{0.811895072f, 0.568613827f},
-std::array<float,2>{0.0386113115f, 0.10594622f},
-std::array<float,2>{0.929106951f, 0.205170467f},
-std::array<float,2>{0.161208257f, 0.732450724f},
-std::array<float,2>{0.679684579f, 0.880034506f},
-std::array<float,2>{0.349299669f, 0.267821759f},
-std::array<float,2>{0.888987899f, 0.255073339f},
-std::array<float,2>{0.14592582f, 0.904070199f},
-std::array<float,2>{0.629247725f, 0.748325765f},
-std::array<float,2>{0.331271887f, 0.188012704f},
-std::array<float,2>{0.589848638f, 0.123761795f},
-std::array<float,2>{0.41073063f, 0.578594208f},
-std::array<float,2>{0.762188375f, 0.864048541f},
-std::array<float,2>{0.00751998601f, 0.471500158f},
-std::array<float,2>{0.733227491f, 0.380128175f},
-std::array<float,2>{0.308192194f, 0.796806335f},
-std::array<float,2>{0.940564692f, 0.544904172f},
-std::array<float,2>{0.22687149f, 0.059527833f},
-std::array<float,2>{0.850410104f, 0.134577528f},
-std::array<float,2>{0.0905910134f, 0.668566048f},
-std::array<float,2>{0.50736475f, 0.965288222f},
-std::array<float,2>{0.485533923f, 0.363485873f},
-std::array<float,2>{0.796518862f, 0.456721544f},
-std::array<float,2>{0.0551021993f, 0.817007184f},
-std::array<float,2>{0.608928084f, 0.604947448f},
-std::array<float,2>{0.401401281f, 0.0643527359f},
-std::array<float,2>{0.664240003f, 0.245735005f},
-std::array<float,2>{0.367425501f, 0.693132699f},
-std::array<float,2>{0.916016817f, 0.929851353f},
-std::array<float,2>{0.177546635f, 0.300173461f},
-std::array<float,2>{0.537288666f, 0.325022519f},
-std::array<float,2>{0.438474327f, 0.994768441f},
-std::array<float,2>{0.83435899f, 0.645179868f},
-std::array<float,2>{0.104640201f, 0.183324605f},
-std::array<float,2>{0.979511857f, 0.0181051139f},
-std::array<float,2>{0.207634538f, 0.528154969f},
-std::array<float,2>{0.689759672f, 0.773994148f},
-std::array<float,2>{0.274663538f, 0.420571238f},
-std::array<float,2>{0.909506381f, 0.484366983f},
-std::array<float,2>{0.18510507f, 0.870606065f},
-std::array<float,2>{0.656977892f, 0.591994345f},
-std::array<float,2>{0.364072114f, 0.114637434f},
-std::array<float,2>{0.599570155f, 0.201348215f},
-std::array<float,2>{0.395647526f, 0.734504759f},
-std::array<float,2>{0.78718406f, 0.898378789f},
-std::array<float,2>{0.050589148f, 0.265314072f},
-std::array<float,2>{0.701109052f, 0.371598542f},
-std::array<float,2>{0.269209117f, 0.959023774f},
-std::array<float,2>{0.971175492f, 0.659160137f},
-std::array<float,2>{0.211290628f, 0.12670584f},
-std::array<float,2>{0.843669653f, 0.0505991541f},
-std::array<float,2>{0.100280702f, 0.538628101f},
-std::array<float,2>{0.542158425f, 0.787711799f},
-std::array<float,2>{0.445999533f, 0.386159927f},
-std::array<float,2>{0.756347001f, 0.310833097f},
-std::array<float,2>{0.0127329836f, 0.928443491f},
-std::array<float,2>{0.585432053f, 0.695483923f},
-std::array<float,2>{0.417871594f, 0.240764052f},
-std::array<float,2>{0.633475959f, 0.0765673518f},
-std::array<float,2>{0.338516474f, 0.596406281f},
-std::array<float,2>{0.877739489f, 0.82319361f},
-std::array<float,2>{0.150519893f, 0.467165142f},
-std::array<float,2>{0.514594018f, 0.41341728f},
-std::array<float,2>{0.496650726f, 0.771771431f},
-std::array<float,2>{0.858216465f, 0.517128944f},
-std::array<float,2>{0.0820632279f, 0.0269001499f},
-std::array<float,2>{0.952008963f, 0.173437521f},
-std::array<float,2>{0.224710271f, 0.650238633f},
-std::array<float,2>{0.72324425f, 0.991041362f},
-std::array<float,2>{0.30414775f, 0.315921485f},
-std::array<float,2>{0.991251707f, 0.340500981f},
-std::array<float,2>{0.197342902f, 0.983527482f},
-std::array<float,2>{0.705248177f, 0.626234233f},
-std::array<float,2>{0.260163963f, 0.160573423f},
-std::array<float,2>{0.548182726f, 0.0135788992f},
-std::array<float,2>{0.459718674f, 0.507997394f},
-std::array<float,2>{0.815334141f, 0.752011716f},
-std::array<float,2>{0.11110875f, 0.436070621f},
-std::array<float,2>{0.68240428f, 0.447250456f},
-std::array<float,2>{0.356433719f, 0.835947216f},
-std::array<float,2>{0.934858322f, 0.624527931f},
-std::array<float,2>{0.170896828f, 0.0828619599f},
-std::array<float,2>{0.800471365f, 0.221634284f},
-std::array<float,2>{0.0460458361f, 0.707963049f},
-std::array<float,2>{0.60990262f, 0.916008651f},
-std::array<float,2>{0.38327688f, 0.281517506f},
-std::array<float,2>{0.869755447f, 0.401887f},
-std::array<float,2>{0.0625018701f, 0.808528602f},
-std::array<float,2>{0.517589033f, 0.554729104f},
-std::array<float,2>{0.477290958f, 0.0441177785f},
-std::array<float,2>{0.740849316f, 0.149435788f},
-std::array<float,2>{0.284836143f, 0.686550796f},
-std::array<float,2>{0.966232777f, 0.951679826f},
-std::array<float,2>{0.239217713f, 0.34510076f},
-std::array<float,2>{0.56499058f, 0.27993691f},
-std::array<float,2>{0.428520501f, 0.888931453f},
-std::array<float,2>{0.780212045f, 0.721115947f},
-std::array<float,2>{0.0235336684f, 0.217377394f},
-std::array<float,2>{0.903393686f, 0.095397234f},
-std::array<float,2>{0.135713652f, 0.576561928f},
-std::array<float,2>{0.655253172f, 0.84960264f},
-std::array<float,2>{0.313397318f, 0.499424189f},
-std::array<float,2>{0.924090087f, 0.408146501f},
-std::array<float,2>{0.157339901f, 0.767491102f},
-std::array<float,2>{0.674980283f, 0.523424208f},
-std::array<float,2>{0.346511424f, 0.0307663213f},
-std::array<float,2>{0.62382865f, 0.179223493f},
-std::array<float,2>{0.379588276f, 0.654478729f},
-std::array<float,2>{0.807998776f, 0.987498879f},
-std::array<float,2>{0.0336763561f, 0.317084253f},
-std::array<float,2>{0.715745807f, 0.308532f},
-std::array<float,2>{0.251460135f, 0.922651529f},
-std::array<float,2>{0.998389244f, 0.699370921f},
-std::array<float,2>{0.192285225f, 0.234939098f},
-std::array<float,2>{0.821980834f, 0.0730523616f},
-std::array<float,2>{0.120342299f, 0.600826979f},
-std::array<float,2>{0.555544257f, 0.826023757f},
-std::array<float,2>{0.463767558f, 0.462335438f},
-std::array<float,2>{0.769138873f, 0.370808631f},
-std::array<float,2>{0.018604856f, 0.955708086f},
-std::array<float,2>{0.574257851f, 0.663001239f},
-std::array<float,2>{0.430172205f, 0.131321713f},
-std::array<float,2>{0.644058585f, 0.0529699624f},
-std::array<float,2>{0.322024614f, 0.532846928f},
-std::array<float,2>{0.896099567f, 0.784142077f},
-std::array<float,2>{0.126881793f, 0.387153149f},
-std::array<float,2>{0.527134001f, 0.478038669f},
-std::array<float,2>{0.472682178f, 0.872867525f},
-std::array<float,2>{0.860677958f, 0.586480558f},
-std::array<float,2>{0.0720116794f, 0.109609082f},
-std::array<float,2>{0.959701061f, 0.196893901f},
-std::array<float,2>{0.245328873f, 0.740764022f},
-std::array<float,2>{0.749346912f, 0.890643656f},
-std::array<float,2>{0.292049289f, 0.259444863f},
-std::array<float,2>{0.980491579f, 0.275626928f},
-std::array<float,2>{0.203303993f, 0.884754896f},
-std::array<float,2>{0.692418158f, 0.726561189f},
-std::array<float,2>{0.280035466f, 0.211489886f},
-std::array<float,2>{0.53339994f, 0.0978441536f},
-std::array<float,2>{0.444904655f, 0.571373641f},
-std::array<float,2>{0.829180121f, 0.844813168f},
-std::array<float,2>{0.106666081f, 0.49226737f},
-std::array<float,2>{0.669846594f, 0.402697831f},
-std::array<float,2>{0.372562766f, 0.8089329f},
-std::array<float,2>{0.919852495f, 0.562499642f},
-std::array<float,2>{0.174875006f, 0.0422710963f},
-std::array<float,2>{0.791059613f, 0.153774932f},
-std::array<float,2>{0.062253762f, 0.680628002f},
-std::array<float,2>{0.6015926f, 0.947211802f},
-std::array<float,2>{0.405825764f, 0.347732484f},
-std::array<float,2>{0.846752763f, 0.452764779f},
-std::array<float,2>{0.0859687924f, 0.84225291f},
-std::array<float,2>{0.502995074f, 0.618503451f},
-std::array<float,2>{0.491506517f, 0.0812449828f},
-std::array<float,2>{0.729652464f, 0.226546496f},
-std::array<float,2>{0.310365856f, 0.703334391f},
-std::array<float,2>{0.942552686f, 0.920368433f},
-std::array<float,2>{0.234235793f, 0.288060665f},
-std::array<float,2>{0.588372767f, 0.338177532f},
-std::array<float,2>{0.410046875f, 0.976834297f},
-std::array<float,2>{0.758486211f, 0.631446779f},
-std::array<float,2>{0.00245588622f, 0.158451736f},
-std::array<float,2>{0.885369241f, 0.0112227788f},
-std::array<float,2>{0.143095762f, 0.51542449f},
-std::array<float,2>{0.628749013f, 0.756414354f},
-std::array<float,2>{0.332268208f, 0.432685524f},
-std::array<float,2>{0.945797801f, 0.490591407f},
-std::array<float,2>{0.222169757f, 0.857241571f},
-std::array<float,2>{0.72237134f, 0.56414181f},
-std::array<float,2>{0.297760129f, 0.101601608f},
-std::array<float,2>{0.509312928f, 0.210703894f},
-std::array<float,2>{0.493462294f, 0.727609217f},
-std::array<float,2>{0.855166256f, 0.876092792f},
-std::array<float,2>{0.0788947791f, 0.270266593f},
-std::array<float,2>{0.640574515f, 0.358520418f},
-std::array<float,2>{0.341561526f, 0.938353121f},
-std::array<float,2>{0.879429102f, 0.678643107f},
-std::array<float,2>{0.155994087f, 0.145608023f},
-std::array<float,2>{0.753298104f, 0.0382390991f},
-std::array<float,2>{0.0104495464f, 0.551370502f},
-std::array<float,2>{0.580380738f, 0.800718427f},
-std::array<float,2>{0.418558717f, 0.392691165f},
-std::array<float,2>{0.83726418f, 0.293509811f},
-std::array<float,2>{0.0941107199f, 0.908691823f},
-std::array<float,2>{0.542994082f, 0.71140027f},
-std::array<float,2>{0.451329052f, 0.232659325f},
-std::array<float,2>{0.695764303f, 0.090509586f},
-std::array<float,2>{0.273396492f, 0.613940001f},
-std::array<float,2>{0.976411939f, 0.832628191f},
-std::array<float,2>{0.217731073f, 0.437693954f},
-std::array<float,2>{0.596072972f, 0.427434117f},
-std::array<float,2>{0.392320663f, 0.762916327f},
-std::array<float,2>{0.782811344f, 0.501502514f},
-std::array<float,2>{0.0541197769f, 0.00570963183f},
-std::array<float,2>{0.912034214f, 0.170883581f},
-std::array<float,2>{0.182773978f, 0.635769784f},
-std::array<float,2>{0.662242055f, 0.97523272f},
-std::array<float,2>{0.362895578f, 0.332875401f},
-std::array<float,2>{0.899639666f, 0.323536187f},
-std::array<float,2>{0.13782157f, 0.996394694f},
-std::array<float,2>{0.64977783f, 0.643343091f},
-std::array<float,2>{0.320217878f, 0.187015995f},
-std::array<float,2>{0.568401814f, 0.0225738306f},
-std::array<float,2>{0.422108024f, 0.524279714f},
-std::array<float,2>{0.776012778f, 0.779855251f},
-std::array<float,2>{0.029403476f, 0.415536493f},
-std::array<float,2>{0.735881031f, 0.458385795f},
-std::array<float,2>{0.28603822f, 0.816270053f},
-std::array<float,2>{0.962337375f, 0.606665015f},
-std::array<float,2>{0.237448752f, 0.0702892542f},
-std::array<float,2>{0.87220335f, 0.249008179f},
-std::array<float,2>{0.0686267614f, 0.687735975f},
-std::array<float,2>{0.520460665f, 0.935888529f},
-std::array<float,2>{0.480865657f, 0.300963968f},
-std::array<float,2>{0.802329242f, 0.377326071f},
-std::array<float,2>{0.0421739109f, 0.792661607f},
-std::array<float,2>{0.614842474f, 0.540099859f},
-std::array<float,2>{0.389006853f, 0.0585594214f},
-std::array<float,2>{0.683695734f, 0.140457004f},
-std::array<float,2>{0.352315664f, 0.664237916f},
-std::array<float,2>{0.932937384f, 0.964727223f},
-std::array<float,2>{0.16544278f, 0.362881154f},
-std::array<float,2>{0.551125944f, 0.252663463f},
-std::array<float,2>{0.45666635f, 0.901314616f},
-std::array<float,2>{0.820042431f, 0.742599428f},
-std::array<float,2>{0.113317549f, 0.191506609f},
-std::array<float,2>{0.986395419f, 0.121048786f},
-std::array<float,2>{0.203123122f, 0.584773719f},
-std::array<float,2>{0.709249258f, 0.863185167f},
-std::array<float,2>{0.261722177f, 0.474236965f},
-std::array<float,2>{0.994811714f, 0.39747113f},
-std::array<float,2>{0.19136259f, 0.802350044f},
-std::array<float,2>{0.71146363f, 0.547573924f},
-std::array<float,2>{0.256289005f, 0.0315076746f},
-std::array<float,2>{0.561115503f, 0.142063215f},
-std::array<float,2>{0.465462923f, 0.674198866f},
-std::array<float,2>{0.825473547f, 0.943782926f},
-std::array<float,2>{0.122495227f, 0.354892671f},
-std::array<float,2>{0.67723614f, 0.265803844f},
-std::array<float,2>{0.350034952f, 0.881531477f},
-std::array<float,2>{0.926515579f, 0.731232047f},
-std::array<float,2>{0.163917437f, 0.204586446f},
-std::array<float,2>{0.809620917f, 0.107648283f},
-std::array<float,2>{0.0357817635f, 0.566408336f},
-std::array<float,2>{0.618907928f, 0.854860723f},
-std::array<float,2>{0.377507567f, 0.486912191f},
-std::array<float,2>{0.866026878f, 0.328351855f},
-std::array<float,2>{0.0763622224f, 0.970050395f},
-std::array<float,2>{0.529339015f, 0.638870955f},
-std::array<float,2>{0.47057119f, 0.167724937f},
-std::array<float,2>{0.745044947f, 0.000746976992f},
-std::array<float,2>{0.295698524f, 0.507023335f},
-std::array<float,2>{0.955633044f, 0.761444092f},
-std::array<float,2>{0.247535631f, 0.422021806f},
-std::array<float,2>{0.573390782f, 0.44153142f},
-std::array<float,2>{0.43706882f, 0.828459084f},
-std::array<float,2>{0.771589518f, 0.613045514f},
-std::array<float,2>{0.0228401367f, 0.0883832797f},
-std::array<float,2>{0.893348575f, 0.227063701f},
-std::array<float,2>{0.131591007f, 0.718047738f},
-std::array<float,2>{0.646625936f, 0.910197675f},
-std::array<float,2>{0.327214986f, 0.289377511f},
-std::array<float,2>{0.915732682f, 0.297011673f},
-std::array<float,2>{0.178671196f, 0.932053447f},
-std::array<float,2>{0.666116357f, 0.694232464f},
-std::array<float,2>{0.369691342f, 0.24249962f},
-std::array<float,2>{0.605559945f, 0.0663624182f},
-std::array<float,2>{0.399774551f, 0.602444947f},
-std::array<float,2>{0.794374585f, 0.818990469f},
-std::array<float,2>{0.0576218292f, 0.45331946f},
-std::array<float,2>{0.688284874f, 0.418468356f},
-std::array<float,2>{0.276911706f, 0.77618736f},
-std::array<float,2>{0.976864219f, 0.530576169f},
-std::array<float,2>{0.210724145f, 0.0168059617f},
-std::array<float,2>{0.83310312f, 0.181608126f},
-std::array<float,2>{0.102290668f, 0.646585286f},
-std::array<float,2>{0.535461426f, 0.994089186f},
-std::array<float,2>{0.439648807f, 0.327660054f},
-std::array<float,2>{0.765236795f, 0.468896925f},
-std::array<float,2>{0.00408352725f, 0.867170274f},
-std::array<float,2>{0.591825545f, 0.580102384f},
-std::array<float,2>{0.412218124f, 0.121854782f},
-std::array<float,2>{0.632080317f, 0.190307543f},
-std::array<float,2>{0.328207791f, 0.746217728f},
-std::array<float,2>{0.888442695f, 0.905770063f},
-std::array<float,2>{0.147850245f, 0.256563365f},
-std::array<float,2>{0.504928708f, 0.365952104f},
-std::array<float,2>{0.487982363f, 0.967220783f},
-std::array<float,2>{0.849028289f, 0.67019695f},
-std::array<float,2>{0.0924900547f, 0.135843351f},
-std::array<float,2>{0.938654125f, 0.0615872405f},
-std::array<float,2>{0.229470715f, 0.545164227f},
-std::array<float,2>{0.731718481f, 0.793178141f},
-std::array<float,2>{0.30595997f, 0.38150999f},
-std::array<float,2>{0.876304448f, 0.466119289f},
-std::array<float,2>{0.148964852f, 0.821163356f},
-std::array<float,2>{0.635381818f, 0.594607234f},
-std::array<float,2>{0.336418152f, 0.0757187232f},
-std::array<float,2>{0.583103299f, 0.238306209f},
-std::array<float,2>{0.415746957f, 0.697445869f},
-std::array<float,2>{0.75467658f, 0.927119136f},
-std::array<float,2>{0.0150179006f, 0.310012072f},
-std::array<float,2>{0.726505816f, 0.313572198f},
-std::array<float,2>{0.301973522f, 0.988665521f},
-std::array<float,2>{0.949934483f, 0.651488841f},
-std::array<float,2>{0.224445984f, 0.174857974f},
-std::array<float,2>{0.856344879f, 0.0248940028f},
-std::array<float,2>{0.084955506f, 0.518143833f},
-std::array<float,2>{0.512822449f, 0.771169782f},
-std::array<float,2>{0.498535365f, 0.411725879f},
-std::array<float,2>{0.786970973f, 0.263549f},
-std::array<float,2>{0.0473612472f, 0.895046115f},
-std::array<float,2>{0.600972533f, 0.737987697f},
-std::array<float,2>{0.397443116f, 0.199992016f},
-std::array<float,2>{0.659877658f, 0.115432121f},
-std::array<float,2>{0.36570549f, 0.590107143f},
-std::array<float,2>{0.907651246f, 0.868852317f},
-std::array<float,2>{0.186396137f, 0.481463224f},
-std::array<float,2>{0.540034711f, 0.384145021f},
-std::array<float,2>{0.448640049f, 0.78666544f},
-std::array<float,2>{0.840945959f, 0.536679685f},
-std::array<float,2>{0.0992878973f, 0.0469462685f},
-std::array<float,2>{0.970364511f, 0.127091631f},
-std::array<float,2>{0.213170782f, 0.657674074f},
-std::array<float,2>{0.701605856f, 0.958582759f},
-std::array<float,2>{0.267077833f, 0.374735981f},
-std::array<float,2>{0.968259394f, 0.347181231f},
-std::array<float,2>{0.240866572f, 0.949602485f},
-std::array<float,2>{0.739597082f, 0.684087753f},
-std::array<float,2>{0.282693803f, 0.15112859f},
-std::array<float,2>{0.516875744f, 0.0454504713f},
-std::array<float,2>{0.480344087f, 0.557951391f},
-std::array<float,2>{0.867917299f, 0.804840624f},
-std::array<float,2>{0.0646958649f, 0.398716033f},
-std::array<float,2>{0.653460264f, 0.497667223f},
-std::array<float,2>{0.315095961f, 0.850811183f},
-std::array<float,2>{0.905933797f, 0.574257672f},
-std::array<float,2>{0.13451618f, 0.0964472443f},
-std::array<float,2>{0.778317213f, 0.215716407f},
-std::array<float,2>{0.0254238471f, 0.719618976f},
-std::array<float,2>{0.564319968f, 0.887498796f},
-std::array<float,2>{0.426961035f, 0.2790232f},
-std::array<float,2>{0.813078701f, 0.435501605f},
-std::array<float,2>{0.111759916f, 0.751040637f},
-std::array<float,2>{0.549045026f, 0.510100603f},
-std::array<float,2>{0.458491564f, 0.015408963f},
-std::array<float,2>{0.70377773f, 0.163883105f},
-std::array<float,2>{0.259589851f, 0.628698826f},
-std::array<float,2>{0.989952445f, 0.980757058f},
-std::array<float,2>{0.196137249f, 0.343355626f},
-std::array<float,2>{0.612291574f, 0.28402108f},
-std::array<float,2>{0.385947287f, 0.917892039f},
-std::array<float,2>{0.798417628f, 0.709335804f},
-std::array<float,2>{0.0435112938f, 0.219737738f},
-std::array<float,2>{0.936437666f, 0.0853010118f},
-std::array<float,2>{0.169568077f, 0.621475399f},
-std::array<float,2>{0.681543887f, 0.838493168f},
-std::array<float,2>{0.358881384f, 0.448979229f},
-std::array<float,2>{0.933450997f, 0.376556009f},
-std::array<float,2>{0.165756628f, 0.790364206f},
-std::array<float,2>{0.684261322f, 0.541592121f},
-std::array<float,2>{0.351938218f, 0.0560630672f},
-std::array<float,2>{0.614372194f, 0.13770318f},
-std::array<float,2>{0.389425486f, 0.667387009f},
-std::array<float,2>{0.801891088f, 0.961869895f},
-std::array<float,2>{0.0425306037f, 0.360160649f},
-std::array<float,2>{0.70984745f, 0.250698209f},
-std::array<float,2>{0.262231201f, 0.899545372f},
-std::array<float,2>{0.986934245f, 0.74551028f},
-std::array<float,2>{0.20228149f, 0.194023848f},
-std::array<float,2>{0.819512308f, 0.118482806f},
-std::array<float,2>{0.114194028f, 0.583341837f},
-std::array<float,2>{0.551317811f, 0.859934032f},
-std::array<float,2>{0.456259221f, 0.475603908f},
-std::array<float,2>{0.775820851f, 0.32151252f},
-std::array<float,2>{0.0301991235f, 0.999931693f},
-std::array<float,2>{0.569183826f, 0.642278552f},
-std::array<float,2>{0.422414035f, 0.183925375f},
-std::array<float,2>{0.649920642f, 0.0201611444f},
-std::array<float,2>{0.319720328f, 0.525880516f},
-std::array<float,2>{0.90002501f, 0.779231071f},
-std::array<float,2>{0.138394728f, 0.41726014f},
-std::array<float,2>{0.519655645f, 0.459932864f},
-std::array<float,2>{0.481190145f, 0.813837945f},
-std::array<float,2>{0.872705579f, 0.60913229f},
-std::array<float,2>{0.0692573488f, 0.0671596527f},
-std::array<float,2>{0.962465167f, 0.24786903f},
-std::array<float,2>{0.238194659f, 0.691236556f},
-std::array<float,2>{0.735464215f, 0.934230924f},
-std::array<float,2>{0.28527686f, 0.303077281f},
-std::array<float,2>{0.97560209f, 0.29521668f},
-std::array<float,2>{0.216877699f, 0.906493127f},
-std::array<float,2>{0.696203113f, 0.713611543f},
-std::array<float,2>{0.272654563f, 0.230627805f},
-std::array<float,2>{0.543661594f, 0.0927044749f},
-std::array<float,2>{0.451949805f, 0.616557539f},
-std::array<float,2>{0.837713599f, 0.833999097f},
-std::array<float,2>{0.0944332704f, 0.439925998f},
-std::array<float,2>{0.662861407f, 0.429009378f},
-std::array<float,2>{0.362677217f, 0.765075684f},
-std::array<float,2>{0.911508501f, 0.50387007f},
-std::array<float,2>{0.183128163f, 0.00670804363f},
-std::array<float,2>{0.782236278f, 0.169580713f},
-std::array<float,2>{0.054250937f, 0.633284569f},
-std::array<float,2>{0.596592605f, 0.972833455f},
-std::array<float,2>{0.391778082f, 0.335138142f},
-std::array<float,2>{0.854886174f, 0.490133315f},
-std::array<float,2>{0.0786036104f, 0.85846746f},
-std::array<float,2>{0.509202242f, 0.565130651f},
-std::array<float,2>{0.494038284f, 0.104600996f},
-std::array<float,2>{0.721710742f, 0.207867622f},
-std::array<float,2>{0.297013074f, 0.730103552f},
-std::array<float,2>{0.94606775f, 0.878235579f},
-std::array<float,2>{0.222037345f, 0.272536784f},
-std::array<float,2>{0.580582261f, 0.356887221f},
-std::array<float,2>{0.418115973f, 0.9411937f},
-std::array<float,2>{0.753450036f, 0.677221298f},
-std::array<float,2>{0.0101739038f, 0.146654606f},
-std::array<float,2>{0.878965497f, 0.0353946127f},
-std::array<float,2>{0.155554071f, 0.554015338f},
-std::array<float,2>{0.639958084f, 0.798692763f},
-std::array<float,2>{0.341048539f, 0.39076224f},
-std::array<float,2>{0.943124175f, 0.450470388f},
-std::array<float,2>{0.233414382f, 0.841657877f},
-std::array<float,2>{0.730439186f, 0.621009171f},
-std::array<float,2>{0.309776932f, 0.0787565261f},
-std::array<float,2>{0.503489316f, 0.222863793f},
-std::array<float,2>{0.491803467f, 0.705367506f},
-std::array<float,2>{0.847631991f, 0.919395685f},
-std::array<float,2>{0.0864422992f, 0.286251605f},
-std::array<float,2>{0.628292143f, 0.337460637f},
-std::array<float,2>{0.332656771f, 0.979716837f},
-std::array<float,2>{0.884822667f, 0.62970829f},
-std::array<float,2>{0.142753392f, 0.158015862f},
-std::array<float,2>{0.757918179f, 0.0092880521f},
-std::array<float,2>{0.00195989711f, 0.512770236f},
-std::array<float,2>{0.588593662f, 0.755474567f},
-std::array<float,2>{0.409571767f, 0.431182146f},
-std::array<float,2>{0.829681456f, 0.27398628f},
-std::array<float,2>{0.107073046f, 0.885810733f},
-std::array<float,2>{0.534002721f, 0.724112272f},
-std::array<float,2>{0.44454509f, 0.213950232f},
-std::array<float,2>{0.693243563f, 0.101557389f},
-std::array<float,2>{0.279311925f, 0.574171245f},
-std::array<float,2>{0.981385469f, 0.845739245f},
-std::array<float,2>{0.203802884f, 0.495758176f},
-std::array<float,2>{0.602392673f, 0.404511958f},
-std::array<float,2>{0.405504465f, 0.811141014f},
-std::array<float,2>{0.791771114f, 0.559958279f},
-std::array<float,2>{0.0618541054f, 0.0408718698f},
-std::array<float,2>{0.919401646f, 0.155173898f},
-std::array<float,2>{0.175331324f, 0.683485508f},
-std::array<float,2>{0.669366002f, 0.948071539f},
-std::array<float,2>{0.372249126f, 0.351020426f},
-std::array<float,2>{0.895725489f, 0.368104249f},
-std::array<float,2>{0.126411825f, 0.954267263f},
-std::array<float,2>{0.643763423f, 0.660645306f},
-std::array<float,2>{0.321776003f, 0.130318388f},
-std::array<float,2>{0.575023651f, 0.0518098883f},
-std::array<float,2>{0.430419236f, 0.534983873f},
-std::array<float,2>{0.768917084f, 0.781980097f},
-std::array<float,2>{0.0192951299f, 0.388808787f},
-std::array<float,2>{0.749973536f, 0.479289949f},
-std::array<float,2>{0.29266265f, 0.874940872f},
-std::array<float,2>{0.959199727f, 0.588615954f},
-std::array<float,2>{0.245928377f, 0.111479931f},
-std::array<float,2>{0.861204207f, 0.197960541f},
-std::array<float,2>{0.0713622198f, 0.738820434f},
-std::array<float,2>{0.526849091f, 0.89287132f},
-std::array<float,2>{0.473483324f, 0.261157006f},
-std::array<float,2>{0.808317184f, 0.409784555f},
-std::array<float,2>{0.0340793803f, 0.768413544f},
-std::array<float,2>{0.623390555f, 0.521346211f},
-std::array<float,2>{0.379376173f, 0.0277596451f},
-std::array<float,2>{0.675740659f, 0.17717807f},
-std::array<float,2>{0.345885724f, 0.653463185f},
-std::array<float,2>{0.924478531f, 0.986278296f},
-std::array<float,2>{0.158158883f, 0.319823831f},
-std::array<float,2>{0.554756701f, 0.305176198f},
-std::array<float,2>{0.463158578f, 0.924622774f},
-std::array<float,2>{0.821542859f, 0.701758862f},
-std::array<float,2>{0.120821841f, 0.23683767f},
-std::array<float,2>{0.998555183f, 0.0721462816f},
-std::array<float,2>{0.191798672f, 0.598760426f},
-std::array<float,2>{0.714961052f, 0.827869296f},
-std::array<float,2>{0.251643449f, 0.464565426f},
-std::array<float,2>{0.989277303f, 0.435871452f},
-std::array<float,2>{0.195727319f, 0.752849221f},
-std::array<float,2>{0.703287661f, 0.50872457f},
-std::array<float,2>{0.259262502f, 0.0129625099f},
-std::array<float,2>{0.549803197f, 0.161025226f},
-std::array<float,2>{0.458696067f, 0.626900673f},
-std::array<float,2>{0.812561691f, 0.983914673f},
-std::array<float,2>{0.111885317f, 0.339855462f},
-std::array<float,2>{0.680666387f, 0.281823158f},
-std::array<float,2>{0.35916698f, 0.915244401f},
-std::array<float,2>{0.935668528f, 0.707344353f},
-std::array<float,2>{0.169303715f, 0.220868334f},
-std::array<float,2>{0.797972858f, 0.0821265355f},
-std::array<float,2>{0.0432119854f, 0.624114692f},
-std::array<float,2>{0.611418128f, 0.836634994f},
-std::array<float,2>{0.386535376f, 0.446412355f},
-std::array<float,2>{0.86731708f, 0.345374674f},
-std::array<float,2>{0.0649470538f, 0.951535106f},
-std::array<float,2>{0.517364144f, 0.687160015f},
-std::array<float,2>{0.479732335f, 0.150068864f},
-std::array<float,2>{0.739872694f, 0.0445026942f},
-std::array<float,2>{0.28297323f, 0.555338621f},
-std::array<float,2>{0.968652904f, 0.807658315f},
-std::array<float,2>{0.240625679f, 0.401686817f},
-std::array<float,2>{0.563820004f, 0.499731719f},
-std::array<float,2>{0.427271396f, 0.848764956f},
-std::array<float,2>{0.777681053f, 0.576685011f},
-std::array<float,2>{0.0259821154f, 0.0951233655f},
-std::array<float,2>{0.905463517f, 0.217274323f},
-std::array<float,2>{0.134221867f, 0.721665084f},
-std::array<float,2>{0.653922319f, 0.889610469f},
-std::array<float,2>{0.314519018f, 0.279767096f},
-std::array<float,2>{0.90808624f, 0.264910996f},
-std::array<float,2>{0.18590343f, 0.897548497f},
-std::array<float,2>{0.659397185f, 0.734898269f},
-std::array<float,2>{0.365818739f, 0.201779738f},
-std::array<float,2>{0.601152241f, 0.11476177f},
-std::array<float,2>{0.396962047f, 0.592570484f},
-std::array<float,2>{0.786153495f, 0.870522857f},
-std::array<float,2>{0.0476119183f, 0.483469009f},
-std::array<float,2>{0.701891065f, 0.386598796f},
-std::array<float,2>{0.267203301f, 0.787158489f},
-std::array<float,2>{0.969756186f, 0.538527787f},
-std::array<float,2>{0.213416055f, 0.050201498f},
-std::array<float,2>{0.841346025f, 0.126080573f},
-std::array<float,2>{0.0987463519f, 0.658266187f},
-std::array<float,2>{0.539406836f, 0.959549367f},
-std::array<float,2>{0.449074209f, 0.371248543f},
-std::array<float,2>{0.753995657f, 0.467404634f},
-std::array<float,2>{0.0154224355f, 0.822663188f},
-std::array<float,2>{0.583752215f, 0.59577924f},
-std::array<float,2>{0.415383339f, 0.0770756304f},
-std::array<float,2>{0.635182381f, 0.240281329f},
-std::array<float,2>{0.336518973f, 0.696131766f},
-std::array<float,2>{0.876826167f, 0.927929461f},
-std::array<float,2>{0.148796186f, 0.311403692f},
-std::array<float,2>{0.51347059f, 0.315839916f},
-std::array<float,2>{0.498408794f, 0.990715921f},
-std::array<float,2>{0.855643392f, 0.649742723f},
-std::array<float,2>{0.0844668522f, 0.173218518f},
-std::array<float,2>{0.949358642f, 0.0266524479f},
-std::array<float,2>{0.223812416f, 0.516644895f},
-std::array<float,2>{0.725791097f, 0.77206248f},
-std::array<float,2>{0.302479476f, 0.413943589f},
-std::array<float,2>{0.888123035f, 0.471139759f},
-std::array<float,2>{0.148393899f, 0.863704741f},
-std::array<float,2>{0.63266325f, 0.57900089f},
-std::array<float,2>{0.32896924f, 0.123076066f},
-std::array<float,2>{0.592697561f, 0.187548846f},
-std::array<float,2>{0.412998021f, 0.748738825f},
-std::array<float,2>{0.764658213f, 0.903472066f},
-std::array<float,2>{0.00453685923f, 0.255678803f},
-std::array<float,2>{0.732058883f, 0.36379528f},
-std::array<float,2>{0.306237459f, 0.965723217f},
-std::array<float,2>{0.939394712f, 0.668213725f},
-std::array<float,2>{0.228636712f, 0.134221405f},
-std::array<float,2>{0.849331379f, 0.0588435829f},
-std::array<float,2>{0.0921319425f, 0.544314086f},
-std::array<float,2>{0.505556583f, 0.796317041f},
-std::array<float,2>{0.487777263f, 0.380739629f},
-std::array<float,2>{0.794555306f, 0.300452977f},
-std::array<float,2>{0.0583569072f, 0.930190206f},
-std::array<float,2>{0.606072068f, 0.692823172f},
-std::array<float,2>{0.400045931f, 0.245447695f},
-std::array<float,2>{0.666733742f, 0.0636657923f},
-std::array<float,2>{0.369622558f, 0.605156124f},
-std::array<float,2>{0.915073037f, 0.816803932f},
-std::array<float,2>{0.178131595f, 0.4565337f},
-std::array<float,2>{0.535703897f, 0.41998142f},
-std::array<float,2>{0.440351486f, 0.773590147f},
-std::array<float,2>{0.833925545f, 0.527579725f},
-std::array<float,2>{0.101712652f, 0.01804257f},
-std::array<float,2>{0.977277577f, 0.182779953f},
-std::array<float,2>{0.209969938f, 0.64486891f},
-std::array<float,2>{0.687916458f, 0.994535089f},
-std::array<float,2>{0.276561677f, 0.324649006f},
-std::array<float,2>{0.955435574f, 0.330634117f},
-std::array<float,2>{0.247728243f, 0.971270263f},
-std::array<float,2>{0.744491935f, 0.637215078f},
-std::array<float,2>{0.295194805f, 0.164528042f},
-std::array<float,2>{0.530130029f, 0.00198249705f},
-std::array<float,2>{0.46998024f, 0.50417304f},
-std::array<float,2>{0.865631759f, 0.759339929f},
-std::array<float,2>{0.0770443082f, 0.424884945f},
-std::array<float,2>{0.64740032f, 0.443674594f},
-std::array<float,2>{0.327850997f, 0.831427217f},
-std::array<float,2>{0.892712951f, 0.609547734f},
-std::array<float,2>{0.131235346f, 0.0871136263f},
-std::array<float,2>{0.772115767f, 0.229900643f},
-std::array<float,2>{0.0229711626f, 0.716015458f},
-std::array<float,2>{0.574147463f, 0.913587391f},
-std::array<float,2>{0.436670095f, 0.292870432f},
-std::array<float,2>{0.825944662f, 0.395075262f},
-std::array<float,2>{0.122801945f, 0.803501546f},
-std::array<float,2>{0.560726166f, 0.549464703f},
-std::array<float,2>{0.464945972f, 0.0343079567f},
-std::array<float,2>{0.711262345f, 0.142841741f},
-std::array<float,2>{0.256728083f, 0.672707856f},
-std::array<float,2>{0.994304121f, 0.942874491f},
-std::array<float,2>{0.190815642f, 0.352625787f},
-std::array<float,2>{0.618488908f, 0.268137246f},
-std::array<float,2>{0.377209485f, 0.880764365f},
-std::array<float,2>{0.810156465f, 0.733314872f},
-std::array<float,2>{0.0354984589f, 0.205745623f},
-std::array<float,2>{0.926015973f, 0.106121145f},
-std::array<float,2>{0.163100943f, 0.569229186f},
-std::array<float,2>{0.677587271f, 0.852301419f},
-std::array<float,2>{0.350388318f, 0.486026704f},
-std::array<float,2>{0.901172221f, 0.415328175f},
-std::array<float,2>{0.139700919f, 0.779464006f},
-std::array<float,2>{0.651337802f, 0.523796856f},
-std::array<float,2>{0.318293214f, 0.0233859029f},
-std::array<float,2>{0.566707373f, 0.186677679f},
-std::array<float,2>{0.42462191f, 0.642753243f},
-std::array<float,2>{0.773788989f, 0.996752918f},
-std::array<float,2>{0.0285905022f, 0.324077964f},
-std::array<float,2>{0.737237751f, 0.301493466f},
-std::array<float,2>{0.288032711f, 0.936306238f},
-std::array<float,2>{0.963207722f, 0.688177466f},
-std::array<float,2>{0.234777316f, 0.248269483f},
-std::array<float,2>{0.874495864f, 0.0696429685f},
-std::array<float,2>{0.0664097071f, 0.607088268f},
-std::array<float,2>{0.522133172f, 0.815559626f},
-std::array<float,2>{0.483207792f, 0.458780646f},
-std::array<float,2>{0.804339349f, 0.362498283f},
-std::array<float,2>{0.0395986661f, 0.964156389f},
-std::array<float,2>{0.615866721f, 0.664745033f},
-std::array<float,2>{0.387695044f, 0.139828309f},
-std::array<float,2>{0.687145054f, 0.0579860024f},
-std::array<float,2>{0.353717566f, 0.540845931f},
-std::array<float,2>{0.931428194f, 0.792427421f},
-std::array<float,2>{0.16649276f, 0.377480179f},
-std::array<float,2>{0.553935111f, 0.473865449f},
-std::array<float,2>{0.453177452f, 0.862359226f},
-std::array<float,2>{0.817310214f, 0.584090889f},
-std::array<float,2>{0.116726682f, 0.120152518f},
-std::array<float,2>{0.985945225f, 0.192378968f},
-std::array<float,2>{0.199612111f, 0.742795229f},
-std::array<float,2>{0.708649457f, 0.900736749f},
-std::array<float,2>{0.265090525f, 0.252386659f},
-std::array<float,2>{0.948102653f, 0.269924402f},
-std::array<float,2>{0.220074266f, 0.876625896f},
-std::array<float,2>{0.719788074f, 0.728360534f},
-std::array<float,2>{0.300191849f, 0.209982514f},
-std::array<float,2>{0.509923398f, 0.102083489f},
-std::array<float,2>{0.495380729f, 0.563961446f},
-std::array<float,2>{0.85274756f, 0.856819987f},
-std::array<float,2>{0.0802801922f, 0.490759104f},
-std::array<float,2>{0.638279378f, 0.393551469f},
-std::array<float,2>{0.343280911f, 0.799900115f},
-std::array<float,2>{0.88192755f, 0.550921261f},
-std::array<float,2>{0.153506875f, 0.0388465375f},
-std::array<float,2>{0.750930309f, 0.146210551f},
-std::array<float,2>{0.00933332182f, 0.678067386f},
-std::array<float,2>{0.578851581f, 0.937959135f},
-std::array<float,2>{0.421108514f, 0.35894087f},
-std::array<float,2>{0.838258266f, 0.438424677f},
-std::array<float,2>{0.096285671f, 0.832249284f},
-std::array<float,2>{0.546355546f, 0.613493443f},
-std::array<float,2>{0.450079262f, 0.090049848f},
-std::array<float,2>{0.697544396f, 0.233057722f},
-std::array<float,2>{0.270995766f, 0.711458683f},
-std::array<float,2>{0.973043978f, 0.908646584f},
-std::array<float,2>{0.214958921f, 0.293248028f},
-std::array<float,2>{0.594624281f, 0.332276881f},
-std::array<float,2>{0.394402713f, 0.974939048f},
-std::array<float,2>{0.784326971f, 0.636559069f},
-std::array<float,2>{0.0513810106f, 0.170233831f},
-std::array<float,2>{0.913704097f, 0.00513174431f},
-std::array<float,2>{0.181264341f, 0.501419008f},
-std::array<float,2>{0.66192776f, 0.763261259f},
-std::array<float,2>{0.359499186f, 0.426876843f},
-std::array<float,2>{0.984068155f, 0.493072331f},
-std::array<float,2>{0.206988737f, 0.845389009f},
-std::array<float,2>{0.693747818f, 0.571807683f},
-std::array<float,2>{0.277386159f, 0.098398298f},
-std::array<float,2>{0.53132081f, 0.210990965f},
-std::array<float,2>{0.442188799f, 0.725976467f},
-std::array<float,2>{0.831059396f, 0.884169042f},
-std::array<float,2>{0.109325871f, 0.276352942f},
-std::array<float,2>{0.670148909f, 0.348501652f},
-std::array<float,2>{0.373591423f, 0.946342111f},
-std::array<float,2>{0.92000258f, 0.68015635f},
-std::array<float,2>{0.173188537f, 0.154155374f},
-std::array<float,2>{0.789240897f, 0.0425636135f},
-std::array<float,2>{0.0595056936f, 0.561576068f},
-std::array<float,2>{0.604200542f, 0.809276998f},
-std::array<float,2>{0.402853698f, 0.402923256f},
-std::array<float,2>{0.84395206f, 0.287333876f},
-std::array<float,2>{0.0883542523f, 0.920625627f},
-std::array<float,2>{0.500855863f, 0.703680634f},
-std::array<float,2>{0.488423318f, 0.225752532f},
-std::array<float,2>{0.728030086f, 0.0820105299f},
-std::array<float,2>{0.312464625f, 0.618760765f},
-std::array<float,2>{0.944319367f, 0.84248203f},
-std::array<float,2>{0.230564609f, 0.452456862f},
-std::array<float,2>{0.586523294f, 0.433579326f},
-std::array<float,2>{0.407341778f, 0.756149888f},
-std::array<float,2>{0.761293471f, 0.514932215f},
-std::array<float,2>{0.000560193846f, 0.0113846622f},
-std::array<float,2>{0.883279443f, 0.159156919f},
-std::array<float,2>{0.142553538f, 0.630982339f},
-std::array<float,2>{0.625194073f, 0.977438629f},
-std::array<float,2>{0.334181994f, 0.338656843f},
-std::array<float,2>{0.922650814f, 0.316549808f},
-std::array<float,2>{0.158853367f, 0.987828374f},
-std::array<float,2>{0.673722863f, 0.654792428f},
-std::array<float,2>{0.345594317f, 0.178960174f},
-std::array<float,2>{0.621568561f, 0.0305927675f},
-std::array<float,2>{0.382169127f, 0.522594154f},
-std::array<float,2>{0.805611491f, 0.76663363f},
-std::array<float,2>{0.0312916562f, 0.407451898f},
-std::array<float,2>{0.716818333f, 0.462574631f},
-std::array<float,2>{0.252174824f, 0.825673997f},
-std::array<float,2>{0.996746182f, 0.601251721f},
-std::array<float,2>{0.195242628f, 0.0726001486f},
-std::array<float,2>{0.823038578f, 0.234481409f},
-std::array<float,2>{0.118041493f, 0.700067639f},
-std::array<float,2>{0.557009637f, 0.921928525f},
-std::array<float,2>{0.462492585f, 0.307866424f},
-std::array<float,2>{0.766388774f, 0.387630105f},
-std::array<float,2>{0.0161548033f, 0.783320129f},
-std::array<float,2>{0.577424228f, 0.532545686f},
-std::array<float,2>{0.432239741f, 0.0536221117f},
-std::array<float,2>{0.641725779f, 0.131787762f},
-std::array<float,2>{0.322975129f, 0.662271559f},
-std::array<float,2>{0.897891819f, 0.955476761f},
-std::array<float,2>{0.127536818f, 0.370371699f},
-std::array<float,2>{0.524476647f, 0.258862346f},
-std::array<float,2>{0.475037158f, 0.891502023f},
-std::array<float,2>{0.862896442f, 0.740255713f},
-std::array<float,2>{0.072543636f, 0.196578979f},
-std::array<float,2>{0.957340181f, 0.110203072f},
-std::array<float,2>{0.242673427f, 0.586113095f},
-std::array<float,2>{0.746582508f, 0.872277915f},
-std::array<float,2>{0.290487915f, 0.47760874f},
-std::array<float,2>{0.966404736f, 0.399111062f},
-std::array<float,2>{0.238414705f, 0.805494785f},
-std::array<float,2>{0.740342379f, 0.558203459f},
-std::array<float,2>{0.284231752f, 0.0453267209f},
-std::array<float,2>{0.518543303f, 0.150815189f},
-std::array<float,2>{0.476882577f, 0.683734953f},
-std::array<float,2>{0.869607747f, 0.950188816f},
-std::array<float,2>{0.0631060675f, 0.346680135f},
-std::array<float,2>{0.65455097f, 0.278545678f},
-std::array<float,2>{0.31290704f, 0.886954546f},
-std::array<float,2>{0.904040515f, 0.719205678f},
-std::array<float,2>{0.135104224f, 0.21524094f},
-std::array<float,2>{0.779403925f, 0.0960964933f},
-std::array<float,2>{0.0243795905f, 0.57492131f},
-std::array<float,2>{0.564685583f, 0.851126611f},
-std::array<float,2>{0.428134918f, 0.497295439f},
-std::array<float,2>{0.814837098f, 0.343006998f},
-std::array<float,2>{0.110372864f, 0.981093466f},
-std::array<float,2>{0.548815846f, 0.62812984f},
-std::array<float,2>{0.459085375f, 0.163167909f},
-std::array<float,2>{0.705597639f, 0.0148697579f},
-std::array<float,2>{0.260395944f, 0.510427177f},
-std::array<float,2>{0.991801381f, 0.751773953f},
-std::array<float,2>{0.198107958f, 0.434950411f},
-std::array<float,2>{0.609420538f, 0.448298365f},
-std::array<float,2>{0.383352607f, 0.838131487f},
-std::array<float,2>{0.800194144f, 0.621613324f},
-std::array<float,2>{0.0468247458f, 0.0858817771f},
-std::array<float,2>{0.935272157f, 0.220678002f},
-std::array<float,2>{0.170193985f, 0.709662199f},
-std::array<float,2>{0.681926012f, 0.917154849f},
-std::array<float,2>{0.355731875f, 0.283447027f},
-std::array<float,2>{0.877427459f, 0.310456306f},
-std::array<float,2>{0.150932446f, 0.92761761f},
-std::array<float,2>{0.633065462f, 0.69813925f},
-std::array<float,2>{0.338285357f, 0.239038482f},
-std::array<float,2>{0.585545719f, 0.0756731331f},
-std::array<float,2>{0.417130411f, 0.594029367f},
-std::array<float,2>{0.756425321f, 0.820322752f},
-std::array<float,2>{0.0133649418f, 0.466358364f},
-std::array<float,2>{0.723057389f, 0.411607325f},
-std::array<float,2>{0.304533571f, 0.770581841f},
-std::array<float,2>{0.951337159f, 0.517844319f},
-std::array<float,2>{0.225318685f, 0.0251110476f},
-std::array<float,2>{0.85763979f, 0.175618991f},
-std::array<float,2>{0.0826508179f, 0.652168214f},
-std::array<float,2>{0.513879836f, 0.989216089f},
-std::array<float,2>{0.496125251f, 0.314428836f},
-std::array<float,2>{0.788037121f, 0.482089937f},
-std::array<float,2>{0.0500414632f, 0.868275046f},
-std::array<float,2>{0.598677576f, 0.590702772f},
-std::array<float,2>{0.396249026f, 0.116027489f},
-std::array<float,2>{0.656438828f, 0.199518189f},
-std::array<float,2>{0.363692522f, 0.737357795f},
-std::array<float,2>{0.90968585f, 0.894661367f},
-std::array<float,2>{0.184992626f, 0.262883782f},
-std::array<float,2>{0.54266721f, 0.37436834f},
-std::array<float,2>{0.445683002f, 0.95847559f},
-std::array<float,2>{0.84307909f, 0.658078909f},
-std::array<float,2>{0.0997349992f, 0.127491161f},
-std::array<float,2>{0.971500099f, 0.047672078f},
-std::array<float,2>{0.211802512f, 0.536451995f},
-std::array<float,2>{0.700426102f, 0.786145866f},
-std::array<float,2>{0.268916219f, 0.384464264f},
-std::array<float,2>{0.916988373f, 0.453811377f},
-std::array<float,2>{0.176971167f, 0.818583727f},
-std::array<float,2>{0.664681077f, 0.602019489f},
-std::array<float,2>{0.368056148f, 0.0654498562f},
-std::array<float,2>{0.608487248f, 0.242765754f},
-std::array<float,2>{0.402237684f, 0.693446279f},
-std::array<float,2>{0.796182215f, 0.932569146f},
-std::array<float,2>{0.0554389544f, 0.297696143f},
-std::array<float,2>{0.690055728f, 0.327417314f},
-std::array<float,2>{0.275091618f, 0.993442059f},
-std::array<float,2>{0.980404079f, 0.647305548f},
-std::array<float,2>{0.207455143f, 0.180996716f},
-std::array<float,2>{0.83490783f, 0.017152695f},
-std::array<float,2>{0.105019569f, 0.531245291f},
-std::array<float,2>{0.538072824f, 0.7757622f},
-std::array<float,2>{0.437554777f, 0.418358296f},
-std::array<float,2>{0.762367427f, 0.25615555f},
-std::array<float,2>{0.00691429153f, 0.905593276f},
-std::array<float,2>{0.590428233f, 0.746904671f},
-std::array<float,2>{0.410268068f, 0.189895034f},
-std::array<float,2>{0.629538f, 0.121251456f},
-std::array<float,2>{0.331670552f, 0.580845296f},
-std::array<float,2>{0.889513195f, 0.866493464f},
-std::array<float,2>{0.146454349f, 0.469603747f},
-std::array<float,2>{0.507205069f, 0.381258547f},
-std::array<float,2>{0.485850364f, 0.793487072f},
-std::array<float,2>{0.849752069f, 0.545761347f},
-std::array<float,2>{0.0902306661f, 0.0624004081f},
-std::array<float,2>{0.941361368f, 0.136615917f},
-std::array<float,2>{0.227128878f, 0.670628488f},
-std::array<float,2>{0.732729793f, 0.967663527f},
-std::array<float,2>{0.307990938f, 0.365716577f},
-std::array<float,2>{0.993936419f, 0.355234027f},
-std::array<float,2>{0.189127505f, 0.944001913f},
-std::array<float,2>{0.713970482f, 0.67459923f},
-std::array<float,2>{0.255525857f, 0.142434359f},
-std::array<float,2>{0.55913806f, 0.0320149064f},
-std::array<float,2>{0.466930807f, 0.5470016f},
-std::array<float,2>{0.826678932f, 0.801866472f},
-std::array<float,2>{0.123514965f, 0.398117483f},
-std::array<float,2>{0.679166734f, 0.486547709f},
-std::array<float,2>{0.348823398f, 0.855062723f},
-std::array<float,2>{0.929329872f, 0.567294478f},
-std::array<float,2>{0.16168119f, 0.108203456f},
-std::array<float,2>{0.81237942f, 0.204939902f},
-std::array<float,2>{0.03843702f, 0.730612695f},
-std::array<float,2>{0.620374382f, 0.88094306f},
-std::array<float,2>{0.376637608f, 0.266406238f},
-std::array<float,2>{0.865132451f, 0.422719151f},
-std::array<float,2>{0.0749413595f, 0.76086235f},
-std::array<float,2>{0.528368056f, 0.507454574f},
-std::array<float,2>{0.471691787f, 0.000221626266f},
-std::array<float,2>{0.742695928f, 0.167352572f},
-std::array<float,2>{0.293400377f, 0.639363825f},
-std::array<float,2>{0.953395605f, 0.970546424f},
-std::array<float,2>{0.249135315f, 0.328794748f},
-std::array<float,2>{0.571837008f, 0.290003926f},
-std::array<float,2>{0.433752894f, 0.910678506f},
-std::array<float,2>{0.77014631f, 0.71844852f},
-std::array<float,2>{0.0201444961f, 0.226613641f},
-std::array<float,2>{0.891991436f, 0.0879941955f},
-std::array<float,2>{0.130471259f, 0.612598538f},
-std::array<float,2>{0.645772755f, 0.828929484f},
-std::array<float,2>{0.324852228f, 0.442032784f},
-std::array<float,2>{0.881149054f, 0.392565459f},
-std::array<float,2>{0.152580127f, 0.79717356f},
-std::array<float,2>{0.637268901f, 0.553189337f},
-std::array<float,2>{0.341910928f, 0.0370216481f},
-std::array<float,2>{0.579160035f, 0.147505835f},
-std::array<float,2>{0.420631081f, 0.676190138f},
-std::array<float,2>{0.751701117f, 0.939615488f},
-std::array<float,2>{0.00828494038f, 0.355713606f},
-std::array<float,2>{0.719312727f, 0.271883279f},
-std::array<float,2>{0.299213409f, 0.877790928f},
-std::array<float,2>{0.949085534f, 0.729487121f},
-std::array<float,2>{0.218896598f, 0.208877593f},
-std::array<float,2>{0.852356076f, 0.10376364f},
-std::array<float,2>{0.0819470212f, 0.56637603f},
-std::array<float,2>{0.511461973f, 0.857911646f},
-std::array<float,2>{0.494873971f, 0.488537818f},
-std::array<float,2>{0.783452034f, 0.334441453f},
-std::array<float,2>{0.0522553176f, 0.973726511f},
-std::array<float,2>{0.595672846f, 0.634004056f},
-std::array<float,2>{0.393406212f, 0.168796033f},
-std::array<float,2>{0.660444379f, 0.00731280167f},
-std::array<float,2>{0.360367745f, 0.502121687f},
-std::array<float,2>{0.912843883f, 0.764146447f},
-std::array<float,2>{0.180091292f, 0.428228319f},
-std::array<float,2>{0.545774698f, 0.441207916f},
-std::array<float,2>{0.450870395f, 0.835520208f},
-std::array<float,2>{0.839362383f, 0.615282178f},
-std::array<float,2>{0.0973752216f, 0.0931790546f},
-std::array<float,2>{0.974145949f, 0.231608704f},
-std::array<float,2>{0.216017827f, 0.714413941f},
-std::array<float,2>{0.699188471f, 0.907796323f},
-std::array<float,2>{0.269951463f, 0.296839565f},
-std::array<float,2>{0.964599252f, 0.304178417f},
-std::array<float,2>{0.235981986f, 0.935492218f},
-std::array<float,2>{0.737783492f, 0.689529479f},
-std::array<float,2>{0.288763016f, 0.246864408f},
-std::array<float,2>{0.522517681f, 0.0677394941f},
-std::array<float,2>{0.483515888f, 0.607721031f},
-std::array<float,2>{0.873895884f, 0.812723219f},
-std::array<float,2>{0.067816481f, 0.460457206f},
-std::array<float,2>{0.652073741f, 0.416116804f},
-std::array<float,2>{0.316864222f, 0.77801007f},
-std::array<float,2>{0.902274787f, 0.526989818f},
-std::array<float,2>{0.139487609f, 0.0207104329f},
-std::array<float,2>{0.774493933f, 0.185274139f},
-std::array<float,2>{0.0277548619f, 0.640675366f},
-std::array<float,2>{0.568045735f, 0.998621583f},
-std::array<float,2>{0.424938977f, 0.320790142f},
-std::array<float,2>{0.817550063f, 0.47510004f},
-std::array<float,2>{0.116112567f, 0.86114198f},
-std::array<float,2>{0.552973568f, 0.58298552f},
-std::array<float,2>{0.454386532f, 0.117199719f},
-std::array<float,2>{0.707115233f, 0.194805011f},
-std::array<float,2>{0.264083534f, 0.744592905f},
-std::array<float,2>{0.985133529f, 0.898927748f},
-std::array<float,2>{0.200250581f, 0.251934469f},
-std::array<float,2>{0.616865158f, 0.36079374f},
-std::array<float,2>{0.38795656f, 0.9624843f},
-std::array<float,2>{0.803523183f, 0.666323483f},
-std::array<float,2>{0.0407871269f, 0.136904165f},
-std::array<float,2>{0.930402815f, 0.0547158569f},
-std::array<float,2>{0.167830139f, 0.542924643f},
-std::array<float,2>{0.686393201f, 0.789248228f},
-std::array<float,2>{0.355260998f, 0.375661194f},
-std::array<float,2>{0.997406721f, 0.463440597f},
-std::array<float,2>{0.193826109f, 0.826554716f},
-std::array<float,2>{0.718267977f, 0.597839117f},
-std::array<float,2>{0.253443182f, 0.0709039867f},
-std::array<float,2>{0.557756782f, 0.237642914f},
-std::array<float,2>{0.461325854f, 0.702420413f},
-std::array<float,2>{0.824014962f, 0.925657332f},
-std::array<float,2>{0.118190981f, 0.306074083f},
-std::array<float,2>{0.672765493f, 0.318921894f},
-std::array<float,2>{0.344392896f, 0.985258043f},
-std::array<float,2>{0.923475027f, 0.652503133f},
-std::array<float,2>{0.160094246f, 0.17623584f},
-std::array<float,2>{0.805828929f, 0.0292921383f},
-std::array<float,2>{0.0325766876f, 0.52009958f},
-std::array<float,2>{0.62297678f, 0.769128561f},
-std::array<float,2>{0.381755173f, 0.408209234f},
-std::array<float,2>{0.862160087f, 0.260021865f},
-std::array<float,2>{0.0739052668f, 0.894508839f},
-std::array<float,2>{0.524178147f, 0.740205109f},
-std::array<float,2>{0.476066113f, 0.198509201f},
-std::array<float,2>{0.747887135f, 0.112390742f},
-std::array<float,2>{0.289797962f, 0.589689732f},
-std::array<float,2>{0.958181739f, 0.873362958f},
-std::array<float,2>{0.243825987f, 0.480184287f},
-std::array<float,2>{0.576254666f, 0.389917254f},
-std::array<float,2>{0.43273738f, 0.782669306f},
-std::array<float,2>{0.767363667f, 0.533511281f},
-std::array<float,2>{0.0174031276f, 0.050943166f},
-std::array<float,2>{0.896930933f, 0.129363373f},
-std::array<float,2>{0.128622487f, 0.661659479f},
-std::array<float,2>{0.641058266f, 0.95356679f},
-std::array<float,2>{0.323576868f, 0.368611932f},
-std::array<float,2>{0.921064138f, 0.349969834f},
-std::array<float,2>{0.172249407f, 0.949141264f},
-std::array<float,2>{0.671075225f, 0.681654751f},
-std::array<float,2>{0.374457628f, 0.156191111f},
-std::array<float,2>{0.605442822f, 0.0399214849f},
-std::array<float,2>{0.404076278f, 0.558904588f},
-std::array<float,2>{0.790164292f, 0.811993361f},
-std::array<float,2>{0.0602459274f, 0.405393332f},
-std::array<float,2>{0.694488347f, 0.494939297f},
-std::array<float,2>{0.27895239f, 0.846884072f},
-std::array<float,2>{0.983372569f, 0.573119223f},
-std::array<float,2>{0.205748573f, 0.100542299f},
-std::array<float,2>{0.830580056f, 0.213283524f},
-std::array<float,2>{0.107530333f, 0.7228778f},
-std::array<float,2>{0.533105195f, 0.885077477f},
-std::array<float,2>{0.442822635f, 0.275117069f},
-std::array<float,2>{0.760066092f, 0.430157542f},
-std::array<float,2>{0.00168094831f, 0.754491389f},
-std::array<float,2>{0.587650895f, 0.511778474f},
-std::array<float,2>{0.406993419f, 0.00844845921f},
-std::array<float,2>{0.626751184f, 0.156329036f},
-std::array<float,2>{0.335339844f, 0.629928529f},
-std::array<float,2>{0.884158671f, 0.978801608f},
-std::array<float,2>{0.141597539f, 0.336452961f},
-std::array<float,2>{0.501383543f, 0.285373688f},
-std::array<float,2>{0.489331067f, 0.918912649f},
-std::array<float,2>{0.845387816f, 0.706857741f},
-std::array<float,2>{0.0893409401f, 0.223838225f},
-std::array<float,2>{0.944705367f, 0.080000028f},
-std::array<float,2>{0.232157215f, 0.619804859f},
-std::array<float,2>{0.727187634f, 0.840579391f},
-std::array<float,2>{0.311344504f, 0.449382991f},
-std::array<float,2>{0.95267117f, 0.412766248f},
-std::array<float,2>{0.226282433f, 0.772899449f},
-std::array<float,2>{0.724225879f, 0.516559541f},
-std::array<float,2>{0.302755505f, 0.0255154204f},
-std::array<float,2>{0.515189767f, 0.172585145f},
-std::array<float,2>{0.497520864f, 0.649115026f},
-std::array<float,2>{0.858917952f, 0.991288602f},
-std::array<float,2>{0.083439f, 0.314876705f},
-std::array<float,2>{0.63414216f, 0.312041372f},
-std::array<float,2>{0.33960101f, 0.929126322f},
-std::array<float,2>{0.87861681f, 0.697035372f},
-std::array<float,2>{0.152023971f, 0.241539925f},
-std::array<float,2>{0.757417917f, 0.0779995471f},
-std::array<float,2>{0.0125927441f, 0.597096801f},
-std::array<float,2>{0.584870338f, 0.823468268f},
-std::array<float,2>{0.416918367f, 0.467945129f},
-std::array<float,2>{0.842238724f, 0.372127056f},
-std::array<float,2>{0.100996867f, 0.960398078f},
-std::array<float,2>{0.541055858f, 0.659219682f},
-std::array<float,2>{0.44724676f, 0.125080839f},
-std::array<float,2>{0.699295878f, 0.0489447974f},
-std::array<float,2>{0.268191546f, 0.537943959f},
-std::array<float,2>{0.972588897f, 0.789038539f},
-std::array<float,2>{0.212559372f, 0.384833395f},
-std::array<float,2>{0.598003685f, 0.483066052f},
-std::array<float,2>{0.395090669f, 0.87008512f},
-std::array<float,2>{0.788957655f, 0.593748093f},
-std::array<float,2>{0.049499806f, 0.113629088f},
-std::array<float,2>{0.908926904f, 0.202359125f},
-std::array<float,2>{0.184145719f, 0.735956788f},
-std::array<float,2>{0.657860816f, 0.896564841f},
-std::array<float,2>{0.364293337f, 0.264068216f},
-std::array<float,2>{0.902859807f, 0.280553788f},
-std::array<float,2>{0.13651365f, 0.889899015f},
-std::array<float,2>{0.655881286f, 0.722173095f},
-std::array<float,2>{0.31435895f, 0.218555897f},
-std::array<float,2>{0.565574229f, 0.0939201266f},
-std::array<float,2>{0.428954452f, 0.577381492f},
-std::array<float,2>{0.781128585f, 0.848346233f},
-std::array<float,2>{0.0249091703f, 0.498102307f},
-std::array<float,2>{0.74203974f, 0.401039451f},
-std::array<float,2>{0.283514947f, 0.807068467f},
-std::array<float,2>{0.965612411f, 0.556286752f},
-std::array<float,2>{0.240180999f, 0.043425899f},
-std::array<float,2>{0.870164752f, 0.149074569f},
-std::array<float,2>{0.0644040257f, 0.685791314f},
-std::array<float,2>{0.518783748f, 0.952565312f},
-std::array<float,2>{0.477909297f, 0.344020098f},
-std::array<float,2>{0.799334705f, 0.445730984f},
-std::array<float,2>{0.0457946137f, 0.836979449f},
-std::array<float,2>{0.610390544f, 0.623351812f},
-std::array<float,2>{0.383957714f, 0.083333157f},
-std::array<float,2>{0.68274188f, 0.222037762f},
-std::array<float,2>{0.357038349f, 0.708250463f},
-std::array<float,2>{0.93429172f, 0.914942086f},
-std::array<float,2>{0.171759754f, 0.282871723f},
-std::array<float,2>{0.547417819f, 0.341113329f},
-std::array<float,2>{0.460738838f, 0.983245552f},
-std::array<float,2>{0.816272736f, 0.625690997f},
-std::array<float,2>{0.11024835f, 0.16151835f},
-std::array<float,2>{0.991143167f, 0.0119492784f},
-std::array<float,2>{0.198447734f, 0.509724379f},
-std::array<float,2>{0.706340015f, 0.75352931f},
-std::array<float,2>{0.261158228f, 0.437279433f},
-std::array<float,2>{0.928441226f, 0.485146016f},
-std::array<float,2>{0.160509273f, 0.852888525f},
-std::array<float,2>{0.677868128f, 0.569749296f},
-std::array<float,2>{0.347762495f, 0.107207447f},
-std::array<float,2>{0.619817555f, 0.206748426f},
-std::array<float,2>{0.375454307f, 0.734121621f},
-std::array<float,2>{0.810854673f, 0.879485309f},
-std::array<float,2>{0.037911687f, 0.269104242f},
-std::array<float,2>{0.713317454f, 0.352074355f},
-std::array<float,2>{0.254548639f, 0.94177562f},
-std::array<float,2>{0.992480397f, 0.67338407f},
-std::array<float,2>{0.187566012f, 0.144436166f},
-std::array<float,2>{0.827516854f, 0.0335404426f},
-std::array<float,2>{0.12430349f, 0.550442755f},
-std::array<float,2>{0.560285628f, 0.804242492f},
-std::array<float,2>{0.468592167f, 0.395735234f},
-std::array<float,2>{0.770941913f, 0.29161191f},
-std::array<float,2>{0.0208041202f, 0.912809432f},
-std::array<float,2>{0.57110852f, 0.715662956f},
-std::array<float,2>{0.434652179f, 0.229108676f},
-std::array<float,2>{0.645406604f, 0.0864363238f},
-std::array<float,2>{0.325659961f, 0.610688031f},
-std::array<float,2>{0.890682936f, 0.830756843f},
-std::array<float,2>{0.129345611f, 0.444876015f},
-std::array<float,2>{0.52789247f, 0.424695641f},
-std::array<float,2>{0.471268564f, 0.758033812f},
-std::array<float,2>{0.863320172f, 0.505281329f},
-std::array<float,2>{0.0759394616f, 0.00297561451f},
-std::array<float,2>{0.954403937f, 0.165424377f},
-std::array<float,2>{0.24858126f, 0.638484299f},
-std::array<float,2>{0.743997335f, 0.972614527f},
-std::array<float,2>{0.294657469f, 0.331137329f},
-std::array<float,2>{0.978687465f, 0.326170325f},
-std::array<float,2>{0.208592996f, 0.9952631f},
-std::array<float,2>{0.69049865f, 0.646357715f},
-std::array<float,2>{0.273627698f, 0.182171583f},
-std::array<float,2>{0.539047301f, 0.0187465232f},
-std::array<float,2>{0.438844204f, 0.528939843f},
-std::array<float,2>{0.835787296f, 0.775150836f},
-std::array<float,2>{0.104043625f, 0.42184484f},
-std::array<float,2>{0.665944576f, 0.455409974f},
-std::array<float,2>{0.368733346f, 0.817999899f},
-std::array<float,2>{0.917330086f, 0.603884518f},
-std::array<float,2>{0.175881192f, 0.0630945042f},
-std::array<float,2>{0.79578346f, 0.244999573f},
-std::array<float,2>{0.056460727f, 0.692325175f},
-std::array<float,2>{0.608218729f, 0.931462228f},
-std::array<float,2>{0.40098837f, 0.298891515f},
-std::array<float,2>{0.85065937f, 0.379257888f},
-std::array<float,2>{0.0913645178f, 0.794938624f},
-std::array<float,2>{0.506628036f, 0.543251991f},
-std::array<float,2>{0.48456645f, 0.059805654f},
-std::array<float,2>{0.733724177f, 0.133723587f},
-std::array<float,2>{0.306990415f, 0.669663489f},
-std::array<float,2>{0.940211713f, 0.966691971f},
-std::array<float,2>{0.227808267f, 0.365078628f},
-std::array<float,2>{0.591170371f, 0.254725486f},
-std::array<float,2>{0.411399841f, 0.902785778f},
-std::array<float,2>{0.763242364f, 0.749096215f},
-std::array<float,2>{0.00632931339f, 0.188889638f},
-std::array<float,2>{0.890189826f, 0.124947876f},
-std::array<float,2>{0.145173192f, 0.57920599f},
-std::array<float,2>{0.630001485f, 0.865156114f},
-std::array<float,2>{0.330315888f, 0.471944869f},
-std::array<float,2>{0.910609066f, 0.426245093f},
-std::array<float,2>{0.182419926f, 0.762332916f},
-std::array<float,2>{0.663924158f, 0.500052631f},
-std::array<float,2>{0.361341894f, 0.00427877856f},
-std::array<float,2>{0.597245812f, 0.171160713f},
-std::array<float,2>{0.390700758f, 0.63538748f},
-std::array<float,2>{0.781556308f, 0.976268649f},
-std::array<float,2>{0.0536879897f, 0.333636492f},
-std::array<float,2>{0.697220266f, 0.294445902f},
-std::array<float,2>{0.272318393f, 0.909630001f},
-std::array<float,2>{0.974867821f, 0.712004721f},
-std::array<float,2>{0.218367279f, 0.233782843f},
-std::array<float,2>{0.836328506f, 0.0908625722f},
-std::array<float,2>{0.095242016f, 0.61430794f},
-std::array<float,2>{0.544869483f, 0.833713233f},
-std::array<float,2>{0.452797264f, 0.439229131f},
-std::array<float,2>{0.752323866f, 0.35803023f},
-std::array<float,2>{0.011600133f, 0.939258039f},
-std::array<float,2>{0.581734776f, 0.679657221f},
-std::array<float,2>{0.419871509f, 0.144554213f},
-std::array<float,2>{0.638907969f, 0.0371640399f},
-std::array<float,2>{0.340779454f, 0.552508354f},
-std::array<float,2>{0.880538166f, 0.798953831f},
-std::array<float,2>{0.154605046f, 0.393558919f},
-std::array<float,2>{0.508603275f, 0.49215889f},
-std::array<float,2>{0.492727906f, 0.855506241f},
-std::array<float,2>{0.854074121f, 0.562755167f},
-std::array<float,2>{0.0795646831f, 0.103287034f},
-std::array<float,2>{0.946503699f, 0.209605366f},
-std::array<float,2>{0.221406534f, 0.726889372f},
-std::array<float,2>{0.721295059f, 0.875705719f},
-std::array<float,2>{0.29795748f, 0.270728171f},
-std::array<float,2>{0.988210857f, 0.253589928f},
-std::array<float,2>{0.201695219f, 0.901384354f},
-std::array<float,2>{0.71054554f, 0.743670583f},
-std::array<float,2>{0.262872338f, 0.193252981f},
-std::array<float,2>{0.552578211f, 0.119972169f},
-std::array<float,2>{0.45529294f, 0.585042417f},
-std::array<float,2>{0.818985164f, 0.862121105f},
-std::array<float,2>{0.114269346f, 0.472815722f},
-std::array<float,2>{0.684765399f, 0.378222018f},
-std::array<float,2>{0.352868736f, 0.791734219f},
-std::array<float,2>{0.932404101f, 0.539276958f},
-std::array<float,2>{0.164078638f, 0.057357315f},
-std::array<float,2>{0.800863266f, 0.138703823f},
-std::array<float,2>{0.0419352129f, 0.665257573f},
-std::array<float,2>{0.614154518f, 0.963553905f},
-std::array<float,2>{0.389753342f, 0.361506194f},
-std::array<float,2>{0.871267557f, 0.457085222f},
-std::array<float,2>{0.0697264597f, 0.815138578f},
-std::array<float,2>{0.520576417f, 0.606238663f},
-std::array<float,2>{0.481719583f, 0.0692831799f},
-std::array<float,2>{0.734881938f, 0.249414548f},
-std::array<float,2>{0.286601484f, 0.688776374f},
-std::array<float,2>{0.961027861f, 0.937080085f},
-std::array<float,2>{0.236399338f, 0.302393079f},
-std::array<float,2>{0.57019496f, 0.322586983f},
-std::array<float,2>{0.423585922f, 0.99717319f},
-std::array<float,2>{0.777320921f, 0.644309938f},
-std::array<float,2>{0.031027073f, 0.186155185f},
-std::array<float,2>{0.898865879f, 0.0217436235f},
-std::array<float,2>{0.136965021f, 0.5246889f},
-std::array<float,2>{0.649281263f, 0.780659676f},
-std::array<float,2>{0.318988144f, 0.414799154f},
-std::array<float,2>{0.960780859f, 0.476932675f},
-std::array<float,2>{0.2444157f, 0.871826172f},
-std::array<float,2>{0.748310208f, 0.587760746f},
-std::array<float,2>{0.291577935f, 0.110893495f},
-std::array<float,2>{0.525851905f, 0.196232885f},
-std::array<float,2>{0.474501848f, 0.742042661f},
-std::array<float,2>{0.85985136f, 0.891912222f},
-std::array<float,2>{0.0703344867f, 0.257921666f},
-std::array<float,2>{0.643544674f, 0.369609922f},
-std::array<float,2>{0.321252346f, 0.956600606f},
-std::array<float,2>{0.895068288f, 0.663180351f},
-std::array<float,2>{0.125905782f, 0.131929532f},
-std::array<float,2>{0.767939329f, 0.0543754771f},
-std::array<float,2>{0.0184508935f, 0.53135097f},
-std::array<float,2>{0.575959325f, 0.785143852f},
-std::array<float,2>{0.431075901f, 0.388560086f},
-std::array<float,2>{0.821101308f, 0.307520002f},
-std::array<float,2>{0.119771689f, 0.923747122f},
-std::array<float,2>{0.555894017f, 0.701163828f},
-std::array<float,2>{0.46449852f, 0.235441536f},
-std::array<float,2>{0.716259062f, 0.0734877363f},
-std::array<float,2>{0.250710666f, 0.599760175f},
-std::array<float,2>{0.999087512f, 0.82444489f},
-std::array<float,2>{0.19244875f, 0.461714268f},
-std::array<float,2>{0.624540389f, 0.406764627f},
-std::array<float,2>{0.380728722f, 0.766202688f},
-std::array<float,2>{0.807052374f, 0.521794677f},
-std::array<float,2>{0.0345437303f, 0.0296646189f},
-std::array<float,2>{0.925077021f, 0.177919492f},
-std::array<float,2>{0.156956419f, 0.656180859f},
-std::array<float,2>{0.673854411f, 0.986944318f},
-std::array<float,2>{0.347413063f, 0.317892224f},
-std::array<float,2>{0.886455655f, 0.339335263f},
-std::array<float,2>{0.14375709f, 0.977626681f},
-std::array<float,2>{0.627140701f, 0.632408738f},
-std::array<float,2>{0.333509326f, 0.159828261f},
-std::array<float,2>{0.589646697f, 0.00990718976f},
-std::array<float,2>{0.408699334f, 0.514390826f},
-std::array<float,2>{0.759059608f, 0.756967783f},
-std::array<float,2>{0.00384696084f, 0.432427526f},
-std::array<float,2>{0.728971601f, 0.451197565f},
-std::array<float,2>{0.309135228f, 0.843487144f},
-std::array<float,2>{0.942340493f, 0.617770672f},
-std::array<float,2>{0.232909158f, 0.0810415223f},
-std::array<float,2>{0.845739543f, 0.22461088f},
-std::array<float,2>{0.0877390504f, 0.705077291f},
-std::array<float,2>{0.502430975f, 0.921582282f},
-std::array<float,2>{0.490286022f, 0.288193852f},
-std::array<float,2>{0.792650163f, 0.404158175f},
-std::array<float,2>{0.0608272478f, 0.810455501f},
-std::array<float,2>{0.602998137f, 0.560706735f},
-std::array<float,2>{0.405022889f, 0.0410329588f},
-std::array<float,2>{0.668583393f, 0.152768135f},
-std::array<float,2>{0.371629179f, 0.681439996f},
-std::array<float,2>{0.918241143f, 0.945345819f},
-std::array<float,2>{0.174646944f, 0.348658979f},
-std::array<float,2>{0.534630179f, 0.27720055f},
-std::array<float,2>{0.44414252f, 0.883054316f},
-std::array<float,2>{0.828990996f, 0.724656224f},
-std::array<float,2>{0.105771817f, 0.212584093f},
-std::array<float,2>{0.981697917f, 0.0995698199f},
-std::array<float,2>{0.204776064f, 0.571082413f},
-std::array<float,2>{0.691911221f, 0.84411633f},
-std::array<float,2>{0.2810238f, 0.493299276f},
-std::array<float,2>{0.969572008f, 0.383171499f},
-std::array<float,2>{0.214814618f, 0.785429358f},
-std::array<float,2>{0.702436447f, 0.535386205f},
-std::array<float,2>{0.26645419f, 0.0486680605f},
-std::array<float,2>{0.54058224f, 0.128025681f},
-std::array<float,2>{0.447493553f, 0.656757891f},
-std::array<float,2>{0.840465605f, 0.957695186f},
-std::array<float,2>{0.0978592709f, 0.373991817f},
-std::array<float,2>{0.659065843f, 0.262396604f},
-std::array<float,2>{0.366271138f, 0.895976841f},
-std::array<float,2>{0.90649724f, 0.737012386f},
-std::array<float,2>{0.187008902f, 0.200687543f},
-std::array<float,2>{0.785463214f, 0.116617069f},
-std::array<float,2>{0.0481249578f, 0.591581106f},
-std::array<float,2>{0.600395799f, 0.867773652f},
-std::array<float,2>{0.398249596f, 0.481216162f},
-std::array<float,2>{0.856732726f, 0.31298995f},
-std::array<float,2>{0.0851538181f, 0.989840925f},
-std::array<float,2>{0.511879086f, 0.651231587f},
-std::array<float,2>{0.499714911f, 0.173986167f},
-std::array<float,2>{0.725438297f, 0.0239797086f},
-std::array<float,2>{0.30166322f, 0.519483387f},
-std::array<float,2>{0.951037705f, 0.770085394f},
-std::array<float,2>{0.223233953f, 0.411006957f},
-std::array<float,2>{0.582426846f, 0.464968085f},
-std::array<float,2>{0.414394766f, 0.822134197f},
-std::array<float,2>{0.755497098f, 0.595036447f},
-std::array<float,2>{0.0145276664f, 0.0747217536f},
-std::array<float,2>{0.87575537f, 0.239905804f},
-std::array<float,2>{0.150113121f, 0.69896251f},
-std::array<float,2>{0.635952592f, 0.925871134f},
-std::array<float,2>{0.33753106f, 0.309465349f},
-std::array<float,2>{0.937158346f, 0.284788162f},
-std::array<float,2>{0.168700442f, 0.9164415f},
-std::array<float,2>{0.679718912f, 0.709970236f},
-std::array<float,2>{0.358224392f, 0.219163224f},
-std::array<float,2>{0.612636089f, 0.0846972167f},
-std::array<float,2>{0.385255933f, 0.622196257f},
-std::array<float,2>{0.797677994f, 0.839198112f},
-std::array<float,2>{0.0442621559f, 0.447986543f},
-std::array<float,2>{0.704672575f, 0.433619022f},
-std::array<float,2>{0.25837189f, 0.750962555f},
-std::array<float,2>{0.988448679f, 0.511190176f},
-std::array<float,2>{0.196803287f, 0.0143250311f},
-std::array<float,2>{0.813984334f, 0.162161022f},
-std::array<float,2>{0.113117017f, 0.627735615f},
-std::array<float,2>{0.550453782f, 0.98144716f},
-std::array<float,2>{0.45755282f, 0.342677146f},
-std::array<float,2>{0.778453648f, 0.496291876f},
-std::array<float,2>{0.027169954f, 0.850398898f},
-std::array<float,2>{0.563334644f, 0.575915456f},
-std::array<float,2>{0.426103979f, 0.0971423909f},
-std::array<float,2>{0.652987421f, 0.216141447f},
-std::array<float,2>{0.316001475f, 0.720414698f},
-std::array<float,2>{0.905045211f, 0.887722015f},
-std::array<float,2>{0.133267939f, 0.27802065f},
-std::array<float,2>{0.516124487f, 0.346182525f},
-std::array<float,2>{0.478846818f, 0.950507402f},
-std::array<float,2>{0.868766904f, 0.685376465f},
-std::array<float,2>{0.0659595653f, 0.151928782f},
-std::array<float,2>{0.967027128f, 0.0468144864f},
-std::array<float,2>{0.2420941f, 0.556984484f},
-std::array<float,2>{0.738885283f, 0.806111813f},
-std::array<float,2>{0.28133291f, 0.400155097f},
-std::array<float,2>{0.893978715f, 0.443315715f},
-std::array<float,2>{0.132532418f, 0.829251051f},
-std::array<float,2>{0.648133218f, 0.611382842f},
-std::array<float,2>{0.326240957f, 0.0890893713f},
-std::array<float,2>{0.572521389f, 0.22794205f},
-std::array<float,2>{0.435570747f, 0.717746377f},
-std::array<float,2>{0.772812426f, 0.911917806f},
-std::array<float,2>{0.0219396073f, 0.290195167f},
-std::array<float,2>{0.745248377f, 0.329856962f},
-std::array<float,2>{0.296616197f, 0.968928516f},
-std::array<float,2>{0.956696808f, 0.640382648f},
-std::array<float,2>{0.246645793f, 0.166514471f},
-std::array<float,2>{0.866586268f, 0.00123724528f},
-std::array<float,2>{0.0777334049f, 0.506492674f},
-std::array<float,2>{0.5310812f, 0.760648131f},
-std::array<float,2>{0.469297498f, 0.423457563f},
-std::array<float,2>{0.809047937f, 0.266805768f},
-std::array<float,2>{0.0365040749f, 0.882253766f},
-std::array<float,2>{0.617576957f, 0.731731176f},
-std::array<float,2>{0.378815293f, 0.203310698f},
-std::array<float,2>{0.676397681f, 0.108750232f},
-std::array<float,2>{0.350711584f, 0.567899168f},
-std::array<float,2>{0.927069068f, 0.853941739f},
-std::array<float,2>{0.163075522f, 0.488074094f},
-std::array<float,2>{0.561588883f, 0.396591604f},
-std::array<float,2>{0.466773182f, 0.801007152f},
-std::array<float,2>{0.824537098f, 0.548695266f},
-std::array<float,2>{0.121778078f, 0.032253027f},
-std::array<float,2>{0.99607861f, 0.141089678f},
-std::array<float,2>{0.190120324f, 0.675526738f},
-std::array<float,2>{0.71275717f, 0.945104241f},
-std::array<float,2>{0.2569924f, 0.353595376f},
-std::array<float,2>{0.938181758f, 0.366602033f},
-std::array<float,2>{0.229854316f, 0.968227148f},
-std::array<float,2>{0.730659187f, 0.671227157f},
-std::array<float,2>{0.305561543f, 0.134969756f},
-std::array<float,2>{0.504477262f, 0.0614733398f},
-std::array<float,2>{0.48722741f, 0.546681821f},
-std::array<float,2>{0.848211825f, 0.794783175f},
-std::array<float,2>{0.0929733738f, 0.382663161f},
-std::array<float,2>{0.630949497f, 0.470588118f},
-std::array<float,2>{0.329780906f, 0.86587882f},
-std::array<float,2>{0.886888146f, 0.581623673f},
-std::array<float,2>{0.147069767f, 0.123046368f},
-std::array<float,2>{0.763856471f, 0.191150144f},
-std::array<float,2>{0.00583193963f, 0.747673929f},
-std::array<float,2>{0.593653142f, 0.904925048f},
-std::array<float,2>{0.413337678f, 0.2574251f},
-std::array<float,2>{0.832784176f, 0.419710666f},
-std::array<float,2>{0.103350982f, 0.777298093f},
-std::array<float,2>{0.536741495f, 0.529852927f},
-std::array<float,2>{0.440535724f, 0.0161234532f},
-std::array<float,2>{0.688559055f, 0.180545658f},
-std::array<float,2>{0.275624454f, 0.647562087f},
-std::array<float,2>{0.97807616f, 0.99284035f},
-std::array<float,2>{0.209124029f, 0.3262299f},
-std::array<float,2>{0.607195854f, 0.298126072f},
-std::array<float,2>{0.399026632f, 0.933500648f},
-std::array<float,2>{0.793030441f, 0.694469035f},
-std::array<float,2>{0.0576001629f, 0.243583977f},
-std::array<float,2>{0.914482951f, 0.0648087114f},
-std::array<float,2>{0.179596558f, 0.603441238f},
-std::array<float,2>{0.667420745f, 0.819511056f},
-std::array<float,2>{0.370145708f, 0.454755694f}}
\ No newline at end of file
@@ -1,4096 +0,0 @@
-{std::array<float,2>{0.937822521f, 0.424457431f},
-std::array<float,2>{0.335403293f, 0.921119034f},
-std::array<float,2>{0.696996272f, 0.599572003f},
-std::array<float,2>{0.0843539611f, 0.0841304883f},
-std::array<float,2>{0.522435546f, 0.145183772f},
-std::array<float,2>{0.134968355f, 0.669812739f},
-std::array<float,2>{0.777783751f, 0.870134652f},
-std::array<float,2>{0.379554182f, 0.317649156f},
-std::array<float,2>{0.627593458f, 0.26344189f},
-std::array<float,2>{0.0346968099f, 0.773984849f},
-std::array<float,2>{0.92146641f, 0.700613201f},
-std::array<float,2>{0.287808061f, 0.206756473f},
-std::array<float,2>{0.847002625f, 0.00998688117f},
-std::array<float,2>{0.494252264f, 0.522706985f},
-std::array<float,2>{0.611511588f, 0.93787688f},
-std::array<float,2>{0.221588016f, 0.475098789f},
-std::array<float,2>{0.781720459f, 0.346306533f},
-std::array<float,2>{0.425891131f, 0.830094635f},
-std::array<float,2>{0.549722493f, 0.632798374f},
-std::array<float,2>{0.159712732f, 0.176314369f},
-std::array<float,2>{0.727300167f, 0.109833613f},
-std::array<float,2>{0.120662063f, 0.59030354f},
-std::array<float,2>{0.979546607f, 0.889756918f},
-std::array<float,2>{0.355798274f, 0.384144038f},
-std::array<float,2>{0.565890849f, 0.463925123f},
-std::array<float,2>{0.199951038f, 0.99617058f},
-std::array<float,2>{0.821190774f, 0.552826166f},
-std::array<float,2>{0.45469895f, 0.043966122f},
-std::array<float,2>{0.893721104f, 0.233501703f},
-std::array<float,2>{0.267096192f, 0.745114326f},
-std::array<float,2>{0.683131456f, 0.787265241f},
-std::array<float,2>{0.00548636029f, 0.30342865f},
-std::array<float,2>{0.835306466f, 0.494120687f},
-std::array<float,2>{0.441112697f, 0.960638821f},
-std::array<float,2>{0.579494417f, 0.505412281f},
-std::array<float,2>{0.216667354f, 0.0161881354f},
-std::array<float,2>{0.660075068f, 0.195509732f},
-std::array<float,2>{0.029495595f, 0.71772784f},
-std::array<float,2>{0.890434802f, 0.751950204f},
-std::array<float,2>{0.254886001f, 0.280835062f},
-std::array<float,2>{0.54008925f, 0.336292684f},
-std::array<float,2>{0.177755535f, 0.859209239f},
-std::array<float,2>{0.812060177f, 0.682195485f},
-std::array<float,2>{0.408225507f, 0.13278687f},
-std::array<float,2>{0.999165893f, 0.0775128826f},
-std::array<float,2>{0.361477792f, 0.614016533f},
-std::array<float,2>{0.746908784f, 0.923091233f},
-std::array<float,2>{0.106650494f, 0.410948515f},
-std::array<float,2>{0.92889142f, 0.281597257f},
-std::array<float,2>{0.301314741f, 0.802124023f},
-std::array<float,2>{0.642877162f, 0.731071711f},
-std::array<float,2>{0.059842024f, 0.245080933f},
-std::array<float,2>{0.607425988f, 0.0605736561f},
-std::array<float,2>{0.248824731f, 0.538201749f},
-std::array<float,2>{0.872836411f, 0.978463709f},
-std::array<float,2>{0.476348221f, 0.440312833f},
-std::array<float,2>{0.714259148f, 0.399245411f},
-std::array<float,2>{0.0630482584f, 0.892112851f},
-std::array<float,2>{0.964672685f, 0.564901173f},
-std::array<float,2>{0.312683165f, 0.103757568f},
-std::array<float,2>{0.764733315f, 0.15864189f},
-std::array<float,2>{0.403171122f, 0.640666842f},
-std::array<float,2>{0.504780114f, 0.812936306f},
-std::array<float,2>{0.149967358f, 0.361201644f},
-std::array<float,2>{0.880298555f, 0.452903688f},
-std::array<float,2>{0.260345429f, 0.972329199f},
-std::array<float,2>{0.671311975f, 0.54084301f},
-std::array<float,2>{0.022696618f, 0.0491515361f},
-std::array<float,2>{0.593735754f, 0.239340052f},
-std::array<float,2>{0.210107103f, 0.722461939f},
-std::array<float,2>{0.841742814f, 0.809162199f},
-std::array<float,2>{0.446344972f, 0.29103303f},
-std::array<float,2>{0.736900449f, 0.368701845f},
-std::array<float,2>{0.095350787f, 0.822392941f},
-std::array<float,2>{0.989475489f, 0.649529874f},
-std::array<float,2>{0.370511264f, 0.1709968f},
-std::array<float,2>{0.801847041f, 0.097337991f},
-std::array<float,2>{0.419443637f, 0.576557577f},
-std::array<float,2>{0.537785828f, 0.903743386f},
-std::array<float,2>{0.182520971f, 0.398258716f},
-std::array<float,2>{0.867158592f, 0.27162534f},
-std::array<float,2>{0.481715292f, 0.760496616f},
-std::array<float,2>{0.601556659f, 0.710605085f},
-std::array<float,2>{0.235117406f, 0.188808292f},
-std::array<float,2>{0.652850747f, 0.0305529609f},
-std::array<float,2>{0.0530361161f, 0.510497808f},
-std::array<float,2>{0.93618995f, 0.966633379f},
-std::array<float,2>{0.30641675f, 0.484513611f},
-std::array<float,2>{0.509915948f, 0.416781694f},
-std::array<float,2>{0.142745942f, 0.935571373f},
-std::array<float,2>{0.751847565f, 0.621765673f},
-std::array<float,2>{0.3943111f, 0.0674837455f},
-std::array<float,2>{0.95981741f, 0.137494966f},
-std::array<float,2>{0.322241336f, 0.678433418f},
-std::array<float,2>{0.70837611f, 0.847956181f},
-std::array<float,2>{0.0731623545f, 0.335655868f},
-std::array<float,2>{0.769208729f, 0.381073534f},
-std::array<float,2>{0.389535904f, 0.882113814f},
-std::array<float,2>{0.52655381f, 0.578485131f},
-std::array<float,2>{0.128345326f, 0.121365704f},
-std::array<float,2>{0.692654073f, 0.18129757f},
-std::array<float,2>{0.0910047293f, 0.637770116f},
-std::array<float,2>{0.949301243f, 0.836153328f},
-std::array<float,2>{0.33637777f, 0.356978774f},
-std::array<float,2>{0.622177601f, 0.307572007f},
-std::array<float,2>{0.230718344f, 0.792858303f},
-std::array<float,2>{0.857482612f, 0.738645494f},
-std::array<float,2>{0.485808969f, 0.21937342f},
-std::array<float,2>{0.911991775f, 0.0372126065f},
-std::array<float,2>{0.295911491f, 0.555165291f},
-std::array<float,2>{0.638874054f, 0.98984462f},
-std::array<float,2>{0.0452512838f, 0.460026294f},
-std::array<float,2>{0.975767493f, 0.32579267f},
-std::array<float,2>{0.350409061f, 0.862997532f},
-std::array<float,2>{0.722100019f, 0.662645221f},
-std::array<float,2>{0.115256995f, 0.153865144f},
-std::array<float,2>{0.561896145f, 0.0903262198f},
-std::array<float,2>{0.167632103f, 0.606862783f},
-std::array<float,2>{0.789236069f, 0.908094883f},
-std::array<float,2>{0.43082422f, 0.434330016f},
-std::array<float,2>{0.67714268f, 0.484183878f},
-std::array<float,2>{0.0138727659f, 0.951229334f},
-std::array<float,2>{0.899028659f, 0.523444831f},
-std::array<float,2>{0.278298497f, 0.0052797012f},
-std::array<float,2>{0.816711426f, 0.218278453f},
-std::array<float,2>{0.461823732f, 0.69164294f},
-std::array<float,2>{0.572311938f, 0.773302615f},
-std::array<float,2>{0.190223068f, 0.252346486f},
-std::array<float,2>{0.986542046f, 0.468855262f},
-std::array<float,2>{0.373462975f, 0.94400543f},
-std::array<float,2>{0.741553009f, 0.518443048f},
-std::array<float,2>{0.100991823f, 0.012190748f},
-std::array<float,2>{0.531965971f, 0.210588619f},
-std::array<float,2>{0.186171398f, 0.698126733f},
-std::array<float,2>{0.799287379f, 0.779391408f},
-std::array<float,2>{0.416967779f, 0.258615702f},
-std::array<float,2>{0.664093196f, 0.315598905f},
-std::array<float,2>{0.0169872846f, 0.873688936f},
-std::array<float,2>{0.875257909f, 0.667793989f},
-std::array<float,2>{0.265495449f, 0.143915132f},
-std::array<float,2>{0.836694062f, 0.0794151425f},
-std::array<float,2>{0.4506585f, 0.595977306f},
-std::array<float,2>{0.589709818f, 0.915023863f},
-std::array<float,2>{0.205895394f, 0.426827431f},
-std::array<float,2>{0.755115926f, 0.298161238f},
-std::array<float,2>{0.397568285f, 0.783643901f},
-std::array<float,2>{0.511844158f, 0.747093081f},
-std::array<float,2>{0.147949561f, 0.229330838f},
-std::array<float,2>{0.706155479f, 0.0399585627f},
-std::array<float,2>{0.0756661147f, 0.548968256f},
-std::array<float,2>{0.955097318f, 0.993285656f},
-std::array<float,2>{0.325054228f, 0.465756416f},
-std::array<float,2>{0.594312549f, 0.389194041f},
-std::array<float,2>{0.239292249f, 0.883524895f},
-std::array<float,2>{0.860762477f, 0.586575925f},
-std::array<float,2>{0.47938183f, 0.116853483f},
-std::array<float,2>{0.932643831f, 0.174688146f},
-std::array<float,2>{0.308848143f, 0.627331793f},
-std::array<float,2>{0.650844157f, 0.83457762f},
-std::array<float,2>{0.0480641425f, 0.348215044f},
-std::array<float,2>{0.85414207f, 0.40854454f},
-std::array<float,2>{0.488771677f, 0.928406179f},
-std::array<float,2>{0.617790699f, 0.610733807f},
-std::array<float,2>{0.227685273f, 0.0712084696f},
-std::array<float,2>{0.634394288f, 0.127132401f},
-std::array<float,2>{0.0391305052f, 0.683627665f},
-std::array<float,2>{0.909121811f, 0.851936698f},
-std::array<float,2>{0.291058809f, 0.341765881f},
-std::array<float,2>{0.530625224f, 0.274953544f},
-std::array<float,2>{0.132437214f, 0.757280946f},
-std::array<float,2>{0.770157278f, 0.712705612f},
-std::array<float,2>{0.385904968f, 0.200738996f},
-std::array<float,2>{0.946535885f, 0.019583635f},
-std::array<float,2>{0.343152374f, 0.503486454f},
-std::array<float,2>{0.690084517f, 0.956206918f},
-std::array<float,2>{0.0865475684f, 0.499101073f},
-std::array<float,2>{0.903924048f, 0.364784569f},
-std::array<float,2>{0.274679422f, 0.819608748f},
-std::array<float,2>{0.672716618f, 0.648414314f},
-std::array<float,2>{0.0078643607f, 0.160785779f},
-std::array<float,2>{0.576693296f, 0.109145284f},
-std::array<float,2>{0.193871781f, 0.568100691f},
-std::array<float,2>{0.81327951f, 0.895107448f},
-std::array<float,2>{0.465337604f, 0.402846873f},
-std::array<float,2>{0.722861111f, 0.442609519f},
-std::array<float,2>{0.111445136f, 0.981292963f},
-std::array<float,2>{0.971857488f, 0.533438087f},
-std::array<float,2>{0.34635511f, 0.0580941662f},
-std::array<float,2>{0.795584857f, 0.249490246f},
-std::array<float,2>{0.436504155f, 0.726667106f},
-std::array<float,2>{0.555582106f, 0.800489604f},
-std::array<float,2>{0.171032459f, 0.28707099f},
-std::array<float,2>{0.917259037f, 0.394108891f},
-std::array<float,2>{0.282704204f, 0.900985003f},
-std::array<float,2>{0.629710734f, 0.570375264f},
-std::array<float,2>{0.035302233f, 0.100852288f},
-std::array<float,2>{0.616710722f, 0.165740475f},
-std::array<float,2>{0.22394f, 0.65399152f},
-std::array<float,2>{0.848001301f, 0.824644148f},
-std::array<float,2>{0.498019964f, 0.373374045f},
-std::array<float,2>{0.699925661f, 0.296558261f},
-std::array<float,2>{0.0796201229f, 0.807336867f},
-std::array<float,2>{0.944809079f, 0.725014627f},
-std::array<float,2>{0.3292889f, 0.234721705f},
-std::array<float,2>{0.777213633f, 0.0535136275f},
-std::array<float,2>{0.376244605f, 0.543000579f},
-std::array<float,2>{0.518487632f, 0.973801792f},
-std::array<float,2>{0.139735639f, 0.445635259f},
-std::array<float,2>{0.824666262f, 0.329311967f},
-std::array<float,2>{0.460805714f, 0.846069574f},
-std::array<float,2>{0.569446206f, 0.674535692f},
-std::array<float,2>{0.195415109f, 0.133591577f},
-std::array<float,2>{0.68659091f, 0.0642405376f},
-std::array<float,2>{0.00280753779f, 0.620794594f},
-std::array<float,2>{0.896022081f, 0.933371484f},
-std::array<float,2>{0.271524757f, 0.419106215f},
-std::array<float,2>{0.553210378f, 0.489983201f},
-std::array<float,2>{0.163607478f, 0.960986018f},
-std::array<float,2>{0.785669029f, 0.513522625f},
-std::array<float,2>{0.424154609f, 0.0241104886f},
-std::array<float,2>{0.984087825f, 0.194311902f},
-std::array<float,2>{0.35443306f, 0.703328848f},
-std::array<float,2>{0.733921409f, 0.764358521f},
-std::array<float,2>{0.124112971f, 0.269041121f},
-std::array<float,2>{0.804825068f, 0.453377575f},
-std::array<float,2>{0.410909802f, 0.984879553f},
-std::array<float,2>{0.544432521f, 0.558906734f},
-std::array<float,2>{0.175311416f, 0.031888403f},
-std::array<float,2>{0.742267609f, 0.223735124f},
-std::array<float,2>{0.101970457f, 0.736981452f},
-std::array<float,2>{0.992958546f, 0.794167638f},
-std::array<float,2>{0.366754234f, 0.311005831f},
-std::array<float,2>{0.58484751f, 0.353811741f},
-std::array<float,2>{0.213836968f, 0.842268765f},
-std::array<float,2>{0.829785287f, 0.63358748f},
-std::array<float,2>{0.441656262f, 0.186822385f},
-std::array<float,2>{0.88341701f, 0.119455598f},
-std::array<float,2>{0.250616729f, 0.582704246f},
-std::array<float,2>{0.662585318f, 0.875725091f},
-std::array<float,2>{0.0253697764f, 0.376215726f},
-std::array<float,2>{0.967716694f, 0.257364243f},
-std::array<float,2>{0.318633527f, 0.76761961f},
-std::array<float,2>{0.714875817f, 0.689922392f},
-std::array<float,2>{0.0697752014f, 0.212960795f},
-std::array<float,2>{0.502422452f, 0.00311503769f},
-std::array<float,2>{0.15319249f, 0.530863404f},
-std::array<float,2>{0.758271098f, 0.94593817f},
-std::array<float,2>{0.398801953f, 0.480466098f},
-std::array<float,2>{0.645779729f, 0.431264699f},
-std::array<float,2>{0.055636853f, 0.913330376f},
-std::array<float,2>{0.92256403f, 0.602226436f},
-std::array<float,2>{0.297715247f, 0.0872965008f},
-std::array<float,2>{0.869703412f, 0.151549533f},
-std::array<float,2>{0.468787521f, 0.659224212f},
-std::array<float,2>{0.603693664f, 0.865617633f},
-std::array<float,2>{0.244113788f, 0.321084499f},
-std::array<float,2>{0.976651788f, 0.385623068f},
-std::array<float,2>{0.358559877f, 0.888280392f},
-std::array<float,2>{0.729490519f, 0.592866838f},
-std::array<float,2>{0.11873138f, 0.112714641f},
-std::array<float,2>{0.547953546f, 0.179464534f},
-std::array<float,2>{0.156602964f, 0.630241632f},
-std::array<float,2>{0.784811616f, 0.829048455f},
-std::array<float,2>{0.428381354f, 0.344441146f},
-std::array<float,2>{0.680274844f, 0.301662445f},
-std::array<float,2>{0.00659698015f, 0.785245955f},
-std::array<float,2>{0.890862882f, 0.742952347f},
-std::array<float,2>{0.268883735f, 0.230479792f},
-std::array<float,2>{0.823486686f, 0.0453522578f},
-std::array<float,2>{0.455618709f, 0.551116586f},
-std::array<float,2>{0.564208925f, 0.999569476f},
-std::array<float,2>{0.202787146f, 0.461273283f},
-std::array<float,2>{0.779438317f, 0.318601549f},
-std::array<float,2>{0.381063968f, 0.867291391f},
-std::array<float,2>{0.520741463f, 0.671606302f},
-std::array<float,2>{0.133042812f, 0.148429126f},
-std::array<float,2>{0.69775027f, 0.0827417746f},
-std::array<float,2>{0.0828035325f, 0.601239264f},
-std::array<float,2>{0.941375315f, 0.918450713f},
-std::array<float,2>{0.333727181f, 0.423343956f},
-std::array<float,2>{0.610335171f, 0.474350303f},
-std::array<float,2>{0.220316455f, 0.940555274f},
-std::array<float,2>{0.843978941f, 0.520638883f},
-std::array<float,2>{0.492499232f, 0.00786466151f},
-std::array<float,2>{0.918020964f, 0.204116791f},
-std::array<float,2>{0.285907418f, 0.701748848f},
-std::array<float,2>{0.62522012f, 0.775790393f},
-std::array<float,2>{0.0330652222f, 0.264575273f},
-std::array<float,2>{0.874844968f, 0.437962592f},
-std::array<float,2>{0.473447591f, 0.980029225f},
-std::array<float,2>{0.606285036f, 0.536983907f},
-std::array<float,2>{0.246604398f, 0.0600598566f},
-std::array<float,2>{0.641535521f, 0.243322954f},
-std::array<float,2>{0.0609518215f, 0.732879639f},
-std::array<float,2>{0.926316857f, 0.803780675f},
-std::array<float,2>{0.303055346f, 0.283486813f},
-std::array<float,2>{0.507771254f, 0.362324655f},
-std::array<float,2>{0.151695997f, 0.815018654f},
-std::array<float,2>{0.762438834f, 0.642617404f},
-std::array<float,2>{0.405523062f, 0.157946557f},
-std::array<float,2>{0.962599993f, 0.10344822f},
-std::array<float,2>{0.31543833f, 0.563671827f},
-std::array<float,2>{0.71112591f, 0.894225061f},
-std::array<float,2>{0.0661784261f, 0.401450336f},
-std::array<float,2>{0.887511909f, 0.277579933f},
-std::array<float,2>{0.257721901f, 0.753666162f},
-std::array<float,2>{0.656633139f, 0.715237319f},
-std::array<float,2>{0.0284946263f, 0.198464513f},
-std::array<float,2>{0.581706405f, 0.0188903604f},
-std::array<float,2>{0.217902869f, 0.506261349f},
-std::array<float,2>{0.833970964f, 0.957843363f},
-std::array<float,2>{0.437972188f, 0.494500011f},
-std::array<float,2>{0.749274135f, 0.413309872f},
-std::array<float,2>{0.108184405f, 0.925707042f},
-std::array<float,2>{0.997020602f, 0.616460145f},
-std::array<float,2>{0.36044392f, 0.0755319521f},
-std::array<float,2>{0.809962749f, 0.129859582f},
-std::array<float,2>{0.407610744f, 0.680380106f},
-std::array<float,2>{0.542777896f, 0.857052207f},
-std::array<float,2>{0.176122874f, 0.338617325f},
-std::array<float,2>{0.933906674f, 0.487555951f},
-std::array<float,2>{0.30701685f, 0.968310595f},
-std::array<float,2>{0.654937625f, 0.508451343f},
-std::array<float,2>{0.0523223318f, 0.0274982657f},
-std::array<float,2>{0.598779082f, 0.190615639f},
-std::array<float,2>{0.237028256f, 0.707337439f},
-std::array<float,2>{0.864765584f, 0.759720564f},
-std::array<float,2>{0.483917743f, 0.270189106f},
-std::array<float,2>{0.71060586f, 0.333384484f},
-std::array<float,2>{0.0721977726f, 0.850274622f},
-std::array<float,2>{0.958548427f, 0.675875545f},
-std::array<float,2>{0.323743582f, 0.13998878f},
-std::array<float,2>{0.752221107f, 0.0688082948f},
-std::array<float,2>{0.391807497f, 0.623389602f},
-std::array<float,2>{0.508549988f, 0.93522042f},
-std::array<float,2>{0.142564759f, 0.415621132f},
-std::array<float,2>{0.842785954f, 0.290802091f},
-std::array<float,2>{0.448770881f, 0.811998546f},
-std::array<float,2>{0.589913666f, 0.718899667f},
-std::array<float,2>{0.208047271f, 0.241577536f},
-std::array<float,2>{0.668123126f, 0.047288809f},
-std::array<float,2>{0.0204851888f, 0.541288912f},
-std::array<float,2>{0.882703185f, 0.969736397f},
-std::array<float,2>{0.259128422f, 0.45028469f},
-std::array<float,2>{0.536618054f, 0.395600259f},
-std::array<float,2>{0.18037343f, 0.904502332f},
-std::array<float,2>{0.803182304f, 0.574658096f},
-std::array<float,2>{0.421011537f, 0.0950055942f},
-std::array<float,2>{0.991473496f, 0.169430286f},
-std::array<float,2>{0.368804723f, 0.650949001f},
-std::array<float,2>{0.735749841f, 0.821374476f},
-std::array<float,2>{0.0962533131f, 0.370046407f},
-std::array<float,2>{0.792164087f, 0.437140018f},
-std::array<float,2>{0.43287003f, 0.908773243f},
-std::array<float,2>{0.558653653f, 0.608745158f},
-std::array<float,2>{0.165993586f, 0.0930669904f},
-std::array<float,2>{0.720042109f, 0.154695392f},
-std::array<float,2>{0.114355803f, 0.661156774f},
-std::array<float,2>{0.973458707f, 0.860603154f},
-std::array<float,2>{0.348128259f, 0.327880055f},
-std::array<float,2>{0.571151674f, 0.250245184f},
-std::array<float,2>{0.188111037f, 0.770486236f},
-std::array<float,2>{0.81949991f, 0.69343257f},
-std::array<float,2>{0.464648157f, 0.216332838f},
-std::array<float,2>{0.900944889f, 0.00700116064f},
-std::array<float,2>{0.280282468f, 0.526111782f},
-std::array<float,2>{0.678568363f, 0.950141072f},
-std::array<float,2>{0.0131623875f, 0.482242912f},
-std::array<float,2>{0.952094555f, 0.357772648f},
-std::array<float,2>{0.338382334f, 0.837976396f},
-std::array<float,2>{0.694494665f, 0.639471769f},
-std::array<float,2>{0.0931151062f, 0.183297768f},
-std::array<float,2>{0.524250448f, 0.123673104f},
-std::array<float,2>{0.126831964f, 0.580811441f},
-std::array<float,2>{0.767442763f, 0.879994929f},
-std::array<float,2>{0.38745296f, 0.380803168f},
-std::array<float,2>{0.63675642f, 0.457998067f},
-std::array<float,2>{0.0446907915f, 0.991325915f},
-std::array<float,2>{0.912246764f, 0.557861328f},
-std::array<float,2>{0.294726729f, 0.0365297757f},
-std::array<float,2>{0.855716407f, 0.221527755f},
-std::array<float,2>{0.486444354f, 0.741452217f},
-std::array<float,2>{0.623366952f, 0.790944517f},
-std::array<float,2>{0.233213231f, 0.304911673f},
-std::array<float,2>{0.954122603f, 0.467959642f},
-std::array<float,2>{0.326417804f, 0.995625496f},
-std::array<float,2>{0.703777313f, 0.546945691f},
-std::array<float,2>{0.0777406916f, 0.0421497263f},
-std::array<float,2>{0.514970779f, 0.227431908f},
-std::array<float,2>{0.145852551f, 0.749463141f},
-std::array<float,2>{0.757562876f, 0.782928109f},
-std::array<float,2>{0.396410167f, 0.299064934f},
-std::array<float,2>{0.650385201f, 0.350531399f},
-std::array<float,2>{0.0497176982f, 0.83292222f},
-std::array<float,2>{0.931628466f, 0.625484467f},
-std::array<float,2>{0.31062898f, 0.173354238f},
-std::array<float,2>{0.861963034f, 0.114414521f},
-std::array<float,2>{0.47795856f, 0.589392006f},
-std::array<float,2>{0.596365333f, 0.885180116f},
-std::array<float,2>{0.241981998f, 0.387496501f},
-std::array<float,2>{0.798161924f, 0.260672271f},
-std::array<float,2>{0.414255112f, 0.778503895f},
-std::array<float,2>{0.534326434f, 0.697239459f},
-std::array<float,2>{0.184850767f, 0.20847927f},
-std::array<float,2>{0.738683939f, 0.0148247527f},
-std::array<float,2>{0.0988895893f, 0.517018437f},
-std::array<float,2>{0.985145986f, 0.942075908f},
-std::array<float,2>{0.371290863f, 0.472173125f},
-std::array<float,2>{0.586849451f, 0.429633737f},
-std::array<float,2>{0.203615353f, 0.917429984f},
-std::array<float,2>{0.838895679f, 0.595375299f},
-std::array<float,2>{0.452485949f, 0.0800877512f},
-std::array<float,2>{0.876988828f, 0.142304465f},
-std::array<float,2>{0.263059288f, 0.664576471f},
-std::array<float,2>{0.667178154f, 0.87287581f},
-std::array<float,2>{0.0179373641f, 0.31390065f},
-std::array<float,2>{0.815607786f, 0.406085193f},
-std::array<float,2>{0.467460215f, 0.897982657f},
-std::array<float,2>{0.576059937f, 0.569001436f},
-std::array<float,2>{0.192095637f, 0.105843477f},
-std::array<float,2>{0.674166441f, 0.162620798f},
-std::array<float,2>{0.0103959646f, 0.645831883f},
-std::array<float,2>{0.905296028f, 0.816553593f},
-std::array<float,2>{0.276829451f, 0.36667189f},
-std::array<float,2>{0.557255447f, 0.288653553f},
-std::array<float,2>{0.168058038f, 0.79851079f},
-std::array<float,2>{0.794130445f, 0.729238987f},
-std::array<float,2>{0.434299916f, 0.247590974f},
-std::array<float,2>{0.968817234f, 0.0549884513f},
-std::array<float,2>{0.345420182f, 0.533161759f},
-std::array<float,2>{0.726251423f, 0.983570397f},
-std::array<float,2>{0.109629139f, 0.444175482f},
-std::array<float,2>{0.907915711f, 0.342588812f},
-std::array<float,2>{0.290525198f, 0.854885578f},
-std::array<float,2>{0.63667047f, 0.686086297f},
-std::array<float,2>{0.0419719927f, 0.126331121f},
-std::array<float,2>{0.620115817f, 0.073014915f},
-std::array<float,2>{0.228820309f, 0.612678051f},
-std::array<float,2>{0.851809859f, 0.926491022f},
-std::array<float,2>{0.490756899f, 0.406717956f},
-std::array<float,2>{0.687773645f, 0.497543275f},
-std::array<float,2>{0.0880329162f, 0.955076098f},
-std::array<float,2>{0.948955357f, 0.50050199f},
-std::array<float,2>{0.340327114f, 0.0220625866f},
-std::array<float,2>{0.772699535f, 0.201888487f},
-std::array<float,2>{0.383788019f, 0.713056087f},
-std::array<float,2>{0.527999282f, 0.753961742f},
-std::array<float,2>{0.129860774f, 0.277197301f},
-std::array<float,2>{0.89673388f, 0.420464456f},
-std::array<float,2>{0.271107614f, 0.930730462f},
-std::array<float,2>{0.684457302f, 0.61913836f},
-std::array<float,2>{0.00192631583f, 0.0644764677f},
-std::array<float,2>{0.566488147f, 0.135887355f},
-std::array<float,2>{0.199016839f, 0.672491074f},
-std::array<float,2>{0.827891946f, 0.843955457f},
-std::array<float,2>{0.45818907f, 0.330131203f},
-std::array<float,2>{0.731633544f, 0.266863883f},
-std::array<float,2>{0.121433534f, 0.761950076f},
-std::array<float,2>{0.981441081f, 0.70691359f},
-std::array<float,2>{0.352039009f, 0.19314158f},
-std::array<float,2>{0.787772596f, 0.0255471636f},
-std::array<float,2>{0.423437536f, 0.514291167f},
-std::array<float,2>{0.551776946f, 0.963237643f},
-std::array<float,2>{0.161430851f, 0.491658598f},
-std::array<float,2>{0.850518644f, 0.371393949f},
-std::array<float,2>{0.498659045f, 0.82711345f},
-std::array<float,2>{0.613846838f, 0.656140506f},
-std::array<float,2>{0.225073978f, 0.166763291f},
-std::array<float,2>{0.632643282f, 0.0987942293f},
-std::array<float,2>{0.0387448929f, 0.574157536f},
-std::array<float,2>{0.915589929f, 0.900128007f},
-std::array<float,2>{0.285057068f, 0.391457498f},
-std::array<float,2>{0.517507195f, 0.447351366f},
-std::array<float,2>{0.138375267f, 0.975765884f},
-std::array<float,2>{0.774824798f, 0.546786308f},
-std::array<float,2>{0.37788406f, 0.0526004322f},
-std::array<float,2>{0.942692578f, 0.238165289f},
-std::array<float,2>{0.331788838f, 0.72297281f},
-std::array<float,2>{0.701708317f, 0.805112362f},
-std::array<float,2>{0.0817561895f, 0.293894231f},
-std::array<float,2>{0.761587203f, 0.477395296f},
-std::array<float,2>{0.402058005f, 0.948154926f},
-std::array<float,2>{0.500401676f, 0.529011607f},
-std::array<float,2>{0.155102015f, 0.00134339859f},
-std::array<float,2>{0.717350423f, 0.212773815f},
-std::array<float,2>{0.0664924607f, 0.687778831f},
-std::array<float,2>{0.965579629f, 0.766096175f},
-std::array<float,2>{0.316874206f, 0.255455434f},
-std::array<float,2>{0.603076577f, 0.323985577f},
-std::array<float,2>{0.244263098f, 0.863755047f},
-std::array<float,2>{0.868599236f, 0.656564534f},
-std::array<float,2>{0.471228421f, 0.149644434f},
-std::array<float,2>{0.924542248f, 0.0879946426f},
-std::array<float,2>{0.300302267f, 0.604139328f},
-std::array<float,2>{0.647082627f, 0.911122918f},
-std::array<float,2>{0.0582666509f, 0.433192849f},
-std::array<float,2>{0.994839191f, 0.308716446f},
-std::array<float,2>{0.364964068f, 0.796019375f},
-std::array<float,2>{0.744231582f, 0.735741854f},
-std::array<float,2>{0.10498482f, 0.225834906f},
-std::array<float,2>{0.545068085f, 0.0335513353f},
-std::array<float,2>{0.173467323f, 0.561167359f},
-std::array<float,2>{0.808078468f, 0.987288833f},
-std::array<float,2>{0.413562566f, 0.456853956f},
-std::array<float,2>{0.660216749f, 0.377813399f},
-std::array<float,2>{0.0266597234f, 0.87768966f},
-std::array<float,2>{0.885342538f, 0.584466994f},
-std::array<float,2>{0.252083659f, 0.11839363f},
-std::array<float,2>{0.832024217f, 0.183862716f},
-std::array<float,2>{0.443856448f, 0.636251569f},
-std::array<float,2>{0.582579553f, 0.840800047f},
-std::array<float,2>{0.211851448f, 0.352923065f},
-std::array<float,2>{0.963748455f, 0.401031673f},
-std::array<float,2>{0.314135998f, 0.892851174f},
-std::array<float,2>{0.713289857f, 0.562648594f},
-std::array<float,2>{0.063743636f, 0.101822719f},
-std::array<float,2>{0.505267739f, 0.156501919f},
-std::array<float,2>{0.14922297f, 0.6435799f},
-std::array<float,2>{0.764614046f, 0.8163113f},
-std::array<float,2>{0.404218763f, 0.362013072f},
-std::array<float,2>{0.643900096f, 0.284422278f},
-std::array<float,2>{0.0593038164f, 0.803426027f},
-std::array<float,2>{0.928610623f, 0.734038353f},
-std::array<float,2>{0.302344412f, 0.242590994f},
-std::array<float,2>{0.871899664f, 0.0594612882f},
-std::array<float,2>{0.474930733f, 0.535208642f},
-std::array<float,2>{0.608891189f, 0.978663445f},
-std::array<float,2>{0.249294281f, 0.439273298f},
-std::array<float,2>{0.810758591f, 0.339671224f},
-std::array<float,2>{0.409668297f, 0.855631232f},
-std::array<float,2>{0.539316893f, 0.680960178f},
-std::array<float,2>{0.179569125f, 0.130375326f},
-std::array<float,2>{0.747364581f, 0.0746842399f},
-std::array<float,2>{0.106192589f, 0.615416944f},
-std::array<float,2>{0.998456955f, 0.924239159f},
-std::array<float,2>{0.363098294f, 0.41296047f},
-std::array<float,2>{0.578783512f, 0.49532631f},
-std::array<float,2>{0.21522443f, 0.958625555f},
-std::array<float,2>{0.834939659f, 0.506932199f},
-std::array<float,2>{0.439588308f, 0.0178758577f},
-std::array<float,2>{0.88952142f, 0.198025867f},
-std::array<float,2>{0.254722863f, 0.716703236f},
-std::array<float,2>{0.658802211f, 0.752566874f},
-std::array<float,2>{0.030904999f, 0.279099077f},
-std::array<float,2>{0.822204292f, 0.462306827f},
-std::array<float,2>{0.453453124f, 0.998543143f},
-std::array<float,2>{0.565396547f, 0.551995814f},
-std::array<float,2>{0.200856894f, 0.0462502874f},
-std::array<float,2>{0.68230015f, 0.232142359f},
-std::array<float,2>{0.00449776696f, 0.743498683f},
-std::array<float,2>{0.893083334f, 0.787098646f},
-std::array<float,2>{0.266038448f, 0.302695245f},
-std::array<float,2>{0.550464153f, 0.345619649f},
-std::array<float,2>{0.158519611f, 0.829271436f},
-std::array<float,2>{0.78236711f, 0.629860044f},
-std::array<float,2>{0.427374333f, 0.178574026f},
-std::array<float,2>{0.978720725f, 0.112161294f},
-std::array<float,2>{0.357141435f, 0.591804206f},
-std::array<float,2>{0.728396475f, 0.886872947f},
-std::array<float,2>{0.119595833f, 0.386174232f},
-std::array<float,2>{0.920167565f, 0.265230328f},
-std::array<float,2>{0.2882061f, 0.776788235f},
-std::array<float,2>{0.628884554f, 0.702939093f},
-std::array<float,2>{0.033893656f, 0.203236207f},
-std::array<float,2>{0.61255312f, 0.00942605641f},
-std::array<float,2>{0.222259417f, 0.520425856f},
-std::array<float,2>{0.846199989f, 0.939971805f},
-std::array<float,2>{0.495508283f, 0.472688317f},
-std::array<float,2>{0.696198225f, 0.422298402f},
-std::array<float,2>{0.0851632208f, 0.919600844f},
-std::array<float,2>{0.938731372f, 0.600219488f},
-std::array<float,2>{0.334650248f, 0.0836189091f},
-std::array<float,2>{0.779135525f, 0.147108674f},
-std::array<float,2>{0.380733669f, 0.670513332f},
-std::array<float,2>{0.523102105f, 0.868926048f},
-std::array<float,2>{0.135769039f, 0.320214152f},
-std::array<float,2>{0.90005213f, 0.481436193f},
-std::array<float,2>{0.278527856f, 0.951093554f},
-std::array<float,2>{0.676349878f, 0.527282834f},
-std::array<float,2>{0.0152803073f, 0.00650005182f},
-std::array<float,2>{0.574079335f, 0.215367481f},
-std::array<float,2>{0.191147953f, 0.695228875f},
-std::array<float,2>{0.817685008f, 0.77129364f},
-std::array<float,2>{0.462313324f, 0.251471221f},
-std::array<float,2>{0.720873415f, 0.326341897f},
-std::array<float,2>{0.116892405f, 0.859510601f},
-std::array<float,2>{0.975266814f, 0.660834491f},
-std::array<float,2>{0.351472884f, 0.155290917f},
-std::array<float,2>{0.790912926f, 0.0925530791f},
-std::array<float,2>{0.430387288f, 0.608269393f},
-std::array<float,2>{0.560638547f, 0.909930468f},
-std::array<float,2>{0.166174024f, 0.435853332f},
-std::array<float,2>{0.858776391f, 0.305758387f},
-std::array<float,2>{0.484904587f, 0.789625108f},
-std::array<float,2>{0.62143153f, 0.74064368f},
-std::array<float,2>{0.232038945f, 0.221706256f},
-std::array<float,2>{0.640481174f, 0.0358236693f},
-std::array<float,2>{0.0459448956f, 0.557537794f},
-std::array<float,2>{0.910420477f, 0.990239859f},
-std::array<float,2>{0.295699835f, 0.458869129f},
-std::array<float,2>{0.525752425f, 0.379757851f},
-std::array<float,2>{0.127504066f, 0.879551947f},
-std::array<float,2>{0.768457651f, 0.581313014f},
-std::array<float,2>{0.390593529f, 0.124939971f},
-std::array<float,2>{0.950381815f, 0.182501256f},
-std::array<float,2>{0.337267399f, 0.640098393f},
-std::array<float,2>{0.691434145f, 0.839460015f},
-std::array<float,2>{0.0905435309f, 0.359309405f},
-std::array<float,2>{0.750821769f, 0.414413124f},
-std::array<float,2>{0.39301765f, 0.933818817f},
-std::array<float,2>{0.511617303f, 0.624612272f},
-std::array<float,2>{0.144028306f, 0.0700241327f},
-std::array<float,2>{0.70740819f, 0.138681307f},
-std::array<float,2>{0.0737291649f, 0.677304983f},
-std::array<float,2>{0.960654557f, 0.851014435f},
-std::array<float,2>{0.32052359f, 0.332568705f},
-std::array<float,2>{0.60013932f, 0.271214575f},
-std::array<float,2>{0.236014426f, 0.758228719f},
-std::array<float,2>{0.866025507f, 0.708343625f},
-std::array<float,2>{0.481353372f, 0.189544648f},
-std::array<float,2>{0.936662555f, 0.0284915213f},
-std::array<float,2>{0.305609345f, 0.509281456f},
-std::array<float,2>{0.65355593f, 0.967462361f},
-std::array<float,2>{0.0541560017f, 0.487108082f},
-std::array<float,2>{0.988346875f, 0.370818645f},
-std::array<float,2>{0.369175047f, 0.820674181f},
-std::array<float,2>{0.737701535f, 0.651722074f},
-std::array<float,2>{0.094148472f, 0.16888012f},
-std::array<float,2>{0.538811028f, 0.0945729017f},
-std::array<float,2>{0.182699874f, 0.575621486f},
-std::array<float,2>{0.801275909f, 0.905827701f},
-std::array<float,2>{0.418160975f, 0.395269603f},
-std::array<float,2>{0.670415044f, 0.449750483f},
-std::array<float,2>{0.0216567516f, 0.969646573f},
-std::array<float,2>{0.878963649f, 0.542713761f},
-std::array<float,2>{0.261051178f, 0.0484057069f},
-std::array<float,2>{0.840809226f, 0.240331113f},
-std::array<float,2>{0.446251184f, 0.719983399f},
-std::array<float,2>{0.592198372f, 0.81128186f},
-std::array<float,2>{0.209059358f, 0.289297521f},
-std::array<float,2>{0.971001685f, 0.444372267f},
-std::array<float,2>{0.346990108f, 0.982521534f},
-std::array<float,2>{0.724198341f, 0.531945288f},
-std::array<float,2>{0.11242047f, 0.0564348102f},
-std::array<float,2>{0.55644536f, 0.246389732f},
-std::array<float,2>{0.170655042f, 0.730173171f},
-std::array<float,2>{0.796163976f, 0.797721326f},
-std::array<float,2>{0.436801523f, 0.287885904f},
-std::array<float,2>{0.673564911f, 0.365356952f},
-std::array<float,2>{0.00947469007f, 0.81759125f},
-std::array<float,2>{0.90285331f, 0.645096242f},
-std::array<float,2>{0.273810953f, 0.163887873f},
-std::array<float,2>{0.813726723f, 0.107205316f},
-std::array<float,2>{0.466558069f, 0.570279658f},
-std::array<float,2>{0.577284694f, 0.897434771f},
-std::array<float,2>{0.195159093f, 0.404414356f},
-std::array<float,2>{0.770768285f, 0.276343286f},
-std::array<float,2>{0.384984225f, 0.755548835f},
-std::array<float,2>{0.529576778f, 0.714269698f},
-std::array<float,2>{0.131081596f, 0.202688068f},
-std::array<float,2>{0.691082478f, 0.0231344383f},
-std::array<float,2>{0.0870033875f, 0.5011307f},
-std::array<float,2>{0.94546181f, 0.953229725f},
-std::array<float,2>{0.341873109f, 0.49698472f},
-std::array<float,2>{0.618292809f, 0.407845706f},
-std::array<float,2>{0.226993591f, 0.927062511f},
-std::array<float,2>{0.855112493f, 0.611857057f},
-std::array<float,2>{0.49015376f, 0.0738535076f},
-std::array<float,2>{0.910140991f, 0.125036791f},
-std::array<float,2>{0.292068511f, 0.687419534f},
-std::array<float,2>{0.633392632f, 0.854400098f},
-std::array<float,2>{0.0407145284f, 0.343537003f},
-std::array<float,2>{0.860126078f, 0.388088077f},
-std::array<float,2>{0.479492188f, 0.886412799f},
-std::array<float,2>{0.595085025f, 0.588353515f},
-std::array<float,2>{0.239040613f, 0.114045918f},
-std::array<float,2>{0.652207911f, 0.172394395f},
-std::array<float,2>{0.0477148816f, 0.626042128f},
-std::array<float,2>{0.931645274f, 0.833551764f},
-std::array<float,2>{0.309976757f, 0.351556689f},
-std::array<float,2>{0.513379455f, 0.300183713f},
-std::array<float,2>{0.146955162f, 0.781778932f},
-std::array<float,2>{0.754083216f, 0.748422325f},
-std::array<float,2>{0.396741807f, 0.227672935f},
-std::array<float,2>{0.956901193f, 0.0419812351f},
-std::array<float,2>{0.325233281f, 0.54831177f},
-std::array<float,2>{0.706023991f, 0.994789183f},
-std::array<float,2>{0.0743027627f, 0.467165589f},
-std::array<float,2>{0.876359463f, 0.312778711f},
-std::array<float,2>{0.263809562f, 0.871154845f},
-std::array<float,2>{0.66540426f, 0.66588819f},
-std::array<float,2>{0.0158682037f, 0.141523719f},
-std::array<float,2>{0.588209331f, 0.0819589272f},
-std::array<float,2>{0.206428871f, 0.594359338f},
-std::array<float,2>{0.837675571f, 0.916684687f},
-std::array<float,2>{0.449792892f, 0.42860508f},
-std::array<float,2>{0.740593016f, 0.471648872f},
-std::array<float,2>{0.100505076f, 0.942875385f},
-std::array<float,2>{0.987366021f, 0.515900552f},
-std::array<float,2>{0.374172598f, 0.0141098192f},
-std::array<float,2>{0.800501287f, 0.207299113f},
-std::array<float,2>{0.417059302f, 0.696169555f},
-std::array<float,2>{0.532394886f, 0.777492344f},
-std::array<float,2>{0.186728656f, 0.260771275f},
-std::array<float,2>{0.9229334f, 0.43228361f},
-std::array<float,2>{0.297959715f, 0.911964178f},
-std::array<float,2>{0.644727409f, 0.605322182f},
-std::array<float,2>{0.0565903485f, 0.0891636834f},
-std::array<float,2>{0.604785323f, 0.148759127f},
-std::array<float,2>{0.242576152f, 0.657512069f},
-std::array<float,2>{0.870944619f, 0.864354551f},
-std::array<float,2>{0.470674843f, 0.323177636f},
-std::array<float,2>{0.716131687f, 0.254875004f},
-std::array<float,2>{0.0684789792f, 0.767509639f},
-std::array<float,2>{0.96800977f, 0.688910902f},
-std::array<float,2>{0.319687814f, 0.210985363f},
-std::array<float,2>{0.759153664f, 0.00038650076f},
-std::array<float,2>{0.399637878f, 0.527568161f},
-std::array<float,2>{0.503339946f, 0.949149251f},
-std::array<float,2>{0.15422532f, 0.477864802f},
-std::array<float,2>{0.828478813f, 0.351814777f},
-std::array<float,2>{0.443292141f, 0.841274798f},
-std::array<float,2>{0.585186362f, 0.634768844f},
-std::array<float,2>{0.214210853f, 0.185478553f},
-std::array<float,2>{0.663983107f, 0.1179979f},
-std::array<float,2>{0.0243270937f, 0.585155785f},
-std::array<float,2>{0.884621799f, 0.87823087f},
-std::array<float,2>{0.251703173f, 0.378548831f},
-std::array<float,2>{0.543646932f, 0.455777138f},
-std::array<float,2>{0.174482837f, 0.987339199f},
-std::array<float,2>{0.806317389f, 0.561754107f},
-std::array<float,2>{0.411671698f, 0.0351175927f},
-std::array<float,2>{0.993680716f, 0.224767923f},
-std::array<float,2>{0.365703642f, 0.734719336f},
-std::array<float,2>{0.743491471f, 0.795829356f},
-std::array<float,2>{0.103061192f, 0.309832126f},
-std::array<float,2>{0.786475062f, 0.490267545f},
-std::array<float,2>{0.425380766f, 0.964424729f},
-std::array<float,2>{0.553807795f, 0.514805615f},
-std::array<float,2>{0.162743568f, 0.0270479787f},
-std::array<float,2>{0.73334533f, 0.192180544f},
-std::array<float,2>{0.12324179f, 0.705719054f},
-std::array<float,2>{0.983276546f, 0.763433278f},
-std::array<float,2>{0.354878962f, 0.266478211f},
-std::array<float,2>{0.569035709f, 0.331341356f},
-std::array<float,2>{0.196880609f, 0.845345676f},
-std::array<float,2>{0.8255288f, 0.673012614f},
-std::array<float,2>{0.459086061f, 0.135604709f},
-std::array<float,2>{0.894541204f, 0.0660149008f},
-std::array<float,2>{0.273271531f, 0.617750585f},
-std::array<float,2>{0.686084032f, 0.929835975f},
-std::array<float,2>{0.00369445025f, 0.421449214f},
-std::array<float,2>{0.943644583f, 0.29443115f},
-std::array<float,2>{0.329100102f, 0.806327403f},
-std::array<float,2>{0.700837433f, 0.724518001f},
-std::array<float,2>{0.0784245133f, 0.236792073f},
-std::array<float,2>{0.519122243f, 0.0512487888f},
-std::array<float,2>{0.138842136f, 0.544922769f},
-std::array<float,2>{0.775901794f, 0.974876642f},
-std::array<float,2>{0.375134975f, 0.448445797f},
-std::array<float,2>{0.630405307f, 0.392547965f},
-std::array<float,2>{0.0361948088f, 0.898479104f},
-std::array<float,2>{0.916430771f, 0.573163867f},
-std::array<float,2>{0.281966746f, 0.0980352685f},
-std::array<float,2>{0.848854661f, 0.167901635f},
-std::array<float,2>{0.496128291f, 0.655234754f},
-std::array<float,2>{0.61539644f, 0.827704549f},
-std::array<float,2>{0.223443851f, 0.372269779f},
-std::array<float,2>{0.997834504f, 0.411236525f},
-std::array<float,2>{0.360181332f, 0.922685027f},
-std::array<float,2>{0.748391986f, 0.614928961f},
-std::array<float,2>{0.109307356f, 0.076536037f},
-std::array<float,2>{0.541152954f, 0.131812483f},
-std::array<float,2>{0.177684382f, 0.682771027f},
-std::array<float,2>{0.808968902f, 0.857461274f},
-std::array<float,2>{0.406315565f, 0.337378919f},
-std::array<float,2>{0.657880485f, 0.280068696f},
-std::array<float,2>{0.0282385815f, 0.750796616f},
-std::array<float,2>{0.888418674f, 0.718697548f},
-std::array<float,2>{0.256497622f, 0.19715248f},
-std::array<float,2>{0.832679868f, 0.0167877637f},
-std::array<float,2>{0.439350367f, 0.504014075f},
-std::array<float,2>{0.580685079f, 0.959068656f},
-std::array<float,2>{0.217634663f, 0.492502153f},
-std::array<float,2>{0.763086796f, 0.359714389f},
-std::array<float,2>{0.40454644f, 0.813503325f},
-std::array<float,2>{0.506768346f, 0.642459929f},
-std::array<float,2>{0.151020676f, 0.159702688f},
-std::array<float,2>{0.71229136f, 0.105280124f},
-std::array<float,2>{0.0654034838f, 0.565567553f},
-std::array<float,2>{0.961538613f, 0.890811324f},
-std::array<float,2>{0.315153152f, 0.399754137f},
-std::array<float,2>{0.606835544f, 0.440660715f},
-std::array<float,2>{0.247651085f, 0.976969242f},
-std::array<float,2>{0.873247564f, 0.537236392f},
-std::array<float,2>{0.473990053f, 0.061553441f},
-std::array<float,2>{0.927238405f, 0.245815113f},
-std::array<float,2>{0.303991199f, 0.731991708f},
-std::array<float,2>{0.641864657f, 0.801545799f},
-std::array<float,2>{0.0619643368f, 0.282363385f},
-std::array<float,2>{0.8456828f, 0.476435244f},
-std::array<float,2>{0.493457407f, 0.938586116f},
-std::array<float,2>{0.610577941f, 0.522185743f},
-std::array<float,2>{0.219254941f, 0.011365884f},
-std::array<float,2>{0.626037419f, 0.2054106f},
-std::array<float,2>{0.0318480432f, 0.700031936f},
-std::array<float,2>{0.918953598f, 0.775163889f},
-std::array<float,2>{0.287007481f, 0.262112975f},
-std::array<float,2>{0.520318329f, 0.316891313f},
-std::array<float,2>{0.134152949f, 0.86980015f},
-std::array<float,2>{0.780397177f, 0.668559134f},
-std::array<float,2>{0.382191092f, 0.145958588f},
-std::array<float,2>{0.940290451f, 0.0857127458f},
-std::array<float,2>{0.332786709f, 0.598445058f},
-std::array<float,2>{0.699181497f, 0.920595288f},
-std::array<float,2>{0.083025299f, 0.425390929f},
-std::array<float,2>{0.892443776f, 0.303929389f},
-std::array<float,2>{0.267832875f, 0.788845301f},
-std::array<float,2>{0.680870354f, 0.745331228f},
-std::array<float,2>{0.0068783653f, 0.233198583f},
-std::array<float,2>{0.562869251f, 0.0439316295f},
-std::array<float,2>{0.201920375f, 0.554492891f},
-std::array<float,2>{0.822344422f, 0.997797549f},
-std::array<float,2>{0.45626837f, 0.463403523f},
-std::array<float,2>{0.729838431f, 0.38330549f},
-std::array<float,2>{0.117926612f, 0.888928056f},
-std::array<float,2>{0.977806866f, 0.591408193f},
-std::array<float,2>{0.357883245f, 0.111201391f},
-std::array<float,2>{0.783651054f, 0.177551866f},
-std::array<float,2>{0.429013073f, 0.631516159f},
-std::array<float,2>{0.547120094f, 0.831959307f},
-std::array<float,2>{0.158044562f, 0.346770853f},
-std::array<float,2>{0.913254738f, 0.459857196f},
-std::array<float,2>{0.293593973f, 0.988506258f},
-std::array<float,2>{0.63824451f, 0.555930078f},
-std::array<float,2>{0.0433788411f, 0.0389891863f},
-std::array<float,2>{0.624383271f, 0.220436826f},
-std::array<float,2>{0.233699888f, 0.739495635f},
-std::array<float,2>{0.85727042f, 0.791078091f},
-std::array<float,2>{0.488080561f, 0.308080256f},
-std::array<float,2>{0.693486929f, 0.355951011f},
-std::array<float,2>{0.0924956128f, 0.837327003f},
-std::array<float,2>{0.953057408f, 0.637623191f},
-std::array<float,2>{0.339272648f, 0.18039678f},
-std::array<float,2>{0.766099453f, 0.122201793f},
-std::array<float,2>{0.388340741f, 0.579563141f},
-std::array<float,2>{0.524753332f, 0.881771803f},
-std::array<float,2>{0.125502512f, 0.382118046f},
-std::array<float,2>{0.818656564f, 0.253426075f},
-std::array<float,2>{0.463506252f, 0.771566451f},
-std::array<float,2>{0.572137296f, 0.692472637f},
-std::array<float,2>{0.189078107f, 0.217555106f},
-std::array<float,2>{0.679453433f, 0.00485452637f},
-std::array<float,2>{0.0122309672f, 0.52510947f},
-std::array<float,2>{0.90157932f, 0.952820897f},
-std::array<float,2>{0.27971229f, 0.482578427f},
-std::array<float,2>{0.560230374f, 0.435035974f},
-std::array<float,2>{0.164534479f, 0.90718621f},
-std::array<float,2>{0.791870058f, 0.605641365f},
-std::array<float,2>{0.431714892f, 0.0912321657f},
-std::array<float,2>{0.974303365f, 0.152461171f},
-std::array<float,2>{0.349233806f, 0.663193882f},
-std::array<float,2>{0.719569147f, 0.861828208f},
-std::array<float,2>{0.11388769f, 0.324865669f},
-std::array<float,2>{0.803812087f, 0.397447646f},
-std::array<float,2>{0.420296073f, 0.903176904f},
-std::array<float,2>{0.536076188f, 0.577584922f},
-std::array<float,2>{0.18116428f, 0.096161373f},
-std::array<float,2>{0.734811902f, 0.170129165f},
-std::array<float,2>{0.0976561159f, 0.649184227f},
-std::array<float,2>{0.990561724f, 0.823772728f},
-std::array<float,2>{0.367543131f, 0.367866188f},
-std::array<float,2>{0.591501832f, 0.292947114f},
-std::array<float,2>{0.20723471f, 0.810378134f},
-std::array<float,2>{0.842023253f, 0.720911205f},
-std::array<float,2>{0.448048711f, 0.238565728f},
-std::array<float,2>{0.881734788f, 0.0505405664f},
-std::array<float,2>{0.258294731f, 0.539941609f},
-std::array<float,2>{0.669787109f, 0.971036553f},
-std::array<float,2>{0.021098895f, 0.451877922f},
-std::array<float,2>{0.957594633f, 0.334369451f},
-std::array<float,2>{0.322305709f, 0.848866403f},
-std::array<float,2>{0.709026337f, 0.678733289f},
-std::array<float,2>{0.0706957951f, 0.138352633f},
-std::array<float,2>{0.50891459f, 0.0666263103f},
-std::array<float,2>{0.140792757f, 0.622195005f},
-std::array<float,2>{0.753365695f, 0.937349737f},
-std::array<float,2>{0.390900463f, 0.41702792f},
-std::array<float,2>{0.656095982f, 0.48554185f},
-std::array<float,2>{0.0509082377f, 0.96563226f},
-std::array<float,2>{0.935098767f, 0.510872364f},
-std::array<float,2>{0.308137029f, 0.0293337125f},
-std::array<float,2>{0.863897622f, 0.188305467f},
-std::array<float,2>{0.482704997f, 0.709100544f},
-std::array<float,2>{0.59836632f, 0.761259794f},
-std::array<float,2>{0.237813473f, 0.273258835f},
-std::array<float,2>{0.947780609f, 0.498098969f},
-std::array<float,2>{0.341281325f, 0.955353618f},
-std::array<float,2>{0.68892777f, 0.502831757f},
-std::array<float,2>{0.0895483941f, 0.0206512772f},
-std::array<float,2>{0.528535485f, 0.199581027f},
-std::array<float,2>{0.130179003f, 0.711870909f},
-std::array<float,2>{0.772221744f, 0.756255388f},
-std::array<float,2>{0.384528637f, 0.273644894f},
-std::array<float,2>{0.634792566f, 0.340284288f},
-std::array<float,2>{0.0420800671f, 0.853170633f},
-std::array<float,2>{0.90636003f, 0.685438812f},
-std::array<float,2>{0.289875299f, 0.128900126f},
-std::array<float,2>{0.853067815f, 0.0720360354f},
-std::array<float,2>{0.49182269f, 0.610292733f},
-std::array<float,2>{0.620698869f, 0.929547966f},
-std::array<float,2>{0.230356336f, 0.409455359f},
-std::array<float,2>{0.79317987f, 0.285939574f},
-std::array<float,2>{0.434629381f, 0.799117029f},
-std::array<float,2>{0.557744741f, 0.728395045f},
-std::array<float,2>{0.168960616f, 0.248125121f},
-std::array<float,2>{0.724763095f, 0.057440009f},
-std::array<float,2>{0.110947534f, 0.534665465f},
-std::array<float,2>{0.970502853f, 0.982350767f},
-std::array<float,2>{0.344312042f, 0.441614568f},
-std::array<float,2>{0.574518621f, 0.403692693f},
-std::array<float,2>{0.192652345f, 0.895777524f},
-std::array<float,2>{0.814502358f, 0.566629469f},
-std::array<float,2>{0.467864096f, 0.107839249f},
-std::array<float,2>{0.905238688f, 0.161345229f},
-std::array<float,2>{0.275939465f, 0.646736741f},
-std::array<float,2>{0.674975991f, 0.819250107f},
-std::array<float,2>{0.0116746044f, 0.363645256f},
-std::array<float,2>{0.837993681f, 0.426062226f},
-std::array<float,2>{0.451807648f, 0.915831566f},
-std::array<float,2>{0.58708787f, 0.597626805f},
-std::array<float,2>{0.204805702f, 0.0782016888f},
-std::array<float,2>{0.666964173f, 0.143449172f},
-std::array<float,2>{0.0188712515f, 0.666026771f},
-std::array<float,2>{0.878187418f, 0.874935806f},
-std::array<float,2>{0.262555331f, 0.315242857f},
-std::array<float,2>{0.533493936f, 0.259627283f},
-std::array<float,2>{0.18454586f, 0.780429363f},
-std::array<float,2>{0.797747254f, 0.698922813f},
-std::array<float,2>{0.415658534f, 0.209894642f},
-std::array<float,2>{0.985903263f, 0.0135211069f},
-std::array<float,2>{0.372970641f, 0.51922363f},
-std::array<float,2>{0.739720941f, 0.944836318f},
-std::array<float,2>{0.0977897942f, 0.470632792f},
-std::array<float,2>{0.930295646f, 0.348652691f},
-std::array<float,2>{0.311568707f, 0.835703492f},
-std::array<float,2>{0.648681104f, 0.628116846f},
-std::array<float,2>{0.0500287786f, 0.175180867f},
-std::array<float,2>{0.597269773f, 0.115575008f},
-std::array<float,2>{0.240904018f, 0.587024271f},
-std::array<float,2>{0.862472296f, 0.884011984f},
-std::array<float,2>{0.477159917f, 0.390463471f},
-std::array<float,2>{0.704122603f, 0.466308504f},
-std::array<float,2>{0.0766458735f, 0.992399514f},
-std::array<float,2>{0.954008579f, 0.550448596f},
-std::array<float,2>{0.327385396f, 0.0408122353f},
-std::array<float,2>{0.756403148f, 0.229509771f},
-std::array<float,2>{0.395044535f, 0.746807456f},
-std::array<float,2>{0.514635503f, 0.784780025f},
-std::array<float,2>{0.144575298f, 0.297063142f},
-std::array<float,2>{0.886281133f, 0.375688285f},
-std::array<float,2>{0.253691047f, 0.876698852f},
-std::array<float,2>{0.662050784f, 0.58397913f},
-std::array<float,2>{0.0258618388f, 0.12092308f},
-std::array<float,2>{0.583920598f, 0.185728535f},
-std::array<float,2>{0.212198988f, 0.634546638f},
-std::array<float,2>{0.830437005f, 0.842826784f},
-std::array<float,2>{0.444527626f, 0.354993731f},
-std::array<float,2>{0.74600482f, 0.311887056f},
-std::array<float,2>{0.103803843f, 0.793864608f},
-std::array<float,2>{0.995821118f, 0.73784095f},
-std::array<float,2>{0.363788903f, 0.223516613f},
-std::array<float,2>{0.807615578f, 0.0325741842f},
-std::array<float,2>{0.412775576f, 0.559951544f},
-std::array<float,2>{0.546310723f, 0.985401094f},
-std::array<float,2>{0.172368139f, 0.454771727f},
-std::array<float,2>{0.867933631f, 0.321728408f},
-std::array<float,2>{0.472463101f, 0.866546512f},
-std::array<float,2>{0.601830482f, 0.658263087f},
-std::array<float,2>{0.245732963f, 0.151270822f},
-std::array<float,2>{0.647715211f, 0.0864704773f},
-std::array<float,2>{0.0568576641f, 0.603440046f},
-std::array<float,2>{0.925019383f, 0.912137032f},
-std::array<float,2>{0.299224108f, 0.429724157f},
-std::array<float,2>{0.50182569f, 0.478651404f},
-std::array<float,2>{0.155992255f, 0.946818173f},
-std::array<float,2>{0.76023066f, 0.529875576f},
-std::array<float,2>{0.400826573f, 0.00210537156f},
-std::array<float,2>{0.965838015f, 0.21474427f},
-std::array<float,2>{0.317757279f, 0.691232264f},
-std::array<float,2>{0.71855998f, 0.769094586f},
-std::array<float,2>{0.068262808f, 0.25674063f},
-std::array<float,2>{0.773481429f, 0.4468427f},
-std::array<float,2>{0.377989709f, 0.97281456f},
-std::array<float,2>{0.516541839f, 0.544003606f},
-std::array<float,2>{0.137302324f, 0.0540824421f},
-std::array<float,2>{0.702463567f, 0.235563248f},
-std::array<float,2>{0.0804782212f, 0.726299047f},
-std::array<float,2>{0.941948116f, 0.808435738f},
-std::array<float,2>{0.330773354f, 0.295339644f},
-std::array<float,2>{0.615002692f, 0.374239594f},
-std::array<float,2>{0.226526827f, 0.825301588f},
-std::array<float,2>{0.850586474f, 0.652997255f},
-std::array<float,2>{0.499430925f, 0.164531544f},
-std::array<float,2>{0.914965153f, 0.100401282f},
-std::array<float,2>{0.283309489f, 0.571337342f},
-std::array<float,2>{0.631067157f, 0.902093887f},
-std::array<float,2>{0.0374462716f, 0.393360496f},
-std::array<float,2>{0.981520653f, 0.267793834f},
-std::array<float,2>{0.352574974f, 0.764818966f},
-std::array<float,2>{0.731160462f, 0.70503068f},
-std::array<float,2>{0.122300856f, 0.194902226f},
-std::array<float,2>{0.550810814f, 0.0244271457f},
-std::array<float,2>{0.161002219f, 0.512059212f},
-std::array<float,2>{0.788851321f, 0.9621135f},
-std::array<float,2>{0.422835469f, 0.488770425f},
-std::array<float,2>{0.685055137f, 0.418797553f},
-std::array<float,2>{0.000708198699f, 0.932127535f},
-std::array<float,2>{0.89838177f, 0.619685292f},
-std::array<float,2>{0.269613147f, 0.0632014498f},
-std::array<float,2>{0.826585114f, 0.134574413f},
-std::array<float,2>{0.457213908f, 0.675572693f},
-std::array<float,2>{0.56822747f, 0.8470186f},
-std::array<float,2>{0.197424412f, 0.328864217f},
-std::array<float,2>{0.960098982f, 0.417924941f},
-std::array<float,2>{0.3212713f, 0.936839402f},
-std::array<float,2>{0.707723916f, 0.622699916f},
-std::array<float,2>{0.0738036335f, 0.0672075078f},
-std::array<float,2>{0.511056483f, 0.138096452f},
-std::array<float,2>{0.144071102f, 0.679530203f},
-std::array<float,2>{0.750075579f, 0.849541664f},
-std::array<float,2>{0.393363595f, 0.334483773f},
-std::array<float,2>{0.654151142f, 0.272471249f},
-std::array<float,2>{0.0543657243f, 0.760892391f},
-std::array<float,2>{0.937093318f, 0.709908843f},
-std::array<float,2>{0.305003911f, 0.187635288f},
-std::array<float,2>{0.865508795f, 0.0298384819f},
-std::array<float,2>{0.480686456f, 0.511253953f},
-std::array<float,2>{0.599837482f, 0.964856207f},
-std::array<float,2>{0.235725582f, 0.48608616f},
-std::array<float,2>{0.80096662f, 0.367582232f},
-std::array<float,2>{0.418550611f, 0.823537707f},
-std::array<float,2>{0.538292289f, 0.648782492f},
-std::array<float,2>{0.183193684f, 0.170509979f},
-std::array<float,2>{0.737926006f, 0.0961961746f},
-std::array<float,2>{0.0942437425f, 0.577734232f},
-std::array<float,2>{0.98887068f, 0.902610183f},
-std::array<float,2>{0.369812846f, 0.396807581f},
-std::array<float,2>{0.592762172f, 0.451463014f},
-std::array<float,2>{0.20956704f, 0.971621513f},
-std::array<float,2>{0.839885235f, 0.5393278f},
-std::array<float,2>{0.44541961f, 0.0499597602f},
-std::array<float,2>{0.879744112f, 0.239057019f},
-std::array<float,2>{0.261318445f, 0.721305668f},
-std::array<float,2>{0.670226097f, 0.809901357f},
-std::array<float,2>{0.0224011578f, 0.292430699f},
-std::array<float,2>{0.81790489f, 0.482935339f},
-std::array<float,2>{0.462845623f, 0.952180684f},
-std::array<float,2>{0.57328707f, 0.524630249f},
-std::array<float,2>{0.190711409f, 0.00435057515f},
-std::array<float,2>{0.676044643f, 0.217236206f},
-std::array<float,2>{0.0146814287f, 0.692994893f},
-std::array<float,2>{0.899511993f, 0.77226907f},
-std::array<float,2>{0.278856009f, 0.253092647f},
-std::array<float,2>{0.56130147f, 0.324562162f},
-std::array<float,2>{0.166586056f, 0.86168915f},
-std::array<float,2>{0.790158093f, 0.663613856f},
-std::array<float,2>{0.429966688f, 0.152981117f},
-std::array<float,2>{0.974976897f, 0.0917204469f},
-std::array<float,2>{0.350886852f, 0.606244862f},
-std::array<float,2>{0.721272945f, 0.906346858f},
-std::array<float,2>{0.11647854f, 0.435407966f},
-std::array<float,2>{0.910826623f, 0.308356315f},
-std::array<float,2>{0.295214921f, 0.791954994f},
-std::array<float,2>{0.639668465f, 0.740005016f},
-std::array<float,2>{0.0464851372f, 0.219984174f},
-std::array<float,2>{0.621703565f, 0.0382342339f},
-std::array<float,2>{0.231497496f, 0.556438684f},
-std::array<float,2>{0.859054029f, 0.989043117f},
-std::array<float,2>{0.484380394f, 0.459196717f},
-std::array<float,2>{0.692085445f, 0.382365793f},
-std::array<float,2>{0.0899047032f, 0.881046057f},
-std::array<float,2>{0.950808048f, 0.579742968f},
-std::array<float,2>{0.337809265f, 0.122614041f},
-std::array<float,2>{0.767873406f, 0.180095553f},
-std::array<float,2>{0.389930755f, 0.636785388f},
-std::array<float,2>{0.525989592f, 0.837521672f},
-std::array<float,2>{0.127188519f, 0.356049567f},
-std::array<float,2>{0.892909467f, 0.463304847f},
-std::array<float,2>{0.266385257f, 0.997101367f},
-std::array<float,2>{0.681941628f, 0.554005921f},
-std::array<float,2>{0.00415887218f, 0.0431248993f},
-std::array<float,2>{0.564594448f, 0.23276931f},
-std::array<float,2>{0.200400874f, 0.746007204f},
-std::array<float,2>{0.821728647f, 0.788505316f},
-std::array<float,2>{0.453700513f, 0.304596633f},
-std::array<float,2>{0.727541864f, 0.3473849f},
-std::array<float,2>{0.119954653f, 0.831113338f},
-std::array<float,2>{0.979386926f, 0.631234646f},
-std::array<float,2>{0.356666297f, 0.176790416f},
-std::array<float,2>{0.782940209f, 0.110755011f},
-std::array<float,2>{0.426867396f, 0.590896726f},
-std::array<float,2>{0.549823344f, 0.88925904f},
-std::array<float,2>{0.159057453f, 0.38322863f},
-std::array<float,2>{0.845723927f, 0.26238063f},
-std::array<float,2>{0.495609373f, 0.774853587f},
-std::array<float,2>{0.613128245f, 0.699528396f},
-std::array<float,2>{0.221917316f, 0.205723628f},
-std::array<float,2>{0.628020823f, 0.0108686872f},
-std::array<float,2>{0.0334335566f, 0.521494448f},
-std::array<float,2>{0.920501888f, 0.939267755f},
-std::array<float,2>{0.289000988f, 0.475617915f},
-std::array<float,2>{0.522530615f, 0.424976677f},
-std::array<float,2>{0.136403799f, 0.92027384f},
-std::array<float,2>{0.778663814f, 0.597678721f},
-std::array<float,2>{0.380243331f, 0.0850367099f},
-std::array<float,2>{0.939202607f, 0.146051943f},
-std::array<float,2>{0.334167838f, 0.668334484f},
-std::array<float,2>{0.695729017f, 0.86931771f},
-std::array<float,2>{0.0857826173f, 0.317350566f},
-std::array<float,2>{0.763796329f, 0.400239021f},
-std::array<float,2>{0.403682083f, 0.891154826f},
-std::array<float,2>{0.505434155f, 0.566101968f},
-std::array<float,2>{0.148590952f, 0.104901172f},
-std::array<float,2>{0.713664711f, 0.15939267f},
-std::array<float,2>{0.064112775f, 0.641721249f},
-std::array<float,2>{0.963075519f, 0.814401984f},
-std::array<float,2>{0.313505203f, 0.359946132f},
-std::array<float,2>{0.608438969f, 0.282920927f},
-std::array<float,2>{0.249549866f, 0.800998211f},
-std::array<float,2>{0.871461034f, 0.7314713f},
-std::array<float,2>{0.475386381f, 0.245134383f},
-std::array<float,2>{0.92784816f, 0.0622218773f},
-std::array<float,2>{0.302017063f, 0.537834764f},
-std::array<float,2>{0.644437551f, 0.977476537f},
-std::array<float,2>{0.0587414764f, 0.441389114f},
-std::array<float,2>{0.998615801f, 0.337602615f},
-std::array<float,2>{0.362662524f, 0.858304322f},
-std::array<float,2>{0.74797833f, 0.683250785f},
-std::array<float,2>{0.105709434f, 0.130923837f},
-std::array<float,2>{0.539887309f, 0.0769829303f},
-std::array<float,2>{0.178958908f, 0.614580393f},
-std::array<float,2>{0.811092734f, 0.92199558f},
-std::array<float,2>{0.409643888f, 0.411971778f},
-std::array<float,2>{0.65832299f, 0.492893577f},
-std::array<float,2>{0.0303936228f, 0.959805012f},
-std::array<float,2>{0.888759971f, 0.504733741f},
-std::array<float,2>{0.254043132f, 0.0175233167f},
-std::array<float,2>{0.834207416f, 0.196521863f},
-std::array<float,2>{0.439985931f, 0.717962742f},
-std::array<float,2>{0.57813251f, 0.75035131f},
-std::array<float,2>{0.215588093f, 0.279489964f},
-std::array<float,2>{0.982710123f, 0.488556206f},
-std::array<float,2>{0.35525462f, 0.96268177f},
-std::array<float,2>{0.73280108f, 0.512285292f},
-std::array<float,2>{0.123838812f, 0.025251694f},
-std::array<float,2>{0.554678321f, 0.194524899f},
-std::array<float,2>{0.162330195f, 0.704219222f},
-std::array<float,2>{0.786834776f, 0.765167773f},
-std::array<float,2>{0.42525658f, 0.268437147f},
-std::array<float,2>{0.685722888f, 0.32845512f},
-std::array<float,2>{0.0029991311f, 0.847411394f},
-std::array<float,2>{0.895347536f, 0.675179362f},
-std::array<float,2>{0.272461653f, 0.13409549f},
-std::array<float,2>{0.825742424f, 0.0625937209f},
-std::array<float,2>{0.459653586f, 0.619437575f},
-std::array<float,2>{0.568431497f, 0.932481527f},
-std::array<float,2>{0.196537226f, 0.418233186f},
-std::array<float,2>{0.775464475f, 0.295568883f},
-std::array<float,2>{0.375627577f, 0.807887316f},
-std::array<float,2>{0.518959522f, 0.72592169f},
-std::array<float,2>{0.139189482f, 0.235980794f},
-std::array<float,2>{0.700391591f, 0.0543688275f},
-std::array<float,2>{0.0790167525f, 0.544541359f},
-std::array<float,2>{0.944200635f, 0.973223269f},
-std::array<float,2>{0.328490943f, 0.446606189f},
-std::array<float,2>{0.615996122f, 0.392858595f},
-std::array<float,2>{0.222907662f, 0.901844084f},
-std::array<float,2>{0.84945178f, 0.571818233f},
-std::array<float,2>{0.496778995f, 0.0996455625f},
-std::array<float,2>{0.916667938f, 0.16462338f},
-std::array<float,2>{0.281398326f, 0.652748406f},
-std::array<float,2>{0.63027364f, 0.825906038f},
-std::array<float,2>{0.0366400033f, 0.374607384f},
-std::array<float,2>{0.870251298f, 0.430520415f},
-std::array<float,2>{0.469938695f, 0.912919223f},
-std::array<float,2>{0.605134428f, 0.602951944f},
-std::array<float,2>{0.242987111f, 0.0862404183f},
-std::array<float,2>{0.645324051f, 0.150430292f},
-std::array<float,2>{0.0559502877f, 0.658791423f},
-std::array<float,2>{0.923727214f, 0.866919339f},
-std::array<float,2>{0.298413336f, 0.321899414f},
-std::array<float,2>{0.503886878f, 0.256233186f},
-std::array<float,2>{0.153487563f, 0.768653929f},
-std::array<float,2>{0.759738743f, 0.69089973f},
-std::array<float,2>{0.399913013f, 0.214314848f},
-std::array<float,2>{0.968608379f, 0.00262028584f},
-std::array<float,2>{0.31983915f, 0.529467881f},
-std::array<float,2>{0.716432035f, 0.946400106f},
-std::array<float,2>{0.0690236911f, 0.479488343f},
-std::array<float,2>{0.883813679f, 0.354714632f},
-std::array<float,2>{0.251074582f, 0.84337604f},
-std::array<float,2>{0.663569152f, 0.633847713f},
-std::array<float,2>{0.02353682f, 0.186253995f},
-std::array<float,2>{0.585607111f, 0.120270491f},
-std::array<float,2>{0.214648828f, 0.583054006f},
-std::array<float,2>{0.828879654f, 0.876140952f},
-std::array<float,2>{0.442831904f, 0.375333369f},
-std::array<float,2>{0.744091332f, 0.454493999f},
-std::array<float,2>{0.102964476f, 0.986226678f},
-std::array<float,2>{0.993284106f, 0.560474575f},
-std::array<float,2>{0.365729243f, 0.0329732597f},
-std::array<float,2>{0.805902123f, 0.222753525f},
-std::array<float,2>{0.411248058f, 0.737665772f},
-std::array<float,2>{0.543379962f, 0.79317683f},
-std::array<float,2>{0.17408973f, 0.312447995f},
-std::array<float,2>{0.93234688f, 0.390125692f},
-std::array<float,2>{0.310245097f, 0.884593248f},
-std::array<float,2>{0.651509523f, 0.587856174f},
-std::array<float,2>{0.0471495241f, 0.115864702f},
-std::array<float,2>{0.595589757f, 0.175518155f},
-std::array<float,2>{0.238304913f, 0.628612161f},
-std::array<float,2>{0.859796464f, 0.835312486f},
-std::array<float,2>{0.480413884f, 0.349304199f},
-std::array<float,2>{0.705335915f, 0.297532976f},
-std::array<float,2>{0.0749545023f, 0.784655809f},
-std::array<float,2>{0.956528127f, 0.746480465f},
-std::array<float,2>{0.32600227f, 0.230329752f},
-std::array<float,2>{0.7547611f, 0.0405119993f},
-std::array<float,2>{0.397272587f, 0.549870312f},
-std::array<float,2>{0.512886167f, 0.9927634f},
-std::array<float,2>{0.147000283f, 0.46646446f},
-std::array<float,2>{0.837203145f, 0.3146469f},
-std::array<float,2>{0.449287534f, 0.8743155f},
-std::array<float,2>{0.588796616f, 0.666979611f},
-std::array<float,2>{0.206803888f, 0.14306277f},
-std::array<float,2>{0.665583134f, 0.0787120461f},
-std::array<float,2>{0.0164239127f, 0.597034693f},
-std::array<float,2>{0.876941085f, 0.915344715f},
-std::array<float,2>{0.26425463f, 0.426312834f},
-std::array<float,2>{0.533028185f, 0.470158428f},
-std::array<float,2>{0.18729651f, 0.944367051f},
-std::array<float,2>{0.799998701f, 0.518640459f},
-std::array<float,2>{0.417703688f, 0.0127658574f},
-std::array<float,2>{0.988242686f, 0.209032699f},
-std::array<float,2>{0.37490195f, 0.698561668f},
-std::array<float,2>{0.741191447f, 0.780845046f},
-std::array<float,2>{0.100029849f, 0.258872032f},
-std::array<float,2>{0.796635449f, 0.442029029f},
-std::array<float,2>{0.437254876f, 0.98149693f},
-std::array<float,2>{0.555919707f, 0.535053074f},
-std::array<float,2>{0.170195997f, 0.0567570515f},
-std::array<float,2>{0.724091351f, 0.248939604f},
-std::array<float,2>{0.112811506f, 0.727548122f},
-std::array<float,2>{0.971283197f, 0.799784541f},
-std::array<float,2>{0.347284645f, 0.28539905f},
-std::array<float,2>{0.577935278f, 0.363924205f},
-std::array<float,2>{0.194579646f, 0.818592072f},
-std::array<float,2>{0.81424588f, 0.647225559f},
-std::array<float,2>{0.46601823f, 0.161825791f},
-std::array<float,2>{0.902567983f, 0.107952513f},
-std::array<float,2>{0.274185419f, 0.566894889f},
-std::array<float,2>{0.672963083f, 0.896401227f},
-std::array<float,2>{0.00895242207f, 0.403891981f},
-std::array<float,2>{0.945897281f, 0.274259448f},
-std::array<float,2>{0.342362672f, 0.75649178f},
-std::array<float,2>{0.690573573f, 0.71141988f},
-std::array<float,2>{0.0876304284f, 0.199712917f},
-std::array<float,2>{0.529851079f, 0.0211399067f},
-std::array<float,2>{0.131786197f, 0.502237976f},
-std::array<float,2>{0.771415412f, 0.955926001f},
-std::array<float,2>{0.385539621f, 0.498668462f},
-std::array<float,2>{0.633111f, 0.410072625f},
-std::array<float,2>{0.0404105671f, 0.929094553f},
-std::array<float,2>{0.909508288f, 0.609799862f},
-std::array<float,2>{0.292628884f, 0.0713112503f},
-std::array<float,2>{0.854902029f, 0.128188878f},
-std::array<float,2>{0.489675939f, 0.68464148f},
-std::array<float,2>{0.619073987f, 0.852590084f},
-std::array<float,2>{0.227517858f, 0.340623677f},
-std::array<float,2>{0.991096854f, 0.394571871f},
-std::array<float,2>{0.367920667f, 0.905609965f},
-std::array<float,2>{0.735003233f, 0.576098442f},
-std::array<float,2>{0.09707506f, 0.0937559381f},
-std::array<float,2>{0.535643876f, 0.168040767f},
-std::array<float,2>{0.18093206f, 0.65228641f},
-std::array<float,2>{0.804566324f, 0.821096957f},
-std::array<float,2>{0.420419395f, 0.370258778f},
-std::array<float,2>{0.669244587f, 0.289889872f},
-std::array<float,2>{0.020801153f, 0.810667336f},
-std::array<float,2>{0.881254971f, 0.720236659f},
-std::array<float,2>{0.258658528f, 0.24111937f},
-std::array<float,2>{0.84276247f, 0.0479819551f},
-std::array<float,2>{0.447437465f, 0.542190433f},
-std::array<float,2>{0.591005504f, 0.969064534f},
-std::array<float,2>{0.207677037f, 0.449348152f},
-std::array<float,2>{0.753493011f, 0.332464427f},
-std::array<float,2>{0.391534507f, 0.851519763f},
-std::array<float,2>{0.509376287f, 0.677219987f},
-std::array<float,2>{0.141152382f, 0.139298424f},
-std::array<float,2>{0.709526896f, 0.0693451315f},
-std::array<float,2>{0.0709780678f, 0.624035776f},
-std::array<float,2>{0.957120121f, 0.934105456f},
-std::array<float,2>{0.322759807f, 0.414774567f},
-std::array<float,2>{0.597897589f, 0.486390054f},
-std::array<float,2>{0.2375011f, 0.966886461f},
-std::array<float,2>{0.863355935f, 0.508918464f},
-std::array<float,2>{0.483245194f, 0.0291411076f},
-std::array<float,2>{0.934744418f, 0.190195307f},
-std::array<float,2>{0.307919204f, 0.708506465f},
-std::array<float,2>{0.655467868f, 0.758388937f},
-std::array<float,2>{0.0513663292f, 0.270537734f},
-std::array<float,2>{0.856522202f, 0.458426714f},
-std::array<float,2>{0.487472653f, 0.991033018f},
-std::array<float,2>{0.624857306f, 0.5566625f},
-std::array<float,2>{0.234331325f, 0.0353118703f},
-std::array<float,2>{0.637934089f, 0.222476065f},
-std::array<float,2>{0.0437918752f, 0.741167724f},
-std::array<float,2>{0.913672686f, 0.789278805f},
-std::array<float,2>{0.293393761f, 0.306153327f},
-std::array<float,2>{0.525093734f, 0.358512908f},
-std::array<float,2>{0.125020459f, 0.838965058f},
-std::array<float,2>{0.766373158f, 0.640522182f},
-std::array<float,2>{0.387867987f, 0.181859329f},
-std::array<float,2>{0.952404261f, 0.124183349f},
-std::array<float,2>{0.33979544f, 0.581591368f},
-std::array<float,2>{0.694216847f, 0.878911138f},
-std::array<float,2>{0.0920575261f, 0.378911585f},
-std::array<float,2>{0.902265608f, 0.251265138f},
-std::array<float,2>{0.280169308f, 0.770760119f},
-std::array<float,2>{0.679163694f, 0.694373965f},
-std::array<float,2>{0.0120807923f, 0.2148536f},
-std::array<float,2>{0.571506202f, 0.0059988373f},
-std::array<float,2>{0.188581064f, 0.526716352f},
-std::array<float,2>{0.818923414f, 0.950346708f},
-std::array<float,2>{0.463029146f, 0.480833828f},
-std::array<float,2>{0.718922973f, 0.436421335f},
-std::array<float,2>{0.113635845f, 0.909589648f},
-std::array<float,2>{0.973720729f, 0.607654631f},
-std::array<float,2>{0.348737001f, 0.0920789763f},
-std::array<float,2>{0.791276276f, 0.156152815f},
-std::array<float,2>{0.432430118f, 0.660159409f},
-std::array<float,2>{0.560011327f, 0.860226035f},
-std::array<float,2>{0.164682031f, 0.326787621f},
-std::array<float,2>{0.919638038f, 0.473461628f},
-std::array<float,2>{0.286355436f, 0.939673364f},
-std::array<float,2>{0.626692832f, 0.519561708f},
-std::array<float,2>{0.0314023197f, 0.00880393572f},
-std::array<float,2>{0.611309648f, 0.203895986f},
-std::array<float,2>{0.219098464f, 0.70243144f},
-std::array<float,2>{0.845167816f, 0.777107537f},
-std::array<float,2>{0.49404788f, 0.264763743f},
-std::array<float,2>{0.698667705f, 0.319393247f},
-std::array<float,2>{0.0839640945f, 0.868497789f},
-std::array<float,2>{0.939851522f, 0.670117021f},
-std::array<float,2>{0.332433522f, 0.146603808f},
-std::array<float,2>{0.780855715f, 0.0831250176f},
-std::array<float,2>{0.382713884f, 0.599692047f},
-std::array<float,2>{0.519974947f, 0.919028759f},
-std::array<float,2>{0.134300202f, 0.422559083f},
-std::array<float,2>{0.822826147f, 0.302230567f},
-std::array<float,2>{0.456771195f, 0.786533713f},
-std::array<float,2>{0.563255608f, 0.743684113f},
-std::array<float,2>{0.201195508f, 0.231752589f},
-std::array<float,2>{0.681501091f, 0.0467501655f},
-std::array<float,2>{0.00739007769f, 0.552520871f},
-std::array<float,2>{0.891664147f, 0.998499215f},
-std::array<float,2>{0.268153429f, 0.462450892f},
-std::array<float,2>{0.547548652f, 0.38654837f},
-std::array<float,2>{0.157597795f, 0.887215555f},
-std::array<float,2>{0.784142494f, 0.592715025f},
-std::array<float,2>{0.429263562f, 0.11175362f},
-std::array<float,2>{0.978083968f, 0.177999422f},
-std::array<float,2>{0.358298481f, 0.629366815f},
-std::array<float,2>{0.730035305f, 0.829814792f},
-std::array<float,2>{0.117445558f, 0.344933927f},
-std::array<float,2>{0.809340239f, 0.412345707f},
-std::array<float,2>{0.407071769f, 0.924596786f},
-std::array<float,2>{0.541873038f, 0.616048157f},
-std::array<float,2>{0.176795438f, 0.0749377534f},
-std::array<float,2>{0.748571336f, 0.130232021f},
-std::array<float,2>{0.108869992f, 0.681582332f},
-std::array<float,2>{0.997403085f, 0.856278718f},
-std::array<float,2>{0.35981974f, 0.338940173f},
-std::array<float,2>{0.580450773f, 0.278511405f},
-std::array<float,2>{0.217117399f, 0.752217472f},
-std::array<float,2>{0.832458794f, 0.716194272f},
-std::array<float,2>{0.438766569f, 0.197595477f},
-std::array<float,2>{0.888011456f, 0.0183046889f},
-std::array<float,2>{0.256229609f, 0.507758021f},
-std::array<float,2>{0.657300353f, 0.958223343f},
-std::array<float,2>{0.0275392663f, 0.495964199f},
-std::array<float,2>{0.960992694f, 0.361567885f},
-std::array<float,2>{0.31463033f, 0.815518558f},
-std::array<float,2>{0.712731659f, 0.64440161f},
-std::array<float,2>{0.0647917464f, 0.156854615f},
-std::array<float,2>{0.505872011f, 0.102188297f},
-std::array<float,2>{0.150613353f, 0.563336551f},
-std::array<float,2>{0.763537169f, 0.893329203f},
-std::array<float,2>{0.405094892f, 0.400719255f},
-std::array<float,2>{0.642499566f, 0.438657254f},
-std::array<float,2>{0.0620928667f, 0.979025722f},
-std::array<float,2>{0.927668989f, 0.535841703f},
-std::array<float,2>{0.304685175f, 0.0589941964f},
-std::array<float,2>{0.873721719f, 0.243023172f},
-std::array<float,2>{0.474482208f, 0.733606815f},
-std::array<float,2>{0.607077718f, 0.802767277f},
-std::array<float,2>{0.247120634f, 0.284673005f},
-std::array<float,2>{0.941788375f, 0.449170828f},
-std::array<float,2>{0.330189496f, 0.975527525f},
-std::array<float,2>{0.702867091f, 0.545507014f},
-std::array<float,2>{0.0806952491f, 0.0515596531f},
-std::array<float,2>{0.515627861f, 0.236893579f},
-std::array<float,2>{0.137106434f, 0.723977685f},
-std::array<float,2>{0.774146616f, 0.805931568f},
-std::array<float,2>{0.378652364f, 0.294526398f},
-std::array<float,2>{0.631722033f, 0.372696489f},
-std::array<float,2>{0.0380749702f, 0.827551365f},
-std::array<float,2>{0.914331317f, 0.654435635f},
-std::array<float,2>{0.283845872f, 0.167387784f},
-std::array<float,2>{0.851279557f, 0.0981971249f},
-std::array<float,2>{0.499630243f, 0.57267803f},
-std::array<float,2>{0.614570081f, 0.899312198f},
-std::array<float,2>{0.225746915f, 0.391867548f},
-std::array<float,2>{0.788457811f, 0.266014129f},
-std::array<float,2>{0.421952575f, 0.762865305f},
-std::array<float,2>{0.551681876f, 0.705554545f},
-std::array<float,2>{0.160396144f, 0.191456154f},
-std::array<float,2>{0.730663717f, 0.026823815f},
-std::array<float,2>{0.122989111f, 0.515452981f},
-std::array<float,2>{0.981986582f, 0.96389395f},
-std::array<float,2>{0.353179991f, 0.490860015f},
-std::array<float,2>{0.567424059f, 0.421349108f},
-std::array<float,2>{0.197997287f, 0.930523753f},
-std::array<float,2>{0.827095211f, 0.617257416f},
-std::array<float,2>{0.457690358f, 0.0654689297f},
-std::array<float,2>{0.897622764f, 0.135064811f},
-std::array<float,2>{0.270477802f, 0.673448265f},
-std::array<float,2>{0.685285032f, 0.845078051f},
-std::array<float,2>{0.000209874896f, 0.332011491f},
-std::array<float,2>{0.830950797f, 0.378358781f},
-std::array<float,2>{0.444829583f, 0.878737748f},
-std::array<float,2>{0.58320576f, 0.585664868f},
-std::array<float,2>{0.212778851f, 0.117425561f},
-std::array<float,2>{0.661167502f, 0.184776336f},
-std::array<float,2>{0.0260428693f, 0.63543731f},
-std::array<float,2>{0.886173069f, 0.841647267f},
-std::array<float,2>{0.253322452f, 0.352253288f},
-std::array<float,2>{0.546699107f, 0.310469657f},
-std::array<float,2>{0.171968088f, 0.79505372f},
-std::array<float,2>{0.806866646f, 0.734998524f},
-std::array<float,2>{0.41255042f, 0.225416839f},
-std::array<float,2>{0.995234013f, 0.034265589f},
-std::array<float,2>{0.363575846f, 0.562413394f},
-std::array<float,2>{0.745229781f, 0.988226533f},
-std::array<float,2>{0.104085043f, 0.455338717f},
-std::array<float,2>{0.925521612f, 0.322360575f},
-std::array<float,2>{0.299738735f, 0.864869118f},
-std::array<float,2>{0.648429394f, 0.658005595f},
-std::array<float,2>{0.0572670288f, 0.149329066f},
-std::array<float,2>{0.602523744f, 0.0895712376f},
-std::array<float,2>{0.245575085f, 0.604822993f},
-std::array<float,2>{0.867340207f, 0.91152966f},
-std::array<float,2>{0.471969932f, 0.431942582f},
-std::array<float,2>{0.71785903f, 0.478460461f},
-std::array<float,2>{0.0676980615f, 0.948430717f},
-std::array<float,2>{0.966502845f, 0.527979195f},
-std::array<float,2>{0.31828782f, 0.00067791203f},
-std::array<float,2>{0.760700226f, 0.211448595f},
-std::array<float,2>{0.401240379f, 0.689336061f},
-std::array<float,2>{0.501259267f, 0.766668677f},
-std::array<float,2>{0.155701652f, 0.254226118f},
-std::array<float,2>{0.878700376f, 0.42786786f},
-std::array<float,2>{0.262153655f, 0.916276455f},
-std::array<float,2>{0.666268945f, 0.594076574f},
-std::array<float,2>{0.0190817676f, 0.0813375711f},
-std::array<float,2>{0.587485671f, 0.140975609f},
-std::array<float,2>{0.20442453f, 0.665391445f},
-std::array<float,2>{0.838598847f, 0.871771514f},
-std::array<float,2>{0.451558203f, 0.313206643f},
-std::array<float,2>{0.739813685f, 0.261274517f},
-std::array<float,2>{0.0984952748f, 0.77805227f},
-std::array<float,2>{0.985550463f, 0.69532913f},
-std::array<float,2>{0.372136593f, 0.207572654f},
-std::array<float,2>{0.79690218f, 0.0146346325f},
-std::array<float,2>{0.415154338f, 0.516556621f},
-std::array<float,2>{0.534177542f, 0.942494392f},
-std::array<float,2>{0.183940679f, 0.470903069f},
-std::array<float,2>{0.863135815f, 0.35082525f},
-std::array<float,2>{0.47678858f, 0.833365798f},
-std::array<float,2>{0.596794546f, 0.626496136f},
-std::array<float,2>{0.240379155f, 0.172001868f},
-std::array<float,2>{0.64922452f, 0.113620169f},
-std::array<float,2>{0.0503138751f, 0.588441133f},
-std::array<float,2>{0.929720402f, 0.88591671f},
-std::array<float,2>{0.312058061f, 0.388320893f},
-std::array<float,2>{0.513975024f, 0.467609733f},
-std::array<float,2>{0.145408422f, 0.994618356f},
-std::array<float,2>{0.755936563f, 0.548489809f},
-std::array<float,2>{0.394627064f, 0.0412241556f},
-std::array<float,2>{0.953505754f, 0.228485346f},
-std::array<float,2>{0.327972651f, 0.748962164f},
-std::array<float,2>{0.705024064f, 0.781610131f},
-std::array<float,2>{0.077145353f, 0.300588965f},
-std::array<float,2>{0.77153945f, 0.496422768f},
-std::array<float,2>{0.384086758f, 0.953986883f},
-std::array<float,2>{0.529269516f, 0.501644135f},
-std::array<float,2>{0.130395174f, 0.0225132108f},
-std::array<float,2>{0.689198136f, 0.202425048f},
-std::array<float,2>{0.0890712887f, 0.714543819f},
-std::array<float,2>{0.947525084f, 0.755337894f},
-std::array<float,2>{0.341687858f, 0.275775313f},
-std::array<float,2>{0.6202178f, 0.342790961f},
-std::array<float,2>{0.229504675f, 0.853888333f},
-std::array<float,2>{0.853016198f, 0.686641634f},
-std::array<float,2>{0.491489619f, 0.125832111f},
-std::array<float,2>{0.907037497f, 0.0734427497f},
-std::array<float,2>{0.289440066f, 0.611544609f},
-std::array<float,2>{0.63563472f, 0.927611291f},
-std::array<float,2>{0.0427083038f, 0.407252073f},
-std::array<float,2>{0.969765246f, 0.287119687f},
-std::array<float,2>{0.344164073f, 0.797007143f},
-std::array<float,2>{0.725495875f, 0.729631245f},
-std::array<float,2>{0.110602908f, 0.24659279f},
-std::array<float,2>{0.558475733f, 0.0561443344f},
-std::array<float,2>{0.169784382f, 0.531403601f},
-std::array<float,2>{0.793837786f, 0.983137906f},
-std::array<float,2>{0.435336858f, 0.445078284f},
-std::array<float,2>{0.675650656f, 0.404878974f},
-std::array<float,2>{0.0109604765f, 0.896820545f},
-std::array<float,2>{0.904633164f, 0.569698393f},
-std::array<float,2>{0.275718629f, 0.106808729f},
-std::array<float,2>{0.814949036f, 0.163202778f},
-std::array<float,2>{0.468564987f, 0.644642591f},
-std::array<float,2>{0.575145543f, 0.81810534f},
-std::array<float,2>{0.192872852f, 0.366140902f},
-std::array<float,2>{0.950148642f, 0.380120188f},
-std::array<float,2>{0.33661139f, 0.8804726f},
-std::array<float,2>{0.693326473f, 0.580177605f},
-std::array<float,2>{0.0915667489f, 0.123327382f},
-std::array<float,2>{0.527050912f, 0.182774112f},
-std::array<float,2>{0.12877804f, 0.639095426f},
-std::array<float,2>{0.768788159f, 0.838762581f},
-std::array<float,2>{0.388855368f, 0.358120024f},
-std::array<float,2>{0.639340818f, 0.305606216f},
-std::array<float,2>{0.0455528498f, 0.790076613f},
-std::array<float,2>{0.911251903f, 0.741804361f},
-std::array<float,2>{0.296634048f, 0.221133322f},
-std::array<float,2>{0.858175576f, 0.0370986089f},
-std::array<float,2>{0.486174464f, 0.558295369f},
-std::array<float,2>{0.622894764f, 0.992162645f},
-std::array<float,2>{0.231256977f, 0.457294643f},
-std::array<float,2>{0.78980577f, 0.32724902f},
-std::array<float,2>{0.431459039f, 0.860894382f},
-std::array<float,2>{0.562077343f, 0.661648691f},
-std::array<float,2>{0.167298272f, 0.154943749f},
-std::array<float,2>{0.722561598f, 0.093343243f},
-std::array<float,2>{0.116209343f, 0.609326363f},
-std::array<float,2>{0.976235092f, 0.908303142f},
-std::array<float,2>{0.349914163f, 0.43699044f},
-std::array<float,2>{0.573202908f, 0.481816411f},
-std::array<float,2>{0.189663365f, 0.949355125f},
-std::array<float,2>{0.817242742f, 0.525445163f},
-std::array<float,2>{0.460969061f, 0.00745405676f},
-std::array<float,2>{0.898676217f, 0.216225639f},
-std::array<float,2>{0.27756843f, 0.694097459f},
-std::array<float,2>{0.677442431f, 0.769679844f},
-std::array<float,2>{0.0143958582f, 0.250729322f},
-std::array<float,2>{0.841092587f, 0.451149017f},
-std::array<float,2>{0.446829051f, 0.970485032f},
-std::array<float,2>{0.593136609f, 0.541990101f},
-std::array<float,2>{0.210823819f, 0.047686629f},
-std::array<float,2>{0.671405733f, 0.242090732f},
-std::array<float,2>{0.0231459159f, 0.719382107f},
-std::array<float,2>{0.880597711f, 0.812103033f},
-std::array<float,2>{0.260004103f, 0.290136546f},
-std::array<float,2>{0.537434459f, 0.369414032f},
-std::array<float,2>{0.181750149f, 0.822264969f},
-std::array<float,2>{0.802539885f, 0.650515795f},
-std::array<float,2>{0.419033498f, 0.16966255f},
-std::array<float,2>{0.989839554f, 0.0952704027f},
-std::array<float,2>{0.370951146f, 0.575177073f},
-std::array<float,2>{0.736358821f, 0.904919028f},
-std::array<float,2>{0.0949295312f, 0.396304399f},
-std::array<float,2>{0.935961783f, 0.269832999f},
-std::array<float,2>{0.30583483f, 0.759101629f},
-std::array<float,2>{0.652796626f, 0.707577765f},
-std::array<float,2>{0.0534900315f, 0.191184431f},
-std::array<float,2>{0.600769579f, 0.0279445741f},
-std::array<float,2>{0.234500334f, 0.507991135f},
-std::array<float,2>{0.866324425f, 0.967799783f},
-std::array<float,2>{0.482282221f, 0.488004684f},
-std::array<float,2>{0.708541811f, 0.415216923f},
-std::array<float,2>{0.072396718f, 0.934833229f},
-std::array<float,2>{0.959112644f, 0.623945653f},
-std::array<float,2>{0.32172215f, 0.0690604299f},
-std::array<float,2>{0.751214325f, 0.140497789f},
-std::array<float,2>{0.393725455f, 0.676476479f},
-std::array<float,2>{0.510606349f, 0.849948287f},
-std::array<float,2>{0.143286794f, 0.333782673f},
-std::array<float,2>{0.89013654f, 0.49493432f},
-std::array<float,2>{0.255680919f, 0.957443893f},
-std::array<float,2>{0.65959698f, 0.506654978f},
-std::array<float,2>{0.0302065369f, 0.0190608893f},
-std::array<float,2>{0.579999924f, 0.199022889f},
-std::array<float,2>{0.21595557f, 0.715748191f},
-std::array<float,2>{0.835475147f, 0.753116667f},
-std::array<float,2>{0.440711468f, 0.277906895f},
-std::array<float,2>{0.746163964f, 0.33806628f},
-std::array<float,2>{0.107237868f, 0.856470287f},
-std::array<float,2>{0.999913573f, 0.679871559f},
-std::array<float,2>{0.361952037f, 0.129006386f},
-std::array<float,2>{0.811993837f, 0.0759656578f},
-std::array<float,2>{0.408737451f, 0.617091417f},
-std::array<float,2>{0.540750504f, 0.925278783f},
-std::array<float,2>{0.178339586f, 0.413795739f},
-std::array<float,2>{0.872467995f, 0.283799291f},
-std::array<float,2>{0.475854218f, 0.804548025f},
-std::array<float,2>{0.6081236f, 0.733320773f},
-std::array<float,2>{0.248094425f, 0.24404265f},
-std::array<float,2>{0.643113256f, 0.0598451346f},
-std::array<float,2>{0.0602735691f, 0.536248505f},
-std::array<float,2>{0.929236114f, 0.979703367f},
-std::array<float,2>{0.301068187f, 0.438400716f},
-std::array<float,2>{0.504133046f, 0.402277201f},
-std::array<float,2>{0.149566248f, 0.893630147f},
-std::array<float,2>{0.765529752f, 0.564204037f},
-std::array<float,2>{0.402509212f, 0.10285069f},
-std::array<float,2>{0.964057148f, 0.15727216f},
-std::array<float,2>{0.313234925f, 0.643350005f},
-std::array<float,2>{0.714790225f, 0.814673483f},
-std::array<float,2>{0.0629882142f, 0.363139153f},
-std::array<float,2>{0.778036177f, 0.423188686f},
-std::array<float,2>{0.379351407f, 0.918722928f},
-std::array<float,2>{0.521753013f, 0.600647986f},
-std::array<float,2>{0.135537297f, 0.0823242888f},
-std::array<float,2>{0.696321666f, 0.147799492f},
-std::array<float,2>{0.0844891816f, 0.671355247f},
-std::array<float,2>{0.938065171f, 0.867775917f},
-std::array<float,2>{0.335572571f, 0.319217503f},
-std::array<float,2>{0.611838222f, 0.264039665f},
-std::array<float,2>{0.221184015f, 0.776209354f},
-std::array<float,2>{0.84736681f, 0.701346397f},
-std::array<float,2>{0.49502492f, 0.204891503f},
-std::array<float,2>{0.921010971f, 0.00864999089f},
-std::array<float,2>{0.287182838f, 0.521199703f},
-std::array<float,2>{0.627216637f, 0.941218793f},
-std::array<float,2>{0.0343510956f, 0.473675817f},
-std::array<float,2>{0.980370164f, 0.343945235f},
-std::array<float,2>{0.356280357f, 0.828391373f},
-std::array<float,2>{0.726987422f, 0.630681157f},
-std::array<float,2>{0.120298594f, 0.178947195f},
-std::array<float,2>{0.549018621f, 0.11302349f},
-std::array<float,2>{0.159493223f, 0.593395114f},
-std::array<float,2>{0.782103419f, 0.887824535f},
-std::array<float,2>{0.426344246f, 0.384804696f},
-std::array<float,2>{0.682774842f, 0.461628586f},
-std::array<float,2>{0.00507170986f, 0.999289513f},
-std::array<float,2>{0.894176304f, 0.551275909f},
-std::array<float,2>{0.266918689f, 0.0454631113f},
-std::array<float,2>{0.820776165f, 0.231344536f},
-std::array<float,2>{0.454464138f, 0.742515266f},
-std::array<float,2>{0.566324472f, 0.785901606f},
-std::array<float,2>{0.199472353f, 0.300915629f},
-std::array<float,2>{0.992519677f, 0.456360638f},
-std::array<float,2>{0.366300792f, 0.98639816f},
-std::array<float,2>{0.742866397f, 0.560590982f},
-std::array<float,2>{0.102183886f, 0.0337199047f},
-std::array<float,2>{0.544645786f, 0.226431012f},
-std::array<float,2>{0.17480804f, 0.735936046f},
-std::array<float,2>{0.805546224f, 0.796557903f},
-std::array<float,2>{0.410601169f, 0.309403896f},
-std::array<float,2>{0.662828982f, 0.353429914f},
-std::array<float,2>{0.0245673545f, 0.840233922f},
-std::array<float,2>{0.882989585f, 0.636122704f},
-std::array<float,2>{0.250405401f, 0.184297651f},
-std::array<float,2>{0.829146087f, 0.118732266f},
-std::array<float,2>{0.442026913f, 0.584928751f},
-std::array<float,2>{0.584066808f, 0.877330422f},
-std::array<float,2>{0.213067412f, 0.377239168f},
-std::array<float,2>{0.758378804f, 0.254921734f},
-std::array<float,2>{0.399228841f, 0.7664994f},
-std::array<float,2>{0.502485514f, 0.688427985f},
-std::array<float,2>{0.1526656f, 0.212128609f},
-std::array<float,2>{0.715485632f, 0.00186517963f},
-std::array<float,2>{0.0700374022f, 0.528369069f},
-std::array<float,2>{0.966871202f, 0.947371602f},
-std::array<float,2>{0.319089592f, 0.477002025f},
-std::array<float,2>{0.604084671f, 0.432829291f},
-std::array<float,2>{0.243584633f, 0.910601556f},
-std::array<float,2>{0.869556129f, 0.603934228f},
-std::array<float,2>{0.469312549f, 0.0884827003f},
-std::array<float,2>{0.922141016f, 0.15038839f},
-std::array<float,2>{0.296898752f, 0.656905293f},
-std::array<float,2>{0.646015108f, 0.863804996f},
-std::array<float,2>{0.0551481433f, 0.323321253f},
-std::array<float,2>{0.848604798f, 0.391102254f},
-std::array<float,2>{0.497139424f, 0.899555564f},
-std::array<float,2>{0.616268337f, 0.573555171f},
-std::array<float,2>{0.224500939f, 0.0995842069f},
-std::array<float,2>{0.629316926f, 0.166181192f},
-std::array<float,2>{0.0359018371f, 0.655315042f},
-std::array<float,2>{0.917954087f, 0.826226056f},
-std::array<float,2>{0.283074141f, 0.371684819f},
-std::array<float,2>{0.517851889f, 0.293060273f},
-std::array<float,2>{0.140600026f, 0.805261433f},
-std::array<float,2>{0.776541829f, 0.72349143f},
-std::array<float,2>{0.376857191f, 0.237412632f},
-std::array<float,2>{0.945193768f, 0.0519141629f},
-std::array<float,2>{0.329808742f, 0.546189547f},
-std::array<float,2>{0.699648559f, 0.976333976f},
-std::array<float,2>{0.0794172138f, 0.447865337f},
-std::array<float,2>{0.89551574f, 0.330773354f},
-std::array<float,2>{0.27198711f, 0.844525754f},
-std::array<float,2>{0.687205791f, 0.672155201f},
-std::array<float,2>{0.00238435389f, 0.136441633f},
-std::array<float,2>{0.570064962f, 0.0653034449f},
-std::array<float,2>{0.196278393f, 0.618191719f},
-std::array<float,2>{0.825043619f, 0.93122834f},
-std::array<float,2>{0.46014595f, 0.420226812f},
-std::array<float,2>{0.733742177f, 0.492047608f},
-std::array<float,2>{0.124814957f, 0.963626087f},
-std::array<float,2>{0.983666778f, 0.513825893f},
-std::array<float,2>{0.35391885f, 0.025906194f},
-std::array<float,2>{0.785480261f, 0.192784652f},
-std::array<float,2>{0.424697429f, 0.706311226f},
-std::array<float,2>{0.553634405f, 0.762552381f},
-std::array<float,2>{0.16325064f, 0.267119944f},
-std::array<float,2>{0.908236146f, 0.407107651f},
-std::array<float,2>{0.291634083f, 0.925962865f},
-std::array<float,2>{0.63402164f, 0.613241255f},
-std::array<float,2>{0.0397596769f, 0.0725597516f},
-std::array<float,2>{0.617513835f, 0.12677674f},
-std::array<float,2>{0.228458121f, 0.685756505f},
-std::array<float,2>{0.853549778f, 0.855012059f},
-std::array<float,2>{0.488710761f, 0.342169404f},
-std::array<float,2>{0.689779043f, 0.276640832f},
-std::array<float,2>{0.0862341151f, 0.754559278f},
-std::array<float,2>{0.947081745f, 0.713732481f},
-std::array<float,2>{0.343401581f, 0.201260969f},
-std::array<float,2>{0.770003676f, 0.0215393528f},
-std::array<float,2>{0.386649847f, 0.500332534f},
-std::array<float,2>{0.531206429f, 0.954185605f},
-std::array<float,2>{0.132053018f, 0.497649312f},
-std::array<float,2>{0.812872291f, 0.366891682f},
-std::array<float,2>{0.465289056f, 0.817381382f},
-std::array<float,2>{0.576313257f, 0.646293759f},
-std::array<float,2>{0.193417013f, 0.162411526f},
-std::array<float,2>{0.672122777f, 0.106333315f},
-std::array<float,2>{0.00859915186f, 0.56874001f},
-std::array<float,2>{0.903691173f, 0.897671223f},
-std::array<float,2>{0.275140047f, 0.405434668f},
-std::array<float,2>{0.554846346f, 0.443654776f},
-std::array<float,2>{0.171723247f, 0.984164596f},
-std::array<float,2>{0.795234084f, 0.53265667f},
-std::array<float,2>{0.435795367f, 0.0552618876f},
-std::array<float,2>{0.972341001f, 0.247164994f},
-std::array<float,2>{0.34617728f, 0.728950143f},
-std::array<float,2>{0.723510504f, 0.798006058f},
-std::array<float,2>{0.111900695f, 0.288404942f},
-std::array<float,2>{0.799633741f, 0.471736848f},
-std::array<float,2>{0.416099995f, 0.94183898f},
-std::array<float,2>{0.531525433f, 0.517319083f},
-std::array<float,2>{0.185731411f, 0.0156139629f},
-std::array<float,2>{0.741728246f, 0.208846971f},
-std::array<float,2>{0.101562142f, 0.696635067f},
-std::array<float,2>{0.987161696f, 0.778841197f},
-std::array<float,2>{0.373694301f, 0.260044158f},
-std::array<float,2>{0.588925481f, 0.314095199f},
-std::array<float,2>{0.20532313f, 0.872208714f},
-std::array<float,2>{0.83638972f, 0.664510071f},
-std::array<float,2>{0.450873166f, 0.141813621f},
-std::array<float,2>{0.875635564f, 0.0810088292f},
-std::array<float,2>{0.264928758f, 0.595053494f},
-std::array<float,2>{0.665035248f, 0.917562544f},
-std::array<float,2>{0.0171252582f, 0.428760856f},
-std::array<float,2>{0.955990672f, 0.29934302f},
-std::array<float,2>{0.324261397f, 0.782685399f},
-std::array<float,2>{0.706724703f, 0.749854922f},
-std::array<float,2>{0.0759117156f, 0.226861805f},
-std::array<float,2>{0.512213111f, 0.0429687016f},
-std::array<float,2>{0.147735715f, 0.547761619f},
-std::array<float,2>{0.755747914f, 0.995432794f},
-std::array<float,2>{0.398299128f, 0.468526125f},
-std::array<float,2>{0.651196122f, 0.387141466f},
-std::array<float,2>{0.0484401509f, 0.885555625f},
-std::array<float,2>{0.933523893f, 0.589040279f},
-std::array<float,2>{0.30955261f, 0.115208887f},
-std::array<float,2>{0.860957503f, 0.172940195f},
-std::array<float,2>{0.478790492f, 0.625502408f},
-std::array<float,2>{0.593845606f, 0.832339764f},
-std::array<float,2>{0.239962474f, 0.349819332f},
-std::array<float,2>{0.972982347f, 0.433756709f},
-std::array<float,2>{0.348561138f, 0.907676041f},
-std::array<float,2>{0.720464766f, 0.607137918f},
-std::array<float,2>{0.115051448f, 0.0905390307f},
-std::array<float,2>{0.559526265f, 0.153438672f},
-std::array<float,2>{0.165073514f, 0.662560105f},
-std::array<float,2>{0.792591512f, 0.86245954f},
-std::array<float,2>{0.43332234f, 0.325536489f},
-std::array<float,2>{0.677939713f, 0.25278455f},
-std::array<float,2>{0.0132143674f, 0.772848368f},
-std::array<float,2>{0.900846958f, 0.692207038f},
-std::array<float,2>{0.281138241f, 0.218088835f},
-std::array<float,2>{0.819919527f, 0.00545541523f},
-std::array<float,2>{0.46427694f, 0.524192631f},
-std::array<float,2>{0.570492864f, 0.952010155f},
-std::array<float,2>{0.187598556f, 0.483581483f},
-std::array<float,2>{0.767028451f, 0.356815279f},
-std::array<float,2>{0.386969835f, 0.836900055f},
-std::array<float,2>{0.523771942f, 0.638231754f},
-std::array<float,2>{0.126340523f, 0.180924684f},
-std::array<float,2>{0.695133567f, 0.121801421f},
-std::array<float,2>{0.0934706852f, 0.578724563f},
-std::array<float,2>{0.951389074f, 0.882561326f},
-std::array<float,2>{0.338264257f, 0.381582886f},
-std::array<float,2>{0.623554468f, 0.460505873f},
-std::array<float,2>{0.232726485f, 0.989503801f},
-std::array<float,2>{0.856436431f, 0.555576503f},
-std::array<float,2>{0.486957371f, 0.0377286077f},
-std::array<float,2>{0.912795603f, 0.218832627f},
-std::array<float,2>{0.293956101f, 0.738945782f},
-std::array<float,2>{0.637208223f, 0.792024076f},
-std::array<float,2>{0.0440423936f, 0.307094216f},
-std::array<float,2>{0.864421785f, 0.484936267f},
-std::array<float,2>{0.483865261f, 0.966084063f},
-std::array<float,2>{0.599551857f, 0.509797752f},
-std::array<float,2>{0.236652747f, 0.0309031084f},
-std::array<float,2>{0.654302835f, 0.189042658f},
-std::array<float,2>{0.0520566851f, 0.710264802f},
-std::array<float,2>{0.934402645f, 0.759834707f},
-std::array<float,2>{0.307483524f, 0.272395164f},
-std::array<float,2>{0.508189201f, 0.335398108f},
-std::array<float,2>{0.141964391f, 0.848476112f},
-std::array<float,2>{0.75281471f, 0.678215325f},
-std::array<float,2>{0.392426759f, 0.137021855f},
-std::array<float,2>{0.958261847f, 0.0680714771f},
-std::array<float,2>{0.32366851f, 0.621177673f},
-std::array<float,2>{0.710078061f, 0.936460257f},
-std::array<float,2>{0.0715211928f, 0.41606763f},
-std::array<float,2>{0.881927848f, 0.291704774f},
-std::array<float,2>{0.259729207f, 0.808759749f},
-std::array<float,2>{0.668882012f, 0.721713483f},
-std::array<float,2>{0.0199830867f, 0.239756957f},
-std::array<float,2>{0.590631306f, 0.0495646484f},
-std::array<float,2>{0.20891495f, 0.540408492f},
-std::array<float,2>{0.843665302f, 0.971966386f},
-std::array<float,2>{0.448299617f, 0.452611804f},
-std::array<float,2>{0.736120403f, 0.397555649f},
-std::array<float,2>{0.0957526043f, 0.904173434f},
-std::array<float,2>{0.99199456f, 0.577009201f},
-std::array<float,2>{0.368369281f, 0.0969805047f},
-std::array<float,2>{0.803566515f, 0.17164962f},
-std::array<float,2>{0.421544254f, 0.650034726f},
-std::array<float,2>{0.537010252f, 0.823206306f},
-std::array<float,2>{0.179942697f, 0.368590057f},
-std::array<float,2>{0.926142097f, 0.439842403f},
-std::array<float,2>{0.303394347f, 0.977677703f},
-std::array<float,2>{0.6409235f, 0.538724184f},
-std::array<float,2>{0.06122794f, 0.0613395572f},
-std::array<float,2>{0.605495095f, 0.244585291f},
-std::array<float,2>{0.246396109f, 0.730596483f},
-std::array<float,2>{0.874314725f, 0.802669346f},
-std::array<float,2>{0.47274211f, 0.281893611f},
-std::array<float,2>{0.711494565f, 0.360552281f},
-std::array<float,2>{0.0656734481f, 0.813334763f},
-std::array<float,2>{0.961953104f, 0.641544282f},
-std::array<float,2>{0.316090226f, 0.159145758f},
-std::array<float,2>{0.762086749f, 0.104015067f},
-std::array<float,2>{0.405959696f, 0.565158486f},
-std::array<float,2>{0.506895125f, 0.891939402f},
-std::array<float,2>{0.152229711f, 0.3986606f},
-std::array<float,2>{0.833241343f, 0.280463517f},
-std::array<float,2>{0.438050538f, 0.751427293f},
-std::array<float,2>{0.581387103f, 0.717058182f},
-std::array<float,2>{0.218547702f, 0.196111202f},
-std::array<float,2>{0.657084405f, 0.015664259f},
-std::array<float,2>{0.0291166306f, 0.504901588f},
-std::array<float,2>{0.887114286f, 0.960077941f},
-std::array<float,2>{0.257112175f, 0.493454844f},
-std::array<float,2>{0.542277098f, 0.410369724f},
-std::array<float,2>{0.176600754f, 0.923638761f},
-std::array<float,2>{0.810283065f, 0.613643885f},
-std::array<float,2>{0.408050776f, 0.0779054984f},
-std::array<float,2>{0.996548474f, 0.132280633f},
-std::array<float,2>{0.36098811f, 0.681974709f},
-std::array<float,2>{0.749756455f, 0.858767807f},
-std::array<float,2>{0.107654169f, 0.336589426f},
-std::array<float,2>{0.784662902f, 0.384337991f},
-std::array<float,2>{0.428164214f, 0.890252531f},
-std::array<float,2>{0.548707962f, 0.59060806f},
-std::array<float,2>{0.157225832f, 0.110074162f},
-std::array<float,2>{0.728957534f, 0.176129729f},
-std::array<float,2>{0.118480675f, 0.631985366f},
-std::array<float,2>{0.977215528f, 0.830697238f},
-std::array<float,2>{0.358928502f, 0.345819801f},
-std::array<float,2>{0.563631237f, 0.303058743f},
-std::array<float,2>{0.202521861f, 0.787654936f},
-std::array<float,2>{0.824035108f, 0.744445503f},
-std::array<float,2>{0.45537883f, 0.234270409f},
-std::array<float,2>{0.891270399f, 0.0444653928f},
-std::array<float,2>{0.269067705f, 0.553286672f},
-std::array<float,2>{0.680025518f, 0.996632576f},
-std::array<float,2>{0.00613037683f, 0.464776725f},
-std::array<float,2>{0.940820575f, 0.318273515f},
-std::array<float,2>{0.333377123f, 0.870945454f},
-std::array<float,2>{0.698054135f, 0.669047415f},
-std::array<float,2>{0.0820492506f, 0.144764975f},
-std::array<float,2>{0.521359622f, 0.0846143216f},
-std::array<float,2>{0.133339763f, 0.598730683f},
-std::array<float,2>{0.780119479f, 0.921571732f},
-std::array<float,2>{0.381599963f, 0.423833042f},
-std::array<float,2>{0.625596344f, 0.474954933f},
-std::array<float,2>{0.0324135683f, 0.938014805f},
-std::array<float,2>{0.918583751f, 0.523189723f},
-std::array<float,2>{0.285503f, 0.0103586568f},
-std::array<float,2>{0.844593227f, 0.206399113f},
-std::array<float,2>{0.493080437f, 0.700751901f},
-std::array<float,2>{0.609766722f, 0.773849308f},
-std::array<float,2>{0.219878763f, 0.26270476f},
-std::array<float,2>{0.964945793f, 0.479492515f},
-std::array<float,2>{0.317205608f, 0.945583999f},
-std::array<float,2>{0.71700269f, 0.530416965f},
-std::array<float,2>{0.0669943169f, 0.00373661192f},
-std::array<float,2>{0.500885427f, 0.213726118f},
-std::array<float,2>{0.154492632f, 0.68994236f},
-std::array<float,2>{0.760983169f, 0.76822412f},
-std::array<float,2>{0.401404381f, 0.256900877f},
-std::array<float,2>{0.646859288f, 0.320359379f},
-std::array<float,2>{0.0580963828f, 0.866194367f},
-std::array<float,2>{0.923906207f, 0.659921348f},
-std::array<float,2>{0.299867988f, 0.152256206f},
-std::array<float,2>{0.868707836f, 0.0876266509f},
-std::array<float,2>{0.471177459f, 0.601746023f},
-std::array<float,2>{0.602970302f, 0.913870037f},
-std::array<float,2>{0.244952783f, 0.431092352f},
-std::array<float,2>{0.80813539f, 0.311376393f},
-std::array<float,2>{0.413734585f, 0.794706702f},
-std::array<float,2>{0.545669675f, 0.736695111f},
-std::array<float,2>{0.173287377f, 0.224412784f},
-std::array<float,2>{0.745111227f, 0.0317234434f},
-std::array<float,2>{0.104499377f, 0.55949384f},
-std::array<float,2>{0.994534552f, 0.984375298f},
-std::array<float,2>{0.364645422f, 0.453781635f},
-std::array<float,2>{0.582388222f, 0.376739621f},
-std::array<float,2>{0.211210266f, 0.875343263f},
-std::array<float,2>{0.831393063f, 0.582235396f},
-std::array<float,2>{0.443482637f, 0.119811527f},
-std::array<float,2>{0.884795249f, 0.187077656f},
-std::array<float,2>{0.252725869f, 0.633191943f},
-std::array<float,2>{0.660667241f, 0.842677057f},
-std::array<float,2>{0.0270032529f, 0.354031295f},
-std::array<float,2>{0.827212095f, 0.419564307f},
-std::array<float,2>{0.458530456f, 0.932652652f},
-std::array<float,2>{0.566998184f, 0.620595157f},
-std::array<float,2>{0.19863534f, 0.0638043135f},
-std::array<float,2>{0.683912039f, 0.133227184f},
-std::array<float,2>{0.00104558899f, 0.673890591f},
-std::array<float,2>{0.897133708f, 0.846626043f},
-std::array<float,2>{0.270682007f, 0.329733372f},
-std::array<float,2>{0.552491724f, 0.269286484f},
-std::array<float,2>{0.161813542f, 0.763789117f},
-std::array<float,2>{0.787545264f, 0.703709722f},
-std::array<float,2>{0.423015714f, 0.193731159f},
-std::array<float,2>{0.980527163f, 0.0237350948f},
-std::array<float,2>{0.352247685f, 0.512717485f},
-std::array<float,2>{0.732212126f, 0.961896181f},
-std::array<float,2>{0.122011542f, 0.489307851f},
-std::array<float,2>{0.915405929f, 0.373543948f},
-std::array<float,2>{0.284493625f, 0.82471168f},
-std::array<float,2>{0.631942809f, 0.65345341f},
-std::array<float,2>{0.0384963714f, 0.165432021f},
-std::array<float,2>{0.613537669f, 0.101108149f},
-std::array<float,2>{0.225225955f, 0.571065426f},
-std::array<float,2>{0.850095749f, 0.900677025f},
-std::array<float,2>{0.498117179f, 0.394016713f},
-std::array<float,2>{0.701265037f, 0.445843041f},
-std::array<float,2>{0.0813813433f, 0.974290967f},
-std::array<float,2>{0.943337142f, 0.543653548f},
-std::array<float,2>{0.331200302f, 0.0531985424f},
-std::array<float,2>{0.775310576f, 0.234986395f},
-std::array<float,2>{0.377433985f, 0.725198686f},
-std::array<float,2>{0.516743302f, 0.806865811f},
-std::array<float,2>{0.137716264f, 0.296335429f},
-std::array<float,2>{0.906039119f, 0.402515173f},
-std::array<float,2>{0.276961803f, 0.894690931f},
-std::array<float,2>{0.67437923f, 0.567694008f},
-std::array<float,2>{0.00979799312f, 0.108400904f},
-std::array<float,2>{0.575524032f, 0.160424069f},
-std::array<float,2>{0.191767782f, 0.64782542f},
-std::array<float,2>{0.81640029f, 0.820134759f},
-std::array<float,2>{0.466988921f, 0.364509225f},
-std::array<float,2>{0.725709677f, 0.286320686f},
-std::array<float,2>{0.110289328f, 0.800110102f},
-std::array<float,2>{0.969317913f, 0.727131128f},
-std::array<float,2>{0.344889373f, 0.249898136f},
-std::array<float,2>{0.794555366f, 0.0583509542f},
-std::array<float,2>{0.433667719f, 0.533929169f},
-std::array<float,2>{0.557095826f, 0.980937302f},
-std::array<float,2>{0.168604389f, 0.442924589f},
-std::array<float,2>{0.852091551f, 0.340847999f},
-std::array<float,2>{0.490709126f, 0.852101624f},
-std::array<float,2>{0.619579732f, 0.684263468f},
-std::array<float,2>{0.22904174f, 0.127672985f},
-std::array<float,2>{0.63595587f, 0.0707556829f},
-std::array<float,2>{0.0414380394f, 0.610864878f},
-std::array<float,2>{0.907362521f, 0.928018212f},
-std::array<float,2>{0.290835232f, 0.408732027f},
-std::array<float,2>{0.527359068f, 0.499873459f},
-std::array<float,2>{0.129347742f, 0.956747413f},
-std::array<float,2>{0.773211777f, 0.503032744f},
-std::array<float,2>{0.383214265f, 0.020447908f},
-std::array<float,2>{0.948617637f, 0.20039922f},
-std::array<float,2>{0.340341538f, 0.712057948f},
-std::array<float,2>{0.688100576f, 0.757344663f},
-std::array<float,2>{0.088832289f, 0.274772823f},
-std::array<float,2>{0.757088542f, 0.465089142f},
-std::array<float,2>{0.395769805f, 0.993740439f},
-std::array<float,2>{0.515324116f, 0.549569845f},
-std::array<float,2>{0.146250054f, 0.0392456949f},
-std::array<float,2>{0.703325748f, 0.228735358f},
-std::array<float,2>{0.0774635151f, 0.747720659f},
-std::array<float,2>{0.954753637f, 0.783846617f},
-std::array<float,2>{0.326697975f, 0.298441052f},
-std::array<float,2>{0.595834911f, 0.347715408f},
-std::array<float,2>{0.241268039f, 0.83421129f},
-std::array<float,2>{0.861743629f, 0.627723932f},
-std::array<float,2>{0.478452325f, 0.174218163f},
-std::array<float,2>{0.931030571f, 0.11655511f},
-std::array<float,2>{0.311495274f, 0.586117804f},
-std::array<float,2>{0.649738073f, 0.882985413f},
-std::array<float,2>{0.0491329767f, 0.388996035f},
-std::array<float,2>{0.984376192f, 0.25808081f},
-std::array<float,2>{0.371812165f, 0.779947996f},
-std::array<float,2>{0.739257693f, 0.69758606f},
-std::array<float,2>{0.099252671f, 0.210129783f},
-std::array<float,2>{0.534935474f, 0.0123452945f},
-std::array<float,2>{0.185426921f, 0.517998993f},
-std::array<float,2>{0.798440576f, 0.943487585f},
-std::array<float,2>{0.414887011f, 0.469490975f},
-std::array<float,2>{0.667653203f, 0.427668184f},
-std::array<float,2>{0.0184207261f, 0.914341748f},
-std::array<float,2>{0.877700329f, 0.59626174f},
-std::array<float,2>{0.263651937f, 0.0799282789f},
-std::array<float,2>{0.839362323f, 0.144155249f},
-std::array<float,2>{0.45275405f, 0.66743958f},
-std::array<float,2>{0.585971177f, 0.873131454f},
-std::array<float,2>{0.20336169f, 0.316227347f},
-std::array<float,2>{0.968176901f, 0.430753469f},
-std::array<float,2>{0.319339961f, 0.913803875f},
-std::array<float,2>{0.716063559f, 0.602038562f},
-std::array<float,2>{0.0687237009f, 0.0877393708f},
-std::array<float,2>{0.50312227f, 0.151869461f},
-std::array<float,2>{0.153979421f, 0.659860373f},
-std::array<float,2>{0.75892669f, 0.865802765f},
-std::array<float,2>{0.399821967f, 0.320669711f},
-std::array<float,2>{0.644797564f, 0.257146776f},
-std::array<float,2>{0.0562689863f, 0.768385053f},
-std::array<float,2>{0.923267543f, 0.690314054f},
-std::array<float,2>{0.298202217f, 0.213394552f},
-std::array<float,2>{0.870788813f, 0.00359087274f},
-std::array<float,2>{0.470310122f, 0.530579031f},
-std::array<float,2>{0.604551792f, 0.945512712f},
-std::array<float,2>{0.242399275f, 0.479838729f},
-std::array<float,2>{0.806609631f, 0.354355484f},
-std::array<float,2>{0.411960661f, 0.842458725f},
-std::array<float,2>{0.543934107f, 0.633017719f},
-std::array<float,2>{0.17479372f, 0.187293723f},
-std::array<float,2>{0.743186891f, 0.119877405f},
-std::array<float,2>{0.103274353f, 0.582334518f},
-std::array<float,2>{0.993973196f, 0.875165701f},
-std::array<float,2>{0.365277022f, 0.376592755f},
-std::array<float,2>{0.585333407f, 0.453885585f},
-std::array<float,2>{0.214044064f, 0.984732985f},
-std::array<float,2>{0.828167319f, 0.559305131f},
-std::array<float,2>{0.442897797f, 0.0312726609f},
-std::array<float,2>{0.884411454f, 0.224284545f},
-std::array<float,2>{0.251876503f, 0.736453116f},
-std::array<float,2>{0.663585067f, 0.794670224f},
-std::array<float,2>{0.0241302103f, 0.311181068f},
-std::array<float,2>{0.825264454f, 0.489693075f},
-std::array<float,2>{0.459343553f, 0.96153295f},
-std::array<float,2>{0.569224358f, 0.512952983f},
-std::array<float,2>{0.197106481f, 0.0234601852f},
-std::array<float,2>{0.686400175f, 0.193511456f},
-std::array<float,2>{0.00353689538f, 0.704051077f},
-std::array<float,2>{0.894985557f, 0.763997078f},
-std::array<float,2>{0.273038715f, 0.269387901f},
-std::array<float,2>{0.554144561f, 0.329958707f},
-std::array<float,2>{0.162995294f, 0.846198916f},
-std::array<float,2>{0.786371052f, 0.674153149f},
-std::array<float,2>{0.425732315f, 0.133029714f},
-std::array<float,2>{0.983139157f, 0.0636147037f},
-std::array<float,2>{0.354611248f, 0.620199502f},
-std::array<float,2>{0.733149409f, 0.932893634f},
-std::array<float,2>{0.123504981f, 0.419865847f},
-std::array<float,2>{0.916090965f, 0.296104431f},
-std::array<float,2>{0.282135934f, 0.807085097f},
-std::array<float,2>{0.630621552f, 0.725370944f},
-std::array<float,2>{0.0365422666f, 0.235182375f},
-std::array<float,2>{0.615698278f, 0.0528893657f},
-std::array<float,2>{0.22315155f, 0.543889225f},
-std::array<float,2>{0.849083126f, 0.974386096f},
-std::array<float,2>{0.496575236f, 0.446160823f},
-std::array<float,2>{0.701004386f, 0.393699527f},
-std::array<float,2>{0.0782823563f, 0.900457859f},
-std::array<float,2>{0.943366289f, 0.57088697f},
-std::array<float,2>{0.328672022f, 0.10145732f},
-std::array<float,2>{0.776138723f, 0.1652558f},
-std::array<float,2>{0.375384301f, 0.653630614f},
-std::array<float,2>{0.519309103f, 0.825064361f},
-std::array<float,2>{0.13902621f, 0.373985827f},
-std::array<float,2>{0.903302729f, 0.443185389f},
-std::array<float,2>{0.273546517f, 0.980547309f},
-std::array<float,2>{0.673599601f, 0.533996165f},
-std::array<float,2>{0.00955776032f, 0.0583032928f},
-std::array<float,2>{0.577409089f, 0.249636501f},
-std::array<float,2>{0.194971696f, 0.727322519f},
-std::array<float,2>{0.813540757f, 0.799967051f},
-std::array<float,2>{0.466527462f, 0.286567569f},
-std::array<float,2>{0.724525094f, 0.364417851f},
-std::array<float,2>{0.112649575f, 0.819864869f},
-std::array<float,2>{0.970761776f, 0.64762938f},
-std::array<float,2>{0.346833855f, 0.160280794f},
-std::array<float,2>{0.796059787f, 0.108763039f},
-std::array<float,2>{0.436568946f, 0.567394435f},
-std::array<float,2>{0.556225538f, 0.894947231f},
-std::array<float,2>{0.170419842f, 0.402770877f},
-std::array<float,2>{0.85531193f, 0.274633914f},
-std::array<float,2>{0.489797533f, 0.757679284f},
-std::array<float,2>{0.618550599f, 0.712380648f},
-std::array<float,2>{0.226737931f, 0.200657502f},
-std::array<float,2>{0.633716524f, 0.0200206619f},
-std::array<float,2>{0.0408611633f, 0.50334686f},
-std::array<float,2>{0.909909308f, 0.957027614f},
-std::array<float,2>{0.292240977f, 0.499565244f},
-std::array<float,2>{0.529395342f, 0.409145713f},
-std::array<float,2>{0.131231487f, 0.927816749f},
-std::array<float,2>{0.770725369f, 0.611171007f},
-std::array<float,2>{0.385152459f, 0.0705104843f},
-std::array<float,2>{0.945625663f, 0.127892181f},
-std::array<float,2>{0.34212938f, 0.684504688f},
-std::array<float,2>{0.691330075f, 0.852462232f},
-std::array<float,2>{0.0871664062f, 0.341171116f},
-std::array<float,2>{0.754279792f, 0.388687462f},
-std::array<float,2>{0.396655768f, 0.883141398f},
-std::array<float,2>{0.513594985f, 0.5862661f},
-std::array<float,2>{0.146621019f, 0.11634969f},
-std::array<float,2>{0.705663979f, 0.173882335f},
-std::array<float,2>{0.0746969208f, 0.627655447f},
-std::array<float,2>{0.956571102f, 0.83442992f},
-std::array<float,2>{0.325672507f, 0.348127902f},
-std::array<float,2>{0.594821334f, 0.298827738f},
-std::array<float,2>{0.23877871f, 0.784103155f},
-std::array<float,2>{0.859956503f, 0.747968018f},
-std::array<float,2>{0.479750395f, 0.228962258f},
-std::array<float,2>{0.931994617f, 0.0393530056f},
-std::array<float,2>{0.30978933f, 0.549520552f},
-std::array<float,2>{0.651916862f, 0.994118869f},
-std::array<float,2>{0.0475631356f, 0.464934349f},
-std::array<float,2>{0.987549603f, 0.316013038f},
-std::array<float,2>{0.374451488f, 0.873517156f},
-std::array<float,2>{0.740401983f, 0.66715157f},
-std::array<float,2>{0.100200444f, 0.144293651f},
-std::array<float,2>{0.532678306f, 0.0797288045f},
-std::array<float,2>{0.186854348f, 0.596481025f},
-std::array<float,2>{0.800679862f, 0.914157867f},
-std::array<float,2>{0.417340666f, 0.427393496f},
-std::array<float,2>{0.665159166f, 0.469273508f},
-std::array<float,2>{0.0159077793f, 0.94361937f},
-std::array<float,2>{0.87604934f, 0.517809391f},
-std::array<float,2>{0.263965607f, 0.0126294009f},
-std::array<float,2>{0.83759135f, 0.210447609f},
-std::array<float,2>{0.450061202f, 0.697275221f},
-std::array<float,2>{0.587941408f, 0.780181408f},
-std::array<float,2>{0.206146941f, 0.257975191f},
-std::array<float,2>{0.975390315f, 0.48378247f},
-std::array<float,2>{0.35109517f, 0.951815903f},
-std::array<float,2>{0.720975041f, 0.524135888f},
-std::array<float,2>{0.116995864f, 0.00585163478f},
-std::array<float,2>{0.560806632f, 0.217925563f},
-std::array<float,2>{0.16644001f, 0.691991985f},
-std::array<float,2>{0.790694833f, 0.772503257f},
-std::array<float,2>{0.430507183f, 0.252538323f},
-std::array<float,2>{0.676647663f, 0.325301081f},
-std::array<float,2>{0.0155513231f, 0.862618685f},
-std::array<float,2>{0.900383472f, 0.662292719f},
-std::array<float,2>{0.278570861f, 0.153703794f},
-std::array<float,2>{0.817480028f, 0.0907051116f},
-std::array<float,2>{0.462047845f, 0.607273459f},
-std::array<float,2>{0.573824346f, 0.907242715f},
-std::array<float,2>{0.191268235f, 0.433915555f},
-std::array<float,2>{0.768300354f, 0.306686133f},
-std::array<float,2>{0.390153974f, 0.792394519f},
-std::array<float,2>{0.525535047f, 0.739100814f},
-std::array<float,2>{0.127720118f, 0.21919021f},
-std::array<float,2>{0.691689551f, 0.0380135141f},
-std::array<float,2>{0.0906355008f, 0.555340648f},
-std::array<float,2>{0.950620532f, 0.989463747f},
-std::array<float,2>{0.337146342f, 0.460841864f},
-std::array<float,2>{0.62130022f, 0.381592989f},
-std::array<float,2>{0.23233369f, 0.88280493f},
-std::array<float,2>{0.858585298f, 0.579086602f},
-std::array<float,2>{0.485167116f, 0.122035287f},
-std::array<float,2>{0.91038543f, 0.180709541f},
-std::array<float,2>{0.295528919f, 0.638619959f},
-std::array<float,2>{0.640366971f, 0.836489975f},
-std::array<float,2>{0.0463538915f, 0.356462717f},
-std::array<float,2>{0.865924597f, 0.416462928f},
-std::array<float,2>{0.480994016f, 0.936077297f},
-std::array<float,2>{0.600485682f, 0.621486783f},
-std::array<float,2>{0.236167416f, 0.0682428256f},
-std::array<float,2>{0.653751373f, 0.136890143f},
-std::array<float,2>{0.0537578017f, 0.677916229f},
-std::array<float,2>{0.936974227f, 0.848190486f},
-std::array<float,2>{0.305217385f, 0.335033834f},
-std::array<float,2>{0.511234522f, 0.271989137f},
-std::array<float,2>{0.143705457f, 0.760100305f},
-std::array<float,2>{0.750703931f, 0.710026801f},
-std::array<float,2>{0.392614871f, 0.189233378f},
-std::array<float,2>{0.960724771f, 0.0311612878f},
-std::array<float,2>{0.320626438f, 0.510252655f},
-std::array<float,2>{0.707087576f, 0.966021419f},
-std::array<float,2>{0.0733746141f, 0.485225707f},
-std::array<float,2>{0.879303634f, 0.368181527f},
-std::array<float,2>{0.260856837f, 0.822897971f},
-std::array<float,2>{0.670680523f, 0.650338173f},
-std::array<float,2>{0.0217671134f, 0.171515137f},
-std::array<float,2>{0.591867447f, 0.0968192294f},
-std::array<float,2>{0.2094246f, 0.576782048f},
-std::array<float,2>{0.8404423f, 0.903974533f},
-std::array<float,2>{0.445938826f, 0.397749871f},
-std::array<float,2>{0.73740077f, 0.452189445f},
-std::array<float,2>{0.0939665735f, 0.971712947f},
-std::array<float,2>{0.988729894f, 0.540049255f},
-std::array<float,2>{0.369417906f, 0.0495365784f},
-std::array<float,2>{0.801603436f, 0.24004668f},
-std::array<float,2>{0.418378353f, 0.722147644f},
-std::array<float,2>{0.538836956f, 0.808860302f},
-std::array<float,2>{0.183007076f, 0.291906595f},
-std::array<float,2>{0.928432703f, 0.398701966f},
-std::array<float,2>{0.302667588f, 0.891709983f},
-std::array<float,2>{0.643620014f, 0.565377176f},
-std::array<float,2>{0.0594604276f, 0.104312107f},
-std::array<float,2>{0.609150112f, 0.158756956f},
-std::array<float,2>{0.249051526f, 0.641340554f},
-std::array<float,2>{0.871689677f, 0.813223124f},
-std::array<float,2>{0.474789113f, 0.360750884f},
-std::array<float,2>{0.712948263f, 0.282189846f},
-std::array<float,2>{0.0636953339f, 0.802282751f},
-std::array<float,2>{0.963491142f, 0.730943978f},
-std::array<float,2>{0.314274341f, 0.244163975f},
-std::array<float,2>{0.764197946f, 0.0612120554f},
-std::array<float,2>{0.403912514f, 0.538977146f},
-std::array<float,2>{0.505017698f, 0.977814078f},
-std::array<float,2>{0.149161205f, 0.439668298f},
-std::array<float,2>{0.834644735f, 0.336713582f},
-std::array<float,2>{0.439905167f, 0.858558118f},
-std::array<float,2>{0.578971744f, 0.681867838f},
-std::array<float,2>{0.214974821f, 0.132056475f},
-std::array<float,2>{0.659168422f, 0.0778570399f},
-std::array<float,2>{0.0310132932f, 0.613379061f},
-std::array<float,2>{0.889371634f, 0.923510671f},
-std::array<float,2>{0.254623413f, 0.410643041f},
-std::array<float,2>{0.539156079f, 0.493252426f},
-std::array<float,2>{0.179318503f, 0.960393846f},
-std::array<float,2>{0.810911357f, 0.505190969f},
-std::array<float,2>{0.409978688f, 0.0159746017f},
-std::array<float,2>{0.998155892f, 0.195928708f},
-std::array<float,2>{0.362963915f, 0.71690625f},
-std::array<float,2>{0.747226417f, 0.751113653f},
-std::array<float,2>{0.106410675f, 0.280692488f},
-std::array<float,2>{0.782487035f, 0.464505494f},
-std::array<float,2>{0.427515715f, 0.99705708f},
-std::array<float,2>{0.550769091f, 0.553629041f},
-std::array<float,2>{0.158289865f, 0.0446846001f},
-std::array<float,2>{0.728039801f, 0.234045938f},
-std::array<float,2>{0.119303294f, 0.744348884f},
-std::array<float,2>{0.978956103f, 0.788039088f},
-std::array<float,2>{0.357180953f, 0.302933961f},
-std::array<float,2>{0.565016747f, 0.346080393f},
-std::array<float,2>{0.20116815f, 0.830921113f},
-std::array<float,2>{0.821880043f, 0.632245481f},
-std::array<float,2>{0.45322302f, 0.175799325f},
-std::array<float,2>{0.89340651f, 0.110167809f},
-std::array<float,2>{0.265816718f, 0.590511203f},
-std::array<float,2>{0.682417691f, 0.89056927f},
-std::array<float,2>{0.00464688567f, 0.384743601f},
-std::array<float,2>{0.938672721f, 0.262983441f},
-std::array<float,2>{0.334945858f, 0.773585558f},
-std::array<float,2>{0.695840061f, 0.700957f},
-std::array<float,2>{0.0853601322f, 0.206285641f},
-std::array<float,2>{0.523323417f, 0.010661711f},
-std::array<float,2>{0.136054009f, 0.523326457f},
-std::array<float,2>{0.778884411f, 0.938296735f},
-std::array<float,2>{0.380479902f, 0.474685311f},
-std::array<float,2>{0.628586054f, 0.424192876f},
-std::array<float,2>{0.0339553393f, 0.921735585f},
-std::array<float,2>{0.919985116f, 0.599019885f},
-std::array<float,2>{0.288483053f, 0.084951736f},
-std::array<float,2>{0.846568942f, 0.144819468f},
-std::array<float,2>{0.495359689f, 0.669322729f},
-std::array<float,2>{0.612403035f, 0.870830417f},
-std::array<float,2>{0.222588316f, 0.31806156f},
-std::array<float,2>{0.995856762f, 0.377184063f},
-std::array<float,2>{0.364129812f, 0.877003431f},
-std::array<float,2>{0.745641291f, 0.584632576f},
-std::array<float,2>{0.103609972f, 0.118899882f},
-std::array<float,2>{0.545986772f, 0.184483916f},
-std::array<float,2>{0.172815099f, 0.63589555f},
-std::array<float,2>{0.807129502f, 0.839964926f},
-std::array<float,2>{0.41289261f, 0.353158116f},
-std::array<float,2>{0.661794662f, 0.309082568f},
-std::array<float,2>{0.0256094355f, 0.79682368f},
-std::array<float,2>{0.886701524f, 0.736255467f},
-std::array<float,2>{0.253655165f, 0.226211712f},
-std::array<float,2>{0.830147505f, 0.0339481123f},
-std::array<float,2>{0.444700301f, 0.56092912f},
-std::array<float,2>{0.583586097f, 0.986624062f},
-std::array<float,2>{0.212010056f, 0.456276327f},
-std::array<float,2>{0.759776652f, 0.323655456f},
-std::array<float,2>{0.400597006f, 0.864070296f},
-std::array<float,2>{0.501615763f, 0.657126784f},
-std::array<float,2>{0.156185672f, 0.150064215f},
-std::array<float,2>{0.718273878f, 0.0886793137f},
-std::array<float,2>{0.0680379495f, 0.603546381f},
-std::array<float,2>{0.966237485f, 0.91023761f},
-std::array<float,2>{0.317557961f, 0.432911158f},
-std::array<float,2>{0.60164988f, 0.476748973f},
-std::array<float,2>{0.245940328f, 0.947631478f},
-std::array<float,2>{0.867708087f, 0.528600812f},
-std::array<float,2>{0.472295314f, 0.00163499126f},
-std::array<float,2>{0.925226569f, 0.212254748f},
-std::array<float,2>{0.298886746f, 0.688151062f},
-std::array<float,2>{0.647661448f, 0.76627779f},
-std::array<float,2>{0.0569504797f, 0.255340815f},
-std::array<float,2>{0.851019025f, 0.448005855f},
-std::array<float,2>{0.499096096f, 0.976109445f},
-std::array<float,2>{0.614793837f, 0.546101987f},
-std::array<float,2>{0.226240709f, 0.0522046536f},
-std::array<float,2>{0.63116622f, 0.237557739f},
-std::array<float,2>{0.0372668952f, 0.72332716f},
-std::array<float,2>{0.914615095f, 0.805528879f},
-std::array<float,2>{0.283452272f, 0.293313295f},
-std::array<float,2>{0.516125083f, 0.371899992f},
-std::array<float,2>{0.137463152f, 0.826505184f},
-std::array<float,2>{0.773869753f, 0.655588865f},
-std::array<float,2>{0.378219664f, 0.166311994f},
-std::array<float,2>{0.942283094f, 0.0991226211f},
-std::array<float,2>{0.331040919f, 0.57341063f},
-std::array<float,2>{0.702299178f, 0.899865746f},
-std::array<float,2>{0.0801379159f, 0.390741676f},
-std::array<float,2>{0.898118973f, 0.267480254f},
-std::array<float,2>{0.269928575f, 0.762349427f},
-std::array<float,2>{0.684781075f, 0.70606488f},
-std::array<float,2>{0.000811588136f, 0.19239071f},
-std::array<float,2>{0.567895234f, 0.0262007415f},
-std::array<float,2>{0.197556153f, 0.51400876f},
-std::array<float,2>{0.826244891f, 0.96348983f},
-std::array<float,2>{0.457281142f, 0.491789907f},
-std::array<float,2>{0.731233478f, 0.420164853f},
-std::array<float,2>{0.122463018f, 0.931433022f},
-std::array<float,2>{0.981702447f, 0.618631124f},
-std::array<float,2>{0.352961332f, 0.0651333183f},
-std::array<float,2>{0.788666546f, 0.136486247f},
-std::array<float,2>{0.422390431f, 0.672015429f},
-std::array<float,2>{0.551234365f, 0.844442725f},
-std::array<float,2>{0.160716549f, 0.33085084f},
-std::array<float,2>{0.90658921f, 0.497982979f},
-std::array<float,2>{0.289672583f, 0.954455614f},
-std::array<float,2>{0.635242283f, 0.500242293f},
-std::array<float,2>{0.0423706099f, 0.0218101609f},
-std::array<float,2>{0.620886028f, 0.201475561f},
-std::array<float,2>{0.230003253f, 0.713600457f},
-std::array<float,2>{0.853431106f, 0.7548365f},
-std::array<float,2>{0.492111862f, 0.276508361f},
-std::array<float,2>{0.688520849f, 0.341834933f},
-std::array<float,2>{0.089620322f, 0.855336308f},
-std::array<float,2>{0.948030889f, 0.685799778f},
-std::array<float,2>{0.340825707f, 0.126622856f},
-std::array<float,2>{0.77201432f, 0.072506167f},
-std::array<float,2>{0.384375513f, 0.613002837f},
-std::array<float,2>{0.528615236f, 0.926115632f},
-std::array<float,2>{0.129950464f, 0.406967849f},
-std::array<float,2>{0.814880788f, 0.288123548f},
-std::array<float,2>{0.468067676f, 0.798320293f},
-std::array<float,2>{0.574311495f, 0.72874862f},
-std::array<float,2>{0.192414716f, 0.247516498f},
-std::array<float,2>{0.675222516f, 0.0555776097f},
-std::array<float,2>{0.0114476131f, 0.532457113f},
-std::array<float,2>{0.904914021f, 0.983904004f},
-std::array<float,2>{0.276230842f, 0.443420678f},
-std::array<float,2>{0.557912111f, 0.405585468f},
-std::array<float,2>{0.169378549f, 0.897878528f},
-std::array<float,2>{0.793444991f, 0.568538725f},
-std::array<float,2>{0.434830993f, 0.105977401f},
-std::array<float,2>{0.970301509f, 0.162245095f},
-std::array<float,2>{0.344500124f, 0.645999432f},
-std::array<float,2>{0.725058496f, 0.817096353f},
-std::array<float,2>{0.111206993f, 0.367114037f},
-std::array<float,2>{0.797531009f, 0.428981543f},
-std::array<float,2>{0.415788591f, 0.917785108f},
-std::array<float,2>{0.533232033f, 0.594915271f},
-std::array<float,2>{0.184259355f, 0.0807053372f},
-std::array<float,2>{0.739443123f, 0.141983286f},
-std::array<float,2>{0.0980220512f, 0.664099336f},
-std::array<float,2>{0.986259818f, 0.872544348f},
-std::array<float,2>{0.372717172f, 0.314325154f},
-std::array<float,2>{0.58721f, 0.25986585f},
-std::array<float,2>{0.205074877f, 0.779258668f},
-std::array<float,2>{0.838283122f, 0.696497679f},
-std::array<float,2>{0.451955944f, 0.208608717f},
-std::array<float,2>{0.878057659f, 0.0153180538f},
-std::array<float,2>{0.262438446f, 0.517448008f},
-std::array<float,2>{0.666747808f, 0.941505075f},
-std::array<float,2>{0.0185721759f, 0.472042352f},
-std::array<float,2>{0.953722954f, 0.350028098f},
-std::array<float,2>{0.327556014f, 0.83218497f},
-std::array<float,2>{0.704511762f, 0.625975966f},
-std::array<float,2>{0.0763384923f, 0.173178822f},
-std::array<float,2>{0.514202893f, 0.114749536f},
-std::array<float,2>{0.14488019f, 0.589208782f},
-std::array<float,2>{0.756629407f, 0.885468423f},
-std::array<float,2>{0.39539662f, 0.386795282f},
-std::array<float,2>{0.648898244f, 0.46842891f},
-std::array<float,2>{0.0501851402f, 0.995347619f},
-std::array<float,2>{0.93054992f, 0.547408462f},
-std::array<float,2>{0.311771601f, 0.0426235124f},
-std::array<float,2>{0.862567782f, 0.226718336f},
-std::array<float,2>{0.477424473f, 0.749713004f},
-std::array<float,2>{0.597503662f, 0.78236717f},
-std::array<float,2>{0.241131037f, 0.299615502f},
-std::array<float,2>{0.952861965f, 0.457116693f},
-std::array<float,2>{0.338889509f, 0.991798282f},
-std::array<float,2>{0.69362998f, 0.558433533f},
-std::array<float,2>{0.092535235f, 0.0367441513f},
-std::array<float,2>{0.524540305f, 0.220782191f},
-std::array<float,2>{0.125873506f, 0.742163837f},
-std::array<float,2>{0.765815139f, 0.790371895f},
-std::array<float,2>{0.388567388f, 0.305352718f},
-std::array<float,2>{0.638639808f, 0.358262092f},
-std::array<float,2>{0.0429983586f, 0.838556349f},
-std::array<float,2>{0.913402975f, 0.638788939f},
-std::array<float,2>{0.293721825f, 0.182914898f},
-std::array<float,2>{0.856939137f, 0.123154245f},
-std::array<float,2>{0.487971336f, 0.580450714f},
-std::array<float,2>{0.624128342f, 0.88081634f},
-std::array<float,2>{0.233501941f, 0.38020286f},
-std::array<float,2>{0.791539907f, 0.250739574f},
-std::array<float,2>{0.431944966f, 0.770002842f},
-std::array<float,2>{0.560505569f, 0.693926632f},
-std::array<float,2>{0.164064065f, 0.216009229f},
-std::array<float,2>{0.71940732f, 0.00774053484f},
-std::array<float,2>{0.114140905f, 0.52563864f},
-std::array<float,2>{0.974379838f, 0.949627161f},
-std::array<float,2>{0.349554062f, 0.481631637f},
-std::array<float,2>{0.57188797f, 0.43657887f},
-std::array<float,2>{0.189345077f, 0.908499539f},
-std::array<float,2>{0.818478763f, 0.608903885f},
-std::array<float,2>{0.463669479f, 0.0935855284f},
-std::array<float,2>{0.901630819f, 0.155052349f},
-std::array<float,2>{0.279341906f, 0.662022948f},
-std::array<float,2>{0.679321587f, 0.86109972f},
-std::array<float,2>{0.0125703327f, 0.327563077f},
-std::array<float,2>{0.842184365f, 0.396130383f},
-std::array<float,2>{0.447892129f, 0.905255973f},
-std::array<float,2>{0.591569543f, 0.574722826f},
-std::array<float,2>{0.207492709f, 0.0955517367f},
-std::array<float,2>{0.669626117f, 0.169765815f},
-std::array<float,2>{0.0212475304f, 0.650635779f},
-std::array<float,2>{0.881508887f, 0.822008133f},
-std::array<float,2>{0.257850736f, 0.369362414f},
-std::array<float,2>{0.535864949f, 0.290509045f},
-std::array<float,2>{0.181453317f, 0.812384367f},
-std::array<float,2>{0.803997278f, 0.719507754f},
-std::array<float,2>{0.419949859f, 0.241921782f},
-std::array<float,2>{0.990314662f, 0.0474376939f},
-std::array<float,2>{0.367421836f, 0.541537762f},
-std::array<float,2>{0.734544992f, 0.970217943f},
-std::array<float,2>{0.0972488746f, 0.450807005f},
-std::array<float,2>{0.935421407f, 0.33369118f},
-std::array<float,2>{0.308378458f, 0.84984386f},
-std::array<float,2>{0.655916154f, 0.676575124f},
-std::array<float,2>{0.0510900021f, 0.140367493f},
-std::array<float,2>{0.598580837f, 0.0692094415f},
-std::array<float,2>{0.238099396f, 0.623652935f},
-std::array<float,2>{0.864153624f, 0.934590936f},
-std::array<float,2>{0.482608169f, 0.415525258f},
-std::array<float,2>{0.709268272f, 0.488119751f},
-std::array<float,2>{0.0704741105f, 0.968210399f},
-std::array<float,2>{0.957823634f, 0.508298099f},
-std::array<float,2>{0.322603971f, 0.0281074587f},
-std::array<float,2>{0.753161669f, 0.190984279f},
-std::array<float,2>{0.390743047f, 0.70787257f},
-std::array<float,2>{0.509240925f, 0.758859813f},
-std::array<float,2>{0.141029179f, 0.269652575f},
-std::array<float,2>{0.888637424f, 0.413994938f},
-std::array<float,2>{0.256795824f, 0.924984813f},
-std::array<float,2>{0.65819943f, 0.616932034f},
-std::array<float,2>{0.0279923379f, 0.075915426f},
-std::array<float,2>{0.581009746f, 0.129334033f},
-std::array<float,2>{0.217328385f, 0.679953992f},
-std::array<float,2>{0.832849979f, 0.856769919f},
-std::array<float,2>{0.438965231f, 0.338267595f},
-std::array<float,2>{0.748224974f, 0.278240621f},
-std::array<float,2>{0.109091349f, 0.753234267f},
-std::array<float,2>{0.997783363f, 0.715514719f},
-std::array<float,2>{0.359891623f, 0.19894883f},
-std::array<float,2>{0.808612645f, 0.0195041634f},
-std::array<float,2>{0.406519711f, 0.506353199f},
-std::array<float,2>{0.541414201f, 0.957149982f},
-std::array<float,2>{0.177446961f, 0.494756311f},
-std::array<float,2>{0.873464048f, 0.362797469f},
-std::array<float,2>{0.473677784f, 0.814906359f},
-std::array<float,2>{0.606615603f, 0.643279314f},
-std::array<float,2>{0.247962609f, 0.157609567f},
-std::array<float,2>{0.641661167f, 0.102768034f},
-std::array<float,2>{0.0617163666f, 0.564234078f},
-std::array<float,2>{0.926948249f, 0.893809676f},
-std::array<float,2>{0.303948522f, 0.401912302f},
-std::array<float,2>{0.506467938f, 0.438065261f},
-std::array<float,2>{0.151348412f, 0.979777873f},
-std::array<float,2>{0.762873113f, 0.536547482f},
-std::array<float,2>{0.404298633f, 0.0597004779f},
-std::array<float,2>{0.961812854f, 0.243856907f},
-std::array<float,2>{0.315239519f, 0.733083665f},
-std::array<float,2>{0.711966038f, 0.804325819f},
-std::array<float,2>{0.0651276261f, 0.284160554f},
-std::array<float,2>{0.780538261f, 0.474021137f},
-std::array<float,2>{0.382026792f, 0.941118419f},
-std::array<float,2>{0.5202443f, 0.521266937f},
-std::array<float,2>{0.13379012f, 0.0083289193f},
-std::array<float,2>{0.698967516f, 0.204699367f},
-std::array<float,2>{0.0833080932f, 0.701596916f},
-std::array<float,2>{0.93999958f, 0.776091516f},
-std::array<float,2>{0.332743376f, 0.263689727f},
-std::array<float,2>{0.610666633f, 0.318892449f},
-std::array<float,2>{0.219555587f, 0.868037701f},
-std::array<float,2>{0.845423818f, 0.671124995f},
-std::array<float,2>{0.493399501f, 0.14764972f},
-std::array<float,2>{0.919416666f, 0.0821884274f},
-std::array<float,2>{0.286657184f, 0.60087204f},
-std::array<float,2>{0.626453638f, 0.918496251f},
-std::array<float,2>{0.0320465714f, 0.423081428f},
-std::array<float,2>{0.977687538f, 0.301053405f},
-std::array<float,2>{0.357544631f, 0.785784304f},
-std::array<float,2>{0.729568005f, 0.742368221f},
-std::array<float,2>{0.117907763f, 0.231052786f},
-std::array<float,2>{0.546953142f, 0.0458001345f},
-std::array<float,2>{0.157944366f, 0.551739037f},
-std::array<float,2>{0.783423364f, 0.999260068f},
-std::array<float,2>{0.428875268f, 0.461702049f},
-std::array<float,2>{0.680999875f, 0.385043591f},
-std::array<float,2>{0.00722821476f, 0.888128877f},
-std::array<float,2>{0.892171085f, 0.5936656f},
-std::array<float,2>{0.267741144f, 0.113201581f},
-std::array<float,2>{0.822514892f, 0.179041356f},
-std::array<float,2>{0.456485599f, 0.630423129f},
-std::array<float,2>{0.562692046f, 0.828336954f},
-std::array<float,2>{0.201857388f, 0.344114929f},
-std::array<float,2>{0.944428742f, 0.391770035f},
-std::array<float,2>{0.329544991f, 0.899004996f},
-std::array<float,2>{0.699979961f, 0.572430372f},
-std::array<float,2>{0.0799881816f, 0.0984855071f},
-std::array<float,2>{0.518262565f, 0.167040125f},
-std::array<float,2>{0.140083686f, 0.654640019f},
-std::array<float,2>{0.777060866f, 0.827390432f},
-std::array<float,2>{0.376105994f, 0.372900695f},
-std::array<float,2>{0.629573166f, 0.294885188f},
-std::array<float,2>{0.0356009156f, 0.805747807f},
-std::array<float,2>{0.917167068f, 0.723648131f},
-std::array<float,2>{0.282231212f, 0.237301245f},
-std::array<float,2>{0.847873509f, 0.0513413623f},
-std::array<float,2>{0.497741133f, 0.545773566f},
-std::array<float,2>{0.617022514f, 0.975223124f},
-std::array<float,2>{0.223796144f, 0.448887467f},
-std::array<float,2>{0.78602457f, 0.331550717f},
-std::array<float,2>{0.424028754f, 0.844903886f},
-std::array<float,2>{0.552880704f, 0.673594952f},
-std::array<float,2>{0.163933247f, 0.134945735f},
-std::array<float,2>{0.734361291f, 0.0658586547f},
-std::array<float,2>{0.124392778f, 0.617550492f},
-std::array<float,2>{0.984285533f, 0.930193007f},
-std::array<float,2>{0.354118556f, 0.420968682f},
-std::array<float,2>{0.569713891f, 0.491079926f},
-std::array<float,2>{0.195683673f, 0.964295745f},
-std::array<float,2>{0.82439965f, 0.515174747f},
-std::array<float,2>{0.460608393f, 0.0264035482f},
-std::array<float,2>{0.896333396f, 0.191799149f},
-std::array<float,2>{0.271892786f, 0.705312312f},
-std::array<float,2>{0.686776817f, 0.763119817f},
-std::array<float,2>{0.00246344064f, 0.265767604f},
-std::array<float,2>{0.830058098f, 0.455253422f},
-std::array<float,2>{0.441591173f, 0.98789686f},
-std::array<float,2>{0.584594727f, 0.562124312f},
-std::array<float,2>{0.213610828f, 0.0346421152f},
-std::array<float,2>{0.662145257f, 0.225243285f},
-std::array<float,2>{0.0250391848f, 0.735154808f},
-std::array<float,2>{0.883682966f, 0.795272887f},
-std::array<float,2>{0.250805855f, 0.310245842f},
-std::array<float,2>{0.544028044f, 0.352451861f},
-std::array<float,2>{0.175764054f, 0.841339052f},
-std::array<float,2>{0.805095434f, 0.635505319f},
-std::array<float,2>{0.41070506f, 0.184895054f},
-std::array<float,2>{0.992768347f, 0.117618605f},
-std::array<float,2>{0.366990954f, 0.585748136f},
-std::array<float,2>{0.742568135f, 0.878630519f},
-std::array<float,2>{0.101611108f, 0.377932101f},
-std::array<float,2>{0.922652304f, 0.253967464f},
-std::array<float,2>{0.297595829f, 0.766966343f},
-std::array<float,2>{0.645548344f, 0.689139843f},
-std::array<float,2>{0.0552418977f, 0.211784184f},
-std::array<float,2>{0.60386008f, 0.000794531661f},
-std::array<float,2>{0.243812695f, 0.528261304f},
-std::array<float,2>{0.869919062f, 0.948719978f},
-std::array<float,2>{0.469018012f, 0.478141218f},
-std::array<float,2>{0.71524924f, 0.431735516f},
-std::array<float,2>{0.0695381835f, 0.911168337f},
-std::array<float,2>{0.967305422f, 0.604563177f},
-std::array<float,2>{0.318415314f, 0.0896105617f},
-std::array<float,2>{0.757932782f, 0.149051219f},
-std::array<float,2>{0.398627102f, 0.657788396f},
-std::array<float,2>{0.502009511f, 0.865152836f},
-std::array<float,2>{0.15292263f, 0.322592258f},
-std::array<float,2>{0.875148714f, 0.471009552f},
-std::array<float,2>{0.265145183f, 0.942771375f},
-std::array<float,2>{0.664329648f, 0.516306996f},
-std::array<float,2>{0.0168114137f, 0.0141700422f},
-std::array<float,2>{0.589583933f, 0.207814306f},
-std::array<float,2>{0.20569475f, 0.695679247f},
-std::array<float,2>{0.836517513f, 0.778302789f},
-std::array<float,2>{0.450256824f, 0.261493504f},
-std::array<float,2>{0.741404116f, 0.313345343f},
-std::array<float,2>{0.100754708f, 0.871916413f},
-std::array<float,2>{0.986585557f, 0.665235877f},
-std::array<float,2>{0.373128146f, 0.140667647f},
-std::array<float,2>{0.798999727f, 0.081182085f},
-std::array<float,2>{0.416614443f, 0.593811691f},
-std::array<float,2>{0.532094836f, 0.916022539f},
-std::array<float,2>{0.186336994f, 0.428168923f},
-std::array<float,2>{0.860481739f, 0.300477386f},
-std::array<float,2>{0.479154587f, 0.781444311f},
-std::array<float,2>{0.594508708f, 0.748711228f},
-std::array<float,2>{0.239631504f, 0.228181884f},
-std::array<float,2>{0.650559068f, 0.0414229259f},
-std::array<float,2>{0.0483246371f, 0.548789084f},
-std::array<float,2>{0.933026731f, 0.994291008f},
-std::array<float,2>{0.308597535f, 0.467293561f},
-std::array<float,2>{0.512104928f, 0.388472706f},
-std::array<float,2>{0.148299143f, 0.886090696f},
-std::array<float,2>{0.755140722f, 0.588648915f},
-std::array<float,2>{0.397865415f, 0.11350143f},
-std::array<float,2>{0.955447435f, 0.172343373f},
-std::array<float,2>{0.324723125f, 0.62681973f},
-std::array<float,2>{0.706449032f, 0.833126962f},
-std::array<float,2>{0.0752529055f, 0.350963384f},
-std::array<float,2>{0.770492971f, 0.407512575f},
-std::array<float,2>{0.386154383f, 0.927378237f},
-std::array<float,2>{0.530317605f, 0.611653626f},
-std::array<float,2>{0.132663295f, 0.0736663342f},
-std::array<float,2>{0.690419793f, 0.125653699f},
-std::array<float,2>{0.0867880285f, 0.687011242f},
-std::array<float,2>{0.946330309f, 0.85366714f},
-std::array<float,2>{0.342873663f, 0.343216866f},
-std::array<float,2>{0.618002295f, 0.27558893f},
-std::array<float,2>{0.227956668f, 0.75492239f},
-std::array<float,2>{0.854295969f, 0.714789748f},
-std::array<float,2>{0.489146113f, 0.20237191f},
-std::array<float,2>{0.90890497f, 0.0229388848f},
-std::array<float,2>{0.291443735f, 0.501820445f},
-std::array<float,2>{0.634682238f, 0.953670144f},
-std::array<float,2>{0.0394797921f, 0.496190757f},
-std::array<float,2>{0.971927762f, 0.36573258f},
-std::array<float,2>{0.346437156f, 0.81812346f},
-std::array<float,2>{0.722994149f, 0.64495033f},
-std::array<float,2>{0.111582704f, 0.163377002f},
-std::array<float,2>{0.555353165f, 0.106532544f},
-std::array<float,2>{0.171147406f, 0.569376945f},
-std::array<float,2>{0.79579246f, 0.896724343f},
-std::array<float,2>{0.436263621f, 0.405156493f},
-std::array<float,2>{0.672525823f, 0.44502154f},
-std::array<float,2>{0.0080683222f, 0.983176887f},
-std::array<float,2>{0.904157341f, 0.531726778f},
-std::array<float,2>{0.274541944f, 0.0559064224f},
-std::array<float,2>{0.813185334f, 0.24690932f},
-std::array<float,2>{0.46574229f, 0.72997421f},
-std::array<float,2>{0.577094853f, 0.797352493f},
-std::array<float,2>{0.194178462f, 0.287512183f},
-std::array<float,2>{0.989562154f, 0.449669242f},
-std::array<float,2>{0.370173544f, 0.968952894f},
-std::array<float,2>{0.737163186f, 0.542400956f},
-std::array<float,2>{0.0956789926f, 0.0482025295f},
-std::array<float,2>{0.537897229f, 0.240863949f},
-std::array<float,2>{0.182322234f, 0.720481932f},
-std::array<float,2>{0.802136958f, 0.810883462f},
-std::array<float,2>{0.419834495f, 0.28976053f},
-std::array<float,2>{0.671104312f, 0.37053892f},
-std::array<float,2>{0.0228780694f, 0.820853889f},
-std::array<float,2>{0.880055606f, 0.651915371f},
-std::array<float,2>{0.26067099f, 0.168344349f},
-std::array<float,2>{0.841467202f, 0.0940700769f},
-std::array<float,2>{0.446578443f, 0.575706363f},
-std::array<float,2>{0.593383312f, 0.905332923f},
-std::array<float,2>{0.210439086f, 0.395012826f},
-std::array<float,2>{0.751478732f, 0.270889729f},
-std::array<float,2>{0.394110739f, 0.758688688f},
-std::array<float,2>{0.510086f, 0.708978117f},
-std::array<float,2>{0.143046364f, 0.189996853f},
-std::array<float,2>{0.70819056f, 0.0290328693f},
-std::array<float,2>{0.0728603899f, 0.509148121f},
-std::array<float,2>{0.95971626f, 0.967233539f},
-std::array<float,2>{0.321787983f, 0.486736596f},
-std::array<float,2>{0.601247072f, 0.414881706f},
-std::array<float,2>{0.234908581f, 0.934342623f},
-std::array<float,2>{0.866895854f, 0.624313653f},
-std::array<float,2>{0.481562018f, 0.0697566718f},
-std::array<float,2>{0.936406136f, 0.13947469f},
-std::array<float,2>{0.306264937f, 0.676858246f},
-std::array<float,2>{0.653297007f, 0.851175725f},
-std::array<float,2>{0.0527426898f, 0.332181782f},
-std::array<float,2>{0.857810378f, 0.379270464f},
-std::array<float,2>{0.485490561f, 0.879254818f},
-std::array<float,2>{0.622380853f, 0.58203119f},
-std::array<float,2>{0.230490908f, 0.124354817f},
-std::array<float,2>{0.639086187f, 0.182122216f},
-std::array<float,2>{0.0449509248f, 0.64035815f},
-std::array<float,2>{0.91177088f, 0.839329004f},
-std::array<float,2>{0.296338618f, 0.358756393f},
-std::array<float,2>{0.52663064f, 0.306398004f},
-std::array<float,2>{0.128106073f, 0.789428055f},
-std::array<float,2>{0.769458473f, 0.74075222f},
-std::array<float,2>{0.389177471f, 0.222255766f},
-std::array<float,2>{0.949521899f, 0.0356334485f},
-std::array<float,2>{0.335953385f, 0.556935966f},
-std::array<float,2>{0.692579508f, 0.990858316f},
-std::array<float,2>{0.0912905037f, 0.458009839f},
-std::array<float,2>{0.899378717f, 0.327071607f},
-std::array<float,2>{0.277968019f, 0.859883904f},
-std::array<float,2>{0.676864684f, 0.660442114f},
-std::array<float,2>{0.0141299982f, 0.155919477f},
-std::array<float,2>{0.572514653f, 0.0918234512f},
-std::array<float,2>{0.190177828f, 0.607752621f},
-std::array<float,2>{0.816534638f, 0.909405589f},
-std::array<float,2>{0.461472273f, 0.436179519f},
-std::array<float,2>{0.721695721f, 0.480566055f},
-std::array<float,2>{0.115493007f, 0.95057857f},
-std::array<float,2>{0.975938976f, 0.526401281f},
-std::array<float,2>{0.350159228f, 0.00627829833f},
-std::array<float,2>{0.789514303f, 0.215213865f},
-std::array<float,2>{0.431072742f, 0.694600701f},
-std::array<float,2>{0.561743796f, 0.770723283f},
-std::array<float,2>{0.167930886f, 0.251092732f},
-std::array<float,2>{0.921841979f, 0.422828019f},
-std::array<float,2>{0.287955344f, 0.919321954f},
-std::array<float,2>{0.627742648f, 0.599913418f},
-std::array<float,2>{0.0349653512f, 0.0834163204f},
-std::array<float,2>{0.611679256f, 0.146868482f},
-std::array<float,2>{0.221263036f, 0.670271754f},
-std::array<float,2>{0.84677732f, 0.868406236f},
-std::array<float,2>{0.494443715f, 0.319634795f},
-std::array<float,2>{0.697207689f, 0.265010208f},
-std::array<float,2>{0.0841818452f, 0.776945233f},
-std::array<float,2>{0.93757081f, 0.702339411f},
-std::array<float,2>{0.335127205f, 0.203640074f},
-std::array<float,2>{0.777484536f, 0.00914177112f},
-std::array<float,2>{0.379744679f, 0.520014286f},
-std::array<float,2>{0.522006214f, 0.939721584f},
-std::array<float,2>{0.135038897f, 0.473199546f},
-std::array<float,2>{0.820823312f, 0.345169485f},
-std::array<float,2>{0.455071121f, 0.829924405f},
-std::array<float,2>{0.565561473f, 0.629039347f},
-std::array<float,2>{0.20001258f, 0.177763894f},
-std::array<float,2>{0.68358463f, 0.111438707f},
-std::array<float,2>{0.00562648894f, 0.592415571f},
-std::array<float,2>{0.893892586f, 0.887477696f},
-std::array<float,2>{0.267340928f, 0.386355698f},
-std::array<float,2>{0.549411178f, 0.462875873f},
-std::array<float,2>{0.16004093f, 0.998261034f},
-std::array<float,2>{0.781481504f, 0.55248636f},
-std::array<float,2>{0.426176339f, 0.0465101823f},
-std::array<float,2>{0.979909658f, 0.231537923f},
-std::array<float,2>{0.355640888f, 0.743923903f},
-std::array<float,2>{0.727170587f, 0.786210358f},
-std::array<float,2>{0.120891422f, 0.301962614f},
-std::array<float,2>{0.812403619f, 0.495768398f},
-std::array<float,2>{0.408547074f, 0.958332658f},
-std::array<float,2>{0.540380597f, 0.507542431f},
-std::array<float,2>{0.178046331f, 0.0184137505f},
-std::array<float,2>{0.746713877f, 0.197481126f},
-std::array<float,2>{0.106837712f, 0.715940773f},
-std::array<float,2>{0.999358058f, 0.752073646f},
-std::array<float,2>{0.361664474f, 0.278665751f},
-std::array<float,2>{0.579177439f, 0.339280546f},
-std::array<float,2>{0.216531366f, 0.856009603f},
-std::array<float,2>{0.835202932f, 0.681179881f},
-std::array<float,2>{0.441200703f, 0.129954398f},
-std::array<float,2>{0.890216589f, 0.0749707744f},
-std::array<float,2>{0.255165488f, 0.615750194f},
-std::array<float,2>{0.659717798f, 0.924521208f},
-std::array<float,2>{0.0296983141f, 0.412574679f},
-std::array<float,2>{0.964368701f, 0.285016119f},
-std::array<float,2>{0.312843919f, 0.803156078f},
-std::array<float,2>{0.713989735f, 0.733750165f},
-std::array<float,2>{0.0634456202f, 0.242829397f},
-std::array<float,2>{0.504622519f, 0.0588278696f},
-std::array<float,2>{0.150175869f, 0.536031306f},
-std::array<float,2>{0.765005231f, 0.97931993f},
-std::array<float,2>{0.402883768f, 0.438792974f},
-std::array<float,2>{0.642592013f, 0.400631845f},
-std::array<float,2>{0.059803661f, 0.893187046f},
-std::array<float,2>{0.929165363f, 0.563108683f},
-std::array<float,2>{0.301549286f, 0.102508761f},
-std::array<float,2>{0.872686327f, 0.157072395f},
-std::array<float,2>{0.476240784f, 0.644114017f},
-std::array<float,2>{0.607842863f, 0.815915883f},
-std::array<float,2>{0.248644829f, 0.361736298f},
-std::array<float,2>{0.981125653f, 0.418169826f},
-std::array<float,2>{0.351734489f, 0.932306528f},
-std::array<float,2>{0.731794357f, 0.619303823f},
-std::array<float,2>{0.121128805f, 0.0629217252f},
-std::array<float,2>{0.552200913f, 0.133934543f},
-std::array<float,2>{0.161296099f, 0.674836636f},
-std::array<float,2>{0.78802973f, 0.847536683f},
-std::array<float,2>{0.423621863f, 0.328192025f},
-std::array<float,2>{0.684178352f, 0.268193334f},
-std::array<float,2>{0.0015960047f, 0.765395701f},
-std::array<float,2>{0.896509886f, 0.704485536f},
-std::array<float,2>{0.271244824f, 0.194797009f},
-std::array<float,2>{0.8278355f, 0.024947023f},
-std::array<float,2>{0.458381385f, 0.512692094f},
-std::array<float,2>{0.566881299f, 0.962530136f},
-std::array<float,2>{0.198783055f, 0.488328665f},
-std::array<float,2>{0.774447441f, 0.374879807f},
-std::array<float,2>{0.377475768f, 0.82593143f},
-std::array<float,2>{0.517212331f, 0.652437866f},
-std::array<float,2>{0.138456777f, 0.16485697f},
-std::array<float,2>{0.702036083f, 0.0999902561f},
-std::array<float,2>{0.0819253474f, 0.572085798f},
-std::array<float,2>{0.942421436f, 0.901417971f},
-std::array<float,2>{0.3317433f, 0.392702192f},
-std::array<float,2>{0.614146411f, 0.446319193f},
-std::array<float,2>{0.224622905f, 0.97363019f},
-std::array<float,2>{0.850200176f, 0.544760108f},
-std::array<float,2>{0.499023139f, 0.0545493141f},
-std::array<float,2>{0.915918767f, 0.236106515f},
-std::array<float,2>{0.284901172f, 0.725779891f},
-std::array<float,2>{0.632353008f, 0.807821155f},
-std::array<float,2>{0.0389095992f, 0.295743674f},
-std::array<float,2>{0.86833328f, 0.479012728f},
-std::array<float,2>{0.471491814f, 0.946635604f},
-std::array<float,2>{0.603321314f, 0.529666483f},
-std::array<float,2>{0.244405866f, 0.00271526468f},
-std::array<float,2>{0.647428691f, 0.213890746f},
-std::array<float,2>{0.0585745797f, 0.690576255f},
-std::array<float,2>{0.924655676f, 0.768813372f},
-std::array<float,2>{0.300589144f, 0.25588271f},
-std::array<float,2>{0.500104845f, 0.322036535f},
-std::array<float,2>{0.154993147f, 0.867167354f},
-std::array<float,2>{0.76142621f, 0.659098148f},
-std::array<float,2>{0.402123541f, 0.150788739f},
-std::array<float,2>{0.965510905f, 0.0861609355f},
-std::array<float,2>{0.316443712f, 0.602734625f},
-std::array<float,2>{0.717529833f, 0.912620366f},
-std::array<float,2>{0.0667585731f, 0.430364698f},
-std::array<float,2>{0.885598361f, 0.312019944f},
-std::array<float,2>{0.25241527f, 0.793397307f},
-std::array<float,2>{0.660522461f, 0.737417102f},
-std::array<float,2>{0.0264548492f, 0.222934261f},
-std::array<float,2>{0.582880735f, 0.0328433923f},
-std::array<float,2>{0.211659476f, 0.560276091f},
-std::array<float,2>{0.83169651f, 0.985891223f},
-std::array<float,2>{0.444196373f, 0.454206258f},
-std::array<float,2>{0.744412005f, 0.375081629f},
-std::array<float,2>{0.105271704f, 0.876316845f},
-std::array<float,2>{0.994879186f, 0.583356082f},
-std::array<float,2>{0.365224749f, 0.120518215f},
-std::array<float,2>{0.807679176f, 0.186379731f},
-std::array<float,2>{0.413266331f, 0.634225786f},
-std::array<float,2>{0.545409501f, 0.843706131f},
-std::array<float,2>{0.173597872f, 0.354917228f},
-std::array<float,2>{0.931234241f, 0.466626287f},
-std::array<float,2>{0.310926348f, 0.993116558f},
-std::array<float,2>{0.65002054f, 0.550244093f},
-std::array<float,2>{0.0495260432f, 0.0400718562f},
-std::array<float,2>{0.596581221f, 0.230005056f},
-std::array<float,2>{0.24183318f, 0.746190846f},
-std::array<float,2>{0.862109542f, 0.784329474f},
-std::array<float,2>{0.47761029f, 0.297716886f},
-std::array<float,2>{0.703939557f, 0.349395901f},
-std::array<float,2>{0.0778867379f, 0.83510536f},
-std::array<float,2>{0.954470158f, 0.628899455f},
-std::array<float,2>{0.326283902f, 0.1756998f},
-std::array<float,2>{0.757774949f, 0.115975983f},
-std::array<float,2>{0.396054924f, 0.587522328f},
-std::array<float,2>{0.514666677f, 0.88438189f},
-std::array<float,2>{0.145703763f, 0.389768064f},
-std::array<float,2>{0.839301348f, 0.259076208f},
-std::array<float,2>{0.452154517f, 0.781139612f},
-std::array<float,2>{0.586562335f, 0.69836086f},
-std::array<float,2>{0.204094976f, 0.209363699f},
-std::array<float,2>{0.667395175f, 0.013033282f},
-std::array<float,2>{0.0176832452f, 0.518995643f},
-std::array<float,2>{0.877306759f, 0.944663107f},
-std::array<float,2>{0.262799233f, 0.469911605f},
-std::array<float,2>{0.534605801f, 0.426756322f},
-std::array<float,2>{0.184697986f, 0.915208638f},
-std::array<float,2>{0.797888756f, 0.596728384f},
-std::array<float,2>{0.414309442f, 0.0789706111f},
-std::array<float,2>{0.984973729f, 0.142711908f},
-std::array<float,2>{0.371534854f, 0.666734815f},
-std::array<float,2>{0.738459885f, 0.874118567f},
-std::array<float,2>{0.0987345204f, 0.314906925f},
-std::array<float,2>{0.794345319f, 0.404164076f},
-std::array<float,2>{0.434557319f, 0.896071851f},
-std::array<float,2>{0.557434618f, 0.567241549f},
-std::array<float,2>{0.168372616f, 0.108154878f},
-std::array<float,2>{0.726364255f, 0.162019372f},
-std::array<float,2>{0.109410696f, 0.64715004f},
-std::array<float,2>{0.969075084f, 0.818796635f},
-std::array<float,2>{0.345657468f, 0.364169538f},
-std::array<float,2>{0.575722098f, 0.285568744f},
-std::array<float,2>{0.192272455f, 0.799332738f},
-std::array<float,2>{0.815723956f, 0.728004396f},
-std::array<float,2>{0.467555016f, 0.248592496f},
-std::array<float,2>{0.905614376f, 0.0569653101f},
-std::array<float,2>{0.276373297f, 0.534811974f},
-std::array<float,2>{0.673915088f, 0.981880188f},
-std::array<float,2>{0.010647933f, 0.442305654f},
-std::array<float,2>{0.949144781f, 0.340441912f},
-std::array<float,2>{0.339987546f, 0.85293901f},
-std::array<float,2>{0.687577605f, 0.684928536f},
-std::array<float,2>{0.0882462412f, 0.128146678f},
-std::array<float,2>{0.528087556f, 0.0716150925f},
-std::array<float,2>{0.129629716f, 0.609594345f},
-std::array<float,2>{0.772886097f, 0.928771555f},
-std::array<float,2>{0.383485377f, 0.409882605f},
-std::array<float,2>{0.636340857f, 0.498947799f},
-std::array<float,2>{0.0416850708f, 0.955711663f},
-std::array<float,2>{0.907998919f, 0.502073586f},
-std::array<float,2>{0.290176928f, 0.0213743094f},
-std::array<float,2>{0.851701498f, 0.200141698f},
-std::array<float,2>{0.491037637f, 0.711091816f},
-std::array<float,2>{0.619722366f, 0.756751001f},
-std::array<float,2>{0.228758112f, 0.273931533f},
-std::array<float,2>{0.958860934f, 0.485846817f},
-std::array<float,2>{0.324113488f, 0.965114653f},
-std::array<float,2>{0.710878313f, 0.51149857f},
-std::array<float,2>{0.0718692988f, 0.0300811436f},
-std::array<float,2>{0.508535862f, 0.187768146f},
-std::array<float,2>{0.142199576f, 0.709561288f},
-std::array<float,2>{0.752012253f, 0.76117003f},
-std::array<float,2>{0.391859263f, 0.272893727f},
-std::array<float,2>{0.655270934f, 0.334861457f},
-std::array<float,2>{0.0526700169f, 0.84915036f},
-std::array<float,2>{0.933678329f, 0.679325998f},
-std::array<float,2>{0.306744784f, 0.137830883f},
-std::array<float,2>{0.865230381f, 0.0670991763f},
-std::array<float,2>{0.484202325f, 0.622970402f},
-std::array<float,2>{0.598900914f, 0.936618447f},
-std::array<float,2>{0.237179384f, 0.417516291f},
-std::array<float,2>{0.802895188f, 0.292041838f},
-std::array<float,2>{0.421317041f, 0.809644938f},
-std::array<float,2>{0.536314011f, 0.72156471f},
-std::array<float,2>{0.180615962f, 0.238773018f},
-std::array<float,2>{0.735473514f, 0.0500594787f},
-std::array<float,2>{0.0964789614f, 0.539187789f},
-std::array<float,2>{0.991369307f, 0.971246004f},
-std::array<float,2>{0.369067639f, 0.451356024f},
-std::array<float,2>{0.590250373f, 0.396686256f},
-std::array<float,2>{0.208450794f, 0.902543604f},
-std::array<float,2>{0.843065202f, 0.578012884f},
-std::array<float,2>{0.449109256f, 0.0966036469f},
-std::array<float,2>{0.882480264f, 0.170816123f},
-std::array<float,2>{0.258789539f, 0.648507416f},
-std::array<float,2>{0.668251932f, 0.823420823f},
-std::array<float,2>{0.0201534517f, 0.367296845f},
-std::array<float,2>{0.819768012f, 0.435251653f},
-std::array<float,2>{0.464401156f, 0.906722486f},
-std::array<float,2>{0.570895374f, 0.606063962f},
-std::array<float,2>{0.188454658f, 0.0915131122f},
-std::array<float,2>{0.678404987f, 0.1532152f},
-std::array<float,2>{0.0128194774f, 0.663871169f},
-std::array<float,2>{0.901212156f, 0.861420274f},
-std::array<float,2>{0.280560046f, 0.324240267f},
-std::array<float,2>{0.559079885f, 0.253319174f},
-std::array<float,2>{0.165562302f, 0.772201121f},
-std::array<float,2>{0.792373121f, 0.693210959f},
-std::array<float,2>{0.432851523f, 0.217023358f},
-std::array<float,2>{0.973338366f, 0.00392635958f},
-std::array<float,2>{0.347758174f, 0.52481246f},
-std::array<float,2>{0.719887793f, 0.952512443f},
-std::array<float,2>{0.114515498f, 0.483343869f},
-std::array<float,2>{0.912411869f, 0.356442809f},
-std::array<float,2>{0.294494957f, 0.837674916f},
-std::array<float,2>{0.637206674f, 0.637141347f},
-std::array<float,2>{0.0446667485f, 0.179735601f},
-std::array<float,2>{0.623117924f, 0.12281993f},
-std::array<float,2>{0.233061478f, 0.579867601f},
-std::array<float,2>{0.855606675f, 0.88121891f},
-std::array<float,2>{0.486611813f, 0.382746965f},
-std::array<float,2>{0.694723845f, 0.45927f},
-std::array<float,2>{0.0930033699f, 0.988947809f},
-std::array<float,2>{0.951749325f, 0.556248128f},
-std::array<float,2>{0.338651031f, 0.0383842401f},
-std::array<float,2>{0.767205834f, 0.219729364f},
-std::array<float,2>{0.387448847f, 0.739973605f},
-std::array<float,2>{0.523953319f, 0.791513622f},
-std::array<float,2>{0.126548469f, 0.308282554f},
-std::array<float,2>{0.891040862f, 0.382915854f},
-std::array<float,2>{0.268726587f, 0.889637172f},
-std::array<float,2>{0.68045187f, 0.591208041f},
-std::array<float,2>{0.00652947463f, 0.11039564f},
-std::array<float,2>{0.564433932f, 0.177210465f},
-std::array<float,2>{0.202949986f, 0.631099641f},
-std::array<float,2>{0.823354185f, 0.83148706f},
-std::array<float,2>{0.455984026f, 0.347650588f},
-std::array<float,2>{0.729243755f, 0.304248601f},
-std::array<float,2>{0.1189254f, 0.788311541f},
-std::array<float,2>{0.976947308f, 0.745839655f},
-std::array<float,2>{0.358814806f, 0.232430011f},
-std::array<float,2>{0.784984767f, 0.0432302766f},
-std::array<float,2>{0.428512394f, 0.553951502f},
-std::array<float,2>{0.54818064f, 0.997383952f},
-std::array<float,2>{0.156311184f, 0.46305874f},
-std::array<float,2>{0.844107807f, 0.316908211f},
-std::array<float,2>{0.49228546f, 0.86957103f},
-std::array<float,2>{0.609932899f, 0.668148041f},
-std::array<float,2>{0.220566615f, 0.146300912f},
-std::array<float,2>{0.625352085f, 0.0854037255f},
-std::array<float,2>{0.0328604467f, 0.598143995f},
-std::array<float,2>{0.918412328f, 0.919964135f},
-std::array<float,2>{0.285711408f, 0.425184816f},
-std::array<float,2>{0.520974159f, 0.475836098f},
-std::array<float,2>{0.133250594f, 0.939089537f},
-std::array<float,2>{0.779569685f, 0.521819174f},
-std::array<float,2>{0.381336987f, 0.0110124359f},
-std::array<float,2>{0.941144824f, 0.205873102f},
-std::array<float,2>{0.333819598f, 0.699411094f},
-std::array<float,2>{0.69731456f, 0.77445811f},
-std::array<float,2>{0.0825373232f, 0.262683988f},
-std::array<float,2>{0.762634993f, 0.4411605f},
-std::array<float,2>{0.405403316f, 0.977227032f},
-std::array<float,2>{0.507544637f, 0.537843406f},
-std::array<float,2>{0.151502013f, 0.0623605438f},
-std::array<float,2>{0.711199522f, 0.245547846f},
-std::array<float,2>{0.0659575835f, 0.731844485f},
-std::array<float,2>{0.962740958f, 0.801064491f},
-std::array<float,2>{0.315763772f, 0.283191949f},
-std::array<float,2>{0.605959713f, 0.360300779f},
-std::array<float,2>{0.246841893f, 0.814021111f},
-std::array<float,2>{0.874748349f, 0.64208883f},
-std::array<float,2>{0.473195732f, 0.159475833f},
-std::array<float,2>{0.926686883f, 0.104668662f},
-std::array<float,2>{0.302848935f, 0.566239417f},
-std::array<float,2>{0.641118705f, 0.891591251f},
-std::array<float,2>{0.0606373139f, 0.399920613f},
-std::array<float,2>{0.996737421f, 0.279679894f},
-std::array<float,2>{0.360703796f, 0.750132978f},
-std::array<float,2>{0.749148488f, 0.718146563f},
-std::array<float,2>{0.108092301f, 0.196652979f},
-std::array<float,2>{0.542670906f, 0.0173022337f},
-std::array<float,2>{0.175888881f, 0.504496872f},
-std::array<float,2>{0.809770942f, 0.959540844f},
-std::array<float,2>{0.407231241f, 0.493104219f},
-std::array<float,2>{0.656274736f, 0.41182977f},
-std::array<float,2>{0.0286946446f, 0.922254443f},
-std::array<float,2>{0.887405992f, 0.614499331f},
-std::array<float,2>{0.257388502f, 0.076809302f},
-std::array<float,2>{0.833680868f, 0.131307989f},
-std::array<float,2>{0.437698036f, 0.683373928f},
-std::array<float,2>{0.581981719f, 0.857958078f},
-std::array<float,2>{0.218202755f, 0.337716937f},
-std::array<float,2>{0.946921945f, 0.409397006f},
-std::array<float,2>{0.343512833f, 0.929323256f},
-std::array<float,2>{0.689626694f, 0.609934866f},
-std::array<float,2>{0.0861487612f, 0.0717870072f},
-std::array<float,2>{0.530764282f, 0.128583521f},
-std::array<float,2>{0.132166788f, 0.685294271f},
-std::array<float,2>{0.769538939f, 0.853307366f},
-std::array<float,2>{0.386231899f, 0.339982361f},
-std::array<float,2>{0.634169638f, 0.27391836f},
-std::array<float,2>{0.0399653129f, 0.756036758f},
-std::array<float,2>{0.90867728f, 0.711476862f},
-std::array<float,2>{0.291966468f, 0.199367106f},
-std::array<float,2>{0.853764176f, 0.0209767167f},
-std::array<float,2>{0.488416404f, 0.502467453f},
-std::array<float,2>{0.617189884f, 0.95522815f},
-std::array<float,2>{0.22806786f, 0.498310804f},
-std::array<float,2>{0.795036376f, 0.363354266f},
-std::array<float,2>{0.435622215f, 0.819018722f},
-std::array<float,2>{0.555091023f, 0.646694958f},
-std::array<float,2>{0.171493977f, 0.161546558f},
-std::array<float,2>{0.723187745f, 0.107434444f},
-std::array<float,2>{0.112197816f, 0.566676676f},
-std::array<float,2>{0.972630501f, 0.89554292f},
-std::array<float,2>{0.345841259f, 0.403431147f},
-std::array<float,2>{0.576569915f, 0.441702366f},
-std::array<float,2>{0.193691105f, 0.982163727f},
-std::array<float,2>{0.812642336f, 0.53430903f},
-std::array<float,2>{0.465014666f, 0.0573129468f},
-std::array<float,2>{0.9033553f, 0.248458639f},
-std::array<float,2>{0.275297195f, 0.728118241f},
-std::array<float,2>{0.672077894f, 0.798912287f},
-std::array<float,2>{0.00838263892f, 0.285646111f},
-std::array<float,2>{0.835984945f, 0.470225215f},
-std::array<float,2>{0.451062769f, 0.945182681f},
-std::array<float,2>{0.58935076f, 0.519324541f},
-std::array<float,2>{0.205126271f, 0.0133234104f},
-std::array<float,2>{0.664640665f, 0.209709585f},
-std::array<float,2>{0.0175577179f, 0.699136078f},
-std::array<float,2>{0.875846148f, 0.780658782f},
-std::array<float,2>{0.264800549f, 0.259422421f},
-std::array<float,2>{0.531354725f, 0.315006673f},
-std::array<float,2>{0.186006114f, 0.874739051f},
-std::array<float,2>{0.799347639f, 0.666332901f},
-std::array<float,2>{0.416454345f, 0.143267259f},
-std::array<float,2>{0.986968577f, 0.0785394013f},
-std::array<float,2>{0.373871267f, 0.597288907f},
-std::array<float,2>{0.742148042f, 0.915544152f},
-std::array<float,2>{0.101167344f, 0.42588678f},
-std::array<float,2>{0.933345795f, 0.297310323f},
-std::array<float,2>{0.30911395f, 0.78509593f},
-std::array<float,2>{0.651101768f, 0.747003913f},
-std::array<float,2>{0.0485966727f, 0.229919463f},
-std::array<float,2>{0.594118893f, 0.0406703874f},
-std::array<float,2>{0.240223765f, 0.550563335f},
-std::array<float,2>{0.861240029f, 0.992458105f},
-std::array<float,2>{0.478643596f, 0.465975314f},
-std::array<float,2>{0.706812263f, 0.390318722f},
-std::array<float,2>{0.0760718435f, 0.884171844f},
-std::array<float,2>{0.955697834f, 0.587241173f},
-std::array<float,2>{0.324574083f, 0.115384609f},
-std::array<float,2>{0.755482793f, 0.174965218f},
-std::array<float,2>{0.398029745f, 0.62835443f},
-std::array<float,2>{0.512581468f, 0.835573614f},
-std::array<float,2>{0.147471592f, 0.348887086f},
-std::array<float,2>{0.883157253f, 0.454843432f},
-std::array<float,2>{0.250134617f, 0.985675216f},
-std::array<float,2>{0.662875295f, 0.559768081f},
-std::array<float,2>{0.0247573499f, 0.0323456973f},
-std::array<float,2>{0.584313512f, 0.223299921f},
-std::array<float,2>{0.213271424f, 0.738102734f},
-std::array<float,2>{0.829444945f, 0.793483377f},
-std::array<float,2>{0.442150056f, 0.311577708f},
-std::array<float,2>{0.7430619f, 0.355256826f},
-std::array<float,2>{0.102464311f, 0.843055785f},
-std::array<float,2>{0.992381692f, 0.634493113f},
-std::array<float,2>{0.366473049f, 0.185943261f},
-std::array<float,2>{0.805231571f, 0.120685831f},
-std::array<float,2>{0.41016531f, 0.583726227f},
-std::array<float,2>{0.544767737f, 0.876822531f},
-std::array<float,2>{0.175134763f, 0.375893652f},
-std::array<float,2>{0.869366586f, 0.256388128f},
-std::array<float,2>{0.469566256f, 0.769437015f},
-std::array<float,2>{0.604327381f, 0.691050649f},
-std::array<float,2>{0.243288919f, 0.214355946f},
-std::array<float,2>{0.646331668f, 0.00229088706f},
-std::array<float,2>{0.0548731647f, 0.530203044f},
-std::array<float,2>{0.921953917f, 0.947193801f},
-std::array<float,2>{0.29714492f, 0.478881329f},
-std::array<float,2>{0.50276351f, 0.430013269f},
-std::array<float,2>{0.152442262f, 0.912374854f},
-std::array<float,2>{0.758576632f, 0.603238463f},
-std::array<float,2>{0.399000287f, 0.086738877f},
-std::array<float,2>{0.967151046f, 0.151009083f},
-std::array<float,2>{0.319110841f, 0.658681154f},
-std::array<float,2>{0.715660512f, 0.866313338f},
-std::array<float,2>{0.0702639073f, 0.321312845f},
-std::array<float,2>{0.77683717f, 0.393223017f},
-std::array<float,2>{0.376559675f, 0.902147591f},
-std::array<float,2>{0.517752767f, 0.571632862f},
-std::array<float,2>{0.140269816f, 0.100271367f},
-std::array<float,2>{0.69941926f, 0.16419746f},
-std::array<float,2>{0.0792060867f, 0.653109789f},
-std::array<float,2>{0.944824457f, 0.825675905f},
-std::array<float,2>{0.330023617f, 0.374281853f},
-std::array<float,2>{0.616650164f, 0.295082331f},
-std::array<float,2>{0.224142954f, 0.808290124f},
-std::array<float,2>{0.848237514f, 0.726371229f},
-std::array<float,2>{0.497505307f, 0.235665888f},
-std::array<float,2>{0.917636335f, 0.0537191592f},
-std::array<float,2>{0.282719374f, 0.544383407f},
-std::array<float,2>{0.629069924f, 0.973130763f},
-std::array<float,2>{0.0356818736f, 0.447067648f},
-std::array<float,2>{0.98358798f, 0.328685582f},
-std::array<float,2>{0.353545189f, 0.846710682f},
-std::array<float,2>{0.733631492f, 0.675359964f},
-std::array<float,2>{0.124673679f, 0.134493038f},
-std::array<float,2>{0.553393662f, 0.0632345602f},
-std::array<float,2>{0.163461044f, 0.620037973f},
-std::array<float,2>{0.78523773f, 0.931874335f},
-std::array<float,2>{0.42443487f, 0.418699563f},
-std::array<float,2>{0.687349856f, 0.489060968f},
-std::array<float,2>{0.00196613302f, 0.962286174f},
-std::array<float,2>{0.895802975f, 0.511720896f},
-std::array<float,2>{0.272224188f, 0.0248917434f},
-std::array<float,2>{0.82485038f, 0.195268035f},
-std::array<float,2>{0.460386604f, 0.704751015f},
-std::array<float,2>{0.570207775f, 0.765048504f},
-std::array<float,2>{0.195897028f, 0.26804322f},
-std::array<float,2>{0.999578834f, 0.492403269f},
-std::array<float,2>{0.362248808f, 0.959427893f},
-std::array<float,2>{0.74654597f, 0.504296362f},
-std::array<float,2>{0.107106186f, 0.017071547f},
-std::array<float,2>{0.540905356f, 0.196996599f},
-std::array<float,2>{0.178688347f, 0.71849215f},
-std::array<float,2>{0.811690688f, 0.750532985f},
-std::array<float,2>{0.408955097f, 0.279889166f},
-std::array<float,2>{0.659267664f, 0.336999446f},
-std::array<float,2>{0.0299586654f, 0.857822537f},
-std::array<float,2>{0.889722347f, 0.682907522f},
-std::array<float,2>{0.255423307f, 0.131540373f},
-std::array<float,2>{0.835811019f, 0.0763039663f},
-std::array<float,2>{0.440557599f, 0.615032256f},
-std::array<float,2>{0.579673648f, 0.922499061f},
-std::array<float,2>{0.216303334f, 0.411610156f},
-std::array<float,2>{0.76515168f, 0.282644182f},
-std::array<float,2>{0.402669132f, 0.801319838f},
-std::array<float,2>{0.504157603f, 0.732313633f},
-std::array<float,2>{0.149788171f, 0.245980918f},
-std::array<float,2>{0.71453166f, 0.0618359186f},
-std::array<float,2>{0.062592499f, 0.537370801f},
-std::array<float,2>{0.964272022f, 0.976572454f},
-std::array<float,2>{0.313028246f, 0.440723956f},
-std::array<float,2>{0.608303547f, 0.399456739f},
-std::array<float,2>{0.248292923f, 0.890895605f},
-std::array<float,2>{0.872169375f, 0.565812349f},
-std::array<float,2>{0.475638598f, 0.105165057f},
-std::array<float,2>{0.929491639f, 0.16008997f},
-std::array<float,2>{0.300852805f, 0.642265797f},
-std::array<float,2>{0.643452585f, 0.813856959f},
-std::array<float,2>{0.0603489652f, 0.359499216f},
-std::array<float,2>{0.847588241f, 0.42558372f},
-std::array<float,2>{0.494789451f, 0.920757651f},
-std::array<float,2>{0.612303495f, 0.598170221f},
-std::array<float,2>{0.220909312f, 0.0855803192f},
-std::array<float,2>{0.627113581f, 0.145710751f},
-std::array<float,2>{0.0346002579f, 0.668712437f},
-std::array<float,2>{0.921255529f, 0.870016754f},
-std::array<float,2>{0.287523776f, 0.316482902f},
-std::array<float,2>{0.521591365f, 0.261781812f},
-std::array<float,2>{0.135299712f, 0.77505362f},
-std::array<float,2>{0.778179586f, 0.699894726f},
-std::array<float,2>{0.379084587f, 0.205188319f},
-std::array<float,2>{0.938428283f, 0.0116803274f},
-std::array<float,2>{0.335827351f, 0.522352457f},
-std::array<float,2>{0.696580231f, 0.938809693f},
-std::array<float,2>{0.0848251656f, 0.476107895f},
-std::array<float,2>{0.894346058f, 0.346927255f},
-std::array<float,2>{0.266845018f, 0.83154881f},
-std::array<float,2>{0.683013439f, 0.631706297f},
-std::array<float,2>{0.00526970485f, 0.177458569f},
-std::array<float,2>{0.566017032f, 0.110979676f},
-std::array<float,2>{0.199227139f, 0.591672361f},
-std::array<float,2>{0.820491612f, 0.888781428f},
-std::array<float,2>{0.454186887f, 0.383719534f},
-std::array<float,2>{0.726584852f, 0.463794291f},
-std::array<float,2>{0.120483316f, 0.997882783f},
-std::array<float,2>{0.980123937f, 0.554383695f},
-std::array<float,2>{0.35600847f, 0.0435342416f},
-std::array<float,2>{0.781875491f, 0.233046591f},
-std::array<float,2>{0.426572114f, 0.745587766f},
-std::array<float,2>{0.549080908f, 0.788709641f},
-std::array<float,2>{0.159360036f, 0.304026783f},
-std::array<float,2>{0.911484063f, 0.381848603f},
-std::array<float,2>{0.2965177f, 0.881466508f},
-std::array<float,2>{0.639411449f, 0.579280257f},
-std::array<float,2>{0.0456916094f, 0.122537464f},
-std::array<float,2>{0.622630358f, 0.18063201f},
-std::array<float,2>{0.230987042f, 0.637450039f},
-std::array<float,2>{0.857961774f, 0.836983025f},
-std::array<float,2>{0.485947818f, 0.355631739f},
-std::array<float,2>{0.693071485f, 0.307658046f},
-std::array<float,2>{0.0914895758f, 0.791388154f},
-std::array<float,2>{0.949742854f, 0.739666283f},
-std::array<float,2>{0.33682555f, 0.220616087f},
-std::array<float,2>{0.768931448f, 0.0385772772f},
-std::array<float,2>{0.389119297f, 0.555824637f},
-std::array<float,2>{0.527339041f, 0.988732576f},
-std::array<float,2>{0.128479898f, 0.459614784f},
-std::array<float,2>{0.817090034f, 0.325122297f},
-std::array<float,2>{0.46125102f, 0.862257779f},
-std::array<float,2>{0.572796524f, 0.6634022f},
-std::array<float,2>{0.189831212f, 0.152795538f},
-std::array<float,2>{0.677651823f, 0.0908746347f},
-std::array<float,2>{0.0144603634f, 0.605787396f},
-std::array<float,2>{0.898900032f, 0.90683037f},
-std::array<float,2>{0.277709335f, 0.434649557f},
-std::array<float,2>{0.562451243f, 0.482889563f},
-std::array<float,2>{0.167025119f, 0.952968001f},
-std::array<float,2>{0.78967458f, 0.525233805f},
-std::array<float,2>{0.431234509f, 0.00458786916f},
-std::array<float,2>{0.976519883f, 0.217329651f},
-std::array<float,2>{0.349730194f, 0.692655683f},
-std::array<float,2>{0.722349823f, 0.771926641f},
-std::array<float,2>{0.115904875f, 0.253724456f},
-std::array<float,2>{0.802418649f, 0.451924503f},
-std::array<float,2>{0.419342607f, 0.970880091f},
-std::array<float,2>{0.537136495f, 0.539767206f},
-std::array<float,2>{0.182085395f, 0.0503780618f},
-std::array<float,2>{0.736721456f, 0.238336727f},
-std::array<float,2>{0.0949764326f, 0.721113682f},
-std::array<float,2>{0.989997983f, 0.810112417f},
-std::array<float,2>{0.370825529f, 0.292624891f},
-std::array<float,2>{0.592916548f, 0.368124008f},
-std::array<float,2>{0.210496813f, 0.823986113f},
-std::array<float,2>{0.840903819f, 0.649053693f},
-std::array<float,2>{0.44718197f, 0.17021668f},
-std::array<float,2>{0.880735874f, 0.0957386717f},
-std::array<float,2>{0.260111243f, 0.577243865f},
-std::array<float,2>{0.671791315f, 0.902881861f},
-std::array<float,2>{0.0233391766f, 0.397090137f},
-std::array<float,2>{0.959407806f, 0.273144782f},
-std::array<float,2>{0.321336329f, 0.76159209f},
-std::array<float,2>{0.708939791f, 0.709306002f},
-std::array<float,2>{0.0725712329f, 0.188204885f},
-std::array<float,2>{0.510263681f, 0.029739419f},
-std::array<float,2>{0.143351272f, 0.511144102f},
-std::array<float,2>{0.751368225f, 0.965400219f},
-std::array<float,2>{0.393804461f, 0.485741407f},
-std::array<float,2>{0.652420104f, 0.417348683f},
-std::array<float,2>{0.0533578992f, 0.937212944f},
-std::array<float,2>{0.93562299f, 0.622460008f},
-std::array<float,2>{0.305992812f, 0.0666989237f},
-std::array<float,2>{0.866548598f, 0.138657123f},
-std::array<float,2>{0.482031524f, 0.679100335f},
-std::array<float,2>{0.600866616f, 0.848959029f},
-std::array<float,2>{0.234844759f, 0.334083885f},
-std::array<float,2>{0.969660997f, 0.404568732f},
-std::array<float,2>{0.345116913f, 0.897060394f},
-std::array<float,2>{0.725961804f, 0.570054531f},
-std::array<float,2>{0.110047877f, 0.106939912f},
-std::array<float,2>{0.55680716f, 0.163735554f},
-std::array<float,2>{0.168942541f, 0.645489156f},
-std::array<float,2>{0.794754326f, 0.817688704f},
-std::array<float,2>{0.434055239f, 0.365643084f},
-std::array<float,2>{0.674753785f, 0.287821889f},
-std::array<float,2>{0.0101929475f, 0.797469676f},
-std::array<float,2>{0.905959964f, 0.730267584f},
-std::array<float,2>{0.277208179f, 0.246298626f},
-std::array<float,2>{0.816046953f, 0.0561878607f},
-std::array<float,2>{0.467096776f, 0.532200873f},
-std::array<float,2>{0.575401425f, 0.982783616f},
-std::array<float,2>{0.191547066f, 0.444723219f},
-std::array<float,2>{0.772963107f, 0.343409061f},
-std::array<float,2>{0.382991552f, 0.854219198f},
-std::array<float,2>{0.52760911f, 0.68711108f},
-std::array<float,2>{0.128929228f, 0.125289425f},
-std::array<float,2>{0.688404202f, 0.0740344822f},
-std::array<float,2>{0.0884429365f, 0.61216557f},
-std::array<float,2>{0.948288858f, 0.926963925f},
-std::array<float,2>{0.340731084f, 0.40799287f},
-std::array<float,2>{0.619280934f, 0.496794254f},
-std::array<float,2>{0.229264691f, 0.953439891f},
-std::array<float,2>{0.852366805f, 0.501323581f},
-std::array<float,2>{0.490472466f, 0.0233741812f},
-std::array<float,2>{0.907559693f, 0.202890381f},
-std::array<float,2>{0.290649325f, 0.714004278f},
-std::array<float,2>{0.636057258f, 0.755749226f},
-std::array<float,2>{0.0410890654f, 0.275962621f},
-std::array<float,2>{0.861572146f, 0.466963232f},
-std::array<float,2>{0.478198588f, 0.994932771f},
-std::array<float,2>{0.595967889f, 0.547936976f},
-std::array<float,2>{0.24160096f, 0.0417153575f},
-std::array<float,2>{0.649431646f, 0.22793901f},
-std::array<float,2>{0.0488963872f, 0.748068154f},
-std::array<float,2>{0.930901945f, 0.782127321f},
-std::array<float,2>{0.311249226f, 0.300038129f},
-std::array<float,2>{0.515434504f, 0.351129591f},
-std::array<float,2>{0.146158278f, 0.833872378f},
-std::array<float,2>{0.756954253f, 0.626410902f},
-std::array<float,2>{0.395581692f, 0.172697052f},
-std::array<float,2>{0.955026388f, 0.113852859f},
-std::array<float,2>{0.326961517f, 0.587950051f},
-std::array<float,2>{0.703598678f, 0.886481285f},
-std::array<float,2>{0.0773904696f, 0.387757927f},
-std::array<float,2>{0.877451777f, 0.261151046f},
-std::array<float,2>{0.263189346f, 0.777656496f},
-std::array<float,2>{0.667764604f, 0.695837736f},
-std::array<float,2>{0.0182480756f, 0.207199752f},
-std::array<float,2>{0.586369812f, 0.0137214083f},
-std::array<float,2>{0.203472331f, 0.515663326f},
-std::array<float,2>{0.839829147f, 0.943266451f},
-std::array<float,2>{0.453028917f, 0.471209705f},
-std::array<float,2>{0.738779902f, 0.428360552f},
-std::array<float,2>{0.0994558558f, 0.916769028f},
-std::array<float,2>{0.98476404f, 0.594724298f},
-std::array<float,2>{0.371986181f, 0.0816882178f},
-std::array<float,2>{0.798678696f, 0.141162932f},
-std::array<float,2>{0.414755285f, 0.665721118f},
-std::array<float,2>{0.534877479f, 0.871466041f},
-std::array<float,2>{0.185205519f, 0.312607348f},
-std::array<float,2>{0.924280226f, 0.477657646f},
-std::array<float,2>{0.300124824f, 0.948799968f},
-std::array<float,2>{0.646631718f, 0.527736068f},
-std::array<float,2>{0.0576729029f, 9.57360462e-05f},
-std::array<float,2>{0.602551579f, 0.211196542f},
-std::array<float,2>{0.244750306f, 0.688651323f},
-std::array<float,2>{0.868913829f, 0.767312407f},
-std::array<float,2>{0.470756888f, 0.254540592f},
-std::array<float,2>{0.717181146f, 0.322812617f},
-std::array<float,2>{0.0673434287f, 0.864516497f},
-std::array<float,2>{0.965330124f, 0.657454133f},
-std::array<float,2>{0.317016691f, 0.148680121f},
-std::array<float,2>{0.761110723f, 0.0888916999f},
-std::array<float,2>{0.40180847f, 0.605085313f},
-std::array<float,2>{0.5007177f, 0.911842883f},
-std::array<float,2>{0.1545562f, 0.432516068f},
-std::array<float,2>{0.831163764f, 0.309765548f},
-std::array<float,2>{0.443742871f, 0.795553505f},
-std::array<float,2>{0.582035363f, 0.734458089f},
-std::array<float,2>{0.210952908f, 0.224983528f},
-std::array<float,2>{0.660931826f, 0.0347237736f},
-std::array<float,2>{0.0273241084f, 0.56199044f},
-std::array<float,2>{0.885178566f, 0.987576962f},
-std::array<float,2>{0.252516091f, 0.456050783f},
-std::array<float,2>{0.545641899f, 0.378675044f},
-std::array<float,2>{0.172899023f, 0.877930343f},
-std::array<float,2>{0.808457136f, 0.585412264f},
-std::array<float,2>{0.414057344f, 0.117725365f},
-std::array<float,2>{0.994237483f, 0.185114309f},
-std::array<float,2>{0.364310563f, 0.635066986f},
-std::array<float,2>{0.744661152f, 0.840932369f},
-std::array<float,2>{0.104755156f, 0.351685941f},
-std::array<float,2>{0.787188232f, 0.421802998f},
-std::array<float,2>{0.423240542f, 0.930019438f},
-std::array<float,2>{0.552441239f, 0.618122518f},
-std::array<float,2>{0.162002876f, 0.0663503781f},
-std::array<float,2>{0.732029736f, 0.135448501f},
-std::array<float,2>{0.121771649f, 0.673254609f},
-std::array<float,2>{0.98081845f, 0.845645845f},
-std::array<float,2>{0.352402568f, 0.331148684f},
-std::array<float,2>{0.567269862f, 0.266230822f},
-std::array<float,2>{0.198260665f, 0.763409615f},
-std::array<float,2>{0.827610731f, 0.705824852f},
-std::array<float,2>{0.458914369f, 0.191903487f},
-std::array<float,2>{0.897424757f, 0.0272884425f},
-std::array<float,2>{0.270925313f, 0.515045345f},
-std::array<float,2>{0.683830142f, 0.964623988f},
-std::array<float,2>{0.00136404368f, 0.490504175f},
-std::array<float,2>{0.942897081f, 0.372354656f},
-std::array<float,2>{0.331337512f, 0.827955186f},
-std::array<float,2>{0.701645374f, 0.654861867f},
-std::array<float,2>{0.0811244994f, 0.167701125f},
-std::array<float,2>{0.516936481f, 0.0978976712f},
-std::array<float,2>{0.1381073f, 0.572851837f},
-std::array<float,2>{0.774928689f, 0.898698628f},
-std::array<float,2>{0.377178013f, 0.392156422f},
-std::array<float,2>{0.632097483f, 0.448534578f},
-std::array<float,2>{0.038178809f, 0.974630773f},
-std::array<float,2>{0.91512084f, 0.54540056f},
-std::array<float,2>{0.284415632f, 0.0509444177f},
-std::array<float,2>{0.849812686f, 0.236404017f},
-std::array<float,2>{0.498508781f, 0.724257767f},
-std::array<float,2>{0.613443315f, 0.806547821f},
-std::array<float,2>{0.225504965f, 0.294174254f},
-std::array<float,2>{0.962344944f, 0.439164937f},
-std::array<float,2>{0.316286355f, 0.97880131f},
-std::array<float,2>{0.711809158f, 0.535598159f},
-std::array<float,2>{0.0657623634f, 0.0592522807f},
-std::array<float,2>{0.507299483f, 0.242283553f},
-std::array<float,2>{0.151938125f, 0.734268665f},
-std::array<float,2>{0.761754215f, 0.80348295f},
-std::array<float,2>{0.406029314f, 0.284460962f},
-std::array<float,2>{0.640854299f, 0.362130582f},
-std::array<float,2>{0.0614087619f, 0.816045165f},
-std::array<float,2>{0.926009178f, 0.644003034f},
-std::array<float,2>{0.303529084f, 0.156361043f},
-std::array<float,2>{0.874106824f, 0.101632148f},
-std::array<float,2>{0.472967684f, 0.562799096f},
-std::array<float,2>{0.605949342f, 0.892584801f},
-std::array<float,2>{0.246334001f, 0.401214004f},
-std::array<float,2>{0.810500443f, 0.279038459f},
-std::array<float,2>{0.407753646f, 0.752830386f},
-std::array<float,2>{0.542170942f, 0.716422915f},
-std::array<float,2>{0.176275805f, 0.19781521f},
-std::array<float,2>{0.749706805f, 0.0175905414f},
-std::array<float,2>{0.107778154f, 0.50729692f},
-std::array<float,2>{0.996274412f, 0.958913922f},
-std::array<float,2>{0.361287475f, 0.495475084f},
-std::array<float,2>{0.58111757f, 0.412793934f},
-std::array<float,2>{0.21844618f, 0.924034059f},
-std::array<float,2>{0.833332002f, 0.615540802f},
-std::array<float,2>{0.438327253f, 0.0743419006f},
-std::array<float,2>{0.886931896f, 0.130793735f},
-std::array<float,2>{0.256893665f, 0.680731773f},
-std::array<float,2>{0.656938434f, 0.855861545f},
-std::array<float,2>{0.0289953556f, 0.339521796f},
-std::array<float,2>{0.823895872f, 0.385976195f},
-std::array<float,2>{0.455214739f, 0.887100279f},
-std::array<float,2>{0.563855946f, 0.592249453f},
-std::array<float,2>{0.202264205f, 0.111979187f},
-std::array<float,2>{0.679813862f, 0.17832832f},
-std::array<float,2>{0.00596742239f, 0.629499257f},
-std::array<float,2>{0.891565084f, 0.829520464f},
-std::array<float,2>{0.26934728f, 0.345273793f},
-std::array<float,2>{0.54857713f, 0.302382231f},
-std::array<float,2>{0.156899408f, 0.786638975f},
-std::array<float,2>{0.784318924f, 0.743279099f},
-std::array<float,2>{0.427775711f, 0.232206166f},
-std::array<float,2>{0.977428436f, 0.0459982269f},
-std::array<float,2>{0.359190494f, 0.552235067f},
-std::array<float,2>{0.728665352f, 0.998897314f},
-std::array<float,2>{0.118362777f, 0.46205312f},
-std::array<float,2>{0.918864608f, 0.319865197f},
-std::array<float,2>{0.285335988f, 0.868840098f},
-std::array<float,2>{0.625878334f, 0.670707166f},
-std::array<float,2>{0.0325795524f, 0.147290856f},
-std::array<float,2>{0.609602094f, 0.08381024f},
-std::array<float,2>{0.21997866f, 0.600562394f},
-std::array<float,2>{0.844254196f, 0.919801414f},
-std::array<float,2>{0.4927499f, 0.421970576f},
-std::array<float,2>{0.697935104f, 0.473034978f},
-std::array<float,2>{0.0823237002f, 0.940343559f},
-std::array<float,2>{0.940510631f, 0.520248413f},
-std::array<float,2>{0.333019286f, 0.00960412715f},
-std::array<float,2>{0.77999419f, 0.20357956f},
-std::array<float,2>{0.381453216f, 0.702751875f},
-std::array<float,2>{0.521047294f, 0.776522338f},
-std::array<float,2>{0.13365002f, 0.265487581f},
-std::array<float,2>{0.900598049f, 0.435559273f},
-std::array<float,2>{0.280987293f, 0.909904361f},
-std::array<float,2>{0.678022087f, 0.60810262f},
-std::array<float,2>{0.0136459926f, 0.0923549011f},
-std::array<float,2>{0.57078743f, 0.15561837f},
-std::array<float,2>{0.187935993f, 0.661119878f},
-std::array<float,2>{0.820114553f, 0.859701872f},
-std::array<float,2>{0.46388185f, 0.326417953f},
-std::array<float,2>{0.720428765f, 0.251885653f},
-std::array<float,2>{0.114833474f, 0.771142602f},
-std::array<float,2>{0.972798586f, 0.694867074f},
-std::array<float,2>{0.348148376f, 0.215755701f},
-std::array<float,2>{0.792862177f, 0.00682382565f},
-std::array<float,2>{0.433565527f, 0.526870131f},
-std::array<float,2>{0.559158564f, 0.950909734f},
-std::array<float,2>{0.165439203f, 0.481197238f},
-std::array<float,2>{0.856121898f, 0.359031826f},
-std::array<float,2>{0.487065673f, 0.839600265f},
-std::array<float,2>{0.623968363f, 0.639840603f},
-std::array<float,2>{0.232455686f, 0.18232961f},
-std::array<float,2>{0.637615561f, 0.124694251f},
-std::array<float,2>{0.0443647131f, 0.58115685f},
-std::array<float,2>{0.913070738f, 0.879735649f},
-std::array<float,2>{0.294402093f, 0.379434615f},
-std::array<float,2>{0.523521423f, 0.458525509f},
-std::array<float,2>{0.126123399f, 0.990673065f},
-std::array<float,2>{0.766664028f, 0.557153821f},
-std::array<float,2>{0.386756122f, 0.0360076912f},
-std::array<float,2>{0.951515615f, 0.222074747f},
-std::array<float,2>{0.337924451f, 0.740344524f},
-std::array<float,2>{0.694943249f, 0.789942265f},
-std::array<float,2>{0.0935621336f, 0.305979878f},
-std::array<float,2>{0.752608776f, 0.486875862f},
-std::array<float,2>{0.392323643f, 0.967567682f},
-std::array<float,2>{0.507847965f, 0.509535432f},
-std::array<float,2>{0.141719043f, 0.0286944322f},
-std::array<float,2>{0.710312784f, 0.189828664f},
-std::array<float,2>{0.0717228428f, 0.708234131f},
-std::array<float,2>{0.95812583f, 0.758039355f},
-std::array<float,2>{0.323316216f, 0.271241248f},
-std::array<float,2>{0.599204242f, 0.332927585f},
-std::array<float,2>{0.236496687f, 0.850821614f},
-std::array<float,2>{0.864550531f, 0.677503347f},
-std::array<float,2>{0.483560741f, 0.138998017f},
-std::array<float,2>{0.934213698f, 0.0702491924f},
-std::array<float,2>{0.307176292f, 0.624964893f},
-std::array<float,2>{0.654700935f, 0.933848858f},
-std::array<float,2>{0.051925689f, 0.414084792f},
-std::array<float,2>{0.991813719f, 0.289341599f},
-std::array<float,2>{0.368491262f, 0.811139345f},
-std::array<float,2>{0.736008883f, 0.719867647f},
-std::array<float,2>{0.0961821079f, 0.240592062f},
-std::array<float,2>{0.536679208f, 0.0487950183f},
-std::array<float,2>{0.179790676f, 0.542928994f},
-std::array<float,2>{0.803340554f, 0.969273388f},
-std::array<float,2>{0.421764165f, 0.450193912f},
-std::array<float,2>{0.668580234f, 0.395074397f},
-std::array<float,2>{0.0196958799f, 0.906097651f},
-std::array<float,2>{0.882307172f, 0.575199306f},
-std::array<float,2>{0.259513766f, 0.0943208858f},
-std::array<float,2>{0.843342006f, 0.168553084f},
-std::array<float,2>{0.448651463f, 0.651443779f},
-std::array<float,2>{0.59057188f, 0.820423424f},
-std::array<float,2>{0.208523497f, 0.371072412f},
-std::array<float,2>{0.956073523f, 0.387212753f},
-std::array<float,2>{0.325847894f, 0.884798467f},
-std::array<float,2>{0.705190599f, 0.589704335f},
-std::array<float,2>{0.0748156458f, 0.114577025f},
-std::array<float,2>{0.51301831f, 0.173601627f},
-std::array<float,2>{0.147316039f, 0.62507534f},
-std::array<float,2>{0.754455507f, 0.832718372f},
-std::array<float,2>{0.397181243f, 0.350215971f},
-std::array<float,2>{0.651708007f, 0.299159855f},
-std::array<float,2>{0.046967756f, 0.782962859f},
-std::array<float,2>{0.932406306f, 0.749218941f},
-std::array<float,2>{0.310530782f, 0.22717616f},
-std::array<float,2>{0.859566391f, 0.0423942134f},
-std::array<float,2>{0.480111003f, 0.54715699f},
-std::array<float,2>{0.595286787f, 0.995883167f},
-std::array<float,2>{0.238724083f, 0.468145162f},
-std::array<float,2>{0.80012536f, 0.313611239f},
-std::array<float,2>{0.417865753f, 0.872668743f},
-std::array<float,2>{0.53280884f, 0.664993167f},
-std::array<float,2>{0.187022448f, 0.142484203f},
-std::array<float,2>{0.740952134f, 0.0804456398f},
-std::array<float,2>{0.099676922f, 0.595509052f},
-std::array<float,2>{0.987878025f, 0.917013943f},
-std::array<float,2>{0.374663264f, 0.429200679f},
-std::array<float,2>{0.588396132f, 0.472476304f},
-std::array<float,2>{0.206705108f, 0.942234635f},
-std::array<float,2>{0.836915672f, 0.516806841f},
-std::array<float,2>{0.449577183f, 0.0149872284f},
-std::array<float,2>{0.876500547f, 0.208067596f},
-std::array<float,2>{0.264647126f, 0.696809232f},
-std::array<float,2>{0.665822685f, 0.778587162f},
-std::array<float,2>{0.0161737371f, 0.260332853f},
-std::array<float,2>{0.813968956f, 0.444011807f},
-std::array<float,2>{0.466188192f, 0.983662009f},
-std::array<float,2>{0.577843606f, 0.532848716f},
-std::array<float,2>{0.194670036f, 0.0548513085f},
-std::array<float,2>{0.673111618f, 0.24796468f},
-std::array<float,2>{0.00925023574f, 0.729317307f},
-std::array<float,2>{0.902815342f, 0.798649549f},
-std::array<float,2>{0.273997039f, 0.288887352f},
-std::array<float,2>{0.555822253f, 0.366213202f},
-std::array<float,2>{0.170149207f, 0.816889763f},
-std::array<float,2>{0.796557069f, 0.645615876f},
-std::array<float,2>{0.437437564f, 0.162900567f},
-std::array<float,2>{0.971657991f, 0.105652437f},
-std::array<float,2>{0.347484082f, 0.569135785f},
-std::array<float,2>{0.72386384f, 0.89837575f},
-std::array<float,2>{0.113107145f, 0.405920237f},
-std::array<float,2>{0.909329116f, 0.277045459f},
-std::array<float,2>{0.29291895f, 0.754236341f},
-std::array<float,2>{0.632970929f, 0.713278532f},
-std::array<float,2>{0.0401149504f, 0.202135026f},
-std::array<float,2>{0.618741333f, 0.0222695973f},
-std::array<float,2>{0.227266476f, 0.500760615f},
-std::array<float,2>{0.854575872f, 0.954820931f},
-std::array<float,2>{0.489335507f, 0.497222424f},
-std::array<float,2>{0.690805674f, 0.406379402f},
-std::array<float,2>{0.0876676515f, 0.926648736f},
-std::array<float,2>{0.946046412f, 0.612486601f},
-std::array<float,2>{0.342671514f, 0.0728070587f},
-std::array<float,2>{0.771168411f, 0.125999451f},
-std::array<float,2>{0.385392338f, 0.686366618f},
-std::array<float,2>{0.530056119f, 0.854521573f},
-std::array<float,2>{0.131359965f, 0.342528731f},
-std::array<float,2>{0.895062506f, 0.491379201f},
-std::array<float,2>{0.272800118f, 0.962931752f},
-std::array<float,2>{0.685908437f, 0.514542282f},
-std::array<float,2>{0.00320975925f, 0.0258225184f},
-std::array<float,2>{0.568703353f, 0.192924216f},
-std::array<float,2>{0.196359947f, 0.70663023f},
-std::array<float,2>{0.825982153f, 0.761989355f},
-std::array<float,2>{0.459897429f, 0.266782641f},
-std::array<float,2>{0.732665062f, 0.330418438f},
-std::array<float,2>{0.123696379f, 0.84414655f},
-std::array<float,2>{0.98250854f, 0.672681034f},
-std::array<float,2>{0.355146706f, 0.136117995f},
-std::array<float,2>{0.78697145f, 0.0647018254f},
-std::array<float,2>{0.424849063f, 0.618887067f},
-std::array<float,2>{0.55441469f, 0.930941939f},
-std::array<float,2>{0.162400842f, 0.420659274f},
-std::array<float,2>{0.849195957f, 0.293633908f},
-std::array<float,2>{0.497032762f, 0.804843485f},
-std::array<float,2>{0.615752637f, 0.722847581f},
-std::array<float,2>{0.22275953f, 0.237815112f},
-std::array<float,2>{0.63012445f, 0.0522494651f},
-std::array<float,2>{0.036985375f, 0.546438634f},
-std::array<float,2>{0.916776359f, 0.97589308f},
-std::array<float,2>{0.281557083f, 0.447586924f},
-std::array<float,2>{0.51863873f, 0.391307116f},
-std::array<float,2>{0.139424711f, 0.900336385f},
-std::array<float,2>{0.775876522f, 0.573928654f},
-std::array<float,2>{0.375762105f, 0.0990474597f},
-std::array<float,2>{0.944059789f, 0.166537479f},
-std::array<float,2>{0.328161061f, 0.655762017f},
-std::array<float,2>{0.700671136f, 0.826804101f},
-std::array<float,2>{0.0786731169f, 0.37123701f},
-std::array<float,2>{0.75940305f, 0.433363855f},
-std::array<float,2>{0.400300562f, 0.910716236f},
-std::array<float,2>{0.503595591f, 0.604411483f},
-std::array<float,2>{0.153677925f, 0.0881721228f},
-std::array<float,2>{0.716556609f, 0.149826631f},
-std::array<float,2>{0.0692676231f, 0.656330585f},
-std::array<float,2>{0.968378425f, 0.863484681f},
-std::array<float,2>{0.320185691f, 0.323927402f},
-std::array<float,2>{0.605438709f, 0.255743891f},
-std::array<float,2>{0.242715672f, 0.765638053f},
-std::array<float,2>{0.870494187f, 0.687537193f},
-std::array<float,2>{0.470071405f, 0.212608412f},
-std::array<float,2>{0.923502505f, 0.00114120264f},
-std::array<float,2>{0.298740029f, 0.529175043f},
-std::array<float,2>{0.645164371f, 0.947764933f},
-std::array<float,2>{0.0557346381f, 0.477145255f},
-std::array<float,2>{0.993505895f, 0.352667302f},
-std::array<float,2>{0.366084993f, 0.840483367f},
-std::array<float,2>{0.74370414f, 0.636522233f},
-std::array<float,2>{0.102740593f, 0.18373315f},
-std::array<float,2>{0.543072462f, 0.118651614f},
-std::array<float,2>{0.173988581f, 0.584086716f},
-std::array<float,2>{0.805958807f, 0.877607048f},
-std::array<float,2>{0.41156888f, 0.377489299f},
-std::array<float,2>{0.663190544f, 0.456670403f},
-std::array<float,2>{0.0237157997f, 0.98693639f},
-std::array<float,2>{0.88403976f, 0.561300159f},
-std::array<float,2>{0.251354724f, 0.0332274139f},
-std::array<float,2>{0.828697681f, 0.225732625f},
-std::array<float,2>{0.442560136f, 0.735469341f},
-std::array<float,2>{0.585935354f, 0.796165109f},
-std::array<float,2>{0.214359224f, 0.308918238f},
-std::array<float,2>{0.979021788f, 0.4609873f},
-std::array<float,2>{0.356882453f, 0.999900043f},
-std::array<float,2>{0.727957129f, 0.55092907f},
-std::array<float,2>{0.119823299f, 0.0450299978f},
-std::array<float,2>{0.550094485f, 0.230942503f},
-std::array<float,2>{0.158795387f, 0.74268043f},
-std::array<float,2>{0.783016443f, 0.785502791f},
-std::array<float,2>{0.427037418f, 0.301335633f},
-std::array<float,2>{0.681777775f, 0.344716489f},
-std::array<float,2>{0.00407750439f, 0.828828335f},
-std::array<float,2>{0.892615974f, 0.629915476f},
-std::array<float,2>{0.266246974f, 0.179270014f},
-std::array<float,2>{0.821347296f, 0.112328142f},
-std::array<float,2>{0.453939617f, 0.593105614f},
-std::array<float,2>{0.564921319f, 0.888458431f},
-std::array<float,2>{0.200494424f, 0.385486662f},
-std::array<float,2>{0.778344572f, 0.264399469f},
-std::array<float,2>{0.37990725f, 0.775566697f},
-std::array<float,2>{0.522850633f, 0.702031612f},
-std::array<float,2>{0.136498079f, 0.204360381f},
-std::array<float,2>{0.695349216f, 0.00827525277f},
-std::array<float,2>{0.0855603665f, 0.520786822f},
-std::array<float,2>{0.939362526f, 0.940818787f},
-std::array<float,2>{0.334409714f, 0.474550962f},
-std::array<float,2>{0.612925828f, 0.42359814f},
-std::array<float,2>{0.221972346f, 0.918049932f},
-std::array<float,2>{0.846127689f, 0.601333618f},
-std::array<float,2>{0.495956689f, 0.0828183889f},
-std::array<float,2>{0.92076093f, 0.14804171f},
-std::array<float,2>{0.288732022f, 0.671823859f},
-std::array<float,2>{0.628310859f, 0.867551625f},
-std::array<float,2>{0.0336117148f, 0.318632483f},
-std::array<float,2>{0.871333957f, 0.401787758f},
-std::array<float,2>{0.475182056f, 0.894370496f},
-std::array<float,2>{0.608872771f, 0.563939095f},
-std::array<float,2>{0.249897391f, 0.103196301f},
-std::array<float,2>{0.644251585f, 0.158063367f},
-std::array<float,2>{0.0588449687f, 0.642852366f},
-std::array<float,2>{0.928142071f, 0.815308869f},
-std::array<float,2>{0.301861227f, 0.362645984f},
-std::array<float,2>{0.505812764f, 0.283284962f},
-std::array<float,2>{0.14879851f, 0.803993583f},
-std::array<float,2>{0.763961136f, 0.732507408f},
-std::array<float,2>{0.403321564f, 0.243554845f},
-std::array<float,2>{0.963187337f, 0.0604293458f},
-std::array<float,2>{0.313749194f, 0.536735356f},
-std::array<float,2>{0.713608563f, 0.980335951f},
-std::array<float,2>{0.0643047392f, 0.437685668f},
-std::array<float,2>{0.888919711f, 0.338802904f},
-std::array<float,2>{0.254214704f, 0.857366323f},
-std::array<float,2>{0.658677936f, 0.680539191f},
-std::array<float,2>{0.0307538509f, 0.12962231f},
-std::array<float,2>{0.578564286f, 0.075389646f},
-std::array<float,2>{0.215531379f, 0.616295338f},
-std::array<float,2>{0.834451616f, 0.925322771f},
-std::array<float,2>{0.440271914f, 0.413332552f},
-std::array<float,2>{0.747637928f, 0.494166762f},
-std::array<float,2>{0.10585285f, 0.957713604f},
-std::array<float,2>{0.998833537f, 0.506066442f},
-std::array<float,2>{0.362417191f, 0.018747665f},
-std::array<float,2>{0.811304748f, 0.198596388f},
-std::array<float,2>{0.409213036f, 0.715077043f},
-std::array<float,2>{0.539597988f, 0.753597438f},
-std::array<float,2>{0.178806931f, 0.277755916f},
-std::array<float,2>{0.937344074f, 0.41596508f},
-std::array<float,2>{0.30472523f, 0.935449362f},
-std::array<float,2>{0.653869927f, 0.623164773f},
-std::array<float,2>{0.0544735789f, 0.0686010122f},
-std::array<float,2>{0.600043356f, 0.139729172f},
-std::array<float,2>{0.235518068f, 0.676112056f},
-std::array<float,2>{0.86541605f, 0.85042125f},
-std::array<float,2>{0.480927706f, 0.333023995f},
-std::array<float,2>{0.707947314f, 0.27049613f},
-std::array<float,2>{0.073985897f, 0.759471178f},
-std::array<float,2>{0.960209489f, 0.707033038f},
-std::array<float,2>{0.321019113f, 0.190900713f},
-std::array<float,2>{0.750366747f, 0.0277908165f},
-std::array<float,2>{0.393279105f, 0.508620381f},
-std::array<float,2>{0.510786414f, 0.968741119f},
-std::array<float,2>{0.144290671f, 0.487533867f},
-std::array<float,2>{0.840296328f, 0.369661599f},
-std::array<float,2>{0.445796132f, 0.821648061f},
-std::array<float,2>{0.592387676f, 0.651356041f},
-std::array<float,2>{0.209896967f, 0.169091642f},
-std::array<float,2>{0.670088172f, 0.0947805569f},
-std::array<float,2>{0.0220956746f, 0.574305713f},
-std::array<float,2>{0.879601419f, 0.904593885f},
-std::array<float,2>{0.261717528f, 0.395820767f},
-std::array<float,2>{0.538485825f, 0.450493485f},
-std::array<float,2>{0.183529139f, 0.970025003f},
-std::array<float,2>{0.801123261f, 0.541179359f},
-std::array<float,2>{0.41890797f, 0.0470120087f},
-std::array<float,2>{0.989230454f, 0.241332963f},
-std::array<float,2>{0.370115638f, 0.719030499f},
-std::array<float,2>{0.738180339f, 0.811661184f},
-std::array<float,2>{0.0946928039f, 0.290529728f},
-std::array<float,2>{0.79041177f, 0.482166559f},
-std::array<float,2>{0.429767489f, 0.949853241f},
-std::array<float,2>{0.561162829f, 0.526336432f},
-std::array<float,2>{0.166835353f, 0.00730713503f},
-std::array<float,2>{0.721653461f, 0.21667321f},
-std::array<float,2>{0.116347656f, 0.693755865f},
-std::array<float,2>{0.974613726f, 0.770196557f},
-std::array<float,2>{0.350776672f, 0.250131011f},
-std::array<float,2>{0.573704362f, 0.327962577f},
-std::array<float,2>{0.190443903f, 0.860363603f},
-std::array<float,2>{0.818238616f, 0.661599636f},
-std::array<float,2>{0.462553918f, 0.154349789f},
-std::array<float,2>{0.899869978f, 0.0930033922f},
-std::array<float,2>{0.279170454f, 0.608450115f},
-std::array<float,2>{0.675909996f, 0.909122109f},
-std::array<float,2>{0.0149726989f, 0.437268674f},
-std::array<float,2>{0.951164186f, 0.305013806f},
-std::array<float,2>{0.337615758f, 0.790658772f},
-std::array<float,2>{0.692148924f, 0.741567314f},
-std::array<float,2>{0.0903025791f, 0.221347913f},
-std::array<float,2>{0.526184618f, 0.036338374f},
-std::array<float,2>{0.127247721f, 0.557657659f},
-std::array<float,2>{0.767816424f, 0.991670907f},
-std::array<float,2>{0.389788091f, 0.457607627f},
-std::array<float,2>{0.640103519f, 0.380509377f},
-std::array<float,2>{0.0468723811f, 0.880200684f},
-std::array<float,2>{0.911110222f, 0.58063978f},
-std::array<float,2>{0.29493627f, 0.123836808f},
-std::array<float,2>{0.859221101f, 0.183569178f},
-std::array<float,2>{0.484653622f, 0.639231384f},
-std::array<float,2>{0.621918499f, 0.838287592f},
-std::array<float,2>{0.231809556f, 0.357480496f},
-std::array<float,2>{0.985681474f, 0.427221924f},
-std::array<float,2>{0.372437477f, 0.914761424f},
-std::array<float,2>{0.73999238f, 0.595728219f},
-std::array<float,2>{0.0983055905f, 0.079211086f},
-std::array<float,2>{0.533899248f, 0.143727615f},
-std::array<float,2>{0.183711097f, 0.667565107f},
-std::array<float,2>{0.797218323f, 0.873894393f},
-std::array<float,2>{0.415411562f, 0.31591776f},
-std::array<float,2>{0.666125715f, 0.258396864f},
-std::array<float,2>{0.0194127336f, 0.779733658f},
-std::array<float,2>{0.87853694f, 0.697823048f},
-std::array<float,2>{0.261849225f, 0.210915446f},
-std::array<float,2>{0.838647008f, 0.0118251499f},
-std::array<float,2>{0.451352715f, 0.518153131f},
-std::array<float,2>{0.587763548f, 0.944151878f},
-std::array<float,2>{0.204124153f, 0.469073057f},
-std::array<float,2>{0.756308496f, 0.348620921f},
-std::array<float,2>{0.394933343f, 0.834832609f},
-std::array<float,2>{0.513733804f, 0.627059162f},
-std::array<float,2>{0.14508234f, 0.174335212f},
-std::array<float,2>{0.704732239f, 0.117051877f},
-std::array<float,2>{0.07684955f, 0.586856306f},
-std::array<float,2>{0.953327417f, 0.883766294f},
-std::array<float,2>{0.327764511f, 0.389550358f},
-std::array<float,2>{0.597016215f, 0.465446144f},
-std::array<float,2>{0.24048999f, 0.993409693f},
-std::array<float,2>{0.862819374f, 0.549248219f},
-std::array<float,2>{0.476896554f, 0.0395607576f},
-std::array<float,2>{0.930010915f, 0.229243249f},
-std::array<float,2>{0.312404364f, 0.747548223f},
-std::array<float,2>{0.648958325f, 0.783404887f},
-std::array<float,2>{0.0507615916f, 0.297977984f},
-std::array<float,2>{0.852585018f, 0.499388933f},
-std::array<float,2>{0.49139291f, 0.956471622f},
-std::array<float,2>{0.620533943f, 0.503785968f},
-std::array<float,2>{0.229927391f, 0.0199402682f},
-std::array<float,2>{0.635333896f, 0.201106533f},
-std::array<float,2>{0.0429394096f, 0.71255511f},
-std::array<float,2>{0.906924307f, 0.756878912f},
-std::array<float,2>{0.289151579f, 0.275278628f},
-std::array<float,2>{0.529019892f, 0.341424853f},
-std::array<float,2>{0.130651265f, 0.851618111f},
-std::array<float,2>{0.771925032f, 0.683973789f},
-std::array<float,2>{0.383901924f, 0.12733908f},
-std::array<float,2>{0.947380543f, 0.0708581731f},
-std::array<float,2>{0.341330498f, 0.610416532f},
-std::array<float,2>{0.689382851f, 0.92850095f},
-std::array<float,2>{0.0893283263f, 0.408260614f},
-std::array<float,2>{0.904525399f, 0.286652625f},
-std::array<float,2>{0.275490165f, 0.800753474f},
-std::array<float,2>{0.67529583f, 0.726915598f},
-std::array<float,2>{0.0111885015f, 0.249182791f},
-std::array<float,2>{0.574911773f, 0.0578345284f},
-std::array<float,2>{0.19326821f, 0.533691049f},
-std::array<float,2>{0.815311372f, 0.981116712f},
-std::array<float,2>{0.468402356f, 0.442762434f},
-std::array<float,2>{0.725306749f, 0.403183341f},
-std::array<float,2>{0.110485375f, 0.895359814f},
-std::array<float,2>{0.969989598f, 0.568136334f},
-std::array<float,2>{0.343913853f, 0.108947568f},
-std::array<float,2>{0.793685615f, 0.161095008f},
-std::array<float,2>{0.435111135f, 0.648023546f},
-std::array<float,2>{0.558242202f, 0.819488585f},
-std::array<float,2>{0.169587702f, 0.365112215f},
-std::array<float,2>{0.914124012f, 0.445358634f},
-std::array<float,2>{0.283945203f, 0.97405833f},
-std::array<float,2>{0.631478906f, 0.543379009f},
-std::array<float,2>{0.0377990156f, 0.0533287562f},
-std::array<float,2>{0.614482105f, 0.234542057f},
-std::array<float,2>{0.226035267f, 0.724785268f},
-std::array<float,2>{0.851351976f, 0.807504237f},
-std::array<float,2>{0.499818683f, 0.296722531f},
-std::array<float,2>{0.703051507f, 0.373203546f},
-std::array<float,2>{0.0809927732f, 0.8243137f},
-std::array<float,2>{0.94155091f, 0.654270172f},
-std::array<float,2>{0.330410063f, 0.165979147f},
-std::array<float,2>{0.77425772f, 0.100788727f},
-std::array<float,2>{0.378803372f, 0.570724368f},
-std::array<float,2>{0.516035378f, 0.901273966f},
-std::array<float,2>{0.136728078f, 0.394320935f},
-std::array<float,2>{0.826688766f, 0.268666595f},
-std::array<float,2>{0.457911313f, 0.764521837f},
-std::array<float,2>{0.567841887f, 0.703442574f},
-std::array<float,2>{0.198162228f, 0.19391194f},
-std::array<float,2>{0.685419559f, 0.0243355762f},
-std::array<float,2>{0.000405231665f, 0.513366759f},
-std::array<float,2>{0.897765398f, 0.96137917f},
-std::array<float,2>{0.270052463f, 0.490164995f},
-std::array<float,2>{0.551405489f, 0.419370383f},
-std::array<float,2>{0.160563469f, 0.933274925f},
-std::array<float,2>{0.788115203f, 0.621071279f},
-std::array<float,2>{0.422126591f, 0.0641205981f},
-std::array<float,2>{0.982210934f, 0.133409113f},
-std::array<float,2>{0.353437126f, 0.674752533f},
-std::array<float,2>{0.730869055f, 0.845904171f},
-std::array<float,2>{0.122686788f, 0.329389662f},
-std::array<float,2>{0.807042718f, 0.376425028f},
-std::array<float,2>{0.41215384f, 0.875744641f},
-std::array<float,2>{0.546423435f, 0.582865477f},
-std::array<float,2>{0.172136873f, 0.119238682f},
-std::array<float,2>{0.745393276f, 0.186721653f},
-std::array<float,2>{0.104323372f, 0.633530617f},
-std::array<float,2>{0.995554745f, 0.841952264f},
-std::array<float,2>{0.363504171f, 0.353659064f},
-std::array<float,2>{0.583338797f, 0.310751498f},
-std::array<float,2>{0.212494239f, 0.794267178f},
-std::array<float,2>{0.830640554f, 0.737101734f},
-std::array<float,2>{0.44524017f, 0.224086985f},
-std::array<float,2>{0.88577342f, 0.0321168602f},
-std::array<float,2>{0.25306344f, 0.558642983f},
-std::array<float,2>{0.661525071f, 0.985270441f},
-std::array<float,2>{0.0262829401f, 0.453166127f},
-std::array<float,2>{0.96660912f, 0.321022749f},
-std::array<float,2>{0.318002731f, 0.865249395f},
-std::array<float,2>{0.718176723f, 0.659435213f},
-std::array<float,2>{0.0674265027f, 0.15168415f},
-std::array<float,2>{0.501051188f, 0.0870041251f},
-std::array<float,2>{0.155510962f, 0.60233891f},
-std::array<float,2>{0.760474384f, 0.913237095f},
-std::array<float,2>{0.401098907f, 0.431639433f},
-std::array<float,2>{0.64806056f, 0.479999393f},
-std::array<float,2>{0.0574229509f, 0.946275353f},
-std::array<float,2>{0.925566971f, 0.53116405f},
-std::array<float,2>{0.299494147f, 0.00323883118f},
-std::array<float,2>{0.867510438f, 0.213210478f},
-std::array<float,2>{0.471833974f, 0.689631104f},
-std::array<float,2>{0.602257729f, 0.76797241f},
-std::array<float,2>{0.245142728f, 0.257732749f},
-std::array<float,2>{0.939490676f, 0.475411296f},
-std::array<float,2>{0.332163036f, 0.937607348f},
-std::array<float,2>{0.698346138f, 0.522524714f},
-std::array<float,2>{0.0836427063f, 0.0100375032f},
-std::array<float,2>{0.519761205f, 0.206971422f},
-std::array<float,2>{0.134757087f, 0.700268149f},
-std::array<float,2>{0.781008244f, 0.774289072f},
-std::array<float,2>{0.382543445f, 0.263223708f},
-std::array<float,2>{0.626781821f, 0.317613065f},
-std::array<float,2>{0.031656079f, 0.870469213f},
-std::array<float,2>{0.919807971f, 0.669481039f},
-std::array<float,2>{0.28659603f, 0.145453274f},
-std::array<float,2>{0.844851792f, 0.0842482746f},
-std::array<float,2>{0.493708104f, 0.599354625f},
-std::array<float,2>{0.611004233f, 0.921174645f},
-std::array<float,2>{0.218824506f, 0.424799919f},
-std::array<float,2>{0.783780098f, 0.303686112f},
-std::array<float,2>{0.429452479f, 0.787587285f},
-std::array<float,2>{0.547808826f, 0.744805515f},
-std::array<float,2>{0.157442048f, 0.233831838f},
-std::array<float,2>{0.730357051f, 0.0443132184f},
-std::array<float,2>{0.117340505f, 0.553080976f},
-std::array<float,2>{0.978445232f, 0.996389806f},
-std::array<float,2>{0.357985944f, 0.464146405f},
-std::array<float,2>{0.563207984f, 0.384010732f},
-std::array<float,2>{0.201551974f, 0.889953613f},
-std::array<float,2>{0.8230654f, 0.590082169f},
-std::array<float,2>{0.456912845f, 0.10943386f},
-std::array<float,2>{0.89206022f, 0.176671922f},
-std::array<float,2>{0.268404216f, 0.632429004f},
-std::array<float,2>{0.681237459f, 0.830399573f},
-std::array<float,2>{0.0075754351f, 0.34660089f},
-std::array<float,2>{0.83204037f, 0.41075018f},
-std::array<float,2>{0.43847838f, 0.923299611f},
-std::array<float,2>{0.580303788f, 0.613908529f},
-std::array<float,2>{0.216832191f, 0.0773852393f},
-std::array<float,2>{0.657620847f, 0.132473513f},
-std::array<float,2>{0.0277554356f, 0.68241173f},
-std::array<float,2>{0.887817681f, 0.858923972f},
-std::array<float,2>{0.255966216f, 0.336103618f},
-std::array<float,2>{0.541602731f, 0.281130791f},
-std::array<float,2>{0.177104414f, 0.751531363f},
-std::array<float,2>{0.809277594f, 0.717383921f},
-std::array<float,2>{0.406771243f, 0.195766866f},
-std::array<float,2>{0.997176111f, 0.0164498258f},
-std::array<float,2>{0.359600604f, 0.505707979f},
-std::array<float,2>{0.748959422f, 0.960838377f},
-std::array<float,2>{0.10840334f, 0.493800491f},
-std::array<float,2>{0.927479506f, 0.361042529f},
-std::array<float,2>{0.304341376f, 0.812705874f},
-std::array<float,2>{0.642252564f, 0.641066611f},
-std::array<float,2>{0.0624251254f, 0.158210635f},
-std::array<float,2>{0.607213795f, 0.103892371f},
-std::array<float,2>{0.247362688f, 0.564554989f},
-std::array<float,2>{0.873878419f, 0.892535746f},
-std::array<float,2>{0.474221945f, 0.398940712f},
-std::array<float,2>{0.712480187f, 0.440076292f},
-std::array<float,2>{0.0645480677f, 0.978169024f},
-std::array<float,2>{0.961194456f, 0.538459659f},
-std::array<float,2>{0.314738214f, 0.0608263128f},
-std::array<float,2>{0.763402879f, 0.244846553f},
-std::array<float,2>{0.404845238f, 0.731415987f},
-std::array<float,2>{0.506172121f, 0.801798046f},
-std::array<float,2>{0.150818482f, 0.281443566f},
-std::array<float,2>{0.88091898f, 0.398035794f},
-std::array<float,2>{0.258438498f, 0.903546691f},
-std::array<float,2>{0.66895318f, 0.576259136f},
-std::array<float,2>{0.0206803232f, 0.0974393338f},
-std::array<float,2>{0.591129065f, 0.171291813f},
-std::array<float,2>{0.207806244f, 0.649779797f},
-std::array<float,2>{0.842358112f, 0.822660565f},
-std::array<float,2>{0.447603613f, 0.368970394f},
-std::array<float,2>{0.735188782f, 0.291297317f},
-std::array<float,2>{0.096880123f, 0.809514284f},
-std::array<float,2>{0.99073869f, 0.722293258f},
-std::array<float,2>{0.367733151f, 0.239534989f},
-std::array<float,2>{0.804308891f, 0.0490049236f},
-std::array<float,2>{0.420888096f, 0.540647864f},
-std::array<float,2>{0.535208344f, 0.972568154f},
-std::array<float,2>{0.180907458f, 0.45285663f},
-std::array<float,2>{0.86365658f, 0.335876316f},
-std::array<float,2>{0.483093441f, 0.847741663f},
-std::array<float,2>{0.597979307f, 0.678510487f},
-std::array<float,2>{0.237724185f, 0.137308478f},
-std::array<float,2>{0.655544043f, 0.0678267851f},
-std::array<float,2>{0.0515285805f, 0.622021139f},
-std::array<float,2>{0.934871376f, 0.935886681f},
-std::array<float,2>{0.307697058f, 0.416511834f},
-std::array<float,2>{0.509726942f, 0.484704047f},
-std::array<float,2>{0.141555667f, 0.966313362f},
-std::array<float,2>{0.753881693f, 0.510623276f},
-std::array<float,2>{0.391251981f, 0.030297704f},
-std::array<float,2>{0.957441986f, 0.188527435f},
-std::array<float,2>{0.323059231f, 0.71071732f},
-std::array<float,2>{0.709925771f, 0.760601759f},
-std::array<float,2>{0.0711039454f, 0.271860152f},
-std::array<float,2>{0.766249061f, 0.4602364f},
-std::array<float,2>{0.38798368f, 0.990199089f},
-std::array<float,2>{0.525185764f, 0.554691195f},
-std::array<float,2>{0.125394523f, 0.0375877395f},
-std::array<float,2>{0.693890452f, 0.219584629f},
-std::array<float,2>{0.0918907076f, 0.738313138f},
-std::array<float,2>{0.952317595f, 0.792645216f},
-std::array<float,2>{0.339409828f, 0.30718857f},
-std::array<float,2>{0.624645293f, 0.357321948f},
-std::array<float,2>{0.233916417f, 0.836223841f},
-std::array<float,2>{0.856879354f, 0.637978911f},
-std::array<float,2>{0.487784356f, 0.18150188f},
-std::array<float,2>{0.914025962f, 0.121149726f},
-std::array<float,2>{0.293106019f, 0.57828325f},
-std::array<float,2>{0.63811934f, 0.88207972f},
-std::array<float,2>{0.0435686819f, 0.381295145f},
-std::array<float,2>{0.974116623f, 0.252102107f},
-std::array<float,2>{0.348918587f, 0.772996068f},
-std::array<float,2>{0.719163239f, 0.691845894f},
-std::array<float,2>{0.113492303f, 0.218582153f},
-std::array<float,2>{0.559618711f, 0.00505351601f},
-std::array<float,2>{0.164832518f, 0.523789227f},
-std::array<float,2>{0.791162252f, 0.951424181f},
-std::array<float,2>{0.432177991f, 0.483989149f},
-std::array<float,2>{0.678802788f, 0.434125096f},
-std::array<float,2>{0.0118073653f, 0.907747209f},
-std::array<float,2>{0.90203613f, 0.606621623f},
-std::array<float,2>{0.279895902f, 0.0899103731f},
-std::array<float,2>{0.819237411f, 0.154106215f},
-std::array<float,2>{0.463165909f, 0.662997127f},
-std::array<float,2>{0.571764708f, 0.863185644f},
-std::array<float,2>{0.188957572f, 0.325942725f}}
\ No newline at end of file
@@ -1,4096 +0,0 @@
-{std::array<float,2>{0.851762176f, 0.242912963f},
-std::array<float,2>{0.0189151876f, 0.583567142f},
-std::array<float,2>{0.586672366f, 0.822652221f},
-std::array<float,2>{0.317403942f, 0.287942767f},
-std::array<float,2>{0.641213417f, 0.477225155f},
-std::array<float,2>{0.376854837f, 0.91896981f},
-std::array<float,2>{0.894877493f, 0.699936688f},
-std::array<float,2>{0.202788725f, 0.123629458f},
-std::array<float,2>{0.535144448f, 0.0469682813f},
-std::array<float,2>{0.250366569f, 0.662215114f},
-std::array<float,2>{0.802982569f, 0.999714255f},
-std::array<float,2>{0.0717395693f, 0.386831522f},
-std::array<float,2>{0.964071751f, 0.354110628f},
-std::array<float,2>{0.168421656f, 0.790410995f},
-std::array<float,2>{0.728505552f, 0.533102632f},
-std::array<float,2>{0.493845671f, 0.169475421f},
-std::array<float,2>{0.909684241f, 0.0649126843f},
-std::array<float,2>{0.242347494f, 0.727978647f},
-std::array<float,2>{0.660759568f, 0.901248515f},
-std::array<float,2>{0.430059195f, 0.447237223f},
-std::array<float,2>{0.617032111f, 0.277634501f},
-std::array<float,2>{0.367767125f, 0.845734656f},
-std::array<float,2>{0.836976945f, 0.602713287f},
-std::array<float,2>{0.0426263027f, 0.196959198f},
-std::array<float,2>{0.715255916f, 0.127964079f},
-std::array<float,2>{0.44836697f, 0.520467639f},
-std::array<float,2>{0.970249653f, 0.758243382f},
-std::array<float,2>{0.135680437f, 0.342105061f},
-std::array<float,2>{0.77036041f, 0.410111725f},
-std::array<float,2>{0.10643889f, 0.94312501f},
-std::array<float,2>{0.523565829f, 0.643039465f},
-std::array<float,2>{0.292363495f, 0.0217799414f},
-std::array<float,2>{0.99982053f, 0.182968989f},
-std::array<float,2>{0.146607623f, 0.552706182f},
-std::array<float,2>{0.693866014f, 0.81096375f},
-std::array<float,2>{0.453125656f, 0.370162666f},
-std::array<float,2>{0.504538894f, 0.404485077f},
-std::array<float,2>{0.308032632f, 0.981238365f},
-std::array<float,2>{0.759404361f, 0.671949804f},
-std::array<float,2>{0.122839414f, 0.0349902846f},
-std::array<float,2>{0.672454059f, 0.10499081f},
-std::array<float,2>{0.416149974f, 0.714672625f},
-std::array<float,2>{0.922768891f, 0.936900616f},
-std::array<float,2>{0.226716325f, 0.48536852f},
-std::array<float,2>{0.826358557f, 0.297013253f},
-std::array<float,2>{0.0617478043f, 0.839616239f},
-std::array<float,2>{0.599202037f, 0.577909887f},
-std::array<float,2>{0.35278064f, 0.222994253f},
-std::array<float,2>{0.790931463f, 0.0103363842f},
-std::array<float,2>{0.0849121064f, 0.630810738f},
-std::array<float,2>{0.559073985f, 0.960782349f},
-std::array<float,2>{0.280203789f, 0.437108696f},
-std::array<float,2>{0.734823108f, 0.320717037f},
-std::array<float,2>{0.472421795f, 0.770243466f},
-std::array<float,2>{0.950122058f, 0.509329736f},
-std::array<float,2>{0.181454018f, 0.149896353f},
-std::array<float,2>{0.565583408f, 0.205021143f},
-std::array<float,2>{0.342660874f, 0.62470746f},
-std::array<float,2>{0.874040604f, 0.869116664f},
-std::array<float,2>{0.0124264052f, 0.250264764f},
-std::array<float,2>{0.879380405f, 0.467861712f},
-std::array<float,2>{0.205661267f, 0.889709592f},
-std::array<float,2>{0.635288656f, 0.740066648f},
-std::array<float,2>{0.395144224f, 0.0805250332f},
-std::array<float,2>{0.757550836f, 0.142444149f},
-std::array<float,2>{0.116679229f, 0.504116833f},
-std::array<float,2>{0.509382606f, 0.775639474f},
-std::array<float,2>{0.30040729f, 0.317315519f},
-std::array<float,2>{0.695904851f, 0.426050037f},
-std::array<float,2>{0.468039274f, 0.963802814f},
-std::array<float,2>{0.989610255f, 0.634123087f},
-std::array<float,2>{0.151657239f, 0.00256033661f},
-std::array<float,2>{0.607752562f, 0.0897688419f},
-std::array<float,2>{0.348367065f, 0.743393838f},
-std::array<float,2>{0.816608727f, 0.876736283f},
-std::array<float,2>{0.0505314432f, 0.458548993f},
-std::array<float,2>{0.932808757f, 0.257941812f},
-std::array<float,2>{0.224968106f, 0.860762596f},
-std::array<float,2>{0.686690867f, 0.609707177f},
-std::array<float,2>{0.407481253f, 0.218625367f},
-std::array<float,2>{0.944174886f, 0.0425546095f},
-std::array<float,2>{0.179160357f, 0.68220073f},
-std::array<float,2>{0.743476033f, 0.969281733f},
-std::array<float,2>{0.481029421f, 0.394450933f},
-std::array<float,2>{0.550222754f, 0.361753941f},
-std::array<float,2>{0.270716012f, 0.802944362f},
-std::array<float,2>{0.788099885f, 0.558009386f},
-std::array<float,2>{0.0874948949f, 0.177851066f},
-std::array<float,2>{0.625084639f, 0.228324115f},
-std::array<float,2>{0.404394597f, 0.563278854f},
-std::array<float,2>{0.888026237f, 0.831709504f},
-std::array<float,2>{0.216171578f, 0.310918599f},
-std::array<float,2>{0.862072885f, 0.493934125f},
-std::array<float,2>{0.00713809719f, 0.923346162f},
-std::array<float,2>{0.571799219f, 0.710199416f},
-std::array<float,2>{0.33155781f, 0.0955186114f},
-std::array<float,2>{0.904114366f, 0.190835297f},
-std::array<float,2>{0.193557426f, 0.600699604f},
-std::array<float,2>{0.655726612f, 0.856940091f},
-std::array<float,2>{0.387155652f, 0.265719801f},
-std::array<float,2>{0.583110869f, 0.439483166f},
-std::array<float,2>{0.324216038f, 0.894372642f},
-std::array<float,2>{0.850339472f, 0.720794201f},
-std::array<float,2>{0.0249575563f, 0.0711599886f},
-std::array<float,2>{0.721625447f, 0.0243428219f},
-std::array<float,2>{0.48967427f, 0.65482223f},
-std::array<float,2>{0.955746353f, 0.948394179f},
-std::array<float,2>{0.163590237f, 0.416488796f},
-std::array<float,2>{0.80700779f, 0.334415942f},
-std::array<float,2>{0.0669443682f, 0.754598558f},
-std::array<float,2>{0.540543199f, 0.527286828f},
-std::array<float,2>{0.262706906f, 0.133332148f},
-std::array<float,2>{0.831881762f, 0.112659447f},
-std::array<float,2>{0.0370827541f, 0.691781521f},
-std::array<float,2>{0.618764639f, 0.907386899f},
-std::array<float,2>{0.362769455f, 0.469033569f},
-std::array<float,2>{0.665195405f, 0.295096099f},
-std::array<float,2>{0.427421898f, 0.815274954f},
-std::array<float,2>{0.915753663f, 0.591419101f},
-std::array<float,2>{0.237930775f, 0.240056962f},
-std::array<float,2>{0.516559184f, 0.161146075f},
-std::array<float,2>{0.284565449f, 0.546851695f},
-std::array<float,2>{0.777462304f, 0.78451103f},
-std::array<float,2>{0.0951477513f, 0.345744401f},
-std::array<float,2>{0.981871963f, 0.376417786f},
-std::array<float,2>{0.129094556f, 0.987343431f},
-std::array<float,2>{0.703926265f, 0.664715052f},
-std::array<float,2>{0.440613776f, 0.0588871911f},
-std::array<float,2>{0.800030112f, 0.213540629f},
-std::array<float,2>{0.0772738755f, 0.613853395f},
-std::array<float,2>{0.53742522f, 0.864011467f},
-std::array<float,2>{0.254770905f, 0.264777631f},
-std::array<float,2>{0.732643902f, 0.455507159f},
-std::array<float,2>{0.49776268f, 0.881793618f},
-std::array<float,2>{0.967665136f, 0.749769211f},
-std::array<float,2>{0.165171459f, 0.0901647732f},
-std::array<float,2>{0.591198266f, 0.00401413767f},
-std::array<float,2>{0.313116878f, 0.639312267f},
-std::array<float,2>{0.856885016f, 0.967938721f},
-std::array<float,2>{0.0202127527f, 0.424235314f},
-std::array<float,2>{0.892989993f, 0.313930988f},
-std::array<float,2>{0.195987001f, 0.780271828f},
-std::array<float,2>{0.647412658f, 0.502184451f},
-std::array<float,2>{0.380916297f, 0.145831987f},
-std::array<float,2>{0.975019872f, 0.0993216336f},
-std::array<float,2>{0.140485704f, 0.70342499f},
-std::array<float,2>{0.714212358f, 0.92900914f},
-std::array<float,2>{0.450777352f, 0.496450722f},
-std::array<float,2>{0.529283762f, 0.306207031f},
-std::array<float,2>{0.294480711f, 0.833315253f},
-std::array<float,2>{0.766991496f, 0.566595137f},
-std::array<float,2>{0.10483095f, 0.233366489f},
-std::array<float,2>{0.659102082f, 0.174328759f},
-std::array<float,2>{0.43674475f, 0.558708966f},
-std::array<float,2>{0.913354933f, 0.797098458f},
-std::array<float,2>{0.247970894f, 0.366242826f},
-std::array<float,2>{0.840756357f, 0.395112634f},
-std::array<float,2>{0.0452130511f, 0.974767864f},
-std::array<float,2>{0.61257863f, 0.6865502f},
-std::array<float,2>{0.374745548f, 0.0436800011f},
-std::array<float,2>{0.927186668f, 0.136900172f},
-std::array<float,2>{0.231622145f, 0.530329466f},
-std::array<float,2>{0.67752701f, 0.753053844f},
-std::array<float,2>{0.420492619f, 0.331356883f},
-std::array<float,2>{0.59416908f, 0.418037355f},
-std::array<float,2>{0.356469482f, 0.952692211f},
-std::array<float,2>{0.822288513f, 0.651160002f},
-std::array<float,2>{0.0579171479f, 0.0279348195f},
-std::array<float,2>{0.689735591f, 0.0778366998f},
-std::array<float,2>{0.457729638f, 0.725779831f},
-std::array<float,2>{0.995319784f, 0.898091197f},
-std::array<float,2>{0.143116474f, 0.445223778f},
-std::array<float,2>{0.762176275f, 0.269874424f},
-std::array<float,2>{0.119684279f, 0.851725399f},
-std::array<float,2>{0.501616776f, 0.59618634f},
-std::array<float,2>{0.309775144f, 0.194473475f},
-std::array<float,2>{0.867235363f, 0.0563820638f},
-std::array<float,2>{0.00952011626f, 0.671796918f},
-std::array<float,2>{0.568369269f, 0.988693953f},
-std::array<float,2>{0.336097658f, 0.38224569f},
-std::array<float,2>{0.63715446f, 0.348387241f},
-std::array<float,2>{0.390770316f, 0.786926746f},
-std::array<float,2>{0.875946224f, 0.539974034f},
-std::array<float,2>{0.20820196f, 0.157250121f},
-std::array<float,2>{0.556821048f, 0.23702307f},
-std::array<float,2>{0.276594043f, 0.588610411f},
-std::array<float,2>{0.794890702f, 0.818593442f},
-std::array<float,2>{0.0802338868f, 0.291480601f},
-std::array<float,2>{0.949017286f, 0.475232899f},
-std::array<float,2>{0.18720457f, 0.913474977f},
-std::array<float,2>{0.742000222f, 0.688714623f},
-std::array<float,2>{0.474381685f, 0.113962404f},
-std::array<float,2>{0.813199043f, 0.167841658f},
-std::array<float,2>{0.0517070778f, 0.536839843f},
-std::array<float,2>{0.60223043f, 0.794670343f},
-std::array<float,2>{0.346584529f, 0.357124627f},
-std::array<float,2>{0.682509065f, 0.384734869f},
-std::array<float,2>{0.410524815f, 0.995662868f},
-std::array<float,2>{0.936433673f, 0.659178734f},
-std::array<float,2>{0.22185573f, 0.0536295921f},
-std::array<float,2>{0.515470743f, 0.117596924f},
-std::array<float,2>{0.303273886f, 0.695614934f},
-std::array<float,2>{0.751278102f, 0.915178299f},
-std::array<float,2>{0.110214651f, 0.482658833f},
-std::array<float,2>{0.985652328f, 0.28346163f},
-std::array<float,2>{0.15287675f, 0.826051533f},
-std::array<float,2>{0.700724602f, 0.579914868f},
-std::array<float,2>{0.464618832f, 0.249694049f},
-std::array<float,2>{0.885097921f, 0.0180803109f},
-std::array<float,2>{0.212510362f, 0.646815181f},
-std::array<float,2>{0.630026758f, 0.940924704f},
-std::array<float,2>{0.399683684f, 0.413278162f},
-std::array<float,2>{0.57575196f, 0.335985512f},
-std::array<float,2>{0.333445072f, 0.763171911f},
-std::array<float,2>{0.866222382f, 0.518685579f},
-std::array<float,2>{0.000346219749f, 0.130486608f},
-std::array<float,2>{0.748191118f, 0.200420678f},
-std::array<float,2>{0.477686524f, 0.606476009f},
-std::array<float,2>{0.939165652f, 0.849386752f},
-std::array<float,2>{0.173709989f, 0.276956737f},
-std::array<float,2>{0.783843756f, 0.450088859f},
-std::array<float,2>{0.0912945643f, 0.904488266f},
-std::array<float,2>{0.553556204f, 0.732531309f},
-std::array<float,2>{0.266586334f, 0.0684423596f},
-std::array<float,2>{0.957231522f, 0.221148744f},
-std::array<float,2>{0.156906709f, 0.57280004f},
-std::array<float,2>{0.726138532f, 0.840717554f},
-std::array<float,2>{0.486043751f, 0.301347166f},
-std::array<float,2>{0.543362379f, 0.489477664f},
-std::array<float,2>{0.261034757f, 0.932860494f},
-std::array<float,2>{0.809814572f, 0.717813849f},
-std::array<float,2>{0.0628641993f, 0.107471317f},
-std::array<float,2>{0.650454581f, 0.0380548723f},
-std::array<float,2>{0.386474818f, 0.679505348f},
-std::array<float,2>{0.899993062f, 0.977726936f},
-std::array<float,2>{0.191103816f, 0.39956218f},
-std::array<float,2>{0.845547676f, 0.372929007f},
-std::array<float,2>{0.0275745075f, 0.805828571f},
-std::array<float,2>{0.581175566f, 0.548665464f},
-std::array<float,2>{0.32810238f, 0.186697528f},
-std::array<float,2>{0.773815334f, 0.083209537f},
-std::array<float,2>{0.101154581f, 0.7378878f},
-std::array<float,2>{0.522072494f, 0.884925544f},
-std::array<float,2>{0.287006289f, 0.46415931f},
-std::array<float,2>{0.708343565f, 0.25754872f},
-std::array<float,2>{0.443252385f, 0.872258365f},
-std::array<float,2>{0.976989627f, 0.62070024f},
-std::array<float,2>{0.12833406f, 0.207876012f},
-std::array<float,2>{0.621251106f, 0.155872524f},
-std::array<float,2>{0.364759922f, 0.512218058f},
-std::array<float,2>{0.833780289f, 0.766834199f},
-std::array<float,2>{0.0340584442f, 0.325834692f},
-std::array<float,2>{0.919012487f, 0.43279177f},
-std::array<float,2>{0.241485596f, 0.955279052f},
-std::array<float,2>{0.670798063f, 0.626344323f},
-std::array<float,2>{0.424612463f, 0.0155025823f},
-std::array<float,2>{0.83934778f, 0.197704718f},
-std::array<float,2>{0.0402602702f, 0.604851484f},
-std::array<float,2>{0.614940584f, 0.843884289f},
-std::array<float,2>{0.370583177f, 0.280979604f},
-std::array<float,2>{0.663763165f, 0.447555959f},
-std::array<float,2>{0.432417691f, 0.898929477f},
-std::array<float,2>{0.908113658f, 0.729432285f},
-std::array<float,2>{0.245169371f, 0.0630054697f},
-std::array<float,2>{0.526016235f, 0.0202841219f},
-std::array<float,2>{0.290254444f, 0.641854346f},
-std::array<float,2>{0.772527456f, 0.94397974f},
-std::array<float,2>{0.109034345f, 0.406985581f},
-std::array<float,2>{0.971403778f, 0.340638757f},
-std::array<float,2>{0.133827448f, 0.761189401f},
-std::array<float,2>{0.718375325f, 0.522530258f},
-std::array<float,2>{0.446415424f, 0.126918346f},
-std::array<float,2>{0.897213042f, 0.122908674f},
-std::array<float,2>{0.200284839f, 0.702397108f},
-std::array<float,2>{0.644280851f, 0.920507908f},
-std::array<float,2>{0.378337413f, 0.478967458f},
-std::array<float,2>{0.588355482f, 0.286477864f},
-std::array<float,2>{0.319279015f, 0.820707023f},
-std::array<float,2>{0.853937268f, 0.584094822f},
-std::array<float,2>{0.0159825943f, 0.244388357f},
-std::array<float,2>{0.728957415f, 0.170580521f},
-std::array<float,2>{0.495022237f, 0.534330249f},
-std::array<float,2>{0.962454617f, 0.792167246f},
-std::array<float,2>{0.17135933f, 0.351565033f},
-std::array<float,2>{0.802259862f, 0.389718384f},
-std::array<float,2>{0.0724160671f, 0.997986138f},
-std::array<float,2>{0.533157468f, 0.661580384f},
-std::array<float,2>{0.253816962f, 0.0495630838f},
-std::array<float,2>{0.953092813f, 0.15185225f},
-std::array<float,2>{0.183254212f, 0.510004461f},
-std::array<float,2>{0.73797816f, 0.773254573f},
-std::array<float,2>{0.470662624f, 0.324031442f},
-std::array<float,2>{0.561922789f, 0.435281724f},
-std::array<float,2>{0.279177487f, 0.958810091f},
-std::array<float,2>{0.792117715f, 0.632159531f},
-std::array<float,2>{0.0827474073f, 0.00860997196f},
-std::array<float,2>{0.633668363f, 0.0794256181f},
-std::array<float,2>{0.397498161f, 0.741051197f},
-std::array<float,2>{0.88128829f, 0.888599038f},
-std::array<float,2>{0.204227105f, 0.465817541f},
-std::array<float,2>{0.871383429f, 0.253193796f},
-std::array<float,2>{0.0153526841f, 0.870973825f},
-std::array<float,2>{0.56364572f, 0.621889532f},
-std::array<float,2>{0.340753704f, 0.205805689f},
-std::array<float,2>{0.759984612f, 0.0329920501f},
-std::array<float,2>{0.124664836f, 0.675629497f},
-std::array<float,2>{0.507089794f, 0.982694268f},
-std::array<float,2>{0.305712074f, 0.404052198f},
-std::array<float,2>{0.693300664f, 0.367585272f},
-std::array<float,2>{0.455519289f, 0.809030771f},
-std::array<float,2>{0.997156918f, 0.553902626f},
-std::array<float,2>{0.144843385f, 0.180465072f},
-std::array<float,2>{0.600525439f, 0.224818319f},
-std::array<float,2>{0.355127454f, 0.57468009f},
-std::array<float,2>{0.824314117f, 0.837233961f},
-std::array<float,2>{0.060530033f, 0.300497681f},
-std::array<float,2>{0.924923956f, 0.487951458f},
-std::array<float,2>{0.229288235f, 0.935014367f},
-std::array<float,2>{0.674222291f, 0.711152673f},
-std::array<float,2>{0.415024132f, 0.101891994f},
-std::array<float,2>{0.785252512f, 0.177296698f},
-std::array<float,2>{0.0880350098f, 0.555774808f},
-std::array<float,2>{0.547881663f, 0.801289022f},
-std::array<float,2>{0.273254752f, 0.360242754f},
-std::array<float,2>{0.74462676f, 0.392070681f},
-std::array<float,2>{0.482536107f, 0.971895635f},
-std::array<float,2>{0.942322612f, 0.680352628f},
-std::array<float,2>{0.176916614f, 0.0401462317f},
-std::array<float,2>{0.572482467f, 0.0957422704f},
-std::array<float,2>{0.329506755f, 0.707336903f},
-std::array<float,2>{0.86004591f, 0.924517632f},
-std::array<float,2>{0.00443771994f, 0.495362967f},
-std::array<float,2>{0.890212178f, 0.30968532f},
-std::array<float,2>{0.218693599f, 0.830043912f},
-std::array<float,2>{0.628126979f, 0.565025032f},
-std::array<float,2>{0.402891517f, 0.229072481f},
-std::array<float,2>{0.990323246f, 0.000807955861f},
-std::array<float,2>{0.150295705f, 0.636079073f},
-std::array<float,2>{0.699163437f, 0.961643994f},
-std::array<float,2>{0.465921909f, 0.428800046f},
-std::array<float,2>{0.511054277f, 0.319817752f},
-std::array<float,2>{0.297558814f, 0.773720145f},
-std::array<float,2>{0.754792392f, 0.506105244f},
-std::array<float,2>{0.113463022f, 0.142614022f},
-std::array<float,2>{0.685328066f, 0.21587944f},
-std::array<float,2>{0.409447819f, 0.613270044f},
-std::array<float,2>{0.931400537f, 0.863221347f},
-std::array<float,2>{0.223604351f, 0.261274517f},
-std::array<float,2>{0.818420112f, 0.459332973f},
-std::array<float,2>{0.0480910093f, 0.878139913f},
-std::array<float,2>{0.606779397f, 0.746082187f},
-std::array<float,2>{0.350774378f, 0.0866832659f},
-std::array<float,2>{0.916935325f, 0.240330622f},
-std::array<float,2>{0.234734863f, 0.59210068f},
-std::array<float,2>{0.667776942f, 0.813509941f},
-std::array<float,2>{0.428164601f, 0.294552058f},
-std::array<float,2>{0.619358897f, 0.470856875f},
-std::array<float,2>{0.360026032f, 0.90840739f},
-std::array<float,2>{0.828600466f, 0.69356668f},
-std::array<float,2>{0.0386812687f, 0.111057587f},
-std::array<float,2>{0.707015395f, 0.0622152239f},
-std::array<float,2>{0.438141286f, 0.666173697f},
-std::array<float,2>{0.9839589f, 0.984690726f},
-std::array<float,2>{0.131986454f, 0.377989829f},
-std::array<float,2>{0.779502749f, 0.344587713f},
-std::array<float,2>{0.0972949192f, 0.782580078f},
-std::array<float,2>{0.518472195f, 0.543287933f},
-std::array<float,2>{0.282553703f, 0.162288815f},
-std::array<float,2>{0.84855634f, 0.0733664036f},
-std::array<float,2>{0.0259862933f, 0.720639348f},
-std::array<float,2>{0.585853338f, 0.890640736f},
-std::array<float,2>{0.321722895f, 0.437671095f},
-std::array<float,2>{0.653071404f, 0.269184709f},
-std::array<float,2>{0.390530527f, 0.857539058f},
-std::array<float,2>{0.905721962f, 0.599030972f},
-std::array<float,2>{0.192080274f, 0.188433081f},
-std::array<float,2>{0.542411327f, 0.136259004f},
-std::array<float,2>{0.26398325f, 0.523886621f},
-std::array<float,2>{0.806051314f, 0.757089257f},
-std::array<float,2>{0.0693322197f, 0.332681984f},
-std::array<float,2>{0.954548478f, 0.414819956f},
-std::array<float,2>{0.161676928f, 0.946305633f},
-std::array<float,2>{0.719564557f, 0.652563572f},
-std::array<float,2>{0.490294874f, 0.0268168915f},
-std::array<float,2>{0.767967939f, 0.231879801f},
-std::array<float,2>{0.103176489f, 0.568618536f},
-std::array<float,2>{0.531048715f, 0.835669577f},
-std::array<float,2>{0.295209378f, 0.308388919f},
-std::array<float,2>{0.711484909f, 0.498254657f},
-std::array<float,2>{0.45301953f, 0.927327871f},
-std::array<float,2>{0.973433554f, 0.705633044f},
-std::array<float,2>{0.138103813f, 0.100857213f},
-std::array<float,2>{0.610248208f, 0.045798555f},
-std::array<float,2>{0.371350318f, 0.68433398f},
-std::array<float,2>{0.842320621f, 0.972988784f},
-std::array<float,2>{0.044351384f, 0.398082405f},
-std::array<float,2>{0.911338389f, 0.36461705f},
-std::array<float,2>{0.248980477f, 0.799705744f},
-std::array<float,2>{0.656729221f, 0.560781598f},
-std::array<float,2>{0.433697581f, 0.173527226f},
-std::array<float,2>{0.966103792f, 0.0933209434f},
-std::array<float,2>{0.167788595f, 0.7477808f},
-std::array<float,2>{0.730481088f, 0.880029857f},
-std::array<float,2>{0.498617798f, 0.455022156f},
-std::array<float,2>{0.535672486f, 0.261874586f},
-std::array<float,2>{0.257646352f, 0.86548394f},
-std::array<float,2>{0.797106326f, 0.616357327f},
-std::array<float,2>{0.0761389956f, 0.211253449f},
-std::array<float,2>{0.645955682f, 0.146767408f},
-std::array<float,2>{0.380815655f, 0.501937389f},
-std::array<float,2>{0.891137064f, 0.77766186f},
-std::array<float,2>{0.197534382f, 0.315729737f},
-std::array<float,2>{0.858553886f, 0.422575057f},
-std::array<float,2>{0.0218445472f, 0.965212345f},
-std::array<float,2>{0.59306401f, 0.636885047f},
-std::array<float,2>{0.315368056f, 0.00761599699f},
-std::array<float,2>{0.87889564f, 0.159669638f},
-std::array<float,2>{0.210033566f, 0.542186618f},
-std::array<float,2>{0.638986945f, 0.787279785f},
-std::array<float,2>{0.394255847f, 0.350418895f},
-std::array<float,2>{0.568142712f, 0.379078954f},
-std::array<float,2>{0.339287519f, 0.990994036f},
-std::array<float,2>{0.870022833f, 0.668696344f},
-std::array<float,2>{0.0114411516f, 0.0571709052f},
-std::array<float,2>{0.739103973f, 0.116092958f},
-std::array<float,2>{0.474955827f, 0.690060258f},
-std::array<float,2>{0.947021365f, 0.911401212f},
-std::array<float,2>{0.184232771f, 0.473608255f},
-std::array<float,2>{0.79641974f, 0.290819079f},
-std::array<float,2>{0.0798959211f, 0.81666249f},
-std::array<float,2>{0.554876745f, 0.586194277f},
-std::array<float,2>{0.274851114f, 0.236285597f},
-std::array<float,2>{0.821004391f, 0.029642906f},
-std::array<float,2>{0.05584554f, 0.649535179f},
-std::array<float,2>{0.596414566f, 0.949358523f},
-std::array<float,2>{0.3593027f, 0.420000732f},
-std::array<float,2>{0.678978205f, 0.328773379f},
-std::array<float,2>{0.419840753f, 0.750608981f},
-std::array<float,2>{0.927836716f, 0.528186619f},
-std::array<float,2>{0.234277457f, 0.139123112f},
-std::array<float,2>{0.502624273f, 0.192059994f},
-std::array<float,2>{0.311853081f, 0.594264627f},
-std::array<float,2>{0.765182972f, 0.855050981f},
-std::array<float,2>{0.118751794f, 0.272390872f},
-std::array<float,2>{0.993895233f, 0.442309737f},
-std::array<float,2>{0.141426072f, 0.89632833f},
-std::array<float,2>{0.689027488f, 0.724478185f},
-std::array<float,2>{0.460443497f, 0.0746916384f},
-std::array<float,2>{0.864645898f, 0.132405862f},
-std::array<float,2>{0.0020739343f, 0.516616166f},
-std::array<float,2>{0.57794708f, 0.764330089f},
-std::array<float,2>{0.334063023f, 0.339837968f},
-std::array<float,2>{0.63149929f, 0.411628842f},
-std::array<float,2>{0.402303457f, 0.939248383f},
-std::array<float,2>{0.883771837f, 0.64604193f},
-std::array<float,2>{0.214442179f, 0.0157311168f},
-std::array<float,2>{0.551842332f, 0.0665910691f},
-std::array<float,2>{0.268177032f, 0.731599867f},
-std::array<float,2>{0.78131938f, 0.903462589f},
-std::array<float,2>{0.0926298201f, 0.45223707f},
-std::array<float,2>{0.941066921f, 0.27439037f},
-std::array<float,2>{0.174337074f, 0.850052834f},
-std::array<float,2>{0.747573316f, 0.608850062f},
-std::array<float,2>{0.478868335f, 0.202948853f},
-std::array<float,2>{0.933991075f, 0.0508270748f},
-std::array<float,2>{0.219725117f, 0.657684028f},
-std::array<float,2>{0.680653274f, 0.992701411f},
-std::array<float,2>{0.413915485f, 0.385518789f},
-std::array<float,2>{0.60413295f, 0.35910517f},
-std::array<float,2>{0.345641524f, 0.796334922f},
-std::array<float,2>{0.815866292f, 0.538225591f},
-std::array<float,2>{0.0527961589f, 0.165141016f},
-std::array<float,2>{0.701492727f, 0.246540099f},
-std::array<float,2>{0.461091578f, 0.580570102f},
-std::array<float,2>{0.98785454f, 0.827702999f},
-std::array<float,2>{0.155137569f, 0.281827092f},
-std::array<float,2>{0.752094924f, 0.480984658f},
-std::array<float,2>{0.112119727f, 0.917399824f},
-std::array<float,2>{0.512940645f, 0.697921038f},
-std::array<float,2>{0.302399486f, 0.119426362f},
-std::array<float,2>{0.979677498f, 0.210045755f},
-std::array<float,2>{0.125109121f, 0.618136585f},
-std::array<float,2>{0.70911783f, 0.87340337f},
-std::array<float,2>{0.444789588f, 0.25394091f},
-std::array<float,2>{0.519690871f, 0.461098105f},
-std::array<float,2>{0.28814137f, 0.883401692f},
-std::array<float,2>{0.775577247f, 0.735359788f},
-std::array<float,2>{0.0984226391f, 0.0842599869f},
-std::array<float,2>{0.668014824f, 0.0118068662f},
-std::array<float,2>{0.422608465f, 0.627030253f},
-std::array<float,2>{0.920613885f, 0.954404175f},
-std::array<float,2>{0.239489809f, 0.431608528f},
-std::array<float,2>{0.834657967f, 0.326204985f},
-std::array<float,2>{0.0330745988f, 0.769056618f},
-std::array<float,2>{0.623160183f, 0.514662862f},
-std::array<float,2>{0.365950435f, 0.152470931f},
-std::array<float,2>{0.810562551f, 0.107179925f},
-std::array<float,2>{0.064469628f, 0.716735601f},
-std::array<float,2>{0.54624182f, 0.929837525f},
-std::array<float,2>{0.258867741f, 0.490406334f},
-std::array<float,2>{0.724350393f, 0.302760035f},
-std::array<float,2>{0.486802816f, 0.842032611f},
-std::array<float,2>{0.96042031f, 0.570578039f},
-std::array<float,2>{0.159309998f, 0.220199838f},
-std::array<float,2>{0.578341901f, 0.184039727f},
-std::array<float,2>{0.326085687f, 0.548890114f},
-std::array<float,2>{0.845886171f, 0.808067441f},
-std::array<float,2>{0.0299286209f, 0.374295205f},
-std::array<float,2>{0.902034819f, 0.400579244f},
-std::array<float,2>{0.189419106f, 0.978561699f},
-std::array<float,2>{0.649938345f, 0.677689672f},
-std::array<float,2>{0.383840501f, 0.0360144638f},
-std::array<float,2>{0.873250544f, 0.207030013f},
-std::array<float,2>{0.0134397745f, 0.622904301f},
-std::array<float,2>{0.565059125f, 0.869464874f},
-std::array<float,2>{0.343589664f, 0.252614796f},
-std::array<float,2>{0.636545181f, 0.466382325f},
-std::array<float,2>{0.396395922f, 0.886777699f},
-std::array<float,2>{0.880088329f, 0.741568446f},
-std::array<float,2>{0.206831962f, 0.0787734538f},
-std::array<float,2>{0.559603691f, 0.00882129557f},
-std::array<float,2>{0.2808972f, 0.631420493f},
-std::array<float,2>{0.789331913f, 0.958003104f},
-std::array<float,2>{0.085830003f, 0.433995783f},
-std::array<float,2>{0.950690687f, 0.323054969f},
-std::array<float,2>{0.18015565f, 0.77178061f},
-std::array<float,2>{0.735736012f, 0.511706471f},
-std::array<float,2>{0.471669734f, 0.150404632f},
-std::array<float,2>{0.92318213f, 0.103314675f},
-std::array<float,2>{0.227654546f, 0.712334514f},
-std::array<float,2>{0.673317254f, 0.934239388f},
-std::array<float,2>{0.417934418f, 0.486855984f},
-std::array<float,2>{0.597747028f, 0.299421489f},
-std::array<float,2>{0.351664603f, 0.836054504f},
-std::array<float,2>{0.82793802f, 0.575674415f},
-std::array<float,2>{0.0606113188f, 0.22609514f},
-std::array<float,2>{0.694911838f, 0.181137398f},
-std::array<float,2>{0.454782128f, 0.553079963f},
-std::array<float,2>{0.998321354f, 0.810022533f},
-std::array<float,2>{0.147942945f, 0.368257344f},
-std::array<float,2>{0.758603096f, 0.402907938f},
-std::array<float,2>{0.121226743f, 0.983677566f},
-std::array<float,2>{0.505352199f, 0.674698532f},
-std::array<float,2>{0.306997925f, 0.0318172835f},
-std::array<float,2>{0.969543815f, 0.125421166f},
-std::array<float,2>{0.136144593f, 0.522301435f},
-std::array<float,2>{0.71614641f, 0.760074019f},
-std::array<float,2>{0.447981596f, 0.341773868f},
-std::array<float,2>{0.524500966f, 0.407716781f},
-std::array<float,2>{0.291674554f, 0.944478929f},
-std::array<float,2>{0.770807028f, 0.641041696f},
-std::array<float,2>{0.1067928f, 0.0210144855f},
-std::array<float,2>{0.661411643f, 0.0637485534f},
-std::array<float,2>{0.43139115f, 0.730276108f},
-std::array<float,2>{0.909071028f, 0.900249362f},
-std::array<float,2>{0.243614525f, 0.448583484f},
-std::array<float,2>{0.835938096f, 0.280266404f},
-std::array<float,2>{0.041911073f, 0.845153689f},
-std::array<float,2>{0.616202593f, 0.603718579f},
-std::array<float,2>{0.369104743f, 0.198677629f},
-std::array<float,2>{0.804311574f, 0.0506110266f},
-std::array<float,2>{0.0705328435f, 0.660488486f},
-std::array<float,2>{0.533279061f, 0.996175468f},
-std::array<float,2>{0.2517941f, 0.388725996f},
-std::array<float,2>{0.727520645f, 0.353097886f},
-std::array<float,2>{0.49229154f, 0.791292369f},
-std::array<float,2>{0.963697731f, 0.534086764f},
-std::array<float,2>{0.169371501f, 0.17135343f},
-std::array<float,2>{0.586969316f, 0.246093556f},
-std::array<float,2>{0.317295462f, 0.585409164f},
-std::array<float,2>{0.852681756f, 0.822020233f},
-std::array<float,2>{0.0185325854f, 0.285776287f},
-std::array<float,2>{0.896322906f, 0.480202645f},
-std::array<float,2>{0.201801121f, 0.921156466f},
-std::array<float,2>{0.642558634f, 0.701434076f},
-std::array<float,2>{0.375286013f, 0.12190982f},
-std::array<float,2>{0.778986752f, 0.163400322f},
-std::array<float,2>{0.0940841958f, 0.544756949f},
-std::array<float,2>{0.51700151f, 0.781543434f},
-std::array<float,2>{0.284024596f, 0.345168352f},
-std::array<float,2>{0.704757273f, 0.377400249f},
-std::array<float,2>{0.440236658f, 0.985598385f},
-std::array<float,2>{0.980810225f, 0.667632222f},
-std::array<float,2>{0.130093649f, 0.0609087497f},
-std::array<float,2>{0.617890298f, 0.109825142f},
-std::array<float,2>{0.361731857f, 0.694748938f},
-std::array<float,2>{0.830173969f, 0.909702837f},
-std::array<float,2>{0.0358002f, 0.472549498f},
-std::array<float,2>{0.914983213f, 0.293784589f},
-std::array<float,2>{0.236890823f, 0.813398302f},
-std::array<float,2>{0.664985955f, 0.592805028f},
-std::array<float,2>{0.42658487f, 0.24178797f},
-std::array<float,2>{0.956873536f, 0.0261496063f},
-std::array<float,2>{0.162817195f, 0.653689265f},
-std::array<float,2>{0.722625732f, 0.945331812f},
-std::array<float,2>{0.488390118f, 0.415595025f},
-std::array<float,2>{0.539129019f, 0.333603382f},
-std::array<float,2>{0.26262483f, 0.756046951f},
-std::array<float,2>{0.807683945f, 0.525212586f},
-std::array<float,2>{0.0681314692f, 0.134871021f},
-std::array<float,2>{0.65431875f, 0.188566849f},
-std::array<float,2>{0.388028383f, 0.598131716f},
-std::array<float,2>{0.902543962f, 0.85891664f},
-std::array<float,2>{0.194653779f, 0.268211037f},
-std::array<float,2>{0.850661933f, 0.438830882f},
-std::array<float,2>{0.0242898315f, 0.892315269f},
-std::array<float,2>{0.582971275f, 0.718907595f},
-std::array<float,2>{0.3223961f, 0.0730155855f},
-std::array<float,2>{0.887051105f, 0.229667321f},
-std::array<float,2>{0.214970171f, 0.566054702f},
-std::array<float,2>{0.626053572f, 0.8290537f},
-std::array<float,2>{0.405848712f, 0.309191883f},
-std::array<float,2>{0.571052194f, 0.494543374f},
-std::array<float,2>{0.330397874f, 0.924922884f},
-std::array<float,2>{0.862393975f, 0.708197415f},
-std::array<float,2>{0.00641726842f, 0.0969224423f},
-std::array<float,2>{0.742631555f, 0.0391688347f},
-std::array<float,2>{0.481513619f, 0.68141216f},
-std::array<float,2>{0.945271134f, 0.971240222f},
-std::array<float,2>{0.178636715f, 0.391048461f},
-std::array<float,2>{0.787278354f, 0.361286551f},
-std::array<float,2>{0.0868062228f, 0.802161634f},
-std::array<float,2>{0.54927671f, 0.555146515f},
-std::array<float,2>{0.269871026f, 0.176406354f},
-std::array<float,2>{0.81809932f, 0.0869209394f},
-std::array<float,2>{0.0496479198f, 0.744390368f},
-std::array<float,2>{0.608536243f, 0.877731562f},
-std::array<float,2>{0.348659217f, 0.460465223f},
-std::array<float,2>{0.685942173f, 0.260074228f},
-std::array<float,2>{0.406430483f, 0.861428797f},
-std::array<float,2>{0.932235837f, 0.612066209f},
-std::array<float,2>{0.226109326f, 0.215491503f},
-std::array<float,2>{0.507870436f, 0.143592283f},
-std::array<float,2>{0.298886448f, 0.506960809f},
-std::array<float,2>{0.756631672f, 0.775145411f},
-std::array<float,2>{0.115888268f, 0.318504781f},
-std::array<float,2>{0.989051938f, 0.427752376f},
-std::array<float,2>{0.150728703f, 0.962684095f},
-std::array<float,2>{0.697089612f, 0.634993792f},
-std::array<float,2>{0.467376292f, 0.00150304055f},
-std::array<float,2>{0.7931844f, 0.234925464f},
-std::array<float,2>{0.0815189704f, 0.587775528f},
-std::array<float,2>{0.55798161f, 0.817951441f},
-std::array<float,2>{0.276008874f, 0.289820284f},
-std::array<float,2>{0.740315259f, 0.474363029f},
-std::array<float,2>{0.473535419f, 0.910379171f},
-std::array<float,2>{0.947891653f, 0.690767169f},
-std::array<float,2>{0.185783938f, 0.116632357f},
-std::array<float,2>{0.569525301f, 0.0584638715f},
-std::array<float,2>{0.337337136f, 0.6697824f},
-std::array<float,2>{0.868855298f, 0.991957188f},
-std::array<float,2>{0.00868762471f, 0.380082637f},
-std::array<float,2>{0.876877248f, 0.351368815f},
-std::array<float,2>{0.207341313f, 0.7890414f},
-std::array<float,2>{0.638417363f, 0.541729212f},
-std::array<float,2>{0.391696483f, 0.15915063f},
-std::array<float,2>{0.994918764f, 0.0755834505f},
-std::array<float,2>{0.143843979f, 0.722721636f},
-std::array<float,2>{0.690696001f, 0.89507854f},
-std::array<float,2>{0.45890066f, 0.44272989f},
-std::array<float,2>{0.500843644f, 0.273065209f},
-std::array<float,2>{0.308628976f, 0.853749096f},
-std::array<float,2>{0.763607442f, 0.595007002f},
-std::array<float,2>{0.12013685f, 0.19249393f},
-std::array<float,2>{0.676210165f, 0.140596807f},
-std::array<float,2>{0.421263009f, 0.528463304f},
-std::array<float,2>{0.925836623f, 0.75135684f},
-std::array<float,2>{0.230748564f, 0.329120904f},
-std::array<float,2>{0.82355994f, 0.421239972f},
-std::array<float,2>{0.0576102324f, 0.950823843f},
-std::array<float,2>{0.595321655f, 0.648804069f},
-std::array<float,2>{0.355674535f, 0.0308327023f},
-std::array<float,2>{0.912302554f, 0.172000751f},
-std::array<float,2>{0.246105239f, 0.561649323f},
-std::array<float,2>{0.659819245f, 0.800735176f},
-std::array<float,2>{0.436212957f, 0.364072919f},
-std::array<float,2>{0.611982524f, 0.397090077f},
-std::array<float,2>{0.373925447f, 0.97444123f},
-std::array<float,2>{0.84155637f, 0.684752882f},
-std::array<float,2>{0.0467637181f, 0.0460814461f},
-std::array<float,2>{0.713200569f, 0.100390948f},
-std::array<float,2>{0.449568897f, 0.706325531f},
-std::array<float,2>{0.976444006f, 0.926467836f},
-std::array<float,2>{0.139106855f, 0.499510467f},
-std::array<float,2>{0.766572058f, 0.307575315f},
-std::array<float,2>{0.104184739f, 0.834254503f},
-std::array<float,2>{0.52734673f, 0.569520772f},
-std::array<float,2>{0.293290913f, 0.231027946f},
-std::array<float,2>{0.855927408f, 0.00673650345f},
-std::array<float,2>{0.0208874289f, 0.638468444f},
-std::array<float,2>{0.58990705f, 0.966112375f},
-std::array<float,2>{0.314317733f, 0.42334339f},
-std::array<float,2>{0.647756994f, 0.314646393f},
-std::array<float,2>{0.38192746f, 0.778663278f},
-std::array<float,2>{0.893846512f, 0.500263989f},
-std::array<float,2>{0.196439087f, 0.14750044f},
-std::array<float,2>{0.538258433f, 0.212153867f},
-std::array<float,2>{0.255181462f, 0.615889966f},
-std::array<float,2>{0.799335003f, 0.866768181f},
-std::array<float,2>{0.0764257088f, 0.262898773f},
-std::array<float,2>{0.968205869f, 0.453964382f},
-std::array<float,2>{0.164928317f, 0.879003286f},
-std::array<float,2>{0.733728886f, 0.747067928f},
-std::array<float,2>{0.496985763f, 0.0920273736f},
-std::array<float,2>{0.83281821f, 0.154205337f},
-std::array<float,2>{0.0343307294f, 0.514257371f},
-std::array<float,2>{0.62217319f, 0.768367708f},
-std::array<float,2>{0.3638345f, 0.327809691f},
-std::array<float,2>{0.671274185f, 0.429715216f},
-std::array<float,2>{0.425637633f, 0.954086065f},
-std::array<float,2>{0.918026924f, 0.627993762f},
-std::array<float,2>{0.240682513f, 0.0127426209f},
-std::array<float,2>{0.523382306f, 0.0855968967f},
-std::array<float,2>{0.285331637f, 0.735313773f},
-std::array<float,2>{0.774539411f, 0.884492457f},
-std::array<float,2>{0.0996719003f, 0.462356865f},
-std::array<float,2>{0.978277206f, 0.255570829f},
-std::array<float,2>{0.127640054f, 0.874987721f},
-std::array<float,2>{0.707370579f, 0.618568718f},
-std::array<float,2>{0.441526979f, 0.209689125f},
-std::array<float,2>{0.898937404f, 0.0361413099f},
-std::array<float,2>{0.190250739f, 0.676514745f},
-std::array<float,2>{0.652027249f, 0.980090082f},
-std::array<float,2>{0.38534227f, 0.402302116f},
-std::array<float,2>{0.580545306f, 0.37309581f},
-std::array<float,2>{0.326967865f, 0.806907952f},
-std::array<float,2>{0.844002843f, 0.550049245f},
-std::array<float,2>{0.0292147156f, 0.185002863f},
-std::array<float,2>{0.72507143f, 0.219041541f},
-std::array<float,2>{0.484534889f, 0.571341455f},
-std::array<float,2>{0.958441317f, 0.843026638f},
-std::array<float,2>{0.157604367f, 0.304048896f},
-std::array<float,2>{0.808753669f, 0.491404772f},
-std::array<float,2>{0.0640430301f, 0.931105673f},
-std::array<float,2>{0.544365108f, 0.715799034f},
-std::array<float,2>{0.259893984f, 0.106026702f},
-std::array<float,2>{0.938410461f, 0.201704085f},
-std::array<float,2>{0.172353297f, 0.608320832f},
-std::array<float,2>{0.749917567f, 0.851118267f},
-std::array<float,2>{0.476932973f, 0.274849832f},
-std::array<float,2>{0.554277182f, 0.451897889f},
-std::array<float,2>{0.267399669f, 0.902863324f},
-std::array<float,2>{0.784771502f, 0.730860353f},
-std::array<float,2>{0.0903566033f, 0.0678896829f},
-std::array<float,2>{0.629146338f, 0.0172618814f},
-std::array<float,2>{0.398768991f, 0.645283878f},
-std::array<float,2>{0.886436939f, 0.938178122f},
-std::array<float,2>{0.211595178f, 0.410807729f},
-std::array<float,2>{0.865297914f, 0.338687688f},
-std::array<float,2>{0.00144544581f, 0.765350461f},
-std::array<float,2>{0.574461102f, 0.515652597f},
-std::array<float,2>{0.332114726f, 0.130957916f},
-std::array<float,2>{0.750331581f, 0.120710097f},
-std::array<float,2>{0.111296006f, 0.69889313f},
-std::array<float,2>{0.51390475f, 0.916766167f},
-std::array<float,2>{0.304090708f, 0.482093483f},
-std::array<float,2>{0.699256122f, 0.28288722f},
-std::array<float,2>{0.463464499f, 0.826985002f},
-std::array<float,2>{0.985276163f, 0.581879616f},
-std::array<float,2>{0.15366216f, 0.247261375f},
-std::array<float,2>{0.602910578f, 0.164447278f},
-std::array<float,2>{0.347551286f, 0.537567139f},
-std::array<float,2>{0.814384222f, 0.795156419f},
-std::array<float,2>{0.052163519f, 0.357606322f},
-std::array<float,2>{0.93686223f, 0.386707544f},
-std::array<float,2>{0.221371993f, 0.993857622f},
-std::array<float,2>{0.683452189f, 0.656576514f},
-std::array<float,2>{0.411384255f, 0.0521967188f},
-std::array<float,2>{0.825440407f, 0.223736793f},
-std::array<float,2>{0.0588941984f, 0.576864541f},
-std::array<float,2>{0.601025105f, 0.838818312f},
-std::array<float,2>{0.353687465f, 0.298069835f},
-std::array<float,2>{0.675198078f, 0.48482269f},
-std::array<float,2>{0.415419221f, 0.935669065f},
-std::array<float,2>{0.923927128f, 0.712892532f},
-std::array<float,2>{0.229691714f, 0.104232147f},
-std::array<float,2>{0.506788611f, 0.0340015404f},
-std::array<float,2>{0.305107385f, 0.67353034f},
-std::array<float,2>{0.761147201f, 0.981814027f},
-std::array<float,2>{0.123113602f, 0.406113923f},
-std::array<float,2>{0.996416867f, 0.369583547f},
-std::array<float,2>{0.145862743f, 0.811805665f},
-std::array<float,2>{0.692241013f, 0.551352143f},
-std::array<float,2>{0.456177741f, 0.182041705f},
-std::array<float,2>{0.882279873f, 0.081129998f},
-std::array<float,2>{0.203665167f, 0.7389974f},
-std::array<float,2>{0.633962631f, 0.889609337f},
-std::array<float,2>{0.396742135f, 0.467389494f},
-std::array<float,2>{0.563401103f, 0.251772195f},
-std::array<float,2>{0.340904117f, 0.867888153f},
-std::array<float,2>{0.872922003f, 0.623911321f},
-std::array<float,2>{0.0146468058f, 0.203703627f},
-std::array<float,2>{0.736499608f, 0.149271086f},
-std::array<float,2>{0.468918562f, 0.508752227f},
-std::array<float,2>{0.951462269f, 0.771026194f},
-std::array<float,2>{0.181757033f, 0.322164953f},
-std::array<float,2>{0.791147768f, 0.435603499f},
-std::array<float,2>{0.0830381364f, 0.959958136f},
-std::array<float,2>{0.560634553f, 0.629442811f},
-std::array<float,2>{0.277470291f, 0.0108378818f},
-std::array<float,2>{0.961357117f, 0.168326065f},
-std::array<float,2>{0.170372218f, 0.531843424f},
-std::array<float,2>{0.730131745f, 0.789727986f},
-std::array<float,2>{0.495909065f, 0.354967415f},
-std::array<float,2>{0.53148061f, 0.388042986f},
-std::array<float,2>{0.252731651f, 0.998767197f},
-std::array<float,2>{0.801183939f, 0.663590968f},
-std::array<float,2>{0.0735615417f, 0.0481244884f},
-std::array<float,2>{0.643411338f, 0.124228798f},
-std::array<float,2>{0.377503812f, 0.70026499f},
-std::array<float,2>{0.897684574f, 0.918714046f},
-std::array<float,2>{0.199452162f, 0.478158176f},
-std::array<float,2>{0.854932666f, 0.288240641f},
-std::array<float,2>{0.0172299389f, 0.823537469f},
-std::array<float,2>{0.588902831f, 0.582384408f},
-std::array<float,2>{0.319492966f, 0.243534788f},
-std::array<float,2>{0.771742284f, 0.0227967855f},
-std::array<float,2>{0.107968867f, 0.643667936f},
-std::array<float,2>{0.526493132f, 0.941891491f},
-std::array<float,2>{0.289467007f, 0.40858227f},
-std::array<float,2>{0.717011929f, 0.343550771f},
-std::array<float,2>{0.445673466f, 0.759181499f},
-std::array<float,2>{0.972122908f, 0.521172702f},
-std::array<float,2>{0.133069649f, 0.127905563f},
-std::array<float,2>{0.613982081f, 0.19558084f},
-std::array<float,2>{0.369622529f, 0.602144241f},
-std::array<float,2>{0.838326216f, 0.84741199f},
-std::array<float,2>{0.0393418111f, 0.278459758f},
-std::array<float,2>{0.907157183f, 0.445795745f},
-std::array<float,2>{0.244979784f, 0.901746929f},
-std::array<float,2>{0.662964463f, 0.727072299f},
-std::array<float,2>{0.432649821f, 0.0660677329f},
-std::array<float,2>{0.805216491f, 0.134393543f},
-std::array<float,2>{0.0701931417f, 0.526116967f},
-std::array<float,2>{0.54147321f, 0.755566001f},
-std::array<float,2>{0.264940351f, 0.335738361f},
-std::array<float,2>{0.720650017f, 0.417754561f},
-std::array<float,2>{0.491246641f, 0.947520733f},
-std::array<float,2>{0.953877628f, 0.655315518f},
-std::array<float,2>{0.161032155f, 0.0244611744f},
-std::array<float,2>{0.584289789f, 0.0717256442f},
-std::array<float,2>{0.320869923f, 0.722401202f},
-std::array<float,2>{0.848855913f, 0.893116295f},
-std::array<float,2>{0.0267241728f, 0.441220462f},
-std::array<float,2>{0.904981375f, 0.266788632f},
-std::array<float,2>{0.193317205f, 0.855966568f},
-std::array<float,2>{0.654028714f, 0.600009978f},
-std::array<float,2>{0.389147609f, 0.190006897f},
-std::array<float,2>{0.98262012f, 0.0604845472f},
-std::array<float,2>{0.130918309f, 0.66537863f},
-std::array<float,2>{0.705491722f, 0.98686713f},
-std::array<float,2>{0.439311326f, 0.375750124f},
-std::array<float,2>{0.518747866f, 0.34686029f},
-std::array<float,2>{0.281778842f, 0.783216059f},
-std::array<float,2>{0.780911148f, 0.54502511f},
-std::array<float,2>{0.0958710536f, 0.160599113f},
-std::array<float,2>{0.66610682f, 0.239222482f},
-std::array<float,2>{0.429449767f, 0.589888573f},
-std::array<float,2>{0.917673588f, 0.815552711f},
-std::array<float,2>{0.236064196f, 0.296180934f},
-std::array<float,2>{0.829454243f, 0.470293403f},
-std::array<float,2>{0.0373024493f, 0.906920791f},
-std::array<float,2>{0.621070921f, 0.692829072f},
-std::array<float,2>{0.360483646f, 0.112254865f},
-std::array<float,2>{0.93056953f, 0.21689494f},
-std::array<float,2>{0.224544927f, 0.611276925f},
-std::array<float,2>{0.683944404f, 0.859936893f},
-std::array<float,2>{0.409123451f, 0.258847952f},
-std::array<float,2>{0.606431067f, 0.457482725f},
-std::array<float,2>{0.350557327f, 0.875374079f},
-std::array<float,2>{0.819745958f, 0.742739975f},
-std::array<float,2>{0.0477711894f, 0.0885748714f},
-std::array<float,2>{0.697575033f, 0.00343032926f},
-std::array<float,2>{0.464923888f, 0.633752644f},
-std::array<float,2>{0.991845071f, 0.964088917f},
-std::array<float,2>{0.149285272f, 0.427460223f},
-std::array<float,2>{0.755601525f, 0.318315119f},
-std::array<float,2>{0.115192004f, 0.777074635f},
-std::array<float,2>{0.510255933f, 0.505817771f},
-std::array<float,2>{0.298649967f, 0.141573429f},
-std::array<float,2>{0.860571742f, 0.0939288288f},
-std::array<float,2>{0.00535451667f, 0.709085822f},
-std::array<float,2>{0.573364437f, 0.922790229f},
-std::array<float,2>{0.328467518f, 0.492561549f},
-std::array<float,2>{0.627898097f, 0.311656743f},
-std::array<float,2>{0.403741688f, 0.830171108f},
-std::array<float,2>{0.889282823f, 0.563830256f},
-std::array<float,2>{0.217564583f, 0.227511972f},
-std::array<float,2>{0.547035456f, 0.179572642f},
-std::array<float,2>{0.271763176f, 0.556959331f},
-std::array<float,2>{0.786420465f, 0.803826153f},
-std::array<float,2>{0.0895874575f, 0.363129407f},
-std::array<float,2>{0.942463875f, 0.392866731f},
-std::array<float,2>{0.176085934f, 0.970653772f},
-std::array<float,2>{0.746055365f, 0.682702661f},
-std::array<float,2>{0.483575284f, 0.0412843972f},
-std::array<float,2>{0.76422143f, 0.194227546f},
-std::array<float,2>{0.117872678f, 0.597648501f},
-std::array<float,2>{0.503134787f, 0.852986455f},
-std::array<float,2>{0.311160445f, 0.271073431f},
-std::array<float,2>{0.687894642f, 0.444139838f},
-std::array<float,2>{0.459665358f, 0.896597862f},
-std::array<float,2>{0.992801905f, 0.724882603f},
-std::array<float,2>{0.142185763f, 0.0769076794f},
-std::array<float,2>{0.597540796f, 0.0288348664f},
-std::array<float,2>{0.357433617f, 0.651846111f},
-std::array<float,2>{0.821488857f, 0.951284647f},
-std::array<float,2>{0.0556131117f, 0.419721752f},
-std::array<float,2>{0.929118991f, 0.330094784f},
-std::array<float,2>{0.232579842f, 0.752517223f},
-std::array<float,2>{0.678307176f, 0.529551506f},
-std::array<float,2>{0.418474257f, 0.137784049f},
-std::array<float,2>{0.946057022f, 0.114285782f},
-std::array<float,2>{0.184870228f, 0.68780005f},
-std::array<float,2>{0.739677072f, 0.912295938f},
-std::array<float,2>{0.475889891f, 0.475841582f},
-std::array<float,2>{0.556249976f, 0.292648524f},
-std::array<float,2>{0.27373293f, 0.819667459f},
-std::array<float,2>{0.795482397f, 0.588953853f},
-std::array<float,2>{0.0782941133f, 0.237857267f},
-std::array<float,2>{0.640381515f, 0.156796917f},
-std::array<float,2>{0.393059999f, 0.540159822f},
-std::array<float,2>{0.877268672f, 0.78605783f},
-std::array<float,2>{0.209719032f, 0.348734021f},
-std::array<float,2>{0.870941401f, 0.381167829f},
-std::array<float,2>{0.00983627699f, 0.989587963f},
-std::array<float,2>{0.566608727f, 0.670520425f},
-std::array<float,2>{0.338857412f, 0.0553944036f},
-std::array<float,2>{0.89235872f, 0.145175859f},
-std::array<float,2>{0.198314965f, 0.503688693f},
-std::array<float,2>{0.644628942f, 0.781148195f},
-std::array<float,2>{0.37909174f, 0.312784255f},
-std::array<float,2>{0.59197402f, 0.425426066f},
-std::array<float,2>{0.315504849f, 0.96689558f},
-std::array<float,2>{0.858284295f, 0.6398561f},
-std::array<float,2>{0.0228594225f, 0.00507661467f},
-std::array<float,2>{0.732057571f, 0.0914029106f},
-std::array<float,2>{0.499857455f, 0.748702884f},
-std::array<float,2>{0.964996815f, 0.882055163f},
-std::array<float,2>{0.166562587f, 0.45671019f},
-std::array<float,2>{0.798410356f, 0.264451325f},
-std::array<float,2>{0.0747495741f, 0.865084708f},
-std::array<float,2>{0.53708297f, 0.614848137f},
-std::array<float,2>{0.25676313f, 0.214646861f},
-std::array<float,2>{0.843144476f, 0.0441724993f},
-std::array<float,2>{0.04336318f, 0.686450243f},
-std::array<float,2>{0.610712707f, 0.976232827f},
-std::array<float,2>{0.373034477f, 0.396150738f},
-std::array<float,2>{0.657853544f, 0.365641266f},
-std::array<float,2>{0.435161233f, 0.797863066f},
-std::array<float,2>{0.911036074f, 0.560342848f},
-std::array<float,2>{0.249792457f, 0.174859583f},
-std::array<float,2>{0.530199766f, 0.233434185f},
-std::array<float,2>{0.296066493f, 0.568209291f},
-std::array<float,2>{0.768645406f, 0.832967818f},
-std::array<float,2>{0.102172017f, 0.305136144f},
-std::array<float,2>{0.973648787f, 0.497073144f},
-std::array<float,2>{0.137223616f, 0.927864969f},
-std::array<float,2>{0.712506831f, 0.704498053f},
-std::array<float,2>{0.451626152f, 0.0984164402f},
-std::array<float,2>{0.847441316f, 0.186026394f},
-std::array<float,2>{0.0302885137f, 0.547133386f},
-std::array<float,2>{0.579790056f, 0.805645347f},
-std::array<float,2>{0.324496925f, 0.371650547f},
-std::array<float,2>{0.649348497f, 0.399400026f},
-std::array<float,2>{0.383402586f, 0.976710856f},
-std::array<float,2>{0.900584936f, 0.677863479f},
-std::array<float,2>{0.18811886f, 0.0382307507f},
-std::array<float,2>{0.544971645f, 0.108693853f},
-std::array<float,2>{0.25862813f, 0.717693865f},
-std::array<float,2>{0.812194824f, 0.931952775f},
-std::array<float,2>{0.065959096f, 0.488839328f},
-std::array<float,2>{0.95993799f, 0.30207485f},
-std::array<float,2>{0.15859805f, 0.840837359f},
-std::array<float,2>{0.723200321f, 0.573852301f},
-std::array<float,2>{0.487647116f, 0.221886709f},
-std::array<float,2>{0.921360373f, 0.013995979f},
-std::array<float,2>{0.238662496f, 0.625861108f},
-std::array<float,2>{0.669433475f, 0.95677942f},
-std::array<float,2>{0.423341572f, 0.432012349f},
-std::array<float,2>{0.624196649f, 0.324784935f},
-std::array<float,2>{0.366907746f, 0.765900791f},
-std::array<float,2>{0.835683882f, 0.512704253f},
-std::array<float,2>{0.0314155333f, 0.154711366f},
-std::array<float,2>{0.710129023f, 0.208820045f},
-std::array<float,2>{0.444188386f, 0.619980812f},
-std::array<float,2>{0.978872359f, 0.871724129f},
-std::array<float,2>{0.126758963f, 0.256223887f},
-std::array<float,2>{0.777324915f, 0.463301122f},
-std::array<float,2>{0.0990195274f, 0.886448205f},
-std::array<float,2>{0.521012485f, 0.737197995f},
-std::array<float,2>{0.287714213f, 0.0827215239f},
-std::array<float,2>{0.987214088f, 0.248854652f},
-std::array<float,2>{0.155501842f, 0.578279495f},
-std::array<float,2>{0.702450037f, 0.824330449f},
-std::array<float,2>{0.461993992f, 0.285028368f},
-std::array<float,2>{0.512234271f, 0.483405173f},
-std::array<float,2>{0.301068604f, 0.914554656f},
-std::array<float,2>{0.753036916f, 0.69710201f},
-std::array<float,2>{0.11270038f, 0.118223555f},
-std::array<float,2>{0.681412935f, 0.0545981862f},
-std::array<float,2>{0.412510723f, 0.660154939f},
-std::array<float,2>{0.935215414f, 0.994974732f},
-std::array<float,2>{0.220615417f, 0.383054376f},
-std::array<float,2>{0.814806342f, 0.355720699f},
-std::array<float,2>{0.0542141385f, 0.793308437f},
-std::array<float,2>{0.604996324f, 0.535878122f},
-std::array<float,2>{0.344551474f, 0.166419342f},
-std::array<float,2>{0.782681942f, 0.0696967542f},
-std::array<float,2>{0.0931570455f, 0.733573973f},
-std::array<float,2>{0.551034868f, 0.905780494f},
-std::array<float,2>{0.26935789f, 0.450281143f},
-std::array<float,2>{0.74698478f, 0.275962234f},
-std::array<float,2>{0.480378419f, 0.848534167f},
-std::array<float,2>{0.940305412f, 0.606345832f},
-std::array<float,2>{0.175403073f, 0.199273095f},
-std::array<float,2>{0.576248884f, 0.129486397f},
-std::array<float,2>{0.335695952f, 0.518516481f},
-std::array<float,2>{0.863665104f, 0.762275517f},
-std::array<float,2>{0.00298351352f, 0.336926699f},
-std::array<float,2>{0.883802235f, 0.412359565f},
-std::array<float,2>{0.21309112f, 0.939872622f},
-std::array<float,2>{0.631988049f, 0.647532046f},
-std::array<float,2>{0.401029885f, 0.0190129876f},
-std::array<float,2>{0.863259494f, 0.226608783f},
-std::array<float,2>{0.00615504198f, 0.56422919f},
-std::array<float,2>{0.570497751f, 0.830779493f},
-std::array<float,2>{0.330596566f, 0.312110066f},
-std::array<float,2>{0.62648803f, 0.493153393f},
-std::array<float,2>{0.405570716f, 0.922345698f},
-std::array<float,2>{0.887262225f, 0.709763169f},
-std::array<float,2>{0.21570313f, 0.094262436f},
-std::array<float,2>{0.549787164f, 0.0417883806f},
-std::array<float,2>{0.270365089f, 0.683255374f},
-std::array<float,2>{0.787610412f, 0.970057905f},
-std::array<float,2>{0.0861701146f, 0.393512666f},
-std::array<float,2>{0.944687605f, 0.362468451f},
-std::array<float,2>{0.177993387f, 0.804256499f},
-std::array<float,2>{0.742906809f, 0.55746907f},
-std::array<float,2>{0.4823291f, 0.178747341f},
-std::array<float,2>{0.931883991f, 0.0882943198f},
-std::array<float,2>{0.225669906f, 0.742237568f},
-std::array<float,2>{0.686141193f, 0.875553548f},
-std::array<float,2>{0.407129675f, 0.45791319f},
-std::array<float,2>{0.609179854f, 0.259619623f},
-std::array<float,2>{0.349320441f, 0.859422624f},
-std::array<float,2>{0.817840517f, 0.610433161f},
-std::array<float,2>{0.0492831692f, 0.217400327f},
-std::array<float,2>{0.69664818f, 0.140917137f},
-std::array<float,2>{0.467184275f, 0.505023777f},
-std::array<float,2>{0.988628507f, 0.776626348f},
-std::array<float,2>{0.151065558f, 0.317456424f},
-std::array<float,2>{0.755948544f, 0.427190155f},
-std::array<float,2>{0.115604885f, 0.96444267f},
-std::array<float,2>{0.508493304f, 0.633234262f},
-std::array<float,2>{0.299360782f, 0.00317662465f},
-std::array<float,2>{0.981137276f, 0.161012009f},
-std::array<float,2>{0.130572453f, 0.54588455f},
-std::array<float,2>{0.7041623f, 0.78396517f},
-std::array<float,2>{0.439476907f, 0.347502112f},
-std::array<float,2>{0.517535865f, 0.375097811f},
-std::array<float,2>{0.283515185f, 0.986679196f},
-std::array<float,2>{0.778756201f, 0.665648401f},
-std::array<float,2>{0.0945258141f, 0.0595908538f},
-std::array<float,2>{0.664530754f, 0.11158064f},
-std::array<float,2>{0.425820142f, 0.692955434f},
-std::array<float,2>{0.914429843f, 0.906648099f},
-std::array<float,2>{0.236500204f, 0.470116049f},
-std::array<float,2>{0.830888987f, 0.296574742f},
-std::array<float,2>{0.0351611823f, 0.815965831f},
-std::array<float,2>{0.617455602f, 0.590461969f},
-std::array<float,2>{0.362074733f, 0.238432154f},
-std::array<float,2>{0.808551252f, 0.0251511261f},
-std::array<float,2>{0.0676943585f, 0.655807614f},
-std::array<float,2>{0.539690554f, 0.948016644f},
-std::array<float,2>{0.262119263f, 0.417394817f},
-std::array<float,2>{0.722069979f, 0.335113436f},
-std::array<float,2>{0.489052534f, 0.755318224f},
-std::array<float,2>{0.956217825f, 0.525575638f},
-std::array<float,2>{0.162397489f, 0.134209484f},
-std::array<float,2>{0.582481861f, 0.189756885f},
-std::array<float,2>{0.323177069f, 0.600304544f},
-std::array<float,2>{0.85117209f, 0.855732501f},
-std::array<float,2>{0.023876192f, 0.267447323f},
-std::array<float,2>{0.903018415f, 0.440777868f},
-std::array<float,2>{0.194836974f, 0.892781854f},
-std::array<float,2>{0.654950857f, 0.721745789f},
-std::array<float,2>{0.388225794f, 0.072122179f},
-std::array<float,2>{0.771141171f, 0.127037734f},
-std::array<float,2>{0.107025959f, 0.520652652f},
-std::array<float,2>{0.52506721f, 0.759584248f},
-std::array<float,2>{0.291207194f, 0.343160242f},
-std::array<float,2>{0.716340303f, 0.408962399f},
-std::array<float,2>{0.447667569f, 0.941936553f},
-std::array<float,2>{0.968806386f, 0.644461274f},
-std::array<float,2>{0.136400521f, 0.0230306238f},
-std::array<float,2>{0.615549743f, 0.0656467602f},
-std::array<float,2>{0.368353516f, 0.726701558f},
-std::array<float,2>{0.836547673f, 0.901863217f},
-std::array<float,2>{0.0412956364f, 0.4458296f},
-std::array<float,2>{0.908665895f, 0.279295027f},
-std::array<float,2>{0.243843749f, 0.846939385f},
-std::array<float,2>{0.661794484f, 0.601686537f},
-std::array<float,2>{0.431128055f, 0.195884392f},
-std::array<float,2>{0.963203073f, 0.048687581f},
-std::array<float,2>{0.169549689f, 0.663556039f},
-std::array<float,2>{0.726654947f, 0.998324394f},
-std::array<float,2>{0.493130893f, 0.38854304f},
-std::array<float,2>{0.533841074f, 0.355021954f},
-std::array<float,2>{0.251014054f, 0.789434433f},
-std::array<float,2>{0.803907514f, 0.531591177f},
-std::array<float,2>{0.0709941015f, 0.168519452f},
-std::array<float,2>{0.64201045f, 0.243792161f},
-std::array<float,2>{0.375621498f, 0.582563818f},
-std::array<float,2>{0.895888746f, 0.824120283f},
-std::array<float,2>{0.201349035f, 0.288999349f},
-std::array<float,2>{0.853336394f, 0.477870405f},
-std::array<float,2>{0.0178720858f, 0.918097615f},
-std::array<float,2>{0.587680817f, 0.700709999f},
-std::array<float,2>{0.316435486f, 0.12467508f},
-std::array<float,2>{0.880615711f, 0.203442976f},
-std::array<float,2>{0.206444994f, 0.623113394f},
-std::array<float,2>{0.636089623f, 0.867329836f},
-std::array<float,2>{0.395556211f, 0.251361817f},
-std::array<float,2>{0.564530551f, 0.466902316f},
-std::array<float,2>{0.342841685f, 0.889114738f},
-std::array<float,2>{0.873880446f, 0.738764346f},
-std::array<float,2>{0.013100192f, 0.0816905871f},
-std::array<float,2>{0.736053109f, 0.0112604788f},
-std::array<float,2>{0.470912367f, 0.629350483f},
-std::array<float,2>{0.950209975f, 0.959391356f},
-std::array<float,2>{0.180259287f, 0.43627876f},
-std::array<float,2>{0.789641559f, 0.321412206f},
-std::array<float,2>{0.0852438584f, 0.77061218f},
-std::array<float,2>{0.560103536f, 0.508010387f},
-std::array<float,2>{0.280563474f, 0.148879156f},
-std::array<float,2>{0.827401757f, 0.10374666f},
-std::array<float,2>{0.0611637384f, 0.713671803f},
-std::array<float,2>{0.598176718f, 0.936517f},
-std::array<float,2>{0.352312356f, 0.485226214f},
-std::array<float,2>{0.67376256f, 0.298368841f},
-std::array<float,2>{0.41724363f, 0.838200033f},
-std::array<float,2>{0.923434854f, 0.576435447f},
-std::array<float,2>{0.228177398f, 0.224327087f},
-std::array<float,2>{0.505391479f, 0.18231377f},
-std::array<float,2>{0.30738309f, 0.551228464f},
-std::array<float,2>{0.757835686f, 0.812090039f},
-std::array<float,2>{0.121784799f, 0.369682431f},
-std::array<float,2>{0.998964429f, 0.405690849f},
-std::array<float,2>{0.148255631f, 0.982367516f},
-std::array<float,2>{0.694650829f, 0.672927141f},
-std::array<float,2>{0.454584926f, 0.0335872546f},
-std::array<float,2>{0.784414887f, 0.199817732f},
-std::array<float,2>{0.0902071595f, 0.605566502f},
-std::array<float,2>{0.553797364f, 0.848095417f},
-std::array<float,2>{0.267050028f, 0.275825143f},
-std::array<float,2>{0.749282777f, 0.451027453f},
-std::array<float,2>{0.477196157f, 0.905309021f},
-std::array<float,2>{0.93764776f, 0.734338284f},
-std::array<float,2>{0.172423333f, 0.0703013167f},
-std::array<float,2>{0.574919999f, 0.0191464275f},
-std::array<float,2>{0.332557797f, 0.648109674f},
-std::array<float,2>{0.86575228f, 0.940202177f},
-std::array<float,2>{0.00184132671f, 0.412911594f},
-std::array<float,2>{0.886201978f, 0.337410986f},
-std::array<float,2>{0.211138085f, 0.761830628f},
-std::array<float,2>{0.629521132f, 0.517666638f},
-std::array<float,2>{0.39898324f, 0.129365563f},
-std::array<float,2>{0.984734416f, 0.119069867f},
-std::array<float,2>{0.154098526f, 0.696718514f},
-std::array<float,2>{0.69986093f, 0.91442275f},
-std::array<float,2>{0.463208765f, 0.484213203f},
-std::array<float,2>{0.51444f, 0.284642667f},
-std::array<float,2>{0.304430842f, 0.824872792f},
-std::array<float,2>{0.750711143f, 0.579058349f},
-std::array<float,2>{0.110476762f, 0.248193502f},
-std::array<float,2>{0.682960868f, 0.166781113f},
-std::array<float,2>{0.411762804f, 0.535511971f},
-std::array<float,2>{0.937071562f, 0.7939201f},
-std::array<float,2>{0.220793486f, 0.356198311f},
-std::array<float,2>{0.813779891f, 0.383354664f},
-std::array<float,2>{0.0527290963f, 0.994384348f},
-std::array<float,2>{0.603400528f, 0.659453392f},
-std::array<float,2>{0.347098053f, 0.0541067719f},
-std::array<float,2>{0.918517292f, 0.155158326f},
-std::array<float,2>{0.240847617f, 0.513494015f},
-std::array<float,2>{0.671737015f, 0.766180634f},
-std::array<float,2>{0.425285071f, 0.324447066f},
-std::array<float,2>{0.622720718f, 0.432494193f},
-std::array<float,2>{0.363510847f, 0.956388175f},
-std::array<float,2>{0.832216263f, 0.625297129f},
-std::array<float,2>{0.0348791331f, 0.0142899062f},
-std::array<float,2>{0.707983434f, 0.0820458457f},
-std::array<float,2>{0.442242652f, 0.736499369f},
-std::array<float,2>{0.977773488f, 0.886062443f},
-std::array<float,2>{0.127112165f, 0.463602632f},
-std::array<float,2>{0.775090456f, 0.256639063f},
-std::array<float,2>{0.100288399f, 0.871530414f},
-std::array<float,2>{0.522750616f, 0.619493246f},
-std::array<float,2>{0.285785079f, 0.20843035f},
-std::array<float,2>{0.844328761f, 0.0387327038f},
-std::array<float,2>{0.0287767593f, 0.678561211f},
-std::array<float,2>{0.58069545f, 0.977124095f},
-std::array<float,2>{0.326260746f, 0.398543149f},
-std::array<float,2>{0.651669443f, 0.371414959f},
-std::array<float,2>{0.385212332f, 0.805016696f},
-std::array<float,2>{0.898865581f, 0.547829986f},
-std::array<float,2>{0.189747378f, 0.186318472f},
-std::array<float,2>{0.544908881f, 0.222476244f},
-std::array<float,2>{0.260324299f, 0.573581278f},
-std::array<float,2>{0.809105396f, 0.841452539f},
-std::array<float,2>{0.0636306554f, 0.302423626f},
-std::array<float,2>{0.958595812f, 0.488739699f},
-std::array<float,2>{0.157819822f, 0.93227309f},
-std::array<float,2>{0.725277185f, 0.716815948f},
-std::array<float,2>{0.485340983f, 0.109105825f},
-std::array<float,2>{0.841036022f, 0.175689459f},
-std::array<float,2>{0.0460337065f, 0.559619367f},
-std::array<float,2>{0.611620665f, 0.798592448f},
-std::array<float,2>{0.373515099f, 0.365834296f},
-std::array<float,2>{0.65946883f, 0.395695299f},
-std::array<float,2>{0.435933888f, 0.975930691f},
-std::array<float,2>{0.913031876f, 0.68599987f},
-std::array<float,2>{0.247020811f, 0.0446933582f},
-std::array<float,2>{0.528255224f, 0.0980523229f},
-std::array<float,2>{0.293642968f, 0.705036998f},
-std::array<float,2>{0.765887141f, 0.928399384f},
-std::array<float,2>{0.103701144f, 0.498021454f},
-std::array<float,2>{0.975841343f, 0.305550367f},
-std::array<float,2>{0.139451787f, 0.832483828f},
-std::array<float,2>{0.713684857f, 0.567592263f},
-std::array<float,2>{0.449900746f, 0.234370291f},
-std::array<float,2>{0.89406836f, 0.00574711012f},
-std::array<float,2>{0.197240517f, 0.640233755f},
-std::array<float,2>{0.648364127f, 0.967337549f},
-std::array<float,2>{0.382502943f, 0.42480728f},
-std::array<float,2>{0.590692639f, 0.313262314f},
-std::array<float,2>{0.313781202f, 0.780447543f},
-std::array<float,2>{0.856078804f, 0.503264189f},
-std::array<float,2>{0.0213562958f, 0.144970551f},
-std::array<float,2>{0.733992159f, 0.214010999f},
-std::array<float,2>{0.496368736f, 0.614548147f},
-std::array<float,2>{0.968476653f, 0.864589214f},
-std::array<float,2>{0.164331421f, 0.264006078f},
-std::array<float,2>{0.799013138f, 0.456364721f},
-std::array<float,2>{0.0767536983f, 0.882634223f},
-std::array<float,2>{0.539021134f, 0.748230696f},
-std::array<float,2>{0.2554079f, 0.0909794718f},
-std::array<float,2>{0.947383344f, 0.237563625f},
-std::array<float,2>{0.18625325f, 0.589719653f},
-std::array<float,2>{0.740898192f, 0.820214927f},
-std::array<float,2>{0.472845972f, 0.292108864f},
-std::array<float,2>{0.558416069f, 0.476193607f},
-std::array<float,2>{0.275699884f, 0.912907898f},
-std::array<float,2>{0.793936193f, 0.688214421f},
-std::array<float,2>{0.0818619803f, 0.114886835f},
-std::array<float,2>{0.638078868f, 0.0548761413f},
-std::array<float,2>{0.392099112f, 0.670337915f},
-std::array<float,2>{0.876378536f, 0.990027368f},
-std::array<float,2>{0.207928389f, 0.38157174f},
-std::array<float,2>{0.868268192f, 0.349388897f},
-std::array<float,2>{0.00811852887f, 0.7854141f},
-std::array<float,2>{0.569980085f, 0.540721595f},
-std::array<float,2>{0.337761492f, 0.156551167f},
-std::array<float,2>{0.763001144f, 0.0764022097f},
-std::array<float,2>{0.120962366f, 0.725405097f},
-std::array<float,2>{0.500339389f, 0.897254407f},
-std::array<float,2>{0.309109211f, 0.443721235f},
-std::array<float,2>{0.691329896f, 0.270806015f},
-std::array<float,2>{0.45830223f, 0.853101611f},
-std::array<float,2>{0.994339645f, 0.59683609f},
-std::array<float,2>{0.144368112f, 0.193787873f},
-std::array<float,2>{0.594763935f, 0.138274878f},
-std::array<float,2>{0.356228918f, 0.530199945f},
-std::array<float,2>{0.824103713f, 0.752133608f},
-std::array<float,2>{0.0569547899f, 0.330854475f},
-std::array<float,2>{0.92675072f, 0.41901812f},
-std::array<float,2>{0.230975837f, 0.951963603f},
-std::array<float,2>{0.67669642f, 0.652243555f},
-std::array<float,2>{0.42145744f, 0.028439451f},
-std::array<float,2>{0.820249915f, 0.214901745f},
-std::array<float,2>{0.0470514558f, 0.611669242f},
-std::array<float,2>{0.605478406f, 0.86210531f},
-std::array<float,2>{0.349689752f, 0.260497987f},
-std::array<float,2>{0.684546351f, 0.460130572f},
-std::array<float,2>{0.408497095f, 0.877038658f},
-std::array<float,2>{0.929717243f, 0.744961202f},
-std::array<float,2>{0.224108979f, 0.0877131075f},
-std::array<float,2>{0.50992167f, 0.000999464421f},
-std::array<float,2>{0.298247963f, 0.635514379f},
-std::array<float,2>{0.755334198f, 0.961914182f},
-std::array<float,2>{0.114328831f, 0.428349793f},
-std::array<float,2>{0.99162811f, 0.31894052f},
-std::array<float,2>{0.148739278f, 0.77448684f},
-std::array<float,2>{0.697894156f, 0.50752759f},
-std::array<float,2>{0.465619564f, 0.144148707f},
-std::array<float,2>{0.888881624f, 0.0974067003f},
-std::array<float,2>{0.217110693f, 0.708791554f},
-std::array<float,2>{0.627133429f, 0.925679922f},
-std::array<float,2>{0.404002786f, 0.49466005f},
-std::array<float,2>{0.573804617f, 0.308849216f},
-std::array<float,2>{0.329006523f, 0.828200877f},
-std::array<float,2>{0.86084187f, 0.565687478f},
-std::array<float,2>{0.00538700074f, 0.230171248f},
-std::array<float,2>{0.745214343f, 0.176086411f},
-std::array<float,2>{0.48416236f, 0.555529594f},
-std::array<float,2>{0.943344474f, 0.802452683f},
-std::array<float,2>{0.176455095f, 0.360496074f},
-std::array<float,2>{0.786875367f, 0.39122197f},
-std::array<float,2>{0.0889757276f, 0.970857024f},
-std::array<float,2>{0.547397077f, 0.680952787f},
-std::array<float,2>{0.272364408f, 0.0399499163f},
-std::array<float,2>{0.953289628f, 0.135444269f},
-std::array<float,2>{0.160223842f, 0.524522901f},
-std::array<float,2>{0.719827533f, 0.756585896f},
-std::array<float,2>{0.492040783f, 0.333295226f},
-std::array<float,2>{0.54155761f, 0.415211827f},
-std::array<float,2>{0.26561445f, 0.945812821f},
-std::array<float,2>{0.804974258f, 0.654107213f},
-std::array<float,2>{0.0696754083f, 0.0256763976f},
-std::array<float,2>{0.653567851f, 0.0723338649f},
-std::array<float,2>{0.389335126f, 0.719706059f},
-std::array<float,2>{0.904765069f, 0.891894519f},
-std::array<float,2>{0.192797184f, 0.439244121f},
-std::array<float,2>{0.849226892f, 0.267955214f},
-std::array<float,2>{0.0271976925f, 0.858606219f},
-std::array<float,2>{0.584685147f, 0.598554969f},
-std::array<float,2>{0.320742756f, 0.189290985f},
-std::array<float,2>{0.780558825f, 0.0613722876f},
-std::array<float,2>{0.0965147242f, 0.667333186f},
-std::array<float,2>{0.519190907f, 0.985927343f},
-std::array<float,2>{0.281402946f, 0.377891749f},
-std::array<float,2>{0.705988586f, 0.345397532f},
-std::array<float,2>{0.438765228f, 0.781981647f},
-std::array<float,2>{0.982940793f, 0.544380963f},
-std::array<float,2>{0.131686002f, 0.164019704f},
-std::array<float,2>{0.620271623f, 0.241479814f},
-std::array<float,2>{0.361077785f, 0.593736947f},
-std::array<float,2>{0.82961607f, 0.812926888f},
-std::array<float,2>{0.0380331129f, 0.293413699f},
-std::array<float,2>{0.917324781f, 0.471997976f},
-std::array<float,2>{0.235743895f, 0.909666181f},
-std::array<float,2>{0.666853845f, 0.694963694f},
-std::array<float,2>{0.428855717f, 0.110162891f},
-std::array<float,2>{0.80173254f, 0.171677247f},
-std::array<float,2>{0.0741866976f, 0.533381164f},
-std::array<float,2>{0.532036245f, 0.791734993f},
-std::array<float,2>{0.252111077f, 0.352625698f},
-std::array<float,2>{0.729625404f, 0.389476657f},
-std::array<float,2>{0.495603591f, 0.996760547f},
-std::array<float,2>{0.96166718f, 0.660907745f},
-std::array<float,2>{0.170505658f, 0.0499982573f},
-std::array<float,2>{0.589827895f, 0.121260956f},
-std::array<float,2>{0.31987983f, 0.701962948f},
-std::array<float,2>{0.855410993f, 0.921489239f},
-std::array<float,2>{0.0167788621f, 0.479605258f},
-std::array<float,2>{0.898061872f, 0.285160393f},
-std::array<float,2>{0.200082764f, 0.821299255f},
-std::array<float,2>{0.642965913f, 0.585801423f},
-std::array<float,2>{0.377196699f, 0.245516896f},
-std::array<float,2>{0.97253567f, 0.0208617691f},
-std::array<float,2>{0.133390054f, 0.641264915f},
-std::array<float,2>{0.717535794f, 0.944991887f},
-std::array<float,2>{0.445889771f, 0.407454759f},
-std::array<float,2>{0.526963174f, 0.341003984f},
-std::array<float,2>{0.289948344f, 0.760321259f},
-std::array<float,2>{0.772378922f, 0.521629751f},
-std::array<float,2>{0.107505634f, 0.125956818f},
-std::array<float,2>{0.66258359f, 0.19910191f},
-std::array<float,2>{0.433359057f, 0.604446828f},
-std::array<float,2>{0.906584918f, 0.845659077f},
-std::array<float,2>{0.244298846f, 0.279623389f},
-std::array<float,2>{0.838719368f, 0.448919356f},
-std::array<float,2>{0.0395905003f, 0.89968586f},
-std::array<float,2>{0.613629758f, 0.729743123f},
-std::array<float,2>{0.370102942f, 0.0641742945f},
-std::array<float,2>{0.924638927f, 0.226067156f},
-std::array<float,2>{0.230090708f, 0.576160073f},
-std::array<float,2>{0.675365269f, 0.836430788f},
-std::array<float,2>{0.415798545f, 0.299264133f},
-std::array<float,2>{0.601370871f, 0.486358106f},
-std::array<float,2>{0.354130894f, 0.933785856f},
-std::array<float,2>{0.826084018f, 0.712806702f},
-std::array<float,2>{0.0593378246f, 0.102725968f},
-std::array<float,2>{0.691513002f, 0.0316660255f},
-std::array<float,2>{0.457003862f, 0.673993707f},
-std::array<float,2>{0.996750891f, 0.984189928f},
-std::array<float,2>{0.146188051f, 0.402358502f},
-std::array<float,2>{0.761326134f, 0.368825585f},
-std::array<float,2>{0.123838253f, 0.810296118f},
-std::array<float,2>{0.506178439f, 0.553615451f},
-std::array<float,2>{0.305589974f, 0.181178555f},
-std::array<float,2>{0.872292817f, 0.07847967f},
-std::array<float,2>{0.0141393207f, 0.741729915f},
-std::array<float,2>{0.562754273f, 0.887590885f},
-std::array<float,2>{0.341752738f, 0.465924591f},
-std::array<float,2>{0.634527206f, 0.252272218f},
-std::array<float,2>{0.397124738f, 0.869761169f},
-std::array<float,2>{0.882680953f, 0.622273684f},
-std::array<float,2>{0.20353888f, 0.206438825f},
-std::array<float,2>{0.561082602f, 0.150892481f},
-std::array<float,2>{0.278004915f, 0.511050224f},
-std::array<float,2>{0.791848838f, 0.772403479f},
-std::array<float,2>{0.0836836174f, 0.322528511f},
-std::array<float,2>{0.95173192f, 0.434270293f},
-std::array<float,2>{0.182542816f, 0.957284451f},
-std::array<float,2>{0.737024784f, 0.630966306f},
-std::array<float,2>{0.469272345f, 0.00948136207f},
-std::array<float,2>{0.753759623f, 0.247947231f},
-std::array<float,2>{0.113079593f, 0.581274033f},
-std::array<float,2>{0.512000263f, 0.826412082f},
-std::array<float,2>{0.301482916f, 0.282689393f},
-std::array<float,2>{0.702786684f, 0.481674939f},
-std::array<float,2>{0.462478399f, 0.916413486f},
-std::array<float,2>{0.986371219f, 0.698479176f},
-std::array<float,2>{0.156118765f, 0.120123021f},
-std::array<float,2>{0.604814887f, 0.0527021028f},
-std::array<float,2>{0.3440274f, 0.656923532f},
-std::array<float,2>{0.8149997f, 0.993351698f},
-std::array<float,2>{0.0537716076f, 0.385792226f},
-std::array<float,2>{0.935005665f, 0.358034045f},
-std::array<float,2>{0.219857723f, 0.795753837f},
-std::array<float,2>{0.680698454f, 0.537623942f},
-std::array<float,2>{0.412847489f, 0.164953187f},
-std::array<float,2>{0.939745247f, 0.0676420853f},
-std::array<float,2>{0.175119683f, 0.731072485f},
-std::array<float,2>{0.746371925f, 0.902826071f},
-std::array<float,2>{0.479538053f, 0.45140779f},
-std::array<float,2>{0.551731408f, 0.27501303f},
-std::array<float,2>{0.268692374f, 0.850778043f},
-std::array<float,2>{0.782809615f, 0.607463658f},
-std::array<float,2>{0.0936757773f, 0.201310918f},
-std::array<float,2>{0.632480025f, 0.131806165f},
-std::array<float,2>{0.4006643f, 0.516495228f},
-std::array<float,2>{0.884435236f, 0.764795005f},
-std::array<float,2>{0.213680372f, 0.337964803f},
-std::array<float,2>{0.863882065f, 0.410500616f},
-std::array<float,2>{0.00361263729f, 0.937658668f},
-std::array<float,2>{0.576813102f, 0.6449669f},
-std::array<float,2>{0.335193902f, 0.0166494716f},
-std::array<float,2>{0.90115267f, 0.185471505f},
-std::array<float,2>{0.187919393f, 0.550677478f},
-std::array<float,2>{0.648709238f, 0.807481468f},
-std::array<float,2>{0.383196086f, 0.373953909f},
-std::array<float,2>{0.579271674f, 0.40172708f},
-std::array<float,2>{0.32501632f, 0.979838371f},
-std::array<float,2>{0.847030103f, 0.67618382f},
-std::array<float,2>{0.0312106945f, 0.0369659066f},
-std::array<float,2>{0.7228688f, 0.105710849f},
-std::array<float,2>{0.487849265f, 0.714888453f},
-std::array<float,2>{0.959233224f, 0.931487799f},
-std::array<float,2>{0.158979848f, 0.491983682f},
-std::array<float,2>{0.8115834f, 0.304637253f},
-std::array<float,2>{0.0655990392f, 0.843674242f},
-std::array<float,2>{0.545725763f, 0.571858883f},
-std::array<float,2>{0.257927626f, 0.219558626f},
-std::array<float,2>{0.835286319f, 0.0132518392f},
-std::array<float,2>{0.0320543461f, 0.628655791f},
-std::array<float,2>{0.624786735f, 0.953329027f},
-std::array<float,2>{0.366246998f, 0.430489719f},
-std::array<float,2>{0.669659793f, 0.327587098f},
-std::array<float,2>{0.423165202f, 0.767832041f},
-std::array<float,2>{0.921852589f, 0.514102995f},
-std::array<float,2>{0.239022776f, 0.153690234f},
-std::array<float,2>{0.520756543f, 0.209260017f},
-std::array<float,2>{0.287461579f, 0.61900574f},
-std::array<float,2>{0.776636302f, 0.874045014f},
-std::array<float,2>{0.0994513705f, 0.254945725f},
-std::array<float,2>{0.979433119f, 0.462696105f},
-std::array<float,2>{0.12605527f, 0.88401866f},
-std::array<float,2>{0.710752726f, 0.734702587f},
-std::array<float,2>{0.443452418f, 0.0851316899f},
-std::array<float,2>{0.857617974f, 0.148108423f},
-std::array<float,2>{0.023032818f, 0.500545979f},
-std::array<float,2>{0.592748582f, 0.779189587f},
-std::array<float,2>{0.316182852f, 0.315337449f},
-std::array<float,2>{0.645181715f, 0.422984958f},
-std::array<float,2>{0.379462093f, 0.966739357f},
-std::array<float,2>{0.891988099f, 0.638100803f},
-std::array<float,2>{0.199113071f, 0.00624650484f},
-std::array<float,2>{0.536260366f, 0.0923775136f},
-std::array<float,2>{0.256274611f, 0.746239662f},
-std::array<float,2>{0.798045337f, 0.879820526f},
-std::array<float,2>{0.074680008f, 0.453287423f},
-std::array<float,2>{0.965383291f, 0.263628095f},
-std::array<float,2>{0.166472152f, 0.866487622f},
-std::array<float,2>{0.731759727f, 0.615478873f},
-std::array<float,2>{0.499110103f, 0.212624073f},
-std::array<float,2>{0.910539806f, 0.0468311235f},
-std::array<float,2>{0.249046475f, 0.685316503f},
-std::array<float,2>{0.657475591f, 0.973984063f},
-std::array<float,2>{0.434943765f, 0.396888465f},
-std::array<float,2>{0.611241758f, 0.363314509f},
-std::array<float,2>{0.372507423f, 0.800149024f},
-std::array<float,2>{0.843688548f, 0.562046111f},
-std::array<float,2>{0.0437867865f, 0.172758967f},
-std::array<float,2>{0.712065518f, 0.230735183f},
-std::array<float,2>{0.452078462f, 0.569961965f},
-std::array<float,2>{0.974385142f, 0.83464551f},
-std::array<float,2>{0.137078002f, 0.306999534f},
-std::array<float,2>{0.769481361f, 0.499533325f},
-std::array<float,2>{0.101910546f, 0.926201224f},
-std::array<float,2>{0.529782891f, 0.706831098f},
-std::array<float,2>{0.296603709f, 0.099824369f},
-std::array<float,2>{0.992290616f, 0.192917511f},
-std::array<float,2>{0.141737908f, 0.5954597f},
-std::array<float,2>{0.688427866f, 0.854244471f},
-std::array<float,2>{0.45900619f, 0.272563756f},
-std::array<float,2>{0.503704071f, 0.443144262f},
-std::array<float,2>{0.310812443f, 0.894969642f},
-std::array<float,2>{0.763926744f, 0.723154366f},
-std::array<float,2>{0.117311679f, 0.0757468194f},
-std::array<float,2>{0.677746117f, 0.0307456441f},
-std::array<float,2>{0.418299198f, 0.649169505f},
-std::array<float,2>{0.929575324f, 0.950270414f},
-std::array<float,2>{0.233365342f, 0.42159459f},
-std::array<float,2>{0.822247207f, 0.329983979f},
-std::array<float,2>{0.0547535382f, 0.751484156f},
-std::array<float,2>{0.596866727f, 0.529030204f},
-std::array<float,2>{0.358251989f, 0.139745206f},
-std::array<float,2>{0.795123696f, 0.116864309f},
-std::array<float,2>{0.0788675621f, 0.691353261f},
-std::array<float,2>{0.555979967f, 0.910880268f},
-std::array<float,2>{0.274175227f, 0.474102974f},
-std::array<float,2>{0.740161836f, 0.289483458f},
-std::array<float,2>{0.476243317f, 0.817695737f},
-std::array<float,2>{0.945475519f, 0.587266684f},
-std::array<float,2>{0.185326293f, 0.234831795f},
-std::array<float,2>{0.567077518f, 0.158605754f},
-std::array<float,2>{0.338212252f, 0.541460514f},
-std::array<float,2>{0.870173156f, 0.788444638f},
-std::array<float,2>{0.0106269661f, 0.350982517f},
-std::array<float,2>{0.877572358f, 0.380546898f},
-std::array<float,2>{0.20902963f, 0.991226792f},
-std::array<float,2>{0.639955342f, 0.66928345f},
-std::array<float,2>{0.393166572f, 0.0579302385f},
-std::array<float,2>{0.849865735f, 0.187592328f},
-std::array<float,2>{0.0245738309f, 0.599190474f},
-std::array<float,2>{0.583763063f, 0.857999325f},
-std::array<float,2>{0.323564917f, 0.268772721f},
-std::array<float,2>{0.655762911f, 0.438056529f},
-std::array<float,2>{0.387446672f, 0.891578317f},
-std::array<float,2>{0.903523862f, 0.719951153f},
-std::array<float,2>{0.19394505f, 0.0738598853f},
-std::array<float,2>{0.540310144f, 0.0273259562f},
-std::array<float,2>{0.263569653f, 0.652903497f},
-std::array<float,2>{0.807168663f, 0.947205365f},
-std::array<float,2>{0.066631794f, 0.414436609f},
-std::array<float,2>{0.955298066f, 0.332214773f},
-std::array<float,2>{0.163263559f, 0.757335961f},
-std::array<float,2>{0.721127927f, 0.524383664f},
-std::array<float,2>{0.489907712f, 0.136072934f},
-std::array<float,2>{0.915186405f, 0.110812671f},
-std::array<float,2>{0.237368569f, 0.694223404f},
-std::array<float,2>{0.665989816f, 0.909003615f},
-std::array<float,2>{0.427118778f, 0.471612632f},
-std::array<float,2>{0.618428111f, 0.294418365f},
-std::array<float,2>{0.363028526f, 0.814349234f},
-std::array<float,2>{0.831144691f, 0.592334807f},
-std::array<float,2>{0.0361863002f, 0.241116047f},
-std::array<float,2>{0.703306556f, 0.162934691f},
-std::array<float,2>{0.441124082f, 0.543778062f},
-std::array<float,2>{0.982109308f, 0.783141613f},
-std::array<float,2>{0.129673317f, 0.343901396f},
-std::array<float,2>{0.778140068f, 0.378482968f},
-std::array<float,2>{0.0954891071f, 0.984867871f},
-std::array<float,2>{0.515942395f, 0.66671139f},
-std::array<float,2>{0.285074592f, 0.0617757104f},
-std::array<float,2>{0.989906251f, 0.143305093f},
-std::array<float,2>{0.152282983f, 0.506435454f},
-std::array<float,2>{0.695618153f, 0.774287164f},
-std::array<float,2>{0.468293995f, 0.319989353f},
-std::array<float,2>{0.508992732f, 0.429654181f},
-std::array<float,2>{0.300239772f, 0.961355627f},
-std::array<float,2>{0.757038355f, 0.636702836f},
-std::array<float,2>{0.117021337f, 9.86829036e-05f},
-std::array<float,2>{0.687079608f, 0.0863958523f},
-std::array<float,2>{0.407853365f, 0.745329678f},
-std::array<float,2>{0.933227718f, 0.878505111f},
-std::array<float,2>{0.225128636f, 0.459516078f},
-std::array<float,2>{0.817069054f, 0.261168808f},
-std::array<float,2>{0.0500138476f, 0.862448573f},
-std::array<float,2>{0.608119309f, 0.612722278f},
-std::array<float,2>{0.347795367f, 0.216561452f},
-std::array<float,2>{0.788983285f, 0.0405390374f},
-std::array<float,2>{0.0871309862f, 0.680081248f},
-std::array<float,2>{0.550401151f, 0.972175241f},
-std::array<float,2>{0.271232218f, 0.392177194f},
-std::array<float,2>{0.743871987f, 0.359784693f},
-std::array<float,2>{0.480539054f, 0.801173806f},
-std::array<float,2>{0.943759084f, 0.556550384f},
-std::array<float,2>{0.179214329f, 0.176843032f},
-std::array<float,2>{0.571320474f, 0.228516296f},
-std::array<float,2>{0.331356168f, 0.564931273f},
-std::array<float,2>{0.861577272f, 0.829580307f},
-std::array<float,2>{0.00734110037f, 0.310312569f},
-std::array<float,2>{0.888653815f, 0.495956719f},
-std::array<float,2>{0.216649711f, 0.923881888f},
-std::array<float,2>{0.625605524f, 0.707781911f},
-std::array<float,2>{0.405114383f, 0.0964339003f},
-std::array<float,2>{0.758825719f, 0.17998302f},
-std::array<float,2>{0.122172803f, 0.554620624f},
-std::array<float,2>{0.50414151f, 0.809453309f},
-std::array<float,2>{0.308514357f, 0.368118584f},
-std::array<float,2>{0.693398833f, 0.403627366f},
-std::array<float,2>{0.454047024f, 0.982950866f},
-std::array<float,2>{0.999494731f, 0.674936593f},
-std::array<float,2>{0.147161201f, 0.0323613659f},
-std::array<float,2>{0.598652661f, 0.10223826f},
-std::array<float,2>{0.353335828f, 0.711836696f},
-std::array<float,2>{0.826804101f, 0.935160935f},
-std::array<float,2>{0.0623960122f, 0.487579584f},
-std::array<float,2>{0.922036886f, 0.300169468f},
-std::array<float,2>{0.227292269f, 0.837487221f},
-std::array<float,2>{0.672069073f, 0.575003922f},
-std::array<float,2>{0.416783899f, 0.225336254f},
-std::array<float,2>{0.949337006f, 0.00796218496f},
-std::array<float,2>{0.180982664f, 0.632578552f},
-std::array<float,2>{0.735145569f, 0.95818156f},
-std::array<float,2>{0.472165108f, 0.434698313f},
-std::array<float,2>{0.559159577f, 0.323416561f},
-std::array<float,2>{0.279331684f, 0.772892356f},
-std::array<float,2>{0.790336967f, 0.510353267f},
-std::array<float,2>{0.0843217671f, 0.15219973f},
-std::array<float,2>{0.634981871f, 0.205154657f},
-std::array<float,2>{0.394592226f, 0.62127918f},
-std::array<float,2>{0.87957406f, 0.870407343f},
-std::array<float,2>{0.205520615f, 0.253667474f},
-std::array<float,2>{0.874617934f, 0.465154022f},
-std::array<float,2>{0.0119746653f, 0.887798488f},
-std::array<float,2>{0.566017926f, 0.740286767f},
-std::array<float,2>{0.342069715f, 0.0796503872f},
-std::array<float,2>{0.89536339f, 0.244793415f},
-std::array<float,2>{0.202322647f, 0.584577739f},
-std::array<float,2>{0.640872896f, 0.821258664f},
-std::array<float,2>{0.376282811f, 0.286744148f},
-std::array<float,2>{0.586413264f, 0.479191989f},
-std::array<float,2>{0.317911118f, 0.920155346f},
-std::array<float,2>{0.852400124f, 0.703066766f},
-std::array<float,2>{0.0194491185f, 0.122454874f},
-std::array<float,2>{0.727929711f, 0.0490578376f},
-std::array<float,2>{0.493473947f, 0.661690235f},
-std::array<float,2>{0.964684546f, 0.997491479f},
-std::array<float,2>{0.168737233f, 0.390200019f},
-std::array<float,2>{0.803622723f, 0.35238561f},
-std::array<float,2>{0.0722635612f, 0.792679071f},
-std::array<float,2>{0.534611642f, 0.535130441f},
-std::array<float,2>{0.250689685f, 0.16995956f},
-std::array<float,2>{0.837636173f, 0.0627326965f},
-std::array<float,2>{0.0423528999f, 0.728956819f},
-std::array<float,2>{0.616598606f, 0.898865283f},
-std::array<float,2>{0.36743629f, 0.447761565f},
-std::array<float,2>{0.660571992f, 0.280352116f},
-std::array<float,2>{0.430209994f, 0.844362438f},
-std::array<float,2>{0.909523845f, 0.605196714f},
-std::array<float,2>{0.242995903f, 0.197958514f},
-std::array<float,2>{0.52419281f, 0.126092523f},
-std::array<float,2>{0.292749614f, 0.523287833f},
-std::array<float,2>{0.770003855f, 0.76136595f},
-std::array<float,2>{0.105869673f, 0.339884907f},
-std::array<float,2>{0.970175624f, 0.406501532f},
-std::array<float,2>{0.135187969f, 0.943812072f},
-std::array<float,2>{0.715819597f, 0.642169237f},
-std::array<float,2>{0.448782146f, 0.0199664682f},
-std::array<float,2>{0.810322165f, 0.220608205f},
-std::array<float,2>{0.063319616f, 0.570837736f},
-std::array<float,2>{0.54387641f, 0.84263289f},
-std::array<float,2>{0.261279613f, 0.30351162f},
-std::array<float,2>{0.725599468f, 0.49076283f},
-std::array<float,2>{0.485568017f, 0.930282533f},
-std::array<float,2>{0.957602918f, 0.716213107f},
-std::array<float,2>{0.156500548f, 0.106541291f},
-std::array<float,2>{0.581842124f, 0.0355515927f},
-std::array<float,2>{0.32750389f, 0.677128494f},
-std::array<float,2>{0.844833195f, 0.979391217f},
-std::array<float,2>{0.0281728338f, 0.401207179f},
-std::array<float,2>{0.899601042f, 0.374660492f},
-std::array<float,2>{0.190711886f, 0.808109045f},
-std::array<float,2>{0.651074708f, 0.549529374f},
-std::array<float,2>{0.386094302f, 0.18456617f},
-std::array<float,2>{0.977064073f, 0.0845339969f},
-std::array<float,2>{0.12881273f, 0.735934198f},
-std::array<float,2>{0.708863676f, 0.883040965f},
-std::array<float,2>{0.442466646f, 0.461476028f},
-std::array<float,2>{0.521684885f, 0.254438281f},
-std::array<float,2>{0.286409795f, 0.873939335f},
-std::array<float,2>{0.774026036f, 0.617493272f},
-std::array<float,2>{0.100895293f, 0.210864991f},
-std::array<float,2>{0.670099378f, 0.15293543f},
-std::array<float,2>{0.423947155f, 0.515488565f},
-std::array<float,2>{0.919799864f, 0.768749416f},
-std::array<float,2>{0.241867244f, 0.326846331f},
-std::array<float,2>{0.833162189f, 0.430942625f},
-std::array<float,2>{0.0334500894f, 0.95483923f},
-std::array<float,2>{0.62166357f, 0.627877593f},
-std::array<float,2>{0.364688128f, 0.0126666948f},
-std::array<float,2>{0.935705781f, 0.165632606f},
-std::array<float,2>{0.222196579f, 0.53903985f},
-std::array<float,2>{0.681890488f, 0.796535313f},
-std::array<float,2>{0.410842657f, 0.358603805f},
-std::array<float,2>{0.6017856f, 0.385121703f},
-std::array<float,2>{0.346007407f, 0.992441475f},
-std::array<float,2>{0.812678993f, 0.657746315f},
-std::array<float,2>{0.0511741787f, 0.0517317988f},
-std::array<float,2>{0.700208604f, 0.119864501f},
-std::array<float,2>{0.463999212f, 0.697729647f},
-std::array<float,2>{0.986187518f, 0.917923629f},
-std::array<float,2>{0.152467176f, 0.480754733f},
-std::array<float,2>{0.751514077f, 0.281400979f},
-std::array<float,2>{0.109673537f, 0.827516079f},
-std::array<float,2>{0.514902711f, 0.580469489f},
-std::array<float,2>{0.303082913f, 0.246869922f},
-std::array<float,2>{0.867056012f, 0.0162438005f},
-std::array<float,2>{0.000546153868f, 0.645902574f},
-std::array<float,2>{0.575343192f, 0.938839912f},
-std::array<float,2>{0.333632112f, 0.411374509f},
-std::array<float,2>{0.630476356f, 0.338979691f},
-std::array<float,2>{0.39993912f, 0.763861775f},
-std::array<float,2>{0.885600328f, 0.517489016f},
-std::array<float,2>{0.21201548f, 0.13191165f},
-std::array<float,2>{0.553137422f, 0.20244427f},
-std::array<float,2>{0.265924364f, 0.609181166f},
-std::array<float,2>{0.783479333f, 0.850154757f},
-std::array<float,2>{0.0917590633f, 0.273908705f},
-std::array<float,2>{0.938646913f, 0.452676684f},
-std::array<float,2>{0.173146084f, 0.903871536f},
-std::array<float,2>{0.748988569f, 0.732350945f},
-std::array<float,2>{0.478215009f, 0.0670286343f},
-std::array<float,2>{0.822803378f, 0.139402986f},
-std::array<float,2>{0.0581551716f, 0.527547717f},
-std::array<float,2>{0.594400048f, 0.750113845f},
-std::array<float,2>{0.357252747f, 0.328395814f},
-std::array<float,2>{0.676788807f, 0.420443177f},
-std::array<float,2>{0.420151293f, 0.950135887f},
-std::array<float,2>{0.927381694f, 0.650358617f},
-std::array<float,2>{0.232000306f, 0.0299835056f},
-std::array<float,2>{0.501256645f, 0.07501968f},
-std::array<float,2>{0.310144871f, 0.723849416f},
-std::array<float,2>{0.762306273f, 0.895625114f},
-std::array<float,2>{0.119370848f, 0.441634119f},
-std::array<float,2>{0.995784044f, 0.271796107f},
-std::array<float,2>{0.143049061f, 0.854690611f},
-std::array<float,2>{0.689949512f, 0.594197214f},
-std::array<float,2>{0.457509071f, 0.191711783f},
-std::array<float,2>{0.875437975f, 0.0567987636f},
-std::array<float,2>{0.208701551f, 0.668447256f},
-std::array<float,2>{0.637287021f, 0.99046284f},
-std::array<float,2>{0.391494334f, 0.379842609f},
-std::array<float,2>{0.568944812f, 0.349759459f},
-std::array<float,2>{0.336552113f, 0.787665546f},
-std::array<float,2>{0.868051052f, 0.542870462f},
-std::array<float,2>{0.00907100737f, 0.159245878f},
-std::array<float,2>{0.74155277f, 0.235604182f},
-std::array<float,2>{0.473926395f, 0.586578608f},
-std::array<float,2>{0.948261797f, 0.816913307f},
-std::array<float,2>{0.186893746f, 0.290338635f},
-std::array<float,2>{0.794003427f, 0.472807884f},
-std::array<float,2>{0.0809641257f, 0.911867201f},
-std::array<float,2>{0.557579458f, 0.689637423f},
-std::array<float,2>{0.277000219f, 0.115457237f},
-std::array<float,2>{0.966963112f, 0.211759642f},
-std::array<float,2>{0.165987015f, 0.616730988f},
-std::array<float,2>{0.733385324f, 0.866080403f},
-std::array<float,2>{0.4972969f, 0.262549788f},
-std::array<float,2>{0.538057566f, 0.454502881f},
-std::array<float,2>{0.253947198f, 0.880676627f},
-std::array<float,2>{0.800754964f, 0.747423053f},
-std::array<float,2>{0.0778732374f, 0.0930454805f},
-std::array<float,2>{0.646806896f, 0.007165886f},
-std::array<float,2>{0.381724477f, 0.63754344f},
-std::array<float,2>{0.893162608f, 0.965777278f},
-std::array<float,2>{0.195689946f, 0.422333807f},
-std::array<float,2>{0.857008398f, 0.316318363f},
-std::array<float,2>{0.0197431482f, 0.778127193f},
-std::array<float,2>{0.59147507f, 0.501253307f},
-std::array<float,2>{0.312759459f, 0.147170767f},
-std::array<float,2>{0.767226338f, 0.101414233f},
-std::array<float,2>{0.105461679f, 0.705148399f},
-std::array<float,2>{0.528769612f, 0.927131951f},
-std::array<float,2>{0.29410252f, 0.498758465f},
-std::array<float,2>{0.714448571f, 0.307916731f},
-std::array<float,2>{0.450330347f, 0.835040629f},
-std::array<float,2>{0.975414097f, 0.569259405f},
-std::array<float,2>{0.139768913f, 0.232223362f},
-std::array<float,2>{0.612820745f, 0.173181355f},
-std::array<float,2>{0.374348879f, 0.561209142f},
-std::array<float,2>{0.840271235f, 0.799282849f},
-std::array<float,2>{0.0456360802f, 0.365214407f},
-std::array<float,2>{0.914059222f, 0.397633314f},
-std::array<float,2>{0.247377127f, 0.973546386f},
-std::array<float,2>{0.658431113f, 0.683656752f},
-std::array<float,2>{0.437439352f, 0.0451361835f},
-std::array<float,2>{0.828617513f, 0.239536449f},
-std::array<float,2>{0.0383352116f, 0.591295481f},
-std::array<float,2>{0.619811296f, 0.814504504f},
-std::array<float,2>{0.359427005f, 0.295684308f},
-std::array<float,2>{0.667158782f, 0.469299585f},
-std::array<float,2>{0.428594798f, 0.907849848f},
-std::array<float,2>{0.916130602f, 0.692338526f},
-std::array<float,2>{0.235071793f, 0.112936005f},
-std::array<float,2>{0.517653883f, 0.0593525171f},
-std::array<float,2>{0.283073306f, 0.664503634f},
-std::array<float,2>{0.779892027f, 0.98813349f},
-std::array<float,2>{0.0968279392f, 0.376614839f},
-std::array<float,2>{0.983496428f, 0.346554369f},
-std::array<float,2>{0.132794425f, 0.784700513f},
-std::array<float,2>{0.706402957f, 0.546078622f},
-std::array<float,2>{0.437678874f, 0.161799043f},
-std::array<float,2>{0.905916691f, 0.0707454383f},
-std::array<float,2>{0.191883072f, 0.721290112f},
-std::array<float,2>{0.652628958f, 0.894020855f},
-std::array<float,2>{0.389895231f, 0.440067232f},
-std::array<float,2>{0.58507055f, 0.266127944f},
-std::array<float,2>{0.321946979f, 0.856624305f},
-std::array<float,2>{0.84767586f, 0.601433158f},
-std::array<float,2>{0.0254833624f, 0.191031381f},
-std::array<float,2>{0.718955338f, 0.13311334f},
-std::array<float,2>{0.490944207f, 0.526471317f},
-std::array<float,2>{0.954993308f, 0.753974378f},
-std::array<float,2>{0.161349371f, 0.334875256f},
-std::array<float,2>{0.806190789f, 0.416826338f},
-std::array<float,2>{0.0683888346f, 0.949121118f},
-std::array<float,2>{0.542568147f, 0.654692173f},
-std::array<float,2>{0.264371157f, 0.0238029771f},
-std::array<float,2>{0.941462517f, 0.178618759f},
-std::array<float,2>{0.177606195f, 0.558319926f},
-std::array<float,2>{0.74492985f, 0.803318918f},
-std::array<float,2>{0.483222544f, 0.362195224f},
-std::array<float,2>{0.548813939f, 0.393620819f},
-std::array<float,2>{0.272629917f, 0.968751967f},
-std::array<float,2>{0.786047995f, 0.681864679f},
-std::array<float,2>{0.0884571597f, 0.0424099788f},
-std::array<float,2>{0.62887013f, 0.0950621441f},
-std::array<float,2>{0.402806669f, 0.7108531f},
-std::array<float,2>{0.889765203f, 0.923165798f},
-std::array<float,2>{0.217937067f, 0.49330014f},
-std::array<float,2>{0.859708309f, 0.311515957f},
-std::array<float,2>{0.00401195651f, 0.831135273f},
-std::array<float,2>{0.5730955f, 0.562817037f},
-std::array<float,2>{0.330037236f, 0.227601111f},
-std::array<float,2>{0.754234254f, 0.00207518018f},
-std::array<float,2>{0.114165299f, 0.634683788f},
-std::array<float,2>{0.511500359f, 0.962936342f},
-std::array<float,2>{0.297289282f, 0.426593155f},
-std::array<float,2>{0.698640227f, 0.316556841f},
-std::array<float,2>{0.466720641f, 0.77632457f},
-std::array<float,2>{0.991113722f, 0.504657805f},
-std::array<float,2>{0.149600923f, 0.141770944f},
-std::array<float,2>{0.607301474f, 0.218211964f},
-std::array<float,2>{0.351287842f, 0.610027134f},
-std::array<float,2>{0.819320738f, 0.861156702f},
-std::array<float,2>{0.0485230386f, 0.258346111f},
-std::array<float,2>{0.930846989f, 0.458336145f},
-std::array<float,2>{0.222734511f, 0.876295447f},
-std::array<float,2>{0.684982896f, 0.743864715f},
-std::array<float,2>{0.41006285f, 0.0892558023f},
-std::array<float,2>{0.792950332f, 0.149959058f},
-std::array<float,2>{0.0823446661f, 0.50884223f},
-std::array<float,2>{0.562197804f, 0.769644499f},
-std::array<float,2>{0.278787464f, 0.321149588f},
-std::array<float,2>{0.737550735f, 0.436655074f},
-std::array<float,2>{0.469993502f, 0.960429549f},
-std::array<float,2>{0.952505946f, 0.630242288f},
-std::array<float,2>{0.182851821f, 0.0102256816f},
-std::array<float,2>{0.564329207f, 0.0806866363f},
-std::array<float,2>{0.340262771f, 0.739703596f},
-std::array<float,2>{0.871910334f, 0.890530407f},
-std::array<float,2>{0.0148831708f, 0.468622804f},
-std::array<float,2>{0.881614506f, 0.250884414f},
-std::array<float,2>{0.204756752f, 0.868479073f},
-std::array<float,2>{0.632853508f, 0.624190867f},
-std::array<float,2>{0.398371249f, 0.20445399f},
-std::array<float,2>{0.997918725f, 0.0346051641f},
-std::array<float,2>{0.145433068f, 0.672430277f},
-std::array<float,2>{0.692702234f, 0.980854332f},
-std::array<float,2>{0.455987036f, 0.404943377f},
-std::array<float,2>{0.507473111f, 0.370736778f},
-std::array<float,2>{0.306354493f, 0.811066866f},
-std::array<float,2>{0.760640085f, 0.552244604f},
-std::array<float,2>{0.124290034f, 0.183536455f},
-std::array<float,2>{0.674753308f, 0.223623633f},
-std::array<float,2>{0.414406121f, 0.577560544f},
-std::array<float,2>{0.92576921f, 0.839020491f},
-std::array<float,2>{0.228864908f, 0.297577679f},
-std::array<float,2>{0.825100362f, 0.485994935f},
-std::array<float,2>{0.0596237518f, 0.937404394f},
-std::array<float,2>{0.599672019f, 0.714032054f},
-std::array<float,2>{0.354970485f, 0.104938418f},
-std::array<float,2>{0.907649636f, 0.196694225f},
-std::array<float,2>{0.245662242f, 0.603163064f},
-std::array<float,2>{0.663526893f, 0.84649229f},
-std::array<float,2>{0.431705207f, 0.278125525f},
-std::array<float,2>{0.61458689f, 0.446350157f},
-std::array<float,2>{0.370892882f, 0.900737703f},
-std::array<float,2>{0.839398324f, 0.728226185f},
-std::array<float,2>{0.0406560674f, 0.0652867481f},
-std::array<float,2>{0.717955947f, 0.022080861f},
-std::array<float,2>{0.44686237f, 0.6433056f},
-std::array<float,2>{0.97113198f, 0.942723215f},
-std::array<float,2>{0.13455902f, 0.409289837f},
-std::array<float,2>{0.773432076f, 0.342334628f},
-std::array<float,2>{0.108535357f, 0.758365154f},
-std::array<float,2>{0.525472403f, 0.519985914f},
-std::array<float,2>{0.290853411f, 0.12885271f},
-std::array<float,2>{0.854368508f, 0.12328618f},
-std::array<float,2>{0.0164022855f, 0.699365556f},
-std::array<float,2>{0.588479996f, 0.919644535f},
-std::array<float,2>{0.318722278f, 0.477022171f},
-std::array<float,2>{0.64395237f, 0.287431329f},
-std::array<float,2>{0.378813922f, 0.823007703f},
-std::array<float,2>{0.896873891f, 0.583202481f},
-std::array<float,2>{0.201036215f, 0.24219498f},
-std::array<float,2>{0.532438755f, 0.169372782f},
-std::array<float,2>{0.253313512f, 0.532247066f},
-std::array<float,2>{0.802159607f, 0.790854037f},
-std::array<float,2>{0.0730919987f, 0.353637993f},
-std::array<float,2>{0.9622159f, 0.387443066f},
-std::array<float,2>{0.171761975f, 0.999093592f},
-std::array<float,2>{0.729061961f, 0.662719548f},
-std::array<float,2>{0.494551003f, 0.0477304645f},
-std::array<float,2>{0.77604121f, 0.207241043f},
-std::array<float,2>{0.0977624431f, 0.620491028f},
-std::array<float,2>{0.520467877f, 0.872913778f},
-std::array<float,2>{0.288753986f, 0.256990075f},
-std::array<float,2>{0.709739387f, 0.464534193f},
-std::array<float,2>{0.445297539f, 0.885665536f},
-std::array<float,2>{0.980428815f, 0.737743676f},
-std::array<float,2>{0.12568824f, 0.0837795287f},
-std::array<float,2>{0.623815119f, 0.0147140836f},
-std::array<float,2>{0.365437627f, 0.626548886f},
-std::array<float,2>{0.834344506f, 0.95577395f},
-std::array<float,2>{0.032227885f, 0.433435768f},
-std::array<float,2>{0.920094132f, 0.325221241f},
-std::array<float,2>{0.239796296f, 0.767159045f},
-std::array<float,2>{0.668840349f, 0.51205641f},
-std::array<float,2>{0.421886593f, 0.155649528f},
-std::array<float,2>{0.960616946f, 0.108353831f},
-std::array<float,2>{0.16004318f, 0.718468904f},
-std::array<float,2>{0.723842025f, 0.933530211f},
-std::array<float,2>{0.486952335f, 0.48988837f},
-std::array<float,2>{0.546679795f, 0.301126122f},
-std::array<float,2>{0.259426713f, 0.840006888f},
-std::array<float,2>{0.811188459f, 0.572517633f},
-std::array<float,2>{0.0649491847f, 0.221613675f},
-std::array<float,2>{0.64952451f, 0.187134936f},
-std::array<float,2>{0.384338558f, 0.547865927f},
-std::array<float,2>{0.901683211f, 0.806367338f},
-std::array<float,2>{0.188567191f, 0.37232697f},
-std::array<float,2>{0.846209705f, 0.400094062f},
-std::array<float,2>{0.0295467172f, 0.978029728f},
-std::array<float,2>{0.578799665f, 0.679171264f},
-std::array<float,2>{0.325265855f, 0.0374713242f},
-std::array<float,2>{0.883209944f, 0.130265832f},
-std::array<float,2>{0.214074522f, 0.519201517f},
-std::array<float,2>{0.631289899f, 0.763332009f},
-std::array<float,2>{0.401438028f, 0.336729467f},
-std::array<float,2>{0.577534378f, 0.413828909f},
-std::array<float,2>{0.334711939f, 0.940686941f},
-std::array<float,2>{0.864961267f, 0.646995902f},
-std::array<float,2>{0.00274289143f, 0.0180466827f},
-std::array<float,2>{0.747308254f, 0.069251895f},
-std::array<float,2>{0.479382873f, 0.733200073f},
-std::array<float,2>{0.940905929f, 0.904978871f},
-std::array<float,2>{0.174118578f, 0.449507058f},
-std::array<float,2>{0.781838179f, 0.276513994f},
-std::array<float,2>{0.0918090716f, 0.849002242f},
-std::array<float,2>{0.552414775f, 0.607236087f},
-std::array<float,2>{0.268007874f, 0.200756192f},
-std::array<float,2>{0.816284597f, 0.0528322197f},
-std::array<float,2>{0.0536996685f, 0.65847367f},
-std::array<float,2>{0.60362941f, 0.995225549f},
-std::array<float,2>{0.34506461f, 0.384081095f},
-std::array<float,2>{0.679841578f, 0.356481642f},
-std::array<float,2>{0.413306653f, 0.794074535f},
-std::array<float,2>{0.934501767f, 0.536210835f},
-std::array<float,2>{0.218982577f, 0.167115331f},
-std::array<float,2>{0.513470232f, 0.249115735f},
-std::array<float,2>{0.301942676f, 0.579332054f},
-std::array<float,2>{0.752857566f, 0.825659811f},
-std::array<float,2>{0.111392163f, 0.284020126f},
-std::array<float,2>{0.987733364f, 0.483161777f},
-std::array<float,2>{0.154399589f, 0.915835738f},
-std::array<float,2>{0.70167613f, 0.695874393f},
-std::array<float,2>{0.461736888f, 0.118005268f},
-std::array<float,2>{0.86937362f, 0.158066586f},
-std::array<float,2>{0.0109314118f, 0.539252043f},
-std::array<float,2>{0.56776458f, 0.786613166f},
-std::array<float,2>{0.339378864f, 0.347909689f},
-std::array<float,2>{0.639262676f, 0.382607967f},
-std::array<float,2>{0.393569589f, 0.988864839f},
-std::array<float,2>{0.878073335f, 0.671337247f},
-std::array<float,2>{0.210524559f, 0.0560034104f},
-std::array<float,2>{0.555492938f, 0.113646708f},
-std::array<float,2>{0.275384635f, 0.689104378f},
-std::array<float,2>{0.796050072f, 0.91388005f},
-std::array<float,2>{0.0791123062f, 0.474634439f},
-std::array<float,2>{0.946767509f, 0.291510701f},
-std::array<float,2>{0.184044048f, 0.819270492f},
-std::array<float,2>{0.738656878f, 0.58804661f},
-std::array<float,2>{0.475210458f, 0.236468509f},
-std::array<float,2>{0.928663373f, 0.0275961794f},
-std::array<float,2>{0.233607978f, 0.650466323f},
-std::array<float,2>{0.679241419f, 0.95218575f},
-std::array<float,2>{0.4194282f, 0.418699771f},
-std::array<float,2>{0.596176445f, 0.331607759f},
-std::array<float,2>{0.358536661f, 0.75371325f},
-std::array<float,2>{0.820464134f, 0.531112552f},
-std::array<float,2>{0.0565463416f, 0.137555346f},
-std::array<float,2>{0.68877095f, 0.195091963f},
-std::array<float,2>{0.460689783f, 0.596417665f},
-std::array<float,2>{0.993458688f, 0.852250457f},
-std::array<float,2>{0.141076908f, 0.270239562f},
-std::array<float,2>{0.765130043f, 0.444576353f},
-std::array<float,2>{0.118256241f, 0.897590458f},
-std::array<float,2>{0.502080619f, 0.726090491f},
-std::array<float,2>{0.312068284f, 0.0774292126f},
-std::array<float,2>{0.973092437f, 0.232791901f},
-std::array<float,2>{0.138351545f, 0.567214847f},
-std::array<float,2>{0.711421549f, 0.833668649f},
-std::array<float,2>{0.452203482f, 0.305872858f},
-std::array<float,2>{0.530356884f, 0.496692151f},
-std::array<float,2>{0.29577148f, 0.929313064f},
-std::array<float,2>{0.768092871f, 0.703939676f},
-std::array<float,2>{0.102921315f, 0.0989372581f},
-std::array<float,2>{0.656800568f, 0.0430969372f},
-std::array<float,2>{0.434350073f, 0.687438965f},
-std::array<float,2>{0.911759734f, 0.975239336f},
-std::array<float,2>{0.24838689f, 0.394808263f},
-std::array<float,2>{0.841953278f, 0.367024601f},
-std::array<float,2>{0.0446506441f, 0.797644734f},
-std::array<float,2>{0.609789014f, 0.559518099f},
-std::array<float,2>{0.371648252f, 0.174269825f},
-std::array<float,2>{0.797470629f, 0.090750657f},
-std::array<float,2>{0.0755627379f, 0.749190331f},
-std::array<float,2>{0.5353778f, 0.881154418f},
-std::array<float,2>{0.256978095f, 0.455569118f},
-std::array<float,2>{0.731176436f, 0.265443444f},
-std::array<float,2>{0.498407483f, 0.863669276f},
-std::array<float,2>{0.966526091f, 0.613457382f},
-std::array<float,2>{0.167079106f, 0.213098317f},
-std::array<float,2>{0.593364656f, 0.146307096f},
-std::array<float,2>{0.314686596f, 0.50275749f},
-std::array<float,2>{0.859300673f, 0.779386222f},
-std::array<float,2>{0.0220382866f, 0.31398046f},
-std::array<float,2>{0.891040683f, 0.424739718f},
-std::array<float,2>{0.19814612f, 0.968532383f},
-std::array<float,2>{0.64624697f, 0.638981879f},
-std::array<float,2>{0.380312443f, 0.00482784165f},
-std::array<float,2>{0.868997753f, 0.236600637f},
-std::array<float,2>{0.00836035889f, 0.588167667f},
-std::array<float,2>{0.569822848f, 0.818999767f},
-std::array<float,2>{0.336922497f, 0.291877985f},
-std::array<float,2>{0.638519764f, 0.474932939f},
-std::array<float,2>{0.392088085f, 0.91357857f},
-std::array<float,2>{0.876551926f, 0.689236343f},
-std::array<float,2>{0.207099274f, 0.113502555f},
-std::array<float,2>{0.557731032f, 0.0558380373f},
-std::array<float,2>{0.27620995f, 0.671082795f},
-std::array<float,2>{0.793347239f, 0.98918277f},
-std::array<float,2>{0.0812687427f, 0.382450014f},
-std::array<float,2>{0.948014319f, 0.347677469f},
-std::array<float,2>{0.185847476f, 0.786248446f},
-std::array<float,2>{0.740594327f, 0.539323807f},
-std::array<float,2>{0.473254502f, 0.157757193f},
-std::array<float,2>{0.926181555f, 0.0771776736f},
-std::array<float,2>{0.230641976f, 0.726372123f},
-std::array<float,2>{0.675839961f, 0.89793247f},
-std::array<float,2>{0.421097726f, 0.444630921f},
-std::array<float,2>{0.595565081f, 0.270413697f},
-std::array<float,2>{0.355887502f, 0.852463901f},
-std::array<float,2>{0.82348156f, 0.596453547f},
-std::array<float,2>{0.0571338348f, 0.194911703f},
-std::array<float,2>{0.690551341f, 0.137311727f},
-std::array<float,2>{0.458577037f, 0.530813396f},
-std::array<float,2>{0.994688034f, 0.753418922f},
-std::array<float,2>{0.143658102f, 0.331982017f},
-std::array<float,2>{0.763345718f, 0.418816596f},
-std::array<float,2>{0.120448008f, 0.952606857f},
-std::array<float,2>{0.500730932f, 0.650740206f},
-std::array<float,2>{0.308851779f, 0.0273833871f},
-std::array<float,2>{0.976240575f, 0.173927337f},
-std::array<float,2>{0.138688013f, 0.55931747f},
-std::array<float,2>{0.71291858f, 0.79742372f},
-std::array<float,2>{0.449333906f, 0.366895199f},
-std::array<float,2>{0.527742326f, 0.394703537f},
-std::array<float,2>{0.293102056f, 0.975401461f},
-std::array<float,2>{0.766285121f, 0.687175572f},
-std::array<float,2>{0.104320042f, 0.0432855226f},
-std::array<float,2>{0.659997284f, 0.0988083482f},
-std::array<float,2>{0.436392367f, 0.703643799f},
-std::array<float,2>{0.912390172f, 0.929526627f},
-std::array<float,2>{0.246343091f, 0.497046113f},
-std::array<float,2>{0.841445386f, 0.305922657f},
-std::array<float,2>{0.0465825163f, 0.833942175f},
-std::array<float,2>{0.612288535f, 0.567028522f},
-std::array<float,2>{0.373548716f, 0.232505411f},
-std::array<float,2>{0.79979676f, 0.00461714901f},
-std::array<float,2>{0.0762480423f, 0.638836026f},
-std::array<float,2>{0.538559496f, 0.968429506f},
-std::array<float,2>{0.255020142f, 0.424500376f},
-std::array<float,2>{0.733567059f, 0.31424728f},
-std::array<float,2>{0.496626019f, 0.779599369f},
-std::array<float,2>{0.967934012f, 0.502577662f},
-std::array<float,2>{0.164602578f, 0.146023691f},
-std::array<float,2>{0.59019959f, 0.213326782f},
-std::array<float,2>{0.314003736f, 0.613620996f},
-std::array<float,2>{0.855481744f, 0.8634004f},
-std::array<float,2>{0.0205481146f, 0.265322715f},
-std::array<float,2>{0.893569052f, 0.455850214f},
-std::array<float,2>{0.196738347f, 0.880935311f},
-std::array<float,2>{0.647611082f, 0.749301851f},
-std::array<float,2>{0.38222757f, 0.0904884264f},
-std::array<float,2>{0.774688005f, 0.155379504f},
-std::array<float,2>{0.100025572f, 0.511735022f},
-std::array<float,2>{0.522955298f, 0.767496109f},
-std::array<float,2>{0.285532773f, 0.325602502f},
-std::array<float,2>{0.707252383f, 0.433319271f},
-std::array<float,2>{0.441741079f, 0.955845416f},
-std::array<float,2>{0.978095412f, 0.626871467f},
-std::array<float,2>{0.127733052f, 0.0151217384f},
-std::array<float,2>{0.622444093f, 0.0835891068f},
-std::array<float,2>{0.364206403f, 0.737492979f},
-std::array<float,2>{0.832675338f, 0.885443509f},
-std::array<float,2>{0.0345547572f, 0.464756608f},
-std::array<float,2>{0.91843158f, 0.257219195f},
-std::array<float,2>{0.240311116f, 0.872667491f},
-std::array<float,2>{0.670950353f, 0.620125175f},
-std::array<float,2>{0.425507903f, 0.207453325f},
-std::array<float,2>{0.95812428f, 0.037262056f},
-std::array<float,2>{0.157288104f, 0.678866267f},
-std::array<float,2>{0.724797428f, 0.978357136f},
-std::array<float,2>{0.484636456f, 0.400210083f},
-std::array<float,2>{0.544030845f, 0.372292727f},
-std::array<float,2>{0.260200679f, 0.806566536f},
-std::array<float,2>{0.808936357f, 0.548175156f},
-std::array<float,2>{0.0643861741f, 0.187365815f},
-std::array<float,2>{0.652308702f, 0.221348032f},
-std::array<float,2>{0.385536611f, 0.572437048f},
-std::array<float,2>{0.8993029f, 0.840331495f},
-std::array<float,2>{0.190118238f, 0.30094558f},
-std::array<float,2>{0.843769789f, 0.490112662f},
-std::array<float,2>{0.0289201159f, 0.933336318f},
-std::array<float,2>{0.580276072f, 0.718631089f},
-std::array<float,2>{0.32674396f, 0.108122818f},
-std::array<float,2>{0.886697352f, 0.200942472f},
-std::array<float,2>{0.211838081f, 0.607023299f},
-std::array<float,2>{0.629212379f, 0.848843694f},
-std::array<float,2>{0.398619711f, 0.276646286f},
-std::array<float,2>{0.57457459f, 0.449233204f},
-std::array<float,2>{0.332484335f, 0.905215859f},
-std::array<float,2>{0.865609527f, 0.733066857f},
-std::array<float,2>{0.00111124979f, 0.0689268336f},
-std::array<float,2>{0.749718308f, 0.0176280327f},
-std::array<float,2>{0.476615399f, 0.647341907f},
-std::array<float,2>{0.938077807f, 0.940587878f},
-std::array<float,2>{0.172018021f, 0.413584352f},
-std::array<float,2>{0.785074472f, 0.336526453f},
-std::array<float,2>{0.0906558856f, 0.76344502f},
-std::array<float,2>{0.554646611f, 0.519471526f},
-std::array<float,2>{0.267288446f, 0.129926637f},
-std::array<float,2>{0.814141631f, 0.117700011f},
-std::array<float,2>{0.0518325791f, 0.696179986f},
-std::array<float,2>{0.602781713f, 0.915701866f},
-std::array<float,2>{0.347342849f, 0.482941777f},
-std::array<float,2>{0.683247745f, 0.283787698f},
-std::array<float,2>{0.411361426f, 0.82526511f},
-std::array<float,2>{0.936656415f, 0.579561055f},
-std::array<float,2>{0.221629411f, 0.249292701f},
-std::array<float,2>{0.514151692f, 0.167472765f},
-std::array<float,2>{0.303717405f, 0.536386728f},
-std::array<float,2>{0.750152707f, 0.794267356f},
-std::array<float,2>{0.110844448f, 0.356824845f},
-std::array<float,2>{0.984881282f, 0.383980989f},
-std::array<float,2>{0.15354161f, 0.995378673f},
-std::array<float,2>{0.699572504f, 0.658257067f},
-std::array<float,2>{0.463853419f, 0.0531242676f},
-std::array<float,2>{0.789239824f, 0.204148874f},
-std::array<float,2>{0.0855959058f, 0.624325812f},
-std::array<float,2>{0.559818327f, 0.868164301f},
-std::array<float,2>{0.281227201f, 0.250600547f},
-std::array<float,2>{0.735588372f, 0.468477577f},
-std::array<float,2>{0.471431851f, 0.890320241f},
-std::array<float,2>{0.951053321f, 0.739403963f},
-std::array<float,2>{0.17980808f, 0.0809978247f},
-std::array<float,2>{0.565287471f, 0.00994686969f},
-std::array<float,2>{0.343447953f, 0.629906476f},
-std::array<float,2>{0.873375177f, 0.960150063f},
-std::array<float,2>{0.0133340945f, 0.436844707f},
-std::array<float,2>{0.88012892f, 0.320863038f},
-std::array<float,2>{0.206653208f, 0.769938946f},
-std::array<float,2>{0.636283934f, 0.509146512f},
-std::array<float,2>{0.396064311f, 0.150174975f},
-std::array<float,2>{0.998099566f, 0.104532912f},
-std::array<float,2>{0.147677884f, 0.714311302f},
-std::array<float,2>{0.695143282f, 0.937097311f},
-std::array<float,2>{0.454857081f, 0.486126155f},
-std::array<float,2>{0.505030036f, 0.29775539f},
-std::array<float,2>{0.306743234f, 0.839321733f},
-std::array<float,2>{0.758536816f, 0.57733959f},
-std::array<float,2>{0.121458478f, 0.223244339f},
-std::array<float,2>{0.67307812f, 0.183260784f},
-std::array<float,2>{0.417576075f, 0.552000642f},
-std::array<float,2>{0.923008323f, 0.811512887f},
-std::array<float,2>{0.227811724f, 0.370949626f},
-std::array<float,2>{0.827841103f, 0.405187517f},
-std::array<float,2>{0.0609593205f, 0.980579495f},
-std::array<float,2>{0.5981071f, 0.672777593f},
-std::array<float,2>{0.351874143f, 0.0342185348f},
-std::array<float,2>{0.908699334f, 0.128420502f},
-std::array<float,2>{0.243220374f, 0.519746661f},
-std::array<float,2>{0.661299288f, 0.758576334f},
-std::array<float,2>{0.431422859f, 0.342579484f},
-std::array<float,2>{0.615832984f, 0.409651786f},
-std::array<float,2>{0.36868614f, 0.942500532f},
-std::array<float,2>{0.836213648f, 0.643413186f},
-std::array<float,2>{0.0415184312f, 0.0222708564f},
-std::array<float,2>{0.715963185f, 0.0650214031f},
-std::array<float,2>{0.448140919f, 0.728318751f},
-std::array<float,2>{0.969412208f, 0.900502861f},
-std::array<float,2>{0.135749295f, 0.446759969f},
-std::array<float,2>{0.770568132f, 0.277970523f},
-std::array<float,2>{0.106520288f, 0.846287608f},
-std::array<float,2>{0.524712801f, 0.603371799f},
-std::array<float,2>{0.291760117f, 0.196413532f},
-std::array<float,2>{0.852911174f, 0.0474023223f},
-std::array<float,2>{0.0181599595f, 0.662898719f},
-std::array<float,2>{0.587310433f, 0.999302328f},
-std::array<float,2>{0.316998899f, 0.387461632f},
-std::array<float,2>{0.642304122f, 0.353851676f},
-std::array<float,2>{0.375160992f, 0.790644526f},
-std::array<float,2>{0.896069467f, 0.532630682f},
-std::array<float,2>{0.201999307f, 0.169119209f},
-std::array<float,2>{0.533621371f, 0.242505908f},
-std::array<float,2>{0.251530856f, 0.583433211f},
-std::array<float,2>{0.804488838f, 0.822981f},
-std::array<float,2>{0.0706272945f, 0.287151664f},
-std::array<float,2>{0.963548541f, 0.476749271f},
-std::array<float,2>{0.168949097f, 0.919874728f},
-std::array<float,2>{0.727185845f, 0.69968468f},
-std::array<float,2>{0.49260506f, 0.123445049f},
-std::array<float,2>{0.830362916f, 0.161921188f},
-std::array<float,2>{0.0359781981f, 0.546191037f},
-std::array<float,2>{0.618070364f, 0.785089016f},
-std::array<float,2>{0.361400366f, 0.34630692f},
-std::array<float,2>{0.664558053f, 0.37683627f},
-std::array<float,2>{0.426477283f, 0.988001645f},
-std::array<float,2>{0.914558351f, 0.664292753f},
-std::array<float,2>{0.237099811f, 0.0591364615f},
-std::array<float,2>{0.516793132f, 0.113180868f},
-std::array<float,2>{0.283730388f, 0.692020833f},
-std::array<float,2>{0.779200196f, 0.908177137f},
-std::array<float,2>{0.0937697515f, 0.469528109f},
-std::array<float,2>{0.980611563f, 0.295541883f},
-std::array<float,2>{0.130254611f, 0.814708471f},
-std::array<float,2>{0.704894781f, 0.590971649f},
-std::array<float,2>{0.440107584f, 0.23931022f},
-std::array<float,2>{0.902757823f, 0.0235097408f},
-std::array<float,2>{0.194422811f, 0.654358149f},
-std::array<float,2>{0.654738545f, 0.948806465f},
-std::array<float,2>{0.387919724f, 0.416668653f},
-std::array<float,2>{0.582702875f, 0.334556073f},
-std::array<float,2>{0.32267338f, 0.754239619f},
-std::array<float,2>{0.850960433f, 0.526698947f},
-std::array<float,2>{0.0240915939f, 0.132850423f},
-std::array<float,2>{0.722177029f, 0.191304609f},
-std::array<float,2>{0.488537699f, 0.601153314f},
-std::array<float,2>{0.956641734f, 0.856805325f},
-std::array<float,2>{0.162843958f, 0.266564161f},
-std::array<float,2>{0.807959735f, 0.440245539f},
-std::array<float,2>{0.0680813193f, 0.893653095f},
-std::array<float,2>{0.539450824f, 0.721639454f},
-std::array<float,2>{0.262259156f, 0.0705059096f},
-std::array<float,2>{0.944908798f, 0.227835178f},
-std::array<float,2>{0.178268149f, 0.562674582f},
-std::array<float,2>{0.74230063f, 0.831536233f},
-std::array<float,2>{0.481839001f, 0.311105639f},
-std::array<float,2>{0.549049973f, 0.493422151f},
-std::array<float,2>{0.269674122f, 0.922946453f},
-std::array<float,2>{0.787435174f, 0.710595071f},
-std::array<float,2>{0.0865905583f, 0.0948669463f},
-std::array<float,2>{0.626343668f, 0.0422297344f},
-std::array<float,2>{0.406222135f, 0.682035506f},
-std::array<float,2>{0.886815429f, 0.969229639f},
-std::array<float,2>{0.215288177f, 0.393987209f},
-std::array<float,2>{0.862736762f, 0.361832142f},
-std::array<float,2>{0.0067743035f, 0.803566277f},
-std::array<float,2>{0.571005285f, 0.558441341f},
-std::array<float,2>{0.330272645f, 0.178444907f},
-std::array<float,2>{0.756459355f, 0.0889781862f},
-std::array<float,2>{0.116182357f, 0.744125366f},
-std::array<float,2>{0.508199811f, 0.876178503f},
-std::array<float,2>{0.299147427f, 0.458209544f},
-std::array<float,2>{0.696891904f, 0.25871852f},
-std::array<float,2>{0.467727393f, 0.860845387f},
-std::array<float,2>{0.988950551f, 0.61014092f},
-std::array<float,2>{0.150626391f, 0.217915729f},
-std::array<float,2>{0.608773291f, 0.142051011f},
-std::array<float,2>{0.348990411f, 0.504599631f},
-std::array<float,2>{0.818244278f, 0.776118398f},
-std::array<float,2>{0.0495173968f, 0.316855311f},
-std::array<float,2>{0.932419837f, 0.42644015f},
-std::array<float,2>{0.226383328f, 0.963154614f},
-std::array<float,2>{0.685697317f, 0.634456754f},
-std::array<float,2>{0.406674743f, 0.0024377408f},
-std::array<float,2>{0.82161516f, 0.191635773f},
-std::array<float,2>{0.0552633591f, 0.593974233f},
-std::array<float,2>{0.597369432f, 0.854852498f},
-std::array<float,2>{0.35775277f, 0.271683663f},
-std::array<float,2>{0.678516924f, 0.441707462f},
-std::array<float,2>{0.418762505f, 0.895874739f},
-std::array<float,2>{0.928756535f, 0.724049807f},
-std::array<float,2>{0.232730865f, 0.0749336556f},
-std::array<float,2>{0.503226936f, 0.0301823113f},
-std::array<float,2>{0.311418623f, 0.65003258f},
-std::array<float,2>{0.764423549f, 0.949898303f},
-std::array<float,2>{0.118024349f, 0.420705229f},
-std::array<float,2>{0.993142188f, 0.328319103f},
-std::array<float,2>{0.142369032f, 0.750314176f},
-std::array<float,2>{0.687635839f, 0.52760303f},
-std::array<float,2>{0.459807515f, 0.139549419f},
-std::array<float,2>{0.877196014f, 0.115572669f},
-std::array<float,2>{0.20947361f, 0.689874291f},
-std::array<float,2>{0.640289187f, 0.91180104f},
-std::array<float,2>{0.392612189f, 0.473070443f},
-std::array<float,2>{0.566690922f, 0.290281683f},
-std::array<float,2>{0.33851999f, 0.817180812f},
-std::array<float,2>{0.870622933f, 0.586706221f},
-std::array<float,2>{0.0100478642f, 0.23557803f},
-std::array<float,2>{0.739329636f, 0.159629494f},
-std::array<float,2>{0.475693256f, 0.542522192f},
-std::array<float,2>{0.945806026f, 0.788048863f},
-std::array<float,2>{0.184790373f, 0.350091934f},
-std::array<float,2>{0.795879662f, 0.379614651f},
-std::array<float,2>{0.0785875097f, 0.990606904f},
-std::array<float,2>{0.556633592f, 0.668092072f},
-std::array<float,2>{0.273613572f, 0.057024911f},
-std::array<float,2>{0.965165675f, 0.147248417f},
-std::array<float,2>{0.166794702f, 0.501142085f},
-std::array<float,2>{0.732235432f, 0.777845681f},
-std::array<float,2>{0.499749988f, 0.316033781f},
-std::array<float,2>{0.536771894f, 0.422080696f},
-std::array<float,2>{0.256553471f, 0.965510905f},
-std::array<float,2>{0.798811615f, 0.637286127f},
-std::array<float,2>{0.0750380829f, 0.00699173799f},
-std::array<float,2>{0.645011544f, 0.0929085761f},
-std::array<float,2>{0.379259676f, 0.74726218f},
-std::array<float,2>{0.892204583f, 0.880400121f},
-std::array<float,2>{0.198585138f, 0.454263389f},
-std::array<float,2>{0.857915699f, 0.262251258f},
-std::array<float,2>{0.0224633049f, 0.865850329f},
-std::array<float,2>{0.592053473f, 0.617108643f},
-std::array<float,2>{0.315760285f, 0.211538941f},
-std::array<float,2>{0.76888895f, 0.0451759696f},
-std::array<float,2>{0.102474652f, 0.683962643f},
-std::array<float,2>{0.529941201f, 0.97333771f},
-std::array<float,2>{0.296237856f, 0.397883147f},
-std::array<float,2>{0.712839246f, 0.364797384f},
-std::array<float,2>{0.451331437f, 0.799034119f},
-std::array<float,2>{0.973897517f, 0.561401248f},
-std::array<float,2>{0.137558877f, 0.172924221f},
-std::array<float,2>{0.610544801f, 0.232010394f},
-std::array<float,2>{0.372786254f, 0.568973064f},
-std::array<float,2>{0.842946708f, 0.835324347f},
-std::array<float,2>{0.0431128219f, 0.307672977f},
-std::array<float,2>{0.910864115f, 0.499007553f},
-std::array<float,2>{0.249528468f, 0.926812351f},
-std::array<float,2>{0.6580441f, 0.705427527f},
-std::array<float,2>{0.435304254f, 0.101266079f},
-std::array<float,2>{0.812362373f, 0.184088081f},
-std::array<float,2>{0.0663685724f, 0.549743056f},
-std::array<float,2>{0.545366645f, 0.808503747f},
-std::array<float,2>{0.258443177f, 0.374816179f},
-std::array<float,2>{0.723442972f, 0.400993258f},
-std::array<float,2>{0.487501562f, 0.979181945f},
-std::array<float,2>{0.959506214f, 0.676847398f},
-std::array<float,2>{0.158263579f, 0.0352024287f},
-std::array<float,2>{0.579964876f, 0.106782123f},
-std::array<float,2>{0.324378699f, 0.715830088f},
-std::array<float,2>{0.847231805f, 0.93058008f},
-std::array<float,2>{0.0307607986f, 0.491088986f},
-std::array<float,2>{0.900639653f, 0.303435087f},
-std::array<float,2>{0.188392073f, 0.842431843f},
-std::array<float,2>{0.649081945f, 0.571153581f},
-std::array<float,2>{0.383684546f, 0.220360875f},
-std::array<float,2>{0.978715956f, 0.0122978315f},
-std::array<float,2>{0.126645416f, 0.62749815f},
-std::array<float,2>{0.710448086f, 0.954816222f},
-std::array<float,2>{0.443971872f, 0.430700749f},
-std::array<float,2>{0.521363974f, 0.326954603f},
-std::array<float,2>{0.287886083f, 0.768807709f},
-std::array<float,2>{0.776879609f, 0.515252531f},
-std::array<float,2>{0.0988113657f, 0.153077438f},
-std::array<float,2>{0.669010878f, 0.210481897f},
-std::array<float,2>{0.423720539f, 0.617209852f},
-std::array<float,2>{0.921124101f, 0.873769939f},
-std::array<float,2>{0.238514245f, 0.254846901f},
-std::array<float,2>{0.835809469f, 0.461861283f},
-std::array<float,2>{0.0317065641f, 0.883082926f},
-std::array<float,2>{0.624502301f, 0.73620522f},
-std::array<float,2>{0.367109984f, 0.0847925618f},
-std::array<float,2>{0.935423017f, 0.246638656f},
-std::array<float,2>{0.220343634f, 0.580087066f},
-std::array<float,2>{0.681164682f, 0.82725352f},
-std::array<float,2>{0.412300259f, 0.281559289f},
-std::array<float,2>{0.605403781f, 0.48052606f},
-std::array<float,2>{0.344327837f, 0.917723477f},
-std::array<float,2>{0.814496577f, 0.697330832f},
-std::array<float,2>{0.0546742752f, 0.120005302f},
-std::array<float,2>{0.702154875f, 0.0513290539f},
-std::array<float,2>{0.462169498f, 0.657980382f},
-std::array<float,2>{0.986859024f, 0.992427647f},
-std::array<float,2>{0.155667096f, 0.38481167f},
-std::array<float,2>{0.753279924f, 0.358817637f},
-std::array<float,2>{0.112436228f, 0.79675132f},
-std::array<float,2>{0.512645781f, 0.538660705f},
-std::array<float,2>{0.300999939f, 0.166015401f},
-std::array<float,2>{0.863485873f, 0.0673143491f},
-std::array<float,2>{0.00323391263f, 0.732119441f},
-std::array<float,2>{0.576588392f, 0.904240668f},
-std::array<float,2>{0.335635662f, 0.453022033f},
-std::array<float,2>{0.63208878f, 0.273617983f},
-std::array<float,2>{0.40119338f, 0.850585639f},
-std::array<float,2>{0.884249628f, 0.608979166f},
-std::array<float,2>{0.213313118f, 0.202181429f},
-std::array<float,2>{0.550825298f, 0.132098496f},
-std::array<float,2>{0.269227356f, 0.517217994f},
-std::array<float,2>{0.782249928f, 0.764149547f},
-std::array<float,2>{0.0929506943f, 0.339200497f},
-std::array<float,2>{0.940125883f, 0.411456972f},
-std::array<float,2>{0.175622448f, 0.938586116f},
-std::array<float,2>{0.746792674f, 0.645707071f},
-std::array<float,2>{0.480119348f, 0.016549645f},
-std::array<float,2>{0.76090759f, 0.225569159f},
-std::array<float,2>{0.123426028f, 0.574943602f},
-std::array<float,2>{0.506573737f, 0.837770045f},
-std::array<float,2>{0.304791063f, 0.300041735f},
-std::array<float,2>{0.692023158f, 0.48732546f},
-std::array<float,2>{0.456406444f, 0.93534404f},
-std::array<float,2>{0.996268213f, 0.711490989f},
-std::array<float,2>{0.145634845f, 0.10245204f},
-std::array<float,2>{0.600760937f, 0.0325531699f},
-std::array<float,2>{0.353940427f, 0.675197005f},
-std::array<float,2>{0.825427592f, 0.98339361f},
-std::array<float,2>{0.0586156622f, 0.403321415f},
-std::array<float,2>{0.924244881f, 0.367798746f},
-std::array<float,2>{0.229827747f, 0.8092044f},
-std::array<float,2>{0.674986482f, 0.55428493f},
-std::array<float,2>{0.415196419f, 0.179895133f},
-std::array<float,2>{0.951345384f, 0.0800317898f},
-std::array<float,2>{0.182045624f, 0.740487099f},
-std::array<float,2>{0.73673743f, 0.888117194f},
-std::array<float,2>{0.469208717f, 0.464973807f},
-std::array<float,2>{0.560950339f, 0.253439307f},
-std::array<float,2>{0.277642548f, 0.870337665f},
-std::array<float,2>{0.791502416f, 0.621565342f},
-std::array<float,2>{0.0834664255f, 0.205322891f},
-std::array<float,2>{0.634258449f, 0.151974618f},
-std::array<float,2>{0.396688193f, 0.510720968f},
-std::array<float,2>{0.88194561f, 0.772613406f},
-std::array<float,2>{0.203987554f, 0.323683321f},
-std::array<float,2>{0.872782886f, 0.435013622f},
-std::array<float,2>{0.0142929833f, 0.958291113f},
-std::array<float,2>{0.56306237f, 0.632552981f},
-std::array<float,2>{0.341249824f, 0.00823843945f},
-std::array<float,2>{0.897870898f, 0.170254409f},
-std::array<float,2>{0.199492499f, 0.534788787f},
-std::array<float,2>{0.643284202f, 0.792883337f},
-std::array<float,2>{0.377747595f, 0.352227896f},
-std::array<float,2>{0.589201391f, 0.390433192f},
-std::array<float,2>{0.319674343f, 0.997291684f},
-std::array<float,2>{0.854621589f, 0.662067294f},
-std::array<float,2>{0.0173977911f, 0.0491932295f},
-std::array<float,2>{0.730408132f, 0.122124873f},
-std::array<float,2>{0.495619565f, 0.702777505f},
-std::array<float,2>{0.961110175f, 0.920273602f},
-std::array<float,2>{0.169933408f, 0.479356527f},
-std::array<float,2>{0.800933957f, 0.286923349f},
-std::array<float,2>{0.0734270215f, 0.820987403f},
-std::array<float,2>{0.531696618f, 0.584933043f},
-std::array<float,2>{0.25254187f, 0.244907364f},
-std::array<float,2>{0.83796227f, 0.0196138471f},
-std::array<float,2>{0.0391638242f, 0.642470181f},
-std::array<float,2>{0.614109814f, 0.943429768f},
-std::array<float,2>{0.369360507f, 0.406371295f},
-std::array<float,2>{0.662625611f, 0.340139687f},
-std::array<float,2>{0.432918578f, 0.761579335f},
-std::array<float,2>{0.906900823f, 0.523193181f},
-std::array<float,2>{0.244631425f, 0.126245707f},
-std::array<float,2>{0.526703298f, 0.198089123f},
-std::array<float,2>{0.28909269f, 0.605287492f},
-std::array<float,2>{0.771588326f, 0.844511807f},
-std::array<float,2>{0.108194098f, 0.280758232f},
-std::array<float,2>{0.971730411f, 0.44807294f},
-std::array<float,2>{0.132845223f, 0.898621023f},
-std::array<float,2>{0.717254817f, 0.728677094f},
-std::array<float,2>{0.445406765f, 0.0627943277f},
-std::array<float,2>{0.849097013f, 0.135915145f},
-std::array<float,2>{0.0265621785f, 0.52412349f},
-std::array<float,2>{0.584148169f, 0.757621586f},
-std::array<float,2>{0.321162492f, 0.332400292f},
-std::array<float,2>{0.65424192f, 0.414283335f},
-std::array<float,2>{0.388849348f, 0.946827412f},
-std::array<float,2>{0.905240715f, 0.653100073f},
-std::array<float,2>{0.192964032f, 0.0270856246f},
-std::array<float,2>{0.54118371f, 0.0739818439f},
-std::array<float,2>{0.264748126f, 0.720061541f},
-std::array<float,2>{0.805571675f, 0.891157329f},
-std::array<float,2>{0.0700267181f, 0.438468635f},
-std::array<float,2>{0.95379293f, 0.268924683f},
-std::array<float,2>{0.160783902f, 0.858274519f},
-std::array<float,2>{0.720215082f, 0.599497676f},
-std::array<float,2>{0.491654038f, 0.187808394f},
-std::array<float,2>{0.917734206f, 0.0615724772f},
-std::array<float,2>{0.236216858f, 0.666941643f},
-std::array<float,2>{0.666334391f, 0.985164523f},
-std::array<float,2>{0.429290146f, 0.378680617f},
-std::array<float,2>{0.620619178f, 0.344147861f},
-std::array<float,2>{0.360824078f, 0.782935321f},
-std::array<float,2>{0.829271436f, 0.543504238f},
-std::array<float,2>{0.0374382026f, 0.162823319f},
-std::array<float,2>{0.705241442f, 0.240776315f},
-std::array<float,2>{0.439009517f, 0.592705131f},
-std::array<float,2>{0.982828677f, 0.814042628f},
-std::array<float,2>{0.131300628f, 0.294016957f},
-std::array<float,2>{0.781041145f, 0.471244961f},
-std::array<float,2>{0.0961501747f, 0.908901691f},
-std::array<float,2>{0.518996119f, 0.693974316f},
-std::array<float,2>{0.282011867f, 0.110371836f},
-std::array<float,2>{0.992047906f, 0.21636641f},
-std::array<float,2>{0.149002731f, 0.612532079f},
-std::array<float,2>{0.697411716f, 0.862630069f},
-std::array<float,2>{0.465187699f, 0.26092577f},
-std::array<float,2>{0.51068306f, 0.459943891f},
-std::array<float,2>{0.298357069f, 0.878848374f},
-std::array<float,2>{0.755658448f, 0.74557662f},
-std::array<float,2>{0.114975803f, 0.0860572159f},
-std::array<float,2>{0.683677435f, 0.000272298959f},
-std::array<float,2>{0.408807725f, 0.636449695f},
-std::array<float,2>{0.930198193f, 0.961069286f},
-std::array<float,2>{0.224336088f, 0.429279119f},
-std::array<float,2>{0.819445848f, 0.32030043f},
-std::array<float,2>{0.0474259071f, 0.773984551f},
-std::array<float,2>{0.606092572f, 0.506802797f},
-std::array<float,2>{0.350280523f, 0.143474251f},
-std::array<float,2>{0.786212802f, 0.096613735f},
-std::array<float,2>{0.0896505564f, 0.707741678f},
-std::array<float,2>{0.547330439f, 0.924232066f},
-std::array<float,2>{0.271691829f, 0.495617688f},
-std::array<float,2>{0.745716989f, 0.310277492f},
-std::array<float,2>{0.483819932f, 0.829327583f},
-std::array<float,2>{0.942838013f, 0.564662695f},
-std::array<float,2>{0.175823212f, 0.228842884f},
-std::array<float,2>{0.573700905f, 0.177072853f},
-std::array<float,2>{0.328347772f, 0.556301951f},
-std::array<float,2>{0.860675931f, 0.801013887f},
-std::array<float,2>{0.00491586514f, 0.359452963f},
-std::array<float,2>{0.889502406f, 0.392413497f},
-std::array<float,2>{0.217329174f, 0.972497165f},
-std::array<float,2>{0.627499938f, 0.679832757f},
-std::array<float,2>{0.40345186f, 0.0408681892f},
-std::array<float,2>{0.856506586f, 0.21269165f},
-std::array<float,2>{0.0204344187f, 0.615342021f},
-std::array<float,2>{0.590942383f, 0.866277575f},
-std::array<float,2>{0.313238412f, 0.263220251f},
-std::array<float,2>{0.647193193f, 0.453454375f},
-std::array<float,2>{0.381331712f, 0.879420936f},
-std::array<float,2>{0.892725885f, 0.74643445f},
-std::array<float,2>{0.196210399f, 0.0926776975f},
-std::array<float,2>{0.537350655f, 0.00591119099f},
-std::array<float,2>{0.254561931f, 0.637887895f},
-std::array<float,2>{0.800067604f, 0.96650058f},
-std::array<float,2>{0.077496402f, 0.423223615f},
-std::array<float,2>{0.967487752f, 0.314979315f},
-std::array<float,2>{0.165397391f, 0.778882742f},
-std::array<float,2>{0.732677937f, 0.500907719f},
-std::array<float,2>{0.497808039f, 0.148365021f},
-std::array<float,2>{0.913220167f, 0.0999881923f},
-std::array<float,2>{0.247616276f, 0.706619978f},
-std::array<float,2>{0.658833683f, 0.925961673f},
-std::array<float,2>{0.436898172f, 0.499943674f},
-std::array<float,2>{0.612406194f, 0.306695968f},
-std::array<float,2>{0.374822706f, 0.834813535f},
-std::array<float,2>{0.840420246f, 0.57010591f},
-std::array<float,2>{0.045028992f, 0.230494693f},
-std::array<float,2>{0.714046538f, 0.172439948f},
-std::array<float,2>{0.451151162f, 0.562298536f},
-std::array<float,2>{0.97481668f, 0.800041854f},
-std::array<float,2>{0.140195251f, 0.36375621f},
-std::array<float,2>{0.766698539f, 0.396685123f},
-std::array<float,2>{0.10462594f, 0.973815799f},
-std::array<float,2>{0.528870046f, 0.685071588f},
-std::array<float,2>{0.294857919f, 0.0463908203f},
-std::array<float,2>{0.995552242f, 0.140053332f},
-std::array<float,2>{0.143543139f, 0.529141188f},
-std::array<float,2>{0.689589858f, 0.751732826f},
-std::array<float,2>{0.457948864f, 0.329812765f},
-std::array<float,2>{0.501823604f, 0.421791583f},
-std::array<float,2>{0.309911788f, 0.950570226f},
-std::array<float,2>{0.761940181f, 0.649291813f},
-std::array<float,2>{0.120006263f, 0.0302775651f},
-std::array<float,2>{0.677298903f, 0.0760769993f},
-std::array<float,2>{0.420848191f, 0.723494947f},
-std::array<float,2>{0.926932156f, 0.894774199f},
-std::array<float,2>{0.231880829f, 0.443001539f},
-std::array<float,2>{0.822698832f, 0.272856921f},
-std::array<float,2>{0.057768967f, 0.854342163f},
-std::array<float,2>{0.593864202f, 0.595269918f},
-std::array<float,2>{0.356877923f, 0.193194687f},
-std::array<float,2>{0.794577599f, 0.0578213446f},
-std::array<float,2>{0.0804547668f, 0.66908282f},
-std::array<float,2>{0.557070434f, 0.991459727f},
-std::array<float,2>{0.276640534f, 0.380638182f},
-std::array<float,2>{0.741731942f, 0.35066399f},
-std::array<float,2>{0.474330366f, 0.788328946f},
-std::array<float,2>{0.94896245f, 0.54112035f},
-std::array<float,2>{0.187292144f, 0.158345655f},
-std::array<float,2>{0.56880033f, 0.234444782f},
-std::array<float,2>{0.336323529f, 0.587007582f},
-std::array<float,2>{0.867636859f, 0.817583084f},
-std::array<float,2>{0.0096115768f, 0.289093137f},
-std::array<float,2>{0.875492692f, 0.473819196f},
-std::array<float,2>{0.208273202f, 0.910992622f},
-std::array<float,2>{0.636879504f, 0.6910671f},
-std::array<float,2>{0.390895367f, 0.116958067f},
-std::array<float,2>{0.75120914f, 0.164615005f},
-std::array<float,2>{0.110024326f, 0.538049817f},
-std::array<float,2>{0.515294552f, 0.795425415f},
-std::array<float,2>{0.30366081f, 0.358281672f},
-std::array<float,2>{0.700966001f, 0.386048287f},
-std::array<float,2>{0.464373767f, 0.993530989f},
-std::array<float,2>{0.98536092f, 0.657205999f},
-std::array<float,2>{0.153201953f, 0.0523690656f},
-std::array<float,2>{0.602306604f, 0.120456785f},
-std::array<float,2>{0.346331745f, 0.698639691f},
-std::array<float,2>{0.813281655f, 0.916232526f},
-std::array<float,2>{0.0514115728f, 0.481865168f},
-std::array<float,2>{0.936136961f, 0.282431573f},
-std::array<float,2>{0.222024977f, 0.826570272f},
-std::array<float,2>{0.682359278f, 0.581378043f},
-std::array<float,2>{0.410399288f, 0.247680545f},
-std::array<float,2>{0.939368129f, 0.016854044f},
-std::array<float,2>{0.173375919f, 0.644542396f},
-std::array<float,2>{0.748369277f, 0.937878728f},
-std::array<float,2>{0.477909118f, 0.410283387f},
-std::array<float,2>{0.553233385f, 0.338168204f},
-std::array<float,2>{0.266122431f, 0.765114725f},
-std::array<float,2>{0.784003854f, 0.516328335f},
-std::array<float,2>{0.0909206048f, 0.131415948f},
-std::array<float,2>{0.630239069f, 0.201616734f},
-std::array<float,2>{0.399579644f, 0.607808173f},
-std::array<float,2>{0.88486284f, 0.850940108f},
-std::array<float,2>{0.212704062f, 0.275360823f},
-std::array<float,2>{0.866610944f, 0.451549023f},
-std::array<float,2>{0.000169417675f, 0.90257895f},
-std::array<float,2>{0.575987697f, 0.731233716f},
-std::array<float,2>{0.333116829f, 0.0675792769f},
-std::array<float,2>{0.900312364f, 0.219352737f},
-std::array<float,2>{0.191248447f, 0.572073579f},
-std::array<float,2>{0.650687695f, 0.843496561f},
-std::array<float,2>{0.386271775f, 0.304384202f},
-std::array<float,2>{0.581407368f, 0.491793305f},
-std::array<float,2>{0.327791542f, 0.93134439f},
-std::array<float,2>{0.845289171f, 0.715143085f},
-std::array<float,2>{0.0277681574f, 0.105760664f},
-std::array<float,2>{0.726349771f, 0.0367791615f},
-std::array<float,2>{0.486312777f, 0.675821662f},
-std::array<float,2>{0.9575122f, 0.979631901f},
-std::array<float,2>{0.157028764f, 0.40144527f},
-std::array<float,2>{0.809797108f, 0.373630166f},
-std::array<float,2>{0.0625931546f, 0.807293713f},
-std::array<float,2>{0.543130696f, 0.550331771f},
-std::array<float,2>{0.260948062f, 0.185241491f},
-std::array<float,2>{0.833566546f, 0.0853316709f},
-std::array<float,2>{0.0338455103f, 0.73446393f},
-std::array<float,2>{0.621557117f, 0.884206235f},
-std::array<float,2>{0.365160733f, 0.462528884f},
-std::array<float,2>{0.670633614f, 0.255303711f},
-std::array<float,2>{0.424488962f, 0.874351978f},
-std::array<float,2>{0.919278502f, 0.618702114f},
-std::array<float,2>{0.241251528f, 0.209124267f},
-std::array<float,2>{0.522396207f, 0.153349176f},
-std::array<float,2>{0.286757231f, 0.513694644f},
-std::array<float,2>{0.773639858f, 0.767637312f},
-std::array<float,2>{0.101463638f, 0.327189118f},
-std::array<float,2>{0.976665318f, 0.430183053f},
-std::array<float,2>{0.127947569f, 0.953429222f},
-std::array<float,2>{0.708026528f, 0.628719151f},
-std::array<float,2>{0.443037957f, 0.0135573251f},
-std::array<float,2>{0.802883565f, 0.2452209f},
-std::array<float,2>{0.071527712f, 0.58562845f},
-std::array<float,2>{0.534673274f, 0.821573019f},
-std::array<float,2>{0.250120074f, 0.285534889f},
-std::array<float,2>{0.72816062f, 0.479855865f},
-std::array<float,2>{0.494116157f, 0.921777606f},
-std::array<float,2>{0.964350939f, 0.701742649f},
-std::array<float,2>{0.168128625f, 0.121515997f},
-std::array<float,2>{0.586520374f, 0.0501832217f},
-std::array<float,2>{0.317710012f, 0.660832882f},
-std::array<float,2>{0.851976633f, 0.996932089f},
-std::array<float,2>{0.0187855083f, 0.389277905f},
-std::array<float,2>{0.89475596f, 0.352826715f},
-std::array<float,2>{0.202906936f, 0.791834474f},
-std::array<float,2>{0.641569734f, 0.533549011f},
-std::array<float,2>{0.376634747f, 0.171592653f},
-std::array<float,2>{0.970681667f, 0.0642481595f},
-std::array<float,2>{0.135457948f, 0.72950834f},
-std::array<float,2>{0.71500051f, 0.89955771f},
-std::array<float,2>{0.448628038f, 0.449146807f},
-std::array<float,2>{0.523771524f, 0.279324234f},
-std::array<float,2>{0.292044282f, 0.845288634f},
-std::array<float,2>{0.770137548f, 0.60409677f},
-std::array<float,2>{0.106122963f, 0.198739573f},
-std::array<float,2>{0.661109388f, 0.125529587f},
-std::array<float,2>{0.429770082f, 0.521908283f},
-std::array<float,2>{0.91009295f, 0.760614872f},
-std::array<float,2>{0.242584541f, 0.341073275f},
-std::array<float,2>{0.837316334f, 0.407548904f},
-std::array<float,2>{0.0428908318f, 0.945187509f},
-std::array<float,2>{0.616939306f, 0.641460896f},
-std::array<float,2>{0.368043542f, 0.0206237696f},
-std::array<float,2>{0.922558308f, 0.181439683f},
-std::array<float,2>{0.226963639f, 0.553453147f},
-std::array<float,2>{0.672851503f, 0.810517848f},
-std::array<float,2>{0.416418165f, 0.36894083f},
-std::array<float,2>{0.599426866f, 0.402707726f},
-std::array<float,2>{0.352995098f, 0.984066486f},
-std::array<float,2>{0.826647043f, 0.6741395f},
-std::array<float,2>{0.0620076507f, 0.0314379372f},
-std::array<float,2>{0.694124043f, 0.102886148f},
-std::array<float,2>{0.453464061f, 0.712431788f},
-std::array<float,2>{0.999628961f, 0.934063733f},
-std::array<float,2>{0.146832168f, 0.486670375f},
-std::array<float,2>{0.759646058f, 0.299002588f},
-std::array<float,2>{0.12278986f, 0.836846352f},
-std::array<float,2>{0.504859805f, 0.575698555f},
-std::array<float,2>{0.307838619f, 0.225823775f},
-std::array<float,2>{0.874469995f, 0.00971509237f},
-std::array<float,2>{0.0126147671f, 0.631110966f},
-std::array<float,2>{0.565778077f, 0.957194567f},
-std::array<float,2>{0.342363894f, 0.434555262f},
-std::array<float,2>{0.635565758f, 0.322504193f},
-std::array<float,2>{0.395469964f, 0.771985888f},
-std::array<float,2>{0.879132926f, 0.510934114f},
-std::array<float,2>{0.20586206f, 0.151358336f},
-std::array<float,2>{0.558790147f, 0.206081718f},
-std::array<float,2>{0.279871255f, 0.6223858f},
-std::array<float,2>{0.790565729f, 0.869983971f},
-std::array<float,2>{0.0845192671f, 0.251992673f},
-std::array<float,2>{0.949713945f, 0.466169178f},
-std::array<float,2>{0.181261092f, 0.887319386f},
-std::array<float,2>{0.734416723f, 0.742185235f},
-std::array<float,2>{0.472201586f, 0.0782132298f},
-std::array<float,2>{0.81676054f, 0.144437745f},
-std::array<float,2>{0.0506766848f, 0.507728398f},
-std::array<float,2>{0.6075688f, 0.774702609f},
-std::array<float,2>{0.348484129f, 0.319275647f},
-std::array<float,2>{0.686812222f, 0.428529531f},
-std::array<float,2>{0.407461822f, 0.962251961f},
-std::array<float,2>{0.933012605f, 0.635462463f},
-std::array<float,2>{0.224775419f, 0.00132183754f},
-std::array<float,2>{0.509694278f, 0.0874661505f},
-std::array<float,2>{0.300612837f, 0.744771838f},
-std::array<float,2>{0.757579148f, 0.877362013f},
-std::array<float,2>{0.116438277f, 0.460226864f},
-std::array<float,2>{0.989460409f, 0.260514855f},
-std::array<float,2>{0.151453122f, 0.861984015f},
-std::array<float,2>{0.696146429f, 0.611552715f},
-std::array<float,2>{0.467885941f, 0.215109959f},
-std::array<float,2>{0.887823462f, 0.0397843421f},
-std::array<float,2>{0.216055736f, 0.680875242f},
-std::array<float,2>{0.625359595f, 0.971082449f},
-std::array<float,2>{0.40465945f, 0.391406f},
-std::array<float,2>{0.572113156f, 0.360668659f},
-std::array<float,2>{0.331843227f, 0.802655518f},
-std::array<float,2>{0.86185354f, 0.555223167f},
-std::array<float,2>{0.00696774619f, 0.175806686f},
-std::array<float,2>{0.743330061f, 0.230389908f},
-std::array<float,2>{0.481234431f, 0.565559387f},
-std::array<float,2>{0.944049478f, 0.82843107f},
-std::array<float,2>{0.178838655f, 0.308655977f},
-std::array<float,2>{0.788566828f, 0.494889617f},
-std::array<float,2>{0.0878225863f, 0.92539686f},
-std::array<float,2>{0.549814284f, 0.708661258f},
-std::array<float,2>{0.270855069f, 0.0974531844f},
-std::array<float,2>{0.955855846f, 0.189087749f},
-std::array<float,2>{0.163837522f, 0.598293543f},
-std::array<float,2>{0.721313298f, 0.858655632f},
-std::array<float,2>{0.489435196f, 0.267708302f},
-std::array<float,2>{0.540802181f, 0.438976467f},
-std::array<float,2>{0.263112694f, 0.891744792f},
-std::array<float,2>{0.806879461f, 0.719327152f},
-std::array<float,2>{0.0673712939f, 0.0726948529f},
-std::array<float,2>{0.655426681f, 0.0255670212f},
-std::array<float,2>{0.386897296f, 0.654011965f},
-std::array<float,2>{0.903817773f, 0.946229696f},
-std::array<float,2>{0.193731785f, 0.4153032f},
-std::array<float,2>{0.850425482f, 0.333179921f},
-std::array<float,2>{0.0253437273f, 0.756793559f},
-std::array<float,2>{0.583467126f, 0.524778366f},
-std::array<float,2>{0.323952854f, 0.135697663f},
-std::array<float,2>{0.777729332f, 0.109926052f},
-std::array<float,2>{0.0947276577f, 0.695252478f},
-std::array<float,2>{0.516190588f, 0.909341693f},
-std::array<float,2>{0.28429848f, 0.471780926f},
-std::array<float,2>{0.70367527f, 0.293054968f},
-std::array<float,2>{0.440897703f, 0.812663555f},
-std::array<float,2>{0.981492043f, 0.593500614f},
-std::array<float,2>{0.129276678f, 0.241417512f},
-std::array<float,2>{0.619012058f, 0.163785294f},
-std::array<float,2>{0.362463564f, 0.544153452f},
-std::array<float,2>{0.831747353f, 0.781987607f},
-std::array<float,2>{0.0366814323f, 0.345485002f},
-std::array<float,2>{0.915861607f, 0.377506554f},
-std::array<float,2>{0.238069847f, 0.986204624f},
-std::array<float,2>{0.665509403f, 0.667071283f},
-std::array<float,2>{0.427698433f, 0.0610431135f},
-std::array<float,2>{0.842601836f, 0.233932003f},
-std::array<float,2>{0.0440044142f, 0.567828417f},
-std::array<float,2>{0.609912336f, 0.832123697f},
-std::array<float,2>{0.371237397f, 0.305405408f},
-std::array<float,2>{0.656441092f, 0.497784764f},
-std::array<float,2>{0.433961481f, 0.928596556f},
-std::array<float,2>{0.911435664f, 0.704669952f},
-std::array<float,2>{0.248659655f, 0.0978157595f},
-std::array<float,2>{0.530875385f, 0.0445079654f},
-std::array<float,2>{0.294963956f, 0.685571969f},
-std::array<float,2>{0.767706692f, 0.975641727f},
-std::array<float,2>{0.103279695f, 0.395968795f},
-std::array<float,2>{0.973217428f, 0.366098195f},
-std::array<float,2>{0.137718946f, 0.798421919f},
-std::array<float,2>{0.711799026f, 0.559957564f},
-std::array<float,2>{0.452800065f, 0.175536141f},
-std::array<float,2>{0.891454935f, 0.0910918638f},
-std::array<float,2>{0.197267115f, 0.748455703f},
-std::array<float,2>{0.64571172f, 0.882564306f},
-std::array<float,2>{0.380542994f, 0.456189752f},
-std::array<float,2>{0.592807412f, 0.263875842f},
-std::array<float,2>{0.315032214f, 0.864275336f},
-std::array<float,2>{0.858772516f, 0.614342093f},
-std::array<float,2>{0.0215692595f, 0.214340523f},
-std::array<float,2>{0.730735123f, 0.144576371f},
-std::array<float,2>{0.498952448f, 0.502993584f},
-std::array<float,2>{0.965948641f, 0.780748427f},
-std::array<float,2>{0.167521745f, 0.313090891f},
-std::array<float,2>{0.797163367f, 0.425130099f},
-std::array<float,2>{0.0756936148f, 0.967680573f},
-std::array<float,2>{0.535954893f, 0.64042443f},
-std::array<float,2>{0.257395923f, 0.0055668233f},
-std::array<float,2>{0.947236359f, 0.156274065f},
-std::array<float,2>{0.184415579f, 0.540961266f},
-std::array<float,2>{0.738773942f, 0.785339713f},
-std::array<float,2>{0.474735022f, 0.3493478f},
-std::array<float,2>{0.555173278f, 0.381685048f},
-std::array<float,2>{0.274578005f, 0.989885032f},
-std::array<float,2>{0.796778798f, 0.670039177f},
-std::array<float,2>{0.0797234923f, 0.055099126f},
-std::array<float,2>{0.638793886f, 0.115155473f},
-std::array<float,2>{0.394305438f, 0.688306153f},
-std::array<float,2>{0.878440142f, 0.912634194f},
-std::array<float,2>{0.210345984f, 0.476380259f},
-std::array<float,2>{0.869863629f, 0.292292655f},
-std::array<float,2>{0.0116392141f, 0.819827974f},
-std::array<float,2>{0.567938447f, 0.589405f},
-std::array<float,2>{0.339053601f, 0.237435296f},
-std::array<float,2>{0.765532374f, 0.0286125429f},
-std::array<float,2>{0.119091652f, 0.652031898f},
-std::array<float,2>{0.502723515f, 0.951817214f},
-std::array<float,2>{0.311701566f, 0.419324368f},
-std::array<float,2>{0.689272821f, 0.330697596f},
-std::array<float,2>{0.460036963f, 0.752227783f},
-std::array<float,2>{0.994014502f, 0.529969871f},
-std::array<float,2>{0.141212538f, 0.138661101f},
-std::array<float,2>{0.596553266f, 0.193455309f},
-std::array<float,2>{0.359070331f, 0.597017765f},
-std::array<float,2>{0.8212201f, 0.853285432f},
-std::array<float,2>{0.0559641495f, 0.270619541f},
-std::array<float,2>{0.928109646f, 0.443553478f},
-std::array<float,2>{0.233889818f, 0.897011697f},
-std::array<float,2>{0.678910196f, 0.725176573f},
-std::array<float,2>{0.419439554f, 0.0766002461f},
-std::array<float,2>{0.781655192f, 0.128976226f},
-std::array<float,2>{0.092324473f, 0.518012285f},
-std::array<float,2>{0.552175999f, 0.762093961f},
-std::array<float,2>{0.268464059f, 0.337745219f},
-std::array<float,2>{0.747830808f, 0.412756771f},
-std::array<float,2>{0.478629649f, 0.939972699f},
-std::array<float,2>{0.941372693f, 0.648352087f},
-std::array<float,2>{0.174681634f, 0.019483136f},
-std::array<float,2>{0.577872038f, 0.0699348375f},
-std::array<float,2>{0.334411472f, 0.734036386f},
-std::array<float,2>{0.864311695f, 0.905746043f},
-std::array<float,2>{0.00243626535f, 0.450783461f},
-std::array<float,2>{0.883487999f, 0.275533706f},
-std::array<float,2>{0.214811549f, 0.847740948f},
-std::array<float,2>{0.631608605f, 0.605756462f},
-std::array<float,2>{0.401884288f, 0.200156763f},
-std::array<float,2>{0.988072634f, 0.0538480431f},
-std::array<float,2>{0.15501602f, 0.659349918f},
-std::array<float,2>{0.701386452f, 0.994484186f},
-std::array<float,2>{0.461182058f, 0.383737504f},
-std::array<float,2>{0.512764275f, 0.356440425f},
-std::array<float,2>{0.302725852f, 0.793476224f},
-std::array<float,2>{0.752230644f, 0.535209715f},
-std::array<float,2>{0.111846983f, 0.166733772f},
-std::array<float,2>{0.680322409f, 0.248418793f},
-std::array<float,2>{0.413673729f, 0.578804374f},
-std::array<float,2>{0.933810413f, 0.825176537f},
-std::array<float,2>{0.219442904f, 0.284306288f},
-std::array<float,2>{0.8156057f, 0.483893692f},
-std::array<float,2>{0.0531282425f, 0.914115548f},
-std::array<float,2>{0.604399562f, 0.696444094f},
-std::array<float,2>{0.345415711f, 0.11874783f},
-std::array<float,2>{0.920746028f, 0.208154544f},
-std::array<float,2>{0.239551619f, 0.61928755f},
-std::array<float,2>{0.668259919f, 0.871204078f},
-std::array<float,2>{0.422433406f, 0.256378293f},
-std::array<float,2>{0.623300314f, 0.463689148f},
-std::array<float,2>{0.366147876f, 0.885831833f},
-std::array<float,2>{0.834831119f, 0.736761451f},
-std::array<float,2>{0.0328688361f, 0.0823625401f},
-std::array<float,2>{0.709422529f, 0.0144739076f},
-std::array<float,2>{0.444361299f, 0.625062585f},
-std::array<float,2>{0.979807019f, 0.956162453f},
-std::array<float,2>{0.125356019f, 0.432319194f},
-std::array<float,2>{0.775832057f, 0.324696571f},
-std::array<float,2>{0.0981743559f, 0.766473532f},
-std::array<float,2>{0.519963384f, 0.51324755f},
-std::array<float,2>{0.288342267f, 0.15490517f},
-std::array<float,2>{0.846111f, 0.109218292f},
-std::array<float,2>{0.0301672705f, 0.7171368f},
-std::array<float,2>{0.578457952f, 0.932414412f},
-std::array<float,2>{0.325692773f, 0.48836711f},
-std::array<float,2>{0.650148034f, 0.302546263f},
-std::array<float,2>{0.384053946f, 0.841632962f},
-std::array<float,2>{0.902116179f, 0.573483944f},
-std::array<float,2>{0.189034924f, 0.22234343f},
-std::array<float,2>{0.54606992f, 0.186209559f},
-std::array<float,2>{0.259041041f, 0.547571361f},
-std::array<float,2>{0.81083411f, 0.804786086f},
-std::array<float,2>{0.0648751855f, 0.37128219f},
-std::array<float,2>{0.960120201f, 0.398738235f},
-std::array<float,2>{0.159452289f, 0.977434695f},
-std::array<float,2>{0.724454224f, 0.678449571f},
-std::array<float,2>{0.486369342f, 0.0389700308f},
-std::array<float,2>{0.772911787f, 0.196172923f},
-std::array<float,2>{0.10922581f, 0.601889968f},
-std::array<float,2>{0.526236475f, 0.846813142f},
-std::array<float,2>{0.290353686f, 0.279025108f},
-std::array<float,2>{0.718534946f, 0.446055621f},
-std::array<float,2>{0.446590185f, 0.902315915f},
-std::array<float,2>{0.971474171f, 0.726911724f},
-std::array<float,2>{0.134081542f, 0.0657087639f},
-std::array<float,2>{0.615218401f, 0.0234029852f},
-std::array<float,2>{0.370234519f, 0.644212365f},
-std::array<float,2>{0.839107513f, 0.942381382f},
-std::array<float,2>{0.0403171629f, 0.408891618f},
-std::array<float,2>{0.907865226f, 0.342949301f},
-std::array<float,2>{0.245470375f, 0.759299338f},
-std::array<float,2>{0.663954318f, 0.520908296f},
-std::array<float,2>{0.432275206f, 0.127381563f},
-std::array<float,2>{0.962804556f, 0.124795489f},
-std::array<float,2>{0.171000957f, 0.700950682f},
-std::array<float,2>{0.72864306f, 0.918307364f},
-std::array<float,2>{0.494803518f, 0.477623492f},
-std::array<float,2>{0.532871246f, 0.288707376f},
-std::array<float,2>{0.253608197f, 0.823907137f},
-std::array<float,2>{0.802496135f, 0.582821667f},
-std::array<float,2>{0.0726832598f, 0.244011745f},
-std::array<float,2>{0.644407332f, 0.168715909f},
-std::array<float,2>{0.378127933f, 0.531434536f},
-std::array<float,2>{0.897363782f, 0.78921932f},
-std::array<float,2>{0.200499505f, 0.355389774f},
-std::array<float,2>{0.85362339f, 0.388227105f},
-std::array<float,2>{0.0156368874f, 0.998283505f},
-std::array<float,2>{0.588014722f, 0.66309911f},
-std::array<float,2>{0.318937868f, 0.0483598635f},
-std::array<float,2>{0.881012261f, 0.148447305f},
-std::array<float,2>{0.204406679f, 0.508138657f},
-std::array<float,2>{0.633477211f, 0.770984948f},
-std::array<float,2>{0.397726476f, 0.321721643f},
-std::array<float,2>{0.56385833f, 0.436510205f},
-std::array<float,2>{0.340480655f, 0.959214509f},
-std::array<float,2>{0.871094942f, 0.629145741f},
-std::array<float,2>{0.0154867424f, 0.0116456859f},
-std::array<float,2>{0.73823297f, 0.0818193257f},
-std::array<float,2>{0.47043255f, 0.738312483f},
-std::array<float,2>{0.952876866f, 0.888912022f},
-std::array<float,2>{0.183446884f, 0.467104286f},
-std::array<float,2>{0.79239887f, 0.251058996f},
-std::array<float,2>{0.0830036923f, 0.86745435f},
-std::array<float,2>{0.561526895f, 0.623497665f},
-std::array<float,2>{0.278826118f, 0.203257829f},
-std::array<float,2>{0.824641109f, 0.0333470404f},
-std::array<float,2>{0.0602518544f, 0.673110306f},
-std::array<float,2>{0.600156486f, 0.981948435f},
-std::array<float,2>{0.355238438f, 0.405389845f},
-std::array<float,2>{0.674030781f, 0.370089382f},
-std::array<float,2>{0.41457659f, 0.812497318f},
-std::array<float,2>{0.925253808f, 0.550866902f},
-std::array<float,2>{0.229094014f, 0.18258521f},
-std::array<float,2>{0.507044375f, 0.224370867f},
-std::array<float,2>{0.306074232f, 0.576271415f},
-std::array<float,2>{0.760138333f, 0.838125944f},
-std::array<float,2>{0.124876291f, 0.298683614f},
-std::array<float,2>{0.99742651f, 0.484868526f},
-std::array<float,2>{0.1445719f, 0.936249554f},
-std::array<float,2>{0.693006933f, 0.713608325f},
-std::array<float,2>{0.455132067f, 0.103987403f},
-std::array<float,2>{0.860161006f, 0.178987086f},
-std::array<float,2>{0.00487514166f, 0.557253838f},
-std::array<float,2>{0.572634935f, 0.804527879f},
-std::array<float,2>{0.329280704f, 0.362597823f},
-std::array<float,2>{0.628391683f, 0.393080294f},
-std::array<float,2>{0.403263181f, 0.969902217f},
-std::array<float,2>{0.890595555f, 0.683383584f},
-std::array<float,2>{0.218262255f, 0.0415131636f},
-std::array<float,2>{0.548182189f, 0.0944995135f},
-std::array<float,2>{0.273154616f, 0.709693253f},
-std::array<float,2>{0.785570204f, 0.922060132f},
-std::array<float,2>{0.088264659f, 0.492759794f},
-std::array<float,2>{0.942092121f, 0.312484741f},
-std::array<float,2>{0.177004203f, 0.830888093f},
-std::array<float,2>{0.744349718f, 0.564170599f},
-std::array<float,2>{0.482751042f, 0.226860449f},
-std::array<float,2>{0.931339979f, 0.00311409379f},
-std::array<float,2>{0.223378912f, 0.632883966f},
-std::array<float,2>{0.68526572f, 0.964713931f},
-std::array<float,2>{0.409309834f, 0.426932365f},
-std::array<float,2>{0.606610298f, 0.317661494f},
-std::array<float,2>{0.35095945f, 0.776534975f},
-std::array<float,2>{0.81872946f, 0.505319178f},
-std::array<float,2>{0.0481194407f, 0.140739799f},
-std::array<float,2>{0.698940575f, 0.217554688f},
-std::array<float,2>{0.466096193f, 0.610740364f},
-std::array<float,2>{0.990704715f, 0.859697461f},
-std::array<float,2>{0.149984196f, 0.259456843f},
-std::array<float,2>{0.754491746f, 0.457639575f},
-std::array<float,2>{0.113649383f, 0.87597388f},
-std::array<float,2>{0.51078409f, 0.742444456f},
-std::array<float,2>{0.297645986f, 0.088088125f},
-std::array<float,2>{0.9843086f, 0.238750026f},
-std::array<float,2>{0.132209212f, 0.590697944f},
-std::array<float,2>{0.706653237f, 0.81640619f},
-std::array<float,2>{0.438449889f, 0.296756983f},
-std::array<float,2>{0.518148065f, 0.46981287f},
-std::array<float,2>{0.282320052f, 0.906325758f},
-std::array<float,2>{0.779544413f, 0.693209887f},
-std::array<float,2>{0.0975653604f, 0.111344293f},
-std::array<float,2>{0.667509258f, 0.0598317049f},
-std::array<float,2>{0.427927673f, 0.665854812f},
-std::array<float,2>{0.916648269f, 0.986569822f},
-std::array<float,2>{0.234533504f, 0.375326455f},
-std::array<float,2>{0.828234851f, 0.34734568f},
-std::array<float,2>{0.0389651284f, 0.783877075f},
-std::array<float,2>{0.619391143f, 0.545518577f},
-std::array<float,2>{0.360147715f, 0.160844445f},
-std::array<float,2>{0.805795014f, 0.0718140006f},
-std::array<float,2>{0.0689660013f, 0.722130775f},
-std::array<float,2>{0.542210579f, 0.893034101f},
-std::array<float,2>{0.263713777f, 0.440587223f},
-std::array<float,2>{0.719349802f, 0.267233491f},
-std::array<float,2>{0.490699142f, 0.855668306f},
-std::array<float,2>{0.954111874f, 0.600363195f},
-std::array<float,2>{0.161884949f, 0.18960157f},
-std::array<float,2>{0.58569032f, 0.13382034f},
-std::array<float,2>{0.321306646f, 0.525696158f},
-std::array<float,2>{0.848233402f, 0.755028546f},
-std::array<float,2>{0.0263016876f, 0.335446775f},
-std::array<float,2>{0.905348361f, 0.417147994f},
-std::array<float,2>{0.192224666f, 0.947823107f},
-std::array<float,2>{0.653155804f, 0.656201899f},
-std::array<float,2>{0.390185744f, 0.0251110997f},
-std::array<float,2>{0.845136404f, 0.222032994f},
-std::array<float,2>{0.0279475208f, 0.573979378f},
-std::array<float,2>{0.581760287f, 0.841088593f},
-std::array<float,2>{0.327283621f, 0.30191806f},
-std::array<float,2>{0.651305854f, 0.489175647f},
-std::array<float,2>{0.385777801f, 0.931808889f},
-std::array<float,2>{0.899772167f, 0.717305303f},
-std::array<float,2>{0.190545917f, 0.108492404f},
-std::array<float,2>{0.543554902f, 0.0384092592f},
-std::array<float,2>{0.261610329f, 0.678208828f},
-std::array<float,2>{0.810174227f, 0.976876855f},
-std::array<float,2>{0.0631835684f, 0.399131924f},
-std::array<float,2>{0.957965493f, 0.371844143f},
-std::array<float,2>{0.156288743f, 0.8053931f},
-std::array<float,2>{0.726022661f, 0.546891332f},
-std::array<float,2>{0.485715449f, 0.185746357f},
-std::array<float,2>{0.919531584f, 0.0827660114f},
-std::array<float,2>{0.24194932f, 0.736850202f},
-std::array<float,2>{0.670309186f, 0.886633277f},
-std::array<float,2>{0.42410627f, 0.463013768f},
-std::array<float,2>{0.621841073f, 0.255924702f},
-std::array<float,2>{0.364291459f, 0.871864438f},
-std::array<float,2>{0.833321512f, 0.619856358f},
-std::array<float,2>{0.0334047787f, 0.208661869f},
-std::array<float,2>{0.708709657f, 0.154346973f},
-std::array<float,2>{0.442837536f, 0.512966692f},
-std::array<float,2>{0.977442026f, 0.765784204f},
-std::array<float,2>{0.128631696f, 0.32513237f},
-std::array<float,2>{0.77429986f, 0.431856722f},
-std::array<float,2>{0.100620359f, 0.956793368f},
-std::array<float,2>{0.521954179f, 0.62561208f},
-std::array<float,2>{0.286191434f, 0.0138681205f},
-std::array<float,2>{0.985979676f, 0.166206658f},
-std::array<float,2>{0.152656808f, 0.535951734f},
-std::array<float,2>{0.700490952f, 0.793128967f},
-std::array<float,2>{0.46414876f, 0.355635315f},
-std::array<float,2>{0.514750421f, 0.383205652f},
-std::array<float,2>{0.302961916f, 0.99466753f},
-std::array<float,2>{0.751871645f, 0.659879029f},
-std::array<float,2>{0.109568983f, 0.054382775f},
-std::array<float,2>{0.681846619f, 0.11848487f},
-std::array<float,2>{0.410989672f, 0.696933448f},
-std::array<float,2>{0.935897648f, 0.914973676f},
-std::array<float,2>{0.22253257f, 0.483754367f},
-std::array<float,2>{0.812848985f, 0.2848804f},
-std::array<float,2>{0.0508261472f, 0.824626684f},
-std::array<float,2>{0.602001905f, 0.578443885f},
-std::array<float,2>{0.345848054f, 0.248557895f},
-std::array<float,2>{0.783216834f, 0.0186711606f},
-std::array<float,2>{0.0914711729f, 0.647881508f},
-std::array<float,2>{0.552857876f, 0.939592242f},
-std::array<float,2>{0.265803218f, 0.412158132f},
-std::array<float,2>{0.74873668f, 0.337277025f},
-std::array<float,2>{0.478349447f, 0.762460828f},
-std::array<float,2>{0.938779771f, 0.518257141f},
-std::array<float,2>{0.173047632f, 0.129767001f},
-std::array<float,2>{0.575511277f, 0.199503586f},
-std::array<float,2>{0.333866358f, 0.605973184f},
-std::array<float,2>{0.866890073f, 0.848161638f},
-std::array<float,2>{0.000753989269f, 0.276239574f},
-std::array<float,2>{0.885439694f, 0.450569004f},
-std::array<float,2>{0.212166488f, 0.906047642f},
-std::array<float,2>{0.630672932f, 0.733700275f},
-std::array<float,2>{0.400349081f, 0.0693536624f},
-std::array<float,2>{0.762651861f, 0.138110906f},
-std::array<float,2>{0.119410768f, 0.529517829f},
-std::array<float,2>{0.501216531f, 0.752759695f},
-std::array<float,2>{0.310341299f, 0.330541968f},
-std::array<float,2>{0.690344989f, 0.419485301f},
-std::array<float,2>{0.457186729f, 0.951438785f},
-std::array<float,2>{0.995912194f, 0.651545882f},
-std::array<float,2>{0.142695352f, 0.029142445f},
-std::array<float,2>{0.594515085f, 0.076675117f},
-std::array<float,2>{0.35717532f, 0.724673152f},
-std::array<float,2>{0.823020279f, 0.896732271f},
-std::array<float,2>{0.0584077276f, 0.443866372f},
-std::array<float,2>{0.927598774f, 0.271374673f},
-std::array<float,2>{0.232404947f, 0.852658749f},
-std::array<float,2>{0.677008688f, 0.597368956f},
-std::array<float,2>{0.420185089f, 0.194075838f},
-std::array<float,2>{0.948523581f, 0.0554829389f},
-std::array<float,2>{0.186660543f, 0.670865953f},
-std::array<float,2>{0.741351843f, 0.989352763f},
-std::array<float,2>{0.473759264f, 0.381078392f},
-std::array<float,2>{0.55714637f, 0.34889558f},
-std::array<float,2>{0.27722162f, 0.785807967f},
-std::array<float,2>{0.794195712f, 0.540353894f},
-std::array<float,2>{0.080605872f, 0.157050982f},
-std::array<float,2>{0.637571752f, 0.238231778f},
-std::array<float,2>{0.391311973f, 0.589165151f},
-std::array<float,2>{0.875151932f, 0.819357216f},
-std::array<float,2>{0.208940655f, 0.292916417f},
-std::array<float,2>{0.867869794f, 0.475642115f},
-std::array<float,2>{0.00887989346f, 0.912573397f},
-std::array<float,2>{0.569262385f, 0.687652588f},
-std::array<float,2>{0.336779118f, 0.114639603f},
-std::array<float,2>{0.893322229f, 0.214422524f},
-std::array<float,2>{0.195355862f, 0.615203142f},
-std::array<float,2>{0.646564305f, 0.864881933f},
-std::array<float,2>{0.381441891f, 0.264168531f},
-std::array<float,2>{0.591611087f, 0.457012922f},
-std::array<float,2>{0.312710106f, 0.882293463f},
-std::array<float,2>{0.857346058f, 0.748810589f},
-std::array<float,2>{0.0199297722f, 0.0916679874f},
-std::array<float,2>{0.733045936f, 0.00521866232f},
-std::array<float,2>{0.497359633f, 0.639927983f},
-std::array<float,2>{0.967212439f, 0.967149138f},
-std::array<float,2>{0.165708333f, 0.425675541f},
-std::array<float,2>{0.800358713f, 0.312523246f},
-std::array<float,2>{0.0780334398f, 0.780802608f},
-std::array<float,2>{0.537832141f, 0.503625035f},
-std::array<float,2>{0.254300326f, 0.145457953f},
-std::array<float,2>{0.839886546f, 0.0982511714f},
-std::array<float,2>{0.0456868783f, 0.704184175f},
-std::array<float,2>{0.613157928f, 0.928137481f},
-std::array<float,2>{0.374260128f, 0.497503668f},
-std::array<float,2>{0.658465922f, 0.304886788f},
-std::array<float,2>{0.437122673f, 0.832713544f},
-std::array<float,2>{0.913769901f, 0.567945242f},
-std::array<float,2>{0.247239515f, 0.23380971f},
-std::array<float,2>{0.528475463f, 0.175151572f},
-std::array<float,2>{0.294412673f, 0.560095966f},
-std::array<float,2>{0.767352998f, 0.79830873f},
-std::array<float,2>{0.105167933f, 0.365458459f},
-std::array<float,2>{0.975233614f, 0.396265417f},
-std::array<float,2>{0.14012526f, 0.976513743f},
-std::array<float,2>{0.714785218f, 0.686273277f},
-std::array<float,2>{0.450480014f, 0.0442890227f},
-std::array<float,2>{0.807567239f, 0.190371707f},
-std::array<float,2>{0.0668489933f, 0.599807084f},
-std::array<float,2>{0.540203989f, 0.85627073f},
-std::array<float,2>{0.263373762f, 0.26708734f},
-std::array<float,2>{0.720801294f, 0.441144079f},
-std::array<float,2>{0.490110815f, 0.893538296f},
-std::array<float,2>{0.955367506f, 0.722472489f},
-std::array<float,2>{0.163425237f, 0.0713868663f},
-std::array<float,2>{0.583605528f, 0.0248012319f},
-std::array<float,2>{0.323264778f, 0.655664921f},
-std::array<float,2>{0.849766254f, 0.947430909f},
-std::array<float,2>{0.0247384142f, 0.417512178f},
-std::array<float,2>{0.903747082f, 0.335681349f},
-std::array<float,2>{0.194222093f, 0.755712807f},
-std::array<float,2>{0.656136751f, 0.526347756f},
-std::array<float,2>{0.387510329f, 0.134754479f},
-std::array<float,2>{0.982302547f, 0.112047814f},
-std::array<float,2>{0.129637629f, 0.692505717f},
-std::array<float,2>{0.703595817f, 0.907214701f},
-std::array<float,2>{0.441236466f, 0.47060433f},
-std::array<float,2>{0.5158149f, 0.296095729f},
-std::array<float,2>{0.284869879f, 0.815887094f},
-std::array<float,2>{0.777894616f, 0.590099633f},
-std::array<float,2>{0.0952516049f, 0.238780528f},
-std::array<float,2>{0.665711462f, 0.160281852f},
-std::array<float,2>{0.426847488f, 0.545301676f},
-std::array<float,2>{0.915446818f, 0.783456266f},
-std::array<float,2>{0.237736955f, 0.347067147f},
-std::array<float,2>{0.831534684f, 0.375556856f},
-std::array<float,2>{0.0366005674f, 0.987107396f},
-std::array<float,2>{0.618171573f, 0.66509831f},
-std::array<float,2>{0.363043368f, 0.0600679368f},
-std::array<float,2>{0.933431625f, 0.141144663f},
-std::array<float,2>{0.225371495f, 0.505381346f},
-std::array<float,2>{0.687314987f, 0.777235866f},
-std::array<float,2>{0.408185452f, 0.317954332f},
-std::array<float,2>{0.608336031f, 0.427563161f},
-std::array<float,2>{0.347912699f, 0.964242935f},
-std::array<float,2>{0.817271352f, 0.633478522f},
-std::array<float,2>{0.0501436777f, 0.00369185791f},
-std::array<float,2>{0.695413649f, 0.0886676833f},
-std::array<float,2>{0.468660921f, 0.742935419f},
-std::array<float,2>{0.9900648f, 0.875225008f},
-std::array<float,2>{0.152029634f, 0.457157224f},
-std::array<float,2>{0.75709033f, 0.259072065f},
-std::array<float,2>{0.116845518f, 0.860259354f},
-std::array<float,2>{0.509067714f, 0.610981166f},
-std::array<float,2>{0.299975961f, 0.217151046f},
-std::array<float,2>{0.861460686f, 0.0410884023f},
-std::array<float,2>{0.0077179186f, 0.682863414f},
-std::array<float,2>{0.571673036f, 0.97034806f},
-std::array<float,2>{0.331084907f, 0.39258045f},
-std::array<float,2>{0.625812888f, 0.362924665f},
-std::array<float,2>{0.404850662f, 0.803994477f},
-std::array<float,2>{0.888307631f, 0.556773603f},
-std::array<float,2>{0.216414809f, 0.179216877f},
-std::array<float,2>{0.550714731f, 0.227069601f},
-std::array<float,2>{0.271407843f, 0.56371361f},
-std::array<float,2>{0.788638711f, 0.830562711f},
-std::array<float,2>{0.0872839391f, 0.311852455f},
-std::array<float,2>{0.943589568f, 0.492310077f},
-std::array<float,2>{0.179472178f, 0.922596455f},
-std::array<float,2>{0.743931592f, 0.709285021f},
-std::array<float,2>{0.480898231f, 0.0940061361f},
-std::array<float,2>{0.826996088f, 0.181853294f},
-std::array<float,2>{0.0622438639f, 0.551614523f},
-std::array<float,2>{0.599033415f, 0.811620951f},
-std::array<float,2>{0.353271425f, 0.369152784f},
-std::array<float,2>{0.672165453f, 0.405959457f},
-std::array<float,2>{0.416531563f, 0.981589496f},
-std::array<float,2>{0.92219758f, 0.673687935f},
-std::array<float,2>{0.227328002f, 0.0337911323f},
-std::array<float,2>{0.504195571f, 0.104447052f},
-std::array<float,2>{0.308337688f, 0.713351488f},
-std::array<float,2>{0.759239674f, 0.93596226f},
-std::array<float,2>{0.122332633f, 0.484452456f},
-std::array<float,2>{0.999150097f, 0.298117191f},
-std::array<float,2>{0.147367641f, 0.838430345f},
-std::array<float,2>{0.693730712f, 0.577039361f},
-std::array<float,2>{0.453793049f, 0.223930597f},
-std::array<float,2>{0.87980336f, 0.0110245915f},
-std::array<float,2>{0.205189034f, 0.629800022f},
-std::array<float,2>{0.635108411f, 0.959497154f},
-std::array<float,2>{0.394864678f, 0.435962886f},
-std::array<float,2>{0.56624788f, 0.321966946f},
-std::array<float,2>{0.341822594f, 0.771304071f},
-std::array<float,2>{0.874782026f, 0.508465409f},
-std::array<float,2>{0.0119279046f, 0.149066761f},
-std::array<float,2>{0.735034764f, 0.203983754f},
-std::array<float,2>{0.471751571f, 0.623696446f},
-std::array<float,2>{0.949572444f, 0.867951334f},
-std::array<float,2>{0.180798441f, 0.25158456f},
-std::array<float,2>{0.790098011f, 0.467550546f},
-std::array<float,2>{0.0842193365f, 0.889273167f},
-std::array<float,2>{0.559562743f, 0.73915112f},
-std::array<float,2>{0.279680878f, 0.0813651085f},
-std::array<float,2>{0.964590907f, 0.243242919f},
-std::array<float,2>{0.168532193f, 0.582237303f},
-std::array<float,2>{0.72761482f, 0.823363185f},
-std::array<float,2>{0.493286908f, 0.288384467f},
-std::array<float,2>{0.534419537f, 0.478487492f},
-std::array<float,2>{0.250803918f, 0.918575287f},
-std::array<float,2>{0.803436577f, 0.70063293f},
-std::array<float,2>{0.0718747452f, 0.124483109f},
-std::array<float,2>{0.640641451f, 0.0479989089f},
-std::array<float,2>{0.376088589f, 0.663829982f},
-std::array<float,2>{0.895125985f, 0.998782635f},
-std::array<float,2>{0.202514201f, 0.38779971f},
-std::array<float,2>{0.852185249f, 0.35457617f},
-std::array<float,2>{0.0191815905f, 0.78996402f},
-std::array<float,2>{0.58610487f, 0.532121003f},
-std::array<float,2>{0.318212986f, 0.168150619f},
-std::array<float,2>{0.76964879f, 0.0662460849f},
-std::array<float,2>{0.105612054f, 0.727478564f},
-std::array<float,2>{0.52407831f, 0.901406646f},
-std::array<float,2>{0.292579323f, 0.445437878f},
-std::array<float,2>{0.715484381f, 0.278760314f},
-std::array<float,2>{0.449203849f, 0.847443044f},
-std::array<float,2>{0.96994251f, 0.602434695f},
-std::array<float,2>{0.13497299f, 0.195370346f},
-std::array<float,2>{0.61623925f, 0.127500117f},
-std::array<float,2>{0.367251605f, 0.521330535f},
-std::array<float,2>{0.837824643f, 0.758817494f},
-std::array<float,2>{0.0420550518f, 0.343447059f},
-std::array<float,2>{0.909326017f, 0.408237815f},
-std::array<float,2>{0.242715493f, 0.941589952f},
-std::array<float,2>{0.660382628f, 0.643925488f},
-std::array<float,2>{0.430524349f, 0.0226918142f},
-std::array<float,2>{0.83414489f, 0.209735602f},
-std::array<float,2>{0.0326500647f, 0.618399739f},
-std::array<float,2>{0.623568714f, 0.874656916f},
-std::array<float,2>{0.365594447f, 0.255840272f},
-std::array<float,2>{0.668667793f, 0.46195522f},
-std::array<float,2>{0.422219753f, 0.884712398f},
-std::array<float,2>{0.920170069f, 0.734965861f},
-std::array<float,2>{0.240179941f, 0.0857503861f},
-std::array<float,2>{0.520219028f, 0.0131495772f},
-std::array<float,2>{0.288824499f, 0.628386378f},
-std::array<float,2>{0.776329875f, 0.953661501f},
-std::array<float,2>{0.0981257707f, 0.429978162f},
-std::array<float,2>{0.980002761f, 0.327977419f},
-std::array<float,2>{0.125913933f, 0.768148065f},
-std::array<float,2>{0.709609091f, 0.5145787f},
-std::array<float,2>{0.444833219f, 0.15402694f},
-std::array<float,2>{0.901553869f, 0.106416285f},
-std::array<float,2>{0.188868672f, 0.715500951f},
-std::array<float,2>{0.649712205f, 0.930767715f},
-std::array<float,2>{0.38452816f, 0.491684049f},
-std::array<float,2>{0.579059184f, 0.303946704f},
-std::array<float,2>{0.325554669f, 0.842815936f},
-std::array<float,2>{0.846450508f, 0.571652293f},
-std::array<float,2>{0.0292998925f, 0.218979552f},
-std::array<float,2>{0.723967135f, 0.184797689f},
-std::array<float,2>{0.487269461f, 0.549807131f},
-std::array<float,2>{0.960785091f, 0.806660533f},
-std::array<float,2>{0.159787863f, 0.373446584f},
-std::array<float,2>{0.811402738f, 0.401953667f},
-std::array<float,2>{0.0653898418f, 0.980387628f},
-std::array<float,2>{0.546606719f, 0.676291406f},
-std::array<float,2>{0.259642035f, 0.0364139229f},
-std::array<float,2>{0.940510452f, 0.131139114f},
-std::array<float,2>{0.174071923f, 0.515909314f},
-std::array<float,2>{0.747549355f, 0.765448093f},
-std::array<float,2>{0.479132801f, 0.338513613f},
-std::array<float,2>{0.552615762f, 0.411111325f},
-std::array<float,2>{0.267604679f, 0.938442588f},
-std::array<float,2>{0.782109439f, 0.645216584f},
-std::array<float,2>{0.0921955779f, 0.0173520111f},
-std::array<float,2>{0.630987287f, 0.0681327507f},
-std::array<float,2>{0.401664436f, 0.730529189f},
-std::array<float,2>{0.883001745f, 0.903100491f},
-std::array<float,2>{0.214282736f, 0.452145964f},
-std::array<float,2>{0.865112364f, 0.274582773f},
-std::array<float,2>{0.00264006248f, 0.851358294f},
-std::array<float,2>{0.577312768f, 0.607976079f},
-std::array<float,2>{0.334914804f, 0.201920271f},
-std::array<float,2>{0.752448082f, 0.0519413501f},
-std::array<float,2>{0.111688294f, 0.65625757f},
-std::array<float,2>{0.51333648f, 0.993931651f},
-std::array<float,2>{0.302094311f, 0.386339337f},
-std::array<float,2>{0.702001095f, 0.357792675f},
-std::array<float,2>{0.461542845f, 0.795226395f},
-std::array<float,2>{0.987343609f, 0.537230194f},
-std::array<float,2>{0.154676795f, 0.164217532f},
-std::array<float,2>{0.603762746f, 0.247349203f},
-std::array<float,2>{0.344751418f, 0.581614852f},
-std::array<float,2>{0.816142619f, 0.826761484f},
-std::array<float,2>{0.0534508079f, 0.282987684f},
-std::array<float,2>{0.93416357f, 0.482319951f},
-std::array<float,2>{0.219093665f, 0.916671336f},
-std::array<float,2>{0.679945111f, 0.699084401f},
-std::array<float,2>{0.413476437f, 0.12099313f},
-std::array<float,2>{0.796327055f, 0.158726782f},
-std::array<float,2>{0.0795427859f, 0.541863739f},
-std::array<float,2>{0.555182815f, 0.788674295f},
-std::array<float,2>{0.274914414f, 0.351300687f},
-std::array<float,2>{0.738481164f, 0.380234092f},
-std::array<float,2>{0.475412846f, 0.991778433f},
-std::array<float,2>{0.94633913f, 0.669579148f},
-std::array<float,2>{0.183641836f, 0.058295738f},
-std::array<float,2>{0.567581296f, 0.116228811f},
-std::array<float,2>{0.339720607f, 0.690449655f},
-std::array<float,2>{0.869622052f, 0.910548925f},
-std::array<float,2>{0.0110080605f, 0.474523693f},
-std::array<float,2>{0.878281832f, 0.289642394f},
-std::array<float,2>{0.210866675f, 0.818352699f},
-std::array<float,2>{0.639539778f, 0.587422192f},
-std::array<float,2>{0.393824309f, 0.235257283f},
-std::array<float,2>{0.993344665f, 0.0311966892f},
-std::array<float,2>{0.140734404f, 0.648636401f},
-std::array<float,2>{0.688529015f, 0.95112294f},
-std::array<float,2>{0.460775703f, 0.421040922f},
-std::array<float,2>{0.502407432f, 0.329449385f},
-std::array<float,2>{0.312282234f, 0.751104176f},
-std::array<float,2>{0.764805377f, 0.528608441f},
-std::array<float,2>{0.11858429f, 0.140295506f},
-std::array<float,2>{0.67946589f, 0.192783788f},
-std::array<float,2>{0.419154108f, 0.594807684f},
-std::array<float,2>{0.928252935f, 0.85400188f},
-std::array<float,2>{0.233767375f, 0.27338928f},
-std::array<float,2>{0.820762038f, 0.442387909f},
-std::array<float,2>{0.0562827401f, 0.895405471f},
-std::array<float,2>{0.59583199f, 0.723086536f},
-std::array<float,2>{0.358779669f, 0.0754189789f},
-std::array<float,2>{0.911968589f, 0.231399134f},
-std::array<float,2>{0.248143241f, 0.56978333f},
-std::array<float,2>{0.657211185f, 0.834216475f},
-std::array<float,2>{0.434088141f, 0.307168096f},
-std::array<float,2>{0.609440684f, 0.499055147f},
-std::array<float,2>{0.372018218f, 0.926519752f},
-std::array<float,2>{0.842190802f, 0.706083953f},
-std::array<float,2>{0.0446904972f, 0.100178771f},
-std::array<float,2>{0.711063564f, 0.0462192446f},
-std::array<float,2>{0.45257777f, 0.684984565f},
-std::array<float,2>{0.972709835f, 0.974350095f},
-std::array<float,2>{0.138579339f, 0.397231907f},
-std::array<float,2>{0.768371224f, 0.363842815f},
-std::array<float,2>{0.102666467f, 0.80034256f},
-std::array<float,2>{0.530657291f, 0.561924338f},
-std::array<float,2>{0.295635641f, 0.172266737f},
-std::array<float,2>{0.859095693f, 0.0921288282f},
-std::array<float,2>{0.0223696306f, 0.746604323f},
-std::array<float,2>{0.593600512f, 0.879176438f},
-std::array<float,2>{0.314871609f, 0.453739047f},
-std::array<float,2>{0.646176457f, 0.263000697f},
-std::array<float,2>{0.380065233f, 0.86698705f},
-std::array<float,2>{0.890679002f, 0.616040707f},
-std::array<float,2>{0.197869092f, 0.212343916f},
-std::array<float,2>{0.535441995f, 0.147857666f},
-std::array<float,2>{0.257269025f, 0.500221908f},
-std::array<float,2>{0.797745347f, 0.778547108f},
-std::array<float,2>{0.0753373802f, 0.314903975f},
-std::array<float,2>{0.966629803f, 0.423637748f},
-std::array<float,2>{0.167297438f, 0.965855122f},
-std::array<float,2>{0.731249988f, 0.63839519f},
-std::array<float,2>{0.498259425f, 0.00657223212f},
-std::array<float,2>{0.780097604f, 0.241982877f},
-std::array<float,2>{0.0971202627f, 0.593203366f},
-std::array<float,2>{0.518019557f, 0.813121974f},
-std::array<float,2>{0.282904297f, 0.29355514f},
-std::array<float,2>{0.706203878f, 0.472168118f},
-std::array<float,2>{0.437759072f, 0.910081029f},
-std::array<float,2>{0.98372364f, 0.694346726f},
-std::array<float,2>{0.132351756f, 0.109554537f},
-std::array<float,2>{0.619961858f, 0.0607035197f},
-std::array<float,2>{0.359688401f, 0.667962968f},
-std::array<float,2>{0.828872621f, 0.985452235f},
-std::array<float,2>{0.0382030234f, 0.377132833f},
-std::array<float,2>{0.916317701f, 0.344932765f},
-std::array<float,2>{0.235166788f, 0.781273007f},
-std::array<float,2>{0.667440236f, 0.54453671f},
-std::array<float,2>{0.428382099f, 0.163125783f},
-std::array<float,2>{0.954695821f, 0.072798036f},
-std::array<float,2>{0.161531359f, 0.719011009f},
-std::array<float,2>{0.719230533f, 0.892500103f},
-std::array<float,2>{0.491041064f, 0.438549757f},
-std::array<float,2>{0.542746842f, 0.268416047f},
-std::array<float,2>{0.264575005f, 0.859337926f},
-std::array<float,2>{0.806493938f, 0.597672045f},
-std::array<float,2>{0.0687889904f, 0.188765049f},
-std::array<float,2>{0.652586281f, 0.135248601f},
-std::array<float,2>{0.389890224f, 0.524953485f},
-std::array<float,2>{0.906180441f, 0.756129861f},
-std::array<float,2>{0.191432178f, 0.333963871f},
-std::array<float,2>{0.84805721f, 0.415992379f},
-std::array<float,2>{0.0257176943f, 0.945766389f},
-std::array<float,2>{0.585216045f, 0.653481126f},
-std::array<float,2>{0.322123706f, 0.0259844661f},
-std::array<float,2>{0.890050352f, 0.176596463f},
-std::array<float,2>{0.218120679f, 0.55489552f},
-std::array<float,2>{0.628497481f, 0.801897228f},
-std::array<float,2>{0.402510494f, 0.36096248f},
-std::array<float,2>{0.572882652f, 0.390820354f},
-std::array<float,2>{0.329766631f, 0.971478164f},
-std::array<float,2>{0.859507322f, 0.681384444f},
-std::array<float,2>{0.00421611918f, 0.039444644f},
-std::array<float,2>{0.744632602f, 0.0969955698f},
-std::array<float,2>{0.483086258f, 0.708337069f},
-std::array<float,2>{0.941757143f, 0.925052345f},
-std::array<float,2>{0.177459836f, 0.494261205f},
-std::array<float,2>{0.785729408f, 0.309500456f},
-std::array<float,2>{0.0888386965f, 0.828655124f},
-std::array<float,2>{0.548501074f, 0.566298008f},
-std::array<float,2>{0.272885203f, 0.229867816f},
-std::array<float,2>{0.819065452f, 0.00173554639f},
-std::array<float,2>{0.0487166718f, 0.635047853f},
-std::array<float,2>{0.607022703f, 0.962449253f},
-std::array<float,2>{0.35144943f, 0.428151041f},
-std::array<float,2>{0.684652209f, 0.318793774f},
-std::array<float,2>{0.409759045f, 0.775250375f},
-std::array<float,2>{0.930972517f, 0.507080495f},
-std::array<float,2>{0.222956628f, 0.143810585f},
-std::array<float,2>{0.511331618f, 0.215735957f},
-std::array<float,2>{0.296921164f, 0.611881912f},
-std::array<float,2>{0.753975034f, 0.861672282f},
-std::array<float,2>{0.113885276f, 0.259973019f},
-std::array<float,2>{0.990882456f, 0.460701942f},
-std::array<float,2>{0.149698287f, 0.877481103f},
-std::array<float,2>{0.698283017f, 0.744276106f},
-std::array<float,2>{0.466508031f, 0.0872564465f},
-std::array<float,2>{0.871645451f, 0.150877789f},
-std::array<float,2>{0.0149756605f, 0.51126194f},
-std::array<float,2>{0.56403482f, 0.771569133f},
-std::array<float,2>{0.339965135f, 0.322906047f},
-std::array<float,2>{0.633084357f, 0.433788627f},
-std::array<float,2>{0.398028105f, 0.957726538f},
-std::array<float,2>{0.881496489f, 0.63181442f},
-std::array<float,2>{0.204852745f, 0.00913154706f},
-std::array<float,2>{0.562337816f, 0.0790171847f},
-std::array<float,2>{0.278401256f, 0.741259873f},
-std::array<float,2>{0.79267633f, 0.887051821f},
-std::array<float,2>{0.0821137056f, 0.466708273f},
-std::array<float,2>{0.95223397f, 0.252706349f},
-std::array<float,2>{0.182943374f, 0.869332552f},
-std::array<float,2>{0.737537205f, 0.622630358f},
-std::array<float,2>{0.469816566f, 0.2066295f},
-std::array<float,2>{0.925376475f, 0.0320738107f},
-std::array<float,2>{0.228625834f, 0.674326539f},
-std::array<float,2>{0.674380898f, 0.983428001f},
-std::array<float,2>{0.414074749f, 0.403221548f},
-std::array<float,2>{0.600022852f, 0.368461132f},
-std::array<float,2>{0.354527086f, 0.809790373f},
-std::array<float,2>{0.824817121f, 0.552797973f},
-std::array<float,2>{0.0599195883f, 0.180757239f},
-std::array<float,2>{0.692476153f, 0.226501808f},
-std::array<float,2>{0.455800444f, 0.575212181f},
-std::array<float,2>{0.997748911f, 0.836230397f},
-std::array<float,2>{0.145199344f, 0.299568921f},
-std::array<float,2>{0.760424435f, 0.487270415f},
-std::array<float,2>{0.124252677f, 0.934493005f},
-std::array<float,2>{0.507743239f, 0.711987317f},
-std::array<float,2>{0.306597084f, 0.103153199f},
-std::array<float,2>{0.97080338f, 0.198440075f},
-std::array<float,2>{0.134402946f, 0.60387975f},
-std::array<float,2>{0.718137443f, 0.844729483f},
-std::array<float,2>{0.447232842f, 0.27982676f},
-std::array<float,2>{0.525744736f, 0.448243171f},
-std::array<float,2>{0.290652305f, 0.90001601f},
-std::array<float,2>{0.773103833f, 0.730198801f},
-std::array<float,2>{0.108866699f, 0.0636191219f},
-std::array<float,2>{0.66317606f, 0.0213507228f},
-std::array<float,2>{0.431997865f, 0.640697122f},
-std::array<float,2>{0.90738821f, 0.944783926f},
-std::array<float,2>{0.245912313f, 0.408109546f},
-std::array<float,2>{0.839636445f, 0.341443956f},
-std::array<float,2>{0.0408600457f, 0.75989747f},
-std::array<float,2>{0.614425659f, 0.522104144f},
-std::array<float,2>{0.370684177f, 0.125161931f},
-std::array<float,2>{0.801929295f, 0.12160334f},
-std::array<float,2>{0.0728182644f, 0.701326966f},
-std::array<float,2>{0.532575011f, 0.921125472f},
-std::array<float,2>{0.253030121f, 0.480400532f},
-std::array<float,2>{0.7293064f, 0.286065608f},
-std::array<float,2>{0.494332522f, 0.822128415f},
-std::array<float,2>{0.961916268f, 0.585077286f},
-std::array<float,2>{0.171397001f, 0.24570483f},
-std::array<float,2>{0.588744581f, 0.171024859f},
-std::array<float,2>{0.31855917f, 0.533822656f},
-std::array<float,2>{0.854019046f, 0.791172504f},
-std::array<float,2>{0.0161957759f, 0.353422552f},
-std::array<float,2>{0.89654094f, 0.389034152f},
-std::array<float,2>{0.200919792f, 0.996430278f},
-std::array<float,2>{0.64362222f, 0.660175264f},
-std::array<float,2>{0.378586829f, 0.0504681729f},
-std::array<float,2>{0.866002321f, 0.202722877f},
-std::array<float,2>{0.00150376221f, 0.608536065f},
-std::array<float,2>{0.575188398f, 0.84980768f},
-std::array<float,2>{0.332983792f, 0.274163276f},
-std::array<float,2>{0.62981838f, 0.452449203f},
-std::array<float,2>{0.399214f, 0.903612494f},
-std::array<float,2>{0.885954618f, 0.73178196f},
-std::array<float,2>{0.211317152f, 0.0668606088f},
-std::array<float,2>{0.554119051f, 0.0161018632f},
-std::array<float,2>{0.266772509f, 0.646441042f},
-std::array<float,2>{0.784527004f, 0.938997686f},
-std::array<float,2>{0.0900155231f, 0.412079483f},
-std::array<float,2>{0.937780559f, 0.339478076f},
-std::array<float,2>{0.172727689f, 0.764564395f},
-std::array<float,2>{0.74924463f, 0.517046034f},
-std::array<float,2>{0.477437317f, 0.132649392f},
-std::array<float,2>{0.937283218f, 0.119208902f},
-std::array<float,2>{0.221050531f, 0.698211074f},
-std::array<float,2>{0.682668388f, 0.917182446f},
-std::array<float,2>{0.412108868f, 0.481210083f},
-std::array<float,2>{0.603221893f, 0.282131106f},
-std::array<float,2>{0.346750826f, 0.827923417f},
-std::array<float,2>{0.813533545f, 0.581028879f},
-std::array<float,2>{0.0523873046f, 0.246207371f},
-std::array<float,2>{0.700027406f, 0.165321484f},
-std::array<float,2>{0.462894261f, 0.538394451f},
-std::array<float,2>{0.984433711f, 0.796137989f},
-std::array<float,2>{0.153858662f, 0.359218955f},
-std::array<float,2>{0.750938773f, 0.385317653f},
-std::array<float,2>{0.110636681f, 0.993073821f},
-std::array<float,2>{0.51424855f, 0.657444954f},
-std::array<float,2>{0.304630637f, 0.0512518845f},
-std::array<float,2>{0.977865636f, 0.152619705f},
-std::array<float,2>{0.127224997f, 0.515024424f},
-std::array<float,2>{0.707663417f, 0.769475281f},
-std::array<float,2>{0.441938877f, 0.32645756f},
-std::array<float,2>{0.522592902f, 0.431389838f},
-std::array<float,2>{0.286069393f, 0.954223812f},
-std::array<float,2>{0.775350332f, 0.627288103f},
-std::array<float,2>{0.100529768f, 0.0120303156f},
-std::array<float,2>{0.671426117f, 0.0841564164f},
-std::array<float,2>{0.425020754f, 0.735748827f},
-std::array<float,2>{0.918929219f, 0.883603454f},
-std::array<float,2>{0.241136506f, 0.461182624f},
-std::array<float,2>{0.832385242f, 0.254248202f},
-std::array<float,2>{0.0351308621f, 0.873246014f},
-std::array<float,2>{0.622908294f, 0.617798388f},
-std::array<float,2>{0.363690615f, 0.210243508f},
-std::array<float,2>{0.809381545f, 0.0357345268f},
-std::array<float,2>{0.0639368296f, 0.677345216f},
-std::array<float,2>{0.544610739f, 0.978804708f},
-std::array<float,2>{0.260585487f, 0.400690258f},
-std::array<float,2>{0.725396633f, 0.374206752f},
-std::array<float,2>{0.484981477f, 0.807686806f},
-std::array<float,2>{0.958764911f, 0.54926163f},
-std::array<float,2>{0.157963097f, 0.183718294f},
-std::array<float,2>{0.581037819f, 0.21990855f},
-std::array<float,2>{0.326604724f, 0.570445478f},
-std::array<float,2>{0.844635785f, 0.842267096f},
-std::array<float,2>{0.0285632722f, 0.303075135f},
-std::array<float,2>{0.898525357f, 0.490608454f},
-std::array<float,2>{0.189516798f, 0.929977834f},
-std::array<float,2>{0.651451945f, 0.716362238f},
-std::array<float,2>{0.384994537f, 0.107004829f},
-std::array<float,2>{0.765848994f, 0.173801646f},
-std::array<float,2>{0.103836454f, 0.560969234f},
-std::array<float,2>{0.527878284f, 0.799437702f},
-std::array<float,2>{0.293944031f, 0.364387721f},
-std::array<float,2>{0.713395f, 0.398368359f},
-std::array<float,2>{0.450188994f, 0.972739995f},
-std::array<float,2>{0.975691915f, 0.684322834f},
-std::array<float,2>{0.13938646f, 0.0455739163f},
-std::array<float,2>{0.611466885f, 0.100606516f},
-std::array<float,2>{0.373184025f, 0.706039011f},
-std::array<float,2>{0.841302633f, 0.927711248f},
-std::array<float,2>{0.0463072211f, 0.498462498f},
-std::array<float,2>{0.912833273f, 0.308304995f},
-std::array<float,2>{0.246670127f, 0.835819781f},
-std::array<float,2>{0.659404874f, 0.568474114f},
-std::array<float,2>{0.435617179f, 0.231446728f},
-std::array<float,2>{0.968508363f, 0.00742702512f},
-std::array<float,2>{0.16409263f, 0.636996865f},
-std::array<float,2>{0.73431474f, 0.965064645f},
-std::array<float,2>{0.496220887f, 0.422833622f},
-std::array<float,2>{0.538681388f, 0.315653861f},
-std::array<float,2>{0.255648404f, 0.777423263f},
-std::array<float,2>{0.799227715f, 0.501473248f},
-std::array<float,2>{0.0770660415f, 0.146708757f},
-std::array<float,2>{0.648038924f, 0.210955799f},
-std::array<float,2>{0.382667124f, 0.616494894f},
-std::array<float,2>{0.894294202f, 0.865388811f},
-std::array<float,2>{0.196879745f, 0.262176543f},
-std::array<float,2>{0.856370211f, 0.4547396f},
-std::array<float,2>{0.0211855173f, 0.880135238f},
-std::array<float,2>{0.590569615f, 0.747984886f},
-std::array<float,2>{0.313595414f, 0.0936199427f},
-std::array<float,2>{0.876113653f, 0.235955715f},
-std::array<float,2>{0.207604662f, 0.586014748f},
-std::array<float,2>{0.637834609f, 0.816603363f},
-std::array<float,2>{0.392435163f, 0.290748954f},
-std::array<float,2>{0.570129454f, 0.473221242f},
-std::array<float,2>{0.337449372f, 0.911186755f},
-std::array<float,2>{0.868425488f, 0.690250456f},
-std::array<float,2>{0.00792150386f, 0.115870208f},
-std::array<float,2>{0.741153061f, 0.0573823303f},
-std::array<float,2>{0.472986966f, 0.668901265f},
-std::array<float,2>{0.947676182f, 0.990763068f},
-std::array<float,2>{0.186297044f, 0.379375339f},
-std::array<float,2>{0.793486595f, 0.350249439f},
-std::array<float,2>{0.0815756321f, 0.787518501f},
-std::array<float,2>{0.558203518f, 0.542295277f},
-std::array<float,2>{0.275458246f, 0.160080969f},
-std::array<float,2>{0.823776186f, 0.0743969381f},
-std::array<float,2>{0.0567558557f, 0.724147022f},
-std::array<float,2>{0.595000625f, 0.896110833f},
-std::array<float,2>{0.355980754f, 0.441985697f},
-std::array<float,2>{0.676343024f, 0.272210658f},
-std::array<float,2>{0.4216775f, 0.855316341f},
-std::array<float,2>{0.926478982f, 0.594639719f},
-std::array<float,2>{0.231327176f, 0.192287013f},
-std::array<float,2>{0.500227451f, 0.138781279f},
-std::array<float,2>{0.309564769f, 0.527870834f},
-std::array<float,2>{0.762702703f, 0.750853658f},
-std::array<float,2>{0.120736025f, 0.328873634f},
-std::array<float,2>{0.994506657f, 0.420278251f},
-std::array<float,2>{0.144210696f, 0.949573219f},
-std::array<float,2>{0.691041291f, 0.649782777f},
-std::array<float,2>{0.458009303f, 0.0294717122f},
-std::array<float,2>{0.788039148f, 0.229422897f},
-std::array<float,2>{0.0862172768f, 0.565208375f},
-std::array<float,2>{0.549440801f, 0.829751313f},
-std::array<float,2>{0.270130068f, 0.309951425f},
-std::array<float,2>{0.743124783f, 0.495319128f},
-std::array<float,2>{0.482015401f, 0.924785256f},
-std::array<float,2>{0.944565892f, 0.707222104f},
-std::array<float,2>{0.177969307f, 0.0961436108f},
-std::array<float,2>{0.570584834f, 0.0403893068f},
-std::array<float,2>{0.330910981f, 0.680494726f},
-std::array<float,2>{0.862906933f, 0.971976519f},
-std::array<float,2>{0.00589705072f, 0.391731948f},
-std::array<float,2>{0.887622058f, 0.359892607f},
-std::array<float,2>{0.215494365f, 0.801541984f},
-std::array<float,2>{0.626885593f, 0.556113541f},
-std::array<float,2>{0.405310571f, 0.17767176f},
-std::array<float,2>{0.988453627f, 0.0866215304f},
-std::array<float,2>{0.151281863f, 0.745822847f},
-std::array<float,2>{0.69630748f, 0.878375113f},
-std::array<float,2>{0.466831326f, 0.459023058f},
-std::array<float,2>{0.508560836f, 0.26154387f},
-std::array<float,2>{0.299579024f, 0.862901807f},
-std::array<float,2>{0.756322503f, 0.612988234f},
-std::array<float,2>{0.115434453f, 0.216296986f},
-std::array<float,2>{0.686393499f, 0.14304924f},
-std::array<float,2>{0.406932235f, 0.50587368f},
-std::array<float,2>{0.932064414f, 0.773439527f},
-std::array<float,2>{0.226021513f, 0.319465101f},
-std::array<float,2>{0.817432344f, 0.429017395f},
-std::array<float,2>{0.0489543006f, 0.961689472f},
-std::array<float,2>{0.609023154f, 0.635982096f},
-std::array<float,2>{0.349508911f, 0.000608419825f},
-std::array<float,2>{0.914113879f, 0.162446395f},
-std::array<float,2>{0.236713231f, 0.543008685f},
-std::array<float,2>{0.664115727f, 0.782343268f},
-std::array<float,2>{0.426113904f, 0.344247609f},
-std::array<float,2>{0.617285609f, 0.378358275f},
-std::array<float,2>{0.362042069f, 0.984454751f},
-std::array<float,2>{0.83063823f, 0.666448116f},
-std::array<float,2>{0.0354606099f, 0.0622833297f},
-std::array<float,2>{0.704586089f, 0.111303784f},
-std::array<float,2>{0.439809322f, 0.6938079f},
-std::array<float,2>{0.981297255f, 0.908564985f},
-std::array<float,2>{0.130752146f, 0.471184343f},
-std::array<float,2>{0.778372765f, 0.294819295f},
-std::array<float,2>{0.0943913087f, 0.813948989f},
-std::array<float,2>{0.517313182f, 0.59188652f},
-std::array<float,2>{0.283316374f, 0.240640685f},
-std::array<float,2>{0.85151571f, 0.0264888834f},
-std::array<float,2>{0.0236570407f, 0.652710438f},
-std::array<float,2>{0.582037807f, 0.946727335f},
-std::array<float,2>{0.322798908f, 0.414653867f},
-std::array<float,2>{0.655250549f, 0.33299315f},
-std::array<float,2>{0.388480633f, 0.756978095f},
-std::array<float,2>{0.903242588f, 0.523658156f},
-std::array<float,2>{0.195309594f, 0.136693582f},
-std::array<float,2>{0.539812684f, 0.18803592f},
-std::array<float,2>{0.261877656f, 0.598783195f},
-std::array<float,2>{0.808319509f, 0.857749879f},
-std::array<float,2>{0.0674503446f, 0.269511431f},
-std::array<float,2>{0.956320107f, 0.43797943f},
-std::array<float,2>{0.162331328f, 0.890902877f},
-std::array<float,2>{0.721835017f, 0.720352054f},
-std::array<float,2>{0.488789141f, 0.0735964775f},
-std::array<float,2>{0.836871147f, 0.126558527f},
-std::array<float,2>{0.0410240404f, 0.522746205f},
-std::array<float,2>{0.615466177f, 0.760871828f},
-std::array<float,2>{0.368486851f, 0.340535104f},
-std::array<float,2>{0.662050366f, 0.40675509f},
-std::array<float,2>{0.430855662f, 0.94416666f},
-std::array<float,2>{0.908232987f, 0.641764998f},
-std::array<float,2>{0.244084552f, 0.0200949796f},
-std::array<float,2>{0.5251683f, 0.0632840246f},
-std::array<float,2>{0.291448414f, 0.72902751f},
-std::array<float,2>{0.771338701f, 0.899319291f},
-std::array<float,2>{0.107192725f, 0.447378755f},
-std::array<float,2>{0.969058454f, 0.281062245f},
-std::array<float,2>{0.136626422f, 0.844175994f},
-std::array<float,2>{0.716711402f, 0.604612947f},
-std::array<float,2>{0.447301745f, 0.197454229f},
-std::array<float,2>{0.89568609f, 0.0494004376f},
-std::array<float,2>{0.201485202f, 0.661367834f},
-std::array<float,2>{0.641833544f, 0.997628212f},
-std::array<float,2>{0.375759393f, 0.390118748f},
-std::array<float,2>{0.587617278f, 0.351970464f},
-std::array<float,2>{0.316712469f, 0.792412281f},
-std::array<float,2>{0.853031635f, 0.534558654f},
-std::array<float,2>{0.0176519006f, 0.170666322f},
-std::array<float,2>{0.726929486f, 0.244204193f},
-std::array<float,2>{0.492803961f, 0.584332168f},
-std::array<float,2>{0.962975681f, 0.820327401f},
-std::array<float,2>{0.169792056f, 0.286312968f},
-std::array<float,2>{0.804171264f, 0.478662759f},
-std::array<float,2>{0.0710989535f, 0.920750737f},
-std::array<float,2>{0.533981085f, 0.70217824f},
-std::array<float,2>{0.251411587f, 0.122770518f},
-std::array<float,2>{0.950583339f, 0.206000581f},
-std::array<float,2>{0.180532202f, 0.621638596f},
-std::array<float,2>{0.736105442f, 0.870615363f},
-std::array<float,2>{0.471054196f, 0.253068805f},
-std::array<float,2>{0.560441315f, 0.465504229f},
-std::array<float,2>{0.280439705f, 0.888388932f},
-std::array<float,2>{0.789999902f, 0.740801156f},
-std::array<float,2>{0.0851233006f, 0.0792646855f},
-std::array<float,2>{0.635816813f, 0.00837746356f},
-std::array<float,2>{0.395844162f, 0.631943226f},
-std::array<float,2>{0.880568564f, 0.958542824f},
-std::array<float,2>{0.206169531f, 0.43535322f},
-std::array<float,2>{0.873676658f, 0.323944986f},
-std::array<float,2>{0.012734727f, 0.772958696f},
-std::array<float,2>{0.564875841f, 0.510049105f},
-std::array<float,2>{0.343102306f, 0.151434124f},
-std::array<float,2>{0.758242369f, 0.101645164f},
-std::array<float,2>{0.121998265f, 0.711393654f},
-std::array<float,2>{0.505750775f, 0.934696078f},
-std::array<float,2>{0.30736497f, 0.488160133f},
-std::array<float,2>{0.694401741f, 0.300598145f},
-std::array<float,2>{0.454237789f, 0.837040782f},
-std::array<float,2>{0.998607874f, 0.57442534f},
-std::array<float,2>{0.148014128f, 0.224865124f},
-std::array<float,2>{0.598566353f, 0.180195123f},
-std::array<float,2>{0.35220167f, 0.553958476f},
-std::array<float,2>{0.827230036f, 0.808735192f},
-std::array<float,2>{0.0615010187f, 0.367387861f},
-std::array<float,2>{0.923651278f, 0.404274434f},
-std::array<float,2>{0.228304237f, 0.982481182f},
-std::array<float,2>{0.673507571f, 0.675403953f},
-std::array<float,2>{0.417180389f, 0.0329232067f},
-std::array<float,2>{0.815378547f, 0.249893799f},
-std::array<float,2>{0.0539846085f, 0.579635441f},
-std::array<float,2>{0.604557276f, 0.825766981f},
-std::array<float,2>{0.343983471f, 0.28338781f},
-std::array<float,2>{0.680994332f, 0.48276484f},
-std::array<float,2>{0.412748605f, 0.915466785f},
-std::array<float,2>{0.934702337f, 0.695400417f},
-std::array<float,2>{0.220151499f, 0.117367551f},
-std::array<float,2>{0.511885226f, 0.0532776639f},
-std::array<float,2>{0.301619589f, 0.658882976f},
-std::array<float,2>{0.753646016f, 0.996088982f},
-std::array<float,2>{0.112873644f, 0.384425253f},
-std::array<float,2>{0.986602783f, 0.357401818f},
-std::array<float,2>{0.155812621f, 0.794710338f},
-std::array<float,2>{0.702924192f, 0.536970913f},
-std::array<float,2>{0.462681711f, 0.167605102f},
-std::array<float,2>{0.884751201f, 0.0687147602f},
-std::array<float,2>{0.21358341f, 0.732843578f},
-std::array<float,2>{0.632768214f, 0.904677153f},
-std::array<float,2>{0.40057078f, 0.44980973f},
-std::array<float,2>{0.577107668f, 0.277269542f},
-std::array<float,2>{0.335408539f, 0.849176347f},
-std::array<float,2>{0.864127576f, 0.606906891f},
-std::array<float,2>{0.00388067681f, 0.200463787f},
-std::array<float,2>{0.746128798f, 0.130683854f},
-std::array<float,2>{0.479869992f, 0.518879473f},
-std::array<float,2>{0.939486206f, 0.76283437f},
-std::array<float,2>{0.174936458f, 0.336380869f},
-std::array<float,2>{0.783053339f, 0.413508296f},
-std::array<float,2>{0.0934168771f, 0.941285968f},
-std::array<float,2>{0.551326334f, 0.646717906f},
-std::array<float,2>{0.268986076f, 0.0184343103f},
-std::array<float,2>{0.959211469f, 0.186777547f},
-std::array<float,2>{0.158868626f, 0.548428655f},
-std::array<float,2>{0.722952187f, 0.806116641f},
-std::array<float,2>{0.488254517f, 0.372580022f},
-std::array<float,2>{0.545525253f, 0.399691403f},
-std::array<float,2>{0.258063614f, 0.978013396f},
-std::array<float,2>{0.811901033f, 0.679291487f},
-std::array<float,2>{0.0657267496f, 0.0376287587f},
-std::array<float,2>{0.648534f, 0.107733123f},
-std::array<float,2>{0.382925421f, 0.718170822f},
-std::array<float,2>{0.90111196f, 0.932897985f},
-std::array<float,2>{0.187648594f, 0.489672512f},
-std::array<float,2>{0.846800923f, 0.301687688f},
-std::array<float,2>{0.0309846904f, 0.840340436f},
-std::array<float,2>{0.579509795f, 0.573210835f},
-std::array<float,2>{0.324943423f, 0.220920026f},
-std::array<float,2>{0.776453674f, 0.0153120514f},
-std::array<float,2>{0.099178955f, 0.626176059f},
-std::array<float,2>{0.520723462f, 0.955565512f},
-std::array<float,2>{0.287350357f, 0.432993501f},
-std::array<float,2>{0.710665703f, 0.326094627f},
-std::array<float,2>{0.443636149f, 0.767005026f},
-std::array<float,2>{0.979113877f, 0.512465954f},
-std::array<float,2>{0.126449406f, 0.156211346f},
-std::array<float,2>{0.624624133f, 0.207676217f},
-std::array<float,2>{0.366676539f, 0.620961487f},
-std::array<float,2>{0.835027814f, 0.872507691f},
-std::array<float,2>{0.0318301432f, 0.257609159f},
-std::array<float,2>{0.921531796f, 0.463925064f},
-std::array<float,2>{0.238772556f, 0.885146379f},
-std::array<float,2>{0.6697703f, 0.73805058f},
-std::array<float,2>{0.423062295f, 0.0834704638f},
-std::array<float,2>{0.798153102f, 0.145606995f},
-std::array<float,2>{0.0744142085f, 0.502251565f},
-std::array<float,2>{0.536463439f, 0.779954255f},
-std::array<float,2>{0.255990207f, 0.313578576f},
-std::array<float,2>{0.731642008f, 0.424071282f},
-std::array<float,2>{0.499442726f, 0.968097568f},
-std::array<float,2>{0.965803802f, 0.639635146f},
-std::array<float,2>{0.166221291f, 0.0043336302f},
-std::array<float,2>{0.592460752f, 0.0900418609f},
-std::array<float,2>{0.316086233f, 0.749604881f},
-std::array<float,2>{0.857764125f, 0.881549597f},
-std::array<float,2>{0.0234113857f, 0.455268592f},
-std::array<float,2>{0.891754985f, 0.265023619f},
-std::array<float,2>{0.198947474f, 0.864067733f},
-std::array<float,2>{0.64536494f, 0.614240348f},
-std::array<float,2>{0.379867136f, 0.213632181f},
-std::array<float,2>{0.974228978f, 0.0437709205f},
-std::array<float,2>{0.136901647f, 0.686897218f},
-std::array<float,2>{0.712322116f, 0.97494024f},
-std::array<float,2>{0.451865762f, 0.395467848f},
-std::array<float,2>{0.529305756f, 0.366695821f},
-std::array<float,2>{0.296816409f, 0.797192991f},
-std::array<float,2>{0.769164026f, 0.559005499f},
-std::array<float,2>{0.101708338f, 0.174603239f},
-std::array<float,2>{0.657368779f, 0.233044714f},
-std::array<float,2>{0.434579164f, 0.566807985f},
-std::array<float,2>{0.910327435f, 0.833034039f},
-std::array<float,2>{0.249478921f, 0.306430936f},
-std::array<float,2>{0.843425512f, 0.496128947f},
-std::array<float,2>{0.043672286f, 0.928932607f},
-std::array<float,2>{0.611028671f, 0.703195572f},
-std::array<float,2>{0.372098982f, 0.0995005295f},
-std::array<float,2>{0.929382324f, 0.194623664f},
-std::array<float,2>{0.233067885f, 0.595928013f},
-std::array<float,2>{0.67815578f, 0.851817489f},
-std::array<float,2>{0.417984396f, 0.269674629f},
-std::array<float,2>{0.597013891f, 0.444830447f},
-std::array<float,2>{0.35799998f, 0.898433983f},
-std::array<float,2>{0.821835876f, 0.725859404f},
-std::array<float,2>{0.0551262721f, 0.0780292004f},
-std::array<float,2>{0.688087404f, 0.0282780863f},
-std::array<float,2>{0.45943594f, 0.651038826f},
-std::array<float,2>{0.992447138f, 0.952916265f},
-std::array<float,2>{0.141945079f, 0.418362349f},
-std::array<float,2>{0.763897777f, 0.331296384f},
-std::array<float,2>{0.11753469f, 0.753293037f},
-std::array<float,2>{0.503446758f, 0.530669868f},
-std::array<float,2>{0.310742527f, 0.137006298f},
-std::array<float,2>{0.870427489f, 0.114126846f},
-std::array<float,2>{0.0104428157f, 0.688763142f},
-std::array<float,2>{0.567193329f, 0.913230419f},
-std::array<float,2>{0.338085562f, 0.475488245f},
-std::array<float,2>{0.639784575f, 0.29116559f},
-std::array<float,2>{0.393346161f, 0.818758965f},
-std::array<float,2>{0.877723515f, 0.588651717f},
-std::array<float,2>{0.209298238f, 0.23729451f},
-std::array<float,2>{0.555798709f, 0.157592267f},
-std::array<float,2>{0.27411145f, 0.539704144f},
-std::array<float,2>{0.795232296f, 0.786862493f},
-std::array<float,2>{0.0786440149f, 0.348477155f},
-std::array<float,2>{0.945623517f, 0.381908715f},
-std::array<float,2>{0.185068145f, 0.988425136f},
-std::array<float,2>{0.739976823f, 0.671565056f},
-std::array<float,2>{0.476366401f, 0.0566157103f},
-std::array<float,2>{0.755076408f, 0.218494862f},
-std::array<float,2>{0.114722542f, 0.609596074f},
-std::array<float,2>{0.510038793f, 0.860497296f},
-std::array<float,2>{0.298064619f, 0.258192748f},
-std::array<float,2>{0.698214054f, 0.458824605f},
-std::array<float,2>{0.46554333f, 0.876708865f},
-std::array<float,2>{0.991454959f, 0.743556857f},
-std::array<float,2>{0.148549557f, 0.089527227f},
-std::array<float,2>{0.605841219f, 0.00273943716f},
-std::array<float,2>{0.349915683f, 0.63401711f},
-std::array<float,2>{0.820061266f, 0.96349597f},
-std::array<float,2>{0.0471313186f, 0.425996393f},
-std::array<float,2>{0.930068731f, 0.31696099f},
-std::array<float,2>{0.223731622f, 0.775528491f},
-std::array<float,2>{0.684233665f, 0.504206181f},
-std::array<float,2>{0.408442855f, 0.142200902f},
-std::array<float,2>{0.942925155f, 0.0954538956f},
-std::array<float,2>{0.176628485f, 0.7102983f},
-std::array<float,2>{0.745538116f, 0.923788548f},
-std::array<float,2>{0.48405385f, 0.493655711f},
-std::array<float,2>{0.547781646f, 0.310722858f},
-std::array<float,2>{0.272214025f, 0.832002699f},
-std::array<float,2>{0.78668189f, 0.563183784f},
-std::array<float,2>{0.0893042758f, 0.22814852f},
-std::array<float,2>{0.627311289f, 0.178184658f},
-std::array<float,2>{0.404241979f, 0.557723105f},
-std::array<float,2>{0.889025152f, 0.803216219f},
-std::array<float,2>{0.216994077f, 0.361337185f},
-std::array<float,2>{0.861226737f, 0.394062489f},
-std::array<float,2>{0.00574397808f, 0.969637573f},
-std::array<float,2>{0.574041486f, 0.682385862f},
-std::array<float,2>{0.328813761f, 0.0428530052f},
-std::array<float,2>{0.904333115f, 0.133586749f},
-std::array<float,2>{0.192532182f, 0.526960373f},
-std::array<float,2>{0.653346241f, 0.75475508f},
-std::array<float,2>{0.389634848f, 0.334107846f},
-std::array<float,2>{0.584774017f, 0.416188687f},
-std::array<float,2>{0.320410639f, 0.948586583f},
-std::array<float,2>{0.849415779f, 0.655190587f},
-std::array<float,2>{0.0268667005f, 0.0239722636f},
-std::array<float,2>{0.720081925f, 0.071016416f},
-std::array<float,2>{0.491861701f, 0.721158981f},
-std::array<float,2>{0.953500807f, 0.894185483f},
-std::array<float,2>{0.160412401f, 0.439802259f},
-std::array<float,2>{0.804792523f, 0.265912503f},
-std::array<float,2>{0.0695326999f, 0.857217789f},
-std::array<float,2>{0.541943491f, 0.601067364f},
-std::array<float,2>{0.26534754f, 0.190572217f},
-std::array<float,2>{0.830029964f, 0.0587320365f},
-std::array<float,2>{0.0378314443f, 0.665026248f},
-std::array<float,2>{0.620482087f, 0.987777889f},
-std::array<float,2>{0.361307055f, 0.375998527f},
-std::array<float,2>{0.666644812f, 0.346085072f},
-std::array<float,2>{0.429083586f, 0.784420013f},
-std::array<float,2>{0.91699785f, 0.546463013f},
-std::array<float,2>{0.235523835f, 0.161479026f},
-std::array<float,2>{0.519401252f, 0.239973038f},
-std::array<float,2>{0.281585872f, 0.591764808f},
-std::array<float,2>{0.780431926f, 0.814963579f},
-std::array<float,2>{0.0962672979f, 0.295241624f},
-std::array<float,2>{0.983255267f, 0.468809545f},
-std::array<float,2>{0.131574392f, 0.907627344f},
-std::array<float,2>{0.705702126f, 0.691574275f},
-std::array<float,2>{0.438635021f, 0.112320125f},
-std::array<float,2>{0.855080366f, 0.169732451f},
-std::array<float,2>{0.0170792285f, 0.532788455f},
-std::array<float,2>{0.589448154f, 0.790213406f},
-std::array<float,2>{0.320088714f, 0.354332268f},
-std::array<float,2>{0.642722428f, 0.386999428f},
-std::array<float,2>{0.377266854f, 0.999832094f},
-std::array<float,2>{0.898271143f, 0.662564158f},
-std::array<float,2>{0.199936479f, 0.0473080426f},
-std::array<float,2>{0.531860888f, 0.124007083f},
-std::array<float,2>{0.252324849f, 0.700084209f},
-std::array<float,2>{0.801371336f, 0.919211805f},
-std::array<float,2>{0.0739160627f, 0.477415949f},
-std::array<float,2>{0.961681306f, 0.287648588f},
-std::array<float,2>{0.170803487f, 0.822295129f},
-std::array<float,2>{0.72989738f, 0.583912671f},
-std::array<float,2>{0.495185792f, 0.242938802f},
-std::array<float,2>{0.906300902f, 0.0214943327f},
-std::array<float,2>{0.244572878f, 0.642737269f},
-std::array<float,2>{0.662220061f, 0.943010867f},
-std::array<float,2>{0.433225542f, 0.409793079f},
-std::array<float,2>{0.613375485f, 0.341905773f},
-std::array<float,2>{0.369853884f, 0.757941484f},
-std::array<float,2>{0.838503182f, 0.520102322f},
-std::array<float,2>{0.0397973843f, 0.128362775f},
-std::array<float,2>{0.717483222f, 0.197063521f},
-std::array<float,2>{0.446123391f, 0.602859378f},
-std::array<float,2>{0.972389579f, 0.846178293f},
-std::array<float,2>{0.133747116f, 0.277493745f},
-std::array<float,2>{0.771981299f, 0.446824819f},
-std::array<float,2>{0.107819133f, 0.900937319f},
-std::array<float,2>{0.527155578f, 0.727645695f},
-std::array<float,2>{0.289584756f, 0.0644612238f},
-std::array<float,2>{0.997042358f, 0.222817004f},
-std::array<float,2>{0.146376252f, 0.57774359f},
-std::array<float,2>{0.691827595f, 0.839401782f},
-std::array<float,2>{0.456641287f, 0.297348171f},
-std::array<float,2>{0.505860984f, 0.485599786f},
-std::array<float,2>{0.305227786f, 0.93656981f},
-std::array<float,2>{0.761684299f, 0.71452415f},
-std::array<float,2>{0.123563588f, 0.105358191f},
-std::array<float,2>{0.675686061f, 0.0346690491f},
-std::array<float,2>{0.415556431f, 0.672190249f},
-std::array<float,2>{0.924389303f, 0.980989158f},
-std::array<float,2>{0.230252415f, 0.404638261f},
-std::array<float,2>{0.825768113f, 0.370493472f},
-std::array<float,2>{0.0592845194f, 0.810732782f},
-std::array<float,2>{0.601080656f, 0.552333117f},
-std::array<float,2>{0.354337424f, 0.182654992f},
-std::array<float,2>{0.791719377f, 0.0802943185f},
-std::array<float,2>{0.083922416f, 0.739935875f},
-std::array<float,2>{0.561359406f, 0.889903009f},
-std::array<float,2>{0.278105408f, 0.468093127f},
-std::array<float,2>{0.737228394f, 0.250008166f},
-std::array<float,2>{0.46969521f, 0.868736327f},
-std::array<float,2>{0.952075303f, 0.624985456f},
-std::array<float,2>{0.182137012f, 0.20474878f},
-std::array<float,2>{0.56250155f, 0.149596348f},
-std::array<float,2>{0.341330796f, 0.50963968f},
-std::array<float,2>{0.872315824f, 0.77034688f},
-std::array<float,2>{0.0137237869f, 0.320556045f},
-std::array<float,2>{0.882341504f, 0.43743819f},
-std::array<float,2>{0.203228951f, 0.960491657f},
-std::array<float,2>{0.634390175f, 0.63052243f},
-std::array<float,2>{0.397283703f, 0.0106904702f}}
\ No newline at end of file